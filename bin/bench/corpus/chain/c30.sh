@@ -0,0 +1,2001 @@
+		printf cd then 'quoted text' --verbose readonly
+	&& cd 'quoted text' test local 2>/dev/null then awk
+	| cd awk --verbose echo export 'quoted text'
+		sed echo | 'quoted text' grep sed
+		cd grep /usr/bin awk awk | readonly 'quoted text' && "$1" $(pwd) "$@" test sed
+	export done test grep 2>/dev/null -eu -eu echo test
+		'quoted text' done x=1 $(pwd)
+sed test awk cd 2>/dev/null printf "$1" test "$@" && echo 'quoted text' export
+		'quoted text' export /usr/bin local cd test sed
+	${HOME} readonly echo | 2>/dev/null echo test local ${HOME} test -eu ${HOME}
+		x=1 printf printf -eu test -eu awk $(pwd) $(pwd) | awk "$@" && test
+		printf export x=1 readonly done -eu echo 'quoted text' /usr/bin
+		/usr/bin local sed && 2>/dev/null "$1" local readonly
+	$(pwd) echo readonly awk printf test 2>/dev/null 'quoted text'
+grep done done "$@" $(pwd) 'quoted text' awk $(pwd) 'quoted text'
+	'quoted text' printf sed $(pwd) grep -eu readonly then
+		printf && 'quoted text' "$@"
+		done x=1 | x=1 export export awk $(pwd)
+awk -eu awk printf --verbose ${HOME} 2>/dev/null
+2>/dev/null test sed "$1" echo
+local cd then sed ${HOME}
+		'quoted text' ${HOME} && x=1 local
+	${HOME} -eu echo echo ${HOME} | grep && x=1 -eu cd then | test /usr/bin && /usr/bin
+	x=1 | -eu echo readonly local --verbose "$1" $(pwd) -eu
+$(pwd) $(pwd) -eu x=1 test ${HOME} $(pwd) sed test
+	sed --verbose ${HOME} "$1" ${HOME} printf cd
+	grep && ${HOME} "$@" "$@" 2>/dev/null
+echo x=1 test x=1 sed export && sed 2>/dev/null
+	cd done test $(pwd) export cd printf readonly sed "$@" readonly echo then cd
+--verbose done "$1" export
+${HOME} /usr/bin awk local
+	$(pwd) "$1" | sed then /usr/bin
+		x=1 /usr/bin 'quoted text' $(pwd) 2>/dev/null
+done then printf x=1 'quoted text' local test
+	"$1" && "$@" 'quoted text' local "$1" export echo
+		printf 2>/dev/null && cd -eu grep readonly printf
+		--verbose "$1" "$1" "$1" cd echo awk local /usr/bin local grep $(pwd) ${HOME} cd
+	awk echo printf /usr/bin then "$@" printf awk -eu
+	local test grep cd x=1 printf readonly export && readonly
+	| ${HOME} echo "$1" /usr/bin then --verbose
+	| -eu x=1 && cd | $(pwd) then sed cd x=1 "$1" | | then printf $(pwd) grep -eu
+		export test -eu printf grep ${HOME}
+		then $(pwd) /usr/bin | echo echo "$@" local readonly
+	"$@" -eu x=1 ${HOME} --verbose -eu -eu readonly x=1
+		$(pwd) echo cd then printf cd
+	&& ${HOME} awk sed /usr/bin
+then | 2>/dev/null sed readonly x=1
+"$1" | --verbose cd awk ${HOME} x=1 /usr/bin then echo export awk awk grep
+	printf awk /usr/bin test export cd | -eu | /usr/bin export sed "$@" local
+		"$@" grep echo cd ${HOME} ${HOME} $(pwd) export
+		-eu printf grep local awk awk 2>/dev/null cd done && x=1 $(pwd) ${HOME} grep
+&& sed "$1" "$@" "$1" && -eu printf done 2>/dev/null
+sed then grep awk $(pwd) done sed test x=1 done 2>/dev/null
+		grep done && "$@" x=1 then sed | 2>/dev/null /usr/bin "$@" local /usr/bin readonly
+		--verbose sed ${HOME} | ${HOME} "$@" printf && | awk local 'quoted text'
+sed 'quoted text' "$@" 'quoted text' "$1" cd | $(pwd)
+readonly 'quoted text' --verbose 'quoted text' "$1"
+echo --verbose $(pwd) sed export -eu x=1 awk $(pwd) export ${HOME} grep -eu |
+grep x=1 -eu awk local awk awk printf
+		export export 2>/dev/null -eu local readonly local 'quoted text'
+$(pwd) "$1" readonly 'quoted text' -eu cd "$@" --verbose -eu
+echo && cd grep "$@" local
+		export then grep 2>/dev/null grep readonly
+	| && sed echo cd "$@" echo 2>/dev/null awk done local
+	sed then then grep cd "$@" ${HOME} export "$@" && echo local done
+	"$1" local ${HOME} "$@" ${HOME} x=1 --verbose --verbose printf ${HOME}
+	x=1 test cd readonly 2>/dev/null cd then /usr/bin
+		"$@" export grep then ${HOME} done $(pwd) ${HOME} ${HOME} done
+done then cd sed "$1" awk local ${HOME} done && --verbose 2>/dev/null printf
+export then local /usr/bin export awk test
+		x=1 $(pwd) -eu && | export done local 'quoted text' printf echo sed local
+/usr/bin /usr/bin then
+	'quoted text' 2>/dev/null test | readonly
+		done | sed cd 'quoted text' 2>/dev/null
+		| test 'quoted text' then readonly
+	grep sed export printf $(pwd) grep 'quoted text' /usr/bin
+		printf cd printf --verbose $(pwd) -eu
+	grep export "$1" grep 'quoted text' | | echo printf /usr/bin cd ${HOME}
+| ${HOME} -eu /usr/bin test 2>/dev/null export x=1 then grep then
+	sed awk x=1 done 'quoted text'
+		-eu -eu 2>/dev/null test --verbose 'quoted text' 2>/dev/null done x=1 test
+	&& done cd export then test then then printf readonly
+local export cd grep "$@" | printf 2>/dev/null
+done then ${HOME} ${HOME} 'quoted text'
+"$1" export sed 2>/dev/null x=1 "$1" export cd 2>/dev/null
+		2>/dev/null ${HOME} 'quoted text' 2>/dev/null cd
+		${HOME} --verbose printf | awk test 'quoted text'
+		readonly /usr/bin local -eu -eu --verbose "$@" local local grep readonly printf
+	'quoted text' printf echo cd x=1 awk readonly
+	local printf /usr/bin $(pwd) 2>/dev/null
+local x=1 | cd | "$1" | then "$@" ${HOME} ${HOME} printf
+	readonly --verbose -eu done $(pwd) x=1
+printf ${HOME} x=1 $(pwd) && done printf export echo
+		${HOME} 'quoted text'
+'quoted text' "$@" then cd
+done x=1 test --verbose x=1 -eu test cd 'quoted text' then
+test done -eu -eu --verbose
+		then $(pwd) | printf local test test cd export
+		--verbose x=1 && done x=1 $(pwd) then readonly | | "$1" 2>/dev/null sed
+		$(pwd) "$@" /usr/bin "$1" && cd readonly local 2>/dev/null
+		-eu echo 2>/dev/null readonly grep readonly --verbose
+	${HOME} --verbose ${HOME} -eu x=1 echo "$@" awk done
+/usr/bin readonly awk | 'quoted text' /usr/bin /usr/bin local readonly
+	export $(pwd) 2>/dev/null $(pwd)
+	/usr/bin done --verbose then cd cd sed /usr/bin 2>/dev/null
+$(pwd) "$1" awk export printf then 2>/dev/null "$1" export -eu readonly 'quoted text'
+| cd /usr/bin then 2>/dev/null done $(pwd)
+		readonly -eu $(pwd) test sed "$1" readonly ${HOME} grep
+		readonly awk "$1" $(pwd) && "$1"
+	sed 'quoted text' export then "$@" grep printf
+then -eu 'quoted text' /usr/bin done
+| --verbose x=1 printf 2>/dev/null
+"$@" && readonly /usr/bin $(pwd) "$@" --verbose | awk ${HOME}
+export $(pwd) awk readonly awk test ${HOME} ${HOME} local
+	grep -eu cd "$@" done local done
+	$(pwd) readonly printf awk
+printf 2>/dev/null echo readonly test test x=1 ${HOME} local 2>/dev/null test
+		2>/dev/null done readonly done cd cd export x=1 | test &&
+	grep | grep then -eu then export local -eu $(pwd)
+done grep $(pwd) -eu grep /usr/bin 'quoted text'
+		| export echo local local
+	x=1 awk cd echo "$@" 'quoted text' 'quoted text' awk then local export local $(pwd)
+awk cd "$1" "$@" then "$@" grep done "$@" && x=1 done | done $(pwd) local 2>/dev/null
+		test /usr/bin 2>/dev/null done --verbose done "$@" "$@" "$@" "$@" && --verbose
+		"$1" echo --verbose 2>/dev/null awk && echo awk -eu done sed grep echo cd "$@" $(pwd)
+		export grep export ${HOME} "$@" "$1" printf export
+2>/dev/null /usr/bin echo x=1 readonly x=1 awk && x=1 sed sed "$@" local
+cd /usr/bin x=1 /usr/bin | 'quoted text' | local cd sed x=1 -eu
+		local $(pwd) /usr/bin "$@" readonly -eu test awk "$1" cd grep
+		printf then 'quoted text' | export "$1" |
+	printf awk grep then awk readonly "$@" export "$@" local grep export x=1 ${HOME}
+readonly -eu awk done x=1
+	-eu && grep then 2>/dev/null
+		then /usr/bin echo /usr/bin export ${HOME} --verbose "$@" "$@" "$1" /usr/bin
+		then printf /usr/bin export ${HOME} then && | then printf
+grep test done export cd grep local 2>/dev/null then printf 2>/dev/null
+readonly | cd x=1 'quoted text' "$@" && --verbose -eu | grep sed then local
+export grep grep readonly then test export grep cd cd x=1 ${HOME} done
+		&& 2>/dev/null done x=1 awk printf cd awk 'quoted text' printf cd $(pwd) ${HOME}
+		local /usr/bin cd readonly
+done 'quoted text' -eu cd -eu /usr/bin /usr/bin
+		'quoted text' 'quoted text' then local local |
+	sed 'quoted text' x=1 sed ${HOME} then 'quoted text' | ${HOME} $(pwd) export
+	--verbose test && 2>/dev/null
+grep readonly test readonly
+| /usr/bin --verbose printf printf test && 'quoted text'
+		&& echo ${HOME} $(pwd) local printf --verbose ${HOME}
+		| && local --verbose local ${HOME} "$@" readonly
+		${HOME} "$1" awk "$1" cd printf readonly $(pwd) local 'quoted text' done
+	x=1 test -eu done printf
+	--verbose test ${HOME}
+		/usr/bin ${HOME} ${HOME} then
+		"$1" awk done x=1 'quoted text' echo "$1" /usr/bin
+	--verbose | x=1 $(pwd) x=1 export printf | -eu ${HOME} && x=1 | | local cd local
+echo | test echo "$@" | test ${HOME} --verbose
+		awk x=1 "$@" readonly local test readonly "$@" ${HOME} 2>/dev/null
+		cd echo sed grep "$1" then ${HOME} "$@" local awk "$1"
+		--verbose x=1 ${HOME} cd sed "$@" "$@" cd sed $(pwd) $(pwd) && &&
+	printf 'quoted text' -eu
+		local "$@" export grep awk readonly test "$@" echo then 'quoted text' awk
+awk /usr/bin 'quoted text' && ${HOME} readonly -eu
+		-eu local echo x=1 then printf
+	test 'quoted text' local x=1
+	'quoted text' done /usr/bin 'quoted text'
+${HOME} --verbose printf printf "$@" local
+		"$@" readonly "$1" | sed -eu 'quoted text' && 2>/dev/null
+${HOME} echo readonly readonly /usr/bin "$1" sed x=1 x=1 | readonly
+"$1" /usr/bin x=1 && local
+echo "$@" x=1 export readonly 'quoted text'
+	local ${HOME} awk 2>/dev/null
+--verbose 2>/dev/null "$1" 'quoted text' test grep | --verbose ${HOME} awk grep
+export test echo "$@" local done awk /usr/bin done
+	local "$@" export sed 'quoted text' 2>/dev/null then $(pwd) test printf 'quoted text'
+x=1 'quoted text' then export "$1"
+	$(pwd) | test local done readonly x=1 local "$@" local && export awk
+	&& readonly then test -eu echo export 2>/dev/null | test done awk
+"$1" -eu local $(pwd) ${HOME} local then echo readonly
+	/usr/bin /usr/bin done then export local $(pwd) local
+		echo cd 'quoted text' $(pwd) echo ${HOME}
+		x=1 test | --verbose "$@" $(pwd) | grep x=1 -eu printf /usr/bin
+	then cd sed awk readonly -eu awk
+	readonly $(pwd) sed ${HOME} 'quoted text' -eu && | readonly export -eu
+	'quoted text' then done awk then "$1" 'quoted text'
+	grep "$@" echo --verbose sed ${HOME} cd export /usr/bin "$1"
+/usr/bin local done then /usr/bin
+"$@" --verbose then "$@" test
+		&& then then $(pwd) --verbose --verbose
+"$1" && grep test "$@" local $(pwd) 'quoted text'
+	echo --verbose x=1 grep -eu cd --verbose 2>/dev/null $(pwd) 2>/dev/null --verbose
+x=1 && $(pwd) awk done x=1 --verbose done 'quoted text'
+readonly 'quoted text' readonly $(pwd) $(pwd) --verbose
+grep then | -eu 2>/dev/null | sed | 'quoted text'
+'quoted text' && test awk | cd cd && done printf
+	| /usr/bin && ${HOME}
+		local /usr/bin then | "$@" 2>/dev/null /usr/bin grep sed export | export
+		cd echo readonly -eu awk -eu printf
+test --verbose printf && awk x=1 $(pwd)
+	"$1" local ${HOME} export cd cd "$@" test printf export then 'quoted text'
+	grep cd printf printf awk test
+2>/dev/null | cd then -eu "$@" /usr/bin local
+'quoted text' grep printf done x=1 readonly local /usr/bin awk
+${HOME} x=1 && "$1" then sed 2>/dev/null then 2>/dev/null
+	&& done 'quoted text' sed
+		sed "$@" echo grep ${HOME} | | x=1
+		'quoted text' /usr/bin x=1 awk -eu readonly
+		x=1 awk cd && awk export then awk printf export local test 2>/dev/null
+		done 'quoted text' awk
+2>/dev/null then && local printf
+		| local && 2>/dev/null grep /usr/bin awk export cd local awk test test $(pwd)
+	printf done test sed then
+/usr/bin echo --verbose export -eu echo printf $(pwd)
+printf x=1 export awk 2>/dev/null printf "$@" "$@" then
+	local --verbose printf cd cd $(pwd) /usr/bin && sed
+	export --verbose /usr/bin test 2>/dev/null x=1 $(pwd) 2>/dev/null x=1
+$(pwd) grep --verbose "$1" then $(pwd) "$1" && "$1"
+	"$@" x=1 then ${HOME} export $(pwd) --verbose then 'quoted text'
+		then /usr/bin "$1" awk test local $(pwd) /usr/bin 'quoted text' --verbose
+		printf awk x=1 local local --verbose $(pwd) "$@" && readonly printf 'quoted text'
+		2>/dev/null test done | cd sed then sed && printf test -eu done | --verbose
+	--verbose test 2>/dev/null "$@" x=1 --verbose
+		$(pwd) cd cd ${HOME} done "$1" export sed cd done 'quoted text'
+	then | awk && grep sed sed then
+		grep | /usr/bin $(pwd) ${HOME} readonly 'quoted text' && sed local -eu --verbose
+	/usr/bin 2>/dev/null grep ${HOME} grep sed sed "$@" -eu | done | printf 2>/dev/null
+${HOME} sed -eu export -eu done printf
+	${HOME} awk printf awk /usr/bin cd export ${HOME}
+2>/dev/null ${HOME} test x=1 /usr/bin /usr/bin /usr/bin then -eu && 'quoted text'
+$(pwd) $(pwd) test cd -eu -eu awk 'quoted text' echo --verbose
+sed export | readonly awk | /usr/bin local echo $(pwd) | done /usr/bin
+		$(pwd) readonly "$1" --verbose ${HOME} /usr/bin awk readonly
+	x=1 "$@" ${HOME} grep $(pwd) done echo cd printf done local sed sed --verbose
+	local echo printf readonly --verbose
+--verbose x=1 "$@" /usr/bin 2>/dev/null
+	awk -eu done done grep 2>/dev/null
+sed local $(pwd) test x=1 sed test --verbose done cd test test grep
+	/usr/bin printf && /usr/bin x=1 && echo
+	then $(pwd) && test sed export cd printf --verbose $(pwd) readonly 'quoted text'
+"$1" awk -eu sed 2>/dev/null grep awk printf test 'quoted text' --verbose && "$1"
+		done grep readonly done | "$1" | readonly && "$1" | grep 'quoted text' export
+		test grep printf | $(pwd) "$@" /usr/bin readonly ${HOME} echo $(pwd) then
+		"$@" export then --verbose test "$1" --verbose 'quoted text' cd && /usr/bin then
+done && ${HOME} export "$1"
+		"$1" awk awk export /usr/bin local awk "$1"
+"$1" x=1 echo x=1 ${HOME} grep "$@" x=1 cd awk
+2>/dev/null done readonly 'quoted text' sed 2>/dev/null cd && done readonly
+test echo ${HOME} /usr/bin grep ${HOME} "$@" printf awk && then cd export
+	cd 'quoted text' readonly
+echo x=1 echo export done
+grep local && 2>/dev/null local export /usr/bin
+		${HOME} printf ${HOME} sed cd $(pwd)
+	test ${HOME} export readonly -eu | grep cd --verbose
+		export then echo readonly "$@" | cd echo printf && sed
+	awk export echo "$@" cd sed printf
+	x=1 -eu 'quoted text' awk
+	2>/dev/null done then sed grep then 'quoted text'
+/usr/bin echo x=1 printf then x=1 $(pwd)
+	echo "$@" /usr/bin "$1" "$1" grep local && awk 'quoted text' local x=1 && echo
+		-eu then 2>/dev/null /usr/bin /usr/bin 'quoted text' echo "$1" &&
+	/usr/bin test test export "$1" done sed --verbose -eu /usr/bin awk cd local
+then done -eu sed test local
+		then "$@" export -eu --verbose
+$(pwd) grep awk | then x=1 sed "$@" cd | awk 2>/dev/null
+		${HOME} 2>/dev/null | ${HOME} done
+		cd grep echo /usr/bin $(pwd) echo test "$1" local | "$@" echo sed
+	"$@" local "$@" local 2>/dev/null local sed grep /usr/bin 2>/dev/null
+		--verbose "$1" printf awk test
+		cd -eu x=1 printf awk 'quoted text' "$@"
+	/usr/bin ${HOME} "$1" x=1 done --verbose printf done "$1" local done then
+test printf | -eu --verbose readonly grep local cd done "$1" | /usr/bin
+		&& grep sed x=1 then local "$1" ${HOME} echo -eu then ${HOME} "$@" 'quoted text'
+export ${HOME} test echo grep --verbose && echo sed
+		| x=1 cd 'quoted text' done x=1 2>/dev/null
+export readonly && awk sed printf awk echo done grep "$@" sed 2>/dev/null
+	then cd echo --verbose grep grep test test x=1 sed printf --verbose
+2>/dev/null then 2>/dev/null $(pwd) 'quoted text' local grep -eu echo
+awk --verbose /usr/bin export grep test /usr/bin echo printf
+		local done | $(pwd) cd /usr/bin /usr/bin "$1" printf $(pwd)
+		export export --verbose printf /usr/bin cd local echo 2>/dev/null | printf grep
+printf ${HOME} sed x=1 printf test done -eu /usr/bin echo
+		x=1 sed done -eu && done grep done x=1 cd ${HOME} then "$1" "$@" test
+sed --verbose 2>/dev/null "$1" awk /usr/bin -eu --verbose
+		&& test --verbose 2>/dev/null done ${HOME}
+	$(pwd) echo | --verbose
+'quoted text' then --verbose done | readonly ${HOME} "$@" 2>/dev/null
+		then then printf readonly printf ${HOME} /usr/bin "$1" export sed x=1 $(pwd)
+"$1" "$@" ${HOME} cd readonly export grep done echo 2>/dev/null done
+		/usr/bin | $(pwd) echo "$1" /usr/bin
+		--verbose test 2>/dev/null local
+	echo && cd "$1" test cd ${HOME} grep sed 'quoted text' test
+2>/dev/null readonly 'quoted text'
+		sed awk printf --verbose /usr/bin grep readonly then test cd
+	$(pwd) sed local ${HOME} grep
+	local done && -eu readonly grep grep echo
+	"$1" grep --verbose 'quoted text'
+sed then /usr/bin readonly
+		echo && local "$1" $(pwd) awk -eu local done /usr/bin
+		"$@" done awk export -eu test done done | "$1" then done $(pwd) --verbose
+done "$@" 'quoted text' then awk && sed done && grep "$1" readonly /usr/bin
+/usr/bin export local echo echo --verbose -eu
+	export /usr/bin sed local local
+	2>/dev/null test cd readonly done | echo awk test local 'quoted text' cd ${HOME}
+		-eu /usr/bin sed test x=1 test cd test
+'quoted text' done grep | echo 'quoted text'
+		$(pwd) | sed then $(pwd) 2>/dev/null
+		-eu grep "$@" test then echo grep 'quoted text'
+		echo export /usr/bin ${HOME}
+	sed export "$1" local
+	2>/dev/null /usr/bin "$@" echo printf
+		echo -eu then readonly 2>/dev/null && --verbose cd local awk | "$@" export echo
+	-eu sed 2>/dev/null "$1" && readonly --verbose
+	2>/dev/null local awk | grep | test "$@" --verbose test "$@" "$1" printf
+x=1 && --verbose "$1" && cd | "$@" then
+		then export -eu test test
+		"$1" export $(pwd) cd 2>/dev/null /usr/bin test sed local x=1
+x=1 local grep "$1" sed cd -eu done export awk local "$@" -eu cd && grep 'quoted text'
+"$@" $(pwd) test 2>/dev/null test x=1 awk 'quoted text' x=1 cd then
+		sed x=1 sed readonly | | 'quoted text' /usr/bin cd x=1 readonly done
+	done done -eu 'quoted text' sed done | echo test readonly readonly 2>/dev/null
+x=1 "$1" then echo && /usr/bin "$1"
+	awk | 'quoted text' then cd | && readonly --verbose grep | -eu
+		echo export $(pwd) "$1" | | test grep printf 2>/dev/null
+	| 2>/dev/null /usr/bin ${HOME}
+x=1 local "$1" sed --verbose && export --verbose
+		grep 2>/dev/null local
+printf local readonly sed then && ${HOME} readonly "$@" | "$1"
+${HOME} printf ${HOME} grep 'quoted text' printf ${HOME} cd export grep cd ${HOME}
+		printf /usr/bin grep export ${HOME} local | "$1" cd $(pwd)
+	--verbose && --verbose sed -eu
+		grep | export then 2>/dev/null | -eu |
+	echo test /usr/bin ${HOME} -eu test "$1" |
+		export 'quoted text' export test awk $(pwd) && test
+		local echo sed --verbose readonly export then
+		readonly readonly grep done done
+		grep test && printf x=1 cd awk sed "$1"
+"$1" export then $(pwd) test "$@"
+	awk readonly local "$1" ${HOME} local x=1 --verbose awk cd sed
+	/usr/bin x=1 test $(pwd) awk grep local "$1" -eu /usr/bin $(pwd) /usr/bin
+	| -eu | "$@" x=1 $(pwd) test "$@" $(pwd) 2>/dev/null ${HOME} "$1"
+		&& sed sed "$@" echo /usr/bin | export
+local "$@" x=1 2>/dev/null 'quoted text' 'quoted text' -eu --verbose $(pwd)
+		sed sed sed done readonly echo 2>/dev/null --verbose
+	${HOME} local printf echo readonly
+	test ${HOME} $(pwd) ${HOME} "$1" "$1" echo done ${HOME} /usr/bin ${HOME}
+	"$@" 'quoted text' test $(pwd) 'quoted text' then
+$(pwd) test | $(pwd) then "$1" ${HOME} "$1"
+		test readonly ${HOME} cd local readonly
+		export 2>/dev/null local echo "$@" ${HOME} done echo ${HOME} ${HOME} done
+		'quoted text' 2>/dev/null "$@" --verbose cd "$@" grep
+2>/dev/null | | local /usr/bin
+"$@" "$1" "$1" then cd sed ${HOME}
+	then test /usr/bin "$@" echo then then && awk awk echo $(pwd) 2>/dev/null
+	local readonly && ${HOME} --verbose awk && awk export cd $(pwd) sed
+grep | echo --verbose
+cd test && echo -eu done "$1" grep readonly --verbose --verbose sed
+		/usr/bin 'quoted text'
+'quoted text' $(pwd) &&
+done export && | 2>/dev/null export 2>/dev/null
+| cd ${HOME} done printf local $(pwd)
+		"$1" awk && "$1" ${HOME} export export echo x=1 export cd then 'quoted text'
+		"$1" grep -eu done 2>/dev/null --verbose then local
+	'quoted text' -eu cd readonly "$@" then echo -eu grep test
+		readonly ${HOME} then done echo
+	test awk ${HOME} grep ${HOME} --verbose
+		awk sed then $(pwd) --verbose
+	| awk --verbose -eu x=1 'quoted text' "$1" echo printf --verbose printf
+	printf printf sed | -eu ${HOME} --verbose
+	local --verbose then done
+	export readonly ${HOME} | awk /usr/bin export done ${HOME} --verbose
+-eu done done grep x=1 $(pwd) printf
+"$@" "$@" 2>/dev/null $(pwd) cd "$@"
+"$1" echo $(pwd) local 2>/dev/null
+	${HOME} test test then cd
+	x=1 x=1 cd cd echo 2>/dev/null then
+		grep printf $(pwd) echo
+	&& sed local 'quoted text' -eu done 2>/dev/null
+		2>/dev/null /usr/bin awk 2>/dev/null
+	--verbose "$1" then readonly x=1 echo "$@" && then 'quoted text'
+		echo done readonly printf /usr/bin echo echo export $(pwd) | /usr/bin | grep
+sed local cd && "$1" x=1 --verbose
+	done $(pwd) "$1" 'quoted text' done then cd awk --verbose --verbose cd printf "$@"
+	printf -eu awk export ${HOME} then printf x=1 grep printf
+		${HOME} 'quoted text' test x=1 echo grep ${HOME}
+	$(pwd) test "$@" --verbose --verbose --verbose
+	| && done awk echo then cd export then export
+	| 'quoted text' $(pwd) -eu export x=1
+	printf readonly then 2>/dev/null cd
+	awk cd | x=1 echo sed $(pwd) printf x=1 then awk /usr/bin /usr/bin
+local /usr/bin readonly && local 'quoted text'
+"$@" | && ${HOME} readonly
+		-eu awk grep test test "$@" ${HOME} done "$1" sed cd sed printf 2>/dev/null test
+		${HOME} ${HOME} -eu grep && "$1" --verbose done done /usr/bin
+test local && ${HOME} cd --verbose printf
+export $(pwd) cd awk echo grep ${HOME} "$1"
+		$(pwd) sed && x=1 | readonly -eu
+--verbose readonly sed done echo awk "$1" /usr/bin printf cd ${HOME} grep
+		local local "$@" /usr/bin --verbose printf ${HOME} --verbose
+	2>/dev/null /usr/bin ${HOME} 'quoted text' export
+		${HOME} | --verbose $(pwd) /usr/bin cd test test | cd grep /usr/bin
+$(pwd) "$@" grep && echo
+		"$1" && test cd test sed $(pwd) | -eu $(pwd)
+	echo test export local "$1" /usr/bin
+		awk "$1" x=1 export 'quoted text' 'quoted text' x=1 then export && --verbose
+		$(pwd) then echo test "$@" "$@" --verbose cd | done | then done "$@" 'quoted text'
+	| /usr/bin && test x=1
+	${HOME} && export echo -eu
+export echo local done && sed /usr/bin cd printf $(pwd) "$@" -eu local 'quoted text'
+	grep export $(pwd) | awk | "$@" local
+		'quoted text' then export echo && printf export awk done local -eu | $(pwd) $(pwd)
+done test echo /usr/bin && /usr/bin cd "$@"
+awk sed ${HOME} grep done sed 2>/dev/null 2>/dev/null local
+	x=1 then ${HOME} done --verbose ${HOME} export "$@" 2>/dev/null awk ${HOME}
+	| "$1" --verbose readonly "$@" "$1"
+	test --verbose 'quoted text' 'quoted text' local readonly "$1" -eu
+	| then printf -eu echo then --verbose local $(pwd) cd /usr/bin then local
+		2>/dev/null printf readonly printf grep cd 'quoted text' export export 'quoted text'
+x=1 --verbose grep $(pwd) x=1 --verbose sed 'quoted text' /usr/bin grep
+grep && local cd test "$1" grep readonly ${HOME} test ${HOME}
+		$(pwd) awk printf 2>/dev/null
+		"$@" local "$1" -eu done readonly --verbose local awk -eu
+test readonly grep |
+		$(pwd) printf && | done printf "$1" /usr/bin && echo then 'quoted text'
+	test ${HOME} "$@" $(pwd) -eu $(pwd) 'quoted text' cd printf x=1 cd 2>/dev/null
+$(pwd) "$1" && readonly /usr/bin x=1 readonly grep grep printf local ${HOME}
+sed 'quoted text' grep echo sed grep 'quoted text'
+	'quoted text' "$1" && readonly
+		'quoted text' echo then grep
+	| grep done export grep readonly /usr/bin x=1 /usr/bin grep $(pwd)
+		echo local ${HOME} -eu readonly "$@" awk && --verbose cd -eu export test
+export sed ${HOME} $(pwd)
+	done ${HOME} printf x=1 printf /usr/bin done sed
+	"$@" -eu local && then /usr/bin cd ${HOME} x=1
+		export local $(pwd) test "$@" grep awk ${HOME} awk "$@"
+x=1 -eu | grep sed local
+		"$@" $(pwd) $(pwd) done |
+		'quoted text' readonly "$1" done done ${HOME} export cd ${HOME}
+		"$1" $(pwd) readonly 2>/dev/null readonly local "$1" printf echo readonly local
+"$1" local 'quoted text' -eu 2>/dev/null "$1" local export /usr/bin
+		${HOME} test then printf then "$1"
+test done -eu done then grep "$1" "$1" grep done "$@" readonly ${HOME}
+	then export x=1 "$1" grep printf $(pwd) grep 'quoted text' export 'quoted text'
+		then | sed && cd "$1" export 'quoted text'
+	readonly && then test x=1 'quoted text'
+		cd 2>/dev/null grep local sed 2>/dev/null grep --verbose echo
+	grep test -eu "$@" --verbose local
+&& /usr/bin grep ${HOME} local x=1 /usr/bin test && readonly 'quoted text' sed
+		cd "$1" echo /usr/bin local
+sed 'quoted text' /usr/bin local
+	&& readonly 2>/dev/null | | "$@" 'quoted text'
+	| then | 'quoted text' 'quoted text' sed "$1" done
+	export /usr/bin then && "$1"
+	x=1 awk /usr/bin sed ${HOME} readonly && printf 'quoted text' --verbose 'quoted text'
+		grep x=1 export | cd sed -eu ${HOME} echo echo 'quoted text' export x=1 'quoted text'
+	"$@" awk export /usr/bin sed then | cd ${HOME} $(pwd) -eu grep "$1" | test cd /usr/bin
+--verbose printf && x=1 test done
+cd then --verbose echo x=1 local export
+	cd | --verbose /usr/bin
+	awk local echo 2>/dev/null "$1" awk sed -eu $(pwd)
+		--verbose done awk -eu $(pwd) grep x=1 --verbose echo done -eu export cd 2>/dev/null
+/usr/bin then | local then --verbose
+	done local x=1 readonly "$@" then 'quoted text' /usr/bin grep 2>/dev/null readonly
+test 2>/dev/null ${HOME} cd
+		2>/dev/null echo && "$@" readonly export
+	cd readonly -eu export x=1
+readonly $(pwd) && | | echo
+		-eu && "$@" export /usr/bin cd --verbose --verbose /usr/bin
+awk test --verbose --verbose ${HOME} "$1" "$1"
+-eu echo printf 2>/dev/null
+	/usr/bin then test ${HOME} ${HOME} readonly done | | 2>/dev/null | 'quoted text'
+-eu cd then /usr/bin done test /usr/bin --verbose awk 'quoted text'
+| x=1 printf "$@" -eu x=1 "$@" /usr/bin echo cd 2>/dev/null
+--verbose && 'quoted text' grep "$1" "$@" then "$1" done | done | then $(pwd)
+		export "$@" export sed then then
+2>/dev/null echo | grep 'quoted text' echo ${HOME} --verbose -eu test
+	"$1" readonly done 'quoted text'
+		${HOME} grep local /usr/bin ${HOME} test && readonly then "$1" && test 'quoted text'
+		local export "$@" 'quoted text' "$1" echo
+	-eu readonly -eu printf sed && && printf local echo done readonly /usr/bin
+	/usr/bin ${HOME} | -eu sed -eu ${HOME} $(pwd) test then done local
+	2>/dev/null --verbose 2>/dev/null && awk | --verbose then
+cd | $(pwd) cd -eu "$1" 2>/dev/null
+	sed cd "$@" echo /usr/bin local echo /usr/bin
+		cd -eu test export "$@" /usr/bin -eu "$@"
+	test $(pwd) x=1 local cd echo awk --verbose local "$1" $(pwd)
+		$(pwd) printf "$@" cd grep grep sed | local $(pwd)
+		test grep && | "$1" echo "$@" 'quoted text' grep 'quoted text' "$@" local |
+	awk $(pwd) test cd then readonly /usr/bin 2>/dev/null printf
+		then --verbose && readonly printf "$@" test cd printf
+${HOME} $(pwd) $(pwd) $(pwd) "$@" "$@" $(pwd) --verbose -eu
+	printf awk && && awk /usr/bin printf
+	${HOME} "$1" x=1 && export echo echo /usr/bin 2>/dev/null 2>/dev/null test
+		2>/dev/null "$@" then /usr/bin local cd "$@" && printf cd $(pwd) local
+	cd x=1 | /usr/bin readonly && local grep ${HOME} local --verbose
+	awk "$1" 2>/dev/null done && "$@" export
+		2>/dev/null && 'quoted text' printf ${HOME} "$@" $(pwd) 2>/dev/null cd export
+		awk $(pwd) --verbose 2>/dev/null
+	done -eu then | export "$@" ${HOME} readonly x=1 awk
+	grep "$1" "$1" -eu ${HOME} printf | test -eu "$@" --verbose
+done then done sed sed ${HOME} 'quoted text'
+	awk export sed && "$@" local then test local done sed
+	"$@" | 2>/dev/null -eu echo
+grep "$1" printf done $(pwd) local echo ${HOME} done 2>/dev/null
+		"$1" --verbose export 'quoted text' | done done export grep
+echo $(pwd) grep 'quoted text'
+		-eu sed ${HOME} | /usr/bin echo awk 'quoted text'
+	2>/dev/null "$@" readonly "$1" local $(pwd) --verbose test done sed "$@" sed then
+		readonly 2>/dev/null awk done export then && /usr/bin --verbose
+	--verbose --verbose readonly ${HOME} local
+	export "$@" | "$@" printf
+	cd echo export awk test then && awk $(pwd) readonly
+	readonly test ${HOME} readonly
+	-eu awk x=1 | 2>/dev/null $(pwd)
+		then readonly /usr/bin sed "$@" "$1"
+/usr/bin echo x=1 'quoted text' cd "$@" awk
+	readonly $(pwd) --verbose ${HOME}
+-eu -eu awk awk --verbose /usr/bin ${HOME} x=1 export
+	echo "$@" "$1" "$1" "$@" 2>/dev/null awk awk local
+readonly ${HOME} printf --verbose sed readonly done "$@" "$1" sed
+		| awk sed done | awk test test then | export readonly
+		local cd test grep readonly printf /usr/bin echo 'quoted text'
+/usr/bin local cd /usr/bin awk 'quoted text' test readonly && && then done /usr/bin
+	${HOME} 'quoted text' $(pwd) readonly && ${HOME} then export | echo
+2>/dev/null awk printf x=1 done then --verbose
+		cd $(pwd) grep "$@" $(pwd) -eu
+		"$@" printf 'quoted text'
+	2>/dev/null 'quoted text' test
+	$(pwd) awk readonly | -eu "$@" 'quoted text' sed
+test && sed test readonly then 'quoted text' "$1" x=1 printf export awk
+		sed | readonly -eu export --verbose
+| /usr/bin grep /usr/bin printf test awk 2>/dev/null
+| cd sed printf printf readonly then /usr/bin && ${HOME}
+${HOME} then 'quoted text' done 'quoted text' test then printf ${HOME}
+		&& readonly && -eu printf
+		printf export local "$@" readonly $(pwd) | &&
+	2>/dev/null 'quoted text' done awk "$1" 2>/dev/null
+	&& printf x=1 test sed 'quoted text'
+		"$1" echo && cd cd export awk test /usr/bin 'quoted text' x=1 $(pwd) /usr/bin
+sed 'quoted text' /usr/bin readonly awk -eu export -eu $(pwd)
+done test && x=1 printf
+	"$1" --verbose awk ${HOME} && 2>/dev/null
+		--verbose then grep echo awk 'quoted text' /usr/bin
+		printf /usr/bin cd /usr/bin awk
+	"$1" test printf 'quoted text' echo sed then test local ${HOME}
+	&& x=1 cd done && local grep --verbose sed
+x=1 -eu && /usr/bin test && readonly --verbose "$1" 2>/dev/null -eu
+	echo test -eu local "$1" test grep |
+-eu /usr/bin export -eu grep && 2>/dev/null
+		grep ${HOME} grep test ${HOME} $(pwd)
+		export 2>/dev/null $(pwd) sed test awk | && echo "$@" then grep grep 'quoted text'
+| --verbose test awk --verbose --verbose
+	readonly ${HOME} printf --verbose -eu && local $(pwd) export 2>/dev/null
+		"$1" | x=1 then readonly -eu --verbose then x=1 export export
+		awk | echo awk test echo --verbose $(pwd)
+test | test echo done $(pwd)
+		-eu then $(pwd) local cd then readonly sed cd test cd
+	printf grep $(pwd) readonly test then --verbose $(pwd) "$1" | cd echo --verbose
+cd export --verbose echo $(pwd) | "$@" ${HOME}
+		${HOME} local readonly -eu 2>/dev/null done
+	-eu $(pwd) /usr/bin awk -eu 2>/dev/null sed cd printf
+	test 'quoted text' local export $(pwd) awk awk printf echo local &&
+	$(pwd) --verbose "$@" echo export readonly test --verbose export ${HOME} $(pwd)
+		${HOME} readonly local -eu && x=1 test sed done 2>/dev/null -eu "$@" | &&
+	awk 2>/dev/null x=1 done -eu
+	then ${HOME} 'quoted text' -eu 2>/dev/null
+grep awk "$1" ${HOME} sed grep && export cd done 2>/dev/null then ${HOME} 2>/dev/null
+		sed && done /usr/bin "$@" -eu --verbose ${HOME} --verbose -eu 'quoted text' ${HOME}
+	| "$1" echo /usr/bin
+awk -eu && awk 'quoted text' -eu && x=1 "$1" sed --verbose done
+	/usr/bin x=1 done ${HOME} awk cd awk 'quoted text' &&
+x=1 2>/dev/null && 'quoted text'
+export x=1 'quoted text' readonly
+	sed printf 2>/dev/null sed readonly done -eu "$1"
+sed /usr/bin then local local awk $(pwd) local 2>/dev/null --verbose | done 'quoted text'
+		&& 2>/dev/null "$@" local && && readonly
+	$(pwd) readonly 'quoted text' "$1" done test test && ${HOME}
+		$(pwd) readonly then "$@"
+	${HOME} && x=1 export "$@" --verbose sed cd
+	readonly readonly readonly "$1" | then done done readonly 'quoted text' "$@"
+export then echo local sed && "$@"
+2>/dev/null --verbose test "$1" 'quoted text' --verbose grep readonly
+export readonly "$1" done cd && -eu done awk && $(pwd) readonly readonly
+&& readonly test x=1 local local echo &&
+	export --verbose done --verbose
+		$(pwd) x=1 test | $(pwd) ${HOME} local test sed printf "$@" ${HOME} sed sed echo
+		awk grep -eu grep awk $(pwd) echo test /usr/bin readonly
+		done "$@" "$@" echo awk export cd
+-eu "$@" test --verbose x=1 test echo readonly local && 'quoted text'
+${HOME} "$1" 'quoted text' readonly ${HOME} readonly x=1 printf
+	-eu cd printf --verbose export -eu printf && ${HOME} cd readonly export &&
+$(pwd) local grep -eu ${HOME} /usr/bin && grep done test readonly cd ${HOME}
+	cd 'quoted text' sed then readonly "$@" x=1 x=1 printf /usr/bin && printf 'quoted text'
+		grep done echo "$1" ${HOME} "$@" awk "$@" local cd export awk $(pwd) test /usr/bin
+cd "$1" x=1 done then awk local readonly
+done echo sed "$@" sed x=1 "$@" readonly awk $(pwd) printf 2>/dev/null -eu
+	-eu then -eu x=1 'quoted text' --verbose then printf readonly x=1
+	local ${HOME} /usr/bin grep local local 'quoted text'
+	'quoted text' 'quoted text' x=1 local echo then
+		x=1 done echo echo 2>/dev/null local && awk ${HOME} $(pwd) printf sed
+	echo 'quoted text' echo printf echo test "$1"
+	local ${HOME} ${HOME} && | export echo test | 2>/dev/null
+		export export -eu sed 2>/dev/null x=1 ${HOME} 'quoted text' then sed local /usr/bin
+		printf && 'quoted text'
+	local local --verbose readonly cd sed then test done && --verbose
+		readonly grep export awk echo && cd "$@" "$@" && cd -eu
+		'quoted text' export test test ${HOME} -eu test
+		/usr/bin 2>/dev/null "$@" ${HOME} 2>/dev/null "$@" "$@" -eu "$1" "$@"
+x=1 sed cd /usr/bin | export ${HOME} | "$@" /usr/bin grep
+		test then then /usr/bin awk export cd local then 2>/dev/null
+		/usr/bin cd printf grep && $(pwd) test "$1" ${HOME} local "$@" done x=1
+local x=1 && then "$1" /usr/bin "$@"
+		export awk export printf readonly $(pwd) echo | test $(pwd) 2>/dev/null
+		--verbose sed $(pwd) export awk awk export cd local
+	test sed test cd --verbose export --verbose local "$@" -eu "$@" -eu export
+	test export $(pwd) ${HOME} cd then | x=1 grep printf cd | sed
+	printf local printf echo
+		readonly local ${HOME} -eu test
+		test 'quoted text' then 2>/dev/null test local
+		sed "$1" 2>/dev/null && awk printf awk
+	x=1 ${HOME} cd cd "$@" then test awk echo printf x=1 'quoted text' --verbose
+	echo test test readonly x=1 ${HOME}
+		&& "$1" then grep grep | "$1" --verbose echo grep 2>/dev/null readonly
+then then awk $(pwd) | "$@" sed /usr/bin printf $(pwd) export /usr/bin x=1 readonly
+	$(pwd) "$@" test then local done
+		-eu test $(pwd) local sed "$@" --verbose ${HOME} sed done $(pwd)
+	| 2>/dev/null done awk --verbose cd "$@"
+	cd 2>/dev/null 'quoted text' local sed done cd grep
+	export done "$@" $(pwd) | /usr/bin grep && -eu -eu done | "$@" |
+local readonly done 2>/dev/null test "$@" /usr/bin
+		readonly done $(pwd) $(pwd) 'quoted text' then readonly "$@" readonly
+		--verbose | then ${HOME} export printf 'quoted text' --verbose
+x=1 cd 'quoted text' export
+		| /usr/bin ${HOME} done /usr/bin done | -eu cd "$@" && ${HOME} -eu
+| then x=1 printf readonly 2>/dev/null test sed
+	--verbose printf awk "$1" /usr/bin sed local $(pwd) | then printf
+&& echo grep export done x=1 done -eu printf printf
+		'quoted text' local "$1" "$1" done grep -eu local test x=1
+	&& 2>/dev/null test "$@" $(pwd) readonly | grep -eu echo cd sed awk local
+export $(pwd) ${HOME} awk local x=1 test printf
+	cd local done "$@" | ${HOME} cd printf 'quoted text' 'quoted text'
+readonly awk "$@" cd test 'quoted text' "$@"
+'quoted text' readonly | 'quoted text' echo
+	test 2>/dev/null test readonly "$@" $(pwd) -eu 2>/dev/null
+		'quoted text' printf echo sed sed --verbose cd awk --verbose
+		done printf | | done sed /usr/bin export
+2>/dev/null awk "$1" grep sed "$1"
+	printf "$@" 'quoted text' "$1"
+	--verbose echo 2>/dev/null done cd && && "$@"
+	readonly awk 2>/dev/null --verbose && x=1 test
+		done echo sed cd export ${HOME} readonly "$@" $(pwd) sed
+		printf && done x=1 x=1 "$@" done sed -eu printf $(pwd)
+	| sed && $(pwd) sed awk 2>/dev/null && | "$1" sed | 2>/dev/null
+	"$1" "$1" test printf cd "$@" | sed -eu "$@"
+sed 2>/dev/null done 'quoted text' 'quoted text' done done echo
+awk export "$1" export export ${HOME} export
+local ${HOME} grep /usr/bin then then echo cd
+	printf "$@" ${HOME} 2>/dev/null
+		awk "$@" export x=1 grep echo
+-eu | /usr/bin awk && awk --verbose 2>/dev/null "$@" "$@" grep 2>/dev/null /usr/bin
+		then x=1 --verbose --verbose
+	${HOME} then --verbose | grep "$@" /usr/bin 2>/dev/null
+test ${HOME} ${HOME} $(pwd) && echo 'quoted text'
+done done --verbose readonly
+	test test 'quoted text' --verbose
+awk grep "$@" local local grep sed readonly local
+	export echo cd ${HOME} 2>/dev/null then ${HOME} $(pwd) readonly printf 2>/dev/null
+	export done | awk /usr/bin printf x=1 echo printf readonly export
+		echo 2>/dev/null cd readonly x=1
+-eu readonly 2>/dev/null awk && | --verbose "$1" echo && && then | printf
+| x=1 test readonly "$@" sed export sed 2>/dev/null echo /usr/bin
+		${HOME} -eu sed x=1 | readonly grep printf sed export test x=1 &&
+	| awk 'quoted text' $(pwd) /usr/bin local readonly
+	--verbose test x=1 grep done local
+	&& /usr/bin 'quoted text' then grep cd then ${HOME} then
+2>/dev/null echo | local $(pwd) export ${HOME} --verbose test grep -eu grep
+		local grep /usr/bin $(pwd)
+--verbose test printf 'quoted text' &&
+	$(pwd) echo x=1 'quoted text' | 'quoted text' printf --verbose 2>/dev/null
+${HOME} grep cd grep && 'quoted text' $(pwd)
+	&& 2>/dev/null | cd x=1 readonly sed awk export -eu done ${HOME} /usr/bin
+x=1 done printf 'quoted text' | x=1 ${HOME} "$@" && cd /usr/bin
+$(pwd) x=1 sed --verbose 2>/dev/null readonly grep awk --verbose
+		done $(pwd) x=1 $(pwd) done sed && | echo
+export readonly awk local printf -eu
+		sed ${HOME} ${HOME} readonly sed test printf
+		test sed x=1 done "$1" "$1" -eu readonly local readonly /usr/bin x=1 $(pwd)
+	/usr/bin | | awk --verbose "$@" then printf "$1" cd awk &&
+	awk awk | x=1 local && grep && "$1" then then sed printf x=1
+local export --verbose 2>/dev/null -eu && "$@" --verbose done
+		'quoted text' echo echo "$@" done
+		-eu echo "$@" cd x=1 "$1" grep awk
+	-eu 2>/dev/null local printf ${HOME}
+		x=1 ${HOME} -eu local test $(pwd) done
+--verbose printf "$1" 'quoted text' && local
+	-eu then sed awk export "$1" | grep then -eu sed /usr/bin
+echo 'quoted text' cd sed x=1 /usr/bin
+export /usr/bin test | /usr/bin
+	'quoted text' x=1 ${HOME} && cd then ${HOME} cd test cd 2>/dev/null
+export local printf $(pwd) "$1" done "$@" ${HOME}
+		-eu cd ${HOME} done /usr/bin && "$1" "$@" 'quoted text'
+then /usr/bin 'quoted text' grep awk
+--verbose cd 2>/dev/null "$@" grep && cd | /usr/bin local "$1" /usr/bin 'quoted text'
+	--verbose then "$1" export export then export "$1" then then $(pwd) "$@"
+		"$1" grep readonly echo -eu local
+--verbose sed done test -eu $(pwd) --verbose
+	${HOME} printf x=1 done | | 2>/dev/null test $(pwd) then
+	local 2>/dev/null && /usr/bin 'quoted text' sed | printf local /usr/bin printf
+		echo -eu test "$@" test /usr/bin grep awk local 2>/dev/null
+		awk local done x=1 export "$@" /usr/bin x=1
+		export grep done $(pwd) done "$@" "$1" 2>/dev/null awk sed sed then echo awk printf
+	"$1" 2>/dev/null local grep sed printf 2>/dev/null
+	2>/dev/null ${HOME} ${HOME} echo --verbose 'quoted text' test printf
+"$@" "$1" grep then | | local 'quoted text' echo
+		grep 'quoted text' then
+		export x=1 cd 'quoted text' printf -eu local done local && 'quoted text' printf
+'quoted text' printf export done /usr/bin sed -eu awk local export done x=1
+		local 2>/dev/null awk sed | | --verbose && x=1 test && /usr/bin cd
+echo done awk sed test 'quoted text' x=1 printf && test
+	${HOME} "$1" grep sed
+	local && | x=1 sed $(pwd) export x=1 then then
+		done printf done -eu "$@" sed x=1 echo test x=1 | local test
+		"$1" then && && | "$@" 2>/dev/null
+grep awk ${HOME} x=1 -eu export readonly readonly /usr/bin
+	printf grep awk -eu && 2>/dev/null test /usr/bin printf printf /usr/bin
+		printf | readonly echo "$1" $(pwd) | done ${HOME} export 2>/dev/null 'quoted text'
+	-eu grep readonly done 2>/dev/null x=1 'quoted text' readonly
+then done sed 2>/dev/null sed sed done done 'quoted text'
+	&& sed "$1" /usr/bin then && "$1" local && done /usr/bin export
+	grep printf -eu "$@"
+		"$1" awk readonly local test ${HOME} ${HOME} export cd awk "$1" "$1" readonly
+"$1" | 2>/dev/null cd done | --verbose "$@" -eu "$1" 2>/dev/null sed export
+test sed export ${HOME} test "$@" then 2>/dev/null
+		export echo 'quoted text' then readonly -eu then export printf grep "$1"
+then cd "$@" cd sed readonly 2>/dev/null x=1
+	${HOME} --verbose printf readonly done 2>/dev/null cd 2>/dev/null x=1 'quoted text'
+	then done sed local test --verbose /usr/bin
+	test $(pwd) awk printf
+		x=1 x=1 "$@" cd echo done echo "$@" 'quoted text' cd
+	"$1" cd grep done x=1 x=1 "$@" readonly readonly -eu readonly test
+		| && test echo /usr/bin
+	then export "$1" echo x=1 test readonly grep | test && | sed awk | sed --verbose
+	cd local readonly readonly 'quoted text'
+x=1 cd sed -eu && cd local export ${HOME} -eu grep printf
+		${HOME} grep readonly done && sed
+printf sed x=1 "$@" grep done x=1 done -eu x=1 "$1" 2>/dev/null local /usr/bin
+	test awk printf 2>/dev/null
+done done sed ${HOME} awk "$@" | printf /usr/bin
+${HOME} grep "$1" test /usr/bin done local then $(pwd) ${HOME} -eu
+		done awk | grep 'quoted text' /usr/bin --verbose | readonly "$1" cd
+		"$@" test then | then "$@" awk cd ${HOME} 'quoted text'
+	'quoted text' then --verbose cd cd export test echo
+local grep -eu local awk ${HOME}
+local && then "$@" sed x=1 'quoted text' $(pwd)
+| echo cd $(pwd) 2>/dev/null 'quoted text' $(pwd) 2>/dev/null 'quoted text'
+	echo /usr/bin "$@" --verbose readonly | readonly test | sed readonly printf "$@"
+		local readonly done 2>/dev/null ${HOME} "$1" printf -eu awk printf
+		-eu echo done export local printf
+| $(pwd) local --verbose "$@" local -eu --verbose
+		export awk 'quoted text' cd $(pwd) --verbose --verbose awk x=1 printf
+	grep /usr/bin && readonly done awk -eu readonly "$1" printf "$1" export
+	2>/dev/null -eu 'quoted text' | 2>/dev/null readonly test
+grep test -eu readonly done sed sed
+	/usr/bin local ${HOME} x=1 done grep grep "$@" 'quoted text'
+then --verbose then test awk done export --verbose
+'quoted text' -eu "$@" $(pwd) local $(pwd) 'quoted text' done 2>/dev/null
+		test cd ${HOME} readonly 2>/dev/null
+	-eu "$@" awk "$@" done $(pwd) sed && ${HOME} done ${HOME} "$@"
+	export /usr/bin then "$@" $(pwd) $(pwd) export awk
+		echo cd /usr/bin printf echo done
+		local && test readonly printf then done readonly && -eu test grep test
+		x=1 done $(pwd) then local
+grep done --verbose "$@" "$@" export | done
+		awk $(pwd) /usr/bin awk 2>/dev/null
+	'quoted text' && | export /usr/bin export 2>/dev/null export
+echo awk grep test grep readonly x=1 grep awk test
+sed then $(pwd) printf echo "$1" && then then sed done -eu export "$1" /usr/bin
+	$(pwd) readonly "$@" test done 2>/dev/null 2>/dev/null grep
+	| 'quoted text' "$@" "$1" printf 'quoted text' cd then -eu "$@" grep export
+		done export "$@" x=1 ${HOME} readonly 'quoted text'
+	'quoted text' /usr/bin readonly "$1" x=1 "$1" readonly "$1" &&
+/usr/bin sed done grep done echo 'quoted text'
+	grep $(pwd) 'quoted text' "$@" --verbose export test
+	| awk grep -eu && printf 'quoted text' awk /usr/bin export then 'quoted text'
+-eu --verbose then | done readonly && readonly printf "$@" local x=1
+		/usr/bin && --verbose x=1 then
+		$(pwd) awk --verbose $(pwd) cd x=1 /usr/bin /usr/bin
+	grep readonly local local
+sed -eu 2>/dev/null test done
+		awk ${HOME} awk ${HOME} cd --verbose -eu x=1 "$@" export ${HOME} -eu test 'quoted text'
+'quoted text' test then
+	printf /usr/bin then |
+	export 2>/dev/null x=1 -eu 2>/dev/null echo && --verbose ${HOME} -eu
+	&& grep grep grep done "$1"
+		"$1" local && ${HOME} grep cd
+export cd readonly 2>/dev/null ${HOME} readonly --verbose
+done cd $(pwd) && 2>/dev/null 'quoted text' $(pwd) 2>/dev/null --verbose /usr/bin
+	$(pwd) echo grep then test grep sed "$1" readonly echo $(pwd) readonly
+	then done | $(pwd) $(pwd) 2>/dev/null cd /usr/bin
+		/usr/bin | sed echo | | 2>/dev/null export $(pwd) /usr/bin
+		then /usr/bin then -eu "$@" -eu
+		| -eu x=1 sed grep $(pwd) then 'quoted text' local then printf done
+sed then $(pwd) cd && echo &&
+	'quoted text' test printf readonly
+test local local "$@" 'quoted text' test 'quoted text' |
+		'quoted text' x=1 then test grep readonly grep local -eu cd | | then local printf
+	cd /usr/bin ${HOME} grep readonly && "$1" printf -eu ${HOME}
+test $(pwd) --verbose --verbose awk echo cd
+		cd | x=1 test echo $(pwd) readonly | test then echo export grep
+x=1 echo then ${HOME} done | "$@" cd local test --verbose export $(pwd) cd
+	done awk cd export --verbose
+		$(pwd) $(pwd) -eu --verbose sed test
+-eu | readonly "$1" /usr/bin grep 2>/dev/null export
+		echo | printf /usr/bin --verbose ${HOME} grep ${HOME} "$1" && printf $(pwd)
+	done "$1" export then test 'quoted text' printf $(pwd) export export grep sed sed
+	/usr/bin $(pwd) cd sed then cd readonly readonly
+		/usr/bin grep grep $(pwd) readonly
+	export $(pwd) 'quoted text' 2>/dev/null
+		| done -eu 'quoted text' grep test sed --verbose 2>/dev/null cd
+		"$@" $(pwd) ${HOME} printf | export | echo export $(pwd) printf
+	then $(pwd) --verbose /usr/bin then local echo export readonly
+$(pwd) | printf grep && ${HOME} && test "$@" && "$@" -eu test x=1
+	-eu grep x=1 $(pwd) done 'quoted text' /usr/bin -eu echo
+| done awk readonly 'quoted text' printf ${HOME} grep export
+	$(pwd) done awk grep printf cd "$@" | export done test done awk "$@" sed $(pwd)
+done && awk | test printf export done
+	printf sed printf ${HOME} 'quoted text'
+	printf local export && "$1" --verbose cd local
+cd sed local $(pwd) grep "$@" 2>/dev/null
+cd /usr/bin "$1" x=1 local cd -eu --verbose --verbose sed done x=1 local
+sed local test echo then awk &&
+	cd -eu --verbose readonly printf
+		| $(pwd) echo cd /usr/bin done test then 2>/dev/null grep 'quoted text' test
+	cd --verbose /usr/bin awk $(pwd) cd echo "$@" sed -eu 2>/dev/null $(pwd) x=1
+	local $(pwd) ${HOME} echo then 'quoted text' | grep echo 2>/dev/null
+		"$@" test awk "$1" printf "$1" then x=1
+test $(pwd) readonly readonly cd sed "$1" 2>/dev/null
+	-eu test ${HOME} 2>/dev/null sed /usr/bin
+echo grep x=1 echo readonly x=1 && grep 2>/dev/null 2>/dev/null 'quoted text'
+'quoted text' then x=1 echo --verbose
+	printf && /usr/bin 'quoted text' && done grep cd grep test then cd ${HOME}
+		printf /usr/bin 2>/dev/null -eu export readonly 'quoted text' /usr/bin
+'quoted text' printf local | 2>/dev/null readonly "$@"
+cd x=1 $(pwd) "$@" then && "$1" 'quoted text' $(pwd)
+		cd ${HOME} && /usr/bin --verbose echo cd local echo
+x=1 export test export then awk x=1 printf echo x=1 -eu 2>/dev/null export |
+	--verbose printf done test cd | test then --verbose done awk awk local "$@"
+		done export sed x=1 $(pwd)
+test ${HOME} cd && -eu readonly 'quoted text' "$1" ${HOME} test
+		x=1 --verbose 'quoted text' "$@" "$@" "$@" "$@" test "$@" export --verbose echo
+	echo then test 'quoted text'
+		&& local export test cd readonly x=1 x=1 ${HOME} echo grep ${HOME} then
+	/usr/bin sed cd awk sed sed | export x=1 /usr/bin
+test readonly then /usr/bin printf
+	grep cd && echo then "$@" grep grep done grep /usr/bin sed then 2>/dev/null --verbose
+x=1 ${HOME} awk -eu cd cd && /usr/bin
+	echo --verbose /usr/bin x=1 'quoted text'
+		grep 2>/dev/null done x=1 echo &&
+	2>/dev/null && awk done 2>/dev/null echo && export | printf |
+${HOME} /usr/bin test
+	/usr/bin test grep printf done "$@" 2>/dev/null /usr/bin 'quoted text' test | 'quoted text'
+	printf local 'quoted text' 2>/dev/null $(pwd) sed test x=1 /usr/bin
+	"$@" && && -eu cd -eu sed "$@" then test done
+	-eu test grep --verbose cd awk x=1 done | awk --verbose grep then --verbose
+sed local then awk export --verbose local printf
+-eu sed && "$@" local x=1 x=1 /usr/bin then awk x=1 test
+		${HOME} $(pwd) printf then && cd
+/usr/bin local cd grep readonly 2>/dev/null
+&& cd done x=1 x=1 ${HOME} $(pwd) sed grep export ${HOME}
+	2>/dev/null "$@" then ${HOME} $(pwd)
+	local --verbose cd awk readonly
+		printf --verbose 2>/dev/null -eu $(pwd) test
+echo printf /usr/bin export sed x=1 2>/dev/null "$@" "$@" x=1 readonly --verbose
+		$(pwd) cd done readonly done ${HOME} /usr/bin
+	${HOME} --verbose done local printf | sed local sed ${HOME} -eu readonly $(pwd)
+sed export sed local export grep | export then echo done readonly
+	done cd 2>/dev/null "$@" 'quoted text' $(pwd) x=1 2>/dev/null -eu done printf
+	&& sed local /usr/bin done 'quoted text'
+		2>/dev/null cd /usr/bin sed done awk --verbose ${HOME} then readonly $(pwd)
+sed export --verbose && awk done 2>/dev/null "$1" 'quoted text'
+$(pwd) cd $(pwd) "$@" "$1" export
+		--verbose printf then 'quoted text' readonly "$1" ${HOME} readonly awk local
+		&& export -eu readonly export cd
+	2>/dev/null x=1 "$@" cd test readonly --verbose
+	&& -eu $(pwd) awk $(pwd) sed $(pwd)
+grep done && $(pwd) awk | sed -eu sed test $(pwd) awk && grep "$1" x=1 test then
+	-eu --verbose 'quoted text' cd test | test local done grep "$1" "$@" grep
+		2>/dev/null "$@" $(pwd) &&
+	/usr/bin export readonly | grep ${HOME} local readonly --verbose readonly /usr/bin
+$(pwd) then $(pwd) | -eu "$@" grep echo 'quoted text' printf test -eu
+		/usr/bin $(pwd) "$@" echo printf export local "$1" --verbose 'quoted text' readonly
+export $(pwd) export x=1 printf readonly
+sed printf echo cd done readonly then
+		| && done awk "$1" sed ${HOME} -eu grep then "$@" "$@" && grep export
+		/usr/bin 2>/dev/null sed cd && readonly
+	2>/dev/null then -eu printf
+		done echo -eu export 'quoted text' sed awk awk /usr/bin &&
+		$(pwd) && 'quoted text' /usr/bin
+		/usr/bin "$@" readonly /usr/bin "$1" cd local
+		local printf cd done $(pwd) then cd done 'quoted text'
+	then && 'quoted text' awk $(pwd) done ${HOME}
+echo "$1" "$@" test awk grep then
+	sed x=1 local test then | then 'quoted text' readonly
+	--verbose grep done awk cd echo done awk local
+then 2>/dev/null sed cd local
+	--verbose done 2>/dev/null 2>/dev/null "$@" readonly x=1 $(pwd) cd
+		| done $(pwd) awk "$1" | done
+		'quoted text' then test readonly "$1" test /usr/bin | local
+x=1 awk 2>/dev/null readonly local
+		readonly echo sed test export | grep done "$@" then cd ${HOME} 2>/dev/null
+"$1" --verbose ${HOME} cd awk | export test --verbose && 'quoted text'
+"$@" x=1 "$1" | "$@" --verbose x=1 echo awk | cd
+	x=1 -eu local | grep readonly --verbose | grep done "$@"
+x=1 /usr/bin echo echo ${HOME} x=1 /usr/bin
+| grep $(pwd) 2>/dev/null cd then
+	| "$@" then sed sed "$1" "$1" ${HOME}
+		${HOME} && /usr/bin --verbose
+		&& export grep readonly "$@" printf && awk 'quoted text' awk
+	awk export awk $(pwd) 2>/dev/null
+local awk "$@" ${HOME} "$1" -eu awk 'quoted text' &&
+export && "$@" awk | awk awk grep cd awk done readonly
+		echo local && 'quoted text' done $(pwd) 'quoted text' sed 'quoted text'
+"$1" 'quoted text' grep local x=1 cd "$@" export printf "$1" sed && cd local export
+	test test 'quoted text' local readonly ${HOME} sed then 2>/dev/null test
+		awk local local 2>/dev/null -eu ${HOME} 'quoted text' -eu
+	&& test export grep done readonly printf awk -eu done
+&& | 'quoted text' --verbose -eu export -eu then test /usr/bin export 'quoted text'
+		/usr/bin $(pwd) readonly awk
+	-eu "$1" ${HOME} | 'quoted text'
+		cd test 'quoted text' "$1" grep done
+		2>/dev/null export readonly cd $(pwd) "$@" then cd ${HOME} /usr/bin "$1" printf
+	--verbose test -eu awk readonly done 'quoted text' x=1 echo export
+	sed then printf then grep then -eu && readonly -eu "$@" "$1" "$1" --verbose x=1
+		/usr/bin printf readonly done awk ${HOME}
+test x=1 x=1 echo awk --verbose local && done sed test -eu cd grep readonly
+done sed "$1" test /usr/bin
+		| /usr/bin && awk -eu --verbose then "$@" grep ${HOME} readonly
+| cd readonly then then && ${HOME} then printf "$1" echo sed
+echo grep readonly 'quoted text' | --verbose printf "$@" export ${HOME}
+	2>/dev/null -eu grep done done --verbose done awk
+		x=1 export echo ${HOME} readonly /usr/bin "$@" /usr/bin 2>/dev/null sed $(pwd)
+'quoted text' /usr/bin echo 2>/dev/null awk && test awk cd "$1"
+	/usr/bin -eu x=1 awk sed export echo cd done done x=1 test local
+awk "$1" readonly --verbose $(pwd) sed done
+		-eu echo && ${HOME} test $(pwd) awk && && done
+	$(pwd) awk test ${HOME} | awk echo $(pwd) && awk | /usr/bin done done --verbose
+2>/dev/null -eu local | && | /usr/bin && 2>/dev/null done
+	local -eu cd export --verbose ${HOME} echo x=1 test | test
+sed /usr/bin local "$1" done 'quoted text'
+		$(pwd) echo done done --verbose
+		export $(pwd) grep printf "$@"
+	local done /usr/bin test printf 2>/dev/null export "$@" ${HOME} awk echo --verbose
+		x=1 && grep "$1" test sed -eu awk then && cd done ${HOME} sed done
+readonly done && echo /usr/bin --verbose
+	'quoted text' printf awk local 2>/dev/null done 'quoted text' export ${HOME}
+cd local test 2>/dev/null
+	cd export sed awk $(pwd)
+		test $(pwd) export export export sed
+		--verbose awk $(pwd) printf /usr/bin 2>/dev/null echo printf readonly "$1" 2>/dev/null
+| "$1" then printf | ${HOME} x=1
+&& -eu test 2>/dev/null echo export then test test readonly "$@" awk 2>/dev/null
+	awk && grep readonly ${HOME} readonly then "$@" echo printf
+		sed $(pwd) test done printf done && 'quoted text' $(pwd) 2>/dev/null
+		--verbose 2>/dev/null "$1" sed cd readonly $(pwd) echo x=1
+		done | 2>/dev/null --verbose -eu
+	printf grep test --verbose
+		${HOME} "$@" cd local grep readonly test export -eu
+		awk then --verbose sed test | cd test printf x=1 -eu sed "$@" && done echo
+		awk --verbose local | --verbose
+		'quoted text' cd cd $(pwd)
+		printf sed 'quoted text' then --verbose /usr/bin test
+	"$@" local grep readonly
+	awk ${HOME} readonly done cd printf | cd && $(pwd) sed awk
+		| x=1 echo test | /usr/bin grep 2>/dev/null cd local done printf
+	sed readonly export then sed $(pwd) -eu cd 'quoted text'
+		export 'quoted text' | "$@" cd -eu export
+		$(pwd) grep 'quoted text' export "$@" then cd ${HOME} -eu then then
+	/usr/bin printf 2>/dev/null readonly local
+	2>/dev/null ${HOME} awk ${HOME} --verbose --verbose
+	echo ${HOME} readonly grep echo done then sed && sed grep && "$@"
+		sed 'quoted text' printf
+'quoted text' local -eu "$@" $(pwd) then test -eu echo grep /usr/bin 'quoted text'
+		export "$1" printf "$@" export readonly
+then "$1" ${HOME} x=1 | cd sed then --verbose printf
+${HOME} sed printf test export ${HOME}
+2>/dev/null | printf 2>/dev/null test grep done 'quoted text' test && $(pwd)
+	then x=1 done awk printf readonly $(pwd) && | && "$@" test | "$1"
+		sed export then && "$@" awk && 'quoted text' -eu
+printf sed && test done x=1 cd done
+		"$@" /usr/bin 2>/dev/null echo printf test readonly
+x=1 then && test printf x=1 "$@" -eu printf
+		| test "$@" --verbose $(pwd) -eu ${HOME}
+	&& then 'quoted text' awk printf
+	| "$1" printf readonly cd 'quoted text' test local "$@" x=1
+readonly "$1" cd local 2>/dev/null grep test $(pwd) export readonly test --verbose
+x=1 sed grep | x=1 local $(pwd) 'quoted text'
+grep printf cd then echo x=1 $(pwd) then "$1" $(pwd) test ${HOME} -eu test
+	export sed grep /usr/bin export 'quoted text'
+sed grep echo test then "$1" readonly then 'quoted text'
+		sed then echo then /usr/bin 2>/dev/null --verbose && "$1" ${HOME} done -eu
+		grep done readonly "$1" then "$@" | --verbose /usr/bin awk "$1" test readonly
+	then ${HOME} sed x=1 done done ${HOME} "$@" 2>/dev/null
+	"$@" 2>/dev/null then test --verbose
+#include c31.sh
+"$1" echo printf sed done readonly
+		--verbose 2>/dev/null sed /usr/bin
+	awk && && echo | --verbose readonly
+grep x=1 echo then local export cd | grep && printf readonly "$1" test && test
+cd --verbose then 2>/dev/null $(pwd) awk test "$@" "$@" "$@" x=1 x=1 grep
+		then done then cd -eu done --verbose readonly
+	printf done done readonly printf ${HOME} printf then export
+		sed /usr/bin 2>/dev/null -eu x=1 awk 'quoted text' then "$1"
+printf -eu x=1 'quoted text'
+/usr/bin local readonly $(pwd) x=1 done awk $(pwd) local local
+local x=1 export done readonly 'quoted text'
+	cd echo readonly sed export test ${HOME}
+	--verbose then | export then echo cd export ${HOME} awk then | 2>/dev/null
+	&& "$@" echo awk awk "$1" grep | local $(pwd) ${HOME} export "$@" echo
+	printf local "$1" printf cd cd 2>/dev/null "$1" local cd local then | sed --verbose
+	/usr/bin 2>/dev/null x=1 done local then ${HOME} "$1" ${HOME}
+	/usr/bin printf 2>/dev/null "$1" 'quoted text' 2>/dev/null ${HOME}
+	'quoted text' done awk cd grep export 2>/dev/null sed ${HOME} x=1 $(pwd)
+| --verbose then /usr/bin x=1 grep grep
+	test awk cd --verbose 'quoted text'
+echo cd cd readonly then
+2>/dev/null grep local cd test -eu $(pwd) local x=1 cd export
+		--verbose test then printf awk x=1 $(pwd) "$1" cd ${HOME} then "$@" printf
+		sed "$@" "$@" -eu 2>/dev/null
+	then done sed printf printf printf awk | echo local
+		/usr/bin export grep $(pwd) -eu export cd && ${HOME}
+	&& && readonly --verbose x=1 | | then readonly "$@" 2>/dev/null sed printf
+sed ${HOME} "$1" ${HOME} done then test $(pwd) done | x=1 readonly export done 2>/dev/null
+	--verbose x=1 2>/dev/null echo
+readonly x=1 test $(pwd)
+	readonly "$1" grep echo export test sed x=1 --verbose && echo readonly
+	-eu "$@" ${HOME} $(pwd) grep $(pwd)
+x=1 | && echo printf x=1 ${HOME} test
+	grep /usr/bin awk "$1" cd echo -eu readonly $(pwd) --verbose
+--verbose "$@" $(pwd) echo echo "$1" && x=1 ${HOME} done export export
+done -eu -eu done cd $(pwd) test echo ${HOME} && echo 2>/dev/null
+	'quoted text' export x=1 awk --verbose local printf sed
+	/usr/bin cd done /usr/bin ${HOME} readonly |
+	test 2>/dev/null /usr/bin echo -eu
+		test | ${HOME} "$@" local
+&& awk --verbose "$@" readonly grep 2>/dev/null x=1 --verbose --verbose
+$(pwd) -eu x=1 echo && 2>/dev/null sed cd 2>/dev/null
+		export export done ${HOME} x=1 --verbose
+	/usr/bin --verbose awk --verbose sed grep --verbose -eu echo readonly readonly
+		$(pwd) 2>/dev/null readonly then
+'quoted text' "$@" cd cd | 2>/dev/null
+		--verbose | done printf -eu
+	x=1 echo "$@" export local echo grep test "$@" -eu
+		2>/dev/null && then /usr/bin awk -eu test -eu 'quoted text' export local test
+	&& export && awk then "$@"
+2>/dev/null grep -eu "$@" grep "$@" sed "$@" | printf cd | readonly then 'quoted text'
+		export -eu "$@" && && printf
+		local "$@" x=1 "$@" local --verbose
+&& then $(pwd) cd ${HOME} export | 2>/dev/null
+		&& "$1" printf && test -eu
+$(pwd) ${HOME} -eu --verbose 'quoted text' done "$1" cd x=1 $(pwd)
+	--verbose "$1" printf x=1 | ${HOME} 2>/dev/null x=1 x=1
+'quoted text' then "$@" printf 2>/dev/null then test printf -eu 'quoted text' then
+		readonly grep awk $(pwd) 2>/dev/null 2>/dev/null printf && 2>/dev/null 'quoted text'
+		$(pwd) -eu awk /usr/bin $(pwd)
+	done "$@" x=1 local "$@" then --verbose sed printf
+	printf done -eu sed 'quoted text'
+		done then then $(pwd) readonly "$@" readonly readonly /usr/bin &&
+		then printf cd cd awk --verbose
+${HOME} 'quoted text' && test 'quoted text' ${HOME} grep $(pwd) grep done export
+	cd -eu | 2>/dev/null export
+		"$1" local test 2>/dev/null ${HOME} 'quoted text' | x=1
+done echo local local
+${HOME} 2>/dev/null $(pwd) --verbose && cd readonly export local 2>/dev/null
+		/usr/bin 2>/dev/null && echo cd done 'quoted text' readonly $(pwd)
+sed sed 2>/dev/null 2>/dev/null local done readonly
+sed $(pwd) ${HOME} sed ${HOME} --verbose $(pwd)
+		-eu x=1 ${HOME} printf local 'quoted text'
+grep ${HOME} --verbose x=1 "$1"
+	${HOME} printf $(pwd) awk readonly awk $(pwd) then && printf
+	"$@" sed 2>/dev/null | /usr/bin | then test -eu then test /usr/bin test 2>/dev/null
+"$@" export printf --verbose export | 2>/dev/null
+	local printf readonly echo $(pwd) test
+		"$1" ${HOME} | sed grep x=1 readonly printf
+	printf && /usr/bin test
+		done /usr/bin printf echo "$@" "$1" ${HOME} "$1" grep
+	cd $(pwd) test $(pwd) awk awk cd $(pwd) ${HOME} cd x=1 printf
+/usr/bin $(pwd) local ${HOME} | x=1
+${HOME} --verbose cd local
+		--verbose sed && export ${HOME}
+		/usr/bin -eu test local local
+	cd 2>/dev/null x=1 test | && sed printf x=1 --verbose
+	awk echo && "$@" awk awk ${HOME} readonly "$1" done cd x=1 readonly | done
+	cd then $(pwd) grep awk && awk --verbose local
+done then grep awk "$@" x=1 export $(pwd) | /usr/bin "$@" "$1" $(pwd)
+		x=1 "$@" echo sed --verbose
+$(pwd) -eu 2>/dev/null "$@" sed awk 'quoted text' sed grep "$1" then
+	-eu x=1 export && "$1" local | "$@" | export printf
+		&& "$1" $(pwd) grep | local ${HOME} 2>/dev/null
+		-eu then cd /usr/bin awk /usr/bin cd 2>/dev/null ${HOME} ${HOME}
+		readonly -eu "$@" sed x=1 /usr/bin sed done "$@"
+test --verbose | -eu 'quoted text' 2>/dev/null
+	sed 'quoted text' | readonly then | printf export "$1" 2>/dev/null
+	| ${HOME} cd printf sed ${HOME} then printf echo x=1 | sed cd readonly echo
+readonly test cd x=1 done | /usr/bin 2>/dev/null "$1" -eu export "$@" grep sed awk
+cd then done sed $(pwd) test
+cd $(pwd) x=1 done && | printf $(pwd) | x=1 "$@" 'quoted text'
+export readonly echo --verbose
+	printf cd printf /usr/bin sed test | -eu sed "$1" then then x=1 readonly readonly
+		test test "$1" 2>/dev/null "$@"
+		test readonly 2>/dev/null $(pwd) && | "$@" readonly test test test cd grep
+		"$@" $(pwd) $(pwd) | "$1" /usr/bin then $(pwd) "$@" awk -eu echo 2>/dev/null
+	done "$1" printf printf then local $(pwd) export done sed "$@" done 2>/dev/null
+		/usr/bin echo local --verbose
+	awk export then done done awk done "$1" "$@"
+sed printf ${HOME} echo printf test x=1 'quoted text' sed export "$@"
+	'quoted text' local printf done "$1" 2>/dev/null then
+		$(pwd) -eu test then $(pwd) export -eu -eu awk sed
+		readonly cd then echo done grep 2>/dev/null
+	readonly echo local echo ${HOME} -eu export cd --verbose "$@" local printf sed
+		done export export export | export
+grep $(pwd) awk 'quoted text' done 2>/dev/null 'quoted text' /usr/bin
+	awk --verbose local then ${HOME} test awk "$@" $(pwd)
+	2>/dev/null --verbose /usr/bin awk "$@" local readonly then test test awk
+&& local printf echo "$@" "$1" readonly export then sed 'quoted text'
+		&& awk sed -eu 'quoted text' ${HOME} x=1 readonly
+	/usr/bin | | && readonly
+x=1 readonly export grep "$@" /usr/bin 2>/dev/null grep 'quoted text' "$@" 'quoted text'
+		local | /usr/bin cd cd 'quoted text' readonly grep awk export $(pwd) grep "$1"
+| | sed --verbose readonly readonly
+	| sed local awk printf test ${HOME} local
+		grep "$@" test then -eu printf test -eu 'quoted text' |
+		${HOME} done ${HOME} local /usr/bin export -eu && ${HOME} grep local
+sed then cd /usr/bin export x=1 grep
+		readonly x=1 "$1" "$1" ${HOME} 2>/dev/null cd /usr/bin "$1" cd
+grep printf "$@" "$@" echo
+		--verbose /usr/bin local
+		local 2>/dev/null /usr/bin sed 2>/dev/null | $(pwd) /usr/bin -eu grep
+	awk awk sed local "$@" | export | cd | /usr/bin echo $(pwd) sed 2>/dev/null
+	"$1" readonly export awk x=1 "$@" sed echo export done 2>/dev/null
+	then echo 2>/dev/null test
+	export /usr/bin sed && echo x=1 test
+		| "$@" awk local /usr/bin "$@" cd
+x=1 cd done printf $(pwd) then printf 'quoted text' x=1 x=1 | 'quoted text'
+		-eu then then "$1" $(pwd) x=1 sed awk echo x=1 awk local sed test && cd x=1 "$@"
+	"$@" printf printf test x=1 /usr/bin && "$1" --verbose sed readonly
+		$(pwd) "$1" $(pwd) /usr/bin export
+		&& local 2>/dev/null | 'quoted text' x=1 --verbose "$@" 2>/dev/null "$@" /usr/bin
+	awk cd && /usr/bin "$1" x=1 $(pwd) awk
+		2>/dev/null then && 2>/dev/null sed x=1 && sed 'quoted text' $(pwd)
+		-eu grep local x=1 | local "$@" 'quoted text' test readonly
+	/usr/bin --verbose echo done
+		then "$@" echo 2>/dev/null done -eu 2>/dev/null
+	| 'quoted text' "$1" export 'quoted text'
+awk test echo $(pwd) x=1 2>/dev/null test /usr/bin readonly 2>/dev/null done &&
+		awk sed printf then readonly test printf
+	&& test test local grep | grep local test x=1 --verbose 2>/dev/null --verbose "$1"
+	'quoted text' cd ${HOME} local /usr/bin --verbose x=1 x=1 readonly
+then && --verbose -eu cd done ${HOME} /usr/bin
+	"$@" export "$@" test printf echo --verbose done
+grep cd 'quoted text' grep 'quoted text' cd awk "$1" -eu cd 2>/dev/null awk "$@"
+	grep "$@" ${HOME} $(pwd) cd ${HOME} echo ${HOME} grep x=1
+		&& then then local $(pwd) | echo readonly
+		-eu "$@" $(pwd) ${HOME}
+		-eu test && cd --verbose grep | "$1" | -eu local "$@" grep && && | ${HOME}
+		awk echo "$@" sed 2>/dev/null then x=1 | local | cd -eu test echo grep "$1" export
+readonly -eu sed readonly cd x=1 ${HOME} readonly $(pwd) 2>/dev/null cd ${HOME}
+	awk $(pwd) x=1 --verbose
+		printf grep local | grep
+	export ${HOME} export "$1" test $(pwd) awk "$@" awk "$@" 'quoted text'
+local printf && /usr/bin then | "$1" echo export awk
+		echo "$@" && /usr/bin
+	cd done "$@" printf readonly printf --verbose
+"$1" cd ${HOME} awk 'quoted text' "$1" "$1" done test readonly 'quoted text'
+	--verbose grep awk && echo done test 'quoted text' readonly test 2>/dev/null
+sed ${HOME} test local grep sed "$1" test printf printf /usr/bin
+&& 'quoted text' ${HOME}
+	"$@" ${HOME} "$@" echo | cd awk x=1 "$@" x=1 -eu /usr/bin
+		done ${HOME} local && export printf cd "$1" | | 2>/dev/null
+	$(pwd) printf sed done echo grep 'quoted text' "$1" sed
+		grep then "$@" /usr/bin local | test cd printf awk "$1" printf
+	2>/dev/null ${HOME} 2>/dev/null
+		-eu then -eu grep 'quoted text' printf printf echo echo 2>/dev/null
+		cd | ${HOME} grep done x=1 sed test local export
+		local grep then printf sed export sed $(pwd) test x=1 cd "$1" then
+"$@" export test echo grep echo --verbose | 2>/dev/null
+	local echo local | then printf |
+		x=1 | && awk done grep export printf cd sed | grep $(pwd) "$@" 2>/dev/null cd
+		done && local | x=1 -eu echo $(pwd)
+		printf sed --verbose local readonly -eu then "$1" x=1 ${HOME} cd
+		then awk readonly x=1 then | && echo $(pwd) sed local $(pwd) echo sed
+		-eu --verbose export awk --verbose readonly
+	x=1 ${HOME} grep /usr/bin done awk --verbose test done awk local
+2>/dev/null sed && && cd readonly
+	grep $(pwd) 'quoted text' then 'quoted text' export /usr/bin
+	2>/dev/null grep 2>/dev/null --verbose printf $(pwd) ${HOME} cd /usr/bin
+		printf && ${HOME} ${HOME} test && 2>/dev/null "$1" --verbose cd ${HOME}
+	awk export 2>/dev/null cd export test && && x=1 x=1 2>/dev/null --verbose 2>/dev/null
+	awk /usr/bin sed $(pwd) sed echo test printf /usr/bin then
+	"$1" readonly grep cd echo
+	done cd && "$1" local local &&
+/usr/bin then --verbose echo grep cd export $(pwd) readonly done -eu 2>/dev/null
+$(pwd) "$1" /usr/bin /usr/bin awk sed echo ${HOME} "$1" readonly ${HOME}
+"$@" && ${HOME} | echo test $(pwd) done "$@" readonly sed "$1"
+	/usr/bin echo x=1 echo /usr/bin cd done then readonly
+test $(pwd) local readonly
+	done && $(pwd) done 'quoted text'
+2>/dev/null --verbose $(pwd) awk local 2>/dev/null --verbose
+	cd cd -eu 'quoted text' readonly printf $(pwd) awk "$@"
+	"$1" readonly -eu /usr/bin 'quoted text' readonly --verbose --verbose --verbose
+		grep && sed echo awk 2>/dev/null x=1 sed export local 'quoted text' echo printf
+${HOME} grep 'quoted text' "$@" "$1" local && | &&
+-eu done -eu /usr/bin grep 2>/dev/null $(pwd) local 2>/dev/null grep
+		$(pwd) echo echo local x=1 x=1 readonly | test "$@" export 2>/dev/null
+-eu test then 2>/dev/null "$@" export "$@" readonly 'quoted text' x=1 test
+/usr/bin printf cd done awk grep sed sed --verbose ${HOME} "$@" sed then
+	echo awk 2>/dev/null | | $(pwd) x=1 x=1 "$1" printf grep
+grep 'quoted text' x=1 done then done printf | then sed ${HOME}
+	'quoted text' "$@" 2>/dev/null
+		cd | readonly sed readonly /usr/bin readonly then x=1 readonly && grep then
+		/usr/bin grep then cd test done test test printf sed awk 'quoted text'
+--verbose | sed --verbose 'quoted text' 2>/dev/null --verbose local
+sed export printf export ${HOME} /usr/bin x=1 readonly "$1"
+		/usr/bin export test test sed test -eu echo echo awk test echo done $(pwd)
+local | test x=1 printf | printf -eu x=1 readonly done
+	grep test printf sed | -eu
+		sed readonly grep awk printf then --verbose | echo
+$(pwd) test export export awk readonly local
+-eu local test cd test -eu --verbose grep "$1" --verbose test
+2>/dev/null test export sed /usr/bin ${HOME} cd then then "$@" 2>/dev/null
+		&& export -eu "$@" export
+then done then grep done ${HOME} ${HOME} then "$@" x=1 $(pwd) /usr/bin test
+		local /usr/bin then && /usr/bin cd | --verbose test cd "$1" ${HOME} "$@" printf
+	&& ${HOME} printf cd cd then grep 'quoted text' printf && then "$1" -eu sed
+		export awk $(pwd) && | cd "$1" export "$1" sed 2>/dev/null
+local /usr/bin local 2>/dev/null
+		grep sed 'quoted text' local -eu test
+${HOME} 'quoted text' readonly
+--verbose awk then test -eu grep && x=1 x=1 then --verbose then --verbose
+		cd -eu test cd awk $(pwd)
+readonly readonly done then &&
+	cd echo cd "$1" local /usr/bin awk printf
+'quoted text' grep done && | echo export /usr/bin "$@"
+	test then $(pwd) "$1" printf x=1 then /usr/bin | done /usr/bin
+	x=1 cd -eu awk 2>/dev/null
+	| test ${HOME} $(pwd) $(pwd) grep then awk &&
+	'quoted text' sed | x=1 && x=1 awk "$@" ${HOME} local printf done $(pwd) /usr/bin
+2>/dev/null -eu && done export
+&& | test -eu /usr/bin awk export /usr/bin
+		awk readonly --verbose -eu printf then "$1" x=1
+		export test && --verbose printf test test test awk "$@"
+		2>/dev/null then $(pwd) $(pwd) local grep
+	grep /usr/bin -eu readonly local sed 2>/dev/null done 2>/dev/null "$1" echo
+	"$1" local test readonly 2>/dev/null "$@" awk cd echo done $(pwd) test
+		-eu x=1 export 'quoted text' printf "$@" awk test grep cd printf /usr/bin
+	export echo local && ${HOME} 2>/dev/null echo done done
+	test "$1" echo -eu test then x=1 ${HOME} readonly sed ${HOME} 'quoted text'
+		${HOME} ${HOME} grep local $(pwd) 'quoted text' | awk "$@" readonly grep x=1
+		echo export 'quoted text'
+-eu cd then awk cd 2>/dev/null awk grep /usr/bin cd readonly ${HOME}
+		sed ${HOME} grep /usr/bin local test --verbose "$@"
+	"$@" /usr/bin /usr/bin readonly test --verbose done "$@" printf
+		sed --verbose readonly 2>/dev/null sed awk export
+| -eu 'quoted text' readonly 2>/dev/null "$@" 'quoted text' then | sed local 2>/dev/null
+	readonly && echo cd then cd 'quoted text' awk local readonly ${HOME}
+		grep 2>/dev/null local test 2>/dev/null printf awk && "$1"
+	printf $(pwd) | export done
+	'quoted text' 'quoted text' ${HOME} awk echo
+	echo echo /usr/bin && grep
+x=1 test test done grep $(pwd) ${HOME} && "$1" "$1" export "$@"
+--verbose sed | && done readonly x=1 --verbose 'quoted text'
+	sed "$@" readonly done 'quoted text' &&
+local --verbose awk export /usr/bin
+	test x=1 awk && x=1 awk -eu $(pwd) sed cd done then "$1" --verbose
+		grep $(pwd) readonly 'quoted text' readonly 'quoted text'
+	"$@" grep readonly x=1 test -eu awk printf ${HOME} x=1 local /usr/bin -eu
+	'quoted text' | done grep local x=1 test grep readonly
+	"$1" ${HOME} local done | cd done ${HOME} "$1" && then 'quoted text' ${HOME}
+	readonly ${HOME} /usr/bin "$1" 2>/dev/null
+	| && echo x=1 sed -eu readonly "$@" done && export --verbose then then echo -eu
+| --verbose | x=1 /usr/bin test | ${HOME} --verbose ${HOME} /usr/bin x=1 grep
+		/usr/bin "$1" test -eu
+	sed "$@" test "$1" 2>/dev/null 'quoted text' awk | | -eu grep test test -eu test
+	printf awk cd 'quoted text' && echo | export sed echo "$@" test sed x=1 2>/dev/null
+		"$@" echo awk /usr/bin test awk printf "$1" test | /usr/bin
+		cd export ${HOME} $(pwd) "$1" 'quoted text' 2>/dev/null | "$@" cd sed && --verbose
+	done | "$1" && 'quoted text' then sed /usr/bin sed readonly "$1"
+	sed done | 2>/dev/null then printf sed
+	'quoted text' awk echo done printf /usr/bin
+awk "$1" ${HOME} printf echo local readonly sed ${HOME} ${HOME} then
+	awk "$1" export --verbose cd test echo --verbose
+	sed cd $(pwd) && grep -eu "$1" | --verbose sed echo 'quoted text' sed
+		/usr/bin 2>/dev/null && echo /usr/bin "$@" --verbose local
+then x=1 echo awk | 'quoted text' grep
+done x=1 grep local done
+		"$@" awk x=1 'quoted text' done done printf "$@" ${HOME} -eu -eu && 2>/dev/null
+		grep -eu | done "$1" 2>/dev/null local
+x=1 | then printf then awk echo printf "$@" --verbose | grep "$@" local printf
+		printf grep echo --verbose test $(pwd)
+	awk local 2>/dev/null awk ${HOME}
+		/usr/bin cd ${HOME} --verbose /usr/bin x=1 sed done $(pwd) $(pwd) readonly
+	"$@" grep grep awk cd printf | --verbose "$@"
+		"$@" $(pwd) awk $(pwd) cd x=1 'quoted text' readonly done
+sed /usr/bin 2>/dev/null grep grep readonly "$@" "$@"
+	echo readonly export done awk sed export cd && 'quoted text' then -eu then
+		'quoted text' 2>/dev/null
+done ${HOME} 2>/dev/null test "$@" awk ${HOME} x=1 ${HOME} x=1 printf -eu ${HOME}
+2>/dev/null sed then
+	$(pwd) && | printf "$1" awk awk printf awk echo ${HOME} && local | 2>/dev/null
+		"$1" export "$1" && 2>/dev/null export "$1" 2>/dev/null
+	x=1 'quoted text' printf readonly export printf printf $(pwd) | -eu "$@" printf
+&& "$@" cd cd --verbose then --verbose then "$1" awk ${HOME} export x=1 "$1"
+	echo x=1 cd test printf then test sed /usr/bin printf
+		${HOME} done sed --verbose /usr/bin "$@" sed /usr/bin /usr/bin | "$@" export
+		"$1" printf "$1" | && export local then export test cd ${HOME} "$1" 'quoted text'
+		grep local done done awk $(pwd) x=1 readonly && cd /usr/bin -eu | x=1
+"$@" done && local $(pwd) && readonly test grep local export
+		sed cd && 'quoted text' ${HOME} echo readonly grep
+awk readonly | grep echo 2>/dev/null export readonly printf printf echo local done
+		${HOME} $(pwd) test printf "$@" sed printf printf --verbose then grep local
+		$(pwd) && 2>/dev/null $(pwd) $(pwd)
+		then | then 'quoted text'
+		${HOME} export done 'quoted text' cd --verbose -eu test awk
+${HOME} 'quoted text' /usr/bin done
+		done ${HOME} "$1" printf 2>/dev/null && grep | /usr/bin cd
+	${HOME} x=1 echo -eu x=1 --verbose sed then sed awk
+		grep echo ${HOME} awk printf ${HOME} 'quoted text'
+		x=1 echo test echo grep "$@" x=1 sed "$1" echo
+then done cd grep done && && 'quoted text' | sed /usr/bin done "$@"
+		printf $(pwd) grep x=1 "$@" | local
+		$(pwd) 2>/dev/null && x=1 'quoted text'
+		local test --verbose --verbose "$@" -eu done grep | cd test printf cd then
+	local 2>/dev/null awk 'quoted text' 'quoted text' sed | sed "$@" done "$1"
+	test sed done local ${HOME} -eu -eu | grep "$@" sed local test
+awk 2>/dev/null sed --verbose && done x=1 $(pwd)
+cd done echo 2>/dev/null /usr/bin 2>/dev/null readonly x=1 && 2>/dev/null
+		test export cd | echo --verbose done
+	sed cd $(pwd) x=1 x=1 readonly
+		test /usr/bin cd local /usr/bin /usr/bin "$1" 2>/dev/null 'quoted text'
+awk sed cd --verbose done /usr/bin local x=1 'quoted text' echo grep && x=1 &&
+'quoted text' local $(pwd) export
+	export then --verbose sed then done echo "$@" 'quoted text'
+"$1" test grep --verbose awk && then cd sed readonly "$1" "$@" printf 'quoted text'
+		test grep awk local "$@" | && | $(pwd) -eu done | 'quoted text'
+	x=1 2>/dev/null x=1 x=1 grep grep --verbose sed test "$1" cd grep
+export | "$@" $(pwd) && done
+	x=1 local $(pwd) 2>/dev/null printf awk then then local | echo --verbose
+	grep cd $(pwd) ${HOME} /usr/bin /usr/bin awk sed ${HOME}
+"$@" 'quoted text' readonly
+test awk x=1 printf then then x=1 export "$1"
+	awk x=1 printf export 'quoted text'
+then echo $(pwd) 2>/dev/null printf
+		grep | cd -eu /usr/bin grep awk
+	grep echo done echo test ${HOME}
+	"$@" then && $(pwd) | then cd export "$1"
+"$@" ${HOME} /usr/bin | 'quoted text' readonly "$@" --verbose
+		--verbose && test local 'quoted text' $(pwd) awk "$@"
+		grep cd "$@" awk readonly cd readonly
+		${HOME} sed awk done /usr/bin x=1 ${HOME}
+		export then grep | ${HOME} awk ${HOME} 'quoted text' then export x=1
+	export export ${HOME} | cd awk printf
+cd sed done 2>/dev/null "$1" /usr/bin 'quoted text'
+	readonly x=1 2>/dev/null
+&& done | sed done export "$@" 'quoted text' && test | test awk done cd 'quoted text'
+	/usr/bin awk awk /usr/bin 2>/dev/null
+'quoted text' grep readonly 'quoted text' echo echo /usr/bin
+	$(pwd) 'quoted text' 'quoted text' 2>/dev/null /usr/bin then /usr/bin
+	printf /usr/bin then printf "$1"
+		test | "$1" printf "$@" grep
+${HOME} ${HOME} x=1 awk
+awk cd | && /usr/bin ${HOME} echo export done --verbose readonly 'quoted text'
+	${HOME} 'quoted text' "$1" 2>/dev/null done && -eu grep -eu 'quoted text'
+		local cd export | x=1 printf 'quoted text'
+		sed "$1" && awk test | | -eu awk readonly 2>/dev/null
+		$(pwd) awk readonly grep
+	-eu "$1" "$@" done sed ${HOME} echo -eu grep 2>/dev/null grep |
+	local then echo ${HOME} $(pwd) 'quoted text' sed printf x=1 printf done then
+	'quoted text' printf -eu printf readonly cd done done 'quoted text'
+		local $(pwd) export done &&
+	${HOME} echo echo then -eu 'quoted text' cd cd x=1 2>/dev/null
+	"$@" cd local awk -eu
+		then "$1" test then cd x=1 grep "$1"
+readonly printf --verbose "$@" test then x=1 local 2>/dev/null $(pwd)
+	$(pwd) readonly /usr/bin cd cd 2>/dev/null test grep
+echo $(pwd) readonly local -eu
+	'quoted text' -eu export && export "$1" 2>/dev/null x=1 printf then "$@" && then
+"$1" echo awk $(pwd) export done done | then /usr/bin
+	done && 2>/dev/null 'quoted text' done
+		-eu done printf printf -eu
+		printf echo "$@" sed then sed
+done test export -eu local | awk grep cd echo grep
+	printf readonly ${HOME} && $(pwd) && grep export 'quoted text'
+'quoted text' | done test readonly
+	echo | local "$1" 2>/dev/null 'quoted text' export "$@" "$@" sed done
+-eu grep /usr/bin x=1 readonly printf /usr/bin && -eu 2>/dev/null
+	grep export then export then "$1" then sed "$1" ${HOME} local $(pwd) | "$@"
+readonly sed cd sed /usr/bin test 2>/dev/null 'quoted text' /usr/bin
+echo sed ${HOME} ${HOME} "$@" echo test --verbose echo "$1" cd printf x=1
+	&& sed printf printf done -eu && cd
+	"$1" local x=1 cd then echo 2>/dev/null
+		awk x=1 then done -eu echo "$@" -eu sed sed && cd --verbose
+		--verbose | $(pwd) --verbose grep ${HOME} test
+		&& test "$1" awk export 'quoted text' awk awk
+		sed readonly awk $(pwd) done local ${HOME} "$1" x=1 "$1" done -eu ${HOME}
+	2>/dev/null "$@" "$1" x=1 readonly --verbose 2>/dev/null printf
+		echo then readonly readonly test sed ${HOME} 2>/dev/null done
+	${HOME} && -eu printf "$@" cd | x=1 "$@"
+	local awk x=1 /usr/bin export cd awk local
+	cd -eu awk cd x=1 cd $(pwd) && local 'quoted text' /usr/bin x=1 cd "$@"
+		| --verbose awk | done "$@" readonly export cd | 'quoted text'
+		cd local "$1" printf ${HOME}
+-eu readonly then "$1" readonly grep grep local | local $(pwd) "$@" printf done
+	export readonly "$1" ${HOME} echo -eu echo && echo | done /usr/bin
+		awk awk ${HOME} local grep && "$1"
+	/usr/bin printf grep export x=1 ${HOME}
+	"$1" then test local done --verbose x=1 && /usr/bin then ${HOME}
+		readonly -eu cd ${HOME} test
+x=1 cd -eu awk -eu test 2>/dev/null
+local x=1 test printf -eu 2>/dev/null x=1 test x=1 && 2>/dev/null cd |
+	${HOME} grep echo && printf -eu "$@" done && && done | -eu
+		local export /usr/bin 'quoted text'
+		printf test test sed cd 'quoted text' cd local ${HOME} 2>/dev/null
+		grep cd export test && export | --verbose local 'quoted text' /usr/bin
+	"$@" 'quoted text' echo local "$@" local sed export --verbose cd $(pwd) |
+		readonly ${HOME} grep sed readonly awk | local
+		awk printf && "$1" /usr/bin sed x=1
+	"$1" x=1 -eu test && sed export ${HOME} -eu "$@" x=1 done printf
+		-eu "$1" grep $(pwd) -eu $(pwd) local 'quoted text'
+	cd 2>/dev/null done readonly "$@"
+		local ${HOME} done test cd then grep grep printf test echo -eu readonly export
+	readonly /usr/bin printf awk then -eu echo export export | test x=1 | 'quoted text'
+		grep cd done 2>/dev/null test then done 'quoted text' then test test
+	-eu /usr/bin sed x=1 ${HOME} 2>/dev/null /usr/bin | 2>/dev/null export
+		/usr/bin "$@" then grep | export ${HOME} "$@" done local echo && test
+		cd awk local cd 2>/dev/null sed ${HOME} 2>/dev/null "$1" -eu
+	cd "$@" -eu grep echo sed "$@" local -eu $(pwd) then "$1" then
+		then 'quoted text' /usr/bin test 2>/dev/null echo test ${HOME}
+		readonly ${HOME} then "$@" printf
+		then /usr/bin local -eu readonly test &&
+"$1" x=1 -eu sed --verbose cd -eu then then
+	printf 'quoted text' && | cd local ${HOME}
+	grep cd | --verbose 2>/dev/null export && export $(pwd) printf
+${HOME} && readonly "$1" printf ${HOME} 2>/dev/null
+&& cd awk && && && /usr/bin "$@" $(pwd) x=1 awk -eu sed $(pwd) export
+	x=1 local test sed 'quoted text' cd ${HOME} awk 2>/dev/null local
+	&& $(pwd) "$1" printf ${HOME} sed echo then | readonly grep test test |
+		-eu then 2>/dev/null $(pwd)
+	cd -eu 'quoted text' sed ${HOME} local x=1 awk | | -eu done
+		"$1" | sed ${HOME} --verbose && --verbose
+	2>/dev/null 'quoted text' |
+"$@" cd 'quoted text' $(pwd)
+		sed && | grep --verbose && $(pwd) --verbose readonly sed echo sed awk readonly
+		local local awk sed cd --verbose --verbose 2>/dev/null
+| local x=1 x=1 grep grep echo "$@" cd
+readonly sed | cd $(pwd) x=1 export 'quoted text' "$1" 2>/dev/null &&
+		"$1" "$1" && $(pwd) then awk /usr/bin cd awk -eu -eu sed
+&& "$1" ${HOME} then "$1" test "$1"
+	${HOME} echo 2>/dev/null 2>/dev/null x=1 awk
+${HOME} local "$@" -eu cd ${HOME} test "$1" sed ${HOME} test sed cd
+then grep test readonly export ${HOME} done echo local export 'quoted text' $(pwd)
+	grep test cd | --verbose readonly
+cd local 'quoted text' printf then readonly --verbose awk local
+test ${HOME} 2>/dev/null then printf
+		test && && /usr/bin "$1" test printf $(pwd) then /usr/bin export test
+'quoted text' echo echo 2>/dev/null done -eu 'quoted text' "$@" cd ${HOME}
+sed done x=1 | done ${HOME} x=1 awk && then awk
+	echo && --verbose 'quoted text' local done | grep 2>/dev/null
+	local test readonly echo export "$1" test
+	done local "$1" $(pwd) awk done awk 2>/dev/null
+"$1" sed "$1" awk x=1 /usr/bin -eu done sed | 2>/dev/null
+'quoted text' --verbose grep test
+		printf test ${HOME} /usr/bin && done done printf
+--verbose /usr/bin x=1 readonly "$@" then --verbose
+	'quoted text' test ${HOME} test | cd x=1 grep ${HOME} $(pwd) 2>/dev/null
+		export 2>/dev/null | --verbose grep ${HOME} -eu $(pwd) && local awk "$@"
+	"$@" /usr/bin awk echo cd ${HOME} cd then export
+local export printf done /usr/bin ${HOME} then done -eu ${HOME}
+		"$@" $(pwd) --verbose grep readonly
+		test local cd | grep x=1 then | | && ${HOME} ${HOME} cd && printf
+	done done $(pwd) printf && 'quoted text' "$@" x=1 "$1" | echo x=1
+done readonly /usr/bin $(pwd)
+	'quoted text' --verbose x=1
+export ${HOME} /usr/bin done awk export awk echo
+printf --verbose grep 'quoted text'
+	"$1" && done test 2>/dev/null sed readonly
+export sed | && awk readonly --verbose ${HOME}
+		printf ${HOME} --verbose 2>/dev/null x=1 sed /usr/bin 'quoted text' "$@"
+	test "$@" ${HOME} "$@" /usr/bin grep /usr/bin
+'quoted text' sed test 'quoted text'
+	2>/dev/null done | 2>/dev/null --verbose done done
+		x=1 echo && done export
+	grep 'quoted text' echo /usr/bin
+		test readonly "$@" awk printf ${HOME} 2>/dev/null local 2>/dev/null ${HOME}
+	grep 2>/dev/null -eu /usr/bin then echo done 'quoted text'
+	cd then export --verbose 2>/dev/null 2>/dev/null local
+		done awk "$@" sed | | && "$1"
+-eu $(pwd) "$1" cd ${HOME} readonly
+		then test then -eu printf | -eu && echo done sed --verbose --verbose sed
+sed x=1 test /usr/bin ${HOME} cd --verbose awk grep
+	&& sed $(pwd) /usr/bin 'quoted text' local echo grep "$@"
+	| echo "$1" readonly
+		2>/dev/null $(pwd) "$@" "$@" awk -eu awk && -eu done export printf
+sed $(pwd) /usr/bin ${HOME} done local awk done grep ${HOME} test awk
+"$@" /usr/bin export $(pwd) printf export
+	awk ${HOME} "$@" local ${HOME} cd local
+		cd export test test test sed awk done --verbose done ${HOME} | done
+		cd "$1" test printf sed /usr/bin x=1 /usr/bin 2>/dev/null "$@"
+		local readonly grep sed awk readonly && x=1 && echo readonly
+	'quoted text' x=1 local then
+		export export -eu export cd 2>/dev/null | 2>/dev/null then printf readonly
+		export "$@" 2>/dev/null
+	done 2>/dev/null --verbose "$1"
+		echo local $(pwd) echo ${HOME} $(pwd)
+		grep "$@" 2>/dev/null printf cd grep "$@" sed printf printf "$@"
+sed -eu && done $(pwd) "$1" local
+	then test echo 2>/dev/null export
+		${HOME} | -eu "$1" then $(pwd) "$@" | 2>/dev/null x=1 "$1" "$@" x=1 'quoted text'
+		cd && && printf -eu echo echo --verbose then
+local cd /usr/bin done readonly readonly local cd $(pwd)
+"$@" "$@" && grep -eu 'quoted text' "$@" printf
+		readonly ${HOME} done then --verbose printf $(pwd) "$1"
+		printf x=1 grep awk x=1 -eu ${HOME} -eu /usr/bin
+done -eu x=1 echo "$@" 2>/dev/null x=1 sed cd readonly echo
+		| 2>/dev/null readonly local test && "$@" "$@" test test cd export 'quoted text'
+grep sed 'quoted text' "$1" sed echo $(pwd) local
+		export 2>/dev/null printf | ${HOME} -eu readonly
+$(pwd) awk echo done awk && then
+readonly grep cd done x=1 'quoted text' echo
+		cd -eu echo done readonly x=1 ${HOME} 'quoted text' && printf
+	readonly sed ${HOME} && export sed -eu then
+export x=1 cd $(pwd) echo awk done && x=1 cd local echo printf test grep
+		"$1" done grep "$@" grep printf done readonly
+	local export x=1 /usr/bin readonly
+	2>/dev/null $(pwd) ${HOME} echo cd 'quoted text'
+		$(pwd) && $(pwd) --verbose "$1" -eu awk 2>/dev/null then
+awk echo export $(pwd) 2>/dev/null
+		${HOME} awk && echo x=1 done 'quoted text' then /usr/bin && then
+		2>/dev/null export 2>/dev/null printf |
+		echo /usr/bin "$1" cd awk
+		echo test local sed grep --verbose grep
+	--verbose x=1 awk -eu awk export && $(pwd)
+	then then x=1 echo 'quoted text' cd local grep && done readonly
+		&& then test 'quoted text' then --verbose echo export echo export
+	export local $(pwd) echo "$1" cd $(pwd) awk test done printf
+		2>/dev/null sed readonly readonly awk && awk 'quoted text' grep -eu
+		test /usr/bin sed x=1 done
+$(pwd) then echo local export &&
+		--verbose $(pwd) printf $(pwd)
+		local x=1 echo printf local
+'quoted text' test grep -eu -eu x=1 $(pwd)
+export x=1 done -eu /usr/bin local $(pwd) "$1" 'quoted text' export ${HOME}
+		local printf $(pwd) --verbose --verbose 2>/dev/null --verbose $(pwd) done
+export then && sed "$1" echo
+	| /usr/bin 2>/dev/null sed ${HOME} printf ${HOME} readonly done 'quoted text'
+	$(pwd) /usr/bin $(pwd) then echo
+	export printf -eu echo 2>/dev/null 'quoted text' "$@"
+		cd | printf then && $(pwd) sed 2>/dev/null awk -eu sed "$@" && done done 2>/dev/null
+	local 2>/dev/null ${HOME} readonly test && awk -eu
+		-eu -eu "$1" | echo --verbose echo readonly
+	export "$@" grep && sed "$1" test sed grep 2>/dev/null | /usr/bin
+grep grep echo local cd test x=1 printf cd printf cd x=1 local $(pwd) "$1" readonly
+		"$1" grep local local "$@" echo sed ${HOME}
+	x=1 | && | "$1" readonly cd sed /usr/bin "$1" "$@" -eu "$1" -eu
+	local then export readonly && awk awk /usr/bin done
+	awk cd x=1 2>/dev/null printf
+		${HOME} /usr/bin readonly printf then &&
+readonly x=1 /usr/bin
+	${HOME} cd readonly 'quoted text' /usr/bin cd /usr/bin done sed
+		&& sed export sed awk /usr/bin then "$@" /usr/bin && echo test /usr/bin awk --verbose
+		x=1 -eu sed 'quoted text' 2>/dev/null cd 2>/dev/null "$1" sed
+$(pwd) export /usr/bin echo -eu export
+	sed local awk 'quoted text' done
+		local -eu "$1" readonly readonly
+		done then "$@" "$@" local test sed x=1 grep -eu
+	| cd awk 'quoted text' then ${HOME}
+	${HOME} echo ${HOME} ${HOME} export /usr/bin | "$@" export /usr/bin
+	--verbose sed -eu -eu -eu && && sed local export
+	2>/dev/null echo local sed x=1
+"$1" x=1 x=1 ${HOME} awk "$@" local export -eu cd printf -eu cd export
+	2>/dev/null done --verbose && 2>/dev/null
+	"$1" readonly $(pwd) readonly then done && echo --verbose export
+	$(pwd) cd "$1" x=1 $(pwd) then then
+	$(pwd) done grep --verbose done ${HOME} test
+		"$@" readonly $(pwd) 2>/dev/null 2>/dev/null x=1 local "$1" then "$@" then
+		local && grep --verbose grep then sed ${HOME} sed grep 'quoted text'
+export x=1 readonly -eu then && readonly -eu test printf
+test grep export $(pwd) -eu grep
+echo 'quoted text' echo ${HOME} $(pwd) cd cd -eu 'quoted text'
+		printf 'quoted text' 'quoted text' x=1 local local awk 2>/dev/null
+2>/dev/null readonly $(pwd) "$1" "$@" --verbose
+	sed 'quoted text' test cd 2>/dev/null $(pwd)
+export --verbose then sed export | 'quoted text' 'quoted text' -eu 2>/dev/null
+readonly ${HOME} && "$@" && --verbose
+		&& && x=1 -eu test --verbose
+local "$@" /usr/bin export cd x=1 -eu readonly readonly "$@" grep ${HOME} 2>/dev/null
+		grep local && ${HOME} $(pwd)
+	printf $(pwd) cd | sed awk echo
+	2>/dev/null 'quoted text' $(pwd) sed test | test | then then /usr/bin export
+then --verbose grep readonly ${HOME} echo sed local then | test
+| && $(pwd) echo | /usr/bin 2>/dev/null "$1" local awk | && "$@" && sed
+cd | | printf "$@" export echo local /usr/bin echo ${HOME}
+	"$1" $(pwd) then x=1 local "$1" awk | --verbose grep echo && $(pwd) awk
+		done "$@" x=1 test cd && test export $(pwd) -eu -eu |
+	readonly grep x=1 sed printf done --verbose
+${HOME} cd --verbose /usr/bin export 'quoted text' then grep then "$1"
+	$(pwd) 'quoted text' |
+	-eu 'quoted text' "$1" done "$@" 2>/dev/null 'quoted text' 'quoted text'
+		$(pwd) 'quoted text' grep local && "$1" 'quoted text' local local done printf |
+grep x=1 "$@" sed 2>/dev/null "$@"
+		/usr/bin readonly /usr/bin grep -eu export awk --verbose 2>/dev/null
+awk /usr/bin awk "$@"
+		awk awk cd readonly -eu
+		"$@" /usr/bin echo ${HOME}
+		cd echo then awk --verbose sed -eu cd
+	--verbose cd -eu | test export grep awk sed "$@" | awk sed done cd awk
+	grep done grep then | test awk echo awk awk test ${HOME} x=1 --verbose done then
+		readonly | | /usr/bin 'quoted text' sed printf readonly
+		grep local 2>/dev/null then ${HOME} cd && "$1"
+		--verbose | sed "$1" x=1 "$@" readonly |
+echo | done -eu "$1" x=1 | "$1" ${HOME}
+"$@" echo export printf awk printf
+		cd /usr/bin awk sed 'quoted text'
+echo sed printf echo && sed
+		2>/dev/null --verbose local done /usr/bin "$@" grep awk --verbose | 'quoted text'
+-eu sed printf --verbose 'quoted text' "$1" "$@" | cd
+		local | cd "$1" awk ${HOME} "$@" local sed 'quoted text'
+'quoted text' && done 'quoted text' printf export
+		then /usr/bin done --verbose test | awk 2>/dev/null test
+	done ${HOME} awk sed local test done && awk ${HOME} --verbose
+awk grep printf /usr/bin cd
+		${HOME} -eu then test sed printf printf test done export 2>/dev/null ${HOME}
+		'quoted text' "$1" printf readonly local $(pwd)
+	echo awk echo "$1" "$1" grep export
+"$1" x=1 && done | x=1 "$1" readonly
+		export | printf "$@" readonly cd
+| local | | done printf printf then x=1 'quoted text' ${HOME} cd
+	-eu 2>/dev/null "$1" | done "$@"
+		test local sed 'quoted text' echo then "$1" | done x=1 && 'quoted text' 'quoted text'
+x=1 ${HOME} echo export grep ${HOME} awk ${HOME} export $(pwd)
+	$(pwd) then 'quoted text' sed "$@" x=1 local x=1 echo && then
+"$1" "$@" awk "$@" 2>/dev/null 2>/dev/null && cd "$1" "$1"
+	cd readonly | 2>/dev/null "$@" $(pwd) cd 2>/dev/null -eu
+	then awk export then $(pwd) local |
+		grep 'quoted text' cd then | x=1 -eu x=1 | then 2>/dev/null sed -eu local
+	$(pwd) cd then /usr/bin &&
+sed done ${HOME} echo printf | --verbose
+	2>/dev/null printf then x=1 "$1" echo printf cd
+readonly printf printf "$1" 2>/dev/null export export cd cd export
+$(pwd) -eu | readonly ${HOME} printf 2>/dev/null sed cd $(pwd) 'quoted text'
+"$@" "$1" echo then --verbose $(pwd)
+	export -eu --verbose test $(pwd) && grep sed echo done printf
+		--verbose --verbose "$1" -eu grep
+	"$1" x=1 ${HOME} cd 'quoted text'
+awk $(pwd) echo cd grep test "$1" printf
+| --verbose 2>/dev/null local test test && | sed --verbose x=1 'quoted text'
+"$1" /usr/bin then cd 2>/dev/null "$1" $(pwd) "$1" test
+/usr/bin --verbose x=1 && awk x=1
+	$(pwd) /usr/bin "$@" then | --verbose x=1 -eu ${HOME} cd grep -eu export 2>/dev/null
+		then echo grep then &&
+awk 'quoted text' --verbose
+		test readonly test printf sed "$@" then grep
+	echo | && readonly | printf
+cd awk test echo done cd done "$@" echo 'quoted text' /usr/bin
+		x=1 local grep grep readonly then "$@" $(pwd) $(pwd) --verbose cd
+		echo cd export /usr/bin "$@" test | echo export done local printf readonly
+/usr/bin $(pwd) ${HOME} | | "$@" awk /usr/bin
+/usr/bin --verbose readonly local ${HOME}
+		test 2>/dev/null echo readonly sed "$1"
+grep cd && && test grep done -eu "$1" grep --verbose x=1 | "$1" test ${HOME}
+	| 2>/dev/null "$@" export $(pwd) export --verbose cd x=1 then /usr/bin x=1 printf
+cd echo "$@" test ${HOME} sed awk $(pwd) export
+		export then sed 'quoted text' printf grep test readonly grep echo ${HOME} 'quoted text'
+	then echo $(pwd) cd && export echo
+		x=1 x=1 printf then then readonly | awk cd sed echo readonly readonly
+		/usr/bin awk then "$@" cd -eu /usr/bin $(pwd) grep
+		local test 2>/dev/null && --verbose sed | | echo local "$@" x=1 done 2>/dev/null
+		&& $(pwd) $(pwd) printf awk printf done | test local $(pwd) $(pwd) /usr/bin
+		/usr/bin 2>/dev/null "$1" done readonly 2>/dev/null 2>/dev/null
+		then --verbose grep 'quoted text' test readonly
+		test "$@" local test "$@"
+	done "$@" 2>/dev/null test test $(pwd)
+		echo test awk test test 2>/dev/null 2>/dev/null test
+'quoted text' test done echo
+/usr/bin 'quoted text' -eu done | done export | |
+	$(pwd) -eu 2>/dev/null "$1" ${HOME}
+	&& && x=1 --verbose "$@" export
+	done cd done awk export
+	| | sed | "$1" grep echo | echo "$1" sed ${HOME} -eu /usr/bin then
+		| x=1 ${HOME} 'quoted text'
+echo echo /usr/bin 'quoted text' done cd "$@" 2>/dev/null
+	awk /usr/bin done 2>/dev/null readonly ${HOME} ${HOME} export done export "$1"
+		export awk && | /usr/bin /usr/bin then ${HOME} readonly
+		sed "$@" grep x=1 --verbose /usr/bin
+		awk 2>/dev/null grep local /usr/bin | ${HOME} then 'quoted text'
+	&& awk grep export "$@" printf sed ${HOME} 'quoted text'
+		grep export done /usr/bin test
+		'quoted text' ${HOME} --verbose --verbose
+	-eu done x=1 | 'quoted text' then -eu x=1 sed
+		sed 2>/dev/null "$@" readonly
+		/usr/bin awk x=1 x=1 -eu $(pwd) test "$1" && ${HOME} test
+	cd test grep 2>/dev/null then
+	echo /usr/bin test readonly /usr/bin cd /usr/bin 2>/dev/null 'quoted text'
+sed -eu printf then 2>/dev/null --verbose $(pwd) then done /usr/bin | export
+		printf grep /usr/bin local printf grep && $(pwd) printf
+	sed test test then "$@" printf ${HOME} 2>/dev/null $(pwd) test echo "$@"
+	test && test awk sed sed printf local awk | grep grep $(pwd) ${HOME} readonly
+		cd test && 2>/dev/null && test done "$1" && readonly local
+	awk | done test printf "$@" && 2>/dev/null --verbose local echo grep done readonly
+		done echo && then test | "$1" ${HOME} x=1 cd x=1 printf
+	-eu --verbose && /usr/bin --verbose
+	'quoted text' local "$@" 2>/dev/null |
+		&& test printf | printf ${HOME} echo export $(pwd) local
+sed 'quoted text' test /usr/bin done printf ${HOME}
+	-eu | -eu "$1" test /usr/bin local export ${HOME} echo
+		"$@" /usr/bin awk readonly "$1" --verbose $(pwd) && 2>/dev/null
+		--verbose grep export "$@" echo readonly grep readonly
+cd printf awk 2>/dev/null
+		sed | cd "$1" test x=1 echo awk "$1" done x=1 then then done printf
+	sed then 'quoted text' then
+2>/dev/null done printf x=1 grep readonly
+	cd readonly 'quoted text' grep test readonly 2>/dev/null test
+		"$@" readonly test cd && | 'quoted text' | --verbose --verbose
+		$(pwd) && 2>/dev/null
+		awk printf local /usr/bin grep echo "$@" readonly
+	/usr/bin "$@" 'quoted text' export local -eu test --verbose
+	awk --verbose ${HOME}
+grep && echo sed && "$@" 'quoted text' -eu ${HOME} sed && 2>/dev/null
+	${HOME} --verbose /usr/bin sed "$1" awk awk && then && "$@" 2>/dev/null
+	'quoted text' && 'quoted text' export done | /usr/bin awk done
+		--verbose then /usr/bin /usr/bin ${HOME} && done export awk
+	&& /usr/bin printf test "$1" test | local readonly sed local "$@"
+		"$@" x=1 cd printf 'quoted text' local done done local
+	test ${HOME} then done "$@" 'quoted text' cd "$@" -eu then printf
+		then /usr/bin "$1" echo export 2>/dev/null -eu --verbose test test "$@" "$1" awk
+		2>/dev/null --verbose cd readonly
+readonly test ${HOME} cd
+		awk echo then 'quoted text' grep echo readonly --verbose ${HOME}
+		cd done readonly -eu $(pwd) --verbose export export local /usr/bin
+done echo $(pwd) $(pwd) grep
+	2>/dev/null grep "$@" --verbose sed --verbose
+		echo "$1" --verbose --verbose
+		2>/dev/null readonly /usr/bin then | readonly awk -eu
+		then "$1" --verbose /usr/bin 2>/dev/null "$1" $(pwd) printf printf ${HOME} /usr/bin
+		| sed 2>/dev/null 2>/dev/null sed export && -eu 'quoted text' readonly "$1"
+		grep done printf then awk && done
+	test | readonly echo 2>/dev/null
+test 'quoted text' grep /usr/bin
+	/usr/bin grep grep sed "$1" awk "$1" export | test
+		done --verbose "$@" echo ${HOME} echo readonly then "$1" test readonly
+"$@" /usr/bin awk awk done export "$@" 2>/dev/null "$@" cd 'quoted text'
+${HOME} readonly local "$1" test sed $(pwd) 2>/dev/null readonly
+export /usr/bin $(pwd) awk 2>/dev/null x=1 local x=1 awk cd
+$(pwd) grep && "$1" printf printf 'quoted text' "$1" &&
+		echo echo "$@" "$@" export 2>/dev/null grep grep && awk --verbose
+		"$@" export --verbose && test
+-eu echo -eu ${HOME} export ${HOME} printf done
+		printf test awk ${HOME} then 'quoted text' "$@" | local sed sed $(pwd)
+then $(pwd) ${HOME} test sed sed local /usr/bin export
+	echo x=1 export cd readonly export -eu
+x=1 cd | | x=1 grep -eu x=1 /usr/bin -eu | -eu awk grep && export grep printf
+		2>/dev/null done && then sed test
+	"$@" grep ${HOME} --verbose local -eu printf printf
+	$(pwd) readonly awk cd readonly echo done -eu readonly -eu -eu grep "$1"
+		test printf -eu "$@" sed grep local
+readonly | --verbose then $(pwd) && export sed $(pwd) | -eu local printf
+printf ${HOME} 'quoted text' local grep --verbose
+	echo "$1" /usr/bin "$1" cd 2>/dev/null $(pwd) export /usr/bin /usr/bin
+"$@" local "$@" sed $(pwd) printf "$1" cd awk done /usr/bin "$1" awk
+		then -eu grep | && done sed readonly then sed x=1 done awk -eu
+		echo "$1" export grep | printf
+	local -eu 2>/dev/null local test awk x=1
+	then echo test /usr/bin -eu /usr/bin -eu awk
+		sed done 2>/dev/null readonly
+		awk x=1 x=1 "$@" ${HOME} export sed 2>/dev/null printf local export
+awk grep local then then 2>/dev/null
+	| local local test done echo then && $(pwd) 2>/dev/null 'quoted text' awk
+		grep $(pwd) echo export export grep
+	$(pwd) test ${HOME} grep sed done awk ${HOME} x=1 then then 'quoted text'
+	awk export done awk readonly | readonly test /usr/bin echo
+	/usr/bin done then test --verbose 2>/dev/null
+	/usr/bin echo cd && test grep sed && "$1" | awk test 'quoted text' sed grep done
+		test cd -eu echo readonly then echo | export && "$1" $(pwd) done
+grep sed grep 'quoted text' ${HOME} $(pwd) && export
+	readonly 2>/dev/null "$@" echo local "$1" && sed echo test
+		done readonly $(pwd) then then cd export /usr/bin "$1" && awk export sed 2>/dev/null
+		--verbose then then "$@" --verbose awk test | && -eu then test "$1" --verbose
+x=1 cd /usr/bin "$@" "$@" ${HOME} printf export cd readonly
+	export sed readonly awk grep local local then local test
+--verbose $(pwd) "$1" local printf cd --verbose echo
+		echo $(pwd) 2>/dev/null
+	done 2>/dev/null $(pwd) then --verbose printf && && 'quoted text' test
+		printf grep ${HOME} "$1" echo done local
+&& --verbose -eu export then printf printf -eu 2>/dev/null
+x=1 grep "$1" then $(pwd)
+		echo x=1 grep export && "$1" cd /usr/bin
+		export test "$1" "$1" -eu cd "$1" $(pwd) "$@" 'quoted text' x=1 | grep $(pwd)
+'quoted text' x=1 -eu /usr/bin | then done printf printf --verbose
+'quoted text' | 'quoted text' "$1" | "$@" && test /usr/bin ${HOME}
+		then test "$1" awk local test test readonly readonly
+awk echo "$1" 2>/dev/null $(pwd) cd cd printf "$@" then &&
+		-eu readonly && sed | --verbose then /usr/bin local then test -eu printf then
+		printf cd "$@" -eu sed printf readonly $(pwd) 'quoted text' ${HOME} "$1" export
+	local test awk | cd /usr/bin 2>/dev/null grep
+"$1" ${HOME} "$@" test export "$@" export awk readonly
+grep -eu readonly then done | --verbose /usr/bin then -eu grep done x=1 export
+readonly then ${HOME} export done --verbose -eu ${HOME} printf sed printf /usr/bin
+	local grep -eu then -eu test | local "$@"
+export done readonly local "$@" --verbose ${HOME} echo "$1" | -eu grep /usr/bin
+"$@" $(pwd) 2>/dev/null "$1" 'quoted text' "$1" --verbose test 'quoted text'
+	export $(pwd) sed printf grep x=1 cd 2>/dev/null "$1" && test done then
+	sed grep $(pwd) x=1 $(pwd) readonly --verbose sed | awk readonly
+"$1" readonly --verbose
+	"$1" test export 2>/dev/null export test | ${HOME} cd readonly readonly
+	| grep ${HOME} done done && "$@"
+printf ${HOME} /usr/bin $(pwd) && /usr/bin 2>/dev/null
+		sed export "$@" 2>/dev/null /usr/bin
+	printf echo sed "$1" grep --verbose $(pwd) ${HOME} done 2>/dev/null export "$@"
+		&& "$1" x=1 $(pwd) --verbose -eu
+	sed -eu -eu then 2>/dev/null "$@" /usr/bin printf 2>/dev/null
+	done echo readonly test /usr/bin x=1 "$1" && done export ${HOME} /usr/bin cd
+	x=1 cd done ${HOME} then sed sed 'quoted text' $(pwd) sed then && --verbose
+		local -eu done grep | awk 'quoted text' sed echo grep /usr/bin grep sed done
+	--verbose printf | 'quoted text' && x=1 printf
+test grep readonly export export 2>/dev/null "$@" "$@" done 'quoted text' -eu
+${HOME} "$@" /usr/bin /usr/bin grep $(pwd) ${HOME} local /usr/bin
+	'quoted text' && x=1 x=1 then awk awk && 'quoted text' 2>/dev/null
+	&& export done /usr/bin $(pwd) echo
+| done 'quoted text' x=1
+		/usr/bin then /usr/bin | test -eu grep 'quoted text'
+		$(pwd) local cd test ${HOME} awk $(pwd) "$@" cd printf
+	then test 'quoted text'
+		cd && grep awk done 'quoted text' "$@" readonly
+	local local -eu /usr/bin 2>/dev/null sed cd ${HOME} cd
+		'quoted text' 2>/dev/null cd export -eu --verbose
+then "$@" echo printf "$@" readonly awk done sed cd x=1
+		done test sed $(pwd) -eu done | ${HOME} x=1
+	local echo -eu "$@" "$@" printf done 2>/dev/null cd | ${HOME} | /usr/bin | 'quoted text'
+	then readonly 'quoted text' export export --verbose $(pwd) test /usr/bin
+		| readonly cd /usr/bin "$1" && 'quoted text' awk
+	| awk test | "$@" then echo 2>/dev/null test done -eu
+	'quoted text' 2>/dev/null cd -eu -eu --verbose --verbose
+	echo local printf | grep "$@" 2>/dev/null awk -eu then -eu cd $(pwd) readonly
+		awk done then local "$1" && local cd printf x=1 then 2>/dev/null
+		sed then && && done && ${HOME}
+	echo cd | 'quoted text' test
+	grep && | 2>/dev/null sed $(pwd) "$1" printf $(pwd)
+	"$1" 'quoted text' then ${HOME} $(pwd)
+		2>/dev/null ${HOME} test cd "$1" sed -eu | 2>/dev/null ${HOME} test /usr/bin "$@"
+	${HOME} --verbose && done awk x=1 "$1" echo readonly printf $(pwd)
+		grep "$1" echo echo cd --verbose "$1" -eu && -eu "$1" /usr/bin x=1 export $(pwd)
+2>/dev/null "$@" then && sed grep printf "$1" /usr/bin && readonly $(pwd)
+		| x=1 && 2>/dev/null -eu $(pwd)
+		| awk done awk test readonly sed "$@" "$1" printf
+	'quoted text' export -eu /usr/bin then 2>/dev/null
+		${HOME} export done echo sed sed grep 2>/dev/null printf
+then -eu --verbose 'quoted text' && echo echo 2>/dev/null printf
+2>/dev/null && test grep grep && awk -eu grep test "$@" $(pwd) && x=1 ${HOME}
+	then readonly "$1" export $(pwd) "$1" cd done readonly grep sed | "$1" export sed
+		--verbose cd done awk --verbose cd test sed x=1 cd && && readonly
+x=1 x=1 $(pwd) --verbose -eu 2>/dev/null && test ${HOME}
+		-eu ${HOME} && 2>/dev/null done then printf test x=1
+awk cd then ${HOME} "$1" $(pwd) ${HOME} printf printf 'quoted text' sed awk
+	sed 'quoted text' echo 2>/dev/null local grep test --verbose
+		$(pwd) grep sed then done test test -eu
+		printf export printf echo awk x=1 test "$@" test
+		$(pwd) /usr/bin --verbose done 'quoted text' export
+printf "$1" && grep --verbose "$1" printf echo local ${HOME}
+		export cd echo echo "$@" --verbose ${HOME} 2>/dev/null 'quoted text'
+readonly done && printf
+		local x=1 done --verbose && sed --verbose /usr/bin --verbose --verbose
+	printf -eu local x=1 grep local ${HOME} readonly
+		$(pwd) x=1 | -eu $(pwd) then echo sed local then ${HOME} grep echo
+readonly grep awk $(pwd) printf printf
+		'quoted text' -eu readonly | echo export && "$@"
+"$1" export echo sed done cd done x=1 cd test ${HOME}
+x=1 echo | test x=1 readonly echo $(pwd) export &&
+local ${HOME} test && 'quoted text' x=1 echo readonly
+	"$@" ${HOME} done x=1 test "$@" "$1"
+readonly grep | done -eu -eu
+		grep local 'quoted text' export cd $(pwd) "$1" $(pwd)
+local --verbose 2>/dev/null 2>/dev/null printf
+	test "$@" -eu ${HOME} export readonly
+	grep sed | | test grep printf /usr/bin
+	"$@" done readonly grep echo sed printf
+test ${HOME} | --verbose cd /usr/bin 'quoted text' "$1" && 'quoted text'
+	echo echo && then | awk 2>/dev/null test printf test /usr/bin 'quoted text'
+export echo cd | x=1 sed readonly readonly printf ${HOME} x=1 2>/dev/null
+	'quoted text' grep local ${HOME} $(pwd) -eu
+	/usr/bin | 2>/dev/null
+		/usr/bin export -eu $(pwd)
+		cd $(pwd) "$1" echo test cd 2>/dev/null "$1" printf
+		grep x=1 done 'quoted text' $(pwd) echo ${HOME} /usr/bin printf | /usr/bin done
+	local && sed test | -eu | ${HOME} ${HOME} grep "$@" "$@" | 'quoted text'
+		&& done /usr/bin -eu 2>/dev/null "$1" "$@" test /usr/bin test echo
+x=1 && -eu x=1 cd /usr/bin --verbose
+		--verbose && awk readonly 'quoted text' 'quoted text' ${HOME} 'quoted text' then
+echo | x=1 local /usr/bin test /usr/bin
+		--verbose echo sed x=1 cd test
+grep echo -eu ${HOME} grep sed local echo
+	echo local cd 'quoted text'
+	--verbose readonly $(pwd) done 2>/dev/null 'quoted text' x=1 awk cd awk local
+	awk x=1 2>/dev/null awk ${HOME} $(pwd)
+cd awk printf echo readonly
+	then "$@" 2>/dev/null --verbose readonly && then 2>/dev/null
+		--verbose --verbose | grep $(pwd) -eu grep ${HOME} 2>/dev/null
+		grep $(pwd) readonly 'quoted text' sed export
+		$(pwd) "$1" printf then && printf | done "$1" readonly | then printf x=1 export
+		then && x=1 grep "$@" export then && cd
+	2>/dev/null local local
+		-eu readonly 2>/dev/null x=1 then x=1 printf && printf /usr/bin grep x=1
+done "$1" readonly sed
+	test then 2>/dev/null "$1" sed local local export ${HOME} done done
+		local awk cd grep | "$1"
+		awk local local cd "$@" x=1 "$1" cd -eu printf
+"$@" readonly echo /usr/bin && test "$@" test "$1" "$1" sed sed -eu local
+	awk test 2>/dev/null sed $(pwd)
+		printf /usr/bin awk && readonly echo grep local export cd -eu printf -eu
+	--verbose ${HOME} awk -eu test echo local $(pwd) x=1 'quoted text' 'quoted text'
+readonly && done 'quoted text' ${HOME} readonly
+		2>/dev/null && "$@" -eu grep 2>/dev/null awk echo awk echo --verbose
+		local printf test sed x=1 $(pwd) --verbose "$1"
+	grep export cd 'quoted text' done then
+then echo 2>/dev/null export
+	"$@" "$1" -eu | "$1" done ${HOME} /usr/bin printf local cd 2>/dev/null then
+readonly awk echo readonly test
+	--verbose "$@" awk "$@" test 'quoted text' /usr/bin x=1 |
+	"$1" x=1 echo && cd sed printf export test sed x=1 sed 2>/dev/null
+	then local $(pwd) 2>/dev/null --verbose --verbose cd ${HOME}
+	done then readonly readonly && --verbose x=1 ${HOME} | done
+export --verbose x=1 'quoted text' -eu then cd -eu export echo $(pwd)
+$(pwd) && done "$1" $(pwd) "$@" ${HOME} ${HOME}
+	2>/dev/null $(pwd) done --verbose test ${HOME} echo | test
+/usr/bin 2>/dev/null -eu
+	"$1" ${HOME} x=1 then "$1" "$@" echo 2>/dev/null test 2>/dev/null
+		test 'quoted text' "$@" sed 2>/dev/null
+$(pwd) done 2>/dev/null local 2>/dev/null 2>/dev/null
+		done --verbose local test export
+		x=1 grep "$@" cd --verbose sed test 2>/dev/null /usr/bin &&
+	export 'quoted text' test --verbose -eu x=1
+	"$1" -eu awk test && | echo --verbose 'quoted text'
+	"$1" then | --verbose | x=1 readonly /usr/bin && export 'quoted text' ${HOME}
+"$@" "$1" awk grep sed awk
+	$(pwd) awk --verbose && -eu cd local test "$@" "$@" printf -eu | "$@"
+		readonly awk "$@" readonly printf | grep /usr/bin then | grep done
+/usr/bin export "$@" /usr/bin readonly 'quoted text'
+$(pwd) --verbose x=1 && export awk 2>/dev/null x=1 sed
+"$@" 'quoted text' local cd "$@" cd 2>/dev/null
+	readonly 'quoted text' grep $(pwd) awk -eu export awk local --verbose printf ${HOME}
+		--verbose ${HOME} x=1 -eu cd --verbose done grep done export export &&
+'quoted text' ${HOME} readonly then readonly test sed local grep
+		'quoted text' $(pwd) awk grep -eu then
+		${HOME} "$1" then done cd --verbose grep "$@" printf readonly test $(pwd) $(pwd)
+	done local $(pwd) test then && | 2>/dev/null awk then -eu &&
+'quoted text' readonly sed local "$1" x=1
+	readonly -eu /usr/bin | test export && | cd test
+/usr/bin echo sed readonly printf grep
+	done done --verbose done
+local echo export $(pwd) -eu x=1 grep $(pwd)
+		'quoted text' local ${HOME} local
+		done sed grep done printf $(pwd) && echo grep done awk test /usr/bin
+		-eu cd && x=1 then cd sed x=1 && test x=1 grep
+		then export $(pwd) local local $(pwd) done 'quoted text' export
+	printf 2>/dev/null /usr/bin awk awk -eu 2>/dev/null | $(pwd) test
+printf printf export -eu echo "$@" echo readonly x=1 "$@" 2>/dev/null "$1" printf
+then x=1 'quoted text' cd sed export then $(pwd) /usr/bin
+		/usr/bin done $(pwd) | $(pwd) then
+readonly && echo "$1" done 'quoted text'
+	printf test "$@" -eu --verbose grep 2>/dev/null readonly test "$@" /usr/bin
+		then ${HOME} -eu && && printf "$@"
+		local export awk awk export export
+export "$1" /usr/bin | -eu echo echo grep | export
+	2>/dev/null 2>/dev/null grep -eu 'quoted text' readonly 'quoted text'
+	| 2>/dev/null 'quoted text' cd local --verbose && 2>/dev/null readonly ${HOME}
+		$(pwd) $(pwd) printf -eu | awk awk grep | --verbose
+--verbose then $(pwd) 2>/dev/null 2>/dev/null export then readonly --verbose x=1
+printf 2>/dev/null then export 'quoted text'
+	${HOME} 'quoted text'
+	| 'quoted text' test && 2>/dev/null printf awk x=1 awk
+sed "$@" && --verbose x=1 "$1" "$1" sed && "$1" done ${HOME} echo
+	cd cd sed --verbose export && echo echo 'quoted text' readonly && test printf
+		sed "$1" $(pwd) /usr/bin awk "$@" --verbose 'quoted text' done grep
+		/usr/bin awk echo "$1" readonly
+		-eu export x=1 ${HOME} 2>/dev/null sed x=1 | $(pwd) && 'quoted text'
+	test ${HOME} "$@" | sed sed | 2>/dev/null 'quoted text'
+sed readonly sed -eu -eu test done sed readonly
+x=1 sed && sed readonly sed && local -eu /usr/bin then 'quoted text'
+	${HOME} x=1 2>/dev/null $(pwd) test && printf 2>/dev/null $(pwd)
+	grep grep sed test cd --verbose local ${HOME} export
+	cd test echo cd readonly | local
+-eu then ${HOME} x=1 'quoted text' $(pwd) grep test --verbose
+	'quoted text' awk && "$@" /usr/bin printf | 'quoted text'
+		test && export sed then readonly 'quoted text'
+	then echo export --verbose sed grep done grep local
+	echo && "$@" echo readonly echo /usr/bin "$@" --verbose sed
+		readonly && local /usr/bin local /usr/bin 'quoted text' "$@" awk echo cd
+	then test 'quoted text' then test
+done test done x=1 cd echo printf export $(pwd) echo /usr/bin printf 2>/dev/null
+		${HOME} /usr/bin printf x=1 | cd cd "$@" 2>/dev/null echo
+		"$@" | done && 'quoted text' then awk readonly /usr/bin --verbose export
+	readonly awk export $(pwd) awk $(pwd) -eu readonly x=1
+		readonly /usr/bin cd done "$@" $(pwd) done x=1 awk awk "$@" x=1 echo
+		/usr/bin export /usr/bin echo
+	test cd && readonly 2>/dev/null "$1" "$1" printf done
+done && echo "$@" /usr/bin "$@" grep /usr/bin test export
+		local 'quoted text' x=1 'quoted text' "$@" "$1" ${HOME} sed readonly
@@ -0,0 +1,2001 @@
+${HOME} 2>/dev/null ${HOME} 'quoted text'
+		"$@" local export awk local | --verbose then --verbose
+local done then 2>/dev/null "$1" 'quoted text' ${HOME} echo local
+${HOME} --verbose done x=1 &&
+	readonly "$@" ${HOME} --verbose "$@" "$@" x=1 grep cd readonly awk "$1"
+		awk awk export $(pwd) --verbose --verbose awk awk awk x=1 /usr/bin
+		"$@" echo x=1 | /usr/bin
+		| $(pwd) local printf ${HOME} $(pwd) && sed | cd readonly
+x=1 ${HOME} test done ${HOME} grep $(pwd)
+	sed done 2>/dev/null /usr/bin /usr/bin printf -eu ${HOME}
+	'quoted text' done /usr/bin done /usr/bin
+-eu "$1" then x=1 sed --verbose /usr/bin $(pwd) && "$@" grep
+	test x=1 grep done test x=1
+done --verbose test 'quoted text' /usr/bin -eu -eu sed done --verbose 'quoted text'
+readonly cd 'quoted text'
+"$1" awk grep x=1 && export | $(pwd) -eu local then
+cd sed local "$@" echo then readonly printf
+	"$@" cd $(pwd) awk awk 2>/dev/null
+		&& 'quoted text' "$@" test grep sed echo -eu export
+		export | printf sed grep done 'quoted text' x=1 ${HOME} readonly
+		&& local done "$@" grep then sed | 'quoted text' sed printf export test done cd
+	local 2>/dev/null awk ${HOME} then
+	"$@" export 'quoted text' "$1"
+		| sed local /usr/bin export && $(pwd) -eu x=1 readonly test &&
+	/usr/bin --verbose test x=1 2>/dev/null then "$1" 2>/dev/null
+test printf readonly then
+	then awk ${HOME} cd --verbose /usr/bin printf grep sed
+--verbose /usr/bin ${HOME} /usr/bin
+done then printf 'quoted text' /usr/bin test echo "$1" $(pwd)
+'quoted text' "$@" /usr/bin | $(pwd) "$@" printf "$1" echo x=1 grep -eu
+	sed -eu cd then printf awk then cd $(pwd) done printf x=1 | awk ${HOME}
+		--verbose 2>/dev/null sed awk awk echo test 'quoted text'
+		$(pwd) sed sed grep ${HOME} $(pwd) awk export printf local
+	&& local sed 2>/dev/null readonly grep /usr/bin
+/usr/bin then test /usr/bin sed x=1 sed /usr/bin
+	sed -eu --verbose printf "$1" --verbose echo "$@" local
+		"$@" -eu "$@" --verbose --verbose export && /usr/bin echo
+	done grep ${HOME} -eu cd then grep x=1 --verbose
+		grep /usr/bin export 2>/dev/null
+${HOME} "$1" "$@" --verbose "$1" local
+		awk | printf grep x=1
+	${HOME} /usr/bin echo x=1 local printf echo sed /usr/bin readonly
+	2>/dev/null done && --verbose grep 'quoted text'
+	"$@" then readonly "$1" done "$@"
+		local | $(pwd) && ${HOME} "$@" 2>/dev/null echo | done "$1" /usr/bin /usr/bin
+		${HOME} readonly 2>/dev/null "$@" --verbose 'quoted text'
+		"$1" "$@" ${HOME} test $(pwd) | ${HOME}
+		&& ${HOME} --verbose "$@" then printf | grep
+	"$1" x=1 && 2>/dev/null cd export local awk "$@" && sed done $(pwd) "$1" "$@"
+	2>/dev/null test "$1" readonly
+		${HOME} export echo "$@" $(pwd) /usr/bin
+		readonly echo 2>/dev/null export
+"$@" 'quoted text' "$@" 2>/dev/null "$@" && "$@" cd then &&
+		export test done 'quoted text' "$1" printf grep printf printf printf echo
+	$(pwd) done "$1" then $(pwd) --verbose ${HOME} "$@" export
+		"$1" export 2>/dev/null
+'quoted text' "$1" 2>/dev/null $(pwd) then awk then "$1" export --verbose
+export then grep grep 2>/dev/null
+-eu $(pwd) done -eu x=1 readonly
+		-eu "$@" export cd done test echo 2>/dev/null
+| && "$1" echo printf printf readonly
+printf then readonly 'quoted text'
+	then cd ${HOME} $(pwd)
+	sed "$1" readonly sed printf done 2>/dev/null
+	printf "$@" "$@" awk export 2>/dev/null x=1 ${HOME} awk "$@" && 2>/dev/null
+	--verbose cd cd ${HOME} export readonly /usr/bin "$1" local
+		printf "$1" "$@" readonly && 2>/dev/null --verbose grep | && printf local
+	export --verbose "$@" x=1
+		"$1" echo | readonly test --verbose
+test "$1" | /usr/bin readonly x=1
+		grep --verbose grep -eu 'quoted text' local --verbose readonly then $(pwd) printf
+		sed echo 'quoted text' export export ${HOME}
+		-eu x=1 local x=1 "$@" echo
+	readonly | "$@" sed local test awk
+		&& 2>/dev/null 2>/dev/null 'quoted text' cd /usr/bin /usr/bin done --verbose --verbose
+	test done x=1 /usr/bin sed | grep 2>/dev/null then cd $(pwd) grep local
+"$@" grep | $(pwd) 2>/dev/null x=1 && grep ${HOME}
+		printf x=1 /usr/bin printf export test | done 'quoted text'
+	echo cd "$1" ${HOME} $(pwd) echo
+$(pwd) local cd then local --verbose
+then done cd ${HOME} -eu local
+	-eu sed $(pwd) $(pwd) grep "$1" x=1 && export "$1" "$@"
+		-eu "$@" -eu export --verbose export local echo then "$@"
+${HOME} printf export sed export -eu | 'quoted text'
+		done "$1" readonly --verbose /usr/bin readonly $(pwd) printf /usr/bin --verbose
+		readonly "$1" $(pwd) done printf
+		--verbose grep done ${HOME} -eu && -eu printf
+		"$1" grep test x=1 --verbose
+	cd && export | sed --verbose x=1 grep $(pwd) export 2>/dev/null
+then test x=1 -eu $(pwd) 2>/dev/null
+		echo sed $(pwd) /usr/bin awk local awk cd cd ${HOME} awk done echo x=1
+readonly cd 'quoted text' --verbose
+		"$@" done awk -eu cd -eu 'quoted text' awk awk /usr/bin "$1" readonly
+done 2>/dev/null | cd /usr/bin export
+	"$1" $(pwd) readonly printf export
+	--verbose && 'quoted text' export readonly then 2>/dev/null
+		/usr/bin grep local sed local "$@" && awk && "$@" awk "$@"
+	grep readonly local | $(pwd)
+then test done /usr/bin echo ${HOME} ${HOME} && grep "$@"
+		'quoted text' $(pwd) 2>/dev/null test export $(pwd) "$1" ${HOME} cd readonly
+done ${HOME} x=1 readonly test 'quoted text' readonly
+x=1 "$1" printf 2>/dev/null then echo local /usr/bin
+		test 'quoted text' $(pwd) test $(pwd) $(pwd)
+		sed awk cd --verbose readonly done awk printf local cd "$1"
+sed grep "$1" --verbose --verbose /usr/bin local export cd printf
+	"$@" sed "$1" | cd cd awk "$1" $(pwd) sed && -eu then printf 2>/dev/null
+/usr/bin /usr/bin 2>/dev/null
+		local 'quoted text' printf /usr/bin
+	"$@" /usr/bin -eu echo --verbose -eu "$1" 2>/dev/null export printf "$@" done
+		"$1" $(pwd) printf x=1 $(pwd) x=1 export cd /usr/bin && grep export -eu ${HOME}
+	export then awk "$1" test awk printf
+	readonly local echo printf printf echo 'quoted text' --verbose 'quoted text'
+-eu printf printf $(pwd) $(pwd)
+sed x=1 export 2>/dev/null
+-eu sed 'quoted text' x=1 "$1" "$1" echo sed grep test x=1
+	| ${HOME} echo awk test export 2>/dev/null 'quoted text' "$@"
+"$@" "$1" "$@" /usr/bin 2>/dev/null 2>/dev/null $(pwd) "$@" "$1" test cd
+		--verbose cd 2>/dev/null readonly "$@" $(pwd) done
+printf local $(pwd) "$@" grep --verbose printf && readonly
+	"$@" done cd then | "$@" && $(pwd) $(pwd)
+		-eu "$1" local "$@" ${HOME} echo "$@" then "$1" "$1" $(pwd) done --verbose
+		2>/dev/null && ${HOME} test /usr/bin
+echo printf printf printf $(pwd) local && 'quoted text' readonly awk sed done ${HOME}
+sed test 'quoted text' awk done echo 2>/dev/null echo x=1 awk ${HOME} sed
+$(pwd) printf x=1 /usr/bin
+	x=1 x=1 then --verbose --verbose /usr/bin -eu test done sed | "$@"
+		export done sed --verbose x=1 sed | /usr/bin && --verbose ${HOME}
+		x=1 x=1 grep printf sed
+&& sed 'quoted text' | /usr/bin sed grep ${HOME}
+	sed | cd done cd export readonly cd done echo test
+	&& --verbose x=1 -eu --verbose | done done awk local "$1"
+		'quoted text' grep | then -eu --verbose
+		-eu | readonly printf $(pwd) | awk --verbose
+-eu test printf $(pwd) echo then local awk
+	$(pwd) awk export then cd sed cd readonly
+	then "$1" ${HOME} grep
+cd --verbose 'quoted text' -eu /usr/bin
+		$(pwd) 2>/dev/null test printf awk done awk readonly grep "$1" sed
+		$(pwd) printf done echo sed | local 2>/dev/null "$1" export | --verbose
+	cd done readonly 2>/dev/null
+test x=1 echo echo "$1" "$1"
+	--verbose "$@" grep cd grep printf
+$(pwd) printf grep local sed
+/usr/bin cd $(pwd) cd $(pwd) grep -eu 'quoted text' sed export
+	'quoted text' 'quoted text' --verbose export local ${HOME}
+	$(pwd) printf test 2>/dev/null done --verbose -eu ${HOME}
+	"$1" test readonly "$1" |
+	&& echo then export awk x=1 test printf "$@" readonly
+	printf printf "$1" printf done done awk
+	export --verbose ${HOME} | /usr/bin local done
+x=1 /usr/bin "$1" $(pwd) sed awk | -eu 2>/dev/null
+	printf 2>/dev/null ${HOME} $(pwd) local ${HOME} echo readonly
+sed "$@" local --verbose
+	local cd printf "$@" awk && cd printf
+		${HOME} 'quoted text' cd test
+	"$@" /usr/bin then "$1" && printf --verbose /usr/bin echo
+		-eu /usr/bin ${HOME} local cd done "$1" sed
+		"$1" readonly export cd done
+$(pwd) local "$@" local
+	$(pwd) /usr/bin done awk "$1" done printf
+	readonly | readonly done | printf cd export /usr/bin $(pwd) /usr/bin
+		echo $(pwd) local "$@" printf
+then local && cd x=1 "$@" grep local done
+/usr/bin "$1" -eu /usr/bin sed printf printf 'quoted text'
+	cd cd readonly $(pwd) done 'quoted text' ${HOME} /usr/bin
+		printf && local | 2>/dev/null
+	$(pwd) then "$@" done done 2>/dev/null export
+$(pwd) ${HOME} printf "$@" cd "$1"
+	grep 'quoted text' printf --verbose "$@" sed x=1 ${HOME} grep 'quoted text'
+		${HOME} "$@" then -eu echo 'quoted text'
+	2>/dev/null grep "$1"
+'quoted text' test ${HOME}
+	2>/dev/null cd done local then --verbose 2>/dev/null sed --verbose done
+	printf done export test readonly --verbose
+${HOME} 2>/dev/null printf local
+printf grep x=1 $(pwd) -eu 'quoted text' "$1" export && ${HOME} | printf
+	2>/dev/null awk ${HOME} "$@" done 'quoted text' readonly grep done
+	sed "$@" local $(pwd) test printf | -eu
+		printf 'quoted text' export /usr/bin done x=1 done "$@" ${HOME} local
+		x=1 -eu sed 'quoted text' 'quoted text' export $(pwd) ${HOME} done printf
+		2>/dev/null 2>/dev/null readonly grep
+	readonly done ${HOME} 'quoted text' -eu
+	"$@" "$1" then "$@" sed sed $(pwd)
+	grep echo cd $(pwd) sed --verbose
+	&& | x=1 'quoted text' export -eu "$1" "$@" awk test $(pwd)
+/usr/bin /usr/bin sed awk "$@" cd readonly export $(pwd) then 2>/dev/null
+"$@" awk "$@" --verbose /usr/bin awk awk --verbose
+-eu echo grep sed cd ${HOME} | echo echo
+	${HOME} then grep && ${HOME} | grep export sed -eu printf echo echo
+local done --verbose 'quoted text' ${HOME} test
+then 'quoted text' then then export
+		&& 'quoted text' && test $(pwd) grep ${HOME} printf grep grep --verbose printf
+		then readonly local && export /usr/bin done test awk printf ${HOME}
+'quoted text' printf
+		then | test printf local grep "$1" 2>/dev/null
+done printf 'quoted text' -eu | echo "$@" --verbose sed
+sed 2>/dev/null then | /usr/bin "$@" --verbose
+	"$1" local 2>/dev/null 'quoted text' -eu printf done "$@"
+		readonly test 'quoted text' sed $(pwd) grep /usr/bin "$1" $(pwd) | cd
+		then test awk then test x=1
+	echo /usr/bin awk export then "$@" -eu -eu | 'quoted text' x=1 sed awk $(pwd) 2>/dev/null
+		local ${HOME} 2>/dev/null local local readonly | 2>/dev/null
+	x=1 /usr/bin 2>/dev/null --verbose local test && $(pwd) ${HOME} ${HOME}
+		grep && printf x=1 done readonly
+echo "$1" -eu sed cd --verbose
+done $(pwd) sed awk x=1 "$@"
+echo 2>/dev/null x=1 x=1
+	test awk x=1 export 'quoted text' /usr/bin /usr/bin done local grep echo $(pwd)
+	printf echo && export test 'quoted text' && grep readonly ${HOME}
+${HOME} "$@" 2>/dev/null | $(pwd) cd grep $(pwd) $(pwd)
+		| /usr/bin && local /usr/bin readonly printf readonly -eu
+local awk 2>/dev/null ${HOME} x=1 then --verbose
+done local local | cd --verbose done printf sed cd 'quoted text' awk /usr/bin |
+		x=1 -eu cd /usr/bin -eu sed done export
+	/usr/bin printf sed 2>/dev/null sed readonly sed
+"$1" /usr/bin then echo local "$1"
+-eu test grep echo test | "$1" echo
+		'quoted text' readonly "$@" $(pwd) x=1 cd cd readonly
+	export awk --verbose awk 2>/dev/null --verbose echo cd
+	test "$@" sed /usr/bin /usr/bin
+	readonly "$@" "$@" && then x=1 test 2>/dev/null
+		-eu local printf cd echo readonly 2>/dev/null --verbose local done && readonly
+${HOME} "$1" | printf 'quoted text' then echo grep test test
+'quoted text' | sed then | /usr/bin echo readonly cd echo 2>/dev/null export
+	$(pwd) "$@" $(pwd) /usr/bin
+	"$@" sed echo 2>/dev/null grep "$1" ${HOME} 'quoted text' cd
+&& echo /usr/bin done --verbose
+	echo echo && test 'quoted text' 2>/dev/null --verbose cd -eu export export 2>/dev/null
+		| echo && export cd /usr/bin "$@"
+/usr/bin sed sed | grep grep export "$1" "$@" "$1" test sed printf
+		readonly readonly && $(pwd) done grep 2>/dev/null
+		readonly then "$@" test local then readonly awk cd | ${HOME} readonly ${HOME}
+echo printf local ${HOME} printf cd echo cd local printf test 2>/dev/null
+-eu printf "$@" then "$1" readonly
+x=1 --verbose $(pwd) 'quoted text' 'quoted text' awk /usr/bin --verbose sed then
+	done printf | --verbose test $(pwd)
+	--verbose -eu | ${HOME} grep cd grep "$1" printf
+export cd printf && local 2>/dev/null awk export
+-eu -eu printf && local -eu "$@" $(pwd)
+	2>/dev/null --verbose local
+	&& -eu -eu ${HOME} done && ${HOME} ${HOME} x=1 cd "$1" export
+--verbose 2>/dev/null awk export ${HOME} 2>/dev/null
+	test 'quoted text' then local sed ${HOME} 'quoted text' ${HOME}
+&& && 'quoted text' "$1" --verbose
+		"$1" -eu | export then awk sed readonly test
+$(pwd) --verbose --verbose readonly grep readonly sed local "$1" sed 'quoted text'
+export 2>/dev/null ${HOME} -eu
+		$(pwd) x=1 test sed export grep
+done x=1 cd "$@" "$1" && awk sed 2>/dev/null "$1" readonly --verbose -eu
+		echo && 'quoted text' 'quoted text' echo
+		readonly ${HOME} echo then --verbose export --verbose $(pwd) done
+--verbose $(pwd) && cd /usr/bin && ${HOME}
+		${HOME} --verbose local local
+	${HOME} ${HOME} export -eu done done
+done /usr/bin && export $(pwd) 'quoted text' 2>/dev/null echo | $(pwd) printf
+		echo 2>/dev/null sed /usr/bin sed 2>/dev/null --verbose then readonly
+	echo --verbose export then readonly $(pwd) --verbose
+		then grep --verbose test 'quoted text' test
+	test export "$1" $(pwd)
+'quoted text' readonly grep -eu | $(pwd) ${HOME} x=1 readonly
+-eu "$1" local then /usr/bin && then "$@" "$@" then grep $(pwd) local
+2>/dev/null grep test cd cd export local cd echo -eu then awk -eu
+	2>/dev/null ${HOME} | 2>/dev/null then then printf
+		readonly --verbose 'quoted text'
+	2>/dev/null "$@" local grep ${HOME} --verbose
+		grep ${HOME} sed printf -eu | grep then 'quoted text'
+	then grep "$@" 'quoted text' awk ${HOME} local && | --verbose && local /usr/bin
+		"$@" $(pwd) awk local --verbose ${HOME} then cd "$1" x=1 'quoted text'
+	&& && done grep $(pwd) cd echo printf readonly done awk && ${HOME}
+		| local "$1" readonly echo --verbose readonly 'quoted text' printf
+local export /usr/bin "$1" readonly readonly --verbose echo -eu --verbose
+		then export x=1 grep
+		$(pwd) $(pwd) done local ${HOME} test echo test grep grep --verbose printf
+	echo 2>/dev/null sed $(pwd) sed then done --verbose
+| /usr/bin -eu x=1 grep export export x=1 $(pwd) export && /usr/bin
+		"$1" then x=1 done --verbose printf
+sed && -eu && 'quoted text' -eu then echo ${HOME} --verbose -eu -eu
+	awk $(pwd) && export /usr/bin
+	local x=1 test 2>/dev/null --verbose
+grep && then printf && export awk printf readonly --verbose readonly $(pwd)
+	awk printf readonly | export local local echo
+		awk x=1 x=1 done printf x=1 export sed export
+		-eu echo | echo export sed
+		sed && export x=1 echo echo x=1 then $(pwd) export export printf | /usr/bin echo
+	"$@" awk done awk | grep 'quoted text' 'quoted text' | grep
+sed then -eu 2>/dev/null -eu test awk $(pwd) readonly printf 2>/dev/null $(pwd)
+	x=1 'quoted text' then $(pwd) cd --verbose
+	'quoted text' sed "$@" done awk "$1" readonly --verbose --verbose
+${HOME} cd --verbose sed local | 'quoted text' echo | -eu && |
+	local | export grep readonly ${HOME}
+		cd | cd then sed "$1" 'quoted text' test printf sed 'quoted text'
+		cd then /usr/bin ${HOME} "$@"
+readonly then --verbose done 2>/dev/null grep 2>/dev/null | && x=1 echo printf
+	2>/dev/null sed -eu 2>/dev/null test "$1" cd "$1"
+	readonly 'quoted text' done
+		2>/dev/null then "$1" grep test test echo /usr/bin then
+	printf then export "$@" -eu cd -eu echo -eu 2>/dev/null "$@" "$1"
+	${HOME} $(pwd) ${HOME} /usr/bin ${HOME} 2>/dev/null
+&& readonly export /usr/bin
+		x=1 printf local && -eu then echo export x=1 2>/dev/null --verbose
+grep local "$@" /usr/bin readonly then readonly "$1" 'quoted text' /usr/bin
+		'quoted text' readonly test -eu -eu | -eu cd
+		/usr/bin test test "$1" && $(pwd) "$@" "$1" then export | then sed cd local x=1
+export grep 2>/dev/null test $(pwd) readonly -eu echo local done
+	$(pwd) $(pwd) -eu "$1" awk /usr/bin export 'quoted text' && /usr/bin
+&& "$1" 2>/dev/null ${HOME} export
+	awk "$@" x=1 awk ${HOME} sed grep
+	local printf | "$@" local "$1" 2>/dev/null
+	readonly /usr/bin 2>/dev/null then awk 'quoted text' printf printf
+	| && 2>/dev/null && --verbose && readonly done
+		--verbose ${HOME} test $(pwd) then x=1 /usr/bin 2>/dev/null
+	'quoted text' grep $(pwd) test /usr/bin -eu 2>/dev/null
+		readonly cd printf "$@" /usr/bin echo
+	&& --verbose local grep local "$1"
+	test "$@" x=1 readonly 2>/dev/null sed --verbose "$@" echo "$@"
+	cd then grep && then "$1" ${HOME} ${HOME} done cd $(pwd)
+--verbose echo awk ${HOME} x=1
+	'quoted text' x=1 awk "$@" export
+		x=1 "$1" awk cd && "$@" local ${HOME} | then 2>/dev/null
+	awk cd && export then 2>/dev/null sed --verbose grep cd cd cd "$@" test cd $(pwd)
+| cd readonly "$@" printf test "$1" && printf -eu
+	grep && local 2>/dev/null | && $(pwd)
+		printf readonly local
+	"$@" 'quoted text' 2>/dev/null cd cd readonly /usr/bin
+		awk export $(pwd) 2>/dev/null awk "$@" local | -eu awk readonly | "$1" "$@" readonly
+	2>/dev/null readonly --verbose echo && | echo 2>/dev/null
+	'quoted text' grep "$1" | 2>/dev/null x=1 | sed then 'quoted text' awk
+		sed /usr/bin /usr/bin --verbose
+		$(pwd) done -eu done /usr/bin "$1"
+	'quoted text' local then
+		export local export echo cd done -eu && --verbose
+awk done then done then "$1" sed export sed readonly 'quoted text' grep local
+		readonly grep awk done test 2>/dev/null export test test awk 2>/dev/null
+test grep -eu /usr/bin 'quoted text' cd "$@" "$@"
+	awk test done ${HOME} | $(pwd) test
+		${HOME} printf $(pwd) echo
+-eu done x=1 cd echo test ${HOME} local -eu printf
+		export cd x=1 ${HOME} readonly /usr/bin sed 2>/dev/null 'quoted text'
+		$(pwd) sed && export | x=1 | echo
+--verbose ${HOME} x=1
+	${HOME} local grep "$1" done test x=1 grep $(pwd) then
+	-eu then cd --verbose x=1 -eu sed "$@" sed
+echo test && --verbose | readonly 'quoted text' local echo grep 2>/dev/null
+		test cd test then sed x=1 local awk x=1 'quoted text' done x=1 done echo
+	local awk -eu 2>/dev/null
+		--verbose "$1" export 'quoted text' done /usr/bin local
+then | test echo x=1 awk ${HOME} then grep 2>/dev/null
+		"$@" "$@" grep test done test
+		x=1 cd x=1 2>/dev/null /usr/bin printf cd test cd ${HOME} awk
+readonly printf -eu local x=1 | ${HOME}
+	test /usr/bin cd echo awk --verbose sed done readonly grep export export
+	--verbose sed /usr/bin $(pwd) sed "$@" test local export
+	sed sed then "$@" -eu readonly "$@" -eu 'quoted text'
+done printf "$1" 2>/dev/null /usr/bin printf grep | echo 'quoted text'
+"$1" 2>/dev/null printf grep local test then $(pwd) "$@" echo test ${HOME}
+	"$@" printf done | x=1 | done awk -eu cd "$1"
+	readonly grep grep export grep grep printf export cd |
+readonly printf test ${HOME}
+	export printf local x=1 "$1" test cd x=1 sed --verbose done "$@"
+		--verbose local local export x=1 cd x=1 done "$1"
+	"$@" 2>/dev/null awk | -eu | $(pwd) echo ${HOME}
+		done awk printf "$@" /usr/bin printf printf "$@" readonly test 2>/dev/null
+	"$1" then | "$1" 2>/dev/null ${HOME} | x=1 printf | printf export &&
+'quoted text' awk local && readonly grep local export "$1" cd export
+	sed "$@" "$@" grep "$1" /usr/bin
+| done $(pwd) ${HOME} awk
+	2>/dev/null awk $(pwd) test grep x=1 cd x=1 grep printf printf test "$@" then readonly
+"$1" sed readonly test grep &&
+printf --verbose x=1 'quoted text'
+		| local && | "$@" export
+'quoted text' /usr/bin awk then then readonly
+	--verbose -eu local /usr/bin --verbose echo grep -eu | cd /usr/bin
+awk test && 'quoted text' 'quoted text' "$1" 'quoted text'
+	test "$1" --verbose "$@" 2>/dev/null grep
+		&& cd readonly x=1 | export 'quoted text' "$@"
+		--verbose | local done /usr/bin grep awk "$@"
+	--verbose awk cd "$1" awk then cd awk | readonly /usr/bin export
+done -eu echo x=1 --verbose readonly printf "$@" cd done | 2>/dev/null
+| x=1 'quoted text' -eu echo ${HOME}
+		"$@" | sed cd echo x=1 echo readonly ${HOME} | readonly 2>/dev/null
+		-eu 'quoted text' -eu /usr/bin then "$1"
+readonly "$@" grep test -eu "$1" grep test echo 2>/dev/null ${HOME} awk /usr/bin
+	&& -eu $(pwd) echo && awk x=1 ${HOME} 2>/dev/null $(pwd) then grep
+echo 'quoted text' && echo $(pwd)
+--verbose ${HOME} 'quoted text'
+		$(pwd) "$@" sed then local printf x=1 echo
+		done -eu "$@" | 2>/dev/null "$@" --verbose /usr/bin "$@" echo /usr/bin
+	&& export then x=1 --verbose done && "$@" printf
+	${HOME} /usr/bin "$1" ${HOME} 2>/dev/null
+		x=1 "$1" grep then then cd
+		readonly "$1" x=1 --verbose
+		done export && cd && -eu 'quoted text' "$1" && x=1 grep local | "$1" --verbose
+	"$1" 2>/dev/null test --verbose /usr/bin
+"$@" $(pwd) "$1" done then "$@" cd local
+grep done local readonly && /usr/bin x=1 done -eu 'quoted text'
+2>/dev/null --verbose $(pwd) then "$@" && printf readonly
+grep sed 'quoted text' /usr/bin cd awk /usr/bin
+	/usr/bin x=1 test readonly | readonly | readonly | echo echo
+test then cd then -eu "$1" cd 2>/dev/null done $(pwd) then
+	&& "$@" $(pwd) cd -eu && 'quoted text' $(pwd) ${HOME} export "$1" then
+	local done --verbose local sed x=1 printf /usr/bin "$@"
+"$1" done printf -eu export ${HOME} test x=1 && -eu "$@" &&
+	| grep 'quoted text' | cd local 'quoted text' awk grep
+		export readonly sed --verbose
+sed grep grep done awk export "$1" done /usr/bin
+grep -eu | -eu export echo $(pwd) done
+	&& ${HOME} --verbose /usr/bin printf && grep readonly && cd /usr/bin local
+		awk echo 'quoted text' test readonly export
+		x=1 ${HOME} "$@" readonly x=1 "$@" 2>/dev/null $(pwd) -eu $(pwd) echo
+	cd | $(pwd) sed ${HOME} cd export export printf sed x=1 -eu sed local
+	"$@" x=1 then cd readonly "$@" x=1 "$@" export "$@" "$1"
+	x=1 sed sed cd then --verbose x=1 "$1" 'quoted text'
+	readonly then printf grep local 2>/dev/null
+	printf awk --verbose 2>/dev/null awk done grep
+	"$@" done ${HOME} echo && echo done printf local -eu -eu --verbose awk
+		export ${HOME} printf | export 'quoted text' local && /usr/bin
+		printf | sed 2>/dev/null -eu x=1 ${HOME} $(pwd) awk --verbose sed grep then
+sed --verbose test local then printf
+		"$1" 'quoted text' readonly
+	2>/dev/null | && awk | | | x=1 $(pwd)
+	$(pwd) "$1" x=1 printf x=1 readonly
+	"$@" echo -eu /usr/bin "$1" test local sed sed export x=1
+		$(pwd) /usr/bin printf "$1" then -eu
+	| cd "$1" cd echo "$@" sed --verbose echo export "$@" local x=1 grep
+		"$1" | sed readonly -eu sed --verbose | 'quoted text' 'quoted text' | "$@"
+echo $(pwd) "$1" -eu test x=1 readonly cd -eu ${HOME} echo
+	readonly -eu ${HOME} ${HOME} ${HOME} grep grep x=1 "$1" |
+		$(pwd) 'quoted text' readonly /usr/bin
+	| 2>/dev/null "$@" x=1 awk | export cd -eu done echo then readonly
+	printf $(pwd) /usr/bin && cd test
+"$@" -eu ${HOME} -eu /usr/bin grep readonly local /usr/bin 2>/dev/null
+		'quoted text' done 2>/dev/null grep printf && grep "$1"
+	export x=1 readonly && then echo /usr/bin readonly cd 'quoted text' grep sed 2>/dev/null
+export then readonly test "$@"
+cd sed done test echo export
+		readonly 'quoted text' "$@" sed | printf 2>/dev/null test x=1 $(pwd) --verbose
+grep echo --verbose printf awk && awk ${HOME} | done sed then done "$@" | "$@"
+$(pwd) "$1" "$1" -eu then && sed && "$1"
+	$(pwd) sed "$@" 'quoted text' $(pwd) 'quoted text'
+	done 'quoted text' printf local ${HOME} printf
+printf "$1" 'quoted text'
+		-eu printf -eu then -eu "$@" sed 'quoted text' -eu
+sed echo printf "$1" then 'quoted text'
+	'quoted text' "$1" /usr/bin 'quoted text' grep ${HOME}
+	&& -eu x=1 /usr/bin ${HOME} echo /usr/bin cd 2>/dev/null echo x=1 $(pwd)
+		| readonly awk cd awk then sed /usr/bin local test
+	sed echo && sed grep 'quoted text'
+&& echo echo 'quoted text' /usr/bin && grep then /usr/bin "$1" "$1"
+sed && ${HOME} readonly x=1 "$@" grep 'quoted text' done "$1" readonly done
+	readonly readonly then "$1" | -eu export grep 'quoted text'
+		done local "$@" grep 'quoted text' then | done
+awk $(pwd) echo --verbose sed /usr/bin cd grep
+		$(pwd) printf "$@" then then awk "$@" | "$@" readonly /usr/bin 2>/dev/null ${HOME}
+sed --verbose $(pwd) echo
+	printf cd echo export readonly $(pwd) readonly
+	${HOME} echo -eu then awk -eu 2>/dev/null sed awk x=1 then
+awk && sed done printf ${HOME} ${HOME} awk awk
+		then export ${HOME} --verbose done test readonly 2>/dev/null printf
+		local grep /usr/bin ${HOME} ${HOME} grep 2>/dev/null
+		awk sed | cd 2>/dev/null -eu $(pwd) --verbose x=1 "$1"
+		then then 'quoted text'
+/usr/bin $(pwd) cd "$1" sed x=1 "$1" grep 2>/dev/null
+grep -eu local sed && "$1" test
+2>/dev/null test "$@" cd && printf readonly readonly | test "$@" 'quoted text'
+		x=1 sed 2>/dev/null export && ${HOME} then awk cd "$@" done
+	&& $(pwd) 2>/dev/null -eu printf printf sed ${HOME} test grep --verbose
+	local 2>/dev/null test "$1" grep sed
+	'quoted text' local "$1" grep
+'quoted text' x=1 "$1" --verbose --verbose -eu x=1 printf awk 2>/dev/null
+$(pwd) | && "$@" cd "$@" then printf $(pwd) printf
+	2>/dev/null cd printf test test export "$1" -eu awk
+sed echo && awk echo readonly
+then echo then printf local 'quoted text' /usr/bin 'quoted text'
+	"$@" "$@" export readonly --verbose printf
+local printf /usr/bin "$@" test ${HOME} readonly
+		then 2>/dev/null awk done x=1 local
+	printf && 2>/dev/null && sed awk /usr/bin then ${HOME}
+		&& -eu export test grep x=1 local "$@"
+then $(pwd) grep 'quoted text' /usr/bin grep && /usr/bin awk -eu
+		then sed 'quoted text'
+-eu then --verbose --verbose grep done echo readonly
+	--verbose "$@" local grep && /usr/bin readonly printf sed
+	printf echo --verbose -eu 'quoted text' test local echo test
+"$@" -eu 'quoted text' ${HOME}
+		&& && | && --verbose /usr/bin export && "$@" printf export
+	"$1" local && "$1" "$@" done printf ${HOME} echo "$@"
+		${HOME} "$1" local -eu "$1" 'quoted text' local echo echo
+		local && "$@" | 'quoted text' echo test awk | 'quoted text' | local local |
+"$1" $(pwd) --verbose printf
+		2>/dev/null then test ${HOME} x=1 awk local /usr/bin echo
+		sed echo export 2>/dev/null 'quoted text' 'quoted text' "$@" sed
+then test then | awk -eu | done done awk ${HOME} /usr/bin
+	--verbose grep then sed | --verbose ${HOME} cd x=1 "$1" "$@" "$1" export
+awk $(pwd) "$1" echo local local && x=1 2>/dev/null
+then 'quoted text' test -eu then sed -eu then cd 'quoted text' test grep then
+		printf done --verbose && $(pwd) "$@" export done
+&& 'quoted text' 'quoted text' grep 'quoted text'
+'quoted text' ${HOME} then readonly echo then
+grep 2>/dev/null awk readonly printf then 2>/dev/null
+	then ${HOME} /usr/bin printf | sed awk 'quoted text' | "$1" /usr/bin "$1"
+	2>/dev/null sed && 2>/dev/null
+"$1" readonly printf | done echo export 2>/dev/null ${HOME}
+	readonly export ${HOME}
+	-eu x=1 test -eu awk readonly grep echo echo ${HOME} cd "$@" -eu | echo
+	2>/dev/null 2>/dev/null x=1 awk | ${HOME} printf x=1 readonly
+	then 'quoted text' grep | cd then local x=1 sed $(pwd) && cd /usr/bin
+		then sed local readonly grep /usr/bin
+	| --verbose -eu ${HOME} $(pwd) local local printf
+	&& | x=1 "$1" --verbose local "$1" echo echo
+		'quoted text' sed 2>/dev/null
+sed -eu $(pwd) "$@" sed
+		-eu export --verbose readonly done local export $(pwd) local
+	export | "$1" "$1" && then
+	awk ${HOME} printf readonly awk grep sed ${HOME} echo
+		"$@" x=1 x=1 2>/dev/null ${HOME} 'quoted text' cd | local x=1 "$1" -eu
+printf export test grep sed 2>/dev/null "$1" "$@" 'quoted text'
+x=1 cd "$@" echo x=1 export -eu export ${HOME} ${HOME} test export
+		/usr/bin /usr/bin test | "$1" export done
+	echo sed awk x=1 ${HOME} /usr/bin ${HOME} echo done local cd printf
+		/usr/bin awk printf $(pwd) test printf | 'quoted text'
+--verbose "$1" then "$1" "$1" test local x=1 printf awk printf
+	"$@" sed echo /usr/bin echo
+		done sed done readonly sed 2>/dev/null $(pwd) then -eu test -eu cd
+x=1 && export ${HOME} cd grep cd grep sed then -eu 2>/dev/null grep readonly sed
+2>/dev/null /usr/bin test -eu
+${HOME} printf | export /usr/bin "$@" -eu
+		"$1" | awk | printf done cd done readonly then && /usr/bin local
+		&& printf cd "$1" echo sed "$@" | export
+	-eu 2>/dev/null -eu "$@" /usr/bin $(pwd)
+		-eu x=1 $(pwd) done 2>/dev/null "$@" done local export x=1 x=1
+		"$1" $(pwd) 2>/dev/null && grep 2>/dev/null done export done printf 2>/dev/null
+		export 'quoted text' grep $(pwd) x=1 2>/dev/null sed cd | $(pwd) done grep echo
+	local echo sed x=1 'quoted text'
+	test ${HOME} then && test cd readonly /usr/bin echo -eu
+		"$1" export "$@" | export then then "$1"
+		${HOME} $(pwd) awk -eu export $(pwd) test
+	$(pwd) "$@" "$@" /usr/bin readonly /usr/bin sed -eu test export awk
+		$(pwd) printf ${HOME} "$1" readonly then done x=1
+	sed then export cd 'quoted text' done "$@" grep done && /usr/bin
+	'quoted text' && $(pwd) sed /usr/bin /usr/bin
+/usr/bin "$1" $(pwd) /usr/bin "$1" echo 2>/dev/null "$@"
+printf $(pwd) test test test && -eu --verbose then $(pwd) then then sed test
+	${HOME} export $(pwd) /usr/bin 'quoted text' echo && grep
+		'quoted text' readonly 2>/dev/null ${HOME} cd
+	-eu -eu x=1 grep ${HOME} local echo x=1
+/usr/bin x=1 then $(pwd) 2>/dev/null
+	export && ${HOME} && test test -eu --verbose
+	| done readonly "$@" awk local $(pwd) ${HOME}
+	| echo readonly awk | && "$@" "$1" done -eu | -eu "$1" ${HOME}
+	awk -eu readonly export -eu test printf
+/usr/bin x=1 && x=1 awk --verbose then
+sed echo /usr/bin done ${HOME} readonly && ${HOME} readonly
+	"$@" then "$1" -eu echo local readonly
+	test "$@" done then "$@" "$@" test
+	done $(pwd) printf /usr/bin ${HOME} x=1 --verbose /usr/bin "$@" cd export grep cd
+done test test readonly $(pwd) --verbose && x=1 then $(pwd) export
+		export echo 'quoted text' echo /usr/bin $(pwd) cd | sed 'quoted text'
+	x=1 test awk "$1" done /usr/bin
+	'quoted text' echo "$@" 2>/dev/null 2>/dev/null local 'quoted text'
+	$(pwd) ${HOME} local && 2>/dev/null
+	${HOME} echo /usr/bin -eu && $(pwd) readonly grep "$1" printf /usr/bin "$1" $(pwd)
+	'quoted text' | then ${HOME} --verbose 'quoted text' printf awk sed
+	${HOME} readonly printf /usr/bin
+	readonly test export 2>/dev/null test local 2>/dev/null | readonly
+		printf test && | printf $(pwd) $(pwd) --verbose
+${HOME} 2>/dev/null "$1" --verbose printf -eu | ${HOME} local
+$(pwd) ${HOME} grep then test 'quoted text' awk awk $(pwd)
+	export $(pwd) cd printf export x=1 awk
+		export done /usr/bin readonly test sed ${HOME}
+		x=1 /usr/bin "$1" done grep /usr/bin 'quoted text'
+/usr/bin --verbose sed $(pwd) cd then echo sed x=1 export awk done local
+&& $(pwd) ${HOME} -eu printf awk /usr/bin x=1 2>/dev/null
+$(pwd) test | 2>/dev/null &&
+		&& ${HOME} local x=1 | grep 2>/dev/null then "$@"
+		grep && cd 2>/dev/null readonly sed grep "$1" export | --verbose
+	export local sed && readonly /usr/bin
+'quoted text' --verbose ${HOME} 2>/dev/null echo "$1" "$1" "$@" echo "$@"
+&& done then "$1" "$1" ${HOME} test local awk done "$1"
+		'quoted text' 2>/dev/null ${HOME} awk grep printf grep local /usr/bin /usr/bin
+		2>/dev/null then awk -eu x=1 x=1 readonly export && then
+sed && grep printf 2>/dev/null then && sed local done --verbose then -eu
+		echo export grep 2>/dev/null then "$1" 2>/dev/null
+		${HOME} echo $(pwd) awk test | "$@" readonly
+	export grep test cd 'quoted text' 'quoted text' done -eu "$1" -eu
+--verbose --verbose local done "$1" readonly 'quoted text' echo local test
+'quoted text' printf "$@" | local sed ${HOME} && -eu "$@" test ${HOME}
+-eu test printf && test awk test $(pwd) readonly 2>/dev/null
+	printf --verbose -eu readonly echo local
+		/usr/bin "$1" readonly cd test test
+		printf done echo echo readonly then 'quoted text' --verbose
+${HOME} 'quoted text' $(pwd) test | --verbose
+		then "$1" printf "$1" "$1" readonly 2>/dev/null echo x=1 | then
+		readonly sed grep printf readonly /usr/bin "$@" ${HOME} grep x=1 done | export
+		sed "$1" 'quoted text' awk /usr/bin echo 2>/dev/null
+		x=1 -eu && -eu x=1 grep sed && readonly 'quoted text'
+	/usr/bin /usr/bin test echo
+	2>/dev/null done ${HOME} "$1" |
+		'quoted text' awk then readonly
+	--verbose done && $(pwd) readonly readonly done export /usr/bin done "$1"
+		awk then then "$1" | readonly 'quoted text' readonly
+		awk /usr/bin 'quoted text' --verbose cd test ${HOME}
+		then $(pwd) --verbose 2>/dev/null 'quoted text'
+		&& "$1" /usr/bin --verbose test -eu /usr/bin && && ${HOME} --verbose
+local cd $(pwd) /usr/bin
+&& export | 'quoted text'
+"$@" cd x=1 then --verbose
+x=1 done done printf printf /usr/bin export readonly $(pwd)
+	readonly $(pwd) "$@" test --verbose
+	-eu then "$@" printf then awk --verbose then cd printf
+		"$1" $(pwd) $(pwd) --verbose ${HOME} test -eu /usr/bin grep sed printf "$1"
+	x=1 awk cd /usr/bin cd grep done /usr/bin
+		"$1" && 'quoted text' awk x=1 export local ${HOME} 2>/dev/null
+	--verbose grep then awk -eu x=1 -eu "$@" && | | then 2>/dev/null
+	"$1" "$@" test cd done readonly done cd
+	/usr/bin readonly | local cd 'quoted text' 2>/dev/null
+then grep printf export 2>/dev/null "$1"
+x=1 grep local echo ${HOME} | /usr/bin awk
+printf local | ${HOME} done 'quoted text' &&
+	export sed readonly awk &&
+		export x=1 --verbose readonly readonly echo 'quoted text'
+then done printf cd | done --verbose $(pwd) printf 2>/dev/null done
+	--verbose sed echo | export grep
+		&& "$@" "$@" 2>/dev/null test && ${HOME} | sed test -eu cd sed
+		echo 2>/dev/null 'quoted text' printf awk x=1 && readonly
+	x=1 'quoted text' sed 'quoted text' test 'quoted text' /usr/bin cd $(pwd) grep
+"$1" x=1 test printf test --verbose cd | echo done
+	local readonly cd $(pwd) export ${HOME}
+local 'quoted text' grep 2>/dev/null
+		"$1" && "$@" "$1" "$@" && --verbose export "$1"
+		-eu local "$@" echo done "$1" then "$1" && | awk "$@" 2>/dev/null && then
+printf /usr/bin grep done test 'quoted text' grep --verbose && grep x=1 'quoted text'
+	sed 'quoted text' ${HOME} | --verbose "$1"
+done awk then 2>/dev/null local cd /usr/bin
+sed cd readonly && "$@" then then $(pwd) && | &&
+		export then export 2>/dev/null -eu | ${HOME} sed "$@" --verbose
+	then done | local printf export cd local | 'quoted text' x=1 done && echo
+$(pwd) /usr/bin grep readonly sed "$1" done | "$1" && 'quoted text'
+	-eu done readonly "$@" awk | test test
+		x=1 && echo printf --verbose ${HOME} printf done export grep
+		cd | && ${HOME} local "$@" | 2>/dev/null export --verbose -eu
+awk cd x=1 cd export 'quoted text'
+		test --verbose done "$1" "$1" cd sed then sed local && then export
+	"$@" test "$1" local "$1" test grep export printf --verbose awk &&
+grep | /usr/bin "$1" 'quoted text' awk /usr/bin cd "$@"
+sed && /usr/bin 2>/dev/null
+	cd "$1" && && sed sed ${HOME} "$@"
+	'quoted text' local x=1 sed then -eu | local x=1 then sed ${HOME} "$@" test /usr/bin
+	2>/dev/null "$1" export 2>/dev/null
+		&& ${HOME} echo x=1 local -eu done done /usr/bin
+	sed ${HOME} ${HOME} "$@"
+| awk "$@" /usr/bin local
+-eu local done echo ${HOME} && sed && && "$1" ${HOME} readonly 2>/dev/null --verbose
+	2>/dev/null /usr/bin test 'quoted text' echo "$1"
+	sed echo printf test
+		printf /usr/bin grep && -eu 2>/dev/null
+	cd x=1 /usr/bin printf | && cd printf printf readonly
+	echo "$@" awk --verbose sed done x=1 grep ${HOME} cd awk x=1
+	"$1" done done 2>/dev/null export printf local local awk sed
+		'quoted text' local printf awk awk --verbose done then test
+2>/dev/null sed ${HOME} test test 'quoted text' sed && printf "$1"
+	local test /usr/bin "$1" -eu x=1 export ${HOME} done x=1 -eu 2>/dev/null
+	--verbose cd x=1 test x=1 export -eu then x=1 |
+	x=1 readonly 2>/dev/null awk sed | 'quoted text'
+	'quoted text' echo 'quoted text'
+	export printf --verbose $(pwd) x=1
+printf test export then done awk local ${HOME} test
+		done --verbose export awk "$1" 'quoted text' "$@"
+printf grep /usr/bin awk ${HOME} echo test | cd readonly sed then readonly 'quoted text'
+		&& echo -eu local x=1 "$1" printf then "$@" | x=1 echo awk done 'quoted text'
+done grep "$@" sed "$1"
+		grep --verbose | echo readonly 2>/dev/null done |
+	done cd | cd done /usr/bin awk export then awk ${HOME} readonly printf -eu test
+$(pwd) printf export test | ${HOME}
+		awk cd "$@" && 'quoted text'
+	grep "$@" then -eu "$1" "$@" printf echo | "$1" echo "$1"
+	"$@" echo readonly -eu -eu grep printf -eu readonly printf awk
+	cd grep 2>/dev/null 2>/dev/null cd -eu 2>/dev/null
+2>/dev/null 2>/dev/null 2>/dev/null printf readonly
+		grep -eu echo done && local cd echo --verbose
+		--verbose $(pwd) then 'quoted text' cd readonly
+	/usr/bin echo then test readonly cd grep
+&& | -eu echo /usr/bin -eu
+test echo test | echo test "$@" export grep
+sed grep ${HOME} echo cd done done test grep ${HOME} -eu awk then then local |
+export then awk x=1 && --verbose x=1 export echo ${HOME} "$@" awk
+		$(pwd) 'quoted text' && -eu grep --verbose /usr/bin printf "$@" cd
+test awk x=1 test grep && sed /usr/bin
+readonly && x=1 ${HOME} ${HOME} "$1" awk sed
+"$@" local --verbose test then && 2>/dev/null then local "$@" local 2>/dev/null
+awk readonly grep ${HOME} export
+		printf -eu ${HOME} "$@" awk printf $(pwd) done then
+	then sed readonly grep $(pwd) ${HOME}
+		awk grep 'quoted text'
+		--verbose cd then /usr/bin grep | x=1 --verbose grep printf ${HOME}
+	2>/dev/null 'quoted text' && /usr/bin -eu cd export then | export
+	sed 'quoted text' readonly then ${HOME} x=1 -eu local
+	cd "$1" /usr/bin ${HOME}
+cd test then "$1" | x=1 test sed | echo && grep printf readonly
+	-eu awk then $(pwd) local test $(pwd) /usr/bin "$1" ${HOME} -eu 2>/dev/null
+		awk export "$@" export ${HOME} --verbose
+	awk test echo sed -eu | $(pwd) x=1 | --verbose printf readonly
+-eu done export && 'quoted text'
+/usr/bin readonly cd 'quoted text' awk readonly done cd $(pwd) --verbose
+sed -eu echo -eu $(pwd) done test sed echo 2>/dev/null then --verbose
+	-eu x=1 cd /usr/bin then test ${HOME} readonly
+| && then ${HOME} --verbose
+		cd printf /usr/bin --verbose grep 2>/dev/null
+	"$@" --verbose /usr/bin cd printf
+		-eu readonly -eu -eu ${HOME}
+	done | printf sed sed x=1 -eu done /usr/bin done
+/usr/bin export done echo /usr/bin -eu 'quoted text' echo
+	-eu $(pwd) grep grep -eu "$@" printf /usr/bin echo
+x=1 /usr/bin sed "$@" | readonly export "$@"
+${HOME} then test "$1"
+sed awk done && 2>/dev/null test 'quoted text'
+	grep --verbose sed sed | $(pwd) test 2>/dev/null
+test then export local "$1"
+		/usr/bin "$@" | ${HOME} -eu
+	test "$1" ${HOME} then && sed grep then "$@" "$1" --verbose done printf printf
+		done then 2>/dev/null grep sed export -eu 2>/dev/null grep | printf done $(pwd)
+		&& "$1" sed then then cd grep grep | echo | 2>/dev/null grep --verbose 2>/dev/null
+cd readonly cd local x=1 sed "$@" export -eu echo
+		test then readonly test then printf 'quoted text' | /usr/bin printf --verbose
+	${HOME} $(pwd) grep "$1" --verbose
+export -eu ${HOME} cd cd readonly export --verbose printf then sed x=1
+	-eu | cd export export "$1" readonly
+	awk 'quoted text' local "$@" export 2>/dev/null echo readonly x=1 "$1" grep
+	&& 2>/dev/null local /usr/bin readonly -eu 'quoted text' ${HOME} export
+2>/dev/null cd export done awk ${HOME} ${HOME} 2>/dev/null
+	printf --verbose echo $(pwd)
+	export --verbose --verbose awk then then
+readonly readonly -eu /usr/bin awk local --verbose 2>/dev/null
+		export grep /usr/bin | $(pwd) | 'quoted text'
+		readonly export | | grep echo export $(pwd)
+		--verbose /usr/bin local export grep
+"$1" done x=1 'quoted text'
+done -eu 2>/dev/null local readonly 2>/dev/null echo export -eu ${HOME}
+echo ${HOME} "$1" readonly grep "$@" x=1 --verbose "$1" "$1" && -eu export | grep
+	2>/dev/null readonly test 2>/dev/null --verbose
+	cd grep | cd --verbose grep echo awk cd grep
+${HOME} done export readonly cd cd $(pwd) | test
+test printf awk x=1 then grep grep test grep 'quoted text'
+local export "$@" "$1" x=1 then
+/usr/bin | 'quoted text' -eu && export cd grep readonly --verbose &&
+		cd 2>/dev/null 'quoted text' 'quoted text' && |
+--verbose "$@" "$@" x=1
+	"$1" printf local && 'quoted text' awk /usr/bin | grep
+	awk 'quoted text' printf
+	"$@" export x=1 grep ${HOME} export sed /usr/bin -eu
+	then "$@" -eu ${HOME} --verbose then cd export
+cd local echo readonly -eu local sed $(pwd) then grep /usr/bin ${HOME} test
+sed test 'quoted text' x=1 -eu cd "$1"
+		sed sed | x=1 $(pwd) | export "$1" | -eu x=1 echo grep echo
+	grep then cd | x=1 grep 2>/dev/null
+		/usr/bin readonly printf export 'quoted text' printf &&
+awk local then 'quoted text'
+		echo "$@" -eu then local ${HOME} 'quoted text' done x=1 'quoted text' -eu x=1 readonly
+	2>/dev/null grep done awk $(pwd) grep echo
+	-eu printf export cd x=1 test
+	done $(pwd) $(pwd) sed
+	"$@" local grep | sed printf export echo then | test done
+grep /usr/bin $(pwd) 'quoted text' local /usr/bin --verbose $(pwd) $(pwd)
+	printf done x=1 && awk test $(pwd) then printf readonly
+	2>/dev/null export done then grep grep grep printf "$@"
+export 2>/dev/null $(pwd) export readonly
+		"$@" && awk test sed ${HOME} "$@" "$1"
+	&& $(pwd) /usr/bin && ${HOME} 'quoted text' sed test | done 2>/dev/null
+export /usr/bin local printf printf /usr/bin then printf grep $(pwd) $(pwd)
+	grep ${HOME} grep export $(pwd) sed readonly done
+| 'quoted text' -eu grep
+-eu "$1" grep "$1" "$@" done printf printf
+	echo grep readonly cd x=1 'quoted text' 'quoted text' $(pwd) -eu && grep | x=1
+readonly && x=1 "$1" | "$1" "$@" -eu cd "$@" x=1 "$1"
+	'quoted text' export | grep "$1" && $(pwd) 'quoted text'
+-eu echo x=1 "$1" test -eu printf 2>/dev/null "$@" local
+	${HOME} -eu test "$1" echo done 2>/dev/null export "$1" awk 'quoted text'
+		--verbose x=1 'quoted text' grep printf "$1" export
+	'quoted text' -eu 'quoted text' grep /usr/bin --verbose
+	grep readonly done grep && ${HOME} 'quoted text' -eu && -eu printf 2>/dev/null
+		export local done /usr/bin $(pwd) $(pwd) grep "$1" | readonly
+2>/dev/null done local $(pwd) | local
+/usr/bin x=1 awk done -eu local --verbose export ${HOME} ${HOME}
+	$(pwd) grep test ${HOME} printf "$@"
+		"$@" cd "$@" ${HOME} $(pwd) done ${HOME} done printf echo -eu sed &&
+	&& sed done local $(pwd) then | "$@" /usr/bin
+	-eu ${HOME} test | -eu x=1 sed awk | cd | then 'quoted text' x=1 && $(pwd)
+		readonly sed printf -eu readonly done export "$1" | ${HOME}
+		grep then | printf sed export sed
+test $(pwd) $(pwd) "$@" sed "$1" 'quoted text' printf export printf
+		local grep export -eu awk readonly sed "$1" $(pwd) 2>/dev/null then export awk sed
+&& export cd "$@" printf export
+	cd local ${HOME} grep then 2>/dev/null /usr/bin echo --verbose export
+	$(pwd) readonly readonly export test
+		'quoted text' x=1 readonly cd done && export grep done $(pwd)
+		/usr/bin "$@" export x=1 awk cd x=1 | 'quoted text' -eu -eu cd | sed 'quoted text'
+x=1 cd && /usr/bin | printf done cd ${HOME}
+${HOME} then $(pwd) printf |
+grep /usr/bin --verbose grep export test --verbose then printf done "$1"
+then grep --verbose -eu grep 2>/dev/null
+/usr/bin 'quoted text' grep && && && x=1 x=1 readonly
+awk /usr/bin 'quoted text' done grep $(pwd)
+2>/dev/null sed cd echo $(pwd)
+		local 'quoted text' grep awk | awk sed ${HOME} cd 2>/dev/null
+		awk awk ${HOME} && printf ${HOME} awk --verbose "$1" 'quoted text'
+		then cd readonly "$1" ${HOME} "$@"
+	test cd 'quoted text' && grep | 2>/dev/null readonly readonly "$@" printf
+done $(pwd) x=1 'quoted text' then cd --verbose grep
+sed | x=1 done then echo ${HOME} sed /usr/bin
+readonly $(pwd) printf --verbose --verbose
+		export x=1 'quoted text' | printf
+sed ${HOME} && echo awk sed ${HOME} readonly
+export readonly sed local
+		sed --verbose sed | x=1 export test printf --verbose && awk cd && done
+		export -eu grep awk local test x=1 cd cd -eu x=1 readonly 2>/dev/null 2>/dev/null
+	--verbose grep test && x=1 readonly -eu ${HOME} 'quoted text'
+	export then test "$@" -eu &&
+	echo --verbose ${HOME} ${HOME} grep 'quoted text' 2>/dev/null
+		local done echo x=1 2>/dev/null done sed -eu then local sed -eu sed sed export
+	"$@" $(pwd) "$@" && sed | test --verbose done "$@" sed && $(pwd) done
+/usr/bin "$@" readonly /usr/bin printf cd 'quoted text' /usr/bin
+	&& | sed echo grep done local test grep --verbose 2>/dev/null ${HOME} 2>/dev/null
+		x=1 | printf then x=1 readonly printf &&
+printf 2>/dev/null test readonly export awk "$@" ${HOME} done "$@"
+		-eu then sed done x=1 && then --verbose
+	cd grep local x=1 x=1 -eu then export
+	export local "$1" sed | x=1 awk -eu test grep 'quoted text'
+awk printf 'quoted text' 'quoted text' && 'quoted text' "$@" cd then local
+		"$1" export test test cd | -eu local $(pwd) echo ${HOME} test done
+cd | "$@" ${HOME} export done /usr/bin && export printf printf
+--verbose /usr/bin $(pwd) ${HOME} local | | awk test export | local "$1" "$@"
+	2>/dev/null test 2>/dev/null cd sed /usr/bin 'quoted text' then $(pwd)
+	&& local sed sed && local
+local && && test readonly
+		${HOME} cd 'quoted text'
+		printf grep | test awk -eu $(pwd) 2>/dev/null
+	test 'quoted text' ${HOME} readonly --verbose grep cd -eu grep then grep /usr/bin
+		"$@" "$1" cd done echo x=1 -eu printf awk $(pwd) "$1" 2>/dev/null done then
+readonly -eu export "$@" 2>/dev/null
+	sed grep --verbose cd printf
+	readonly sed echo && then done ${HOME} 'quoted text'
+readonly awk ${HOME} test cd 2>/dev/null | echo x=1 test
+	then readonly x=1 then echo "$1" ${HOME} ${HOME} 2>/dev/null $(pwd) $(pwd) 'quoted text'
+	$(pwd) readonly cd $(pwd) "$@" done
+		$(pwd) /usr/bin local test $(pwd) ${HOME} /usr/bin awk sed 2>/dev/null "$1" awk
+	done && done done grep "$@" done 2>/dev/null --verbose
+	| readonly && 2>/dev/null | "$1" | "$1" echo export readonly
+	printf x=1 readonly "$1" $(pwd) test x=1 2>/dev/null -eu then printf grep $(pwd)
+		/usr/bin then -eu /usr/bin cd printf
+grep local $(pwd) | then readonly then printf local /usr/bin export grep
+		$(pwd) 'quoted text' "$@" --verbose readonly
+echo awk /usr/bin 'quoted text' printf local -eu
+		| ${HOME} | done 2>/dev/null | readonly
+		local x=1 readonly cd grep
+| grep 2>/dev/null /usr/bin "$1" $(pwd) echo 2>/dev/null readonly x=1 then
+printf awk cd -eu $(pwd)
+		&& --verbose export && && cd --verbose -eu
+	--verbose "$@" --verbose "$1"
+/usr/bin "$@" && -eu /usr/bin printf -eu "$@"
+	readonly $(pwd) sed test echo done
+		&& $(pwd) /usr/bin readonly -eu /usr/bin readonly $(pwd) $(pwd) cd "$1" x=1
+		x=1 $(pwd) "$@" awk printf sed echo "$1"
+		"$@" local readonly local x=1 readonly grep
+		then printf 2>/dev/null
+	grep sed -eu awk awk "$@" awk readonly x=1 x=1 test | sed 'quoted text' then
+	then $(pwd) 2>/dev/null | awk grep "$1" && local awk
+	printf echo 2>/dev/null export awk 'quoted text'
+echo sed awk local done then --verbose awk grep export
+		&& && x=1 && printf ${HOME} then -eu 'quoted text' local then "$1" test -eu
+	x=1 $(pwd) --verbose then | && grep "$1" done -eu | readonly echo
+done $(pwd) awk echo grep -eu /usr/bin "$@" $(pwd)
+test awk awk then sed && local /usr/bin done
+		${HOME} readonly local $(pwd)
+awk -eu awk -eu readonly grep && printf
+		readonly sed $(pwd) 2>/dev/null awk done awk cd 2>/dev/null done 'quoted text'
+	sed 2>/dev/null grep grep 'quoted text'
+	-eu && $(pwd) --verbose && | awk --verbose "$@" readonly
+	done local readonly /usr/bin -eu done | sed readonly -eu
+grep local "$@" cd ${HOME} awk grep && "$1" printf /usr/bin export
+	--verbose printf then export awk
+	2>/dev/null echo readonly awk export ${HOME} && "$1" readonly sed /usr/bin
+$(pwd) 'quoted text' local cd x=1 && cd x=1 test sed awk | sed "$@"
+	echo --verbose cd export sed awk sed "$1" && "$@" cd printf
+		cd printf local x=1 | readonly sed -eu awk 2>/dev/null echo "$1" /usr/bin "$@"
+	local grep /usr/bin 2>/dev/null readonly export readonly readonly readonly
+		awk local local readonly 'quoted text' | export
+		local "$@" "$1" grep && ${HOME} "$1" --verbose "$1" $(pwd) sed
+		awk then export cd then ${HOME} | -eu
+test printf export x=1 -eu readonly
+		"$1" && printf printf local "$@" test grep && sed x=1 x=1 && echo done ${HOME}
+		test test sed -eu | local echo done "$1" export "$1" ${HOME}
+		"$@" local x=1 local && sed done "$@" echo sed "$@" readonly
+/usr/bin /usr/bin sed -eu ${HOME}
+printf "$1" grep done "$1" x=1 && awk export printf export --verbose echo
+		&& then ${HOME} readonly 2>/dev/null then
+	readonly 'quoted text'
+	&& done "$1" echo echo printf -eu readonly | 'quoted text'
+	echo | /usr/bin done test /usr/bin echo ${HOME}
+		"$1" export /usr/bin awk awk grep sed readonly done cd done
+-eu export local | done | --verbose
+		'quoted text' grep export awk && "$@" echo readonly && test ${HOME} "$@"
+	then sed x=1 && 'quoted text' grep "$1" 2>/dev/null
+		export --verbose export sed awk done && "$1" --verbose
+	${HOME} -eu /usr/bin "$@" export then cd x=1 awk then "$@" awk | "$1" grep done
+	echo awk -eu x=1 | -eu grep test x=1 /usr/bin
+		then "$@" -eu awk /usr/bin sed "$1" echo
+		grep sed "$@" readonly cd 'quoted text' "$@" test ${HOME} x=1 echo /usr/bin
+	then ${HOME} ${HOME} local 'quoted text' export /usr/bin x=1
+/usr/bin --verbose /usr/bin then then
+printf test sed cd then cd "$1" /usr/bin echo test -eu "$1" "$1" $(pwd) -eu
+--verbose test then sed -eu -eu then local sed | printf cd $(pwd) x=1 x=1 echo
+	x=1 test grep 2>/dev/null done grep 2>/dev/null
+		done | test printf echo done $(pwd)
+		&& awk printf $(pwd) local 2>/dev/null $(pwd) && grep sed 'quoted text' awk
+"$@" sed local --verbose readonly printf cd cd | grep cd /usr/bin
+	"$@" export x=1 echo awk 'quoted text' sed awk then export -eu grep awk
+local grep /usr/bin sed echo | grep printf /usr/bin
+		then 2>/dev/null 2>/dev/null 2>/dev/null
+awk && -eu | && "$@" | --verbose -eu --verbose cd printf && -eu /usr/bin
+	local "$@" readonly | ${HOME} local
+	x=1 test "$1" local | cd then printf x=1 local printf 2>/dev/null then
+		--verbose sed 2>/dev/null
+printf awk sed 2>/dev/null local export cd local --verbose
+		export ${HOME} export
+	--verbose awk export
+	then $(pwd) sed printf test grep echo
+	export cd 2>/dev/null x=1 /usr/bin "$@" done export readonly cd done cd
+		/usr/bin | --verbose printf --verbose $(pwd)
+	echo --verbose test 'quoted text'
+	"$1" && "$@" -eu export grep ${HOME} printf printf
+	readonly echo -eu --verbose local sed && cd 2>/dev/null
+		echo "$@" "$1" done sed x=1
+		&& 2>/dev/null "$1" echo /usr/bin done ${HOME} export awk sed 'quoted text'
+		"$@" $(pwd) echo awk | --verbose sed
+		echo done test grep then /usr/bin 2>/dev/null $(pwd)
+		$(pwd) grep && cd grep awk 'quoted text' $(pwd) readonly
+printf grep printf done -eu done | "$@" echo $(pwd) 2>/dev/null echo "$@" /usr/bin
+		$(pwd) x=1 2>/dev/null awk
+	2>/dev/null "$1" echo --verbose
+	$(pwd) sed 'quoted text' printf $(pwd) /usr/bin readonly readonly
+'quoted text' then x=1 awk
+	printf ${HOME} test grep "$@" printf done | local 'quoted text' -eu grep ${HOME}
+$(pwd) 2>/dev/null local export test echo cd 'quoted text'
+		&& test sed printf x=1 && | && x=1 /usr/bin awk awk export local echo | export
+--verbose printf | x=1 readonly x=1 local
+	-eu done awk cd grep printf readonly "$1" test 2>/dev/null
+		$(pwd) sed done "$@" "$1" printf "$1" && $(pwd) done 'quoted text'
+	sed done "$@" && x=1 then local
+	'quoted text' local x=1 done sed done done export printf "$@" test "$1"
+		x=1 -eu 2>/dev/null "$1" "$@" 2>/dev/null grep
+'quoted text' "$1" -eu export
+then -eu test awk export --verbose export cd "$@" --verbose
+	--verbose "$1" --verbose echo echo cd -eu x=1 x=1 readonly done 'quoted text' --verbose
+'quoted text' grep | done | awk -eu x=1 --verbose 'quoted text' 'quoted text'
+echo ${HOME} $(pwd) echo printf "$1" /usr/bin
+2>/dev/null -eu "$1" --verbose 2>/dev/null
+local && "$@" "$@" sed $(pwd)
+	2>/dev/null /usr/bin done /usr/bin printf awk awk --verbose readonly -eu --verbose
+	sed printf --verbose $(pwd) /usr/bin
+	| -eu --verbose && --verbose x=1
+	| readonly 'quoted text' test 'quoted text' export then
+	readonly "$@" | readonly echo grep readonly readonly
+		--verbose 2>/dev/null then then printf grep test
+		-eu 'quoted text' cd ${HOME} readonly test ${HOME} "$@" "$1" awk
+	x=1 printf local sed "$1" && done sed -eu
+--verbose | -eu 'quoted text' x=1 | ${HOME} export
+		$(pwd) | test printf "$1" grep echo sed "$1" x=1 awk local echo $(pwd) 'quoted text'
+	$(pwd) grep sed grep done readonly test | done
+	grep /usr/bin echo sed printf
+	then awk awk grep done "$@" sed
+		cd "$@" x=1 test sed 2>/dev/null printf
+	printf readonly "$1" sed /usr/bin --verbose sed awk 'quoted text'
+| export export local "$1" then "$@" ${HOME} 'quoted text'
+export export echo --verbose 'quoted text' grep && "$@" x=1 printf
+${HOME} sed 'quoted text' test awk 'quoted text' -eu cd cd test "$1" /usr/bin echo
+	sed printf printf local printf test 'quoted text'
+"$1" $(pwd) && done local "$@" && ${HOME} done done
+		grep && /usr/bin 'quoted text'
+/usr/bin then && local grep cd 2>/dev/null echo sed -eu sed 'quoted text'
+then | printf ${HOME} && | /usr/bin 'quoted text' "$1"
+grep echo test 'quoted text' cd local
+		awk /usr/bin grep printf awk readonly
+then -eu x=1 done -eu printf
+	echo readonly export echo /usr/bin /usr/bin
+		echo cd -eu sed $(pwd) readonly done
+		then --verbose 2>/dev/null sed | local echo /usr/bin && "$@" test export | -eu |
+		${HOME} then "$1" export grep 2>/dev/null 'quoted text'
+	done readonly printf ${HOME} echo readonly local 2>/dev/null && 'quoted text'
+'quoted text' 2>/dev/null /usr/bin ${HOME} $(pwd) /usr/bin -eu
+		local -eu --verbose 2>/dev/null sed 2>/dev/null --verbose
+	echo cd $(pwd) sed $(pwd) local 'quoted text'
+${HOME} grep sed printf x=1 /usr/bin "$@"
+		&& grep /usr/bin cd printf
+		awk $(pwd) cd "$1" then x=1 'quoted text' grep cd "$1" "$@" "$@" local --verbose
+--verbose sed /usr/bin -eu | printf done local readonly export ${HOME} then
+		cd && test local export awk | --verbose
+2>/dev/null ${HOME} "$@" local | local test then printf
+$(pwd) "$1" awk printf sed done local export
+x=1 --verbose then --verbose $(pwd) printf echo local
+		grep echo && cd x=1 readonly echo && $(pwd)
+	-eu readonly printf && --verbose && --verbose
+#include c32.sh
+/usr/bin local cd $(pwd) cd "$1" "$@" sed
+	-eu printf 2>/dev/null sed test
+		$(pwd) done x=1 ${HOME}
+printf cd 'quoted text' awk printf --verbose $(pwd) "$1" --verbose awk 'quoted text'
+	&& local ${HOME} && && sed 2>/dev/null cd | then test -eu ${HOME} readonly printf
+	readonly export && && test local export && cd echo export 'quoted text' "$1"
+done "$1" "$@" ${HOME} /usr/bin test local echo test then "$@" $(pwd) cd printf
+		cd && $(pwd) x=1 local awk ${HOME} done -eu
+		readonly echo export /usr/bin && then $(pwd) test --verbose sed
+	cd export && then x=1 awk echo then
+-eu grep cd ${HOME} -eu local readonly && then /usr/bin -eu ${HOME}
+printf awk -eu done echo "$@" --verbose -eu readonly export readonly awk
+| cd --verbose ${HOME} | --verbose 2>/dev/null ${HOME} 'quoted text' printf readonly
+done $(pwd) x=1 "$@" awk 2>/dev/null test grep grep echo x=1 && cd printf local
+	/usr/bin echo readonly x=1 "$1" $(pwd) $(pwd) grep $(pwd)
+then 2>/dev/null printf /usr/bin ${HOME} sed done sed 2>/dev/null
+		/usr/bin "$@" $(pwd) --verbose
+readonly $(pwd) -eu echo cd readonly then 'quoted text' echo "$1" cd printf
+"$1" local cd export "$1" awk grep "$1" 2>/dev/null then printf && 2>/dev/null
+done sed printf sed export
+		&& && x=1 "$@" local x=1 x=1 printf ${HOME} cd then readonly
+		local done 'quoted text' then echo sed "$1" cd 'quoted text'
+test done 'quoted text' 2>/dev/null grep printf
+		/usr/bin x=1 'quoted text' done ${HOME}
+		sed readonly "$1" /usr/bin sed cd awk printf x=1 echo
+		export 2>/dev/null done /usr/bin readonly x=1 ${HOME} done "$1"
+	--verbose 2>/dev/null 'quoted text' "$1" printf /usr/bin
+"$1" echo sed --verbose "$1" then "$1" x=1
+		$(pwd) printf x=1 /usr/bin echo ${HOME} done 'quoted text' then done
+	test ${HOME} -eu done done -eu 'quoted text' test -eu export then
+	| /usr/bin /usr/bin then "$1" readonly
+	x=1 --verbose | | local ${HOME} ${HOME} local 2>/dev/null 2>/dev/null echo 'quoted text'
+		done -eu -eu cd printf done 2>/dev/null
+done $(pwd) && test readonly $(pwd) cd awk /usr/bin echo cd readonly ${HOME}
+	| grep x=1 grep | then export
+echo | printf 2>/dev/null --verbose test grep /usr/bin
+		${HOME} test cd done sed x=1 2>/dev/null && then local
+local ${HOME} readonly 2>/dev/null $(pwd) readonly /usr/bin
+		grep test readonly && local grep local awk test "$@" done export
+"$@" $(pwd) cd -eu -eu test x=1 /usr/bin
+		| done 2>/dev/null done echo && "$@" x=1 &&
+"$@" echo echo readonly "$1" 'quoted text' -eu
+&& $(pwd) echo && awk /usr/bin printf && "$@" && $(pwd)
+		done cd "$@" echo done local awk 2>/dev/null
+		"$@" echo | readonly x=1 export
+	echo sed grep 2>/dev/null -eu /usr/bin cd --verbose local && readonly
+/usr/bin --verbose $(pwd) grep local -eu then grep
+done "$@" sed -eu x=1 readonly done 2>/dev/null test $(pwd) && x=1 |
+		--verbose | --verbose local /usr/bin 2>/dev/null printf /usr/bin sed
+		x=1 /usr/bin ${HOME} 'quoted text'
+export cd /usr/bin export sed sed | $(pwd) && 'quoted text' awk sed "$1"
+		"$1" test 'quoted text' | --verbose "$@" sed | 2>/dev/null
+	| grep awk x=1 echo then sed "$1" readonly done --verbose cd
+	local echo local awk $(pwd) done -eu "$1"
+2>/dev/null grep $(pwd) done
+echo test then then --verbose cd $(pwd)
+then "$@" $(pwd) | awk x=1 sed grep printf "$1" ${HOME} export export local x=1
+		-eu then "$@" "$@" printf cd -eu then sed readonly --verbose
+	--verbose then --verbose then readonly ${HOME} awk 'quoted text'
+readonly sed -eu awk $(pwd) echo printf
+"$@" x=1 | && x=1 2>/dev/null --verbose echo 2>/dev/null $(pwd) printf grep -eu
+	echo grep -eu export local cd ${HOME} 'quoted text' then x=1 --verbose export
+	"$1" awk "$1" sed cd --verbose grep ${HOME} grep
+	-eu then --verbose export test done echo ${HOME} grep
+	/usr/bin done "$@" "$1" /usr/bin | echo ${HOME} then printf "$1" 'quoted text'
+		test $(pwd) && echo 2>/dev/null echo grep | --verbose
+	grep "$@" grep "$@" sed grep --verbose
+	'quoted text' printf "$@" && --verbose awk "$1" local "$@" sed printf $(pwd) local
+		'quoted text' 2>/dev/null readonly cd 'quoted text' 2>/dev/null
+		| ${HOME} done grep export 2>/dev/null && export /usr/bin -eu cd |
+	2>/dev/null /usr/bin /usr/bin cd "$@" echo "$@" done "$@" awk grep
+"$@" x=1 /usr/bin sed export -eu echo readonly
+	${HOME} "$1" grep "$1" x=1 $(pwd) | awk && --verbose export
+	awk "$1" sed export 2>/dev/null "$1" then then local
+		&& then $(pwd) readonly ${HOME} 'quoted text' -eu "$1" printf
+		&& sed printf | export test 'quoted text'
+-eu 2>/dev/null sed local 2>/dev/null "$1" cd awk x=1 "$1" /usr/bin done
+	"$@" --verbose /usr/bin 'quoted text'
+| x=1 grep "$1" -eu ${HOME} local "$@" sed 2>/dev/null sed then export echo
+		-eu "$1" "$@" "$1" test printf
+		2>/dev/null "$@" 2>/dev/null | && done --verbose -eu awk export
+		sed done ${HOME} awk "$1" "$1" test local awk then 2>/dev/null --verbose -eu "$1"
+	--verbose -eu export done x=1 readonly && "$1" 'quoted text'
+	local sed test /usr/bin sed export test export echo then 'quoted text' awk "$1"
+		-eu x=1 sed grep 2>/dev/null awk sed x=1
+		readonly cd printf "$1" x=1 then export -eu 'quoted text'
+-eu echo 2>/dev/null 'quoted text' 'quoted text' local --verbose
+		--verbose readonly x=1 ${HOME} $(pwd) --verbose
+	"$1" x=1 x=1 2>/dev/null -eu cd ${HOME} done cd x=1 local
+/usr/bin 2>/dev/null export then awk x=1 2>/dev/null cd
+	${HOME} test --verbose grep awk
+	'quoted text' | test
+		readonly 2>/dev/null && x=1
+		awk test then 'quoted text' ${HOME} done readonly
+		"$@" export ${HOME} $(pwd) ${HOME} /usr/bin printf ${HOME} x=1 'quoted text'
+awk export ${HOME} ${HOME} done local "$@" export
+		done -eu test then --verbose test /usr/bin 2>/dev/null awk grep echo done
+		awk x=1 "$1" --verbose
+test ${HOME} 2>/dev/null --verbose /usr/bin sed /usr/bin
+	sed printf | echo 2>/dev/null ${HOME} $(pwd) local export local x=1
+	local then "$1" x=1 "$1" --verbose
+${HOME} grep "$1" test then -eu cd -eu echo /usr/bin
+	sed 'quoted text' sed | ${HOME}
+test && | printf awk grep readonly 2>/dev/null
+then readonly "$1" ${HOME} test readonly
+2>/dev/null local readonly 2>/dev/null cd echo readonly
+	cd sed sed cd local -eu
+	then printf readonly "$@" --verbose done grep printf awk && && "$1"
+test | test readonly test "$1" printf echo --verbose "$@" grep 2>/dev/null
+		-eu "$@" && cd done grep cd cd printf 'quoted text' echo ${HOME} echo
+--verbose local then 'quoted text'
+	"$@" local then ${HOME} ${HOME} ${HOME} &&
+	2>/dev/null --verbose "$@" test grep then /usr/bin
+	"$@" sed test | --verbose readonly | 'quoted text' "$1" ${HOME} readonly sed
+	printf -eu test ${HOME} 2>/dev/null
+		readonly -eu awk x=1 && test sed echo export awk x=1 local
+		grep echo 2>/dev/null printf awk /usr/bin 2>/dev/null "$@"
+	cd | --verbose ${HOME} local local
+		$(pwd) done grep readonly && x=1 -eu readonly 2>/dev/null
+local ${HOME} cd x=1 export local "$1" x=1 x=1 "$@" $(pwd) /usr/bin && then done
+	readonly | echo done grep done sed ${HOME} grep done cd ${HOME} -eu | "$@" readonly
+		grep local && 2>/dev/null awk --verbose /usr/bin sed
+readonly sed "$1" local echo 2>/dev/null printf cd sed $(pwd) | readonly
+		test test done $(pwd) local sed $(pwd) ${HOME} x=1 'quoted text' cd cd /usr/bin
+done test grep 2>/dev/null /usr/bin x=1 x=1 && grep "$@" -eu
+2>/dev/null -eu 'quoted text'
+		"$1" grep x=1 && -eu export | echo sed "$1" $(pwd)
+	/usr/bin $(pwd) "$1" awk 'quoted text'
+		printf "$1" x=1 awk echo done printf grep test --verbose -eu done export 'quoted text'
+		"$@" /usr/bin sed cd sed
+		printf "$1" awk echo test ${HOME} test
+sed -eu "$1" test && cd ${HOME} /usr/bin sed 2>/dev/null
+	grep done /usr/bin local local "$@" 2>/dev/null local x=1 ${HOME} && "$1" awk printf
+		then "$@" "$1" "$1" local "$@" grep
+local /usr/bin test "$1" "$1" 2>/dev/null test done 2>/dev/null ${HOME}
+	then readonly local export x=1 echo 2>/dev/null awk cd readonly grep sed
+		${HOME} test x=1 grep "$1" test -eu ${HOME} readonly --verbose 2>/dev/null 2>/dev/null
+	sed sed "$1" 2>/dev/null grep $(pwd) cd printf -eu | "$@" printf done 'quoted text'
+x=1 /usr/bin export x=1 /usr/bin
+		test done readonly echo /usr/bin test grep "$@" | printf
+grep | 2>/dev/null "$1" | && "$1" | grep sed && $(pwd) /usr/bin
+2>/dev/null "$1" readonly grep "$1" 'quoted text' then "$1" sed awk /usr/bin x=1
+"$@" 2>/dev/null done /usr/bin grep 'quoted text' -eu
+local "$1" $(pwd) echo cd test /usr/bin 'quoted text'
+printf echo readonly printf --verbose | 2>/dev/null x=1 2>/dev/null -eu
+	&& export done readonly
+export test printf grep export awk echo local x=1 2>/dev/null
+&& grep test 'quoted text' readonly -eu 2>/dev/null --verbose
+	printf --verbose x=1 readonly printf
+		test done sed x=1 -eu printf readonly echo &&
+"$@" 2>/dev/null then local 2>/dev/null
+		echo $(pwd) -eu cd then then
+		${HOME} -eu done "$1" | -eu readonly
+		"$@" cd -eu $(pwd) ${HOME} && "$@" --verbose printf awk "$1" x=1 sed cd
+	sed | then --verbose local && readonly done readonly $(pwd) 'quoted text' test
+'quoted text' export -eu printf 2>/dev/null && awk export echo test && "$1"
+		export awk grep $(pwd) cd x=1 grep && then | test /usr/bin -eu
+	sed /usr/bin export --verbose -eu x=1
+		| -eu x=1 readonly "$1" | grep $(pwd)
+	echo echo local x=1 cd awk cd
+cd local done "$@" -eu readonly done cd 'quoted text' --verbose | cd done
+then test -eu --verbose then ${HOME} readonly export $(pwd) done 2>/dev/null
+cd awk -eu export "$@" local then $(pwd) awk 'quoted text' test $(pwd) "$1" --verbose
+	$(pwd) $(pwd) cd x=1 local 2>/dev/null "$1" 2>/dev/null -eu
+	$(pwd) "$1" "$1" --verbose | echo awk $(pwd) x=1
+awk "$@" -eu x=1 && "$@"
+printf awk test -eu local --verbose
+	cd "$1" "$@" export sed | export -eu "$1" $(pwd) /usr/bin echo
+"$@" readonly test readonly --verbose
+		${HOME} $(pwd) done 2>/dev/null
+		"$1" x=1 $(pwd) done "$@" export ${HOME} then $(pwd) printf readonly
+	2>/dev/null $(pwd) x=1 /usr/bin 'quoted text' |
+		printf cd awk awk "$@" done ${HOME} grep local awk -eu /usr/bin then -eu
+	/usr/bin /usr/bin && -eu then cd 'quoted text'
+	"$1" test printf awk awk export $(pwd) cd sed ${HOME} local done --verbose &&
+done local local test -eu "$@" export /usr/bin --verbose "$1" | grep done
+export grep echo --verbose | ${HOME} $(pwd)
+		local 'quoted text' x=1 /usr/bin "$1" "$1" local
+-eu 'quoted text' && ${HOME} 2>/dev/null
+	/usr/bin cd echo then --verbose printf ${HOME} done printf
+		"$1" && 'quoted text' ${HOME} 2>/dev/null /usr/bin printf
+cd x=1 "$@" readonly /usr/bin "$1" "$@" local local local | cd 2>/dev/null awk ${HOME}
+		grep awk readonly ${HOME} -eu $(pwd) then x=1 'quoted text' then $(pwd) local
+		&& | x=1 "$@" sed x=1 2>/dev/null done
+		then awk echo sed 'quoted text' sed cd 2>/dev/null sed export x=1 readonly
+		2>/dev/null test printf x=1 'quoted text' cd 2>/dev/null
+	done awk readonly 'quoted text' grep test |
+test "$1" 2>/dev/null then ${HOME} grep local /usr/bin awk -eu echo 2>/dev/null
+	grep printf echo x=1 test echo --verbose cd test 'quoted text' echo grep awk
+	export "$@" 'quoted text' echo cd --verbose sed
+cd 'quoted text' && sed then printf readonly "$@" then sed test sed awk && $(pwd)
+	sed 'quoted text' 'quoted text' local ${HOME} done then 2>/dev/null
+local /usr/bin --verbose export
+-eu echo done grep cd local /usr/bin readonly
+	cd done x=1 awk "$1" awk cd "$1" then --verbose
+	readonly --verbose test 'quoted text' "$1" ${HOME} /usr/bin grep done
+	"$@" | export local 2>/dev/null /usr/bin grep
+	cd x=1 printf $(pwd) x=1 ${HOME}
+	--verbose "$1" "$1" -eu ${HOME}
+export && 2>/dev/null echo && 2>/dev/null awk "$@"
+	then 'quoted text' done printf awk test 'quoted text'
+		&& 'quoted text' x=1 --verbose done "$1" local grep | cd -eu x=1 /usr/bin |
+cd printf echo sed awk grep && "$@"
+		sed "$@" | then --verbose && ${HOME}
+readonly printf -eu then
+		cd ${HOME} export 'quoted text' done done echo local ${HOME} 2>/dev/null "$@"
+		"$@" sed grep --verbose export ${HOME} && 2>/dev/null && $(pwd) "$1" printf $(pwd)
+		export x=1 "$@" "$@" && local "$@" readonly grep awk local done
+		"$1" readonly then test readonly cd
+		| cd "$@" awk printf /usr/bin then awk -eu --verbose "$@" "$1" echo export
+		--verbose /usr/bin printf $(pwd) done --verbose done 2>/dev/null | then 2>/dev/null
+--verbose 2>/dev/null 2>/dev/null
+	"$@" $(pwd) awk && /usr/bin test done echo 2>/dev/null 'quoted text' 'quoted text'
+	$(pwd) | | cd 2>/dev/null | awk "$@"
+-eu then readonly then $(pwd) printf readonly 'quoted text' local | "$1" echo
+x=1 && printf done local x=1 $(pwd) awk /usr/bin done $(pwd) x=1 done test /usr/bin
+	| grep $(pwd) 2>/dev/null test readonly && --verbose
+/usr/bin grep readonly x=1 "$1" 'quoted text'
+	sed x=1 x=1 test && "$@" /usr/bin
+		-eu export sed -eu export test 'quoted text' /usr/bin done 2>/dev/null
+		/usr/bin ${HOME} local echo
+-eu local done | x=1 $(pwd) then 'quoted text' then -eu echo --verbose
+export /usr/bin | && && export ${HOME}
+	x=1 grep test x=1 "$@"
+'quoted text' "$1" echo local
+'quoted text' grep cd printf "$@" "$1" -eu x=1 x=1 cd awk | -eu
+		awk "$@" "$@" sed | printf echo done -eu sed --verbose && | echo test export
+	-eu -eu -eu echo 2>/dev/null ${HOME} awk
+	'quoted text' sed | echo "$@" 'quoted text' readonly x=1 "$@" $(pwd) 'quoted text'
+	local awk && -eu test local export test | readonly
+		"$1" grep "$1" x=1 --verbose done x=1 2>/dev/null /usr/bin readonly done
+sed done cd test echo echo
+		sed then 2>/dev/null readonly 2>/dev/null readonly
+	grep then grep echo echo echo awk test ${HOME} $(pwd)
+		export ${HOME} local /usr/bin printf
+"$@" | 2>/dev/null 'quoted text' $(pwd) x=1 ${HOME} x=1 export readonly
+	echo ${HOME} --verbose then $(pwd) x=1 2>/dev/null && export $(pwd)
+	x=1 /usr/bin sed "$@" 'quoted text' printf test grep |
+awk then ${HOME} export export then then x=1 &&
+	test cd | awk | -eu sed
+		&& grep "$1" ${HOME} $(pwd) --verbose test ${HOME}
+"$1" x=1 printf | export | done "$@" x=1 -eu
+readonly && then "$1" cd sed export ${HOME} cd ${HOME} grep done
+	printf "$@" "$1" 2>/dev/null && grep $(pwd) sed | readonly cd 2>/dev/null
+	"$@" "$@" grep $(pwd) /usr/bin ${HOME} test
+${HOME} readonly printf ${HOME} echo local &&
+-eu "$1" grep printf --verbose /usr/bin
+		/usr/bin 'quoted text' "$1" ${HOME} cd test done echo
+	'quoted text' 'quoted text' sed -eu sed "$@" readonly awk export grep x=1 && local
+		| -eu ${HOME} "$@" then 'quoted text' "$1" "$@" local $(pwd) readonly
+		grep done export ${HOME} /usr/bin "$1" readonly local
+"$@" -eu echo 'quoted text' 2>/dev/null "$1" awk && printf awk 2>/dev/null --verbose
+		2>/dev/null then grep grep done readonly
+		readonly test then --verbose /usr/bin -eu done x=1 -eu
+echo echo --verbose && "$1" cd | --verbose | 'quoted text'
+	readonly sed awk done --verbose
+	&& printf grep x=1 ${HOME} | awk
+		$(pwd) printf "$1" | test --verbose done
+	x=1 cd 'quoted text' /usr/bin
+		printf grep ${HOME} "$1" 2>/dev/null
+	--verbose --verbose sed "$1"
+	'quoted text' ${HOME} grep export x=1 then "$1" 'quoted text' "$1" sed export
+--verbose printf done | "$1"
+	2>/dev/null cd 'quoted text' &&
+$(pwd) sed && 'quoted text' cd sed -eu && x=1 done 'quoted text' -eu
+		&& export grep echo --verbose "$@" -eu printf test $(pwd) -eu --verbose
+$(pwd) local then printf grep local -eu 'quoted text'
+2>/dev/null readonly printf /usr/bin "$1" sed --verbose local local export sed
+--verbose $(pwd) ${HOME} echo "$1" x=1 local ${HOME} cd grep &&
+		&& readonly then export
+	-eu /usr/bin /usr/bin echo /usr/bin cd test printf 2>/dev/null local awk
+	local sed $(pwd) test test $(pwd) --verbose sed "$1" done
+/usr/bin 'quoted text' echo awk
+		grep ${HOME} $(pwd) then | "$1" | "$1"
+cd printf 2>/dev/null $(pwd) done $(pwd) 2>/dev/null
+	awk -eu local awk 2>/dev/null test "$1" cd -eu | "$@" 2>/dev/null
+		sed cd "$@" 2>/dev/null cd then "$1"
+		local done && awk sed readonly /usr/bin done local | echo
+grep ${HOME} echo export 2>/dev/null local x=1 "$@" /usr/bin &&
+"$@" -eu done echo awk 'quoted text' then cd test cd --verbose export
+-eu then awk 2>/dev/null ${HOME} then readonly sed printf readonly then
+		'quoted text' "$@" | awk then $(pwd) && 2>/dev/null readonly local
+		&& done echo | /usr/bin export 2>/dev/null && export done awk ${HOME}
+	"$1" /usr/bin then $(pwd)
+then done printf local 'quoted text' 'quoted text' then local | "$1"
+awk "$1" awk "$1" "$@" local && sed 'quoted text'
+${HOME} grep $(pwd) ${HOME} /usr/bin sed export
+	'quoted text' done export "$1" test awk echo | && echo "$@" echo awk "$1"
+readonly /usr/bin test --verbose
+	"$@" x=1 2>/dev/null grep done printf awk 'quoted text'
+		x=1 2>/dev/null x=1 cd -eu then /usr/bin /usr/bin export done test grep
+		readonly "$@" cd && 'quoted text'
+	awk | done $(pwd) "$@"
+		readonly | grep export $(pwd) 2>/dev/null local && 2>/dev/null $(pwd) test
+awk readonly --verbose 'quoted text' x=1 "$@" test
+	readonly $(pwd) export printf export ${HOME} -eu 2>/dev/null ${HOME} cd awk
+	local && grep $(pwd) x=1 echo 'quoted text' --verbose "$@" awk awk echo
+	then done grep printf $(pwd) awk x=1 grep sed "$1" && grep readonly x=1 awk /usr/bin
+	&& -eu test printf ${HOME} awk awk ${HOME}
+		"$1" printf -eu 2>/dev/null /usr/bin echo 2>/dev/null -eu $(pwd)
+		local "$@" echo echo $(pwd)
+	x=1 sed export readonly && cd sed local done "$@" 'quoted text' export
+		$(pwd) awk awk && sed grep printf then x=1 "$@" "$@" local export
+		/usr/bin export local local
+printf 2>/dev/null printf | | test "$1" local --verbose --verbose
+sed --verbose 'quoted text'
+		sed test then --verbose "$1" readonly "$@" export export --verbose -eu
+sed && "$@" readonly test test "$1" x=1 'quoted text' printf awk printf 'quoted text'
+		| -eu --verbose grep 2>/dev/null
+		$(pwd) sed sed export && then printf 2>/dev/null x=1 'quoted text' printf
+		"$1" 2>/dev/null test local /usr/bin 2>/dev/null x=1
+	then "$1" cd test awk done "$@" awk
+		cd 'quoted text' grep /usr/bin "$@"
+test /usr/bin cd x=1 sed then cd x=1 -eu /usr/bin readonly
+"$1" local local export "$1" "$@"
+${HOME} 'quoted text' done test
+awk sed cd && done echo sed
+		-eu echo 2>/dev/null $(pwd) && cd
+		/usr/bin ${HOME} 'quoted text' x=1 test | 'quoted text' "$@"
+		test then export export "$@" printf 2>/dev/null awk
+		"$@" readonly && ${HOME} "$1"
+"$1" $(pwd) 'quoted text' | echo then "$1"
+	grep test readonly 2>/dev/null $(pwd)
+	done sed printf printf awk then cd printf awk
+		printf "$1" /usr/bin /usr/bin done x=1 cd export "$@" sed ${HOME}
+		export sed 'quoted text' | awk local 'quoted text' "$1" x=1 "$@" x=1
+		local 2>/dev/null /usr/bin export
+export local readonly "$@" x=1 /usr/bin printf
+awk export then x=1 | done export echo $(pwd) printf printf echo awk readonly
+	x=1 "$@" readonly readonly
+		grep x=1 "$@" && cd $(pwd) readonly printf $(pwd)
+sed echo 'quoted text' x=1 export $(pwd) grep "$1" ${HOME} x=1 /usr/bin then
+		"$1" && sed --verbose "$@" /usr/bin
+-eu grep x=1 then ${HOME} test awk awk 2>/dev/null grep printf "$@"
+cd x=1 | test sed sed awk $(pwd) then
+		&& then "$1" printf readonly grep local $(pwd) $(pwd) ${HOME} | readonly
+		-eu printf && $(pwd) local printf
+done readonly 'quoted text'
+		| readonly printf awk 2>/dev/null ${HOME} cd -eu 2>/dev/null
+		then then 2>/dev/null $(pwd) x=1 then "$@" echo
+then readonly 2>/dev/null
+		cd 2>/dev/null then readonly readonly /usr/bin 'quoted text'
+&& cd x=1 sed $(pwd) then echo
+		&& 2>/dev/null | grep -eu grep $(pwd) -eu cd awk test cd local ${HOME}
+	&& readonly ${HOME} && $(pwd) then done /usr/bin local readonly
+		grep "$1" readonly awk printf && ${HOME} done x=1 -eu
+	2>/dev/null local test "$1" test test echo -eu 'quoted text'
+	--verbose sed printf awk test -eu cd 'quoted text' test export ${HOME} awk
+	| "$@" then x=1 export export awk done ${HOME}
+		${HOME} "$@" grep grep sed x=1 awk --verbose export && readonly echo -eu | sed
+then | 'quoted text' printf x=1 local readonly readonly printf done test /usr/bin
+	done echo --verbose --verbose && grep
+	printf $(pwd) local cd /usr/bin 'quoted text' grep then sed test cd |
+$(pwd) -eu echo local "$1" local export grep echo "$@" local 2>/dev/null awk --verbose
+-eu grep awk x=1 2>/dev/null sed echo
+		export && then ${HOME} grep && printf test
+		"$@" $(pwd) /usr/bin local -eu "$@" -eu sed grep
+	| done cd /usr/bin cd printf grep readonly $(pwd)
+		local | awk test /usr/bin "$1" /usr/bin printf test /usr/bin --verbose sed
+	grep awk --verbose done grep printf -eu "$1" then printf ${HOME} 'quoted text'
+	x=1 x=1 2>/dev/null 2>/dev/null ${HOME} "$@" /usr/bin printf
+		sed -eu grep | echo awk
+		then done done ${HOME} done grep /usr/bin -eu cd sed /usr/bin
+	grep ${HOME} awk then test "$1" local
+-eu | 2>/dev/null -eu $(pwd) then 'quoted text' ${HOME} cd readonly
+		sed $(pwd) | done sed | cd $(pwd) printf sed -eu printf test echo
+	local "$1" 2>/dev/null "$1" "$1" test /usr/bin | cd -eu /usr/bin 2>/dev/null
+readonly "$@" echo -eu awk done test /usr/bin then "$@" then echo 'quoted text'
+		&& /usr/bin --verbose awk cd /usr/bin echo 'quoted text' /usr/bin 2>/dev/null
+	${HOME} 'quoted text'
+		awk awk x=1 "$@" -eu ${HOME} "$@" then done "$@"
+		awk sed | 2>/dev/null echo && printf then | grep 'quoted text'
+	"$1" 2>/dev/null test grep --verbose && | $(pwd) | $(pwd)
+done export awk printf x=1 "$1"
+echo "$@" then "$@" export echo local export done then local done
+	| 'quoted text' sed ${HOME} awk | x=1 awk
+	export done && grep /usr/bin /usr/bin $(pwd) readonly && | export cd -eu test test
+| readonly local /usr/bin done export /usr/bin
+printf echo test local then done --verbose awk x=1 grep readonly done
+		$(pwd) export readonly cd local --verbose x=1
+	export export && /usr/bin
+	2>/dev/null -eu then done echo readonly x=1 /usr/bin "$@"
+done readonly 'quoted text' "$@" --verbose done awk
+	export /usr/bin --verbose --verbose
+	"$@" 'quoted text' | local /usr/bin printf "$@" printf printf cd printf
+	grep local "$@" 'quoted text' grep readonly 'quoted text'
+$(pwd) awk then ${HOME} export test 2>/dev/null --verbose grep && /usr/bin test
+		done awk x=1 2>/dev/null -eu sed then /usr/bin 2>/dev/null local echo local /usr/bin
+	awk printf "$1" 'quoted text' x=1 printf printf
+'quoted text' test --verbose | echo then echo export
+		awk "$@" 2>/dev/null echo readonly /usr/bin readonly ${HOME} "$1" ${HOME} $(pwd)
+"$1" grep -eu sed readonly $(pwd) then readonly
+then ${HOME} x=1 "$@" /usr/bin sed $(pwd) readonly
+| && -eu local -eu x=1
+	"$@" 2>/dev/null /usr/bin
+		test printf done sed "$1" -eu "$@" test awk && --verbose /usr/bin
+	$(pwd) ${HOME} /usr/bin "$1" awk readonly
+	cd sed "$@" && x=1 $(pwd) grep cd awk
+		2>/dev/null readonly && "$@" 'quoted text' readonly && /usr/bin cd readonly
+		export local test 'quoted text' 'quoted text' $(pwd) "$1"
+	grep cd test ${HOME} test grep "$1" export
+		"$1" test readonly --verbose x=1
+${HOME} test "$1" test $(pwd) "$1" "$@" then grep readonly local grep 'quoted text'
+	printf --verbose $(pwd) then /usr/bin --verbose awk --verbose $(pwd) "$1"
+		| export 2>/dev/null cd "$@" grep test -eu | "$1" $(pwd)
+${HOME} test printf --verbose "$@" echo done then sed x=1 export 'quoted text'
+		| grep x=1 awk ${HOME} x=1 /usr/bin 2>/dev/null
+'quoted text' then -eu 2>/dev/null
+		"$1" export /usr/bin printf test grep done done $(pwd) printf sed local /usr/bin
+	echo "$@" then local 2>/dev/null 'quoted text' test && $(pwd) "$@"
+	done local | "$1" | local "$@" 2>/dev/null local | 2>/dev/null
+then --verbose && -eu echo $(pwd) | $(pwd) cd local printf && test sed &&
+grep sed then test ${HOME}
+x=1 $(pwd) 'quoted text' printf
+		echo "$@" sed ${HOME} x=1 grep
+	$(pwd) cd then then ${HOME} 2>/dev/null
+then awk done grep export sed --verbose local cd 'quoted text'
+'quoted text' sed 2>/dev/null done done ${HOME}
+'quoted text' 'quoted text' 2>/dev/null awk "$1" echo sed --verbose
+	grep "$@" "$1" test sed
+--verbose awk sed local printf -eu echo local local readonly 'quoted text'
+sed $(pwd) export -eu /usr/bin
+	2>/dev/null grep printf --verbose 2>/dev/null readonly readonly readonly
+		"$@" ${HOME} && printf 2>/dev/null
+	local then 'quoted text' export $(pwd)
+	test $(pwd) grep awk printf test x=1 | sed
+		"$1" | ${HOME} -eu /usr/bin 2>/dev/null export 2>/dev/null export
+		/usr/bin then $(pwd) 2>/dev/null export echo ${HOME} "$1" cd echo local
+	grep | cd "$1" grep done | 2>/dev/null
+	local readonly ${HOME} echo 2>/dev/null 2>/dev/null
+		-eu /usr/bin -eu --verbose --verbose ${HOME}
+		${HOME} --verbose export 'quoted text' | "$@" local /usr/bin
+		awk awk echo export cd $(pwd) then | grep "$@"
+cd sed test && ${HOME} awk 'quoted text' then &&
+x=1 | --verbose test local
+test sed "$1" $(pwd) printf echo test done done "$1" ${HOME}
+	then then then cd 'quoted text' printf readonly $(pwd)
+		/usr/bin local --verbose sed export
+&& then sed --verbose then 'quoted text' then "$@"
+done -eu local /usr/bin --verbose
+		export x=1 --verbose
+readonly "$1" ${HOME} sed -eu echo
+		$(pwd) done | --verbose sed printf done
+		echo x=1 2>/dev/null -eu "$@" export 2>/dev/null "$1" cd 'quoted text' cd
+	--verbose then test awk awk then -eu x=1 cd x=1 $(pwd) | | readonly export test
+${HOME} /usr/bin && done "$@" cd 'quoted text' 'quoted text'
+	$(pwd) export export 'quoted text'
+		printf /usr/bin $(pwd) | && ${HOME} cd sed /usr/bin
+"$1" "$@" test echo "$@" echo test && export sed test grep done then local 'quoted text'
+then cd x=1 $(pwd) done $(pwd) "$1" export 2>/dev/null
+awk sed printf "$1" then echo "$@" awk then 'quoted text'
+	"$1" "$@" "$@" ${HOME}
+grep x=1 grep --verbose export $(pwd)
+done x=1 grep test "$@" printf done | 'quoted text' --verbose "$1" | && --verbose
+	test export grep then
+$(pwd) export printf -eu sed
+		--verbose done "$@" local
+		test export | | -eu "$@" printf done $(pwd)
+		| printf 'quoted text' echo export done grep done readonly 'quoted text' x=1
+	test local --verbose -eu export readonly /usr/bin | then export test --verbose
+		awk -eu sed then test -eu test
+	then echo export -eu 'quoted text'
+&& awk && grep local $(pwd) sed cd awk
+		-eu $(pwd) awk readonly local 'quoted text' "$@" awk "$1" "$@" --verbose
+		test "$1" readonly printf readonly --verbose /usr/bin test --verbose sed /usr/bin
+		&& echo -eu --verbose printf --verbose export -eu sed export "$1" |
+	--verbose local then test 'quoted text' test
+'quoted text' done cd cd "$@" ${HOME} sed 'quoted text' grep x=1 printf
+readonly ${HOME} && awk x=1 then ${HOME} cd -eu && cd -eu /usr/bin x=1
+&& then export grep -eu printf $(pwd) readonly grep 2>/dev/null
+	done test x=1 x=1 "$1" local done test 2>/dev/null
+"$@" test "$@" "$1" "$@" "$1" ${HOME} test sed printf export -eu "$@"
+| sed local readonly /usr/bin local test && local -eu | grep readonly
+x=1 export test ${HOME} readonly test 2>/dev/null
+	'quoted text' 2>/dev/null -eu 2>/dev/null export
+		--verbose readonly x=1 2>/dev/null readonly x=1 test export
+		done | "$1" cd "$@" --verbose test test "$@" --verbose done
+test "$1" | test && --verbose local
+printf echo then ${HOME} "$1" -eu local
+'quoted text' cd 'quoted text' 2>/dev/null then && test x=1 readonly
+	sed $(pwd) cd $(pwd) "$@" local && $(pwd) sed then awk local x=1 "$1" echo 2>/dev/null
+		| 'quoted text' | echo echo then test && sed && export
+		local test sed --verbose 2>/dev/null | done printf printf test done
+		echo cd && | readonly $(pwd) -eu x=1
+	-eu then echo test 'quoted text' | /usr/bin echo && sed export done test sed
+-eu "$@" 2>/dev/null -eu sed /usr/bin
+	${HOME} export -eu cd -eu x=1 local cd "$@" awk $(pwd) printf local readonly awk
+		'quoted text' x=1 grep x=1 local printf &&
+	done "$1" && /usr/bin local printf readonly printf then grep test printf
+x=1 echo done printf | $(pwd) local "$1" -eu --verbose "$@" local export echo
+		&& grep $(pwd) done local 2>/dev/null sed cd awk
+		&& && echo x=1 echo "$1" printf $(pwd) 'quoted text' | local 2>/dev/null x=1
+		x=1 printf x=1 "$@" x=1 --verbose "$1" "$1" done
+		sed export 2>/dev/null && done
+'quoted text' "$@" grep --verbose local && $(pwd) local 2>/dev/null
+		echo --verbose 2>/dev/null $(pwd) echo /usr/bin "$1" --verbose
+	--verbose cd "$1" -eu then | 'quoted text' x=1 test
+		cd | --verbose --verbose then export /usr/bin
+	printf echo echo 'quoted text' | x=1 printf
+	export --verbose "$1" ${HOME} echo local | x=1
+$(pwd) test grep /usr/bin
+		'quoted text' readonly
+		awk 'quoted text' && awk "$@"
+	/usr/bin x=1 awk /usr/bin cd | && export local -eu readonly awk local
+	&& readonly "$@" /usr/bin done x=1
+${HOME} x=1 -eu done then && test then /usr/bin -eu -eu && && 2>/dev/null /usr/bin
+$(pwd) export echo export test "$1" done --verbose awk ${HOME} x=1 2>/dev/null
+		sed 2>/dev/null printf --verbose -eu sed --verbose echo 2>/dev/null
+		local test 2>/dev/null local | then --verbose grep export grep x=1 cd /usr/bin
+	grep $(pwd) local | printf cd 2>/dev/null printf x=1 printf
+		then -eu printf 2>/dev/null "$1" readonly /usr/bin
+"$@" "$1" ${HOME} | awk done readonly printf ${HOME} printf ${HOME}
+	| 'quoted text' "$@" printf --verbose "$@" 'quoted text' -eu awk && done
+echo awk x=1 --verbose then | $(pwd) 'quoted text' $(pwd)
+	done | test /usr/bin cd readonly printf printf $(pwd)
+		awk -eu "$@" && echo test
+--verbose "$1" export /usr/bin sed 'quoted text' /usr/bin x=1 printf sed x=1 then
+	-eu 'quoted text' readonly export then x=1 export "$1" printf awk test readonly
+	test local x=1 && sed
+		local && cd "$@" echo echo
+${HOME} "$1" awk --verbose test export done test ${HOME} --verbose ${HOME}
+then export x=1 awk cd done done --verbose "$1" "$1"
+	sed | export echo done cd $(pwd) printf && readonly ${HOME} ${HOME} test
+	"$1" grep x=1 | x=1 && 2>/dev/null done export 2>/dev/null $(pwd) sed grep "$@"
+		$(pwd) awk | $(pwd) $(pwd) "$1" test grep $(pwd) | export | 'quoted text'
+${HOME} 2>/dev/null | readonly grep --verbose
+	"$1" x=1 --verbose "$@" grep "$1" awk cd ${HOME} cd 2>/dev/null then
+then echo ${HOME} grep && done 2>/dev/null /usr/bin
+		printf readonly done x=1 "$1" --verbose x=1 export readonly
+$(pwd) cd ${HOME} "$@" 'quoted text'
+	-eu && | "$1" printf && grep | printf done
+	awk test cd x=1 printf x=1 "$@" grep cd --verbose
+		test sed test printf $(pwd) export grep test readonly 2>/dev/null
+grep cd ${HOME} 2>/dev/null && readonly -eu "$1" printf x=1 echo done awk
+&& 2>/dev/null awk local --verbose sed readonly ${HOME}
+-eu cd echo | sed "$1" -eu && && sed | ${HOME} export grep "$@" done 2>/dev/null
+	grep 2>/dev/null done $(pwd) "$@" printf then grep
+	cd done --verbose -eu && cd -eu export readonly printf
+${HOME} /usr/bin readonly then test "$1" | sed 2>/dev/null
+		export --verbose export echo ${HOME} /usr/bin
+		local | export local -eu test grep printf 2>/dev/null sed
+		sed local done 'quoted text' 'quoted text' export /usr/bin ${HOME} /usr/bin
+	export /usr/bin 'quoted text' done -eu --verbose grep readonly readonly "$@" printf
+	printf printf "$@" "$1" ${HOME}
+then /usr/bin | test "$1" && local then export local
+	local 2>/dev/null sed done "$@" done 2>/dev/null
+done $(pwd) && awk 2>/dev/null 'quoted text'
+	cd | 'quoted text' 2>/dev/null
+		test readonly local 2>/dev/null sed &&
+	| printf awk done cd && test 'quoted text'
+		--verbose --verbose 'quoted text'
+	"$@" ${HOME} | test 2>/dev/null local x=1 grep done readonly "$@" echo && printf
+x=1 cd export awk x=1 x=1 --verbose 2>/dev/null cd
+	done printf readonly | export sed test --verbose local 2>/dev/null
+done /usr/bin awk local export --verbose local /usr/bin -eu
+	test ${HOME} x=1 "$1" /usr/bin x=1 $(pwd)
+	done grep ${HOME} 2>/dev/null "$@" sed then export
+echo --verbose 'quoted text' export "$@" 'quoted text' printf 'quoted text' "$@"
+		--verbose sed /usr/bin echo done cd cd done readonly readonly
+	2>/dev/null grep ${HOME} test printf
+		'quoted text' x=1 2>/dev/null ${HOME} export && echo -eu --verbose then --verbose
+		export | -eu then /usr/bin printf /usr/bin awk 'quoted text'
+x=1 ${HOME} export cd printf | 2>/dev/null awk readonly readonly done
+	&& "$1" $(pwd) then grep "$1" && 2>/dev/null ${HOME} -eu local cd &&
+		echo awk done "$1" | printf
+	readonly then readonly awk /usr/bin
+	x=1 $(pwd) echo 2>/dev/null /usr/bin -eu printf readonly -eu
+cd /usr/bin readonly $(pwd) awk readonly /usr/bin
+	${HOME} x=1 sed printf test readonly --verbose local then echo readonly
+readonly 2>/dev/null 2>/dev/null ${HOME} x=1 done then done -eu then
+	echo ${HOME} done export --verbose printf "$1" "$@" ${HOME} sed
+| 'quoted text' /usr/bin
+	local readonly export cd 'quoted text'
+		x=1 "$1" test done -eu cd then $(pwd) readonly sed echo
+		-eu local 2>/dev/null readonly local done 'quoted text'
+		then readonly test ${HOME} | echo 'quoted text' local printf readonly -eu
+	x=1 then echo done && && export
+grep echo x=1 && -eu export && -eu x=1 test 'quoted text' export
+awk && done export ${HOME}
+	test && "$@" --verbose --verbose grep test
+	"$1" echo && grep 2>/dev/null cd echo $(pwd) grep ${HOME} then | cd "$1"
+/usr/bin ${HOME} && done printf grep x=1 /usr/bin && 2>/dev/null grep /usr/bin /usr/bin
+	cd cd grep awk | readonly /usr/bin cd local | | ${HOME}
+--verbose local printf "$@" printf ${HOME} grep done cd "$1" cd x=1 awk then
+	'quoted text' local 2>/dev/null sed 2>/dev/null then /usr/bin
+2>/dev/null local x=1 readonly
+		echo /usr/bin printf | /usr/bin
+readonly export sed test 2>/dev/null
+	"$1" ${HOME} 'quoted text' -eu cd then awk
+	"$1" --verbose x=1 export awk test echo -eu done | /usr/bin | x=1
+	echo readonly export 2>/dev/null && export echo /usr/bin
+	| ${HOME} x=1 local grep $(pwd) grep --verbose
+	/usr/bin printf readonly cd echo $(pwd)
+	x=1 && then export local echo export
+		then "$@" echo --verbose then "$@" readonly
+x=1 ${HOME} test test readonly && "$@" printf awk ${HOME} /usr/bin 2>/dev/null local
+		$(pwd) && export && echo readonly local $(pwd) ${HOME}
+		2>/dev/null export test test ${HOME} printf --verbose
+	cd 'quoted text' cd printf
+sed --verbose awk | && ${HOME} echo awk 2>/dev/null
+		"$1" echo export --verbose awk echo -eu |
+readonly awk --verbose ${HOME}
+	${HOME} $(pwd) cd "$@" | "$@" | grep echo local "$@" $(pwd) cd ${HOME}
+cd echo "$@" x=1 x=1 x=1 local x=1 --verbose && $(pwd) && 'quoted text'
+"$@" export awk x=1 done | awk $(pwd) ${HOME} $(pwd)
+	printf echo export $(pwd) export grep grep
+		export local /usr/bin /usr/bin then /usr/bin sed /usr/bin 2>/dev/null test
+	printf grep "$@" echo 'quoted text' $(pwd) 2>/dev/null test --verbose ${HOME} export
+sed && "$1" x=1 --verbose "$1"
+		x=1 grep printf sed x=1 -eu then
+	2>/dev/null then --verbose grep grep --verbose "$1" done ${HOME} awk 2>/dev/null
+		then 'quoted text' 'quoted text' "$1" -eu test done awk
+		x=1 --verbose export ${HOME} 'quoted text' "$@" --verbose printf export
+	${HOME} then local export export "$1" ${HOME} done printf -eu then
+--verbose printf 2>/dev/null 2>/dev/null x=1 done "$1" sed
+	then "$1" echo --verbose --verbose /usr/bin ${HOME}
+x=1 done "$@" "$1" done local x=1
+	&& then x=1 export readonly readonly then -eu "$1" then | readonly "$@" ${HOME}
+		test local test --verbose && done then
+awk && grep | awk export /usr/bin
+		local | local awk grep /usr/bin ${HOME} printf cd /usr/bin
+readonly --verbose sed test "$@" awk sed done cd
+sed echo "$1" /usr/bin -eu sed ${HOME} --verbose awk --verbose 'quoted text'
+awk export awk && done local -eu -eu "$@" export 2>/dev/null
+then readonly readonly && printf readonly --verbose | local
+		${HOME} sed then printf -eu
+		"$@" "$@" export readonly sed "$@" done echo | then "$1" grep echo
+"$@" local local sed grep done test x=1 readonly /usr/bin sed --verbose
+	local && test printf x=1 -eu 'quoted text'
+	-eu && grep echo 2>/dev/null test awk then
+done export $(pwd) $(pwd) "$@" test local test && test
+| grep cd awk $(pwd) $(pwd) local |
+export /usr/bin x=1 local printf && "$@" /usr/bin
+		| ${HOME} then x=1 done -eu readonly grep
+$(pwd) "$1" | export /usr/bin sed ${HOME} && then --verbose sed
+	'quoted text' export cd ${HOME} sed 2>/dev/null | grep | /usr/bin then cd ${HOME}
+	cd then "$@" sed printf /usr/bin grep cd cd readonly local local
+-eu /usr/bin --verbose test awk 2>/dev/null
+test && "$@" echo awk local local | test /usr/bin "$1" done awk then test awk
+	then done "$@" /usr/bin export readonly sed done | done test 'quoted text' "$@"
+	${HOME} 2>/dev/null "$1" cd "$@" $(pwd) --verbose $(pwd) awk
+		--verbose sed readonly
+	'quoted text' /usr/bin --verbose ${HOME}
+"$1" --verbose 'quoted text' awk echo then --verbose
+		--verbose --verbose local echo grep x=1 test sed ${HOME} printf | then $(pwd) printf
+/usr/bin done sed printf test cd -eu ${HOME} $(pwd) 'quoted text'
+		"$@" then $(pwd) awk done then echo
+		x=1 export cd $(pwd) $(pwd) local 2>/dev/null
+		then grep -eu readonly
+echo export 2>/dev/null
+echo cd export "$1" then printf --verbose printf 2>/dev/null --verbose echo ${HOME}
+cd 2>/dev/null | printf 2>/dev/null -eu local 'quoted text' 'quoted text' x=1
+		printf -eu test sed readonly -eu | ${HOME} "$1" /usr/bin printf sed x=1 local test
+	/usr/bin x=1 && local -eu 2>/dev/null | sed readonly done
+		&& test ${HOME} export "$1" "$1" $(pwd) "$@" echo
+/usr/bin grep awk echo cd x=1 $(pwd) /usr/bin
+| && -eu --verbose /usr/bin test 2>/dev/null x=1 local --verbose && "$1" x=1
+| printf /usr/bin x=1 then awk local 'quoted text' cd done --verbose
+	done "$@" printf test grep test "$@"
+done export grep printf export local sed "$1" --verbose awk
+		-eu | "$@" test echo ${HOME} /usr/bin --verbose
+		cd export 2>/dev/null --verbose
+	sed /usr/bin 'quoted text' x=1 awk readonly local
+		| export /usr/bin 'quoted text' sed awk awk
+	"$1" "$@" 2>/dev/null echo cd printf export
+sed && done $(pwd) x=1 && sed 2>/dev/null printf echo "$1" /usr/bin local
+	--verbose "$@" echo --verbose
+		'quoted text' printf "$1" done "$1" --verbose local $(pwd) then
+		export export $(pwd) && /usr/bin $(pwd) test $(pwd) grep
+/usr/bin export sed "$@" sed export | readonly cd echo awk export
+	cd sed readonly --verbose | echo && test --verbose local printf
+	test --verbose && printf ${HOME} echo echo echo "$1"
+		'quoted text' /usr/bin ${HOME} export $(pwd) awk readonly
+	| 'quoted text' then export awk /usr/bin ${HOME}
+	grep /usr/bin | local then echo --verbose sed local sed test export --verbose
+		test sed 'quoted text' then cd && $(pwd)
+		--verbose local 2>/dev/null "$@" -eu
+		echo "$@" awk && printf /usr/bin readonly cd --verbose export 2>/dev/null
+	test local "$1" "$@" sed sed echo grep && "$@" export 2>/dev/null
+		$(pwd) ${HOME} && && done $(pwd)
+"$1" "$1" grep "$1" | $(pwd) then 'quoted text' readonly | sed
+		echo ${HOME} /usr/bin test export export done
+done 'quoted text' grep
+	--verbose grep /usr/bin then | 'quoted text' printf
+		| test sed $(pwd) 2>/dev/null cd
+	&& then export $(pwd) 'quoted text' x=1 done "$1" export cd cd export
+	--verbose ${HOME} grep ${HOME} $(pwd) $(pwd) sed x=1 'quoted text'
+		then /usr/bin /usr/bin -eu "$@" x=1 /usr/bin
+	| $(pwd) | echo then awk && ${HOME}
+2>/dev/null x=1 -eu local local awk local x=1 printf && && echo printf
+	grep ${HOME} x=1 then "$1" | ${HOME} &&
+		export done "$@" echo export grep readonly cd echo "$@" "$@" && x=1 printf x=1 "$1"
+		done export $(pwd) --verbose ${HOME} awk 'quoted text' sed grep readonly echo
+	"$1" x=1 --verbose "$@" test "$1" 'quoted text'
+	"$@" then -eu && export test then done done 'quoted text' x=1 done
+		| local export test -eu x=1 cd "$@"
+	readonly readonly printf | $(pwd) 'quoted text' && printf
+-eu export /usr/bin done "$@"
+	export done printf 2>/dev/null export $(pwd)
+		sed | "$1" test cd readonly grep readonly
+	2>/dev/null done readonly local sed
+	test -eu 2>/dev/null readonly then then && $(pwd) then | cd 2>/dev/null
+"$1" done $(pwd) done "$1" --verbose
+		-eu done ${HOME} grep done x=1 grep 'quoted text' && grep sed local | /usr/bin
+	'quoted text' "$@" test 2>/dev/null
+		/usr/bin done echo then "$1" then "$@" echo then awk export local printf
+		${HOME} | sed then done echo printf
+	--verbose 'quoted text' -eu && grep --verbose --verbose "$1" && echo "$1"
+	printf local local && printf printf readonly x=1 /usr/bin 2>/dev/null
+&& | local echo local export
+readonly x=1 -eu $(pwd) --verbose
+	readonly "$1" done test /usr/bin sed sed sed x=1 -eu echo
+	x=1 printf grep $(pwd) done ${HOME} x=1 readonly 2>/dev/null sed $(pwd)
+		export -eu x=1 /usr/bin
+printf local cd && --verbose
+	then 2>/dev/null local | done "$1" | --verbose readonly
+		x=1 awk done echo printf readonly readonly
+/usr/bin test test printf cd done $(pwd) --verbose
+	'quoted text' awk ${HOME}
+grep /usr/bin printf export ${HOME} printf done -eu --verbose
+	local local echo 'quoted text' echo --verbose
+		/usr/bin | test "$1" done local -eu export test /usr/bin
+		2>/dev/null cd 'quoted text' $(pwd) x=1 /usr/bin printf 'quoted text'
+&& "$1" cd local -eu
+		sed local $(pwd) sed "$1" sed "$1" -eu export printf awk
+		x=1 cd "$@" echo x=1 awk
+	x=1 test test cd 2>/dev/null
+	${HOME} ${HOME} done "$@" x=1 grep 'quoted text' export
+	/usr/bin | readonly /usr/bin echo grep "$@" -eu grep --verbose |
+done sed "$1" 'quoted text' --verbose
+	/usr/bin $(pwd) --verbose export echo | -eu 'quoted text' grep
+--verbose "$1" "$1" done export sed awk local /usr/bin ${HOME} "$1"
+	local export local local && local sed grep cd -eu
+x=1 $(pwd) awk | local ${HOME} awk
+	grep test -eu 2>/dev/null test /usr/bin sed grep printf ${HOME}
+	cd /usr/bin readonly awk && $(pwd) grep "$@"
+		sed readonly cd "$@" | "$1" | test done 'quoted text'
+		${HOME} test "$@" 2>/dev/null
+export then $(pwd) ${HOME} "$1" x=1 | awk sed
+		awk "$@" readonly $(pwd) x=1 export grep done sed $(pwd) local
+&& local | -eu sed sed done echo test "$1" && export
+	echo test done printf ${HOME} /usr/bin printf x=1 sed printf | -eu
+	grep "$@" grep | && "$@" x=1 then "$@" && 2>/dev/null
+	done && then export printf
+		awk -eu grep echo sed
+	export awk then test sed "$1"
+done awk "$1" x=1 -eu local echo test local --verbose x=1 ${HOME}
+	local cd "$@" && x=1 "$1" | "$1" done
+done awk 'quoted text' ${HOME} sed && done ${HOME} --verbose
+		test awk echo && "$@" grep local grep
+		-eu local printf | && readonly $(pwd) then then $(pwd) local printf done "$1" $(pwd)
+awk local then "$@" 2>/dev/null awk
+	&& echo then local ${HOME}
+	printf $(pwd) printf -eu printf export 2>/dev/null then x=1 | x=1 'quoted text'
+	local && --verbose ${HOME} | x=1 /usr/bin --verbose 2>/dev/null
+	cd && printf then then "$1" "$@" sed -eu --verbose "$@" grep
+"$1" printf "$@" export readonly x=1 done "$@" "$1"
+	then cd $(pwd) test local
+grep test && printf then /usr/bin grep
+	readonly echo $(pwd) "$1" "$@" local $(pwd) readonly
+test | ${HOME} | 2>/dev/null && x=1 /usr/bin
+		${HOME} x=1 -eu 2>/dev/null printf export x=1
+'quoted text' --verbose "$1" local export "$@" /usr/bin test x=1 --verbose
+test done "$1" -eu 'quoted text' awk sed
+	export $(pwd) --verbose 'quoted text' --verbose "$1" printf sed cd "$@"
+	x=1 readonly done /usr/bin "$@" sed
+grep $(pwd) /usr/bin -eu awk $(pwd) export sed done "$@"
+then | x=1 --verbose "$1" "$@" x=1 echo readonly then grep $(pwd) && cd x=1 --verbose
+		readonly "$@" -eu then grep -eu grep -eu then && done
+	readonly && | | ${HOME} && export done then ${HOME} printf sed readonly
+	/usr/bin then "$1" 2>/dev/null
+	sed then done "$1" x=1 -eu echo
+x=1 -eu -eu done export sed --verbose grep /usr/bin sed /usr/bin 'quoted text'
+printf | readonly x=1 ${HOME} then then grep "$1" $(pwd) awk 'quoted text'
+cd readonly && then --verbose cd grep | --verbose done
+		${HOME} ${HOME} $(pwd) local readonly then -eu sed readonly 'quoted text'
+"$@" sed | done local -eu cd sed | test -eu | ${HOME} done | 2>/dev/null
+		then grep | | | test grep awk $(pwd)
+"$1" echo && cd then export | local $(pwd) export sed then
+${HOME} local test done local printf -eu "$@" x=1 test -eu
+	--verbose echo --verbose readonly ${HOME} $(pwd) 2>/dev/null -eu ${HOME} printf
+	readonly test $(pwd) echo | readonly
+'quoted text' echo local awk grep grep | $(pwd) readonly sed 2>/dev/null
+		'quoted text' readonly /usr/bin && export done cd awk then $(pwd) 2>/dev/null
+		grep echo /usr/bin sed echo done -eu && -eu "$1" done | cd "$1" local -eu printf
+		readonly 2>/dev/null test /usr/bin -eu x=1 "$1" |
+		cd cd $(pwd) printf "$1" "$1"
+		-eu local echo "$1" printf
+'quoted text' && test ${HOME} export test "$1" local grep test then export
+		awk cd ${HOME} then --verbose && 'quoted text'
+	"$@" && awk readonly export
+--verbose export 2>/dev/null then "$1" && grep cd then 2>/dev/null --verbose
+		-eu sed "$@" 'quoted text' ${HOME}
+		x=1 local ${HOME} done awk cd x=1 test --verbose cd printf x=1 2>/dev/null
+	grep sed "$@" done sed -eu awk 2>/dev/null grep 'quoted text'
+awk done $(pwd) printf printf test
+done ${HOME} "$1" then /usr/bin test "$1" x=1 local done local
+	/usr/bin | 'quoted text' 'quoted text'
+		sed "$1" done | grep "$@" echo 'quoted text'
+		"$1" -eu -eu x=1 /usr/bin 'quoted text' 2>/dev/null
+	then local awk 2>/dev/null 2>/dev/null "$1"
+done -eu | 2>/dev/null | 2>/dev/null x=1 2>/dev/null test | printf &&
+echo --verbose then local sed
+	readonly readonly sed done ${HOME} awk cd
+	/usr/bin "$1" readonly
+	export test $(pwd) ${HOME} 2>/dev/null ${HOME} && then "$@" x=1 export
+		${HOME} 2>/dev/null -eu cd done --verbose "$@" export then --verbose
+		then grep cd echo ${HOME} x=1 then printf && grep
+		2>/dev/null /usr/bin test $(pwd)
+	test cd then -eu test $(pwd) test export ${HOME} 'quoted text'
+2>/dev/null -eu $(pwd) | grep ${HOME} readonly cd local 2>/dev/null then
+${HOME} cd --verbose readonly "$@"
+test ${HOME} cd local
+	| "$1" "$@" then "$1" cd x=1 printf $(pwd)
+		${HOME} --verbose sed sed test 2>/dev/null --verbose
+	then -eu --verbose readonly done x=1 readonly awk | "$1"
+	x=1 'quoted text' then then
+export --verbose then then | x=1 -eu
+	$(pwd) "$@" --verbose /usr/bin "$1" awk local then $(pwd) "$1" echo -eu done
+		2>/dev/null sed --verbose
+		-eu grep printf 'quoted text' "$@" then 2>/dev/null sed awk echo
+		test local 'quoted text' then --verbose 2>/dev/null
+	readonly awk 2>/dev/null awk readonly export
+	echo export then ${HOME} awk "$1" 'quoted text' readonly
+		test done /usr/bin ${HOME} 2>/dev/null test export
+printf export echo done -eu /usr/bin done awk --verbose sed printf
+		grep --verbose | "$@" x=1 done local done ${HOME} && -eu echo local readonly awk
+printf local $(pwd) $(pwd) --verbose then then local printf echo
+	grep && export then done $(pwd) 'quoted text' "$1" x=1 -eu
+grep cd echo awk printf && awk done
+	done export "$@" grep ${HOME} readonly test printf "$1" x=1 "$1" awk
+grep x=1 x=1 test 2>/dev/null --verbose readonly x=1 'quoted text'
+		local $(pwd) then readonly awk sed x=1 readonly
+	local && "$@" 'quoted text' readonly 2>/dev/null
+	grep 2>/dev/null "$1" cd test printf readonly 'quoted text' cd
+'quoted text' printf -eu "$@"
+	--verbose awk cd x=1 test cd awk awk
+done test "$1" "$1" -eu 'quoted text' echo | readonly
+-eu readonly test -eu -eu sed | "$@" "$1" echo
+		--verbose -eu awk then "$1" -eu && x=1 "$@" printf /usr/bin
+	export awk -eu readonly
+	'quoted text' "$1" ${HOME}
+	sed $(pwd) sed "$@" 'quoted text' | grep cd 'quoted text'
+		cd /usr/bin echo export -eu -eu 2>/dev/null --verbose ${HOME} x=1 sed
+		-eu --verbose echo | awk awk awk done 2>/dev/null ${HOME}
+${HOME} | echo 2>/dev/null "$@" then test sed x=1 test $(pwd)
+		-eu test /usr/bin then
+		then cd -eu printf done | grep | sed cd && -eu export printf
+		grep /usr/bin "$@" -eu $(pwd) export
+/usr/bin x=1 /usr/bin sed 'quoted text'
+echo "$1" readonly ${HOME} local sed done -eu cd awk cd && -eu local
+		--verbose ${HOME} local done then printf grep
+${HOME} x=1 ${HOME} "$@" cd sed then printf /usr/bin ${HOME}
+	readonly sed 2>/dev/null -eu sed awk /usr/bin
+x=1 -eu cd echo 'quoted text' | printf
+	readonly awk 'quoted text' readonly
+	--verbose awk cd x=1 printf done done /usr/bin "$@"
+	$(pwd) && x=1 2>/dev/null test readonly
+		export "$1" -eu 2>/dev/null && | readonly export cd cd "$@"
+	echo awk 2>/dev/null test 'quoted text' echo x=1 awk done
+		export 2>/dev/null "$1" "$@" readonly -eu local printf
+		/usr/bin 2>/dev/null $(pwd) done
+	echo "$@" --verbose --verbose
+| printf cd grep sed /usr/bin
+		'quoted text' done --verbose 2>/dev/null /usr/bin ${HOME} done
+echo /usr/bin 2>/dev/null readonly done $(pwd) x=1 --verbose
+x=1 'quoted text' done $(pwd) then
+		then | "$1" readonly 'quoted text' test local printf
+		--verbose readonly "$@" --verbose -eu && grep | "$@" local | 2>/dev/null
+		grep local echo echo $(pwd) $(pwd)
+	-eu export cd --verbose "$1" && 'quoted text'
+readonly local done "$@" 2>/dev/null readonly readonly printf awk local echo
+	export done local export $(pwd) ${HOME}
+		${HOME} awk echo "$1" grep sed "$@" --verbose 'quoted text' readonly grep done readonly
+		echo local then readonly
+grep 'quoted text' 2>/dev/null sed 2>/dev/null readonly printf
+		then --verbose -eu $(pwd) then export
+		local ${HOME} test --verbose
+		printf 2>/dev/null $(pwd) cd 2>/dev/null grep ${HOME}
+		-eu readonly awk test 'quoted text'
+echo | && $(pwd) && then --verbose "$1" 'quoted text' -eu done echo test test cd
+	/usr/bin | x=1 && 'quoted text' export
+		printf $(pwd) printf readonly then sed test ${HOME} 'quoted text' 2>/dev/null
+		x=1 done ${HOME} "$@" export "$1"
+export awk 'quoted text' test --verbose 'quoted text' "$1" ${HOME} awk
+		"$@" ${HOME} cd -eu x=1 echo &&
+	"$@" readonly /usr/bin readonly export
+	-eu /usr/bin then && done --verbose awk test local "$1" /usr/bin readonly
+		$(pwd) sed then -eu "$1" test "$1" grep ${HOME}
+test export /usr/bin "$1" local export sed --verbose "$1" x=1
+local | then readonly local x=1 test test x=1 x=1 $(pwd)
+| | --verbose sed test cd | then then echo
+sed "$@" && printf "$1" local echo 'quoted text' "$@" ${HOME} "$1" ${HOME} echo
+--verbose "$1" then export
+grep local then "$1"
+	"$@" -eu export done readonly ${HOME} && readonly
+		printf export echo -eu 2>/dev/null 2>/dev/null | sed --verbose
+	2>/dev/null 'quoted text'
+-eu 'quoted text' grep
+	done awk ${HOME} && test grep export && 2>/dev/null -eu --verbose readonly
+		-eu "$1" cd | ${HOME} cd readonly && "$@" -eu -eu 'quoted text'
+x=1 "$@" $(pwd) x=1 cd ${HOME} printf sed | x=1
+		printf && export x=1 then echo done --verbose
+export then /usr/bin test ${HOME} ${HOME}
+/usr/bin "$@" 2>/dev/null "$1" /usr/bin cd sed export 2>/dev/null
+		then && export 2>/dev/null grep ${HOME} local then echo
+		export sed --verbose awk printf printf then
+grep "$@" local "$@" grep "$1"
+	done test echo /usr/bin export
+	done $(pwd) echo 'quoted text' 2>/dev/null awk awk readonly
+	&& readonly 'quoted text' sed
+	awk -eu "$@" "$1" echo ${HOME} x=1 export printf grep "$@" "$1" done
+	printf export x=1 && && -eu then done "$1" ${HOME} done ${HOME} test
+	then -eu printf | echo then sed "$@" then local then grep $(pwd)
+		sed test && && grep /usr/bin awk ${HOME} test then --verbose
+	awk awk cd 2>/dev/null ${HOME} x=1 ${HOME} then | "$1" then
+	2>/dev/null x=1 echo
+		&& | test && ${HOME} printf -eu | grep
+	export -eu "$1" --verbose awk echo "$1" 'quoted text' printf
+printf done "$1" 2>/dev/null export
+"$@" "$@" ${HOME} --verbose $(pwd) && "$@" "$1" test && ${HOME}
+		awk 'quoted text' cd -eu printf $(pwd) echo readonly
+	readonly export $(pwd) then ${HOME} | --verbose ${HOME} sed && printf grep
+	test ${HOME} x=1 && grep 'quoted text' done 2>/dev/null local readonly
+"$@" --verbose -eu && /usr/bin | x=1 local awk grep awk then
+		--verbose readonly 'quoted text' test $(pwd) local cd echo sed
+	printf echo ${HOME} ${HOME} awk then echo awk 'quoted text'
+	-eu awk cd --verbose &&
+	local then then --verbose -eu -eu "$@" -eu cd x=1 sed
+	then export then sed | 2>/dev/null
+		/usr/bin awk sed "$1" export ${HOME} test ${HOME} | | ${HOME}
+		&& readonly x=1 echo grep
+awk done | export "$@" ${HOME} x=1 grep $(pwd) 'quoted text' && && ${HOME}
+x=1 cd test --verbose -eu "$1" sed
+		--verbose "$1" x=1 local
+readonly echo -eu readonly sed 'quoted text' && ${HOME}
+2>/dev/null --verbose test
+		local sed -eu echo printf export x=1
+		export --verbose ${HOME} "$1" "$@"
+	$(pwd) test 'quoted text' local $(pwd) cd "$@" -eu --verbose
+	2>/dev/null done grep -eu echo && | $(pwd) awk /usr/bin "$1"
+		readonly -eu printf awk 2>/dev/null readonly -eu export /usr/bin readonly
+	"$@" | awk cd 'quoted text' done | 2>/dev/null
+	sed cd -eu "$1" $(pwd) --verbose x=1 readonly | then sed --verbose test
+		readonly && 2>/dev/null grep --verbose "$@" awk test 2>/dev/null sed --verbose
+	| 2>/dev/null "$1" readonly grep local printf ${HOME} 2>/dev/null
+		echo 'quoted text' awk export sed
+		"$@" readonly "$1" ${HOME} sed
+grep && /usr/bin echo | echo ${HOME} | 2>/dev/null cd x=1
+	printf awk && ${HOME} local
+		"$1" done done -eu -eu echo $(pwd) ${HOME} x=1 'quoted text' cd /usr/bin
+awk export sed $(pwd) then --verbose "$@" 'quoted text' echo ${HOME}
+		$(pwd) x=1 export 2>/dev/null 'quoted text' ${HOME} printf test $(pwd)
+&& done awk 2>/dev/null "$1" grep then grep readonly 'quoted text'
+	--verbose --verbose echo "$1" "$1" 2>/dev/null "$1" then then && export $(pwd)
+		cd 2>/dev/null $(pwd) --verbose
+echo -eu && export 2>/dev/null | "$1" "$1" export readonly $(pwd) printf done
+"$1" --verbose --verbose 'quoted text' $(pwd) done
+		test sed sed then --verbose printf "$1" ${HOME} "$@" local
+test printf --verbose x=1 && local cd && | then then then done
+		-eu awk export "$@" printf
+echo export | "$1" 2>/dev/null done grep sed "$1" cd x=1 awk | 2>/dev/null
+${HOME} echo --verbose x=1 && sed /usr/bin printf awk sed readonly grep done sed
+	done local sed "$1" -eu test | done ${HOME} 2>/dev/null grep
+	echo echo -eu sed readonly echo -eu test /usr/bin sed x=1 grep $(pwd) printf
+"$@" && sed sed export --verbose /usr/bin
+test printf 'quoted text' | 2>/dev/null "$@" awk x=1 --verbose
+-eu test /usr/bin readonly local $(pwd) test --verbose cd
+		sed && --verbose 'quoted text' | awk | test 'quoted text'
+readonly export "$@" printf grep local sed grep ${HOME}
+	local /usr/bin x=1 printf cd $(pwd) --verbose printf printf
+printf readonly $(pwd) $(pwd) && /usr/bin
+	done ${HOME} -eu export "$@" /usr/bin
+awk "$@" cd cd awk test 2>/dev/null "$@"
+$(pwd) cd export local grep local local echo local awk "$@" &&
+		"$1" test test --verbose test test 2>/dev/null -eu
+/usr/bin && 2>/dev/null ${HOME} grep /usr/bin
+		"$1" && "$@" 'quoted text'
+	readonly 'quoted text' x=1 local
+awk x=1 /usr/bin grep /usr/bin printf readonly && awk /usr/bin local test
+		grep $(pwd) test echo "$@" $(pwd) local cd x=1 --verbose test
+cd readonly 2>/dev/null $(pwd) "$1" export printf local export
+		readonly $(pwd) local "$@"
+echo x=1 | /usr/bin | && ${HOME}
+		${HOME} ${HOME} grep test readonly
+		cd done ${HOME} && test awk && readonly | $(pwd)
+	'quoted text' "$1" 'quoted text' printf grep readonly awk
+		printf export printf 'quoted text' ${HOME}
+printf -eu | export printf "$@" grep local readonly awk then
+/usr/bin echo export cd -eu grep "$1" $(pwd)
+	"$1" echo local test echo printf x=1 --verbose cd export 'quoted text'
+	test /usr/bin | -eu -eu test
+		done cd then "$@" echo grep -eu ${HOME}
+		then | then --verbose --verbose x=1 -eu --verbose
+test | local | "$1" | 'quoted text' -eu $(pwd) sed local cd && grep echo local
+		grep awk awk x=1 export
+	export then cd "$@" echo | printf /usr/bin test ${HOME} printf
+		x=1 -eu && cd ${HOME} | local then then "$1" readonly done grep awk sed | && |
+local 'quoted text' sed -eu "$@" "$@" awk export done local echo printf printf "$1"
+	test export readonly awk awk $(pwd) export sed test $(pwd) 'quoted text' && 'quoted text'
@@ -0,0 +1,2001 @@
+&& -eu "$@" | cd then awk --verbose awk grep local sed "$@"
+		awk --verbose "$1" echo cd done "$@" local x=1 -eu | awk && /usr/bin export
+		"$1" local -eu then /usr/bin export | -eu "$1" 2>/dev/null -eu printf
+sed grep ${HOME} x=1 | export done cd local /usr/bin cd 'quoted text'
+		local then $(pwd) "$1" readonly --verbose x=1 | && awk /usr/bin
+	$(pwd) export -eu test /usr/bin $(pwd) 2>/dev/null 'quoted text'
+	readonly done awk echo "$1" local && echo then "$1" x=1 done sed ${HOME}
+		export local awk printf | -eu done "$@" /usr/bin test ${HOME}
+	$(pwd) "$@" && 2>/dev/null
+	"$@" "$1" "$1" export "$@" 'quoted text' x=1 x=1
+$(pwd) $(pwd) && readonly
+		echo cd 'quoted text' 'quoted text'
+		then 'quoted text' /usr/bin
+	cd -eu done printf | "$@"
+		awk --verbose printf $(pwd) 'quoted text' -eu $(pwd) cd -eu readonly readonly
+local export 2>/dev/null
+	"$1" -eu --verbose --verbose | test
+	awk then echo printf | /usr/bin readonly -eu ${HOME} -eu readonly grep local $(pwd)
+	$(pwd) awk export && grep sed $(pwd)
+readonly 'quoted text' x=1 'quoted text' $(pwd) "$@" x=1 then | /usr/bin cd
+		&& sed | && echo --verbose | then 'quoted text' -eu then readonly
+		awk "$1" then $(pwd) /usr/bin ${HOME} 2>/dev/null
+export $(pwd) $(pwd) test && then | then local cd ${HOME} readonly
+printf | ${HOME} ${HOME} x=1 sed --verbose printf
+		--verbose awk awk /usr/bin "$1" awk "$1"
+	awk /usr/bin --verbose sed awk export ${HOME} then test x=1 | && --verbose sed
+		export cd printf "$@" && echo awk "$@" "$@"
+	/usr/bin $(pwd) "$1" "$1" awk echo /usr/bin grep x=1 grep readonly
+	"$@" echo -eu x=1 --verbose done echo grep "$1" cd ${HOME}
+		done local cd ${HOME} -eu -eu
+	printf | 'quoted text' readonly x=1 x=1 readonly
+| $(pwd) ${HOME} $(pwd) cd
+grep 'quoted text' $(pwd) printf echo "$1" 2>/dev/null --verbose "$@" done /usr/bin
+2>/dev/null ${HOME} printf -eu then
+	${HOME} $(pwd) | grep /usr/bin 2>/dev/null "$1" /usr/bin ${HOME} export
+		&& $(pwd) | sed --verbose sed local test 'quoted text' local sed 'quoted text'
+'quoted text' done /usr/bin
+		printf /usr/bin | 2>/dev/null 2>/dev/null echo sed then echo 'quoted text'
+x=1 then "$1" awk "$@" grep "$1" $(pwd) 'quoted text' | | printf grep -eu | ${HOME}
+/usr/bin test done awk test cd local /usr/bin local export awk grep cd awk
+awk test printf done printf x=1 $(pwd)
+/usr/bin then $(pwd) -eu x=1 sed && export export "$@" printf $(pwd) export local
+		| 2>/dev/null $(pwd) export | 'quoted text'
+		echo x=1 "$1" awk x=1 $(pwd) sed local done 'quoted text' && test
+		local echo | | x=1 then sed "$@" $(pwd) test x=1 grep $(pwd) ${HOME}
+done "$1" "$@" then /usr/bin export sed
+export "$@" "$1" readonly local 2>/dev/null
+&& export readonly echo 2>/dev/null
+cd 2>/dev/null "$1" $(pwd) /usr/bin
+		| export grep export "$1" export export
+	-eu test /usr/bin $(pwd) ${HOME}
+		grep 'quoted text' $(pwd) sed sed echo grep export awk
+		$(pwd) local then test printf | awk test sed "$1" awk "$1" sed cd done "$1"
+x=1 awk | test $(pwd) 'quoted text'
+| sed export "$@" "$@" sed $(pwd)
+		"$1" "$1" readonly 'quoted text' /usr/bin test /usr/bin echo $(pwd) export && &&
+	sed ${HOME} 2>/dev/null $(pwd) --verbose ${HOME} readonly
+		-eu && then local x=1 export grep "$1" 2>/dev/null 'quoted text' local
+$(pwd) 'quoted text' && grep test done then 'quoted text'
+	done "$@" ${HOME} "$1" cd then export awk
+sed x=1 -eu cd /usr/bin test readonly local
+		"$1" | x=1 && -eu echo echo 'quoted text' then printf
+	2>/dev/null /usr/bin 2>/dev/null -eu
+	| --verbose grep 'quoted text' awk "$1" x=1 local $(pwd) cd readonly sed export
+--verbose readonly 'quoted text' 'quoted text' -eu
+		x=1 local /usr/bin ${HOME} && x=1 test cd ${HOME} sed "$1" echo
+/usr/bin && local -eu then test cd 'quoted text' then printf
+echo local && $(pwd) awk 2>/dev/null x=1
+	2>/dev/null test readonly $(pwd) local echo
+		| local | 'quoted text' 'quoted text' ${HOME} then echo
+	${HOME} grep $(pwd) $(pwd) $(pwd) "$@" export echo awk cd cd local readonly
+		readonly sed ${HOME} 2>/dev/null echo export export x=1 | && /usr/bin
+$(pwd) 2>/dev/null echo /usr/bin grep "$1" | 'quoted text' -eu test
+	echo $(pwd) cd && | "$@" then
+then sed "$@" echo export $(pwd) && export "$1" test local export && ${HOME}
+	-eu 'quoted text' printf "$1" "$@" local 2>/dev/null "$@"
+local ${HOME} done 'quoted text'
+-eu cd | /usr/bin test printf && --verbose local /usr/bin
+	readonly sed 'quoted text' done export test $(pwd) sed grep -eu -eu $(pwd) awk
+	2>/dev/null && $(pwd) "$@" "$1" echo -eu | /usr/bin done
+export sed && sed readonly -eu 2>/dev/null
+	local | --verbose printf --verbose 'quoted text' -eu echo
+		$(pwd) then done readonly awk readonly 'quoted text'
+		"$@" export awk ${HOME} printf ${HOME} x=1 export
+	'quoted text' "$@" ${HOME} "$1" then && local readonly
+	test "$1" echo export -eu readonly grep awk /usr/bin
+then grep done -eu | local awk "$1" $(pwd) /usr/bin grep printf done 'quoted text'
+	'quoted text' ${HOME} --verbose
+	${HOME} x=1 local 'quoted text' "$1" then "$1" export
+	${HOME} echo && export 2>/dev/null
+		'quoted text' && grep then $(pwd) test
+	| -eu --verbose ${HOME} printf export && 2>/dev/null 2>/dev/null
+sed readonly ${HOME} --verbose done $(pwd) then
+'quoted text' -eu printf 2>/dev/null
+	"$@" $(pwd) $(pwd) done /usr/bin cd awk test grep cd 'quoted text'
+		test grep "$@" grep printf
+readonly $(pwd) echo /usr/bin $(pwd) 'quoted text' $(pwd) ${HOME} "$1" $(pwd)
+awk ${HOME} sed sed grep test
+/usr/bin export 2>/dev/null sed "$1" grep
+	$(pwd) | --verbose then
+		test x=1 $(pwd) ${HOME} done x=1 local ${HOME} | 2>/dev/null --verbose --verbose
+local done x=1 "$1" /usr/bin | ${HOME} awk -eu x=1 2>/dev/null
+export export grep "$@"
+	"$@" echo export --verbose grep | echo && &&
+	'quoted text' | ${HOME} echo "$@" echo grep --verbose 'quoted text' $(pwd)
+echo done grep grep "$1" ${HOME} 2>/dev/null
+	"$@" readonly then $(pwd) "$@" local export | awk x=1 then readonly 'quoted text'
+		done && sed 2>/dev/null --verbose $(pwd) | done export | grep sed x=1 cd
+	"$@" /usr/bin "$@" /usr/bin grep cd $(pwd) export awk then then grep grep
+		"$1" && local done echo &&
+	export test awk --verbose grep $(pwd)
+	-eu printf ${HOME} test
+"$1" --verbose export then $(pwd) awk "$1"
+		awk | ${HOME} sed -eu done cd printf
+		echo | grep done -eu done --verbose printf 'quoted text' 2>/dev/null "$@" 2>/dev/null
+	test export awk --verbose && awk -eu 2>/dev/null test --verbose ${HOME} grep sed
+	then | ${HOME} --verbose ${HOME} done done
+		echo 'quoted text' && 'quoted text' grep -eu &&
+	| -eu x=1 cd | -eu echo done /usr/bin x=1 done 'quoted text'
+	${HOME} x=1 sed 2>/dev/null test then --verbose --verbose done $(pwd) 'quoted text'
+then && cd sed /usr/bin $(pwd) export x=1 done readonly grep
+--verbose sed awk "$1" then echo then printf -eu export local && then
+		sed "$1" 2>/dev/null 'quoted text' readonly
+	grep "$1" local sed x=1 printf grep 2>/dev/null 2>/dev/null
+local -eu 'quoted text' echo readonly --verbose test 2>/dev/null x=1
+		--verbose local | 2>/dev/null
+-eu --verbose sed 2>/dev/null | export ${HOME} test done --verbose
+then readonly -eu test awk awk ${HOME} ${HOME}
+		then readonly local --verbose && done "$1" done sed test awk awk
+local "$1" grep awk then echo "$1" --verbose
+--verbose sed "$@" grep sed 2>/dev/null $(pwd) done echo awk grep
+&& awk "$1" $(pwd) ${HOME} --verbose "$@" /usr/bin 2>/dev/null done
+		| -eu readonly local "$1" ${HOME} awk sed 2>/dev/null
+		/usr/bin /usr/bin /usr/bin -eu local | -eu local "$1" printf $(pwd) done
+		readonly /usr/bin 'quoted text' grep "$@" cd awk ${HOME} | $(pwd) $(pwd) -eu x=1
+	sed ${HOME} grep then then echo done grep 2>/dev/null "$@" done 'quoted text'
+	test awk /usr/bin readonly $(pwd) --verbose
+	| 2>/dev/null test | | --verbose --verbose cd awk printf --verbose
+/usr/bin local test | ${HOME} sed /usr/bin
+printf && -eu sed then then printf /usr/bin "$@" readonly
+	/usr/bin test readonly echo then grep local && 2>/dev/null 2>/dev/null
+	grep 'quoted text' "$1"
+	-eu | local echo echo x=1 then printf
+		| x=1 printf grep "$@" 2>/dev/null $(pwd)
+	"$1" "$@" awk then awk sed && printf /usr/bin -eu x=1 awk test
+	done $(pwd) readonly | export $(pwd) 'quoted text'
+		'quoted text' then 2>/dev/null done 'quoted text' 2>/dev/null test && cd readonly
+"$@" "$@" 'quoted text' cd grep && "$@" |
+		local && /usr/bin "$1" $(pwd) "$1" --verbose "$@" echo "$1" --verbose
+		test ${HOME} --verbose $(pwd) then --verbose "$1" &&
+	export $(pwd) -eu $(pwd) 2>/dev/null -eu 2>/dev/null | local 'quoted text'
+readonly printf x=1 done done x=1
+		test 'quoted text' "$@" done 'quoted text' echo cd 'quoted text' test printf
+	"$@" echo 2>/dev/null $(pwd) awk done 'quoted text'
+	| printf /usr/bin printf readonly export | /usr/bin
+"$1" /usr/bin test 'quoted text' /usr/bin done test awk export
+	grep grep x=1 && $(pwd) --verbose x=1 export $(pwd) sed && "$1" grep
+'quoted text' 'quoted text'
+local && awk readonly | export done export then cd "$1"
+/usr/bin 2>/dev/null readonly readonly |
+echo "$@" /usr/bin | local "$@" printf
+done printf -eu /usr/bin --verbose echo && printf /usr/bin 2>/dev/null
+		echo local -eu 'quoted text' export grep -eu ${HOME} local --verbose
+	--verbose readonly && "$@" $(pwd) test
+		$(pwd) 2>/dev/null "$@" "$1" sed /usr/bin grep readonly sed
+		echo --verbose readonly readonly "$1" awk $(pwd)
+/usr/bin sed -eu x=1 grep readonly --verbose 'quoted text' local done
+echo $(pwd) ${HOME} x=1 printf awk grep export
+	&& test /usr/bin awk --verbose $(pwd) --verbose 'quoted text' export -eu $(pwd)
+$(pwd) readonly test --verbose readonly test --verbose 2>/dev/null then
+	"$@" awk 'quoted text' printf 2>/dev/null export
+	x=1 -eu local sed 'quoted text' "$1"
+${HOME} printf --verbose cd 'quoted text'
+	${HOME} /usr/bin local grep local /usr/bin 'quoted text'
+		--verbose -eu grep --verbose
+		2>/dev/null cd --verbose test && cd done sed && sed
+$(pwd) /usr/bin "$1" local local
+"$1" --verbose sed x=1 && ${HOME} printf ${HOME} -eu local --verbose readonly cd
+	then echo test grep printf test readonly "$@" printf
+printf x=1 readonly awk "$@" 2>/dev/null printf 'quoted text'
+export "$@" readonly 'quoted text' "$@" /usr/bin export cd readonly echo export
+		local x=1 done printf awk readonly printf 'quoted text' then done echo "$@"
+awk x=1 "$1" printf $(pwd) $(pwd) awk ${HOME} "$1" | grep echo sed x=1 sed | |
+	$(pwd) test sed ${HOME} && awk "$@" "$@" export -eu grep done
+		x=1 sed echo awk "$1" local 'quoted text'
+		sed sed awk cd "$1" then
+		local readonly export $(pwd) /usr/bin ${HOME} awk "$@" "$1" echo
+	x=1 done cd $(pwd) -eu "$@"
+		test done done $(pwd) ${HOME} echo "$1" grep printf
+grep --verbose readonly local printf
+		/usr/bin export 'quoted text' then awk local "$1" export "$1"
+"$@" echo $(pwd) test echo grep 'quoted text'
+'quoted text' export && /usr/bin /usr/bin
+	$(pwd) test "$@" x=1 $(pwd) 2>/dev/null awk --verbose export then then | export
+		printf printf readonly 'quoted text' cd done --verbose | echo /usr/bin
+		'quoted text' /usr/bin 2>/dev/null
+	'quoted text' export && x=1 sed x=1 test "$1" export printf
+		"$1" printf export echo cd && ${HOME} done sed --verbose "$1" $(pwd)
+readonly cd printf "$@" "$1" ${HOME} /usr/bin x=1 2>/dev/null "$@" 2>/dev/null
+grep | local $(pwd) && /usr/bin local test x=1 'quoted text' cd then
+sed "$1" --verbose done test --verbose readonly test awk --verbose awk
+	sed | -eu ${HOME} local awk 2>/dev/null grep printf ${HOME}
+then grep sed 2>/dev/null readonly printf | --verbose done printf
+	done /usr/bin echo /usr/bin echo test printf
+		cd sed | -eu "$1" "$@" /usr/bin --verbose readonly readonly /usr/bin ${HOME}
+	2>/dev/null $(pwd) awk $(pwd) export
+		'quoted text' | ${HOME} -eu
+		-eu ${HOME} readonly echo awk
+		| "$@" | --verbose printf printf
+		local "$1" $(pwd) /usr/bin "$@" 'quoted text'
+	/usr/bin | "$@" test readonly cd x=1 awk
+${HOME} x=1 awk test then && cd local sed
+echo local /usr/bin --verbose /usr/bin
+	$(pwd) awk local -eu local x=1 "$1" export
+	done done echo ${HOME} cd cd 2>/dev/null echo 2>/dev/null "$@" then $(pwd)
+	&& local | "$1" printf readonly
+		echo /usr/bin printf -eu done /usr/bin readonly
+	readonly x=1 printf test cd cd grep echo readonly printf
+		/usr/bin test /usr/bin test /usr/bin grep test test cd
+	then readonly ${HOME} 2>/dev/null --verbose test grep echo
+		local sed /usr/bin /usr/bin
+cd export local -eu -eu export sed readonly awk && -eu
+		| $(pwd) test grep $(pwd) ${HOME} 'quoted text' printf sed ${HOME} $(pwd)
+		${HOME} 'quoted text' cd then done
+	echo && awk "$1" then 'quoted text'
+		test ${HOME} echo -eu then &&
+"$1" ${HOME} && done printf x=1 ${HOME} --verbose
+		echo -eu local | $(pwd) then sed awk -eu -eu x=1
+		readonly 2>/dev/null -eu 2>/dev/null -eu -eu done then then
+	cd --verbose /usr/bin done echo printf x=1 awk awk
+	cd "$1" local readonly "$@" local cd "$1" grep --verbose
+--verbose x=1 echo "$@" -eu
+	--verbose x=1 && local sed 'quoted text' $(pwd) && 2>/dev/null
+		--verbose local && done done --verbose
+${HOME} ${HOME} $(pwd) /usr/bin
+	"$@" | --verbose /usr/bin
+		local "$1" x=1 cd --verbose
+readonly /usr/bin printf ${HOME} | "$1" echo echo test
+'quoted text' ${HOME} test x=1 local echo "$@" 2>/dev/null
+	$(pwd) "$1" export echo grep sed $(pwd) sed
+		cd "$@" printf test export && local "$@" | then readonly "$1" cd && /usr/bin |
+		grep "$1" local $(pwd) printf grep "$@" grep done -eu 'quoted text' &&
+	then echo then local 'quoted text' printf awk printf
+	-eu 'quoted text' test ${HOME}
+		/usr/bin echo "$@" ${HOME} done echo then ${HOME} local
+--verbose grep $(pwd) | then export awk grep --verbose then readonly awk $(pwd)
+		local --verbose sed -eu echo 'quoted text' local awk sed |
+	2>/dev/null cd then test printf -eu
+2>/dev/null && 'quoted text' /usr/bin cd 2>/dev/null x=1
+	grep | sed awk | readonly | --verbose x=1
+	$(pwd) then then ${HOME} export printf local
+	local -eu awk | printf -eu export printf printf printf $(pwd)
+	'quoted text' sed grep x=1 sed grep
+		"$@" done /usr/bin sed "$@" | "$1" local &&
+"$@" sed /usr/bin -eu test printf | 2>/dev/null && x=1 then 2>/dev/null
+&& test test sed readonly echo cd && $(pwd) local local -eu && && local
+		then sed --verbose sed local cd "$@" awk local printf
+		2>/dev/null 'quoted text' 'quoted text'
+--verbose printf "$1" readonly
+		'quoted text' awk test cd x=1 echo cd --verbose
+	--verbose readonly && done export /usr/bin 'quoted text'
+	done cd --verbose test --verbose
+2>/dev/null -eu x=1 ${HOME}
+| "$1" x=1 2>/dev/null printf | -eu ${HOME} "$@" export /usr/bin
+	readonly then test $(pwd) awk | | readonly 2>/dev/null
+2>/dev/null $(pwd) readonly x=1 readonly 'quoted text' cd printf cd echo | | done
+	then 'quoted text' && && 'quoted text' readonly
+'quoted text' -eu && echo
+		--verbose ${HOME} then grep cd echo
+&& "$@" "$1" && | cd export
+		2>/dev/null readonly -eu "$1"
+readonly local -eu printf -eu "$@" x=1 x=1 &&
+		-eu cd 'quoted text' sed awk
+awk "$1" test "$@" grep "$1" /usr/bin grep then grep $(pwd) 2>/dev/null -eu local
+		"$@" grep grep $(pwd) grep ${HOME} && then x=1 done
+	--verbose ${HOME} 'quoted text' awk "$1" readonly cd -eu cd "$@" grep "$1" | |
+export local done "$1" grep
+-eu printf grep -eu echo local grep grep /usr/bin grep then done "$1" local
+	"$@" done ${HOME} local "$1" then
+then x=1 echo $(pwd) $(pwd) -eu "$@" "$1" sed 'quoted text' printf awk -eu "$1"
+		-eu ${HOME} then "$1" done "$@" grep ${HOME}
+		"$@" 2>/dev/null "$1" "$@" /usr/bin printf
+		${HOME} then readonly grep printf then done $(pwd) 'quoted text' $(pwd) | 'quoted text'
+		readonly 'quoted text' cd --verbose x=1
+		$(pwd) grep printf $(pwd) readonly readonly readonly
+$(pwd) /usr/bin test x=1 | printf "$@" sed grep
+		echo 2>/dev/null "$@" awk "$1" grep $(pwd)
+		sed sed then 'quoted text' --verbose readonly -eu grep done
+awk | grep sed export "$@" awk $(pwd) awk /usr/bin printf local cd done
+	awk done ${HOME} awk "$1" grep grep "$1"
+awk cd "$1" grep printf x=1 x=1 2>/dev/null cd
+-eu printf "$1" echo done | export grep && local
+$(pwd) test "$1" x=1 sed ${HOME} test test | printf -eu readonly
+$(pwd) then "$1" | test $(pwd) then -eu printf 'quoted text'
+then -eu echo --verbose 2>/dev/null export then readonly
+	/usr/bin -eu local printf --verbose $(pwd) then export x=1 2>/dev/null
+"$@" "$1" "$1" printf
+readonly | echo cd local --verbose -eu
+	2>/dev/null x=1 local 'quoted text'
+	$(pwd) printf ${HOME} then local
+	sed ${HOME} then 'quoted text'
+printf readonly awk done printf
+	"$1" grep then --verbose | "$1" sed /usr/bin export --verbose "$@" grep /usr/bin
+		sed x=1 'quoted text' 2>/dev/null sed then
+	$(pwd) "$@" x=1 | 'quoted text' "$1" 2>/dev/null local grep --verbose
+	readonly 2>/dev/null | && then /usr/bin $(pwd)
+	cd local -eu readonly then ${HOME} -eu && | printf x=1 readonly then awk --verbose
+	sed printf echo /usr/bin done "$@" /usr/bin awk | 2>/dev/null
+"$@" $(pwd) $(pwd) awk export 'quoted text'
+	/usr/bin grep export awk done echo && sed then ${HOME} | --verbose --verbose
+	done printf 2>/dev/null && printf sed
+readonly -eu sed ${HOME}
+	cd && local $(pwd) -eu /usr/bin $(pwd) done && -eu grep local awk /usr/bin then
+local grep | && local local ${HOME} -eu sed readonly readonly --verbose ${HOME}
+"$@" x=1 2>/dev/null done export printf $(pwd) grep && echo sed awk --verbose
+	done x=1 test x=1 $(pwd) then "$@" "$1" "$1" test x=1 local test done
+	grep 2>/dev/null | test | test export 'quoted text'
+	local readonly grep -eu "$1" ${HOME} /usr/bin | then && then echo test local
+	/usr/bin readonly | 2>/dev/null export -eu done readonly
+	"$1" "$1" $(pwd) grep readonly --verbose 'quoted text' && awk done
+'quoted text' grep "$@" 2>/dev/null --verbose
+${HOME} then $(pwd) | local ${HOME} x=1 $(pwd) export
+		/usr/bin printf cd $(pwd) /usr/bin | local
+${HOME} export -eu then grep echo $(pwd)
+		cd 2>/dev/null test test then
+	local echo awk readonly && 2>/dev/null
+	2>/dev/null cd | "$1" "$1" test "$@" 2>/dev/null done echo local
+x=1 -eu export | x=1 && printf then
+	"$1" printf -eu $(pwd) then -eu -eu then $(pwd)
+		'quoted text' -eu sed /usr/bin then cd export $(pwd) $(pwd)
+		'quoted text' -eu then test && test printf sed cd export local
+readonly | grep $(pwd) test "$1" "$1" test grep echo done --verbose
+		$(pwd) /usr/bin 'quoted text'
+	"$1" ${HOME} local readonly ${HOME} | echo 'quoted text' ${HOME} export 'quoted text'
+	-eu | ${HOME} grep 'quoted text' printf ${HOME} test
+awk 'quoted text' ${HOME} then --verbose /usr/bin export 'quoted text'
+	printf 'quoted text' printf done grep test 'quoted text'
+		"$1" grep grep local test /usr/bin
+		done 'quoted text' grep | sed grep 2>/dev/null ${HOME} ${HOME} 2>/dev/null 'quoted text'
+	then test "$1" -eu "$@" cd
+	"$1" 2>/dev/null sed "$1" $(pwd) "$1" done ${HOME}
+		readonly cd ${HOME} x=1 done printf readonly |
+	| then local "$1" cd test
+export cd x=1 'quoted text' grep
+	"$1" grep printf done "$1" ${HOME}
+printf grep && cd | printf && cd sed
+2>/dev/null echo test export "$@" done && local readonly "$@" x=1 export
+--verbose 2>/dev/null "$1" --verbose export test done readonly cd export
+	test test x=1 /usr/bin readonly local done test && &&
+	grep $(pwd) then $(pwd)
+"$@" x=1 printf awk grep done /usr/bin done /usr/bin 'quoted text'
+	$(pwd) readonly sed done "$1" /usr/bin awk awk 'quoted text'
+	sed sed "$@" done 'quoted text' awk "$@" sed awk -eu
+		done -eu 2>/dev/null
+		${HOME} cd "$@" -eu "$@" ${HOME} 'quoted text' --verbose echo cd
+		done awk readonly cd $(pwd) local $(pwd) then -eu -eu
+	printf /usr/bin readonly 2>/dev/null 2>/dev/null
+	&& export awk ${HOME} cd cd --verbose grep 'quoted text' then cd
+		2>/dev/null test "$@" /usr/bin $(pwd) 'quoted text'
+printf 'quoted text' ${HOME} test --verbose export test printf | test
+	"$1" ${HOME} sed && 'quoted text' echo x=1 --verbose ${HOME} then
+		done -eu 2>/dev/null echo export | export ${HOME} --verbose
+		printf --verbose "$@" printf x=1 -eu export "$@" cd awk done printf -eu
+		"$@" grep --verbose --verbose done "$@" 'quoted text' echo export 2>/dev/null
+	grep local -eu sed printf sed --verbose sed $(pwd) /usr/bin export
+sed grep cd sed then local awk 'quoted text' $(pwd)
+	"$1" local $(pwd) sed
+		${HOME} 'quoted text' then awk $(pwd)
+echo --verbose grep 2>/dev/null --verbose "$1" /usr/bin x=1 "$@"
+		done "$1" x=1 awk | sed
+	done cd grep local 'quoted text' export
+sed --verbose -eu readonly && readonly
+		$(pwd) readonly grep echo
+	printf test grep x=1 'quoted text' echo local printf
+	${HOME} /usr/bin --verbose
+		export test then cd $(pwd) export "$1" | local echo "$@" done
+		"$1" -eu | ${HOME} 'quoted text' grep done done $(pwd) ${HOME}
+	grep --verbose && awk sed -eu "$1" readonly done "$1" 2>/dev/null
+-eu 2>/dev/null export cd | | then local /usr/bin | && /usr/bin printf then awk
+	export sed done ${HOME} $(pwd) ${HOME} grep "$1" --verbose
+readonly readonly printf readonly
+	&& test echo -eu export $(pwd)
+		| | awk echo --verbose done grep 2>/dev/null export ${HOME} readonly "$@" grep
+	/usr/bin cd test export 2>/dev/null "$1"
+	-eu sed "$1" "$@" /usr/bin | grep awk /usr/bin "$@" "$1" -eu $(pwd) "$1"
+2>/dev/null 2>/dev/null done --verbose "$1" printf
+		${HOME} done then x=1 test 2>/dev/null printf $(pwd) printf ${HOME} printf cd readonly
+&& awk $(pwd) done export local --verbose
+	then "$@" && echo --verbose $(pwd) printf
+	"$1" readonly echo echo ${HOME} local
+		| echo -eu "$1" | export then 'quoted text' done then awk readonly cd | $(pwd) "$@"
+		| "$1" test export "$@" done
+		$(pwd) ${HOME} done 'quoted text' readonly then done export
+		sed "$1" then test export x=1 echo sed readonly cd echo "$1" echo
+	| 2>/dev/null test export --verbose $(pwd) then local grep "$@" && &&
+	$(pwd) /usr/bin "$@" /usr/bin ${HOME} local grep 'quoted text' "$@" grep "$1" ${HOME}
+	cd --verbose "$1" $(pwd) "$1" export awk && && local echo /usr/bin
+		/usr/bin printf local local | "$1"
+		"$@" readonly /usr/bin then test done
+		printf sed local done printf
+	local 2>/dev/null 2>/dev/null printf --verbose | printf "$@" | then
+		printf then 2>/dev/null
+2>/dev/null cd | "$@" then "$1" /usr/bin "$@" --verbose local
+/usr/bin echo echo ${HOME} test grep
+	2>/dev/null $(pwd) readonly | sed grep cd test then sed -eu 'quoted text'
+		${HOME} grep export --verbose
+| -eu --verbose --verbose cd done $(pwd)
+	sed | then cd 2>/dev/null $(pwd)
+readonly local readonly "$1" && grep echo cd grep | grep export test awk readonly
+		"$@" "$@" && 'quoted text' | test && && sed "$@" --verbose
+test "$1" printf local ${HOME} printf grep | $(pwd)
+		--verbose "$1" "$@" "$1" 'quoted text'
+		grep export && readonly /usr/bin 'quoted text' echo echo -eu --verbose echo
+awk --verbose readonly | readonly done test
+	&& test ${HOME} test printf readonly echo then &&
+		&& awk sed "$1" grep "$1" export x=1 -eu && -eu $(pwd) 2>/dev/null
+	/usr/bin ${HOME} then && export x=1
+cd printf test | -eu export export
+	printf "$1" ${HOME} grep x=1 x=1 export $(pwd) 2>/dev/null ${HOME}
+		/usr/bin 'quoted text' grep -eu -eu && -eu readonly cd
+${HOME} -eu awk --verbose "$@"
+sed -eu 'quoted text' x=1 x=1 grep readonly grep test ${HOME}
+2>/dev/null readonly sed 'quoted text' "$1" ${HOME}
+		/usr/bin x=1 cd ${HOME} then 'quoted text' $(pwd) printf printf
+	$(pwd) "$@" sed echo "$@" grep 'quoted text' cd
+-eu echo $(pwd) $(pwd) 'quoted text' /usr/bin export --verbose
+	then "$@" readonly then "$@" && && && local
+&& test grep /usr/bin awk --verbose cd
+		/usr/bin then echo -eu local -eu awk readonly
+		--verbose x=1 sed -eu cd export 2>/dev/null $(pwd) x=1
+x=1 echo | --verbose | | readonly 2>/dev/null
+done | && sed awk 'quoted text' cd && "$1" then readonly
+		'quoted text' "$@" -eu "$1" ${HOME} grep -eu ${HOME} 'quoted text' --verbose
+		done test awk test && $(pwd) sed cd sed export
+	then "$1" "$1" 2>/dev/null sed
+		echo --verbose 2>/dev/null --verbose cd "$1"
+		export 2>/dev/null awk sed | export 'quoted text' "$1" export readonly 2>/dev/null
+		| cd cd --verbose awk 2>/dev/null done ${HOME} ${HOME} && --verbose
+	done 'quoted text' sed -eu local 2>/dev/null /usr/bin
+		sed ${HOME} export grep 'quoted text' | 2>/dev/null
+	'quoted text' | --verbose -eu 2>/dev/null -eu /usr/bin "$1" grep /usr/bin sed
+	printf ${HOME} sed grep done
+		awk 2>/dev/null sed export -eu x=1 /usr/bin
+--verbose | "$@" readonly
+	${HOME} x=1 test then echo --verbose
+		"$@" 2>/dev/null export export printf |
+	then then local cd local x=1 2>/dev/null printf printf grep
+	| 'quoted text' test done printf && x=1
+	export $(pwd) echo test 'quoted text'
+--verbose printf --verbose grep cd $(pwd) 'quoted text'
+		awk awk grep printf ${HOME}
+		2>/dev/null cd && x=1 grep 'quoted text' | awk local
+		printf echo local echo done && x=1 local export
+x=1 local $(pwd) -eu echo x=1 /usr/bin /usr/bin 2>/dev/null printf $(pwd) test
+		echo 2>/dev/null ${HOME} -eu test "$1" done echo -eu x=1 grep cd --verbose readonly
+		echo x=1 ${HOME} && local
+		awk sed x=1 "$1" "$@" 2>/dev/null awk echo readonly
+		test "$1" 2>/dev/null export "$@" && printf
+2>/dev/null local $(pwd) test
+		export then done 'quoted text'
+		done -eu $(pwd) sed ${HOME} "$@" then
+	$(pwd) "$@" && | printf x=1 grep
+	test cd readonly sed 2>/dev/null
+		-eu -eu awk -eu && readonly then $(pwd) $(pwd) --verbose
+	x=1 "$1" echo printf cd export sed /usr/bin
+	x=1 sed --verbose local awk then
+	"$1" awk "$@" $(pwd) then $(pwd)
+done then $(pwd) printf ${HOME} "$@" |
+		x=1 "$@" sed 'quoted text' $(pwd) done -eu echo "$@" then sed printf /usr/bin
+| printf /usr/bin x=1 | "$1" grep | sed printf -eu cd 2>/dev/null /usr/bin
+	| cd test cd sed -eu "$1"
+test 2>/dev/null /usr/bin /usr/bin $(pwd) done /usr/bin -eu | then
+printf test done $(pwd)
+		awk grep done $(pwd) done $(pwd) x=1 "$1" /usr/bin
+	x=1 then -eu local sed "$1" 'quoted text'
+	"$1" readonly 'quoted text' echo
+		readonly test done export ${HOME} done done grep 'quoted text'
+		grep "$@" -eu "$1" awk ${HOME} local
+sed printf grep local test awk && /usr/bin readonly test &&
+	-eu 'quoted text' 'quoted text' local test "$@" 2>/dev/null /usr/bin
+&& then && then --verbose
+		${HOME} printf cd $(pwd) x=1
+echo -eu "$1" --verbose | readonly /usr/bin x=1 && printf "$@"
+	x=1 ${HOME} -eu /usr/bin grep echo "$1" test
+	"$1" test printf -eu local && 2>/dev/null 'quoted text' /usr/bin
+	local readonly grep $(pwd) test grep readonly echo "$@" echo ${HOME} done
+&& /usr/bin ${HOME} awk x=1 awk --verbose /usr/bin
+	test $(pwd) then cd x=1 "$@" /usr/bin x=1 sed then awk 'quoted text' grep cd -eu
+"$1" 'quoted text' local local cd test x=1 -eu $(pwd) export | && && -eu 2>/dev/null
+		2>/dev/null | x=1 awk printf | export &&
+	local ${HOME} cd ${HOME} ${HOME} $(pwd) x=1 echo /usr/bin
+--verbose test && "$1" test -eu awk -eu && 'quoted text' echo --verbose export
+then && cd printf "$1" x=1 && && 'quoted text'
+"$@" $(pwd) "$1" "$1"
+	cd x=1 echo ${HOME} cd sed $(pwd) $(pwd)
+		$(pwd) "$@" 2>/dev/null printf awk sed sed echo "$@"
+	then $(pwd) $(pwd) | /usr/bin export local 'quoted text' "$1"
+	"$1" x=1 | x=1 echo 'quoted text' printf /usr/bin echo echo test printf /usr/bin
+--verbose 2>/dev/null --verbose "$@" readonly cd --verbose
+		local awk echo awk sed
+	-eu sed /usr/bin done
+		'quoted text' ${HOME} "$1" ${HOME} sed cd awk test
+"$1" 2>/dev/null ${HOME} "$1" then && readonly sed 2>/dev/null echo x=1 grep
+printf local "$@" --verbose done printf
+awk echo then grep 2>/dev/null local
+		export echo echo export test then local 'quoted text' --verbose 'quoted text'
+		2>/dev/null 'quoted text' 2>/dev/null
+		readonly ${HOME} readonly -eu
+	"$1" -eu cd --verbose /usr/bin ${HOME} test 2>/dev/null
+	local test /usr/bin "$@" "$@" -eu | test x=1 --verbose then cd
+		done 'quoted text' echo grep -eu readonly $(pwd) "$1" "$1" ${HOME} /usr/bin
+/usr/bin printf done $(pwd) echo then /usr/bin export
+readonly printf /usr/bin 2>/dev/null test readonly sed done --verbose
+	$(pwd) then echo grep "$1" | awk echo ${HOME} cd /usr/bin -eu ${HOME} "$@" "$@"
+		-eu 'quoted text' then local local $(pwd) "$@" grep echo test -eu &&
+	&& && awk printf --verbose && readonly then x=1 | $(pwd) $(pwd) local ${HOME}
+		grep /usr/bin echo --verbose | local grep sed x=1 printf -eu 'quoted text'
+		/usr/bin done echo done readonly x=1 echo cd printf awk then echo done "$1"
+	awk then "$1" sed sed $(pwd) ${HOME} 2>/dev/null 'quoted text'
+| local -eu local | test
+	2>/dev/null ${HOME} ${HOME} grep 2>/dev/null sed --verbose
+&& && && ${HOME} --verbose local ${HOME} "$@" -eu 'quoted text' x=1 echo | 2>/dev/null
+		local test /usr/bin -eu x=1 printf && | local readonly x=1 -eu
+then /usr/bin $(pwd) | cd echo cd x=1 done printf local
+		x=1 ${HOME} --verbose /usr/bin 'quoted text' then x=1
+	test "$@" "$@" 'quoted text' awk test
+grep sed 2>/dev/null done then x=1 "$1" grep
+		x=1 local printf 'quoted text' ${HOME} test "$1" "$@" -eu
+--verbose $(pwd) $(pwd) "$1" "$@" "$@" sed ${HOME}
+		then test "$1" awk test test x=1 printf then export done ${HOME} "$1" -eu /usr/bin
+	then && "$1" local awk $(pwd) then "$@" /usr/bin -eu export then ${HOME}
+| echo && 2>/dev/null done printf local readonly cd
+	sed 'quoted text' --verbose x=1 echo "$@" $(pwd) sed /usr/bin
+/usr/bin local /usr/bin export | x=1 test /usr/bin
+grep -eu awk x=1 $(pwd) ${HOME} export -eu && -eu
+	2>/dev/null "$1" "$1" awk 'quoted text' | test awk "$@" export cd
+	"$@" sed sed readonly -eu readonly awk ${HOME} $(pwd)
+2>/dev/null awk 2>/dev/null then printf | echo 2>/dev/null then ${HOME} x=1
+	"$1" /usr/bin sed readonly $(pwd) x=1 -eu local ${HOME} done then -eu /usr/bin export
+		printf done sed echo grep /usr/bin echo awk grep --verbose then 2>/dev/null
+		"$1" local 'quoted text' -eu grep echo ${HOME} then awk echo
+		x=1 "$1" --verbose 'quoted text' echo cd "$@" done
+	sed local x=1 && readonly grep
+	"$@" 2>/dev/null test "$1" grep then grep local export "$1"
+done ${HOME} echo sed done grep printf /usr/bin
+		-eu local echo grep local awk sed done local local 2>/dev/null grep awk
+		local test cd cd then readonly export printf "$@"
+| 2>/dev/null test 2>/dev/null 2>/dev/null test $(pwd)
+then sed echo echo --verbose
+		"$1" x=1 /usr/bin 'quoted text'
+		"$@" --verbose cd cd "$@" && local $(pwd) 2>/dev/null 'quoted text'
+done local | then x=1 /usr/bin ${HOME}
+then grep local then "$1" "$1" done x=1 $(pwd) ${HOME} local &&
+		-eu && x=1 sed 'quoted text' x=1 x=1 --verbose then cd readonly export cd -eu
+	readonly | sed awk | export
+	--verbose echo "$@" "$@" done done 'quoted text'
+	&& printf "$1" $(pwd) /usr/bin x=1 sed 'quoted text' && sed && local $(pwd)
+		grep test test awk awk | then $(pwd) 'quoted text' awk awk readonly
+sed sed ${HOME} $(pwd) x=1 "$@" awk
+		x=1 /usr/bin -eu then 2>/dev/null
+		| done echo | $(pwd) x=1 export awk
+	export && && | test --verbose "$@" && local local $(pwd) test && then | --verbose
+		${HOME} $(pwd) then x=1 grep "$@" -eu ${HOME}
+x=1 sed $(pwd) awk test cd local export export $(pwd) sed 'quoted text'
+		grep ${HOME} awk /usr/bin --verbose test "$@"
+	${HOME} "$@" && export && sed ${HOME}
+		export --verbose export 'quoted text' -eu -eu awk | "$1" export sed 'quoted text'
+		awk && then done $(pwd) export sed test grep sed
+	test done -eu test "$1" "$@" echo --verbose
+x=1 readonly sed "$1" && -eu sed | sed --verbose test 2>/dev/null
+	awk /usr/bin -eu "$@" "$1" ${HOME} readonly | x=1 test $(pwd) printf
+	test "$@" local grep echo -eu export $(pwd) | --verbose
+	readonly 'quoted text' done 'quoted text'
+	$(pwd) awk x=1 echo /usr/bin 2>/dev/null $(pwd) --verbose export local local
+		"$1" printf $(pwd) -eu echo | $(pwd) then
+		x=1 2>/dev/null awk --verbose
+		done 2>/dev/null test x=1 then sed cd "$@" cd echo echo
+	2>/dev/null "$@" echo sed 2>/dev/null
+	cd printf | readonly readonly cd sed ${HOME} /usr/bin x=1 then awk
+	export /usr/bin "$1" awk && done export /usr/bin | | awk x=1 -eu sed
+		local test export printf then
+test "$1" 'quoted text' export x=1 then grep -eu x=1
+-eu ${HOME} x=1 'quoted text' local --verbose readonly "$1" ${HOME} "$@" echo sed
+	2>/dev/null 2>/dev/null "$1" --verbose
+	echo awk 'quoted text' ${HOME} 'quoted text' "$@" --verbose
+--verbose $(pwd) /usr/bin -eu awk export
+	--verbose export grep readonly 2>/dev/null
+'quoted text' readonly ${HOME} /usr/bin printf printf grep awk 'quoted text' $(pwd)
+	grep --verbose readonly
+	&& export -eu && awk "$@" 2>/dev/null -eu sed done "$1" readonly awk -eu
+test -eu | echo readonly 2>/dev/null then | export done awk --verbose
+	then local 'quoted text' | test 2>/dev/null
+	local awk grep then $(pwd) then readonly 2>/dev/null "$1" "$1" cd $(pwd) cd
+&& then cd then 2>/dev/null ${HOME}
+	${HOME} "$@" -eu && $(pwd) 'quoted text' local test --verbose 'quoted text' -eu
+	/usr/bin /usr/bin readonly echo $(pwd)
+awk grep cd export export -eu
+--verbose 2>/dev/null test local grep local 2>/dev/null | && test
+cd /usr/bin local -eu test then grep /usr/bin cd $(pwd) local
+awk sed then "$1" awk test "$@" readonly export $(pwd)
+	awk $(pwd) $(pwd) && readonly ${HOME} --verbose ${HOME} local
+	done 'quoted text' printf --verbose test readonly "$@" printf 2>/dev/null
+	test export "$1" printf | done test && $(pwd)
+	--verbose --verbose -eu
+	printf local /usr/bin sed then test && cd export grep
+'quoted text' /usr/bin done x=1 && awk && echo
+test sed -eu "$@" then $(pwd)
+	export -eu done /usr/bin -eu /usr/bin then then ${HOME}
+		done printf --verbose echo sed grep "$1" /usr/bin --verbose
+export done then 'quoted text' x=1 'quoted text'
+| $(pwd) /usr/bin test "$@" 2>/dev/null sed readonly
+		local -eu cd test echo 'quoted text' /usr/bin
+	'quoted text' "$1" 2>/dev/null
+	done test -eu /usr/bin printf awk cd 2>/dev/null
+		&& export x=1 echo && | awk
+grep 'quoted text' echo 'quoted text' sed export
+	cd test readonly "$1" sed then cd 2>/dev/null
+	| ${HOME} awk --verbose "$1" then printf sed export $(pwd) awk | awk
+		done "$1" then echo --verbose test cd
+grep test then awk x=1
+export done sed readonly x=1 | "$@" grep 2>/dev/null ${HOME} 2>/dev/null
+x=1 | echo "$@" sed test local -eu 'quoted text' -eu "$@" local export
+	x=1 done --verbose test 'quoted text' test x=1 local awk 2>/dev/null
+--verbose 'quoted text'
+| $(pwd) done "$1" "$@" echo local printf -eu | cd
+grep grep "$@" test local then sed local
+2>/dev/null && "$@" done export
+		"$1" local "$1" local then ${HOME} && "$@" printf 'quoted text' done | local sed
+grep && sed cd | 'quoted text'
+		2>/dev/null cd $(pwd) 'quoted text' local done awk awk test
+"$@" printf "$1" 2>/dev/null "$1" && awk 2>/dev/null
+		"$@" 'quoted text' then then
+'quoted text' && printf /usr/bin printf grep
+		'quoted text' awk | x=1 awk --verbose cd
+	${HOME} readonly /usr/bin test "$@" local awk export "$1" grep test printf
+		'quoted text' export test test --verbose echo -eu then printf done awk
+	local local --verbose grep echo | then "$1" export printf
+	'quoted text' 'quoted text' ${HOME} test
+	${HOME} --verbose then &&
+/usr/bin local done --verbose export && printf "$1" --verbose | then
+	"$1" awk awk cd done 2>/dev/null
+		printf sed sed printf 'quoted text' awk "$1" readonly | echo export awk 2>/dev/null
+	cd done done then sed readonly export
+&& x=1 /usr/bin $(pwd) cd awk awk --verbose -eu echo readonly $(pwd) "$@"
+${HOME} cd x=1 local local awk grep --verbose | readonly export
+		x=1 | cd $(pwd) grep "$@" | /usr/bin $(pwd) test grep
+	--verbose x=1 local --verbose
+| | 'quoted text' ${HOME} echo 2>/dev/null then | grep test grep -eu
+	sed awk ${HOME} /usr/bin ${HOME}
+		printf awk 'quoted text' awk ${HOME} x=1 sed /usr/bin test local && | export
+	done "$@" test readonly
+	| 'quoted text' awk --verbose $(pwd) &&
+	local -eu readonly cd "$1"
+	--verbose then $(pwd) -eu grep ${HOME}
+	$(pwd) x=1 done && 2>/dev/null ${HOME}
+${HOME} && 'quoted text' "$1" "$@" -eu 'quoted text' readonly
+		"$@" -eu echo "$@" grep test then grep done | /usr/bin -eu /usr/bin 'quoted text'
+		$(pwd) local && "$1" $(pwd) "$@" --verbose /usr/bin && done echo $(pwd)
+	x=1 ${HOME} 'quoted text' -eu cd sed local then awk
+cd 2>/dev/null done 2>/dev/null local
+"$@" x=1 echo printf grep && test
+x=1 -eu x=1 x=1 ${HOME} x=1 -eu $(pwd)
+		echo -eu | readonly local 'quoted text' test | done grep ${HOME} printf then
+		sed x=1 sed test "$1" done 2>/dev/null -eu /usr/bin /usr/bin test
+	test $(pwd) grep -eu done readonly 2>/dev/null then -eu sed
+done -eu awk readonly && && done
+	readonly x=1 awk 2>/dev/null 2>/dev/null
+&& 'quoted text' local --verbose ${HOME}
+	export export test 'quoted text' readonly /usr/bin --verbose cd 'quoted text'
+local test | 'quoted text'
+${HOME} grep echo $(pwd) cd done cd printf local readonly then 2>/dev/null done
+	x=1 echo /usr/bin | x=1 cd ${HOME} local --verbose
+		${HOME} "$1" x=1 local /usr/bin "$@" /usr/bin sed cd x=1 -eu echo | ${HOME}
+		grep cd test x=1 2>/dev/null sed printf readonly | $(pwd) | "$1"
+		cd /usr/bin --verbose -eu $(pwd) done
+		export echo grep 'quoted text' readonly
+	"$@" cd $(pwd) export -eu then readonly export
+	export printf ${HOME} awk && $(pwd) ${HOME} "$1" echo | "$1" printf awk
+'quoted text' test then
+		$(pwd) "$1" -eu /usr/bin $(pwd)
+sed test -eu printf /usr/bin
+	then done -eu cd $(pwd) "$@" "$@" awk printf 'quoted text'
+		echo ${HOME} grep "$1" local cd readonly $(pwd) | export
+| printf test export $(pwd) export cd readonly
+		'quoted text' echo sed awk echo printf then "$1" 2>/dev/null
+		echo --verbose 2>/dev/null "$@" readonly | && "$1" echo
+		echo grep "$@" --verbose readonly then | awk -eu
+		echo done then test | 'quoted text'
+local local sed echo && $(pwd) /usr/bin done | awk
+/usr/bin 2>/dev/null | done export 2>/dev/null grep /usr/bin
+		| 2>/dev/null "$1" /usr/bin | x=1 "$@" ${HOME}
+"$@" 'quoted text' export /usr/bin 2>/dev/null
+		"$@" && x=1 echo $(pwd) readonly cd printf cd && sed printf "$1" x=1 grep x=1
+"$@" export then printf cd printf done
+	echo test $(pwd) test then sed readonly $(pwd) awk
+	local ${HOME} /usr/bin && awk $(pwd)
+grep | $(pwd) 2>/dev/null then printf ${HOME} test "$@" test 'quoted text'
+"$@" "$@" "$@" test 'quoted text'
+	'quoted text' ${HOME} | "$1" $(pwd) /usr/bin readonly
+		export "$@" cd then x=1 done export grep cd then "$@"
+readonly readonly && then && x=1 printf "$@" readonly test -eu test cd
+		$(pwd) echo x=1 echo test export test local echo grep then awk "$@" sed $(pwd)
+	2>/dev/null $(pwd) 2>/dev/null | $(pwd) 2>/dev/null ${HOME} x=1 "$@" --verbose
+		-eu 2>/dev/null grep | local 'quoted text' printf test ${HOME} "$@" x=1 /usr/bin
+	awk | -eu local echo 'quoted text' $(pwd) local local grep grep sed -eu
+		sed then sed echo printf x=1 | /usr/bin test ${HOME} local "$1" "$1" printf
+		${HOME} done | printf /usr/bin | 2>/dev/null
+'quoted text' ${HOME} echo
+grep grep test echo --verbose 2>/dev/null 2>/dev/null "$@" local && --verbose 'quoted text'
+		awk 'quoted text' -eu local local
+grep && 'quoted text' export then then x=1 "$@" awk echo export awk 2>/dev/null
+		&& test /usr/bin test --verbose | $(pwd) --verbose then echo then cd -eu "$1"
+		$(pwd) -eu $(pwd) && readonly local -eu printf awk 'quoted text' -eu echo local
+		sed awk x=1 readonly /usr/bin 2>/dev/null
+	2>/dev/null done /usr/bin printf ${HOME}
+		-eu cd done && /usr/bin grep
+	$(pwd) 'quoted text' printf "$@"
+	sed echo /usr/bin local test -eu sed x=1 grep export -eu
+	&& readonly then done --verbose "$@" printf readonly /usr/bin
+		cd printf "$@" test readonly awk /usr/bin readonly $(pwd) $(pwd) then cd
+		/usr/bin -eu grep --verbose then 'quoted text' awk printf cd export printf | then
+test done echo readonly awk sed
+${HOME} cd -eu -eu | then printf printf "$@" -eu printf done 2>/dev/null
+	export && echo "$1" ${HOME} test readonly "$1" test
+		x=1 2>/dev/null done -eu test sed test --verbose local -eu 'quoted text' local
+		"$1" $(pwd) /usr/bin echo && local "$@" echo sed test
+	done -eu cd 2>/dev/null 2>/dev/null export printf
+		grep -eu ${HOME} grep "$1" echo ${HOME} export done test cd $(pwd) test -eu
+	local sed grep sed printf /usr/bin then sed echo cd -eu -eu 2>/dev/null
+		$(pwd) -eu test -eu sed local local cd /usr/bin --verbose sed
+${HOME} ${HOME} cd 2>/dev/null
+		awk "$@" local --verbose 'quoted text' ${HOME} test then "$1" test ${HOME}
+		-eu 'quoted text' "$1" | ${HOME} test sed -eu readonly
+	then | echo done /usr/bin ${HOME} then grep
+	/usr/bin then -eu "$1" 'quoted text'
+		/usr/bin readonly -eu -eu "$1" export
+grep && grep "$@" echo
+printf "$1" /usr/bin echo then $(pwd) test done awk $(pwd) ${HOME}
+		x=1 awk export grep "$@" --verbose grep
+	echo --verbose cd $(pwd)
+	cd done "$@" 'quoted text' 'quoted text' 2>/dev/null --verbose test ${HOME} grep
+		--verbose grep then grep awk --verbose 2>/dev/null
+	/usr/bin cd echo awk -eu --verbose sed x=1 --verbose echo sed ${HOME}
+	x=1 sed && then 'quoted text' printf && $(pwd) ${HOME} echo
+	grep grep | test cd | -eu then "$@" -eu sed 'quoted text' echo done --verbose
+cd /usr/bin printf x=1 sed 'quoted text' then
+	$(pwd) done local "$1" $(pwd) local | 2>/dev/null local local x=1 | readonly
+awk echo $(pwd) "$1" -eu $(pwd) grep |
+	"$@" local readonly done grep --verbose ${HOME} | sed
+	test test 2>/dev/null printf "$@" ${HOME}
+		cd 2>/dev/null test "$@"
+		--verbose awk sed local cd then 'quoted text'
+		-eu echo local x=1 echo
+		-eu cd then readonly awk $(pwd) echo && then 2>/dev/null awk $(pwd)
+printf grep | $(pwd) 'quoted text' sed $(pwd)
+		$(pwd) /usr/bin readonly ${HOME} x=1 readonly /usr/bin
+	grep $(pwd) $(pwd) then &&
+		"$@" sed "$1" sed ${HOME} 2>/dev/null
+	then then ${HOME} export export
+2>/dev/null 2>/dev/null echo
+	'quoted text' "$@" cd readonly && /usr/bin sed "$1" && /usr/bin sed readonly
+then awk -eu then grep x=1 'quoted text' then printf 2>/dev/null
+| 'quoted text' $(pwd) done cd echo done $(pwd)
+		"$1" printf | --verbose printf | export grep printf /usr/bin x=1 done
+	&& 'quoted text' sed local
+$(pwd) awk then grep
+		local $(pwd) awk printf
+	awk 2>/dev/null 2>/dev/null 2>/dev/null then done
+	local && && readonly cd awk $(pwd) "$@" | awk awk "$@" local x=1 x=1 --verbose
+	/usr/bin awk sed --verbose 2>/dev/null cd sed -eu readonly done 2>/dev/null
+		export "$1" awk $(pwd) x=1 $(pwd)
+x=1 -eu printf readonly | && x=1 "$1" 'quoted text' 2>/dev/null printf grep
+		-eu -eu "$1" "$1" grep "$1" cd ${HOME} echo "$1" awk echo then printf awk 'quoted text'
+		--verbose ${HOME} local test 2>/dev/null
+sed -eu grep | x=1 readonly export export grep echo 'quoted text' readonly x=1 ${HOME}
+sed /usr/bin "$1" --verbose awk -eu x=1 $(pwd) 2>/dev/null
+	"$@" readonly /usr/bin cd cd awk "$1"
+	readonly test test "$@" test ${HOME} echo "$@" then
+done then readonly export export sed /usr/bin | then
+	--verbose readonly 'quoted text' /usr/bin local
+		"$1" readonly grep -eu echo export done | -eu export done
+awk /usr/bin local $(pwd) test grep $(pwd) $(pwd) then then
+	grep grep cd echo export ${HOME} done 2>/dev/null
+export done done echo test sed 2>/dev/null awk
+'quoted text' x=1 ${HOME}
+	/usr/bin --verbose && ${HOME} then && && -eu 2>/dev/null
+local x=1 x=1 local test ${HOME} echo $(pwd)
+		grep -eu | --verbose echo --verbose "$1" && cd echo | "$1" | "$@" 2>/dev/null
+	grep ${HOME} done /usr/bin 2>/dev/null
+	&& done done 'quoted text' cd cd local cd then
+		local readonly cd grep readonly test sed /usr/bin readonly 'quoted text' sed
+	| done local then 'quoted text'
+		done export sed sed /usr/bin export awk local "$@" readonly
+grep then --verbose "$1" test && | local export -eu /usr/bin then done /usr/bin
+done test local && sed | test test /usr/bin export | ${HOME}
+export 2>/dev/null --verbose 2>/dev/null /usr/bin $(pwd) --verbose "$@" export
+		'quoted text' 2>/dev/null "$1" then grep
+	| --verbose /usr/bin printf "$@" echo then export ${HOME}
+	--verbose "$1" awk cd "$1" | readonly x=1 2>/dev/null sed awk
+local awk "$1" printf -eu
+	cd /usr/bin grep | sed export --verbose /usr/bin
+		export sed awk -eu cd "$@" cd && echo done readonly awk ${HOME}
+	/usr/bin 2>/dev/null test printf grep done x=1
+		"$1" echo ${HOME} -eu
+		$(pwd) 'quoted text' --verbose echo printf
+--verbose printf --verbose sed x=1 sed readonly done | readonly local readonly
+	awk | | sed --verbose done && "$@" && $(pwd) x=1 'quoted text' /usr/bin
+		&& printf "$1" sed readonly printf
+		local test 2>/dev/null 2>/dev/null done | --verbose && "$1" "$1" local
+export && grep echo -eu | cd export export test 2>/dev/null
+export -eu export local -eu printf | awk
+then ${HOME} awk "$1" sed 2>/dev/null
+		&& 'quoted text' 2>/dev/null x=1 sed sed
+		grep cd -eu echo cd 'quoted text' awk
+echo 'quoted text' -eu done
+		readonly printf grep /usr/bin "$1" test $(pwd) ${HOME} readonly
+	&& /usr/bin 'quoted text' then readonly local /usr/bin sed "$1" $(pwd) cd readonly
+	test | grep -eu 2>/dev/null
+--verbose "$1" sed x=1 local "$1"
+	printf "$@" -eu cd /usr/bin
+	echo ${HOME} /usr/bin | awk sed export 'quoted text'
+		echo export grep readonly -eu $(pwd)
+		readonly then && printf /usr/bin export "$@" "$1" export /usr/bin
+	"$1" | awk -eu echo "$1" 2>/dev/null then done echo printf grep
+cd ${HOME} local -eu -eu --verbose | then echo
+$(pwd) | grep then awk local 2>/dev/null
+		grep && 'quoted text' && export
+"$1" x=1 --verbose echo "$@" && && "$1" cd local then
+	$(pwd) && local cd done -eu && | readonly | cd ${HOME} /usr/bin --verbose
+	| -eu --verbose done printf x=1
+		done x=1 echo $(pwd) 'quoted text' echo local
+printf "$1" "$1" 2>/dev/null then readonly 2>/dev/null grep readonly $(pwd) /usr/bin
+x=1 printf echo ${HOME} 2>/dev/null grep sed "$@" readonly awk "$@"
+| export && x=1 readonly 'quoted text' done /usr/bin echo -eu x=1 export
+		$(pwd) 2>/dev/null "$@" -eu ${HOME} awk sed grep 2>/dev/null awk -eu
+local "$1" sed /usr/bin test
+	| echo grep awk | test "$@" done --verbose
+	readonly $(pwd) readonly test done done echo awk "$@" x=1 readonly printf
+	"$1" grep $(pwd) then
+x=1 2>/dev/null awk 'quoted text' 2>/dev/null "$@" grep /usr/bin test x=1 2>/dev/null
+		-eu test x=1 && echo cd printf 'quoted text' x=1 $(pwd) readonly
+	$(pwd) ${HOME} grep "$1" cd
+readonly sed echo && then done done "$1" "$@" x=1 readonly --verbose printf
+	/usr/bin export x=1 ${HOME} cd 'quoted text' -eu x=1
+		local printf echo printf done --verbose
+		"$@" then then ${HOME} 2>/dev/null awk readonly "$1" done test awk
+	"$1" x=1 sed sed then --verbose
+		| x=1 "$@" "$@" /usr/bin then --verbose "$@" -eu 'quoted text'
+test test printf x=1 --verbose 2>/dev/null printf && --verbose "$1" grep
+		echo then then ${HOME} cd | readonly 2>/dev/null
+		then sed local --verbose done 'quoted text' readonly
+		${HOME} readonly echo 'quoted text' readonly && cd awk cd "$@" 'quoted text' x=1
+sed 2>/dev/null sed x=1 local echo sed local local grep then printf
+cd then done x=1 done grep done /usr/bin test grep grep && "$1" $(pwd) | readonly
+--verbose /usr/bin readonly export "$@" echo 'quoted text'
+grep $(pwd) && "$1" test test export ${HOME} local readonly
+'quoted text' echo -eu ${HOME}
+		| && -eu ${HOME} printf x=1 echo
+--verbose -eu sed readonly then "$@" printf
+2>/dev/null awk ${HOME} awk test x=1 | /usr/bin export then readonly 2>/dev/null
+		2>/dev/null cd printf $(pwd) export sed cd
+	"$@" | done readonly 'quoted text' then /usr/bin
+		export "$@" && done cd sed | /usr/bin
+/usr/bin then grep grep readonly
+	test "$1" $(pwd) -eu "$1"
+	$(pwd) sed | cd /usr/bin "$@" then echo --verbose && && local
+		echo export sed 2>/dev/null
+echo grep && | echo local 'quoted text' $(pwd) "$@"
+	${HOME} | 2>/dev/null ${HOME} ${HOME} /usr/bin awk "$1" 'quoted text'
+/usr/bin "$1" -eu "$@" -eu grep local -eu printf $(pwd) --verbose --verbose awk
+		done echo grep ${HOME} ${HOME} test "$1" done && then -eu
+echo x=1 grep "$1" echo
+		x=1 echo $(pwd) $(pwd) --verbose 'quoted text'
+	-eu /usr/bin x=1 local $(pwd) export
+		--verbose echo readonly test local && "$@" grep local /usr/bin
+		grep readonly $(pwd) done sed sed $(pwd) local /usr/bin
+		x=1 /usr/bin sed readonly && --verbose /usr/bin echo sed -eu /usr/bin local
+		local x=1 echo ${HOME} printf
+echo readonly 'quoted text' | 2>/dev/null sed sed 'quoted text'
+sed ${HOME} "$1" "$1" $(pwd) readonly printf cd x=1 awk && sed cd done grep readonly
+	done 2>/dev/null echo done echo --verbose readonly done awk readonly 'quoted text'
+2>/dev/null printf sed printf "$@" grep 2>/dev/null test done
+	grep cd awk -eu grep local
+		${HOME} echo x=1 -eu local && "$1" grep /usr/bin echo && "$@" local "$@" sed
+	"$1" --verbose grep x=1 done /usr/bin 2>/dev/null sed 'quoted text'
+-eu $(pwd) readonly test "$@" x=1 "$@" sed "$1" echo
+cd local readonly grep printf
+2>/dev/null | "$@" $(pwd) | x=1
+		test "$1" --verbose sed ${HOME}
+cd ${HOME} echo export readonly $(pwd) export --verbose done
+echo && && grep -eu awk
+"$1" then export printf && x=1 -eu | local
+	${HOME} "$@" local awk
+		"$1" test "$@" echo awk && awk 2>/dev/null "$@" local then readonly "$@"
+		done -eu grep ${HOME} /usr/bin awk --verbose 'quoted text' export export 'quoted text'
+	export --verbose -eu cd
+"$1" | done local --verbose local 2>/dev/null | printf --verbose 'quoted text'
+		/usr/bin cd && x=1 ${HOME} then echo test 'quoted text'
+	cd done test && grep 2>/dev/null
+grep then -eu sed ${HOME} -eu --verbose x=1
+| 'quoted text' cd printf done then echo printf 'quoted text'
+sed 2>/dev/null "$@" done
+		cd echo printf printf "$@" sed local -eu
+		done 2>/dev/null sed sed
+		test /usr/bin awk && $(pwd) /usr/bin echo | -eu grep grep x=1 x=1
+		printf && readonly printf sed | -eu local sed done -eu "$@" cd cd then -eu
+		export 'quoted text' then 'quoted text' cd cd "$1" | then /usr/bin
+		then /usr/bin sed $(pwd) --verbose test 'quoted text'
+local && "$@" "$1" sed awk --verbose ${HOME} && then x=1 2>/dev/null printf
+$(pwd) "$1" $(pwd) "$@" ${HOME} 2>/dev/null echo readonly x=1 cd 2>/dev/null
+		done $(pwd) local /usr/bin
+		cd "$@" 'quoted text' 2>/dev/null cd readonly 'quoted text' readonly "$1" ${HOME}
+	$(pwd) 2>/dev/null awk local --verbose ${HOME} --verbose grep done
+		x=1 cd ${HOME} awk $(pwd) ${HOME} local
+		then done ${HOME} awk /usr/bin readonly $(pwd) export cd x=1
+	--verbose test awk ${HOME} /usr/bin --verbose
+		echo "$1" printf 2>/dev/null awk echo test --verbose cd grep
+local "$@" then echo echo
+		then sed readonly && sed export printf export done readonly echo
+	/usr/bin x=1 export && && printf
+		"$1" "$@" then 'quoted text' ${HOME} awk --verbose
+printf 'quoted text' grep done
+		local 'quoted text' && test cd readonly readonly $(pwd) grep $(pwd)
+--verbose "$@" --verbose then | --verbose cd "$1" printf local x=1
+		export local "$1" local echo echo 'quoted text'
+local echo 2>/dev/null x=1 readonly $(pwd) | 2>/dev/null
+	local then && "$@" done test ${HOME} grep printf
+	readonly --verbose cd 2>/dev/null awk local ${HOME} cd /usr/bin ${HOME} printf
+done x=1 $(pwd) && sed /usr/bin 'quoted text' cd local done echo
+		'quoted text' x=1 'quoted text' printf | 2>/dev/null
+cd readonly "$1" /usr/bin 2>/dev/null test ${HOME}
+	/usr/bin echo echo && x=1 cd printf then "$1" /usr/bin "$1" "$1" test
+		then 2>/dev/null grep sed && ${HOME} 2>/dev/null test cd test
+		&& /usr/bin x=1 cd local && && then "$@" /usr/bin "$1" $(pwd) 'quoted text'
+		&& awk x=1 sed --verbose readonly grep /usr/bin 'quoted text'
+		--verbose -eu echo $(pwd) "$@" export --verbose
+		--verbose -eu "$1" cd x=1 printf 2>/dev/null -eu --verbose grep echo
+	echo --verbose export readonly --verbose test && awk export $(pwd) then sed
+	"$1" "$1" /usr/bin sed && 'quoted text' awk export
+test grep x=1 printf cd "$@" local readonly done --verbose $(pwd) grep
+	2>/dev/null x=1 'quoted text'
+/usr/bin export cd grep /usr/bin /usr/bin "$@" sed /usr/bin && grep printf /usr/bin
+		$(pwd) "$@" sed "$@" "$@" echo
+		sed readonly "$@" "$1" "$1" sed awk | done -eu then -eu | cd "$@" printf
+$(pwd) echo ${HOME} -eu cd
+test "$1" x=1 "$@" grep readonly echo 2>/dev/null
+	-eu ${HOME} awk x=1 && 'quoted text' echo echo 2>/dev/null $(pwd)
+	--verbose echo awk ${HOME} printf printf
+-eu | cd -eu grep -eu ${HOME}
+	$(pwd) grep $(pwd) done local x=1 done cd "$1"
+		2>/dev/null printf awk 'quoted text' && 'quoted text' x=1 ${HOME} readonly
+${HOME} -eu 2>/dev/null /usr/bin
+		2>/dev/null local test local then x=1 'quoted text'
+		readonly "$@" echo cd grep && --verbose ${HOME} awk test
+		$(pwd) awk | $(pwd) test local -eu /usr/bin "$@" export local grep
+done then export /usr/bin -eu test local ${HOME} /usr/bin "$1" "$@" export
+| 'quoted text' "$@" echo printf printf "$1" /usr/bin sed /usr/bin done
+${HOME} test printf then && "$@" /usr/bin
+$(pwd) printf then readonly printf -eu "$@" && | printf then && x=1 awk awk readonly
+local 'quoted text' sed "$@" 'quoted text' ${HOME} grep done cd --verbose
+2>/dev/null local sed | -eu 2>/dev/null readonly awk "$@" local "$@" done
+	2>/dev/null "$@" 'quoted text' && 2>/dev/null cd echo -eu then "$1" && 2>/dev/null
+	"$@" readonly && --verbose
+	"$1" test $(pwd) readonly /usr/bin
+printf then $(pwd) test printf
+	test | export ${HOME} echo | -eu test "$@" ${HOME} sed export then x=1
+		/usr/bin | then $(pwd)
+	done && readonly grep /usr/bin "$1" awk printf 'quoted text' x=1 awk ${HOME}
+	echo && "$1" grep x=1 | export $(pwd) 'quoted text' export /usr/bin
+	${HOME} local -eu done x=1 $(pwd) x=1 grep cd | 2>/dev/null ${HOME} ${HOME}
+awk readonly done /usr/bin then sed 2>/dev/null x=1 cd $(pwd) echo
+	'quoted text' cd local 2>/dev/null then && then 'quoted text' -eu sed
+then awk awk $(pwd) | test | export printf "$1" /usr/bin printf export awk readonly
+then 'quoted text' && test -eu ${HOME} -eu "$@" done cd test $(pwd)
+	then then sed done | $(pwd) "$@" && then x=1 x=1 printf
+	2>/dev/null && printf done cd -eu awk echo "$@" --verbose
+		&& done sed "$1" echo /usr/bin sed printf readonly
+		done echo export ${HOME} export readonly 2>/dev/null --verbose local sed "$1"
+		export sed echo && "$1" grep
+local cd cd printf x=1 /usr/bin test awk -eu test "$@" done ${HOME}
+cd awk /usr/bin x=1 | grep x=1 &&
+		export "$@" --verbose readonly 2>/dev/null cd && test export
+		"$1" grep awk awk grep sed --verbose export | grep readonly sed awk awk 2>/dev/null
+	grep ${HOME} 'quoted text'
+	--verbose && -eu 'quoted text' echo grep
+/usr/bin local | | printf then /usr/bin "$@" -eu --verbose
+printf readonly $(pwd) test
+readonly grep && test echo "$@" -eu x=1 x=1 ${HOME} done test echo sed export
+	x=1 awk readonly readonly test grep grep && local ${HOME} readonly -eu "$@"
+awk && /usr/bin | sed "$@" x=1 | printf test
+	then "$@" cd awk && cd test 'quoted text' "$@" /usr/bin export
+	local && sed 'quoted text' /usr/bin "$@"
+'quoted text' "$1" then sed awk export done "$@" then x=1
+2>/dev/null --verbose && sed done x=1
+	$(pwd) cd "$@" /usr/bin printf
+	local x=1 /usr/bin x=1 'quoted text' readonly awk 2>/dev/null
+	test printf export echo ${HOME} local local test
+	export cd | done local | x=1 "$1" sed $(pwd) "$@" | "$1" && x=1
+	'quoted text' done "$1"
+/usr/bin -eu 2>/dev/null "$@" then printf "$@" local /usr/bin
+#include c33.sh
+then echo 'quoted text' grep --verbose test cd
+		-eu printf $(pwd) printf -eu printf x=1
+		readonly printf printf sed ${HOME} /usr/bin test
+export readonly 2>/dev/null -eu && local readonly
+echo ${HOME} 'quoted text' ${HOME} --verbose /usr/bin
+		grep local ${HOME} "$@" awk done test
+grep sed awk then 'quoted text'
+		"$1" echo echo "$@" "$@" local done "$@"
+		x=1 echo /usr/bin echo | ${HOME} 'quoted text' && $(pwd) /usr/bin
+		export x=1 /usr/bin grep --verbose printf "$1" --verbose printf -eu printf -eu
+	test | grep $(pwd) && $(pwd) 'quoted text' local
+	2>/dev/null grep local /usr/bin grep printf
+		"$1" awk -eu sed && export "$@" done 'quoted text' $(pwd) cd export --verbose
+	printf printf x=1 -eu test
+	x=1 -eu printf $(pwd) printf
+	readonly awk | "$1" $(pwd) 2>/dev/null sed grep --verbose $(pwd)
+		sed awk 2>/dev/null local export export grep $(pwd) $(pwd) ${HOME} 'quoted text'
+x=1 printf x=1 /usr/bin 'quoted text'
+"$1" 2>/dev/null awk "$1" $(pwd) local "$@"
+		x=1 sed sed echo "$1" done grep export $(pwd)
+		test ${HOME} export echo
+		echo printf sed x=1 --verbose x=1 printf test local export x=1 readonly local
+sed 2>/dev/null echo then
+grep 2>/dev/null test sed "$1" | grep export ${HOME}
+		-eu x=1 && /usr/bin readonly ${HOME} "$1" --verbose test then | $(pwd) awk grep
+		printf printf $(pwd) "$@" x=1 | printf
+		--verbose | sed $(pwd) readonly "$@" printf
+cd "$1" echo $(pwd) "$1" cd -eu "$1" readonly
+	local $(pwd) local $(pwd) --verbose -eu 'quoted text'
+-eu ${HOME} readonly test sed local /usr/bin
+"$1" "$1" ${HOME} ${HOME} /usr/bin sed sed /usr/bin printf -eu "$1" ${HOME}
+	"$@" ${HOME} /usr/bin done 2>/dev/null done test
+	test | 'quoted text' "$1" ${HOME}
+-eu done 'quoted text' local "$@" "$1" "$@" --verbose
+		${HOME} $(pwd) export "$1" /usr/bin
+	then test sed ${HOME} export local "$1" $(pwd) "$@" ${HOME} local --verbose readonly
+		cd ${HOME} test test then x=1 2>/dev/null
+local --verbose "$@" $(pwd) export 'quoted text' && grep
+	x=1 "$@" -eu "$1" awk /usr/bin export "$1" 'quoted text'
+'quoted text' readonly done export
+		local /usr/bin | local x=1 done x=1 local | &&
+	'quoted text' "$1" --verbose --verbose local 2>/dev/null && export
+	&& ${HOME} awk grep 'quoted text' 'quoted text'
+x=1 printf test ${HOME} | && -eu | -eu x=1 ${HOME} ${HOME}
+"$1" 2>/dev/null export awk | cd x=1 x=1 | && grep
+	test test x=1 $(pwd) readonly "$@" awk -eu /usr/bin | export
+	/usr/bin sed done x=1 local grep grep awk test ${HOME} 'quoted text'
+	"$1" -eu /usr/bin test grep awk /usr/bin done echo printf
+	local local cd local grep "$1" --verbose grep awk
+		x=1 $(pwd) then grep "$@" "$@" grep
+	--verbose grep then echo | grep awk
+	test grep && "$1" /usr/bin local --verbose test -eu export
+	grep -eu echo x=1 /usr/bin
+	x=1 | grep printf /usr/bin
+done then awk -eu done readonly
+	done export awk printf then echo then && ${HOME} readonly printf /usr/bin
+		--verbose --verbose && cd
+'quoted text' then &&
+/usr/bin $(pwd) readonly
+	--verbose cd x=1 readonly "$@" && ${HOME}
+		then export local ${HOME} sed then | --verbose local local printf done
+printf readonly $(pwd) local awk done --verbose cd --verbose 'quoted text'
+	local "$@" done -eu 'quoted text' "$1" "$1" /usr/bin && && 2>/dev/null
+		/usr/bin done printf x=1 /usr/bin
+		&& awk export sed cd grep
+export 2>/dev/null 2>/dev/null then
+		cd 'quoted text' --verbose $(pwd) 2>/dev/null ${HOME} awk ${HOME} "$1"
+local grep ${HOME} grep | x=1 awk then ${HOME} local then cd echo
+export 'quoted text' printf && test cd echo && test sed -eu printf local
+printf awk --verbose "$@" && -eu $(pwd) "$@" then export --verbose
+	"$1" 'quoted text' then x=1 done /usr/bin "$1" 2>/dev/null --verbose | 'quoted text'
+		/usr/bin 2>/dev/null "$1" cd then
+		cd ${HOME} printf grep --verbose 2>/dev/null "$1" sed 'quoted text'
+	'quoted text' export test test awk "$@"
+	/usr/bin awk -eu 2>/dev/null grep "$@" 'quoted text'
+		test "$1" echo awk --verbose 2>/dev/null echo grep local awk cd &&
+${HOME} ${HOME} /usr/bin cd sed sed test test 'quoted text' sed grep
+		x=1 test then export done 'quoted text' 'quoted text'
+	then "$1" "$@" awk && /usr/bin cd -eu ${HOME}
+	| -eu local x=1 cd "$@" readonly --verbose | ${HOME}
+awk then ${HOME} 2>/dev/null
+		printf grep local "$1" && | 'quoted text' 'quoted text' awk
+		test /usr/bin 'quoted text' printf $(pwd) export printf grep 2>/dev/null
+done grep -eu done x=1 then local test printf test grep |
+--verbose then sed 'quoted text'
+	export done /usr/bin ${HOME}
+	then cd grep 'quoted text' cd readonly echo echo && "$1" "$@"
+		cd grep local && awk then local x=1 && && | cd /usr/bin sed && done export
+		/usr/bin && then $(pwd) "$1" | test "$1" --verbose /usr/bin local awk then export
+		then printf x=1 -eu 2>/dev/null "$@" 2>/dev/null echo 2>/dev/null grep
+		&& --verbose cd sed local
+"$1" /usr/bin "$@" cd x=1 "$1" --verbose
+		grep local export -eu && then readonly readonly grep | && x=1 "$@" echo
+	cd -eu test printf "$@"
+		grep done test printf --verbose /usr/bin
+	/usr/bin done awk x=1 && echo grep
+	'quoted text' awk cd 'quoted text' printf
+awk cd sed export | $(pwd) && awk
+		&& then | awk /usr/bin $(pwd) -eu printf then sed export test 'quoted text' local
+		"$1" "$1" echo readonly "$1" x=1 printf "$@" 'quoted text'
+		$(pwd) ${HOME} 2>/dev/null readonly test /usr/bin done 'quoted text'
+	x=1 echo 2>/dev/null awk then && 'quoted text' -eu |
+	cd test ${HOME} 'quoted text' readonly /usr/bin 'quoted text'
+awk local "$1" grep | /usr/bin readonly ${HOME} /usr/bin
+	x=1 echo test cd 2>/dev/null
+	readonly /usr/bin echo /usr/bin local awk awk 2>/dev/null export grep x=1 x=1 "$@"
+"$1" done /usr/bin echo x=1 | --verbose local $(pwd) readonly |
+&& awk x=1 printf "$1" && "$@" x=1 --verbose echo ${HOME}
+sed 2>/dev/null cd awk -eu sed export
+	${HOME} ${HOME} export && x=1 | sed $(pwd)
+	awk 2>/dev/null -eu /usr/bin 'quoted text'
+| readonly $(pwd) | test echo ${HOME} 'quoted text' readonly then ${HOME}
+/usr/bin $(pwd) echo | readonly "$1" "$@" "$1" "$1"
+	awk grep readonly then echo done done x=1
+	$(pwd) /usr/bin x=1 echo readonly x=1 sed
+	done --verbose /usr/bin done /usr/bin
+$(pwd) printf $(pwd) test | "$1" --verbose "$@" echo test $(pwd) cd readonly
+	| local ${HOME} "$@" echo cd export grep then 2>/dev/null
+grep readonly done sed echo $(pwd) && 2>/dev/null "$@" x=1 ${HOME}
+	${HOME} --verbose readonly
+"$1" ${HOME} then x=1 grep 2>/dev/null sed printf then $(pwd) cd --verbose
+	local grep && | /usr/bin export /usr/bin echo && && && then done local sed cd awk
+/usr/bin -eu done "$@" ${HOME} | readonly sed local &&
+done && /usr/bin 2>/dev/null /usr/bin
+	| ${HOME} --verbose && cd then test x=1 grep
+test -eu printf cd 'quoted text' /usr/bin test x=1 2>/dev/null
+cd 2>/dev/null readonly grep grep $(pwd)
+		"$@" | -eu && done cd grep "$@" test
+		&& /usr/bin --verbose local sed readonly test 'quoted text' &&
+$(pwd) "$@" | sed 2>/dev/null printf awk
+	&& local grep cd local printf cd then
+		cd | test cd "$@" && ${HOME} then 'quoted text' | | ${HOME} "$1"
+	"$@" /usr/bin printf && local local | export then -eu 2>/dev/null
+| echo readonly --verbose
+sed --verbose sed sed "$1" local grep | done "$1" /usr/bin local local /usr/bin
+	sed 'quoted text' && done echo | "$1" 'quoted text' 'quoted text'
+| awk sed local "$1" sed grep test 2>/dev/null | /usr/bin 'quoted text' &&
+	test --verbose cd 'quoted text' grep --verbose sed
+	readonly /usr/bin echo readonly /usr/bin export then
+	test cd $(pwd) /usr/bin done 'quoted text' $(pwd)
+'quoted text' sed x=1 x=1 --verbose printf "$1" && /usr/bin local then ${HOME} readonly
+	awk test then x=1 'quoted text' --verbose -eu -eu export | "$@" echo
+		export echo /usr/bin /usr/bin
+		"$1" sed awk "$@" -eu test then "$@" /usr/bin "$@" done sed --verbose
+"$1" readonly 'quoted text' awk test "$@" "$@" echo ${HOME} $(pwd) "$@" ${HOME}
+		cd x=1 $(pwd) awk --verbose local cd test test awk sed "$1"
+		awk echo 'quoted text' cd test "$@"
+	"$1" echo | cd -eu awk test "$1" /usr/bin grep sed x=1 grep && then local printf
+	/usr/bin grep test export | then awk |
+'quoted text' export "$1" printf test $(pwd) echo echo sed
+cd local /usr/bin ${HOME} cd
+"$@" export printf | --verbose
+then 'quoted text' | printf printf x=1
+	sed $(pwd) awk cd sed cd -eu cd done readonly local awk done "$@" then $(pwd)
+	x=1 local cd readonly 2>/dev/null then "$@"
+cd ${HOME} /usr/bin test | grep printf ${HOME} | sed | ${HOME}
+	"$1" test then "$@" echo printf --verbose then printf | readonly
+test | --verbose "$1" cd "$@" -eu ${HOME} sed -eu "$@" && echo | sed local
+sed export cd then && cd "$@" $(pwd) readonly
+	echo done 'quoted text'
+awk --verbose x=1 $(pwd) | export export readonly --verbose printf printf |
+		awk /usr/bin 'quoted text' awk 2>/dev/null
+	test $(pwd) export "$1" && export readonly sed && 2>/dev/null grep
+echo 'quoted text' "$1" cd "$@" readonly -eu echo "$1" awk export "$1" ${HOME}
+	/usr/bin echo sed export then 2>/dev/null ${HOME} "$@" "$@" done
+	${HOME} cd cd sed export then 'quoted text' printf awk done x=1 "$@" then
+	/usr/bin export 'quoted text' x=1 test 'quoted text' "$@" awk cd /usr/bin export
+| 'quoted text' echo "$@" grep done /usr/bin 'quoted text'
+then ${HOME} --verbose cd sed printf test export then && x=1 --verbose
+	readonly | | -eu sed -eu 'quoted text' export $(pwd) --verbose export -eu sed |
+		| 'quoted text' -eu --verbose
+done export ${HOME} done && ${HOME} awk awk $(pwd) --verbose printf echo /usr/bin
+	then then printf done -eu sed
+	$(pwd) local x=1 export sed grep
+test /usr/bin export -eu $(pwd) then x=1 -eu test 2>/dev/null -eu 2>/dev/null
+		2>/dev/null awk test printf $(pwd) /usr/bin -eu readonly sed then
+	test -eu readonly 'quoted text' -eu && printf -eu 'quoted text'
+		printf "$@" 2>/dev/null --verbose && $(pwd)
+		cd /usr/bin sed done sed readonly | 2>/dev/null
+	-eu echo 'quoted text' &&
+readonly echo /usr/bin export sed -eu && $(pwd) done test cd export
+	grep export -eu sed grep --verbose /usr/bin test /usr/bin local readonly
+		printf /usr/bin readonly
+sed && echo ${HOME} grep x=1 "$@" printf x=1 $(pwd) then | "$@" readonly sed
+done readonly sed --verbose "$1" grep test grep -eu export
+		grep printf export export -eu export $(pwd) awk 2>/dev/null "$1" ${HOME}
+		--verbose awk && awk sed awk readonly readonly grep $(pwd) then -eu awk "$@" cd
+	done printf $(pwd) sed $(pwd) echo then then readonly 2>/dev/null /usr/bin
+$(pwd) then "$@" then local 2>/dev/null readonly awk
+echo 'quoted text' 'quoted text'
+		cd readonly x=1 "$@" cd export ${HOME} readonly cd $(pwd) && grep then
+		'quoted text' x=1 printf "$1" -eu -eu ${HOME} 'quoted text'
+	| printf awk ${HOME} ${HOME} readonly readonly --verbose
+		sed && 2>/dev/null -eu test
+		done -eu x=1 -eu printf 'quoted text' x=1 export awk -eu printf echo /usr/bin printf
+	"$@" readonly && sed done ${HOME}
+"$1" readonly then -eu grep 2>/dev/null | ${HOME} "$1" 'quoted text' sed
+		"$1" 'quoted text' 2>/dev/null awk cd && -eu ${HOME} $(pwd) readonly
+		&& "$1" 'quoted text' "$1" | export && && then echo test 'quoted text'
+sed -eu test readonly x=1 then 'quoted text'
+		'quoted text' && | sed 2>/dev/null x=1 cd grep export local "$@" "$1"
+		"$@" 'quoted text' ${HOME} $(pwd) then awk
+test export printf echo local ${HOME} sed 'quoted text' --verbose
+		local x=1 sed x=1 "$@" x=1 done ${HOME} test awk -eu export x=1
+		2>/dev/null cd -eu 'quoted text' ${HOME} --verbose done "$@" && sed sed export
+		"$@" echo cd "$@" "$1" 2>/dev/null | test printf
+		awk && local $(pwd) printf | local local sed export readonly echo
+	2>/dev/null ${HOME} 2>/dev/null done export /usr/bin /usr/bin readonly
+sed done printf echo grep | readonly sed 2>/dev/null
+		export && echo /usr/bin "$1" cd done ${HOME} sed awk grep -eu
+		/usr/bin cd -eu -eu && $(pwd) 2>/dev/null cd -eu
+	/usr/bin test echo cd $(pwd) export "$1" "$1" echo done /usr/bin export
+cd 2>/dev/null 2>/dev/null
+		'quoted text' echo sed export local "$1"
+	| local x=1 test /usr/bin
+		2>/dev/null then done $(pwd) grep x=1 -eu "$@" -eu /usr/bin sed /usr/bin x=1
+	$(pwd) x=1 /usr/bin "$@" readonly $(pwd) -eu 'quoted text'
+	/usr/bin printf 2>/dev/null grep /usr/bin
+		-eu --verbose "$@" x=1 then local 'quoted text' sed ${HOME} then sed echo
+	--verbose x=1 2>/dev/null sed -eu && then x=1 "$@" -eu
+		--verbose "$1" sed readonly cd $(pwd) --verbose --verbose echo
+'quoted text' ${HOME} --verbose cd $(pwd) 'quoted text'
+cd 2>/dev/null ${HOME} && "$@" export 2>/dev/null then printf
+"$@" printf | awk echo "$1" --verbose printf
+		done -eu echo test -eu done sed
+echo && done --verbose "$@" && "$1" $(pwd)
+	cd -eu --verbose --verbose then $(pwd) test
+echo done readonly printf --verbose
+		printf && readonly printf grep cd /usr/bin awk -eu done "$@" ${HOME}
+	local 'quoted text' awk | --verbose
+		echo "$1" then && /usr/bin ${HOME} then /usr/bin then "$1" awk test 2>/dev/null
+		&& "$@" "$1" ${HOME} $(pwd) 2>/dev/null 'quoted text'
+		x=1 awk 2>/dev/null readonly x=1
+echo then 2>/dev/null /usr/bin | done export readonly export
+		2>/dev/null then echo x=1 "$1"
+		export "$1" $(pwd) x=1 -eu local echo
+sed "$1" -eu sed export done /usr/bin then $(pwd) "$1" "$@" grep printf test |
+		| readonly ${HOME} && awk test 2>/dev/null
+--verbose readonly "$1"
+		then ${HOME} awk sed --verbose && ${HOME} readonly "$1" echo cd /usr/bin
+	-eu | --verbose /usr/bin grep then grep echo
+"$@" 2>/dev/null readonly
+	$(pwd) then -eu "$1" $(pwd)
+sed export && x=1 'quoted text' "$@" | printf printf
+		$(pwd) local 2>/dev/null && 'quoted text'
+then awk 2>/dev/null "$1" "$@" && | ${HOME}
+"$@" grep then echo export ${HOME} test x=1
+		echo readonly grep printf then /usr/bin "$1" "$1" awk -eu /usr/bin
+		x=1 $(pwd) then test grep
+	'quoted text' ${HOME} && export | sed /usr/bin -eu -eu "$@" --verbose /usr/bin
+		grep "$1" readonly /usr/bin then 'quoted text' printf
+	readonly ${HOME} export 2>/dev/null 'quoted text' awk
+		then printf "$1" ${HOME} awk "$@" grep export
+	$(pwd) test test && -eu then test -eu done "$1" | /usr/bin sed readonly
+		--verbose "$1" printf grep "$1" 2>/dev/null echo 2>/dev/null readonly "$@" ${HOME}
+test export 2>/dev/null printf
+		2>/dev/null --verbose local
+		x=1 ${HOME} cd && test
+	"$1" $(pwd) | 2>/dev/null -eu printf
+		grep $(pwd) printf 'quoted text' && test cd readonly
+		done /usr/bin 2>/dev/null 'quoted text' export "$1"
+echo then ${HOME} done "$@" readonly
+		grep $(pwd) done -eu local
+		$(pwd) grep 'quoted text' awk then -eu | $(pwd)
+	cd | -eu sed test && sed test cd cd --verbose 'quoted text'
+cd /usr/bin "$@" then "$1" printf --verbose 2>/dev/null 'quoted text'
+		readonly --verbose /usr/bin readonly awk -eu export local test test cd x=1
+		'quoted text' readonly awk --verbose awk sed grep done test $(pwd) | done $(pwd)
+		local readonly grep awk "$@" $(pwd) $(pwd) local echo done awk | -eu
+	sed | -eu test "$@" --verbose 'quoted text' cd 2>/dev/null x=1 echo
+printf printf $(pwd) /usr/bin export 2>/dev/null 'quoted text' --verbose readonly
+	export 'quoted text' "$1"
+then | | test -eu then then
+test printf "$1" x=1 readonly && sed -eu -eu awk
+	"$@" local done "$@" printf readonly x=1 cd echo
+		then done --verbose done awk export done export local echo ${HOME} 'quoted text'
+		--verbose "$1" x=1 then test ${HOME} 2>/dev/null ${HOME} 2>/dev/null awk readonly
+		test x=1 cd cd test $(pwd) x=1 export "$1" done 'quoted text' test
+done local "$1" sed awk export echo export then
+| then grep test "$1" $(pwd) export awk --verbose
+--verbose --verbose $(pwd) echo ${HOME} x=1 /usr/bin &&
+		printf ${HOME} x=1 grep export "$1" $(pwd) x=1 awk printf grep 'quoted text'
+-eu export $(pwd) $(pwd)
+		sed "$@" /usr/bin --verbose 'quoted text' $(pwd) echo
+	cd "$@" /usr/bin readonly test 'quoted text' && x=1 'quoted text' echo echo
+	readonly ${HOME} ${HOME} "$1" "$@" readonly
+test | awk export readonly printf
+	x=1 "$@" sed awk 'quoted text' -eu
+		done printf x=1 printf done export local ${HOME} | readonly
+	"$1" echo readonly -eu --verbose echo && ${HOME} readonly /usr/bin "$1" -eu
+	| $(pwd) $(pwd) sed $(pwd) &&
+	| awk /usr/bin && x=1 "$@" cd --verbose
+cd awk "$@" $(pwd) 2>/dev/null printf && 'quoted text' done 2>/dev/null
+2>/dev/null "$@" --verbose grep /usr/bin 'quoted text' $(pwd)
+	$(pwd) local echo printf
+local 2>/dev/null grep --verbose readonly
+		x=1 2>/dev/null 'quoted text' 2>/dev/null test $(pwd)
+test 2>/dev/null awk printf 'quoted text' --verbose x=1 local && done &&
+		'quoted text' 2>/dev/null --verbose "$1" ${HOME} printf
+done test ${HOME} then cd 'quoted text' awk 'quoted text' ${HOME} -eu "$1" grep
+		"$@" echo done 'quoted text'
+	local printf printf && ${HOME} x=1 echo awk echo cd $(pwd)
+		awk awk "$@" 2>/dev/null echo export cd test done -eu ${HOME}
+		${HOME} export grep -eu awk readonly
+		sed test "$@" ${HOME} grep done --verbose awk 'quoted text' "$1" -eu -eu
+		| export sed 2>/dev/null --verbose cd 'quoted text' "$1" 'quoted text'
+	export --verbose local awk x=1 x=1 --verbose | export "$1" $(pwd) done ${HOME}
+	&& "$1" sed ${HOME} awk && ${HOME} 2>/dev/null | awk echo | 2>/dev/null
+		/usr/bin sed export 2>/dev/null && printf "$1"
+	grep $(pwd) sed /usr/bin echo && ${HOME} awk export | readonly 2>/dev/null
+	"$@" echo readonly grep export export && done echo ${HOME}
+echo ${HOME} local awk printf echo local 2>/dev/null echo x=1
+	-eu echo awk && readonly grep
+		sed cd local sed sed $(pwd) -eu "$@" $(pwd) printf
+&& sed 2>/dev/null grep $(pwd) local | ${HOME}
+| /usr/bin "$@" done "$1"
+		awk sed $(pwd) "$1" "$@" echo "$@" done --verbose | grep
+test "$@" grep x=1 awk grep ${HOME}
+		then local cd export local 2>/dev/null
+		test && && | "$1" printf 2>/dev/null export
+2>/dev/null "$@" readonly -eu export x=1 $(pwd) cd --verbose "$@" "$@" export
+	| && | test readonly /usr/bin "$@" $(pwd) | echo $(pwd) grep
+echo 2>/dev/null 2>/dev/null
+readonly printf local then printf ${HOME} printf
+	x=1 && printf --verbose local printf
+	export 'quoted text' done | done
+printf ${HOME} --verbose
+		echo 2>/dev/null grep "$1" cd export | local --verbose sed grep
+		x=1 x=1 readonly then sed readonly readonly
+printf grep local /usr/bin 2>/dev/null -eu "$1" | && | local
+	${HOME} "$@" "$1" awk && cd done $(pwd)
+'quoted text' export export cd done ${HOME} --verbose
+done export grep $(pwd) readonly cd export echo test
+readonly printf | echo awk printf local 'quoted text' x=1 cd $(pwd) && && $(pwd)
+local local cd /usr/bin grep && -eu 2>/dev/null
+		awk 'quoted text' ${HOME}
+		x=1 local --verbose && ${HOME} "$1" local then | test local readonly /usr/bin
+	grep export 'quoted text' -eu export test $(pwd) then then x=1 done 'quoted text'
+	test $(pwd) printf "$1" -eu sed --verbose | 'quoted text' && printf grep local
+grep x=1 "$1" | -eu "$1" sed test done done readonly done
+		grep --verbose readonly awk 'quoted text' 'quoted text' x=1
+test echo "$1" "$@" -eu ${HOME}
+		readonly grep 2>/dev/null $(pwd) readonly done 2>/dev/null
+		readonly done /usr/bin
+printf done then && then
+"$@" && 2>/dev/null "$@" then
+awk cd x=1 then then /usr/bin ${HOME} /usr/bin test $(pwd) "$@"
+readonly echo --verbose $(pwd) "$1" grep &&
+$(pwd) /usr/bin echo readonly /usr/bin done "$@" cd 2>/dev/null done
+| -eu cd awk printf 'quoted text' --verbose echo | grep
+	then test cd "$@" printf && "$1" 2>/dev/null export
+	test -eu ${HOME} echo awk echo | --verbose test
+		local readonly | "$@" 2>/dev/null grep -eu
+	readonly | 'quoted text' $(pwd)
+| ${HOME} x=1 2>/dev/null awk 'quoted text' export
+$(pwd) "$@" awk then printf
+cd --verbose sed readonly export /usr/bin "$@" cd printf "$@" echo sed sed "$1"
+&& "$1" 'quoted text' local 'quoted text' then printf done x=1 && echo awk -eu
+		test printf && 'quoted text'
+	test x=1 grep | printf x=1 'quoted text' grep printf sed ${HOME} ${HOME}
+--verbose echo then 'quoted text'
+grep -eu grep 'quoted text' done
+	&& export $(pwd) x=1 x=1 grep printf grep --verbose done 'quoted text'
+	export test $(pwd) ${HOME} x=1 readonly
+-eu 2>/dev/null then sed ${HOME} $(pwd) awk
+		&& awk --verbose printf --verbose local done "$1" -eu "$1" x=1 $(pwd)
+		$(pwd) local $(pwd) local readonly readonly awk --verbose
+	cd test 'quoted text' ${HOME} done local readonly "$@" printf printf
+		'quoted text' --verbose "$1" 2>/dev/null then cd -eu
+	'quoted text' --verbose readonly ${HOME} x=1
+		echo done | cd done -eu grep --verbose printf test test cd local grep printf /usr/bin
+	local readonly "$@" --verbose echo 'quoted text' test printf local
+echo cd grep grep echo printf cd local
+		test | export 2>/dev/null test printf then ${HOME} echo echo awk --verbose
+-eu readonly done ${HOME}
+&& "$1" -eu local $(pwd) test done done $(pwd) local
+		${HOME} readonly -eu grep
+	2>/dev/null echo -eu "$@" then sed -eu cd echo
+	/usr/bin && cd done /usr/bin then /usr/bin printf grep 'quoted text'
+		cd sed awk sed cd x=1 "$@" && 'quoted text' then done 'quoted text' "$@" then
+		"$@" then ${HOME} local awk -eu -eu "$@" --verbose "$@" export readonly
+		"$1" 2>/dev/null ${HOME} --verbose
+		| | 'quoted text' "$1" test "$1" x=1 x=1
+echo x=1 /usr/bin 'quoted text' cd $(pwd)
+echo && sed export cd sed 'quoted text' /usr/bin "$@" ${HOME}
+"$1" grep local local ${HOME} readonly
+--verbose -eu "$1" grep
+$(pwd) readonly readonly -eu
+then echo echo grep 2>/dev/null printf export
+	/usr/bin sed 2>/dev/null
+grep ${HOME} printf 2>/dev/null
+	"$@" -eu /usr/bin awk && "$@" && 2>/dev/null awk test then "$1" -eu
+		printf -eu local "$@" awk
+		--verbose sed $(pwd) local 'quoted text' test sed
+		awk /usr/bin && echo then test 2>/dev/null test
+test 2>/dev/null export readonly x=1 x=1
+	done $(pwd) | readonly x=1 test "$@" | -eu echo local test 2>/dev/null
+	test x=1 test ${HOME} 2>/dev/null
+	awk then --verbose printf test cd test
+		/usr/bin /usr/bin then && $(pwd)
+	readonly /usr/bin done awk "$1" printf
+	"$@" 'quoted text' --verbose cd sed awk export && /usr/bin awk test | /usr/bin done
+cd && | -eu awk 2>/dev/null readonly
+		awk echo /usr/bin 'quoted text' local 'quoted text'
+	--verbose 2>/dev/null readonly | && x=1 x=1 "$@" sed echo | 'quoted text' awk readonly
+done echo export && 2>/dev/null cd readonly printf export local then printf
+/usr/bin 'quoted text' -eu printf /usr/bin local grep --verbose
+	x=1 /usr/bin export ${HOME} $(pwd) 'quoted text' then | cd &&
+grep && export echo x=1 cd cd grep readonly x=1 ${HOME}
+	local grep readonly test ${HOME} cd sed done ${HOME}
+	x=1 readonly -eu then "$1" local x=1 --verbose "$1" done awk readonly -eu grep &&
+		2>/dev/null --verbose local
+	test test readonly sed --verbose export echo awk $(pwd) ${HOME} local then 2>/dev/null
+	${HOME} x=1 readonly $(pwd) readonly x=1 readonly
+		x=1 sed grep cd x=1 "$@" readonly 'quoted text' then --verbose -eu --verbose
+then /usr/bin /usr/bin /usr/bin awk readonly "$@"
+	/usr/bin 2>/dev/null /usr/bin echo readonly "$@" 2>/dev/null cd
+printf -eu -eu grep --verbose grep local | local awk 2>/dev/null sed
+	grep 2>/dev/null "$1" /usr/bin export
+		"$1" 'quoted text' ${HOME} 'quoted text' local 2>/dev/null then sed local
+		2>/dev/null echo test | --verbose local awk then local "$@" export
+	"$1" test readonly readonly "$1" awk then
+		'quoted text' printf "$1" $(pwd) $(pwd) $(pwd) grep "$@" export then
+	awk && export && -eu awk readonly x=1 --verbose
+		echo then echo /usr/bin test local
+	export grep local 'quoted text'
+		export readonly 'quoted text' /usr/bin "$@" --verbose
+		"$1" sed /usr/bin && && "$@" printf ${HOME} then sed echo | ${HOME} awk
+sed readonly sed && ${HOME}
+	grep && /usr/bin | cd -eu printf --verbose "$@" "$@" local
+		| x=1 grep $(pwd) 'quoted text'
+2>/dev/null /usr/bin done $(pwd) ${HOME} sed printf | local "$@"
+	printf grep x=1 done printf | grep export readonly /usr/bin local local
+	local local --verbose export done test "$@" cd | echo -eu then 2>/dev/null 'quoted text'
+	x=1 ${HOME} awk 'quoted text' test ${HOME} local | test done -eu cd "$@" sed sed
+"$1" sed --verbose --verbose && $(pwd)
+	echo cd awk 'quoted text' $(pwd) readonly then --verbose
+cd sed "$@" done 'quoted text' x=1 --verbose
+	| then done printf --verbose awk then /usr/bin ${HOME} export 2>/dev/null | $(pwd)
+done grep 'quoted text' /usr/bin | awk local
+	readonly then 2>/dev/null --verbose echo 'quoted text'
+x=1 --verbose done test printf
+	"$@" | local export cd --verbose
+awk readonly 'quoted text'
+readonly grep --verbose done test 2>/dev/null
+		/usr/bin 2>/dev/null readonly "$@" 'quoted text'
+| grep done $(pwd) local --verbose
+${HOME} readonly --verbose 'quoted text' export 'quoted text'
+export /usr/bin cd echo printf --verbose "$@" $(pwd)
+awk 'quoted text' then local
+	awk 2>/dev/null printf --verbose 2>/dev/null readonly
+'quoted text' readonly sed done 2>/dev/null printf then && done
+		"$1" && "$1" "$1" test echo cd sed printf && "$@" sed
+		| printf ${HOME} awk 2>/dev/null sed readonly awk readonly sed done | x=1
+-eu -eu --verbose cd 'quoted text' awk awk echo --verbose awk readonly x=1 echo
+	cd grep local then echo 2>/dev/null
+		local | $(pwd) cd $(pwd) readonly x=1 done "$@"
+		$(pwd) test grep local
+done then 2>/dev/null test grep && then /usr/bin cd echo grep printf
+	readonly export grep then awk "$1" --verbose done grep done $(pwd) export echo 'quoted text'
+		export printf sed test local --verbose
+"$1" cd printf grep "$1" cd /usr/bin 2>/dev/null
+		readonly --verbose "$1" grep -eu "$@"
+then -eu | readonly 'quoted text' export && x=1
+test cd then grep "$@" ${HOME} ${HOME} ${HOME} cd sed cd done "$1" -eu x=1 export
+	&& -eu done -eu "$@" x=1 test "$@" 2>/dev/null echo $(pwd) printf x=1 export
+	grep --verbose done awk && done sed grep && awk --verbose --verbose
+		cd | -eu echo grep -eu awk grep grep -eu "$1" export && ${HOME} then $(pwd) $(pwd)
+-eu x=1 -eu printf /usr/bin ${HOME} "$@" then readonly "$@" cd test
+	cd echo readonly test done cd ${HOME} local ${HOME} ${HOME} -eu then /usr/bin
+		$(pwd) /usr/bin cd /usr/bin printf grep
+$(pwd) 2>/dev/null "$1"
+		--verbose awk | local 'quoted text' /usr/bin sed x=1 export
+		test x=1 2>/dev/null grep -eu done | ${HOME} "$1" $(pwd) | sed
+		'quoted text' 'quoted text' 'quoted text'
+		local then grep done 2>/dev/null echo 'quoted text' export
+printf grep && --verbose x=1 export export
+	readonly echo x=1 echo sed /usr/bin
+export x=1 echo done local | echo
+		local export "$@" grep -eu done then "$1" sed cd /usr/bin echo | 'quoted text'
+sed local -eu 'quoted text' sed local "$1" && "$1" echo ${HOME} echo /usr/bin
+	local cd $(pwd) test awk printf
+		sed --verbose "$1" then then "$@" export printf
+	local 'quoted text' | x=1 export /usr/bin
+	x=1 && ${HOME} sed echo "$1" export
+		&& && done /usr/bin 2>/dev/null 2>/dev/null echo local done 'quoted text'
+	/usr/bin printf | local cd 'quoted text'
+local test 2>/dev/null readonly --verbose export cd awk done 2>/dev/null
+	"$@" test awk && echo test awk test readonly local local x=1 "$1" | then printf
+	awk printf /usr/bin grep export grep "$@" readonly
+${HOME} 2>/dev/null 'quoted text'
+x=1 awk export cd | 'quoted text'
+	'quoted text' export sed readonly then "$@" | sed test echo 2>/dev/null --verbose
+	--verbose grep printf 'quoted text'
+	printf then export /usr/bin && "$1" --verbose awk && local "$@" "$1" awk
+done && /usr/bin echo cd "$1" test
+export -eu x=1 readonly done /usr/bin cd && | "$1" /usr/bin
+		&& 'quoted text' sed awk sed echo printf x=1 x=1
+	&& ${HOME} x=1 && printf 2>/dev/null x=1 "$1" local echo echo x=1 printf export
+		grep sed printf 'quoted text'
+		local readonly awk | -eu $(pwd) export "$@" && ${HOME}
+		'quoted text' awk then /usr/bin x=1 -eu $(pwd) && grep 'quoted text' /usr/bin
+	then then sed "$1" 'quoted text' printf "$1" -eu done readonly
+		2>/dev/null --verbose --verbose done readonly echo done then awk $(pwd)
+x=1 x=1 then ${HOME} awk ${HOME} | ${HOME} echo 2>/dev/null
+		then --verbose /usr/bin ${HOME} sed /usr/bin && test -eu
+		done --verbose && "$@" && 2>/dev/null -eu echo ${HOME}
+readonly "$@" 'quoted text' --verbose cd /usr/bin --verbose
+		'quoted text' local "$@" 2>/dev/null
+		test -eu then 2>/dev/null
+local printf "$1" then cd -eu -eu
+		sed "$@" "$@" done "$1" && x=1 export
+		test ${HOME} 2>/dev/null ${HOME} x=1 ${HOME} --verbose test | /usr/bin
+	readonly then awk | "$@" printf x=1 "$@" echo && 2>/dev/null awk -eu printf
+		"$@" "$1" awk | export 'quoted text'
+	&& printf awk readonly echo echo x=1 grep "$1" printf done | sed
+	"$@" 2>/dev/null test | "$@" ${HOME}
+		'quoted text' readonly local "$1" /usr/bin echo x=1 --verbose "$@" /usr/bin printf
+	"$@" && "$@" 'quoted text'
+		${HOME} --verbose /usr/bin export done | 'quoted text' "$@" cd grep /usr/bin
+		grep echo "$1" echo sed sed readonly then /usr/bin && awk "$@"
+	/usr/bin 'quoted text' export sed echo done sed
+		printf then test awk local "$@" printf
+	done cd then $(pwd) /usr/bin echo | test test --verbose
+	local | awk sed 'quoted text' -eu grep test local "$1" && export -eu $(pwd) &&
+'quoted text' local done
+x=1 done echo awk "$@" echo export
+done --verbose done awk x=1 readonly -eu $(pwd) /usr/bin
+done readonly awk "$1" "$1" cd done /usr/bin -eu 2>/dev/null export /usr/bin
+sed "$@" then export readonly sed "$1" awk $(pwd) ${HOME}
+		awk --verbose | ${HOME} $(pwd) then && | then | done 'quoted text'
+done --verbose $(pwd)
+		| && && sed then printf --verbose
+printf sed readonly --verbose --verbose
+		| ${HOME} "$@" then x=1 /usr/bin echo cd echo cd -eu && cd -eu -eu ${HOME} --verbose
+		then awk x=1 grep readonly 'quoted text' awk export /usr/bin local
+| | printf /usr/bin --verbose printf && grep /usr/bin
+	local grep && export local awk echo grep 'quoted text' export /usr/bin
+2>/dev/null && ${HOME} test 2>/dev/null export readonly
+	cd readonly -eu 2>/dev/null x=1 done && $(pwd)
+		done "$@" printf export cd x=1 ${HOME}
+	"$1" cd 'quoted text' && test --verbose done &&
+		cd echo | $(pwd) local grep ${HOME} readonly | echo
+$(pwd) printf 2>/dev/null then "$1" x=1 readonly "$@" /usr/bin && ${HOME}
+		"$@" "$@" $(pwd) /usr/bin 2>/dev/null $(pwd) | test local
+	cd awk export printf "$1" printf /usr/bin
+	printf cd /usr/bin 2>/dev/null grep -eu --verbose local local grep "$1" sed 2>/dev/null
+		&& test test printf then cd grep local printf grep readonly readonly 'quoted text'
+		awk printf grep 'quoted text' printf &&
+printf sed "$1" 'quoted text' x=1 ${HOME} echo 2>/dev/null grep | /usr/bin
+		echo awk done 2>/dev/null local 'quoted text'
+		-eu | grep grep "$@" printf cd &&
+		"$1" | awk 2>/dev/null "$1" ${HOME}
+"$@" grep && $(pwd) readonly
+		echo test cd sed printf "$1"
+| then $(pwd) readonly /usr/bin local "$1" local done | test -eu local "$@"
+		then -eu test awk && readonly printf test cd test local cd done x=1
+&& /usr/bin ${HOME} echo
+		awk | test /usr/bin awk printf printf
+	awk | /usr/bin printf 2>/dev/null && --verbose ${HOME} export ${HOME}
+"$@" cd echo awk "$1" 2>/dev/null local 2>/dev/null /usr/bin
+		'quoted text' /usr/bin export export then
+	awk $(pwd) 'quoted text' local awk then --verbose /usr/bin
+		local /usr/bin "$@" readonly "$@" | --verbose 2>/dev/null
+	--verbose test 'quoted text' readonly
+| awk | grep | 'quoted text' --verbose
+'quoted text' local export test grep 'quoted text' $(pwd) grep | awk local
+		x=1 ${HOME} 2>/dev/null "$@" 'quoted text'
+test readonly done 2>/dev/null done local test grep 'quoted text' x=1
+	readonly grep export && "$@"
+	readonly done x=1 test awk test 'quoted text'
+		| readonly test grep echo 2>/dev/null cd printf /usr/bin /usr/bin done |
+	readonly x=1 sed sed readonly --verbose sed "$1" "$@" done "$@"
+	"$@" "$1" --verbose printf test "$1" ${HOME} && echo x=1 grep then
+	awk /usr/bin "$@" printf printf awk readonly cd "$1" echo | 2>/dev/null -eu
+		done $(pwd) /usr/bin x=1 done --verbose /usr/bin ${HOME} test then done
+	x=1 sed x=1 && 'quoted text'
+	&& echo cd done /usr/bin $(pwd) then /usr/bin echo /usr/bin sed printf cd
+	${HOME} /usr/bin | 2>/dev/null "$1" "$@" export local
+done echo 'quoted text'
+	printf cd "$@" grep $(pwd) done done /usr/bin then "$1" grep local cd
+readonly echo grep /usr/bin printf "$1" | 'quoted text' | 2>/dev/null
+grep | sed export done 2>/dev/null sed $(pwd) then "$1" readonly cd test ${HOME}
+-eu && sed --verbose && cd export echo awk export
+cd 2>/dev/null echo cd readonly sed test readonly
+'quoted text' done printf --verbose && $(pwd) local then --verbose "$@"
+	then then 2>/dev/null cd ${HOME} test $(pwd) readonly --verbose awk then
+"$@" test | then printf | x=1 x=1 $(pwd) && ${HOME} export readonly printf test
+	'quoted text' 2>/dev/null $(pwd) x=1
+		local /usr/bin sed readonly cd ${HOME} ${HOME} x=1 -eu -eu 'quoted text'
+${HOME} local | printf local sed printf
+&& test -eu cd export awk echo grep grep done "$@"
+		--verbose --verbose printf export export readonly 'quoted text'
+	2>/dev/null | printf grep | awk 2>/dev/null "$1" awk 2>/dev/null && --verbose
+	cd test test readonly ${HOME} "$1" "$@" /usr/bin
+		&& --verbose 2>/dev/null readonly awk -eu
+cd export test export readonly 'quoted text' export "$1" x=1 && |
+		export -eu grep then | export -eu then grep && awk /usr/bin
+		&& cd readonly awk printf sed echo && local --verbose grep
+		'quoted text' export test test awk
+printf && --verbose --verbose "$1" "$@" --verbose --verbose
+--verbose grep "$@" local 'quoted text' $(pwd) /usr/bin x=1 echo -eu $(pwd) then
+		--verbose "$1" 'quoted text' grep grep --verbose
+	/usr/bin $(pwd) done $(pwd) echo | && grep echo
+	awk x=1 readonly $(pwd) printf 2>/dev/null "$1" /usr/bin | done 2>/dev/null
+${HOME} done test $(pwd)
+	/usr/bin export ${HOME} $(pwd) 'quoted text' grep grep export then x=1 $(pwd)
+	| "$1" | export "$1" awk awk /usr/bin export export 2>/dev/null
+	-eu && local 'quoted text' -eu done awk grep test "$1" 'quoted text'
+	grep echo /usr/bin &&
+		cd 'quoted text' "$@" echo sed && echo local
+		&& test 'quoted text' awk
+	--verbose awk | /usr/bin --verbose local test --verbose test
+		sed $(pwd) && local | -eu test | $(pwd) grep test $(pwd)
+	local export printf --verbose awk test 'quoted text'
+	"$1" then then $(pwd) $(pwd) "$@" local echo "$1" 2>/dev/null readonly -eu test
+$(pwd) export ${HOME} ${HOME}
+	then then done done && "$1" "$@" readonly
+		&& local cd test 'quoted text'
+"$@" then echo x=1 ${HOME} -eu $(pwd) --verbose
+test "$@" done printf
+	done --verbose 2>/dev/null test done cd --verbose --verbose
+${HOME} ${HOME} then x=1 -eu /usr/bin "$1"
+	done grep x=1 export echo awk printf && export grep test export
+	local | then "$1" x=1 $(pwd) readonly
+	-eu printf printf --verbose $(pwd) printf 'quoted text' local
+	readonly /usr/bin -eu $(pwd)
+		cd ${HOME} awk $(pwd) --verbose echo x=1 grep export ${HOME} cd awk
+	then printf $(pwd) 'quoted text' $(pwd) test x=1 $(pwd) | /usr/bin "$@"
+		| awk x=1 export then "$@" "$@" --verbose -eu awk x=1 'quoted text'
+	readonly cd && local awk local $(pwd) 2>/dev/null test then
+		| 'quoted text' && echo 'quoted text' "$@" -eu $(pwd) echo readonly x=1
+	| local -eu "$1" done local export grep
+	-eu "$@" /usr/bin | | awk && echo && done ${HOME} --verbose local x=1 export
+	--verbose done 2>/dev/null readonly done | "$@" readonly
+	test 2>/dev/null done "$@" local awk test | $(pwd) && | done "$1" 2>/dev/null
+	'quoted text' awk export test test
+	printf && echo awk ${HOME} grep then "$@" printf local
+		then grep "$@" "$@" then printf test test --verbose "$@"
+		x=1 $(pwd) readonly then export sed | printf export local --verbose
+		awk --verbose x=1 -eu 'quoted text' $(pwd) --verbose printf
+&& | /usr/bin printf $(pwd) /usr/bin "$1"
+	'quoted text' $(pwd) 2>/dev/null
+	local local echo | test && export local
+'quoted text' "$@" "$1" 2>/dev/null 2>/dev/null local 'quoted text' "$@"
+		-eu grep "$1" readonly printf "$1" test export
+| | "$@" printf sed grep
+	"$1" $(pwd) $(pwd) | export ${HOME} local
+	"$@" awk $(pwd) && cd readonly printf --verbose -eu
+'quoted text' readonly | && x=1 ${HOME} local readonly
+local ${HOME} 'quoted text' done sed printf ${HOME}
+		x=1 sed cd 'quoted text' 2>/dev/null
+		readonly test /usr/bin && /usr/bin "$1" "$@"
+	then 'quoted text' test
+	printf echo "$1" 'quoted text' "$1" 2>/dev/null then readonly test readonly sed
+	${HOME} cd $(pwd) done ${HOME} 2>/dev/null 'quoted text'
+		"$1" then readonly "$1" cd "$@" awk readonly "$@" printf && 'quoted text'
+readonly local /usr/bin export 'quoted text' "$@" printf printf echo test awk
+'quoted text' | -eu then ${HOME}
+--verbose local $(pwd) printf sed 2>/dev/null
+	done sed cd printf test
+	--verbose | | sed --verbose sed && test
+	2>/dev/null test "$@" echo $(pwd) 2>/dev/null local 'quoted text' "$1"
+/usr/bin 2>/dev/null export done printf 2>/dev/null
+		grep test export /usr/bin sed $(pwd) x=1 -eu test done grep "$@" $(pwd)
+		-eu sed "$@" 'quoted text' readonly
+--verbose test cd $(pwd) sed /usr/bin then ${HOME} then $(pwd)
+export sed | export ${HOME} "$@" sed x=1 x=1 'quoted text'
+		${HOME} --verbose && done && --verbose export grep awk printf $(pwd)
+		test "$1" cd done export done done then printf "$@"
+	then then then ${HOME} x=1 2>/dev/null local local
+	test test | $(pwd) cd && && awk $(pwd) && &&
+&& echo ${HOME} ${HOME} | echo 2>/dev/null "$1" cd export
+		cd x=1 grep $(pwd) $(pwd) done "$@" | && readonly printf "$1" ${HOME} "$1" export
+	| 2>/dev/null done local export
+		grep /usr/bin grep /usr/bin 2>/dev/null
+	done "$1" local awk x=1 | ${HOME} local
+"$@" /usr/bin 'quoted text' done | ${HOME} $(pwd) cd
+	printf printf then sed ${HOME} ${HOME} awk 'quoted text' local local
+export then export && local printf echo -eu "$@"
+	-eu | && -eu readonly -eu $(pwd) awk -eu then "$@" -eu local
+		awk export local "$1" printf grep 2>/dev/null printf done ${HOME}
+	&& printf done grep 'quoted text' "$@" 2>/dev/null $(pwd) grep 'quoted text'
+		x=1 "$1" local x=1 "$1" cd -eu export
+-eu then $(pwd) | test export cd grep readonly ${HOME} done | echo $(pwd)
+	"$@" /usr/bin "$@" local ${HOME} -eu 'quoted text'
+/usr/bin x=1 done --verbose "$1" $(pwd) grep && -eu "$@" printf "$@" echo ${HOME}
+2>/dev/null readonly sed -eu cd export local && "$@" $(pwd)
+	"$1" local "$@" local x=1
+&& 'quoted text' 'quoted text' printf && "$1" readonly
+"$1" echo --verbose local grep
+	test --verbose 2>/dev/null readonly echo readonly printf
+awk echo | export test test
+	test sed | readonly cd test local sed printf cd x=1
+	awk sed | awk | 2>/dev/null | "$@" grep sed && -eu local | 'quoted text'
+grep readonly --verbose "$1" awk && 'quoted text' --verbose
+local export local -eu test && export --verbose 'quoted text' x=1 "$1" && sed grep
+	done 2>/dev/null $(pwd) sed "$@" grep && echo /usr/bin 'quoted text' export
+	awk then | test awk local "$1" sed /usr/bin
+	awk x=1 "$1" | x=1 "$1" 'quoted text' && $(pwd) echo
+		| x=1 | | readonly ${HOME} x=1 echo "$1" $(pwd) local
+$(pwd) grep grep test "$1" sed -eu ${HOME}
+/usr/bin test | readonly x=1 2>/dev/null
+x=1 done 2>/dev/null 'quoted text' "$1" awk /usr/bin local --verbose
+		/usr/bin x=1 printf 2>/dev/null ${HOME} awk "$1"
+	$(pwd) readonly && 'quoted text' ${HOME} awk "$@" "$1"
+		-eu && grep grep "$@" -eu grep
+/usr/bin test export && --verbose | test sed "$1"
+	export test 'quoted text' cd test "$@"
+	&& export 'quoted text' cd export "$1" && $(pwd)
+2>/dev/null "$1" 'quoted text' x=1 test done echo 'quoted text' $(pwd)
+$(pwd) sed -eu x=1 "$@" readonly export awk then "$1" echo /usr/bin "$@"
+		cd x=1 ${HOME} then /usr/bin
+local 2>/dev/null /usr/bin export "$1" 2>/dev/null
+	done x=1 sed | 2>/dev/null readonly echo then -eu -eu readonly local export
+		awk test -eu cd done "$1" x=1 2>/dev/null |
+cd | cd test | 2>/dev/null ${HOME} sed local | done export local local
+		2>/dev/null $(pwd) then "$@" && -eu then echo readonly ${HOME}
+		2>/dev/null $(pwd) -eu awk export then "$@" readonly
+awk local test -eu cd "$@" local test echo grep awk "$@"
+		echo then awk "$@" x=1 $(pwd) then awk 2>/dev/null && | $(pwd) grep 2>/dev/null
+grep done "$@" cd "$1" "$@" test readonly | /usr/bin echo sed 2>/dev/null
+	| then $(pwd) "$1" $(pwd) $(pwd) printf grep export &&
+		cd echo -eu x=1 echo | |
+/usr/bin $(pwd) /usr/bin readonly "$@" | echo ${HOME} 2>/dev/null 'quoted text'
+		2>/dev/null done -eu 2>/dev/null
+		"$@" echo done --verbose 2>/dev/null sed /usr/bin
+${HOME} local then && "$1" then sed -eu && awk x=1 2>/dev/null
+	echo done $(pwd) then | awk done grep --verbose done $(pwd) x=1 -eu echo
+-eu local printf --verbose echo then
+&& "$1" then printf && awk done export -eu then cd $(pwd) echo
+	/usr/bin "$@" "$@" test 'quoted text'
+echo -eu ${HOME} echo printf x=1 grep --verbose /usr/bin x=1 x=1 printf 2>/dev/null
+		printf -eu /usr/bin "$1" --verbose $(pwd) printf && | then grep readonly
+2>/dev/null 'quoted text' x=1 test && sed "$@" test
+	--verbose 'quoted text' "$@" 'quoted text' | sed --verbose 2>/dev/null
+&& /usr/bin 2>/dev/null grep ${HOME}
+		--verbose export sed sed "$@" test cd 'quoted text'
+readonly $(pwd) "$1" "$@" 2>/dev/null then ${HOME} then 2>/dev/null
+${HOME} "$1" $(pwd) "$@" echo awk printf then /usr/bin
+	x=1 -eu echo && $(pwd) printf
+	readonly test && local
+	'quoted text' "$@" -eu -eu
+"$1" cd then /usr/bin awk 'quoted text' done "$1" then test -eu
+		then test sed echo readonly --verbose readonly 'quoted text' export
+	cd test /usr/bin readonly 2>/dev/null export --verbose /usr/bin sed -eu readonly
+$(pwd) test --verbose done readonly grep x=1 then sed 2>/dev/null ${HOME} echo
+-eu ${HOME} local ${HOME} --verbose ${HOME} echo "$1" /usr/bin local
+	grep cd 'quoted text' local sed done && done $(pwd) sed printf
+	awk ${HOME} echo done cd 'quoted text'
+awk ${HOME} echo done then readonly /usr/bin test then "$1"
+readonly $(pwd) test x=1 && ${HOME} cd awk local echo done
+	--verbose $(pwd) readonly 'quoted text'
+		${HOME} 2>/dev/null done done local done awk $(pwd) readonly "$1" /usr/bin
+	'quoted text' cd 'quoted text' cd -eu
+	-eu "$@" /usr/bin ${HOME} grep -eu awk readonly local readonly cd 2>/dev/null
+	$(pwd) "$1" 2>/dev/null test ${HOME} 'quoted text'
+		echo "$1" 2>/dev/null --verbose 'quoted text' $(pwd) export export "$1" test then
+		2>/dev/null | /usr/bin awk grep x=1
+		$(pwd) && done sed readonly
+	grep local grep /usr/bin ${HOME} "$1" "$@" 2>/dev/null
+printf sed $(pwd) echo ${HOME} | ${HOME} printf
+-eu local x=1 --verbose
+		"$1" $(pwd) && 2>/dev/null grep readonly local &&
+		${HOME} awk echo export then "$@" 2>/dev/null "$1"
+	x=1 x=1 -eu /usr/bin x=1 ${HOME} $(pwd) x=1 readonly | printf "$1" 2>/dev/null
+"$1" test test "$1" --verbose
+then local x=1 'quoted text' echo awk &&
+		then grep awk grep echo cd &&
+	done | && then awk -eu && | cd readonly --verbose
+		'quoted text' then readonly $(pwd) export /usr/bin 'quoted text' "$@"
+	-eu x=1 2>/dev/null && local 'quoted text' grep export export done
+2>/dev/null "$@" done readonly $(pwd)
+awk 2>/dev/null local --verbose 2>/dev/null echo "$@" local "$@" $(pwd) /usr/bin
+	--verbose printf /usr/bin local "$1" done --verbose printf 2>/dev/null
+		echo grep export awk then export cd then
+	--verbose && grep export -eu
+--verbose readonly local then 2>/dev/null then 2>/dev/null local
+		| grep --verbose test "$1" echo
+"$1" awk export $(pwd) awk
+	export local -eu then 2>/dev/null ${HOME} local -eu test | export then grep x=1
+		then awk "$1" test 2>/dev/null echo export --verbose --verbose cd /usr/bin 2>/dev/null
+	done grep export | echo
+		x=1 /usr/bin --verbose grep "$@" sed -eu cd /usr/bin /usr/bin then 'quoted text'
+| "$@" printf done echo -eu local -eu done $(pwd) done
+test -eu printf grep sed "$1" "$1" export ${HOME} then
+	$(pwd) echo ${HOME} 2>/dev/null x=1 x=1 'quoted text'
+		"$@" export echo test 2>/dev/null "$@" echo echo grep && sed
+then cd then /usr/bin sed
+		--verbose export -eu | x=1 x=1 printf
+	$(pwd) --verbose then ${HOME} x=1 test /usr/bin printf "$1"
+/usr/bin "$@" 2>/dev/null | $(pwd) done 'quoted text'
+"$1" grep grep $(pwd) x=1 printf ${HOME} | | done "$1" awk
+"$@" awk ${HOME} awk /usr/bin --verbose 'quoted text'
+	sed /usr/bin | 2>/dev/null
+	export sed x=1 && export ${HOME} 'quoted text' "$@" -eu awk done "$@"
+	cd 'quoted text' readonly echo echo
+		readonly awk --verbose $(pwd) "$@" echo
+	-eu $(pwd) ${HOME} readonly done --verbose
+then grep echo --verbose grep test x=1 test /usr/bin $(pwd) "$@" echo export
+$(pwd) "$@" printf $(pwd) 'quoted text' x=1
+	"$@" | "$1" $(pwd) done readonly --verbose local 2>/dev/null grep
+	2>/dev/null then done export test sed grep then export -eu 'quoted text' /usr/bin
+	printf printf /usr/bin echo sed awk x=1 --verbose --verbose "$1" -eu
+		"$@" x=1 x=1 export && printf "$@" && x=1 local
+	awk printf sed sed cd | x=1 x=1 && --verbose "$@" /usr/bin
+| readonly | then $(pwd) "$@" done x=1 cd export
+		echo echo awk -eu export | test && --verbose "$1" done -eu echo -eu ${HOME}
+echo -eu export sed awk x=1 sed export $(pwd) x=1
+	echo /usr/bin --verbose "$1"
+awk | grep ${HOME} cd awk test grep 2>/dev/null
+"$@" printf /usr/bin echo readonly grep x=1 readonly | $(pwd) | -eu "$1" "$1"
+	sed x=1 'quoted text' 'quoted text' x=1
+/usr/bin /usr/bin "$1" --verbose /usr/bin
+x=1 grep awk -eu "$1" "$@" 2>/dev/null --verbose then 2>/dev/null awk awk
+	then -eu done local | 'quoted text' && 2>/dev/null --verbose
+	done | -eu printf grep local test done $(pwd) /usr/bin --verbose
+		2>/dev/null $(pwd) then cd &&
+		awk readonly /usr/bin && sed grep ${HOME} sed awk readonly
+-eu x=1 cd /usr/bin 2>/dev/null
+		sed 'quoted text' export sed
+	awk grep ${HOME} 'quoted text' sed local ${HOME} grep
+		cd local echo "$1" && --verbose then --verbose export test && export
+		done "$@" /usr/bin awk readonly cd $(pwd) cd 2>/dev/null readonly -eu then ${HOME}
+		| 2>/dev/null test "$@" | echo awk "$@"
+printf grep export "$@" "$1" "$@" 'quoted text'
+local | 'quoted text' | --verbose 'quoted text' 'quoted text' | x=1
+	echo && export grep -eu /usr/bin grep cd ${HOME} |
+	| local $(pwd) /usr/bin x=1 grep export && && /usr/bin printf /usr/bin $(pwd)
+		echo export | "$1" --verbose 2>/dev/null local test then "$@" export 'quoted text'
+		local "$@" ${HOME} && 2>/dev/null /usr/bin local "$1" then
+--verbose then --verbose /usr/bin "$1" then printf export /usr/bin ${HOME}
+	| cd && cd export done ${HOME} ${HOME} 'quoted text'
+	| "$1" then "$1" done done 2>/dev/null test cd test
+--verbose done test 2>/dev/null
+	x=1 done x=1 local readonly awk "$1" "$1" test
+cd "$@" x=1 'quoted text' | awk then "$1" x=1 sed
+2>/dev/null echo then "$1" local 2>/dev/null
+	grep ${HOME} awk "$@" && echo /usr/bin
+'quoted text' 'quoted text' readonly
+		export 2>/dev/null -eu echo printf export ${HOME} x=1 &&
+		&& then then awk then 'quoted text' -eu x=1 'quoted text' | echo
+	done | "$1" then printf sed readonly ${HOME}
+		readonly --verbose ${HOME} /usr/bin then "$@" -eu $(pwd) done echo
+	/usr/bin awk $(pwd) cd grep
+	printf awk echo echo -eu sed local "$1" 2>/dev/null
+		2>/dev/null grep x=1 printf x=1 sed $(pwd) echo export -eu && 'quoted text'
+	echo 'quoted text' /usr/bin sed --verbose 'quoted text' && "$1" printf
+		grep test x=1 && -eu $(pwd) export
+local local x=1 grep ${HOME} x=1 awk 2>/dev/null
+test ${HOME} | done ${HOME} && --verbose | test
+	x=1 then /usr/bin echo "$@" done awk && grep sed echo grep x=1
+		cd awk --verbose "$1" | ${HOME} grep grep --verbose cd export
+	then printf ${HOME} local echo done $(pwd)
+		echo readonly then | && x=1 printf /usr/bin ${HOME} "$@" local
+	"$@" echo "$1" && "$1" ${HOME} done "$1" local done echo "$@" 2>/dev/null
+		"$@" /usr/bin -eu printf readonly local awk 'quoted text' ${HOME}
+$(pwd) /usr/bin cd export grep $(pwd) grep 2>/dev/null printf
+	echo test done | --verbose test cd cd then local echo then $(pwd) local
+2>/dev/null ${HOME} x=1 sed /usr/bin && then printf
+awk $(pwd) 2>/dev/null /usr/bin
+x=1 export | cd awk 2>/dev/null echo x=1 &&
+"$@" grep && "$@" awk printf then printf
+grep sed export grep x=1 printf then sed cd /usr/bin $(pwd)
+printf | then && 'quoted text' printf && 'quoted text'
+2>/dev/null test $(pwd) "$1" done awk | /usr/bin echo
+	| "$1" readonly -eu sed "$1" export
+		| $(pwd) sed 'quoted text' test cd grep readonly
+$(pwd) awk "$1" echo done /usr/bin "$1" printf echo cd
+		printf /usr/bin "$@" $(pwd) --verbose 2>/dev/null printf 'quoted text'
+printf test readonly | | && printf "$@" /usr/bin printf test test
+		awk cd $(pwd) -eu 2>/dev/null cd export
+		echo echo && /usr/bin | grep x=1 x=1 "$@" --verbose test readonly x=1 grep
+	cd 'quoted text' echo then ${HOME} ${HOME} awk export 'quoted text'
+		awk cd /usr/bin 'quoted text' /usr/bin "$@" "$@"
+	awk grep x=1 test cd "$1"
+"$@" -eu && | test 'quoted text' test && printf sed done
+	&& then "$1" echo --verbose cd | x=1 'quoted text' grep readonly
+		'quoted text' $(pwd) then readonly "$@" export
+done awk && done echo | ${HOME} export done /usr/bin done
+		then ${HOME} test echo 'quoted text' /usr/bin --verbose
+		$(pwd) 2>/dev/null -eu "$1" --verbose && ${HOME} test
+		test /usr/bin export grep cd
+${HOME} $(pwd) grep /usr/bin grep 2>/dev/null
+	done --verbose 2>/dev/null sed --verbose -eu --verbose $(pwd) readonly
+test readonly echo readonly test echo cd awk awk echo --verbose x=1 -eu
+readonly local grep 'quoted text' echo echo "$1" readonly x=1
+	echo /usr/bin sed cd export readonly done printf done sed | export done --verbose
+		export echo test local ${HOME} $(pwd) done
+echo /usr/bin $(pwd) awk printf 2>/dev/null | readonly then "$1" done ${HOME}
+		awk done && && /usr/bin local x=1 "$@" 'quoted text' | sed 2>/dev/null
+		x=1 export "$1" local grep 2>/dev/null local export $(pwd)
+readonly "$1" done sed && 'quoted text' ${HOME} 2>/dev/null 2>/dev/null
+		printf then grep "$1" | | $(pwd) x=1 export -eu cd done readonly
+		'quoted text' "$1" 2>/dev/null done | ${HOME} 2>/dev/null
+	test then cd cd cd 2>/dev/null test -eu $(pwd) sed awk "$1"
+		readonly -eu "$1" test local readonly $(pwd) ${HOME}
+		${HOME} cd grep && x=1 --verbose
+"$1" grep --verbose "$@" awk cd done done $(pwd) readonly /usr/bin export export
+	-eu printf local test $(pwd) | 'quoted text' "$1" then test printf -eu cd "$1"
+	done /usr/bin local printf ${HOME} | -eu
+		done readonly | "$@" ${HOME} then -eu local done | ${HOME}
+awk /usr/bin sed readonly local && 'quoted text'
+	awk test cd export ${HOME} "$1" readonly x=1 -eu | cd x=1 awk
+done awk "$@" "$@" $(pwd) then -eu 'quoted text'
+then x=1 "$1" 2>/dev/null 'quoted text' x=1 $(pwd)
+	grep done 2>/dev/null && printf "$@" then 'quoted text' awk
+then x=1 "$@" $(pwd)
+readonly test "$1" $(pwd) ${HOME} 2>/dev/null awk && readonly
+$(pwd) && test export "$1" --verbose && | ${HOME}
+	"$@" -eu 'quoted text' cd grep grep "$1" then 'quoted text' /usr/bin
+| -eu cd ${HOME} x=1 printf local -eu export cd awk x=1
+		/usr/bin local ${HOME} grep $(pwd) && test grep then awk 2>/dev/null
+${HOME} printf ${HOME} test
+	local $(pwd) awk 2>/dev/null
+		--verbose sed ${HOME} ${HOME} sed cd readonly then /usr/bin ${HOME} "$1"
+		done done 2>/dev/null export test 2>/dev/null then test &&
+	sed 'quoted text' done $(pwd)
+		| | | 'quoted text' done grep && then readonly printf then | 'quoted text'
+	sed ${HOME} -eu test readonly grep test then
+	${HOME} 'quoted text' sed --verbose -eu --verbose echo $(pwd) 'quoted text'
+x=1 grep export test test 2>/dev/null export test
+		test readonly printf /usr/bin
+		"$@" done echo awk --verbose readonly grep $(pwd)
+		export 'quoted text' && grep $(pwd) cd
+done --verbose x=1 2>/dev/null --verbose done readonly echo && awk --verbose
+	/usr/bin export printf done test export echo awk readonly echo readonly
+		sed done ${HOME} grep awk
+	test grep grep awk done cd
+		"$@" done "$1" export done
+		cd done export 2>/dev/null "$@" awk "$1" echo --verbose then export printf
+awk 2>/dev/null then grep "$@" $(pwd)
+	then then | --verbose done --verbose | $(pwd) readonly /usr/bin cd awk cd cd /usr/bin
+	x=1 'quoted text' "$@" -eu sed "$1" grep grep echo printf $(pwd) ${HOME} printf
+/usr/bin /usr/bin cd echo readonly 'quoted text'
+sed export | "$@" /usr/bin --verbose "$@" sed --verbose && printf echo
+${HOME} cd x=1 x=1 x=1 awk $(pwd)
+"$1" 2>/dev/null grep local x=1 test echo sed then && --verbose "$1"
+echo awk awk | $(pwd) export $(pwd) -eu export 2>/dev/null printf grep 2>/dev/null
+	readonly /usr/bin echo $(pwd) printf export 'quoted text' then 'quoted text'
+	&& done done then 'quoted text' printf | sed 2>/dev/null /usr/bin
+		local grep ${HOME} awk
+		x=1 cd --verbose local export test echo --verbose test | readonly /usr/bin &&
+		2>/dev/null x=1 grep cd /usr/bin cd 'quoted text' /usr/bin test --verbose
+		&& readonly echo sed export printf 2>/dev/null -eu $(pwd)
+${HOME} 'quoted text' "$1"
+		cd /usr/bin done ${HOME} local sed then -eu printf then "$@" $(pwd) echo -eu
+	-eu --verbose $(pwd) cd test sed "$@" echo "$1" | 2>/dev/null
+-eu x=1 2>/dev/null export local readonly readonly cd done "$@" local
+	"$1" echo done "$@" done test "$@" cd sed "$1" echo
+	"$1" "$@" echo then 2>/dev/null echo | test then "$@" printf | printf export
+		--verbose printf test grep sed echo grep "$@" $(pwd) sed
+		test -eu "$@" --verbose grep readonly
+"$@" x=1 -eu "$1" readonly then then | sed 'quoted text'
+'quoted text' local "$1" test | local /usr/bin then then $(pwd) echo ${HOME}
+	| "$@" $(pwd) /usr/bin ${HOME} echo x=1 cd "$@" "$@" "$1" && local ${HOME}
+	${HOME} --verbose echo awk awk sed
+		local $(pwd) echo --verbose x=1 grep export $(pwd) echo 'quoted text'
+		then cd awk --verbose
+$(pwd) export awk | /usr/bin
+		cd cd 'quoted text' local export grep printf 2>/dev/null then --verbose
+	printf grep 2>/dev/null -eu local && done export $(pwd) /usr/bin --verbose x=1
+		printf grep sed printf cd -eu then readonly
+		"$1" 2>/dev/null then /usr/bin grep ${HOME} 2>/dev/null awk /usr/bin done | ${HOME}
+| "$@" "$1" -eu && export readonly sed
+	local | /usr/bin sed -eu echo printf | x=1 && then --verbose
+		readonly "$1" --verbose -eu 'quoted text' x=1 ${HOME} && -eu printf sed --verbose
+		local export export 'quoted text' readonly
+	/usr/bin "$@" local echo /usr/bin --verbose
+		cd x=1 "$1" local --verbose printf --verbose echo x=1 awk
+	export ${HOME} -eu awk && readonly
+		"$1" awk "$1" sed "$1" ${HOME} readonly && cd 2>/dev/null awk local 'quoted text'
+--verbose 2>/dev/null && ${HOME}
+echo cd /usr/bin awk local export x=1 then "$@" readonly local grep
+/usr/bin ${HOME} awk "$@" printf | cd printf -eu $(pwd) awk 'quoted text' printf
+	readonly then cd /usr/bin printf $(pwd) 2>/dev/null export ${HOME}
+		export | local awk readonly 2>/dev/null "$@" && $(pwd) local sed local grep printf
+		/usr/bin readonly /usr/bin -eu echo -eu cd export ${HOME} export
+2>/dev/null readonly readonly grep cd && 'quoted text'
+sed /usr/bin | /usr/bin printf then "$@" "$1" && grep $(pwd) cd
+	awk "$@" 2>/dev/null ${HOME} "$1" test
+		readonly local local cd cd printf done test grep
+readonly /usr/bin sed sed local
+	--verbose -eu 'quoted text' sed /usr/bin -eu sed --verbose then readonly
+		x=1 sed grep && sed "$@" 2>/dev/null $(pwd) grep "$@" local x=1 export done readonly
+		awk -eu test "$@" then ${HOME} 'quoted text' sed then awk ${HOME}
+then /usr/bin readonly /usr/bin | printf test
+		done grep --verbose local grep grep done ${HOME} 2>/dev/null then awk 'quoted text'
+${HOME} x=1 /usr/bin printf test export sed sed $(pwd)
+		export "$1" | 2>/dev/null 2>/dev/null | then then "$1" 2>/dev/null ${HOME}
+readonly | echo sed awk "$1" export local $(pwd) "$1" && "$@" ${HOME} printf -eu
+	printf cd | export readonly "$@" echo then $(pwd)
+	/usr/bin readonly grep echo cd 2>/dev/null local done 'quoted text' printf
+grep done -eu $(pwd) 2>/dev/null readonly
+	x=1 readonly awk test | readonly |
+done sed printf printf test ${HOME} 'quoted text'
+$(pwd) /usr/bin done /usr/bin /usr/bin
+$(pwd) grep $(pwd) grep
+"$1" --verbose /usr/bin cd -eu awk | --verbose && 'quoted text' awk done then
+	--verbose "$@" "$@" 2>/dev/null 'quoted text' ${HOME} then sed then readonly echo
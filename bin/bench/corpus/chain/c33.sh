@@ -0,0 +1,2001 @@
+	done local ${HOME} x=1 | | local ${HOME} done then done readonly && grep test
+	awk | printf --verbose local --verbose --verbose then export /usr/bin |
+		cd -eu local /usr/bin grep /usr/bin then
+	printf echo readonly grep
+		--verbose awk local readonly done ${HOME}
+		"$1" -eu $(pwd) readonly local sed | echo test
+	| done export grep "$@" 2>/dev/null x=1 readonly readonly
+		-eu grep ${HOME} "$1" | "$1"
+	cd ${HOME} sed awk done --verbose && x=1 grep echo
+	export done && awk 2>/dev/null -eu /usr/bin "$@" x=1 && | awk ${HOME} local $(pwd)
+	| | test 'quoted text' local
+grep | echo awk /usr/bin echo --verbose -eu then then /usr/bin readonly
+		--verbose readonly local 2>/dev/null awk local ${HOME} grep $(pwd) sed local
+awk /usr/bin /usr/bin export ${HOME} "$@"
+	&& --verbose local printf then | x=1 echo
+		/usr/bin local | 2>/dev/null test printf x=1 | done export && 2>/dev/null
+	2>/dev/null -eu "$@" then export && "$@" echo "$@" --verbose | done grep
+	export 2>/dev/null x=1 sed readonly && | local
+		printf local readonly 2>/dev/null awk
+		grep "$1" readonly test /usr/bin x=1 awk export 'quoted text'
+		sed grep export $(pwd) "$1" | /usr/bin grep export x=1 test x=1 2>/dev/null
+		local --verbose test awk $(pwd) grep readonly echo
+	"$1" "$@" test /usr/bin then /usr/bin
+	| /usr/bin --verbose sed && x=1 && x=1 export done local 2>/dev/null
+	sed && --verbose done awk export test
+	sed local sed -eu grep test "$1"
+		x=1 2>/dev/null "$1" echo done 2>/dev/null local local && export
+		--verbose test && local "$1" | | | --verbose /usr/bin --verbose
+		${HOME} -eu $(pwd) readonly "$1" sed grep "$1"
+export grep $(pwd) "$@" export && --verbose export sed "$@" export --verbose -eu
+		printf awk grep test test awk
+	--verbose test cd readonly awk test x=1 && sed cd "$1"
+"$1" /usr/bin | x=1 x=1 printf
+	local then cd readonly then $(pwd) ${HOME}
+2>/dev/null && grep then grep $(pwd) /usr/bin awk done local $(pwd) | cd "$@"
+	-eu 2>/dev/null /usr/bin x=1 "$1" -eu x=1 && echo local readonly
+test local x=1 /usr/bin -eu cd grep local then sed cd awk export cd
+x=1 export echo 2>/dev/null | export | | grep 'quoted text'
+		"$1" echo grep /usr/bin awk then then grep 'quoted text' x=1 "$@" echo 2>/dev/null
+test cd grep && | cd then && 2>/dev/null
+		$(pwd) $(pwd) awk && "$1" 2>/dev/null then x=1
+		then x=1 'quoted text' | done local x=1 'quoted text' cd 2>/dev/null | --verbose
+	local grep && cd && export 'quoted text'
+'quoted text' then readonly ${HOME}
+	| test local then then export $(pwd) ${HOME} local x=1 && local 2>/dev/null
+| --verbose sed sed local done local
+'quoted text' x=1 2>/dev/null sed "$1"
+--verbose done sed local then | echo /usr/bin | cd
+		grep /usr/bin | echo --verbose cd 2>/dev/null --verbose
+		2>/dev/null done ${HOME} printf "$@" local "$@" grep /usr/bin --verbose --verbose
+printf grep printf "$1" "$@" && && awk /usr/bin && grep grep done 2>/dev/null
+sed --verbose done printf -eu $(pwd) -eu
+		| /usr/bin cd -eu then $(pwd) 2>/dev/null export cd 2>/dev/null
+		local test local awk export "$1" echo done "$@" awk ${HOME} export ${HOME}
+	2>/dev/null export echo done "$@" grep awk done "$1" cd readonly
+	local export $(pwd) "$@" 'quoted text' | test && | done grep "$@"
+	grep then x=1 readonly test
+	local local echo $(pwd) x=1 done
+		done readonly && 2>/dev/null /usr/bin done sed $(pwd) echo $(pwd) 'quoted text'
+local x=1 then "$1" readonly
+'quoted text' /usr/bin test sed && cd x=1 awk grep "$1" 2>/dev/null awk done
+awk echo "$@" $(pwd) cd | "$@" 'quoted text' done /usr/bin
+	$(pwd) test echo grep grep
+cd local echo readonly
+	$(pwd) export awk done export --verbose sed sed readonly && 2>/dev/null 2>/dev/null
+		$(pwd) then awk $(pwd) readonly awk done export local $(pwd) sed grep test
+	echo local 'quoted text' local grep
+then && | x=1 "$@" export 'quoted text' sed /usr/bin x=1
+	$(pwd) && 'quoted text' local "$@" cd ${HOME} && && 2>/dev/null
+done && then then "$@" then /usr/bin | $(pwd) readonly cd "$@" awk
+		test sed "$@" then --verbose x=1 "$1" then
+| -eu && --verbose "$@" sed "$@" /usr/bin
+	| readonly && readonly 2>/dev/null
+	then done $(pwd) then $(pwd) "$@" cd awk awk
+	"$1" | 'quoted text' | | && --verbose grep grep
+		-eu sed /usr/bin grep sed test
+${HOME} | --verbose done
+		-eu readonly | echo "$@" --verbose 2>/dev/null
+printf cd grep printf done x=1 | /usr/bin && "$@" sed x=1 $(pwd)
+grep awk -eu --verbose export 'quoted text'
+-eu readonly | export 'quoted text' 2>/dev/null "$1" && readonly
+	--verbose $(pwd) sed 'quoted text' export then $(pwd) test ${HOME} grep "$1"
+echo $(pwd) cd export && done ${HOME} x=1 --verbose && 2>/dev/null test sed
+	echo then awk done && x=1 2>/dev/null 2>/dev/null grep --verbose x=1
+	export local --verbose x=1 local awk | ${HOME} echo
+		sed readonly 2>/dev/null --verbose cd $(pwd) echo then test --verbose export
+	x=1 x=1 "$1" local | "$1" cd
+		export test $(pwd) local local awk grep 'quoted text' done export 'quoted text'
+	/usr/bin echo test -eu x=1 grep echo echo awk printf
+	--verbose --verbose grep test then done done /usr/bin
+test grep && printf | | awk test ${HOME} 'quoted text' test ${HOME} $(pwd)
+$(pwd) then 2>/dev/null "$1" readonly awk --verbose
+sed test then -eu /usr/bin "$1" "$@" export ${HOME}
+		then -eu cd && $(pwd) then /usr/bin echo $(pwd) export readonly
+| done $(pwd) test && "$@" local
+readonly x=1 && grep sed export && echo readonly --verbose done
+	x=1 grep awk 'quoted text' echo && echo grep
+	readonly printf /usr/bin $(pwd) "$1" 'quoted text'
+		export /usr/bin readonly 2>/dev/null printf && 2>/dev/null /usr/bin
+		"$1" printf x=1 "$@" ${HOME} printf test | $(pwd) local /usr/bin sed /usr/bin
+	2>/dev/null test | -eu export "$1" grep
+		done ${HOME} grep export cd && $(pwd) --verbose
+		-eu done --verbose -eu test "$@" local printf
+x=1 export && readonly $(pwd) | && awk
+		local test ${HOME} x=1 $(pwd) then 'quoted text'
+	then then --verbose $(pwd) grep then cd export "$1" 2>/dev/null
+		readonly --verbose "$1" "$1" printf cd test /usr/bin test
+${HOME} sed -eu 2>/dev/null
+	readonly then -eu then sed local export awk 2>/dev/null
+	x=1 $(pwd) ${HOME} "$1" grep /usr/bin
+		cd cd $(pwd) ${HOME} sed /usr/bin printf "$@"
+		$(pwd) 2>/dev/null cd echo
+		printf readonly awk -eu 2>/dev/null
+		'quoted text' grep "$1" readonly done 2>/dev/null awk |
+test test "$1" ${HOME} && | cd sed readonly readonly "$1" test
+	"$@" x=1 printf then | then done
+"$@" test cd $(pwd) grep then | -eu "$@" printf
+	2>/dev/null done local 'quoted text' test -eu export --verbose grep test awk
+/usr/bin $(pwd) test then x=1 $(pwd) "$1" grep done sed local awk /usr/bin readonly
+echo local test && then grep -eu
+/usr/bin $(pwd) 'quoted text'
+		| "$@" ${HOME} "$@" -eu done x=1 x=1 ${HOME}
+	2>/dev/null --verbose 'quoted text' awk /usr/bin
+	test export /usr/bin 2>/dev/null readonly x=1 ${HOME} x=1 /usr/bin
+		$(pwd) printf then x=1 grep "$@" ${HOME} sed sed test local | -eu -eu local
+	&& 'quoted text' && echo -eu sed /usr/bin
+--verbose awk && test 'quoted text'
+		"$1" x=1 x=1 sed local $(pwd) then "$@"
+	local ${HOME} sed /usr/bin 'quoted text' -eu "$@" grep echo && "$@" 'quoted text'
+	cd cd --verbose "$@" then done export "$1"
+		cd test "$@" /usr/bin | /usr/bin /usr/bin echo readonly -eu 'quoted text'
+		-eu echo export x=1 --verbose awk local --verbose "$1"
+	sed "$1" awk "$1" readonly -eu readonly $(pwd) 'quoted text' -eu
+	then x=1 ${HOME} 2>/dev/null
+${HOME} $(pwd) readonly ${HOME} | test -eu
+2>/dev/null "$1" ${HOME} && x=1 | ${HOME} export
+		'quoted text' && sed cd then awk readonly then
+	${HOME} ${HOME} sed printf $(pwd)
+		cd awk -eu "$@" 'quoted text' grep
+printf "$1" --verbose "$@" test "$@"
+	grep ${HOME} awk test readonly sed -eu printf "$@"
+		-eu echo && 'quoted text' "$1" 2>/dev/null echo readonly
+		2>/dev/null --verbose test test 2>/dev/null
+	grep awk sed readonly export ${HOME} grep sed "$1" x=1 ${HOME} cd -eu ${HOME} 2>/dev/null
+		test "$1" "$@" "$1" cd readonly
+		awk readonly && readonly && /usr/bin cd echo x=1 echo x=1 export
+	done ${HOME} "$1" x=1 "$1" echo | local x=1 "$@" && readonly local
+${HOME} then -eu cd --verbose grep
+		printf readonly test grep export grep readonly grep -eu 2>/dev/null export x=1
+&& x=1 -eu grep grep 'quoted text' echo
+'quoted text' -eu test test export cd
+test x=1 test && printf
+	then && then echo awk grep grep /usr/bin $(pwd) done
+sed cd --verbose cd export ${HOME} readonly -eu sed -eu /usr/bin
+/usr/bin --verbose 'quoted text' printf
+		grep then printf x=1 $(pwd) $(pwd) export
+${HOME} x=1 readonly readonly --verbose
+readonly local awk awk "$1" printf echo /usr/bin $(pwd) done --verbose sed 'quoted text'
+/usr/bin echo test done test 2>/dev/null local cd readonly printf 2>/dev/null
+printf grep printf readonly $(pwd)
+--verbose "$1" export /usr/bin cd x=1
+		readonly 2>/dev/null && local then cd done
+		export grep test "$@" | "$1" ${HOME} readonly "$@" --verbose
+sed sed /usr/bin && done "$1"
+echo cd && $(pwd) --verbose
+2>/dev/null grep printf grep local 2>/dev/null awk 'quoted text'
+		&& awk | $(pwd) $(pwd)
+awk test 'quoted text' && then ${HOME} && grep 'quoted text'
+${HOME} -eu echo ${HOME} x=1 && "$1" test export /usr/bin
+-eu test | "$@" | $(pwd) --verbose
+	grep grep cd ${HOME} test /usr/bin test grep
+		/usr/bin "$@" printf local ${HOME} $(pwd) --verbose test "$@" grep
+	done 2>/dev/null cd echo done echo | cd /usr/bin local /usr/bin
+done --verbose x=1 "$1" sed "$1" grep awk -eu
+		then --verbose printf test 2>/dev/null
+	echo test awk /usr/bin ${HOME} readonly test sed grep -eu "$@" then $(pwd)
+/usr/bin 'quoted text' -eu grep | awk echo &&
+	grep printf "$@" -eu $(pwd) export export
+		| "$@" x=1 local 'quoted text' -eu then sed
+	echo 'quoted text' then sed done
+	sed ${HOME} | awk -eu echo -eu && $(pwd) sed test cd export
+		local | -eu done 2>/dev/null 2>/dev/null
+echo ${HOME} echo done export | sed export --verbose "$1" x=1
+awk printf | "$@" local 2>/dev/null "$@" 'quoted text'
+awk /usr/bin cd && | ${HOME}
+"$@" 'quoted text' printf grep then
+	test 2>/dev/null export 2>/dev/null awk echo ${HOME}
+printf --verbose cd grep ${HOME}
+	done export test $(pwd) -eu awk done | printf && printf && -eu --verbose -eu
+	--verbose $(pwd) /usr/bin
+	test grep readonly cd | test
+		2>/dev/null printf &&
+		-eu 'quoted text' export 2>/dev/null
+	export 2>/dev/null grep "$1" then -eu --verbose
+		x=1 printf "$1" export $(pwd) printf printf echo local
+	/usr/bin grep local 2>/dev/null done done /usr/bin 2>/dev/null ${HOME}
+	x=1 grep 2>/dev/null awk x=1 "$1" 2>/dev/null export ${HOME} x=1 -eu cd readonly
+export readonly -eu grep -eu --verbose 2>/dev/null local 'quoted text'
+$(pwd) 2>/dev/null 2>/dev/null
+	2>/dev/null local ${HOME} "$1" --verbose 2>/dev/null export done
+"$1" grep cd local cd cd "$@" "$1" | test "$1" readonly
+	${HOME} && "$1" 2>/dev/null
+	| grep /usr/bin echo --verbose 'quoted text' local sed grep local then
+		awk grep 'quoted text' -eu printf then -eu && export cd echo test printf
+		printf cd export /usr/bin
+sed grep local local -eu "$@" awk | && ${HOME}
+		local | readonly grep 'quoted text' /usr/bin "$@" echo "$1" printf 2>/dev/null
+	${HOME} grep grep 2>/dev/null awk 'quoted text'
+awk echo cd grep printf -eu awk | $(pwd) done $(pwd) && /usr/bin
+		local awk readonly test 'quoted text'
+grep readonly 2>/dev/null readonly $(pwd) /usr/bin then done "$@" readonly
+sed 'quoted text' awk $(pwd) -eu && done &&
+$(pwd) 'quoted text' x=1 'quoted text' sed ${HOME} $(pwd) x=1 --verbose
+	local x=1 local | export then
+		--verbose $(pwd) x=1 "$@" readonly
+	&& && grep sed 'quoted text' echo test | then echo sed ${HOME} --verbose
+	"$1" "$1" echo cd cd printf "$1" done --verbose --verbose
+		export "$1" 2>/dev/null awk "$@" ${HOME} export done 'quoted text' | 'quoted text'
+grep x=1 export local echo
+"$1" ${HOME} 'quoted text' echo local /usr/bin x=1 grep
+-eu echo echo && local test --verbose | 2>/dev/null cd /usr/bin
+	test --verbose done then "$@" echo 'quoted text' ${HOME} readonly
+	local "$@" && x=1 readonly | "$1" awk
+${HOME} test sed x=1 sed | done local awk 'quoted text' sed
+	$(pwd) && "$@" readonly -eu cd 'quoted text' cd
+sed "$1" export awk $(pwd) readonly sed ${HOME} cd /usr/bin 2>/dev/null echo
+		-eu readonly local done 2>/dev/null printf 2>/dev/null x=1 awk readonly
+&& printf 2>/dev/null "$1" 2>/dev/null readonly ${HOME} export
+		"$1" -eu grep -eu --verbose
+		$(pwd) awk 2>/dev/null 2>/dev/null
+		sed "$@" "$1" "$1" cd 2>/dev/null
+	| ${HOME} -eu printf export echo cd ${HOME}
+		grep done $(pwd) done cd then -eu ${HOME} | -eu 2>/dev/null
+	"$1" then done test local test $(pwd) readonly "$@" x=1 "$1" sed local grep -eu
+$(pwd) x=1 --verbose local | /usr/bin done 2>/dev/null cd
+		2>/dev/null awk "$@" "$@" grep | 'quoted text' printf awk
+2>/dev/null test --verbose --verbose
+	done /usr/bin then x=1 done grep local x=1 awk
+sed --verbose --verbose readonly --verbose ${HOME} 2>/dev/null
+	-eu awk readonly sed cd local local then cd x=1 readonly && -eu local ${HOME}
+		'quoted text' readonly --verbose 2>/dev/null
+	&& ${HOME} | /usr/bin cd 'quoted text' /usr/bin awk sed
+test ${HOME} readonly cd grep echo awk $(pwd) awk -eu export export done ${HOME}
+&& then && 'quoted text' $(pwd) /usr/bin "$1" && local $(pwd)
+	test "$@" echo ${HOME} grep 2>/dev/null 2>/dev/null
+		"$1" done /usr/bin echo 'quoted text' $(pwd) x=1 /usr/bin cd /usr/bin
+	printf awk then readonly local echo && done "$@" cd ${HOME} grep sed
+		sed echo $(pwd) sed x=1 $(pwd) cd
+		&& --verbose /usr/bin local
+printf ${HOME} $(pwd) "$@" sed test ${HOME}
+		| test test | sed "$@" awk "$@" ${HOME}
+test ${HOME} --verbose then export ${HOME} |
+readonly "$@" -eu export then "$1" 2>/dev/null
+		$(pwd) 'quoted text' then cd then grep "$1" "$1" x=1 readonly
+	grep sed readonly grep sed done printf echo 2>/dev/null
+	x=1 sed printf $(pwd) && ${HOME}
+printf printf "$1" &&
+		done printf 2>/dev/null 'quoted text' grep 'quoted text' local sed sed -eu
+	printf -eu printf 'quoted text' $(pwd) $(pwd) ${HOME}
+$(pwd) echo "$1" -eu then echo
+export ${HOME} | "$@" then "$1" export cd 'quoted text'
+	"$1" echo readonly grep local
+	awk 2>/dev/null sed x=1 /usr/bin
+	test "$@" sed -eu done -eu /usr/bin sed sed echo sed "$@"
+		&& && cd "$@" $(pwd) | $(pwd) echo x=1 'quoted text'
+--verbose awk -eu && sed awk local cd echo | cd | local export -eu cd done
+		/usr/bin -eu | --verbose -eu then ${HOME}
+		| $(pwd) grep "$@" echo x=1 "$1" printf
+	${HOME} done | $(pwd) "$1" | /usr/bin printf /usr/bin -eu 2>/dev/null && echo "$1"
+"$1" "$1" sed x=1 "$1" local 2>/dev/null
+		/usr/bin /usr/bin export --verbose && ${HOME} test done && cd export readonly "$1"
+		&& local /usr/bin echo then test done 2>/dev/null cd echo local | grep
+'quoted text' $(pwd) then readonly export test $(pwd)
+	printf printf ${HOME} | then "$@" | sed |
+	&& echo 2>/dev/null sed && /usr/bin 2>/dev/null $(pwd)
+	"$@" readonly "$1" ${HOME} local "$@"
+		local echo $(pwd) "$1" 'quoted text' $(pwd) grep 'quoted text' "$1" ${HOME}
+		/usr/bin grep awk $(pwd) grep && export cd sed printf
+echo export ${HOME} local -eu $(pwd)
+done printf done local printf local then -eu echo cd --verbose
+	cd -eu local export export export 'quoted text' awk printf grep
+		/usr/bin $(pwd) x=1 cd -eu x=1 then printf local awk then local
+	--verbose | cd | "$1" local 'quoted text' sed export local && 2>/dev/null
+awk echo --verbose "$@" printf 'quoted text' printf
+		| ${HOME} awk printf done
+		done /usr/bin --verbose "$@"
+'quoted text' ${HOME} cd "$@" && 2>/dev/null done x=1 ${HOME} /usr/bin
+"$1" cd "$1" --verbose awk then -eu &&
+		export /usr/bin 'quoted text' awk "$@" export -eu
+		--verbose test $(pwd) printf 2>/dev/null 2>/dev/null "$1" $(pwd) echo
+		'quoted text' 2>/dev/null cd x=1
+	done ${HOME} x=1 | export local /usr/bin echo cd echo && sed printf
+		/usr/bin "$1" printf && test export done then && local 'quoted text' 2>/dev/null
+export test -eu "$1" awk cd test x=1 awk 2>/dev/null && -eu grep echo "$1"
+-eu local awk /usr/bin grep sed test local "$@" echo
+		/usr/bin test grep printf readonly printf done
+echo printf && ${HOME} 'quoted text' | export cd cd
+		done ${HOME} --verbose "$1" x=1 "$1" printf "$1" && ${HOME}
+		"$@" local "$1" sed printf "$1" grep | -eu "$@" 2>/dev/null $(pwd) readonly awk
+'quoted text' /usr/bin -eu
+then ${HOME} cd --verbose export readonly /usr/bin awk
+	sed done /usr/bin "$1" echo -eu "$1" -eu --verbose 'quoted text' awk export -eu
+		2>/dev/null sed echo "$@" then
+	"$@" ${HOME} grep && "$1" echo printf printf ${HOME} 2>/dev/null x=1
+awk /usr/bin x=1 2>/dev/null
+cd then ${HOME} export && "$@" sed 'quoted text' $(pwd) sed
+readonly -eu | 2>/dev/null cd 'quoted text' done
+	x=1 /usr/bin printf 2>/dev/null --verbose --verbose &&
+awk awk echo export sed done cd 2>/dev/null | 2>/dev/null
+		--verbose "$1" && cd
+	&& local then "$@" printf --verbose "$1" 2>/dev/null
+	cd export cd printf -eu awk /usr/bin 'quoted text' then
+test --verbose then "$1" sed grep then then "$@"
+	export awk $(pwd) $(pwd) printf cd readonly done printf grep --verbose
+		readonly "$@" 2>/dev/null $(pwd) readonly "$1" done
+"$1" grep $(pwd) ${HOME}
+		&& --verbose sed x=1 printf && then $(pwd) then 'quoted text' test
+		done x=1 /usr/bin grep | then grep && $(pwd) -eu
+		local "$@" "$@" "$@" --verbose 2>/dev/null "$@" 2>/dev/null
+		done test awk $(pwd)
+	--verbose --verbose local && | x=1 x=1 --verbose
+		printf "$1" test | $(pwd) sed $(pwd) ${HOME} 'quoted text'
+		echo x=1 $(pwd) -eu --verbose awk test -eu x=1 echo printf
+grep $(pwd) --verbose readonly cd grep grep
+	then then readonly grep
+'quoted text' then sed printf
+		x=1 echo awk then test $(pwd) 2>/dev/null "$1" $(pwd) local
+		local /usr/bin -eu x=1 ${HOME} grep x=1 printf printf /usr/bin grep "$@" -eu
+printf $(pwd) $(pwd) done && awk local export then &&
+	"$1" then cd ${HOME} done /usr/bin readonly then x=1 done echo | 2>/dev/null
+then $(pwd) x=1 awk x=1 | /usr/bin ${HOME} echo echo
+'quoted text' printf 'quoted text' $(pwd) --verbose 'quoted text'
+-eu -eu /usr/bin then sed echo 'quoted text' x=1 done grep "$1" echo echo ${HOME}
+"$1" | echo -eu 'quoted text' cd done test 2>/dev/null "$@" ${HOME} cd --verbose
+	| cd test local echo "$1" ${HOME} printf "$@" echo | -eu 2>/dev/null
+$(pwd) --verbose | awk -eu && readonly echo -eu grep readonly && local
+grep test ${HOME} then
+	cd --verbose done then awk done "$@" 2>/dev/null $(pwd) readonly
+then 2>/dev/null test $(pwd) export test grep done $(pwd) sed readonly cd echo $(pwd)
+	${HOME} test "$1" test
+		"$@" echo | x=1 | readonly x=1 printf 2>/dev/null 2>/dev/null x=1 export
+then --verbose ${HOME} readonly done &&
+printf /usr/bin sed 'quoted text' awk && /usr/bin readonly "$1" ${HOME}
+		| 2>/dev/null then ${HOME} /usr/bin | 'quoted text' printf printf
+	printf test && "$1" sed /usr/bin
+export -eu 'quoted text' 'quoted text' export
+		--verbose "$1" printf export | printf readonly local echo export then
+	sed --verbose then -eu grep --verbose awk readonly cd
+		'quoted text' readonly printf
+		cd export cd "$1" then export $(pwd) 2>/dev/null x=1 awk sed 'quoted text' local
+		-eu export local awk cd readonly test --verbose
+	printf then sed awk | grep $(pwd)
+		-eu -eu printf cd --verbose readonly x=1 x=1
+		${HOME} sed | echo --verbose sed then awk /usr/bin then done grep echo
+		printf sed 2>/dev/null 'quoted text' done awk done awk export export done | ${HOME}
+then ${HOME} 2>/dev/null cd x=1
+"$1" --verbose /usr/bin ${HOME}
+'quoted text' done readonly
+		$(pwd) cd awk cd --verbose -eu 'quoted text' grep test then readonly
+--verbose --verbose cd -eu awk -eu | ${HOME} /usr/bin
+test /usr/bin printf export "$@" /usr/bin 'quoted text' 2>/dev/null
+"$@" --verbose x=1 echo -eu export echo --verbose "$@" done cd /usr/bin 2>/dev/null
+	"$1" local /usr/bin done awk "$1" readonly test done cd then && /usr/bin export
+&& $(pwd) awk echo /usr/bin
+		| ${HOME} grep sed | export
+	x=1 | test 'quoted text' --verbose && ${HOME} $(pwd)
+		&& test export ${HOME} "$@" local export local local export
+		cd ${HOME} "$1" 'quoted text' --verbose then /usr/bin
+	local echo 2>/dev/null grep cd "$1" --verbose readonly --verbose 'quoted text'
+--verbose -eu grep -eu done
+x=1 export grep sed "$@" grep $(pwd) awk
+	--verbose sed done $(pwd) done readonly
+done "$@" cd grep "$@" grep readonly "$@" && -eu then sed 2>/dev/null
+	test awk awk then -eu echo cd awk sed local awk then
+	2>/dev/null sed | cd | x=1 2>/dev/null export && 2>/dev/null printf
+awk echo "$1" 'quoted text' --verbose sed 2>/dev/null
+readonly $(pwd) then sed awk x=1 printf sed /usr/bin
+"$1" printf && /usr/bin -eu done grep
+	"$@" done | "$1" /usr/bin /usr/bin
+echo -eu echo printf readonly awk /usr/bin
+	printf --verbose export -eu ${HOME} local $(pwd) grep | grep echo
+	'quoted text' export /usr/bin
+"$1" /usr/bin "$1" sed done echo export
+/usr/bin "$@" export readonly
+	grep then export /usr/bin cd 2>/dev/null /usr/bin 'quoted text' 'quoted text'
+	x=1 "$1" --verbose then | awk export && grep --verbose awk local 'quoted text'
+		echo "$1" -eu printf && test "$@" grep done && printf local printf x=1 ${HOME}
+		local done -eu 'quoted text' x=1 && sed cd sed && readonly 'quoted text'
+	'quoted text' x=1 | local "$1" && ${HOME} x=1
+	"$@" -eu cd ${HOME} -eu -eu awk local
+printf && readonly export -eu && cd && sed echo printf
+	awk cd local "$@" readonly 'quoted text'
+		"$1" 2>/dev/null --verbose x=1 ${HOME}
+	then ${HOME} test done printf -eu sed -eu awk "$1" awk ${HOME} ${HOME} --verbose
+&& printf 2>/dev/null ${HOME} /usr/bin
+		sed awk export local cd done awk test
+		printf /usr/bin readonly "$1" then 2>/dev/null | 'quoted text'
+	local ${HOME} cd done cd readonly 2>/dev/null 'quoted text'
+2>/dev/null -eu then test grep then cd readonly
+	echo then awk local awk sed
+		| sed -eu printf x=1 && x=1 /usr/bin && grep /usr/bin export
+	sed readonly grep 2>/dev/null --verbose
+	test x=1 "$1" -eu done awk "$@" --verbose
+		test sed --verbose 'quoted text' cd grep ${HOME} --verbose printf sed
+export grep echo "$@"
+/usr/bin printf grep && --verbose ${HOME}
+		printf /usr/bin | test
+&& | $(pwd) 2>/dev/null local $(pwd)
+readonly $(pwd) then grep 'quoted text' "$@" sed ${HOME}
+	test export "$@" --verbose echo local -eu test "$1" awk local printf sed readonly
+		${HOME} done export -eu "$@" 2>/dev/null 'quoted text' | sed
+grep "$1" export "$@" cd export "$@" 'quoted text' echo
+		awk grep printf export cd
+done -eu --verbose x=1 "$@" --verbose $(pwd) x=1 "$@" test awk "$@" sed export
+	awk $(pwd) "$1" local && --verbose grep grep then done local "$1"
+	sed $(pwd) readonly test done cd x=1
+cd 2>/dev/null "$1" /usr/bin then "$@" cd readonly && echo local 2>/dev/null
+awk | readonly done then echo 'quoted text'
+	&& "$1" test then cd cd "$@" 2>/dev/null
+		2>/dev/null local && local && cd grep readonly local --verbose 'quoted text'
+x=1 cd awk /usr/bin awk "$@" /usr/bin /usr/bin cd $(pwd)
+		${HOME} --verbose then "$1" grep
+		sed "$1" cd && printf $(pwd) && then "$@"
+		-eu -eu readonly --verbose grep
+	${HOME} 2>/dev/null /usr/bin ${HOME} readonly
+2>/dev/null 'quoted text' echo export /usr/bin printf local local --verbose test
+	printf cd export local cd readonly local 2>/dev/null "$@" | cd awk
+	printf readonly "$@" test
+local awk readonly $(pwd)
+	grep cd echo | "$@" done --verbose readonly readonly "$@"
+	grep export --verbose then | && awk
+		2>/dev/null x=1 | export 2>/dev/null grep $(pwd) local -eu ${HOME} export 2>/dev/null
+--verbose "$@" readonly /usr/bin echo &&
+		--verbose sed printf --verbose
+		${HOME} "$1" /usr/bin local awk ${HOME} /usr/bin $(pwd)
+		| x=1 'quoted text' readonly --verbose /usr/bin done /usr/bin -eu done
+${HOME} "$1" -eu 2>/dev/null && printf then "$@" test
+		$(pwd) cd test local local done printf
+2>/dev/null /usr/bin /usr/bin printf test grep grep $(pwd) cd
+"$@" | x=1 sed cd printf then x=1 cd -eu x=1 awk $(pwd) --verbose
+awk x=1 -eu && "$@" awk sed cd $(pwd)
+		awk done grep test done then "$@" x=1 grep ${HOME} grep x=1 -eu cd awk done $(pwd)
+		x=1 export $(pwd) && sed /usr/bin x=1 && /usr/bin
+		x=1 && --verbose cd test -eu "$1" sed "$@" then
+	sed awk echo -eu -eu echo 2>/dev/null then && grep cd awk --verbose
+"$1" printf 2>/dev/null cd "$@" 2>/dev/null cd $(pwd) local test "$1" 2>/dev/null
+x=1 grep readonly test "$@" done sed cd ${HOME} local
+		grep $(pwd) ${HOME} test "$@"
+	awk "$1" --verbose then &&
+| | local /usr/bin 2>/dev/null -eu sed "$1" sed done printf "$@"
+		done echo echo --verbose grep
+	then done "$1" grep test test local export sed done 2>/dev/null
+&& readonly && /usr/bin x=1
+'quoted text' echo x=1 -eu awk "$@"
+		${HOME} export grep sed 2>/dev/null then -eu printf awk && printf
+		2>/dev/null awk 2>/dev/null /usr/bin
+export local | /usr/bin readonly
+	readonly ${HOME} awk $(pwd) ${HOME} /usr/bin "$1" /usr/bin -eu then "$@" 2>/dev/null
+	"$@" && /usr/bin grep && "$1" 2>/dev/null readonly sed printf x=1 printf /usr/bin
+| --verbose sed awk then
+awk sed --verbose grep sed && echo sed then /usr/bin export "$@" sed local sed
+	&& cd done | x=1 then readonly cd done
+echo printf --verbose /usr/bin local &&
+		"$@" | "$1" sed then readonly x=1 | 2>/dev/null then
+-eu --verbose printf readonly export && x=1 -eu | /usr/bin grep printf
+"$1" 2>/dev/null grep 2>/dev/null readonly x=1 x=1 -eu 'quoted text' echo printf
+		| "$@" then grep then done sed echo
+		local awk cd --verbose echo cd 'quoted text' ${HOME} 2>/dev/null
+awk readonly -eu --verbose
+		then $(pwd) then sed printf "$1" printf && printf "$1" --verbose x=1 2>/dev/null
+	readonly --verbose awk 'quoted text' && test then export 'quoted text'
+"$1" "$1" 'quoted text' -eu x=1 2>/dev/null | /usr/bin
+	done awk readonly "$1" | |
+readonly "$1" x=1 'quoted text' | test --verbose
+/usr/bin | $(pwd) then $(pwd) "$1" cd test --verbose "$@" export done echo $(pwd)
+	readonly printf local $(pwd) --verbose printf test 2>/dev/null
+	local -eu printf then x=1 -eu 'quoted text' x=1 export sed then -eu --verbose
+"$1" printf "$@" 2>/dev/null ${HOME} "$1" readonly | /usr/bin readonly sed
+		sed printf sed then /usr/bin -eu | printf /usr/bin
+	export 2>/dev/null cd |
+		export x=1 sed cd && $(pwd) --verbose /usr/bin 'quoted text' export
+$(pwd) "$1" test printf 2>/dev/null
+		/usr/bin printf ${HOME} then local
+		grep "$1" "$@" export "$@"
+	printf printf | | $(pwd) local /usr/bin --verbose test awk "$@"
+		sed export /usr/bin x=1 awk x=1 -eu 2>/dev/null test && awk awk
+	readonly echo "$1" cd -eu
+		readonly awk echo sed test ${HOME} x=1 && cd echo 'quoted text'
+	2>/dev/null echo test
+awk 'quoted text' test awk -eu "$1" echo printf 'quoted text' ${HOME}
+		--verbose /usr/bin ${HOME} awk test cd 2>/dev/null -eu
+		2>/dev/null echo readonly -eu
+	then readonly then x=1
+	"$1" $(pwd) | /usr/bin grep
+/usr/bin x=1 cd local --verbose 'quoted text' done readonly local /usr/bin test
+		--verbose --verbose test done "$1" local sed "$1" && -eu then cd $(pwd)
+readonly then --verbose done awk sed test export $(pwd)
+test 'quoted text' sed --verbose 2>/dev/null "$@" --verbose test &&
+	"$1" x=1 test sed ${HOME} 'quoted text' -eu
+	--verbose "$1" test export test printf ${HOME} "$@" local then export
+echo | test export echo ${HOME} test "$1" sed ${HOME} printf sed
+	sed then 2>/dev/null cd cd readonly cd cd --verbose
+	"$@" -eu && "$@" sed 'quoted text' awk && cd done echo
+-eu 'quoted text' | | 'quoted text' "$1" 2>/dev/null $(pwd) | --verbose $(pwd)
+		done --verbose $(pwd) /usr/bin "$@" x=1 then local "$1" done cd local
+	readonly awk export --verbose /usr/bin echo /usr/bin
+		export readonly --verbose cd test awk 'quoted text' grep done "$1"
+readonly export /usr/bin --verbose /usr/bin awk | readonly && echo
+	2>/dev/null -eu -eu cd -eu echo test "$1" -eu readonly
+$(pwd) $(pwd) readonly ${HOME} test -eu && printf && $(pwd) $(pwd)
+	cd sed then x=1 test printf readonly
+	printf then test printf | test $(pwd) -eu grep && readonly
+		echo | "$@" ${HOME} "$@" local then "$@" "$1"
+	cd done test cd grep sed $(pwd) test | -eu &&
+done sed -eu local "$@" awk grep "$1"
+	| --verbose /usr/bin sed && "$@" printf grep export ${HOME} grep | 'quoted text'
+	printf --verbose readonly "$@"
+-eu awk $(pwd) echo local then | then
+	sed sed cd | export local sed | sed awk then | 2>/dev/null
+		grep sed export /usr/bin
+	echo export local export sed test
+	"$@" && sed /usr/bin x=1 --verbose awk "$@" && awk "$@" --verbose
+		"$@" && then "$1" readonly
+		${HOME} -eu test "$1" --verbose cd test awk test printf grep grep && "$1" cd
+		${HOME} $(pwd) printf 'quoted text' --verbose 2>/dev/null -eu x=1 && local
+	grep local local test x=1 printf sed --verbose sed printf 2>/dev/null "$1"
+	&& awk sed "$@" awk export --verbose
+		local 'quoted text' local 'quoted text' "$@" printf &&
+		readonly then grep ${HOME} done ${HOME} 2>/dev/null 2>/dev/null 2>/dev/null
+		awk 2>/dev/null local | /usr/bin test then grep
+		${HOME} echo echo /usr/bin 2>/dev/null | cd export awk | readonly x=1 done -eu
+		cd done $(pwd) export $(pwd) awk test readonly "$@" local x=1 sed
+		x=1 done printf grep export $(pwd) export $(pwd) $(pwd) ${HOME}
+test readonly sed /usr/bin
+	export --verbose export printf grep printf cd -eu
+	echo sed "$1" sed export
+		test $(pwd) /usr/bin && -eu echo "$@" -eu $(pwd) x=1 &&
+		grep export 'quoted text' sed printf printf |
+		"$1" export "$1" 2>/dev/null test awk local -eu
+		cd readonly grep 2>/dev/null 'quoted text'
+test export echo $(pwd) done --verbose
+| --verbose sed cd sed
+grep "$1" then --verbose
+	"$@" done then && 'quoted text'
+test x=1 grep $(pwd) $(pwd) grep 'quoted text' sed && -eu "$1" printf
+		${HOME} "$1" && --verbose 2>/dev/null cd echo grep
+export test | then -eu | "$1" grep then --verbose
+cd /usr/bin $(pwd) awk "$1" export /usr/bin cd awk printf && --verbose local
+	export grep /usr/bin $(pwd) "$1" cd && test ${HOME}
+	echo "$@" awk && test sed grep $(pwd) "$1" x=1 2>/dev/null
+then ${HOME} /usr/bin --verbose awk
+		export echo --verbose 'quoted text' "$@" &&
+		sed grep then export done $(pwd)
+		-eu sed cd done --verbose 'quoted text'
+'quoted text' "$@" readonly done printf done 2>/dev/null
+	readonly $(pwd) 'quoted text'
+sed export printf -eu 'quoted text' readonly /usr/bin cd sed export | 2>/dev/null
+	$(pwd) cd then $(pwd) 2>/dev/null 2>/dev/null ${HOME} --verbose
+		export "$@" sed readonly "$1" done
+	awk awk --verbose echo then && echo test x=1 2>/dev/null done
+	done then export 2>/dev/null sed sed 'quoted text' grep awk cd done $(pwd)
+	sed grep /usr/bin sed export grep -eu grep printf ${HOME} readonly
+		/usr/bin 'quoted text' printf export printf sed
+	"$1" printf $(pwd) /usr/bin
+		${HOME} 'quoted text' x=1 | ${HOME} && sed $(pwd) /usr/bin ${HOME}
+"$@" export printf cd --verbose
+	$(pwd) 2>/dev/null cd readonly echo export sed local
+		export echo 2>/dev/null /usr/bin test -eu $(pwd) cd
+then "$@" done 'quoted text' awk && export export ${HOME}
+awk 2>/dev/null grep "$1" /usr/bin $(pwd) awk x=1 local done x=1 "$@" 'quoted text'
+$(pwd) awk export 2>/dev/null -eu && --verbose
+-eu && "$1" test sed "$@" $(pwd) export --verbose cd 2>/dev/null echo done
+	then 'quoted text' ${HOME} sed x=1 sed
+	2>/dev/null printf /usr/bin test sed 2>/dev/null export | cd test -eu
+'quoted text' $(pwd) 'quoted text'
+		done | test sed x=1 2>/dev/null
+		local readonly 2>/dev/null ${HOME} printf 'quoted text' --verbose local
+$(pwd) then local export && && echo 2>/dev/null done readonly readonly 'quoted text'
+${HOME} sed sed 'quoted text'
+	test 2>/dev/null cd awk "$@" "$1" printf x=1 printf cd awk 'quoted text' x=1 then
+x=1 "$@" x=1 /usr/bin local
+$(pwd) readonly sed printf test grep then && readonly printf then
+		&& then /usr/bin ${HOME} 'quoted text' 2>/dev/null grep sed
+		&& local export "$1"
+		sed "$1" 2>/dev/null --verbose
+'quoted text' readonly 'quoted text' /usr/bin
+sed then "$1" test sed echo
+	"$1" 2>/dev/null grep sed 'quoted text' -eu "$1" echo sed readonly 2>/dev/null
+	cd "$@" 'quoted text' 2>/dev/null "$1" /usr/bin ${HOME}
+	"$@" local "$1" --verbose ${HOME} --verbose local
+	-eu awk done ${HOME} $(pwd) grep -eu
+		readonly "$@" awk awk 2>/dev/null 2>/dev/null sed 'quoted text'
+		$(pwd) grep readonly 2>/dev/null awk --verbose test grep readonly && 'quoted text'
+	then awk ${HOME} "$@" ${HOME} && -eu "$1" then grep readonly |
+	$(pwd) x=1 ${HOME} then ${HOME} -eu $(pwd) grep local done x=1 done /usr/bin
+		${HOME} x=1 'quoted text' readonly sed --verbose $(pwd) x=1 -eu echo export
+&& && sed grep grep export then | grep 2>/dev/null ${HOME} $(pwd) 2>/dev/null
+	&& echo local x=1 ${HOME} "$@" cd local readonly echo
+		${HOME} $(pwd) printf 'quoted text'
+	$(pwd) 'quoted text' x=1 --verbose export readonly "$@" local $(pwd) 'quoted text'
+	sed "$1" && -eu cd x=1 printf
+		--verbose x=1 ${HOME} grep "$1" && && then x=1 'quoted text'
+		awk "$@" cd cd local | cd awk then
+	grep cd x=1 && echo 'quoted text' local $(pwd) sed
+	-eu test sed --verbose ${HOME} /usr/bin x=1 "$1" readonly readonly test grep
+		grep "$@" echo 'quoted text' test test "$1" printf 'quoted text' /usr/bin
+		-eu export test "$@" ${HOME} sed
+		$(pwd) ${HOME} cd test test $(pwd) x=1 --verbose -eu
+	test "$@" "$@" "$1" then export
+test 'quoted text' x=1 'quoted text'
+local && $(pwd) --verbose export && x=1 | "$@" 2>/dev/null
+		"$1" /usr/bin ${HOME} 2>/dev/null
+	echo 2>/dev/null then local $(pwd) awk --verbose && export -eu cd export done local
+/usr/bin awk "$1" cd sed
+export "$@" -eu --verbose $(pwd)
+		2>/dev/null local "$@" -eu --verbose /usr/bin && grep cd export test grep
+echo grep /usr/bin done awk printf local local 'quoted text' x=1 x=1 /usr/bin
+"$1" "$@" sed "$1" x=1 then
+		-eu readonly done export done $(pwd) 'quoted text'
+		/usr/bin /usr/bin readonly sed --verbose ${HOME} ${HOME}
+	"$@" x=1 sed 'quoted text' local grep 'quoted text' /usr/bin
+		export then then -eu | readonly && $(pwd) grep $(pwd) $(pwd) echo
+	$(pwd) done "$1" readonly --verbose /usr/bin
+		| $(pwd) then readonly ${HOME} then then && ${HOME} --verbose awk
+	done cd /usr/bin -eu local echo /usr/bin "$1"
+	"$1" 'quoted text' /usr/bin
+--verbose "$@" awk 2>/dev/null 2>/dev/null $(pwd) readonly |
+export && x=1 && echo test | then done x=1 2>/dev/null export x=1 x=1 export
+| $(pwd) "$1" "$@" echo --verbose ${HOME} && --verbose
+local done readonly /usr/bin
+		grep readonly echo printf | && awk
+	echo local ${HOME} then |
+		&& echo export 2>/dev/null awk export ${HOME} --verbose local test "$@" $(pwd)
+		awk ${HOME} 2>/dev/null "$@" then readonly export readonly printf -eu x=1
+		cd grep -eu sed done local printf /usr/bin -eu /usr/bin
+		done -eu sed ${HOME} echo
+&& printf ${HOME} | ${HOME} sed
+	sed printf printf echo readonly $(pwd)
+${HOME} cd readonly readonly $(pwd) test awk
+	-eu --verbose grep test cd echo 'quoted text' /usr/bin sed && readonly "$@"
+	sed awk && ${HOME} -eu /usr/bin 2>/dev/null export "$@" "$1" ${HOME}
+		"$1" awk printf -eu echo cd 2>/dev/null printf | ${HOME} $(pwd) "$1" awk -eu printf
+x=1 'quoted text' cd awk readonly awk "$@" printf sed test done then && export
+		sed awk printf ${HOME} then sed -eu test grep x=1 --verbose
+"$@" cd | -eu awk "$@" local then printf "$1" /usr/bin /usr/bin test "$@"
+		printf then printf sed x=1 echo 2>/dev/null x=1 "$1" /usr/bin export
+&& 2>/dev/null /usr/bin --verbose "$@"
+	echo printf readonly done 2>/dev/null && done echo x=1 "$@"
+		| "$1" x=1 local 'quoted text' ${HOME} 2>/dev/null then
+		grep done 'quoted text' -eu $(pwd) grep readonly | test
+then cd --verbose cd "$@" --verbose "$1" 2>/dev/null ${HOME}
+		echo then awk local -eu printf "$1" local | readonly "$@" 2>/dev/null
+test "$@" 2>/dev/null ${HOME} printf local cd awk "$@" 'quoted text'
+	"$@" then 2>/dev/null && done sed printf /usr/bin echo
+		then export local x=1 export /usr/bin sed readonly printf $(pwd) $(pwd)
+	${HOME} "$@" --verbose sed echo "$@"
+	"$1" | done && $(pwd) printf && x=1 readonly cd local then then "$@"
+		test && | done 2>/dev/null printf grep -eu "$1" sed then
+	sed /usr/bin 2>/dev/null
+	'quoted text' 2>/dev/null | sed 'quoted text' awk
+readonly printf test | export cd ${HOME}
+grep x=1 awk 'quoted text' test awk 'quoted text' test 2>/dev/null && done 'quoted text'
+		grep printf -eu ${HOME} 'quoted text' /usr/bin local printf grep done
+	| printf test ${HOME} done $(pwd) /usr/bin x=1 then
+	"$1" then --verbose sed readonly
+		awk && ${HOME} ${HOME} && export | grep
+"$@" $(pwd) test 2>/dev/null printf then sed -eu local readonly grep cd grep
+'quoted text' grep "$@" sed 2>/dev/null sed | 2>/dev/null "$1" sed grep
+	/usr/bin "$@" "$1" | printf readonly && printf export x=1 then printf -eu
+		"$1" "$@" cd export printf $(pwd) awk grep done sed /usr/bin --verbose && grep
+"$1" grep cd sed printf then cd 2>/dev/null --verbose
+--verbose 'quoted text' x=1 --verbose
+	awk --verbose local /usr/bin export
+	then "$@" echo test "$@" readonly cd | then export awk x=1
+	printf then --verbose cd 2>/dev/null done ${HOME}
+	export x=1 ${HOME} 'quoted text'
+		"$@" "$1" test | /usr/bin local 2>/dev/null | $(pwd) 'quoted text'
+	awk && x=1 awk | 2>/dev/null
+local local x=1 $(pwd) $(pwd) sed | -eu && export done |
+-eu /usr/bin $(pwd) "$@" ${HOME} test
+grep awk $(pwd) local readonly -eu x=1 echo $(pwd) x=1 "$@" echo && export
+	then test "$@" cd readonly /usr/bin local
+export ${HOME} readonly "$@" /usr/bin $(pwd) /usr/bin
+export 2>/dev/null local
+		test then -eu sed ${HOME} awk export export /usr/bin | "$1" readonly
+		test test local test export printf /usr/bin export cd 2>/dev/null grep
+		test echo 2>/dev/null export | && -eu echo echo | -eu
+	awk echo echo echo export cd "$1" then
+	sed x=1 readonly echo cd --verbose | "$1" x=1 | |
+		awk printf -eu 2>/dev/null printf | awk then readonly "$@" sed "$@" x=1 /usr/bin
+done --verbose --verbose grep x=1 grep awk done $(pwd) | /usr/bin x=1 2>/dev/null
+	${HOME} | -eu --verbose
+	export $(pwd) && x=1 /usr/bin printf ${HOME} ${HOME} awk --verbose 'quoted text'
+	sed readonly "$1" "$1" readonly sed --verbose --verbose ${HOME}
+"$@" sed $(pwd) cd 2>/dev/null cd -eu x=1 printf then awk then export 'quoted text'
+		grep sed $(pwd) x=1 done echo cd -eu grep local local printf awk
+"$1" local x=1 /usr/bin $(pwd) "$@" sed done 'quoted text' done && sed sed --verbose
+	done "$1" | local grep test && 'quoted text'
+"$1" echo cd && grep &&
+		printf --verbose --verbose grep 'quoted text' x=1 -eu readonly
+		x=1 'quoted text' | cd -eu cd export $(pwd)
+readonly 2>/dev/null --verbose awk ${HOME} sed cd -eu "$1" $(pwd) "$1"
+--verbose -eu ${HOME} ${HOME} done 2>/dev/null readonly ${HOME} x=1 local sed
+		${HOME} && --verbose export ${HOME} grep && cd printf
+	"$1" then $(pwd) "$@" awk local && | 2>/dev/null export local
+	| ${HOME} export 'quoted text' $(pwd) "$@" 'quoted text'
+	"$@" -eu --verbose $(pwd) x=1 awk
+	sed grep printf grep grep readonly ${HOME} test cd &&
+	${HOME} grep "$@" test "$@" export x=1 | readonly &&
+then test --verbose /usr/bin
+		-eu "$@" grep "$@" done 2>/dev/null 'quoted text' then export cd | then
+		2>/dev/null -eu sed export 'quoted text' test | then
+		'quoted text' sed --verbose sed --verbose "$1" && --verbose test cd ${HOME}
+		awk ${HOME} cd cd done /usr/bin 'quoted text' 2>/dev/null echo 2>/dev/null "$@"
+-eu sed --verbose $(pwd)
+		'quoted text' | "$1" awk printf
+| echo export test -eu cd /usr/bin "$1" 2>/dev/null
+-eu 2>/dev/null "$1" --verbose printf then
+	x=1 awk sed "$@" "$1" awk -eu 'quoted text' 2>/dev/null
+		"$1" 'quoted text' 2>/dev/null "$@" 2>/dev/null cd | /usr/bin
+	local local 2>/dev/null readonly 'quoted text' "$@"
+		-eu 'quoted text' grep x=1 -eu readonly test sed
+	test $(pwd) | local sed then && test then "$1" test
+	/usr/bin 2>/dev/null readonly 'quoted text' "$@" local 'quoted text'
+	"$1" && echo 'quoted text' "$@" $(pwd) 'quoted text'
+		x=1 export readonly export grep /usr/bin cd test readonly
+		sed grep ${HOME} awk ${HOME} "$1"
+	printf 'quoted text' grep x=1 readonly
+${HOME} printf | --verbose ${HOME} /usr/bin
+grep grep /usr/bin | -eu $(pwd) 2>/dev/null --verbose && x=1 $(pwd)
+		"$1" 2>/dev/null && --verbose echo local sed export /usr/bin /usr/bin grep $(pwd)
+	--verbose export /usr/bin | cd done grep sed $(pwd) "$@" "$@" "$1" "$@"
+		x=1 echo cd | --verbose --verbose cd ${HOME} 2>/dev/null 'quoted text'
+		&& grep 2>/dev/null done test -eu $(pwd) awk -eu 'quoted text'
+	| export -eu local -eu printf
+-eu "$1" 'quoted text' | printf cd "$@" | | awk readonly --verbose x=1 export
+test printf x=1 -eu done sed export done grep -eu
+	awk awk test printf ${HOME}
+sed /usr/bin export test -eu readonly export awk /usr/bin
+	then printf ${HOME} ${HOME} && test 'quoted text'
+		done grep echo awk readonly "$1" && "$1" test /usr/bin
+	${HOME} && ${HOME} printf test $(pwd) echo | printf awk cd ${HOME} | local sed
+		'quoted text' test test printf
+	then "$1" cd cd $(pwd) sed -eu "$1" -eu ${HOME} awk --verbose
+done done sed printf export export grep 2>/dev/null $(pwd)
+		sed $(pwd) && x=1 ${HOME} grep echo awk
+grep sed then local cd printf export
+		local cd awk ${HOME} awk test sed | export | /usr/bin
+		cd -eu -eu -eu 2>/dev/null "$1" export /usr/bin grep
+echo 2>/dev/null grep -eu cd readonly --verbose
+		sed ${HOME} grep "$1" readonly local then
+		"$1" export "$1" sed local sed cd local readonly --verbose
+$(pwd) --verbose 2>/dev/null printf 'quoted text' 'quoted text' "$1" then /usr/bin
+	2>/dev/null ${HOME} awk printf sed && grep 'quoted text' |
+readonly readonly then then local grep 2>/dev/null 2>/dev/null
+		'quoted text' "$1" done done cd test awk local done -eu
+		cd && 2>/dev/null 2>/dev/null -eu
+	cd local $(pwd) done --verbose sed /usr/bin printf sed x=1 echo "$1" printf awk
+		/usr/bin -eu --verbose 'quoted text' $(pwd) test sed then "$1" grep x=1 cd -eu
+$(pwd) readonly --verbose "$1" export echo test x=1 $(pwd) "$1" "$1"
+	awk | && test /usr/bin ${HOME} readonly local 'quoted text' -eu 2>/dev/null then
+	echo sed 2>/dev/null "$1" --verbose "$@" export awk cd 2>/dev/null
+	then x=1 x=1 | test test cd then
+		export cd done readonly $(pwd) sed --verbose echo readonly "$@" export
+		sed 2>/dev/null readonly grep ${HOME}
+		then cd cd printf grep --verbose --verbose
+$(pwd) && echo done ${HOME} grep x=1 then printf && grep then grep
+	"$1" /usr/bin 'quoted text'
+	/usr/bin grep awk printf readonly
+	2>/dev/null --verbose | done cd | "$1" then | | "$@" /usr/bin |
+		then test | export --verbose local printf readonly sed ${HOME} cd done | -eu
+		/usr/bin "$@" cd export awk &&
+		${HOME} ${HOME} | /usr/bin done "$1" printf test "$@"
+		"$1" sed then cd ${HOME} done
+done x=1 2>/dev/null cd | readonly printf $(pwd) readonly
+		x=1 x=1 printf echo readonly $(pwd) printf
+then test grep "$@" done /usr/bin export echo $(pwd) readonly
+		"$1" readonly --verbose -eu sed && -eu done
+	done test 'quoted text' x=1 grep done local then then
+	2>/dev/null cd export --verbose x=1 done echo
+		test readonly test 2>/dev/null awk && echo
+		"$1" then "$@" then ${HOME} 'quoted text' | 2>/dev/null cd export /usr/bin
+		done -eu grep /usr/bin 2>/dev/null | 2>/dev/null
+test ${HOME} ${HOME} -eu then cd 2>/dev/null done echo x=1 sed "$@" echo
+		then "$@" local 'quoted text' export
+grep done readonly done local printf test && sed $(pwd) export echo
+		test test readonly export grep
+cd printf test printf test local export $(pwd) sed then test --verbose
+	printf readonly "$@" grep $(pwd) awk done local
+		-eu local done 2>/dev/null printf ${HOME} ${HOME} readonly "$1"
+readonly | 'quoted text' echo x=1 x=1 then --verbose "$1" export readonly $(pwd)
+	sed done echo -eu 'quoted text' -eu grep cd "$1" echo cd --verbose
+	done then ${HOME} then then done -eu then
+	export printf 'quoted text'
+	/usr/bin x=1 readonly echo cd --verbose local readonly 'quoted text' awk 2>/dev/null
+awk awk $(pwd) test "$@" then export sed "$@"
+2>/dev/null /usr/bin "$1" then echo sed sed "$1" sed test readonly then
+		then then 2>/dev/null grep then "$1" printf "$@" test 'quoted text'
+	readonly --verbose echo && 'quoted text' --verbose "$1" cd test
+		test | echo export 'quoted text' printf
+${HOME} awk "$@" then && 2>/dev/null "$@" 'quoted text'
+grep printf "$1" ${HOME} local local done "$1" ${HOME} grep export "$@" cd -eu export
+	then x=1 then "$1" $(pwd) $(pwd) readonly
+		| local test --verbose /usr/bin awk /usr/bin -eu --verbose
+	then $(pwd) grep "$1" grep 2>/dev/null cd ${HOME} ${HOME} /usr/bin readonly
+	$(pwd) sed -eu "$1" && "$1" done then done x=1 test /usr/bin test readonly echo
+		export -eu awk -eu 'quoted text' --verbose export ${HOME} && --verbose ${HOME}
+	sed --verbose --verbose export "$@" 'quoted text' echo -eu
+test "$1" done | -eu awk $(pwd) $(pwd)
+export ${HOME} x=1 /usr/bin sed
+	x=1 x=1 test | /usr/bin sed awk local | test ${HOME} test
+echo then /usr/bin printf
+		readonly -eu /usr/bin cd 2>/dev/null "$1" "$1" 'quoted text'
+		| x=1 2>/dev/null sed done export | test then 2>/dev/null grep
+'quoted text' test cd | echo sed x=1 ${HOME} --verbose 2>/dev/null
+	printf cd 'quoted text' $(pwd) readonly 2>/dev/null | "$1" cd 'quoted text'
+	${HOME} 'quoted text' test $(pwd) "$1" cd sed $(pwd) export 2>/dev/null
+	$(pwd) cd ${HOME} "$@" awk done
+	test export awk -eu local echo then "$@" cd 'quoted text'
+	done x=1 then done -eu export
+	sed done readonly echo --verbose ${HOME} -eu 2>/dev/null && cd x=1
+		${HOME} 'quoted text' sed awk
+		-eu then export "$@" export $(pwd) cd then then 2>/dev/null -eu
+	cd && awk export local export "$@" -eu
+-eu printf 2>/dev/null local awk | export grep 'quoted text' -eu $(pwd)
+/usr/bin grep && 2>/dev/null -eu then grep "$1" && awk 2>/dev/null awk then then
+grep 2>/dev/null echo grep && "$1" awk
+		test ${HOME} then done awk 2>/dev/null 2>/dev/null local
+	'quoted text' 'quoted text' export
+		sed && readonly grep /usr/bin ${HOME} ${HOME} cd 2>/dev/null then then export
+	2>/dev/null awk x=1 "$@" 2>/dev/null $(pwd)
+x=1 "$1" -eu 2>/dev/null awk export ${HOME} | then export
+	-eu /usr/bin && echo ${HOME}
+	printf 'quoted text' local grep test -eu $(pwd) "$@" sed 2>/dev/null readonly
+sed && export test then printf "$1" --verbose
+	--verbose test 2>/dev/null ${HOME} -eu ${HOME} && sed | --verbose
+echo && then echo x=1 /usr/bin
+		echo /usr/bin $(pwd) 2>/dev/null --verbose
+x=1 cd | local echo readonly 2>/dev/null ${HOME}
+		'quoted text' 2>/dev/null done sed export export then export
+		local x=1 export sed local $(pwd)
+	${HOME} 2>/dev/null printf | | then ${HOME} 2>/dev/null "$1" sed
+		/usr/bin readonly test 2>/dev/null --verbose ${HOME}
+	echo /usr/bin then /usr/bin cd
+--verbose && "$@" 'quoted text' test printf readonly
+		"$@" readonly local export /usr/bin
+		sed cd /usr/bin readonly cd then 'quoted text' 'quoted text'
+		--verbose "$1" "$@" awk "$1" x=1 printf /usr/bin echo test
+		then "$@" cd grep $(pwd) && test
+		readonly && printf printf printf
+		$(pwd) test test printf -eu grep
+		"$@" x=1 echo /usr/bin export | then "$1" then export /usr/bin && cd printf
+local then -eu echo local then
+	export echo --verbose $(pwd) export sed sed --verbose 'quoted text' &&
+	--verbose awk readonly 'quoted text'
+"$1" echo /usr/bin -eu
+		${HOME} cd sed "$@" test --verbose done printf then
+readonly 'quoted text' | test /usr/bin
+		then grep local test local
+readonly grep awk --verbose readonly grep ${HOME}
+export && local echo 2>/dev/null grep -eu -eu /usr/bin $(pwd) done done
+		x=1 echo then -eu 2>/dev/null "$1" echo export
+	x=1 done echo && --verbose cd then ${HOME} "$1" sed "$@" printf
+		'quoted text' awk /usr/bin "$@" printf | awk done readonly grep
+	--verbose --verbose cd -eu cd | 'quoted text' /usr/bin "$1" readonly readonly
+		printf readonly "$1" 2>/dev/null cd $(pwd)
+		awk --verbose | printf echo "$@" 'quoted text'
+		"$1" sed done cd sed export -eu "$1" $(pwd) 2>/dev/null "$@" 'quoted text'
+"$1" --verbose grep "$@" --verbose
+	readonly && cd cd local | export -eu && x=1 test /usr/bin printf awk
+	export "$@" "$@" awk -eu then done awk | 'quoted text' | printf readonly
+	done && awk --verbose done
+"$@" grep readonly done test grep --verbose x=1 $(pwd) 2>/dev/null x=1
+	| export export echo local $(pwd) then 'quoted text' grep | "$1" local | readonly
+		"$@" --verbose awk cd local | echo echo grep ${HOME} "$@" | done
+	grep | --verbose sed sed grep x=1 sed local ${HOME} local local x=1
+	readonly local cd export "$1" --verbose x=1 | export echo "$@" x=1 --verbose
+$(pwd) 2>/dev/null $(pwd) cd --verbose echo echo readonly
+	grep local "$1" cd grep 2>/dev/null "$@" $(pwd) local cd x=1 printf x=1 && 'quoted text'
+	printf -eu printf ${HOME} /usr/bin test echo /usr/bin
+		sed | export ${HOME} grep 'quoted text' cd | grep "$@" test 'quoted text'
+		cd cd test 2>/dev/null -eu
+		| then then 2>/dev/null local done export /usr/bin grep /usr/bin
+	'quoted text' done echo --verbose done
+		/usr/bin x=1 -eu echo -eu then ${HOME} x=1 2>/dev/null /usr/bin local -eu
+	-eu -eu cd "$1" local export then ${HOME} 'quoted text' sed -eu --verbose
+	printf -eu 2>/dev/null done
+		grep sed "$@" /usr/bin --verbose 2>/dev/null $(pwd)
+		-eu /usr/bin awk grep $(pwd) -eu "$@" export ${HOME}
+		x=1 cd | $(pwd) export /usr/bin 'quoted text' /usr/bin /usr/bin /usr/bin
+	done && 'quoted text' "$1" done grep 'quoted text' 2>/dev/null awk --verbose
+	printf readonly "$@" | printf $(pwd) 2>/dev/null 'quoted text' cd -eu
+		2>/dev/null && --verbose $(pwd) local | grep --verbose
+${HOME} /usr/bin then --verbose | -eu | ${HOME} export done then local
+	awk echo awk test $(pwd) x=1 awk cd grep | grep | cd echo "$@" done
+	sed /usr/bin test awk awk echo 2>/dev/null then | local x=1
+		x=1 "$1" 'quoted text' $(pwd) $(pwd)
+	readonly sed echo --verbose echo cd done
+	echo $(pwd) test then 2>/dev/null export
+export && --verbose done /usr/bin readonly cd printf
+		local && | ${HOME} 'quoted text'
+	test readonly awk "$@"
+	&& ${HOME} --verbose $(pwd) /usr/bin
+		2>/dev/null then ${HOME} printf "$@" x=1 ${HOME}
+readonly 2>/dev/null | local 'quoted text' && "$1" grep cd $(pwd) 'quoted text'
+	sed cd "$1" | grep export $(pwd) ${HOME} x=1 local
+	done readonly --verbose sed "$@" readonly
+cd cd readonly grep "$@" local x=1 echo export "$@" printf sed then
+		${HOME} 2>/dev/null readonly "$1" export $(pwd) test
+	cd then awk test --verbose sed grep 2>/dev/null export x=1 /usr/bin
+	$(pwd) "$1" awk grep "$@" then x=1 'quoted text' "$1" done export "$@" ${HOME} printf
+'quoted text' cd cd cd ${HOME} sed "$@" "$@" "$1" "$@" awk readonly
+--verbose awk printf awk echo awk
+	awk readonly | echo ${HOME}
+'quoted text' then echo test x=1 2>/dev/null ${HOME} 2>/dev/null
+	&& awk -eu readonly ${HOME} ${HOME} "$@" echo grep printf done
+2>/dev/null awk "$@" -eu && 'quoted text'
+awk /usr/bin | echo 'quoted text' /usr/bin cd | x=1 awk 'quoted text'
+	&& echo /usr/bin | sed grep "$1" "$@" x=1
+	awk $(pwd) cd local -eu then local | "$1" -eu printf --verbose
+grep ${HOME} x=1 'quoted text'
+test awk export | test "$1" /usr/bin "$1" -eu
+		sed test 2>/dev/null -eu then x=1 /usr/bin 2>/dev/null
+	${HOME} sed 2>/dev/null $(pwd)
+$(pwd) $(pwd) "$@" --verbose
+	2>/dev/null sed awk x=1 done sed "$1" $(pwd) awk grep sed
+done cd sed | cd test $(pwd)
+		done 2>/dev/null printf "$1" grep && readonly
+	then && sed "$@" --verbose echo "$@" -eu
+&& done grep echo readonly sed grep ${HOME} && echo "$@" "$1" export awk "$@" cd
+		2>/dev/null local x=1 done grep echo /usr/bin x=1 readonly
+	readonly printf 2>/dev/null awk grep 2>/dev/null done -eu
+		printf readonly 2>/dev/null && --verbose && local local done export
+"$1" test sed && | /usr/bin awk ${HOME} ${HOME} grep -eu x=1 | "$@" /usr/bin
+		/usr/bin "$@" -eu 2>/dev/null export --verbose test /usr/bin grep awk
+	printf && ${HOME} grep 'quoted text' grep printf -eu x=1 grep | test
+		export "$@" x=1 done && awk printf "$@" $(pwd)
+	grep export --verbose export echo 'quoted text' x=1 $(pwd) --verbose
+printf ${HOME} awk grep cd -eu | done x=1 ${HOME} done
+	--verbose ${HOME} 'quoted text' "$1" printf printf done
+		local 2>/dev/null | grep 2>/dev/null sed
+		--verbose "$@" sed then |
+	--verbose | -eu local "$@" local
+printf 2>/dev/null then --verbose /usr/bin
+		'quoted text' echo | test echo local x=1 cd /usr/bin grep && | "$@" export
+	2>/dev/null local ${HOME} grep ${HOME} export
+		export echo awk cd sed then done /usr/bin then ${HOME}
+	then test x=1 echo then 2>/dev/null awk test 2>/dev/null |
+	/usr/bin ${HOME} "$1" readonly "$1" | grep
+grep cd x=1 then --verbose ${HOME} -eu readonly then sed sed awk --verbose
+		readonly printf 'quoted text' local done --verbose /usr/bin
+		/usr/bin test -eu 2>/dev/null --verbose "$@" readonly then
+| sed echo grep && "$@" 2>/dev/null "$1" --verbose && readonly "$@" grep printf
+-eu grep test awk cd 'quoted text'
+	x=1 then cd test sed test "$@"
+	x=1 -eu cd done "$@" ${HOME} &&
+then sed /usr/bin 'quoted text' printf /usr/bin grep $(pwd) local
+		"$@" $(pwd) then echo --verbose printf $(pwd)
+		done -eu then x=1 cd
+		$(pwd) $(pwd) "$@" 'quoted text' --verbose test echo cd sed
+		grep /usr/bin test then 'quoted text'
+		readonly echo --verbose
+		$(pwd) done /usr/bin printf test 'quoted text'
+-eu 'quoted text' ${HOME} local done done export awk grep -eu
+		2>/dev/null export printf echo && && printf test -eu test -eu x=1 ${HOME} awk
+-eu awk export then sed && && printf echo readonly | test grep
+	"$@" ${HOME} 2>/dev/null then done echo readonly local "$@" grep cd export --verbose
+		2>/dev/null readonly $(pwd) $(pwd) /usr/bin
+	sed sed | then readonly $(pwd)
+/usr/bin cd done 'quoted text' readonly echo cd ${HOME} 2>/dev/null
+		2>/dev/null x=1 && 'quoted text' echo -eu && 2>/dev/null "$1" $(pwd) awk "$1"
+	awk done ${HOME} echo export test ${HOME}
+		done readonly cd ${HOME} cd printf export sed awk local --verbose awk echo
+	'quoted text' 2>/dev/null x=1 local "$1" "$1" ${HOME}
+	then "$1" export done export x=1 | --verbose "$@" ${HOME} then readonly export
+		/usr/bin 2>/dev/null local cd local $(pwd) printf "$@" cd "$@"
+then echo /usr/bin 2>/dev/null 2>/dev/null 'quoted text' --verbose
+		--verbose then 2>/dev/null grep done grep 'quoted text'
+	then printf export x=1 $(pwd) then sed test export readonly echo test | 'quoted text'
+	echo test done 2>/dev/null printf | printf --verbose
+		printf ${HOME} then $(pwd) local readonly
+done "$@" readonly 'quoted text' -eu awk ${HOME} local
+		&& sed | sed local ${HOME} /usr/bin
+	export 2>/dev/null printf grep then local | && printf 'quoted text'
+		$(pwd) "$1" test readonly
+	awk --verbose export $(pwd) "$1" local test
+		-eu 2>/dev/null $(pwd) $(pwd) local local ${HOME} readonly ${HOME}
+	$(pwd) ${HOME} | echo 2>/dev/null grep --verbose | done 'quoted text'
+"$1" printf done then "$1" awk ${HOME} test && -eu | sed sed grep $(pwd)
+$(pwd) echo "$@" test cd then local cd printf local 'quoted text'
+-eu "$1" then 'quoted text' awk local $(pwd) && /usr/bin
+		test | readonly awk sed awk test --verbose echo export grep -eu 'quoted text'
+	local export x=1 2>/dev/null 'quoted text' awk
+${HOME} | "$@" | ${HOME} awk export test 'quoted text' ${HOME}
+then awk cd "$@" sed 'quoted text' done && readonly -eu local export test cd
+	| | then --verbose --verbose | export
+export done grep then "$1" local "$@" local grep local | "$1"
+readonly local local then -eu && "$1" test readonly
+	2>/dev/null sed sed "$@" && && --verbose done grep && "$@" export
+		then "$@" done awk 'quoted text' 2>/dev/null readonly grep cd /usr/bin local
+#include c34.sh
+	'quoted text' local grep done /usr/bin && "$1" "$@" local done
+		"$1" ${HOME} && awk cd cd test printf
+	cd echo grep /usr/bin local -eu /usr/bin --verbose local ${HOME}
+"$1" echo readonly 2>/dev/null awk test 2>/dev/null
+	x=1 ${HOME} "$1" x=1 "$1" export
+	export echo $(pwd) done x=1 readonly
+		cd cd awk then grep "$1" sed "$1" "$@" echo $(pwd) 2>/dev/null local -eu &&
+printf printf done readonly ${HOME} grep "$1" then ${HOME} && -eu
+grep test ${HOME} "$@" sed test sed readonly $(pwd) echo
+	sed cd 'quoted text' ${HOME} done && echo -eu cd --verbose x=1
+		-eu printf then "$@" "$@" done test "$@" --verbose export $(pwd) grep export
+		--verbose x=1 && local grep echo awk test /usr/bin -eu x=1 /usr/bin cd done
+	printf x=1 test awk 'quoted text'
+"$@" "$1" -eu | then ${HOME} printf | export
+		awk grep then echo $(pwd) 2>/dev/null readonly echo 2>/dev/null
+		readonly "$@" /usr/bin "$@" "$1" ${HOME} "$@" --verbose "$1" done "$1" "$1"
+		awk cd test export grep then echo | ${HOME} echo ${HOME} "$@"
+readonly local printf x=1
+	cd grep printf "$@" local --verbose grep x=1 | && "$1"
+"$1" "$@" "$1" ${HOME} sed readonly "$@" grep $(pwd)
+		done | -eu 2>/dev/null x=1 grep "$@" 'quoted text' sed test export
+		${HOME} --verbose | local 2>/dev/null $(pwd) grep export | x=1 awk export echo
+		local $(pwd) export -eu "$1" echo grep then done | echo $(pwd) printf printf
+	&& cd -eu --verbose grep 2>/dev/null cd 2>/dev/null x=1 "$1" awk
+		cd 'quoted text' cd awk /usr/bin
+		-eu && ${HOME} then "$1" printf done && local echo 2>/dev/null
+		/usr/bin readonly "$1" | --verbose readonly
+-eu 'quoted text' echo cd then
+		export printf echo | echo cd then
+		${HOME} sed awk "$1" 'quoted text' "$1" "$@" readonly 2>/dev/null
+/usr/bin "$1" grep grep -eu ${HOME} sed export ${HOME} awk 2>/dev/null
+	/usr/bin 'quoted text' printf ${HOME} "$1" /usr/bin done
+		2>/dev/null ${HOME} then awk local | cd -eu 2>/dev/null export
+		${HOME} ${HOME} 'quoted text'
+-eu printf grep 'quoted text' readonly awk x=1 export readonly /usr/bin "$@"
+$(pwd) --verbose printf test 'quoted text'
+	'quoted text' && ${HOME}
+		cd echo "$1" export readonly | done 2>/dev/null "$@"
+		readonly printf printf "$1" local -eu done then cd local "$1" | sed "$@" then
+	&& sed | 2>/dev/null "$@" -eu awk awk && 2>/dev/null | -eu local
+	$(pwd) "$1" readonly ${HOME} 2>/dev/null
+sed export | x=1 x=1 cd $(pwd) 'quoted text' awk test echo readonly
+	/usr/bin cd | 2>/dev/null local grep "$1" "$@" awk --verbose awk sed && test export
+	printf export 'quoted text' printf then x=1 && grep ${HOME} "$1"
+| awk | then /usr/bin done export "$1" 'quoted text'
+		then --verbose cd /usr/bin x=1 sed "$1" ${HOME}
+then && | then echo readonly /usr/bin done done x=1 /usr/bin "$@" done
+"$1" $(pwd) test 'quoted text' "$@" grep export
+/usr/bin x=1 --verbose && /usr/bin export
+echo grep /usr/bin done echo awk test export
+/usr/bin "$@" /usr/bin 2>/dev/null then --verbose printf -eu cd
+"$@" echo export echo readonly
+	'quoted text' test echo sed readonly -eu | && cd 'quoted text' test done
+/usr/bin && test echo 'quoted text' test awk
+		/usr/bin test x=1 awk "$@" && echo test ${HOME} /usr/bin $(pwd) 'quoted text' done
+-eu sed "$1" readonly 2>/dev/null done
+	&& 2>/dev/null "$@" x=1 grep readonly "$1" 2>/dev/null
+| 2>/dev/null awk x=1 -eu /usr/bin then grep then readonly echo grep
+awk sed done 2>/dev/null 2>/dev/null
+		$(pwd) test 2>/dev/null grep | 'quoted text' test printf 'quoted text'
+	done done then "$@" 'quoted text'
+		cd grep 2>/dev/null --verbose done -eu grep echo
+&& ${HOME} "$@" echo printf test && && -eu
+	cd export printf "$@" "$1" ${HOME} grep x=1 then readonly done
+	sed "$1" readonly "$@" /usr/bin
+		awk x=1 x=1 2>/dev/null done
+'quoted text' $(pwd) printf test readonly local readonly sed cd --verbose
+	done then test then "$@" --verbose "$@" -eu printf
+printf --verbose -eu && grep then export --verbose
+	--verbose test awk $(pwd) readonly cd /usr/bin 'quoted text' local
+	"$@" cd readonly && $(pwd) printf test 'quoted text' --verbose | sed local test
+	$(pwd) -eu x=1 printf | --verbose "$1" done --verbose done
+2>/dev/null echo ${HOME} /usr/bin export awk then cd grep ${HOME} readonly
+		"$1" cd export 2>/dev/null export awk awk export test "$@" local printf
+	then awk sed x=1 2>/dev/null
+		then -eu | local readonly grep echo done readonly
+		sed test -eu -eu x=1 'quoted text' then /usr/bin sed grep ${HOME} cd echo
+	grep 'quoted text' test echo x=1 "$@" readonly done done then cd &&
+cd test 'quoted text' test
+then 'quoted text' sed then then local printf
+	done printf echo "$1" printf /usr/bin export done
+		cd readonly x=1 'quoted text'
+&& local then echo | readonly printf
+	-eu "$@" 2>/dev/null "$@" awk ${HOME} -eu && cd printf awk cd done
+"$@" export done then awk /usr/bin | sed sed && sed | done && -eu printf
+| $(pwd) sed done printf x=1 "$1" awk 'quoted text' && then sed printf "$@"
+	| test done test ${HOME} then printf "$1" -eu && 'quoted text' grep
+	-eu readonly x=1 $(pwd) ${HOME}
+"$@" x=1 "$@" awk "$1" export && 2>/dev/null done 'quoted text' "$1"
+		--verbose export "$1" | echo
+x=1 /usr/bin 2>/dev/null --verbose /usr/bin | done 2>/dev/null --verbose "$@" 'quoted text'
+done | "$1" ${HOME} "$@" local
+"$1" 'quoted text' --verbose $(pwd)
+	then readonly 2>/dev/null
+/usr/bin -eu --verbose --verbose -eu local printf printf "$@" done cd && |
+	"$1" $(pwd) /usr/bin x=1 | local "$1" sed readonly printf
+	"$1" test cd ${HOME} /usr/bin test 2>/dev/null ${HOME} "$1" echo
+2>/dev/null "$1" local done && readonly local readonly -eu sed
+$(pwd) readonly --verbose printf
+	local sed awk cd then x=1 cd then $(pwd) x=1 printf
+2>/dev/null /usr/bin printf 'quoted text' awk awk readonly
+		'quoted text' done 2>/dev/null 2>/dev/null local && $(pwd) -eu | export
+		'quoted text' && done export done echo then
+	test sed --verbose export
+		export grep "$1" cd printf
+	sed done sed done export && --verbose /usr/bin
+done echo grep printf local -eu awk echo
+		| && echo cd export --verbose
+$(pwd) | --verbose ${HOME} done /usr/bin
+test -eu && | ${HOME} printf x=1 $(pwd)
+		grep "$1" "$1" && then awk test -eu $(pwd) && | 2>/dev/null done "$1"
+		--verbose local test 2>/dev/null -eu | sed $(pwd) "$@" then local
+	'quoted text' done test then "$@" x=1
+	"$@" /usr/bin --verbose /usr/bin $(pwd) export
+	sed printf "$@" x=1 grep readonly -eu printf 2>/dev/null grep ${HOME} --verbose
+		printf "$1" echo $(pwd) awk done echo printf x=1 test "$@" cd
+		| $(pwd) awk awk 'quoted text' 2>/dev/null
+	then x=1 echo 'quoted text' printf 'quoted text' local awk | "$@"
+printf ${HOME} echo export grep cd then /usr/bin test $(pwd) "$1"
+	$(pwd) --verbose /usr/bin cd $(pwd) "$@" readonly
+	test done cd $(pwd) $(pwd) $(pwd) then done "$@" $(pwd) then
+export x=1 awk -eu ${HOME} readonly 2>/dev/null awk local test local ${HOME}
+test x=1 export done done done $(pwd) export && printf test x=1 sed --verbose then
+		then test ${HOME} -eu readonly echo --verbose /usr/bin --verbose awk ${HOME}
+		echo sed cd -eu -eu echo done
+x=1 sed | then ${HOME} "$1" grep "$1" | awk 2>/dev/null
+/usr/bin echo then /usr/bin done test ${HOME}
+		'quoted text' test | $(pwd) ${HOME} done
+		"$1" x=1 then && "$1" $(pwd) "$1" -eu
+		printf --verbose | sed export ${HOME} 2>/dev/null
+echo then readonly "$1"
+		$(pwd) cd "$1" --verbose echo x=1 cd | | 'quoted text'
+	grep grep --verbose awk x=1 'quoted text' --verbose -eu "$@" | "$@" done
+		$(pwd) "$1" $(pwd) 'quoted text' /usr/bin
+	'quoted text' "$1" -eu cd /usr/bin
+	| x=1 printf 2>/dev/null export
+then readonly -eu | sed done sed sed "$1" sed
+	awk then then local grep ${HOME} | then -eu echo -eu "$@" -eu printf export -eu
+export --verbose $(pwd) -eu local cd export echo 'quoted text'
+printf | echo test done "$@" $(pwd) grep -eu 'quoted text'
+	printf $(pwd) 2>/dev/null readonly echo 2>/dev/null $(pwd) x=1
+	echo "$@" $(pwd) -eu | /usr/bin export "$@" 2>/dev/null
+		| printf -eu && local done ${HOME} -eu done
+		2>/dev/null | $(pwd) awk done readonly 'quoted text' -eu 'quoted text'
+		/usr/bin "$1" then 'quoted text' | cd awk cd "$1" x=1 printf local |
+	sed --verbose "$@" 2>/dev/null grep $(pwd) cd
+		'quoted text' sed test then done /usr/bin echo sed then
+		--verbose test x=1 'quoted text' 'quoted text'
+		then local x=1 /usr/bin readonly grep printf sed local ${HOME}
+		| ${HOME} printf printf cd /usr/bin sed sed printf x=1
+	export 2>/dev/null readonly "$@" cd ${HOME}
+	| "$1" done 'quoted text' | readonly 2>/dev/null readonly awk
+local "$1" -eu | awk then
+		2>/dev/null 2>/dev/null grep awk grep $(pwd) done readonly | printf
+		'quoted text' "$1" test cd then grep "$@"
+x=1 $(pwd) test && awk awk 2>/dev/null awk cd cd | export done 'quoted text'
+	grep test -eu x=1 /usr/bin 2>/dev/null
+		$(pwd) | cd sed export x=1 echo readonly -eu ${HOME} -eu printf
+$(pwd) readonly /usr/bin 'quoted text' awk x=1
+	export awk /usr/bin cd local
+	then && -eu 'quoted text'
+		"$1" | done sed $(pwd) && -eu /usr/bin | 2>/dev/null
+		grep local export export -eu 2>/dev/null ${HOME} export
+then readonly && local export 2>/dev/null --verbose &&
+	test sed && done -eu test /usr/bin 'quoted text' awk done
+| -eu "$1" | x=1 export echo test 'quoted text'
+x=1 then /usr/bin 2>/dev/null
+readonly then "$@" $(pwd) then grep "$1" "$1"
+'quoted text' | "$1" export "$@" local | 2>/dev/null -eu awk
+cd "$@" /usr/bin echo "$@" then | sed local local readonly
+		sed echo grep /usr/bin "$@"
+		-eu x=1 && "$1" test | ${HOME} grep grep test readonly export 2>/dev/null
+	export ${HOME} done echo then done printf then awk | export "$@" 'quoted text'
+		| && --verbose ${HOME} test 2>/dev/null done
+		'quoted text' cd "$@" awk echo readonly local $(pwd) ${HOME} ${HOME}
+/usr/bin grep $(pwd) "$@" | /usr/bin /usr/bin local "$@" local
+| echo | | ${HOME} ${HOME} /usr/bin
+		&& $(pwd) "$1" x=1 --verbose -eu /usr/bin test local export
+sed -eu printf local -eu grep readonly $(pwd) local
+	readonly sed && $(pwd) && /usr/bin sed 'quoted text' local 2>/dev/null sed | echo
+		2>/dev/null "$@" then cd $(pwd)
+/usr/bin && /usr/bin then sed awk && cd | --verbose then x=1
+	"$1" readonly -eu cd grep
+	$(pwd) -eu | | | readonly done -eu done awk
+| export echo | export 2>/dev/null "$1" awk 2>/dev/null
+| --verbose printf then | echo
+		echo done /usr/bin -eu 2>/dev/null "$1" /usr/bin "$1" --verbose 2>/dev/null
+/usr/bin /usr/bin && cd ${HOME} --verbose readonly sed printf awk x=1 echo ${HOME}
+echo 'quoted text' ${HOME} -eu --verbose "$1" 'quoted text' "$1" 'quoted text'
+		"$1" ${HOME} "$@" printf test | 'quoted text' "$1" cd awk printf -eu -eu
+		awk x=1 | && && "$1" ${HOME} readonly | test
+| -eu awk then test x=1
+	$(pwd) export local grep "$@" awk readonly
+| "$1" -eu x=1 $(pwd) "$@" --verbose "$@" readonly readonly local
+${HOME} grep "$1" sed "$@"
+	export "$1" 2>/dev/null $(pwd) 2>/dev/null echo export $(pwd) -eu ${HOME}
+test $(pwd) printf "$@" local sed sed readonly export
+${HOME} /usr/bin printf grep printf test test -eu
+		--verbose ${HOME} grep readonly "$@" "$1" $(pwd)
+		grep -eu "$@" grep readonly then cd export done 2>/dev/null $(pwd) x=1 ${HOME}
+		sed done "$@" -eu "$1" local 'quoted text' 2>/dev/null
+	&& 'quoted text' "$@" then
+	grep 2>/dev/null /usr/bin readonly "$1" /usr/bin
+		$(pwd) /usr/bin "$1" ${HOME} && 2>/dev/null echo readonly readonly
+		| /usr/bin | test 'quoted text' test echo awk ${HOME}
+		$(pwd) x=1 && 2>/dev/null "$@" then done done
+	"$@" 'quoted text' cd grep 'quoted text'
+	'quoted text' sed done done sed printf awk ${HOME}
+	&& local grep test "$@" && $(pwd) then ${HOME} awk printf echo sed
+--verbose "$1" | done $(pwd) 2>/dev/null --verbose $(pwd)
+	-eu local sed $(pwd) then readonly sed --verbose 'quoted text'
+--verbose "$@" echo ${HOME} $(pwd) | | && /usr/bin -eu $(pwd) readonly $(pwd)
+test grep "$1" "$1" awk 2>/dev/null ${HOME} awk -eu
+printf /usr/bin 2>/dev/null export then x=1 echo /usr/bin 2>/dev/null
+	export awk done /usr/bin "$@" && export --verbose test echo then export
+	echo "$1" "$@" /usr/bin
+grep | "$@" test printf | sed sed echo 'quoted text' |
+--verbose 'quoted text' printf ${HOME} grep $(pwd) then
+		x=1 $(pwd) sed 'quoted text' 'quoted text' ${HOME} /usr/bin
+then -eu 'quoted text' readonly grep done then done
+		| "$1" -eu 'quoted text'
+		sed x=1 export local &&
+	test local awk --verbose echo "$@" && printf readonly
+awk | readonly sed x=1 -eu $(pwd) && 'quoted text'
+	&& "$1" 2>/dev/null ${HOME}
+		readonly /usr/bin && cd grep x=1 "$@" $(pwd) sed readonly done export
+"$@" then printf printf
+"$1" grep readonly grep
+		$(pwd) readonly $(pwd) awk &&
+	/usr/bin grep 2>/dev/null test printf cd
+| 2>/dev/null 2>/dev/null ${HOME} grep $(pwd)
+$(pwd) x=1 x=1 x=1 -eu | 2>/dev/null && awk local echo export printf /usr/bin
+		local x=1 printf sed echo sed && &&
+-eu readonly x=1 printf --verbose "$1" --verbose
+'quoted text' -eu echo | "$1" echo && sed readonly sed cd /usr/bin done awk readonly
+awk x=1 then "$@" --verbose /usr/bin 2>/dev/null then then | $(pwd) awk
+	cd && --verbose 2>/dev/null | 2>/dev/null
+		&& x=1 export x=1 -eu sed $(pwd) echo printf $(pwd) /usr/bin --verbose "$1" done
+"$@" readonly -eu /usr/bin
+	done printf readonly awk awk |
+	test && 'quoted text' test
+		&& && sed "$1" ${HOME} export ${HOME} $(pwd) "$@"
+	${HOME} ${HOME} grep "$1" -eu | test 'quoted text'
+	--verbose --verbose grep | 'quoted text' && /usr/bin export ${HOME} awk
+${HOME} cd --verbose && "$1"
+		${HOME} -eu "$1" /usr/bin "$1" readonly /usr/bin -eu printf
+cd "$1" local | awk -eu && --verbose echo sed -eu export sed "$@" cd "$@"
+| cd printf export x=1 "$1" 2>/dev/null "$1" cd printf cd $(pwd) && /usr/bin
+	done then grep export 'quoted text' then "$1" test export | 2>/dev/null
+-eu sed 'quoted text' --verbose export cd 2>/dev/null
+		"$1" "$@" | x=1 ${HOME} ${HOME}
+	readonly ${HOME} 2>/dev/null local grep local | /usr/bin
+"$1" test "$1" && awk echo 2>/dev/null "$1" sed --verbose -eu
+	${HOME} 2>/dev/null | printf test /usr/bin echo /usr/bin x=1 && cd
+	| printf done done sed -eu /usr/bin
+	export && readonly test x=1 "$@" echo
+		test readonly && awk printf "$1" done 'quoted text'
+	awk readonly cd "$@" -eu 2>/dev/null test export -eu "$@" cd export "$1"
+		cd echo 'quoted text' cd --verbose test then readonly then done 2>/dev/null
+'quoted text' x=1 2>/dev/null awk readonly local test 2>/dev/null ${HOME}
+		--verbose awk then /usr/bin 2>/dev/null printf
+	| x=1 "$1" $(pwd) awk sed 2>/dev/null && $(pwd) then 'quoted text'
+	then awk /usr/bin "$1" readonly printf then local sed
+		"$1" local test grep readonly cd then awk /usr/bin
+	test && local export grep cd
+		| -eu echo cd x=1 && 2>/dev/null "$@" x=1 test readonly
+	sed then echo awk done echo printf printf --verbose $(pwd) grep 2>/dev/null
+		awk -eu printf then "$@" "$1" cd local && 'quoted text' 'quoted text'
+		$(pwd) cd 2>/dev/null
+| -eu echo ${HOME} awk x=1 "$@" "$1" $(pwd) awk /usr/bin "$1" grep "$1" -eu
+${HOME} --verbose ${HOME} ${HOME} test then then readonly x=1
+sed 2>/dev/null then printf then readonly
+'quoted text' ${HOME} echo cd local grep test | -eu ${HOME}
+	then && awk local && "$1" ${HOME} --verbose $(pwd) awk
+2>/dev/null done && 2>/dev/null "$1" echo /usr/bin 2>/dev/null && | local &&
+	2>/dev/null $(pwd) grep $(pwd)
+then awk --verbose "$1" 'quoted text'
+awk 'quoted text' $(pwd) ${HOME}
+		${HOME} local | local ${HOME} sed | -eu
+		"$1" ${HOME} done "$1" 2>/dev/null 2>/dev/null --verbose
+		"$@" | grep 'quoted text'
+	test done "$@" cd local readonly /usr/bin --verbose --verbose
+/usr/bin done cd 2>/dev/null grep 'quoted text' local --verbose
+		x=1 sed cd 'quoted text' 2>/dev/null | && local printf awk 2>/dev/null grep
+	"$@" -eu cd test then "$1" local printf sed /usr/bin -eu
+	test readonly -eu cd printf ${HOME} --verbose awk echo "$@" &&
+	2>/dev/null "$@" echo --verbose
+sed echo "$1" 2>/dev/null
+	"$@" "$@" 'quoted text' export printf 'quoted text' "$@" done
+	"$@" sed ${HOME} then && export ${HOME} done done | local local -eu awk
+		done sed -eu sed -eu echo -eu $(pwd) x=1 done
+${HOME} "$@" printf echo grep then "$@" --verbose ${HOME} ${HOME}
+grep "$1" export done -eu
+	$(pwd) $(pwd) test 'quoted text' sed then ${HOME} sed 2>/dev/null -eu $(pwd)
+		"$1" cd grep /usr/bin echo 'quoted text'
+--verbose readonly --verbose echo export done && echo grep 2>/dev/null $(pwd) cd
+		grep test printf $(pwd) -eu -eu then /usr/bin echo | test "$@" grep && sed
+	export printf | "$@" cd test -eu export "$1" printf 2>/dev/null
+		x=1 $(pwd) echo "$@" "$1" && "$@" --verbose x=1 ${HOME} | "$1" printf export
+	cd grep ${HOME} /usr/bin "$1" | --verbose awk done
+		local echo sed printf echo printf done
+		printf x=1 ${HOME} cd $(pwd) $(pwd) printf sed done -eu readonly local
+		'quoted text' echo export | x=1 /usr/bin local cd
+	export --verbose test -eu test readonly grep done done echo readonly
+		-eu echo done && test ${HOME} done
+		echo readonly awk 2>/dev/null
+		'quoted text' export echo local cd "$1" test echo printf
+	echo sed 2>/dev/null -eu grep
+		'quoted text' | ${HOME} && "$@" 'quoted text' && grep local -eu "$@" then 'quoted text'
+	/usr/bin 'quoted text' done -eu "$@" awk export
+		awk "$@" 'quoted text' test --verbose
+		${HOME} then ${HOME} 'quoted text'
+	"$@" awk cd --verbose x=1 awk done sed --verbose echo "$@" ${HOME}
+		cd readonly cd echo ${HOME} export printf x=1 "$@" x=1
+		"$@" grep sed $(pwd) printf "$@" "$@"
+	readonly grep awk printf && 2>/dev/null echo readonly /usr/bin
+	-eu local awk "$1" test readonly && "$1" grep --verbose
+	x=1 test 2>/dev/null then 2>/dev/null grep awk --verbose
+	"$@" cd echo | ${HOME} x=1 "$@" done grep test sed -eu
+	readonly test "$1" 'quoted text' done awk x=1 readonly
+	| grep grep sed printf printf printf
+	"$@" export local | sed $(pwd) printf readonly test sed | "$1" -eu test cd
+	2>/dev/null echo "$1" -eu && export readonly printf
+		awk awk awk cd then 'quoted text' grep "$1"
+	/usr/bin x=1 cd echo
+2>/dev/null done 2>/dev/null --verbose
+then grep sed x=1 | $(pwd) test export readonly
+	printf ${HOME} ${HOME} cd -eu /usr/bin --verbose x=1 then local /usr/bin
+2>/dev/null 'quoted text' && -eu readonly 'quoted text' sed
+test 2>/dev/null -eu sed export echo done printf $(pwd) && awk cd export x=1
+	then then awk 'quoted text' awk 'quoted text' done
+	readonly /usr/bin cd -eu then && ${HOME} && done readonly | "$@" export echo
+		${HOME} x=1 "$1" x=1 && done test done grep
+		echo "$1" done local ${HOME} 'quoted text' printf
+	grep echo $(pwd) -eu cd readonly local local &&
+	${HOME} "$@" 2>/dev/null "$@" x=1 "$@" awk test "$@" 'quoted text' ${HOME} $(pwd)
+		-eu then "$@" $(pwd) /usr/bin "$@" /usr/bin "$@"
+		then 'quoted text' grep -eu | awk done $(pwd) cd local awk cd done readonly
+		export 'quoted text' | readonly readonly && | then done done
+	sed printf "$@" $(pwd) | "$@" echo $(pwd) /usr/bin test
+-eu readonly 2>/dev/null then echo export 'quoted text' readonly &&
+test --verbose export test 2>/dev/null local x=1
+then done 2>/dev/null 2>/dev/null local done 'quoted text'
+export then ${HOME} printf grep /usr/bin --verbose
+		&& printf readonly x=1 $(pwd) 'quoted text' "$@"
+	cd test /usr/bin $(pwd) --verbose awk "$1"
+		--verbose $(pwd) /usr/bin
+	"$1" ${HOME} --verbose $(pwd) x=1 x=1 echo readonly done local export test
+	2>/dev/null $(pwd) $(pwd) /usr/bin x=1 echo export
+	-eu readonly local --verbose /usr/bin sed done && printf "$1" x=1 cd
+		--verbose | test x=1 $(pwd) $(pwd) cd --verbose export
+	sed cd ${HOME} test awk
+		readonly awk /usr/bin grep grep 2>/dev/null ${HOME} test "$1"
+/usr/bin grep -eu done cd "$1" then cd "$1" readonly 2>/dev/null printf readonly
+		then echo then echo "$@" sed then -eu /usr/bin printf "$1" done /usr/bin
+	test "$1" && echo $(pwd) -eu --verbose sed
+		printf "$1" done grep $(pwd) -eu
+x=1 sed echo ${HOME} printf readonly export 'quoted text' awk
+		test ${HOME} -eu echo cd && awk
+	"$1" "$1" "$1" -eu -eu readonly
+	"$@" --verbose 'quoted text' | 2>/dev/null printf export
+		grep test printf --verbose | then
+		${HOME} /usr/bin export && then "$1" "$@" && 2>/dev/null && x=1 "$@" readonly
+printf printf $(pwd) ${HOME} 2>/dev/null grep grep test ${HOME}
+sed "$@" "$@" | grep $(pwd) "$@" -eu | | --verbose local 'quoted text'
+-eu ${HOME} ${HOME} awk done awk export "$@" ${HOME} test | sed $(pwd)
+"$1" export | | "$1" "$1"
+		export ${HOME} test 2>/dev/null "$@" test /usr/bin --verbose
+	'quoted text' "$@" | echo -eu --verbose then | test 2>/dev/null "$1" done ${HOME}
+		sed && ${HOME} 2>/dev/null local
+/usr/bin readonly 'quoted text' "$@" && echo --verbose
+	"$1" 2>/dev/null | && x=1 done --verbose done awk done /usr/bin 'quoted text' done
+/usr/bin "$@" readonly awk test then 2>/dev/null 'quoted text' sed local done
+		2>/dev/null | $(pwd) "$@" sed "$1" readonly --verbose done awk cd
+		/usr/bin $(pwd) export cd "$1" "$@" test x=1 grep "$@" readonly "$@"
+	$(pwd) && "$@" --verbose | ${HOME} export done $(pwd) echo -eu 'quoted text'
+x=1 then ${HOME} export x=1 x=1 'quoted text'
+	| echo local "$1" -eu "$1" sed ${HOME}
+		grep echo printf x=1 -eu awk local 'quoted text'
+		--verbose echo echo then
+echo 2>/dev/null readonly ${HOME} local
+done $(pwd) test local $(pwd) "$@" then --verbose awk --verbose export
+	cd awk /usr/bin awk $(pwd)
+		$(pwd) 2>/dev/null | local ${HOME} "$@" -eu printf
+		$(pwd) then export then 'quoted text' readonly "$@" &&
+export then 'quoted text' 'quoted text'
+-eu "$@" grep echo $(pwd) | export "$1" then
+	awk 2>/dev/null sed -eu /usr/bin done --verbose
+	test awk sed "$1" test awk $(pwd) then x=1 echo
+	"$@" awk && cd test awk done sed done /usr/bin -eu -eu ${HOME} readonly
+		sed $(pwd) "$1" then "$1" x=1 readonly
+	--verbose "$1" "$1" readonly -eu
+		export test printf | local -eu 'quoted text' 2>/dev/null
+		"$1" sed "$@" "$@" /usr/bin grep readonly --verbose
+grep | sed && cd x=1 export then grep x=1 export sed done awk | echo 'quoted text'
+		cd x=1 2>/dev/null && printf --verbose sed test -eu grep x=1 && grep
+	${HOME} && --verbose echo echo 'quoted text' echo -eu
+	done 2>/dev/null echo /usr/bin cd --verbose test test echo export cd printf $(pwd)
+	$(pwd) /usr/bin 'quoted text' 2>/dev/null |
+echo --verbose "$@" $(pwd) $(pwd) "$1" x=1 done grep done
+	/usr/bin sed printf export "$1" 2>/dev/null ${HOME} done x=1 awk | export
+test | grep printf local "$1" echo "$1" echo 'quoted text'
+awk test awk local "$@" done 2>/dev/null
+	/usr/bin cd cd cd readonly
+test local x=1 printf x=1 --verbose $(pwd) sed test printf
+		x=1 awk -eu echo "$@" awk "$@" "$@" sed awk 'quoted text' grep
+		printf /usr/bin then then /usr/bin && echo cd 2>/dev/null x=1
+		grep printf awk sed | test printf $(pwd) "$@" 'quoted text' local && 2>/dev/null
+	echo done export && -eu ${HOME} x=1 -eu 2>/dev/null "$1"
+grep grep /usr/bin /usr/bin readonly x=1 echo export cd cd && $(pwd) x=1
+		$(pwd) -eu grep --verbose
+	"$@" then $(pwd) -eu 2>/dev/null "$@" echo cd /usr/bin done grep grep
+	printf readonly "$1" printf export 2>/dev/null then cd echo
+	export cd echo 'quoted text' grep then export cd 'quoted text'
+x=1 x=1 export awk cd done ${HOME} echo done echo "$1"
+&& export 2>/dev/null $(pwd)
+		/usr/bin x=1 $(pwd) done printf readonly /usr/bin "$1" x=1
+awk export echo x=1 /usr/bin done x=1 echo "$1" grep && awk x=1 local
+		"$1" | ${HOME} "$1" | printf done --verbose
+	/usr/bin $(pwd) "$1" "$@" "$1" export | "$@" x=1 cd export echo $(pwd)
+		readonly done grep -eu cd /usr/bin echo
+	readonly 2>/dev/null /usr/bin
+	| cd -eu readonly --verbose 'quoted text'
+done "$1" -eu --verbose echo sed test --verbose test test
+		| sed "$@" sed "$1" then sed /usr/bin $(pwd) | printf awk done x=1 printf printf
+		"$1" test | readonly echo test awk ${HOME} test ${HOME}
+	printf ${HOME} 'quoted text' readonly ${HOME} cd
+"$1" test 2>/dev/null "$1" ${HOME}
+		then echo && ${HOME} | --verbose && grep
+	echo && $(pwd) "$@" "$@" awk
+readonly --verbose && awk && printf test x=1 test | /usr/bin 2>/dev/null
+-eu sed ${HOME} "$1" test 'quoted text' awk export awk echo awk local
+	done test export then ${HOME} 'quoted text'
+	&& cd awk 'quoted text' x=1 printf readonly test grep local
+	awk 2>/dev/null /usr/bin local
+	test done | test 2>/dev/null 2>/dev/null | awk /usr/bin awk sed /usr/bin
+-eu ${HOME} -eu then 'quoted text'
+	awk /usr/bin | /usr/bin then
+	--verbose cd local "$1" $(pwd) grep 2>/dev/null x=1 --verbose
+cd && "$@" | local -eu && && $(pwd) 'quoted text' awk test export local readonly
+	echo x=1 "$@" readonly 2>/dev/null grep local 2>/dev/null "$1" cd local cd
+		--verbose --verbose sed awk done done sed sed 2>/dev/null test then
+	local export x=1 -eu 'quoted text' test grep ${HOME} "$@"
+	printf echo 2>/dev/null local awk
+then -eu then ${HOME} cd $(pwd) -eu x=1 && --verbose $(pwd) -eu echo local
+	2>/dev/null test x=1 "$1" local && ${HOME} awk then "$1" 'quoted text'
+cd -eu $(pwd) sed test local echo done | cd --verbose && cd then --verbose --verbose
+	test test | "$@" echo sed
+then sed /usr/bin --verbose sed cd -eu cd
+readonly 2>/dev/null cd echo 'quoted text' sed export "$1" echo awk
+	done then 'quoted text' export then
+		grep --verbose | | awk |
+sed local "$@" done echo export && cd sed 'quoted text' ${HOME} 2>/dev/null $(pwd)
+2>/dev/null then | readonly --verbose printf /usr/bin grep /usr/bin
+| --verbose test awk sed $(pwd) readonly echo "$@" echo
+	done cd readonly /usr/bin && done $(pwd) grep
+grep x=1 sed cd done sed local 'quoted text'
+2>/dev/null x=1 | export ${HOME}
+	sed ${HOME} --verbose ${HOME} | x=1 grep /usr/bin
+		local x=1 | 2>/dev/null --verbose 2>/dev/null | echo sed
+	2>/dev/null echo cd -eu ${HOME} && $(pwd) then $(pwd)
+		x=1 local awk echo local 'quoted text' x=1 printf x=1 $(pwd) -eu
+export grep sed | 'quoted text' ${HOME} "$1" export then ${HOME} -eu $(pwd) test
+	cd 2>/dev/null $(pwd) local awk cd export local test test awk then export
+	-eu 'quoted text' export awk "$1" -eu /usr/bin
+| -eu readonly ${HOME} $(pwd) readonly awk --verbose grep test
+	"$1" /usr/bin /usr/bin && x=1 cd grep
+x=1 done "$1" ${HOME} x=1 printf $(pwd) then --verbose
+		2>/dev/null then test echo x=1
+sed echo $(pwd) sed local cd then then
+		-eu -eu /usr/bin cd then x=1
+-eu -eu then done printf --verbose && sed && "$@" awk "$1" sed --verbose 2>/dev/null
+		awk /usr/bin echo sed awk printf printf then $(pwd) && grep done $(pwd) 2>/dev/null
+		${HOME} /usr/bin readonly --verbose | "$1" && | cd --verbose
+	/usr/bin grep then && grep | test export | readonly "$@"
+"$@" -eu then 2>/dev/null && ${HOME} 'quoted text' && 2>/dev/null
+	${HOME} export ${HOME} awk awk
+		"$@" --verbose export readonly echo
+readonly echo $(pwd) 'quoted text' $(pwd) sed printf export done echo then
+--verbose 'quoted text' ${HOME} x=1 sed readonly then 'quoted text' --verbose
+${HOME} && -eu "$1" && && "$1"
+		sed test export cd | cd local x=1 printf | && && | ${HOME} -eu printf
+sed 'quoted text' export cd 2>/dev/null local && && "$1"
+sed $(pwd) | ${HOME} readonly then 'quoted text' local echo local
+readonly test | ${HOME} --verbose
+/usr/bin local awk sed -eu sed $(pwd) "$@"
+		${HOME} | "$@" then --verbose 'quoted text' $(pwd) ${HOME} ${HOME} then
+		local /usr/bin echo $(pwd) | awk awk "$1" done done
+	&& sed printf /usr/bin sed readonly grep -eu local done
+		| -eu done grep --verbose
+		/usr/bin export "$1" awk awk /usr/bin
+		readonly awk --verbose /usr/bin printf $(pwd) --verbose -eu "$1" printf
+		/usr/bin 2>/dev/null export done |
+	| ${HOME} then 'quoted text' awk --verbose | ${HOME} 2>/dev/null "$1" test
+	"$1" -eu then done test sed | | printf x=1 then export local
+local ${HOME} printf done cd export -eu ${HOME} sed cd "$@" --verbose printf
+		awk "$@" sed done --verbose done && grep
+readonly readonly grep && x=1 cd 'quoted text'
+		awk done printf --verbose && -eu
+	2>/dev/null local grep | grep && -eu local ${HOME} "$1"
+	"$1" "$1" local && && --verbose grep | test x=1 /usr/bin
+		awk local export done $(pwd) grep -eu printf readonly sed test x=1
+	test 'quoted text' then
+		test --verbose test done awk sed grep | test grep -eu | readonly
+	cd 'quoted text' echo echo /usr/bin cd ${HOME} export 2>/dev/null done
+	done "$@" readonly 'quoted text'
+	export test local echo --verbose | "$@" local x=1
+	export $(pwd) --verbose
+		test | $(pwd) grep && done readonly sed | grep cd
+	local sed "$@" x=1 grep readonly echo readonly
+"$1" "$@" -eu export /usr/bin /usr/bin
+		-eu readonly && awk test /usr/bin done local /usr/bin
+		$(pwd) ${HOME} "$1" ${HOME} sed echo "$@" cd then grep && 'quoted text' x=1 export
+'quoted text' && /usr/bin awk echo printf done then local done --verbose
+--verbose cd done test local cd "$1"
+		&& 2>/dev/null $(pwd) done echo 2>/dev/null 2>/dev/null $(pwd) && &&
+	readonly -eu x=1 ${HOME} printf | export sed grep awk awk
+cd cd 'quoted text' done printf
+		| awk then local sed readonly 2>/dev/null --verbose
+'quoted text' local x=1 printf then then --verbose 2>/dev/null
+	x=1 done 2>/dev/null readonly "$@" 2>/dev/null printf ${HOME}
+local local "$1" test cd --verbose "$@"
+printf $(pwd) | then export sed
+"$1" cd 2>/dev/null sed "$1" cd && local local readonly 'quoted text' echo |
+grep echo sed printf && local
+		--verbose export local awk -eu cd test "$1" grep
+		2>/dev/null "$@" local done --verbose echo | 'quoted text' x=1 ${HOME}
+$(pwd) readonly $(pwd) 'quoted text'
+	| readonly $(pwd) x=1 local --verbose then ${HOME}
+"$1" readonly test -eu "$@" echo -eu 'quoted text'
+-eu cd 'quoted text' readonly 'quoted text' readonly
+		"$@" readonly sed "$@" then x=1 readonly
+	then export sed printf awk 'quoted text' export
+		"$@" printf echo x=1 --verbose $(pwd) then export x=1 local
+/usr/bin ${HOME} 'quoted text' awk printf readonly | awk $(pwd) $(pwd) &&
+	'quoted text' "$1" done
+local --verbose printf x=1 --verbose 'quoted text'
+		cd $(pwd) echo --verbose /usr/bin ${HOME} echo then
+	printf readonly test then 2>/dev/null
+		cd && /usr/bin readonly export readonly readonly then printf readonly export
+	'quoted text' $(pwd) --verbose sed x=1 test
+		echo -eu readonly readonly x=1 x=1 awk printf 2>/dev/null
+	"$1" export ${HOME} --verbose
+		2>/dev/null echo echo sed
+readonly grep $(pwd) $(pwd) printf export "$@" && ${HOME} && test
+		'quoted text' 2>/dev/null 'quoted text' sed && $(pwd) echo cd grep
+	then grep | -eu grep export then | grep ${HOME} $(pwd) grep $(pwd) test readonly
+	"$@" --verbose awk 'quoted text' test cd 2>/dev/null local echo $(pwd) printf
+${HOME} then export --verbose
+		awk | sed $(pwd) "$1" 2>/dev/null local export "$@" "$@" local
+		&& 2>/dev/null "$1" $(pwd) -eu then && x=1 --verbose 2>/dev/null
+	"$@" /usr/bin /usr/bin cd && export
+export 'quoted text' "$@" cd export x=1 && "$1"
+	sed ${HOME} -eu "$1" -eu export done $(pwd) then 'quoted text' test x=1
+| --verbose then test && | 2>/dev/null
+	export $(pwd) export awk 2>/dev/null then x=1 printf | grep
+	'quoted text' && 'quoted text' awk export cd echo readonly 2>/dev/null
+	cd local readonly && -eu export --verbose done -eu grep awk sed
+done 2>/dev/null echo && local -eu $(pwd) /usr/bin "$1" then local local
+export x=1 -eu local "$1" | /usr/bin local readonly cd && --verbose "$@"
+		awk 'quoted text' done export export
+	export printf export done 2>/dev/null /usr/bin 'quoted text' -eu awk && --verbose
+		done ${HOME} "$1" done ${HOME} cd cd | export echo grep echo
+	export echo 'quoted text' test
+		done -eu 2>/dev/null printf cd awk sed cd test -eu
+	x=1 local local sed "$1" readonly 2>/dev/null awk $(pwd) local
+		then export 'quoted text' x=1 awk "$@" export
+	cd then done "$1" grep echo
+test sed -eu local 2>/dev/null 2>/dev/null && 2>/dev/null
+		--verbose printf -eu | grep "$@" done -eu printf then $(pwd) sed ${HOME}
+printf x=1 done "$1" "$@" 'quoted text' cd printf 'quoted text'
+local x=1 then printf awk && readonly sed awk ${HOME} /usr/bin
+		done export "$1" readonly echo $(pwd) --verbose local
+	'quoted text' printf && x=1 x=1 $(pwd) 'quoted text' local cd done done
+grep && export test awk "$@" --verbose
+		echo -eu -eu | then ${HOME} printf --verbose done --verbose
+/usr/bin /usr/bin test 'quoted text'
+	printf echo printf | done $(pwd) done readonly done test
+		sed x=1 -eu readonly 'quoted text'
+		"$@" ${HOME} export local done export ${HOME} sed /usr/bin
+		printf x=1 -eu awk readonly then --verbose "$@" local x=1 ${HOME}
+		| echo 'quoted text' /usr/bin echo echo sed grep $(pwd)
+		| && x=1 | export cd --verbose export local x=1 ${HOME} awk then
+then "$@" local export sed local done then awk local -eu test -eu -eu
+	-eu "$@" done export x=1 test | --verbose $(pwd) echo awk printf x=1 | |
+	&& readonly export done awk cd ${HOME} test
+		&& -eu x=1 "$1" /usr/bin x=1 awk -eu readonly -eu 'quoted text' sed awk awk
+then readonly "$@" $(pwd) "$1" then $(pwd) ${HOME} awk then
+grep $(pwd) "$@" ${HOME} export echo /usr/bin awk printf /usr/bin
+readonly && then --verbose x=1 $(pwd) awk
+	x=1 printf local export $(pwd) 'quoted text'
+2>/dev/null test grep x=1 awk cd $(pwd)
+		export ${HOME} awk | && done printf cd
+	$(pwd) cd /usr/bin grep -eu cd done ${HOME} "$1" && -eu test grep echo --verbose
+		x=1 "$@" && 2>/dev/null echo $(pwd) x=1 awk
+echo 'quoted text' | 'quoted text'
+		/usr/bin then readonly "$@" --verbose readonly
+		'quoted text' then --verbose sed echo test sed
+		/usr/bin then ${HOME} test -eu done "$1" printf
+	/usr/bin 'quoted text' 2>/dev/null test echo echo
+cd && cd | x=1 export grep /usr/bin $(pwd) "$1" sed awk ${HOME}
+"$@" done cd && 2>/dev/null "$@" && 'quoted text' echo done
+	cd test 2>/dev/null "$1"
+		$(pwd) -eu test | export echo sed | printf
+		done "$1" done then readonly local x=1
+	-eu cd printf --verbose grep &&
+		/usr/bin sed x=1 'quoted text' --verbose
+	--verbose done local "$@" test "$@" printf -eu cd
+test awk --verbose --verbose export
+	/usr/bin 2>/dev/null awk 2>/dev/null /usr/bin /usr/bin /usr/bin | local 'quoted text'
+		x=1 ${HOME} printf 'quoted text'
+		cd | x=1 && x=1 2>/dev/null "$@" export $(pwd) -eu printf sed
+-eu grep sed "$@" done ${HOME} ${HOME} -eu $(pwd)
+readonly ${HOME} echo test awk 'quoted text'
+	${HOME} -eu grep local sed x=1 readonly | $(pwd) grep 'quoted text'
+local echo readonly export --verbose export
+	&& x=1 'quoted text' | | | 'quoted text'
+		readonly | cd -eu "$@" awk grep x=1 ${HOME} $(pwd) printf -eu -eu /usr/bin
+		test echo test printf 'quoted text'
+	readonly done local 'quoted text' --verbose
+		-eu export awk && grep ${HOME} "$@" then ${HOME} -eu then "$1" sed &&
+		export && done sed 2>/dev/null cd readonly test
+	awk readonly test "$@" test ${HOME} /usr/bin sed cd readonly printf export
+	${HOME} "$@" "$1" 2>/dev/null cd cd echo --verbose
+"$@" cd | --verbose 2>/dev/null echo cd grep 2>/dev/null local
+	--verbose then cd export -eu --verbose test
+		grep 'quoted text' --verbose && |
+		--verbose echo sed /usr/bin printf sed -eu 2>/dev/null
+	| "$@" ${HOME} readonly done cd
+	local "$1" --verbose $(pwd) echo cd && --verbose
+		'quoted text' "$@" "$1" ${HOME} "$@" awk 'quoted text' 'quoted text'
+"$@" echo awk --verbose "$1"
+	printf done printf 'quoted text' |
+	2>/dev/null /usr/bin printf "$@" cd $(pwd) export
+	$(pwd) | then -eu 'quoted text' printf | local then
+	--verbose && -eu /usr/bin readonly printf x=1 grep 2>/dev/null
+readonly printf --verbose printf done ${HOME} cd then cd $(pwd) cd |
+	grep $(pwd) 2>/dev/null 2>/dev/null
+		/usr/bin $(pwd) sed 'quoted text'
+		$(pwd) -eu && "$1" /usr/bin echo $(pwd) -eu printf --verbose "$1"
+readonly printf done cd printf echo --verbose
+	&& x=1 export test readonly | x=1 awk done sed $(pwd) done
+	grep awk then then x=1 2>/dev/null local
+	printf test export then printf
+	2>/dev/null awk grep $(pwd) 'quoted text'
+	sed x=1 "$@" | | echo "$@" done readonly
+	"$1" export | readonly printf --verbose echo readonly sed
+	then echo test test local awk
+	"$@" $(pwd) grep done sed test "$@"
+${HOME} $(pwd) "$1" local sed "$@" then 'quoted text' done readonly
+x=1 then cd cd done export | "$@" local x=1 cd &&
+		printf ${HOME} readonly 'quoted text'
+"$@" echo awk 2>/dev/null
+		--verbose echo done $(pwd) done
+	x=1 $(pwd) --verbose /usr/bin then x=1 -eu grep 'quoted text' ${HOME} cd local
+${HOME} "$@" then ${HOME} "$@"
+	/usr/bin export echo local "$@" ${HOME} $(pwd) $(pwd) 2>/dev/null
+	'quoted text' -eu /usr/bin readonly
+		x=1 test 'quoted text' readonly $(pwd)
+	-eu | /usr/bin "$1" cd 2>/dev/null
+	-eu 'quoted text' local | | "$@" -eu grep ${HOME} export
+		/usr/bin then grep x=1 'quoted text' ${HOME} --verbose -eu && local | done then
+test printf && "$1" 'quoted text' $(pwd) sed export && 2>/dev/null x=1 | &&
+'quoted text' done "$1" $(pwd) ${HOME} then && "$@" -eu -eu
+${HOME} grep export then 2>/dev/null && --verbose grep grep x=1 cd
+		cd /usr/bin then 2>/dev/null done echo | grep /usr/bin echo -eu
+		awk printf printf /usr/bin readonly sed readonly printf echo echo printf grep
+		done ${HOME} /usr/bin test local "$1" local && 2>/dev/null
+	grep cd then 'quoted text' export local "$@" local -eu grep awk
+'quoted text' && x=1 test x=1 echo then local 2>/dev/null
+echo export --verbose /usr/bin readonly readonly sed echo done echo then
+		sed "$@" printf local printf
+		echo cd | awk echo x=1 then local done 'quoted text' -eu 'quoted text' awk local
+local ${HOME} "$@" | -eu then x=1 grep |
+$(pwd) printf export ${HOME} "$1" ${HOME}
+echo && 2>/dev/null x=1 cd x=1
+	&& x=1 && readonly printf readonly &&
+	then /usr/bin 2>/dev/null ${HOME} x=1 "$@" && 2>/dev/null then
+x=1 sed && && ${HOME} "$@" readonly
+		printf $(pwd) | && export &&
+export test cd && x=1 cd -eu ${HOME} "$1"
+		'quoted text' export grep && 2>/dev/null test awk
+	/usr/bin ${HOME} /usr/bin cd --verbose export -eu | 2>/dev/null
+	2>/dev/null awk done done && | printf && sed export done "$@" --verbose cd
+	-eu x=1 then x=1 local "$1"
+	echo sed then -eu 2>/dev/null sed /usr/bin "$1" echo "$1"
+	"$1" "$1" /usr/bin --verbose test 2>/dev/null export --verbose
+	&& $(pwd) "$@" x=1 2>/dev/null | "$1" $(pwd) && --verbose
+	2>/dev/null && "$1" local export && echo cd $(pwd)
+	echo local echo then $(pwd) ${HOME}
+grep $(pwd) "$@" ${HOME} awk done readonly
+	cd && sed 'quoted text' | printf 2>/dev/null then --verbose then
+	"$@" printf ${HOME} 'quoted text'
+		test /usr/bin awk ${HOME} ${HOME} awk then "$1" readonly readonly
+		${HOME} ${HOME} && awk -eu --verbose grep awk "$1" done /usr/bin
+		awk sed -eu grep /usr/bin grep test "$1"
+	2>/dev/null && "$1" | local
+	export echo "$1" $(pwd) $(pwd) test "$@" cd printf local cd x=1 then
+	readonly cd grep $(pwd) export then cd | -eu cd cd 'quoted text'
+		"$1" | then && x=1 echo "$1" done export ${HOME} done done
+	done awk local awk sed ${HOME} grep sed x=1 --verbose echo test $(pwd)
+		then 2>/dev/null grep done ${HOME} 'quoted text' done
+		awk ${HOME} 2>/dev/null $(pwd) readonly x=1 cd | --verbose
+grep 'quoted text' --verbose 'quoted text' local done awk $(pwd) --verbose
+		| "$1" "$@" /usr/bin printf "$1" /usr/bin test awk printf ${HOME} ${HOME} printf
+${HOME} "$1" awk x=1 sed ${HOME} --verbose /usr/bin sed -eu && grep | 'quoted text'
+-eu awk "$@" printf printf 2>/dev/null
+	"$@" -eu ${HOME} cd 2>/dev/null local
+	readonly --verbose test sed readonly "$1"
+-eu --verbose test /usr/bin | echo ${HOME} /usr/bin
+--verbose 2>/dev/null grep then awk printf --verbose "$@"
+printf -eu -eu then echo local --verbose -eu grep local
+${HOME} sed --verbose grep readonly
+x=1 done echo test "$@" done 2>/dev/null awk local | 'quoted text'
+		local 2>/dev/null /usr/bin local "$1"
+		export then | export then | -eu awk x=1 | 'quoted text'
+	/usr/bin test | export
+	echo awk sed sed awk 2>/dev/null | 'quoted text' then local $(pwd)
+/usr/bin grep local $(pwd) export done x=1 'quoted text' "$1" readonly
+	local --verbose --verbose | printf awk then 'quoted text' "$1" echo echo
+	awk ${HOME} readonly "$1" x=1 export printf ${HOME} x=1
+		'quoted text' ${HOME} echo && /usr/bin then "$@" --verbose sed sed printf
+	awk readonly test local readonly echo then | 2>/dev/null
+		&& cd "$@" -eu $(pwd) readonly readonly -eu done export && grep export done then
+	| cd x=1 x=1 /usr/bin local grep awk --verbose sed export done done
+	-eu 2>/dev/null awk $(pwd) grep done done --verbose 2>/dev/null
+export $(pwd) echo | --verbose | --verbose
+	readonly cd "$1" test $(pwd) done
+		'quoted text' $(pwd) -eu
+	cd -eu /usr/bin $(pwd) awk local readonly
+'quoted text' 2>/dev/null 'quoted text' 'quoted text'
+		2>/dev/null cd test -eu then echo echo cd grep | export
+-eu && $(pwd) -eu readonly printf | echo sed ${HOME} done 2>/dev/null
+export export done "$1" awk grep 2>/dev/null ${HOME}
+		$(pwd) echo ${HOME} $(pwd) $(pwd)
+$(pwd) $(pwd) readonly awk done x=1 awk awk printf -eu
+	$(pwd) --verbose local ${HOME} grep done ${HOME} "$1" 2>/dev/null cd | readonly
+		sed local x=1 ${HOME} sed ${HOME}
+	cd test -eu /usr/bin && /usr/bin "$@"
+		"$1" && awk | cd test $(pwd) x=1 printf grep -eu "$@" "$@"
+		cd "$1" echo ${HOME} grep "$1" echo "$@" sed 'quoted text' then
+		2>/dev/null echo | /usr/bin test sed cd
+	${HOME} /usr/bin cd sed ${HOME} sed then awk echo local readonly 2>/dev/null
+		-eu export --verbose | printf 2>/dev/null ${HOME} $(pwd) "$@" $(pwd) grep -eu -eu
+	awk -eu /usr/bin done "$1" done then cd readonly /usr/bin
+then sed && 'quoted text' done $(pwd) then "$1" then
+	"$@" export -eu /usr/bin cd grep -eu done $(pwd) | export | readonly --verbose
+$(pwd) echo cd $(pwd) done sed -eu --verbose --verbose awk readonly
+	x=1 local awk sed "$@" test printf
+	readonly 2>/dev/null readonly | then && done && x=1 && cd ${HOME} /usr/bin
+		--verbose -eu grep grep done 'quoted text' test sed sed echo local then /usr/bin
+	| done "$1" then printf printf local local
+export 2>/dev/null local sed
+done readonly $(pwd) ${HOME}
+	done printf printf "$@" $(pwd) cd test printf printf cd 2>/dev/null
+"$@" local local $(pwd) /usr/bin 'quoted text'
+echo export local --verbose 'quoted text' test "$@" --verbose test
+	"$1" ${HOME} awk cd done sed 'quoted text' | 2>/dev/null grep --verbose
+'quoted text' 'quoted text' grep && done export
+		--verbose sed 'quoted text' && x=1
+then /usr/bin --verbose grep local sed $(pwd) grep cd done local |
+--verbose x=1 $(pwd) echo awk $(pwd) grep test && x=1 cd $(pwd)
+	"$@" 'quoted text' done && x=1 grep done "$@" awk "$1" x=1 "$1"
+		/usr/bin awk sed then --verbose "$@"
+		"$1" -eu && then readonly --verbose cd $(pwd) printf ${HOME}
+	| /usr/bin local "$1" test $(pwd) grep | then $(pwd) echo sed local
+		echo /usr/bin sed test x=1 /usr/bin awk $(pwd) then echo /usr/bin
+grep grep 'quoted text'
+	export local 'quoted text' | "$1" printf test local "$1" | readonly grep
+		2>/dev/null then done sed then /usr/bin cd cd $(pwd) x=1 x=1 2>/dev/null ${HOME}
+		test export x=1 readonly "$@" | done
+&& && cd --verbose $(pwd) readonly
+	printf "$@" | "$@" sed sed test "$@" sed echo cd | sed "$@" "$@" then "$@" sed
+	cd /usr/bin x=1 test echo local x=1 local
+	x=1 && done local && test &&
+		'quoted text' 2>/dev/null export done printf cd grep && sed
+--verbose local local x=1 2>/dev/null
+cd x=1 -eu sed x=1 | cd done -eu x=1 'quoted text' awk 2>/dev/null $(pwd)
+		x=1 "$1" echo "$@" readonly $(pwd) local 2>/dev/null cd 2>/dev/null
+		$(pwd) | test printf | echo /usr/bin readonly
+		printf --verbose readonly 'quoted text' test export /usr/bin 'quoted text' 2>/dev/null
+x=1 && then "$@" "$1" cd
+	export /usr/bin --verbose awk test echo --verbose then && sed && printf
+awk "$1" --verbose cd "$@" cd x=1 "$1" export
+test readonly awk local local ${HOME}
+	/usr/bin x=1 "$@" sed 'quoted text' "$1" printf echo "$@" -eu
+grep "$1" export && readonly awk 2>/dev/null
+		2>/dev/null -eu sed "$1"
+		/usr/bin x=1 then export $(pwd)
+	then echo test test ${HOME} echo export -eu echo "$1" awk
+	then -eu done sed sed done grep -eu echo cd test | export
+then grep awk done export | 'quoted text' then "$1" export cd && | "$@"
+test ${HOME} local x=1 test test x=1 --verbose awk export "$1" done
+	"$1" cd && -eu /usr/bin && "$1"
+		sed echo then grep echo done /usr/bin export 2>/dev/null awk /usr/bin && "$1" export
+		"$1" grep /usr/bin done grep export local then
+test done --verbose -eu && "$1" local /usr/bin printf
+	${HOME} sed readonly $(pwd) "$1" grep --verbose printf
+cd --verbose | "$@" export sed sed awk "$1"
+$(pwd) sed local export && local grep "$@" cd 2>/dev/null
+		/usr/bin -eu printf "$1" grep test
+export echo grep echo "$@" x=1 /usr/bin
+		"$1" ${HOME} 'quoted text'
+		readonly --verbose echo readonly --verbose printf echo
+		"$1" && "$@" local -eu readonly
+--verbose awk ${HOME} grep sed 'quoted text' 2>/dev/null 'quoted text' -eu local
+		readonly echo --verbose printf x=1 awk sed printf x=1
+	${HOME} printf test -eu | 2>/dev/null | printf && done
+test sed local --verbose test then test readonly
+	done test export x=1 test -eu awk grep echo x=1 | done && 'quoted text' done cd
+		echo readonly | export test
+		done readonly awk "$@" "$1" export && --verbose
+test /usr/bin test "$1" --verbose | printf sed grep done 2>/dev/null
+	${HOME} "$1" $(pwd) | test awk | x=1 x=1 sed 2>/dev/null | 2>/dev/null
+	awk readonly test | printf ${HOME} && then cd done
+	local local local sed 2>/dev/null -eu printf "$1" echo && cd export &&
+readonly export done --verbose awk ${HOME} --verbose
+		readonly awk echo readonly && printf -eu cd awk
+		"$1" --verbose "$@" 'quoted text' /usr/bin export "$1" cd grep done
+	readonly readonly 'quoted text' printf 2>/dev/null && local test x=1 awk local
+printf x=1 /usr/bin echo cd done sed test
+		readonly test x=1 awk test printf ${HOME} -eu "$1" /usr/bin printf
+	export ${HOME} export echo test /usr/bin
+	done local && awk $(pwd) printf --verbose "$1"
+	readonly $(pwd) export readonly done grep --verbose
+done printf && && done --verbose grep printf done
+	2>/dev/null sed printf && awk local
+		"$@" --verbose sed test && "$@"
+		sed "$@" printf local /usr/bin export /usr/bin ${HOME} | test
+		test "$@" -eu cd 2>/dev/null cd ${HOME} sed awk echo
+		awk readonly export sed -eu echo "$1" 'quoted text' $(pwd) export --verbose
+		readonly awk local export 'quoted text' export "$1" -eu --verbose
+-eu printf sed ${HOME} "$1" "$@"
+		/usr/bin awk awk x=1 local ${HOME} -eu $(pwd) cd --verbose
+	| x=1 then awk 'quoted text'
+	printf sed 'quoted text' sed local ${HOME} readonly
+grep -eu x=1 sed printf "$@" echo then sed $(pwd) test
+&& awk "$1" done sed $(pwd) test /usr/bin -eu
+		awk export then grep x=1 readonly 'quoted text' sed awk done sed /usr/bin
+		| | sed && ${HOME} readonly test sed printf echo | test "$1" readonly
+'quoted text' export 2>/dev/null "$@" printf 2>/dev/null
+/usr/bin printf $(pwd)
+		$(pwd) sed sed grep /usr/bin | readonly && printf /usr/bin
+		local done --verbose 2>/dev/null
+/usr/bin x=1 --verbose ${HOME} then sed then echo --verbose
+"$1" 'quoted text' /usr/bin --verbose
+	2>/dev/null $(pwd) "$@" "$1" -eu readonly "$@"
+'quoted text' test 'quoted text' | awk awk $(pwd) /usr/bin sed | -eu
+	test "$@" 2>/dev/null "$1" grep then echo awk x=1 sed then 2>/dev/null
+"$@" && export then export ${HOME} awk readonly $(pwd) awk awk printf 2>/dev/null
+	&& cd local /usr/bin 2>/dev/null x=1 $(pwd)
+	cd -eu local test echo grep /usr/bin awk echo printf done
+local readonly | /usr/bin export awk then && $(pwd) --verbose
+	'quoted text' grep then "$@" 2>/dev/null done && "$@" cd cd sed "$1" && readonly
+--verbose /usr/bin sed local
+	"$@" awk local -eu readonly --verbose x=1 grep x=1 sed export
+	printf awk && 2>/dev/null local | -eu "$@" readonly x=1 /usr/bin 2>/dev/null | 'quoted text'
+		readonly $(pwd) sed local cd ${HOME} echo 'quoted text'
+	-eu /usr/bin --verbose ${HOME} then then test awk export
+	"$1" 'quoted text' local 'quoted text' local
+		"$@" grep "$@" ${HOME} done cd "$1" x=1 cd x=1
+	2>/dev/null grep echo
+		/usr/bin sed | awk /usr/bin cd echo echo readonly test --verbose
+	$(pwd) --verbose cd awk test /usr/bin 2>/dev/null -eu cd --verbose
+	readonly "$1" 'quoted text' test 'quoted text' ${HOME} 'quoted text' local export
+	readonly 2>/dev/null && /usr/bin done sed x=1 --verbose -eu 2>/dev/null
+		| && ${HOME} -eu readonly -eu then --verbose
+		'quoted text' 'quoted text' awk local then
+-eu printf sed x=1 cd -eu -eu awk /usr/bin ${HOME}
+--verbose export local local done grep test echo
+	done 2>/dev/null "$1" && done local awk local | grep then then
+	&& /usr/bin --verbose && "$@" export grep
+| echo printf | && test then
+		$(pwd) $(pwd) readonly grep local awk printf
+"$@" awk export done
+	2>/dev/null 'quoted text' echo /usr/bin ${HOME} /usr/bin sed && 2>/dev/null x=1
+sed cd && /usr/bin ${HOME} then && "$1" x=1 -eu readonly --verbose test export
+| export 'quoted text'
+	then readonly readonly && cd 'quoted text' readonly sed "$@" echo 2>/dev/null
+"$@" /usr/bin x=1 ${HOME} "$@" --verbose readonly done -eu ${HOME} echo
+grep /usr/bin cd 2>/dev/null "$@" grep done ${HOME} local done 'quoted text'
+then then "$@" -eu echo "$@"
+		test && done $(pwd) echo
+		export test echo test $(pwd) export -eu then awk x=1 $(pwd) echo
+		printf x=1 cd awk 'quoted text' printf echo 2>/dev/null export 'quoted text'
+printf readonly done printf
+		cd test $(pwd) export awk sed test x=1 done "$@" ${HOME}
+	printf readonly && 2>/dev/null test $(pwd) /usr/bin done test "$@"
+| echo cd done -eu sed
+		--verbose 2>/dev/null export export
+	$(pwd) done /usr/bin
+	| test "$@" --verbose $(pwd) && cd "$1" echo && awk "$1" && "$1" x=1 grep
+	"$1" "$1" then echo awk 'quoted text' && 2>/dev/null sed $(pwd)
+		| sed ${HOME} --verbose "$1"
+		$(pwd) && local /usr/bin then && "$1" grep -eu ${HOME} |
+		&& echo then done --verbose
+	test -eu 'quoted text' $(pwd)
+		x=1 done local 2>/dev/null echo --verbose --verbose 2>/dev/null x=1
+		/usr/bin && cd cd echo "$1" printf done sed | test
+	export && grep echo --verbose
+cd && "$@" /usr/bin printf awk printf
+		2>/dev/null "$1" test
+local "$1" | local done sed
+	2>/dev/null --verbose done $(pwd) then 2>/dev/null then | cd cd
+--verbose x=1 then then | awk 2>/dev/null
+	export test sed printf /usr/bin readonly
+		"$1" | "$@" x=1 -eu then grep readonly && x=1 "$@"
+	grep readonly echo ${HOME} 'quoted text' -eu export printf
+"$1" export local | cd && readonly "$@" done then awk local readonly 2>/dev/null
+		/usr/bin readonly /usr/bin 2>/dev/null | done
+| "$1" echo /usr/bin /usr/bin done 2>/dev/null
+"$1" awk /usr/bin local local -eu sed 2>/dev/null printf sed sed done 2>/dev/null
+		x=1 printf export grep --verbose echo
+"$@" sed "$@" then printf echo grep printf 'quoted text' done cd /usr/bin
+	-eu echo x=1 done local x=1 "$@" test cd then printf
+"$@" echo x=1 local | "$@" echo /usr/bin local grep | then test 2>/dev/null
+$(pwd) awk test | ${HOME} && -eu 'quoted text' echo export "$1" test local grep
+	-eu ${HOME} echo $(pwd) cd "$1" ${HOME} 2>/dev/null 2>/dev/null $(pwd)
+		"$1" 'quoted text' x=1 -eu then x=1
+	readonly x=1 echo local "$@"
+grep "$@" 'quoted text' test local sed -eu readonly readonly 2>/dev/null
+	grep readonly cd $(pwd) | /usr/bin && export "$@" export sed export -eu printf
+-eu 'quoted text' --verbose sed awk readonly "$1" local sed awk test --verbose
+	printf awk "$1" then 2>/dev/null
+	sed cd readonly grep "$@" echo && -eu printf "$@" --verbose
+		then cd && "$1" && "$@" | printf
+		&& /usr/bin grep sed $(pwd)
+		test grep readonly 2>/dev/null --verbose awk printf "$@" |
+	'quoted text' local | local readonly done printf $(pwd)
+$(pwd) "$@" local readonly local readonly then
+		printf "$@" echo "$@" done
+| local "$@" --verbose /usr/bin test local -eu $(pwd) $(pwd) local /usr/bin cd
+"$1" printf cd readonly -eu -eu
+	grep "$@" grep echo sed cd awk awk test echo | "$@" 2>/dev/null
+$(pwd) x=1 && readonly grep local
+	$(pwd) test echo cd export echo export export /usr/bin 2>/dev/null printf &&
+		2>/dev/null "$@" test | /usr/bin printf test test
+		sed cd "$1" | awk awk ${HOME} grep /usr/bin
+sed test then export done sed then awk cd readonly x=1 echo
+	$(pwd) awk /usr/bin cd cd /usr/bin $(pwd) "$1" export printf cd
+	sed $(pwd) cd echo done 'quoted text' local readonly test awk done export
+		then local | "$1" export then test "$1" /usr/bin
+then x=1 -eu echo cd -eu
+		&& done grep done 2>/dev/null export
+-eu 2>/dev/null 2>/dev/null $(pwd) "$@"
+"$1" sed grep 'quoted text' sed x=1 $(pwd) test | "$1" ${HOME} test --verbose
+printf ${HOME} /usr/bin export ${HOME}
+	/usr/bin printf | "$@" local --verbose
+	printf && -eu grep export export --verbose ${HOME}
+		echo ${HOME} export --verbose readonly
+| readonly local test awk grep "$1" x=1 awk /usr/bin sed grep $(pwd) "$@"
+	${HOME} "$1" 'quoted text' printf sed "$@" $(pwd) 'quoted text' /usr/bin
+	printf readonly $(pwd) -eu | local -eu export then
+done then && ${HOME} then "$@" /usr/bin cd "$1" printf
+		$(pwd) --verbose awk
+	cd && test $(pwd) "$@" echo cd -eu $(pwd) && local printf
+then printf done readonly sed | x=1 cd $(pwd)
+		2>/dev/null test awk "$1" -eu x=1 /usr/bin
+&& sed awk | readonly && readonly
+		${HOME} -eu x=1 sed awk export /usr/bin &&
+		echo export | "$@" local cd 2>/dev/null
+	local -eu $(pwd) && /usr/bin
+	echo 'quoted text' && export
+	"$@" grep 'quoted text' grep --verbose awk "$@" --verbose then printf export local
+		done $(pwd) ${HOME} sed done "$1" awk -eu done 2>/dev/null 'quoted text'
+	printf ${HOME} sed 2>/dev/null && test done | $(pwd) then $(pwd)
+| "$1" "$@" local 'quoted text'
+		readonly printf cd test test cd /usr/bin
+		local | "$1" echo "$@" awk ${HOME} /usr/bin "$1" local printf x=1 done
+		sed /usr/bin cd cd $(pwd)
+	$(pwd) then --verbose
+awk export test 2>/dev/null readonly ${HOME} sed sed | awk sed echo
+	local -eu -eu cd cd sed $(pwd) "$1" 'quoted text' export $(pwd) 2>/dev/null -eu
+	export done grep x=1 x=1 sed readonly "$@" $(pwd) grep
+	--verbose sed 2>/dev/null -eu
+		2>/dev/null $(pwd) "$1" $(pwd) && x=1 ${HOME}
+		test --verbose /usr/bin "$@" export
+		&& test then /usr/bin "$1" | /usr/bin then "$1" /usr/bin awk readonly "$1"
+	local cd then done local grep export | && 2>/dev/null "$@" x=1 readonly
+&& printf test echo "$1" 'quoted text' local
+/usr/bin done | -eu ${HOME} x=1 echo printf done cd /usr/bin $(pwd) -eu export
+		$(pwd) sed -eu test export export printf 'quoted text'
+		x=1 2>/dev/null ${HOME} -eu /usr/bin test
+		/usr/bin /usr/bin printf "$1" | ${HOME}
+| echo local echo readonly readonly /usr/bin cd --verbose printf /usr/bin
+		${HOME} --verbose grep --verbose 'quoted text' /usr/bin "$@" "$1"
+x=1 local sed local -eu cd --verbose sed done echo
+cd test /usr/bin sed test echo
+		--verbose done 'quoted text' && awk export 2>/dev/null grep readonly
+cd echo awk grep $(pwd) --verbose "$1"
+	&& export export x=1 -eu export "$1" -eu done awk ${HOME} printf /usr/bin
+'quoted text' grep x=1 echo --verbose then local && | cd printf echo "$1" printf
+		--verbose "$@" awk 2>/dev/null 2>/dev/null echo
+	done 'quoted text' --verbose export grep cd --verbose
+		cd export --verbose | sed 'quoted text'
+		2>/dev/null done -eu $(pwd) $(pwd) --verbose $(pwd)
+		printf cd && echo local 'quoted text' cd export --verbose grep "$@" readonly
+done "$@" done awk export && echo grep
+echo $(pwd) echo export echo awk "$1" grep export |
+	/usr/bin 2>/dev/null 2>/dev/null x=1 printf &&
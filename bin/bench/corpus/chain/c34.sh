@@ -0,0 +1,2001 @@
+	x=1 done readonly ${HOME} done test
+	$(pwd) echo --verbose local echo "$@" export "$1" echo --verbose
+sed 2>/dev/null | 2>/dev/null ${HOME} echo awk && test -eu cd ${HOME} export
+	then ${HOME} 'quoted text' $(pwd) 2>/dev/null --verbose
+readonly awk "$1" --verbose awk && then 2>/dev/null
+test awk -eu then local printf "$1" -eu local "$@" "$1" && test echo local ${HOME}
+$(pwd) test grep printf
+		sed 'quoted text' | "$1" local "$1" cd $(pwd) | local "$1" printf then readonly
+		then 'quoted text' 'quoted text'
+	2>/dev/null --verbose | 'quoted text' $(pwd) ${HOME}
+	${HOME} "$@" 'quoted text' 2>/dev/null $(pwd) export done $(pwd) awk ${HOME}
+cd | then done local readonly
+done then $(pwd) sed --verbose echo $(pwd) "$@" cd
+		awk --verbose echo 'quoted text' $(pwd) "$@" "$@" test then awk cd grep /usr/bin
+		echo local "$1" echo then "$@"
+		x=1 x=1 test | && 2>/dev/null test cd sed 2>/dev/null
+'quoted text' && test 2>/dev/null --verbose
+	${HOME} 'quoted text' | 2>/dev/null done echo x=1 /usr/bin | grep cd grep --verbose
+$(pwd) awk local x=1 cd local local --verbose
+		$(pwd) cd ${HOME} | x=1 --verbose echo | local echo
+		x=1 echo done then sed | ${HOME} cd
+x=1 export then | echo sed x=1 "$@" awk then export readonly
+'quoted text' -eu echo printf && awk export && printf "$@" cd
+grep | --verbose -eu -eu /usr/bin cd 2>/dev/null
+sed local $(pwd) "$@"
+	cd | test done cd x=1 echo 2>/dev/null readonly awk awk /usr/bin
+		cd test sed ${HOME} $(pwd) 2>/dev/null 'quoted text'
+	echo then x=1 export cd done awk cd awk "$1"
+	printf --verbose awk $(pwd) sed $(pwd) readonly
+printf then && x=1 | done /usr/bin | grep
+	"$1" cd -eu -eu x=1 x=1 echo echo then "$@" ${HOME} printf export $(pwd) export
+	local readonly then /usr/bin then
+then --verbose x=1 done ${HOME} 'quoted text'
+then echo export done "$@" grep ${HOME} local $(pwd)
+printf x=1 readonly local printf local done echo /usr/bin
+		export x=1 2>/dev/null cd then grep export then "$1"
+	grep $(pwd) awk 2>/dev/null grep --verbose 'quoted text'
+	cd test "$1" | "$@" echo awk --verbose
+$(pwd) -eu --verbose printf "$@" ${HOME} test x=1
+&& printf -eu ${HOME} awk x=1 readonly ${HOME} grep /usr/bin
+grep done x=1 done 2>/dev/null test cd
+awk echo /usr/bin grep export local ${HOME} "$@" ${HOME}
+		awk | printf then export && local
+	readonly "$@" done -eu ${HOME} then 2>/dev/null
+"$1" x=1 readonly | x=1 sed "$@" && local ${HOME} local printf
+readonly test | --verbose
+		sed 'quoted text' echo 'quoted text'
+		test cd | then printf -eu ${HOME} --verbose export && printf done done --verbose
+"$@" done cd readonly readonly && ${HOME} sed /usr/bin 2>/dev/null
+		test x=1 x=1 cd && $(pwd) awk && "$1" sed ${HOME}
+		| 'quoted text' /usr/bin 'quoted text' "$@" test cd local 2>/dev/null cd | then
+	local printf "$1" awk sed awk --verbose awk /usr/bin "$@"
+	-eu 'quoted text' awk ${HOME} 'quoted text' test then -eu sed ${HOME}
+${HOME} x=1 ${HOME} --verbose grep readonly
+	awk then cd export --verbose readonly x=1
+		cd awk then | printf 2>/dev/null export readonly /usr/bin "$1" printf &&
+	'quoted text' then sed 2>/dev/null
+"$1" local local done
+		cd x=1 ${HOME} 'quoted text'
+/usr/bin test done readonly "$@" 'quoted text'
+test 'quoted text' done ${HOME} /usr/bin
+awk | local awk $(pwd) echo "$1" local readonly cd ${HOME} grep "$@" export
+	/usr/bin x=1 "$1" sed sed ${HOME} -eu awk "$@" local $(pwd)
+		export --verbose "$@" sed x=1 then export 2>/dev/null | echo --verbose
+awk then --verbose "$1" grep
+done -eu /usr/bin readonly -eu && --verbose
+'quoted text' readonly printf grep local "$@" done /usr/bin readonly
+	"$1" "$1" test | echo $(pwd) "$@" $(pwd) done
+		${HOME} awk --verbose x=1 -eu readonly ${HOME} sed && printf export x=1 |
+echo && test cd local test -eu then
+		export --verbose awk done test export $(pwd) x=1 2>/dev/null
+local awk awk grep | echo && done && 'quoted text' local ${HOME}
+'quoted text' then awk && "$1"
+		x=1 "$1" cd echo "$1" test $(pwd) ${HOME} local $(pwd) sed test 'quoted text'
+	$(pwd) echo $(pwd) cd /usr/bin
+		readonly ${HOME} && then
+sed 2>/dev/null "$@" done local /usr/bin readonly sed readonly
+		printf /usr/bin 'quoted text' $(pwd) /usr/bin export local printf export &&
+-eu | export -eu printf | printf test
+	grep export echo sed done done then then $(pwd) readonly
+'quoted text' cd awk test sed --verbose readonly then 'quoted text' --verbose
+/usr/bin printf grep test
+'quoted text' -eu local ${HOME} echo -eu printf grep readonly printf local
+		echo $(pwd) | /usr/bin "$1" readonly x=1 done
+		"$1" 2>/dev/null ${HOME} | printf && "$1" $(pwd) test ${HOME}
+		grep grep export | local --verbose &&
+done cd cd $(pwd) && ${HOME} done 2>/dev/null cd x=1
+	then | then grep printf grep /usr/bin
+	local printf x=1 test readonly local echo local readonly --verbose 2>/dev/null
+export "$1" -eu sed sed local x=1 then 2>/dev/null -eu printf then
+		done then $(pwd) grep sed sed -eu "$@" "$@" then 2>/dev/null
+	'quoted text' $(pwd) "$1" ${HOME} x=1 sed grep echo ${HOME} ${HOME} printf then
+	-eu --verbose export "$@" --verbose printf
+		&& awk printf -eu sed 'quoted text' x=1
+-eu awk cd 'quoted text' 2>/dev/null 'quoted text' | printf x=1
+		then cd "$1" cd 'quoted text' --verbose readonly done
+		awk && 'quoted text' printf $(pwd) && -eu | readonly
+	done then cd done test --verbose $(pwd) grep | x=1 ${HOME} done | then echo local
+${HOME} ${HOME} readonly
+-eu && sed export done 2>/dev/null -eu readonly "$1" --verbose readonly
+		$(pwd) ${HOME} sed then echo | local 2>/dev/null sed
+printf "$@" --verbose /usr/bin /usr/bin sed x=1 $(pwd) $(pwd) --verbose
+	export /usr/bin grep grep local -eu export 2>/dev/null x=1 "$@" &&
+"$@" sed /usr/bin && $(pwd) 'quoted text' 'quoted text'
+then x=1 $(pwd) 'quoted text' readonly /usr/bin local awk local
+		&& readonly grep 'quoted text' x=1 &&
+	x=1 "$@" readonly grep awk 2>/dev/null --verbose $(pwd) then && then
+export | -eu x=1 local local awk | cd then echo test x=1 $(pwd) 'quoted text'
+	'quoted text' x=1 --verbose 2>/dev/null local
+	/usr/bin printf printf readonly export $(pwd) echo "$1" $(pwd)
+	$(pwd) 2>/dev/null done x=1 'quoted text' $(pwd) 2>/dev/null && x=1
+	sed printf printf test export
+local "$@" cd $(pwd) 2>/dev/null printf cd x=1 export export
+	then cd export export grep && then --verbose readonly /usr/bin
+	grep readonly local /usr/bin
+		grep then local done && grep grep 'quoted text' 2>/dev/null /usr/bin "$1"
+	grep -eu readonly cd echo 2>/dev/null
+		--verbose awk 2>/dev/null then test 2>/dev/null
+	local /usr/bin grep "$1" --verbose printf 2>/dev/null export
+$(pwd) -eu $(pwd) $(pwd)
+${HOME} -eu "$@" readonly $(pwd) 2>/dev/null then printf sed "$@" ${HOME} sed
+		grep "$@" "$@" echo done readonly
+		readonly echo $(pwd) cd x=1 && then grep export
+'quoted text' local "$@"
+"$@" x=1 grep echo /usr/bin
+sed x=1 done "$1" x=1 "$@" /usr/bin -eu $(pwd) awk | "$1" grep $(pwd) "$@" then
+	awk "$@" "$1" grep then test test grep test echo printf -eu cd
+test echo 'quoted text' | --verbose local /usr/bin readonly awk "$1" cd
+	&& sed local --verbose ${HOME} echo then cd done -eu
+		export then "$@" x=1 done x=1 | readonly done -eu sed /usr/bin echo readonly
+	awk -eu 'quoted text' --verbose echo | x=1 done x=1 printf | --verbose export
+		done $(pwd) awk then 'quoted text' test "$@" readonly
+${HOME} awk done then --verbose 2>/dev/null printf
+then --verbose readonly x=1 sed readonly x=1 local done grep grep -eu $(pwd) /usr/bin
+printf "$@" sed printf x=1 && then --verbose then --verbose
+2>/dev/null readonly /usr/bin x=1
+echo echo -eu /usr/bin x=1 done grep 'quoted text' 2>/dev/null
+	then $(pwd) /usr/bin test ${HOME} sed $(pwd) local test grep sed
+x=1 then && then ${HOME} awk printf readonly awk
+	&& | test printf readonly -eu then cd /usr/bin "$@" echo -eu test test local then
+		local ${HOME} sed sed test cd 2>/dev/null && readonly --verbose --verbose
+		/usr/bin grep echo ${HOME}
+		'quoted text' "$1" cd printf "$1" test test ${HOME} done export /usr/bin
+test grep --verbose $(pwd) "$@" "$1"
+"$@" grep cd -eu awk then then $(pwd) x=1 2>/dev/null | awk local --verbose
+	$(pwd) "$@" ${HOME} ${HOME} "$@"
+${HOME} x=1 "$@" then awk test x=1 export
+$(pwd) export readonly cd printf cd awk printf ${HOME} printf cd awk && test
+cd /usr/bin local local | done "$1" --verbose cd "$@" && -eu "$1" readonly
+		"$1" test -eu test x=1 ${HOME} && cd ${HOME} "$@"
+"$1" x=1 grep 'quoted text' echo $(pwd) ${HOME} | local x=1 --verbose /usr/bin readonly
+	readonly local sed grep echo -eu --verbose ${HOME} && done
+		sed "$1" awk -eu awk cd | awk 'quoted text' ${HOME}
+	awk ${HOME} printf "$1" "$1" $(pwd) done 'quoted text' -eu /usr/bin
+		$(pwd) echo then $(pwd) export &&
+	cd awk /usr/bin 2>/dev/null printf awk awk local done 2>/dev/null
+	&& -eu "$1" cd x=1 readonly 2>/dev/null readonly "$1" then && --verbose ${HOME}
+		grep sed awk echo ${HOME} "$1" then /usr/bin grep --verbose "$@" test 'quoted text'
+		awk awk sed local printf $(pwd) | 2>/dev/null then /usr/bin
+		awk | grep | ${HOME} "$1" /usr/bin done "$1" "$1" test "$1" printf
+		"$1" | "$1" printf then grep cd echo && readonly grep
+--verbose x=1 done && grep awk done export echo 'quoted text'
+then grep awk /usr/bin "$1" export echo awk 'quoted text' done -eu | awk printf
+		"$@" ${HOME} done 2>/dev/null readonly printf x=1 $(pwd) && "$@" then export "$@"
+	| "$1" x=1 | export test --verbose ${HOME} 2>/dev/null sed
+printf local && done "$1" | export printf test done x=1 /usr/bin
+		awk grep test printf "$1" sed printf --verbose awk export printf
+	"$@" cd "$1" awk $(pwd) /usr/bin echo /usr/bin "$@" $(pwd) sed printf sed
+readonly local grep done grep echo then echo test awk && printf
+	&& local ${HOME} done sed "$@" cd --verbose echo /usr/bin readonly 'quoted text'
+2>/dev/null 2>/dev/null then 'quoted text'
+		2>/dev/null cd grep grep "$1" printf "$@" local awk
+	printf $(pwd) sed | &&
+x=1 "$@" x=1 echo | ${HOME} grep awk cd export
+		${HOME} local $(pwd) | --verbose "$@" local grep -eu sed echo /usr/bin && "$@" local
+		'quoted text' export then export /usr/bin ${HOME} done
+export test printf && export "$@" && local /usr/bin
+$(pwd) | $(pwd) -eu export --verbose
+		then 2>/dev/null $(pwd) readonly
+		'quoted text' done 2>/dev/null ${HOME}
+		local ${HOME} -eu $(pwd) 2>/dev/null /usr/bin && done grep 2>/dev/null
+		/usr/bin readonly ${HOME}
+	export "$@" then /usr/bin then /usr/bin -eu $(pwd) sed
+$(pwd) done printf "$1" "$@"
+awk export done 'quoted text' /usr/bin ${HOME} 'quoted text' printf x=1 grep
+	${HOME} /usr/bin local done readonly awk $(pwd) 'quoted text'
+&& -eu -eu 2>/dev/null test 'quoted text' /usr/bin
+		| awk readonly readonly awk echo done printf
+		2>/dev/null "$@" x=1 'quoted text' --verbose
+		done ${HOME} awk grep && cd echo x=1 ${HOME} printf
+		readonly awk ${HOME} export
+	local /usr/bin ${HOME} done cd -eu test cd done && "$1" 'quoted text'
+then $(pwd) $(pwd) grep | done $(pwd) cd | grep "$@" sed "$@" export sed &&
+"$1" "$1" 2>/dev/null cd "$1" echo "$1" 'quoted text' | echo
+	-eu 2>/dev/null "$1" $(pwd) readonly 'quoted text'
+	local 'quoted text' sed 'quoted text'
+		grep 2>/dev/null | echo && sed cd -eu
+	grep "$@" done 2>/dev/null && /usr/bin done 'quoted text' -eu "$@"
+		local local local cd && | ${HOME} 'quoted text'
+		x=1 sed $(pwd) && x=1 | test awk ${HOME} then
+| grep sed printf done grep $(pwd) 'quoted text'
+		x=1 printf then 2>/dev/null printf sed "$@" && x=1 'quoted text'
+	readonly 2>/dev/null $(pwd) && /usr/bin local
+cd $(pwd) grep echo "$@"
+		cd -eu cd 2>/dev/null awk | done sed 2>/dev/null --verbose x=1
+		done && then x=1 'quoted text' "$1" | echo ${HOME} grep x=1 readonly export -eu
+export cd && | echo grep printf readonly
+'quoted text' grep "$1" | x=1 grep readonly test --verbose
+$(pwd) x=1 cd done | test | cd local "$@" /usr/bin 'quoted text'
+		cd "$1" readonly test | &&
+		${HOME} x=1 2>/dev/null $(pwd) "$@" "$@" "$@" --verbose 'quoted text' 'quoted text'
+		sed "$1" printf echo
+		"$@" then x=1 /usr/bin grep export test
+		"$@" test export cd export 2>/dev/null
+test x=1 cd "$1" "$1" -eu echo $(pwd) cd export local ${HOME} $(pwd) $(pwd)
+awk | -eu printf | cd then $(pwd) | 'quoted text' awk sed "$@" grep then
+grep grep awk "$@" ${HOME} && --verbose x=1 echo then grep --verbose done readonly
+	${HOME} x=1 done $(pwd) grep
+local printf "$@" awk local "$1"
+&& -eu test test $(pwd) | readonly export done $(pwd)
+	grep done awk 'quoted text' done done /usr/bin ${HOME} grep done 'quoted text'
+	"$1" $(pwd) sed printf ${HOME}
+	printf x=1 export 2>/dev/null readonly test 2>/dev/null readonly -eu
+	export awk | "$@" cd ${HOME} sed -eu readonly $(pwd) then
+	'quoted text' $(pwd) 2>/dev/null
+		"$1" export export done 'quoted text'
+sed test --verbose /usr/bin --verbose
+done sed "$1" x=1 awk
+	-eu ${HOME} | && test local then grep $(pwd) export grep grep -eu | /usr/bin sed
+	local readonly $(pwd) x=1
+		sed cd x=1 2>/dev/null &&
+	export /usr/bin cd x=1 ${HOME} export sed grep sed 'quoted text'
+	"$@" local cd test readonly
+	--verbose readonly $(pwd) -eu "$@" -eu echo awk
+| readonly 2>/dev/null x=1 then test grep $(pwd) grep && 2>/dev/null
+	| readonly printf test ${HOME} | "$@" printf
+	"$@" | test $(pwd) "$1" "$@" | cd export awk local ${HOME}
+		done -eu grep echo | 'quoted text' cd then sed
+		grep cd cd && sed export readonly grep then 2>/dev/null ${HOME} $(pwd)
+		2>/dev/null local 2>/dev/null sed local readonly &&
+cd test readonly readonly x=1 /usr/bin | cd ${HOME} "$@" grep local export
+${HOME} awk cd 'quoted text' cd ${HOME} /usr/bin cd $(pwd) echo cd
+readonly | 'quoted text' done --verbose test grep done grep readonly printf readonly
+		export /usr/bin ${HOME} 'quoted text'
+		-eu | printf -eu awk /usr/bin sed /usr/bin
+	${HOME} cd echo -eu echo ${HOME}
+		'quoted text' 'quoted text'
+	printf | printf printf x=1 --verbose
+	2>/dev/null ${HOME} grep
+		echo x=1 /usr/bin local $(pwd) && "$1" awk
+/usr/bin --verbose grep "$1" done "$@" x=1 -eu "$1" | /usr/bin /usr/bin
+	&& /usr/bin -eu sed --verbose /usr/bin --verbose "$1" cd | cd
+cd -eu readonly 2>/dev/null
+		&& && | 'quoted text' then "$1" $(pwd) && --verbose
+2>/dev/null echo ${HOME} ${HOME}
+		"$@" && test "$1" local printf done awk x=1
+		x=1 2>/dev/null then ${HOME} sed cd && $(pwd)
+		then $(pwd) done echo grep
+'quoted text' -eu then grep readonly --verbose done && echo
+	'quoted text' sed export echo 2>/dev/null grep 2>/dev/null ${HOME} echo "$@"
+		printf export /usr/bin export readonly then printf then echo printf
+		"$@" ${HOME} && -eu readonly 'quoted text' /usr/bin
+		awk done export /usr/bin test "$@" "$@" "$@" | | -eu -eu done grep --verbose
+		-eu grep $(pwd) | --verbose
+grep 'quoted text' done grep "$@" ${HOME} echo /usr/bin
+	2>/dev/null awk test echo local export /usr/bin
+	2>/dev/null | grep grep local done --verbose
+		| echo "$@" $(pwd) export export export 2>/dev/null done /usr/bin 2>/dev/null
+	then "$@" cd sed grep x=1 test echo readonly "$1" local "$@" ${HOME} export
+	-eu $(pwd) cd readonly local $(pwd) /usr/bin -eu readonly ${HOME} ${HOME} |
+"$1" x=1 2>/dev/null sed grep echo awk --verbose
+	local then "$1" $(pwd) local $(pwd) && ${HOME} 2>/dev/null -eu && | done export
+	done done "$1" readonly -eu
+	echo test grep x=1 grep grep 'quoted text'
+		/usr/bin | local | test -eu done sed sed
+readonly "$1" cd 'quoted text' cd --verbose export export && grep cd 'quoted text'
+	done x=1 done "$@" -eu done $(pwd) -eu && echo ${HOME} printf local && $(pwd)
+		echo export printf $(pwd) local --verbose /usr/bin sed /usr/bin
+done $(pwd) test then -eu grep -eu && readonly -eu ${HOME} /usr/bin
+	/usr/bin export $(pwd) readonly --verbose done -eu readonly
+	| then --verbose | cd export readonly
+local ${HOME} && --verbose --verbose &&
+--verbose printf done "$@" export
+readonly then export done "$1" cd sed 2>/dev/null sed 2>/dev/null
+	2>/dev/null $(pwd) -eu done cd cd readonly grep $(pwd)
+		--verbose then x=1 $(pwd) ${HOME} grep done export x=1 sed grep grep 2>/dev/null
+		-eu ${HOME} x=1 echo awk awk cd done | echo echo
+	--verbose awk -eu && x=1 sed cd grep $(pwd) /usr/bin
+2>/dev/null --verbose 'quoted text'
+	local x=1 grep readonly echo 2>/dev/null -eu | -eu -eu
+	2>/dev/null awk cd -eu 'quoted text' awk "$@" "$1" --verbose then
+	/usr/bin export /usr/bin 2>/dev/null --verbose done --verbose local
+		then /usr/bin "$@" 2>/dev/null x=1 $(pwd) ${HOME}
+test "$1" export readonly readonly
+		| printf grep awk printf ${HOME} done ${HOME} test -eu 'quoted text'
+printf export readonly --verbose
+		--verbose test && test echo echo 2>/dev/null --verbose test test export
+		done --verbose --verbose "$@" x=1 "$@" "$1" "$@" -eu test --verbose x=1 local
+--verbose echo ${HOME} $(pwd) done $(pwd) done 2>/dev/null "$1"
+		readonly 2>/dev/null grep /usr/bin echo
+		local export local "$@" done /usr/bin export
+	awk | x=1 'quoted text' grep x=1 cd grep ${HOME} && && 2>/dev/null
+		"$@" x=1 "$1" awk awk printf awk | echo ${HOME} ${HOME} export &&
+		then export sed /usr/bin grep ${HOME} done ${HOME} printf then sed export
+		awk sed -eu grep | x=1 grep 2>/dev/null | printf x=1 x=1 "$@" done
+	| readonly awk 'quoted text' awk && echo
+		| | cd -eu printf x=1 local 2>/dev/null grep
+		"$1" $(pwd) "$1" 2>/dev/null
+&& --verbose grep test awk test --verbose 2>/dev/null echo
+	2>/dev/null "$@" grep 2>/dev/null
+local done export | --verbose echo "$@" grep $(pwd)
+--verbose export test x=1 --verbose test
+		| sed 2>/dev/null sed echo $(pwd) "$1" | | grep test done
+		awk 'quoted text' export --verbose
+	echo | -eu 'quoted text' done &&
+/usr/bin test echo /usr/bin done
+	sed readonly $(pwd) sed 2>/dev/null --verbose
+	test test -eu --verbose
+		awk then "$@" export awk "$@" && test --verbose
+grep $(pwd) 'quoted text' | awk x=1 then printf done local export -eu test
+	&& awk $(pwd) readonly then --verbose
+	"$@" -eu $(pwd) awk 2>/dev/null printf test printf awk
+		test sed --verbose "$1" done 2>/dev/null export export grep test "$@" && /usr/bin
+	2>/dev/null cd $(pwd) /usr/bin --verbose export
+		--verbose "$@" export test
+	echo -eu grep local $(pwd) printf 'quoted text' readonly 'quoted text'
+	test | local 2>/dev/null cd "$@" then test | printf echo done --verbose
+awk --verbose --verbose cd 'quoted text' export
+| export "$@" awk export sed "$@" "$@" 'quoted text' "$@"
+awk local grep /usr/bin awk echo
+sed test readonly grep printf /usr/bin x=1 echo awk "$1"
+local test --verbose | -eu 'quoted text' sed readonly local 2>/dev/null
+		--verbose ${HOME} printf readonly export cd -eu ${HOME} awk echo local
+	sed local readonly local --verbose
+	then cd "$@" /usr/bin x=1 readonly printf awk
+	--verbose readonly /usr/bin grep grep 'quoted text' test local sed printf $(pwd)
+	then | local $(pwd) /usr/bin 'quoted text' 2>/dev/null cd
+cd --verbose 2>/dev/null readonly done
+&& "$@" && "$1" sed 'quoted text' "$@" 'quoted text' | cd awk
+		then then 2>/dev/null echo
+	| && 'quoted text' local export
+	'quoted text' test "$1" local
+cd test printf done x=1 --verbose local x=1 && export local sed ${HOME} $(pwd)
+&& readonly sed --verbose
+		-eu ${HOME} --verbose local | | "$1" echo echo awk
+		then done readonly local printf sed x=1 then 'quoted text' && printf /usr/bin
+then grep | ${HOME} /usr/bin
+	test "$@" $(pwd) then printf 'quoted text' --verbose grep done awk && cd ${HOME}
+x=1 $(pwd) grep sed 'quoted text' /usr/bin readonly local test echo x=1 export
+cd x=1 | awk | echo printf test /usr/bin grep "$@" done $(pwd) -eu test
+	"$1" && $(pwd) --verbose ${HOME} then
+		printf grep "$1" "$@" export --verbose "$@" /usr/bin
+		--verbose done export && "$@" /usr/bin awk readonly
+'quoted text' "$1" export |
+"$1" 'quoted text' x=1 && /usr/bin
+		grep | echo grep --verbose test grep printf
+done 'quoted text' readonly grep $(pwd) /usr/bin /usr/bin $(pwd) "$@"
+${HOME} printf grep readonly local
+	2>/dev/null printf "$1" echo | $(pwd) readonly
+	printf x=1 && --verbose 'quoted text'
+	done $(pwd) -eu /usr/bin done export 'quoted text' done local ${HOME} | /usr/bin
+2>/dev/null x=1 'quoted text' "$@" done
+	&& x=1 awk sed echo then
+		then done printf grep then ${HOME} done -eu then echo
+		/usr/bin grep grep echo printf local && -eu "$1" sed
+'quoted text' 'quoted text'
+		cd x=1 "$1" 2>/dev/null $(pwd) 'quoted text'
+		-eu && $(pwd) /usr/bin printf
+	| --verbose | then $(pwd) local then 'quoted text' echo ${HOME}
+	test printf cd then ${HOME} done test sed
+		'quoted text' 'quoted text' --verbose -eu $(pwd)
+	/usr/bin 'quoted text' "$@" 2>/dev/null "$1" grep && local done sed
+		then awk test printf done "$@" cd printf grep readonly "$@"
+local 2>/dev/null $(pwd) x=1 awk then
+	then then readonly echo && done echo && local export ${HOME}
+	printf -eu cd -eu awk "$1" "$1" "$@" test readonly ${HOME} 2>/dev/null
+sed "$@" --verbose readonly
+2>/dev/null echo "$1" -eu ${HOME}
+	awk local /usr/bin -eu $(pwd) x=1 'quoted text' sed then
+	readonly && --verbose test 2>/dev/null echo awk --verbose sed test
+		$(pwd) --verbose local x=1 | "$@" then "$@" | "$1" readonly
+sed then x=1 sed --verbose printf -eu 'quoted text' $(pwd)
+/usr/bin 'quoted text' "$@" export grep sed -eu readonly export
+	done readonly echo sed | x=1 /usr/bin test /usr/bin $(pwd)
+		${HOME} export echo /usr/bin test --verbose 2>/dev/null echo sed cd x=1
+	printf 'quoted text' ${HOME} test printf local printf "$@" grep grep
+	export 'quoted text' printf "$@" printf $(pwd) awk
+		grep cd awk 'quoted text' 2>/dev/null
+	2>/dev/null printf && then printf && local
+		"$1" export cd | grep | echo cd 2>/dev/null local cd cd test readonly
+		test -eu && grep cd /usr/bin awk /usr/bin done test -eu readonly
+	2>/dev/null /usr/bin readonly
+		'quoted text' awk --verbose printf
+| sed grep -eu ${HOME} printf
+"$1" $(pwd) done -eu x=1 awk ${HOME} export --verbose then export cd local
+		${HOME} "$@" awk 'quoted text' then $(pwd)
+	export $(pwd) readonly --verbose x=1
+		2>/dev/null "$1" printf $(pwd)
+/usr/bin 2>/dev/null ${HOME} "$@" -eu $(pwd) cd | local
+		| awk | && | local grep local x=1 /usr/bin grep readonly "$@" printf export
+	export 2>/dev/null cd /usr/bin ${HOME} done -eu
+		done $(pwd) -eu /usr/bin echo sed "$1" done printf awk 2>/dev/null sed done
+	--verbose && export "$@"
+	done readonly | x=1 --verbose done readonly ${HOME} grep "$@" awk then ${HOME}
+		$(pwd) local then sed test ${HOME} $(pwd) /usr/bin | /usr/bin sed echo
+	then then readonly /usr/bin export local 2>/dev/null
+		2>/dev/null "$1" sed "$@" echo x=1
+	"$@" echo 2>/dev/null echo readonly cd printf x=1 cd grep
+		done awk export readonly export x=1 printf grep test ${HOME} 'quoted text'
+	$(pwd) 'quoted text' --verbose
+local readonly awk 'quoted text' && printf --verbose done
+		--verbose sed sed readonly local ${HOME} 'quoted text' ${HOME} export | test cd
+	"$1" echo test grep local awk $(pwd) echo
+local local echo readonly export sed readonly sed x=1 ${HOME} local test 'quoted text'
+sed printf readonly test export /usr/bin test echo awk -eu
+	sed ${HOME} sed ${HOME} printf && "$@" grep printf | $(pwd) sed "$@" test
+		"$@" awk 2>/dev/null "$@" printf sed done then -eu grep export
+${HOME} done sed sed echo /usr/bin local cd -eu local -eu
+test -eu echo printf grep | /usr/bin $(pwd) && ${HOME}
+x=1 readonly /usr/bin 2>/dev/null x=1 "$1" done | test "$@"
+$(pwd) local readonly awk export "$@" /usr/bin export "$1" x=1 /usr/bin --verbose
+	2>/dev/null 'quoted text' -eu then --verbose printf
+'quoted text' 2>/dev/null ${HOME} "$@" echo local "$1"
+		grep printf ${HOME} cd --verbose export -eu
+	export test then readonly then ${HOME} ${HOME} 2>/dev/null local ${HOME}
+'quoted text' --verbose && echo -eu cd "$1"
+	echo grep readonly local readonly
+"$@" 2>/dev/null 'quoted text' 'quoted text' test done
+"$@" $(pwd) awk $(pwd) --verbose test $(pwd) /usr/bin
+sed && "$@" export done 2>/dev/null
+$(pwd) local 2>/dev/null ${HOME} "$@" | "$@" x=1
+		test -eu sed then done sed export local ${HOME} awk echo
+2>/dev/null printf printf readonly -eu export /usr/bin --verbose ${HOME}
+		cd done local test echo
+		--verbose grep ${HOME} --verbose 'quoted text' grep
+	test sed local export -eu && awk "$1" "$@" ${HOME} export then 'quoted text' local
+local "$@" then done $(pwd) 2>/dev/null x=1 export grep && grep local awk "$1"
+readonly done then export $(pwd)
+	then test cd 2>/dev/null x=1 grep -eu x=1 grep
+"$@" | "$1" sed awk 'quoted text' sed done x=1 'quoted text'
+readonly --verbose $(pwd) readonly then "$1"
+	x=1 --verbose then 'quoted text'
+		--verbose then export cd done 2>/dev/null $(pwd) 2>/dev/null grep "$1"
+"$1" && ${HOME} -eu local printf "$@" done /usr/bin
+		"$1" test "$@" | test done x=1 "$1" 'quoted text'
+		readonly 2>/dev/null && /usr/bin
+cd "$@" awk "$@" echo /usr/bin 'quoted text' sed -eu -eu | 2>/dev/null
+		"$@" sed echo x=1 "$@" echo "$@" && then && awk
+		/usr/bin awk $(pwd) "$1" readonly 2>/dev/null x=1 export 'quoted text' echo grep
+	"$1" -eu $(pwd) 'quoted text' local | $(pwd) readonly /usr/bin printf
+	printf local | 2>/dev/null grep -eu readonly
+	local test echo ${HOME} awk /usr/bin /usr/bin then grep printf
+	sed export ${HOME} --verbose grep printf "$@" sed printf printf x=1
+	cd printf "$@" awk echo done "$1" ${HOME} awk "$@" 2>/dev/null
+	x=1 | --verbose 2>/dev/null | 'quoted text' echo
+${HOME} 2>/dev/null "$1" then "$@" "$1" test && grep | $(pwd) 'quoted text'
+| awk export -eu -eu then /usr/bin cd
+2>/dev/null $(pwd) 2>/dev/null ${HOME}
+	done x=1 ${HOME} awk | 'quoted text'
+	'quoted text' awk cd 2>/dev/null
+/usr/bin done && printf local test "$@" local done
+	export grep 2>/dev/null printf readonly
+2>/dev/null export cd
+echo done cd test grep awk grep sed x=1 test then printf && 'quoted text'
+export "$@" | ${HOME} 'quoted text'
+	"$@" printf && $(pwd) 'quoted text' grep done test x=1 cd local cd
+		printf cd done --verbose "$1"
+		x=1 x=1 -eu 2>/dev/null grep "$@" awk /usr/bin printf test
+&& | | readonly x=1 'quoted text' test /usr/bin
+	--verbose "$@" $(pwd) local done "$@" test cd $(pwd) readonly
+	"$1" local awk ${HOME} sed awk done | readonly local $(pwd) "$1" done local --verbose
+test "$1" awk "$1" cd test -eu 'quoted text' then && awk $(pwd) printf
+		grep test sed printf ${HOME}
+		then grep printf 2>/dev/null done 2>/dev/null --verbose 2>/dev/null | local readonly
+		grep cd printf /usr/bin cd -eu awk echo local then --verbose
+--verbose 'quoted text' x=1 awk /usr/bin --verbose done && awk "$1"
+	grep --verbose "$1" echo cd awk ${HOME} -eu done export grep && &&
+		awk "$@" | export -eu 2>/dev/null ${HOME} $(pwd) x=1 "$@" && readonly
+		"$1" cd ${HOME} printf printf echo done then --verbose printf
+	"$@" 2>/dev/null done echo local readonly awk &&
+grep done "$1" then printf sed --verbose cd x=1
+export echo --verbose /usr/bin "$@" "$1" | && $(pwd)
+-eu grep echo local ${HOME} 2>/dev/null local $(pwd)
+	test 2>/dev/null awk then local "$@" 'quoted text'
+/usr/bin export then x=1 awk sed /usr/bin && --verbose "$1" | &&
+		sed "$@" sed local 'quoted text' done printf
+	sed echo readonly echo export done export done sed x=1 export | x=1 export
+"$@" awk grep x=1 then awk /usr/bin readonly readonly
+$(pwd) readonly then sed --verbose cd echo printf /usr/bin cd local $(pwd)
+		'quoted text' && $(pwd) export then sed ${HOME}
+"$@" readonly then "$@" printf then then
+then "$@" cd x=1 2>/dev/null
+	test sed awk $(pwd) grep then "$1" && grep
+"$1" grep test awk test 2>/dev/null ${HOME}
+		-eu echo --verbose echo cd /usr/bin then export
+	'quoted text' awk printf "$@" && /usr/bin x=1 printf $(pwd) "$1"
+cd 2>/dev/null awk then cd 'quoted text' 'quoted text' sed $(pwd) ${HOME} $(pwd)
+		cd "$1" /usr/bin 'quoted text' printf x=1 printf grep
+	export echo ${HOME} printf export done x=1 echo
+	export 'quoted text' echo export | | x=1 | done -eu
+	--verbose -eu --verbose 2>/dev/null local done sed local | /usr/bin 2>/dev/null
+	'quoted text' echo ${HOME} printf
+	cd sed && echo "$@" echo 2>/dev/null "$@" $(pwd)
+		/usr/bin test awk 2>/dev/null 'quoted text'
+cd x=1 && readonly 'quoted text' sed
+		sed -eu readonly 2>/dev/null awk -eu echo then readonly -eu 'quoted text' echo awk
+awk /usr/bin awk readonly --verbose | 'quoted text'
+		/usr/bin /usr/bin then then cd "$@" echo
+		"$@" --verbose then test "$@" 'quoted text' && awk echo && grep
+		2>/dev/null /usr/bin sed readonly echo $(pwd)
+	grep | local --verbose export x=1 export cd ${HOME} echo readonly cd
+		done printf /usr/bin ${HOME} x=1 sed local
+		| /usr/bin readonly then then cd $(pwd) /usr/bin sed
+		awk /usr/bin | $(pwd) --verbose | && /usr/bin --verbose
+done cd export sed grep 2>/dev/null test
+		x=1 | sed sed awk sed
+		--verbose "$@" done done $(pwd)
+| x=1 | local $(pwd) printf
+&& export echo --verbose && && awk done | | -eu echo |
+	sed x=1 "$@" grep 'quoted text' cd printf | 2>/dev/null then | then awk
+		${HOME} test "$@" 2>/dev/null local
+	'quoted text' test then "$1" 'quoted text' echo echo --verbose sed done ${HOME}
+		readonly 2>/dev/null 'quoted text'
+		-eu "$@" "$1" x=1 sed "$@"
+	/usr/bin sed /usr/bin
+-eu then | export --verbose /usr/bin done then test grep "$1" done
+	readonly /usr/bin $(pwd)
+awk printf $(pwd) "$1" sed "$1" test | 2>/dev/null
+		&& "$@" --verbose printf test export printf
+test "$1" cd "$1" test | cd /usr/bin $(pwd) -eu /usr/bin
+export /usr/bin export "$1" /usr/bin
+		2>/dev/null --verbose && | cd then /usr/bin "$1" test printf
+	printf readonly readonly test readonly then cd ${HOME}
+	cd | && local local cd readonly local --verbose cd | echo cd 'quoted text' grep
+		${HOME} --verbose grep "$1" grep local 'quoted text'
+		readonly test cd $(pwd) 'quoted text' sed grep echo "$@" -eu
+	cd --verbose ${HOME} --verbose | done $(pwd)
+	| local export done then /usr/bin --verbose $(pwd) 'quoted text'
+	| $(pwd) done awk sed test 2>/dev/null ${HOME}
+		"$1" local --verbose sed readonly 2>/dev/null
+	2>/dev/null x=1 grep awk 2>/dev/null cd done printf -eu x=1 | sed echo
+	${HOME} && "$@" x=1 readonly "$@" "$@" test done $(pwd) 'quoted text'
+readonly $(pwd) sed "$@" 2>/dev/null "$@" "$1"
+printf test sed test sed cd /usr/bin awk readonly
+printf --verbose readonly
+sed then export done sed --verbose "$1" done /usr/bin --verbose
+	export awk /usr/bin && then awk ${HOME} ${HOME} "$@" done grep | 2>/dev/null
+	"$1" export echo readonly 2>/dev/null /usr/bin 'quoted text' && | awk | then
+		/usr/bin $(pwd) echo "$@" 'quoted text' echo then /usr/bin | 2>/dev/null
+$(pwd) x=1 sed "$1" | $(pwd) awk ${HOME} && printf echo grep
+	awk --verbose sed grep |
+		done "$1" | done test readonly x=1
+-eu echo 2>/dev/null "$1" "$@" export grep export export echo
+	done x=1 'quoted text' | --verbose 2>/dev/null cd -eu sed 'quoted text' printf
+	&& x=1 | 'quoted text' x=1
+printf /usr/bin --verbose awk sed printf "$1" $(pwd)
+	echo readonly --verbose test
+readonly /usr/bin cd --verbose
+test --verbose | | -eu done awk export 2>/dev/null
+${HOME} readonly x=1
+	test sed | grep grep then | "$@" ${HOME}
+		'quoted text' grep -eu grep x=1 sed
+	2>/dev/null 'quoted text' 'quoted text'
+	readonly 2>/dev/null 'quoted text' export x=1 cd
+		echo $(pwd) 2>/dev/null grep -eu
+	"$1" echo then export local /usr/bin
+		'quoted text' "$1" ${HOME} grep
+	cd ${HOME} local echo test cd sed x=1 cd printf $(pwd) "$1"
+		grep | readonly awk "$@" grep 2>/dev/null echo && 'quoted text' echo --verbose
+	awk export then cd local readonly sed grep "$1" "$@" local
+	printf -eu then readonly local ${HOME} ${HOME} local test readonly
+		"$@" && awk x=1 $(pwd) then printf /usr/bin readonly "$@"
+	${HOME} -eu "$1" awk ${HOME}
+local then grep 2>/dev/null 'quoted text' -eu
+local local $(pwd) cd x=1 --verbose
+| sed sed | then readonly then
+		grep then test 2>/dev/null ${HOME} sed echo export test awk "$1"
+	x=1 grep awk test -eu -eu echo $(pwd) x=1 -eu /usr/bin
+-eu ${HOME} ${HOME} echo done sed "$@" readonly -eu printf grep ${HOME} "$1" x=1
+		2>/dev/null /usr/bin ${HOME} && sed local $(pwd) 2>/dev/null &&
+		printf grep test x=1 test then -eu sed grep local
+		printf done readonly readonly 2>/dev/null cd
+$(pwd) cd grep -eu readonly
+	'quoted text' 2>/dev/null x=1 sed "$@" cd ${HOME}
+	grep /usr/bin --verbose 'quoted text' | test "$@" test echo 'quoted text'
+2>/dev/null readonly export "$1" 2>/dev/null sed readonly "$1" awk awk
+	printf grep "$1" x=1 $(pwd) readonly
+	/usr/bin /usr/bin cd && "$1" test cd 2>/dev/null export
+grep | /usr/bin sed grep test done echo sed "$@" ${HOME}
+'quoted text' $(pwd) grep x=1 &&
+test done && 'quoted text' -eu readonly "$1" done
+		-eu local awk printf echo x=1 local awk --verbose echo test cd
+		'quoted text' && export awk "$@" local 2>/dev/null "$@" "$@" echo printf
+	"$1" x=1 x=1 export ${HOME} printf $(pwd) local --verbose
+		--verbose readonly && | local awk done "$@"
+	done sed echo sed 2>/dev/null ${HOME} awk -eu 2>/dev/null "$1" local /usr/bin
+	done -eu then 'quoted text' 2>/dev/null "$@" $(pwd) x=1 grep then local ${HOME}
+	2>/dev/null done x=1 test | local 'quoted text' -eu echo
+		-eu readonly done /usr/bin echo | cd "$@" | cd printf
+	echo local 'quoted text' && 'quoted text' ${HOME} 'quoted text' then "$1"
+		2>/dev/null test sed test "$@" ${HOME} local $(pwd) awk "$1" export
+		2>/dev/null 'quoted text' -eu 'quoted text' ${HOME}
+awk cd | "$@" awk awk then export
+		awk cd test 'quoted text' ${HOME} local 'quoted text' "$@" test
+then -eu export then "$1" cd x=1 /usr/bin then printf "$1" awk cd
+echo -eu test "$1" awk
+	test 2>/dev/null ${HOME} -eu sed --verbose echo
+		test test && -eu | done test
+		${HOME} $(pwd) export 2>/dev/null $(pwd) sed -eu echo
+-eu grep grep $(pwd) export cd 'quoted text' export grep -eu --verbose done "$1"
+		--verbose awk "$@" then echo
+		local cd x=1 'quoted text' sed -eu test echo --verbose readonly
+	grep -eu test sed "$@" readonly ${HOME}
+		'quoted text' && 2>/dev/null echo | sed 'quoted text' grep local /usr/bin ${HOME}
+	${HOME} "$@" then awk export cd grep "$1" "$@" echo | export $(pwd) 'quoted text'
+"$1" $(pwd) test "$@" printf cd export done --verbose
+printf printf -eu echo readonly sed local test 2>/dev/null
+done done "$1" ${HOME} local &&
+		echo done printf "$1" $(pwd) "$1" x=1 local /usr/bin grep 2>/dev/null
+readonly $(pwd) && | | /usr/bin done ${HOME} then
+export sed local local awk x=1 x=1 then printf && printf
+	local | | local x=1 -eu --verbose /usr/bin && printf
+	/usr/bin /usr/bin 'quoted text'
+	$(pwd) grep local --verbose awk readonly "$@" then 2>/dev/null then test cd
+	printf -eu "$1" awk done then printf && awk $(pwd) then "$1"
+	${HOME} 2>/dev/null "$1" done 'quoted text' test readonly
+		test local -eu echo "$1" sed readonly "$@" ${HOME}
+		'quoted text' $(pwd) $(pwd) --verbose | x=1 cd x=1 sed echo
+		sed grep sed done printf /usr/bin | --verbose cd $(pwd) x=1
+	awk 'quoted text' sed && /usr/bin cd
+		-eu | echo "$1" done test /usr/bin
+	${HOME} /usr/bin local cd /usr/bin readonly && --verbose echo printf -eu
+	'quoted text' awk && sed cd $(pwd) grep echo ${HOME}
+		echo sed x=1 export $(pwd) test grep awk then 2>/dev/null 'quoted text' | export
+	/usr/bin printf --verbose x=1
+test local export local test awk test export export "$@" printf done
+		&& readonly && local -eu 'quoted text' echo 2>/dev/null echo
+		2>/dev/null 2>/dev/null awk awk test $(pwd) ${HOME}
+	then -eu -eu | $(pwd) 'quoted text' 2>/dev/null
+	printf test --verbose echo ${HOME} then
+	then grep grep grep export
+"$@" awk | done -eu x=1 local --verbose done 'quoted text' printf ${HOME} --verbose
+"$1" echo "$@" then cd export ${HOME} echo test echo "$1" -eu $(pwd)
+x=1 --verbose -eu | echo $(pwd) test done test awk echo
+		printf --verbose --verbose "$1" /usr/bin
+awk done $(pwd) 'quoted text' 2>/dev/null
+	echo readonly test sed grep export && sed 'quoted text'
+		readonly && echo /usr/bin echo then 2>/dev/null then "$@" done ${HOME} export
+local readonly "$1" $(pwd) printf awk -eu ${HOME}
+--verbose -eu cd done 'quoted text' test -eu --verbose --verbose printf &&
+'quoted text' cd $(pwd) | $(pwd) /usr/bin
+	| | $(pwd) "$@" ${HOME} done
+	grep then /usr/bin 'quoted text' -eu then "$1" x=1 x=1 "$1" echo
+	grep $(pwd) readonly x=1 grep "$1" cd local $(pwd) awk
+		"$@" awk export 2>/dev/null echo printf
+		'quoted text' x=1 done "$@" | && $(pwd) | && export echo
+		cd 2>/dev/null echo then test x=1 "$@" --verbose "$1" grep then local
+	test ${HOME} | readonly x=1 readonly grep ${HOME}
+	| cd && "$1" /usr/bin ${HOME} | ${HOME}
+		2>/dev/null printf readonly $(pwd) x=1 then echo local
+		sed x=1 $(pwd) grep /usr/bin sed export awk && readonly
+		2>/dev/null | && --verbose && echo
+		printf "$@" grep $(pwd) test 2>/dev/null "$@" $(pwd) "$@" /usr/bin cd
+		"$@" 'quoted text' /usr/bin $(pwd) && done grep $(pwd)
+		echo /usr/bin awk -eu ${HOME} readonly "$1" "$1"
+cd readonly x=1 | "$@" "$@" -eu done 2>/dev/null "$@" && local
+	"$@" echo readonly "$@" "$1" 'quoted text' export
+	done readonly x=1 --verbose | done test export export echo
+		--verbose /usr/bin then x=1 $(pwd)
+	then cd export local --verbose export x=1 "$1"
+	printf | sed printf local --verbose 'quoted text' $(pwd) && | | 2>/dev/null
+	echo grep awk "$@" awk 'quoted text' -eu x=1 "$1" grep "$@"
+x=1 echo test then printf awk ${HOME}
+	local 'quoted text' "$@" 'quoted text' && awk x=1 'quoted text' "$@" x=1 readonly
+	2>/dev/null readonly 'quoted text' then grep local
+	| --verbose 'quoted text' done sed "$1" sed then $(pwd) "$@" readonly
+		${HOME} export && 'quoted text' /usr/bin | ${HOME} 'quoted text' readonly
+		echo ${HOME} --verbose readonly printf printf echo echo ${HOME}
+export echo && -eu grep "$@" export then ${HOME} && "$@" && then | printf
+sed && echo echo sed done --verbose x=1
+${HOME} done printf "$@" cd local awk | --verbose && local awk echo ${HOME}
+	cd ${HOME} then 'quoted text'
+	then $(pwd) && 2>/dev/null sed export done | && --verbose
+		2>/dev/null | /usr/bin | /usr/bin -eu done awk awk local export export sed
+		echo grep $(pwd) cd -eu sed printf
+		$(pwd) grep grep test cd awk | echo
+	sed /usr/bin cd "$1" "$@" "$1" ${HOME} /usr/bin readonly printf
+	| awk test export 2>/dev/null export printf test
+echo ${HOME} /usr/bin grep done echo 'quoted text'
+	done test ${HOME} --verbose -eu /usr/bin 'quoted text'
+		done awk printf then export sed sed printf 'quoted text' grep --verbose "$@" 'quoted text'
+		/usr/bin export echo local "$1" local sed | cd cd sed | printf && export
+--verbose grep local x=1 && then awk --verbose "$@" export test done | $(pwd)
+2>/dev/null done cd /usr/bin -eu && 'quoted text'
+then -eu printf cd "$@" "$@" /usr/bin awk "$@" -eu --verbose local x=1
+done test export $(pwd) cd echo printf then done then x=1 grep awk
+	/usr/bin cd && "$@" 2>/dev/null test "$1" test $(pwd) export
+echo printf readonly printf echo 2>/dev/null $(pwd) test local
+sed export "$1" -eu 'quoted text' ${HOME} 2>/dev/null then test
+		sed 2>/dev/null grep done ${HOME} echo -eu then x=1 printf $(pwd) "$1" --verbose
+		&& --verbose echo then ${HOME}
+		/usr/bin sed 2>/dev/null done | echo local $(pwd) echo awk local
+	--verbose readonly echo done local awk --verbose
+		${HOME} local done grep
+readonly test grep then test local done && x=1 export -eu local 'quoted text'
+		&& $(pwd) then x=1 ${HOME} "$@" then && | sed x=1 "$@"
+		printf local readonly readonly printf $(pwd) test 2>/dev/null
+cd /usr/bin sed test cd sed then 'quoted text' x=1 2>/dev/null local readonly
+	| printf 'quoted text' cd then export then x=1 ${HOME} | x=1 "$@" x=1
+		export -eu then printf
+	"$1" 'quoted text' /usr/bin echo "$1" export readonly export -eu
+		readonly -eu && $(pwd) && export /usr/bin
+	2>/dev/null $(pwd) 'quoted text' grep | 2>/dev/null
+test ${HOME} /usr/bin awk ${HOME} done printf echo
+	local | cd && export awk "$1" grep grep 2>/dev/null /usr/bin
+	-eu printf ${HOME} awk "$1" echo /usr/bin /usr/bin echo /usr/bin
+		2>/dev/null "$@" readonly | readonly $(pwd) /usr/bin
+cd | -eu 'quoted text' echo awk -eu ${HOME} x=1
+&& test | && export $(pwd) -eu readonly export test ${HOME}
+	"$1" cd echo --verbose test echo $(pwd)
+		/usr/bin grep x=1 export sed echo cd printf | cd printf readonly grep
+2>/dev/null awk export ${HOME} cd echo cd cd done
+		--verbose 'quoted text' "$1" -eu 2>/dev/null test printf | done $(pwd) done export
+	$(pwd) test 'quoted text' ${HOME} "$1" then --verbose x=1 "$1" ${HOME} 2>/dev/null
+		$(pwd) "$1" export x=1 grep x=1 $(pwd) grep test && test sed
+${HOME} | ${HOME} then local /usr/bin
+	cd | 'quoted text' ${HOME} awk x=1 /usr/bin "$1" awk
+--verbose echo "$1" 2>/dev/null awk then
+	'quoted text' | 2>/dev/null echo echo /usr/bin cd && test
+	-eu -eu grep && x=1 awk -eu test "$@" done
+	readonly x=1 awk 2>/dev/null
+readonly && 2>/dev/null grep cd readonly ${HOME}
+		x=1 -eu x=1 sed export test test echo "$@" ${HOME}
+		echo | grep $(pwd) 'quoted text' readonly | grep test x=1 then ${HOME}
+	x=1 x=1 ${HOME} local -eu ${HOME} "$@" && readonly
+	/usr/bin echo $(pwd) sed done
+local readonly sed "$1" 2>/dev/null
+${HOME} "$1" --verbose && ${HOME} export grep 2>/dev/null echo test "$@" x=1 --verbose
+	${HOME} export cd &&
+done export "$1" then | && cd x=1 "$@" local awk sed $(pwd) local -eu grep
+	| test "$1" echo awk done 'quoted text' then export
+	&& "$1" sed -eu ${HOME} done export done export export
+		${HOME} 2>/dev/null grep awk --verbose readonly 'quoted text' readonly
+		"$1" && ${HOME} /usr/bin printf
+	done 'quoted text' && x=1 readonly echo --verbose printf sed /usr/bin
+	echo 'quoted text' sed done
+&& grep $(pwd) 2>/dev/null ${HOME} readonly cd && "$1" 2>/dev/null
+	printf sed "$1" x=1 $(pwd) sed test grep export export | readonly
+	echo $(pwd) --verbose x=1 grep sed | awk done done $(pwd) -eu echo
+	"$@" local awk cd "$@" printf test && local
+test readonly /usr/bin done $(pwd) -eu --verbose
+$(pwd) -eu -eu awk /usr/bin "$1" /usr/bin "$1" | ${HOME} readonly $(pwd) "$@" printf
+	cd ${HOME} -eu echo /usr/bin local "$@"
+printf cd "$1" grep x=1 --verbose | x=1 cd printf "$1"
+	| "$@" echo | export local
+		${HOME} 'quoted text' | -eu done echo then $(pwd) "$1"
+	then awk /usr/bin test cd cd readonly
+	awk "$1" grep x=1 "$1" --verbose awk
+local ${HOME} done printf
+	'quoted text' && done && -eu --verbose
+	awk "$@" cd then printf grep test local
+		readonly local -eu local test x=1 "$1" done echo
+		${HOME} /usr/bin --verbose done /usr/bin "$@" x=1 'quoted text' /usr/bin grep
+test "$1" --verbose -eu
+	$(pwd) 'quoted text' ${HOME} && x=1 --verbose ${HOME}
+awk done 'quoted text' grep x=1
+	'quoted text' grep -eu local --verbose ${HOME}
+export "$1" echo sed "$1" "$1" --verbose
+		"$1" "$1" cd cd export x=1 -eu x=1 echo test /usr/bin echo /usr/bin grep grep
+	-eu | "$@" printf 'quoted text' export /usr/bin export "$1" then
+"$@" then test $(pwd) cd ${HOME} ${HOME} x=1 "$1" awk "$1" local --verbose
+		/usr/bin x=1 'quoted text' done done cd $(pwd) awk awk then x=1 --verbose
+sed cd 2>/dev/null cd $(pwd) $(pwd) | local
+	"$1" /usr/bin sed && $(pwd) then -eu test 'quoted text'
+	cd test echo echo cd then $(pwd) && local sed printf sed | "$1"
+${HOME} 2>/dev/null && /usr/bin --verbose x=1 | echo -eu sed -eu printf echo readonly
+	done echo x=1 sed ${HOME} sed readonly --verbose grep readonly /usr/bin
+	/usr/bin && export 2>/dev/null
+	| echo 'quoted text' ${HOME} 'quoted text' | export /usr/bin 2>/dev/null echo awk
+	$(pwd) --verbose sed echo local readonly readonly printf /usr/bin ${HOME}
+	cd -eu 2>/dev/null ${HOME} $(pwd) $(pwd) readonly ${HOME}
+		2>/dev/null --verbose && then /usr/bin cd -eu ${HOME}
+		-eu local x=1 test 2>/dev/null 'quoted text'
+cd then && ${HOME} $(pwd) && ${HOME} done local 2>/dev/null readonly
+'quoted text' && grep cd --verbose export
+		then test --verbose readonly
+	"$1" | test /usr/bin | "$@" done sed cd cd $(pwd) awk awk "$1" grep "$1" done
+cd --verbose readonly grep 2>/dev/null | test local local then
+	done | x=1 "$1" awk done x=1 printf echo
+		printf 'quoted text' x=1 "$1" export
+	sed | echo 'quoted text' done test awk local && then export
+printf --verbose x=1 'quoted text' export printf ${HOME} test "$@" --verbose
+&& --verbose sed printf echo local sed local | "$@" readonly
+	echo 2>/dev/null -eu 2>/dev/null && printf test "$1" readonly
+	/usr/bin awk 2>/dev/null readonly echo awk echo echo local export 2>/dev/null
+		${HOME} awk --verbose local export
+	grep x=1 grep /usr/bin cd 2>/dev/null local
+done test "$1" | | 'quoted text' --verbose
+--verbose --verbose &&
+	$(pwd) then && x=1 then "$1"
+2>/dev/null ${HOME} echo ${HOME}
+		"$@" test --verbose $(pwd)
+	'quoted text' sed readonly
+	--verbose done -eu x=1 ${HOME} "$1" "$1" done echo ${HOME} awk -eu printf -eu
+		$(pwd) "$1" test done grep "$1" 2>/dev/null /usr/bin
+| sed 'quoted text' echo x=1 printf test -eu then
+		2>/dev/null $(pwd) local $(pwd) sed printf
+		readonly ${HOME} readonly "$@" grep "$@" $(pwd) then 2>/dev/null readonly
+	${HOME} 2>/dev/null awk awk then
+		awk | readonly export "$1" ${HOME} | done 2>/dev/null local --verbose |
+	test test x=1 && -eu | -eu export then then sed --verbose ${HOME} x=1
+		export done grep "$1" && test
+		-eu /usr/bin && grep "$1" test local -eu -eu -eu cd grep | export /usr/bin
+		&& -eu "$@" 2>/dev/null readonly readonly x=1 done x=1 "$@" x=1 | grep export
+		readonly 2>/dev/null x=1 cd done /usr/bin
+		done then ${HOME} cd /usr/bin /usr/bin ${HOME} readonly /usr/bin ${HOME}
+		sed done && -eu "$1" test cd
+	-eu && | -eu --verbose export --verbose ${HOME} then
+grep | done | awk grep "$@" grep local | test
+	x=1 'quoted text' | test "$1" readonly awk
+	&& cd local | /usr/bin then /usr/bin
+		local cd test -eu cd sed | -eu done grep 'quoted text'
+readonly local awk grep /usr/bin
+local --verbose && local "$@"
+printf done echo awk -eu grep export awk done "$@" "$@" $(pwd)
+		"$@" printf cd $(pwd) grep done readonly
+		grep $(pwd) | 2>/dev/null /usr/bin 2>/dev/null ${HOME} then done grep && awk awk
+		/usr/bin && 2>/dev/null
+		&& grep printf | | --verbose echo ${HOME} x=1 done $(pwd) "$1" -eu "$1" echo x=1
+x=1 x=1 "$1" sed cd -eu --verbose
+sed ${HOME} sed -eu x=1 test && 'quoted text' readonly cd $(pwd) -eu done "$@"
+	local export /usr/bin ${HOME} printf /usr/bin ${HOME} local
+	| && done "$@" | x=1 grep printf | done
+		echo sed x=1 -eu done 'quoted text' cd "$@" awk test | ${HOME} "$1" awk
+	printf grep $(pwd) export sed printf 'quoted text' "$1" "$@"
+		test test done "$@" "$1" awk export "$@" sed -eu /usr/bin test cd readonly
+		2>/dev/null && 'quoted text' /usr/bin && &&
+		$(pwd) -eu $(pwd) done $(pwd) export
+	| /usr/bin sed awk && -eu echo "$1" /usr/bin grep local --verbose
+	/usr/bin cd printf "$1" echo echo -eu /usr/bin sed local $(pwd) awk awk |
+	awk | -eu x=1 cd 'quoted text' done
+${HOME} && echo grep 'quoted text'
+		cd then export test cd $(pwd) -eu --verbose
+cd export then && ${HOME} cd sed local done readonly $(pwd) cd readonly
+	2>/dev/null local sed local local local
+	cd then sed -eu printf |
+	| -eu && printf "$@" awk "$@" local
+then --verbose then | printf /usr/bin
+test "$@" done local 'quoted text' --verbose
+then cd grep $(pwd) /usr/bin "$1" printf readonly readonly done then ${HOME}
+&& "$@" awk | "$@" /usr/bin test
+$(pwd) | echo test done readonly
+		test x=1 $(pwd) cd grep grep sed awk 2>/dev/null done done grep -eu 2>/dev/null
+		/usr/bin local readonly test echo local printf && grep export then
+awk done /usr/bin ${HOME} x=1 $(pwd) "$@" echo "$@" printf readonly | --verbose
+'quoted text' -eu export ${HOME} "$1" "$1" "$@" awk "$1" "$@" echo 'quoted text'
+		readonly then grep /usr/bin done | -eu "$@" && then "$1" readonly
+test $(pwd) "$@" local -eu
+"$@" sed echo "$1" then grep readonly -eu $(pwd) ${HOME}
+done readonly export grep | "$1"
+${HOME} sed 'quoted text'
+		-eu x=1 sed | ${HOME} cd
+	then | cd x=1 then | then -eu grep echo grep readonly
+/usr/bin cd printf test &&
+		grep sed $(pwd) then readonly
+| 2>/dev/null export echo ${HOME} ${HOME}
+		local done cd 2>/dev/null "$1" $(pwd) echo grep $(pwd)
+		'quoted text' --verbose $(pwd) test grep --verbose
+	-eu | export sed /usr/bin 2>/dev/null 2>/dev/null $(pwd) cd
+		-eu local test 'quoted text' 2>/dev/null local local awk x=1 "$1"
+		done echo $(pwd) readonly ${HOME} 'quoted text'
+$(pwd) | "$1" --verbose readonly /usr/bin sed export echo readonly
+export then printf export export local then "$1" 'quoted text'
+	export readonly ${HOME} "$@" /usr/bin local done done 2>/dev/null --verbose
+sed /usr/bin cd --verbose
+	local $(pwd) x=1 && echo -eu readonly printf printf done sed grep /usr/bin
+	local cd 'quoted text'
+		"$1" && grep printf sed local then 'quoted text'
+$(pwd) 2>/dev/null $(pwd) x=1
+		/usr/bin echo ${HOME} -eu local 2>/dev/null done printf cd sed "$1" $(pwd) printf
+		$(pwd) 'quoted text' readonly local grep
+		sed local ${HOME} readonly then readonly
+		"$1" --verbose x=1 echo sed local /usr/bin && sed readonly
+cd printf 2>/dev/null ${HOME} cd "$1" 'quoted text' export test cd
+	2>/dev/null echo test /usr/bin && "$@"
+2>/dev/null x=1 | test awk "$1" test "$@" readonly /usr/bin
+	${HOME} --verbose $(pwd) x=1 -eu then "$@" echo | "$@" readonly
+printf awk sed /usr/bin && 2>/dev/null
+		"$@" then awk grep | 2>/dev/null /usr/bin printf export
+${HOME} 'quoted text' local echo
+		${HOME} sed printf 2>/dev/null --verbose then then 'quoted text'
+test sed then then test x=1 awk done |
+		&& test 2>/dev/null -eu grep
+	then "$1" sed done | 'quoted text' 2>/dev/null grep 'quoted text'
+cd done then 'quoted text' $(pwd) --verbose export export test ${HOME}
+&& printf 'quoted text' x=1 && x=1 test echo sed | grep
+/usr/bin local | ${HOME} "$1" | ${HOME} cd done "$@"
+x=1 done printf cd "$@" x=1
+&& ${HOME} printf x=1 "$@" sed && 'quoted text' 'quoted text' --verbose then
+$(pwd) export readonly readonly done
+	local export 'quoted text' sed ${HOME}
+grep done ${HOME} && /usr/bin
+		local export cd "$@" x=1 local | local 'quoted text' /usr/bin
+		${HOME} /usr/bin cd done readonly x=1 echo && printf readonly "$@" cd test $(pwd)
+	| local $(pwd) test cd 2>/dev/null grep readonly export
+	done grep 'quoted text' echo cd && $(pwd)
+	awk grep done grep && awk export awk --verbose cd ${HOME} done | readonly
+		echo readonly 2>/dev/null sed "$1" 2>/dev/null --verbose
+		&& export ${HOME} printf printf cd
+	local printf && printf 'quoted text'
+		"$1" export && | grep -eu
+then "$1" awk grep export ${HOME} done done x=1 && "$@" grep 2>/dev/null
+		done grep local local
+	then x=1 awk then local && grep done
+	local 2>/dev/null echo "$1" readonly export echo cd x=1 $(pwd) test cd readonly
+	sed readonly 2>/dev/null awk -eu export "$@" readonly "$1" test echo test
+$(pwd) && export sed printf awk then ${HOME} printf | | local | 2>/dev/null
+/usr/bin echo --verbose readonly ${HOME}
+x=1 export /usr/bin $(pwd) then awk grep printf
+		| test ${HOME} awk then | readonly ${HOME} test x=1 --verbose 'quoted text'
+		--verbose awk local "$1"
+done readonly /usr/bin /usr/bin cd export | export -eu
+test /usr/bin "$1" --verbose 2>/dev/null | export "$@"
+	local 'quoted text' then echo printf $(pwd) | -eu test x=1 test echo echo /usr/bin
+	test done "$@" "$@" | 2>/dev/null "$@" export /usr/bin
+local --verbose printf $(pwd) done echo 2>/dev/null
+		done $(pwd) $(pwd) cd && local 'quoted text' --verbose
+	--verbose done test && local
+	test $(pwd) && test $(pwd) "$1" "$@" export
+		'quoted text' $(pwd) cd 2>/dev/null awk 'quoted text'
+	echo grep 2>/dev/null | cd --verbose grep && echo
+${HOME} 'quoted text' | /usr/bin export awk test "$1"
+	--verbose -eu -eu /usr/bin "$1" x=1 /usr/bin cd 'quoted text' printf
+${HOME} "$@" /usr/bin local ${HOME} --verbose
+'quoted text' --verbose | $(pwd)
+	printf done | x=1 then done ${HOME} sed sed awk readonly
+	-eu ${HOME} test cd 'quoted text' grep cd export awk
+	done /usr/bin echo local echo printf --verbose test echo 2>/dev/null
+	-eu 2>/dev/null 2>/dev/null test readonly
+		"$@" export then awk && | local
+	-eu && 2>/dev/null sed export sed x=1 && 2>/dev/null
+	x=1 awk local "$@" done 2>/dev/null done then
+grep && 'quoted text' 'quoted text'
+	local $(pwd) 'quoted text' cd -eu -eu done echo "$1" -eu readonly local readonly
+		'quoted text' --verbose "$@"
+		printf | printf export awk test
+	sed then readonly cd readonly then -eu awk done
+	readonly /usr/bin export echo "$1" && awk x=1 $(pwd) "$@" x=1 -eu /usr/bin
+	printf "$1" grep echo 2>/dev/null
+		| --verbose $(pwd) x=1 export
+	"$1" && sed sed "$1" 2>/dev/null awk /usr/bin
+then 'quoted text' export && awk
+done x=1 awk | cd printf grep local 2>/dev/null --verbose grep | x=1 && awk
+	sed local 2>/dev/null grep grep x=1 echo printf ${HOME}
+	| printf x=1 | "$@" -eu echo
+		awk printf ${HOME} then awk
+	awk echo export test readonly
+grep | then && ${HOME} local printf
+		then export then echo sed printf $(pwd) "$1" 'quoted text' $(pwd) 2>/dev/null
+		| cd "$@" awk 2>/dev/null then printf sed 2>/dev/null then 2>/dev/null 'quoted text'
+		cd x=1 grep -eu readonly "$@" --verbose 2>/dev/null cd $(pwd)
+	cd readonly grep printf 2>/dev/null done done
+		echo readonly readonly $(pwd) x=1 readonly printf then awk local
+	export && -eu && cd | |
+	-eu sed export test $(pwd) ${HOME} ${HOME} cd x=1 ${HOME}
+done printf $(pwd) echo awk
+/usr/bin grep "$@" 'quoted text' && $(pwd) 2>/dev/null
+	"$@" cd "$@" && awk -eu cd -eu "$1" /usr/bin "$@" && awk echo local
+local /usr/bin echo "$1" "$1" awk --verbose export && export "$1" test 2>/dev/null
+		grep test && export echo $(pwd) readonly ${HOME} echo | export
+		x=1 then 'quoted text' done ${HOME} awk export ${HOME} awk local readonly export
+		2>/dev/null printf && done printf grep cd "$@"
+		cd "$1" local readonly grep printf test | readonly "$1" readonly 2>/dev/null
+done done $(pwd) -eu sed done "$@" && grep ${HOME}
+export x=1 done "$1" "$@" "$1" local printf &&
+		--verbose local "$1" readonly "$1" printf done test | test 'quoted text'
+	awk "$1" --verbose x=1 test ${HOME} | x=1 local sed | echo readonly
+		--verbose /usr/bin /usr/bin printf echo
+		2>/dev/null ${HOME} export local --verbose "$@" grep echo 'quoted text' test
+then $(pwd) -eu done && | sed | grep awk | &&
+	$(pwd) cd local ${HOME} "$1" printf "$@" awk test --verbose
+-eu && test | done /usr/bin test sed x=1
+local done printf readonly
+		| local "$@" /usr/bin done awk awk 2>/dev/null
+		&& local test && ${HOME} | "$@" "$@" --verbose
+		export "$@" "$1" echo
+		--verbose /usr/bin ${HOME} 'quoted text' -eu then awk local | "$@" "$1" cd /usr/bin
+		test $(pwd) | echo test 'quoted text' -eu readonly
+echo 2>/dev/null sed "$1" 'quoted text' export --verbose $(pwd) cd -eu grep
+	x=1 readonly 'quoted text' 2>/dev/null
+		$(pwd) awk done then then grep "$@" export readonly awk ${HOME} /usr/bin
+		-eu && "$1" grep awk --verbose 'quoted text'
+	/usr/bin "$1" 'quoted text' printf $(pwd) 'quoted text'
+		| $(pwd) then readonly readonly /usr/bin local awk | cd $(pwd) "$1" test
+readonly && 2>/dev/null -eu printf
+	cd local local awk "$1"
+done printf awk x=1 $(pwd) awk ${HOME} "$@" $(pwd) echo readonly
+		${HOME} | $(pwd) printf echo /usr/bin "$@" awk sed done printf | --verbose
+		$(pwd) grep readonly grep 2>/dev/null
+	/usr/bin "$1" 'quoted text' then | then /usr/bin | /usr/bin done /usr/bin
+#include c35.sh
+	/usr/bin "$@" /usr/bin --verbose
+x=1 && $(pwd) 2>/dev/null printf readonly --verbose export done
+		local export $(pwd) export 'quoted text' sed readonly test readonly export
+		'quoted text' cd sed export echo readonly "$1" $(pwd)
+echo "$1" test "$1" x=1 x=1 grep | readonly grep | && --verbose | --verbose x=1
+cd ${HOME} echo test $(pwd) ${HOME} ${HOME}
+		sed | $(pwd) "$1" then -eu 2>/dev/null grep ${HOME}
+then awk test local cd | "$1" "$1" grep "$1" done x=1 echo done $(pwd) --verbose
+	sed && echo cd cd done
+done then $(pwd) 2>/dev/null cd $(pwd) readonly | 2>/dev/null
+		--verbose /usr/bin ${HOME} $(pwd) 2>/dev/null awk printf local "$@"
+	sed awk readonly | local && done 'quoted text' | local export
+	--verbose then "$1" printf echo ${HOME} local /usr/bin
+&& 2>/dev/null 'quoted text' 'quoted text' $(pwd)
+		/usr/bin /usr/bin sed export "$@" echo "$@" /usr/bin readonly readonly |
+		export grep then then -eu && echo export awk --verbose /usr/bin then
+local readonly export ${HOME} --verbose "$@" $(pwd) --verbose ${HOME} printf
+cd export "$@" "$@" awk && "$1" ${HOME} | "$@" 2>/dev/null then echo local cd printf
+awk --verbose test 'quoted text' then echo export done 'quoted text' -eu |
+		done readonly && readonly local done -eu | /usr/bin
+'quoted text' ${HOME} -eu printf then -eu 2>/dev/null readonly 2>/dev/null
+		done grep awk "$1" --verbose --verbose --verbose
+2>/dev/null $(pwd) "$1" grep
+	&& awk done "$@" echo 'quoted text' $(pwd) then /usr/bin 'quoted text'
+		then done && "$1" ${HOME}
+sed "$@" /usr/bin grep x=1 x=1 test "$@" grep x=1 -eu | "$1" --verbose readonly
+		x=1 | 'quoted text' $(pwd)
+readonly printf cd test test grep
+	'quoted text' -eu test ${HOME} "$@" && export printf printf /usr/bin
+		${HOME} "$1" done test $(pwd) x=1 "$1" | ${HOME} | $(pwd)
+$(pwd) sed 'quoted text' awk
+		"$@" printf --verbose && x=1 grep awk && ${HOME} cd 2>/dev/null test
+--verbose export printf test $(pwd)
+		then test "$@" ${HOME} sed awk 'quoted text' ${HOME} then
+		"$@" x=1 | grep "$1" && ${HOME} --verbose --verbose $(pwd) /usr/bin | awk
+${HOME} /usr/bin "$@" -eu $(pwd) x=1 sed --verbose
+		${HOME} --verbose 2>/dev/null $(pwd) awk --verbose printf "$@" cd && done echo
+'quoted text' then x=1 x=1 2>/dev/null -eu
+	--verbose cd && grep grep
+		&& local | && 2>/dev/null $(pwd)
+	export | readonly -eu /usr/bin grep awk x=1
+	local x=1 done | sed -eu awk -eu
+		--verbose cd awk cd x=1 /usr/bin
+	2>/dev/null 'quoted text' | local ${HOME} test ${HOME}
+	test ${HOME} $(pwd) done x=1 awk awk
+		done export then -eu readonly grep $(pwd)
+--verbose export readonly ${HOME} done done grep
+-eu done local --verbose
+	${HOME} && awk "$@" done awk -eu "$@" "$@" test x=1 | /usr/bin
+sed printf awk sed printf printf --verbose /usr/bin /usr/bin ${HOME} /usr/bin
+		${HOME} | sed -eu awk $(pwd) grep done awk echo then export
+		grep printf export | 'quoted text' $(pwd) done then export then readonly
+	${HOME} cd then done 2>/dev/null export sed ${HOME} cd -eu "$1" /usr/bin
+	export /usr/bin -eu cd
+	${HOME} grep grep local
+	/usr/bin x=1 x=1 "$@" echo
+		"$1" -eu && "$@" -eu 'quoted text' echo test test export --verbose /usr/bin local
+test export $(pwd) sed then cd /usr/bin
+local grep local "$1" printf -eu "$@" sed ${HOME} 2>/dev/null
+test 2>/dev/null cd test grep done
+		-eu --verbose "$1" "$1" $(pwd) then printf
+		-eu && -eu test /usr/bin test x=1 readonly && then ${HOME} "$1"
+test grep done --verbose
+	done cd -eu export echo "$1"
+"$@" done printf ${HOME} 'quoted text'
+	awk test 'quoted text' local "$1" then x=1 sed "$@" /usr/bin awk x=1 grep
+		echo local && /usr/bin | export --verbose awk grep echo $(pwd) printf export
+		"$@" echo echo 'quoted text' "$1" then /usr/bin then cd export
+		printf export --verbose "$1" ${HOME} "$1" test done
+2>/dev/null grep sed $(pwd) local printf local | printf cd cd /usr/bin grep &&
+"$1" awk export --verbose ${HOME} export
+	awk $(pwd) then -eu echo local 'quoted text' readonly | 'quoted text'
+echo 'quoted text' local "$1" | 2>/dev/null -eu grep
+readonly printf local echo local echo
+	export then cd 'quoted text' export "$1" | x=1 2>/dev/null
+	echo local grep grep ${HOME} local --verbose 'quoted text' "$@" ${HOME} 'quoted text'
+		&& /usr/bin cd export export "$@" echo --verbose 'quoted text' x=1 done
+	'quoted text' /usr/bin 'quoted text' "$@" done cd 'quoted text'
+	sed "$1" local --verbose /usr/bin then "$@" 2>/dev/null $(pwd) export
+	'quoted text' local echo readonly awk --verbose | test "$@" readonly x=1 awk
+		"$@" -eu | /usr/bin done then | -eu sed x=1 done then test --verbose then /usr/bin
+		done done then -eu && printf then $(pwd) ${HOME}
+	export && "$@" 2>/dev/null 'quoted text'
+	done "$@" cd && cd cd 'quoted text' x=1
+${HOME} "$@" "$@" local ${HOME} done --verbose
+export echo done echo cd grep awk $(pwd) cd -eu &&
+	echo test -eu readonly /usr/bin ${HOME} && awk then && printf local done
+		-eu test 'quoted text' readonly then | then sed --verbose export printf
+	/usr/bin export 'quoted text' "$1" local /usr/bin test echo -eu x=1 x=1
+	sed "$1" readonly test echo /usr/bin cd "$1" export x=1 2>/dev/null ${HOME} printf
+printf 2>/dev/null -eu --verbose ${HOME} x=1 ${HOME}
+	export sed echo $(pwd) 'quoted text' /usr/bin "$@" done | "$@" test
+		printf /usr/bin --verbose printf ${HOME}
+		| local test ${HOME} 2>/dev/null && $(pwd) readonly echo && -eu export
+		awk echo | "$@" x=1 test 2>/dev/null awk
+readonly test -eu sed $(pwd) "$@" awk readonly && | echo echo $(pwd) 'quoted text'
+echo local local -eu x=1 --verbose && grep
+	then test | 2>/dev/null --verbose "$@" cd x=1 && echo x=1 sed cd echo readonly
+	/usr/bin awk sed awk cd export && awk "$@" readonly "$@" | && -eu 'quoted text'
+	&& | readonly printf export
+		'quoted text' 'quoted text' x=1 echo then printf | /usr/bin
+	${HOME} cd "$1" 'quoted text'
+done test test && -eu | && done -eu then awk sed printf -eu && /usr/bin
+		awk x=1 2>/dev/null |
+${HOME} ${HOME} grep | --verbose awk 'quoted text' --verbose
+	then awk --verbose /usr/bin
+	/usr/bin --verbose readonly 2>/dev/null local
+	then && cd sed done printf && printf /usr/bin -eu
+		echo sed ${HOME} /usr/bin sed
+	&& -eu done echo export x=1 sed
+"$@" "$@" export printf readonly
+	cd && echo export --verbose | x=1 "$1" readonly export && "$@"
+		${HOME} test ${HOME} awk
+"$@" -eu local 2>/dev/null | "$@" export 2>/dev/null done done "$1" cd export /usr/bin
+		"$1" 'quoted text' cd -eu && -eu printf ${HOME} /usr/bin local --verbose
+	"$1" done | cd done local 2>/dev/null grep -eu readonly awk grep 2>/dev/null
+	then printf sed readonly -eu ${HOME} x=1
+		sed /usr/bin sed --verbose export "$@" $(pwd) export grep
+	grep test cd test grep sed $(pwd) awk
+	| x=1 -eu ${HOME} x=1 ${HOME} readonly
+		${HOME} && export -eu "$@" sed /usr/bin
+	x=1 --verbose done grep -eu ${HOME} test test 2>/dev/null done
+	"$1" /usr/bin /usr/bin "$1" local $(pwd)
+sed echo awk | awk cd printf grep printf 'quoted text'
+cd readonly $(pwd) grep --verbose
+readonly printf grep ${HOME}
+		grep done "$1" && && ${HOME}
+"$@" export awk "$@" && --verbose $(pwd) 2>/dev/null export
+printf 2>/dev/null printf
+	awk export done ${HOME} "$1" local "$@" /usr/bin
+		grep readonly printf 'quoted text' printf x=1 grep readonly "$@"
+		/usr/bin /usr/bin echo cd
+		-eu test | x=1 $(pwd) 'quoted text'
+	-eu printf test printf "$1" printf ${HOME} /usr/bin export 2>/dev/null "$1" |
+	2>/dev/null "$@" local done export && x=1 /usr/bin "$@" awk ${HOME} | /usr/bin
+		printf "$@" grep cd echo
+		/usr/bin readonly local /usr/bin ${HOME} "$1" ${HOME}
+"$1" "$@" "$1" x=1 2>/dev/null cd then awk -eu done --verbose -eu -eu printf
+		local local | printf then 2>/dev/null && | "$@" echo 2>/dev/null
+/usr/bin grep ${HOME} awk x=1 && $(pwd) $(pwd) sed export grep
+	"$1" awk sed awk grep 'quoted text' export ${HOME}
+2>/dev/null sed grep /usr/bin -eu export x=1 x=1
+	printf cd local export done
+x=1 cd readonly "$@" printf && then
+local "$1" 'quoted text' local sed 2>/dev/null "$@" "$@" x=1 && export "$1" "$1"
+then 'quoted text' printf x=1 printf
+cd local cd printf readonly done
+	"$@" export 2>/dev/null export local /usr/bin
+2>/dev/null cd echo x=1 $(pwd) grep grep grep
+		x=1 && echo -eu 'quoted text' | echo
+	readonly /usr/bin 2>/dev/null ${HOME} done -eu && cd "$@" "$@" export cd
+	&& echo 2>/dev/null awk printf sed test
+		${HOME} then 2>/dev/null 'quoted text' done grep "$1"
+echo ${HOME} awk done cd | --verbose
+		'quoted text' export | "$@" "$@" &&
+	local x=1 readonly /usr/bin
+		'quoted text' sed -eu | "$1" 'quoted text' local echo 'quoted text'
+	test awk x=1 2>/dev/null export | sed readonly test export grep awk awk printf
+done cd && done echo then /usr/bin export ${HOME} echo && /usr/bin echo "$1"
+		local cd done | grep && "$1" cd readonly
+'quoted text' 'quoted text' -eu
+export echo 2>/dev/null grep $(pwd) readonly export
+		local "$@" ${HOME} cd -eu grep ${HOME} printf /usr/bin awk readonly awk "$@"
+	local 2>/dev/null cd 2>/dev/null && export then 'quoted text'
+	$(pwd) printf then 'quoted text' $(pwd) export x=1 ${HOME} 'quoted text' cd
+awk printf echo cd export 'quoted text' $(pwd) cd ${HOME} awk
+${HOME} | /usr/bin ${HOME} 'quoted text' export local echo sed export $(pwd)
+cd "$@" awk "$1" echo -eu test done awk | local test cd local |
+'quoted text' test then ${HOME} && $(pwd) 'quoted text'
+echo awk 2>/dev/null sed sed x=1 -eu x=1 test grep /usr/bin 'quoted text'
+$(pwd) && echo echo 'quoted text' "$@" export
+	"$@" awk -eu echo --verbose grep grep $(pwd) "$1" export cd local
+	"$1" $(pwd) grep export cd /usr/bin /usr/bin "$@" 2>/dev/null 'quoted text'
+	2>/dev/null sed done test printf then echo -eu readonly test
+sed 'quoted text' ${HOME} 'quoted text' /usr/bin x=1 awk printf -eu "$1"
+awk grep local 2>/dev/null
+awk cd 2>/dev/null $(pwd) echo && sed -eu 2>/dev/null local 'quoted text'
+	'quoted text' awk | -eu "$1" local printf done readonly export --verbose
+	awk grep sed then sed readonly ${HOME} "$1" then ${HOME} -eu x=1 local |
+	x=1 export printf test x=1 printf local test awk cd then awk x=1 sed sed
+		${HOME} cd "$@" echo echo test -eu printf grep test
+	&& -eu test awk echo 'quoted text'
+	'quoted text' export done | readonly 2>/dev/null |
+local test local /usr/bin done readonly
+	2>/dev/null export readonly local $(pwd) 2>/dev/null
+$(pwd) x=1 /usr/bin /usr/bin x=1 done test 2>/dev/null then cd | sed
+${HOME} $(pwd) $(pwd) x=1 | grep export -eu "$@" printf -eu cd 'quoted text'
+		${HOME} local cd grep grep x=1
+	'quoted text' "$1" -eu x=1 export local --verbose sed | export /usr/bin
+	--verbose --verbose export --verbose sed "$@" 2>/dev/null export
+	${HOME} cd | | grep && /usr/bin echo printf echo awk --verbose -eu
+		then done | x=1 printf $(pwd) 'quoted text'
+sed readonly then x=1 && -eu x=1 $(pwd) grep
+	$(pwd) then | printf done "$@" then then then $(pwd) $(pwd)
+	awk cd readonly grep sed sed x=1 local -eu
+/usr/bin test -eu echo $(pwd) printf test "$@" "$@" sed "$1" local then --verbose
+	| grep test grep readonly cd 'quoted text'
+		'quoted text' 2>/dev/null local | echo x=1 --verbose
+cd echo printf "$1" test test sed done --verbose done
+	"$@" ${HOME} $(pwd) x=1 grep awk cd
+	"$@" /usr/bin done /usr/bin readonly --verbose
+-eu ${HOME} "$@" test test && "$1" echo | sed 2>/dev/null
+		"$@" 'quoted text' cd /usr/bin cd --verbose ${HOME}
+awk echo grep readonly then echo x=1 readonly awk echo
+	done -eu --verbose && echo && local done printf x=1 cd 2>/dev/null
+	/usr/bin grep /usr/bin awk "$@" test awk && x=1 awk sed export -eu then
+		| && awk $(pwd) local -eu printf local 'quoted text' $(pwd)
+	echo export "$1" echo $(pwd) echo /usr/bin
+	"$@" grep done done -eu 'quoted text' "$1" --verbose "$1" --verbose then
+		/usr/bin grep export then 2>/dev/null && "$1" sed 'quoted text' --verbose
+		"$@" ${HOME} export ${HOME} && test -eu printf 'quoted text' cd
+		echo cd "$1" 2>/dev/null $(pwd) $(pwd)
+	| "$@" $(pwd) | readonly grep &&
+		| "$1" sed readonly 2>/dev/null readonly
+x=1 readonly 'quoted text' 2>/dev/null sed then
+	sed echo test done x=1 awk local export 2>/dev/null 2>/dev/null then grep
+"$@" awk then "$1" awk local --verbose
+	$(pwd) x=1 -eu local /usr/bin
+		grep export then export "$1" readonly 'quoted text' | $(pwd) "$1" && then readonly
+		-eu $(pwd) "$1" && sed --verbose grep 'quoted text'
+		readonly $(pwd) done export "$@" | grep then -eu
+	awk printf printf $(pwd) ${HOME} test test $(pwd) sed local cd awk
+"$1" awk 2>/dev/null ${HOME}
+export x=1 test readonly | test readonly echo export grep $(pwd) $(pwd)
+		printf printf then 2>/dev/null
+	/usr/bin -eu sed test then "$1"
+then -eu sed cd | cd --verbose --verbose -eu && --verbose "$@" test then readonly
+		export "$1" readonly | grep test printf 2>/dev/null "$@" readonly $(pwd)
+	--verbose /usr/bin test /usr/bin local "$@" x=1 test done
+	done x=1 cd readonly -eu echo "$1"
+	local $(pwd) then 'quoted text' -eu local printf sed export echo x=1
+readonly cd grep | "$1" cd 2>/dev/null export | done
+grep test done "$1" echo ${HOME}
+	| -eu then cd --verbose export
+		export printf 'quoted text' "$@" $(pwd) x=1
+	test grep --verbose -eu readonly readonly -eu --verbose $(pwd)
+-eu "$@" | awk x=1 awk test readonly printf local awk sed grep "$@"
+done grep && $(pwd) 2>/dev/null sed x=1 local awk --verbose
+	x=1 done echo -eu x=1 done $(pwd) done
+readonly $(pwd) then "$@" "$@" readonly && x=1 readonly
+	--verbose -eu /usr/bin echo test
+		local printf "$@" 'quoted text'
+	${HOME} sed $(pwd) /usr/bin 'quoted text' done sed cd "$@" --verbose grep echo 2>/dev/null
+		"$1" test "$1" ${HOME} done local "$@" | $(pwd)
+	${HOME} | x=1 2>/dev/null awk local awk local --verbose $(pwd)
+		${HOME} local /usr/bin test | -eu awk --verbose "$@" then 2>/dev/null 2>/dev/null
+		${HOME} --verbose test 'quoted text' 2>/dev/null 'quoted text'
+	done test --verbose x=1
+		-eu export x=1 $(pwd) ${HOME} sed local $(pwd) echo $(pwd) "$@" local echo
+	then | | /usr/bin export done
+	done sed sed -eu x=1 x=1 x=1 printf --verbose
+awk cd then /usr/bin printf
+	readonly sed 2>/dev/null test
+	/usr/bin 2>/dev/null ${HOME} done 'quoted text' sed && echo /usr/bin
+	cd $(pwd) then -eu x=1 grep ${HOME} "$@" export echo awk
+		-eu $(pwd) readonly printf
+| && --verbose "$@" done "$1" "$1" local readonly printf local then
+		then "$1" readonly then
+	"$1" done $(pwd) /usr/bin 'quoted text' cd ${HOME}
+local 'quoted text' /usr/bin
+	| echo --verbose sed
+-eu readonly 2>/dev/null grep printf
+		x=1 echo export cd 'quoted text'
+	test echo printf test -eu
+		test awk | 2>/dev/null && /usr/bin x=1 "$1" ${HOME} awk
+		${HOME} 2>/dev/null grep echo grep export echo && && 'quoted text' /usr/bin
+	'quoted text' printf grep | grep -eu done done x=1 printf 2>/dev/null
+		"$1" $(pwd) sed ${HOME} done
+"$@" 2>/dev/null "$1" awk done echo done "$1" ${HOME} | x=1
+	2>/dev/null --verbose $(pwd) sed echo awk 'quoted text'
+	done printf /usr/bin -eu --verbose
+	"$@" grep sed then | "$@" then echo /usr/bin echo then ${HOME} /usr/bin
+	"$@" printf "$1" then "$@" x=1 2>/dev/null
+		'quoted text' 2>/dev/null 'quoted text' grep sed printf local ${HOME}
+| "$@" test x=1 --verbose local echo cd --verbose then "$1" readonly then
+	-eu echo --verbose export grep readonly awk echo awk readonly
+local x=1 awk test "$@" "$1" --verbose local
+		local | "$@" /usr/bin "$@"
+		test export "$@" -eu then awk
+	| readonly echo printf awk readonly
+	sed grep 2>/dev/null local sed "$1" awk 2>/dev/null
+	| /usr/bin printf test readonly --verbose export done "$@" local /usr/bin
+printf 2>/dev/null grep ${HOME} | cd /usr/bin
+		cd readonly local export --verbose
+then export grep local $(pwd) echo printf "$@" -eu cd
+	cd then readonly sed 'quoted text' awk awk
+grep done printf sed
+	printf && 2>/dev/null local $(pwd) --verbose
+	"$1" 2>/dev/null echo cd "$@" awk local $(pwd) grep && then then cd -eu
+		echo "$@" x=1 && done ${HOME} 'quoted text' awk "$1"
+test echo 2>/dev/null grep 'quoted text'
+		printf 2>/dev/null printf export
+		'quoted text' 'quoted text' local echo -eu "$@" "$1" echo ${HOME}
+		$(pwd) readonly "$@" then | export done "$1" local readonly
+done echo done readonly echo "$@" export export
+		$(pwd) 2>/dev/null awk --verbose awk -eu echo $(pwd)
+	/usr/bin x=1 "$@" local $(pwd) | sed "$@" "$@" echo "$@" readonly
+$(pwd) awk export test sed readonly
+	export "$@" 'quoted text' done readonly
+	$(pwd) grep readonly "$1" readonly -eu echo ${HOME} local --verbose 2>/dev/null
+cd awk echo awk sed && x=1 && ${HOME} "$1" export readonly awk grep
+sed done done readonly
+	/usr/bin -eu $(pwd) readonly export echo printf "$@"
+grep export cd then readonly grep "$@" 2>/dev/null awk done 'quoted text'
+		/usr/bin test && readonly
+then --verbose readonly /usr/bin readonly cd "$1" "$@" "$@" /usr/bin local
+		/usr/bin awk && done "$1" && export awk | printf echo then
+	"$1" sed awk 'quoted text' --verbose -eu "$@" $(pwd) x=1 --verbose
+		cd echo x=1 sed $(pwd) echo --verbose awk export printf && "$@" -eu x=1 echo
+	readonly -eu done awk -eu -eu ${HOME} done /usr/bin
+then --verbose readonly grep 'quoted text'
+awk cd then 2>/dev/null "$@" | local "$1" -eu cd "$@" 2>/dev/null
+	&& x=1 ${HOME} sed "$1" grep 'quoted text'
+x=1 done $(pwd) awk readonly grep then printf awk echo
+	x=1 ${HOME} "$@" grep cd x=1 done 'quoted text' then /usr/bin
+		${HOME} then readonly --verbose
+grep grep cd test 2>/dev/null "$@" 'quoted text' "$1"
+	-eu echo done -eu cd ${HOME} "$@"
+	printf ${HOME} cd 2>/dev/null printf && echo x=1 2>/dev/null && 'quoted text'
+		2>/dev/null 2>/dev/null ${HOME} test done cd -eu sed &&
+		${HOME} done sed grep | awk && $(pwd) export "$@" then
+2>/dev/null printf sed printf $(pwd) readonly x=1 && 2>/dev/null then test
+$(pwd) $(pwd) -eu awk
+	test $(pwd) $(pwd) | cd sed printf /usr/bin -eu $(pwd) done
+test sed x=1 printf /usr/bin /usr/bin /usr/bin && -eu 'quoted text' x=1 -eu
+| cd grep then then x=1 awk 'quoted text'
+		echo --verbose | "$@" test export export export awk x=1 cd echo "$@"
+		--verbose then export -eu 2>/dev/null
+	test /usr/bin then "$@" | "$@" /usr/bin test 'quoted text'
+-eu done awk test ${HOME} echo --verbose -eu --verbose export |
+-eu x=1 grep readonly cd 2>/dev/null
+awk | cd readonly awk "$1" export echo printf ${HOME}
+		'quoted text' export ${HOME} sed $(pwd) | cd | export x=1 2>/dev/null
+readonly $(pwd) -eu local done -eu echo awk local awk && 2>/dev/null --verbose
+'quoted text' echo cd x=1 local test 'quoted text' x=1 export awk ${HOME}
+test export echo cd | readonly echo $(pwd)
+/usr/bin 2>/dev/null test "$1" ${HOME} | printf
+grep $(pwd) "$1" -eu -eu sed sed --verbose readonly && x=1 x=1 sed printf "$@"
+cd 'quoted text' local readonly sed "$@" 'quoted text'
+'quoted text' "$1" "$@" "$1"
+"$@" x=1 | ${HOME} local then ${HOME}
+		readonly export ${HOME} -eu --verbose printf sed
+	x=1 ${HOME} 'quoted text' && sed test printf readonly "$@"
+		local awk $(pwd) && awk sed cd
+grep sed --verbose x=1 export --verbose readonly && printf -eu echo
+-eu echo then 2>/dev/null 2>/dev/null awk
+	"$1" 'quoted text' echo "$1"
+		printf sed cd "$@" | export --verbose export grep
+echo 'quoted text' && readonly
+		awk printf -eu echo /usr/bin | export --verbose $(pwd) "$@" grep
+then sed "$@" 2>/dev/null "$@" test awk sed readonly
+		then && echo /usr/bin export printf done && x=1 readonly
+-eu then grep --verbose test /usr/bin 'quoted text' 'quoted text' /usr/bin
+then "$@" then local printf local
+"$1" printf 'quoted text' readonly
+		"$@" 2>/dev/null -eu ${HOME}
+		$(pwd) cd local x=1 "$1" printf
+--verbose --verbose -eu readonly |
+		export ${HOME} done local
+	awk -eu test 2>/dev/null grep test "$1" ${HOME}
+		export ${HOME} sed --verbose then && sed echo grep export
+		then grep | printf 'quoted text'
+readonly 'quoted text' test test -eu cd $(pwd) local && | echo
+	readonly --verbose --verbose
+	printf readonly "$1" ${HOME}
+-eu ${HOME} echo grep "$@" echo readonly readonly export
+		2>/dev/null sed printf ${HOME} --verbose test readonly ${HOME} sed | echo 'quoted text'
+	'quoted text' awk "$@" done /usr/bin -eu local sed &&
+		| local readonly | x=1 $(pwd) /usr/bin "$1" printf export
+	done ${HOME} "$@" "$@" | cd "$@" ${HOME}
+"$@" 2>/dev/null -eu 2>/dev/null sed echo echo done 2>/dev/null
+'quoted text' -eu 2>/dev/null | cd "$@" | grep awk
+		printf done then readonly 2>/dev/null
+		x=1 && grep cd test -eu 'quoted text' $(pwd)
+	${HOME} sed awk grep export awk 2>/dev/null -eu "$1" 2>/dev/null then
+		'quoted text' done /usr/bin local grep ${HOME} printf echo export cd "$1"
+	&& -eu readonly readonly then && && printf
+local /usr/bin echo x=1
+		echo 2>/dev/null /usr/bin readonly -eu "$@"
+	cd then grep cd readonly $(pwd) export grep
+		--verbose | -eu printf test --verbose grep cd
+	"$@" awk --verbose $(pwd) --verbose sed printf 2>/dev/null "$1"
+	sed then export x=1 done export
+	"$1" 2>/dev/null -eu local test --verbose /usr/bin
+		awk echo 2>/dev/null 2>/dev/null export
+		test awk printf done test "$@" ${HOME} cd && local done printf ${HOME} "$@" 2>/dev/null
+then /usr/bin /usr/bin | $(pwd) grep 'quoted text' && 2>/dev/null "$@" &&
+	"$1" then test x=1 --verbose && $(pwd) "$@"
+x=1 sed readonly /usr/bin | done readonly -eu -eu
+		${HOME} "$1" cd -eu test export x=1
+	readonly "$@" "$@" echo readonly sed printf printf "$@" /usr/bin grep --verbose
+--verbose --verbose test "$1" sed && ${HOME} -eu export
+awk export "$1" $(pwd) | 2>/dev/null readonly readonly && ${HOME}
+	then test --verbose awk test ${HOME}
+		then printf x=1 grep x=1 test echo "$1" local -eu 'quoted text' cd done done
+		echo cd "$1" then --verbose done /usr/bin echo
+		echo $(pwd) readonly echo printf
+	/usr/bin -eu $(pwd) | test "$1" --verbose "$1"
+		'quoted text' done ${HOME} "$1" --verbose export -eu then
+	then -eu cd ${HOME} export then --verbose grep | echo done
+export | "$@" local test local 'quoted text'
+		${HOME} echo $(pwd) test sed | sed printf done
+export sed ${HOME} cd $(pwd)
+		readonly awk x=1 test 2>/dev/null then && sed x=1 test /usr/bin ${HOME}
+done $(pwd) /usr/bin readonly 'quoted text'
+	"$1" ${HOME} "$1" echo $(pwd) cd local
+printf awk x=1 cd awk test
+		then "$1" local readonly
+		--verbose then done awk
+"$@" | then x=1 sed $(pwd) test sed "$1" export sed readonly 'quoted text' cd
+		"$@" cd /usr/bin -eu "$1"
+	2>/dev/null export readonly /usr/bin | -eu cd printf 'quoted text'
+then /usr/bin -eu printf awk "$@" ${HOME} | "$@" cd printf |
+	--verbose grep --verbose "$1" && && | export
+		-eu readonly ${HOME} | printf 2>/dev/null
+		'quoted text' $(pwd) -eu ${HOME} --verbose
+${HOME} && readonly 'quoted text' 'quoted text'
+	awk cd && export grep test
+		${HOME} done $(pwd) "$1" printf -eu ${HOME}
+	printf sed test "$@" printf --verbose ${HOME} printf | printf
+		'quoted text' "$1" "$1" "$1" readonly --verbose |
+	grep /usr/bin 'quoted text' export $(pwd) 'quoted text' -eu -eu
+2>/dev/null sed printf --verbose
+		-eu --verbose 'quoted text' local /usr/bin && x=1 && && "$1"
+echo echo 2>/dev/null ${HOME}
+	'quoted text' "$@" grep
+		/usr/bin echo -eu 2>/dev/null
+grep 2>/dev/null | | 2>/dev/null readonly printf grep | local test
+		sed sed x=1 export local readonly sed
+		then $(pwd) "$@" 'quoted text' 2>/dev/null ${HOME} test
+		"$1" | awk then readonly && awk ${HOME} awk
+echo local echo --verbose cd readonly local printf test 'quoted text'
+	awk 'quoted text' done | grep "$1" && --verbose echo "$1" local --verbose
+		grep cd --verbose "$@" local "$@" grep sed $(pwd)
+readonly -eu readonly 'quoted text' && test grep -eu done done printf
+		done 'quoted text' export awk | then export
+		&& && local $(pwd) test done sed 2>/dev/null test echo
+	then export local 'quoted text' -eu $(pwd) grep "$@" echo "$1" && ${HOME}
+cd local then grep grep local grep printf && "$1" x=1
+	2>/dev/null export 'quoted text' done done
+--verbose then sed ${HOME} local x=1 'quoted text' grep sed 'quoted text'
+		'quoted text' | sed x=1 awk $(pwd) test /usr/bin x=1 echo
+	echo ${HOME} awk x=1 "$@" -eu $(pwd) 2>/dev/null
+		then then /usr/bin "$1" grep echo echo x=1 | test "$1"
+	2>/dev/null "$1" "$@" x=1 grep awk && export
+		echo -eu done export readonly
+		/usr/bin /usr/bin done "$1" printf then -eu
+		echo $(pwd) 'quoted text' -eu grep test 2>/dev/null --verbose
+echo grep grep cd -eu --verbose local
+		'quoted text' 'quoted text'
+		--verbose printf readonly $(pwd)
+	test "$1" "$@" export ${HOME} grep then cd awk && 2>/dev/null export
+		${HOME} && $(pwd) /usr/bin cd local local local --verbose printf 'quoted text'
+	${HOME} 'quoted text' then | /usr/bin && | grep $(pwd) echo "$1" awk 'quoted text'
+		-eu done 'quoted text'
+-eu sed readonly printf sed -eu 2>/dev/null /usr/bin sed -eu -eu sed
+test 'quoted text' grep grep sed x=1 awk "$1" 'quoted text' test | 'quoted text'
+		"$@" 'quoted text' x=1 --verbose -eu 'quoted text'
+		echo "$1" test awk 2>/dev/null printf
+	sed 2>/dev/null local awk x=1 | /usr/bin "$1" printf "$1" $(pwd) "$@"
+		-eu awk | grep --verbose readonly "$1" test 'quoted text' 2>/dev/null printf
+		"$1" printf local cd 2>/dev/null
+/usr/bin $(pwd) readonly $(pwd) -eu awk echo "$@" && echo then grep local
+2>/dev/null sed done x=1 /usr/bin awk /usr/bin then
+	$(pwd) sed && test 2>/dev/null
+	"$@" test echo awk /usr/bin -eu grep awk "$@" "$@"
+2>/dev/null readonly && 2>/dev/null && test $(pwd) | "$@" $(pwd) | cd printf export
+/usr/bin echo 'quoted text' cd x=1 awk 2>/dev/null awk
+	x=1 && && $(pwd) test "$@" cd grep /usr/bin done "$@"
+	'quoted text' printf /usr/bin
+	2>/dev/null printf 'quoted text'
+readonly x=1 && export sed export x=1 2>/dev/null x=1
+		| export done echo && --verbose grep && /usr/bin ${HOME}
+"$1" then cd "$1" cd readonly ${HOME} "$1" $(pwd) local
+sed done x=1 printf printf echo /usr/bin -eu 2>/dev/null "$@" test x=1 awk
+test | /usr/bin then readonly then printf export cd awk 2>/dev/null
+sed --verbose echo cd echo done
+	done test "$1" 'quoted text' | -eu 'quoted text' cd "$@" test /usr/bin "$1"
+		--verbose "$1" grep done done cd grep /usr/bin
+		-eu --verbose 2>/dev/null test grep "$1"
+	readonly ${HOME} test export printf readonly --verbose sed -eu
+local 'quoted text' export 2>/dev/null 2>/dev/null done /usr/bin readonly
+	awk -eu -eu echo printf done grep
+2>/dev/null -eu ${HOME} echo sed grep then | /usr/bin --verbose
+	&& "$1" printf echo x=1 local cd awk 'quoted text' local
+		--verbose readonly /usr/bin 'quoted text'
+awk echo echo 'quoted text' readonly | cd | then then grep local printf |
+	export -eu 2>/dev/null x=1 "$@" printf 2>/dev/null
+${HOME} awk done 2>/dev/null awk done 'quoted text'
+		"$1" grep --verbose test done | done
+	$(pwd) "$1" printf readonly $(pwd)
+		--verbose cd "$@" grep $(pwd) "$@" $(pwd) export 2>/dev/null local
+		echo | sed awk /usr/bin printf
+${HOME} awk export local ${HOME} echo local -eu --verbose -eu grep x=1 echo
+x=1 then then then "$1" -eu
+${HOME} awk grep local x=1
+/usr/bin readonly then $(pwd) x=1 cd awk local
+cd done local then "$@" "$@" printf /usr/bin 'quoted text'
+then ${HOME} x=1 cd then
+local ${HOME} 'quoted text' "$1" ${HOME} 'quoted text' awk $(pwd) --verbose
+		echo awk x=1 test echo && test && ${HOME} cd awk $(pwd) /usr/bin then sed
+		"$@" cd awk "$@" sed "$1" 2>/dev/null cd --verbose $(pwd) awk | && cd
+		"$1" "$@" cd && printf grep
+		$(pwd) x=1 echo $(pwd) grep sed $(pwd) cd 2>/dev/null
+printf test /usr/bin "$1" | x=1 grep echo -eu 2>/dev/null
+		$(pwd) | awk 2>/dev/null x=1
+		then | -eu sed $(pwd) ${HOME}
+	done 'quoted text' cd then cd x=1 then -eu grep $(pwd) grep
+		cd sed echo --verbose | && && sed 'quoted text' export grep echo ${HOME} 2>/dev/null
+		printf $(pwd) /usr/bin local readonly echo "$@" local
+readonly /usr/bin 'quoted text' "$@" 2>/dev/null sed printf done
+	"$1" 'quoted text' -eu ${HOME} test "$1"
+	done sed grep then export ${HOME} echo 'quoted text' | /usr/bin "$1" cd echo
+grep "$@" /usr/bin x=1 /usr/bin done then
+		${HOME} then test readonly -eu done grep x=1 done 'quoted text' echo --verbose
+export /usr/bin awk && echo test x=1 sed then ${HOME} --verbose done grep
+		2>/dev/null $(pwd) readonly export --verbose awk | $(pwd)
+		${HOME} sed /usr/bin cd 'quoted text'
+/usr/bin readonly "$1" local "$1" printf readonly then -eu -eu 2>/dev/null
+		--verbose /usr/bin printf
+		$(pwd) export awk awk readonly $(pwd) printf "$@" export "$@" printf
+		test done local /usr/bin --verbose export test local ${HOME} readonly
+2>/dev/null | 'quoted text' printf then | && 2>/dev/null readonly
+/usr/bin x=1 awk sed readonly | local echo | local --verbose x=1 | $(pwd) 2>/dev/null
+		grep sed done --verbose done /usr/bin $(pwd) "$1"
+"$1" "$@" local x=1 "$1" grep x=1 grep grep test grep readonly sed ${HOME}
+	local awk && 'quoted text' "$1" && done local
+		export --verbose test "$@" | 'quoted text' x=1 awk -eu printf && done cd
+then done 2>/dev/null cd sed readonly --verbose
+"$@" 2>/dev/null echo
+sed sed "$1" test | export done -eu done local test done
+	then x=1 $(pwd) && -eu export 2>/dev/null x=1
+		-eu 'quoted text' 'quoted text' 2>/dev/null
+awk -eu | test /usr/bin ${HOME} --verbose then -eu $(pwd) 'quoted text' | /usr/bin
+	-eu readonly grep /usr/bin | local x=1 cd test
+	/usr/bin /usr/bin printf sed grep done "$@" && x=1 awk done
+	$(pwd) awk awk export grep local done /usr/bin export x=1 awk export
+	printf readonly export echo "$1" awk export "$@" /usr/bin -eu $(pwd)
+local "$@" ${HOME} --verbose grep readonly -eu printf local printf
+&& readonly then done 'quoted text' done cd -eu ${HOME} ${HOME} /usr/bin "$1" awk
+		2>/dev/null export cd $(pwd) test printf awk 2>/dev/null test
+	then printf /usr/bin awk --verbose printf
+${HOME} 2>/dev/null test awk sed /usr/bin && test 2>/dev/null
+	then "$1" echo -eu ${HOME} awk -eu && test echo --verbose x=1 grep -eu x=1
+	export "$@" 'quoted text' awk done /usr/bin
+	"$@" --verbose done printf && $(pwd) ${HOME} grep sed
+	"$@" "$@" then --verbose printf readonly /usr/bin
+	$(pwd) echo && awk --verbose 'quoted text' test "$@" && "$1" | awk $(pwd)
+| ${HOME} $(pwd) "$1" $(pwd) && x=1 2>/dev/null done echo x=1 grep
+sed "$1" done --verbose cd export ${HOME} &&
+sed $(pwd) 2>/dev/null -eu then test /usr/bin
+		then -eu "$@" ${HOME} ${HOME} printf test awk $(pwd) test
+"$1" awk | 2>/dev/null grep 2>/dev/null --verbose "$@" test x=1 --verbose
+	sed 2>/dev/null "$1" $(pwd) test "$@" done then $(pwd) &&
+		-eu export -eu -eu cd -eu $(pwd) then "$1" $(pwd) done
+	x=1 done readonly readonly -eu printf export echo done
+sed --verbose -eu $(pwd) "$1" 2>/dev/null "$1"
+		local grep 2>/dev/null cd awk
+'quoted text' awk "$1" $(pwd) $(pwd) $(pwd) $(pwd) | 'quoted text'
+		${HOME} 2>/dev/null x=1 export -eu readonly /usr/bin
+cd sed printf && test cd --verbose "$1" /usr/bin awk
+grep then 2>/dev/null && x=1 x=1 $(pwd) /usr/bin $(pwd) readonly x=1 -eu "$1" local
+	readonly cd then /usr/bin sed $(pwd) readonly /usr/bin
+		export x=1 ${HOME} "$1" printf local local "$@" /usr/bin
+		| done 2>/dev/null $(pwd) | awk
+-eu readonly export | 'quoted text' x=1 awk printf /usr/bin x=1
+	printf sed | "$1" 2>/dev/null awk
+	/usr/bin cd done cd |
+	$(pwd) -eu echo cd echo | /usr/bin --verbose printf | ${HOME} && $(pwd) then
+	${HOME} export readonly "$@" printf readonly readonly $(pwd)
+		readonly grep ${HOME} then /usr/bin echo 2>/dev/null printf 2>/dev/null awk $(pwd)
+	readonly sed done cd printf 'quoted text' local 2>/dev/null "$1" test
+grep done readonly grep | /usr/bin /usr/bin /usr/bin
+	--verbose 2>/dev/null && sed $(pwd) grep 'quoted text' printf
+test sed awk local printf 'quoted text' /usr/bin
+&& | grep printf echo sed $(pwd) | readonly 'quoted text'
+&& echo readonly then 'quoted text' $(pwd) cd --verbose then readonly
+printf sed done x=1 echo
+		printf "$@" "$1" --verbose 2>/dev/null x=1 --verbose "$1" --verbose local "$1"
+		printf /usr/bin "$@" local readonly
+		local done 2>/dev/null readonly
+test export && done done
+	local echo ${HOME} export "$@"
+	grep done export then -eu awk
+test done done 2>/dev/null 2>/dev/null readonly "$1" awk printf
+		printf grep readonly export test grep done then sed readonly ${HOME} | "$1"
+	"$1" test cd /usr/bin 2>/dev/null export local
+		echo 'quoted text' x=1 readonly
+-eu done x=1 && 2>/dev/null local && /usr/bin
+	/usr/bin test $(pwd) ${HOME}
+	| -eu -eu grep -eu 2>/dev/null "$@" --verbose
+/usr/bin ${HOME} $(pwd) ${HOME} echo && -eu
+${HOME} then grep then $(pwd)
+-eu x=1 done x=1 /usr/bin 2>/dev/null --verbose awk 'quoted text' $(pwd)
+	test $(pwd) $(pwd) echo --verbose cd test done grep 'quoted text' | /usr/bin
+		readonly echo | export grep sed grep cd 2>/dev/null sed | ${HOME}
+		readonly echo readonly grep readonly local
+	2>/dev/null cd echo ${HOME} export $(pwd) local &&
+sed "$@" done --verbose 2>/dev/null
+	sed grep grep readonly "$1" awk ${HOME} then "$1" test && /usr/bin
+		printf test | export printf cd 2>/dev/null 'quoted text' --verbose grep $(pwd)
+/usr/bin "$@" "$@" echo && then grep -eu && test
+		| -eu local 'quoted text'
+		/usr/bin awk x=1 readonly grep grep sed 'quoted text' /usr/bin
+		printf echo --verbose && /usr/bin
+		--verbose $(pwd) printf awk then | --verbose grep
+"$1" echo 2>/dev/null x=1 'quoted text' -eu echo printf readonly test
+		'quoted text' export echo test test done 'quoted text' done && cd --verbose
+		export x=1 readonly /usr/bin 2>/dev/null awk "$1" && echo
+test awk then grep readonly 2>/dev/null export echo | test grep
+	sed && awk echo "$1" export sed awk
+'quoted text' | sed "$@" grep && sed echo then export
+		awk echo --verbose $(pwd) done grep -eu printf local /usr/bin "$@" /usr/bin
+	&& printf --verbose then | cd --verbose then "$@" grep 'quoted text'
+		then sed 'quoted text' then
+	"$@" sed x=1 export awk export x=1 local echo | sed /usr/bin
+	printf test done export done "$1" -eu readonly
+		readonly done -eu then grep sed -eu "$@" --verbose && 'quoted text'
+	&& test test readonly -eu echo export /usr/bin 'quoted text'
+2>/dev/null cd sed sed
+	readonly 2>/dev/null grep printf "$1" "$1" grep done grep ${HOME}
+		printf export echo test grep 2>/dev/null
+		$(pwd) printf x=1 export cd
+	readonly export printf grep echo
+		export echo grep cd "$1" local local done $(pwd) ${HOME}
+	-eu awk ${HOME} 'quoted text' cd "$1" "$1" "$1" 2>/dev/null
+done export done grep /usr/bin
+	$(pwd) -eu x=1 -eu 2>/dev/null 'quoted text'
+		2>/dev/null && && --verbose
+		"$1" cd readonly cd /usr/bin export "$1" readonly -eu -eu test && "$1" cd x=1
+		${HOME} && $(pwd) -eu
+		2>/dev/null then test done x=1 | /usr/bin printf 'quoted text'
+$(pwd) echo readonly awk
+	printf export awk "$1" 'quoted text' && 'quoted text' local printf
+printf sed --verbose 2>/dev/null sed grep awk sed export
+	cd readonly echo ${HOME} then && then export 'quoted text' then export done
+	awk 2>/dev/null 2>/dev/null x=1 export export
+		/usr/bin echo --verbose printf /usr/bin printf x=1
+local awk "$1" "$@" x=1 then "$@" x=1 /usr/bin local && /usr/bin x=1 "$@" x=1
+		&& -eu 'quoted text' test echo cd -eu export grep printf "$1" then ${HOME}
+		printf test grep --verbose
+		| --verbose local sed readonly export echo 'quoted text' awk printf
+/usr/bin export grep -eu
+echo 'quoted text' "$@" grep then sed
+	local --verbose local && export -eu 'quoted text' /usr/bin
+	'quoted text' test | "$1" 2>/dev/null /usr/bin local "$@"
+	"$@" grep test && test $(pwd) $(pwd) ${HOME} x=1 export readonly
+x=1 "$1" /usr/bin awk test echo cd | --verbose cd ${HOME}
+readonly "$1" local printf $(pwd) readonly export sed "$@" 'quoted text'
+	sed ${HOME} test grep "$@" /usr/bin && 2>/dev/null
+	sed ${HOME} cd --verbose local 'quoted text'
+	'quoted text' "$@" awk grep ${HOME} grep awk 'quoted text' -eu "$1"
+2>/dev/null echo "$1" /usr/bin done grep &&
+		| test && 2>/dev/null -eu | grep cd awk $(pwd) 'quoted text' readonly
+readonly --verbose 'quoted text' ${HOME} export /usr/bin then x=1 'quoted text'
+	local "$1" $(pwd) then local printf cd /usr/bin /usr/bin done then then export
+		cd $(pwd) test local x=1 /usr/bin
+		"$@" test local x=1 export ${HOME} $(pwd) sed
+		grep /usr/bin "$1" done done printf sed "$1" && | $(pwd) grep 'quoted text'
+		x=1 export cd "$1" test export $(pwd)
+	done test "$@" | --verbose awk $(pwd) test | 'quoted text' /usr/bin
+--verbose local | 'quoted text' readonly "$1" grep "$@" "$@" export x=1
+		--verbose 2>/dev/null x=1 readonly local grep | $(pwd) --verbose $(pwd)
+grep "$@" "$1" "$@" echo
+&& done -eu export "$@" grep cd
+local local export export "$@" grep sed grep export echo
+echo test echo 2>/dev/null /usr/bin echo test readonly
+	cd && x=1 "$1" export
+--verbose done done echo $(pwd) echo -eu x=1 grep then awk sed "$1" readonly awk
+	readonly ${HOME} then printf readonly echo --verbose /usr/bin x=1 awk "$1"
+$(pwd) echo --verbose
+		-eu && -eu --verbose 2>/dev/null /usr/bin "$1"
+	echo $(pwd) | $(pwd) -eu readonly sed echo 2>/dev/null
+		awk x=1 sed && --verbose "$1" ${HOME} grep x=1 grep "$1" -eu "$@" then test
+		local 2>/dev/null "$@" && printf ${HOME} 'quoted text' $(pwd) cd printf then
+		echo | export ${HOME} |
+		'quoted text' 2>/dev/null && awk export awk x=1 readonly then 'quoted text'
+		&& && done | cd 2>/dev/null 2>/dev/null grep then test readonly awk readonly
+--verbose echo then "$1" 'quoted text' test grep
+	readonly awk -eu ${HOME} awk done export 2>/dev/null export
+		/usr/bin local ${HOME} 'quoted text' grep grep readonly
+$(pwd) x=1 'quoted text' echo grep | awk "$@" echo
+done -eu printf sed then sed "$@" 2>/dev/null "$@" /usr/bin sed
+		--verbose export "$@" awk test then readonly --verbose
+	-eu done readonly awk
+		readonly ${HOME} echo echo $(pwd) printf && /usr/bin ${HOME} then sed
+		'quoted text' export then "$@" readonly 2>/dev/null then --verbose
+x=1 awk "$1" "$@" "$1" x=1 grep ${HOME} 2>/dev/null then local
+'quoted text' 'quoted text' cd x=1 done test cd "$1" ${HOME} ${HOME} x=1 $(pwd)
+		&& export sed --verbose | echo
+	awk sed export | grep awk awk 'quoted text' then local $(pwd) echo printf done
+		2>/dev/null x=1 echo sed
+	-eu 2>/dev/null local --verbose test readonly && ${HOME} echo && ${HOME}
+"$1" ${HOME} x=1 "$1" -eu x=1 "$1"
+	readonly printf "$@" test export "$@" 2>/dev/null
+	readonly "$1" -eu cd cd awk sed $(pwd) x=1 readonly 'quoted text'
+		x=1 done awk -eu ${HOME} awk --verbose
+	-eu "$1" local printf -eu --verbose awk then /usr/bin then local --verbose
+		"$@" --verbose 2>/dev/null test
+| 'quoted text' cd | done sed sed /usr/bin local readonly
+sed echo awk printf 2>/dev/null
+$(pwd) readonly -eu "$@" grep -eu 2>/dev/null | readonly 'quoted text' x=1
+		--verbose local awk "$1" 2>/dev/null
+		'quoted text' cd --verbose 'quoted text' $(pwd) "$1" local 'quoted text'
+		test cd cd x=1 readonly "$1" awk local printf x=1 'quoted text'
+		local 'quoted text' "$@" 'quoted text' echo "$@" ${HOME}
+	&& 2>/dev/null readonly --verbose
+test 2>/dev/null sed x=1 readonly local export --verbose
+	&& /usr/bin cd --verbose printf
+		test printf readonly $(pwd) $(pwd) echo awk "$1" && echo
+		local export --verbose sed done ${HOME} -eu $(pwd) export test && | "$1"
+	then echo && /usr/bin grep /usr/bin $(pwd) printf -eu x=1 sed
+printf | x=1 'quoted text' readonly 2>/dev/null
+	readonly /usr/bin done && -eu cd $(pwd) && cd test local ${HOME} cd test sed |
+	printf $(pwd) printf --verbose cd awk 2>/dev/null export 'quoted text' then
+	export local && | /usr/bin test readonly printf grep
+sed | awk --verbose --verbose
+		$(pwd) 'quoted text' cd cd /usr/bin cd sed /usr/bin 'quoted text' "$1" --verbose
+printf printf export awk x=1
+		grep export $(pwd) test x=1 /usr/bin awk && /usr/bin
+&& awk printf 2>/dev/null then done printf grep --verbose
+	$(pwd) "$@" /usr/bin grep cd sed
+x=1 echo test && /usr/bin then --verbose "$1" local readonly done export 2>/dev/null
+		echo readonly $(pwd) x=1 'quoted text' x=1 then sed cd printf local readonly
+	${HOME} grep x=1 /usr/bin 'quoted text' "$@"
+	local x=1 local export test 2>/dev/null test cd cd /usr/bin
+		'quoted text' readonly cd "$@"
+		cd echo test cd readonly "$@" local done readonly cd echo sed printf
+"$@" sed -eu x=1 printf readonly awk then test 'quoted text'
+		then x=1 ${HOME} sed sed then
+	'quoted text' export readonly
+	/usr/bin -eu then "$1" "$@" | awk
+printf printf cd x=1 sed sed readonly export --verbose echo
+		'quoted text' cd 2>/dev/null
+local awk done "$@" grep /usr/bin test grep readonly done then then
+| test echo 'quoted text' then cd echo
+printf export -eu test readonly 'quoted text' ${HOME} -eu readonly
+		$(pwd) test local $(pwd) -eu sed --verbose --verbose
+		readonly test echo grep local grep test
+	local sed /usr/bin export 'quoted text'
+	export export done readonly 'quoted text' awk export /usr/bin
+	readonly awk awk cd readonly then readonly
+		printf $(pwd) echo grep done local |
+		readonly sed printf /usr/bin /usr/bin awk "$@" ${HOME}
+echo sed grep $(pwd) 2>/dev/null grep local x=1 done local
+	2>/dev/null ${HOME} awk 'quoted text' cd --verbose -eu readonly x=1 printf "$1"
+		awk test awk 'quoted text' ${HOME} readonly done
+		cd grep export /usr/bin
+	$(pwd) local cd ${HOME} &&
+	cd x=1 'quoted text' cd done then cd "$1" export --verbose echo
+--verbose printf printf | | 'quoted text' export "$1" grep done
+		test 'quoted text' "$1" echo
+then && sed 2>/dev/null grep "$@" printf | x=1 awk grep 2>/dev/null readonly
+		&& printf ${HOME} ${HOME} 2>/dev/null x=1 /usr/bin
+$(pwd) export then ${HOME} echo |
+sed awk --verbose local cd "$@" cd && && echo local export
+		/usr/bin -eu --verbose grep && grep "$@" done then echo "$@" --verbose done test
+x=1 awk then --verbose readonly x=1 grep
+	cd grep sed $(pwd) grep echo
+	printf readonly 'quoted text' | sed cd then echo $(pwd)
+	&& ${HOME} then echo readonly && printf
+	-eu echo local $(pwd) done
+	/usr/bin local readonly x=1 $(pwd) cd 'quoted text' test
+	2>/dev/null ${HOME} then done then awk 'quoted text'
+		2>/dev/null 'quoted text' export |
+/usr/bin 2>/dev/null test --verbose /usr/bin "$1"
+	readonly local "$@" ${HOME} done
+		${HOME} 'quoted text' export && "$1" cd | /usr/bin /usr/bin
+	-eu local local test echo x=1 then 2>/dev/null sed grep
+done local 'quoted text' export 2>/dev/null -eu
+readonly /usr/bin | --verbose then awk
+done 'quoted text' x=1
+	"$1" awk -eu 2>/dev/null x=1 -eu
+	/usr/bin "$1" awk "$@" done awk done | awk readonly && && awk cd &&
+readonly printf -eu "$1" --verbose 2>/dev/null /usr/bin ${HOME}
+printf "$@" done 'quoted text' printf x=1 printf awk "$@" readonly grep /usr/bin
+done 2>/dev/null "$1" -eu then echo export
+		2>/dev/null export "$@" ${HOME} -eu x=1 sed
+"$@" --verbose local 2>/dev/null then test ${HOME} then 2>/dev/null
+	echo cd "$@" export export $(pwd) --verbose echo grep done "$@" readonly
+export ${HOME} test 'quoted text' 'quoted text' awk
+/usr/bin cd cd test done then then
+		| /usr/bin sed awk "$@"
+	then grep 'quoted text' -eu cd awk printf ${HOME} 'quoted text'
+echo "$@" then cd | grep && test grep $(pwd) awk awk x=1 readonly
+	readonly $(pwd) --verbose "$1" test | 2>/dev/null "$@" /usr/bin cd "$1" done
+	done readonly done "$@" --verbose awk readonly /usr/bin
+2>/dev/null $(pwd) export x=1 /usr/bin -eu readonly done --verbose printf
+	local 2>/dev/null done "$1" local | then
+printf test x=1 printf
+	"$@" printf && "$1" --verbose "$@" --verbose then printf
+		x=1 && "$@" && then local
+	printf ${HOME} ${HOME} then export local /usr/bin then | export awk echo export
+		&& readonly x=1 echo cd done ${HOME} sed x=1 2>/dev/null cd awk 2>/dev/null -eu
+done done echo export | local /usr/bin | sed -eu x=1 export echo 'quoted text'
+echo printf "$1" readonly
+		sed echo ${HOME} cd 2>/dev/null grep | x=1 -eu "$1" cd export local done
+	x=1 | export | x=1 awk "$@" test echo --verbose done "$@" x=1 export
+		test sed then then x=1 echo echo
+		echo ${HOME} ${HOME} $(pwd) printf printf readonly grep "$@" test sed grep grep
+awk 2>/dev/null /usr/bin readonly awk export readonly
+/usr/bin awk echo 2>/dev/null --verbose
+	echo export 'quoted text' 2>/dev/null export --verbose
+		'quoted text' $(pwd) cd "$@" export ${HOME} ${HOME} printf
+	test echo 2>/dev/null 2>/dev/null $(pwd) 'quoted text' x=1 2>/dev/null
+		grep $(pwd) awk "$1" grep
+	test -eu ${HOME} awk "$@" echo grep
+	$(pwd) echo local 'quoted text' readonly local
+		-eu sed awk --verbose awk --verbose printf "$@" "$@" awk --verbose echo
+		2>/dev/null 'quoted text' grep 'quoted text' | 2>/dev/null "$@" -eu
+	2>/dev/null | ${HOME} then
+	readonly test "$1" --verbose 2>/dev/null
+	x=1 $(pwd) grep "$1" -eu export local
+	test local "$1" cd export sed export local printf echo cd $(pwd) then ${HOME}
+		readonly && export local cd awk test local x=1
+&& printf cd /usr/bin readonly "$1" done readonly local -eu
+		local cd 'quoted text' done done 2>/dev/null local grep done --verbose
+		'quoted text' | readonly | | 2>/dev/null 'quoted text' && 'quoted text'
+"$@" -eu then /usr/bin
+		&& /usr/bin /usr/bin "$@" $(pwd) awk --verbose
+	test readonly done echo then echo test | x=1 && echo done ${HOME} && readonly
+		printf export then readonly echo test done 'quoted text'
+	then /usr/bin -eu done -eu readonly x=1 ${HOME}
+/usr/bin local $(pwd) &&
+		'quoted text' local "$@" ${HOME}
+	export sed /usr/bin "$1" local test | awk
+/usr/bin 2>/dev/null echo && local $(pwd) | 'quoted text' test | grep $(pwd) sed
+		"$1" printf grep then then local
+		2>/dev/null 'quoted text'
+/usr/bin export cd printf sed local done done x=1 'quoted text' "$@"
+done grep x=1 test ${HOME} /usr/bin ${HOME} $(pwd) echo cd cd readonly
+		test readonly printf /usr/bin /usr/bin readonly local done export
+	/usr/bin then printf readonly awk -eu | then ${HOME} ${HOME}
+| cd grep awk awk readonly test
+	printf /usr/bin $(pwd) "$1" ${HOME} test
+	grep | -eu cd then x=1 -eu "$1" awk then | $(pwd) /usr/bin
+	export $(pwd) 2>/dev/null
+printf done 'quoted text' ${HOME}
+${HOME} -eu local test $(pwd) test awk 'quoted text'
+local grep 'quoted text'
+	"$1" done x=1 done /usr/bin then "$@" done done local 2>/dev/null readonly
+test $(pwd) 2>/dev/null "$@" x=1 -eu 2>/dev/null
+-eu --verbose grep local 'quoted text' grep sed |
+printf grep "$1" "$@" "$@" && cd && "$1" | test /usr/bin "$@" ${HOME} sed
+		test -eu 'quoted text' ${HOME} ${HOME} --verbose
+&& --verbose awk echo readonly x=1 "$@" --verbose "$1" 'quoted text'
+		grep && --verbose "$@" printf 2>/dev/null 2>/dev/null done sed
+test 'quoted text' 2>/dev/null cd "$1" export export 'quoted text'
+	"$@" | && && printf grep --verbose "$1" $(pwd) then | $(pwd) /usr/bin ${HOME}
+sed echo && && then x=1 $(pwd) test awk test
+		${HOME} 2>/dev/null export grep sed test awk test readonly export x=1
+	grep --verbose --verbose /usr/bin readonly test echo 'quoted text'
+then printf --verbose then "$1" readonly
+		"$1" 'quoted text' ${HOME} --verbose
+export cd cd | "$1" 2>/dev/null then echo -eu echo awk echo test sed local -eu
+		cd awk | grep "$@" done sed grep
+	| done readonly && test grep local
+		'quoted text' export | readonly "$@" | local --verbose readonly "$1" "$@"
+	printf && grep test grep local
+		done done $(pwd) ${HOME} 2>/dev/null /usr/bin sed echo then $(pwd) --verbose
+	export 'quoted text' -eu cd && "$1" grep sed local ${HOME}
+	$(pwd) echo echo readonly cd x=1 -eu done ${HOME} x=1 echo readonly "$1" grep
+	local ${HOME} x=1 ${HOME} printf ${HOME} grep sed 2>/dev/null
+	2>/dev/null cd export local then export sed 'quoted text'
+cd echo grep grep --verbose $(pwd) "$1" readonly grep |
+	cd grep 'quoted text'
+	local ${HOME} x=1 sed
+		x=1 'quoted text' readonly awk | local awk 2>/dev/null x=1 awk
+		sed x=1 -eu printf echo then export sed readonly grep then
+done "$1" $(pwd) test export &&
+	done | echo "$1" echo 2>/dev/null "$@" $(pwd)
+x=1 local test "$1" cd local printf 'quoted text'
+		printf test readonly 2>/dev/null grep /usr/bin cd local grep readonly
+	readonly done 2>/dev/null
+	local ${HOME} && echo export then /usr/bin --verbose && printf && echo
+		cd /usr/bin sed /usr/bin x=1 --verbose readonly --verbose test x=1
+	printf sed /usr/bin ${HOME} export && /usr/bin
+grep printf awk $(pwd) x=1 done 2>/dev/null then
+		awk then "$1" sed test echo | $(pwd) grep grep $(pwd) cd
+	&& then awk then readonly "$@" done test grep
+	local && done awk local then sed test sed then -eu |
+"$1" printf done test test --verbose
+		readonly cd grep -eu done printf printf printf local "$@" grep 'quoted text'
+2>/dev/null local done "$1" 'quoted text'
+/usr/bin awk local "$1" | awk /usr/bin "$@" ${HOME}
+$(pwd) && --verbose && sed done /usr/bin
+		export awk awk "$1" printf then 'quoted text'
+	${HOME} "$1" printf "$@" | | x=1 readonly $(pwd) printf sed cd echo
+		readonly "$1" 2>/dev/null ${HOME} done awk cd -eu export readonly cd readonly --verbose
+cd echo /usr/bin | "$@" /usr/bin printf done ${HOME} /usr/bin |
+	sed /usr/bin awk "$@" /usr/bin printf --verbose 2>/dev/null awk $(pwd) done then
+	readonly awk local readonly echo $(pwd) cd grep |
+echo cd cd sed 'quoted text'
+	test $(pwd) grep sed --verbose /usr/bin | readonly
+		--verbose export awk cd echo x=1 | --verbose
+		$(pwd) done readonly cd grep done cd && echo 'quoted text' then export
+	readonly 'quoted text' export "$1" /usr/bin cd ${HOME} printf $(pwd) test sed
+done done /usr/bin x=1 export
+${HOME} cd | --verbose "$1" test | 2>/dev/null x=1 readonly
+"$1" grep -eu echo "$@" ${HOME} 'quoted text' cd
+		'quoted text' ${HOME} grep 'quoted text' 'quoted text'
+		'quoted text' ${HOME} echo export x=1 /usr/bin --verbose $(pwd) grep
+/usr/bin test sed $(pwd) "$1" then grep grep /usr/bin
+		then && local ${HOME} local "$1" then -eu
+		echo readonly test grep "$@" && -eu printf cd $(pwd) $(pwd) $(pwd) export && -eu
+		then local && $(pwd) printf done sed $(pwd) done | awk grep 'quoted text' test
+readonly /usr/bin cd "$@" --verbose "$@" export /usr/bin "$@" export
+		sed export "$1" 2>/dev/null --verbose
+"$1" export printf "$1" "$1"
+		$(pwd) -eu echo | $(pwd) export then done --verbose readonly
+		test sed --verbose grep x=1 -eu cd sed ${HOME}
+"$@" echo ${HOME} test /usr/bin "$1" export local sed done sed sed
+awk /usr/bin grep then test awk -eu && done /usr/bin then "$@"
+&& printf test cd export ${HOME} $(pwd) x=1 && printf && ${HOME} --verbose
+/usr/bin 2>/dev/null done "$@" $(pwd) | --verbose
+then "$1" done sed 2>/dev/null 2>/dev/null x=1 --verbose --verbose readonly
+local echo printf | awk $(pwd) export $(pwd) && done && && | $(pwd) printf
+		readonly cd | 2>/dev/null ${HOME} && --verbose done
+-eu sed "$@" $(pwd) printf done /usr/bin cd 2>/dev/null
+	--verbose | awk /usr/bin local sed /usr/bin
+then && done $(pwd) done "$1" local local sed sed grep
+| x=1 -eu local "$@" -eu "$1" then then
+grep 2>/dev/null printf && sed && readonly
+	&& readonly 2>/dev/null "$1"
+		awk && echo printf awk echo x=1 local | awk grep local "$1" done cd 'quoted text'
+--verbose sed /usr/bin "$@" local cd awk -eu
+	test /usr/bin printf local -eu $(pwd) echo printf
+"$@" 2>/dev/null && 2>/dev/null export "$@" printf printf ${HOME}
+		${HOME} "$1" cd printf x=1 printf readonly sed && readonly export done -eu -eu
+	export test done grep && $(pwd) done sed x=1 printf export
+	x=1 x=1 "$1" | | -eu test "$@" -eu x=1 ${HOME} echo x=1
+	then | 2>/dev/null /usr/bin grep printf then cd printf export
+		sed export grep "$@" test --verbose && $(pwd) grep sed
+		printf cd grep && then export awk cd | local done | 2>/dev/null echo
+--verbose cd local printf test | && 'quoted text' printf 'quoted text'
+"$@" 'quoted text' "$1" local /usr/bin grep readonly 'quoted text' 'quoted text'
+		echo "$@" echo test readonly --verbose printf done
+		${HOME} "$1" 2>/dev/null
+	grep test export "$@" done cd /usr/bin | sed 2>/dev/null && awk readonly cd
+	printf grep ${HOME} local
+readonly && 2>/dev/null "$1" "$@" local $(pwd)
+		echo then "$1" 2>/dev/null echo export readonly 'quoted text' test grep "$1"
+	printf echo awk -eu done | --verbose -eu sed
+sed "$@" then readonly "$@" printf
+	done -eu readonly /usr/bin test printf awk cd | sed -eu sed
+	-eu cd 2>/dev/null 2>/dev/null printf done local x=1 awk x=1 ${HOME}
+	readonly done $(pwd) --verbose $(pwd) done printf --verbose then
+	done grep echo 'quoted text' printf awk cd grep
+		test "$1" -eu done echo "$1" grep then then echo echo $(pwd)
+readonly grep x=1 && ${HOME} echo $(pwd) "$@"
+		echo printf readonly echo -eu export | done --verbose echo --verbose
+	-eu "$@" readonly echo test 'quoted text'
+	test "$1" printf 2>/dev/null
+	--verbose -eu echo "$@"
+		echo local "$1" awk printf done x=1 test | echo
+		-eu $(pwd) awk x=1 test then echo
+		/usr/bin $(pwd) && 'quoted text'
+	echo $(pwd) "$@" && && "$1" cd grep ${HOME} then done x=1 "$1" done test readonly
+		awk "$1" 'quoted text' | sed grep && $(pwd) --verbose 'quoted text' -eu echo $(pwd)
+	cd then local grep test sed x=1 x=1 printf printf awk echo -eu $(pwd)
+		local then --verbose export local awk local cd local ${HOME}
+		"$1" export -eu | done "$@" echo
+		readonly x=1 | $(pwd) x=1 echo done -eu 'quoted text' cd "$@" export
+	&& x=1 local 'quoted text'
+		readonly export 'quoted text' && test
+$(pwd) $(pwd) x=1 export ${HOME} awk grep 2>/dev/null
+	then readonly -eu -eu 'quoted text'
+cd 2>/dev/null local printf
+grep export cd 2>/dev/null test && 'quoted text' && 'quoted text'
+/usr/bin && export && awk printf
+	grep 2>/dev/null local grep then then 2>/dev/null $(pwd) && then &&
+		cd awk 2>/dev/null $(pwd) "$1" sed then
+sed then 2>/dev/null sed cd then 2>/dev/null grep then -eu $(pwd) then 'quoted text'
+echo --verbose done x=1 --verbose done
+		echo /usr/bin 'quoted text' readonly /usr/bin ${HOME} | | readonly
+cd | $(pwd) sed awk && "$1" echo awk grep readonly | | cd
+	${HOME} local ${HOME} echo "$1" /usr/bin
+	'quoted text' echo /usr/bin --verbose export 2>/dev/null
+	"$@" echo /usr/bin -eu "$1" -eu done export cd && && sed test then grep 2>/dev/null
+	${HOME} --verbose export x=1 'quoted text' echo --verbose
+	echo export then printf test "$@" awk "$1" 2>/dev/null printf x=1 "$1" grep grep
+		/usr/bin awk x=1 $(pwd) --verbose cd "$@" -eu
+		echo && --verbose 'quoted text' cd test "$@"
+		-eu --verbose x=1 --verbose ${HOME}
+	cd $(pwd) test | "$@" $(pwd) 2>/dev/null done printf
+'quoted text' test ${HOME} x=1 readonly ${HOME} printf $(pwd) "$1"
+printf && awk "$1" ${HOME}
+	| | grep sed $(pwd) printf && done
+	echo ${HOME} local x=1 grep x=1
+		&& $(pwd) -eu --verbose /usr/bin test
+		| 'quoted text' printf -eu
+		readonly "$@" grep test "$@" /usr/bin then && echo ${HOME} test "$@" 2>/dev/null
+	sed echo $(pwd) test "$@" readonly then ${HOME} cd "$1" readonly /usr/bin export
+grep done local "$1" grep
+	"$@" done $(pwd) /usr/bin cd "$@" 'quoted text' test sed local ${HOME}
+		-eu test 'quoted text' local local 'quoted text' awk && 2>/dev/null
+		x=1 grep 'quoted text' -eu grep -eu export printf $(pwd)
+	readonly test 'quoted text'
+cd 'quoted text' /usr/bin "$@" x=1
+		2>/dev/null done sed grep 2>/dev/null ${HOME} $(pwd) cd grep | export
@@ -0,0 +1,2001 @@
+export printf 2>/dev/null && | then awk test ${HOME} echo | -eu export x=1
+		export then -eu && /usr/bin x=1 awk
+		${HOME} printf --verbose /usr/bin
+		| test /usr/bin awk cd local $(pwd) echo awk sed
+	--verbose "$1" -eu && -eu --verbose $(pwd) 2>/dev/null readonly /usr/bin
+		2>/dev/null "$1" printf
+		export sed awk sed grep sed printf test ${HOME} grep
+		cd cd "$@" $(pwd) | printf "$1" grep
+readonly x=1 echo $(pwd) 'quoted text' ${HOME} grep 'quoted text'
+export grep cd cd ${HOME} ${HOME} -eu then done then readonly
+		export $(pwd) --verbose cd echo x=1 2>/dev/null then | cd readonly
+		awk echo && x=1 && echo /usr/bin "$1" 2>/dev/null $(pwd)
+local 'quoted text' 2>/dev/null sed 2>/dev/null
+export "$@" grep grep sed
+		"$1" cd then echo test --verbose test then $(pwd) /usr/bin done
+	| echo done $(pwd) -eu test ${HOME} "$@" --verbose x=1 'quoted text'
+	&& done -eu done cd | awk -eu local "$@" printf then |
+		/usr/bin ${HOME} echo 2>/dev/null && "$1" local ${HOME} $(pwd)
+	/usr/bin local local --verbose | | -eu --verbose "$1" -eu x=1 && echo cd ${HOME}
+	"$1" 2>/dev/null "$1" -eu ${HOME} export cd cd echo && /usr/bin export
+		test export | /usr/bin "$@" "$@" /usr/bin test then cd $(pwd) --verbose --verbose
+	"$1" 'quoted text' then readonly
+	"$1" 2>/dev/null x=1 export $(pwd) x=1 test
+		--verbose cd --verbose && $(pwd) done
+		| "$1" /usr/bin awk x=1 --verbose ${HOME} then
+		'quoted text' printf && local
+		then "$1" --verbose done x=1 then && /usr/bin
+local ${HOME} 2>/dev/null $(pwd)
+readonly sed /usr/bin 2>/dev/null 'quoted text' --verbose printf
+| $(pwd) && sed export test | /usr/bin printf done 'quoted text' --verbose echo
+	grep test | done -eu /usr/bin readonly
+	$(pwd) | readonly test printf "$@" export
+| && sed test "$1" then readonly cd $(pwd) then then test readonly
+		"$1" x=1 $(pwd) done 2>/dev/null printf test awk $(pwd) echo "$1"
+	then $(pwd) test then --verbose 2>/dev/null
+		echo local awk "$@" sed && printf 2>/dev/null printf "$@" grep test $(pwd) local
+		echo --verbose | export | echo && echo 2>/dev/null --verbose
+	echo export --verbose $(pwd) printf 2>/dev/null
+		cd x=1 export grep test
+		test "$1" readonly cd | ${HOME} "$@"
+		grep grep local 'quoted text' cd "$1"
+"$@" x=1 test export echo printf 2>/dev/null 'quoted text'
+	readonly && "$@" grep export printf local x=1 "$@" | x=1 echo cd 2>/dev/null "$1"
+test --verbose "$@" printf "$1" | then /usr/bin 2>/dev/null
+	"$1" "$@" "$1" 2>/dev/null |
+		-eu $(pwd) "$1" | cd then &&
+		done readonly /usr/bin "$@" "$1" ${HOME}
+		awk 'quoted text' test "$@" test "$@" && then /usr/bin done readonly
+--verbose echo grep --verbose test
+${HOME} readonly --verbose grep $(pwd) /usr/bin
+		x=1 printf echo test -eu "$@" && "$1" --verbose "$1" "$1" then
+		grep 'quoted text' "$@" grep
+		| sed x=1 | /usr/bin printf 2>/dev/null echo done
+		then then x=1 echo test x=1 ${HOME}
+	export grep | echo $(pwd) test cd ${HOME}
+	'quoted text' && $(pwd) | export done printf ${HOME} printf $(pwd) 'quoted text'
+	$(pwd) grep -eu then awk 'quoted text' printf
+local && -eu | grep "$@" 'quoted text' local x=1 awk echo --verbose
+	echo /usr/bin test "$@" then awk 'quoted text'
+local test | | | $(pwd) /usr/bin 2>/dev/null then "$@" test x=1 test
+		echo 2>/dev/null local && export local printf cd sed done export sed | &&
+		x=1 export && --verbose cd readonly test 'quoted text' | && sed "$@" test
+then "$1" export -eu export | | | "$@" then
+		local /usr/bin -eu "$1" /usr/bin $(pwd) readonly then then local grep /usr/bin
+	-eu "$@" grep readonly grep "$1" grep test done grep && echo
+		printf && sed local "$1" --verbose ${HOME} -eu test
+	&& && cd ${HOME} 'quoted text' readonly done "$@" readonly
+"$1" ${HOME} readonly local done echo sed awk printf 2>/dev/null grep -eu x=1
+	/usr/bin test grep -eu "$1" sed | sed --verbose /usr/bin
+	then printf /usr/bin done sed awk cd echo echo test 2>/dev/null
+		sed --verbose echo then --verbose export cd printf awk ${HOME} /usr/bin
+		'quoted text' "$@" grep -eu x=1 then awk printf awk
+		done "$1" readonly $(pwd) grep grep export | awk 2>/dev/null x=1 /usr/bin -eu
+		--verbose then "$1" 2>/dev/null -eu test sed grep /usr/bin ${HOME} --verbose
+		test 'quoted text' | grep test printf test 'quoted text' echo
+		'quoted text' "$@" $(pwd) test --verbose
+	grep grep printf awk readonly
+test x=1 -eu grep ${HOME} echo $(pwd) sed /usr/bin
+		local echo then 2>/dev/null printf grep "$1" readonly x=1
+	$(pwd) | 2>/dev/null x=1 awk ${HOME} test awk echo
+		awk ${HOME} $(pwd) --verbose sed /usr/bin test then printf "$@" --verbose
+	x=1 export $(pwd) && /usr/bin export test awk export local 'quoted text'
+	cd /usr/bin | then echo done printf local /usr/bin done | readonly 2>/dev/null
+	--verbose -eu "$1" then local -eu echo awk ${HOME} grep done x=1
+'quoted text' awk local -eu readonly printf /usr/bin -eu done then readonly local
+	readonly export | done echo && readonly
+		test cd local sed 2>/dev/null then
+		test /usr/bin "$@" -eu 'quoted text' local
+done export -eu then grep done 'quoted text' awk /usr/bin then /usr/bin
+		"$@" printf cd grep | export
+		local /usr/bin --verbose 2>/dev/null cd
+"$1" then cd && 2>/dev/null
+grep done done readonly echo export && $(pwd) printf readonly test && awk awk
+done then 2>/dev/null ${HOME}
+	echo then printf "$@" x=1 /usr/bin printf && echo "$1" /usr/bin
+awk "$@" $(pwd) $(pwd) x=1 grep /usr/bin -eu 'quoted text' 'quoted text'
+		awk 'quoted text' readonly $(pwd) printf then local -eu readonly
+then test && done x=1 "$1" x=1 readonly --verbose /usr/bin --verbose
+| x=1 && --verbose echo 2>/dev/null "$@" done && -eu | | && -eu awk
+grep test readonly sed /usr/bin | && $(pwd) ${HOME} awk awk && printf printf
+	cd local $(pwd) grep $(pwd) "$1" 'quoted text'
+		$(pwd) grep grep echo grep then 'quoted text' 2>/dev/null
+test 'quoted text' done then "$1" ${HOME} /usr/bin "$1" "$1" x=1 echo
+&& x=1 ${HOME} cd then awk export test grep export x=1 --verbose
+	printf printf cd local "$1" | /usr/bin "$1" grep
+	export 'quoted text' -eu test /usr/bin ${HOME} echo $(pwd) readonly local
+-eu "$1" local done local done
+		printf && local export
+	printf local local "$1"
+	awk -eu grep awk x=1 printf "$1" && then && | -eu && /usr/bin export
+	-eu 'quoted text' 2>/dev/null readonly awk | $(pwd)
+	| 2>/dev/null then cd test sed then | cd test
+	"$1" /usr/bin echo -eu x=1 awk 2>/dev/null x=1 2>/dev/null export "$1" | echo |
+		$(pwd) && x=1 x=1 done test 'quoted text' | cd awk echo 'quoted text' then cd
+		echo local local ${HOME} $(pwd) then x=1 $(pwd) echo 2>/dev/null
+	printf 2>/dev/null then
+	readonly echo grep ${HOME}
+readonly 2>/dev/null grep echo ${HOME} local --verbose cd "$1" ${HOME}
+		export --verbose 'quoted text' test sed 'quoted text' /usr/bin echo x=1 -eu
+echo sed --verbose /usr/bin grep sed sed then /usr/bin
+/usr/bin cd grep "$@" local echo test /usr/bin readonly
+	readonly cd printf $(pwd) done | then cd --verbose
+--verbose readonly /usr/bin test done cd ${HOME} printf 'quoted text'
+'quoted text' readonly printf grep -eu test 'quoted text' then export
+		x=1 cd echo | && then grep | then test sed cd -eu readonly
+		echo readonly 2>/dev/null ${HOME} 2>/dev/null
+	"$1" "$1" printf -eu
+	printf readonly grep readonly printf grep
+awk then grep 'quoted text' local
+	| cd done readonly | && echo sed /usr/bin -eu printf then
+	--verbose done done /usr/bin sed 'quoted text' x=1 done cd test printf 2>/dev/null
+	$(pwd) 'quoted text' echo awk export then awk test -eu then grep
+		x=1 2>/dev/null --verbose x=1 2>/dev/null
+	readonly readonly test readonly "$1" sed echo
+	echo --verbose 2>/dev/null printf grep "$1" then
+--verbose ${HOME} 'quoted text' sed
+	sed | test export "$@" && --verbose ${HOME} --verbose export
+		$(pwd) done 2>/dev/null test cd | 2>/dev/null test test $(pwd)
+		sed awk $(pwd) 'quoted text' | cd 2>/dev/null /usr/bin 2>/dev/null
+		"$@" test test 2>/dev/null -eu test awk sed "$@" echo
+	echo done test sed && test readonly 2>/dev/null "$1" /usr/bin then local done
+		local sed cd awk grep 'quoted text'
+sed export export printf export done sed test | ${HOME} cd --verbose $(pwd) ${HOME}
+2>/dev/null $(pwd) then "$@" then done export "$@" 'quoted text'
+sed x=1 -eu && echo test /usr/bin /usr/bin printf test /usr/bin echo echo
+		grep grep local echo && | /usr/bin 2>/dev/null
+printf && awk grep then awk && then export echo then && sed grep
+		${HOME} $(pwd) echo -eu grep sed
+test awk grep x=1 export "$@"
+	"$1" cd echo | test 'quoted text'
+		done export x=1 cd $(pwd) printf export /usr/bin $(pwd) --verbose
+	| done cd grep then "$1" "$@" cd test -eu
+printf /usr/bin /usr/bin | --verbose "$1" 2>/dev/null
+		| && awk -eu 2>/dev/null 'quoted text'
+	'quoted text' $(pwd)
+--verbose $(pwd) "$@" x=1 /usr/bin -eu local
+	awk "$1" -eu x=1 "$1" ${HOME}
+		&& $(pwd) grep local $(pwd) sed $(pwd) test
+	echo readonly 2>/dev/null 'quoted text'
+	x=1 --verbose awk 2>/dev/null test printf export
+grep | 'quoted text' ${HOME} echo done
+	x=1 | 'quoted text' cd then printf x=1 --verbose
+	--verbose $(pwd) export readonly grep "$1" 2>/dev/null | /usr/bin
+	awk x=1 "$@" awk "$1" test sed grep -eu | readonly
+	done echo local local printf printf "$@" x=1 -eu local x=1 printf x=1 "$@" test
+	test sed export --verbose awk ${HOME} grep --verbose test echo
+	readonly ${HOME} | x=1 test test grep readonly cd && readonly then
+	readonly then && awk $(pwd) 2>/dev/null
+test export test sed --verbose readonly --verbose |
+printf 2>/dev/null test $(pwd) done "$@" "$1" printf readonly local
+	echo echo x=1 then -eu export 'quoted text' && test 2>/dev/null
+	export grep /usr/bin sed "$1" | "$@" done export &&
+	-eu 2>/dev/null /usr/bin $(pwd) cd cd done readonly cd export && 'quoted text'
+		local local done echo cd "$@" $(pwd)
+printf echo "$1" "$1" --verbose ${HOME} printf grep then x=1
+		"$1" then -eu 2>/dev/null printf x=1 --verbose done $(pwd)
+		readonly printf printf
+	x=1 x=1 $(pwd) then | "$@" ${HOME} && "$@" 2>/dev/null 'quoted text' cd grep
+		&& done local x=1 echo cd | sed ${HOME} sed /usr/bin 2>/dev/null
+	done export done /usr/bin
+grep --verbose && printf test awk $(pwd)
+export "$@" awk /usr/bin 2>/dev/null
+	| done echo cd test done "$@" x=1 && | export cd
+	| ${HOME} -eu local x=1 -eu grep ${HOME} -eu sed 'quoted text' &&
+		cd done awk grep -eu then cd grep
+2>/dev/null sed done local cd then 'quoted text' 'quoted text' -eu
+	test /usr/bin && export 2>/dev/null ${HOME} export printf 2>/dev/null
+	"$1" | 2>/dev/null cd $(pwd) "$@" export 2>/dev/null grep /usr/bin
+	-eu printf local sed sed readonly && printf $(pwd) "$1"
+	test printf local awk ${HOME} awk 'quoted text' 2>/dev/null readonly | grep echo
+		$(pwd) --verbose && done $(pwd) awk "$1" echo then readonly ${HOME} local "$1"
+'quoted text' done "$@" ${HOME} done grep /usr/bin
+		test /usr/bin --verbose --verbose && "$@" "$1" readonly ${HOME}
+	${HOME} sed "$1" | && grep --verbose then
+		test done then "$1" then cd
+readonly -eu | "$1" readonly export readonly grep
+readonly 2>/dev/null | && grep x=1 sed && grep $(pwd)
+readonly done cd readonly /usr/bin x=1
+printf --verbose then /usr/bin
+	&& readonly then sed done then readonly && sed x=1
+| -eu /usr/bin ${HOME} 'quoted text' /usr/bin then "$1" cd test
+local | echo /usr/bin "$@"
+		sed -eu $(pwd) awk 2>/dev/null "$@" local awk local done done sed 2>/dev/null
+		then | && "$@" 2>/dev/null "$@" ${HOME}
+"$1" test "$@" 2>/dev/null readonly echo test awk ${HOME}
+	"$@" cd --verbose | done readonly x=1 export then cd 'quoted text'
+grep cd sed grep sed ${HOME} ${HOME} awk test
+| x=1 "$@" export sed sed | /usr/bin "$1" readonly ${HOME} 2>/dev/null
+		&& "$@" ${HOME} sed grep sed export then -eu then ${HOME} done sed ${HOME} printf
+	printf ${HOME} $(pwd) ${HOME} /usr/bin done -eu awk | ${HOME} && "$1" sed
+		"$1" then grep x=1 sed 2>/dev/null "$1" 'quoted text'
+	2>/dev/null --verbose readonly printf 'quoted text'
+$(pwd) 2>/dev/null 'quoted text' test 2>/dev/null -eu
+		readonly done ${HOME} "$@" cd echo test | "$1" readonly then &&
+	export $(pwd) 'quoted text' "$@"
+	printf printf && ${HOME} test test
+	"$1" /usr/bin --verbose
+	${HOME} 'quoted text' local grep export local export "$@" --verbose printf printf
+		${HOME} export ${HOME} | then export then --verbose export then
+		--verbose && printf grep $(pwd) awk done export 'quoted text'
+	printf readonly sed -eu readonly test 'quoted text' echo done readonly
+	done readonly 'quoted text' /usr/bin -eu ${HOME} done local export
+		printf export readonly "$1" sed export awk "$@" 'quoted text' -eu sed sed export
+		printf grep sed 2>/dev/null sed readonly && --verbose "$@" cd "$1" && test 2>/dev/null
+	test | sed local grep
+	'quoted text' echo --verbose sed awk export printf then done && export
+	${HOME} grep done x=1 ${HOME}
+${HOME} /usr/bin sed 2>/dev/null && x=1 test -eu
+		cd /usr/bin readonly test && | "$@" "$1" local cd export --verbose
+"$1" awk /usr/bin 'quoted text' ${HOME} sed | $(pwd) --verbose && 2>/dev/null
+readonly | /usr/bin $(pwd) $(pwd)
+	"$1" done -eu local test echo $(pwd) $(pwd) && | awk export test ${HOME} readonly
+	&& readonly "$1" cd test readonly then "$@" -eu local "$1" sed &&
+		"$@" sed done echo printf readonly readonly readonly then test echo done $(pwd)
+readonly $(pwd) 'quoted text' --verbose local x=1 grep
+		readonly cd grep cd x=1 local cd 2>/dev/null echo ${HOME} 2>/dev/null export
+local export | awk 'quoted text'
+then export 'quoted text' x=1 -eu x=1 "$1" | done readonly /usr/bin cd &&
+		cd awk --verbose /usr/bin done echo
+sed 'quoted text' cd then awk then 2>/dev/null --verbose
+		| sed 2>/dev/null grep "$@" ${HOME} done local && done test ${HOME} printf
+-eu local 2>/dev/null local $(pwd) readonly "$@"
+		2>/dev/null "$@" printf test 2>/dev/null export awk readonly
+		--verbose cd done | printf 2>/dev/null 'quoted text' then
+		--verbose cd readonly readonly sed grep /usr/bin && grep
+	printf | readonly grep awk | -eu
+		&& awk export done | awk -eu local "$1" grep 'quoted text' cd | $(pwd)
+		"$1" $(pwd) "$@" 2>/dev/null
+printf && printf then 'quoted text'
+	printf "$1" x=1 'quoted text' export grep sed test readonly
+then "$1" 2>/dev/null && -eu --verbose
+		| cd && "$1" 2>/dev/null readonly
+x=1 echo /usr/bin done local 'quoted text' "$1" export readonly then
+		local awk cd local 'quoted text' readonly sed --verbose $(pwd) printf done
+	x=1 2>/dev/null export "$@" awk | done ${HOME} -eu 2>/dev/null ${HOME}
+	-eu readonly 'quoted text' export
+	done /usr/bin printf done test then -eu awk | printf /usr/bin
+echo echo x=1 -eu 2>/dev/null -eu -eu cd
+		-eu export local -eu --verbose && sed awk && sed readonly "$1" awk
+	readonly $(pwd) | --verbose then echo "$@" export cd
+&& sed export echo done ${HOME} -eu local awk export
+then x=1 test --verbose echo done ${HOME} awk "$1" export readonly && | "$@"
+		--verbose x=1 done test "$@" && cd $(pwd) test 2>/dev/null
+-eu -eu x=1 test then then grep awk grep
+		local awk done local done local && --verbose
+		${HOME} grep export | "$@" then && 2>/dev/null done awk export
+		2>/dev/null test "$@" awk $(pwd) grep -eu "$@"
+		"$1" echo sed local x=1 x=1 test then ${HOME} $(pwd) readonly echo done printf
+		"$1" 2>/dev/null $(pwd) test $(pwd) done
+	-eu sed grep 'quoted text' grep readonly $(pwd) | local grep --verbose | grep
+		local ${HOME} x=1 "$1" "$@"
+	printf | -eu 2>/dev/null readonly | export
+	readonly sed export $(pwd)
+then echo grep --verbose cd sed local
+		readonly readonly x=1 2>/dev/null
+		$(pwd) ${HOME} -eu readonly /usr/bin x=1 test ${HOME} then done test
+		| printf awk done grep then ${HOME} echo -eu 2>/dev/null && 2>/dev/null &&
+	&& echo sed grep "$@" export then readonly --verbose "$1" printf
+		cd echo ${HOME} sed grep sed "$1" cd local -eu 2>/dev/null
+	awk export export export
+	"$@" 'quoted text' 2>/dev/null | local "$1" x=1 export
+&& --verbose echo /usr/bin sed | awk cd ${HOME} readonly $(pwd) --verbose
+	then done printf "$1" -eu $(pwd) x=1 x=1 && test
+cd "$@" readonly ${HOME}
+		--verbose 2>/dev/null done "$@" awk 2>/dev/null 2>/dev/null cd "$@"
+	/usr/bin cd then /usr/bin $(pwd)
+then --verbose test "$1" test "$1" 2>/dev/null
+	x=1 ${HOME} grep sed x=1 echo done cd test
+printf export | "$@" grep
+	cd 2>/dev/null ${HOME} --verbose then ${HOME} grep
+echo --verbose -eu /usr/bin "$@" 'quoted text' x=1 printf test printf |
+	"$1" x=1 'quoted text'
+		cd test ${HOME} x=1 $(pwd) done then x=1 echo echo grep
+		${HOME} done ${HOME} x=1 2>/dev/null x=1 done --verbose
+	done -eu "$@" cd 'quoted text'
+		/usr/bin -eu "$@" --verbose readonly then 'quoted text' sed && 'quoted text'
+then -eu then --verbose && 2>/dev/null && "$@" grep export
+	export grep "$@" /usr/bin grep 2>/dev/null "$@" then && --verbose ${HOME} sed
+		awk ${HOME} readonly printf done "$1" -eu printf -eu printf | 2>/dev/null
+	2>/dev/null "$@" awk x=1 --verbose -eu ${HOME} 2>/dev/null then
+		"$@" printf printf grep /usr/bin "$1"
+	&& 'quoted text' "$1" awk 'quoted text' done done export && -eu "$1"
+	-eu local cd 'quoted text' echo $(pwd) local cd echo test
+		/usr/bin sed --verbose done export local
+	printf /usr/bin && "$@" -eu local 'quoted text'
+printf test printf | 'quoted text' 'quoted text'
+	${HOME} 'quoted text' cd "$@" && awk done "$@" $(pwd)
+		&& sed --verbose x=1 awk
+		done $(pwd) 'quoted text' done done
+--verbose export done local 2>/dev/null 2>/dev/null "$@" awk $(pwd) 'quoted text'
+		-eu 'quoted text' grep printf
+printf -eu $(pwd) | $(pwd) printf
+	grep awk -eu grep export
+sed | | | "$1" $(pwd) -eu | x=1 local $(pwd) "$@" 2>/dev/null "$@" echo
+		cd local grep local /usr/bin 'quoted text' done | readonly $(pwd) x=1
+-eu awk local --verbose | ${HOME} awk -eu cd readonly then
+	/usr/bin -eu printf 2>/dev/null sed echo x=1 ${HOME}
+2>/dev/null grep then sed sed readonly $(pwd) readonly printf
+		2>/dev/null local 2>/dev/null then readonly --verbose export done &&
+		test printf local "$1" /usr/bin sed "$1" sed /usr/bin /usr/bin x=1 'quoted text'
+	2>/dev/null ${HOME} done
+		printf grep 'quoted text' ${HOME} test
+	$(pwd) export export -eu 'quoted text' --verbose
+test "$@" -eu sed echo x=1 readonly done cd then
+		awk 'quoted text' echo $(pwd) then readonly "$@" export printf
+		2>/dev/null done $(pwd) x=1 test local | && && "$1" 2>/dev/null && local done
+		grep printf cd x=1 grep awk then "$@"
+		"$1" test "$@" printf sed readonly 2>/dev/null cd printf
+	readonly awk /usr/bin "$1" x=1 x=1 ${HOME}
+	-eu ${HOME} grep && readonly export ${HOME} local
+"$1" /usr/bin "$1" 2>/dev/null -eu | x=1
+		local readonly && && echo && printf | 'quoted text' /usr/bin && /usr/bin "$@"
+cd 'quoted text' x=1 local echo printf ${HOME} "$@" "$1"
+		"$1" grep -eu readonly 'quoted text' $(pwd) sed "$@" awk /usr/bin local x=1 sed
+		'quoted text' local "$1" printf then x=1 && then then x=1 "$@"
+local export && 2>/dev/null cd 2>/dev/null cd x=1 readonly grep grep printf
+	local readonly local grep readonly 2>/dev/null local cd |
+		local sed 2>/dev/null 2>/dev/null ${HOME} --verbose
+		2>/dev/null 'quoted text' | $(pwd) -eu cd sed grep
+		'quoted text' cd x=1 --verbose readonly sed done /usr/bin 'quoted text'
+		echo "$@" awk && done done "$@"
+		2>/dev/null sed /usr/bin awk -eu echo "$1"
+	'quoted text' printf "$@" /usr/bin $(pwd) printf --verbose $(pwd)
+local cd && awk && -eu export sed $(pwd) sed $(pwd) export
+&& then /usr/bin --verbose -eu
+		sed export x=1 export 'quoted text' && echo "$1" --verbose printf cd -eu
+	| ${HOME} ${HOME} ${HOME} sed ${HOME} 'quoted text' then "$@" "$1"
+awk readonly --verbose readonly awk awk $(pwd) 2>/dev/null -eu "$@" "$1"
+cd "$1" test 2>/dev/null ${HOME} ${HOME} $(pwd) grep x=1 ${HOME}
+		'quoted text' export | | && x=1 "$@" sed then echo
+	x=1 cd ${HOME} readonly $(pwd) 'quoted text' printf then
+		| echo && -eu local 2>/dev/null
+	$(pwd) "$@" cd printf then && then readonly "$@" "$@" x=1 then 2>/dev/null
+		printf test $(pwd) local then export ${HOME} -eu cd ${HOME} $(pwd) awk "$1" x=1
+x=1 sed sed echo done "$@" "$@" sed awk
+readonly "$@" sed ${HOME} cd export --verbose --verbose x=1 2>/dev/null "$1"
+		-eu grep 2>/dev/null cd grep 'quoted text' readonly
+local printf local readonly cd x=1 | readonly /usr/bin printf
+grep ${HOME} "$1" done export printf readonly
+	$(pwd) done readonly cd -eu ${HOME} "$1" done
+		done local ${HOME} /usr/bin "$1" | /usr/bin then -eu
+echo -eu readonly then test
+grep done "$1" printf /usr/bin | "$@" "$1"
+		x=1 /usr/bin "$@" done && printf echo -eu sed $(pwd)
+${HOME} x=1 test sed awk
+		then $(pwd) sed "$1"
+	$(pwd) cd then awk readonly /usr/bin export
+		| $(pwd) -eu -eu printf
+	then test --verbose cd x=1
+printf local $(pwd) test --verbose && grep awk | printf
+$(pwd) done test 'quoted text' grep then grep awk readonly
+then && && export "$@" done awk local local 2>/dev/null /usr/bin readonly printf
+	--verbose printf local awk 'quoted text' readonly
+		echo export --verbose readonly 'quoted text' "$1" /usr/bin local "$1"
+--verbose /usr/bin printf sed 2>/dev/null $(pwd) then then
+		| echo "$@" readonly then export
+	--verbose x=1 | local
+		readonly -eu "$@" echo "$1" 'quoted text' export 2>/dev/null
+		sed --verbose sed then "$1" ${HOME} export $(pwd) cd echo readonly | grep awk grep
+		test /usr/bin ${HOME} export 'quoted text' "$1" local "$1" --verbose
+		| local /usr/bin cd test done readonly /usr/bin
+		sed "$1" $(pwd) grep echo "$1" readonly awk readonly
+$(pwd) && sed awk 2>/dev/null
+		grep awk 2>/dev/null done echo x=1 ${HOME} then 'quoted text' then
+		"$@" printf -eu printf grep
+		/usr/bin $(pwd) x=1 awk export | test
+	cd $(pwd) 2>/dev/null 'quoted text' 2>/dev/null awk --verbose $(pwd) --verbose
+		export $(pwd) readonly $(pwd) --verbose "$1" --verbose sed echo /usr/bin 'quoted text'
+		$(pwd) awk "$@" $(pwd) 2>/dev/null --verbose
+		| export then sed $(pwd) 'quoted text' readonly export export $(pwd)
+	printf grep local /usr/bin test $(pwd) "$@" sed
+	sed then echo --verbose local && /usr/bin --verbose grep
+printf sed 2>/dev/null local local -eu readonly | printf /usr/bin test awk
+'quoted text' -eu "$@" "$1" x=1 -eu /usr/bin && cd test echo
+local grep 'quoted text' cd readonly && sed -eu then 2>/dev/null -eu
+	2>/dev/null --verbose printf 'quoted text' 'quoted text' x=1 2>/dev/null
+	cd cd $(pwd) then "$1" /usr/bin "$@" printf
+test | cd /usr/bin echo /usr/bin "$@" readonly /usr/bin
+		local then ${HOME} readonly
+	--verbose export then ${HOME} /usr/bin test cd $(pwd) | sed cd sed cd
+| "$@" "$1" && export "$1" 'quoted text' $(pwd) 2>/dev/null --verbose
+	awk ${HOME} printf "$1" export | -eu sed readonly readonly 'quoted text'
+	x=1 "$@" awk sed "$@" x=1 printf
+		-eu && test /usr/bin local 2>/dev/null done 'quoted text' local 2>/dev/null
+local echo "$1" readonly awk
+		test local test "$1"
+| -eu x=1 grep export test && done -eu readonly
+		--verbose | local "$1" "$1" ${HOME} "$@" | test
+--verbose 2>/dev/null printf export
+		"$1" export x=1 sed "$1" local "$@" printf then then readonly awk $(pwd)
+	"$@" local 2>/dev/null cd --verbose
+test test | --verbose -eu $(pwd)
+local then echo "$@" &&
+	$(pwd) | printf x=1 "$@" && -eu "$1" awk sed "$@" x=1 $(pwd) echo
+		| export local 2>/dev/null
+	done sed $(pwd) $(pwd) awk then sed done local x=1 done "$@" /usr/bin
+		sed $(pwd) "$@" then $(pwd)
+		/usr/bin /usr/bin local 2>/dev/null done done
+		readonly 2>/dev/null ${HOME}
+		'quoted text' /usr/bin export ${HOME} awk 'quoted text' $(pwd)
+	local 2>/dev/null awk done -eu x=1 grep 'quoted text' -eu && --verbose
+	cd cd done then printf --verbose "$@" local x=1 export awk x=1 "$@" cd grep
+		readonly sed "$@" ${HOME} ${HOME} $(pwd) sed
+done 'quoted text' awk readonly sed 'quoted text' grep "$@" 2>/dev/null 'quoted text'
+		"$1" x=1 grep sed printf && "$1" grep 'quoted text' cd && test local awk
+		test cd then sed local "$@"
+readonly sed 2>/dev/null 'quoted text' && ${HOME} then export cd && done ${HOME}
+		export && ${HOME} export $(pwd) printf -eu --verbose export
+readonly $(pwd) $(pwd) && "$@" grep /usr/bin readonly
+		"$@" 'quoted text' --verbose printf "$1"
+sed cd "$1" && export readonly then grep "$@" 2>/dev/null export
+	$(pwd) echo x=1 local sed awk --verbose $(pwd) test "$@"
+		grep readonly 2>/dev/null sed ${HOME}
+x=1 && printf "$@" local export grep local cd awk cd && export /usr/bin
+		/usr/bin x=1 && done export /usr/bin export "$@" "$1" x=1
+	grep $(pwd) "$@" printf /usr/bin x=1 && readonly "$@" "$1" awk /usr/bin 'quoted text'
+		done printf export sed x=1 && 'quoted text'
+then && ${HOME} && grep | readonly
+	--verbose "$@" grep ${HOME} /usr/bin "$@" readonly then done "$@"
+		&& && $(pwd) "$@" -eu cd x=1 x=1 grep printf local then -eu done ${HOME} /usr/bin
+echo x=1 -eu local 2>/dev/null 2>/dev/null && 'quoted text' x=1 'quoted text'
+	grep 'quoted text' readonly cd sed cd "$@" then done && ${HOME} "$1"
+	printf 'quoted text' --verbose
+printf "$1" printf done echo 'quoted text' /usr/bin
+test && -eu export echo
+		"$1" /usr/bin $(pwd) printf sed export done echo
+--verbose -eu then | export
+		printf sed x=1 readonly -eu done -eu
+/usr/bin echo echo printf x=1
+	2>/dev/null && --verbose
+"$@" grep $(pwd) cd sed
+	"$@" x=1 x=1 $(pwd) grep "$@" readonly --verbose && sed grep /usr/bin then printf
+${HOME} 'quoted text' -eu then x=1 | --verbose local
+		${HOME} "$@" /usr/bin sed --verbose echo test test "$@" ${HOME} test cd echo test
+		sed x=1 readonly && 'quoted text' sed local export export
+		${HOME} "$@" "$1" -eu && printf | readonly
+		$(pwd) && grep local | ${HOME} grep printf grep /usr/bin 'quoted text'
+awk "$@" x=1 cd -eu 2>/dev/null x=1 done done
+	| | /usr/bin 2>/dev/null awk printf --verbose then $(pwd)
+export --verbose ${HOME} x=1 "$@" awk 'quoted text'
+--verbose "$1" 2>/dev/null export done "$@" 'quoted text'
+&& awk readonly && printf 'quoted text'
+echo echo then awk local "$@" export cd "$1" /usr/bin echo 2>/dev/null readonly
+	${HOME} "$1" $(pwd) grep cd cd "$@" echo /usr/bin
+	$(pwd) sed done readonly "$@" cd --verbose
+"$@" "$1" | awk 'quoted text' sed done -eu 'quoted text'
+echo x=1 then local test 2>/dev/null |
+	/usr/bin grep 'quoted text' x=1 export done --verbose export
+		test 2>/dev/null "$@" readonly
+		export && echo 2>/dev/null local
+grep $(pwd) x=1 "$@" grep -eu sed -eu "$1" cd x=1 printf
+readonly /usr/bin "$1" printf local "$@" 'quoted text'
+"$1" echo $(pwd) "$@" -eu 'quoted text' then /usr/bin -eu ${HOME}
+		/usr/bin 'quoted text' readonly test "$@" 'quoted text'
+		export test grep local cd "$1" --verbose
+		| grep | $(pwd) | 'quoted text' && test
+	cd readonly --verbose /usr/bin --verbose
+x=1 grep -eu "$@" $(pwd) readonly --verbose /usr/bin printf grep done readonly
+	--verbose export local $(pwd) 'quoted text' local cd
+2>/dev/null 'quoted text'
+		done /usr/bin x=1 cd echo ${HOME} | "$@" "$1" done /usr/bin
+local --verbose cd | "$@"
+	'quoted text' awk awk $(pwd) test | --verbose && /usr/bin $(pwd) $(pwd)
+		${HOME} export sed sed readonly x=1 | then /usr/bin "$@" then sed sed 2>/dev/null
+	awk | export test -eu $(pwd) 'quoted text' echo cd $(pwd)
+		--verbose "$1" | awk awk x=1 awk
+	/usr/bin 'quoted text' readonly cd export 'quoted text'
+	done ${HOME} "$1" && then
+	cd export --verbose $(pwd) readonly x=1 cd echo /usr/bin "$@" ${HOME} awk "$@"
+cd 2>/dev/null cd /usr/bin done && grep
+	$(pwd) "$1" "$@" then 'quoted text' $(pwd) export cd awk export |
+		'quoted text' /usr/bin 2>/dev/null readonly
+&& done awk $(pwd) readonly
+		${HOME} && done local 'quoted text'
+	readonly cd /usr/bin grep 2>/dev/null
+	--verbose --verbose echo /usr/bin ${HOME}
+echo && then $(pwd) done ${HOME} -eu --verbose "$@" grep
+		test sed printf then 'quoted text' $(pwd) awk --verbose -eu | export
+		/usr/bin -eu $(pwd) "$@" cd /usr/bin then
+		export "$1" /usr/bin && test
+		local ${HOME} then local local done sed $(pwd) /usr/bin awk 2>/dev/null
+		printf done done cd "$1" /usr/bin done --verbose done readonly
+"$1" echo awk 'quoted text'
+		printf test then awk echo x=1 | sed printf x=1
+	x=1 then --verbose grep "$1" $(pwd) 2>/dev/null
+	done awk && | /usr/bin echo 'quoted text' sed sed /usr/bin
+		"$@" "$@" export cd readonly | $(pwd) cd cd echo && export "$1" cd x=1
+	| "$@" && cd "$1" ${HOME}
+x=1 -eu grep ${HOME} printf 2>/dev/null -eu grep sed awk /usr/bin "$@"
+	grep test echo test | &&
+&& "$1" echo "$1" && local "$@" done done then awk local cd &&
+		${HOME} done /usr/bin export /usr/bin ${HOME}
+local --verbose sed printf cd -eu -eu echo printf "$1"
+	'quoted text' printf /usr/bin | done 'quoted text'
+cd cd && local awk printf x=1 sed "$@" echo "$@" ${HOME} sed then awk local
+		export 2>/dev/null ${HOME} && 2>/dev/null "$1" done awk
+| x=1 | /usr/bin then /usr/bin "$@" test
+--verbose "$@" ${HOME} 2>/dev/null --verbose
+	2>/dev/null -eu x=1 $(pwd) 'quoted text' --verbose
+	x=1 then /usr/bin -eu | test cd x=1 done then --verbose ${HOME}
+		--verbose sed echo sed
+	sed export && done then ${HOME}
+		printf done echo x=1 then export ${HOME} then --verbose /usr/bin
+		grep test | $(pwd) /usr/bin then -eu x=1 cd echo
+local --verbose then local grep cd then then "$1" -eu
+		cd printf x=1 echo $(pwd) 'quoted text'
+		"$1" && ${HOME} -eu | && grep 2>/dev/null "$@" ${HOME} done
+		'quoted text' then /usr/bin export
+	then x=1 -eu "$@" "$@" /usr/bin done -eu test 2>/dev/null
+readonly --verbose x=1 local sed
+		x=1 --verbose awk done done then export -eu printf 'quoted text'
+		x=1 | | test /usr/bin test cd "$1" local ${HOME} ${HOME}
+local "$1" --verbose done awk done export --verbose $(pwd)
+		'quoted text' cd ${HOME} sed sed
+		local done ${HOME} --verbose
+readonly x=1 sed -eu 2>/dev/null /usr/bin "$1" test test "$1" cd
+		'quoted text' | | sed printf awk done export readonly | test test test x=1
+cd 2>/dev/null x=1 "$@" then export "$1" "$@"
+	/usr/bin 2>/dev/null | local $(pwd) && cd export local x=1 cd echo printf
+		&& 'quoted text' -eu cd $(pwd) x=1 x=1 done test | done
+	grep printf readonly /usr/bin
+test "$@" local export printf export grep grep | && ${HOME} echo
+export cd grep test | &&
+		then 'quoted text' done --verbose /usr/bin $(pwd) $(pwd) echo "$@" grep ${HOME}
+	2>/dev/null cd test echo then test && "$1" 2>/dev/null x=1
+		${HOME} && 'quoted text' -eu done /usr/bin /usr/bin
+		readonly x=1 /usr/bin $(pwd) | printf then /usr/bin awk sed && 'quoted text'
+	echo $(pwd) x=1 test test "$@" readonly /usr/bin echo
+		export 2>/dev/null /usr/bin -eu
+		"$1" 'quoted text' done readonly x=1 'quoted text'
+		readonly awk -eu 2>/dev/null -eu -eu local 'quoted text' --verbose
+	| then readonly printf done then test $(pwd) ${HOME}
+		--verbose test echo "$1" x=1 awk readonly $(pwd) 2>/dev/null x=1 sed
+	grep "$@" printf readonly ${HOME} "$1"
+		${HOME} "$@" export then readonly awk
+echo export /usr/bin test "$1" sed echo 2>/dev/null ${HOME} local
+		$(pwd) sed grep export $(pwd) printf local readonly $(pwd) /usr/bin
+&& awk --verbose printf printf
+		export /usr/bin grep --verbose | local | x=1 | local echo && sed export
+	"$1" "$1" readonly ${HOME} sed /usr/bin x=1 /usr/bin -eu
+		printf ${HOME} | then ${HOME} x=1 $(pwd) && ${HOME} sed
+		${HOME} --verbose -eu -eu 'quoted text' awk 'quoted text'
+		grep printf "$1" awk | "$1" x=1 "$@" "$@"
+cd awk 2>/dev/null 'quoted text' -eu echo readonly -eu readonly --verbose
+		grep $(pwd) sed 2>/dev/null local local awk then awk printf $(pwd)
+	done 'quoted text' echo | awk awk done -eu echo 'quoted text' "$1" echo 'quoted text'
+	export done printf echo -eu && 2>/dev/null
+awk 2>/dev/null | $(pwd) awk | grep $(pwd) local local printf ${HOME} | echo
+	done 2>/dev/null printf "$@" export | cd then echo echo --verbose 'quoted text'
+	then 'quoted text' echo | test
+		sed then 'quoted text' printf "$@" awk "$@"
+		&& -eu $(pwd) then then 'quoted text'
+	x=1 "$@" test export done printf then
+	"$1" x=1 && --verbose 2>/dev/null /usr/bin $(pwd) $(pwd)
+	echo local -eu cd --verbose test
+	grep cd "$@" test printf grep "$@" 'quoted text' export && printf
+		grep | sed 'quoted text' export
+	grep sed printf printf local
+		x=1 sed export local readonly /usr/bin /usr/bin | done
+then readonly readonly echo --verbose sed "$@" $(pwd) then readonly then
+	"$@" local done "$@" sed
+	then test echo awk readonly test $(pwd) awk test printf
+"$1" cd 2>/dev/null then
+		then awk export done awk readonly 'quoted text' --verbose readonly
+grep 'quoted text' readonly awk
+		$(pwd) export readonly "$1" | 'quoted text' x=1 --verbose
+$(pwd) test /usr/bin "$1" "$1" "$@" -eu "$@" test echo then
+then ${HOME} test export "$@" /usr/bin
+	printf "$1" | 2>/dev/null /usr/bin
+| /usr/bin 2>/dev/null echo x=1 test awk awk "$@" ${HOME} local "$1"
+	awk x=1 awk readonly printf sed x=1 --verbose --verbose then echo then 'quoted text'
+		| local --verbose then grep local x=1 echo echo /usr/bin | echo
+	/usr/bin --verbose ${HOME} /usr/bin
+		${HOME} ${HOME} | test
+		'quoted text' test "$1" 'quoted text'
+	readonly 2>/dev/null 'quoted text'
+printf $(pwd) "$@" readonly | ${HOME} printf
+		| 'quoted text' "$@" export 'quoted text' ${HOME}
+		'quoted text' 2>/dev/null
+	echo export export --verbose "$1" ${HOME} ${HOME} /usr/bin --verbose test &&
+$(pwd) 'quoted text' --verbose
+$(pwd) grep $(pwd) --verbose
+	&& sed x=1 sed test /usr/bin awk grep "$1" done
+sed printf -eu readonly $(pwd) awk 2>/dev/null
+	cd "$@" readonly readonly done -eu cd |
+awk echo ${HOME} --verbose /usr/bin | $(pwd) $(pwd)
+	then test x=1 then $(pwd) 'quoted text' export printf /usr/bin $(pwd) &&
+		printf $(pwd) then echo && echo readonly ${HOME}
+	/usr/bin echo ${HOME} then $(pwd) "$@" -eu sed readonly awk local "$1" local
+export 'quoted text' then export test /usr/bin
+		local x=1 done && 'quoted text' printf $(pwd) 'quoted text' printf printf sed cd
+	export echo awk -eu 'quoted text'
+		readonly export awk | grep
+		| then 2>/dev/null local export test grep /usr/bin ${HOME} "$@"
+"$@" cd export "$@" --verbose 2>/dev/null
+test && "$1" export $(pwd) "$@" 'quoted text' "$@" $(pwd) x=1 "$@" readonly
+	printf export export $(pwd) then "$@" -eu awk then "$1" test echo
+	"$@" ${HOME} local done && "$1"
+		"$@" x=1 then /usr/bin 'quoted text'
+	cd local cd -eu local export cd "$@" --verbose
+echo readonly 2>/dev/null test -eu 'quoted text'
+	then | 2>/dev/null sed "$1"
+test readonly x=1 then echo -eu then local awk readonly
+local x=1 -eu grep "$1" cd grep done
+&& test done then sed --verbose --verbose export readonly && sed $(pwd)
+	printf ${HOME} -eu 'quoted text'
+	awk sed /usr/bin "$@" 'quoted text' | readonly cd export && grep test -eu
+2>/dev/null done && -eu && printf readonly readonly x=1 2>/dev/null done ${HOME}
+		/usr/bin | sed | $(pwd) awk ${HOME}
+cd $(pwd) awk 'quoted text' && "$@" 2>/dev/null local 'quoted text'
+	done --verbose readonly sed | 2>/dev/null ${HOME} /usr/bin 2>/dev/null
+	-eu then "$1" then printf local $(pwd) x=1 2>/dev/null --verbose $(pwd)
+$(pwd) echo 2>/dev/null awk && grep test awk export "$@"
+	| -eu test sed then --verbose
+		echo readonly -eu $(pwd) then
+	x=1 echo x=1 /usr/bin $(pwd) local 'quoted text'
+		printf | $(pwd) readonly grep done && "$@" 2>/dev/null
+	2>/dev/null done -eu $(pwd) awk done ${HOME} cd $(pwd) grep x=1
+	&& x=1 test "$@" echo 2>/dev/null done awk /usr/bin
+readonly then echo && "$@" /usr/bin readonly
+	test $(pwd) 'quoted text' test "$@" x=1 $(pwd) printf
+echo | cd | && test local printf
+grep --verbose "$@" $(pwd) ${HOME} echo test export
+		echo ${HOME} /usr/bin --verbose "$1" grep
+-eu && cd export "$@" awk 'quoted text' echo printf
+	${HOME} 2>/dev/null done ${HOME} test 'quoted text'
+then /usr/bin && cd --verbose 'quoted text' awk awk
+| "$@" | x=1 $(pwd) x=1 'quoted text' ${HOME}
+	echo /usr/bin --verbose --verbose test test echo echo
+	| awk grep $(pwd) "$1" 'quoted text'
+readonly && 'quoted text' test $(pwd) grep "$@" export done "$1" export
+-eu printf readonly "$1" cd "$@" -eu sed local "$1" test ${HOME} echo && $(pwd)
+		cd -eu ${HOME} 2>/dev/null -eu readonly
+&& export "$1" echo ${HOME} done -eu cd cd x=1 sed "$@" sed cd printf
+		export $(pwd) /usr/bin done local local sed cd export cd "$1" readonly cd then
+	--verbose grep --verbose local 2>/dev/null test -eu x=1 ${HOME}
+	| printf test "$@" done "$1" export readonly x=1 local ${HOME} $(pwd) 2>/dev/null
+		printf awk echo --verbose
+	-eu echo x=1 x=1 sed then printf 2>/dev/null echo readonly -eu
+	cd printf && awk && test echo grep 2>/dev/null
+		cd local local -eu done then printf 'quoted text'
+sed | $(pwd) then test x=1 "$1" /usr/bin
+2>/dev/null -eu x=1 x=1 "$@" $(pwd) x=1 ${HOME} awk local
+$(pwd) printf 'quoted text' -eu
+		"$@" readonly ${HOME} printf grep /usr/bin local
+	2>/dev/null test x=1 grep
+-eu --verbose | "$@" cd awk --verbose -eu 'quoted text'
+	sed sed -eu | printf cd then "$1" --verbose test --verbose done readonly
+	/usr/bin local 'quoted text' readonly sed awk cd
+	local "$@" --verbose -eu "$1" grep 'quoted text' awk then x=1 then 'quoted text'
+		printf 'quoted text' cd "$1" ${HOME} 'quoted text' test printf -eu
+	awk x=1 --verbose -eu 'quoted text' export "$@" --verbose
+	x=1 readonly | --verbose echo printf
+--verbose then cd cd local export test grep
+$(pwd) /usr/bin then grep export "$1" 'quoted text' | /usr/bin 'quoted text'
+	"$1" $(pwd) /usr/bin 'quoted text' x=1 && test "$@" printf readonly
+readonly | export then local done -eu --verbose "$@"
+		local local awk then
+local echo --verbose --verbose && grep 'quoted text' -eu echo
+	printf echo "$@" "$@" then | | x=1 && readonly 'quoted text'
+	echo x=1 | "$@" local sed awk | local 'quoted text'
+export local -eu printf -eu && export local x=1 $(pwd) sed grep awk /usr/bin
+	export 2>/dev/null cd "$@" ${HOME} cd printf && 'quoted text'
+$(pwd) ${HOME} export sed local 2>/dev/null 2>/dev/null
+	test echo "$@" --verbose $(pwd) $(pwd) cd && grep /usr/bin
+		${HOME} "$1" | local
+		local -eu "$@" cd "$@" sed cd $(pwd) local x=1 | printf
+export 2>/dev/null sed local x=1 export done -eu && "$1" then test ${HOME}
+	export done ${HOME} 2>/dev/null
+	local 2>/dev/null then 2>/dev/null export /usr/bin
+then done local grep --verbose awk
+	2>/dev/null $(pwd) grep -eu 'quoted text' done x=1 awk grep echo printf
+	--verbose $(pwd) cd | $(pwd) && -eu --verbose
+echo -eu export printf local test -eu && /usr/bin readonly |
+		local printf test ${HOME} 2>/dev/null echo "$1" x=1 ${HOME}
+		'quoted text' grep local awk echo
+	test test local "$@" printf
+	"$1" test done awk -eu grep awk
+test done readonly export /usr/bin readonly local local "$1" local x=1
+		"$1" 2>/dev/null test test done 2>/dev/null sed ${HOME} grep "$1"
+		sed local ${HOME} "$1" -eu echo local | ${HOME} printf | /usr/bin
+&& -eu readonly | && cd ${HOME} | printf ${HOME}
+	local sed 'quoted text' 2>/dev/null && readonly | test 2>/dev/null grep readonly
+	x=1 cd && $(pwd) "$@" awk local grep ${HOME}
+		"$1" 2>/dev/null /usr/bin /usr/bin x=1 "$1" -eu $(pwd) done awk
+	| $(pwd) "$@" 'quoted text' grep "$1" grep grep $(pwd) then $(pwd) done
+		$(pwd) grep $(pwd) && then && printf && --verbose cd "$1" echo then 2>/dev/null
+		$(pwd) x=1 printf readonly x=1 "$@" 'quoted text'
+		export --verbose sed --verbose done then test printf local
+	sed grep "$1" test x=1 done 2>/dev/null x=1 -eu x=1
+grep ${HOME} ${HOME} then -eu | readonly -eu export --verbose
+grep --verbose && 2>/dev/null printf printf /usr/bin test
+	grep && cd cd sed export x=1 printf
+--verbose grep ${HOME} grep "$1" local echo printf 2>/dev/null
+	'quoted text' && done 'quoted text' sed test local ${HOME} && | sed x=1 2>/dev/null
+	export ${HOME} -eu -eu echo x=1 x=1 awk cd 2>/dev/null printf
+| then "$@" printf | "$@" export "$1" cd export echo local
+		local "$1" $(pwd) -eu sed local sed 'quoted text' /usr/bin
+		printf awk done -eu $(pwd) | /usr/bin export
+		printf printf -eu awk then && done "$@" "$1"
+readonly local "$1" $(pwd) then sed && && /usr/bin export cd -eu cd echo 'quoted text'
+	&& local /usr/bin ${HOME} ${HOME} 2>/dev/null 2>/dev/null readonly
+-eu echo awk cd done 'quoted text' -eu printf 2>/dev/null echo && "$1" cd "$1"
+	"$@" echo done && --verbose $(pwd) 2>/dev/null
+		grep $(pwd) awk x=1 'quoted text' $(pwd)
+'quoted text' x=1 printf printf x=1 grep $(pwd) sed $(pwd) then local printf &&
+		awk "$@" echo echo awk $(pwd) && -eu &&
+	'quoted text' cd 2>/dev/null "$@" --verbose then awk printf
+test printf sed then export -eu echo cd x=1 echo
+readonly sed | /usr/bin printf done test "$@"
+		local then export 'quoted text'
+test 'quoted text' echo sed ${HOME} awk local ${HOME} test export /usr/bin ${HOME}
+	local "$@" test cd x=1 | cd done $(pwd)
+done local done | --verbose local -eu /usr/bin done
+		"$1" 'quoted text' readonly
+$(pwd) --verbose then grep "$@" --verbose /usr/bin /usr/bin 'quoted text'
+	local cd ${HOME} && 'quoted text' x=1 cd local ${HOME} 'quoted text' readonly
+		--verbose 2>/dev/null readonly ${HOME} awk cd sed local
+		then printf "$@" test local -eu --verbose sed done 2>/dev/null
+cd export printf 2>/dev/null 'quoted text'
+	printf -eu x=1 | 2>/dev/null "$@" "$1" "$1" sed ${HOME} 'quoted text' done
+	awk "$@" "$1" sed then awk "$1" $(pwd) x=1
+	printf --verbose echo -eu && awk printf $(pwd) 'quoted text'
+		then 2>/dev/null x=1 "$@" done
+	$(pwd) "$1" --verbose printf
+	echo readonly /usr/bin 2>/dev/null local
+		&& | grep awk readonly |
+		--verbose done then && done $(pwd) then grep export
+echo then local grep printf export then awk cd done export readonly 2>/dev/null
+2>/dev/null printf && 'quoted text' "$@" done then sed awk
+	export /usr/bin x=1 "$@" grep readonly
+	grep "$@" then readonly x=1 readonly echo | printf
+		"$@" /usr/bin -eu echo $(pwd) test 'quoted text' x=1 local echo local /usr/bin
+		x=1 -eu sed done --verbose export then grep
+	echo "$1" then echo local ${HOME}
+readonly x=1 x=1 ${HOME} x=1 $(pwd) --verbose --verbose sed /usr/bin
+	2>/dev/null local done 'quoted text' export
+	local local x=1 then --verbose grep x=1 /usr/bin
+	readonly echo "$1" "$1" ${HOME} 'quoted text' cd 2>/dev/null
+	cd && 'quoted text' cd done "$1" x=1 'quoted text'
+then -eu printf -eu "$1"
+then "$1" done --verbose && 2>/dev/null then then /usr/bin export readonly
+		cd printf "$1" grep grep 'quoted text' awk printf ${HOME}
+		grep --verbose done --verbose
+	echo 2>/dev/null /usr/bin ${HOME}
+		grep printf $(pwd) local printf echo 2>/dev/null 2>/dev/null
+		export 'quoted text' test awk cd local && export done echo grep
+--verbose ${HOME} readonly test /usr/bin
+awk ${HOME} printf 2>/dev/null
+		${HOME} $(pwd) --verbose --verbose
+	awk then $(pwd) awk 'quoted text' grep cd export grep $(pwd) -eu x=1 export
+${HOME} cd | --verbose $(pwd) 2>/dev/null | -eu echo sed -eu echo export
+	"$1" --verbose ${HOME} sed -eu echo && export test cd cd
+	${HOME} /usr/bin | | | cd | 'quoted text'
+		${HOME} then test "$@" echo $(pwd)
+	| then grep export grep && test && cd printf awk test sed --verbose /usr/bin
+		grep ${HOME} local 'quoted text' ${HOME} -eu printf done "$1" | | | readonly
+		| | $(pwd) sed $(pwd) export
+		2>/dev/null readonly grep awk
+	done export 2>/dev/null done
+		| | | && awk && echo "$@" --verbose sed | --verbose sed printf echo printf
+		$(pwd) x=1 --verbose "$1" 2>/dev/null
+	printf echo | readonly 'quoted text'
+	2>/dev/null awk 'quoted text' echo && printf printf
+awk then | export 2>/dev/null test test then -eu awk
+		'quoted text' && ${HOME} awk cd --verbose test "$1" grep x=1 then
+	test "$@" 'quoted text' local
+		awk ${HOME} 2>/dev/null --verbose echo readonly
+echo local "$@" export done cd test
+	grep "$@" done done 'quoted text' local done /usr/bin 2>/dev/null "$@"
+/usr/bin /usr/bin && echo 2>/dev/null cd --verbose "$1" -eu grep cd test
+		x=1 | 'quoted text' sed echo awk printf "$@"
+		printf -eu local then cd readonly
+	"$@" done grep echo "$1" $(pwd) done --verbose
+	'quoted text' && local | printf readonly 'quoted text' ${HOME} sed
+		-eu local "$@" 2>/dev/null sed --verbose "$@"
+	/usr/bin $(pwd) -eu $(pwd) done -eu cd readonly
+		cd cd awk && then 2>/dev/null
+	${HOME} $(pwd) "$@" "$1" -eu /usr/bin $(pwd) test && 'quoted text' local
+sed local readonly -eu printf && printf printf ${HOME} sed grep 'quoted text'
+	x=1 -eu printf done "$1" 'quoted text' 'quoted text' --verbose "$@" /usr/bin
+readonly echo done local /usr/bin
+then sed cd readonly "$@" ${HOME} && |
+	export && echo done "$@" "$@" --verbose x=1 $(pwd)
+'quoted text' test awk cd -eu 2>/dev/null sed sed done 2>/dev/null printf
+"$1" | x=1 --verbose then /usr/bin awk local
+"$@" -eu /usr/bin echo printf grep | "$1" /usr/bin test
+awk sed -eu awk awk echo --verbose /usr/bin
+	| --verbose 2>/dev/null cd printf awk --verbose
+'quoted text' 2>/dev/null
+	&& printf 2>/dev/null && ${HOME} export $(pwd)
+cd 'quoted text' test then then -eu 'quoted text'
+printf && $(pwd) then &&
+	printf | "$@" ${HOME} /usr/bin 2>/dev/null done readonly 'quoted text'
+		&& 2>/dev/null 2>/dev/null cd && "$@" awk $(pwd) /usr/bin
+	2>/dev/null ${HOME} export /usr/bin
+		grep "$1" /usr/bin $(pwd) $(pwd) ${HOME} then "$@"
+"$1" && test grep "$1" printf echo | awk "$1" $(pwd) local && cd awk
+		sed done 2>/dev/null printf then sed grep | test
+	| export export --verbose sed export 'quoted text' x=1 x=1 test
+x=1 | 2>/dev/null printf echo "$1" export grep -eu | && /usr/bin printf
+$(pwd) grep && printf -eu echo sed | "$1" --verbose
+${HOME} | then done readonly printf ${HOME} cd echo grep
+		| ${HOME} echo 2>/dev/null then && ${HOME} && readonly then test cd
+		sed readonly /usr/bin /usr/bin | echo printf $(pwd)
+	x=1 export 2>/dev/null printf local 'quoted text' echo then readonly /usr/bin
+	"$@" cd -eu x=1 export readonly
+'quoted text' then echo ${HOME}
+	export export awk x=1 done /usr/bin
+export | -eu 2>/dev/null 'quoted text' then --verbose
+		grep "$1" $(pwd) sed local echo --verbose x=1 2>/dev/null
+		"$@" /usr/bin "$@" done local /usr/bin -eu ${HOME} "$@"
+	2>/dev/null test printf | x=1 $(pwd) printf 2>/dev/null cd printf printf grep
+	readonly readonly 'quoted text'
+	/usr/bin "$1" ${HOME} && "$1"
+	export --verbose then export cd done && awk test 2>/dev/null
+		| 'quoted text' readonly awk "$1" -eu "$@"
+	"$@" 'quoted text' test cd --verbose printf export
+	--verbose echo then grep awk readonly test "$1" grep
+echo readonly 'quoted text' echo
+	/usr/bin "$1" $(pwd) $(pwd) done /usr/bin
+		sed "$@" cd grep printf && cd --verbose sed 'quoted text' cd export $(pwd)
+		&& $(pwd) | "$@" "$1" && 'quoted text' --verbose cd readonly && "$1" -eu "$@"
+		test export grep "$@" local sed "$1" echo /usr/bin x=1 | "$1" cd echo x=1
+local export 2>/dev/null /usr/bin
+	-eu 2>/dev/null test echo grep test "$@" test then 2>/dev/null && 'quoted text'
+		export ${HOME} cd -eu test "$@" done printf export "$@" done
+	then 2>/dev/null --verbose printf $(pwd) "$1" local --verbose x=1 "$@"
+		test cd x=1 done grep cd then cd -eu echo "$1"
+	&& ${HOME} grep then x=1 sed then "$1" | export echo x=1 cd --verbose
+local sed echo 2>/dev/null printf
+--verbose ${HOME} "$@" "$@"
+then cd && "$1" $(pwd) $(pwd) done export
+	-eu 'quoted text' ${HOME} 'quoted text' 2>/dev/null readonly x=1 awk $(pwd) awk
+		${HOME} "$@" x=1 echo awk grep -eu sed | -eu --verbose x=1
+		grep 'quoted text' sed export then printf cd | awk
+/usr/bin sed 2>/dev/null sed awk --verbose "$@" 2>/dev/null | ${HOME}
+	then $(pwd) ${HOME} 'quoted text' 'quoted text' test test echo --verbose
+	sed 2>/dev/null 'quoted text' 2>/dev/null /usr/bin
+	x=1 awk grep export /usr/bin 'quoted text' "$@" done export sed x=1
+	x=1 cd grep printf then /usr/bin
+		local grep done sed x=1 then "$@" &&
+	echo local awk | done echo
+-eu /usr/bin then local grep && readonly awk /usr/bin --verbose x=1 local "$@"
+		&& readonly x=1 echo -eu then -eu test ${HOME} export done
+-eu sed "$@" && | export 2>/dev/null export -eu 2>/dev/null echo awk ${HOME}
+		x=1 | awk cd grep 2>/dev/null
+	&& 2>/dev/null sed done | grep
+		awk 2>/dev/null /usr/bin readonly x=1 "$@" "$1" | 2>/dev/null 'quoted text'
+	2>/dev/null grep /usr/bin 'quoted text' | cd 2>/dev/null
+		/usr/bin readonly cd test x=1 -eu x=1 local --verbose export
+| $(pwd) readonly export /usr/bin readonly $(pwd) x=1 | "$1"
+/usr/bin then /usr/bin echo x=1 printf export 2>/dev/null ${HOME} done
+awk 'quoted text' && done | /usr/bin
+sed printf /usr/bin printf ${HOME} "$1" x=1 test ${HOME} 'quoted text' awk $(pwd)
+		'quoted text' 2>/dev/null x=1 awk
+	x=1 export "$@" x=1 "$@" cd &&
+	test export sed 'quoted text' "$@" "$1" sed export grep $(pwd)
+	/usr/bin sed /usr/bin export awk sed then x=1 export grep grep -eu echo printf
+		sed then local cd --verbose then export local awk "$@" | "$1"
+		x=1 local done readonly
+		"$@" echo ${HOME} echo cd local cd cd test /usr/bin 2>/dev/null
+	/usr/bin then sed test "$@" echo readonly ${HOME} cd done
+		&& cd done readonly x=1 --verbose printf export sed cd sed && "$@" $(pwd)
+printf 'quoted text' x=1 echo echo test x=1 done printf -eu awk | x=1 grep
+	echo 'quoted text' 'quoted text' test "$1" printf awk echo 'quoted text'
+local -eu done then sed $(pwd) cd test cd printf "$1" then then
+		&& --verbose printf grep && test && $(pwd)
+	readonly 'quoted text' 2>/dev/null x=1 cd cd printf && 2>/dev/null "$1"
+		printf x=1 printf local done echo x=1 awk | --verbose done
+		$(pwd) printf "$1" local ${HOME} -eu && /usr/bin cd awk awk grep
+		local export grep sed ${HOME}
+	echo printf 2>/dev/null cd printf "$@" sed done sed cd "$@"
+		| echo local readonly done
+	${HOME} x=1 done done printf -eu --verbose printf grep echo
+	--verbose "$@" --verbose x=1 ${HOME} test done --verbose
+sed awk 'quoted text' then | --verbose | --verbose "$@" "$@"
+		cd export "$@" "$@" /usr/bin ${HOME} ${HOME} "$@"
+x=1 --verbose awk ${HOME} /usr/bin x=1 test
+		local then ${HOME} x=1 awk &&
+	sed printf awk grep -eu 'quoted text' -eu test printf 2>/dev/null | --verbose
+		$(pwd) grep | then x=1 done grep /usr/bin
+	&& | --verbose readonly 2>/dev/null --verbose "$@"
+${HOME} awk | local "$@"
+		printf "$1" echo "$@" x=1 done cd export
+	readonly -eu echo sed then 2>/dev/null local "$1" done 2>/dev/null x=1 test | done
+		2>/dev/null "$@" test awk x=1 sed && "$1" 'quoted text'
+		${HOME} "$@" local 2>/dev/null
+	--verbose awk && "$@" awk 2>/dev/null
+	--verbose done local cd 2>/dev/null
+		"$1" $(pwd) local "$1" | | cd "$@" $(pwd) | echo local cd "$@" test readonly
+/usr/bin cd awk -eu cd "$1" test "$1" local echo done grep
+	printf "$1" -eu && --verbose --verbose 2>/dev/null
+		"$@" echo readonly printf 'quoted text' test local sed
+		$(pwd) echo /usr/bin 'quoted text'
+	sed -eu local ${HOME} echo 'quoted text' export 2>/dev/null && test "$@" 2>/dev/null
+	'quoted text' echo awk && "$1" -eu done echo 2>/dev/null
+		export 'quoted text' ${HOME} -eu done local "$1" export local "$1"
+	"$@" export awk printf "$@" | | grep
+	"$1" -eu /usr/bin local then
+		sed $(pwd) $(pwd) readonly 2>/dev/null sed && test /usr/bin "$1" x=1 grep /usr/bin
+| --verbose "$1" done ${HOME}
+grep grep "$1" x=1 test readonly "$@" | export -eu | ${HOME} grep
+		x=1 x=1 then awk echo ${HOME} then
+		grep "$1" 2>/dev/null local /usr/bin /usr/bin
+	test /usr/bin | && x=1 sed "$@" 2>/dev/null printf
+	cd cd --verbose grep then readonly 2>/dev/null
+	cd readonly cd echo /usr/bin -eu && -eu local done local ${HOME} ${HOME}
+		$(pwd) sed --verbose x=1 /usr/bin "$@" grep done "$@" "$1" readonly | | export
+	"$1" test $(pwd) export then cd then then "$@"
+		local awk /usr/bin local "$@"
+		echo grep $(pwd) awk
+sed -eu 'quoted text' export "$1" export test $(pwd) export grep printf "$@"
+		readonly export then test 'quoted text' printf $(pwd) test local test
+		printf echo "$1" $(pwd) cd "$@" then ${HOME} 2>/dev/null
+-eu cd printf | "$@" | 2>/dev/null | -eu cd local "$@" | --verbose
+printf export done $(pwd) awk "$1" "$1" printf "$1" printf
+		$(pwd) done readonly && sed export
+		local /usr/bin printf readonly -eu
+	grep local test | test ${HOME} grep | grep awk ${HOME}
+		export ${HOME} test "$@" test 2>/dev/null printf sed echo 'quoted text'
+	export cd readonly -eu done awk local
+&& readonly export "$@" sed | export $(pwd)
+--verbose sed printf $(pwd) "$@" /usr/bin printf 2>/dev/null then
+	echo echo sed "$@" grep /usr/bin "$1" done ${HOME}
+	test done local export "$@"
+	sed test && test readonly 'quoted text'
+	sed "$1" && && /usr/bin export ${HOME} grep printf export echo 2>/dev/null
+awk sed 2>/dev/null /usr/bin then done
+"$@" -eu done readonly --verbose cd done "$1" printf export "$@" echo | test
+	/usr/bin grep x=1 x=1 then "$@"
+--verbose done test export | grep
+	--verbose --verbose sed test -eu "$1" done x=1 $(pwd) "$@" done | awk
+'quoted text' grep x=1 local -eu
+		-eu local grep "$@" export then then /usr/bin
+	cd -eu then -eu "$1" printf --verbose cd | echo awk "$@"
+'quoted text' cd export 'quoted text' && && export printf
+		readonly ${HOME} && /usr/bin printf done ${HOME} && grep echo
+	"$1" | 'quoted text' -eu printf "$@" then test | printf echo awk printf ${HOME}
+	cd done printf "$1" 2>/dev/null export --verbose local 'quoted text' x=1 x=1 |
+	readonly ${HOME} 'quoted text' 2>/dev/null then ${HOME}
+		local done $(pwd) readonly 'quoted text' "$@"
+	cd echo printf local x=1 x=1 /usr/bin /usr/bin
+-eu printf cd && awk export cd ${HOME} echo grep 'quoted text'
+		printf cd export local 2>/dev/null
+		/usr/bin grep x=1 then grep ${HOME}
+		readonly test then x=1 printf test -eu done -eu ${HOME}
+		--verbose 2>/dev/null sed /usr/bin "$@" | /usr/bin $(pwd) grep ${HOME}
+	cd export test awk sed grep 'quoted text' x=1 ${HOME}
+awk printf awk then /usr/bin
+		'quoted text' export sed "$1" test
+		done 'quoted text' "$1" readonly printf | export ${HOME} $(pwd)
+	cd $(pwd) printf export "$1" local grep &&
+grep x=1 "$@" sed --verbose "$1" --verbose 'quoted text'
+readonly local x=1 ${HOME} cd 2>/dev/null "$@" $(pwd) 'quoted text'
+/usr/bin --verbose x=1
+	printf -eu --verbose then local
+		-eu -eu local 'quoted text' 2>/dev/null
+		/usr/bin $(pwd) "$1" test --verbose ${HOME} -eu && export local --verbose
+done && cd awk ${HOME} "$@" awk "$@" ${HOME} grep 'quoted text' /usr/bin
+x=1 echo done 2>/dev/null "$1" --verbose export readonly awk
+		| -eu sed export readonly
+		cd cd done --verbose export ${HOME} sed local
+	test grep cd 'quoted text' echo ${HOME} then done "$1" awk then ${HOME} /usr/bin
+	${HOME} done sed /usr/bin printf grep 'quoted text' x=1
+readonly "$@" "$1" "$1" --verbose "$1" grep awk
+		${HOME} cd export sed && | awk x=1 2>/dev/null then && then
+	sed /usr/bin -eu "$@" $(pwd)
+--verbose export x=1
+		--verbose "$@" export printf 'quoted text' | done cd && | echo grep 'quoted text'
+	"$1" ${HOME} printf 2>/dev/null export $(pwd) "$1" ${HOME}
+		2>/dev/null 'quoted text' 'quoted text' grep ${HOME}
+x=1 --verbose readonly "$1"
+		'quoted text' "$@" local sed done awk then test done x=1 'quoted text'
+	-eu then sed -eu test $(pwd) export
+	printf "$@" && "$1" $(pwd) 'quoted text'
+		echo /usr/bin --verbose -eu grep
+printf readonly then done 'quoted text' "$1" export "$1" ${HOME}
+	test ${HOME} grep done
+2>/dev/null -eu test 2>/dev/null
+#include c36.sh
+		cd then then awk 2>/dev/null | && --verbose
+		readonly awk "$1" cd /usr/bin
+printf printf x=1 readonly readonly
+		x=1 cd $(pwd) grep && 2>/dev/null "$@" | then test readonly && 'quoted text' test
+		export $(pwd) && --verbose
+		test test sed done cd done $(pwd) readonly | 'quoted text'
+		then && echo sed local sed $(pwd) -eu 2>/dev/null 2>/dev/null ${HOME}
+	2>/dev/null x=1 /usr/bin readonly cd 2>/dev/null | && cd grep -eu
+		x=1 "$@" done export then x=1
+	printf cd "$1" echo echo
+	cd grep ${HOME} awk cd "$@" grep 2>/dev/null local done /usr/bin
+	2>/dev/null done export && cd local "$1" && "$1"
+awk printf export export 'quoted text' echo "$1" 2>/dev/null
+		test grep test "$@" cd "$1" "$@" cd -eu done test -eu readonly
+printf --verbose 2>/dev/null
+	readonly "$@" -eu awk done 2>/dev/null "$@" grep /usr/bin &&
+echo echo -eu "$1" --verbose && then then ${HOME} export -eu
+		&& done then 'quoted text' $(pwd) cd --verbose | /usr/bin
+		/usr/bin export then test "$1" "$1" ${HOME} 2>/dev/null x=1 "$@" $(pwd) $(pwd)
+${HOME} cd then done -eu then local export
+'quoted text' "$@" done
+	| /usr/bin $(pwd) test | 2>/dev/null
+	awk done -eu local readonly echo export printf 2>/dev/null readonly done
+		${HOME} local "$1" /usr/bin grep
+		/usr/bin && export cd "$1" then echo ${HOME} echo local ${HOME} x=1
+'quoted text' grep x=1 test printf done
+	local $(pwd) done then local
+	&& x=1 | 2>/dev/null /usr/bin test && export $(pwd) done echo sed &&
+	local ${HOME} $(pwd) && && printf local awk done sed then
+	"$1" done sed 2>/dev/null echo local local readonly
+		grep ${HOME} local $(pwd) x=1 printf printf echo grep local local 'quoted text'
+	readonly printf /usr/bin echo --verbose export
+	printf echo 'quoted text' 2>/dev/null printf echo &&
+		$(pwd) 'quoted text' local -eu $(pwd) local awk then -eu sed --verbose
+	-eu then x=1 echo 'quoted text' readonly cd "$@" printf x=1 --verbose 'quoted text'
+	readonly then awk sed test "$1" -eu awk --verbose done 'quoted text'
+	"$1" export cd then cd printf && awk then grep -eu -eu -eu printf
+		done grep done 2>/dev/null local test "$1" then 'quoted text'
+"$@" 'quoted text' -eu readonly
+	readonly export grep grep local $(pwd) | | $(pwd) -eu cd cd echo local
+		| test 'quoted text' cd | test x=1 "$@" grep && | ${HOME} test 'quoted text'
+	&& x=1 printf && printf printf test
+		local done | grep then $(pwd) cd sed -eu --verbose sed --verbose 2>/dev/null
+	x=1 local x=1 2>/dev/null && x=1 awk 2>/dev/null done
+	echo test done 'quoted text' sed
+		x=1 then && $(pwd) export done -eu /usr/bin then
+export ${HOME} then x=1 2>/dev/null "$@" -eu test && -eu done
+	| done | export 2>/dev/null awk && cd 'quoted text'
+$(pwd) echo awk export readonly $(pwd) awk cd test sed sed
+	2>/dev/null ${HOME} awk cd printf test && 2>/dev/null
+'quoted text' echo awk | "$@" --verbose /usr/bin $(pwd) $(pwd)
+	then ${HOME} grep then echo awk done local
+	cd && | test x=1 "$@" --verbose readonly export --verbose $(pwd) readonly
+--verbose printf readonly
+		awk 2>/dev/null sed "$@" sed
+	test cd | done /usr/bin echo ${HOME} 'quoted text'
+	then done "$@" ${HOME} | grep then test grep printf x=1 readonly "$1" done readonly
+		awk printf local cd cd readonly
+	awk "$1" | printf /usr/bin test done ${HOME} sed grep "$@" echo done
+		local ${HOME} printf && "$1" grep "$@"
+		$(pwd) 'quoted text' echo export
+	--verbose local awk 2>/dev/null awk -eu
+	"$1" echo $(pwd) && && "$@" local
+		local cd -eu printf |
+	sed echo "$@" done --verbose --verbose $(pwd) readonly readonly 2>/dev/null awk
+done && test | /usr/bin grep "$@" export awk "$1" /usr/bin echo
+		| done grep cd readonly -eu then 2>/dev/null ${HOME} 2>/dev/null
+	cd printf | cd x=1 done awk --verbose then then
+	export -eu printf -eu
+	"$1" then "$@" && readonly grep awk then grep $(pwd) local test grep export
+	$(pwd) 2>/dev/null readonly then x=1 export readonly | echo sed
+grep 2>/dev/null local "$1" echo && $(pwd) x=1 ${HOME} printf
+local "$1" && sed /usr/bin then &&
+	x=1 -eu && 2>/dev/null
+	x=1 2>/dev/null 'quoted text'
+	local local -eu cd then echo | readonly "$1" test cd done --verbose
+/usr/bin test $(pwd) printf
+readonly then done "$@" sed awk && $(pwd) -eu echo "$1"
+	local then echo done ${HOME} printf local "$@" "$@"
+| 2>/dev/null x=1 "$1" then && awk test test done 2>/dev/null
+	local test readonly $(pwd) echo test
+		local x=1 echo "$1" test
+		&& $(pwd) --verbose 'quoted text' awk awk grep
+		echo "$1" /usr/bin --verbose cd /usr/bin --verbose done /usr/bin $(pwd) cd readonly
+		then x=1 && test printf grep local grep x=1 local &&
+	sed export local then | $(pwd) && printf
+x=1 && "$1" done sed x=1 cd ${HOME} sed done grep then
+"$1" ${HOME} local -eu /usr/bin /usr/bin --verbose sed sed
+	readonly && export readonly then 2>/dev/null && -eu awk done sed echo done x=1 then
+		sed sed | cd printf $(pwd) ${HOME} printf --verbose sed "$@" "$1" then --verbose
+	-eu echo local printf | ${HOME} echo local
+		--verbose x=1 local echo
+		x=1 "$1" "$1" echo x=1 2>/dev/null
+| --verbose && -eu $(pwd) export echo awk done 'quoted text' sed grep x=1 local
+	grep sed x=1 x=1 ${HOME} ${HOME} grep echo ${HOME} export
+	done ${HOME} test done 2>/dev/null ${HOME} "$@" readonly -eu
+${HOME} local /usr/bin done $(pwd) export 2>/dev/null
+readonly sed 2>/dev/null export | test --verbose
+	| "$1" echo sed && echo $(pwd) /usr/bin "$1"
+	&& ${HOME} printf "$1" /usr/bin done 'quoted text' | && "$1" awk export
+awk $(pwd) printf echo cd x=1 ${HOME} -eu /usr/bin ${HOME} grep
+/usr/bin done export cd readonly
+awk $(pwd) -eu "$1" -eu --verbose done "$@" "$1" awk
+		then 2>/dev/null local export printf $(pwd) $(pwd) local
+	echo grep && 'quoted text' $(pwd) test
+| export sed test $(pwd) x=1 && 'quoted text' done 'quoted text' ${HOME} | then
+"$@" grep printf --verbose $(pwd) readonly cd local cd 2>/dev/null
+/usr/bin printf $(pwd) $(pwd) readonly /usr/bin x=1 awk $(pwd)
+| -eu readonly then then
+"$1" $(pwd) sed 2>/dev/null ${HOME} local echo $(pwd) | awk cd
+	/usr/bin readonly sed 'quoted text' 2>/dev/null -eu readonly x=1 sed "$@"
+	readonly "$@" x=1 2>/dev/null "$@"
+cd x=1 -eu x=1 x=1 echo local done | printf export 2>/dev/null -eu printf
+		'quoted text' ${HOME} printf "$@" readonly test sed -eu
+	&& | && 'quoted text' cd "$1" local "$1" sed grep
+export echo grep -eu sed done /usr/bin then
+	${HOME} export 'quoted text' test && done printf done test "$@" && x=1 echo
+	${HOME} local awk && done sed --verbose
+	&& --verbose grep "$1" printf
+		x=1 --verbose then awk "$1" /usr/bin sed grep "$1" --verbose then sed
+		x=1 printf x=1 && then awk -eu "$@" export -eu x=1 "$@" $(pwd)
+	readonly --verbose cd grep ${HOME} 'quoted text' readonly grep
+printf /usr/bin echo printf --verbose
+local | sed printf then ${HOME}
+"$1" x=1 /usr/bin sed done readonly echo && awk test -eu export
+	printf awk ${HOME} sed $(pwd)
+	$(pwd) cd cd sed grep x=1 local grep "$1" echo -eu -eu test
+	done echo done export | local readonly x=1 /usr/bin awk then ${HOME}
+		"$@" awk x=1 | "$@" 2>/dev/null -eu ${HOME} sed test cd
+		/usr/bin test export ${HOME} "$@" readonly
+	| "$1" | cd sed | ${HOME} awk x=1 awk echo 'quoted text' ${HOME} ${HOME}
+	/usr/bin | --verbose --verbose
+readonly readonly cd ${HOME} done "$1" x=1 printf local "$1" awk /usr/bin
+		then /usr/bin sed local done cd |
+	cd ${HOME} && export done test echo &&
+		test 2>/dev/null printf | ${HOME} $(pwd) cd test x=1 readonly
+$(pwd) 'quoted text' --verbose -eu ${HOME}
+printf -eu /usr/bin done cd grep
+| "$@" printf cd grep test printf 'quoted text' $(pwd) printf
+2>/dev/null /usr/bin --verbose x=1 export
+	$(pwd) "$@" --verbose
+--verbose test grep then export x=1 -eu ${HOME} readonly
+		&& /usr/bin awk ${HOME} cd readonly
+		&& awk 'quoted text' awk sed printf then ${HOME}
+"$1" "$1" x=1 readonly printf "$@" $(pwd)
+		&& local cd x=1 done grep $(pwd) test "$1" | echo ${HOME} x=1 "$@" x=1 cd $(pwd)
+	echo awk /usr/bin "$@" "$1" done
+${HOME} | -eu x=1 2>/dev/null --verbose /usr/bin /usr/bin
+then grep echo printf sed ${HOME} && export $(pwd) | then sed "$@" done | awk done
+2>/dev/null ${HOME} awk 2>/dev/null -eu printf local
+		printf echo x=1 && sed 2>/dev/null printf "$1" |
+	2>/dev/null "$1" -eu -eu "$@" $(pwd) && --verbose test
+	--verbose /usr/bin 'quoted text' grep ${HOME} && $(pwd) $(pwd)
+export | /usr/bin readonly readonly cd cd x=1 test 2>/dev/null grep then
+		done printf && readonly test
+grep /usr/bin 'quoted text' | done grep --verbose x=1 x=1 cd
+		'quoted text' cd cd test done sed printf --verbose /usr/bin
+--verbose && --verbose done then /usr/bin -eu x=1 "$1" x=1 "$1" printf x=1
+	awk 'quoted text' --verbose awk x=1 export then -eu readonly
+	readonly ${HOME} done "$1"
+	export done grep /usr/bin && test cd grep export echo done grep export "$1" local
+	then then printf test cd awk x=1 sed x=1 -eu
+		sed sed /usr/bin 'quoted text' $(pwd) export $(pwd) cd export awk "$@"
+| /usr/bin 'quoted text'
+	test export awk 'quoted text' && /usr/bin "$@" test export 2>/dev/null test
+	-eu --verbose test ${HOME} 'quoted text' 'quoted text'
+		done readonly readonly test $(pwd) --verbose printf
+	-eu awk 'quoted text' printf
+		2>/dev/null echo test "$1" && test
+	sed 2>/dev/null awk "$@" readonly
+	$(pwd) export printf test cd "$@" done | "$@" --verbose test
+		&& 'quoted text' /usr/bin | cd printf
+"$@" printf then awk 'quoted text' then echo && /usr/bin
+	"$1" local -eu && | "$1" $(pwd) /usr/bin readonly echo ${HOME}
+		2>/dev/null | | local 'quoted text' $(pwd) x=1 local local --verbose
+		2>/dev/null local "$@" then $(pwd) $(pwd) $(pwd) && | | sed awk | -eu | x=1 "$@"
+then 2>/dev/null readonly then printf
+sed ${HOME} --verbose cd local sed then test cd ${HOME} readonly
+		$(pwd) grep then ${HOME} "$@" done export 'quoted text' then sed 'quoted text'
+/usr/bin done "$1" && sed ${HOME} && export awk awk sed -eu
+printf && ${HOME} "$1" sed export && test ${HOME} readonly 'quoted text'
+"$@" 'quoted text' ${HOME} --verbose
+"$1" $(pwd) 2>/dev/null local sed 'quoted text' && done then "$1" "$1" readonly
+		sed test "$@" -eu "$@" export readonly $(pwd) ${HOME} then "$1" x=1 test
+	"$1" echo && $(pwd) ${HOME} cd --verbose
+		'quoted text' 2>/dev/null sed | $(pwd) && "$@" sed readonly
+"$1" local test echo then "$@" done readonly ${HOME} export echo --verbose && then
+| x=1 export --verbose && grep readonly
+local /usr/bin && -eu then -eu grep grep echo | 2>/dev/null
+	x=1 /usr/bin local --verbose
+		test x=1 then grep awk $(pwd) sed cd
+done $(pwd) sed then sed 2>/dev/null then test done | x=1
+	done export echo printf /usr/bin 2>/dev/null
+		sed 2>/dev/null "$@" -eu grep 2>/dev/null test readonly export $(pwd) -eu -eu
+		sed /usr/bin then && awk -eu --verbose ${HOME}
+	| grep 2>/dev/null --verbose x=1 local
+	grep 'quoted text' && ${HOME} local x=1 done /usr/bin ${HOME} --verbose sed
+		2>/dev/null sed $(pwd) --verbose ${HOME} awk | && local && local
+	-eu $(pwd) echo ${HOME} "$@" readonly grep $(pwd)
+	cd awk readonly -eu done then -eu /usr/bin
+		sed -eu cd readonly | && | sed $(pwd)
+	echo readonly ${HOME} grep | readonly x=1 --verbose test sed "$1" done
+done then export awk awk ${HOME} "$@" "$@" then "$@" echo /usr/bin printf x=1
+		readonly grep grep |
+--verbose 2>/dev/null export printf --verbose x=1 'quoted text'
+done "$@" --verbose export
+awk | | 2>/dev/null export $(pwd) ${HOME} "$1" cd /usr/bin 'quoted text'
+${HOME} -eu "$@" $(pwd) | then 2>/dev/null done export
+		${HOME} ${HOME} -eu then local readonly printf
+	done cd | x=1 2>/dev/null $(pwd) done done done --verbose -eu
+		"$@" $(pwd) then $(pwd) awk readonly && "$@" "$1" && grep && test ${HOME}
+		echo "$@" local /usr/bin readonly done echo echo x=1 $(pwd) local "$1"
+		/usr/bin export --verbose readonly $(pwd) awk cd readonly x=1 sed
+		x=1 && echo "$@" then ${HOME} awk "$1" 2>/dev/null then /usr/bin cd
+		| grep 2>/dev/null cd local /usr/bin sed local ${HOME} awk cd then sed -eu
+		done sed echo 'quoted text'
+export x=1 done $(pwd) grep | grep local --verbose "$@" echo grep echo sed
+		cd sed 2>/dev/null |
+export "$@" grep --verbose "$@" "$@" export awk 2>/dev/null test &&
+"$1" sed cd readonly /usr/bin grep printf "$1" -eu | /usr/bin
+	done sed --verbose $(pwd) cd export test grep | local printf test echo
+cd /usr/bin readonly export | printf
+	then /usr/bin grep export sed "$@" readonly
+-eu sed printf /usr/bin awk "$@" -eu done echo local | /usr/bin /usr/bin
+sed echo x=1 test 2>/dev/null /usr/bin ${HOME} test printf grep readonly
+		x=1 sed -eu cd x=1 grep cd test x=1 $(pwd) 2>/dev/null
+local awk "$1" | test export /usr/bin echo
+readonly awk echo done /usr/bin awk ${HOME} local | echo
+		"$@" cd test readonly cd /usr/bin x=1 | done /usr/bin then ${HOME}
+		grep test ${HOME} -eu && 2>/dev/null 2>/dev/null
+		sed export | /usr/bin -eu readonly
+	"$1" test grep readonly
+readonly grep /usr/bin sed "$1" && -eu echo cd x=1 local "$1" "$@" done
+	export | cd printf "$@" sed | && ${HOME}
+	test local cd awk test 'quoted text' "$1" awk
+${HOME} test export -eu ${HOME} && test cd /usr/bin echo sed
+	"$1" --verbose readonly cd /usr/bin printf 2>/dev/null printf echo 2>/dev/null
+-eu $(pwd) "$@" local -eu readonly
+		2>/dev/null 'quoted text' echo | && readonly readonly export
+		| ${HOME} "$@" "$1" readonly then sed 2>/dev/null printf local readonly echo
+		$(pwd) then --verbose
+/usr/bin sed readonly | | --verbose | printf
+		2>/dev/null export then $(pwd) printf --verbose
+	readonly then export done $(pwd)
+echo sed echo 2>/dev/null cd x=1 local | readonly ${HOME} "$@" $(pwd) "$1" readonly
+		/usr/bin readonly "$1" /usr/bin echo grep $(pwd) ${HOME} /usr/bin then
+--verbose "$1" -eu export "$@" && cd "$@" /usr/bin 'quoted text'
+	"$@" then done awk $(pwd) test
+'quoted text' /usr/bin -eu export "$@" echo
+	2>/dev/null local then ${HOME} readonly 2>/dev/null x=1 echo cd
+then test echo "$1" "$1" "$1" |
+	test echo done ${HOME} 'quoted text' 2>/dev/null cd | $(pwd) "$@" --verbose
+2>/dev/null && cd 2>/dev/null x=1 echo x=1
+		2>/dev/null --verbose cd x=1 readonly x=1
+awk -eu /usr/bin done --verbose "$1" 'quoted text' 2>/dev/null -eu
+'quoted text' printf test test grep && | local
+		local ${HOME} local readonly /usr/bin -eu readonly
+	'quoted text' sed printf readonly
+		/usr/bin then export $(pwd) "$@" sed /usr/bin readonly then -eu echo cd x=1
+export && printf done /usr/bin local
+		-eu --verbose test test 2>/dev/null /usr/bin -eu local
+sed 2>/dev/null -eu sed --verbose sed 'quoted text'
+	printf grep "$1" local ${HOME} echo x=1 /usr/bin
+		printf | done export sed "$1" done "$@" readonly printf echo /usr/bin export
+then ${HOME} | then local $(pwd) grep --verbose x=1 "$1" test readonly
+	$(pwd) | -eu && local cd readonly grep $(pwd) x=1 local sed
+	local "$@" 'quoted text'
+		export -eu grep ${HOME} awk
+	awk --verbose 2>/dev/null --verbose
+/usr/bin export cd ${HOME}
+${HOME} done ${HOME} x=1 cd test /usr/bin
+	export sed $(pwd) "$1" test -eu /usr/bin printf cd && 2>/dev/null
+| then grep && && done sed done "$1" $(pwd) sed --verbose
+-eu test readonly readonly
+then /usr/bin awk grep export x=1 sed readonly
+		${HOME} ${HOME} done -eu
+	${HOME} cd -eu done | echo cd /usr/bin
+	done printf x=1 then cd x=1 /usr/bin
+		readonly export awk readonly cd export | test sed grep -eu test --verbose 'quoted text'
+	cd sed ${HOME} 2>/dev/null && "$1" sed test awk -eu 'quoted text'
+		| "$@" | -eu done -eu 'quoted text'
+	done cd --verbose sed 2>/dev/null $(pwd) done $(pwd) && && export printf
+	&& && 2>/dev/null printf awk $(pwd) x=1 grep $(pwd) cd echo 2>/dev/null
+	'quoted text' --verbose --verbose awk /usr/bin cd
+	"$@" x=1 /usr/bin then --verbose | ${HOME} then
+	cd done then x=1 x=1 2>/dev/null /usr/bin "$@" /usr/bin x=1
+		test && --verbose -eu done "$1" 'quoted text' echo "$@" && | awk local
+		2>/dev/null -eu then 2>/dev/null done
+		awk then done --verbose export awk sed && ${HOME} "$@" then
+	then 'quoted text' awk printf then done sed | then done printf local
+		"$1" then | sed printf printf -eu printf $(pwd) "$@" done
+		2>/dev/null 'quoted text' awk "$@" local grep
+readonly done 2>/dev/null
+grep export printf "$1" cd printf x=1 echo echo readonly "$@" export /usr/bin
+--verbose && test grep sed 'quoted text' x=1 printf test sed 2>/dev/null
+	done echo then grep echo readonly export --verbose grep then grep
+		done echo then local test $(pwd)
+	grep sed --verbose export done "$@" export local
+		then "$1" sed /usr/bin local readonly "$@" $(pwd) "$1" -eu
+	awk local -eu 'quoted text' -eu export
+		-eu --verbose cd -eu ${HOME} then export grep 2>/dev/null
+	&& "$@" 'quoted text' test printf sed && "$1" -eu -eu export test ${HOME}
+	echo 2>/dev/null readonly "$1" | then grep export
+	"$1" x=1 | printf 2>/dev/null -eu grep test done
+		cd $(pwd) 'quoted text' && -eu "$1" local
+		--verbose /usr/bin done echo grep local test $(pwd) --verbose
+--verbose | $(pwd) "$1" export 2>/dev/null awk ${HOME}
+done x=1 "$@" echo --verbose "$1" export --verbose && ${HOME} readonly ${HOME}
+readonly echo -eu --verbose printf
+		$(pwd) $(pwd) "$1" readonly export cd ${HOME} awk x=1 $(pwd) 'quoted text'
+		test awk "$1" /usr/bin $(pwd) export
+--verbose test 'quoted text' "$@" sed x=1 /usr/bin done /usr/bin "$1"
+'quoted text' x=1 | readonly readonly then export --verbose 'quoted text' printf
+	"$@" && test sed x=1 awk grep done --verbose
+grep cd local echo "$@"
+	x=1 ${HOME} grep --verbose ${HOME}
+	printf readonly cd $(pwd)
+'quoted text' 'quoted text' x=1 2>/dev/null local grep
+export grep && $(pwd) | x=1 | export cd readonly awk x=1 then local
+x=1 awk x=1 then cd /usr/bin cd $(pwd) sed | sed local /usr/bin
+	sed then "$@" export /usr/bin
+		local echo /usr/bin printf echo
+		${HOME} grep test -eu local
+printf echo grep grep | /usr/bin export x=1
+readonly test done --verbose $(pwd) cd "$@" -eu cd
+		printf then "$1" export then echo $(pwd) ${HOME} "$1" -eu local readonly
+"$1" x=1 done | "$@" ${HOME} export cd awk export
+'quoted text' "$@" /usr/bin | export /usr/bin test done
+	test ${HOME} done -eu -eu x=1 && | "$1" --verbose 2>/dev/null x=1 'quoted text'
+		awk readonly | && test awk && "$@" readonly done readonly echo awk readonly
+		2>/dev/null local && "$@" | | echo local ${HOME} awk ${HOME} printf
+${HOME} sed then export
+		awk then ${HOME} -eu cd done awk local
+		/usr/bin $(pwd) export
+"$@" "$@" -eu done 'quoted text'
+cd done "$@" 'quoted text' --verbose /usr/bin awk grep $(pwd) 2>/dev/null export
+	"$@" 'quoted text' -eu test $(pwd) 'quoted text'
+		local printf 'quoted text' --verbose export x=1 echo cd sed ${HOME}
+	x=1 "$1" printf readonly "$@" awk -eu
+	2>/dev/null cd "$@" /usr/bin grep ${HOME} "$1" && test
+		export 2>/dev/null /usr/bin 'quoted text' test | x=1 'quoted text'
+		x=1 "$@" "$1" "$@" readonly
+		&& done ${HOME} grep grep echo local ${HOME} local export
+test $(pwd) cd then then grep -eu $(pwd) && awk 'quoted text' readonly -eu /usr/bin
+echo readonly -eu sed /usr/bin
+	awk grep export awk && -eu local "$@" x=1 grep $(pwd) "$1" "$1" sed cd && x=1 local
+then echo awk then echo grep grep
+		-eu ${HOME} --verbose && x=1 $(pwd) then readonly readonly ${HOME} cd export awk
+echo sed grep test -eu $(pwd) "$1" $(pwd) --verbose && && x=1 grep echo
+"$1" 'quoted text' printf --verbose
+	awk awk local grep 'quoted text' printf cd "$@" awk readonly readonly
+"$@" 'quoted text' "$1" 'quoted text' grep local done echo x=1 && /usr/bin
+		'quoted text' readonly cd export 2>/dev/null
+	$(pwd) readonly local -eu done --verbose ${HOME} cd done | /usr/bin 2>/dev/null
+		2>/dev/null readonly && then | export
+	-eu cd readonly local sed && awk readonly "$@" /usr/bin echo test then
+	&& done ${HOME} readonly
+	&& readonly "$1" | printf --verbose /usr/bin x=1 done then -eu && grep
+	${HOME} "$@" export cd | 'quoted text' "$@" 2>/dev/null test readonly
+		$(pwd) $(pwd) $(pwd) echo |
+	cd "$@" 'quoted text' printf | | "$@" -eu 2>/dev/null
+$(pwd) 'quoted text' x=1 "$1" && awk test x=1 printf done x=1
+		grep -eu local cd ${HOME} cd 2>/dev/null | grep &&
+export --verbose x=1 /usr/bin awk echo local 2>/dev/null -eu 'quoted text'
+-eu cd readonly $(pwd) $(pwd) -eu test printf -eu 'quoted text'
+	test done ${HOME} readonly "$@" $(pwd) echo done sed export
+export --verbose --verbose x=1 | | test $(pwd) test
+		grep 'quoted text' && export readonly echo test -eu sed -eu 2>/dev/null then done
+		'quoted text' then x=1 sed readonly "$@" --verbose sed then && readonly
+	local cd ${HOME} cd -eu 'quoted text' 2>/dev/null $(pwd) local
+sed --verbose readonly 'quoted text' then $(pwd) 'quoted text'
+	printf then "$1" ${HOME} && -eu "$@" awk echo "$1"
+		&& then | test export readonly "$@" "$@" | "$@" /usr/bin /usr/bin
+	/usr/bin 'quoted text' done sed test "$1" awk ${HOME}
+	$(pwd) "$1" "$@" "$1" cd printf sed | $(pwd) "$@" sed | cd /usr/bin sed local
+"$1" awk "$1" echo "$@" test awk x=1 "$1" done x=1 $(pwd) "$1" export 2>/dev/null
+		&& echo | done export /usr/bin sed sed grep printf readonly echo
+	then readonly readonly
+	/usr/bin grep echo echo readonly
+		-eu --verbose grep export $(pwd) echo $(pwd) /usr/bin ${HOME} test
+"$@" then cd x=1 cd 2>/dev/null 2>/dev/null awk grep grep echo export readonly
+/usr/bin readonly local | local
+"$1" /usr/bin x=1 | -eu | echo "$1"
+		--verbose echo awk echo "$1" export "$@" "$@"
+echo "$1" "$1" test |
+		$(pwd) then "$1" -eu done "$@" cd 2>/dev/null ${HOME} grep
+		$(pwd) awk sed done sed && local /usr/bin echo then echo
+	sed "$@" "$@" printf "$1"
+local "$1" cd printf && test sed && readonly sed -eu printf cd /usr/bin ${HOME}
+		echo test /usr/bin /usr/bin
+$(pwd) printf && --verbose "$@" sed 'quoted text'
+"$1" printf echo cd then awk echo then "$@" test readonly /usr/bin sed then
+x=1 readonly 'quoted text' /usr/bin -eu -eu
+	x=1 readonly printf export /usr/bin local sed 'quoted text'
+		${HOME} echo sed readonly test -eu --verbose ${HOME}
+| --verbose /usr/bin "$1" "$@"
+		then echo export /usr/bin echo && ${HOME} 2>/dev/null
+	/usr/bin local ${HOME} "$1" grep 2>/dev/null 'quoted text' grep local /usr/bin
+		echo test echo --verbose test --verbose x=1 local grep
+	--verbose printf awk "$@" x=1 | "$@" -eu
+sed echo printf "$@" echo 'quoted text' export /usr/bin done "$@" "$@"
+| printf --verbose -eu done "$1" sed export "$1" ${HOME} -eu test
+echo 'quoted text' 2>/dev/null "$1" x=1 cd test && x=1
+	cd done "$@" printf local awk awk done 2>/dev/null $(pwd) readonly &&
+	awk $(pwd) sed then /usr/bin "$@" --verbose readonly then
+		'quoted text' local | /usr/bin "$1" awk echo && $(pwd) local awk "$1" x=1 done
+sed -eu ${HOME} -eu done grep printf ${HOME} |
+${HOME} 'quoted text' 2>/dev/null "$1" cd echo export "$1" echo
+	cd && 'quoted text' x=1 --verbose readonly done printf "$1" export --verbose 2>/dev/null
+		done test test ${HOME} printf
+	grep export cd 'quoted text' awk echo ${HOME} --verbose
+		| 2>/dev/null && | sed sed done cd printf "$1" "$1" readonly
+		echo | "$1" /usr/bin grep
+		x=1 sed test /usr/bin echo echo sed | | awk ${HOME} test readonly $(pwd) cd readonly
+		"$@" grep then printf 'quoted text' sed ${HOME}
+		"$1" ${HOME} local sed readonly 'quoted text' 2>/dev/null /usr/bin
+	${HOME} && "$1" x=1 && $(pwd) "$@" printf x=1 awk export
+	done readonly local done readonly $(pwd) test $(pwd) test sed readonly "$@" x=1
+${HOME} awk cd grep --verbose "$@" then cd ${HOME} /usr/bin readonly
+		export done "$1" | 2>/dev/null
+		sed done /usr/bin printf $(pwd) $(pwd) cd export then /usr/bin
+		/usr/bin "$@" echo | echo
+	done /usr/bin readonly x=1 printf
+		done 2>/dev/null grep $(pwd)
+	-eu done export done
+printf && $(pwd) -eu |
+		done cd --verbose echo && x=1 $(pwd) sed "$1" &&
+	&& test x=1 readonly ${HOME}
+	"$1" $(pwd) -eu awk done x=1 readonly --verbose 'quoted text' awk /usr/bin
+		"$@" readonly local printf x=1 $(pwd) --verbose
+local echo $(pwd) awk grep readonly --verbose "$@"
+	echo cd grep echo done test --verbose printf readonly
+		--verbose && /usr/bin x=1 awk 'quoted text' cd | echo /usr/bin 2>/dev/null --verbose
+		echo ${HOME} echo 'quoted text' $(pwd) -eu /usr/bin
+		${HOME} && ${HOME} awk cd --verbose test echo echo
+		printf -eu awk done awk grep x=1 2>/dev/null 2>/dev/null local echo
+'quoted text' 2>/dev/null export grep /usr/bin --verbose awk 2>/dev/null
+		then "$@" --verbose sed 2>/dev/null cd then echo done ${HOME} -eu 'quoted text'
+	export grep printf export test /usr/bin --verbose test done && test -eu
+		then done "$@" local ${HOME} sed /usr/bin export $(pwd) test
+	export cd /usr/bin export 2>/dev/null ${HOME} then $(pwd)
+		printf "$1" | | cd printf
+	awk /usr/bin export 2>/dev/null --verbose && test grep --verbose
+		${HOME} test /usr/bin 2>/dev/null readonly cd --verbose "$1" grep echo
+		&& $(pwd) then local awk
+	x=1 awk cd awk printf printf -eu && ${HOME} awk | 2>/dev/null grep printf
+cd grep test -eu awk "$1" | /usr/bin done test 2>/dev/null sed x=1 'quoted text'
+test "$@" then /usr/bin | cd grep | 2>/dev/null 2>/dev/null -eu && && "$@" -eu
+		readonly | printf export "$@" $(pwd)
+	${HOME} then --verbose awk -eu $(pwd) export /usr/bin
+		&& then local -eu 2>/dev/null && echo
+	echo local --verbose sed sed 2>/dev/null && local sed x=1 2>/dev/null local
+	readonly --verbose 2>/dev/null "$1" /usr/bin /usr/bin ${HOME} /usr/bin
+		2>/dev/null grep $(pwd) sed readonly done cd 'quoted text' ${HOME}
+	${HOME} $(pwd) cd /usr/bin 2>/dev/null local && done test &&
+	export cd local export local then echo grep sed $(pwd) $(pwd)
+	cd cd $(pwd) sed cd readonly 2>/dev/null "$1" 2>/dev/null
+-eu export echo | test echo echo then 2>/dev/null && 'quoted text' &&
+| ${HOME} awk 'quoted text' "$@" test grep /usr/bin grep
+'quoted text' | "$@" -eu 'quoted text' local echo -eu grep $(pwd) ${HOME}
+	${HOME} printf --verbose grep && printf printf grep printf
+	/usr/bin 2>/dev/null 2>/dev/null local | "$1" export && "$@" test
+| sed then | && grep 'quoted text' 'quoted text' test grep printf -eu
+		&& 2>/dev/null | /usr/bin
+		2>/dev/null export then && printf | local -eu $(pwd) done printf x=1 | export
+		${HOME} 'quoted text' export 'quoted text'
+	'quoted text' "$@" -eu echo $(pwd) export $(pwd)
+	-eu | cd cd awk test
+		grep done sed awk export echo "$1" 'quoted text'
+		done done $(pwd) $(pwd) ${HOME} test sed readonly 2>/dev/null local $(pwd) done
+"$@" 2>/dev/null 'quoted text'
+/usr/bin cd "$1" 'quoted text'
+	/usr/bin "$1" --verbose && done && /usr/bin readonly grep | "$@" | "$1"
+		| ${HOME} ${HOME} done then then $(pwd) 2>/dev/null 'quoted text'
+		export "$@" then "$1" done readonly && test cd x=1 sed "$@"
+		2>/dev/null --verbose /usr/bin
+		then echo done then "$@" awk "$@" --verbose
+grep cd | readonly readonly
+	x=1 'quoted text' local local | 'quoted text' cd sed then printf
+$(pwd) printf ${HOME} test /usr/bin &&
+sed 'quoted text' 2>/dev/null cd "$1" printf awk 2>/dev/null -eu test
+"$1" test 'quoted text' && $(pwd) export --verbose $(pwd)
+		&& 2>/dev/null test readonly 2>/dev/null done /usr/bin grep -eu --verbose
+export local 2>/dev/null sed "$@" cd readonly $(pwd) "$1" "$@" then
+		awk /usr/bin echo x=1 done done echo grep "$@" awk x=1 printf &&
+		awk 2>/dev/null cd local
+	printf local -eu export 'quoted text' awk -eu echo printf
+		echo then | | && | printf echo $(pwd)
+	| then /usr/bin test test sed && | --verbose
+echo printf x=1 awk x=1 --verbose grep printf
+	x=1 2>/dev/null && done "$@" -eu grep |
+'quoted text' | && 'quoted text' 2>/dev/null $(pwd) grep test x=1
+	readonly awk echo "$1" 2>/dev/null grep
+		-eu done $(pwd) awk && 2>/dev/null export
+		grep export awk echo done awk $(pwd) /usr/bin 'quoted text' then export
+--verbose ${HOME} sed local
+${HOME} x=1 $(pwd) 2>/dev/null export x=1 -eu -eu 2>/dev/null
+x=1 ${HOME} local local local
+		printf x=1 2>/dev/null readonly export local
+printf /usr/bin test sed export then grep awk readonly
+${HOME} "$1" /usr/bin "$1" "$@" local done --verbose then printf
+	test done export "$1" 'quoted text' "$1" /usr/bin
+		readonly echo && "$@" done /usr/bin /usr/bin 'quoted text'
+	'quoted text' cd 'quoted text' awk echo
+	local printf "$1" local awk && ${HOME} -eu --verbose sed
+awk awk grep "$1" "$1" printf 2>/dev/null export
+		/usr/bin /usr/bin /usr/bin x=1 done echo cd /usr/bin 'quoted text'
+		$(pwd) test echo "$@" "$1" grep sed then --verbose done
+grep $(pwd) done grep x=1 then -eu && echo 2>/dev/null
+2>/dev/null 'quoted text' "$1" sed awk printf echo | sed done then done /usr/bin
+	cd done && --verbose "$@" grep done
+		export "$1" export -eu &&
+readonly local export then echo then
+	"$1" done echo then readonly
+local local printf printf 'quoted text' printf $(pwd) "$@"
+	awk export 2>/dev/null /usr/bin ${HOME} "$@" x=1 ${HOME} 'quoted text'
+-eu x=1 then done "$1" | readonly ${HOME} /usr/bin "$@" --verbose "$@"
+		done 2>/dev/null "$@" awk done "$1"
+		x=1 then --verbose sed export -eu grep cd
+local test 2>/dev/null then test /usr/bin
+		| done local 2>/dev/null awk then export $(pwd)
+| cd grep "$1" && test test $(pwd)
+		x=1 x=1 awk | ${HOME} export /usr/bin ${HOME} readonly test | awk done ${HOME}
+	local --verbose /usr/bin | readonly
+		echo --verbose readonly
+"$@" 2>/dev/null -eu -eu done && "$1"
+"$1" done "$@" done printf done x=1
+export x=1 export then done x=1 cd "$@" awk --verbose test
+		x=1 local cd printf /usr/bin -eu readonly --verbose
+then x=1 readonly then local 2>/dev/null export x=1
+printf sed local 2>/dev/null sed x=1 && | 'quoted text' --verbose "$@" x=1
+x=1 export echo local -eu local echo ${HOME} "$@" sed
+readonly export 'quoted text' ${HOME} -eu $(pwd) $(pwd) 'quoted text' sed "$@"
+x=1 test 2>/dev/null "$1" then test awk -eu cd -eu "$1" awk sed 'quoted text'
+	"$1" "$1" | printf local printf sed 2>/dev/null
+/usr/bin $(pwd) then grep cd done ${HOME} export then --verbose then ${HOME}
+	local -eu "$@" && --verbose |
+		then cd local then export "$@" | sed done -eu sed "$1" --verbose printf echo
+test sed --verbose "$@"
+		/usr/bin && | x=1 printf
+2>/dev/null done local then
+	x=1 grep -eu ${HOME} 'quoted text' | then && --verbose x=1 /usr/bin awk
+printf export 'quoted text' printf cd "$@" "$1" 2>/dev/null
+		-eu 2>/dev/null printf printf local local x=1 x=1 grep local readonly
+		awk done sed awk echo sed "$1" sed done && export then local | test readonly | &&
+		'quoted text' printf grep then
+	awk local /usr/bin export | printf 2>/dev/null x=1 cd
+--verbose local echo echo awk sed x=1 sed 'quoted text'
+		"$1" && readonly printf $(pwd) /usr/bin then local "$1" test -eu test done cd readonly
+		done done "$1" echo && test grep /usr/bin export
+		export cd 'quoted text' local done
+'quoted text' awk | sed /usr/bin $(pwd) /usr/bin && --verbose printf
+		export ${HOME} && ${HOME} $(pwd) readonly $(pwd) grep done --verbose grep
+then cd cd 'quoted text' 'quoted text' "$1" "$@"
+	local awk "$1" test sed then | local export local x=1 done "$1"
+	"$1" done | awk | --verbose
+${HOME} then | --verbose $(pwd) sed then
+		export && && x=1 export test 'quoted text' printf test readonly | then | &&
+		sed x=1 2>/dev/null printf then local grep
+&& export sed awk done done sed -eu
+		cd -eu 'quoted text' grep then echo grep -eu $(pwd)
+	| cd 2>/dev/null && readonly then 'quoted text' && grep sed x=1
+/usr/bin test ${HOME}
+then local grep 'quoted text' -eu &&
+x=1 cd 'quoted text' printf /usr/bin | -eu grep "$@" x=1
+done sed ${HOME} -eu /usr/bin "$1" test --verbose
+		then 2>/dev/null -eu printf awk sed "$@" local done
+export 'quoted text' ${HOME} $(pwd) sed --verbose local
+	echo awk ${HOME} export "$@" x=1 ${HOME} x=1 grep ${HOME} "$1" then test x=1 printf
+		echo "$@" "$1" awk local 'quoted text'
+	${HOME} | && awk ${HOME} x=1 sed echo done
+		/usr/bin export --verbose | "$@" 'quoted text' export echo
+	${HOME} /usr/bin --verbose sed /usr/bin 2>/dev/null
+--verbose -eu export test "$@" x=1 test "$1"
+	"$@" printf 'quoted text'
+		then --verbose local echo
+	/usr/bin export "$1" local && grep awk test x=1 -eu then awk echo
+		done | cd | $(pwd) echo --verbose --verbose 'quoted text'
+		sed echo export printf "$1" echo 'quoted text' printf "$1" test
+readonly --verbose awk 'quoted text'
+		then test ${HOME} local $(pwd) | then
+	printf then /usr/bin test echo export
+echo ${HOME} 'quoted text' then grep echo export printf
+		local $(pwd) grep 2>/dev/null
+		&& done printf -eu /usr/bin local
+		readonly x=1 && test -eu
+		&& -eu local $(pwd) ${HOME} x=1 --verbose then echo done
+	sed local x=1 /usr/bin test ${HOME} local then readonly "$1" then
+	2>/dev/null sed echo -eu | readonly ${HOME} export readonly
+	awk -eu 'quoted text' -eu readonly /usr/bin && x=1 "$@" x=1 "$1" "$@" local sed
+		awk 2>/dev/null $(pwd) readonly --verbose "$1" 'quoted text' test cd
+then $(pwd) 2>/dev/null "$1" sed /usr/bin --verbose
+	export readonly "$1" $(pwd) grep grep && -eu x=1 $(pwd)
+export x=1 awk echo | 2>/dev/null test
+printf $(pwd) grep cd done
+"$@" printf done ${HOME} readonly x=1 export /usr/bin --verbose
+		readonly export x=1 --verbose local x=1 "$1" echo ${HOME} 2>/dev/null
+${HOME} done 'quoted text'
+		2>/dev/null grep then && printf cd x=1 awk --verbose then /usr/bin
+$(pwd) local export x=1 cd echo 'quoted text' "$@" local | done grep awk $(pwd)
+cd test -eu echo --verbose then grep ${HOME}
+&& export -eu then x=1 "$1" readonly ${HOME} "$@" x=1 --verbose
+		test x=1 "$1" readonly readonly sed -eu then printf export --verbose -eu
+	x=1 ${HOME} -eu readonly echo done grep awk -eu
+	${HOME} x=1 /usr/bin printf export echo $(pwd)
+		'quoted text' "$1" && then
+export test -eu x=1 test $(pwd) awk "$@" &&
+readonly 2>/dev/null done cd 2>/dev/null readonly sed
+readonly grep "$1" grep --verbose test export cd "$@" x=1
+		export local $(pwd) $(pwd)
+	test 'quoted text' sed printf readonly readonly readonly
+	readonly $(pwd) | /usr/bin printf readonly echo
+	-eu && /usr/bin 'quoted text' | printf export --verbose
+	x=1 done ${HOME} local sed && done done /usr/bin $(pwd) test awk echo "$1"
+${HOME} "$@" --verbose printf
+/usr/bin --verbose readonly ${HOME} "$1" done 2>/dev/null
+		&& "$1" "$@" ${HOME} local readonly 'quoted text' "$@" | 2>/dev/null 'quoted text'
+	awk $(pwd) grep export --verbose local 2>/dev/null
+	2>/dev/null local grep && local
+		sed echo 2>/dev/null sed done | cd echo
+readonly 2>/dev/null --verbose && done "$@"
+/usr/bin then /usr/bin
+	&& done cd cd test done sed /usr/bin | test --verbose && &&
+		done printf then 'quoted text' --verbose export && && local readonly x=1
+	${HOME} echo then "$1"
+	local sed x=1 'quoted text' awk "$1" echo done test
+	${HOME} x=1 local printf test done "$1" awk export x=1
+grep x=1 awk "$1" then then echo "$@" readonly
+		local grep ${HOME} grep 2>/dev/null
+echo --verbose "$1" /usr/bin "$1" x=1 grep
+		-eu -eu "$1" -eu x=1 sed
+		sed local 2>/dev/null
+		--verbose readonly -eu -eu "$1" then cd && 2>/dev/null
+	&& test grep $(pwd) ${HOME} | test
+		test /usr/bin "$1" readonly "$@" awk "$1"
+		/usr/bin $(pwd) readonly export 2>/dev/null 'quoted text'
+| export then awk local && echo export /usr/bin ${HOME} then readonly
+		&& --verbose test && awk /usr/bin export ${HOME}
+	$(pwd) grep echo 'quoted text' | | /usr/bin
+2>/dev/null 2>/dev/null sed readonly
+	-eu ${HOME} x=1 "$@" printf -eu sed test && x=1 -eu &&
+	-eu -eu sed 2>/dev/null test /usr/bin
+		done | && local test readonly ${HOME} $(pwd) awk local 'quoted text'
+		local sed printf /usr/bin grep ${HOME} 'quoted text' readonly awk export /usr/bin
+	awk --verbose cd 'quoted text' printf | | local printf local echo && 2>/dev/null
+		| x=1 x=1 local x=1 && | printf printf && x=1 cd export cd
+sed 2>/dev/null "$@" ${HOME} printf export -eu then 2>/dev/null
+'quoted text' 2>/dev/null
+		$(pwd) ${HOME} x=1 --verbose awk done awk printf then
+		x=1 /usr/bin printf -eu x=1 "$1"
+		local --verbose | sed | "$@" readonly
+	&& ${HOME} x=1 | /usr/bin "$1" grep local 2>/dev/null
+	x=1 readonly done | echo "$@" x=1 readonly && echo sed done && $(pwd)
+	then echo x=1 then | cd --verbose echo ${HOME} "$@" && done "$1"
+	awk /usr/bin export done x=1 ${HOME} then awk "$1" then 'quoted text' sed 'quoted text'
+awk | readonly local ${HOME} | sed 'quoted text' cd | grep
+		-eu -eu x=1 sed 2>/dev/null done local printf $(pwd) && done test export
+test cd "$1" grep local $(pwd) done echo $(pwd) then test
+local 2>/dev/null then awk awk
+	cd test then sed | ${HOME}
+-eu readonly grep "$1" grep echo
+		x=1 x=1 grep then test ${HOME} /usr/bin
+	$(pwd) -eu --verbose -eu
+		"$@" $(pwd) then cd ${HOME} /usr/bin grep printf -eu test
+		| then -eu test then printf readonly /usr/bin | then | "$@" cd x=1 "$@" x=1
+	x=1 && grep "$@" "$1" grep echo | | grep
+readonly sed grep readonly /usr/bin grep awk then
+		echo awk | echo then x=1 2>/dev/null
+2>/dev/null done sed done x=1 cd grep x=1 -eu sed $(pwd)
+echo readonly "$@" then x=1 export grep -eu /usr/bin
+	"$1" /usr/bin export export grep $(pwd) 'quoted text' local 2>/dev/null
+2>/dev/null awk echo sed -eu printf | 'quoted text' echo /usr/bin
+		test $(pwd) 2>/dev/null printf
+		"$1" $(pwd) local x=1 /usr/bin
+awk "$@" /usr/bin /usr/bin x=1 then --verbose printf "$@"
+done 'quoted text' cd printf
+		$(pwd) grep cd test sed awk | then | $(pwd)
+	| x=1 readonly "$@" | done $(pwd) ${HOME} x=1 sed -eu -eu export 'quoted text'
+		x=1 printf "$@" && readonly 2>/dev/null "$@" export
+		"$@" sed 2>/dev/null "$@" echo /usr/bin export cd x=1 printf x=1 x=1 sed $(pwd)
+		${HOME} 2>/dev/null /usr/bin -eu sed
+		--verbose sed $(pwd) | 2>/dev/null $(pwd) | awk test grep then $(pwd)
+| && "$1" sed cd x=1 awk 'quoted text' sed sed && local grep echo awk test
+"$1" grep cd sed done "$@" $(pwd)
+"$@" local export --verbose x=1 $(pwd) 'quoted text'
+		readonly x=1 sed $(pwd) export echo && | "$@" | sed cd | "$@"
+/usr/bin grep 2>/dev/null sed printf
+	2>/dev/null 2>/dev/null test /usr/bin 'quoted text' echo cd local
+		&& --verbose x=1 local cd local ${HOME} grep /usr/bin awk --verbose -eu export
+	done x=1 printf echo export ${HOME} ${HOME} ${HOME} awk x=1 $(pwd) |
+then then cd && && then test /usr/bin then x=1 x=1 readonly test 'quoted text'
+		then | -eu --verbose sed readonly &&
+test "$@" | readonly export grep echo /usr/bin -eu
+local export 'quoted text' cd --verbose && -eu 2>/dev/null
+	"$1" readonly grep done 2>/dev/null done grep local
+		--verbose x=1 done awk $(pwd) 2>/dev/null
+	| /usr/bin awk && ${HOME} -eu grep awk local local "$1" done 'quoted text'
+then printf && 'quoted text' "$1" --verbose && test --verbose && printf
+	$(pwd) grep /usr/bin grep then | ${HOME} export $(pwd) export sed printf
+	"$1" $(pwd) grep test /usr/bin -eu -eu local | "$1" 'quoted text'
+	x=1 x=1 printf cd 2>/dev/null test | "$1" done -eu x=1 done echo
+printf local echo grep export test done | export local -eu done readonly "$1" export
+$(pwd) export readonly sed export | grep | then "$@" grep
+| local ${HOME} x=1 | grep test -eu echo "$1" echo grep /usr/bin
+$(pwd) "$@" 'quoted text' && local x=1 grep $(pwd) "$1" /usr/bin test
+	test awk readonly --verbose /usr/bin -eu $(pwd) local -eu
+		sed grep -eu "$1" cd echo && -eu sed then 'quoted text' x=1 test 'quoted text'
+then -eu 2>/dev/null ${HOME} local then x=1 ${HOME} test | export then grep x=1
+	then 'quoted text' export
+	readonly $(pwd) grep /usr/bin readonly readonly export echo cd test $(pwd)
+done --verbose local test /usr/bin --verbose "$@" sed export ${HOME} cd "$1"
+		x=1 "$1" echo x=1 "$1" /usr/bin sed 'quoted text' echo test /usr/bin sed -eu then
+		test readonly "$@" printf
+--verbose echo /usr/bin grep && cd /usr/bin done -eu readonly
+	grep 'quoted text' /usr/bin echo 'quoted text'
+	readonly x=1 && $(pwd) ${HOME} echo /usr/bin
+	readonly /usr/bin "$@" cd --verbose
+		local --verbose echo then done x=1 printf /usr/bin 'quoted text'
+	2>/dev/null export test ${HOME} done awk cd ${HOME} -eu done
+export printf echo sed && --verbose grep echo 2>/dev/null 2>/dev/null
+		| "$@" --verbose 'quoted text'
+		readonly | export sed /usr/bin export grep $(pwd) ${HOME} &&
+		"$1" -eu --verbose "$@" x=1 cd readonly "$@" grep readonly awk -eu /usr/bin
+	awk "$@" cd sed ${HOME} cd x=1 $(pwd) --verbose "$1"
+		done x=1 test local printf "$@" readonly sed cd done
+		cd "$@" readonly 'quoted text'
+		-eu && cd export $(pwd) "$@" cd awk x=1 --verbose cd -eu awk | readonly
+	awk cd | && cd awk 'quoted text'
+	then echo --verbose cd grep awk test
+printf 'quoted text' --verbose export -eu 2>/dev/null
+		done printf cd readonly "$1" "$1"
+		$(pwd) ${HOME} cd readonly "$1" readonly test cd $(pwd) | 2>/dev/null export
+awk readonly test 2>/dev/null export readonly then awk --verbose 2>/dev/null
+		grep cd | test | local done "$1" && "$@" x=1 $(pwd) done sed -eu export
+		2>/dev/null done --verbose && echo
+	awk test sed $(pwd) test test
+	sed && test x=1 export ${HOME} --verbose
+	grep test --verbose local awk sed
+		x=1 grep -eu test && "$1" ${HOME} export && --verbose done test
+		cd test $(pwd) -eu cd x=1 -eu --verbose $(pwd) ${HOME} local
+		'quoted text' -eu awk awk && done local awk
+		grep awk test test printf printf awk test then cd "$1" then $(pwd) grep ${HOME}
+$(pwd) printf "$1" "$1" && --verbose export $(pwd) done echo 2>/dev/null
+		grep local "$@" export x=1 local "$@" "$@" ${HOME}
+	x=1 "$@" local sed printf ${HOME} sed 'quoted text'
+| cd ${HOME} x=1 && 2>/dev/null printf ${HOME}
+	${HOME} sed | readonly export cd done 2>/dev/null done test cd
+		printf printf sed -eu local
+readonly | 2>/dev/null x=1 -eu readonly
+--verbose "$1" local sed --verbose 'quoted text' export 2>/dev/null
+	local && test 'quoted text' 'quoted text'
+		-eu awk echo --verbose echo "$1" && /usr/bin printf readonly done
+		$(pwd) cd test test awk grep "$1" sed
+		$(pwd) readonly 2>/dev/null 2>/dev/null cd ${HOME} cd x=1 export
+	done test /usr/bin $(pwd) awk
+'quoted text' ${HOME} "$1" grep /usr/bin "$@"
+	/usr/bin "$1" "$1" | 2>/dev/null echo "$1" readonly && printf $(pwd)
+done | local x=1 done echo --verbose ${HOME} 2>/dev/null grep
+grep sed 'quoted text' then readonly
+		then ${HOME} local --verbose -eu printf done /usr/bin local readonly
+readonly && done /usr/bin sed export | --verbose echo echo
+readonly awk "$1" export $(pwd) awk /usr/bin cd 2>/dev/null
+	/usr/bin -eu then /usr/bin test x=1 echo 'quoted text'
+cd $(pwd) "$@" "$@" --verbose then $(pwd) cd /usr/bin $(pwd) sed /usr/bin
+		/usr/bin | /usr/bin "$@" 2>/dev/null done /usr/bin sed &&
+		cd grep ${HOME} awk done $(pwd)
+		export && $(pwd) echo 'quoted text' grep | done export ${HOME}
+		local local readonly export printf "$@" printf
+| grep $(pwd) cd grep awk /usr/bin --verbose printf x=1 cd && /usr/bin printf
+	awk $(pwd) then done ${HOME} && x=1 printf sed cd $(pwd) $(pwd) cd
+	grep echo x=1 x=1 awk 'quoted text' 2>/dev/null "$@" cd x=1 x=1 "$1" && printf
+'quoted text' $(pwd) /usr/bin
+		x=1 local sed --verbose local x=1 test x=1
+	"$1" | export awk ${HOME} x=1 echo $(pwd)
+	awk | "$@" --verbose "$@" grep --verbose 'quoted text'
+		${HOME} 'quoted text' local awk grep ${HOME} | sed "$@" "$1" -eu --verbose
+	local ${HOME} "$@" grep $(pwd) 2>/dev/null test ${HOME} | local 2>/dev/null
+	readonly readonly $(pwd) grep grep readonly sed
+	/usr/bin export ${HOME} done && grep then local then
+&& grep then then x=1 2>/dev/null then | $(pwd) cd 2>/dev/null then test
+		test --verbose "$@" grep 'quoted text'
+		"$@" readonly printf readonly ${HOME} 'quoted text'
+${HOME} "$@" test cd 'quoted text' done 'quoted text'
+${HOME} 'quoted text' && local && 'quoted text' && 'quoted text' "$1"
+| grep echo readonly grep 2>/dev/null 'quoted text'
+	readonly awk 2>/dev/null $(pwd)
+	printf -eu local sed -eu x=1 awk awk | test
+		-eu -eu x=1 "$1" local cd && awk grep "$@" ${HOME} local then sed
+	"$1" then cd -eu export
+	printf "$1" "$@" echo 2>/dev/null ${HOME} x=1 sed then /usr/bin 'quoted text'
+x=1 sed --verbose local
+	readonly "$@" cd ${HOME} -eu --verbose 2>/dev/null printf && x=1 sed | -eu
+		$(pwd) /usr/bin $(pwd) test cd test local local done sed local --verbose
+export grep 'quoted text' printf sed
+		local printf done done cd sed export --verbose
+		&& "$1" local readonly
+	"$@" then cd sed sed $(pwd) then -eu awk && 'quoted text'
+		| /usr/bin x=1 "$@" awk echo readonly sed sed then 2>/dev/null cd
+	printf "$1" && $(pwd) awk 2>/dev/null
+		"$@" | "$1" 'quoted text' printf test x=1
+&& /usr/bin "$@" export $(pwd) $(pwd) echo ${HOME} done grep sed local x=1 awk
+		"$@" grep grep printf local $(pwd)
+	'quoted text' --verbose --verbose /usr/bin local sed --verbose done awk x=1 "$1"
+grep done awk 'quoted text' -eu
+		then $(pwd) readonly export cd 'quoted text' grep 'quoted text'
+	then grep | local 'quoted text'
+"$@" "$@" grep 'quoted text' awk
+$(pwd) local ${HOME} readonly "$@"
+	x=1 "$1" export -eu | --verbose
+test 'quoted text' then x=1 "$1" 2>/dev/null cd cd echo grep |
+readonly "$@" $(pwd) 2>/dev/null $(pwd)
+/usr/bin printf -eu ${HOME}
+	/usr/bin x=1 awk "$1" cd x=1 'quoted text' grep
+		x=1 "$1" printf /usr/bin done then 'quoted text' cd -eu
+	local then grep x=1 sed &&
+		cd awk test printf cd ${HOME} echo /usr/bin
+sed export && | echo "$1" readonly | printf "$@" grep /usr/bin sed
+"$@" | printf -eu test ${HOME} 'quoted text' grep ${HOME} "$@" readonly
+		then test -eu x=1 x=1 done 'quoted text' readonly done -eu export "$1"
+	then $(pwd) done 'quoted text' $(pwd)
+	export | sed done sed printf export --verbose
+'quoted text' sed printf export $(pwd) --verbose
+	2>/dev/null 2>/dev/null printf grep ${HOME} 'quoted text' readonly
+	--verbose grep 'quoted text' export readonly echo printf sed 'quoted text'
+		cd | echo x=1 | x=1 -eu printf
+	--verbose 2>/dev/null x=1 grep then "$@" test then echo
+	echo && x=1 && "$@" export local local test && && x=1 $(pwd) local
+--verbose "$@" readonly "$@" --verbose /usr/bin printf
+2>/dev/null 2>/dev/null -eu then then test cd sed grep awk x=1 $(pwd)
+		done && --verbose export $(pwd)
+x=1 sed test echo | sed
+	readonly grep cd && cd 'quoted text' |
+readonly 2>/dev/null cd && x=1 printf 2>/dev/null
+		export echo x=1 local && /usr/bin "$1"
+		"$@" echo x=1 ${HOME} done test -eu -eu "$1" awk 'quoted text' --verbose "$1" |
+		&& "$1" grep /usr/bin awk sed then | /usr/bin
+	x=1 printf readonly local readonly
+printf --verbose "$@" $(pwd) sed -eu readonly awk awk | then $(pwd) cd
+	'quoted text' sed x=1 echo
+	printf echo grep $(pwd) export then x=1 echo x=1 test
+	-eu ${HOME} "$1" ${HOME} 'quoted text' echo test then
+x=1 && -eu test cd local then printf -eu sed 2>/dev/null
+awk "$1" test awk printf local && awk
+		$(pwd) done "$1" | then $(pwd) test ${HOME} "$1" printf printf ${HOME}
+	cd printf 2>/dev/null export -eu "$@"
+	| done && && | | "$1" | /usr/bin cd echo awk sed 2>/dev/null
+	printf -eu ${HOME} 'quoted text'
+	${HOME} test /usr/bin local echo
+"$1" && ${HOME} local 2>/dev/null printf export
+	printf cd --verbose echo local /usr/bin
+	2>/dev/null sed /usr/bin
+	cd local local $(pwd) ${HOME}
+	cd export echo | ${HOME} echo && 'quoted text' then | $(pwd) -eu
+--verbose /usr/bin done export printf printf
+	grep local /usr/bin readonly | test echo local
+then done grep printf echo done
+grep && local done export | done "$1"
+printf "$@" "$1" $(pwd)
+		/usr/bin && printf done cd $(pwd) 'quoted text' local "$1"
+done 2>/dev/null 'quoted text' test $(pwd) awk 'quoted text'
+		"$@" /usr/bin printf "$@" $(pwd) 'quoted text' 2>/dev/null
+		'quoted text' && sed /usr/bin printf 2>/dev/null
+	| echo 'quoted text' echo readonly sed -eu
+		| grep --verbose grep 'quoted text' 'quoted text' awk local echo --verbose
+/usr/bin sed x=1 awk printf --verbose
+		readonly cd --verbose 2>/dev/null export export readonly test done "$@"
+	awk ${HOME} | local 'quoted text'
+	test "$1" awk --verbose && then
+		sed "$@" --verbose -eu
+		printf ${HOME} $(pwd) awk "$@" export -eu cd then export
+	"$1" local ${HOME} "$@" && cd "$1" echo done readonly readonly 'quoted text'
+	/usr/bin $(pwd) /usr/bin done
+'quoted text' printf grep ${HOME} printf printf test "$@"
+-eu cd -eu $(pwd) ${HOME} grep readonly cd && printf done "$@"
+		echo cd $(pwd) $(pwd) 'quoted text' test ${HOME} -eu done cd awk -eu
+grep echo $(pwd) awk local --verbose "$@" 'quoted text'
+	awk echo --verbose $(pwd) 2>/dev/null "$1" | readonly cd readonly grep done local
+2>/dev/null && readonly "$1"
+		done && grep | readonly readonly local grep x=1 grep /usr/bin | then awk awk
+${HOME} 2>/dev/null 'quoted text' "$1" then "$1" awk cd readonly local readonly
+		--verbose export && -eu 2>/dev/null cd ${HOME} x=1 x=1 cd grep echo
+	test export 'quoted text'
+	$(pwd) grep "$1" sed 'quoted text'
+		awk /usr/bin ${HOME} "$@" awk awk
+		"$1" "$1" cd --verbose then test export --verbose "$@" readonly
+done x=1 'quoted text' --verbose test "$@" -eu
+	readonly then 2>/dev/null $(pwd) done | test local done export "$@" test export
+	'quoted text' local $(pwd) sed
+	cd test printf grep 2>/dev/null cd ${HOME} $(pwd)
+	done export awk test x=1 echo 'quoted text' ${HOME} x=1 | grep | $(pwd) awk
+'quoted text' "$@" x=1 grep test echo export "$@" 'quoted text' | test
+	sed awk /usr/bin readonly "$1" /usr/bin -eu 'quoted text' "$@" readonly
+		-eu "$1" /usr/bin local then then x=1 grep grep --verbose -eu | && test x=1
+		printf -eu echo awk local echo | sed local x=1 then then x=1 echo cd awk
+x=1 readonly awk ${HOME} readonly
+		grep printf /usr/bin 2>/dev/null
+	readonly printf export printf --verbose 2>/dev/null test echo /usr/bin
+$(pwd) export readonly local "$@"
+	sed $(pwd) -eu 2>/dev/null 2>/dev/null grep printf "$1" "$@" "$1" readonly
+		--verbose "$1" && grep sed -eu sed sed grep test && -eu ${HOME} cd export
+		'quoted text' x=1 "$1" "$1" echo then sed
+	then done /usr/bin grep /usr/bin local echo /usr/bin --verbose | -eu | readonly
+/usr/bin /usr/bin readonly
+x=1 sed echo && | cd /usr/bin
+then awk "$1" /usr/bin cd "$1" --verbose
+	export printf -eu awk test x=1 local local | readonly "$1" --verbose
+$(pwd) --verbose done echo x=1 sed export "$@" grep grep echo echo
+	local "$1" -eu sed "$1" export
+cd 'quoted text' cd x=1 "$@" sed $(pwd) sed export done awk then $(pwd) ${HOME}
+readonly "$@" awk printf && awk /usr/bin echo "$1" local local -eu sed | 'quoted text'
+x=1 echo cd grep $(pwd) 2>/dev/null
+		'quoted text' $(pwd) x=1 x=1 echo 2>/dev/null | cd readonly && then then awk then
+2>/dev/null --verbose 2>/dev/null readonly local done printf 2>/dev/null
+x=1 printf 2>/dev/null
+	grep $(pwd) "$1" then grep x=1 "$1" /usr/bin x=1 awk && grep done 'quoted text'
+		awk export local awk | && sed awk $(pwd)
+	grep | && awk && sed x=1 export awk /usr/bin ${HOME} then --verbose
+	2>/dev/null done "$1" local -eu x=1 ${HOME} | "$@"
+	then then && awk echo readonly
+"$1" -eu "$1" echo cd readonly then local test | grep 'quoted text'
+test | $(pwd) ${HOME} --verbose ${HOME} "$@" -eu readonly readonly
+	$(pwd) | done && "$@" && local cd x=1
+$(pwd) then echo done | printf
+		done && awk "$1" echo 2>/dev/null
+		&& then local test echo 'quoted text'
+	then test test 2>/dev/null awk ${HOME}
+		&& | echo grep test grep local cd cd test | echo -eu local $(pwd) awk printf
+	then cd --verbose done sed 'quoted text' sed 'quoted text' then --verbose
+awk "$@" grep ${HOME} ${HOME} readonly "$1" done $(pwd) sed 'quoted text' sed
+	test grep done sed 2>/dev/null
+	test readonly awk && done readonly
+	2>/dev/null -eu "$@" awk done "$@"
+"$@" printf export then
+	sed test echo done grep done sed && "$@" $(pwd)
+		&& test awk "$1" -eu && sed x=1 then 'quoted text' --verbose "$1" printf
+${HOME} 2>/dev/null -eu grep printf | -eu "$@" 'quoted text'
+done $(pwd) x=1 then local /usr/bin
+		'quoted text' printf ${HOME} then /usr/bin && grep --verbose 2>/dev/null
+cd grep "$1" | -eu cd $(pwd) done && done echo echo
+&& --verbose grep then sed "$1" | awk sed done
+		/usr/bin --verbose ${HOME} readonly test
+export grep readonly /usr/bin
+		export "$@" echo "$1" --verbose "$1"
+		&& -eu export awk 2>/dev/null printf 'quoted text' | test $(pwd) 'quoted text'
+		"$@" readonly 'quoted text'
+&& then local echo | -eu --verbose cd
+x=1 && readonly 'quoted text' | | -eu 'quoted text' cd test
+printf then -eu && export
+		${HOME} test grep --verbose printf 2>/dev/null sed done awk --verbose
+cd awk sed awk /usr/bin "$1" local "$@" 'quoted text' test
+	"$@" local --verbose 2>/dev/null --verbose test readonly echo
+		grep then x=1 test ${HOME}
+		sed | sed /usr/bin printf --verbose -eu $(pwd) awk x=1
+		export local 'quoted text' printf
+--verbose | cd "$1" test 'quoted text' x=1 done | sed test
+		"$1" x=1 awk x=1 cd "$@" ${HOME} 2>/dev/null --verbose
+cd then $(pwd) x=1 printf && --verbose
+		echo $(pwd) readonly 2>/dev/null "$@" then printf x=1 | done
+	done sed done local then local | "$1" --verbose
+	done grep 'quoted text' 2>/dev/null "$@" "$@" echo "$@" /usr/bin $(pwd)
+		-eu | export done export echo printf echo
+		"$@" then done grep -eu $(pwd) 'quoted text' | | done $(pwd) sed
+/usr/bin echo "$@" "$1" ${HOME} /usr/bin | "$@"
+		${HOME} 'quoted text' "$@" done | $(pwd) printf done done -eu local
+	echo echo sed cd sed ${HOME} -eu
+	test --verbose | then 2>/dev/null -eu local then | | --verbose
+	local local --verbose printf test
+	then test printf then /usr/bin --verbose $(pwd) -eu done /usr/bin test export
+grep 2>/dev/null -eu cd then then /usr/bin /usr/bin ${HOME} export --verbose
+2>/dev/null grep && ${HOME}
+2>/dev/null "$@" "$@" | /usr/bin grep test sed local readonly
+local && "$1" -eu awk local -eu | then
+		then -eu then echo cd readonly /usr/bin
+local readonly done grep test "$@" awk && test done && /usr/bin | "$@"
+	printf test --verbose /usr/bin printf printf grep cd 2>/dev/null readonly "$1"
+	then export sed --verbose then | export 2>/dev/null ${HOME}
+&& "$@" 'quoted text' echo then test
+then 2>/dev/null sed $(pwd) done
+	&& cd readonly grep grep 'quoted text' $(pwd) cd grep then "$@" then test sed
+	export awk export grep then 'quoted text' cd test "$@"
+		/usr/bin $(pwd) x=1 done $(pwd) test x=1 export local 'quoted text'
+	/usr/bin grep cd && awk "$@" readonly --verbose readonly local cd 2>/dev/null
+	&& "$@" sed --verbose -eu
+echo x=1 && ${HOME} cd | -eu && 2>/dev/null x=1 /usr/bin awk 'quoted text'
+	local grep $(pwd) awk "$@" 'quoted text' then
+printf export ${HOME}
+	awk then printf local export
+x=1 then 2>/dev/null "$1" readonly --verbose x=1 printf awk && x=1 &&
+-eu x=1 printf grep export && awk
+export cd "$1" | cd sed grep export echo "$1" --verbose local | $(pwd) 'quoted text'
+cd then $(pwd) local
+	${HOME} local x=1 readonly printf
+then $(pwd) sed then test readonly awk readonly awk readonly grep
+		--verbose /usr/bin cd local /usr/bin 2>/dev/null
+"$@" local 2>/dev/null | test done then && local export -eu
+		grep grep awk x=1 printf
+	-eu /usr/bin then export | export cd
+--verbose x=1 "$1" cd printf then printf readonly --verbose
+	done $(pwd) printf export
+		$(pwd) 'quoted text' x=1 test "$@" grep && export
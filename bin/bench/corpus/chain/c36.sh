@@ -0,0 +1,2001 @@
+grep export x=1 $(pwd) 'quoted text' ${HOME}
+		awk sed cd | $(pwd) && grep export x=1 -eu /usr/bin -eu test
+		done ${HOME} --verbose "$1"
+	readonly 2>/dev/null /usr/bin export sed --verbose "$@"
+	--verbose ${HOME} /usr/bin && 'quoted text' && --verbose cd echo ${HOME}
+"$1" ${HOME} 2>/dev/null sed local cd /usr/bin
+		cd 'quoted text' awk export
+	&& grep local cd 'quoted text' $(pwd) test $(pwd)
+grep grep readonly then echo grep awk readonly export export
+export then -eu echo ${HOME} export
+"$1" $(pwd) sed "$@" awk -eu "$1" && test 'quoted text' test "$1" && $(pwd) 2>/dev/null
+	x=1 x=1 cd /usr/bin readonly grep $(pwd) local | done grep local 2>/dev/null
+		$(pwd) cd test 2>/dev/null 2>/dev/null /usr/bin -eu 2>/dev/null ${HOME}
+		test awk && awk export --verbose export
+		'quoted text' done $(pwd) sed export | $(pwd) | then printf "$@" /usr/bin
+		grep awk local then -eu
+	| "$@" then test && "$1" --verbose $(pwd) export readonly | x=1 grep
+	printf "$@" && "$1" $(pwd) -eu done echo export "$@" printf --verbose /usr/bin
+		${HOME} x=1 cd sed x=1 $(pwd) "$@" export && /usr/bin $(pwd) cd readonly
+		'quoted text' done grep
+	"$1" /usr/bin --verbose --verbose && /usr/bin readonly
+test $(pwd) /usr/bin export $(pwd) /usr/bin "$@" x=1
+		readonly 2>/dev/null then sed export
+	"$1" export printf "$1" x=1 awk done -eu done readonly echo then local ${HOME}
+	| awk ${HOME} export
+$(pwd) -eu grep done -eu echo "$@" test ${HOME} then
+		cd then -eu $(pwd) 2>/dev/null --verbose echo cd readonly 2>/dev/null
+printf | echo "$1" $(pwd) 2>/dev/null grep printf ${HOME} -eu |
+local 2>/dev/null sed sed $(pwd) 2>/dev/null local grep x=1 grep done "$@" "$1"
+	--verbose grep done "$1" ${HOME} --verbose && local test readonly grep readonly
+		x=1 awk ${HOME} local &&
+	"$@" done printf local x=1 sed x=1 printf grep /usr/bin printf "$1" && local grep
+	sed printf && local x=1 && awk ${HOME} $(pwd) printf -eu then export -eu done
+		&& x=1 done printf && grep "$1" sed
+$(pwd) "$1" /usr/bin test done grep done $(pwd) $(pwd)
+	awk 2>/dev/null --verbose cd readonly ${HOME} /usr/bin ${HOME} && local local
+	readonly x=1 export --verbose awk -eu echo $(pwd) x=1 "$@" ${HOME} printf
+	--verbose test echo $(pwd) | --verbose awk --verbose | test
+	printf -eu | && local "$1" /usr/bin "$1" cd | echo
+		/usr/bin && ${HOME} "$@" done "$@"
+		&& $(pwd) local x=1 echo --verbose awk readonly $(pwd) local 2>/dev/null 'quoted text'
+&& --verbose /usr/bin /usr/bin local --verbose $(pwd) sed done -eu
+readonly export printf test
+		&& readonly "$1" $(pwd) done awk grep | readonly --verbose awk readonly
+		sed "$@" sed -eu printf export done echo done then grep readonly
+		local --verbose local 2>/dev/null
+	"$@" 2>/dev/null ${HOME} local "$1" $(pwd) test echo local
+		"$1" "$1" $(pwd) cd | "$@" export $(pwd) test readonly 2>/dev/null printf
+	grep x=1 grep | "$@" ${HOME} "$@" x=1 done -eu printf "$@"
+| --verbose printf grep test echo $(pwd) "$@" awk sed then sed | ${HOME}
+then grep echo printf /usr/bin readonly x=1 $(pwd) grep | 2>/dev/null
+	done --verbose && 'quoted text' grep test cd export then readonly done
+		local | 'quoted text' && /usr/bin x=1
+	"$1" done test "$1" 'quoted text' awk /usr/bin "$1" grep local awk
+echo sed export /usr/bin /usr/bin
+		sed | then readonly done $(pwd) sed grep "$@"
+	cd x=1 | 'quoted text' && echo --verbose | "$@" | | sed grep done
+		/usr/bin -eu grep "$1" | && -eu 'quoted text' readonly
+		test 2>/dev/null local
+		&& readonly local && ${HOME}
+&& readonly awk | x=1 grep then readonly cd | test x=1 grep 'quoted text' awk
+		done x=1 "$1" "$@" done /usr/bin local test
+		export $(pwd) && --verbose x=1 /usr/bin
+		2>/dev/null cd -eu then x=1 "$1" ${HOME}
+		echo readonly /usr/bin test printf awk done awk sed done local "$1" printf "$1"
+	test export cd "$1" --verbose $(pwd) | cd && 2>/dev/null ${HOME}
+	printf test export 'quoted text' --verbose
+		echo then awk "$@" --verbose awk export "$@" --verbose 2>/dev/null grep cd done
+export && awk test grep -eu $(pwd) | sed
+	$(pwd) readonly && cd awk --verbose -eu "$1" "$1" echo /usr/bin readonly
+		--verbose ${HOME} printf sed | cd echo sed echo 'quoted text' &&
+"$@" /usr/bin x=1 | 'quoted text'
+		/usr/bin "$@" $(pwd) test 2>/dev/null 'quoted text' printf
+		local && --verbose grep -eu /usr/bin
+		2>/dev/null sed printf ${HOME}
+done x=1 echo awk --verbose local sed | $(pwd) 2>/dev/null awk echo -eu 'quoted text'
+local sed local ${HOME} &&
+test | awk "$1" printf -eu cd cd echo $(pwd) | done /usr/bin x=1 ${HOME}
+	cd && export export $(pwd) "$@" done test $(pwd) export -eu $(pwd) x=1
+	readonly echo test "$@"
+	grep | && "$@" x=1 | -eu 'quoted text' -eu cd cd
+done readonly local && awk ${HOME}
+		then "$1" readonly $(pwd) echo 'quoted text' $(pwd)
+	readonly cd awk -eu then x=1 "$@" ${HOME} --verbose
+	local grep test local then test x=1 && echo /usr/bin echo
+"$@" $(pwd) local readonly test echo x=1
+2>/dev/null export ${HOME} ${HOME}
+	-eu sed test local 2>/dev/null cd $(pwd)
+		$(pwd) ${HOME} ${HOME} local then sed local then then sed export
+	2>/dev/null "$@" awk /usr/bin 'quoted text' readonly export x=1
+		echo x=1 echo awk local awk test ${HOME} cd grep -eu local cd "$@" "$1"
+		--verbose 'quoted text' readonly "$1"
+		awk /usr/bin awk readonly export 'quoted text'
+		| grep then readonly 2>/dev/null
+		readonly "$@" done && -eu 2>/dev/null
+		"$@" cd local $(pwd) "$1" | export export test cd printf sed
+		"$1" x=1 -eu export echo "$1" $(pwd) "$1" echo awk readonly -eu "$1" done then
+		then then done x=1 then done 'quoted text' $(pwd) "$@" printf test
+	2>/dev/null 2>/dev/null export cd cd 2>/dev/null
+	$(pwd) done -eu test | readonly /usr/bin "$@" echo
+		${HOME} ${HOME} && export "$1" | echo --verbose export --verbose
+		echo /usr/bin then export done "$1" then then | /usr/bin then done cd
+		printf printf cd | "$@" done awk readonly
+	$(pwd) ${HOME} "$@" readonly cd done "$1" $(pwd)
+	local "$1" --verbose 'quoted text' /usr/bin
+	"$1" printf 'quoted text' then x=1 $(pwd) grep "$@" | local
+		echo | awk --verbose | && "$1" "$@" "$@" awk local
+		echo "$@" then echo local cd grep export grep local /usr/bin 'quoted text' readonly
+	${HOME} test 'quoted text' export test then ${HOME} cd cd readonly
+	sed printf "$1" ${HOME} then printf --verbose
+		awk "$@" done ${HOME} | readonly 'quoted text' $(pwd) 2>/dev/null
+		export x=1 ${HOME} 2>/dev/null && done 'quoted text'
+		"$1" -eu | echo ${HOME} sed ${HOME} "$@" grep | test export then | local
+	readonly "$@" "$1" awk | 'quoted text' export && 'quoted text' "$1"
+		sed | printf cd test /usr/bin done grep echo /usr/bin
+		grep && --verbose 2>/dev/null printf "$1" $(pwd) sed sed done
+	then | export test then -eu $(pwd)
+	then 2>/dev/null 2>/dev/null ${HOME} --verbose
+	local cd grep /usr/bin 2>/dev/null test printf --verbose "$1" $(pwd) "$@"
+		"$@" "$1" export echo local 2>/dev/null test 'quoted text' printf
+${HOME} --verbose "$1" 2>/dev/null
+sed local 'quoted text' $(pwd) printf ${HOME} printf x=1
+	cd && sed grep | grep && ${HOME} awk test $(pwd) --verbose done "$@" $(pwd)
+		"$1" sed then printf cd /usr/bin | 'quoted text'
+		x=1 -eu echo 2>/dev/null "$@" sed local echo done awk readonly local
+	2>/dev/null "$1" "$1" --verbose
+		done $(pwd) local "$@" x=1 ${HOME} "$@" awk sed 2>/dev/null
+"$@" x=1 sed 'quoted text' $(pwd) $(pwd) sed 'quoted text' local cd echo
+		readonly export /usr/bin cd printf
+	--verbose sed cd ${HOME} "$1" --verbose
+'quoted text' readonly then test then "$1" && cd "$1" 'quoted text' done
+		| 2>/dev/null local ${HOME} /usr/bin printf
+		printf grep x=1 -eu "$1" 'quoted text' awk local
+	sed 2>/dev/null 2>/dev/null ${HOME} -eu "$1" "$@" sed x=1 $(pwd)
+	test | export --verbose then readonly $(pwd) done x=1 readonly cd readonly
+printf printf test readonly "$@" done | awk printf sed "$@" 'quoted text' local
+		-eu && && local test ${HOME} cd "$1" /usr/bin /usr/bin
+echo $(pwd) echo then -eu --verbose --verbose "$1" printf
+echo "$1" done echo | --verbose cd --verbose -eu | $(pwd) then x=1 sed
+	--verbose awk grep readonly test awk
+readonly 'quoted text' --verbose | cd 2>/dev/null sed
+		--verbose local --verbose -eu 2>/dev/null ${HOME} test readonly
+	2>/dev/null local -eu sed ${HOME} ${HOME} local 'quoted text' /usr/bin done printf
+		-eu /usr/bin "$1" "$@" ${HOME} readonly
+'quoted text' awk x=1 then "$@" readonly -eu ${HOME} readonly --verbose
+		done awk cd /usr/bin /usr/bin "$@"
+-eu export sed && sed echo
+'quoted text' "$1" "$@" $(pwd)
+		sed --verbose 'quoted text' --verbose | readonly
+		grep | echo awk sed $(pwd) 2>/dev/null done export grep "$1" | $(pwd) &&
+		test local sed 'quoted text' awk cd printf awk grep 2>/dev/null
+	| export $(pwd) "$1" done --verbose readonly
+printf ${HOME} sed readonly grep
+	| --verbose printf printf
+	readonly 'quoted text' sed --verbose done done local local
+	sed printf 2>/dev/null $(pwd) ${HOME} then sed && --verbose
+		export sed export then local sed && "$@" done /usr/bin done echo "$1" local
+-eu /usr/bin test local cd sed $(pwd) grep x=1 done grep test echo ${HOME}
+		cd test 'quoted text' /usr/bin && test ${HOME} --verbose echo | grep 2>/dev/null
+	readonly awk "$@" 'quoted text' sed readonly cd /usr/bin
+x=1 grep $(pwd) x=1 /usr/bin then awk awk awk cd readonly grep
+	-eu && --verbose echo ${HOME} /usr/bin
+		then 2>/dev/null sed local export echo --verbose && && ${HOME}
+'quoted text' --verbose export ${HOME} 2>/dev/null
+		/usr/bin local 2>/dev/null /usr/bin printf $(pwd) awk done x=1 readonly
+"$@" 'quoted text' 'quoted text' local $(pwd) echo
+		sed $(pwd) readonly cd 'quoted text' "$@" done printf test
+'quoted text' readonly
+	then x=1 $(pwd) ${HOME} | local 'quoted text' cd local "$@" 2>/dev/null local
+	'quoted text' && test 'quoted text'
+	2>/dev/null | printf $(pwd) --verbose /usr/bin && "$@" 'quoted text' && printf
+	-eu export readonly test local done -eu $(pwd) local x=1 printf echo
+| "$1" then then printf cd printf x=1 awk $(pwd) 2>/dev/null
+	2>/dev/null -eu awk && 2>/dev/null --verbose x=1 | echo local 'quoted text'
+done 2>/dev/null awk && export test cd $(pwd)
+	cd 'quoted text' awk sed "$1" grep $(pwd) && -eu "$@" --verbose
+	"$@" ${HOME} -eu "$1" | readonly sed then then "$1" 'quoted text'
+		printf echo export && $(pwd) x=1 -eu && x=1 then readonly grep printf
+	printf && --verbose "$@" echo
+		'quoted text' $(pwd) sed awk echo cd --verbose awk && $(pwd) echo grep
+	-eu 2>/dev/null echo awk --verbose | "$@" $(pwd) echo
+		"$1" && ${HOME} x=1 awk done
+test readonly export readonly 2>/dev/null sed ${HOME} "$1"
+		&& echo --verbose sed 'quoted text' "$1" printf echo then then "$@" awk done
+	${HOME} $(pwd) readonly test && cd /usr/bin
+		grep ${HOME} grep done 'quoted text' -eu 'quoted text' "$@" export --verbose
+${HOME} printf test "$@" export
+		${HOME} 'quoted text' | $(pwd) test echo "$1" ${HOME} 'quoted text'
+	$(pwd) -eu "$@" done && && "$1" printf --verbose /usr/bin "$@" printf && then 2>/dev/null
+	readonly cd awk -eu then
+&& done awk awk cd readonly test $(pwd) 2>/dev/null
+		/usr/bin --verbose done sed grep cd ${HOME} "$1" "$1" test $(pwd) export
+	readonly | done $(pwd) ${HOME}
+/usr/bin awk 'quoted text' awk
+local grep "$@" && --verbose export 'quoted text'
+${HOME} test then 'quoted text' done x=1 printf $(pwd) done
+/usr/bin ${HOME} echo awk $(pwd) && sed 'quoted text' -eu export
+	2>/dev/null local $(pwd) sed test "$@"
+		printf /usr/bin readonly awk awk sed && && 2>/dev/null
+		&& printf | local echo echo "$@" && "$1" printf sed ${HOME}
+		$(pwd) sed then x=1 "$1" $(pwd) printf 2>/dev/null
+	-eu && && x=1 cd local /usr/bin test ${HOME} "$1" ${HOME} printf 'quoted text'
+	readonly $(pwd) grep then echo local -eu -eu cd
+then | echo done then
+readonly then 'quoted text' | local 2>/dev/null
+	"$@" 2>/dev/null $(pwd) sed then
+		&& && -eu "$1" && echo awk $(pwd) /usr/bin
+		/usr/bin sed test 'quoted text' readonly /usr/bin
+local --verbose 'quoted text' awk
+	"$1" 'quoted text' --verbose done grep sed 2>/dev/null done ${HOME} then awk
+done | /usr/bin "$1" "$@" -eu local readonly then x=1 printf "$1" grep readonly
+		${HOME} then 2>/dev/null test cd done cd local ${HOME} echo /usr/bin $(pwd)
+	"$1" echo sed "$1" test -eu 'quoted text' then
+		printf printf export test $(pwd) export && && 2>/dev/null && "$1"
+	&& awk ${HOME} --verbose cd sed x=1 echo | /usr/bin
+		awk test "$@" cd /usr/bin sed printf
+then awk ${HOME} 2>/dev/null 'quoted text' printf then --verbose
+-eu && | awk test printf
+	awk -eu echo readonly readonly /usr/bin
+--verbose 2>/dev/null done test "$1" sed grep && grep local readonly cd --verbose
+	/usr/bin readonly 2>/dev/null local done $(pwd)
+readonly "$@" awk | |
+cd 'quoted text' "$1" awk /usr/bin --verbose done test
+export /usr/bin export echo export -eu /usr/bin cd awk echo
+grep cd 'quoted text' echo awk ${HOME}
+		"$@" cd -eu local ${HOME} echo "$1"
+	cd "$@" test ${HOME} cd --verbose
+		echo grep export --verbose x=1 export awk export 2>/dev/null awk /usr/bin
+		2>/dev/null done && ${HOME} $(pwd) --verbose awk sed
+test readonly "$1" -eu local ${HOME} printf local printf $(pwd) local $(pwd)
+	/usr/bin local 'quoted text' "$1" && /usr/bin echo awk awk
+awk $(pwd) grep /usr/bin "$1" test
+	"$1" "$1" | $(pwd) readonly --verbose grep /usr/bin "$@" echo test "$@" --verbose
+		| echo -eu sed --verbose then /usr/bin
+	grep && 2>/dev/null | /usr/bin && | "$@" readonly
+	/usr/bin sed 'quoted text' sed grep cd cd test $(pwd) "$@" /usr/bin &&
+	awk /usr/bin grep -eu done awk export local
+local readonly ${HOME} /usr/bin
+		then export printf "$1" then 'quoted text' /usr/bin done echo done --verbose
+| cd test 'quoted text' && cd "$@"
+	&& test x=1 then -eu awk cd 2>/dev/null
+		&& local x=1 readonly test 2>/dev/null local readonly
+awk done done -eu | echo &&
+	'quoted text' test --verbose $(pwd) "$@" echo
+	"$@" cd then 'quoted text' done
+		readonly 2>/dev/null 2>/dev/null && test echo grep done "$1" echo local
+		local "$@" 2>/dev/null test done 2>/dev/null --verbose "$@" local grep
+${HOME} --verbose done && awk x=1 done && grep readonly grep local &&
+		&& "$@" 'quoted text' then "$@" sed local test -eu |
+	local 2>/dev/null 'quoted text' awk && awk --verbose "$1" sed done
+		export /usr/bin test sed -eu export --verbose readonly "$@" local
+${HOME} --verbose | /usr/bin readonly printf x=1 printf sed
+		2>/dev/null echo x=1 --verbose
+	| /usr/bin test "$@" grep awk printf grep "$1" export 'quoted text'
+	--verbose 2>/dev/null test cd printf -eu 2>/dev/null
+	sed 2>/dev/null then then "$1" /usr/bin
+	2>/dev/null awk 2>/dev/null x=1 "$1" local done "$1" then
+		awk 2>/dev/null cd cd grep /usr/bin done $(pwd) printf -eu "$@" cd cd 'quoted text'
+'quoted text' -eu awk awk | | local -eu local done grep
+	cd | 2>/dev/null export readonly "$@" printf | 2>/dev/null then echo printf
+		&& awk test $(pwd) awk --verbose /usr/bin -eu $(pwd) --verbose
+-eu test | && cd sed echo local printf readonly && 'quoted text' local awk local
+		x=1 sed export cd 'quoted text' 'quoted text' && -eu test /usr/bin then
+2>/dev/null /usr/bin "$@"
+printf readonly ${HOME} x=1 then sed then readonly cd -eu cd /usr/bin
+		export /usr/bin echo "$@" -eu "$@" | $(pwd) 'quoted text' 2>/dev/null
+		echo 2>/dev/null awk printf export && readonly && export sed --verbose
+${HOME} grep sed export awk "$1" x=1 /usr/bin awk x=1 readonly "$1" $(pwd) grep
+${HOME} then /usr/bin -eu | readonly
+	sed local then local export sed echo printf export ${HOME} test
+awk export $(pwd) && printf | done then done done "$@"
+		cd sed grep $(pwd) ${HOME} awk --verbose -eu "$1" --verbose
+readonly 2>/dev/null ${HOME} then 'quoted text' echo | 'quoted text'
+	test 'quoted text' 2>/dev/null printf
+	| done --verbose cd /usr/bin
+	done export then -eu x=1 -eu test 2>/dev/null "$@"
+	'quoted text' ${HOME} -eu cd
+	then && echo printf grep then "$@" grep local | x=1 grep $(pwd) cd "$@" | echo
+$(pwd) "$@" "$@" | "$@" 2>/dev/null | --verbose awk ${HOME} --verbose 'quoted text'
+printf $(pwd) "$1" sed --verbose test 2>/dev/null "$1" readonly
+		&& test $(pwd) readonly 'quoted text' "$1" awk printf done -eu "$@" echo
+		echo printf /usr/bin $(pwd) /usr/bin 2>/dev/null 'quoted text'
+	grep echo "$1" printf sed -eu "$@" cd "$@" -eu awk /usr/bin printf
+		$(pwd) readonly && ${HOME} | echo echo "$1" test 'quoted text' awk 2>/dev/null
+"$1" then sed 2>/dev/null cd awk local done ${HOME} local
+	2>/dev/null then x=1 local local "$1" done grep
+	${HOME} x=1 $(pwd) ${HOME}
+		readonly then 2>/dev/null | awk ${HOME} printf
+	x=1 local --verbose done
+	2>/dev/null export export readonly $(pwd) readonly test "$@" readonly
+2>/dev/null --verbose export
+--verbose cd readonly x=1 && local $(pwd) test --verbose | | sed ${HOME}
+2>/dev/null -eu $(pwd) cd then cd /usr/bin
+		&& cd readonly readonly ${HOME} ${HOME} awk 'quoted text'
+${HOME} cd --verbose
+		$(pwd) grep "$@" "$@" && 2>/dev/null then printf printf local "$1"
+		'quoted text' echo awk x=1 $(pwd) $(pwd) cd export "$@" local --verbose
+	grep x=1 ${HOME} && -eu 2>/dev/null
+	export echo done x=1 x=1 'quoted text' then --verbose readonly | --verbose
+"$1" "$1" test --verbose then "$@" export awk ${HOME} local cd local
+	'quoted text' readonly printf readonly local 'quoted text' printf /usr/bin 'quoted text'
+	x=1 'quoted text' /usr/bin "$@" | sed sed then $(pwd) /usr/bin && readonly printf
+/usr/bin sed then -eu 2>/dev/null cd awk | ${HOME} x=1 2>/dev/null 'quoted text'
+	2>/dev/null 'quoted text' echo export
+		/usr/bin readonly done | ${HOME} then awk local local
+	echo awk /usr/bin awk $(pwd) sed test 2>/dev/null 'quoted text' $(pwd)
+"$@" "$1" grep /usr/bin local --verbose
+		/usr/bin /usr/bin local test /usr/bin printf readonly local 'quoted text'
+local $(pwd) test -eu --verbose ${HOME} grep sed -eu 'quoted text'
+	readonly local local $(pwd) sed "$1" printf local local "$@" 'quoted text'
+awk "$@" -eu printf "$1" ${HOME} 2>/dev/null "$@" done done 2>/dev/null export
+	'quoted text' test test "$1" "$@" export x=1
+	grep export ${HOME} ${HOME} 2>/dev/null $(pwd)
+	readonly /usr/bin awk test local
+	grep 'quoted text' readonly $(pwd) "$1"
+		sed cd done && done && | $(pwd) then 2>/dev/null "$@" local && $(pwd) | test
+grep test /usr/bin export $(pwd) grep --verbose $(pwd) ${HOME}
+	local $(pwd) awk "$1" "$1" grep grep | $(pwd) sed -eu export awk awk
+		/usr/bin sed then -eu "$1" readonly then sed sed ${HOME} -eu printf
+		--verbose test then cd
+	2>/dev/null then --verbose sed "$1" cd /usr/bin then
+		x=1 sed grep "$1" /usr/bin 2>/dev/null done local "$1" grep ${HOME} x=1
+	/usr/bin cd $(pwd) && $(pwd) sed $(pwd) readonly then readonly
+		$(pwd) sed "$@" -eu 'quoted text'
+	cd sed /usr/bin "$@" --verbose "$1" sed "$@" done /usr/bin done then "$@"
+	then readonly "$@" done --verbose sed export test
+--verbose cd readonly x=1 'quoted text'
+printf $(pwd) sed $(pwd) done done done /usr/bin readonly local | done export |
+		readonly -eu readonly test grep cd -eu /usr/bin 'quoted text' $(pwd)
+	"$1" x=1 /usr/bin sed ${HOME} /usr/bin done cd -eu --verbose |
+		--verbose sed printf x=1 done x=1 cd /usr/bin local
+"$1" "$1" then local $(pwd) cd done export export done test ${HOME}
+	printf sed awk ${HOME} local cd readonly cd "$1" 2>/dev/null -eu -eu --verbose
+	${HOME} printf grep "$@" cd "$@" echo ${HOME} test 2>/dev/null
+		then echo 'quoted text' then cd then "$@" printf awk done && readonly awk && &&
+echo then printf /usr/bin
+&& grep sed local local readonly test ${HOME} done echo
+done echo --verbose cd then && then printf
+	readonly x=1 | "$@" grep echo test -eu test then ${HOME} sed
+then --verbose && x=1 -eu test --verbose | "$@" 'quoted text'
+local grep sed x=1 -eu $(pwd) --verbose then && /usr/bin test test cd /usr/bin
+		cd local /usr/bin /usr/bin /usr/bin -eu then test $(pwd) echo echo
+		--verbose done sed cd 'quoted text' $(pwd) test then | sed awk -eu /usr/bin
+		awk "$@" 2>/dev/null sed awk 2>/dev/null
+		"$1" echo "$1" readonly /usr/bin cd echo
+		'quoted text' then | && x=1 printf done "$1" echo --verbose export ${HOME} | 2>/dev/null
+	printf echo done "$1" --verbose test awk | sed | ${HOME}
+	sed done readonly test done x=1 printf x=1 cd test export sed 'quoted text' x=1
+--verbose /usr/bin printf export
+	awk sed 2>/dev/null readonly "$@"
+2>/dev/null x=1 2>/dev/null awk ${HOME} cd && test sed echo local && "$1" --verbose
+		| "$@" | sed awk "$1" "$@" readonly 2>/dev/null
+--verbose 'quoted text' --verbose /usr/bin grep echo printf /usr/bin
+	readonly awk 'quoted text' done /usr/bin test cd "$@" echo echo "$1" "$1"
+	awk "$1" | readonly export export grep then -eu export "$1" test | && sed
+${HOME} sed grep printf | "$1" && "$1" awk && "$1" echo ${HOME}
+		"$1" ${HOME} readonly test then && awk grep -eu -eu 2>/dev/null grep
+	| test "$@" export x=1 test cd
+/usr/bin grep ${HOME} grep $(pwd) done cd printf
+-eu 2>/dev/null printf local
+		'quoted text' readonly -eu
+		"$1" 'quoted text' grep 2>/dev/null "$1" 'quoted text'
+echo -eu "$1" 'quoted text' grep then /usr/bin awk
+	x=1 -eu printf echo awk 2>/dev/null sed done ${HOME} export 'quoted text'
+	done done cd 2>/dev/null && ${HOME} sed cd sed "$1" done
+awk cd cd test echo readonly
+	"$1" echo cd sed ${HOME} "$@" "$@" printf
+${HOME} -eu "$1" export -eu awk x=1 echo
+done 2>/dev/null grep grep ${HOME}
+		done 2>/dev/null grep -eu ${HOME} /usr/bin
+/usr/bin "$@" /usr/bin $(pwd) 2>/dev/null $(pwd) /usr/bin grep
+		'quoted text' $(pwd) export test -eu test -eu -eu x=1 echo x=1 done -eu
+	awk test awk export | then $(pwd) 'quoted text' "$@" "$1" -eu done
+		--verbose local 'quoted text' | 2>/dev/null && | "$1" export printf export
+	/usr/bin 2>/dev/null readonly x=1 | then $(pwd) printf
+		"$1" readonly --verbose echo cd sed 'quoted text' ${HOME} grep &&
+	"$@" $(pwd) test local readonly readonly then "$@" awk awk then echo
+	/usr/bin ${HOME} $(pwd) 2>/dev/null
+		--verbose ${HOME} 'quoted text' $(pwd) export --verbose test
+	| then grep sed x=1 x=1 cd then ${HOME} /usr/bin -eu -eu "$@" /usr/bin
+	done -eu grep readonly ${HOME} printf echo
+local | sed && readonly --verbose printf && local echo -eu local cd sed $(pwd) x=1
+	sed "$@" 2>/dev/null sed x=1 done export 2>/dev/null && awk
+"$@" "$1" "$@" awk echo ${HOME} -eu "$1" -eu ${HOME} grep
+	export export echo sed local 2>/dev/null grep
+		test $(pwd) test printf readonly readonly /usr/bin /usr/bin | done 'quoted text'
+"$1" done "$1" echo "$1" --verbose --verbose done 'quoted text'
+		'quoted text' echo --verbose 'quoted text'
+x=1 awk cd test "$@" | readonly | printf
+		done /usr/bin x=1 "$1" "$1" grep ${HOME}
+		local done -eu readonly $(pwd) -eu /usr/bin
+printf sed then 'quoted text' awk /usr/bin x=1 grep 2>/dev/null &&
+	awk then | grep local ${HOME} printf
+		grep awk grep printf echo awk awk
+		then "$1" then && cd $(pwd) $(pwd) readonly
+	-eu export test "$@" && grep readonly done x=1 test | --verbose "$1" x=1
+$(pwd) 2>/dev/null echo 2>/dev/null x=1 readonly
+readonly grep 2>/dev/null "$@" local "$1" then
+test ${HOME} test test "$@" ${HOME} -eu sed printf sed awk awk
+	cd done -eu --verbose "$1" ${HOME} --verbose 'quoted text' && && awk export
+		$(pwd) /usr/bin x=1 /usr/bin ${HOME} cd sed "$1" $(pwd) 'quoted text'
+		$(pwd) export | "$1" ${HOME} ${HOME} printf ${HOME} x=1 then cd echo
+	&& cd awk $(pwd) grep "$1" 'quoted text' ${HOME} "$1" grep
+/usr/bin | local 'quoted text' readonly test awk 'quoted text'
+		x=1 awk sed export sed | -eu 2>/dev/null
+cd grep "$@" echo local /usr/bin export awk cd 'quoted text' export
+	/usr/bin $(pwd) then "$1" "$@" 2>/dev/null export done 'quoted text'
+--verbose "$1" export 'quoted text' --verbose | local 'quoted text' printf
+		sed | printf x=1 done 2>/dev/null /usr/bin cd -eu
+		-eu grep awk echo && awk awk printf echo
+		readonly | "$@" | sed readonly && x=1 $(pwd) --verbose
+		sed /usr/bin awk x=1 export grep printf && echo "$1" "$@" x=1
+2>/dev/null x=1 | ${HOME} x=1 -eu cd x=1 grep "$1" test "$1" test sed sed
+	$(pwd) echo printf done | export | grep grep echo
+		echo ${HOME} ${HOME} printf echo cd $(pwd) done readonly
+"$1" ${HOME} sed done done 2>/dev/null export ${HOME} echo then awk cd awk x=1 export
+		local sed readonly export awk echo
+then --verbose done 2>/dev/null && 2>/dev/null awk sed /usr/bin then "$@" ${HOME}
+	2>/dev/null awk awk printf 'quoted text' "$1" --verbose 'quoted text'
+		"$1" test then test readonly -eu readonly readonly readonly --verbose awk $(pwd)
+--verbose "$1" | echo 2>/dev/null "$1"
+	test echo sed "$@" --verbose &&
+	2>/dev/null readonly readonly grep
+x=1 --verbose cd $(pwd) grep readonly export 'quoted text' local "$@" local
+		| | export && cd && x=1 sed 2>/dev/null --verbose
+	/usr/bin sed printf export sed "$@" "$1" && done -eu ${HOME}
+-eu && ${HOME} grep && 'quoted text' cd && sed ${HOME} 'quoted text' done 2>/dev/null
+		cd x=1 cd "$@" /usr/bin test test test ${HOME} ${HOME} "$@" done then readonly
+printf echo cd sed 'quoted text'
+| sed done "$@" cd export
+		then $(pwd) awk "$@" sed sed "$@" test ${HOME}
+$(pwd) && readonly $(pwd) --verbose x=1 cd | local test done -eu ${HOME}
+	cd --verbose "$@" "$@"
+then sed && then --verbose awk printf test
+echo awk | done then 'quoted text' cd export grep awk
+&& done export cd x=1 echo cd grep ${HOME} $(pwd)
+		"$@" 2>/dev/null && cd --verbose $(pwd) done
+	readonly sed grep done echo | cd /usr/bin ${HOME} && cd test cd "$1" then echo
+| ${HOME} $(pwd) printf --verbose
+		done $(pwd) ${HOME} awk $(pwd) echo $(pwd) done printf echo | | "$1"
+awk echo local printf sed "$@" local "$1" "$@" then --verbose $(pwd)
+--verbose "$1" export $(pwd) local "$@" x=1 echo cd x=1 awk
+then printf sed readonly grep readonly
+sed local "$1" local done then 'quoted text' --verbose "$@" sed
+	"$1" 'quoted text' grep --verbose printf ${HOME}
+	x=1 && done local /usr/bin export printf --verbose $(pwd) done && echo
+'quoted text' done x=1 sed
+&& echo grep && /usr/bin printf "$1" echo && done
+	2>/dev/null printf ${HOME} export
+	echo printf --verbose /usr/bin printf then
+awk sed $(pwd) test "$1" 2>/dev/null awk cd | --verbose "$1"
+		'quoted text' x=1 done test "$1" /usr/bin 2>/dev/null
+	cd grep $(pwd) $(pwd) then | test 2>/dev/null local
+	readonly test x=1 ${HOME} readonly
+	${HOME} | cd then ${HOME} 'quoted text'
+	-eu done "$1" /usr/bin $(pwd)
+"$1" x=1 $(pwd) awk awk awk
+		printf printf 2>/dev/null cd test echo done
+&& --verbose $(pwd) grep --verbose
+		test /usr/bin --verbose x=1 then | cd cd x=1
+	${HOME} awk local grep x=1 readonly echo then
+${HOME} x=1 x=1 2>/dev/null awk && | cd then
+	2>/dev/null echo "$@" awk export cd readonly awk | sed cd /usr/bin readonly
+		"$1" "$1" | printf then --verbose export local cd export readonly local 2>/dev/null
+--verbose --verbose then $(pwd)
+grep 'quoted text' readonly
+	cd "$1" "$1" readonly awk "$1" -eu
+	'quoted text' local "$@" && /usr/bin done export | | sed
+	echo 'quoted text' test $(pwd)
+${HOME} /usr/bin export awk
+		&& "$1" | 2>/dev/null readonly | $(pwd) then && "$1"
+		printf awk cd "$1" 'quoted text' | printf x=1 'quoted text' cd --verbose
+x=1 then ${HOME} awk | done && -eu
+		grep --verbose readonly /usr/bin 'quoted text' test $(pwd) $(pwd) grep ${HOME}
+		done ${HOME} then --verbose -eu -eu test readonly
+	done test "$@" $(pwd) test x=1 sed test export
+	awk --verbose local --verbose 2>/dev/null cd --verbose 2>/dev/null awk cd
+"$1" local then -eu && "$@" "$1"
+		-eu then local ${HOME} --verbose awk 'quoted text' "$1" /usr/bin $(pwd) ${HOME}
+		x=1 printf $(pwd) local export readonly ${HOME} --verbose
+		sed grep grep awk then "$1" done grep -eu $(pwd) -eu 2>/dev/null awk | awk
+	"$@" $(pwd) local 2>/dev/null awk sed done 2>/dev/null 'quoted text'
+export x=1 $(pwd) printf 'quoted text'
+	awk 'quoted text' then local x=1 test local $(pwd) printf export && echo
+	"$@" local -eu readonly then --verbose
+		/usr/bin | printf 'quoted text'
+		grep local awk done 2>/dev/null readonly awk "$1"
+		x=1 $(pwd) local test $(pwd) readonly export grep grep | grep sed 'quoted text'
+		/usr/bin /usr/bin readonly sed done test grep grep 2>/dev/null
+test export awk /usr/bin "$@" | "$@" /usr/bin cd /usr/bin sed x=1
+	-eu 2>/dev/null then cd
+		x=1 done awk grep x=1 done | cd "$@"
+test -eu sed readonly "$1" 2>/dev/null &&
+		x=1 sed done then | done awk done 2>/dev/null "$1" 'quoted text' sed
+	done readonly 2>/dev/null readonly grep
+		x=1 && --verbose "$1" 2>/dev/null test cd "$@" local
+	-eu done 2>/dev/null echo
+		cd -eu then cd sed -eu /usr/bin /usr/bin export local grep ${HOME} -eu x=1 $(pwd)
+printf x=1 done cd -eu local && x=1 2>/dev/null sed x=1 sed
+		grep sed && "$1" /usr/bin echo 2>/dev/null grep -eu | then then $(pwd)
+	then | grep "$1" then "$1" | | export --verbose readonly $(pwd) awk echo export
+	x=1 2>/dev/null "$@" done -eu echo 2>/dev/null
+	then test x=1 readonly echo export ${HOME} 2>/dev/null echo grep "$@" test
+		2>/dev/null ${HOME} -eu printf echo then "$1" readonly && x=1 printf printf
+local 2>/dev/null echo
+		"$@" export test | then sed awk | /usr/bin -eu
+	"$@" done printf done awk "$@" cd --verbose
+		grep | readonly "$@" test
+export done then --verbose grep test printf 'quoted text' done ${HOME} awk x=1
+		printf /usr/bin "$@" then --verbose 2>/dev/null $(pwd) awk test cd local 'quoted text'
+		-eu 'quoted text' local --verbose then readonly
+		"$@" readonly grep echo readonly sed $(pwd) done --verbose
+"$1" local printf export local done echo test
+		export 'quoted text' test -eu grep
+		done test printf /usr/bin grep 'quoted text' awk /usr/bin local done && then local
+	cd grep -eu $(pwd) --verbose -eu
+--verbose 'quoted text' awk
+-eu printf printf echo "$1" 2>/dev/null then | "$@" local
+	sed awk $(pwd) 2>/dev/null ${HOME} | done readonly && then 'quoted text'
+cd echo local grep x=1 test
+	"$@" awk local /usr/bin local cd 2>/dev/null
+		done export awk | 'quoted text'
+	"$1" grep 'quoted text' cd export ${HOME} sed /usr/bin
+	| 2>/dev/null readonly x=1 && readonly "$1" &&
+x=1 cd then "$1" awk $(pwd) ${HOME} grep echo 'quoted text'
+		done "$1" $(pwd) --verbose 2>/dev/null grep
+	&& grep $(pwd) --verbose printf printf /usr/bin local echo 2>/dev/null then
+	cd echo export printf done 2>/dev/null | 'quoted text' 'quoted text'
+"$1" readonly 2>/dev/null local local $(pwd) export readonly
+"$@" then awk printf printf 'quoted text'
+	printf done --verbose cd /usr/bin "$1" local x=1 x=1 readonly cd ${HOME}
+		-eu printf ${HOME} export
+	/usr/bin "$1" printf $(pwd) ${HOME} $(pwd) then $(pwd) $(pwd)
+'quoted text' | 2>/dev/null && grep printf && cd local
+	2>/dev/null echo test ${HOME} "$@" then --verbose ${HOME} /usr/bin
+		$(pwd) readonly sed ${HOME} grep echo readonly printf
+2>/dev/null | && | grep x=1 printf -eu echo test 'quoted text' done cd 'quoted text'
+done ${HOME} -eu printf -eu "$@"
+		readonly grep $(pwd) && cd ${HOME} 2>/dev/null x=1 readonly
+	export test $(pwd) x=1 done local echo && /usr/bin -eu "$1" awk printf done test
+		${HOME} printf test ${HOME} x=1 printf
+	--verbose sed && 2>/dev/null export local -eu done && export
+printf 'quoted text' grep
+		grep && /usr/bin | sed
+/usr/bin readonly && export cd 2>/dev/null 2>/dev/null 'quoted text' echo 2>/dev/null
+2>/dev/null $(pwd) /usr/bin grep then sed
+echo 2>/dev/null x=1 test test /usr/bin
+	readonly ${HOME} 'quoted text' echo echo echo 2>/dev/null
+--verbose ${HOME} echo "$@"
+	| echo echo local 2>/dev/null done /usr/bin sed grep done && local echo
+		'quoted text' 'quoted text' grep test grep grep readonly local "$1" &&
+printf readonly then ${HOME}
+then "$1" /usr/bin awk "$@" test 2>/dev/null test /usr/bin
+	| x=1 'quoted text' "$1" && printf echo --verbose local readonly
+readonly readonly readonly
+export awk && "$1" && local && export cd 2>/dev/null 'quoted text'
+		'quoted text' x=1 export | sed --verbose
+local && cd $(pwd) $(pwd) test "$1" x=1
+| "$@" sed export | grep 'quoted text' --verbose readonly cd sed printf "$1" "$@"
+	$(pwd) /usr/bin awk "$@" awk readonly
+${HOME} test sed grep cd then 'quoted text' $(pwd)
+		readonly ${HOME} 'quoted text'
+	/usr/bin grep awk 2>/dev/null "$@" x=1 "$@" /usr/bin printf then export
+printf export printf && | sed then
+		awk echo "$1" | /usr/bin done --verbose sed cd ${HOME} echo done then -eu
+export x=1 --verbose x=1 'quoted text'
+	test | $(pwd) "$1" ${HOME}
+		cd then awk test cd $(pwd) printf printf && --verbose
+echo printf $(pwd) printf
+--verbose grep 'quoted text' --verbose done
+cd | | readonly --verbose local
+	"$@" x=1 awk test export -eu
+		&& local -eu echo export --verbose x=1 test ${HOME}
+	export readonly sed --verbose --verbose readonly "$1" readonly --verbose 2>/dev/null
+	then ${HOME} --verbose --verbose "$1" done then
+printf | -eu -eu ${HOME} echo local $(pwd) 'quoted text' then local
+		then sed local "$@" 'quoted text' grep "$@" local printf && "$@" ${HOME}
+	2>/dev/null local -eu | local awk && awk && --verbose /usr/bin -eu
+	test 'quoted text' readonly 2>/dev/null readonly awk --verbose "$1" |
+	awk $(pwd) ${HOME} | $(pwd) $(pwd) awk cd | --verbose
+	then "$1" --verbose local awk "$@" local 'quoted text' && "$@"
+	--verbose -eu awk local test
+	--verbose local $(pwd) then /usr/bin
+	awk ${HOME} done ${HOME} awk done
+	test --verbose test /usr/bin
+		then /usr/bin then "$1" awk printf ${HOME} export local
+		done awk printf "$1" awk 2>/dev/null --verbose printf | /usr/bin ${HOME}
+"$1" export echo --verbose
+		"$@" 2>/dev/null --verbose printf x=1 awk "$@"
+export local sed printf x=1 echo grep $(pwd) && cd -eu | |
+awk --verbose readonly --verbose readonly x=1 echo printf 'quoted text'
+-eu echo sed "$1" && --verbose printf "$1" $(pwd)
+		"$1" test grep awk && printf "$1" --verbose cd echo sed cd printf 'quoted text'
+grep readonly local | | cd local then sed export -eu
+	'quoted text' 'quoted text' x=1 && && done x=1 --verbose
+awk grep sed "$@" awk 2>/dev/null "$1"
+x=1 test local then -eu 2>/dev/null awk grep -eu grep printf
+		2>/dev/null -eu cd "$@" "$1" export local grep && test -eu sed "$@" sed
+		local awk cd | done echo local then done
+/usr/bin export | readonly local -eu 'quoted text' awk
+	test "$1" "$@" awk /usr/bin $(pwd) cd -eu cd "$1" grep printf "$1" local sed -eu
+awk "$@" grep grep ${HOME} ${HOME} grep "$@" --verbose
+printf "$1" cd readonly export ${HOME}
+	| then x=1 cd /usr/bin "$@" printf cd --verbose cd $(pwd) echo done sed --verbose
+	| readonly /usr/bin cd "$1" /usr/bin
+		| test ${HOME} readonly && /usr/bin readonly "$@" printf sed awk
+		grep then 'quoted text' && readonly ${HOME} then local done export /usr/bin
+	x=1 test test awk sed
+		awk grep /usr/bin 'quoted text' local test /usr/bin 'quoted text' grep export
+--verbose 'quoted text' cd sed -eu readonly "$1" cd "$1" "$1" export awk then
+		| grep -eu echo echo grep readonly test export /usr/bin ${HOME} --verbose
+		-eu | cd "$@" $(pwd) local printf cd "$@" readonly local 2>/dev/null
+	local /usr/bin echo --verbose awk test printf 'quoted text' -eu "$1" "$@"
+"$1" x=1 "$1" printf export grep awk | cd sed then --verbose test then cd sed &&
+x=1 /usr/bin | done ${HOME} export grep -eu export awk && | "$@"
+--verbose "$1" sed ${HOME} grep
+echo echo --verbose /usr/bin
+echo local --verbose 2>/dev/null readonly 'quoted text' export
+		--verbose sed /usr/bin readonly done --verbose then printf readonly echo ${HOME}
+local && local /usr/bin sed grep --verbose
+		awk cd sed 'quoted text' echo test $(pwd) $(pwd) awk
+	"$@" x=1 ${HOME} "$@" -eu sed 2>/dev/null
+done grep local test cd "$1"
+test local "$@" awk cd echo -eu | done "$@" "$1" cd /usr/bin
+	2>/dev/null echo 2>/dev/null grep "$@" -eu 'quoted text' sed "$@"
+-eu readonly -eu x=1 $(pwd) grep printf sed local cd
+	$(pwd) grep grep "$1"
+		done | echo export --verbose then awk export grep awk "$@"
+	| cd readonly | $(pwd) x=1 done readonly grep x=1 test
+		-eu printf && sed --verbose local ${HOME} -eu echo &&
+	'quoted text' 2>/dev/null done 'quoted text' grep
+	-eu sed export done 2>/dev/null cd grep sed --verbose
+	"$@" $(pwd) 2>/dev/null test "$1" sed /usr/bin /usr/bin "$1" test then
+| && $(pwd) | printf test echo export local 2>/dev/null then cd x=1
+		export export export local
+then awk local done done done readonly "$1" ${HOME} local --verbose
+then ${HOME} printf "$1" readonly x=1 --verbose && readonly sed echo
+	&& ${HOME} then "$1" 'quoted text'
+x=1 x=1 awk printf echo x=1 2>/dev/null 2>/dev/null test echo readonly | sed awk
+'quoted text' ${HOME} then x=1 'quoted text'
+| printf 'quoted text' echo
+	"$@" readonly readonly readonly grep x=1 && awk $(pwd) | then /usr/bin 'quoted text'
+then done then then -eu echo grep "$1" grep awk grep x=1 echo && printf local then
+	"$@" local grep cd cd x=1 | test done /usr/bin --verbose export --verbose
+--verbose 'quoted text'
+	2>/dev/null then 2>/dev/null readonly then /usr/bin then -eu cd printf
+/usr/bin then && echo grep "$1" 'quoted text' grep
+local 'quoted text' awk test readonly grep done readonly && --verbose
+	sed 2>/dev/null done "$1" --verbose
+$(pwd) grep x=1 && sed grep cd --verbose printf
+		export grep 'quoted text' 'quoted text' cd then readonly awk then
+${HOME} cd done && readonly 'quoted text' 'quoted text'
+| sed test done grep awk ${HOME} $(pwd) export /usr/bin x=1 printf
+		"$1" local -eu local echo | export then |
+	"$@" x=1 -eu /usr/bin test $(pwd) /usr/bin then | local ${HOME}
+	'quoted text' then test printf export echo
+local && 2>/dev/null awk export echo -eu --verbose export
+		cd "$@" ${HOME} echo printf cd && x=1 test cd printf --verbose printf
+	export export x=1 ${HOME} then sed test 'quoted text' done printf echo
+	-eu local "$1" sed --verbose
+	--verbose "$1" && /usr/bin local -eu $(pwd) --verbose
+	$(pwd) /usr/bin export $(pwd) 'quoted text' $(pwd) local printf $(pwd) done test
+		${HOME} /usr/bin x=1 2>/dev/null "$1" x=1 then
+"$1" | readonly && $(pwd) cd && x=1 readonly
+	-eu awk grep /usr/bin "$1" ${HOME} export
+		-eu "$@" && "$@" echo readonly x=1 x=1 awk test "$@"
+	x=1 readonly ${HOME} local
+sed 2>/dev/null test && echo local sed /usr/bin
+--verbose grep then echo grep then --verbose test 'quoted text'
+		| export 'quoted text' done -eu grep "$1" readonly test 'quoted text'
+	"$1" then local export $(pwd)
+"$1" x=1 then export local 2>/dev/null then "$@" sed grep x=1 --verbose "$@"
+${HOME} readonly done ${HOME} 2>/dev/null
+	&& readonly x=1 "$@" -eu | -eu | ${HOME}
+		readonly ${HOME} export then x=1 then
+		done grep sed ${HOME} export readonly ${HOME} "$@" $(pwd) cd 'quoted text' then
+readonly --verbose echo test
+--verbose | | 'quoted text' sed $(pwd)
+"$@" x=1 2>/dev/null 'quoted text' grep
+		2>/dev/null && && done done done done "$1"
+	grep printf test "$@" readonly echo /usr/bin test --verbose done echo "$@" x=1
+	$(pwd) 'quoted text' "$1" grep 'quoted text' cd $(pwd) local -eu
+test 2>/dev/null && $(pwd) --verbose
+	${HOME} | $(pwd) readonly done "$@" -eu ${HOME} | $(pwd) done 2>/dev/null
+	sed "$@" $(pwd) "$@" export $(pwd)
+printf export $(pwd) awk printf 2>/dev/null | export local /usr/bin
+printf echo readonly x=1 then $(pwd) printf
+	$(pwd) x=1 2>/dev/null ${HOME} 'quoted text'
+'quoted text' awk $(pwd) test 2>/dev/null
+		x=1 2>/dev/null awk x=1 -eu local grep printf
+		'quoted text' sed awk echo echo test echo then test --verbose grep x=1
+		test local then "$1" --verbose grep
+| awk grep grep ${HOME} done ${HOME}
+	then /usr/bin --verbose export -eu | done
+'quoted text' awk cd
+-eu then 'quoted text' ${HOME} x=1 then
+		printf local 2>/dev/null printf
+		-eu cd x=1 --verbose | -eu "$@" awk
+	2>/dev/null ${HOME} /usr/bin && | echo local awk x=1 export then "$@" cd | readonly
+"$1" /usr/bin grep 2>/dev/null readonly
+	export 2>/dev/null ${HOME} "$@" then done awk --verbose $(pwd) test local sed
+	'quoted text' done then test local
+		"$@" && local grep 'quoted text' awk then test awk then "$1" "$1" x=1 --verbose
+&& echo sed echo ${HOME} then then sed local test readonly x=1
+	x=1 grep awk printf test readonly then readonly then -eu "$@" awk 'quoted text'
+	'quoted text' test /usr/bin "$1" grep "$@" "$@" readonly x=1 /usr/bin
+		| sed local printf done "$@" x=1 -eu then "$@" readonly
+	echo local echo test grep
+		local done awk local x=1 printf "$1" awk "$1" done x=1 "$@"
+		| "$@" echo $(pwd) $(pwd) 'quoted text'
+	echo $(pwd) readonly printf
+		$(pwd) then ${HOME} echo ${HOME} grep 'quoted text'
+	export /usr/bin -eu test readonly | printf 2>/dev/null "$@"
+		/usr/bin done "$1" | echo -eu readonly done x=1 --verbose
+		test grep --verbose && ${HOME} x=1 --verbose
+test test awk cd cd export
+$(pwd) "$@" $(pwd) local x=1 $(pwd) && x=1 cd cd 2>/dev/null ${HOME} | | echo --verbose
+	--verbose x=1 awk "$1" printf sed && then 2>/dev/null
+-eu readonly readonly "$1" x=1 printf sed readonly $(pwd) awk /usr/bin
+		done && cd $(pwd) grep /usr/bin readonly sed ${HOME}
+grep ${HOME} -eu then done --verbose sed "$@" done test 2>/dev/null local
+"$1" echo done ${HOME} cd readonly "$1"
+'quoted text' | echo test ${HOME} 'quoted text' && /usr/bin grep
+readonly grep | echo $(pwd) done && x=1 /usr/bin x=1 "$1" 2>/dev/null "$@"
+		grep 2>/dev/null $(pwd) awk
+		test grep then "$1" "$1" cd | /usr/bin /usr/bin
+	export 2>/dev/null local 2>/dev/null 2>/dev/null -eu /usr/bin "$1" && && export
+	then local $(pwd) $(pwd) export grep
+		--verbose sed | ${HOME} $(pwd) $(pwd) grep
+		export done 2>/dev/null /usr/bin done test && local done ${HOME} printf echo
+done -eu | ${HOME} readonly
+test test "$1" echo grep grep $(pwd) test printf "$1" sed
+		'quoted text' 'quoted text'
+	then /usr/bin grep ${HOME} sed echo echo --verbose grep $(pwd) local "$@"
+echo "$@" echo awk x=1 cd --verbose -eu
+'quoted text' x=1 echo printf --verbose cd 2>/dev/null
+		readonly /usr/bin then ${HOME}
+		x=1 && sed grep echo x=1 test done then /usr/bin /usr/bin -eu x=1 x=1 readonly
+then 'quoted text' /usr/bin local sed x=1 then readonly
+	-eu cd done && | echo grep awk printf ${HOME} cd /usr/bin /usr/bin
+	x=1 "$@" echo printf ${HOME} && x=1 sed sed $(pwd) then grep
+	done | test 'quoted text' echo readonly
+	export test --verbose | awk /usr/bin
+	export -eu readonly cd test 2>/dev/null
+		printf test export | then echo readonly done then test "$1" awk readonly sed done
+	readonly sed -eu --verbose local printf -eu readonly $(pwd) --verbose "$1" cd
+readonly -eu x=1 sed "$1" --verbose --verbose awk grep 'quoted text' echo
+		test cd /usr/bin | export "$1" "$1" test 'quoted text' "$1" 2>/dev/null &&
+		cd -eu | printf ${HOME} && done awk | && "$1" ${HOME} "$1" |
+	readonly | test readonly sed && echo x=1 2>/dev/null
+	then awk awk test | $(pwd)
+	cd then grep --verbose local sed --verbose then ${HOME} "$@" local
+	"$@" x=1 sed ${HOME} -eu echo
+		cd then -eu export && && /usr/bin | awk 2>/dev/null then done cd echo 2>/dev/null
+	readonly done | | awk && x=1 "$1" local
+	${HOME} export awk --verbose sed "$@" readonly
+		test printf then | readonly then 'quoted text'
+| cd x=1 "$@" done cd cd then 'quoted text'
+&& grep then test -eu echo | "$@"
+		/usr/bin grep readonly sed local 2>/dev/null $(pwd)
+export && cd "$@" ${HOME} printf test -eu /usr/bin
+/usr/bin | test -eu export awk "$@" done -eu x=1 ${HOME} -eu
+$(pwd) ${HOME} $(pwd) grep --verbose
+x=1 'quoted text' && /usr/bin then
+	awk local readonly "$1" printf
+	/usr/bin --verbose echo awk "$1" export | test && $(pwd) 'quoted text'
+		/usr/bin local | 2>/dev/null
+		done local --verbose "$@" /usr/bin
+		local readonly && awk $(pwd) $(pwd) readonly then x=1
+	done sed $(pwd) ${HOME} x=1 cd sed 'quoted text' awk ${HOME} export --verbose done
+"$1" && --verbose $(pwd) echo $(pwd) && local awk -eu && sed x=1
+-eu done sed printf && export
+"$@" export test readonly grep test cd cd readonly && ${HOME} cd test
+	done | x=1 echo "$1" export -eu sed 'quoted text' done $(pwd)
+		readonly ${HOME} export | -eu && printf test sed 2>/dev/null sed readonly
+test && test sed cd readonly cd 2>/dev/null "$@" local then grep "$@" export
+--verbose sed | cd --verbose "$@"
+echo --verbose then | $(pwd) "$1" sed awk grep x=1 -eu --verbose
+export cd x=1 ${HOME} --verbose grep export cd export
+	"$1" x=1 echo && local export done local export local
+		2>/dev/null readonly --verbose
+		'quoted text' sed $(pwd) "$@" 'quoted text' readonly
+--verbose local grep awk awk printf printf ${HOME}
+cd "$@" && 2>/dev/null $(pwd)
+	&& 'quoted text' readonly $(pwd) 'quoted text' /usr/bin export /usr/bin "$1"
+	| && | echo grep export local readonly "$1"
+		sed /usr/bin test x=1 printf 2>/dev/null readonly done "$1" readonly
+	&& done awk --verbose && 2>/dev/null readonly --verbose test awk 2>/dev/null
+-eu 2>/dev/null cd sed local test "$1" printf readonly sed test
+test local printf printf -eu done
+		then x=1 readonly echo $(pwd) --verbose export
+x=1 | done test done x=1 local /usr/bin
+	"$1" $(pwd) sed "$@" /usr/bin -eu test | awk echo --verbose readonly x=1 2>/dev/null
+	export echo "$@" local awk cd "$@" ${HOME} then readonly | awk test $(pwd)
+		--verbose readonly awk test ${HOME} export -eu -eu | "$1"
+	x=1 cd cd done ${HOME} awk printf /usr/bin
+	test sed grep export "$1" /usr/bin cd 'quoted text' printf
+		export 2>/dev/null then -eu 2>/dev/null $(pwd) readonly cd readonly printf
+$(pwd) awk "$@" "$1" test
+grep -eu x=1 'quoted text' /usr/bin awk export "$1" $(pwd) then /usr/bin
+printf /usr/bin && echo ${HOME} --verbose $(pwd) 2>/dev/null
+	'quoted text' then test -eu sed && "$1" -eu --verbose x=1 $(pwd) printf readonly
+	cd 'quoted text' test | export echo x=1 done && "$1" echo local ${HOME}
+		2>/dev/null | local -eu test 'quoted text' done "$@" readonly 2>/dev/null
+test echo awk grep x=1 sed readonly done --verbose "$1" echo grep test local done
+	'quoted text' x=1 echo printf && /usr/bin $(pwd) cd $(pwd) 'quoted text'
+		"$1" && 2>/dev/null grep readonly
+		awk readonly 'quoted text' readonly | /usr/bin $(pwd) x=1 echo | "$1" ${HOME}
+		readonly test then then --verbose
+sed test x=1 readonly sed "$1" sed | then done 2>/dev/null
+	&& local "$1" then export x=1 'quoted text' "$1" -eu local grep -eu
+	"$1" -eu /usr/bin awk "$@"
+		grep 'quoted text' ${HOME} 'quoted text' readonly 'quoted text'
+		&& export grep sed echo awk local 2>/dev/null cd 2>/dev/null then
+-eu local "$@" echo echo && 'quoted text' test cd then --verbose export
+	| sed "$@" local "$1" --verbose $(pwd) $(pwd) /usr/bin then $(pwd)
+		local ${HOME} -eu $(pwd) export "$@" /usr/bin "$1" echo x=1
+	echo 'quoted text' $(pwd) "$@" --verbose echo $(pwd)
+&& /usr/bin | grep "$1" /usr/bin cd local done printf test
+	cd "$1" export local readonly 'quoted text'
+	"$1" test readonly "$1" /usr/bin sed local | 'quoted text' $(pwd)
+	test x=1 sed then | local --verbose sed awk done && 2>/dev/null
+		| -eu x=1 "$@" "$1" x=1 then then sed sed | x=1 awk --verbose awk "$@"
+printf grep -eu grep readonly printf printf readonly
+&& export $(pwd) readonly | ${HOME} x=1 /usr/bin printf
+	done echo --verbose awk done test printf -eu then
+	2>/dev/null done local sed printf sed echo 'quoted text'
+		printf | --verbose 2>/dev/null
+then "$1" export "$@"
+	&& | awk | ${HOME} sed readonly grep sed ${HOME} awk
+export grep x=1 x=1 then x=1 ${HOME} export test
+x=1 'quoted text' then x=1 'quoted text' && grep readonly
+| cd cd readonly done readonly awk 2>/dev/null then "$1" -eu 'quoted text'
+	sed test readonly done $(pwd) awk sed cd --verbose --verbose
+		printf sed x=1 echo x=1 "$@" | "$@" grep ${HOME} awk /usr/bin
+	local export echo 2>/dev/null
+		done --verbose $(pwd) export $(pwd) test /usr/bin grep
+'quoted text' ${HOME} --verbose awk awk 'quoted text'
+	done readonly grep grep
+	&& x=1 "$1" | local local cd
+2>/dev/null readonly && export
+	-eu cd --verbose $(pwd) then | $(pwd)
+		-eu printf 'quoted text' grep printf "$1"
+	$(pwd) 'quoted text' grep local /usr/bin 2>/dev/null awk printf
+		done awk | $(pwd) then "$1" grep --verbose done --verbose
+	x=1 local printf printf /usr/bin sed ${HOME}
+	x=1 $(pwd) then then $(pwd) awk ${HOME} -eu export | readonly
+cd readonly 'quoted text' --verbose && "$@" 2>/dev/null "$@" cd awk | 2>/dev/null
+'quoted text' --verbose "$@" 2>/dev/null "$@"
+	printf cd readonly readonly 2>/dev/null -eu ${HOME} /usr/bin
+printf "$@" awk 2>/dev/null "$1" ${HOME} "$@" readonly
+	then sed test /usr/bin "$1"
+	local && test --verbose grep x=1 ${HOME} sed ${HOME}
+		awk 2>/dev/null local then -eu readonly ${HOME}
+	2>/dev/null readonly then
+/usr/bin | test test readonly ${HOME} 'quoted text'
+	printf -eu then done ${HOME} /usr/bin
+${HOME} printf ${HOME} grep /usr/bin test
+		awk "$@" local local 'quoted text'
+	'quoted text' awk ${HOME} "$@"
+		readonly done | ${HOME} done | | export
+	cd /usr/bin cd printf echo 2>/dev/null ${HOME} "$1"
+		"$1" sed readonly local -eu done 2>/dev/null ${HOME} echo --verbose
+	then awk sed grep echo ${HOME} "$1" x=1 local "$@" local ${HOME} local
+then $(pwd) cd then "$1" readonly && && -eu export
+	then grep && sed awk -eu
+	echo export ${HOME} ${HOME} sed grep x=1 test echo -eu
+		'quoted text' /usr/bin test done | "$1" ${HOME} --verbose "$1" cd test /usr/bin
+	${HOME} done -eu sed awk test sed then x=1 local export ${HOME} $(pwd)
+"$1" printf grep echo 'quoted text' grep "$@"
+	/usr/bin 2>/dev/null echo $(pwd) awk && | export
+grep test readonly grep "$1" then
+	grep sed $(pwd) && local sed sed
+	$(pwd) && && grep awk sed echo export export | export
+		then readonly /usr/bin export x=1 local test --verbose echo then
+		done x=1 local local && $(pwd) cd local
+		grep then echo --verbose "$@" ${HOME} | ${HOME} local test $(pwd) "$@"
+	"$1" | 2>/dev/null grep "$1" grep export
+printf "$@" then && --verbose
+| 'quoted text' local "$1"
+	test /usr/bin then "$1" -eu test --verbose cd ${HOME}
+		&& then echo then "$1" x=1 test "$@" $(pwd) cd readonly then readonly
+	x=1 x=1 -eu ${HOME} echo cd 'quoted text'
+${HOME} --verbose ${HOME} cd 'quoted text' 2>/dev/null
+$(pwd) grep "$1" sed --verbose echo "$@" $(pwd)
+	printf cd $(pwd) cd test then local readonly "$@" cd sed awk x=1 sed "$@"
+"$@" readonly $(pwd) readonly echo $(pwd) done $(pwd) then $(pwd) cd
+	export 'quoted text' $(pwd) --verbose ${HOME}
+'quoted text' printf grep awk cd readonly awk cd printf
+		cd "$1" "$@" /usr/bin local echo "$1" awk printf grep printf test
+	-eu /usr/bin export printf "$@"
+	${HOME} readonly 'quoted text' 'quoted text'
+	readonly "$1" /usr/bin && 'quoted text' x=1 "$1" /usr/bin grep -eu $(pwd)
+	sed export echo done /usr/bin grep x=1 grep local ${HOME} /usr/bin
+sed 2>/dev/null $(pwd) printf grep then sed /usr/bin
+done printf test readonly -eu --verbose sed local --verbose
+		"$1" echo x=1 local 'quoted text'
+printf export ${HOME} grep ${HOME} grep printf
+		$(pwd) printf 'quoted text' grep readonly ${HOME} grep export x=1 --verbose
+then "$1" -eu "$@" | "$1" local $(pwd) then grep && printf 'quoted text'
+	echo ${HOME} && export | 2>/dev/null then cd test $(pwd) done test "$@" 2>/dev/null
+	--verbose test sed x=1 -eu 'quoted text' cd awk "$@"
+"$@" export && x=1 then cd readonly echo | "$@" | export && sed "$@"
+	-eu readonly cd 'quoted text' awk && sed
+		2>/dev/null grep "$@" grep "$1" 2>/dev/null
+cd done && printf echo export echo --verbose ${HOME}
+readonly ${HOME} /usr/bin 2>/dev/null printf local
+		printf awk test done printf
+readonly -eu done 2>/dev/null sed awk "$1" |
+		sed done ${HOME} ${HOME} && sed local "$@"
+	'quoted text' readonly "$1" $(pwd) "$1"
+local done /usr/bin "$1" printf printf "$1" cd && && "$1" printf
+"$@" sed x=1 "$@" /usr/bin awk test
+"$1" export readonly /usr/bin 'quoted text' readonly awk echo done
+	local 'quoted text' ${HOME} echo then printf "$1" "$1" readonly "$@"
+then cd then "$@" done then 'quoted text'
+grep ${HOME} cd x=1 "$1" ${HOME} sed "$1" 'quoted text' export
+		"$1" echo sed ${HOME} ${HOME} sed x=1 export --verbose
+	echo cd done && test done 'quoted text' ${HOME}
+		grep "$1" then && test cd --verbose
+| 2>/dev/null | "$@" then local "$@" sed "$@"
+printf grep -eu test local readonly | printf cd && -eu
+		--verbose /usr/bin grep done "$@" grep && sed /usr/bin | printf -eu done echo
+		-eu local x=1 cd /usr/bin sed
+	awk awk sed readonly && 2>/dev/null test echo -eu done -eu 2>/dev/null
+	sed x=1 | -eu cd "$1" echo export cd readonly -eu then grep "$@" -eu $(pwd)
+	then x=1 then --verbose --verbose ${HOME} local $(pwd) -eu local "$1"
+		${HOME} printf $(pwd)
+printf ${HOME} local echo x=1 "$1" | sed
+test awk echo 'quoted text' --verbose echo test && sed
+'quoted text' then grep
+printf | -eu --verbose grep "$@" ${HOME} "$@" grep then readonly -eu
+	echo echo readonly cd $(pwd) 2>/dev/null awk sed sed test done
+	local local export test echo readonly 'quoted text' done
+		x=1 then sed cd 2>/dev/null /usr/bin grep printf export /usr/bin
+	readonly done local x=1 2>/dev/null $(pwd) -eu test sed 'quoted text'
+x=1 $(pwd) -eu cd && printf "$1" $(pwd) -eu done ${HOME} /usr/bin &&
+		then local test && awk sed test $(pwd) 2>/dev/null
+		echo done readonly readonly 2>/dev/null
+printf "$1" echo local local $(pwd) -eu "$@" sed readonly cd
+	printf $(pwd) ${HOME} --verbose printf "$1" && readonly printf /usr/bin "$@"
+		&& test 2>/dev/null x=1 export 'quoted text'
+grep echo $(pwd) /usr/bin
+	local test 2>/dev/null -eu cd /usr/bin grep | awk | done
+"$1" "$1" 'quoted text' /usr/bin
+	then local 2>/dev/null printf awk cd 2>/dev/null awk grep readonly | | grep --verbose
+	printf $(pwd) 'quoted text' /usr/bin 2>/dev/null "$@" | local then --verbose
+		| "$1" | ${HOME} done /usr/bin grep -eu $(pwd) cd local local /usr/bin
+	"$@" && then readonly "$1" export grep
+export $(pwd) --verbose ${HOME} "$@" ${HOME} && "$@" 2>/dev/null
+		cd echo x=1 ${HOME} export x=1 local grep printf
+-eu readonly then --verbose done export ${HOME} awk then local done
+test $(pwd) "$@" 'quoted text' cd 'quoted text'
+		$(pwd) test 2>/dev/null awk ${HOME} test grep awk -eu test awk done sed &&
+| && && --verbose grep $(pwd) x=1 test then grep 2>/dev/null
+		"$1" sed /usr/bin sed awk export 'quoted text' /usr/bin
+	${HOME} printf then local readonly export 2>/dev/null
+	/usr/bin local /usr/bin sed test $(pwd) 'quoted text'
+		"$1" then awk 'quoted text' x=1 awk test 'quoted text' local echo ${HOME}
+		local "$@" -eu test 2>/dev/null -eu | "$1" grep test
+	| then /usr/bin test cd
+		/usr/bin echo | "$1" 'quoted text'
+	export && "$1" export && --verbose | export
+		&& sed -eu done printf x=1 cd -eu 2>/dev/null
+		&& | readonly $(pwd) &&
+	2>/dev/null x=1 test done export sed 'quoted text'
+echo readonly $(pwd) $(pwd) grep --verbose
+	/usr/bin && awk test test grep
+export export 'quoted text' sed then grep
+		/usr/bin test && $(pwd) x=1 "$@" --verbose grep
+		cd /usr/bin test test && done sed && 'quoted text' | sed x=1 done test
+printf done /usr/bin grep 2>/dev/null
+		2>/dev/null x=1 ${HOME} --verbose --verbose
+		--verbose "$1" grep "$1" x=1 echo test
+printf /usr/bin grep /usr/bin $(pwd) echo --verbose sed cd 2>/dev/null
+		sed x=1 ${HOME} && $(pwd) awk sed |
+/usr/bin /usr/bin "$1" $(pwd) local && readonly export "$@" "$1" 2>/dev/null
+		2>/dev/null grep /usr/bin
+	/usr/bin /usr/bin $(pwd) readonly cd
+	test readonly $(pwd) 'quoted text' x=1 grep -eu readonly 'quoted text'
+"$@" 'quoted text' $(pwd) | | && | 2>/dev/null --verbose
+		-eu printf sed -eu sed "$1" sed -eu export then && 'quoted text' test 'quoted text'
+		-eu local "$@" /usr/bin printf cd "$1" | cd /usr/bin grep --verbose echo
+	then | printf ${HOME} /usr/bin 'quoted text'
+		2>/dev/null export cd "$@" --verbose 'quoted text' /usr/bin test printf
+	done grep x=1 readonly awk test x=1 $(pwd)
+${HOME} /usr/bin grep $(pwd) sed x=1 readonly sed -eu x=1 readonly
+	local echo 2>/dev/null readonly then sed cd 'quoted text' ${HOME} cd printf
+	"$1" grep 2>/dev/null done done | export --verbose done local awk "$1" then
+"$@" 'quoted text' --verbose && "$@" 'quoted text'
+		"$1" "$1" && printf && x=1 done
+	$(pwd) $(pwd) readonly grep sed 2>/dev/null x=1 cd test export "$1" 2>/dev/null
+		awk cd sed | $(pwd) echo local
+2>/dev/null $(pwd) --verbose "$@" 'quoted text'
+printf echo /usr/bin "$1" $(pwd)
+	printf /usr/bin cd "$1" 'quoted text' printf printf /usr/bin sed
+	readonly | 2>/dev/null --verbose --verbose "$@" 2>/dev/null
+--verbose sed echo awk x=1 -eu /usr/bin then x=1 echo test -eu --verbose ${HOME}
+	x=1 done local local -eu -eu "$1" export $(pwd) -eu /usr/bin "$1" -eu x=1 x=1
+2>/dev/null done local && sed then /usr/bin readonly $(pwd)
+#include c37.sh
+	${HOME} | echo ${HOME} awk test
+	awk then | export ${HOME} cd
+		cd export cd 'quoted text' sed | 'quoted text' done
+$(pwd) export then echo --verbose export
+		'quoted text' --verbose && 2>/dev/null | done x=1 echo /usr/bin
+"$@" done done 'quoted text'
+"$@" x=1 then 2>/dev/null awk echo | -eu "$@" | &&
+	'quoted text' && "$@" "$@" && /usr/bin "$1" local local local 2>/dev/null
+	${HOME} x=1 local grep local local awk awk cd && then x=1
+local | 'quoted text' then && done local sed | test | then export done
+'quoted text' sed then "$1" echo cd readonly ${HOME} "$@" readonly ${HOME} local
+	done --verbose 'quoted text' test echo local local 2>/dev/null local
+		grep echo awk export -eu 2>/dev/null
+		--verbose grep cd printf
+| x=1 ${HOME} export then local ${HOME} export
+		echo /usr/bin sed 2>/dev/null cd readonly ${HOME} printf export
+2>/dev/null then printf sed local test test -eu then
+		printf awk test | && 'quoted text' -eu cd && sed --verbose $(pwd) export
+	'quoted text' | test cd then -eu && grep /usr/bin
+cd local awk /usr/bin /usr/bin
+		"$1" cd | local grep printf 'quoted text' "$@" awk && "$@"
+"$1" && awk ${HOME} done "$1" 2>/dev/null
+	${HOME} --verbose echo | then printf then test echo
+		readonly done /usr/bin 'quoted text' -eu --verbose cd test | "$@" x=1 then 'quoted text'
+	| -eu awk local done "$@" printf echo 'quoted text' && | "$@" local sed
+	--verbose | | sed /usr/bin -eu $(pwd)
+	-eu --verbose 'quoted text' sed done sed $(pwd) then cd -eu
+		awk cd grep readonly && | x=1 "$1" "$1" /usr/bin sed
+cd x=1 echo ${HOME} then then 'quoted text' cd then --verbose test
+		| /usr/bin then "$@" grep then $(pwd) then
+test /usr/bin readonly done echo local 2>/dev/null cd /usr/bin -eu x=1 "$@" then
+	/usr/bin sed local readonly awk
+	-eu | sed readonly cd && -eu done ${HOME} readonly --verbose grep x=1 export
+	-eu && test done grep export "$@" test sed test && then && readonly cd && 'quoted text'
+grep sed local ${HOME} grep x=1 cd 'quoted text'
+		sed done done | export && "$1" sed 'quoted text' readonly
+| local grep | x=1 cd sed 2>/dev/null ${HOME}
+		"$1" local 'quoted text' sed awk "$1" /usr/bin /usr/bin 2>/dev/null
+		$(pwd) "$1" then ${HOME} printf export 2>/dev/null local -eu "$1"
+	local 2>/dev/null x=1 $(pwd) /usr/bin --verbose cd /usr/bin "$@" awk /usr/bin
+		${HOME} grep "$@" local "$@" 'quoted text'
+	-eu x=1 done printf local
+	readonly awk export -eu /usr/bin then echo /usr/bin printf local
+		then "$@" $(pwd) "$@" ${HOME} 'quoted text' echo 2>/dev/null
+		| --verbose | "$@" | then sed
+	| done echo x=1 "$@" ${HOME} $(pwd) | && -eu /usr/bin x=1 ${HOME}
+		&& sed $(pwd) x=1 awk
+	readonly export awk "$1" x=1
+		--verbose --verbose local export
+x=1 cd 2>/dev/null && 2>/dev/null
+export /usr/bin ${HOME} x=1 cd "$1" sed grep sed $(pwd) echo
+grep export "$@" sed -eu then 2>/dev/null export
+		$(pwd) export grep --verbose && "$@" then -eu "$@" then local
+| printf -eu grep local echo sed awk cd ${HOME} done "$1" | 2>/dev/null
+	readonly printf printf && /usr/bin export local $(pwd) grep "$@" &&
+		cd cd ${HOME} then ${HOME} |
+	${HOME} 2>/dev/null awk "$1" ${HOME} printf /usr/bin grep export --verbose
+		readonly echo "$@" ${HOME} sed then | | grep 'quoted text' echo printf 'quoted text'
+		--verbose --verbose 2>/dev/null echo cd done export -eu
+		cd done echo test local && x=1 "$@" "$@"
+		'quoted text' | awk x=1 readonly x=1 "$1" export readonly done ${HOME}
+x=1 printf readonly -eu "$1" readonly printf ${HOME} -eu
+	-eu x=1 local awk 2>/dev/null "$1" --verbose printf readonly | then -eu --verbose
+		then awk && sed $(pwd) export done && 'quoted text' grep
+export cd x=1 awk echo -eu "$@" awk test 2>/dev/null local && $(pwd)
+	${HOME} printf awk export "$@" /usr/bin done x=1 | 'quoted text'
+	readonly | "$1" "$@" export test $(pwd)
+${HOME} cd -eu 'quoted text' 2>/dev/null echo ${HOME} printf
+		sed --verbose then then
+		2>/dev/null echo cd 'quoted text' readonly
+readonly 'quoted text' && /usr/bin then printf printf printf | /usr/bin
+	-eu awk local 'quoted text' -eu ${HOME} readonly export
+		--verbose "$1" /usr/bin "$@"
+export | && printf -eu -eu ${HOME} "$@" "$@"
+	"$@" printf && | | then "$@" --verbose echo
+grep /usr/bin grep x=1 cd "$@" $(pwd) awk cd -eu x=1 test test
+x=1 grep echo done /usr/bin $(pwd) 'quoted text' ${HOME} /usr/bin local printf
+	cd --verbose 2>/dev/null /usr/bin awk
+--verbose readonly "$1" ${HOME} $(pwd) x=1 $(pwd) -eu test | "$1" echo ${HOME}
+	&& cd test sed test export && then printf 'quoted text' sed --verbose grep test
+local 2>/dev/null cd "$@" done 2>/dev/null
+		readonly $(pwd) | printf && "$1" printf $(pwd) /usr/bin
+		then && awk test /usr/bin
+		printf | awk 'quoted text' awk sed awk 2>/dev/null then test done
+	awk export "$@" cd && "$@" readonly grep x=1 then -eu 'quoted text'
+	x=1 printf cd grep echo grep --verbose cd printf 'quoted text' awk
+	'quoted text' ${HOME} printf x=1 printf -eu $(pwd)
+	"$1" $(pwd) sed done x=1 readonly --verbose grep 'quoted text' ${HOME} x=1 "$1"
+	test "$1" echo readonly echo 'quoted text' sed /usr/bin then grep done
+		/usr/bin sed "$1" 'quoted text' local echo
+	export printf ${HOME} "$@" printf -eu ${HOME} && | echo 'quoted text' && local grep
+	$(pwd) printf echo "$1" ${HOME} cd $(pwd) -eu readonly
+| then awk local ${HOME} then | "$1" awk
+"$1" x=1 sed printf echo
+	/usr/bin && echo "$@" readonly 2>/dev/null "$1"
+test test printf "$1" && local "$@" 2>/dev/null export -eu
+	then awk export echo echo $(pwd) local -eu printf 'quoted text' ${HOME} 2>/dev/null
+echo then local then x=1 cd test test then done "$1" && | "$1" -eu sed
+		readonly $(pwd) then ${HOME} grep readonly awk "$1" printf "$@" "$@" /usr/bin
+	'quoted text' test /usr/bin printf awk ${HOME} | readonly | && 'quoted text'
+		2>/dev/null --verbose grep echo "$@" && sed /usr/bin
+		local ${HOME} x=1 local test grep then readonly echo local /usr/bin
+	done awk printf echo "$1" x=1 | "$1" readonly readonly then test test sed echo /usr/bin
+	grep "$1" then printf grep sed x=1 ${HOME} x=1 readonly test cd | printf --verbose
+		readonly readonly "$1" x=1 |
+	"$@" awk 2>/dev/null ${HOME} awk grep $(pwd) grep done then && --verbose $(pwd)
+	grep echo 'quoted text' export -eu --verbose
+done --verbose grep cd -eu awk x=1 "$@" printf x=1
+readonly awk grep | then 'quoted text' 2>/dev/null
+		x=1 2>/dev/null local 'quoted text' awk local -eu "$1" then 'quoted text' echo cd
+cd | cd 2>/dev/null x=1 'quoted text'
+	done -eu --verbose 'quoted text' --verbose cd export
+	then awk -eu "$1" awk awk 2>/dev/null test
+		grep --verbose "$@" | "$1" export export
+	'quoted text' echo test then $(pwd) --verbose local
+sed $(pwd) grep cd ${HOME} /usr/bin ${HOME} "$1" awk cd local export
+	echo && 'quoted text' && $(pwd) 2>/dev/null awk /usr/bin
+		${HOME} ${HOME} x=1 awk ${HOME} local "$1" "$@" local
+		then "$1" /usr/bin export 2>/dev/null local echo -eu
+		/usr/bin local sed printf cd ${HOME}
+cd "$@" "$@" echo "$1" x=1 grep $(pwd) && x=1 done
+	export --verbose -eu x=1 /usr/bin echo export 2>/dev/null
+	x=1 grep done | -eu local
+		| local printf --verbose printf export
+		$(pwd) && $(pwd) sed sed test 'quoted text' readonly ${HOME}
+${HOME} "$1" 2>/dev/null sed local printf then then -eu x=1
+	${HOME} local x=1 2>/dev/null sed
+		2>/dev/null $(pwd) 2>/dev/null ${HOME} /usr/bin readonly cd export printf
+		echo && local export "$1"
+		--verbose ${HOME} readonly
+	awk readonly done | "$1" readonly then 'quoted text' /usr/bin --verbose
+	/usr/bin x=1 && sed export
+		${HOME} local readonly $(pwd) sed x=1 awk done cd sed ${HOME} ${HOME} printf echo
+		$(pwd) local then 2>/dev/null
+x=1 local ${HOME} readonly sed ${HOME} "$@" /usr/bin "$@" "$@" -eu done
+	export && x=1 then then
+	${HOME} awk done "$1"
+echo test printf 'quoted text' $(pwd) echo -eu | local "$1" --verbose readonly
+		x=1 test "$@" ${HOME} 2>/dev/null
+		2>/dev/null export done /usr/bin && awk 2>/dev/null
+		"$1" cd test done awk export awk ${HOME} local x=1 awk -eu readonly
+		2>/dev/null 2>/dev/null local x=1 x=1 ${HOME} printf readonly x=1
+	&& then local --verbose local export sed --verbose
+printf "$@" awk printf ${HOME} $(pwd) x=1 "$@" echo readonly grep && awk printf
+	printf printf then $(pwd) /usr/bin then ${HOME} cd | --verbose readonly
+		test $(pwd) done sed readonly 2>/dev/null
+	--verbose $(pwd) export done test 'quoted text' printf
+		&& "$1" -eu test grep --verbose
+		echo ${HOME} 'quoted text' grep
+	'quoted text' grep | echo sed readonly 2>/dev/null | readonly "$@"
+grep "$1" awk local cd readonly grep export && sed grep
+	sed /usr/bin /usr/bin --verbose done x=1 local ${HOME} echo
+'quoted text' export 2>/dev/null -eu awk cd
+export $(pwd) grep 2>/dev/null
+		--verbose then -eu done done 2>/dev/null echo test /usr/bin local then x=1 |
+		local sed 'quoted text' "$1" "$@" "$1" test && "$@"
+grep ${HOME} local /usr/bin "$@" 2>/dev/null ${HOME} x=1 awk then ${HOME}
+		echo -eu printf && printf && 2>/dev/null awk 'quoted text'
+	/usr/bin local x=1 -eu 'quoted text' | printf ${HOME}
+		x=1 export test echo --verbose test sed test --verbose 'quoted text'
+	'quoted text' then awk && awk done
+	grep local | done "$@" export x=1 then done grep echo && cd export
+'quoted text' sed && grep
+grep printf 2>/dev/null ${HOME} $(pwd) test then local "$1" test export
+		-eu x=1 readonly cd 'quoted text' ${HOME} /usr/bin then
+		| cd awk | grep printf printf ${HOME} readonly printf grep printf
+	then sed x=1 /usr/bin cd readonly ${HOME} awk "$@" ${HOME}
+done x=1 2>/dev/null export
+	test cd sed done grep then
+		x=1 sed $(pwd) 'quoted text' --verbose
+	export 'quoted text' export readonly --verbose echo printf
+		--verbose ${HOME} readonly sed awk grep echo 2>/dev/null
+		cd readonly echo export x=1 export /usr/bin ${HOME}
+		awk $(pwd) readonly && /usr/bin $(pwd) | --verbose
+		echo $(pwd) grep 2>/dev/null done --verbose
+		&& test done ${HOME} export
+		| export --verbose export "$1" readonly "$1" -eu cd "$@" ${HOME} x=1
+export then x=1 /usr/bin readonly 2>/dev/null /usr/bin $(pwd) done local
+		${HOME} | echo local &&
+		local x=1 cd && 2>/dev/null 2>/dev/null
+	$(pwd) awk readonly --verbose ${HOME}
+"$1" "$@" x=1 "$1" $(pwd) /usr/bin $(pwd) grep local "$1" /usr/bin | awk | local
+		${HOME} | 2>/dev/null
+echo 2>/dev/null export export grep printf grep 2>/dev/null grep
+	printf $(pwd) "$1" export test x=1
+	echo awk grep | x=1 printf awk local ${HOME} export -eu echo echo "$1"
+		grep done ${HOME} sed then readonly /usr/bin
+		export /usr/bin 'quoted text' && local "$@" "$1"
+"$@" test --verbose | awk cd -eu local
+		readonly --verbose awk ${HOME}
+		awk local $(pwd) done 2>/dev/null /usr/bin done done readonly "$1" done
+$(pwd) local done 2>/dev/null awk echo export then --verbose readonly x=1 done |
+		$(pwd) --verbose 'quoted text'
+		test test | -eu grep ${HOME} awk 2>/dev/null grep test x=1
+		readonly "$@" awk done export test &&
+printf -eu ${HOME} x=1 cd grep && local test x=1 test printf
+	done "$1" local done "$@" export echo
+	readonly -eu echo | readonly test $(pwd) ${HOME} -eu | 2>/dev/null --verbose
+	"$@" echo --verbose && readonly $(pwd) "$1" awk "$1"
+	awk awk 'quoted text' "$@" x=1
+	${HOME} 'quoted text' test
+local x=1 done $(pwd) 2>/dev/null
+| x=1 /usr/bin && export $(pwd) && -eu echo "$@" then readonly echo echo sed
+		test then -eu /usr/bin
+-eu readonly awk ${HOME} $(pwd) x=1 export
+		&& done local --verbose x=1 test printf
+	done "$1" export readonly 2>/dev/null done $(pwd) grep
+	done && 2>/dev/null local echo local -eu then
+grep ${HOME} --verbose readonly 2>/dev/null ${HOME}
+test printf "$@" awk x=1 ${HOME} && test ${HOME} /usr/bin
+	done 'quoted text' /usr/bin 2>/dev/null export
+		'quoted text' 'quoted text' echo --verbose "$1" | printf export
+		'quoted text' local "$1" ${HOME} export --verbose awk
+		then 'quoted text' sed then "$1" readonly export -eu cd
+		cd test readonly then x=1 readonly export test awk export
+	${HOME} $(pwd) x=1 local export --verbose grep /usr/bin printf ${HOME}
+	2>/dev/null done && then "$1" echo cd | && sed readonly "$1" cd awk
+	-eu echo printf -eu cd "$@" --verbose
+awk readonly /usr/bin -eu 2>/dev/null done 'quoted text' local
+grep printf && x=1 $(pwd) cd printf test ${HOME} $(pwd) done done printf 'quoted text'
+local awk export ${HOME} /usr/bin awk ${HOME} sed 'quoted text' 2>/dev/null
+sed | awk awk echo done printf then && /usr/bin
+export ${HOME} -eu cd "$1" /usr/bin printf
+		sed | 'quoted text' | echo sed printf /usr/bin
+	readonly "$1" export export | | 'quoted text' && "$@" echo
+		--verbose "$1" /usr/bin /usr/bin --verbose grep
+x=1 readonly awk echo ${HOME} test -eu -eu --verbose done
+		&& sed 2>/dev/null && then x=1
+		sed sed export done done "$@" sed sed cd echo --verbose test
+		x=1 ${HOME} local /usr/bin ${HOME} sed x=1 sed test 'quoted text'
+		printf echo then 'quoted text' /usr/bin sed done x=1 sed export
+		$(pwd) readonly "$1" -eu
+		--verbose local then /usr/bin echo readonly then "$1" --verbose
+		"$1" "$1" 'quoted text' echo /usr/bin awk 'quoted text'
+$(pwd) printf then "$@" && &&
+		done && --verbose test export "$@" printf then
+	"$@" "$1" done readonly && echo then --verbose test printf
+	2>/dev/null x=1 "$1" done done printf "$1" sed done ${HOME} ${HOME}
+		$(pwd) then 'quoted text' 2>/dev/null "$1" "$1" sed sed -eu sed readonly then
+		x=1 export printf ${HOME} $(pwd) done "$@"
+x=1 -eu x=1 readonly 2>/dev/null
+${HOME} readonly x=1 sed sed -eu 2>/dev/null -eu 'quoted text'
+awk 'quoted text' /usr/bin export test done x=1
+	"$@" done && grep "$1" sed readonly | $(pwd) awk done && readonly local
+2>/dev/null 'quoted text' local done printf printf
+then $(pwd) | done | export awk then ${HOME} readonly x=1 printf local | sed
+	x=1 local cd 'quoted text'
+local 'quoted text' 2>/dev/null printf then "$1" -eu "$@" awk
+		2>/dev/null ${HOME} local then 'quoted text' /usr/bin awk
+	test 2>/dev/null "$@" 2>/dev/null "$1" then --verbose grep 2>/dev/null
+grep | awk && ${HOME} 'quoted text' "$@" test done --verbose export
+export sed -eu sed sed cd readonly 2>/dev/null export
+		then local readonly /usr/bin $(pwd) grep test cd awk "$1"
+		echo x=1 cd echo done && printf echo local -eu x=1 sed export printf local
+		then then /usr/bin sed printf export
+	2>/dev/null readonly "$1" | -eu then export
+	x=1 cd sed export 2>/dev/null export 2>/dev/null
+	$(pwd) "$@" --verbose printf awk grep local readonly
+		awk -eu --verbose && /usr/bin && awk export awk test 2>/dev/null
+	| local | awk /usr/bin then -eu done local cd "$@" && then printf grep
+-eu sed export --verbose grep && $(pwd) 2>/dev/null
+echo readonly echo grep
+then --verbose echo --verbose awk ${HOME} grep
+awk -eu done readonly then && printf
+	${HOME} local && ${HOME}
+		cd && grep -eu "$@" x=1 "$@"
+		| readonly x=1 echo sed grep awk 'quoted text' done $(pwd) awk cd grep /usr/bin
+printf printf grep "$@" cd --verbose
+sed export local $(pwd) 'quoted text'
+	/usr/bin echo /usr/bin x=1 /usr/bin
+		"$1" done | readonly ${HOME} "$1" local && | "$@" readonly grep test grep
+local --verbose then echo 'quoted text' done cd test ${HOME} --verbose
+		awk --verbose then printf local
+		echo test $(pwd) grep cd --verbose 2>/dev/null printf /usr/bin test
+-eu sed export sed grep sed sed
+		awk -eu x=1 local /usr/bin echo | readonly test
+"$@" then "$1" readonly done
+		export sed -eu readonly readonly cd x=1 then done --verbose ${HOME} done /usr/bin
+		cd ${HOME} x=1 grep x=1 export readonly echo x=1 2>/dev/null "$1" -eu test
+$(pwd) ${HOME} "$1" /usr/bin /usr/bin 'quoted text'
+		'quoted text' 'quoted text' -eu 'quoted text' 'quoted text' | 2>/dev/null
+	/usr/bin readonly | then done ${HOME} cd $(pwd)
+		then $(pwd) /usr/bin x=1
+		-eu && 'quoted text' 'quoted text' sed
+	/usr/bin ${HOME} readonly /usr/bin --verbose test $(pwd) sed test
+		2>/dev/null cd awk --verbose --verbose awk sed 2>/dev/null ${HOME} | test grep
+		-eu | readonly -eu then x=1 --verbose -eu then cd ${HOME} then ${HOME} sed grep
+"$1" -eu $(pwd) export
+then grep cd then && "$1" grep sed "$@" "$@" sed grep ${HOME} --verbose
+then done done "$@" sed -eu awk "$@"
+x=1 cd && && x=1 export awk "$@" export echo
+awk grep 'quoted text' export $(pwd) 'quoted text'
+"$1" done local test echo then then readonly echo | 'quoted text'
+then --verbose 'quoted text' then /usr/bin x=1 printf && x=1 sed test
+awk /usr/bin $(pwd) 2>/dev/null grep /usr/bin 2>/dev/null "$1" sed
+	sed 2>/dev/null test echo "$@" && printf done export -eu printf -eu
+x=1 printf "$1" x=1 "$1" x=1 echo --verbose export $(pwd) ${HOME}
+	readonly && done --verbose done
+x=1 && test x=1 export cd then $(pwd) 2>/dev/null
+printf grep cd export --verbose "$1" 2>/dev/null
+	${HOME} printf sed readonly sed && then 2>/dev/null done cd /usr/bin local readonly
+		printf $(pwd) printf sed test echo awk
+		export done "$@" -eu 'quoted text' export test
+	test "$@" sed cd test local grep x=1 -eu echo cd readonly $(pwd) 'quoted text'
+		/usr/bin export && 'quoted text' 2>/dev/null
+	done --verbose "$1" && ${HOME} 'quoted text' grep
+local | sed --verbose ${HOME} printf
+		export --verbose -eu export --verbose 'quoted text'
+export 'quoted text' then | test -eu
+awk ${HOME} ${HOME} 'quoted text'
+	export -eu printf done 'quoted text' $(pwd)
+	readonly --verbose export printf done && then &&
+"$@" export done done 2>/dev/null
+"$@" grep export awk readonly 2>/dev/null --verbose && /usr/bin awk --verbose
+	| --verbose "$@" "$@" sed 2>/dev/null 'quoted text' "$@" ${HOME} && sed export "$1"
+	"$1" sed test $(pwd) grep
+2>/dev/null | sed grep awk | | 'quoted text' sed readonly && local export
+readonly grep printf -eu done export /usr/bin grep -eu test -eu echo x=1
+echo --verbose $(pwd) 2>/dev/null "$1" $(pwd)
+	echo $(pwd) 2>/dev/null "$@" ${HOME}
+		cd cd printf /usr/bin 2>/dev/null "$@"
+		awk $(pwd) printf then test -eu then "$@" cd x=1
+		local $(pwd) cd /usr/bin local
+		awk local local sed readonly export done then echo && -eu cd ${HOME} local
+		${HOME} grep "$1" x=1 | awk x=1 done
+	then sed awk && awk --verbose -eu echo --verbose
+		local 'quoted text' | done local sed sed then 2>/dev/null "$@"
+	printf "$1" readonly cd && | && ${HOME}
+	&& printf export -eu done export
+'quoted text' export cd x=1 /usr/bin ${HOME} grep cd then cd
+&& | x=1 then printf ${HOME} $(pwd) 'quoted text' sed 2>/dev/null then export
+"$@" | awk /usr/bin "$1" 'quoted text' then -eu grep "$1" echo then printf
+		export 'quoted text' /usr/bin
+"$1" && $(pwd) sed local test 2>/dev/null
+awk && test $(pwd) ${HOME} -eu awk $(pwd) sed &&
+		x=1 echo echo | $(pwd) -eu 'quoted text' ${HOME} ${HOME}
+	--verbose echo local export readonly grep test && readonly
+		readonly awk --verbose then "$1" | 'quoted text' -eu ${HOME}
+		sed -eu awk x=1 "$1" /usr/bin /usr/bin grep readonly
+export awk 2>/dev/null | && readonly | "$@" 'quoted text' 2>/dev/null
+	| "$@" && x=1 "$1" done $(pwd) "$@" readonly awk printf readonly
+	--verbose test local ${HOME} x=1 "$@" && readonly 'quoted text'
+	export 'quoted text' sed "$1" cd test && "$@" export then readonly grep
+"$@" printf -eu ${HOME} local awk | then | export then --verbose "$@" awk grep
+cd readonly 'quoted text' 'quoted text'
+	x=1 done 'quoted text' echo test test
+grep echo readonly /usr/bin
+	&& grep "$@" grep /usr/bin awk
+&& x=1 printf "$1" then "$@" test grep done 'quoted text' cd 'quoted text'
+		done x=1 | && printf readonly "$1" | "$1" 'quoted text' printf
+		"$1" "$@" done "$1" then x=1 readonly "$1" --verbose && printf cd done local
+		printf | 2>/dev/null 'quoted text' --verbose readonly echo x=1 cd && then
+grep grep 2>/dev/null test && 2>/dev/null "$@" cd echo
+local 2>/dev/null && $(pwd) $(pwd) cd 'quoted text' local 'quoted text'
+/usr/bin grep cd done "$@" | grep cd | 2>/dev/null done x=1 'quoted text'
+	x=1 cd "$@" "$@" 2>/dev/null
+	'quoted text' | /usr/bin test $(pwd) local /usr/bin | then awk 'quoted text'
+		x=1 local x=1 echo grep -eu $(pwd) echo && readonly --verbose -eu "$1"
+sed awk "$@" local awk | printf --verbose ${HOME} ${HOME} x=1 export
+/usr/bin ${HOME} | "$@" readonly done
+--verbose printf 2>/dev/null echo test --verbose done export
+		sed cd local && --verbose x=1
+	-eu export && ${HOME} sed /usr/bin sed then ${HOME} cd readonly echo
+		done local && x=1 -eu readonly
+		'quoted text' 2>/dev/null echo done 'quoted text' --verbose local local
+done printf then $(pwd) x=1 'quoted text' grep grep 'quoted text'
+		local local 2>/dev/null grep local $(pwd) && | -eu grep "$@" export --verbose
+		awk echo x=1 "$1" sed printf local
+echo sed cd | local $(pwd) 2>/dev/null readonly $(pwd) 'quoted text'
+	sed | /usr/bin | 'quoted text' 2>/dev/null --verbose ${HOME}
+	grep | 'quoted text' "$@" | $(pwd) export
+		readonly /usr/bin readonly
+	then readonly export "$1" "$@"
+&& done /usr/bin $(pwd) --verbose
+		printf -eu "$1" /usr/bin x=1 readonly export
+x=1 'quoted text' 2>/dev/null
+		local sed "$1" $(pwd) 'quoted text' 2>/dev/null then -eu | export awk "$1" x=1
+		test ${HOME} "$1" 2>/dev/null "$1"
+--verbose ${HOME} readonly awk awk cd then awk
+		done | export "$1" export && "$1" local 'quoted text'
+sed cd ${HOME} -eu echo export cd --verbose "$@" -eu $(pwd) local
+echo awk "$1" && grep sed && 'quoted text' x=1
+printf printf printf $(pwd)
+${HOME} "$1" echo awk $(pwd) export echo $(pwd) printf export /usr/bin x=1 2>/dev/null
+		x=1 && $(pwd) echo echo local
+		cd "$@" done printf cd /usr/bin 'quoted text' $(pwd) done export awk "$1" done
+		x=1 /usr/bin $(pwd) test export 2>/dev/null 2>/dev/null 2>/dev/null
+		sed "$@" grep | test done grep printf local "$1" 2>/dev/null
+	sed "$@" x=1 'quoted text' printf awk 2>/dev/null export grep
+		$(pwd) -eu --verbose -eu 'quoted text' 'quoted text' grep
+		'quoted text' done "$@" echo local 2>/dev/null
+		$(pwd) "$@" ${HOME} --verbose
+		readonly readonly 2>/dev/null /usr/bin
+	"$1" --verbose test grep
+		then /usr/bin && | printf /usr/bin readonly
+		local echo 'quoted text' readonly | printf /usr/bin
+	readonly "$@" cd local $(pwd) "$@"
+		$(pwd) local $(pwd) sed readonly "$1" 'quoted text'
+	grep $(pwd) test "$1"
+		/usr/bin done export -eu then | "$1" cd export 'quoted text'
+export cd -eu x=1 && --verbose local ${HOME} awk
+"$1" 'quoted text' test -eu grep
+	sed echo local sed grep done ${HOME} x=1 export ${HOME} awk /usr/bin test
+/usr/bin x=1 readonly 'quoted text' 2>/dev/null
+		printf --verbose cd /usr/bin | ${HOME} 'quoted text' x=1 "$@" 2>/dev/null
+local 'quoted text' printf local "$@" | cd cd readonly printf echo 2>/dev/null
+	printf echo readonly grep $(pwd) "$1" 'quoted text' --verbose
+	| then x=1 'quoted text' --verbose && test then | x=1
+		"$1" export "$1" local ${HOME} local /usr/bin cd export
+-eu grep done && readonly "$@" grep && -eu export ${HOME}
+sed x=1 local -eu done export 'quoted text' awk done x=1 x=1 'quoted text' grep
+		export then readonly && cd awk
+sed cd export | -eu &&
+	2>/dev/null readonly && "$1" then "$@" "$@" cd awk --verbose sed export ${HOME}
+printf cd 'quoted text' readonly cd 'quoted text'
+	x=1 done test printf printf
+	cd cd readonly awk /usr/bin
+		test done grep 'quoted text' echo readonly 2>/dev/null echo && 'quoted text'
+	| -eu $(pwd) awk printf awk "$@" && "$@" cd readonly x=1 --verbose
+then 'quoted text' -eu 'quoted text' 2>/dev/null
+printf && test 'quoted text' sed "$1" test
+	readonly sed awk x=1 cd local -eu sed readonly
+"$@" awk grep "$@" readonly cd sed 'quoted text' local awk 2>/dev/null done
+		readonly "$@" 'quoted text' "$1" test x=1 echo done 'quoted text'
+	awk "$@" echo 2>/dev/null
+2>/dev/null "$@" grep 2>/dev/null "$@" $(pwd) awk -eu done test
+awk export echo "$1" ${HOME} done $(pwd) echo local && test then && cd "$1"
+	x=1 "$1" readonly test test x=1 sed -eu x=1 "$@" 'quoted text' echo -eu
+2>/dev/null $(pwd) x=1 sed | then | ${HOME} grep export awk grep
+	awk printf -eu "$@" && 'quoted text' export grep done --verbose
+	test 2>/dev/null | grep
+	$(pwd) && done x=1 | x=1 ${HOME}
+'quoted text' grep cd 2>/dev/null readonly echo
+		| ${HOME} printf 2>/dev/null readonly | test printf $(pwd) -eu | export
+	"$1" done --verbose --verbose --verbose --verbose && then
+		then cd then echo local then x=1 2>/dev/null -eu sed x=1 awk ${HOME}
+local --verbose cd echo 2>/dev/null
+	printf /usr/bin -eu "$1" $(pwd) /usr/bin then
+	'quoted text' -eu echo ${HOME}
+		awk grep | x=1 test x=1
+	'quoted text' echo -eu $(pwd) ${HOME}
+then local done readonly test printf awk
+	readonly | "$@" "$1" export printf
+	grep done --verbose readonly && "$@" ${HOME} local cd /usr/bin && printf awk printf
+${HOME} readonly echo local echo x=1 readonly $(pwd) && done /usr/bin x=1 printf
+	cd -eu 2>/dev/null -eu echo && awk
+	local readonly done readonly
+	printf sed local | x=1 2>/dev/null 'quoted text'
+'quoted text' | x=1 'quoted text' |
+sed 2>/dev/null --verbose 2>/dev/null | ${HOME} export export
+grep -eu sed | /usr/bin done 2>/dev/null "$1" "$1" 'quoted text' x=1 then awk
+	export awk echo 'quoted text' -eu grep awk done local "$@" "$@" printf sed grep
+		x=1 --verbose test "$@" "$@"
+		readonly sed cd printf echo done $(pwd) --verbose cd
+	local local sed echo readonly "$@" printf ${HOME} "$1"
+x=1 "$1" 2>/dev/null local ${HOME} /usr/bin local done
+"$@" --verbose "$@" readonly local x=1 $(pwd) --verbose echo
+export done $(pwd) done "$@" "$1"
+	test /usr/bin | | readonly | --verbose printf awk
+"$1" "$@" local cd -eu 2>/dev/null export /usr/bin
+		${HOME} sed && grep x=1 then
+	&& sed $(pwd) echo cd then printf x=1 'quoted text' $(pwd) "$@"
+export awk -eu grep sed
+x=1 export | done then "$@" 2>/dev/null
+	cd x=1 -eu printf local "$@"
+'quoted text' /usr/bin -eu /usr/bin
+$(pwd) 'quoted text' | 2>/dev/null
+	"$1" export printf local awk sed --verbose x=1
+		awk echo -eu echo --verbose awk $(pwd) "$@" test --verbose
+		'quoted text' 2>/dev/null done done
+	&& x=1 x=1 export cd -eu readonly cd readonly local cd -eu test awk 2>/dev/null
+	"$@" x=1 'quoted text' sed local local export ${HOME} local "$@" --verbose &&
+	printf "$1" done sed 'quoted text' export "$@" then awk grep "$@" | x=1
+		awk then "$@" then | 2>/dev/null --verbose printf "$@"
+		2>/dev/null 2>/dev/null grep $(pwd)
+		--verbose sed | "$@" sed done ${HOME} test sed "$@" export printf && $(pwd) readonly
+		2>/dev/null sed /usr/bin then x=1 "$1" test | $(pwd) "$@" printf test "$1"
+	done awk then "$1" "$1" echo 'quoted text' --verbose awk test -eu ${HOME}
+		echo readonly $(pwd) echo echo && && "$@" x=1 sed $(pwd) then "$1"
+		x=1 $(pwd) grep "$1" test
+		--verbose local 'quoted text' echo done echo sed local sed
+printf cd "$1" then local then 'quoted text' "$@" "$@"
+	export "$@" 2>/dev/null cd local
+&& | ${HOME} printf 2>/dev/null echo sed echo 'quoted text'
+		local export 'quoted text' cd readonly "$@" cd -eu grep --verbose echo done && &&
+printf sed -eu | export 'quoted text' "$1" sed -eu cd done $(pwd)
+/usr/bin -eu | done 'quoted text' done test cd | done grep sed $(pwd) test
+	$(pwd) /usr/bin $(pwd) "$1"
+	$(pwd) x=1 test done 'quoted text' export printf 'quoted text' readonly cd cd
+	/usr/bin ${HOME} then "$@" cd grep "$@" "$@" local "$@" export
+'quoted text' 'quoted text' 'quoted text'
+		"$@" 'quoted text' done /usr/bin echo x=1 x=1 done printf
+	printf $(pwd) readonly x=1 && 'quoted text' awk "$1" awk "$@" && --verbose cd
+		readonly grep printf cd ${HOME} /usr/bin 2>/dev/null grep cd
+		export ${HOME} /usr/bin printf 2>/dev/null export /usr/bin 'quoted text'
+readonly $(pwd) grep --verbose /usr/bin
+export | export $(pwd) 2>/dev/null | ${HOME}
+awk printf sed awk 'quoted text'
+	test && awk sed | "$@" echo "$@" && printf then x=1 grep --verbose
+	x=1 cd /usr/bin && awk
+		readonly "$1" x=1 done 2>/dev/null printf && ${HOME}
+	done then "$1" readonly
+awk readonly awk local 2>/dev/null
+	then "$@" export && echo local readonly grep local printf echo -eu then readonly
+x=1 -eu | export test readonly --verbose local test | grep export &&
+	&& local 2>/dev/null local local then --verbose "$1" sed local readonly
+local export grep awk local && echo /usr/bin local
+		test | 'quoted text' export sed awk "$@" x=1 2>/dev/null -eu echo
+		'quoted text' "$1" test $(pwd) 'quoted text'
+		"$1" cd done then export local x=1 sed readonly printf
+	--verbose --verbose awk then $(pwd) sed export
+		| ${HOME} 2>/dev/null --verbose done
+	awk done echo && export local && 'quoted text'
+"$@" local cd x=1 ${HOME} 2>/dev/null
+sed export local "$1" && export "$@" grep && x=1 local
+	'quoted text' /usr/bin && && ${HOME} export awk
+2>/dev/null grep 'quoted text' export x=1 printf
+		${HOME} "$@" | awk local
+	cd "$1" printf && sed 2>/dev/null done awk
+	grep sed --verbose | test -eu 'quoted text' then "$1" /usr/bin
+	done export "$@" grep done 'quoted text' then
+	test 2>/dev/null 2>/dev/null cd local x=1 then
+printf "$1" "$1" readonly | done echo 'quoted text' 2>/dev/null -eu "$1" "$@" x=1
+		awk then && local "$@" readonly ${HOME} && "$1" printf "$1"
+		'quoted text' export readonly printf
+	local "$@" x=1 $(pwd) "$@" sed sed && -eu x=1 "$1" ${HOME}
+		${HOME} local sed "$@" 'quoted text'
+	sed | --verbose /usr/bin ${HOME} printf
+&& -eu test sed cd /usr/bin /usr/bin "$@"
+		"$@" 2>/dev/null x=1 test 2>/dev/null
+	grep readonly sed | | 'quoted text' 2>/dev/null 2>/dev/null cd && --verbose
+		echo -eu "$1" /usr/bin then "$1" x=1 readonly readonly export | echo then |
+	$(pwd) | 'quoted text' -eu printf $(pwd) "$@" --verbose
+		${HOME} -eu awk ${HOME} 'quoted text' x=1 ${HOME} test x=1 "$1"
+		| && local then printf done x=1 -eu 2>/dev/null
+		${HOME} sed readonly then
+		echo cd printf "$1" -eu -eu export | local /usr/bin grep printf test
+		--verbose 2>/dev/null echo $(pwd) $(pwd) && local then readonly awk echo
+		export "$1" local cd done local cd --verbose x=1 echo printf readonly
+	local cd awk readonly --verbose 2>/dev/null local then printf | echo
+	/usr/bin cd echo echo local /usr/bin x=1
+	x=1 $(pwd) && "$1" 2>/dev/null awk "$1" then $(pwd)
+	printf readonly | echo printf "$1" done export && then "$1"
+done export 'quoted text' local "$1"
+	-eu echo local /usr/bin -eu local done 2>/dev/null
+	'quoted text' "$1" echo readonly test
+	export printf test ${HOME} grep $(pwd)
+awk export awk printf grep
+		awk echo test readonly /usr/bin readonly
+		local printf "$1" ${HOME} done cd "$@" awk && readonly test 2>/dev/null
+	export echo local export "$@"
+/usr/bin export "$@" grep 'quoted text' 2>/dev/null
+-eu ${HOME} grep readonly --verbose ${HOME} then echo && echo
+		then grep ${HOME} sed cd | awk done awk grep
+grep then "$@" awk /usr/bin then then cd cd -eu -eu ${HOME}
+export | echo done cd
+echo then grep && "$@" --verbose local 2>/dev/null printf ${HOME} export
+		readonly /usr/bin export done "$@" 2>/dev/null grep readonly | "$@" grep printf
+"$@" -eu export -eu echo $(pwd) 'quoted text' readonly test $(pwd) 'quoted text'
+--verbose $(pwd) awk "$@" -eu test done echo -eu | 2>/dev/null then export
+x=1 2>/dev/null --verbose test export | --verbose 2>/dev/null
+		'quoted text' x=1 "$@" local grep "$1" $(pwd) 'quoted text'
+		${HOME} ${HOME} x=1 'quoted text' 'quoted text'
+	grep "$@" export | 'quoted text' sed done && done && echo echo grep
+	done then "$@" readonly "$@" done readonly awk
+		local done "$@" then /usr/bin cd -eu readonly grep
+	| && sed echo "$1" echo export done printf "$@" 2>/dev/null "$1" echo | $(pwd) "$@"
+'quoted text' echo awk && /usr/bin echo cd test readonly export --verbose
+		"$@" cd printf 2>/dev/null cd sed 2>/dev/null /usr/bin "$@" --verbose
+then awk printf local readonly awk --verbose --verbose
+		sed "$@" -eu test printf awk test --verbose 'quoted text'
+		readonly cd local awk -eu "$1" echo $(pwd) awk
+--verbose x=1 && echo 2>/dev/null then grep
+	2>/dev/null 2>/dev/null cd done && printf
+		grep -eu then ${HOME} /usr/bin ${HOME} | | export --verbose
+	then printf | test -eu done export echo ${HOME} 2>/dev/null $(pwd) sed $(pwd)
+awk local done && /usr/bin "$1" printf -eu cd
+readonly 'quoted text' | cd awk -eu
+printf ${HOME} local --verbose /usr/bin readonly $(pwd) export
+/usr/bin done -eu grep cd ${HOME} $(pwd) | "$@" then printf cd printf
+		grep local local then 'quoted text' | --verbose grep ${HOME} sed "$1" ${HOME} local
+		"$1" ${HOME} x=1 done && | --verbose x=1 --verbose test --verbose -eu readonly
+test awk -eu local sed cd done
+| done 'quoted text' cd && 2>/dev/null && awk
+		local readonly test grep --verbose --verbose export "$1" 2>/dev/null
+	-eu /usr/bin | test 2>/dev/null then echo
+	grep printf printf 'quoted text' sed 'quoted text'
+		| && sed | grep $(pwd)
+		awk --verbose x=1 x=1 printf && awk /usr/bin ${HOME}
+		test 'quoted text' echo grep readonly && | done awk x=1
+		| printf 'quoted text' done export -eu sed --verbose x=1 -eu
+awk echo | export test readonly 2>/dev/null test /usr/bin
+	&& readonly 'quoted text' -eu done export cd && --verbose "$@" && test 'quoted text'
+	cd x=1 --verbose 2>/dev/null "$1" sed awk then "$@" cd 'quoted text'
+"$1" "$@" test "$@" /usr/bin && cd grep local awk export -eu $(pwd) --verbose
+		${HOME} "$@" ${HOME} 2>/dev/null grep x=1 $(pwd) printf done 2>/dev/null
+	'quoted text' then "$1" then test $(pwd) 'quoted text' cd cd x=1 awk cd
+	/usr/bin 'quoted text' export "$1" | "$@" printf
+	printf --verbose test local
+printf x=1 then awk &&
+--verbose sed -eu echo
+echo --verbose "$@" test awk export awk done grep
+| -eu export awk local export
+	done echo "$@" 'quoted text' awk test --verbose
+	test sed local local 'quoted text' readonly x=1 && "$1" 'quoted text' local 2>/dev/null
+&& 'quoted text' awk grep $(pwd) grep printf
+		"$@" -eu sed then $(pwd) $(pwd) done
+	test sed $(pwd) test grep "$@" awk then
+x=1 awk ${HOME} && $(pwd)
+	"$1" 'quoted text' 2>/dev/null
+	"$@" done --verbose $(pwd) "$1" test | "$@" done 2>/dev/null --verbose
+	"$@" "$@" local done cd printf
+	cd 'quoted text' ${HOME} then cd ${HOME} -eu done echo --verbose
+	'quoted text' 2>/dev/null local sed grep | then ${HOME} echo 2>/dev/null
+	test "$1" 2>/dev/null --verbose 2>/dev/null
+		echo test | local && then cd 'quoted text'
+	"$@" test && -eu "$@" test test "$@"
+echo 2>/dev/null --verbose "$@" grep cd && readonly $(pwd) | -eu done readonly
+awk --verbose printf local test
+		echo test /usr/bin && grep "$@" local echo /usr/bin then echo -eu --verbose local
+&& echo x=1 readonly grep readonly
+x=1 x=1 2>/dev/null /usr/bin export then /usr/bin $(pwd) -eu done
+local --verbose | then --verbose -eu done && x=1 ${HOME} "$1" export
+test 2>/dev/null echo | /usr/bin "$1" /usr/bin
+	test sed "$@" printf sed 2>/dev/null | printf echo then
+		x=1 grep 2>/dev/null /usr/bin test | $(pwd) printf --verbose
+	echo x=1 x=1 ${HOME} local "$1" sed printf grep
+		test -eu && && echo 2>/dev/null echo cd $(pwd) done --verbose
+	'quoted text' $(pwd) done 'quoted text' --verbose local echo && -eu $(pwd)
+		test -eu && grep | -eu 2>/dev/null
+sed 2>/dev/null x=1 sed 2>/dev/null 2>/dev/null "$@" -eu "$@" then
+		done cd sed test then readonly awk x=1 "$@"
+	/usr/bin sed cd echo | "$1"
+'quoted text' --verbose readonly | /usr/bin done echo "$@"
+echo echo readonly local 2>/dev/null echo
+	&& --verbose awk "$@" export -eu sed /usr/bin
+printf "$1" ${HOME} ${HOME} grep printf 'quoted text' /usr/bin --verbose sed
+sed then --verbose "$@" -eu
+	"$@" x=1 test $(pwd) --verbose -eu readonly -eu /usr/bin
+${HOME} sed | then done cd "$1" x=1 /usr/bin echo awk && local printf &&
+done done printf awk "$@" x=1 2>/dev/null x=1 cd /usr/bin grep "$@" cd ${HOME}
+	cd /usr/bin "$@" readonly test cd 'quoted text'
+'quoted text' ${HOME} "$@" grep | printf && done printf
+done x=1 /usr/bin local cd then cd "$@" sed test
+		"$@" printf "$1" export $(pwd)
+		grep /usr/bin | "$1" printf && sed grep 'quoted text' export
+	sed "$1" && | x=1 awk 2>/dev/null echo grep test --verbose
+&& sed --verbose sed export ${HOME} test
+		sed x=1 test 2>/dev/null 'quoted text' --verbose
+	printf then awk 'quoted text'
+	done test export done && ${HOME} | sed export && done /usr/bin && x=1
+	then done 2>/dev/null && grep test /usr/bin "$@" printf "$1" 2>/dev/null "$1" cd
+		&& "$1" "$1" printf awk export readonly then export --verbose
+"$1" 'quoted text' | -eu "$1" x=1 2>/dev/null printf
+awk test sed $(pwd) cd echo grep sed 'quoted text' && --verbose readonly
+x=1 2>/dev/null ${HOME} printf export x=1 "$1" export
+		-eu then $(pwd) test
+		sed ${HOME} | awk printf
+	awk "$@" $(pwd) export "$@" cd local
+x=1 then | test local sed printf
+		then && "$1" ${HOME} local
+	x=1 "$1" 2>/dev/null test sed echo then
+	"$@" then 2>/dev/null -eu --verbose &&
+grep sed "$@" "$1" printf 2>/dev/null
+x=1 | "$@" && -eu /usr/bin && x=1 sed "$@" test local cd && "$1"
+	cd $(pwd) -eu -eu ${HOME} ${HOME} awk 'quoted text' $(pwd) then -eu echo
+then | -eu ${HOME} cd
+	/usr/bin local -eu grep local "$@" /usr/bin
+/usr/bin x=1 sed then sed
+		cd x=1 then 2>/dev/null | test 'quoted text' readonly
+awk /usr/bin test grep 'quoted text' --verbose | then export readonly printf cd
+		/usr/bin sed $(pwd) cd -eu sed cd ${HOME} local done && test export
+'quoted text' readonly sed awk "$@" export --verbose local
+		export local printf echo "$1" "$@" printf ${HOME}
+echo cd echo printf && $(pwd) --verbose sed printf ${HOME} 'quoted text' sed -eu
+		${HOME} done cd $(pwd) 2>/dev/null readonly
+test -eu && local done awk
+awk awk --verbose test test readonly done
+	x=1 ${HOME} done test x=1 cd printf done export printf
+		test x=1 cd /usr/bin --verbose x=1 local
+done | readonly test && done "$@"
+	$(pwd) cd readonly --verbose echo /usr/bin awk "$1"
+	then | readonly -eu "$@" printf done $(pwd) echo
+		x=1 "$@" 2>/dev/null | cd export | 2>/dev/null "$1" test
+2>/dev/null $(pwd) export && awk export cd -eu "$@" awk "$1"
+local echo 2>/dev/null cd cd "$1"
+"$1" printf | "$1" /usr/bin "$1" awk cd awk -eu then "$@" cd | local echo x=1
+	'quoted text' "$@" readonly local -eu &&
+		cd $(pwd) && $(pwd) test sed readonly done |
+		local cd -eu | x=1 readonly
+		"$1" cd then readonly
+	cd echo local readonly -eu done && | --verbose
+		$(pwd) | ${HOME} local /usr/bin
+		grep ${HOME} $(pwd) ${HOME} awk echo && -eu then test
+grep $(pwd) export $(pwd) 2>/dev/null done readonly | then --verbose
+"$1" cd ${HOME} 'quoted text' printf test then -eu cd && then
+	printf echo then 2>/dev/null --verbose -eu grep x=1 ${HOME} ${HOME} sed 'quoted text'
+	cd readonly $(pwd) -eu | -eu | awk && sed -eu grep
+readonly test printf cd ${HOME} local | awk grep -eu --verbose awk sed ${HOME}
+'quoted text' local grep | echo export sed --verbose x=1
+x=1 'quoted text' --verbose
+	grep awk then 'quoted text' local echo /usr/bin done x=1 then
+	cd -eu "$@" awk done grep | "$1" "$@"
+		export export | "$1" 'quoted text' /usr/bin
+printf cd then x=1 done ${HOME} -eu --verbose "$@" grep 'quoted text'
+	cd | export then 'quoted text'
+x=1 x=1 test "$1" x=1 printf ${HOME} then test
+2>/dev/null then /usr/bin && "$1" printf ${HOME} sed && grep 2>/dev/null
+printf "$1" awk $(pwd) cd awk -eu "$1" grep "$@" -eu "$@"
+		$(pwd) awk -eu export --verbose awk printf export && x=1
+		test 2>/dev/null test export x=1 x=1 awk echo export ${HOME} && printf
+readonly cd 2>/dev/null "$1" && ${HOME} sed -eu "$1" ${HOME} test local sed cd
+		/usr/bin x=1 && ${HOME} "$@"
+		x=1 && test /usr/bin "$@" "$1" export
+		/usr/bin export test echo grep export test echo && done $(pwd)
+	then -eu $(pwd) printf --verbose then "$@" ${HOME}
+	-eu printf $(pwd) then local 'quoted text'
+		/usr/bin 2>/dev/null | $(pwd) awk echo
+	sed /usr/bin 'quoted text' printf readonly printf ${HOME} x=1
+test grep then awk printf done "$@" readonly $(pwd)
+		test cd /usr/bin "$@" readonly /usr/bin
+/usr/bin -eu awk /usr/bin done /usr/bin grep test 'quoted text' ${HOME} /usr/bin
+		/usr/bin 2>/dev/null local && cd
+	done && test $(pwd) awk 'quoted text' test
+	sed $(pwd) then grep test 2>/dev/null cd printf export
+	grep sed x=1 -eu echo ${HOME} local && $(pwd) $(pwd) | echo readonly
+	sed sed grep local printf 2>/dev/null 2>/dev/null "$@"
+		'quoted text' 'quoted text' ${HOME} cd ${HOME} --verbose test /usr/bin 'quoted text'
+		done grep -eu echo ${HOME} readonly test
+then cd cd export /usr/bin
+done cd /usr/bin && x=1 export /usr/bin && 2>/dev/null echo --verbose
+	${HOME} 2>/dev/null && local sed /usr/bin /usr/bin ${HOME} x=1 | $(pwd) "$@"
+	cd "$1" done --verbose $(pwd)
+	grep 2>/dev/null done local echo
+		awk echo | cd 2>/dev/null 2>/dev/null
+'quoted text' grep test "$@" readonly 2>/dev/null
+		/usr/bin -eu awk $(pwd)
+		readonly x=1 grep test x=1 grep x=1 test x=1 'quoted text'
+	x=1 x=1 then x=1 export sed x=1 readonly 'quoted text' --verbose done | 'quoted text'
+		export test grep export
+	2>/dev/null /usr/bin "$1" then 2>/dev/null 2>/dev/null cd "$@"
+	test $(pwd) x=1 sed /usr/bin echo local then "$1" done done ${HOME}
+-eu awk printf local test $(pwd) -eu local cd $(pwd) awk readonly
+'quoted text' 'quoted text' "$@" &&
+done ${HOME} x=1 2>/dev/null then "$1" local
+		export cd done printf
+export grep | "$1" printf
+		sed printf printf 2>/dev/null && 2>/dev/null awk then awk sed
+cd cd readonly sed printf -eu --verbose readonly awk readonly sed test 2>/dev/null
+		then 'quoted text' export local "$1" /usr/bin -eu /usr/bin export &&
+		${HOME} test then cd $(pwd) sed x=1 2>/dev/null
+	2>/dev/null grep then local
+${HOME} echo done x=1 grep ${HOME} cd grep awk
+2>/dev/null ${HOME} 2>/dev/null /usr/bin --verbose /usr/bin
+		cd | then done then x=1 2>/dev/null "$1" readonly sed export
+		/usr/bin /usr/bin local "$1" grep /usr/bin ${HOME}
+		&& $(pwd) sed "$1" done printf x=1 /usr/bin printf 'quoted text'
+cd local -eu printf /usr/bin "$1" grep 'quoted text' 'quoted text'
+		cd readonly cd 2>/dev/null /usr/bin x=1
+/usr/bin && | ${HOME} 'quoted text' export 'quoted text' sed 'quoted text'
+	'quoted text' echo -eu 'quoted text'
+	awk | "$1" "$1" | 2>/dev/null local
+		echo readonly "$1" sed 2>/dev/null /usr/bin readonly test && 2>/dev/null $(pwd)
+/usr/bin echo ${HOME} --verbose
+	echo --verbose local --verbose
+	&& export "$1" && 'quoted text' export cd test ${HOME}
+		grep cd test ${HOME} /usr/bin grep
+		&& sed export | "$1" --verbose
+		x=1 local 'quoted text' export
+done 2>/dev/null local 2>/dev/null x=1 && $(pwd) export local echo
+		--verbose sed readonly
+		printf && printf x=1
+		2>/dev/null test && awk /usr/bin done ${HOME} done test awk ${HOME} 'quoted text'
+		then grep done 2>/dev/null echo "$1" x=1 readonly -eu "$1" x=1
+	cd printf "$@" readonly $(pwd) export 2>/dev/null done
+	/usr/bin echo done ${HOME} --verbose
+		"$1" --verbose sed $(pwd) then sed ${HOME} $(pwd) export x=1 awk /usr/bin ${HOME}
+		export awk sed test test 2>/dev/null "$1" /usr/bin
+		cd readonly 'quoted text' --verbose grep
+		"$1" awk --verbose 'quoted text'
+done "$@" cd grep -eu echo x=1
+		&& 2>/dev/null $(pwd) 'quoted text'
+2>/dev/null test echo done readonly echo test local && echo export
+		$(pwd) grep cd export awk local
+	echo awk 'quoted text' local x=1 ${HOME} && "$1" awk echo readonly local 2>/dev/null
+done export echo export --verbose ${HOME} "$1" cd then ${HOME} &&
+		then "$1" "$1" 'quoted text' echo "$@" cd done then then readonly --verbose
+	x=1 done --verbose ${HOME} 'quoted text' then echo local "$@" export cd
+&& cd "$1" printf x=1
+	echo --verbose sed && readonly local /usr/bin 'quoted text'
+		| 'quoted text' 'quoted text'
+| 2>/dev/null sed test echo grep "$1" ${HOME} grep then grep local readonly ${HOME}
+		${HOME} /usr/bin export ${HOME} export --verbose test export sed
+x=1 x=1 "$1" -eu local grep cd then
+readonly awk done ${HOME} 'quoted text' | && 2>/dev/null local
+	grep "$@" test 'quoted text' printf
+		printf ${HOME} printf | /usr/bin 2>/dev/null 2>/dev/null --verbose echo
+	&& /usr/bin cd ${HOME} printf done "$1"
+printf | then | grep grep
+	awk printf export then "$@" sed cd test "$@"
+	cd cd local $(pwd) x=1 "$@" 2>/dev/null echo printf
+	export 'quoted text' --verbose then grep sed x=1 --verbose && /usr/bin $(pwd)
+grep then local /usr/bin /usr/bin -eu awk -eu readonly "$1" x=1 cd sed x=1
+	x=1 cd printf cd -eu cd ${HOME} x=1 grep -eu && export test | awk local
+		"$1" "$1" printf -eu "$@" | local grep awk && 2>/dev/null ${HOME} then | cd /usr/bin
+		-eu /usr/bin | ${HOME} printf readonly test && | ${HOME} x=1 2>/dev/null
+		$(pwd) cd "$1" | -eu 'quoted text' export
+sed && cd printf test export ${HOME} readonly echo x=1 -eu ${HOME}
+	then readonly test sed 2>/dev/null export $(pwd) x=1 echo "$@" local |
+	${HOME} 2>/dev/null x=1 export export done -eu echo "$@" 2>/dev/null test
+	readonly local 'quoted text' awk "$@" | && &&
+sed awk then local && readonly cd /usr/bin
+	grep -eu printf "$@" echo /usr/bin
+	$(pwd) | cd grep cd $(pwd) | grep then test $(pwd) test /usr/bin /usr/bin echo
+$(pwd) sed x=1 sed x=1 readonly $(pwd) awk -eu
+then "$@" then cd sed export /usr/bin -eu then grep "$@" readonly
+		printf --verbose local then | local readonly echo ${HOME} x=1
+done -eu cd echo local --verbose $(pwd) sed export echo then -eu readonly
+	x=1 sed then grep "$@" printf local $(pwd) test test $(pwd) cd
+| "$1" test x=1 cd /usr/bin |
+	printf then 2>/dev/null readonly awk &&
+	test done done local x=1 export --verbose &&
+	--verbose test readonly then export |
+		x=1 local echo done /usr/bin -eu "$1" then ${HOME}
+	sed ${HOME} done cd --verbose grep /usr/bin
+	export /usr/bin export echo sed
+		$(pwd) $(pwd) awk --verbose
+		/usr/bin 'quoted text' echo x=1 && done $(pwd) local grep echo printf cd sed then
+sed printf "$1" local "$1" local -eu && 'quoted text'
+	readonly done readonly /usr/bin export "$@" ${HOME} "$@" -eu "$1" ${HOME} readonly
+		local ${HOME} "$1" 2>/dev/null
+		sed export grep printf 'quoted text'
+	echo "$@" | local $(pwd) local 'quoted text'
+	local "$1" printf done x=1 --verbose 2>/dev/null x=1 "$1" 'quoted text' local
+	test $(pwd) sed /usr/bin --verbose cd awk
+test "$@" /usr/bin echo readonly ${HOME} ${HOME} then && --verbose
+		then echo awk 'quoted text' -eu $(pwd) 'quoted text'
+test 'quoted text' local
+	"$1" sed echo then grep | -eu | /usr/bin | done local 'quoted text'
+	sed ${HOME} done local "$@" done grep awk ${HOME} sed -eu "$1" &&
+&& awk local "$1" export x=1 awk -eu /usr/bin grep
+		-eu printf sed printf cd ${HOME}
+then printf done | cd $(pwd) ${HOME} 'quoted text'
+		/usr/bin grep grep "$@" echo echo /usr/bin echo
+'quoted text' printf --verbose |
+	"$1" export cd "$@" -eu cd 2>/dev/null "$1" /usr/bin
+		| cd x=1 done "$1" sed $(pwd) printf | sed /usr/bin | awk then readonly printf
+'quoted text' x=1 then "$@" --verbose
+		awk then "$@" then "$@" --verbose x=1 cd echo -eu --verbose "$1" cd
+		echo awk cd sed echo 2>/dev/null then 'quoted text' && readonly
+		echo x=1 then 2>/dev/null --verbose export done x=1 sed readonly
+		local 'quoted text' x=1 $(pwd) readonly
+readonly -eu echo readonly 'quoted text' "$1" --verbose cd "$1"
+	awk printf 2>/dev/null 2>/dev/null 2>/dev/null "$@"
+		'quoted text' export /usr/bin $(pwd) awk
+	--verbose cd cd 2>/dev/null --verbose readonly local ${HOME}
+	/usr/bin "$1" sed cd readonly
+		"$@" done local printf 'quoted text' readonly
+$(pwd) | | x=1 sed | x=1 test readonly 2>/dev/null readonly cd awk "$1"
+		done test 'quoted text' $(pwd) | "$1" && x=1 'quoted text'
+		$(pwd) sed 'quoted text'
+		/usr/bin && then readonly grep
+"$1" readonly --verbose -eu export readonly --verbose 2>/dev/null local done
+/usr/bin 2>/dev/null grep then test
+	2>/dev/null awk | "$@" "$@" awk x=1 test && done readonly
+cd ${HOME} | --verbose x=1 && cd awk then 2>/dev/null ${HOME} sed && $(pwd) test
+		| readonly 'quoted text' $(pwd) | export test $(pwd) echo $(pwd) /usr/bin test -eu
+		-eu local echo x=1 done 'quoted text' x=1 -eu local
+cd 'quoted text' test cd test
+		test done -eu ${HOME} /usr/bin echo 2>/dev/null export /usr/bin
+-eu echo /usr/bin x=1 sed /usr/bin | && -eu sed
+		/usr/bin x=1 2>/dev/null cd 2>/dev/null -eu sed cd
+		$(pwd) readonly cd "$1" "$1" grep export readonly 2>/dev/null "$1" export
+sed sed && 2>/dev/null done /usr/bin /usr/bin 'quoted text' readonly
+--verbose then echo ${HOME} local awk then $(pwd) readonly "$1" awk 2>/dev/null
+		local ${HOME} 'quoted text' "$@" export then "$1" -eu "$@"
+		readonly then local done 2>/dev/null echo readonly 'quoted text' 'quoted text'
+	/usr/bin echo sed "$1" cd | test test $(pwd) readonly
+		--verbose && ${HOME} /usr/bin
+		test grep readonly readonly |
+$(pwd) ${HOME} then printf cd $(pwd) readonly sed awk grep
+--verbose && test sed awk grep $(pwd)
+		/usr/bin test --verbose
+		cd && /usr/bin grep done -eu "$1" readonly echo 'quoted text'
+		$(pwd) awk test --verbose --verbose sed export
+printf echo -eu echo cd && done awk test && grep $(pwd) readonly &&
+printf awk done export readonly && -eu x=1
+	$(pwd) echo /usr/bin x=1 && done ${HOME}
+grep "$1" /usr/bin sed "$1" 2>/dev/null sed test
+readonly then --verbose sed sed
+		| ${HOME} sed cd $(pwd) grep ${HOME} readonly
+		--verbose then 2>/dev/null printf "$1" echo 2>/dev/null --verbose | then test
+		echo echo "$@" 'quoted text' 2>/dev/null 2>/dev/null printf readonly
+2>/dev/null && printf x=1 printf "$@" echo export && export echo
+	echo | awk sed awk ${HOME} "$1" then
+	echo test ${HOME} | --verbose printf test "$@" $(pwd) x=1
+	local export --verbose 'quoted text' grep test 2>/dev/null
+awk x=1 "$1" && sed x=1 grep x=1 echo grep 2>/dev/null printf export "$1"
+		"$1" done 2>/dev/null awk test $(pwd) 2>/dev/null
+	awk --verbose --verbose test cd awk --verbose "$@"
+		x=1 done echo && 2>/dev/null
+	-eu && test local printf $(pwd) export then "$@" 'quoted text'
+done local 2>/dev/null && "$@" grep 'quoted text' ${HOME} grep
+cd export test --verbose -eu $(pwd) && $(pwd)
+printf 2>/dev/null cd printf x=1 readonly echo && awk 2>/dev/null
+	test export done then export
+		sed ${HOME} x=1 local echo cd
+local cd 'quoted text' x=1 readonly
+		2>/dev/null "$@" --verbose 2>/dev/null ${HOME} echo
+		export /usr/bin /usr/bin test | && printf "$@" cd
+		x=1 -eu && | local local export grep awk local --verbose cd $(pwd)
+	local 2>/dev/null test "$1" awk 'quoted text' then export
+$(pwd) /usr/bin --verbose x=1 x=1 echo 'quoted text' && ${HOME}
+		| -eu -eu grep sed --verbose local
+	"$1" export export "$@" sed then done -eu &&
+	2>/dev/null awk grep local done && sed 2>/dev/null test x=1 /usr/bin
+		/usr/bin "$@" --verbose
+-eu done && 'quoted text' test grep "$1" readonly local done done echo
+		${HOME} sed -eu | 'quoted text' x=1 "$1" | awk
+		export sed | sed sed done && --verbose x=1
+${HOME} test ${HOME} readonly sed "$@" local
+		test x=1 printf && readonly readonly grep export | && done ${HOME}
+/usr/bin x=1 2>/dev/null 'quoted text' grep echo
+	${HOME} done -eu sed ${HOME} "$1" ${HOME} "$@" /usr/bin
+	$(pwd) "$@" | x=1 ${HOME} | 2>/dev/null /usr/bin
+then cd /usr/bin --verbose
+	export done $(pwd) test cd local export ${HOME} export $(pwd)
+export 2>/dev/null export "$1" "$@"
+	'quoted text' x=1 echo 'quoted text' 2>/dev/null local
+	&& echo echo test 2>/dev/null
+		x=1 done 'quoted text' $(pwd) && readonly "$@" grep 2>/dev/null ${HOME} printf
+	then echo export then done test sed "$1" /usr/bin printf --verbose awk grep awk
+	'quoted text' --verbose | "$1" cd grep 'quoted text'
+		readonly done 2>/dev/null echo then done | test /usr/bin
+echo grep 2>/dev/null then awk 'quoted text' local awk /usr/bin --verbose --verbose
+		grep | && done sed test --verbose echo awk 2>/dev/null sed 2>/dev/null
+		${HOME} grep && -eu | readonly
+test 2>/dev/null 'quoted text' echo local 2>/dev/null
+export x=1 "$1" -eu /usr/bin
+		cd readonly /usr/bin done ${HOME} 2>/dev/null done
+	cd local -eu $(pwd) test 'quoted text' -eu printf
+	"$@" x=1 'quoted text' "$@"
+&& export then cd "$1" done readonly -eu export
+		${HOME} printf "$@" then echo | -eu -eu /usr/bin test sed "$@" grep
+	cd $(pwd) "$1" x=1 "$1" echo --verbose printf sed
+		echo 2>/dev/null ${HOME} awk then ${HOME}
+		| done grep | /usr/bin sed && "$1" 'quoted text'
+	echo --verbose 'quoted text' test awk done /usr/bin
+	"$@" echo $(pwd) 2>/dev/null --verbose 'quoted text'
+		printf /usr/bin test | --verbose "$@" "$@" --verbose local -eu $(pwd) 'quoted text'
+	readonly done /usr/bin x=1 |
+	| readonly $(pwd) grep done then 'quoted text' printf cd sed local sed
+'quoted text' "$@" readonly awk awk test "$@" sed 'quoted text' echo cd local
+	grep local --verbose grep readonly
+		local sed awk | awk /usr/bin $(pwd) x=1 test then | --verbose local test
+$(pwd) 'quoted text' echo echo 'quoted text' cd grep x=1
+--verbose echo local "$@" -eu echo "$@" cd
+cd "$1" /usr/bin -eu then printf awk printf awk grep done "$@" 2>/dev/null
+test -eu test awk done 'quoted text' "$1" echo grep && ${HOME}
+	$(pwd) /usr/bin ${HOME} readonly $(pwd) $(pwd) --verbose | "$@"
+export test $(pwd) sed | $(pwd) 'quoted text' ${HOME} | "$1" done
+	'quoted text' --verbose $(pwd) /usr/bin echo | && printf printf | | 'quoted text'
+${HOME} done /usr/bin --verbose
+		then --verbose export "$1" $(pwd) x=1 x=1 sed readonly
+	then --verbose --verbose done test done $(pwd) test --verbose sed 2>/dev/null
+	sed -eu local then "$@" 2>/dev/null sed readonly -eu echo "$1"
+	"$@" awk awk 'quoted text' --verbose
+	x=1 /usr/bin "$@" printf "$@" -eu && grep x=1 $(pwd) --verbose 'quoted text' ${HOME}
+	&& 2>/dev/null /usr/bin --verbose $(pwd) 2>/dev/null
+-eu 'quoted text' test test && then sed grep grep sed "$1" x=1
+		export printf test export
+	"$1" readonly sed "$1"
+	2>/dev/null "$1" local sed sed local && && grep test x=1 export then readonly
+		-eu echo 2>/dev/null /usr/bin -eu ${HOME} grep && -eu
+-eu echo sed echo 'quoted text' test printf
+/usr/bin readonly readonly sed /usr/bin "$1" --verbose "$@" -eu export done
+cd readonly sed grep && test --verbose then
+	local $(pwd) -eu cd awk $(pwd) grep /usr/bin done export printf test printf -eu
+		2>/dev/null done readonly awk done
+		"$@" -eu export readonly printf sed readonly printf
+		$(pwd) --verbose x=1 readonly -eu $(pwd) done -eu echo $(pwd)
+	export | test test readonly sed 2>/dev/null ${HOME} readonly
+| -eu echo printf cd "$@" local 2>/dev/null
+		| cd then $(pwd) readonly then 2>/dev/null 2>/dev/null then -eu grep
+	export -eu | test 'quoted text'
+	awk cd "$@" printf 2>/dev/null 'quoted text' x=1 awk sed x=1
+		"$1" then cd echo then /usr/bin local --verbose ${HOME} | awk awk -eu
+cd export "$@" "$@" readonly /usr/bin sed
+		$(pwd) 2>/dev/null cd ${HOME} done $(pwd) "$1" -eu /usr/bin -eu 2>/dev/null printf
+${HOME} | test cd sed echo printf echo --verbose cd 2>/dev/null cd
+/usr/bin 'quoted text' 'quoted text' /usr/bin 2>/dev/null
+		${HOME} -eu /usr/bin readonly cd printf
+| grep awk 2>/dev/null x=1 grep sed 2>/dev/null --verbose readonly "$@"
+	-eu 2>/dev/null /usr/bin printf then && ${HOME} -eu cd echo
+export export awk -eu "$1" readonly
+x=1 | x=1 ${HOME} 'quoted text' $(pwd) readonly
+export && ${HOME} awk && ${HOME} --verbose done test then ${HOME} sed "$@"
+| echo sed then 'quoted text' readonly local awk
+	done echo && printf done x=1 echo && echo x=1 | export
+		then sed /usr/bin local export x=1 done printf export export x=1 -eu "$@"
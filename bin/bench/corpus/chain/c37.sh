@@ -0,0 +1,2001 @@
+		then then $(pwd) cd 2>/dev/null
+echo $(pwd) --verbose awk 2>/dev/null
+| "$1" $(pwd) ${HOME} test readonly export done ${HOME} --verbose
+	done sed printf then readonly then && sed printf -eu "$@" grep /usr/bin then $(pwd)
+		-eu readonly "$@" "$1" local "$1"
+then --verbose echo ${HOME} sed cd cd done | grep "$@" | echo && "$@"
+readonly local 2>/dev/null && cd | readonly printf readonly $(pwd) "$1"
+"$1" ${HOME} test echo | x=1 /usr/bin
+		test then readonly awk -eu -eu local export echo export echo export
+	then done 2>/dev/null 'quoted text' done /usr/bin grep 'quoted text' printf sed
+	done done local $(pwd) "$@" | done printf grep cd local then test && printf ${HOME}
+	printf local /usr/bin ${HOME} 2>/dev/null sed sed printf
+	&& /usr/bin printf sed && sed 'quoted text' | echo test
+x=1 done "$1" "$1" readonly -eu $(pwd) readonly --verbose
+	/usr/bin sed x=1 readonly | sed x=1 x=1 /usr/bin /usr/bin --verbose -eu readonly
+	--verbose echo cd printf local ${HOME} local done echo readonly ${HOME} x=1
+echo local test "$@" done sed "$1" ${HOME} done 'quoted text' | then printf
+	"$1" 2>/dev/null awk x=1 grep done test "$@" ${HOME} done test $(pwd) sed "$@"
+	awk 2>/dev/null -eu && "$@" ${HOME} export grep x=1 && | echo -eu x=1 test
+grep cd 2>/dev/null readonly 2>/dev/null 2>/dev/null
+	echo && then sed local /usr/bin && readonly $(pwd) -eu grep
+-eu echo ${HOME} export then done "$1" -eu 'quoted text' "$@" printf
+	2>/dev/null /usr/bin && test ${HOME} && sed $(pwd) readonly
+		x=1 -eu grep local --verbose
+	--verbose cd sed "$@" x=1 2>/dev/null $(pwd) grep cd
+	readonly then | ${HOME} ${HOME} local x=1 local -eu grep && test local
+	-eu cd --verbose ${HOME} ${HOME} grep export awk && export awk "$1"
+printf "$1" $(pwd) sed done test "$1" awk --verbose
+		x=1 'quoted text' printf 'quoted text' "$@" -eu echo done 'quoted text' | "$@"
+		sed 2>/dev/null "$1" "$@" grep x=1 ${HOME}
+		$(pwd) 2>/dev/null grep
+	--verbose --verbose grep "$1" echo readonly printf
+done export --verbose printf ${HOME} --verbose test 2>/dev/null grep then
+sed done then | $(pwd) grep 2>/dev/null "$@" echo -eu x=1 echo && 'quoted text'
+		awk | ${HOME} --verbose x=1
+printf ${HOME} $(pwd) 2>/dev/null local printf "$@"
+	export cd $(pwd) | then printf echo awk ${HOME} test then readonly
+		$(pwd) test "$@" -eu cd -eu test "$@" "$1" ${HOME} && && grep | done awk ${HOME}
+2>/dev/null | local cd printf && readonly printf
+		echo | 'quoted text' sed echo | sed done
+		$(pwd) x=1 export printf 2>/dev/null -eu --verbose
+		--verbose echo && done export printf then done ${HOME} && export
+test && $(pwd) printf local --verbose
+	readonly | 'quoted text' local
+local grep done "$@" 2>/dev/null
+echo | && grep && readonly sed echo test test --verbose
+		then --verbose $(pwd) | echo test done "$1" cd "$@" "$@" local local && 'quoted text'
+		sed local grep readonly "$1" echo grep && printf local then x=1 x=1 $(pwd) cd
+	local echo && awk done ${HOME} | cd then printf ${HOME} printf -eu
+cd readonly echo local grep x=1 2>/dev/null
+	&& sed "$@" "$@" cd "$@"
+		export --verbose sed export local
+	done done sed local test /usr/bin "$@" | local --verbose
+"$@" x=1 $(pwd) test then export -eu grep then sed 2>/dev/null
+		sed -eu | awk -eu echo
+		-eu readonly sed readonly sed sed "$1" readonly
+cd "$@" | sed cd grep then awk && awk local export $(pwd)
+		/usr/bin ${HOME} export readonly printf then ${HOME} x=1 --verbose && "$1" --verbose
+--verbose readonly &&
+	2>/dev/null $(pwd) "$@" "$@" ${HOME}
+done sed 'quoted text' sed 2>/dev/null grep export then cd -eu x=1 $(pwd)
+	-eu printf 2>/dev/null grep export cd readonly
+2>/dev/null echo sed x=1 export
+	readonly "$@" /usr/bin test sed
+		test -eu | echo then /usr/bin export --verbose
+then readonly | "$@" ${HOME} && x=1
+x=1 2>/dev/null $(pwd) printf ${HOME}
+	x=1 readonly "$1" export | /usr/bin
+/usr/bin --verbose awk $(pwd) 'quoted text' readonly grep "$1" x=1 grep 'quoted text'
+echo echo 2>/dev/null "$@" readonly "$1" "$@" 'quoted text' readonly
+		test --verbose x=1 -eu test printf printf sed $(pwd) --verbose then x=1 cd then
+		| grep 'quoted text' /usr/bin
+		&& -eu echo sed awk x=1 test
+	done printf test then readonly && $(pwd) done awk /usr/bin readonly readonly
+&& readonly && $(pwd) "$@" export export "$@" | local /usr/bin
+		sed "$@" 2>/dev/null /usr/bin echo $(pwd)
+		grep export echo && x=1 sed
+/usr/bin then --verbose /usr/bin export readonly readonly done 'quoted text'
+		readonly local cd "$@" x=1
+		cd 2>/dev/null export sed x=1 done && export local awk cd
+	readonly then test | ${HOME} -eu readonly "$@" /usr/bin
+	"$@" /usr/bin && readonly $(pwd) export export then then "$@" sed then
+		--verbose ${HOME} -eu -eu --verbose ${HOME}
+	/usr/bin grep && /usr/bin done 2>/dev/null --verbose sed "$1" test -eu done
+		"$1" export done -eu ${HOME} ${HOME} "$1" /usr/bin
+	/usr/bin 2>/dev/null "$1" && ${HOME} then | ${HOME} "$1" local "$1"
+	export echo local export cd printf 'quoted text'
+		echo cd grep "$1" echo "$@" echo then && awk
+	awk --verbose readonly "$1" -eu 2>/dev/null
+	2>/dev/null && test readonly done
+	readonly | cd grep "$@" cd && export ${HOME}
+		"$1" export awk export cd printf readonly
+--verbose /usr/bin grep printf readonly
+echo ${HOME} then done "$@" $(pwd) -eu x=1 test sed readonly "$1" "$1" test
+		"$@" 'quoted text' && ${HOME} "$1" done sed --verbose
+		${HOME} test sed echo cd 2>/dev/null done
+"$@" 2>/dev/null "$@" --verbose --verbose readonly awk $(pwd) cd printf awk /usr/bin
+	"$1" printf -eu export done 2>/dev/null && readonly
+	x=1 sed -eu then then | --verbose 2>/dev/null $(pwd) "$1" 'quoted text'
+		&& "$@" awk then --verbose -eu local awk ${HOME} $(pwd)
+'quoted text' done 2>/dev/null
+&& echo && x=1 readonly ${HOME} done awk grep sed grep
+		local then local local readonly 2>/dev/null && && grep export
+	--verbose "$@" ${HOME} "$@" local sed done
+		export /usr/bin readonly -eu local test readonly -eu
+	--verbose $(pwd) printf x=1 'quoted text' -eu $(pwd) x=1 2>/dev/null "$1" -eu "$1"
+		| 'quoted text' --verbose sed cd "$@" --verbose
+	/usr/bin -eu grep local "$1" then grep x=1 done && --verbose
+		export grep cd -eu sed "$1" x=1 export 2>/dev/null
+	sed $(pwd) --verbose "$1" awk --verbose export && readonly | export $(pwd) cd
+${HOME} echo x=1 ${HOME} then "$@"
+x=1 "$1" printf sed done echo then test && cd "$@" -eu done cd readonly
+	echo --verbose cd $(pwd)
+"$@" x=1 export test echo export local done local
+	x=1 $(pwd) then "$1" 'quoted text' ${HOME} $(pwd) sed then
+		$(pwd) readonly export ${HOME} -eu $(pwd) | --verbose
+		x=1 -eu /usr/bin sed "$@" local $(pwd) | /usr/bin done 2>/dev/null grep
+	${HOME} cd -eu $(pwd) then printf sed printf cd
+	readonly 'quoted text' done ${HOME} readonly | grep awk done readonly
+		| --verbose awk x=1 'quoted text' 'quoted text' done export echo test --verbose
+	'quoted text' $(pwd) awk sed done printf x=1 printf awk ${HOME} 2>/dev/null
+grep ${HOME} sed && local export --verbose grep && /usr/bin x=1 x=1 done x=1
+	printf -eu "$@" cd grep 2>/dev/null ${HOME} grep then local 'quoted text'
+	grep && /usr/bin && | local 2>/dev/null
+	"$@" local export grep $(pwd)
+	test echo $(pwd) sed awk "$1" cd
+	"$@" awk then "$@" done then cd done $(pwd) && "$@" awk | "$1" done 'quoted text'
+		printf cd | done grep awk sed && "$1" cd /usr/bin 2>/dev/null cd 2>/dev/null awk
+		2>/dev/null /usr/bin awk | 2>/dev/null local "$@" | awk "$@"
+	export "$1" cd test -eu readonly cd -eu "$@" && 'quoted text'
+	$(pwd) readonly test $(pwd) echo
+"$1" echo --verbose test 2>/dev/null
+sed done /usr/bin printf printf "$@" "$1" local test ${HOME} echo printf
+		/usr/bin local "$1" | $(pwd) test export test
+	done printf --verbose $(pwd) echo "$1"
+		cd awk done -eu readonly local -eu
+	/usr/bin then ${HOME} "$@" test
+	then done local then x=1 cd --verbose export | export sed --verbose "$@"
+	printf | -eu $(pwd) | local then "$@" done readonly
+	$(pwd) /usr/bin /usr/bin test 2>/dev/null &&
+		then --verbose export cd echo "$@" && grep ${HOME}
+2>/dev/null -eu printf -eu printf
+	sed printf local cd test 2>/dev/null "$1" "$1" 'quoted text' 2>/dev/null sed
+		--verbose $(pwd) x=1 --verbose
+--verbose 2>/dev/null grep awk cd "$@" done
+cd | printf -eu && readonly
+		${HOME} test done grep ${HOME} done /usr/bin cd $(pwd)
+echo 'quoted text' local | readonly "$@" | export | $(pwd) test
+		${HOME} then grep 'quoted text' && grep ${HOME} ${HOME} 'quoted text' printf
+	| "$@" && 2>/dev/null "$@" local sed echo printf
+		/usr/bin x=1 2>/dev/null "$1" && /usr/bin test export -eu grep -eu --verbose
+		done --verbose "$1" "$1" "$1" readonly printf export "$@" x=1 cd x=1
+	| cd 'quoted text' 'quoted text' export $(pwd) x=1 x=1 cd readonly && /usr/bin
+	${HOME} export printf echo "$@" ${HOME} cd printf -eu
+		${HOME} export readonly grep cd | done sed grep | local awk then export | readonly
+awk test readonly test grep x=1 done
+		--verbose printf && 2>/dev/null
+	/usr/bin 'quoted text' --verbose
+	sed --verbose awk 'quoted text' 2>/dev/null | then 2>/dev/null | then done local
+	cd printf sed -eu -eu ${HOME} printf | && then 'quoted text' ${HOME}
+sed printf grep done echo "$1" test /usr/bin x=1 printf
+done grep --verbose && readonly "$1" sed grep readonly grep test
+awk printf done "$@" ${HOME}
+		-eu "$@" --verbose $(pwd) sed awk readonly grep sed | export readonly ${HOME}
+x=1 'quoted text' readonly -eu x=1 "$1" grep printf done
+		| x=1 /usr/bin done $(pwd)
+then -eu ${HOME} printf grep -eu ${HOME} local x=1
+echo /usr/bin readonly then && 'quoted text' "$1"
+		test export printf then $(pwd)
+local --verbose awk done readonly && "$1" $(pwd)
+	export local --verbose 'quoted text'
+	"$@" | /usr/bin test x=1 local echo then awk "$@"
+		2>/dev/null 2>/dev/null readonly x=1 | /usr/bin echo ${HOME}
+	local ${HOME} awk test done echo sed
+		/usr/bin grep done -eu echo then
+/usr/bin /usr/bin ${HOME} local && done local grep ${HOME} 'quoted text'
+"$@" "$@" grep export "$1" local | local "$@" 'quoted text' cd $(pwd) --verbose
+test readonly awk sed printf done && grep printf printf "$@"
+	-eu 'quoted text' 2>/dev/null local "$@" "$@"
+		done "$@" && printf test 'quoted text' awk "$1" done ${HOME}
+	readonly "$1" test 2>/dev/null
+		grep cd 2>/dev/null $(pwd) done printf | && --verbose -eu "$1" /usr/bin
+		echo 'quoted text' -eu "$@" awk then --verbose readonly done test
+		$(pwd) echo ${HOME} cd awk --verbose done
+		echo && then sed | | $(pwd) grep 'quoted text' --verbose
+		then then x=1 export 2>/dev/null -eu sed awk echo
+"$1" export $(pwd) x=1 echo sed /usr/bin ${HOME} sed then awk export &&
+	then test -eu done export 'quoted text' printf
+		awk export "$@" ${HOME} 2>/dev/null printf test export done /usr/bin printf
+'quoted text' local "$@" | "$1" "$1" export cd ${HOME} export readonly --verbose
+	'quoted text' --verbose --verbose grep awk --verbose
+--verbose | -eu ${HOME}
+| | "$1" then $(pwd) test 2>/dev/null "$1" "$@" -eu cd awk printf
+		| x=1 echo && /usr/bin export local awk
+x=1 done sed "$1" "$@" local
+"$1" test $(pwd) awk ${HOME} test sed grep export sed 2>/dev/null
+2>/dev/null x=1 then readonly x=1 "$1"
+cd "$1" cd x=1 /usr/bin test local x=1 "$1" && "$@" --verbose /usr/bin --verbose
+		| then "$@" test --verbose | printf | then | /usr/bin awk awk "$1" cd printf "$@"
+	awk sed 2>/dev/null ${HOME} --verbose "$@"
+		export | grep test readonly 'quoted text'
+	sed export 2>/dev/null ${HOME} 2>/dev/null
+		2>/dev/null --verbose grep --verbose && export x=1 && then readonly sed grep
+		done awk "$@" cd 2>/dev/null | -eu test export grep export grep -eu x=1 export
+| local "$1" export readonly 'quoted text' 'quoted text'
+2>/dev/null ${HOME} readonly 2>/dev/null
+--verbose "$1" --verbose /usr/bin
+	awk printf test sed echo
+	then export test done done readonly
+		$(pwd) cd export /usr/bin
+	then done awk "$@" echo --verbose cd sed 'quoted text' ${HOME} done
+		x=1 --verbose sed readonly export "$1" awk x=1 /usr/bin
+	printf awk x=1 test export done --verbose 'quoted text' echo && 'quoted text'
+| 2>/dev/null | printf sed export ${HOME} grep readonly && done ${HOME} --verbose
+		local x=1 ${HOME} 2>/dev/null && x=1 'quoted text'
+	${HOME} cd "$@" awk --verbose cd
+"$1" "$@" export readonly
+-eu then "$@" echo done -eu ${HOME} local then
+export | awk | 'quoted text' "$1" "$1" printf readonly
+"$@" ${HOME} grep test
+	sed cd awk local "$1" awk 2>/dev/null x=1 --verbose
+	-eu && done cd echo printf | local awk local -eu export echo grep export
+	sed local test local readonly grep cd done sed $(pwd)
+	printf $(pwd) 'quoted text' sed ${HOME}
+	/usr/bin "$@" $(pwd) ${HOME} cd then -eu
+		&& test $(pwd) awk awk local grep
+	${HOME} 2>/dev/null awk awk test /usr/bin
+"$1" cd awk test readonly cd -eu grep grep "$@" --verbose |
+		cd | test $(pwd) local echo /usr/bin test cd x=1 && --verbose
+		echo test echo then export echo
+	readonly echo x=1 /usr/bin | | then local
+export 2>/dev/null readonly
+		awk cd readonly echo 'quoted text'
+	&& x=1 awk awk ${HOME} 2>/dev/null export /usr/bin
+grep | printf "$1" 'quoted text'
+		readonly $(pwd) grep "$@" awk grep
+		echo readonly export 2>/dev/null printf
+${HOME} x=1 'quoted text' cd
+	2>/dev/null x=1 awk --verbose readonly echo done ${HOME}
+2>/dev/null awk echo /usr/bin /usr/bin --verbose
+		grep && printf -eu "$@" printf
+		cd 2>/dev/null cd export /usr/bin then
+export "$1" test grep && test echo
+		2>/dev/null "$@" awk test 'quoted text' done &&
+	x=1 grep "$1" sed x=1 local
+	'quoted text' x=1 "$1" && echo printf
+echo grep readonly $(pwd) 2>/dev/null x=1 export /usr/bin sed readonly cd --verbose
+	x=1 | "$@" x=1 2>/dev/null "$@" sed cd $(pwd) awk "$1" ${HOME} x=1 2>/dev/null
+		x=1 sed local $(pwd) && 2>/dev/null printf awk 'quoted text' | "$1" 'quoted text'
+printf done "$1" --verbose done sed done local x=1 sed "$@" test $(pwd)
+		then printf ${HOME} --verbose
+	-eu echo x=1 test | done test -eu test grep done | local && 'quoted text'
+		-eu printf awk | test 2>/dev/null then "$@" ${HOME} -eu echo cd grep
+		$(pwd) 'quoted text' /usr/bin
+		2>/dev/null /usr/bin done cd && export printf
+-eu "$@" readonly awk then "$@" sed ${HOME} echo "$@" done $(pwd)
+/usr/bin 'quoted text' 'quoted text' readonly
+	local 2>/dev/null printf grep --verbose cd /usr/bin printf
+	local 2>/dev/null x=1 x=1 'quoted text'
+test | then ${HOME} done done export cd 2>/dev/null | && cd grep $(pwd) done
+		x=1 export sed sed && && local -eu then && x=1 then
+	'quoted text' 'quoted text' --verbose readonly
+		local echo echo 'quoted text' sed 'quoted text' awk | test local | sed readonly
+		x=1 then local && export --verbose test printf /usr/bin local local 'quoted text'
+echo $(pwd) $(pwd) -eu $(pwd) awk export cd printf
+		printf 2>/dev/null ${HOME}
+	&& readonly test export && printf -eu 2>/dev/null printf
+| 'quoted text' 'quoted text' 'quoted text'
+cd x=1 | $(pwd) $(pwd) awk sed "$1" export awk echo --verbose
+		cd local done /usr/bin test /usr/bin "$1" export 2>/dev/null
+	cd awk cd ${HOME} ${HOME} cd readonly grep local sed export awk
+sed 2>/dev/null --verbose 2>/dev/null /usr/bin /usr/bin
+--verbose | -eu test 2>/dev/null x=1 echo "$@" -eu /usr/bin 2>/dev/null -eu done
+| done grep "$1" ${HOME} "$@" local /usr/bin grep
+-eu test | done test x=1 --verbose &&
+printf done x=1 grep -eu grep local
+	-eu 2>/dev/null -eu --verbose $(pwd) awk $(pwd)
+export printf grep x=1 then sed printf -eu printf echo awk "$@" test 2>/dev/null
+		then $(pwd) 2>/dev/null 'quoted text' test
+		printf | test | grep sed 2>/dev/null
+		&& echo 'quoted text' x=1 export then --verbose ${HOME} then readonly
+echo --verbose then | echo printf && 2>/dev/null export "$@" 'quoted text'
+x=1 && "$1" done readonly export test 2>/dev/null --verbose grep readonly printf
+		local --verbose test test readonly 'quoted text'
+&& 2>/dev/null -eu && local "$@" test $(pwd) "$1" 2>/dev/null readonly readonly
+${HOME} -eu 'quoted text' --verbose
+		"$@" /usr/bin "$1" export sed 'quoted text' awk local readonly awk
+	"$1" test -eu done cd then done /usr/bin done 2>/dev/null
+sed && cd "$1" export sed then local --verbose --verbose
+&& readonly "$1" awk readonly && printf echo echo cd sed x=1 cd
+sed sed grep 'quoted text' x=1 readonly local && readonly
+		printf 'quoted text' /usr/bin ${HOME} readonly "$@"
+		cd ${HOME} local done then then
+	printf x=1 2>/dev/null -eu ${HOME} && 2>/dev/null test readonly test "$1" | x=1
+local "$@" then echo "$@" cd export grep test sed --verbose --verbose "$@" 2>/dev/null
+		cd 'quoted text' 'quoted text'
+export 2>/dev/null /usr/bin | --verbose done ${HOME} --verbose -eu printf
+	grep $(pwd) "$1" grep cd done "$1" echo test
+		echo export then /usr/bin | x=1 cd printf | echo 2>/dev/null && cd "$1" 'quoted text'
+	"$1" printf done x=1 --verbose "$1" sed grep export
+	"$1" x=1 done | -eu then awk /usr/bin $(pwd) done ${HOME}
+		/usr/bin local "$@" -eu -eu awk
+awk "$1" $(pwd) grep x=1 export && awk && printf 2>/dev/null --verbose | 'quoted text'
+		grep 2>/dev/null --verbose printf -eu grep x=1 sed "$@" grep printf "$@"
+then then ${HOME} ${HOME} "$@" "$@" export -eu echo -eu awk readonly
+	export cd | awk sed printf done ${HOME}
+cd test && 2>/dev/null 2>/dev/null --verbose done -eu /usr/bin 2>/dev/null
+grep -eu cd "$@" --verbose ${HOME} printf --verbose test "$@" cd echo done
+		echo test then -eu "$1" "$@" x=1 grep grep
+	$(pwd) grep local "$1" export --verbose 2>/dev/null
+		2>/dev/null "$@" | done grep readonly
+	cd cd "$@" echo readonly &&
+printf /usr/bin done local then "$@" --verbose grep awk export x=1
+		local printf | cd cd 'quoted text' readonly $(pwd)
+		then awk echo -eu && test grep
+	grep 'quoted text' ${HOME}
+		$(pwd) sed "$@" -eu export readonly awk /usr/bin
+		done 2>/dev/null sed 'quoted text' $(pwd) test echo $(pwd) | 2>/dev/null
+		"$@" "$1" readonly | | | grep "$1" test printf "$@" "$1" 2>/dev/null printf --verbose
+		sed ${HOME} $(pwd) grep grep echo
+/usr/bin -eu x=1 echo grep /usr/bin x=1 then local
+	/usr/bin then then printf local grep cd ${HOME} ${HOME}
+		| "$@" "$@" test local && --verbose
+		"$1" export sed && export
+cd export 'quoted text' cd readonly then then x=1 ${HOME}
+	grep done awk export done echo &&
+		grep -eu export ${HOME} "$@" test readonly "$@"
+$(pwd) 2>/dev/null echo
+then then local echo $(pwd) export $(pwd) $(pwd) local local local sed $(pwd) "$1"
+		done | readonly sed sed export test export test
+	${HOME} echo printf cd
+local done 'quoted text' ${HOME}
+		awk /usr/bin printf $(pwd) printf
+	export local "$@" | --verbose sed && printf test
+	--verbose 'quoted text' && 'quoted text' readonly sed x=1 printf printf
+2>/dev/null readonly ${HOME} local then | --verbose 'quoted text'
+		cd x=1 "$1" awk cd cd test echo && "$1" awk $(pwd) /usr/bin
+echo | "$@" awk local | "$@" ${HOME} test sed cd -eu test
+sed | 'quoted text' "$1" "$@" test "$1" && readonly -eu printf
+		readonly | local sed 2>/dev/null cd
+x=1 printf --verbose 'quoted text' &&
+		${HOME} local readonly printf grep
+	${HOME} 2>/dev/null export grep && | readonly
+	$(pwd) x=1 ${HOME} ${HOME}
+echo then cd "$1" --verbose -eu printf /usr/bin | ${HOME} local 2>/dev/null
+	/usr/bin "$@" /usr/bin echo -eu cd sed /usr/bin
+		/usr/bin export && local && then
+	x=1 /usr/bin -eu x=1 "$1" readonly
+	"$@" | 'quoted text' printf ${HOME} local printf
+/usr/bin cd x=1 cd "$1" -eu && 2>/dev/null
+		grep /usr/bin cd grep --verbose awk test test echo | printf readonly
+readonly done && 'quoted text' "$@" readonly ${HOME}
+		${HOME} ${HOME} 2>/dev/null --verbose cd && cd grep
+		export printf awk 2>/dev/null $(pwd) awk $(pwd) 'quoted text'
+&& -eu export x=1 local $(pwd) then --verbose && then
+	printf sed 2>/dev/null && ${HOME} 2>/dev/null readonly test 'quoted text' x=1 "$1"
+/usr/bin export $(pwd) --verbose cd --verbose
+--verbose && x=1 local export /usr/bin 'quoted text' x=1
+		${HOME} 'quoted text' echo grep awk export | export && readonly
+	sed ${HOME} export printf then
+grep export grep cd printf | readonly sed $(pwd) sed local readonly
+	| done test printf x=1 test test awk ${HOME} x=1 done cd done
+/usr/bin echo done /usr/bin test 2>/dev/null $(pwd) x=1 sed && 'quoted text'
+2>/dev/null awk && -eu --verbose cd 'quoted text' $(pwd)
+"$1" --verbose 'quoted text' awk grep 'quoted text' then -eu test
+	&& echo grep | -eu 2>/dev/null printf
+	"$1" | then printf "$1" 'quoted text' "$@" -eu
+/usr/bin done 2>/dev/null then done grep done 2>/dev/null ${HOME} test grep
+	printf sed export export export local printf printf test && "$1"
+printf awk ${HOME} "$@" x=1 --verbose cd "$1" readonly readonly
+	-eu export test && "$1" 2>/dev/null sed "$1" $(pwd) cd
+		grep "$1" awk x=1 $(pwd) then "$1" test "$@" $(pwd) test export
+${HOME} local x=1 2>/dev/null
+awk then | x=1 "$1" --verbose test 2>/dev/null "$@"
+		$(pwd) cd 'quoted text' export x=1 "$1" then
+"$@" export readonly | done 2>/dev/null local --verbose /usr/bin /usr/bin
+		awk cd done && | then 'quoted text'
+--verbose /usr/bin awk x=1 | done grep export --verbose
+		printf awk -eu local ${HOME} grep
+		readonly x=1 readonly then awk ${HOME}
+	| then ${HOME} && readonly /usr/bin /usr/bin done cd then done then | "$1" echo
+		--verbose --verbose local 'quoted text'
+		${HOME} export x=1 local awk sed export ${HOME} awk local 2>/dev/null | cd grep
+done 'quoted text' test test ${HOME} 2>/dev/null /usr/bin ${HOME} $(pwd) local
+	awk ${HOME} $(pwd) printf echo test "$1" test | ${HOME}
+		${HOME} grep -eu export printf
+sed then then printf && 2>/dev/null x=1 local echo --verbose 'quoted text'
+		awk export readonly readonly | --verbose "$@" echo
+$(pwd) done done local export | /usr/bin "$@" /usr/bin 'quoted text' export then
+"$1" 2>/dev/null local $(pwd) | -eu -eu -eu | -eu local readonly $(pwd)
+		'quoted text' -eu | ${HOME} 'quoted text' then 2>/dev/null
+x=1 'quoted text' && -eu "$1" echo awk "$@" --verbose --verbose
+		grep cd export awk cd && sed then grep && local grep done
+cd $(pwd) $(pwd) done -eu && && ${HOME} "$1" done cd done printf 2>/dev/null
+	2>/dev/null /usr/bin readonly local then 'quoted text'
+		"$@" export export ${HOME} printf $(pwd) test
+--verbose | done "$1" 2>/dev/null --verbose echo cd echo export local readonly
+then readonly 'quoted text' /usr/bin && done "$@" export "$@" | sed ${HOME} x=1
+	awk && | "$1" $(pwd) --verbose awk "$1"
+/usr/bin local then --verbose $(pwd) local
+	2>/dev/null done printf grep
+| printf $(pwd) grep "$@" grep "$1" | export cd | awk local
+	"$@" awk && grep "$1" ${HOME} cd awk sed grep
+'quoted text' readonly readonly $(pwd) test "$@" --verbose x=1
+		export $(pwd) then /usr/bin printf then then printf done printf cd readonly
+test cd local $(pwd) | grep "$1" test echo cd 2>/dev/null printf cd test
+	grep printf cd cd export sed grep
+		/usr/bin $(pwd) test done && ${HOME} /usr/bin ${HOME}
+		done "$1" -eu 2>/dev/null && x=1 2>/dev/null --verbose cd --verbose
+		| 'quoted text' done then
+		-eu export awk /usr/bin sed
+		&& export readonly sed done echo
+	${HOME} | /usr/bin -eu readonly
+&& readonly sed test test /usr/bin grep 2>/dev/null $(pwd)
+	"$@" local -eu "$@" && cd test "$1" /usr/bin awk "$@"
+	echo "$1" grep | printf && x=1 then local x=1 export &&
+		done echo && | /usr/bin 'quoted text' printf printf x=1
+	echo 2>/dev/null sed "$@" export ${HOME}
+	&& --verbose awk then local sed && "$@" "$@" && | sed
+		| $(pwd) export 2>/dev/null
+		done grep echo printf "$@" ${HOME} test && x=1 /usr/bin "$1" 2>/dev/null
+	'quoted text' -eu 'quoted text' echo -eu "$1" echo local 'quoted text'
+	2>/dev/null --verbose readonly --verbose done grep printf
+then ${HOME} "$1" export readonly /usr/bin local -eu local grep
+	--verbose cd then then $(pwd) local "$@" grep done x=1 ${HOME} --verbose | export
+		x=1 sed then grep grep grep printf export awk 'quoted text'
+test cd ${HOME} test $(pwd) done grep cd export sed ${HOME} cd test
+grep "$1" grep readonly echo then --verbose done
+	"$@" x=1 2>/dev/null x=1 done "$1" echo && then echo /usr/bin -eu
+		&& readonly --verbose done local test
+-eu awk local | && x=1 readonly
+printf /usr/bin echo cd x=1 --verbose ${HOME} -eu /usr/bin printf
+	| "$@" grep | done x=1 "$@" x=1 x=1 "$@" test ${HOME} sed test 'quoted text'
+	awk grep then then test && "$1" export x=1 test cd readonly cd test
+	done cd 'quoted text' local sed printf sed done local $(pwd)
+sed && grep local 'quoted text' /usr/bin
+		cd awk export sed printf grep $(pwd) done test then $(pwd)
+	2>/dev/null $(pwd) "$@"
+--verbose && grep | $(pwd) "$@" $(pwd) "$1" ${HOME} $(pwd)
+		-eu printf -eu -eu 2>/dev/null "$@" x=1 export export
+	&& --verbose --verbose ${HOME}
+		&& ${HOME} /usr/bin --verbose -eu "$1"
+printf test readonly test && -eu export test x=1 done awk readonly grep 'quoted text'
+cd grep sed local x=1 awk awk test echo awk then ${HOME}
+| sed "$1" "$1" printf sed printf --verbose 2>/dev/null
+/usr/bin "$1" $(pwd) "$@" /usr/bin sed local printf cd | printf | -eu
+		export && "$1" "$@" "$@"
+		${HOME} --verbose readonly export done then --verbose export cd
+echo then -eu done test export | -eu 'quoted text' /usr/bin
+		"$@" 2>/dev/null /usr/bin readonly "$@" ${HOME}
+		sed 2>/dev/null /usr/bin
+cd "$@" "$@" test -eu readonly
+test printf awk test -eu $(pwd) echo cd readonly --verbose
+		| local echo ${HOME} local | ${HOME} readonly 'quoted text' 'quoted text' grep |
+		awk 'quoted text' -eu done && 'quoted text'
+		"$@" x=1 local $(pwd)
+	'quoted text' cd awk $(pwd) /usr/bin 'quoted text' /usr/bin --verbose | | grep
+	"$@" readonly grep ${HOME} printf export test test 'quoted text'
+		x=1 2>/dev/null x=1 echo --verbose then awk readonly 2>/dev/null
+echo then grep then sed --verbose $(pwd) "$1" sed /usr/bin export
+	local cd /usr/bin printf echo -eu x=1 test 'quoted text' "$1" echo grep awk $(pwd)
+	x=1 x=1 cd printf $(pwd) test 'quoted text'
+		grep local readonly grep ${HOME} sed readonly test readonly
+	"$@" 'quoted text' then 'quoted text'
+"$1" cd 2>/dev/null ${HOME} 'quoted text' $(pwd) | 2>/dev/null "$@" x=1
+	export && then ${HOME} grep test awk && -eu
+		&& export readonly export "$1" x=1 done awk 'quoted text'
+	"$1" export local --verbose awk --verbose printf
+		awk && sed done "$@" sed
+$(pwd) printf x=1 readonly 'quoted text' /usr/bin --verbose then "$@"
+printf echo && | sed awk "$@" x=1 grep "$@" && && then | x=1 local ${HOME}
+	grep test sed "$@" export --verbose "$@"
+done -eu ${HOME} grep --verbose local grep printf awk 'quoted text' 'quoted text'
+	-eu "$1" "$1" test --verbose -eu "$1" sed "$1"
+	local | && sed -eu 'quoted text' && export 'quoted text'
+echo 2>/dev/null --verbose then "$1" "$@" printf && local echo test grep
+	-eu 'quoted text' -eu local && test grep x=1 echo | grep sed /usr/bin printf
+		test 'quoted text' local ${HOME} x=1 local
+		echo --verbose grep "$@" test local export grep printf printf done local
+	'quoted text' ${HOME} "$@" "$1" done readonly x=1
+	'quoted text' awk x=1 local | awk ${HOME}
+	test ${HOME} $(pwd) cd local 2>/dev/null x=1 grep local "$1" local done echo
+	| x=1 grep grep awk cd -eu -eu "$1" --verbose cd done -eu --verbose
+done sed "$1" echo --verbose printf x=1 x=1 && /usr/bin x=1 'quoted text'
+		local 2>/dev/null 2>/dev/null echo
+		"$@" 'quoted text' done && export export --verbose
+	x=1 test 2>/dev/null awk echo && local $(pwd) printf
+		${HOME} local -eu printf readonly 'quoted text'
+		done cd printf | test "$@" done grep
+cd readonly sed readonly 2>/dev/null cd x=1 sed readonly && /usr/bin then
+test $(pwd) "$@" 'quoted text' export printf $(pwd) /usr/bin
+| ${HOME} -eu grep readonly /usr/bin "$1" export 2>/dev/null
+	local export grep && x=1 sed printf -eu test x=1 test grep then test cd
+x=1 sed done --verbose $(pwd) "$@" |
+then done then sed x=1 test cd ${HOME} done sed 2>/dev/null 2>/dev/null
+--verbose local printf --verbose
+		sed done cd --verbose awk | echo | awk x=1 2>/dev/null sed
+		/usr/bin ${HOME} then
+export awk printf x=1 printf $(pwd) "$@" grep
+	export grep readonly --verbose done readonly |
+	awk cd local echo local -eu && x=1
+		printf then readonly /usr/bin local awk "$@"
+	test "$@" "$@" 2>/dev/null done 2>/dev/null echo "$1" /usr/bin
+	printf --verbose sed /usr/bin
+	done test grep export 2>/dev/null
+cd && sed && ${HOME} $(pwd) "$1" "$1" local done --verbose 2>/dev/null
+		sed -eu -eu awk 'quoted text' -eu readonly x=1 awk -eu "$@" printf 'quoted text'
+	${HOME} "$1" export export x=1 test && "$@" readonly sed grep test cd | printf
+"$1" cd awk && cd | printf x=1 local
+	grep readonly grep "$@" cd x=1 -eu 'quoted text'
+		then cd ${HOME} $(pwd) readonly local x=1 readonly ${HOME} /usr/bin then export
+	then export | test sed "$1" export test "$@" echo | echo | --verbose
+x=1 then printf printf x=1 printf echo grep
+2>/dev/null x=1 done export echo
+	$(pwd) echo x=1 $(pwd) then 'quoted text' test
+		"$1" echo test | | x=1
+	$(pwd) printf --verbose export echo done awk $(pwd) && | awk /usr/bin
+$(pwd) local printf export "$1" | cd -eu printf export printf test "$1"
+	export 'quoted text' export grep
+		$(pwd) x=1 "$@" 'quoted text' readonly printf
+	local readonly test "$@" /usr/bin then sed grep "$1" printf then awk awk -eu local
+		printf | | | sed "$1" readonly x=1 grep 2>/dev/null printf
+		echo done local readonly 'quoted text' | grep -eu
+		$(pwd) ${HOME} awk "$1" local then readonly
+	x=1 ${HOME} printf grep
+	2>/dev/null local export ${HOME} readonly 'quoted text' -eu local export --verbose
+grep && readonly ${HOME}
+cd grep "$@" $(pwd) printf grep
+	2>/dev/null $(pwd) -eu ${HOME} sed sed
+printf -eu export "$1" 'quoted text' /usr/bin awk $(pwd)
+-eu readonly done readonly /usr/bin
+	done test $(pwd) $(pwd) then readonly export local 2>/dev/null ${HOME}
+	"$@" $(pwd) sed && done awk x=1 grep done done 2>/dev/null
+'quoted text' grep 'quoted text'
+		--verbose readonly "$1" 'quoted text' sed readonly --verbose 2>/dev/null local
+"$@" local local x=1 local | readonly sed grep --verbose
+	awk 2>/dev/null "$1" cd printf
+		local | grep sed awk done | 'quoted text'
+readonly /usr/bin -eu 2>/dev/null then echo "$1" sed && readonly printf
+export "$@" export then | --verbose printf
+		"$@" readonly grep $(pwd) &&
+"$1" test $(pwd) test $(pwd) done export
+/usr/bin readonly local done echo -eu then
+	-eu grep sed 2>/dev/null test -eu printf cd done printf grep $(pwd) | export readonly
+	cd readonly && printf local
+	&& | done cd readonly done export -eu -eu
+"$1" "$@" "$@" -eu test 'quoted text'
+	printf done done cd test
+		grep x=1 then $(pwd) done "$1"
+'quoted text' | && ${HOME} /usr/bin "$@" awk --verbose &&
+	"$@" grep cd | local awk 2>/dev/null awk $(pwd) x=1 readonly
+echo awk local cd done && done then ${HOME}
+local | 'quoted text' 2>/dev/null && "$@" readonly readonly
+		"$1" export --verbose then 'quoted text' 'quoted text' -eu && echo test
+'quoted text' && done /usr/bin "$1" $(pwd) 2>/dev/null echo | echo
+		cd export --verbose 2>/dev/null
+export 'quoted text' 'quoted text' && ${HOME}
+		/usr/bin x=1 "$@" local echo
+		$(pwd) awk local "$1" "$1" echo /usr/bin /usr/bin test &&
+	--verbose awk local echo x=1 | | export --verbose
+		export sed local $(pwd) 'quoted text' 2>/dev/null then grep
+echo -eu then readonly test test local printf /usr/bin
+	printf readonly cd done readonly test printf 'quoted text'
+	--verbose $(pwd) sed sed x=1 && -eu "$1" --verbose --verbose done awk 2>/dev/null
+		"$1" awk grep test /usr/bin done test printf x=1 printf -eu grep -eu then
+		then grep grep awk export then "$1" done awk local printf awk
+		grep done export done -eu | readonly local --verbose sed export 2>/dev/null
+	/usr/bin sed "$@" "$1" --verbose "$1" printf printf $(pwd) cd
+	"$@" $(pwd) "$1" cd then cd "$@" x=1 | x=1 then printf done 2>/dev/null
+		echo && export --verbose "$@" && echo export
+local cd | -eu printf x=1 -eu then local test then 'quoted text'
+	&& "$@" printf | -eu readonly
+		'quoted text' 'quoted text' sed | awk 2>/dev/null
+		x=1 grep sed sed local x=1 sed cd ${HOME} grep -eu 'quoted text'
+-eu --verbose --verbose printf /usr/bin
+export sed | printf grep export cd "$@" $(pwd)
+		2>/dev/null x=1 --verbose x=1 printf then $(pwd) printf sed "$@"
+cd $(pwd) readonly && 'quoted text' --verbose awk 'quoted text' 2>/dev/null
+	export done test "$@" cd printf sed local ${HOME} --verbose
+	echo x=1 $(pwd) && test readonly echo echo cd export "$@" printf
+	$(pwd) --verbose | export --verbose
+	then 'quoted text' --verbose then cd cd x=1 x=1 test
+		cd awk --verbose x=1 grep done "$@" "$@"
+	awk /usr/bin "$@" -eu readonly cd printf sed sed $(pwd) "$@" grep
+		export then awk "$1" then
+		local x=1 printf awk then $(pwd) && 'quoted text' ${HOME} -eu ${HOME}
+	$(pwd) "$@" $(pwd) cd echo local "$@" export -eu "$1" echo test grep 'quoted text'
+export /usr/bin /usr/bin "$1" sed ${HOME} done /usr/bin then 'quoted text'
+		awk printf printf export | local "$@" "$1" -eu x=1 x=1 /usr/bin | 'quoted text'
+		local -eu cd ${HOME} then | -eu then grep printf test printf test ${HOME}
+-eu cd /usr/bin $(pwd) --verbose export printf --verbose echo 2>/dev/null
+'quoted text' ${HOME} -eu && 2>/dev/null sed
+		'quoted text' grep export 'quoted text' ${HOME}
+	$(pwd) --verbose && echo --verbose
+2>/dev/null "$@" readonly ${HOME} done readonly && "$1" readonly printf
+${HOME} echo grep "$1" export --verbose $(pwd) x=1 test readonly
+2>/dev/null test grep "$1" 'quoted text'
+		2>/dev/null /usr/bin $(pwd) --verbose && grep x=1
+$(pwd) x=1 readonly /usr/bin cd local echo printf --verbose ${HOME} awk && | cd
+echo grep done grep readonly && && export -eu grep 2>/dev/null | readonly x=1
+		grep readonly local sed readonly
+	export sed x=1 && "$1" $(pwd) local 'quoted text' export /usr/bin x=1
+		readonly test ${HOME} 2>/dev/null readonly "$1" done "$1" printf awk grep
+		2>/dev/null test ${HOME} /usr/bin $(pwd)
+		/usr/bin test readonly && | awk "$@" x=1 ${HOME} x=1 done printf $(pwd)
+then 'quoted text' 2>/dev/null /usr/bin
+	echo test awk x=1 echo sed "$1" test awk done then && 'quoted text'
+		then local awk /usr/bin 2>/dev/null | readonly --verbose grep printf
+		readonly -eu /usr/bin && $(pwd) -eu /usr/bin
+--verbose "$@" printf | && cd awk 'quoted text' done "$1" ${HOME}
+		"$1" local cd /usr/bin printf export --verbose "$@" x=1 -eu $(pwd) -eu cd printf
+		export export echo -eu "$1" "$@" --verbose readonly printf then
+printf "$@" done grep printf
+		then /usr/bin then readonly ${HOME} echo 'quoted text'
+	export "$@" $(pwd) -eu --verbose echo --verbose export && cd
+${HOME} | printf ${HOME} export printf
+		2>/dev/null "$@" $(pwd) 2>/dev/null 'quoted text' export
+	awk local 2>/dev/null 2>/dev/null done && && sed grep echo
+	'quoted text' done --verbose sed "$@" export grep grep printf test awk && /usr/bin
+	printf readonly sed then sed --verbose
+		"$@" $(pwd) then printf -eu echo local --verbose
+		"$1" 'quoted text' local "$1" export "$1"
+		"$1" printf x=1 'quoted text' -eu "$@" x=1 $(pwd) && printf
+	echo local "$1" --verbose
+	| 2>/dev/null export sed ${HOME} test done -eu /usr/bin
+		/usr/bin | ${HOME} "$@" grep cd -eu sed
+		${HOME} --verbose readonly -eu readonly done grep then --verbose x=1 sed
+	readonly 'quoted text' export sed
+done && 2>/dev/null cd local grep
+'quoted text' export grep echo awk local 'quoted text' sed $(pwd)
+		then echo export $(pwd) awk && "$@" awk "$1" -eu $(pwd)
+"$@" /usr/bin 2>/dev/null --verbose cd 'quoted text' sed local 'quoted text'
+		/usr/bin && then export --verbose 'quoted text' 2>/dev/null
+	sed local awk printf export 2>/dev/null test then && local
+x=1 awk "$1" -eu sed ${HOME} -eu local export x=1
+		done 2>/dev/null local ${HOME} --verbose $(pwd) && -eu /usr/bin --verbose x=1
+| grep | $(pwd) printf | local export "$1" "$@" x=1 $(pwd) export printf test
+echo printf $(pwd) && sed -eu ${HOME} $(pwd)
+		done | "$@" done readonly echo "$1" test /usr/bin $(pwd) 'quoted text'
+		$(pwd) x=1 ${HOME} && x=1 awk grep
+local 2>/dev/null export ${HOME} export awk 2>/dev/null
+	awk "$@" | $(pwd) | echo test "$@" -eu test printf "$1" sed echo
+done printf 2>/dev/null then
+	export ${HOME} -eu /usr/bin /usr/bin "$1" $(pwd) /usr/bin ${HOME} echo $(pwd)
+		local grep -eu "$1" x=1 "$@" cd done $(pwd) "$1"
+		'quoted text' test -eu /usr/bin echo printf awk
+	/usr/bin /usr/bin echo sed cd export
+		grep $(pwd) --verbose 'quoted text' 'quoted text'
+x=1 | -eu test grep local "$@" | $(pwd) cd
+$(pwd) export readonly printf done -eu done -eu && "$@"
+then --verbose then && "$@" done ${HOME} then done -eu && grep x=1 sed | "$1"
+	done grep -eu | printf &&
+	| --verbose "$@" 'quoted text' "$1" && /usr/bin "$1" readonly -eu
+	${HOME} "$1" "$1" "$@" then done readonly awk awk | then /usr/bin
+-eu "$1" --verbose local echo
+		then 2>/dev/null readonly local
+		/usr/bin grep x=1 -eu 'quoted text' awk $(pwd)
+	| cd grep ${HOME} printf test echo "$@" x=1 "$@" awk readonly
+"$@" $(pwd) "$@" /usr/bin printf 'quoted text' cd grep
+--verbose test /usr/bin
+		readonly echo --verbose /usr/bin 2>/dev/null x=1
+		$(pwd) | --verbose /usr/bin 'quoted text' sed "$1"
+	awk | local done 'quoted text'
+		echo ${HOME} awk awk printf -eu
+grep x=1 sed awk test 'quoted text' export --verbose
+export grep grep local grep test --verbose ${HOME} awk echo -eu export export
+		test local awk printf /usr/bin printf 'quoted text'
+	x=1 export sed "$@" done done local done test
+		local printf --verbose --verbose sed
+-eu then x=1 grep local test then readonly grep 2>/dev/null -eu then $(pwd)
+		echo 'quoted text' done && $(pwd) --verbose
+	export done -eu 2>/dev/null awk --verbose | --verbose done 'quoted text'
+	/usr/bin echo cd printf then "$1" printf then ${HOME} 'quoted text' sed
+sed | local 'quoted text' 2>/dev/null 2>/dev/null "$1" "$@" "$1"
+	"$1" then printf then | sed
+		test 2>/dev/null $(pwd) | sed -eu local printf local export awk printf local done
+	&& awk printf && then /usr/bin 'quoted text' printf echo grep cd && $(pwd) -eu
+-eu then "$@" && ${HOME} awk 2>/dev/null
+	export awk -eu 'quoted text' cd echo
+		&& /usr/bin -eu 'quoted text' grep done grep echo ${HOME} 'quoted text' echo -eu
+		${HOME} echo cd local ${HOME} |
+done awk | /usr/bin -eu readonly sed cd && local awk readonly
+	2>/dev/null -eu 'quoted text' && $(pwd) export readonly export readonly $(pwd)
+		printf --verbose readonly /usr/bin
+		readonly --verbose awk sed local local done "$1" printf local
+	cd export | 'quoted text' ${HOME} local
+printf "$1" awk done $(pwd) && awk 'quoted text' echo done 2>/dev/null
+		| ${HOME} $(pwd) && done "$@" 2>/dev/null echo --verbose -eu done ${HOME}
+		$(pwd) -eu /usr/bin ${HOME} local cd $(pwd) readonly readonly then export
+		2>/dev/null -eu 2>/dev/null 2>/dev/null
+	${HOME} "$1" 'quoted text' awk 'quoted text' -eu cd export --verbose
+	"$1" readonly cd ${HOME} done
+		/usr/bin awk | awk test then
+	awk printf ${HOME} "$@" | /usr/bin x=1
+		echo | then awk printf 'quoted text' grep test sed sed echo export echo
+echo readonly "$@" "$1" | done && readonly done 2>/dev/null grep
+x=1 grep done cd && awk export x=1 --verbose done readonly "$@"
+		local readonly $(pwd) x=1 readonly awk x=1
+cd local grep sed local done
+test 2>/dev/null --verbose "$1" 2>/dev/null printf | printf $(pwd)
+		-eu x=1 readonly | then awk | awk
+	${HOME} export sed done printf /usr/bin -eu awk sed cd $(pwd) awk printf && 'quoted text'
+		grep ${HOME} --verbose /usr/bin readonly $(pwd) $(pwd) then grep printf grep
+$(pwd) sed local test test local "$1" | "$@"
+grep sed ${HOME} printf "$@" "$1" /usr/bin $(pwd) x=1 sed cd cd
+-eu $(pwd) 'quoted text' readonly grep test grep local cd test sed && awk
+		cd printf done $(pwd)
+	$(pwd) test local -eu export
+echo echo "$1" echo ${HOME} | readonly export 2>/dev/null && "$@"
+		test 2>/dev/null cd sed "$1" readonly
+cd 2>/dev/null done x=1 'quoted text' /usr/bin test awk
+	${HOME} | /usr/bin | readonly awk grep x=1 ${HOME} ${HOME} then done "$@"
+--verbose && $(pwd) $(pwd) echo && sed | -eu export test
+-eu 'quoted text' then "$@" | --verbose test | 'quoted text'
+	readonly readonly export && 2>/dev/null $(pwd) done cd local grep $(pwd) && -eu
+	| 'quoted text' $(pwd) /usr/bin echo
+		"$@" "$1" cd local $(pwd) --verbose "$1" test "$1" 2>/dev/null
+		"$1" printf /usr/bin export -eu x=1 printf test $(pwd) grep readonly "$@" grep
+done | done ${HOME} "$@" grep
+		&& grep test 'quoted text' --verbose --verbose 2>/dev/null
+/usr/bin then done export grep test /usr/bin ${HOME} grep
+	cd 'quoted text' /usr/bin "$1"
+	printf echo x=1 sed grep sed sed then "$@" | 2>/dev/null -eu
+		printf ${HOME} 2>/dev/null "$@" cd export awk local 2>/dev/null
+${HOME} ${HOME} --verbose done
+	echo export && 'quoted text' -eu printf "$@" 'quoted text' local local local
+		${HOME} "$1" && echo then $(pwd) grep grep && grep x=1 grep -eu
+&& printf | test --verbose $(pwd) local
+		"$@" awk /usr/bin sed done grep
+printf test printf --verbose sed x=1 grep 'quoted text'
+printf --verbose --verbose $(pwd) --verbose done readonly
+$(pwd) 'quoted text' | --verbose test cd | cd
+	| ${HOME} then export /usr/bin ${HOME} ${HOME} export awk |
+echo 'quoted text' | | | echo
+		cd readonly "$1" ${HOME} 2>/dev/null && grep "$1" | grep 'quoted text'
+		then test -eu -eu done
+-eu -eu then awk && sed "$1"
+'quoted text' echo printf done
+		local ${HOME} "$1" $(pwd) --verbose $(pwd) | | cd -eu cd
+		&& printf | sed x=1 "$1" printf grep -eu local done awk local done then then
+	--verbose 2>/dev/null awk done 2>/dev/null | export "$1" test x=1 /usr/bin grep
+	export echo local | x=1 readonly | export | readonly
+	cd && --verbose 'quoted text' then -eu test | cd --verbose x=1 done /usr/bin
+2>/dev/null | && readonly sed then sed && "$1" ${HOME} grep
+$(pwd) test 'quoted text' awk printf readonly 2>/dev/null
+grep export | $(pwd) sed /usr/bin test
+		| "$1" awk echo then awk awk grep echo x=1 sed ${HOME} | done awk "$1"
+		2>/dev/null 2>/dev/null -eu cd "$1" "$@" --verbose
+-eu --verbose done --verbose cd
+"$@" then test printf 2>/dev/null && done readonly then grep sed -eu "$@"
+		readonly 2>/dev/null 2>/dev/null done /usr/bin sed printf "$@" 'quoted text' grep
+--verbose x=1 test test readonly | export test x=1 awk local cd grep 'quoted text'
+	x=1 test test echo "$@" -eu --verbose grep
+	export done -eu test $(pwd) awk "$@" "$1"
+	"$1" export 'quoted text' printf 2>/dev/null 'quoted text'
+export readonly "$1" -eu echo
+	sed test $(pwd) "$@" readonly test
+cd echo readonly ${HOME} grep
+'quoted text' done export "$@" --verbose
+	test $(pwd) local printf $(pwd) cd grep /usr/bin
+--verbose "$@" then x=1 then awk printf test
+		then 'quoted text' -eu grep "$@" /usr/bin /usr/bin
+--verbose awk x=1 "$1" "$@" 2>/dev/null readonly x=1 sed "$1"
+		local $(pwd) printf $(pwd) x=1 $(pwd)
+		test x=1 && x=1 "$@" sed cd readonly -eu readonly && 'quoted text'
+	| ${HOME} then /usr/bin then printf grep "$@" echo
+		2>/dev/null 2>/dev/null cd "$1" -eu /usr/bin awk export 'quoted text'
+	local -eu done ${HOME} ${HOME} /usr/bin
+	test && -eu then done $(pwd) 'quoted text' 'quoted text'
+		grep export "$1" x=1 ${HOME} 'quoted text'
+	"$1" echo export x=1 grep 2>/dev/null 2>/dev/null
+export ${HOME} -eu sed "$1" x=1 --verbose
+	printf sed export 'quoted text' echo export ${HOME} 2>/dev/null
+	x=1 "$@" "$@" $(pwd) cd local
+		"$@" readonly echo --verbose done local printf readonly cd sed $(pwd) export then
+	/usr/bin 2>/dev/null grep
+		/usr/bin /usr/bin cd ${HOME} done x=1 ${HOME} && /usr/bin then echo echo
+		/usr/bin local then $(pwd)
+--verbose export "$@" | printf then sed echo "$@" readonly grep /usr/bin
+${HOME} && then --verbose awk -eu export --verbose export
+		"$@" awk printf sed readonly awk 2>/dev/null export "$1"
+	then 'quoted text' x=1 echo 2>/dev/null --verbose done then | grep
+	/usr/bin readonly "$1" export then
+		awk "$@" -eu && 2>/dev/null "$1" echo echo "$@" echo awk awk $(pwd) x=1 local "$1"
+	sed "$1" && --verbose local x=1 then
+		'quoted text' test "$@"
+	"$@" cd -eu awk --verbose | then
+		--verbose /usr/bin export ${HOME} printf /usr/bin -eu ${HOME} ${HOME} done
+-eu sed then && awk readonly $(pwd) test -eu 'quoted text' test --verbose
+		/usr/bin local cd $(pwd) /usr/bin cd cd ${HOME} cd | awk sed "$@" echo | then ${HOME}
+2>/dev/null readonly | export
+-eu awk echo awk x=1 local cd "$@" done -eu local /usr/bin | awk |
+-eu 2>/dev/null ${HOME} 2>/dev/null export done "$@" test echo then sed
+export /usr/bin grep -eu "$@"
+-eu done | "$1" readonly && grep test test "$1" echo printf
+printf export printf "$@" readonly printf /usr/bin
+		done -eu && 'quoted text' grep done
+		echo awk local 2>/dev/null x=1 && /usr/bin 'quoted text' /usr/bin test
+	x=1 grep printf ${HOME} x=1 done 'quoted text' export "$1" ${HOME} /usr/bin readonly
+		grep grep 'quoted text' "$@"
+| grep -eu printf test done test sed x=1 local | "$1"
+	local export x=1 then local
+	echo 2>/dev/null then done "$@" printf
+'quoted text' "$1" sed export printf sed $(pwd) export -eu cd 2>/dev/null
+/usr/bin $(pwd) done "$1" test echo ${HOME} printf x=1 "$@" && local && export
+	awk echo /usr/bin printf $(pwd) "$1" echo | | $(pwd) ${HOME} export $(pwd) x=1
+readonly $(pwd) sed awk local "$1" x=1 printf -eu awk sed grep x=1 cd then
+"$@" printf cd /usr/bin awk sed export readonly 'quoted text'
+	export awk -eu echo && ${HOME} then local "$1"
+	grep awk done $(pwd) $(pwd) ${HOME} "$1" /usr/bin
+	export sed sed echo /usr/bin cd then cd "$1" printf $(pwd)
+		/usr/bin --verbose x=1 $(pwd) $(pwd) /usr/bin grep done && local "$@"
+	grep -eu "$@" done local 2>/dev/null | ${HOME} 'quoted text' local cd --verbose
+local echo 'quoted text' grep
+		${HOME} sed "$1" done 2>/dev/null done ${HOME} grep 2>/dev/null
+export printf --verbose |
+	sed ${HOME} export sed done $(pwd) 'quoted text' awk then printf && export
+"$1" printf printf then printf local test --verbose 'quoted text' echo
+	'quoted text' -eu grep then echo 'quoted text' local done
+		"$1" local -eu test readonly /usr/bin done test ${HOME}
+echo sed && ${HOME} | 'quoted text' awk
+	&& -eu export 'quoted text' local "$1" --verbose done grep
+		-eu cd x=1 x=1 -eu done
+		local test x=1 "$@" test
+/usr/bin cd local "$1" test --verbose readonly x=1 export readonly "$1"
+'quoted text' ${HOME} awk $(pwd)
+x=1 $(pwd) "$@" "$@" done sed test test local "$@" && "$1" sed echo
+sed ${HOME} echo test 'quoted text' "$1" /usr/bin && cd grep local "$@" "$1"
+		"$@" /usr/bin cd export local 2>/dev/null then done
+local "$1" "$1" grep ${HOME} 'quoted text' sed "$1" /usr/bin | readonly local
+-eu then done -eu readonly sed $(pwd) export then ${HOME} "$1" export then export
+	export sed done test printf "$@" ${HOME} 2>/dev/null
+then $(pwd) "$1" grep "$1" "$@"
+		| ${HOME} echo ${HOME} "$1" sed
+done test local grep test --verbose /usr/bin done readonly && echo
+--verbose | export "$1" $(pwd) "$@" done local
+	${HOME} 2>/dev/null export echo grep echo ${HOME} "$@" readonly sed readonly
+	then "$1" 'quoted text' --verbose x=1 "$1" cd /usr/bin
+	done readonly sed done awk --verbose
+	${HOME} sed $(pwd) ${HOME} && -eu 2>/dev/null done local -eu
+done local && /usr/bin local 'quoted text'
+x=1 export done x=1 grep
+sed printf "$@" export awk
+		'quoted text' | --verbose 2>/dev/null
+		"$1" --verbose export readonly grep echo 2>/dev/null && printf
+local /usr/bin done 2>/dev/null
+		${HOME} 2>/dev/null echo 'quoted text' $(pwd) grep 'quoted text'
+	echo cd export ${HOME} --verbose
+cd local x=1 cd echo | $(pwd) &&
+		awk $(pwd) /usr/bin then awk export --verbose $(pwd)
+	'quoted text' "$1" --verbose -eu readonly
+	readonly --verbose echo && ${HOME}
+	"$@" awk cd readonly x=1 $(pwd) awk cd
+		/usr/bin then echo /usr/bin cd cd cd /usr/bin
+"$1" "$1" "$@" && then x=1 "$1" 2>/dev/null
+	'quoted text' awk done 2>/dev/null then then | "$1" -eu printf then "$1"
+		then $(pwd) local && "$@"
+		echo /usr/bin echo cd then printf && ${HOME} ${HOME}
+"$@" local "$@" grep ${HOME} /usr/bin ${HOME} printf x=1 printf printf done "$1"
+local echo $(pwd) --verbose -eu export "$1" grep
+		printf test /usr/bin "$@" x=1 "$@" | -eu awk "$@" cd awk
+		'quoted text' test local echo test local x=1 2>/dev/null
+		grep cd ${HOME} --verbose | done
+then | then awk then test 2>/dev/null
+echo 'quoted text' /usr/bin $(pwd) $(pwd)
+	$(pwd) "$1" local --verbose "$1" | printf
+	x=1 | local done /usr/bin readonly --verbose
+	printf 'quoted text' ${HOME} 2>/dev/null | | 'quoted text'
+	export sed ${HOME} then cd export "$@" "$1" 2>/dev/null
+echo --verbose printf | ${HOME}
+		done cd cd printf ${HOME} ${HOME} awk cd export done printf /usr/bin echo
+		readonly ${HOME} printf local
+		'quoted text' x=1 -eu "$1"
+	-eu test readonly cd ${HOME} ${HOME} && printf x=1 "$1" /usr/bin
+		| printf "$1" sed export -eu export echo | $(pwd) local test grep echo local
+	2>/dev/null | grep export grep grep echo awk local 2>/dev/null
+&& printf $(pwd) "$@" && 'quoted text'
+	| | readonly -eu /usr/bin readonly --verbose
+		--verbose readonly 'quoted text' ${HOME} readonly "$1" echo /usr/bin
+		--verbose $(pwd) readonly
+cd | $(pwd) | done then | local ${HOME} | --verbose $(pwd)
+	"$@" grep done -eu x=1 "$1" export && /usr/bin awk export | && local
+	'quoted text' done ${HOME} 2>/dev/null ${HOME} readonly 'quoted text' /usr/bin
+		"$@" ${HOME} x=1 x=1 grep awk printf 2>/dev/null
+-eu awk readonly awk --verbose then ${HOME} -eu readonly -eu local
+		export readonly printf grep sed done cd then readonly
+		awk grep 2>/dev/null then /usr/bin done
+		"$1" test awk x=1 export readonly
+		"$1" "$1" local ${HOME} then 2>/dev/null then
+	awk -eu sed export /usr/bin cd | awk $(pwd)
+echo then sed then 2>/dev/null done
+"$@" sed 2>/dev/null | readonly grep export -eu | 2>/dev/null
+		local /usr/bin cd x=1 $(pwd)
+done 'quoted text' readonly 'quoted text'
+		readonly test 2>/dev/null then x=1 && ${HOME} local "$1"
+		--verbose done readonly sed /usr/bin printf echo "$@" sed done
+	done readonly "$@" ${HOME} cd --verbose export export grep echo awk |
+test 2>/dev/null done ${HOME}
+-eu ${HOME} --verbose && "$@" ${HOME} readonly | "$1" x=1 "$1"
+	'quoted text' export sed ${HOME} local echo local x=1 'quoted text' --verbose
+grep readonly printf local printf --verbose export grep | ${HOME}
+	x=1 export readonly "$1" then printf echo grep sed grep 'quoted text'
+test local awk /usr/bin echo x=1 grep grep $(pwd) -eu "$1" x=1 -eu echo -eu sed
+		"$@" x=1 /usr/bin x=1 awk
+then 'quoted text' 2>/dev/null $(pwd) done 'quoted text' grep ${HOME}
+	grep -eu "$@" "$@" printf then
+	readonly --verbose sed $(pwd) "$1" printf then cd "$1" awk cd -eu awk
+	x=1 | local echo && printf done $(pwd)
+readonly test grep -eu readonly export "$@"
+printf && $(pwd) --verbose | "$1" | then export awk "$@" echo grep 2>/dev/null
+export done /usr/bin local test printf export ${HOME}
+	readonly 'quoted text' echo sed $(pwd) readonly done "$@" done
+		| | sed test then grep then ${HOME} cd then 2>/dev/null export
+		test then "$1" readonly -eu --verbose
+		"$1" $(pwd) printf awk x=1 | readonly 'quoted text' &&
+	done "$@" /usr/bin /usr/bin
+	/usr/bin export then sed | "$1" && sed 'quoted text'
+'quoted text' export test
+	$(pwd) 'quoted text' local export --verbose --verbose && -eu export --verbose
+		2>/dev/null done 2>/dev/null $(pwd)
+--verbose cd readonly readonly -eu x=1 test echo test
+	$(pwd) test sed sed export cd x=1 done then 'quoted text' echo printf
+		local export | -eu 2>/dev/null
+"$1" x=1 test -eu done 'quoted text' grep && awk printf -eu awk 'quoted text'
+	| --verbose 'quoted text' | --verbose cd
+awk 'quoted text' | test done /usr/bin
+		awk local | echo $(pwd) sed 'quoted text' local export
+		--verbose x=1 printf
+	awk /usr/bin && then $(pwd) ${HOME}
+	"$@" && "$1" -eu cd $(pwd) --verbose 2>/dev/null /usr/bin sed done | test
+	cd x=1 | grep then ${HOME} cd sed
+		then 2>/dev/null 'quoted text' export ${HOME} cd printf "$1" 'quoted text'
+		x=1 export --verbose /usr/bin done done test --verbose
+grep 'quoted text' readonly then -eu && $(pwd) test export awk export readonly
+		test printf /usr/bin "$@" echo
+x=1 x=1 -eu | /usr/bin echo test done export
+awk && cd "$1" 2>/dev/null printf done $(pwd) export
+		done cd --verbose 2>/dev/null --verbose | --verbose
+		| x=1 readonly printf test | ${HOME} awk --verbose
+		--verbose grep cd echo
+		"$1" 2>/dev/null && --verbose cd "$@" $(pwd) &&
+test printf && && x=1 awk 2>/dev/null
+	readonly awk -eu awk grep local -eu ${HOME} -eu 2>/dev/null | /usr/bin
+echo && $(pwd) local -eu echo grep test awk -eu
+"$1" "$@" sed && "$1" awk && local local "$1" ${HOME}
+		"$@" printf grep 2>/dev/null readonly printf readonly
+		--verbose | cd awk "$1" ${HOME} -eu /usr/bin
+	local readonly 'quoted text' | sed echo
+	local /usr/bin sed -eu --verbose "$@" sed 'quoted text' test ${HOME}
+		then readonly x=1 | -eu "$1"
+		'quoted text' test -eu -eu 'quoted text' readonly echo sed done
+		sed | --verbose $(pwd) awk readonly done x=1 -eu sed grep
+		-eu sed awk -eu "$@" 2>/dev/null ${HOME} grep local sed export
+echo "$1" echo echo && 'quoted text' test readonly grep export
+| "$@" ${HOME} sed readonly done | echo "$@"
+	grep export /usr/bin 2>/dev/null
+grep then && readonly 2>/dev/null --verbose && readonly
+	&& $(pwd) 2>/dev/null "$1" cd "$1" export local 'quoted text'
+		sed local $(pwd) 'quoted text' local echo $(pwd) x=1 export done |
+		--verbose readonly 'quoted text' sed --verbose /usr/bin sed 'quoted text'
+"$@" 'quoted text' readonly
+$(pwd) done | test $(pwd) && -eu local local && readonly x=1
+export | awk | awk | $(pwd) awk awk 'quoted text'
+		-eu done 'quoted text' -eu export 2>/dev/null
+	/usr/bin "$@" awk echo 'quoted text' test $(pwd) grep -eu readonly ${HOME}
+	| sed /usr/bin readonly -eu local sed x=1 printf local
+	x=1 sed 2>/dev/null export cd "$1" awk "$1" 2>/dev/null printf grep x=1
+		| 2>/dev/null then awk "$@" export --verbose -eu 2>/dev/null then awk
+readonly awk /usr/bin test x=1 echo ${HOME} --verbose
+x=1 grep cd -eu x=1 'quoted text'
+		awk -eu ${HOME} printf test export x=1 grep $(pwd) "$@" 2>/dev/null /usr/bin
+		printf x=1 local $(pwd) |
+		${HOME} -eu && ${HOME} && sed grep
+| && ${HOME} 'quoted text' |
+	grep test printf sed readonly readonly done awk "$@" local 2>/dev/null 2>/dev/null
+		local local local test "$1" $(pwd) $(pwd) -eu ${HOME}
+$(pwd) 'quoted text' grep 2>/dev/null -eu test ${HOME} then test
+	then -eu local x=1 2>/dev/null
+		x=1 -eu 2>/dev/null readonly
+printf -eu && readonly ${HOME} $(pwd)
+export | export x=1 /usr/bin $(pwd) x=1 && cd ${HOME} /usr/bin export &&
+		"$@" awk x=1 readonly x=1 'quoted text'
+		echo && "$1" local --verbose readonly "$1" grep
+awk sed test x=1 && 'quoted text' /usr/bin then
+export x=1 --verbose sed x=1 sed ${HOME} local | && readonly | printf done
+awk ${HOME} grep cd | awk --verbose "$1" 'quoted text' printf 'quoted text'
+--verbose "$@" $(pwd) $(pwd) sed "$1" && --verbose /usr/bin | then sed 2>/dev/null
+		-eu readonly /usr/bin export 'quoted text' awk && echo 2>/dev/null --verbose cd
+	then then | ${HOME} local "$1"
+-eu awk --verbose 2>/dev/null export done && readonly -eu readonly 2>/dev/null
+	$(pwd) "$1" done | -eu cd export "$@" $(pwd) --verbose
+	export "$1" -eu "$@" ${HOME} grep test "$@"
+	test echo && awk -eu printf grep
+echo echo printf $(pwd) -eu 2>/dev/null export "$1" $(pwd) 'quoted text' test
+		--verbose $(pwd) readonly /usr/bin --verbose grep export awk -eu "$@" test
+	&& awk x=1 | then 'quoted text' 'quoted text' | 2>/dev/null
+done 'quoted text' --verbose
+x=1 x=1 $(pwd) --verbose x=1 sed printf then --verbose x=1 local done
+done readonly cd /usr/bin echo | printf sed grep done echo test | 'quoted text'
+	"$1" printf then then 'quoted text' &&
+#include c38.sh
+	$(pwd) "$1" "$@" sed /usr/bin test echo /usr/bin | test printf
+	export local printf ${HOME}
+	echo -eu grep --verbose "$@"
+	"$@" cd echo awk && && 'quoted text'
+	awk $(pwd) then awk --verbose sed grep sed "$@" grep "$@" 'quoted text'
+		sed echo cd echo awk awk /usr/bin && sed export local
+	$(pwd) grep ${HOME} ${HOME}
+		cd 'quoted text' echo "$1" 2>/dev/null
+	printf readonly cd readonly
+		echo /usr/bin then && echo local printf grep echo then
+		then -eu 'quoted text' | ${HOME} readonly
+		export cd readonly local 'quoted text' printf
+$(pwd) $(pwd) printf then
+readonly export -eu echo done cd sed awk test /usr/bin "$@" test x=1 --verbose
+		${HOME} "$@" 'quoted text' grep ${HOME} 'quoted text' local grep test
+	test then "$@" "$1" | -eu local /usr/bin grep readonly && sed printf
+	"$1" ${HOME} x=1 sed grep test | "$@" awk | ${HOME} | --verbose echo
+		-eu --verbose x=1 "$1" --verbose then printf ${HOME} "$@" $(pwd) -eu ${HOME} awk
+"$1" done sed 'quoted text' /usr/bin printf readonly
+2>/dev/null echo 2>/dev/null printf "$1" awk x=1 && done ${HOME}
+	done done -eu test --verbose local
+	sed /usr/bin local done grep "$@" grep then x=1 ${HOME} 'quoted text'
+		/usr/bin 2>/dev/null then
+readonly "$1" --verbose "$@" /usr/bin local then printf $(pwd)
+$(pwd) printf echo grep $(pwd) 2>/dev/null echo done
+		local cd "$@" -eu 2>/dev/null
+	$(pwd) 2>/dev/null x=1 awk then awk printf 'quoted text' ${HOME}
+		--verbose done x=1 printf echo local cd cd test
+		/usr/bin cd local echo | "$@" /usr/bin readonly awk | done ${HOME}
+	--verbose grep 2>/dev/null "$1" grep "$1" printf | --verbose 'quoted text' -eu
+&& cd --verbose 2>/dev/null x=1 | echo ${HOME} printf local
+		sed then grep 2>/dev/null /usr/bin 'quoted text' -eu
+	test ${HOME} test printf then /usr/bin "$1" grep 'quoted text' printf /usr/bin
+		x=1 -eu grep grep sed /usr/bin done export 'quoted text' test test readonly
+		x=1 cd done && 'quoted text' readonly sed awk readonly --verbose local &&
+	"$1" --verbose done 2>/dev/null
+cd "$@" cd $(pwd) local 2>/dev/null cd | local 2>/dev/null awk export "$@"
+	--verbose then cd then -eu -eu sed local ${HOME} && then -eu --verbose -eu
+	'quoted text' "$@" ${HOME} then | done $(pwd)
+	local cd test test sed --verbose readonly
+done /usr/bin && --verbose -eu readonly "$@" 'quoted text'
+/usr/bin 2>/dev/null grep | grep && export "$1"
+printf "$1" $(pwd) && sed
+		local done 2>/dev/null 'quoted text' sed 2>/dev/null
+		"$1" "$@" readonly && local export "$1" | | awk 'quoted text' grep sed grep 'quoted text'
+		printf sed --verbose 'quoted text' sed printf /usr/bin done x=1 "$1" "$1" -eu
+	printf then echo sed -eu ${HOME} "$1" cd && $(pwd) done /usr/bin
+		--verbose && readonly cd -eu 2>/dev/null "$1" test grep cd /usr/bin test
+2>/dev/null && x=1 awk readonly printf
+		export | export 2>/dev/null --verbose readonly then awk sed "$@"
+		export sed /usr/bin readonly | && readonly x=1 done export sed $(pwd) test /usr/bin
+	grep /usr/bin $(pwd) grep "$@" | 'quoted text' -eu local && $(pwd)
+		readonly printf done grep sed 'quoted text'
+-eu echo grep echo "$@" && done 2>/dev/null readonly "$1" then
+grep grep export x=1 -eu export && && readonly cd sed readonly sed
+		x=1 done test $(pwd) x=1 $(pwd) export 2>/dev/null && sed export printf
+	cd x=1 $(pwd) test /usr/bin then printf
+		"$@" test -eu echo /usr/bin readonly grep readonly then -eu
+$(pwd) 'quoted text' printf | "$@" export x=1 local --verbose
+		--verbose | "$1" local "$1" readonly /usr/bin echo printf export local 2>/dev/null
+	grep printf cd /usr/bin printf ${HOME} export | done |
+	| printf x=1 && readonly printf done 'quoted text' $(pwd) done "$@" &&
+	x=1 sed "$@" cd /usr/bin --verbose && 2>/dev/null --verbose
+| $(pwd) x=1 | export local grep
+${HOME} -eu cd 'quoted text'
+	done awk 'quoted text' "$1" echo
+	"$@" sed then 'quoted text' export 2>/dev/null -eu x=1 echo x=1 && $(pwd) test
+		$(pwd) --verbose -eu
+	sed x=1 then $(pwd) done | && /usr/bin
+then done cd then --verbose && && echo | "$1" && "$1" done readonly "$@" test
+		grep /usr/bin 'quoted text' export -eu x=1 /usr/bin "$1" | $(pwd)
+		printf export cd ${HOME} 'quoted text'
+'quoted text' && then echo x=1 x=1 export cd "$@"
+	done then readonly -eu done x=1 "$1" done 'quoted text'
+export grep "$1" --verbose cd --verbose done awk $(pwd) awk grep test
+-eu --verbose /usr/bin sed echo ${HOME} grep
+-eu then sed then echo test
+		&& /usr/bin awk 2>/dev/null $(pwd) x=1 readonly done $(pwd) local cd test
+		cd /usr/bin awk awk readonly printf && -eu grep local $(pwd) &&
+	then 'quoted text' 'quoted text'
+awk export x=1 then "$1" awk "$1" "$1" | sed /usr/bin x=1 "$@" sed ${HOME}
+&& done export -eu test local awk ${HOME} 'quoted text'
+		sed 'quoted text' printf x=1 | awk $(pwd) "$1"
+	&& -eu test export "$1" -eu then $(pwd) local awk "$1" awk then
+		cd cd test readonly export $(pwd) grep local && /usr/bin readonly --verbose
+-eu then printf export printf readonly "$1" 'quoted text'
+		export && | 2>/dev/null --verbose x=1 done echo grep /usr/bin
+	echo sed done readonly | done echo readonly $(pwd) &&
+		$(pwd) echo printf echo export export "$@" cd export done 2>/dev/null
+	cd /usr/bin done export export 'quoted text' | printf
+	grep sed awk /usr/bin awk test --verbose awk then /usr/bin /usr/bin
+	then --verbose ${HOME} sed grep "$1" printf
+${HOME} grep "$1" awk ${HOME} sed -eu grep readonly test -eu ${HOME}
+	2>/dev/null x=1 local printf
+| echo && | --verbose | "$@" test awk printf ${HOME} 'quoted text' export awk
+		cd then awk 'quoted text' | awk
+		printf "$1" /usr/bin awk then -eu 'quoted text' ${HOME} && --verbose echo done
+	readonly 2>/dev/null ${HOME} 'quoted text' -eu "$@" done 'quoted text' 2>/dev/null
+		&& $(pwd) printf "$@" readonly | $(pwd) | 2>/dev/null
+	export x=1 test && x=1 grep
+	then $(pwd) "$@" --verbose cd local readonly then sed sed | cd -eu 'quoted text'
+done | -eu "$1" "$1" $(pwd) then /usr/bin 'quoted text'
+then -eu done x=1 --verbose $(pwd) printf 2>/dev/null
+sed "$@" local then "$1" x=1 -eu && 'quoted text' "$@" local -eu cd
+		&& then cd cd -eu 2>/dev/null && done awk export export printf awk /usr/bin ${HOME}
+/usr/bin "$@" --verbose /usr/bin 2>/dev/null
+	export test -eu export x=1 test 'quoted text' then done 2>/dev/null
+	echo echo ${HOME} -eu -eu && test | "$1" /usr/bin "$@" then
+		-eu done /usr/bin -eu
+		printf x=1 --verbose sed && echo ${HOME} | $(pwd) export "$@" sed then
+	${HOME} -eu then cd done "$1" 'quoted text' awk readonly readonly | readonly
+	/usr/bin readonly /usr/bin grep echo | test then $(pwd) && ${HOME} local
+/usr/bin $(pwd) printf readonly && test --verbose
+		&& grep "$1" test | readonly local --verbose echo | done 2>/dev/null
+local "$@" | local "$1" ${HOME}
+		cd echo | echo $(pwd) /usr/bin 'quoted text' "$1" x=1 export --verbose awk readonly
+export readonly test test test /usr/bin /usr/bin
+		"$@" echo -eu 'quoted text' cd 2>/dev/null
+	test done x=1 --verbose export "$1" cd grep && echo then export -eu
+&& 'quoted text' sed "$@" sed printf ${HOME} | 2>/dev/null then 2>/dev/null sed
+"$1" && grep grep done -eu sed
+		test sed done cd ${HOME} test 2>/dev/null done sed grep done printf
+	printf "$@" grep awk "$@" && 'quoted text' -eu "$1" sed -eu
+	x=1 echo "$1" /usr/bin test | local echo -eu && export test ${HOME}
+done ${HOME} then "$@"
+	2>/dev/null export ${HOME} done sed -eu --verbose
+readonly test /usr/bin ${HOME} x=1 then "$1" sed --verbose
+	test --verbose test /usr/bin /usr/bin cd
+		"$@" then awk local export $(pwd) readonly --verbose 'quoted text'
+		--verbose 2>/dev/null done then "$@" grep echo readonly
+	&& echo echo grep ${HOME} grep -eu 2>/dev/null
+	--verbose ${HOME} done -eu then echo grep ${HOME} x=1 echo --verbose $(pwd)
+		"$1" echo 2>/dev/null x=1 ${HOME} echo 2>/dev/null
+		2>/dev/null sed readonly done export | $(pwd) done "$@" ${HOME} export
+		| "$@" | readonly awk done then x=1 local /usr/bin done 'quoted text'
+echo x=1 "$1" 2>/dev/null && awk | --verbose local sed $(pwd)
+		$(pwd) && && | -eu | done test sed sed export echo 'quoted text' -eu
+	echo local echo 2>/dev/null 2>/dev/null 'quoted text' sed 2>/dev/null
+		/usr/bin readonly --verbose awk echo "$1" 'quoted text' test ${HOME}
+local $(pwd) sed --verbose "$1" /usr/bin export
+		'quoted text' 'quoted text' printf readonly $(pwd) awk printf
+| local /usr/bin "$1" -eu test done 2>/dev/null
+	"$1" awk --verbose --verbose | done printf 'quoted text'
+/usr/bin $(pwd) ${HOME} /usr/bin then echo local then ${HOME} $(pwd) cd
+	&& "$@" /usr/bin printf printf readonly cd awk
+sed ${HOME} then printf "$@" sed local
+${HOME} then /usr/bin sed then readonly
+		printf sed && grep $(pwd) 2>/dev/null $(pwd) 'quoted text'
+	--verbose "$@" readonly /usr/bin readonly &&
+done ${HOME} -eu -eu test
+"$@" awk --verbose ${HOME} ${HOME} "$@" readonly -eu "$@" readonly printf 2>/dev/null
+printf export sed --verbose "$@" done
+--verbose then ${HOME} sed $(pwd) "$@" 2>/dev/null x=1 /usr/bin --verbose 'quoted text'
+done $(pwd) $(pwd) printf x=1 test /usr/bin grep echo 2>/dev/null $(pwd) "$@"
+		${HOME} awk "$@" awk sed readonly then test && grep && then
+	export 'quoted text' --verbose
+--verbose 2>/dev/null /usr/bin sed 2>/dev/null sed export done local
+		readonly --verbose echo | 2>/dev/null
+	$(pwd) test done "$@" ${HOME} $(pwd) "$@"
+		2>/dev/null && readonly cd -eu ${HOME}
+	$(pwd) ${HOME} awk && local ${HOME} "$@" 2>/dev/null done --verbose
+&& grep sed "$1" | $(pwd) 2>/dev/null
+	x=1 sed sed done --verbose x=1 'quoted text' $(pwd) sed "$@" -eu -eu
+	test ${HOME} ${HOME} then readonly "$1" $(pwd) printf done
+export 2>/dev/null printf -eu local local /usr/bin 'quoted text' cd
+| --verbose --verbose awk export
+--verbose then awk $(pwd) echo 'quoted text' x=1 grep && test grep
+| 2>/dev/null ${HOME} 2>/dev/null $(pwd)
+	--verbose 'quoted text' ${HOME}
+"$1" then /usr/bin echo local $(pwd) --verbose
+	2>/dev/null 2>/dev/null /usr/bin /usr/bin
+		${HOME} $(pwd) export printf cd
+	awk grep ${HOME} echo local x=1 export export then
+"$@" && && x=1 then "$1" awk echo test --verbose grep awk test done
+&& test done /usr/bin "$@" sed 2>/dev/null export local ${HOME}
+	x=1 export | done local | "$@" done /usr/bin
+	export | ${HOME} grep local x=1 local done echo
+		cd /usr/bin "$@" --verbose export sed 'quoted text' readonly | export readonly cd
+	x=1 cd then ${HOME} ${HOME} | $(pwd) sed printf $(pwd) $(pwd) "$@" -eu readonly
+		/usr/bin 'quoted text' cd printf | && local printf
+	sed grep && $(pwd) local 'quoted text'
+then then readonly 'quoted text'
+		x=1 x=1 local grep $(pwd) cd ${HOME} | test export awk | --verbose then printf
+	${HOME} sed | awk then test x=1 local grep local 'quoted text' 'quoted text'
+sed sed export export ${HOME}
+printf done test awk readonly x=1 printf
+		local cd /usr/bin cd readonly
+	'quoted text' local test --verbose echo
+"$@" printf 2>/dev/null grep $(pwd) printf export && -eu export | /usr/bin grep
+	'quoted text' then "$1" x=1 echo test && readonly printf readonly cd then ${HOME}
+	-eu -eu -eu grep | 2>/dev/null printf 'quoted text' readonly
+		printf awk printf sed
+test && readonly grep /usr/bin printf local readonly cd then "$@" test | printf
+	printf local 'quoted text' ${HOME} 2>/dev/null awk 2>/dev/null ${HOME} awk
+		readonly awk && ${HOME} $(pwd) cd then "$1"
+		local test cd /usr/bin -eu test
+		2>/dev/null && done -eu
+		${HOME} readonly done local export ${HOME} export done 2>/dev/null
+sed "$@" | "$1" --verbose
+	sed test --verbose export ${HOME}
+test cd then echo ${HOME} x=1 ${HOME} readonly then
+	$(pwd) export printf "$1" 'quoted text' grep awk grep grep 2>/dev/null
+	x=1 2>/dev/null 'quoted text' local && grep readonly export -eu test "$@" grep
+		grep "$@" && | && /usr/bin $(pwd) && ${HOME} "$1" echo "$@" readonly
+grep ${HOME} test echo x=1
+		"$1" then && "$1" x=1 2>/dev/null
+		"$1" && /usr/bin -eu ${HOME} -eu
+test readonly export printf -eu echo 2>/dev/null
+	&& readonly readonly $(pwd) local printf printf grep cd ${HOME} /usr/bin
+cd | ${HOME} x=1 readonly awk "$1" export 'quoted text'
+local | "$1" cd export done 2>/dev/null then && echo 'quoted text' sed ${HOME}
+"$@" then ${HOME} ${HOME} 2>/dev/null -eu done
+		awk cd done ${HOME} x=1 cd ${HOME} test 2>/dev/null 'quoted text'
+	${HOME} local --verbose sed test local 'quoted text'
+printf done printf "$1" x=1 test "$@" printf
+2>/dev/null "$@" --verbose
+export export test 2>/dev/null
+		grep 'quoted text' test echo cd | test "$@" --verbose then export
+	printf local done ${HOME} "$1" x=1 | 2>/dev/null
+		awk /usr/bin export printf | done grep printf | /usr/bin done 'quoted text' export
+	&& -eu done | "$@" $(pwd) 'quoted text' x=1
+	&& grep grep then test sed export "$1" cd then "$1" $(pwd)
+		--verbose awk "$1" readonly cd awk grep && done
+		sed | "$@" cd 2>/dev/null test done 'quoted text' printf -eu "$1"
+		x=1 local x=1 grep --verbose sed /usr/bin done done "$@" -eu
+	then x=1 printf ${HOME} --verbose echo
+	"$@" $(pwd) /usr/bin "$@" "$1"
+export grep awk done grep ${HOME}
+local printf --verbose
+	"$1" local echo done "$1" test
+	export done echo cd local awk local printf
+${HOME} --verbose test grep -eu echo export "$1" -eu test
+/usr/bin grep printf local "$@" grep | "$@" test "$1" then 2>/dev/null
+		awk /usr/bin test "$@" $(pwd)
+sed | 2>/dev/null sed then "$@"
+		local export then then awk
+test readonly export 2>/dev/null test /usr/bin "$1" echo
+readonly cd done echo -eu /usr/bin echo sed /usr/bin
+	"$1" export x=1 /usr/bin 'quoted text' &&
+		-eu export echo x=1 done test --verbose test awk /usr/bin readonly $(pwd)
+		$(pwd) --verbose 2>/dev/null then
+	then "$1" -eu test readonly export sed x=1 ${HOME}
+	/usr/bin "$@" printf echo $(pwd) echo && | readonly
+	awk grep awk $(pwd) echo local
+/usr/bin && awk test 'quoted text'
+'quoted text' --verbose readonly
+	| done local sed --verbose
+	test /usr/bin sed sed
+x=1 $(pwd) 2>/dev/null cd ${HOME} | /usr/bin 2>/dev/null then
+		&& local sed --verbose "$1" printf export export awk then sed ${HOME} "$@"
+x=1 | /usr/bin printf export $(pwd) echo "$@" | cd "$1"
+"$@" x=1 awk awk sed 2>/dev/null --verbose | cd 'quoted text' local --verbose
+'quoted text' 2>/dev/null printf export "$1" 'quoted text' then cd awk
+	| --verbose export cd ${HOME} awk -eu sed
+		'quoted text' export cd $(pwd) printf "$@" 'quoted text'
+test cd | && printf sed "$1" grep --verbose grep grep $(pwd) 'quoted text'
+	/usr/bin sed export then test cd "$1" --verbose
+	then done echo test sed sed | /usr/bin done
+	local --verbose grep "$@" sed ${HOME} ${HOME} --verbose test 'quoted text'
+	cd 2>/dev/null 2>/dev/null sed "$1" "$1" grep
+export export local "$@" "$1"
+grep 2>/dev/null 'quoted text'
+		x=1 $(pwd) grep 'quoted text' echo "$1" sed ${HOME}
+		done ${HOME} | printf awk awk && sed x=1 echo awk && -eu 2>/dev/null
+	cd -eu ${HOME} && 'quoted text' 'quoted text' test | printf /usr/bin && grep
+	echo && local local test then $(pwd) awk echo echo echo --verbose $(pwd)
+	awk "$1" && export echo 2>/dev/null 'quoted text' "$@" grep then 2>/dev/null
+local $(pwd) ${HOME}
+	2>/dev/null grep $(pwd)
+	x=1 test x=1 ${HOME} awk done awk && export then done awk /usr/bin then readonly
+printf awk /usr/bin grep "$1" local 'quoted text' 2>/dev/null
+	2>/dev/null && "$1" grep export $(pwd) grep then
+		test -eu 'quoted text' "$@" --verbose
+readonly x=1 "$@" echo grep
+export 2>/dev/null /usr/bin 'quoted text'
+	readonly 'quoted text' cd sed | export x=1 "$1" printf
+	&& grep --verbose local --verbose 'quoted text' x=1 grep x=1 x=1 x=1 awk
+	awk --verbose grep -eu echo /usr/bin 2>/dev/null export 2>/dev/null
+grep ${HOME} "$@" ${HOME} grep awk 'quoted text'
+grep test ${HOME} && export readonly grep --verbose printf "$@" "$@" --verbose
+		readonly "$1" local -eu local done export
+grep sed $(pwd) x=1 x=1 x=1 cd echo then test awk readonly test ${HOME} "$@" sed
+then --verbose -eu awk
+		"$1" grep printf sed done
+readonly x=1 && ${HOME} ${HOME} test then cd test test /usr/bin done 2>/dev/null
+/usr/bin | echo "$1" x=1 $(pwd) --verbose readonly sed 2>/dev/null
+	-eu cd printf sed local -eu printf 2>/dev/null && awk --verbose
+	echo --verbose /usr/bin sed test
+	"$@" sed && readonly --verbose cd $(pwd) sed readonly
+cd 2>/dev/null echo done "$@" cd echo echo
+	awk test -eu ${HOME} $(pwd) done ${HOME} --verbose cd grep sed local &&
+	awk 2>/dev/null ${HOME} "$1" then --verbose echo readonly then echo then sed
+sed 2>/dev/null -eu -eu x=1
+	grep $(pwd) "$@" echo cd | done && && -eu -eu
+	&& test then awk export "$1"
+| -eu x=1 && cd /usr/bin
+		${HOME} readonly --verbose cd
+	-eu --verbose printf export -eu done local sed echo /usr/bin
+	export x=1 /usr/bin sed readonly export done 'quoted text'
+	| then printf x=1 cd /usr/bin
+		sed /usr/bin x=1 && -eu printf /usr/bin done grep && echo then awk awk |
+	"$1" "$1" -eu echo then ${HOME}
+		done | ${HOME} echo cd export done
+local x=1 x=1 ${HOME} then ${HOME} local echo readonly ${HOME} readonly
+		cd -eu cd ${HOME} 'quoted text' done then -eu
+		echo awk $(pwd) && sed printf cd then export then printf
+	cd test | done --verbose /usr/bin "$@" export then /usr/bin
+		&& -eu x=1 && x=1 /usr/bin -eu /usr/bin -eu
+"$1" $(pwd) "$1" test 2>/dev/null "$1" $(pwd) $(pwd) cd 'quoted text'
+		--verbose "$1" printf x=1 test
+$(pwd) "$@" 'quoted text' 'quoted text' awk | readonly x=1 done --verbose
+2>/dev/null -eu export grep sed
+echo 2>/dev/null 2>/dev/null readonly
+	2>/dev/null x=1 --verbose printf $(pwd)
+sed "$@" printf ${HOME} --verbose awk "$1" local echo awk ${HOME}
+	'quoted text' readonly printf awk | export ${HOME} "$@" ${HOME} 2>/dev/null done
+		"$1" echo echo grep echo
+	cd export ${HOME} then | done "$@" x=1 &&
+		then export test 2>/dev/null /usr/bin 'quoted text' done "$@" cd then "$1"
+	sed | echo /usr/bin local printf
+	awk cd then echo echo --verbose printf -eu cd -eu /usr/bin echo test x=1
+	readonly "$@" 2>/dev/null -eu test done
+		local "$@" x=1 readonly
+-eu && --verbose x=1 "$@" sed -eu | 2>/dev/null echo --verbose /usr/bin
+done export sed grep |
+--verbose /usr/bin printf "$@" ${HOME} then done cd && 2>/dev/null
+'quoted text' then printf /usr/bin "$@"
+	$(pwd) -eu done "$1" local | readonly && $(pwd)
+${HOME} | --verbose "$@" echo cd test "$1" local printf "$@" test
+		echo 'quoted text' then 'quoted text' ${HOME} local /usr/bin awk x=1 readonly
+then ${HOME} "$1" $(pwd) 'quoted text'
+		done grep test awk x=1 && 'quoted text' export 2>/dev/null
+then ${HOME} cd local ${HOME} grep then x=1 "$@" test 'quoted text' sed readonly
+		echo "$1" "$@" grep printf
+done export 2>/dev/null then
+	"$@" grep $(pwd) x=1 sed printf awk -eu --verbose then ${HOME} local printf
+		| local | -eu x=1 test 2>/dev/null --verbose sed "$1"
+	/usr/bin cd $(pwd) /usr/bin
+$(pwd) && done 'quoted text' "$@" && "$@" | "$@" -eu /usr/bin x=1
+		&& readonly --verbose $(pwd) awk 2>/dev/null test cd local sed done 2>/dev/null
+	done "$@" awk grep export && printf
+		| awk && $(pwd) x=1 test readonly 'quoted text' awk grep echo
+	&& && grep | cd /usr/bin /usr/bin /usr/bin local
+		2>/dev/null x=1 grep
+readonly "$@" done ${HOME} grep awk
+"$1" $(pwd) test printf echo printf -eu x=1 /usr/bin -eu |
+	grep grep printf then "$@" cd
+local "$1" 'quoted text' test x=1 awk echo
+&& && grep && sed cd local test export /usr/bin then $(pwd) sed 'quoted text'
+done readonly local $(pwd) export 2>/dev/null awk
+		"$@" x=1 x=1 cd x=1 x=1 printf
+| test done export sed readonly readonly
+		"$1" --verbose x=1 test
+	$(pwd) local && test awk -eu then readonly 'quoted text' local cd "$1"
+-eu test 'quoted text' && then done then /usr/bin --verbose
+		-eu local cd -eu printf /usr/bin "$1" local export |
+	| -eu --verbose local 'quoted text' 2>/dev/null test "$1"
+then | /usr/bin awk "$1" "$@" test readonly
+	x=1 readonly done ${HOME}
+/usr/bin echo sed test x=1 "$1" 'quoted text' export "$1" --verbose cd
+		printf sed done done | done
+	echo readonly $(pwd) readonly
+export awk export awk x=1 readonly |
+		readonly sed done "$1" "$@" test --verbose 'quoted text'
+printf printf $(pwd) awk ${HOME} printf && export ${HOME} sed x=1 $(pwd)
+		-eu "$@" | && test grep grep local local echo | local "$1"
+		awk x=1 /usr/bin && ${HOME} "$1" -eu 2>/dev/null 'quoted text'
+	x=1 export echo --verbose awk cd "$1" | "$1" printf x=1 -eu -eu then x=1
+	'quoted text' "$1" printf sed | | | 2>/dev/null ${HOME}
+	grep then export 2>/dev/null "$1" printf then /usr/bin -eu "$1"
+then readonly ${HOME} local sed awk cd $(pwd) export $(pwd) x=1 && "$@" echo
+		/usr/bin export export sed 'quoted text' awk
+	test grep ${HOME} export local export cd ${HOME} "$@" -eu export export done
+		readonly cd "$1" local x=1 --verbose | "$@" && readonly printf sed readonly test
+done local readonly readonly ${HOME} export then x=1 local
+printf "$1" -eu local && x=1 2>/dev/null grep export $(pwd) ${HOME} 2>/dev/null
+grep ${HOME} | echo readonly && cd "$@" export cd | ${HOME}
+	export /usr/bin local
+2>/dev/null $(pwd) local $(pwd) done echo
+	'quoted text' --verbose
+		-eu && $(pwd) export cd printf local printf export test 2>/dev/null 'quoted text'
+	| /usr/bin export printf && 'quoted text' local grep
+	&& readonly then --verbose sed printf | local "$1" "$1" then done
+local printf && 2>/dev/null && export test
+"$@" done export --verbose 'quoted text' x=1 test 'quoted text'
+done then ${HOME} $(pwd) test awk --verbose "$@" && && --verbose
+	then 'quoted text' readonly 2>/dev/null /usr/bin
+$(pwd) local --verbose "$@" sed grep sed "$1" "$1"
+		test | && sed "$1" -eu 2>/dev/null $(pwd) export local x=1 'quoted text' test test
+	$(pwd) export && sed --verbose export grep ${HOME} -eu "$1" echo then "$1" awk
+sed && then local export
+	| local test grep 'quoted text' sed readonly | cd "$1"
+		x=1 -eu printf x=1 "$@" 'quoted text' sed && echo $(pwd)
+		"$@" $(pwd) && echo | 'quoted text' cd $(pwd) "$1" local x=1
+		${HOME} "$1" --verbose | awk local -eu /usr/bin local done cd
+		x=1 -eu then local 'quoted text' echo 2>/dev/null
+"$@" then then done --verbose /usr/bin test x=1 local -eu "$@" ${HOME} && x=1
+local local /usr/bin cd --verbose awk /usr/bin printf
+	local | && "$@" sed -eu sed /usr/bin --verbose echo
+"$1" local readonly sed -eu
+		readonly /usr/bin grep && | sed ${HOME} ${HOME} "$@" export export -eu "$1" "$@"
+	then sed printf export
+		&& | grep -eu done export 'quoted text' | printf
+		test sed local $(pwd)
+	awk x=1 $(pwd) x=1 sed cd sed done "$@" $(pwd) echo $(pwd) $(pwd) ${HOME} --verbose
+	"$1" then 2>/dev/null | cd readonly "$1" --verbose --verbose 'quoted text' 'quoted text'
+	awk local && && $(pwd) printf x=1
+-eu awk local /usr/bin then 2>/dev/null $(pwd) then
+'quoted text' && && local test test -eu 2>/dev/null
+	'quoted text' sed local grep done 'quoted text'
+		&& && && $(pwd) local cd ${HOME}
+	sed grep readonly awk --verbose 'quoted text' ${HOME} cd
+		test --verbose readonly grep x=1 $(pwd) then export printf
+	done | local /usr/bin awk printf cd sed echo sed -eu printf
+/usr/bin grep x=1 2>/dev/null echo readonly x=1 export cd
+	"$@" --verbose | test cd && 'quoted text' 'quoted text' x=1
+		cd --verbose $(pwd) "$1" export done -eu 'quoted text' done /usr/bin
+		x=1 grep && cd echo grep grep local x=1 ${HOME} done export -eu cd printf 'quoted text'
+	/usr/bin test x=1 printf x=1 /usr/bin awk
+		echo /usr/bin --verbose readonly
+2>/dev/null awk x=1 2>/dev/null then | readonly $(pwd) 2>/dev/null $(pwd) /usr/bin
+	--verbose printf ${HOME} sed
+	readonly test echo x=1 'quoted text' readonly then grep grep test
+		"$1" then then "$1" awk 'quoted text' export /usr/bin
+		cd 'quoted text' /usr/bin printf /usr/bin x=1 done sed awk ${HOME} "$@"
+	-eu --verbose -eu awk 2>/dev/null $(pwd)
+echo done cd $(pwd) test done $(pwd) x=1 sed sed awk && $(pwd) x=1 -eu
+		--verbose done 2>/dev/null x=1
+$(pwd) export $(pwd) --verbose echo echo
+	"$1" $(pwd) local readonly ${HOME} /usr/bin local test local then then readonly
+	printf awk --verbose done test /usr/bin cd -eu 2>/dev/null $(pwd)
+	--verbose then 'quoted text'
+2>/dev/null ${HOME} "$1" readonly
+		"$1" grep awk cd local echo echo done export
+	${HOME} 'quoted text' x=1 echo local printf readonly
+cd -eu readonly x=1 cd grep awk done
+| cd $(pwd) export test 'quoted text' && done 2>/dev/null done
+	then x=1 echo readonly x=1 test /usr/bin "$1"
+	export && "$@" readonly && "$1" then "$1" /usr/bin echo | grep cd
+		--verbose test ${HOME} --verbose done
+"$@" "$@" "$1" export -eu grep test cd ${HOME} "$@" grep done
+	$(pwd) x=1 x=1 export "$@" ${HOME} test awk "$@" local && grep |
+		"$@" awk 2>/dev/null -eu local 2>/dev/null local ${HOME} "$@" export
+export printf 'quoted text'
+		done 'quoted text' 'quoted text' -eu --verbose $(pwd) then 2>/dev/null readonly
+test 'quoted text' export 2>/dev/null
+		echo -eu printf printf --verbose
+&& cd cd 2>/dev/null cd "$1" export
+	grep /usr/bin && sed -eu sed "$1" local local "$@" -eu | ${HOME}
+		export ${HOME} /usr/bin 2>/dev/null 'quoted text' 2>/dev/null cd
+'quoted text' && export printf readonly 'quoted text'
+x=1 then && echo test done export
+		readonly --verbose grep x=1 done local | --verbose cd done ${HOME} grep | echo
+		$(pwd) 2>/dev/null cd grep local
+-eu sed "$1" export --verbose awk cd done readonly grep | done --verbose
+		sed sed printf "$@" printf --verbose 2>/dev/null 2>/dev/null cd 2>/dev/null
+		--verbose x=1 test readonly then done
+	done local printf ${HOME}
+	x=1 -eu "$1" /usr/bin printf /usr/bin "$@" -eu test
+	test test x=1 grep $(pwd) cd cd printf sed readonly test
+		${HOME} 2>/dev/null then "$1" "$@" 2>/dev/null sed $(pwd) && awk
+		printf -eu --verbose && sed --verbose echo cd done export
+	readonly "$1" ${HOME} $(pwd)
+	$(pwd) $(pwd) awk cd then
+		-eu 2>/dev/null test printf export /usr/bin x=1 "$1" -eu x=1
+	$(pwd) "$@" readonly
+		${HOME} 2>/dev/null x=1 test -eu x=1 cd
+&& "$@" awk -eu | export cd readonly ${HOME} local && local awk
+		$(pwd) local cd && printf $(pwd)
+		| grep x=1 readonly sed local awk /usr/bin test grep ${HOME} ${HOME}
+		'quoted text' -eu --verbose grep 'quoted text' 2>/dev/null 2>/dev/null export readonly
+		export echo then printf $(pwd) | then then
+	'quoted text' && sed "$1" "$1"
+	-eu --verbose ${HOME} grep
+	echo --verbose echo cd echo
+		export /usr/bin test readonly export && cd test "$@" "$@" | readonly echo ${HOME}
+	sed $(pwd) 2>/dev/null readonly
+"$1" printf $(pwd) export |
+	/usr/bin cd export "$1" x=1 cd /usr/bin --verbose "$1" 2>/dev/null 'quoted text'
+/usr/bin echo cd cd sed 'quoted text'
+		--verbose | test printf then echo cd cd ${HOME} 2>/dev/null grep
+	${HOME} grep printf echo echo $(pwd)
+${HOME} -eu echo "$1" ${HOME}
+awk --verbose "$@" 2>/dev/null local --verbose local
+		sed then ${HOME} /usr/bin
+$(pwd) && 'quoted text' export ${HOME}
+		export readonly then local 2>/dev/null printf ${HOME} -eu -eu /usr/bin -eu test
+/usr/bin 2>/dev/null /usr/bin local && printf /usr/bin then
+		awk cd -eu "$@" | --verbose local && "$@" x=1 sed
+x=1 cd grep 'quoted text' ${HOME} | --verbose readonly
+then $(pwd) $(pwd) 'quoted text' -eu echo -eu 'quoted text' 2>/dev/null
+	x=1 sed cd 2>/dev/null
+	'quoted text' $(pwd) | --verbose then /usr/bin x=1 --verbose | local ${HOME}
+	--verbose 2>/dev/null readonly 'quoted text' local done export export readonly
+		${HOME} then test "$@" 'quoted text' echo --verbose
+awk /usr/bin then /usr/bin "$1" $(pwd) export ${HOME}
+x=1 | awk readonly 'quoted text' && x=1 && echo
+/usr/bin printf 'quoted text' "$1" "$1" test -eu
+		"$@" local "$@" "$1" ${HOME} grep then cd echo export local x=1 "$@" echo -eu
+	export local x=1 readonly cd "$@" | ${HOME} printf
+cd && x=1 "$1" --verbose 'quoted text'
+		printf ${HOME} awk awk awk test local test
+	sed --verbose "$@" | 'quoted text' | x=1 test x=1 -eu awk
+		"$1" x=1 export && && "$1"
+		&& --verbose export /usr/bin test grep readonly
+		x=1 $(pwd) x=1 x=1 awk echo -eu echo readonly ${HOME}
+	'quoted text' 'quoted text' "$1"
+		local readonly 'quoted text' -eu 'quoted text'
+	sed printf -eu | /usr/bin readonly --verbose
+2>/dev/null printf -eu done ${HOME} && 2>/dev/null awk ${HOME} readonly done cd
+	sed local sed readonly cd -eu $(pwd) | readonly
+		'quoted text' -eu 2>/dev/null cd 'quoted text' echo local done
+		awk printf test | printf "$@"
+'quoted text' "$@" export printf awk echo
+done test /usr/bin awk test
+${HOME} export --verbose && -eu test
+	${HOME} grep grep | | awk done && done test &&
+	awk test sed 2>/dev/null printf
+printf done -eu 'quoted text' && then -eu
+| x=1 -eu grep sed done cd /usr/bin grep readonly sed | done export 'quoted text'
+	grep printf export x=1 2>/dev/null 'quoted text'
+sed grep "$@" local 2>/dev/null --verbose
+/usr/bin /usr/bin cd | x=1 echo
+	"$1" readonly grep then sed ${HOME} grep --verbose
+	2>/dev/null /usr/bin sed ${HOME} echo "$1" 'quoted text'
+		sed $(pwd) then sed "$1" 2>/dev/null /usr/bin -eu readonly done
+	'quoted text' readonly sed "$1" "$1" echo "$1" echo
+$(pwd) then cd done --verbose ${HOME}
+&& done x=1 local /usr/bin | | 'quoted text' 2>/dev/null awk echo "$1" 'quoted text'
+	-eu sed readonly 2>/dev/null cd test 'quoted text'
+	grep | then -eu export export ${HOME} export "$1"
+	"$1" 2>/dev/null sed | | | done /usr/bin $(pwd) 2>/dev/null ${HOME} then
+	done grep done 'quoted text' $(pwd) "$1" -eu ${HOME} ${HOME} local
+		then /usr/bin sed sed sed | --verbose 2>/dev/null ${HOME} $(pwd) "$@" 'quoted text'
+	cd | && $(pwd) grep cd "$1"
+		-eu awk | | sed "$1" && printf && readonly export | local /usr/bin echo --verbose
+"$1" sed export x=1 awk export
+		"$@" cd local "$@" cd --verbose grep cd test "$@" $(pwd) $(pwd)
+$(pwd) grep grep cd awk 2>/dev/null "$1" && printf /usr/bin awk "$1"
+	x=1 done "$1" printf $(pwd) 2>/dev/null
+export | awk 2>/dev/null local $(pwd) export done then sed sed /usr/bin
+	$(pwd) then && "$@" local && $(pwd) ${HOME} | "$@" sed $(pwd)
+	test sed sed awk local --verbose awk test local
+		$(pwd) 'quoted text' 'quoted text' sed done cd --verbose export then done echo grep
+"$1" x=1 $(pwd) "$1" 'quoted text' export
+		"$@" $(pwd) | sed export | then | x=1 /usr/bin
+	then sed /usr/bin $(pwd) && $(pwd) printf -eu
+	| x=1 /usr/bin grep cd sed echo cd -eu | export export printf
+"$1" && echo && printf x=1 && -eu -eu $(pwd) 2>/dev/null --verbose "$1" -eu then
+		"$1" $(pwd) "$@" readonly "$@" done done | readonly && /usr/bin export then then
+		export -eu printf local ${HOME} 2>/dev/null 2>/dev/null
+		'quoted text' then cd printf | --verbose | "$1" "$1"
+	sed done export "$1" --verbose /usr/bin echo test "$@"
+		--verbose --verbose grep local
+$(pwd) ${HOME} | "$@" sed grep sed echo cd
+echo | printf 2>/dev/null 'quoted text' 2>/dev/null
+		x=1 ${HOME} awk done && 'quoted text' x=1 ${HOME} printf --verbose printf done
+	/usr/bin x=1 'quoted text' --verbose
+		export readonly | | && $(pwd) cd /usr/bin --verbose cd -eu --verbose | echo && test
+	2>/dev/null done /usr/bin then local then ${HOME} echo | then $(pwd) readonly
+sed --verbose --verbose sed "$@" export $(pwd) printf
+	| awk cd x=1 test sed grep
+		local cd -eu readonly --verbose cd &&
+	printf --verbose --verbose $(pwd)
+/usr/bin readonly "$1" 2>/dev/null test x=1 2>/dev/null x=1 "$1" /usr/bin
+	printf sed --verbose /usr/bin printf export cd ${HOME}
+${HOME} sed then 2>/dev/null test grep x=1 awk 2>/dev/null
+readonly sed cd cd x=1 /usr/bin done local --verbose
+printf test echo readonly $(pwd) 'quoted text'
+		'quoted text' then printf $(pwd) --verbose | local "$1" ${HOME} 'quoted text'
+then readonly done cd /usr/bin
+--verbose 2>/dev/null x=1 | then x=1 2>/dev/null cd done ${HOME} 2>/dev/null
+awk echo echo awk && 'quoted text' export
+x=1 --verbose "$@" readonly ${HOME} cd printf | /usr/bin readonly
+	printf /usr/bin 'quoted text' export
+		awk && done awk --verbose -eu x=1 readonly then ${HOME} readonly | 'quoted text'
+		export ${HOME} 'quoted text' local
+	sed done readonly printf printf 2>/dev/null sed "$1" 'quoted text'
+printf -eu && printf export
+&& test "$1" $(pwd) export 2>/dev/null
+	test done --verbose 2>/dev/null
+	local 'quoted text' | awk --verbose grep cd && test $(pwd) echo ${HOME}
+2>/dev/null 2>/dev/null -eu
+		readonly awk done cd 2>/dev/null --verbose x=1 "$@"
+	| 'quoted text' local $(pwd) awk -eu printf then awk
+	printf ${HOME} grep printf
+		/usr/bin grep x=1 $(pwd) then test 2>/dev/null readonly awk && --verbose /usr/bin
+		x=1 readonly ${HOME} 'quoted text' readonly
+then cd cd x=1 echo x=1
+/usr/bin -eu -eu | | /usr/bin && x=1 /usr/bin 'quoted text'
+		/usr/bin echo sed 2>/dev/null
+		echo printf local "$@" awk readonly done && 'quoted text'
+	"$@" local export "$1"
+	&& --verbose awk test 2>/dev/null
+	test --verbose /usr/bin /usr/bin local "$1" sed $(pwd) ${HOME} 2>/dev/null
+		grep then -eu "$1" 'quoted text' echo | printf $(pwd) &&
+		/usr/bin 2>/dev/null 2>/dev/null
+| printf 2>/dev/null local "$@" echo cd "$@"
+		&& "$1" test x=1 sed && local printf "$@" 2>/dev/null 2>/dev/null
+--verbose sed 2>/dev/null 'quoted text' 2>/dev/null cd -eu x=1
+awk ${HOME} export --verbose done printf 'quoted text' echo then | sed -eu export
+		printf --verbose export
+		| --verbose x=1 cd sed --verbose "$@" "$1" local $(pwd) awk | -eu $(pwd)
+printf then grep -eu "$@" then x=1 | | then $(pwd) awk printf printf
+	printf && awk | | /usr/bin
+		test awk test readonly done sed && ${HOME}
+readonly && local export $(pwd) && -eu "$@" echo
+"$@" ${HOME} echo x=1 -eu test "$1" grep "$1" then export printf
+		${HOME} local ${HOME} 'quoted text' done | && echo && "$1" sed sed printf --verbose
+		x=1 grep cd --verbose then ${HOME} --verbose done local printf | 'quoted text'
+printf done grep echo "$@" /usr/bin
+		-eu sed test x=1 sed done && grep |
+		printf done "$1" 'quoted text'
+		x=1 grep sed $(pwd) 'quoted text' cd
+		then awk awk test export echo printf grep sed grep
+	${HOME} readonly printf --verbose local export printf test -eu awk printf
+	then then && local "$1" export
+		"$@" /usr/bin | -eu && grep && grep
+	export -eu done -eu test
+then x=1 local cd "$@" --verbose 'quoted text' "$1"
+		export ${HOME} readonly export sed $(pwd) readonly "$@"
+	--verbose --verbose echo awk | sed "$1" $(pwd) echo local awk
+printf readonly "$@" then 'quoted text' -eu | ${HOME} $(pwd) echo
+		local "$1" grep "$1" echo sed x=1 ${HOME} export
+		/usr/bin grep x=1 local --verbose
+printf local done 2>/dev/null | "$@" awk grep
+	2>/dev/null local | | | then | readonly | 2>/dev/null
+		&& cd sed -eu test cd sed cd | | ${HOME} 2>/dev/null then test /usr/bin export
+sed && local 2>/dev/null "$@" "$@" done x=1 $(pwd) 'quoted text'
+export then /usr/bin test ${HOME} readonly
+	-eu cd readonly "$@" printf
+		x=1 2>/dev/null /usr/bin printf export echo then $(pwd) | --verbose grep awk
+cd awk 2>/dev/null && export $(pwd) ${HOME} "$1" $(pwd) readonly "$1"
+awk awk readonly $(pwd) readonly awk | awk echo -eu
+done /usr/bin | $(pwd) done readonly /usr/bin /usr/bin $(pwd) test $(pwd)
+		2>/dev/null printf --verbose
+	echo sed "$@" 'quoted text' ${HOME}
+		sed test sed 2>/dev/null awk "$@" awk printf awk local
+printf grep printf test readonly sed /usr/bin awk grep /usr/bin ${HOME} done sed
+		-eu 'quoted text' 'quoted text' local awk
+readonly sed local then x=1 then readonly $(pwd) local echo sed
+printf local && grep && printf "$1" grep echo --verbose
+		grep cd export done then cd export $(pwd) sed ${HOME} | /usr/bin sed
+		cd "$1" x=1 grep awk export "$@" sed --verbose "$1" $(pwd) $(pwd)
+		'quoted text' && export test -eu readonly 'quoted text' | | "$1"
+awk grep export awk echo
+		printf x=1 $(pwd) echo sed -eu x=1 /usr/bin printf awk 'quoted text' "$@" test test
+		printf /usr/bin cd 2>/dev/null
+printf grep cd "$@" echo "$1" --verbose $(pwd) test | --verbose
+		done && && --verbose echo 'quoted text' $(pwd)
+grep --verbose sed cd $(pwd) && sed test ${HOME}
+		local echo $(pwd) /usr/bin sed cd done local test
+echo then sed | --verbose awk awk |
+	awk /usr/bin then local x=1 echo local x=1 grep /usr/bin /usr/bin readonly awk
+-eu "$@" sed local then
+awk 2>/dev/null "$1" then then "$@" printf /usr/bin done printf printf
+	awk done && ${HOME} && readonly "$1" sed export
+| grep "$@" "$@" local /usr/bin export export ${HOME} && && x=1 "$1" |
+		--verbose $(pwd) "$1" echo "$1" "$1" $(pwd) local 'quoted text' $(pwd) export
+		| "$@" -eu "$1" ${HOME} | export "$@" && /usr/bin "$@" awk cd
+		test printf grep x=1 --verbose "$1" | printf readonly test
+		local printf $(pwd) awk | 2>/dev/null ${HOME} grep grep "$1" local awk
+local --verbose -eu 2>/dev/null ${HOME} export then grep | $(pwd)
+"$@" /usr/bin awk && awk done
+	echo sed x=1 --verbose "$@" cd 'quoted text'
+$(pwd) x=1 'quoted text' done 'quoted text' ${HOME} echo
+	| | printf then 2>/dev/null export
+		echo "$@" ${HOME} awk
+	&& awk 2>/dev/null awk -eu export echo $(pwd)
+	--verbose && -eu echo ${HOME} done --verbose && -eu --verbose readonly
+	'quoted text' local | export 'quoted text'
+		printf "$1" printf x=1 && cd 'quoted text' && export $(pwd)
+		echo | --verbose /usr/bin $(pwd) awk export sed
+readonly export && x=1 | 2>/dev/null 2>/dev/null then $(pwd) "$1"
+	sed done "$1" grep export 2>/dev/null local echo "$1" 2>/dev/null
+	echo "$1" "$1" echo echo x=1 --verbose "$1" | export done export
+		done "$@" -eu printf x=1 "$@" && sed -eu $(pwd) &&
+	then done 2>/dev/null cd | /usr/bin sed | ${HOME}
+		"$1" x=1 export test $(pwd) echo
+local then x=1 "$@" awk awk echo then ${HOME} -eu sed printf printf
+local export && x=1 awk printf "$@" test 2>/dev/null printf
+	readonly /usr/bin /usr/bin test $(pwd) local
+	'quoted text' 'quoted text' | /usr/bin -eu grep sed
+		-eu test -eu x=1 local
+	test local "$@" printf "$1" -eu local -eu sed 2>/dev/null
+--verbose | ${HOME} local echo 2>/dev/null | printf readonly test printf
+	sed $(pwd) x=1 readonly
+	${HOME} then "$@" $(pwd) sed -eu test "$@" && $(pwd)
+		${HOME} --verbose local "$1" local /usr/bin /usr/bin "$@" | sed | cd local
+	awk local | /usr/bin "$@" && $(pwd) then then export
+"$@" -eu $(pwd) ${HOME} 2>/dev/null $(pwd) done echo ${HOME} --verbose
+	$(pwd) awk grep sed --verbose awk "$1" then "$1" x=1 export sed then local
+awk printf local 'quoted text' cd readonly grep --verbose /usr/bin local
+		cd 'quoted text' 2>/dev/null readonly $(pwd) x=1
+	then --verbose echo /usr/bin export 'quoted text' done awk grep
+	'quoted text' then test 2>/dev/null $(pwd) local 'quoted text' ${HOME}
+	$(pwd) x=1 printf ${HOME} printf then grep ${HOME} $(pwd) cd $(pwd)
+	--verbose readonly printf then
+	"$@" printf "$1" printf done cd && test 2>/dev/null readonly test
+		${HOME} awk echo done printf && done | grep readonly /usr/bin echo printf x=1
+	${HOME} printf /usr/bin "$@" awk readonly | test grep
+printf printf "$1" then grep --verbose "$@" printf
+	export readonly cd x=1 grep
+		test then printf x=1 "$@" printf
+/usr/bin awk && done awk x=1 printf 'quoted text'
+	${HOME} then test "$1" "$1" awk x=1 $(pwd)
+		&& awk done test --verbose "$1" /usr/bin then && sed && readonly --verbose printf
+	test 'quoted text' /usr/bin ${HOME} -eu
+	readonly x=1 --verbose | echo readonly export ${HOME} local | $(pwd) then
+	"$@" printf -eu cd 'quoted text' && printf grep 2>/dev/null
+		test awk && $(pwd) 'quoted text' | export grep && echo then "$1" cd
+		"$@" -eu test ${HOME} -eu then /usr/bin ${HOME} $(pwd) | export then done
+	--verbose "$@" cd awk x=1
+		grep "$@" 'quoted text' then "$@" printf readonly -eu ${HOME} "$1" printf
+$(pwd) /usr/bin -eu ${HOME} cd test "$1"
+		'quoted text' sed grep -eu 2>/dev/null 2>/dev/null $(pwd)
+	/usr/bin /usr/bin "$1" && && awk /usr/bin echo && "$1" sed then --verbose
+	sed 2>/dev/null export local done 2>/dev/null then $(pwd)
+		"$1" grep awk $(pwd) -eu printf 2>/dev/null
+	sed sed 2>/dev/null "$1" x=1 x=1 --verbose 2>/dev/null x=1 local printf printf
+		local /usr/bin 2>/dev/null 'quoted text'
+	grep echo cd --verbose echo && --verbose
+	then printf | --verbose ${HOME} /usr/bin x=1 2>/dev/null
+		x=1 | x=1 local x=1 then -eu &&
+	$(pwd) 'quoted text' done then local "$1" cd "$1" sed
+'quoted text' ${HOME} --verbose local done test /usr/bin local /usr/bin "$1" &&
+printf then ${HOME} "$@" printf
+readonly $(pwd) x=1 | test sed done 2>/dev/null
+	then | readonly | printf /usr/bin | -eu $(pwd) ${HOME} | cd 'quoted text'
+/usr/bin sed echo | --verbose "$@" cd printf local test cd ${HOME}
+	--verbose cd ${HOME} 'quoted text' grep -eu 'quoted text' /usr/bin then echo
+	done /usr/bin echo test done
+		readonly 2>/dev/null done "$1" echo 'quoted text'
+/usr/bin test done cd test && --verbose
+	"$1" --verbose local local cd "$@" ${HOME} 2>/dev/null
+	readonly -eu awk -eu cd local cd ${HOME} test echo
+		| 'quoted text' echo test awk printf | && x=1 grep grep ${HOME} printf ${HOME}
+		$(pwd) && 'quoted text'
+		"$@" x=1 export test /usr/bin
+		$(pwd) "$@" /usr/bin test
+		done -eu /usr/bin readonly
+	2>/dev/null /usr/bin -eu 2>/dev/null $(pwd) then ${HOME} sed "$@" printf 'quoted text'
+	readonly echo && 'quoted text'
+"$@" "$@" 'quoted text' ${HOME} 2>/dev/null
+	export printf printf --verbose done readonly --verbose
+	local --verbose test "$@" awk readonly $(pwd) ${HOME} printf printf then 'quoted text'
+export /usr/bin "$@" -eu --verbose then test --verbose --verbose ${HOME}
+then | then local --verbose local 'quoted text' -eu "$@" sed -eu
+cd test x=1 local ${HOME} "$1" "$@" sed then x=1 test grep cd $(pwd)
+-eu "$1" local --verbose 'quoted text' ${HOME}
+readonly /usr/bin /usr/bin
+	grep local x=1 echo printf export sed sed then -eu x=1 cd && then done
+--verbose $(pwd) "$1" export 2>/dev/null
+		'quoted text' | "$1" x=1 local echo $(pwd) sed $(pwd) /usr/bin local -eu awk
+"$@" 2>/dev/null -eu /usr/bin awk grep test $(pwd) done test --verbose grep sed
+echo echo 2>/dev/null awk 'quoted text'
+	"$@" --verbose "$1" -eu x=1
+	local "$@" local /usr/bin | -eu $(pwd) 2>/dev/null printf $(pwd)
+	-eu "$@" awk ${HOME} awk export local && --verbose
+awk awk | 2>/dev/null 2>/dev/null printf /usr/bin
+sed printf $(pwd) x=1 done x=1 --verbose awk local 2>/dev/null sed grep
+		done done $(pwd) printf sed sed 'quoted text' sed $(pwd)
+		test cd done printf ${HOME}
+	$(pwd) test 2>/dev/null
+	2>/dev/null grep grep ${HOME}
+		then local done 2>/dev/null done awk readonly ${HOME} grep then awk -eu && readonly
+		then grep 'quoted text' 2>/dev/null then /usr/bin
+	${HOME} -eu $(pwd) export ${HOME} cd sed sed ${HOME} x=1 cd then
+--verbose && awk ${HOME} -eu then 'quoted text'
+	sed readonly done grep then --verbose -eu x=1 2>/dev/null cd 2>/dev/null
+	test awk grep cd readonly local cd ${HOME} awk export
+		x=1 "$@" "$1" printf sed echo "$@" local "$@" ${HOME} export sed --verbose
+	grep export ${HOME} --verbose /usr/bin 2>/dev/null awk grep | then 'quoted text'
+		done then awk "$1" sed sed 2>/dev/null sed
+		-eu "$1" $(pwd) | ${HOME} 2>/dev/null ${HOME} 2>/dev/null readonly
+	| ${HOME} local /usr/bin --verbose "$@" printf export | && 2>/dev/null ${HOME}
+"$1" | done 'quoted text' printf local then "$1"
+local /usr/bin $(pwd) then printf && sed test export 2>/dev/null
+&& | printf "$1" test x=1 test x=1 echo --verbose /usr/bin
+-eu readonly then ${HOME} $(pwd) done then test "$@" grep cd grep "$@"
+	'quoted text' -eu $(pwd) | readonly && -eu | "$@" readonly echo ${HOME} &&
+		-eu "$@" grep $(pwd) "$@" echo 2>/dev/null done $(pwd) 'quoted text'
+		-eu | done --verbose awk x=1 test echo | sed then && export grep sed done
+	awk then cd cd readonly && awk -eu /usr/bin done 'quoted text'
+x=1 awk sed awk 2>/dev/null then awk "$@" "$@"
+		$(pwd) sed "$1" 'quoted text' | cd $(pwd) sed
+	sed then | export 2>/dev/null echo --verbose "$1" -eu $(pwd) done grep export
+		x=1 cd test printf sed 2>/dev/null export done && grep local then
+	export local "$@" sed x=1 cd awk grep -eu "$1" ${HOME}
+sed then --verbose ${HOME} printf
+	$(pwd) printf --verbose && echo "$@" export -eu /usr/bin -eu export sed test
+	"$1" 2>/dev/null done "$@" export && 'quoted text' local awk test grep cd then 2>/dev/null
+	echo printf "$1" printf export readonly done echo
+		then done 'quoted text'
+	done echo export done "$1" local x=1 export cd $(pwd)
+	done | printf cd "$1" 'quoted text' -eu echo then sed | && --verbose
+"$1" | local "$@" 'quoted text' printf --verbose | sed ${HOME}
+	--verbose 2>/dev/null
+echo test cd -eu --verbose && --verbose x=1 $(pwd) --verbose
+local -eu sed echo ${HOME} 'quoted text' awk sed then test printf
+	-eu "$1" "$1" | $(pwd) awk printf ${HOME} printf ${HOME} export && local
+${HOME} --verbose --verbose
+	| printf printf --verbose test awk && awk
+		echo && echo cd 'quoted text' "$1" $(pwd) | "$@" "$1" test "$@" echo $(pwd)
+		x=1 export ${HOME} "$1" cd printf
+	echo "$@" then export "$1" 'quoted text' then cd x=1 test sed test -eu
+sed readonly --verbose && readonly test readonly export
+		test "$1" --verbose "$@" readonly awk cd test then $(pwd) then echo
+		-eu sed "$@" "$1" 'quoted text' 'quoted text'
+| "$1" readonly cd && ${HOME} -eu grep then ${HOME} export readonly
+/usr/bin x=1 && $(pwd) 'quoted text'
+done x=1 'quoted text' done ${HOME} "$1" cd awk echo done ${HOME}
+		&& export local 'quoted text' ${HOME} ${HOME} && -eu x=1
+		awk grep /usr/bin 2>/dev/null $(pwd) cd local
+		-eu test test ${HOME} test --verbose printf && sed local local ${HOME} /usr/bin
+	--verbose readonly "$@" --verbose printf --verbose
+	--verbose ${HOME} sed cd then --verbose && local --verbose
+		test --verbose --verbose echo cd then "$@" 'quoted text' then && done -eu printf
+		/usr/bin --verbose done $(pwd) && test export -eu 2>/dev/null
+sed /usr/bin echo | /usr/bin ${HOME} "$@" "$1" "$@" && then | export
+		echo -eu && $(pwd) echo then 2>/dev/null --verbose 2>/dev/null
+	--verbose -eu && ${HOME} $(pwd) 'quoted text' "$1" && /usr/bin "$1" test 2>/dev/null
+/usr/bin cd ${HOME} /usr/bin x=1 "$1" x=1 2>/dev/null done
+		sed then /usr/bin && printf cd sed "$@" cd "$1" 2>/dev/null done cd
+		awk x=1 awk $(pwd) && readonly grep | --verbose cd export then -eu | grep "$1"
+	${HOME} awk $(pwd) then /usr/bin "$1" -eu sed
+		"$1" 2>/dev/null printf -eu readonly done grep awk --verbose echo
+	readonly sed x=1 test echo done local && --verbose grep export test | /usr/bin
+local | "$@" --verbose readonly | && /usr/bin awk readonly "$1" done $(pwd)
+	"$@" test ${HOME} sed --verbose
+	echo done $(pwd) /usr/bin --verbose
+	sed cd grep --verbose /usr/bin
+--verbose "$1" awk export
+	x=1 grep --verbose /usr/bin $(pwd) "$@" x=1 sed -eu printf 2>/dev/null
+	grep readonly "$@" then "$@" awk
+sed --verbose cd done readonly && && -eu ${HOME} cd 2>/dev/null
+	local echo awk && sed x=1 readonly ${HOME} export cd /usr/bin awk then 2>/dev/null
+	awk $(pwd) $(pwd) export "$1"
+		/usr/bin "$@" && && 2>/dev/null
+		local then readonly | grep $(pwd) then
+readonly && awk ${HOME} sed ${HOME} -eu x=1 sed echo "$1" 'quoted text' &&
+	$(pwd) export cd "$@" ${HOME} export awk local
+		then grep -eu sed sed test readonly --verbose cd
+"$@" cd ${HOME} then cd readonly x=1 grep sed printf
+	"$1" "$@" --verbose local test
+		-eu grep sed sed then 2>/dev/null | test
+	awk /usr/bin done $(pwd) local printf readonly readonly awk | $(pwd) readonly
+	test grep local done printf | 'quoted text'
+| sed printf --verbose awk printf && export ${HOME} -eu local awk local cd sed
+		cd "$@" -eu $(pwd) ${HOME} "$@" export printf then
+echo test export "$@"
+	${HOME} x=1 --verbose cd --verbose $(pwd) awk test 2>/dev/null cd printf then
+		then sed | echo echo "$@" && done | $(pwd)
+awk $(pwd) 'quoted text' done done then grep | export grep
+	awk local ${HOME} ${HOME} cd export
+| readonly cd then sed 'quoted text' | --verbose
+		awk 2>/dev/null | done
+		2>/dev/null --verbose echo export 2>/dev/null
+	readonly done awk export cd export
+--verbose local x=1 ${HOME} x=1 printf && /usr/bin 'quoted text'
+		awk "$1" ${HOME} local export
+	cd echo --verbose | 'quoted text' x=1 "$@" awk $(pwd)
+		sed $(pwd) ${HOME} x=1 $(pwd) done --verbose export x=1 "$@"
+grep $(pwd) readonly export then
+	'quoted text' "$@" test then cd test sed x=1 "$@" awk echo
+		sed echo sed local 'quoted text'
+		awk echo echo | grep "$1" | "$@" local cd 'quoted text'
+	&& /usr/bin printf | then grep "$@"
+	"$1" readonly --verbose printf grep printf echo /usr/bin printf awk |
+test export "$1" done ${HOME} --verbose cd "$@" x=1 awk 'quoted text' --verbose
+		printf 'quoted text' grep
+'quoted text' local "$1" test grep readonly cd test test x=1 x=1 'quoted text'
+$(pwd) printf "$@" "$1" | | /usr/bin
+		echo --verbose 2>/dev/null
+		2>/dev/null then export cd x=1 && ${HOME} printf "$@" sed "$@"
+echo done "$1" test then sed local && "$@" export
+$(pwd) --verbose awk /usr/bin x=1 ${HOME} --verbose
+export printf awk -eu readonly 2>/dev/null done
+		export 2>/dev/null grep cd "$@" sed -eu 'quoted text'
+/usr/bin ${HOME} then done 'quoted text' x=1 "$@" "$1" x=1 awk 'quoted text'
+	&& awk echo x=1 export | x=1 printf echo export done
+	export 'quoted text' --verbose $(pwd) echo "$@" then
+	/usr/bin readonly cd awk "$1" --verbose 'quoted text' done
+| "$1" | x=1 readonly && "$1" $(pwd) grep export 'quoted text'
+	local | x=1 test 2>/dev/null local 'quoted text'
+		${HOME} | readonly x=1 cd "$@" 2>/dev/null --verbose echo
+cd && | --verbose test printf printf "$@" export grep local printf $(pwd)
+	${HOME} grep $(pwd) local "$@"
+local echo printf $(pwd) cd readonly local 'quoted text'
+${HOME} ${HOME} /usr/bin x=1
+	/usr/bin grep readonly | grep
+		/usr/bin "$1" cd sed "$1" 2>/dev/null done export && 2>/dev/null echo |
+-eu test grep "$1" 'quoted text'
+		"$@" export "$@" printf --verbose printf /usr/bin sed "$1" | 'quoted text'
+		-eu export awk x=1 export awk
+grep ${HOME} 2>/dev/null done "$1" cd export
+	--verbose "$@" sed export done then | 2>/dev/null
+sed readonly $(pwd) $(pwd) awk awk "$@"
+	&& export "$@" grep grep /usr/bin "$1" "$@"
+	printf grep -eu test export $(pwd) 'quoted text' &&
+export 'quoted text' test 2>/dev/null
+		local "$1" then -eu readonly then 2>/dev/null done
+		then ${HOME} awk 2>/dev/null -eu local readonly
+	/usr/bin grep 2>/dev/null grep 2>/dev/null awk printf
+	"$@" grep local readonly printf | printf done grep
+	/usr/bin local printf "$1" | sed test
+printf readonly test -eu && && 2>/dev/null export echo readonly --verbose
+export echo sed && /usr/bin x=1 readonly cd "$1" ${HOME} | x=1 $(pwd) | &&
+	awk x=1 x=1 grep | sed printf local export local readonly 'quoted text'
+	grep "$1" sed 2>/dev/null echo export local
+		x=1 then readonly then test echo -eu "$@" printf test --verbose 'quoted text'
+		done --verbose echo ${HOME}
+	x=1 sed | test export x=1 $(pwd) echo --verbose grep 2>/dev/null
+	2>/dev/null "$@" $(pwd) ${HOME} readonly
+		test export printf $(pwd) export echo test awk ${HOME} 2>/dev/null readonly local
+grep sed then printf echo "$@" then 'quoted text' local grep printf
+		x=1 x=1 sed printf then "$@" -eu cd done ${HOME} then -eu "$@" x=1
+	'quoted text' "$1" readonly -eu grep then "$1" awk grep
+	| && sed test done export 'quoted text' --verbose cd local
+--verbose echo x=1 "$1" grep /usr/bin sed |
+		test then "$1" grep printf 'quoted text' /usr/bin then 'quoted text'
+	local then --verbose cd local | awk
+		2>/dev/null awk 'quoted text'
+readonly && cd test /usr/bin --verbose awk "$@" test $(pwd) /usr/bin
+x=1 x=1 awk x=1 -eu /usr/bin
+		$(pwd) x=1 sed --verbose echo 'quoted text' local "$@" test | "$@" readonly
+2>/dev/null x=1 done printf export cd
+	x=1 grep $(pwd) x=1 x=1 export then 2>/dev/null printf cd readonly "$@" local
+	$(pwd) "$1" local | "$1"
+| export readonly ${HOME} ${HOME} -eu local x=1 grep grep "$1" local
+	grep | local | export grep ${HOME}
+		export sed 'quoted text' "$@" "$1" then && done "$@"
+		local "$@" local $(pwd) readonly printf printf -eu 'quoted text'
+		sed echo "$@" "$1" grep grep ${HOME} ${HOME} 2>/dev/null -eu ${HOME} $(pwd)
+		test local echo ${HOME} --verbose "$@" -eu /usr/bin awk done 'quoted text'
+2>/dev/null 2>/dev/null sed 2>/dev/null /usr/bin done sed grep
+echo "$1" "$1" 'quoted text'
+		test $(pwd) local ${HOME}
+		$(pwd) -eu export && awk "$1" readonly
+		cd printf local awk printf 'quoted text' && done test
+then echo readonly && done test sed -eu local done awk test --verbose
+	"$@" "$@" ${HOME} && && | ${HOME}
+	done $(pwd) -eu --verbose then grep
+	then && readonly awk
+"$1" local "$1" 2>/dev/null awk
+		&& cd x=1 "$@" "$@" test done ${HOME}
+		'quoted text' grep done printf test -eu sed "$@" test
+	/usr/bin "$1" local 'quoted text' $(pwd) 2>/dev/null awk $(pwd) x=1 done grep
+		local && && "$@" 2>/dev/null printf 2>/dev/null cd | sed sed
+	"$@" 'quoted text' | cd printf --verbose cd | awk printf local
+	readonly x=1 --verbose $(pwd) grep then 'quoted text' | grep "$1" cd
+done done -eu readonly awk x=1 'quoted text'
+		awk "$1" && /usr/bin 'quoted text' 'quoted text'
+	printf done 'quoted text' grep local echo "$1" ${HOME}
+	export printf --verbose awk
+local 'quoted text' printf then --verbose sed then readonly
+		echo then && then export "$1" $(pwd) test
+${HOME} && readonly readonly
+	| local 'quoted text' "$@" --verbose /usr/bin cd --verbose local test -eu sed
+		'quoted text' 2>/dev/null cd x=1 && ${HOME} --verbose
+		echo ${HOME} "$@" x=1 awk 'quoted text' export
+local "$1" echo && local cd /usr/bin grep ${HOME} ${HOME} echo printf "$@"
+	${HOME} printf done local readonly
+		sed local local test /usr/bin | | test
+		sed x=1 2>/dev/null export then /usr/bin
+export local done local local grep "$1" echo | ${HOME} --verbose $(pwd) ${HOME}
+	printf -eu | $(pwd) $(pwd)
+	readonly ${HOME} && done test export ${HOME} -eu /usr/bin x=1 x=1 export
+local "$1" echo --verbose test grep 'quoted text'
+2>/dev/null "$1" 'quoted text'
+&& --verbose sed x=1 /usr/bin "$1" cd local --verbose &&
+x=1 grep x=1 -eu awk test && local local && awk "$1"
+	'quoted text' then export /usr/bin local then
+then && "$1" 'quoted text' $(pwd) export
+	&& $(pwd) | export done x=1 && readonly then
+		grep cd test ${HOME} "$1" sed local awk sed grep sed $(pwd)
+		/usr/bin test $(pwd) "$@" printf sed printf --verbose 2>/dev/null /usr/bin echo
+		done x=1 ${HOME} 2>/dev/null printf x=1 && export ${HOME} awk x=1 --verbose
+	readonly done export test x=1
+x=1 x=1 echo done test printf 2>/dev/null
+	echo $(pwd) readonly 2>/dev/null 2>/dev/null printf | ${HOME} /usr/bin sed -eu
+		local awk cd && 2>/dev/null 2>/dev/null local | "$1" "$@" ${HOME} |
+	x=1 "$@" cd | sed local | awk readonly --verbose | grep
+x=1 /usr/bin printf | test awk -eu sed grep then
+		export /usr/bin | 'quoted text'
+		--verbose readonly local done readonly cd -eu -eu readonly
+| echo grep | export awk sed export 2>/dev/null
+	/usr/bin 'quoted text' echo "$1" | export awk readonly printf
+	cd | "$1" "$1" && 'quoted text'
+	$(pwd) printf local readonly test x=1 'quoted text' grep export x=1
+		printf readonly 'quoted text' x=1
+		then then 'quoted text' echo grep echo | "$@"
+		readonly ${HOME} /usr/bin && printf printf
+	export -eu awk cd | then "$@" test ${HOME} cd x=1 test ${HOME} awk test awk x=1
+"$@" grep echo "$1" awk done && "$1" 'quoted text' -eu export
+| done "$@" 2>/dev/null && 2>/dev/null
+	local echo done sed 2>/dev/null $(pwd)
+	x=1 echo test ${HOME} awk 2>/dev/null "$1" 2>/dev/null sed "$@"
+export export awk --verbose readonly
+2>/dev/null test cd printf export 2>/dev/null 'quoted text' readonly
@@ -0,0 +1,2001 @@
+		&& --verbose ${HOME} | test local done x=1 --verbose
+x=1 x=1 && done awk readonly -eu local && ${HOME}
+	'quoted text' printf &&
+		sed printf /usr/bin "$1" --verbose $(pwd) |
+	${HOME} test echo cd 2>/dev/null export local grep test
+echo then 'quoted text' local 2>/dev/null done 'quoted text' /usr/bin
+	"$@" done && echo | done "$@" local grep then then | | ${HOME}
+		local local ${HOME} && x=1 ${HOME} then -eu
+/usr/bin then awk readonly echo echo
+	cd $(pwd) "$@" $(pwd) x=1 --verbose "$@" printf "$@" done
+		$(pwd) "$1" readonly printf echo
+		export echo ${HOME} && cd 2>/dev/null awk "$@"
+		${HOME} cd printf && && then sed awk test /usr/bin readonly "$@" |
+		export local cd test ${HOME}
+		local then 'quoted text'
+	awk "$@" && awk && /usr/bin x=1 | done /usr/bin
+		x=1 2>/dev/null echo --verbose 'quoted text' && printf $(pwd) local /usr/bin export
+printf | grep 2>/dev/null $(pwd) local ${HOME} echo -eu awk printf x=1 && test
+		2>/dev/null then test -eu
+		x=1 awk sed && local ${HOME} "$@" then "$@" $(pwd) /usr/bin --verbose
+then && && ${HOME} printf "$1"
+		sed --verbose -eu --verbose cd "$@" $(pwd) | cd && local --verbose then
+"$1" -eu "$1" /usr/bin grep /usr/bin printf local "$1" local printf | cd -eu local
+	&& | -eu printf 2>/dev/null grep export 2>/dev/null
+-eu "$1" --verbose printf readonly
+		test /usr/bin 2>/dev/null local --verbose
+		awk printf $(pwd) test done grep ${HOME} -eu cd -eu $(pwd)
+		sed grep then done local
+awk | cd echo awk | sed then readonly
+export -eu /usr/bin ${HOME} --verbose readonly /usr/bin
+	--verbose /usr/bin -eu ${HOME} && 2>/dev/null sed && done then then ${HOME}
+export export local "$1" 2>/dev/null /usr/bin "$1" readonly --verbose cd echo
+		cd awk cd /usr/bin cd export grep $(pwd) -eu -eu 2>/dev/null
+		"$1" ${HOME} $(pwd) done | "$1" "$1" x=1 2>/dev/null awk | 'quoted text'
+		| "$@" -eu sed 2>/dev/null | export ${HOME} sed grep -eu x=1 grep "$1"
+echo 'quoted text' $(pwd) | 'quoted text' awk ${HOME} /usr/bin echo "$1" /usr/bin
+-eu sed printf | ${HOME} --verbose echo && 2>/dev/null "$@"
+done "$@" test sed | -eu 'quoted text' echo test -eu test x=1 then "$@"
+		$(pwd) --verbose grep test x=1 $(pwd) $(pwd) 2>/dev/null ${HOME} "$1"
+	done x=1 x=1 /usr/bin $(pwd) 2>/dev/null
+test 'quoted text' grep readonly && x=1
+	| | then --verbose x=1 'quoted text' readonly $(pwd) test test
+		export sed "$1" $(pwd)
+"$1" && sed readonly | /usr/bin grep $(pwd) test readonly echo printf "$@" echo
+		"$1" local export x=1 $(pwd) then sed x=1 export local && echo "$1" | 2>/dev/null
+	&& awk ${HOME} -eu printf local --verbose
+		x=1 "$1" awk /usr/bin printf "$1"
+		export cd $(pwd) ${HOME} && done readonly local --verbose echo
+		local test 2>/dev/null 'quoted text' grep then ${HOME} 'quoted text' test
+"$1" ${HOME} $(pwd) 'quoted text' readonly
+		| grep $(pwd) "$1" "$1"
+		'quoted text' then awk printf readonly /usr/bin 2>/dev/null
+	'quoted text' local export -eu export done done "$1" cd awk
+"$1" --verbose $(pwd) $(pwd) ${HOME}
+		sed awk test ${HOME} $(pwd) grep ${HOME} "$@"
+	x=1 && | "$@" 2>/dev/null "$@" grep -eu sed ${HOME} export /usr/bin echo -eu done
+x=1 local then sed then /usr/bin
+"$@" echo cd sed /usr/bin && $(pwd) /usr/bin sed
+		done awk "$1" -eu printf "$@" done 'quoted text'
+	/usr/bin cd printf sed sed cd "$1" "$@"
+| readonly 'quoted text' /usr/bin then then awk echo -eu
+	/usr/bin then printf /usr/bin "$1" "$1" export "$1" /usr/bin ${HOME}
+		"$@" done -eu 'quoted text' grep sed grep readonly grep "$@" readonly 2>/dev/null
+	/usr/bin 2>/dev/null && -eu awk test then 2>/dev/null 2>/dev/null export
+	echo awk grep -eu printf x=1 ${HOME} readonly
+printf cd test "$1" echo "$@" grep then sed export echo
+test x=1 -eu 'quoted text' awk /usr/bin "$1"
+	-eu && --verbose $(pwd) 'quoted text' && --verbose
+grep then then printf "$@" printf "$@" $(pwd) x=1 then x=1 "$1" 2>/dev/null
+$(pwd) | -eu /usr/bin 'quoted text' x=1
+		readonly test ${HOME} | 2>/dev/null local printf echo $(pwd) $(pwd)
+		echo 2>/dev/null /usr/bin awk
+x=1 --verbose local then export awk
+	'quoted text' cd ${HOME} printf grep sed -eu cd done "$1"
+		readonly done awk x=1 x=1 printf ${HOME} "$@" -eu x=1 echo -eu echo sed
+	echo "$1" 'quoted text' printf cd --verbose done "$1" | /usr/bin -eu
+printf local done then "$@" && && && grep printf && cd printf
+	grep sed ${HOME} then "$@" 'quoted text'
+		| grep | | 2>/dev/null "$@" printf && local test
+		done 'quoted text' sed -eu grep 'quoted text'
+then then cd echo 2>/dev/null | grep | 2>/dev/null
+${HOME} local /usr/bin export then
+		--verbose x=1 export cd grep x=1 awk awk grep export -eu
+| cd $(pwd) && readonly then
+	printf 2>/dev/null && -eu -eu then echo 'quoted text' cd | readonly --verbose
+		test | readonly -eu test
+	readonly -eu local --verbose | echo sed echo "$@" && cd | test -eu cd "$@"
+printf local echo echo --verbose
+		cd 'quoted text' grep --verbose "$1" "$1" cd ${HOME} test readonly
+&& echo | x=1 readonly then printf readonly test |
+	done ${HOME} x=1 local
+'quoted text' 2>/dev/null sed awk then done -eu 2>/dev/null && sed
+	x=1 'quoted text' then export
+"$@" sed 'quoted text' done grep awk awk | $(pwd) done local ${HOME}
+echo printf x=1 grep done 'quoted text' readonly done "$@" echo
+	awk cd echo export cd readonly test readonly export awk --verbose "$@" export
+		awk -eu --verbose x=1 -eu --verbose
+		grep --verbose echo awk 2>/dev/null 2>/dev/null -eu ${HOME} printf
+		then /usr/bin cd echo export | test 2>/dev/null readonly local x=1
+		test echo x=1 done -eu then done grep x=1 export grep 2>/dev/null
+2>/dev/null "$@" 2>/dev/null
+export "$1" | grep | test printf && echo 'quoted text' $(pwd)
+		echo done test export then 2>/dev/null | ${HOME} "$@" awk /usr/bin "$@"
+export local readonly printf cd printf -eu | ${HOME} sed 2>/dev/null x=1
+$(pwd) /usr/bin "$1" "$1" "$1" then -eu grep sed --verbose done
+	-eu --verbose "$1" sed cd 2>/dev/null awk sed grep local | "$1" ${HOME} local
+	x=1 x=1 | sed local readonly &&
+		grep sed printf --verbose "$@" local $(pwd)
+done ${HOME} "$1" readonly ${HOME} ${HOME} 2>/dev/null /usr/bin readonly
+--verbose local "$1" readonly sed cd x=1 |
+-eu grep x=1 grep local /usr/bin awk printf
+		'quoted text' cd --verbose grep
+		echo -eu --verbose export "$1" ${HOME} -eu cd x=1 sed cd local 2>/dev/null
+awk | awk x=1 local sed 'quoted text'
+	--verbose | test x=1 x=1 export readonly grep cd readonly | test
+	&& -eu test then ${HOME} grep $(pwd) echo cd cd done && test cd "$@"
+		&& grep $(pwd) 'quoted text' x=1 | then /usr/bin export readonly
+2>/dev/null sed cd export done echo | done done --verbose export grep && x=1 sed
+		"$@" /usr/bin 'quoted text'
+	$(pwd) awk local test echo ${HOME} readonly sed | | "$1"
+	cd 2>/dev/null sed echo
+	readonly 2>/dev/null && grep then x=1 && echo | export grep && readonly --verbose
+	echo ${HOME} && ${HOME} /usr/bin -eu "$1" | export echo grep grep done -eu &&
+-eu ${HOME} | $(pwd) --verbose local local --verbose
+printf sed /usr/bin echo test 'quoted text' x=1 readonly local
+		awk | then /usr/bin echo 2>/dev/null readonly | 'quoted text'
+	${HOME} /usr/bin --verbose --verbose local echo
+&& 'quoted text' local | printf echo "$@"
+	${HOME} readonly $(pwd) cd grep test ${HOME} grep
+	&& then x=1 x=1 awk 'quoted text' | sed printf local echo ${HOME} done | 2>/dev/null
+		&& "$@" printf ${HOME} /usr/bin
+		x=1 then test export /usr/bin local x=1 2>/dev/null | awk sed
+	| $(pwd) echo awk readonly 'quoted text'
+	then $(pwd) printf test done && export 2>/dev/null && echo grep awk
+echo printf grep local 'quoted text' "$1" -eu -eu --verbose
+		grep export --verbose && x=1 grep /usr/bin 'quoted text' sed $(pwd)
+	"$1" /usr/bin "$@" cd "$1" test && | sed "$@" "$1" --verbose
+		sed grep echo test /usr/bin printf awk
+	-eu x=1 then $(pwd) local x=1 cd cd grep $(pwd) cd x=1
+		then 2>/dev/null echo --verbose awk then && sed /usr/bin "$@"
+	printf -eu --verbose test done | echo test printf local grep x=1 then "$@"
+echo sed export "$@" | awk x=1 sed printf ${HOME} awk x=1 then sed
+		local "$@" x=1 readonly --verbose grep grep awk awk cd local export | printf
+		local export test done 2>/dev/null | | sed awk 'quoted text'
+$(pwd) ${HOME} done local "$@" echo printf 'quoted text'
+"$1" && done awk then -eu
+		echo printf 'quoted text' | 'quoted text'
+	$(pwd) 2>/dev/null -eu printf printf --verbose
+		2>/dev/null then 'quoted text' /usr/bin 2>/dev/null
+		x=1 cd $(pwd) 2>/dev/null 2>/dev/null
+${HOME} --verbose done ${HOME} /usr/bin 'quoted text' grep 2>/dev/null &&
+	${HOME} "$1" awk sed local ${HOME} echo "$1" && $(pwd) echo then
+	export local 'quoted text'
+		"$1" cd 2>/dev/null printf done done awk sed test | readonly export
+export done printf 'quoted text'
+		'quoted text' echo --verbose "$@" $(pwd) local 'quoted text'
+		cd $(pwd) printf then "$1" && | export grep "$1"
+&& x=1 -eu ${HOME} ${HOME} printf --verbose local
+readonly cd --verbose 2>/dev/null test sed x=1 awk $(pwd) 'quoted text'
+	--verbose "$@" readonly "$1" awk readonly export printf
+		printf --verbose cd x=1 sed $(pwd) /usr/bin --verbose sed
+local /usr/bin && x=1 cd -eu test cd $(pwd) x=1 &&
+	/usr/bin 2>/dev/null x=1 'quoted text'
+	test ${HOME} then done then
+		&& ${HOME} printf awk | 2>/dev/null readonly -eu
+		"$1" $(pwd) "$@" 2>/dev/null | ${HOME}
+		sed ${HOME} ${HOME} --verbose
+| local local cd then 2>/dev/null
+	local 2>/dev/null printf $(pwd) done local
+		"$1" /usr/bin ${HOME} local 2>/dev/null
+	'quoted text' local awk done cd sed ${HOME} "$1" test echo local
+		${HOME} x=1 /usr/bin 'quoted text' "$@" | | $(pwd) cd export
+		grep test $(pwd) -eu "$@" -eu 2>/dev/null x=1 readonly
+		awk x=1 then cd grep --verbose grep ${HOME} local readonly
+		-eu | done ${HOME} export ${HOME} local grep /usr/bin
+	cd test 'quoted text' --verbose readonly | then
+		$(pwd) test -eu done "$1" -eu | ${HOME} ${HOME} printf
+		| done $(pwd) x=1 local test echo "$1" ${HOME} 'quoted text' test
+		2>/dev/null -eu sed && sed export 'quoted text' "$1" "$1"
+	then echo && test then printf 2>/dev/null 'quoted text'
+	2>/dev/null cd "$1" then $(pwd) && 2>/dev/null echo "$1" done 2>/dev/null
+| printf x=1 awk readonly printf /usr/bin then "$1" "$1" ${HOME} "$@" printf printf
+	sed 2>/dev/null 'quoted text'
+		local export readonly then done readonly test --verbose
+		"$@" grep awk printf -eu test test 2>/dev/null
+	| done ${HOME} /usr/bin -eu x=1 test readonly
+		'quoted text' test awk cd $(pwd) && readonly then readonly 2>/dev/null
+	--verbose | ${HOME} /usr/bin $(pwd) "$@"
+echo export then /usr/bin -eu "$@" --verbose then ${HOME} ${HOME} awk "$1" export
+then && "$1" $(pwd) then test awk && printf --verbose sed
+	| awk --verbose done 'quoted text' && grep && local /usr/bin grep /usr/bin -eu
+		then export readonly printf cd echo -eu 2>/dev/null
+	-eu cd | 2>/dev/null echo | cd awk done
+	2>/dev/null local $(pwd) then readonly
+local ${HOME} | ${HOME} $(pwd) test $(pwd) | ${HOME} && $(pwd)
+	-eu export "$1" x=1 printf
+test then grep echo sed ${HOME} "$@" readonly
+	sed grep "$1" ${HOME} then cd "$1" x=1 echo awk export printf 'quoted text' awk
+test x=1 echo x=1 2>/dev/null "$@" cd && grep local $(pwd)
+	2>/dev/null | --verbose -eu "$@" 'quoted text'
+		done x=1 | -eu /usr/bin done cd printf $(pwd) test grep
+		$(pwd) ${HOME} done | x=1 test cd grep awk ${HOME}
+	2>/dev/null printf local grep "$1" echo done "$@" |
+		local printf test grep awk done printf readonly readonly printf
+'quoted text' /usr/bin 'quoted text' | --verbose test && local
+-eu test grep awk | /usr/bin -eu x=1 && --verbose sed echo x=1
+		-eu awk grep local x=1 ${HOME} awk | sed && 2>/dev/null
+	grep test && 'quoted text' && 'quoted text' --verbose then x=1 sed
+${HOME} $(pwd) grep 'quoted text'
+	readonly local ${HOME} "$1" cd -eu && 2>/dev/null grep readonly
+	2>/dev/null readonly then ${HOME} $(pwd)
+	"$@" ${HOME} test x=1 /usr/bin local && export /usr/bin awk sed 'quoted text'
+		test ${HOME} 'quoted text' x=1 /usr/bin grep ${HOME} test local
+	-eu --verbose x=1 then grep ${HOME} -eu printf grep | done | awk ${HOME}
+"$@" awk | awk x=1 echo sed local "$1" && 2>/dev/null $(pwd) ${HOME} done
+		$(pwd) sed cd local 2>/dev/null -eu x=1 test 'quoted text' grep /usr/bin
+	-eu readonly x=1 test readonly
+-eu "$@" readonly done | && test "$1" printf -eu -eu cd cd -eu 'quoted text' printf
+	-eu "$@" readonly local x=1 export
+$(pwd) cd test $(pwd) | | sed printf "$1" /usr/bin
+cd cd $(pwd) test | 2>/dev/null ${HOME} x=1 test --verbose
+	/usr/bin "$1" "$1" then done local 2>/dev/null ${HOME} sed grep | "$1" test echo
+	test | done x=1 export export export sed "$@" 'quoted text'
+grep $(pwd) echo test done /usr/bin
+	done && -eu export then then echo then sed
+		awk --verbose awk echo "$1" && 'quoted text'
+	grep echo sed $(pwd) "$1"
+		test -eu sed | local test cd export "$1" 2>/dev/null done /usr/bin | x=1
+		--verbose $(pwd) readonly | done printf done && awk then readonly --verbose
+		"$@" export x=1 readonly awk ${HOME} $(pwd) export
+		--verbose | -eu 2>/dev/null then awk x=1 -eu local -eu x=1 | "$@" sed printf
+/usr/bin grep | x=1 x=1 ${HOME} export 'quoted text' 2>/dev/null
+	"$@" "$@" test export cd 'quoted text' export
+echo cd cd sed 'quoted text'
+sed local local "$1" readonly "$1" grep -eu readonly 2>/dev/null
+	/usr/bin test export $(pwd)
+		test "$@" echo printf "$1" local && done cd --verbose
+		sed x=1 readonly grep local then | awk echo echo
+	| readonly && local -eu "$@" "$1" 2>/dev/null
+		echo echo echo awk ${HOME} sed done --verbose echo
+		readonly done x=1 grep done printf local test local --verbose echo x=1
+	export grep local x=1 sed local sed 'quoted text' awk -eu test --verbose
+2>/dev/null sed --verbose x=1 /usr/bin
+	local $(pwd) grep echo sed then echo 2>/dev/null then
+	printf /usr/bin x=1 cd readonly test x=1 "$@" | local "$1" "$1" /usr/bin then
+	"$1" test && ${HOME} sed local -eu readonly "$@" &&
+	$(pwd) /usr/bin -eu "$@" grep local export
+--verbose | grep local echo && cd 2>/dev/null then local test
+		readonly /usr/bin --verbose export test $(pwd) 2>/dev/null && grep -eu ${HOME}
+		"$@" done test test "$@" readonly
+		$(pwd) cd printf $(pwd) -eu --verbose 2>/dev/null echo &&
+		readonly --verbose -eu x=1 -eu ${HOME} /usr/bin
+	echo 2>/dev/null ${HOME} export "$1" printf
+		-eu --verbose x=1 "$@" | local | awk done 2>/dev/null $(pwd) done export
+		'quoted text' sed /usr/bin
+	--verbose 'quoted text' printf --verbose $(pwd) -eu
+		--verbose echo test sed $(pwd) 2>/dev/null 2>/dev/null sed |
+		echo awk $(pwd) awk printf x=1 test --verbose x=1 x=1
+		awk grep echo "$1" && awk sed --verbose -eu sed -eu -eu done cd ${HOME} local
+		${HOME} && local && printf --verbose readonly
+		done 2>/dev/null ${HOME} --verbose export /usr/bin then ${HOME} "$1" x=1
+	sed --verbose readonly && done x=1 x=1
+		| "$1" export done "$@" | 'quoted text' ${HOME} x=1
+		"$@" 'quoted text' ${HOME} x=1 export
+	test done grep test "$@" printf export -eu ${HOME}
+	/usr/bin export && sed export sed 2>/dev/null printf /usr/bin
+	echo && | $(pwd) && -eu printf "$1" ${HOME} && local local export &&
+		| -eu test && --verbose done local x=1 export export local "$@"
+"$@" local -eu local ${HOME} grep /usr/bin
+	| cd x=1 cd printf | 'quoted text' readonly
+		"$@" 'quoted text' && local "$1" 'quoted text'
+done -eu local printf $(pwd) local test $(pwd)
+cd $(pwd) 'quoted text' awk cd && awk awk
+		done echo | sed $(pwd) 'quoted text' "$@" "$1" echo 2>/dev/null local echo $(pwd)
+	2>/dev/null then | awk | ${HOME} "$@" readonly
+'quoted text' && awk ${HOME} echo
+test 2>/dev/null -eu -eu | export 'quoted text' printf 2>/dev/null awk -eu $(pwd)
+	x=1 local 2>/dev/null x=1 awk $(pwd) -eu export --verbose sed test
+		sed /usr/bin --verbose local then --verbose grep printf /usr/bin then
+done x=1 readonly echo "$1" printf printf done | echo
+		"$@" && | awk cd "$1" && x=1 local /usr/bin
+	local | --verbose cd 'quoted text' sed "$@" export done local ${HOME} awk
+2>/dev/null && grep printf cd "$1" cd cd
+	cd | export cd local export cd
+${HOME} readonly -eu grep 'quoted text'
+	echo cd printf --verbose done x=1
+	$(pwd) done 2>/dev/null -eu cd export then 'quoted text'
+	$(pwd) cd "$@" x=1 'quoted text' readonly sed echo /usr/bin test |
+	then cd local readonly --verbose awk grep 'quoted text' --verbose
+		'quoted text' done grep grep
+		| -eu readonly awk /usr/bin "$@" --verbose
+		-eu printf test done export cd printf local local x=1 echo grep readonly
+awk local && sed && 2>/dev/null printf printf --verbose grep
+		done export && x=1 test | export 2>/dev/null "$@" 2>/dev/null
+		"$@" sed test 'quoted text' x=1 awk 'quoted text' cd readonly
+		"$1" grep 'quoted text' && printf sed sed grep -eu export
+	--verbose --verbose test 'quoted text'
+	'quoted text' | sed awk done $(pwd) cd
+--verbose grep then done ${HOME} export
+	then done echo test echo 2>/dev/null done test done
+test -eu local /usr/bin
+sed cd $(pwd) awk sed sed 'quoted text' export "$@"
+	x=1 2>/dev/null x=1 test $(pwd) $(pwd) -eu 2>/dev/null 2>/dev/null
+local 2>/dev/null awk local "$1" export --verbose grep
+		readonly "$1" printf $(pwd) "$@" x=1 export local export
+	${HOME} export ${HOME} sed -eu local grep --verbose "$1" | printf
+	"$@" 'quoted text' then 2>/dev/null ${HOME} "$1"
+	"$1" readonly awk awk sed "$@" test awk -eu ${HOME} ${HOME} then local echo
+readonly 'quoted text' then x=1 | x=1 x=1 ${HOME} 2>/dev/null "$@" export
+awk grep done x=1 done test readonly --verbose /usr/bin
+	--verbose x=1 export "$@" && ${HOME}
+	then readonly "$@" --verbose 2>/dev/null test && 'quoted text' ${HOME}
+	grep && "$@" --verbose x=1 -eu printf
+		sed | export local && printf test $(pwd) /usr/bin grep
+test x=1 -eu done echo sed --verbose ${HOME} printf x=1
+	test "$1" x=1 | then
+		2>/dev/null done && "$1" && --verbose
+	&& cd local -eu then local printf
+	'quoted text' echo then $(pwd) 'quoted text' sed test cd done printf
+	export echo grep sed "$1" -eu readonly awk
+--verbose local && grep x=1 grep export export
+cd /usr/bin grep test "$@" echo --verbose done awk --verbose
+		awk /usr/bin | $(pwd) awk ${HOME} grep "$1" printf export 2>/dev/null
+	"$1" then 'quoted text' -eu
+		$(pwd) local readonly $(pwd) 'quoted text' sed echo local $(pwd) x=1 test
+	test --verbose sed 2>/dev/null local x=1 cd $(pwd) readonly
+		sed local export "$@" done printf done printf
+		| grep export grep --verbose sed | echo /usr/bin ${HOME}
+x=1 sed ${HOME} x=1 --verbose | "$1" export $(pwd)
+x=1 local sed /usr/bin test local printf cd done "$1" cd grep done awk sed x=1
+		cd --verbose | done echo printf $(pwd) --verbose export
+"$@" x=1 --verbose local sed x=1 then ${HOME} then export sed 2>/dev/null
+		"$1" grep export awk awk awk grep "$1" done sed sed
+'quoted text' sed x=1 readonly grep local
+"$1" 'quoted text' ${HOME} ${HOME}
+	--verbose awk then "$1" export echo $(pwd) x=1 grep done export
+		grep awk --verbose test done
+		awk echo cd test printf grep printf
+	awk echo x=1 sed readonly printf x=1 grep readonly readonly then test echo done
+		"$@" x=1 "$@" echo awk $(pwd) echo export "$1" readonly /usr/bin local "$@"
+	'quoted text' readonly then
+export --verbose 2>/dev/null 2>/dev/null "$@" 2>/dev/null then $(pwd)
+	printf cd test test export
+		2>/dev/null -eu | grep export echo test ${HOME} /usr/bin "$1"
+		export readonly readonly && export
+	/usr/bin done awk local export ${HOME} echo && readonly "$1" && 2>/dev/null
+		$(pwd) "$1" -eu printf
+	$(pwd) test test grep test local export -eu -eu 'quoted text' $(pwd) sed
+		readonly awk "$@" readonly $(pwd)
+		x=1 /usr/bin --verbose
+	${HOME} 'quoted text' cd ${HOME} "$1" echo test done awk awk 'quoted text'
+awk local awk test then test sed readonly
+		grep ${HOME} --verbose grep
+		${HOME} /usr/bin grep "$1" readonly | ${HOME} test | ${HOME} grep /usr/bin export
+$(pwd) test ${HOME} readonly awk local && export
+	cd echo awk ${HOME} x=1 "$1" /usr/bin echo
+		awk ${HOME} /usr/bin --verbose "$1" 'quoted text' export
+		-eu test x=1 "$@" "$@" 2>/dev/null done cd export ${HOME} export
+	grep /usr/bin awk "$1" $(pwd) x=1 2>/dev/null |
+		&& /usr/bin --verbose sed "$@" x=1 "$1" readonly "$1" done -eu awk readonly sed
+2>/dev/null local grep readonly /usr/bin $(pwd) --verbose readonly
+		"$@" printf "$1" awk readonly grep x=1 ${HOME} $(pwd) local
+	"$@" grep done 'quoted text'
+		readonly && -eu readonly x=1 | grep local "$@" readonly
+		awk "$1" test x=1 export 'quoted text' -eu x=1 printf 2>/dev/null -eu
+-eu export awk awk local 2>/dev/null
+	/usr/bin | 2>/dev/null x=1 "$1" then $(pwd) "$1" sed --verbose done
+		2>/dev/null sed awk cd grep
+		$(pwd) $(pwd) awk local --verbose ${HOME} printf 'quoted text'
+		'quoted text' test done 2>/dev/null && awk
+		"$1" grep --verbose printf /usr/bin
+		${HOME} local "$@" printf -eu ${HOME}
+		printf && printf x=1 awk "$1" local
+--verbose ${HOME} test 2>/dev/null cd export $(pwd) awk 2>/dev/null local 'quoted text'
+		export grep | "$@" awk sed
+printf --verbose ${HOME} $(pwd)
+		"$@" export awk sed "$@" grep then $(pwd) && readonly readonly printf
+/usr/bin /usr/bin && then printf awk "$1" && /usr/bin 'quoted text' awk | /usr/bin
+	| $(pwd) grep done echo x=1
+	/usr/bin $(pwd) /usr/bin -eu && test 2>/dev/null -eu local
+"$@" | 2>/dev/null /usr/bin printf test export grep
+export echo local cd "$1" printf local 'quoted text' test --verbose printf
+	grep 'quoted text' readonly
+	export | sed "$@" $(pwd) echo
+		--verbose 'quoted text' "$@" cd cd | sed ${HOME} export 2>/dev/null x=1 --verbose
+grep test --verbose then /usr/bin && 2>/dev/null
+	then ${HOME} grep && cd done 2>/dev/null cd
+		2>/dev/null export echo then awk done "$1" printf readonly 'quoted text'
+${HOME} $(pwd) "$@" awk then && readonly 'quoted text'
+		'quoted text' -eu | then | 'quoted text'
+"$@" /usr/bin /usr/bin cd "$@" sed && test export
+		/usr/bin export x=1 local done then 2>/dev/null $(pwd) done --verbose
+		&& "$@" -eu 2>/dev/null $(pwd) "$1" grep export sed $(pwd) --verbose
+		"$@" 'quoted text' test /usr/bin -eu "$@" 'quoted text'
+	2>/dev/null export cd echo then 2>/dev/null | x=1 local done x=1
+export then "$1" export && sed 'quoted text' -eu
+		${HOME} $(pwd) awk done then export grep
+	done export sed 'quoted text' grep export 'quoted text'
+/usr/bin 'quoted text' sed
+		awk $(pwd) -eu grep export done ${HOME} export cd | "$1"
+	| test awk awk echo ${HOME} grep then x=1 --verbose grep
+		sed awk ${HOME} ${HOME} 'quoted text' printf 'quoted text' $(pwd)
+		export printf done done then printf local /usr/bin then export /usr/bin
+		&& readonly then readonly "$1"
+	readonly printf "$@" 2>/dev/null readonly "$@" printf /usr/bin --verbose
+	grep readonly cd 'quoted text' "$@" printf ${HOME} /usr/bin
+		"$@" 'quoted text' cd /usr/bin
+local && | done 2>/dev/null grep | cd | then test export "$1"
+x=1 'quoted text' $(pwd) x=1 2>/dev/null --verbose local
+${HOME} printf sed --verbose cd local "$@" "$@" readonly | awk printf ${HOME}
+		local "$1" x=1 ${HOME} export | "$1" "$@" x=1 export "$@" cd "$1"
+	printf local 'quoted text' sed | x=1 "$1" readonly 2>/dev/null x=1
+"$@" printf test local local && echo "$@" | 'quoted text' cd -eu grep
+	export echo x=1 "$@" done then then 2>/dev/null done
+	export grep 2>/dev/null sed awk
+		${HOME} sed 'quoted text' grep readonly
+	export | 2>/dev/null then "$@" done printf
+--verbose awk then 2>/dev/null export ${HOME} | x=1 test test awk cd 2>/dev/null
+| -eu 'quoted text' grep done /usr/bin then sed readonly readonly
+sed x=1 grep printf then export awk printf
+| export done then 2>/dev/null
+export done local awk $(pwd) test test export
+	&& | grep readonly printf x=1 $(pwd) ${HOME}
+| cd "$@" awk readonly awk
+sed && 2>/dev/null done "$@" grep test sed sed "$@" export 'quoted text'
+	${HOME} readonly $(pwd) /usr/bin test export ${HOME} readonly
+		test printf 'quoted text' echo then && readonly printf x=1 2>/dev/null
+		cd then printf export
+	then readonly awk "$1" test "$1" --verbose grep echo ${HOME}
+-eu 'quoted text' 2>/dev/null grep done readonly awk
+x=1 done printf local $(pwd)
+		-eu 'quoted text' /usr/bin 'quoted text'
+	&& echo cd grep $(pwd) test "$1" awk "$1" "$1" sed test
+		grep /usr/bin then 2>/dev/null
+	/usr/bin 'quoted text' test cd readonly 'quoted text' export grep grep cd /usr/bin
+"$1" $(pwd) x=1 x=1 awk /usr/bin awk $(pwd) 2>/dev/null then printf --verbose
+		$(pwd) --verbose then --verbose 2>/dev/null x=1 'quoted text' then awk --verbose
+		"$@" then $(pwd) 'quoted text' grep /usr/bin awk cd x=1 x=1 readonly x=1
+		/usr/bin test $(pwd) 'quoted text' awk ${HOME} test cd "$1" $(pwd)
+		export 2>/dev/null && x=1 cd readonly awk done grep readonly awk $(pwd)
+sed sed then 'quoted text' /usr/bin $(pwd) $(pwd) grep test x=1 2>/dev/null
+		sed 'quoted text' readonly test | export done 'quoted text'
+	test grep test printf ${HOME} /usr/bin printf then cd test 'quoted text' cd
+		-eu 2>/dev/null echo readonly -eu local done done x=1 awk
+&& && cd "$1" | "$@" x=1
+"$1" /usr/bin grep x=1 $(pwd) printf sed x=1 local
+echo awk grep export export local export /usr/bin $(pwd)
+	&& test 2>/dev/null cd "$@" awk && ${HOME} local
+		${HOME} ${HOME} sed awk
+awk then local x=1 x=1 printf /usr/bin 2>/dev/null /usr/bin
+		x=1 ${HOME} --verbose && done printf echo printf && readonly 2>/dev/null &&
+	cd export cd "$@" local awk ${HOME} local 2>/dev/null cd awk /usr/bin cd test 2>/dev/null
+		cd x=1 x=1 && export "$1" export local $(pwd) printf -eu /usr/bin &&
+	&& local test then /usr/bin done |
+	test grep printf 'quoted text' awk
+	"$@" | test 2>/dev/null x=1 then 'quoted text'
+		x=1 "$@" readonly "$@" 2>/dev/null local
+/usr/bin readonly local grep sed $(pwd) $(pwd) | -eu ${HOME} test 2>/dev/null
+		cd 2>/dev/null echo -eu done echo $(pwd) 'quoted text' then ${HOME} "$@" /usr/bin
+	"$1" awk readonly cd x=1 'quoted text'
+grep test grep x=1 test ${HOME} "$1" printf
+cd printf then local 2>/dev/null -eu &&
+		done | local sed | then test 'quoted text'
+	2>/dev/null sed /usr/bin --verbose ${HOME} local export -eu x=1 export
+		printf /usr/bin 'quoted text' /usr/bin export
+cd readonly sed awk then 'quoted text' then | sed local grep
+echo echo | "$@" "$@" readonly
+grep $(pwd) printf export
+		then ${HOME} ${HOME} cd $(pwd) echo
+echo && -eu awk printf
+		cd readonly --verbose awk grep --verbose /usr/bin "$@"
+cd $(pwd) cd 'quoted text' done sed "$@" | test grep
+	done "$1" 'quoted text' echo then && $(pwd)
+	"$1" echo $(pwd) --verbose
+	then "$@" 'quoted text' && cd test grep grep grep 'quoted text'
+		$(pwd) local sed test test export ${HOME} awk -eu done grep "$@"
+		cd -eu && grep "$@" awk sed -eu 'quoted text'
+x=1 grep awk done done test "$@" "$@" export local test "$@" cd sed awk 2>/dev/null
+	export --verbose export -eu /usr/bin printf then
+	| && && done | --verbose -eu ${HOME} readonly --verbose
+	${HOME} --verbose sed && awk test
+		export export export echo test | local 'quoted text' ${HOME} "$@" echo
+		--verbose x=1 $(pwd) local "$1" | "$1" export local ${HOME} test awk awk sed
+		test grep "$@" done readonly
+grep | $(pwd) -eu done "$@" grep local awk 2>/dev/null
+		test $(pwd) test 'quoted text' --verbose grep grep readonly
+cd && done x=1 "$@" awk 2>/dev/null sed done grep readonly readonly
+readonly && -eu then && $(pwd) "$1" $(pwd) && local readonly readonly
+		awk printf && | awk ${HOME} --verbose
+	| done awk readonly sed && printf export
+"$1" && && done "$1" done
+		/usr/bin printf -eu -eu && x=1 readonly awk
+then "$1" --verbose | $(pwd) sed local "$@" --verbose "$@" x=1 /usr/bin $(pwd)
+| x=1 x=1 readonly then -eu $(pwd) awk printf
+	-eu grep sed local then 2>/dev/null --verbose --verbose 'quoted text' done
+	"$@" | test && 2>/dev/null done sed x=1 grep x=1 cd done echo done
+	readonly grep --verbose /usr/bin export 'quoted text' 2>/dev/null then readonly
+		awk export done printf && ${HOME} grep -eu readonly | /usr/bin
+2>/dev/null x=1 --verbose printf sed echo grep
+awk printf | x=1 sed 2>/dev/null "$@" && awk | test printf
+	&& awk x=1 printf $(pwd) export ${HOME} printf /usr/bin ${HOME} $(pwd)
+2>/dev/null $(pwd) sed 'quoted text' x=1 test /usr/bin
+readonly $(pwd) x=1 awk -eu -eu x=1 then -eu grep then | "$1" --verbose
+-eu && grep echo awk export then x=1 echo grep
+		export cd done -eu "$1" $(pwd) "$@" --verbose && test sed awk cd sed cd ${HOME}
+grep -eu -eu printf --verbose awk --verbose
+--verbose test local ${HOME} 'quoted text' ${HOME} -eu echo sed
+		"$1" grep test test "$1" $(pwd) grep 2>/dev/null | grep echo
+then sed printf done export --verbose awk 2>/dev/null | local local
+readonly "$@" 'quoted text'
+		| sed then "$1" then export --verbose echo
+	local "$1" printf echo echo 2>/dev/null cd "$@" ${HOME} "$1" export
+-eu 2>/dev/null | 'quoted text'
+$(pwd) x=1 cd | | /usr/bin /usr/bin then $(pwd) grep
+	echo test echo 2>/dev/null done local cd $(pwd) echo
+	printf /usr/bin sed echo grep 2>/dev/null 2>/dev/null readonly 'quoted text'
+	sed -eu done 2>/dev/null sed echo && grep x=1 /usr/bin
+readonly cd export echo local 'quoted text' ${HOME} "$@" then printf printf
+sed grep export "$1" printf /usr/bin
+	sed 2>/dev/null sed grep done "$1" /usr/bin
+		printf $(pwd) cd -eu x=1 then --verbose | ${HOME} | -eu ${HOME}
+	export grep -eu awk test 2>/dev/null | sed --verbose printf ${HOME}
+	/usr/bin -eu done done 2>/dev/null done ${HOME} --verbose 2>/dev/null grep "$@"
+		then printf /usr/bin then test local echo echo -eu "$@" ${HOME} $(pwd) x=1 ${HOME}
+		| "$1" 2>/dev/null echo done ${HOME} 2>/dev/null
+		"$1" echo && readonly /usr/bin done awk $(pwd)
+	local sed 2>/dev/null echo -eu x=1 --verbose grep local ${HOME} grep
+	"$@" export $(pwd) && -eu ${HOME} sed "$@" then local awk sed grep |
+	2>/dev/null 'quoted text' 'quoted text'
+"$@" $(pwd) local echo "$@" awk "$@" -eu "$@" grep echo then local "$@" 'quoted text'
+	then sed test /usr/bin ${HOME} export done x=1 /usr/bin 2>/dev/null
+		cd "$@" | $(pwd) -eu $(pwd) --verbose --verbose
+&& echo test && test export readonly cd readonly
+		${HOME} test | echo export && 'quoted text' awk | sed export then
+	done -eu $(pwd) printf -eu then "$@" export printf x=1 "$@"
+	&& echo test "$@" grep "$@" ${HOME} $(pwd) sed grep export export $(pwd)
+2>/dev/null /usr/bin "$@" "$@" awk /usr/bin local export && $(pwd) /usr/bin
+		/usr/bin --verbose awk test x=1 | awk awk done then export readonly 2>/dev/null
+	then $(pwd) export x=1 x=1 x=1 cd | test ${HOME}
+	'quoted text' 2>/dev/null 'quoted text' local grep $(pwd)
+	done "$@" -eu 2>/dev/null x=1 sed readonly
+	export done grep awk readonly ${HOME} /usr/bin
+	x=1 sed done sed test awk cd sed grep
+		echo "$@" | grep local done then printf printf done /usr/bin /usr/bin &&
+		then && x=1 then 2>/dev/null $(pwd) $(pwd) ${HOME} then
+	-eu done /usr/bin grep awk --verbose grep export cd
+		done grep | awk export x=1 --verbose && ${HOME} test 2>/dev/null
+	"$@" test awk test --verbose |
+		2>/dev/null -eu ${HOME}
+	awk local "$@" test local x=1
+		"$1" done awk /usr/bin test
+${HOME} echo done local cd "$@" then printf export
+		/usr/bin && && echo 'quoted text' 2>/dev/null test
+	x=1 ${HOME} x=1 --verbose /usr/bin
+export -eu $(pwd) && -eu then then export "$@" echo x=1 sed -eu readonly test
+		then grep awk test echo sed | test 2>/dev/null x=1 x=1 $(pwd) cd
+		export -eu then x=1 -eu then then --verbose echo --verbose --verbose awk local
+		readonly --verbose $(pwd) 'quoted text' echo /usr/bin --verbose
+	cd "$@" && then $(pwd) cd test 2>/dev/null done test sed cd done && cd test && printf
+	echo printf grep done done echo test export awk -eu then 'quoted text' -eu awk
+	"$@" | | x=1 | grep local "$1" echo ${HOME} $(pwd) 'quoted text'
+'quoted text' x=1 sed && grep | export sed grep echo
+		done /usr/bin local ${HOME} then export
+cd && 'quoted text' && "$1" ${HOME} --verbose 2>/dev/null $(pwd) readonly
+grep printf awk cd printf "$1" readonly ${HOME}
+printf 'quoted text' --verbose /usr/bin sed | local && | 2>/dev/null
+	--verbose $(pwd) awk $(pwd)
+	then test echo sed 'quoted text'
+	readonly | echo 'quoted text' readonly && grep
+		grep "$@" /usr/bin export | /usr/bin readonly grep readonly -eu
+		then echo --verbose sed done test $(pwd) 2>/dev/null
+		cd $(pwd) local ${HOME} "$@" then test then "$1" readonly
+		$(pwd) "$1" awk /usr/bin grep /usr/bin "$1" test x=1 ${HOME} && $(pwd)
+		export "$@" 'quoted text' ${HOME}
+	test -eu cd printf --verbose | export test 'quoted text' | | ${HOME} echo
+	echo /usr/bin $(pwd) local "$1"
+		sed sed -eu 'quoted text' x=1 /usr/bin
+| printf | awk done local
+		'quoted text' --verbose x=1 awk 'quoted text' local -eu cd --verbose
+		&& grep ${HOME} "$@" $(pwd) grep | cd ${HOME} test then "$1"
+		/usr/bin awk "$@" echo printf | awk awk printf $(pwd)
+| /usr/bin readonly | 'quoted text' /usr/bin local
+-eu local "$@" then x=1 printf test grep echo
+	$(pwd) export $(pwd) local --verbose 2>/dev/null && local echo
+"$@" echo /usr/bin printf awk printf local done
+		awk --verbose $(pwd) ${HOME}
+	'quoted text' local -eu "$@" printf cd printf --verbose local $(pwd) /usr/bin
+		-eu printf sed --verbose | then x=1 printf --verbose printf /usr/bin "$1" printf
+		echo ${HOME} export --verbose -eu then echo $(pwd) then export
+	printf "$1" && | cd echo "$1"
+		local sed $(pwd) "$@" /usr/bin 'quoted text' $(pwd) grep printf
+	export export && "$@" $(pwd) awk "$@" test test "$1"
+$(pwd) done cd then /usr/bin
+		printf /usr/bin && readonly "$1" --verbose
+	x=1 export "$@" /usr/bin test done printf cd /usr/bin x=1 | then cd grep echo
+	printf readonly test "$1" awk x=1 local /usr/bin "$1" ${HOME} test readonly
+		then then printf 'quoted text' readonly
+	printf test x=1 local grep 2>/dev/null --verbose printf
+awk 'quoted text' grep 'quoted text' test --verbose ${HOME}
+then /usr/bin 'quoted text' local export $(pwd)
+done export x=1 test cd sed
+	awk /usr/bin awk export "$1" echo sed --verbose test ${HOME} && 'quoted text'
+${HOME} grep | x=1 "$1" "$@" /usr/bin echo test $(pwd)
+--verbose echo readonly export done cd test sed then "$1"
+		awk done then x=1 awk 2>/dev/null -eu
+	done x=1 export readonly echo "$1" echo
+		x=1 cd x=1 'quoted text' "$1" "$1" cd ${HOME} x=1 printf
+	sed awk awk test | "$@" test test 2>/dev/null grep done then readonly done
+	-eu | echo cd ${HOME}
+		--verbose --verbose awk && readonly echo $(pwd) | "$1"
+		"$@" cd && awk local done "$1" | -eu --verbose
+		grep ${HOME} awk local done readonly awk && /usr/bin ${HOME}
+	echo readonly /usr/bin awk x=1 --verbose x=1 $(pwd) |
+		readonly grep export "$1" echo then $(pwd) 'quoted text' $(pwd)
+		"$@" done $(pwd) printf local x=1 --verbose x=1 local grep x=1 done | readonly
+	export -eu ${HOME} 2>/dev/null
+	"$@" test /usr/bin | printf --verbose ${HOME} grep local "$1" test ${HOME}
+		-eu then then $(pwd) then ${HOME} x=1 echo "$1"
+		${HOME} --verbose then && sed
+	echo test echo "$1" readonly grep awk 2>/dev/null
+		cd echo 'quoted text' "$1" echo test
+		--verbose x=1 $(pwd) cd
+	printf cd sed 'quoted text'
+printf "$1" local readonly then awk test && | then grep then local
+--verbose readonly $(pwd)
+	then | test ${HOME} ${HOME} export cd done -eu && /usr/bin "$1" /usr/bin
+		/usr/bin then 2>/dev/null x=1 --verbose
+		--verbose awk printf 'quoted text' done awk ${HOME} echo 'quoted text' cd echo ${HOME}
+	2>/dev/null test grep /usr/bin 'quoted text' -eu && | local --verbose 'quoted text'
+		printf sed && export readonly
+sed "$@" sed done printf local 2>/dev/null then 2>/dev/null 2>/dev/null
+--verbose then 2>/dev/null ${HOME} then export then readonly
+		printf sed echo ${HOME} x=1 | test sed "$1" cd "$@" then
+x=1 --verbose 'quoted text'
+	${HOME} /usr/bin then 'quoted text' --verbose printf export echo grep $(pwd)
+		done 2>/dev/null 2>/dev/null
+		| ${HOME} "$@" readonly echo grep grep $(pwd) echo
+		sed sed readonly printf | 2>/dev/null local $(pwd) test readonly
+	--verbose test && local | ${HOME} echo $(pwd) then grep grep readonly
+	readonly export "$@" test then done "$1" cd 2>/dev/null ${HOME} awk "$1"
+echo 2>/dev/null ${HOME} export && ${HOME} -eu awk | readonly
+readonly cd $(pwd) grep awk echo ${HOME} && -eu export cd && /usr/bin "$@" done
+"$@" readonly export | awk
+"$@" cd cd grep ${HOME} readonly export
+-eu && sed x=1 cd export
+	'quoted text' local sed local local awk -eu
+	cd cd then readonly then export 2>/dev/null -eu echo sed -eu --verbose
+awk -eu --verbose && --verbose sed /usr/bin readonly
+		2>/dev/null "$@" && export /usr/bin "$@" done | awk local ${HOME} sed echo
+		printf $(pwd) | --verbose
+		&& printf printf echo /usr/bin $(pwd) printf "$1"
+		2>/dev/null /usr/bin /usr/bin ${HOME} && readonly
+		readonly ${HOME} test --verbose printf
+/usr/bin awk --verbose x=1 cd done
+	local printf x=1 $(pwd)
+'quoted text' 'quoted text' | test cd x=1 echo | printf --verbose
+	| grep --verbose local done -eu local | "$@" $(pwd) x=1 | x=1 --verbose
+-eu export test echo 'quoted text' --verbose echo cd
+-eu then sed "$1" echo "$@" && 'quoted text'
+test printf awk echo && local
+--verbose --verbose "$1" export -eu
+	--verbose --verbose $(pwd) x=1 --verbose "$1" -eu /usr/bin && test 'quoted text'
+	x=1 local awk "$1" 'quoted text' /usr/bin
+	then awk $(pwd) --verbose | done x=1 --verbose /usr/bin awk 2>/dev/null
+	2>/dev/null export "$1" done
+		echo | "$@" --verbose readonly 2>/dev/null test grep readonly -eu printf && x=1
+/usr/bin echo awk awk cd local --verbose local sed
+		"$1" /usr/bin sed readonly
+'quoted text' && export /usr/bin done export
+		/usr/bin readonly grep
+printf 'quoted text' awk 2>/dev/null
+		'quoted text' readonly then export sed readonly export echo sed --verbose
+&& /usr/bin then 'quoted text' 2>/dev/null readonly echo
+printf /usr/bin local done awk 'quoted text' | 'quoted text'
+$(pwd) && --verbose test sed
+grep && awk ${HOME} echo 'quoted text' "$1" 2>/dev/null | | $(pwd)
+	--verbose awk "$1" -eu then 2>/dev/null
+readonly /usr/bin grep readonly /usr/bin
+		printf awk sed readonly "$@" export
+		2>/dev/null printf export echo 'quoted text'
+2>/dev/null printf readonly 'quoted text' "$1" --verbose "$1"
+		x=1 /usr/bin done --verbose --verbose 2>/dev/null 'quoted text' "$1" ${HOME}
+awk done then -eu 'quoted text' --verbose
+		/usr/bin --verbose --verbose 2>/dev/null test printf
+		local awk local x=1 echo && ${HOME} echo -eu "$1" --verbose && | sed awk
+		${HOME} 2>/dev/null 'quoted text'
+	printf grep ${HOME} "$1" ${HOME} sed /usr/bin local then
+		test --verbose done grep cd 'quoted text'
+	printf "$@" | sed ${HOME} done echo grep "$@" /usr/bin
+grep done x=1 | && printf /usr/bin printf
+		'quoted text' test "$1" awk done 'quoted text' grep $(pwd) grep test echo
+	"$1" "$@" done 2>/dev/null -eu cd --verbose export ${HOME} grep $(pwd)
+printf "$@" /usr/bin "$@"
+test grep "$1" echo done /usr/bin ${HOME} x=1
+	awk sed echo $(pwd) -eu awk printf 'quoted text' "$@" cd cd && $(pwd) |
+	export $(pwd) 'quoted text' $(pwd) export
+'quoted text' grep test test && $(pwd)
+		printf --verbose readonly && "$@" x=1
+		awk grep readonly && printf 'quoted text' "$1" && awk grep
+	"$1" sed && awk local 2>/dev/null export $(pwd)
+sed --verbose --verbose
+2>/dev/null 'quoted text' 2>/dev/null && test "$1" && x=1 -eu grep printf --verbose
+	local done x=1 --verbose
+		readonly --verbose sed export
+	readonly awk then then $(pwd) export /usr/bin done $(pwd) cd 2>/dev/null
+then echo grep x=1 readonly sed done "$1" sed readonly sed echo
+'quoted text' echo test then --verbose grep local done done ${HOME} --verbose
+	echo /usr/bin 2>/dev/null
+		then then awk 2>/dev/null readonly cd cd &&
+		'quoted text' x=1 "$@" done "$@" grep sed --verbose
+--verbose echo "$1" --verbose local "$@" 'quoted text'
+		sed readonly then "$1" local awk
+	${HOME} x=1 ${HOME} export readonly echo export | sed export | grep
+		2>/dev/null -eu cd ${HOME} "$@" done awk "$@" done test awk local x=1
+		then 2>/dev/null test grep test export cd | printf echo x=1 -eu $(pwd)
+		printf ${HOME} then $(pwd) awk awk x=1 sed grep -eu | then $(pwd)
+export grep readonly ${HOME} readonly && cd cd export sed 'quoted text' ${HOME}
+echo grep readonly cd done readonly -eu 2>/dev/null
+--verbose x=1 'quoted text' "$@" ${HOME} /usr/bin export sed local readonly
+&& readonly then | "$1" 2>/dev/null
+	"$1" printf readonly export grep "$1" 'quoted text' --verbose
+cd --verbose "$@" awk | "$@" done sed x=1 grep export done | awk done
+-eu export then grep
+	test local "$@" test cd then --verbose /usr/bin test | done cd sed
+"$1" printf $(pwd) 2>/dev/null -eu awk "$1"
+		$(pwd) $(pwd) 'quoted text' 'quoted text' export ${HOME} "$1" printf readonly
+	x=1 $(pwd) 'quoted text' test grep x=1
+		${HOME} done test readonly --verbose
+	awk $(pwd) sed cd export done echo $(pwd) -eu | printf
+	x=1 printf "$@" -eu awk
+	2>/dev/null $(pwd) x=1 test ${HOME}
+		printf x=1 sed export cd "$@" printf then | cd echo "$1" export -eu
+'quoted text' local readonly printf -eu
+		printf && --verbose /usr/bin test --verbose
+	local 2>/dev/null done 2>/dev/null awk sed done 2>/dev/null "$@" grep awk echo 2>/dev/null
+local echo readonly 2>/dev/null x=1 && "$@" grep -eu
+/usr/bin local local sed then echo test
+&& done readonly local | $(pwd)
+	'quoted text' export 'quoted text' export x=1 done $(pwd) grep x=1 done then
+		--verbose "$1" 'quoted text' /usr/bin awk ${HOME} "$1" cd readonly
+	cd | cd printf $(pwd) test then "$1" cd | | test
+		"$@" sed | echo grep sed printf "$@" export done 2>/dev/null && -eu grep echo awk
+	cd 'quoted text' printf --verbose &&
+	2>/dev/null sed "$1" done echo /usr/bin export
+	awk 'quoted text' echo local
+		done then export 2>/dev/null test test -eu then "$@" awk cd ${HOME} grep -eu
+	| export then -eu test | 2>/dev/null
+	export echo -eu then awk ${HOME} 2>/dev/null 2>/dev/null
+"$1" "$1" 2>/dev/null -eu -eu /usr/bin printf
+		-eu local /usr/bin grep cd sed done "$1" awk -eu then export
+		x=1 2>/dev/null readonly "$1" grep awk readonly
+		"$1" then 'quoted text' echo -eu
+x=1 x=1 done then awk -eu && local sed --verbose 'quoted text' grep -eu
+	then test awk "$1" echo | $(pwd) done && "$1" sed -eu /usr/bin sed
+x=1 "$@" x=1 $(pwd) -eu | test grep /usr/bin readonly
+		| && "$1" awk cd -eu --verbose
+		done 2>/dev/null 2>/dev/null local sed /usr/bin
+	| cd --verbose sed grep printf ${HOME}
+		"$1" --verbose | /usr/bin 2>/dev/null test | awk awk local local
+then && test sed done "$1" export ${HOME} export sed then
+x=1 cd ${HOME} cd ${HOME} -eu readonly $(pwd) 2>/dev/null 'quoted text'
+'quoted text' readonly 2>/dev/null done "$@" test readonly --verbose test
+	2>/dev/null export /usr/bin local local then -eu "$@" && x=1 "$@" sed
+		done -eu $(pwd) 2>/dev/null export && 'quoted text'
+-eu test -eu /usr/bin test --verbose
+		local $(pwd) 2>/dev/null grep 'quoted text' "$1"
+	2>/dev/null export then echo done && $(pwd) sed done | awk --verbose "$1"
+		echo | export then /usr/bin cd /usr/bin readonly done ${HOME} done --verbose
+	sed /usr/bin x=1 'quoted text' 2>/dev/null "$@"
+	--verbose echo grep grep awk x=1 grep --verbose
+		sed x=1 echo test 2>/dev/null ${HOME} --verbose /usr/bin 2>/dev/null test
+		&& export readonly export readonly then readonly x=1 local ${HOME} local
+		local && awk done ${HOME} | cd
+&& cd awk --verbose $(pwd)
+	then test awk | "$@" && grep cd | "$@"
+		readonly --verbose grep 2>/dev/null && 2>/dev/null ${HOME}
+		then readonly --verbose cd $(pwd) -eu && ${HOME} local
+"$1" echo x=1 x=1 'quoted text' then export export | echo
+x=1 done ${HOME} 'quoted text' echo -eu echo done "$@" grep test echo echo awk
+	-eu local export cd -eu "$@" "$@" test
+local | echo && x=1 'quoted text' readonly
+		2>/dev/null test done test 2>/dev/null x=1 sed --verbose
+	"$1" then then ${HOME} export --verbose && sed ${HOME}
+	printf then readonly done $(pwd) "$1" -eu && 2>/dev/null --verbose awk ${HOME}
+local then "$@" $(pwd) then
+test | sed readonly sed x=1 grep awk && "$1" && grep echo | echo -eu ${HOME}
+		$(pwd) echo --verbose | printf awk awk "$1" -eu cd done x=1 "$1" awk "$@"
+		echo ${HOME} /usr/bin && ${HOME} test ${HOME} export
+	x=1 sed ${HOME} test | ${HOME} then
+grep /usr/bin local -eu cd printf | test | then grep export
+then readonly "$1" --verbose
+		$(pwd) $(pwd) "$1" export
+"$@" local grep && grep $(pwd) awk && $(pwd)
+	"$1" echo then grep export /usr/bin && grep && 'quoted text'
+-eu ${HOME} then && /usr/bin /usr/bin done
+		| grep && "$1" "$@" $(pwd) 'quoted text' "$@"
+		${HOME} 2>/dev/null echo && local done
+	printf /usr/bin -eu sed && $(pwd) cd x=1 done readonly then && grep readonly
+'quoted text' test "$1" ${HOME} 'quoted text' grep sed 2>/dev/null
+	echo "$@" then export
+	'quoted text' && sed 2>/dev/null --verbose printf export && /usr/bin export
+"$1" 2>/dev/null -eu | test local test --verbose $(pwd) x=1 "$@" && cd && /usr/bin
+		x=1 /usr/bin printf grep /usr/bin
+		sed ${HOME} $(pwd) "$1" readonly 'quoted text' 2>/dev/null
+		grep --verbose cd $(pwd) test 'quoted text' && readonly x=1 x=1 && ${HOME} local
+--verbose export echo | cd done export
+		awk "$1" cd --verbose && && $(pwd) ${HOME} readonly && echo 'quoted text' local
+		sed "$1" "$1" x=1 done /usr/bin local done | readonly --verbose
+		printf "$1" -eu && ${HOME} awk ${HOME} 2>/dev/null awk /usr/bin ${HOME} --verbose
+	readonly cd "$@" "$@" /usr/bin
+"$1" grep && ${HOME} | 'quoted text'
+	"$1" then echo local printf 2>/dev/null | | 2>/dev/null
+readonly "$@" then x=1 -eu && 'quoted text' x=1 export ${HOME} x=1
+		then /usr/bin "$1" "$1" -eu 'quoted text'
+	"$1" grep export ${HOME} local cd test done local cd /usr/bin
+echo --verbose test cd "$@" $(pwd) "$@"
+	printf then sed 'quoted text' ${HOME} &&
+		x=1 | "$@" then $(pwd) && -eu grep printf local test "$@" cd then test
+local "$@" test done $(pwd) grep --verbose | "$1" && echo then test "$1" local
+		done local ${HOME} printf export -eu sed printf
+		test --verbose export ${HOME} 2>/dev/null test sed "$1" export
+		sed grep $(pwd) 2>/dev/null readonly grep "$@" "$@" ${HOME}
+done export -eu -eu --verbose local printf then --verbose
+	| then 'quoted text' grep /usr/bin
+	"$1" echo "$1" ${HOME} ${HOME} grep | done /usr/bin /usr/bin "$@" -eu 'quoted text'
+--verbose --verbose 2>/dev/null export export grep | /usr/bin then --verbose
+	printf "$@" then 'quoted text' "$1" |
+		test 2>/dev/null readonly done done sed printf grep "$1" grep
+	"$@" ${HOME} export local readonly
+	test 'quoted text' export 2>/dev/null ${HOME} $(pwd) 2>/dev/null cd
+		then echo && done ${HOME} "$1" "$@" $(pwd) printf readonly && ${HOME}
+		x=1 | printf x=1 test --verbose grep "$1" 2>/dev/null 'quoted text' cd
+/usr/bin | awk --verbose 2>/dev/null "$1" "$1" /usr/bin | test then
+		echo sed 'quoted text' test | -eu x=1
+	echo $(pwd) echo echo $(pwd) 'quoted text' awk grep -eu /usr/bin
+x=1 "$1" done x=1 $(pwd) -eu cd x=1 sed done ${HOME}
+	"$1" cd sed local readonly 2>/dev/null
+	--verbose local ${HOME} local x=1 test
+readonly printf then done 2>/dev/null | readonly ${HOME}
+		readonly && done && ${HOME}
+printf --verbose 'quoted text' 'quoted text' export
+		"$@" grep "$@" grep ${HOME} grep cd readonly "$@" then $(pwd) done && awk 'quoted text'
+		--verbose printf /usr/bin --verbose && /usr/bin -eu test --verbose echo
+/usr/bin "$1" --verbose sed echo then sed 2>/dev/null test printf test "$1" local
+'quoted text' && awk 'quoted text' $(pwd) grep export "$1" export local sed
+	done /usr/bin "$1" 'quoted text'
+	local 'quoted text' test readonly
+	"$1" printf ${HOME} -eu
+"$1" export x=1 2>/dev/null
+	x=1 -eu "$@" -eu cd readonly awk
+-eu && awk export 2>/dev/null ${HOME} done
+	done readonly printf x=1 "$@" "$1" then 'quoted text' && awk then then
+	grep export $(pwd) "$@" | && --verbose echo
+	$(pwd) -eu -eu echo "$@"
+		printf ${HOME} cd export -eu --verbose local export /usr/bin --verbose 'quoted text'
+sed --verbose grep cd ${HOME} local awk local x=1
+	export ${HOME} 'quoted text' | /usr/bin
+readonly printf test export grep 2>/dev/null test | then -eu -eu grep --verbose
+		| ${HOME} printf echo export "$1" echo then local printf -eu -eu readonly
+&& sed 2>/dev/null then "$1" export
+"$@" grep awk "$1" ${HOME} $(pwd) cd printf /usr/bin "$1"
+echo test grep export ${HOME}
+		export test x=1 readonly "$1" printf export | then then
+	readonly "$@" cd $(pwd) local
+'quoted text' done cd 2>/dev/null test
+export cd awk 'quoted text'
+grep cd readonly printf $(pwd) x=1 readonly
+		&& $(pwd) grep $(pwd) done sed /usr/bin /usr/bin && $(pwd)
+	export export $(pwd) done --verbose test $(pwd) awk echo grep
+readonly local --verbose
+		| then grep echo local /usr/bin 'quoted text' echo 2>/dev/null
+echo --verbose readonly export
+		'quoted text' echo cd done sed && then done local ${HOME} | "$@"
+		readonly "$1" -eu "$@" && printf ${HOME} --verbose awk
+	done cd done awk printf "$@" echo grep done | 2>/dev/null test
+	2>/dev/null awk echo | done grep 2>/dev/null
+	printf /usr/bin awk -eu test 2>/dev/null then
+		&& ${HOME} local sed done 2>/dev/null then done then
+readonly 2>/dev/null $(pwd) cd then cd grep echo test "$1" && "$@" -eu /usr/bin
+	| x=1 /usr/bin done && "$@" 2>/dev/null && | 'quoted text'
+"$@" echo "$1" printf ${HOME} printf "$1" x=1 --verbose
+	${HOME} x=1 'quoted text' echo 'quoted text' "$@" 'quoted text' $(pwd)
+		'quoted text' $(pwd) "$1" ${HOME} /usr/bin
+		| 2>/dev/null "$1" "$1" $(pwd)
+	'quoted text' cd $(pwd) cd local echo ${HOME} /usr/bin -eu && ${HOME} test
+	"$1" -eu then -eu cd readonly readonly done export "$1" awk x=1 sed local
+${HOME} local | readonly 2>/dev/null readonly export test cd done "$@"
+	grep done 'quoted text' test grep /usr/bin
+		&& "$@" echo local cd export ${HOME} $(pwd) x=1 done echo && ${HOME} -eu printf
+	&& grep --verbose "$@" && --verbose ${HOME} readonly x=1 --verbose
+sed 2>/dev/null "$@" printf local --verbose local local /usr/bin awk x=1 then
+		"$1" grep -eu $(pwd) -eu awk cd done
+	-eu && cd | test echo then --verbose ${HOME}
+| test grep --verbose then
+	local /usr/bin local && echo "$@" done 'quoted text' ${HOME} awk "$1"
+	awk awk grep && sed x=1 echo local
+		cd "$1" echo -eu awk export grep $(pwd) sed test "$1" x=1
+	then ${HOME} $(pwd) printf test awk grep readonly -eu test 'quoted text'
+	&& echo export sed | 2>/dev/null /usr/bin 'quoted text' ${HOME} done 2>/dev/null
+"$1" x=1 printf readonly echo readonly 'quoted text' x=1 --verbose local
+		x=1 local test printf "$@" $(pwd) 2>/dev/null sed x=1 $(pwd) $(pwd) local printf
+		"$@" echo export 'quoted text' grep done printf && done local
+	"$1" "$1" printf && -eu readonly echo 2>/dev/null local
+	then 2>/dev/null awk sed | export "$@" x=1 -eu echo
+		local cd x=1 export awk sed awk printf "$@" "$1" "$@" export
+	awk echo readonly grep --verbose done
+	-eu printf echo ${HOME} printf
+	&& local cd then --verbose
+	--verbose x=1 "$@" printf $(pwd) local
+/usr/bin cd --verbose awk echo ${HOME} -eu 2>/dev/null $(pwd) export then /usr/bin
+echo local sed readonly 2>/dev/null echo local
+	test echo local 'quoted text' && grep 2>/dev/null ${HOME}
+--verbose readonly 'quoted text' printf
+	then 'quoted text' "$@" --verbose
+-eu ${HOME} printf | cd grep ${HOME} awk --verbose ${HOME} $(pwd)
+		$(pwd) readonly readonly 2>/dev/null
+	done local echo awk x=1
+	readonly && "$@" sed && printf --verbose x=1 'quoted text'
+echo x=1 | test | --verbose "$@" cd 2>/dev/null 'quoted text' | --verbose
+	printf x=1 cd $(pwd) && "$@" sed grep -eu /usr/bin echo
+readonly --verbose /usr/bin then --verbose
+cd done grep readonly 2>/dev/null $(pwd) 'quoted text' then 2>/dev/null
+'quoted text' "$1" printf then awk /usr/bin "$1" echo ${HOME}
+2>/dev/null && -eu grep && 'quoted text'
+		-eu echo && local 'quoted text' done "$@" 2>/dev/null local 'quoted text' readonly
+		-eu && "$1" awk "$@" local /usr/bin -eu "$@" | $(pwd) test export | sed -eu cd
+	export test 2>/dev/null && ${HOME} --verbose local
+awk sed test then "$@" x=1 | "$1" printf awk local export && export
+	awk awk /usr/bin /usr/bin grep export awk "$@" printf sed test "$1" &&
+readonly "$1" then echo echo 'quoted text' then 'quoted text'
+		'quoted text' -eu 2>/dev/null then done echo grep
+	"$@" grep done export && export 2>/dev/null
+		cd local local printf $(pwd) "$1" sed | done export /usr/bin x=1 echo $(pwd)
+	--verbose readonly readonly 'quoted text'
+2>/dev/null $(pwd) 'quoted text'
+'quoted text' local -eu sed
+	cd 'quoted text' printf -eu echo test readonly x=1 export && export printf
+		/usr/bin awk readonly test then x=1 x=1 'quoted text' /usr/bin printf
+		grep /usr/bin readonly 'quoted text' ${HOME} -eu /usr/bin
+	"$@" && "$@" cd x=1 "$@" x=1 x=1 x=1 grep |
+		then local && awk test $(pwd) --verbose | awk grep test then "$1" printf
+	then x=1 awk awk export then sed -eu cd /usr/bin export done $(pwd) |
+	readonly done /usr/bin
+&& cd && export then && grep && then printf /usr/bin sed
+export 2>/dev/null readonly cd /usr/bin local --verbose
+	echo $(pwd) local readonly "$@" ${HOME} grep "$1" "$@"
+&& export 2>/dev/null echo | printf
+awk echo 'quoted text' | awk /usr/bin "$1" grep printf
+	awk x=1 -eu awk x=1 /usr/bin /usr/bin echo && done sed sed ${HOME}
+		grep -eu "$@" 2>/dev/null $(pwd) test 'quoted text'
+	awk echo 2>/dev/null "$@" done readonly x=1
+		| awk echo 'quoted text' done 'quoted text' -eu $(pwd) "$@" local $(pwd) && /usr/bin
+awk /usr/bin sed "$1" 2>/dev/null sed /usr/bin grep
+sed done | 2>/dev/null --verbose
+local awk then x=1 readonly | then
+--verbose done printf awk test "$@" grep local x=1 awk && local readonly
+		sed /usr/bin awk grep 2>/dev/null
+grep cd done x=1 | $(pwd) local $(pwd) |
+	echo grep awk $(pwd) readonly "$1" 2>/dev/null readonly
+$(pwd) readonly -eu sed test 'quoted text' "$1" && $(pwd) awk
+		readonly export 2>/dev/null "$1" x=1 && 'quoted text'
+		grep x=1 cd cd ${HOME} export done grep
+		'quoted text' "$1" local ${HOME} | export
+	| grep 2>/dev/null "$1" then ${HOME} done done 'quoted text' done 2>/dev/null
+/usr/bin -eu | printf export
+		2>/dev/null && cd local 2>/dev/null
+2>/dev/null | readonly then x=1 "$@" 2>/dev/null
+		"$@" ${HOME} readonly done sed sed ${HOME}
+	/usr/bin | done 2>/dev/null ${HOME}
+		&& "$@" "$@" echo grep test
+"$1" done readonly awk && -eu 2>/dev/null done && echo "$1" "$1" "$@" then
+	export /usr/bin sed -eu 2>/dev/null grep printf
+		x=1 readonly $(pwd) x=1 $(pwd) $(pwd) $(pwd)
+	--verbose echo export "$1" then "$1" grep --verbose x=1
+	--verbose echo ${HOME}
+	export 'quoted text' 'quoted text'
+		local "$@" local --verbose export export done then "$@" 2>/dev/null
+	"$@" 'quoted text' grep echo
+	local && then 'quoted text' test $(pwd) printf printf -eu | local
+	echo 'quoted text' grep then then 2>/dev/null && then then printf "$@"
+		&& ${HOME} -eu x=1 readonly | 2>/dev/null
+	${HOME} -eu test awk sed cd
+&& echo sed ${HOME} --verbose
+		awk "$@" printf grep echo "$@" $(pwd) x=1
+	x=1 x=1 export $(pwd) ${HOME} done | done 2>/dev/null
+	"$@" 'quoted text' ${HOME} printf done /usr/bin export done grep /usr/bin
+${HOME} ${HOME} then local then ${HOME}
+		printf --verbose 2>/dev/null awk grep x=1 echo cd /usr/bin
+		| test grep "$@" "$1" readonly test printf "$@" "$1" -eu local
+echo export 2>/dev/null ${HOME} export awk 'quoted text' echo test
+		grep /usr/bin test printf | /usr/bin | done cd sed printf "$1" awk 'quoted text'
+		| grep 2>/dev/null readonly | readonly /usr/bin local echo local test "$@"
+	echo | --verbose x=1 x=1 then $(pwd) --verbose then "$@" sed done /usr/bin
+	awk /usr/bin -eu printf | $(pwd) readonly test
+printf readonly x=1 "$1" 'quoted text' ${HOME} local "$@" x=1
+"$1" "$1" /usr/bin grep && export printf done 'quoted text'
+	local echo 'quoted text' sed -eu "$1" local export 'quoted text'
+	/usr/bin cd export export 'quoted text' 'quoted text' sed echo cd |
+		local done then printf 'quoted text' then "$1" x=1 awk grep export
+	then | awk readonly --verbose then ${HOME} then "$@"
+#include c39.sh
+	local 'quoted text' readonly ${HOME} "$@" --verbose --verbose echo 'quoted text'
+	echo export --verbose -eu 'quoted text' /usr/bin grep local
+		printf then sed awk "$@" --verbose sed /usr/bin echo x=1 "$1"
+2>/dev/null done 'quoted text' 'quoted text' awk "$1" done awk printf
+--verbose grep "$1" 'quoted text' --verbose "$@" local
+		x=1 awk ${HOME} test x=1 cd $(pwd) test x=1 awk readonly
+		-eu sed echo /usr/bin 'quoted text'
+	echo x=1 | --verbose | export cd
+	$(pwd) awk /usr/bin $(pwd)
+x=1 x=1 grep export 2>/dev/null readonly printf "$@" ${HOME}
+	"$@" -eu done printf sed 2>/dev/null
+/usr/bin cd done x=1 cd /usr/bin sed done echo
+	--verbose "$@" readonly x=1 awk "$@" then 2>/dev/null cd "$@" $(pwd)
+	test sed then export awk -eu 2>/dev/null
+	grep "$1" --verbose 'quoted text' export ${HOME} cd 'quoted text'
+"$1" export cd awk x=1 -eu export "$1" local
+	${HOME} then 2>/dev/null then test
+	echo done echo --verbose
+	done cd x=1 done cd | printf cd awk
+	sed export local --verbose
+		'quoted text' sed done && /usr/bin test echo x=1 readonly
+	/usr/bin $(pwd) sed /usr/bin export 2>/dev/null echo "$@"
+		then export export 'quoted text' then sed grep --verbose $(pwd) echo
+"$1" readonly $(pwd) -eu /usr/bin cd grep "$1" x=1 /usr/bin
+--verbose awk then | | -eu -eu local local export cd then 'quoted text'
+test grep awk cd echo 'quoted text' ${HOME} /usr/bin /usr/bin
+2>/dev/null 'quoted text' then ${HOME} -eu printf x=1 -eu ${HOME} --verbose then
+awk done awk readonly | x=1 echo 'quoted text' "$@"
+2>/dev/null && sed -eu export 2>/dev/null 'quoted text'
+		export grep 2>/dev/null x=1 readonly then echo
+		"$1" local test x=1 then "$1" sed readonly
+	-eu "$1" then then local "$1" then --verbose awk printf done
+		$(pwd) --verbose /usr/bin cd sed "$@" 2>/dev/null grep ${HOME} sed then
+/usr/bin --verbose grep $(pwd) ${HOME} && echo "$@" echo awk --verbose
+export ${HOME} -eu /usr/bin test ${HOME} $(pwd) && | test
+	'quoted text' sed sed 'quoted text' local printf
+	sed echo readonly sed then grep sed 2>/dev/null
+printf export ${HOME} printf readonly "$@" /usr/bin "$@"
+		"$1" then 2>/dev/null echo cd "$@" cd 2>/dev/null printf -eu "$1" cd test
+		local local | -eu test 2>/dev/null 'quoted text'
+		grep then && test export "$1" sed /usr/bin readonly "$@" grep
+	'quoted text' "$1" x=1 2>/dev/null export grep && "$@" cd --verbose
+		printf x=1 readonly 2>/dev/null "$@" ${HOME}
+		local 2>/dev/null awk --verbose
+	export done awk local sed | echo sed printf
+grep done awk printf -eu grep
+		&& then "$1" awk --verbose then "$@" cd local
+		/usr/bin -eu echo grep 'quoted text' $(pwd)
+	2>/dev/null sed awk $(pwd) awk printf --verbose local grep test
+/usr/bin printf export printf
+export local /usr/bin readonly sed 2>/dev/null export 'quoted text'
+	cd test grep /usr/bin sed && $(pwd) && -eu printf cd printf readonly
+	&& readonly "$@" 'quoted text' $(pwd) $(pwd) | -eu readonly
+		sed x=1 $(pwd) done 'quoted text' $(pwd) printf
+| --verbose ${HOME} $(pwd) awk $(pwd) ${HOME} readonly
+		local x=1 "$1" "$1" sed --verbose && local
+		-eu then cd "$@" "$@" "$1" printf echo x=1 test -eu |
+	grep sed x=1 echo -eu --verbose
+	grep awk && echo 'quoted text' -eu sed cd --verbose readonly cd test
+	cd then export ${HOME} sed readonly done
+grep --verbose x=1 /usr/bin
+		done printf /usr/bin && cd then
+		"$1" /usr/bin export test "$@" "$@"
+	${HOME} /usr/bin test ${HOME}
+&& awk "$1" $(pwd) && --verbose 'quoted text' cd grep | 2>/dev/null
+echo 'quoted text' export echo echo then "$1" | 2>/dev/null
+	$(pwd) cd export --verbose then -eu -eu
+		"$1" awk | local $(pwd) then 2>/dev/null printf grep
+		| -eu "$1" awk && echo --verbose awk $(pwd) awk x=1 "$@" then 'quoted text'
+	done printf sed "$@" then 'quoted text' && then then export x=1 echo $(pwd) "$1"
+	export cd $(pwd) grep "$@" -eu local --verbose
+cd test then awk /usr/bin cd "$1" local awk printf awk
+	echo && ${HOME} export ${HOME}
+	$(pwd) echo test test local "$@" printf && test /usr/bin awk cd then
+		/usr/bin x=1 then done "$1" -eu readonly "$1" echo | x=1 readonly "$@" echo $(pwd)
+-eu echo 'quoted text' $(pwd) 2>/dev/null then grep
+-eu then && sed readonly export /usr/bin | 2>/dev/null
+-eu "$1" then sed x=1 | -eu 'quoted text'
+grep printf 2>/dev/null ${HOME} /usr/bin
+echo $(pwd) echo /usr/bin 2>/dev/null -eu $(pwd) awk x=1 echo cd 2>/dev/null
+test -eu readonly sed export done sed export ${HOME} 2>/dev/null cd echo
+/usr/bin sed /usr/bin readonly -eu awk /usr/bin
+		2>/dev/null then /usr/bin cd --verbose $(pwd) test && export 'quoted text'
+x=1 /usr/bin test test && cd | /usr/bin "$1" printf | "$@" | /usr/bin
+		readonly test then 'quoted text' -eu cd done readonly x=1 awk export -eu sed sed
+		"$@" sed "$@" export /usr/bin awk && ${HOME} && readonly ${HOME} && export
+| 'quoted text' cd 'quoted text' readonly echo cd $(pwd) then x=1 -eu && "$1" sed
+		printf echo --verbose 2>/dev/null echo --verbose local export readonly
+"$1" $(pwd) && --verbose printf
+	echo done ${HOME} "$@"
+test ${HOME} --verbose "$1" awk $(pwd) then 'quoted text' ${HOME} | $(pwd) export
+	printf ${HOME} awk -eu printf
+		echo readonly readonly awk done sed
+	/usr/bin ${HOME} readonly -eu
+		-eu echo "$1" grep --verbose && export awk sed && "$@" | printf --verbose done
+	/usr/bin $(pwd) readonly 2>/dev/null ${HOME} sed x=1 test
+		-eu 2>/dev/null "$@" 2>/dev/null export grep | echo "$@" printf then readonly
+	"$1" then export "$@" sed echo sed "$@" --verbose 2>/dev/null
+cd | export x=1 export --verbose "$1"
+awk grep "$@" readonly local readonly
+	-eu 'quoted text' cd "$@"
+		sed $(pwd) test printf echo && cd $(pwd) readonly awk then echo readonly
+printf awk $(pwd) printf x=1 $(pwd) x=1 export awk && -eu "$1" $(pwd) ${HOME}
+local 'quoted text' $(pwd) "$@" "$@" x=1 readonly done 2>/dev/null
+&& x=1 done done "$@" "$1" local awk 'quoted text'
+		'quoted text' awk done 2>/dev/null
+		2>/dev/null done done --verbose test -eu -eu /usr/bin
+	awk test sed local sed printf local | awk echo /usr/bin sed cd -eu sed --verbose
+/usr/bin x=1 x=1 $(pwd) grep test x=1 --verbose "$1" --verbose
+test then x=1 echo export then then echo "$1" x=1 readonly -eu 'quoted text' printf
+		2>/dev/null $(pwd) then "$@" then "$@" "$1" /usr/bin 2>/dev/null
+	test export "$@" -eu --verbose | echo sed x=1 echo cd 2>/dev/null grep
+cd -eu x=1 echo sed && cd local x=1 2>/dev/null
+awk awk --verbose grep export
+/usr/bin 'quoted text' printf 2>/dev/null cd test
+	done "$@" | "$@" grep export "$1" awk
+	$(pwd) ${HOME} "$@" $(pwd) 2>/dev/null cd --verbose test "$@" --verbose
+	echo x=1 | "$1" x=1 /usr/bin && && export | awk local grep "$1" export then local
+"$1" awk cd done "$@" "$@" done "$@" grep awk local done readonly
+		cd printf --verbose sed local "$@"
+	"$1" echo | 2>/dev/null "$1" test awk "$1" grep --verbose printf --verbose
+-eu /usr/bin /usr/bin local
+$(pwd) sed local grep $(pwd) | "$1"
+	&& --verbose export x=1 test test echo $(pwd) sed && cd printf
+		sed "$@" | 2>/dev/null --verbose 'quoted text' 'quoted text'
+printf export cd done $(pwd)
+	2>/dev/null sed then | -eu x=1 && sed local $(pwd)
+	export cd grep readonly readonly "$1" x=1
+		$(pwd) $(pwd) echo echo 'quoted text'
+		"$1" 2>/dev/null grep 2>/dev/null
+		printf "$1" /usr/bin done export readonly
+		$(pwd) sed x=1 -eu ${HOME}
+	${HOME} && -eu test local sed export local
+		-eu 'quoted text' | sed printf cd cd ${HOME} x=1 2>/dev/null
+export $(pwd) export $(pwd) && 2>/dev/null
+	done export export cd grep done ${HOME} readonly
+		"$1" test x=1 "$@" echo && |
+	${HOME} cd awk grep | echo echo local awk "$@" 'quoted text'
+/usr/bin sed printf export readonly done ${HOME}
+/usr/bin 2>/dev/null 'quoted text'
+	'quoted text' x=1 done echo --verbose x=1 readonly && grep "$@" && done
+	$(pwd) 'quoted text' cd test -eu then done then readonly
+		cd && then "$1" export then printf export test --verbose then /usr/bin
+	grep awk awk && && echo local export
+echo local awk --verbose
+		--verbose sed cd /usr/bin | echo test local done echo --verbose | 'quoted text'
+		done "$1" 'quoted text' export | echo grep echo && "$1" "$@"
+	cd readonly -eu 2>/dev/null
+	| grep printf -eu then $(pwd) echo --verbose ${HOME} | && x=1 done
+		/usr/bin grep cd sed -eu done awk && echo echo --verbose |
+		"$@" then printf awk then ${HOME} x=1 cd $(pwd) echo 2>/dev/null
+	readonly -eu $(pwd) readonly sed "$1" x=1 ${HOME} $(pwd) "$@" test 2>/dev/null
+	readonly sed 2>/dev/null ${HOME} -eu
+cd | cd done $(pwd) && sed
+grep export echo done then | readonly export echo echo ${HOME} echo awk export
+${HOME} 'quoted text' sed test awk
+	| "$@" ${HOME} grep printf --verbose done then printf sed export --verbose --verbose
+cd "$1" sed readonly -eu awk grep ${HOME} 2>/dev/null readonly 'quoted text'
+grep "$@" done local printf cd awk export
+	/usr/bin cd && | echo sed /usr/bin then local
+	'quoted text' ${HOME} 2>/dev/null
+	&& echo "$@" awk echo | &&
+		${HOME} then 2>/dev/null 2>/dev/null ${HOME} cd "$1"
+sed && done test echo "$@" "$@" ${HOME} | local then local printf
+		export -eu "$1" ${HOME} sed --verbose /usr/bin
+	readonly awk awk echo cd x=1 done ${HOME} local --verbose done && cd | echo
+		"$@" --verbose done | ${HOME} && local ${HOME}
+		${HOME} $(pwd) $(pwd) cd printf
+x=1 ${HOME} 'quoted text' readonly then "$1" 'quoted text'
+		echo "$@" readonly -eu 2>/dev/null awk 2>/dev/null local | then /usr/bin /usr/bin
+		readonly grep grep /usr/bin ${HOME} echo cd cd /usr/bin --verbose 2>/dev/null
+| echo sed echo readonly export
+readonly && -eu --verbose printf readonly grep grep test --verbose | ${HOME} awk
+	sed awk --verbose $(pwd)
+-eu $(pwd) sed 2>/dev/null echo | readonly
+	x=1 x=1 "$1" "$1" 2>/dev/null "$@" /usr/bin echo 2>/dev/null 2>/dev/null awk
+	export printf done x=1 test
+		"$1" ${HOME} grep awk $(pwd) | -eu ${HOME} | "$@" then awk &&
+	local $(pwd) 'quoted text' cd awk && done
+		local local awk $(pwd) grep done
+		local echo x=1 ${HOME} local cd
+		"$1" then local echo done test readonly
+		then | then x=1 local
+	local awk "$1" -eu test
+	--verbose test local echo
+local x=1 ${HOME} -eu export
+		'quoted text' cd 'quoted text' echo local "$1"
+	test done /usr/bin && grep local |
+		x=1 "$@" "$1" export
+		"$1" "$1" --verbose export ${HOME} printf
+local export sed done then test ${HOME} test printf sed "$1" ${HOME}
+	/usr/bin sed test --verbose x=1 cd local
+	readonly /usr/bin 2>/dev/null | 2>/dev/null test export && --verbose then
+		grep "$@" test "$@" ${HOME} "$@"
+		/usr/bin export test ${HOME} 'quoted text'
+	| 2>/dev/null test local ${HOME} echo test
+| "$1" cd && 2>/dev/null 'quoted text' echo | test sed 'quoted text' 2>/dev/null
+	2>/dev/null grep then sed export | --verbose
+--verbose $(pwd) printf sed awk sed
+cd test export then readonly
+		&& then /usr/bin grep local grep /usr/bin "$@" --verbose awk -eu done
+	"$1" /usr/bin echo echo
+		export printf -eu awk /usr/bin local awk --verbose then test /usr/bin
+awk /usr/bin local | echo
+		/usr/bin then readonly --verbose done done then -eu echo
+		x=1 then x=1 awk 2>/dev/null then test test "$1" x=1 /usr/bin
+echo printf readonly |
+| "$@" local 2>/dev/null cd $(pwd) awk "$1" test grep done 2>/dev/null
+	x=1 -eu $(pwd) printf "$1" printf --verbose
+	$(pwd) cd | local /usr/bin test
+		grep "$1" then && local ${HOME} echo x=1 ${HOME}
+	${HOME} done $(pwd) echo sed ${HOME} sed "$1"
+		printf printf 'quoted text' grep then
+	readonly cd 2>/dev/null | then /usr/bin 2>/dev/null grep && ${HOME} /usr/bin readonly
+echo "$@" printf --verbose sed echo
+| echo local 2>/dev/null local printf "$1" readonly grep 2>/dev/null | /usr/bin
+	x=1 "$@" awk test awk readonly 2>/dev/null ${HOME} grep ${HOME}
+	local 2>/dev/null cd ${HOME}
+readonly $(pwd) then cd
+--verbose done $(pwd) x=1 ${HOME}
+		done -eu "$@" sed /usr/bin awk "$1" test then echo grep awk 'quoted text' -eu
+		${HOME} 2>/dev/null printf
+		$(pwd) ${HOME} test then --verbose export --verbose
+		printf x=1 sed echo done x=1 then 'quoted text' 'quoted text' $(pwd)
+		then 2>/dev/null printf awk cd --verbose
+		printf printf | echo sed test awk awk x=1 $(pwd) --verbose
+cd grep test --verbose awk grep echo export
+	sed --verbose printf grep x=1 /usr/bin grep echo --verbose "$@" sed
+	grep readonly then "$@" 2>/dev/null
+	test grep grep printf "$@" local "$1" ${HOME} -eu printf --verbose
+		awk cd grep --verbose $(pwd) --verbose && done
+		test awk $(pwd) printf done && -eu grep sed "$1" done
+		&& sed -eu echo ${HOME} ${HOME} && && readonly && cd
+echo | x=1 readonly test done "$@" echo local
+	export x=1 printf awk /usr/bin $(pwd) test sed test cd x=1 grep ${HOME} -eu cd sed
+-eu test -eu local 'quoted text' /usr/bin then $(pwd)
+		then local && "$@" /usr/bin sed then awk && then 'quoted text' "$1" cd done "$@"
+sed && "$@" 2>/dev/null printf test 'quoted text' $(pwd)
+		then readonly awk echo grep awk echo && grep export ${HOME}
+${HOME} awk 'quoted text' | x=1 ${HOME} &&
+--verbose done awk | export export 2>/dev/null
+		&& printf awk $(pwd) "$1" sed readonly ${HOME} "$1" done /usr/bin
+	awk cd export test /usr/bin "$1"
+		&& && | cd ${HOME} 2>/dev/null
+		-eu readonly grep /usr/bin && local "$1" awk then
+	"$1" x=1 | sed printf grep echo then readonly /usr/bin --verbose | 'quoted text'
+	grep awk | then -eu 'quoted text'
+cd readonly sed && 2>/dev/null cd "$@" done 'quoted text'
+	sed local awk test /usr/bin /usr/bin
+	awk export /usr/bin local test x=1 2>/dev/null cd echo done grep x=1
+awk done awk then 2>/dev/null
+		export "$@" local test echo sed awk "$1" -eu && then --verbose awk readonly 2>/dev/null
+		2>/dev/null "$@" --verbose test --verbose
+		"$@" grep --verbose export "$@" done local echo
+${HOME} "$1" -eu ${HOME} -eu ${HOME} echo cd "$1" 'quoted text' x=1 2>/dev/null
+		export cd | awk test -eu export readonly then && then
+sed awk done && $(pwd) echo echo local
+2>/dev/null 'quoted text' then "$1" readonly /usr/bin
+	$(pwd) echo x=1 && | "$1" $(pwd) /usr/bin 2>/dev/null /usr/bin cd export
+		'quoted text' export 'quoted text' x=1 x=1
+		-eu readonly -eu echo | grep readonly -eu sed printf awk
+		| then export echo 'quoted text' echo sed cd && printf awk local -eu --verbose
+		grep sed "$@" export "$@" "$1" --verbose --verbose test x=1 --verbose
+	echo grep echo "$@" awk ${HOME} "$@" then local ${HOME} ${HOME} 2>/dev/null
+export "$@" "$1" then -eu readonly readonly local readonly
+"$@" --verbose $(pwd) ${HOME} ${HOME} local --verbose && && readonly
+2>/dev/null echo echo sed 'quoted text' ${HOME} export | export $(pwd)
+	'quoted text' awk local x=1 /usr/bin
+	grep $(pwd) x=1 cd x=1 printf | printf test 2>/dev/null
+${HOME} && awk /usr/bin local test -eu local echo
+${HOME} ${HOME} awk /usr/bin --verbose /usr/bin 'quoted text'
+		&& $(pwd) "$@" ${HOME} done "$1" echo --verbose sed "$@" "$@" ${HOME}
+		/usr/bin sed -eu | /usr/bin export
+then --verbose /usr/bin -eu cd echo && local --verbose
+export ${HOME} | readonly "$@" local cd "$@" --verbose ${HOME} -eu
+2>/dev/null echo echo /usr/bin grep -eu readonly echo
+	printf grep sed then && readonly readonly
+local export cd grep /usr/bin
+		local 2>/dev/null then | 2>/dev/null done | sed test grep readonly
+		cd 'quoted text' then sed --verbose test cd 'quoted text'
+	-eu | /usr/bin ${HOME} grep done export echo local done | | /usr/bin "$@" 'quoted text'
+cd awk 2>/dev/null $(pwd) local ${HOME} x=1 "$@" 2>/dev/null
+	| "$@" awk export --verbose readonly sed awk x=1 && "$1" grep
+x=1 grep $(pwd) 2>/dev/null $(pwd) done readonly
+	done awk awk x=1 then readonly "$1" -eu done
+		readonly --verbose 'quoted text' "$@" -eu done 2>/dev/null grep sed | export "$@"
+x=1 then "$1" local sed grep grep local test --verbose
+		x=1 'quoted text' echo done sed sed 'quoted text' cd cd && readonly
+	then $(pwd) x=1 done printf | "$@" ${HOME}
+		"$1" ${HOME} readonly 2>/dev/null local grep 'quoted text'
+test /usr/bin test local test x=1 local awk readonly
+		awk "$1" readonly printf && then ${HOME} -eu
+	grep x=1 test $(pwd) ${HOME} "$@" cd -eu awk --verbose
+	echo export grep /usr/bin "$@" $(pwd) grep awk echo 'quoted text' --verbose
+sed 2>/dev/null x=1 local local grep 2>/dev/null printf test cd sed "$@" sed
+&& awk printf "$1" "$@"
+		"$1" 'quoted text' awk awk x=1 'quoted text' then
+	| $(pwd) && test export $(pwd) readonly local echo 'quoted text' x=1
+	sed "$1" sed then 'quoted text' then done && readonly echo sed | "$@" sed
+done printf sed ${HOME} x=1 done --verbose sed
+	sed | x=1 x=1 /usr/bin cd test &&
+	'quoted text' test --verbose readonly --verbose sed -eu "$1" ${HOME}
+--verbose sed x=1 printf ${HOME}
+grep 'quoted text' 2>/dev/null local
+${HOME} readonly x=1 readonly $(pwd) && | readonly then readonly
+2>/dev/null | ${HOME} -eu "$1" cd 2>/dev/null cd /usr/bin --verbose
+	printf ${HOME} 2>/dev/null
+		awk -eu 2>/dev/null readonly
+		printf readonly echo printf done export $(pwd) printf readonly
+	-eu then then --verbose -eu -eu echo printf then -eu echo
+awk /usr/bin && sed done
+		"$1" echo local awk local echo test /usr/bin
+		$(pwd) sed -eu grep cd readonly
+sed then $(pwd) $(pwd) cd "$1" "$@" x=1 printf export ${HOME} grep echo
+		test -eu test 'quoted text'
+		local && /usr/bin local $(pwd) done done /usr/bin ${HOME} | test done && /usr/bin
+	| readonly --verbose readonly then cd /usr/bin
+echo echo readonly 2>/dev/null "$@" "$@" grep "$@" cd done /usr/bin export
+	-eu grep then test /usr/bin
+grep readonly export done 2>/dev/null
+x=1 test printf readonly
+	readonly /usr/bin export 2>/dev/null "$1" "$1" | 'quoted text' echo -eu && "$@"
+		sed sed /usr/bin $(pwd) done sed x=1 'quoted text' awk -eu ${HOME} grep cd
+		'quoted text' grep done ${HOME} /usr/bin then /usr/bin
+export done | test 2>/dev/null awk grep "$1" cd awk
+	-eu /usr/bin printf grep -eu local --verbose done cd grep && grep cd
+'quoted text' test --verbose
+		${HOME} 'quoted text' ${HOME} printf
+	2>/dev/null sed "$@" printf $(pwd) echo done ${HOME} awk "$1" awk && grep
+	2>/dev/null "$@" | export
+		grep 2>/dev/null echo | | /usr/bin readonly test ${HOME} 2>/dev/null export
+done awk 2>/dev/null | 'quoted text' x=1 "$@" cd then
+		${HOME} test "$1" "$@" then printf x=1 awk
+		local readonly | sed x=1 -eu readonly 'quoted text'
+	test test printf test test printf sed
+	'quoted text' ${HOME} printf ${HOME} | then sed then sed
+	x=1 /usr/bin local local local readonly printf local --verbose cd x=1 test /usr/bin
+	-eu test "$1" -eu --verbose 'quoted text'
+'quoted text' then awk ${HOME}
+	echo x=1 printf test 2>/dev/null $(pwd) readonly test then $(pwd) grep --verbose
+-eu export "$1" "$@" awk "$1" done echo printf
+	grep | $(pwd) $(pwd) | then export done done 2>/dev/null then cd | then cd then
+	echo export then 2>/dev/null test $(pwd) local $(pwd)
+readonly printf local readonly then
+	&& /usr/bin local $(pwd) local ${HOME} awk
+		/usr/bin x=1 done cd 'quoted text' export x=1 done -eu $(pwd) &&
+x=1 done --verbose | local
+		&& awk printf 'quoted text' && /usr/bin printf && "$1" | echo test
+		$(pwd) x=1 then sed export "$@"
+test awk /usr/bin | local then $(pwd) -eu x=1 cd ${HOME} done
+export "$@" && 'quoted text' ${HOME} x=1 | $(pwd) export grep /usr/bin
+		sed local then export local
+	grep 2>/dev/null grep "$@" --verbose && /usr/bin "$@" done ${HOME}
+	--verbose awk -eu "$@" --verbose cd readonly
+		"$1" $(pwd) -eu x=1 local sed
+$(pwd) x=1 "$@" grep $(pwd) --verbose sed | readonly
+		cd cd && ${HOME} cd grep cd ${HOME} test $(pwd) grep $(pwd) "$1" readonly
+	"$1" 2>/dev/null --verbose export readonly grep local -eu | | --verbose
+then printf /usr/bin echo "$1" awk -eu readonly grep "$1" "$@" awk done /usr/bin
+		/usr/bin "$1" && echo /usr/bin 'quoted text'
+	then && ${HOME} then && sed $(pwd) x=1 && -eu awk printf x=1 awk
+	grep "$1" done x=1 /usr/bin "$@" x=1 readonly echo export
+	done -eu test && done grep $(pwd) "$@" test echo && "$1" 2>/dev/null
+	| && --verbose cd /usr/bin cd grep
+		export grep -eu && /usr/bin $(pwd) x=1 echo export sed "$@" 2>/dev/null cd awk
+	readonly /usr/bin sed printf ${HOME} $(pwd)
+	| && cd then export then $(pwd)
+cd printf test && grep export && echo local cd | then "$1" $(pwd)
+		readonly -eu awk printf --verbose ${HOME}
+	test 'quoted text' --verbose --verbose x=1 && -eu grep export
+&& local test "$@" "$1" echo awk
+echo /usr/bin -eu readonly readonly then cd printf test | printf sed $(pwd)
+		grep done cd ${HOME} cd ${HOME} "$@"
+		done awk x=1 cd local grep ${HOME} 2>/dev/null
+echo readonly 'quoted text' test then /usr/bin local readonly then
+"$1" /usr/bin readonly x=1 x=1 && printf $(pwd) && export --verbose
+local 'quoted text' --verbose
+	grep echo 'quoted text' cd export grep awk 'quoted text' sed
+	x=1 test -eu echo readonly -eu "$@" export | && "$1" | $(pwd) | 2>/dev/null
+		--verbose x=1 2>/dev/null -eu awk export local test | x=1 /usr/bin
+	'quoted text' test printf ${HOME} | "$@" --verbose 'quoted text'
+		| grep sed "$@" local "$1"
+	-eu then sed && && test
+	awk local awk | test
+x=1 local && x=1 $(pwd) local test "$1" && awk --verbose $(pwd) then ${HOME}
+	--verbose 'quoted text' "$1" | $(pwd) -eu echo
+test sed grep test printf
+	--verbose ${HOME} /usr/bin "$1" printf printf 2>/dev/null
+${HOME} x=1 done 2>/dev/null
+--verbose 2>/dev/null x=1 2>/dev/null local done cd export export grep test
+awk 'quoted text' sed 2>/dev/null
+grep done sed ${HOME} cd test test /usr/bin --verbose readonly $(pwd)
+	echo --verbose /usr/bin $(pwd) export ${HOME} "$@" && ${HOME} $(pwd) --verbose
+	x=1 readonly awk printf -eu grep 'quoted text' /usr/bin && "$1"
+		$(pwd) "$@" $(pwd) /usr/bin sed echo
+| ${HOME} readonly done 'quoted text'
+then /usr/bin $(pwd) readonly done readonly
+	&& awk done && 'quoted text' echo && done ${HOME} | done 'quoted text' && 'quoted text'
+		"$@" && sed | local sed printf echo x=1 then
+	readonly local sed done printf
+		cd printf then ${HOME} x=1 then local done cd x=1 local readonly
+sed test grep --verbose
+export printf | grep done export local $(pwd) grep
+${HOME} export x=1 readonly "$1" done $(pwd) done then sed echo cd test -eu
+cd "$1" "$1" local ${HOME}
+-eu cd sed x=1 | done "$@" 2>/dev/null awk "$1" /usr/bin done cd "$1"
+then | test grep /usr/bin done done sed awk readonly
+	&& && | && | 'quoted text' x=1 | && sed "$1" echo
+$(pwd) awk sed "$@" grep && 'quoted text' 'quoted text' 'quoted text'
+		$(pwd) local "$1" && done && cd printf ${HOME}
+	--verbose "$@" 2>/dev/null 'quoted text'
+	$(pwd) awk readonly sed "$1" grep -eu cd /usr/bin $(pwd) sed 'quoted text' done
+x=1 2>/dev/null x=1 printf && cd local /usr/bin sed
+		readonly awk | test export sed $(pwd) && --verbose printf && 'quoted text'
+		-eu --verbose cd -eu cd local export readonly export -eu x=1
+readonly | "$@" readonly grep x=1 done "$1" awk "$@" /usr/bin readonly cd sed
+		&& | test readonly readonly --verbose --verbose cd 'quoted text'
+		echo | done && /usr/bin cd
+		awk done cd grep grep | ${HOME} "$@" --verbose 'quoted text'
+		"$@" "$@" awk && && $(pwd) 2>/dev/null
+awk test $(pwd) then done export echo cd readonly echo | ${HOME} printf
+cd 'quoted text' | && test export export && local ${HOME} $(pwd)
+	"$@" --verbose printf sed --verbose x=1 --verbose
+		echo echo 'quoted text' export
+local | ${HOME} "$1" echo readonly cd export ${HOME}
+		local test "$@" --verbose /usr/bin printf --verbose sed
+	printf /usr/bin echo readonly local local echo echo echo cd cd -eu ${HOME}
+		awk && test grep | export echo echo ${HOME} export "$1" cd readonly
+printf awk | x=1 printf test export echo && ${HOME} &&
+export $(pwd) 2>/dev/null && 2>/dev/null export 'quoted text' -eu "$1"
+cd grep sed ${HOME} then then then readonly cd
+test --verbose readonly echo "$1" 'quoted text' grep export echo export -eu
+	x=1 "$1" grep printf readonly --verbose then grep cd printf
+	--verbose local done cd local | cd cd grep sed --verbose "$@"
+sed -eu ${HOME} then local ${HOME} --verbose export grep cd awk "$@" grep
+x=1 'quoted text' echo -eu test readonly ${HOME}
+		export readonly echo $(pwd) --verbose ${HOME}
+	echo 2>/dev/null ${HOME} local "$@" 2>/dev/null cd 2>/dev/null ${HOME}
+		cd local ${HOME} awk ${HOME} | done then /usr/bin printf
+grep sed local awk grep readonly x=1 sed ${HOME} | --verbose
+2>/dev/null then grep --verbose then local then sed readonly grep
+/usr/bin sed grep $(pwd) /usr/bin 2>/dev/null $(pwd) echo && x=1 $(pwd) | test
+| $(pwd) 2>/dev/null awk awk 2>/dev/null grep -eu ${HOME} ${HOME} |
+		export /usr/bin awk printf then echo sed local then test
+local | echo awk | then && export printf cd | readonly
+	local readonly && readonly sed
+${HOME} 'quoted text' x=1 test cd test && done
+	local then local "$@"
+test "$@" 2>/dev/null x=1 -eu local done
+		"$1" $(pwd) ${HOME} local export cd ${HOME} /usr/bin /usr/bin | 2>/dev/null
+done 2>/dev/null then 'quoted text' readonly
+"$1" "$@" echo sed | sed $(pwd) | --verbose
+	2>/dev/null grep cd test grep | 2>/dev/null $(pwd) && "$@" "$1" echo /usr/bin echo
+	echo grep done test $(pwd) done
+		echo 'quoted text' | export readonly done | awk
+	cd readonly x=1 'quoted text' $(pwd) | done readonly echo
+	| sed then /usr/bin export $(pwd) sed grep
+	export awk then "$1" 2>/dev/null
+	"$1" then echo then x=1
+| $(pwd) | --verbose local printf --verbose x=1 local grep --verbose sed
+	'quoted text' test $(pwd) "$1"
+echo awk export sed /usr/bin
+-eu | x=1 then awk 'quoted text' export export
+printf "$1" $(pwd) x=1 grep /usr/bin test test $(pwd)
+	| 'quoted text' x=1 -eu done 2>/dev/null
+/usr/bin 2>/dev/null "$@" cd test 2>/dev/null
+		readonly sed x=1 ${HOME} awk printf $(pwd)
+	${HOME} printf | export ${HOME}
+cd /usr/bin grep $(pwd) awk "$@" readonly grep sed "$1" grep $(pwd)
+then printf test -eu awk export export export $(pwd) /usr/bin
+grep --verbose then && "$1" | done "$1" then "$1" awk x=1
+	grep printf awk "$@" awk && 2>/dev/null export | 2>/dev/null
+		2>/dev/null local $(pwd) | 2>/dev/null
+printf cd "$1" && grep && grep | -eu cd | $(pwd) "$@" awk 'quoted text' done
+$(pwd) test done -eu
+	2>/dev/null local then && done then "$@"
+	sed awk "$1" readonly && done -eu ${HOME} 'quoted text' x=1
+	export x=1 readonly then awk --verbose "$1" export /usr/bin cd ${HOME}
+	test && ${HOME} then $(pwd) ${HOME} awk echo sed awk --verbose
+&& "$1" $(pwd) ${HOME} local echo cd export echo echo
+	/usr/bin /usr/bin then x=1
+	export | cd sed grep then --verbose && export awk ${HOME} export done -eu cd then
+cd --verbose --verbose | echo sed $(pwd) printf | printf && grep grep awk
+		printf "$@" readonly cd test readonly ${HOME} done --verbose printf test
+	done cd printf printf $(pwd) $(pwd) ${HOME} $(pwd)
+		x=1 /usr/bin export sed
+'quoted text' cd readonly -eu /usr/bin x=1 test sed echo ${HOME} x=1 /usr/bin
+		awk /usr/bin awk 'quoted text' && --verbose export 'quoted text'
+	local | && printf local echo export cd local
+${HOME} awk /usr/bin && x=1 -eu "$1" "$1" $(pwd)
+	"$1" /usr/bin awk 2>/dev/null ${HOME} /usr/bin
+--verbose then printf local --verbose cd x=1 export awk --verbose "$@" --verbose
+		"$1" --verbose then then test
+	| done done export -eu /usr/bin
+		echo done x=1 && cd ${HOME} "$1" local
+$(pwd) $(pwd) ${HOME} sed printf readonly local sed echo export cd printf
+	grep printf printf export done && -eu sed awk -eu 2>/dev/null
+awk done 2>/dev/null grep then | awk 2>/dev/null then echo "$@" -eu
+then /usr/bin --verbose sed export
+	"$1" 2>/dev/null $(pwd) && ${HOME} | /usr/bin grep
+2>/dev/null $(pwd) $(pwd) awk
+		test sed echo local --verbose 2>/dev/null printf 'quoted text'
+		echo --verbose x=1 && && test 'quoted text' test $(pwd) test done x=1 &&
+	export then 2>/dev/null 2>/dev/null awk | local
+	printf test readonly "$@" awk cd test
+	2>/dev/null grep done
+&& grep export /usr/bin cd done printf --verbose readonly
+	$(pwd) 'quoted text' -eu awk readonly
+		then cd | "$@" cd ${HOME} printf /usr/bin cd then awk 2>/dev/null
+test done awk printf && && printf $(pwd) done ${HOME}
+x=1 local | "$1" readonly /usr/bin x=1 && ${HOME}
+readonly sed echo /usr/bin
+	then | x=1 readonly && 2>/dev/null ${HOME} local
+	echo readonly awk $(pwd) then /usr/bin grep local done cd x=1 "$@" local
+cd test "$1" then "$@" test printf grep grep $(pwd)
+test cd test "$@" --verbose && export awk echo 2>/dev/null
+$(pwd) awk awk export ${HOME} awk cd sed x=1
+	then 2>/dev/null awk done -eu test test $(pwd) --verbose cd "$@"
+	grep echo grep $(pwd) ${HOME} $(pwd) $(pwd) echo awk grep done
+local sed 'quoted text' 'quoted text' && echo then --verbose local
+	then $(pwd) /usr/bin /usr/bin /usr/bin x=1 --verbose ${HOME} $(pwd)
+	2>/dev/null x=1 2>/dev/null grep then $(pwd) $(pwd) x=1 readonly
+done readonly export $(pwd) sed
+		x=1 sed "$1" --verbose $(pwd) "$@" "$1"
+"$1" awk test readonly printf /usr/bin 'quoted text' local
+		local x=1 then readonly $(pwd) sed --verbose
+	awk 2>/dev/null 2>/dev/null test grep readonly awk echo --verbose ${HOME} awk
+x=1 then sed 'quoted text' -eu | "$1" sed cd 'quoted text'
+		awk printf 'quoted text' 2>/dev/null readonly && awk then "$@" grep "$1" export
+	test -eu printf cd done cd export 2>/dev/null x=1 export sed done grep ${HOME}
+		cd $(pwd) "$1" /usr/bin local export
+	"$@" /usr/bin printf awk $(pwd) awk -eu test awk readonly && 'quoted text'
+then && -eu export /usr/bin printf awk --verbose grep
+		| "$@" test then 'quoted text' 2>/dev/null
+"$1" "$@" | $(pwd) 'quoted text' printf sed echo test | export 2>/dev/null
+cd cd "$1" sed grep && 'quoted text' printf cd
+		${HOME} local --verbose awk echo grep -eu printf
+		"$1" && ${HOME} grep /usr/bin | 2>/dev/null /usr/bin
+	test awk sed $(pwd) done test export echo printf done test ${HOME} 2>/dev/null
+"$@" printf 2>/dev/null "$1" cd grep awk awk export "$@" "$1" ${HOME} grep test
+"$@" ${HOME} 'quoted text' x=1 local echo 'quoted text' && awk x=1
+		done local done awk -eu local $(pwd) && | 'quoted text' 2>/dev/null ${HOME} test
+		then grep && export echo then 'quoted text' ${HOME} then 2>/dev/null
+		| test --verbose cd done "$1" /usr/bin
+	"$@" ${HOME} then 'quoted text' | readonly cd then /usr/bin
+		grep export --verbose 2>/dev/null 'quoted text'
+	sed x=1 local $(pwd) printf echo
+		2>/dev/null -eu then && $(pwd)
+readonly x=1 sed local
+${HOME} cd "$1" "$@" "$1" "$@" $(pwd)
+		'quoted text' awk $(pwd) awk 2>/dev/null grep
+printf grep /usr/bin echo -eu cd test cd cd awk cd "$1" $(pwd) --verbose
+		echo export then /usr/bin | -eu export
+test cd x=1 then printf $(pwd) readonly
+	/usr/bin then 2>/dev/null done cd "$@" 2>/dev/null
+$(pwd) "$@" grep x=1 -eu export test
+		echo -eu done -eu | | /usr/bin cd
+		awk then ${HOME} printf test export -eu ${HOME} local grep --verbose x=1
+export $(pwd) $(pwd) x=1 -eu ${HOME} --verbose then 2>/dev/null local printf done
+/usr/bin $(pwd) && $(pwd) "$@" --verbose && awk -eu x=1
+	"$1" /usr/bin 'quoted text' /usr/bin && | then readonly
+awk sed done && sed ${HOME}
+		local "$@" 'quoted text' ${HOME} $(pwd) x=1
+	sed && x=1 echo ${HOME} echo /usr/bin then | /usr/bin $(pwd)
+		--verbose "$1" --verbose grep cd 'quoted text'
+${HOME} test ${HOME} &&
+		/usr/bin && cd test local echo readonly 2>/dev/null 'quoted text'
+	grep 2>/dev/null 'quoted text' test 'quoted text' "$1" test printf
+	grep test readonly /usr/bin "$1" local $(pwd) ${HOME} 2>/dev/null
+-eu echo then "$@" then ${HOME} echo local && $(pwd) grep test "$@" |
+		2>/dev/null 2>/dev/null --verbose grep | 'quoted text'
+	printf readonly grep grep printf test test $(pwd) 'quoted text' readonly | awk cd
+local grep | /usr/bin done export |
+-eu && ${HOME} readonly
+		readonly sed export ${HOME} readonly test printf "$1"
+		${HOME} /usr/bin grep then "$@" "$@" "$1" local grep sed export &&
+&& "$@" local && && done cd "$1" ${HOME} /usr/bin readonly local
+	grep | sed awk then export printf ${HOME} 2>/dev/null
+2>/dev/null ${HOME} done grep | && printf 2>/dev/null
+	readonly then printf "$1" readonly cd then cd "$@"
+test test | local cd echo "$@" "$@" then 2>/dev/null local
+		${HOME} "$@" -eu $(pwd) sed
+	${HOME} "$1" $(pwd) $(pwd) then then grep && ${HOME} "$1" cd then x=1
+printf local /usr/bin $(pwd) -eu sed x=1 "$@"
+	test 'quoted text' "$@" 'quoted text' local then export "$1" done x=1
+	readonly done sed "$1" then grep done "$@" printf done "$1" --verbose test
+sed local local /usr/bin local printf export
+	$(pwd) done cd cd 'quoted text' x=1 test cd
+		| /usr/bin -eu "$1" 'quoted text' | && cd local printf
+		sed ${HOME} | printf -eu && "$1" echo 2>/dev/null then awk awk
+	echo "$@" export printf cd "$@" grep cd "$1" "$@" grep && && "$@" awk 2>/dev/null
+	x=1 && printf printf ${HOME} | 'quoted text' ${HOME}
+	| sed -eu 'quoted text' x=1 && readonly $(pwd) then "$@" printf 2>/dev/null
+	'quoted text' ${HOME} done 'quoted text'
+| /usr/bin | test ${HOME} done 2>/dev/null done $(pwd) /usr/bin test 'quoted text'
+		echo && ${HOME} awk test grep cd "$1" awk "$@"
+	$(pwd) /usr/bin ${HOME} --verbose && readonly
+printf cd -eu then ${HOME} test export /usr/bin --verbose printf
+		'quoted text' | awk "$@" --verbose cd -eu | x=1 printf sed
+		cd -eu 'quoted text' then ${HOME} --verbose awk | $(pwd) 'quoted text' /usr/bin
+grep readonly echo grep
+		test -eu awk "$@" sed awk
+'quoted text' awk ${HOME} &&
+		2>/dev/null && && "$1" readonly $(pwd) done |
+		"$@" readonly export cd /usr/bin
+echo export then printf
+	export 'quoted text' 'quoted text' printf /usr/bin 'quoted text' readonly "$1"
+		cd ${HOME} "$1" | --verbose | echo | x=1 echo --verbose
+done local x=1 echo test --verbose awk sed -eu grep then echo then
+		x=1 export sed awk printf then /usr/bin printf "$@" /usr/bin
+		${HOME} done | cd "$1" grep export && "$1" cd cd /usr/bin
+printf /usr/bin echo
+		done printf then 2>/dev/null x=1 /usr/bin x=1 ${HOME} readonly x=1 test
+	"$@" export echo /usr/bin sed export done grep local "$@" $(pwd) "$@"
+printf "$1" /usr/bin ${HOME} local
+	done x=1 "$@" $(pwd) grep 2>/dev/null cd --verbose /usr/bin printf
+$(pwd) export awk -eu ${HOME} ${HOME} x=1
+sed "$1" $(pwd) test local x=1 'quoted text' --verbose
+		"$1" "$1" --verbose test "$@"
+		-eu printf --verbose $(pwd) "$@" 'quoted text' done x=1 sed
+"$1" $(pwd) x=1 sed 'quoted text'
+x=1 "$1" then local "$1" done cd | /usr/bin --verbose then && readonly /usr/bin
+	--verbose grep export | grep then grep --verbose echo x=1 | /usr/bin
+	sed && cd -eu printf /usr/bin local local /usr/bin
+grep sed then awk export local 2>/dev/null cd /usr/bin -eu $(pwd) grep
+	| awk $(pwd) $(pwd) local
+grep cd --verbose --verbose echo --verbose 2>/dev/null --verbose
+cd cd awk "$1" echo --verbose --verbose export "$1" "$1" -eu "$@"
+done -eu "$@" x=1 awk cd grep $(pwd) /usr/bin then | local
+	sed -eu done cd echo x=1 x=1 "$@" 2>/dev/null ${HOME} $(pwd) readonly "$@"
+	sed $(pwd) --verbose && | cd $(pwd) "$1" done test echo
+echo -eu local printf $(pwd) | -eu ${HOME} -eu
+	2>/dev/null awk x=1 readonly "$1" $(pwd) && test
+	"$@" done | x=1 --verbose readonly $(pwd) printf |
+	--verbose 2>/dev/null sed "$1" done sed 'quoted text'
+"$@" --verbose then sed -eu export "$1" printf
+		then readonly ${HOME} --verbose cd "$@" /usr/bin
+printf awk 'quoted text' 2>/dev/null echo x=1 /usr/bin cd && -eu "$1"
+grep x=1 local done cd
+		-eu echo export "$1" echo test echo 'quoted text' -eu grep
+x=1 --verbose done x=1 grep sed 2>/dev/null export done | | sed | ${HOME}
+	--verbose x=1 2>/dev/null done export
+	then test 2>/dev/null cd cd local then "$1" then /usr/bin
+	| export | -eu awk && echo local | "$@"
+	local "$1" --verbose -eu local --verbose
+	"$@" $(pwd) printf awk local then then && 'quoted text'
+		grep "$@" then -eu local --verbose grep "$1" done && ${HOME} "$1"
+"$@" ${HOME} sed printf 'quoted text' | $(pwd)
+		$(pwd) export | && readonly ${HOME} "$1" test 2>/dev/null "$1" sed
+	"$@" awk then 'quoted text' then printf sed test export --verbose echo grep cd --verbose
+'quoted text' 2>/dev/null $(pwd) "$@" --verbose
+		then done --verbose -eu grep grep "$@" sed
+	then "$@" /usr/bin awk readonly "$@"
+		&& /usr/bin /usr/bin test $(pwd) export cd test ${HOME}
+	test && cd awk "$1" printf cd grep x=1
+${HOME} echo cd cd ${HOME} ${HOME}
+test --verbose /usr/bin cd x=1 then 2>/dev/null cd | $(pwd) 2>/dev/null
+'quoted text' && echo export sed export readonly printf echo awk "$@" done then
+		cd "$1" local "$@" "$1"
+"$1" awk grep awk --verbose --verbose x=1 "$1" "$@" test echo && readonly
+		test 2>/dev/null done cd done export
+		2>/dev/null echo "$@" 2>/dev/null sed then awk awk -eu export && grep
+	--verbose done local "$1" x=1 echo | printf --verbose $(pwd) $(pwd)
+test ${HOME} echo awk printf local done awk "$@" -eu printf x=1 x=1
+	export printf done && 'quoted text' $(pwd) "$1"
+	then | local printf printf 2>/dev/null export 2>/dev/null /usr/bin | x=1
+/usr/bin cd grep ${HOME} 2>/dev/null $(pwd) done readonly sed | awk
+	$(pwd) done --verbose "$@" --verbose printf sed -eu /usr/bin readonly && 2>/dev/null
+		$(pwd) sed test /usr/bin cd awk --verbose
+	&& ${HOME} ${HOME} ${HOME}
+${HOME} cd echo $(pwd) done printf readonly
+		export --verbose --verbose
+done readonly 2>/dev/null 2>/dev/null --verbose done /usr/bin
+awk echo 2>/dev/null 2>/dev/null printf | "$1" "$1"
+printf then export printf test printf printf
+-eu sed export $(pwd) "$1" done sed grep grep cd echo | local sed
+		then 2>/dev/null $(pwd) -eu $(pwd) /usr/bin 'quoted text'
+		| | "$@" local export | | awk 2>/dev/null
+test awk echo awk /usr/bin export /usr/bin 'quoted text'
+done echo done cd ${HOME} x=1 x=1 sed then "$1" ${HOME} && /usr/bin x=1
+		grep readonly grep test printf
+grep readonly 'quoted text' grep readonly local -eu export
+	printf readonly x=1 printf readonly && 2>/dev/null /usr/bin ${HOME} ${HOME}
+		export test "$1" | done cd awk --verbose
+done ${HOME} readonly $(pwd) 2>/dev/null "$1" export echo awk readonly
+		| "$@" cd ${HOME} echo printf ${HOME} ${HOME} "$@"
+		awk then printf ${HOME} echo /usr/bin sed
+		grep local "$1" | /usr/bin ${HOME} -eu echo done local done
+${HOME} 2>/dev/null then printf ${HOME}
+	x=1 ${HOME} readonly done x=1 /usr/bin "$@" $(pwd)
+then then x=1 x=1 cd export
+awk echo "$@" export done 2>/dev/null 2>/dev/null local local $(pwd)
+		x=1 'quoted text' local 2>/dev/null
+		then 2>/dev/null x=1 $(pwd) grep cd grep then && && x=1 local x=1
+	local then cd grep cd "$1" grep 'quoted text' echo grep echo echo 2>/dev/null
+		$(pwd) 'quoted text' -eu -eu printf --verbose -eu /usr/bin
+&& awk 'quoted text' echo test --verbose export readonly awk done readonly
+sed /usr/bin cd --verbose --verbose | && grep $(pwd)
+	-eu awk export /usr/bin | "$@" grep printf 2>/dev/null | ${HOME}
+done test echo "$@" 'quoted text' export printf && awk $(pwd) readonly
+local then "$1" echo "$@" done local test $(pwd) test
+		done 'quoted text' x=1 /usr/bin readonly --verbose && && cd local cd
+		sed export 'quoted text' printf echo grep sed &&
+printf | x=1 && export --verbose local
+		"$1" | x=1 done export readonly cd -eu cd -eu readonly cd -eu -eu -eu sed
+	'quoted text' ${HOME} echo cd "$1" && awk echo --verbose --verbose
+		"$@" cd export ${HOME} 2>/dev/null && printf printf "$@" sed awk
+2>/dev/null test export echo /usr/bin --verbose $(pwd) echo | awk
+		"$@" "$@" then echo ${HOME} && sed sed echo
+	| $(pwd) /usr/bin sed awk grep echo 2>/dev/null local then $(pwd) sed |
+		2>/dev/null ${HOME} 'quoted text'
+	$(pwd) "$@" export done awk 2>/dev/null ${HOME} $(pwd) --verbose awk x=1 echo
+		sed -eu readonly --verbose local
+"$1" "$1" $(pwd) done "$1" export && -eu cd x=1 grep && && --verbose
+		local "$1" sed grep x=1 2>/dev/null "$@" local grep printf echo /usr/bin x=1
+	then cd readonly echo done -eu -eu "$1" then x=1 $(pwd)
+/usr/bin /usr/bin cd then ${HOME} "$1"
+	echo echo 'quoted text'
+	--verbose 'quoted text' readonly then ${HOME} awk cd && "$1" export "$1" ${HOME}
+		"$@" "$@" export grep /usr/bin sed --verbose done && awk x=1 awk cd grep echo test
+sed 'quoted text' sed then
+	test /usr/bin readonly ${HOME} ${HOME} test awk cd
+| "$@" "$1" 'quoted text' --verbose
+x=1 export | sed /usr/bin | --verbose 'quoted text' grep | grep
+	x=1 test local 2>/dev/null printf ${HOME}
+		done 'quoted text' $(pwd) local done echo --verbose local
+		awk grep then test --verbose test -eu local then $(pwd) | $(pwd) -eu -eu local
+	export $(pwd) | /usr/bin
+test 2>/dev/null 2>/dev/null done
+	export $(pwd) "$@" sed | 'quoted text' awk readonly $(pwd) grep then cd awk
+		x=1 x=1 -eu && cd awk readonly
+		'quoted text' -eu local 2>/dev/null $(pwd) test && -eu readonly sed
+done "$@" ${HOME} sed 'quoted text' "$@" printf then "$1" "$1" then 'quoted text'
+		test -eu echo $(pwd) | --verbose 'quoted text' done done | ${HOME} x=1 'quoted text'
+awk | done cd ${HOME} && done --verbose
+readonly grep 'quoted text'
+printf export x=1 then 'quoted text' "$@"
+		/usr/bin echo awk "$1" "$@" readonly $(pwd)
+		| then sed cd "$1" | cd --verbose 'quoted text' 2>/dev/null grep
+		export sed export sed
+		2>/dev/null $(pwd) echo "$@" "$@" -eu && | cd grep echo |
+| grep readonly 'quoted text' test readonly && 'quoted text' export $(pwd)
+	cd then printf readonly export && printf "$1" "$1" /usr/bin
+		grep && -eu cd ${HOME} local -eu done -eu 2>/dev/null
+		| /usr/bin --verbose && 2>/dev/null echo echo x=1 ${HOME} /usr/bin
+${HOME} | export x=1 ${HOME} "$@" export export grep 'quoted text' printf then
+		x=1 x=1 x=1 --verbose | x=1 /usr/bin local
+		readonly -eu export "$@" sed 'quoted text'
+		--verbose test awk ${HOME} ${HOME} echo then echo printf $(pwd) then grep
+		done && export test grep
+-eu 'quoted text' "$@" printf export grep | test -eu test /usr/bin | echo ${HOME}
+		test readonly "$@" echo 'quoted text'
+		readonly | cd export echo local readonly
+	cd 2>/dev/null 2>/dev/null /usr/bin then then awk test test "$1" /usr/bin
+&& local echo -eu export && | -eu 'quoted text' export --verbose
+		export | ${HOME} /usr/bin
+done sed readonly readonly "$1" cd 'quoted text' $(pwd) 2>/dev/null 'quoted text'
+	${HOME} readonly export 'quoted text' printf -eu awk "$@" done cd local
+	awk awk 2>/dev/null x=1 | done
+		sed printf | ${HOME} "$1" "$@" export --verbose
+		cd x=1 $(pwd) --verbose then
+	/usr/bin then | local cd test cd then cd export then grep -eu x=1 $(pwd)
+	cd sed 'quoted text' test && 'quoted text' --verbose x=1 'quoted text' --verbose
+"$@" readonly sed --verbose done
+printf /usr/bin -eu && | awk && grep
+	"$@" awk export -eu test ${HOME} printf echo ${HOME}
+	awk cd awk local grep ${HOME} local x=1 ${HOME}
+	then awk echo -eu then readonly grep $(pwd)
+done x=1 && sed awk 2>/dev/null
+	echo | /usr/bin test "$1" 2>/dev/null done "$1" then
+	sed then | readonly then $(pwd) 2>/dev/null grep test local
+		sed 2>/dev/null done /usr/bin test done 'quoted text' sed readonly --verbose
+test 2>/dev/null sed test "$@" x=1
+		&& echo x=1 grep printf 'quoted text' readonly grep awk grep local sed echo
+	readonly sed /usr/bin sed export
+$(pwd) cd -eu 'quoted text' x=1 ${HOME} echo echo "$1" "$@" ${HOME}
+		'quoted text' export "$1" echo awk echo 'quoted text'
+	'quoted text' 'quoted text' readonly && && done then local && /usr/bin printf
+		then local grep ${HOME} -eu readonly
+grep export "$@" "$1" then sed $(pwd) "$@" -eu $(pwd) local echo then test sed
+	awk sed x=1 "$1" done /usr/bin cd | export
+"$@" local --verbose && /usr/bin awk local | 'quoted text' "$1" test /usr/bin
+| "$1" "$@" cd /usr/bin && 'quoted text' test local 'quoted text' readonly
+	$(pwd) done awk sed $(pwd) --verbose "$@" then echo
+export -eu "$1" local
+		grep ${HOME} echo echo echo | sed "$@" local "$1" $(pwd) -eu export
+readonly ${HOME} && done done && awk grep
+	export 2>/dev/null $(pwd) 2>/dev/null
+	readonly 'quoted text' | -eu
+-eu 'quoted text' awk "$@"
+"$1" sed x=1 2>/dev/null readonly then then -eu ${HOME} ${HOME} 2>/dev/null export
+		sed readonly x=1 /usr/bin |
+local 'quoted text' ${HOME} cd done export x=1
+		| cd awk | && ${HOME} done
+	readonly then readonly sed 'quoted text'
+	-eu && grep printf 2>/dev/null echo printf
+		${HOME} cd cd | printf "$1" readonly test done $(pwd)
+		${HOME} 2>/dev/null --verbose cd 2>/dev/null
+		cd export ${HOME} x=1 x=1 readonly
+	"$@" echo cd awk sed cd ${HOME}
+		awk echo local test | grep /usr/bin awk /usr/bin "$1"
+done cd 'quoted text' | then "$1" 2>/dev/null grep "$1"
+	readonly cd --verbose 'quoted text' --verbose | --verbose then
+	$(pwd) awk && export "$1" local ${HOME}
+	cd $(pwd) && done done cd printf
+done | readonly then 2>/dev/null
+	-eu --verbose -eu readonly && export awk x=1 export $(pwd) "$@" x=1 | ${HOME}
+--verbose cd done 2>/dev/null local 2>/dev/null ${HOME} $(pwd) -eu
+		printf readonly "$1" printf -eu /usr/bin x=1 -eu && done printf
+		sed test --verbose /usr/bin 2>/dev/null echo readonly echo grep "$1" x=1
+	sed sed test awk x=1 cd awk ${HOME}
+		/usr/bin ${HOME} --verbose x=1 sed awk -eu cd test /usr/bin ${HOME}
+export | echo cd grep | done test ${HOME} 'quoted text' $(pwd) cd
+	export readonly ${HOME} --verbose | 'quoted text'
+x=1 grep echo x=1 $(pwd) readonly then /usr/bin -eu grep
+&& 'quoted text' export local
+		sed echo 'quoted text' 2>/dev/null ${HOME} printf -eu echo ${HOME} local --verbose
+	printf readonly export awk ${HOME} printf /usr/bin /usr/bin done
+--verbose echo sed $(pwd) awk cd x=1 printf test $(pwd) | readonly 'quoted text'
+		sed printf $(pwd) sed done echo export | 'quoted text' 2>/dev/null grep echo
+	export 'quoted text' "$@" x=1 grep --verbose readonly
+		grep "$1" echo 'quoted text' /usr/bin grep 2>/dev/null awk done grep $(pwd) && then
+/usr/bin printf local grep
+export $(pwd) 'quoted text' readonly export /usr/bin done
+	$(pwd) x=1 readonly then local "$@" test printf grep awk
+	then "$1" && echo 2>/dev/null done test $(pwd)
+		/usr/bin done --verbose done | "$@" "$1"
+test local /usr/bin grep test sed x=1 then export "$1" test x=1
+	2>/dev/null printf local 'quoted text' awk sed then | sed done readonly local x=1
+		$(pwd) 2>/dev/null x=1 cd $(pwd) ${HOME} && ${HOME}
+		local printf test local
+awk then /usr/bin ${HOME} 'quoted text' --verbose $(pwd)
+'quoted text' $(pwd) /usr/bin sed ${HOME} && sed echo sed |
+/usr/bin -eu sed x=1 "$1" done --verbose 'quoted text'
+		-eu readonly sed awk then 2>/dev/null
+	-eu printf grep "$1" "$1" && printf && ${HOME}
+$(pwd) x=1 then "$1" test local "$1" | readonly awk 'quoted text' grep grep "$1"
+		--verbose ${HOME} ${HOME} sed 'quoted text'
+cd grep x=1 local sed && export sed $(pwd) then readonly "$1" "$1" "$1" test --verbose
+		2>/dev/null local | 2>/dev/null "$@" then export /usr/bin x=1 then echo
+local "$@" grep 'quoted text' $(pwd) sed
+	grep test ${HOME} echo printf
+	'quoted text' 'quoted text' "$@" then "$1" /usr/bin -eu --verbose $(pwd)
+x=1 readonly local done test 2>/dev/null x=1 local
+local "$@" printf /usr/bin 'quoted text' ${HOME} --verbose done ${HOME} /usr/bin
+-eu awk "$1" sed printf then
+		-eu x=1 readonly | && --verbose | sed -eu
+	export export && "$1" sed local 2>/dev/null -eu "$1" then x=1 /usr/bin --verbose
+		echo awk cd 'quoted text'
+		&& -eu export grep 2>/dev/null -eu done ${HOME} $(pwd)
+	done sed cd x=1 export
+	export x=1 "$@" 'quoted text' ${HOME} done "$@" then awk sed echo "$@" /usr/bin
+		then /usr/bin readonly test "$1" export && done grep && then test ${HOME}
+		readonly --verbose export readonly cd
+		test --verbose $(pwd) "$@" export readonly x=1 && | | export $(pwd) $(pwd) local
+	done x=1 'quoted text' cd export test x=1 done 2>/dev/null
+		2>/dev/null readonly grep grep export -eu local cd readonly | local awk x=1 awk
+	"$1" 2>/dev/null "$1" done 2>/dev/null "$@" x=1 cd
+/usr/bin 'quoted text' then cd $(pwd) 'quoted text'
+		export grep -eu | 'quoted text' test cd "$1" echo test x=1 sed "$1" 'quoted text'
+	${HOME} | 2>/dev/null sed --verbose
+		-eu -eu ${HOME} printf export test ${HOME} then export /usr/bin
+		"$1" local x=1 && grep --verbose export "$1" "$1" sed test --verbose ${HOME} done
+	then sed "$1" ${HOME} 'quoted text' --verbose --verbose
+2>/dev/null readonly test && /usr/bin /usr/bin awk printf "$1" "$@" grep
+	printf echo 'quoted text' printf sed printf /usr/bin "$@" echo 2>/dev/null
+		--verbose 2>/dev/null echo /usr/bin
+&& 2>/dev/null readonly ${HOME} ${HOME} --verbose
+		${HOME} sed grep readonly grep sed | printf
+| "$1" awk local readonly echo $(pwd) 2>/dev/null
+x=1 export awk "$1" then ${HOME} awk export ${HOME} cd "$1" grep
+		cd "$@" export readonly && ${HOME} /usr/bin x=1 then then readonly
+readonly printf 2>/dev/null echo readonly "$@"
+	| local awk export printf printf "$@" awk 'quoted text' $(pwd) x=1 ${HOME}
+export ${HOME} export x=1 | grep printf printf ${HOME} 2>/dev/null 'quoted text'
+		export echo grep awk && done cd -eu 'quoted text' 'quoted text' "$@"
+	$(pwd) x=1 printf sed -eu cd echo grep done $(pwd)
+	local test ${HOME} done export -eu echo
+	x=1 2>/dev/null "$@" cd "$@" -eu "$1" $(pwd) test | | done
+		&& cd /usr/bin ${HOME} cd | awk && done readonly ${HOME} | test awk x=1 local
+		awk then && 'quoted text' ${HOME} echo | x=1 'quoted text' printf
+	$(pwd) -eu cd sed readonly cd $(pwd)
+x=1 "$1" awk awk local ${HOME} printf readonly ${HOME} --verbose /usr/bin
+printf | cd cd grep printf -eu grep done readonly "$@"
+	export grep -eu sed -eu && awk done printf | 'quoted text'
+	| | cd sed echo grep echo local local 2>/dev/null
+"$1" echo then local -eu && done /usr/bin ${HOME} -eu --verbose awk
+	sed done /usr/bin "$1"
+grep cd export /usr/bin awk && export
+	local $(pwd) 2>/dev/null readonly -eu cd readonly export 'quoted text'
+	readonly done then echo then
+/usr/bin 'quoted text' | readonly $(pwd) grep ${HOME}
+	printf done --verbose $(pwd) awk export -eu $(pwd) | ${HOME} 'quoted text'
+2>/dev/null | printf && cd /usr/bin 2>/dev/null export export /usr/bin -eu --verbose
+	| printf 2>/dev/null ${HOME}
+		${HOME} 'quoted text' /usr/bin export
+| awk "$1" cd export done "$@" echo "$1" /usr/bin 2>/dev/null
+		then /usr/bin grep test | printf | readonly local "$1" cd
+		'quoted text' cd --verbose sed "$@" done /usr/bin ${HOME} | readonly
+2>/dev/null then -eu test grep /usr/bin then | export
+test done test then then
+		| printf printf 2>/dev/null ${HOME} "$@" test done local 'quoted text' cd echo
+&& local 'quoted text' export 2>/dev/null $(pwd) readonly "$1" 2>/dev/null grep
+		"$1" echo grep export 'quoted text' local && export "$@"
+	test 'quoted text' "$@" && -eu echo readonly $(pwd) local done
+printf | awk grep then $(pwd) local local test && | -eu ${HOME} export x=1
+	| x=1 local cd /usr/bin
+	sed 'quoted text' awk | /usr/bin local /usr/bin echo "$1"
+2>/dev/null echo echo export cd $(pwd)
+	/usr/bin local | && export grep then --verbose --verbose
+		"$@" grep ${HOME} export $(pwd) "$@" then readonly
+-eu done test | grep local
+		'quoted text' printf printf | -eu echo && echo -eu /usr/bin
+	done -eu --verbose done /usr/bin --verbose readonly "$1" local
+		"$@" $(pwd) test "$@" cd 2>/dev/null "$1" 2>/dev/null awk -eu --verbose
+		--verbose then cd done local /usr/bin export cd --verbose $(pwd) 2>/dev/null
+		$(pwd) 'quoted text' readonly grep export awk -eu test grep printf sed -eu
+echo /usr/bin | test
+		'quoted text' 'quoted text'
+		local export x=1 test -eu $(pwd)
+		grep then | export printf ${HOME} printf "$1" local then readonly
+		printf readonly printf test
+	&& printf 2>/dev/null /usr/bin readonly 2>/dev/null sed grep grep sed done
+	awk done ${HOME} "$1" echo echo "$@" grep "$1" | --verbose
+then "$@" then | local awk grep $(pwd) local && printf 'quoted text' 'quoted text'
+		--verbose -eu | "$1" then /usr/bin /usr/bin
+		$(pwd) local 2>/dev/null cd -eu awk awk test printf 'quoted text'
+	grep grep $(pwd) | echo && "$1" | && /usr/bin
+		-eu "$1" export awk 2>/dev/null | printf then local -eu &&
+		$(pwd) | && x=1 "$1" printf echo local "$1" readonly sed --verbose "$1" printf printf
+done grep export grep x=1
+'quoted text' 2>/dev/null $(pwd) | printf
+		done "$1" && /usr/bin cd printf export x=1 "$1"
+		--verbose x=1 $(pwd) 'quoted text' printf test
+x=1 done grep export 'quoted text' cd
+local "$@" -eu printf && "$@"
+	then --verbose then --verbose awk export sed "$@" --verbose
+		x=1 "$@" readonly then ${HOME} then 'quoted text'
+$(pwd) sed done 'quoted text'
+		&& cd local sed readonly $(pwd) && export
+		done echo && && "$1" | $(pwd) echo done
+then ${HOME} export -eu test $(pwd)
+${HOME} export --verbose | echo readonly "$@" --verbose awk done
+	-eu readonly cd echo | test 2>/dev/null "$@" grep 2>/dev/null
+	done ${HOME} printf ${HOME}
+		grep ${HOME} grep printf done
+	awk /usr/bin x=1 2>/dev/null done export done | awk awk /usr/bin
+		x=1 | 'quoted text' done grep done local test -eu readonly "$1" && local local
+		printf 'quoted text' | done x=1 readonly && done "$@" ${HOME}
+	export "$1" $(pwd) -eu
+grep | cd /usr/bin 'quoted text' printf --verbose
+	x=1 echo x=1 "$1" x=1 -eu export echo grep then --verbose 2>/dev/null export
+	awk "$@" grep && && readonly awk "$1" 2>/dev/null
+	sed done local "$1" && 'quoted text' awk && export sed echo
+	"$1" ${HOME} 2>/dev/null cd | awk /usr/bin export 2>/dev/null printf x=1 ${HOME}
+		done | && done readonly 2>/dev/null 'quoted text' printf 'quoted text'
+awk echo "$@" local "$@" ${HOME} | 2>/dev/null grep readonly
+	| "$1" "$1" "$@" grep && sed then local
+	--verbose -eu export && local && && cd /usr/bin awk -eu 2>/dev/null done
+		grep grep export x=1 x=1 printf awk 2>/dev/null echo done && 2>/dev/null | echo
+$(pwd) awk printf then ${HOME} cd /usr/bin sed cd local export
+&& done && test test -eu
+	awk grep then ${HOME} 'quoted text' echo x=1 && local
+then test 'quoted text' printf grep export "$@"
+-eu --verbose $(pwd) done cd awk then | | export then grep && done local then
+		| --verbose 2>/dev/null
+	--verbose | then "$1" local awk sed x=1 sed sed grep "$1"
+		$(pwd) "$1" sed --verbose printf -eu &&
+		2>/dev/null export grep then && awk &&
+		export sed sed 2>/dev/null 'quoted text' sed local awk -eu --verbose
+		2>/dev/null /usr/bin ${HOME} -eu then
+	awk 'quoted text' | readonly 'quoted text' awk then readonly ${HOME} |
+	done test cd "$@" awk cd 'quoted text' done x=1 echo
+	&& && 'quoted text' --verbose 2>/dev/null printf grep -eu sed x=1
+	local | test done "$1" done export sed | done
+		export echo -eu ${HOME} && cd
+sed && done --verbose echo && --verbose echo $(pwd) && cd 'quoted text' cd
+		echo printf echo sed awk
+awk local "$@" printf x=1 sed $(pwd) 'quoted text' "$1" ${HOME} /usr/bin
+	2>/dev/null awk then --verbose sed && sed then cd -eu sed then then --verbose
+	| --verbose grep x=1 "$@" | awk awk sed --verbose grep 'quoted text'
+		$(pwd) && sed test awk local awk
+		/usr/bin test && awk cd "$1"
+		-eu grep sed cd sed printf ${HOME} ${HOME} 'quoted text'
+	readonly cd -eu readonly x=1 test /usr/bin grep
+	echo "$1" awk readonly
+		/usr/bin awk "$1" 2>/dev/null | x=1 -eu "$1" then grep /usr/bin
+	x=1 --verbose sed grep then &&
+printf "$1" done printf local printf 2>/dev/null cd 'quoted text' $(pwd)
+	x=1 x=1 2>/dev/null cd echo echo "$1" "$1" 2>/dev/null then 'quoted text'
+	local awk -eu local $(pwd) test test export grep
+	"$1" && sed export local
+-eu -eu echo echo ${HOME}
+	x=1 x=1 && "$1" test cd then -eu
+local done /usr/bin cd -eu printf "$1" test 2>/dev/null "$1" | /usr/bin printf
+/usr/bin "$1" grep local local done | && $(pwd) "$@" $(pwd) awk printf
+		${HOME} local done |
+	local cd local then sed test x=1 done "$@" printf x=1 then readonly ${HOME}
+	awk 2>/dev/null export 2>/dev/null | printf
+		export $(pwd) grep sed "$@" /usr/bin sed --verbose cd echo sed
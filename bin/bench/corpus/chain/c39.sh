@@ -0,0 +1,2001 @@
+		'quoted text' "$@" x=1
+sed done "$1" x=1 "$1" done printf
+		x=1 grep grep test x=1 --verbose cd 'quoted text' cd && readonly then -eu -eu
+	| sed grep cd $(pwd) done then grep | printf ${HOME} --verbose x=1 2>/dev/null
+/usr/bin local echo cd
+	-eu "$1" "$@" grep done export test /usr/bin
+		-eu awk echo 2>/dev/null then cd | | $(pwd)
+export done printf "$@" -eu echo sed x=1 2>/dev/null printf sed
+	sed echo local $(pwd) ${HOME} && | $(pwd) then x=1 'quoted text' 'quoted text'
+	awk 2>/dev/null printf then readonly ${HOME} sed
+		--verbose local awk "$@"
+		grep 2>/dev/null /usr/bin ${HOME}
+--verbose $(pwd) echo x=1 | "$@" $(pwd)
+		test 2>/dev/null $(pwd) $(pwd) awk "$1" printf --verbose
+	2>/dev/null "$1" readonly
+	cd export x=1 echo local readonly local -eu "$1" export grep
+&& export awk -eu 2>/dev/null test echo $(pwd) then /usr/bin test export x=1 "$@"
+	test ${HOME} readonly cd 'quoted text'
+"$@" cd export && 'quoted text' readonly && local /usr/bin
+		| "$@" && printf 2>/dev/null -eu echo $(pwd) awk 'quoted text' readonly
+		test echo cd | cd sed --verbose
+export test readonly awk readonly grep && grep printf 'quoted text'
+	| "$@" sed grep ${HOME} "$1" readonly
+		readonly $(pwd) 'quoted text' test "$1" -eu
+	readonly "$@" x=1 && && cd then -eu grep "$1" printf -eu /usr/bin
+	/usr/bin 2>/dev/null done export && then 2>/dev/null x=1 then cd && local
+	$(pwd) ${HOME} x=1 printf export -eu done echo done 'quoted text' awk --verbose
+	test grep sed x=1 awk "$1" /usr/bin "$1" $(pwd) "$@" ${HOME}
+		printf export printf echo export export local ${HOME} test
+		$(pwd) awk readonly sed $(pwd)
+awk readonly | printf test printf test
+	echo echo grep "$@" readonly then done grep "$1" -eu $(pwd) | grep /usr/bin echo
+	/usr/bin --verbose sed && $(pwd) readonly
+		readonly then sed "$@" readonly printf /usr/bin
+	"$@" -eu awk | export "$@" local awk done "$1" && --verbose test printf
+/usr/bin export sed grep ${HOME} cd sed 2>/dev/null awk awk 2>/dev/null echo
+	/usr/bin done then "$1" printf awk readonly /usr/bin echo
+"$@" readonly echo readonly 2>/dev/null
+${HOME} then /usr/bin && local cd && sed $(pwd) test
+then local $(pwd) cd test | $(pwd) "$@" printf test readonly "$1" cd echo
+	echo "$1" "$1" && sed "$1" echo "$1" "$1"
+awk done "$1" done 2>/dev/null && 'quoted text' test test done local && && ${HOME}
+		echo echo "$@" test test
+&& $(pwd) export | x=1 --verbose test 2>/dev/null
+	| readonly export cd cd awk then "$@" export sed x=1 "$@"
+	| done && sed test "$1" "$1" $(pwd) /usr/bin 'quoted text' grep ${HOME}
+cd ${HOME} test printf ${HOME}
+		printf then ${HOME} "$@" /usr/bin grep sed readonly echo
+2>/dev/null cd x=1 | 'quoted text'
+	echo readonly grep && then done "$@" "$@"
+		$(pwd) awk grep $(pwd) readonly grep test "$1" | awk ${HOME} x=1 echo
+		-eu /usr/bin x=1 ${HOME} -eu
+		then grep $(pwd) grep $(pwd) done cd "$@" local
+"$1" 2>/dev/null -eu test
+/usr/bin 'quoted text' ${HOME} cd "$1" done 'quoted text' $(pwd)
+awk grep grep done -eu -eu
+	/usr/bin 'quoted text' test "$@" readonly cd | export
+cd && && then grep x=1 local local readonly --verbose 2>/dev/null printf
+"$@" echo && ${HOME} readonly --verbose "$1" printf /usr/bin awk "$@"
+done grep local echo -eu "$1" grep "$@" then "$1" grep 'quoted text' | x=1 done
+grep x=1 "$1" --verbose done export "$@" 2>/dev/null echo test sed grep --verbose
+		cd /usr/bin export then "$@" export x=1 "$@" --verbose
+export "$@" then local printf -eu x=1 awk | --verbose
+		readonly export test awk sed
+		readonly done x=1 2>/dev/null -eu readonly && --verbose
+echo $(pwd) "$1" --verbose echo export "$1" | -eu sed x=1 local $(pwd)
+${HOME} export grep readonly local x=1 cd
+		then sed -eu "$1" echo test sed $(pwd) sed /usr/bin printf cd x=1 --verbose
+		readonly x=1 /usr/bin awk 2>/dev/null grep test export
+		sed awk cd "$@" grep awk -eu /usr/bin echo 'quoted text' sed local
+		--verbose "$1" sed -eu -eu /usr/bin
+cd | "$@" sed $(pwd) grep "$@" "$1" awk -eu x=1 local grep
+	grep | x=1 test local -eu sed 2>/dev/null
+	"$1" --verbose local then -eu grep "$1" x=1 local
+	readonly export x=1 then | test 'quoted text' sed x=1 --verbose done
+awk done readonly cd x=1 echo test
+done done "$@" done --verbose
+| awk --verbose 'quoted text' --verbose x=1 2>/dev/null then -eu awk -eu && readonly
+	"$1" -eu done "$1" | printf cd echo $(pwd) "$@" --verbose
+	awk cd /usr/bin /usr/bin && 'quoted text' "$@" 'quoted text'
+	sed "$@" export ${HOME} printf
+x=1 done export | /usr/bin 2>/dev/null cd echo test grep awk awk grep
+		export awk done 2>/dev/null 'quoted text' export then 'quoted text'
+		--verbose "$1" "$1" sed "$@" export test
+		${HOME} ${HOME} local "$1" 2>/dev/null | printf test echo "$@" --verbose readonly
+	export sed local "$@" local test then readonly awk 2>/dev/null && | x=1 --verbose
+-eu 2>/dev/null /usr/bin -eu ${HOME} test
+	export cd grep grep x=1 export ${HOME} "$@" -eu test
+		test done 'quoted text' -eu 'quoted text' && -eu test 2>/dev/null readonly test
+		| cd local 'quoted text' cd 'quoted text' "$@" grep
+then sed test readonly
+/usr/bin test -eu then echo "$@" && then ${HOME}
+		local cd printf 2>/dev/null done | | /usr/bin -eu echo awk /usr/bin
+	$(pwd) "$1" "$@" $(pwd) 'quoted text' grep export export x=1 "$@"
+${HOME} grep done --verbose --verbose then 'quoted text' echo export readonly
+		'quoted text' then && done cd $(pwd) then cd --verbose export 'quoted text'
+	test local grep 2>/dev/null cd && /usr/bin echo cd export local | grep
+$(pwd) grep ${HOME} | && echo ${HOME} sed done ${HOME}
+		2>/dev/null "$@" test "$1" done ${HOME} cd ${HOME}
+	--verbose then cd echo
+		grep "$1" grep --verbose awk cd printf && "$@" $(pwd) x=1 $(pwd)
+	&& 'quoted text' 2>/dev/null done -eu local && $(pwd) -eu printf && test 'quoted text'
+		x=1 sed 'quoted text' echo | grep "$@" x=1 $(pwd) | printf
+		printf then 2>/dev/null | readonly grep
+		export x=1 awk 'quoted text' sed printf
+		--verbose /usr/bin ${HOME} readonly test -eu --verbose
+		"$1" then | 'quoted text' test && x=1 && cd --verbose x=1
+		printf $(pwd) $(pwd) /usr/bin cd done /usr/bin 2>/dev/null
+		${HOME} --verbose grep echo --verbose
+	/usr/bin /usr/bin export readonly awk then /usr/bin -eu 'quoted text'
+printf awk 'quoted text'
+	export 2>/dev/null --verbose cd $(pwd) test done awk
+		printf printf 'quoted text' grep
+		/usr/bin ${HOME} 2>/dev/null --verbose "$@" done export
+	then x=1 --verbose 2>/dev/null
+		awk x=1 done done "$@" sed -eu /usr/bin x=1 test readonly test 2>/dev/null
+	sed sed -eu sed -eu export sed && test export test test export ${HOME} --verbose
+then 2>/dev/null /usr/bin grep readonly test /usr/bin
+		-eu $(pwd) grep ${HOME} export -eu | sed 2>/dev/null readonly 2>/dev/null
+	export x=1 awk 'quoted text' 2>/dev/null
+		"$1" echo 2>/dev/null
+/usr/bin --verbose awk then "$1"
+		grep printf ${HOME} then x=1 done done readonly grep 2>/dev/null && done
+		printf --verbose x=1 $(pwd) ${HOME} awk --verbose sed ${HOME} "$@" ${HOME}
+		test ${HOME} readonly cd 'quoted text' printf 'quoted text' cd /usr/bin
+		$(pwd) awk export $(pwd) sed awk grep readonly && x=1 done printf && cd && -eu
+		-eu 2>/dev/null export grep
+	echo local 2>/dev/null printf -eu sed -eu done
+		test local then done printf --verbose
+	"$@" && --verbose then export echo $(pwd) x=1 then
+		done printf -eu then echo 'quoted text' "$1" ${HOME} --verbose printf echo 2>/dev/null
+		cd echo /usr/bin 2>/dev/null /usr/bin test $(pwd) x=1 ${HOME}
+		-eu 'quoted text' --verbose echo
+		then $(pwd) cd test && ${HOME} | then printf
+	done sed 2>/dev/null 2>/dev/null $(pwd) local cd awk awk then awk "$1"
+&& | ${HOME} "$@" then /usr/bin test $(pwd) | test ${HOME} sed readonly
+/usr/bin done "$@" 'quoted text' $(pwd) ${HOME} "$@" cd 2>/dev/null printf | awk
+		x=1 && /usr/bin awk /usr/bin -eu | test
+	"$@" --verbose 2>/dev/null && export "$1"
+	local grep cd echo && then sed ${HOME} "$1"
+	local 2>/dev/null local test
+	| awk echo /usr/bin local sed /usr/bin awk then /usr/bin --verbose
+		done then -eu awk "$@" /usr/bin
+	--verbose /usr/bin x=1 readonly "$1" awk
+then 2>/dev/null grep x=1 local test 'quoted text' printf export
+		test printf awk "$@" /usr/bin ${HOME}
+		cd printf local test $(pwd)
+		cd $(pwd) export 'quoted text' echo awk printf "$@" $(pwd)
+2>/dev/null ${HOME} --verbose grep done ${HOME} "$@" readonly printf "$@"
+	"$@" 'quoted text' sed test
+test | then printf echo echo echo x=1 test
+awk $(pwd) -eu test done awk | test "$@" test
+	/usr/bin | local 'quoted text' awk test readonly /usr/bin done 2>/dev/null
+		grep echo | done test sed x=1 'quoted text' $(pwd) cd grep x=1 && local
+	echo $(pwd) $(pwd) printf then
+x=1 then done "$@" test 'quoted text'
+	printf -eu x=1 readonly 'quoted text' done $(pwd) /usr/bin
+	sed x=1 | sed $(pwd) local export test awk then 2>/dev/null
+	"$1" 2>/dev/null local /usr/bin test then 2>/dev/null
+cd printf ${HOME} readonly --verbose 2>/dev/null 'quoted text'
+cd 2>/dev/null then x=1 $(pwd) echo then "$@" "$1" grep printf sed
+	$(pwd) "$1" printf x=1 "$@" awk "$@" test sed cd readonly -eu echo
+readonly --verbose cd x=1 local | 2>/dev/null ${HOME} $(pwd) sed
+		readonly "$@" then --verbose "$1" then test awk | ${HOME}
+local "$1" /usr/bin printf readonly sed $(pwd) then | -eu x=1 -eu && "$1" awk readonly
+grep export printf export
+		echo export -eu "$1" 2>/dev/null 'quoted text' then -eu 'quoted text'
+	done export grep echo sed echo awk echo && printf printf
+	local then "$1" awk $(pwd) 2>/dev/null done $(pwd) | "$1" $(pwd) | cd done sed
+printf /usr/bin then /usr/bin export | 2>/dev/null 'quoted text' --verbose
+		| sed $(pwd) 'quoted text' readonly "$@" -eu sed test export x=1 test
+		grep "$@" -eu test printf test "$@" $(pwd)
+		-eu x=1 grep sed | "$1" -eu grep then ${HOME}
+'quoted text' grep cd ${HOME}
+		x=1 | -eu local | printf | grep cd 2>/dev/null && sed awk echo $(pwd) | -eu
+--verbose sed then 2>/dev/null -eu done "$1" awk -eu done
+	cd readonly $(pwd) x=1 x=1 | local x=1 'quoted text'
+-eu sed $(pwd) echo | sed local grep awk
+2>/dev/null export 'quoted text' grep
+		2>/dev/null -eu x=1 cd -eu local /usr/bin | "$1" -eu cd grep grep "$1" ${HOME}
+	"$1" -eu "$@" printf ${HOME} | cd cd cd /usr/bin x=1
+	grep printf test -eu local printf
+	awk 2>/dev/null 2>/dev/null
+-eu sed x=1 done $(pwd) export echo 2>/dev/null && test x=1 readonly
+| echo local test "$@" echo
+	then export then cd "$@" sed
+		| "$@" grep /usr/bin awk cd -eu && sed && && "$@" export
+	done /usr/bin local grep && test export
+		test 'quoted text' export cd
+cd echo | local | test echo readonly 2>/dev/null
+		grep $(pwd) 2>/dev/null export grep "$1" /usr/bin 2>/dev/null
+'quoted text' echo sed then
+test /usr/bin sed "$1" --verbose cd 'quoted text' export $(pwd) local readonly
+cd 2>/dev/null 2>/dev/null && /usr/bin cd sed cd sed "$@"
+	'quoted text' sed local | export
+x=1 sed 'quoted text' readonly cd --verbose
+	then ${HOME} x=1 local | $(pwd) -eu 2>/dev/null
+	-eu readonly echo | echo export
+$(pwd) then 2>/dev/null 'quoted text' grep | 'quoted text'
+then | --verbose $(pwd) "$@" then x=1 | ${HOME} local x=1 printf
+	2>/dev/null test done $(pwd) ${HOME} sed | sed cd printf
+x=1 2>/dev/null cd awk readonly
+cd sed /usr/bin ${HOME} printf
+	readonly then | echo done echo && "$@"
+		readonly then /usr/bin done awk awk cd -eu readonly
+		$(pwd) "$@" "$@" "$@"
+&& grep | awk 2>/dev/null
+		-eu x=1 /usr/bin printf -eu readonly then then
+	printf 2>/dev/null x=1 x=1 "$1" --verbose
+	readonly printf /usr/bin x=1 "$1" printf done -eu 2>/dev/null then readonly
+--verbose test sed x=1 echo "$1"
+	readonly awk cd export awk && then local echo export -eu 2>/dev/null local
+	readonly | awk local local 2>/dev/null 2>/dev/null local x=1 $(pwd) readonly
+		&& then echo x=1 export export then | echo printf
+		local /usr/bin export ${HOME} "$@" --verbose 2>/dev/null $(pwd) "$1"
+	done 'quoted text' && sed /usr/bin awk done local then local readonly
+		/usr/bin then 'quoted text' 2>/dev/null $(pwd) local readonly cd test "$@" x=1
+-eu local x=1 done "$1" sed x=1 | /usr/bin then
+	2>/dev/null then -eu cd sed && | sed grep awk export export export export
+grep sed echo x=1 sed export 'quoted text' test cd readonly sed grep export export
+	| awk test test "$@" then 2>/dev/null awk "$@" -eu sed | | 2>/dev/null
+awk echo /usr/bin x=1 awk
+then | then ${HOME} /usr/bin $(pwd) printf
+	printf && cd grep local
+		-eu ${HOME} cd echo test $(pwd) printf "$@" awk "$@" 2>/dev/null local readonly
+		grep echo $(pwd) $(pwd) test
+| local readonly $(pwd) awk /usr/bin
+	x=1 x=1 grep echo | awk "$1" | grep test /usr/bin ${HOME} "$1" export printf
+		"$1" echo -eu /usr/bin 'quoted text'
+${HOME} printf done sed local && $(pwd)
+		echo done | 'quoted text' x=1 test cd local awk export
+	then -eu "$@" test grep 2>/dev/null grep grep --verbose /usr/bin
+	--verbose --verbose ${HOME} x=1 test
+done x=1 x=1 'quoted text' test $(pwd)
+-eu x=1 $(pwd) echo 'quoted text' awk awk readonly && test "$1"
+	x=1 local then sed test then "$@" && --verbose then
+test cd "$@" sed 2>/dev/null echo --verbose
+"$@" awk --verbose "$1" printf echo awk awk | done | then awk
+/usr/bin $(pwd) done --verbose
+	printf && sed x=1 echo local echo local printf printf /usr/bin
+grep awk | readonly printf x=1 --verbose then readonly
+	then -eu && done 'quoted text' ${HOME} done $(pwd)
+		${HOME} then --verbose $(pwd) echo
+		'quoted text' export test ${HOME} then && 'quoted text'
+local && "$@" grep echo done local $(pwd) ${HOME} x=1 cd /usr/bin sed 'quoted text'
+2>/dev/null $(pwd) grep -eu ${HOME} export sed test 'quoted text' test local
+		then readonly grep export /usr/bin --verbose
+done 'quoted text' /usr/bin
+		readonly sed printf export printf sed grep sed printf
+	echo -eu then done && 'quoted text' readonly |
+	$(pwd) echo -eu awk echo sed
+	-eu -eu export -eu 2>/dev/null --verbose awk then | sed ${HOME} awk
+	$(pwd) export 2>/dev/null x=1 -eu printf 'quoted text' -eu grep local then
+		printf | done export 2>/dev/null "$@" sed -eu echo export printf
+		grep "$1" "$@" /usr/bin && $(pwd) --verbose grep export "$@" cd grep awk
+&& && then x=1 && echo --verbose
+		sed -eu x=1 2>/dev/null && cd grep sed sed | -eu "$@" 'quoted text'
+		cd 2>/dev/null echo "$1" "$@" test 2>/dev/null 2>/dev/null
+	readonly x=1 ${HOME} readonly --verbose | $(pwd)
+	| 2>/dev/null readonly "$1" | /usr/bin readonly printf
+-eu awk export local done $(pwd) $(pwd) test "$@"
+		&& awk cd readonly | "$1" printf then -eu test
+		${HOME} done test $(pwd) then readonly $(pwd) then && "$1" "$1" --verbose
+		$(pwd) export test "$@" done sed | readonly test 2>/dev/null $(pwd) readonly
+then "$@" test sed 2>/dev/null 2>/dev/null printf 2>/dev/null
+cd echo x=1 x=1 ${HOME}
+		$(pwd) echo then local awk x=1 sed
+-eu awk awk $(pwd) "$1" "$1" sed | && 2>/dev/null sed done printf "$1" sed
+		'quoted text' x=1 then 'quoted text' readonly export /usr/bin
+		cd readonly 2>/dev/null export 'quoted text'
+	$(pwd) x=1 local $(pwd) 2>/dev/null ${HOME}
+"$1" | && ${HOME} cd export awk done "$@" sed export 'quoted text' | | echo
+printf $(pwd) cd -eu export ${HOME} printf awk
+	2>/dev/null test done grep ${HOME}
+"$1" echo /usr/bin then "$@" then sed
+	| --verbose x=1 printf sed --verbose x=1 2>/dev/null
+2>/dev/null test $(pwd) $(pwd) printf printf && printf echo ${HOME} &&
+		echo test export "$1" x=1 done test sed test awk test "$@" export printf
+echo local cd cd && done export | cd awk "$1" "$1" then x=1
+	${HOME} "$@" done echo
+		readonly ${HOME} export 'quoted text'
+'quoted text' -eu "$1" done $(pwd) echo ${HOME} $(pwd) $(pwd)
+test grep && readonly -eu "$1" sed x=1 2>/dev/null && x=1 grep $(pwd)
+	| readonly "$1" sed local ${HOME} done "$@"
+| $(pwd) "$1" && 2>/dev/null
+2>/dev/null -eu | | "$@" local local && awk -eu awk 2>/dev/null "$@" done
+		awk | readonly export /usr/bin awk awk $(pwd) --verbose /usr/bin /usr/bin
+		readonly 2>/dev/null done then
+-eu done test readonly ${HOME} 2>/dev/null && -eu 2>/dev/null
+awk --verbose sed cd done
+	"$1" test && --verbose readonly 'quoted text' x=1 done "$1"
+	printf cd && export ${HOME} awk test printf printf x=1 done echo done
+		test | 2>/dev/null cd && then done
+		2>/dev/null echo printf done -eu
+	-eu sed 2>/dev/null printf sed test
+		${HOME} then export -eu local done | export
+readonly ${HOME} && export echo cd then $(pwd) "$1" grep test && && &&
+		cd -eu echo cd awk $(pwd) test export
+test test /usr/bin x=1 cd --verbose ${HOME} readonly
+	x=1 echo && ${HOME} done
+		echo cd grep "$1" echo ${HOME} export
+	sed awk --verbose | local grep && local
+sed printf test "$1" printf $(pwd)
+export x=1 export test "$@" then /usr/bin local printf $(pwd) sed 2>/dev/null
+/usr/bin done then done test 2>/dev/null --verbose -eu $(pwd)
+2>/dev/null printf cd test test 'quoted text'
+		awk ${HOME} && done $(pwd) -eu sed -eu
+| echo sed 'quoted text' cd | ${HOME} "$@" -eu ${HOME} sed
+		| --verbose grep "$@" -eu printf cd x=1 $(pwd) readonly && --verbose
+	echo x=1 --verbose -eu sed --verbose
+echo done grep grep cd /usr/bin && printf 'quoted text' x=1
+	| | awk ${HOME} && then
+	$(pwd) export --verbose "$1" readonly "$1" sed echo
+		printf grep grep ${HOME} printf -eu 'quoted text' done -eu
+		&& test && then ${HOME} 'quoted text' local x=1 then x=1 awk grep echo 2>/dev/null
+	x=1 x=1 awk local echo readonly /usr/bin
+'quoted text' printf echo done
+		2>/dev/null grep x=1 | "$1" "$@" | grep done 'quoted text'
+echo then "$1" then "$1"
+sed | x=1 export then
+	printf done 2>/dev/null && cd
+-eu then then then sed -eu /usr/bin "$1" $(pwd) readonly "$1"
+	printf local -eu then x=1 "$1" then local 'quoted text' test grep done done |
+		$(pwd) readonly -eu 2>/dev/null printf --verbose "$1" 'quoted text' 2>/dev/null
+		2>/dev/null x=1 "$@" local -eu $(pwd)
+		"$@" cd "$1" grep echo && cd printf $(pwd) && ${HOME} echo export
+"$@" grep cd x=1 readonly x=1 $(pwd) /usr/bin export done export cd "$@"
+/usr/bin printf "$@" export cd then "$1" local $(pwd) done -eu export cd
+printf --verbose cd -eu x=1 -eu
+		$(pwd) /usr/bin --verbose --verbose /usr/bin
+cd cd --verbose local readonly export
+		grep ${HOME} awk "$1" 'quoted text' echo /usr/bin x=1 ${HOME}
+	then cd test | && readonly --verbose --verbose
+then then printf done "$@"
+		$(pwd) printf x=1 cd printf && grep "$@" --verbose cd grep | "$1"
+	sed "$@" 'quoted text' grep "$1" 'quoted text' "$@" 2>/dev/null "$@"
+		awk grep x=1 $(pwd) sed export cd then $(pwd) local
+		$(pwd) readonly "$@" ${HOME}
+/usr/bin readonly /usr/bin readonly 2>/dev/null /usr/bin
+2>/dev/null | cd echo export then -eu /usr/bin export x=1 export done 'quoted text'
+awk --verbose printf cd "$@" ${HOME} 'quoted text' test
+	done then grep readonly | -eu awk test test
+&& readonly readonly
+		export "$@" export then x=1 done | "$1" -eu "$@" echo
+	test ${HOME} $(pwd) /usr/bin -eu then done test | done && 2>/dev/null printf
+	$(pwd) done && 'quoted text' "$@" printf readonly | "$@"
+sed done printf readonly -eu printf ${HOME} local 2>/dev/null $(pwd) "$@" cd $(pwd)
+		${HOME} local local ${HOME} test x=1 local awk export "$@"
+		${HOME} readonly then cd | --verbose test test
+local $(pwd) echo cd cd export then ${HOME} "$@" "$1"
+		--verbose -eu done && grep --verbose export echo ${HOME} export 2>/dev/null
+		cd cd then -eu --verbose sed 2>/dev/null then "$@"
+	-eu awk echo then 'quoted text' 2>/dev/null "$@" ${HOME}
+test && x=1 -eu | "$@" export then grep awk x=1 && /usr/bin 'quoted text' $(pwd)
+	test ${HOME} && done done "$@" "$1" local
+then | grep 2>/dev/null "$@" then 2>/dev/null /usr/bin sed /usr/bin then sed
+		local awk ${HOME} && readonly awk export
+	export sed /usr/bin local readonly
+		readonly "$1" sed test echo
+	cd --verbose "$1" sed "$@" $(pwd) "$@" echo printf cd
+x=1 printf "$@" $(pwd) "$1" export then | &&
+cd grep x=1 /usr/bin $(pwd) --verbose export
+	local awk 'quoted text' && sed x=1 "$1" | printf readonly grep cd 2>/dev/null
+		export "$1" | grep && --verbose 'quoted text' && x=1 awk
+		x=1 done "$@" cd 'quoted text' |
+	'quoted text' sed printf "$@" awk /usr/bin
+	sed 2>/dev/null -eu -eu "$@" && awk 2>/dev/null -eu then echo $(pwd) 'quoted text'
+2>/dev/null awk "$@" /usr/bin echo x=1
+	test printf /usr/bin cd -eu -eu awk ${HOME} "$1" ${HOME} --verbose
+	$(pwd) sed cd printf && 2>/dev/null sed export sed 2>/dev/null
+	2>/dev/null ${HOME} test "$1" "$1" && then local "$@" $(pwd)
+${HOME} | x=1 'quoted text' test "$@" -eu sed --verbose done grep sed
+echo grep then -eu | &&
+	export sed /usr/bin /usr/bin cd && echo "$@" /usr/bin sed "$@" x=1 && "$@"
+	| readonly $(pwd) && 'quoted text' local readonly echo readonly 'quoted text'
+/usr/bin awk x=1 then "$@" cd ${HOME}
+cd $(pwd) "$@" --verbose $(pwd) "$@" --verbose 'quoted text' then && "$1"
+	grep readonly test then /usr/bin cd test "$@" local -eu sed
+'quoted text' then x=1 grep && export readonly
+awk $(pwd) done 'quoted text' 2>/dev/null /usr/bin 2>/dev/null echo "$1" && test
+	${HOME} "$1" printf /usr/bin done /usr/bin printf
+	'quoted text' 2>/dev/null $(pwd) 'quoted text'
+	x=1 awk 2>/dev/null "$1" done grep done 'quoted text' &&
+	2>/dev/null $(pwd) "$@" "$@" | export "$@" local x=1 export
+		| done grep /usr/bin then sed && ${HOME} "$@" -eu ${HOME} readonly ${HOME}
+		cd echo echo sed echo sed "$@" /usr/bin x=1 $(pwd) cd && | test
+echo awk sed then "$1" ${HOME} cd printf then then
+	grep 2>/dev/null local $(pwd) printf $(pwd) done
+	--verbose printf -eu "$1" && then
+	${HOME} done --verbose echo -eu $(pwd) grep --verbose grep "$@" && 2>/dev/null
+		$(pwd) sed && export "$1" export --verbose --verbose
+--verbose && 'quoted text'
+echo readonly cd ${HOME} x=1 $(pwd) x=1 "$@" readonly
+$(pwd) "$1" export printf sed test ${HOME} cd export then 2>/dev/null 'quoted text'
+echo && --verbose readonly /usr/bin "$@" done /usr/bin
+		"$1" x=1 "$@" export done awk 'quoted text' awk export /usr/bin x=1 --verbose
+		"$@" && ${HOME} "$@" /usr/bin sed
+		readonly done printf echo |
+| grep | x=1 --verbose awk --verbose
+		"$1" && printf "$@" "$1" cd awk -eu sed awk grep -eu
+readonly -eu "$@" "$1" $(pwd) local done local readonly local
+	local ${HOME} | /usr/bin grep cd echo test cd
+-eu grep done printf x=1 ${HOME} test $(pwd) cd done readonly
+$(pwd) printf awk sed awk
+	&& echo grep printf grep readonly done
+		$(pwd) readonly export --verbose awk printf
+	'quoted text' then | 'quoted text' /usr/bin sed "$1" "$@" 'quoted text'
+	'quoted text' "$@" "$@" done readonly
+	--verbose 'quoted text' awk x=1 export "$1" && grep | local export
+	then 'quoted text' grep | grep 'quoted text' local
+echo -eu --verbose readonly "$1" done then
+x=1 test grep test done done echo -eu grep printf /usr/bin -eu $(pwd)
+'quoted text' /usr/bin cd | 2>/dev/null
+		x=1 'quoted text' && "$1" | cd local echo done readonly printf
+		awk printf && -eu then done -eu
+done "$1" ${HOME} readonly | cd /usr/bin
+	printf "$@" --verbose 'quoted text' | && -eu $(pwd)
+local $(pwd) printf local
+	awk printf test "$@" -eu 'quoted text' test test "$1" test
+		printf done $(pwd) local
+	printf $(pwd) && grep --verbose "$@" echo $(pwd) -eu 'quoted text' --verbose
+'quoted text' cd awk done x=1 done sed && done 'quoted text' ${HOME} x=1
+printf --verbose echo x=1 awk readonly $(pwd) "$1" cd done && /usr/bin local
+		$(pwd) "$1" "$@" grep grep --verbose cd ${HOME}
+		"$1" "$1" | sed awk x=1 then "$1" --verbose
+		then /usr/bin "$1" --verbose sed then 'quoted text' && cd --verbose
+printf local x=1 /usr/bin awk awk
+echo readonly 'quoted text' 2>/dev/null -eu --verbose done /usr/bin && "$@"
+		2>/dev/null grep "$1" --verbose
+	$(pwd) echo | local --verbose local
+	2>/dev/null readonly "$@" then $(pwd) echo 'quoted text'
+		awk local awk $(pwd) done --verbose
+	local then ${HOME} 2>/dev/null
+	test awk | then printf local $(pwd) "$1" "$@" echo printf 2>/dev/null cd "$@"
+		cd 2>/dev/null then done /usr/bin
+--verbose --verbose grep echo
+awk cd grep | printf $(pwd) local test "$1" local local printf 'quoted text'
+		| then readonly grep "$1" && x=1 x=1 "$@" awk -eu sed "$1"
+"$1" /usr/bin local 'quoted text' local sed
+'quoted text' done local /usr/bin
+		'quoted text' 2>/dev/null sed done cd local -eu "$@" readonly
+	awk readonly awk /usr/bin x=1 test "$@" $(pwd) $(pwd) export && x=1 "$1"
+	--verbose readonly then ${HOME} /usr/bin 2>/dev/null 2>/dev/null -eu "$@" sed
+		then local local | x=1 readonly awk 'quoted text' awk 'quoted text'
+		&& printf "$1" echo grep export 'quoted text'
+printf ${HOME} sed awk test x=1 --verbose awk /usr/bin $(pwd) ${HOME} x=1 "$1" "$@"
+	'quoted text' then /usr/bin export -eu local
+		awk "$@" && done printf cd 'quoted text' && local --verbose readonly
+		printf /usr/bin test "$@" then awk grep | done
+"$1" echo printf test 2>/dev/null 2>/dev/null
+	$(pwd) $(pwd) echo 'quoted text' readonly
+		$(pwd) sed && printf cd --verbose "$@" readonly
+		then -eu x=1 done then /usr/bin -eu export
+	&& export grep "$@" && awk 2>/dev/null --verbose | echo -eu grep echo "$1"
+		--verbose /usr/bin then
+-eu "$1" x=1 "$1" then readonly
+2>/dev/null cd 'quoted text'
+		"$1" local /usr/bin printf /usr/bin ${HOME} local
+--verbose then | | 2>/dev/null 2>/dev/null cd sed ${HOME} then "$1" export
+$(pwd) -eu 2>/dev/null /usr/bin done | grep
+done local test x=1 cd then export "$1" $(pwd) /usr/bin
+	-eu awk "$@" sed ${HOME} -eu cd sed && /usr/bin
+	then | --verbose --verbose -eu x=1 'quoted text' cd local awk done
+sed local "$1" "$1" "$1" | /usr/bin export | /usr/bin 'quoted text' sed -eu
+		readonly "$@" "$1" 2>/dev/null 2>/dev/null $(pwd)
+cd /usr/bin 2>/dev/null then $(pwd)
+	2>/dev/null grep done ${HOME}
+		export 'quoted text' grep
+		awk awk /usr/bin local $(pwd) then | $(pwd) cd --verbose 'quoted text' $(pwd)
+--verbose -eu && x=1 local cd -eu local then --verbose readonly && $(pwd)
+		"$1" -eu cd 'quoted text' $(pwd) 2>/dev/null cd
+		'quoted text' export test echo then 2>/dev/null
+		printf awk export /usr/bin x=1 sed -eu cd /usr/bin "$1" done
+echo -eu "$1" ${HOME} readonly "$1" awk 2>/dev/null done printf "$@"
+| readonly --verbose local x=1 "$@"
+		grep local --verbose 2>/dev/null
+	then $(pwd) export ${HOME} echo export "$1" "$@" done sed grep -eu
+export -eu "$@" | /usr/bin $(pwd) readonly awk && readonly awk local export
+	"$@" local -eu readonly "$1" -eu sed "$@" export readonly -eu
+		/usr/bin 'quoted text' --verbose x=1 done -eu --verbose 2>/dev/null 2>/dev/null
+sed grep test export 2>/dev/null ${HOME} export local cd 'quoted text' awk test
+2>/dev/null export -eu && awk && -eu local done 'quoted text' --verbose
+grep grep $(pwd) grep /usr/bin readonly "$1" readonly 2>/dev/null
+	'quoted text' | ${HOME} then -eu 2>/dev/null export test then echo $(pwd)
+test "$@" 2>/dev/null awk $(pwd) then printf cd then | cd cd local --verbose
+printf /usr/bin && readonly ${HOME} 2>/dev/null "$1" done "$@" $(pwd)
+		$(pwd) then 2>/dev/null
+test | done "$@" readonly local local 2>/dev/null then test -eu
+	${HOME} -eu printf --verbose local --verbose 'quoted text' | ${HOME} -eu 2>/dev/null
+"$1" 'quoted text' x=1 $(pwd) cd ${HOME} echo --verbose
+	awk then && done export awk -eu "$1" "$1" grep export "$@" --verbose && | readonly
+cd local ${HOME} test ${HOME} /usr/bin
+${HOME} done then test "$1"
+	local printf $(pwd) | cd readonly echo 'quoted text' export then test
+		sed x=1 cd readonly ${HOME} printf --verbose then readonly local
+		readonly printf $(pwd) | grep -eu local ${HOME} && /usr/bin
+--verbose --verbose --verbose cd && grep x=1 "$@" /usr/bin | --verbose -eu
+	2>/dev/null && echo grep 2>/dev/null
+${HOME} cd ${HOME} local export 'quoted text' /usr/bin ${HOME} $(pwd)
+2>/dev/null ${HOME} /usr/bin readonly &&
+	-eu 2>/dev/null grep 'quoted text' "$@" /usr/bin
+'quoted text' 'quoted text' && awk
+		x=1 x=1 test echo | echo local -eu /usr/bin sed /usr/bin x=1 echo
+	cd done /usr/bin ${HOME}
+-eu sed 'quoted text' then 2>/dev/null &&
+&& | | "$1" -eu grep -eu cd test local "$@" test $(pwd) test echo ${HOME}
+	done export && 2>/dev/null
+"$@" ${HOME} awk awk readonly
+		local 'quoted text' ${HOME} | ${HOME} echo
+	sed export echo /usr/bin x=1 $(pwd) grep grep "$@" sed x=1 cd x=1 echo
+	done --verbose $(pwd) readonly
+		readonly -eu $(pwd) export /usr/bin
+		--verbose $(pwd) grep grep local "$@" 2>/dev/null $(pwd) |
+		${HOME} --verbose readonly "$@" | | echo --verbose
+$(pwd) export awk 'quoted text' "$@" readonly --verbose done x=1 && 2>/dev/null
+		2>/dev/null local test echo then 'quoted text' ${HOME} export
+		export local printf grep "$1"
+		readonly /usr/bin 2>/dev/null then cd "$1"
+&& export readonly /usr/bin /usr/bin grep local && then $(pwd) $(pwd) cd /usr/bin
+-eu "$1" 'quoted text'
+	-eu local sed done sed
+	export && 'quoted text' test "$@"
+		grep ${HOME} cd sed printf export --verbose done local grep
+		/usr/bin then -eu grep grep 2>/dev/null sed --verbose -eu -eu grep
+"$@" test $(pwd) awk sed then awk "$@"
+	${HOME} && test readonly
+readonly grep export 'quoted text' done
+| echo export --verbose "$1" test $(pwd) test done awk $(pwd) test --verbose
+done printf export $(pwd) cd ${HOME} -eu echo cd done ${HOME} then then 'quoted text'
+		then && /usr/bin 'quoted text' export --verbose awk printf done
+	$(pwd) readonly "$1" sed grep awk -eu -eu | readonly
+		x=1 export local "$1" --verbose ${HOME} awk then
+	'quoted text' x=1 cd 'quoted text'
+${HOME} sed $(pwd) test "$@" awk /usr/bin 'quoted text'
+&& sed ${HOME} | then local 2>/dev/null
+	done done echo /usr/bin printf --verbose
+	readonly --verbose local export awk "$@" done readonly x=1 --verbose
+		export && /usr/bin /usr/bin -eu -eu cd printf &&
+	$(pwd) echo export "$1" export
+	awk $(pwd) echo 'quoted text'
+$(pwd) done "$@" sed 'quoted text'
+	then /usr/bin test --verbose && readonly
+		"$1" x=1 | 2>/dev/null cd local ${HOME} | grep
+/usr/bin ${HOME} printf "$1" sed $(pwd) local 2>/dev/null
+		"$1" 2>/dev/null done done "$1" export echo
+		export awk && $(pwd) awk -eu /usr/bin "$1" export
+-eu echo /usr/bin then
+		then 'quoted text' $(pwd) x=1 && | echo sed test
+awk 'quoted text' awk echo export | export then $(pwd) echo "$@" /usr/bin
+		2>/dev/null && local ${HOME} cd
+echo x=1 ${HOME} sed grep 2>/dev/null then grep --verbose
+		sed export then 2>/dev/null export /usr/bin 2>/dev/null grep 'quoted text'
+		local cd x=1 export then grep ${HOME} then sed ${HOME}
+/usr/bin "$@" ${HOME} && 'quoted text'
+sed grep printf grep x=1 'quoted text' grep
+	2>/dev/null test export -eu
+	echo cd && done && done local | test 'quoted text' ${HOME} /usr/bin local awk 2>/dev/null
+	/usr/bin then ${HOME} $(pwd) readonly done
+	--verbose echo | cd export
+	local ${HOME} "$@" printf /usr/bin $(pwd) then 2>/dev/null then then cd
+	"$1" grep grep done echo cd printf |
+	--verbose "$@" then test done cd readonly
+	printf | /usr/bin export -eu echo --verbose then export
+"$1" --verbose 'quoted text'
+	cd readonly x=1 'quoted text' export -eu 2>/dev/null |
+		/usr/bin grep 2>/dev/null grep export export awk ${HOME} echo
+	export export readonly then done export echo
+	readonly ${HOME} x=1 sed done 2>/dev/null done sed done && then 'quoted text'
+	'quoted text' awk local | test then local 'quoted text' /usr/bin
+done local "$1" then "$1" local "$1" 2>/dev/null
+	| 'quoted text' echo awk sed printf | done && ${HOME} printf done done done
+cd export awk echo | readonly "$@" sed cd "$@"
+'quoted text' export done echo grep && awk export
+		2>/dev/null grep -eu 'quoted text'
+| test --verbose local 'quoted text' 'quoted text'
+		"$@" /usr/bin -eu "$@" done sed test local -eu printf echo "$@" done "$@" printf
+		grep 'quoted text' test 2>/dev/null ${HOME} local $(pwd) x=1 /usr/bin
+	"$1" -eu && readonly "$1"
+		done ${HOME} "$1" printf echo done /usr/bin
+		'quoted text' "$@" printf ${HOME}
+${HOME} sed ${HOME} /usr/bin local
+	then cd done x=1 echo "$1" $(pwd) readonly
+		"$@" cd /usr/bin ${HOME}
+/usr/bin printf grep printf export grep ${HOME} "$1"
+		awk readonly grep $(pwd)
+"$1" echo "$@" | awk printf ${HOME} local done local 2>/dev/null
+		2>/dev/null 'quoted text' 'quoted text'
+'quoted text' readonly printf readonly
+grep "$@" "$@" local sed then done "$1" 'quoted text' test &&
+		export 'quoted text' done export ${HOME} done "$@" local
+	echo x=1 "$1" /usr/bin printf readonly echo
+		-eu local then /usr/bin x=1 printf
+| sed done | then "$@" cd $(pwd) /usr/bin && "$@" -eu $(pwd) grep $(pwd)
+	test "$1" export done 2>/dev/null cd test local done
+sed 'quoted text' export
+awk --verbose test -eu awk test grep && $(pwd) $(pwd)
+local grep "$1" --verbose sed readonly then echo readonly cd printf
+/usr/bin && awk && awk $(pwd) | sed awk /usr/bin sed -eu test x=1 cd done -eu
+	&& printf then readonly | test sed echo done awk export
+| cd && 'quoted text' then
+	$(pwd) ${HOME} "$1" awk && -eu 'quoted text' local awk then local then
+/usr/bin printf grep x=1 cd /usr/bin && readonly awk then echo sed
+		local then | awk x=1 readonly && cd 2>/dev/null 'quoted text' sed
+	export export grep awk echo awk && | readonly --verbose | && then -eu $(pwd)
+	awk readonly local cd | /usr/bin && printf
+&& -eu test grep done awk sed local | readonly && cd $(pwd) cd
+		done 'quoted text' test readonly sed x=1 --verbose | x=1 2>/dev/null
+done test | "$1" awk readonly local awk x=1 sed awk export echo
+		2>/dev/null grep $(pwd) /usr/bin /usr/bin export cd
+| x=1 "$1" /usr/bin done -eu $(pwd) -eu done && readonly && "$1" cd export
+	sed export 'quoted text' -eu echo "$1" --verbose awk $(pwd)
+printf $(pwd) -eu /usr/bin ${HOME}
+	sed sed 2>/dev/null 2>/dev/null "$@" -eu --verbose then
+		test cd --verbose 'quoted text' $(pwd) "$1" | | | then $(pwd) 'quoted text'
+&& "$@" cd && && "$1" | readonly
+	echo /usr/bin grep x=1 cd local $(pwd)
+	readonly x=1 && --verbose /usr/bin --verbose readonly test 2>/dev/null export
+x=1 printf ${HOME} /usr/bin export
+	sed grep 2>/dev/null 2>/dev/null "$@"
+	awk /usr/bin ${HOME} && -eu --verbose x=1 test
+done -eu 'quoted text' grep $(pwd) 'quoted text' | echo 'quoted text' readonly export
+done cd sed printf awk cd echo done
+grep "$@" then $(pwd) done then 'quoted text' && --verbose
+	readonly export test && "$1" export 'quoted text' "$1" "$@" sed | --verbose
+"$1" local $(pwd) /usr/bin awk echo -eu awk export
+		export printf awk && cd readonly x=1
+/usr/bin "$@" ${HOME} then ${HOME} $(pwd) | test awk test readonly 2>/dev/null
+"$1" "$1" "$1" && x=1 local "$@" 'quoted text'
+		done awk && "$1" then $(pwd) /usr/bin
+--verbose test grep x=1 sed 'quoted text'
+done "$1" --verbose grep 2>/dev/null
+| sed --verbose local local local printf "$@" echo local printf --verbose
+	| /usr/bin 'quoted text' test
+	2>/dev/null printf export done awk ${HOME} grep x=1 then then
+	/usr/bin readonly printf done echo
+		readonly printf local export done
+--verbose cd && local printf "$@" 'quoted text' | local
+done --verbose 2>/dev/null awk
+readonly export sed && then cd echo echo --verbose 'quoted text'
+	echo $(pwd) printf then
+		awk printf done grep /usr/bin "$1" sed grep && --verbose $(pwd)
+	/usr/bin ${HOME} readonly --verbose sed --verbose -eu ${HOME} "$1"
+		"$@" x=1 sed /usr/bin ${HOME} echo printf echo local
+	"$@" test | test readonly ${HOME} "$@" ${HOME} local -eu /usr/bin
+grep then --verbose --verbose x=1 then
+	export awk then done awk cd cd local then awk local export ${HOME}
+done then echo "$@" export awk 2>/dev/null
+		-eu sed /usr/bin && echo local --verbose
+	$(pwd) x=1 ${HOME} awk export $(pwd) cd --verbose x=1 local /usr/bin echo
+		readonly 'quoted text' "$@"
+	grep "$@" then 2>/dev/null ${HOME} "$@" sed sed x=1 --verbose --verbose ${HOME}
+		cd sed x=1 awk && --verbose grep
+/usr/bin -eu $(pwd) sed 2>/dev/null printf awk awk then $(pwd)
+		--verbose echo sed then --verbose test --verbose /usr/bin grep
+	/usr/bin awk 'quoted text' "$@" "$1" echo local then x=1
+		test sed awk test ${HOME} -eu cd "$@" printf x=1 sed 'quoted text'
+		&& ${HOME} 'quoted text' grep readonly x=1 $(pwd) ${HOME}
+	readonly ${HOME} cd sed 2>/dev/null grep $(pwd)
+	cd --verbose export "$1" done echo done 'quoted text' "$1" "$@" "$@" x=1
+"$@" -eu -eu "$@" -eu test cd sed readonly local ${HOME} done && |
+	cd grep --verbose ${HOME} && $(pwd)
+		'quoted text' test export export 2>/dev/null done then cd done ${HOME} -eu
+		--verbose x=1 grep printf 2>/dev/null local
+		echo -eu ${HOME} --verbose "$@" awk x=1 ${HOME} "$@" local x=1 then 2>/dev/null
+"$1" export done ${HOME} test echo
+"$@" | awk 'quoted text' done 2>/dev/null sed -eu sed done "$@"
+export --verbose printf echo -eu test awk "$1" "$1" cd |
+		printf test x=1 'quoted text' cd ${HOME} readonly ${HOME}
+sed printf echo echo readonly sed done readonly 'quoted text' "$@" && done
+	awk "$@" "$@" "$1" printf test
+		grep "$@" "$1" 2>/dev/null /usr/bin echo 'quoted text' | test /usr/bin
+		--verbose readonly done readonly local | && "$1" test
+echo readonly 2>/dev/null grep
+		'quoted text' | done readonly echo cd 'quoted text'
+cd $(pwd) local printf local
+	local done "$1" grep done -eu ${HOME}
+test $(pwd) cd grep sed 'quoted text' "$1" -eu
+		local then test test grep test $(pwd) /usr/bin test cd echo ${HOME}
+readonly 2>/dev/null $(pwd) grep then | local 'quoted text' printf 'quoted text'
+	&& then then 2>/dev/null done ${HOME} sed $(pwd) local $(pwd) readonly
+		echo sed $(pwd) test "$1" echo "$@"
+		cd done ${HOME} /usr/bin awk "$@" -eu then | cd then /usr/bin
+		export then | printf local then --verbose 'quoted text' then test && &&
+	--verbose ${HOME} readonly awk sed local --verbose
+		&& cd then local $(pwd) sed cd cd && 'quoted text' 'quoted text'
+		readonly -eu sed test grep test && cd /usr/bin
+		--verbose readonly test printf 2>/dev/null done awk
+	export readonly local ${HOME} $(pwd)
+&& printf $(pwd) grep $(pwd) 2>/dev/null then local "$@" "$@" printf "$@" x=1
+	sed "$1" awk -eu -eu done "$1" readonly /usr/bin /usr/bin /usr/bin
+	--verbose echo $(pwd) echo x=1 sed 'quoted text' --verbose ${HOME}
+		"$1" | 'quoted text' done done
+"$@" ${HOME} x=1 sed echo $(pwd) -eu readonly && -eu done test
+	&& 'quoted text' done | x=1 printf
+sed -eu "$1" 'quoted text' $(pwd) printf awk x=1 | done local 2>/dev/null -eu
+		export sed awk && then awk sed -eu 'quoted text' x=1 done /usr/bin done printf
+done 'quoted text' $(pwd) echo 2>/dev/null export echo
+		awk awk -eu then local -eu ${HOME} then then /usr/bin --verbose --verbose
+	x=1 'quoted text' "$1"
+		readonly cd then $(pwd) /usr/bin then then awk /usr/bin
+	${HOME} printf readonly --verbose done test ${HOME}
+	awk then done --verbose readonly test echo test done ${HOME} x=1 "$1" $(pwd) --verbose
+sed cd 'quoted text' "$1"
+printf x=1 local printf
+		| awk | /usr/bin "$@" cd readonly | 2>/dev/null 'quoted text'
+		echo test "$1" && grep /usr/bin awk 'quoted text' cd 2>/dev/null then done &&
+		test "$@" echo 'quoted text' then printf --verbose then
+then --verbose local && | test -eu test local printf $(pwd) --verbose $(pwd)
+		2>/dev/null ${HOME} sed printf done done local x=1 'quoted text' 'quoted text'
+"$@" ${HOME} grep cd echo export -eu cd done cd
+echo 2>/dev/null printf 2>/dev/null ${HOME} x=1
+	printf --verbose && | awk 2>/dev/null 'quoted text' then grep echo && sed grep
+		test 2>/dev/null 2>/dev/null awk local ${HOME} --verbose $(pwd) awk /usr/bin
+${HOME} sed done | sed -eu 'quoted text' done -eu /usr/bin -eu 2>/dev/null
+		'quoted text' cd 2>/dev/null 'quoted text' "$1" printf then
+		x=1 readonly export "$1" "$@"
+"$1" cd -eu then && test test then cd local done $(pwd) sed then readonly done
+local ${HOME} then export
+		export 'quoted text' 'quoted text' 2>/dev/null sed
+echo printf printf cd "$1"
+		export local echo "$1" echo /usr/bin "$1" 'quoted text' x=1
+		-eu --verbose local export grep | cd && 'quoted text'
+		| cd grep done | echo sed "$1" readonly && /usr/bin | 2>/dev/null awk
+		--verbose 2>/dev/null --verbose 2>/dev/null sed done --verbose local "$1"
+2>/dev/null echo && test printf "$@" "$1"
+x=1 2>/dev/null 'quoted text' x=1 awk -eu x=1 cd done
+		export export grep echo echo readonly "$1" "$1" export
+then local x=1 /usr/bin export local "$1" | 'quoted text' test
+		echo export printf x=1 done printf --verbose printf grep awk x=1
+export 'quoted text' done && && echo "$1" /usr/bin then grep sed --verbose cd
+	printf $(pwd) -eu printf printf 2>/dev/null | 2>/dev/null ${HOME} --verbose
+&& export "$@" printf export "$1" readonly sed grep test -eu | /usr/bin
+${HOME} test $(pwd) test
+		/usr/bin test "$@" 'quoted text' grep awk grep
+grep cd -eu then 'quoted text' "$1" |
+	awk cd done --verbose export export
+local printf ${HOME} printf done 2>/dev/null -eu $(pwd)
+--verbose echo | 'quoted text' -eu local awk then && test sed export sed
+${HOME} x=1 "$1" readonly | 2>/dev/null local ${HOME} "$1" readonly
+		readonly grep test export done /usr/bin /usr/bin cd export printf
+		$(pwd) cd awk -eu awk export /usr/bin
+	awk readonly then local $(pwd) 2>/dev/null grep $(pwd) sed && --verbose
+| sed $(pwd) "$1" 2>/dev/null 'quoted text'
+printf "$@" ${HOME} printf grep /usr/bin ${HOME} echo "$1" sed ${HOME} echo echo
+	${HOME} ${HOME} test echo readonly
+x=1 test readonly then && cd $(pwd) done export && /usr/bin
+	-eu && test 2>/dev/null sed done
+	echo /usr/bin 'quoted text' readonly test then grep "$@" grep 'quoted text'
+	--verbose 'quoted text' 2>/dev/null echo ${HOME}
+		"$@" export --verbose "$@" ${HOME} | local local export readonly
+		awk "$1" cd 2>/dev/null test cd printf -eu "$1" ${HOME}
+		done --verbose | done export | "$@" ${HOME} -eu 'quoted text' 2>/dev/null
+	echo sed local grep test 2>/dev/null cd && $(pwd)
+		export done echo cd printf x=1 2>/dev/null ${HOME} && ${HOME}
+	"$@" 'quoted text' sed
+		"$@" /usr/bin | done
+		awk x=1 ${HOME} "$@" "$@" readonly printf --verbose echo 2>/dev/null && then
+	/usr/bin then printf then grep grep export
+	echo sed grep 'quoted text' x=1 then && local
+		local --verbose /usr/bin readonly 'quoted text'
+	${HOME} local 2>/dev/null local readonly test | | ${HOME} export grep "$1" printf
+	'quoted text' then -eu --verbose done --verbose --verbose echo --verbose
+	local test local done /usr/bin
+test ${HOME} -eu test 'quoted text' -eu 'quoted text' awk | -eu -eu 'quoted text'
+		done awk $(pwd) $(pwd) ${HOME} printf /usr/bin grep awk printf $(pwd)
+x=1 echo "$1" done 2>/dev/null x=1 "$@" /usr/bin local
+'quoted text' done x=1 "$@" echo done ${HOME} | local
+	printf 'quoted text' 2>/dev/null | grep ${HOME} ${HOME}
+sed x=1 $(pwd) $(pwd) readonly $(pwd) local local then echo | /usr/bin "$1" then
+		"$1" readonly cd -eu ${HOME} test --verbose
+		awk $(pwd) done sed -eu 'quoted text'
+| 'quoted text' -eu export
+-eu export cd -eu done -eu test |
+"$1" readonly sed echo done readonly sed |
+	then "$1" "$1" -eu "$1" sed
+	then 'quoted text' && "$@" --verbose ${HOME}
+	grep awk printf "$1" then x=1 local --verbose --verbose &&
+test test 2>/dev/null "$1" readonly readonly local test --verbose
+		export /usr/bin ${HOME} 2>/dev/null "$1" $(pwd) sed "$@"
+--verbose readonly "$1" x=1 "$1" | sed 2>/dev/null x=1 local "$@" | "$1" done
+		then local done readonly $(pwd) sed grep grep done --verbose
+		${HOME} readonly -eu
+		echo "$1" 'quoted text' --verbose done sed readonly
+"$1" done x=1 cd /usr/bin $(pwd) local "$1" readonly /usr/bin awk
+'quoted text' 'quoted text' && readonly --verbose "$@" "$@" awk sed then done
+awk echo $(pwd) $(pwd) ${HOME}
+		readonly done ${HOME} printf 'quoted text'
+		"$@" | awk printf $(pwd) readonly export readonly ${HOME} grep
+	${HOME} $(pwd) "$@" --verbose printf "$@" 'quoted text' "$1" | test
+		export 'quoted text' sed -eu ${HOME} then && | sed /usr/bin sed "$@" $(pwd) sed
+test export "$1" ${HOME} --verbose readonly echo local export
+		x=1 $(pwd) then sed sed | then "$@" echo && cd 'quoted text'
+		"$@" grep done ${HOME} | | ${HOME} awk local x=1 grep printf readonly
+	2>/dev/null export 2>/dev/null -eu echo | printf
+		then && cd printf export /usr/bin export ${HOME} test | -eu sed
+-eu done && grep grep "$1" /usr/bin
+		export x=1 ${HOME} then grep "$1" $(pwd) "$1" grep 'quoted text'
+		export printf printf local awk echo x=1 local readonly grep --verbose grep x=1
+	/usr/bin ${HOME} then test cd then printf done $(pwd) cd "$1"
+awk printf test sed ${HOME} done echo "$@"
+	'quoted text' "$@" export printf
+	then ${HOME} done 2>/dev/null echo "$1" printf 2>/dev/null ${HOME} && /usr/bin
+2>/dev/null x=1 cd "$1" export done local local 'quoted text' cd grep -eu 'quoted text'
+		"$1" then -eu cd | cd /usr/bin sed export 'quoted text' sed readonly printf
+	&& -eu readonly --verbose
+	cd sed "$@" readonly printf test then --verbose /usr/bin cd printf
+local -eu printf "$@" && $(pwd) 'quoted text' printf
+		readonly sed x=1 | "$@" x=1 | printf export 'quoted text' echo "$1" sed echo
+		| sed 2>/dev/null done local --verbose --verbose 'quoted text'
+&& $(pwd) readonly /usr/bin echo
+	test /usr/bin "$@" local | /usr/bin awk test echo --verbose sed 'quoted text'
+	awk ${HOME} printf | then export 2>/dev/null -eu
+	readonly awk sed done echo -eu --verbose readonly printf "$@" test |
+export x=1 --verbose $(pwd) readonly readonly then printf
+	echo readonly -eu "$@" -eu awk /usr/bin && readonly
+readonly 2>/dev/null test --verbose
+		"$1" awk && /usr/bin grep --verbose "$@" sed /usr/bin
+"$1" printf grep printf --verbose printf grep 2>/dev/null x=1 grep
+	cd x=1 -eu export echo "$@" awk -eu /usr/bin -eu --verbose
+	test local --verbose --verbose -eu test then printf && readonly
+grep $(pwd) && printf awk ${HOME} test /usr/bin && grep
+local local -eu -eu -eu test awk && test 'quoted text'
+		$(pwd) test x=1 --verbose --verbose "$@" printf
+	| grep "$@" echo 'quoted text' --verbose
+sed cd awk grep done && grep 2>/dev/null /usr/bin "$1" "$@"
+		done -eu 'quoted text' cd awk ${HOME} | /usr/bin /usr/bin
+		-eu x=1 && grep then --verbose "$1" echo
+local test grep sed readonly "$@" test test "$1" $(pwd) sed readonly -eu
+awk local $(pwd) "$@" grep cd "$1" awk | cd /usr/bin
+		--verbose x=1 readonly "$@" readonly 'quoted text' printf export
+		then echo done /usr/bin $(pwd) "$1" /usr/bin | $(pwd) printf test cd
+	-eu 2>/dev/null x=1 grep -eu export $(pwd) then printf sed
+echo printf 'quoted text' -eu /usr/bin
+'quoted text' --verbose | x=1 export ${HOME}
+	"$1" awk test awk x=1 sed
+		cd then then test "$1" --verbose -eu cd "$@" /usr/bin
+'quoted text' printf $(pwd) "$1" "$1" cd
+	/usr/bin sed 'quoted text'
+		export | sed done "$1" 'quoted text'
+"$@" export x=1 x=1 'quoted text' --verbose awk
+		/usr/bin && test awk -eu --verbose then printf && 'quoted text' sed
+		cd && echo "$1" printf "$1" then awk --verbose printf readonly $(pwd)
+	done --verbose | sed done 2>/dev/null
+echo cd -eu --verbose awk echo --verbose printf --verbose --verbose -eu
+	printf readonly --verbose $(pwd) done export "$@" cd test | sed readonly x=1 ${HOME}
+export then done 'quoted text'
+	then && test $(pwd) echo
+		--verbose $(pwd) cd 'quoted text'
+	$(pwd) /usr/bin | ${HOME} /usr/bin readonly ${HOME} -eu cd && test --verbose
+x=1 "$1" readonly sed --verbose
+		local then awk 2>/dev/null
+		"$@" awk 'quoted text' && --verbose awk then x=1
+grep sed export -eu echo export awk | && test
+		awk "$1" cd "$@" local && awk done export | "$@" /usr/bin 2>/dev/null
+	&& 2>/dev/null ${HOME} printf grep printf $(pwd) local -eu awk awk then
+&& -eu test /usr/bin
+grep -eu --verbose sed | $(pwd) grep | sed
+		local test awk /usr/bin "$1" awk printf readonly
+		export -eu sed | export test readonly 'quoted text'
+		2>/dev/null /usr/bin then | $(pwd) x=1 ${HOME} test readonly readonly
+		printf $(pwd) then $(pwd) awk 'quoted text' local
+	sed printf ${HOME} then 2>/dev/null echo "$1" -eu && && x=1 "$1" sed then
+$(pwd) printf 'quoted text' -eu export then ${HOME} $(pwd) 'quoted text'
+		$(pwd) done | --verbose
+	"$@" $(pwd) cd export x=1 awk &&
+		&& x=1 done $(pwd) cd "$1" x=1 --verbose then -eu sed
+	/usr/bin | 2>/dev/null && awk local printf awk then
+"$@" ${HOME} /usr/bin ${HOME}
+&& then -eu local x=1 then ${HOME} && 'quoted text' awk /usr/bin echo
+		grep ${HOME} awk readonly x=1 $(pwd) | "$1" sed "$1" export done printf test &&
+local echo awk --verbose /usr/bin --verbose local "$1" 'quoted text'
+"$@" 2>/dev/null $(pwd) sed ${HOME}
+		export x=1 -eu 2>/dev/null ${HOME} export export 2>/dev/null -eu printf
+	x=1 --verbose -eu 'quoted text' awk
+	"$@" ${HOME} awk printf cd echo grep echo local "$@" done && done -eu
+	"$@" grep printf --verbose test export then done grep --verbose
+	--verbose && local echo "$1" | printf local 2>/dev/null sed grep then /usr/bin
+	${HOME} -eu export test 'quoted text' done cd "$1"
+		sed echo sed then test awk "$1" "$1" then local $(pwd) $(pwd) 'quoted text'
+		/usr/bin grep 'quoted text' -eu $(pwd) ${HOME} printf export ${HOME} && sed local
+		done -eu | /usr/bin export grep readonly echo readonly awk printf "$@"
+	x=1 ${HOME} cd awk && export cd -eu ${HOME} awk 'quoted text' test
+	/usr/bin "$1" local /usr/bin cd echo test cd /usr/bin $(pwd)
+	done cd -eu $(pwd) && done | awk grep readonly "$1" readonly "$@" grep printf
+readonly 2>/dev/null "$1" "$1" cd "$1" readonly test sed
+		${HOME} && awk then /usr/bin export awk -eu 2>/dev/null cd $(pwd)
+then readonly -eu && printf 'quoted text' ${HOME} local 2>/dev/null
+		"$@" export -eu then echo done /usr/bin local printf "$1"
+	$(pwd) grep ${HOME} test local test 'quoted text' | test x=1 done echo 'quoted text'
+	2>/dev/null local awk local -eu 'quoted text' readonly
+'quoted text' done "$@" readonly x=1 readonly --verbose "$1" -eu
+	local -eu "$1" 2>/dev/null --verbose local
+		awk -eu then "$1" test x=1 | local done cd "$1"
+"$@" /usr/bin export sed done readonly "$1" echo awk awk 'quoted text' printf
+		| local ${HOME} then 'quoted text'
+		2>/dev/null printf cd /usr/bin $(pwd) grep
+		readonly 2>/dev/null x=1 -eu /usr/bin test 'quoted text'
+		$(pwd) x=1 x=1 test test export "$1" x=1 | && &&
+	cd then sed local local grep local export 'quoted text' readonly 2>/dev/null
+/usr/bin $(pwd) local local "$1" ${HOME} ${HOME}
+grep 2>/dev/null test && ${HOME} local then 2>/dev/null x=1
+		-eu awk then local x=1 && "$1" readonly done printf readonly | cd
+		'quoted text' echo | 'quoted text' awk test awk 2>/dev/null
+		2>/dev/null echo then --verbose ${HOME} sed 2>/dev/null "$@"
+	'quoted text' --verbose done printf then
+	echo -eu grep cd /usr/bin
+		cd done local "$1" readonly done "$1" "$@" local "$1"
+	--verbose | && grep readonly awk printf &&
+		test sed printf done /usr/bin
+-eu --verbose export printf echo --verbose cd "$1" sed
+	echo $(pwd) 2>/dev/null 2>/dev/null /usr/bin $(pwd) ${HOME} test
+		| /usr/bin $(pwd) awk awk 2>/dev/null "$@" then x=1 "$1" awk test
+	x=1 readonly grep then local test 'quoted text' awk grep "$1" grep echo
+		done $(pwd) ${HOME} cd x=1 cd cd x=1 | 2>/dev/null
+export ${HOME} -eu grep then --verbose x=1 /usr/bin
+	"$1" test "$1" --verbose 'quoted text' then | ${HOME} test cd
+	cd sed | export /usr/bin ${HOME} "$@" export
+	2>/dev/null "$@" test 2>/dev/null export then /usr/bin
+2>/dev/null cd local echo export x=1 /usr/bin | then 2>/dev/null ${HOME} | test
+	test printf echo ${HOME} x=1 sed grep 2>/dev/null cd && | "$@" 'quoted text'
+		$(pwd) test /usr/bin 2>/dev/null $(pwd) -eu test sed readonly cd 2>/dev/null
+	"$1" "$@" 2>/dev/null | "$@" test && grep local
+	local cd | "$@" export printf "$@" export $(pwd) echo local "$@" export x=1 awk
+cd "$@" -eu "$@" /usr/bin test ${HOME} done 'quoted text' && printf echo
+printf then awk printf $(pwd)
+		x=1 2>/dev/null printf then export $(pwd) cd ${HOME} echo "$1"
+		${HOME} sed cd then awk grep readonly grep --verbose x=1 "$@" test
+${HOME} local grep grep then --verbose
+	export 'quoted text' test
+	-eu /usr/bin $(pwd) x=1
+$(pwd) cd $(pwd) awk ${HOME} done $(pwd) then
+	x=1 echo $(pwd) $(pwd) /usr/bin /usr/bin | $(pwd)
+	2>/dev/null local grep /usr/bin awk 'quoted text'
+		printf 2>/dev/null "$@" local "$@" readonly done then
+-eu 2>/dev/null $(pwd) echo | "$1" ${HOME} x=1
+		awk printf 'quoted text' test sed $(pwd)
+		readonly grep 2>/dev/null then
+-eu then 'quoted text' 2>/dev/null $(pwd) 'quoted text'
+	printf local "$1" done /usr/bin local ${HOME} && printf ${HOME} ${HOME} "$@"
+"$@" "$@" grep sed /usr/bin /usr/bin --verbose awk export
+	cd echo ${HOME} local then echo sed printf && -eu export ${HOME} --verbose sed
+		local /usr/bin --verbose sed grep sed sed then sed readonly
+	/usr/bin | 2>/dev/null readonly test sed done "$@" grep echo x=1 cd
+		echo 2>/dev/null readonly grep
+		local -eu && export "$1" printf /usr/bin ${HOME} echo
+	readonly then 2>/dev/null "$@" awk /usr/bin
+&& 2>/dev/null then cd 'quoted text' /usr/bin readonly
+		| done grep then grep echo cd && export 'quoted text' x=1 readonly
+	/usr/bin -eu "$1" export sed printf x=1 done ${HOME} /usr/bin readonly
+${HOME} --verbose then test grep local
+| echo done 'quoted text' readonly "$1" export | && "$1" awk then readonly
+		| export $(pwd) "$@" --verbose local awk 'quoted text'
+export "$@" then printf test /usr/bin /usr/bin awk
+	readonly local printf "$@" awk
+2>/dev/null "$@" local grep then --verbose then readonly awk then cd cd
+grep done "$@" /usr/bin
+cd && export ${HOME} done echo
+		cd && cd "$1" /usr/bin awk | readonly awk ${HOME} x=1 --verbose awk test
+	/usr/bin echo "$1" readonly done done then -eu done && x=1 test local
+	test && "$@" -eu export export x=1 sed test test "$1" cd "$1" && | --verbose
+	test ${HOME} printf printf
+cd local "$1" && awk x=1 echo 2>/dev/null /usr/bin grep $(pwd) local &&
+	/usr/bin sed 'quoted text' -eu x=1
+	-eu && -eu test printf 2>/dev/null 2>/dev/null
+		then && $(pwd) -eu /usr/bin printf printf awk --verbose $(pwd) | export 2>/dev/null
+	$(pwd) local then | ${HOME} done 2>/dev/null done
+		readonly ${HOME} -eu --verbose test cd /usr/bin sed /usr/bin
+	export --verbose | sed done printf then readonly printf /usr/bin readonly $(pwd)
+	'quoted text' echo then done export
+		${HOME} /usr/bin /usr/bin 'quoted text'
+echo "$@" awk --verbose readonly 'quoted text' then | "$@" awk ${HOME} /usr/bin
+		2>/dev/null --verbose && 2>/dev/null done --verbose x=1 /usr/bin
+2>/dev/null 'quoted text' echo cd echo done printf -eu -eu | awk
+2>/dev/null local export local sed test sed sed local then then --verbose -eu sed
+	"$1" && readonly done readonly grep grep "$1" done done "$@" readonly | "$1" x=1
+	&& "$@" ${HOME} done printf "$@" cd "$@" then done then x=1 awk awk 2>/dev/null
+done export && "$1" --verbose done
+		2>/dev/null awk then done && local
+"$@" x=1 ${HOME} "$1" "$@" test sed readonly done
+printf x=1 done readonly | -eu export "$1" test echo && x=1 cd
+	done awk export awk export 'quoted text' readonly sed "$1"
+	echo export cd awk sed test echo cd | test grep ${HOME} test grep export
+local sed test 2>/dev/null /usr/bin test x=1 sed sed /usr/bin "$@" done | done
+		test "$1" ${HOME} sed | done
+		echo 'quoted text' 'quoted text' -eu readonly 2>/dev/null --verbose
+/usr/bin test export echo
+		--verbose readonly export cd sed /usr/bin
+	"$1" grep ${HOME} local "$1" | echo local done
+export --verbose done local | | 'quoted text' printf
+echo ${HOME} | "$1" export echo awk | x=1 && done then
+readonly grep 2>/dev/null "$@" -eu |
+	readonly --verbose /usr/bin readonly /usr/bin
+	readonly x=1 done 'quoted text' "$@" export grep export ${HOME} 'quoted text'
+		x=1 -eu echo $(pwd) local "$1" export 2>/dev/null "$1" readonly
+	&& -eu export test sed 'quoted text'
+done ${HOME} && sed local 2>/dev/null
+		${HOME} "$@" printf -eu
+	export awk grep && "$@" cd echo done awk echo ${HOME}
+		grep then | -eu --verbose 'quoted text' export export sed
+export awk readonly local printf echo 'quoted text'
+#include c40.sh
+export | -eu then awk test x=1 done echo "$@" $(pwd) echo test export 2>/dev/null
+		-eu /usr/bin --verbose echo
+$(pwd) /usr/bin sed $(pwd) -eu echo $(pwd) && printf test
+	2>/dev/null awk --verbose readonly x=1 "$@" | | grep
+x=1 "$1" then 2>/dev/null awk echo --verbose -eu &&
+	then export grep local --verbose x=1 readonly | export awk -eu sed
+x=1 | echo "$@" | echo echo echo local ${HOME}
+done /usr/bin 2>/dev/null && /usr/bin x=1 --verbose && awk $(pwd)
+grep && then | cd && | && x=1 printf --verbose 'quoted text' &&
+		printf sed grep x=1 awk |
+		local test ${HOME} x=1 $(pwd) echo done ${HOME} test awk | --verbose
+		printf -eu ${HOME} -eu then | "$@" then
+-eu local cd then awk && && test readonly /usr/bin -eu x=1 --verbose
+		done then "$1" done export $(pwd) printf echo
+x=1 ${HOME} done readonly
+"$@" grep test readonly readonly local | ${HOME} awk | x=1 $(pwd) local
+	then -eu "$@" test readonly export then
+	test $(pwd) awk test export printf done
+		${HOME} then printf grep 'quoted text' cd
+printf ${HOME} 2>/dev/null | printf
+	echo $(pwd) && test then $(pwd) readonly x=1 readonly
+	x=1 "$@" 'quoted text' readonly cd 2>/dev/null --verbose | cd echo
+	"$1" "$@" 2>/dev/null export
+	--verbose done | local 'quoted text' echo test
+		-eu | test --verbose | && grep
+	printf 'quoted text' echo /usr/bin
+	| echo -eu | "$@" grep done ${HOME}
+	${HOME} printf -eu cd echo sed "$@" test
+	'quoted text' echo test $(pwd)
+		done ${HOME} $(pwd) --verbose grep 'quoted text' 'quoted text' -eu echo
+printf sed local "$@" | ${HOME} "$1" export /usr/bin sed "$1" then $(pwd)
+export 2>/dev/null | 2>/dev/null sed /usr/bin
+	awk $(pwd) test cd awk 2>/dev/null local
+'quoted text' awk cd test $(pwd) $(pwd) "$@"
+		awk | sed echo | printf done cd sed then awk awk | $(pwd) ${HOME} export --verbose
+"$@" -eu "$1" 'quoted text' readonly /usr/bin cd $(pwd)
+	export cd -eu ${HOME} 2>/dev/null test ${HOME} 2>/dev/null
+/usr/bin x=1 test done && test done echo x=1 echo local
+echo readonly then -eu "$@" printf &&
+	readonly cd /usr/bin && x=1 --verbose | |
+		$(pwd) "$@" 'quoted text' sed echo awk then ${HOME} echo 2>/dev/null
+&& printf ${HOME} | grep ${HOME} awk cd $(pwd) then
+/usr/bin then -eu grep cd ${HOME} | && && printf awk test printf echo /usr/bin
+		${HOME} echo grep export local done /usr/bin -eu test 2>/dev/null
+		grep | $(pwd) sed -eu readonly 'quoted text' sed $(pwd) test readonly
+		$(pwd) && awk grep done x=1 grep "$1" readonly
+sed 2>/dev/null echo --verbose
+		local x=1 done 'quoted text' printf readonly
+then cd printf local $(pwd)
+echo && "$1" then local sed sed test --verbose then "$1" test x=1 sed test echo
+	readonly echo 'quoted text' && then then "$@" export
+	"$1" sed cd ${HOME} "$@" test x=1 'quoted text' grep
+cd echo "$1" test | printf done
+	done 2>/dev/null 'quoted text' grep
+		done then readonly ${HOME} /usr/bin export local
+		'quoted text' 2>/dev/null test /usr/bin echo echo echo -eu x=1 export
+| local readonly x=1 cd cd $(pwd)
+		/usr/bin && -eu /usr/bin x=1 2>/dev/null
+		done ${HOME} $(pwd) awk sed && "$1" "$@" 2>/dev/null local x=1
+	2>/dev/null export awk 'quoted text' grep export cd $(pwd)
+		/usr/bin printf test then
+	'quoted text' x=1 done $(pwd) -eu then x=1 readonly sed "$1" printf awk "$@"
+then && /usr/bin export
+		&& 'quoted text' cd grep awk cd
+	&& $(pwd) done x=1 test export "$@" grep /usr/bin
+		local && export printf ${HOME} x=1 /usr/bin then /usr/bin
+		sed readonly x=1 --verbose cd test printf | 2>/dev/null "$1" ${HOME}
+		$(pwd) awk test 2>/dev/null readonly $(pwd) cd "$1" "$@" x=1 readonly
+		local echo x=1 grep readonly | -eu echo ${HOME}
+		$(pwd) "$1" "$1" --verbose
+done then x=1 x=1 $(pwd) echo $(pwd) "$@" printf local export
+	echo $(pwd) --verbose export echo 2>/dev/null
+	grep ${HOME} $(pwd) "$@" | -eu x=1 sed cd local 2>/dev/null ${HOME} "$@"
+		'quoted text' "$1" "$1"
+	2>/dev/null --verbose && x=1 | awk export test awk printf -eu awk x=1 local ${HOME}
+	'quoted text' grep printf echo done /usr/bin then sed --verbose | readonly
+		'quoted text' cd cd x=1 /usr/bin test sed "$@" test printf test | printf cd printf
+printf grep | done /usr/bin "$1" /usr/bin 'quoted text' | done
+test printf --verbose && "$@" 2>/dev/null
+"$@" done | ${HOME} $(pwd) export
+		test grep && then export $(pwd) ${HOME} then done echo 'quoted text' cd
+	awk grep done $(pwd) x=1 readonly then
+		readonly cd 2>/dev/null && printf x=1 'quoted text'
+then printf && /usr/bin x=1
+	$(pwd) local awk --verbose readonly printf --verbose && --verbose
+	echo then x=1 "$1" | -eu done 'quoted text' then readonly local "$1"
+	cd 2>/dev/null x=1 x=1 x=1 printf ${HOME} ${HOME} "$1" grep echo x=1
+		| export 'quoted text' cd /usr/bin /usr/bin --verbose ${HOME} echo
+	2>/dev/null $(pwd) && then cd $(pwd) cd /usr/bin
+		--verbose "$@" -eu /usr/bin printf printf done
+		export then -eu /usr/bin done && test $(pwd) test sed --verbose sed printf -eu
+printf /usr/bin cd printf echo
+$(pwd) test | -eu x=1 x=1 done export local local "$@" local "$@"
+x=1 export test printf export /usr/bin grep "$@"
+readonly ${HOME} x=1 printf awk echo ${HOME} awk export
+	done grep $(pwd) awk ${HOME}
+		/usr/bin done echo export -eu test echo sed readonly
+	"$@" | | -eu done x=1 $(pwd)
+		printf grep local --verbose sed done
+| ${HOME} ${HOME} x=1 2>/dev/null printf grep echo printf sed
+		export && ${HOME} export
+export sed 'quoted text' --verbose done done -eu grep done 'quoted text'
+'quoted text' 'quoted text' cd export echo local ${HOME}
+		&& readonly -eu grep readonly "$@" done "$1" sed "$1" 'quoted text' | --verbose
+		then grep sed readonly export printf -eu export /usr/bin readonly -eu --verbose
+		| awk local && cd 2>/dev/null
+	'quoted text' ${HOME} -eu awk sed test awk 2>/dev/null | 'quoted text'
+		cd test printf cd x=1 | grep export export --verbose
+-eu echo /usr/bin "$1" | cd && x=1 cd 'quoted text'
+	"$1" "$1" | local awk export "$1" $(pwd) echo "$@" /usr/bin /usr/bin 2>/dev/null
+	done && --verbose then printf export /usr/bin $(pwd) local &&
+-eu 'quoted text' then --verbose then /usr/bin "$1" /usr/bin export
+		"$1" local local grep x=1 "$@" /usr/bin 2>/dev/null ${HOME}
+readonly "$@" ${HOME} awk -eu sed cd test -eu 2>/dev/null
+printf && done export --verbose -eu "$@" readonly test done
+	${HOME} sed $(pwd) cd $(pwd) 2>/dev/null 2>/dev/null
+	2>/dev/null 'quoted text' cd "$1" --verbose x=1 awk
+| test 2>/dev/null ${HOME} --verbose
+		done --verbose 2>/dev/null test "$@" sed done cd readonly
+		x=1 cd | printf printf && 2>/dev/null
+test "$@" /usr/bin /usr/bin awk
+echo /usr/bin | --verbose --verbose readonly then /usr/bin /usr/bin
+		export --verbose 'quoted text' printf done awk ${HOME} && "$1" printf "$@"
+	2>/dev/null then x=1 /usr/bin $(pwd) 'quoted text'
+		--verbose $(pwd) test export readonly $(pwd) x=1
+	echo -eu awk 2>/dev/null echo 'quoted text' printf done
+local && cd /usr/bin | printf 2>/dev/null echo export /usr/bin
+		readonly awk $(pwd) test $(pwd) 2>/dev/null && sed
+&& echo awk 'quoted text' awk -eu printf printf readonly | --verbose
+sed echo -eu awk $(pwd) $(pwd) $(pwd)
+		--verbose $(pwd) ${HOME} test printf awk
+	&& cd && echo local -eu
+		"$1" && --verbose "$1" export grep && "$@" 'quoted text' /usr/bin
+	&& printf test ${HOME} -eu 'quoted text'
+	export echo && "$1" 2>/dev/null printf
+x=1 && && x=1 'quoted text' $(pwd) "$@"
+2>/dev/null $(pwd) local x=1 local
+		local test $(pwd) -eu awk echo
+		awk echo export 'quoted text'
+	${HOME} && 2>/dev/null awk done "$@" echo -eu | /usr/bin echo
+printf done test readonly export export sed sed done
+	readonly "$@" 2>/dev/null
+		$(pwd) then export ${HOME} awk done | cd test sed cd echo --verbose awk awk
+		echo && cd grep export x=1 awk && "$@" x=1 'quoted text'
+		printf /usr/bin local printf
+--verbose cd printf ${HOME} awk --verbose echo x=1 | readonly
+		sed printf -eu | $(pwd) test printf && export && sed printf
+	'quoted text' sed 'quoted text' sed echo sed --verbose
+		/usr/bin | -eu -eu "$1" test ${HOME}
+		sed -eu /usr/bin $(pwd) ${HOME} done
+		--verbose | then --verbose test 2>/dev/null /usr/bin --verbose x=1
+export then "$@" awk cd grep ${HOME} cd
+x=1 readonly printf && local echo /usr/bin done echo cd
+	/usr/bin local awk awk "$1"
+&& && ${HOME} && awk --verbose grep ${HOME}
+cd -eu export 2>/dev/null /usr/bin ${HOME} /usr/bin
+	'quoted text' sed test $(pwd) test --verbose grep awk "$1" export 2>/dev/null
+echo "$1" -eu sed --verbose
+		printf done 2>/dev/null x=1
+local local local cd && "$1"
+		x=1 2>/dev/null $(pwd) 2>/dev/null readonly | && echo |
+		test --verbose "$@" /usr/bin local x=1 cd done export printf readonly --verbose
+		/usr/bin | grep test echo local done ${HOME} export "$@" "$1" sed "$1"
+		| -eu /usr/bin ${HOME} ${HOME} then 2>/dev/null
+	&& cd && grep awk cd sed x=1 echo local 'quoted text' local cd awk printf
+	$(pwd) $(pwd) grep awk ${HOME} awk && cd cd then
+"$@" x=1 2>/dev/null export 'quoted text' && -eu && local --verbose ${HOME}
+	test then "$1" done test x=1 readonly grep "$1" sed
+x=1 awk awk "$@" && "$@" printf sed 2>/dev/null done && local
+		export local done /usr/bin sed awk printf cd $(pwd) $(pwd)
+		export local printf test -eu export printf && local $(pwd) /usr/bin && then
+--verbose --verbose x=1 | -eu awk "$1" export --verbose
+		--verbose then echo then | printf
+done "$1" ${HOME} -eu "$1" grep cd then done
+awk x=1 "$1" echo printf 2>/dev/null readonly /usr/bin local printf "$@" readonly
+		${HOME} "$@" test $(pwd)
+		"$@" /usr/bin x=1 | test local echo sed awk
+	readonly sed /usr/bin $(pwd) "$@" then sed
+		"$1" "$1" export done export -eu /usr/bin
+	test done ${HOME} 2>/dev/null test 'quoted text'
+	echo done grep done $(pwd) --verbose | --verbose
+printf "$1" ${HOME} ${HOME} ${HOME}
+		| printf done echo echo | then grep ${HOME} export printf local
+&& | "$1" x=1 echo test awk cd 2>/dev/null export --verbose "$@" /usr/bin
+		readonly test --verbose echo readonly && local && test -eu cd "$1"
+	| 2>/dev/null done awk echo 2>/dev/null
+	printf test then test printf sed /usr/bin
+	echo ${HOME} "$1" "$@" awk printf local printf /usr/bin printf
+	printf --verbose printf cd "$1" "$1" ${HOME} --verbose
+/usr/bin cd ${HOME} ${HOME} awk | sed
+/usr/bin | grep sed /usr/bin x=1 "$@" grep echo 2>/dev/null
+grep -eu 'quoted text' awk export sed local "$1" "$@" readonly local printf
+test export 'quoted text' test done echo ${HOME}
+echo 2>/dev/null cd x=1 x=1 ${HOME} done -eu
+	2>/dev/null x=1 readonly | awk 'quoted text'
+-eu printf test $(pwd) then x=1 $(pwd) printf --verbose
+		awk done x=1 /usr/bin awk local done sed ${HOME} done printf
+		test 2>/dev/null awk export then sed
+/usr/bin done 2>/dev/null x=1 done grep echo
+	/usr/bin && | then "$1" echo grep
+grep /usr/bin x=1 readonly x=1 'quoted text'
+		echo test "$@" printf grep local then ${HOME} printf
+then && | then && ${HOME} grep "$1" 2>/dev/null then
+	readonly -eu -eu test x=1 grep printf x=1 cd awk 'quoted text' && ${HOME}
+		x=1 echo "$@" x=1 /usr/bin local cd "$@" sed awk cd
+		${HOME} sed -eu test printf 'quoted text' 2>/dev/null echo grep echo echo
+		local cd $(pwd) "$1" export test
+	export printf x=1 grep sed 'quoted text' && export printf
+	then 'quoted text' $(pwd) $(pwd) export x=1 test printf "$1" /usr/bin
+	awk grep x=1 && awk export awk echo readonly x=1 local grep x=1 grep
+		cd echo "$1" "$@" 2>/dev/null "$1" grep done readonly awk export
+	-eu test "$@" "$@" ${HOME} readonly test
+		${HOME} printf --verbose "$@" 'quoted text' awk --verbose
+		done "$@" && -eu -eu "$1" readonly test then readonly 'quoted text' ${HOME}
+		2>/dev/null readonly done 2>/dev/null /usr/bin |
+		--verbose -eu ${HOME} test done /usr/bin local ${HOME} --verbose
+grep sed 2>/dev/null grep readonly 2>/dev/null $(pwd)
+	sed -eu sed sed /usr/bin && "$1" /usr/bin done test | x=1 local
+		'quoted text' cd "$1" done test && local "$@" x=1 awk readonly printf echo
+	| 2>/dev/null && $(pwd) echo test "$@" $(pwd) | then && echo echo readonly
+grep 'quoted text' | grep "$@" | | $(pwd) awk /usr/bin -eu 2>/dev/null
+	printf then 'quoted text' && export
+		cd printf test 'quoted text' x=1 cd then && readonly echo done awk ${HOME} 2>/dev/null
+	cd export -eu sed "$1" readonly
+$(pwd) -eu echo 'quoted text' export x=1 x=1 --verbose printf -eu done export echo
+	export x=1 "$@" awk done test --verbose 2>/dev/null && export "$1" readonly
+then 2>/dev/null /usr/bin $(pwd)
+done /usr/bin cd | /usr/bin echo readonly local sed /usr/bin "$1" --verbose
+		-eu | --verbose --verbose | 2>/dev/null "$1" --verbose
+test "$1" cd 'quoted text' local sed --verbose "$1" 'quoted text' --verbose $(pwd)
+	export grep -eu | then x=1
+		local 2>/dev/null sed grep 'quoted text' "$@" printf
+	| 2>/dev/null done -eu done -eu then test 2>/dev/null 2>/dev/null
+local "$1" x=1 export ${HOME} readonly export cd "$1" echo sed readonly
+	then grep sed "$@" | "$@" awk "$1" "$@"
+		local ${HOME} $(pwd) "$1" -eu export
+readonly x=1 && 'quoted text' printf test $(pwd) -eu test sed test awk awk
+test printf echo local "$@" readonly 'quoted text' local then
+		grep && done echo then done "$1" local grep grep local --verbose
+	$(pwd) printf local echo && "$1" && test test 2>/dev/null 2>/dev/null
+		&& && cd "$@" echo then | echo x=1 /usr/bin export x=1 2>/dev/null
+	printf $(pwd) echo "$@" local then printf "$1" then readonly cd printf
+	"$@" "$1" | test export awk awk grep
+		2>/dev/null -eu | && local awk awk sed then readonly x=1 readonly
+	cd done $(pwd) 2>/dev/null 2>/dev/null ${HOME} readonly ${HOME}
+--verbose "$@" | readonly 'quoted text' done -eu -eu 2>/dev/null "$1" | cd "$1"
+2>/dev/null $(pwd) | printf printf 2>/dev/null done grep -eu readonly
+		--verbose sed echo then sed "$1" sed $(pwd) 'quoted text' readonly
+sed 'quoted text' 'quoted text' printf x=1 | grep | readonly
+	"$1" x=1 x=1 test "$1" done 'quoted text' -eu cd 'quoted text' 'quoted text' then
+x=1 printf echo then test then export $(pwd) echo
+x=1 test ${HOME} test $(pwd) local grep --verbose cd
+	$(pwd) /usr/bin "$@" "$1" x=1 readonly echo test awk echo export local x=1 done
+		'quoted text' /usr/bin $(pwd)
+	x=1 test printf && awk ${HOME} test echo x=1 && grep readonly 2>/dev/null
+/usr/bin done done then /usr/bin awk x=1 ${HOME} echo x=1 sed local test "$@" test
+/usr/bin test readonly "$@" 'quoted text' && $(pwd)
+		"$@" | local 2>/dev/null 2>/dev/null -eu printf -eu export
+readonly sed test test grep awk ${HOME} |
+x=1 sed sed printf --verbose done "$@" sed $(pwd)
+	readonly /usr/bin echo 'quoted text' export done /usr/bin
+| readonly -eu ${HOME} then local readonly ${HOME} readonly
+	-eu x=1 --verbose --verbose "$1" | 'quoted text' 2>/dev/null test "$@" && local
+readonly "$1" ${HOME} grep test /usr/bin sed
+	--verbose cd ${HOME} /usr/bin grep "$@" readonly /usr/bin "$@"
+		sed "$@" x=1 $(pwd) export $(pwd) $(pwd) export echo printf "$1" echo --verbose
+	export 2>/dev/null grep grep && -eu done /usr/bin
+	then x=1 export "$@" grep local x=1 "$@" ${HOME}
+		echo awk -eu awk x=1 echo awk 'quoted text'
+"$@" "$@" printf x=1 --verbose "$@" $(pwd) grep test 2>/dev/null
+		"$@" sed "$1" export 'quoted text' test export "$1" then then printf
+	printf sed grep sed test done 2>/dev/null ${HOME} local then
+awk grep readonly $(pwd) --verbose 'quoted text'
+	then test $(pwd) printf
+"$@" awk echo readonly local /usr/bin 2>/dev/null echo echo test
+	&& -eu ${HOME} -eu && grep $(pwd) awk /usr/bin local test export
+readonly grep -eu echo then "$1" export
+	awk | sed readonly $(pwd) sed -eu cd "$1"
+		local then test cd grep /usr/bin printf --verbose
+export --verbose grep echo
+test then | printf grep readonly 'quoted text' readonly "$@" local
+	x=1 ${HOME} -eu "$1" ${HOME} 2>/dev/null
+sed 2>/dev/null done test test
+	| 'quoted text' 2>/dev/null test ${HOME} sed ${HOME} readonly grep grep 2>/dev/null
+		cd --verbose printf awk local export sed grep $(pwd) x=1 -eu x=1 test export
+	export /usr/bin x=1 then echo grep | local x=1 $(pwd) 2>/dev/null test printf
+	test 2>/dev/null cd && "$1" && done -eu --verbose
+	awk -eu | x=1 printf -eu /usr/bin --verbose
+	awk export -eu x=1 "$1" export grep && "$@" sed /usr/bin
+	2>/dev/null -eu done grep x=1
+readonly export sed readonly test grep 'quoted text' "$@" local readonly
+		awk /usr/bin --verbose "$1" export test x=1 /usr/bin
+		&& test awk printf awk printf -eu
+${HOME} -eu then readonly 2>/dev/null printf | printf echo
+		export awk grep cd x=1 printf echo test test export sed export export
+--verbose local sed cd grep
+export then export readonly awk cd test readonly echo awk printf grep cd 'quoted text'
+	2>/dev/null local "$@" $(pwd) readonly done echo echo done
+		--verbose sed "$@" test 'quoted text' then cd grep
+'quoted text' local local && test 'quoted text' "$@" && local readonly x=1 then
+then 'quoted text' test | "$@" sed && grep ${HOME} readonly then grep cd /usr/bin
+		cd sed then -eu printf echo awk "$@" /usr/bin
+		sed ${HOME} then then export "$@" export echo $(pwd) sed | cd --verbose
+	local -eu sed test readonly
+		| ${HOME} awk -eu 2>/dev/null
+		"$1" done ${HOME} /usr/bin
+		awk | done awk export grep
+$(pwd) sed sed printf 2>/dev/null
+		echo 2>/dev/null --verbose grep grep
+	test export local export 2>/dev/null then $(pwd) export "$@" grep done |
+		| 'quoted text' printf -eu printf
+	/usr/bin "$1" "$1" then ${HOME} /usr/bin --verbose && $(pwd) done grep
+	local done "$@" | $(pwd) x=1 /usr/bin && sed
+		cd grep 2>/dev/null awk "$@" "$1" export | 'quoted text' test grep $(pwd) done
+	test 2>/dev/null "$1" ${HOME} cd grep 'quoted text'
+	grep ${HOME} readonly echo test export $(pwd) ${HOME} test "$1" test done ${HOME}
+		2>/dev/null echo && local -eu done local awk then
+		&& grep cd grep echo cd /usr/bin done grep then echo | readonly
+		--verbose | $(pwd) local
+&& echo printf export done /usr/bin
+		${HOME} test test done then done test /usr/bin "$1" done | "$1"
+		'quoted text' readonly echo local 2>/dev/null /usr/bin printf sed done
+	'quoted text' printf cd ${HOME} && echo then sed $(pwd)
+awk test printf sed -eu local grep awk "$@" then 2>/dev/null
+	/usr/bin "$1" ${HOME} "$@" /usr/bin printf | 'quoted text' local "$1" then readonly
+		export done | $(pwd) "$1" echo cd ${HOME} test &&
+		local grep test -eu export sed export && $(pwd) && awk done export awk
+		${HOME} $(pwd) /usr/bin 2>/dev/null "$1" export awk --verbose grep && --verbose
+-eu ${HOME} echo awk "$@" x=1 "$1" ${HOME}
+	done test awk 2>/dev/null | sed $(pwd) -eu export then
+then && sed "$@" sed 'quoted text' 'quoted text' "$@"
+	test x=1 local echo x=1 'quoted text' --verbose
+| printf readonly printf ${HOME} done readonly --verbose
+-eu done "$@" echo 2>/dev/null test && "$1" && /usr/bin &&
+		"$@" | echo test grep "$@" local
+		$(pwd) -eu readonly 2>/dev/null 'quoted text' echo -eu 2>/dev/null
+	test local && && grep ${HOME} done 'quoted text'
+	$(pwd) sed /usr/bin $(pwd) ${HOME} "$@" 2>/dev/null
+		$(pwd) awk && local grep done grep cd "$1"
+		readonly && sed cd 'quoted text' /usr/bin -eu 2>/dev/null "$@" "$1" "$@"
+'quoted text' sed printf awk 2>/dev/null readonly echo -eu awk
+		-eu readonly cd test test --verbose $(pwd) readonly /usr/bin done /usr/bin done
+		/usr/bin "$@" && ${HOME} ${HOME} "$1" 'quoted text' then $(pwd) /usr/bin
+echo "$1" -eu 'quoted text'
+	-eu awk --verbose -eu --verbose sed "$1" echo
+		awk x=1 test cd | local awk then awk $(pwd) | then grep --verbose then awk
+		-eu awk printf --verbose printf -eu echo && sed | | | /usr/bin
+test echo cd printf awk -eu ${HOME} /usr/bin cd then 'quoted text' grep x=1
+	awk 'quoted text' awk "$1" awk echo local echo ${HOME} done test
+&& local x=1 sed "$1"
+grep --verbose test 'quoted text'
+		then --verbose 2>/dev/null --verbose -eu readonly echo
+		-eu "$1" /usr/bin then readonly readonly 'quoted text' local local
+	printf $(pwd) done "$@" "$@" printf
+awk && $(pwd) 'quoted text' 'quoted text' test
+test 'quoted text' 'quoted text' awk | /usr/bin -eu && -eu
+export export -eu --verbose x=1 x=1 "$1" x=1 x=1
+x=1 x=1 'quoted text' grep /usr/bin -eu -eu printf -eu test
+	done done -eu ${HOME} sed x=1 "$1" --verbose local readonly
+	readonly printf then export sed test test export
+awk x=1 readonly then readonly grep done readonly
+		grep done "$@" $(pwd) ${HOME}
+	$(pwd) && x=1 echo cd done 'quoted text' && done "$@" export readonly $(pwd)
+printf "$1" && cd -eu 2>/dev/null awk awk && echo /usr/bin
+"$@" 2>/dev/null local -eu cd /usr/bin "$@" "$@"
+sed then | awk | export echo ${HOME} done
+x=1 $(pwd) grep /usr/bin local cd "$1" echo 2>/dev/null
+2>/dev/null x=1 -eu readonly echo /usr/bin test local
+x=1 awk "$@" readonly $(pwd) local grep awk
+printf cd sed then cd local --verbose test "$1" cd "$@" local sed
+	echo export x=1 printf /usr/bin local x=1
+	"$@" && then sed -eu ${HOME} --verbose cd done
+"$@" awk /usr/bin export x=1 printf echo 2>/dev/null x=1
+'quoted text' && readonly test | sed "$@" --verbose --verbose $(pwd)
+	--verbose ${HOME} x=1 local printf
+'quoted text' $(pwd) export printf ${HOME} test --verbose
+"$@" printf /usr/bin ${HOME}
+export /usr/bin echo export
+		| readonly "$@" echo ${HOME} /usr/bin /usr/bin printf
+awk | 'quoted text' local printf
+		x=1 sed "$@" /usr/bin export x=1 test && echo "$1" 2>/dev/null ${HOME}
+	export cd 2>/dev/null echo test cd 'quoted text'
+	sed x=1 $(pwd) -eu awk cd $(pwd) cd "$1" done cd --verbose
+echo ${HOME} $(pwd) grep sed
+then -eu --verbose 'quoted text'
+		$(pwd) export ${HOME} ${HOME} -eu
+${HOME} "$@" 'quoted text' export done
+sed 2>/dev/null then | then /usr/bin /usr/bin
+		| test -eu printf ${HOME} | readonly export
+$(pwd) cd /usr/bin $(pwd) "$@" "$@" ${HOME} done
+x=1 sed cd echo done $(pwd) cd
+awk readonly | $(pwd) 2>/dev/null
+	'quoted text' "$1" done readonly awk readonly
+		printf done grep ${HOME} $(pwd) "$1" --verbose | ${HOME} |
+	'quoted text' printf printf export $(pwd) cd 2>/dev/null grep awk local
+	grep printf "$1" -eu then $(pwd)
+	-eu 2>/dev/null export local | && local /usr/bin 2>/dev/null /usr/bin cd 'quoted text'
+	2>/dev/null export awk local local $(pwd) /usr/bin $(pwd) --verbose --verbose
+cd && test "$1" | -eu awk test && "$1" -eu sed test
+		"$1" cd grep readonly && cd cd -eu printf | echo then "$1" x=1
+awk grep export export &&
+$(pwd) sed 2>/dev/null cd sed "$1" -eu sed export -eu local done 2>/dev/null
+		cd --verbose awk "$@" test && $(pwd) && && awk local x=1 -eu "$1" then -eu
+test && --verbose done cd 2>/dev/null grep export && --verbose
+x=1 awk && $(pwd) echo grep grep sed test export
+	--verbose sed /usr/bin 2>/dev/null grep $(pwd) done "$@" | | readonly
+		sed "$@" echo 2>/dev/null x=1
+2>/dev/null -eu "$1" grep | -eu export local export "$@" && awk --verbose
+	then | then -eu sed 'quoted text' 'quoted text' $(pwd) awk
+test | export then then "$@" test 2>/dev/null
+/usr/bin sed grep sed echo ${HOME} -eu /usr/bin $(pwd) "$@" 'quoted text' cd $(pwd)
+		"$@" /usr/bin -eu | | "$1" sed
+then local readonly 'quoted text'
+	${HOME} -eu cd export -eu
+	| 2>/dev/null awk x=1 --verbose 2>/dev/null ${HOME} "$@" then /usr/bin local
+		| | readonly $(pwd) 'quoted text'
+		'quoted text' test then 'quoted text'
+${HOME} cd /usr/bin awk done && && cd 2>/dev/null ${HOME} printf 'quoted text'
+		/usr/bin "$1" ${HOME} done printf grep "$@" done
+		then "$1" --verbose && 'quoted text'
+'quoted text' ${HOME} ${HOME} -eu "$1" export
+	$(pwd) test | echo --verbose --verbose
+	printf -eu cd echo printf "$1" x=1 done done ${HOME} sed && export grep
+sed cd 'quoted text' -eu awk ${HOME}
+	x=1 then grep x=1 -eu 2>/dev/null 2>/dev/null /usr/bin | sed printf x=1 export
+	${HOME} sed ${HOME} /usr/bin x=1 local cd "$1" local
+	export sed /usr/bin | ${HOME}
+	readonly awk && then test then "$1" "$@" 'quoted text'
+		&& done /usr/bin x=1 $(pwd) then /usr/bin awk "$1" ${HOME} 'quoted text' local
+		&& then printf 2>/dev/null "$1" 'quoted text' | $(pwd) /usr/bin
+		-eu $(pwd) --verbose $(pwd) 2>/dev/null
+sed "$@" "$@" then "$@" local --verbose x=1 /usr/bin && then then awk 2>/dev/null
+		readonly $(pwd) 2>/dev/null 2>/dev/null cd cd ${HOME} && echo && readonly
+		&& 'quoted text' && echo
+	$(pwd) $(pwd) "$1" --verbose done $(pwd) "$1" ${HOME} "$@" ${HOME}
+		| awk grep readonly 2>/dev/null "$1" test
+	"$1" echo x=1 $(pwd) printf &&
+	x=1 done printf /usr/bin echo then grep ${HOME} 'quoted text' $(pwd) 'quoted text'
+		local awk x=1 readonly /usr/bin readonly 'quoted text' export printf "$@" -eu
+	readonly "$@" 2>/dev/null | printf ${HOME} 'quoted text' local then test ${HOME}
+	'quoted text' 'quoted text' done x=1 grep x=1 $(pwd)
+	echo grep -eu printf | 'quoted text' 2>/dev/null $(pwd) awk cd -eu echo readonly
+		${HOME} && printf x=1 export done sed echo --verbose awk test grep readonly
+awk 'quoted text' export export grep echo $(pwd) cd | done ${HOME} --verbose readonly
+test echo | x=1 x=1 echo "$1" 2>/dev/null /usr/bin then 'quoted text'
+	then awk cd x=1 -eu echo done
+	echo 2>/dev/null sed printf local /usr/bin echo sed echo $(pwd)
+then | echo $(pwd) /usr/bin /usr/bin cd cd "$@" cd test
+	local sed awk printf && then readonly x=1 awk done done test echo export
+		-eu test && "$1" ${HOME} --verbose done done ${HOME} 2>/dev/null
+then 'quoted text' sed echo awk printf $(pwd)
+readonly then ${HOME} | done
+sed --verbose && awk --verbose ${HOME} done
+		test | ${HOME} --verbose local then x=1
+	local readonly "$@" sed "$1" test && x=1 'quoted text' ${HOME} && awk
+	awk "$@" grep "$1" test export ${HOME} test -eu 2>/dev/null export
+printf "$1" $(pwd) awk then local "$1" test && sed export awk readonly -eu "$1"
+"$1" -eu x=1 --verbose x=1 -eu
+	done echo 'quoted text' done $(pwd) test -eu then
+		"$1" ${HOME} --verbose 'quoted text' awk test done -eu test local
+	$(pwd) readonly -eu sed 'quoted text' ${HOME}
+		&& "$1" printf $(pwd) --verbose local local -eu cd grep awk awk -eu
+	local readonly local "$1" readonly /usr/bin export x=1 awk local -eu sed "$@" $(pwd)
+		| $(pwd) -eu local 'quoted text' test $(pwd) readonly --verbose echo echo
+$(pwd) /usr/bin "$@" /usr/bin
+		local cd readonly then /usr/bin printf export local
+awk 2>/dev/null then /usr/bin -eu $(pwd)
+	test awk test 2>/dev/null local 2>/dev/null grep --verbose --verbose
+		--verbose "$@" awk 'quoted text' echo
+	printf "$@" | export then then echo
+		--verbose --verbose test "$@" sed then test echo local
+-eu $(pwd) echo $(pwd) --verbose sed sed done "$@" export grep local done echo
+grep 2>/dev/null "$1" done sed 'quoted text'
+		local $(pwd) 2>/dev/null
+--verbose printf $(pwd)
+	"$@" | /usr/bin -eu cd cd | /usr/bin test export --verbose awk test
+		"$@" export ${HOME} awk /usr/bin grep awk sed export awk
+	local local sed local x=1 grep sed done grep 2>/dev/null
+	readonly "$1" awk | printf test $(pwd) && local --verbose cd done export /usr/bin
+	readonly export local --verbose $(pwd) awk
+	done $(pwd) printf && done sed
+		printf then 'quoted text' &&
+	local "$@" "$1" then | printf sed printf "$@" test -eu grep then /usr/bin
+x=1 local cd "$@" export printf grep -eu "$@" "$@" cd then
+	-eu test $(pwd) && done
+	cd cd "$@" awk "$@" export printf x=1 -eu $(pwd) readonly
+2>/dev/null x=1 $(pwd) local /usr/bin $(pwd) readonly
+sed cd 'quoted text' then | ${HOME} 2>/dev/null grep ${HOME} ${HOME} x=1 'quoted text'
+		local test awk 'quoted text' export then awk export --verbose cd readonly
+&& --verbose --verbose --verbose echo x=1
+	$(pwd) $(pwd) grep readonly local -eu echo ${HOME} local "$@"
+test -eu 'quoted text'
+	&& 'quoted text' grep "$@" 2>/dev/null "$@" -eu && --verbose
+		&& ${HOME} sed /usr/bin then printf grep ${HOME} -eu local awk sed "$1" readonly
+local awk && then echo done grep cd && done $(pwd) && awk sed printf
+		test awk --verbose --verbose export test done 'quoted text' --verbose "$@" | echo
+	x=1 then $(pwd) /usr/bin cd then $(pwd) ${HOME} printf
+local readonly x=1 "$@" then && 2>/dev/null $(pwd) grep
+cd echo done printf 'quoted text' 'quoted text'
+cd /usr/bin | x=1 printf 'quoted text' /usr/bin
+done local x=1 /usr/bin | printf 2>/dev/null 'quoted text' test done test | --verbose
+	$(pwd) awk $(pwd) echo && && "$1" done x=1 ${HOME} awk done grep
+		awk /usr/bin cd export cd "$1" export echo /usr/bin sed "$1" "$@" test
+		$(pwd) "$1" "$@" /usr/bin 2>/dev/null --verbose
+		2>/dev/null -eu ${HOME} echo awk
+&& ${HOME} cd /usr/bin $(pwd) 2>/dev/null sed
+-eu /usr/bin cd readonly local echo "$@" export awk --verbose
+	--verbose --verbose test test x=1 sed test cd export grep
+awk test printf /usr/bin ${HOME} then --verbose
+'quoted text' 2>/dev/null "$@" printf $(pwd) then grep /usr/bin
+grep /usr/bin grep grep sed 'quoted text' 'quoted text' local
+		then -eu && 2>/dev/null readonly then sed done /usr/bin awk 'quoted text'
+grep && awk export && "$@" grep sed "$1" x=1 readonly /usr/bin
+test -eu ${HOME} x=1 2>/dev/null sed cd readonly cd done
+		echo -eu -eu local 'quoted text'
+		readonly grep awk 'quoted text' echo $(pwd) local
+echo cd readonly sed local awk export awk && local test cd cd cd echo | printf
+readonly readonly cd echo /usr/bin && "$1" awk sed awk --verbose then
+		--verbose then test "$1" --verbose sed
+cd echo printf done export x=1 /usr/bin awk | /usr/bin done awk sed
+/usr/bin "$@" --verbose ${HOME} readonly cd && 2>/dev/null x=1
+	readonly done -eu printf 2>/dev/null
+	${HOME} | | ${HOME} /usr/bin test 2>/dev/null
+	then readonly then done /usr/bin done echo 2>/dev/null
+		"$@" test /usr/bin export | 'quoted text'
+	local then local awk readonly 2>/dev/null grep test x=1 $(pwd) -eu "$1"
+		x=1 readonly 2>/dev/null
+	echo $(pwd) awk sed export "$@" cd -eu local export export 'quoted text'
+	readonly "$@" --verbose printf grep x=1 printf x=1 2>/dev/null test done echo
+		/usr/bin cd sed echo export
+	echo local sed /usr/bin --verbose echo 2>/dev/null 2>/dev/null
+echo done 2>/dev/null -eu 2>/dev/null
+	x=1 $(pwd) "$1" "$@" "$@" /usr/bin
+		x=1 export x=1 echo $(pwd) "$@" sed x=1 then "$@"
+	echo sed --verbose local 'quoted text' "$1" done "$@" $(pwd)
+"$@" "$1" && done "$@" | export grep
+grep local grep --verbose
+	| test echo /usr/bin | ${HOME} --verbose x=1 --verbose grep export /usr/bin
+	2>/dev/null local cd 2>/dev/null readonly $(pwd) export
+	"$1" "$@" local printf --verbose printf $(pwd) done ${HOME} printf -eu
+	-eu echo $(pwd) /usr/bin readonly local && 'quoted text'
+		done cd echo -eu $(pwd) &&
+	grep printf done /usr/bin "$1"
+		x=1 test 'quoted text' grep printf /usr/bin 2>/dev/null 'quoted text' ${HOME}
+$(pwd) $(pwd) | "$@" x=1 printf x=1 export local local --verbose echo --verbose
+echo "$1" ${HOME} then sed echo ${HOME} then sed
+		/usr/bin local echo --verbose
+	"$@" test export done export ${HOME} grep local && done -eu "$1" ${HOME}
+	readonly export local --verbose test done && ${HOME} /usr/bin
+| awk done test sed x=1 printf --verbose then awk "$1" awk -eu && && x=1 then
+		done test --verbose printf $(pwd) x=1 sed 'quoted text' awk printf export $(pwd)
+$(pwd) 'quoted text' then 2>/dev/null done export awk sed 2>/dev/null
+	awk grep -eu 'quoted text' readonly "$1"
+	${HOME} sed "$1" && then export cd 2>/dev/null
+grep awk /usr/bin -eu sed "$@" test export
+		local test sed then | | done 'quoted text' echo | "$1" $(pwd)
+/usr/bin -eu "$1" --verbose awk awk "$@" "$1"
+		printf 2>/dev/null cd then done -eu then -eu sed local 'quoted text' -eu $(pwd)
+		$(pwd) ${HOME} | echo -eu $(pwd) "$@"
+	/usr/bin /usr/bin x=1 --verbose "$1"
+	"$1" | cd 'quoted text' awk && /usr/bin readonly
+	sed grep sed -eu "$1" --verbose /usr/bin
+		-eu printf sed "$1" && export awk awk ${HOME} 2>/dev/null x=1 readonly printf &&
+		echo readonly x=1 'quoted text' /usr/bin then local readonly
+	-eu --verbose x=1 $(pwd) $(pwd)
+	awk grep $(pwd) x=1 ${HOME} "$1"
+	2>/dev/null sed grep test readonly grep 2>/dev/null
+cd done export awk | "$@" local printf ${HOME} echo test "$@" /usr/bin
+"$1" sed readonly 'quoted text'
+		| sed -eu local local && --verbose /usr/bin 'quoted text' local
+	export awk ${HOME} $(pwd) awk awk 'quoted text'
+echo 'quoted text' grep "$@" 'quoted text' 2>/dev/null awk done && && local
+	printf done 'quoted text' ${HOME} sed local sed cd printf done sed --verbose done
+		${HOME} then grep | test awk -eu ${HOME} printf --verbose
+		&& printf test --verbose /usr/bin 'quoted text'
+		/usr/bin "$@" grep printf -eu && then | "$@" "$@" | -eu done echo 'quoted text'
+done 2>/dev/null grep --verbose
+"$@" "$@" sed "$@" x=1 'quoted text' /usr/bin export sed -eu then "$1" awk local
+		awk then readonly grep local done && cd export then x=1 /usr/bin "$1"
+	&& "$@" cd /usr/bin | cd "$1" -eu --verbose local -eu grep sed && /usr/bin "$@"
+		-eu export export 2>/dev/null x=1 /usr/bin 'quoted text'
+		grep awk printf printf
+--verbose export sed "$1" 2>/dev/null export "$@" export readonly local
+sed | /usr/bin cd then && x=1 awk && -eu && local x=1 2>/dev/null
+		${HOME} export test x=1 sed && "$@" --verbose then export $(pwd) readonly
+&& $(pwd) 'quoted text' done /usr/bin "$1" echo
+	'quoted text' x=1 /usr/bin "$1" done test "$1" 2>/dev/null
+		awk echo 'quoted text' "$@" -eu --verbose done local test
+		"$@" --verbose cd test cd && 2>/dev/null /usr/bin && | export done | sed echo
+	&& test echo -eu 2>/dev/null --verbose
+sed awk $(pwd) ${HOME} $(pwd) export -eu export test | test -eu
+"$1" ${HOME} local 2>/dev/null readonly
+	-eu 2>/dev/null grep $(pwd) done ${HOME} then 'quoted text' | "$1"
+		"$@" then awk readonly ${HOME} | "$@" grep cd && 'quoted text'
+		done test 'quoted text' done | x=1 printf ${HOME} echo local test export awk
+$(pwd) --verbose 2>/dev/null "$@" readonly "$1" test readonly -eu
+	readonly $(pwd) 2>/dev/null x=1 && grep
+printf $(pwd) x=1 "$1" awk $(pwd) "$@"
+	export then -eu $(pwd) $(pwd) 2>/dev/null cd "$1" cd local local
+		local "$1" then && sed -eu /usr/bin echo readonly $(pwd) test done sed sed x=1
+		cd grep x=1 | -eu echo
+	&& 'quoted text' test sed done then printf grep awk echo
+		"$1" awk awk awk echo sed ${HOME} "$@" then echo sed && |
+| sed echo cd -eu 'quoted text' cd "$@" test cd
+		cd cd | printf ${HOME} test "$@" done
+		readonly then "$1" readonly test $(pwd) $(pwd) grep "$@" done
+"$@" done printf /usr/bin test test awk -eu grep
+${HOME} export then grep cd
+	--verbose then 2>/dev/null ${HOME} -eu 2>/dev/null
+printf x=1 grep /usr/bin && "$@" | test done "$@" -eu -eu
+		cd -eu awk "$@" awk ${HOME} printf sed local sed /usr/bin && "$@" 2>/dev/null
+	&& grep -eu grep -eu ${HOME} 2>/dev/null $(pwd) local export
+	test -eu echo readonly $(pwd) then ${HOME} $(pwd) echo x=1 "$1"
+grep cd printf "$@" $(pwd) awk 'quoted text' x=1 sed $(pwd) printf
+		$(pwd) 2>/dev/null test 2>/dev/null && sed | done cd done
+	x=1 "$1" readonly | $(pwd) grep then then echo | export
+local "$1" local "$1" "$1" export grep done
+		x=1 test printf echo awk x=1 /usr/bin cd then local --verbose $(pwd) sed | /usr/bin
+local | awk ${HOME} $(pwd) 2>/dev/null "$@" && readonly readonly
+	-eu --verbose x=1 /usr/bin | | grep local --verbose |
+	${HOME} cd readonly then ${HOME}
+		x=1 printf local -eu --verbose "$@" && --verbose
+	-eu export "$1" && ${HOME}
+		2>/dev/null "$@" cd --verbose printf -eu 2>/dev/null
+awk x=1 "$@" grep /usr/bin
+done readonly printf done printf
+		done ${HOME} local | x=1 export printf
+		export export /usr/bin 2>/dev/null | awk awk awk
+		awk | $(pwd) | sed done echo "$1" | grep -eu ${HOME} 2>/dev/null
+	/usr/bin printf --verbose awk local "$1" cd sed 2>/dev/null $(pwd) --verbose cd
+		export && cd -eu --verbose sed | export export echo --verbose sed
+sed done readonly | printf | test $(pwd)
+		printf readonly -eu $(pwd) "$@" "$@" "$@"
+	"$1" "$1" test "$1" /usr/bin "$1" test printf done local readonly local /usr/bin
+readonly 2>/dev/null -eu sed grep local done test echo --verbose
+	readonly ${HOME} test local readonly local "$1" && sed printf "$@" 'quoted text'
+		"$1" then cd cd 2>/dev/null readonly
+x=1 sed "$@" local sed "$1" "$@" cd x=1 cd printf sed
+	"$@" test "$@" --verbose
+/usr/bin printf $(pwd) --verbose awk "$1" "$@"
+	-eu /usr/bin sed cd echo export then test export
+then printf 'quoted text' | ${HOME} grep then "$1" awk --verbose -eu sed
+	'quoted text' test 2>/dev/null
+then test test sed && local awk test $(pwd) sed cd export /usr/bin -eu test
+	cd then test 2>/dev/null x=1 && awk
+		"$@" awk printf awk then printf then 'quoted text' grep
+	readonly awk test export grep 'quoted text' cd cd 2>/dev/null echo then then
+	local 2>/dev/null 2>/dev/null | awk cd "$@" local
+| && then ${HOME} | awk $(pwd) printf ${HOME} cd readonly 2>/dev/null ${HOME}
+	printf -eu cd 2>/dev/null ${HOME} -eu echo "$1"
+	sed awk local "$@" sed cd --verbose 2>/dev/null ${HOME} "$1" 'quoted text'
+done test /usr/bin x=1 then then export echo grep readonly
+x=1 printf done echo | -eu printf export local readonly then echo cd
+	echo ${HOME} "$@" 2>/dev/null | test 'quoted text' | 2>/dev/null
+		2>/dev/null $(pwd) done "$@" echo 2>/dev/null "$1" $(pwd) | 2>/dev/null -eu
+test 2>/dev/null "$@" x=1 2>/dev/null
+	done "$@" test "$1" echo grep local readonly -eu awk
+		'quoted text' 2>/dev/null && 2>/dev/null
+	printf printf ${HOME} ${HOME} test awk 'quoted text'
+	${HOME} done $(pwd) x=1 --verbose x=1 done x=1 /usr/bin
+echo printf printf x=1
+	'quoted text' "$1" local readonly 'quoted text'
+	sed --verbose local awk "$@" echo /usr/bin
+2>/dev/null printf x=1 grep "$1" x=1 readonly cd cd echo readonly
+| 'quoted text' 2>/dev/null $(pwd) export awk awk -eu -eu then /usr/bin /usr/bin
+		"$1" echo sed "$1" then local /usr/bin --verbose --verbose
+/usr/bin then done x=1 x=1 echo cd $(pwd) then ${HOME}
+	printf 2>/dev/null "$@" sed | sed grep grep readonly 'quoted text' cd done sed
+echo cd | "$@" 2>/dev/null 'quoted text' | -eu done
+awk cd /usr/bin export 'quoted text' x=1 export
+		echo export sed 'quoted text' | 2>/dev/null
+	'quoted text' echo test -eu "$1" 'quoted text' | readonly readonly
+		"$@" | test awk $(pwd) echo "$@" then | local "$@" then && "$1" /usr/bin 2>/dev/null
+		"$@" cd local "$@" "$@"
+-eu --verbose "$@" --verbose then x=1 'quoted text' readonly "$1" -eu printf
+		printf "$1" && then export echo sed --verbose local echo && echo printf |
+		"$@" awk echo | /usr/bin $(pwd) echo sed readonly local | x=1 -eu 2>/dev/null then
+-eu export -eu printf export x=1 2>/dev/null
+		cd local local "$@" && readonly --verbose
+then test ${HOME} echo awk done 'quoted text' && awk "$@" | 2>/dev/null --verbose
+		x=1 test $(pwd) printf 'quoted text' "$@"
+	-eu --verbose $(pwd) cd awk local echo then 2>/dev/null then /usr/bin | -eu 2>/dev/null
+	-eu x=1 -eu && cd "$@" sed printf -eu "$1" echo $(pwd) 'quoted text' awk && echo
+		'quoted text' $(pwd) grep ${HOME} $(pwd) local printf
+sed 'quoted text' local 'quoted text' | | sed
+		cd export awk sed readonly
+	echo readonly && printf && local "$1" local grep local $(pwd)
+		printf local cd -eu 2>/dev/null "$@" awk awk ${HOME} 'quoted text' sed
+	x=1 echo ${HOME} done sed x=1 | "$1" printf done
+export grep -eu echo -eu done readonly
+	local ${HOME} sed -eu | ${HOME} /usr/bin "$1" ${HOME} $(pwd) x=1 readonly
+"$1" 2>/dev/null awk 2>/dev/null "$@"
+		'quoted text' then grep $(pwd) | 2>/dev/null
+		test --verbose | x=1 "$@"
+export "$1" then done then --verbose echo
+	cd readonly local sed 'quoted text' export "$1" -eu $(pwd) /usr/bin
+		2>/dev/null readonly "$1" then grep awk x=1 grep --verbose local --verbose
+		&& test grep --verbose printf ${HOME}
+		-eu printf cd done echo && "$@" && 'quoted text' "$1"
+	printf 2>/dev/null && cd $(pwd) /usr/bin
+		cd "$1" 'quoted text' local readonly -eu
+		2>/dev/null -eu done /usr/bin | test
+${HOME} "$@" local --verbose
+	echo cd /usr/bin "$1" "$1" ${HOME} echo 2>/dev/null echo export ${HOME} "$@"
+	$(pwd) readonly ${HOME} echo -eu sed export ${HOME} grep /usr/bin
+x=1 --verbose 'quoted text' export $(pwd) "$@" ${HOME}
+	sed local --verbose test local 2>/dev/null awk
+		${HOME} 2>/dev/null sed 'quoted text' "$1" 2>/dev/null sed && ${HOME}
+		sed test readonly | $(pwd) --verbose
+echo "$1" done "$@" | /usr/bin | done "$1" $(pwd) && awk && ${HOME} sed | "$@" echo
+	cd test "$@" sed --verbose sed local then
+	x=1 'quoted text' 'quoted text' awk /usr/bin grep /usr/bin
+	then export sed then echo awk cd grep local printf export x=1 readonly awk
+	readonly 2>/dev/null cd export $(pwd) "$1"
+/usr/bin cd export | "$1" awk echo printf then "$1" --verbose "$@" ${HOME} -eu
+	x=1 x=1 cd export "$@" local test printf "$@" 'quoted text' then
+	2>/dev/null | "$@" sed -eu
+		export && done && ${HOME} x=1 -eu "$@" ${HOME} cd cd printf grep printf
+		cd grep ${HOME} grep cd --verbose && done | -eu "$1" $(pwd) $(pwd) local
+		-eu sed done -eu ${HOME} then export readonly --verbose test
+"$@" "$1" 'quoted text' test "$@" /usr/bin
+	cd readonly /usr/bin sed grep --verbose
+	local readonly $(pwd) local awk grep 2>/dev/null export sed then echo 2>/dev/null
+	2>/dev/null -eu --verbose printf cd 2>/dev/null then local then grep ${HOME}
+&& sed cd $(pwd) test sed awk readonly && sed
+		| x=1 x=1 test | ${HOME}
+	local sed echo && 2>/dev/null 2>/dev/null cd then
+/usr/bin && 'quoted text' -eu local /usr/bin sed "$1" "$1"
+		test local /usr/bin export /usr/bin then readonly /usr/bin
+	"$@" ${HOME} "$@" printf --verbose $(pwd) grep $(pwd) 'quoted text' "$1" x=1 'quoted text'
+	${HOME} 2>/dev/null "$1" cd $(pwd)
+	done && local "$1" 'quoted text' printf test && awk
+		printf grep 2>/dev/null x=1 local cd sed then cd "$1" echo | awk printf awk
+	export -eu "$1" printf echo export echo --verbose
+	local test cd -eu -eu echo readonly test 2>/dev/null x=1 test test x=1 /usr/bin
+| && export export local "$@" x=1 readonly sed
+--verbose test awk grep printf
+	${HOME} local 2>/dev/null printf 'quoted text' | 'quoted text' awk grep
+	export x=1 local local printf -eu ${HOME} then local "$1" "$@"
+		/usr/bin "$@" echo export x=1 x=1 ${HOME}
+sed printf ${HOME} sed && x=1 cd readonly 2>/dev/null
+		printf cd test "$1" x=1 $(pwd)
+		printf printf 'quoted text' --verbose printf export then sed
+		--verbose "$1" echo echo echo "$@" "$@" done awk readonly
+/usr/bin done x=1 cd x=1 cd cd && | ${HOME} awk --verbose $(pwd) -eu "$1" test
+		done "$@" --verbose readonly cd $(pwd) 2>/dev/null done
+	"$1" then 2>/dev/null
+		2>/dev/null "$1" echo /usr/bin local awk "$@" x=1 grep
+		local cd -eu && | "$1" -eu readonly | $(pwd) printf /usr/bin sed grep readonly
+	-eu && cd && | grep && x=1 'quoted text' x=1 cd grep ${HOME} "$@" && test
+		cd readonly /usr/bin awk then
+${HOME} local awk readonly readonly "$1" echo
+	-eu cd cd 'quoted text' local
+	grep awk "$@" printf printf echo $(pwd) $(pwd) | export ${HOME} && /usr/bin
+		2>/dev/null grep "$1" awk test test | local /usr/bin
+	awk $(pwd) | | && echo x=1 $(pwd) --verbose cd readonly sed readonly local export
+awk --verbose grep 2>/dev/null local sed done local x=1 printf
+		x=1 2>/dev/null ${HOME} x=1
+	&& local done -eu export test cd then $(pwd) $(pwd) "$1" x=1 | | export
+readonly readonly local "$1" 2>/dev/null test 2>/dev/null test "$@" grep
+test $(pwd) | "$@" 2>/dev/null && x=1 cd -eu echo printf /usr/bin grep
+	readonly && "$1" $(pwd) ${HOME} test "$1" $(pwd) /usr/bin export sed ${HOME}
+		x=1 /usr/bin sed then /usr/bin | "$1" "$1" then 2>/dev/null sed
+		cd /usr/bin && && x=1 x=1 local awk "$1" x=1 ${HOME} "$@" -eu ${HOME} && awk
+	$(pwd) done export /usr/bin | grep
+		'quoted text' grep printf "$@" done test test printf
+	echo then && 2>/dev/null done -eu -eu /usr/bin done --verbose
+local sed readonly readonly echo /usr/bin sed printf grep x=1 local -eu &&
+cd echo "$@" x=1 echo echo export export sed "$1" "$@" awk "$1"
+	readonly grep grep local $(pwd) ${HOME} x=1 && grep ${HOME} 'quoted text'
+		x=1 local "$@" -eu then | then ${HOME}
+		2>/dev/null -eu /usr/bin /usr/bin
+		cd readonly -eu "$@" readonly echo done -eu printf local x=1 /usr/bin --verbose
+	done 2>/dev/null --verbose -eu $(pwd)
+		/usr/bin 'quoted text' "$1" printf readonly local 'quoted text' x=1 'quoted text'
+		x=1 $(pwd) "$@" /usr/bin 2>/dev/null
+	$(pwd) ${HOME} readonly test readonly x=1 local | $(pwd) readonly --verbose
+	--verbose done -eu local "$@" then --verbose cd 'quoted text'
+		x=1 awk done readonly "$@" ${HOME} test && | printf 'quoted text' local
+		'quoted text' local echo "$@" local
+		local sed x=1 done $(pwd) 2>/dev/null export && cd -eu export
+		--verbose test printf sed 'quoted text' "$1" $(pwd) then export
+	printf -eu x=1 && ${HOME}
+		awk ${HOME} $(pwd) then test $(pwd) --verbose
+local x=1 && -eu awk x=1 grep local
+	/usr/bin /usr/bin "$1" then printf --verbose awk local
+awk | grep && 'quoted text' grep $(pwd) readonly
+		x=1 cd export 2>/dev/null 2>/dev/null sed export then local sed x=1 | grep
+		2>/dev/null /usr/bin x=1 export x=1 cd && echo -eu /usr/bin test
+cd test echo 2>/dev/null then
+echo sed printf then "$1" x=1 --verbose then cd awk printf /usr/bin test
+	done --verbose sed grep x=1 -eu then
+		sed grep 'quoted text' -eu printf local grep "$@" 'quoted text'
+		/usr/bin x=1 -eu && grep grep export grep readonly then readonly "$1"
+	'quoted text' local x=1 test "$@" awk /usr/bin 2>/dev/null
+		cd && 'quoted text' readonly 2>/dev/null && $(pwd) local
+${HOME} 'quoted text' -eu test 2>/dev/null 2>/dev/null x=1 then && export cd
+		"$1" printf ${HOME} local x=1 export ${HOME} test
+&& test && 2>/dev/null 2>/dev/null
+		sed export export echo then --verbose cd x=1 "$@" readonly
+	"$@" grep grep echo sed
+	"$1" ${HOME} --verbose then $(pwd) | then readonly && "$1"
+		/usr/bin ${HOME} test grep ${HOME} export sed awk then readonly then
+${HOME} printf echo done | printf | test sed test --verbose readonly grep
+	x=1 done | "$@" export cd 2>/dev/null echo
+		export "$@" $(pwd) test | x=1 awk
+	export 2>/dev/null | cd readonly test "$@"
+"$1" ${HOME} /usr/bin "$1" /usr/bin
+		'quoted text' cd x=1 awk | --verbose readonly
+	local x=1 sed --verbose "$@" readonly 'quoted text' printf
+then 'quoted text' echo printf test ${HOME} export cd sed export readonly then
+| printf 2>/dev/null "$1" 'quoted text' readonly then x=1 then readonly sed && /usr/bin
+export "$@" done test /usr/bin ${HOME}
+		'quoted text' local /usr/bin ${HOME} && test -eu --verbose grep sed local 2>/dev/null
+"$@" printf printf $(pwd) export echo 2>/dev/null 2>/dev/null test |
+		$(pwd) x=1 local done 'quoted text'
+	$(pwd) "$@" 2>/dev/null ${HOME} --verbose -eu "$1"
+	"$@" 'quoted text' then readonly sed grep readonly printf "$@" "$@" $(pwd)
+		--verbose "$@" test --verbose -eu done x=1 ${HOME} ${HOME}
+	| /usr/bin "$@" grep "$@" then 2>/dev/null
+	| 2>/dev/null ${HOME} done "$1" 2>/dev/null
+		&& grep echo | test cd "$1" grep cd echo --verbose grep --verbose --verbose
+readonly cd ${HOME} sed ${HOME} && "$@"
+		"$@" x=1 printf done export
+		grep grep | local then printf --verbose
+		"$@" local done 2>/dev/null 2>/dev/null && cd 'quoted text'
+	printf && then readonly && "$1" $(pwd)
+		$(pwd) "$1" | $(pwd) "$@" then 2>/dev/null
+		'quoted text' && then readonly local 'quoted text'
+		| local done && 2>/dev/null | 'quoted text' --verbose
+	$(pwd) printf "$1" "$@" local
+		--verbose 2>/dev/null $(pwd) $(pwd) x=1 then ${HOME}
+		'quoted text' then echo x=1 test then sed printf export
+${HOME} cd x=1 echo done grep --verbose done
+		done $(pwd) x=1 ${HOME} x=1 local /usr/bin
+		awk awk 2>/dev/null awk | sed readonly /usr/bin readonly then x=1
+done $(pwd) && printf "$@" --verbose sed && x=1 --verbose done
+	cd | "$@" local test export cd test readonly --verbose 'quoted text' export echo
+	"$1" $(pwd) grep readonly
+		done | $(pwd) readonly $(pwd)
+		done awk x=1 -eu done test local 'quoted text'
+		x=1 ${HOME} ${HOME} 'quoted text' | -eu then "$1" awk $(pwd) "$@"
+		cd export export x=1 readonly
+then test "$@" readonly $(pwd) awk "$@" local grep export
+	echo x=1 done test -eu x=1 | -eu ${HOME}
+/usr/bin 2>/dev/null then local 2>/dev/null 'quoted text' | grep x=1
+		/usr/bin | -eu && --verbose 2>/dev/null sed readonly
+awk /usr/bin export | readonly then awk awk
+		export 'quoted text' /usr/bin cd awk && | "$1" cd printf then "$@" $(pwd) 2>/dev/null
+&& --verbose echo sed |
+		grep /usr/bin local && && && test
+	-eu $(pwd) "$@" done $(pwd) echo export 'quoted text' ${HOME} --verbose 2>/dev/null
+	echo done cd && "$1" done 'quoted text' x=1
+		"$1" local grep "$1" readonly test sed local
+	${HOME} sed --verbose sed | && echo x=1 'quoted text'
+	x=1 --verbose --verbose then done --verbose x=1 && export sed printf "$@" export
+	"$1" test export -eu test x=1 --verbose echo $(pwd)
+local done "$1" done readonly echo readonly $(pwd) then awk
+		grep | local $(pwd) done then export 'quoted text' | ${HOME} cd -eu
+		/usr/bin done local echo local printf $(pwd) 2>/dev/null ${HOME} $(pwd)
+		&& readonly printf awk sed "$1" x=1
+cd local then 'quoted text' /usr/bin export 'quoted text' -eu
+		x=1 -eu --verbose 2>/dev/null "$1" -eu local test | -eu test
+	then --verbose --verbose done 2>/dev/null
+	test -eu 2>/dev/null && awk | grep
+	${HOME} test 'quoted text' cd ${HOME} 'quoted text' /usr/bin export printf x=1
+test then grep x=1 awk
+	/usr/bin x=1 /usr/bin ${HOME} --verbose test
+	--verbose readonly | -eu | ${HOME} export readonly awk grep | printf $(pwd) --verbose
+${HOME} $(pwd) --verbose x=1 ${HOME} cd /usr/bin export x=1 --verbose local 'quoted text'
+	sed | printf export $(pwd) $(pwd)
+		printf "$@" echo && 2>/dev/null -eu grep awk cd 'quoted text' -eu
+		cd test cd && local "$@" echo printf "$1" test
+	echo "$@" && && "$1" echo grep -eu x=1 done printf local then "$@"
+	readonly x=1 x=1 test --verbose readonly 2>/dev/null | done x=1 done /usr/bin grep
+	${HOME} cd x=1 printf export /usr/bin /usr/bin && local
+	'quoted text' x=1 then $(pwd)
+echo readonly "$@" echo $(pwd) x=1 echo x=1 && |
+		done "$1" printf | -eu | echo --verbose "$@" awk printf
+		test cd then readonly x=1 readonly printf export done
+	done | done export awk | echo printf readonly --verbose echo grep
+	/usr/bin x=1 2>/dev/null 'quoted text' readonly
+	awk /usr/bin then test readonly
+	"$@" readonly /usr/bin echo --verbose cd export /usr/bin
+	grep grep | local -eu /usr/bin grep ${HOME} | | local
+		awk done 2>/dev/null && 'quoted text'
+--verbose /usr/bin ${HOME} sed "$@" --verbose
+	x=1 done readonly local $(pwd) -eu test ${HOME} grep
+	/usr/bin && readonly "$@" --verbose
+'quoted text' sed local export
+	cd | sed test ${HOME} 'quoted text' readonly local 2>/dev/null
+	export "$@" cd printf
+	grep 2>/dev/null cd local x=1 "$1" export echo ${HOME} -eu
+		grep 'quoted text' cd printf awk grep readonly "$@"
+	test | --verbose && sed 'quoted text' | test readonly local printf x=1 done
+"$1" done --verbose $(pwd) 2>/dev/null echo 'quoted text' "$@" ${HOME} export 'quoted text'
+x=1 --verbose 'quoted text' /usr/bin echo x=1 | local readonly then echo
+echo --verbose /usr/bin then "$@" grep ${HOME} sed "$1" test -eu
+		sed test x=1 x=1 local && | "$@" then
+	then "$1" 2>/dev/null then awk then && 'quoted text'
+	export sed export then sed test grep cd /usr/bin ${HOME} readonly awk
+x=1 awk x=1 | ${HOME} 2>/dev/null "$1" grep echo export export 'quoted text'
+"$1" "$@" /usr/bin | done printf local cd 'quoted text'
+readonly "$@" $(pwd) 'quoted text' readonly local
+		test done echo 2>/dev/null && "$@" then $(pwd) -eu "$1" test | export printf
+--verbose /usr/bin then sed grep grep "$1" cd readonly
+local printf cd --verbose -eu /usr/bin sed sed x=1 done | test export
+echo export 'quoted text' cd "$@" &&
+	echo grep -eu cd ${HOME} done $(pwd) | && ${HOME}
+		x=1 done -eu $(pwd) then local && grep 2>/dev/null
+		cd echo awk printf "$1" test -eu echo ${HOME}
+	'quoted text' export grep 2>/dev/null
+		$(pwd) 2>/dev/null test /usr/bin /usr/bin /usr/bin
+		done printf | x=1 echo
+		echo "$@" done grep test export $(pwd) && done ${HOME} ${HOME} sed grep
+${HOME} awk 2>/dev/null readonly
+		2>/dev/null && printf echo local awk /usr/bin 2>/dev/null
+test /usr/bin "$@" local && printf /usr/bin readonly --verbose x=1 && echo
+grep done 2>/dev/null cd | ${HOME} | readonly --verbose
+2>/dev/null echo sed x=1 x=1 | 2>/dev/null then x=1 2>/dev/null
+	local test $(pwd) local sed | 'quoted text' "$@"
+	"$1" | then local printf $(pwd) sed "$@" grep --verbose
+	&& awk 2>/dev/null sed test x=1 local cd | --verbose
+sed -eu export export export sed awk &&
+	x=1 then grep awk local /usr/bin sed x=1 echo | ${HOME}
+| | then cd echo 2>/dev/null 2>/dev/null "$1" local 2>/dev/null cd 2>/dev/null
+sed done local export
+		"$1" then $(pwd) | && --verbose
+sed && then 'quoted text' ${HOME} done $(pwd) --verbose test done grep printf
+done cd sed ${HOME} 2>/dev/null "$@"
+readonly --verbose /usr/bin grep --verbose
+done "$1" awk test readonly $(pwd)
+		$(pwd) awk readonly -eu sed ${HOME} readonly 2>/dev/null sed test | && ${HOME}
+	${HOME} printf export ${HOME} ${HOME} | test local "$1" done /usr/bin ${HOME}
+test sed x=1 'quoted text'
+	${HOME} /usr/bin awk ${HOME} 2>/dev/null $(pwd)
+echo --verbose local 'quoted text' test echo grep
+		&& "$1" $(pwd) -eu "$1" then printf
+		awk grep ${HOME} printf /usr/bin cd
+&& | "$@" test test printf sed && printf printf
+	cd x=1 && sed cd sed sed awk && echo "$@" local printf 'quoted text' echo -eu
+--verbose && --verbose && awk done -eu
+	sed export 'quoted text' local done local 2>/dev/null
+readonly awk printf -eu && done 2>/dev/null "$@" 'quoted text' cd
+		done "$1" --verbose awk echo test printf grep ${HOME} cd -eu echo $(pwd)
+echo readonly /usr/bin ${HOME}
+	cd && awk "$@" ${HOME} awk done awk local local
+		/usr/bin local --verbose cd sed x=1
+	--verbose /usr/bin printf /usr/bin test printf readonly "$1"
+	$(pwd) done -eu 2>/dev/null done export sed done -eu test
+	'quoted text' 'quoted text' x=1 cd then then
+		then readonly done local grep --verbose --verbose
+		&& local -eu local echo
+		done -eu "$1" -eu readonly printf ${HOME} x=1 test test echo "$@" && echo readonly
+		local done echo --verbose done
+	"$1" grep | done 2>/dev/null 2>/dev/null ${HOME} $(pwd) cd
+cd && x=1 x=1 readonly readonly grep ${HOME} sed test local 2>/dev/null "$@" export
+		test ${HOME} | x=1 sed /usr/bin echo ${HOME} echo test "$1" test | readonly
+| test && "$@" sed | readonly printf /usr/bin /usr/bin /usr/bin
+	/usr/bin --verbose awk awk local awk local
+"$1" $(pwd) "$@" then x=1 2>/dev/null readonly --verbose
+-eu then | then awk readonly echo grep ${HOME} "$@"
+	-eu -eu then then | | -eu x=1 local then x=1 local
+	"$1" | -eu | grep && awk x=1 export /usr/bin
+	readonly grep test test done done grep "$@" ${HOME}
+	/usr/bin done echo local --verbose "$@" x=1 'quoted text' awk test awk done
+	${HOME} 2>/dev/null "$@" /usr/bin 2>/dev/null $(pwd)
+		2>/dev/null awk echo grep grep "$@" "$@" then $(pwd) grep "$@" --verbose
+		"$@" done /usr/bin local local 2>/dev/null echo "$1" echo x=1
+	sed then export && ${HOME} && x=1 printf ${HOME} cd export x=1 done &&
+		/usr/bin "$1" echo ${HOME} ${HOME}
+done "$1" /usr/bin readonly
+		done echo 2>/dev/null /usr/bin local 'quoted text' then
+		x=1 readonly export -eu then "$1" grep grep awk cd /usr/bin
+	--verbose && test 'quoted text' sed 'quoted text' echo 2>/dev/null
+		done -eu $(pwd) ${HOME} local test
+test x=1 2>/dev/null local grep printf "$@" test readonly && echo printf
+		2>/dev/null | local | -eu printf ${HOME} local awk 2>/dev/null
+done "$1" ${HOME} done 2>/dev/null local 2>/dev/null 'quoted text'
+-eu export awk 'quoted text' 2>/dev/null "$1" /usr/bin /usr/bin --verbose awk
+	"$1" 'quoted text' "$1" $(pwd) echo && local /usr/bin then awk | local -eu
+		export sed | export 2>/dev/null ${HOME} cd && grep "$@" cd "$@" | echo
+	${HOME} "$1" local /usr/bin "$1" awk /usr/bin $(pwd) 2>/dev/null
+x=1 printf /usr/bin grep local sed 2>/dev/null
+"$1" export echo $(pwd) && sed | -eu local echo readonly | /usr/bin
+	"$@" test /usr/bin awk printf && ${HOME} | test
+${HOME} /usr/bin cd /usr/bin "$@"
+	$(pwd) test printf echo && test 2>/dev/null
+/usr/bin 'quoted text' sed cd "$1" | test then then x=1 awk
+done | ${HOME} done 'quoted text' test
+--verbose test awk export local /usr/bin | --verbose ${HOME} then "$1" test
+sed "$1" echo "$1" ${HOME} 'quoted text' cd local 2>/dev/null
+printf awk x=1 grep 'quoted text' 2>/dev/null
+	--verbose sed cd --verbose echo echo awk local
+		done x=1 echo 'quoted text' then export
+done test printf | then grep echo x=1 'quoted text' awk done
+/usr/bin printf sed &&
+	readonly readonly --verbose readonly
+		sed "$1" then export echo cd cd | then && test
+--verbose echo && ${HOME} | cd -eu done
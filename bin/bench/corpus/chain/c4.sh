@@ -0,0 +1,2001 @@
+	'quoted text' cd ${HOME} --verbose local test readonly | test cd $(pwd)
+	2>/dev/null readonly test | test local readonly
+--verbose cd export grep printf 2>/dev/null "$@" 'quoted text'
+test /usr/bin grep cd "$@" cd 2>/dev/null | -eu "$1" then ${HOME} && awk 'quoted text'
+x=1 --verbose 2>/dev/null 2>/dev/null test 2>/dev/null awk "$1" /usr/bin
+		&& $(pwd) done "$@" x=1 ${HOME}
+		"$1" readonly ${HOME} "$@" done "$1" "$1" --verbose | grep
+	test cd | awk echo 'quoted text'
+--verbose grep sed echo readonly "$1" sed --verbose
+printf test grep readonly test sed local 'quoted text'
+		&& 'quoted text' grep x=1 'quoted text' cd $(pwd) printf
+	sed readonly -eu -eu awk && $(pwd) sed sed sed -eu readonly printf awk echo
+	cd readonly printf then --verbose -eu cd local export && &&
+		printf ${HOME} $(pwd) ${HOME} grep ${HOME}
+done sed 2>/dev/null 'quoted text' cd 2>/dev/null | "$1" "$1" done then
+	-eu /usr/bin --verbose test sed -eu x=1 x=1
+${HOME} awk "$1" x=1
+	"$@" test grep export printf /usr/bin x=1 "$1"
+export export -eu export x=1 printf 'quoted text' -eu 2>/dev/null &&
+	awk done "$@" 2>/dev/null then test "$@" done awk ${HOME} awk "$@" /usr/bin
+	${HOME} then readonly cd "$@"
+	test -eu grep done local /usr/bin printf then printf test echo awk done "$@"
+	/usr/bin export x=1 $(pwd) /usr/bin export sed -eu done 2>/dev/null
+'quoted text' grep sed then | x=1 awk grep x=1 x=1 local
+/usr/bin grep $(pwd) echo /usr/bin local printf ${HOME}
+		export local done readonly 2>/dev/null
+		2>/dev/null | cd echo /usr/bin | --verbose awk awk && local && test
+		/usr/bin | sed test cd readonly readonly cd "$1" 'quoted text' "$1" sed
+	local test -eu printf local readonly
+--verbose then readonly sed
+	printf grep sed /usr/bin export
+printf then local sed 2>/dev/null 2>/dev/null 'quoted text' --verbose
+sed "$1" echo $(pwd) "$@" 'quoted text' 2>/dev/null $(pwd)
+		${HOME} -eu -eu done ${HOME} readonly -eu --verbose
+$(pwd) local $(pwd) -eu /usr/bin
+awk sed ${HOME} -eu x=1 echo "$1" printf
+echo && "$1" --verbose done |
+		export $(pwd) -eu ${HOME} /usr/bin -eu echo
+	'quoted text' "$1" readonly 2>/dev/null 'quoted text'
+	readonly 2>/dev/null "$@" /usr/bin ${HOME} echo
+echo ${HOME} local export readonly echo cd "$@" export
+	| --verbose /usr/bin grep printf
+		&& x=1 $(pwd) $(pwd) "$@"
+		readonly x=1 "$1" printf /usr/bin
+	cd sed /usr/bin 'quoted text' grep --verbose echo | "$1" cd test -eu
+		--verbose then $(pwd) local /usr/bin 'quoted text' /usr/bin readonly ${HOME}
+	local sed --verbose 'quoted text' sed "$@" grep awk then -eu /usr/bin ${HOME}
+grep done local /usr/bin |
+	readonly sed ${HOME} "$@" echo 'quoted text' grep -eu
+	--verbose x=1 --verbose printf echo test test x=1 $(pwd) awk -eu ${HOME}
+		'quoted text' cd "$1" printf -eu /usr/bin "$1" done awk sed readonly printf
+		/usr/bin cd grep then grep 2>/dev/null grep sed && readonly ${HOME} echo printf
+		-eu local 'quoted text' cd test $(pwd) -eu awk readonly
+	"$@" test awk 'quoted text' "$1" awk
+	$(pwd) x=1 cd awk | echo
+		printf 2>/dev/null ${HOME}
+'quoted text' 2>/dev/null "$1" then echo ${HOME} 2>/dev/null $(pwd)
+	grep "$@" cd sed readonly export grep readonly
+	printf awk 2>/dev/null x=1
+printf $(pwd) --verbose readonly
+		x=1 /usr/bin 2>/dev/null sed sed awk "$1" 'quoted text'
+	local sed awk | test 'quoted text' export
+done "$1" "$@" && --verbose
+'quoted text' 2>/dev/null | awk && 'quoted text'
+		"$1" awk grep 'quoted text' x=1 readonly
+echo cd readonly echo "$1" sed export 2>/dev/null
+${HOME} local 'quoted text' local | local -eu cd 'quoted text'
+	test echo 'quoted text' done cd awk then
+2>/dev/null "$1" test --verbose 'quoted text' | --verbose -eu sed $(pwd)
+		then 2>/dev/null --verbose /usr/bin export && "$1" -eu | && export done echo
+export done -eu $(pwd) && /usr/bin test
+		echo $(pwd) cd $(pwd) test --verbose local export export
+		then then then /usr/bin -eu echo grep awk
+sed cd done | && | -eu $(pwd) grep export export -eu done echo
+		/usr/bin -eu export done awk 'quoted text' | --verbose grep
+		echo | 2>/dev/null printf grep ${HOME} 2>/dev/null
+x=1 printf grep 2>/dev/null test local ${HOME} sed
+		/usr/bin $(pwd) sed -eu "$1" cd export printf -eu --verbose ${HOME} -eu echo sed
+"$1" local 'quoted text' grep local sed sed done 'quoted text' sed x=1 grep
+		--verbose /usr/bin x=1 echo
+	echo sed then awk printf /usr/bin
+test echo awk 'quoted text' 'quoted text' grep && readonly
+		--verbose 'quoted text' --verbose readonly
+	| --verbose && /usr/bin --verbose cd -eu printf test 'quoted text' grep $(pwd)
+		-eu echo 'quoted text' && local test && done 2>/dev/null done
+		grep --verbose then printf --verbose 2>/dev/null && $(pwd) $(pwd)
+readonly --verbose echo
+	export ${HOME} readonly then grep x=1 sed 'quoted text' done then then
+awk echo sed -eu 2>/dev/null -eu | done readonly export 'quoted text' done
+		${HOME} grep grep && --verbose
+		cd cd then printf readonly cd export readonly --verbose ${HOME} grep
+		local readonly local cd readonly
+"$1" echo then 2>/dev/null "$1" sed then local 'quoted text'
+		grep done "$1" cd x=1 readonly x=1 echo ${HOME}
+-eu readonly --verbose -eu export x=1 | "$1" awk test done 2>/dev/null
+	"$1" /usr/bin /usr/bin grep ${HOME} echo then x=1 2>/dev/null 2>/dev/null
+then local awk cd /usr/bin
+	x=1 ${HOME} export ${HOME} x=1 done ${HOME} export cd &&
+	'quoted text' --verbose "$@" readonly "$1" sed local -eu sed
+	"$@" grep local /usr/bin export
+	--verbose | sed printf echo "$@" sed export sed
+	x=1 sed $(pwd) done grep then $(pwd)
+grep awk cd done $(pwd) done
+| export -eu readonly && /usr/bin x=1 sed 'quoted text'
+	-eu | && --verbose ${HOME} then printf export cd "$@" test echo
+	export readonly echo "$1" cd cd x=1 ${HOME} awk done "$@" ${HOME} readonly
+	sed grep && | /usr/bin ${HOME} && ${HOME} local readonly awk test awk $(pwd) awk
+		done then /usr/bin done | readonly /usr/bin sed /usr/bin 'quoted text' /usr/bin
+${HOME} "$1" echo ${HOME} awk done sed then /usr/bin
+	"$@" --verbose x=1 cd -eu "$1" export cd x=1 | local readonly
+readonly done done 2>/dev/null local export 2>/dev/null /usr/bin local "$1"
+		sed && --verbose readonly -eu 'quoted text' /usr/bin 'quoted text' 'quoted text'
+		awk "$@" ${HOME} grep test sed awk "$1" local done readonly
+		"$1" -eu done /usr/bin then && && sed printf local then local "$@" "$@"
+${HOME} 'quoted text' ${HOME}
+	/usr/bin /usr/bin printf printf /usr/bin 'quoted text' sed grep
+		x=1 grep grep printf awk readonly -eu --verbose readonly
+	2>/dev/null printf echo 'quoted text' done printf cd then -eu readonly
+		test | 'quoted text' readonly echo local readonly then awk "$1"
+		readonly grep x=1 'quoted text' --verbose 2>/dev/null /usr/bin
+cd sed -eu then done x=1 cd x=1 -eu
+		test -eu then 'quoted text' cd 2>/dev/null &&
+	grep local printf --verbose && "$1" done $(pwd) | 'quoted text' "$1" "$@"
+	export awk readonly "$1" 2>/dev/null grep --verbose 'quoted text'
+	2>/dev/null $(pwd) x=1 ${HOME} 2>/dev/null
+		"$@" 'quoted text' sed 2>/dev/null then export 'quoted text' test && export
+		"$@" export $(pwd) done "$1" sed awk readonly then awk
+		then awk && awk "$@" "$@" && 2>/dev/null "$@" sed /usr/bin -eu
+	x=1 /usr/bin printf && x=1 cd | 2>/dev/null 'quoted text'
+	'quoted text' ${HOME} /usr/bin $(pwd) /usr/bin done cd done ${HOME} cd sed echo
+sed cd "$@" readonly then $(pwd) grep readonly
+then --verbose 'quoted text' cd
+	x=1 then --verbose $(pwd) sed export "$1" x=1 x=1 ${HOME}
+local && x=1 awk sed -eu local cd done
+&& sed export "$@" printf $(pwd) done
+	-eu awk $(pwd) test awk --verbose local --verbose awk 2>/dev/null
+		echo 'quoted text' -eu /usr/bin
+sed printf cd local then awk printf
+	$(pwd) --verbose grep -eu -eu -eu sed printf local /usr/bin readonly
+"$1" /usr/bin readonly
+$(pwd) && --verbose export 'quoted text'
+		export done | test "$@" | test x=1 test | "$@" then "$1"
+		"$1" 2>/dev/null done && x=1 readonly awk ${HOME} printf
+		test local readonly && --verbose cd grep local | printf ${HOME}
+	&& awk | 'quoted text' awk sed done ${HOME} awk export grep
+		"$@" /usr/bin "$@" 2>/dev/null /usr/bin ${HOME} export sed -eu echo cd &&
+x=1 | ${HOME} 'quoted text' sed "$1" "$1" sed local --verbose
+		/usr/bin "$@" printf x=1 done $(pwd) then "$@"
+		echo local test export 'quoted text' awk && awk $(pwd) cd
+	readonly ${HOME} printf x=1 && test local -eu grep 2>/dev/null
+	'quoted text' awk ${HOME} 2>/dev/null
+		grep then sed cd $(pwd) local test
+export sed grep "$@" grep --verbose 'quoted text'
+	${HOME} $(pwd) ${HOME} ${HOME} readonly export done
+		readonly 'quoted text' /usr/bin | test printf --verbose then printf
+		--verbose echo cd "$@" 'quoted text' local cd /usr/bin done x=1 printf && "$1"
+	then ${HOME} done && /usr/bin export echo x=1 2>/dev/null -eu
+	/usr/bin cd readonly then
+		then 2>/dev/null ${HOME} "$@" -eu /usr/bin
+	--verbose | /usr/bin local --verbose test printf
+		sed x=1 $(pwd) 2>/dev/null "$1" "$1" "$1" done x=1 /usr/bin
+		printf export test test test /usr/bin /usr/bin 'quoted text' printf "$1" /usr/bin
+	"$@" x=1 then ${HOME} awk
+		--verbose 'quoted text' test /usr/bin echo --verbose $(pwd) -eu 2>/dev/null
+	| /usr/bin test sed then $(pwd) done test cd 2>/dev/null -eu
+2>/dev/null local cd /usr/bin awk done ${HOME} ${HOME}
+		grep grep "$1" 2>/dev/null ${HOME} "$1" local
+		2>/dev/null x=1 printf && 2>/dev/null local | "$@" "$1" $(pwd) test
+x=1 --verbose readonly "$@" echo --verbose done
+		| -eu cd then $(pwd) test grep | readonly
+printf echo $(pwd) /usr/bin && 'quoted text' sed cd "$@" readonly
+		x=1 --verbose ${HOME} 'quoted text' then | readonly
+		then readonly "$1" export readonly test local "$@" |
+	2>/dev/null cd 2>/dev/null
+awk && test --verbose -eu test ${HOME} 'quoted text' cd ${HOME} then | -eu -eu 'quoted text'
+	printf --verbose local export x=1 sed awk $(pwd)
+	awk done 'quoted text' --verbose "$@" 2>/dev/null
+local "$1" -eu then local
+		--verbose 'quoted text' && 2>/dev/null local $(pwd) "$@" $(pwd) /usr/bin
+		${HOME} "$1" --verbose 2>/dev/null "$1" sed 2>/dev/null local ${HOME} && "$@"
+&& cd 2>/dev/null local /usr/bin grep && readonly done 2>/dev/null | &&
+--verbose /usr/bin ${HOME} export
+		"$@" grep echo | 'quoted text' then -eu |
+--verbose echo && ${HOME} "$@" done -eu /usr/bin
+		sed 2>/dev/null awk awk
+	--verbose x=1 local grep --verbose x=1 'quoted text' echo 2>/dev/null 2>/dev/null
+		local echo /usr/bin "$1" && | cd echo echo done local printf export ${HOME}
+		--verbose done 2>/dev/null test --verbose | "$1" export
+&& "$@" then printf ${HOME} 'quoted text' 'quoted text' local ${HOME} then
+	export --verbose echo && test then awk
+		echo | 2>/dev/null printf 'quoted text'
+		'quoted text' $(pwd) "$1" export cd printf cd 'quoted text' echo local "$@"
+printf done /usr/bin && x=1 test grep cd --verbose 'quoted text' test grep 'quoted text'
+		&& 'quoted text' test $(pwd) export -eu echo ${HOME} export sed x=1 sed
+readonly /usr/bin | printf done | "$1"
+	${HOME} --verbose 'quoted text' local 'quoted text' $(pwd) 'quoted text'
+sed --verbose "$@" $(pwd) export then && grep "$1" && sed grep 'quoted text' printf
+	export export 'quoted text' cd
+printf && local --verbose $(pwd) echo $(pwd) "$@" export "$@" x=1 &&
+		echo ${HOME} && echo -eu 'quoted text'
+		printf done ${HOME} "$@" x=1 sed printf
+		-eu | sed grep done awk echo x=1 x=1 --verbose
+echo local && -eu && sed then sed "$1" 2>/dev/null awk ${HOME} then test ${HOME}
+	"$1" printf awk grep 'quoted text' echo && export x=1 local export done
+		printf test readonly && 'quoted text' ${HOME}
+local "$1" awk printf /usr/bin done | sed printf
+&& 2>/dev/null sed readonly printf x=1 "$1" && sed cd sed
+| printf 'quoted text' -eu
+		readonly -eu local awk test x=1
+	readonly "$@" && readonly export grep && | 'quoted text' echo ${HOME} local
+grep 'quoted text' 2>/dev/null test export
+		&& done /usr/bin && | test ${HOME}
+	then done -eu && /usr/bin done local
+	done 2>/dev/null ${HOME} $(pwd) $(pwd) x=1 -eu 2>/dev/null "$@" $(pwd)
+	awk test local /usr/bin echo $(pwd)
+	printf readonly | local | --verbose
+	"$1" local $(pwd) x=1 grep $(pwd) export grep echo printf
+		-eu grep "$1" then x=1 readonly awk x=1 | "$@" sed 2>/dev/null -eu
+	export | done sed then ${HOME} 2>/dev/null sed sed echo
+		/usr/bin ${HOME} export awk test readonly /usr/bin && cd
+	grep done /usr/bin $(pwd) grep export grep /usr/bin ${HOME}
+&& test $(pwd) --verbose x=1 x=1 $(pwd) && test export
+$(pwd) grep echo && 2>/dev/null done
+then /usr/bin --verbose
+	export export && done printf
+readonly /usr/bin ${HOME} grep ${HOME} "$@" awk cd awk --verbose
+	2>/dev/null test 'quoted text' 2>/dev/null done ${HOME} awk "$@" | sed sed
+		${HOME} ${HOME} $(pwd) /usr/bin --verbose | export
+"$1" echo /usr/bin -eu test x=1 &&
+		| test "$@" | printf echo export local sed ${HOME} echo && "$@" | sed
+awk -eu printf "$1" | test | local -eu sed "$1" printf done "$1" cd 'quoted text'
+	/usr/bin printf readonly grep sed done export x=1 "$@" test export "$1"
+	local printf -eu test | --verbose 'quoted text' $(pwd) 2>/dev/null ${HOME}
+		cd "$1" then grep | ${HOME}
+		/usr/bin awk -eu x=1 awk --verbose
+	readonly --verbose /usr/bin -eu ${HOME} echo readonly
+		grep && $(pwd) then export echo $(pwd) "$1" ${HOME}
+test --verbose cd x=1 readonly awk sed && done printf test "$@" cd
+	&& export then | | export test $(pwd) --verbose awk 2>/dev/null
+		printf 'quoted text' test | 'quoted text' /usr/bin "$@" x=1 printf 'quoted text'
+		$(pwd) ${HOME} readonly cd x=1 $(pwd) awk --verbose
+${HOME} ${HOME} cd local
+	echo grep && "$1" cd "$1" -eu sed "$@" readonly 'quoted text'
+	test awk sed 'quoted text'
+		then && | awk 'quoted text' "$@" local local then echo awk -eu -eu cd ${HOME}
+	2>/dev/null then test && 2>/dev/null awk cd /usr/bin
+	&& ${HOME} "$1" x=1 "$@" sed "$@" --verbose
+&& /usr/bin then awk | export done $(pwd) | $(pwd) 'quoted text' then test
+/usr/bin $(pwd) "$@" x=1 awk grep printf grep 'quoted text' cd --verbose "$@" printf
+"$@" echo | 'quoted text' test "$1" -eu | | && sed done x=1 && 2>/dev/null
+2>/dev/null grep then export -eu /usr/bin x=1 sed "$1" ${HOME}
+	grep 2>/dev/null 'quoted text' ${HOME} $(pwd)
+	/usr/bin awk && "$1" then echo local x=1 sed
+export awk sed cd grep
+test -eu local $(pwd) awk cd test test /usr/bin
+| grep echo echo $(pwd) "$@" local done sed readonly -eu then awk done test $(pwd)
+	-eu $(pwd) awk sed x=1 -eu --verbose printf sed done 'quoted text' awk 'quoted text'
+'quoted text' echo --verbose "$@" | -eu test && export then 'quoted text'
+	&& x=1 echo echo echo local grep 'quoted text'
+	grep test --verbose grep && "$1" export -eu | $(pwd) 'quoted text' "$@" cd &&
+	local "$@" local "$1" "$1" -eu
+$(pwd) readonly local done readonly export
+	local "$1" export && /usr/bin
+$(pwd) x=1 ${HOME} 2>/dev/null
+| readonly 2>/dev/null | --verbose export printf
+	export /usr/bin export printf echo --verbose ${HOME} cd "$@" 'quoted text'
+		echo awk | done x=1 | grep "$1" /usr/bin -eu then $(pwd) export grep
+&& test --verbose 2>/dev/null $(pwd) then local
+"$@" -eu then test ${HOME} "$@" export awk ${HOME} echo local sed
+	'quoted text' 2>/dev/null $(pwd) | then --verbose && 2>/dev/null
+	'quoted text' ${HOME} awk && printf
+		sed readonly && && local "$1" local --verbose 2>/dev/null 'quoted text' $(pwd)
+&& $(pwd) echo "$1" sed printf awk test "$1" echo && readonly
+	x=1 then -eu awk "$@" test && readonly $(pwd) printf -eu local
+| ${HOME} | export ${HOME} $(pwd) cd readonly -eu printf
+awk echo 'quoted text' ${HOME} -eu 'quoted text' $(pwd) readonly
+	${HOME} | readonly ${HOME} printf
+&& -eu ${HOME} $(pwd) /usr/bin cd 2>/dev/null awk echo
+		printf local printf echo then awk grep echo ${HOME} awk 2>/dev/null
+| $(pwd) awk -eu 'quoted text' | local $(pwd) sed "$1" done x=1
+		${HOME} then x=1 | -eu "$@" done "$1" 'quoted text' "$@" sed test readonly
+		grep 2>/dev/null | | $(pwd)
+		done printf echo "$@" 'quoted text' test export export "$@" /usr/bin
+	echo 2>/dev/null ${HOME} -eu awk x=1 grep "$1" printf local -eu printf 'quoted text'
+		sed cd -eu readonly -eu export test "$@" --verbose test readonly
+		2>/dev/null | readonly cd 2>/dev/null x=1 readonly -eu /usr/bin then 'quoted text'
+		test export export sed --verbose
+		cd readonly echo test done
+x=1 -eu 2>/dev/null -eu x=1 export && readonly awk |
+--verbose printf "$@" test cd readonly grep done local cd awk "$@" "$1" readonly
+	$(pwd) local "$@" --verbose
+	printf printf sed done 2>/dev/null test awk $(pwd)
+$(pwd) 'quoted text' export
+	done -eu "$@" 'quoted text' local sed
+		grep local export x=1 2>/dev/null | /usr/bin
+		"$@" /usr/bin awk done $(pwd) done $(pwd) && &&
+		grep export done export export awk
+		x=1 ${HOME} | /usr/bin | printf then --verbose $(pwd) local grep cd /usr/bin
+2>/dev/null && --verbose printf x=1
+		grep | $(pwd) echo printf --verbose --verbose local $(pwd) --verbose
+x=1 /usr/bin readonly sed "$@" test "$@"
+$(pwd) test && echo printf 2>/dev/null sed -eu printf then echo printf x=1
+		grep x=1 --verbose local && ${HOME} 2>/dev/null readonly x=1
+	readonly export "$@" test "$@" x=1 sed &&
+	&& $(pwd) cd /usr/bin
+	printf x=1 "$1" local test sed 2>/dev/null $(pwd) test -eu sed printf
+		'quoted text' sed /usr/bin local local echo | export /usr/bin
+		-eu printf 'quoted text' export && $(pwd) $(pwd) | -eu x=1 local
+		${HOME} x=1 $(pwd) then done test /usr/bin sed
+printf echo "$1" awk -eu |
+	printf /usr/bin then local
+		test readonly readonly && sed grep printf printf sed -eu then --verbose
+--verbose export /usr/bin "$1" x=1 readonly printf cd && then done &&
+		'quoted text' $(pwd) readonly cd awk 'quoted text' && -eu export -eu
+		echo "$@" grep then ${HOME}
+	test /usr/bin then cd $(pwd) "$1" export x=1 && sed cd printf grep echo --verbose
+		done -eu $(pwd) 'quoted text' && /usr/bin --verbose export x=1 "$@" | echo grep
+		&& export "$@" ${HOME} $(pwd) "$1" test export then local then local
+${HOME} test --verbose cd test echo
+	-eu -eu local echo x=1 'quoted text' sed printf ${HOME} ${HOME} cd readonly
+	export /usr/bin "$1" | test done | ${HOME} sed printf done "$1" export ${HOME}
+		local printf x=1 export 'quoted text' then
+	"$1" test /usr/bin printf x=1 done
+	&& "$@" local grep 2>/dev/null ${HOME} export echo --verbose
+		local cd --verbose export test "$@" then 2>/dev/null $(pwd) /usr/bin && "$@" readonly
+sed cd 'quoted text' 2>/dev/null cd grep ${HOME} readonly $(pwd) local
+	-eu test 'quoted text' /usr/bin
+printf then export export --verbose $(pwd) readonly export "$1" /usr/bin test
+		$(pwd) && -eu echo --verbose then x=1 export | printf sed then "$1"
+		done && && "$1" export readonly export local x=1 then
+	x=1 printf "$@" export "$@" ${HOME} | test done awk "$1" test $(pwd)
+		-eu | --verbose grep --verbose
+	-eu echo done then 'quoted text' local then readonly ${HOME}
+		$(pwd) readonly /usr/bin awk ${HOME} | | cd grep
+export /usr/bin done 2>/dev/null printf echo cd ${HOME} cd awk awk $(pwd) "$1"
+"$@" test 'quoted text' "$@" $(pwd) | printf done ${HOME} printf
+		'quoted text' readonly sed "$1" then local 2>/dev/null
+export --verbose grep test --verbose
+x=1 2>/dev/null test sed 'quoted text'
+	local "$@" done local "$@" | 2>/dev/null ${HOME} test
+		'quoted text' /usr/bin "$@" printf then 2>/dev/null then printf -eu && awk echo
+		grep then $(pwd) done /usr/bin
+	--verbose cd grep cd --verbose 'quoted text' /usr/bin done 2>/dev/null grep
+	cd ${HOME} awk grep $(pwd)
+	2>/dev/null -eu 2>/dev/null /usr/bin
+2>/dev/null export export 2>/dev/null awk
+	| export awk "$1" ${HOME} readonly /usr/bin $(pwd) export
+		printf /usr/bin "$@" done awk then /usr/bin export
+		then | 'quoted text' echo sed done $(pwd) awk 2>/dev/null &&
+		sed readonly ${HOME} local && 2>/dev/null awk 2>/dev/null x=1 "$@" x=1 "$1" x=1
+/usr/bin sed done x=1 2>/dev/null readonly && cd && cd local printf echo "$1"
+x=1 echo "$@" -eu then | test /usr/bin then "$@" grep --verbose readonly
+		export done local 2>/dev/null "$1" awk printf done export
+	readonly -eu --verbose 'quoted text' ${HOME} awk done done printf
+x=1 done done && $(pwd) | readonly "$@" readonly "$@" /usr/bin
+&& test export --verbose cd /usr/bin && && awk "$1" export readonly export
+		| done test "$@" && 'quoted text'
+	sed grep 'quoted text' grep 'quoted text' ${HOME} | "$1" "$@" echo --verbose grep
+	--verbose readonly cd "$1" "$1" | |
+cd 2>/dev/null x=1 ${HOME}
+	/usr/bin grep | awk sed readonly echo /usr/bin
+	"$1" readonly /usr/bin sed "$@" | $(pwd) && 2>/dev/null local done done
+printf $(pwd) ${HOME} ${HOME} $(pwd) readonly export "$1" printf | then 2>/dev/null
+		sed /usr/bin ${HOME} | | printf awk done
+	| x=1 awk x=1 test "$@" echo /usr/bin sed test sed local
+		2>/dev/null | -eu x=1 | && export readonly 'quoted text' ${HOME} "$@" then local
+| readonly grep export 'quoted text' --verbose
+	test /usr/bin echo "$@"
+	readonly done export sed x=1 cd readonly "$@" -eu x=1 ${HOME}
+awk /usr/bin sed "$@" /usr/bin "$1" cd -eu ${HOME}
+		${HOME} | "$@" | then grep cd
+readonly $(pwd) 'quoted text' -eu "$1" cd grep 2>/dev/null cd local ${HOME}
+		x=1 awk printf "$1" test readonly readonly 2>/dev/null
+		x=1 printf $(pwd) 2>/dev/null ${HOME} cd ${HOME}
+		'quoted text' sed "$1" test export export x=1 'quoted text' "$1" printf grep
+	then -eu local cd grep printf local done
+	export x=1 "$1" export grep readonly test ${HOME} 2>/dev/null readonly "$1" x=1
+		-eu ${HOME} test test -eu | local | cd printf cd 'quoted text' 2>/dev/null
+then 2>/dev/null grep ${HOME} sed $(pwd)
+	sed | /usr/bin test local done
+2>/dev/null local 2>/dev/null x=1 --verbose | cd
+	| $(pwd) ${HOME} echo --verbose export echo grep "$@" printf
+&& sed | "$1" cd cd && printf done /usr/bin ${HOME} ${HOME} local $(pwd)
+	cd local | echo done sed ${HOME} -eu 'quoted text' --verbose --verbose
+		&& export awk "$1" export cd ${HOME} echo /usr/bin awk -eu test | "$1" 'quoted text'
+		printf done | $(pwd) test "$1" -eu ${HOME} $(pwd) ${HOME} echo
+	-eu && 2>/dev/null echo readonly export ${HOME} "$1" ${HOME} echo
+		export awk && readonly 2>/dev/null readonly "$1" x=1 | printf export
+	"$@" x=1 test printf export "$@" "$@" -eu ${HOME} 'quoted text'
+	${HOME} readonly /usr/bin test then 2>/dev/null
+x=1 | awk sed -eu grep export done awk "$@" $(pwd) ${HOME} x=1 sed awk $(pwd) then
+		${HOME} export 'quoted text'
+	'quoted text' 2>/dev/null sed cd "$@" done -eu "$@" /usr/bin "$@" export
+	/usr/bin x=1 readonly ${HOME} done /usr/bin test then done echo sed sed "$@" test
+$(pwd) echo test grep /usr/bin
+		awk 2>/dev/null $(pwd) x=1 echo "$1" &&
+sed sed readonly printf ${HOME}
+2>/dev/null 2>/dev/null printf cd
+then && 2>/dev/null /usr/bin awk then
+		test --verbose readonly printf --verbose then then "$@" echo ${HOME}
+${HOME} sed && printf /usr/bin then | export
+/usr/bin "$@" printf local 2>/dev/null
+		cd export ${HOME} local x=1 test /usr/bin $(pwd) sed -eu 2>/dev/null
+$(pwd) 2>/dev/null -eu test
+		"$@" local awk --verbose grep sed echo -eu test
+	$(pwd) "$1" "$@" echo 'quoted text' awk --verbose "$@" "$@" sed "$@" printf
+		local export awk local $(pwd) export /usr/bin
+		then readonly x=1 printf "$@" grep local && readonly echo export
+done done 'quoted text' local "$@" -eu export test test $(pwd)
+"$@" 'quoted text' printf /usr/bin
+	export then echo readonly $(pwd) awk test ${HOME} done
+2>/dev/null 2>/dev/null echo $(pwd) local
+	sed "$1" cd "$1" 'quoted text' 'quoted text' "$@" awk ${HOME}
+		/usr/bin ${HOME} readonly -eu "$1" /usr/bin --verbose "$@"
+		/usr/bin && x=1 then then x=1 "$@" ${HOME} $(pwd) -eu x=1
+	&& | 2>/dev/null then awk printf cd 2>/dev/null 2>/dev/null | readonly
+	echo "$1" printf ${HOME} then x=1 /usr/bin "$1" grep "$1" 'quoted text' x=1 2>/dev/null
+	done then printf awk echo
+readonly grep export "$1" awk | readonly cd --verbose
+	awk printf export && printf 'quoted text' sed export awk | "$1" then "$1" $(pwd)
+		"$@" readonly sed -eu ${HOME} && /usr/bin | readonly test 'quoted text' 'quoted text'
+done awk 'quoted text' sed --verbose ${HOME} awk printf -eu cd "$@" ${HOME}
+	"$1" --verbose test --verbose echo echo "$1" 2>/dev/null
+		| then /usr/bin && /usr/bin local awk grep
+		done -eu --verbose echo "$@"
+	test local readonly x=1
+		grep /usr/bin 2>/dev/null test test "$1" -eu readonly 'quoted text'
+${HOME} cd sed echo && cd then "$1" export local 'quoted text'
+	printf done -eu ${HOME} "$@" 2>/dev/null sed local -eu /usr/bin
+		echo -eu local echo grep && "$@" then 2>/dev/null printf -eu
+		done 2>/dev/null --verbose && 2>/dev/null local
+	then readonly echo printf cd echo -eu "$1" -eu "$1" printf $(pwd) 2>/dev/null
+then --verbose cd awk && done -eu && && printf readonly x=1 grep awk x=1
+		| then then $(pwd) test 'quoted text'
+	"$1" -eu 2>/dev/null x=1 && then echo $(pwd) $(pwd) printf -eu ${HOME}
+		"$@" /usr/bin export printf ${HOME} "$1" grep readonly awk echo | --verbose
+		/usr/bin --verbose test export -eu cd cd readonly local $(pwd) 2>/dev/null
+readonly "$@" -eu x=1 "$1" ${HOME} echo
+export && 2>/dev/null "$1"
+		$(pwd) echo /usr/bin printf readonly ${HOME} test "$@" grep | cd
+	${HOME} "$@" $(pwd) then
+		2>/dev/null export local -eu export sed $(pwd) export | grep "$@" echo
+		-eu export echo x=1 x=1 echo grep printf
+	test 2>/dev/null printf "$1" 2>/dev/null grep
+| sed -eu /usr/bin "$@" local local
+	2>/dev/null --verbose sed "$1" echo awk readonly sed $(pwd) -eu
+| -eu | /usr/bin "$1" echo awk
+	-eu awk x=1 "$1" /usr/bin
+	-eu then printf grep readonly
+printf "$@" && --verbose readonly test -eu readonly 2>/dev/null cd then then -eu
+then cd ${HOME} $(pwd) | readonly
+		| export --verbose ${HOME} test printf /usr/bin "$@"
+	export | && sed local done 2>/dev/null echo done printf -eu | then /usr/bin
+		| grep export echo "$1" --verbose | sed 'quoted text'
+		| $(pwd) grep -eu -eu x=1 --verbose 'quoted text' && $(pwd) awk grep | done
+		cd x=1 $(pwd) --verbose 2>/dev/null readonly /usr/bin
+	printf grep x=1 "$@" readonly printf echo done then | ${HOME} grep --verbose $(pwd)
+export sed /usr/bin --verbose $(pwd) $(pwd) export cd test
+done 2>/dev/null readonly x=1 -eu awk $(pwd)
+cd done $(pwd) sed sed 'quoted text' 'quoted text' && "$1" then export
+		'quoted text' readonly awk cd grep export x=1 printf local $(pwd)
+		readonly sed && "$1" grep && "$@" 2>/dev/null cd /usr/bin grep local && done sed
+$(pwd) && | ${HOME} awk echo --verbose -eu && grep "$1" x=1 printf test export
+		cd | "$@" cd readonly test cd done && done readonly echo readonly
+done awk 2>/dev/null ${HOME} 2>/dev/null ${HOME} echo grep
+	done local 'quoted text' test /usr/bin $(pwd)
+		/usr/bin done printf sed local echo
+'quoted text' done | readonly -eu
+-eu local then -eu export awk x=1 echo --verbose test
+		'quoted text' "$@" | done
+	x=1 /usr/bin grep 2>/dev/null sed printf sed readonly echo "$1" --verbose
+		export -eu ${HOME} --verbose
+	x=1 'quoted text' sed 'quoted text' then ${HOME} test ${HOME}
+		$(pwd) -eu echo done readonly local 'quoted text' awk
+sed --verbose grep cd $(pwd) | cd test done cd | sed awk export then then $(pwd)
+&& 'quoted text' cd /usr/bin x=1 x=1 -eu --verbose $(pwd) local | x=1 local
+/usr/bin awk grep echo test awk
+x=1 printf 'quoted text' 2>/dev/null
+		&& done awk test | $(pwd) done | sed sed | 2>/dev/null local local printf
+then x=1 awk then printf sed readonly --verbose
+	"$1" export then cd x=1 --verbose then cd export $(pwd) local echo done $(pwd)
+--verbose echo local -eu
+'quoted text' cd $(pwd) 2>/dev/null local awk ${HOME} then echo -eu "$1"
+	test then && echo printf test --verbose test sed printf
+		readonly | -eu $(pwd) echo
+		"$@" | cd test local local -eu
+		awk "$1" $(pwd) $(pwd) | then then 2>/dev/null "$1"
+		-eu local export $(pwd) 'quoted text' readonly done
+		"$@" x=1 export grep ${HOME} printf | cd --verbose
+| 2>/dev/null cd /usr/bin then 'quoted text'
+-eu 'quoted text' "$1" ${HOME}
+		"$@" readonly cd "$@"
+		x=1 grep test /usr/bin --verbose $(pwd)
+local export "$@" ${HOME} export test "$1" --verbose
+		echo local then x=1 ${HOME} echo && done echo printf -eu sed printf
+2>/dev/null ${HOME} --verbose ${HOME}
+grep 'quoted text' awk readonly && printf x=1 then /usr/bin awk
+	/usr/bin 'quoted text' grep sed /usr/bin "$1" 'quoted text'
+	'quoted text' 2>/dev/null awk sed awk 'quoted text'
+		readonly | /usr/bin local "$1" readonly awk "$@" test
+printf local -eu && x=1 awk done awk printf
+		&& --verbose 'quoted text' sed export
+	"$@" local "$1" $(pwd) grep printf echo done grep 2>/dev/null
+		printf x=1 /usr/bin /usr/bin then then -eu
+		then export x=1 awk 2>/dev/null local "$@" && /usr/bin ${HOME}
+&& grep --verbose && cd /usr/bin x=1 echo
+		done && printf $(pwd) 2>/dev/null done cd grep grep 2>/dev/null
+sed | && 'quoted text' 'quoted text' printf grep echo "$1" printf x=1 && -eu
+		done cd "$1" done x=1 printf local cd cd done grep | -eu cd ${HOME} awk
+echo then done done done "$1" "$1" --verbose && sed readonly
+		echo | cd && test | test done "$1" 2>/dev/null && ${HOME} done | printf echo ${HOME}
+		x=1 cd && "$1" test local "$@" "$@"
+/usr/bin awk printf awk "$1" "$@" 2>/dev/null then then grep done sed sed "$1"
+		printf $(pwd) readonly echo
+awk $(pwd) /usr/bin test readonly done cd && local -eu printf readonly
+readonly echo /usr/bin grep "$1" "$1" printf export cd && | && then
+cd grep cd $(pwd) echo echo test awk "$@" ${HOME} x=1 then /usr/bin sed cd "$1"
+grep && awk "$1" printf echo grep printf $(pwd) cd cd printf ${HOME} cd -eu
+		"$1" 'quoted text' then readonly
+	${HOME} awk sed cd 'quoted text' --verbose "$1" ${HOME} 2>/dev/null test export
+${HOME} printf echo | $(pwd)
+	export /usr/bin "$1" test
+| grep export sed done -eu export local
+		cd x=1 --verbose "$@" export "$@" grep cd
+awk && test echo sed grep "$1" 'quoted text' $(pwd) done then /usr/bin
+	2>/dev/null export 2>/dev/null && $(pwd) test
+	${HOME} cd then "$1" echo readonly 2>/dev/null x=1 && then | ${HOME} done -eu echo
+		/usr/bin -eu readonly 'quoted text' 'quoted text' && --verbose
+		sed ${HOME} $(pwd) sed 'quoted text'
+	echo export grep then then printf ${HOME} ${HOME} export done
+	&& ${HOME} then -eu done local
+	test local 'quoted text' sed test --verbose x=1
+	-eu local x=1 echo --verbose done ${HOME} ${HOME}
+-eu printf test && $(pwd) export $(pwd) cd then $(pwd) then 'quoted text'
+echo awk /usr/bin 2>/dev/null local grep
+"$1" export --verbose then && --verbose
+2>/dev/null --verbose "$1" $(pwd) grep test $(pwd) then
+done x=1 local export test export ${HOME} echo /usr/bin
+		sed done && "$1" "$1" done readonly
+$(pwd) -eu x=1 sed "$1" export readonly readonly "$@" cd | && 2>/dev/null
+echo 'quoted text' export $(pwd) awk readonly -eu 'quoted text' $(pwd) -eu 'quoted text'
+	2>/dev/null "$1" echo printf "$1" /usr/bin grep "$@" export && local
+then sed x=1 'quoted text' ${HOME} readonly export | x=1 readonly --verbose
+	export && && 'quoted text' 2>/dev/null
+		cd $(pwd) done awk -eu ${HOME} 'quoted text' printf
+$(pwd) test awk --verbose
+"$@" done ${HOME} "$1" &&
+		echo readonly done -eu local -eu | ${HOME} 2>/dev/null --verbose
+echo --verbose x=1 readonly sed && $(pwd) awk readonly && $(pwd)
+		'quoted text' grep 'quoted text' grep x=1 test export grep | 'quoted text'
+grep echo printf ${HOME} "$@" then export then then -eu
+	'quoted text' | 'quoted text' then 'quoted text'
+	-eu then | sed --verbose
+		2>/dev/null done then export
+		readonly 2>/dev/null local test sed $(pwd) then
+--verbose sed ${HOME} --verbose sed --verbose printf -eu "$1" 2>/dev/null "$1" export
+	${HOME} "$@" export printf "$@" 2>/dev/null x=1 2>/dev/null
+export 2>/dev/null test done "$@" cd readonly 2>/dev/null local "$1" local | local
+then "$@" export test "$1" --verbose --verbose /usr/bin ${HOME} x=1 'quoted text'
+2>/dev/null export --verbose
+"$1" awk done awk /usr/bin
+	cd grep local 'quoted text' cd 'quoted text'
+&& test 'quoted text' printf test "$@" x=1 x=1 /usr/bin
+		'quoted text' "$@" printf 'quoted text' | done --verbose
+	then x=1 $(pwd) && --verbose "$1" ${HOME}
+	grep sed printf $(pwd)
+		-eu 2>/dev/null --verbose test --verbose 2>/dev/null "$@" sed done "$@" /usr/bin
+2>/dev/null readonly --verbose --verbose --verbose 'quoted text' cd $(pwd)
+	-eu ${HOME} "$@" printf $(pwd) sed printf "$@" echo then readonly
+	"$@" "$@" ${HOME} grep $(pwd)
+${HOME} -eu && grep done --verbose sed $(pwd) | sed && 2>/dev/null local awk
+	| -eu cd awk test awk echo -eu local readonly grep awk
+		${HOME} /usr/bin ${HOME} echo then x=1 ${HOME} 2>/dev/null export "$@"
+		x=1 done 'quoted text' grep "$1" readonly
+	grep x=1 -eu printf && readonly then && 'quoted text' sed then && awk test 2>/dev/null
+		then printf test export
+&& then export grep $(pwd) echo "$@" -eu test $(pwd) done
+		--verbose "$1" 'quoted text' local $(pwd)
+		&& local awk local grep --verbose done awk local echo
+		${HOME} grep "$@" cd then x=1 then local local /usr/bin cd /usr/bin export
+		$(pwd) then readonly -eu 2>/dev/null test | | /usr/bin
+/usr/bin sed echo cd awk x=1 --verbose
+	then export local readonly done $(pwd) grep -eu $(pwd) grep "$1" 2>/dev/null
+		| printf printf ${HOME} export ${HOME} && -eu export export 'quoted text'
+		test -eu --verbose --verbose echo then x=1 -eu test cd readonly
+		printf 2>/dev/null -eu done $(pwd) | | ${HOME} sed done x=1 | -eu awk test ${HOME}
+		readonly ${HOME} done local && | grep readonly
+	then readonly export x=1 'quoted text' sed grep $(pwd) 'quoted text'
+		2>/dev/null echo echo export cd --verbose export awk x=1 "$@" x=1 |
+awk x=1 sed readonly then "$1" /usr/bin echo
+	then test --verbose --verbose x=1 awk readonly
+export export grep && then local test
+		/usr/bin grep grep /usr/bin ${HOME} ${HOME} test
+	sed 2>/dev/null && awk done /usr/bin local 2>/dev/null sed --verbose | | && x=1
+	then echo -eu $(pwd) -eu ${HOME} awk 'quoted text' local "$1" done awk
+-eu test sed cd echo export "$@"
+-eu then sed sed echo printf
+		sed awk echo /usr/bin printf 'quoted text' $(pwd) $(pwd) | && readonly
+		| awk sed -eu "$@" 2>/dev/null grep ${HOME} readonly $(pwd) awk /usr/bin
+	&& ${HOME} awk grep grep readonly --verbose
+		awk grep awk sed 'quoted text' local ${HOME} 2>/dev/null done printf awk awk
+grep "$1" "$@" 2>/dev/null | sed sed $(pwd) test then echo done --verbose grep
+		&& export echo && printf cd ${HOME} cd echo export x=1 done
+test echo awk export /usr/bin sed done cd local sed x=1 2>/dev/null $(pwd)
+		"$@" readonly /usr/bin done x=1 grep readonly then echo
+		readonly && 'quoted text' ${HOME} ${HOME} local
+	"$1" then | 'quoted text' grep echo 2>/dev/null
+printf && ${HOME} /usr/bin | sed done $(pwd) |
+		"$1" echo awk && $(pwd) grep 'quoted text' --verbose
+	echo | sed readonly x=1 test
+	$(pwd) then 2>/dev/null test "$@" ${HOME} /usr/bin echo 2>/dev/null
+	readonly -eu cd printf export export
+	| printf then export "$@" done sed sed sed printf
+	${HOME} local ${HOME} "$1" && "$1" /usr/bin 'quoted text' x=1 echo && export x=1
+	$(pwd) --verbose readonly x=1 awk cd "$1" -eu awk --verbose printf $(pwd)
+	grep "$1" "$1" sed awk -eu && export
+		done awk $(pwd) cd /usr/bin sed echo grep "$1" export 2>/dev/null
+&& export then --verbose ${HOME}
+		test awk /usr/bin cd local --verbose
+		/usr/bin "$1" echo echo export "$@" cd ${HOME} ${HOME} x=1 test sed && && --verbose
+	echo test export grep export &&
+	local 2>/dev/null awk ${HOME} "$@" ${HOME} test readonly local -eu ${HOME}
+		test printf "$1" | $(pwd) $(pwd) cd echo "$@" readonly test -eu echo -eu
+	-eu ${HOME} 2>/dev/null x=1
+	then printf sed --verbose && printf local | && ${HOME}
+		2>/dev/null "$@" /usr/bin "$1" then done | cd export /usr/bin
+		grep awk echo done awk 2>/dev/null 'quoted text' && 'quoted text'
+"$1" then --verbose done
+	printf echo ${HOME} readonly echo $(pwd) then 2>/dev/null done cd && | readonly
+export export x=1 test cd | 2>/dev/null
+	"$@" --verbose grep /usr/bin 'quoted text' 2>/dev/null sed local printf
+awk local --verbose sed --verbose | echo ${HOME}
+x=1 grep "$@" export done $(pwd) 2>/dev/null ${HOME} test "$1" /usr/bin echo
+	awk x=1 && echo 'quoted text' | /usr/bin 'quoted text'
+	local | -eu printf $(pwd) 2>/dev/null echo test /usr/bin
+		readonly local x=1 printf "$1" 2>/dev/null
+		x=1 awk "$@" printf && ${HOME} cd x=1 echo grep
+sed 2>/dev/null export 2>/dev/null test grep printf /usr/bin
+	echo ${HOME} then && export ${HOME} "$1" export x=1 awk 'quoted text'
+	test awk cd ${HOME} local export $(pwd) export -eu --verbose -eu 'quoted text'
+		grep local done 2>/dev/null cd ${HOME}
+	'quoted text' -eu awk done x=1 printf && /usr/bin local
+		/usr/bin printf awk x=1 | ${HOME} readonly 2>/dev/null
+cd grep cd then export grep /usr/bin x=1 local test test
+		local | 'quoted text' echo readonly
+echo "$1" test "$1" cd printf printf cd grep
+	-eu 'quoted text' readonly
+	export /usr/bin $(pwd) grep test && -eu export 'quoted text'
+x=1 awk /usr/bin printf 'quoted text' local -eu export export && export
+	| -eu /usr/bin readonly grep
+	readonly --verbose sed done x=1 /usr/bin
+	awk /usr/bin 'quoted text' export 'quoted text' done export $(pwd) /usr/bin
+	echo then printf 2>/dev/null
+	then sed 2>/dev/null x=1 readonly $(pwd)
+	2>/dev/null | done printf sed && cd /usr/bin
+${HOME} /usr/bin $(pwd) $(pwd) --verbose --verbose
+		sed test done $(pwd) | -eu local "$1" awk echo awk printf cd 'quoted text'
+test "$1" cd 2>/dev/null readonly $(pwd) ${HOME} test /usr/bin echo cd printf
+		cd export printf readonly
+"$@" test cd readonly 2>/dev/null /usr/bin "$@"
+	then /usr/bin done cd test test printf 2>/dev/null test "$1"
+		done 'quoted text' echo echo -eu
+		awk 'quoted text' 2>/dev/null awk
+	"$1" /usr/bin ${HOME} done awk printf && && /usr/bin "$@" test printf
+	local 2>/dev/null "$1"
+awk --verbose local $(pwd) $(pwd) "$@" test 'quoted text'
+	readonly test "$1" 2>/dev/null then 'quoted text' awk && && x=1 'quoted text'
+		$(pwd) awk /usr/bin ${HOME} 2>/dev/null
+	| export /usr/bin printf --verbose /usr/bin | x=1 && x=1 cd ${HOME}
+	cd --verbose && -eu cd x=1 grep --verbose
+		cd export printf done | | then && 2>/dev/null 2>/dev/null
+	echo -eu cd $(pwd) --verbose -eu --verbose 2>/dev/null
+--verbose grep printf 'quoted text' echo && /usr/bin
+		cd test grep x=1 done | cd "$@" | -eu 'quoted text'
+	done awk local && export test ${HOME} echo export printf --verbose
+		sed | readonly test && 2>/dev/null test local
+	'quoted text' awk sed $(pwd) then "$@" awk local grep
+	printf $(pwd) sed && then local local local -eu sed
+'quoted text' grep --verbose ${HOME} local --verbose
+		export /usr/bin export $(pwd) done sed export grep echo sed done grep
+	printf local cd then --verbose
+		-eu -eu "$@" /usr/bin then --verbose done export 'quoted text'
+		"$1" cd echo cd | --verbose x=1 then
+echo echo grep && cd ${HOME} local 2>/dev/null ${HOME} then
+sed echo 2>/dev/null test sed test done then "$1" local
+${HOME} -eu /usr/bin done $(pwd) awk
+		"$@" --verbose awk local $(pwd) --verbose
+	awk done test 'quoted text' -eu "$@" -eu
+	grep ${HOME} printf readonly grep
+sed "$1" && /usr/bin && cd --verbose cd readonly cd printf grep sed
+| printf ${HOME} readonly $(pwd) -eu "$1" --verbose readonly | test
+	test && local awk local /usr/bin test readonly -eu local then "$1" 'quoted text'
+	echo ${HOME} local /usr/bin 'quoted text' | --verbose grep
+		${HOME} --verbose sed grep readonly |
+		test /usr/bin -eu test $(pwd) then && "$1" done sed -eu echo export $(pwd) done
+then && printf export 2>/dev/null
+	then $(pwd) echo then local echo | readonly /usr/bin awk done
+		| then grep done cd "$@" --verbose
+		done -eu then then done test 2>/dev/null -eu && 'quoted text' $(pwd)
+	echo && done "$@" awk awk 'quoted text' /usr/bin -eu printf $(pwd)
+		then sed export then test local test cd -eu readonly ${HOME}
+		-eu --verbose -eu "$@"
+cd test 'quoted text' done export "$1" x=1 test sed && readonly sed cd "$@"
+echo grep grep cd | 'quoted text' cd "$1" cd x=1 | x=1 2>/dev/null
+${HOME} "$1" readonly | export local local
+x=1 'quoted text' done local cd printf $(pwd)
+		/usr/bin echo test "$@" readonly local && ${HOME}
+		done 2>/dev/null x=1 awk | echo /usr/bin
+		"$1" --verbose done ${HOME} test test ${HOME} --verbose "$@" | ${HOME} grep
+	then grep -eu local && readonly "$1" && echo then "$1" readonly
+'quoted text' "$@" -eu && "$@" readonly "$1" "$@" printf export readonly -eu echo
+grep done 'quoted text' sed sed sed awk 'quoted text' && -eu done 'quoted text'
+		readonly export export && done grep ${HOME} 'quoted text'
+		&& grep readonly sed cd sed grep test printf test x=1 2>/dev/null
+	done "$@" -eu local /usr/bin "$@" awk /usr/bin $(pwd) test "$@" $(pwd)
+test /usr/bin 2>/dev/null sed --verbose done echo awk | export x=1 cd grep
+	/usr/bin ${HOME} readonly "$@" x=1 cd test
+	sed "$1" done $(pwd) /usr/bin
+&& grep awk -eu sed 'quoted text' then $(pwd) readonly 2>/dev/null
+	export readonly awk local
+x=1 cd ${HOME} -eu 2>/dev/null sed $(pwd) && /usr/bin awk test /usr/bin
+		sed x=1 && -eu "$@" && printf "$1" echo | "$@" export local
+	done cd $(pwd) sed 2>/dev/null awk 'quoted text' "$1" test local && readonly
+		/usr/bin grep printf -eu 'quoted text' readonly
+		2>/dev/null readonly | sed sed --verbose x=1 readonly printf
+	&& && "$1" sed 'quoted text' | grep "$@" x=1 "$@" --verbose --verbose
+	test | then grep grep 2>/dev/null $(pwd) awk printf
+	2>/dev/null && sed readonly ${HOME} "$1" readonly 2>/dev/null && -eu 2>/dev/null
+		grep test echo readonly awk readonly done 'quoted text' test printf
+	done -eu 2>/dev/null x=1 /usr/bin awk done done $(pwd) readonly
+	2>/dev/null && 'quoted text' echo printf "$@"
+		2>/dev/null $(pwd) cd grep readonly
+		readonly 'quoted text' echo $(pwd) export --verbose then -eu 'quoted text'
+		-eu 'quoted text' | test cd && export cd done
+	"$@" test && test done printf awk
+	&& export 'quoted text' x=1 cd | grep && "$1" readonly
+	--verbose $(pwd) ${HOME} sed printf test cd | "$1" printf --verbose grep
+		awk 2>/dev/null $(pwd) "$1"
+		| echo && export x=1 awk then "$@" grep then 'quoted text' /usr/bin
+	-eu x=1 grep echo | printf then local --verbose /usr/bin /usr/bin x=1
+grep 2>/dev/null printf test then ${HOME} readonly && && readonly
+echo /usr/bin x=1 ${HOME} export export x=1 /usr/bin echo grep then readonly
+		x=1 "$@" "$1" && 'quoted text'
+		${HOME} echo printf && --verbose
+--verbose -eu ${HOME} grep local -eu echo then export x=1 cd then | "$@"
+		--verbose awk sed grep x=1
+		local $(pwd) --verbose echo --verbose "$@" ${HOME} readonly
+	done -eu $(pwd) "$1" "$1" "$1" 'quoted text' printf export then
+/usr/bin cd echo test 'quoted text'
+"$1" --verbose "$1" readonly
+		done echo local readonly test -eu | local
+"$@" awk awk "$@" readonly printf 'quoted text' "$1" 'quoted text'
+grep done 2>/dev/null grep | sed -eu then export
+sed local 2>/dev/null $(pwd) local && $(pwd) printf x=1
+		local | -eu then done && local
+		--verbose ${HOME} 'quoted text' /usr/bin done cd "$@" /usr/bin echo x=1 done
+		&& sed ${HOME} | && -eu cd sed awk readonly && | local done | && local | done x=1
+${HOME} "$1" test x=1 && ${HOME} grep readonly awk 'quoted text' test --verbose
+	2>/dev/null grep | sed test grep && && /usr/bin done printf export
+--verbose /usr/bin ${HOME} done awk 2>/dev/null 2>/dev/null x=1 awk echo
+	echo && readonly ${HOME} "$1" readonly
+		done awk cd /usr/bin "$1" x=1 local x=1 ${HOME} grep | 2>/dev/null done "$@" local
+	2>/dev/null -eu /usr/bin -eu "$1" cd /usr/bin export && 'quoted text'
+		sed x=1 --verbose grep ${HOME} ${HOME} echo $(pwd) test "$@"
+done $(pwd) cd sed && ${HOME} /usr/bin then then readonly export export
+then local grep then $(pwd) cd local && readonly 'quoted text' export
+done && 'quoted text' $(pwd) /usr/bin && test -eu 2>/dev/null readonly export
+		then sed local done x=1 printf sed "$1"
+		2>/dev/null 'quoted text' grep test
+	"$1" then "$1" x=1 cd printf readonly "$@" cd awk
+"$1" 2>/dev/null x=1 then x=1 awk then local 2>/dev/null ${HOME} | | x=1 "$@" /usr/bin
+		readonly test 'quoted text' printf echo /usr/bin test "$@" --verbose then &&
+		/usr/bin && $(pwd) then sed | then printf test
+		--verbose then printf test cd ${HOME} ${HOME} ${HOME} -eu echo
+		local --verbose readonly | done grep grep x=1 -eu -eu grep done export local
+then ${HOME} printf sed grep && then local readonly $(pwd) -eu 'quoted text'
+| echo done echo "$@" readonly
+		x=1 printf grep "$@" 2>/dev/null "$@" x=1 --verbose
+	$(pwd) 2>/dev/null /usr/bin x=1
+		awk grep done ${HOME} --verbose echo |
+	| ${HOME} then done --verbose --verbose export done | readonly --verbose $(pwd)
+	echo "$1" then -eu && ${HOME} $(pwd) 2>/dev/null
+	printf $(pwd) --verbose done $(pwd) readonly test awk 2>/dev/null
+"$@" "$@" echo 'quoted text' then | -eu local awk 2>/dev/null
+		grep then readonly 'quoted text' 2>/dev/null 2>/dev/null
+		then ${HOME} then sed -eu then 'quoted text' 'quoted text' x=1
+-eu done | done test awk && 'quoted text' 2>/dev/null && export 2>/dev/null
+2>/dev/null | | 'quoted text' 'quoted text' sed -eu
+		test sed "$1" export sed local x=1 ${HOME} -eu | then sed sed sed x=1 2>/dev/null
+		echo 2>/dev/null "$1" 2>/dev/null
+&& "$@" 'quoted text' done
+$(pwd) then "$1" $(pwd) 'quoted text' $(pwd)
+	echo $(pwd) $(pwd) then -eu && cd
+$(pwd) test then echo "$1" then && awk "$@" sed readonly then
+	local readonly awk printf
+	2>/dev/null x=1 /usr/bin /usr/bin awk then export --verbose sed readonly
+		| -eu export x=1 x=1 && | printf printf
+'quoted text' cd cd sed
+		| x=1 sed readonly ${HOME} && done
+	cd readonly awk echo test test cd && then readonly 'quoted text'
+	"$1" -eu done "$1" export $(pwd) --verbose awk grep | x=1
+	readonly x=1 export awk "$1" printf $(pwd) awk printf $(pwd) local then
+	${HOME} 'quoted text' /usr/bin sed ${HOME} x=1 printf "$1" export -eu | x=1 printf
+	printf "$@" /usr/bin /usr/bin export $(pwd) "$1" then -eu sed
+		done | 'quoted text'
+	awk then echo 2>/dev/null local | cd
+--verbose then local local test /usr/bin awk echo export | grep then printf
+		test readonly | grep test grep local sed sed grep
+local awk grep 2>/dev/null
+	&& export awk x=1 grep -eu | local
+-eu printf "$1" 2>/dev/null done
+		--verbose done 'quoted text'
+sed -eu cd echo -eu | x=1 x=1 printf "$1" | echo
+	then printf awk sed echo done echo export ${HOME} /usr/bin cd
+"$@" /usr/bin grep | awk then echo ${HOME} && --verbose
+	"$@" x=1 2>/dev/null 'quoted text' export readonly readonly cd | local
+export 'quoted text' printf
+		"$1" $(pwd) readonly ${HOME}
+		test 2>/dev/null "$1" then
+| | then $(pwd) /usr/bin
+	${HOME} readonly "$1" 'quoted text'
+		grep sed readonly cd grep 2>/dev/null
+/usr/bin 'quoted text' sed export
+	-eu ${HOME} printf -eu /usr/bin "$1" /usr/bin sed $(pwd)
+/usr/bin $(pwd) awk "$@" export | /usr/bin printf "$@" 2>/dev/null &&
+readonly grep done then | echo printf then sed
+$(pwd) echo ${HOME} test grep
+		local echo printf grep
+		x=1 --verbose 2>/dev/null sed cd cd | test
+	local then -eu then "$@" done ${HOME} 2>/dev/null 2>/dev/null
+		test readonly 'quoted text' "$1" test && sed readonly --verbose
+sed | done readonly /usr/bin "$@"
+sed /usr/bin && grep 2>/dev/null --verbose cd ${HOME} echo readonly -eu cd then
+		2>/dev/null echo awk 'quoted text' ${HOME}
+		test "$1" "$@" 2>/dev/null test | sed $(pwd) cd sed test printf 'quoted text'
+		-eu "$@" sed done 2>/dev/null test readonly
+		test local local done
+	test 2>/dev/null "$1" readonly then "$1" 2>/dev/null
+		$(pwd) "$@" "$@" echo && cd 'quoted text'
+		sed $(pwd) | 2>/dev/null then x=1 'quoted text' && local export ${HOME}
+		cd readonly | printf local "$@" "$@" awk sed 'quoted text'
+	cd export && x=1 "$1" /usr/bin x=1 grep $(pwd)
+		x=1 cd ${HOME} test printf
+		readonly --verbose export awk readonly export cd $(pwd) 'quoted text'
+		export echo -eu 'quoted text'
+then --verbose | readonly done
+	then && printf done cd local 'quoted text'
+x=1 sed "$1" "$@" readonly sed local export local 2>/dev/null then $(pwd)
+		| then x=1 grep 'quoted text' echo then readonly ${HOME} 'quoted text' sed
+		x=1 x=1 cd done 'quoted text' --verbose done --verbose /usr/bin grep
+$(pwd) done echo test cd awk readonly 'quoted text'
+		local test 2>/dev/null awk printf "$1" grep
+echo then 2>/dev/null $(pwd) echo x=1 x=1 sed local | echo --verbose "$1" "$1" |
+		'quoted text' grep x=1
+/usr/bin | /usr/bin --verbose then echo export local local readonly awk
+	grep test printf test | grep -eu | /usr/bin grep
+&& readonly echo /usr/bin test done && printf readonly then "$1"
+		$(pwd) /usr/bin | ${HOME} readonly cd "$@" x=1 &&
+	2>/dev/null "$1" 2>/dev/null
+		export "$1" awk done --verbose done
+echo awk && --verbose grep local -eu sed /usr/bin
+local $(pwd) echo /usr/bin
+		"$1" readonly grep local --verbose x=1 echo grep
+	$(pwd) echo "$1" x=1 ${HOME} "$1" export /usr/bin "$@" export --verbose test
+"$1" && 'quoted text' $(pwd) ${HOME} | test /usr/bin export ${HOME} 2>/dev/null
+		&& cd $(pwd) test printf sed ${HOME} readonly local done echo
+x=1 echo test export test 2>/dev/null awk
+		echo | /usr/bin cd export
+	export | 'quoted text' "$@" then grep $(pwd) 2>/dev/null
+		printf | grep export grep cd export done "$1" 'quoted text'
+		done x=1 echo sed cd done test cd
+	2>/dev/null 2>/dev/null "$@" 'quoted text'
+printf test export && 'quoted text'
+	x=1 cd export $(pwd) test awk --verbose --verbose
+test echo done x=1 "$1" echo /usr/bin 2>/dev/null readonly printf
+	x=1 x=1 export export test export local 2>/dev/null printf /usr/bin
+	readonly "$1" readonly "$1" -eu 'quoted text' 2>/dev/null export
+test $(pwd) test "$@" done /usr/bin grep -eu sed grep "$@" done
+"$@" done "$@" x=1 then awk test "$1" /usr/bin echo ${HOME}
+	printf "$@" x=1 export sed printf local
+	'quoted text' && printf printf 2>/dev/null
+		2>/dev/null done sed 'quoted text' 2>/dev/null x=1 --verbose --verbose sed
+		$(pwd) grep /usr/bin /usr/bin /usr/bin -eu awk echo --verbose readonly
+export readonly echo then test sed export printf done $(pwd)
+		printf x=1 readonly | local sed | ${HOME} $(pwd) cd 'quoted text'
+	"$1" awk 'quoted text' $(pwd) 'quoted text' "$1" $(pwd)
+		export 'quoted text' sed local /usr/bin grep $(pwd) x=1 done
+	done done "$1" grep 'quoted text' $(pwd) cd ${HOME}
+	"$@" ${HOME} printf x=1 readonly cd awk cd readonly
+"$@" $(pwd) 'quoted text' test awk cd "$@" "$@"
+		echo then 'quoted text' | ${HOME} 2>/dev/null x=1 echo
+		echo local echo printf readonly $(pwd) test |
+	awk $(pwd) "$@" "$@" 2>/dev/null 'quoted text'
+		-eu --verbose "$@" awk "$1" cd done done
+		'quoted text' export "$1" grep grep | awk printf then test
+		${HOME} export "$@" ${HOME}
+	'quoted text' done then "$1" then -eu $(pwd) x=1 local &&
+	&& done grep 2>/dev/null && echo then done && local printf
+&& ${HOME} grep awk | 'quoted text'
+	/usr/bin readonly --verbose export sed --verbose
+	--verbose | "$@" 2>/dev/null 2>/dev/null /usr/bin grep -eu | export 'quoted text'
+		/usr/bin 2>/dev/null 2>/dev/null
+	${HOME} "$1" /usr/bin local "$@" then /usr/bin readonly export
+		test /usr/bin "$@" && export x=1 'quoted text' /usr/bin "$1" 'quoted text' ${HOME}
+	"$1" then ${HOME} -eu $(pwd) -eu
+done printf grep sed grep awk awk export 'quoted text' 2>/dev/null test
+		printf done --verbose "$@" | local --verbose
+x=1 done -eu then test ${HOME} ${HOME}
+		grep export export x=1 grep printf
+		done cd x=1 export x=1 done /usr/bin "$@" &&
+	readonly 'quoted text' "$@" local
+	cd cd | 'quoted text' export done "$@" | &&
+	grep local sed sed | --verbose awk grep 'quoted text' $(pwd) done
+	test export done echo "$@" 2>/dev/null grep done readonly
+		"$1" then "$1" grep -eu $(pwd) $(pwd)
+2>/dev/null --verbose 'quoted text' export /usr/bin grep 'quoted text'
+	echo /usr/bin 2>/dev/null echo grep
+		/usr/bin && "$@" grep grep readonly /usr/bin
+	cd --verbose awk && ${HOME} then --verbose 'quoted text' awk test awk ${HOME}
+awk && 'quoted text' export printf 2>/dev/null
+awk readonly 'quoted text' test "$1" | /usr/bin sed 2>/dev/null local awk then |
+	awk | test printf then 'quoted text' readonly ${HOME} 'quoted text'
+local awk awk export local printf --verbose | sed --verbose | ${HOME}
+${HOME} readonly $(pwd) && local "$@" printf $(pwd) $(pwd) --verbose
+--verbose then /usr/bin $(pwd) x=1 echo x=1 'quoted text' "$1" 'quoted text' /usr/bin
+		"$1" | ${HOME} -eu done
+		done 'quoted text' echo x=1 "$@" awk echo | "$1"
+${HOME} local test readonly | | && readonly x=1 x=1 "$1" done "$1" /usr/bin
+then --verbose local "$@" done 'quoted text' $(pwd) $(pwd) echo local "$@" done
+		echo | readonly ${HOME} sed done "$@" "$1" 'quoted text' readonly
+		2>/dev/null ${HOME} grep
+$(pwd) "$@" export then 'quoted text' echo $(pwd) grep --verbose "$1"
+'quoted text' | printf "$1" $(pwd) then awk "$1" 'quoted text'
+		x=1 && readonly grep local echo $(pwd) -eu sed 'quoted text' $(pwd)
+local /usr/bin test ${HOME} echo 'quoted text' test -eu --verbose -eu x=1 done
+		--verbose sed "$@" x=1 sed done cd awk test printf && /usr/bin
+/usr/bin then export && && | sed readonly | --verbose
+2>/dev/null grep /usr/bin readonly printf local done cd sed done export awk
+-eu printf sed then && grep | && --verbose
+$(pwd) --verbose cd x=1 2>/dev/null ${HOME} ${HOME} echo then grep "$@" export test
+		then --verbose "$1" then "$1" && readonly | --verbose
+'quoted text' test 'quoted text' /usr/bin
+	cd cd cd done 'quoted text' sed /usr/bin local 'quoted text' &&
+	done readonly test sed test awk ${HOME} readonly export
+	grep $(pwd) awk test done grep -eu readonly x=1 grep cd printf
+		readonly "$@" /usr/bin
+| echo "$@" ${HOME} cd sed cd grep && 'quoted text' export export "$1" -eu cd
+		"$1" cd x=1 grep && local echo /usr/bin done printf readonly x=1 | /usr/bin
+		${HOME} awk 2>/dev/null awk echo /usr/bin /usr/bin awk --verbose cd $(pwd)
+		x=1 -eu printf $(pwd) then
+	local echo done "$1" cd grep export && ${HOME} echo grep &&
+--verbose $(pwd) grep local local x=1 echo echo awk "$@" local test printf
+		-eu printf printf then local | | $(pwd) grep
+export echo ${HOME} "$@" "$1" ${HOME} readonly test
+		readonly -eu 'quoted text' echo test | | sed x=1 export $(pwd) x=1 test
+| then 'quoted text' 2>/dev/null echo sed export
+		--verbose && export test "$1" readonly export echo 'quoted text' x=1 done
+		$(pwd) sed cd printf done && "$@" sed local test
+	grep "$@" $(pwd) grep 2>/dev/null 2>/dev/null 'quoted text'
+sed "$1" grep 'quoted text'
+		| /usr/bin $(pwd) echo echo "$@" export awk sed echo -eu /usr/bin local
+local echo sed echo cd "$@" /usr/bin
+		grep x=1 awk "$1" --verbose 2>/dev/null test && "$1" && && printf
+done "$@" -eu "$1" &&
+	x=1 x=1 && -eu awk x=1 sed done $(pwd) local local && | "$1" && 2>/dev/null
+/usr/bin test done "$@" done done --verbose
+		${HOME} "$1" test -eu
+'quoted text' local test readonly
+	x=1 && --verbose cd 2>/dev/null && x=1
+	local echo cd "$@" 2>/dev/null $(pwd) -eu | 'quoted text' "$1"
+	local x=1 then x=1 cd ${HOME} "$1" 2>/dev/null --verbose echo ${HOME} 'quoted text'
+		sed $(pwd) cd ${HOME} 'quoted text' -eu then
+printf x=1 | && 2>/dev/null printf local cd 'quoted text'
+	test "$1" -eu then printf export awk sed -eu
+/usr/bin then printf local ${HOME} done | echo readonly readonly sed "$@" echo
+'quoted text' local then $(pwd) readonly -eu export readonly export
+	grep /usr/bin ${HOME} done printf echo --verbose
+	"$1" --verbose x=1 local readonly
+		-eu && | x=1 awk x=1 readonly 'quoted text' -eu export printf -eu "$1" done
+		awk $(pwd) done cd export && --verbose /usr/bin
+	&& printf echo 2>/dev/null && readonly 'quoted text'
+		grep printf cd 'quoted text'
+test $(pwd) | then "$1" grep ${HOME} | readonly printf
+		then then echo awk printf 2>/dev/null 'quoted text' --verbose grep
+/usr/bin awk 2>/dev/null echo 'quoted text'
+	$(pwd) x=1 export awk $(pwd) test 'quoted text' |
+then --verbose local "$@" sed x=1 readonly "$1" && then "$1"
+		"$1" printf cd --verbose export x=1 done 'quoted text' ${HOME}
+		"$@" | export printf readonly
+	awk then x=1 'quoted text' "$@" grep echo echo cd
+	echo 2>/dev/null echo $(pwd) && done sed
+		-eu cd "$1" 2>/dev/null test done "$@" awk done local grep && | &&
+$(pwd) -eu grep $(pwd) $(pwd) readonly
+printf 'quoted text' "$1" "$1" done grep done
+	&& && cd awk "$@" ${HOME} $(pwd) readonly
+		${HOME} x=1 2>/dev/null -eu echo
+echo 2>/dev/null export "$@" grep ${HOME}
+&& export test x=1 awk "$@" done ${HOME} test ${HOME}
+then ${HOME} "$1" $(pwd) $(pwd) ${HOME} cd then cd awk awk -eu 'quoted text'
+		test --verbose test /usr/bin
+#include c5.sh
+grep x=1 awk $(pwd) sed "$1" export local cd "$1" sed then | -eu /usr/bin
+	cd ${HOME} "$@" grep x=1 && 2>/dev/null 'quoted text'
+${HOME} readonly export printf
+local export && $(pwd) export printf awk then
+readonly sed --verbose -eu cd /usr/bin x=1 sed
+awk awk x=1 grep | cd /usr/bin "$1" 'quoted text'
+		--verbose echo awk grep /usr/bin cd $(pwd) 2>/dev/null
+local awk 2>/dev/null --verbose 2>/dev/null
+		${HOME} done 'quoted text'
+	then export done | "$1" $(pwd) "$@" test ${HOME}
+printf cd && done $(pwd) 2>/dev/null grep then x=1 readonly $(pwd)
+		-eu -eu $(pwd) export 2>/dev/null
+awk ${HOME} && sed "$@" x=1 done grep awk
+	local awk x=1 then export local 2>/dev/null | cd x=1 cd -eu export | "$1" export
+local printf /usr/bin "$@" 2>/dev/null 2>/dev/null
+		readonly done "$@" local && grep -eu
+		grep local local "$@" local
+'quoted text' 2>/dev/null local ${HOME} grep 'quoted text' "$1" "$@" ${HOME}
+local awk readonly /usr/bin ${HOME} ${HOME} 'quoted text' grep 2>/dev/null
+	sed -eu echo readonly readonly | | --verbose then ${HOME}
+		"$1" test awk awk grep -eu awk cd
+		"$1" --verbose cd test 'quoted text' && local | --verbose
+	-eu 2>/dev/null cd cd && "$1" 'quoted text' 2>/dev/null 2>/dev/null grep
+	printf grep --verbose echo "$@" grep --verbose
+	"$1" "$@" | -eu done export local
+	2>/dev/null x=1 cd cd --verbose
+	$(pwd) sed ${HOME} printf done local -eu -eu x=1
+		/usr/bin awk --verbose cd local readonly
+${HOME} printf 'quoted text' | cd sed local
+	$(pwd) $(pwd) cd 'quoted text' done
+	${HOME} $(pwd) awk done sed then /usr/bin /usr/bin -eu readonly
+/usr/bin export printf -eu 2>/dev/null -eu readonly -eu grep --verbose
+		readonly ${HOME} "$1" test "$1" 'quoted text'
+	--verbose done "$1" 2>/dev/null export -eu grep grep "$1" export sed
+		"$@" $(pwd) grep export -eu awk "$@" -eu export
+		then grep printf ${HOME} echo printf "$1"
+readonly 2>/dev/null 'quoted text'
+	readonly /usr/bin readonly
+	&& local local awk then --verbose test 'quoted text' ${HOME} awk x=1 cd
+		x=1 then awk grep readonly done "$@" printf cd
+		export ${HOME} "$@" "$@" 2>/dev/null export
+	${HOME} readonly grep then
+2>/dev/null "$@" --verbose $(pwd) x=1 'quoted text' cd sed 'quoted text'
+		grep printf | | cd awk echo 'quoted text' grep ${HOME} -eu local printf "$1"
+		local $(pwd) -eu ${HOME} x=1 export readonly
+	"$1" /usr/bin printf test awk
+		${HOME} 2>/dev/null "$1" "$@" awk | done "$1" test test grep "$@" $(pwd) echo
+--verbose "$@" grep 'quoted text'
+		export 2>/dev/null "$@" "$1" done then test test done then -eu sed 2>/dev/null
+		grep "$@" printf "$@" sed $(pwd) && "$@" printf $(pwd) "$@"
+awk export cd grep -eu
+	"$@" local "$@" "$1" printf x=1 x=1 test awk 2>/dev/null then
+		$(pwd) echo $(pwd) --verbose awk "$1" cd "$@"
+		${HOME} x=1 printf x=1 export 'quoted text' "$1" 'quoted text'
+	"$1" "$1" echo 2>/dev/null printf --verbose then --verbose
+		echo readonly readonly && ${HOME} $(pwd) echo
+	export x=1 echo ${HOME} | test | && local test 2>/dev/null printf echo printf
+	--verbose --verbose sed -eu -eu /usr/bin -eu --verbose 2>/dev/null "$@" export
+		done "$1" printf export && | printf cd $(pwd) "$@"
+export --verbose $(pwd) readonly && echo | "$1" test readonly then --verbose echo
+	local "$1" && ${HOME} ${HOME} "$@" cd -eu local echo done "$1"
+	printf export export readonly --verbose "$@" ${HOME} printf $(pwd) -eu readonly
+		cd awk && grep "$@" cd local 2>/dev/null grep cd printf
+		grep /usr/bin cd --verbose readonly x=1 printf grep $(pwd) sed sed readonly "$@"
+		| ${HOME} -eu test then sed local echo
+| test -eu sed ${HOME} --verbose
+	then then /usr/bin echo test /usr/bin local
+x=1 /usr/bin 'quoted text' grep sed printf && 2>/dev/null
+| echo test cd test cd ${HOME}
+	local 2>/dev/null ${HOME} printf
+	grep done x=1 then 2>/dev/null local -eu --verbose
+x=1 done then 'quoted text' awk | then | sed 2>/dev/null
+		| /usr/bin -eu export readonly 'quoted text'
+		2>/dev/null ${HOME} "$@" cd && 2>/dev/null x=1 "$@" && | readonly
+	printf export && 2>/dev/null --verbose readonly awk local echo "$@" | |
+		2>/dev/null -eu && done awk &&
+	'quoted text' "$@" echo ${HOME} "$1"
+		&& "$@" awk cd test done /usr/bin sed test /usr/bin cd
+x=1 --verbose "$@" readonly export 2>/dev/null awk "$1" ${HOME} x=1 export
+	x=1 --verbose x=1 "$1" 2>/dev/null
+		export grep ${HOME} done sed awk --verbose && "$@" awk "$1" printf
+	echo $(pwd) then sed /usr/bin "$1" 2>/dev/null test awk
+echo printf 'quoted text' cd echo printf then "$1" ${HOME} 'quoted text' local
+then $(pwd) --verbose "$@" |
+	"$@" sed && cd sed 2>/dev/null $(pwd) | test then && /usr/bin
+		-eu awk -eu /usr/bin | echo
+	awk then | 2>/dev/null awk awk &&
+		--verbose readonly awk local printf readonly | readonly
+		local "$1" 2>/dev/null export x=1 'quoted text' echo 'quoted text'
+	test then cd -eu "$1" "$1" /usr/bin readonly --verbose readonly readonly
+"$1" awk awk done then then readonly /usr/bin 2>/dev/null
+		-eu ${HOME} x=1 awk $(pwd)
+readonly -eu awk /usr/bin export | done && | echo sed echo --verbose ${HOME}
+		$(pwd) printf "$1" $(pwd) $(pwd) export done sed
+		cd "$@" ${HOME} "$@"
+-eu cd ${HOME} x=1 | export 2>/dev/null -eu test
+$(pwd) done x=1 | echo export done export ${HOME} 'quoted text'
+	echo "$@" 2>/dev/null "$1"
+	"$1" awk 'quoted text' cd ${HOME} --verbose /usr/bin then -eu | -eu cd
+test then then x=1 /usr/bin $(pwd) | | "$@" "$@" echo $(pwd) | | test cd
+		-eu echo readonly "$1" printf /usr/bin -eu local local readonly
+$(pwd) 'quoted text' export grep "$@" "$1"
+	echo /usr/bin readonly x=1 "$1" awk x=1 echo echo | && echo
+		'quoted text' --verbose "$1" then $(pwd) -eu --verbose
+/usr/bin -eu && done then -eu test sed local 2>/dev/null $(pwd) grep grep 'quoted text'
+awk "$1" cd printf awk "$1" printf x=1 grep --verbose then
+	export then -eu $(pwd) | grep "$1" /usr/bin /usr/bin sed then done x=1
+		--verbose export then 'quoted text' done 'quoted text' done
+grep $(pwd) | cd sed --verbose awk && export sed printf then echo 2>/dev/null
+grep 'quoted text' readonly
+		printf 'quoted text' readonly local local test awk | 'quoted text' done test
+		'quoted text' done "$1" | "$@" echo "$1" export
+		sed sed cd awk readonly | export "$1" /usr/bin done cd done
+sed sed /usr/bin test awk cd "$1" ${HOME} echo -eu $(pwd)
+	| /usr/bin 2>/dev/null 'quoted text' && "$@" $(pwd) && awk readonly
+2>/dev/null -eu readonly | "$@" readonly -eu -eu sed 'quoted text'
+	sed $(pwd) printf && readonly local 2>/dev/null $(pwd) 2>/dev/null
+test "$@" 2>/dev/null sed x=1 2>/dev/null printf cd && awk && x=1 | x=1 'quoted text'
+	'quoted text' echo "$1" sed then readonly local 2>/dev/null 2>/dev/null
+	echo && --verbose cd -eu then test grep /usr/bin then test export test test
+| ${HOME} done /usr/bin x=1 && printf printf export
+export echo -eu test export
+	-eu --verbose $(pwd) readonly x=1 -eu
+	2>/dev/null "$@" local then "$@" test x=1
+	local grep 'quoted text' --verbose awk /usr/bin grep
+	then "$@" readonly then readonly test "$@" x=1 "$1" test -eu && grep test x=1
+readonly -eu sed awk --verbose
+		'quoted text' awk test | "$@"
+2>/dev/null 2>/dev/null 2>/dev/null -eu awk $(pwd) --verbose | -eu
+		"$1" /usr/bin grep -eu readonly then /usr/bin "$1" grep "$@" -eu $(pwd) x=1
+		local export "$1" x=1 ${HOME} &&
+		sed then $(pwd) /usr/bin then done then 'quoted text' 'quoted text'
+	export sed readonly echo --verbose 'quoted text' printf --verbose
+		-eu -eu $(pwd) 'quoted text' /usr/bin printf export "$1" local x=1 export then
+-eu 2>/dev/null && ${HOME} sed printf
+2>/dev/null then echo x=1
+		sed local | -eu "$1" x=1 && printf "$1" readonly
+	$(pwd) export done export 2>/dev/null 'quoted text' local test grep
+/usr/bin "$1" grep 'quoted text' -eu export -eu
+2>/dev/null local x=1 $(pwd) && 2>/dev/null
+then echo 2>/dev/null --verbose export local /usr/bin done export 2>/dev/null
+		/usr/bin done readonly 2>/dev/null then readonly local 2>/dev/null
+	/usr/bin readonly echo -eu --verbose && $(pwd)
+	echo && "$1" && 'quoted text' $(pwd) grep $(pwd)
+		x=1 $(pwd) | x=1 x=1 test local 2>/dev/null echo
+		-eu $(pwd) -eu 'quoted text' test
+		done --verbose awk && printf 2>/dev/null local readonly
+		-eu "$@" ${HOME} 2>/dev/null
+-eu readonly grep 'quoted text'
+		-eu export readonly awk sed readonly "$1" awk sed test readonly
+grep --verbose "$1" echo export
+	then "$@" "$@" $(pwd) export ${HOME} then "$1" then 2>/dev/null
+		2>/dev/null && export echo ${HOME}
+	cd x=1 | readonly readonly -eu
+export ${HOME} cd export done /usr/bin && 'quoted text' sed done "$@" "$@"
+then && --verbose 'quoted text' cd sed local echo --verbose 2>/dev/null x=1
+		cd cd local done ${HOME} echo test
+	readonly grep $(pwd) sed "$1"
+	x=1 then x=1 ${HOME} -eu sed readonly
+		2>/dev/null "$@" | grep && then test /usr/bin "$@" --verbose 2>/dev/null
+export test 2>/dev/null export then printf $(pwd) &&
+		$(pwd) then 'quoted text' "$1" $(pwd)
+	&& awk && -eu cd 2>/dev/null done awk 'quoted text' ${HOME}
+		"$@" "$1" && readonly then export --verbose |
+${HOME} x=1 | echo readonly then 'quoted text' done grep done then $(pwd) 'quoted text'
+awk /usr/bin && 'quoted text' test
+echo x=1 | export done "$1" echo $(pwd) sed $(pwd) sed
+	"$1" done test /usr/bin
+${HOME} && grep printf readonly export -eu sed 2>/dev/null -eu "$1"
+		$(pwd) -eu | sed 2>/dev/null
+$(pwd) ${HOME} $(pwd) test then awk readonly $(pwd) x=1 export "$@"
+	/usr/bin export grep /usr/bin 2>/dev/null
+local ${HOME} "$@" readonly | 'quoted text' readonly echo export $(pwd)
+	| readonly && ${HOME} -eu printf "$1"
+		x=1 echo test echo ${HOME} cd $(pwd) then $(pwd) x=1 | $(pwd) "$@"
+	done readonly "$@" then test echo "$@" --verbose "$@" 'quoted text' test "$@"
+	echo done echo "$@" local "$@" $(pwd) done
+awk ${HOME} local 'quoted text' sed | "$@" sed test export
+grep -eu grep $(pwd) export echo 2>/dev/null then --verbose
+		sed done echo grep /usr/bin sed then awk echo $(pwd) x=1 readonly readonly
+		readonly awk /usr/bin 'quoted text' "$1" $(pwd) local
+		x=1 printf 2>/dev/null && /usr/bin 2>/dev/null done sed
+${HOME} sed export | cd echo sed local | then x=1 printf printf
+	2>/dev/null grep sed printf | 2>/dev/null --verbose awk cd
+	/usr/bin sed ${HOME} then printf
+		export 'quoted text' "$1" && printf cd /usr/bin then
+$(pwd) export x=1 && 'quoted text' awk echo test then grep
+${HOME} && cd x=1 && printf echo sed test 2>/dev/null done grep -eu "$1" x=1
+echo echo grep test echo sed then x=1 done echo cd
+done export done export sed && 2>/dev/null printf
+	$(pwd) echo test ${HOME} 2>/dev/null --verbose && x=1 echo /usr/bin
+		/usr/bin 2>/dev/null echo $(pwd) /usr/bin echo $(pwd) grep awk
+	2>/dev/null /usr/bin grep &&
+	/usr/bin --verbose && awk ${HOME} readonly $(pwd) done ${HOME} readonly
+export ${HOME} export "$@"
+		/usr/bin | && ${HOME} sed readonly test x=1 /usr/bin
+		printf grep export cd readonly done "$@" 2>/dev/null sed printf ${HOME}
+		x=1 'quoted text' --verbose awk /usr/bin done export "$@"
+	sed then --verbose 'quoted text' local
+	x=1 "$@" 'quoted text' export readonly
+		2>/dev/null printf export sed && sed local echo cd readonly
+		"$@" --verbose ${HOME} cd --verbose x=1 done 'quoted text'
+		readonly printf test done "$1" "$1" echo local "$1" then $(pwd) x=1 then then
+	x=1 sed sed | "$@" --verbose printf
+	${HOME} && 'quoted text'
+	--verbose cd -eu test echo then && 2>/dev/null
+"$1" export test done "$1" x=1 done cd
+printf "$@" "$1" | | "$@" "$@"
+	test cd 2>/dev/null printf x=1 | done && 'quoted text' done && export awk
+-eu grep "$1" 'quoted text'
+	x=1 -eu ${HOME} $(pwd)
+		echo printf ${HOME} | --verbose
+		cd --verbose "$1" done readonly printf | test 2>/dev/null "$@"
+local --verbose "$@" -eu -eu local sed x=1 ${HOME} | awk "$1"
+	then cd ${HOME} -eu ${HOME} awk --verbose sed $(pwd) awk echo test
+--verbose /usr/bin 2>/dev/null /usr/bin local ${HOME} | cd $(pwd)
+		-eu done | export echo "$1" $(pwd) readonly -eu 2>/dev/null |
+	then "$1" x=1 /usr/bin test
+	x=1 -eu echo "$1" "$@" local /usr/bin awk done cd /usr/bin sed grep sed local
+	done $(pwd) local then x=1 done then $(pwd) grep x=1
+	"$1" | $(pwd) export 'quoted text' echo 2>/dev/null 2>/dev/null
+		test export echo ${HOME} 2>/dev/null $(pwd) sed export export -eu 'quoted text'
+		2>/dev/null local 'quoted text' awk 2>/dev/null
+	"$@" then export grep &&
+/usr/bin --verbose awk 'quoted text' | "$1"
+${HOME} grep awk --verbose
+	done --verbose | readonly sed cd ${HOME} local
+		&& grep 'quoted text' then export && "$1" --verbose test
+	echo sed then local readonly "$1" -eu 2>/dev/null | 'quoted text'
+		grep then ${HOME} --verbose ${HOME} | --verbose "$1"
+	readonly --verbose x=1 sed
+		local && export echo && -eu $(pwd) cd grep done awk $(pwd)
+--verbose /usr/bin && && sed --verbose test
+		readonly 2>/dev/null "$1" --verbose
+		cd ${HOME} | done ${HOME} && /usr/bin x=1 sed 2>/dev/null sed --verbose
+-eu export printf | echo -eu awk grep --verbose cd readonly
+	echo readonly /usr/bin 'quoted text' --verbose ${HOME}
+		$(pwd) awk sed ${HOME} "$@"
+cd done ${HOME} $(pwd) printf 2>/dev/null then ${HOME} /usr/bin awk
+x=1 | && done cd done grep $(pwd) then
+		local grep sed readonly ${HOME} 'quoted text' "$1" "$1" $(pwd) readonly
+		then export then "$@" grep awk -eu then && 'quoted text' 2>/dev/null "$@" sed
+	then local done readonly export && ${HOME} sed
+	| readonly done local --verbose 2>/dev/null x=1 | 2>/dev/null
+	test "$@" echo x=1 x=1 -eu "$@" 2>/dev/null x=1 echo
+	'quoted text' -eu x=1 echo "$1" "$@" | | export x=1 -eu
+x=1 x=1 -eu 2>/dev/null then cd --verbose grep awk echo 'quoted text'
+awk --verbose $(pwd) readonly grep "$@" awk ${HOME}
+		${HOME} /usr/bin 'quoted text' local x=1 "$1" 2>/dev/null done ${HOME} "$@" sed
+		local readonly echo awk 2>/dev/null done test test readonly local printf then sed
+done printf -eu local echo cd && | "$@" ${HOME} 'quoted text' test awk /usr/bin
+		export "$@" then echo ${HOME} "$1" 'quoted text'
+	--verbose cd "$1" "$@" $(pwd) "$@" | -eu 2>/dev/null printf
+	sed echo --verbose awk sed
+&& export --verbose | test x=1 printf grep && readonly then sed
+awk "$@" "$1" readonly -eu /usr/bin awk | grep /usr/bin readonly export cd
+"$@" printf sed done then && cd "$1" "$@" --verbose
+	awk 'quoted text' "$@" echo "$1" export echo
+		export /usr/bin sed /usr/bin then 2>/dev/null
+	| x=1 cd export done sed $(pwd) && echo test
+--verbose sed x=1 ${HOME} test readonly printf 2>/dev/null
+	sed test cd cd 'quoted text' done /usr/bin -eu | x=1 -eu cd
+	then sed done "$@" -eu printf echo 'quoted text'
+	then grep "$@" x=1 export cd --verbose awk printf ${HOME} --verbose x=1 ${HOME}
+	$(pwd) printf x=1 x=1 printf "$1" done
+	test 2>/dev/null local --verbose readonly ${HOME}
+		&& x=1 printf 'quoted text' export awk | "$1" cd cd echo printf
+"$1" sed 2>/dev/null ${HOME} sed 2>/dev/null -eu export -eu 2>/dev/null
+		export ${HOME} | --verbose --verbose sed test | printf printf
+	echo 2>/dev/null export /usr/bin done 2>/dev/null $(pwd) "$1"
+	--verbose -eu "$1" | printf && grep --verbose /usr/bin "$1" ${HOME} x=1
+	grep 'quoted text' && test done 'quoted text'
+	local /usr/bin done /usr/bin printf 'quoted text' awk local
+		| 'quoted text' x=1 readonly 2>/dev/null x=1 done
+	${HOME} 2>/dev/null then --verbose awk echo
+	done echo | $(pwd) --verbose
+	sed "$@" --verbose test --verbose awk x=1 test done
+-eu then 'quoted text' grep --verbose readonly
+done test export 2>/dev/null test /usr/bin x=1 $(pwd) | then printf echo
+awk local sed ${HOME} "$@" /usr/bin x=1 echo echo export then
+		"$1" 2>/dev/null export "$1"
+		grep -eu local 'quoted text'
+		&& readonly x=1 "$1" 'quoted text'
+"$@" | --verbose grep awk $(pwd) sed $(pwd) 'quoted text'
+	export ${HOME} 2>/dev/null test printf | x=1 grep 2>/dev/null
+	2>/dev/null 'quoted text' local cd readonly &&
+		&& && "$1" 2>/dev/null export echo ${HOME} ${HOME} "$1" "$1" ${HOME} -eu echo
+-eu /usr/bin grep 'quoted text' x=1 && -eu readonly echo local echo export
+"$@" grep $(pwd) --verbose sed
+echo grep local sed ${HOME} test
+	export $(pwd) grep sed "$@" -eu ${HOME} "$1" echo sed /usr/bin | /usr/bin
+"$@" --verbose echo sed
+readonly 2>/dev/null |
+| && test printf printf test | cd "$1" done | local x=1 /usr/bin then
+echo | cd cd then 'quoted text' printf && -eu x=1 then | export "$1" ${HOME}
+	"$1" then then -eu export test --verbose
+then sed 2>/dev/null done awk local 2>/dev/null done done 'quoted text'
+	-eu sed 2>/dev/null "$1" ${HOME} done test awk /usr/bin -eu grep $(pwd)
+	--verbose && 2>/dev/null sed x=1 done awk test && x=1 printf ${HOME}
+		"$1" done done && 2>/dev/null
+	--verbose local -eu 2>/dev/null echo done ${HOME} ${HOME} export
+	"$1" awk then echo | /usr/bin | /usr/bin 2>/dev/null
+		'quoted text' x=1 | "$1" x=1 grep readonly cd $(pwd) test -eu test $(pwd)
+test && local -eu | 2>/dev/null done test printf cd test local
+	awk readonly printf done 2>/dev/null cd &&
+${HOME} ${HOME} /usr/bin cd test x=1 sed cd && 2>/dev/null | $(pwd)
+printf -eu sed grep &&
+	awk ${HOME} --verbose export sed awk
+$(pwd) printf local | echo 2>/dev/null test && && -eu "$@" cd done awk -eu then
+		'quoted text' "$1" $(pwd) done echo -eu test then test echo local "$@"
+	echo && $(pwd) -eu 'quoted text' && awk "$1" 2>/dev/null cd
+	grep local "$@" echo x=1 $(pwd) "$@" local done cd grep -eu grep x=1
+		sed 2>/dev/null awk | /usr/bin 2>/dev/null
+2>/dev/null test 'quoted text' | grep test then grep export grep awk then &&
+x=1 test then echo "$1" export export echo echo printf echo "$@" local awk
+		echo 'quoted text' | test local -eu readonly -eu local cd x=1 echo
+		local awk local echo done $(pwd) sed 'quoted text' ${HOME} local
+		readonly && readonly cd sed ${HOME} echo 2>/dev/null
+		grep cd test 2>/dev/null printf $(pwd) ${HOME} 2>/dev/null
+	/usr/bin local 'quoted text' awk
+$(pwd) then | local ${HOME} local "$1"
+	awk 'quoted text' "$@" --verbose x=1 $(pwd) -eu | test sed sed done test
+awk ${HOME} ${HOME} ${HOME} --verbose
+"$@" x=1 2>/dev/null -eu grep cd printf
+test x=1 sed export local sed --verbose
+	printf --verbose $(pwd) then "$1" --verbose export cd awk --verbose
+	grep x=1 $(pwd) then "$@" $(pwd) 2>/dev/null x=1 -eu $(pwd) x=1 "$1" x=1 awk "$@"
+	then done "$@" grep ${HOME}
+	echo ${HOME} sed $(pwd) 'quoted text' --verbose test --verbose
+		printf done 'quoted text' export echo
+		awk "$@" sed printf grep
+		| 'quoted text' "$@" ${HOME} cd grep awk ${HOME} echo
+		'quoted text' awk test x=1 $(pwd) | then
+	done && 'quoted text' x=1 export -eu cd test "$1" -eu cd "$@" 2>/dev/null $(pwd)
+	"$@" -eu then local --verbose
+	&& "$1" grep | echo | printf
+		'quoted text' readonly
+	grep "$@" local "$@" ${HOME} -eu x=1 echo done printf --verbose then local
+export then readonly "$1" 2>/dev/null
+		-eu awk grep /usr/bin /usr/bin grep 2>/dev/null && /usr/bin -eu $(pwd) "$1"
+"$1" done export awk ${HOME} local local --verbose 2>/dev/null then --verbose awk
+		--verbose --verbose x=1 readonly $(pwd) export "$1" x=1 'quoted text'
+	"$@" export -eu local then
+printf "$1" sed | | 'quoted text' local cd /usr/bin
+echo export $(pwd) && printf sed | export -eu readonly cd then
+		/usr/bin && $(pwd) "$1" grep x=1 awk "$@" printf
+echo sed test x=1 grep cd -eu /usr/bin -eu then "$1" then
+readonly test sed test x=1 grep "$1" test test local
+test -eu ${HOME} echo test x=1 x=1 sed awk done -eu "$1" then cd ${HOME} awk
+awk /usr/bin then test ${HOME} test
+		awk && export ${HOME} -eu test $(pwd) ${HOME} "$@"
+	test printf readonly $(pwd) echo test -eu sed done x=1 grep --verbose sed
+	--verbose awk local $(pwd) "$@" cd grep /usr/bin
+echo x=1 echo echo x=1 &&
+	x=1 /usr/bin "$@" local x=1 | echo --verbose cd cd "$1" grep echo
+	'quoted text' 'quoted text' sed $(pwd) echo sed
+	--verbose $(pwd) /usr/bin $(pwd) grep /usr/bin cd 2>/dev/null
+	"$1" echo sed --verbose
+	"$@" "$1" export grep $(pwd) $(pwd) sed export
+grep x=1 cd 2>/dev/null 'quoted text' | 'quoted text' --verbose
+-eu local sed echo echo done |
+		local $(pwd) local sed "$1" --verbose 'quoted text' echo readonly
+		local "$@" x=1 local grep readonly ${HOME} grep sed x=1
+	echo x=1 "$@" && 2>/dev/null then
+	cd awk cd x=1 ${HOME} x=1
+| | /usr/bin echo "$@" printf
+		&& 'quoted text' printf 'quoted text'
+$(pwd) && local then export ${HOME} "$1" cd "$1" $(pwd) x=1 cd --verbose
+| grep export grep 2>/dev/null local printf ${HOME} awk
+	| echo then done awk then then x=1 local
+echo "$1" then | | "$1" then 2>/dev/null /usr/bin /usr/bin cd cd done
+grep -eu done export awk sed then ${HOME} export 2>/dev/null
+	/usr/bin sed grep 2>/dev/null "$@" export --verbose
+grep $(pwd) x=1 /usr/bin /usr/bin cd 'quoted text'
+		$(pwd) "$@" 'quoted text' echo
+$(pwd) && | test -eu
+		then awk --verbose 'quoted text'
+	&& echo export done printf export x=1
+	-eu "$@" $(pwd) export readonly
+		readonly printf $(pwd) "$1" | $(pwd) -eu 2>/dev/null
+		"$@" readonly "$@" $(pwd) ${HOME} && /usr/bin
+	test then cd --verbose | 'quoted text'
+	grep -eu readonly cd export then test 2>/dev/null
+&& export then x=1 x=1 -eu sed test echo /usr/bin then test $(pwd) test |
+		'quoted text' /usr/bin --verbose awk ${HOME} && grep "$1" echo
+		'quoted text' printf 2>/dev/null local readonly then cd --verbose done export
+	export then --verbose -eu printf "$1"
+	2>/dev/null sed /usr/bin x=1 sed ${HOME} "$@" --verbose -eu 2>/dev/null readonly
+sed test ${HOME} x=1 'quoted text'
+grep export "$@" --verbose --verbose
+	printf 2>/dev/null x=1 && sed cd --verbose
+printf done --verbose readonly ${HOME} | then test readonly cd local
+done readonly cd && sed "$1" "$1" cd printf /usr/bin x=1 then
+	x=1 'quoted text' then printf $(pwd) 'quoted text'
+	printf cd printf -eu awk ${HOME} ${HOME} printf grep ${HOME} local grep
+	-eu local grep /usr/bin /usr/bin
+echo x=1 test /usr/bin sed printf done && "$@" echo && $(pwd) 'quoted text'
+	readonly test local && awk "$@"
+$(pwd) 'quoted text' then then ${HOME} then && ${HOME} done test test
+	/usr/bin test grep done /usr/bin --verbose sed printf
+${HOME} local "$@" then sed 2>/dev/null echo /usr/bin "$@" cd /usr/bin
+"$1" readonly done awk x=1 /usr/bin export export test
+	sed awk | awk cd local test ${HOME} | done $(pwd) local -eu local grep
+		sed && /usr/bin export "$@" awk awk 'quoted text'
+	readonly grep grep export test | readonly "$1" grep -eu && -eu awk
+export | | --verbose printf
+	echo | sed | done "$@" -eu --verbose
+		local 2>/dev/null -eu cd echo cd -eu test echo
+$(pwd) cd test x=1 "$@" | echo done export test readonly local "$1" cd echo
+	done "$@" "$1" "$@" cd export ${HOME} | test $(pwd)
+		'quoted text' awk 2>/dev/null cd printf /usr/bin ${HOME}
+	sed then then $(pwd) x=1 test "$1"
+		--verbose sed printf 2>/dev/null /usr/bin printf $(pwd) cd | x=1 ${HOME} then
+		--verbose -eu readonly
+		"$@" export local --verbose done
+done awk echo awk x=1 | cd -eu 'quoted text' x=1 -eu test
+printf | ${HOME} cd done test awk /usr/bin "$1" 2>/dev/null
+grep | ${HOME} && export /usr/bin echo $(pwd) -eu test 'quoted text'
+		${HOME} | | 2>/dev/null cd test done
+		-eu printf test "$1" $(pwd) readonly then grep awk "$1" $(pwd) awk
+		--verbose 'quoted text' sed -eu /usr/bin
+| test && done /usr/bin ${HOME}
+		&& local cd done export awk
+		readonly grep | 'quoted text' "$@" readonly 2>/dev/null sed done
+	x=1 --verbose cd x=1 "$@" test sed x=1 export
+		"$1" 2>/dev/null done 'quoted text' readonly 'quoted text' then test 2>/dev/null
+	&& done -eu sed 'quoted text' grep cd && ${HOME}
+/usr/bin && readonly local -eu 2>/dev/null x=1 local export 'quoted text'
+/usr/bin local local $(pwd) && 2>/dev/null export done local "$1" printf "$@"
+	cd awk --verbose done readonly local printf
+		done echo export | printf
+	$(pwd) ${HOME} -eu local $(pwd) then local echo |
+--verbose grep test ${HOME} local /usr/bin
+	"$1" 2>/dev/null sed test x=1 /usr/bin sed 'quoted text' /usr/bin && &&
+		awk sed export sed awk awk sed
+	then && printf /usr/bin printf 'quoted text'
+		printf 'quoted text' echo cd sed ${HOME} sed readonly 'quoted text' echo export
+	"$1" export done then local ${HOME} cd -eu $(pwd) |
+2>/dev/null /usr/bin "$1" 'quoted text' $(pwd) echo
+		x=1 sed "$@" export ${HOME} "$@" sed test | $(pwd) local readonly
+		test "$@" && grep done done cd 'quoted text'
+$(pwd) export && grep test printf
+		"$@" && export done "$@" 'quoted text' readonly readonly
+	| -eu | export readonly $(pwd) test --verbose | cd grep export
+		echo test | test echo "$@" | test 2>/dev/null
+		$(pwd) echo ${HOME} sed && "$1" --verbose test x=1 2>/dev/null $(pwd)
+		/usr/bin -eu | ${HOME} done "$@" done /usr/bin
+"$@" "$1" sed printf "$1"
+		readonly sed $(pwd) grep done 'quoted text'
+--verbose sed "$@" "$1" awk then grep "$1" export $(pwd)
+&& --verbose $(pwd) 'quoted text' awk --verbose --verbose sed done
+	done | --verbose cd echo then -eu | grep printf export
+'quoted text' local cd then /usr/bin x=1 readonly sed 2>/dev/null | -eu /usr/bin
+	$(pwd) local echo 2>/dev/null
+local echo printf test sed && cd -eu 2>/dev/null /usr/bin x=1 test &&
+	| done readonly 'quoted text' "$1" | done local
+| $(pwd) 2>/dev/null sed "$@" && echo "$@" 2>/dev/null cd test readonly
+echo printf grep && printf readonly 'quoted text' /usr/bin ${HOME} 'quoted text'
+		&& export "$@" done readonly ${HOME} $(pwd)
+readonly sed echo echo export export ${HOME} && $(pwd)
+		printf 2>/dev/null -eu local $(pwd) cd export | && done readonly sed 2>/dev/null
+	grep local ${HOME} printf awk cd 'quoted text' 2>/dev/null
+/usr/bin local awk 2>/dev/null x=1 sed sed 2>/dev/null printf "$1"
+		x=1 && then cd awk 2>/dev/null
+test --verbose "$@" /usr/bin done $(pwd) sed echo export |
+echo readonly x=1 awk 'quoted text'
+		readonly printf "$1" sed
+	&& | && 'quoted text' done then
+		export -eu local 'quoted text' /usr/bin done done --verbose
+test $(pwd) | done "$@" local "$1" echo done 'quoted text'
+		sed 'quoted text' | $(pwd) awk export x=1 "$1" -eu "$1" "$@" | grep "$@" readonly
+	export local | printf export | x=1 sed echo then local readonly
+	"$1" && echo readonly 2>/dev/null
+		$(pwd) sed then grep 'quoted text'
+2>/dev/null test cd 'quoted text' echo then done 2>/dev/null
+	'quoted text' local -eu grep echo && /usr/bin done | $(pwd) export
+	echo done "$1" export && "$@" ${HOME} echo echo local /usr/bin
+		local cd done test printf /usr/bin grep test
+	x=1 done && cd 2>/dev/null readonly "$1" $(pwd) test $(pwd)
+		'quoted text' ${HOME} ${HOME} printf test printf test done
+| export readonly ${HOME} --verbose x=1 grep export then cd &&
+	grep "$1" echo /usr/bin readonly
+	sed | x=1 local --verbose "$@" printf
+&& test && readonly export printf test | done
+	x=1 readonly /usr/bin ${HOME}
+	readonly local x=1 -eu 2>/dev/null awk 'quoted text' readonly
+	test awk grep && awk awk then readonly
+		${HOME} readonly "$@" --verbose then && sed printf
+sed echo readonly 2>/dev/null "$@" && local /usr/bin printf /usr/bin ${HOME} then
+		| local readonly && ${HOME} awk x=1 --verbose $(pwd)
+		local "$1" awk readonly "$1" | /usr/bin test
+	done awk sed printf ${HOME} 'quoted text' --verbose $(pwd) sed $(pwd) sed awk
+	awk readonly 2>/dev/null echo ${HOME} && -eu sed awk "$@"
+	/usr/bin 'quoted text' grep awk printf readonly "$1" ${HOME} awk done grep
+done local echo test echo $(pwd) export -eu sed --verbose 'quoted text'
+grep test /usr/bin -eu ${HOME} ${HOME}
+| export 2>/dev/null then 'quoted text' cd | $(pwd)
+printf $(pwd) "$1" | x=1 --verbose 'quoted text'
+grep && 2>/dev/null cd readonly
+awk then 'quoted text' local test local | then cd printf
+done "$@" -eu "$@" sed && $(pwd) awk sed readonly /usr/bin "$@" sed then
+	&& $(pwd) /usr/bin && "$1" awk | printf
+"$1" -eu local && 'quoted text' readonly --verbose --verbose
+&& test local export -eu && "$1" test --verbose test done cd test awk awk x=1
+"$@" cd test sed test | --verbose then done grep done "$1"
+		"$1" test $(pwd) grep --verbose cd printf
+		"$@" /usr/bin 'quoted text' local then && "$@" grep "$1" export "$@" then
+		'quoted text' then -eu x=1 local export readonly then printf
+--verbose done && "$1" grep -eu export && "$@" done export 'quoted text' $(pwd)
+		readonly done "$1" /usr/bin $(pwd)
+	x=1 test readonly local done && printf export "$1" -eu local then
+cd ${HOME} | cd && test readonly
+		echo --verbose | -eu -eu | $(pwd)
+	cd then /usr/bin && 'quoted text' 'quoted text' echo printf --verbose
+		/usr/bin x=1 ${HOME} -eu sed printf echo awk
+readonly export -eu sed --verbose x=1 export export echo $(pwd) "$@"
+		awk --verbose printf /usr/bin echo readonly
+	then 'quoted text' readonly readonly | then test
+	local cd grep $(pwd) 2>/dev/null printf readonly
+	printf test x=1 test local /usr/bin
+		"$@" test "$1" cd sed 'quoted text' readonly
+echo 2>/dev/null 'quoted text'
+	done 'quoted text' 2>/dev/null ${HOME}
+	x=1 test awk done echo /usr/bin | ${HOME} local "$1" awk "$1" sed "$@" cd && printf
+2>/dev/null readonly $(pwd) --verbose test grep "$1" sed 2>/dev/null
+		| done grep test /usr/bin test "$@" 2>/dev/null | && | sed
+		readonly done cd "$@" sed
+done 'quoted text' "$1" printf 2>/dev/null
+--verbose sed cd printf x=1 -eu $(pwd) test readonly x=1 export
+cd local echo x=1 readonly && then 2>/dev/null
+echo x=1 /usr/bin awk --verbose local sed --verbose printf local && "$1" --verbose
+awk grep export "$1" | && grep "$@" awk awk awk --verbose grep
+		2>/dev/null cd ${HOME} grep sed
+sed | test x=1 printf done --verbose "$@" grep sed cd cd echo readonly
+		test sed done then 2>/dev/null test --verbose awk "$1" local x=1 x=1
+		then $(pwd) local &&
+		echo $(pwd) export ${HOME} "$@" then && test test $(pwd) --verbose
+/usr/bin 'quoted text' ${HOME} 'quoted text' && done -eu
+		test x=1 "$1" then cd 2>/dev/null "$@" awk cd then grep local $(pwd)
+		cd local x=1 test sed done
+printf cd readonly grep then && awk test
+printf grep -eu then x=1 export cd ${HOME} done then 'quoted text'
+		"$@" 2>/dev/null 'quoted text' readonly $(pwd)
+/usr/bin sed ${HOME} done awk $(pwd) export test
+	echo --verbose then x=1 'quoted text'
+	printf cd awk awk test "$1" -eu /usr/bin "$1" 'quoted text' then awk echo
+test awk echo test 2>/dev/null | --verbose
+	x=1 test | done /usr/bin /usr/bin echo then 'quoted text'
+printf echo local ${HOME} "$@" grep export 2>/dev/null sed "$1" ${HOME} 'quoted text'
+		$(pwd) readonly cd ${HOME} cd "$@" export cd
+		awk readonly -eu local "$@" | sed "$1" awk echo $(pwd) echo export
+/usr/bin grep readonly --verbose test "$1" ${HOME} awk 2>/dev/null "$@" printf
+		/usr/bin done sed x=1 printf sed then readonly x=1 printf 'quoted text' local
+&& $(pwd) cd grep --verbose ${HOME} local local cd local ${HOME}
+		sed --verbose export /usr/bin echo ${HOME}
+	awk -eu 2>/dev/null "$@" 2>/dev/null
+	&& -eu $(pwd) ${HOME} 'quoted text' done test x=1 'quoted text'
+	local && 2>/dev/null 2>/dev/null
+printf | grep cd && "$1" printf test --verbose |
+		printf sed ${HOME} --verbose local && 2>/dev/null
+		export done 2>/dev/null sed /usr/bin --verbose -eu 'quoted text' export export
+		| export local $(pwd) $(pwd) cd -eu
+	'quoted text' export ${HOME} "$@" "$1" 2>/dev/null readonly
+-eu grep /usr/bin done readonly then done awk | -eu 2>/dev/null 2>/dev/null $(pwd)
+then sed done export && local readonly local | && ${HOME} ${HOME} x=1 $(pwd) ${HOME}
+'quoted text' "$@" test --verbose printf local cd readonly awk ${HOME} "$1" "$@"
+		test done 'quoted text' "$@" "$@" printf printf
+		then "$@" sed echo echo 2>/dev/null test printf x=1 "$@" x=1 2>/dev/null printf
+	readonly | 2>/dev/null "$@" local --verbose 2>/dev/null
+		${HOME} test | && readonly
+		$(pwd) done sed done --verbose cd /usr/bin ${HOME} local awk --verbose
+local 'quoted text' 'quoted text'
+done 'quoted text' echo $(pwd)
+	/usr/bin grep readonly done "$1" 2>/dev/null
+		$(pwd) awk | ${HOME} --verbose /usr/bin ${HOME} done sed readonly awk --verbose
+	| "$@" | "$1" "$@" local "$@" then --verbose sed "$@" then --verbose sed x=1
+	cd printf cd 'quoted text'
+	test $(pwd) ${HOME} "$@"
+		grep readonly grep export grep printf 'quoted text' echo then test && "$1" then
+	| test ${HOME} -eu then "$1"
+	export 'quoted text' x=1 grep then test echo
+		/usr/bin "$1" printf export | sed -eu ${HOME}
+	export | export echo local export sed /usr/bin /usr/bin --verbose
+"$1" local printf --verbose 'quoted text'
+	"$@" echo /usr/bin cd && echo done "$1" then sed "$1" | then "$@" $(pwd) test |
+	'quoted text' export then export export /usr/bin
+		$(pwd) printf then printf cd grep export
+		done cd cd cd done grep readonly "$1" export && 2>/dev/null readonly
+		-eu 2>/dev/null sed local echo ${HOME} export test -eu --verbose export
+		--verbose export local printf local test readonly && sed awk "$1"
+then export "$@" $(pwd) --verbose sed local grep 'quoted text' test "$@"
+$(pwd) local "$1" /usr/bin
+		awk awk test printf "$1" done done -eu local export "$1" test "$@"
+	'quoted text' $(pwd) local 2>/dev/null 2>/dev/null cd 'quoted text' --verbose
+		&& "$1" -eu | awk x=1 echo done && && test export x=1 | export
+	x=1 -eu then 2>/dev/null export cd x=1 cd /usr/bin $(pwd) /usr/bin
+$(pwd) | "$1" local awk test -eu sed export
+local done ${HOME} 'quoted text' "$1"
+		awk -eu printf done 'quoted text'
+export local && "$@" "$1" 2>/dev/null ${HOME} grep printf --verbose
+		awk --verbose done export grep && awk "$@" /usr/bin test -eu "$1"
+echo export local then 2>/dev/null -eu 2>/dev/null
+		done grep 'quoted text' x=1 && grep "$1" sed printf awk $(pwd)
+printf && -eu "$1" /usr/bin export cd ${HOME} /usr/bin
+-eu | ${HOME} sed && done --verbose 2>/dev/null $(pwd) cd
+${HOME} cd readonly "$1" then ${HOME} 2>/dev/null 2>/dev/null then
+-eu awk /usr/bin cd ${HOME} 2>/dev/null printf "$@" export awk sed 2>/dev/null ${HOME}
+echo $(pwd) test then /usr/bin
+	cd ${HOME} "$@" ${HOME} "$@" "$1" $(pwd) then && readonly readonly | /usr/bin
+--verbose -eu test done 2>/dev/null test 2>/dev/null
+		${HOME} | ${HOME} export printf grep
+		$(pwd) local grep test |
+		x=1 && printf readonly --verbose
+	--verbose readonly awk export then | | done test readonly
+	--verbose export export 2>/dev/null --verbose ${HOME} printf "$@" --verbose
+then --verbose local readonly 'quoted text'
+local printf && local ${HOME} printf 2>/dev/null $(pwd)
+	export && test && export "$@" then /usr/bin
+"$1" grep sed && printf 2>/dev/null | done readonly --verbose 2>/dev/null
+		readonly test sed export 'quoted text'
+		| local 'quoted text' 'quoted text' && done $(pwd) readonly done
+done "$1" -eu ${HOME} sed /usr/bin 2>/dev/null
+| | done done test test | local export grep |
+done cd done ${HOME} awk echo grep sed export cd | local /usr/bin
+	test /usr/bin "$@" 2>/dev/null test 2>/dev/null
+		| cd sed "$@" --verbose done 2>/dev/null --verbose
+done sed test /usr/bin $(pwd) | 2>/dev/null printf && sed awk cd 'quoted text'
+	awk $(pwd) "$@" local && --verbose local | test then 'quoted text' && /usr/bin
+grep awk /usr/bin cd -eu -eu export ${HOME} grep "$1"
+		sed ${HOME} x=1 --verbose
+	awk echo grep $(pwd) && then
+		printf | awk 2>/dev/null grep /usr/bin done test
+x=1 ${HOME} | "$@" done
+test "$1" export "$1" test export done printf done grep "$1" awk
+| local $(pwd) $(pwd) 2>/dev/null echo done readonly x=1 -eu export
+		done -eu printf x=1 -eu local echo sed --verbose
+		grep -eu echo "$1" 2>/dev/null
+		'quoted text' grep 'quoted text' readonly 'quoted text' grep
+		sed echo --verbose ${HOME} 'quoted text' -eu test $(pwd) --verbose
+sed /usr/bin local --verbose local ${HOME}
+		$(pwd) cd && cd sed --verbose awk echo test && /usr/bin --verbose
+	cd readonly done /usr/bin ${HOME} /usr/bin --verbose --verbose export x=1 cd
+	/usr/bin ${HOME} /usr/bin export printf printf sed export
+		export x=1 export "$1" x=1 export -eu $(pwd) cd
+done cd 'quoted text' awk
+'quoted text' cd then 'quoted text' 'quoted text' awk awk ${HOME}
+	--verbose sed cd sed "$1" export && -eu done --verbose &&
+	test "$1" "$1" -eu -eu
+	then && printf export test -eu "$1" test x=1
+	done --verbose sed printf
+	echo done /usr/bin x=1
+	then then echo "$1" | --verbose export /usr/bin readonly --verbose | grep
+readonly awk local | 2>/dev/null readonly
+	test cd done ${HOME} $(pwd) awk 2>/dev/null grep
+		2>/dev/null printf | cd awk
+	x=1 "$1" test /usr/bin 'quoted text' 'quoted text' test echo echo $(pwd)
+		&& grep grep && done --verbose 'quoted text' $(pwd) cd --verbose
+		'quoted text' 'quoted text' "$@"
+		sed then --verbose local ${HOME} cd $(pwd) 'quoted text' printf
+done echo 'quoted text' done /usr/bin "$@" 'quoted text' $(pwd)
+		printf --verbose ${HOME} echo export "$1" ${HOME} cd then sed
+	local 'quoted text' test x=1 then echo --verbose -eu echo "$1" "$1" done
+	2>/dev/null awk cd printf
+test ${HOME} test export 2>/dev/null export export 2>/dev/null readonly x=1
+		readonly --verbose printf $(pwd) "$1" done
+	sed x=1 printf awk -eu done printf && -eu | /usr/bin
+		export | test | local local test done echo done local 'quoted text' &&
+		2>/dev/null done then printf export x=1 | done x=1 2>/dev/null test
+--verbose /usr/bin local | readonly sed local ${HOME} | then then then 2>/dev/null
+		local ${HOME} sed readonly export export readonly /usr/bin ${HOME}
+/usr/bin 'quoted text' export grep && sed printf /usr/bin cd done export
+		${HOME} --verbose "$1" local -eu readonly 2>/dev/null echo local 2>/dev/null |
+		echo echo test grep --verbose "$1" export "$@" ${HOME}
+sed x=1 test && grep 'quoted text' "$@"
+		grep ${HOME} -eu /usr/bin cd -eu cd awk then --verbose sed readonly
+&& 'quoted text' 'quoted text'
+'quoted text' && sed sed awk 'quoted text' then && "$1"
+| cd cd | sed echo --verbose && --verbose test
+	sed && 'quoted text' 'quoted text' "$@" awk ${HOME} "$@" export
+	done $(pwd) local printf test readonly "$1" --verbose done
+	x=1 $(pwd) ${HOME} export printf "$1" ${HOME} && 'quoted text' grep | x=1 done -eu
+	&& 'quoted text' /usr/bin grep echo export
+$(pwd) 2>/dev/null /usr/bin sed 'quoted text' sed sed sed test ${HOME} readonly
+	awk $(pwd) printf test done test --verbose sed printf
+&& done echo && "$@" ${HOME} ${HOME} readonly test echo awk echo sed "$1" cd cd
+	-eu && then cd 'quoted text' 'quoted text' cd export $(pwd) | && local ${HOME}
+	local $(pwd) readonly "$1" then $(pwd) ${HOME} "$1"
+	grep echo printf cd grep ${HOME}
+2>/dev/null /usr/bin | && 2>/dev/null |
+"$@" then /usr/bin --verbose "$1"
+	2>/dev/null echo awk done && readonly awk --verbose echo
+		cd ${HOME} test 2>/dev/null
+		--verbose -eu --verbose cd then /usr/bin
+	grep grep "$1" test /usr/bin export
+grep "$1" local 'quoted text' | then "$@" "$@" grep "$1" export export /usr/bin
+		/usr/bin x=1 $(pwd) | local echo "$1" test
+		then -eu then local cd sed awk x=1 2>/dev/null x=1 x=1 readonly export done test
+	then 'quoted text' readonly -eu /usr/bin ${HOME} readonly then readonly
+	sed x=1 && ${HOME} 'quoted text' "$@" local ${HOME} "$1" echo
+		printf export -eu ${HOME} awk readonly echo /usr/bin "$1"
+readonly 'quoted text' awk local
+		echo --verbose readonly x=1 "$@" --verbose
+${HOME} local x=1 grep
+$(pwd) && ${HOME} "$@" && 'quoted text' "$@" --verbose $(pwd) "$1" grep "$1"
+/usr/bin cd "$@" then "$1" echo
+		| --verbose test -eu --verbose 'quoted text' done cd /usr/bin "$@" readonly
+"$1" -eu cd "$1" local local "$1" echo --verbose
+	'quoted text' --verbose "$1" && 2>/dev/null 'quoted text' "$@" done then 2>/dev/null
+	sed ${HOME} /usr/bin /usr/bin /usr/bin && x=1 local && $(pwd)
+	$(pwd) sed export then grep "$@" ${HOME} cd | "$1" ${HOME} export cd export
+	--verbose -eu "$@" "$1" printf grep test "$@" test x=1 awk -eu $(pwd) -eu printf
+	local readonly export cd cd then
+x=1 "$@" x=1 -eu printf ${HOME} test done && /usr/bin $(pwd)
+sed /usr/bin "$1" readonly && 2>/dev/null -eu x=1 &&
+	/usr/bin echo echo export
+		-eu /usr/bin $(pwd) "$@" && then then 2>/dev/null 'quoted text' ${HOME}
+		echo --verbose export
+$(pwd) "$1" grep 2>/dev/null 2>/dev/null 2>/dev/null
+2>/dev/null 'quoted text' export echo then done 'quoted text'
+	local $(pwd) "$@" --verbose grep
+grep then /usr/bin printf $(pwd) ${HOME} local $(pwd) echo --verbose x=1 done sed
+		&& ${HOME} -eu cd cd sed then done printf
+	sed x=1 done x=1 sed $(pwd) awk
+		then test 2>/dev/null test -eu 2>/dev/null grep sed done
+		'quoted text' ${HOME} "$@" --verbose readonly $(pwd) $(pwd) -eu cd 'quoted text'
+	test echo 2>/dev/null x=1 $(pwd) awk $(pwd) export 2>/dev/null
+	'quoted text' grep "$@" | /usr/bin && then "$1" "$@" /usr/bin
+		test ${HOME} "$1" ${HOME} test
+export awk --verbose -eu "$1" $(pwd) export -eu cd test awk export && then
+		printf sed readonly done && /usr/bin ${HOME} then then printf local -eu --verbose
+	printf ${HOME} x=1 export
+		export 2>/dev/null sed readonly
+		export echo awk --verbose then
+then 'quoted text' echo test x=1 | echo grep | grep readonly
+	echo echo "$1" /usr/bin export
+		"$1" | cd echo "$@" | readonly done | 2>/dev/null
+		printf then awk -eu then printf
+--verbose awk "$@" cd --verbose 2>/dev/null awk 2>/dev/null ${HOME} "$1" |
+$(pwd) test test readonly done "$1" "$1"
+cd 2>/dev/null | "$1" printf 2>/dev/null "$@" | /usr/bin printf "$1" | $(pwd)
+$(pwd) cd grep --verbose 'quoted text' grep -eu grep
+grep "$@" grep echo done ${HOME}
+sed test readonly grep then then export 2>/dev/null ${HOME} 2>/dev/null
+local grep grep --verbose | grep
+		done awk grep awk export "$1" cd then test -eu --verbose
+		-eu printf 'quoted text' cd /usr/bin --verbose readonly then
+'quoted text' test grep grep x=1 export
+	awk local grep local printf echo | "$@" | local "$@"
+	&& "$@" printf sed 2>/dev/null -eu local ${HOME} done /usr/bin then -eu
+	cd echo --verbose local printf /usr/bin printf && /usr/bin cd printf
+		/usr/bin grep readonly cd "$@"
+| 2>/dev/null "$1" printf 'quoted text' done --verbose printf sed | readonly
+$(pwd) ${HOME} | | done done printf export
+	done $(pwd) x=1 awk ${HOME} grep readonly echo grep -eu
+	'quoted text' cd printf 'quoted text'
+	&& printf done 2>/dev/null
+		sed readonly "$1" sed 'quoted text' grep then 2>/dev/null "$@" export sed local
+		then readonly cd grep printf | grep 2>/dev/null readonly
+readonly "$@" /usr/bin --verbose test
+	${HOME} 'quoted text' local sed 'quoted text'
+echo then /usr/bin readonly cd ${HOME} export then printf
+	awk 2>/dev/null "$1" local && local --verbose local export cd export | $(pwd)
+done "$1" export ${HOME} -eu cd && then done -eu
+	| export "$1" local "$@" then done "$1" $(pwd) echo ${HOME} $(pwd) ${HOME} "$@"
+"$@" awk 'quoted text' && sed $(pwd) && done readonly "$1" x=1 awk x=1 test then
+		${HOME} readonly "$@" 2>/dev/null sed 2>/dev/null printf printf $(pwd)
+		sed x=1 --verbose ${HOME} x=1 | cd done grep ${HOME}
+	"$1" --verbose "$1" awk 2>/dev/null then
+		2>/dev/null --verbose readonly cd
+		| $(pwd) $(pwd) grep then /usr/bin "$@" && grep awk "$1" ${HOME}
+2>/dev/null sed sed && $(pwd) readonly echo
+local then echo local
+$(pwd) cd sed /usr/bin done done local readonly | export 2>/dev/null
+		cd readonly $(pwd) readonly printf "$1" readonly then "$@" $(pwd)
+		done $(pwd) -eu 'quoted text' grep && "$@" -eu test
+		--verbose && x=1 local cd awk local done $(pwd) echo
+	cd test cd -eu x=1 readonly
+		echo && then "$1" readonly -eu done cd "$@"
+		printf readonly | echo echo 2>/dev/null ${HOME} local 'quoted text' printf
+cd $(pwd) x=1 local readonly -eu "$1" readonly awk cd &&
+	echo echo local readonly ${HOME}
+readonly 'quoted text' 'quoted text' export "$1" x=1 printf $(pwd)
+readonly | 'quoted text' cd && cd "$1" $(pwd)
+		2>/dev/null export local ${HOME} then done export x=1 'quoted text' readonly test
+	cd ${HOME} x=1 "$1" export done x=1 readonly
+	x=1 && sed "$@" echo 'quoted text' printf echo 2>/dev/null ${HOME} ${HOME}
+	&& "$1" done printf "$@" 'quoted text'
+		echo x=1 ${HOME} then test -eu x=1 && 'quoted text'
+${HOME} echo 2>/dev/null awk /usr/bin
+awk cd | export "$@" "$@" done awk grep test cd 2>/dev/null "$1" local
+${HOME} ${HOME} ${HOME} "$1" grep sed $(pwd) x=1 "$@"
+		| test sed sed 'quoted text' test "$@" "$@" export /usr/bin grep 'quoted text'
+		'quoted text' $(pwd) awk --verbose
+done test local x=1 printf cd local && echo export x=1 x=1 | export
+	${HOME} && "$1" --verbose then $(pwd) | grep export cd export | printf
+		/usr/bin printf -eu awk /usr/bin echo "$@" readonly test
+	printf cd export "$@" x=1 "$1" sed printf /usr/bin 2>/dev/null
+done then $(pwd) 2>/dev/null /usr/bin export "$1" awk readonly printf awk
+		test "$1" test grep then -eu "$@" && 'quoted text'
+		&& sed -eu "$1" x=1 test ${HOME} "$1" awk && --verbose
+		cd printf then local | readonly test /usr/bin awk readonly test awk 'quoted text'
+| -eu 'quoted text' export ${HOME} -eu printf "$@" ${HOME} 'quoted text'
+	| && then x=1 test 'quoted text' test 2>/dev/null
+		$(pwd) printf && --verbose readonly 'quoted text' local 2>/dev/null done --verbose
+${HOME} && && export grep echo local "$1" x=1 &&
+		"$@" test /usr/bin "$1" awk 'quoted text' 'quoted text' -eu done
+		sed cd echo sed local local --verbose
+-eu -eu readonly | grep export "$1" 'quoted text' 'quoted text'
+	${HOME} /usr/bin ${HOME} "$1" 2>/dev/null x=1 local local --verbose
+		2>/dev/null "$@" awk readonly 'quoted text' grep -eu 'quoted text'
+	echo /usr/bin cd /usr/bin printf local
+grep done cd grep | x=1 2>/dev/null cd awk test ${HOME} 2>/dev/null
+		${HOME} printf --verbose 'quoted text' 2>/dev/null
+	export | echo --verbose "$@" readonly grep then
+"$@" printf | 2>/dev/null
+grep "$1" ${HOME} ${HOME} export export 2>/dev/null awk test 2>/dev/null then
+	&& | then 2>/dev/null 2>/dev/null cd done done
+	/usr/bin grep "$1" -eu -eu done ${HOME} /usr/bin done done cd awk x=1 "$@" cd
+	&& done /usr/bin ${HOME} 2>/dev/null -eu local then /usr/bin sed
+echo local echo test x=1 test
+"$1" "$@" grep /usr/bin grep cd
+		cd test $(pwd) "$@" local -eu readonly | sed "$@"
+		readonly 'quoted text' then sed printf ${HOME} "$1" sed echo
+	awk 'quoted text' 'quoted text'
+	"$1" done done ${HOME} ${HOME} $(pwd) local printf
+	done -eu 'quoted text' 'quoted text'
+	awk /usr/bin && -eu "$@" /usr/bin "$@"
+	| "$@" "$1" $(pwd) | echo grep export readonly ${HOME} cd 'quoted text' echo
+	--verbose 2>/dev/null grep
+sed 'quoted text' 'quoted text' test "$@" && printf 2>/dev/null
+		| && -eu local ${HOME} test 2>/dev/null sed
+export --verbose done grep /usr/bin && 2>/dev/null --verbose cd readonly
+	${HOME} awk awk grep x=1 sed done 'quoted text' --verbose done
+		/usr/bin -eu readonly $(pwd) cd done grep export
+${HOME} then && 'quoted text' test $(pwd) $(pwd) "$1" local export
+	/usr/bin then "$1" echo cd x=1 local x=1
+	test done awk ${HOME} echo local "$1" grep local 'quoted text' x=1 test sed
+		cd local $(pwd) cd test /usr/bin
+	awk -eu echo awk "$@"
+	test echo done --verbose 'quoted text' 'quoted text' | /usr/bin && echo
+| printf 2>/dev/null x=1 $(pwd) local printf sed printf 'quoted text'
+printf local && cd ${HOME} done sed echo
+	"$@" export "$1" done ${HOME} x=1 2>/dev/null "$@" && "$1" $(pwd) readonly
+		"$1" then -eu sed echo $(pwd) -eu --verbose
+		awk 2>/dev/null export -eu
+	awk 'quoted text' 'quoted text' cd sed
+	'quoted text' cd /usr/bin && 'quoted text' sed local readonly --verbose
+		'quoted text' test awk -eu printf test sed | 'quoted text' && printf 'quoted text'
+&& 2>/dev/null x=1 ${HOME} --verbose
+'quoted text' done awk echo -eu /usr/bin awk
+	${HOME} && local sed echo | awk --verbose -eu then ${HOME} then
+		sed -eu $(pwd) cd then -eu --verbose -eu echo done
+		sed export | done && then $(pwd) x=1 local echo "$@" export "$@"
+$(pwd) "$1" local awk local done
+		readonly sed | --verbose | export /usr/bin 'quoted text' echo then $(pwd)
+		/usr/bin then | ${HOME} done readonly export cd
+${HOME} cd $(pwd) test awk done
+		readonly echo "$@" "$@" local
+	${HOME} -eu --verbose -eu echo && done printf --verbose printf grep sed 'quoted text'
+2>/dev/null "$1" printf 'quoted text' grep /usr/bin x=1 readonly echo then "$1"
+		then x=1 -eu ${HOME} $(pwd) --verbose done 2>/dev/null
+		$(pwd) "$1" | echo $(pwd) "$@" x=1 -eu local
+		2>/dev/null -eu cd --verbose && then
+awk 2>/dev/null test local x=1 sed &&
+grep grep | $(pwd) done sed "$1" printf "$1" 2>/dev/null done "$@" 2>/dev/null
+done -eu --verbose echo test 'quoted text' | export then
+		$(pwd) --verbose sed grep readonly --verbose "$1" local
+grep sed printf grep awk awk x=1 --verbose 2>/dev/null
+local /usr/bin test sed /usr/bin
+	export "$1" readonly ${HOME} $(pwd) | done readonly /usr/bin
+		test 2>/dev/null ${HOME} grep 2>/dev/null 'quoted text' local 2>/dev/null export
+then /usr/bin echo echo readonly test "$@" x=1 /usr/bin /usr/bin printf | local
+		| grep 'quoted text' export grep x=1 sed awk then ${HOME}
+awk cd awk export done cd
+awk "$1" sed $(pwd) | x=1 "$1" 2>/dev/null --verbose printf awk cd local $(pwd)
+		x=1 && | ${HOME} then /usr/bin export readonly
+		$(pwd) awk local $(pwd) && cd --verbose x=1
+cd local $(pwd) x=1 ${HOME} --verbose $(pwd) test "$@" cd sed test /usr/bin
+| --verbose done "$1" grep local
+	/usr/bin ${HOME} && | test -eu test printf
+	echo local "$1" cd echo local cd test
+awk cd -eu | x=1 -eu printf readonly printf "$@" "$@" done && sed local test awk
+		done --verbose test local echo $(pwd) -eu sed --verbose sed --verbose /usr/bin
+		-eu && local 2>/dev/null -eu echo awk sed readonly 2>/dev/null
+"$@" test printf ${HOME} sed ${HOME} export
+	sed 2>/dev/null awk local 'quoted text' cd awk "$1"
+		printf local local -eu | ${HOME} ${HOME} cd 'quoted text' local $(pwd)
+		local cd test echo ${HOME} export --verbose | $(pwd) && $(pwd) echo echo && $(pwd)
+x=1 "$@" /usr/bin done
+"$1" export printf "$@" done 2>/dev/null $(pwd) $(pwd)
+	local test printf "$1" local readonly printf ${HOME} readonly then -eu sed readonly
+echo 2>/dev/null 2>/dev/null local "$@" sed local --verbose
+&& sed then -eu done ${HOME} | readonly x=1 export -eu done
+	/usr/bin ${HOME} 'quoted text' 'quoted text' cd done && cd export sed x=1
+	grep test printf then test && readonly 'quoted text' local grep done test "$@"
+		then export readonly $(pwd) grep then $(pwd) echo x=1 done awk
+		local x=1 /usr/bin && export "$1" && awk ${HOME} readonly done awk -eu echo grep
+sed then 'quoted text' echo done sed then |
+x=1 ${HOME} then 2>/dev/null && "$1" ${HOME} local "$@" ${HOME} --verbose
+	2>/dev/null readonly | echo done printf x=1 cd echo test 'quoted text'
+		grep $(pwd) readonly then $(pwd) | "$@" -eu $(pwd) done && | "$1" cd
+	export done export $(pwd) 'quoted text' /usr/bin sed 'quoted text' grep "$@"
+-eu "$@" local -eu "$@" echo export | | grep $(pwd) "$@" "$@"
+	cd then $(pwd) "$1" grep sed awk test --verbose "$1" /usr/bin
+		2>/dev/null then readonly sed grep sed $(pwd) export -eu local cd cd done "$1"
+		then | $(pwd) then local echo grep --verbose
+	sed awk $(pwd) | awk $(pwd) x=1 | awk $(pwd) done && sed
+grep test local ${HOME} cd "$@" printf && /usr/bin done test local $(pwd)
+		-eu echo | readonly && cd $(pwd) local echo x=1 local grep
+	'quoted text' export echo --verbose 'quoted text'
+local grep cd /usr/bin /usr/bin 2>/dev/null $(pwd) echo grep
+'quoted text' "$1" sed
+	readonly x=1 -eu -eu -eu sed export export awk test test grep sed printf --verbose
+		done && then readonly echo printf "$@"
+	printf | 'quoted text' export printf
+test local readonly "$1"
+		'quoted text' | export echo -eu then x=1 sed test export export done 2>/dev/null
+$(pwd) echo done done test printf export
+2>/dev/null readonly $(pwd) sed ${HOME} /usr/bin 'quoted text'
+	grep ${HOME} export awk sed echo -eu echo
+		&& 'quoted text' echo ${HOME} local
+	grep readonly | && echo awk "$1" "$1" echo /usr/bin 'quoted text'
+printf cd printf awk sed readonly -eu "$1" readonly
+		echo grep "$@" sed then export local && grep echo x=1 --verbose $(pwd) local cd
+x=1 awk readonly --verbose | -eu x=1 grep 'quoted text' readonly
+sed && local $(pwd) done $(pwd) cd test grep export "$1" -eu printf printf
+		/usr/bin x=1 --verbose awk $(pwd) "$@" grep
+echo ${HOME} export 'quoted text' local export --verbose then
+	x=1 'quoted text' grep && 2>/dev/null readonly $(pwd) 2>/dev/null
+'quoted text' 2>/dev/null echo 2>/dev/null sed then cd &&
+local "$@" && grep -eu && test echo local --verbose awk 'quoted text' grep test
+		printf | $(pwd) awk /usr/bin
+readonly 'quoted text' /usr/bin "$1" | && --verbose printf
+		grep "$1" done grep awk export done 'quoted text' ${HOME}
+-eu ${HOME} done grep readonly x=1 test --verbose grep -eu && $(pwd)
+	"$1" cd -eu sed ${HOME} awk
+	/usr/bin test -eu printf "$@" $(pwd) /usr/bin
+		done "$1" x=1 export 'quoted text' "$1"
+-eu /usr/bin then then printf 'quoted text'
+echo --verbose x=1 readonly export "$@" -eu && readonly printf -eu export && &&
+		local $(pwd) then then awk sed sed done | --verbose sed cd grep grep --verbose
+local /usr/bin grep printf --verbose
+sed done 2>/dev/null grep
+		sed "$@" && test readonly $(pwd) test x=1 local 2>/dev/null grep sed
+	&& grep $(pwd) local "$1" && printf --verbose --verbose done
+		-eu x=1 "$@" sed readonly /usr/bin ${HOME} awk local then "$1" 2>/dev/null
+test grep local printf -eu readonly -eu $(pwd) 2>/dev/null
+sed echo 'quoted text' printf x=1
+	--verbose x=1 cd /usr/bin "$@" grep test "$@" done /usr/bin ${HOME} export sed
+/usr/bin echo then && grep
+cd /usr/bin --verbose /usr/bin printf --verbose 2>/dev/null
+grep x=1 -eu test -eu
+export readonly cd "$1" echo 'quoted text' -eu /usr/bin /usr/bin
+	local 'quoted text' export done
+	| 'quoted text' | local --verbose --verbose | --verbose printf
+		local "$@" --verbose done printf x=1 sed test grep done ${HOME}
+	x=1 printf awk local -eu | ${HOME} 2>/dev/null | printf cd $(pwd)
+grep then awk test awk readonly "$@" $(pwd) --verbose x=1
+	$(pwd) ${HOME} -eu && sed x=1 printf export -eu && --verbose test
+$(pwd) cd then then local export "$1" echo --verbose
+	awk local test readonly |
+		/usr/bin x=1 && --verbose 2>/dev/null
+		then local echo test /usr/bin
+done ${HOME} echo && export x=1
+export 2>/dev/null --verbose local printf grep
+&& $(pwd) local done printf ${HOME} | /usr/bin /usr/bin -eu $(pwd) sed then done
+export readonly x=1 | "$1"
+test export printf -eu local x=1 x=1 local readonly done x=1 -eu done
+		"$1" cd sed && printf test then
+		${HOME} --verbose readonly
+"$@" ${HOME} "$1" /usr/bin sed cd readonly /usr/bin
+	-eu -eu awk then export printf ${HOME} printf sed 2>/dev/null ${HOME}
+	local printf /usr/bin /usr/bin
+		grep cd "$@" local done awk
+'quoted text' 'quoted text' done | export readonly export | /usr/bin
+		cd then awk awk 2>/dev/null export readonly echo test awk --verbose
+		cd local $(pwd) sed && 'quoted text'
+$(pwd) readonly grep -eu grep cd x=1 "$@" | /usr/bin x=1 'quoted text'
+| /usr/bin export cd 'quoted text' echo cd && test echo ${HOME}
+		x=1 export "$@" | echo -eu /usr/bin "$@" 2>/dev/null export export 2>/dev/null sed
+"$@" sed awk local printf awk printf then ${HOME} readonly 2>/dev/null
+	grep x=1 echo x=1 done -eu printf echo local printf printf echo sed 'quoted text'
+	grep x=1 && x=1 then
+		printf | "$1" echo | readonly "$@" "$@" ${HOME} && -eu echo -eu printf
+--verbose ${HOME} grep
+	grep -eu done $(pwd) awk "$1" cd printf | local cd 'quoted text' test
+	&& "$1" then --verbose awk readonly local grep 2>/dev/null -eu
+	sed local && readonly && ${HOME} test ${HOME}
+	cd | echo /usr/bin local ${HOME}
+test | | ${HOME} echo then /usr/bin $(pwd) done && grep grep | done
+--verbose then | local local $(pwd) awk "$1"
+	local readonly sed then ${HOME} test x=1 grep echo x=1 /usr/bin printf 2>/dev/null
+		| -eu | sed x=1 cd $(pwd)
+	"$@" && printf export awk ${HOME} /usr/bin "$@" "$1" "$@" && | grep then
+		cd awk $(pwd) export done awk 'quoted text' then $(pwd) ${HOME} -eu /usr/bin export
+test awk echo 'quoted text' && printf then ${HOME} printf done
+	then printf $(pwd) cd && -eu ${HOME} "$1" local sed && /usr/bin local
+		local 'quoted text' 'quoted text' sed sed test done /usr/bin ${HOME}
+		'quoted text' grep echo $(pwd) then export awk --verbose 'quoted text' awk
+"$1" 'quoted text' then printf
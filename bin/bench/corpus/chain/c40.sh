@@ -0,0 +1,2001 @@
+test grep readonly echo export 'quoted text'
+grep --verbose test | awk done cd export done --verbose
+		echo --verbose x=1 "$1" -eu then "$1" x=1 2>/dev/null x=1 ${HOME}
+		${HOME} awk /usr/bin 'quoted text' awk cd cd export 2>/dev/null
+	"$@" -eu local ${HOME} ${HOME}
+		$(pwd) test test "$1" done echo $(pwd) 2>/dev/null export sed "$@" "$@" grep done
+		readonly x=1 'quoted text' "$@" local && ${HOME}
+		grep --verbose && then && 'quoted text'
+		2>/dev/null "$@" "$1" echo --verbose
+	-eu done "$1" "$1" $(pwd) then export printf readonly local "$1" echo "$@"
+	printf --verbose 2>/dev/null /usr/bin | test then /usr/bin $(pwd)
+&& grep local ${HOME} 2>/dev/null
+		${HOME} ${HOME} $(pwd) sed local cd 2>/dev/null /usr/bin then ${HOME} echo
+--verbose "$1" cd export
+		"$1" readonly "$1" && /usr/bin
+		then sed sed export printf 2>/dev/null $(pwd)
+		test grep grep printf -eu | -eu awk | /usr/bin x=1 -eu "$@" readonly sed
+--verbose printf --verbose
+readonly "$1" && --verbose readonly cd awk --verbose printf awk
+		local ${HOME} cd cd "$1" echo readonly 2>/dev/null "$1" x=1 printf awk test /usr/bin
+	export $(pwd) && cd $(pwd) | ${HOME} test
+		-eu readonly awk then echo readonly grep
+	"$@" local && printf && $(pwd)
+		readonly echo $(pwd) test then cd -eu /usr/bin sed grep then grep
+		readonly then test 2>/dev/null --verbose test "$1" ${HOME} awk &&
+		--verbose | local $(pwd) && -eu "$@" x=1 then /usr/bin
+sed "$1" | ${HOME} cd sed | sed "$@" then test && test awk then
+readonly readonly cd export test | done ${HOME} x=1 cd --verbose
+-eu 'quoted text' cd printf 2>/dev/null grep
+	| done && | export printf grep
+/usr/bin test test sed test "$@" done 'quoted text'
+		--verbose "$1" | export -eu then -eu
+${HOME} echo awk 'quoted text'
+$(pwd) done local done && "$1" | /usr/bin
+echo 2>/dev/null sed /usr/bin x=1 done --verbose && "$1"
+test /usr/bin 'quoted text'
+		"$1" export "$@" | "$1" ${HOME} x=1 printf local ${HOME} | ${HOME} cd "$@" export
+		test echo printf "$@" export then then
+2>/dev/null ${HOME} cd then export ${HOME} /usr/bin 2>/dev/null $(pwd)
+sed local -eu /usr/bin local grep sed 2>/dev/null test 'quoted text'
+		-eu -eu echo 2>/dev/null /usr/bin "$1" ${HOME}
+		-eu echo sed echo | 2>/dev/null grep local readonly 2>/dev/null --verbose awk |
+		cd readonly --verbose "$1" && ${HOME} export $(pwd) grep grep x=1 printf
+		echo $(pwd) | 'quoted text' | "$1" local
+	cd x=1 cd export test --verbose | /usr/bin local printf echo test
+	"$@" --verbose sed done --verbose --verbose 'quoted text' $(pwd)
+awk grep 'quoted text' printf "$1" then x=1 test sed -eu then test
+	readonly printf 'quoted text' --verbose ${HOME}
+		sed ${HOME} | /usr/bin then "$1" | $(pwd) "$1" 'quoted text' &&
+--verbose echo --verbose printf ${HOME}
+		| 2>/dev/null /usr/bin 'quoted text' ${HOME} echo "$1" awk export | test
+-eu && then x=1 then grep done cd && local && awk export $(pwd) awk
+"$@" 2>/dev/null sed "$1" ${HOME} 2>/dev/null
+awk readonly 2>/dev/null local $(pwd) printf x=1 echo 'quoted text' ${HOME}
+	local 'quoted text' --verbose | | "$1"
+		echo sed grep grep export readonly $(pwd) grep -eu
+sed then printf --verbose --verbose
+		test /usr/bin --verbose
+	-eu 2>/dev/null "$@" local test --verbose "$1" test $(pwd) readonly
+		"$@" 'quoted text' "$@" test x=1 done x=1 export $(pwd) ${HOME} awk done "$1" readonly
+	grep 2>/dev/null then awk x=1 'quoted text' echo | --verbose readonly
+cd x=1 awk | cd ${HOME}
+		readonly local | /usr/bin
+	$(pwd) done | export && export x=1 && grep 2>/dev/null
+	sed grep ${HOME} awk done | grep readonly
+	"$@" local | ${HOME} then 'quoted text' then then
+| 2>/dev/null sed done x=1 | cd
+	awk && --verbose local cd then | "$1" "$1" "$@" printf | export
+	done printf | test 'quoted text'
+		cd $(pwd) "$1" printf
+		| --verbose "$1" printf local awk echo $(pwd) sed done
+		sed grep 'quoted text' then --verbose
+	awk cd grep -eu && echo grep /usr/bin export --verbose $(pwd) printf
+		&& "$1" test done export test "$@" "$1" export x=1 /usr/bin 2>/dev/null test
+'quoted text' && then local sed printf then x=1 printf printf | export x=1 grep
+	"$@" export readonly echo 'quoted text' "$1" $(pwd) local awk local
+		/usr/bin done -eu done -eu ${HOME} ${HOME}
+&& x=1 export local ${HOME} local $(pwd) 2>/dev/null x=1 sed && ${HOME} ${HOME}
+	&& export /usr/bin /usr/bin done test test | | readonly $(pwd) "$@" awk sed done
+		sed | 2>/dev/null printf -eu test sed | && cd grep "$@" echo x=1
+		-eu test awk test 2>/dev/null then /usr/bin grep awk then "$1" readonly
+		"$@" x=1 'quoted text' && grep echo "$1" export
+-eu 2>/dev/null "$1" "$@" ${HOME}
+	then cd x=1 done -eu printf -eu readonly 'quoted text' $(pwd) $(pwd) sed cd
+		readonly /usr/bin test && x=1 'quoted text' -eu done echo cd cd cd awk 2>/dev/null
+"$@" sed 2>/dev/null && test export local && --verbose 2>/dev/null test $(pwd)
+printf then sed --verbose 2>/dev/null awk "$@" then readonly
+echo $(pwd) test 2>/dev/null local export sed
+	'quoted text' 'quoted text' echo done 'quoted text' "$1" | grep x=1
+	awk local 'quoted text' ${HOME} cd test
+--verbose cd ${HOME} export done cd ${HOME} -eu test sed --verbose test /usr/bin
+		"$@" x=1 export | /usr/bin "$1" echo "$@" -eu "$@"
+	$(pwd) local then /usr/bin test cd x=1 "$1" 2>/dev/null --verbose x=1 local
+&& "$@" test --verbose | cd sed grep
+	awk "$@" "$@" done done --verbose 'quoted text'
+	export x=1 'quoted text' echo local
+	test "$1" then then printf readonly printf 2>/dev/null --verbose grep
+	'quoted text' awk | printf local x=1
+	| | -eu grep /usr/bin --verbose "$@" 'quoted text' | x=1 echo done then x=1 readonly
+local export "$@" grep readonly "$1" done then /usr/bin x=1 ${HOME}
+		echo export "$1" awk x=1
+&& x=1 printf sed -eu 2>/dev/null /usr/bin /usr/bin x=1 cd "$@"
+grep 2>/dev/null 'quoted text' export
+	$(pwd) then && "$1" then 2>/dev/null $(pwd) sed $(pwd) then ${HOME} ${HOME}
+export test printf done
+		"$1" awk && /usr/bin "$@" readonly
+		x=1 local then && --verbose sed sed readonly /usr/bin --verbose /usr/bin
+		readonly readonly done 2>/dev/null
+	cd 2>/dev/null $(pwd) $(pwd) awk "$1" printf $(pwd) /usr/bin ${HOME} awk -eu
+	-eu test "$1" /usr/bin --verbose
+	printf local /usr/bin ${HOME} 'quoted text' -eu 'quoted text'
+local "$@" --verbose done sed grep /usr/bin ${HOME} then /usr/bin
+		grep x=1 /usr/bin -eu "$1" --verbose cd readonly local echo $(pwd)
+	echo 2>/dev/null readonly -eu then grep "$1" printf && 2>/dev/null grep 'quoted text'
+	test then local test 2>/dev/null x=1 "$@" awk 2>/dev/null "$@" /usr/bin
+readonly x=1 ${HOME} cd "$1" 2>/dev/null
+		/usr/bin /usr/bin cd "$1" "$@" local
+then test $(pwd) && | export printf
+sed done then local cd --verbose
+test local "$@" local x=1
+awk -eu && x=1 printf $(pwd) test x=1 "$@"
+		'quoted text' readonly readonly ${HOME} export grep "$@"
+		done --verbose grep "$1" grep | cd cd && "$1" /usr/bin grep "$1" export 2>/dev/null
+	${HOME} | local grep -eu $(pwd) && ${HOME} | $(pwd) /usr/bin
+	test x=1 then awk then "$@"
+		local ${HOME} --verbose 'quoted text' grep grep 2>/dev/null printf echo
+		2>/dev/null $(pwd) && "$1" "$@" $(pwd) -eu 'quoted text'
+		cd | -eu awk "$@" "$@" x=1 done /usr/bin sed | then done echo sed
+"$@" "$@" | && export && x=1 done /usr/bin "$@" x=1
+'quoted text' -eu && -eu x=1 $(pwd) | readonly "$@"
+printf awk x=1 then printf readonly
+	printf x=1 ${HOME} export local --verbose && 2>/dev/null grep --verbose
+	readonly ${HOME} sed ${HOME} sed local -eu readonly export readonly ${HOME}
+export --verbose grep grep | awk test /usr/bin ${HOME} "$@" grep -eu x=1 x=1
+	x=1 x=1 ${HOME} && export /usr/bin /usr/bin cd | | /usr/bin 2>/dev/null
+"$1" readonly | export export "$1" awk $(pwd) 'quoted text'
+cd echo then awk printf --verbose
+echo $(pwd) | $(pwd) then readonly cd
+--verbose echo cd cd --verbose test "$@" readonly
+		--verbose "$@" awk done
+echo local | x=1 "$@" | | then echo ${HOME} cd printf -eu
+	sed grep export awk $(pwd) then printf $(pwd)
+		$(pwd) $(pwd) 'quoted text' x=1
+	awk sed "$@" then $(pwd) readonly x=1
+done 2>/dev/null --verbose cd -eu printf done sed test $(pwd) then
+		$(pwd) --verbose sed $(pwd) then readonly export "$@" done then --verbose echo
+		"$1" then 2>/dev/null | test test 2>/dev/null &&
+'quoted text' -eu export --verbose $(pwd) x=1 readonly printf grep 'quoted text'
+	${HOME} | export awk 'quoted text' --verbose
+--verbose 2>/dev/null -eu $(pwd) /usr/bin | 2>/dev/null done 2>/dev/null ${HOME}
+		| ${HOME} -eu 'quoted text'
+printf | ${HOME} echo $(pwd) 'quoted text'
+		| done x=1 awk && "$1" 2>/dev/null 'quoted text'
+	--verbose done echo export awk echo echo && then echo "$@" --verbose
+		'quoted text' local --verbose ${HOME} export export test sed sed echo
+		| cd --verbose awk x=1 ${HOME}
+x=1 "$1" local ${HOME} export --verbose --verbose awk readonly ${HOME} export
+		/usr/bin $(pwd) export -eu 'quoted text' --verbose "$1" x=1
+${HOME} | cd -eu $(pwd) -eu
+		/usr/bin sed 'quoted text' /usr/bin 'quoted text'
+&& cd x=1 | x=1 2>/dev/null && printf sed x=1 2>/dev/null done 'quoted text'
+	$(pwd) ${HOME} sed export then printf
+		/usr/bin done export -eu $(pwd)
+readonly grep 2>/dev/null test "$@" echo
+	test cd "$@" --verbose x=1 grep && cd echo "$@" x=1 | /usr/bin &&
+		| 2>/dev/null ${HOME} export
+		grep cd $(pwd) "$1" && $(pwd)
+	--verbose | awk then local 2>/dev/null 2>/dev/null printf 'quoted text' $(pwd)
+	cd -eu 'quoted text' $(pwd)
+	test readonly awk $(pwd) printf && | && ${HOME} ${HOME}
+	&& export x=1 'quoted text' echo 2>/dev/null test grep then
+	--verbose ${HOME} "$1" echo --verbose local then echo $(pwd)
+	"$@" && printf then 2>/dev/null 'quoted text' $(pwd) test
+		export sed "$1" $(pwd) $(pwd) cd && local
+	2>/dev/null /usr/bin cd "$1" cd echo echo
+	-eu then /usr/bin $(pwd) ${HOME} echo /usr/bin
+	2>/dev/null -eu "$1" 2>/dev/null "$1" 2>/dev/null
+grep then grep done grep
+x=1 awk sed then -eu && sed
+		/usr/bin printf sed | readonly local | awk export printf local
+${HOME} --verbose cd then $(pwd) readonly local sed && -eu echo sed
+	/usr/bin "$1" done /usr/bin readonly $(pwd) done "$1" awk local done | done
+	'quoted text' 2>/dev/null
+		${HOME} echo printf x=1 --verbose cd test echo --verbose x=1 local
+	$(pwd) export 2>/dev/null test cd $(pwd) grep awk x=1 /usr/bin printf
+	echo test grep && 2>/dev/null grep
+test $(pwd) export test test test /usr/bin
+export $(pwd) 2>/dev/null local local printf /usr/bin
+&& test export /usr/bin | printf 'quoted text' done x=1 'quoted text' x=1
+echo local --verbose export readonly grep cd -eu printf
+	"$@" cd /usr/bin local awk 'quoted text' "$1" x=1 printf
+	readonly awk $(pwd) --verbose done --verbose ${HOME}
+sed sed awk 2>/dev/null grep 'quoted text' $(pwd) x=1
+		sed && 2>/dev/null 'quoted text' ${HOME} export "$1" then /usr/bin
+		"$@" printf grep 'quoted text' /usr/bin local
+$(pwd) ${HOME} --verbose --verbose awk "$@" grep awk printf export
+	then test && then --verbose
+		export /usr/bin printf cd && cd
+		local "$1" sed 'quoted text' | "$@" readonly $(pwd) 2>/dev/null echo
+$(pwd) readonly sed | -eu -eu local local awk
+	test then echo /usr/bin | 2>/dev/null then grep awk x=1 x=1 local
+sed ${HOME} 'quoted text' grep local awk export
+	x=1 grep "$@" "$@" 2>/dev/null cd x=1 grep test test | $(pwd) && then "$@"
+"$@" && cd grep cd --verbose cd $(pwd) --verbose printf
+	2>/dev/null "$1" --verbose -eu 2>/dev/null
+	printf echo test x=1 sed local then x=1 readonly
+done x=1 --verbose /usr/bin
+echo export awk "$1" export
+--verbose readonly export printf $(pwd) x=1 /usr/bin done 2>/dev/null
+	2>/dev/null cd $(pwd) /usr/bin test
+	| cd grep | echo awk | /usr/bin readonly "$1" local &&
+		--verbose "$@" test export 'quoted text' sed "$@" grep | awk
+		printf echo ${HOME} done "$1" printf
+| cd x=1 $(pwd) done /usr/bin
+		grep printf grep | done export $(pwd) && readonly local awk test -eu export
+		"$@" readonly ${HOME} | export echo awk 2>/dev/null
+$(pwd) cd 'quoted text' x=1 $(pwd) printf "$1" 2>/dev/null
+grep 'quoted text' ${HOME} then export cd echo export
+local && then sed grep test "$1" 2>/dev/null
+	"$@" export grep "$1" 'quoted text' | then then && awk "$1" -eu then
+		awk ${HOME} export then readonly /usr/bin 'quoted text'
+		export --verbose echo && "$@" test grep "$@" && $(pwd) 2>/dev/null
+echo test export | awk 'quoted text'
+		awk then --verbose 2>/dev/null 2>/dev/null /usr/bin local then --verbose
+	test then | sed cd "$1" then ${HOME} local
+	${HOME} printf x=1 sed
+	printf && 'quoted text' then grep test "$1" 2>/dev/null awk printf 'quoted text'
+		$(pwd) /usr/bin local --verbose
+	local then sed grep local sed ${HOME} awk cd ${HOME} -eu -eu done -eu $(pwd)
+		awk "$1" done /usr/bin "$@" echo -eu awk then grep sed printf -eu "$@" /usr/bin
+	--verbose readonly cd export printf local /usr/bin | local sed then "$@" | export
+'quoted text' x=1 x=1 $(pwd) 'quoted text' done cd local
+		local grep readonly echo readonly test && readonly readonly
+/usr/bin cd then then | cd --verbose
+-eu sed printf done -eu 'quoted text' export done x=1 x=1 2>/dev/null x=1
+	"$1" local cd readonly readonly && --verbose 'quoted text'
+2>/dev/null then | $(pwd) then then echo
+		--verbose -eu -eu "$@" ${HOME} --verbose x=1 "$@" then done readonly
+	| test | readonly /usr/bin $(pwd) 2>/dev/null
+		then sed test | awk --verbose test "$1"
+	local echo printf 2>/dev/null awk then printf
+		printf printf -eu readonly && export $(pwd) done 2>/dev/null sed -eu
+		cd 2>/dev/null echo "$@" --verbose echo printf /usr/bin grep | awk done grep
+${HOME} grep sed 'quoted text' echo done "$@" echo awk -eu
+'quoted text' printf grep echo then test readonly
+	sed x=1 awk $(pwd) --verbose grep /usr/bin
+	$(pwd) | | done "$@" readonly -eu awk echo cd && awk awk
+	echo -eu printf /usr/bin x=1 'quoted text'
+	x=1 grep sed export "$1" printf "$@" x=1 'quoted text' sed && then grep grep
+${HOME} /usr/bin x=1 ${HOME} export
+		| test "$1" echo local awk $(pwd) test "$1" && test readonly
+	/usr/bin "$1" then printf
+/usr/bin $(pwd) test export local -eu export echo cd grep 2>/dev/null
+		grep | 'quoted text' grep cd awk grep
+		readonly -eu readonly test
+		export "$1" -eu | done readonly grep cd grep 'quoted text'
+	grep && "$@" echo printf
+		"$1" grep 'quoted text' --verbose cd then 2>/dev/null
+	-eu "$@" ${HOME} && sed --verbose sed -eu --verbose then ${HOME} cd
+		local echo /usr/bin -eu test then 2>/dev/null ${HOME}
+	--verbose -eu x=1 sed local cd ${HOME} test x=1 local readonly test
+	2>/dev/null export && -eu /usr/bin done 'quoted text'
+--verbose x=1 --verbose $(pwd) echo "$1" $(pwd) x=1 awk 'quoted text' cd &&
+	--verbose ${HOME} grep 'quoted text' && printf cd 'quoted text' grep grep
+| /usr/bin grep ${HOME} x=1 2>/dev/null local export
+"$@" 2>/dev/null grep 'quoted text'
+		test 'quoted text' -eu then "$1" awk done cd echo $(pwd) echo then printf 'quoted text'
+		"$1" ${HOME} awk sed $(pwd) awk | sed "$1" /usr/bin x=1
+readonly 2>/dev/null sed
+		x=1 awk readonly "$@" done $(pwd) printf
+	sed 'quoted text' awk local
+${HOME} local echo x=1 x=1 && then -eu test cd export cd test echo "$@" -eu
+cd $(pwd) "$@" then grep
+		readonly export export | export 2>/dev/null
+/usr/bin test echo --verbose test
+	local export test echo "$@" cd echo readonly $(pwd) echo ${HOME}
+$(pwd) readonly local -eu ${HOME} | local local $(pwd) printf grep
+		--verbose 2>/dev/null done 2>/dev/null printf
+		then printf ${HOME} "$1" printf /usr/bin && && "$@" 'quoted text' && 'quoted text'
+		"$1" echo ${HOME} x=1 awk ${HOME} done -eu sed cd "$@" | -eu && echo
+		$(pwd) && awk readonly ${HOME} --verbose 'quoted text' | 2>/dev/null
+	'quoted text' x=1 --verbose /usr/bin x=1 | readonly
+		printf -eu grep grep "$@" -eu then then
+	-eu --verbose 'quoted text' test 'quoted text'
+	"$1" --verbose "$@" --verbose awk x=1 echo
+		/usr/bin "$1" echo /usr/bin grep
+		export awk --verbose -eu done "$@" && grep "$1" 'quoted text'
+		sed "$1" cd printf && | && 2>/dev/null ${HOME} | sed "$1" local 2>/dev/null
+	2>/dev/null grep -eu awk -eu ${HOME} 2>/dev/null awk local "$1"
+${HOME} ${HOME} grep done /usr/bin sed | &&
+		/usr/bin sed readonly "$@" "$1"
+	cd sed readonly --verbose ${HOME} test ${HOME} done test then "$@" | printf then
+		echo /usr/bin 2>/dev/null -eu && test echo then done -eu 2>/dev/null --verbose
+	x=1 --verbose x=1 "$@" --verbose
+		sed done | awk 2>/dev/null "$1" | test sed cd --verbose done --verbose
+echo 'quoted text' ${HOME} local $(pwd) cd ${HOME} awk cd -eu printf export test
+	&& "$@" local sed /usr/bin awk readonly awk ${HOME} --verbose && echo grep grep
+	local /usr/bin readonly /usr/bin x=1 && $(pwd) $(pwd) cd ${HOME} sed readonly
+	sed sed test ${HOME} $(pwd) printf --verbose
+		${HOME} local 2>/dev/null echo $(pwd)
+--verbose export export ${HOME} cd "$1" --verbose
+		readonly cd $(pwd) sed
+readonly --verbose printf && test --verbose sed /usr/bin $(pwd)
+test readonly cd "$@" test echo 'quoted text'
+echo "$@" x=1 ${HOME} echo 'quoted text'
+		readonly -eu | cd test local
+	x=1 local echo then && $(pwd) "$@"
+	test /usr/bin echo --verbose 2>/dev/null $(pwd) done then local /usr/bin /usr/bin
+'quoted text' then done x=1
+	echo printf sed && -eu awk $(pwd) "$@" printf local awk
+printf 2>/dev/null -eu export test 'quoted text' sed | awk
+'quoted text' 'quoted text' 'quoted text' ${HOME} then /usr/bin "$@" ${HOME}
+		&& --verbose 2>/dev/null readonly -eu
+	grep sed && readonly echo echo 2>/dev/null then
+echo grep 'quoted text' awk
+		&& done | export grep 'quoted text' echo cd "$@" /usr/bin -eu 2>/dev/null
+	2>/dev/null x=1 'quoted text' cd local /usr/bin |
+	cd "$@" sed cd printf local local --verbose
+		/usr/bin /usr/bin | grep ${HOME} "$1" test x=1 test sed printf grep
+		readonly then awk "$1" "$1" then x=1 export "$@" then export "$@" 2>/dev/null
+$(pwd) /usr/bin "$1"
+		${HOME} then $(pwd) done -eu awk ${HOME} echo done cd -eu 2>/dev/null
+grep grep done | x=1 'quoted text'
+		| cd 'quoted text' local $(pwd) 'quoted text' echo /usr/bin
+		export sed && test ${HOME} | -eu ${HOME}
+	"$@" /usr/bin local "$1" cd "$1" echo /usr/bin printf echo
+	2>/dev/null "$1" test readonly done cd awk done echo then awk -eu echo
+		/usr/bin grep local ${HOME} cd printf test | "$@" -eu
+2>/dev/null $(pwd) sed
+		done "$@" echo local awk
+"$1" 2>/dev/null x=1 --verbose x=1 local sed "$@" x=1 readonly
+	echo echo && ${HOME} printf export | 2>/dev/null
+		/usr/bin | test awk -eu 'quoted text' echo && echo 'quoted text'
+	x=1 | -eu /usr/bin awk echo cd done sed grep x=1 done then
+	readonly /usr/bin cd ${HOME}
+	'quoted text' export 2>/dev/null then cd grep done readonly 'quoted text' 'quoted text'
+printf done /usr/bin echo local echo 'quoted text'
+sed $(pwd) cd export done x=1 grep -eu ${HOME} --verbose x=1 --verbose
+		printf /usr/bin printf cd $(pwd) "$@" ${HOME} x=1 test
+		readonly readonly "$@" export echo export local ${HOME} awk awk test 2>/dev/null
+	grep 2>/dev/null "$@" grep
+${HOME} awk 'quoted text' "$1" readonly cd export test --verbose x=1 ${HOME}
+/usr/bin echo 'quoted text' -eu "$1" | -eu export done -eu x=1 then done "$1"
+test | | export export 'quoted text'
+	printf sed 'quoted text' export | awk "$1" "$1" && -eu printf
+		cd sed "$1" "$1" echo cd done 2>/dev/null then export $(pwd) 'quoted text' sed
+cd /usr/bin readonly sed export | export
+	/usr/bin "$1" printf -eu $(pwd) sed | cd done ${HOME} done done
+--verbose done ${HOME} grep 2>/dev/null -eu 'quoted text'
+-eu cd && readonly -eu sed done
+	done export printf "$@" && "$1" | sed 'quoted text' local echo grep $(pwd) -eu
+	| echo test 'quoted text' echo local test
+		-eu cd --verbose -eu "$@" then echo then awk && 'quoted text'
+$(pwd) awk printf export "$@" x=1
+	$(pwd) 2>/dev/null test echo --verbose && cd --verbose then done ${HOME} /usr/bin
+export awk -eu x=1 -eu -eu printf printf /usr/bin cd | |
+		x=1 'quoted text' test done awk sed local /usr/bin 2>/dev/null
+test cd grep 2>/dev/null | 'quoted text'
+	${HOME} --verbose "$1" ${HOME} x=1 printf printf readonly
+		grep | ${HOME} && ${HOME} x=1 && 'quoted text'
+	export ${HOME} "$1" $(pwd) | cd -eu "$@" | ${HOME} ${HOME} | 'quoted text' 2>/dev/null
+done printf 'quoted text' "$1" | && awk awk echo printf
+"$1" awk local test sed x=1 grep && $(pwd)
+readonly printf ${HOME} done x=1 && grep --verbose ${HOME} export
+		cd export $(pwd) "$@" export echo
+		$(pwd) ${HOME} --verbose test
+"$1" sed sed | -eu grep test test sed sed --verbose printf ${HOME}
+	sed /usr/bin test x=1 $(pwd)
+echo "$@" x=1 --verbose x=1 ${HOME} done | 'quoted text'
+grep --verbose printf cd awk 2>/dev/null printf
+		${HOME} done done printf echo readonly ${HOME} -eu -eu x=1 grep
+	readonly -eu "$1" "$1" done test cd local | | &&
+		&& 'quoted text' grep readonly | "$@" echo done 'quoted text'
+		"$@" --verbose 2>/dev/null echo grep then export export && awk
+	-eu export | -eu awk done then
+	done test printf | sed then && "$1" done /usr/bin 'quoted text'
+	local 'quoted text' local cd local
+	cd printf && done "$1" x=1 $(pwd) test /usr/bin
+	"$1" sed 2>/dev/null then --verbose echo printf local test sed --verbose --verbose
+	awk "$@" then && cd readonly then cd
+		'quoted text' sed | $(pwd) --verbose /usr/bin 2>/dev/null done | printf
+$(pwd) 'quoted text' cd | cd "$@" --verbose readonly
+printf cd printf grep cd && 2>/dev/null
+		awk local cd x=1 printf 'quoted text' x=1 echo --verbose "$1"
+		2>/dev/null done "$1" ${HOME} x=1 done export readonly
+	-eu x=1 && readonly done export readonly local cd cd grep | --verbose awk cd
+"$@" ${HOME} "$1" cd /usr/bin awk -eu /usr/bin x=1
+/usr/bin 'quoted text' /usr/bin cd test -eu then x=1 "$1" "$@"
+		2>/dev/null /usr/bin readonly x=1 readonly -eu sed "$1" readonly readonly export
+		'quoted text' grep sed $(pwd) 2>/dev/null && then local -eu sed done printf printf
+		cd -eu x=1 x=1 done grep export grep 'quoted text' -eu readonly cd | sed -eu
+	"$1" 'quoted text' readonly -eu readonly done "$1" grep 'quoted text'
+	awk 'quoted text' "$1" "$1" echo then 'quoted text' -eu cd local
+grep done | then ${HOME} | grep cd x=1 echo
+	$(pwd) --verbose | printf local 2>/dev/null
+	local export | 2>/dev/null 'quoted text' "$@" done "$1" sed
+$(pwd) x=1 awk printf /usr/bin export readonly
+		&& grep sed x=1 'quoted text' echo $(pwd) "$@" test && --verbose ${HOME}
+		done echo done ${HOME} awk local
+	$(pwd) printf echo x=1 && /usr/bin 'quoted text' printf /usr/bin test 2>/dev/null
+		test then /usr/bin x=1 ${HOME} | local 2>/dev/null --verbose cd
+&& "$@" printf ${HOME} ${HOME} | readonly
+		cd /usr/bin done export 'quoted text'
+		done export "$1" awk $(pwd) sed ${HOME} -eu --verbose $(pwd) $(pwd)
+		export grep cd /usr/bin "$@" awk $(pwd) cd 2>/dev/null 2>/dev/null grep -eu
+		grep done awk | done sed cd sed "$1" cd -eu -eu -eu 2>/dev/null
+| $(pwd) ${HOME} done --verbose then && "$1" /usr/bin /usr/bin
+		echo "$1" 2>/dev/null --verbose printf | $(pwd) 'quoted text' test
+		grep test --verbose readonly ${HOME} --verbose | --verbose
+		grep readonly | echo then printf 2>/dev/null --verbose
+	x=1 cd "$1" awk readonly readonly 'quoted text' grep test
+		/usr/bin done done -eu then then export 2>/dev/null
+		test test -eu /usr/bin | awk -eu $(pwd) sed echo "$@" "$@" 2>/dev/null
+		sed readonly --verbose --verbose
+	&& echo -eu grep -eu 'quoted text'
+		--verbose 2>/dev/null awk readonly sed 'quoted text'
+cd test sed export done sed local && $(pwd) awk "$@" echo 2>/dev/null
+'quoted text' -eu /usr/bin
+	grep | -eu --verbose 'quoted text'
+--verbose test | local local printf echo grep export
+	export 'quoted text' sed export echo 'quoted text'
+		x=1 then done grep /usr/bin -eu 2>/dev/null
+awk "$1" printf then test
+	'quoted text' echo x=1 readonly sed x=1 ${HOME} export -eu grep grep printf
+&& "$@" readonly 2>/dev/null 'quoted text' ${HOME} /usr/bin x=1 awk -eu -eu
+	| test "$1" done --verbose test readonly 2>/dev/null printf
+		test /usr/bin $(pwd) | test /usr/bin | 'quoted text' /usr/bin $(pwd) 'quoted text'
+	'quoted text' ${HOME} test /usr/bin cd test cd grep
+2>/dev/null awk --verbose | && "$1" sed "$1" && | done test 2>/dev/null
+	readonly printf 2>/dev/null /usr/bin printf local export -eu $(pwd)
+	awk sed ${HOME} awk ${HOME}
+&& "$@" sed test -eu x=1 2>/dev/null /usr/bin awk "$1" --verbose
+		'quoted text' --verbose sed x=1 sed test printf 2>/dev/null printf
+	echo then readonly x=1 'quoted text' done done then export 'quoted text' export
+	${HOME} awk | | 2>/dev/null local $(pwd) /usr/bin $(pwd) export then
+2>/dev/null $(pwd) /usr/bin
+	x=1 sed then echo 2>/dev/null cd awk && "$@" sed echo 'quoted text' printf
+then 2>/dev/null 'quoted text' done grep 'quoted text' then ${HOME} then $(pwd)
+	then readonly x=1 echo
+		x=1 "$@" ${HOME} x=1 --verbose --verbose done test 'quoted text' then /usr/bin
+		-eu then "$@" "$@" awk test "$@" -eu -eu "$@" | "$@" export done awk "$@" x=1
+	printf /usr/bin grep 2>/dev/null
+	local | x=1 "$@" readonly local /usr/bin done --verbose local "$1" $(pwd)
+	"$@" | --verbose printf done
+x=1 export then "$@" x=1 'quoted text' ${HOME} awk && then --verbose 2>/dev/null
+	cd --verbose "$@" --verbose awk printf grep x=1 "$1" --verbose
+		&& done cd export export sed $(pwd) --verbose 2>/dev/null "$@"
+echo local awk ${HOME} printf 2>/dev/null sed echo 2>/dev/null "$@" cd export
+	x=1 x=1 && 'quoted text' -eu "$1" local -eu test ${HOME}
+grep | /usr/bin readonly 'quoted text'
+	| "$@" /usr/bin readonly echo local
+		export local x=1 cd done -eu x=1
+sed then -eu cd grep $(pwd)
+		echo printf | export ${HOME} | -eu done echo cd
+	x=1 local x=1 done $(pwd) --verbose --verbose x=1 --verbose -eu
+-eu awk echo test readonly "$1" echo ${HOME} "$@" grep --verbose
+	printf "$1" then ${HOME} $(pwd) | 'quoted text' | 'quoted text' && readonly
+done printf -eu grep export
+		awk cd 'quoted text'
+	readonly grep ${HOME} ${HOME} 2>/dev/null then export then "$1" export
+		sed printf | test export echo awk 'quoted text' ${HOME}
+		sed 2>/dev/null | "$@"
+		done awk x=1 printf grep
+	readonly 'quoted text' printf readonly test
+	export "$1" test 2>/dev/null grep && "$@"
+	/usr/bin $(pwd) "$1" cd echo ${HOME} -eu x=1 test "$1" sed
+	&& --verbose ${HOME} && sed -eu readonly
+		"$@" export 2>/dev/null --verbose awk test x=1 "$@"
+		-eu ${HOME} 2>/dev/null test export cd awk export
+	awk && && test local then awk cd 2>/dev/null
+		$(pwd) awk x=1 done echo $(pwd) 'quoted text' --verbose 2>/dev/null
+$(pwd) then sed awk && x=1 "$@" "$1" -eu x=1 ${HOME} cd && cd "$1"
+		export sed readonly awk
+export test /usr/bin local grep && -eu $(pwd) 2>/dev/null "$@" /usr/bin
+	cd export "$@" sed 'quoted text' echo && "$@" "$@" echo echo
+	$(pwd) -eu /usr/bin grep sed 2>/dev/null readonly | then -eu x=1 "$1" printf
+done -eu && sed done /usr/bin
+cd local printf test ${HOME} done
+		export && -eu cd ${HOME} grep | 'quoted text'
+		then "$1" /usr/bin sed echo done done then test --verbose x=1 then
+	${HOME} 2>/dev/null readonly local done x=1 /usr/bin $(pwd) printf
+local 'quoted text' "$1" test | 'quoted text' && cd cd printf "$@" 'quoted text'
+	cd then | local | then cd readonly ${HOME} "$@" 2>/dev/null
+		awk sed then local $(pwd) local "$1" /usr/bin 2>/dev/null
+		'quoted text' export --verbose x=1 export -eu $(pwd) test
+readonly then readonly readonly cd
+	readonly | $(pwd) cd printf
+		sed printf 'quoted text' sed 'quoted text' 'quoted text' 2>/dev/null
+		cd sed printf /usr/bin --verbose grep echo -eu export
+		local 'quoted text' done "$1" echo $(pwd) cd
+$(pwd) test /usr/bin test readonly readonly cd sed 'quoted text' 'quoted text'
+		echo ${HOME} 2>/dev/null echo "$1" cd echo echo then
+	x=1 done x=1 readonly && printf export readonly export | -eu
+		done $(pwd) --verbose "$1" test --verbose export cd $(pwd)
+		export local | "$1" 'quoted text' 2>/dev/null &&
+	${HOME} then && "$1" "$1" x=1 printf
+		then "$@" "$1" $(pwd) local echo "$1" readonly "$1" && 'quoted text' cd
+	--verbose echo $(pwd) ${HOME} -eu printf
+	x=1 2>/dev/null x=1 local && 2>/dev/null
+		"$1" echo done sed && printf ${HOME} "$@" local ${HOME} $(pwd) export
+		local "$@" local -eu cd "$@" --verbose && export sed | | "$@" && "$1"
+x=1 done readonly awk test "$1" "$@" ${HOME} cd $(pwd) "$1" cd
+echo "$1" 'quoted text' sed printf /usr/bin ${HOME} ${HOME} then test | readonly
+	"$@" /usr/bin && grep awk --verbose
+		$(pwd) export 'quoted text' "$@" --verbose -eu sed x=1 -eu printf |
+&& test export | "$@" export readonly
+		"$1" --verbose "$1" then "$@" done grep readonly
+| done && printf --verbose local && /usr/bin cd sed "$1" awk cd | /usr/bin && "$1"
+		&& x=1 && 'quoted text' grep ${HOME}
+		done awk grep done && readonly
+-eu then awk 2>/dev/null ${HOME} x=1 --verbose grep cd test done
+done echo x=1 'quoted text' export
+		&& grep done awk then export 'quoted text'
+		--verbose local cd printf |
+| $(pwd) cd grep cd $(pwd) x=1 done echo cd printf
+	printf && 2>/dev/null | --verbose test grep
+		&& && then local done done cd x=1 export done readonly --verbose
+sed x=1 grep 'quoted text' "$1"
+		readonly done then -eu --verbose 'quoted text' "$1" && 'quoted text'
+"$@" printf x=1 --verbose echo 2>/dev/null --verbose "$@" local
+		export --verbose ${HOME} readonly printf | 'quoted text'
+then cd --verbose --verbose -eu test test ${HOME} ${HOME} /usr/bin
+		/usr/bin sed 'quoted text' && readonly
+		2>/dev/null 'quoted text' 2>/dev/null
+	export | done ${HOME} /usr/bin 'quoted text' printf export "$@" ${HOME} awk
+		printf 'quoted text' 2>/dev/null then awk done then test local
+	readonly awk && -eu cd && awk | 2>/dev/null cd echo
+'quoted text' export --verbose
+	readonly export && | awk printf cd then "$1" echo test && | readonly
+		echo test cd test awk awk echo readonly
+	/usr/bin $(pwd) | --verbose local "$1" ${HOME} then echo readonly
+		x=1 "$@" "$@" awk readonly x=1 && awk test --verbose test | 'quoted text' done
+	${HOME} --verbose ${HOME} ${HOME} "$@" local
+&& "$@" -eu 'quoted text' "$1" then ${HOME} -eu printf test &&
+	then grep echo echo "$@" 2>/dev/null /usr/bin -eu --verbose 2>/dev/null readonly
+export awk printf printf echo readonly 2>/dev/null local --verbose
+		export printf local readonly "$1" /usr/bin $(pwd) 'quoted text' export
+/usr/bin sed | "$1" local | cd readonly x=1 "$1" 'quoted text'
+		test test cd && echo $(pwd) "$1" "$@" printf awk /usr/bin
+${HOME} "$@" done | echo test "$1" --verbose && && $(pwd) test test echo
+		test 'quoted text' grep sed x=1 $(pwd)
+sed /usr/bin local local local test done 'quoted text'
+		grep printf test grep printf
+		test x=1 /usr/bin local 'quoted text' then local readonly echo
+'quoted text' done printf 2>/dev/null /usr/bin | | cd x=1 $(pwd) 2>/dev/null
+then echo done x=1 -eu "$1" cd 2>/dev/null | sed x=1 /usr/bin | 2>/dev/null
+		-eu done && $(pwd) sed 'quoted text' /usr/bin 'quoted text'
+done -eu then then done --verbose printf && $(pwd) done "$@" && | "$1" x=1 grep
+&& grep $(pwd) -eu -eu $(pwd) x=1 | ${HOME} 'quoted text' grep ${HOME}
+		printf "$1" readonly x=1 "$@" done printf $(pwd) /usr/bin grep
+		sed echo $(pwd) && | echo printf | ${HOME} done
+	${HOME} awk done export x=1 'quoted text'
+		awk && sed sed export "$1" sed export | export echo awk grep test sed done --verbose
+	then readonly test sed 2>/dev/null then echo
+	readonly | | sed cd ${HOME} awk "$1" export done && test && then $(pwd)
+	$(pwd) local awk | /usr/bin $(pwd) && x=1 -eu x=1 -eu export then -eu --verbose
+	then test printf ${HOME} test cd awk "$@" /usr/bin 'quoted text' -eu && test
+--verbose readonly test
+/usr/bin echo test $(pwd) echo test readonly local echo then 'quoted text'
+export ${HOME} -eu "$@" readonly local $(pwd) 2>/dev/null
+echo echo 2>/dev/null awk export test 2>/dev/null $(pwd) -eu
+	-eu ${HOME} test 2>/dev/null
+	"$@" readonly printf done then export 2>/dev/null /usr/bin awk sed /usr/bin then
+		awk 2>/dev/null | grep $(pwd) | printf awk cd -eu | sed
+$(pwd) ${HOME} cd /usr/bin -eu cd "$1" x=1 && export -eu
+	$(pwd) ${HOME} sed awk readonly done "$@" "$@" cd sed echo
+	done test test 'quoted text' && printf cd grep
+	then cd -eu && echo readonly 'quoted text'
+	readonly test sed -eu readonly sed | 'quoted text'
+		cd readonly "$@" test test $(pwd) test
+sed -eu local | export x=1
+${HOME} "$@" 2>/dev/null readonly awk then 2>/dev/null "$@"
+	| --verbose 2>/dev/null awk &&
+	-eu local | | awk | -eu $(pwd) done 'quoted text'
+		/usr/bin --verbose 'quoted text' $(pwd) local "$@" "$@" readonly awk printf
+	x=1 echo then 'quoted text' local done /usr/bin export -eu test /usr/bin
+sed | 'quoted text' | 2>/dev/null sed 'quoted text' printf readonly
+		"$@" test grep then done export export x=1
+/usr/bin then | done readonly done ${HOME} "$1" cd then sed local
+		&& cd awk "$@" --verbose "$@" grep -eu "$@" awk done ${HOME}
+/usr/bin printf awk printf
+awk ${HOME} /usr/bin local ${HOME} x=1 && awk export then
+	--verbose then local && "$1" x=1 done local cd local
+		"$1" awk then "$1" x=1 x=1 cd
+	&& export 'quoted text' echo | then /usr/bin
+		cd $(pwd) sed $(pwd) awk x=1 -eu --verbose --verbose --verbose x=1 local
+--verbose -eu done printf echo --verbose awk test x=1 awk printf grep
+		printf then echo grep printf sed export "$@" local awk -eu --verbose
+	grep echo grep "$1" grep $(pwd) sed 2>/dev/null done && cd
+		$(pwd) export export readonly grep ${HOME} readonly /usr/bin sed /usr/bin |
+	awk printf awk test grep 2>/dev/null x=1
+	'quoted text' /usr/bin x=1 -eu ${HOME} && x=1 2>/dev/null echo
+/usr/bin then "$1" $(pwd)
+"$@" local sed /usr/bin -eu
+"$@" printf grep /usr/bin cd cd
+	${HOME} printf --verbose printf cd export ${HOME}
+readonly 'quoted text' printf "$@" cd export readonly && "$@" "$@"
+		then | done sed echo echo 2>/dev/null --verbose readonly
+done /usr/bin x=1 cd grep 2>/dev/null then
+	local $(pwd) "$@" ${HOME} cd "$@" ${HOME} --verbose
+		readonly 'quoted text' export && "$1" $(pwd) 'quoted text'
+		done "$@" "$@" ${HOME} local readonly &&
+'quoted text' local ${HOME} 2>/dev/null done cd -eu cd "$@" done printf --verbose
+		sed done --verbose sed ${HOME} -eu -eu awk &&
+&& sed /usr/bin done /usr/bin | export awk then done export local x=1
+	-eu --verbose export echo
+		export -eu done cd x=1 local echo "$1" x=1 "$@" echo readonly
+done --verbose $(pwd) awk local readonly
+	| echo readonly local 2>/dev/null
+/usr/bin ${HOME} then && |
+	"$@" grep echo --verbose x=1 awk "$1" export then cd 'quoted text' printf
+	| printf "$1" | awk grep
+${HOME} && test test grep local 'quoted text'
+	2>/dev/null /usr/bin "$@" readonly cd readonly -eu x=1 "$@" "$1" $(pwd) $(pwd)
+	'quoted text' --verbose && awk $(pwd) $(pwd)
+	sed --verbose -eu | /usr/bin -eu
+		cd | cd x=1 "$@" cd -eu && -eu echo x=1 export && && "$@"
+local cd printf | echo $(pwd) test test 2>/dev/null $(pwd) readonly ${HOME}
+	grep "$1" $(pwd) $(pwd) "$1"
+	x=1 --verbose readonly ${HOME} "$1" readonly then /usr/bin done
+	awk "$@" grep x=1 --verbose test readonly x=1
+	${HOME} export cd /usr/bin
+		/usr/bin && 2>/dev/null -eu $(pwd) /usr/bin readonly $(pwd) --verbose
+		test "$@" done --verbose /usr/bin cd -eu grep test
+	test $(pwd) && x=1 $(pwd) awk --verbose x=1
+${HOME} $(pwd) readonly echo /usr/bin printf
+		'quoted text' cd | readonly test -eu export --verbose echo && 2>/dev/null
+		export --verbose 2>/dev/null sed local 'quoted text' -eu x=1
+	${HOME} done 2>/dev/null 2>/dev/null
+	$(pwd) $(pwd) cd /usr/bin 2>/dev/null /usr/bin
+readonly cd 'quoted text' && 2>/dev/null test -eu test sed "$@" done
+	--verbose "$1" echo local x=1 awk then grep printf
+		grep local readonly ${HOME} x=1 local $(pwd)
+$(pwd) /usr/bin echo test
+		2>/dev/null --verbose then ${HOME} cd "$@" printf -eu cd awk ${HOME}
+		&& ${HOME} && ${HOME} export readonly "$@"
+		x=1 awk echo awk 'quoted text' local test ${HOME} /usr/bin
+	local -eu sed "$1" awk "$1" readonly then echo 2>/dev/null export x=1 echo grep
+		${HOME} $(pwd) $(pwd) then -eu printf | 2>/dev/null awk
+-eu $(pwd) -eu printf 2>/dev/null 'quoted text'
+		export --verbose --verbose | ${HOME} echo printf done export
+	awk cd $(pwd) "$1" | sed "$1" test awk sed cd "$@" ${HOME} local echo x=1
+		2>/dev/null cd cd ${HOME} local "$1" grep
+		"$1" local local cd -eu export export
+	${HOME} sed x=1 export "$@" export done ${HOME} cd grep 2>/dev/null
+awk x=1 "$1" -eu --verbose && |
+		'quoted text' sed done x=1 local $(pwd) readonly /usr/bin
+		done sed printf done "$@" cd ${HOME} 2>/dev/null cd "$@"
+		done cd echo ${HOME} local printf grep done --verbose
+		then done | then -eu awk test | x=1 then ${HOME}
+		"$@" -eu test awk printf x=1 local grep 'quoted text'
+		readonly test local --verbose cd "$@" done /usr/bin then "$@" -eu test readonly
+		done cd "$@" awk test | done
+2>/dev/null --verbose printf --verbose then --verbose echo |
+		cd -eu | grep x=1 local then awk local test 2>/dev/null
+	grep cd awk --verbose /usr/bin ${HOME} test then -eu
+		done local --verbose then echo x=1 /usr/bin && grep ${HOME} $(pwd)
+		echo x=1 awk sed "$@" sed export printf 2>/dev/null x=1 grep | printf done
+"$@" sed printf test grep cd awk ${HOME}
+	x=1 cd local --verbose /usr/bin sed /usr/bin echo readonly
+echo $(pwd) done --verbose
+	x=1 done --verbose sed $(pwd) test test
+		sed $(pwd) awk 2>/dev/null ${HOME} printf 'quoted text' x=1 --verbose
+		x=1 ${HOME} 2>/dev/null
+		--verbose sed sed -eu -eu cd x=1 'quoted text' test ${HOME}
+		test --verbose && export $(pwd) printf readonly readonly export printf
+x=1 grep readonly /usr/bin done 2>/dev/null
+	echo "$@" $(pwd) && printf x=1 test | printf /usr/bin $(pwd)
+		"$@" --verbose echo test --verbose awk done then | x=1
+	grep local "$@" cd ${HOME} 2>/dev/null ${HOME} 2>/dev/null
+	cd local && sed echo /usr/bin | grep test 2>/dev/null then "$@"
+		grep $(pwd) then $(pwd) ${HOME} -eu "$@" $(pwd) --verbose
+	x=1 echo then readonly --verbose sed echo local then /usr/bin
+-eu test echo ${HOME} local awk then | --verbose then /usr/bin
+	echo --verbose awk && local $(pwd) echo readonly /usr/bin | ${HOME}
+		"$@" --verbose 'quoted text' 'quoted text' 2>/dev/null
+local printf cd | test local echo 2>/dev/null x=1
+/usr/bin export cd grep readonly local done readonly local readonly
+	cd sed done sed echo /usr/bin x=1 $(pwd) readonly
+done printf local | $(pwd) grep printf echo test 2>/dev/null then awk awk
+x=1 --verbose then /usr/bin export --verbose then $(pwd) cd grep /usr/bin
+cd export echo awk then
+	sed readonly readonly echo cd
+	sed --verbose cd 'quoted text'
+	-eu 'quoted text' echo test && echo /usr/bin --verbose
+		| "$@" awk then test done ${HOME} $(pwd) && printf -eu sed "$1" "$1" then done
+		"$1" -eu local printf 'quoted text' awk readonly "$@" && local readonly then
+2>/dev/null "$1" "$@"
+		sed 'quoted text' | awk ${HOME} 2>/dev/null
+'quoted text' grep readonly --verbose grep "$@" printf export sed
+cd 2>/dev/null $(pwd) ${HOME} cd $(pwd) "$@" |
+	'quoted text' x=1 2>/dev/null cd echo -eu echo cd --verbose | 2>/dev/null 'quoted text'
+	"$@" 2>/dev/null "$1"
+		sed sed sed echo 'quoted text' export
+	"$1" local sed test ${HOME} | echo --verbose
+	sed x=1 -eu then test then 2>/dev/null local then readonly 'quoted text' 2>/dev/null
+x=1 ${HOME} test sed echo cd readonly && then && $(pwd) printf echo sed
+		/usr/bin export readonly --verbose awk ${HOME} awk
+done sed "$@" "$1" cd test "$@" && && test "$@" readonly 'quoted text' x=1
+then awk "$@" --verbose x=1 sed awk -eu printf local
+		/usr/bin echo echo -eu 'quoted text' printf then $(pwd) --verbose printf awk &&
+done ${HOME} 2>/dev/null readonly readonly
+		2>/dev/null x=1 test $(pwd) export awk $(pwd) | "$1" 'quoted text' readonly
+--verbose ${HOME} x=1 /usr/bin grep x=1 awk ${HOME}
+	&& printf sed local echo -eu echo local /usr/bin "$1" then
+		done ${HOME} awk | export 2>/dev/null then test sed cd 'quoted text'
+		-eu $(pwd) | local export /usr/bin then export | 'quoted text' x=1 done /usr/bin
+		awk readonly printf | 'quoted text'
+	sed local && 'quoted text' done printf
+"$@" local "$@" && --verbose ${HOME} 'quoted text' --verbose 2>/dev/null
+	/usr/bin --verbose -eu printf -eu cd local --verbose echo printf "$@"
+	"$@" 2>/dev/null /usr/bin
+	readonly "$@" x=1 'quoted text' /usr/bin local echo readonly /usr/bin "$1" &&
+	-eu "$1" done then awk ${HOME} --verbose awk $(pwd) done then $(pwd) --verbose
+x=1 printf /usr/bin local test --verbose /usr/bin readonly
+		x=1 test export 2>/dev/null 'quoted text' | && printf "$1" test
+done readonly -eu x=1 readonly
+awk 'quoted text' x=1 done readonly && cd
+		$(pwd) then && echo --verbose 'quoted text' done
+--verbose echo --verbose cd local printf echo test grep awk && --verbose "$1"
+done /usr/bin printf echo | 'quoted text' "$1" done then test x=1 2>/dev/null
+	"$@" grep grep done export done test "$1" /usr/bin "$@" $(pwd) readonly
+	test 2>/dev/null && | sed -eu "$@" awk 2>/dev/null "$@" ${HOME}
+local done cd done $(pwd) then export 'quoted text' readonly ${HOME}
+${HOME} echo echo --verbose 'quoted text' x=1
+&& export --verbose printf /usr/bin awk done cd
+'quoted text' awk awk awk ${HOME} --verbose "$1" grep 'quoted text'
+awk /usr/bin export test cd "$1" cd /usr/bin | done x=1 test then
+	sed done "$1" 'quoted text' /usr/bin
+grep then grep "$1" "$1" sed $(pwd) "$1" grep /usr/bin cd "$1" -eu x=1 "$1"
+		awk grep then readonly | /usr/bin x=1 printf 2>/dev/null &&
+	&& grep -eu echo echo -eu "$@" grep export test "$@" awk echo local printf awk
+		printf grep echo 'quoted text' "$1" awk awk | printf "$1" done | | && 'quoted text'
+	2>/dev/null && echo 'quoted text' readonly export | ${HOME} && 'quoted text'
+		x=1 /usr/bin $(pwd) /usr/bin 'quoted text' x=1 $(pwd) local /usr/bin
+		readonly 'quoted text' /usr/bin printf readonly --verbose
+	echo ${HOME} $(pwd) "$@" -eu && && "$@" -eu local x=1 | awk grep "$1" "$1" 2>/dev/null
+-eu ${HOME} "$1" && cd
+		local printf "$1" grep 'quoted text' /usr/bin && | local $(pwd) "$1" 'quoted text'
+awk /usr/bin local --verbose
+then | x=1 export awk export
+	echo echo local --verbose | grep /usr/bin $(pwd) done cd -eu "$1"
+	grep printf 2>/dev/null 'quoted text'
+	"$1" x=1 local 2>/dev/null readonly 2>/dev/null
+${HOME} done "$@" "$1" sed
+		then then -eu "$1" 2>/dev/null awk ${HOME} && --verbose grep ${HOME} echo "$@"
+"$@" sed awk done | done printf grep 2>/dev/null && --verbose "$@" done sed 2>/dev/null
+	echo sed cd ${HOME} cd sed -eu grep 'quoted text' readonly readonly
+cd export local printf test test awk printf cd
+		2>/dev/null /usr/bin --verbose readonly /usr/bin
+	$(pwd) "$@" echo local sed /usr/bin
+	${HOME} 'quoted text' cd local local && $(pwd) awk
+	/usr/bin $(pwd) sed 2>/dev/null cd test echo -eu test && 'quoted text'
+	$(pwd) --verbose 2>/dev/null readonly readonly
+test -eu done -eu awk printf 2>/dev/null /usr/bin
+${HOME} ${HOME} ${HOME} $(pwd) "$1" awk $(pwd) --verbose
+local echo awk /usr/bin "$@" /usr/bin "$1" cd echo --verbose export
+		test readonly "$@" grep printf && && done "$1" | "$@" done test
+		--verbose readonly 2>/dev/null "$@"
+		-eu done readonly ${HOME} export -eu $(pwd) printf awk cd then
+		sed && /usr/bin local "$1" 2>/dev/null "$1" "$1" | | then $(pwd) echo
+--verbose 'quoted text' --verbose echo "$@" "$1" --verbose local
+		done echo "$1" awk test x=1 /usr/bin
+echo "$@" sed awk -eu 2>/dev/null
+		echo x=1 x=1 ${HOME} $(pwd) test 2>/dev/null then test && "$@" 2>/dev/null
+printf -eu | x=1 grep test 2>/dev/null
+	/usr/bin && ${HOME} test | then local $(pwd) then readonly ${HOME} readonly
+/usr/bin --verbose printf x=1 2>/dev/null then --verbose grep /usr/bin ${HOME}
+echo 'quoted text' /usr/bin | cd x=1 ${HOME} done $(pwd) awk then
+	test -eu | grep export -eu then "$@" x=1 awk "$@" $(pwd) 2>/dev/null
+	"$1" awk /usr/bin sed printf | 2>/dev/null x=1 then $(pwd) done
+local cd -eu awk awk -eu local 2>/dev/null awk readonly x=1 x=1 2>/dev/null ${HOME}
+	-eu $(pwd) $(pwd) echo "$1" 'quoted text' cd ${HOME}
+	| --verbose echo 2>/dev/null ${HOME} printf local export test cd sed grep
+		export && ${HOME} && cd && echo $(pwd) "$@" sed export && awk test
+		grep test test awk "$1" grep cd /usr/bin
+		cd local done "$1" local /usr/bin "$@" local awk done printf
+		/usr/bin grep 2>/dev/null readonly cd readonly $(pwd) $(pwd)
+	'quoted text' cd awk test cd grep
+		"$@" "$1" | ${HOME} readonly
+	'quoted text' ${HOME} export local printf ${HOME} then test awk then export printf
+"$1" $(pwd) then cd echo "$@" awk ${HOME} local && done && done done echo
+sed x=1 grep sed x=1 --verbose 2>/dev/null /usr/bin --verbose
+"$@" export 2>/dev/null grep printf && readonly
+	/usr/bin x=1 local 'quoted text' export cd awk "$1" awk cd ${HOME} echo 2>/dev/null
+		printf x=1 ${HOME} echo then done
+	"$@" $(pwd) then done then
+		-eu --verbose printf local --verbose cd then export | grep grep export
+x=1 export 'quoted text' -eu then sed then then cd x=1 test cd ${HOME} grep
+	&& done grep /usr/bin 2>/dev/null printf grep export readonly printf
+	&& "$@" awk awk $(pwd) /usr/bin && awk readonly -eu readonly
+		export grep sed local local awk "$@" -eu cd "$1" 'quoted text'
+&& "$@" export $(pwd) "$@" "$@"
+$(pwd) done readonly $(pwd) sed ${HOME} sed $(pwd) cd grep local $(pwd) cd awk
+then -eu x=1 cd $(pwd) test then local local done | grep "$1" awk
+	/usr/bin 2>/dev/null ${HOME}
+		echo readonly grep echo -eu done "$@" && export && /usr/bin done -eu
+	done cd "$1" x=1 echo local echo ${HOME} then
+	$(pwd) then 'quoted text' ${HOME}
+		$(pwd) sed grep ${HOME} x=1 | $(pwd) done 2>/dev/null "$@" done
+sed then && echo x=1
+-eu 2>/dev/null "$1" 2>/dev/null | 2>/dev/null printf export x=1
+		-eu "$1" && export cd "$@" -eu local awk
+'quoted text' printf --verbose awk done grep
+	test cd echo local -eu readonly
+	"$1" done local local export x=1 x=1
+export echo grep then -eu --verbose
+	then printf 2>/dev/null
+		-eu echo readonly printf awk echo done test
+	2>/dev/null awk -eu | cd grep grep "$1" test sed
+		done done done then printf sed test awk
+	done grep "$1" -eu printf awk echo 2>/dev/null
+readonly /usr/bin test sed
+		/usr/bin "$@" sed printf export /usr/bin &&
+x=1 printf echo printf ${HOME} then
+	grep --verbose readonly |
+then readonly echo ${HOME}
+	export sed done 'quoted text' | -eu then export sed readonly "$@" test "$1" sed
+	awk cd printf x=1 awk /usr/bin awk export x=1 done ${HOME} $(pwd)
+x=1 cd ${HOME} "$@" 2>/dev/null printf
+cd sed 'quoted text' grep
+	/usr/bin 2>/dev/null $(pwd) done --verbose 'quoted text' && echo x=1 sed
+'quoted text' sed --verbose then x=1 $(pwd) && ${HOME}
+	test --verbose local export readonly cd
+		done printf --verbose done
+		x=1 awk "$@" ${HOME} done export then local 'quoted text' --verbose && echo
+	/usr/bin 'quoted text' "$@" grep awk && then "$@" cd cd test 2>/dev/null
+		/usr/bin && sed test "$1" 'quoted text' 'quoted text'
+		local "$1" 'quoted text' then local export export /usr/bin 'quoted text'
+		-eu readonly cd local printf "$@" 'quoted text' 'quoted text'
+cd test -eu local readonly printf --verbose /usr/bin test sed ${HOME}
+export then "$@" 'quoted text'
+	x=1 && 'quoted text' --verbose && then ${HOME} -eu
+		export "$@" cd grep local awk sed $(pwd) x=1 awk then export printf --verbose
+"$@" grep cd echo | /usr/bin 2>/dev/null test export local echo $(pwd)
+local $(pwd) $(pwd) sed && echo grep
+		-eu x=1 cd local export && $(pwd) && /usr/bin grep then cd x=1 x=1
+		awk x=1 'quoted text' | 2>/dev/null
+	cd $(pwd) done export ${HOME} test ${HOME} grep local grep | then
+'quoted text' | echo && x=1 done 'quoted text' /usr/bin /usr/bin | $(pwd) --verbose
+-eu export ${HOME} sed echo echo done export done export | "$@" grep "$@" ${HOME}
+	--verbose 2>/dev/null printf 2>/dev/null 'quoted text'
+		echo /usr/bin "$@" 2>/dev/null $(pwd) sed -eu sed $(pwd) 'quoted text'
+| /usr/bin cd ${HOME} then
+$(pwd) test sed 'quoted text' $(pwd) cd done export export --verbose
+done awk cd /usr/bin "$@" "$@" readonly sed -eu
+	echo cd x=1 $(pwd) --verbose "$1" ${HOME} "$1" export "$1" echo 2>/dev/null
+2>/dev/null cd 2>/dev/null sed -eu readonly $(pwd)
+		$(pwd) $(pwd) "$1" export ${HOME} -eu then $(pwd)
+/usr/bin && cd 2>/dev/null echo $(pwd) 2>/dev/null
+		| echo sed done grep $(pwd) /usr/bin sed x=1 echo "$@" readonly test
+	2>/dev/null local ${HOME} $(pwd) awk sed then | done ${HOME} done sed local 2>/dev/null
+	2>/dev/null x=1 "$@" printf local echo then test ${HOME}
+	printf 'quoted text' --verbose test && 2>/dev/null awk --verbose test export local
+$(pwd) 2>/dev/null /usr/bin ${HOME} done done | && --verbose
+export then -eu -eu 2>/dev/null export 'quoted text'
+	"$@" cd $(pwd) grep 2>/dev/null export test -eu ${HOME} $(pwd) "$@" local awk
+		"$1" 'quoted text' "$@" cd awk done local $(pwd) local cd then cd && awk test
+	grep | awk cd $(pwd) x=1 /usr/bin test test ${HOME} "$1" export ${HOME}
+	sed echo echo awk local /usr/bin -eu "$@" "$1" -eu local "$1" cd done "$1"
+readonly $(pwd) $(pwd) awk "$1" local grep awk
+	&& -eu then -eu then
+	test then && done && && local done "$1" readonly
+		cd 2>/dev/null --verbose
+/usr/bin && "$1" done 'quoted text' ${HOME}
+		-eu ${HOME} x=1 "$@" echo
+		sed /usr/bin sed awk readonly echo local sed "$@" then awk | x=1 echo export
+	| export "$@" ${HOME} && 2>/dev/null x=1 readonly awk echo done $(pwd) awk
+	$(pwd) readonly readonly | | cd x=1
+"$1" local local | readonly 'quoted text'
+	'quoted text' /usr/bin --verbose "$@" export test awk echo printf
+	/usr/bin "$1" && && local --verbose
+| "$1" -eu local --verbose ${HOME} done | ${HOME} ${HOME} then printf test ${HOME}
+2>/dev/null /usr/bin /usr/bin
+	local sed /usr/bin "$1" "$@" 2>/dev/null
+	sed cd export --verbose $(pwd) -eu
+	&& readonly "$@" $(pwd) cd cd printf then 'quoted text' "$@" "$@" --verbose echo
+	grep echo cd "$1" && /usr/bin grep && x=1 readonly awk grep | --verbose
+| sed "$@" echo local x=1 then then "$1" /usr/bin sed && printf local sed -eu
+		/usr/bin cd && echo "$1" readonly --verbose
+		&& -eu | "$1" --verbose export -eu && $(pwd) readonly done "$1" readonly
+| test awk /usr/bin awk echo /usr/bin && | local
+		2>/dev/null awk x=1 sed && --verbose readonly done
+		done 'quoted text' 2>/dev/null /usr/bin 'quoted text' local --verbose --verbose
+${HOME} "$@" readonly grep done sed local done printf grep printf
+		/usr/bin test x=1 echo local -eu "$@" local
+	echo printf sed $(pwd) --verbose x=1 done
+		local then sed "$1" local readonly awk && local done x=1 test && ${HOME} echo
+	echo -eu readonly -eu | export grep readonly
+	then ${HOME} test readonly
+echo x=1 echo x=1 then done | test then /usr/bin grep "$@"
+		${HOME} echo -eu $(pwd) x=1 export && done
+test cd --verbose grep sed awk 'quoted text' local cd sed local
+	&& --verbose readonly "$1" cd --verbose
+		'quoted text' --verbose cd 2>/dev/null export /usr/bin "$1" && ${HOME} x=1
+		-eu awk "$1" printf printf readonly
+	cd done x=1 | echo sed -eu export /usr/bin echo ${HOME}
+readonly | /usr/bin --verbose sed export cd "$1" export
+		x=1 "$1" local 'quoted text' export printf $(pwd) export | --verbose
+local "$@" --verbose done done awk echo
+	then export --verbose x=1 -eu awk
+	"$1" then /usr/bin test && sed done
+		sed cd sed x=1 readonly echo
+		export echo grep 2>/dev/null 2>/dev/null readonly && echo local sed test sed printf
+		2>/dev/null $(pwd) "$1" $(pwd) cd test $(pwd) && done /usr/bin
+	local 2>/dev/null x=1
+"$1" readonly && ${HOME} x=1 sed cd awk grep
+		sed "$@" awk test cd /usr/bin
+readonly grep local readonly printf export /usr/bin
+"$1" cd /usr/bin && then /usr/bin
+		${HOME} printf -eu done printf
+	test $(pwd) "$1" readonly then then ${HOME} |
+		-eu -eu export printf test /usr/bin awk | "$1" awk /usr/bin | $(pwd)
+		| echo then readonly -eu test
+		| then printf sed "$@" "$@" done 2>/dev/null "$1" $(pwd) printf sed &&
+	/usr/bin ${HOME} -eu echo x=1 test 'quoted text' echo
+$(pwd) local /usr/bin readonly cd cd -eu awk x=1 grep printf
+"$@" printf x=1 2>/dev/null x=1 cd done readonly -eu done
+	x=1 awk test local export
+&& && $(pwd) printf -eu /usr/bin local | local sed x=1 done
+		&& awk x=1 export /usr/bin test cd done
+		"$1" x=1 cd --verbose grep | 'quoted text'
+${HOME} && 'quoted text' cd x=1 grep echo cd -eu done "$@"
+	grep 'quoted text' && ${HOME} 2>/dev/null x=1 | sed
+	$(pwd) 'quoted text' grep
+	&& ${HOME} "$@" cd -eu && --verbose printf grep --verbose
+cd "$1" then done "$@" cd $(pwd) x=1 x=1 "$@" grep
+then | "$1" export ${HOME} x=1 echo local 2>/dev/null export | grep test export
+test readonly then | ${HOME} -eu readonly done then ${HOME}
+grep done printf ${HOME} "$@" done 'quoted text'
+local sed echo sed /usr/bin
+	2>/dev/null | /usr/bin && test then "$@" sed -eu -eu /usr/bin 'quoted text'
+done awk local --verbose printf "$1" then /usr/bin export "$1" --verbose
+		--verbose --verbose sed echo test printf readonly --verbose
+	local echo test awk grep | && echo 'quoted text' 2>/dev/null x=1 x=1
+grep printf ${HOME} readonly && | "$1" echo "$@" readonly local
+		$(pwd) "$@" "$1" 2>/dev/null sed /usr/bin printf printf
+		cd --verbose echo $(pwd) 2>/dev/null local local
+		export then | export | awk 2>/dev/null -eu then done grep
+/usr/bin local sed echo grep readonly export export test 2>/dev/null
+2>/dev/null then $(pwd) echo ${HOME} test | && grep echo "$1"
+printf echo | then awk cd 2>/dev/null test 'quoted text' | then local "$@"
+2>/dev/null export $(pwd)
+	/usr/bin "$@" --verbose cd awk ${HOME}
+		then sed "$@" awk /usr/bin echo printf echo export | grep
+	2>/dev/null cd sed $(pwd) then "$1" local
+		sed then "$1" 2>/dev/null --verbose awk ${HOME}
+	/usr/bin test --verbose $(pwd) printf 2>/dev/null --verbose
+"$@" awk "$1" "$@" /usr/bin 2>/dev/null
+grep 2>/dev/null cd $(pwd) test 2>/dev/null
+	done grep sed local echo
+		&& export awk export sed "$1" readonly "$1" sed | | --verbose
+		/usr/bin sed && echo x=1 echo | export 2>/dev/null
+	printf && 2>/dev/null awk --verbose
+&& /usr/bin awk test ${HOME} readonly 2>/dev/null
+		'quoted text' local local -eu 2>/dev/null --verbose grep
+then sed --verbose /usr/bin --verbose printf --verbose local
+done | 'quoted text' "$@" local local "$1" -eu
+	printf then "$@" -eu $(pwd) $(pwd) -eu -eu | && grep grep grep
+		${HOME} test grep 'quoted text' x=1 readonly /usr/bin test cd $(pwd) cd
+	--verbose then --verbose sed
+$(pwd) echo export | && "$@" /usr/bin "$@" x=1 cd export x=1 grep done
+	then test grep && 2>/dev/null done 'quoted text' test cd -eu /usr/bin
+	--verbose -eu grep printf -eu | |
+	local /usr/bin 2>/dev/null
+	grep x=1 export test --verbose awk "$1" -eu 'quoted text' printf -eu readonly
+"$@" awk ${HOME} -eu /usr/bin export | --verbose cd -eu sed &&
+"$@" -eu grep "$@" $(pwd) && x=1 cd -eu sed
+--verbose "$1" -eu grep $(pwd) && awk 2>/dev/null done -eu
+	x=1 -eu readonly $(pwd) done echo test local
+	"$@" awk done then && local | printf
+		echo --verbose | readonly "$1" ${HOME} x=1 then awk local -eu --verbose
+		readonly $(pwd) export printf --verbose cd echo | | --verbose
+local cd awk echo export local x=1 printf awk sed x=1 -eu
+		then ${HOME} x=1 export cd "$1" awk && --verbose ${HOME} && -eu export
+	test --verbose sed 2>/dev/null
+/usr/bin export 2>/dev/null | export
+		done "$@" echo 2>/dev/null
+done test readonly $(pwd) sed then awk test cd | ${HOME}
+		x=1 then 2>/dev/null printf local
+test 'quoted text' -eu sed printf --verbose export sed awk sed echo 'quoted text'
+	local export --verbose echo export echo done $(pwd) export | 2>/dev/null --verbose
+'quoted text' && sed export then -eu export local printf && 2>/dev/null x=1
+'quoted text' 2>/dev/null && 'quoted text'
+	grep "$@" | then "$@" && "$@" echo && x=1 done | local printf && ${HOME}
+	$(pwd) 'quoted text' 'quoted text' printf /usr/bin export grep then readonly
+		cd done then && echo grep done printf && "$@" printf x=1 then then test
+	done | --verbose 'quoted text' done x=1 $(pwd) grep x=1 -eu
+		printf x=1 sed then done export
+	export local && 'quoted text' -eu $(pwd) | x=1 readonly 2>/dev/null
+	"$@" grep 'quoted text' cd /usr/bin sed 2>/dev/null
+printf -eu printf readonly printf /usr/bin done echo x=1 "$@" /usr/bin
+	| --verbose sed readonly -eu then sed | sed --verbose && export
+'quoted text' "$@" local -eu echo && local $(pwd) | -eu "$1" 'quoted text'
+	then echo sed sed --verbose grep x=1 "$@" ${HOME} ${HOME}
+done cd 'quoted text' x=1 done then | local
+	awk awk sed -eu "$1" 2>/dev/null local 2>/dev/null
+		$(pwd) 'quoted text' sed grep $(pwd) --verbose x=1 sed printf grep export $(pwd)
+	&& /usr/bin grep readonly 2>/dev/null grep
+	awk | printf --verbose ${HOME}
+#include c41.sh
+grep local 2>/dev/null done
+/usr/bin done -eu export grep "$@" x=1 2>/dev/null "$@" then test
+local printf x=1 sed x=1 2>/dev/null ${HOME} export -eu -eu | grep grep
+	/usr/bin 2>/dev/null echo echo "$@" ${HOME}
+	${HOME} then echo done grep test 'quoted text'
+	x=1 printf printf 2>/dev/null 2>/dev/null /usr/bin
+	readonly "$1" "$@" "$@" 2>/dev/null | printf x=1 2>/dev/null
+echo -eu /usr/bin sed printf echo 2>/dev/null --verbose -eu ${HOME}
+	test ${HOME} cd 2>/dev/null readonly -eu then /usr/bin 'quoted text'
+	test done -eu test then readonly $(pwd) local grep --verbose
+test awk 2>/dev/null cd
+	cd --verbose export -eu "$1"
+cd grep awk done -eu done sed grep 2>/dev/null export
+cd done echo /usr/bin cd readonly echo done "$@" grep --verbose
+		then --verbose /usr/bin ${HOME} cd /usr/bin /usr/bin test
+2>/dev/null 'quoted text' readonly then awk test local readonly
+$(pwd) 2>/dev/null export "$1" x=1 2>/dev/null then $(pwd) "$1"
+		test cd x=1 echo local --verbose
+	"$1" echo --verbose 'quoted text'
+2>/dev/null done sed done "$1" -eu "$1" x=1 local --verbose /usr/bin done
+		done -eu test printf $(pwd) export
+sed sed local "$@" cd "$1"
+| --verbose 'quoted text' echo "$1" --verbose grep cd awk 'quoted text'
+	"$@" "$1" echo --verbose 2>/dev/null cd "$@" test test printf
+	| /usr/bin then export cd "$1" x=1 awk
+		'quoted text' $(pwd) printf grep test test "$@" /usr/bin --verbose --verbose
+		done | export cd local local x=1 test $(pwd) test ${HOME} awk local
+	local --verbose done awk sed && | --verbose | export -eu done printf --verbose
+		test --verbose -eu cd cd echo grep sed /usr/bin export grep then grep test
+	| 2>/dev/null export readonly then "$1" | && grep printf echo test 2>/dev/null
+	-eu 'quoted text' --verbose $(pwd) $(pwd) done "$1" local cd x=1 --verbose
+	| 2>/dev/null then -eu sed $(pwd) /usr/bin | 2>/dev/null
+$(pwd) echo awk echo 2>/dev/null
+'quoted text' sed | readonly 'quoted text' cd $(pwd) sed --verbose
+		then /usr/bin printf ${HOME} && "$1" test && x=1 export /usr/bin
+${HOME} echo 2>/dev/null export test x=1 then
+	cd | 2>/dev/null readonly | "$@" -eu readonly
+		$(pwd) grep | /usr/bin awk -eu --verbose "$1" && grep "$@" test x=1 "$1" 2>/dev/null
+$(pwd) done echo ${HOME} export readonly
+		'quoted text' cd grep awk /usr/bin export sed -eu ${HOME}
+		| sed | readonly ${HOME} cd test printf export done then
+	&& export awk awk echo test "$1" local
+		grep $(pwd) cd export --verbose local "$@" && readonly sed echo grep
+x=1 export "$1" ${HOME} -eu x=1
+	| sed test cd echo local sed x=1 grep readonly ${HOME}
+/usr/bin "$1" "$1" && then local then sed local "$1" sed awk export
+test echo x=1 printf cd echo -eu /usr/bin test readonly 2>/dev/null
+		${HOME} echo test --verbose | test $(pwd) then grep awk done && x=1 grep "$@" $(pwd)
+		"$1" grep /usr/bin ${HOME} ${HOME} "$1" --verbose
+2>/dev/null printf 2>/dev/null 2>/dev/null
+		--verbose /usr/bin -eu /usr/bin && grep ${HOME}
+	then export && sed readonly printf $(pwd) sed echo $(pwd) printf | --verbose
+		"$1" local export cd sed printf "$@" test
+'quoted text' printf local "$@" cd readonly
+	x=1 sed "$1" 2>/dev/null done done local $(pwd) local 2>/dev/null
+	local printf grep grep printf 2>/dev/null
+awk --verbose && cd awk test
+	--verbose -eu && 'quoted text' "$@" --verbose test "$@" local "$1" export
+		2>/dev/null done 'quoted text' -eu test "$@" "$@" done readonly
+		x=1 done printf --verbose
+	awk 'quoted text' | /usr/bin $(pwd)
+		done export readonly done "$1" readonly "$@" awk 'quoted text'
+"$@" ${HOME} /usr/bin --verbose echo 'quoted text'
+	cd awk | | export test
+		sed export grep -eu awk cd x=1 ${HOME} ${HOME}
+cd /usr/bin export 'quoted text' -eu echo 'quoted text'
+	awk sed sed done printf -eu
+| done -eu x=1 /usr/bin ${HOME} awk 'quoted text' cd x=1 awk
+	awk $(pwd) export ${HOME} 2>/dev/null export test
+export sed 2>/dev/null echo
+${HOME} -eu $(pwd) && printf | $(pwd) test -eu local 'quoted text'
+		awk grep done "$1" "$1" "$@" | export -eu local echo ${HOME} "$@" 2>/dev/null x=1
+printf ${HOME} test cd cd
+2>/dev/null printf then grep readonly 2>/dev/null "$@" | cd
+	-eu 2>/dev/null export local "$1" ${HOME} 2>/dev/null $(pwd) "$@" export
+printf -eu grep $(pwd) "$@" x=1 sed readonly | 2>/dev/null echo $(pwd) then ${HOME}
+		export test done cd printf
+| 2>/dev/null readonly printf "$@" cd --verbose export sed grep then "$@" test --verbose
+		--verbose ${HOME} readonly --verbose $(pwd) "$@" echo sed readonly cd test
+		awk 'quoted text' done readonly "$@" | | awk 'quoted text'
+'quoted text' readonly printf 2>/dev/null cd $(pwd) export
+	${HOME} done printf echo done cd readonly echo test /usr/bin
+		grep local cd && grep /usr/bin
+echo | printf then $(pwd) x=1 2>/dev/null ${HOME} /usr/bin then 'quoted text'
+		cd -eu local -eu cd printf grep
+readonly ${HOME} awk x=1
+	cd readonly | /usr/bin | "$1" ${HOME} printf /usr/bin --verbose
+	| test "$1" -eu x=1 readonly printf 2>/dev/null ${HOME} "$1" grep
+	${HOME} /usr/bin local x=1 local -eu readonly ${HOME}
+--verbose readonly 2>/dev/null grep cd awk /usr/bin && awk sed local
+	| $(pwd) --verbose awk /usr/bin | |
+	"$@" local readonly then echo grep awk echo 2>/dev/null
+$(pwd) $(pwd) awk local grep cd cd grep cd && | 'quoted text'
+	/usr/bin printf | sed awk sed
+--verbose awk && 2>/dev/null "$@" 2>/dev/null --verbose
+/usr/bin done grep printf export "$1" sed grep then
+		"$1" /usr/bin "$@" then 2>/dev/null
+		sed x=1 then test x=1 $(pwd) done cd x=1 echo then then 2>/dev/null done test &&
+		x=1 done x=1 $(pwd) $(pwd) | "$1" 'quoted text' then readonly "$@"
+	2>/dev/null -eu echo $(pwd) --verbose 'quoted text'
+	readonly echo local then cd 2>/dev/null
+		x=1 | cd x=1 awk sed cd
+		local done | /usr/bin ${HOME} then 'quoted text' sed | local "$@" export
+grep -eu -eu test 2>/dev/null "$@" x=1 then | "$@" 'quoted text' grep x=1 grep
+awk local && /usr/bin local export 2>/dev/null local grep export grep
+	x=1 "$1" "$@" --verbose "$1"
+	"$@" x=1 | | export done grep sed grep echo /usr/bin 2>/dev/null &&
+"$@" && "$1" $(pwd) --verbose readonly | test done "$1"
+--verbose export && readonly local awk then grep grep printf && | export
+		then /usr/bin test then export
+		/usr/bin echo 'quoted text' 2>/dev/null 2>/dev/null export export "$@" /usr/bin
+x=1 readonly /usr/bin readonly ${HOME} "$@" 'quoted text' && /usr/bin
+	| local && printf test awk "$1" export readonly local awk cd sed test awk
+		printf && && test done ${HOME} "$1" "$@" sed printf $(pwd) test printf 'quoted text'
+	$(pwd) "$@" export --verbose test local cd "$1"
+cd && /usr/bin 'quoted text'
+	echo awk readonly --verbose grep readonly --verbose done test ${HOME} "$@"
+${HOME} sed $(pwd) grep 'quoted text' awk x=1 'quoted text'
+	${HOME} | 'quoted text' done test readonly
+	${HOME} ${HOME} grep 'quoted text' 2>/dev/null 2>/dev/null awk cd
+	then | | local then | 2>/dev/null x=1 grep | | ${HOME} done then --verbose test
+		2>/dev/null done && then printf | 2>/dev/null grep --verbose awk
+		export ${HOME} awk then cd "$1" "$@" /usr/bin
+cd export echo grep --verbose grep cd ${HOME} sed
+		test 'quoted text' cd
+readonly ${HOME} test cd 2>/dev/null test grep
+| 'quoted text' local $(pwd) then "$1" export | "$1" 2>/dev/null -eu "$@"
+${HOME} 2>/dev/null x=1 /usr/bin | test | test export $(pwd)
+	local test 2>/dev/null test "$@" --verbose sed grep $(pwd) --verbose sed echo
+	$(pwd) then export awk && &&
+		"$1" printf done then --verbose ${HOME} $(pwd) /usr/bin "$@" -eu echo 2>/dev/null
+		export --verbose test 'quoted text' | $(pwd) | 'quoted text'
+-eu && ${HOME} test local
+	${HOME} then grep readonly echo /usr/bin 2>/dev/null sed done | export
+		--verbose ${HOME} test sed local
+		sed local grep local && done "$1" --verbose
+test ${HOME} && cd && grep awk then export | local $(pwd) grep
+		awk export done done | "$@" sed test cd echo -eu
+	cd ${HOME} printf then 'quoted text' grep
+"$@" 'quoted text' $(pwd) awk | local echo
+sed grep then printf | -eu && done awk export 2>/dev/null
+	local ${HOME} readonly export $(pwd) $(pwd) done export ${HOME}
+		done 'quoted text' --verbose -eu sed --verbose cd x=1 cd done local printf
+		x=1 grep -eu printf then export
+test --verbose -eu export x=1 --verbose done
+	$(pwd) awk grep && then 'quoted text' then ${HOME}
+done done test export 'quoted text' && cd "$@" echo printf
+	cd --verbose sed 'quoted text'
+		--verbose sed | echo echo
+		/usr/bin done grep readonly test readonly --verbose grep $(pwd) local echo then
+		then export $(pwd) --verbose done readonly export
+local --verbose echo cd printf $(pwd) x=1 export "$@"
+readonly ${HOME} then awk test && "$1" grep ${HOME} --verbose export "$@"
+"$@" grep 'quoted text' /usr/bin printf done test $(pwd) 2>/dev/null
+awk test "$1" ${HOME} cd -eu | /usr/bin echo -eu
+	export grep sed echo x=1 -eu then 2>/dev/null
+		${HOME} done readonly sed
+	export 2>/dev/null $(pwd)
+	cd done $(pwd) ${HOME} 2>/dev/null 2>/dev/null 'quoted text' x=1 sed printf done
+		test echo sed "$@" then && "$1" 'quoted text' ${HOME} cd test cd
+printf "$1" $(pwd) | && "$@" test test printf
+"$@" cd ${HOME} && "$@" $(pwd) -eu sed /usr/bin x=1 -eu cd /usr/bin
+	echo 2>/dev/null $(pwd) grep 2>/dev/null | grep readonly 'quoted text' --verbose
+		test grep /usr/bin -eu sed $(pwd) && echo x=1 test -eu cd 2>/dev/null grep ${HOME}
+awk 2>/dev/null -eu readonly
+-eu echo 'quoted text' test awk -eu printf 'quoted text' /usr/bin local /usr/bin
+echo echo awk export
+&& printf /usr/bin | test printf "$@" ${HOME} &&
+		-eu cd sed ${HOME} export grep && local export 2>/dev/null -eu export x=1 done
+		grep "$1" --verbose | "$@" ${HOME} $(pwd) then test echo "$@" sed printf -eu
+	export sed done /usr/bin test 'quoted text' "$@"
+echo grep local x=1 test /usr/bin
+	cd then readonly x=1 "$1" test test done "$@"
+	then && -eu --verbose done cd "$1"
+"$@" then -eu echo readonly test test
+	x=1 --verbose printf readonly grep cd echo $(pwd) 'quoted text'
+printf done grep then x=1 export awk "$@" test
+	"$1" echo then sed $(pwd) sed x=1 "$@" -eu "$@" "$1" printf
+	awk 2>/dev/null --verbose 'quoted text' "$1" sed
+	then echo local then /usr/bin grep -eu done -eu
+$(pwd) export local test then test --verbose "$@" done
+	${HOME} grep local awk local
+awk readonly cd 2>/dev/null readonly grep "$@" | readonly &&
+		cd then export test grep 'quoted text' "$@" "$@" -eu $(pwd) readonly grep
+	echo | $(pwd) readonly cd --verbose x=1 awk echo cd x=1 "$@" grep --verbose
+	sed local then printf ${HOME} test 'quoted text' echo --verbose printf
+$(pwd) then awk 'quoted text' $(pwd) echo then | done /usr/bin done readonly cd
+export "$@" "$1" local sed awk test then $(pwd) cd awk done 2>/dev/null
+	'quoted text' 2>/dev/null | --verbose "$@" grep readonly awk printf readonly
+		sed | && | $(pwd) | done $(pwd) printf test x=1 'quoted text' $(pwd) cd | ${HOME}
+readonly $(pwd) ${HOME} grep printf echo $(pwd) 2>/dev/null
+then 'quoted text' -eu
+"$@" done | local --verbose local grep export readonly && sed
+-eu local x=1 "$@" "$1" -eu "$@" 'quoted text' export cd awk --verbose done then
+		printf cd --verbose $(pwd)
+	local cd 2>/dev/null sed "$@" | export |
+"$@" $(pwd) "$1" test 'quoted text' $(pwd) $(pwd) test "$1"
+export $(pwd) test awk cd sed awk printf 2>/dev/null printf x=1 sed | "$1"
+	${HOME} awk awk printf grep
+	grep "$@" && ${HOME} /usr/bin x=1 readonly printf $(pwd)
+		--verbose sed ${HOME} && ${HOME} 2>/dev/null --verbose export
+		2>/dev/null --verbose awk && -eu echo printf export then --verbose cd done local
+	-eu done && awk sed x=1 test && -eu
+		test cd 2>/dev/null "$@"
+grep --verbose export x=1 "$1" cd /usr/bin
+		export x=1 'quoted text' x=1 echo sed
+	"$@" "$1" | sed export echo readonly done echo cd grep test done test x=1
+${HOME} printf echo readonly 'quoted text' printf --verbose /usr/bin
+"$1" ${HOME} 2>/dev/null "$1" export 'quoted text' | ${HOME} ${HOME}
+printf sed readonly printf 2>/dev/null export $(pwd) done
+done sed "$1" echo "$1" -eu 2>/dev/null | ${HOME} -eu ${HOME} test sed export |
+"$@" -eu "$1" /usr/bin cd "$1" done 2>/dev/null x=1 --verbose done x=1 --verbose
+done printf 'quoted text' done 'quoted text' ${HOME} $(pwd) 2>/dev/null 'quoted text'
+	printf sed $(pwd) grep && 'quoted text' 'quoted text' local
+		"$1" sed printf ${HOME} 2>/dev/null test cd
+x=1 local printf done test
+	"$1" /usr/bin readonly local 2>/dev/null cd done ${HOME} readonly cd | grep
+		local readonly 'quoted text' 2>/dev/null
+	| test ${HOME} "$@" "$@" && sed | --verbose $(pwd)
+		"$1" export --verbose /usr/bin | awk done ${HOME} && 2>/dev/null -eu "$@"
+2>/dev/null "$1" 'quoted text' cd test export then /usr/bin "$1" "$1" readonly
+	cd "$1" cd done sed awk readonly --verbose local "$@" cd cd x=1 && "$1" |
+		'quoted text' printf done readonly /usr/bin "$@" 2>/dev/null -eu readonly 2>/dev/null
+	2>/dev/null 2>/dev/null then then export printf echo cd
+	--verbose "$@" cd sed awk readonly x=1 x=1 "$1" | export
+		$(pwd) 2>/dev/null printf test ${HOME} x=1 'quoted text' awk
+&& && 'quoted text' awk test echo echo echo
+		echo echo -eu cd sed && echo grep --verbose test printf
+		"$1" grep $(pwd) awk && 2>/dev/null
+	--verbose done printf test ${HOME} local && local /usr/bin local
+	x=1 -eu x=1 readonly ${HOME} | echo 'quoted text' local awk
+	-eu --verbose readonly -eu | printf
+	${HOME} echo | -eu printf --verbose --verbose
+	| x=1 -eu grep -eu 2>/dev/null "$@" readonly "$1"
+	local $(pwd) done x=1 export
+	"$1" && && readonly $(pwd) && x=1 then | export
+		/usr/bin "$1" $(pwd) then ${HOME} done 2>/dev/null printf
+		--verbose 'quoted text' && test 'quoted text' "$1"
+		$(pwd) 'quoted text' ${HOME} "$@" /usr/bin export cd ${HOME} readonly export
+printf /usr/bin 'quoted text' grep 2>/dev/null /usr/bin awk printf export
+		test && "$1" done -eu "$@" grep --verbose printf
+	awk cd "$1" readonly awk printf export then x=1
+	cd awk export cd "$@" x=1 --verbose
+	${HOME} grep /usr/bin readonly -eu $(pwd) /usr/bin echo 2>/dev/null
+		awk /usr/bin /usr/bin readonly
+then sed then awk awk grep "$1" readonly && && /usr/bin readonly
+$(pwd) $(pwd) test $(pwd) --verbose awk --verbose x=1 "$1" then && | local $(pwd)
+	done echo grep -eu echo --verbose printf
+	x=1 -eu | 2>/dev/null done 'quoted text'
+	then | x=1 done $(pwd) -eu 'quoted text' 2>/dev/null cd ${HOME} --verbose
+-eu /usr/bin done done test -eu
+| 2>/dev/null 'quoted text' x=1 /usr/bin x=1 x=1 awk readonly x=1 then
+	cd --verbose sed && | sed printf readonly echo
+'quoted text' readonly x=1 ${HOME}
+	&& awk 'quoted text' echo /usr/bin && ${HOME} --verbose local /usr/bin
+		/usr/bin /usr/bin export sed local done 2>/dev/null ${HOME} 2>/dev/null /usr/bin
+	&& && /usr/bin grep then awk cd "$@" echo
+		printf "$@" echo --verbose echo grep export
+	local readonly grep $(pwd) "$1" 'quoted text' -eu --verbose done sed $(pwd)
+'quoted text' then export done
+--verbose echo --verbose done $(pwd)
+		${HOME} readonly ${HOME} awk /usr/bin local x=1 2>/dev/null
+		${HOME} sed --verbose printf
+	"$@" export sed $(pwd) sed | cd x=1 x=1
+		then echo then ${HOME} local | echo
+sed readonly "$1" x=1 then echo echo -eu printf cd --verbose
+		"$@" readonly -eu 2>/dev/null
+export echo printf done awk sed
+		local $(pwd) x=1 -eu "$1" export then
+		test test 'quoted text' /usr/bin "$@" 2>/dev/null x=1 2>/dev/null
+		then 2>/dev/null readonly && readonly printf test sed $(pwd) echo
+2>/dev/null done readonly "$1" cd ${HOME} 'quoted text' cd local | test then
+/usr/bin --verbose sed "$1" echo $(pwd) grep readonly cd $(pwd) && ${HOME}
+		x=1 grep | x=1 export x=1 export "$@" && x=1 readonly printf echo &&
+echo readonly readonly ${HOME} /usr/bin ${HOME} export
+$(pwd) done grep 2>/dev/null local 'quoted text' awk x=1 export
+		export then sed export local local then $(pwd) export && -eu export readonly
+		test /usr/bin awk export --verbose
+		--verbose awk /usr/bin local local -eu
+	$(pwd) --verbose ${HOME} awk && local then
+		x=1 export readonly 2>/dev/null done echo "$@" sed
+		grep readonly /usr/bin "$1" $(pwd) printf && export cd "$@" && "$@" $(pwd) &&
+	-eu | "$1" 2>/dev/null
+grep printf -eu 2>/dev/null -eu sed 'quoted text' test --verbose
+	-eu | awk --verbose -eu test readonly && export
+-eu $(pwd) cd && "$@" --verbose cd -eu "$@" && && "$@" /usr/bin
+	printf && "$@" | && local "$1" done | 2>/dev/null echo x=1 "$@"
+	printf "$1" "$@" $(pwd) -eu printf
+		'quoted text' printf $(pwd) "$@" "$1" cd
+test -eu printf cd cd ${HOME} cd | printf readonly 'quoted text' echo $(pwd)
+		x=1 "$1" "$@" 2>/dev/null "$@" test
+x=1 printf ${HOME} cd -eu x=1 test x=1 export $(pwd) awk && export
+	cd "$@" 'quoted text' -eu sed awk 2>/dev/null 2>/dev/null cd readonly
+	/usr/bin ${HOME} && printf ${HOME}
+	&& printf x=1 | --verbose --verbose awk cd export printf sed | readonly | ${HOME}
+echo sed "$1" ${HOME} export $(pwd) x=1
+		x=1 | test export printf -eu 'quoted text' --verbose "$@" local
+	"$1" local -eu echo cd awk ${HOME} "$@" 2>/dev/null readonly grep awk
+	&& readonly -eu --verbose printf --verbose |
+/usr/bin ${HOME} $(pwd) ${HOME} echo done x=1 2>/dev/null test local "$@" && export
+		2>/dev/null then sed then -eu export readonly --verbose -eu then sed --verbose 'quoted text'
+		"$1" cd --verbose printf "$@"
+		test x=1 --verbose grep cd readonly --verbose readonly export 2>/dev/null export
+		printf local --verbose --verbose /usr/bin
+		sed -eu done local /usr/bin
+cd sed test x=1 "$1" printf local done readonly /usr/bin
+		export awk printf readonly awk | --verbose | /usr/bin -eu cd cd
+	sed -eu ${HOME} /usr/bin ${HOME} readonly
+"$@" done | test && x=1 x=1 ${HOME} cd echo export ${HOME}
+		printf printf -eu sed "$@" /usr/bin local cd test x=1 awk then local
+	| sed --verbose local -eu -eu cd "$@" export sed && | grep test test
+	cd cd && ${HOME} printf grep | ${HOME} 2>/dev/null "$1"
+		'quoted text' -eu cd then
+'quoted text' && export $(pwd) test then && readonly then done
+cd test done echo test x=1 | "$@" echo grep readonly sed test then then sed ${HOME}
+	cd readonly 2>/dev/null ${HOME} 'quoted text' |
+		test done then sed && local x=1 "$1" | "$1" cd | then ${HOME}
+		&& x=1 done local cd $(pwd) "$1" export ${HOME} && cd local readonly
+		/usr/bin x=1 | done then ${HOME} /usr/bin ${HOME} echo $(pwd) -eu x=1
+		-eu /usr/bin 2>/dev/null "$1" && cd "$@" export
+	$(pwd) then cd then local "$1" -eu readonly
+		2>/dev/null x=1 x=1 "$@" 2>/dev/null | /usr/bin x=1 done test
+		then 'quoted text' -eu
+		/usr/bin ${HOME} readonly local
+	'quoted text' sed sed printf -eu cd -eu
+then --verbose test awk x=1 x=1 --verbose $(pwd) test --verbose
+		x=1 --verbose --verbose grep /usr/bin
+cd 2>/dev/null then -eu export local
+	2>/dev/null readonly "$1" x=1 ${HOME} echo sed $(pwd) then export
+		${HOME} /usr/bin ${HOME} cd readonly echo awk 2>/dev/null /usr/bin
+		2>/dev/null /usr/bin "$@" done grep 'quoted text'
+		local sed 'quoted text' cd ${HOME} 2>/dev/null "$@" "$@" echo grep then "$1"
+		echo --verbose x=1 printf done printf grep
+local readonly $(pwd) awk "$@" $(pwd)
+local "$1" awk | echo /usr/bin
+		local printf 2>/dev/null
+	'quoted text' x=1 export
+		/usr/bin echo 'quoted text' -eu
+		$(pwd) printf export /usr/bin then "$@" local && 'quoted text' local "$@" local
+x=1 local sed local 2>/dev/null x=1 awk sed /usr/bin $(pwd) 'quoted text' local
+	then echo sed cd x=1 $(pwd) done local export
+-eu test ${HOME} --verbose ${HOME} test export |
+		2>/dev/null then printf cd export && -eu export ${HOME} 2>/dev/null
+	--verbose --verbose x=1 awk | local cd ${HOME}
+done sed export grep done sed x=1 cd
+		2>/dev/null -eu awk echo "$1" "$@"
+grep && local $(pwd) grep 2>/dev/null
+test cd && cd ${HOME} sed x=1 ${HOME} sed 'quoted text' /usr/bin -eu x=1 $(pwd)
+	readonly printf && --verbose $(pwd)
+echo "$@" local 2>/dev/null grep $(pwd) test ${HOME} "$@" && test
+		/usr/bin echo x=1 | ${HOME} "$@" done grep --verbose ${HOME} "$1"
+		x=1 /usr/bin | ${HOME} -eu /usr/bin cd "$@" "$1" echo local cd awk $(pwd) grep
+		-eu -eu readonly printf | export local readonly
+		--verbose /usr/bin export "$1" 'quoted text'
+	--verbose /usr/bin "$@" /usr/bin && --verbose -eu | $(pwd) 'quoted text'
+	| printf 'quoted text' "$1" done 'quoted text' then "$1" /usr/bin "$1"
+		printf /usr/bin 2>/dev/null "$1" echo | cd local "$1" echo echo then export local
+grep test sed echo grep "$1" echo awk awk
+${HOME} test | 'quoted text' test "$1" local x=1 readonly
+done 'quoted text' && readonly 'quoted text'
+		awk readonly test echo x=1
+	-eu -eu grep readonly x=1
+x=1 /usr/bin awk local local cd echo readonly export $(pwd) "$@" local then then
+echo --verbose -eu --verbose /usr/bin x=1 ${HOME}
+then 'quoted text' x=1 -eu test sed echo export $(pwd) grep export | grep
+	sed test /usr/bin 'quoted text' /usr/bin echo grep -eu --verbose -eu --verbose
+		| ${HOME} && && | | x=1 /usr/bin --verbose $(pwd)
+	--verbose readonly export readonly x=1 "$1" | -eu cd export readonly
+	x=1 cd printf echo "$1" readonly done then export cd grep -eu --verbose "$1"
+echo x=1 x=1 "$@" sed | "$1" grep done then && then grep echo
+${HOME} test echo readonly && "$@" "$@" --verbose "$1" "$@" "$1" awk
+local test | grep export test then "$@" local --verbose done 2>/dev/null
+	-eu | readonly /usr/bin
+| awk readonly echo --verbose awk
+	"$@" cd then cd sed -eu 2>/dev/null done
+		sed cd printf then readonly ${HOME} export 2>/dev/null "$@" 'quoted text'
+	"$1" then ${HOME} local $(pwd) grep cd local sed 'quoted text' "$1" -eu cd
+		grep cd readonly then export
+		| --verbose && export
+grep then cd export | 'quoted text' "$@" awk 2>/dev/null -eu done sed 'quoted text'
+printf readonly "$@" export && && readonly -eu 2>/dev/null ${HOME} && readonly
+	$(pwd) x=1 /usr/bin then | "$1" 2>/dev/null then 2>/dev/null
+echo --verbose export test "$1" /usr/bin
+readonly -eu ${HOME} && sed $(pwd) | printf printf echo | awk "$@" && ${HOME}
+then grep ${HOME} printf 2>/dev/null
+&& test local $(pwd) awk readonly 2>/dev/null echo "$@" /usr/bin x=1 'quoted text'
+&& cd test done then x=1 ${HOME} then "$@"
+	awk "$1" | 'quoted text' awk && cd && grep "$@" x=1
+		'quoted text' sed sed readonly
+printf 'quoted text' sed /usr/bin -eu x=1 awk echo 2>/dev/null
+done awk test ${HOME} printf
+	$(pwd) echo "$@" /usr/bin test $(pwd)
+&& printf $(pwd) then awk awk /usr/bin test export test
+		${HOME} local $(pwd) "$1" export -eu && readonly --verbose test local
+	/usr/bin 2>/dev/null sed -eu sed -eu
+	readonly done cd echo awk sed awk printf "$@" grep
+		$(pwd) grep then local printf
+		${HOME} --verbose -eu "$@" printf $(pwd) && awk
+		grep printf && x=1 then printf && && -eu 'quoted text' printf done grep "$1" done
+sed export then readonly printf /usr/bin "$@"
+		2>/dev/null local 'quoted text' grep $(pwd) x=1 local test awk cd test ${HOME}
+		echo $(pwd) readonly printf readonly | 2>/dev/null grep
+	"$1" x=1 cd "$1" /usr/bin export done --verbose x=1 -eu sed printf then
+		"$@" "$@" local "$@" sed | 2>/dev/null
+	readonly "$@" 2>/dev/null ${HOME} printf awk export "$1" local awk
+	cd -eu -eu export | readonly 'quoted text' /usr/bin 'quoted text'
+grep /usr/bin then grep done /usr/bin then x=1 $(pwd) 'quoted text' grep
+		awk export test | local /usr/bin 2>/dev/null done
+sed echo sed export ${HOME} | && then "$@"
+--verbose $(pwd) test readonly /usr/bin test sed "$1" 'quoted text' done
+		export 'quoted text' then export printf test echo test local readonly awk test
+		readonly grep sed "$1" 'quoted text' 'quoted text' $(pwd)
+		$(pwd) test test awk cd printf
+	done 2>/dev/null 'quoted text' done awk /usr/bin local --verbose --verbose
+	&& done echo grep x=1 2>/dev/null && awk export echo cd -eu ${HOME} x=1 | export
+	/usr/bin done $(pwd) x=1 test 2>/dev/null "$1" -eu -eu -eu awk
+--verbose readonly /usr/bin | $(pwd) "$@"
+awk "$@" && cd && then sed 'quoted text' test awk export 2>/dev/null sed
+		&& then x=1 awk printf cd export --verbose $(pwd) echo --verbose
+grep export readonly echo | 2>/dev/null
+		"$1" local x=1 "$@" -eu | $(pwd) | 'quoted text' sed
+		then 2>/dev/null then "$@" x=1 export 2>/dev/null $(pwd) printf done -eu local awk
+		then "$@" x=1 | "$1" test local then --verbose ${HOME} 2>/dev/null grep "$1"
+-eu sed grep 2>/dev/null --verbose cd readonly readonly ${HOME} awk /usr/bin
+		echo grep $(pwd) ${HOME}
+	| $(pwd) printf then readonly grep local --verbose printf x=1 then /usr/bin
+		"$1" readonly 2>/dev/null local $(pwd) --verbose export
+		readonly grep grep x=1
+-eu | cd local test then grep "$@" $(pwd) /usr/bin -eu cd && x=1 x=1
+		test | printf /usr/bin ${HOME}
+&& then sed ${HOME} /usr/bin -eu printf printf grep 2>/dev/null readonly
+	--verbose grep ${HOME} export cd sed 'quoted text' local cd | 'quoted text'
+&& -eu readonly -eu test done && sed
+sed readonly local -eu awk awk --verbose 2>/dev/null readonly 2>/dev/null
+2>/dev/null 'quoted text' 2>/dev/null 2>/dev/null
+x=1 "$@" && done "$1" -eu
+&& readonly 2>/dev/null --verbose export
+	${HOME} then test done then printf
+	printf -eu "$@" awk cd then "$1" echo then $(pwd) "$1" 2>/dev/null
+	${HOME} test export then "$@" --verbose
+	/usr/bin $(pwd) 'quoted text' 2>/dev/null && 'quoted text'
+		readonly | | /usr/bin 'quoted text' grep -eu readonly --verbose
+	"$@" "$1" 2>/dev/null ${HOME} then printf local "$@" then local then
+		/usr/bin && "$@" awk
+$(pwd) echo | /usr/bin then -eu sed then cd echo echo | && --verbose && export
+"$1" export ${HOME} ${HOME} /usr/bin cd then ${HOME} && 2>/dev/null $(pwd)
+		-eu sed "$1" --verbose -eu ${HOME}
+		done export readonly "$@" 2>/dev/null ${HOME} ${HOME} grep --verbose /usr/bin
+		'quoted text' grep sed grep "$@"
+	&& then $(pwd) then printf grep readonly done then ${HOME}
+	--verbose -eu /usr/bin && export 'quoted text'
+--verbose export printf grep /usr/bin sed 2>/dev/null
+		echo 'quoted text' grep && -eu x=1 $(pwd) done x=1 test
+	printf ${HOME} test ${HOME} awk cd done /usr/bin printf export 2>/dev/null
+		sed "$@" /usr/bin x=1
+	x=1 sed echo 2>/dev/null
+		sed /usr/bin 2>/dev/null /usr/bin --verbose -eu $(pwd) $(pwd) x=1 done done x=1
+done test 2>/dev/null && readonly
+		$(pwd) 2>/dev/null | grep done done "$@" cd && ${HOME} then echo test ${HOME} /usr/bin
+		"$1" "$1" 'quoted text'
+$(pwd) local echo then && printf then 2>/dev/null sed "$@" done $(pwd) sed
+printf readonly echo 2>/dev/null ${HOME} readonly
+		x=1 cd export echo ${HOME} && 2>/dev/null echo /usr/bin 2>/dev/null
+	export test "$1" awk awk grep /usr/bin /usr/bin "$1" sed -eu x=1 sed grep
+		-eu 'quoted text' local x=1 'quoted text' done grep cd then 2>/dev/null
+		$(pwd) "$1" printf sed echo && "$1" grep -eu "$1" awk cd "$1"
+	echo /usr/bin --verbose export && printf "$1" echo
+awk cd awk "$@" && printf "$1"
+x=1 awk x=1 test then --verbose sed 'quoted text'
+		--verbose 2>/dev/null echo echo local x=1 | test && "$1" x=1 grep 'quoted text'
+		readonly sed cd 2>/dev/null "$1"
+sed echo $(pwd) /usr/bin | 'quoted text' 'quoted text' --verbose
+done echo /usr/bin printf | export &&
+&& ${HOME} sed local && "$@" sed 'quoted text'
+"$@" --verbose echo "$1" grep
+export echo x=1 done then export awk
+	2>/dev/null then | /usr/bin
+2>/dev/null | 'quoted text' ${HOME} local 'quoted text'
+printf echo $(pwd) local then | done -eu echo 2>/dev/null
+		cd cd /usr/bin 'quoted text' "$1" grep sed printf readonly
+	"$@" test then export done
+	printf -eu x=1 local printf
+/usr/bin echo && "$1" "$@" export "$1" cd awk test -eu 'quoted text'
+| local printf printf "$1" printf
+		"$@" local $(pwd) then 'quoted text' $(pwd) grep
+| "$1" 'quoted text' 'quoted text'
+	readonly printf 2>/dev/null echo awk
+		grep 2>/dev/null local printf awk 2>/dev/null ${HOME}
+		--verbose echo echo cd "$@" 2>/dev/null sed done -eu echo cd
+	readonly $(pwd) cd "$1" -eu grep then
+printf --verbose test --verbose test awk done awk -eu test awk test
+		| "$1" ${HOME} x=1 echo 'quoted text'
+cd 'quoted text' x=1 printf
+	--verbose sed readonly sed x=1 /usr/bin 2>/dev/null 'quoted text' export test
+		"$@" $(pwd) ${HOME} then
+	test && done done export
+		'quoted text' x=1 readonly /usr/bin then cd readonly | export
+		sed cd | then ${HOME} readonly
+		awk awk printf x=1 grep readonly done echo local "$1" local export --verbose 'quoted text'
+		export local readonly then && x=1
+	awk grep --verbose /usr/bin ${HOME} done --verbose cd -eu /usr/bin local
+'quoted text' sed sed "$1" sed local 2>/dev/null
+x=1 then local x=1 $(pwd) ${HOME} export $(pwd) /usr/bin cd
+		"$1" /usr/bin sed /usr/bin /usr/bin "$1" grep 'quoted text' local
+"$@" /usr/bin && grep sed readonly echo --verbose
+sed test -eu readonly done grep && ${HOME}
+	2>/dev/null sed printf export grep "$@"
+${HOME} sed echo echo local grep -eu --verbose export local && sed echo
+	/usr/bin readonly $(pwd) printf grep cd local cd done 2>/dev/null &&
+-eu /usr/bin 2>/dev/null test printf readonly sed "$@" echo
+		&& --verbose cd sed local 2>/dev/null export 'quoted text' "$1" test x=1 export
+printf "$1" sed "$1" && | echo export --verbose && "$@" cd x=1 && --verbose
+		2>/dev/null /usr/bin ${HOME} readonly "$1" 'quoted text' 2>/dev/null
+		$(pwd) export done ${HOME} local awk $(pwd) awk
+export local "$1" done $(pwd) export
+		"$@" "$1" 'quoted text' | readonly x=1 "$1" sed && awk -eu $(pwd)
+		${HOME} $(pwd) 2>/dev/null echo
+		readonly sed awk echo grep 2>/dev/null ${HOME} x=1 'quoted text'
+test 2>/dev/null 'quoted text' sed ${HOME} 2>/dev/null
+	2>/dev/null --verbose -eu grep -eu | grep awk /usr/bin cd test ${HOME}
+| then ${HOME} test awk done test | sed cd 2>/dev/null "$@" done ${HOME}
+"$1" echo readonly && grep
+		"$1" then awk then && 2>/dev/null --verbose -eu | done ${HOME} 2>/dev/null
+	| grep "$1" sed grep cd done grep then --verbose grep readonly 2>/dev/null
+$(pwd) awk 'quoted text' | -eu test done
+		| cd test /usr/bin cd 2>/dev/null 2>/dev/null $(pwd) done
+	awk ${HOME} --verbose "$@" cd ${HOME} 2>/dev/null | export
+	cd sed /usr/bin done sed readonly $(pwd) x=1 "$@"
+"$1" done local "$@" x=1 --verbose
+		"$@" sed x=1 awk echo 2>/dev/null sed 2>/dev/null
+	${HOME} export x=1 done echo grep
+	$(pwd) cd grep local "$@" export "$@" sed --verbose
+		awk && 2>/dev/null readonly awk
+		$(pwd) local cd readonly --verbose $(pwd) x=1 done printf sed -eu "$1" --verbose
+	local --verbose --verbose printf local $(pwd) 'quoted text'
+	export done cd /usr/bin done ${HOME} 'quoted text' && --verbose
+		-eu "$1" 2>/dev/null x=1 'quoted text'
+		local 2>/dev/null /usr/bin $(pwd)
+	local 'quoted text' ${HOME} grep 'quoted text' 'quoted text' done --verbose awk
+	&& "$@" grep test | "$@" done --verbose
+	then readonly cd --verbose grep --verbose
+		printf 2>/dev/null test /usr/bin done printf test echo x=1
+--verbose "$@" awk -eu export /usr/bin /usr/bin
+"$1" x=1 'quoted text' /usr/bin grep readonly cd && "$@" local grep 2>/dev/null
+		readonly cd ${HOME} && sed -eu readonly awk export
+		&& readonly | local done
+		sed --verbose --verbose --verbose
+		&& awk sed then sed 'quoted text' && local local $(pwd) --verbose "$@"
+	echo awk /usr/bin done /usr/bin --verbose then
+		&& "$@" then then $(pwd)
+	-eu cd "$@" done && sed then printf awk sed -eu $(pwd) x=1 readonly
+		${HOME} && printf ${HOME} -eu cd export cd
+	2>/dev/null readonly "$1" done
+	readonly ${HOME} printf printf | echo sed
+cd 2>/dev/null 'quoted text' $(pwd)
+		$(pwd) export --verbose sed awk test -eu echo "$1" echo local ${HOME} x=1 sed
+cd grep $(pwd) --verbose ${HOME} cd cd && /usr/bin grep /usr/bin
+	readonly ${HOME} /usr/bin "$@" sed 'quoted text' 'quoted text'
+	grep cd x=1 then 2>/dev/null readonly | ${HOME} done local echo awk printf
+		sed done sed done local /usr/bin done cd && $(pwd)
+${HOME} local "$1" awk && awk "$1" local 'quoted text' then "$1" "$1"
+	sed export "$1" awk printf | 'quoted text' && echo then x=1 local export
+"$1" -eu /usr/bin export "$1" 2>/dev/null local --verbose
+		printf sed && x=1 'quoted text' "$@" x=1
+-eu && readonly then local x=1 'quoted text'
+test awk export then ${HOME} $(pwd) x=1 -eu test | 2>/dev/null "$1" | done export
+		then 'quoted text' | grep | "$@"
+		"$@" "$@" | export && --verbose x=1 /usr/bin awk done 'quoted text'
+readonly test | readonly 2>/dev/null -eu awk awk then test $(pwd)
+	cd $(pwd) $(pwd) then "$1" done grep cd -eu
+readonly then 2>/dev/null 'quoted text' /usr/bin ${HOME} echo /usr/bin printf
+	| $(pwd) cd 'quoted text'
+		-eu awk test ${HOME} printf 'quoted text' test readonly sed readonly echo -eu "$@"
+	${HOME} export /usr/bin
+	x=1 test 2>/dev/null /usr/bin done
+-eu printf $(pwd) | -eu 'quoted text'
+		${HOME} ${HOME} readonly sed | 'quoted text'
+	/usr/bin --verbose echo sed -eu $(pwd) "$1" "$@" "$@" && export "$1" ${HOME}
+local local test --verbose
+local local $(pwd) test echo | printf
+		sed /usr/bin ${HOME} printf 2>/dev/null x=1 then -eu 2>/dev/null
+	cd /usr/bin sed done 2>/dev/null
+echo grep && 'quoted text' done done test
+	$(pwd) printf "$1" sed -eu grep
+		$(pwd) export printf x=1 printf /usr/bin done export local test x=1
+		"$@" export 2>/dev/null "$1" | then /usr/bin x=1 test "$1" cd test --verbose cd
+		/usr/bin $(pwd) sed "$1" readonly "$@"
+	sed $(pwd) 'quoted text' ${HOME} readonly
+		-eu /usr/bin printf -eu cd grep $(pwd) readonly -eu echo echo --verbose
+"$@" printf /usr/bin "$@" $(pwd) readonly
+		grep --verbose /usr/bin && && grep then /usr/bin 2>/dev/null local "$1" "$@"
+	--verbose $(pwd) cd 2>/dev/null 2>/dev/null
+	-eu "$1" 2>/dev/null /usr/bin
+		x=1 then x=1 sed sed /usr/bin | "$1"
+export /usr/bin 'quoted text' "$@" readonly grep
+readonly $(pwd) printf printf then
+done awk x=1 export test cd 2>/dev/null "$1" printf export /usr/bin $(pwd) done
+		then awk x=1 echo && then ${HOME} sed echo local | -eu printf awk echo
+-eu x=1 "$1" local done
+		/usr/bin local 'quoted text' $(pwd) "$1" done 'quoted text' "$1"
+		${HOME} local $(pwd) $(pwd) awk 'quoted text' local
+		--verbose then sed grep awk $(pwd) readonly
+		/usr/bin 'quoted text' && ${HOME}
+		&& local grep then /usr/bin export
+		--verbose 2>/dev/null && printf "$1" echo 'quoted text' --verbose |
+		| --verbose "$1" ${HOME} | test
+		grep printf echo echo x=1 | readonly | "$@"
+	sed 2>/dev/null export local $(pwd) then | --verbose printf /usr/bin sed sed export
+	/usr/bin /usr/bin readonly echo -eu test && | 2>/dev/null
+local x=1 'quoted text' 2>/dev/null readonly x=1 "$@" test /usr/bin awk --verbose
+	'quoted text' x=1 --verbose printf --verbose cd && && grep printf
+	${HOME} $(pwd) x=1 /usr/bin local sed readonly "$@" grep readonly
+grep "$1" echo ${HOME} sed
+2>/dev/null --verbose ${HOME} "$1" test $(pwd) -eu && then
+	readonly x=1 | x=1 -eu awk awk readonly grep done readonly grep test /usr/bin
+	2>/dev/null readonly --verbose
+&& grep 'quoted text' echo local sed $(pwd) "$1"
+-eu "$1" printf local "$1" local && export test echo readonly --verbose echo
+	"$1" && 'quoted text' /usr/bin printf ${HOME} $(pwd) done "$@"
+	export done awk grep then
+	/usr/bin grep && --verbose cd cd echo
+grep "$1" $(pwd) 'quoted text' -eu $(pwd)
+echo 2>/dev/null done printf 'quoted text' --verbose test test done 'quoted text'
+		-eu x=1 then --verbose --verbose cd local --verbose test
+	| done echo cd export "$1"
+		--verbose && grep --verbose cd | /usr/bin grep printf $(pwd)
+	x=1 test 'quoted text' x=1 done ${HOME} cd /usr/bin
+		export x=1 $(pwd) 'quoted text' --verbose -eu
+	export "$1" && done grep x=1 x=1 2>/dev/null readonly
+	'quoted text' then awk then 2>/dev/null
+		/usr/bin awk ${HOME} | && echo $(pwd) sed grep
+		--verbose test ${HOME} local -eu
+"$@" cd ${HOME} x=1 done sed done ${HOME}
+awk grep | 2>/dev/null 2>/dev/null 2>/dev/null --verbose
+		/usr/bin -eu sed $(pwd) "$1" awk ${HOME}
+		cd local local local x=1 echo x=1 awk done
+	local grep export $(pwd)
+	x=1 "$@" sed local test grep /usr/bin
+	done $(pwd) 2>/dev/null echo then -eu -eu done cd printf export then
+		cd local readonly grep test $(pwd) readonly
+		printf sed grep && "$1" printf -eu cd
+local export grep echo then | && export
+	printf | echo then cd readonly echo 2>/dev/null "$@" ${HOME}
+	| -eu sed test 'quoted text' -eu export grep cd cd readonly
+		x=1 /usr/bin then export sed cd cd -eu then sed then cd | echo local $(pwd) local
+	${HOME} "$1" grep "$@" echo -eu $(pwd) export "$@" x=1 --verbose
+		export /usr/bin && done printf 'quoted text' &&
+	export cd printf cd grep 'quoted text' printf
+		done ${HOME} | test awk | 2>/dev/null sed 2>/dev/null ${HOME}
+	test | /usr/bin -eu then export readonly printf export 'quoted text'
+awk $(pwd) printf 'quoted text' test export 2>/dev/null "$1" x=1 then $(pwd) --verbose
+		then "$@" printf grep export /usr/bin export $(pwd) "$1" -eu | then
+x=1 "$1" && -eu cd local
+	echo x=1 && grep x=1 cd grep printf
+/usr/bin done "$@" 2>/dev/null sed export
+	"$1" "$@" 'quoted text' sed awk && x=1 x=1
+		cd then export readonly
+$(pwd) cd 'quoted text' ${HOME}
+x=1 x=1 "$1" then then
+	/usr/bin | local /usr/bin
+		local then ${HOME} cd $(pwd) cd --verbose grep grep /usr/bin /usr/bin test -eu
+		x=1 awk | cd 2>/dev/null "$1" test done echo test -eu "$1" test
+	$(pwd) printf then local ${HOME} grep cd then export --verbose echo
+		$(pwd) grep then /usr/bin echo export sed test "$@" awk local echo | test -eu 'quoted text'
+&& $(pwd) grep --verbose readonly "$@" done cd
+		'quoted text' sed done && --verbose echo && export
+		cd export /usr/bin -eu awk -eu printf x=1 grep export test
+		x=1 printf 'quoted text'
+$(pwd) 2>/dev/null --verbose
+	/usr/bin test $(pwd) "$@" printf x=1
+		&& cd "$1" sed -eu export cd export ${HOME}
+	then readonly echo "$1" ${HOME} printf grep done
+-eu | && export grep sed
+readonly grep test grep sed
+cd /usr/bin echo -eu "$@" --verbose sed | $(pwd)
+		echo "$@" printf 'quoted text' awk done $(pwd)
+		2>/dev/null ${HOME} test /usr/bin printf test
+readonly "$@" export export x=1 "$1" /usr/bin
+		echo done -eu "$1" cd awk cd "$1" 'quoted text'
+	local | ${HOME} then test test &&
+&& sed -eu done test && x=1 readonly x=1 export grep export
+	"$@" && x=1 -eu readonly "$@" "$@" "$1" printf 2>/dev/null
+		--verbose done x=1 grep done readonly export echo export then
+		"$@" local cd ${HOME} ${HOME} done
+grep local --verbose /usr/bin &&
+	"$@" readonly 2>/dev/null "$@" then x=1 -eu | grep --verbose
+	printf 2>/dev/null --verbose 2>/dev/null
+$(pwd) sed cd echo 2>/dev/null then
+--verbose local 'quoted text' echo cd cd "$@"
+-eu cd printf ${HOME} && --verbose done awk /usr/bin && "$1"
+	'quoted text' 2>/dev/null $(pwd) done printf grep readonly
+		local readonly | && x=1 cd done -eu local "$@" -eu "$1" local echo
+x=1 "$@" grep "$@" awk test 'quoted text'
+	test 2>/dev/null cd echo awk | printf export test x=1 --verbose ${HOME} test | ${HOME}
+	&& printf local cd echo awk grep /usr/bin echo readonly 2>/dev/null /usr/bin -eu
+	${HOME} grep ${HOME} awk -eu && ${HOME}
+		$(pwd) 2>/dev/null 2>/dev/null test echo && sed
+	local awk echo sed /usr/bin test | 2>/dev/null printf export awk |
+		printf "$@" -eu test -eu
+	"$@" local x=1 done then test
+awk printf export $(pwd) test export done done /usr/bin awk
+test test -eu "$@" cd cd
+echo readonly printf then printf readonly readonly readonly
+		test readonly local sed done x=1 'quoted text' cd | done awk export local
+	$(pwd) printf "$1" done sed cd | cd /usr/bin then
+	/usr/bin echo && 2>/dev/null x=1 /usr/bin
+		grep test echo printf cd echo readonly 'quoted text'
+		"$1" test /usr/bin /usr/bin awk echo sed sed echo printf -eu
+	readonly 'quoted text' export "$1"
+	| then | --verbose && printf "$@" awk cd | awk x=1 --verbose && "$1" cd echo cd
+		"$@" && grep | $(pwd) -eu 'quoted text' "$1" test --verbose --verbose "$1" /usr/bin
+	cd local awk --verbose -eu export test "$@" ${HOME} 2>/dev/null cd $(pwd) | --verbose
+	echo --verbose ${HOME} "$@" echo ${HOME} 2>/dev/null | printf cd
+		"$1" local then /usr/bin export $(pwd) $(pwd) $(pwd) | cd /usr/bin x=1 grep echo
+		cd 'quoted text' done export
+		2>/dev/null export local done test -eu done awk && /usr/bin local 2>/dev/null
+awk /usr/bin | grep echo
+		| -eu $(pwd) | then "$1" readonly 'quoted text'
+		printf /usr/bin grep cd done --verbose readonly test /usr/bin sed
+$(pwd) 'quoted text' 'quoted text' readonly
+	echo test then -eu local "$1" /usr/bin
+	'quoted text' /usr/bin "$@" sed | 2>/dev/null 'quoted text'
+awk 'quoted text' --verbose cd
+'quoted text' done "$1" ${HOME} cd x=1 export | | grep 'quoted text'
+		'quoted text' local x=1
+	| sed test awk "$@" done readonly done readonly export grep 2>/dev/null
+	/usr/bin local x=1 | 2>/dev/null --verbose ${HOME} -eu sed ${HOME} sed ${HOME}
+awk echo | awk export 2>/dev/null
+readonly ${HOME} | echo awk 2>/dev/null echo
+awk printf printf -eu && printf 'quoted text' /usr/bin | && x=1 sed
+		done ${HOME} local 'quoted text' "$@" "$@" local 'quoted text'
+		local /usr/bin ${HOME} x=1 x=1 awk "$1" -eu $(pwd) "$1" echo grep
+2>/dev/null local cd x=1 ${HOME} test
+		--verbose /usr/bin && then $(pwd)
+		printf readonly echo then x=1
+		--verbose "$@" x=1 x=1 && test then sed
+	cd local cd grep sed -eu echo --verbose done "$@" sed sed ${HOME} 'quoted text'
+"$1" printf export local 'quoted text'
+	test -eu test sed --verbose "$1" --verbose local /usr/bin export awk readonly
+		cd cd printf --verbose && 2>/dev/null local awk local
+sed readonly test readonly
+	local && grep x=1 printf export test cd done test x=1 local sed "$1" x=1 -eu echo
+		echo test "$1" ${HOME} done "$@" test echo printf awk
+	${HOME} cd 2>/dev/null export && printf sed
+	awk done --verbose $(pwd) 2>/dev/null
+&& sed --verbose -eu 'quoted text' 'quoted text' 'quoted text'
+2>/dev/null then "$@" awk export local readonly 2>/dev/null
+	$(pwd) sed cd readonly
+		awk sed 'quoted text' test sed 'quoted text' grep then $(pwd)
+sed $(pwd) | -eu ${HOME} cd x=1 echo cd grep printf --verbose
+echo && export /usr/bin "$1" $(pwd) then --verbose echo cd "$@" ${HOME}
+		2>/dev/null | "$1" then cd readonly readonly 2>/dev/null "$1" && export
+sed sed "$@" "$1" test $(pwd) export
+"$@" cd x=1 ${HOME} 'quoted text' 2>/dev/null cd "$1" x=1 done export && then
+		export test $(pwd) 2>/dev/null | readonly 2>/dev/null x=1 local ${HOME}
+test && cd readonly |
+		"$@" ${HOME} "$1" 'quoted text' readonly
+		printf sed -eu export done 'quoted text' &&
+		export /usr/bin --verbose x=1 |
+	2>/dev/null export grep "$1" -eu "$1" 'quoted text' -eu local echo then test
+	${HOME} then "$@" grep "$@"
+		--verbose printf done | readonly grep | --verbose
+		grep ${HOME} awk -eu ${HOME} done --verbose
+"$@" cd && && "$@" test /usr/bin "$1" -eu /usr/bin awk printf /usr/bin -eu
+	/usr/bin | readonly export
+| && 'quoted text' grep "$1" "$1" 'quoted text' 'quoted text'
+		$(pwd) "$@" grep --verbose printf /usr/bin
+		sed readonly awk export test
+grep readonly local $(pwd) awk then ${HOME} --verbose
+		awk x=1 --verbose readonly "$1" 2>/dev/null done &&
+	printf "$@" --verbose 'quoted text' printf 'quoted text'
+		"$1" sed 2>/dev/null ${HOME} done echo printf then
+	readonly $(pwd) | "$1" awk
+		| | local --verbose -eu echo echo /usr/bin
+		cd "$@" "$1" export 'quoted text' "$@" echo
+local && local sed echo 'quoted text' then grep ${HOME} 'quoted text'
+	cd done "$@" grep ${HOME} test && x=1 $(pwd) then cd cd /usr/bin
+		sed /usr/bin ${HOME} "$1" done "$@" 'quoted text' local then printf
+		| 2>/dev/null readonly
+local | local /usr/bin -eu $(pwd) $(pwd) --verbose --verbose "$1" awk 'quoted text'
+		2>/dev/null then echo readonly "$1" && ${HOME} sed local echo echo sed && 'quoted text'
+grep readonly local x=1 echo ${HOME} && && x=1 done
+	"$1" "$@" | test | x=1 $(pwd) && "$@" local $(pwd) "$1"
+		export printf -eu sed && x=1 --verbose
+x=1 cd readonly sed ${HOME} --verbose --verbose grep && echo
+		'quoted text' readonly $(pwd) 2>/dev/null ${HOME} /usr/bin --verbose
+done local 2>/dev/null done cd grep export then test ${HOME} cd then sed sed ${HOME}
+		awk "$1" $(pwd) && export 2>/dev/null
+		done "$@" 'quoted text' && then -eu echo printf "$1" 2>/dev/null && | cd awk
+	sed $(pwd) x=1 'quoted text' cd 2>/dev/null /usr/bin ${HOME} local ${HOME}
+	| --verbose x=1 awk echo
+	"$1" -eu printf local /usr/bin readonly | | x=1 sed
+awk | --verbose cd grep readonly "$@" "$@" && 2>/dev/null 'quoted text' echo
+sed x=1 local grep test x=1 x=1 readonly readonly
+		-eu grep echo $(pwd) done then --verbose
+	'quoted text' done ${HOME} /usr/bin test $(pwd) export local awk readonly
+	then 2>/dev/null echo 'quoted text' echo | awk 2>/dev/null sed done --verbose grep
+	x=1 readonly then "$@" $(pwd) 'quoted text' grep
+	grep grep "$@" && /usr/bin grep readonly echo "$@" 'quoted text'
+	done then readonly /usr/bin done readonly
+| "$1" sed local ${HOME} x=1 && printf export echo 'quoted text' awk awk local
+	echo 'quoted text' readonly /usr/bin echo sed readonly ${HOME} 'quoted text'
+then sed grep 'quoted text' test -eu "$@" "$@" local 'quoted text'
+'quoted text' local "$@" test
+	grep done done echo grep && --verbose
+		test cd local --verbose export local && test grep export sed export
+		"$1" export export echo printf echo && export
+		'quoted text' grep cd 'quoted text'
+		$(pwd) readonly ${HOME}
+$(pwd) readonly echo done local export test | grep printf --verbose sed --verbose
+	local printf "$1" -eu "$@" echo "$@" cd then 2>/dev/null
+	/usr/bin -eu 'quoted text' test readonly x=1 printf
+	"$@" "$@" then 'quoted text' "$@" export sed | ${HOME}
+	"$1" && 'quoted text'
+	readonly cd "$1" readonly printf grep x=1 $(pwd) cd $(pwd) ${HOME} x=1 "$1"
+		awk | test "$@" local grep cd printf sed local x=1
+		2>/dev/null "$1" 'quoted text' done sed x=1 test --verbose printf -eu
+		readonly $(pwd) "$@" --verbose
+		"$@" export readonly then local awk grep
+		/usr/bin cd | $(pwd) cd -eu
+	echo printf ${HOME} "$@" 2>/dev/null
+		done ${HOME} printf cd export then -eu "$@" then --verbose ${HOME} --verbose
+${HOME} ${HOME} /usr/bin "$@" test grep | local local 'quoted text'
+		test local && export cd sed
+		echo sed $(pwd) /usr/bin
+printf printf grep test export $(pwd)
+sed echo local -eu then x=1 'quoted text' readonly 'quoted text' "$1"
+		"$1" printf done ${HOME}
+	echo then awk printf 'quoted text' x=1 done
+then printf $(pwd) done cd printf then -eu x=1
+		sed test grep && 'quoted text' grep
+| 'quoted text' grep && done --verbose then readonly "$1" $(pwd) /usr/bin
+		test 'quoted text' | test sed ${HOME} x=1 x=1 -eu "$1" x=1 'quoted text'
+readonly "$1" | done --verbose $(pwd) echo cd readonly
+	export readonly echo 'quoted text' 'quoted text'
+	${HOME} test "$@" printf done cd then ${HOME} | /usr/bin readonly
+		test && | "$1" cd -eu x=1 grep cd x=1 readonly awk printf local test grep awk
+grep printf | then | 2>/dev/null
+	echo then then echo test echo -eu grep 2>/dev/null x=1 x=1 | local x=1
+		then "$1" $(pwd) "$1" $(pwd)
+	readonly local /usr/bin
+		echo ${HOME} -eu x=1 sed then echo
+	"$@" then readonly then -eu echo -eu && --verbose "$@"
+	done /usr/bin --verbose readonly x=1 "$1" && ${HOME} ${HOME} "$1"
+	"$1" --verbose sed printf done printf local 2>/dev/null && "$1" &&
+grep done && "$@" 'quoted text' $(pwd) 'quoted text' ${HOME} x=1 echo --verbose
+grep x=1 sed cd /usr/bin then test "$@" done -eu readonly $(pwd)
+	$(pwd) x=1 "$@" ${HOME} ${HOME} --verbose 'quoted text' test 2>/dev/null x=1
+	sed x=1 local "$@" && echo local
+$(pwd) export echo echo grep x=1
+		| echo export export 'quoted text'
+	grep /usr/bin $(pwd) /usr/bin done export
+		then done local grep then export local
+		export export $(pwd) 'quoted text' | --verbose
+		cd export printf "$1" --verbose $(pwd) done | 'quoted text' awk awk 2>/dev/null
+	/usr/bin $(pwd) cd test done $(pwd) awk -eu echo readonly done "$@"
+	printf local 'quoted text' "$1" done ${HOME} x=1 cd $(pwd) echo $(pwd) ${HOME}
+done then cd grep ${HOME} ${HOME} grep | awk grep | x=1 printf
+--verbose printf cd ${HOME} 2>/dev/null echo 'quoted text'
+		--verbose "$1" /usr/bin ${HOME} local -eu export
+test 2>/dev/null sed -eu printf sed export local /usr/bin --verbose then done
+grep awk "$@" | echo 'quoted text' grep "$@" grep sed readonly
+		x=1 test | --verbose grep --verbose printf sed
+	"$@" local --verbose sed printf test done "$1" then -eu && --verbose && printf
+	test /usr/bin x=1 | 'quoted text' cd --verbose $(pwd) "$1"
+		'quoted text' done && --verbose sed echo "$1" printf 'quoted text'
+--verbose 'quoted text' echo cd && | && /usr/bin 'quoted text' local
+	done cd export "$1" -eu sed /usr/bin -eu export test
+		awk test sed 'quoted text' && export cd cd readonly --verbose
+	/usr/bin cd ${HOME} test readonly
+grep sed 2>/dev/null 2>/dev/null --verbose $(pwd) "$@" x=1 sed grep && test test
+	done export "$@" readonly x=1 grep -eu /usr/bin test ${HOME} /usr/bin
+	cd then echo sed && 2>/dev/null readonly 2>/dev/null -eu grep && $(pwd) "$1"
+"$@" done && export done $(pwd) x=1 --verbose then --verbose
+$(pwd) --verbose --verbose ${HOME} test done 'quoted text'
+awk local echo export x=1 && grep
+		test printf $(pwd) done 'quoted text'
+		--verbose done 'quoted text' $(pwd) echo awk --verbose $(pwd)
+		cd done x=1 -eu awk "$@" cd ${HOME} 'quoted text' && export "$@" 'quoted text'
+	printf then grep cd | local 2>/dev/null
+		-eu grep --verbose cd && -eu ${HOME} export $(pwd) local awk local "$@" done
+		export 2>/dev/null $(pwd) $(pwd) grep printf test 2>/dev/null awk
+	done then readonly test done $(pwd) sed && /usr/bin awk test export "$@" cd
+		readonly --verbose done "$@" cd x=1 "$@" export
+		awk "$@" | echo awk test -eu cd test | -eu 2>/dev/null grep done ${HOME}
+	export local -eu grep grep done done "$1" done x=1 "$1" && then
+	cd /usr/bin /usr/bin "$1" done 'quoted text' /usr/bin ${HOME}
+	'quoted text' $(pwd) "$1" 2>/dev/null then cd --verbose grep
+	local awk readonly x=1 2>/dev/null && "$1" sed 2>/dev/null "$@" echo "$1"
+	local local done -eu "$@" && echo export && local echo
+	'quoted text' sed $(pwd) ${HOME} then
+	sed -eu echo export then x=1 2>/dev/null awk awk x=1
+local done 'quoted text' "$1" local cd then x=1 local local awk $(pwd)
+echo 'quoted text' $(pwd) done "$@" sed done
+	done --verbose -eu 'quoted text'
+		sed awk grep 'quoted text'
+	echo && ${HOME} | | 2>/dev/null printf | "$1" printf /usr/bin then -eu echo printf
+	| printf cd then cd then local "$@" sed
+/usr/bin test then && done ${HOME}
+readonly readonly $(pwd) printf printf
+	export grep /usr/bin grep
+	${HOME} printf echo then | done | test cd -eu ${HOME} -eu "$@" --verbose
+'quoted text' awk /usr/bin done "$1" && sed -eu x=1 echo readonly
+	grep cd x=1 readonly echo && cd sed "$@"
+then grep /usr/bin x=1 "$1" cd "$@" 'quoted text' cd x=1 test
+	grep "$1" local "$1" && /usr/bin done sed echo export "$@" test -eu 2>/dev/null
+	sed test -eu done 2>/dev/null && grep -eu --verbose
+	local --verbose 'quoted text' test /usr/bin done printf
+	then cd | "$@" /usr/bin then x=1 sed "$1" x=1 readonly cd
+| readonly sed 'quoted text' -eu done printf x=1 && x=1 readonly | readonly echo
+		grep readonly --verbose cd sed && awk x=1 'quoted text' awk local 2>/dev/null
+"$1" export sed 2>/dev/null 'quoted text'
+		test ${HOME} readonly | then local echo sed
+x=1 x=1 -eu echo -eu printf "$1" 2>/dev/null
+		local --verbose --verbose echo sed sed --verbose
+		-eu ${HOME} $(pwd) echo
+sed 'quoted text' 'quoted text' $(pwd) "$1"
+	test printf --verbose grep readonly then readonly done export echo && then
+		readonly ${HOME} sed readonly printf then then | local "$@" awk readonly
+	printf 'quoted text' cd && --verbose "$1" sed test echo
+		x=1 done --verbose 'quoted text' "$@" | cd done export 2>/dev/null
+	--verbose grep echo $(pwd) "$@" && | -eu -eu readonly then test grep local
+	| x=1 2>/dev/null test --verbose | awk export /usr/bin $(pwd)
+	awk grep sed 'quoted text' "$@" --verbose && readonly grep /usr/bin ${HOME} grep
+	--verbose x=1 'quoted text' local
+$(pwd) readonly "$@" x=1 sed -eu 2>/dev/null readonly cd $(pwd) $(pwd) $(pwd) $(pwd)
+	${HOME} done /usr/bin test
+	readonly ${HOME} export printf --verbose -eu 2>/dev/null
+2>/dev/null --verbose x=1 "$1" done echo --verbose
+		x=1 echo x=1 done sed ${HOME}
+echo readonly grep export test /usr/bin
+	$(pwd) sed -eu cd "$1" --verbose $(pwd) cd ${HOME} grep
+$(pwd) readonly "$@" echo printf 'quoted text'
+| echo export /usr/bin test awk "$1" readonly ${HOME} printf &&
+	&& echo /usr/bin grep export readonly 2>/dev/null
+$(pwd) ${HOME} $(pwd) /usr/bin 2>/dev/null
+	"$1" done -eu -eu readonly awk ${HOME} ${HOME}
+		test printf ${HOME} "$@" /usr/bin --verbose
+echo /usr/bin readonly x=1 local readonly -eu | done then readonly
+"$1" x=1 "$1" /usr/bin local
+	| grep then $(pwd) ${HOME} awk x=1 'quoted text' readonly test grep
+grep readonly sed local grep 'quoted text' cd 2>/dev/null
+		-eu --verbose echo | 2>/dev/null 'quoted text' cd
+	done sed -eu export "$1"
+		"$@" --verbose then x=1 grep | && -eu ${HOME} "$1" cd grep test cd
+	export awk sed test export sed x=1 -eu "$1" --verbose printf 'quoted text'
+	&& then --verbose printf x=1 printf /usr/bin x=1 then done echo printf | 2>/dev/null
+	&& 'quoted text' /usr/bin 2>/dev/null -eu sed | printf
+		"$@" test grep 2>/dev/null 2>/dev/null then
+		grep done ${HOME} --verbose && local && echo /usr/bin
+	"$@" 'quoted text' ${HOME} --verbose ${HOME}
+echo 'quoted text' readonly cd && printf awk export
+cd "$1" x=1 done ${HOME} test echo awk
+		cd export "$1" then | then printf -eu x=1 -eu then
+		-eu readonly && echo "$@"
+	local --verbose $(pwd) export /usr/bin ${HOME} test local
+'quoted text' sed cd sed --verbose grep export --verbose
+"$1" --verbose local printf x=1
+	export 2>/dev/null ${HOME} 'quoted text' /usr/bin printf "$1"
+test printf "$@" --verbose awk grep 'quoted text'
+printf --verbose grep 'quoted text' readonly
+	| echo then -eu /usr/bin
+'quoted text' | echo sed 2>/dev/null readonly ${HOME}
+	/usr/bin then done export
+printf grep local echo 2>/dev/null
+		echo grep echo 2>/dev/null -eu
+echo echo awk test sed 'quoted text'
+sed "$1" grep $(pwd) | && test && 'quoted text' export sed 'quoted text'
+--verbose --verbose 'quoted text' $(pwd) then printf $(pwd) "$1" ${HOME}
+	--verbose /usr/bin /usr/bin then
+	--verbose -eu $(pwd) local /usr/bin
+export x=1 cd local local /usr/bin export awk done export
+	'quoted text' -eu local /usr/bin "$@" test test /usr/bin "$@" $(pwd) $(pwd)
+test "$@" printf --verbose --verbose local "$@" grep done awk 'quoted text'
+	done echo 2>/dev/null && -eu sed done awk $(pwd) done 2>/dev/null
+		sed echo 'quoted text' --verbose grep
+x=1 --verbose $(pwd) grep -eu 2>/dev/null -eu test done readonly printf
+${HOME} $(pwd) echo test -eu test cd $(pwd)
+	'quoted text' "$1" sed x=1 grep cd
+		readonly awk -eu cd cd | test
+readonly "$@" done /usr/bin /usr/bin
+	test echo grep -eu x=1 ${HOME} test ${HOME} /usr/bin 2>/dev/null sed
+readonly then ${HOME} printf /usr/bin $(pwd) echo 2>/dev/null
+	${HOME} && local sed -eu 2>/dev/null "$1" | grep
+	sed local grep 2>/dev/null grep cd echo readonly grep -eu done grep
+		x=1 && 2>/dev/null done printf 2>/dev/null ${HOME} "$@" echo readonly "$@" grep
+		/usr/bin sed "$@" "$@" export --verbose cd x=1 -eu /usr/bin
+test 2>/dev/null local "$1" cd "$1" 2>/dev/null sed export done export
+-eu | sed /usr/bin readonly 'quoted text' readonly
+	local awk $(pwd) test 'quoted text' awk -eu test
+	echo done grep test /usr/bin $(pwd) x=1 grep then 'quoted text' && awk --verbose
+grep "$1" && | x=1 $(pwd) test -eu readonly --verbose echo x=1 ${HOME}
+		echo test local | done /usr/bin test x=1 ${HOME}
+	test | "$1" readonly test awk --verbose /usr/bin "$1"
+	readonly -eu -eu 'quoted text' "$1"
+	then export /usr/bin $(pwd) "$1" cd echo sed "$1" cd $(pwd)
+	sed "$1" export $(pwd) done local --verbose && awk
+	/usr/bin export && cd echo x=1 cd /usr/bin 2>/dev/null
+/usr/bin local then x=1 "$@" echo "$@"
+printf done 'quoted text' sed --verbose --verbose && /usr/bin $(pwd) 2>/dev/null
@@ -0,0 +1,2001 @@
+then echo awk test --verbose echo "$1" --verbose
+	grep 2>/dev/null | grep
+		done readonly x=1 | awk "$1" $(pwd) echo 'quoted text'
+"$1" "$@" export grep "$1" x=1 --verbose /usr/bin /usr/bin then
+--verbose | then readonly "$@" then echo export echo ${HOME} ${HOME}
+sed then -eu x=1 x=1 awk then 'quoted text' test printf readonly printf
+	printf --verbose echo then x=1 test
+		"$@" grep | sed cd grep "$1"
+		2>/dev/null awk readonly -eu printf --verbose ${HOME}
+sed x=1 sed "$1" test | export printf ${HOME} x=1 -eu 'quoted text' printf grep
+	$(pwd) readonly echo x=1 "$1" echo cd ${HOME} -eu $(pwd) && local
+export awk ${HOME} grep /usr/bin local test | ${HOME}
+cd then readonly -eu &&
+sed test test echo "$1" then export then
+'quoted text' 'quoted text' "$@" 'quoted text' sed sed
+		-eu sed printf then awk | cd | && echo printf --verbose done "$1" then awk --verbose
+'quoted text' -eu printf "$@" -eu echo then /usr/bin && echo 'quoted text'
+	grep $(pwd) -eu readonly -eu echo done
+		x=1 'quoted text' 2>/dev/null done readonly local cd ${HOME} then local | test
+		then grep then awk printf $(pwd) local | /usr/bin
+		local done /usr/bin ${HOME} /usr/bin x=1 && then | "$@" $(pwd)
+	echo 2>/dev/null /usr/bin readonly ${HOME} x=1 'quoted text' grep $(pwd) done then
+	printf 2>/dev/null test test 'quoted text'
+/usr/bin $(pwd) --verbose done cd --verbose cd $(pwd) -eu ${HOME} then
+	"$@" printf 2>/dev/null
+--verbose grep done awk ${HOME} echo readonly --verbose -eu awk
+	--verbose readonly ${HOME} "$@" echo done readonly $(pwd)
+		printf | "$1" readonly awk "$1" cd then export export "$1" sed "$1" export "$@"
+		printf x=1 && /usr/bin && "$@" printf awk readonly
+		| ${HOME} && test | 2>/dev/null test -eu cd sed done printf
+	&& cd export grep x=1 printf readonly && --verbose
+		2>/dev/null /usr/bin local awk sed echo && x=1
+		'quoted text' cd $(pwd) | ${HOME} local && readonly $(pwd)
+		"$1" awk done $(pwd) 2>/dev/null /usr/bin grep x=1 grep --verbose 'quoted text'
+		test $(pwd) 'quoted text' echo sed local sed $(pwd) sed local x=1 readonly echo
+	test local cd 'quoted text' sed 2>/dev/null
+		readonly -eu local 2>/dev/null grep printf "$@" ${HOME}
+grep export sed $(pwd) readonly test
+	"$@" x=1 x=1 test /usr/bin cd ${HOME} "$1"
+		sed export cd sed then ${HOME} printf done awk
+	"$@" readonly sed "$@" && | ${HOME} then --verbose "$@" | awk | ${HOME}
+		test -eu test x=1 2>/dev/null test | then readonly local
+sed /usr/bin --verbose done readonly && | | awk test echo local
+	--verbose echo printf export ${HOME}
+	"$@" "$@" && readonly | awk test local printf "$@" grep x=1
+sed 'quoted text' ${HOME} local export
+x=1 /usr/bin --verbose sed $(pwd) awk echo -eu -eu echo "$1" "$@" "$1" sed awk
+| export test $(pwd) grep printf | done local then printf
+		test 'quoted text' echo --verbose then echo
+	printf local -eu "$1" export awk awk readonly "$1"
+		echo done test printf 2>/dev/null x=1 awk grep sed | awk $(pwd) "$@"
+--verbose | x=1 awk cd -eu echo export
+		"$@" printf "$1" | printf awk "$1" test export && done /usr/bin
+		printf --verbose /usr/bin && export
+		x=1 /usr/bin then $(pwd) grep local
+	done 2>/dev/null 'quoted text' echo ${HOME} then local "$@" export then
+	readonly readonly -eu local | cd "$@" "$@" then $(pwd) ${HOME} $(pwd) 2>/dev/null
+		awk "$@" x=1 --verbose done
+	awk -eu | cd "$@" sed then /usr/bin ${HOME}
+export local "$1" $(pwd) | cd x=1 awk local awk ${HOME} printf
+		${HOME} printf | test $(pwd) --verbose then && $(pwd) awk readonly "$1"
+grep export "$1" readonly --verbose
+echo /usr/bin x=1 $(pwd) "$1" 2>/dev/null
+	--verbose "$@" "$1" sed -eu done /usr/bin /usr/bin cd $(pwd) | && -eu
+		grep && readonly -eu then printf done 'quoted text'
+		grep ${HOME} 2>/dev/null echo
+		echo 2>/dev/null cd grep | export |
+$(pwd) && -eu local "$@" /usr/bin cd 'quoted text' 2>/dev/null
+cd x=1 awk && sed sed cd ${HOME} done && then --verbose | 2>/dev/null "$@" x=1
+"$@" 2>/dev/null printf grep awk then 'quoted text' done local awk grep printf
+${HOME} ${HOME} sed sed sed -eu sed echo --verbose
+${HOME} test 'quoted text' 'quoted text' --verbose ${HOME}
+printf ${HOME} done -eu echo echo ${HOME} readonly then test "$1" echo done 'quoted text'
+	done /usr/bin readonly "$1"
+	export --verbose grep then 'quoted text' $(pwd) grep x=1 "$@"
+		printf "$1" 2>/dev/null cd test
+	export sed "$1" then awk ${HOME} | 2>/dev/null
+	"$1" --verbose awk | local then --verbose
+	cd 'quoted text' awk -eu readonly /usr/bin printf awk
+		sed test ${HOME} local && done echo echo grep | && --verbose printf "$1"
+		sed readonly test x=1 'quoted text' grep "$@" readonly
+&& ${HOME} cd awk awk ${HOME}
+		cd sed printf | then cd grep
+	x=1 /usr/bin -eu export test /usr/bin
+		${HOME} done "$1" cd /usr/bin 2>/dev/null
+	done 2>/dev/null | ${HOME} export test $(pwd) 2>/dev/null 'quoted text' then ${HOME}
+	| 2>/dev/null grep local grep && grep
+	${HOME} grep export -eu -eu && cd "$@" "$@" grep
+'quoted text' | 2>/dev/null | printf
+x=1 export then cd grep printf awk
+| -eu "$1" /usr/bin | sed -eu readonly
+local | /usr/bin done awk grep | | local grep
+	printf done $(pwd) x=1 then
+	then "$@" awk $(pwd) cd | | $(pwd)
+	$(pwd) grep 'quoted text' sed /usr/bin echo readonly ${HOME}
+awk /usr/bin echo "$1"
+grep readonly printf printf $(pwd) && -eu 2>/dev/null export sed
+		"$@" sed -eu awk then sed awk echo "$@" 2>/dev/null grep
+	export awk x=1 done grep printf
+		--verbose 'quoted text' -eu $(pwd) 2>/dev/null 2>/dev/null
+		&& grep --verbose then "$1" done export &&
+		"$1" 2>/dev/null --verbose test ${HOME}
+	${HOME} then ${HOME} && 'quoted text' local $(pwd) | export 'quoted text'
+grep readonly ${HOME} export "$1" "$1" --verbose 2>/dev/null local grep -eu
+"$1" export then echo done 2>/dev/null
+then echo grep printf
+	"$1" 2>/dev/null cd test
+&& && export cd | printf -eu echo test readonly
+	echo then x=1 2>/dev/null
+		cd test then && export ${HOME}
+		${HOME} 2>/dev/null | && --verbose | export ${HOME} grep readonly
+		grep && sed && -eu awk
+	done then -eu test done test 'quoted text'
+--verbose sed printf && echo "$1" 2>/dev/null printf cd 'quoted text'
+	${HOME} -eu /usr/bin echo && awk x=1 /usr/bin
+x=1 done grep $(pwd) "$1"
+	sed printf /usr/bin cd --verbose local 'quoted text' "$@"
+readonly /usr/bin ${HOME} done test
+		x=1 awk 'quoted text' awk | readonly $(pwd) local
+echo 2>/dev/null --verbose && "$1" "$1" $(pwd) | "$@" x=1 x=1 ${HOME} awk
+		&& sed 'quoted text' && test sed export
+cd -eu done then echo readonly then $(pwd) ${HOME} "$1" echo
+printf x=1 local 2>/dev/null export "$@" grep x=1 2>/dev/null
+		'quoted text' readonly "$1"
+	"$@" readonly export
+	grep --verbose "$@" /usr/bin printf /usr/bin
+	--verbose | test export x=1 $(pwd) --verbose $(pwd) --verbose
+		done sed awk awk then "$@" 2>/dev/null printf sed &&
+		done $(pwd) sed cd readonly echo test then --verbose
+x=1 "$@" sed echo local echo local printf export
+cd --verbose /usr/bin printf awk local ${HOME}
+	&& grep && "$@" echo then readonly 2>/dev/null local cd $(pwd)
+		/usr/bin --verbose | done then done
+		test export readonly cd "$1" --verbose | sed local 'quoted text'
+"$@" && printf test && done readonly local grep | -eu cd awk then | echo export
+	2>/dev/null echo printf cd local
+	then --verbose local && "$@" "$@"
+		grep grep && --verbose ${HOME} awk /usr/bin
+		x=1 'quoted text' readonly $(pwd) /usr/bin 2>/dev/null --verbose
+		test local $(pwd) /usr/bin done /usr/bin $(pwd) 2>/dev/null awk test readonly
+	awk 'quoted text' readonly then ${HOME}
+cd done local cd readonly -eu awk local export local
+	grep && then "$1" && | cd "$@" -eu "$@" --verbose x=1 echo grep ${HOME}
+${HOME} "$@" export "$@" grep printf test /usr/bin grep ${HOME} 'quoted text'
+		grep "$1" readonly export printf printf "$@" cd
+		cd echo echo | 2>/dev/null
+	echo 'quoted text' ${HOME} --verbose local grep local $(pwd) printf done
+--verbose 2>/dev/null --verbose $(pwd) --verbose sed
+		x=1 then $(pwd) 2>/dev/null
+export echo local cd readonly
+	done test $(pwd) done 'quoted text' "$1" echo ${HOME} 'quoted text' awk printf
+		export test test ${HOME} export "$1" awk then --verbose test sed
+	2>/dev/null export && test
+	$(pwd) done x=1 readonly done ${HOME} --verbose x=1 echo awk export
+'quoted text' "$1" then -eu
+	cd local printf $(pwd) &&
+local "$1" x=1 /usr/bin
+sed | | test grep local /usr/bin
+	readonly 2>/dev/null && printf test 2>/dev/null
+		export grep --verbose test "$@" /usr/bin printf cd readonly export cd
+		then /usr/bin 2>/dev/null cd readonly
+		${HOME} "$@" local cd | && done export printf ${HOME} done
+		awk ${HOME} $(pwd) grep then
+/usr/bin /usr/bin --verbose readonly
+	local sed export ${HOME} sed readonly
+	awk /usr/bin 'quoted text' --verbose "$@" readonly sed "$1"
+		2>/dev/null sed readonly test sed printf export ${HOME} | --verbose echo
+sed 'quoted text' cd export then then --verbose echo "$@"
+		"$1" sed export $(pwd) awk /usr/bin --verbose local local $(pwd) then echo
+		--verbose echo export | 2>/dev/null awk
+		echo "$1" done local | awk readonly done /usr/bin cd
+echo then grep "$1" cd printf ${HOME}
+		done sed $(pwd) 2>/dev/null 2>/dev/null --verbose -eu local | /usr/bin cd
+		sed done x=1 2>/dev/null
+	local cd test "$@" | sed printf awk grep grep -eu
+	local | 2>/dev/null test "$@" test sed grep sed ${HOME} && printf $(pwd) done
+	awk x=1 cd x=1 | readonly "$1" && test sed | awk /usr/bin cd test test
+export | && readonly local "$@" then export x=1 awk --verbose local
+	cd grep local "$@" readonly local export done then x=1 'quoted text'
+'quoted text' grep done printf echo awk $(pwd) | | && 2>/dev/null
+${HOME} grep printf awk printf x=1 ${HOME} "$@" --verbose cd
+		'quoted text' awk && test cd sed done "$1" grep 2>/dev/null echo
+	done $(pwd) "$@" ${HOME} then sed "$1" then
+		-eu $(pwd) printf && "$@" "$1" grep
+	"$@" 2>/dev/null x=1 'quoted text'
+x=1 echo printf 2>/dev/null grep &&
+export | local -eu 2>/dev/null
+printf 'quoted text' local 2>/dev/null readonly
+		printf printf then --verbose done done test x=1 printf
+	export | x=1 2>/dev/null ${HOME} | x=1 --verbose echo grep "$1"
+echo x=1 cd -eu 'quoted text' test -eu "$@" --verbose
+		--verbose 'quoted text' --verbose cd
+		then && then -eu grep export $(pwd) done then "$1"
+		export then && grep done 2>/dev/null
+	"$1" -eu sed cd && && -eu -eu sed x=1
+&& ${HOME} /usr/bin "$@" then /usr/bin /usr/bin | done local readonly ${HOME}
+readonly export | /usr/bin /usr/bin | x=1 /usr/bin grep x=1 | cd "$1" x=1
+export $(pwd) 'quoted text' awk test --verbose -eu awk | printf
+	export "$@" "$@" /usr/bin export local awk --verbose 2>/dev/null cd cd x=1 echo
+echo /usr/bin $(pwd) test "$@" 2>/dev/null
+	"$@" local | done local export local printf awk test &&
+awk printf sed ${HOME} echo /usr/bin sed
+	&& "$1" | cd -eu x=1 readonly printf $(pwd) "$@" readonly /usr/bin done /usr/bin
+printf "$1" cd x=1 local cd echo test | 2>/dev/null && readonly ${HOME}
+	"$1" "$@" test export local local -eu -eu | x=1 then cd | done echo sed
+awk 2>/dev/null | "$@" local printf
+		echo export sed x=1 readonly sed ${HOME} 2>/dev/null then
+-eu ${HOME} grep "$1" echo ${HOME} | ${HOME} cd -eu echo awk local local
+		printf --verbose && printf $(pwd) -eu 'quoted text' 2>/dev/null -eu awk
+	export && export 'quoted text' 'quoted text'
+		-eu export "$1" export local x=1 printf /usr/bin done | ${HOME} -eu 'quoted text'
+	"$1" && sed export cd x=1 2>/dev/null "$1" printf && done "$1" then readonly
+		"$1" done ${HOME} && -eu $(pwd) printf export
+echo cd | awk test cd export | then test -eu then
+		done local x=1 export local cd ${HOME} -eu
+		&& ${HOME} grep printf export printf cd done ${HOME} done
+	done awk --verbose 2>/dev/null /usr/bin echo -eu ${HOME}
+		x=1 echo 'quoted text' -eu
+awk ${HOME} 2>/dev/null | "$@" echo /usr/bin "$@" done "$@" x=1
+2>/dev/null local export
+awk then test cd grep printf local $(pwd) local -eu x=1 echo "$1" ${HOME} && done
+sed readonly done local awk 2>/dev/null
+	cd "$1" sed printf cd "$1"
+		x=1 && x=1 sed done && "$@" 'quoted text' ${HOME} awk
+	&& grep --verbose && --verbose "$@" then 2>/dev/null ${HOME} | grep &&
+2>/dev/null readonly cd | 2>/dev/null grep ${HOME} printf "$@" "$@"
+	x=1 /usr/bin readonly grep | 2>/dev/null cd "$1" local done export
+		done cd done printf -eu "$1" "$1" $(pwd) $(pwd) awk 2>/dev/null
+		then export done sed done printf
+		export then test then && --verbose 'quoted text' "$1"
+	${HOME} $(pwd) "$@" echo x=1
+		2>/dev/null sed x=1 test grep awk
+	| done | -eu sed grep --verbose x=1
+	echo local && "$@" printf
+	&& -eu test $(pwd) 'quoted text' awk cd awk printf | "$1" "$@" |
+	x=1 awk ${HOME} && "$@" -eu cd 2>/dev/null then /usr/bin sed local
+	"$1" && awk then x=1 --verbose sed && local | 2>/dev/null -eu awk /usr/bin grep
+	local sed x=1 x=1 $(pwd) $(pwd) sed cd "$@"
+		2>/dev/null done --verbose
+		'quoted text' test grep $(pwd) "$@" 'quoted text' 2>/dev/null
+	2>/dev/null --verbose local test "$@" done local "$@"
+2>/dev/null /usr/bin "$1" awk x=1 --verbose awk done && --verbose
+		local done --verbose awk 2>/dev/null printf
+	'quoted text' done -eu $(pwd) /usr/bin /usr/bin --verbose x=1
+	&& x=1 'quoted text' echo "$1" sed "$@" 2>/dev/null x=1
+readonly done sed "$@" then | export cd /usr/bin |
+	2>/dev/null then && printf export printf
+	-eu "$1" cd done && done -eu 'quoted text' --verbose sed
+	cd readonly awk | cd 'quoted text' sed && export awk "$@"
+	$(pwd) done then sed done 'quoted text' "$1" /usr/bin
+test then "$1" readonly export ${HOME} local
+	echo | cd && --verbose
+then ${HOME} local 2>/dev/null
+		sed grep -eu | awk "$1" && grep ${HOME} 2>/dev/null printf 'quoted text' /usr/bin
+		done readonly awk x=1 /usr/bin done
+test printf 2>/dev/null x=1 readonly local cd done printf -eu awk test
+2>/dev/null readonly /usr/bin "$@" cd test cd test grep
+		"$1" "$@" 2>/dev/null then
+		cd ${HOME} && "$@" echo "$@" echo
+done export "$1" ${HOME} "$@" echo 2>/dev/null $(pwd) 'quoted text'
+$(pwd) readonly "$1" "$@" ${HOME} printf -eu then "$1"
+x=1 ${HOME} ${HOME} readonly $(pwd) x=1 && "$@" --verbose echo
+	done --verbose 2>/dev/null grep $(pwd) grep 2>/dev/null $(pwd) done test readonly
+printf x=1 awk sed /usr/bin
+		${HOME} printf -eu sed $(pwd) grep "$@" test printf "$1" /usr/bin
+	${HOME} sed grep 2>/dev/null readonly sed $(pwd) sed
+	grep 'quoted text' | done && 2>/dev/null then $(pwd)
+	grep readonly echo 2>/dev/null 'quoted text'
+grep awk "$1" && ${HOME} /usr/bin --verbose | && done
+		test cd printf grep then cd x=1 export ${HOME} export $(pwd) $(pwd)
+'quoted text' 2>/dev/null
+		done --verbose export $(pwd) readonly /usr/bin
+		sed echo export echo echo local sed ${HOME}
+cd 'quoted text' test | $(pwd) awk | cd readonly local
+2>/dev/null echo | -eu readonly export /usr/bin x=1 'quoted text'
+		export local done "$1" echo -eu grep grep export x=1
+		2>/dev/null echo printf x=1 then echo grep readonly
+done "$1" && export && x=1 "$1" sed then echo "$@" cd printf "$1"
+"$@" local then && readonly && grep | $(pwd) $(pwd) printf echo then -eu grep
+		2>/dev/null export readonly 2>/dev/null 2>/dev/null
+	"$@" then printf export export 2>/dev/null --verbose x=1
+2>/dev/null awk then local /usr/bin "$@" readonly -eu 2>/dev/null echo sed
+	--verbose echo printf 'quoted text' | echo sed printf $(pwd) printf cd then
+"$1" echo test test local ${HOME} cd
+export test readonly readonly printf printf then local awk $(pwd) "$1"
+		test printf && | && local
+	2>/dev/null -eu then local grep then | "$@" then
+2>/dev/null sed printf sed grep
+	done sed | 2>/dev/null awk cd | && x=1 'quoted text' then | done $(pwd) $(pwd)
+		readonly --verbose x=1 2>/dev/null
+	--verbose -eu "$@" readonly export awk | test -eu 'quoted text' x=1 $(pwd)
+x=1 printf readonly export then x=1 readonly | "$1" awk
+sed then cd "$1" ${HOME} done $(pwd) 2>/dev/null "$@" $(pwd)
+		$(pwd) then readonly printf --verbose $(pwd) sed | 2>/dev/null && --verbose
+		"$1" readonly --verbose ${HOME} test done $(pwd) cd readonly -eu -eu -eu -eu
+		cd done echo "$@" | -eu | grep /usr/bin "$@" local
+test 'quoted text' done done "$@" then echo done done sed /usr/bin
+| 2>/dev/null cd grep printf printf printf "$@" printf && awk cd then --verbose
+		test 'quoted text' $(pwd) x=1 "$1"
+		then local --verbose then grep
+		2>/dev/null then | sed printf
+	| "$1" local awk | 'quoted text'
+		'quoted text' sed cd awk && then && --verbose x=1
+	/usr/bin test 'quoted text' then then x=1
+2>/dev/null grep "$1" awk cd
+--verbose test -eu export readonly ${HOME} export |
+		/usr/bin readonly ${HOME} printf | 'quoted text' local $(pwd) "$1" && done export
+--verbose 'quoted text' 'quoted text' ${HOME} echo 'quoted text' echo
+	--verbose && 'quoted text' then cd x=1 cd 2>/dev/null /usr/bin local
+$(pwd) | sed then done test x=1 x=1 grep export x=1 test
+	${HOME} test | 2>/dev/null echo /usr/bin export local grep ${HOME} local --verbose
+	then "$@" | /usr/bin local x=1 awk 'quoted text' ${HOME}
+"$1" grep then "$1" "$@" readonly | -eu sed | sed echo 'quoted text'
+		2>/dev/null 2>/dev/null "$1" printf
+	grep /usr/bin export awk test grep readonly /usr/bin /usr/bin sed export
+	then cd printf grep && && printf printf 'quoted text' 2>/dev/null local
+	local && test export | x=1 /usr/bin grep then --verbose --verbose
+		sed -eu "$1" && 'quoted text' then /usr/bin
+grep done "$1" --verbose "$@" sed cd x=1
+	local echo grep "$@" /usr/bin done grep -eu 2>/dev/null && --verbose ${HOME} &&
+done "$@" grep then 2>/dev/null /usr/bin grep sed ${HOME} -eu cd 2>/dev/null
+	test export 'quoted text' printf echo 'quoted text'
+'quoted text' --verbose cd export "$@" echo printf $(pwd) printf readonly
+		${HOME} --verbose $(pwd) -eu
+	&& /usr/bin local "$1" readonly && -eu "$@" x=1 $(pwd) --verbose
+	test export test done "$@" local | readonly awk printf
+		$(pwd) /usr/bin awk local 'quoted text' && -eu
+	--verbose x=1 cd 2>/dev/null -eu cd awk then test grep
+"$1" cd ${HOME} 2>/dev/null /usr/bin readonly printf export | --verbose sed
+cd cd grep && | printf echo 'quoted text'
+x=1 -eu "$@" 'quoted text' | then done --verbose
+	$(pwd) $(pwd) awk "$@"
+&& ${HOME} sed && awk --verbose sed "$@" sed | && x=1 --verbose
+/usr/bin && && echo readonly $(pwd)
+local cd local local 2>/dev/null
+		readonly printf then
+		sed echo readonly then echo local printf | readonly
+		-eu && test --verbose local -eu test ${HOME} readonly
+		readonly /usr/bin --verbose cd ${HOME}
+	"$@" "$@" test | /usr/bin x=1 then
+		$(pwd) && && test done "$@" | "$@" /usr/bin ${HOME} -eu
+	echo awk readonly local -eu export ${HOME} cd "$@" "$@" done
+		export x=1 x=1 -eu "$1"
+		test local export $(pwd) ${HOME} sed | "$@" export
+		done echo printf | then awk local | &&
+	/usr/bin awk -eu "$1" printf | done "$@" printf -eu $(pwd) sed &&
+		awk readonly "$1" sed --verbose ${HOME} --verbose "$@"
+		$(pwd) | sed cd cd test sed done $(pwd) && echo done $(pwd) cd /usr/bin /usr/bin
+	2>/dev/null /usr/bin 2>/dev/null $(pwd) cd done export done x=1 done test 2>/dev/null
+		2>/dev/null test $(pwd) test
+	${HOME} sed test sed | echo && "$1" grep "$@"
+		'quoted text' readonly local && export local 'quoted text' export then x=1
+grep cd | -eu "$1" | readonly awk grep sed local "$@" -eu "$@" -eu | test echo
+test local local x=1 -eu 2>/dev/null && && | -eu
+		cd readonly sed readonly awk "$@" $(pwd) export test done echo /usr/bin
+$(pwd) grep readonly --verbose $(pwd) ${HOME} printf "$@"
+		-eu local "$@" test test awk sed
+		"$@" export echo ${HOME} && && $(pwd) grep then ${HOME} x=1
+	| printf done /usr/bin cd 'quoted text' sed then
+grep cd --verbose && export
+		test readonly sed -eu ${HOME} local local cd | ${HOME}
+	echo -eu then ${HOME} done --verbose ${HOME} "$1" ${HOME} 'quoted text'
+	$(pwd) "$@" /usr/bin test | sed test cd readonly then && local
+"$1" --verbose echo x=1 "$@" then "$@"
+	"$1" --verbose sed echo $(pwd) test -eu cd export export export
+x=1 sed ${HOME} grep readonly sed 'quoted text' cd done export export sed done $(pwd)
+${HOME} $(pwd) sed /usr/bin
+cd done grep ${HOME} "$1" echo
+		local x=1 -eu local sed printf && sed /usr/bin export 2>/dev/null
+	grep | export "$@" "$@" local 2>/dev/null | readonly
+	echo done readonly grep
+		'quoted text' local "$@" sed cd "$1" /usr/bin test 2>/dev/null -eu
+		-eu x=1 local "$1" && x=1 2>/dev/null
+	$(pwd) "$@" echo /usr/bin 2>/dev/null
+		test then /usr/bin readonly printf --verbose /usr/bin
+		x=1 | | then "$@" local /usr/bin --verbose
+	cd "$@" sed echo | "$1" done
+local x=1 && "$1" "$1" ${HOME} | test "$1" /usr/bin local awk awk then &&
+		export && then && "$@" done sed
+	test done printf $(pwd) done && && readonly 2>/dev/null
+test 2>/dev/null /usr/bin x=1 echo
+		2>/dev/null done then then 'quoted text'
+grep ${HOME} 'quoted text' grep export grep local /usr/bin --verbose
+		"$1" test then awk local "$@" --verbose printf && readonly
+	-eu cd grep awk --verbose 'quoted text' printf 2>/dev/null test sed
+	"$1" x=1 test readonly local /usr/bin test "$@" echo "$1" ${HOME} awk
+	test echo | | readonly export --verbose
+		$(pwd) | grep export cd --verbose "$1" ${HOME} local && cd test | export "$@"
+	"$@" -eu test readonly test awk $(pwd) --verbose 2>/dev/null ${HOME}
+export x=1 then ${HOME} awk ${HOME} "$1" 2>/dev/null "$1" /usr/bin
+grep local && "$@" -eu test
+		/usr/bin 2>/dev/null && readonly $(pwd) test cd /usr/bin
+$(pwd) grep 2>/dev/null readonly | grep awk awk -eu grep cd "$1" --verbose
+		x=1 test test "$1" printf && -eu | "$@"
+	/usr/bin 2>/dev/null export 'quoted text' export then test readonly && ${HOME}
+export | grep readonly "$1" sed x=1
+		--verbose --verbose 2>/dev/null "$1" export --verbose local readonly
+then awk && ${HOME} then 'quoted text' "$1" cd export echo | cd
+	local 'quoted text' "$1" printf awk done awk then export
+		--verbose sed /usr/bin && printf "$1" sed sed -eu -eu local done readonly
+printf echo awk grep readonly local then /usr/bin done
+		--verbose 2>/dev/null
+	$(pwd) printf local cd echo local $(pwd)
+	awk x=1 awk sed readonly done awk echo
+&& printf echo awk local then $(pwd) "$@" $(pwd) export export
+	grep "$@" readonly --verbose done 'quoted text'
+		done 2>/dev/null then test local test x=1
+	&& then local printf awk |
+	$(pwd) x=1 test sed ${HOME} "$1" then echo printf /usr/bin | /usr/bin ${HOME}
+/usr/bin printf x=1 x=1 /usr/bin -eu done local grep
+then x=1 "$1" then -eu /usr/bin $(pwd) "$@" sed --verbose "$@" "$1" x=1 grep
+then | awk x=1 "$@" "$1" cd grep 'quoted text'
+	| $(pwd) --verbose ${HOME} printf printf /usr/bin
+test sed $(pwd) $(pwd) export 'quoted text' 'quoted text'
+		'quoted text' "$@" sed printf sed "$1" cd printf | test
+readonly "$1" grep test x=1 test $(pwd) x=1 --verbose echo
+	"$1" local sed grep test test 'quoted text'
+	cd && -eu --verbose "$1"
+	2>/dev/null awk $(pwd) readonly && | readonly printf export /usr/bin -eu "$@"
+	$(pwd) x=1 "$@" echo | echo "$@" "$@" then awk 2>/dev/null ${HOME}
+&& -eu ${HOME} sed echo export "$1" cd /usr/bin sed x=1
+"$1" --verbose test "$1" echo export printf done echo printf export ${HOME}
+	/usr/bin readonly local sed "$1"
+		export echo | sed "$1" export echo $(pwd) 2>/dev/null echo 2>/dev/null
+		x=1 echo local echo export | awk 2>/dev/null then
+awk export /usr/bin sed cd --verbose echo 'quoted text' "$@" local export
+| | local 2>/dev/null test --verbose test export then --verbose done
+		"$@" sed done && ${HOME} readonly x=1 local echo | x=1 test x=1 "$@" echo
+	$(pwd) readonly sed && cd then 2>/dev/null readonly sed printf done
+	"$@" test 2>/dev/null sed printf -eu echo -eu sed $(pwd) /usr/bin && && cd export
+	cd done --verbose sed ${HOME} -eu $(pwd)
+	${HOME} local --verbose done
+	$(pwd) $(pwd) awk sed cd
+		then --verbose test 2>/dev/null printf /usr/bin export /usr/bin x=1 grep /usr/bin
+		export --verbose readonly 2>/dev/null
+		-eu "$1" "$@" readonly "$@" awk ${HOME} "$@" $(pwd) ${HOME} grep
+		grep $(pwd) "$@" sed 'quoted text'
+printf "$1" $(pwd) readonly $(pwd) -eu -eu x=1 x=1 then ${HOME} sed "$1" ${HOME}
+"$@" grep done x=1 readonly cd "$1" sed
+readonly | done then done 2>/dev/null
+awk "$@" echo test echo
+		&& "$1" "$1" 'quoted text' x=1 printf
+		local /usr/bin && then "$1" x=1 printf readonly 'quoted text'
+		export sed printf echo readonly
+	${HOME} test local export --verbose cd sed 2>/dev/null "$@" test done $(pwd)
+		-eu | /usr/bin grep awk then readonly
+	awk readonly --verbose readonly printf | ${HOME} test --verbose --verbose
+		2>/dev/null grep && awk /usr/bin readonly grep sed -eu local then --verbose
+	done sed && && 'quoted text' awk && echo grep 'quoted text' sed awk local
+		"$1" then 2>/dev/null local cd echo -eu test "$1" x=1 cd "$1" --verbose 'quoted text'
+	local | 'quoted text' local --verbose awk ${HOME} awk local 2>/dev/null "$@" done
+export cd printf sed --verbose 'quoted text' && readonly
+2>/dev/null ${HOME} && test -eu 'quoted text' x=1 local && | done | cd echo
+		x=1 printf -eu cd test done ${HOME}
+		export && "$@" 2>/dev/null /usr/bin
+	| 'quoted text' -eu printf 'quoted text' /usr/bin then readonly
+		-eu export "$1" test $(pwd) export "$1" then sed "$1" ${HOME}
+		2>/dev/null cd /usr/bin 'quoted text' /usr/bin 'quoted text' --verbose
+		2>/dev/null test "$@" $(pwd) sed
+/usr/bin export echo x=1 'quoted text' 2>/dev/null printf 'quoted text'
+grep $(pwd) 2>/dev/null --verbose export readonly
+	export --verbose /usr/bin
+		readonly local --verbose
+	done "$1" export printf awk ${HOME} cd test "$@" then |
+	$(pwd) 'quoted text' printf awk --verbose test x=1 $(pwd) --verbose
+awk $(pwd) done ${HOME} sed export cd 'quoted text'
+	2>/dev/null readonly $(pwd) -eu echo readonly
+	'quoted text' /usr/bin done echo cd printf
+	x=1 test x=1 && test done 'quoted text' local $(pwd) && -eu awk $(pwd) printf
+test /usr/bin grep cd done -eu readonly
+	cd x=1 | grep local readonly sed "$1"
+	export "$@" && ${HOME} sed --verbose x=1 ${HOME} "$1" export
+"$@" cd grep awk readonly "$1" printf readonly echo $(pwd) readonly cd
+echo | local -eu awk && --verbose && --verbose printf export
+2>/dev/null test --verbose --verbose "$1" local sed && sed local && "$1" | then
+test then test | test sed sed echo local export grep
+x=1 "$1" /usr/bin "$1" then readonly
+		&& readonly test x=1 $(pwd) readonly -eu ${HOME} grep --verbose export
+| awk grep && sed "$@" && test test "$@" cd echo cd "$@" done ${HOME}
+	"$@" 2>/dev/null grep echo | awk grep ${HOME} export x=1 grep
+	local echo /usr/bin then grep x=1 grep export export 'quoted text'
+test then /usr/bin "$@" --verbose -eu "$@" x=1 readonly
+		/usr/bin sed test $(pwd) "$1" && $(pwd) sed 'quoted text'
+done sed "$@" grep readonly && | test "$1" --verbose local
+then export export --verbose /usr/bin 2>/dev/null
+echo export done | then done grep /usr/bin ${HOME}
+cd 'quoted text' 'quoted text' "$1" export readonly && echo sed
+		done -eu | $(pwd) test $(pwd) export
+done 'quoted text' done local grep printf "$@" sed export then "$@" 'quoted text'
+-eu test /usr/bin echo
+		'quoted text' export readonly $(pwd) -eu readonly "$@" "$@" readonly grep
+	done printf x=1 done grep grep
+grep grep "$@" x=1 then ${HOME} printf printf
+	x=1 local then x=1 | | && -eu $(pwd)
+then $(pwd) && sed then readonly |
+local && -eu done test grep ${HOME} local echo ${HOME}
+$(pwd) grep "$@" printf
+awk test /usr/bin grep echo && $(pwd)
+| printf ${HOME} ${HOME} then 'quoted text' cd local --verbose ${HOME} sed -eu
+	'quoted text' grep && awk local export done "$@" echo && export 2>/dev/null
+grep local export cd grep test $(pwd) x=1 awk
+		cd printf -eu cd awk printf /usr/bin then echo awk $(pwd) echo
+sed ${HOME} -eu readonly && done echo grep 'quoted text' echo echo | -eu export
+		cd test test grep test --verbose $(pwd) test --verbose
+cd --verbose && "$1" test --verbose
+	"$@" printf done "$1" sed x=1
+		grep | 'quoted text' cd readonly echo --verbose readonly
+/usr/bin awk -eu 2>/dev/null ${HOME} -eu test ${HOME} done "$1" ${HOME}
+2>/dev/null "$1" then grep cd test 2>/dev/null echo local ${HOME}
+local awk -eu -eu $(pwd) "$1" "$1" -eu test then && sed then 'quoted text'
+	--verbose 'quoted text' test && -eu
+	done cd local 2>/dev/null "$1" echo | 'quoted text'
+	grep printf export /usr/bin /usr/bin &&
+'quoted text' local x=1 -eu "$@" | awk /usr/bin test 'quoted text'
+	sed 2>/dev/null 2>/dev/null
+	&& ${HOME} printf $(pwd) cd readonly && && /usr/bin "$@" x=1 test awk printf
+		x=1 "$@" export export 2>/dev/null | 'quoted text' x=1 && $(pwd) cd printf "$@"
+${HOME} "$@" awk ${HOME}
+		printf && cd "$@" readonly ${HOME} cd done export local ${HOME} | $(pwd) test
+	printf sed ${HOME} && export cd | --verbose printf done test 2>/dev/null
+		"$@" && | awk cd export 'quoted text' 'quoted text' echo
+	grep $(pwd) cd cd printf readonly 2>/dev/null then cd 'quoted text' sed
+${HOME} export -eu echo grep x=1 export sed x=1
+		"$1" printf then echo then cd grep
+	grep cd 'quoted text' "$@" x=1 $(pwd) 'quoted text' x=1 cd local then
+awk printf "$@" $(pwd) echo done test 2>/dev/null /usr/bin
+x=1 x=1 -eu grep then grep x=1 grep --verbose sed --verbose /usr/bin
+	readonly | test awk /usr/bin "$1" grep --verbose
+-eu 2>/dev/null awk sed grep /usr/bin readonly grep echo --verbose
+		${HOME} cd ${HOME} 2>/dev/null readonly readonly
+	"$1" 'quoted text' 2>/dev/null then then sed -eu ${HOME} export --verbose printf
+'quoted text' export test | awk
+		sed test grep sed ${HOME} -eu --verbose $(pwd)
+	then "$@" x=1 awk /usr/bin export ${HOME} cd 'quoted text' 2>/dev/null done grep
+printf cd cd ${HOME} sed done "$@" test awk test awk 2>/dev/null grep test
+grep done /usr/bin local export local 'quoted text' echo awk grep /usr/bin
+		cd done export ${HOME} readonly && && 2>/dev/null echo 'quoted text' test
+	"$1" cd readonly x=1 sed -eu local "$@" 'quoted text' grep grep
+	readonly | | /usr/bin "$@" then sed
+-eu /usr/bin $(pwd) test grep
+	/usr/bin cd "$1" sed ${HOME} "$@" 'quoted text' "$@" local cd local readonly
+local x=1 "$1" && grep "$@" local -eu 'quoted text' 'quoted text'
+		"$1" 'quoted text' local | $(pwd) $(pwd) echo grep
+		printf export | printf 2>/dev/null
+	| cd grep export local echo awk local -eu
+echo local "$@" ${HOME} sed local "$@"
+		/usr/bin $(pwd) /usr/bin | -eu awk readonly /usr/bin echo export
+		"$1" grep "$1" readonly cd readonly grep grep
+	"$@" readonly /usr/bin cd echo ${HOME} grep awk -eu awk 'quoted text'
+	export | cd cd test grep
+	echo sed 2>/dev/null -eu 2>/dev/null test x=1 /usr/bin /usr/bin $(pwd)
+	export done test x=1 awk
+x=1 sed local test && | cd $(pwd) "$1" echo --verbose
+		&& "$1" test local --verbose
+		grep then | readonly x=1 $(pwd)
+		local grep ${HOME} printf "$1" sed cd 2>/dev/null | x=1 export
+		| awk readonly cd 'quoted text' echo -eu readonly grep -eu "$@"
+		done grep test cd grep readonly
+$(pwd) done test printf printf "$1" done -eu $(pwd) export --verbose ${HOME}
+readonly local 2>/dev/null --verbose sed
+		"$@" 'quoted text' grep cd
+	"$1" "$1" 'quoted text' export echo /usr/bin
+		cd 'quoted text' cd sed then then -eu 'quoted text' /usr/bin
+	grep 2>/dev/null /usr/bin export test export && cd readonly export 2>/dev/null
+	-eu then -eu --verbose | done printf $(pwd) cd
+	test $(pwd) x=1 sed $(pwd) echo -eu -eu local local
+export printf cd readonly ${HOME} /usr/bin
+	grep && x=1 then | grep
+	export "$@" 'quoted text' "$@" x=1 | cd /usr/bin | && /usr/bin "$@" && sed --verbose
+		"$1" "$@" /usr/bin echo
+		then awk $(pwd) done grep grep
+export --verbose export --verbose 'quoted text' sed done test echo -eu echo
+| ${HOME} test 2>/dev/null 'quoted text' grep grep | grep grep export printf
+		sed $(pwd) then $(pwd) local "$@" /usr/bin | sed sed
+--verbose "$@" export grep && cd awk "$@" 2>/dev/null --verbose /usr/bin sed "$@"
+${HOME} test 'quoted text' && -eu printf echo | readonly
+"$1" cd x=1 then echo test sed printf | then -eu
+	readonly x=1 readonly x=1
+	then sed && "$@" sed "$@" sed test local /usr/bin $(pwd) --verbose
+x=1 export grep then done 2>/dev/null -eu cd 2>/dev/null readonly cd -eu -eu echo
+		x=1 "$@" readonly $(pwd) "$1" /usr/bin cd printf 'quoted text' local "$1" $(pwd)
+	/usr/bin cd --verbose then cd done
+	-eu ${HOME} then && sed echo $(pwd) printf $(pwd) test x=1 && export ${HOME} sed
+		| then then $(pwd) 'quoted text' then "$1" 'quoted text' "$1" 'quoted text'
+	printf /usr/bin 2>/dev/null "$@" cd local done $(pwd) && cd | | ${HOME}
+		cd printf "$@" cd awk local awk echo 2>/dev/null printf then awk "$@" sed
+"$@" $(pwd) && sed ${HOME} test "$@" awk grep test awk done "$@"
+'quoted text' /usr/bin test
+	&& 2>/dev/null awk /usr/bin cd done $(pwd) awk test
+printf && then && && export ${HOME} done $(pwd)
+"$1" sed /usr/bin ${HOME}
+	local cd $(pwd) local then local then -eu export $(pwd) && --verbose readonly
+	local $(pwd) && readonly
+| --verbose /usr/bin /usr/bin
+		test printf | echo -eu x=1 x=1 "$@" printf $(pwd) then
+	x=1 sed awk 'quoted text' x=1 grep printf readonly x=1 done x=1 'quoted text'
+	x=1 --verbose 'quoted text' readonly echo "$@" sed -eu "$@" readonly ${HOME} then
+		readonly printf done grep -eu -eu ${HOME} --verbose
+	sed cd awk grep -eu --verbose local "$@"
+-eu 'quoted text' awk test && test 2>/dev/null readonly 2>/dev/null
+	&& ${HOME} awk grep "$@" /usr/bin done 2>/dev/null
+		cd && awk 2>/dev/null printf -eu sed "$@" export cd readonly test 2>/dev/null
+sed $(pwd) cd -eu echo local "$@" x=1 | 'quoted text' grep x=1 echo cd &&
+	local local cd test 2>/dev/null "$1" readonly /usr/bin echo echo "$1" grep grep
+		-eu then "$1" ${HOME} $(pwd) "$1" ${HOME} --verbose grep ${HOME} 2>/dev/null
+		cd -eu readonly --verbose printf done readonly "$@" then then grep /usr/bin done
+local done done 'quoted text'
+		cd 'quoted text' done grep $(pwd) grep awk awk awk echo sed 2>/dev/null | grep
+	${HOME} "$1" local grep | /usr/bin local
+2>/dev/null $(pwd) printf 'quoted text' local
+	local 2>/dev/null done ${HOME} /usr/bin x=1 /usr/bin "$@" && cd --verbose
+		grep && then readonly readonly done
+sed echo -eu local "$1" test "$1" /usr/bin
+		readonly then cd local "$1" local local "$1" x=1 export && "$1"
+		cd echo ${HOME} printf awk /usr/bin "$@" 'quoted text' -eu "$1"
+		x=1 then /usr/bin /usr/bin $(pwd) export cd grep
+	"$@" 'quoted text' --verbose | && cd awk 2>/dev/null
+		"$@" | export done export
+--verbose x=1 && readonly done /usr/bin /usr/bin --verbose 'quoted text'
+		local /usr/bin && x=1 test export && $(pwd) /usr/bin cd ${HOME} readonly
+	test sed && local printf 2>/dev/null local sed printf | local test 2>/dev/null
+	grep -eu -eu ${HOME} -eu awk readonly echo --verbose ${HOME} x=1 cd
+	'quoted text' printf 'quoted text' grep then $(pwd) echo 'quoted text' then readonly
+	done sed done -eu local test --verbose && /usr/bin printf && export local sed sed
+cd 'quoted text' "$@" cd /usr/bin
+		sed | then printf printf done then echo |
+x=1 sed echo sed cd | "$@" 'quoted text'
+	"$@" "$@" done grep | ${HOME}
+		-eu | ${HOME} test then done echo 2>/dev/null 2>/dev/null
+local then sed "$1" --verbose local 'quoted text' $(pwd) 'quoted text' grep
+		x=1 grep && sed awk sed 'quoted text'
+	'quoted text' x=1 "$@" export &&
+awk then cd readonly --verbose export grep --verbose 2>/dev/null |
+	export 'quoted text' cd then
+x=1 -eu $(pwd) 'quoted text'
+echo 'quoted text' local cd local printf cd
+	${HOME} test x=1 "$1" 'quoted text' grep
+		&& 'quoted text' /usr/bin -eu awk echo readonly
+echo ${HOME} sed awk 'quoted text'
+"$@" sed cd sed readonly cd
+	echo awk export then | $(pwd) | 'quoted text' grep "$1" "$1" awk 2>/dev/null
+		${HOME} echo then | 'quoted text' ${HOME} printf "$1" test /usr/bin 2>/dev/null
+		cd | | --verbose -eu done x=1 export then grep grep local
+	local x=1 sed -eu awk "$@" --verbose awk then 'quoted text' ${HOME} 'quoted text'
+		x=1 'quoted text' echo && sed echo test x=1
+export readonly local --verbose
+local then then printf
+printf test awk cd grep 'quoted text' sed
+'quoted text' -eu cd echo then echo
+		sed cd -eu x=1 then "$@" /usr/bin
+'quoted text' sed done test done x=1 cd -eu && && export | awk /usr/bin
+		readonly cd local $(pwd) "$1" /usr/bin then echo awk then export then /usr/bin
+printf then 2>/dev/null -eu echo done readonly printf test
+	${HOME} ${HOME} awk | /usr/bin 'quoted text'
+${HOME} /usr/bin /usr/bin done readonly 'quoted text'
+	cd $(pwd) 2>/dev/null printf ${HOME}
+		'quoted text' "$1" sed /usr/bin
+test sed "$@" | export --verbose local "$1" ${HOME} test ${HOME}
+		readonly sed test "$1" then readonly
+echo echo $(pwd) ${HOME} sed printf
+	&& done printf readonly readonly ${HOME} local ${HOME} awk readonly
+local "$@" /usr/bin then readonly "$1" sed --verbose
+	| --verbose "$@" "$1" $(pwd)
+		export "$@" test 'quoted text' | readonly -eu readonly export done | x=1
+echo "$1" printf export test
+done readonly "$@" $(pwd) readonly export cd "$1" test grep
+&& local $(pwd) "$1" done "$1" x=1 awk 2>/dev/null | ${HOME} local "$1" then
+/usr/bin grep done test echo $(pwd) x=1 ${HOME} test | awk sed
+		| test grep 'quoted text' test printf 2>/dev/null
+cd local --verbose then echo sed grep && x=1 $(pwd)
+x=1 -eu --verbose awk 2>/dev/null sed local 'quoted text' "$1"
+	${HOME} "$1" then printf ${HOME} x=1
+	cd cd -eu echo export "$@" --verbose "$1" --verbose "$@"
+		cd -eu echo 2>/dev/null x=1 ${HOME} 'quoted text' 2>/dev/null printf
+		${HOME} x=1 /usr/bin awk sed "$@" && sed export 2>/dev/null sed 2>/dev/null
+		grep -eu done 2>/dev/null "$@" done awk export -eu "$1" awk -eu
+'quoted text' "$1" && then local then "$@" "$@" awk ${HOME}
+		x=1 echo 2>/dev/null then local export grep
+		export && test awk grep done echo
+		awk grep /usr/bin x=1 x=1 "$@" cd grep local test
+$(pwd) /usr/bin 2>/dev/null done
+-eu x=1 x=1 then --verbose "$1" && /usr/bin
+$(pwd) echo "$@" sed grep printf /usr/bin "$@" then $(pwd) "$@" &&
+test ${HOME} 2>/dev/null | "$1" local /usr/bin --verbose
+	$(pwd) && 2>/dev/null cd local printf
+'quoted text' grep --verbose ${HOME} ${HOME} 2>/dev/null -eu "$1" export
+	--verbose echo local local export
+then echo readonly && --verbose echo grep "$1" readonly "$1" $(pwd) export
+		readonly 2>/dev/null export 2>/dev/null -eu && local
+		| grep cd done ${HOME} cd x=1 --verbose grep cd readonly cd --verbose
+	readonly | "$@" ${HOME} export sed
+	readonly printf sed done x=1 grep "$1" printf "$@" 2>/dev/null
+	grep sed local echo | | then done echo awk grep export sed test done
+	echo test "$1" --verbose
+		export grep /usr/bin 'quoted text'
+		/usr/bin $(pwd) | export && "$@" 2>/dev/null
+	export sed && echo "$@"
+		awk $(pwd) 'quoted text' export echo | 'quoted text' cd awk cd printf cd cd
+		/usr/bin 'quoted text' $(pwd) |
+		local local printf $(pwd) 'quoted text' x=1 2>/dev/null | /usr/bin then
+	echo && cd done cd && test grep printf --verbose
+		'quoted text' "$@" export | readonly printf test
+		-eu && -eu "$@" awk printf grep export readonly
+	awk ${HOME} "$@" test /usr/bin grep -eu 2>/dev/null
+		printf echo --verbose $(pwd) $(pwd) x=1 x=1 grep
+	"$@" ${HOME} echo readonly
+		sed local "$@" "$@" local done done grep | -eu | "$@" done 2>/dev/null
+		local sed 2>/dev/null --verbose -eu echo
+${HOME} --verbose --verbose
+${HOME} done grep readonly x=1 local ${HOME} "$1" | --verbose -eu done
+		done "$1" echo "$1" "$1" local
+readonly local $(pwd) grep | x=1 grep sed $(pwd) printf "$1"
+	then && /usr/bin readonly
+	/usr/bin done local -eu ${HOME} sed test grep --verbose
+		printf "$@" export export --verbose sed --verbose
+done "$1" ${HOME} | /usr/bin export --verbose 'quoted text'
+awk test -eu sed printf test 2>/dev/null
+		&& $(pwd) awk done readonly 'quoted text' x=1
+	"$1" sed | 2>/dev/null readonly 'quoted text' then echo --verbose 2>/dev/null
+		$(pwd) /usr/bin done "$@" test 2>/dev/null && 'quoted text'
+"$@" test printf sed echo -eu local x=1 /usr/bin
+		awk test echo grep && | then && x=1 x=1 export readonly
+		readonly $(pwd) /usr/bin -eu $(pwd) readonly x=1
+	grep awk $(pwd) export then && | test $(pwd) done sed
+'quoted text' /usr/bin x=1 "$1" $(pwd) test 'quoted text' x=1
+printf x=1 echo echo then grep echo && /usr/bin then ${HOME} | x=1 sed "$1" then
+		"$@" export done cd cd export --verbose local /usr/bin 2>/dev/null test
+x=1 /usr/bin sed then sed --verbose
+	"$1" "$1" export && | then printf local grep x=1 x=1 --verbose sed /usr/bin $(pwd)
+		/usr/bin "$@" readonly cd && $(pwd) 'quoted text'
+		grep awk --verbose && local "$1" "$@" then cd | "$1" $(pwd)
+		-eu ${HOME} awk readonly awk grep then x=1 $(pwd) 2>/dev/null done local grep printf
+	then then printf cd ${HOME} export /usr/bin 2>/dev/null readonly readonly
+local done sed readonly awk x=1 /usr/bin printf cd
+cd awk echo x=1 $(pwd) -eu export printf x=1 "$1" | echo local echo
+readonly 2>/dev/null --verbose 'quoted text' | "$@" done -eu $(pwd) | grep
+	export $(pwd) printf --verbose "$1" "$1" -eu | echo export /usr/bin | -eu x=1
+		-eu test grep "$1" printf ${HOME} && grep
+	readonly "$1" then && 2>/dev/null
+x=1 -eu local 'quoted text' cd --verbose
+	then then local awk awk --verbose "$1" ${HOME} then --verbose x=1 echo
+		"$@" readonly ${HOME} /usr/bin sed echo "$@" 2>/dev/null sed ${HOME} /usr/bin
+		cd local then local awk x=1 x=1 /usr/bin
+local echo readonly done "$@" && export -eu 2>/dev/null | |
+	sed export local | readonly | readonly 2>/dev/null then
+		| awk then $(pwd) "$1" grep x=1
+		"$1" $(pwd) -eu x=1 cd | 2>/dev/null
+x=1 sed --verbose test done done awk -eu -eu /usr/bin
+	sed done echo export "$@" readonly done 'quoted text' done 2>/dev/null x=1
+-eu && $(pwd) printf ${HOME} && sed local "$1"
+		local cd ${HOME} done --verbose -eu "$1" readonly /usr/bin then x=1 'quoted text'
+		done awk export cd export test sed |
+done | printf printf "$@" readonly
+| 'quoted text' "$1" done $(pwd) printf echo readonly printf
+awk local done ${HOME} cd 'quoted text' awk ${HOME} && $(pwd) done
+	"$1" 'quoted text' cd 'quoted text' cd
+		--verbose sed echo echo ${HOME} sed --verbose echo --verbose
+readonly echo sed grep -eu 2>/dev/null
+	x=1 ${HOME} cd /usr/bin /usr/bin /usr/bin grep export "$@"
+	printf $(pwd) printf cd && local 'quoted text' --verbose -eu "$1" then |
+		/usr/bin done export "$@" $(pwd) 'quoted text' && awk "$@"
+| test awk 2>/dev/null echo sed -eu "$1" 2>/dev/null awk printf export
+	awk printf readonly sed 'quoted text'
+grep | test export "$@" -eu $(pwd) then 2>/dev/null | x=1 "$1" -eu printf
+	then printf 'quoted text' x=1 2>/dev/null local readonly 2>/dev/null /usr/bin /usr/bin
+		| test test 2>/dev/null --verbose x=1 echo 2>/dev/null
+		/usr/bin local | then /usr/bin readonly
+		x=1 export -eu ${HOME} --verbose awk /usr/bin grep done echo "$@" | then ${HOME}
+readonly readonly $(pwd) printf
+	"$1" printf $(pwd) readonly readonly -eu echo --verbose grep test
+		sed ${HOME} printf -eu export | done x=1 done test awk -eu /usr/bin
+x=1 ${HOME} test done readonly
+		awk x=1 --verbose 'quoted text' $(pwd) export export --verbose printf printf "$@"
+echo cd awk "$@" "$1" ${HOME} export awk echo x=1 ${HOME} readonly grep printf
+	done export ${HOME} 'quoted text' then $(pwd) | && awk
+/usr/bin /usr/bin ${HOME} printf export printf
+then printf local readonly /usr/bin
+		done readonly readonly 'quoted text' echo awk "$1"
+		${HOME} grep local awk --verbose echo 'quoted text' 2>/dev/null test
+then 'quoted text' | grep 'quoted text' test 2>/dev/null then echo x=1
+		then awk local sed "$@" /usr/bin x=1 awk readonly export ${HOME}
+	test readonly -eu sed cd | x=1 | | export export awk readonly
+		'quoted text' echo /usr/bin "$@" sed && export && --verbose
+		test && awk $(pwd) | && "$1" &&
+echo export sed printf sed test 2>/dev/null -eu "$@" printf ${HOME} $(pwd)
+printf 2>/dev/null "$1" test grep test local | 'quoted text' grep
+	readonly printf then "$@" local test
+		cd $(pwd) --verbose export then "$1" cd local "$1" sed x=1 'quoted text'
+	x=1 test readonly cd ${HOME} awk printf
+		test done | cd /usr/bin export ${HOME}
+		&& export then "$1" sed && | export ${HOME}
+		export && 'quoted text' ${HOME} export echo
+		| && /usr/bin -eu ${HOME} readonly local
+		awk then cd | ${HOME} local
+		test x=1 ${HOME} printf ${HOME} --verbose cd test done /usr/bin /usr/bin printf
+	${HOME} $(pwd) ${HOME} printf
+--verbose --verbose export && sed ${HOME} test grep grep test export
+-eu grep export export printf "$@" awk x=1 /usr/bin x=1 done then
+		&& local done "$1" /usr/bin "$1" x=1 readonly test x=1 sed 2>/dev/null
+	cd readonly awk grep export done ${HOME}
+	readonly export 'quoted text' test "$@" cd "$1"
+		-eu x=1 grep 2>/dev/null /usr/bin "$@" "$@" "$@" echo
+	"$1" && done | ${HOME} "$@" then
+${HOME} ${HOME} /usr/bin readonly x=1
+sed $(pwd) export grep 2>/dev/null 2>/dev/null test ${HOME}
+	local ${HOME} printf awk "$@" && | "$@"
+awk -eu /usr/bin readonly --verbose
+	| printf grep x=1 --verbose readonly
+	local printf then awk test awk 'quoted text'
+"$@" sed echo && printf then 2>/dev/null done && | ${HOME}
+	awk echo ${HOME} "$@" && 'quoted text'
+	grep then echo ${HOME} 'quoted text' cd 2>/dev/null 2>/dev/null local
+		awk --verbose echo awk done $(pwd) ${HOME}
+		readonly && -eu done 'quoted text' printf done ${HOME} cd 'quoted text' && $(pwd)
+x=1 --verbose sed awk 2>/dev/null ${HOME} done && test
+	sed test then 2>/dev/null 2>/dev/null
+	test "$1" x=1 | $(pwd) && printf export echo "$@"
+readonly printf local --verbose 2>/dev/null --verbose ${HOME}
+	"$1" ${HOME} sed x=1 -eu grep && done done &&
+	readonly awk readonly printf grep then done then $(pwd) local awk
+"$@" then local "$@" x=1 printf test then local
+&& printf then "$1" then done /usr/bin then echo "$1" test x=1 "$@" export "$@"
+		awk 2>/dev/null sed && local /usr/bin --verbose awk 2>/dev/null then x=1 x=1
+	printf -eu "$1" | cd printf "$1" awk 'quoted text' awk printf
+		local ${HOME} "$@" $(pwd) -eu local --verbose "$@" grep
+2>/dev/null /usr/bin | "$@" x=1 && $(pwd) /usr/bin
+		$(pwd) awk && done export -eu -eu echo awk
+		/usr/bin echo "$1" done local readonly -eu test
+		then export x=1 echo && readonly
+		-eu cd /usr/bin readonly -eu readonly
+	cd grep awk | export printf then sed 'quoted text'
+	done export then echo test
+	export "$@" test readonly /usr/bin --verbose "$1" then
+	printf -eu 'quoted text' 'quoted text' ${HOME} -eu local test
+2>/dev/null local local "$@" && cd 'quoted text'
+done /usr/bin && then && then export ${HOME} 2>/dev/null echo cd && 2>/dev/null
+		printf 2>/dev/null local $(pwd) x=1 awk cd
+&& local "$@" grep test grep
+-eu awk 2>/dev/null -eu
+	export 2>/dev/null ${HOME} 'quoted text'
+	/usr/bin 2>/dev/null ${HOME} grep | grep done 'quoted text' readonly
+	--verbose echo done sed local sed -eu -eu "$1" echo echo cd
+	then sed export x=1 export -eu $(pwd)
+/usr/bin grep "$1" test 2>/dev/null sed && awk then
+		awk | export "$@" 2>/dev/null readonly /usr/bin
+done | sed readonly awk test then
+	| && $(pwd) "$@" "$@" test sed
+	echo $(pwd) ${HOME} grep "$@" local --verbose
+		printf --verbose readonly awk /usr/bin grep "$@" /usr/bin x=1 -eu && ${HOME}
+"$@" && 'quoted text' x=1 cd ${HOME} awk grep "$@" awk export
+		grep grep && $(pwd) local x=1 grep | sed 2>/dev/null
+done -eu "$@" $(pwd) echo "$1"
+		"$@" /usr/bin x=1 2>/dev/null
+		'quoted text' awk -eu local ${HOME} && "$1" ${HOME}
+		echo cd printf ${HOME} sed export grep done 'quoted text'
+		2>/dev/null "$@" 2>/dev/null "$@" | awk done test
+		"$1" printf awk awk echo grep
+"$1" sed grep export then then printf $(pwd)
+--verbose cd echo printf done -eu | 2>/dev/null -eu
+export echo echo printf 2>/dev/null sed "$1" sed
+	--verbose "$@" | test /usr/bin echo 2>/dev/null grep 2>/dev/null
+	| 2>/dev/null "$1" "$1" /usr/bin awk test sed echo -eu done sed ${HOME} ${HOME}
+	x=1 /usr/bin /usr/bin 2>/dev/null && readonly test local echo --verbose 2>/dev/null
+	then local done printf &&
+	sed awk | "$@" --verbose /usr/bin "$1" ${HOME} done printf
+		awk 'quoted text' cd grep sed "$@" local sed export 'quoted text'
+	"$@" awk ${HOME} "$@" 'quoted text' ${HOME} cd $(pwd) x=1 ${HOME} printf
+	test then printf echo "$1" "$1" printf sed test awk 'quoted text' && /usr/bin
+		echo x=1 awk sed "$@" | --verbose ${HOME} awk /usr/bin
+	export echo && echo export sed
+	&& test grep "$1" done grep "$@" $(pwd) -eu done /usr/bin -eu sed local
+cd "$1" --verbose -eu sed | $(pwd) x=1 grep then | |
+	sed export x=1 readonly printf sed local
+printf | then | -eu 2>/dev/null ${HOME} local sed 2>/dev/null
+		&& x=1 done then cd 2>/dev/null awk
+	--verbose test awk grep | -eu "$1" $(pwd)
+		local sed printf 'quoted text' $(pwd) --verbose "$1" /usr/bin
+		awk ${HOME} done export && cd cd readonly && cd printf export "$1" echo &&
+	2>/dev/null grep /usr/bin x=1 grep export cd 2>/dev/null "$@" 2>/dev/null
+		cd && -eu 2>/dev/null echo $(pwd)
+| awk $(pwd) local $(pwd) printf --verbose /usr/bin printf x=1 grep grep
+"$1" test test echo /usr/bin cd /usr/bin
+	local done "$@" readonly awk
+		2>/dev/null sed && x=1 printf -eu grep "$@" then "$1" "$1" printf awk then --verbose
+		done -eu then export "$@" /usr/bin
+2>/dev/null ${HOME} /usr/bin done then x=1 "$1" -eu readonly readonly
+	printf $(pwd) x=1 -eu $(pwd) grep echo done sed done local echo "$@" |
+		done sed /usr/bin 2>/dev/null
+	local $(pwd) ${HOME} /usr/bin cd
+	&& cd && awk $(pwd) local
+| local sed -eu "$1" grep grep $(pwd) printf echo done
+	'quoted text' $(pwd) cd test --verbose 2>/dev/null readonly /usr/bin 'quoted text'
+export local done && $(pwd) 2>/dev/null local | "$@"
+		&& sed -eu awk | x=1 /usr/bin then echo --verbose cd "$@" $(pwd)
+		export $(pwd) ${HOME} ${HOME} grep test done ${HOME}
+	done && --verbose 2>/dev/null sed x=1 && then sed | test test ${HOME} cd cd
+done test x=1 then then 2>/dev/null --verbose 2>/dev/null
+		2>/dev/null printf "$1"
+		grep export /usr/bin | awk awk x=1 test /usr/bin
+		done printf 'quoted text' 'quoted text' done /usr/bin grep "$@" "$1"
+	'quoted text' test -eu sed readonly readonly
+printf grep readonly --verbose then grep && done
+	${HOME} | 'quoted text' -eu "$@"
+	"$@" printf done readonly awk -eu ${HOME} grep && awk grep --verbose && && export
+	awk grep awk /usr/bin | local test readonly
+test "$1" -eu local -eu $(pwd)
+		test local then readonly
+	${HOME} | echo $(pwd) x=1
+		| sed 'quoted text' 2>/dev/null ${HOME}
+	$(pwd) -eu echo $(pwd) /usr/bin printf grep --verbose
+		export readonly "$@" -eu /usr/bin printf /usr/bin
+	grep ${HOME} done 'quoted text' test && "$@" x=1 grep "$@"
+		readonly 'quoted text' local | 2>/dev/null
+"$1" $(pwd) readonly printf echo export then grep done
+	done awk test 2>/dev/null | done $(pwd) echo 'quoted text' done then
+		done 2>/dev/null --verbose printf
+done grep 'quoted text' done done echo -eu "$@" | local then "$@"
+		'quoted text' test /usr/bin sed grep /usr/bin && cd echo x=1 readonly
+		"$1" $(pwd) -eu printf "$1" grep local && echo
+		"$1" ${HOME} then echo /usr/bin ${HOME} grep echo echo export && -eu /usr/bin
+--verbose 'quoted text' printf readonly export readonly then
+		local | $(pwd) $(pwd) "$@" printf 2>/dev/null -eu grep && awk grep sed
+-eu && sed x=1 /usr/bin done
+		-eu 'quoted text' awk | export x=1 local printf "$1" test "$@" test
+		local done done $(pwd)
+done then readonly | --verbose
+&& done cd "$1" sed && then "$1"
+		grep "$1" export grep x=1 cd then awk printf "$1"
+| awk test echo readonly sed "$1" echo && sed cd
+&& then /usr/bin done local cd &&
+		"$@" 'quoted text' -eu done | test
+	&& 2>/dev/null && 2>/dev/null
+&& 'quoted text' 'quoted text' export printf | then printf ${HOME} done readonly
+	2>/dev/null readonly readonly done echo printf
+&& "$1" done done ${HOME} awk
+		then cd echo export cd export echo awk test 'quoted text' cd -eu readonly local
+		x=1 cd echo export ${HOME} | /usr/bin ${HOME} x=1 $(pwd)
+local cd | grep /usr/bin printf then 'quoted text' awk
+done local 'quoted text' test printf | /usr/bin cd cd local x=1 "$@" sed local
+&& echo readonly awk $(pwd) && grep --verbose then awk export
+		awk "$@" echo grep | readonly x=1 --verbose sed awk "$1" | local
+	grep grep then readonly
+then "$@" test printf echo echo 2>/dev/null "$1"
+local then echo ${HOME} --verbose | --verbose -eu 'quoted text' test cd
+		x=1 | cd && local "$1" local /usr/bin
+	cd "$@" cd -eu 'quoted text' grep awk --verbose grep 'quoted text' &&
+	then "$1" awk 2>/dev/null x=1 /usr/bin readonly
+	readonly "$1" /usr/bin "$1" "$1" "$1" cd done
+		&& export 'quoted text' local grep --verbose x=1 x=1 cd echo sed done /usr/bin then
+/usr/bin awk --verbose && cd awk | test --verbose
+		x=1 $(pwd) --verbose | | | "$@" 'quoted text' | -eu "$@" sed 'quoted text'
+sed --verbose test awk | && --verbose export done readonly
+	export export readonly x=1 2>/dev/null echo grep cd echo $(pwd)
+readonly sed $(pwd) 'quoted text' /usr/bin
+	sed grep grep export "$1" printf printf x=1 $(pwd) then test ${HOME} sed
+		readonly 2>/dev/null /usr/bin sed /usr/bin -eu readonly test grep awk local "$@"
+	-eu printf x=1 x=1 $(pwd) ${HOME} test
+	sed awk 2>/dev/null then
+	$(pwd) x=1 'quoted text' local ${HOME} 'quoted text' x=1 ${HOME}
+		/usr/bin grep && readonly 2>/dev/null readonly grep --verbose printf
+	-eu --verbose -eu | "$1" sed --verbose ${HOME}
+		export then | grep ${HOME} "$1" /usr/bin printf printf echo
+		| sed grep "$1" cd ${HOME} export cd export /usr/bin
+	-eu | "$1" echo grep done sed ${HOME} cd grep done /usr/bin awk
+sed done then test && export
+local then --verbose "$@" -eu export local x=1 --verbose grep /usr/bin sed printf
+		/usr/bin 'quoted text' /usr/bin done printf then printf x=1 2>/dev/null
+		${HOME} $(pwd) x=1 done done | 'quoted text'
+-eu --verbose -eu x=1 then cd export 2>/dev/null $(pwd) 'quoted text'
+	sed "$1" -eu then awk ${HOME} then local printf
+		"$@" -eu echo export echo "$1"
+	echo 2>/dev/null -eu 2>/dev/null readonly test then then ${HOME}
+then 2>/dev/null -eu $(pwd) ${HOME} cd local echo echo
+$(pwd) done -eu 'quoted text' local -eu --verbose 'quoted text'
+	readonly test && awk x=1 | readonly echo | done export -eu export 2>/dev/null
+readonly | export grep $(pwd) readonly sed test done test $(pwd)
+2>/dev/null | 'quoted text' 'quoted text' echo
+done export "$@" done echo --verbose cd done && readonly export x=1 sed "$1" /usr/bin
+	awk "$1" x=1 echo ${HOME} then && ${HOME} $(pwd) && 'quoted text' done
+printf readonly test x=1 echo 2>/dev/null test then then readonly
+	local -eu awk awk $(pwd) export grep
+	'quoted text' done 2>/dev/null awk "$1" local
+printf local | done readonly "$1" x=1 export 'quoted text'
+"$1" "$@" 'quoted text' local "$1" "$@"
+then && done $(pwd) sed | local readonly then done
+	'quoted text' done readonly grep awk "$1" /usr/bin test echo x=1 --verbose
+		sed ${HOME} test --verbose
+cd printf 'quoted text' awk grep grep
+		/usr/bin --verbose -eu printf 'quoted text' /usr/bin
+cd sed /usr/bin 'quoted text' 'quoted text' --verbose && echo local grep
+printf -eu /usr/bin grep && 'quoted text' readonly
+	"$1" echo local cd "$1" && local && --verbose done readonly $(pwd)
+		export export | 'quoted text' awk && $(pwd) x=1
+		&& | $(pwd) $(pwd) "$@" local local awk awk /usr/bin $(pwd)
+	test cd sed && && printf grep cd "$1"
+		-eu x=1 "$@" test | 'quoted text'
+		cd test $(pwd) x=1 x=1 "$@" done then export "$1" x=1 ${HOME} -eu export grep
+done awk 2>/dev/null test then sed done x=1 x=1
+	cd test 2>/dev/null cd --verbose done
+		grep "$@" awk echo $(pwd) /usr/bin printf 'quoted text' 'quoted text' "$@" test
+#include c42.sh
+/usr/bin export --verbose -eu then local 2>/dev/null grep
+grep ${HOME} 'quoted text' && | done $(pwd)
+		| ${HOME} readonly x=1 test x=1 -eu /usr/bin 'quoted text' "$1"
+		2>/dev/null | awk $(pwd) $(pwd) /usr/bin 2>/dev/null cd
+	done sed $(pwd) "$@" then x=1 2>/dev/null 'quoted text'
+local local test | && echo echo --verbose | ${HOME}
+sed awk x=1 "$1" 'quoted text' export -eu printf
+2>/dev/null -eu "$1" echo export -eu grep local readonly
+		'quoted text' && $(pwd) local --verbose 'quoted text' | && -eu x=1 $(pwd) sed x=1
+local "$1" export printf sed
+done | "$1" $(pwd) test readonly 2>/dev/null -eu -eu ${HOME}
+&& cd cd printf test x=1
+		cd x=1 -eu sed done cd test grep then ${HOME} test readonly then 2>/dev/null
+-eu ${HOME} local printf /usr/bin 2>/dev/null "$1"
+	2>/dev/null awk /usr/bin cd && | then "$@" --verbose cd local
+	readonly 2>/dev/null && sed -eu "$1" $(pwd) printf
+	${HOME} "$1" done awk grep then $(pwd) ${HOME} then cd "$@" ${HOME} cd printf echo
+	-eu x=1 x=1 ${HOME} printf readonly readonly 2>/dev/null test
+grep $(pwd) "$1" && "$@" && -eu grep "$1" local --verbose
+	$(pwd) echo "$@" sed export readonly export $(pwd) then ${HOME} echo
+	-eu done awk echo 2>/dev/null readonly awk readonly printf | awk
+	"$1" printf done cd awk local --verbose "$@" $(pwd) done local awk
+done done printf $(pwd) awk test cd && printf -eu "$1"
+	then /usr/bin export awk 2>/dev/null then 'quoted text' "$@" 'quoted text' done
+	then x=1 grep /usr/bin test local local "$@" then printf
+then test -eu && --verbose grep
+		'quoted text' "$@" awk "$1" $(pwd) --verbose done && x=1 test -eu -eu local
+	&& cd cd printf readonly test x=1
+	echo "$1" 'quoted text' sed then printf --verbose -eu 'quoted text'
+	/usr/bin cd $(pwd) awk cd test done awk then "$1" | $(pwd) echo
+${HOME} "$1" awk sed done x=1 && local
+	x=1 sed -eu readonly sed 2>/dev/null sed echo cd 'quoted text' /usr/bin
+${HOME} -eu local test grep ${HOME} then ${HOME}
+	readonly done sed -eu && /usr/bin "$@" /usr/bin
+		/usr/bin x=1 awk ${HOME} printf --verbose "$@" $(pwd)
+export printf && then test test local /usr/bin printf awk | done
+		printf printf sed grep test "$@"
+/usr/bin && grep printf "$1" then && local cd local 'quoted text'
+		--verbose 'quoted text' 'quoted text'
+	printf export $(pwd) /usr/bin awk | "$1" && --verbose
+	2>/dev/null export echo 2>/dev/null
+		--verbose -eu | && x=1 done sed -eu | test /usr/bin
+		2>/dev/null local test awk cd "$@" grep ${HOME}
+x=1 sed "$1" cd "$1" "$@" done
+		"$1" then grep awk --verbose | readonly echo grep local test
+		&& --verbose && then done local sed "$1" then "$@" /usr/bin
+	2>/dev/null readonly $(pwd) sed export printf export readonly | awk test cd
+	grep x=1 test --verbose sed readonly printf -eu test x=1 'quoted text' --verbose
+	| "$1" local x=1 grep then printf --verbose cd sed 'quoted text' export
+		${HOME} test $(pwd) -eu sed ${HOME} x=1 ${HOME} sed export
+	/usr/bin export sed awk local sed
+	"$1" test local readonly export /usr/bin --verbose "$1" x=1 local then && test
+		sed local "$1" -eu ${HOME} $(pwd) --verbose ${HOME} 'quoted text'
+	'quoted text' printf sed $(pwd) | $(pwd)
+"$1" ${HOME} then sed done then x=1 -eu local
+		then cd local awk "$1" printf x=1 done echo -eu "$1" x=1 x=1 -eu "$@"
+	$(pwd) --verbose sed echo grep local printf then
+local ${HOME} done 2>/dev/null test 'quoted text' 2>/dev/null test test sed ${HOME}
+		then readonly cd | then -eu -eu 'quoted text' "$@" --verbose $(pwd) -eu
+	"$1" printf | export awk awk "$1" -eu
+	cd 2>/dev/null "$1" printf printf done ${HOME} $(pwd) local then then sed export
+grep "$@" grep awk local 'quoted text'
+	x=1 printf 2>/dev/null export printf cd export awk export ${HOME} 2>/dev/null
+sed awk --verbose "$@" x=1 x=1 && test done echo
+2>/dev/null /usr/bin export
+		"$1" printf && $(pwd) x=1 -eu printf | sed 'quoted text' done --verbose
+&& /usr/bin 'quoted text' $(pwd) /usr/bin && -eu 2>/dev/null | export -eu |
+		${HOME} export "$@" "$@" done $(pwd)
+		${HOME} x=1 && done test cd export local then grep test /usr/bin | 2>/dev/null
+	'quoted text' echo echo
+	grep sed grep -eu sed --verbose sed /usr/bin --verbose
+		--verbose local 'quoted text' 'quoted text' /usr/bin
+printf 2>/dev/null done cd readonly cd local
+	grep local local done |
+	awk "$@" test done /usr/bin readonly awk awk
+awk "$@" $(pwd) --verbose cd echo export | ${HOME} export "$@" export
+test printf then then $(pwd) export --verbose
+		'quoted text' | printf local x=1 done "$1" --verbose -eu readonly grep sed
+	printf /usr/bin 2>/dev/null "$@" "$@" awk x=1 | test done "$1"
+	"$@" grep cd cd ${HOME} sed local x=1 sed --verbose
+	"$1" x=1 2>/dev/null && test echo
+		readonly done /usr/bin echo readonly local
+		2>/dev/null done local -eu "$1" sed $(pwd)
+		$(pwd) | printf | then local cd readonly /usr/bin
+	${HOME} ${HOME} done && $(pwd) | test then
+	readonly echo then $(pwd) export cd -eu sed readonly cd
+	export /usr/bin export | && 2>/dev/null test $(pwd) echo then "$1"
+--verbose local && && /usr/bin 'quoted text'
+	x=1 cd test x=1 local "$1" x=1 then
+x=1 ${HOME} local && grep
+		x=1 then "$@" $(pwd) awk export 2>/dev/null "$@" grep
+| test printf x=1 export --verbose | "$@" echo cd local echo test --verbose
+cd -eu && $(pwd) "$1" 'quoted text' cd test | 'quoted text' "$1" echo x=1 test
+sed echo 'quoted text' done | |
+	"$@" --verbose 'quoted text' "$1" 2>/dev/null awk --verbose
+"$@" 'quoted text' printf readonly awk done awk grep cd --verbose ${HOME} export
+	$(pwd) 2>/dev/null && grep "$1"
+done grep echo echo $(pwd) cd readonly readonly
+	export x=1 echo readonly
+echo 2>/dev/null cd cd -eu echo export
+	| cd cd cd readonly readonly && done --verbose "$1" local /usr/bin --verbose
+		done --verbose awk -eu -eu grep "$@" /usr/bin local readonly
+	printf --verbose grep test -eu ${HOME} done "$1" export sed
+	local export x=1 sed && sed readonly
+		cd done cd done -eu local $(pwd) local "$1"
+	grep cd /usr/bin "$@" /usr/bin -eu -eu sed export cd | awk -eu
+		sed $(pwd) /usr/bin --verbose readonly /usr/bin -eu
+	local cd then x=1 x=1 sed sed "$@"
+	'quoted text' -eu /usr/bin x=1 done then
+awk | readonly && then export 'quoted text' printf 2>/dev/null
+		/usr/bin local $(pwd) /usr/bin cd done x=1 export
+		/usr/bin awk printf cd | grep export sed printf echo cd
+		$(pwd) ${HOME} --verbose echo export -eu printf $(pwd) && test "$1" grep done ${HOME}
+	"$@" && x=1 "$1" awk "$1" && "$1"
+	$(pwd) 2>/dev/null test export --verbose $(pwd) $(pwd) --verbose ${HOME} cd done
+	then readonly grep printf sed /usr/bin printf
+	2>/dev/null "$@" "$@" export $(pwd) && sed then -eu $(pwd) printf
+		"$1" --verbose 2>/dev/null grep printf
+cd sed awk --verbose | "$@" export local done &&
+	"$1" "$1" local "$@" 'quoted text' done | && | -eu 2>/dev/null
+		export "$1" awk /usr/bin
+	&& export then -eu done echo /usr/bin "$@" then test printf -eu "$@" 2>/dev/null
+&& "$1" /usr/bin -eu local echo $(pwd) sed echo export "$@" $(pwd) 'quoted text'
+	done local $(pwd) local -eu cd ${HOME} -eu then
+sed && x=1 echo $(pwd) ${HOME} cd grep sed local grep test local 2>/dev/null
+		cd awk export sed test x=1 readonly
+	test awk | $(pwd) ${HOME} 2>/dev/null awk /usr/bin cd test "$1" test
+	then x=1 cd | done local &&
+$(pwd) readonly && awk printf export
+x=1 /usr/bin awk && cd readonly awk 2>/dev/null grep 2>/dev/null "$@" cd
+'quoted text' ${HOME} done echo && sed test $(pwd) cd sed local && 'quoted text'
+	awk $(pwd) then test readonly | 'quoted text' printf 'quoted text'
+		done done echo && "$1" then 2>/dev/null x=1 x=1 ${HOME} -eu "$@"
+export 2>/dev/null test then readonly
+	local 2>/dev/null -eu awk done -eu grep && --verbose --verbose printf "$@" $(pwd)
+	then 'quoted text' then && $(pwd) export sed printf then then ${HOME} sed
+		"$1" /usr/bin "$@" cd x=1 readonly local /usr/bin 2>/dev/null ${HOME}
+cd then | /usr/bin 2>/dev/null /usr/bin ${HOME} "$1" $(pwd) | /usr/bin done
+	printf --verbose local | cd /usr/bin 2>/dev/null -eu "$1" ${HOME} printf | "$1"
+		printf export sed && local local grep 2>/dev/null grep 2>/dev/null then --verbose
+		readonly test 'quoted text' 2>/dev/null --verbose "$1"
+	then "$1" export 'quoted text' printf grep
+-eu 2>/dev/null echo awk -eu | test
+		$(pwd) awk /usr/bin | /usr/bin local | "$1" done x=1 ${HOME} "$1" "$@"
+		| -eu x=1 ${HOME} readonly
+		done test /usr/bin cd printf export echo && x=1 "$@" -eu echo done
+		-eu local x=1 --verbose awk --verbose
+		${HOME} test grep echo --verbose
+'quoted text' sed readonly && -eu sed sed grep echo cd x=1 grep "$@"
+		done $(pwd) --verbose sed "$1" readonly && ${HOME} $(pwd)
+		local "$1" x=1 printf then local "$@" test --verbose
+	$(pwd) awk printf local "$@" printf $(pwd) readonly
+cd test --verbose local x=1 "$1"
+--verbose cd | "$@" 'quoted text' "$@" --verbose /usr/bin
+	echo sed $(pwd) --verbose test --verbose 'quoted text' sed
+		done local awk ${HOME} test printf "$@" "$@" $(pwd) x=1 2>/dev/null
+		awk ${HOME} readonly "$1" echo cd $(pwd)
+done readonly printf grep test "$1" "$@" grep $(pwd)
+"$@" x=1 then echo /usr/bin
+		"$@" x=1 'quoted text'
+	/usr/bin grep --verbose test $(pwd) "$@" "$1" ${HOME}
+	sed x=1 cd && local sed grep /usr/bin && awk --verbose
+echo printf 2>/dev/null --verbose then | x=1 x=1 echo readonly "$@" done 'quoted text'
+	/usr/bin export -eu readonly -eu
+echo then done /usr/bin
+	| $(pwd) $(pwd) x=1 'quoted text'
+	awk -eu 2>/dev/null test test test awk awk --verbose awk local test
+	cd awk awk | echo printf "$@" local "$1" /usr/bin --verbose cd grep "$@"
+	export done printf /usr/bin test echo "$1" done && && 'quoted text'
+		"$@" x=1 local echo "$@" --verbose /usr/bin x=1 /usr/bin
+		x=1 --verbose echo "$@" /usr/bin
+		-eu sed awk then && then awk sed awk awk
+		'quoted text' -eu readonly 'quoted text' test 'quoted text' export
+local -eu printf cd cd readonly $(pwd) "$@" 2>/dev/null $(pwd) x=1
+"$@" readonly -eu done -eu -eu awk export && ${HOME} "$1" "$1"
+		2>/dev/null 2>/dev/null $(pwd) then then readonly
+&& grep "$@" printf --verbose -eu local
+		cd awk "$1" printf awk --verbose then awk then x=1 done --verbose ${HOME} "$1"
+		sed then | then "$1" grep "$1" x=1 | awk grep done --verbose 2>/dev/null sed readonly
+	2>/dev/null printf "$1"
+	readonly local readonly printf 'quoted text' --verbose
+	x=1 grep test --verbose done
+then local 2>/dev/null then $(pwd) --verbose readonly then x=1
+		2>/dev/null readonly grep grep /usr/bin $(pwd) readonly
+		export 'quoted text' 'quoted text'
+2>/dev/null ${HOME} export /usr/bin done sed readonly
+awk sed ${HOME} local echo sed --verbose x=1 done done "$1"
+--verbose $(pwd) "$@" -eu "$@" x=1 sed test
+printf local echo /usr/bin local readonly ${HOME} && done
+	'quoted text' cd grep ${HOME}
+		$(pwd) -eu | local ${HOME} awk echo
+done local 2>/dev/null awk
+-eu done "$@" done /usr/bin test done done ${HOME} 'quoted text' 'quoted text'
+		2>/dev/null grep -eu | /usr/bin "$@" ${HOME} "$@" "$@" cd -eu echo $(pwd)
+	export cd ${HOME} echo done export
+	x=1 then grep ${HOME} &&
+&& local then -eu && -eu -eu | -eu cd
+done $(pwd) local readonly /usr/bin then awk awk 2>/dev/null |
+${HOME} sed local 2>/dev/null
+	&& awk grep printf ${HOME}
+local printf "$1" sed echo "$@" /usr/bin ${HOME} echo "$@" done 'quoted text' grep
+	| sed done /usr/bin 'quoted text' | grep
+	local "$1" done | export done export 'quoted text' sed | grep "$1" sed | -eu
+		local then readonly "$1"
+	/usr/bin ${HOME} 'quoted text' sed export /usr/bin
+sed cd -eu x=1 awk then then x=1 done awk done ${HOME}
+/usr/bin /usr/bin awk local local
+local done && "$1" done awk local local done readonly $(pwd) | done sed "$@"
+		grep "$@" awk -eu /usr/bin done 'quoted text' "$@" /usr/bin
+	"$1" export 'quoted text' ${HOME} x=1 "$1"
+	--verbose --verbose done grep $(pwd) printf test $(pwd) test --verbose 2>/dev/null
+		"$1" && printf "$@" grep x=1
+'quoted text' cd "$@" 2>/dev/null readonly sed 'quoted text'
+x=1 /usr/bin local x=1 | export test 'quoted text' local
+		then grep grep x=1 -eu printf test "$1" done echo "$@" test | --verbose
+		2>/dev/null then x=1 echo awk
+		"$1" --verbose /usr/bin printf sed x=1 $(pwd)
+'quoted text' then printf cd printf then 'quoted text'
+	-eu "$1" /usr/bin done readonly | "$@"
+awk "$@" then "$1" $(pwd) done "$@" /usr/bin $(pwd) test
+/usr/bin done "$@" -eu "$1" "$@" 2>/dev/null | awk sed --verbose
+		'quoted text' x=1 'quoted text' | readonly then
+test awk $(pwd) awk "$1"
+	echo | "$@" awk | "$1" "$1" export ${HOME} printf test 2>/dev/null
+	local && 2>/dev/null | /usr/bin test "$1"
+'quoted text' printf sed $(pwd) export 'quoted text' ${HOME} && /usr/bin
+		$(pwd) 2>/dev/null x=1 done | test
+		readonly "$@" export local 2>/dev/null printf
+		then | --verbose --verbose 'quoted text'
+2>/dev/null echo ${HOME} 2>/dev/null
+	awk test x=1 sed test done done x=1 'quoted text'
+	grep /usr/bin && sed && && grep export
+	--verbose export "$1" -eu && ${HOME} && 2>/dev/null
+	$(pwd) | && "$@" -eu test readonly --verbose
+		grep export -eu printf readonly "$1" 'quoted text'
+		--verbose /usr/bin | "$@" export "$1" readonly
+		2>/dev/null printf cd /usr/bin 'quoted text'
+	/usr/bin sed 2>/dev/null $(pwd) done $(pwd) | test 'quoted text'
+echo export ${HOME} sed 'quoted text' && $(pwd) then "$@" printf printf readonly
+	-eu x=1 echo then sed 2>/dev/null "$@" 'quoted text'
+awk sed && test local awk grep "$@" echo echo then | done | awk
+x=1 x=1 export x=1 sed cd done | x=1 && test 2>/dev/null done
+		local grep 2>/dev/null "$1" local printf sed | export then
+	readonly readonly "$1" echo readonly
+		${HOME} export $(pwd) $(pwd) --verbose $(pwd)
+'quoted text' readonly
+	readonly -eu echo sed awk
+printf cd cd sed | -eu then /usr/bin
+		| 'quoted text' echo printf && test done cd "$1" cd ${HOME}
+printf 'quoted text' printf 'quoted text' 'quoted text' grep
+		| grep | -eu && local local
+	done export "$1" ${HOME} && export && grep
+	then test then readonly sed test 2>/dev/null --verbose done
+	"$1" then /usr/bin $(pwd) $(pwd) "$1" -eu
+		test /usr/bin then awk /usr/bin | | echo then awk x=1 --verbose
+	sed export -eu echo cd 'quoted text' --verbose x=1 2>/dev/null
+2>/dev/null /usr/bin && grep --verbose x=1 -eu cd echo
+	"$1" then ${HOME} "$@" | --verbose export echo then ${HOME} echo
+	done 'quoted text' 2>/dev/null done then awk grep
+test --verbose export 'quoted text' 2>/dev/null local sed 2>/dev/null
+x=1 grep "$@" && && && --verbose --verbose
+		export | done printf done
+	echo --verbose export $(pwd) readonly cd /usr/bin test -eu /usr/bin
+		x=1 -eu export 'quoted text' done "$@" cd x=1 sed done readonly
+	local $(pwd) "$1" printf -eu
+	-eu 'quoted text' "$@" | /usr/bin readonly done ${HOME} then
+	-eu x=1 readonly && test echo "$@" 'quoted text'
+--verbose | readonly "$@" awk -eu $(pwd)
+		x=1 $(pwd) && awk && && "$1" 2>/dev/null echo "$1" test then
+	/usr/bin /usr/bin cd grep 2>/dev/null | -eu
+		$(pwd) ${HOME} awk grep "$@" export ${HOME} | grep x=1
+&& 'quoted text' cd ${HOME} /usr/bin 'quoted text' test printf readonly
+done cd export ${HOME} -eu done
+		'quoted text' cd --verbose | awk $(pwd) test echo cd
+test "$@" x=1 "$1" | && then -eu "$@" local "$1" grep ${HOME} cd
+		${HOME} done 2>/dev/null grep sed readonly "$1" | x=1 "$@" && && | echo
+		done 2>/dev/null 'quoted text' readonly test "$1" export done 'quoted text'
+		x=1 "$@" done ${HOME} readonly test local ${HOME} "$1" readonly
+	awk 2>/dev/null x=1 $(pwd) done 'quoted text' sed && export 2>/dev/null
+		local && printf printf sed sed 'quoted text' grep
+	awk && cd then 'quoted text'
+| "$1" -eu echo sed ${HOME} && "$1" "$@" --verbose export 2>/dev/null --verbose
+	then "$@" --verbose done x=1 /usr/bin grep
+	| awk -eu export echo echo && && test awk then
+2>/dev/null 'quoted text' 2>/dev/null
+readonly awk local local | /usr/bin echo --verbose
+	"$1" local "$@" ${HOME} test $(pwd) x=1 export grep | /usr/bin
+printf --verbose readonly export "$@" && $(pwd) 2>/dev/null
+awk -eu && sed grep local awk readonly $(pwd) cd | echo && done
+	${HOME} $(pwd) --verbose
+	readonly $(pwd) echo done test
+"$1" $(pwd) then export sed x=1 echo --verbose local done
+'quoted text' 'quoted text' awk x=1 $(pwd) /usr/bin
+grep $(pwd) then echo then printf
+	x=1 local "$1" sed grep test local && "$1" awk then /usr/bin
+grep cd 'quoted text' grep "$1" | grep awk ${HOME} 2>/dev/null 2>/dev/null
+	$(pwd) sed 'quoted text' readonly cd readonly
+	2>/dev/null sed grep test cd --verbose local 'quoted text' sed "$@" $(pwd) sed
+		export cd $(pwd) x=1 then 'quoted text' readonly cd x=1 sed readonly sed 'quoted text'
+		"$@" x=1 ${HOME} awk 2>/dev/null sed then echo /usr/bin |
+		echo ${HOME} printf test test readonly
+echo && printf readonly --verbose
+	&& sed then export cd | sed awk 'quoted text' test
+		readonly --verbose x=1 export x=1 $(pwd) x=1 && ${HOME} printf
+	--verbose export printf
+"$@" 'quoted text' x=1 -eu then awk readonly "$1" done grep
+grep cd test ${HOME} echo
+		-eu 2>/dev/null sed grep export | readonly done cd grep
+		readonly sed readonly && sed --verbose ${HOME} then /usr/bin
+awk 'quoted text' /usr/bin
+	--verbose x=1 2>/dev/null test 2>/dev/null
+		| $(pwd) -eu printf 2>/dev/null
+	awk test ${HOME} $(pwd)
+	awk && printf echo readonly --verbose local sed "$@" x=1 then then export
+	&& grep && cd $(pwd) export && echo "$@" awk x=1 && 'quoted text' 'quoted text'
+-eu export readonly /usr/bin
+	done cd cd "$1" && sed echo echo | test echo export awk done
+		${HOME} --verbose awk "$@" printf -eu /usr/bin readonly
+	cd /usr/bin 'quoted text' echo echo x=1 echo test ${HOME} 2>/dev/null /usr/bin
+	&& /usr/bin 2>/dev/null --verbose -eu sed /usr/bin $(pwd)
+		--verbose 2>/dev/null echo sed cd printf ${HOME}
+	grep cd awk cd test export $(pwd) sed -eu && 'quoted text' test
+| $(pwd) ${HOME} readonly test awk | then export 2>/dev/null grep test "$1" "$@"
+2>/dev/null --verbose cd 'quoted text' | then
+printf --verbose x=1 | printf --verbose
+	done export readonly |
+"$@" grep --verbose sed printf export test then
+		cd x=1 echo grep export /usr/bin done echo -eu
+		&& --verbose sed printf 2>/dev/null grep printf local /usr/bin
+$(pwd) -eu local 'quoted text' readonly
+then /usr/bin | then test grep --verbose ${HOME} | readonly "$@" -eu local
+	done "$@" 2>/dev/null test then /usr/bin "$@" "$@" /usr/bin | printf sed "$@"
+grep --verbose $(pwd) test x=1
+		done "$1" "$@" x=1 then awk done
+		then test x=1 /usr/bin done /usr/bin test /usr/bin
+		${HOME} then readonly $(pwd) export | echo done
+	2>/dev/null test echo test 'quoted text' test $(pwd) ${HOME} x=1 --verbose
+	echo 'quoted text' x=1 "$@" "$@" x=1 "$@" grep -eu printf $(pwd) printf
+	"$@" "$@" test $(pwd) && export echo readonly readonly readonly "$@" printf
+		local $(pwd) -eu /usr/bin test --verbose 'quoted text'
+done awk 2>/dev/null then done awk --verbose 2>/dev/null | test -eu done done
+test ${HOME} /usr/bin test local awk "$@"
+cd "$@" awk --verbose -eu && "$1" x=1 export
+		readonly ${HOME} export grep grep export printf done
+		test done | test printf then test printf x=1 sed cd echo echo -eu grep "$1"
+	sed && | printf && --verbose sed "$1" awk && local done then export
+		awk 'quoted text' test "$1"
+	local sed /usr/bin 'quoted text'
+		readonly readonly x=1 awk 2>/dev/null
+	printf $(pwd) export ${HOME} $(pwd)
+		/usr/bin "$1" printf done cd ${HOME} echo x=1 &&
+	cd sed awk /usr/bin "$@" done
+printf then export printf
+		$(pwd) sed cd awk && | sed x=1 $(pwd) && done &&
+		export then echo printf "$1" cd ${HOME} echo "$1" &&
+test --verbose readonly -eu | $(pwd) then "$@" test
+x=1 ${HOME} done readonly && "$@"
+		| ${HOME} | echo "$1" readonly --verbose
+		readonly grep --verbose test export "$@" --verbose "$1" -eu done x=1 echo
+test printf /usr/bin "$@" echo awk && cd -eu x=1 readonly
+		x=1 | grep 2>/dev/null export --verbose 'quoted text'
+	cd 'quoted text' test grep x=1 2>/dev/null "$1" /usr/bin
+	2>/dev/null --verbose 2>/dev/null local && ${HOME} then grep test then "$@" "$@"
+readonly -eu $(pwd) then 2>/dev/null -eu echo export "$@" awk 'quoted text'
+local 2>/dev/null ${HOME} | 'quoted text' test printf
+&& printf printf readonly $(pwd) $(pwd) && && readonly done "$@" echo readonly
+		'quoted text' done -eu x=1 echo $(pwd) test 'quoted text' export | local &&
+		| local -eu $(pwd) $(pwd) done ${HOME} grep done readonly "$1" "$@" grep "$1"
+awk -eu echo export "$@"
+	export done done done 2>/dev/null printf
+done | local "$1" awk -eu then export "$1" sed awk export export
+		sed local "$@" readonly 2>/dev/null "$@" printf
+export ${HOME} "$@" done | echo printf "$1" 2>/dev/null
+	$(pwd) $(pwd) --verbose 'quoted text' then 'quoted text'
+x=1 test test cd local "$@" test 'quoted text'
+grep --verbose echo "$@" ${HOME}
+	2>/dev/null ${HOME} export ${HOME} "$@"
+	'quoted text' awk done x=1 /usr/bin
+		awk test "$1" sed 2>/dev/null $(pwd) local local --verbose
+readonly "$1" awk test 'quoted text' sed -eu printf readonly | awk
+awk printf && awk test test |
+awk echo sed cd $(pwd) local printf local test grep awk echo ${HOME} grep
+--verbose 2>/dev/null echo export -eu "$1" local &&
+		"$@" test | echo ${HOME} -eu echo done grep && --verbose
+'quoted text' sed sed awk then
+	2>/dev/null local grep x=1 -eu done printf /usr/bin export -eu 2>/dev/null
+	sed done -eu --verbose && && | "$@" --verbose 2>/dev/null 2>/dev/null
+		x=1 readonly 2>/dev/null && -eu
+		printf && "$1" /usr/bin 2>/dev/null
+grep awk "$1" 'quoted text' 2>/dev/null
+		/usr/bin -eu test test sed | export
+local grep awk ${HOME} | cd 'quoted text'
+		$(pwd) local test test "$1" 2>/dev/null local "$@" /usr/bin
+	sed && readonly && done then
+	printf test readonly --verbose local ${HOME} && done readonly
+export test 2>/dev/null "$1" cd local -eu awk then
+	x=1 cd awk cd --verbose 'quoted text'
+		local -eu done | "$@" sed "$1"
+	-eu test readonly | cd $(pwd) awk then done printf done awk && 2>/dev/null
+readonly ${HOME} printf test 'quoted text' awk printf readonly
+	then --verbose echo "$1" echo 2>/dev/null export --verbose x=1 2>/dev/null
+	--verbose | printf --verbose "$@" cd grep
+	-eu done export 2>/dev/null "$1" "$1" x=1 export 'quoted text' --verbose
+		x=1 test test grep --verbose 'quoted text' ${HOME} --verbose
+	test && printf | then --verbose "$1" /usr/bin
+		then grep | awk 'quoted text' done printf
+done --verbose test test "$1" printf "$@" printf ${HOME}
+	&& | "$1" awk local 'quoted text' 'quoted text' export echo readonly
+2>/dev/null --verbose echo
+export local then then "$@" "$@" then
+test "$@" printf test /usr/bin
+		'quoted text' awk export sed "$@" awk printf x=1 export /usr/bin -eu --verbose 'quoted text'
+test | cd "$@" x=1 local printf --verbose | $(pwd) cd
+	cd | local test cd 2>/dev/null export readonly --verbose cd "$@" | test && -eu
+		then echo grep cd done -eu readonly sed 2>/dev/null done 'quoted text'
+printf /usr/bin ${HOME} sed x=1 | ${HOME} $(pwd) -eu test 2>/dev/null
+then export ${HOME} 2>/dev/null
+	-eu x=1 printf printf printf x=1 grep then --verbose printf 2>/dev/null
+		sed 'quoted text' local --verbose readonly readonly awk -eu echo readonly
+		sed grep && 'quoted text'
+	2>/dev/null $(pwd) awk | local
+		awk -eu -eu "$@" readonly "$1" test
+	echo "$@" && --verbose test export then
+		&& sed ${HOME} readonly cd | readonly $(pwd)
+cd 'quoted text' test 2>/dev/null 'quoted text' "$1" sed sed 2>/dev/null
+		--verbose x=1 && cd 'quoted text'
+	2>/dev/null && echo -eu local 2>/dev/null
+awk sed readonly 'quoted text' local then "$1" "$1" test /usr/bin readonly $(pwd)
+-eu ${HOME} awk "$1" sed
+	echo 'quoted text' echo awk ${HOME} done 'quoted text'
+		$(pwd) x=1 --verbose readonly
+		awk $(pwd) 'quoted text' /usr/bin
+export 'quoted text' x=1 then -eu -eu export 2>/dev/null grep "$1" echo 'quoted text'
+		&& -eu test printf printf ${HOME} $(pwd) 'quoted text'
+		$(pwd) $(pwd) then test export grep /usr/bin printf
+"$@" done grep cd export x=1 -eu echo awk sed test
+cd test grep /usr/bin | printf
+local local local readonly
+	echo 2>/dev/null "$1" "$@"
+grep export local ${HOME} export local ${HOME}
+printf $(pwd) | $(pwd)
+printf echo /usr/bin export awk done printf export -eu x=1 "$@"
+readonly /usr/bin test ${HOME} done export "$@"
+"$1" sed grep 'quoted text'
+--verbose -eu -eu export sed test printf local done
+		${HOME} done then echo x=1 | "$1" echo printf x=1 grep local
+		2>/dev/null cd $(pwd) readonly "$1" then awk ${HOME} 'quoted text'
+		grep readonly /usr/bin
+		printf readonly | done /usr/bin 'quoted text'
+	printf && printf test 'quoted text' -eu | 'quoted text' readonly done
+	--verbose then -eu test
+	2>/dev/null printf 'quoted text' && then grep /usr/bin grep sed awk cd printf
+		readonly --verbose export readonly sed $(pwd) -eu export readonly
+	then 'quoted text' grep sed -eu grep $(pwd)
+		| && done | ${HOME} $(pwd) | $(pwd) done printf local readonly
+	then | 2>/dev/null printf sed && grep cd ${HOME} done "$@" done then awk
+'quoted text' export | done $(pwd) --verbose
+		/usr/bin /usr/bin printf "$@" /usr/bin then | $(pwd) ${HOME} 'quoted text'
+x=1 export done "$1" | "$@" awk "$1" cd then ${HOME} /usr/bin "$@" export echo awk
+		printf -eu ${HOME} awk cd $(pwd) awk
+		x=1 $(pwd) echo "$@" | then $(pwd) -eu 'quoted text' test export 'quoted text'
+/usr/bin awk sed --verbose local | test cd grep -eu --verbose echo grep -eu local
+		printf 'quoted text' 2>/dev/null done then | && ${HOME}
+| sed awk 2>/dev/null 'quoted text'
+| sed printf -eu -eu --verbose
+	readonly && cd test && printf "$@" printf 'quoted text'
+		printf done awk $(pwd) then local x=1 done then printf then then x=1 awk && export
+		awk awk awk local printf 'quoted text' /usr/bin x=1 -eu 'quoted text'
+		done then cd done sed export cd $(pwd) echo "$@"
+		--verbose 2>/dev/null | "$1" "$1" then x=1 "$1" "$@" ${HOME} ${HOME} |
+	"$@" | awk local test -eu $(pwd) local
+	cd local grep "$1" ${HOME} 2>/dev/null then then export /usr/bin | then
+	-eu cd --verbose && --verbose | echo "$@" -eu export -eu echo
+printf printf done test grep
+	-eu -eu done cd readonly
+	sed cd printf "$@" -eu then && && then cd 2>/dev/null x=1 'quoted text'
+'quoted text' grep local x=1 then 'quoted text'
+	&& /usr/bin grep then grep awk test export export $(pwd) --verbose
+	echo | 2>/dev/null printf /usr/bin "$1"
+		'quoted text' 2>/dev/null echo | --verbose
+	2>/dev/null awk $(pwd) printf && done done -eu local
+	readonly echo -eu /usr/bin awk -eu printf test /usr/bin readonly done /usr/bin
+		"$1" then sed test done echo cd /usr/bin -eu --verbose local ${HOME} export
+	done "$1" /usr/bin | grep cd && awk then "$@"
+"$1" 2>/dev/null --verbose done
+echo then export done readonly
+		${HOME} 2>/dev/null && --verbose
+	echo -eu --verbose cd ${HOME}
+&& sed 2>/dev/null echo 'quoted text' test local
+		readonly grep test 'quoted text'
+	${HOME} local -eu --verbose ${HOME} 'quoted text' done "$@" test test --verbose
+	local -eu | -eu echo test /usr/bin && 'quoted text'
+local echo grep local $(pwd) grep 2>/dev/null sed ${HOME}
+		/usr/bin -eu "$1" x=1 $(pwd) then awk "$1" readonly "$1" echo sed test test "$1"
+echo export echo done echo done grep "$1" grep local
+	"$1" echo readonly done | "$@"
+/usr/bin echo "$@" grep awk test 'quoted text' &&
+		export && awk export 2>/dev/null
+	--verbose -eu export printf grep echo 2>/dev/null
+2>/dev/null test export | "$@" sed -eu test | readonly echo -eu
+	"$1" cd local $(pwd) $(pwd) then then awk sed export then /usr/bin awk test
+x=1 cd -eu readonly -eu printf 2>/dev/null
+--verbose then grep grep -eu
+2>/dev/null cd $(pwd) "$1" export 2>/dev/null ${HOME} /usr/bin
+	| readonly 2>/dev/null grep "$1" "$@" cd $(pwd) "$1"
+-eu sed sed awk $(pwd) $(pwd) awk echo $(pwd) x=1 'quoted text' done 2>/dev/null
+	"$@" export export sed /usr/bin local x=1 echo printf 'quoted text' done
+	local done grep export sed 'quoted text'
+	$(pwd) sed sed x=1 --verbose
+		cd sed test -eu grep 2>/dev/null export 'quoted text'
+		2>/dev/null -eu readonly grep
+${HOME} 2>/dev/null sed 'quoted text' 'quoted text' | | x=1 -eu then /usr/bin
+		${HOME} -eu | /usr/bin test local then sed
+		echo printf "$1" awk 2>/dev/null
+		"$1" -eu echo 2>/dev/null x=1 'quoted text' echo then test export -eu --verbose
+grep printf 'quoted text' then done export export
+		x=1 /usr/bin --verbose printf sed awk awk $(pwd) echo export /usr/bin
+	${HOME} echo then | sed sed $(pwd) "$1" x=1 readonly test ${HOME} local
+	then readonly printf grep readonly awk
+export && done echo grep ${HOME} done printf
+		2>/dev/null 'quoted text'
+		local cd && export "$@" done x=1 -eu $(pwd) then x=1 'quoted text'
+$(pwd) awk -eu awk echo then 2>/dev/null then /usr/bin
+	test test && "$@" sed 'quoted text'
+	$(pwd) "$@" 2>/dev/null $(pwd) readonly
+		done $(pwd) done ${HOME} /usr/bin
+-eu printf done grep | $(pwd) awk 2>/dev/null $(pwd) "$1" sed cd && "$1" 2>/dev/null
+		test && echo "$1" "$1" --verbose 2>/dev/null export grep printf ${HOME}
+	printf awk test x=1 x=1 -eu && "$1"
+done -eu cd x=1 awk local
+x=1 export sed test done /usr/bin readonly x=1 2>/dev/null 2>/dev/null
+| /usr/bin $(pwd) local 2>/dev/null
+2>/dev/null then sed $(pwd)
+readonly -eu 2>/dev/null readonly export ${HOME} ${HOME} ${HOME} 'quoted text'
+	printf 2>/dev/null x=1 then export export printf cd echo grep cd x=1
+		test echo then ${HOME} local local readonly -eu && export
+	&& --verbose /usr/bin printf local then /usr/bin --verbose echo awk test
+-eu done -eu 2>/dev/null /usr/bin --verbose "$@" grep ${HOME} then export
+		export | done -eu export /usr/bin then ${HOME} $(pwd) sed test && 2>/dev/null
+		2>/dev/null grep --verbose done -eu cd grep echo printf "$1" -eu sed /usr/bin
+		${HOME} printf printf then 2>/dev/null x=1 --verbose sed x=1 echo "$1" 'quoted text'
+		&& "$1" | test sed printf grep awk 2>/dev/null /usr/bin --verbose
+		${HOME} -eu readonly "$@" "$1" 'quoted text' --verbose sed
+	printf readonly -eu grep "$1"
+"$@" export && echo /usr/bin
+	$(pwd) -eu awk 'quoted text' "$1" --verbose cd local readonly 'quoted text'
+'quoted text' local test awk echo $(pwd) test
+	export x=1 export then sed 'quoted text'
+		done echo done --verbose
+		"$1" sed readonly --verbose ${HOME} --verbose "$@" "$@" -eu printf done cd ${HOME}
+	$(pwd) local readonly | export 2>/dev/null
+	"$@" "$@" && "$1" cd 'quoted text' cd ${HOME}
+	x=1 2>/dev/null --verbose 'quoted text'
+	"$1" sed --verbose then | ${HOME} 2>/dev/null local
+--verbose "$1" sed printf done printf
+"$1" test -eu grep &&
+echo "$1" done export -eu
+	export awk x=1 $(pwd) grep printf ${HOME}
+	echo 2>/dev/null test ${HOME}
+echo --verbose then --verbose /usr/bin 2>/dev/null
+readonly echo ${HOME} done ${HOME} grep echo && ${HOME} local ${HOME}
+/usr/bin sed cd | /usr/bin
+	${HOME} | ${HOME} x=1 $(pwd) /usr/bin -eu 'quoted text'
+	test then "$@" | x=1 -eu x=1 grep 'quoted text'
+awk "$1" "$1" local 2>/dev/null
+		2>/dev/null "$1" then 2>/dev/null
+		export ${HOME} export awk /usr/bin "$@" 2>/dev/null && 2>/dev/null ${HOME}
+-eu echo test echo test
+	--verbose ${HOME} cd | printf cd "$@" done
+	echo test export readonly
+	sed readonly readonly printf echo ${HOME} $(pwd)
+test printf local ${HOME} test export done grep
+--verbose "$@" 2>/dev/null -eu x=1 done && grep "$@" ${HOME} /usr/bin
+$(pwd) cd then x=1 ${HOME} x=1 2>/dev/null readonly
+echo "$@" echo awk -eu echo --verbose "$@" done cd -eu $(pwd) sed
+	"$@" && local && && x=1 cd echo echo -eu "$1" -eu | -eu ${HOME} readonly echo 2>/dev/null
+then awk awk awk readonly ${HOME} x=1 'quoted text' x=1 grep
+	'quoted text' ${HOME}
+	"$1" grep printf --verbose "$1" /usr/bin --verbose ${HOME}
+	cd x=1 $(pwd) done | ${HOME} then /usr/bin local 'quoted text'
+		test 'quoted text' grep grep cd grep done 2>/dev/null export
+done | echo test "$@" export -eu /usr/bin readonly sed echo done "$@" --verbose
+		grep echo test echo x=1 echo cd 'quoted text' done
+&& local printf cd 'quoted text' | ${HOME} done sed then test -eu local
+"$@" "$1" x=1 /usr/bin awk then -eu sed grep
+x=1 --verbose x=1 --verbose -eu done sed --verbose -eu 2>/dev/null
+		cd x=1 readonly readonly
+	awk printf && /usr/bin done
+		echo awk grep local /usr/bin test local
+		-eu "$1" awk 'quoted text' ${HOME} test --verbose -eu done
+'quoted text' printf "$1" readonly done | 2>/dev/null && "$1" $(pwd) &&
+		echo "$@" "$1" --verbose 2>/dev/null
+test 2>/dev/null readonly && then -eu echo awk
+		then $(pwd) && ${HOME} readonly x=1
+"$@" then export $(pwd) -eu local cd grep export --verbose --verbose $(pwd) test
+	printf 'quoted text' readonly done 2>/dev/null sed
+2>/dev/null x=1 then -eu -eu "$@" readonly test ${HOME} then local
+	awk awk then then export $(pwd) 'quoted text'
+		'quoted text' awk cd grep done -eu "$1" ${HOME}
+test readonly 2>/dev/null cd done $(pwd) echo printf readonly -eu x=1 local
+	| $(pwd) echo x=1 done grep export "$1" 'quoted text' awk
+awk /usr/bin local readonly /usr/bin local echo echo
+test 2>/dev/null cd export
+		export -eu "$@" printf 'quoted text' /usr/bin --verbose awk "$1" readonly
+	readonly done grep 'quoted text' export readonly echo sed /usr/bin
+local && printf awk echo awk done cd printf 'quoted text'
+		printf sed grep ${HOME} test "$@" echo local | cd | "$@" "$@" echo
+		export /usr/bin cd test && printf | | printf /usr/bin
+x=1 "$@" ${HOME} $(pwd) export ${HOME} local test --verbose
+-eu 'quoted text' then cd grep cd readonly then "$1"
+		| grep sed && printf readonly sed -eu awk readonly ${HOME} -eu export sed
+-eu done /usr/bin $(pwd) echo cd 2>/dev/null
+readonly 2>/dev/null -eu
+readonly | export awk /usr/bin
+	"$1" sed printf local grep sed local 2>/dev/null local awk --verbose grep cd awk
+		--verbose export 'quoted text'
+	readonly | then ${HOME} -eu cd readonly printf --verbose test ${HOME} "$@" cd --verbose
+${HOME} x=1 sed | && then && && "$1" 'quoted text' ${HOME} test
+		readonly --verbose then local local echo
+${HOME} "$1" export /usr/bin readonly
+export export "$@" /usr/bin ${HOME} then 'quoted text' "$1" then grep
+		"$@" && done --verbose
+	$(pwd) -eu awk test sed
+	grep 'quoted text' readonly -eu ${HOME} export done printf cd $(pwd)
+		&& 'quoted text' cd "$@" --verbose cd echo $(pwd) "$1" awk test --verbose
+export | 'quoted text' sed &&
+		| awk && then readonly $(pwd) sed grep readonly "$@" done test sed
+		$(pwd) && grep x=1 -eu | "$@"
+		x=1 export "$@" test | 2>/dev/null | grep /usr/bin ${HOME}
+"$@" 2>/dev/null "$1" "$@" "$1" /usr/bin 2>/dev/null
+grep readonly cd printf sed ${HOME} test $(pwd) done then cd sed readonly $(pwd)
+	$(pwd) ${HOME} readonly -eu
+'quoted text' "$1" 2>/dev/null cd $(pwd) | export grep echo echo
+${HOME} ${HOME} done then grep && x=1 -eu echo echo x=1 && "$1" sed sed --verbose
+		x=1 -eu /usr/bin 2>/dev/null printf local readonly echo grep local
+'quoted text' echo "$@" test echo && 'quoted text' sed -eu
+grep cd then grep export done | grep && && x=1 readonly
+'quoted text' 2>/dev/null 2>/dev/null --verbose --verbose $(pwd) readonly
+then sed cd readonly done
+		readonly ${HOME} "$1" cd grep done 'quoted text' /usr/bin
+	$(pwd) printf "$@" x=1 $(pwd) && "$1" printf
+done cd sed cd 'quoted text' 2>/dev/null sed "$@"
+		| x=1 'quoted text' echo test echo 2>/dev/null
+test ${HOME} ${HOME} | "$1" --verbose
+/usr/bin 2>/dev/null echo readonly cd export awk 2>/dev/null --verbose
+		2>/dev/null test export && then && local |
+	&& x=1 /usr/bin $(pwd) awk sed sed sed
+		-eu | x=1 sed export 'quoted text' grep 2>/dev/null
+	local sed 'quoted text' /usr/bin printf x=1 "$@" $(pwd) "$1" export export
+	local awk "$1" | x=1 x=1 test then /usr/bin -eu /usr/bin 2>/dev/null
+		/usr/bin export export then "$@" test test x=1 done $(pwd) --verbose 'quoted text'
+	test echo | $(pwd) -eu
+		| export cd 'quoted text' test "$@"
+	--verbose test test 2>/dev/null $(pwd) 2>/dev/null cd ${HOME} x=1 &&
+test printf -eu "$@" sed printf && cd export then ${HOME}
+/usr/bin x=1 "$1" cd readonly | 2>/dev/null grep
+	2>/dev/null local "$1" /usr/bin
+	"$1" cd -eu done then done $(pwd) --verbose "$1" printf 'quoted text' cd
+"$@" x=1 | 'quoted text' ${HOME} export --verbose awk
+		${HOME} test sed echo grep "$1" then -eu printf
+		"$1" $(pwd) then x=1 local done x=1
+grep $(pwd) x=1 2>/dev/null test | readonly sed $(pwd) printf export 'quoted text'
+local readonly then local echo
+awk then done done sed readonly
+	/usr/bin sed cd --verbose awk grep export
+&& readonly -eu "$@" --verbose "$1" $(pwd) | x=1 'quoted text' 2>/dev/null
+		printf "$1" done test x=1 readonly ${HOME} 2>/dev/null
+	2>/dev/null test local export echo
+		${HOME} ${HOME} ${HOME} cd 'quoted text' local
+		printf $(pwd) x=1 2>/dev/null /usr/bin 2>/dev/null test -eu awk echo
+sed readonly export 2>/dev/null readonly "$@" 'quoted text' then --verbose
+		'quoted text' printf x=1
+		${HOME} test then export 2>/dev/null sed "$1" test $(pwd) "$@" sed cd local printf
+	2>/dev/null 2>/dev/null
+		${HOME} test -eu done ${HOME} done -eu -eu sed readonly test cd "$@" 2>/dev/null
+then 'quoted text' cd && readonly then && 'quoted text' /usr/bin x=1
+	$(pwd) sed sed local test awk
+"$1" 'quoted text' "$1" -eu "$@" && then printf 2>/dev/null then
+		export test x=1 awk awk export readonly echo printf sed done | export
+		export readonly "$1" ${HOME} readonly "$1" $(pwd) "$1" | | done 'quoted text'
+	export export x=1 printf $(pwd) echo echo "$1" test grep 2>/dev/null 2>/dev/null
+sed x=1 && echo echo sed | -eu
+	sed "$1" awk "$@" then export echo
+	readonly ${HOME} printf awk && | | "$1" done 'quoted text'
+		then && export && /usr/bin 2>/dev/null export awk printf readonly 2>/dev/null
+	grep then readonly echo export then 'quoted text' done printf /usr/bin
+	local $(pwd) x=1 export --verbose grep grep grep
+	then 'quoted text' test done
+	-eu ${HOME} x=1 export local
+	/usr/bin export sed /usr/bin --verbose
+		--verbose printf sed export x=1 awk awk echo grep
+		'quoted text' && /usr/bin done 'quoted text' x=1 -eu $(pwd) local cd readonly
+	| && | export cd echo readonly "$1" $(pwd) cd "$@"
+		printf readonly then x=1 printf $(pwd) ${HOME} "$@" 'quoted text' test -eu
+	export x=1 --verbose "$1" /usr/bin /usr/bin "$1" awk 'quoted text'
+	2>/dev/null readonly | then "$@" awk "$@" test --verbose $(pwd) "$1" grep
+	$(pwd) ${HOME} "$@" -eu && export ${HOME} cd ${HOME} export test
+then grep $(pwd) readonly done 2>/dev/null then
+	test awk test --verbose done ${HOME}
+		"$1" $(pwd) "$@" done /usr/bin local 'quoted text' /usr/bin 2>/dev/null
+		done x=1 --verbose -eu && printf cd 2>/dev/null x=1 local 2>/dev/null
+	echo && then 2>/dev/null "$1" --verbose x=1 2>/dev/null readonly
+		echo awk export test $(pwd) ${HOME} "$1" test 'quoted text'
+awk grep printf 'quoted text'
+		2>/dev/null && 2>/dev/null readonly grep $(pwd) "$@" | -eu test
+	/usr/bin 'quoted text'
+		then test "$@" "$1" done cd | && | | cd sed test | "$@" /usr/bin 'quoted text'
+	-eu 2>/dev/null -eu ${HOME} awk | x=1 "$@" done $(pwd) sed cd done
+--verbose && local grep && "$@" awk --verbose echo 2>/dev/null
+	x=1 export --verbose x=1
+	/usr/bin cd 'quoted text'
+	2>/dev/null --verbose --verbose "$1" --verbose grep /usr/bin
+cd $(pwd) "$1" | readonly 2>/dev/null
+		printf | echo sed printf export $(pwd) "$1" sed $(pwd)
+${HOME} --verbose cd --verbose printf 'quoted text' $(pwd) echo ${HOME} x=1
+		| printf test echo printf "$@"
+		"$1" /usr/bin test then printf "$1" local cd "$1" 2>/dev/null grep readonly sed
+		cd then local x=1 grep 'quoted text' printf done sed done --verbose
+	export test local $(pwd) cd export --verbose
+echo local -eu x=1 readonly --verbose local x=1 "$@" "$1" sed 2>/dev/null
+		awk ${HOME} awk cd sed $(pwd) x=1 2>/dev/null
+	echo grep $(pwd) --verbose -eu readonly -eu done && x=1 test "$@" 'quoted text'
+/usr/bin readonly --verbose
+	sed 'quoted text' test x=1 export test export cd 2>/dev/null
+export /usr/bin "$@" --verbose test
+		grep then && 'quoted text' then ${HOME} readonly /usr/bin test && | sed /usr/bin
+export ${HOME} echo x=1 done grep
+	test "$@" "$1" done "$@" awk "$1" readonly awk && sed grep echo local 2>/dev/null
+	local "$1" echo --verbose --verbose 2>/dev/null
+	done cd && ${HOME} awk --verbose
+--verbose ${HOME} sed && -eu then grep "$@" done /usr/bin
+grep printf x=1 /usr/bin awk export printf
+	--verbose local echo "$1"
+	readonly ${HOME} sed sed x=1 /usr/bin printf cd
+--verbose then done grep && "$1" done
+| awk && export 'quoted text' 'quoted text'
+		echo 2>/dev/null echo grep "$@" 'quoted text' /usr/bin sed
+	cd /usr/bin test printf | export && 2>/dev/null
+2>/dev/null "$1" -eu grep "$@" done grep then 'quoted text' local cd test
+readonly $(pwd) readonly
+		2>/dev/null && /usr/bin /usr/bin 2>/dev/null done -eu "$@"
+		test $(pwd) local "$@"
+'quoted text' awk 2>/dev/null /usr/bin readonly test /usr/bin
+	local local grep awk
+	/usr/bin export test grep awk "$1" /usr/bin cd then $(pwd) /usr/bin ${HOME}
+	/usr/bin grep "$@" export sed
+		"$@" ${HOME} sed -eu awk $(pwd) --verbose | ${HOME} printf
+2>/dev/null $(pwd) sed printf | --verbose --verbose
+	local "$@" "$1" /usr/bin 'quoted text' -eu $(pwd) /usr/bin -eu grep "$@"
+--verbose "$1" then then sed grep --verbose -eu ${HOME} sed
+local grep readonly awk test awk then && 2>/dev/null x=1 sed $(pwd)
+		--verbose test local "$@" sed sed && echo
+	-eu echo -eu ${HOME} cd awk ${HOME} ${HOME}
+grep local "$@" --verbose printf
+sed printf awk "$@" then "$@" && local cd grep $(pwd) -eu x=1
+printf cd /usr/bin ${HOME} "$@" "$@" -eu cd readonly 2>/dev/null
+	$(pwd) x=1 "$@" printf "$1" 2>/dev/null
+	"$1" awk sed sed then 'quoted text' /usr/bin grep echo x=1 grep && "$1" 2>/dev/null
+| cd | ${HOME} ${HOME} "$1" | awk printf ${HOME} 2>/dev/null then 2>/dev/null
+echo x=1 done 2>/dev/null printf local sed echo 2>/dev/null | cd "$@" grep ${HOME}
+awk 2>/dev/null --verbose readonly 'quoted text' $(pwd)
+	printf x=1 -eu 'quoted text' /usr/bin "$@" 2>/dev/null 'quoted text' local --verbose
+	--verbose 2>/dev/null /usr/bin "$@"
+	"$1" && printf 2>/dev/null cd sed -eu printf x=1 done
+		/usr/bin then | local test echo -eu | sed then test then x=1 sed "$1"
+sed | export awk --verbose then cd
+	local $(pwd) -eu done test "$@" && &&
+		/usr/bin sed local 'quoted text' then /usr/bin
+	/usr/bin then then $(pwd) "$@" readonly x=1
+		cd 'quoted text' /usr/bin ${HOME} 2>/dev/null $(pwd) /usr/bin
+		${HOME} done echo ${HOME} sed $(pwd) 'quoted text'
+		readonly awk echo echo 'quoted text'
+	| then -eu && export /usr/bin then
+		/usr/bin echo | export && 'quoted text'
+	$(pwd) -eu /usr/bin echo readonly
+		local --verbose echo x=1 x=1 echo "$@" x=1 grep
+| cd echo then $(pwd)
+	${HOME} /usr/bin 'quoted text' && 2>/dev/null export
+	echo done "$@" --verbose sed export grep
+-eu "$1" x=1 | readonly awk export done
+test ${HOME} local echo echo 'quoted text' readonly
+		2>/dev/null sed x=1 $(pwd)
+readonly x=1 $(pwd) --verbose $(pwd)
+		export done echo echo test --verbose
+		'quoted text' test -eu $(pwd) "$@" then printf $(pwd) |
+	--verbose then --verbose -eu ${HOME}
+	| 'quoted text' -eu /usr/bin awk awk /usr/bin $(pwd) test grep "$@"
+	done echo test /usr/bin cd echo
+	| "$@" cd "$@" test grep local ${HOME} && echo ${HOME} "$@"
+	test 'quoted text' local "$1" awk 'quoted text' sed 'quoted text' | 'quoted text'
+	local 2>/dev/null then "$@" local awk /usr/bin
+	then $(pwd) $(pwd) --verbose -eu --verbose /usr/bin $(pwd) ${HOME}
+| && readonly then done echo printf local cd -eu /usr/bin
+printf then awk "$@" /usr/bin grep echo then readonly
+--verbose "$@" echo $(pwd) | ${HOME} printf echo && printf sed echo "$1"
+awk x=1 export --verbose readonly --verbose sed test 'quoted text' export
+	x=1 --verbose --verbose "$1" "$1" 2>/dev/null then 2>/dev/null /usr/bin
+export -eu --verbose local --verbose
+	&& grep echo 'quoted text' ${HOME} && $(pwd) && | export grep echo awk
+/usr/bin x=1 -eu printf cd sed grep && then
+		echo 'quoted text' x=1 done x=1 printf awk $(pwd)
+	"$1" 'quoted text' "$1" grep echo $(pwd) printf cd local
+		${HOME} echo x=1 $(pwd) -eu readonly --verbose "$@" x=1 cd -eu export $(pwd) /usr/bin
+		test -eu x=1 'quoted text'
+		--verbose printf -eu 'quoted text' "$@" 'quoted text'
+	x=1 readonly printf test printf "$@" | && done
+	| $(pwd) readonly local done 'quoted text' readonly
+| then ${HOME} echo -eu ${HOME}
+		&& grep test -eu printf "$1" local 'quoted text' $(pwd)
+--verbose $(pwd) test /usr/bin /usr/bin
+		sed printf test grep --verbose 2>/dev/null test --verbose grep "$1" 'quoted text'
+		| cd grep 'quoted text' "$1" 'quoted text'
+	'quoted text' grep readonly "$@" echo grep
+	"$@" -eu x=1 test local local awk
+		sed -eu "$1" printf cd test | export $(pwd) --verbose printf
+done ${HOME} printf cd && export sed cd awk 'quoted text' test cd &&
+		printf readonly -eu 2>/dev/null $(pwd) --verbose cd test /usr/bin 'quoted text'
+$(pwd) echo awk && then ${HOME} grep 'quoted text' 'quoted text'
+		sed "$1" x=1 echo then "$1" test then $(pwd)
+export export $(pwd) local export -eu --verbose -eu
+--verbose then then $(pwd) | printf 2>/dev/null "$1" printf "$@" readonly then
+		"$@" local printf sed readonly then
+		echo && test | printf $(pwd) sed -eu
+"$@" ${HOME} "$@" then readonly "$@" --verbose local
+		${HOME} 2>/dev/null && ${HOME} echo $(pwd)
+	awk ${HOME} local /usr/bin done
+		-eu sed 'quoted text' $(pwd) $(pwd) awk "$1" /usr/bin "$1" $(pwd)
+	readonly done awk 2>/dev/null "$1" $(pwd) /usr/bin sed
+		grep readonly 2>/dev/null test "$@" "$@" echo 'quoted text' local
+		-eu 2>/dev/null grep -eu $(pwd) cd --verbose && echo
+	--verbose echo && "$@" "$1" done 2>/dev/null
+2>/dev/null then export readonly $(pwd) x=1 ${HOME} "$1" -eu cd cd export
+	export sed grep ${HOME} echo 2>/dev/null --verbose
+		cd "$1" done done echo echo readonly && && cd grep -eu /usr/bin awk 2>/dev/null
+'quoted text' cd /usr/bin /usr/bin "$@" --verbose $(pwd) echo sed sed done awk
+&& | 2>/dev/null 'quoted text' test --verbose grep
+--verbose done 2>/dev/null done && cd x=1 then export awk && /usr/bin | 2>/dev/null
+sed 'quoted text' then -eu ${HOME} "$@" export printf
+then 2>/dev/null then awk -eu
+		export && | cd -eu | printf awk $(pwd) "$@" awk local
+	--verbose 2>/dev/null ${HOME} $(pwd) | grep 'quoted text' test
+		awk export | /usr/bin test ${HOME} "$1" "$@" export "$1" test $(pwd) cd awk /usr/bin
+	awk "$@" then --verbose cd
+	/usr/bin 'quoted text' grep
+		$(pwd) readonly "$@" 'quoted text' export grep "$@" grep awk "$1" | && grep
+	| test | local /usr/bin
+/usr/bin "$@" x=1 printf sed
+	grep done --verbose test -eu --verbose $(pwd) readonly
+	echo sed sed $(pwd) export echo
+		readonly --verbose then | ${HOME} test echo x=1 grep done printf then
+		done grep test x=1 echo local && "$1" sed
+		awk test test 'quoted text' test local 2>/dev/null /usr/bin
+	done "$@" awk sed sed ${HOME} x=1 export
+'quoted text' sed 'quoted text' --verbose | --verbose ${HOME} export /usr/bin
+	$(pwd) awk printf 2>/dev/null
+	'quoted text' done local 'quoted text' echo
+	| 'quoted text' then done x=1 $(pwd) x=1 /usr/bin grep cd $(pwd) /usr/bin
+	sed ${HOME} x=1 export 2>/dev/null ${HOME} /usr/bin echo $(pwd)
+		local --verbose && "$1" done x=1 $(pwd) echo "$@" && grep 'quoted text' local grep
+		export $(pwd) printf ${HOME} then && -eu cd x=1 printf done echo sed sed
+grep then "$@" echo 2>/dev/null echo printf -eu export 'quoted text' test
+	"$@" echo test grep && -eu awk awk -eu && grep printf cd test local local
+--verbose done done | x=1 2>/dev/null
+test ${HOME} && awk /usr/bin
+'quoted text' sed x=1 /usr/bin done then echo sed && done sed sed ${HOME} $(pwd)
+'quoted text' cd sed done
+		$(pwd) cd /usr/bin cd "$@" echo -eu
+--verbose local -eu "$@"
+		then "$1" 2>/dev/null $(pwd) echo export cd ${HOME} |
+		then | "$@" 2>/dev/null then 2>/dev/null 'quoted text' echo "$@" && then ${HOME}
+${HOME} "$1" --verbose test -eu awk done test readonly export
+awk | "$@" test -eu | local "$1" awk
+		readonly && 'quoted text' grep awk readonly 'quoted text' printf
+export /usr/bin 2>/dev/null $(pwd) x=1 x=1
+		grep echo export sed x=1 -eu 'quoted text' then 2>/dev/null
+		printf readonly local 'quoted text' sed "$1" && sed
+"$1" --verbose done ${HOME} awk
+then cd readonly && then
+	| awk 'quoted text' readonly /usr/bin local ${HOME} sed | x=1 test cd $(pwd)
+		--verbose x=1 done local echo --verbose $(pwd) | printf "$@" sed printf
+		/usr/bin 'quoted text' 2>/dev/null
+${HOME} done done x=1 local local printf -eu local then "$1" export $(pwd)
+		printf cd readonly $(pwd) printf "$1"
+sed echo grep $(pwd) --verbose -eu | readonly
+		test 2>/dev/null readonly grep | awk x=1
+	grep | awk sed echo awk 'quoted text' --verbose --verbose ${HOME}
+		export 'quoted text' 2>/dev/null then 'quoted text' sed done &&
+	cd export | x=1 printf --verbose -eu cd local test
+	cd ${HOME} done ${HOME} printf $(pwd) -eu printf "$@" printf
+"$1" readonly /usr/bin --verbose "$@" "$1" test /usr/bin awk export -eu local
+		readonly /usr/bin echo grep grep x=1 cd "$@" then --verbose
+then sed awk /usr/bin x=1 -eu printf
+	| /usr/bin sed $(pwd) then "$@" local local readonly
+local grep export --verbose -eu $(pwd) done done printf x=1
+		x=1 grep /usr/bin done 'quoted text' cd awk
+		"$1" --verbose 2>/dev/null $(pwd) -eu readonly x=1 grep
+--verbose test 2>/dev/null
+		echo ${HOME} /usr/bin | /usr/bin echo echo | x=1 2>/dev/null done && grep
+		/usr/bin then done echo 2>/dev/null then sed sed test export done 2>/dev/null &&
+		sed sed "$@" awk cd "$1" cd ${HOME} "$1" x=1 --verbose test printf --verbose
+-eu $(pwd) awk /usr/bin --verbose
+local readonly $(pwd) --verbose cd --verbose
+		grep | grep "$@" sed $(pwd) "$1" /usr/bin sed then awk then grep --verbose
+'quoted text' -eu 2>/dev/null sed && "$@" 2>/dev/null 'quoted text' $(pwd) sed echo
+		| test cd "$@" 2>/dev/null export sed "$@" --verbose
+		"$1" then echo x=1 ${HOME} | readonly test awk
+		$(pwd) "$@" printf test $(pwd) sed 'quoted text' ${HOME} 'quoted text' 2>/dev/null
+| ${HOME} 2>/dev/null grep awk grep
+	x=1 && printf test local /usr/bin sed 2>/dev/null sed "$1" 2>/dev/null
+	local -eu 2>/dev/null printf && && $(pwd) echo --verbose "$@"
+done x=1 export done export $(pwd) readonly then then
+		sed 2>/dev/null printf readonly
+	--verbose awk awk "$1" readonly echo "$@" 'quoted text'
+		done then local export echo
+	readonly awk x=1 'quoted text' echo
+	| then | awk then -eu "$1" test cd && | $(pwd) -eu test 'quoted text'
+"$1" 'quoted text' x=1 && /usr/bin then echo ${HOME} $(pwd)
+done "$@" "$1" && /usr/bin /usr/bin "$1" done 'quoted text' sed --verbose then ${HOME}
+cd cd "$@" 2>/dev/null test local $(pwd) readonly local
+		sed export awk printf test export printf
+		local /usr/bin "$1" cd ${HOME} grep 'quoted text' readonly "$@"
+grep 'quoted text' -eu awk $(pwd) export
+		$(pwd) x=1 done then 2>/dev/null "$@" awk done ${HOME} sed cd echo &&
+	"$1" test then test -eu 2>/dev/null
+		"$1" /usr/bin -eu /usr/bin test grep
+		/usr/bin readonly sed echo awk ${HOME}
+		then "$@" then $(pwd) test | sed | "$1"
+	echo "$1" export done | 2>/dev/null
+		local grep ${HOME} "$@" done
+then | cd $(pwd) --verbose ${HOME} local export "$1"
+echo printf echo 2>/dev/null
+done test && test echo | 2>/dev/null awk readonly
+		$(pwd) readonly 2>/dev/null x=1 $(pwd) "$1" 'quoted text'
+	"$1" ${HOME} 'quoted text' -eu | --verbose sed ${HOME} awk printf && | then
+		local grep cd ${HOME} 'quoted text' && "$1" 2>/dev/null sed 'quoted text'
+	echo sed done "$@" done local then | printf && grep /usr/bin
+	test 'quoted text' test local "$@" "$@" grep local
+		echo printf $(pwd) grep
+		$(pwd) printf x=1 'quoted text'
+&& readonly test /usr/bin x=1 | awk | "$@" readonly x=1 sed export grep -eu readonly
+	export 2>/dev/null 2>/dev/null sed readonly $(pwd) /usr/bin cd
+-eu cd grep printf | $(pwd) cd cd "$1" "$1" echo done 2>/dev/null sed ${HOME}
+"$@" /usr/bin 2>/dev/null
+x=1 then cd -eu "$1" cd done test local done echo $(pwd) export ${HOME} done
+		$(pwd) grep readonly | local --verbose -eu 2>/dev/null -eu test $(pwd) printf
+/usr/bin --verbose && /usr/bin
+		then ${HOME} printf readonly cd ${HOME} grep export
+test local readonly "$1" "$@" test "$1" 'quoted text' $(pwd) then $(pwd)
+	awk | local awk export done test echo /usr/bin --verbose "$1" "$1"
+	-eu sed readonly grep export && 2>/dev/null | awk local
+grep --verbose awk cd "$1" local -eu grep "$1"
+--verbose /usr/bin grep | /usr/bin cd grep done
+		readonly local readonly "$1" x=1
+		cd sed sed echo readonly export grep
+printf x=1 --verbose test && ${HOME} "$@" done | 'quoted text'
+		export ${HOME} 2>/dev/null $(pwd) 2>/dev/null grep local $(pwd) 2>/dev/null $(pwd)
+echo printf /usr/bin test readonly export grep /usr/bin sed local sed 'quoted text'
+	local --verbose 'quoted text' /usr/bin "$1"
+	/usr/bin && "$1" "$1" then then 2>/dev/null done
+		&& 'quoted text' ${HOME} echo local "$@" x=1 | local
+	printf then cd printf echo 'quoted text' test
+	test done cd --verbose test echo grep 'quoted text' awk
+"$@" done echo x=1 --verbose $(pwd) readonly "$@"
+		2>/dev/null /usr/bin && && ${HOME} export /usr/bin $(pwd) $(pwd) echo
+"$1" local ${HOME} readonly readonly "$@" cd test
+	export "$@" --verbose printf done awk "$@" test echo ${HOME}
+done /usr/bin readonly 2>/dev/null printf grep printf printf local
+	&& cd x=1 ${HOME} sed ${HOME} && "$@" done echo cd test awk
+done 'quoted text' done done "$1" awk 'quoted text' printf x=1 done grep "$1"
+	sed --verbose | /usr/bin
+	${HOME} test /usr/bin sed /usr/bin readonly x=1
+		grep "$@" -eu then ${HOME} --verbose awk sed test export -eu "$@" --verbose -eu
+echo /usr/bin ${HOME} then grep /usr/bin x=1 'quoted text'
+		${HOME} x=1 export grep cd awk printf "$@" cd local
+		test export cd x=1 awk echo printf x=1
+	echo sed sed printf printf ${HOME} -eu ${HOME}
+		"$@" ${HOME} echo done local export "$1"
+	cd -eu "$1" awk "$@" 2>/dev/null local && --verbose grep readonly done readonly
+&& awk ${HOME} $(pwd) --verbose -eu printf $(pwd) "$@" printf test
+		export 2>/dev/null grep export printf
+test printf local "$1" printf
+"$@" then sed "$1" -eu done --verbose sed printf --verbose 2>/dev/null
+"$1" then grep && test printf
+export cd -eu "$@" 2>/dev/null done readonly then
+sed "$@" 'quoted text' printf echo sed | "$@" x=1 export 2>/dev/null
+	/usr/bin --verbose | ${HOME} && readonly
+		"$1" $(pwd) echo echo | 2>/dev/null -eu 2>/dev/null then export awk grep
+		echo then test "$@" test echo $(pwd) local -eu printf awk sed printf x=1 &&
+"$@" "$1" 'quoted text' local -eu printf then printf -eu done awk awk -eu
+export export then printf $(pwd) --verbose local |
+		2>/dev/null 2>/dev/null export test -eu echo ${HOME} export done cd export $(pwd)
+/usr/bin "$@" "$1" cd local "$@"
+		export then then 'quoted text' --verbose /usr/bin readonly --verbose sed readonly
+grep "$1" printf -eu local && then export then
+		echo /usr/bin | /usr/bin /usr/bin readonly readonly sed 'quoted text' |
+		cd export cd 'quoted text' grep awk $(pwd) "$@" test 'quoted text'
+	"$@" ${HOME} echo readonly --verbose readonly /usr/bin x=1 test test
+	-eu cd test test export -eu grep 2>/dev/null readonly /usr/bin $(pwd) 'quoted text'
+cd "$@" 2>/dev/null 'quoted text' then readonly readonly --verbose
+		--verbose $(pwd) local sed /usr/bin
@@ -0,0 +1,2001 @@
+		${HOME} test export sed 'quoted text' "$@"
+		$(pwd) then 2>/dev/null 'quoted text' readonly
+-eu readonly "$1" ${HOME} printf grep -eu awk "$@" then --verbose
+	grep grep test readonly grep x=1 done "$@" cd awk | grep ${HOME}
+${HOME} grep x=1 grep | 2>/dev/null 'quoted text' | | "$1" --verbose
+2>/dev/null ${HOME} 'quoted text' ${HOME}
+		test x=1 then awk -eu 'quoted text'
+&& ${HOME} 'quoted text' export /usr/bin awk "$1" | readonly
+-eu ${HOME} sed sed | test cd --verbose
+	2>/dev/null "$@" printf $(pwd)
+printf | printf sed --verbose
+	/usr/bin ${HOME} cd ${HOME} 2>/dev/null /usr/bin 2>/dev/null ${HOME} readonly
+| 2>/dev/null "$@" then printf "$1" then "$1" ${HOME}
+done local "$@" awk sed
+"$1" cd local | && local "$1"
+&& then sed test "$@" sed -eu -eu done | export
+		local "$@" 'quoted text' "$1" "$1" done grep echo test /usr/bin test "$@"
+	local printf local | export awk printf 'quoted text'
+		awk sed && export test --verbose "$@" test printf done -eu
+		local then printf echo "$1" --verbose export then test printf sed cd $(pwd) readonly
+	x=1 2>/dev/null /usr/bin x=1 x=1
+sed readonly | "$1" -eu done test && "$1" echo x=1 'quoted text' --verbose
+cd x=1 test test sed grep 2>/dev/null readonly
+		-eu printf test ${HOME} cd
+	sed export then echo -eu --verbose readonly ${HOME} sed local printf "$1" && cd
+	x=1 /usr/bin done test --verbose cd then then printf cd $(pwd) "$@" echo local
+		$(pwd) | x=1 sed --verbose printf
+		echo printf done done sed done readonly ${HOME} awk x=1 test && local ${HOME} x=1
+	| export ${HOME} 2>/dev/null 'quoted text' test export | cd
+	--verbose -eu test | 2>/dev/null ${HOME} echo grep export ${HOME}
+	| "$@" local 2>/dev/null x=1 'quoted text' --verbose
+done --verbose 'quoted text' done test local
+		${HOME} "$1" test grep grep -eu cd "$@" grep sed $(pwd) 2>/dev/null
+		grep ${HOME} cd -eu export && "$1" -eu echo then ${HOME} ${HOME} then "$@"
+		-eu | "$@" /usr/bin sed --verbose
+| readonly "$@" awk /usr/bin done 'quoted text' | awk 2>/dev/null "$@"
+x=1 readonly x=1 "$1" x=1 ${HOME} readonly && 'quoted text' export local
+readonly 'quoted text' local $(pwd) 2>/dev/null --verbose
+		${HOME} && x=1 'quoted text'
+		then local $(pwd) export $(pwd) test -eu
+printf grep sed awk | && done -eu cd | 'quoted text' readonly test 'quoted text'
+	readonly | 2>/dev/null | done grep |
+"$@" grep "$1" awk then readonly sed
+$(pwd) local export ${HOME} ${HOME} "$@" cd -eu readonly cd "$1" -eu --verbose
+		grep awk done sed -eu && local && export grep grep $(pwd)
+	"$@" 'quoted text' cd --verbose 'quoted text' /usr/bin
+		2>/dev/null readonly "$@" test $(pwd) export printf cd cd awk $(pwd) then cd /usr/bin
+'quoted text' export -eu export /usr/bin x=1 'quoted text' test
+"$1" grep 'quoted text' awk test ${HOME} printf /usr/bin x=1 test echo
+	'quoted text' awk printf export x=1 local then -eu sed "$@" 2>/dev/null
+export local -eu | local grep
+	${HOME} x=1 && echo 2>/dev/null echo done done ${HOME} $(pwd) $(pwd) 2>/dev/null
+	"$@" then "$@" x=1 awk echo | printf /usr/bin $(pwd)
+		--verbose --verbose /usr/bin cd awk | grep grep x=1 --verbose done local "$1"
+		printf x=1 ${HOME} && then "$1" then | && x=1 awk grep -eu "$1" "$@"
+2>/dev/null echo cd "$@" ${HOME} then "$@" awk
+		test export printf $(pwd) 'quoted text'
+-eu export --verbose echo cd grep done
+	$(pwd) x=1 then ${HOME} | 'quoted text' | export
+2>/dev/null awk echo 2>/dev/null /usr/bin grep && local 'quoted text' x=1
+	| --verbose /usr/bin readonly --verbose
+		| then /usr/bin -eu && local
+		sed /usr/bin x=1 local done awk
+readonly then -eu && local --verbose ${HOME}
+		| "$1" done && $(pwd) local test cd awk grep && awk ${HOME}
+		then 'quoted text' done done --verbose local $(pwd) test
+	/usr/bin local echo && printf
+done cd 'quoted text' && readonly test then readonly then readonly
+		-eu cd export sed -eu grep 2>/dev/null
+	echo test "$@" ${HOME} 2>/dev/null
+		echo ${HOME} sed printf "$1" "$1" sed local | | ${HOME}
+	readonly 'quoted text'
+		$(pwd) /usr/bin $(pwd) x=1 test -eu $(pwd) echo sed grep then && "$1"
+grep done | cd $(pwd) sed -eu
+sed -eu cd cd 2>/dev/null test | readonly "$1" | echo echo $(pwd)
+--verbose "$@" printf test 'quoted text' -eu done 2>/dev/null "$1" "$@" readonly
+	${HOME} && && done 'quoted text' --verbose
+	local export printf && awk grep grep 2>/dev/null export
+readonly && export awk ${HOME} 'quoted text' 2>/dev/null
+"$@" grep x=1 | | /usr/bin awk | "$@" sed ${HOME} 2>/dev/null export cd echo
+		echo 'quoted text' | /usr/bin 2>/dev/null x=1 echo readonly x=1 $(pwd) grep
+		&& sed printf $(pwd) cd then readonly
+-eu /usr/bin x=1 x=1 &&
+${HOME} awk | 'quoted text' printf done x=1 sed && 2>/dev/null printf
+"$@" cd "$1" local done --verbose printf --verbose
+${HOME} -eu 2>/dev/null 'quoted text'
+	readonly x=1 "$1" grep && ${HOME} /usr/bin | 'quoted text'
+	-eu then | then readonly readonly local
+	local 'quoted text' sed -eu "$@"
+	'quoted text' "$@" "$@" 'quoted text' 'quoted text' 'quoted text'
+	export cd "$1" local 'quoted text' "$1" grep readonly printf "$@" done printf
+	awk readonly sed "$1" grep ${HOME}
+	grep export -eu echo -eu done sed 'quoted text' 2>/dev/null
+		done export readonly "$@" x=1 /usr/bin done $(pwd)
+	awk 'quoted text' echo then 2>/dev/null readonly grep then
+${HOME} x=1 printf | printf 'quoted text' --verbose -eu "$@"
+	test -eu $(pwd) then "$@" printf printf &&
+$(pwd) x=1 ${HOME} grep x=1 "$1" done then cd 'quoted text'
+	local done 'quoted text' done
+awk $(pwd) export done && grep |
+	&& | $(pwd) --verbose done x=1 2>/dev/null done 'quoted text' then readonly
+	printf /usr/bin 'quoted text' awk test 2>/dev/null 'quoted text'
+		/usr/bin then sed && /usr/bin /usr/bin
+		readonly test /usr/bin sed awk sed "$1" local "$@" $(pwd)
+		| x=1 then export local | -eu done
+cd export then 2>/dev/null 2>/dev/null readonly printf --verbose then 'quoted text'
+		cd test sed 2>/dev/null "$@" /usr/bin 'quoted text' "$@"
+		"$@" 'quoted text' "$@" sed then ${HOME} -eu test && ${HOME} 2>/dev/null
+		export sed 'quoted text' && 'quoted text' /usr/bin ${HOME} export readonly export
+		test export "$1" test "$@" cd
+	then printf "$@" local "$@" then readonly done "$1"
+	/usr/bin readonly /usr/bin &&
+	awk --verbose awk && awk then
+printf sed local test --verbose done
+		$(pwd) x=1 -eu /usr/bin
+	done | /usr/bin 'quoted text'
+echo 'quoted text' --verbose --verbose --verbose
+--verbose readonly -eu
+		&& sed grep readonly sed done && echo cd printf test then done echo
+		then test echo "$@" awk cd export awk grep 'quoted text' readonly
+		-eu "$@" ${HOME} /usr/bin grep cd && sed test -eu
+x=1 $(pwd) x=1 2>/dev/null then
+		$(pwd) grep $(pwd) awk export
+	echo sed then export x=1 ${HOME}
+done x=1 grep then done echo sed printf ${HOME}
+&& then -eu then -eu readonly
+		export printf x=1 echo --verbose awk 2>/dev/null ${HOME} awk "$1"
+sed --verbose /usr/bin then done awk then /usr/bin ${HOME} sed export --verbose
+"$@" x=1 echo | test export local export export $(pwd) sed done grep -eu cd "$1"
+	x=1 x=1 done grep test
+	2>/dev/null awk cd done test readonly then "$@"
+| done then cd then | 'quoted text'
+${HOME} cd export /usr/bin test done
+	done x=1 -eu $(pwd) local printf local printf ${HOME} awk $(pwd) 'quoted text'
+	then printf then cd echo --verbose printf x=1 export
+	'quoted text' | "$1" x=1 /usr/bin export cd -eu
+		"$1" "$1" 'quoted text' "$@" | test | grep
+then test echo x=1 "$1" "$@" 2>/dev/null test
+	export "$1" /usr/bin awk awk 2>/dev/null export test
+		echo done "$1" printf
+	-eu --verbose awk -eu $(pwd) echo --verbose export 'quoted text'
+export && readonly echo x=1 export test
+done cd sed sed cd "$@" "$@" export "$@" $(pwd) 'quoted text' x=1 done
+		"$1" cd awk "$@" done ${HOME} "$@" x=1
+$(pwd) test sed ${HOME} x=1
+		'quoted text' cd local | x=1 "$@"
+		cd ${HOME} test /usr/bin -eu readonly 2>/dev/null "$@" local && readonly
+		grep && -eu cd | x=1 local then /usr/bin --verbose sed
+		readonly sed --verbose readonly
+echo awk export awk grep awk /usr/bin | test printf
+		x=1 -eu readonly then export
+'quoted text' | echo readonly
+then 2>/dev/null echo | then "$1" "$1" 'quoted text' cd export then
+	$(pwd) cd 2>/dev/null done grep -eu done local then readonly sed export
+2>/dev/null -eu sed && readonly "$1" --verbose --verbose
+	"$1" 'quoted text' cd -eu 'quoted text'
+	local echo local done $(pwd) /usr/bin printf 2>/dev/null
+		"$@" 2>/dev/null ${HOME} echo x=1 ${HOME} grep 2>/dev/null $(pwd) /usr/bin
+	/usr/bin "$1" grep test then --verbose
+-eu 2>/dev/null cd export echo printf done --verbose 2>/dev/null
+'quoted text' -eu /usr/bin --verbose test
+		awk && && && --verbose readonly
+		/usr/bin awk printf 2>/dev/null
+		grep ${HOME} /usr/bin "$1" /usr/bin ${HOME} && --verbose --verbose
+	&& 2>/dev/null 2>/dev/null | test 2>/dev/null ${HOME}
+awk local --verbose "$1" -eu
+2>/dev/null "$@" then x=1 "$1" --verbose "$1" sed x=1 grep
+	done test $(pwd) 'quoted text'
+x=1 -eu /usr/bin echo printf
+		readonly --verbose 'quoted text' cd local cd export
+		${HOME} x=1 readonly "$1" x=1 readonly -eu printf done x=1 readonly
+	${HOME} export export then
+test x=1 -eu "$1" -eu -eu --verbose
+awk readonly awk sed echo test && local &&
+	$(pwd) cd export --verbose 'quoted text' awk
+${HOME} && "$@" local sed /usr/bin then awk ${HOME} export 'quoted text'
+printf export test readonly
+	readonly grep test printf printf x=1 readonly local /usr/bin cd x=1 ${HOME}
+	--verbose printf then cd && x=1 $(pwd) "$@" echo sed export sed cd export
+		x=1 readonly printf --verbose ${HOME} "$1" ${HOME} "$@" cd "$@" readonly
+sed | $(pwd) $(pwd) done echo ${HOME} | cd then
+local echo echo echo | test readonly echo
+	cd sed then "$1" ${HOME} && printf local ${HOME} cd && sed echo --verbose
+		2>/dev/null | test sed export x=1 readonly
+		$(pwd) 'quoted text' "$1" then "$1" test local $(pwd) grep 2>/dev/null "$1"
+${HOME} grep 2>/dev/null done sed
+		/usr/bin "$@" grep && /usr/bin
+2>/dev/null sed test done export printf echo sed /usr/bin
+	"$@" ${HOME} ${HOME} && "$@" "$@" $(pwd) -eu /usr/bin
+export test local "$@" test
+	then printf "$@" --verbose 2>/dev/null export
+		awk then test then x=1 "$@" && test echo test sed echo /usr/bin echo
+printf grep test done "$@"
+-eu "$1" 2>/dev/null x=1 echo then grep 2>/dev/null
+		grep --verbose test --verbose done $(pwd) sed --verbose
+		| readonly cd sed --verbose ${HOME} | then test /usr/bin awk
+-eu "$1" | done echo
+&& done --verbose 'quoted text' sed
+		${HOME} printf awk "$@" ${HOME} grep readonly --verbose x=1 &&
+	cd -eu "$1" --verbose && --verbose | 2>/dev/null
+		&& sed $(pwd) local test "$1" --verbose done local "$1" 2>/dev/null then awk
+		done local "$1" done test grep 2>/dev/null x=1 cd "$@" "$1"
+	x=1 $(pwd) 'quoted text' 2>/dev/null awk "$1" done cd "$@" /usr/bin
+		"$@" readonly test | export done cd ${HOME} x=1 "$1" $(pwd) test export awk | printf
+	"$1" echo sed && --verbose | cd
+		sed grep done /usr/bin test
+local 2>/dev/null cd 2>/dev/null | | "$1" && /usr/bin x=1
+		&& 2>/dev/null 2>/dev/null | printf grep readonly sed /usr/bin echo $(pwd) "$@"
+		"$@" "$@" then cd done local x=1 | | && then export readonly 'quoted text'
+	done --verbose test | then | $(pwd) done local
+local && sed readonly export
+cd && /usr/bin 'quoted text' --verbose
+echo | awk grep grep $(pwd) "$1" --verbose local
+		| then printf awk x=1 then readonly grep "$@" /usr/bin "$1" export done "$@"
+2>/dev/null "$@" && test cd done --verbose cd done | $(pwd) "$@" done awk "$@"
+	$(pwd) ${HOME} --verbose printf grep $(pwd) local && grep
+	echo printf sed $(pwd) $(pwd)
+-eu "$@" -eu && grep && printf --verbose awk done echo $(pwd) -eu done -eu
+"$@" echo 'quoted text' export 2>/dev/null done
+		done | && readonly test cd printf 2>/dev/null cd grep $(pwd)
+grep "$1" /usr/bin ${HOME} | echo printf awk
+		done export && 'quoted text' 'quoted text' cd done awk
+		${HOME} local test "$1" test cd "$1" done ${HOME} "$@"
+	awk "$1" readonly then printf
+		x=1 awk "$1" | --verbose export
+		done sed $(pwd) "$1" sed printf 2>/dev/null -eu echo then sed export
+		$(pwd) local | -eu done /usr/bin
+$(pwd) awk local then local local export local "$1" done | $(pwd)
+		local done echo cd printf 2>/dev/null echo
+		cd -eu && $(pwd) --verbose export test &&
+	-eu echo local "$1" sed x=1 x=1 x=1 'quoted text'
+		| 'quoted text' echo "$1"
+	export printf then ${HOME} grep cd --verbose test && grep export readonly
+	printf "$@" export && 2>/dev/null
+		| grep test cd 'quoted text'
+/usr/bin readonly x=1 x=1 sed export
+		local --verbose ${HOME} cd echo
+	printf -eu -eu sed readonly cd &&
+$(pwd) "$@" "$1" local && readonly readonly
+awk export --verbose /usr/bin export
+		'quoted text' awk 2>/dev/null 2>/dev/null sed -eu /usr/bin test | 2>/dev/null
+done echo export awk 2>/dev/null export printf 'quoted text' "$1" echo --verbose
+		-eu x=1 done then 'quoted text' && readonly $(pwd) "$1" readonly
+grep awk $(pwd) /usr/bin x=1 $(pwd) 'quoted text'
+		then "$@" && 'quoted text' 'quoted text' 'quoted text' grep /usr/bin test
+		cd -eu && cd sed /usr/bin 2>/dev/null -eu readonly | echo $(pwd) && "$@"
+"$1" "$1" "$1" 2>/dev/null -eu 'quoted text' local x=1
+test awk sed sed awk export $(pwd) x=1 "$@" 'quoted text'
+		printf | sed ${HOME} 2>/dev/null
+	then $(pwd) /usr/bin "$1" grep sed test && local x=1 sed local 'quoted text' sed
+	"$@" sed "$@" $(pwd) | done readonly grep
+	| $(pwd) 'quoted text' done "$@" printf "$@" "$1"
+		done local "$1" --verbose test echo printf ${HOME} $(pwd)
+export -eu done "$1" sed 2>/dev/null test awk echo
+	| "$1" printf echo export "$1" ${HOME} 2>/dev/null local $(pwd) export
+		'quoted text' ${HOME} printf cd $(pwd) readonly done
+test /usr/bin grep -eu test echo
+-eu done "$1" readonly /usr/bin export local grep "$@"
+	x=1 awk printf done awk ${HOME} "$1" cd local printf
+x=1 local awk echo readonly export export local -eu && then x=1 $(pwd) 2>/dev/null
+	--verbose "$@" -eu test 2>/dev/null readonly printf "$@" | printf local
+	cd local /usr/bin done /usr/bin done
+		awk done -eu 'quoted text'
+/usr/bin /usr/bin --verbose "$1" | x=1 echo printf --verbose $(pwd)
+		--verbose readonly -eu
+-eu export "$1" && awk then --verbose 2>/dev/null $(pwd) ${HOME}
+	local local --verbose then then cd x=1 ${HOME} cd $(pwd) then done local export
+awk printf sed /usr/bin cd | -eu readonly
+	-eu printf --verbose -eu grep printf "$1" "$1" echo grep -eu 2>/dev/null
+readonly "$1" printf && /usr/bin awk "$@" awk
+		| printf "$1" $(pwd) then awk awk "$1"
+	2>/dev/null readonly cd | --verbose then printf export sed sed
+sed readonly echo ${HOME} local && 'quoted text'
+readonly && | sed echo x=1 2>/dev/null
+done test 'quoted text'
+	2>/dev/null --verbose /usr/bin "$1" export local readonly && "$@" ${HOME}
+x=1 grep --verbose 'quoted text' printf test grep sed "$1" sed
+		readonly -eu cd local 2>/dev/null
+	sed readonly awk x=1 $(pwd) readonly x=1 echo --verbose then
+	test -eu /usr/bin export printf x=1 x=1 ${HOME} awk
+	/usr/bin 'quoted text' export "$1" printf grep | done cd x=1 sed
+		export "$1" /usr/bin sed done test echo /usr/bin sed && ${HOME} 2>/dev/null local
+	local | "$1" printf export then 'quoted text' | --verbose
+	done sed done test 2>/dev/null | done then
+-eu local awk x=1 && export done ${HOME}
+	$(pwd) echo -eu export cd -eu 'quoted text'
+2>/dev/null then ${HOME} sed -eu test export ${HOME} awk "$@" done
+		echo $(pwd) test 'quoted text' cd awk printf export
+sed done then "$1" "$1" && then readonly
+		--verbose cd test | done local 'quoted text' local x=1
+		echo "$1" "$1" ${HOME} "$1" then export "$@" 'quoted text' -eu "$1" --verbose /usr/bin
+	&& sed echo 'quoted text' -eu 2>/dev/null "$@" printf local done 'quoted text'
+readonly 2>/dev/null && test 'quoted text' echo -eu test | | --verbose -eu &&
+	echo "$1" test x=1 grep
+		$(pwd) local test 2>/dev/null awk | test cd ${HOME} awk | then "$@"
+--verbose /usr/bin printf | 'quoted text'
+awk --verbose sed echo echo echo
+	sed -eu --verbose sed "$@" $(pwd) sed echo
+-eu awk "$1" echo x=1 "$@" export 'quoted text'
+		test done "$1" "$@" $(pwd) "$1" ${HOME} "$@" x=1 local printf
+then -eu x=1 "$@" local -eu --verbose printf sed --verbose then done test export
+		grep readonly done awk | 2>/dev/null "$1" sed
+		readonly && readonly --verbose printf printf $(pwd)
+"$@" local local sed readonly test awk echo cd ${HOME} done 'quoted text'
+printf /usr/bin awk readonly
+		&& "$@" "$@" grep readonly
+		awk done then printf readonly /usr/bin grep export echo
+	printf ${HOME} cd | readonly $(pwd) |
+	--verbose export "$@" /usr/bin export printf
+awk cd grep export test readonly test awk && $(pwd)
+echo $(pwd) && echo sed "$1" -eu ${HOME} $(pwd) --verbose test 2>/dev/null awk printf
+		-eu 2>/dev/null grep 2>/dev/null done then done done cd x=1 x=1 cd test
+	export --verbose x=1 x=1 && | --verbose --verbose $(pwd)
+$(pwd) ${HOME} "$@" test ${HOME} printf echo
+	"$1" && local "$@" local 'quoted text' sed "$1" && 2>/dev/null
+grep done /usr/bin x=1 test 2>/dev/null ${HOME} $(pwd)
+	grep local && printf "$@" grep --verbose
+		/usr/bin printf readonly cd echo && -eu /usr/bin local x=1 awk then
+	test && | echo --verbose x=1 ${HOME} /usr/bin local
+	test | then | -eu echo cd 2>/dev/null cd export printf
+	| 2>/dev/null 'quoted text' sed --verbose done && x=1 printf export
+	readonly cd /usr/bin cd done then export test awk -eu 2>/dev/null
+		echo $(pwd) echo $(pwd) x=1 printf $(pwd) readonly && $(pwd) export
+| cd done local printf /usr/bin -eu grep
+grep x=1 --verbose echo "$1" && x=1 then "$@"
+	"$@" cd "$1" grep "$@" grep grep
+test /usr/bin cd x=1 readonly
+	sed export readonly done "$@" 'quoted text' awk local
+readonly -eu -eu /usr/bin awk | printf -eu cd
+	then -eu echo && "$@" test && $(pwd) && /usr/bin
+		then | && /usr/bin echo
+	local done && "$@" readonly /usr/bin --verbose && local printf
+	sed cd | done local echo "$@" --verbose 2>/dev/null export $(pwd)
+	$(pwd) "$1" $(pwd) done then readonly sed local
+2>/dev/null $(pwd) awk /usr/bin echo "$1" readonly --verbose
+	$(pwd) then cd | export export --verbose -eu test -eu && "$1" 'quoted text'
+		done done "$@" -eu "$@" 2>/dev/null $(pwd) ${HOME}
+		${HOME} echo "$1" awk export /usr/bin
+	&& sed local readonly ${HOME} cd sed && echo echo && 'quoted text' then
+	$(pwd) "$@" -eu local /usr/bin $(pwd) ${HOME} /usr/bin 2>/dev/null
+	"$@" ${HOME} echo x=1 grep awk -eu -eu grep 'quoted text' sed && x=1 &&
+	--verbose ${HOME} 2>/dev/null grep readonly --verbose
+		x=1 --verbose then | local 'quoted text'
+		x=1 local --verbose test 2>/dev/null then 'quoted text'
+"$@" local /usr/bin --verbose 'quoted text' test grep 2>/dev/null echo sed echo
+		export test x=1 ${HOME} sed | awk $(pwd) grep 2>/dev/null "$1" "$1" cd
+		awk 2>/dev/null export readonly "$@" ${HOME}
+		then | cd --verbose test then printf done then
+	$(pwd) test local test | ${HOME} 2>/dev/null 'quoted text'
+sed cd "$@" && /usr/bin ${HOME} 'quoted text' "$@" 'quoted text' awk x=1 echo
+"$@" "$@" awk --verbose && awk awk done 2>/dev/null /usr/bin grep $(pwd)
+	cd "$@" x=1 readonly $(pwd) -eu export test 'quoted text' then cd --verbose
+		"$@" grep echo x=1 "$@" done $(pwd) done
+		${HOME} "$1" printf "$@"
+		test && readonly $(pwd) "$1" $(pwd) "$@" x=1 "$1" | cd | --verbose done
+	2>/dev/null done | local local | | export 'quoted text' ${HOME} sed && "$@"
+	-eu /usr/bin ${HOME} echo | export ${HOME} /usr/bin
+export "$@" readonly "$1" done --verbose "$1" 'quoted text'
+		&& ${HOME} "$1" "$1" awk "$1" ${HOME}
+	"$@" x=1 grep echo --verbose
+		/usr/bin && awk "$@" /usr/bin --verbose --verbose echo then 2>/dev/null "$1" test
+		2>/dev/null done --verbose -eu "$@" 2>/dev/null $(pwd)
+		awk then then $(pwd) 'quoted text' grep awk "$1" ${HOME} awk "$1" test $(pwd)
+export ${HOME} 2>/dev/null
+		echo cd x=1 -eu done --verbose local /usr/bin x=1 sed ${HOME} local
+'quoted text' export test x=1 test ${HOME} "$@"
+&& cd | awk readonly cd 2>/dev/null 2>/dev/null
+		2>/dev/null "$@" "$@" then export --verbose &&
+		local readonly sed readonly
+	| x=1 awk test | cd "$1" printf ${HOME} && grep -eu ${HOME} echo --verbose
+test && "$1" $(pwd) test
+	"$1" local "$@" 'quoted text'
+		"$1" sed 2>/dev/null -eu 'quoted text' 'quoted text'
+		${HOME} grep /usr/bin export test 'quoted text' | | | export local
+2>/dev/null $(pwd) sed | sed awk 'quoted text'
+| 'quoted text' test $(pwd) local --verbose readonly
+	"$1" $(pwd) cd /usr/bin -eu | 2>/dev/null "$1"
+		sed readonly test "$1" 'quoted text' test test readonly
+	$(pwd) echo $(pwd) awk echo "$1" 2>/dev/null
+		local /usr/bin grep "$@" local x=1 && echo local ${HOME}
+x=1 "$@" cd printf printf test
+cd --verbose 2>/dev/null
+		2>/dev/null x=1 $(pwd) ${HOME}
+2>/dev/null readonly $(pwd) done /usr/bin $(pwd)
+	then "$@" grep then "$@" --verbose cd echo grep printf | echo local sed
+then test -eu $(pwd) --verbose
+	'quoted text' test 'quoted text' &&
+"$@" --verbose sed done awk x=1 2>/dev/null 'quoted text' "$@"
+grep /usr/bin awk echo then then readonly $(pwd)
+| done sed x=1 cd test | x=1 -eu readonly then | cd /usr/bin --verbose sed
+		local echo "$1" "$1" ${HOME} "$@" cd -eu | export export done 'quoted text'
+test /usr/bin --verbose && "$1" | cd --verbose
+'quoted text' "$1" 'quoted text' --verbose
+	printf grep cd test x=1 ${HOME} readonly 2>/dev/null "$1"
+awk sed readonly local | local -eu cd -eu readonly awk --verbose done 2>/dev/null
+		/usr/bin | echo local ${HOME} local export $(pwd) | 2>/dev/null
+local done echo "$@" $(pwd) 'quoted text' | -eu then done then && printf x=1
+	grep cd ${HOME} awk "$@" echo && $(pwd) sed --verbose then x=1
+then ${HOME} "$@" grep test echo printf
+		&& "$1" -eu "$1" grep printf
+$(pwd) sed awk export export 'quoted text' "$@" sed echo printf export ${HOME}
+	done && "$1" $(pwd) echo
+2>/dev/null $(pwd) $(pwd)
+'quoted text' x=1 "$1" cd cd done printf ${HOME} grep grep x=1 grep "$1"
+	x=1 grep 'quoted text' -eu export 2>/dev/null done && grep && -eu done
+	test 'quoted text' "$@" && "$1" echo && "$@" && "$@" 'quoted text'
+${HOME} readonly "$@" done && | 'quoted text' sed 2>/dev/null
+--verbose "$1" echo printf
+		$(pwd) --verbose echo /usr/bin
+grep "$@" grep readonly printf sed printf ${HOME}
+	done printf -eu done | done sed echo sed cd sed -eu
+		$(pwd) 'quoted text' $(pwd) "$1" "$1" -eu sed test awk $(pwd) "$1" /usr/bin awk
+${HOME} 'quoted text' 2>/dev/null ${HOME}
+		-eu done test test echo x=1 export -eu 2>/dev/null done /usr/bin --verbose
+	local done done echo | 2>/dev/null cd | then cd echo /usr/bin /usr/bin grep
+		local /usr/bin "$1" /usr/bin awk readonly test
+	'quoted text' "$@" cd grep then awk | "$@" "$1" -eu "$1" | echo then -eu test
+		then sed cd done "$@" | --verbose done readonly
+	export done test && sed readonly export
+--verbose test local readonly 2>/dev/null
+		test "$1" /usr/bin /usr/bin test ${HOME} |
+		&& --verbose awk awk "$@"
+&& -eu printf -eu echo | "$@" x=1 /usr/bin
+readonly 2>/dev/null export | 'quoted text' export "$1" /usr/bin
+		sed "$@" --verbose export then 'quoted text' | -eu then done
+"$1" local ${HOME} $(pwd) 'quoted text'
+		sed 2>/dev/null cd 'quoted text' /usr/bin x=1 grep sed readonly
+	then test echo $(pwd) sed ${HOME} grep x=1 2>/dev/null "$@" "$1" &&
+	"$@" /usr/bin -eu --verbose echo readonly test && $(pwd) then
+		then echo done /usr/bin awk readonly then grep x=1 printf "$@"
+readonly export /usr/bin -eu && --verbose echo --verbose
+printf "$1" cd export local "$1" grep done grep | test ${HOME}
+	local test sed --verbose "$@" then echo export ${HOME} local ${HOME} -eu
+		then local --verbose awk $(pwd) printf echo | &&
+		2>/dev/null test cd echo "$1" printf test | printf ${HOME} sed ${HOME} | "$1"
+		awk export -eu printf cd printf | sed 2>/dev/null x=1 awk
+/usr/bin "$@" && 2>/dev/null | /usr/bin ${HOME} -eu 2>/dev/null "$1" readonly
+'quoted text' ${HOME} then 'quoted text' export awk ${HOME} ${HOME} done
+done awk && --verbose ${HOME} ${HOME}
+		readonly | | $(pwd) "$@" && echo grep -eu x=1
+	/usr/bin ${HOME} | then "$@" x=1
+		done /usr/bin x=1 done echo -eu test
+		x=1 grep 'quoted text' ${HOME} && echo ${HOME} --verbose | 'quoted text'
+	cd -eu x=1 && cd $(pwd) "$@" echo cd grep 2>/dev/null
+		'quoted text' awk $(pwd) 2>/dev/null cd printf echo cd done cd
+local && | x=1 2>/dev/null export -eu --verbose $(pwd) /usr/bin 'quoted text'
+	awk x=1 test sed ${HOME}
+--verbose && awk ${HOME} "$1" /usr/bin && && test $(pwd) --verbose export /usr/bin
+		printf echo done --verbose sed | printf
+		$(pwd) $(pwd) /usr/bin cd -eu && ${HOME} test local --verbose -eu --verbose "$@"
+	echo readonly ${HOME} done "$@"
+printf grep "$1" 2>/dev/null x=1 echo awk /usr/bin
+done awk grep test "$1" -eu "$1" test
+		sed echo sed 'quoted text' cd export then awk printf 'quoted text'
+then "$@" "$1" 2>/dev/null x=1 'quoted text'
+		readonly test /usr/bin && "$1" "$@" && export "$1" echo
+	2>/dev/null x=1 awk 'quoted text' echo echo then awk awk -eu done && grep done
+	local && 2>/dev/null --verbose awk | test --verbose printf
+	&& echo "$1" sed 'quoted text'
+&& ${HOME} echo -eu readonly local then export
+${HOME} readonly done
+		"$@" sed local test grep "$@" echo readonly
+	&& printf 2>/dev/null x=1 x=1 grep sed 2>/dev/null
+&& -eu sed x=1 then done export test printf ${HOME} then
+	-eu test -eu 'quoted text' sed export grep test /usr/bin ${HOME}
+		/usr/bin done echo awk sed grep done | x=1 grep -eu | | ${HOME}
+-eu 2>/dev/null --verbose readonly | --verbose
+		2>/dev/null /usr/bin printf awk 2>/dev/null 'quoted text' ${HOME}
+		echo then sed sed sed test "$@"
+cd echo 2>/dev/null local test printf
+		"$1" 2>/dev/null x=1 "$@" | 'quoted text' test grep x=1 "$@" printf
+${HOME} done printf awk /usr/bin done readonly 'quoted text'
+		printf ${HOME} echo echo readonly ${HOME} echo
+printf sed --verbose printf /usr/bin ${HOME} x=1 "$1" grep ${HOME} -eu x=1 echo
+	${HOME} cd sed | then && "$@" printf --verbose
+"$@" | x=1 readonly /usr/bin /usr/bin "$@" /usr/bin 'quoted text' 'quoted text'
+	printf echo 2>/dev/null && test test 2>/dev/null export
+readonly 'quoted text'
+		/usr/bin echo x=1 done echo 'quoted text' printf echo readonly
+		$(pwd) then then readonly local 2>/dev/null then done done x=1 ${HOME} done
+	echo export then sed test export export | 'quoted text'
+	test x=1 cd -eu | sed grep sed awk x=1 local /usr/bin | "$@" test
+/usr/bin && 'quoted text' done
+		&& && test test $(pwd) grep awk &&
+-eu sed -eu 'quoted text'
+&& echo | "$1" export ${HOME} export 'quoted text'
+then | 2>/dev/null printf
+awk local local ${HOME} local then x=1 readonly | done
+"$1" local local -eu sed && ${HOME} awk -eu 2>/dev/null grep | --verbose
+		-eu && local ${HOME} sed local -eu printf done test export x=1 | printf test
+		awk x=1 awk $(pwd) awk then
+	"$@" cd && "$@" && $(pwd) echo awk ${HOME} -eu local && "$@" export
+| ${HOME} test local 'quoted text' -eu && echo test
+		2>/dev/null -eu cd 2>/dev/null
+		${HOME} test /usr/bin local grep "$1" x=1 sed /usr/bin $(pwd) /usr/bin
+		local && 2>/dev/null "$@" $(pwd) | grep export done x=1 $(pwd)
+export "$@" test && /usr/bin awk echo awk test
+		export local 'quoted text'
+	${HOME} cd -eu test then | local -eu /usr/bin test cd grep sed "$@" /usr/bin
+	| local /usr/bin cd 2>/dev/null
+"$@" local -eu cd local | test --verbose | readonly x=1 "$1" --verbose
+		"$@" 2>/dev/null awk local readonly
+printf awk echo 2>/dev/null export "$1" printf grep --verbose x=1 readonly cd $(pwd)
+"$@" 2>/dev/null export echo 'quoted text'
+		cd done --verbose x=1 printf && grep
+readonly done test | /usr/bin grep && test grep done
+	done | && done 'quoted text' | printf printf test printf then
+		done $(pwd) printf printf --verbose && | $(pwd) cd then printf
+	printf -eu printf 'quoted text' test done "$1" ${HOME}
+		local export x=1 done then "$@" cd test x=1 awk
+		| awk readonly grep "$@" local export ${HOME} 2>/dev/null ${HOME} --verbose ${HOME}
+	$(pwd) 2>/dev/null printf local test -eu |
+${HOME} cd printf export done $(pwd) export /usr/bin cd awk |
+		"$@" echo -eu ${HOME} awk 'quoted text' done export && done done then $(pwd)
+	export then cd cd local local readonly
+grep $(pwd) -eu then readonly readonly grep printf 2>/dev/null test
+		echo 2>/dev/null /usr/bin then grep
+		"$1" readonly printf 'quoted text' --verbose cd readonly sed x=1 sed -eu done
+	"$@" "$@" then done export | ${HOME} 'quoted text' --verbose "$@"
+	-eu export local readonly x=1 export export
+	readonly $(pwd) "$1" -eu echo x=1 cd &&
+/usr/bin cd -eu 'quoted text' | export "$1" ${HOME} echo readonly 2>/dev/null
+${HOME} -eu echo x=1 ${HOME} x=1 done cd --verbose
+${HOME} -eu 'quoted text' done readonly "$@" --verbose local echo sed
+"$@" readonly $(pwd) done
+&& export awk local grep x=1 /usr/bin printf done | awk readonly --verbose $(pwd)
+	-eu | readonly "$1" printf -eu test cd printf | local
+	readonly echo ${HOME} echo ${HOME} export awk
+'quoted text' then "$@" --verbose
+		readonly && done grep then "$@" sed -eu grep
+	2>/dev/null echo awk --verbose then then grep $(pwd) echo -eu && export
+		done 'quoted text' | /usr/bin export | ${HOME} | --verbose export /usr/bin -eu
+	export then "$1" local test export 'quoted text' done awk done ${HOME} ${HOME}
+		"$1" export && done readonly ${HOME}
+done cd && | test echo "$1" local | done done cd $(pwd) 2>/dev/null
+export 2>/dev/null /usr/bin echo ${HOME} cd done printf
+x=1 "$@" export /usr/bin
+	'quoted text' ${HOME} "$1" 2>/dev/null "$1" test x=1 test
+	$(pwd) export 2>/dev/null --verbose then grep sed $(pwd) && done readonly
+		-eu x=1 -eu grep /usr/bin local -eu && sed ${HOME}
+	-eu done grep | printf $(pwd) 2>/dev/null
+		test test "$1" cd --verbose
+done done && test awk | $(pwd) sed --verbose
+	done 2>/dev/null cd -eu $(pwd) /usr/bin ${HOME}
+		${HOME} ${HOME} then $(pwd) ${HOME} && cd local --verbose cd printf
+"$@" done "$@" 'quoted text' x=1 | "$@" test done awk "$1" sed
+		&& test done "$1" 2>/dev/null ${HOME} echo awk -eu 'quoted text'
+	${HOME} -eu done ${HOME} -eu echo cd awk echo readonly
+		-eu done echo awk && grep --verbose readonly export done echo 2>/dev/null x=1 --verbose
+grep printf awk /usr/bin echo "$@" grep | cd "$1" echo x=1 export
+		cd local done && export "$@" test cd then $(pwd) local
+	| 'quoted text' 'quoted text' cd then test "$@" cd test export x=1 grep grep
+	2>/dev/null -eu 'quoted text' ${HOME} x=1 "$@" test readonly |
+2>/dev/null echo grep x=1 done readonly "$@" test readonly
+		x=1 export local cd readonly readonly
+		'quoted text' -eu sed echo --verbose -eu "$1" awk
+local printf --verbose sed printf /usr/bin sed echo 2>/dev/null
+--verbose x=1 'quoted text' done 2>/dev/null && ${HOME}
+		sed echo grep readonly sed cd && echo && echo /usr/bin 'quoted text'
+	awk $(pwd) $(pwd) export "$1" readonly readonly /usr/bin
+x=1 x=1 sed grep "$@" x=1
+		--verbose $(pwd) && 2>/dev/null printf done $(pwd) && x=1 ${HOME} | echo /usr/bin
+	| | cd local cd awk && "$1" "$1" 'quoted text'
+'quoted text' ${HOME} $(pwd) && /usr/bin export |
+	then awk awk "$1" grep ${HOME} && echo grep /usr/bin awk readonly x=1 test x=1
+		echo x=1 then "$1" 'quoted text' then && -eu export 2>/dev/null "$@" cd && grep
+	-eu awk done "$1" export $(pwd) grep
+x=1 readonly $(pwd) | done sed echo 'quoted text' printf | -eu 'quoted text' printf
+	| then printf $(pwd) export x=1
+	'quoted text' $(pwd) $(pwd)
+	${HOME} test done && cd -eu | x=1 done x=1 sed then &&
+'quoted text' /usr/bin printf local x=1 && --verbose
+then && then cd x=1 local
+		-eu "$@" awk 2>/dev/null | echo awk x=1 -eu -eu /usr/bin
+		--verbose export then cd sed $(pwd) sed sed readonly test echo
+'quoted text' then x=1 "$@" echo done awk 2>/dev/null done readonly local 2>/dev/null
+		printf | then sed readonly && | cd "$@" && export cd sed test $(pwd)
+	then readonly | awk test grep && done echo awk -eu local grep grep 'quoted text'
+	cd 'quoted text' ${HOME} cd /usr/bin readonly --verbose && cd awk echo 2>/dev/null
+	-eu then | echo awk done test /usr/bin
+		export sed sed $(pwd) | readonly
+		&& "$@" x=1 /usr/bin $(pwd) 2>/dev/null then done /usr/bin ${HOME}
+	awk printf grep echo $(pwd) grep awk --verbose
+		$(pwd) printf grep done local $(pwd) then /usr/bin --verbose -eu done
+	| x=1 ${HOME} awk done 2>/dev/null $(pwd) local done echo | "$@"
+		done -eu sed | && && grep 'quoted text'
+		done ${HOME} grep cd readonly
+		$(pwd) -eu grep $(pwd) ${HOME} cd && "$1" then cd 'quoted text'
+	local awk | cd 'quoted text' -eu
+	$(pwd) readonly printf export export --verbose readonly sed -eu
+'quoted text' local cd /usr/bin "$@"
+		local awk readonly grep grep
+printf grep && x=1 && echo
+		cd printf "$1" awk awk grep "$@" local /usr/bin
+		--verbose 2>/dev/null x=1 x=1 && | readonly ${HOME}
+	cd x=1 'quoted text' 2>/dev/null $(pwd) then printf --verbose
+	printf -eu test readonly && -eu test sed done then | --verbose
+		cd readonly "$@" sed && then x=1 awk | done
+	x=1 && grep awk ${HOME}
+	| | "$@" /usr/bin printf test 2>/dev/null cd "$1" export "$@" cd sed
+		"$1" test | "$@" "$@" sed 'quoted text' local -eu 'quoted text'
+x=1 sed /usr/bin sed cd x=1 "$1" awk test
+$(pwd) local && awk /usr/bin 'quoted text' cd --verbose grep /usr/bin
+readonly cd test readonly printf $(pwd)
+	test done done "$@" --verbose readonly 'quoted text' --verbose "$1" "$@" &&
+		/usr/bin done test --verbose
+	| printf && echo "$@" printf --verbose "$1" -eu then --verbose && 'quoted text'
+		--verbose readonly printf awk -eu /usr/bin awk /usr/bin | echo -eu awk
+	&& readonly readonly then 'quoted text'
+	-eu printf sed readonly "$1" echo echo 2>/dev/null done "$1" done ${HOME}
+--verbose ${HOME} "$1" ${HOME} $(pwd) 2>/dev/null local cd "$@" local
+| grep grep /usr/bin -eu "$1" x=1 readonly 'quoted text' ${HOME} "$1" 2>/dev/null
+		awk awk 'quoted text' $(pwd)
+		$(pwd) awk sed && test echo 2>/dev/null $(pwd) x=1 done /usr/bin ${HOME}
+	${HOME} test grep export grep done /usr/bin | awk sed echo -eu done
+		test "$1" && done && cd "$@" sed ${HOME} --verbose 2>/dev/null readonly 2>/dev/null
+	export 'quoted text' sed
+$(pwd) $(pwd) && export | 'quoted text' printf $(pwd) $(pwd) --verbose
+		x=1 readonly readonly local then readonly grep echo awk && grep -eu done done
+"$@" x=1 sed grep && 'quoted text' done
+		printf cd printf cd x=1 grep test done
+/usr/bin grep done echo cd && | export echo --verbose awk /usr/bin 2>/dev/null
+	export local done echo $(pwd) grep 2>/dev/null /usr/bin then
+-eu 'quoted text' $(pwd) 2>/dev/null
+printf | 'quoted text' 2>/dev/null
+done readonly test readonly --verbose test "$1" done
+		awk ${HOME} cd 2>/dev/null $(pwd) /usr/bin "$1" ${HOME} awk printf
+		| echo test --verbose local $(pwd) cd then --verbose grep local 'quoted text'
+local done --verbose cd --verbose printf -eu ${HOME} |
+	test export x=1 grep --verbose local /usr/bin printf readonly
+	"$1" printf "$1" grep "$@"
+		awk 'quoted text' grep done test local ${HOME} | sed printf ${HOME}
+	"$@" printf readonly $(pwd)
+done local grep 'quoted text' awk && cd | export && | -eu -eu done $(pwd) test
+"$1" sed ${HOME} ${HOME} local then awk --verbose
+readonly printf | sed x=1 then x=1 export 2>/dev/null
+		awk sed grep "$@" echo then sed "$@" /usr/bin then grep printf
+&& then 2>/dev/null readonly ${HOME} test && 2>/dev/null
+	$(pwd) $(pwd) grep cd sed done local | then ${HOME}
+	local local sed grep 'quoted text' grep "$1" $(pwd) cd test x=1 && then
+	${HOME} sed $(pwd) | /usr/bin echo -eu --verbose $(pwd) export awk --verbose cd
+		then --verbose | /usr/bin test cd && /usr/bin
+"$@" then | then cd export printf echo readonly
+		export /usr/bin awk cd then -eu "$1" 'quoted text'
+	"$@" grep $(pwd) && | /usr/bin echo --verbose
+	${HOME} "$@" grep "$@" 2>/dev/null
+		--verbose $(pwd) /usr/bin $(pwd) cd 2>/dev/null done --verbose &&
+--verbose echo then export test done && ${HOME} local echo test /usr/bin
+	test test readonly $(pwd) sed x=1 readonly echo x=1 $(pwd) /usr/bin export
+test "$@" 2>/dev/null local then done grep
+	cd export -eu --verbose 2>/dev/null
+		local grep grep "$@" echo echo 2>/dev/null
+	${HOME} export test && test 2>/dev/null "$@" ${HOME}
+		-eu /usr/bin && export done echo export local "$@"
+	-eu test then echo 2>/dev/null 'quoted text' sed sed test grep
+export done echo done sed -eu then --verbose "$@" "$@" cd echo local
+	$(pwd) sed $(pwd) ${HOME} -eu /usr/bin --verbose | /usr/bin
+done 'quoted text' grep "$@" /usr/bin cd printf 'quoted text'
+		${HOME} "$1" then 'quoted text' export
+		local 'quoted text' echo grep $(pwd) cd 2>/dev/null sed "$1"
+	echo awk /usr/bin --verbose x=1 then -eu -eu sed 2>/dev/null
+	export grep grep 'quoted text'
+		--verbose grep done echo readonly 2>/dev/null $(pwd)
+		then local sed grep | /usr/bin local "$1" x=1 ${HOME} $(pwd)
+| echo readonly readonly
+	readonly cd done readonly
+awk sed 2>/dev/null ${HOME} readonly 'quoted text'
+	${HOME} cd $(pwd) "$@" printf ${HOME} readonly grep echo ${HOME} $(pwd)
+| then ${HOME} sed 2>/dev/null cd $(pwd) sed 2>/dev/null awk 'quoted text'
+"$1" echo printf "$@" "$@" ${HOME} x=1 export -eu done --verbose
+test && done export x=1 "$@" "$@" 2>/dev/null && test sed awk export 2>/dev/null
+		grep 'quoted text' sed 'quoted text' readonly awk ${HOME} --verbose test
+		sed /usr/bin test x=1 /usr/bin 2>/dev/null
+${HOME} done 'quoted text' --verbose
+	sed readonly grep echo
+		'quoted text' && done awk 2>/dev/null $(pwd) --verbose cd -eu $(pwd) 2>/dev/null
+"$@" | 'quoted text' grep /usr/bin echo ${HOME}
+		awk 'quoted text' && local export local $(pwd) local -eu && --verbose 2>/dev/null
+cd grep --verbose | $(pwd)
+sed 'quoted text' export printf export cd
+"$@" "$@" 'quoted text' then cd | --verbose 'quoted text' then sed
+	&& "$1" echo local echo local ${HOME} && --verbose grep readonly | done cd
+--verbose 2>/dev/null grep x=1 cd export x=1 | $(pwd) export --verbose readonly
+	local sed ${HOME} | echo 2>/dev/null x=1
+$(pwd) awk x=1 x=1 && echo --verbose printf then
+		/usr/bin "$1" done export "$1" 'quoted text'
+	then grep export done grep cd --verbose x=1 --verbose test x=1 export
+		then x=1 export local grep 'quoted text' local 2>/dev/null $(pwd) /usr/bin
+	&& ${HOME} /usr/bin local
+	readonly -eu $(pwd) 2>/dev/null x=1 && grep "$@" /usr/bin ${HOME} /usr/bin
+"$@" done sed -eu | awk | test sed x=1 && sed sed local $(pwd)
+&& readonly awk export echo && awk | --verbose local local
+		--verbose done grep then local awk printf x=1 && x=1 --verbose -eu then readonly
+		then 'quoted text' /usr/bin echo
+then cd --verbose local awk
+		$(pwd) x=1 readonly grep then readonly "$1" grep "$@" readonly
+/usr/bin /usr/bin 2>/dev/null -eu printf 2>/dev/null
+	then local grep test --verbose 'quoted text' readonly done
+${HOME} local "$1" readonly ${HOME} local sed done
+	cd printf sed x=1 $(pwd) "$1" ${HOME} $(pwd) export x=1
+		printf done -eu export sed /usr/bin /usr/bin echo x=1 echo 'quoted text'
+	| then sed x=1 "$1" cd printf && export "$@" local readonly awk test "$1" grep
+		sed /usr/bin --verbose "$@" ${HOME} -eu -eu printf
+		echo echo grep x=1 grep
+test echo --verbose "$@" printf awk x=1 local
+--verbose local /usr/bin test 'quoted text' 2>/dev/null $(pwd) 'quoted text' then
+		2>/dev/null "$1" awk local 'quoted text' 'quoted text'
+	done /usr/bin then grep && $(pwd) cd --verbose then export 2>/dev/null test | done
+	awk "$1" done readonly echo grep local
+awk "$1" readonly "$1" cd x=1 | sed local then
+		"$1" cd --verbose && ${HOME} readonly export /usr/bin done && --verbose
+	/usr/bin printf "$1" test
+printf test /usr/bin | done 'quoted text'
+--verbose 'quoted text' export
+		readonly && /usr/bin done /usr/bin
+| awk sed /usr/bin then --verbose
+x=1 test readonly test then readonly
+	local "$1" sed awk done
+		"$1" echo 'quoted text'
+		&& | /usr/bin awk | readonly | --verbose "$1"
+-eu grep /usr/bin $(pwd)
+grep readonly local echo "$1" printf /usr/bin printf awk
+		"$@" $(pwd) $(pwd) echo -eu /usr/bin -eu then /usr/bin then |
+then "$@" && x=1 /usr/bin
+-eu awk awk /usr/bin "$1"
+--verbose "$@" readonly "$@" -eu ${HOME}
+	cd then 2>/dev/null readonly --verbose /usr/bin export readonly "$@" awk
+		grep 'quoted text' "$@" export "$@" x=1 then sed readonly export local export $(pwd)
+	done local --verbose "$@" x=1 done --verbose
+	sed x=1 "$@" /usr/bin done local | cd | printf readonly 'quoted text'
+export awk export /usr/bin test -eu /usr/bin "$@" $(pwd) 2>/dev/null then
+		$(pwd) -eu "$1" -eu /usr/bin
+	grep "$1" -eu "$1" | "$1" -eu "$1" --verbose local test sed --verbose "$@" awk 'quoted text'
+/usr/bin && awk test && export readonly sed && /usr/bin -eu | sed && | -eu --verbose
+		'quoted text' 'quoted text' -eu x=1
+	readonly awk && local readonly cd "$@" then grep && "$@" export sed
+		| sed readonly done /usr/bin
+/usr/bin local then --verbose --verbose -eu
+		--verbose export | done -eu echo /usr/bin
+		export local cd /usr/bin grep 'quoted text' | grep sed 2>/dev/null
+"$1" 'quoted text' $(pwd) done cd awk awk /usr/bin -eu cd "$1" x=1 /usr/bin
+		cd grep echo | then ${HOME} sed export test && | done cd "$1"
+	echo sed export $(pwd) x=1 cd sed done awk printf then
+${HOME} grep | x=1 readonly
+	"$1" echo /usr/bin x=1 -eu awk ${HOME}
+		done $(pwd) /usr/bin x=1 | $(pwd) 'quoted text' ${HOME} awk | test cd done
+test ${HOME} printf local
+	${HOME} readonly done ${HOME}
+		"$@" printf --verbose grep readonly echo grep test export
+printf printf ${HOME} echo done --verbose 'quoted text'
+	| readonly readonly readonly "$1" 2>/dev/null 2>/dev/null
+		test -eu /usr/bin done cd readonly
+	test --verbose x=1 done 'quoted text' grep echo
+		--verbose test /usr/bin readonly
+		test awk 'quoted text' /usr/bin 2>/dev/null
+-eu 'quoted text' export ${HOME}
+	2>/dev/null | test /usr/bin grep
+	echo test local 'quoted text' -eu sed done | awk readonly then echo
+	$(pwd) ${HOME} && "$@" printf "$@" printf done 2>/dev/null local
+	--verbose local cd 2>/dev/null done done echo readonly export
+awk done x=1 "$@" --verbose local
+--verbose echo "$@" sed awk grep local awk | -eu ${HOME} | export
+	local printf grep awk /usr/bin --verbose then
+		$(pwd) awk 2>/dev/null readonly ${HOME} "$@" done | $(pwd) readonly "$@"
+echo | x=1 then && && --verbose 2>/dev/null
+		| sed printf grep test
+2>/dev/null "$1" printf done echo sed ${HOME}
+	cd awk -eu | echo test "$@" $(pwd)
+	export awk | "$1" "$@" echo -eu | | "$@" --verbose done printf awk --verbose
+		/usr/bin readonly cd readonly grep | local done 'quoted text' | -eu 'quoted text'
+cd ${HOME} cd then | test done
+"$1" then local --verbose grep && readonly /usr/bin test then local
+echo "$@" grep /usr/bin "$1" cd
+2>/dev/null -eu --verbose --verbose
+local done $(pwd) test ${HOME} 2>/dev/null ${HOME} awk -eu "$@"
+		2>/dev/null && export "$1" awk "$@" | 'quoted text'
+readonly --verbose grep -eu then "$1" readonly
+awk -eu 'quoted text' x=1 | export export then "$1" | "$1" ${HOME} && readonly
+		export cd readonly printf test 'quoted text' readonly
+	sed readonly | echo cd echo
+local export export test cd 2>/dev/null awk 2>/dev/null
+echo -eu local -eu sed done grep
+	-eu echo x=1 readonly sed cd ${HOME} readonly export "$1" $(pwd) /usr/bin
+grep test done "$1" /usr/bin "$1"
+then echo 'quoted text' "$@" cd 2>/dev/null test
+	x=1 sed 2>/dev/null done && echo 'quoted text'
+	grep echo awk readonly -eu local sed
+	export | cd "$@" test 'quoted text' export "$1" -eu readonly && $(pwd) ${HOME}
+		local grep cd done sed then "$1" echo test local printf sed "$1" done
+	"$@" $(pwd) --verbose grep sed $(pwd) && then test "$1" --verbose done $(pwd)
+		&& 'quoted text' /usr/bin 'quoted text'
+export local echo readonly
+		then printf done && "$@" awk x=1 printf
+		"$1" test readonly 2>/dev/null 2>/dev/null echo | grep readonly awk test
+--verbose local /usr/bin printf local awk 'quoted text'
+awk sed test echo ${HOME} 2>/dev/null local sed 2>/dev/null then x=1 'quoted text'
+echo && "$@" done -eu grep "$@" readonly awk --verbose && ${HOME} then
+	then awk --verbose readonly x=1 local x=1 -eu awk export done grep | && -eu local
+		${HOME} "$1" echo /usr/bin && local "$@" x=1 echo sed done
+	sed awk ${HOME} /usr/bin /usr/bin then 'quoted text'
+readonly && && sed ${HOME} ${HOME} cd 'quoted text' 2>/dev/null test cd -eu sed
+	done awk done 'quoted text' readonly
+	echo sed --verbose cd test 'quoted text' then then ${HOME} grep -eu
+	"$@" $(pwd) /usr/bin export awk echo | $(pwd) grep
+		awk awk /usr/bin ${HOME} local && 'quoted text'
+sed | | readonly awk readonly test
+	then | $(pwd) && export cd
+	$(pwd) ${HOME} 2>/dev/null $(pwd) readonly 2>/dev/null printf then "$1" "$@"
+	export readonly 'quoted text' 'quoted text'
+	printf test -eu awk x=1 sed then | x=1
+	--verbose export x=1 printf export ${HOME} 'quoted text'
+		printf && $(pwd) $(pwd) printf /usr/bin sed ${HOME} /usr/bin
+then $(pwd) 2>/dev/null --verbose 2>/dev/null x=1 done readonly
+		$(pwd) --verbose readonly grep printf && echo then x=1 readonly 'quoted text'
+	printf "$1" awk test x=1 | sed "$@" local test -eu -eu export grep
+"$1" | "$@" && && ${HOME} readonly
+echo sed test echo done x=1 --verbose local -eu 'quoted text' --verbose --verbose
+printf grep test then test ${HOME} ${HOME} -eu --verbose sed
+	${HOME} 2>/dev/null --verbose && 2>/dev/null "$1" test then 2>/dev/null &&
+		export printf done "$1" && export then --verbose 'quoted text' sed "$1" sed echo
+	"$1" x=1 -eu awk && x=1
+local then "$1" $(pwd) done && 2>/dev/null sed sed
+		'quoted text' export "$@" 'quoted text' done
+	-eu $(pwd) echo local && 'quoted text' $(pwd) $(pwd) readonly "$1"
+	${HOME} cd x=1 export export "$1" done readonly 'quoted text' readonly export
+		'quoted text' 'quoted text' readonly export cd ${HOME} ${HOME}
+	sed /usr/bin x=1 grep 'quoted text' 2>/dev/null "$1" -eu cd 2>/dev/null
+printf readonly export awk 'quoted text' 2>/dev/null
+awk readonly | done done sed awk grep printf 'quoted text' "$@" sed
+done local "$@" sed 2>/dev/null
+		"$1" local printf x=1 'quoted text' | x=1 'quoted text'
+&& x=1 --verbose && "$@" 'quoted text'
+		grep done export $(pwd) x=1 test awk $(pwd) ${HOME} readonly echo
+	echo --verbose $(pwd) | then $(pwd) sed printf local
+	'quoted text' test 2>/dev/null local && $(pwd) sed -eu export done awk
+&& /usr/bin sed 2>/dev/null
+	${HOME} test readonly x=1 sed --verbose x=1
+		&& printf $(pwd) done readonly "$1" x=1
+	export ${HOME} | awk ${HOME} $(pwd) 'quoted text' --verbose done
+	2>/dev/null 'quoted text' readonly local && 'quoted text' export local cd
+		done local "$1" "$@" awk
+2>/dev/null printf x=1 printf echo
+2>/dev/null --verbose done printf grep printf echo 'quoted text' local
+	--verbose /usr/bin then --verbose $(pwd) readonly readonly grep ${HOME} -eu
+		done export x=1 done x=1 -eu done local export && readonly && printf export --verbose
+local done 2>/dev/null then -eu 'quoted text' | --verbose &&
+		x=1 --verbose /usr/bin local sed export cd --verbose cd awk test awk -eu
+	"$@" -eu 'quoted text' export -eu readonly grep printf && done $(pwd) test
+		export export awk local && export awk $(pwd) local | |
+		sed --verbose done ${HOME} ${HOME}
+| cd grep -eu --verbose readonly && && local local x=1 then cd
+	cd sed local "$@" | 2>/dev/null /usr/bin then cd echo test 'quoted text' ${HOME}
+'quoted text' test readonly /usr/bin --verbose "$1"
+awk "$1" awk 'quoted text' &&
+	"$1" local then ${HOME} $(pwd)
+	test | local done export echo $(pwd) printf ${HOME} printf /usr/bin
+		$(pwd) echo && cd -eu sed
+export readonly readonly printf | export $(pwd) printf /usr/bin
+	x=1 then -eu 2>/dev/null then --verbose cd export grep cd local "$@"
+		done ${HOME} grep export | grep ${HOME} | local | $(pwd) 'quoted text' 2>/dev/null
+		local $(pwd) cd done done ${HOME} printf $(pwd) &&
+		printf "$@" "$1" | export
+	/usr/bin 'quoted text' grep 2>/dev/null sed 'quoted text' echo | then export "$@"
+	local export | x=1 'quoted text' -eu ${HOME} test && | echo local awk
+echo echo | cd 2>/dev/null test ${HOME}
+		| export readonly -eu 'quoted text' $(pwd) printf
+"$1" 'quoted text' $(pwd) then
+	echo ${HOME} echo $(pwd) test $(pwd) | ${HOME} done
+		${HOME} printf && /usr/bin export --verbose awk cd local /usr/bin 2>/dev/null
+	x=1 cd then grep "$@" "$@" 'quoted text' 'quoted text' sed export local readonly
+x=1 cd -eu --verbose | echo ${HOME} 'quoted text' /usr/bin 'quoted text'
+"$@" done echo && && ${HOME}
+		| test ${HOME} "$1" ${HOME} -eu x=1 'quoted text' | ${HOME} ${HOME} cd
+		| local done && x=1 "$1" printf test local then then 2>/dev/null x=1 2>/dev/null
+	then "$1" -eu local sed -eu ${HOME} export sed --verbose
+	test done /usr/bin done /usr/bin ${HOME} then -eu sed | test printf
+	readonly then && x=1 grep ${HOME} $(pwd) "$@" awk printf
+	&& done local then $(pwd) export | grep $(pwd) && grep --verbose grep
+		done "$1" awk done /usr/bin $(pwd) && done $(pwd) 'quoted text'
+awk -eu then export cd | /usr/bin awk
+	'quoted text' local x=1 x=1 'quoted text' x=1 printf -eu /usr/bin grep then
+/usr/bin echo printf test /usr/bin grep $(pwd)
+	done readonly readonly | "$1" done grep cd "$@" echo | "$@" "$@" readonly
+done echo /usr/bin 2>/dev/null "$@"
+	2>/dev/null | echo /usr/bin sed ${HOME}
+2>/dev/null "$@" ${HOME} 2>/dev/null
+2>/dev/null sed sed -eu awk
+	--verbose done local "$1"
+${HOME} /usr/bin $(pwd)
+	echo x=1 cd $(pwd) "$1" x=1 test 'quoted text' | ${HOME} cd /usr/bin --verbose
+	'quoted text' export sed cd test grep echo x=1 /usr/bin awk --verbose 'quoted text'
+	2>/dev/null x=1 cd 2>/dev/null && printf done grep test
+	grep done export done cd /usr/bin local ${HOME}
+	&& ${HOME} 'quoted text'
+		export 2>/dev/null test /usr/bin printf
+&& test "$@" /usr/bin then 2>/dev/null then local "$@" "$1" awk
+x=1 sed then && test local local "$@" --verbose awk "$1" sed /usr/bin
+test $(pwd) awk "$1" export $(pwd)
+	"$1" 2>/dev/null then
+local test --verbose -eu sed awk "$1" && && ${HOME} x=1 readonly
+/usr/bin x=1 | | --verbose awk printf x=1 awk printf -eu awk printf
+	then -eu "$@" cd -eu 2>/dev/null "$1" export --verbose export awk ${HOME}
+	$(pwd) ${HOME} echo /usr/bin echo --verbose
+'quoted text' /usr/bin | grep then
+	sed "$1" 'quoted text' 2>/dev/null
+	${HOME} 'quoted text' awk awk
+		readonly sed export ${HOME} x=1
+		then ${HOME} | grep && -eu -eu /usr/bin ${HOME} readonly
+	then | 2>/dev/null local export local
+printf done x=1 "$1" echo test | ${HOME} local x=1 echo grep local "$@" ${HOME}
+	sed 2>/dev/null test | && -eu grep cd readonly printf
+		$(pwd) ${HOME} --verbose grep "$1"
+-eu && cd "$1" -eu "$@" && echo "$1" export sed export local /usr/bin
+cd /usr/bin ${HOME} "$@" x=1 export printf done | /usr/bin grep ${HOME}
+	cd done printf 'quoted text' export 2>/dev/null --verbose
+	readonly sed sed cd cd $(pwd) awk --verbose awk
+	"$1" echo $(pwd) && sed x=1 -eu "$@" &&
+	local then printf done "$@" grep sed then x=1 sed --verbose local readonly
+		export -eu local /usr/bin ${HOME}
+/usr/bin /usr/bin export 2>/dev/null readonly | local x=1 echo /usr/bin -eu cd ${HOME}
+2>/dev/null readonly | && done -eu sed && grep "$@" done echo "$@" echo cd
+		$(pwd) "$@" "$@" 2>/dev/null readonly cd | ${HOME} export x=1 test 'quoted text'
+		&& | 2>/dev/null done x=1 cd --verbose printf $(pwd) | "$1" sed done &&
+grep export ${HOME} ${HOME} 'quoted text' readonly
+	-eu $(pwd) sed grep readonly
+${HOME} -eu test cd "$1" sed -eu 2>/dev/null
+| awk awk -eu readonly x=1 ${HOME} && && $(pwd) x=1 /usr/bin
+sed printf 2>/dev/null cd -eu "$1" ${HOME} done && /usr/bin
+	| x=1 'quoted text' done && grep
+	--verbose "$@" $(pwd) && x=1 then grep cd "$@" test --verbose
+"$1" printf 2>/dev/null $(pwd) 2>/dev/null
+		${HOME} 'quoted text' export && printf then /usr/bin
+	printf $(pwd) test cd "$1" ${HOME} 'quoted text' then cd readonly
+"$@" $(pwd) echo export 'quoted text' cd 2>/dev/null
+done sed awk /usr/bin done cd test ${HOME} "$1"
+		grep 'quoted text' ${HOME} local 'quoted text' --verbose "$1" "$1" 2>/dev/null
+		printf printf readonly printf echo $(pwd) "$1" test "$1" $(pwd)
+		grep "$1" | sed -eu && sed awk x=1 2>/dev/null "$@" x=1 $(pwd)
+		x=1 ${HOME} /usr/bin ${HOME} -eu && printf 2>/dev/null |
+		x=1 local test | echo x=1 echo $(pwd) test ${HOME} --verbose 'quoted text'
+done 'quoted text' then x=1 && test
+		&& awk cd -eu done "$@" echo
+		done awk "$1" grep "$1" export done done
+	readonly --verbose && cd /usr/bin
+		| "$1" cd /usr/bin "$1" $(pwd) "$@"
+	/usr/bin readonly $(pwd) $(pwd) then /usr/bin cd "$1" local x=1 printf
+grep "$1" /usr/bin && then -eu grep -eu ${HOME} x=1
+		| | -eu --verbose grep readonly awk export && export
+	echo printf local "$@" grep --verbose grep "$1" readonly readonly test printf
+		cd ${HOME} awk ${HOME} 2>/dev/null ${HOME} 'quoted text' cd done x=1 x=1 && echo
+		/usr/bin $(pwd) test export then readonly
+		grep ${HOME} export x=1 $(pwd) awk grep
+		$(pwd) ${HOME} awk --verbose && readonly cd x=1 grep /usr/bin 'quoted text'
+		then grep && sed 'quoted text' x=1 then ${HOME} --verbose $(pwd) test ${HOME} echo
+local echo cd grep | local grep local then "$@" sed printf cd
+		echo then grep 2>/dev/null 2>/dev/null | sed && 2>/dev/null
+test printf test cd local echo grep | echo 2>/dev/null
+	x=1 then $(pwd) | && "$@" -eu done -eu |
+		test --verbose cd printf 2>/dev/null printf
+	then 2>/dev/null awk 'quoted text' && export
+	-eu -eu /usr/bin grep readonly echo grep
+		/usr/bin x=1 local "$@" cd "$@" x=1 2>/dev/null --verbose printf --verbose "$1"
+echo -eu printf export --verbose
+local ${HOME} && --verbose done "$@" printf 'quoted text'
+echo -eu /usr/bin | --verbose
+	then | | done grep local export readonly 2>/dev/null
+sed -eu grep $(pwd) -eu $(pwd) "$1" x=1 --verbose printf echo ${HOME}
+	awk readonly $(pwd) 'quoted text'
+		test awk export "$@" $(pwd) "$@" cd 'quoted text'
+	local 2>/dev/null /usr/bin 2>/dev/null then
+/usr/bin cd 2>/dev/null $(pwd) "$1" && | grep && cd && | awk 2>/dev/null
+--verbose "$@" echo cd export then | "$1" 'quoted text' done test 'quoted text'
+		-eu 2>/dev/null -eu "$@" ${HOME} grep awk 'quoted text' local
+		grep local && ${HOME} "$@" 2>/dev/null
+	&& printf -eu 2>/dev/null $(pwd) awk -eu awk grep | 'quoted text' grep
+		${HOME} --verbose ${HOME} done export "$1" ${HOME}
+		'quoted text' done awk export | test sed done export awk -eu && 'quoted text' -eu
+${HOME} /usr/bin && echo 2>/dev/null --verbose $(pwd) ${HOME} printf export
+	readonly /usr/bin /usr/bin printf
+2>/dev/null done awk /usr/bin x=1 ${HOME} -eu printf ${HOME} | --verbose local
+readonly x=1 cd && "$1" 'quoted text'
+		| done readonly test --verbose
+	export "$1" "$@" test then && $(pwd)
+"$@" readonly && | local done local printf
+		grep ${HOME} printf then local 'quoted text'
+	| then ${HOME} "$1" sed x=1 sed sed awk 2>/dev/null x=1 --verbose 'quoted text'
+		test --verbose export awk 2>/dev/null "$1" echo echo 2>/dev/null x=1 --verbose
+	-eu "$@" grep ${HOME} then /usr/bin --verbose $(pwd) then
+test | 2>/dev/null ${HOME} && -eu $(pwd) done test
+		| 'quoted text' "$1" && done "$1" echo 2>/dev/null echo then -eu
+	local cd "$1" sed local sed echo readonly grep grep printf 2>/dev/null
+then awk grep export done
+	"$@" echo 'quoted text' --verbose &&
+done -eu 'quoted text' --verbose sed ${HOME}
+	$(pwd) -eu grep grep awk --verbose
+		${HOME} echo local grep 2>/dev/null printf
+	test --verbose 2>/dev/null -eu sed "$1" $(pwd) ${HOME} 'quoted text' "$1"
+	&& /usr/bin done awk ${HOME} awk local
+		x=1 export grep export 2>/dev/null test test 'quoted text' grep local awk export
+	cd 'quoted text' export export then cd ${HOME} local done grep
+#include c43.sh
+--verbose x=1 echo 'quoted text' && x=1 "$1" export readonly
+		-eu x=1 $(pwd) echo /usr/bin test x=1 readonly
+2>/dev/null "$1" | local /usr/bin ${HOME} test awk x=1
+export --verbose test 2>/dev/null $(pwd) echo /usr/bin ${HOME} && printf
+		echo x=1 ${HOME} test --verbose
+--verbose 2>/dev/null readonly && $(pwd) readonly ${HOME} readonly then
+"$1" && "$1" awk "$1" test
+	local sed 'quoted text' local export awk test awk local 'quoted text'
+		printf --verbose grep "$@" echo x=1 2>/dev/null local 'quoted text' test
+--verbose "$@" /usr/bin $(pwd)
+	awk test then /usr/bin ${HOME}
+	"$@" --verbose export cd $(pwd) local then done 2>/dev/null
+		"$@" export && readonly -eu -eu printf -eu
+test | /usr/bin "$1" export test then echo export sed 'quoted text' done
+		readonly "$@" -eu /usr/bin ${HOME} && "$1" -eu "$@" export readonly
+		${HOME} | test cd 'quoted text'
+export x=1 then -eu /usr/bin printf $(pwd) export awk /usr/bin x=1 "$@" "$@" 2>/dev/null
+		/usr/bin ${HOME} ${HOME} | -eu awk
+sed grep /usr/bin "$1" export export /usr/bin
+		"$@" printf --verbose --verbose echo ${HOME} && printf local cd 'quoted text'
+"$@" | | sed awk && printf
+		then | $(pwd) /usr/bin local cd grep printf 'quoted text' && then
+| done done then "$@" && echo
+	then -eu local sed printf
+| /usr/bin local test
+		export export | printf --verbose ${HOME}
+	readonly 2>/dev/null -eu x=1 /usr/bin 2>/dev/null local
+		"$1" "$1" 'quoted text' then "$@" | test readonly done awk -eu
+	| grep /usr/bin x=1 /usr/bin printf ${HOME} x=1
+'quoted text' readonly
+	${HOME} -eu grep printf 'quoted text' done then /usr/bin --verbose
+	test 2>/dev/null echo "$1" awk 'quoted text'
+export sed --verbose 'quoted text' $(pwd) | echo
+	sed test awk awk printf -eu | 'quoted text' printf "$1"
+		| grep export awk 2>/dev/null awk -eu && /usr/bin
+	awk done /usr/bin readonly
+		| -eu sed export test sed /usr/bin | cd 'quoted text' echo export sed ${HOME} /usr/bin
+grep grep local ${HOME} "$@" | local
+	then printf 'quoted text' readonly | local printf x=1 x=1 $(pwd)
+	2>/dev/null && /usr/bin /usr/bin 2>/dev/null
+		x=1 awk /usr/bin done cd then 'quoted text' done --verbose 2>/dev/null printf
+		$(pwd) test echo test readonly then awk then /usr/bin $(pwd)
+	${HOME} x=1 printf sed ${HOME} local ${HOME} /usr/bin local /usr/bin /usr/bin
+	readonly grep 2>/dev/null grep --verbose && export
+		--verbose grep 2>/dev/null local $(pwd) awk printf cd --verbose printf
+	export awk sed sed x=1 local /usr/bin --verbose
+	--verbose cd grep echo test 'quoted text' echo export
+	cd printf awk local sed sed "$@" cd printf done && ${HOME} "$1" readonly
+		&& grep "$@" x=1 printf && --verbose then | 'quoted text'
+	done grep local export /usr/bin $(pwd) /usr/bin "$1" then x=1 "$1" cd
+	export "$@" x=1 echo awk "$@" 2>/dev/null local
+		grep && export grep echo done export export /usr/bin test cd export
+	/usr/bin && /usr/bin then cd printf readonly --verbose "$@" readonly
+	$(pwd) $(pwd) x=1 readonly grep ${HOME} --verbose "$@"
+done grep echo 2>/dev/null grep then export readonly | -eu 'quoted text'
+readonly export $(pwd) && 'quoted text' sed done | /usr/bin export then
+printf && | local --verbose test 2>/dev/null cd test -eu 'quoted text'
+	&& /usr/bin awk grep ${HOME} export 2>/dev/null
+	&& $(pwd) local 'quoted text' "$1" echo local sed echo x=1 $(pwd) "$@"
+		-eu x=1 "$@" echo sed printf done cd done export x=1 grep sed -eu "$@" /usr/bin
+		-eu 'quoted text' sed /usr/bin awk -eu then sed printf x=1 local
+	/usr/bin $(pwd) grep "$@" test local && && then
+	done sed done -eu 2>/dev/null
+${HOME} $(pwd) --verbose export /usr/bin ${HOME} test
+		echo 'quoted text' $(pwd) /usr/bin then
+	export 'quoted text' sed 2>/dev/null
+	-eu x=1 /usr/bin done $(pwd) readonly then 2>/dev/null printf
+cd printf grep --verbose awk export local local test | done awk "$1" readonly
+	-eu "$1" && ${HOME} "$@"
+		printf readonly | 'quoted text' awk 2>/dev/null && grep /usr/bin
+then 2>/dev/null --verbose echo grep grep && --verbose
+	awk --verbose && local then test $(pwd) --verbose 2>/dev/null local export &&
+cd -eu cd test x=1 -eu local $(pwd) grep readonly sed ${HOME} cd "$1" x=1
+	grep 'quoted text' /usr/bin grep export test && done 'quoted text' /usr/bin
+		sed /usr/bin cd | ${HOME} echo -eu
+sed --verbose --verbose 'quoted text' x=1 $(pwd) cd --verbose done cd
+		printf | /usr/bin done test sed printf --verbose export
+		'quoted text' ${HOME} printf $(pwd) "$1" sed readonly sed
+cd cd export 'quoted text'
+		done && ${HOME} | readonly done cd printf cd
+		readonly local export $(pwd) grep 2>/dev/null | "$@" grep ${HOME}
+		cd | grep test "$@" then grep "$1" "$1" awk --verbose
+	&& awk /usr/bin ${HOME} x=1 export
+	-eu awk cd | printf "$@" /usr/bin 'quoted text' && sed awk then $(pwd) readonly
+		local ${HOME} awk -eu -eu "$@" test
+		2>/dev/null then --verbose /usr/bin $(pwd) awk "$1" cd
+	| "$1" echo readonly 'quoted text' readonly echo then "$1" -eu echo awk $(pwd) |
+	grep done local ${HOME} test
+		${HOME} awk --verbose test test awk -eu local grep
+sed export test awk 'quoted text' | export ${HOME}
+	awk "$1" 'quoted text' "$1" "$1" cd --verbose x=1 ${HOME} echo -eu "$@"
+	readonly -eu --verbose done export local $(pwd) x=1 /usr/bin
+'quoted text' | test ${HOME} && printf grep -eu $(pwd) printf done -eu "$1"
+		$(pwd) done printf grep ${HOME} echo export | | 'quoted text' printf awk
+$(pwd) $(pwd) grep | -eu -eu grep test readonly "$@" "$@" && local --verbose readonly
+	"$1" x=1 awk export 2>/dev/null
+	awk 2>/dev/null && $(pwd) sed then
+		-eu -eu then && awk export sed 2>/dev/null printf echo awk /usr/bin && --verbose
+local | done printf readonly export 2>/dev/null test | 'quoted text'
+"$@" done $(pwd) x=1 echo awk cd printf && --verbose sed 'quoted text'
+		'quoted text' readonly cd ${HOME} printf sed 2>/dev/null export echo grep
+		readonly printf local cd echo then | export x=1
+	then grep && test ${HOME} local sed "$1" awk sed cd $(pwd)
+	--verbose echo 'quoted text' 2>/dev/null
+"$1" grep && "$1" --verbose --verbose sed grep cd 2>/dev/null "$@"
+		export done awk printf /usr/bin | test --verbose echo -eu sed $(pwd) done
+${HOME} readonly printf "$1" sed local "$1" 'quoted text'
+	then echo && sed && printf printf cd awk /usr/bin local /usr/bin
+cd echo ${HOME} ${HOME} export | echo done echo x=1 "$1" /usr/bin ${HOME} test 'quoted text'
+	cd test test 'quoted text' local
+/usr/bin test test echo /usr/bin
+export "$@" | && grep printf echo | --verbose ${HOME} awk -eu export
+	local | awk grep --verbose /usr/bin 2>/dev/null
+	awk $(pwd) /usr/bin 'quoted text' /usr/bin
+	echo then $(pwd) grep "$1" echo readonly readonly local
+		readonly /usr/bin then "$1" | done then readonly local echo echo
+		sed readonly test /usr/bin cd "$@"
+	printf && local --verbose /usr/bin
+"$@" 'quoted text' printf printf "$@" 2>/dev/null export export
+		x=1 export ${HOME} grep
+	sed awk awk then awk local ${HOME}
+'quoted text' readonly sed cd export --verbose then awk /usr/bin test then
+	echo readonly "$@" printf cd local awk ${HOME} 'quoted text'
+then ${HOME} 'quoted text' readonly x=1 $(pwd) printf then
+		${HOME} printf --verbose "$@" sed readonly 'quoted text' done export
+cd 2>/dev/null grep -eu /usr/bin x=1 local /usr/bin && x=1 grep "$1"
+	-eu && done "$1" export export awk 2>/dev/null x=1 local "$1"
+	done export /usr/bin readonly && 2>/dev/null
+	echo readonly grep $(pwd) 2>/dev/null readonly ${HOME} ${HOME}
+2>/dev/null readonly awk sed | local
+	grep done done readonly export $(pwd) "$1" /usr/bin x=1 local sed --verbose awk
+		readonly "$1" $(pwd) then "$@" --verbose ${HOME}
+	export /usr/bin echo | printf local sed then --verbose
+		x=1 grep test sed && "$1" done grep x=1 2>/dev/null
+		x=1 "$1" awk "$1" echo /usr/bin export sed grep test readonly ${HOME}
+done awk /usr/bin | printf $(pwd) /usr/bin echo done 'quoted text'
+		export then && then done ${HOME} done 2>/dev/null sed -eu test local then $(pwd)
+2>/dev/null /usr/bin local -eu readonly --verbose printf | x=1 awk x=1 export
+${HOME} 2>/dev/null 'quoted text'
+| readonly | cd x=1 $(pwd) sed then then --verbose "$@" ${HOME} -eu 'quoted text'
+readonly | $(pwd) then | -eu ${HOME} then -eu test done ${HOME} -eu printf
+	sed "$@" test grep then
+		| x=1 $(pwd) done local grep local "$@" then awk /usr/bin then --verbose 2>/dev/null
+test printf | --verbose sed -eu readonly cd done --verbose "$@" "$1"
+	| x=1 -eu awk | /usr/bin local awk -eu
+		"$@" readonly -eu 'quoted text' "$1" printf 'quoted text' grep | cd $(pwd) &&
+	done ${HOME} "$@" printf 2>/dev/null 'quoted text' --verbose "$1" | sed
+	$(pwd) -eu awk export then
+	'quoted text' echo cd echo ${HOME} grep
+		${HOME} /usr/bin && | 'quoted text' -eu /usr/bin printf then sed cd |
+	echo ${HOME} 'quoted text' "$1" echo | && sed "$@" /usr/bin cd
+then -eu "$@" "$1" grep /usr/bin 2>/dev/null
+		then sed grep awk /usr/bin "$@" test "$@" cd grep then /usr/bin sed x=1
+		"$@" "$@" x=1 ${HOME} test test 'quoted text'
+	x=1 readonly "$1" --verbose printf "$1" grep $(pwd) /usr/bin
+$(pwd) grep then 'quoted text' cd 'quoted text' awk printf readonly cd 2>/dev/null
+then echo 'quoted text' grep "$1" test 'quoted text' x=1 printf printf
+		export 'quoted text' export -eu then "$@" ${HOME} /usr/bin $(pwd) sed
+	grep echo then -eu -eu sed x=1 -eu printf "$1" awk local 2>/dev/null
+	export -eu /usr/bin printf test -eu
+"$1" grep 2>/dev/null grep "$1" grep sed export --verbose
+	&& cd then done "$1" ${HOME} && export "$1" readonly awk grep grep "$@"
+| 'quoted text' readonly
+awk | grep 2>/dev/null echo done /usr/bin 2>/dev/null
+	-eu -eu done "$@" done /usr/bin
+		"$@" 2>/dev/null sed 'quoted text' 2>/dev/null export
+		printf readonly echo echo export done local -eu grep 'quoted text'
+	done sed $(pwd) "$@" export echo echo $(pwd) $(pwd) echo export && test
+	"$@" then ${HOME} && test done local awk readonly
+	local | /usr/bin awk done /usr/bin awk grep /usr/bin "$1" "$@" "$@" 2>/dev/null
+done test echo "$1" "$1" readonly | then printf /usr/bin
+		$(pwd) test cd "$@" 'quoted text' "$@" readonly 2>/dev/null
+		export $(pwd) "$@" grep 2>/dev/null
+	sed $(pwd) | | done grep done "$1" 'quoted text' readonly export local && readonly
+	sed 2>/dev/null /usr/bin "$@" "$@" x=1 'quoted text' --verbose | done
+	test 'quoted text' local printf echo
+$(pwd) readonly 'quoted text' echo then
+	printf done done readonly x=1 ${HOME}
+		grep test test readonly cd --verbose then done $(pwd) awk readonly awk "$1"
+	then x=1 $(pwd) && printf "$1" /usr/bin readonly
+export local | | 'quoted text' printf done cd "$1" -eu "$1" printf export ${HOME}
+		test grep cd x=1 local "$1" done -eu local -eu "$@" readonly
+"$@" /usr/bin sed | grep echo sed && "$1" cd "$@" echo 2>/dev/null printf grep "$@"
+		test then x=1 /usr/bin /usr/bin 2>/dev/null then local
+		&& -eu readonly cd local printf
+		"$@" export ${HOME} awk
+x=1 readonly echo echo
+	done awk grep 2>/dev/null echo echo /usr/bin local test 'quoted text' cd
+	${HOME} printf x=1 export 2>/dev/null then --verbose --verbose
+		awk -eu cd 'quoted text' done
+| printf -eu 2>/dev/null export "$1" "$1" "$1" done grep ${HOME} "$@" "$@"
+| && awk x=1 done export
+then done | x=1 local export readonly -eu then "$1"
+$(pwd) then done $(pwd) cd /usr/bin | | printf 2>/dev/null --verbose local
+sed x=1 -eu echo then then
+	readonly ${HOME} "$@" 'quoted text' grep
+		"$@" --verbose grep | 2>/dev/null cd x=1 /usr/bin && cd grep done $(pwd) readonly
+&& && cd cd $(pwd) ${HOME} 2>/dev/null 'quoted text'
+readonly awk test 'quoted text' local
+		awk "$1" grep readonly "$@" test local | /usr/bin 2>/dev/null
+echo "$1" && readonly sed export sed
+	x=1 -eu printf $(pwd) x=1 && $(pwd) printf grep
+	then --verbose then readonly test -eu --verbose $(pwd) 2>/dev/null
+	${HOME} sed -eu then local && -eu cd x=1 $(pwd) grep --verbose awk "$1"
+| x=1 echo x=1 ${HOME} done ${HOME}
+2>/dev/null cd sed awk ${HOME} readonly
+--verbose then grep ${HOME} --verbose local cd $(pwd) export
+	$(pwd) /usr/bin /usr/bin 'quoted text' && /usr/bin 2>/dev/null export
+echo && ${HOME} x=1 readonly 2>/dev/null 'quoted text' x=1 local | "$1" ${HOME}
+		then awk awk export "$@" sed "$1" echo | "$@"
+		| 2>/dev/null /usr/bin printf test echo printf "$@" sed ${HOME} done
+	local 'quoted text' 'quoted text' printf /usr/bin && "$1" echo --verbose && 2>/dev/null
+	readonly 2>/dev/null then -eu 'quoted text'
+	then then x=1 ${HOME} echo sed local awk "$1" export
+then grep $(pwd) -eu 'quoted text'
+		done "$1" done --verbose printf && readonly
+		cd ${HOME} /usr/bin -eu &&
+then -eu 2>/dev/null ${HOME} grep local $(pwd) 2>/dev/null test 'quoted text'
+-eu x=1 2>/dev/null cd then && test && local export printf 'quoted text'
+	2>/dev/null export -eu grep sed
+		cd test x=1 sed $(pwd)
+		printf | ${HOME} awk then ${HOME} test --verbose
+	&& awk x=1 readonly $(pwd) done export ${HOME} readonly readonly
+		-eu $(pwd) then then readonly 'quoted text' --verbose "$1" 2>/dev/null
+echo echo ${HOME} grep printf /usr/bin test readonly
+local readonly 2>/dev/null && 2>/dev/null && /usr/bin test
+	x=1 --verbose ${HOME} grep cd ${HOME} 'quoted text' echo printf | local
+	&& && readonly && 2>/dev/null | --verbose 'quoted text'
+"$1" | grep local grep done test awk /usr/bin /usr/bin then ${HOME}
+'quoted text' done then 2>/dev/null 'quoted text' sed "$@" readonly test 'quoted text'
+	awk cd export readonly ${HOME} readonly
+	$(pwd) --verbose readonly -eu && ${HOME} cd
+		cd -eu x=1 test readonly export --verbose printf printf printf
+	/usr/bin /usr/bin "$1" export -eu -eu $(pwd) 'quoted text' "$1" &&
+	test done cd export export readonly "$@" readonly local /usr/bin
+	&& --verbose done x=1 2>/dev/null --verbose "$@" /usr/bin
+	export test $(pwd) --verbose sed $(pwd) printf -eu echo sed export 2>/dev/null
+		x=1 && awk && "$1" echo readonly done ${HOME} export x=1
+	'quoted text' export 2>/dev/null sed then && sed awk && echo -eu ${HOME} cd
+x=1 printf "$@" ${HOME} readonly readonly local local test
+"$@" x=1 $(pwd) -eu -eu
+		then export then done done 2>/dev/null -eu test | "$@" awk ${HOME}
+cd cd grep "$@" then echo sed 2>/dev/null 'quoted text'
+		then local test awk awk sed export done /usr/bin /usr/bin export -eu "$@" $(pwd)
+		--verbose echo $(pwd) test echo echo sed grep 'quoted text'
+	x=1 sed awk && /usr/bin then readonly
+	then ${HOME} "$@" echo awk "$1" readonly 'quoted text' sed -eu
+		test 'quoted text' "$@"
+	| export readonly 2>/dev/null && printf $(pwd) "$1"
+	grep $(pwd) 'quoted text' $(pwd) "$@" local cd cd $(pwd) "$@" ${HOME}
+-eu local x=1 | done grep grep sed then grep readonly done test
+grep then awk && | -eu printf x=1 "$1" 'quoted text'
+export ${HOME} echo -eu done awk "$1" printf && awk $(pwd) cd "$1"
+		cd "$@" grep | test then x=1 $(pwd)
+	awk test done sed /usr/bin done /usr/bin
+export awk 2>/dev/null "$1"
+	/usr/bin "$@" printf "$1" $(pwd) done printf /usr/bin ${HOME} export -eu
+	readonly --verbose ${HOME} export grep sed test
+x=1 test | test $(pwd) printf x=1 -eu test awk
+		| /usr/bin local $(pwd) 2>/dev/null -eu cd local 'quoted text'
+	echo sed printf && 2>/dev/null /usr/bin printf local ${HOME} $(pwd) x=1 /usr/bin
+	readonly "$@" done | x=1 -eu test
+		awk 'quoted text' readonly $(pwd) 2>/dev/null awk awk "$@" x=1 sed then "$@" sed
+awk sed echo -eu local local -eu printf grep readonly -eu 2>/dev/null awk "$@"
+		test readonly -eu grep
+2>/dev/null x=1 cd --verbose /usr/bin "$@" test
+local -eu done test -eu ${HOME} cd done 2>/dev/null 'quoted text' /usr/bin | readonly
+		| readonly local | && ${HOME} 'quoted text'
+	&& /usr/bin awk | $(pwd) --verbose "$1" test
+	export readonly $(pwd) 'quoted text' readonly awk
+	2>/dev/null 'quoted text' sed cd x=1 cd done printf
+		"$@" 'quoted text' x=1 "$1" $(pwd) "$@" "$@" readonly -eu
+	cd ${HOME} cd sed done -eu ${HOME} /usr/bin done x=1 grep 2>/dev/null /usr/bin
+	export 2>/dev/null "$1" && x=1 -eu cd awk ${HOME} | "$@"
+local "$1" local cd cd local
+'quoted text' local 'quoted text' awk -eu && test
+test echo sed readonly --verbose printf ${HOME} 2>/dev/null
+		| "$1" && && "$1" local then awk export
+		x=1 && x=1 then "$1" -eu awk printf
+	$(pwd) sed awk sed echo "$@"
+		2>/dev/null cd test "$@" | && "$@" export grep "$@"
+	x=1 local "$@" ${HOME} ${HOME} then test export local test -eu export
+-eu grep | printf && "$@" /usr/bin
+	printf 'quoted text'
+		echo "$1" then 2>/dev/null && $(pwd) readonly awk "$@" readonly cd grep echo
+		local awk awk --verbose awk 'quoted text' local echo sed cd $(pwd)
+awk "$@" then test | 'quoted text' && cd /usr/bin ${HOME} export then ${HOME} -eu
+		$(pwd) /usr/bin then -eu /usr/bin
+		"$1" --verbose test export
+local /usr/bin cd sed then export
+		&& sed done /usr/bin 'quoted text'
+		2>/dev/null export export && grep then
+	--verbose awk echo done | echo
+		'quoted text' | printf 2>/dev/null
+grep | echo local --verbose x=1
+		test then --verbose 'quoted text' done then test export
+	sed cd then local readonly $(pwd) x=1 --verbose /usr/bin && awk
+	then 'quoted text' && -eu done 2>/dev/null && test /usr/bin
+export then && /usr/bin "$@" -eu 'quoted text'
+	x=1 x=1 ${HOME} echo | && 2>/dev/null export readonly 2>/dev/null local
+	-eu export | sed | done echo local grep done then cd -eu 2>/dev/null /usr/bin
+		printf $(pwd) awk 2>/dev/null local --verbose then
+"$1" ${HOME} | x=1 /usr/bin 'quoted text' local 'quoted text' cd "$@" | && readonly
+		-eu then | $(pwd) done grep
+	export echo grep --verbose && ${HOME}
+	"$1" echo | | local printf export &&
+		"$1" ${HOME} readonly readonly
+		'quoted text' -eu export printf "$1" grep "$1" printf
+		local readonly printf sed readonly
+	readonly "$1" printf awk "$@" "$1" echo sed
+		local -eu 'quoted text' &&
+	printf test /usr/bin $(pwd) "$1" printf
+		then x=1 'quoted text' sed 'quoted text' /usr/bin /usr/bin
+		echo awk && ${HOME} "$1" 2>/dev/null ${HOME} x=1 readonly 'quoted text'
+	local test readonly "$1" "$@" awk /usr/bin ${HOME} echo x=1 cd 'quoted text'
+		then "$@" ${HOME} $(pwd) sed | -eu grep cd /usr/bin printf
+	awk $(pwd) then test test --verbose x=1
+		grep /usr/bin sed 'quoted text' "$@" done
+		'quoted text' ${HOME} grep echo readonly -eu echo | 2>/dev/null x=1 export
+	$(pwd) && printf readonly $(pwd) ${HOME} printf && "$@" test readonly
+		x=1 --verbose sed -eu printf | $(pwd)
+$(pwd) && "$1" --verbose local sed local echo cd then printf readonly
+-eu x=1 /usr/bin sed readonly | awk -eu "$@" -eu echo echo $(pwd) done done
+local --verbose $(pwd) done printf | echo export -eu test "$1"
+		$(pwd) echo && -eu test local | --verbose awk --verbose printf cd grep
+${HOME} x=1 && -eu sed local --verbose
+		-eu | then sed 'quoted text' cd printf readonly && export -eu -eu
+readonly sed sed test local 2>/dev/null 2>/dev/null
+	-eu 'quoted text' readonly awk --verbose --verbose sed 'quoted text'
+grep readonly "$@" --verbose printf "$@" --verbose then test readonly 'quoted text'
+readonly /usr/bin awk $(pwd) ${HOME} 'quoted text' done
+		awk /usr/bin $(pwd) export ${HOME} cd readonly
+		'quoted text' echo 2>/dev/null readonly | -eu sed grep done x=1 -eu export
+	then test done cd 2>/dev/null --verbose $(pwd) | 2>/dev/null cd $(pwd)
+		local | readonly local awk readonly awk /usr/bin awk 'quoted text' --verbose
+		test local 'quoted text' "$1" done "$@"
+		local | x=1 -eu 2>/dev/null
+--verbose -eu x=1 'quoted text'
+grep grep ${HOME} -eu grep echo "$1" "$@" test cd
+	printf /usr/bin ${HOME} | printf sed | "$1" ${HOME} done
+sed grep echo readonly 'quoted text' && done
+	printf then && test export x=1 'quoted text'
+	cd grep test 'quoted text' done readonly
+	--verbose echo cd then echo
+	${HOME} ${HOME} | export 2>/dev/null
+	then export awk 'quoted text' readonly export x=1
+	sed x=1 export 2>/dev/null $(pwd)
+		x=1 | grep then export 'quoted text' 'quoted text' done $(pwd) "$1" "$1" ${HOME}
+done $(pwd) x=1 test
+	awk echo 'quoted text'
+		then -eu awk 2>/dev/null sed 'quoted text' 2>/dev/null $(pwd) 'quoted text'
+	export | done $(pwd) /usr/bin
+		'quoted text' printf 2>/dev/null ${HOME}
+		printf done 2>/dev/null "$@"
+		| -eu "$1" 2>/dev/null --verbose grep
+"$1" $(pwd) "$@" done sed done sed
+awk x=1 grep $(pwd) awk test echo export readonly printf local $(pwd) 'quoted text'
+echo -eu sed awk "$1" /usr/bin --verbose printf echo export done cd -eu
+		then cd | -eu ${HOME} "$@" --verbose
+		local /usr/bin printf readonly
+		${HOME} cd && then readonly $(pwd) echo
+		then "$1" printf readonly --verbose sed $(pwd) done $(pwd)
+$(pwd) readonly cd /usr/bin 'quoted text' /usr/bin
+/usr/bin export && done done done | ${HOME} sed cd --verbose
+	&& test echo 'quoted text'
+	"$@" export done /usr/bin sed /usr/bin "$1" awk grep awk then "$@" "$@" 2>/dev/null
+-eu printf echo echo ${HOME} &&
+x=1 "$@" "$@" sed "$1" printf ${HOME} done cd 'quoted text' echo cd sed cd "$@"
+	$(pwd) 'quoted text' $(pwd) --verbose
+	$(pwd) 2>/dev/null 'quoted text' printf
+awk printf x=1 "$1" 2>/dev/null echo done echo "$@"
+x=1 test local /usr/bin then 'quoted text' done $(pwd) -eu "$@" /usr/bin
+	test awk export cd | printf "$@" awk sed --verbose echo readonly
+		cd test ${HOME} done "$@" --verbose "$1" awk local printf -eu done
+		/usr/bin --verbose printf --verbose
+--verbose 2>/dev/null 2>/dev/null done echo
+		printf test -eu "$1" 'quoted text' echo /usr/bin cd then export
+		-eu grep && ${HOME} readonly "$1" "$1" sed "$@" export grep && echo 'quoted text'
+--verbose x=1 ${HOME} /usr/bin -eu | && readonly ${HOME}
+"$1" /usr/bin 'quoted text' x=1 export grep echo &&
+awk awk done | cd "$1" ${HOME}
+local | "$@" x=1 grep printf local "$1" --verbose echo && echo readonly --verbose
+		cd local export x=1 -eu then readonly -eu cd echo ${HOME} printf
+		| readonly local done x=1 done echo ${HOME} echo
+		-eu x=1 -eu x=1 "$@" ${HOME}
+	test 2>/dev/null echo grep sed
+	done export ${HOME} --verbose
+		done /usr/bin readonly -eu -eu --verbose done done cd
+	awk 2>/dev/null "$1" x=1 && $(pwd) /usr/bin readonly cd echo -eu
+		done 'quoted text' printf
+		"$@" /usr/bin "$@" export "$@" --verbose then --verbose awk sed "$@"
+	2>/dev/null grep cd x=1 /usr/bin readonly cd "$@" readonly awk 'quoted text'
+		"$@" | "$@" 2>/dev/null then ${HOME} x=1 -eu 2>/dev/null
+local local export /usr/bin echo -eu sed | ${HOME} awk 'quoted text'
+	2>/dev/null then echo done "$@" ${HOME} export -eu 'quoted text'
+		"$1" ${HOME} printf && awk 2>/dev/null
+&& done /usr/bin && ${HOME} 'quoted text' 'quoted text' ${HOME} /usr/bin |
+${HOME} test sed export ${HOME} "$@" readonly awk awk -eu echo "$1"
+	awk 2>/dev/null | cd 'quoted text' $(pwd) sed
+		--verbose "$@" && cd "$@" grep && sed && x=1 | done cd test --verbose $(pwd) done
+		${HOME} -eu --verbose echo "$@" grep echo | cd sed && awk --verbose x=1 --verbose
+		${HOME} x=1 -eu --verbose "$@"
+then awk local x=1 grep done x=1 x=1 echo 2>/dev/null
+	readonly export awk ${HOME} && "$@" | && x=1 then && printf
+		export printf echo grep readonly local
+-eu && "$1" | grep done && && awk printf $(pwd)
+	grep awk awk "$@" printf cd echo printf 2>/dev/null "$@" cd echo
+| 2>/dev/null printf 2>/dev/null printf grep /usr/bin
+	done cd ${HOME} ${HOME} readonly
+local awk grep -eu export grep export awk test local echo done export echo cd
+awk then local 2>/dev/null local grep -eu done readonly local
+	| $(pwd) x=1 $(pwd) x=1 | ${HOME} -eu "$@" ${HOME} -eu awk export
+		grep sed grep $(pwd) && sed cd /usr/bin grep sed echo echo 2>/dev/null cd local
+	cd && x=1 local ${HOME} "$@" grep --verbose export
+| $(pwd) "$@" -eu 2>/dev/null x=1 awk x=1 grep $(pwd)
+	2>/dev/null 2>/dev/null
+	$(pwd) && "$@" export sed readonly ${HOME} && grep "$1" -eu ${HOME} local
+	${HOME} printf "$1" local
+then grep && "$1" && printf sed
+		$(pwd) /usr/bin echo
+	export x=1 | "$1" echo
+	2>/dev/null /usr/bin local "$1" readonly 'quoted text'
+printf "$@" ${HOME} then
+	${HOME} readonly done export local test grep local ${HOME} readonly awk
+then -eu echo /usr/bin x=1 done printf done | 'quoted text' "$1" 'quoted text' 'quoted text'
+		awk done done ${HOME} readonly x=1 "$@" echo
+export x=1 done 'quoted text' "$1" sed cd then done ${HOME} done
+	local $(pwd) && printf ${HOME}
+		&& export export grep "$@" export
+		$(pwd) test test sed awk done "$1" 2>/dev/null grep
+		awk readonly x=1 x=1 then 2>/dev/null cd printf test $(pwd) test -eu
+		| "$@" awk test grep local -eu /usr/bin "$1" then export
+| --verbose done readonly awk echo test /usr/bin -eu 2>/dev/null ${HOME}
+	grep "$@" done awk echo --verbose
+		local x=1 $(pwd) 'quoted text' local "$@" /usr/bin ${HOME}
+	done $(pwd) awk cd && printf $(pwd) printf
+-eu grep printf /usr/bin | grep test printf -eu export x=1 ${HOME}
+		${HOME} 'quoted text' 2>/dev/null "$1" export printf
+	-eu x=1 printf then --verbose printf export --verbose
+sed -eu cd awk $(pwd) echo printf cd $(pwd) grep "$1" /usr/bin | $(pwd)
+cd then printf $(pwd) "$1" --verbose --verbose
+	'quoted text' x=1 done $(pwd) --verbose | then "$1" "$1" then && &&
+	printf printf -eu test export 'quoted text' echo 'quoted text' "$@" awk -eu
+		x=1 2>/dev/null readonly | export done readonly && awk grep |
+		${HOME} grep local grep && readonly /usr/bin export readonly test x=1 test
+	then && x=1 then test then
+		then ${HOME} 'quoted text' x=1 echo x=1 2>/dev/null local
+	then 'quoted text' x=1 ${HOME} sed test readonly echo readonly cd then
+		awk 'quoted text' $(pwd) done awk done export 'quoted text'
+		grep cd export local cd sed && local readonly done local x=1 cd echo "$1"
+done --verbose local "$1" done "$@" "$@" /usr/bin 'quoted text'
+		/usr/bin -eu local --verbose export readonly && | -eu 2>/dev/null
+	$(pwd) 'quoted text' test --verbose
+sed local export ${HOME} | test "$1" readonly 'quoted text' local
+	| grep local "$@" readonly awk /usr/bin | x=1 /usr/bin awk readonly -eu echo export
+export export sed grep echo "$1" -eu -eu done echo test
+		--verbose grep && awk /usr/bin && x=1 test
+	&& 'quoted text' then --verbose grep -eu
+	-eu /usr/bin --verbose | export --verbose
+	"$1" readonly --verbose local "$1" grep printf
+		&& 2>/dev/null -eu sed | then test /usr/bin 'quoted text'
+	export done awk && done
+		printf --verbose sed /usr/bin readonly export cd | printf
+	local awk done "$1" test ${HOME} grep "$@" /usr/bin export --verbose $(pwd) then
+		export export sed "$1" 2>/dev/null local
+		local done 'quoted text' x=1 2>/dev/null cd printf grep /usr/bin grep
+	readonly sed done export test export grep x=1 --verbose x=1
+	grep "$@" 'quoted text' then test cd readonly then test 'quoted text'
+	awk test readonly echo sed local 'quoted text' $(pwd) done grep
+	test echo $(pwd) test | 2>/dev/null -eu grep "$1"
+		| $(pwd) printf "$@" printf printf awk test grep 'quoted text'
+		readonly readonly ${HOME} readonly
+		&& echo grep test 'quoted text' export
+cd awk | && | done 2>/dev/null x=1 done 'quoted text' -eu $(pwd) then
+		/usr/bin x=1 printf ${HOME} printf ${HOME} then "$1" readonly $(pwd) export
+		test $(pwd) readonly readonly
+		readonly | -eu && export 2>/dev/null export awk done 'quoted text'
+		done --verbose cd sed x=1 then
+		grep 2>/dev/null sed x=1 then sed export done done printf
+		grep export test done --verbose then | "$1" readonly printf $(pwd) cd done
+	cd readonly grep && --verbose printf --verbose sed /usr/bin $(pwd)
+		"$@" done sed $(pwd) done $(pwd) grep "$1" /usr/bin local -eu
+	readonly 'quoted text' cd
+then readonly x=1 "$1" sed echo -eu awk
+awk $(pwd) cd | "$@" test readonly 'quoted text' "$@"
+then readonly test $(pwd) -eu done 2>/dev/null
+	$(pwd) awk && -eu printf --verbose x=1
+		-eu cd done 2>/dev/null --verbose
+	--verbose printf $(pwd) "$1" test "$1" /usr/bin then --verbose
+		| readonly /usr/bin && ${HOME} echo -eu echo readonly
+	/usr/bin printf /usr/bin /usr/bin
+		$(pwd) 'quoted text' $(pwd) readonly x=1
+	&& 'quoted text' | echo awk
+	local sed export printf printf /usr/bin
+--verbose "$@" "$@" --verbose | then --verbose then -eu x=1 awk grep 2>/dev/null
+/usr/bin "$@" local echo awk grep "$@" done $(pwd) 'quoted text' done export
+	'quoted text' sed grep
+	export local "$@" /usr/bin printf cd sed printf printf export -eu /usr/bin
+readonly && local local echo --verbose "$1" test | $(pwd) x=1 x=1
+		readonly /usr/bin printf sed && && test | --verbose ${HOME} cd test local
+awk export -eu ${HOME}
+	"$@" done 2>/dev/null done "$1" -eu printf --verbose -eu "$@" then readonly
+	echo echo 'quoted text' awk printf echo printf readonly sed x=1 x=1 echo echo
+		2>/dev/null ${HOME} readonly -eu grep readonly ${HOME}
+/usr/bin $(pwd) done printf
+	--verbose x=1 awk local printf
+	cd ${HOME} local "$@" readonly &&
+	then "$1" --verbose && | && --verbose sed 2>/dev/null
+test grep ${HOME} sed readonly export && $(pwd) export "$1"
+		grep && grep readonly -eu "$@" --verbose x=1 $(pwd)
+		export sed | grep cd cd printf 'quoted text' sed "$1" cd done sed ${HOME} local
+		then "$1" x=1 2>/dev/null 'quoted text' local readonly
+	export x=1 $(pwd) "$1" done done
+export test ${HOME} awk 2>/dev/null
+${HOME} grep -eu export echo echo && ${HOME} grep printf
+readonly then cd 2>/dev/null 2>/dev/null
+		printf "$@" -eu grep && $(pwd)
+		export 'quoted text' ${HOME} cd export 2>/dev/null
+	"$@" $(pwd) local $(pwd) then "$@" echo awk ${HOME} && local done
+		done local && cd sed 'quoted text' 2>/dev/null awk grep printf cd 'quoted text'
+	sed readonly local x=1 "$@" "$@" export sed "$@" $(pwd)
+	2>/dev/null sed awk && sed grep echo -eu /usr/bin
+		export $(pwd) awk "$1" "$@"
+		export "$@" $(pwd) awk $(pwd) cd ${HOME} export test /usr/bin --verbose
+test x=1 ${HOME} grep export && 2>/dev/null awk --verbose then export $(pwd)
+		awk awk echo /usr/bin awk sed 2>/dev/null
+		x=1 cd done "$1" && awk /usr/bin printf /usr/bin
+	$(pwd) "$1" grep 2>/dev/null /usr/bin x=1 grep test then readonly
+	"$@" export /usr/bin "$1" && sed
+		sed ${HOME} then done $(pwd) grep -eu ${HOME} export $(pwd) sed
+		then export cd 'quoted text' printf test x=1
+		printf --verbose -eu grep export readonly awk 2>/dev/null $(pwd) readonly local
+"$1" 'quoted text' 2>/dev/null local "$@" then "$@" test sed
+"$@" cd then grep printf then echo 'quoted text' 'quoted text' /usr/bin && "$1"
+printf | test 'quoted text'
+		done test x=1 echo then printf x=1
+	/usr/bin | && test "$1" then grep
+export /usr/bin printf test test test $(pwd) then && grep && cd 'quoted text'
+		export && echo awk x=1 $(pwd) --verbose ${HOME} then 'quoted text' $(pwd)
+		2>/dev/null readonly sed printf /usr/bin -eu grep -eu readonly "$@" grep
+		test sed echo && x=1 echo 2>/dev/null sed awk export done echo -eu sed 2>/dev/null
+2>/dev/null local $(pwd) 2>/dev/null echo -eu "$@" export grep /usr/bin awk
+		$(pwd) x=1 x=1 "$@" sed ${HOME}
+	2>/dev/null echo && readonly
+		&& grep export cd test test test awk 2>/dev/null 'quoted text'
+		echo 2>/dev/null ${HOME} | --verbose readonly then printf sed ${HOME}
+	2>/dev/null then then x=1 awk
+		| then ${HOME} -eu local $(pwd) --verbose
+		-eu x=1 2>/dev/null readonly
+	"$@" $(pwd) ${HOME} x=1 2>/dev/null
+	-eu "$@" x=1 --verbose done local done && done && printf grep cd
+		echo ${HOME} ${HOME} grep sed --verbose
+	"$@" export | 'quoted text' grep readonly awk 'quoted text'
+		2>/dev/null -eu 2>/dev/null -eu
+		| test sed done then grep printf -eu ${HOME}
+		-eu "$1" "$@" x=1 echo 'quoted text' local 2>/dev/null then | 'quoted text'
+	x=1 --verbose echo then sed
+		$(pwd) $(pwd) "$1" 'quoted text'
+	x=1 -eu done "$@" $(pwd) done $(pwd) echo grep
+--verbose sed printf x=1 then $(pwd) export then printf
+		local "$@" test cd then
+awk cd then -eu printf
+	--verbose printf local "$1" "$1" -eu printf then local local cd 'quoted text'
+	&& printf ${HOME} 'quoted text' --verbose done --verbose $(pwd)
+		2>/dev/null local echo grep $(pwd) /usr/bin sed printf "$1"
+	"$1" echo | --verbose local /usr/bin x=1 sed done && && && local then
+$(pwd) awk printf readonly readonly printf echo /usr/bin
+'quoted text' -eu export $(pwd) && cd cd ${HOME} local printf -eu -eu
+	echo | awk printf "$1" readonly printf local
+		'quoted text' "$@" done -eu then /usr/bin printf x=1
+		x=1 done awk && x=1 sed --verbose
+	/usr/bin | done local && 2>/dev/null
+		readonly echo "$1" sed | export sed x=1 | -eu ${HOME} export /usr/bin 2>/dev/null
+		"$1" awk --verbose 2>/dev/null 'quoted text' "$@"
+	| awk && -eu "$1" readonly done done
+	x=1 printf export export echo
+	/usr/bin && 2>/dev/null printf ${HOME} test 'quoted text'
+		local --verbose awk $(pwd) printf x=1
+"$@" local done awk then "$1" "$@"
+	"$@" echo 2>/dev/null "$@" cd export -eu ${HOME} 'quoted text' test printf
+echo && --verbose x=1 done readonly
+		cd grep echo && done "$1" then | ${HOME}
+		x=1 then "$1" awk awk local export $(pwd) test 'quoted text' grep grep "$@"
+cd export awk 'quoted text' echo echo
+	2>/dev/null awk then && then echo ${HOME} test 'quoted text' readonly test 'quoted text'
+x=1 | sed test ${HOME} cd export && readonly readonly x=1
+	&& test export grep local $(pwd) local export printf readonly
+-eu | x=1 x=1 2>/dev/null "$@" echo
+$(pwd) | | --verbose readonly /usr/bin ${HOME} export sed sed ${HOME} awk --verbose
+	echo cd done -eu readonly 'quoted text' -eu
+	sed $(pwd) done "$1" readonly export 'quoted text'
+	readonly done | && $(pwd) | 'quoted text' --verbose export "$1"
+--verbose echo test /usr/bin
+cd ${HOME} --verbose echo 'quoted text' done
+	"$@" sed --verbose | --verbose sed test --verbose |
+	local export | -eu $(pwd) "$1"
+	test export 'quoted text' readonly "$@" && "$1"
+	test ${HOME} test 'quoted text' local readonly sed 'quoted text' -eu
+		2>/dev/null "$1" $(pwd) sed echo readonly test then echo
+	x=1 grep | cd readonly "$1" export test done 'quoted text' ${HOME} "$@"
+		local echo ${HOME} awk export
+	done -eu && export test done local export awk
+2>/dev/null echo local ${HOME} -eu grep "$1" 'quoted text'
+test | 2>/dev/null x=1 local x=1 ${HOME} /usr/bin readonly && && export readonly
+test "$1" sed then readonly --verbose
+	grep x=1 cd /usr/bin /usr/bin readonly cd 'quoted text'
+		export | $(pwd) local echo 2>/dev/null ${HOME}
+		then ${HOME} /usr/bin 'quoted text' | $(pwd) cd "$@" export
+printf && && $(pwd) | 'quoted text' local "$@"
+	/usr/bin readonly echo --verbose test sed
+sed $(pwd) | awk -eu done test --verbose export export export "$1" sed |
+	sed ${HOME} -eu then export grep echo export $(pwd) echo test 2>/dev/null -eu
+then ${HOME} grep echo "$@" awk local ${HOME} local cd $(pwd) echo x=1
+		local export "$1" --verbose local local ${HOME} done
+		done awk done then cd $(pwd) "$1" |
+${HOME} $(pwd) awk then "$1" x=1 "$1" --verbose readonly test
+		sed sed "$@" grep "$@" $(pwd) "$1" 2>/dev/null local then printf printf
+	grep | sed export then "$@" x=1 cd && test cd test sed printf /usr/bin
+echo $(pwd) -eu sed grep && cd "$1" grep x=1 printf export export --verbose test
+		cd ${HOME} test printf readonly -eu grep 'quoted text' then | /usr/bin
+		--verbose export $(pwd) local done printf ${HOME} readonly echo /usr/bin printf
+		x=1 'quoted text' local
+		--verbose cd x=1 done $(pwd) then "$1" --verbose sed 'quoted text' ${HOME}
+		awk cd -eu printf sed sed --verbose done local cd | x=1 'quoted text'
+then ${HOME} grep test awk 2>/dev/null ${HOME} export "$1" $(pwd) done "$@" sed
+	awk readonly printf printf 2>/dev/null
+	$(pwd) --verbose printf cd | && -eu printf
+		-eu 'quoted text' echo "$@" local
+	| printf done $(pwd) | ${HOME} 2>/dev/null
+		sed 'quoted text' export export
+		export -eu local done echo echo
+test --verbose cd readonly cd printf done /usr/bin echo cd "$1" | $(pwd)
+		cd ${HOME} 'quoted text' /usr/bin
+	test "$1" $(pwd) "$@" then export
+"$1" sed /usr/bin then awk -eu && awk x=1 export --verbose
+		grep then "$@" 2>/dev/null
+		export then grep -eu |
+		&& grep && cd done then $(pwd) cd && $(pwd) 2>/dev/null "$1" export then
+test ${HOME} test readonly readonly /usr/bin "$@" 2>/dev/null
+		/usr/bin x=1 && ${HOME} test
+"$@" 2>/dev/null test
+"$1" "$1" | echo /usr/bin
+		&& x=1 done cd | "$@" -eu export awk | printf test readonly "$@" 2>/dev/null
+&& | then "$1" x=1 -eu then test done local | test --verbose x=1 ${HOME} local
+		export /usr/bin 2>/dev/null -eu then
+	'quoted text' readonly grep local awk export ${HOME} readonly --verbose
+		printf 2>/dev/null ${HOME} "$1" 2>/dev/null then grep $(pwd)
+-eu local echo 2>/dev/null printf awk
+sed x=1 "$1" local -eu "$@" /usr/bin 2>/dev/null /usr/bin
+	grep && then "$@" local echo | "$@" -eu --verbose
+	x=1 readonly $(pwd) 'quoted text' export 2>/dev/null readonly $(pwd)
+		-eu && 'quoted text' export 2>/dev/null readonly awk sed /usr/bin | sed "$@" x=1
+	then test 'quoted text' sed ${HOME} && --verbose printf
+sed 'quoted text' local readonly export then $(pwd) readonly
+		| export done local sed sed then x=1 test then && echo /usr/bin
+readonly | 2>/dev/null awk x=1 cd "$1" -eu done echo awk $(pwd)
+		2>/dev/null 'quoted text' ${HOME} cd "$@" then | -eu readonly --verbose
+		"$1" /usr/bin awk local
+x=1 $(pwd) /usr/bin export --verbose $(pwd) done sed printf local --verbose
+	printf export done && readonly export then echo sed
+&& ${HOME} echo $(pwd) 2>/dev/null | export | export ${HOME}
+		test awk sed printf 2>/dev/null x=1 test "$1" -eu printf ${HOME} grep "$@" awk
+test test 2>/dev/null "$1" sed --verbose $(pwd)
+	awk done 2>/dev/null awk x=1 -eu readonly
+	-eu 2>/dev/null done $(pwd) grep local /usr/bin awk done -eu "$@"
+	done grep then 2>/dev/null "$@" "$@" awk cd
+		$(pwd) then sed grep sed && -eu export /usr/bin printf --verbose test readonly
+	"$@" readonly -eu sed local /usr/bin 2>/dev/null local readonly printf
+'quoted text' $(pwd) /usr/bin
+		&& 2>/dev/null | --verbose "$@" printf awk grep
+sed echo | ${HOME} sed x=1 /usr/bin && cd export "$@" readonly grep
+		/usr/bin --verbose && grep /usr/bin x=1 x=1 grep x=1
+	x=1 | --verbose done "$1" grep -eu local && $(pwd)
+sed "$1" test cd awk printf 2>/dev/null done export
+		"$@" | | ${HOME} local done
+	$(pwd) cd export awk export then echo echo test sed grep 2>/dev/null
+	x=1 "$1" printf printf test test printf
+		x=1 ${HOME} 2>/dev/null "$1"
+readonly --verbose 'quoted text' ${HOME} done echo cd sed /usr/bin
+	-eu 2>/dev/null done --verbose
+| done -eu && printf --verbose test test readonly local
+grep && printf x=1 printf test x=1 cd cd
+	$(pwd) ${HOME} test x=1 -eu 'quoted text' /usr/bin readonly | ${HOME} test
+		cd export cd && test then sed grep "$1" -eu
+		export awk $(pwd) x=1 awk x=1 awk done printf grep | /usr/bin local awk done
+	"$@" printf awk done ${HOME} ${HOME} echo echo x=1 echo $(pwd) sed "$1" then
+	| && done 2>/dev/null sed cd cd local export cd echo readonly ${HOME}
+	printf readonly grep echo --verbose
+local $(pwd) grep x=1 'quoted text' x=1 'quoted text'
+		local awk local 2>/dev/null cd | awk readonly cd --verbose sed
+		printf sed sed $(pwd) awk 2>/dev/null "$@" $(pwd) --verbose ${HOME} done
+	sed "$@" then export --verbose "$@" /usr/bin
+'quoted text' && local && then sed grep && /usr/bin
+/usr/bin cd test "$1" export $(pwd) && then $(pwd) grep printf /usr/bin
+&& test 'quoted text' awk test /usr/bin
+		export readonly "$@" cd local sed "$1" awk cd cd test sed && ${HOME}
+echo done awk 'quoted text'
+"$@" export cd && x=1 && 'quoted text' /usr/bin
+	sed 2>/dev/null echo echo local 'quoted text'
+done echo x=1 awk then x=1
+	-eu grep --verbose | echo then awk done -eu "$@" /usr/bin then 'quoted text'
+echo sed ${HOME} local /usr/bin "$@" --verbose
+sed /usr/bin | sed -eu $(pwd)
+		/usr/bin --verbose | 'quoted text' cd sed printf "$1"
+readonly local $(pwd) --verbose sed local readonly | local --verbose printf readonly
+	-eu grep && sed echo grep
+"$1" then test "$1" cd done then export printf grep grep
+		'quoted text' "$1" printf grep awk /usr/bin 2>/dev/null cd 'quoted text'
+-eu | x=1 test export "$@" "$@"
+'quoted text' cd --verbose "$@"
+		awk /usr/bin cd && "$@" echo 'quoted text' "$1" awk /usr/bin
+| $(pwd) then sed readonly x=1 --verbose then
+		x=1 test ${HOME} $(pwd) export readonly /usr/bin "$@" &&
+	grep x=1 echo printf $(pwd) && $(pwd) 2>/dev/null readonly
+	x=1 2>/dev/null "$1" echo "$1" printf x=1 -eu &&
+	$(pwd) | printf 'quoted text' readonly
+		2>/dev/null -eu x=1 done
+&& --verbose && then done cd local "$1" && cd sed "$@" sed --verbose x=1
+		printf printf 'quoted text' done $(pwd) printf echo then then --verbose x=1
+		test && echo test export
+sed 'quoted text' $(pwd) awk echo then then && done sed grep /usr/bin
+printf cd done printf printf ${HOME} sed /usr/bin
+export grep 'quoted text' readonly printf
+	"$@" x=1 cd --verbose && grep --verbose sed 2>/dev/null
+	| then readonly "$@" /usr/bin done $(pwd) sed then
+		$(pwd) local printf /usr/bin test 2>/dev/null
+readonly grep /usr/bin -eu sed -eu done then done -eu export export awk -eu 2>/dev/null
+	/usr/bin --verbose 2>/dev/null 'quoted text' echo ${HOME} echo export
+readonly readonly then ${HOME}
+sed echo 'quoted text' ${HOME} 'quoted text'
+	"$@" grep 'quoted text' --verbose sed cd export export test
+		done --verbose readonly sed local
+readonly $(pwd) test awk x=1 2>/dev/null "$1"
+		&& -eu cd readonly ${HOME} done test | printf $(pwd) local echo
+"$1" 2>/dev/null cd /usr/bin /usr/bin readonly && "$1" 2>/dev/null test
+		cd $(pwd) 'quoted text' grep 'quoted text' sed "$@"
+export 'quoted text' ${HOME} local cd readonly done | test
+	${HOME} test readonly done --verbose cd | -eu x=1
+awk --verbose $(pwd) local export echo | "$@" /usr/bin -eu x=1 local
+		-eu printf printf local ${HOME} /usr/bin local done 2>/dev/null
+		readonly export then test /usr/bin 2>/dev/null
+	cd /usr/bin done $(pwd) && -eu /usr/bin 'quoted text' export cd ${HOME}
+		export echo 'quoted text' done
+cd test ${HOME} -eu ${HOME} echo printf --verbose local
+		--verbose local "$1" 'quoted text' readonly --verbose && --verbose awk "$1"
+	x=1 test printf grep cd local export readonly --verbose awk test
+		${HOME} awk && cd printf done readonly
+readonly done local awk -eu awk 2>/dev/null | local
+done done /usr/bin | ${HOME} 2>/dev/null ${HOME} && "$1" sed cd -eu export ${HOME}
+		cd -eu done | export 2>/dev/null 'quoted text' awk | -eu printf | 'quoted text'
+	&& cd | x=1 2>/dev/null then /usr/bin | 'quoted text'
+		2>/dev/null echo 2>/dev/null printf 2>/dev/null grep then then sed $(pwd) printf
+		echo "$@" readonly export sed $(pwd) cd local echo
+		printf -eu readonly $(pwd) 'quoted text'
+local && | readonly --verbose "$1" "$@" -eu x=1 echo ${HOME} then test cd
+	-eu grep then $(pwd) awk local printf "$1" /usr/bin
+$(pwd) cd printf grep
+"$@" x=1 2>/dev/null sed ${HOME} readonly ${HOME}
+	cd cd x=1 "$1" grep --verbose
+local cd ${HOME} awk awk awk ${HOME} /usr/bin grep
+sed sed "$1" -eu then 2>/dev/null "$@" export awk 2>/dev/null awk ${HOME}
+	'quoted text' $(pwd) sed -eu cd export grep then && readonly
+		readonly "$@" readonly cd | then $(pwd) sed 'quoted text' && "$1" test grep
+	grep && 'quoted text' "$1" | then 2>/dev/null
+export $(pwd) "$1" -eu awk 2>/dev/null test cd x=1
+		/usr/bin "$1" | export sed && && $(pwd) done done | grep echo
+	&& 'quoted text' x=1 &&
+	"$@" export && awk printf 'quoted text' sed
+	${HOME} echo echo printf then done cd 2>/dev/null local
+x=1 sed then 'quoted text' 'quoted text' && export && ${HOME}
+		'quoted text' "$@" && --verbose done $(pwd) 'quoted text'
+	readonly 'quoted text' then $(pwd) && printf
+	$(pwd) echo printf then 2>/dev/null
+	grep /usr/bin readonly $(pwd) then grep grep test --verbose ${HOME} ${HOME}
+	"$@" test ${HOME} cd && $(pwd) awk export -eu 2>/dev/null
+	-eu "$1" && x=1 echo printf done local local /usr/bin
+x=1 echo ${HOME} | awk --verbose grep
+	'quoted text' 2>/dev/null $(pwd) 'quoted text' 'quoted text' export 'quoted text'
+		sed sed sed done echo $(pwd) local --verbose grep x=1 && "$@" --verbose
+	printf 2>/dev/null 'quoted text' $(pwd) && local
+awk test echo /usr/bin 'quoted text'
+cd local export done 2>/dev/null
+		done /usr/bin export x=1 export grep x=1
+		$(pwd) -eu grep readonly ${HOME} -eu "$@"
+--verbose readonly awk export echo test grep $(pwd) "$1" done readonly
+		test x=1 sed sed "$@" cd "$@" cd then "$@" 2>/dev/null
+		local awk test ${HOME} readonly sed /usr/bin
+		local /usr/bin -eu && local x=1 echo 'quoted text' /usr/bin | export 'quoted text'
+	awk export cd printf readonly && printf
+	&& 2>/dev/null $(pwd) done "$1" export test test 2>/dev/null
+cd --verbose -eu done x=1 local local then local export &&
+		readonly /usr/bin /usr/bin echo ${HOME} $(pwd)
+		awk x=1 cd /usr/bin grep ${HOME} ${HOME} echo 'quoted text' awk done
+		x=1 --verbose local export && readonly done sed && --verbose
+		test $(pwd) then cd local && local sed
+		cd x=1 awk export export 2>/dev/null "$1" "$@" --verbose --verbose --verbose
+	grep printf grep -eu done 2>/dev/null ${HOME} "$1" then 2>/dev/null
+test -eu grep test readonly ${HOME}
+		--verbose 2>/dev/null 'quoted text' --verbose test sed then && readonly
+awk "$@" /usr/bin 2>/dev/null then ${HOME} sed -eu local
+		-eu export "$1" | then ${HOME} "$@" echo then
+		"$@" ${HOME} cd local "$1" done readonly "$@" ${HOME}
+	sed cd readonly readonly --verbose done -eu cd 2>/dev/null
+	done then echo printf then $(pwd)
+		local $(pwd) | export then --verbose /usr/bin printf x=1 readonly test
+readonly then local awk grep test | grep "$1" 2>/dev/null "$@"
+	"$1" 'quoted text' | ${HOME} then ${HOME} && then sed printf cd x=1 --verbose
+	x=1 /usr/bin | printf 2>/dev/null
+	printf ${HOME} -eu x=1 export
+done export done | 2>/dev/null echo ${HOME} --verbose && $(pwd)
+--verbose /usr/bin x=1 ${HOME} | awk export cd
+		x=1 ${HOME} echo export cd export 2>/dev/null -eu readonly x=1 local 'quoted text'
+		2>/dev/null grep 'quoted text' -eu sed -eu cd done --verbose
+	-eu grep then x=1 x=1 $(pwd) "$1" --verbose "$@" export test echo echo "$1"
+	/usr/bin -eu export "$@" printf printf -eu /usr/bin 2>/dev/null local
+		x=1 awk 'quoted text' echo x=1 "$@" "$1" | 2>/dev/null && | local
+x=1 test $(pwd) "$1" awk cd "$@" done sed printf "$@" "$1" "$1" | -eu readonly
+2>/dev/null 'quoted text' x=1 /usr/bin 'quoted text'
+sed echo printf then $(pwd) x=1 $(pwd) "$@" then printf export echo -eu "$1" |
+then && export sed /usr/bin x=1 -eu && ${HOME} "$@"
+	-eu /usr/bin && 2>/dev/null test done --verbose sed x=1 echo
+		"$@" --verbose -eu && 2>/dev/null then "$@" grep readonly --verbose
+cd 2>/dev/null awk "$1" "$@"
+		readonly 'quoted text' test readonly cd then done -eu --verbose x=1 test
+		"$@" printf $(pwd) printf echo x=1 "$@" x=1 echo sed $(pwd) "$@"
+| printf 2>/dev/null readonly cd 'quoted text' test cd "$1" --verbose
+	2>/dev/null local awk test 'quoted text' local
+	awk 2>/dev/null export "$1" && /usr/bin
+	test then done "$@" 'quoted text' -eu --verbose ${HOME} printf awk "$@"
+		2>/dev/null ${HOME} /usr/bin 'quoted text' $(pwd) 2>/dev/null readonly $(pwd)
+$(pwd) local x=1 readonly "$@" awk x=1 /usr/bin
+--verbose export 'quoted text'
+done echo 2>/dev/null echo | ${HOME} printf "$1" |
+--verbose -eu "$@" export --verbose local x=1 ${HOME} 'quoted text' printf cd
+		awk echo awk && $(pwd)
+x=1 readonly cd x=1 cd && $(pwd) ${HOME}
+		"$1" test x=1 awk "$@" echo echo 2>/dev/null
+		readonly x=1 sed /usr/bin export readonly grep readonly sed
+test $(pwd) then ${HOME} test cd 2>/dev/null grep
+	/usr/bin "$1" test sed grep export -eu && "$1"
+		done local local sed
+		export x=1 "$1" cd printf $(pwd) 'quoted text' readonly export /usr/bin --verbose
+		2>/dev/null --verbose "$@"
+	sed "$1" "$@" --verbose done /usr/bin printf -eu awk
+		grep sed test --verbose
+		"$1" export echo -eu | -eu "$1" ${HOME} --verbose && local
+		export "$@" awk ${HOME} -eu then grep export
+	-eu printf cd done done awk
+	'quoted text' local "$@" printf
+	cd printf test test cd 'quoted text' 2>/dev/null --verbose
+sed local test x=1 printf /usr/bin x=1 $(pwd) "$1" --verbose 'quoted text' "$@"
+		sed x=1 printf readonly --verbose | cd
+		local && && export echo done readonly
+cd awk then -eu local readonly echo then printf cd cd "$@" "$@" then
+"$1" test grep awk readonly "$1" done then cd 2>/dev/null then $(pwd) local
+"$@" x=1 printf /usr/bin export
+"$@" "$1" test x=1 awk grep test done
+		"$@" 'quoted text' 'quoted text' cd
+	sed -eu then readonly test -eu ${HOME}
+| -eu x=1 local awk 'quoted text'
+	echo echo 2>/dev/null "$@" done local && "$1" ${HOME} /usr/bin
+-eu cd sed sed grep awk 2>/dev/null x=1
+		readonly sed grep --verbose x=1 readonly readonly done awk 2>/dev/null
+		&& then -eu "$@" echo local -eu grep local awk export
+	x=1 local /usr/bin export $(pwd) export -eu sed grep 'quoted text'
+/usr/bin 2>/dev/null /usr/bin --verbose readonly
+local 'quoted text' ${HOME}
+local export 'quoted text' && sed $(pwd) $(pwd)
+		2>/dev/null export echo "$@" local
+		x=1 sed sed sed echo -eu test local then | 'quoted text' done sed grep "$1" --verbose
+then cd 'quoted text' /usr/bin export awk -eu echo /usr/bin done ${HOME} 2>/dev/null
+"$@" x=1 test awk x=1 awk $(pwd) --verbose && /usr/bin
+	echo sed then /usr/bin "$@" | 'quoted text'
+		grep export && -eu awk local sed
+		echo printf awk 2>/dev/null "$@" | grep
+	2>/dev/null sed && 'quoted text' echo local cd sed echo echo export
+		-eu ${HOME} printf -eu local "$@" cd -eu | ${HOME}
+	cd 2>/dev/null readonly readonly readonly local grep readonly grep done local
+		test --verbose $(pwd) test echo "$1"
+$(pwd) printf /usr/bin $(pwd) readonly 2>/dev/null
+		test 'quoted text' --verbose x=1 /usr/bin test printf "$@"
+local /usr/bin "$1" "$1" | then -eu done printf "$1" sed sed
+	"$@" printf /usr/bin done test local &&
+		'quoted text' then printf printf ${HOME}
+		done "$1" && -eu export 'quoted text' echo
+		&& readonly echo test $(pwd) x=1 grep "$@" | ${HOME} && && -eu local
+	grep cd 'quoted text' && then local test -eu x=1 "$@" sed "$1" test printf
+	test test grep "$1" "$@" awk export echo echo echo -eu x=1 "$1" $(pwd) 2>/dev/null
+		| "$1" 2>/dev/null 2>/dev/null grep "$@" && $(pwd) 'quoted text'
+	then echo 2>/dev/null "$@" -eu "$1" && printf awk
+		'quoted text' cd echo && "$1"
+	-eu echo "$1" && --verbose
+		2>/dev/null /usr/bin test then then sed sed
+${HOME} "$1" printf cd sed -eu then printf 2>/dev/null
+		2>/dev/null -eu -eu sed /usr/bin /usr/bin --verbose readonly
+$(pwd) readonly --verbose then printf ${HOME} 2>/dev/null "$@" export
+grep awk cd test sed local test x=1 'quoted text' sed $(pwd)
+'quoted text' /usr/bin "$1" ${HOME} cd 2>/dev/null
+&& $(pwd) printf ${HOME} "$@" awk x=1 export 'quoted text'
+echo test grep done awk grep
+		"$@" test test 2>/dev/null
+		echo /usr/bin -eu local $(pwd)
+		cd "$@" /usr/bin awk --verbose "$1" grep then export
+	&& "$1" grep printf echo -eu "$1" cd && cd readonly then "$1" then "$1"
+awk | local $(pwd) "$@" sed $(pwd) readonly | grep ${HOME} sed printf
+		done 'quoted text' local 2>/dev/null -eu grep export $(pwd) 2>/dev/null &&
+export "$1" "$@" | test echo export /usr/bin
+	${HOME} --verbose "$1" "$1" $(pwd) /usr/bin "$@" done echo | --verbose "$@" -eu
+		--verbose sed && echo
+	grep then cd /usr/bin test x=1
+		'quoted text' cd 'quoted text' -eu -eu test --verbose "$@" export cd 'quoted text'
+		local 2>/dev/null grep ${HOME} "$@" $(pwd) "$1" export 'quoted text'
+printf then $(pwd) | | done && echo $(pwd) /usr/bin $(pwd) readonly
+	grep local done cd | printf echo done readonly x=1 --verbose echo sed &&
+		"$1" -eu 'quoted text' printf ${HOME} test
+		"$1" -eu local test 2>/dev/null grep x=1 cd 2>/dev/null awk test
+	x=1 awk ${HOME} "$1" cd 2>/dev/null 2>/dev/null export
+done --verbose | test printf x=1 grep export $(pwd) done sed done echo --verbose
+		local local ${HOME} -eu done
+	export /usr/bin then "$@" done echo export echo "$@" $(pwd)
+	2>/dev/null /usr/bin export cd ${HOME} ${HOME} "$@" && cd cd
+	--verbose cd && "$1" /usr/bin echo ${HOME} | done "$@" $(pwd) | 'quoted text'
+"$@" awk ${HOME} echo local 'quoted text'
+		done cd "$@" "$1" | --verbose
+	"$@" test test && echo $(pwd) sed 'quoted text'
+	/usr/bin echo awk echo 2>/dev/null $(pwd) test x=1 x=1 | 'quoted text' --verbose
+export echo --verbose printf
+	test then 2>/dev/null export sed x=1 export test "$1" printf 2>/dev/null
+/usr/bin echo grep cd --verbose
+		readonly grep --verbose
+		'quoted text' && --verbose echo "$1"
+	$(pwd) sed printf x=1 test && x=1 cd "$1" done "$1" x=1 "$1" --verbose
+		sed x=1 x=1 local "$@" &&
+	local readonly 'quoted text' $(pwd) cd sed sed ${HOME} "$@" test
+		sed "$@" 'quoted text' $(pwd) 2>/dev/null echo awk readonly done ${HOME} &&
+	sed && done x=1 cd sed --verbose $(pwd)
+	&& sed done done | ${HOME} echo 'quoted text' export 2>/dev/null
+		--verbose ${HOME} "$@" awk readonly cd && --verbose
+	then /usr/bin printf test /usr/bin | | printf
+awk /usr/bin 'quoted text' | -eu local
+	'quoted text' test cd ${HOME} export ${HOME} test -eu printf echo --verbose
+		sed grep ${HOME} echo x=1 test
+	awk x=1 test cd --verbose test cd 'quoted text' 2>/dev/null | |
+	sed cd grep x=1 sed cd "$@" done "$1"
+	awk "$@" echo ${HOME} | local $(pwd) test sed 2>/dev/null "$@" printf 'quoted text'
+		x=1 && "$1" ${HOME} 'quoted text' x=1 local && echo -eu done then && 2>/dev/null
+	2>/dev/null printf export export --verbose ${HOME} ${HOME}
+	&& ${HOME} 2>/dev/null then sed 'quoted text' readonly $(pwd) $(pwd)
+		sed readonly | ${HOME} /usr/bin cd grep -eu readonly 'quoted text'
+		x=1 $(pwd) echo printf x=1 | /usr/bin "$1"
+	export "$1" "$@" -eu /usr/bin $(pwd) 'quoted text' then grep
+--verbose cd printf cd 'quoted text'
+		2>/dev/null /usr/bin 2>/dev/null
+&& awk "$@" && 'quoted text' printf /usr/bin then sed printf 'quoted text'
+awk cd /usr/bin then readonly printf readonly test
+	&& test cd --verbose
+		sed $(pwd) x=1 printf "$@" then test "$1" sed "$1" |
+'quoted text' cd | "$1"
+	/usr/bin awk awk test readonly "$@" awk --verbose x=1
+		printf x=1 && "$@" ${HOME} cd awk $(pwd) export 2>/dev/null /usr/bin /usr/bin
+readonly "$1" echo ${HOME} test
+	"$@" done 2>/dev/null ${HOME} test done test readonly x=1 "$@" export echo
+"$@" done 2>/dev/null && --verbose 'quoted text' --verbose sed
+	${HOME} export -eu "$1" x=1 /usr/bin $(pwd) then /usr/bin test sed then then
+		/usr/bin test | cd local grep --verbose x=1 then /usr/bin
+test --verbose ${HOME} /usr/bin 'quoted text' "$1" done sed 'quoted text'
+grep awk test local | /usr/bin then -eu /usr/bin done
+	awk --verbose echo x=1 --verbose printf readonly readonly && | cd printf 2>/dev/null
+	--verbose echo cd awk done && ${HOME} -eu printf export
+2>/dev/null | | sed echo readonly 'quoted text' -eu && local
+		awk echo "$1" test | cd printf
+	"$@" /usr/bin sed awk /usr/bin awk && "$1" printf $(pwd) sed 'quoted text' "$@"
+--verbose test grep local done export
+		then printf done then /usr/bin /usr/bin "$1" ${HOME} 'quoted text'
+	sed grep awk && echo done
+		local local $(pwd) echo printf cd echo 2>/dev/null 'quoted text' printf "$1"
+		${HOME} export test echo awk export
+	${HOME} && grep "$1" && then 2>/dev/null
+		x=1 'quoted text' export /usr/bin
+grep printf 2>/dev/null cd 2>/dev/null cd $(pwd)
+	-eu export done ${HOME} then printf test
+		test "$1" "$1" sed cd sed done export grep then ${HOME} 'quoted text'
+readonly echo echo && /usr/bin && && /usr/bin ${HOME} x=1 cd | --verbose
+	${HOME} /usr/bin printf $(pwd) done --verbose /usr/bin echo -eu cd
+		/usr/bin done /usr/bin "$@" "$@" ${HOME} printf $(pwd) grep
+local grep && | done cd awk test ${HOME}
+echo && test && printf done /usr/bin --verbose 2>/dev/null
+		$(pwd) export --verbose 2>/dev/null -eu $(pwd) x=1 "$1" $(pwd) echo /usr/bin "$1"
+--verbose --verbose then
+	/usr/bin | "$@" local 2>/dev/null "$1" | cd export echo 'quoted text' | && cd
+	$(pwd) /usr/bin readonly grep cd echo printf /usr/bin &&
+	$(pwd) test readonly $(pwd) test done
+awk test "$@" 2>/dev/null cd grep then echo awk grep
+	"$@" grep x=1 sed echo sed --verbose "$@" awk ${HOME} grep echo test $(pwd)
+readonly cd ${HOME} awk test test awk && printf test grep
+	"$@" && 2>/dev/null local printf 2>/dev/null
+		test "$@" echo x=1 "$@" local && "$@" && "$1" local printf cd && --verbose
+	done "$@" then then $(pwd) echo ${HOME} echo
+done | ${HOME} export cd "$1" then sed cd sed x=1 echo 'quoted text'
+-eu | -eu then export local done test cd test "$1" readonly local "$1" -eu
@@ -0,0 +1,2001 @@
+local "$1" -eu readonly x=1 test x=1 done "$@" ${HOME} /usr/bin "$1" cd && "$1"
+--verbose cd then readonly cd sed 2>/dev/null then 'quoted text' echo
+		$(pwd) && done export 2>/dev/null 'quoted text' printf 'quoted text'
+		"$1" cd "$1" -eu && local printf "$1" "$1"
+		x=1 --verbose --verbose "$1" --verbose export "$@" $(pwd) local "$@" readonly
+'quoted text' cd grep export awk sed cd local
+	${HOME} echo 2>/dev/null "$@"
+	&& local && ${HOME} readonly -eu ${HOME} export
+"$1" readonly done | $(pwd) then "$@" grep
+&& sed ${HOME} | 2>/dev/null cd done cd $(pwd) --verbose /usr/bin local
+		echo 'quoted text' 2>/dev/null cd
+	| test sed readonly "$1" && 'quoted text' $(pwd)
+		x=1 --verbose done ${HOME} echo done sed cd ${HOME} sed printf export
+	cd "$1" --verbose /usr/bin --verbose
+export --verbose grep export cd && export readonly --verbose x=1
+		local -eu "$1" $(pwd) readonly echo grep -eu x=1 -eu 'quoted text' 2>/dev/null
+	x=1 test "$1" awk x=1 2>/dev/null 2>/dev/null echo printf done echo export sed
+	/usr/bin "$@" ${HOME} --verbose
+/usr/bin ${HOME} x=1 'quoted text' echo
+	readonly /usr/bin awk test
+-eu "$@" echo --verbose done cd cd readonly cd readonly
+printf sed "$@" done "$@" && "$1"
+		| sed --verbose && printf $(pwd) sed readonly then && readonly
+		"$1" --verbose x=1 $(pwd) cd | awk echo test --verbose 'quoted text' export
+	test then -eu readonly x=1 "$@" ${HOME} then cd cd x=1 awk export grep
+printf $(pwd) awk "$1" --verbose cd -eu printf
+-eu $(pwd) -eu grep cd awk export test "$@" export "$1" && "$@"
+		"$1" local "$1" echo then export sed echo readonly | $(pwd) &&
+	sed 2>/dev/null done then cd test && x=1 ${HOME} "$1" readonly
+${HOME} 'quoted text' /usr/bin local | cd local
+"$@" | local --verbose x=1 2>/dev/null echo --verbose x=1
+then printf | then done readonly printf x=1 -eu cd cd cd awk readonly
+	awk readonly --verbose export local readonly
+local printf 'quoted text' 'quoted text' then 2>/dev/null done export echo 'quoted text'
+	'quoted text' done readonly printf test local awk grep echo
+awk local test local readonly --verbose
+done local local /usr/bin local -eu awk -eu "$1" then ${HOME} --verbose export
+x=1 'quoted text' export && 2>/dev/null $(pwd) | && x=1 echo readonly grep
+	readonly readonly local local ${HOME} readonly && done $(pwd)
+	test test grep printf sed $(pwd) -eu --verbose $(pwd)
+echo cd 'quoted text' then test "$1" $(pwd) echo test ${HOME} local readonly cd
+	'quoted text' done $(pwd) 2>/dev/null test printf then echo 2>/dev/null
+	x=1 --verbose "$@" printf export && "$@" && then /usr/bin grep sed echo
+	done x=1 /usr/bin test then -eu test "$@" 'quoted text'
+		$(pwd) "$1" x=1 local local /usr/bin ${HOME}
+	x=1 --verbose && --verbose $(pwd) printf
+		test 'quoted text' --verbose -eu /usr/bin "$1" grep x=1 'quoted text' 'quoted text'
+	'quoted text' ${HOME} printf /usr/bin && ${HOME} export sed done
+	then /usr/bin $(pwd) readonly | && local && --verbose readonly
+		test 'quoted text' test done grep 2>/dev/null "$@" "$1" sed
+	then /usr/bin $(pwd) export "$1" awk -eu "$1"
+export cd export readonly
+"$@" readonly echo -eu local
+| -eu local export 2>/dev/null export local local readonly
+	grep ${HOME} /usr/bin $(pwd) sed
+&& then 'quoted text' "$@" --verbose --verbose
+	cd sed grep $(pwd) awk
+	${HOME} then && local readonly 2>/dev/null 2>/dev/null "$@" sed
+	echo awk grep && -eu && sed grep x=1 'quoted text' |
+	grep readonly | export 'quoted text' && printf awk grep 'quoted text' sed &&
+grep then done $(pwd) done
+-eu 2>/dev/null "$1" && -eu done grep
+2>/dev/null local | then readonly grep | sed ${HOME} "$1"
+	cd test "$@" test local $(pwd) $(pwd) grep echo -eu
+awk x=1 ${HOME} --verbose
+	awk test awk /usr/bin --verbose ${HOME}
+		"$@" readonly export --verbose && readonly export done ${HOME} | printf
+x=1 x=1 $(pwd) test "$@" then /usr/bin test readonly /usr/bin
+	2>/dev/null local | x=1 cd
+		2>/dev/null 'quoted text' echo export test awk then 'quoted text'
+/usr/bin | cd -eu 'quoted text'
+echo 2>/dev/null printf x=1 printf
+${HOME} echo awk then
+	"$1" done --verbose $(pwd) done then x=1 grep $(pwd) awk readonly
+		"$1" /usr/bin printf $(pwd) && | export then cd test export then && --verbose
+		--verbose x=1 sed awk test
+	| ${HOME} awk then cd | awk sed /usr/bin done local grep "$@" "$@" && -eu
+		&& ${HOME} export awk --verbose x=1 readonly $(pwd)
+	cd 2>/dev/null test 'quoted text' then cd grep then readonly
+/usr/bin done x=1 ${HOME} "$1" x=1 awk sed awk /usr/bin
+	readonly 2>/dev/null awk 'quoted text' echo --verbose $(pwd)
+		sed $(pwd) export printf | 'quoted text' 'quoted text'
+done "$@" then sed ${HOME} "$1" 'quoted text' test | 'quoted text'
+		then grep 2>/dev/null "$@" && "$@" 'quoted text' test local done then test
+	done "$1" local --verbose x=1 echo printf then cd echo readonly ${HOME}
+		then local test "$1"
+	test grep sed ${HOME} --verbose "$1" awk
+grep sed grep x=1 --verbose export
+		grep --verbose -eu grep x=1 done export
+		$(pwd) | | echo test --verbose /usr/bin awk awk
+	"$@" readonly ${HOME} cd echo x=1 | 2>/dev/null
+		done sed readonly test x=1 grep test "$1" readonly -eu awk
+	"$1" "$@" x=1 cd | local sed && export 2>/dev/null
+		then | ${HOME} awk sed | | grep 'quoted text' /usr/bin awk 2>/dev/null
+	${HOME} done && x=1 grep && ${HOME} "$@" grep 'quoted text' grep echo
+&& 2>/dev/null /usr/bin local -eu -eu /usr/bin -eu printf "$@" local then sed
+sed 2>/dev/null then | export sed --verbose && | "$1" | grep cd then | awk test
+${HOME} local /usr/bin 'quoted text' readonly
+	readonly done grep 2>/dev/null /usr/bin
+	--verbose then 'quoted text' ${HOME} cd local sed
+		cd "$@" 2>/dev/null awk export local done
+		local grep $(pwd) /usr/bin --verbose /usr/bin "$@" readonly --verbose "$1" cd
+x=1 export 2>/dev/null done readonly 'quoted text' "$@" awk
+"$@" ${HOME} "$1" "$1" && readonly export
+sed then then export sed readonly export then -eu test local grep | ${HOME} 2>/dev/null
+		test ${HOME} local 'quoted text' then sed "$@" $(pwd) cd /usr/bin -eu -eu
+	done test 2>/dev/null readonly | --verbose local && readonly "$1"
+		&& local cd awk && then 2>/dev/null "$1" test 'quoted text'
+		"$1" test --verbose then ${HOME} $(pwd)
+		cd test done -eu grep -eu then echo export
+	| local test grep 2>/dev/null 2>/dev/null local "$@" | -eu grep --verbose
+	x=1 cd done done "$1" cd $(pwd) readonly then
+test -eu awk 2>/dev/null 2>/dev/null /usr/bin 2>/dev/null 2>/dev/null "$@"
+	${HOME} -eu && sed | | x=1 readonly -eu local
+		awk then awk test | test -eu $(pwd) /usr/bin test grep $(pwd)
+	-eu 'quoted text' awk | awk x=1 cd 2>/dev/null /usr/bin "$1"
+	/usr/bin "$@" ${HOME} readonly printf
+then ${HOME} 2>/dev/null echo test $(pwd) echo readonly then "$1"
+	&& 'quoted text' local 2>/dev/null sed /usr/bin && grep readonly 'quoted text'
+		&& ${HOME} "$1" $(pwd) local 'quoted text'
+	echo "$1" "$@" 'quoted text' && grep x=1 echo "$@"
+	&& export "$1" x=1 $(pwd) --verbose
+| 'quoted text' -eu -eu done printf
+		"$1" && /usr/bin x=1 "$1" 2>/dev/null --verbose 2>/dev/null && done -eu 'quoted text'
+	export x=1 done /usr/bin "$1" $(pwd) sed && awk readonly
+/usr/bin test printf $(pwd) 2>/dev/null $(pwd) -eu then then printf
+		test then test /usr/bin local
+		"$1" "$@" "$@" "$1" echo awk /usr/bin
+readonly readonly readonly | cd x=1 --verbose $(pwd) then awk "$@"
+export "$1" awk -eu "$@" ${HOME} 2>/dev/null then then
+	${HOME} awk 'quoted text' cd && local sed -eu ${HOME} done echo readonly local
+2>/dev/null x=1 grep | ${HOME} 2>/dev/null awk done sed /usr/bin "$1" ${HOME}
+		local grep "$@" sed sed -eu then done 'quoted text'
+	-eu echo -eu | "$1" -eu ${HOME}
+		'quoted text' --verbose "$@" 'quoted text' -eu local printf -eu
+	| grep local sed echo test | 2>/dev/null readonly readonly
+		printf ${HOME} readonly readonly grep 'quoted text'
+		"$@" cd 2>/dev/null local
+x=1 done grep "$1" && $(pwd)
+		| echo ${HOME} echo local export export local 2>/dev/null "$1" done && 'quoted text'
+local | 'quoted text' export readonly test
+	'quoted text' $(pwd) x=1 'quoted text'
+		local -eu printf x=1 printf then export
+	/usr/bin awk export $(pwd) x=1 && then
+"$1" ${HOME} cd -eu grep cd
+	"$@" "$1" 2>/dev/null --verbose --verbose grep x=1 -eu test "$@" done
+		local readonly grep echo local echo printf "$@"
+then 2>/dev/null echo "$@" then 'quoted text' $(pwd)
+	$(pwd) export 'quoted text' echo ${HOME} ${HOME} ${HOME} "$@" /usr/bin
+test /usr/bin && export then | printf --verbose sed "$1" /usr/bin
+		${HOME} done cd $(pwd) /usr/bin "$1" x=1
+		--verbose -eu sed then && grep ${HOME} -eu local && grep $(pwd) readonly
+	sed -eu then echo 'quoted text' readonly | --verbose printf awk grep x=1 sed
+	export 2>/dev/null | 2>/dev/null then awk "$@"
+| 'quoted text' --verbose test readonly awk --verbose --verbose
+		'quoted text' awk printf --verbose "$@" export /usr/bin echo echo
+		x=1 export test grep export 'quoted text'
+		'quoted text' x=1 /usr/bin export -eu export ${HOME} sed "$@" x=1
+	test x=1 printf 2>/dev/null echo printf
+	sed grep cd 'quoted text' "$1" export local awk ${HOME} /usr/bin grep
+	sed 2>/dev/null awk awk $(pwd) grep then printf local cd ${HOME} printf
+	export grep -eu echo then 'quoted text'
+	${HOME} cd sed then cd x=1 export /usr/bin 2>/dev/null x=1
+	'quoted text' done -eu export | 'quoted text' $(pwd) test cd cd $(pwd)
+		test x=1 && test echo local test then local
+readonly done && test "$1" |
+	export "$@" local 2>/dev/null echo /usr/bin local
+printf "$@" awk done printf "$@" $(pwd) && readonly /usr/bin sed grep
+		grep && done echo && "$1" cd readonly ${HOME} 'quoted text'
+		&& printf test ${HOME} cd done readonly x=1 /usr/bin 2>/dev/null
+	| ${HOME} /usr/bin grep local test export ${HOME} done then grep local
+	local x=1 "$@" && local /usr/bin x=1
+$(pwd) local "$@" echo then echo "$@" $(pwd) ${HOME} test 2>/dev/null
+		2>/dev/null /usr/bin 'quoted text' readonly export x=1 echo export "$@" "$@"
+		sed /usr/bin | readonly --verbose echo
+	$(pwd) && --verbose readonly readonly 'quoted text' then readonly
+	then awk ${HOME} cd readonly done done grep "$@" $(pwd) done | awk readonly
+	${HOME} $(pwd) $(pwd) --verbose sed $(pwd) 'quoted text'
+done | printf 'quoted text' done ${HOME} -eu cd grep
+then 2>/dev/null --verbose
+		-eu awk --verbose local grep
+	then | && readonly ${HOME} && awk awk
+'quoted text' local echo
+		$(pwd) grep echo printf printf test /usr/bin
+	$(pwd) --verbose grep 'quoted text' cd echo cd -eu printf
+	export export x=1 test -eu
+	export --verbose | --verbose export awk cd
+	$(pwd) echo --verbose readonly -eu "$@" grep "$1" awk x=1 printf export
+grep grep test "$@" then printf && cd test x=1
+	${HOME} cd --verbose local -eu export awk printf
+${HOME} local printf local x=1 grep --verbose printf grep ${HOME} then
+		$(pwd) && /usr/bin test
+x=1 readonly sed 'quoted text' /usr/bin | local /usr/bin
+grep 2>/dev/null | awk done
+readonly ${HOME} x=1 ${HOME} ${HOME} --verbose local | readonly printf
+		echo && 2>/dev/null grep | echo
+		${HOME} printf "$@" done 2>/dev/null printf readonly
+	2>/dev/null local 2>/dev/null
+		local --verbose 2>/dev/null export $(pwd) printf | local
+		then echo test sed | 'quoted text'
+	awk done $(pwd) printf && readonly
+	'quoted text' | done ${HOME} then cd
+	"$1" awk test "$@" sed then export done
+		readonly test -eu /usr/bin 2>/dev/null readonly "$@"
+	&& awk test awk "$@" x=1 -eu export /usr/bin --verbose sed local x=1 then $(pwd)
+		done printf sed "$@" export
+		local 'quoted text' 2>/dev/null --verbose echo "$1" done "$@" then readonly
+		$(pwd) sed | grep echo && local awk export printf
+	"$@" && "$1" export --verbose cd export sed -eu "$1" echo echo /usr/bin && local
+export 2>/dev/null --verbose test -eu --verbose -eu /usr/bin done
+/usr/bin local && test ${HOME}
+cd awk x=1 "$1" then "$@" "$1" test awk done --verbose cd grep -eu 'quoted text'
+	echo ${HOME} printf printf grep | test
+		then sed then done && sed
+/usr/bin ${HOME} readonly echo /usr/bin "$@" sed 2>/dev/null
+	2>/dev/null $(pwd) grep -eu "$1" local ${HOME} | local export /usr/bin
+'quoted text' ${HOME} -eu "$@" 'quoted text'
+sed awk sed "$1" cd awk
+done 2>/dev/null local cd && -eu local
+	/usr/bin done 2>/dev/null cd x=1 --verbose grep
+		printf 'quoted text' 'quoted text' x=1 grep "$@"
+		awk 2>/dev/null awk "$1" cd
+grep cd grep | sed -eu 'quoted text'
+		sed local 'quoted text' awk sed 2>/dev/null test sed 2>/dev/null done test sed
+		awk printf | 2>/dev/null export "$@" ${HOME} readonly sed local local local |
+	readonly then grep awk readonly 'quoted text' "$@" grep export printf
+	x=1 echo "$@" then | x=1 then awk && sed
+export readonly awk readonly local awk readonly sed export && test "$1" 2>/dev/null
+	awk && then test $(pwd) export
+		$(pwd) test /usr/bin "$@" done export -eu cd test x=1 $(pwd) export
+	--verbose /usr/bin cd ${HOME} ${HOME} sed /usr/bin 2>/dev/null readonly ${HOME}
+		cd 'quoted text' "$1" && "$1" 'quoted text' local "$@" 2>/dev/null
+		'quoted text' echo local $(pwd) printf test readonly && ${HOME} 'quoted text' awk
+	printf "$1" "$1" done | /usr/bin
+		awk $(pwd) && test "$1" export
+		local && 'quoted text' 'quoted text'
+| echo awk x=1 export && 2>/dev/null
+		-eu $(pwd) cd "$@" | "$1" /usr/bin 'quoted text' "$1" echo readonly local /usr/bin
+	"$1" readonly x=1 local
+		local /usr/bin sed local done && && local export then printf
+	grep done -eu ${HOME} export
+		awk "$1" done then then "$@" ${HOME} sed done
+	then /usr/bin x=1 sed grep $(pwd) "$@"
+then printf readonly "$1" printf export printf 'quoted text' then 'quoted text'
+		'quoted text' grep --verbose export printf cd ${HOME} ${HOME}
+${HOME} -eu x=1 test done awk /usr/bin
+then x=1 done test local 2>/dev/null /usr/bin cd test local "$1"
+	grep echo "$@" 2>/dev/null grep
+	"$@" | local sed test -eu -eu -eu x=1
+export test awk ${HOME} && "$@" awk readonly then cd
+	/usr/bin then printf /usr/bin x=1 x=1 grep readonly
+x=1 printf "$1" test | test grep grep done
+	$(pwd) printf && grep --verbose
+	local export -eu | /usr/bin
+	2>/dev/null 2>/dev/null then printf cd -eu done printf 2>/dev/null
+		'quoted text' "$@" local $(pwd) && $(pwd) done sed then export sed $(pwd)
+		'quoted text' local && printf x=1 -eu done awk test cd --verbose
+	test /usr/bin done 2>/dev/null sed then
+	cd sed export done then awk --verbose "$@" export
+		$(pwd) sed && awk local done 2>/dev/null ${HOME} -eu awk local x=1 ${HOME}
+		/usr/bin 2>/dev/null $(pwd) export "$@" 'quoted text' --verbose
+'quoted text' -eu done test 'quoted text'
+"$@" | | cd x=1 test then done 2>/dev/null 'quoted text' -eu /usr/bin &&
+		${HOME} awk /usr/bin sed && sed awk cd -eu printf ${HOME} | awk export echo /usr/bin
+		then ${HOME} 'quoted text' sed readonly printf test export --verbose "$1" awk
+		-eu local ${HOME} awk ${HOME} printf cd export readonly "$@" then test awk
+	"$@" -eu echo /usr/bin readonly 'quoted text' "$@" "$@" test
+/usr/bin $(pwd) "$1" done "$@" cd 2>/dev/null
+then printf test "$@" export ${HOME} done
+2>/dev/null $(pwd) sed "$1" /usr/bin cd "$1" $(pwd) sed ${HOME}
+		sed -eu export 'quoted text' readonly 'quoted text' $(pwd)
+	| -eu readonly /usr/bin x=1 $(pwd) echo | done x=1 $(pwd) test printf --verbose
+	done sed ${HOME} local 'quoted text' readonly | -eu awk done $(pwd)
+printf echo 2>/dev/null readonly test sed /usr/bin test
+		x=1 readonly $(pwd) x=1 &&
+	test cd "$1" "$1" /usr/bin grep x=1 ${HOME} local
+	x=1 /usr/bin grep "$@" test | x=1 "$@" "$@" -eu local $(pwd) ${HOME} local
+&& && cd awk then 'quoted text' | 'quoted text'
+	x=1 export /usr/bin $(pwd) "$@" 'quoted text'
+	test 2>/dev/null test echo
+'quoted text' readonly 2>/dev/null -eu x=1 | printf readonly
+	&& x=1 readonly --verbose ${HOME} then then export $(pwd) "$1" done sed done
+		-eu cd sed --verbose "$@" 'quoted text' --verbose && readonly test "$1" -eu
+	"$@" "$@" echo 2>/dev/null "$@" echo --verbose --verbose awk test sed awk $(pwd)
+--verbose "$@" done sed readonly echo 'quoted text' awk cd $(pwd) -eu 'quoted text'
+		cd export $(pwd) -eu local | "$@" printf
+		readonly 'quoted text' readonly
+	${HOME} printf 'quoted text'
+	/usr/bin 'quoted text' $(pwd) sed cd 'quoted text'
+	'quoted text' /usr/bin /usr/bin printf -eu ${HOME} "$@" sed echo $(pwd)
+$(pwd) && /usr/bin --verbose /usr/bin 2>/dev/null "$1" $(pwd) then
+		cd 2>/dev/null export
+	then "$@" ${HOME} ${HOME} printf -eu export
+"$@" --verbose "$1" sed awk then --verbose echo export done
+&& readonly grep /usr/bin 'quoted text' --verbose done
+/usr/bin awk 2>/dev/null done awk readonly
+		done 2>/dev/null $(pwd) --verbose 'quoted text' local x=1
+	cd then echo grep && -eu /usr/bin $(pwd) "$@" --verbose 2>/dev/null $(pwd)
+	--verbose local && cd done readonly x=1 awk awk sed "$1" /usr/bin
+${HOME} readonly cd sed x=1 then 'quoted text' && grep
+readonly -eu printf local
+test --verbose ${HOME} export echo "$1" awk && 2>/dev/null sed
+		2>/dev/null then printf ${HOME}
+	readonly readonly cd 'quoted text'
+		/usr/bin -eu 'quoted text' done done
+	--verbose printf echo readonly test 'quoted text' /usr/bin "$1" 2>/dev/null
+		'quoted text' ${HOME} 2>/dev/null test printf
+		/usr/bin printf printf --verbose /usr/bin printf 'quoted text'
+	awk sed && cd 2>/dev/null grep grep "$@" readonly $(pwd) "$1" |
+		grep printf ${HOME} local
+	grep sed 'quoted text' $(pwd) -eu grep
+		x=1 -eu local readonly "$@" 'quoted text' x=1 ${HOME} local
+	done sed done | ${HOME} echo printf local cd "$@" "$@" $(pwd) export
+		echo echo --verbose $(pwd) "$@" printf local -eu readonly $(pwd) test x=1 readonly
+	$(pwd) export ${HOME} /usr/bin "$@" awk /usr/bin test
+awk sed && readonly && 'quoted text' printf printf && printf | 2>/dev/null
+	/usr/bin test -eu -eu awk "$@" export
+		awk /usr/bin test echo "$@"
+		test "$1" 'quoted text' done grep $(pwd)
+| "$@" echo 2>/dev/null 2>/dev/null /usr/bin
+printf then -eu -eu "$@" awk sed -eu printf /usr/bin
+		-eu echo "$1" | echo then printf 2>/dev/null | && printf sed then awk printf
+-eu "$1" "$@" --verbose export echo --verbose 2>/dev/null readonly grep 'quoted text'
+		printf echo $(pwd) && 'quoted text' && export | then 'quoted text'
+	printf cd local /usr/bin local then cd /usr/bin sed &&
+test sed export echo "$1" local sed
+x=1 export 'quoted text' printf --verbose
+	awk /usr/bin 2>/dev/null "$@" | cd echo printf local
+		x=1 sed test printf $(pwd)
+	readonly /usr/bin echo | then test readonly echo sed "$@" 'quoted text'
+x=1 --verbose grep |
+		${HOME} printf printf then export awk "$@" done export $(pwd) "$1" awk awk ${HOME}
+	-eu grep /usr/bin cd done local | cd readonly done readonly $(pwd)
+		&& 'quoted text' readonly 'quoted text'
+		readonly ${HOME} "$1" "$@" 'quoted text' readonly then /usr/bin echo
+$(pwd) 2>/dev/null done
+	--verbose 2>/dev/null x=1 --verbose 'quoted text' 2>/dev/null
+$(pwd) "$1" x=1 $(pwd) 2>/dev/null --verbose done printf --verbose $(pwd)
+local | 'quoted text' sed printf grep grep test "$@" export then awk ${HOME}
+		&& && | awk test test test --verbose | awk
+	${HOME} 2>/dev/null ${HOME} -eu echo sed
+		sed sed export awk $(pwd) 'quoted text' x=1 | /usr/bin
+	test $(pwd) /usr/bin grep cd sed x=1 | "$@" && "$@" printf
+$(pwd) cd awk test sed 2>/dev/null
+		readonly test printf $(pwd) test /usr/bin grep x=1 --verbose
+echo echo local readonly
+	echo "$1" cd -eu x=1 test ${HOME} 2>/dev/null printf
+	readonly readonly --verbose ${HOME} local awk -eu
+		grep readonly -eu ${HOME} printf | "$@" awk --verbose /usr/bin
+2>/dev/null local echo | "$@" cd 'quoted text' /usr/bin test then echo
+"$@" test /usr/bin "$@" done -eu awk ${HOME}
+readonly test "$@" local printf then && awk
+	awk grep | local awk x=1 "$@" --verbose $(pwd) "$@" grep
+	awk --verbose then awk cd 2>/dev/null
+		| sed 'quoted text' --verbose | echo "$1" done sed printf sed ${HOME}
+	'quoted text' export -eu export export local ${HOME}
+	${HOME} | then local $(pwd) readonly ${HOME} | done
+	| | cd sed | printf 2>/dev/null x=1 ${HOME} --verbose
+$(pwd) readonly /usr/bin &&
+	then done "$@" sed readonly "$@" awk | 'quoted text' -eu 'quoted text'
+2>/dev/null grep && awk
+		then ${HOME} readonly local then echo "$@" then /usr/bin done "$1" grep
+	sed 2>/dev/null /usr/bin readonly cd done 2>/dev/null done sed awk 2>/dev/null
+		readonly --verbose $(pwd) /usr/bin /usr/bin
+"$1" | -eu then $(pwd) local 2>/dev/null
+		cd then awk && done test | $(pwd) -eu test
+	export grep printf | echo sed "$@" --verbose test
+	${HOME} then awk 'quoted text'
+	readonly cd x=1 sed ${HOME} awk grep -eu grep echo ${HOME} --verbose sed
+local $(pwd) | test $(pwd) -eu cd done /usr/bin
+&& cd ${HOME} 2>/dev/null awk x=1 printf printf ${HOME} readonly
+--verbose grep echo $(pwd) 'quoted text' awk ${HOME} x=1 -eu
+	awk 2>/dev/null ${HOME} -eu ${HOME}
+	cd 2>/dev/null 'quoted text' && $(pwd)
+		"$@" --verbose 2>/dev/null then echo "$@" /usr/bin "$@" /usr/bin
+local $(pwd) printf | export cd "$@" then "$@" /usr/bin --verbose
+		done awk --verbose && -eu test | readonly ${HOME} "$@" sed sed
+2>/dev/null export test && -eu awk export sed && then ${HOME} local
+		sed && awk 'quoted text' echo
+		echo awk echo x=1 ${HOME} awk cd echo "$1"
+sed awk $(pwd) printf echo && x=1 done
+		local done done awk /usr/bin export $(pwd)
+	2>/dev/null awk "$1" | && |
+		/usr/bin ${HOME} && $(pwd) | test "$1" "$@" cd
+"$@" | done local grep readonly cd cd
+&& done && --verbose export 2>/dev/null ${HOME} printf done ${HOME} --verbose
+	sed test done /usr/bin && sed
+	/usr/bin /usr/bin cd --verbose
+	2>/dev/null sed 'quoted text' --verbose printf sed -eu
+	"$@" -eu export ${HOME} "$@" "$1" $(pwd) echo 2>/dev/null done /usr/bin && grep
+		cd 'quoted text' awk
+	readonly grep grep /usr/bin 'quoted text' export local then readonly
+		local printf export --verbose
+| readonly export $(pwd) "$@" then printf export 2>/dev/null ${HOME}
+		-eu cd sed echo export then $(pwd) "$@" --verbose
+		/usr/bin "$1" printf cd 'quoted text' 2>/dev/null
+		-eu then sed readonly export
+		$(pwd) grep printf readonly "$@" -eu x=1
+x=1 awk $(pwd) grep "$@" x=1 | ${HOME} | grep test awk echo cd
+	printf echo 2>/dev/null sed $(pwd) local readonly 'quoted text'
+	'quoted text' awk x=1 /usr/bin 2>/dev/null "$1" local cd printf printf ${HOME}
+	$(pwd) /usr/bin grep done --verbose
+		x=1 /usr/bin 2>/dev/null --verbose $(pwd) | /usr/bin sed --verbose
+		readonly printf /usr/bin | $(pwd)
+printf 2>/dev/null $(pwd) "$@" | -eu && done ${HOME} cd awk $(pwd)
+echo /usr/bin grep --verbose ${HOME} done | awk /usr/bin "$@"
+		awk -eu printf test "$@" | grep "$1" | 'quoted text' local 'quoted text' sed
+'quoted text' x=1 cd && test echo export
+		2>/dev/null printf "$1" 'quoted text' 2>/dev/null "$@" grep && "$1" done
+	--verbose sed x=1 sed && export /usr/bin /usr/bin && x=1 &&
+		&& --verbose cd && sed printf "$1" export "$1" echo /usr/bin $(pwd) awk
+		done "$1" && && "$1" sed export && x=1 sed readonly local 2>/dev/null
+	'quoted text' grep printf "$@"
+		"$@" grep --verbose /usr/bin $(pwd) readonly x=1 then && "$@" --verbose
+&& awk 2>/dev/null printf test |
+export sed x=1 "$@" $(pwd) ${HOME}
+then ${HOME} | x=1 awk export
+		x=1 'quoted text' -eu -eu "$@" -eu "$1" $(pwd) grep -eu grep readonly done
+		export local grep $(pwd) printf then ${HOME} && test awk printf grep | test export
+	export sed echo ${HOME} grep ${HOME}
+| test printf local && local grep | "$1" 'quoted text' --verbose test -eu export
+	&& -eu 2>/dev/null grep --verbose test --verbose echo
+'quoted text' sed local && 'quoted text'
+readonly awk "$@" "$@" ${HOME} cd local "$1" readonly
+export grep 2>/dev/null $(pwd) cd echo 'quoted text' x=1
+	awk x=1 printf sed export
+		&& awk | 'quoted text' awk printf /usr/bin 'quoted text'
+cd test 2>/dev/null 'quoted text' x=1 $(pwd) awk ${HOME}
+	readonly 'quoted text' printf grep grep local 'quoted text' awk
+		"$@" 'quoted text' export | x=1 export export printf echo test ${HOME}
+		| export readonly 2>/dev/null printf then echo then ${HOME} /usr/bin local "$@"
+${HOME} | /usr/bin then && x=1 "$@" echo readonly && x=1 x=1 then ${HOME} echo
+		2>/dev/null "$@" export echo 'quoted text' -eu ${HOME}
+	grep local "$@" 'quoted text' --verbose sed x=1
+	test local 2>/dev/null sed
+		"$@" --verbose && local test then --verbose
+	printf echo readonly ${HOME} /usr/bin cd printf test grep
+printf export cd "$1" -eu cd local cd ${HOME} && --verbose echo
+		test printf x=1 done x=1
+		/usr/bin local then /usr/bin /usr/bin
+x=1 readonly | ${HOME} ${HOME}
+test then ${HOME} --verbose sed
+	test grep && done echo sed 'quoted text' 'quoted text' -eu
+		awk x=1 done -eu grep && "$1" 'quoted text'
+--verbose echo $(pwd) /usr/bin
+-eu readonly "$1" export "$1" /usr/bin sed sed --verbose -eu export x=1 'quoted text'
+readonly | | 2>/dev/null | then printf -eu then
+-eu && 'quoted text' grep printf local | grep 2>/dev/null x=1 'quoted text' grep
+	readonly -eu 'quoted text' $(pwd) | local $(pwd) export then x=1 printf done export
+sed printf done grep "$1" cd awk grep sed $(pwd) local
+printf done "$1" "$@" "$@" ${HOME} "$1" awk /usr/bin export && $(pwd) printf
+	grep /usr/bin 'quoted text' sed echo 2>/dev/null
+		--verbose && grep --verbose /usr/bin 2>/dev/null
+	${HOME} "$@" | readonly local then test
+| printf x=1 'quoted text' --verbose readonly printf -eu 2>/dev/null test
+then "$@" awk then "$1" "$1" $(pwd) x=1 x=1 echo
+		then "$1" "$1" cd $(pwd) 'quoted text'
+	local --verbose sed printf x=1 $(pwd) /usr/bin
+		&& --verbose sed awk x=1 export $(pwd) grep 2>/dev/null
+	--verbose --verbose export export --verbose 'quoted text' done printf grep done
+		awk x=1 $(pwd) readonly 2>/dev/null "$@" export x=1 grep 2>/dev/null
+		--verbose | export export 2>/dev/null && x=1
+	local sed then && export $(pwd) x=1 'quoted text' --verbose $(pwd) &&
+	--verbose | sed 'quoted text' --verbose test echo export
+${HOME} "$@" cd "$1" test |
+		sed awk ${HOME} grep sed ${HOME} sed x=1 /usr/bin
+	/usr/bin echo && -eu "$1" grep x=1
+local export readonly cd then done sed --verbose x=1 /usr/bin
+		'quoted text' cd 2>/dev/null ${HOME} done test --verbose then $(pwd)
+	cd done cd 'quoted text' then x=1 &&
+echo readonly export awk ${HOME} 'quoted text' --verbose export && done export
+-eu $(pwd) grep printf printf 2>/dev/null
+${HOME} test done export 2>/dev/null test
+	awk then then awk export 2>/dev/null && "$1" --verbose readonly
+x=1 local cd cd --verbose "$1" ${HOME} && ${HOME} local
+	-eu then && && sed --verbose 'quoted text' && export "$@"
+		$(pwd) && cd | -eu /usr/bin grep ${HOME} awk -eu done printf
+		&& sed /usr/bin done | x=1 --verbose sed cd --verbose "$1"
+test $(pwd) awk sed && "$1" --verbose local 2>/dev/null printf
+		| | then echo -eu done "$@" printf -eu "$1"
+done export --verbose cd ${HOME} "$@"
+		/usr/bin /usr/bin "$@" | local
+cd test printf && local then grep $(pwd) ${HOME} $(pwd) /usr/bin
+		x=1 test 'quoted text' /usr/bin x=1 && --verbose then then awk awk
+awk awk local | "$1" then
+cd | --verbose $(pwd) local local test awk $(pwd)
+then 'quoted text' cd --verbose
+	export --verbose printf grep readonly readonly cd | | | cd ${HOME} | && export
+	local cd -eu awk grep sed readonly && export 2>/dev/null cd | test
+	grep 'quoted text' done test "$1" 'quoted text' | echo readonly ${HOME}
+	"$@" export "$@" sed echo --verbose 'quoted text'
+		grep awk then | /usr/bin --verbose sed "$1" 'quoted text' 'quoted text'
+grep "$@" && readonly /usr/bin && export
+export /usr/bin /usr/bin $(pwd) x=1 export local x=1 echo
+--verbose printf echo 2>/dev/null grep 'quoted text' awk $(pwd) && done
+readonly | 'quoted text'
+		$(pwd) printf grep --verbose
+		&& done awk -eu local --verbose "$@" ${HOME} x=1 "$1" | 2>/dev/null
+	| then | 'quoted text' test cd readonly grep "$1"
+		--verbose ${HOME} then then then cd -eu cd printf test 'quoted text'
+	2>/dev/null 'quoted text' 2>/dev/null sed /usr/bin sed done "$@"
+		export then awk -eu local $(pwd)
+--verbose -eu 'quoted text' x=1 -eu grep /usr/bin
+cd | export "$1" sed ${HOME} /usr/bin readonly | export
+	cd 'quoted text' cd cd x=1 echo
+		grep --verbose echo export awk ${HOME} "$1" 'quoted text' $(pwd) "$@" "$@"
+		local cd 'quoted text' test | local 'quoted text'
+	/usr/bin printf sed x=1 --verbose $(pwd) grep then sed awk | ${HOME} readonly
+		awk test "$@" "$1" export cd then "$@" readonly
+test then then "$@" /usr/bin
+		"$1" test 'quoted text' export | sed && --verbose
+"$@" && 2>/dev/null && awk -eu then awk 2>/dev/null echo 2>/dev/null echo test
+	x=1 --verbose echo cd 2>/dev/null "$@" then "$@" --verbose "$@" cd
+| done local && -eu $(pwd) test $(pwd) test "$@" /usr/bin 'quoted text'
+		sed "$@" test && "$@" then echo echo
+	export done $(pwd) readonly | readonly 'quoted text' sed 'quoted text'
+$(pwd) cd "$@" then -eu awk test | done $(pwd)
+	'quoted text' readonly 'quoted text'
+/usr/bin 2>/dev/null $(pwd) done /usr/bin sed $(pwd) $(pwd)
+x=1 x=1 echo && 'quoted text' 2>/dev/null awk /usr/bin && done ${HOME} "$@"
+export && && test --verbose -eu --verbose
+	echo | x=1 "$1" --verbose $(pwd) --verbose -eu local ${HOME}
+	test sed /usr/bin x=1 test $(pwd) 'quoted text'
+		'quoted text' awk echo
+		printf 2>/dev/null echo | x=1 "$@" ${HOME} grep && readonly printf
+	x=1 done readonly "$@" test "$1" /usr/bin cd --verbose sed "$1"
+	then | sed && 2>/dev/null "$@" x=1 echo
+		test export sed done then x=1 'quoted text' done
+		$(pwd) "$1" ${HOME} readonly echo sed && local -eu "$1" cd echo grep printf cd --verbose
+	grep "$@" sed 'quoted text' 'quoted text' ${HOME} readonly -eu "$1" 'quoted text'
+		x=1 echo "$@" then echo && readonly -eu cd ${HOME} grep /usr/bin sed "$@"
+	export local && printf test
+done /usr/bin 'quoted text' done sed awk done export
+	"$@" printf test printf local grep local 'quoted text' $(pwd) x=1 && grep
+	test ${HOME} /usr/bin echo x=1 sed awk "$@" x=1 | cd 2>/dev/null
+	-eu "$@" done cd 2>/dev/null readonly && | test test -eu | ${HOME} cd &&
+		then done $(pwd) $(pwd) 2>/dev/null awk 'quoted text' export /usr/bin
+		-eu "$1" done 'quoted text' "$@" echo "$@" "$1"
+	then cd "$@" readonly && export "$@" echo done test then
+	grep && --verbose done -eu -eu export "$@" done local
+	readonly readonly awk awk
+"$1" echo && awk x=1 export
+	test readonly local -eu && 2>/dev/null printf sed -eu sed
+		readonly local grep "$@" x=1 | echo --verbose then test && $(pwd)
+		"$1" sed done ${HOME} readonly $(pwd) x=1 && then local "$@" awk && readonly
+		export echo 2>/dev/null x=1 x=1 sed 2>/dev/null
+	printf $(pwd) --verbose awk cd /usr/bin
+	export sed 'quoted text' export export then "$@"
+		x=1 grep x=1 && readonly test | 'quoted text' printf /usr/bin
+readonly test printf -eu /usr/bin local /usr/bin test
+"$1" "$@" $(pwd) test echo && -eu local $(pwd) "$1" grep "$@" then grep ${HOME}
+	"$1" test | local -eu 'quoted text'
+	then "$1" /usr/bin local local x=1
+	--verbose readonly "$@" --verbose export
+$(pwd) echo 'quoted text' ${HOME} && grep grep sed export 2>/dev/null -eu
+	export sed readonly done
+export cd -eu 2>/dev/null "$1" echo "$@"
+		&& | echo readonly -eu done done grep grep done ${HOME}
+local then readonly /usr/bin cd cd ${HOME} -eu grep
+	test 2>/dev/null && readonly
+		sed awk "$1" readonly readonly | done
+	grep readonly cd /usr/bin | /usr/bin readonly export awk "$@" 'quoted text'
+		local grep | grep 2>/dev/null
+		"$1" 'quoted text' export printf --verbose --verbose sed 2>/dev/null
+	x=1 awk /usr/bin --verbose -eu cd --verbose then export test grep
+	'quoted text' ${HOME} -eu readonly done /usr/bin test readonly 'quoted text'
+	| 2>/dev/null echo then export sed | awk ${HOME} ${HOME} local cd "$@"
+		readonly 2>/dev/null readonly then sed 2>/dev/null "$1"
+	printf test cd /usr/bin "$@" x=1 --verbose
+	-eu grep ${HOME} grep
+	export && $(pwd) x=1 "$1" done local awk grep echo 'quoted text'
+	-eu -eu cd awk grep cd
+"$@" export "$1" && -eu /usr/bin && printf
+cd -eu 2>/dev/null "$1" done ${HOME} && awk printf done
+		2>/dev/null then && local --verbose && export echo "$@" /usr/bin awk
+local cd cd sed grep -eu 2>/dev/null
+	'quoted text' "$@" cd
+then export 'quoted text' && awk grep -eu export
+local && local test ${HOME} 'quoted text' printf readonly
+	local 2>/dev/null "$@" cd "$1" "$1" $(pwd) cd &&
+test test readonly test local local echo x=1 -eu grep printf cd x=1 test
+		"$@" awk $(pwd) grep printf grep cd cd ${HOME} -eu | export --verbose 'quoted text'
+		--verbose awk local local ${HOME} echo export printf cd awk
+x=1 printf printf $(pwd)
+&& "$@" readonly echo test 'quoted text' "$1" printf
+		/usr/bin local && x=1 then --verbose $(pwd) x=1 "$@" echo 'quoted text'
+	"$1" --verbose awk --verbose printf x=1 && readonly local ${HOME} 2>/dev/null
+x=1 then "$1" done --verbose awk /usr/bin awk printf --verbose export local
+		echo grep ${HOME} && export cd sed /usr/bin && echo sed awk $(pwd) && x=1
+"$1" export /usr/bin echo | test /usr/bin /usr/bin
+		$(pwd) printf sed printf local 'quoted text' ${HOME}
+		readonly then x=1 2>/dev/null
+2>/dev/null --verbose cd -eu
+		"$1" --verbose 2>/dev/null awk "$@" awk echo then echo "$1" /usr/bin
+		-eu done -eu $(pwd) $(pwd) test --verbose x=1 export printf
+		awk "$@" then printf grep export $(pwd) cd
+'quoted text' 'quoted text' --verbose
+local x=1 'quoted text' grep $(pwd) | sed
+$(pwd) && && ${HOME} && then local awk "$1"
+		export x=1 cd done echo local local local done then done printf
+		2>/dev/null $(pwd) 2>/dev/null printf cd "$@"
+	/usr/bin readonly test -eu && "$@" sed -eu
+		export -eu awk cd "$@" $(pwd) sed -eu ${HOME} --verbose done test awk awk grep
+test printf then /usr/bin export cd -eu cd printf local && &&
+	-eu done readonly 'quoted text' "$@" awk readonly "$1" cd "$@" $(pwd)
+	'quoted text' 2>/dev/null ${HOME} x=1 x=1 test grep ${HOME}
+		--verbose ${HOME} sed awk done
+		test readonly readonly ${HOME} "$@" x=1
+'quoted text' x=1 --verbose "$@" /usr/bin 2>/dev/null --verbose $(pwd)
+	-eu /usr/bin $(pwd) export
+		--verbose export readonly test grep readonly
+		sed test /usr/bin $(pwd) -eu cd ${HOME} | && echo
+	--verbose cd --verbose x=1 ${HOME} then -eu ${HOME}
+printf sed readonly cd grep echo 'quoted text' sed
+--verbose test ${HOME} $(pwd) /usr/bin grep export readonly "$@" local
+		--verbose cd | $(pwd) x=1 then ${HOME} local printf && | awk test cd /usr/bin
+readonly awk awk cd awk $(pwd)
+	echo sed sed sed grep | cd readonly $(pwd) cd local "$1" && readonly
+	awk -eu | test | done -eu test && readonly awk done &&
+		| $(pwd) local grep 'quoted text' grep printf | done grep
+		sed export | ${HOME} $(pwd)
+		--verbose | "$1" "$@" then && export local /usr/bin 'quoted text' | export grep
+	'quoted text' --verbose printf && "$@" echo | ${HOME} export printf && test
+		then "$@" -eu x=1 test echo -eu x=1 -eu sed "$1" &&
+	then 2>/dev/null cd cd -eu
+2>/dev/null sed --verbose 'quoted text'
+		then --verbose awk echo -eu 2>/dev/null local printf x=1 'quoted text' /usr/bin
+		readonly test cd grep local awk 'quoted text' -eu | 'quoted text' sed awk /usr/bin
+local sed awk /usr/bin echo 'quoted text' /usr/bin awk $(pwd) echo "$@"
+'quoted text' printf then
+		local grep "$@" cd "$@" export cd 'quoted text' readonly "$1" 2>/dev/null
+	echo "$1" -eu "$@" printf 'quoted text' && then
+	sed ${HOME} --verbose -eu -eu && test -eu | | --verbose
+	printf printf "$1" sed awk --verbose awk | "$1" /usr/bin
+'quoted text' export echo readonly readonly grep && echo sed x=1
+	readonly grep grep readonly -eu grep -eu
+	--verbose x=1 && printf
+printf ${HOME} -eu test x=1 test done
+x=1 | echo x=1 local echo export ${HOME} 2>/dev/null
+cd 'quoted text' "$@" test | local | grep sed 2>/dev/null
+		test ${HOME} done x=1 && 2>/dev/null ${HOME} 2>/dev/null "$1"
+		cd readonly /usr/bin test $(pwd) "$@" done
+"$1" -eu cd /usr/bin export "$1"
+		export local /usr/bin "$1" echo -eu cd done export && sed
+printf local then $(pwd)
+		&& ${HOME} "$1" cd grep 'quoted text' then echo "$1" ${HOME}
+	--verbose "$1" "$@" grep ${HOME}
+	grep 'quoted text' "$1" x=1 grep ${HOME} "$1" awk local x=1
+	-eu sed export export ${HOME} export 2>/dev/null then 2>/dev/null grep $(pwd)
+done grep "$@" grep x=1 done "$1" ${HOME} local | x=1 /usr/bin printf x=1 "$@"
+		--verbose 'quoted text' sed awk && | "$@" export
+	"$@" done export export local /usr/bin x=1 2>/dev/null -eu ${HOME}
+"$1" grep && echo 2>/dev/null $(pwd) cd readonly /usr/bin echo
+		done /usr/bin -eu readonly export
+		export readonly --verbose --verbose awk done
+echo && 2>/dev/null | 'quoted text'
+	export "$1" export awk awk sed printf 'quoted text'
+	| local echo grep printf cd --verbose |
+	local done then && 'quoted text' sed test --verbose readonly "$1" x=1
+printf printf "$@" printf $(pwd) readonly /usr/bin
+		"$1" cd sed x=1 $(pwd) -eu grep 'quoted text' 2>/dev/null
+		"$@" x=1 'quoted text' && ${HOME} ${HOME} echo then test done local -eu readonly
+	sed "$@" cd awk done | sed $(pwd) sed $(pwd) -eu 2>/dev/null test "$1"
+${HOME} 'quoted text' echo | echo --verbose test && sed 2>/dev/null
+		'quoted text' "$1" ${HOME} "$1"
+	sed sed | awk 'quoted text' --verbose $(pwd)
+	awk export printf grep local &&
+done local local cd 'quoted text' -eu -eu cd x=1 done then grep 'quoted text'
+	/usr/bin 2>/dev/null --verbose local 'quoted text' 'quoted text' readonly
+	export x=1 awk -eu "$1" awk x=1 done 'quoted text' awk 'quoted text'
+		2>/dev/null awk test printf export -eu $(pwd) cd "$@" then "$1" -eu
+	--verbose sed printf 'quoted text' export x=1 echo then grep
+		export && -eu sed ${HOME}
+	export "$@" done grep x=1 done local echo 2>/dev/null echo && awk grep sed
+	$(pwd) --verbose x=1 echo printf "$@" /usr/bin readonly sed /usr/bin
+readonly echo 'quoted text' 'quoted text' "$1" grep
+		&& | done /usr/bin "$1"
+		cd ${HOME} awk grep --verbose done done | x=1 echo /usr/bin grep awk
+export "$@" -eu grep echo awk | sed printf "$@" 'quoted text' ${HOME} --verbose
+		done /usr/bin x=1 echo done test
+	echo | export grep --verbose readonly 'quoted text' cd then cd local "$1"
+	"$1" | sed awk $(pwd) then echo test then export ${HOME} cd | x=1 sed echo
+		| ${HOME} && && local x=1 cd --verbose 'quoted text' 'quoted text' "$@" export
+test 'quoted text' $(pwd) local ${HOME} | /usr/bin sed
+	"$1" 'quoted text' "$@" readonly echo echo readonly /usr/bin -eu 'quoted text'
+		'quoted text' then /usr/bin echo awk -eu done 2>/dev/null readonly
+	x=1 'quoted text' "$@" "$@"
+	"$1" 'quoted text' echo $(pwd) awk 'quoted text'
+		echo 'quoted text' x=1 cd && | sed done 2>/dev/null
+		"$@" readonly -eu "$@" $(pwd)
+export sed grep 2>/dev/null
+awk x=1 x=1 awk | export | /usr/bin
+	then export -eu 2>/dev/null printf sed printf && awk --verbose
+awk export awk "$@" -eu "$1" "$@" | 2>/dev/null
+	| --verbose test test "$1" $(pwd) -eu | -eu awk /usr/bin ${HOME} done awk
+	sed test /usr/bin export $(pwd) sed 2>/dev/null
+		test cd awk 2>/dev/null test
+	export done readonly "$@" /usr/bin then && -eu 'quoted text'
+		$(pwd) echo printf ${HOME} 2>/dev/null 'quoted text' grep $(pwd) "$@"
+		'quoted text' export | test --verbose "$@" awk awk ${HOME} readonly grep | ${HOME}
+		/usr/bin && 2>/dev/null readonly local export /usr/bin
+	readonly printf grep 2>/dev/null && export done export 'quoted text'
+		'quoted text' 2>/dev/null readonly readonly
+	&& "$@" readonly /usr/bin x=1 2>/dev/null done | $(pwd) sed "$@"
+-eu x=1 "$1" then export && -eu x=1 done 'quoted text' 2>/dev/null 2>/dev/null test
+	grep then echo && grep printf /usr/bin cd "$1" done export x=1 --verbose
+		readonly && then sed echo
+		"$@" $(pwd) local awk
+	| test local local && export
+		"$@" && then --verbose $(pwd) 'quoted text' local local
+		printf && --verbose cd ${HOME} test x=1 printf awk |
+	--verbose "$1" grep $(pwd) && test export sed "$@" --verbose ${HOME} "$@"
+		readonly cd && sed ${HOME} --verbose -eu local awk sed && test echo
+	sed cd 'quoted text' /usr/bin ${HOME}
+		awk sed && sed x=1 --verbose --verbose export
+	-eu test /usr/bin "$1" --verbose "$@" && export
+		"$@" 'quoted text' sed cd done --verbose && awk test -eu local
+| test --verbose test local local -eu sed test
+		grep printf && then /usr/bin test export 'quoted text'
+	readonly "$@" && 2>/dev/null printf done done x=1 2>/dev/null 2>/dev/null cd
+	sed echo | readonly | sed
+| then grep 'quoted text' then && -eu
+	x=1 local $(pwd) $(pwd) | awk "$@" 'quoted text' /usr/bin readonly 2>/dev/null awk
+		2>/dev/null grep printf done then 2>/dev/null done grep "$@" ${HOME}
+		awk grep cd "$@" grep 'quoted text'
+	echo sed --verbose local "$@" readonly grep 'quoted text' ${HOME} grep x=1
+		'quoted text' 'quoted text' cd grep done $(pwd) awk |
+	echo 'quoted text' 2>/dev/null "$@" "$@"
+		done test ${HOME} test then sed -eu export local $(pwd) awk echo echo
+	local done grep "$1" then "$@" ${HOME}
+		done cd "$@" --verbose printf done "$1" printf cd
+-eu echo done grep | x=1 -eu printf
+		-eu local | grep awk /usr/bin | test -eu "$@" then "$1" "$@" $(pwd)
+	"$@" printf awk readonly ${HOME} echo && readonly "$@"
+		x=1 test | echo then --verbose x=1 /usr/bin /usr/bin readonly
+awk "$@" /usr/bin local awk printf
+local cd export && ${HOME} cd cd echo
+test printf --verbose 2>/dev/null 2>/dev/null "$@" "$1" | --verbose ${HOME}
+		'quoted text' grep x=1 readonly readonly "$@" printf "$@"
+	export readonly printf
+"$@" 'quoted text' ${HOME} | --verbose local cd export $(pwd) readonly
+${HOME} local | 'quoted text' 'quoted text' x=1 && readonly
+&& local --verbose "$1" export local | export /usr/bin export "$1" "$@"
+done 'quoted text' done -eu -eu -eu -eu --verbose local readonly 'quoted text'
+	/usr/bin && grep 2>/dev/null "$1"
+	"$@" done 2>/dev/null | && 'quoted text'
+		$(pwd) | "$1" printf "$1" "$1" ${HOME} $(pwd)
+x=1 'quoted text' --verbose then --verbose printf 2>/dev/null --verbose
+${HOME} test | sed awk
+	then local echo $(pwd) printf "$@" test $(pwd) 'quoted text' local
+&& | && awk sed echo grep
+	echo ${HOME} cd echo sed
+	"$1" "$1" $(pwd) --verbose -eu
+	grep test x=1 && echo x=1 x=1 --verbose awk "$1" 'quoted text' ${HOME}
+--verbose awk 2>/dev/null ${HOME} "$@" sed 'quoted text'
+	"$1" readonly | local echo echo -eu 'quoted text'
+	echo && $(pwd) echo done "$1" ${HOME}
+		x=1 then grep export -eu test done $(pwd)
+		printf "$@" grep local
+"$@" "$@" then grep --verbose grep grep x=1 --verbose
+		-eu test readonly local readonly -eu then --verbose $(pwd) test --verbose
+		"$@" | && test printf | grep 2>/dev/null local grep awk /usr/bin
+		2>/dev/null 'quoted text' x=1 grep test then local
+	cd readonly done /usr/bin -eu echo x=1 export printf &&
+		"$1" sed export && export x=1
+printf export "$1" done readonly cd printf test
+cd grep $(pwd) "$@" sed 'quoted text' 2>/dev/null printf --verbose done
+sed export awk sed grep "$1" grep then ${HOME} "$1" x=1 --verbose
+awk ${HOME} --verbose /usr/bin echo x=1 then readonly 'quoted text'
+		readonly cd echo -eu sed test
+2>/dev/null ${HOME} -eu done 'quoted text' "$1" | x=1 --verbose -eu
+--verbose export "$1" 2>/dev/null done --verbose
+--verbose 'quoted text' "$@" then export "$1" -eu $(pwd) "$1" awk cd | done
+printf "$@" "$1" export printf x=1 local done $(pwd) test
+		| done grep /usr/bin sed && "$1" ${HOME} | awk 'quoted text' sed
+		'quoted text' sed echo "$@" | test sed "$1" readonly
+2>/dev/null then readonly
+	local ${HOME} then echo --verbose $(pwd) sed /usr/bin sed && 2>/dev/null -eu --verbose
+		"$1" cd | export 'quoted text' done cd awk then "$1" export echo
+	$(pwd) grep printf "$1" "$1" test local echo /usr/bin
+cd "$@" -eu export then $(pwd) local
+		| "$@" printf grep --verbose 'quoted text' "$@" ${HOME} export 'quoted text' x=1
+${HOME} --verbose && ${HOME} grep printf "$1" readonly
+		${HOME} done echo sed then x=1 grep x=1 awk grep | local --verbose
+grep sed printf local 'quoted text' 2>/dev/null ${HOME}
+		cd -eu local 2>/dev/null echo "$1" $(pwd) printf
+	echo done && x=1 echo 'quoted text' sed x=1 "$@" "$1" export readonly
+"$@" && test /usr/bin -eu ${HOME} echo done local 2>/dev/null readonly readonly
+		--verbose x=1 printf 2>/dev/null 'quoted text'
+	$(pwd) 'quoted text' 'quoted text' printf /usr/bin grep awk then $(pwd)
+		${HOME} test grep -eu 2>/dev/null
+then then export export readonly
+		2>/dev/null awk "$@" "$@" sed | export awk readonly -eu done sed "$1" x=1 'quoted text'
+readonly -eu readonly cd printf readonly awk sed
+	${HOME} "$@" -eu test $(pwd) echo && done printf
+	'quoted text' 'quoted text'
+&& echo $(pwd) --verbose 'quoted text'
+		echo /usr/bin grep sed | local echo
+	-eu -eu && awk 'quoted text' 2>/dev/null
+	readonly awk -eu printf && test | "$@" ${HOME} export export export && -eu
+then test readonly "$1" && then 2>/dev/null
+		readonly "$@" "$@" echo -eu sed printf --verbose && "$1" done readonly
+		"$1" "$@" local printf
+export then -eu 2>/dev/null export grep "$@" /usr/bin x=1 awk cd x=1 then 2>/dev/null
+		then readonly "$@" done | $(pwd) done | printf
+		-eu echo done cd x=1 readonly export
+	$(pwd) "$@" --verbose grep export && test sed
+		/usr/bin test local export && done 2>/dev/null export ${HOME}
+	$(pwd) ${HOME} test grep export | readonly cd $(pwd)
+	export -eu grep 'quoted text' -eu 'quoted text' x=1 local $(pwd) cd && grep ${HOME}
+	printf $(pwd) cd "$@" 'quoted text' 2>/dev/null sed
+grep export echo awk /usr/bin grep $(pwd) 'quoted text' echo
+		/usr/bin awk local sed "$1" grep
+		readonly test "$@" printf -eu test 'quoted text' ${HOME}
+		'quoted text' 2>/dev/null local /usr/bin $(pwd) test 'quoted text'
+	done export readonly grep export 'quoted text' 'quoted text'
+		readonly /usr/bin grep 2>/dev/null 'quoted text'
+	"$@" ${HOME} readonly --verbose ${HOME} export -eu | echo "$@" 2>/dev/null | "$@"
+sed cd printf /usr/bin /usr/bin sed /usr/bin "$1" sed $(pwd) printf
+	then $(pwd) -eu printf done --verbose 2>/dev/null ${HOME} -eu grep
+	printf ${HOME} | then ${HOME} x=1 "$1" "$1" | sed
+readonly "$@" "$1" printf ${HOME}
+		sed -eu "$1" then sed "$@" $(pwd) -eu local
+		awk 'quoted text' echo awk export awk --verbose
+/usr/bin cd grep local && awk test grep
+		grep echo then export /usr/bin
+		then sed $(pwd) cd $(pwd) local
+/usr/bin local then | /usr/bin readonly --verbose done
+'quoted text' && echo 2>/dev/null done awk
+/usr/bin then test /usr/bin
+		&& -eu sed x=1 $(pwd) "$@" cd ${HOME} | --verbose
+export x=1 2>/dev/null readonly 'quoted text' ${HOME} local
+	2>/dev/null test cd 2>/dev/null local $(pwd) printf readonly
+local "$@" "$1" cd grep export grep x=1 readonly
+		${HOME} "$1" 'quoted text' 'quoted text' then echo awk $(pwd) sed awk --verbose
+		/usr/bin | test | && ${HOME} test "$@"
+	test "$1" /usr/bin ${HOME} 2>/dev/null
+awk 2>/dev/null /usr/bin test
+		${HOME} "$1" test | echo cd readonly 2>/dev/null /usr/bin /usr/bin x=1 awk --verbose
+	${HOME} | | -eu "$1" then done grep $(pwd) "$@" grep -eu local 2>/dev/null
+	grep -eu readonly local grep cd awk printf "$1" cd "$@" test echo --verbose
+	| "$1" "$@" /usr/bin printf then /usr/bin
+		awk 2>/dev/null then ${HOME} -eu
+"$1" grep export x=1 local printf
+	export && readonly then local --verbose
+then --verbose then grep local x=1 "$1" test
+	2>/dev/null /usr/bin printf
+	--verbose 2>/dev/null export export
+		sed -eu grep | printf $(pwd) export then 2>/dev/null -eu /usr/bin printf then
+		test "$@" readonly 2>/dev/null local printf export -eu readonly
+		printf | awk done && /usr/bin export && test then "$1" /usr/bin --verbose
+2>/dev/null awk -eu export | done done $(pwd) /usr/bin x=1 "$@" "$1" echo 2>/dev/null
+		| test echo 2>/dev/null
+sed then -eu awk | 'quoted text' export printf
+		/usr/bin | readonly "$1" local "$@" 'quoted text'
+	| then ${HOME} local -eu /usr/bin | cd ${HOME}
+"$1" -eu | /usr/bin --verbose 'quoted text' ${HOME} ${HOME} | test grep grep printf
+	printf && cd awk "$1" 'quoted text' export
+	cd readonly sed "$1" 'quoted text' $(pwd) "$1" done | then ${HOME} /usr/bin
+	${HOME} test sed /usr/bin /usr/bin 2>/dev/null done "$@"
+		x=1 && -eu awk 'quoted text' 'quoted text' export ${HOME} cd "$1"
+		printf grep test | done x=1 $(pwd) then then printf readonly --verbose done $(pwd)
+		done readonly cd readonly --verbose --verbose sed printf -eu local printf
+	--verbose done then grep 'quoted text' x=1 "$1"
+"$1" "$1" --verbose --verbose cd /usr/bin
+		-eu test ${HOME} then x=1 export printf printf ${HOME} 'quoted text'
+	| 2>/dev/null --verbose export readonly $(pwd) test 2>/dev/null 2>/dev/null
+	readonly --verbose "$1" then /usr/bin
+	x=1 printf awk cd 'quoted text'
+cd cd "$1" then printf /usr/bin $(pwd) cd /usr/bin readonly
+	${HOME} export $(pwd) "$1" 'quoted text' local printf
+	"$1" --verbose readonly done awk | awk "$@" /usr/bin echo sed
+	export local "$1" grep sed awk echo $(pwd) | x=1 readonly grep -eu sed
+	/usr/bin 2>/dev/null $(pwd) readonly export awk && -eu printf awk cd 2>/dev/null
+		awk /usr/bin $(pwd) && then echo
+	x=1 --verbose grep sed readonly export "$1" ${HOME} readonly grep
+		done readonly test echo
+		-eu 2>/dev/null | -eu
+		"$@" x=1 -eu "$1" "$@"
+	-eu grep -eu -eu | 'quoted text'
+	export grep /usr/bin local -eu "$1" readonly grep echo test "$1"
+		| sed | local && ${HOME} /usr/bin sed --verbose echo 2>/dev/null "$@" test
+--verbose --verbose "$@" "$1" echo --verbose /usr/bin --verbose 2>/dev/null awk
+	/usr/bin && printf 2>/dev/null x=1
+		"$@" sed grep x=1 echo x=1 'quoted text' $(pwd) x=1 /usr/bin done printf
+2>/dev/null done --verbose printf readonly cd printf 2>/dev/null x=1 echo |
+readonly && awk /usr/bin x=1 'quoted text' done grep "$@"
+--verbose readonly grep readonly /usr/bin
+	${HOME} 2>/dev/null "$@" x=1 && cd local 'quoted text'
+		grep "$@" sed --verbose &&
+		printf local | ${HOME} | test /usr/bin | echo --verbose
+		-eu test local -eu -eu
+	$(pwd) "$1" readonly printf readonly
+		${HOME} printf export printf --verbose /usr/bin
+		"$@" && test && | cd echo ${HOME} export -eu export printf
+awk 'quoted text' sed awk export local | done /usr/bin 'quoted text' grep
+2>/dev/null sed printf "$@" --verbose /usr/bin
+${HOME} sed $(pwd) /usr/bin then -eu -eu ${HOME} 2>/dev/null
+2>/dev/null then "$@" then test -eu "$1"
+	local $(pwd) ${HOME} done export cd then /usr/bin awk 'quoted text'
+	readonly x=1 -eu awk && 2>/dev/null readonly 2>/dev/null
+	readonly $(pwd) /usr/bin local local awk | /usr/bin
+readonly sed then readonly --verbose sed awk echo printf 2>/dev/null
+cd 2>/dev/null -eu printf $(pwd)
+	grep | /usr/bin "$@" --verbose -eu /usr/bin
+		--verbose /usr/bin readonly && --verbose
+		$(pwd) grep --verbose grep 'quoted text'
+sed sed cd 2>/dev/null x=1 then echo ${HOME}
+awk awk sed sed awk && && | && awk /usr/bin | | 2>/dev/null sed $(pwd) then
+-eu x=1 "$1" echo 2>/dev/null awk -eu echo done -eu $(pwd) test cd readonly
+then done export sed echo | "$1" then --verbose awk
+	${HOME} grep && grep x=1 test grep echo printf | $(pwd) done
+		/usr/bin awk x=1 $(pwd) cd
+test --verbose echo 'quoted text' echo sed
+	"$@" done export $(pwd) "$1" /usr/bin x=1 cd -eu echo sed $(pwd) --verbose --verbose
+	x=1 && then export grep done x=1 cd done "$@" 2>/dev/null x=1
+--verbose cd grep echo echo "$1" $(pwd) "$@" "$@" readonly printf
+		sed export cd readonly grep done readonly $(pwd) | printf /usr/bin
+sed done cd x=1 -eu && awk echo /usr/bin cd "$1" -eu $(pwd)
+	sed test readonly cd | x=1
+	| export then readonly cd | export
+$(pwd) /usr/bin then 2>/dev/null export
+		2>/dev/null --verbose 'quoted text' echo test | && done done x=1 local ${HOME}
+	${HOME} done done $(pwd)
+then then ${HOME} readonly export sed && awk "$1" | awk done sed ${HOME}
+		--verbose awk grep awk export readonly cd "$@" $(pwd) echo "$1" "$@"
+grep | 'quoted text' awk && grep /usr/bin
+		awk test done -eu done "$@"
+/usr/bin "$1" grep then then printf then
+	2>/dev/null --verbose sed $(pwd) awk x=1 "$1"
+	&& | echo 2>/dev/null 2>/dev/null 2>/dev/null awk then "$@" grep test readonly
+"$1" echo awk && export x=1 2>/dev/null /usr/bin echo awk sed
+	echo then 'quoted text' 2>/dev/null export printf sed /usr/bin
+sed test local | echo $(pwd) then done then 'quoted text' --verbose
+		done --verbose then --verbose printf "$1" test x=1 local
+| done test /usr/bin "$1" export "$1" && readonly | 'quoted text' sed done
+export export grep $(pwd) local readonly test 'quoted text' "$1"
+	"$1" 2>/dev/null export /usr/bin test echo done "$1" | export
+awk -eu export local | x=1 local -eu
+		export /usr/bin "$1" done export 2>/dev/null
+	local sed cd grep /usr/bin printf export --verbose "$1"
+	"$1" "$@" "$1" readonly 'quoted text'
+${HOME} "$@" grep && --verbose printf cd --verbose
+		awk readonly grep --verbose awk local awk grep test x=1 then -eu 'quoted text'
+		test cd -eu && 'quoted text' "$@" "$@" x=1 /usr/bin -eu printf x=1 ${HOME}
+		readonly done echo awk ${HOME} cd -eu
+		sed /usr/bin export | local done | echo 'quoted text' local
+	awk /usr/bin 2>/dev/null && -eu grep readonly "$@"
+	/usr/bin cd done $(pwd) echo printf "$@" "$@" "$@"
+		/usr/bin --verbose "$@" 'quoted text'
+2>/dev/null "$@" cd && done 2>/dev/null x=1 export 'quoted text'
+	x=1 ${HOME} sed done ${HOME} sed --verbose sed local
+		--verbose sed echo -eu done --verbose
+	done readonly 2>/dev/null readonly cd /usr/bin cd 2>/dev/null local then then
+	test --verbose ${HOME} "$@" "$1" /usr/bin 2>/dev/null
+	$(pwd) printf export | --verbose
+	done sed printf "$1" test -eu grep
+echo export $(pwd) awk -eu grep $(pwd) sed x=1 /usr/bin
+	x=1 ${HOME} -eu readonly --verbose
+		| /usr/bin printf then awk then 2>/dev/null && cd then
+readonly then "$1" grep $(pwd) 'quoted text' 2>/dev/null "$@" local
+"$@" done printf 'quoted text' ${HOME} && 2>/dev/null local cd 2>/dev/null printf
+		2>/dev/null done 2>/dev/null
+		x=1 awk grep -eu 2>/dev/null readonly printf readonly && --verbose
+	awk /usr/bin test && printf
+		'quoted text' 'quoted text'
+-eu 'quoted text' /usr/bin && 2>/dev/null done readonly
+	"$1" 2>/dev/null cd cd "$1" printf x=1 then printf
+	x=1 'quoted text' done | x=1 cd test $(pwd)
+readonly sed "$@" local done done ${HOME} grep | then --verbose &&
+cd && ${HOME} "$@" echo
+		x=1 cd echo readonly local /usr/bin grep ${HOME} test
+		--verbose && 'quoted text' 2>/dev/null local test ${HOME} "$1" ${HOME} readonly
+		grep x=1 2>/dev/null && 2>/dev/null
+		echo "$1" --verbose 2>/dev/null
+"$1" grep 'quoted text' "$1" | | readonly
+local sed /usr/bin "$@" test /usr/bin done export local test | ${HOME}
+	$(pwd) --verbose 'quoted text' export done "$@" export echo
+	printf 'quoted text' printf /usr/bin done && /usr/bin grep && then ${HOME}
+grep local ${HOME} "$@" 'quoted text' "$@" local && then 2>/dev/null
+	done printf x=1 -eu 'quoted text' 2>/dev/null $(pwd) then
+	"$1" --verbose test printf readonly sed grep readonly
+	${HOME} ${HOME} printf echo 'quoted text' done grep
+done 2>/dev/null readonly $(pwd) local && cd "$@" ${HOME} grep 2>/dev/null "$1"
+		-eu awk ${HOME} echo && done done "$@" readonly
+		x=1 grep local then export -eu readonly sed -eu "$1" $(pwd) done done grep
+		then awk 2>/dev/null local test $(pwd) -eu test 'quoted text' --verbose -eu --verbose
+x=1 readonly 2>/dev/null then export done x=1 2>/dev/null
+	local -eu export then ${HOME} /usr/bin --verbose /usr/bin done ${HOME}
+readonly readonly then sed | readonly awk cd echo | $(pwd) done -eu "$1"
+		local then cd cd "$1" grep 'quoted text' printf printf
+$(pwd) then cd ${HOME} printf /usr/bin
+		$(pwd) -eu grep then export printf done "$1" then awk then ${HOME} readonly awk
+	then --verbose grep test grep $(pwd) $(pwd) x=1 | sed x=1 "$1" -eu sed && export
+	cd echo "$@" test 2>/dev/null && readonly printf echo 'quoted text' --verbose
+&& sed printf readonly cd 'quoted text' awk sed 2>/dev/null grep echo
+	'quoted text' "$1" printf cd -eu echo
+		"$@" "$@" --verbose awk cd test -eu ${HOME} x=1 | export
+--verbose grep $(pwd) readonly
+		test sed "$@" grep printf cd cd ${HOME} local $(pwd) 2>/dev/null
+#include c44.sh
+	test "$1" readonly awk 'quoted text' readonly && $(pwd) | /usr/bin
+		grep /usr/bin sed 'quoted text' | grep --verbose grep cd printf 2>/dev/null
+		-eu grep x=1 then printf cd $(pwd) grep grep export
+		echo --verbose -eu test export done x=1 then /usr/bin printf
+	awk 'quoted text' $(pwd) export $(pwd) 'quoted text' ${HOME} readonly
+${HOME} then x=1 printf --verbose sed done done sed -eu awk test -eu readonly
+	${HOME} then grep cd x=1 x=1 export awk cd x=1 "$@"
+		x=1 2>/dev/null | cd &&
+		printf done test sed export | x=1 then local | x=1
+"$@" | && local cd 'quoted text' local /usr/bin $(pwd)
+	-eu readonly && "$1" readonly --verbose -eu test
+grep "$1" printf done
+"$1" /usr/bin export export ${HOME}
+	then | export done awk && readonly ${HOME}
+		grep 'quoted text' then echo /usr/bin "$@" 2>/dev/null
+local x=1 $(pwd) $(pwd) cd local 'quoted text' echo echo done 'quoted text' awk
+done -eu "$1" readonly done export sed $(pwd)
+	'quoted text' /usr/bin test 'quoted text' local grep
+$(pwd) readonly sed done
+	--verbose echo grep local test $(pwd) sed export
+	local /usr/bin --verbose /usr/bin readonly
+readonly done grep readonly "$@" awk printf done awk then -eu printf
+${HOME} echo 2>/dev/null /usr/bin done 'quoted text' grep -eu done then
+		'quoted text' awk echo local 'quoted text' export 'quoted text'
+local $(pwd) local printf -eu awk export --verbose sed export ${HOME}
+	local export test test awk -eu awk printf done done export readonly
+	$(pwd) test done grep echo echo sed export then awk | 'quoted text' "$1"
+		${HOME} x=1 sed then ${HOME} awk done "$@" grep
+	--verbose /usr/bin -eu ${HOME} "$@" 'quoted text' /usr/bin
+	done sed "$1" test 2>/dev/null local printf $(pwd) printf 2>/dev/null /usr/bin
+		'quoted text' --verbose readonly x=1 $(pwd) sed 2>/dev/null export local 2>/dev/null
+${HOME} 2>/dev/null && echo readonly
+	&& && /usr/bin test grep x=1 done export awk x=1 readonly -eu readonly
+		2>/dev/null local "$1" test x=1 done 'quoted text'
+		done ${HOME} "$1" export --verbose sed && then cd "$1" readonly "$@" test "$@"
+		${HOME} printf export done "$1" -eu cd readonly && local
+cd test cd awk $(pwd) then awk echo readonly readonly "$1" awk "$1" 'quoted text'
+	'quoted text' | x=1 sed test $(pwd) --verbose done
+		"$@" cd --verbose export x=1 "$@" test $(pwd)
+		"$1" local printf grep "$@" $(pwd) x=1 2>/dev/null /usr/bin grep $(pwd)
+	cd echo grep awk export 'quoted text' 2>/dev/null done
+	| 2>/dev/null --verbose done && test /usr/bin $(pwd)
+/usr/bin sed grep awk grep
+		grep done 'quoted text' "$1" "$1"
+cd /usr/bin "$1" echo | x=1 test && echo
+		test x=1 done && 2>/dev/null
+	done && x=1 awk | done 2>/dev/null awk && "$1" /usr/bin | done test "$@"
+		cd readonly done then ${HOME} 'quoted text' $(pwd) cd export printf grep | then
+test then readonly export
+		test 'quoted text' /usr/bin "$1"
+		readonly "$1" ${HOME} done
+		then local printf readonly then && readonly sed grep test awk
+		"$@" local awk then test printf ${HOME} x=1
+-eu then /usr/bin "$1" cd && x=1 | printf $(pwd)
+		x=1 grep export ${HOME} printf --verbose --verbose local local export
+		cd cd 2>/dev/null export $(pwd) export "$1" -eu test export "$@" printf export
+		-eu ${HOME} echo && done x=1 test && && export /usr/bin
+	echo test --verbose && &&
+		"$@" printf sed readonly
+/usr/bin cd --verbose | then awk x=1 'quoted text'
+readonly printf x=1 cd
+printf echo && awk -eu -eu /usr/bin -eu sed
+	readonly printf done sed grep 'quoted text' sed "$@" local ${HOME}
+--verbose grep 'quoted text' test test printf 2>/dev/null
+--verbose export grep cd done
+		export then -eu printf -eu printf local done $(pwd) export grep
+	sed ${HOME} echo local "$@"
+	test --verbose $(pwd) --verbose -eu 2>/dev/null "$@"
+		"$1" awk | --verbose local 'quoted text' sed test && sed grep 'quoted text'
+		sed x=1 test printf grep --verbose "$@" $(pwd) cd then awk done readonly
+	--verbose cd sed cd test readonly /usr/bin
+test grep x=1 'quoted text' sed echo done | && echo ${HOME}
+$(pwd) cd readonly x=1 --verbose sed ${HOME} cd then $(pwd) -eu && printf
+	| test done grep x=1 echo done grep export grep local sed 'quoted text' ${HOME}
+export cd cd grep printf cd cd cd 'quoted text'
+sed awk -eu done ${HOME} done $(pwd) then "$@" "$1" && 2>/dev/null
+		-eu grep then /usr/bin /usr/bin --verbose local test && local --verbose
+test test export cd then 2>/dev/null echo
+		-eu $(pwd) x=1 | /usr/bin test sed awk echo $(pwd) ${HOME}
+/usr/bin local 2>/dev/null $(pwd) && x=1 export printf && 2>/dev/null 'quoted text'
+	"$1" test then local 'quoted text'
+| grep printf x=1 awk | /usr/bin x=1 awk export
+	-eu awk readonly | | awk -eu &&
+		$(pwd) sed 2>/dev/null test /usr/bin local |
+local | --verbose export
+export readonly cd echo awk $(pwd) done done done "$@" "$@" then grep |
+	cd "$1" --verbose $(pwd) && done export "$1"
+x=1 'quoted text' test ${HOME} 2>/dev/null -eu sed /usr/bin done local cd
+	"$1" done export readonly sed grep "$@" --verbose readonly | echo "$@" printf export
+echo $(pwd) test then x=1 done "$1" local local && 'quoted text'
+	&& done export readonly --verbose &&
+	| | --verbose grep 2>/dev/null /usr/bin /usr/bin sed then "$@" -eu export /usr/bin
+		grep awk test --verbose | grep "$1" echo done && done |
+	printf readonly cd 'quoted text' grep awk && --verbose
+		then sed awk then echo -eu $(pwd) then local $(pwd)
+awk 'quoted text' -eu then cd
+$(pwd) /usr/bin && | grep done 'quoted text'
+| 'quoted text' readonly local | | grep awk
+	2>/dev/null x=1 2>/dev/null "$@" "$@" 'quoted text' $(pwd) cd export 2>/dev/null
+	| sed cd done && -eu awk "$1" export readonly --verbose --verbose /usr/bin
+		x=1 2>/dev/null awk readonly "$1" then cd sed grep 2>/dev/null
+cd $(pwd) ${HOME} cd && then -eu 2>/dev/null test /usr/bin awk /usr/bin 2>/dev/null
+		&& 'quoted text' then | | --verbose ${HOME} awk test export 2>/dev/null cd readonly
+-eu /usr/bin printf done 'quoted text' | 2>/dev/null
+${HOME} x=1 done "$@" "$1" "$@"
+"$@" readonly grep -eu 2>/dev/null x=1 "$1" 'quoted text' $(pwd) x=1 "$1" "$1"
+	readonly awk test readonly -eu test sed awk && then cd grep done /usr/bin 'quoted text'
+2>/dev/null awk printf "$1" | echo 2>/dev/null 2>/dev/null test sed awk -eu export
+		2>/dev/null 'quoted text' readonly then $(pwd)
+x=1 | then grep sed "$@"
+		then local 2>/dev/null ${HOME} local 'quoted text' 2>/dev/null ${HOME} awk /usr/bin
+| local then x=1 echo --verbose
+		"$@" && --verbose /usr/bin 2>/dev/null && local && readonly
+	&& local test echo 2>/dev/null x=1 'quoted text' readonly sed local readonly
+awk x=1 "$1" test test /usr/bin
+readonly sed done /usr/bin
+printf printf readonly printf done -eu cd 'quoted text' cd
+		| printf ${HOME} test then /usr/bin 'quoted text' ${HOME} | $(pwd)
+		test readonly x=1 test "$@" awk sed done awk 2>/dev/null
+"$@" then $(pwd) echo
+/usr/bin -eu export done readonly awk
+${HOME} "$1" test 2>/dev/null local | export "$@"
+	local "$@" ${HOME} done | local ${HOME}
+	local done awk $(pwd) printf export awk test cd grep
+x=1 x=1 $(pwd) test test --verbose readonly echo
+	echo test --verbose awk $(pwd) x=1 /usr/bin export "$@"
+		grep local awk 'quoted text' /usr/bin
+	awk 2>/dev/null x=1 && done --verbose ${HOME} --verbose --verbose x=1 --verbose
+sed local x=1 cd done
+		$(pwd) printf awk && ${HOME} 'quoted text' | test 2>/dev/null sed test "$@"
+	--verbose awk then "$1" export sed local | x=1 --verbose readonly awk then 2>/dev/null
+	awk 2>/dev/null x=1 printf
+cd x=1 ${HOME} readonly "$1" x=1
+sed "$1" /usr/bin echo local readonly && test export x=1 then done done
+"$@" then test | export --verbose sed 2>/dev/null grep printf
+		echo cd --verbose awk awk
+		then local then /usr/bin $(pwd) && | done awk "$1" export test awk test sed echo
+	'quoted text' ${HOME} test printf ${HOME} grep echo grep
+		"$1" -eu export 2>/dev/null $(pwd) x=1
+		export x=1 readonly x=1 /usr/bin 'quoted text' local
+	--verbose 'quoted text' then readonly sed /usr/bin
+"$1" sed test then x=1 echo
+		cd /usr/bin x=1 'quoted text' "$1" ${HOME}
+		"$1" test 'quoted text' export && awk -eu "$@"
+then ${HOME} --verbose && && && "$1"
+${HOME} x=1 && x=1 awk test export --verbose --verbose grep
+		"$@" $(pwd) test 'quoted text' echo echo $(pwd) $(pwd) grep
+		done readonly --verbose $(pwd) 'quoted text'
+		test sed --verbose ${HOME} test --verbose 'quoted text'
+done echo "$1" export "$1" readonly readonly cd cd then
+2>/dev/null grep /usr/bin 'quoted text' printf awk readonly
+awk && x=1 --verbose -eu "$@" $(pwd)
+		x=1 then "$1" awk --verbose
+	$(pwd) local echo x=1 echo export sed echo
+/usr/bin -eu readonly done "$@" echo export 'quoted text' printf 2>/dev/null
+&& then --verbose | -eu "$@" 'quoted text' -eu $(pwd)
+grep /usr/bin -eu readonly --verbose
+	x=1 /usr/bin ${HOME} ${HOME} test 2>/dev/null
+cd sed grep local export "$@" x=1 export x=1
+printf 2>/dev/null /usr/bin
+2>/dev/null 'quoted text' grep && done done | echo
+	"$1" "$@" ${HOME} $(pwd) "$1" local $(pwd) | printf local ${HOME}
+"$@" | grep done ${HOME} done $(pwd)
+--verbose export then "$@" 2>/dev/null printf 'quoted text' awk awk sed readonly
+&& /usr/bin then export
+	"$1" /usr/bin cd grep | ${HOME} done
+	grep test grep then local then ${HOME} x=1 grep
+echo test ${HOME} cd -eu local export test done echo | --verbose
+	$(pwd) done ${HOME} --verbose export |
+export cd then | readonly printf | readonly -eu awk x=1 echo /usr/bin
+${HOME} "$1" awk -eu local local | /usr/bin 'quoted text'
+$(pwd) 2>/dev/null "$@" done test
+then ${HOME} /usr/bin echo grep readonly
+export export test then "$1" cd 2>/dev/null $(pwd) | | x=1 'quoted text'
+	printf readonly && $(pwd) test then sed local awk -eu test export
+	test done | sed && readonly readonly readonly "$1" "$1" $(pwd)
+2>/dev/null export /usr/bin -eu -eu "$1" $(pwd) 2>/dev/null "$1" echo "$@"
+	local "$@" readonly 2>/dev/null "$@" export cd awk
+		done "$1" | then then cd export sed "$1" -eu done
+"$1" 'quoted text' cd test $(pwd) then x=1 "$1"
+	"$@" 'quoted text' awk grep test sed grep ${HOME} | "$1" sed $(pwd)
+| then then printf 'quoted text' export cd | ${HOME} sed /usr/bin
+		readonly x=1 --verbose 'quoted text' awk "$1" $(pwd) echo &&
+'quoted text' grep printf -eu printf -eu printf sed printf then -eu 'quoted text'
+grep -eu echo done cd /usr/bin awk then "$1"
+	/usr/bin $(pwd) -eu readonly | "$@"
+"$@" ${HOME} sed && $(pwd) && sed --verbose $(pwd) "$1" sed && x=1 done printf
+then --verbose awk | $(pwd) -eu ${HOME} done $(pwd) printf -eu done
+	"$1" --verbose && ${HOME} awk test readonly "$1" && test 'quoted text'
+then --verbose "$@" /usr/bin readonly cd
+	--verbose --verbose /usr/bin local $(pwd) "$@" printf "$1"
+		| && | export then echo grep --verbose -eu x=1 readonly 2>/dev/null export
+		sed awk printf ${HOME} printf sed cd ${HOME} echo echo printf 2>/dev/null
+	--verbose -eu --verbose ${HOME} ${HOME} --verbose test -eu 'quoted text'
+/usr/bin echo awk awk local
+test awk cd ${HOME} export done ${HOME} 'quoted text' ${HOME}
+		then export sed sed -eu --verbose | grep ${HOME} "$@" | /usr/bin
+		-eu && "$@" 'quoted text' export
+		local printf /usr/bin 2>/dev/null printf local 'quoted text'
+		x=1 'quoted text' && 2>/dev/null echo then readonly
+		local readonly -eu readonly awk -eu then local 'quoted text'
+	printf awk sed "$1" -eu grep -eu test x=1 -eu awk sed ${HOME} 'quoted text'
+	-eu x=1 --verbose && &&
+	then then then done | x=1 printf
+	2>/dev/null -eu | "$@" --verbose then done cd grep "$@"
+		printf echo export "$1" -eu done "$@" "$@" | readonly 'quoted text'
+		2>/dev/null printf export /usr/bin test grep printf "$@" readonly done
+	2>/dev/null grep export 2>/dev/null readonly x=1
+	| done awk cd echo /usr/bin
+"$@" grep && | local x=1 export && awk -eu /usr/bin
+		cd 2>/dev/null "$@" "$@" && then | "$@" test && 'quoted text' ${HOME}
+done awk then 2>/dev/null awk
+		sed then && test export done $(pwd) -eu "$@" readonly
+printf 2>/dev/null | test sed --verbose -eu ${HOME} grep | "$@" 'quoted text'
+		export "$1" done /usr/bin grep test && "$@"
+		/usr/bin "$1" 'quoted text'
+"$@" -eu export export
+-eu /usr/bin && local -eu awk test test x=1 2>/dev/null
+-eu local "$1" sed awk export /usr/bin $(pwd) ${HOME}
+		done cd export x=1 "$1" done echo && cd awk
+		2>/dev/null | 'quoted text' grep
+	local $(pwd) /usr/bin done awk "$1" cd export local
+		echo ${HOME} /usr/bin sed "$@" ${HOME} --verbose | x=1
+		"$@" -eu grep sed /usr/bin readonly "$1" | $(pwd)
+grep 2>/dev/null $(pwd) /usr/bin export /usr/bin 'quoted text' ${HOME} cd readonly
+&& export done grep printf 'quoted text' test "$1" -eu
+		2>/dev/null 2>/dev/null local local readonly printf 2>/dev/null
+	echo -eu grep printf "$1" ${HOME}
+		printf awk x=1 sed /usr/bin | done printf $(pwd) /usr/bin
+		${HOME} printf --verbose x=1 local "$1"
+		sed && "$@" 'quoted text' "$1" "$1" local echo 2>/dev/null
+		-eu readonly "$1" 'quoted text' 2>/dev/null
+	test then done local grep && -eu "$1" | --verbose 2>/dev/null
+		grep $(pwd) "$@" --verbose
+	'quoted text' ${HOME} $(pwd) "$1" echo export export
+readonly /usr/bin test -eu --verbose 2>/dev/null then ${HOME}
+		readonly then readonly --verbose | "$@" printf $(pwd) export $(pwd)
+"$@" readonly | cd ${HOME} local printf 'quoted text' sed awk echo printf
+		local -eu -eu awk done x=1 "$@" sed 2>/dev/null awk 'quoted text' awk printf
+2>/dev/null local "$1" export 2>/dev/null /usr/bin done "$@" then cd "$1" then |
+printf export awk x=1 local 'quoted text'
+	then x=1 readonly x=1 ${HOME} --verbose printf export export local echo -eu local
+export && | x=1 --verbose -eu -eu ${HOME} grep sed local
+	$(pwd) export && "$@" then && local -eu local 2>/dev/null
+"$1" export sed "$@" test
+sed echo cd ${HOME} -eu /usr/bin cd export ${HOME} printf -eu test $(pwd) 'quoted text'
+	&& | then ${HOME} "$1" readonly cd printf
+awk && /usr/bin && cd test | 'quoted text' then ${HOME} grep echo then printf
+"$1" sed awk cd test echo echo printf
+		/usr/bin export awk sed local 'quoted text'
+		cd "$@" x=1 then grep ${HOME} /usr/bin sed 2>/dev/null then then
+		-eu then echo $(pwd) export sed --verbose "$1"
+	| awk /usr/bin /usr/bin /usr/bin $(pwd) done 'quoted text' 'quoted text'
+		"$1" $(pwd) local "$1" /usr/bin local 2>/dev/null
+'quoted text' /usr/bin sed then ${HOME}
+		| readonly done -eu local /usr/bin 2>/dev/null 'quoted text' /usr/bin
+	"$@" grep then ${HOME} ${HOME} local awk | sed echo "$1" grep /usr/bin printf
+--verbose 'quoted text' /usr/bin echo export printf
+		grep | --verbose then && echo printf
+-eu $(pwd) local sed echo sed sed ${HOME} | then cd grep local 2>/dev/null
+	printf done grep --verbose && "$@" awk "$@"
+	/usr/bin "$@" cd -eu && then grep -eu readonly $(pwd) -eu &&
+	then sed | 'quoted text' 'quoted text' local ${HOME} x=1 printf
+$(pwd) printf grep then
+		awk $(pwd) "$@" "$@" done
+test awk local -eu $(pwd) /usr/bin then cd grep done /usr/bin $(pwd) /usr/bin
+	awk awk x=1 --verbose ${HOME} ${HOME} echo "$1" "$@" then export
+	"$1" -eu --verbose --verbose
+		/usr/bin && "$1" readonly "$@" $(pwd) done grep test | grep grep test
+test readonly -eu then done then 'quoted text' && cd export printf
+	--verbose readonly test $(pwd)
+'quoted text' awk local
+awk "$@" awk export readonly
+		"$1" sed awk x=1 && readonly /usr/bin
+then && printf "$1" export 'quoted text' cd grep
+	local awk readonly awk x=1 then 'quoted text' "$@" sed
+${HOME} "$@" local && 2>/dev/null awk test |
+	--verbose | --verbose ${HOME}
+--verbose && -eu 2>/dev/null
+	export --verbose "$@" sed export ${HOME}
+		printf grep "$1" x=1 | export cd --verbose -eu
+	then printf 'quoted text' /usr/bin echo x=1 /usr/bin printf x=1 printf done awk
+	"$1" awk done then x=1 --verbose
+	$(pwd) readonly $(pwd) "$@" cd --verbose awk /usr/bin && x=1 | --verbose
+	&& --verbose | cd sed "$@"
+	cd readonly awk done echo local
+		x=1 && awk "$1" export x=1 grep --verbose --verbose "$1" | echo readonly echo
+	test awk export awk $(pwd) $(pwd) grep local | 'quoted text'
+	done export | x=1 awk 2>/dev/null cd /usr/bin readonly /usr/bin $(pwd)
+		x=1 x=1 test -eu awk local printf cd "$1" | -eu
+		grep x=1 local 2>/dev/null --verbose x=1 /usr/bin 'quoted text'
+		--verbose "$1" local grep /usr/bin "$1" 2>/dev/null "$@"
+		export local ${HOME} readonly 'quoted text' awk printf grep $(pwd)
+		local export export /usr/bin echo printf && /usr/bin awk ${HOME} &&
+		&& readonly ${HOME} "$@" test awk export "$1" grep done
+	"$@" -eu /usr/bin /usr/bin done printf grep $(pwd) | x=1
+${HOME} --verbose test printf readonly cd | printf -eu 'quoted text'
+${HOME} /usr/bin ${HOME} export 2>/dev/null "$@" export --verbose echo
+	"$1" readonly $(pwd) x=1
+		'quoted text' --verbose sed readonly | ${HOME} grep done
+test 2>/dev/null $(pwd) | -eu local export echo -eu grep /usr/bin "$@"
+x=1 grep --verbose 2>/dev/null printf printf x=1
+		awk awk cd echo "$1" grep --verbose sed cd "$1" $(pwd) sed
+'quoted text' export $(pwd) grep $(pwd) awk cd -eu done done
+		"$@" x=1 --verbose done readonly /usr/bin && 'quoted text'
+		awk export "$1" then x=1 x=1 /usr/bin --verbose printf then -eu export sed
+		then $(pwd) $(pwd) ${HOME} && $(pwd) then echo
+	awk 'quoted text' x=1 "$@" && printf cd ${HOME} grep | then echo local cd export
+	"$1" done $(pwd) ${HOME} printf done "$1" $(pwd) 2>/dev/null printf x=1
+	&& -eu $(pwd) --verbose "$1" "$@" done x=1 export "$@" "$1" 'quoted text' readonly
+"$@" local -eu grep --verbose $(pwd) echo local -eu export
+		&& "$1" printf ${HOME} "$@" export then --verbose printf printf x=1 ${HOME} "$1"
+sed ${HOME} readonly -eu readonly awk $(pwd) test echo
+		export local printf cd x=1 x=1 /usr/bin export
+		sed awk cd printf | awk "$@" grep x=1 $(pwd) cd sed test sed done grep local
+&& "$@" then "$@" 'quoted text'
+awk "$1" awk $(pwd) -eu
+x=1 grep awk echo /usr/bin
+		test sed $(pwd) --verbose test "$1" then readonly ${HOME} awk 2>/dev/null ${HOME}
+		&& grep -eu /usr/bin test
+printf ${HOME} then 2>/dev/null
+printf readonly local "$1" $(pwd) "$1" grep 2>/dev/null
+		-eu then test readonly $(pwd) -eu done test local 2>/dev/null
+	done readonly cd x=1 'quoted text'
+	local ${HOME} then && sed 'quoted text'
+	echo export cd 2>/dev/null printf echo 2>/dev/null
+		--verbose grep done echo -eu export 'quoted text' sed && sed x=1 local
+		done && readonly && -eu /usr/bin
+		local test done x=1 "$1" readonly 2>/dev/null readonly test -eu
+		2>/dev/null 'quoted text' /usr/bin cd
+export done "$@" x=1 local printf printf echo |
+		"$@" && 2>/dev/null cd 'quoted text' echo readonly then /usr/bin done echo echo
+local && echo then test 2>/dev/null "$@"
+		"$@" | then "$@" $(pwd) ${HOME} "$@" x=1 $(pwd) cd ${HOME} then then -eu &&
+	local local cd done --verbose $(pwd) | then | &&
+readonly export echo | echo cd sed then sed
+	done readonly 'quoted text' "$@" then | /usr/bin readonly
+		'quoted text' /usr/bin awk && echo /usr/bin
+	sed sed "$@" cd awk "$@" awk readonly --verbose sed cd | then test x=1 /usr/bin
+	&& x=1 sed -eu export grep grep 'quoted text'
+	/usr/bin | grep -eu "$@" awk x=1 /usr/bin grep ${HOME}
+		test test awk x=1 export local "$@" x=1 echo export grep -eu ${HOME}
+cd then test | -eu $(pwd) x=1
+	grep -eu grep "$1" /usr/bin ${HOME}
+		readonly | awk -eu local ${HOME} $(pwd) --verbose printf echo local then
+"$@" awk "$1" export "$1" x=1 test 'quoted text'
+		-eu then awk local "$@" -eu cd readonly | sed x=1 "$@" readonly readonly awk
+		"$@" done test | grep readonly
+		x=1 x=1 /usr/bin ${HOME} "$1" export
+done export local $(pwd) done grep 2>/dev/null && readonly
+		then sed export -eu && then echo local done test 2>/dev/null printf export
+-eu local "$1" | local cd x=1 test
+printf sed echo cd grep $(pwd) awk -eu "$@" local done -eu "$1" "$1" | cd -eu then
+$(pwd) | awk test local readonly 'quoted text' echo
+		local sed $(pwd) ${HOME}
+	| grep printf 2>/dev/null
+	"$@" $(pwd) readonly -eu &&
+		printf --verbose x=1 echo $(pwd) printf awk --verbose "$1"
+cd echo ${HOME} cd /usr/bin $(pwd) then
+	"$1" test local --verbose -eu printf test
+	"$1" grep test grep cd 2>/dev/null local
+/usr/bin cd "$1" then && export printf sed sed done "$1"
+	-eu | printf $(pwd) export $(pwd) -eu ${HOME} then done $(pwd)
+		grep 2>/dev/null echo printf "$1" --verbose -eu /usr/bin /usr/bin echo 2>/dev/null
+test --verbose 'quoted text'
+	done --verbose sed "$1" 2>/dev/null --verbose ${HOME} "$@"
+		'quoted text' done test --verbose "$@" test --verbose
+cd cd grep export --verbose $(pwd)
+	test export awk "$@" -eu awk export $(pwd) 2>/dev/null local
+	--verbose export then cd readonly awk
+		"$@" test awk grep && export $(pwd) "$@"
+		echo x=1 printf $(pwd) "$1" awk ${HOME} export then sed echo test && readonly awk
+	-eu 'quoted text' x=1 'quoted text'
+${HOME} 2>/dev/null done x=1 grep x=1 x=1 printf && then ${HOME} done $(pwd) echo
+awk test -eu "$@" x=1 ${HOME}
+		--verbose awk grep local echo /usr/bin cd /usr/bin
+readonly ${HOME} done --verbose
+/usr/bin "$1" x=1 2>/dev/null readonly readonly
+	awk awk "$@" /usr/bin cd test done done 'quoted text'
+	export then then $(pwd) then grep x=1 local $(pwd) x=1 local
+		2>/dev/null "$@" -eu cd echo | "$@" | x=1 test "$@" test readonly printf test
+		| sed ${HOME} sed "$1" sed 'quoted text' x=1 readonly "$1" sed /usr/bin local
+		sed echo ${HOME} -eu | x=1 cd /usr/bin awk awk -eu "$@" awk "$@" x=1 export printf
+		echo then readonly printf cd awk 'quoted text' awk grep
+	then echo && grep --verbose readonly done sed export --verbose
+'quoted text' local | done x=1 "$@" local
+	echo printf 'quoted text' sed && --verbose
+		"$@" grep ${HOME} test | --verbose "$@" "$1" --verbose local x=1
+	| "$1" $(pwd) "$1" && ${HOME} cd sed awk then "$@" local /usr/bin
+	/usr/bin -eu && cd x=1
+	| /usr/bin && printf awk done --verbose
+		--verbose ${HOME} printf awk sed $(pwd) x=1 /usr/bin then /usr/bin cd
+$(pwd) --verbose grep "$1" sed then -eu && && cd 'quoted text'
+	&& echo printf readonly done grep
+		'quoted text' 'quoted text' sed x=1 'quoted text' $(pwd) "$1" && readonly x=1
+		| local export ${HOME} grep $(pwd) printf then
+cd local export echo --verbose export echo x=1 x=1 sed readonly $(pwd) /usr/bin
+| x=1 --verbose "$@" then echo 'quoted text'
+		printf x=1 2>/dev/null echo local "$1"
+	printf | echo awk "$@" awk grep -eu sed export local local awk awk -eu test &&
+		awk echo printf echo readonly
+'quoted text' 2>/dev/null echo export
+echo -eu awk && | --verbose --verbose
+"$@" export | "$1" ${HOME} echo done && printf export -eu && cd
+	${HOME} -eu 2>/dev/null "$1" then 2>/dev/null sed export
+		2>/dev/null x=1 2>/dev/null x=1
+	${HOME} printf /usr/bin
+readonly -eu export 2>/dev/null x=1 'quoted text'
+	/usr/bin 2>/dev/null awk -eu ${HOME}
+-eu grep /usr/bin test export
+	cd done grep "$@" test 2>/dev/null /usr/bin sed "$1" then printf 2>/dev/null
+	-eu ${HOME} echo "$1" echo
+		${HOME} -eu --verbose
+	cd printf grep export
+$(pwd) grep | --verbose echo then cd done sed grep test ${HOME} ${HOME}
+		awk "$@" $(pwd) sed -eu then then "$@" && | x=1 2>/dev/null sed x=1 x=1
+readonly done echo sed awk awk readonly echo readonly $(pwd) | "$1" export sed
+	"$1" grep cd $(pwd) sed printf | awk -eu done
+	${HOME} readonly export 2>/dev/null
+| local sed printf 2>/dev/null -eu --verbose
+	"$1" export readonly $(pwd) | grep grep ${HOME} --verbose echo
+| awk && export export sed && readonly
+| cd grep && test then test export local --verbose
+		| local ${HOME} test export readonly sed grep readonly then
+	--verbose "$@" test --verbose 'quoted text' readonly awk $(pwd) readonly
+| ${HOME} cd | $(pwd) printf test done 2>/dev/null
+grep /usr/bin 2>/dev/null local 2>/dev/null
+		$(pwd) -eu sed sed readonly
+		cd echo && awk then cd 2>/dev/null
+test grep sed $(pwd) "$1"
+	readonly echo 2>/dev/null cd 2>/dev/null 2>/dev/null 2>/dev/null && awk -eu readonly
+export local awk sed /usr/bin done 'quoted text' -eu | sed
+'quoted text' 'quoted text' test grep local ${HOME} export | sed then
+| echo awk awk test x=1 cd export local grep test readonly grep awk 2>/dev/null
+-eu 'quoted text' x=1 printf test grep "$@"
+	awk x=1 "$@" sed printf test test
+	2>/dev/null test export echo
+	export "$@" cd printf 'quoted text'
+local "$@" --verbose ${HOME} cd printf test
+	/usr/bin "$1" --verbose sed | && /usr/bin "$1" --verbose "$@" 2>/dev/null
+	'quoted text' ${HOME} readonly "$@" "$@"
+awk 2>/dev/null --verbose -eu grep 'quoted text' echo
+"$@" cd cd -eu --verbose -eu then ${HOME} export readonly
+export "$@" local cd | awk echo local printf readonly echo --verbose
+sed local x=1 awk local ${HOME} done readonly readonly readonly 2>/dev/null
+		${HOME} --verbose grep ${HOME} | done
+	--verbose export && readonly export /usr/bin ${HOME}
+cd echo done $(pwd) && local $(pwd) /usr/bin then local --verbose
+test printf "$@" local "$@" readonly 2>/dev/null
+		${HOME} done test awk --verbose -eu x=1 /usr/bin && --verbose done
+		awk && $(pwd) export sed "$1" export awk 2>/dev/null /usr/bin
+	/usr/bin "$@" ${HOME} then "$@" | "$1" 2>/dev/null
+		printf test readonly grep grep x=1
+		echo awk 2>/dev/null readonly printf
+	'quoted text' ${HOME} "$@" && $(pwd) "$1" done 'quoted text' "$1" cd done
+--verbose | -eu 'quoted text' -eu $(pwd) sed echo readonly done x=1 /usr/bin
+	"$1" --verbose local then | | test done test then --verbose
+	export | grep echo then grep cd $(pwd) test 'quoted text' then awk $(pwd)
+	then test /usr/bin awk --verbose readonly grep export -eu "$@" -eu 2>/dev/null
+		"$1" | | $(pwd) -eu local then done /usr/bin
+export --verbose sed echo /usr/bin export export 'quoted text'
+done 2>/dev/null cd then grep -eu local sed test local then x=1 -eu
+		-eu cd 'quoted text' export done local local 'quoted text'
+local /usr/bin "$1" "$1" printf grep awk 2>/dev/null printf 2>/dev/null
+		2>/dev/null x=1 test readonly x=1 local && && then test cd "$@" && $(pwd)
+	awk $(pwd) grep echo $(pwd) printf printf
+	then | 2>/dev/null readonly printf $(pwd) test 2>/dev/null awk test "$1" "$@"
+		local ${HOME} && 'quoted text' local printf sed --verbose 'quoted text'
+	grep | test 'quoted text' $(pwd) "$@" printf
+		readonly sed ${HOME} done 'quoted text' -eu sed && &&
+/usr/bin /usr/bin 2>/dev/null |
+	sed /usr/bin local -eu readonly then done -eu cd done done echo cd echo
+local "$@" | printf x=1 sed done x=1 2>/dev/null local $(pwd) &&
+'quoted text' done --verbose 2>/dev/null | sed $(pwd) printf
+	done "$@" 2>/dev/null awk ${HOME} awk ${HOME}
+then --verbose echo cd awk $(pwd) grep
+	/usr/bin 'quoted text' -eu grep export
+"$1" --verbose then echo sed && done --verbose grep then cd -eu done sed grep 'quoted text'
+		'quoted text' --verbose sed /usr/bin --verbose then then printf
+${HOME} echo cd "$1" /usr/bin grep done "$@" x=1 x=1 | printf
+	grep /usr/bin /usr/bin local && 2>/dev/null -eu printf
+| "$1" cd test 2>/dev/null readonly 2>/dev/null
+export grep readonly x=1 $(pwd) --verbose then ${HOME} echo printf $(pwd) "$@" "$@"
+		awk done awk then sed export sed done 2>/dev/null export x=1 2>/dev/null
+		readonly then export
+		'quoted text' && -eu echo
+		cd 'quoted text' test $(pwd) $(pwd) -eu && --verbose readonly 2>/dev/null readonly
+test ${HOME} sed | 2>/dev/null export cd "$@"
+/usr/bin readonly local echo --verbose $(pwd)
+	&& test --verbose printf readonly 'quoted text' then done "$1" | 2>/dev/null sed
+"$1" "$@" export -eu --verbose sed | | printf then
+		-eu 2>/dev/null | then export x=1 'quoted text'
+		"$@" then -eu grep /usr/bin
+cd then test local printf
+	awk export awk done local x=1 awk && test -eu then "$1"
+then -eu export test local echo export printf 2>/dev/null done echo
+then /usr/bin -eu sed && ${HOME} then sed "$@" grep 'quoted text' | cd awk "$@"
+export | | 'quoted text' --verbose
+	| --verbose ${HOME} /usr/bin "$1"
+x=1 readonly local ${HOME} x=1 cd
+"$1" --verbose export ${HOME} "$@" 2>/dev/null
+/usr/bin cd "$@" | done /usr/bin "$@"
+x=1 local $(pwd) /usr/bin "$1" then local printf $(pwd)
+done -eu awk ${HOME} readonly done
+	done awk $(pwd) ${HOME} $(pwd) $(pwd) $(pwd)
+-eu "$@" --verbose -eu printf | then
+	--verbose && cd done then test -eu export
+x=1 readonly grep "$1" 'quoted text' printf
+&& x=1 local readonly /usr/bin x=1 echo ${HOME} export && then 'quoted text'
+awk 'quoted text' readonly "$1"
+	'quoted text' x=1 && 'quoted text' ${HOME} && readonly | done $(pwd) && | "$1"
+	echo x=1 | printf "$@" echo printf sed -eu --verbose cd -eu echo
+	"$1" cd -eu /usr/bin && /usr/bin
+		printf export --verbose sed 2>/dev/null export test && --verbose
+		echo ${HOME} export && printf /usr/bin ${HOME}
+local 2>/dev/null printf
+		printf $(pwd) grep /usr/bin
+2>/dev/null --verbose "$1" && | cd then echo | --verbose export "$1" awk cd
+	then awk 'quoted text' export cd $(pwd) 2>/dev/null 'quoted text' 2>/dev/null
+		-eu "$@" x=1 "$@" "$1" $(pwd) |
+test printf awk local 'quoted text' cd printf
+	export ${HOME} echo "$1" echo $(pwd) awk sed
+	"$@" "$1" $(pwd) sed |
+printf awk "$1" local -eu --verbose echo
+	local export $(pwd) export "$@" && 2>/dev/null
+		--verbose "$1" cd export x=1 --verbose
+		x=1 $(pwd) grep "$@" --verbose $(pwd) && export
+	x=1 awk -eu done cd echo done sed x=1 export
+		test awk awk export printf --verbose
+--verbose 2>/dev/null test done -eu readonly
+		test 'quoted text' grep /usr/bin | test local awk printf x=1 -eu $(pwd) 2>/dev/null
+		--verbose then --verbose 2>/dev/null done x=1
+	/usr/bin readonly "$@"
+	then then 2>/dev/null /usr/bin
+		awk cd test && printf "$@" cd local "$@" && 2>/dev/null
+		${HOME} $(pwd) sed $(pwd)
+$(pwd) cd && ${HOME} 'quoted text' --verbose printf 2>/dev/null /usr/bin
+$(pwd) "$@" readonly ${HOME} then | test 'quoted text'
+	grep echo $(pwd) export --verbose
+sed | cd readonly grep local $(pwd) done ${HOME}
+-eu local test test --verbose
+	awk && echo --verbose && then then 'quoted text' sed sed $(pwd) &&
+	2>/dev/null grep "$@" local "$1" echo readonly 2>/dev/null readonly readonly
+-eu "$1" | local readonly "$@" ${HOME} 'quoted text' done readonly "$1" echo
+	'quoted text' $(pwd) /usr/bin then $(pwd) done x=1 then
+2>/dev/null printf test x=1 | echo /usr/bin local grep 'quoted text' readonly
+	| $(pwd) local grep local /usr/bin x=1 echo
+local | $(pwd) | | echo readonly done readonly
+| "$@" test awk ${HOME} | readonly /usr/bin readonly
+	printf echo 2>/dev/null --verbose ${HOME} "$1" readonly local
+done export export test
+	&& cd done "$1" done --verbose printf "$1" x=1 awk "$@" awk -eu
+/usr/bin then "$1" echo then /usr/bin printf awk $(pwd) export
+	echo | 'quoted text' sed 'quoted text'
+/usr/bin echo -eu | x=1 echo
+		done awk ${HOME} "$@" awk readonly 'quoted text' && grep $(pwd)
+echo local x=1 | $(pwd) done --verbose $(pwd) done
+"$@" grep local && -eu echo echo sed sed /usr/bin done readonly
+		x=1 ${HOME} && awk "$@" "$@" $(pwd) && readonly 'quoted text'
+	local cd test done local ${HOME} x=1 "$1" local readonly then
+		$(pwd) 'quoted text'
+"$1" awk -eu cd x=1 ${HOME} echo x=1 --verbose 'quoted text'
+		cd then 'quoted text' grep printf 'quoted text' --verbose grep
+printf printf --verbose cd 'quoted text' 'quoted text'
+local 2>/dev/null ${HOME} x=1 "$1" --verbose done "$1" ${HOME} -eu printf
+$(pwd) test grep test awk x=1
+	2>/dev/null && cd x=1 export "$@" awk local 'quoted text' "$1" cd ${HOME}
+printf local ${HOME} /usr/bin
+		done local awk cd grep echo
+		"$@" cd local echo | -eu sed ${HOME} "$@" sed export cd cd -eu test 2>/dev/null
+'quoted text' "$1" -eu done && | -eu -eu x=1 x=1 && --verbose printf "$@" done
+	2>/dev/null -eu then sed
+	readonly local printf -eu done echo cd
+	readonly grep done 'quoted text' done "$1" done printf 'quoted text' ${HOME}
+		'quoted text' then ${HOME} done | 2>/dev/null --verbose -eu $(pwd) local grep awk
+		local local "$@" cd | "$@" x=1 export
+		'quoted text' /usr/bin --verbose
+	done test sed cd sed cd sed 2>/dev/null 2>/dev/null grep $(pwd) done sed test
+&& --verbose done "$1" echo /usr/bin --verbose cd echo /usr/bin export -eu "$1"
+	$(pwd) "$@" local "$@" export echo echo /usr/bin
+		local test echo $(pwd)
+	'quoted text' export export done
+local readonly && 2>/dev/null readonly test && 2>/dev/null
+sed $(pwd) "$1" $(pwd) /usr/bin done echo test "$@" grep cd
+	sed awk readonly | | 'quoted text' x=1 sed -eu then 'quoted text' /usr/bin "$@"
+	printf /usr/bin 2>/dev/null local sed -eu sed local
+	cd 'quoted text' sed readonly -eu
+	sed | 'quoted text' done test awk readonly cd echo "$@" printf done done "$@"
+		printf awk ${HOME} $(pwd) /usr/bin
+$(pwd) echo x=1 then awk "$@" sed $(pwd) export x=1 readonly $(pwd) awk
+		export --verbose awk printf awk local done export /usr/bin ${HOME} printf echo
+	awk "$1" local --verbose export sed then x=1
+"$@" sed export 2>/dev/null readonly -eu "$@" grep test test --verbose
+	--verbose local local x=1 local readonly
+		--verbose then $(pwd) then readonly
+		${HOME} $(pwd) 'quoted text' sed awk "$@" "$1" $(pwd) | "$1" 'quoted text' grep
+	-eu 'quoted text' cd --verbose cd readonly "$1" export && | 'quoted text'
+	"$@" test && "$1" awk --verbose -eu 'quoted text' test x=1
+		local readonly grep done echo
+readonly $(pwd) --verbose cd
+		/usr/bin awk done | $(pwd) ${HOME}
+		/usr/bin --verbose "$@" 'quoted text'
+	sed echo export 'quoted text' x=1 /usr/bin
+		grep grep "$@" awk "$@"
+		sed -eu local sed -eu x=1
+	printf awk | 2>/dev/null "$@" x=1 2>/dev/null ${HOME} $(pwd) ${HOME}
+"$1" /usr/bin /usr/bin --verbose ${HOME} /usr/bin /usr/bin ${HOME} "$@" grep
+	x=1 "$@" cd awk local readonly $(pwd) "$@" cd then -eu cd ${HOME} printf
+2>/dev/null "$@" 2>/dev/null "$1" 2>/dev/null
+		readonly /usr/bin test cd --verbose --verbose
+export test /usr/bin && | | && awk export "$1" "$@" && x=1 ${HOME}
+sed cd "$@" /usr/bin sed -eu 'quoted text' && x=1 "$1" cd
+cd 2>/dev/null readonly "$1" export awk
+"$@" cd local 2>/dev/null awk awk 2>/dev/null test export "$1"
+sed done 'quoted text' then -eu sed && -eu then done /usr/bin
+| 'quoted text' grep grep --verbose 2>/dev/null grep ${HOME} grep
+	readonly printf sed | echo "$1" "$1" printf "$@"
+	--verbose | export --verbose "$@" 2>/dev/null export
+printf done cd -eu -eu /usr/bin "$1" /usr/bin -eu -eu && sed cd 'quoted text'
+		printf 'quoted text' test | then local export readonly sed
+	${HOME} awk sed $(pwd) grep readonly then --verbose
+	--verbose done $(pwd) cd "$1" local "$@" | awk -eu ${HOME} printf
+	"$1" sed sed awk done done export -eu done readonly sed
+	"$1" | -eu printf x=1 export 2>/dev/null
+	&& "$1" ${HOME} grep --verbose
+		'quoted text' cd export
+	x=1 /usr/bin printf then 'quoted text' "$@" /usr/bin 2>/dev/null
+| then local x=1 x=1 readonly
+printf | ${HOME} cd 2>/dev/null --verbose
+"$@" -eu --verbose | cd 2>/dev/null grep local export export /usr/bin
+readonly grep ${HOME} done test
+		| local "$@" ${HOME} done local test /usr/bin
+sed then --verbose export echo x=1 cd --verbose readonly /usr/bin export readonly
+		export done then x=1 cd 'quoted text'
+"$1" done "$@" --verbose "$@" printf
+-eu local sed readonly cd ${HOME} -eu readonly -eu grep done export grep
+done sed readonly --verbose sed export
+	&& "$@" echo /usr/bin cd done printf | -eu --verbose grep | ${HOME} grep then grep
+	then then sed awk | then cd -eu 'quoted text' sed 2>/dev/null "$@"
+		done x=1 export export grep local | --verbose "$1" test
+${HOME} && x=1 readonly 'quoted text' export readonly "$@" && && "$1"
+	readonly sed done && && done /usr/bin
+		x=1 export grep grep x=1 test
+--verbose 2>/dev/null done -eu $(pwd) test | && cd local awk cd "$@" /usr/bin 2>/dev/null
+	${HOME} cd awk --verbose
+printf done -eu && awk cd -eu then
+$(pwd) cd x=1 test export | local "$1" sed "$@" then | -eu "$1" awk
+		-eu x=1 --verbose readonly
+		readonly echo --verbose then
+		'quoted text' export done cd
+	/usr/bin cd then printf "$1" sed x=1 x=1 "$1" done test
+echo 'quoted text' x=1 $(pwd)
+		sed $(pwd) ${HOME} cd grep sed --verbose export awk -eu printf grep
+		"$1" echo cd readonly && | grep ${HOME} local ${HOME}
+	/usr/bin awk local && 2>/dev/null done echo
+-eu test readonly && then "$@"
+	--verbose 2>/dev/null echo "$1" -eu grep readonly |
+		awk local $(pwd) echo | ${HOME} $(pwd) && then grep && --verbose cd x=1
+"$@" readonly "$1" printf
+'quoted text' echo grep | echo printf sed | ${HOME}
+	"$1" "$1" test --verbose 'quoted text' export ${HOME}
+awk cd | -eu done local --verbose "$@" sed grep ${HOME} echo
+	sed sed $(pwd) readonly
+local grep test grep $(pwd) /usr/bin test 'quoted text' ${HOME} done --verbose
+	| | "$1" "$@" "$@" | awk export ${HOME} "$1"
+		export 'quoted text' "$1" && export | /usr/bin test awk "$@" echo
+${HOME} 2>/dev/null "$@" cd grep /usr/bin ${HOME} 2>/dev/null local local
+done cd echo -eu done && readonly export --verbose readonly
+		printf 'quoted text' 2>/dev/null readonly done 'quoted text'
+"$@" export && test printf "$1"
+$(pwd) -eu --verbose readonly ${HOME} /usr/bin "$1" readonly
+grep grep test 'quoted text' then
+	awk /usr/bin then x=1 sed echo && done "$@" cd echo
+		grep "$@" grep /usr/bin && $(pwd) echo test awk cd export local ${HOME}
+		${HOME} ${HOME} /usr/bin 'quoted text' "$1" 'quoted text'
+&& "$@" "$1" /usr/bin x=1 ${HOME} printf readonly local sed --verbose
+		"$1" echo grep "$@" then | /usr/bin grep test 'quoted text' x=1 /usr/bin grep
+2>/dev/null printf x=1 readonly echo ${HOME} printf && |
+		/usr/bin && | /usr/bin then local --verbose local && grep awk -eu echo
+	/usr/bin "$@" echo && /usr/bin 'quoted text'
+--verbose 2>/dev/null export | ${HOME} sed readonly 'quoted text' test
+		"$1" $(pwd) done | local then
+"$@" sed -eu test "$1" sed | cd $(pwd) --verbose sed "$@" sed test /usr/bin
+'quoted text' test | test sed
+&& /usr/bin readonly printf printf "$1" grep
+		local grep awk grep printf ${HOME} cd "$@" export x=1 | | && awk readonly
+'quoted text' done 'quoted text' export /usr/bin --verbose
+cd test printf 'quoted text' then $(pwd) --verbose
+		export readonly echo && grep -eu | x=1 'quoted text'
+'quoted text' awk test then echo /usr/bin /usr/bin export && done "$@"
+readonly awk grep export test awk | && sed cd ${HOME}
+$(pwd) 'quoted text' /usr/bin printf done "$1"
+	--verbose echo --verbose readonly readonly sed sed sed
+done sed /usr/bin readonly 2>/dev/null 2>/dev/null grep printf
+awk readonly done --verbose
+		--verbose export done --verbose "$@" x=1 awk done $(pwd) 2>/dev/null
+	grep --verbose echo "$@" ${HOME} -eu sed test test printf ${HOME}
+readonly 2>/dev/null "$1" printf
+		$(pwd) -eu echo done 2>/dev/null
+	$(pwd) done awk 'quoted text' cd 'quoted text'
+	'quoted text' export
+		sed 'quoted text' && export
+${HOME} local "$1" awk export "$1" "$1" export local printf
+$(pwd) && sed $(pwd) printf readonly awk ${HOME} echo x=1 then | test cd $(pwd)
+	then $(pwd) "$@" readonly ${HOME} -eu done ${HOME} $(pwd) /usr/bin
+grep 'quoted text' then --verbose
+		local -eu ${HOME} 2>/dev/null -eu cd local done 'quoted text' 2>/dev/null
+		$(pwd) test ${HOME} test export 2>/dev/null
+	'quoted text' /usr/bin then | test done printf done readonly grep 'quoted text'
+	test | export /usr/bin
+readonly sed /usr/bin cd awk printf export test then -eu "$1" && x=1
+&& $(pwd) "$1" x=1 $(pwd) -eu /usr/bin sed && ${HOME} sed -eu
+readonly 'quoted text' printf 'quoted text' export 'quoted text' local && /usr/bin
+		readonly -eu readonly export
+	2>/dev/null /usr/bin local printf -eu && sed printf printf --verbose && --verbose
+	then grep -eu readonly readonly then 'quoted text'
+		${HOME} -eu /usr/bin printf test then readonly /usr/bin
+		readonly awk sed grep $(pwd) 2>/dev/null /usr/bin x=1 printf echo
+		2>/dev/null -eu cd 'quoted text' sed printf ${HOME}
+		x=1 ${HOME} "$@" -eu 'quoted text' -eu ${HOME} grep printf
+printf ${HOME} export "$@" x=1 | | test printf |
+	| then done sed | awk -eu printf /usr/bin 2>/dev/null x=1
+		/usr/bin printf printf 'quoted text' sed $(pwd) cd readonly export readonly printf
+echo -eu $(pwd) awk test awk && 2>/dev/null 'quoted text'
+	'quoted text' echo 2>/dev/null export $(pwd)
+		printf then 'quoted text' "$@" sed -eu /usr/bin -eu x=1 export
+	echo x=1 grep grep | then then /usr/bin test sed ${HOME} --verbose
+		2>/dev/null cd then cd printf sed local /usr/bin $(pwd) x=1 2>/dev/null cd
+&& export /usr/bin | && "$@" "$@" "$@" x=1 x=1 --verbose x=1
+2>/dev/null cd printf
+	2>/dev/null ${HOME} echo
+	then 2>/dev/null /usr/bin done cd --verbose ${HOME} | -eu
+	export awk && x=1 $(pwd) export readonly local x=1 awk printf 'quoted text'
+	$(pwd) /usr/bin /usr/bin sed local readonly echo -eu 'quoted text'
+		2>/dev/null local --verbose | "$@" | /usr/bin done x=1 --verbose "$1" $(pwd)
+grep ${HOME} sed export test -eu cd ${HOME} then &&
+	awk "$1" && ${HOME} grep --verbose echo "$@" cd done | export
+	"$1" printf cd awk /usr/bin readonly && $(pwd)
+		done -eu | --verbose $(pwd) sed local done $(pwd) grep readonly | /usr/bin
+		&& ${HOME} test export $(pwd)
+		'quoted text' done printf printf /usr/bin 2>/dev/null local local -eu && &&
+	local test "$@" 2>/dev/null readonly
+		&& /usr/bin $(pwd) $(pwd) $(pwd) "$1" export
+	x=1 'quoted text' "$1" printf "$@" 'quoted text' ${HOME}
+	&& -eu echo awk awk grep cd && sed awk --verbose
+		done "$1" done && export then --verbose
+		echo awk /usr/bin test $(pwd) x=1 'quoted text'
+		cd sed grep export "$@" /usr/bin 2>/dev/null && 'quoted text'
+	readonly readonly test printf /usr/bin && cd readonly local
+	x=1 2>/dev/null export echo
+		export 'quoted text' |
+		2>/dev/null /usr/bin x=1
+export sed test $(pwd) "$1"
+	export test printf 'quoted text' printf 2>/dev/null
+	local awk | --verbose awk awk
+	export 2>/dev/null echo 2>/dev/null
+	then "$1" ${HOME} test x=1 x=1 sed printf "$1" awk 'quoted text' then local /usr/bin
+/usr/bin && x=1 --verbose 'quoted text' echo local
+done grep export --verbose grep $(pwd) | --verbose "$@" $(pwd) |
+export awk "$@" done | "$1" x=1 cd local test
+	--verbose --verbose awk "$1" /usr/bin awk then
+		| test x=1 $(pwd) /usr/bin ${HOME} local test grep
+echo sed "$1" x=1 2>/dev/null
+"$1" && export readonly "$@" export $(pwd) test /usr/bin
+		x=1 then echo local -eu done
+	&& "$1" ${HOME} grep grep grep
+	export readonly done sed
+		| printf 2>/dev/null printf grep /usr/bin echo grep && readonly
+&& cd /usr/bin --verbose "$@" readonly readonly "$1" awk grep printf test
+		cd printf -eu | test echo export && readonly
+		printf export cd -eu $(pwd) echo test
+"$@" 2>/dev/null x=1 test ${HOME} --verbose $(pwd) &&
+	"$@" awk test printf x=1 $(pwd) 'quoted text' readonly done awk cd ${HOME} "$1"
+	/usr/bin local then readonly 'quoted text' echo readonly && ${HOME}
+	"$@" echo done test echo grep
+		| 'quoted text' export test x=1 echo test echo
+	-eu 'quoted text' local then ${HOME} cd "$1"
+| --verbose test export ${HOME} 'quoted text' -eu
+awk /usr/bin done "$@" cd
+grep | /usr/bin cd grep test --verbose local 2>/dev/null
+then $(pwd) echo x=1 x=1 readonly
+x=1 grep done cd awk | awk 'quoted text' then --verbose echo
+		"$1" && cd then awk sed "$1" 'quoted text' printf
+		printf /usr/bin -eu awk 'quoted text' grep
+		sed done sed echo done -eu awk cd done readonly
+		${HOME} /usr/bin grep x=1 export done -eu echo
+	test export ${HOME} awk "$@" sed done "$@" echo
+		test readonly test awk 'quoted text' cd 'quoted text' sed then cd then
+	test x=1 printf $(pwd) echo done 'quoted text'
+		x=1 awk "$1" $(pwd) x=1 echo awk $(pwd) readonly sed export 2>/dev/null sed
+&& printf -eu sed readonly x=1 sed /usr/bin grep export echo done then x=1
+		${HOME} printf | test awk x=1 export "$1" test grep -eu local grep then && then
+cd awk "$1" sed awk /usr/bin
+	done 'quoted text' sed -eu 2>/dev/null then printf x=1 --verbose
+cd grep export /usr/bin 2>/dev/null
+	local -eu | --verbose "$@" ${HOME} sed grep | export grep test ${HOME} x=1
+x=1 echo ${HOME} "$1" && awk "$@" grep local local readonly then --verbose 2>/dev/null
+		cd ${HOME} "$1" ${HOME} -eu then done test
+	cd /usr/bin cd test "$@" export test
+awk done 'quoted text' export sed readonly
+cd /usr/bin ${HOME} printf | done "$1" cd echo grep --verbose
+		| printf readonly -eu export export x=1 $(pwd) ${HOME} cd --verbose sed sed
+		sed | printf cd /usr/bin 2>/dev/null sed sed then
+--verbose $(pwd) cd test cd 2>/dev/null local x=1
+local sed x=1 2>/dev/null 'quoted text'
+	"$1" "$@" 2>/dev/null 2>/dev/null local && &&
+sed echo /usr/bin x=1 done test 'quoted text' sed
+		x=1 --verbose 'quoted text' echo | 2>/dev/null $(pwd) ${HOME} grep
+		done --verbose "$@" $(pwd) local local
+	2>/dev/null 'quoted text' test /usr/bin |
+	x=1 && "$1" $(pwd) export 'quoted text' 2>/dev/null "$1" "$1" "$1" awk
+		"$1" cd echo readonly readonly then test grep --verbose
+		2>/dev/null x=1 && ${HOME} ${HOME} test export $(pwd) then echo
+| test readonly export --verbose "$1" 'quoted text' "$@" ${HOME}
+${HOME} 2>/dev/null readonly then | && ${HOME} 'quoted text' 2>/dev/null local
+	--verbose && awk local x=1 echo &&
+	${HOME} done /usr/bin test awk
+	sed readonly export "$1"
+$(pwd) | cd "$@" | 'quoted text' 'quoted text' done then sed /usr/bin
+2>/dev/null | export | 'quoted text' echo /usr/bin test 'quoted text'
+	done test done test | 'quoted text' cd readonly | awk sed 2>/dev/null "$@"
+		test awk -eu readonly "$@" && --verbose --verbose "$1" "$@" x=1
+		--verbose && cd export x=1 ${HOME} 2>/dev/null test -eu -eu | 'quoted text'
+	${HOME} cd test sed && x=1 awk "$1" echo && printf x=1 && && /usr/bin
+	echo cd && export 2>/dev/null -eu cd /usr/bin awk echo sed done /usr/bin
+		x=1 awk echo test 2>/dev/null | then printf && grep local "$@"
+		2>/dev/null "$1" 'quoted text' test cd x=1 | printf
+&& 'quoted text' | 2>/dev/null /usr/bin x=1 then $(pwd) && "$@"
+		awk test "$1" then -eu echo printf /usr/bin grep awk
+	/usr/bin 'quoted text' 'quoted text' done cd export $(pwd)
+		| "$1" $(pwd) printf 2>/dev/null sed grep
+		test x=1 ${HOME} then awk then "$1"
+		cd sed x=1 'quoted text' x=1
+		2>/dev/null -eu 2>/dev/null awk "$1" 2>/dev/null --verbose done x=1 --verbose
+| export && test x=1 local | readonly grep printf done done
+	readonly then awk "$1" printf then cd printf ${HOME} cd printf sed cd awk echo cd
+		${HOME} echo x=1 ${HOME} "$1" "$1" 'quoted text'
+		sed export --verbose printf ${HOME} "$@" 'quoted text' then x=1 /usr/bin
+		"$1" 'quoted text' 'quoted text' | awk readonly
+	grep awk done printf export $(pwd) "$1" |
+	&& x=1 awk then ${HOME} 2>/dev/null -eu then "$@"
+local awk /usr/bin done cd done -eu test
+		2>/dev/null | "$1" --verbose 'quoted text'
+	2>/dev/null --verbose "$@" awk -eu readonly 2>/dev/null
+		| 2>/dev/null $(pwd) awk export echo grep x=1 $(pwd) readonly
+		'quoted text' done export sed x=1 cd
+		sed "$1" x=1 ${HOME} sed "$1" echo && cd awk
+	| readonly export $(pwd) && then
+	grep done ${HOME} local
+		"$@" | cd then echo 2>/dev/null --verbose local grep && "$1"
+		"$@" -eu /usr/bin readonly awk "$1" awk echo
+	then "$1" export sed && cd "$@" -eu 2>/dev/null cd awk x=1 echo grep grep
+	"$@" | && 2>/dev/null local sed --verbose cd cd export export local "$@" "$@"
+awk 2>/dev/null $(pwd) readonly && awk
+local test && /usr/bin grep done 'quoted text' export 'quoted text' sed cd test
+	/usr/bin 'quoted text' ${HOME} $(pwd) export export
+	&& test echo then "$@" awk ${HOME} x=1 then cd ${HOME}
+		--verbose 'quoted text' then grep printf export echo | x=1 "$@"
+	readonly cd "$1" readonly cd "$1" then then 2>/dev/null "$1" && echo export /usr/bin
+		cd grep ${HOME} | grep -eu cd then | "$1" 2>/dev/null "$@" | echo "$@" /usr/bin
+		'quoted text' test test then local sed /usr/bin x=1 "$1" echo
+	| printf 'quoted text'
+"$@" grep "$1" export done done "$@" grep echo
+		'quoted text' | --verbose awk "$@" | sed
+		'quoted text' done cd local --verbose readonly export --verbose cd
+grep then x=1 "$@" 2>/dev/null sed -eu && $(pwd) grep
+printf awk test ${HOME} "$1" test && -eu ${HOME} | readonly
+local export -eu x=1 echo 'quoted text' sed -eu cd readonly
+		cd local --verbose done $(pwd) -eu "$@" 'quoted text'
+local awk readonly export test "$@" --verbose printf readonly
+	$(pwd) | ${HOME} x=1 then "$1" "$@" export
+	awk -eu done cd grep ${HOME} && done export -eu && sed /usr/bin "$@" local | x=1
+		$(pwd) x=1 /usr/bin readonly local "$@" /usr/bin 2>/dev/null
+		awk echo ${HOME} $(pwd) 2>/dev/null readonly cd 'quoted text'
+2>/dev/null /usr/bin x=1 x=1 readonly echo then test
+local local readonly test export -eu 'quoted text'
+		awk export $(pwd) && readonly --verbose local then
+		grep local --verbose 2>/dev/null echo test ${HOME} -eu export "$@" 'quoted text'
+		done printf --verbose cd | awk "$@" $(pwd) then sed 'quoted text' sed printf
+test "$@" 'quoted text' | then
+printf 'quoted text' local grep 'quoted text' local awk printf
+		sed "$1" sed /usr/bin done grep test printf grep awk "$@" "$@" test
+		'quoted text' 2>/dev/null echo local x=1 'quoted text' local $(pwd) ${HOME}
+'quoted text' sed "$1" echo && $(pwd) sed cd 2>/dev/null
+	/usr/bin printf test grep then awk then grep then awk
+grep | printf export | -eu -eu "$@"
+/usr/bin /usr/bin --verbose 'quoted text'
+	-eu | echo local test printf printf
+		cd sed then "$1" sed grep done printf awk echo ${HOME} readonly
+		readonly sed && && ${HOME} export then export $(pwd) then ${HOME} -eu export
+		| sed done /usr/bin export ${HOME} test
+	${HOME} export "$1" done | awk grep $(pwd) /usr/bin | --verbose
+	then "$1" local cd export printf echo done
+cd local echo | then export readonly printf && done 2>/dev/null export
+--verbose then local "$1" -eu 2>/dev/null
+test $(pwd) "$@" export grep
+-eu test "$1" test echo test | cd echo /usr/bin "$@" -eu done && "$@" readonly
+	readonly local -eu "$1" "$1" | 'quoted text' x=1 |
+/usr/bin $(pwd) $(pwd) ${HOME} export x=1 done -eu
+sed 2>/dev/null "$@" --verbose x=1 2>/dev/null echo 2>/dev/null
+		then | cd awk | awk x=1 cd x=1 test grep sed
+"$1" then "$1" ${HOME} /usr/bin 2>/dev/null && 'quoted text' | done
+	&& echo x=1 readonly cd ${HOME}
+	done "$@" echo printf printf
+		&& 2>/dev/null local printf export export awk
+	awk sed /usr/bin echo
+		"$1" --verbose awk then done sed "$@" "$1" sed -eu then done test ${HOME}
+		readonly cd printf 2>/dev/null ${HOME} then local local | readonly printf test
+	| export | --verbose /usr/bin && echo printf awk done | --verbose x=1
+--verbose --verbose grep $(pwd) -eu printf
+export local /usr/bin
+	--verbose && then ${HOME} --verbose grep printf local
+	"$1" awk printf "$1"
+/usr/bin cd x=1 $(pwd) "$@" test printf
+	cd grep readonly -eu $(pwd) test --verbose x=1 cd
+"$1" awk echo sed awk printf --verbose | 'quoted text' --verbose "$1"
+2>/dev/null | readonly done grep done && then | done sed $(pwd)
+/usr/bin "$@" done x=1 sed x=1 awk then export "$@" 'quoted text'
+		2>/dev/null local then && x=1 awk echo readonly
+		'quoted text' sed | "$1" x=1 -eu echo cd |
+'quoted text' grep local printf ${HOME} && awk readonly x=1 --verbose
+	$(pwd) ${HOME} -eu cd 'quoted text' awk grep cd readonly /usr/bin "$@"
+	printf grep awk -eu cd cd --verbose -eu --verbose local /usr/bin test 'quoted text'
+		&& then ${HOME} x=1 /usr/bin | x=1 && | done ${HOME} x=1 | printf | cd x=1 sed
+	grep local "$1" x=1 ${HOME} $(pwd) "$@"
+	grep cd then sed echo | "$1" 2>/dev/null 2>/dev/null --verbose "$1" /usr/bin
+		"$@" local && then then 2>/dev/null
+/usr/bin x=1 "$@" --verbose
+grep awk printf export printf -eu ${HOME} local /usr/bin local 'quoted text'
+	2>/dev/null | cd x=1 'quoted text' "$@" test 2>/dev/null local /usr/bin
+	test "$@" $(pwd) then | sed readonly export --verbose
+	done done ${HOME} $(pwd) test export test && then /usr/bin ${HOME}
+	x=1 export readonly local test
+		sed && readonly "$1" | | -eu "$1" 2>/dev/null
+awk 'quoted text' echo grep grep then cd done printf
+	$(pwd) && cd grep echo -eu "$1" then x=1 2>/dev/null | awk x=1 && 'quoted text'
+	-eu grep done local /usr/bin "$1" done grep done && "$@" then && grep then
+		$(pwd) cd x=1 | --verbose 2>/dev/null
+		&& -eu 'quoted text' then | --verbose local sed
+"$1" -eu printf cd ${HOME} | /usr/bin /usr/bin
+	export cd done "$1" printf $(pwd) export && local -eu && local x=1 /usr/bin
+local local local 'quoted text' done test
+	sed 2>/dev/null && done then printf test awk export echo
+echo x=1 /usr/bin x=1 printf ${HOME} ${HOME} && grep export cd readonly awk
+	export cd ${HOME} done test
+		| grep awk "$1" "$1" | export awk 'quoted text' done 2>/dev/null |
+awk echo "$@" "$1" printf
+		-eu 'quoted text' -eu ${HOME} /usr/bin --verbose export && "$@" export --verbose
+	| x=1 awk 'quoted text'
+		test x=1 'quoted text' echo
+	$(pwd) then && cd /usr/bin readonly export "$@" printf
+		then $(pwd) export 2>/dev/null
+export done 'quoted text' sed echo
+	then local $(pwd) 2>/dev/null /usr/bin ${HOME} echo /usr/bin 'quoted text'
+	awk | cd /usr/bin --verbose && 2>/dev/null
+		sed test done $(pwd) && -eu $(pwd)
+	/usr/bin -eu readonly test
+&& | /usr/bin --verbose readonly
+	done grep test test readonly readonly readonly && echo readonly cd done sed
+	${HOME} | cd && 2>/dev/null then
+		"$@" -eu | /usr/bin awk test printf --verbose test printf && 2>/dev/null done then
+cd done sed export export && export --verbose | "$1" "$1" ${HOME} "$1"
+	/usr/bin local | x=1 awk 'quoted text' "$@" sed grep ${HOME} 'quoted text'
+	| grep /usr/bin grep grep grep then ${HOME} &&
+		'quoted text' test x=1
+		| 'quoted text' x=1 "$1" export then
+	2>/dev/null awk && echo -eu /usr/bin /usr/bin
+"$1" test export export "$@" export ${HOME} then $(pwd)
+	/usr/bin x=1 | printf "$@" sed "$@" "$1" done --verbose grep
+x=1 | sed test /usr/bin export $(pwd) awk --verbose awk done $(pwd)
+	cd x=1 readonly -eu echo then done cd | sed | x=1 ${HOME} -eu done && ${HOME}
+| grep test printf $(pwd) ${HOME}
+		export && done grep local | test export awk /usr/bin "$1" grep "$@" 'quoted text'
+		2>/dev/null "$@" x=1 2>/dev/null ${HOME} /usr/bin "$1" 2>/dev/null
+		done x=1 sed /usr/bin | then --verbose grep "$@" 'quoted text'
+cd test test sed printf /usr/bin
+	"$1" awk echo | "$1" && sed 2>/dev/null grep printf
+	grep x=1 x=1 test done 2>/dev/null
+/usr/bin readonly "$1" export grep done printf 2>/dev/null x=1 "$1" 2>/dev/null
+		awk printf done --verbose "$1" /usr/bin "$@" sed --verbose
+	${HOME} export printf readonly grep awk printf ${HOME}
+		2>/dev/null ${HOME} then grep x=1 "$1"
+	done then ${HOME} readonly x=1 local
+		readonly "$1" grep 'quoted text' "$1" sed
+		| --verbose then /usr/bin sed sed "$@" readonly cd readonly printf | "$@"
+		done /usr/bin echo done -eu
+		printf awk ${HOME} x=1 export
+	--verbose export done 'quoted text'
+	$(pwd) ${HOME} done $(pwd) export
+	2>/dev/null | export printf then readonly then | ${HOME}
+export then $(pwd) --verbose export
+		${HOME} awk 2>/dev/null | export
+	then printf | --verbose grep "$@" local --verbose test printf awk sed
+		x=1 "$1" 'quoted text' 2>/dev/null "$@" --verbose
+		awk x=1 && 2>/dev/null x=1 done cd sed echo echo 2>/dev/null | ${HOME}
+"$@" --verbose done ${HOME} $(pwd) readonly $(pwd) 'quoted text' | echo test |
+	&& && ${HOME} && local echo test then $(pwd) ${HOME}
+		/usr/bin ${HOME} then 'quoted text' && readonly sed
+'quoted text' cd then x=1 printf awk 2>/dev/null x=1
+		--verbose grep && "$@" awk ${HOME} readonly && done printf
@@ -0,0 +1,2001 @@
+export x=1 test cd cd sed awk local cd 2>/dev/null readonly
+		then sed | -eu 'quoted text' && && local /usr/bin
+x=1 && echo test x=1 'quoted text' x=1 'quoted text'
+		export $(pwd) grep 2>/dev/null readonly && test &&
+	awk | echo sed export export cd | $(pwd) ${HOME} $(pwd) local printf
+test local then awk grep
+	grep export ${HOME} local readonly printf local "$1" readonly && done
+	export --verbose sed cd
+	/usr/bin printf local readonly ${HOME} export local done
+	test -eu awk && test 'quoted text' "$@" printf "$@"
+		then 'quoted text' cd local readonly done done grep then $(pwd)
+	&& $(pwd) /usr/bin awk 2>/dev/null
+	done $(pwd) "$@" grep
+| awk awk printf then done sed x=1 test && grep "$1" 'quoted text'
+		&& grep "$@" ${HOME} 2>/dev/null grep echo sed awk "$1" test
+&& echo 'quoted text' test |
+then --verbose "$@" then
+		echo --verbose local
+	echo readonly readonly awk local export | | then
+/usr/bin 2>/dev/null readonly | | done --verbose local test export --verbose
+"$1" cd cd x=1 ${HOME} | ${HOME} sed ${HOME} test "$1" done 'quoted text' local
+		export readonly local export cd test 2>/dev/null --verbose | -eu
+-eu $(pwd) readonly local "$@" "$1" cd echo
+echo sed -eu -eu test "$@" "$1" grep sed printf
+	$(pwd) cd local test
+$(pwd) $(pwd) x=1 $(pwd) test sed done awk
+	${HOME} x=1 test test $(pwd) --verbose
+		| readonly done then printf -eu | "$1" awk done $(pwd)
+		"$@" cd test grep echo -eu x=1 grep local
+x=1 && sed done readonly 'quoted text'
+		${HOME} "$@" local /usr/bin export test /usr/bin $(pwd) -eu done -eu 'quoted text'
+-eu done readonly local then then /usr/bin sed grep awk --verbose | export then
+2>/dev/null printf 2>/dev/null done -eu "$1" && "$1" sed printf then ${HOME}
+cd -eu local ${HOME} | printf awk readonly done done then | $(pwd)
+		echo ${HOME} /usr/bin sed printf 'quoted text' x=1
+		"$@" && ${HOME} --verbose ${HOME} awk "$1" | cd export test grep sed cd "$@"
+echo 'quoted text' export "$@" x=1 printf test sed |
+	--verbose then echo x=1 sed echo --verbose cd /usr/bin done readonly cd
+		| --verbose "$@" 'quoted text'
+	2>/dev/null ${HOME} 'quoted text' | 2>/dev/null | export
+		"$1" printf $(pwd) done &&
+		'quoted text' $(pwd) local 'quoted text' ${HOME} ${HOME}
+	awk readonly readonly x=1 /usr/bin &&
+		sed "$@" readonly grep --verbose $(pwd) readonly
+grep readonly then 2>/dev/null
+	done sed test 'quoted text' && export $(pwd) /usr/bin
+x=1 export test x=1 cd $(pwd) 2>/dev/null
+	"$@" "$@" -eu done export 2>/dev/null ${HOME} sed ${HOME} cd "$1"
+	grep export echo cd local echo x=1 readonly -eu 2>/dev/null | test test
+--verbose test | echo $(pwd) export 'quoted text' readonly
+	"$@" x=1 'quoted text' 'quoted text' && "$1" readonly "$@" "$1" 2>/dev/null
+$(pwd) done ${HOME} x=1 grep "$1" /usr/bin ${HOME}
+		-eu | cd echo test ${HOME} awk -eu export ${HOME} test printf grep ${HOME} $(pwd)
+		/usr/bin "$1" x=1 $(pwd) cd x=1 && sed cd readonly export 'quoted text' printf
+	printf sed | export "$@" done && && then --verbose "$1"
+'quoted text' -eu -eu $(pwd) "$@" awk -eu
+		'quoted text' ${HOME} sed printf -eu &&
+	export done export readonly readonly readonly
+		$(pwd) printf x=1 printf
+	-eu grep done test -eu test
+cd --verbose awk export /usr/bin --verbose x=1 /usr/bin "$@" then 2>/dev/null
+echo export && echo --verbose --verbose cd test sed cd awk then | "$@" sed
+x=1 awk cd "$@" then echo x=1 "$1" --verbose $(pwd) local "$1" /usr/bin
+	readonly "$1" $(pwd) cd "$1" "$1" export
+	&& "$@" done local local printf echo
+x=1 | ${HOME} $(pwd) then -eu done 'quoted text' test 2>/dev/null sed
+	export /usr/bin --verbose && printf
+		test -eu awk test done "$1" test echo then
+	test 'quoted text' "$@" "$1" local echo done awk -eu echo echo && && 2>/dev/null
+	--verbose "$1" "$1" grep
+	done echo printf grep /usr/bin 'quoted text'
+	printf sed readonly 'quoted text' test 2>/dev/null
+	/usr/bin sed -eu grep -eu readonly printf | done awk 2>/dev/null --verbose
+		-eu readonly then readonly printf /usr/bin "$@" --verbose
+| then echo | 2>/dev/null grep
+	/usr/bin --verbose 'quoted text' readonly --verbose cd done
+	| echo ${HOME} then grep sed then printf test && | ${HOME}
+"$1" "$1" --verbose x=1 2>/dev/null grep "$1" 'quoted text'
+$(pwd) ${HOME} readonly 2>/dev/null grep $(pwd)
+	done cd test 'quoted text' echo grep ${HOME} readonly test ${HOME}
+2>/dev/null local 2>/dev/null
+	awk "$1" done | then echo export 2>/dev/null printf test "$@" "$@" --verbose
+test /usr/bin test && echo "$1" $(pwd) sed
+		readonly $(pwd) "$1" cd export && /usr/bin echo ${HOME}
+	&& /usr/bin local | /usr/bin | $(pwd) ${HOME} "$@"
+&& then /usr/bin x=1 && test "$@"
+		&& done "$@" "$@" echo 2>/dev/null done -eu local export grep echo
+	readonly -eu printf 2>/dev/null
+export --verbose --verbose "$1" && readonly
+		${HOME} then "$@" export awk awk
+/usr/bin "$1" then printf printf
+		local readonly test echo ${HOME}
+	--verbose test --verbose done "$@" grep ${HOME}
+	x=1 2>/dev/null done local 2>/dev/null export then
+then 2>/dev/null x=1 | grep
+export readonly ${HOME} 2>/dev/null | x=1 echo x=1 ${HOME} awk x=1
+		readonly | echo export export echo export test done "$@"
+	readonly test 'quoted text' $(pwd) --verbose export | 'quoted text'
+		$(pwd) echo -eu then done /usr/bin --verbose
+		-eu 2>/dev/null $(pwd) "$@" "$1" cd $(pwd) /usr/bin
+		/usr/bin "$@" then then ${HOME} awk printf x=1 done sed "$@" 'quoted text'
+printf "$@" 2>/dev/null -eu /usr/bin 2>/dev/null
+		then --verbose export cd "$@" "$@" export
+-eu then readonly export | -eu export /usr/bin
+| cd sed test local test | local -eu local echo cd awk local "$@"
+	sed ${HOME} awk ${HOME} "$1" sed echo x=1 test 2>/dev/null cd ${HOME}
+done cd | printf then grep
+	'quoted text' done done "$1" "$@" -eu "$1" | "$@" x=1 done readonly /usr/bin
+		&& $(pwd) test then "$@" | ${HOME} /usr/bin x=1 sed --verbose --verbose
+	echo --verbose export sed cd ${HOME} readonly printf cd grep export test
+done printf ${HOME} 2>/dev/null sed "$1"
+done done test then echo ${HOME} && readonly
+cd sed && ${HOME} readonly sed awk 2>/dev/null 'quoted text' echo
+x=1 then grep 2>/dev/null awk $(pwd) && ${HOME} export "$@" cd readonly && "$@"
+		done readonly x=1 sed && x=1
+		then sed export ${HOME} 'quoted text' $(pwd) echo sed --verbose readonly 'quoted text'
+		$(pwd) done printf $(pwd) test "$1" echo /usr/bin done awk "$@" 'quoted text'
+		$(pwd) printf awk sed /usr/bin echo 'quoted text'
+-eu x=1 "$@" cd awk 2>/dev/null | local 'quoted text' 'quoted text'
+		&& "$1" -eu && 2>/dev/null | done x=1 --verbose
+${HOME} grep then export x=1 "$1" printf echo -eu echo $(pwd) 2>/dev/null
+export sed then awk && ${HOME} sed echo /usr/bin echo echo printf 'quoted text'
+${HOME} "$1" && 2>/dev/null then x=1 "$@" x=1 awk
+cd readonly done local printf && done "$1" --verbose
+		${HOME} grep /usr/bin grep done
+		test sed --verbose 2>/dev/null
+		done awk "$1" grep | awk --verbose --verbose sed printf -eu x=1 awk $(pwd)
+	export then awk grep grep done then 'quoted text'
+	then | cd $(pwd) -eu ${HOME} cd 'quoted text'
+		$(pwd) echo ${HOME} && 'quoted text'
+	$(pwd) printf 'quoted text' "$1" "$@" ${HOME} echo
+then export x=1 $(pwd) echo "$@"
+		"$@" test -eu -eu readonly local ${HOME} /usr/bin sed 2>/dev/null
+	--verbose "$@" sed $(pwd) /usr/bin --verbose "$@" ${HOME} "$@" | 'quoted text'
+	&& | cd /usr/bin | export
+	-eu awk && && readonly 'quoted text' done grep /usr/bin done -eu done done
+		$(pwd) cd sed 2>/dev/null -eu x=1 then sed | /usr/bin readonly
+readonly grep -eu x=1 sed -eu export sed local awk done ${HOME} --verbose
+$(pwd) then echo x=1 local awk | then x=1 echo then export
+test awk | export --verbose
+	2>/dev/null | | cd -eu awk sed -eu 2>/dev/null | | | $(pwd) | $(pwd)
+		cd export "$@" -eu readonly
+$(pwd) | sed /usr/bin
+		then awk done /usr/bin --verbose
+		printf printf printf $(pwd) sed export test done "$@"
+		export 2>/dev/null awk "$1" readonly echo printf 'quoted text'
+		sed && awk done $(pwd) -eu export grep "$1" &&
+/usr/bin done printf && export then | grep local
+		cd "$1" local ${HOME} readonly ${HOME} | cd x=1 -eu && "$@" | done && readonly
+--verbose "$1" 'quoted text' 'quoted text' then $(pwd) export sed done
+	x=1 -eu export x=1 2>/dev/null export echo export test
+	&& ${HOME} ${HOME} --verbose test && grep 2>/dev/null
+		x=1 $(pwd) local ${HOME} /usr/bin test "$@" grep then done x=1 grep local $(pwd)
+		grep x=1 awk 'quoted text' | ${HOME} 2>/dev/null | | x=1
+	$(pwd) --verbose sed 2>/dev/null echo 'quoted text' -eu done cd /usr/bin test &&
+&& sed then cd readonly 2>/dev/null | done -eu grep --verbose
+readonly awk printf 2>/dev/null local awk x=1 -eu 2>/dev/null readonly
+	export done readonly |
+	export "$1" export then echo printf cd readonly sed
+2>/dev/null | local local
+echo cd then echo local printf local $(pwd) echo
+		${HOME} 'quoted text' test local 'quoted text' echo /usr/bin 2>/dev/null
+	--verbose -eu test printf /usr/bin done printf /usr/bin then /usr/bin
+/usr/bin --verbose 'quoted text' test
+		echo && -eu 2>/dev/null awk export 2>/dev/null
+	then | echo && | awk
+	'quoted text' grep /usr/bin echo local ${HOME} then
+		echo "$1" 2>/dev/null printf
+"$@" $(pwd) printf done sed ${HOME} "$1" awk readonly
+-eu sed 2>/dev/null awk x=1 printf x=1 $(pwd) "$1" /usr/bin "$1" then local
+	grep /usr/bin $(pwd) | $(pwd) sed then done readonly export
+		echo printf test && printf local awk | $(pwd) ${HOME} -eu --verbose
+local "$1" awk | | $(pwd) "$1" && awk --verbose 'quoted text' "$1" /usr/bin
+&& sed test --verbose 'quoted text' then echo
+cd /usr/bin export test "$1" 'quoted text'
+		done local local done then sed grep done local sed export then grep x=1 && readonly
+${HOME} 2>/dev/null | | sed done && ${HOME} done grep
+	printf then x=1 test echo -eu then readonly 2>/dev/null
+-eu export | test readonly test done x=1 --verbose
+"$@" 'quoted text' then sed
+"$1" local cd local x=1 then $(pwd) printf export echo ${HOME} "$1" done
+	test awk then | echo
+		export echo then 'quoted text'
+	-eu 'quoted text' -eu echo --verbose -eu local export cd test x=1 export | -eu
+	export --verbose printf printf
+		x=1 2>/dev/null printf then "$@" x=1 awk -eu "$1" | -eu cd export
+		sed ${HOME} && sed local readonly "$1" local local /usr/bin
+x=1 test local grep 'quoted text' grep --verbose
+	local $(pwd) | "$@" export export export "$@" printf sed awk printf /usr/bin
+	sed $(pwd) | printf -eu sed $(pwd) then
+printf local local echo ${HOME} local /usr/bin local 'quoted text'
+printf "$@" ${HOME} x=1 --verbose "$@"
+	/usr/bin cd x=1 readonly awk echo
+awk grep awk grep awk grep done --verbose --verbose test local
+		local 2>/dev/null /usr/bin $(pwd) readonly awk then grep --verbose ${HOME}
+	-eu $(pwd) then && | printf -eu then grep $(pwd)
+/usr/bin cd grep --verbose printf export local awk
+		done "$@" | test sed then local
+grep 2>/dev/null then printf x=1 -eu export test $(pwd) done && $(pwd) readonly
+		local done x=1 printf
+	--verbose && 'quoted text' test sed export --verbose /usr/bin -eu /usr/bin
+		'quoted text' 2>/dev/null /usr/bin readonly 'quoted text' /usr/bin
+	done "$1" x=1 then then | x=1 readonly $(pwd) readonly grep printf then
+	"$@" export --verbose then printf --verbose
+	echo awk done readonly cd 'quoted text'
+		'quoted text' 2>/dev/null | echo grep grep echo x=1 --verbose x=1 echo export
+		echo grep done done --verbose local test $(pwd) awk awk then readonly ${HOME}
+	echo | --verbose awk grep grep export "$@" -eu
+		&& ${HOME} -eu awk x=1 readonly sed "$1" "$@" local
+test $(pwd) awk export 2>/dev/null 2>/dev/null echo test "$1" -eu awk 'quoted text'
+local x=1 awk printf 'quoted text' local awk grep /usr/bin
+		readonly --verbose | readonly export
+--verbose /usr/bin then readonly 2>/dev/null local $(pwd) 'quoted text'
+printf -eu x=1 'quoted text' 'quoted text' done "$@" "$1"
+	x=1 local ${HOME} --verbose && -eu test
+		-eu 2>/dev/null "$@" grep echo "$@" --verbose
+		sed $(pwd) local ${HOME} && readonly
+	grep echo cd 'quoted text' 2>/dev/null then test sed 'quoted text' /usr/bin "$1"
+then $(pwd) local "$1" readonly --verbose done test "$1" ${HOME}
+		test --verbose local local
+	'quoted text' 'quoted text' readonly sed x=1
+readonly 2>/dev/null grep test export test grep readonly
+	-eu | --verbose printf cd awk 2>/dev/null -eu sed grep done local
+		export "$1" -eu export
+	grep echo -eu --verbose --verbose "$1" readonly sed sed cd && ${HOME}
+		sed done echo -eu -eu readonly /usr/bin local awk awk -eu sed awk local
+		readonly 2>/dev/null cd test sed grep sed then "$@" test 'quoted text'
+		'quoted text' readonly readonly awk echo x=1 2>/dev/null "$1" x=1 done
+	echo 2>/dev/null done test awk ${HOME} $(pwd) cd sed then export done $(pwd)
+export --verbose "$@" test awk x=1 cd "$1" done local then
+cd printf done "$@" && $(pwd) echo sed sed 'quoted text' local
+x=1 sed export /usr/bin
+$(pwd) readonly readonly sed --verbose ${HOME}
+awk | sed "$@" printf --verbose test then
+		/usr/bin sed grep ${HOME} then grep /usr/bin cd done local "$1" local
+	$(pwd) printf awk "$1" test && cd done 2>/dev/null then
+	"$@" 'quoted text' 'quoted text'
+		test 2>/dev/null --verbose ${HOME} 2>/dev/null
+"$1" /usr/bin ${HOME} readonly "$1"
+		echo printf | -eu done --verbose | --verbose --verbose && | grep
+then done /usr/bin cd 'quoted text'
+	x=1 local printf ${HOME} "$1" -eu grep sed test done --verbose "$@" readonly
+	then | test cd -eu then then x=1
+--verbose done 'quoted text' --verbose --verbose printf $(pwd) done
+readonly 'quoted text' export echo awk && x=1 ${HOME} -eu grep echo | && grep
+	then readonly sed "$@" test 2>/dev/null cd awk export
+	cd printf -eu then --verbose
+	-eu 2>/dev/null ${HOME} ${HOME} && "$@" --verbose test echo 'quoted text'
+echo 'quoted text' /usr/bin
+		sed && printf "$1" -eu awk
+awk cd && "$1" | done 'quoted text' grep export "$1" 2>/dev/null $(pwd) /usr/bin
+x=1 local sed readonly export test ${HOME} sed printf
+| | readonly printf | then cd sed readonly ${HOME} echo --verbose
+	done readonly readonly 'quoted text' ${HOME}
+	"$1" ${HOME} "$@" | sed then 'quoted text' 'quoted text' x=1 done ${HOME} 'quoted text'
+test cd "$@" --verbose export test done grep test done local
+		x=1 "$1" test awk echo
+done "$@" x=1 /usr/bin --verbose printf sed 'quoted text' printf then "$1"
+		&& "$1" --verbose x=1 x=1 printf 2>/dev/null printf &&
+		x=1 echo && --verbose 'quoted text' then |
+	printf 2>/dev/null ${HOME} -eu /usr/bin test |
+sed --verbose && cd && export sed awk printf local 'quoted text'
+	test && 2>/dev/null ${HOME}
+	&& done | --verbose $(pwd) ${HOME} $(pwd) then "$1" 'quoted text' grep $(pwd) --verbose
+'quoted text' --verbose test x=1 grep $(pwd) | readonly
+${HOME} readonly local cd | $(pwd) local 'quoted text'
+	test "$1" 2>/dev/null && done
+	done done then "$1" export printf 'quoted text' readonly readonly echo test
+		then test | ${HOME} echo 2>/dev/null export test "$1" /usr/bin
+	local then $(pwd) sed grep && "$@" -eu -eu | done && && export grep --verbose
+		--verbose cd export cd
+	readonly "$@" then cd echo sed local
+"$1" "$@" && export x=1 done /usr/bin echo
+${HOME} export sed test /usr/bin cd ${HOME} echo local 2>/dev/null x=1 export
+| cd ${HOME} cd cd "$1" done export 2>/dev/null
+	/usr/bin cd readonly ${HOME} printf && 2>/dev/null export readonly && printf
+	readonly | test local && readonly
+		'quoted text' echo test awk local
+	echo done 2>/dev/null then ${HOME} grep
+		grep then x=1 echo "$@" "$@" local sed | echo
+	"$1" echo awk readonly awk ${HOME} local -eu local sed export cd done "$1"
+		local readonly $(pwd) printf "$1" local
+$(pwd) cd ${HOME} ${HOME} && 'quoted text' then | local echo export 2>/dev/null
+--verbose x=1 echo ${HOME} readonly 2>/dev/null
+		printf $(pwd) 2>/dev/null
+printf x=1 "$1" && --verbose echo local 2>/dev/null grep done 2>/dev/null echo
+		2>/dev/null 2>/dev/null --verbose grep "$1" then "$@" --verbose
+		2>/dev/null test "$1" then ${HOME} awk -eu
+		sed 'quoted text' cd export then $(pwd) awk readonly sed done ${HOME} cd readonly
+--verbose $(pwd) cd printf export --verbose then local
+	local sed 2>/dev/null -eu "$@" --verbose 2>/dev/null awk grep
+awk grep printf 2>/dev/null ${HOME} "$@"
+	local sed readonly readonly $(pwd) test /usr/bin printf $(pwd) echo
+	printf x=1 | readonly
+	--verbose x=1 "$@" $(pwd) grep "$1" cd
+	--verbose | local --verbose --verbose /usr/bin "$@" readonly local
+		$(pwd) /usr/bin awk export local "$@" $(pwd) /usr/bin awk /usr/bin readonly
+	-eu local done && then printf echo | local $(pwd) 2>/dev/null
+$(pwd) done done readonly grep grep $(pwd) awk --verbose 'quoted text'
+	/usr/bin readonly ${HOME} done awk "$1" printf "$@" 2>/dev/null | && 2>/dev/null
+		/usr/bin 'quoted text' | printf "$@" awk
+"$1" test local printf export && "$@" "$1"
+		printf x=1 sed awk readonly
+		then | | printf echo /usr/bin test cd export /usr/bin printf readonly
+	/usr/bin "$1" export 'quoted text' $(pwd) printf
+		"$@" "$@" "$@" grep readonly grep
+	| readonly done done export done echo
+	then echo echo cd printf grep 'quoted text' readonly
+local $(pwd) local --verbose cd
+printf then ${HOME} test readonly
+		readonly echo then export grep /usr/bin then x=1 done grep awk /usr/bin
+done "$1" export local | /usr/bin export ${HOME}
+		cd --verbose 'quoted text' "$@" $(pwd) "$@" /usr/bin test grep x=1 "$1" local
+	"$@" done printf grep awk --verbose -eu "$@"
+		awk test readonly cd grep then "$@" x=1 awk done
+		awk printf ${HOME} done 2>/dev/null "$@" && test grep test cd x=1 grep --verbose
+	readonly test --verbose grep export export done | /usr/bin -eu 'quoted text'
+echo sed 2>/dev/null grep "$1" sed awk test "$@"
+sed local x=1 "$@" awk $(pwd)
+		| echo local local local | 2>/dev/null "$1" 'quoted text'
+		sed sed local ${HOME} echo grep awk /usr/bin "$1"
+'quoted text' export grep sed "$1" awk | local export -eu echo "$@" then
+		export test /usr/bin then done
+		&& readonly local cd /usr/bin
+		--verbose test | then sed readonly then ${HOME} echo ${HOME}
+	awk 'quoted text' && done export sed printf
+	&& echo grep export sed printf -eu printf cd sed 'quoted text' --verbose | -eu
+	$(pwd) 'quoted text' --verbose ${HOME} test test
+	--verbose "$1" && local x=1 2>/dev/null
+		then 2>/dev/null --verbose -eu --verbose &&
+		echo 'quoted text' done grep done
+&& test done then 'quoted text' ${HOME} "$1" echo 2>/dev/null x=1
+--verbose sed "$1" grep local
+	"$1" cd awk | x=1 "$@" -eu done cd done
+		sed "$@" done done awk readonly sed export done local
+	$(pwd) cd | x=1 sed grep export | /usr/bin done local $(pwd) local grep $(pwd)
+		export done test readonly && grep then printf sed local $(pwd)
+	echo --verbose ${HOME} && | test $(pwd)
+	"$1" echo 'quoted text' /usr/bin
+		cd grep "$@" /usr/bin x=1 readonly 2>/dev/null then &&
+&& awk test then ${HOME} grep 'quoted text'
+		${HOME} "$@" $(pwd) && ${HOME} x=1 awk /usr/bin --verbose
+	grep "$1" local ${HOME} && "$@" awk "$@" /usr/bin local echo --verbose
+"$1" -eu export --verbose readonly
+echo 2>/dev/null local "$@" 'quoted text'
+| ${HOME} "$1" ${HOME} awk "$1" x=1 awk 2>/dev/null grep
+-eu then test $(pwd) printf readonly export
+readonly $(pwd) grep test /usr/bin export --verbose local
+	$(pwd) && grep 'quoted text' 'quoted text'
+echo sed test grep ${HOME} /usr/bin x=1 /usr/bin local 2>/dev/null && ${HOME}
+	-eu done grep sed printf export grep sed 'quoted text' $(pwd)
+		| cd sed && done x=1 $(pwd) $(pwd) "$1"
+		${HOME} readonly -eu awk ${HOME} && export export "$@"
+	"$1" | 'quoted text' --verbose awk $(pwd) -eu
+		&& && 'quoted text' $(pwd) --verbose echo then &&
+		echo 2>/dev/null $(pwd) --verbose grep ${HOME} -eu readonly --verbose 'quoted text'
+	export grep printf x=1 printf awk printf done grep done ${HOME}
+"$@" --verbose /usr/bin local export 'quoted text' ${HOME} -eu /usr/bin -eu
+${HOME} readonly /usr/bin printf ${HOME} ${HOME} done
+test 2>/dev/null "$1" sed "$@" sed awk 'quoted text' export 'quoted text' then
+readonly 2>/dev/null test "$1" readonly | sed done grep echo "$1" -eu echo
+		--verbose 2>/dev/null readonly /usr/bin
+	$(pwd) /usr/bin sed done
+then && then then cd export readonly export --verbose ${HOME}
+		$(pwd) done $(pwd) sed then
+		/usr/bin grep echo 'quoted text' && "$@" "$@"
+-eu 2>/dev/null "$@" && 'quoted text'
+		sed sed | ${HOME} | cd test ${HOME}
+grep $(pwd) done | then 2>/dev/null
+	echo readonly export x=1 /usr/bin printf --verbose
+		'quoted text' --verbose -eu sed grep readonly test done | then 'quoted text'
+"$1" "$1" awk echo grep echo then 'quoted text' "$@" x=1 --verbose x=1 readonly
+	then done echo echo done /usr/bin x=1 $(pwd) && export awk echo then
+'quoted text' export local local
+		sed --verbose x=1 x=1 $(pwd) "$1" echo ${HOME} then test --verbose
+	done -eu 'quoted text' 2>/dev/null "$@" printf readonly | export 'quoted text'
+local grep -eu --verbose grep | sed grep export $(pwd) done test
+	--verbose then export awk export readonly x=1 "$1" && 'quoted text' x=1 /usr/bin
+		"$1" | done cd echo printf | "$1" test export --verbose test x=1 x=1 local printf
+		${HOME} --verbose 'quoted text'
+		readonly readonly awk readonly "$@" ${HOME} && then printf "$@"
+export sed "$@" | -eu awk echo "$@" local readonly export
+		grep readonly export done awk 'quoted text' ${HOME} ${HOME} then -eu then
+	/usr/bin -eu test ${HOME} -eu "$1" 'quoted text'
+	test done && -eu "$1" "$@" ${HOME} cd ${HOME} x=1 awk /usr/bin 'quoted text'
+	sed printf 'quoted text' x=1 then echo done && done awk
+	done 2>/dev/null then readonly local test x=1 -eu done then x=1 grep 'quoted text'
+sed cd test | sed | 'quoted text' "$1" grep cd 2>/dev/null -eu cd 2>/dev/null
+then $(pwd) 2>/dev/null awk grep 2>/dev/null done && && done test cd awk
+	"$1" readonly export awk done --verbose "$@" "$@"
+	then then | sed $(pwd) sed local echo "$@" echo "$@"
+	grep readonly x=1 'quoted text' ${HOME} test readonly x=1 cd readonly printf readonly
+$(pwd) "$@" echo printf $(pwd) grep grep cd $(pwd)
+		echo printf test $(pwd) printf awk sed
+'quoted text' ${HOME} printf readonly
+		grep $(pwd) sed x=1 awk "$@" x=1
+		test | local cd 2>/dev/null x=1 | 'quoted text' cd export
+		--verbose | && | 2>/dev/null |
+	| /usr/bin -eu -eu awk $(pwd) $(pwd) local -eu --verbose
+"$1" $(pwd) cd "$@" grep x=1 echo | then test --verbose readonly
+		"$1" $(pwd) /usr/bin && ${HOME} ${HOME}
+sed 'quoted text' export x=1 --verbose | /usr/bin -eu echo echo "$@"
+		x=1 "$@" local "$@" "$1" export
+--verbose && sed x=1 done readonly cd export done printf "$1" x=1 "$@"
+printf grep awk printf
+		done "$@" export test done | -eu x=1 'quoted text' awk |
+'quoted text' local --verbose 'quoted text' $(pwd) grep "$1" local
+2>/dev/null readonly /usr/bin readonly ${HOME} "$1" done awk test
+2>/dev/null | $(pwd) | grep done | test
+	test -eu printf 'quoted text' grep grep printf -eu done test --verbose x=1 sed
+printf 'quoted text' done "$@" sed done 2>/dev/null readonly $(pwd) local $(pwd)
+		echo cd test cd echo /usr/bin && ${HOME} awk "$@" --verbose then
+'quoted text' test export printf
+then cd x=1 /usr/bin cd 'quoted text' "$@" "$@" grep
+	echo readonly cd -eu then ${HOME} awk && 2>/dev/null
+		x=1 cd grep echo then cd /usr/bin "$@" cd cd -eu ${HOME} && $(pwd) x=1 grep
+		local 'quoted text' /usr/bin
+'quoted text' cd $(pwd) 2>/dev/null readonly
+${HOME} awk grep 'quoted text' local ${HOME}
+--verbose grep echo local 'quoted text'
+		| "$@" x=1 --verbose sed test sed
+export grep "$1" -eu printf x=1 then cd /usr/bin cd printf sed then /usr/bin
+		2>/dev/null --verbose "$@" readonly -eu sed /usr/bin cd /usr/bin |
+	"$@" --verbose --verbose $(pwd) 'quoted text'
+&& export printf then local x=1 printf then -eu readonly
+sed test "$1" local 'quoted text' local cd
+		${HOME} | awk "$@" "$@" --verbose &&
+"$@" grep grep $(pwd) ${HOME} echo 2>/dev/null test $(pwd) grep test grep /usr/bin
+${HOME} /usr/bin awk "$1" grep cd /usr/bin
+$(pwd) cd "$1" cd awk awk -eu local
+	${HOME} --verbose && /usr/bin awk done /usr/bin x=1 /usr/bin test
+	| 2>/dev/null x=1 printf 2>/dev/null -eu grep echo ${HOME} "$@" | done
+	grep echo ${HOME} && ${HOME}
+x=1 && 2>/dev/null then 2>/dev/null echo printf /usr/bin x=1 test
+	${HOME} done readonly echo echo done --verbose --verbose
+		$(pwd) 'quoted text' --verbose "$@" x=1
+done 2>/dev/null --verbose grep
+-eu done local 'quoted text' | printf readonly echo 'quoted text' grep
+		export printf | export cd 2>/dev/null
+x=1 then awk ${HOME} | -eu -eu "$1"
+	export ${HOME} then "$1" local done test readonly "$1" 'quoted text' export
+		x=1 2>/dev/null sed && | local sed x=1 export | $(pwd) grep cd
+printf local done | 2>/dev/null "$1"
+		-eu -eu $(pwd) /usr/bin --verbose && done then $(pwd) echo grep awk --verbose
+		local x=1 /usr/bin | echo | export done x=1 "$@" local then done
+	"$1" x=1 local $(pwd) then printf done
+local echo "$1" cd printf "$@" "$@" x=1 "$@" test
+	x=1 /usr/bin test readonly then x=1 2>/dev/null then sed -eu
+	/usr/bin x=1 && "$@" sed test grep x=1 echo
+	"$1" printf then sed printf then && grep grep "$1" 'quoted text'
+grep grep /usr/bin 'quoted text'
+"$1" "$@" ${HOME} | test done export readonly 'quoted text' "$@" sed -eu -eu sed
+	-eu --verbose 'quoted text' x=1 --verbose readonly x=1 | then /usr/bin printf test
+	--verbose printf sed -eu "$1" /usr/bin printf "$@" $(pwd)
+		--verbose | local done x=1 local readonly
+	local $(pwd) -eu grep export --verbose --verbose echo
+	&& done x=1 $(pwd) export /usr/bin
+export -eu x=1 && --verbose "$@" local
+		export -eu sed && then ${HOME} -eu "$1" grep
+	then awk printf awk printf readonly && readonly $(pwd)
+	2>/dev/null /usr/bin | local
+		-eu export cd test /usr/bin "$@" "$@" | "$@" "$1" done grep --verbose
+test "$1" grep && | -eu local "$@" grep done
+local local sed x=1 awk grep x=1 local sed sed && echo
+		"$1" 'quoted text' 'quoted text' readonly
+	echo grep cd && then readonly done echo printf x=1
+	-eu 2>/dev/null export then sed "$@" local
+	${HOME} /usr/bin printf echo $(pwd) then && readonly
+printf printf "$1" x=1 x=1 $(pwd) --verbose
+/usr/bin 'quoted text' "$@" cd awk readonly $(pwd)
+'quoted text' -eu sed && printf sed then /usr/bin echo
+		done test ${HOME} && ${HOME}
+		test --verbose | $(pwd) readonly 2>/dev/null
+		"$@" "$@" grep "$1" sed ${HOME} --verbose local
+		readonly 2>/dev/null grep export "$1" printf -eu awk 'quoted text'
+	-eu | grep then | then awk local readonly awk cd cd local /usr/bin
+'quoted text' then -eu grep awk grep ${HOME} done echo
+		/usr/bin $(pwd) "$1" echo
+	printf cd "$@" echo readonly cd /usr/bin ${HOME} awk grep --verbose awk
+| cd local 2>/dev/null local grep $(pwd) printf
+&& "$@" done test 'quoted text' printf then grep
+		awk grep | && $(pwd) "$@" test 'quoted text' readonly test local x=1 done ${HOME}
+	--verbose sed 2>/dev/null grep --verbose
+		"$@" grep done test local cd "$@" awk
+		"$1" $(pwd) && printf 'quoted text'
+		$(pwd) done 2>/dev/null ${HOME}
+	cd "$1" x=1 local echo
+	"$1" --verbose done echo 'quoted text' | grep echo done
+	2>/dev/null "$@" sed /usr/bin $(pwd)
+		awk test then /usr/bin && 2>/dev/null --verbose "$1" x=1 $(pwd) /usr/bin
+-eu 'quoted text' /usr/bin cd --verbose echo sed export then export awk
+readonly then printf then
+		done && test echo -eu printf -eu echo test local /usr/bin readonly
+	local /usr/bin 'quoted text' sed test local readonly 2>/dev/null readonly
+x=1 echo 2>/dev/null | done 2>/dev/null echo "$@" "$@" ${HOME}
+		-eu "$@" "$1" done "$@" $(pwd) grep | "$@" ${HOME}
+	| cd -eu readonly -eu ${HOME} "$@" &&
+		'quoted text' test export awk 2>/dev/null
+then 'quoted text' 2>/dev/null
+		2>/dev/null && "$@" done done cd
+	local "$@" echo test done
+	printf awk done x=1 | "$1" awk readonly 2>/dev/null
+		sed echo -eu export test readonly 2>/dev/null readonly test readonly
+		'quoted text' printf sed export
+readonly readonly "$1" $(pwd) test | awk then then
+	echo ${HOME} 'quoted text' --verbose
+	2>/dev/null then readonly "$@" 'quoted text'
+	local $(pwd) ${HOME} | x=1 2>/dev/null done &&
+grep ${HOME} awk 2>/dev/null
+	then $(pwd) && 2>/dev/null test -eu grep echo -eu
+	&& export done sed 'quoted text' sed 'quoted text'
+grep done -eu printf sed $(pwd) x=1 "$1" "$1" then grep export
+		grep -eu 2>/dev/null test local export
+	2>/dev/null readonly "$@" then test | local /usr/bin test echo echo
+		readonly x=1 readonly ${HOME} readonly then /usr/bin
+	--verbose && awk 'quoted text' --verbose
+	${HOME} awk readonly then
+	cd 'quoted text' "$@" && grep "$@"
+cd x=1 'quoted text' local local $(pwd) grep
+cd echo done -eu --verbose $(pwd) "$@" 2>/dev/null --verbose
+		sed sed && "$@" 'quoted text' export 'quoted text' test printf
+		&& $(pwd) test readonly ${HOME}
+--verbose echo local 'quoted text' /usr/bin printf readonly -eu "$@"
+	test export /usr/bin 2>/dev/null -eu 2>/dev/null done
+		/usr/bin 'quoted text' "$@" done 'quoted text' echo -eu
+printf /usr/bin ${HOME} local done "$@" $(pwd) printf "$@" echo export test
+x=1 'quoted text' --verbose printf test | awk $(pwd) | readonly 'quoted text'
+		-eu "$1" cd 2>/dev/null export awk then 'quoted text' test && 'quoted text'
+readonly then ${HOME} -eu | "$1" "$@"
+	x=1 done x=1 local -eu cd readonly 2>/dev/null readonly x=1 sed && $(pwd)
+		"$@" "$1" done ${HOME} test $(pwd) cd 2>/dev/null echo cd -eu done test then
+	done local "$1" ${HOME} sed echo local
+	readonly readonly sed ${HOME} | "$@" &&
+		"$@" ${HOME} /usr/bin printf ${HOME} local "$1" --verbose &&
+| | 'quoted text' test export printf 2>/dev/null done /usr/bin sed then done /usr/bin
+	printf ${HOME} readonly done --verbose "$1" printf -eu
+		--verbose grep printf echo && /usr/bin export grep echo --verbose
+		grep sed "$@" then echo $(pwd) then "$@" printf --verbose &&
+printf echo /usr/bin ${HOME}
+	then grep && x=1 then export test sed 2>/dev/null && &&
+| export | "$1" local local 2>/dev/null 2>/dev/null $(pwd) 'quoted text'
+x=1 printf 'quoted text' printf --verbose export 'quoted text' ${HOME} $(pwd)
+cd awk echo "$@" printf 2>/dev/null
+/usr/bin 2>/dev/null -eu echo export /usr/bin done awk x=1 echo "$@" printf 'quoted text'
+		export -eu cd cd echo awk then
+		$(pwd) sed /usr/bin local
+	-eu $(pwd) export "$@" awk ${HOME} x=1 echo local
+	readonly 2>/dev/null test $(pwd) then then
+		sed /usr/bin sed cd x=1 $(pwd) x=1
+		awk -eu | 'quoted text' sed grep /usr/bin -eu export then -eu "$1" cd
+"$1" $(pwd) x=1 /usr/bin readonly test 'quoted text' done &&
+	readonly local awk --verbose
+test | x=1 readonly grep grep --verbose test --verbose done x=1 "$@" /usr/bin local
+${HOME} awk local 2>/dev/null done "$1" done --verbose
+$(pwd) x=1 /usr/bin -eu "$1" local | $(pwd)
+	echo awk local echo grep "$1" then echo local ${HOME} && echo -eu 'quoted text'
+	cd /usr/bin 2>/dev/null --verbose
+awk 'quoted text' local
+	local printf "$1" readonly /usr/bin
+	sed "$1" ${HOME} "$@" x=1 x=1 | && export $(pwd) sed awk cd ${HOME}
+"$@" done test done && /usr/bin | test then x=1 'quoted text' awk readonly
+	then export sed printf -eu && grep grep grep 'quoted text' printf
+	"$1" export test echo | "$@" local
+	done $(pwd) "$1" export --verbose grep --verbose test cd export sed cd awk awk
+		"$1" awk echo awk 2>/dev/null then readonly --verbose cd 2>/dev/null
+x=1 --verbose 'quoted text' x=1 /usr/bin
+sed awk export then --verbose printf
+then readonly test && printf ${HOME} grep test cd export 2>/dev/null cd 2>/dev/null
+	readonly && /usr/bin done "$@" 2>/dev/null /usr/bin | && --verbose
+export "$@" /usr/bin export echo
+	| export --verbose ${HOME} export 'quoted text' "$1" export /usr/bin awk
+	"$@" --verbose grep local printf $(pwd) printf awk
+	export echo $(pwd) && | x=1 then local then "$1" "$1" printf cd export -eu
+2>/dev/null export export $(pwd) "$1" 'quoted text'
+		&& --verbose awk echo then readonly test ${HOME}
+	2>/dev/null printf then /usr/bin /usr/bin -eu sed -eu grep | then cd echo
+	cd 'quoted text' echo export "$1" /usr/bin /usr/bin
+	readonly 2>/dev/null readonly "$@" x=1 then
+'quoted text' 'quoted text' test $(pwd) done done
+	sed "$@" && x=1 && sed then done "$1" 'quoted text'
+awk echo $(pwd) export cd awk 2>/dev/null echo sed grep test printf
+		x=1 'quoted text' 2>/dev/null 'quoted text' | echo local -eu
+$(pwd) echo --verbose 2>/dev/null x=1 "$@" sed ${HOME} "$1" x=1
+		| done local "$1" printf readonly
+x=1 sed sed local sed 2>/dev/null 'quoted text' && $(pwd) x=1 | printf
+		/usr/bin $(pwd) done export x=1 x=1 test sed cd local
+${HOME} grep | readonly readonly /usr/bin echo | echo 'quoted text' test
+	awk echo echo export $(pwd) printf sed | local /usr/bin $(pwd) /usr/bin
+x=1 sed "$1" --verbose ${HOME}
+/usr/bin && | x=1 awk readonly ${HOME} x=1 cd done then 'quoted text'
+		/usr/bin 'quoted text' printf then export awk sed printf grep
+| 2>/dev/null awk 'quoted text' "$@" grep then --verbose
+	2>/dev/null && printf | ${HOME}
+echo then $(pwd) test
+		2>/dev/null echo grep 2>/dev/null export cd test grep --verbose
+--verbose "$@" test $(pwd)
+	printf 'quoted text' export sed cd 2>/dev/null sed "$@"
+		test | 'quoted text' $(pwd) export readonly "$1" | echo
+	printf grep && "$1" | grep echo
+		x=1 -eu readonly sed 'quoted text' ${HOME} /usr/bin x=1 /usr/bin cd cd "$1" printf
+	2>/dev/null --verbose
+grep done --verbose --verbose sed 'quoted text' cd 'quoted text' export 2>/dev/null
+	| export test | cd -eu local echo then x=1 x=1 printf
+	done 2>/dev/null printf 'quoted text' done cd
+		'quoted text' printf "$1"
+	| printf export /usr/bin test printf $(pwd) echo sed echo x=1 test sed
+| && --verbose $(pwd) 'quoted text' x=1 echo sed then -eu
+		x=1 then then sed then "$@" /usr/bin then done 2>/dev/null local awk printf sed
+		--verbose test 2>/dev/null echo grep 2>/dev/null --verbose $(pwd) /usr/bin
+	local -eu cd readonly grep printf export && x=1 sed 'quoted text'
+	printf -eu local x=1 export grep echo then done $(pwd) 'quoted text' "$@"
+printf cd awk then printf printf test &&
+		'quoted text' test "$1" readonly | 2>/dev/null awk /usr/bin
+	sed cd --verbose ${HOME} $(pwd) then x=1 'quoted text' local cd ${HOME} readonly
+	x=1 sed $(pwd) "$1" && 2>/dev/null grep -eu "$@" 'quoted text'
+	export grep $(pwd) cd 2>/dev/null readonly
+	printf | x=1 printf 'quoted text' "$@" ${HOME}
+		"$@" readonly 'quoted text' awk grep echo local readonly echo ${HOME} grep "$1"
+	"$@" x=1 "$1" test local printf done --verbose printf local then
+		printf /usr/bin $(pwd) x=1 && printf then "$1" | ${HOME} $(pwd) cd sed cd
+'quoted text' awk "$1" && awk -eu x=1 test x=1 -eu $(pwd) echo cd test
+		'quoted text' awk local done --verbose | test -eu -eu done local $(pwd) $(pwd) cd
+then then sed cd test 'quoted text' readonly "$1" printf $(pwd) grep done done
+	readonly sed done "$1" /usr/bin
+local "$1" local export printf cd printf
+	x=1 readonly ${HOME} then sed then x=1 then echo done x=1
+		cd echo $(pwd) 'quoted text' cd cd export --verbose
+then cd readonly export x=1 awk "$1" test
+	--verbose local $(pwd)
+x=1 readonly test printf x=1 readonly 'quoted text' 'quoted text'
+		'quoted text' then test grep printf awk ${HOME} printf cd
+echo -eu awk readonly then readonly /usr/bin then cd "$@"
+		&& local test cd /usr/bin printf /usr/bin local local
+	then printf "$@" "$@" test x=1 cd $(pwd) done && printf cd local readonly
+"$@" -eu /usr/bin -eu x=1
+$(pwd) 2>/dev/null -eu "$1" 2>/dev/null -eu /usr/bin --verbose cd
+	${HOME} then readonly done printf && export -eu --verbose | export $(pwd) done
+		x=1 $(pwd) -eu 'quoted text' "$@" /usr/bin x=1 cd export | -eu local ${HOME} grep
+		"$@" ${HOME} && export "$@" awk
+printf echo -eu echo "$@" sed --verbose x=1 awk printf local
+${HOME} 'quoted text' && 2>/dev/null
+'quoted text' readonly ${HOME} done -eu printf done "$1" "$@" | sed && x=1
+		&& echo test echo 2>/dev/null | ${HOME} x=1 $(pwd) grep $(pwd) local ${HOME}
+		then "$1" printf printf | "$1" printf sed export "$1" test
+		"$@" test grep $(pwd) 2>/dev/null
+	${HOME} echo && printf && 'quoted text' && cd export
+		| $(pwd) done -eu | "$@" --verbose
+readonly export then sed -eu readonly
+	grep /usr/bin local echo awk 2>/dev/null
+		| printf "$@" "$1" 2>/dev/null cd export export sed printf && && 'quoted text'
+awk x=1 then export && "$@" "$1"
+	done -eu cd -eu readonly
+echo 2>/dev/null export ${HOME} /usr/bin printf "$1" $(pwd) --verbose sed "$@"
+		'quoted text' local $(pwd) then export x=1
+	$(pwd) ${HOME} "$1" grep awk $(pwd) test echo &&
+		export grep cd done local | -eu sed printf $(pwd) readonly
+	awk export 'quoted text' readonly awk test --verbose x=1 printf
+	/usr/bin echo "$@" local local "$@" printf "$1" local --verbose readonly x=1 &&
+'quoted text' awk sed /usr/bin then -eu grep awk ${HOME} x=1 sed -eu then -eu
+		-eu ${HOME} x=1 -eu test done test local x=1 'quoted text' readonly $(pwd)
+done cd "$1" export sed 'quoted text' ${HOME} --verbose test then
+		local && && local && | then
+	"$1" 'quoted text' done "$1" echo grep then cd 2>/dev/null ${HOME}
+	cd echo test sed "$@" ${HOME}
+		printf cd && ${HOME} "$@" --verbose $(pwd) local 'quoted text'
+		x=1 cd /usr/bin then && "$1" export local --verbose "$1" done 'quoted text' -eu
+		2>/dev/null then -eu "$1" -eu "$1" sed -eu awk test ${HOME}
+		then local cd grep "$1"
+		&& echo x=1 echo readonly cd "$@" 2>/dev/null
+		&& ${HOME} sed cd "$1" $(pwd) test --verbose
+		test local local printf x=1 done
+		$(pwd) printf grep -eu $(pwd) /usr/bin done export -eu
+	&& grep "$1" readonly
+		| "$1" sed 2>/dev/null &&
+2>/dev/null echo x=1 grep --verbose 2>/dev/null
+	local -eu x=1 -eu done local readonly -eu 2>/dev/null export x=1 x=1 awk "$1"
+	&& then $(pwd) test "$1" printf test --verbose --verbose ${HOME}
+		sed echo then "$@" awk export test test | 2>/dev/null readonly
+	${HOME} "$@" readonly sed sed grep test printf sed grep echo then "$1"
+/usr/bin 2>/dev/null ${HOME} --verbose
+done --verbose grep 'quoted text' --verbose 'quoted text' grep $(pwd) ${HOME}
+-eu $(pwd) sed "$1" |
+	awk $(pwd) 'quoted text' readonly local awk readonly "$1" -eu cd echo ${HOME}
+| ${HOME} printf cd ${HOME}
+	2>/dev/null /usr/bin awk export echo ${HOME} x=1
+		sed done local sed 2>/dev/null ${HOME}
+--verbose test local grep ${HOME} test awk printf $(pwd)
+		awk 2>/dev/null /usr/bin cd grep export $(pwd) printf
+cd "$@" "$@" 2>/dev/null readonly x=1 /usr/bin
+		sed then 'quoted text' | done local --verbose awk
+	&& cd echo test x=1 printf ${HOME} test 'quoted text' grep
+	/usr/bin 2>/dev/null && ${HOME} 'quoted text' test local
+		$(pwd) && readonly test | export cd
+| -eu 2>/dev/null grep "$@" "$@" "$@" echo
+	printf "$1" done -eu export "$@" $(pwd) export readonly awk && "$1"
+		-eu test then sed 'quoted text'
+	sed local cd 'quoted text'
+2>/dev/null 'quoted text' grep --verbose printf
+	then && | 'quoted text'
+| echo /usr/bin test --verbose 'quoted text'
+	"$1" sed export 2>/dev/null /usr/bin "$@" && export awk --verbose
+	awk --verbose sed done
+	--verbose then sed ${HOME} grep local export done local
+"$@" x=1 awk cd done /usr/bin ${HOME} |
+	sed $(pwd) awk done "$1" "$1" -eu -eu "$1" local awk export local 2>/dev/null
+		x=1 'quoted text' test sed 'quoted text' "$@" readonly awk | /usr/bin
+2>/dev/null --verbose $(pwd)
+	local cd 2>/dev/null export
+	"$@" "$@" then && ${HOME} readonly
+		'quoted text' export test /usr/bin awk then printf 'quoted text' grep ${HOME} echo
+		"$@" printf echo grep cd done && awk $(pwd) /usr/bin echo readonly readonly
+$(pwd) local export "$1" sed readonly awk 2>/dev/null echo
+export "$1" readonly then export cd ${HOME} cd 'quoted text'
+		${HOME} printf 'quoted text' | then cd "$@" -eu
+		echo then done grep | grep 'quoted text' local 'quoted text'
+$(pwd) then | sed 'quoted text'
+"$@" readonly "$@" cd | $(pwd) | cd /usr/bin
+	export 2>/dev/null 'quoted text' x=1 2>/dev/null
+	${HOME} "$1" cd readonly
+	'quoted text' $(pwd)
+cd --verbose $(pwd) | printf done cd | grep
+	printf awk x=1 -eu $(pwd) "$1" grep && "$@" done awk
+	readonly readonly -eu && /usr/bin local "$@"
+		readonly export cd -eu x=1 ${HOME} | cd test $(pwd) 'quoted text' export cd readonly
+test printf ${HOME} && 2>/dev/null
+local && 2>/dev/null awk sed readonly cd
+	then x=1 && local export test
+sed readonly export 'quoted text' 2>/dev/null $(pwd)
+	done awk readonly && sed $(pwd) sed x=1 /usr/bin cd -eu echo echo ${HOME} 'quoted text'
+echo test done then grep && "$@" then
+	--verbose x=1 $(pwd) --verbose
+	| cd readonly grep && "$1" /usr/bin
+		${HOME} sed -eu then "$1" -eu --verbose printf 'quoted text' done sed printf
+		awk sed /usr/bin sed done
+	-eu grep grep --verbose 'quoted text' 'quoted text'
+-eu && cd echo test /usr/bin "$@" then 2>/dev/null "$@" "$1" $(pwd) $(pwd)
+then && "$@" local /usr/bin done test 'quoted text'
+		&& $(pwd) local /usr/bin x=1 local local --verbose 2>/dev/null grep readonly
+	echo then x=1 'quoted text' /usr/bin printf local "$@"
+	cd cd grep -eu -eu readonly --verbose printf ${HOME} printf done --verbose | "$@"
+		readonly awk ${HOME} grep /usr/bin
+		readonly awk 2>/dev/null ${HOME}
+--verbose readonly $(pwd) cd readonly local local grep then /usr/bin
+		x=1 export $(pwd) ${HOME} "$@" export cd then
+	grep --verbose -eu | cd /usr/bin | 2>/dev/null awk "$1" "$@" ${HOME} -eu grep
+$(pwd) "$1" cd test done -eu ${HOME} && awk "$1" &&
+		grep x=1 "$@" && export /usr/bin "$@" | 2>/dev/null printf "$1" -eu x=1 2>/dev/null
+		grep printf export && 2>/dev/null done --verbose readonly awk then then
+	sed sed x=1 2>/dev/null $(pwd) "$1" x=1 grep 2>/dev/null
+printf $(pwd) test $(pwd) done /usr/bin local "$@" | 2>/dev/null ${HOME}
+		cd grep --verbose export readonly printf "$1" x=1 printf --verbose
+printf test "$1" 2>/dev/null /usr/bin "$@" /usr/bin /usr/bin
+local echo local && $(pwd) then
+	-eu x=1 "$1" && printf echo
+	x=1 /usr/bin /usr/bin $(pwd)
+	'quoted text' done cd awk "$@"
+x=1 test echo --verbose readonly sed grep 2>/dev/null local | ${HOME} sed
+${HOME} local echo --verbose /usr/bin "$@" readonly 2>/dev/null && test readonly
+		"$1" local 'quoted text' |
+cd grep ${HOME} printf test cd
+printf cd grep export -eu grep x=1 then echo $(pwd) 'quoted text' ${HOME}
+		printf local awk 'quoted text'
+		sed sed test $(pwd) -eu echo
+		readonly -eu awk 'quoted text' /usr/bin 2>/dev/null awk done /usr/bin 'quoted text'
+	sed 'quoted text' | local done | | printf x=1 --verbose grep
+		-eu | then ${HOME} && export printf echo && awk ${HOME} local cd
+		awk ${HOME} 2>/dev/null 2>/dev/null
+sed -eu local && grep local "$@" done 2>/dev/null "$1" then 2>/dev/null && done
+	'quoted text' /usr/bin readonly export
+x=1 printf done local then printf &&
+x=1 test 2>/dev/null && && grep test "$1" done 2>/dev/null
+		"$1" sed grep echo then 'quoted text' | sed
+		&& then local $(pwd) grep readonly --verbose 'quoted text'
+readonly local done "$@" 2>/dev/null test ${HOME} /usr/bin
+		$(pwd) export grep x=1 x=1 sed export "$1"
+		"$1" 'quoted text' printf test awk
+		/usr/bin awk cd 2>/dev/null echo
+		&& readonly ${HOME} grep printf --verbose test && readonly | 2>/dev/null local
+echo $(pwd) --verbose test x=1 "$1" $(pwd) /usr/bin -eu export
+	/usr/bin local "$1" --verbose 'quoted text' "$1" then
+"$1" local x=1 -eu | ${HOME} sed then grep sed cd
+readonly /usr/bin cd --verbose
+grep test /usr/bin 'quoted text' $(pwd)
+	&& readonly readonly $(pwd) sed test awk /usr/bin export ${HOME} | -eu
+	$(pwd) cd "$1" ${HOME} 'quoted text' export ${HOME} "$@" sed
+cd | printf x=1 "$@" /usr/bin cd printf
+grep --verbose cd export
+	| 2>/dev/null grep printf echo test printf awk awk "$1" local done printf
+	grep --verbose awk | /usr/bin export cd
+		${HOME} 'quoted text' local echo -eu $(pwd)
+		2>/dev/null | readonly ${HOME} "$1" | printf
+	&& local sed -eu then test cd && grep x=1 'quoted text'
+	--verbose readonly && echo cd && -eu -eu then --verbose echo "$@"
+		local sed x=1 "$1" 'quoted text' && test local && 'quoted text'
+		"$1" awk grep awk local echo test awk
+	readonly sed /usr/bin | x=1 test grep "$1" --verbose then test "$@" echo
+	done echo "$@" ${HOME} "$1" echo printf --verbose
+grep done printf test echo 2>/dev/null
+grep readonly /usr/bin /usr/bin
+	sed grep readonly readonly local then printf local -eu -eu printf
+		printf /usr/bin test | 2>/dev/null "$1"
+		-eu 2>/dev/null $(pwd) "$1" x=1 "$1" echo done x=1 awk cd then | echo then
+sed sed export export test printf $(pwd) 'quoted text'
+		&& 2>/dev/null test x=1 $(pwd) --verbose
+		$(pwd) -eu sed ${HOME} 2>/dev/null sed
+		printf $(pwd) done readonly readonly /usr/bin 'quoted text' cd readonly | readonly
+		-eu cd $(pwd) readonly && "$@" awk export echo then && x=1 grep then 2>/dev/null
+		$(pwd) --verbose done printf done done then ${HOME} printf && "$1" 'quoted text'
+		-eu done local test /usr/bin x=1 then $(pwd) $(pwd)
+	echo test --verbose awk ${HOME}
+	x=1 --verbose printf local "$@" && "$1" "$@" $(pwd) && local
+local "$@" then readonly | x=1 | done x=1 -eu
+	test awk -eu then cd grep readonly 'quoted text'
+		test printf local /usr/bin ${HOME} test grep 2>/dev/null
+		--verbose $(pwd) readonly $(pwd) -eu -eu then ${HOME} ${HOME} printf
+		2>/dev/null readonly --verbose "$1"
+	'quoted text' | "$1" test test --verbose
+| done echo "$1" grep echo done "$1" x=1 grep sed sed 'quoted text'
+done 'quoted text' cd &&
+	then readonly "$@" -eu 'quoted text' sed printf export -eu done
+	| export readonly local ${HOME} test "$@" "$@" then --verbose
+'quoted text' local 'quoted text'
+--verbose "$@" --verbose "$1"
+	export 2>/dev/null 'quoted text'
+		export export /usr/bin cd export then && local
+		--verbose ${HOME} ${HOME} awk /usr/bin 'quoted text' | readonly
+export test | awk 2>/dev/null sed test -eu && 'quoted text' awk test
+	sed | cd | 2>/dev/null local ${HOME} 2>/dev/null printf 2>/dev/null
+awk /usr/bin x=1 /usr/bin 2>/dev/null awk | 2>/dev/null
+		x=1 x=1 'quoted text' "$1" && then
+	printf /usr/bin then local sed "$1" $(pwd) printf "$@" readonly local &&
+		$(pwd) export 2>/dev/null echo done then
+		&& x=1 echo && echo $(pwd) echo 2>/dev/null ${HOME} grep
+${HOME} -eu printf ${HOME}
+		done | awk "$1" local x=1 readonly ${HOME} then export sed sed "$1"
+	done $(pwd) && sed grep grep echo test grep export
+then done readonly --verbose -eu --verbose
+test awk -eu ${HOME} echo grep awk export 'quoted text' export
+		grep printf 'quoted text' --verbose export 2>/dev/null
+	local "$1" export /usr/bin export /usr/bin test "$1" /usr/bin /usr/bin
+$(pwd) printf "$1" grep export then awk "$@" $(pwd) x=1 readonly "$@"
+$(pwd) local "$@" /usr/bin done /usr/bin then grep printf ${HOME} -eu export
+		awk 2>/dev/null $(pwd) 2>/dev/null sed cd "$1" &&
+	test local && sed then done && done test "$1" && printf ${HOME}
+-eu ${HOME} "$@" then /usr/bin echo cd sed
+	local | && | sed 'quoted text'
+	awk done "$1" then | | $(pwd) $(pwd) done && awk local
+export "$@" printf done export /usr/bin --verbose printf grep grep sed
+		test echo done awk cd 'quoted text' awk test awk sed
+	awk grep test local 2>/dev/null --verbose test x=1 "$1"
+	/usr/bin | "$@" then /usr/bin cd printf x=1 'quoted text' x=1
+	'quoted text' cd cd -eu
+		export 2>/dev/null /usr/bin echo $(pwd) "$@"
+		&& grep --verbose x=1 2>/dev/null 'quoted text'
+	awk $(pwd) test x=1 test readonly "$@" cd | export | printf
+	-eu awk test -eu echo -eu && /usr/bin x=1 --verbose echo "$1" sed sed sed
+		awk echo sed test 'quoted text' printf $(pwd) "$@" x=1 echo --verbose
+		'quoted text' x=1 "$1" ${HOME}
+"$@" $(pwd) 2>/dev/null /usr/bin
+		awk $(pwd) && grep 'quoted text' printf then -eu readonly
+		/usr/bin sed readonly | sed
+then && ${HOME} test && local cd --verbose grep readonly "$1" echo -eu cd /usr/bin
+	${HOME} done $(pwd) printf -eu && | printf test
+--verbose && "$@" export cd grep "$1" awk -eu then $(pwd) --verbose sed printf
+	$(pwd) --verbose --verbose x=1 /usr/bin /usr/bin 2>/dev/null
+		sed --verbose 2>/dev/null done && test awk --verbose -eu local
+	"$@" -eu export local test --verbose
+		then cd $(pwd) -eu then x=1 $(pwd)
+	--verbose | --verbose "$@" x=1 export export $(pwd) sed x=1 printf
+	done echo $(pwd) "$@" readonly
+	-eu cd test && ${HOME} awk --verbose readonly
+	test --verbose "$@" readonly printf $(pwd) echo printf
+printf test local x=1 x=1 ${HOME} -eu sed printf --verbose
+	readonly cd | 2>/dev/null local 2>/dev/null
+2>/dev/null ${HOME} "$@" --verbose cd x=1 /usr/bin readonly
+		done cd x=1 readonly then export --verbose
+		sed 2>/dev/null grep grep 'quoted text' local ${HOME} | $(pwd)
+	sed printf 2>/dev/null "$@" export
+		printf export cd | readonly then 'quoted text' grep ${HOME}
+cd $(pwd) echo "$1" test ${HOME} awk done /usr/bin ${HOME} grep ${HOME} ${HOME}
+		${HOME} then then then x=1 -eu x=1 cd 'quoted text'
+done 'quoted text' cd done "$1" awk $(pwd)
+--verbose echo grep sed readonly test $(pwd)
+	printf readonly --verbose /usr/bin "$1" x=1 x=1 &&
+test grep /usr/bin then "$1" grep awk grep
+		"$1" -eu printf then export "$1" export grep echo then test 'quoted text'
+		${HOME} local printf -eu /usr/bin awk cd --verbose "$@" 2>/dev/null sed readonly
+	local 'quoted text' | "$1" ${HOME} /usr/bin then 'quoted text'
+cd printf printf test local /usr/bin "$@" -eu
+--verbose grep x=1 echo local
+then -eu awk && then readonly "$1" 'quoted text' sed /usr/bin 'quoted text'
+cd readonly test awk "$@" done --verbose --verbose printf done awk then
+		echo ${HOME} local printf -eu x=1 awk then readonly
+		-eu "$@" grep --verbose -eu done awk cd -eu "$1" printf "$@"
+	grep --verbose /usr/bin "$@" "$1"
+		2>/dev/null echo local /usr/bin "$1" 'quoted text'
+		test cd sed 2>/dev/null ${HOME} export echo awk cd | readonly then && "$@" awk readonly
+		done --verbose sed "$1" local echo sed && echo export
+&& printf | awk done $(pwd) | done -eu 'quoted text' local
+printf then test /usr/bin cd awk 2>/dev/null ${HOME} 'quoted text'
+	${HOME} local printf printf cd done then test sed awk awk x=1 x=1
+awk echo && $(pwd) echo grep x=1 awk ${HOME}
+	local 'quoted text' cd x=1 echo
+		sed export --verbose grep x=1 'quoted text' 'quoted text' --verbose
+grep done export printf echo $(pwd) "$1" $(pwd)
+	-eu local 2>/dev/null grep cd -eu $(pwd) 'quoted text' -eu | readonly
+	export "$1" grep x=1 local /usr/bin
+	&& done "$1" readonly readonly done 'quoted text' sed
+		2>/dev/null awk readonly export $(pwd)
+	${HOME} ${HOME} cd 'quoted text'
+	x=1 $(pwd) 'quoted text' 2>/dev/null printf --verbose
+"$1" readonly then local export ${HOME} echo export "$1" printf
+printf && x=1 echo cd $(pwd) echo awk cd "$@" local | export done
+	$(pwd) 2>/dev/null cd /usr/bin "$@" readonly 2>/dev/null && readonly 'quoted text'
+		| --verbose -eu test /usr/bin echo sed printf ${HOME} grep
+		echo cd --verbose done
+		| "$1" "$@" "$@" grep 'quoted text'
+	'quoted text' --verbose then 2>/dev/null sed
+	| awk cd $(pwd) /usr/bin $(pwd) $(pwd) | && $(pwd) done 2>/dev/null
+x=1 grep "$@" "$1" sed | /usr/bin && --verbose "$@" 2>/dev/null awk
+		/usr/bin | export --verbose $(pwd) "$1" test test 'quoted text' done --verbose
+	echo $(pwd) echo $(pwd) awk &&
+		grep --verbose && x=1 echo | 'quoted text' && sed test x=1 && --verbose awk
+awk printf $(pwd) /usr/bin printf 'quoted text' 'quoted text'
+	2>/dev/null echo local then | "$1" done readonly grep /usr/bin
+then awk done local awk
+		'quoted text' then cd | "$@" printf
+		&& test local awk export && sed &&
+		test -eu local 2>/dev/null && "$@" --verbose local 'quoted text' awk "$1" readonly
+	x=1 $(pwd) 'quoted text' printf /usr/bin 2>/dev/null export grep 2>/dev/null
+	| ${HOME} awk sed sed printf
+		'quoted text' 2>/dev/null
+export ${HOME} then $(pwd) "$1"
+	export echo --verbose local echo --verbose "$1" 'quoted text'
+sed "$@" test cd local export -eu sed ${HOME} "$1"
+	'quoted text' --verbose ${HOME} && awk export readonly -eu | 'quoted text'
+		"$@" cd readonly local cd then
+	${HOME} 'quoted text' --verbose 'quoted text' ${HOME} test x=1 export
+	"$1" "$@" grep local x=1 sed ${HOME}
+	&& 'quoted text' cd && ${HOME} awk /usr/bin
+	"$@" -eu && /usr/bin then --verbose | "$1" --verbose
+'quoted text' && sed x=1
+	${HOME} 2>/dev/null "$1" printf grep awk ${HOME} 2>/dev/null "$1" grep
+	done --verbose local awk printf grep grep readonly
+	cd "$@" awk done then /usr/bin && done
+	readonly x=1 then "$1" test $(pwd) echo
+"$1" --verbose printf
+		cd "$1" | x=1 sed printf --verbose 'quoted text' "$1" "$1" awk 'quoted text'
+echo ${HOME} local test ${HOME} printf local x=1 printf done "$1"
+		/usr/bin sed then printf then printf readonly local $(pwd) $(pwd)
+		then printf done sed "$1" export
+	awk 2>/dev/null printf -eu
+		sed cd "$1" awk /usr/bin /usr/bin 'quoted text' "$1" awk cd --verbose export
+	-eu && readonly | export -eu export awk /usr/bin echo export --verbose "$1"
+$(pwd) "$@" test export echo $(pwd) "$@" echo readonly
+echo "$@" awk printf && sed --verbose $(pwd) local "$@" sed "$@" | | x=1 $(pwd)
+		"$1" $(pwd) readonly sed then /usr/bin x=1 echo ${HOME} 'quoted text' $(pwd)
+	"$1" export --verbose /usr/bin --verbose cd 'quoted text' | test x=1 --verbose
+		"$@" export done done sed
+${HOME} "$@" ${HOME} x=1 test /usr/bin | readonly x=1 -eu echo
+$(pwd) readonly echo printf "$@" sed 'quoted text' && cd $(pwd) "$@"
+		$(pwd) export "$1" readonly local grep "$1" $(pwd) awk
+	printf test $(pwd) then 2>/dev/null then "$@" export readonly --verbose
+	-eu export && echo x=1 echo readonly "$1"
+x=1 echo printf sed echo && printf x=1
+	"$@" done | "$@" export 'quoted text' echo && -eu grep $(pwd) awk
+sed readonly done --verbose ${HOME}
+		x=1 $(pwd) test done readonly x=1
+done "$@" 2>/dev/null $(pwd) -eu "$@" printf ${HOME} | done export
+	readonly sed -eu 'quoted text' "$@"
+	/usr/bin x=1 test 'quoted text'
+	grep done readonly && then awk printf readonly
+	| readonly grep printf ${HOME} done ${HOME} && -eu | && export -eu |
+	&& cd done x=1 -eu cd test done awk local then 2>/dev/null done sed then 'quoted text'
+then 2>/dev/null -eu readonly echo printf
+-eu /usr/bin | 2>/dev/null ${HOME} printf done | test local export 'quoted text'
+	readonly | $(pwd) --verbose then $(pwd) readonly
+		| export "$1" cd sed sed printf local
+"$@" 'quoted text' x=1 --verbose test
+	x=1 && cd ${HOME} awk readonly $(pwd) | 'quoted text'
+--verbose export | export 2>/dev/null | "$@" --verbose grep sed sed
+		done awk --verbose /usr/bin "$1" echo 'quoted text' /usr/bin "$1" echo "$1" /usr/bin
+		test "$1" printf && $(pwd) -eu echo 2>/dev/null then
+${HOME} | done --verbose && 'quoted text' done
+		-eu sed "$1" done | then 'quoted text' ${HOME}
+	--verbose printf export awk -eu /usr/bin
+	| /usr/bin ${HOME} x=1 /usr/bin grep "$@" grep awk sed "$@" x=1
+		"$@" grep done done readonly echo cd sed then echo export 2>/dev/null -eu echo
+		--verbose x=1 --verbose sed 'quoted text' done
+&& ${HOME} awk $(pwd)
+	printf --verbose | then readonly export /usr/bin x=1 export grep "$1" printf 2>/dev/null
+		printf sed grep then sed
+	2>/dev/null ${HOME} | && cd ${HOME} --verbose && then "$1" echo awk
+grep /usr/bin echo echo | ${HOME} x=1 /usr/bin "$@" grep && | readonly
+		printf && 'quoted text' then -eu cd sed printf "$@" readonly printf
+		&& then printf grep && test ${HOME} 2>/dev/null
+		"$1" --verbose readonly printf
+		--verbose $(pwd) -eu x=1 x=1 export then sed 'quoted text' | $(pwd) /usr/bin cd
+		then cd 2>/dev/null printf "$1" done --verbose | echo export
+	printf printf && cd "$@" printf --verbose && test then sed readonly
+#include c45.sh
+		grep "$@" printf test 'quoted text' test done grep grep echo | --verbose ${HOME}
+	printf then "$1" x=1 'quoted text' done then $(pwd)
+		done $(pwd) cd | test "$@" && cd grep readonly -eu
+		export printf awk then --verbose local echo 2>/dev/null
+		'quoted text' printf && /usr/bin sed echo "$1" --verbose
+sed local ${HOME} -eu | grep done export
+	readonly sed test local
+&& export --verbose readonly
+/usr/bin local echo x=1 "$1" x=1 cd sed printf printf 'quoted text'
+grep awk 'quoted text' x=1 grep | "$@" --verbose 'quoted text' -eu
+		then cd "$1" test x=1 test readonly cd --verbose
+test grep done "$@" | grep
+	test --verbose --verbose && test 'quoted text'
+		--verbose done printf /usr/bin
+awk "$1" "$1" && echo /usr/bin
+	echo test grep test "$@" done 2>/dev/null local && then "$@" local sed
+done export export done $(pwd) ${HOME} export
+	grep x=1 echo echo then local -eu $(pwd) done ${HOME}
+	| done printf local -eu sed "$@"
+	2>/dev/null cd then test /usr/bin done $(pwd) /usr/bin ${HOME} -eu "$1" "$@"
+		${HOME} sed $(pwd) x=1 grep ${HOME}
+| | x=1 "$@" x=1 "$1" | x=1 grep printf test
+cd then /usr/bin x=1 2>/dev/null awk 2>/dev/null "$1" "$@" done 2>/dev/null
+	then "$1" test test export
+--verbose test grep x=1 2>/dev/null && printf 2>/dev/null
+		echo done local | /usr/bin
+		local "$@" "$1" "$1" grep -eu grep sed --verbose -eu 2>/dev/null 2>/dev/null
+| ${HOME} awk then export /usr/bin x=1
+	"$@" local readonly awk export "$@" export cd 2>/dev/null -eu "$@" sed export local
+	export awk printf export
+	${HOME} readonly 2>/dev/null 'quoted text' $(pwd) 2>/dev/null grep done then
+-eu "$1" local ${HOME} 'quoted text' && grep local --verbose "$1"
+readonly 'quoted text' local "$@" export printf /usr/bin $(pwd) x=1 then 'quoted text'
+	${HOME} && sed local cd cd && -eu "$@" grep "$1" 'quoted text'
+		echo "$1" 'quoted text'
+		| local awk "$@" $(pwd) $(pwd) --verbose 2>/dev/null "$1" $(pwd)
+		x=1 readonly grep "$1" sed awk
+		then 'quoted text' /usr/bin done && 'quoted text' $(pwd) cd awk awk -eu
+sed readonly export "$@" --verbose $(pwd) "$@" /usr/bin
+		readonly ${HOME} grep 2>/dev/null echo
+	cd then 'quoted text' cd 'quoted text'
+	cd -eu x=1 export readonly /usr/bin --verbose grep sed
+cd $(pwd) sed "$@" sed echo done "$1" 'quoted text' echo
+	${HOME} echo then awk 2>/dev/null
+		cd && readonly local --verbose && -eu | 2>/dev/null done awk local "$@"
+	2>/dev/null readonly | local
+		then | grep done then "$1" printf sed local
+		x=1 | && $(pwd) echo then --verbose grep done grep awk test "$1" $(pwd) |
+		printf ${HOME} && -eu
+'quoted text' export ${HOME} cd test "$1" "$1" export grep $(pwd)
+	echo awk && && awk /usr/bin "$1" "$@" ${HOME} grep test sed
+$(pwd) $(pwd) --verbose ${HOME} test export
+awk -eu && --verbose "$1" &&
+awk sed awk --verbose $(pwd)
+	$(pwd) $(pwd) sed then
+	-eu echo then --verbose 'quoted text' sed $(pwd) echo
+cd "$1" x=1 "$1" cd 2>/dev/null "$@" 'quoted text' printf
+		$(pwd) /usr/bin sed | export 2>/dev/null --verbose
+		${HOME} then /usr/bin readonly
+export then "$@" readonly grep 'quoted text' /usr/bin
+	&& 'quoted text' "$1" "$@" -eu /usr/bin sed -eu 2>/dev/null then
+	| local echo && ${HOME} ${HOME} | cd then && | /usr/bin -eu test cd "$1" readonly
+		-eu "$@" then grep 'quoted text' 'quoted text'
+	grep /usr/bin /usr/bin 2>/dev/null | test readonly ${HOME} echo 'quoted text' ${HOME}
+		"$@" --verbose done done
+2>/dev/null sed x=1 grep x=1 sed --verbose /usr/bin && readonly grep "$1" &&
+		-eu awk echo test echo $(pwd) test local
+	export export export $(pwd) cd printf grep echo $(pwd) export
+| done && | -eu | | ${HOME} then local -eu echo --verbose
+	export cd readonly | test --verbose echo $(pwd)
+printf echo done 2>/dev/null --verbose export
+		"$1" && -eu 'quoted text'
+		sed local local printf readonly --verbose
+sed x=1 'quoted text' done
+		| -eu printf && "$@" printf ${HOME} echo export grep "$1" awk
+	x=1 printf done sed x=1 local 'quoted text' $(pwd) grep && ${HOME} awk echo printf
+	grep printf -eu "$1" cd done /usr/bin $(pwd) 2>/dev/null && | -eu awk
+		'quoted text' && then then readonly awk printf 'quoted text' /usr/bin
+	local awk "$@" 2>/dev/null
+		then x=1 readonly | then
+	"$@" && then cd done x=1 x=1 test -eu
+	export echo test local test 2>/dev/null awk echo
+x=1 grep "$1" -eu ${HOME} /usr/bin sed done "$1"
+"$1" && awk then readonly test 'quoted text' printf | "$1" --verbose test sed
+	awk x=1 test echo export grep cd echo -eu ${HOME} "$@"
+printf cd export sed grep x=1 'quoted text' 2>/dev/null local readonly echo 'quoted text'
+	done && 'quoted text' test test
+local "$1" "$@" readonly 2>/dev/null "$1" --verbose then sed awk readonly
+cd $(pwd) $(pwd) readonly x=1
+echo test readonly "$1" then && /usr/bin ${HOME} readonly local 'quoted text'
+	grep then done x=1 /usr/bin echo ${HOME} 2>/dev/null x=1
+		echo $(pwd) 2>/dev/null
+	&& readonly sed cd cd 'quoted text'
+		&& ${HOME} printf done grep $(pwd)
+then test -eu then sed done
+		$(pwd) echo sed local local "$1" local "$1" -eu awk
+cd $(pwd) -eu printf 2>/dev/null x=1 $(pwd)
+grep then ${HOME} $(pwd) &&
+		printf -eu local then 2>/dev/null then test awk done ${HOME} export
+		2>/dev/null ${HOME} echo readonly && grep
+		printf cd "$@" readonly "$1" done local test test "$1" done 2>/dev/null
+	--verbose ${HOME} $(pwd) done readonly ${HOME} done cd "$1" sed readonly
+		$(pwd) -eu $(pwd) echo -eu then $(pwd) "$1" -eu done awk cd readonly ${HOME}
+/usr/bin then "$1" sed "$@" grep sed 2>/dev/null
+		local 'quoted text' echo
+"$@" then echo printf "$1" 2>/dev/null 2>/dev/null then test then
+		then export then grep sed | export x=1 "$1" test local 2>/dev/null
+	| ${HOME} && then test grep -eu ${HOME}
+	&& local cd then 2>/dev/null done && 2>/dev/null --verbose 'quoted text'
+	grep "$1" -eu cd grep echo echo awk && readonly $(pwd) sed test echo local
+		${HOME} grep test local "$@" sed && "$@" | && --verbose awk --verbose && export
+	export /usr/bin "$1" readonly readonly sed && $(pwd) local -eu
+| export | local ${HOME} test printf printf ${HOME}
+		$(pwd) -eu cd cd printf readonly
+"$1" local grep then test local
+echo /usr/bin sed x=1 export $(pwd) "$@" -eu "$1" printf echo cd
+		echo x=1 -eu 2>/dev/null echo grep
+grep ${HOME} awk "$1" done grep 'quoted text' "$@"
+	| -eu sed test grep awk done x=1 $(pwd)
+	'quoted text' printf | --verbose ${HOME} cd /usr/bin "$@" cd readonly ${HOME}
+export readonly ${HOME} readonly
+	'quoted text' local ${HOME} /usr/bin
+	awk test x=1 2>/dev/null ${HOME} export -eu echo x=1 /usr/bin awk export
+		| "$1" export printf "$1" $(pwd) local && ${HOME} -eu "$1" export
+		test printf | ${HOME} awk 'quoted text' local sed sed export --verbose
+	2>/dev/null "$@" && done
+	'quoted text' export awk ${HOME}
+	$(pwd) local | "$1" "$1" printf test printf ${HOME} /usr/bin local ${HOME} printf
+		2>/dev/null 'quoted text' readonly -eu done awk then local local awk x=1
+		-eu echo echo | 'quoted text'
+2>/dev/null | x=1 local grep cd grep 2>/dev/null export sed then awk grep
+cd test "$1" 2>/dev/null 2>/dev/null | 2>/dev/null && echo readonly
+&& grep 2>/dev/null 2>/dev/null cd sed -eu
+"$1" cd /usr/bin --verbose cd ${HOME} /usr/bin
+	| echo 2>/dev/null test 'quoted text' ${HOME} test $(pwd)
+		local readonly --verbose test
+-eu | | && /usr/bin | cd printf && awk 2>/dev/null
+&& local | grep sed x=1 export
+then "$1" -eu /usr/bin then echo readonly grep awk --verbose
+		$(pwd) | grep x=1 'quoted text' ${HOME} 'quoted text' x=1 export x=1 then
+	"$@" ${HOME} export $(pwd) readonly echo
+sed $(pwd) done 2>/dev/null done /usr/bin /usr/bin grep ${HOME}
+	local x=1 export 'quoted text' then 'quoted text'
+		cd export && 'quoted text' 2>/dev/null then test
+	$(pwd) cd then cd -eu | 'quoted text'
+		| 'quoted text' -eu 2>/dev/null
+awk sed then 'quoted text' cd echo readonly && readonly
+		2>/dev/null test $(pwd) "$1"
+cd awk 'quoted text' -eu -eu $(pwd) grep $(pwd) ${HOME}
+		readonly "$@" test && local 2>/dev/null
+		| /usr/bin | --verbose | printf test
+		export "$@" $(pwd) printf "$@" 'quoted text' -eu
+		2>/dev/null -eu sed x=1 readonly readonly
+		"$1" && cd | $(pwd) $(pwd) -eu 2>/dev/null
+	export 2>/dev/null x=1 awk && then /usr/bin | "$1" local 2>/dev/null test done
+cd awk ${HOME} "$1" ${HOME} done -eu --verbose
+| local printf 'quoted text' ${HOME} $(pwd) echo readonly -eu
+	-eu readonly --verbose grep grep printf awk done 2>/dev/null test
+grep ${HOME} -eu awk ${HOME} --verbose
+	done awk then test done && cd x=1 test $(pwd) && then awk export
+	'quoted text' test cd $(pwd) printf local export done cd export
+		${HOME} sed done 2>/dev/null done export -eu ${HOME}
+		grep readonly && 'quoted text'
+sed "$@" awk awk printf x=1 test
+		echo | ${HOME} 2>/dev/null "$@" 'quoted text' --verbose printf -eu echo
+sed test test "$@" echo --verbose grep x=1 cd
+		grep ${HOME} && $(pwd) then
+	'quoted text' && sed export && printf awk "$@" test "$1" echo then printf
+		awk -eu $(pwd) local x=1 | 2>/dev/null
+	echo export 2>/dev/null x=1 done then readonly local x=1 /usr/bin
+	done grep export "$@" ${HOME} "$1" awk test && export readonly x=1 local
+&& "$@" grep 'quoted text' ${HOME}
+		sed cd then | 'quoted text'
+&& ${HOME} x=1 "$1" 'quoted text' grep
+	/usr/bin $(pwd) | sed local $(pwd) cd ${HOME}
+		"$1" export done readonly 'quoted text' cd test cd awk done cd ${HOME} echo /usr/bin
+sed awk sed echo cd | grep |
+	awk /usr/bin 'quoted text' x=1 --verbose
+		test | grep readonly 'quoted text' test then x=1 readonly readonly $(pwd)
+$(pwd) awk done cd then awk local then && local -eu
+local ${HOME} -eu | echo | -eu 'quoted text' "$1"
+		readonly | readonly printf ${HOME} 2>/dev/null x=1 done &&
+local export printf then x=1 | test done then printf done
+		/usr/bin readonly cd echo && "$@" 2>/dev/null then local -eu ${HOME}
+	cd then | cd "$1" /usr/bin test | "$1" then test local --verbose awk awk -eu
+	x=1 export grep sed -eu
+		| "$1" /usr/bin grep
+then 'quoted text' local /usr/bin "$@"
+		then $(pwd) 'quoted text' && /usr/bin readonly
+		export awk cd local done 2>/dev/null readonly done ${HOME} export
+	'quoted text' /usr/bin --verbose | 2>/dev/null
+/usr/bin then | cd local "$@" -eu export grep
+	| test awk | "$@" 2>/dev/null && cd readonly
+	${HOME} 2>/dev/null --verbose done test echo done 2>/dev/null && x=1
+then | done 2>/dev/null -eu
+	&& | ${HOME} grep 'quoted text' ${HOME} printf "$1" 'quoted text' 'quoted text'
+		"$1" -eu && $(pwd) --verbose "$1" export export $(pwd) sed
+		"$1" grep | "$@" 'quoted text' export
+	local sed --verbose --verbose printf "$@" awk -eu x=1 local awk /usr/bin
+--verbose /usr/bin export local cd echo ${HOME} export /usr/bin awk
+		then echo test -eu export | | && | then 2>/dev/null "$@" awk x=1 /usr/bin x=1 x=1
+		cd $(pwd) "$@" 'quoted text'
+		'quoted text' /usr/bin x=1
+		export ${HOME} readonly
+done then readonly "$1" awk /usr/bin
+	test -eu 2>/dev/null echo test done printf test "$@"
+		2>/dev/null sed $(pwd) then $(pwd) grep 2>/dev/null --verbose test export then
+		then && test test 'quoted text' printf
+"$1" done /usr/bin x=1 grep cd 2>/dev/null $(pwd) "$1"
+sed 'quoted text' export
+		cd -eu awk cd ${HOME} 'quoted text'
+	then "$1" awk && test --verbose readonly 'quoted text'
+grep ${HOME} export 2>/dev/null
+		printf awk printf done -eu "$1" | "$1" export -eu $(pwd) "$1" local then
+		test done cd x=1 | --verbose -eu 2>/dev/null ${HOME}
+	echo sed local ${HOME} readonly echo && x=1 readonly awk readonly
+	test && awk test ${HOME} && test awk &&
+		"$@" done sed 'quoted text' local 2>/dev/null cd awk local && $(pwd) --verbose
+"$1" cd | 'quoted text' done cd done 'quoted text' -eu awk cd cd | "$@"
+		/usr/bin sed $(pwd) -eu "$@" cd && cd export done awk export --verbose
+		test ${HOME} echo $(pwd) test ${HOME} "$1" then
+/usr/bin export $(pwd) then "$@" then printf x=1
+awk echo 'quoted text' then export "$@" export
+	readonly "$1" cd 2>/dev/null local /usr/bin awk sed test
+		test test 'quoted text' local
+then test /usr/bin && "$@" 'quoted text' then sed done x=1 $(pwd) export x=1
+cd cd echo test "$1" "$1" $(pwd) && test echo
+	readonly done readonly done 'quoted text' done 2>/dev/null printf
+		2>/dev/null cd echo x=1 x=1 $(pwd)
+		grep readonly awk -eu echo echo grep grep "$@" local 'quoted text'
+	test /usr/bin done readonly
+	test export sed then cd -eu "$1"
+		done | /usr/bin | readonly test 'quoted text'
+"$@" 'quoted text' -eu 2>/dev/null printf test done then $(pwd) --verbose 2>/dev/null
+		awk "$@" /usr/bin "$1" "$@" ${HOME}
+	test cd ${HOME} export ${HOME} test ${HOME} x=1 ${HOME} printf
+x=1 "$@" ${HOME} ${HOME}
+		-eu then "$@" 2>/dev/null 'quoted text'
+sed "$1" "$@" printf && export 'quoted text'
+	$(pwd) printf --verbose test --verbose "$@" -eu sed --verbose grep 2>/dev/null
+		&& test done x=1 | 'quoted text'
+	"$@" sed | "$1" test local export
+	grep awk cd 2>/dev/null /usr/bin
+		-eu cd && -eu -eu | printf -eu "$1" awk cd printf 'quoted text'
+		awk | "$1" cd export cd /usr/bin
+	sed ${HOME} -eu cd awk local /usr/bin test test
+cd $(pwd) -eu | awk $(pwd) --verbose awk $(pwd) local
+	--verbose $(pwd) $(pwd) test --verbose && local local
+		grep printf | echo "$1" | grep x=1 export then x=1 test --verbose done readonly
+| sed test test cd export --verbose x=1 ${HOME} "$@" readonly readonly 2>/dev/null
+| -eu then $(pwd) export && local
+		export echo then done | x=1 2>/dev/null && | ${HOME}
+		grep "$1" x=1 grep 2>/dev/null
+	sed | $(pwd) "$1" && grep test printf then 2>/dev/null
+&& | sed local && | 'quoted text' ${HOME} test then 'quoted text'
+2>/dev/null done "$1" -eu x=1 cd test | export
+	readonly "$@" awk sed
+	2>/dev/null | sed export x=1 x=1 local 2>/dev/null 2>/dev/null printf --verbose
+grep sed test 2>/dev/null 'quoted text' &&
+| 'quoted text' readonly && -eu then && | echo export readonly test awk echo
+	then readonly $(pwd) 2>/dev/null cd --verbose export $(pwd) 'quoted text'
+'quoted text' test grep done --verbose
+	sed cd echo sed "$1" awk echo ${HOME} 2>/dev/null
+	test awk 2>/dev/null then "$1" cd "$@"
+"$@" 'quoted text' && echo done | grep grep -eu done printf test /usr/bin
+		$(pwd) --verbose /usr/bin
+awk | "$@" readonly && then local grep | 'quoted text'
+	printf sed "$1" export "$1"
+		export /usr/bin readonly 'quoted text' -eu -eu $(pwd) printf
+"$@" | 2>/dev/null export export 2>/dev/null awk printf export printf /usr/bin
+echo "$1" export $(pwd) awk cd | "$@" printf /usr/bin "$@" printf 2>/dev/null done
+		&& done readonly | | local cd cd cd awk --verbose ${HOME} "$1" echo
+x=1 "$1" "$1" "$@" cd sed local | /usr/bin readonly 'quoted text'
+done test export | sed | "$1" local readonly && x=1
+	"$@" "$1" $(pwd) test cd printf done 2>/dev/null local --verbose sed
+		2>/dev/null ${HOME} test
+	"$1" sed test && done printf x=1 'quoted text'
+	done cd awk 2>/dev/null -eu then 'quoted text' echo -eu test readonly printf local
+		local /usr/bin /usr/bin "$@" -eu
+grep 2>/dev/null cd --verbose && awk --verbose &&
+		$(pwd) printf printf echo | awk echo x=1 awk
+		echo grep && done echo test echo test $(pwd)
+		test test readonly done x=1 test ${HOME} grep -eu && "$@" export x=1 export
+	local sed && $(pwd) /usr/bin sed cd $(pwd) 2>/dev/null 'quoted text' awk
+export --verbose then -eu $(pwd)
+		$(pwd) local test 2>/dev/null export
+printf "$1" x=1 then readonly test readonly cd readonly
+grep local cd 2>/dev/null | $(pwd)
+grep cd x=1 2>/dev/null
+		2>/dev/null export then cd printf /usr/bin sed grep | cd "$1" ${HOME} ${HOME}
+export --verbose "$1" export "$@" --verbose $(pwd) printf 2>/dev/null
+	2>/dev/null 2>/dev/null $(pwd)
+	'quoted text' "$1" "$1" then printf x=1
+	"$1" awk printf "$1" export printf cd sed test export export 'quoted text'
+	"$1" -eu "$1" x=1 then 'quoted text' grep --verbose | x=1 printf 2>/dev/null "$1"
+	-eu then cd /usr/bin "$@" awk | readonly grep | echo awk readonly
+		| sed ${HOME} echo sed 'quoted text' grep export ${HOME} && export grep export
+	echo grep export | printf grep sed echo echo echo readonly done /usr/bin
+	/usr/bin | && export then && | $(pwd) sed "$@" 2>/dev/null
+	"$1" echo then sed --verbose | echo done cd "$1" && export cd
+		-eu --verbose $(pwd) x=1 printf export 'quoted text'
+	test -eu -eu ${HOME} done local grep sed done --verbose
+		sed && -eu cd "$@" readonly "$1" readonly readonly -eu awk | sed | 2>/dev/null awk
+$(pwd) grep echo export then /usr/bin 2>/dev/null /usr/bin 2>/dev/null test
+echo x=1 --verbose done awk sed
+		echo export local 2>/dev/null 2>/dev/null
+		${HOME} then sed echo local then echo
+	export printf "$@" $(pwd)
+		printf cd test local --verbose --verbose /usr/bin echo done -eu ${HOME}
+		readonly done x=1 printf && local 'quoted text' --verbose local sed local
+		local awk readonly done readonly echo
+		--verbose readonly then 2>/dev/null sed "$1" "$1" 'quoted text' /usr/bin
+${HOME} && $(pwd) "$@" local sed
+		then then then then x=1 2>/dev/null -eu 'quoted text'
+	"$1" -eu x=1 sed grep awk readonly readonly awk done readonly ${HOME} "$@"
+printf x=1 then --verbose "$@" readonly "$@" ${HOME} -eu "$@" done awk
+		export /usr/bin x=1 sed && /usr/bin export echo "$1" local
+	/usr/bin local --verbose cd echo "$@" local
+	"$1" -eu export export --verbose --verbose echo awk export local
+then grep export grep sed ${HOME} done echo | /usr/bin grep
+	grep 2>/dev/null -eu 'quoted text' export then ${HOME} echo --verbose
+	--verbose | then cd /usr/bin ${HOME} "$1" printf readonly "$@" awk /usr/bin
+	2>/dev/null && sed 'quoted text' | "$1" sed && cd then
+		--verbose "$@" grep 'quoted text' grep && then "$1" /usr/bin
+"$@" x=1 "$@" "$@" local
+		-eu sed "$@" 'quoted text' "$@" "$@"
+	export then awk export export ${HOME} cd && "$1"
+		${HOME} "$1" /usr/bin "$1" echo -eu done ${HOME} 'quoted text'
+awk cd cd local | awk local readonly
+	done local x=1 ${HOME} printf "$1" ${HOME} done export
+		| readonly sed sed && grep then $(pwd) $(pwd) echo /usr/bin 2>/dev/null 'quoted text'
+		echo -eu export printf --verbose 'quoted text' sed echo --verbose $(pwd) --verbose
+	| echo done echo | | ${HOME} awk | done --verbose then grep test 2>/dev/null "$1"
+		export cd test "$1" --verbose
+	${HOME} done test "$1" then readonly
+	local export ${HOME} && then 'quoted text' && export test cd then
+readonly /usr/bin -eu
+echo $(pwd) grep readonly
+done grep readonly then ${HOME} cd printf x=1 2>/dev/null
+then sed done x=1 awk echo "$1" awk | awk sed echo "$1" awk cd sed $(pwd)
+		local export awk echo test --verbose $(pwd) -eu && 2>/dev/null
+readonly x=1 echo && printf then $(pwd) local
+	awk export | 2>/dev/null done -eu
+		&& export $(pwd) then printf then test
+	$(pwd) then readonly && && $(pwd) grep grep "$@" cd awk 2>/dev/null
+	--verbose cd readonly 2>/dev/null | done grep
+		"$1" x=1 -eu cd /usr/bin --verbose
+		/usr/bin x=1 export local
+test done sed cd cd echo test 2>/dev/null cd awk then export "$@" x=1 $(pwd) printf
+	&& /usr/bin $(pwd) done
+		"$1" | 2>/dev/null x=1
+	awk -eu "$1" then && /usr/bin
+$(pwd) -eu && printf awk awk sed -eu printf --verbose test 'quoted text'
+	"$1" grep cd echo sed /usr/bin $(pwd) "$1" $(pwd)
+		readonly /usr/bin 'quoted text' && local export cd && export
+	sed x=1 | "$@" /usr/bin local test awk test
+	awk && then "$@" readonly local -eu 'quoted text'
+		$(pwd) ${HOME} --verbose awk
+		2>/dev/null grep local then 2>/dev/null && sed local -eu done
+cd grep $(pwd) test /usr/bin -eu then -eu && echo echo -eu done
+x=1 done export ${HOME} "$@" "$1" printf local "$1" awk 2>/dev/null echo
+	sed then echo export grep printf $(pwd) grep x=1 done /usr/bin printf printf ${HOME}
+local test local -eu --verbose done local ${HOME}
+		2>/dev/null readonly 'quoted text' readonly x=1 grep then -eu
+		sed $(pwd) then sed 'quoted text' x=1 -eu then test && echo 'quoted text'
+cd --verbose && "$1" $(pwd) "$@" test
+	/usr/bin then readonly /usr/bin done readonly printf awk | sed
+-eu 'quoted text' grep cd cd && "$1" printf test | grep test test
+		${HOME} then grep --verbose && ${HOME} --verbose printf && local | --verbose
+-eu cd done awk awk /usr/bin --verbose "$@" | echo --verbose
+	awk test "$1" then cd export printf export test /usr/bin
+grep $(pwd) ${HOME} "$@" /usr/bin | sed
+		export sed grep /usr/bin test ${HOME}
+	grep export && | 'quoted text' printf cd 2>/dev/null --verbose sed
+-eu && -eu x=1 && "$1" x=1 -eu "$@" /usr/bin export 2>/dev/null
+		local then echo cd printf echo sed
+${HOME} --verbose x=1 then 2>/dev/null 2>/dev/null
+	| 2>/dev/null sed local grep readonly
+sed cd sed 2>/dev/null /usr/bin "$1" grep 2>/dev/null sed ${HOME} |
+awk test $(pwd) printf test then readonly
+awk export $(pwd) readonly cd test 2>/dev/null -eu ${HOME} "$1" awk done
+/usr/bin grep done awk cd "$@" "$1"
+	2>/dev/null $(pwd) echo awk /usr/bin "$@" && readonly
+		--verbose x=1 readonly $(pwd) done printf | 'quoted text'
+2>/dev/null -eu ${HOME} printf && cd | sed | 2>/dev/null --verbose then 'quoted text'
+${HOME} export --verbose "$@" readonly then /usr/bin echo "$@"
+		-eu sed /usr/bin "$1" 2>/dev/null x=1 "$@" test | "$@" 'quoted text'
+printf /usr/bin $(pwd) awk x=1 sed export local $(pwd)
+	awk test test awk && local 2>/dev/null
+		test -eu && local && done && echo readonly
+		$(pwd) echo && 'quoted text' readonly local x=1 "$1" "$1" --verbose 2>/dev/null
+&& then awk done export | test then ${HOME} done
+		"$1" | | then sed test done cd /usr/bin
+	cd | /usr/bin x=1 2>/dev/null printf grep printf then awk | --verbose echo
+	done then echo then --verbose --verbose grep x=1 echo local printf 'quoted text'
+		then printf -eu 'quoted text' awk | && done "$@" "$1" sed echo ${HOME} ${HOME}
+		test export grep x=1 readonly
+"$1" "$@" awk ${HOME} /usr/bin local test awk grep --verbose
+	readonly ${HOME} grep sed done /usr/bin printf readonly export $(pwd)
+	echo --verbose --verbose x=1 /usr/bin ${HOME} $(pwd) grep 'quoted text'
+		echo readonly echo then printf && && 'quoted text'
+		'quoted text' 'quoted text' then echo x=1 then /usr/bin
+2>/dev/null printf | export | --verbose --verbose local done x=1 "$@"
+		cd /usr/bin awk test ${HOME} | done printf --verbose x=1 printf
+		local done --verbose export /usr/bin "$@" && done "$1" "$@" readonly | ${HOME}
+readonly && readonly readonly /usr/bin | $(pwd)
+	grep && done readonly "$@" /usr/bin "$1" echo done readonly | readonly ${HOME}
+		readonly awk 'quoted text' 'quoted text' awk done local sed "$1"
+then sed local "$@" printf
+		"$1" x=1 cd x=1 local --verbose readonly -eu awk
+		grep then "$@" sed 2>/dev/null
+		done awk cd x=1 export sed "$@" printf cd "$@" --verbose 'quoted text'
+grep grep test /usr/bin ${HOME} grep awk 'quoted text' --verbose $(pwd)
+		'quoted text' local "$@" ${HOME} awk printf
+		awk | | sed cd /usr/bin $(pwd) done echo $(pwd) sed printf $(pwd) "$@"
+		"$@" | "$1" awk then grep 'quoted text' local
+/usr/bin x=1 test /usr/bin --verbose --verbose 'quoted text' $(pwd)
+		then "$@" then /usr/bin cd local test done
+	done "$@" export "$@" ${HOME}
+		/usr/bin ${HOME} export echo && ${HOME} printf && printf local | "$@" && test
+	-eu ${HOME} "$@" | readonly --verbose
+	--verbose --verbose test printf -eu
+	--verbose "$1" awk awk local awk && done awk readonly $(pwd) "$1" local echo awk
+	printf -eu cd /usr/bin && --verbose "$1" test
+	then $(pwd) 2>/dev/null 2>/dev/null
+		readonly /usr/bin | -eu "$@" printf grep | printf then x=1 export awk printf
+	sed ${HOME} -eu $(pwd) "$1" && echo --verbose x=1 printf
+		readonly cd readonly $(pwd) | cd
+	export 'quoted text' grep 'quoted text' | local "$1" grep done
+		${HOME} readonly readonly done
+2>/dev/null grep done test "$1" cd && then then
+		done /usr/bin --verbose printf 2>/dev/null "$1" "$1"
+	| test -eu awk then 2>/dev/null export -eu &&
+	sed readonly 'quoted text' "$1" echo export then "$@" grep "$1" x=1
+	printf sed printf sed ${HOME} | local then local x=1 grep cd sed
+		then grep export export "$@" then ${HOME} printf 2>/dev/null "$@" readonly 2>/dev/null
+	test | grep done cd x=1 && x=1 /usr/bin | echo x=1 2>/dev/null sed && $(pwd)
+grep printf /usr/bin echo sed local sed local then 'quoted text' ${HOME} done
+		then readonly awk $(pwd) "$@" /usr/bin "$@"
+echo -eu readonly sed $(pwd) readonly -eu grep 2>/dev/null
+	${HOME} "$1" printf -eu test
+"$@" grep "$@" export --verbose echo -eu -eu
+	"$1" x=1 | awk sed --verbose local grep local -eu $(pwd)
+	then export sed grep sed 'quoted text'
+	done --verbose echo "$@" done 'quoted text'
+		&& "$1" readonly -eu 2>/dev/null grep readonly /usr/bin
+	then done 2>/dev/null /usr/bin 'quoted text'
+printf x=1 2>/dev/null 'quoted text'
+	${HOME} x=1 local test "$1" x=1
+	done $(pwd) then test x=1 cd && sed grep awk then printf test awk &&
+	2>/dev/null done echo | $(pwd) "$@" test grep --verbose
+	export "$@" --verbose ${HOME} /usr/bin
+		then ${HOME} 2>/dev/null export ${HOME} "$@" x=1 'quoted text'
+		-eu $(pwd) 2>/dev/null readonly --verbose export test cd && --verbose /usr/bin cd
+		echo printf x=1 echo x=1 /usr/bin ${HOME} /usr/bin "$@" $(pwd) -eu | cd echo /usr/bin
+	/usr/bin local "$1" awk "$@"
+	grep && -eu then -eu | 2>/dev/null
+		sed grep local 'quoted text' 'quoted text' export echo then cd $(pwd)
+	"$@" grep $(pwd) 2>/dev/null "$1" "$@" then readonly | ${HOME}
+"$1" 'quoted text' test "$@" ${HOME}
+"$1" printf grep cd export grep awk awk done ${HOME} x=1 2>/dev/null
+		done printf --verbose echo
+		sed local printf 2>/dev/null awk done printf
+	| grep echo then awk cd printf
+	x=1 ${HOME} test cd done then readonly && cd echo
+	grep echo readonly -eu && -eu export sed grep
+		/usr/bin readonly test grep 2>/dev/null
+	echo -eu -eu grep readonly test | local echo local echo export sed "$@" printf
+		local awk readonly && done && --verbose echo done printf 'quoted text'
+	done -eu grep ${HOME} /usr/bin 2>/dev/null done test
+	printf x=1 readonly sed | done x=1 done $(pwd) local 2>/dev/null
+export /usr/bin then awk cd sed readonly | echo grep export cd | -eu test "$@"
+	--verbose echo ${HOME} done && readonly | export test
+		${HOME} 2>/dev/null && && then $(pwd) cd -eu && "$@" 2>/dev/null export ${HOME}
+	/usr/bin 'quoted text' then 2>/dev/null | |
+${HOME} "$@" grep echo then readonly x=1 /usr/bin
+x=1 | cd 2>/dev/null then "$1" 2>/dev/null cd cd then awk /usr/bin export
+		awk readonly awk x=1 -eu ${HOME} "$1" export
+2>/dev/null && -eu -eu x=1 2>/dev/null
+	2>/dev/null "$1" | -eu 2>/dev/null awk done
+	sed x=1 'quoted text' readonly then
+then -eu | "$1" then | -eu 'quoted text' "$1" local 2>/dev/null && "$@"
+	sed sed echo | /usr/bin grep
+"$@" cd test && readonly printf 'quoted text'
+	readonly -eu && echo local awk 2>/dev/null && "$@" done readonly
+	$(pwd) 2>/dev/null && ${HOME} then printf readonly
+		cd "$1" "$1" cd ${HOME} ${HOME} cd 'quoted text' export
+		&& ${HOME} printf 2>/dev/null 'quoted text' echo $(pwd) awk x=1 -eu
+x=1 && "$1" readonly done local grep
+		readonly && readonly x=1 echo readonly
+		&& ${HOME} printf /usr/bin
+		export local done printf &&
+-eu export echo then "$@" "$1" cd "$@" grep -eu ${HOME} $(pwd) readonly
+sed /usr/bin echo --verbose awk cd "$@" cd x=1 2>/dev/null | | $(pwd)
+	test "$1" $(pwd) export test x=1 readonly then test $(pwd) 'quoted text'
+	export printf "$@" --verbose 2>/dev/null export awk readonly readonly echo cd
+		&& && ${HOME} cd echo printf done export sed done 2>/dev/null ${HOME} cd then
+	/usr/bin echo --verbose printf "$@" cd readonly $(pwd)
+		$(pwd) && 2>/dev/null 2>/dev/null /usr/bin $(pwd) sed /usr/bin "$@"
+		export $(pwd) echo $(pwd) && ${HOME} then | /usr/bin sed x=1 && $(pwd) test
+sed sed "$@" "$1" grep printf then export "$@" awk echo && cd export
+x=1 echo test 'quoted text' local cd
+awk $(pwd) cd --verbose | done "$@" $(pwd) ${HOME} ${HOME} then grep grep readonly
+$(pwd) awk $(pwd) /usr/bin "$@" 'quoted text' awk $(pwd) "$@"
+/usr/bin grep printf readonly test printf then "$1" -eu test grep
+	export $(pwd) test | printf $(pwd) --verbose readonly export
+	export 2>/dev/null | export | readonly
+done then export "$1" local --verbose awk
+	local local readonly cd /usr/bin
+	/usr/bin then "$1" readonly
+-eu grep test --verbose printf && readonly
+then cd echo -eu -eu ${HOME} grep test "$@" printf cd x=1 test export
+		test 2>/dev/null local "$@" ${HOME} 2>/dev/null
+	awk 'quoted text' test "$1" readonly
+	export sed echo grep $(pwd) --verbose test | -eu export export
+		2>/dev/null $(pwd) 2>/dev/null --verbose 2>/dev/null
+	'quoted text' readonly "$1" readonly then export $(pwd) export --verbose ${HOME}
+		then 'quoted text' sed ${HOME} /usr/bin sed --verbose awk 2>/dev/null
+2>/dev/null echo readonly local
+	"$@" --verbose "$1" cd 'quoted text' sed test x=1 readonly ${HOME} echo ${HOME}
+done $(pwd) /usr/bin printf echo printf cd then 2>/dev/null echo
+	${HOME} echo | cd | --verbose /usr/bin
+	readonly 'quoted text' readonly -eu export | /usr/bin done "$1" readonly
+	readonly done done export x=1 test sed readonly grep sed test export
+		-eu ${HOME} readonly test $(pwd) done grep ${HOME} awk echo
+		grep 2>/dev/null sed grep "$@" readonly cd awk ${HOME} printf --verbose then grep
+		x=1 grep "$1" then 2>/dev/null && awk
+--verbose grep | 2>/dev/null local -eu sed --verbose -eu | test
+	awk x=1 done "$1" printf export done local && local
+&& "$1" readonly printf
+		printf "$@" then | readonly
+${HOME} export x=1 grep local then echo
+local 'quoted text' 'quoted text' "$@" 'quoted text' local cd "$1" done printf
+x=1 | test printf awk cd /usr/bin --verbose echo awk grep
+--verbose --verbose export "$1" local test echo "$@" sed $(pwd) readonly 'quoted text'
+		x=1 x=1 "$1" readonly "$@" echo x=1 "$1" x=1 2>/dev/null local ${HOME}
+	&& $(pwd) printf x=1 cd $(pwd) x=1
+	sed readonly -eu 'quoted text' then "$1" "$@" awk local grep x=1 &&
+		test 2>/dev/null sed sed -eu grep
+	printf export test x=1
+$(pwd) --verbose grep awk readonly awk "$@" $(pwd) then export printf
+	readonly "$1" "$1" /usr/bin 2>/dev/null
+		${HOME} --verbose && printf
+	then cd ${HOME} local && then /usr/bin grep grep 'quoted text'
+	awk x=1 --verbose ${HOME} printf echo echo readonly --verbose awk awk
+		"$@" | 2>/dev/null done grep --verbose "$@" export $(pwd) grep grep
+		export | sed ${HOME} readonly "$@" && export
+"$1" --verbose test export readonly then -eu echo then 2>/dev/null
+	awk printf printf export --verbose "$@" && done
+	test 'quoted text' -eu
+		export test cd test 'quoted text' echo --verbose --verbose printf export printf
+		${HOME} x=1 printf grep cd -eu $(pwd) && echo
+		--verbose -eu readonly /usr/bin then export done echo readonly &&
+	done sed ${HOME} then done test 'quoted text' printf echo
+		2>/dev/null /usr/bin then && /usr/bin readonly sed
+echo sed | done && 2>/dev/null -eu --verbose "$@" done --verbose
+	grep "$1" | echo printf "$@" awk local
+"$@" awk export readonly --verbose "$1"
+/usr/bin x=1 then export readonly "$1" grep sed --verbose
+sed sed then ${HOME} -eu awk "$@" 'quoted text'
+--verbose -eu x=1 printf /usr/bin ${HOME} $(pwd)
+x=1 done then 2>/dev/null | sed printf /usr/bin readonly ${HOME} cd done then |
+		printf readonly echo --verbose && echo cd "$@"
+		then "$1" --verbose test --verbose --verbose
+	-eu --verbose | test && | cd
+	$(pwd) local --verbose cd printf "$1" --verbose x=1 'quoted text'
+		-eu && readonly awk grep | echo
+	"$@" export grep "$@" "$@" "$1" 'quoted text' "$1" grep
+	grep done $(pwd) x=1 | | | test ${HOME} done
+echo local cd cd | x=1 readonly 'quoted text'
+done && /usr/bin cd printf --verbose && | done
+export "$1" | -eu x=1 awk $(pwd) echo echo export "$@" grep local grep
+	${HOME} x=1 local --verbose 'quoted text'
+		then /usr/bin printf readonly
+	2>/dev/null test 2>/dev/null awk done ${HOME} ${HOME} done test
+		x=1 'quoted text' sed x=1 2>/dev/null grep && grep -eu local x=1 /usr/bin
+		sed awk printf | x=1 sed awk --verbose echo awk 2>/dev/null printf
+	${HOME} ${HOME} export test --verbose
+"$@" --verbose $(pwd)
+then awk export ${HOME} 'quoted text' 2>/dev/null
+	printf readonly && "$@" echo --verbose
+		local $(pwd) test $(pwd) && -eu local grep sed export | 2>/dev/null
+		$(pwd) --verbose cd test 'quoted text' echo && grep x=1 --verbose
+	printf && ${HOME} cd done export printf readonly x=1 --verbose
+--verbose test "$1" "$1" "$@" "$1" 'quoted text' /usr/bin readonly 'quoted text'
+export printf export x=1 && 2>/dev/null then
+		--verbose | export printf 'quoted text' local x=1 export x=1 'quoted text'
+	readonly | /usr/bin "$1" -eu export awk printf readonly ${HOME} export $(pwd) done
+	"$@" done readonly cd 'quoted text' local local echo test /usr/bin
+		local done /usr/bin ${HOME} done echo grep "$1" --verbose --verbose 2>/dev/null
+		"$@" sed -eu test export export
+		$(pwd) --verbose 'quoted text'
+		cd export --verbose awk export echo x=1 sed export awk $(pwd) ${HOME}
+	done "$@" test -eu -eu cd then | --verbose grep then x=1 $(pwd)
+cd "$@" --verbose local echo awk echo readonly then "$1" export
+/usr/bin -eu | export /usr/bin awk awk && sed readonly
+	export readonly local -eu awk cd test $(pwd) | $(pwd) x=1 "$1" |
+		cd sed awk 2>/dev/null cd awk local "$@" 2>/dev/null local | cd "$1" done
+grep printf printf test cd /usr/bin
+		x=1 echo then x=1 | /usr/bin export && export 'quoted text' grep done printf grep
+/usr/bin printf x=1 then 'quoted text' | "$@" 'quoted text' x=1 awk &&
+		done sed grep "$@" export "$@" local -eu | --verbose printf &&
+	/usr/bin --verbose -eu awk cd local sed $(pwd) test /usr/bin /usr/bin
+		"$1" | cd test grep readonly sed "$1" "$1" "$@" local
+		awk && local grep awk "$@" sed "$1" done grep readonly done export
+grep /usr/bin 2>/dev/null | x=1 /usr/bin test test "$1" && "$@" x=1 local
+	&& readonly echo done /usr/bin 'quoted text'
+sed then x=1 && sed awk test local grep ${HOME} x=1 --verbose ${HOME} /usr/bin
+sed /usr/bin $(pwd) $(pwd) /usr/bin "$1" && done "$1" | 2>/dev/null
+		$(pwd) echo "$@" readonly then export "$1" --verbose /usr/bin
+	x=1 cd -eu printf 'quoted text' "$1"
+local test $(pwd) test -eu 2>/dev/null
+		2>/dev/null | "$1" x=1 local ${HOME} test
+	echo export 'quoted text' grep export && "$1" x=1 sed done
+	cd awk local grep printf
+	${HOME} -eu readonly | && then "$1" then /usr/bin | x=1
+		"$@" "$@" "$1" export "$1" sed $(pwd) then "$1" --verbose
+local -eu "$1" | then 'quoted text' x=1 test "$1"
+-eu 2>/dev/null export 'quoted text'
+	printf sed "$@" readonly --verbose local local echo
+		/usr/bin -eu done local grep test grep "$1" echo $(pwd) cd --verbose
+"$@" local | then | grep export 'quoted text'
+sed -eu local 'quoted text' 2>/dev/null "$1" test echo
+"$@" /usr/bin then printf sed test local cd readonly
+		printf 2>/dev/null -eu cd x=1 readonly
+	test grep local --verbose $(pwd) | -eu local sed && grep && "$@" /usr/bin cd readonly
+		done $(pwd) cd "$@" readonly $(pwd) cd test "$@" export sed && 2>/dev/null $(pwd)
+		$(pwd) readonly awk x=1 export
+	test awk $(pwd) && $(pwd) "$1" test then then
+	echo "$1" printf test ${HOME} && --verbose local $(pwd) printf
+		&& 2>/dev/null --verbose local
+done echo --verbose | "$@" --verbose
+	'quoted text' grep cd then -eu local export x=1 "$1" 2>/dev/null ${HOME} echo
+	then $(pwd) -eu echo then -eu echo echo 2>/dev/null 'quoted text'
+		grep "$@" && x=1 2>/dev/null /usr/bin /usr/bin "$1" cd grep local sed $(pwd) printf
+		export awk $(pwd) readonly /usr/bin sed printf local printf x=1 --verbose && /usr/bin
+		$(pwd) 'quoted text' echo -eu local | then | then
+	grep printf grep $(pwd) printf printf then x=1 printf echo done echo
+	x=1 /usr/bin 2>/dev/null "$1" local then then && "$1" --verbose x=1 sed
+readonly /usr/bin echo -eu echo ${HOME} local cd export
+	export 'quoted text' x=1 echo echo printf test echo
+		sed printf | "$1" "$1" local local x=1 ${HOME} test
+		awk ${HOME} test 'quoted text' /usr/bin
+awk ${HOME} "$1" | | && test | echo x=1 readonly | ${HOME} && $(pwd) x=1 cd
+	test sed ${HOME} $(pwd) $(pwd) done "$@"
+	| "$1" -eu && awk local 2>/dev/null
+--verbose readonly $(pwd) -eu 'quoted text' echo test
+local then done sed done && ${HOME} 2>/dev/null
+		&& /usr/bin /usr/bin printf done /usr/bin && done readonly
+sed then --verbose --verbose done 2>/dev/null
+"$@" "$1" "$1" readonly 2>/dev/null /usr/bin | test
+then grep export done x=1 x=1 readonly export 'quoted text'
+		'quoted text' /usr/bin done echo "$@" 'quoted text' 'quoted text'
+		x=1 | printf x=1 cd x=1
+	local | | $(pwd) ${HOME} then awk export printf echo && -eu /usr/bin -eu
+	test /usr/bin 'quoted text' | local cd test sed readonly
+		'quoted text' sed grep | /usr/bin echo "$1" | done "$1" "$@" "$@"
+${HOME} "$1" cd "$1" test -eu cd x=1 --verbose ${HOME}
+sed local 2>/dev/null -eu --verbose
+-eu done -eu 'quoted text' x=1 /usr/bin grep --verbose echo ${HOME}
+		2>/dev/null --verbose printf ${HOME} local readonly cd grep
+	grep ${HOME} x=1 $(pwd) "$@" x=1 /usr/bin export export
+	'quoted text' ${HOME} 'quoted text' grep
+	'quoted text' grep "$@" | $(pwd) awk | --verbose test cd "$@" grep
+	x=1 printf done printf grep export
+		'quoted text' local printf --verbose 2>/dev/null then
+	${HOME} readonly echo /usr/bin export | export
+		'quoted text' export then && printf printf printf echo done test
+echo readonly $(pwd) && $(pwd) sed readonly && sed local $(pwd) cd 2>/dev/null
+		"$@" "$@" done then "$1" awk awk then echo /usr/bin sed grep --verbose
+	sed -eu then && grep x=1 readonly
+	&& && then /usr/bin "$@" "$@" awk 2>/dev/null
+${HOME} cd | sed then ${HOME} --verbose --verbose /usr/bin x=1 && grep
+readonly export /usr/bin 'quoted text' 'quoted text' ${HOME} cd done
+	"$1" ${HOME} printf -eu export sed grep --verbose 2>/dev/null
+x=1 awk test cd sed | | echo awk 2>/dev/null export && export done "$1" -eu
+done echo "$@" 'quoted text' x=1 -eu printf && -eu done then test
+		"$@" | echo && | test | "$1" $(pwd) done grep then 'quoted text' export
+	printf && 'quoted text' --verbose | ${HOME} sed echo ${HOME} --verbose 2>/dev/null
+		"$1" ${HOME} x=1 local grep done test --verbose && done printf "$1" "$1" -eu "$@"
+${HOME} | | | cd "$1" test $(pwd) test 'quoted text'
+	x=1 test grep sed /usr/bin test
+		&& $(pwd) 2>/dev/null 2>/dev/null
+local sed "$@" /usr/bin done "$@" export ${HOME} then echo echo 'quoted text'
+$(pwd) local test grep export -eu 2>/dev/null sed sed | $(pwd) 2>/dev/null
+	'quoted text' 2>/dev/null ${HOME} /usr/bin local
+test "$@" readonly 2>/dev/null test readonly cd ${HOME} cd | then | cd then
+	2>/dev/null sed x=1 x=1 && sed -eu done | cd readonly sed local echo
+	/usr/bin "$@" then "$1" "$1" --verbose 2>/dev/null
+cd 'quoted text' $(pwd) local export readonly grep then readonly echo 2>/dev/null
+	then --verbose awk | test | --verbose grep /usr/bin export grep
+export -eu printf cd echo && /usr/bin -eu --verbose export
+readonly $(pwd) readonly && ${HOME} | then /usr/bin x=1 "$@" export "$@" --verbose
+		done export echo printf local -eu | | | && 2>/dev/null "$@" then export 'quoted text'
+		sed then done "$1" readonly printf -eu sed
+"$1" | sed /usr/bin "$@" readonly readonly ${HOME} printf awk
+&& readonly "$1" readonly x=1 x=1 test readonly "$1" x=1 'quoted text' ${HOME}
+	cd printf | test awk /usr/bin 2>/dev/null --verbose sed "$@" x=1 'quoted text'
+/usr/bin && done | 'quoted text'
+		export "$1" /usr/bin echo cd printf local
+2>/dev/null export done
+/usr/bin grep awk cd $(pwd) sed ${HOME} /usr/bin export --verbose --verbose cd &&
+		&& grep /usr/bin local | awk awk
+	"$1" "$@" -eu $(pwd) $(pwd)
+	awk x=1 done -eu ${HOME} sed $(pwd) --verbose
+	awk local "$1" awk test && -eu echo x=1 | 2>/dev/null export 'quoted text' sed readonly
+2>/dev/null echo printf && -eu export then readonly test "$1" done
+echo 'quoted text' ${HOME}
+	/usr/bin | cd /usr/bin export ${HOME} -eu && readonly | test
+	2>/dev/null /usr/bin | grep local grep local --verbose
+	--verbose ${HOME} local /usr/bin test sed cd 2>/dev/null
+	"$1" "$@" test local readonly x=1 | 2>/dev/null 2>/dev/null 2>/dev/null
+		then grep "$1" done local local /usr/bin readonly --verbose export $(pwd)
+printf -eu $(pwd) done 'quoted text' "$@" then readonly
+		local "$1" printf -eu "$1" x=1 local then -eu echo -eu x=1 2>/dev/null
+		done test | grep $(pwd) && "$@" ${HOME} 'quoted text'
+		x=1 --verbose "$1" && $(pwd) readonly | 'quoted text' done done "$@" printf
+echo local x=1 grep test local && "$1" x=1 && x=1 -eu --verbose then local
+/usr/bin | /usr/bin sed test --verbose && awk "$@" then 'quoted text' | ${HOME}
+	printf awk readonly $(pwd) "$@" -eu then /usr/bin $(pwd) export ${HOME}
+sed x=1 x=1 "$1" grep 'quoted text' done -eu $(pwd) awk echo grep
+		export sed /usr/bin local export $(pwd) test then $(pwd) readonly "$1" |
+"$1" | awk then -eu echo local "$1" --verbose -eu local grep --verbose /usr/bin
+export "$1" "$1" test
+		&& printf test -eu "$@" "$1"
+-eu sed && /usr/bin "$@" cd /usr/bin 2>/dev/null 'quoted text' grep
+grep $(pwd) test ${HOME} awk local && 2>/dev/null test 'quoted text'
+$(pwd) "$@" "$@" /usr/bin then grep printf readonly export ${HOME} && then
+		| 2>/dev/null x=1 "$@" -eu echo -eu readonly readonly
+		then x=1 'quoted text' test readonly printf
+	local 2>/dev/null ${HOME} -eu 2>/dev/null sed echo grep && "$@" 2>/dev/null ${HOME}
+-eu readonly sed /usr/bin 'quoted text'
+export export printf --verbose done awk
+	grep sed printf awk printf ${HOME} readonly && x=1 local printf
+&& --verbose -eu printf printf then --verbose printf local awk "$@"
+echo | cd export | export && | 2>/dev/null --verbose --verbose x=1
+		test echo /usr/bin ${HOME} ${HOME} $(pwd) 2>/dev/null &&
+	x=1 sed x=1 cd local "$@" --verbose readonly -eu "$@" cd ${HOME} && cd
+then awk -eu readonly x=1
+	readonly then export --verbose done ${HOME}
+		grep test "$@" "$@" -eu test /usr/bin export -eu test 2>/dev/null $(pwd)
+cd "$1" --verbose "$@" "$@" "$1"
+		readonly 2>/dev/null /usr/bin
+		'quoted text' test && 'quoted text' readonly then | local 2>/dev/null x=1 local
+		cd "$@" -eu 2>/dev/null "$1" -eu awk then $(pwd) "$@" awk
+	export local test test export awk 'quoted text' local printf then -eu echo | cd
+$(pwd) /usr/bin 'quoted text' 2>/dev/null && "$1" echo sed $(pwd) printf "$@"
+	then $(pwd) $(pwd) export
+		&& "$1" | 2>/dev/null printf then --verbose
+		sed printf printf local test 'quoted text' test sed "$1" then echo -eu "$@" -eu
+	test -eu 2>/dev/null --verbose 'quoted text'
+		grep $(pwd) | echo -eu "$1"
+	-eu sed $(pwd) | then "$@" "$1" 2>/dev/null echo && echo $(pwd) grep "$@"
+then 2>/dev/null ${HOME} echo
+		&& then x=1 echo done sed
+		printf 2>/dev/null | then $(pwd) export $(pwd) grep echo awk cd then
+"$1" grep then printf printf done $(pwd) then 2>/dev/null awk then printf
+		test ${HOME} grep awk && "$1"
+		| sed sed "$1" done done /usr/bin --verbose && then 2>/dev/null
+/usr/bin $(pwd) test "$@" export 2>/dev/null local
+	&& awk ${HOME} test 2>/dev/null | --verbose local export grep 'quoted text'
+	2>/dev/null --verbose "$1" export /usr/bin sed echo -eu -eu x=1
+sed /usr/bin 2>/dev/null done
+then then /usr/bin /usr/bin done export 2>/dev/null
+	done printf readonly test printf then && /usr/bin 2>/dev/null local then local
+		"$@" then printf test test | cd /usr/bin
+		test x=1 | sed then -eu
+-eu "$@" cd test readonly local ${HOME}
+	"$@" sed grep export x=1 cd sed "$1"
+	echo export printf | local then | cd
+	&& test | grep "$@" cd -eu x=1 -eu 'quoted text' export then
+/usr/bin grep && sed
+		sed 2>/dev/null "$@" test echo /usr/bin
+	awk -eu done readonly "$@" "$@" 2>/dev/null test done echo --verbose then "$@"
+	cd printf awk grep done $(pwd) x=1
+	| -eu "$@" -eu "$1" readonly $(pwd) local x=1 sed
+	local awk "$1" "$@" test --verbose ${HOME}
+	--verbose && printf cd done "$@" --verbose readonly
+-eu /usr/bin x=1 awk | 'quoted text'
+'quoted text' echo 'quoted text' x=1 | export
+		&& readonly /usr/bin printf local ${HOME} && test $(pwd) ${HOME} 2>/dev/null
+done awk -eu "$@" echo
+		&& local done grep sed readonly 2>/dev/null grep "$1" printf
+		readonly sed grep echo -eu $(pwd) "$1" test readonly then
+readonly cd awk done /usr/bin done x=1 done cd cd $(pwd)
+grep export then ${HOME} sed /usr/bin
+	--verbose | done ${HOME} grep | ${HOME} then $(pwd)
+		${HOME} awk 'quoted text' 'quoted text'
+test test -eu ${HOME} local echo --verbose
+	export then && --verbose local sed /usr/bin "$1" && export $(pwd)
+	printf "$@" /usr/bin && && local | printf test printf
+		readonly test cd --verbose readonly test -eu awk -eu done awk readonly
+		sed ${HOME} "$1" readonly -eu 2>/dev/null grep test readonly
+x=1 awk test | cd 'quoted text' local readonly
+	awk local $(pwd) cd echo "$@" ${HOME} 'quoted text' -eu readonly cd
+	test echo done $(pwd) export
+	/usr/bin cd awk | "$1" --verbose 'quoted text' local
+	"$@" 2>/dev/null readonly
+		"$1" grep echo 'quoted text' local x=1 test then x=1
+		x=1 /usr/bin sed readonly -eu local test "$1" sed | awk export
+export test x=1 "$1" /usr/bin "$@" "$@" ${HOME}
+sed awk done "$@" grep ${HOME}
+		| 'quoted text' then
+$(pwd) sed && "$@" export echo /usr/bin cd && 2>/dev/null /usr/bin awk
+		sed 2>/dev/null then printf
+'quoted text' && awk cd echo local grep done export x=1 x=1 ${HOME} ${HOME}
+	echo "$1" grep 2>/dev/null x=1 x=1 && sed then echo
+	test readonly -eu ${HOME} /usr/bin "$@" test grep readonly $(pwd)
+2>/dev/null sed local cd awk --verbose local -eu x=1
+		"$@" echo done /usr/bin -eu "$1" x=1 test local && | grep printf
+		grep /usr/bin | test ${HOME} grep $(pwd) "$1" export $(pwd) awk x=1 'quoted text'
+	test $(pwd) $(pwd) then x=1 test cd && "$@" export
+| test export awk | done --verbose
+"$@" echo sed "$@" readonly then "$@"
+sed echo readonly x=1 done awk ${HOME} ${HOME} then
+		x=1 -eu export -eu ${HOME} grep printf ${HOME} grep readonly then "$@" then
+	&& "$1" "$@" --verbose ${HOME} "$1" /usr/bin readonly grep --verbose
+		grep && x=1 ${HOME} readonly awk awk
+	readonly awk "$@" 2>/dev/null --verbose test
+"$@" readonly 'quoted text' printf 'quoted text' -eu 2>/dev/null
+	--verbose done then && /usr/bin test awk printf "$@" done printf cd && "$@"
+		readonly echo && --verbose awk test awk sed 2>/dev/null x=1 && export
+/usr/bin test then ${HOME} /usr/bin -eu "$1" then grep x=1 -eu echo then
+"$1" 2>/dev/null sed 'quoted text'
+--verbose then local local printf export local printf
+	done readonly then test ${HOME} -eu x=1 $(pwd) -eu printf sed grep
+		x=1 ${HOME} grep /usr/bin done printf echo | awk sed
+then -eu local printf cd | local printf "$1" done export
+| done 2>/dev/null then test
+		sed 2>/dev/null done printf "$@"
+	${HOME} | 2>/dev/null grep
+cd && $(pwd) echo then && "$1" $(pwd) test | awk "$@" printf grep
+sed 'quoted text' ${HOME} echo
+done | awk x=1 $(pwd) then -eu "$@" 'quoted text'
+	| awk 'quoted text' sed
+	/usr/bin 'quoted text' sed readonly awk 2>/dev/null
+'quoted text' grep local done "$@" 'quoted text'
+sed $(pwd) cd --verbose local
+	readonly awk cd sed local test readonly grep ${HOME}
+readonly ${HOME} awk x=1 2>/dev/null cd --verbose
+readonly done 2>/dev/null -eu --verbose "$1" grep && sed 2>/dev/null
+x=1 /usr/bin then -eu printf "$1" $(pwd) grep printf --verbose sed 'quoted text'
+	/usr/bin $(pwd) export printf --verbose sed done x=1 export "$@" test -eu --verbose
+echo 2>/dev/null $(pwd) "$@" -eu $(pwd) --verbose
+		then "$1" export printf x=1
+	test 'quoted text' && | then then awk done test done --verbose
+export then grep && /usr/bin "$1" awk local local --verbose
+| sed "$1" readonly ${HOME} test readonly "$1" x=1 export cd $(pwd) --verbose sed
+	echo -eu ${HOME} then export grep cd 2>/dev/null $(pwd) "$1" export x=1
+2>/dev/null 2>/dev/null grep readonly "$1"
+"$1" /usr/bin "$@" "$1" "$@" local "$@" cd && "$@" 'quoted text' printf cd
+then export done 2>/dev/null printf /usr/bin local && /usr/bin | done local
+test && "$1" local export then "$1" printf "$1" && sed "$@" done "$@"
+	--verbose awk && 2>/dev/null | printf -eu $(pwd)
+		sed && /usr/bin | /usr/bin ${HOME}
+		local ${HOME} $(pwd) && then test $(pwd) x=1 -eu && then "$1" printf
+		readonly printf $(pwd) printf done sed -eu 'quoted text' x=1 "$1" done "$1" printf
+	done --verbose 'quoted text' | x=1 then /usr/bin
+	cd test ${HOME} test --verbose "$@" | x=1 awk export
+grep cd $(pwd) done readonly export "$1" x=1 "$1" -eu test
+		cd -eu echo 'quoted text' 'quoted text' && 2>/dev/null printf cd local awk
+/usr/bin x=1 echo awk then 'quoted text'
+"$1" x=1 done local printf
+echo "$1" ${HOME} --verbose export awk echo
+| 2>/dev/null ${HOME} sed sed 2>/dev/null printf test x=1 "$1" 2>/dev/null
+x=1 'quoted text' then test -eu local "$@" echo sed
+export export local ${HOME} "$@" $(pwd)
+/usr/bin readonly | | readonly --verbose done sed
+	echo --verbose $(pwd) && 2>/dev/null
+done 2>/dev/null --verbose --verbose ${HOME} then
+cd 2>/dev/null echo awk test cd "$1" "$@" --verbose awk x=1 /usr/bin
+	awk --verbose ${HOME} local then $(pwd) local local printf
+| "$1" $(pwd) then readonly
+$(pwd) --verbose cd "$@" 2>/dev/null cd test x=1 x=1
+	${HOME} x=1 x=1 then test ${HOME} 'quoted text'
+	readonly ${HOME} --verbose grep awk ${HOME} --verbose local
+		&& cd done then local done ${HOME} local awk
+export test awk done "$1" | /usr/bin
+		test readonly | -eu export "$1" sed
+		"$1" local -eu /usr/bin printf /usr/bin done readonly
+readonly x=1 sed local /usr/bin && 'quoted text' printf export "$@" 'quoted text'
+		grep $(pwd) ${HOME} grep done local "$1"
+local -eu export then echo done export
+		--verbose then printf awk /usr/bin export local sed test awk grep cd ${HOME}
+/usr/bin x=1 grep printf export then grep "$1" 'quoted text' local
+		sed export printf readonly 2>/dev/null echo 'quoted text' sed echo cd awk &&
+		--verbose sed 'quoted text'
+		export 2>/dev/null echo 'quoted text' local | grep 'quoted text' grep 'quoted text'
+grep 'quoted text' | /usr/bin -eu export export awk export readonly sed local
+		x=1 cd then test && cd test export x=1
+$(pwd) export /usr/bin
+grep x=1 grep grep echo local echo -eu x=1 awk cd grep "$@" done readonly
+	&& $(pwd) -eu grep then export export sed printf
+--verbose then -eu 2>/dev/null awk local x=1 sed test sed readonly
+/usr/bin echo $(pwd) $(pwd) sed local 2>/dev/null | 'quoted text' cd --verbose
+	awk && local $(pwd) then $(pwd) cd && readonly cd done
+	grep then ${HOME} ${HOME} "$1" $(pwd) 'quoted text'
+		echo | && "$1" export cd ${HOME} "$1" local sed sed "$1" test
+		cd -eu echo | "$1" x=1 | && -eu "$1" printf awk 'quoted text' $(pwd) done
+		"$1" test done done && grep 2>/dev/null
+"$1" grep sed grep printf test test && 'quoted text'
+		-eu -eu x=1 grep $(pwd) $(pwd) && 2>/dev/null cd awk
+sed /usr/bin printf -eu ${HOME} "$1" $(pwd) $(pwd) --verbose | echo echo printf
+/usr/bin $(pwd) -eu export 'quoted text' local ${HOME} /usr/bin -eu 2>/dev/null
+	--verbose && grep cd awk "$1"
+	readonly x=1 readonly done cd 2>/dev/null echo | && echo $(pwd)
+done export 2>/dev/null "$1" -eu then $(pwd) sed /usr/bin $(pwd) then awk test awk
+then "$1" | "$@" "$@" "$@" sed grep "$1" done
+		sed "$@" 'quoted text' sed "$@" x=1 'quoted text'
+export cd export -eu ${HOME} /usr/bin /usr/bin
+	awk "$@" 'quoted text' test x=1 "$1" |
+then ${HOME} -eu readonly 'quoted text' echo 'quoted text' test | --verbose
+	done "$1" done printf "$1" -eu then | export x=1 grep 'quoted text' --verbose
+	printf sed 2>/dev/null && "$1" echo $(pwd) -eu cd readonly grep awk x=1 grep
+		local test printf then --verbose
+		grep | done x=1 export
+		/usr/bin "$@" "$1" /usr/bin -eu
+	| --verbose | done | done -eu then /usr/bin echo printf "$@"
+	printf sed /usr/bin cd && export && $(pwd) local then local ${HOME} x=1 -eu
+	"$1" readonly && | readonly printf $(pwd) test "$@" ${HOME} awk readonly
+	${HOME} test then 'quoted text' readonly ${HOME} 2>/dev/null
+&& /usr/bin -eu printf readonly
+	readonly sed printf -eu x=1 --verbose
+cd 2>/dev/null sed && && test local grep then $(pwd) cd && | awk grep | test echo
+| printf "$@" && -eu ${HOME} sed 2>/dev/null done "$@" 'quoted text'
+${HOME} readonly && then echo 'quoted text' sed
+		sed test export ${HOME} && sed
+		test local 'quoted text' "$@" cd "$1" /usr/bin -eu local
+"$1" cd done grep | 'quoted text' test then
+		${HOME} done ${HOME} echo
+echo ${HOME} "$1" $(pwd) /usr/bin echo cd done done 2>/dev/null
+"$@" x=1 "$@" && then x=1 sed x=1 test test echo
+		--verbose x=1 2>/dev/null "$@" "$1" 'quoted text' readonly $(pwd)
+	$(pwd) printf -eu echo ${HOME}
+cd readonly grep --verbose cd -eu --verbose --verbose
+| done then export test sed echo -eu grep ${HOME} ${HOME} then "$@" ${HOME}
+		local && /usr/bin | done /usr/bin grep "$1" printf 'quoted text' -eu
+$(pwd) export x=1 echo /usr/bin
+	/usr/bin "$1" /usr/bin
+		sed $(pwd) readonly /usr/bin --verbose --verbose readonly done
+sed "$1" echo "$1" x=1 printf then /usr/bin "$1"
+		&& done /usr/bin -eu 'quoted text' cd x=1 printf x=1 export readonly readonly done
+done sed x=1 readonly
+/usr/bin ${HOME} cd test --verbose &&
+		local then $(pwd) echo
+/usr/bin x=1 done 'quoted text' then cd "$1" readonly cd "$@" | --verbose
+	2>/dev/null --verbose local "$1" 2>/dev/null 'quoted text' awk then $(pwd)
+	echo echo x=1 --verbose /usr/bin ${HOME}
+$(pwd) sed "$@" --verbose echo
+		${HOME} sed done 2>/dev/null done cd
+	echo grep --verbose "$1" "$@" --verbose grep $(pwd) && cd "$1" then grep
+	sed grep -eu awk $(pwd) then done
+	local /usr/bin readonly cd readonly | $(pwd) grep awk
+-eu 'quoted text' 'quoted text' /usr/bin awk ${HOME}
+		| ${HOME} local "$1" 2>/dev/null then done && then printf readonly -eu
+		cd test "$@" 2>/dev/null ${HOME} --verbose export printf "$1"
+"$1" local awk local && cd --verbose then x=1 x=1
+export | then | /usr/bin
+	'quoted text' readonly -eu cd local 'quoted text'
+	cd readonly done "$1" "$1" done -eu done $(pwd) "$@" -eu ${HOME}
+		local /usr/bin export awk 2>/dev/null
+	awk printf printf printf ${HOME} printf
+	test /usr/bin readonly awk echo
+	sed "$@" ${HOME} awk "$1" $(pwd) $(pwd) awk --verbose readonly
+echo local "$1" then sed && sed grep 2>/dev/null sed x=1 local
+		"$@" export ${HOME} &&
+		printf cd 2>/dev/null &&
+	--verbose test --verbose echo grep echo done 2>/dev/null 'quoted text' &&
+	-eu sed $(pwd) $(pwd) 'quoted text' then then done --verbose
+then 2>/dev/null then readonly
+	cd readonly $(pwd) then then cd cd 'quoted text'
+	/usr/bin /usr/bin then echo export local x=1 && && --verbose grep 2>/dev/null
+	2>/dev/null echo x=1 done | readonly ${HOME} --verbose "$@" "$1"
+	x=1 | "$@" test -eu x=1 cd
+"$@" ${HOME} local done cd cd 2>/dev/null readonly ${HOME} done echo
+	"$1" -eu /usr/bin "$@" $(pwd) export test "$@" grep
+grep /usr/bin "$@" "$1" test | /usr/bin printf $(pwd) ${HOME}
+2>/dev/null -eu && then
+		${HOME} readonly then --verbose local readonly done grep "$@" export export echo
+		--verbose -eu --verbose
+		awk "$@" readonly sed then grep test grep -eu | cd && "$1" 2>/dev/null done
+	then echo test 2>/dev/null "$@" 'quoted text' done && done done cd then
+	-eu ${HOME} printf echo
+		sed printf local --verbose $(pwd)
+sed export 2>/dev/null cd -eu ${HOME} ${HOME} done readonly sed readonly readonly
+		-eu -eu export | | grep done printf
+'quoted text' test /usr/bin echo "$@" test /usr/bin 'quoted text'
+		awk "$@" "$@" local "$@" /usr/bin | test | 2>/dev/null echo awk
+		echo x=1 /usr/bin $(pwd) awk -eu $(pwd) ${HOME} /usr/bin done
+		"$1" x=1 "$1" --verbose grep | "$1" --verbose readonly /usr/bin sed
+	"$1" done x=1 2>/dev/null local printf 'quoted text' test /usr/bin /usr/bin
+	export $(pwd) | test "$@"
+local /usr/bin | sed
+	grep export -eu awk awk && local "$1" "$1" -eu local
+		${HOME} export "$@" then cd printf awk done done sed &&
+		'quoted text' export ${HOME} done | awk -eu printf
+		local grep printf readonly done 2>/dev/null
+		/usr/bin "$@" cd grep && --verbose export
+-eu 2>/dev/null sed local cd then then
+		| printf done -eu | then then done "$@" -eu
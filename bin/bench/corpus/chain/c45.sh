@@ -0,0 +1,2001 @@
+| "$@" export 'quoted text' test export $(pwd)
+		test ${HOME} local test grep echo then /usr/bin ${HOME} export $(pwd) export |
+	-eu echo cd export cd x=1 local local readonly 2>/dev/null -eu export
+2>/dev/null readonly done echo ${HOME}
+	echo cd then echo -eu 2>/dev/null
+	grep awk "$1" | "$@" readonly done test | /usr/bin && -eu "$@" -eu 2>/dev/null
+readonly "$@" printf export 2>/dev/null export --verbose local $(pwd)
+	| echo cd /usr/bin $(pwd) -eu
+		| grep grep done awk && sed "$1" && --verbose echo "$1" && test
+	readonly local grep export echo
+		test ${HOME} | export | local export then 'quoted text'
+		printf printf local -eu "$@" 2>/dev/null
+	done "$@" "$@" --verbose && export echo
+		awk then grep 'quoted text' test 'quoted text' sed done then $(pwd) then sed
+		local awk printf ${HOME} printf $(pwd) grep echo sed
+		"$@" then then export ${HOME} 2>/dev/null then "$1" then $(pwd)
+done "$@" readonly 'quoted text' echo done $(pwd)
+--verbose done -eu && then && /usr/bin -eu && grep -eu
+echo readonly | echo -eu done sed grep 'quoted text' x=1 local
+	then && then cd grep /usr/bin local x=1 done grep -eu then echo sed
+cd cd local ${HOME} then echo && awk readonly --verbose
+echo /usr/bin grep && --verbose
+x=1 echo done done "$@" grep local local then test $(pwd) -eu done 2>/dev/null
+| then done cd "$1" cd local grep readonly cd x=1 'quoted text'
+		--verbose export grep
+		done "$1" done /usr/bin && grep $(pwd) x=1 'quoted text' ${HOME}
+	local echo ${HOME} done awk awk awk "$@" sed grep done
+done grep /usr/bin ${HOME} ${HOME}
+		&& ${HOME} test "$@" export 'quoted text' /usr/bin && $(pwd)
+		"$1" export --verbose export 'quoted text'
+	awk 'quoted text' test x=1 local test printf test
+		"$1" export ${HOME} $(pwd) done then && $(pwd) $(pwd)
+		${HOME} done done x=1 printf
+		'quoted text' x=1 $(pwd) && 2>/dev/null ${HOME} done sed
+	&& cd then sed && "$1" -eu $(pwd)
+		echo test sed printf --verbose readonly test "$1" printf export
+		| export --verbose printf 2>/dev/null $(pwd) echo cd cd echo export cd export
+	readonly awk ${HOME} x=1
+--verbose export cd $(pwd) 2>/dev/null echo local export
+	/usr/bin export "$1" 'quoted text' cd 'quoted text' x=1 && grep
+		"$@" test awk export && | readonly test grep -eu
+		"$@" $(pwd) -eu ${HOME} x=1 sed readonly | && "$@"
+	grep --verbose export "$@" sed then && then --verbose "$@" sed test $(pwd)
+		grep | sed sed done local cd local $(pwd) 2>/dev/null grep 2>/dev/null
+sed --verbose ${HOME} "$@" --verbose awk cd "$@" | sed x=1 awk
+$(pwd) printf test printf x=1 'quoted text' export readonly | export awk |
+		"$1" -eu local sed $(pwd) export grep grep ${HOME} cd readonly grep "$1" done --verbose
+	2>/dev/null 2>/dev/null done echo --verbose $(pwd)
+/usr/bin && printf echo "$@" awk readonly 2>/dev/null awk &&
+	test grep | ${HOME} "$1" && then -eu ${HOME} 2>/dev/null grep
+then | | test 2>/dev/null | echo awk ${HOME} "$@" local export
+echo done -eu | cd "$@" 2>/dev/null 2>/dev/null
+	grep "$1" done | done /usr/bin -eu local sed readonly
+		$(pwd) cd readonly readonly awk "$1" grep "$1" awk && test export printf done local
+		test /usr/bin local done local 2>/dev/null 'quoted text' "$@"
+cd readonly "$@" awk test cd $(pwd) "$1" 2>/dev/null 'quoted text'
+		then 2>/dev/null sed x=1 local "$@"
+echo | --verbose readonly printf sed x=1 ${HOME} ${HOME} awk export test 2>/dev/null
+		| cd $(pwd) echo "$@" grep cd 2>/dev/null echo
+'quoted text' 'quoted text' export
+	| test x=1 ${HOME} local local && test printf $(pwd) /usr/bin awk echo
+		2>/dev/null then grep printf echo export local grep x=1 local x=1 --verbose
+		export "$1" $(pwd) cd --verbose done $(pwd) $(pwd) "$1"
+local readonly $(pwd) readonly --verbose | export export printf ${HOME} sed
+		--verbose sed readonly "$@" export && grep sed then 'quoted text' printf echo
+	'quoted text' | grep local
+	test --verbose then readonly /usr/bin test cd test /usr/bin x=1 "$1" cd
+	grep echo 'quoted text' /usr/bin -eu done "$@" &&
+	| printf grep echo | sed sed ${HOME} | -eu sed /usr/bin
+		awk echo export awk 'quoted text' export && printf
+		done readonly awk 'quoted text' readonly "$1" 2>/dev/null done
+	x=1 done -eu && then | printf sed "$1" &&
+	${HOME} awk -eu local 'quoted text' --verbose sed
+awk $(pwd) grep done export 'quoted text' awk export then awk
+${HOME} ${HOME} -eu export -eu grep
+	awk test 2>/dev/null awk $(pwd) -eu ${HOME} grep echo test sed
+printf then "$1" /usr/bin echo | /usr/bin
+local export 2>/dev/null awk "$1" $(pwd) then --verbose
+		-eu -eu local 'quoted text' done echo awk
+awk awk 2>/dev/null done printf printf test | ${HOME} cd
+	grep 2>/dev/null && done "$@" 'quoted text'
+		${HOME} grep "$1" 'quoted text' /usr/bin export
+	"$1" | then $(pwd) "$1" readonly /usr/bin "$1" test --verbose local /usr/bin cd
+		$(pwd) sed | cd done awk test -eu && $(pwd) export x=1 "$@" /usr/bin grep /usr/bin
+	&& readonly test cd export "$1" sed
+	${HOME} cd | grep 'quoted text' "$@"
+	'quoted text' echo "$1" ${HOME} x=1 "$@" 'quoted text' test "$1"
+cd test /usr/bin done x=1 echo | awk grep $(pwd) --verbose
+	x=1 echo grep --verbose test readonly 2>/dev/null
+sed ${HOME} && && sed "$@" 'quoted text'
+	then then ${HOME} printf sed $(pwd) -eu
+	$(pwd) -eu x=1 /usr/bin local
+/usr/bin test local cd local $(pwd) | "$@" x=1 | | "$@" 2>/dev/null
+	done x=1 grep echo sed sed echo "$1" test x=1
+-eu --verbose then /usr/bin /usr/bin sed /usr/bin
+	${HOME} then | sed "$@" ${HOME} x=1 then --verbose sed /usr/bin
+	"$@" ${HOME} done x=1 done awk done printf cd test cd sed echo
+	readonly test ${HOME} then readonly
+	awk readonly export "$1" sed done test export
+$(pwd) /usr/bin /usr/bin 2>/dev/null
+	sed echo done then 'quoted text' ${HOME} sed cd
+grep /usr/bin ${HOME} 'quoted text' && $(pwd) test
+	readonly then -eu printf ${HOME} ${HOME} then "$@" echo $(pwd) local echo
+'quoted text' -eu echo
+	${HOME} then done "$@" echo grep x=1 cd 2>/dev/null printf grep | test
+grep readonly ${HOME} cd -eu $(pwd) ${HOME} $(pwd) printf done --verbose
+		printf -eu | echo --verbose "$@" 2>/dev/null local then
+x=1 x=1 ${HOME} grep printf "$@" echo x=1
+	/usr/bin 'quoted text' done -eu
+readonly "$1" then ${HOME} grep x=1 test echo
+		| then 2>/dev/null local sed "$1" "$1" /usr/bin -eu --verbose $(pwd)
+	"$1" $(pwd) "$@" readonly "$@" grep "$1" printf echo -eu readonly grep 2>/dev/null
+'quoted text' printf -eu echo -eu
+	| printf 2>/dev/null sed | && 2>/dev/null /usr/bin cd -eu test && $(pwd) -eu
+		${HOME} | ${HOME} x=1 cd 'quoted text' grep then echo local "$1" --verbose
+-eu local "$@" && sed printf awk
+	cd export "$1" && /usr/bin 'quoted text' ${HOME} grep
+${HOME} sed ${HOME} test "$@" cd 'quoted text' grep local awk awk "$1" "$1"
+/usr/bin x=1 then x=1 grep cd export readonly local "$@"
+		--verbose grep && && done echo readonly $(pwd) printf
+	awk x=1 grep sed /usr/bin -eu then 2>/dev/null && ${HOME} -eu | printf
+		printf local done | readonly
+		sed ${HOME} awk x=1 cd /usr/bin "$@" local echo test -eu /usr/bin
+'quoted text' | done "$@" "$1"
+		awk sed readonly readonly ${HOME} printf 'quoted text' local test | &&
+awk then ${HOME} | --verbose awk $(pwd) readonly echo 'quoted text' | grep &&
+	test local awk done ${HOME} x=1 && awk --verbose
+printf | grep sed grep -eu done ${HOME} echo "$@" -eu ${HOME}
+		${HOME} "$@" --verbose readonly then $(pwd) /usr/bin readonly
+		/usr/bin "$1" 2>/dev/null "$1" grep x=1 2>/dev/null "$@" 2>/dev/null
+	x=1 sed grep readonly cd
+	local "$1" then test then --verbose export -eu "$@" printf local
+		x=1 cd && ${HOME} "$@" test $(pwd) 'quoted text'
+		${HOME} --verbose sed | 'quoted text' /usr/bin -eu
+printf /usr/bin test -eu test ${HOME} test x=1 "$1" done $(pwd) 'quoted text'
+	-eu "$1" 'quoted text' ${HOME} x=1 done grep -eu cd "$@"
+		&& ${HOME} /usr/bin local x=1 --verbose --verbose -eu readonly
+	&& && $(pwd) && sed local local -eu done
+	cd awk then test echo then awk
+"$@" readonly $(pwd) -eu grep ${HOME} echo 'quoted text' /usr/bin
+		then | -eu readonly 'quoted text'
+		${HOME} --verbose then /usr/bin awk ${HOME} awk cd
+	local | -eu printf printf --verbose readonly sed sed
+2>/dev/null "$1" && "$1" grep
+		printf grep 'quoted text' /usr/bin -eu |
+		$(pwd) --verbose readonly $(pwd)
+		export && "$1" "$@" then done then -eu printf done "$1" "$@"
+	$(pwd) awk 'quoted text' | local done 'quoted text'
+		--verbose done cd | -eu readonly
+echo | awk --verbose &&
+done "$1" readonly readonly /usr/bin
+		export 2>/dev/null | ${HOME} -eu then
+	awk printf echo "$@" && && grep x=1 grep /usr/bin local -eu
+		&& printf --verbose export printf x=1 export printf
+		'quoted text' ${HOME} "$1" printf echo | -eu done /usr/bin "$@" cd export cd
+		cd --verbose readonly -eu 'quoted text'
+| x=1 /usr/bin printf awk &&
+	--verbose printf readonly "$@"
+		done export x=1 printf export ${HOME} 'quoted text' printf /usr/bin printf ${HOME}
+	grep export awk | --verbose
+	cd test then && then done echo local $(pwd)
+	printf $(pwd) -eu | export
+		echo awk 'quoted text' then
+${HOME} /usr/bin cd grep 2>/dev/null sed $(pwd) "$@"
+		| x=1 grep grep readonly done printf echo echo x=1 && grep done done cd done
+	"$@" /usr/bin cd --verbose | $(pwd) cd "$1" done test "$1" echo awk printf
+	cd | $(pwd) && test x=1 done then
+awk 2>/dev/null local cd cd local grep cd
+	cd | sed /usr/bin -eu printf --verbose awk -eu test readonly ${HOME}
+${HOME} 'quoted text' "$1" sed cd printf ${HOME} /usr/bin readonly
+/usr/bin | awk printf then done test
+	then 2>/dev/null readonly printf cd cd | 2>/dev/null
+		readonly --verbose then awk grep grep grep readonly grep x=1 cd awk test
+	then export --verbose printf ${HOME}
+	"$1" done printf done
+	export local | sed sed local $(pwd) test local /usr/bin /usr/bin
+	grep ${HOME} 'quoted text' /usr/bin cd cd printf "$@"
+		then then -eu "$@" "$@" grep awk echo "$@"
+		sed done readonly -eu -eu x=1 && x=1 done grep done
+		| echo ${HOME} cd 2>/dev/null grep && printf then export --verbose -eu awk | test
+		cd "$@" grep cd done 2>/dev/null echo printf "$1" test 2>/dev/null
+		sed sed && done sed awk export
+readonly 2>/dev/null local echo awk "$@" done $(pwd) && /usr/bin
+awk "$1" 'quoted text' printf 2>/dev/null readonly echo local then
+		sed "$1" $(pwd) done ${HOME} echo
+	${HOME} | echo --verbose 'quoted text'
+		"$@" 'quoted text' grep "$@" grep 2>/dev/null printf | --verbose x=1 2>/dev/null
+readonly | echo x=1 local test printf /usr/bin --verbose ${HOME} done
+sed /usr/bin echo done /usr/bin export export ${HOME}
+		done sed x=1 "$@" awk -eu | "$@" echo echo printf
+	&& 'quoted text' ${HOME} ${HOME}
+${HOME} && 'quoted text' -eu cd | 2>/dev/null
+		| -eu --verbose 'quoted text' printf export && then
+2>/dev/null test sed cd | --verbose echo readonly 'quoted text' echo "$1"
+	then 'quoted text' ${HOME} awk
+		&& ${HOME} readonly then | grep cd $(pwd) "$@" sed export "$@" grep && cd
+	${HOME} echo $(pwd) echo "$1" /usr/bin ${HOME} export awk export then 2>/dev/null
+	awk local test 2>/dev/null
+		local echo | "$@" "$@"
+	awk "$@" ${HOME} sed then /usr/bin grep printf test echo test "$1"
+	'quoted text' sed 'quoted text'
+${HOME} done grep $(pwd) /usr/bin done export /usr/bin then sed
+		grep 'quoted text' grep awk cd $(pwd)
+"$@" grep readonly x=1 echo /usr/bin
+${HOME} x=1 --verbose --verbose -eu | --verbose awk cd /usr/bin grep echo
+	"$1" x=1 sed grep printf test local sed readonly grep then "$@" "$@"
+	awk awk cd export local local /usr/bin cd ${HOME}
+	test -eu echo done | $(pwd) export done local
+		cd 2>/dev/null sed --verbose "$@" "$1" 2>/dev/null "$1" $(pwd) cd then | 'quoted text'
+		local x=1 printf test sed printf "$1" awk sed sed /usr/bin --verbose cd $(pwd)
+		-eu ${HOME} printf echo | /usr/bin 2>/dev/null grep
+		"$1" sed $(pwd) x=1 readonly readonly test echo x=1 printf export
+		2>/dev/null 'quoted text' grep -eu grep
+		test awk --verbose $(pwd) test
+	cd grep | /usr/bin | /usr/bin local printf sed x=1 "$@" $(pwd) test -eu --verbose
+	/usr/bin "$1" "$1" 2>/dev/null printf 'quoted text'
+grep cd local /usr/bin
+		test export awk local grep
+grep awk local "$@" local --verbose grep /usr/bin "$@" readonly /usr/bin grep
+	| --verbose && "$@" echo
+	printf export cd grep "$1" done -eu
+	grep "$@" && ${HOME} grep x=1 -eu $(pwd) -eu local cd 'quoted text' printf
+export export printf done --verbose done export
+	'quoted text' printf /usr/bin
+export local sed $(pwd) local x=1 "$@"
+		/usr/bin export $(pwd) --verbose export sed && grep cd done
+	"$@" test --verbose export
+2>/dev/null cd printf 2>/dev/null done
+		sed 2>/dev/null --verbose done && | "$1" cd 'quoted text'
+		printf sed awk 2>/dev/null awk grep echo 2>/dev/null -eu local -eu $(pwd)
+test $(pwd) readonly x=1
+		cd awk cd readonly awk
+		$(pwd) -eu printf sed --verbose grep --verbose | sed 2>/dev/null && awk test
+		--verbose -eu test | 2>/dev/null && readonly echo "$@" export 2>/dev/null sed
+&& -eu cd /usr/bin 'quoted text' --verbose 'quoted text' "$1" --verbose
+${HOME} && 'quoted text' x=1 test && then export grep "$@" x=1 then done "$@"
+		$(pwd) ${HOME} -eu local test export cd 2>/dev/null $(pwd)
+	-eu $(pwd) -eu /usr/bin printf
+		grep "$1" test "$@" --verbose /usr/bin grep "$@" local
+echo readonly printf "$1" ${HOME} 2>/dev/null echo local | then "$@" echo
+	done | echo export done sed local test
+		awk local x=1 x=1 "$1" export
+	"$@" --verbose sed cd "$@" ${HOME} awk | test x=1 /usr/bin then sed
+sed x=1 "$@" test export "$@" grep sed -eu
+	--verbose grep done echo local test --verbose /usr/bin ${HOME} done awk
+sed echo export grep | grep grep ${HOME} cd x=1 grep done awk | "$@" 2>/dev/null
+&& test test done grep cd cd --verbose then
+x=1 "$1" 2>/dev/null x=1 then then done
+		$(pwd) "$1" echo cd readonly
+	2>/dev/null then && test 2>/dev/null ${HOME} readonly 'quoted text' &&
+		awk "$1" then "$1" "$@" x=1 local cd x=1 echo sed local readonly
+"$@" && grep export cd readonly
+	local && export -eu local sed done then 'quoted text' 2>/dev/null printf
+	sed "$1" readonly "$@" -eu /usr/bin export --verbose echo "$@" --verbose
+		/usr/bin then && sed done done printf local sed readonly /usr/bin
+	"$@" done /usr/bin ${HOME} grep
+		/usr/bin $(pwd) export echo then
+	"$1" $(pwd) grep | awk awk -eu
+	${HOME} -eu | local then 'quoted text'
+		grep x=1 /usr/bin then test awk printf "$@" -eu sed awk "$1" awk
+		'quoted text' printf x=1 then && awk awk "$@" grep x=1 "$@" readonly
+		readonly -eu then $(pwd) -eu
+		| done ${HOME} /usr/bin && done "$1" "$1" sed export echo done printf
+		&& export cd --verbose sed cd done awk grep --verbose 'quoted text'
+--verbose grep $(pwd) then
+sed | awk && && test /usr/bin
+$(pwd) then echo | sed -eu "$@"
+	'quoted text' && sed
+		then sed done 'quoted text' x=1 echo export grep "$1" "$@" awk 2>/dev/null
+		local printf awk "$1" export -eu "$@" ${HOME} grep echo sed
+		test awk "$@" ${HOME} /usr/bin awk | done
+		${HOME} x=1 --verbose -eu "$1" test local "$@" awk then && 'quoted text'
+done x=1 && 'quoted text' awk -eu local "$1" -eu --verbose
+	| export local x=1 sed readonly then 'quoted text' $(pwd) ${HOME}
+		printf "$@" --verbose test "$1" -eu test test
+		export /usr/bin echo test /usr/bin 2>/dev/null local | $(pwd) /usr/bin
+x=1 export done grep echo local "$@" test 'quoted text' -eu
+	echo -eu export cd 'quoted text' awk printf | --verbose "$@" x=1 2>/dev/null
+		/usr/bin sed "$1" printf local
+&& -eu cd echo grep "$@" 'quoted text' x=1 cd then test -eu echo && | /usr/bin
+	echo sed "$@" sed && && | 2>/dev/null -eu grep
+"$1" --verbose -eu then && grep && "$1" 'quoted text'
+sed grep then local /usr/bin
+	"$1" /usr/bin echo cd readonly done sed cd then export local export done x=1
+		export 'quoted text' 'quoted text' $(pwd) -eu | ${HOME} $(pwd)
+| sed -eu $(pwd) sed
+	"$@" local export /usr/bin ${HOME} test test /usr/bin
+cd ${HOME} 'quoted text' ${HOME} sed cd ${HOME} then --verbose
+awk | cd export then printf echo --verbose "$1" done test grep awk cd $(pwd)
+printf 'quoted text' readonly local awk "$1" 'quoted text' x=1
+	then awk /usr/bin x=1
+local printf 2>/dev/null done export
+		--verbose "$1" 2>/dev/null grep grep awk 'quoted text' export 'quoted text'
+printf -eu printf --verbose printf test cd --verbose 2>/dev/null
+	then x=1 then "$1" "$1" test
+"$@" cd printf done printf -eu sed &&
+		grep grep && 2>/dev/null cd ${HOME} --verbose grep /usr/bin x=1
+	sed --verbose /usr/bin --verbose
+		sed done awk "$@" "$1" test ${HOME} grep 'quoted text' |
+	$(pwd) test --verbose sed && && local
+		then ${HOME} then done /usr/bin
+		"$1" 'quoted text' --verbose /usr/bin /usr/bin "$1" then "$1" echo
+		readonly && -eu 'quoted text' "$1" 2>/dev/null echo $(pwd) local
+sed done echo && "$1" --verbose export /usr/bin $(pwd) "$@" echo x=1 x=1
+--verbose done ${HOME} done | | export 2>/dev/null --verbose
+		cd awk x=1 /usr/bin 'quoted text' then x=1 "$1" done export | "$@" echo
+	printf -eu awk done then
+sed 2>/dev/null export local echo
+		echo export test printf then "$1" sed readonly $(pwd) |
+grep 2>/dev/null --verbose ${HOME} local
+	echo sed awk then done -eu --verbose awk echo awk test readonly
+		-eu then printf "$@" x=1
+		cd echo sed x=1 readonly 2>/dev/null ${HOME} $(pwd) done ${HOME} local && /usr/bin
+		grep local 2>/dev/null $(pwd) x=1
+		--verbose | --verbose "$@" && grep then local "$@"
+local "$1" | "$@" export
+	-eu then echo echo /usr/bin grep "$@"
+&& echo local "$@" echo 2>/dev/null
+	echo | 'quoted text' && awk local awk echo then cd test --verbose
+	then sed then "$1" x=1 --verbose $(pwd) local x=1 | awk -eu export export readonly
+		echo x=1 --verbose awk x=1 cd x=1 readonly
+$(pwd) sed ${HOME} printf 'quoted text'
+export $(pwd) && ${HOME} test --verbose sed echo $(pwd) | then cd
+		done then export $(pwd) local ${HOME}
+	readonly sed export test --verbose 'quoted text'
+'quoted text' 2>/dev/null
+	"$@" 'quoted text' sed "$1" x=1 "$@" ${HOME} cd echo export
+		&& x=1 grep readonly 'quoted text' |
+grep grep x=1 x=1 sed local sed export readonly
+		then then printf "$1" export
+		awk echo --verbose --verbose local /usr/bin
+readonly then export /usr/bin
+		--verbose ${HOME} done printf
+		2>/dev/null "$1" awk printf && -eu 'quoted text' then grep "$1" readonly sed
+		"$1" "$@" | printf grep /usr/bin printf printf -eu grep
+'quoted text' readonly $(pwd) printf export test 2>/dev/null done && "$@"
+then $(pwd) grep x=1 2>/dev/null cd awk && "$@"
+		2>/dev/null test 'quoted text' echo local 'quoted text'
+	awk cd done && -eu && then 2>/dev/null done ${HOME} cd 'quoted text' readonly export
+		then 2>/dev/null ${HOME} "$@" && "$1" --verbose
+"$@" --verbose 2>/dev/null x=1 grep sed export 'quoted text' echo 2>/dev/null
+		2>/dev/null ${HOME} export 'quoted text' $(pwd) --verbose ${HOME} then $(pwd)
+	"$1" && "$1" && awk grep
+	export --verbose export x=1 echo --verbose local
+		-eu printf local done && 2>/dev/null
+		"$@" test x=1 printf sed echo
+awk test ${HOME} readonly -eu --verbose && then 2>/dev/null
+	x=1 $(pwd) local | then x=1 "$1" "$1" $(pwd) "$@" "$1"
+		$(pwd) echo cd x=1 --verbose "$@" | cd 'quoted text' 'quoted text'
+grep readonly done then && | 2>/dev/null 2>/dev/null sed && $(pwd) printf -eu
+		/usr/bin -eu local --verbose then export printf then done printf
+then "$@" grep -eu ${HOME} ${HOME} printf x=1 grep $(pwd) | then
+echo "$1" sed export test export cd -eu | export ${HOME} "$1" | grep
+2>/dev/null | && -eu grep && $(pwd) "$@" grep -eu -eu "$1" ${HOME}
+	done export && 'quoted text' --verbose x=1 'quoted text' "$1"
+		"$1" --verbose "$@" $(pwd) | printf printf ${HOME} then /usr/bin /usr/bin | | grep
+-eu awk 2>/dev/null --verbose /usr/bin
+"$@" test test | test | "$@" "$@" "$@" cd "$@" echo readonly
+--verbose "$@" && awk $(pwd) readonly
+test test /usr/bin cd local && ${HOME} echo && --verbose
+		cd grep awk grep "$1" | awk test sed sed awk printf -eu test "$1"
+		'quoted text' 2>/dev/null printf cd 2>/dev/null
+		| "$1" x=1 awk -eu $(pwd) $(pwd) test echo
+		"$@" readonly echo local echo test
+	'quoted text' then 'quoted text' && && 2>/dev/null x=1 --verbose
+		--verbose test $(pwd) -eu "$@" export sed
+		export /usr/bin export local echo sed grep local && test x=1 local grep awk then
+-eu -eu 'quoted text' local -eu done cd readonly
+		done cd awk -eu readonly "$@" x=1 x=1 grep "$1" "$1" grep $(pwd) local
+	done /usr/bin && printf --verbose test cd readonly
+then --verbose local grep /usr/bin "$@" -eu 'quoted text'
+	-eu && 2>/dev/null grep "$@" "$@" $(pwd) $(pwd) local test /usr/bin 'quoted text'
+grep done "$@" "$1" "$1" -eu -eu "$1" echo "$@" awk $(pwd) cd x=1 test
+awk /usr/bin cd awk sed | grep "$1" test
+		readonly && 'quoted text' then "$1"
+	export sed $(pwd) && 2>/dev/null cd $(pwd) 'quoted text' "$@" cd local x=1
+		"$1" echo && 'quoted text' x=1 echo export && done local "$1" local echo
+done test export --verbose cd "$@" -eu
+	grep local --verbose readonly x=1 | export
+export --verbose readonly test 'quoted text' /usr/bin 2>/dev/null
+	then /usr/bin --verbose --verbose
+${HOME} echo "$1" "$1" printf awk x=1 x=1 | test | --verbose "$1" $(pwd)
+		2>/dev/null /usr/bin && readonly readonly
+		sed ${HOME} printf echo 'quoted text' --verbose
+	cd x=1 'quoted text' /usr/bin cd readonly sed local test
+/usr/bin echo -eu echo --verbose export
+	$(pwd) cd done grep -eu --verbose | grep echo ${HOME}
+	cd printf grep local 2>/dev/null echo $(pwd) export
+	done readonly /usr/bin -eu /usr/bin && local -eu "$1" -eu test
+local $(pwd) cd then cd echo export 2>/dev/null "$@" 'quoted text' "$1" printf
+	done /usr/bin then 2>/dev/null cd awk grep then 'quoted text'
+		grep ${HOME} | x=1 && "$@" printf cd done local test
+		"$@" /usr/bin grep test x=1 sed --verbose readonly
+	&& readonly export /usr/bin && $(pwd) "$@" /usr/bin
+		awk $(pwd) /usr/bin 'quoted text' -eu x=1 --verbose
+	done && readonly awk --verbose | sed
+	readonly done x=1 sed grep "$@" 2>/dev/null
+local 'quoted text' cd test /usr/bin sed
+	grep local --verbose 2>/dev/null cd grep export local grep echo "$@" ${HOME}
+	done awk -eu echo grep done $(pwd) sed
+		done then test awk printf done /usr/bin
+		done --verbose done export | --verbose "$1" ${HOME} local 2>/dev/null
+		"$@" echo cd ${HOME} ${HOME} then grep 'quoted text' $(pwd) 'quoted text' x=1 $(pwd)
+		&& "$1" && local --verbose && echo --verbose grep local echo awk | cd x=1 printf
+printf sed && local readonly done sed "$1" x=1 x=1 "$1" grep -eu local
+		2>/dev/null sed 'quoted text' $(pwd) 'quoted text'
+/usr/bin done --verbose --verbose x=1 -eu "$@"
+| readonly && export "$@" cd $(pwd) printf x=1 | export awk printf local
+		cd x=1 cd 'quoted text' echo /usr/bin 2>/dev/null "$@" awk then | | ${HOME}
+	readonly local x=1 | "$@" awk $(pwd) printf printf x=1 "$1" --verbose x=1 awk |
+		| grep awk test then ${HOME}
+	echo then --verbose ${HOME} "$@"
+done test $(pwd) done test "$1"
+then $(pwd) test printf cd x=1 2>/dev/null
+'quoted text' "$1" -eu "$@" readonly 2>/dev/null grep awk test ${HOME}
+	test 2>/dev/null export "$1" test test awk ${HOME} awk
+		--verbose && local && $(pwd) grep
+	$(pwd) sed local printf | 'quoted text'
+	x=1 readonly export cd --verbose done -eu "$@" 2>/dev/null echo -eu readonly
+		readonly 'quoted text' -eu "$1" ${HOME} ${HOME} 'quoted text' test local
+	printf $(pwd) printf done awk test sed local "$@" then --verbose
+		/usr/bin grep local awk /usr/bin ${HOME} local && then $(pwd) done
+/usr/bin sed $(pwd) &&
+	awk test echo grep grep test sed export x=1 "$@" | local local /usr/bin
+done test test 2>/dev/null cd
+	&& "$1" $(pwd) $(pwd) /usr/bin /usr/bin -eu
+	then export test -eu x=1 2>/dev/null export ${HOME} x=1 /usr/bin
+		${HOME} export x=1 ${HOME} cd grep
+grep x=1 readonly test then grep test -eu
+		"$1" grep $(pwd) echo printf -eu /usr/bin test grep
+		cd x=1 local | --verbose readonly -eu done test awk x=1 /usr/bin
+&& printf awk ${HOME} export echo cd local --verbose sed "$1" cd | --verbose
+	then export echo echo export
+	"$1" done local echo readonly ${HOME} "$1" done test test ${HOME} done
+	&& test printf x=1 printf grep test "$@" then export done --verbose
+	then local "$@" then | grep ${HOME} && sed
+	printf export cd ${HOME} done awk --verbose cd "$1" x=1 /usr/bin ${HOME} ${HOME}
+	/usr/bin echo sed ${HOME} ${HOME} && printf sed "$@" /usr/bin "$@" | ${HOME}
+		export echo $(pwd) readonly local $(pwd) echo x=1 && --verbose
+	--verbose "$@" echo && test "$1" readonly
+	echo cd test -eu test done
+	'quoted text' "$1" printf 2>/dev/null readonly
+	x=1 printf export && ${HOME} grep "$1"
+-eu printf test 2>/dev/null ${HOME} awk printf echo -eu 'quoted text' 'quoted text'
+&& $(pwd) -eu grep ${HOME} then test readonly
+$(pwd) -eu 2>/dev/null readonly --verbose /usr/bin readonly x=1 /usr/bin cd done
+	/usr/bin 'quoted text' local x=1 x=1 grep
+	x=1 local test export grep sed && $(pwd) --verbose "$@" echo --verbose
+		$(pwd) local done -eu -eu "$1"
+local done "$1" awk && test printf --verbose grep test sed test done "$1" "$1"
+		x=1 -eu readonly sed | test 2>/dev/null ${HOME} | cd "$@" x=1 grep local 2>/dev/null
+	echo && "$@" ${HOME} x=1 then grep readonly readonly
+		local export -eu echo sed test
+then test x=1 grep test then printf 2>/dev/null
+		local test --verbose local ${HOME} ${HOME} printf
+	/usr/bin -eu /usr/bin cd | "$@" awk x=1 && && 2>/dev/null
+"$@" && printf cd local done "$1"
+	sed printf /usr/bin "$@"
+	printf "$@" test grep "$1" readonly sed 'quoted text'
+		readonly cd printf readonly $(pwd)
+export printf "$1" $(pwd) sed && --verbose printf grep sed
+export -eu --verbose -eu "$1" ${HOME}
+2>/dev/null /usr/bin ${HOME} done printf "$@" then cd ${HOME} sed && echo x=1
+| -eu grep test $(pwd) readonly "$@"
+	sed -eu awk printf 2>/dev/null 2>/dev/null 'quoted text' "$@" 'quoted text'
+		-eu /usr/bin $(pwd) export
+	2>/dev/null sed 'quoted text' readonly
+	cd "$@" | then "$1" printf -eu && "$1" awk
+		sed cd -eu -eu -eu readonly | 'quoted text' 2>/dev/null 2>/dev/null local printf
+--verbose /usr/bin --verbose grep x=1 /usr/bin
+local "$@" "$@" local "$1" ${HOME}
+		then local -eu x=1 x=1 ${HOME} awk 'quoted text' local done "$@" export
+		awk then /usr/bin local
+test readonly readonly /usr/bin
+		-eu x=1 /usr/bin /usr/bin && ${HOME} "$1" x=1 test "$@"
+		grep test then 2>/dev/null awk export $(pwd) $(pwd) ${HOME} && awk then 2>/dev/null
+then --verbose echo /usr/bin | | echo grep then then grep local
+'quoted text' "$@" local readonly readonly sed grep echo printf cd |
+'quoted text' then && "$1" done "$1" 2>/dev/null "$@" grep test then ${HOME}
+		-eu --verbose "$@" echo export | x=1 /usr/bin
+		'quoted text' -eu cd export export ${HOME}
+		export 'quoted text' && "$@" sed | && cd /usr/bin 'quoted text' export ${HOME}
+$(pwd) /usr/bin test x=1 /usr/bin done 'quoted text'
+		/usr/bin /usr/bin $(pwd) echo readonly printf local grep grep | 2>/dev/null
+/usr/bin -eu ${HOME} echo grep grep
+	echo grep echo done echo $(pwd) cd awk | /usr/bin
+		x=1 readonly 2>/dev/null then sed --verbose ${HOME} | test export "$@"
+"$1" export && ${HOME} && then sed /usr/bin done 'quoted text'
+test "$1" --verbose 2>/dev/null done readonly "$@" then
+awk | printf local "$1" awk && test cd
+	"$@" readonly export awk readonly | /usr/bin awk $(pwd) x=1 then export export
+	/usr/bin sed cd cd "$@" $(pwd)
+		cd awk --verbose $(pwd) x=1 -eu "$@" grep printf
+		x=1 -eu -eu echo x=1 && done x=1 &&
+local | readonly x=1 readonly echo export && ${HOME} printf -eu then ${HOME}
+		--verbose sed && grep sed awk "$1"
+		test ${HOME} printf done "$1" echo -eu local 2>/dev/null cd 2>/dev/null
+"$@" grep && "$1" 2>/dev/null
+${HOME} done grep "$@" sed | && | echo cd | | && sed /usr/bin
+		--verbose echo | export done -eu | awk $(pwd) --verbose "$@" awk printf
+"$@" cd readonly 2>/dev/null
+grep sed readonly readonly sed "$1" $(pwd) then "$@" readonly sed
+'quoted text' printf -eu awk export | /usr/bin readonly then echo
+		| 2>/dev/null sed grep sed readonly echo
+echo done done x=1 echo echo readonly export readonly 2>/dev/null "$1"
+		local sed $(pwd) && --verbose awk && cd then grep done test test echo | cd
+then export "$@" -eu 'quoted text' "$1" sed grep 'quoted text'
+	awk grep test | sed /usr/bin 'quoted text'
+/usr/bin --verbose &&
+		local ${HOME} cd awk 2>/dev/null
+	done awk ${HOME} ${HOME} --verbose 'quoted text' local "$1" cd test
+	sed local --verbose 2>/dev/null
+	done | test | grep printf echo grep 'quoted text' x=1 2>/dev/null
+/usr/bin x=1 'quoted text' echo awk "$1" local export grep echo grep
+		2>/dev/null sed test --verbose sed x=1 -eu printf local
+	local done grep --verbose awk $(pwd) 'quoted text' /usr/bin
+test export /usr/bin --verbose
+	awk test done "$1" $(pwd) local 'quoted text' /usr/bin $(pwd) local
+--verbose awk "$1" export $(pwd) echo export readonly echo --verbose
+		| done "$1" "$@" then "$1"
+		"$1" echo 'quoted text' sed && 2>/dev/null 2>/dev/null
+	local ${HOME} done done local sed "$1" --verbose ${HOME} awk 2>/dev/null --verbose
+test $(pwd) x=1 | echo done ${HOME} 2>/dev/null
+	/usr/bin local echo 'quoted text' test cd grep echo printf
+	export then done test ${HOME}
+		&& cd -eu local sed | x=1 test test cd && $(pwd)
+		--verbose done awk /usr/bin && "$@"
+-eu echo export cd "$1" printf done grep /usr/bin $(pwd) export $(pwd) test
+	"$1" readonly echo $(pwd)
+		"$@" awk printf && test "$@" | printf readonly printf printf
+		test ${HOME} --verbose $(pwd) grep cd awk 'quoted text' $(pwd)
+	"$@" then readonly | echo grep local cd export echo test x=1 'quoted text'
+cd --verbose readonly -eu readonly
+readonly && cd ${HOME} export local echo x=1 cd $(pwd) "$1" && printf
+	--verbose "$@" export "$1" --verbose 'quoted text'
+	'quoted text' echo 'quoted text' $(pwd) /usr/bin test 2>/dev/null
+&& local grep grep printf test done done test /usr/bin && printf cd sed readonly
+	"$1" printf x=1 grep export /usr/bin
+		--verbose then done export /usr/bin
+		x=1 /usr/bin then "$@" ${HOME} done printf --verbose readonly
+		"$1" export | awk echo local awk ${HOME} "$1" 2>/dev/null --verbose
+		local ${HOME} x=1 -eu | printf $(pwd) readonly $(pwd) printf
+grep then ${HOME} grep ${HOME} -eu printf /usr/bin x=1 2>/dev/null x=1 cd local
+	"$@" "$1" sed -eu cd done $(pwd) awk
+"$1" printf then done | test --verbose 'quoted text' cd export "$1" export echo
+		export | cd grep x=1 then 'quoted text' grep export echo x=1
+	then -eu then export $(pwd) 'quoted text' echo test -eu "$@"
+	| -eu | | | test then grep && -eu 'quoted text' test | awk test
+	'quoted text' "$1" printf --verbose then ${HOME} readonly local done test
+		-eu awk then cd /usr/bin done "$@" 'quoted text' -eu /usr/bin
+		${HOME} awk $(pwd) ${HOME} && x=1 | "$@" --verbose $(pwd) ${HOME}
+	readonly --verbose readonly
+		&& "$1" $(pwd) export
+	local then | readonly "$@" --verbose -eu done /usr/bin "$1" 'quoted text' &&
+		grep sed readonly ${HOME} | ${HOME} test | ${HOME}
+	&& then export sed -eu /usr/bin /usr/bin $(pwd) printf
+| echo -eu $(pwd) x=1 ${HOME} && done "$1" echo /usr/bin "$@" 'quoted text' then
+		local done printf readonly && export export
+		&& $(pwd) local cd "$1" awk done cd printf
+sed 2>/dev/null 'quoted text' && then sed --verbose done cd "$1" 2>/dev/null
+awk "$1" readonly test x=1 readonly readonly | export -eu -eu
+	2>/dev/null -eu --verbose 'quoted text'
+then && ${HOME} sed then readonly export awk 'quoted text'
+		echo grep $(pwd) ${HOME} readonly awk cd grep 'quoted text'
+		cd ${HOME} local "$1" $(pwd) echo | readonly done | x=1
+		grep cd done x=1 $(pwd) $(pwd) 'quoted text' /usr/bin
+		export 'quoted text' local test
+local done -eu --verbose grep cd /usr/bin readonly $(pwd) grep export
+test "$@" 2>/dev/null "$1" sed ${HOME} "$@" sed sed then export test --verbose
+		x=1 export "$@" x=1 printf ${HOME} | | 2>/dev/null
+local -eu -eu echo "$@" readonly $(pwd) test test
+		readonly export $(pwd)
+		cd sed | test printf /usr/bin /usr/bin
+	'quoted text' 2>/dev/null then sed 2>/dev/null $(pwd)
+'quoted text' 2>/dev/null ${HOME} export
+readonly then test cd "$1" x=1 && grep readonly awk awk 'quoted text' cd done
+	"$@" echo /usr/bin "$@" && /usr/bin export x=1 ${HOME} x=1 grep && printf
+		local echo awk && readonly ${HOME} export --verbose | test export $(pwd) | 2>/dev/null
+		&& test ${HOME} $(pwd) x=1 test --verbose echo "$@"
+		local | "$1" sed sed test readonly printf && $(pwd) && test grep
+	| 'quoted text' -eu sed test /usr/bin
+-eu "$@" $(pwd) 2>/dev/null |
+	then /usr/bin export test "$1" -eu
+	-eu && 'quoted text' test --verbose 2>/dev/null awk 2>/dev/null && local export
+	echo readonly test ${HOME} done /usr/bin "$@" x=1 2>/dev/null
+	--verbose | | && "$1" && export 2>/dev/null export ${HOME}
+	test sed readonly echo awk -eu readonly done --verbose && -eu test test
+	-eu export awk test printf awk ${HOME} test printf --verbose then printf "$@" x=1
+	readonly then awk printf
+	done cd echo 2>/dev/null test awk "$1" done then awk
+		&& && "$@" test ${HOME} printf $(pwd)
+	&& x=1 printf && awk printf && | local --verbose export cd 'quoted text' -eu then
+	--verbose printf && export sed done then $(pwd)
+		"$@" $(pwd) grep 2>/dev/null cd
+-eu 'quoted text' "$@" local --verbose && awk --verbose "$1" printf
+		readonly done /usr/bin | local awk && "$1" test "$1" export test done
+cd && /usr/bin | awk then done done test test
+"$1" $(pwd) grep printf local cd -eu
+"$@" done grep $(pwd) 2>/dev/null 2>/dev/null then printf
+		done ${HOME} /usr/bin test grep then 'quoted text' readonly export test cd /usr/bin
+	done -eu -eu /usr/bin echo && then
+	done | cd "$@" cd sed then printf x=1 printf done grep printf
+x=1 --verbose -eu printf printf echo && x=1
+${HOME} /usr/bin readonly readonly grep --verbose /usr/bin
+'quoted text' done "$@" -eu -eu echo sed ${HOME}
+		awk $(pwd) $(pwd) grep readonly | "$1" grep grep -eu -eu && awk sed 2>/dev/null
+		| cd 'quoted text' then "$@" local grep grep ${HOME} 'quoted text' --verbose
+	local done sed 'quoted text' done test export && awk awk 'quoted text'
+done "$1" ${HOME} readonly /usr/bin
+		2>/dev/null sed sed awk readonly | local local
+		done test x=1 awk x=1 done echo ${HOME} printf "$1" "$@" echo awk "$1" echo
+	"$@" awk readonly local -eu | done $(pwd) $(pwd) readonly
+&& printf "$@" test /usr/bin
+echo export readonly export
+x=1 $(pwd) export | grep sed
+	"$1" cd readonly "$@" echo echo ${HOME} x=1 local cd awk readonly x=1 readonly
+	/usr/bin test --verbose cd x=1 --verbose echo && printf
+sed "$1" $(pwd) sed ${HOME} /usr/bin readonly --verbose $(pwd)
+		/usr/bin test readonly done 2>/dev/null "$1" printf readonly "$@"
+test x=1 readonly && /usr/bin sed "$1" $(pwd) printf test $(pwd) | test grep readonly
+		done awk && sed --verbose printf
+		2>/dev/null --verbose grep ${HOME} cd
+		$(pwd) x=1 sed -eu echo awk export then
+--verbose "$@" && test 2>/dev/null
+	x=1 echo "$1" cd local "$1" sed grep $(pwd)
+		grep -eu then cd grep "$1" readonly printf "$@" printf x=1
+	-eu "$1" sed | awk then x=1 -eu
+export --verbose cd grep done done x=1 then awk export local
+		printf /usr/bin && cd && x=1 $(pwd) test printf test cd | 2>/dev/null 'quoted text'
+| --verbose --verbose -eu && sed grep $(pwd) grep then test | readonly grep $(pwd)
+	test sed awk done done -eu printf awk x=1 x=1
+		echo x=1 'quoted text' local grep
+done "$@" && cd test done 'quoted text' readonly echo local echo done
+		| /usr/bin awk local sed local "$1" | --verbose $(pwd)
+		awk x=1 | 2>/dev/null $(pwd) ${HOME} --verbose $(pwd)
+then test echo grep export
+	export done grep 'quoted text' printf | export
+	"$1" -eu echo 2>/dev/null /usr/bin -eu done 2>/dev/null test awk
+sed 2>/dev/null $(pwd)
+&& echo sed 'quoted text'
+	cd awk ${HOME} then awk readonly grep --verbose printf 2>/dev/null echo printf
+&& /usr/bin "$@" then | done x=1 readonly --verbose sed awk grep 2>/dev/null
+test 'quoted text' local -eu 2>/dev/null /usr/bin
+cd echo sed x=1 'quoted text' /usr/bin x=1 echo
+	${HOME} 'quoted text'
+	2>/dev/null sed done grep export 'quoted text' 'quoted text' then | "$@"
+	cd awk $(pwd) sed export test --verbose
+		2>/dev/null x=1 sed --verbose
+x=1 | 2>/dev/null echo $(pwd) && cd printf "$1" local
+	printf --verbose then test &&
+	--verbose --verbose readonly && cd 2>/dev/null ${HOME} awk echo /usr/bin
+		export printf /usr/bin && "$@" $(pwd)
+	local readonly printf "$1" printf 'quoted text'
+cd ${HOME} then echo done 2>/dev/null echo local done
+		grep done cd "$@" export awk grep awk 2>/dev/null
+then 2>/dev/null grep x=1 --verbose ${HOME} "$1" sed sed && cd x=1 then
+		export $(pwd) cd "$@" 'quoted text' -eu | export local then 'quoted text'
+	x=1 'quoted text' -eu done x=1 $(pwd) $(pwd) printf test x=1 printf &&
+		-eu echo | "$@" cd test cd
+	'quoted text' grep ${HOME} --verbose
+	x=1 local awk export $(pwd) printf 'quoted text' 'quoted text'
+grep 'quoted text' --verbose
+"$1" readonly "$@" local x=1 sed --verbose | --verbose
+	$(pwd) --verbose export
+local sed echo ${HOME} x=1 'quoted text'
+	$(pwd) -eu done 'quoted text' echo export awk -eu local then sed ${HOME} "$@"
+	| && $(pwd) grep "$1" export done printf echo
+	'quoted text' grep "$1" printf grep
+		-eu /usr/bin cd awk sed 2>/dev/null $(pwd)
+		test echo && && "$1" /usr/bin test
+	"$@" grep local local x=1 x=1 ${HOME} echo cd --verbose grep test readonly
+		grep cd printf sed sed --verbose
+	x=1 sed export | x=1 sed done | cd x=1 $(pwd) 2>/dev/null
+local | "$1" 'quoted text' echo local printf 2>/dev/null
+	$(pwd) local local then grep cd "$@" --verbose local
+done awk "$1" export done
+	--verbose printf | sed x=1 $(pwd) local
+		awk 2>/dev/null --verbose ${HOME} "$1" awk
+	"$@" echo then ${HOME}
+		local --verbose x=1 awk cd x=1 2>/dev/null test x=1 'quoted text'
+	"$@" -eu sed $(pwd) done 'quoted text' "$@" "$@" export -eu
+		awk $(pwd) 'quoted text' echo && echo
+then --verbose done sed ${HOME} "$@" sed --verbose &&
+		echo && x=1 "$1" grep local /usr/bin sed ${HOME} ${HOME} ${HOME} echo
+readonly printf export export test "$@"
+		$(pwd) then 'quoted text' $(pwd) "$@" local "$1" | readonly sed | sed /usr/bin
+test /usr/bin && then 2>/dev/null "$1" printf 2>/dev/null printf awk export
+"$@" cd awk $(pwd) "$@" printf "$@" | sed echo awk echo
+	"$@" then /usr/bin -eu | && && echo 2>/dev/null
+		2>/dev/null sed ${HOME} awk ${HOME} echo local readonly /usr/bin
+		then $(pwd) done local 2>/dev/null 'quoted text' && readonly --verbose
+		"$@" ${HOME} printf then readonly awk
+		grep test ${HOME} 2>/dev/null $(pwd) && awk $(pwd) 2>/dev/null
+		export 'quoted text' --verbose
+x=1 done ${HOME} --verbose awk cd -eu 2>/dev/null --verbose $(pwd) printf
+echo export "$@" "$@" readonly test sed "$@" --verbose then
+	awk sed local --verbose then $(pwd) export
+awk printf | printf && 'quoted text' cd "$@" awk done echo printf
+	grep "$@" /usr/bin 2>/dev/null readonly awk export x=1 done -eu "$1"
+done local | echo local /usr/bin "$@" sed $(pwd) "$1" grep
+	local 'quoted text' --verbose export "$@" local done $(pwd) 2>/dev/null
+		/usr/bin && x=1 x=1 $(pwd) /usr/bin echo --verbose sed echo |
+2>/dev/null ${HOME} grep readonly /usr/bin --verbose x=1
+	done local cd /usr/bin 'quoted text'
+export $(pwd) x=1 ${HOME} cd done readonly -eu test
+	printf && | echo test readonly
+		${HOME} done 'quoted text' 'quoted text' readonly
+	&& 2>/dev/null 'quoted text' test sed "$1" done ${HOME} && readonly local "$@"
+	local grep awk done awk printf 'quoted text' 2>/dev/null --verbose
+"$@" then printf export 2>/dev/null local cd test then cd -eu then cd
+--verbose 2>/dev/null sed | && readonly ${HOME} awk $(pwd) readonly then
+$(pwd) then | ${HOME} done ${HOME} then 2>/dev/null /usr/bin sed then awk 2>/dev/null
+		grep grep printf cd local grep "$@" echo
+export $(pwd) && ${HOME} export readonly ${HOME}
+&& then ${HOME} | && sed sed | $(pwd)
+${HOME} 2>/dev/null export done echo sed "$1" 2>/dev/null cd
+	| test $(pwd) | | x=1 'quoted text'
+	done awk "$@" "$1" readonly grep "$1" then awk test printf test /usr/bin 2>/dev/null
+	"$@" "$@" 2>/dev/null &&
+	readonly printf $(pwd) done test readonly local --verbose printf | --verbose
+		"$1" local export $(pwd)
+/usr/bin 'quoted text' /usr/bin done echo readonly readonly
+${HOME} done $(pwd) local printf $(pwd) -eu test -eu
+	--verbose printf echo cd grep 'quoted text' /usr/bin sed
+		$(pwd) -eu awk | test cd 'quoted text' readonly
+&& echo test cd awk ${HOME} awk echo | readonly printf $(pwd) awk export awk "$1"
+"$@" 2>/dev/null "$1"
+	x=1 test "$@" done test
+		sed $(pwd) done 'quoted text' awk && grep
+	--verbose "$1" --verbose $(pwd) | export --verbose readonly --verbose
+	'quoted text' /usr/bin printf grep x=1 'quoted text' test export
+	readonly readonly 2>/dev/null --verbose "$@" 2>/dev/null ${HOME}
+2>/dev/null sed sed cd
+printf ${HOME} 'quoted text' awk export awk && 2>/dev/null echo local
+	awk && --verbose echo awk then local then --verbose /usr/bin
+		export local cd echo awk && ${HOME} then x=1 ${HOME}
+		sed "$1" test readonly done printf sed ${HOME}
+cd awk done grep | awk -eu x=1 export | "$@" "$@" grep echo test 'quoted text'
+--verbose cd "$1" printf readonly 'quoted text' done export then local
+	${HOME} cd sed $(pwd) 'quoted text'
+test local export test
+	${HOME} -eu sed 2>/dev/null sed x=1 printf $(pwd) cd
+sed -eu "$@" "$1" export grep $(pwd) cd echo "$@" --verbose 2>/dev/null
+		${HOME} --verbose done test /usr/bin done cd done "$1" "$@" test | /usr/bin
+	'quoted text' readonly "$@" then 'quoted text' done echo
+sed $(pwd) 2>/dev/null /usr/bin export "$1" --verbose echo readonly awk
+| x=1 /usr/bin test --verbose ${HOME} readonly 'quoted text'
+'quoted text' sed export cd export awk ${HOME} test sed $(pwd) && then
+		then printf $(pwd) awk local --verbose readonly /usr/bin -eu | printf 'quoted text'
+	"$@" /usr/bin /usr/bin ${HOME} done x=1 "$1" then
+		sed echo awk | /usr/bin test | 'quoted text' "$@" grep 'quoted text'
+	printf grep 'quoted text' then sed | export /usr/bin ${HOME}
+--verbose cd x=1 /usr/bin | then
+		export local -eu sed | awk readonly
+		local | echo -eu printf ${HOME} x=1 2>/dev/null readonly 2>/dev/null
+		export $(pwd) done "$@" /usr/bin
+sed echo && export export
+		-eu "$@" done ${HOME}
+x=1 printf local local sed "$1" -eu $(pwd) cd cd ${HOME} then export export "$1"
+	| sed "$1" $(pwd) done test x=1 ${HOME}
+cd done sed local /usr/bin then
+awk $(pwd) 'quoted text' "$1" readonly echo
+	then $(pwd) export echo "$@" readonly x=1 cd
+	"$1" grep "$1" cd printf ${HOME} "$@" echo -eu done
+2>/dev/null ${HOME} 2>/dev/null | "$@" printf 'quoted text' test
+		&& printf then done "$1" $(pwd) && sed done 'quoted text'
+test ${HOME} then ${HOME} --verbose cd $(pwd) then 2>/dev/null echo awk "$@"
+		| 'quoted text' 2>/dev/null awk local test $(pwd) sed
+		2>/dev/null awk | /usr/bin
+sed /usr/bin then "$1" cd grep | readonly "$1" then sed -eu local /usr/bin local
+	"$@" readonly /usr/bin 2>/dev/null /usr/bin -eu -eu -eu awk
+${HOME} readonly done export awk grep export awk cd echo printf
+		grep | awk "$@" "$1" -eu 2>/dev/null /usr/bin printf &&
+		"$@" grep && ${HOME} /usr/bin | && test grep awk local echo 2>/dev/null test done
+		local awk sed -eu then 2>/dev/null "$@" ${HOME} 'quoted text' test 2>/dev/null
+then printf -eu x=1 | --verbose --verbose sed local
+		| cd ${HOME} readonly | x=1 grep test done ${HOME} $(pwd) test |
+"$1" --verbose ${HOME} done 'quoted text' "$@"
+		grep "$1" $(pwd) ${HOME} echo test echo 2>/dev/null export && awk | | -eu
+		grep cd 2>/dev/null then then $(pwd) $(pwd)
+	${HOME} | 'quoted text' | | x=1 x=1 --verbose x=1 test 2>/dev/null
+		printf grep readonly then x=1 echo 2>/dev/null /usr/bin | printf 'quoted text'
+	x=1 ${HOME} export awk cd then echo 'quoted text' /usr/bin $(pwd) done |
+		echo "$@" cd && 2>/dev/null "$@" readonly
+done 2>/dev/null | $(pwd) echo $(pwd) ${HOME} && && && cd cd -eu
+cd sed 'quoted text' "$@" && $(pwd) local x=1 local
+	echo && x=1 export cd | test readonly export done awk local
+		export export printf test --verbose x=1 printf echo readonly local | --verbose
+		then then "$1" "$1" cd printf --verbose | then 'quoted text'
+echo then /usr/bin printf && local sed local ${HOME} $(pwd) ${HOME} awk readonly
+'quoted text' 2>/dev/null printf | sed local
+--verbose && local printf sed "$1" 'quoted text'
+	x=1 echo 2>/dev/null readonly then "$@" export
+2>/dev/null grep --verbose printf awk -eu printf && "$1" echo
+	x=1 echo local ${HOME} 2>/dev/null 2>/dev/null then $(pwd) echo 'quoted text'
+		grep readonly 'quoted text' -eu grep -eu then local done cd printf -eu "$@"
+${HOME} export printf then export "$@" readonly 2>/dev/null
+	sed sed 'quoted text' readonly local export sed echo done echo
+"$@" done --verbose -eu
+		readonly /usr/bin echo done export --verbose 2>/dev/null
+"$@" cd | | done --verbose ${HOME}
+	awk awk -eu test cd sed /usr/bin awk printf
+		$(pwd) -eu x=1 echo local
+${HOME} local ${HOME} test sed
+	printf export printf 'quoted text' | test
+		"$1" && sed cd -eu done /usr/bin awk echo sed "$1" && ${HOME} --verbose
+test "$@" --verbose local
+cd cd readonly grep grep && && ${HOME} $(pwd) x=1 && done
+	local "$@" sed awk echo
+	x=1 awk "$1" $(pwd) $(pwd)
+${HOME} readonly awk x=1 -eu export then 2>/dev/null x=1 x=1
+	readonly readonly ${HOME} | awk test | "$1" "$@" cd && /usr/bin | local echo
+		| 2>/dev/null local "$@" $(pwd) x=1 x=1 ${HOME} "$@" readonly echo awk "$@" -eu
+	local cd readonly grep /usr/bin ${HOME} awk then grep /usr/bin grep test
+		cd echo sed then "$@" awk ${HOME}
+		cd printf ${HOME} | readonly sed ${HOME} 2>/dev/null
+/usr/bin echo | | echo
+		-eu grep sed local echo -eu ${HOME} | 2>/dev/null readonly -eu --verbose
+	${HOME} echo cd | test /usr/bin && readonly done local
+		cd then printf test then echo echo local $(pwd) "$1" x=1 local grep echo local
+		printf test x=1 "$@" 2>/dev/null done then 'quoted text'
+		&& && test local export printf
+	echo readonly --verbose "$@"
+	echo /usr/bin && /usr/bin x=1 cd "$@" printf grep
+	then readonly "$@" /usr/bin test echo | done
+done done ${HOME} $(pwd) $(pwd) --verbose && ${HOME} --verbose sed
+	"$1" local local -eu printf
+export 'quoted text' /usr/bin ${HOME} ${HOME} echo ${HOME} export
+	2>/dev/null done export grep awk test $(pwd) "$1" local done && done "$1"
+export local grep test ${HOME}
+--verbose "$@" sed printf grep "$1" echo ${HOME} && then 2>/dev/null
+'quoted text' then local $(pwd) printf
+		then local cd echo && then then --verbose grep test done grep
+	/usr/bin ${HOME} sed echo test cd sed
+	local readonly done --verbose
+	printf local /usr/bin ${HOME} done --verbose done "$1" echo test --verbose
+--verbose readonly sed /usr/bin readonly | "$@" ${HOME} sed test test
+cd ${HOME} | printf test
+	"$@" 'quoted text' -eu export /usr/bin grep -eu then local
+	--verbose 'quoted text' grep then "$@" printf
+		done printf --verbose readonly done && test done cd readonly echo
+| | "$@" grep echo | "$@" printf
+		done test then 'quoted text' ${HOME} /usr/bin
+/usr/bin grep | done x=1 --verbose && awk echo $(pwd)
+		"$@" && && grep local printf 2>/dev/null "$@" done -eu echo echo && sed --verbose
+		$(pwd) --verbose test "$@" done 'quoted text'
+export done echo x=1 ${HOME} test sed printf sed
+		echo "$@" done 2>/dev/null
+${HOME} grep grep awk -eu cd x=1 | | x=1
+&& ${HOME} /usr/bin && readonly x=1
+cd && test "$1" sed 'quoted text'
+echo x=1 -eu done awk ${HOME} 'quoted text' sed 2>/dev/null test $(pwd) export
+		$(pwd) -eu | cd ${HOME} "$@"
+/usr/bin 2>/dev/null printf local "$@"
+		${HOME} echo then && && "$1" | 2>/dev/null test /usr/bin x=1 readonly /usr/bin
+		| local printf cd printf -eu --verbose 2>/dev/null "$1" local -eu 'quoted text'
+	"$1" -eu grep awk "$@" && --verbose awk awk local -eu "$1" test
+		printf 'quoted text' 'quoted text' && | "$1" awk
+export $(pwd) x=1 && "$@" sed --verbose
+/usr/bin test echo "$1" export echo | ${HOME} -eu /usr/bin printf 2>/dev/null
+'quoted text' then x=1 /usr/bin 2>/dev/null readonly
+		printf 2>/dev/null x=1 local 'quoted text' "$@" | "$1" && cd
+done grep $(pwd) 'quoted text' done "$@"
+	local printf && | sed printf cd --verbose | 'quoted text' &&
+		x=1 $(pwd) ${HOME} $(pwd) echo
+		echo $(pwd) cd grep echo 'quoted text' printf grep printf ${HOME} sed
+	${HOME} "$1" cd test | test /usr/bin /usr/bin
+		-eu test x=1 | grep sed --verbose
+	then -eu ${HOME} $(pwd) test then --verbose printf export $(pwd)
+		'quoted text' readonly -eu "$1" echo | grep &&
+	${HOME} /usr/bin sed done local grep
+		test "$1" test done ${HOME} 'quoted text' cd
+		2>/dev/null ${HOME} readonly 2>/dev/null x=1 grep 'quoted text' "$@" grep
+		export -eu --verbose "$@" readonly
+	/usr/bin && "$@" x=1 ${HOME} x=1 -eu grep grep grep 'quoted text'
+'quoted text' "$1" export export /usr/bin x=1 "$1" && then cd /usr/bin
+then printf echo cd grep
+	test cd grep then /usr/bin test $(pwd)
+		/usr/bin cd "$1" /usr/bin echo local
+	/usr/bin x=1 echo | && test ${HOME} done
+		local local | local &&
+echo grep printf -eu $(pwd) done -eu
+	-eu 2>/dev/null && --verbose | "$@" cd cd
+2>/dev/null /usr/bin ${HOME} 2>/dev/null "$@" export
+	"$@" grep then cd 'quoted text'
+		&& sed echo readonly sed awk "$@" &&
+	grep "$@" | "$1" local cd "$1" grep test -eu export
+	grep $(pwd) "$@" printf "$1" --verbose export ${HOME} | 2>/dev/null
+		then grep --verbose local && awk 2>/dev/null x=1 local local $(pwd)
+	"$@" ${HOME} 2>/dev/null -eu cd x=1 | 2>/dev/null cd $(pwd) ${HOME}
+	$(pwd) 2>/dev/null "$@" printf && awk awk
+2>/dev/null export test
+	printf /usr/bin 2>/dev/null grep $(pwd) 'quoted text' $(pwd) -eu
+	readonly then --verbose grep 'quoted text'
+		&& grep "$1" x=1 local readonly awk local && && 'quoted text'
+	/usr/bin grep printf "$1" x=1
+		$(pwd) 'quoted text' && printf && 2>/dev/null
+		-eu export | 'quoted text' $(pwd) --verbose /usr/bin printf export grep cd
+local printf "$@" -eu 2>/dev/null
+	readonly && done export ${HOME} ${HOME} test sed echo "$1" --verbose
+	/usr/bin test grep awk "$@" /usr/bin /usr/bin
+x=1 /usr/bin echo 2>/dev/null &&
+${HOME} sed grep | test |
+"$@" "$@" test printf
+| export printf --verbose && x=1 $(pwd) export
+		sed printf --verbose $(pwd) awk -eu local cd done local readonly "$@" test
+	"$@" cd grep export cd -eu export printf awk
+$(pwd) ${HOME} -eu readonly export 2>/dev/null
+| awk echo printf export local 2>/dev/null 'quoted text' export grep
+cd "$1" -eu then echo
+		'quoted text' local done echo ${HOME} readonly
+	printf readonly "$@" local grep && "$@" sed x=1 export then
+	test export "$1" export readonly 'quoted text' 2>/dev/null grep export 2>/dev/null
+		2>/dev/null 'quoted text' grep printf --verbose
+then sed export "$1"
+'quoted text' $(pwd) |
+	test then "$@" then x=1 done readonly "$1" "$1" 2>/dev/null awk awk -eu ${HOME}
+awk --verbose awk /usr/bin x=1
+x=1 cd done | -eu sed sed | then test grep |
+"$1" awk --verbose x=1 printf sed -eu | then test 'quoted text'
+		export done /usr/bin printf 2>/dev/null export awk
+	test then 2>/dev/null done 'quoted text'
+		awk | $(pwd) && echo --verbose && $(pwd) then $(pwd) then readonly ${HOME}
+&& done then then x=1 2>/dev/null -eu done 2>/dev/null
+		/usr/bin | -eu local sed printf echo then local readonly then ${HOME}
+		test sed grep /usr/bin done && cd readonly 2>/dev/null sed test ${HOME}
+done --verbose -eu readonly
+export printf $(pwd) export x=1 ${HOME} $(pwd) --verbose x=1
+	&& "$@" local then cd "$1" ${HOME} grep | --verbose sed --verbose
+then export then 'quoted text'
+		| x=1 printf "$@" printf /usr/bin export test cd test -eu "$1" && $(pwd) cd
+	2>/dev/null --verbose done ${HOME} cd x=1 --verbose x=1 done grep
+		/usr/bin test awk --verbose $(pwd) echo done --verbose test && -eu export
+export test x=1 ${HOME} /usr/bin | x=1 grep | cd ${HOME}
+		local "$1" ${HOME} -eu && "$1"
+		"$@" "$@" x=1 echo $(pwd) ${HOME} x=1 ${HOME} then "$@" awk && sed sed export
+&& awk "$@" grep grep --verbose
+${HOME} printf | done cd $(pwd) done && done 2>/dev/null echo cd
+	-eu | "$@" printf 'quoted text' && sed export then $(pwd) --verbose
+grep cd grep awk test 2>/dev/null |
+2>/dev/null | awk "$@" 2>/dev/null
+cd local awk -eu | local grep printf
+"$1" | grep "$@" "$@" awk sed grep awk $(pwd) export cd export
+		--verbose echo done /usr/bin -eu test grep "$@" export sed grep --verbose
+	readonly "$@" $(pwd) "$@" then "$1"
+		-eu done test then | $(pwd) local echo cd sed /usr/bin printf -eu -eu -eu
+		local 'quoted text' test "$1" /usr/bin echo --verbose export
+"$@" | --verbose && local echo cd /usr/bin sed 'quoted text' && -eu then
+&& $(pwd) $(pwd) cd done --verbose awk "$1" awk readonly
+awk grep "$@" export cd /usr/bin grep echo printf
+grep echo done "$@" | echo test -eu test 'quoted text' /usr/bin | &&
+	then 2>/dev/null && cd x=1 done
+	${HOME} -eu /usr/bin 'quoted text' ${HOME} local 'quoted text'
+sed /usr/bin echo export grep ${HOME} sed 'quoted text' cd local $(pwd) echo "$@"
+	/usr/bin 'quoted text' |
+	/usr/bin /usr/bin -eu grep x=1
+$(pwd) awk ${HOME} export -eu -eu 'quoted text' "$1" grep 'quoted text'
+		local grep "$@" && "$1" done --verbose grep export --verbose cd 'quoted text'
+	awk export export echo 'quoted text' 'quoted text' echo 'quoted text' --verbose
+"$1" export -eu export export "$1"
+	export ${HOME} then printf && export then ${HOME} export grep
+then 2>/dev/null "$1" && local -eu $(pwd) readonly
+	local $(pwd) x=1 x=1 cd "$@" ${HOME} done sed
+--verbose local --verbose done readonly --verbose test -eu sed "$@" local "$@"
+		done ${HOME} readonly $(pwd) ${HOME} ${HOME} "$@"
+	x=1 2>/dev/null --verbose 'quoted text'
+	echo x=1 /usr/bin "$@" -eu | awk && "$1" readonly printf printf
+	'quoted text' local && export "$@" local test
+	"$@" test "$1" echo grep test sed awk | ${HOME} -eu export done 2>/dev/null
+	$(pwd) -eu 2>/dev/null test sed echo
+x=1 | 'quoted text' $(pwd) x=1 export "$1" 2>/dev/null x=1 export
+&& -eu echo echo export local /usr/bin sed export echo ${HOME} echo readonly
+2>/dev/null printf /usr/bin test printf
+$(pwd) printf cd local then "$@" ${HOME}
+	export --verbose cd local -eu
+		'quoted text' grep grep "$@"
+		2>/dev/null then then local done -eu
+local then test sed /usr/bin export -eu | "$1" grep 'quoted text'
+echo "$@" && "$@" "$1" 'quoted text' x=1 | sed readonly
+"$@" --verbose printf --verbose --verbose ${HOME}
+		export 2>/dev/null x=1 readonly export 2>/dev/null
+		then awk 'quoted text' local printf "$1" /usr/bin ${HOME}
+	"$1" sed | export "$@" printf x=1 echo | && $(pwd) echo -eu
+	--verbose grep test done awk --verbose readonly 2>/dev/null
+&& cd grep /usr/bin --verbose
+		then cd | readonly export && grep
+	sed /usr/bin printf &&
+	cd 'quoted text' cd --verbose local 'quoted text'
+x=1 $(pwd) ${HOME} ${HOME} done export --verbose
+	--verbose readonly /usr/bin then grep
+export | ${HOME} test then export
+x=1 | 2>/dev/null local then printf | | cd printf readonly /usr/bin && cd
+	x=1 "$@" readonly readonly awk -eu x=1 grep local | printf sed sed
+		$(pwd) test /usr/bin then awk 2>/dev/null -eu "$1" test --verbose echo local
+sed x=1 sed --verbose echo export sed && $(pwd) local export cd readonly
+${HOME} x=1 readonly x=1
+| x=1 then 2>/dev/null -eu test grep --verbose "$@" && readonly -eu local | -eu
+| printf cd grep sed grep "$@"
+	done local printf && && printf && | "$@" export --verbose test
+	then echo "$1" | "$@" --verbose awk done printf then "$1" x=1
+#include c46.sh
+	x=1 "$1" test then --verbose
+		/usr/bin printf | /usr/bin && done x=1 "$1" x=1 -eu cd printf
+	printf --verbose "$@" $(pwd) $(pwd) sed $(pwd)
+	test local ${HOME} "$@" export x=1 --verbose && done
+"$1" awk 'quoted text' sed -eu | then
+echo x=1 test "$@" test local $(pwd) local && export
+		| awk 'quoted text' $(pwd) "$1" --verbose done awk local --verbose --verbose "$@"
+	'quoted text' "$@" test printf && local echo
+		printf 2>/dev/null awk /usr/bin "$@" local printf && echo then | done ${HOME} then
+		local then 2>/dev/null --verbose export
+$(pwd) $(pwd) local awk ${HOME} then x=1 "$@"
+grep -eu sed ${HOME} grep 'quoted text' export --verbose 2>/dev/null echo local
+		--verbose $(pwd) done | printf
+		| | ${HOME} x=1 sed readonly echo export "$@" local
+		$(pwd) cd sed x=1 /usr/bin then x=1 /usr/bin readonly $(pwd) readonly | local
+		cd | -eu && awk 'quoted text' --verbose --verbose then "$@" --verbose echo
+		"$1" sed 'quoted text'
+"$@" printf x=1 local awk test 2>/dev/null readonly printf
+readonly grep test && ${HOME} done $(pwd) -eu 'quoted text'
+	echo printf 'quoted text' readonly "$@" 'quoted text'
+		${HOME} grep awk | x=1 echo printf "$@" | 'quoted text'
+	then done readonly -eu sed export 'quoted text' printf --verbose
+		readonly awk "$1" -eu && test cd x=1 --verbose 2>/dev/null
+		export printf awk x=1 | test ${HOME}
+${HOME} 2>/dev/null echo 2>/dev/null ${HOME} 2>/dev/null
+	then cd 'quoted text' --verbose readonly /usr/bin
+	printf cd local local /usr/bin echo | 'quoted text'
+		grep echo -eu 2>/dev/null -eu export ${HOME} x=1 'quoted text' -eu test grep
+	export && cd $(pwd) "$@" grep awk | export
+		/usr/bin 2>/dev/null printf ${HOME} then && printf 'quoted text'
+awk sed done cd readonly 2>/dev/null
+$(pwd) echo x=1 test 'quoted text' &&
+awk "$1" echo local cd x=1 readonly "$@" "$1" 2>/dev/null
+		printf 'quoted text' 2>/dev/null -eu cd 'quoted text' "$@" export done
+		done "$@" cd local x=1 "$@" --verbose
+	'quoted text' $(pwd) readonly --verbose cd 2>/dev/null
+	/usr/bin 'quoted text' -eu echo printf
+	'quoted text' cd x=1 sed grep
+	test export local | && 2>/dev/null ${HOME} then ${HOME} "$@" done x=1
+	${HOME} 2>/dev/null | printf 2>/dev/null echo sed
+2>/dev/null export | readonly grep && echo --verbose 2>/dev/null 2>/dev/null
+	"$1" readonly | then cd && --verbose
+	x=1 "$1" && readonly done cd local 'quoted text'
+	cd /usr/bin local -eu readonly 'quoted text' /usr/bin printf
+		cd $(pwd) then echo sed grep x=1 /usr/bin done && printf sed
+	cd sed local echo printf sed cd /usr/bin /usr/bin grep test done sed
+'quoted text' echo && export done test readonly local
+	x=1 "$1" | --verbose cd ${HOME}
+then ${HOME} 2>/dev/null printf awk echo x=1 readonly done 2>/dev/null cd printf
+awk local grep local
+		'quoted text' local | echo cd /usr/bin "$1"
+x=1 export sed | done awk "$@" done | | x=1 printf 'quoted text'
+--verbose export -eu cd echo 'quoted text' sed awk
+-eu grep x=1 awk x=1 grep echo sed |
+		echo export $(pwd) cd ${HOME}
+readonly local cd local --verbose
+		--verbose export test awk 'quoted text'
+		awk awk sed x=1 done && && awk
+		awk ${HOME} && "$@" local export
+	| | 2>/dev/null test 'quoted text' printf --verbose "$1" && "$1" echo grep
+'quoted text' "$1" 2>/dev/null
+		done "$1" 2>/dev/null grep local awk "$1" && 'quoted text' -eu
+		echo done "$1" && /usr/bin 'quoted text'
+echo -eu local local 'quoted text' done readonly echo done
+		local /usr/bin grep 2>/dev/null 'quoted text' /usr/bin "$@" test -eu
+	2>/dev/null -eu readonly $(pwd) grep && cd -eu | printf $(pwd)
+		2>/dev/null test grep | done local | -eu test ${HOME} "$1" test cd awk
+awk ${HOME} then 2>/dev/null
+	sed cd cd grep sed echo grep 2>/dev/null export
+| $(pwd) grep --verbose readonly
+x=1 | /usr/bin --verbose /usr/bin
+echo cd grep echo 'quoted text' echo test awk readonly
+		${HOME} -eu local ${HOME} test then readonly 'quoted text' x=1 "$1" "$@"
+--verbose ${HOME} readonly /usr/bin
+	cd 2>/dev/null "$1" awk done 2>/dev/null $(pwd)
+	then 'quoted text' test
+	${HOME} readonly $(pwd) done awk "$1" readonly "$1" ${HOME} grep test
+		echo && cd readonly export "$1" | printf readonly
+		done 'quoted text' --verbose x=1 "$1" cd echo echo && "$1" "$@"
+	test 2>/dev/null ${HOME} /usr/bin sed 2>/dev/null -eu
+	| --verbose sed /usr/bin -eu export 2>/dev/null && readonly
+	cd x=1 test awk x=1 readonly grep 'quoted text'
+	x=1 | echo sed export export test
+		| readonly && then 'quoted text' test "$@" $(pwd) 'quoted text'
+2>/dev/null printf test export &&
+		${HOME} 2>/dev/null awk grep 2>/dev/null $(pwd) then
+		"$1" "$@" $(pwd) awk x=1 echo grep grep x=1 export export test /usr/bin "$@"
+		2>/dev/null sed cd ${HOME} x=1
+test grep awk then ${HOME} "$@" export done -eu echo then cd 'quoted text'
+		export printf "$1" ${HOME} awk | | cd echo "$1" readonly grep echo && echo
+		$(pwd) done readonly printf -eu && readonly "$@" readonly
+		/usr/bin "$1" awk -eu done | printf 2>/dev/null
+		'quoted text' local x=1 then done 'quoted text' "$1" 'quoted text'
+		"$@" test then 'quoted text' sed -eu local 'quoted text' echo -eu cd grep
+echo sed "$@" export $(pwd) --verbose export 2>/dev/null --verbose
+test | cd -eu 'quoted text' ${HOME} then grep export "$1" |
+		readonly sed printf -eu readonly "$@" local --verbose done local local sed ${HOME}
+		${HOME} "$@" | /usr/bin -eu grep 'quoted text'
+test readonly cd awk then readonly 'quoted text'
+"$1" readonly x=1 export echo readonly local export printf "$1" cd /usr/bin
+/usr/bin test -eu sed | echo && cd $(pwd) then echo ${HOME} printf &&
+local local "$@" readonly
+then grep 'quoted text' ${HOME} | --verbose
+		test /usr/bin printf grep && "$1" grep $(pwd) readonly && ${HOME} awk ${HOME} ${HOME}
+sed /usr/bin -eu sed then grep -eu readonly "$@" --verbose
+		printf -eu echo sed && test
+	grep "$1" $(pwd) "$@" ${HOME} cd printf
+	| readonly x=1 readonly 2>/dev/null then echo "$1" export test 'quoted text'
+test /usr/bin x=1 /usr/bin | ${HOME} 2>/dev/null
+grep local grep /usr/bin "$@" --verbose /usr/bin "$@"
+sed --verbose --verbose --verbose
+		readonly done cd $(pwd) && awk "$1" cd 'quoted text' --verbose
+	2>/dev/null "$@" "$@" readonly
+	test && $(pwd) readonly && then 2>/dev/null cd 2>/dev/null test "$@"
+x=1 local then export && /usr/bin && "$@"
+test x=1 echo local export test && cd awk echo ${HOME} && grep | readonly
+		printf done local local awk grep 2>/dev/null
+	2>/dev/null awk export "$@" /usr/bin x=1 cd 2>/dev/null
+"$@" 2>/dev/null then then /usr/bin
+| "$1" -eu local test echo local "$@" -eu "$@"
+	test "$1" | cd /usr/bin ${HOME} ${HOME} grep /usr/bin echo readonly
+"$1" $(pwd) sed sed "$1" -eu cd -eu ${HOME} $(pwd) "$1" sed 'quoted text'
+		awk grep x=1 'quoted text' done && export
+	x=1 -eu "$1" done local awk 2>/dev/null -eu then echo --verbose sed 'quoted text'
+		cd then ${HOME} "$@" grep x=1 | then /usr/bin
+		| then readonly /usr/bin && --verbose done done printf local readonly
+	awk && test grep 'quoted text' cd 'quoted text' done grep readonly test cd && |
+	test /usr/bin x=1 'quoted text' readonly printf
+	readonly "$@" awk done ${HOME} then "$@"
+$(pwd) printf -eu "$1" test x=1 'quoted text' local cd /usr/bin ${HOME} sed done
+${HOME} done | done printf echo "$@" /usr/bin /usr/bin
+	done export then readonly local cd export x=1 printf
+"$1" x=1 -eu sed "$1" readonly --verbose readonly
+		awk ${HOME} "$1" done awk echo "$1" local 2>/dev/null local
+printf && test readonly
+		${HOME} x=1 -eu awk 2>/dev/null printf /usr/bin | test awk awk 'quoted text' "$@"
+	grep sed --verbose sed awk ${HOME} "$@" "$1" export export x=1
+		| -eu -eu "$1" x=1 local | --verbose grep $(pwd)
+sed 'quoted text' && | local
+x=1 "$@" x=1 then printf x=1 then /usr/bin readonly
+	cd done sed test echo x=1 x=1 cd printf test then x=1 done 2>/dev/null test
+		done $(pwd) 'quoted text' | 2>/dev/null readonly $(pwd) awk
+2>/dev/null grep x=1 awk | cd test grep
+		readonly /usr/bin readonly readonly cd test then awk | test test
+	printf printf "$1" awk "$1"
+		sed -eu "$1" sed /usr/bin x=1 | "$1"
+	--verbose printf 2>/dev/null readonly ${HOME} 2>/dev/null awk
+	export sed done | "$@" then printf 'quoted text' ${HOME} &&
+x=1 cd grep cd local 2>/dev/null grep sed && "$1"
+	2>/dev/null printf 2>/dev/null /usr/bin | 'quoted text' ${HOME}
+		cd $(pwd) readonly then $(pwd) x=1 echo test awk --verbose x=1
+	${HOME} sed echo x=1 --verbose "$@" ${HOME} then -eu
+		export awk $(pwd) ${HOME} -eu /usr/bin "$1" x=1 ${HOME} export -eu done -eu
+| 2>/dev/null ${HOME} -eu 2>/dev/null
+$(pwd) awk printf $(pwd) /usr/bin export awk x=1 2>/dev/null
+		"$1" local && && 2>/dev/null && --verbose readonly local --verbose
+	then ${HOME} awk readonly readonly && /usr/bin /usr/bin 2>/dev/null
+	'quoted text' 2>/dev/null "$1" 2>/dev/null awk "$1" export grep then printf
+	printf --verbose awk "$@"
+export export 'quoted text' "$1" 2>/dev/null local -eu 'quoted text'
+		x=1 cd "$1" x=1 export | awk readonly
+readonly x=1 done $(pwd) done awk cd test test "$@" sed test printf -eu ${HOME}
+		cd then readonly $(pwd) export test test "$1" grep ${HOME} echo grep | echo
+	/usr/bin 'quoted text' "$@" --verbose echo 'quoted text'
+		done sed printf /usr/bin done export --verbose test readonly export printf
+	x=1 2>/dev/null ${HOME} cd awk /usr/bin printf
+	readonly 'quoted text' "$@" 'quoted text' --verbose $(pwd) x=1 local
+$(pwd) x=1 export -eu ${HOME}
+		local test -eu readonly && 'quoted text' echo done echo test then
+		readonly readonly printf sed test then then 2>/dev/null $(pwd) printf
+"$@" then ${HOME} $(pwd) && --verbose && "$1"
+		"$1" 2>/dev/null && sed readonly "$1" 2>/dev/null grep
+	"$1" -eu test "$1" readonly -eu --verbose /usr/bin
+	&& 'quoted text' ${HOME} --verbose 'quoted text' &&
+		done local test local && awk
+&& | then $(pwd) echo "$1" $(pwd) --verbose cd ${HOME} ${HOME} then
+grep ${HOME} export then /usr/bin grep "$@" cd grep test $(pwd) local done
+printf ${HOME} local grep echo /usr/bin grep done echo $(pwd)
+	-eu grep then local sed sed then && ${HOME} && sed sed
+		x=1 readonly "$@" echo local awk -eu 2>/dev/null sed then 2>/dev/null readonly
+	sed cd export echo awk /usr/bin -eu | x=1
+		test sed && -eu readonly | then x=1 && "$@" ${HOME}
+	test --verbose -eu printf local local 2>/dev/null /usr/bin echo
+	test printf then done cd
+		readonly grep ${HOME} done && "$@"
+	export -eu export "$@" awk "$@" export ${HOME} grep then 2>/dev/null -eu then
+${HOME} /usr/bin readonly grep awk "$1" 'quoted text'
+	| cd 2>/dev/null test ${HOME} sed done then test echo -eu
+		test local /usr/bin ${HOME} $(pwd) test export awk 2>/dev/null
+2>/dev/null 2>/dev/null && 2>/dev/null
+grep $(pwd) grep grep -eu
+awk echo cd then "$1" echo /usr/bin
+x=1 $(pwd) test --verbose $(pwd) readonly
+${HOME} | | readonly test 2>/dev/null --verbose
+		local $(pwd) then export printf 'quoted text' && | x=1 echo
+printf echo sed /usr/bin awk sed -eu "$@" $(pwd) && awk 'quoted text'
+sed done cd /usr/bin | "$@" test cd 'quoted text'
+	cd "$1" | grep --verbose 2>/dev/null cd "$@" && then "$1" test done --verbose
+		&& grep 2>/dev/null local $(pwd) printf "$@"
+	--verbose then ${HOME} ${HOME} printf echo $(pwd) | 'quoted text'
+	$(pwd) | echo x=1 "$1" printf done 'quoted text' | then "$1" --verbose
+	sed then export 'quoted text'
+x=1 sed done printf readonly
+"$@" && grep "$@" local
+		export then 2>/dev/null x=1 $(pwd) cd /usr/bin /usr/bin done && readonly |
+		'quoted text' sed --verbose grep ${HOME} | export
+		done awk sed readonly printf "$@" done echo | $(pwd)
+-eu 2>/dev/null "$1" && test --verbose
+		"$1" local readonly "$@" awk --verbose
+	grep "$1" | echo $(pwd) ${HOME} echo sed grep grep
+$(pwd) | 'quoted text' grep local /usr/bin 2>/dev/null 'quoted text'
+	${HOME} awk sed 'quoted text' readonly ${HOME} "$@" export cd
+		x=1 -eu ${HOME} cd /usr/bin
+		| 'quoted text' done export 'quoted text'
+echo export 2>/dev/null then echo done
+	awk x=1 local "$1" $(pwd)
+		--verbose -eu printf printf export "$@" $(pwd) printf 'quoted text' readonly /usr/bin
+	test done readonly printf 2>/dev/null $(pwd)
+		&& awk $(pwd) x=1 x=1 cd cd sed 'quoted text' export | awk
+x=1 -eu export export 2>/dev/null
+'quoted text' readonly && "$@" -eu 'quoted text' local 2>/dev/null local local
+"$@" sed grep -eu | 'quoted text' grep && local
+	${HOME} done sed -eu then local --verbose sed
+	echo local x=1 awk $(pwd) 'quoted text' 2>/dev/null echo
+echo 'quoted text' 'quoted text' printf then /usr/bin cd
+	then $(pwd) test printf x=1 cd awk test cd grep
+		test -eu echo awk done awk
+		&& "$1" awk local done grep "$@" test then x=1 'quoted text'
+		readonly && local 2>/dev/null -eu ${HOME} cd awk done x=1 cd sed then && "$1"
+	awk 2>/dev/null --verbose cd echo 'quoted text' ${HOME}
+		${HOME} awk then cd /usr/bin "$1" done --verbose "$1" readonly local
+		grep done readonly "$1" 2>/dev/null "$@" local awk export cd
+		sed "$1" then done printf done -eu sed cd readonly ${HOME} | echo readonly
+	awk done readonly x=1 'quoted text' "$@" | test printf /usr/bin --verbose grep
+local grep 2>/dev/null --verbose 2>/dev/null
+	export 2>/dev/null readonly awk --verbose readonly then test echo /usr/bin
+		awk awk /usr/bin $(pwd) awk "$@" cd | x=1
+done sed x=1 test x=1 && x=1 && && "$1" /usr/bin printf 'quoted text'
+		2>/dev/null readonly cd done 'quoted text'
+		/usr/bin printf 'quoted text' cd | echo ${HOME}
+"$1" grep readonly 'quoted text' "$@" 2>/dev/null awk test sed | grep grep x=1
+echo printf cd "$1" && && "$1" $(pwd) test 'quoted text' x=1 /usr/bin
+		&& export && test done x=1 sed -eu 'quoted text'
+awk ${HOME} 2>/dev/null /usr/bin && "$@" export 2>/dev/null
+-eu done /usr/bin -eu "$1" readonly readonly awk && $(pwd) test $(pwd)
+echo x=1 cd && cd "$@" ${HOME} echo readonly
+2>/dev/null test awk "$1" 'quoted text' -eu "$@" then local export
+	$(pwd) $(pwd) "$@" grep "$1" && done --verbose test done $(pwd) | "$@"
+$(pwd) "$1" done -eu /usr/bin printf "$@" x=1 cd ${HOME} ${HOME}
+then "$1" grep ${HOME} -eu test -eu done local
+done "$1" local /usr/bin ${HOME} readonly /usr/bin $(pwd) 2>/dev/null /usr/bin
+export /usr/bin printf grep "$1" printf cd "$@" x=1 "$1" then echo grep "$1"
+awk && "$1" 'quoted text'
+		echo -eu awk readonly 2>/dev/null cd ${HOME} "$1" done local | $(pwd)
+		'quoted text' echo sed 'quoted text' ${HOME} local $(pwd)
+		printf test && cd --verbose test
+	/usr/bin printf done "$1" 'quoted text' cd x=1 test 2>/dev/null 'quoted text'
+test grep "$@" "$@" --verbose "$1" grep "$1" "$@" grep printf
+		"$1" "$@" -eu "$1" local ${HOME} test && grep x=1 --verbose "$@" && "$@"
+	"$@" cd test awk 'quoted text' /usr/bin 'quoted text' | 2>/dev/null
+'quoted text' readonly echo awk --verbose printf | ${HOME} done
+	then $(pwd) local "$1" cd "$1" sed "$@" "$1" ${HOME} printf sed && $(pwd) /usr/bin
+	echo test test "$1" cd export printf echo --verbose printf cd sed grep
+	"$@" done sed then echo ${HOME} sed grep awk --verbose echo "$@" 'quoted text'
+	/usr/bin echo sed awk /usr/bin $(pwd) sed awk cd | sed printf awk -eu 'quoted text'
+		readonly "$@" /usr/bin
+	/usr/bin then | test "$1" sed grep
+		readonly 2>/dev/null /usr/bin -eu 2>/dev/null "$1" $(pwd) echo
+/usr/bin done --verbose printf export "$1" "$1" readonly echo
+	&& -eu cd "$@" then 'quoted text' && --verbose -eu awk done 2>/dev/null
+export "$@" --verbose x=1 cd $(pwd)
+	printf 2>/dev/null 'quoted text' 'quoted text' echo -eu && cd | 'quoted text'
+		echo grep readonly echo printf 'quoted text' "$1" --verbose test echo
+	${HOME} "$@" --verbose done echo | && readonly then $(pwd) local grep
+test $(pwd) /usr/bin local -eu ${HOME} awk
+	test awk 2>/dev/null | && cd grep echo done
+/usr/bin printf test "$@" 2>/dev/null
+local 2>/dev/null ${HOME} test echo ${HOME} export echo /usr/bin /usr/bin
+	"$@" awk sed local grep cd "$1" test
+		printf then -eu echo echo --verbose
+		then readonly ${HOME} printf 'quoted text' export 2>/dev/null then then sed
+		$(pwd) "$@" export | "$1" echo
+| then test /usr/bin x=1 'quoted text' "$1" ${HOME}
+	local cd echo -eu x=1 test export printf printf 'quoted text' readonly awk &&
+	grep printf 'quoted text' test local 'quoted text' awk
+	x=1 | local done | "$1" done
+		$(pwd) cd readonly done --verbose export export then "$@"
+'quoted text' awk x=1 local done
+"$1" 2>/dev/null 2>/dev/null
+		&& --verbose test "$1" done /usr/bin /usr/bin export grep --verbose 'quoted text'
+'quoted text' 2>/dev/null x=1 $(pwd) 2>/dev/null
+		readonly 'quoted text' test printf echo /usr/bin
+grep 'quoted text' cd $(pwd) | ${HOME} echo awk
+	export --verbose printf
+'quoted text' sed --verbose grep $(pwd) cd test then
+echo 2>/dev/null ${HOME} "$@"
+	sed --verbose then && --verbose
+test x=1 sed 2>/dev/null /usr/bin 'quoted text' ${HOME} awk test grep
+	"$1" "$@" test printf -eu -eu x=1 cd ${HOME} ${HOME} awk grep
+		test sed --verbose ${HOME} then "$1" -eu local 2>/dev/null 2>/dev/null "$@" cd
+&& then local $(pwd)
+		readonly export test printf
+	cd cd x=1 $(pwd) export printf ${HOME} ${HOME}
+local && "$1" 'quoted text' local local grep then
+		$(pwd) readonly readonly
+		grep then then 2>/dev/null /usr/bin /usr/bin local
+"$@" "$@" local then "$@" awk 'quoted text' -eu x=1 "$@" 'quoted text'
+	x=1 printf grep done x=1 export x=1 --verbose awk 'quoted text' "$@" --verbose
+		'quoted text' grep "$1" | x=1 ${HOME} x=1
+	| /usr/bin export test -eu 'quoted text'
+		2>/dev/null 'quoted text' grep
+echo -eu export local awk "$1" then done local readonly && echo --verbose then
+awk awk --verbose x=1 "$1" ${HOME} /usr/bin echo | x=1 then done cd -eu
+	sed 2>/dev/null then export sed cd grep $(pwd) x=1 test "$@" "$@"
+		grep echo cd 2>/dev/null -eu test then && x=1 /usr/bin ${HOME} readonly
+		/usr/bin "$1" && readonly grep
+/usr/bin $(pwd) --verbose
+	grep then | cd | -eu | done "$@" done --verbose grep
+	-eu done then 'quoted text' cd $(pwd) export printf readonly
+"$@" export --verbose -eu readonly "$1" readonly $(pwd) grep awk
+		"$1" done "$1" "$1" cd && && grep test done
+grep && cd 'quoted text' test ${HOME}
+		grep export cd "$@" $(pwd)
+	-eu --verbose "$@" export x=1 sed export $(pwd) sed --verbose grep
+	printf "$@" ${HOME} grep sed x=1 $(pwd) then
+		--verbose --verbose $(pwd)
+${HOME} --verbose "$1" cd /usr/bin grep -eu x=1 sed printf | sed ${HOME}
+awk test local then && && && "$1" 'quoted text' --verbose
+-eu sed "$1" ${HOME} test /usr/bin echo /usr/bin printf /usr/bin -eu /usr/bin
+	x=1 export printf /usr/bin readonly
+		awk -eu "$1" 2>/dev/null local | readonly -eu echo export echo /usr/bin echo
+	then ${HOME} --verbose local cd 2>/dev/null --verbose readonly x=1 export
+		done test grep then sed x=1
+		sed --verbose echo done ${HOME} done "$1" --verbose done local printf && "$@" printf
+printf test 2>/dev/null 2>/dev/null grep readonly printf
+&& /usr/bin ${HOME} 'quoted text' "$1" /usr/bin
+export -eu && ${HOME} 2>/dev/null
+	printf echo x=1 cd test && | 2>/dev/null then $(pwd) 2>/dev/null
+	then -eu echo cd readonly "$@" sed cd
+echo 2>/dev/null local "$1" done |
+	awk sed grep done -eu --verbose ${HOME}
+		| | then awk $(pwd) "$1" printf test grep cd readonly
+	echo printf readonly export cd | "$@" ${HOME} ${HOME} $(pwd) export "$@"
+cd awk 2>/dev/null "$@" done | /usr/bin
+test "$@" sed echo echo sed echo 'quoted text' -eu test x=1 /usr/bin cd -eu printf
+	2>/dev/null cd echo printf -eu export "$1" 2>/dev/null "$@" x=1
+	-eu --verbose /usr/bin -eu echo test 'quoted text' printf
+		'quoted text' 'quoted text' grep | x=1 local
+-eu grep $(pwd) local | --verbose 2>/dev/null
+	readonly "$@" sed echo 'quoted text' then -eu test ${HOME} awk readonly 'quoted text'
+		readonly $(pwd) --verbose 'quoted text' grep local
+		printf export x=1 "$@" $(pwd) printf x=1
+--verbose "$1" test "$1" --verbose "$1" ${HOME} then 2>/dev/null
+		'quoted text' awk done "$@" | grep export "$@" -eu | grep
+	"$1" sed "$1" export /usr/bin /usr/bin 2>/dev/null export "$1" echo
+local printf export grep ${HOME} && printf local 'quoted text' printf 2>/dev/null
+&& printf then local && "$1" ${HOME}
+		done printf "$1" awk x=1 printf then echo
+		test awk /usr/bin --verbose readonly export grep
+		--verbose -eu /usr/bin x=1 'quoted text' | $(pwd) "$@" /usr/bin
+		'quoted text' echo done x=1 cd "$1" -eu $(pwd) cd local export |
+	sed readonly sed | | --verbose test 'quoted text' test /usr/bin | printf cd --verbose
+		readonly && sed 2>/dev/null done 2>/dev/null export ${HOME}
+done printf -eu echo grep sed then ${HOME} | then then echo printf /usr/bin echo
+	2>/dev/null x=1 local printf --verbose awk |
+		/usr/bin cd grep export --verbose local -eu
+	'quoted text' /usr/bin "$1" cd /usr/bin
+"$@" cd x=1 readonly then readonly
+&& printf done then 'quoted text' local
+		echo echo | awk ${HOME} ${HOME} cd "$@" export --verbose
+	&& 2>/dev/null && --verbose && echo echo && $(pwd) test grep grep readonly
+		cd && ${HOME} readonly x=1 'quoted text' "$@"
+		'quoted text' echo readonly "$@"
+cd grep "$1" grep local && echo local grep ${HOME}
+		done then "$1" | local done grep cd "$@" local sed | && --verbose
+		cd "$1" 2>/dev/null printf grep printf
+		2>/dev/null /usr/bin 'quoted text'
+		x=1 cd "$1" | export awk cd ${HOME} "$@" then echo -eu export printf x=1
+	sed cd export cd ${HOME} readonly | export $(pwd) printf 'quoted text' /usr/bin
+	| cd "$1" readonly awk then 'quoted text' readonly $(pwd) "$@" sed echo
+		"$@" $(pwd) cd readonly x=1 echo awk
+		| -eu "$1" /usr/bin "$@" done cd echo local "$1" printf
+&& $(pwd) readonly done x=1 cd
+printf 'quoted text' then awk x=1 ${HOME} awk $(pwd) 'quoted text'
+2>/dev/null | x=1 local /usr/bin local then 'quoted text' printf
+"$1" x=1 export x=1 --verbose
+	| ${HOME} grep then export 2>/dev/null sed readonly
+	'quoted text' | sed local awk ${HOME} --verbose
+	test done export x=1 done --verbose
+"$1" then local grep readonly && awk && printf test done -eu "$@"
+		local $(pwd) done local echo 'quoted text' awk 'quoted text' && test "$@"
+2>/dev/null "$1" done readonly 'quoted text' -eu awk
+printf done done -eu echo "$@" grep
+	$(pwd) 'quoted text' then ${HOME} -eu -eu readonly echo
+	--verbose ${HOME} printf echo "$1"
+&& "$1" done then 'quoted text' x=1 && x=1 awk then
+"$@" local done cd awk 'quoted text' && test 'quoted text'
+	printf done echo awk "$1" printf --verbose ${HOME} readonly
+	/usr/bin then cd then 2>/dev/null
+	${HOME} test printf "$@" ${HOME} 2>/dev/null export /usr/bin
+		-eu readonly sed && then && 'quoted text' x=1 | && done
+readonly --verbose "$1" $(pwd) local 2>/dev/null 'quoted text' local
+		--verbose 'quoted text' local local export
+		'quoted text' 'quoted text' --verbose | then "$1" x=1 "$@" 2>/dev/null
+		"$1" x=1 && -eu sed 'quoted text' ${HOME} --verbose
+		${HOME} 2>/dev/null 'quoted text' sed | printf
+		test echo grep test printf && readonly
+done test 'quoted text' --verbose awk "$1" "$1" 2>/dev/null
+		echo --verbose echo /usr/bin then
+cd sed /usr/bin echo $(pwd) local "$@" && --verbose $(pwd)
+	"$1" grep export && && printf -eu then "$1" export sed export ${HOME}
+cd done export /usr/bin awk 2>/dev/null echo awk readonly | --verbose
+	2>/dev/null then $(pwd) "$1" 2>/dev/null
+	2>/dev/null readonly x=1
+		echo /usr/bin /usr/bin sed "$@" done
+		--verbose cd --verbose 2>/dev/null x=1 --verbose ${HOME}
+"$@" printf "$@" local then export done echo /usr/bin test && printf "$@" export
+"$@" "$@" test ${HOME} done $(pwd) ${HOME} 2>/dev/null export
+&& sed sed "$@" x=1 ${HOME}
+		$(pwd) x=1 $(pwd) 'quoted text' ${HOME} awk && --verbose then
+then --verbose 'quoted text' done 2>/dev/null "$@" /usr/bin
+	${HOME} 'quoted text' local /usr/bin done | x=1 awk | local export
+2>/dev/null awk "$1" grep cd x=1 $(pwd) grep /usr/bin x=1 export sed
+awk test grep -eu 2>/dev/null 'quoted text' "$@" test done
+		"$1" readonly sed test && $(pwd) x=1 && --verbose local grep $(pwd) printf readonly
+done && grep && --verbose /usr/bin x=1 grep "$@" x=1 echo cd 'quoted text' cd printf
+	cd export printf --verbose $(pwd) awk test "$@" --verbose "$@"
+--verbose 2>/dev/null awk 'quoted text' 'quoted text'
+		then 'quoted text' 'quoted text' 'quoted text'
+	/usr/bin done "$1" && | cd then "$1" | awk awk readonly "$@" 'quoted text' 2>/dev/null
+		${HOME} 'quoted text' | -eu --verbose
+	--verbose local /usr/bin "$@"
+then echo ${HOME} echo cd /usr/bin $(pwd) "$@" export 2>/dev/null awk $(pwd)
+		readonly cd ${HOME} 'quoted text' "$1" readonly --verbose
+		| 2>/dev/null && 2>/dev/null -eu 2>/dev/null grep export
+	--verbose sed x=1 && export $(pwd) && export "$@" cd "$@"
+	cd awk "$1" done $(pwd) x=1 --verbose local /usr/bin done
+	printf 2>/dev/null printf --verbose
+		'quoted text' test cd "$1" ${HOME} cd then --verbose cd | then
+		readonly x=1 grep done
+		done 2>/dev/null 'quoted text'
+		local export export $(pwd) awk && /usr/bin cd readonly
+| done then "$1" x=1 x=1 test $(pwd) export /usr/bin "$1" x=1 sed done
+--verbose 'quoted text' "$@" export ${HOME} "$1" cd sed then sed test sed
+	then done ${HOME} cd $(pwd) $(pwd)
+		export readonly --verbose done export
+		grep ${HOME} --verbose awk
+	done -eu printf then printf ${HOME} "$1"
+		--verbose readonly local && echo x=1
+	--verbose awk ${HOME} printf printf $(pwd) readonly local $(pwd) export echo export
+		${HOME} awk -eu sed done echo | done printf then 2>/dev/null then |
+sed -eu /usr/bin cd then x=1 'quoted text' cd ${HOME} &&
+		&& then awk ${HOME} test 'quoted text' --verbose cd sed 2>/dev/null $(pwd)
+	grep && ${HOME} grep "$@" && | cd done -eu -eu then awk -eu printf test "$@"
+		${HOME} && x=1 sed x=1 echo "$1" grep awk awk readonly 2>/dev/null
+		-eu -eu test /usr/bin "$@" grep "$1" echo awk local done echo cd | -eu test | then
+	cd $(pwd) x=1 local x=1
+		"$1" 2>/dev/null && 2>/dev/null then printf
+${HOME} $(pwd) grep sed /usr/bin done local test export 2>/dev/null
+		${HOME} /usr/bin awk && cd grep /usr/bin
+export echo && sed -eu 'quoted text' echo 2>/dev/null then
+	--verbose $(pwd) then echo
+	--verbose grep awk | awk /usr/bin then sed done && | export local
+		$(pwd) --verbose -eu done echo --verbose
+	2>/dev/null --verbose /usr/bin 'quoted text'
+	printf grep | grep cd awk test --verbose "$1" echo --verbose 'quoted text' cd
+		&& awk then readonly 'quoted text'
+		"$1" printf readonly "$1" | readonly -eu then then then
+echo test && --verbose 2>/dev/null && done
+		grep echo local $(pwd) "$@" | "$1" cd x=1 export readonly "$1" "$@"
+		done 2>/dev/null echo grep then done x=1 echo 'quoted text'
+		/usr/bin --verbose done then echo export test /usr/bin awk
+	local grep x=1 export then done x=1 done 2>/dev/null cd readonly
+readonly cd -eu -eu && -eu
+"$@" | x=1 $(pwd) sed 2>/dev/null export cd test "$@" --verbose
+	/usr/bin done awk sed printf &&
+	grep test x=1 | cd "$1" echo echo
+--verbose awk sed test ${HOME} "$1" | awk export 'quoted text' --verbose awk
+/usr/bin local printf echo | done --verbose /usr/bin ${HOME}
+test x=1 echo x=1 test printf then -eu x=1
+--verbose && sed printf x=1 'quoted text' 'quoted text'
+		"$1" cd 2>/dev/null done printf done printf /usr/bin then then /usr/bin cd
+		echo && "$1" ${HOME} sed
+		cd -eu sed cd $(pwd) local awk | readonly local "$@" $(pwd)
+	export awk readonly grep grep
+"$1" "$@" -eu 2>/dev/null ${HOME} test export
+test grep test "$@" "$@" /usr/bin
+'quoted text' awk sed -eu then
+	x=1 "$@" 2>/dev/null
+		then cd /usr/bin /usr/bin 'quoted text' printf awk cd ${HOME}
+		| echo /usr/bin -eu then "$1" then echo "$1"
+		-eu local $(pwd) 2>/dev/null export && 2>/dev/null test printf cd ${HOME}
+		'quoted text' x=1 2>/dev/null export --verbose 'quoted text' &&
+${HOME} "$@" echo echo then -eu 'quoted text' 2>/dev/null 2>/dev/null export
+cd local echo done && "$1" $(pwd) 'quoted text'
+	local grep readonly x=1 ${HOME}
+		test done -eu ${HOME} awk
+		&& $(pwd) done $(pwd) -eu export ${HOME} sed --verbose done test x=1 printf then
+local --verbose echo /usr/bin awk export 2>/dev/null &&
+		'quoted text' x=1 cd "$@" ${HOME} "$1" awk 2>/dev/null echo
+	test grep grep | /usr/bin
+${HOME} cd local readonly $(pwd) export sed $(pwd)
+		export "$1" cd echo cd cd test "$@" --verbose /usr/bin test readonly
+	"$@" export cd "$1" readonly -eu x=1 export -eu done sed 'quoted text'
+"$@" awk grep -eu cd 2>/dev/null awk awk sed
+	${HOME} grep 2>/dev/null $(pwd) | printf printf "$1" | echo "$@" | cd x=1 readonly
+		echo --verbose cd ${HOME}
+"$@" --verbose 2>/dev/null "$1" echo export $(pwd)
+sed echo "$1" test awk sed $(pwd) 2>/dev/null --verbose 'quoted text'
+test "$1" sed readonly grep export x=1 test $(pwd) "$1"
+/usr/bin "$1" x=1 2>/dev/null
+sed ${HOME} x=1 -eu grep --verbose cd cd test 2>/dev/null 2>/dev/null
+	local ${HOME} then 'quoted text' && export ${HOME}
+		done | echo ${HOME} readonly 2>/dev/null cd && grep
+${HOME} $(pwd) then ${HOME} export $(pwd) test
+sed awk cd && sed echo "$@"
+--verbose readonly export test --verbose then printf
+		"$1" | readonly done x=1 readonly local
+	"$1" /usr/bin "$1" /usr/bin local -eu && cd then export "$1"
+/usr/bin sed $(pwd) readonly x=1 "$@" export -eu readonly ${HOME}
+"$1" --verbose grep then printf -eu 'quoted text' x=1 export test /usr/bin
+-eu /usr/bin awk grep x=1 printf done awk then local cd x=1 -eu x=1
+printf grep grep | done $(pwd) sed then echo echo test local "$1" x=1 'quoted text'
+	${HOME} | | then local grep ${HOME}
+		then grep grep ${HOME} 2>/dev/null export "$@" cd done /usr/bin ${HOME} export
+		"$@" --verbose "$@" && readonly grep $(pwd) readonly cd
+		echo --verbose x=1 local
+		then cd /usr/bin | | sed -eu ${HOME}
+	test then test "$1" local /usr/bin "$1" done
+		"$1" 'quoted text' sed "$@" then readonly &&
+		"$@" test then then local awk --verbose && export --verbose test awk test
+		"$1" test echo readonly cd "$@" awk x=1 "$1" "$1"
+-eu printf echo echo $(pwd) --verbose awk echo readonly | "$@" ${HOME} grep
+	2>/dev/null sed printf 'quoted text'
+test -eu 2>/dev/null 2>/dev/null test ${HOME} awk /usr/bin awk
+		local 2>/dev/null cd 'quoted text' x=1 done done done | test
+		"$@" local /usr/bin cd -eu /usr/bin local /usr/bin "$1" export then done readonly
+cd grep | cd "$1" x=1 | test ${HOME}
+		"$1" grep printf grep "$@" | echo --verbose 'quoted text'
+		$(pwd) sed && x=1 grep
+sed grep sed "$1" && done
+'quoted text' -eu "$1" then awk done
+		x=1 readonly echo /usr/bin then done export
+sed ${HOME} cd echo 2>/dev/null 'quoted text' awk x=1 readonly "$@" sed printf
+grep "$1" -eu --verbose 2>/dev/null then awk &&
+	"$1" /usr/bin done done printf test "$@" 2>/dev/null "$1" cd test echo awk
+	awk 'quoted text' done -eu 'quoted text' 'quoted text' --verbose ${HOME}
+test sed 'quoted text' echo local ${HOME} cd $(pwd) awk
+	echo done ${HOME} x=1 x=1 printf --verbose /usr/bin awk sed test
+	$(pwd) -eu grep "$1" "$@" then cd export cd
+2>/dev/null cd then -eu | done
+		test 2>/dev/null "$@" echo sed 'quoted text'
+	readonly /usr/bin then done grep ${HOME} $(pwd) readonly readonly export ${HOME}
+	sed readonly done x=1 'quoted text' cd $(pwd) 'quoted text' "$1"
+x=1 ${HOME} readonly "$1" echo done
+done --verbose grep /usr/bin cd done printf $(pwd)
+		/usr/bin 2>/dev/null -eu
+	awk done then && | "$1" $(pwd)
+		awk $(pwd) /usr/bin sed
+	awk local "$@" sed "$@" "$1" -eu local "$1" echo grep ${HOME}
+	| then --verbose x=1 ${HOME}
+		-eu $(pwd) 'quoted text' local echo readonly $(pwd) | printf "$1" $(pwd)
+		x=1 ${HOME} test x=1 /usr/bin ${HOME}
+2>/dev/null local printf
+	echo 'quoted text' | then export done -eu x=1 -eu sed
+		grep echo ${HOME} 'quoted text' 2>/dev/null "$@" $(pwd) sed
+		sed /usr/bin | ${HOME} | readonly $(pwd) --verbose grep test
+printf local 2>/dev/null $(pwd) 'quoted text' x=1 "$1" test grep "$1" $(pwd) export
+echo 'quoted text' && awk $(pwd) sed then done --verbose printf /usr/bin $(pwd)
+grep awk | sed 2>/dev/null
+x=1 | ${HOME} done grep "$1" --verbose $(pwd) echo $(pwd) done /usr/bin
+/usr/bin done readonly 2>/dev/null printf 2>/dev/null grep sed sed
+	"$@" local test sed cd ${HOME} grep
+		"$@" awk sed printf $(pwd) 'quoted text' readonly cd && && then
+		export /usr/bin local "$1" /usr/bin x=1 && /usr/bin local 2>/dev/null
+	$(pwd) grep printf awk $(pwd) "$@" test -eu
+	done echo | test "$1" printf $(pwd) grep &&
+	done 2>/dev/null local cd awk printf grep done export "$@"
+	echo test cd awk sed readonly sed | x=1 && 2>/dev/null export
+	/usr/bin readonly echo cd 2>/dev/null echo ${HOME} -eu local echo
+2>/dev/null sed 'quoted text' export printf "$@"
+readonly x=1 "$@" "$1" printf test --verbose x=1 local
+		done echo export local echo
+cd -eu 'quoted text' "$@" awk grep 2>/dev/null printf awk --verbose && x=1 $(pwd)
+/usr/bin "$@" then local awk then
+		$(pwd) -eu awk grep done 2>/dev/null done -eu readonly && local
+		$(pwd) "$@" local | 'quoted text' awk 'quoted text' then
+		| done test --verbose test export done | readonly then x=1
+	sed done then ${HOME} 2>/dev/null printf
+		${HOME} | 'quoted text' then local readonly 'quoted text' && 'quoted text'
+sed /usr/bin "$1" grep printf /usr/bin echo
+printf cd readonly echo && 'quoted text' done test /usr/bin cd grep 2>/dev/null
+	test cd --verbose "$1" then awk ${HOME} 'quoted text'
+then done && -eu then --verbose cd ${HOME} cd cd x=1 export then && "$@" && awk
+		cd 'quoted text' done --verbose local $(pwd) test | "$@" 'quoted text' 'quoted text'
+	export local test /usr/bin printf export 2>/dev/null --verbose
+	'quoted text' -eu x=1 awk grep
+echo printf echo x=1 2>/dev/null
+2>/dev/null echo export cd then && 2>/dev/null export local sed
+		${HOME} export $(pwd) test $(pwd) "$@" ${HOME} $(pwd)
+		readonly cd cd | "$1" "$@" x=1 $(pwd) && x=1 2>/dev/null sed 'quoted text'
+export $(pwd) printf done -eu test 'quoted text'
+		"$1" 'quoted text' echo readonly
+		test printf readonly export x=1 /usr/bin 2>/dev/null
+'quoted text' ${HOME} grep export sed sed readonly -eu readonly sed &&
+		2>/dev/null done then 'quoted text' --verbose cd grep | ${HOME} test sed -eu
+	printf then ${HOME} && "$@" echo x=1 $(pwd) printf
+-eu export then --verbose /usr/bin then readonly cd export
+--verbose export "$@" sed x=1 awk readonly test --verbose
+	printf export -eu awk x=1 grep test
+		x=1 local "$@" x=1 sed "$1" "$@" &&
+		echo grep local 2>/dev/null readonly sed done 2>/dev/null cd
+		readonly then /usr/bin readonly cd grep -eu && cd echo
+		/usr/bin test | /usr/bin local test export $(pwd) grep
+	printf "$1" ${HOME} x=1 x=1 sed then "$@" readonly 'quoted text'
+	echo --verbose echo /usr/bin && readonly printf | ${HOME} x=1 $(pwd) /usr/bin export
+		${HOME} "$1" readonly readonly grep 'quoted text' && $(pwd)
+		echo 2>/dev/null ${HOME} -eu local | export echo done cd
+cd printf done export local cd 'quoted text' $(pwd) --verbose done
+		done sed readonly then ${HOME} test local cd local x=1 -eu 2>/dev/null grep
+	x=1 && echo printf "$1" | /usr/bin && "$@" awk awk
+	$(pwd) ${HOME} -eu grep awk --verbose done $(pwd) then x=1 sed cd -eu local
+--verbose | cd 2>/dev/null && local x=1 sed done x=1 grep
+		&& --verbose test readonly local local awk | --verbose
+local x=1 test export readonly "$1" /usr/bin "$@" readonly export export
+--verbose then done "$1"
+	export echo "$@" done -eu export $(pwd) "$1"
+		sed export | $(pwd) | $(pwd) 2>/dev/null
+x=1 ${HOME} && "$1" "$@" | printf test -eu | sed sed ${HOME} ${HOME}
+"$@" ${HOME} && local echo && done | echo "$1" test test cd
+		local "$@" printf "$@" awk /usr/bin $(pwd) done
+cd -eu done then $(pwd) 2>/dev/null
+	${HOME} echo 'quoted text' --verbose grep | echo echo
+		'quoted text' export --verbose
+		"$1" local local | readonly export readonly awk &&
+		then ${HOME} 2>/dev/null --verbose -eu readonly local | x=1 cd
+echo test echo "$@" "$@"
+		local --verbose /usr/bin readonly sed readonly "$@" /usr/bin test done
+	'quoted text' 'quoted text' ${HOME} 'quoted text' ${HOME} $(pwd)
+		x=1 done x=1 printf cd then x=1 grep echo done sed -eu printf
+	| && "$@" "$1" $(pwd) sed /usr/bin
+local 2>/dev/null -eu printf 'quoted text' echo x=1
+		$(pwd) "$@" -eu ${HOME} done export
+echo "$@" --verbose cd
+	--verbose awk cd x=1 ${HOME}
+readonly --verbose | "$1" /usr/bin && sed $(pwd) cd "$@" | readonly "$1"
+cd local echo ${HOME} grep
+		/usr/bin printf $(pwd) then
+	readonly grep | echo export
+	test 2>/dev/null local printf 2>/dev/null export test printf "$1" "$1" awk
+x=1 /usr/bin $(pwd) ${HOME} sed -eu awk | awk 'quoted text' $(pwd) 2>/dev/null
+		sed awk readonly sed "$1" "$@" && | -eu 'quoted text' done --verbose printf x=1
+	"$@" x=1 echo local awk awk local
+	| | 2>/dev/null ${HOME} local cd && grep local awk "$1" --verbose
+		/usr/bin done export awk sed test grep ${HOME} "$@" echo /usr/bin 'quoted text'
+		then grep echo "$1" local echo --verbose -eu sed ${HOME} --verbose -eu x=1
+	-eu x=1 "$@" x=1 echo sed then && local export --verbose cd local && export
+	&& readonly sed 'quoted text' done --verbose readonly $(pwd) --verbose
+	sed export grep echo x=1 && printf -eu ${HOME} -eu
+	export 2>/dev/null test sed && grep --verbose -eu ${HOME}
+local export grep "$1" /usr/bin printf cd $(pwd) cd ${HOME} printf awk /usr/bin
+	echo local && grep printf then sed -eu 'quoted text' ${HOME} readonly
+/usr/bin printf x=1 awk cd 2>/dev/null test printf
+	"$@" grep awk done done awk 2>/dev/null x=1 done && grep "$@" local printf
+done awk sed x=1 /usr/bin $(pwd) ${HOME} ${HOME}
+	-eu 2>/dev/null 'quoted text' x=1 grep readonly
+		&& 'quoted text' grep local /usr/bin 'quoted text'
+local $(pwd) echo && echo printf --verbose echo cd -eu test
+grep 2>/dev/null "$@" echo readonly $(pwd) | 2>/dev/null --verbose -eu x=1
+		cd -eu test cd cd done -eu "$1" x=1 local
+x=1 awk grep then ${HOME} readonly "$1" done --verbose
+	| x=1 $(pwd) | x=1 && "$1" test 'quoted text' readonly -eu ${HOME}
+test --verbose cd x=1 sed ${HOME} | sed readonly
+		echo export echo 2>/dev/null sed 2>/dev/null then
+/usr/bin "$@" export -eu export "$1" readonly local
+		x=1 cd sed local awk --verbose test then
+	sed "$1" awk -eu | "$1" readonly then grep readonly
+		--verbose x=1 readonly x=1 grep sed then done cd export then test awk /usr/bin
+		export x=1 cd && echo local echo grep --verbose | "$@"
+then $(pwd) ${HOME} 'quoted text' cd "$1" $(pwd) sed readonly
+export local grep 2>/dev/null export 'quoted text'
+	printf ${HOME} "$@" "$1" local /usr/bin sed awk test grep 2>/dev/null sed ${HOME}
+done x=1 "$@" awk "$1" awk sed export
+"$1" printf echo export /usr/bin "$@" ${HOME}
+		then && && && $(pwd) /usr/bin && echo awk cd "$1"
+		readonly test --verbose grep cd | grep done $(pwd)
+	"$@" --verbose ${HOME} grep &&
+/usr/bin grep | readonly export done cd test 'quoted text'
+	"$@" "$@" "$@" --verbose 2>/dev/null -eu 2>/dev/null
+	export && $(pwd) "$1" awk sed then && sed cd readonly 'quoted text'
+	cd local "$@" 2>/dev/null cd "$1" /usr/bin $(pwd) done done | x=1 -eu "$@" awk /usr/bin
+| "$@" printf then export 'quoted text'
+--verbose x=1 sed grep -eu local /usr/bin readonly $(pwd) then "$@" "$@" test -eu
+sed "$@" --verbose local readonly $(pwd)
+		--verbose /usr/bin x=1 "$1" sed | --verbose
+test $(pwd) x=1 -eu local && cd -eu grep
+printf && sed awk awk --verbose
+		test 2>/dev/null -eu printf export grep done && readonly
+&& --verbose sed | "$1" printf echo readonly |
+	'quoted text' awk --verbose printf test ${HOME} $(pwd) local echo
+	echo | then echo export ${HOME} grep ${HOME}
+${HOME} export /usr/bin cd echo && awk readonly | 'quoted text' x=1 'quoted text'
+	done sed ${HOME} export $(pwd)
+		"$1" test 'quoted text' readonly x=1 awk awk "$1"
+/usr/bin echo awk export echo sed 'quoted text' | export x=1
+	'quoted text' sed readonly x=1 awk "$@" $(pwd) 'quoted text' ${HOME}
+	2>/dev/null | --verbose "$@" /usr/bin && |
+export echo "$1" 'quoted text' ${HOME} x=1 "$1" done sed local -eu /usr/bin
+--verbose | grep --verbose sed
+		/usr/bin x=1 "$@" printf printf $(pwd) readonly printf ${HOME} awk "$@" "$1"
+awk 2>/dev/null test test x=1 'quoted text' grep readonly grep 2>/dev/null
+sed "$1" readonly && 'quoted text' 'quoted text' local
+		cd ${HOME} /usr/bin test "$@" done ${HOME} 'quoted text' export test
+"$@" 2>/dev/null export /usr/bin grep | | "$1" export "$1" "$@" then local test
+		| printf ${HOME} then "$@" x=1 "$1" readonly readonly cd | x=1 then
+'quoted text' printf done /usr/bin --verbose cd then test cd && --verbose
+		x=1 "$1" -eu sed "$@" x=1 sed && then done --verbose ${HOME} sed 'quoted text'
+		&& echo printf "$1" then
+		-eu ${HOME} -eu cd x=1 then echo --verbose
+	${HOME} then /usr/bin
+		done done sed printf test $(pwd) awk "$@" cd awk grep
+		done cd $(pwd) $(pwd) /usr/bin "$1" cd 2>/dev/null && | test grep sed cd sed
+		echo "$1" test ${HOME} awk 2>/dev/null | test "$@" $(pwd) 2>/dev/null 2>/dev/null
+		"$1" "$1" local test 2>/dev/null cd ${HOME} && /usr/bin sed "$@" then awk printf
+	export "$@" then export 'quoted text' -eu 2>/dev/null
+&& printf readonly readonly sed --verbose
+	printf local "$@" local "$@" x=1 /usr/bin then sed test --verbose export 'quoted text'
+	cd export readonly echo done sed
+		printf done "$1" $(pwd) export $(pwd) readonly cd done x=1 --verbose | 2>/dev/null
+		readonly echo export sed readonly awk export
+${HOME} 2>/dev/null printf done --verbose grep && && readonly awk grep printf
+${HOME} readonly grep 2>/dev/null grep awk $(pwd) "$1" && export printf ${HOME}
+local x=1 export grep readonly readonly readonly && 'quoted text'
+	"$@" | 'quoted text' && | grep x=1 --verbose
+		&& 'quoted text' readonly cd
+		| echo x=1 2>/dev/null ${HOME} -eu && export test --verbose export | awk
+		awk | then | cd 'quoted text' readonly /usr/bin local
+awk --verbose 2>/dev/null ${HOME} echo 'quoted text' 'quoted text' done
+$(pwd) ${HOME} /usr/bin --verbose $(pwd) ${HOME} ${HOME} -eu $(pwd) "$1" x=1 x=1
+		-eu echo test x=1 "$1" export x=1 awk readonly
+		readonly && && -eu readonly | printf --verbose local cd readonly $(pwd) "$1" 2>/dev/null
+		cd grep && grep printf $(pwd) echo
+2>/dev/null printf cd printf x=1 readonly "$1" 'quoted text'
+		| cd awk then export --verbose echo
+		readonly grep /usr/bin printf grep awk "$@" awk "$1" ${HOME} /usr/bin
+&& 'quoted text' local sed cd echo readonly | $(pwd)
+"$@" 2>/dev/null $(pwd) --verbose test ${HOME} echo
+	| grep cd 'quoted text' export -eu printf 'quoted text' -eu x=1 ${HOME}
+cd /usr/bin sed echo test printf x=1
+		| ${HOME} --verbose test
+cd "$1" --verbose sed | echo 'quoted text' x=1 /usr/bin
+x=1 2>/dev/null x=1 test done readonly sed -eu cd && printf x=1 &&
+${HOME} x=1 -eu cd sed 2>/dev/null test "$1" local local $(pwd)
+	2>/dev/null printf sed /usr/bin done export -eu then 2>/dev/null
+		awk /usr/bin grep printf local /usr/bin ${HOME}
+| awk export $(pwd) readonly "$@" x=1 export
+grep awk printf 2>/dev/null
+	| done sed grep -eu export sed /usr/bin printf x=1 awk
+		x=1 --verbose "$1" && awk 'quoted text' readonly $(pwd) ${HOME} -eu grep awk
+	local "$1" -eu awk | -eu export printf sed done && test && 2>/dev/null "$1"
+-eu --verbose $(pwd) x=1 then "$1" grep local test test -eu
+	printf "$1" then -eu local test -eu cd | readonly then /usr/bin
+		| local awk export cd grep && awk
+awk cd /usr/bin readonly grep then && | 'quoted text' "$@" local && && -eu | &&
+grep readonly test "$@" readonly
+		awk 2>/dev/null then echo printf awk --verbose /usr/bin cd
+	${HOME} grep done 2>/dev/null echo export local
+	--verbose then ${HOME} --verbose echo export && 'quoted text'
+	'quoted text' 2>/dev/null $(pwd) test printf test "$@" 'quoted text'
+	--verbose "$1" -eu -eu export "$1" x=1 ${HOME} -eu x=1 readonly
+	then export test 2>/dev/null then 'quoted text' x=1 done echo | x=1 test export
+		sed "$@" "$1" x=1 then export "$1" 'quoted text' awk export
+done grep 'quoted text' "$@" ${HOME} 'quoted text' awk && grep
+		&& 2>/dev/null x=1 -eu x=1 2>/dev/null
+	$(pwd) readonly | local
+--verbose "$1" test grep "$@" ${HOME} --verbose done -eu "$@" local export
+local | $(pwd) 'quoted text' readonly | awk "$1" -eu
+		&& printf printf echo $(pwd) | echo echo
+		readonly grep --verbose 2>/dev/null grep "$@" | done
+		| test $(pwd) sed local awk
+	done sed | && local --verbose local awk 2>/dev/null
+	'quoted text' then 'quoted text'
+	awk test awk 2>/dev/null then awk echo --verbose
+x=1 local -eu cd x=1 'quoted text' 2>/dev/null x=1 && --verbose echo $(pwd) ${HOME}
+		cd --verbose "$1" then ${HOME}
+	"$1" | ${HOME} | done readonly ${HOME}
+	-eu sed readonly 'quoted text' 2>/dev/null test
+		$(pwd) grep "$1" echo test done ${HOME} 'quoted text'
+	local echo awk done ${HOME} "$1" printf "$@" cd 2>/dev/null 'quoted text'
+	grep export sed 2>/dev/null awk grep export 2>/dev/null
+	/usr/bin x=1 'quoted text' $(pwd) export readonly echo grep
+	/usr/bin /usr/bin 'quoted text' printf sed then grep
+	grep cd done readonly 'quoted text' then x=1 export
+&& /usr/bin x=1 then readonly "$@" $(pwd) 2>/dev/null
+	printf export readonly sed
+		cd export /usr/bin local ${HOME}
+	$(pwd) then "$@" 'quoted text' /usr/bin echo "$@" done
+		echo printf sed done readonly grep $(pwd) test
+awk "$1" sed --verbose 2>/dev/null readonly awk
+	cd printf "$@" 'quoted text' "$@" sed x=1 export "$@" grep echo -eu then
+'quoted text' awk x=1 /usr/bin
+$(pwd) printf echo && local
+$(pwd) sed | $(pwd) then awk
+$(pwd) && --verbose /usr/bin /usr/bin cd
+		export | grep sed 'quoted text' echo x=1 then -eu readonly
+"$1" grep "$1" /usr/bin test /usr/bin
+/usr/bin done local sed done cd export local
+		-eu $(pwd) readonly ${HOME}
+'quoted text' ${HOME} "$1" x=1 | done /usr/bin then
+		test then grep "$@" test 'quoted text' export
+printf x=1 grep export cd printf test printf echo 'quoted text' test cd
+test sed cd --verbose | then printf "$@" 2>/dev/null
+"$1" test /usr/bin awk --verbose ${HOME}
+	/usr/bin test 2>/dev/null grep && test
+-eu awk 2>/dev/null /usr/bin
+	printf readonly cd --verbose cd export "$@" $(pwd) ${HOME} 2>/dev/null
+	'quoted text' -eu $(pwd) readonly cd local export
+	test /usr/bin 2>/dev/null /usr/bin "$@" sed readonly ${HOME}
+printf | grep "$@" local sed
+"$1" -eu local x=1 echo 2>/dev/null done ${HOME} awk
+then awk sed | x=1 'quoted text' "$1" export "$@"
+then cd printf cd grep echo then
+	$(pwd) done 'quoted text' echo printf
+		| "$1" then cd sed x=1 x=1 'quoted text' && printf local
+		'quoted text' export
+2>/dev/null "$@" 2>/dev/null x=1 echo 'quoted text'
+2>/dev/null -eu | export 'quoted text'
+	/usr/bin readonly -eu readonly done test printf -eu printf done /usr/bin
+		cd ${HOME} ${HOME} | -eu test ${HOME} done 2>/dev/null readonly "$@" ${HOME}
+		2>/dev/null "$1" ${HOME} printf && -eu 'quoted text'
+	x=1 done | awk then -eu && 'quoted text' test grep echo 'quoted text' grep printf
+&& echo export 'quoted text' "$1" echo
+	then "$@" $(pwd) ${HOME} done done "$1" 2>/dev/null
+		readonly /usr/bin && printf 2>/dev/null x=1 readonly $(pwd) then export
+		grep 'quoted text' printf echo 2>/dev/null printf local /usr/bin /usr/bin done
+	printf "$1" test "$@" x=1 2>/dev/null x=1 readonly $(pwd) awk
+	x=1 readonly then then awk grep --verbose ${HOME}
+	| /usr/bin awk grep 2>/dev/null local
+		$(pwd) cd $(pwd) sed grep sed
+		cd --verbose done 'quoted text' "$1" && export cd 'quoted text'
+		"$@" printf 'quoted text' | ${HOME}
+"$@" sed sed /usr/bin sed | --verbose "$@" /usr/bin
+		grep 'quoted text' 2>/dev/null test x=1 readonly awk awk -eu /usr/bin
+	$(pwd) export sed | "$@" test ${HOME} done readonly /usr/bin done
+		printf 2>/dev/null "$1" 2>/dev/null export
+		&& -eu $(pwd) then ${HOME} export export -eu 'quoted text'
+$(pwd) "$1" then 'quoted text' ${HOME} 'quoted text' awk export sed | printf
+	echo "$1" export x=1 grep 'quoted text' "$1" readonly 'quoted text' local
+echo grep done done "$@" local 'quoted text' 'quoted text' --verbose then "$1" "$1"
+	/usr/bin ${HOME} cd test --verbose
+test 2>/dev/null "$@" readonly "$1"
+		-eu x=1 test cd cd test export
+$(pwd) ${HOME} "$1" local echo && -eu sed awk done -eu sed -eu "$1" x=1 $(pwd) x=1
+done --verbose | then -eu echo ${HOME} echo ${HOME}
+	readonly done awk awk echo done then done grep $(pwd) grep local
+${HOME} --verbose 2>/dev/null cd then | export sed echo test cd x=1 'quoted text'
+sed x=1 readonly 2>/dev/null export awk x=1 --verbose -eu | ${HOME} export
+		cd x=1 export | 'quoted text'
+/usr/bin test "$@" --verbose then echo "$1" local
+		done echo -eu grep done 2>/dev/null
+/usr/bin test local test sed sed export
+	cd readonly done done "$1" --verbose | readonly readonly --verbose | printf $(pwd)
+		export printf --verbose $(pwd) $(pwd) cd
+		awk awk printf cd -eu export | 2>/dev/null done sed $(pwd) "$1" test
+awk local then grep sed then /usr/bin -eu awk done echo "$@"
+	"$@" 'quoted text' && && readonly $(pwd) echo --verbose sed
+	&& sed "$1" awk awk 2>/dev/null 2>/dev/null
+	"$@" echo done 2>/dev/null --verbose "$1" | 2>/dev/null done printf "$1"
+		export printf local test sed
+		then x=1 printf export cd --verbose "$1"
+		test test 2>/dev/null export echo --verbose ${HOME} local test && --verbose
+	cd sed then grep | /usr/bin local && x=1 grep awk x=1 printf "$1" --verbose "$@"
+		sed 'quoted text' /usr/bin echo && test
+done $(pwd) export printf export "$1" local "$@" 2>/dev/null x=1 "$1" cd
+	printf done && 'quoted text'
+	&& ${HOME} test sed sed
+2>/dev/null awk "$@" readonly -eu local then local echo grep awk
+		echo test --verbose x=1
+		| $(pwd) echo && 2>/dev/null sed /usr/bin cd ${HOME}
+		--verbose cd printf | "$@" "$@" then && cd
+printf 'quoted text' export /usr/bin -eu $(pwd) cd export $(pwd)
+	'quoted text' done sed $(pwd) x=1
+echo readonly echo --verbose
+"$1" export printf $(pwd) readonly then "$1" "$1"
+${HOME} printf done printf test
+	done local -eu done -eu 2>/dev/null grep grep sed awk printf
+	export "$@" | echo $(pwd) ${HOME} && echo | && done echo &&
+	export export $(pwd) ${HOME} done ${HOME}
+	&& readonly cd | /usr/bin test done
+		awk sed --verbose awk export done ${HOME} && export /usr/bin test grep
+	/usr/bin then printf local 'quoted text' echo grep
+		x=1 echo /usr/bin sed -eu 2>/dev/null
+	${HOME} test 'quoted text' grep && 'quoted text' 'quoted text' "$1"
+	/usr/bin sed export x=1 done "$1" --verbose local
+x=1 grep sed --verbose 'quoted text'
+	'quoted text' local cd 'quoted text' done ${HOME} echo local | $(pwd) "$1"
+	| done sed && --verbose test -eu /usr/bin "$1"
+"$@" test && && && echo | awk x=1
+export echo echo done export
+	printf /usr/bin then readonly then x=1 printf
+	"$@" /usr/bin 2>/dev/null "$@" test printf && then x=1 test local
+		done then awk 2>/dev/null cd then sed echo grep grep grep --verbose
+	sed cd then readonly export test x=1 cd printf readonly "$@" $(pwd)
+		${HOME} --verbose then export local
+		$(pwd) grep /usr/bin /usr/bin x=1 readonly readonly done $(pwd) ${HOME}
+readonly echo $(pwd) awk cd then 2>/dev/null ${HOME} /usr/bin printf "$1"
+	-eu /usr/bin sed local export "$1" test x=1 -eu
+	echo export done --verbose && cd done cd readonly
+sed "$1" /usr/bin test ${HOME} local echo
+echo --verbose sed echo export sed export | test echo x=1 && done 2>/dev/null
+	done "$@" 'quoted text' ${HOME} -eu sed readonly
+$(pwd) "$1" local readonly echo export -eu local 'quoted text' cd
+	echo printf grep 'quoted text' sed | --verbose && then sed readonly export -eu
+${HOME} /usr/bin --verbose
+	| readonly | /usr/bin --verbose "$@" /usr/bin sed local /usr/bin $(pwd) awk
+-eu readonly && x=1 done "$@" --verbose echo then echo
+		--verbose cd $(pwd) "$1"
+		readonly && echo /usr/bin printf /usr/bin --verbose
+		printf 'quoted text' ${HOME} done done -eu | readonly local
+	&& printf then "$@" $(pwd) $(pwd) printf
+	cd sed readonly $(pwd) /usr/bin -eu x=1 done cd -eu echo
+		then --verbose $(pwd) "$1" cd 2>/dev/null
+		awk cd "$@" x=1 'quoted text' test --verbose
+		-eu sed --verbose done $(pwd) grep awk "$1" 'quoted text' readonly
+		${HOME} 2>/dev/null | echo
+	export done awk --verbose printf sed awk
+	"$1" test cd -eu | && 'quoted text' /usr/bin done $(pwd) awk then sed --verbose
+		readonly printf | -eu $(pwd)
+		"$@" -eu awk "$@" echo local echo sed $(pwd) sed
+	"$1" sed echo "$@" printf 'quoted text' /usr/bin --verbose echo done "$@" &&
+'quoted text' /usr/bin printf test cd 2>/dev/null | /usr/bin 2>/dev/null
+		/usr/bin /usr/bin "$@" sed awk sed local printf
+	x=1 -eu 2>/dev/null export 'quoted text' echo ${HOME} --verbose
+		sed ${HOME} export 2>/dev/null "$@" && then then sed cd -eu "$@" printf export
+		'quoted text' awk ${HOME} "$1" local
+		echo -eu "$1" grep x=1 export
+	sed cd 'quoted text' $(pwd) sed test "$1" export $(pwd) echo "$1" awk test grep
+done "$1" $(pwd) sed 'quoted text' printf cd grep test awk | x=1 printf test
+	"$@" cd "$@" /usr/bin done "$@" awk $(pwd) | readonly 'quoted text' /usr/bin
+		x=1 readonly export | cd test readonly && 'quoted text' "$1" echo awk /usr/bin
+		test x=1 cd echo /usr/bin done -eu
+grep awk then test test readonly readonly "$1" echo sed done export
+	test | awk $(pwd) | export echo done test test x=1 then /usr/bin
+	echo printf --verbose echo $(pwd)
+	printf printf 2>/dev/null "$@" "$@" && echo then x=1 awk export
+		-eu | echo x=1 local x=1 | | local test x=1 /usr/bin printf
+awk test $(pwd) local echo grep test -eu test
+echo 'quoted text' awk cd sed /usr/bin readonly /usr/bin cd 'quoted text' /usr/bin
+		echo -eu && /usr/bin sed "$1" "$@" x=1 "$@" cd sed done
+sed test export awk ${HOME} -eu sed 'quoted text' local readonly
+		awk | done test 2>/dev/null "$1"
+'quoted text' "$@" --verbose readonly sed &&
+	done --verbose export 'quoted text'
+	local ${HOME} "$1" printf
+	then --verbose x=1 export /usr/bin 2>/dev/null
+	export export ${HOME} readonly test
+'quoted text' 'quoted text'
+	--verbose -eu x=1 export "$1" echo local cd 2>/dev/null
+		readonly sed printf /usr/bin && | "$@" sed 2>/dev/null printf "$@"
+		"$@" grep export $(pwd) | local grep readonly echo export
+grep 'quoted text' ${HOME} /usr/bin done "$@" -eu echo "$@"
+then x=1 cd -eu test 'quoted text' --verbose test then awk awk done "$1" | printf
+	sed x=1 | x=1 awk grep && $(pwd) echo --verbose then done grep "$1" echo ${HOME}
+		done 'quoted text' /usr/bin -eu grep --verbose
+$(pwd) sed 'quoted text' -eu done sed 2>/dev/null grep local cd
+echo 2>/dev/null --verbose then printf 'quoted text'
+	"$1" x=1 && 2>/dev/null | 2>/dev/null -eu local awk --verbose
+x=1 printf ${HOME} grep /usr/bin done done
+	grep grep readonly sed test -eu export | export sed sed then cd
+	awk grep && then x=1 2>/dev/null printf
+		echo "$1" readonly echo readonly --verbose "$1"
+		--verbose readonly ${HOME} | -eu --verbose "$1"
+$(pwd) then test /usr/bin
+	test printf sed --verbose
+		done 'quoted text' awk done then
+sed done | ${HOME} | printf -eu && then echo local /usr/bin && /usr/bin
+'quoted text' "$@" sed ${HOME}
+printf "$1" $(pwd) x=1 readonly printf
+		export | --verbose "$@" 'quoted text' echo && "$@" grep
+local 'quoted text' echo $(pwd) && && grep readonly cd printf -eu
+then cd printf test echo readonly | sed done
+		2>/dev/null -eu "$1" && "$@" export readonly && sed local awk done ${HOME} ${HOME}
+		sed test then grep sed grep local 'quoted text'
+awk export x=1 awk /usr/bin sed "$@" test x=1 | -eu /usr/bin "$1"
+	done "$1" "$@" test | && $(pwd) awk awk -eu
+	--verbose "$@" -eu ${HOME} | awk 2>/dev/null --verbose cd readonly
+then local "$1" export && done -eu local "$1"
+		then export awk readonly && && --verbose $(pwd)
+test "$1" -eu printf done | "$@" done sed
+		sed sed then awk grep local echo readonly grep -eu export "$1" readonly
+"$1" done done sed local "$@" ${HOME} grep then then $(pwd)
+echo test done 2>/dev/null
+	local done | 'quoted text' $(pwd) 2>/dev/null done sed done done
+${HOME} grep grep --verbose "$1" -eu $(pwd) done --verbose printf
+		x=1 x=1 --verbose x=1 2>/dev/null awk sed local grep local
+		awk -eu grep local awk ${HOME} echo cd 'quoted text' done -eu /usr/bin
+	sed 'quoted text' then grep cd done "$@" x=1 && done -eu sed 2>/dev/null --verbose
+	'quoted text' export | readonly && -eu 2>/dev/null 'quoted text' "$@"
+${HOME} sed "$1" export "$1" export test 'quoted text'
+		${HOME} sed 'quoted text' ${HOME} 'quoted text'
@@ -0,0 +1,2001 @@
+"$1" test /usr/bin test
+	cd readonly printf $(pwd) sed -eu local $(pwd) printf | done local
+"$@" && grep "$@" grep "$1" /usr/bin test
+	grep && 2>/dev/null --verbose
+test && printf "$@" done grep local | awk
+	echo /usr/bin local $(pwd) "$1" 2>/dev/null sed 2>/dev/null cd grep /usr/bin
+	readonly readonly x=1 "$@" export $(pwd) 'quoted text' | --verbose
+	--verbose then 2>/dev/null
+	cd done $(pwd) "$@" done x=1 -eu printf "$1" then readonly ${HOME}
+	awk grep done $(pwd) then $(pwd)
+		2>/dev/null -eu --verbose /usr/bin ${HOME} -eu 'quoted text' sed 2>/dev/null
+	export ${HOME} 'quoted text'
+	export 2>/dev/null "$1" cd grep 'quoted text' echo
+		echo export awk 2>/dev/null printf
+		&& 2>/dev/null readonly "$@" echo readonly grep done "$@" /usr/bin test local
+		x=1 awk | ${HOME} 2>/dev/null "$1" local ${HOME} done
+cd then cd then --verbose "$@"
+		readonly --verbose then
+	--verbose grep -eu printf "$@" --verbose ${HOME} --verbose "$1" local
+-eu export grep /usr/bin grep printf cd /usr/bin /usr/bin done "$@" sed 'quoted text'
+	--verbose then test awk -eu done "$@" cd export cd test readonly
+		2>/dev/null sed export
+		/usr/bin test --verbose
+		'quoted text' cd 2>/dev/null
+		test /usr/bin --verbose readonly -eu
+	--verbose 2>/dev/null local -eu then x=1 echo && --verbose
+	/usr/bin done ${HOME} -eu then readonly | cd local 2>/dev/null readonly done
+"$1" export | | test then readonly $(pwd) --verbose local export printf then
+sed then test local test 2>/dev/null
+	awk --verbose && && -eu export "$@" |
+$(pwd) then printf 2>/dev/null
+		done local export /usr/bin sed readonly
+export 2>/dev/null readonly then 'quoted text' 'quoted text'
+	echo local | && grep local
+		2>/dev/null "$@" && cd -eu local --verbose /usr/bin cd $(pwd) && -eu ${HOME}
+	readonly x=1 x=1 local readonly echo /usr/bin -eu then awk readonly echo
+	/usr/bin then /usr/bin grep grep echo --verbose local 2>/dev/null /usr/bin "$1"
+	"$@" test | --verbose x=1 grep done && 2>/dev/null
+	sed "$1" sed && sed done -eu awk cd printf then
+		/usr/bin -eu -eu "$@" readonly cd --verbose
+		${HOME} -eu 'quoted text' $(pwd) cd local awk ${HOME} $(pwd) 'quoted text'
+	'quoted text' grep printf x=1 $(pwd) awk 2>/dev/null local
+	"$1" $(pwd) awk "$@" "$@" sed "$1" grep cd 2>/dev/null awk 2>/dev/null local ${HOME}
+	--verbose -eu /usr/bin cd 2>/dev/null
+		$(pwd) readonly -eu echo /usr/bin
+	sed 'quoted text' printf && $(pwd) 2>/dev/null then | 'quoted text'
+	readonly $(pwd) "$1" export 2>/dev/null $(pwd) ${HOME} && | /usr/bin done
+printf "$@" /usr/bin | 'quoted text' done awk | x=1 echo
+awk 'quoted text' && cd printf export && printf then ${HOME}
+sed local --verbose -eu | sed 2>/dev/null
+"$@" echo "$@" cd ${HOME} export test grep 'quoted text' sed awk -eu 'quoted text'
+"$1" 'quoted text' test sed x=1 then | ${HOME} export ${HOME} readonly
+export grep sed local --verbose echo "$@" 2>/dev/null printf export
+		awk done sed then x=1 sed /usr/bin local sed sed /usr/bin /usr/bin /usr/bin $(pwd)
+	readonly grep $(pwd) awk done export ${HOME} awk readonly cd
+		printf --verbose export printf /usr/bin /usr/bin export
+"$1" grep x=1 test awk done $(pwd) local export ${HOME} local
+export export --verbose echo done done
+		then test then done | cd local done echo $(pwd) "$@" 'quoted text'
+&& $(pwd) x=1 grep local
+		2>/dev/null "$@" $(pwd) printf $(pwd) /usr/bin test ${HOME} $(pwd) awk --verbose
+cd cd grep then test x=1 sed | then "$1" sed
+	${HOME} "$@" -eu then 'quoted text' printf ${HOME} awk sed --verbose
+		then sed --verbose x=1 x=1 | "$1" printf readonly printf --verbose readonly grep
+	sed local | 2>/dev/null test test awk echo echo awk && -eu test cd
+		done test /usr/bin --verbose test 2>/dev/null sed test "$1"
+		done 2>/dev/null sed 'quoted text' --verbose && test echo && awk "$1" export
+		"$@" grep grep then test
+--verbose "$@" /usr/bin
+		export readonly 2>/dev/null -eu done sed "$1" /usr/bin readonly
+		echo "$1" cd && readonly 2>/dev/null awk local export | 2>/dev/null
+		readonly cd printf readonly done cd | $(pwd) && export grep "$@" &&
+	${HOME} cd export | 'quoted text' "$1" && awk 'quoted text'
+		awk x=1 local export test grep $(pwd) readonly sed done export local --verbose
+	"$@" /usr/bin readonly 'quoted text'
+		cd awk awk echo -eu grep awk x=1 'quoted text'
+2>/dev/null test x=1 awk cd then "$@" local
+${HOME} readonly export 'quoted text' "$1"
+		$(pwd) done -eu "$1" sed "$@" readonly grep &&
+		'quoted text' x=1 then
+		x=1 grep /usr/bin 2>/dev/null
+grep printf 2>/dev/null awk "$@" export echo | cd 2>/dev/null "$@" "$@"
+-eu awk grep echo readonly export /usr/bin then
+	x=1 awk --verbose readonly "$@" x=1 | $(pwd) 2>/dev/null
+	--verbose 'quoted text' local --verbose 'quoted text' then export readonly
+	echo x=1 | && local readonly
+printf then then ${HOME} then 'quoted text' 2>/dev/null export
+	export "$1" | && local x=1 done test 2>/dev/null /usr/bin "$1" test local
+test cd /usr/bin printf sed x=1 | 2>/dev/null printf && export sed echo ${HOME}
+	x=1 "$1" --verbose grep -eu | -eu 2>/dev/null /usr/bin
+local then then awk -eu export done then cd $(pwd) 2>/dev/null /usr/bin 'quoted text'
+		then 2>/dev/null cd grep ${HOME}
+	2>/dev/null then readonly
+		2>/dev/null && "$@" "$@" "$1" --verbose && done "$1" "$1" /usr/bin
+--verbose local 'quoted text' "$1" "$@" /usr/bin sed echo 2>/dev/null
+2>/dev/null ${HOME} -eu --verbose
+	done x=1 $(pwd) $(pwd) ${HOME} "$@" -eu x=1 2>/dev/null
+		${HOME} -eu $(pwd) && "$1" | test awk cd test awk "$1" done
+readonly sed cd test export export echo awk echo then && 'quoted text' export
+readonly /usr/bin local 'quoted text' && "$@" 2>/dev/null -eu cd
+		awk echo echo /usr/bin "$1" 2>/dev/null
+		then /usr/bin test 'quoted text'
+	cd 'quoted text' done awk
+	${HOME} export && $(pwd) 'quoted text' "$1" export $(pwd) local export
+export cd x=1 | then local grep done --verbose x=1 then ${HOME} | | export export
+	&& -eu x=1 "$1" done done readonly "$1" done x=1 && done
+		printf -eu 2>/dev/null ${HOME} cd /usr/bin $(pwd) x=1 /usr/bin done
+		cd -eu "$1" readonly $(pwd) sed grep
+		awk local readonly awk 'quoted text' x=1 awk --verbose
+		sed ${HOME} --verbose grep then echo awk -eu readonly
+	readonly 'quoted text' done && done 'quoted text' $(pwd) "$@" --verbose
+		2>/dev/null "$@" ${HOME} then
+		echo --verbose /usr/bin local --verbose
+	$(pwd) local x=1 --verbose -eu "$@" readonly x=1 && then
+		$(pwd) awk sed 'quoted text' sed then && test test &&
+awk "$1" awk grep "$1" cd awk x=1 local --verbose /usr/bin --verbose
+test -eu grep -eu printf then local readonly x=1
+awk 2>/dev/null done && awk awk ${HOME}
+	'quoted text' --verbose $(pwd)
+	readonly sed "$@" "$@" /usr/bin test then then 2>/dev/null done cd | |
+	export "$@" "$1" then x=1 | x=1 readonly done then
+	awk cd --verbose $(pwd) $(pwd) | then ${HOME} then cd printf
+local "$@" /usr/bin /usr/bin echo readonly
+${HOME} awk then "$1" 2>/dev/null "$1" /usr/bin echo local
+		done -eu --verbose export
+		printf 'quoted text' export then x=1
+	sed $(pwd) && x=1 readonly | x=1 awk local 2>/dev/null echo grep readonly
+		then && $(pwd) "$@" -eu /usr/bin "$1" 'quoted text'
+x=1 test x=1 echo cd "$@" sed awk --verbose
+		--verbose && | && ${HOME} readonly
+		test 'quoted text' local test test done awk ${HOME} 'quoted text' readonly /usr/bin
+cd "$@" printf && awk | 'quoted text' --verbose grep ${HOME} x=1 local then
+	"$1" sed awk local readonly | echo local ${HOME} $(pwd)
+	-eu --verbose grep "$1" /usr/bin
+x=1 export then x=1 x=1 2>/dev/null sed echo 'quoted text' grep test x=1 test
+'quoted text' /usr/bin ${HOME}
+	sed grep then done && readonly 2>/dev/null
+	2>/dev/null x=1 && printf $(pwd) readonly && cd -eu /usr/bin cd "$@" 'quoted text'
+		| ${HOME} sed grep | export x=1 awk printf
+		$(pwd) && | sed --verbose local /usr/bin /usr/bin done awk echo
+	--verbose "$@" "$1" /usr/bin sed ${HOME} grep
+done $(pwd) "$1" grep sed --verbose --verbose
+		'quoted text' x=1 done done awk "$1" echo grep x=1 $(pwd) grep "$@" export
+| /usr/bin export 2>/dev/null local 'quoted text'
+	export 'quoted text' sed done printf readonly -eu export cd echo -eu readonly
+	"$1" readonly awk -eu ${HOME} | /usr/bin echo
+	then printf local "$@" printf sed then echo /usr/bin grep cd readonly cd export
+		export -eu echo | done "$1"
+	readonly ${HOME} test x=1 ${HOME} then then "$@" "$@" then printf
+"$@" ${HOME} printf 'quoted text'
+		awk local x=1 /usr/bin test then "$1" 2>/dev/null "$@" sed then
+printf sed 'quoted text' sed then done | export echo "$1" $(pwd) 'quoted text'
+2>/dev/null && -eu -eu x=1 grep 2>/dev/null $(pwd) test
+	"$@" /usr/bin then echo && done printf && then awk printf cd sed readonly /usr/bin
+		sed 2>/dev/null then "$@" "$@" $(pwd) --verbose /usr/bin
+	--verbose -eu -eu /usr/bin done grep printf --verbose local "$1"
+	/usr/bin grep test /usr/bin -eu ${HOME} readonly sed then x=1 /usr/bin local
+	'quoted text' printf cd awk test --verbose readonly printf
+${HOME} --verbose printf 'quoted text'
+		'quoted text' ${HOME}
+		export sed done 'quoted text'
+		then cd x=1 ${HOME} local x=1 /usr/bin "$@" grep "$1" -eu echo -eu
+	/usr/bin -eu local test export 'quoted text' cd | ${HOME} sed
+${HOME} "$1" done 'quoted text' 2>/dev/null -eu then cd export done $(pwd) export
+		${HOME} x=1 | export readonly
+	grep 2>/dev/null "$@" --verbose grep export 'quoted text'
+"$@" x=1 x=1 done --verbose
+		done then local 'quoted text' x=1 2>/dev/null -eu echo $(pwd) | x=1 --verbose grep
+	done && 2>/dev/null local sed /usr/bin readonly
+	done 2>/dev/null /usr/bin test /usr/bin readonly /usr/bin &&
+		"$1" --verbose "$1" readonly local 'quoted text'
+printf "$1" /usr/bin echo /usr/bin
+${HOME} | echo cd export && 2>/dev/null done printf --verbose export $(pwd)
+	sed 'quoted text' x=1 --verbose x=1 "$@" grep ${HOME} x=1 grep
+"$@" $(pwd) sed --verbose x=1 && echo cd 'quoted text'
+	x=1 cd printf 'quoted text' && grep echo echo 'quoted text'
+		local "$@" export 'quoted text' -eu ${HOME} 'quoted text' 2>/dev/null /usr/bin
+	test /usr/bin x=1 ${HOME} readonly
+2>/dev/null done cd $(pwd) 'quoted text' $(pwd) x=1
+		awk grep awk 'quoted text'
+-eu --verbose grep cd x=1 printf x=1 export then
+	2>/dev/null export x=1 --verbose 'quoted text'
+printf -eu $(pwd) export 'quoted text' done
+	local readonly sed then export && local done printf | --verbose export 2>/dev/null
+${HOME} done export export
+		$(pwd) $(pwd) printf && 2>/dev/null -eu ${HOME} /usr/bin /usr/bin echo
+"$@" printf | done 'quoted text'
+		$(pwd) done 2>/dev/null && cd done x=1 test sed /usr/bin
+	"$@" "$@" x=1 export --verbose echo $(pwd) x=1 'quoted text'
+		$(pwd) readonly local "$@" && "$1" echo "$@" 'quoted text' grep then sed
+	awk x=1 ${HOME} "$@" x=1 then x=1 printf then sed
+		${HOME} x=1 done grep ${HOME} grep x=1 sed
+x=1 --verbose then test ${HOME} ${HOME} 2>/dev/null && "$@" test &&
+		then "$@" --verbose export 2>/dev/null printf ${HOME} --verbose
+awk "$1" then printf "$@" 'quoted text' "$@" -eu x=1 grep 2>/dev/null
+	done -eu "$@" printf sed
+		2>/dev/null awk && 'quoted text'
+	-eu grep x=1 "$@" sed export readonly local done x=1 test export
+		"$@" done export test -eu $(pwd) cd local awk cd sed
+echo printf readonly sed ${HOME} export
+		-eu done echo echo 2>/dev/null && sed
+awk ${HOME} cd local awk && sed ${HOME}
+local 2>/dev/null /usr/bin printf printf --verbose
+	$(pwd) test printf sed /usr/bin
+		local readonly then printf export /usr/bin ${HOME} --verbose
+		then test x=1 export && | local "$1" export /usr/bin 'quoted text' echo done "$1"
+2>/dev/null readonly cd x=1 2>/dev/null
+	echo echo "$@" printf then "$1" test grep grep x=1 done
+| test && 'quoted text' grep "$1" then export echo
+	done cd done local $(pwd) ${HOME}
+echo /usr/bin then awk /usr/bin echo -eu
+	readonly printf 'quoted text' | awk 'quoted text' sed
+		done "$1" awk test | done x=1 cd grep | $(pwd) "$1" local export ${HOME}
+	-eu "$1" local then grep then awk | "$1" done printf && test 2>/dev/null
+		| export local x=1 then echo ${HOME} $(pwd) /usr/bin && done
+export test printf echo sed "$1" done "$@" | && /usr/bin /usr/bin
+		grep 2>/dev/null 'quoted text' -eu export x=1 "$@"
+-eu 'quoted text' 2>/dev/null export -eu /usr/bin 2>/dev/null
+	sed cd grep readonly export $(pwd) --verbose "$@" readonly
+		done $(pwd) --verbose grep "$@" export $(pwd) $(pwd) printf local sed
+		$(pwd) | $(pwd) $(pwd) printf /usr/bin printf --verbose
+		grep cd printf 2>/dev/null x=1 sed printf
+	then $(pwd) "$@" printf "$1" printf 2>/dev/null ${HOME}
+cd $(pwd) -eu awk "$@" echo echo --verbose echo "$1" 2>/dev/null 'quoted text'
+2>/dev/null 2>/dev/null
+printf then then ${HOME} then 2>/dev/null
+then echo cd "$@" "$1" "$1" "$1" && x=1
+	printf ${HOME} grep printf cd sed test 2>/dev/null grep cd 2>/dev/null
+	export $(pwd) x=1 awk 'quoted text' cd -eu done
+		awk $(pwd) x=1 2>/dev/null cd /usr/bin sed sed sed done
+x=1 ${HOME} awk | readonly readonly export readonly printf echo cd "$@" "$1" readonly
+	echo export 'quoted text' x=1 && /usr/bin | /usr/bin x=1 export cd readonly
+		export grep awk readonly local 'quoted text' readonly printf then
+	"$@" 'quoted text' 2>/dev/null readonly readonly echo | | && grep --verbose test
+		"$@" awk cd x=1 local 2>/dev/null export x=1 done x=1 "$@" 'quoted text' && "$1"
+		grep $(pwd) /usr/bin 2>/dev/null 2>/dev/null readonly x=1 /usr/bin grep
+		/usr/bin grep x=1 readonly "$@" test ${HOME} readonly x=1 grep grep local readonly
+		awk x=1 then && awk then -eu local grep local grep
+		x=1 && $(pwd) printf && "$@" 'quoted text'
+printf then done 2>/dev/null 2>/dev/null -eu -eu export grep
+	awk | -eu done | grep 'quoted text' "$@"
+		2>/dev/null readonly test /usr/bin test sed | done --verbose
+	x=1 ${HOME} && "$1" ${HOME} awk export -eu x=1 sed --verbose /usr/bin
+		--verbose local | test echo awk export printf 'quoted text'
+	grep $(pwd) printf awk "$@" cd --verbose -eu readonly "$@" x=1 done done
+&& test echo readonly | local
+grep cd awk done printf awk | echo $(pwd)
+	-eu 'quoted text' | 2>/dev/null $(pwd) /usr/bin grep x=1 x=1 local
+sed cd 2>/dev/null printf export $(pwd) awk export 'quoted text' --verbose
+local test 'quoted text' && 2>/dev/null readonly && 'quoted text'
+		"$@" /usr/bin "$1" done test 2>/dev/null "$@" then -eu
+awk x=1 sed cd echo "$@"
+	grep export /usr/bin && readonly done readonly then awk cd test 2>/dev/null
+echo readonly 2>/dev/null sed
+sed readonly test grep /usr/bin test | -eu test x=1
+	"$1" | readonly readonly local 'quoted text'
+		readonly awk export /usr/bin
+		--verbose -eu x=1 "$@" then echo test ${HOME} local
+local x=1 sed x=1 "$1" awk 'quoted text'
+then $(pwd) done grep 'quoted text'
+		"$@" export local "$@" -eu "$@" && export test
+		sed $(pwd) local export done | ${HOME} echo 'quoted text' 2>/dev/null awk grep
+		"$1" && -eu x=1 export && | grep | && then "$1" x=1 echo
+	-eu "$1" done done -eu cd /usr/bin /usr/bin
+grep "$1" cd | ${HOME} awk awk ${HOME} done /usr/bin x=1 printf
+| sed grep test local then ${HOME} "$@" /usr/bin cd /usr/bin cd then
+	x=1 done cd 'quoted text' 'quoted text' "$@" readonly --verbose printf "$@"
+		grep -eu local echo export printf printf
+readonly | | readonly |
+/usr/bin grep x=1 ${HOME} 'quoted text' x=1 export $(pwd) --verbose
+-eu $(pwd) x=1 done 'quoted text' local cd "$@"
+		printf echo done /usr/bin grep
+	2>/dev/null echo cd -eu then cd x=1 2>/dev/null
+	&& echo x=1 -eu grep then /usr/bin 2>/dev/null /usr/bin && test cd
+	echo printf grep -eu && test readonly && "$1" done 'quoted text' $(pwd) sed ${HOME}
+$(pwd) -eu grep /usr/bin -eu $(pwd) then sed x=1 ${HOME} done
+		readonly printf /usr/bin awk -eu
+		test echo $(pwd) ${HOME} 'quoted text' echo && done export
+${HOME} 2>/dev/null -eu /usr/bin 'quoted text' -eu grep --verbose x=1
+		-eu readonly done echo | local
+		local -eu then /usr/bin 2>/dev/null echo x=1 test && grep
+	"$1" printf then && awk sed grep export "$1" echo "$1" awk
+		done echo /usr/bin readonly -eu /usr/bin cd readonly sed $(pwd) cd grep |
+	done echo 2>/dev/null ${HOME}
+'quoted text' readonly 'quoted text' 2>/dev/null --verbose
+		x=1 export test echo done cd export sed awk --verbose sed then awk export "$1" 'quoted text'
+		$(pwd) && --verbose cd "$@" then printf 'quoted text' test then awk /usr/bin
+| cd "$@" then | ${HOME} test export then done $(pwd) echo x=1 'quoted text'
+		/usr/bin -eu test | $(pwd) x=1
+2>/dev/null local sed ${HOME} cd export echo readonly $(pwd) echo awk
+		local -eu -eu && test printf
+x=1 | printf "$@" readonly 2>/dev/null 2>/dev/null $(pwd)
+		export $(pwd) | export done printf echo ${HOME} "$@" done /usr/bin readonly
+	$(pwd) /usr/bin printf "$@" sed printf
+	awk cd x=1 2>/dev/null x=1 /usr/bin awk
+		"$@" local "$@" sed printf local cd ${HOME} local sed sed | test | -eu &&
+		$(pwd) cd | cd grep -eu "$1" printf "$1" echo local grep "$1" | then then | && echo
+	$(pwd) "$1" ${HOME} 2>/dev/null test echo printf
+		'quoted text' awk 2>/dev/null export
+	sed --verbose sed -eu test cd echo && x=1 "$@" x=1 readonly sed
+"$1" ${HOME} ${HOME} | 'quoted text'
+&& "$1" | x=1 grep awk /usr/bin
+	'quoted text' test export | "$1" test ${HOME} && | /usr/bin done -eu local
+	cd "$1" 2>/dev/null "$@"
+sed done ${HOME} --verbose "$1" "$1" && sed grep x=1 --verbose
+$(pwd) test test $(pwd) test printf awk "$@" 'quoted text' readonly ${HOME} readonly
+	sed then grep test awk test ${HOME} export ${HOME} 'quoted text' export
+done | "$1" ${HOME} ${HOME} | then readonly test ${HOME} 2>/dev/null &&
+| test awk x=1 "$@" printf x=1 "$1" 'quoted text' then -eu then
+awk export /usr/bin --verbose ${HOME} sed then
+	/usr/bin "$1" sed grep readonly 2>/dev/null $(pwd) grep /usr/bin readonly
+	| ${HOME} "$1" readonly /usr/bin && ${HOME} readonly
+sed 'quoted text' && ${HOME}
+then $(pwd) readonly $(pwd) readonly awk "$1" && && 2>/dev/null
+	--verbose echo --verbose $(pwd) sed grep
+		&& && echo ${HOME} echo then done "$@" "$@" local "$1"
+	test cd | | -eu sed cd test x=1 readonly local done
+local "$@" 'quoted text' 2>/dev/null x=1 sed local 2>/dev/null echo
+		cd sed && -eu printf && | "$1" 'quoted text' readonly "$@" /usr/bin
+		local $(pwd) 2>/dev/null x=1 && awk && ${HOME}
+	cd $(pwd) export test sed /usr/bin then awk cd cd
+		&& sed "$@" --verbose readonly --verbose | readonly awk
+cd cd && 'quoted text' x=1 cd printf ${HOME} cd export $(pwd) test
+/usr/bin "$1" && x=1 cd 2>/dev/null
+		--verbose 2>/dev/null awk 'quoted text' printf --verbose cd then awk awk
+	local readonly grep export && | "$1" --verbose printf
+$(pwd) export "$1" 2>/dev/null
+		$(pwd) 2>/dev/null echo
+		| cd local "$@" export 'quoted text' $(pwd) "$@" sed test x=1 -eu /usr/bin 'quoted text'
+echo export sed "$@" --verbose x=1 cd "$1" printf "$1" test then 2>/dev/null
+		done --verbose | ${HOME} -eu
+		x=1 $(pwd) | echo && && sed grep 'quoted text' then echo
+	${HOME} local /usr/bin ${HOME} export then awk readonly -eu echo echo /usr/bin
+	"$1" $(pwd) && "$1" --verbose $(pwd) | readonly
+/usr/bin echo cd $(pwd) --verbose --verbose echo
+	then cd /usr/bin then "$1" --verbose &&
+	then grep echo cd readonly 'quoted text' printf
+"$1" "$@" | cd "$1" "$1" $(pwd) echo x=1 -eu then
+	| awk "$1" /usr/bin readonly local then awk echo echo "$@" /usr/bin printf
+	$(pwd) sed x=1 awk printf
+		| ${HOME} then 2>/dev/null && 2>/dev/null
+		readonly done ${HOME} ${HOME} "$@" readonly | -eu 2>/dev/null
+		awk grep "$1" ${HOME} cd readonly |
+	printf then sed $(pwd) export "$@"
+cd grep readonly "$@" $(pwd) ${HOME} "$@" grep readonly -eu
+grep test test 2>/dev/null
+	cd sed test "$1" echo test test "$@" grep 'quoted text' grep
+| x=1 awk "$1" echo --verbose grep cd && 'quoted text'
+readonly export -eu | grep printf cd --verbose /usr/bin
+		$(pwd) grep $(pwd) -eu &&
+		echo awk "$1" sed export
+local --verbose done -eu printf -eu | grep sed grep
+		local echo ${HOME} cd cd grep then "$1" x=1 $(pwd) ${HOME}
+	cd echo echo sed 2>/dev/null
+'quoted text' test /usr/bin readonly grep && && grep export 'quoted text'
+"$1" grep ${HOME} grep --verbose done cd -eu echo /usr/bin sed
+		| x=1 readonly --verbose test awk awk "$1" readonly grep done export "$@"
+		--verbose printf local -eu cd test
+	grep awk awk printf cd /usr/bin --verbose export ${HOME} export
+echo done export $(pwd) "$@" $(pwd) done local --verbose then
+	'quoted text' awk grep /usr/bin grep grep sed --verbose
+printf readonly local sed done export awk "$1" local
+		echo /usr/bin readonly echo test awk ${HOME} -eu test done x=1 /usr/bin
+		'quoted text' 2>/dev/null "$@" awk readonly done then test grep
+grep --verbose --verbose readonly
+done cd readonly /usr/bin sed test sed
+printf readonly printf 2>/dev/null 'quoted text' done
+	export --verbose | --verbose && local --verbose "$1" echo "$1" 2>/dev/null "$@"
+		export done awk done done
+	-eu $(pwd) cd "$1" 'quoted text' 'quoted text' local
+	x=1 printf | ${HOME} x=1 export 'quoted text'
+	test echo 2>/dev/null -eu printf /usr/bin then printf done x=1 awk local 2>/dev/null
+printf printf | $(pwd) 'quoted text'
+		grep readonly 2>/dev/null readonly
+		local readonly cd /usr/bin grep $(pwd)
+		"$1" "$@" "$1" export export 2>/dev/null readonly then
+2>/dev/null /usr/bin readonly ${HOME} 2>/dev/null
+&& "$@" local | ${HOME} -eu --verbose ${HOME} printf done
+-eu test printf then export "$1"
+		cd && sed sed done printf
+${HOME} "$1" local echo /usr/bin | && ${HOME} grep $(pwd)
+export "$@" cd then sed export export
+		echo x=1 printf echo printf /usr/bin ${HOME}
+		local test 2>/dev/null
+&& cd | done $(pwd) "$@"
+		/usr/bin x=1 $(pwd) -eu local
+	cd echo "$@" export local ${HOME} test echo sed local awk local 'quoted text'
+		$(pwd) export awk "$@" sed awk ${HOME} cd "$1" | && 2>/dev/null 'quoted text' 2>/dev/null
+		grep printf --verbose local 2>/dev/null -eu --verbose
+| sed 'quoted text' export /usr/bin printf && grep printf cd cd awk "$1" printf
+--verbose grep readonly echo test
+		awk sed printf then | readonly $(pwd) 'quoted text'
+	-eu sed done --verbose local "$1"
+	export local done done export
+sed cd x=1 sed readonly "$1" grep
+		test 'quoted text' export x=1 --verbose && done x=1 printf 2>/dev/null local -eu
+	cd grep --verbose readonly then echo ${HOME} then test 'quoted text' grep done
+	grep x=1 done /usr/bin /usr/bin x=1 test cd then 'quoted text' --verbose ${HOME}
+		2>/dev/null /usr/bin ${HOME} local echo export local | sed "$1" done test then
+done --verbose cd echo ${HOME} readonly done printf done cd | awk local
+		awk grep grep export $(pwd) awk 2>/dev/null 'quoted text' "$@" $(pwd) cd
+		| -eu echo test -eu $(pwd) export "$1" echo awk $(pwd) 2>/dev/null
+/usr/bin printf 2>/dev/null
+$(pwd) --verbose then cd then --verbose awk /usr/bin readonly local -eu
+		grep done x=1 grep sed then
+	$(pwd) printf --verbose sed "$1" 'quoted text'
+		'quoted text' 'quoted text' ${HOME} | 2>/dev/null
+		$(pwd) ${HOME} 2>/dev/null export readonly $(pwd)
+	2>/dev/null done cd 2>/dev/null x=1 done x=1 "$@" 'quoted text'
+	printf sed -eu ${HOME} printf "$1" "$@" && 2>/dev/null
+		test grep awk cd && test then cd && cd cd --verbose
+printf local echo test
+awk done local echo then ${HOME} ${HOME} $(pwd) ${HOME} awk done 'quoted text'
+&& --verbose -eu printf sed grep /usr/bin "$1" readonly sed "$@" awk | 2>/dev/null
+	"$@" then echo test 2>/dev/null printf grep grep && cd cd sed | "$@"
+	${HOME} echo test echo $(pwd) "$1" "$@" sed $(pwd) 'quoted text' $(pwd)
+x=1 then | x=1 "$1" "$1" x=1 local then then printf --verbose "$1" printf
+		cd done local sed "$@" 'quoted text' sed 'quoted text' && /usr/bin "$1" x=1
+	awk then awk "$@" && cd --verbose then /usr/bin awk
+		cd --verbose echo printf done test -eu -eu printf
+		&& -eu ${HOME} grep cd x=1
+		"$@" export -eu /usr/bin --verbose test
+	export printf --verbose "$@" "$1" 2>/dev/null
+	readonly 'quoted text' sed readonly 'quoted text'
+	2>/dev/null "$1" $(pwd) "$@" echo sed $(pwd) echo && cd awk $(pwd)
+$(pwd) 'quoted text' --verbose echo awk
+		done readonly echo "$1" 'quoted text' cd grep readonly /usr/bin 2>/dev/null
+	printf grep readonly "$@" $(pwd) /usr/bin
+		| $(pwd) readonly /usr/bin done 2>/dev/null
+	2>/dev/null cd && sed ${HOME} readonly 2>/dev/null
+readonly /usr/bin awk "$@" x=1 local
+${HOME} $(pwd) cd | ${HOME}
+then sed export printf /usr/bin done then "$@" awk test grep $(pwd)
+		"$@" export 'quoted text' test then test local awk readonly awk | local done sed
+-eu $(pwd) x=1 export --verbose printf "$@" printf then /usr/bin
+	awk sed then done test -eu
+	$(pwd) "$1" --verbose awk x=1 export local
+test 'quoted text' sed done
+x=1 readonly readonly cd -eu done readonly sed "$@" sed | x=1 readonly
+	x=1 awk done done 'quoted text' done export /usr/bin -eu 2>/dev/null
+	${HOME} x=1 local echo 2>/dev/null -eu 'quoted text' /usr/bin
+	&& && sed "$@" && export cd done cd 'quoted text' 2>/dev/null
+		echo printf x=1 | && x=1 done "$@" "$1"
+	sed $(pwd) printf 'quoted text' "$@" | "$@" 2>/dev/null grep && echo "$@" -eu echo
+$(pwd) printf done then && done | 'quoted text'
+/usr/bin sed ${HOME} awk ${HOME} ${HOME} test cd | then export
+done printf cd 'quoted text' "$1" 'quoted text' cd x=1 /usr/bin 2>/dev/null
+		printf grep && $(pwd) awk local ${HOME} export $(pwd) -eu
+done "$@" 2>/dev/null ${HOME} local x=1
+--verbose x=1 awk && --verbose &&
+	grep x=1 test local /usr/bin
+--verbose "$@" echo cd readonly sed | cd $(pwd) "$1" export
+'quoted text' 2>/dev/null local awk done $(pwd) 'quoted text' grep
+		--verbose local | awk cd --verbose $(pwd) -eu echo cd | awk then export
+-eu 'quoted text' ${HOME} grep -eu export echo -eu &&
+		'quoted text' --verbose printf
+	sed done /usr/bin done awk readonly x=1 local
+		then --verbose -eu sed "$@" cd --verbose 2>/dev/null cd printf
+	sed x=1 $(pwd) echo test grep done
+		local | 'quoted text' done -eu | "$@" 'quoted text' $(pwd)
+sed printf printf | -eu sed echo
+		test 'quoted text' ${HOME} $(pwd) readonly x=1 then --verbose $(pwd)
+		/usr/bin test /usr/bin 'quoted text' test 'quoted text'
+| ${HOME} 'quoted text' $(pwd) export 2>/dev/null && "$1"
+		${HOME} --verbose then readonly 'quoted text' "$1" --verbose 2>/dev/null --verbose
+		awk grep 2>/dev/null cd export 2>/dev/null ${HOME} then ${HOME}
+	"$@" export awk $(pwd) printf 'quoted text' export
+	awk done grep | 2>/dev/null
+		"$1" local awk -eu /usr/bin $(pwd) awk "$@" awk
+--verbose cd printf readonly then -eu local $(pwd) cd --verbose
+		$(pwd) 'quoted text' echo | echo --verbose --verbose
+-eu printf "$@" -eu grep printf
+		then readonly done awk
+--verbose local 'quoted text' | test
+	export | ${HOME} --verbose "$@" local /usr/bin awk ${HOME}
+"$@" --verbose then export printf printf
+	echo | 2>/dev/null awk ${HOME} grep printf --verbose "$1" "$@" 2>/dev/null
+/usr/bin local cd /usr/bin printf "$1"
+	test awk --verbose cd && test ${HOME} local
+	local 'quoted text' x=1 --verbose sed awk export local sed --verbose 'quoted text'
+then then $(pwd) cd printf 'quoted text' printf sed ${HOME} local done -eu
+2>/dev/null then 2>/dev/null -eu | echo local $(pwd) echo 'quoted text' 2>/dev/null
+	printf done grep $(pwd) readonly 'quoted text' "$1" --verbose
+		-eu test echo x=1 echo -eu sed /usr/bin 2>/dev/null grep --verbose echo cd
+	echo -eu && test "$1" | ${HOME} printf 2>/dev/null --verbose -eu | local
+		readonly done local "$@" done sed
+		export local --verbose done x=1 x=1 export $(pwd) awk local /usr/bin
+2>/dev/null x=1 | 'quoted text' 'quoted text'
+test grep grep "$1" then local "$1" cd echo 2>/dev/null 'quoted text'
+${HOME} --verbose readonly --verbose x=1 x=1 2>/dev/null
+		printf sed "$@" cd export && x=1
+	awk then && test 2>/dev/null then
+	then 2>/dev/null done sed grep x=1
+--verbose echo grep /usr/bin | /usr/bin readonly done ${HOME}
+	awk echo && echo && /usr/bin /usr/bin test sed x=1 done readonly readonly
+echo --verbose done /usr/bin && test | done test done then local $(pwd) done
+		'quoted text' && export sed | x=1 $(pwd) | grep echo test then
+	"$@" ${HOME} echo && echo
+	"$1" then --verbose grep /usr/bin "$@" local
+		"$1" ${HOME} --verbose | "$1" local done x=1 | "$@" && | "$1" x=1 then
+		"$@" export --verbose local echo then "$1" awk "$@" 'quoted text' /usr/bin
+	test test | then export 2>/dev/null | printf
+	printf ${HOME} "$@" then --verbose
+		$(pwd) ${HOME} then then then awk ${HOME} done
+	'quoted text' ${HOME} x=1 local awk readonly cd 'quoted text' echo --verbose export
+		cd --verbose awk export echo $(pwd) -eu $(pwd) | | ${HOME} $(pwd) "$1" &&
+	--verbose cd test 'quoted text' 'quoted text' x=1 cd printf
+	x=1 && && printf "$1" ${HOME} ${HOME}
+		export | then cd printf grep printf awk export && "$1" x=1 echo
+		sed "$@" then export printf 'quoted text' ${HOME} x=1 -eu echo cd
+| "$1" 2>/dev/null $(pwd) 2>/dev/null
+	2>/dev/null --verbose ${HOME} 'quoted text' local
+		$(pwd) && $(pwd) done 'quoted text' printf done echo cd x=1 local
+		"$@" -eu x=1 export local done then grep && | then local -eu grep
+		export awk printf grep | done $(pwd) awk cd ${HOME} awk then $(pwd)
+local x=1 "$1" printf /usr/bin awk readonly
+	cd --verbose readonly awk printf /usr/bin | cd test printf
+		"$1" && -eu sed done 'quoted text' printf awk /usr/bin /usr/bin x=1 then --verbose
+		-eu readonly done $(pwd)
+		/usr/bin "$1" ${HOME} echo echo | echo ${HOME} printf "$@"
+	grep then 'quoted text' $(pwd) -eu echo test | -eu
+		printf 'quoted text' test x=1 printf readonly ${HOME} "$1" readonly "$1" ${HOME}
+		awk grep 'quoted text'
+	then && sed echo 2>/dev/null
+grep | "$1" $(pwd) cd grep | "$@" test
+grep local local cd "$1" export readonly readonly
+	test "$1" --verbose && cd 2>/dev/null test "$@" 2>/dev/null
+	local cd $(pwd) /usr/bin
+		done /usr/bin "$@" --verbose awk "$@" printf "$@" export "$@"
+x=1 echo printf ${HOME} "$@"
+echo $(pwd) test --verbose "$1" x=1 && done
+		x=1 && sed awk awk test ${HOME} 'quoted text'
+		'quoted text' -eu done grep test -eu local grep | x=1 awk test
+done grep x=1 | -eu done printf 2>/dev/null awk cd cd "$1" ${HOME} x=1 "$1"
+&& && then done done export local cd | /usr/bin x=1
+	done cd cd then 'quoted text' x=1 local
+	readonly /usr/bin $(pwd) 2>/dev/null local
+grep && done -eu --verbose --verbose x=1 printf "$1"
+	cd | "$1" awk local cd sed $(pwd) sed "$@" awk cd export awk 'quoted text'
+		x=1 ${HOME} echo cd x=1 "$1" "$@" local
+	sed cd test awk /usr/bin /usr/bin
+		echo test export "$1" cd /usr/bin
+| /usr/bin "$@" sed "$1" 2>/dev/null export && echo
+then grep | local local ${HOME} | then then echo
+printf | sed ${HOME} readonly $(pwd) sed -eu then
+		${HOME} awk then x=1 done printf $(pwd) ${HOME} /usr/bin
+"$1" then grep && readonly --verbose ${HOME} | sed readonly
+	export && ${HOME} grep cd grep -eu done grep && /usr/bin awk
+		"$@" sed -eu "$1" grep local | done $(pwd) printf 'quoted text'
+		$(pwd) -eu "$@" sed done export ${HOME} "$@" && cd awk
+		awk sed | grep x=1 printf grep x=1 echo |
+	grep 2>/dev/null x=1 $(pwd) "$@"
+		echo 2>/dev/null "$1" "$1" 2>/dev/null
+		/usr/bin "$1" readonly echo then test "$1" -eu -eu x=1 2>/dev/null
+	--verbose cd x=1 "$1" awk awk readonly then
+echo ${HOME} cd readonly "$1" local awk grep then x=1 2>/dev/null
+	--verbose test cd && export x=1 ${HOME} awk "$1" done then 'quoted text'
+--verbose 'quoted text' printf grep
+export -eu /usr/bin awk echo done ${HOME} --verbose then export "$@"
+	2>/dev/null then && 2>/dev/null echo then awk | sed
+	-eu test cd printf && "$@" then ${HOME} $(pwd) awk "$1" export
+		local export "$1" cd readonly ${HOME} 'quoted text' $(pwd)
+		local awk /usr/bin done "$1" && 2>/dev/null sed --verbose /usr/bin -eu done
+	test cd x=1 | --verbose sed then && grep 'quoted text' && "$1" echo 'quoted text'
+	| /usr/bin echo done cd | readonly test $(pwd) grep cd grep awk
+2>/dev/null then readonly awk done done export "$1" echo 'quoted text'
+echo ${HOME} grep grep then /usr/bin | $(pwd) export 2>/dev/null "$1" && 2>/dev/null
+	&& --verbose export x=1 test grep "$@" export 'quoted text'
+		local sed local awk | $(pwd) cd done "$1" sed readonly -eu --verbose
+	test && printf "$@" "$1" 'quoted text' printf 'quoted text'
+$(pwd) x=1 $(pwd) /usr/bin sed export
+		done && local "$1" 2>/dev/null grep -eu grep "$@" /usr/bin "$1" then && $(pwd) "$@"
+"$1" | sed test $(pwd) cd --verbose readonly ${HOME}
+		test --verbose local export then test grep
+	${HOME} test $(pwd) x=1 echo readonly awk | then export cd ${HOME}
+x=1 grep x=1 echo grep
+		done "$1" ${HOME} 2>/dev/null
+echo -eu awk "$1" 'quoted text' ${HOME} "$@" --verbose "$@" export
+then /usr/bin sed grep then x=1 "$@" echo $(pwd) export
+		local $(pwd) export sed --verbose && "$@" done printf | readonly local grep
+		done done | sed local 2>/dev/null $(pwd) 2>/dev/null ${HOME}
+		/usr/bin sed x=1 test x=1 done export
+		${HOME} 2>/dev/null -eu /usr/bin local export ${HOME}
+	"$1" 'quoted text' && 2>/dev/null && -eu test
+done readonly x=1 export "$@" ${HOME} /usr/bin -eu /usr/bin
+&& local x=1 echo test | x=1 | test test -eu awk && local "$1" done
+		printf ${HOME} done readonly $(pwd) cd 'quoted text' && 'quoted text'
+	awk test cd $(pwd) 2>/dev/null $(pwd)
+	then "$@" -eu 2>/dev/null
+	cd cd export done awk printf done /usr/bin done sed
+		cd "$1" && cd "$1" /usr/bin && export then export printf test
+		awk then "$@" -eu | | x=1 printf readonly --verbose awk export $(pwd) grep
+		then | grep $(pwd) then readonly -eu -eu test $(pwd) "$@" sed
+${HOME} "$1" test x=1 && 2>/dev/null ${HOME} -eu 2>/dev/null cd "$@" "$1"
+printf 'quoted text' && printf -eu /usr/bin printf "$1"
+		2>/dev/null "$@" then readonly local then 'quoted text'
+		/usr/bin printf && cd cd test "$@" printf echo "$@"
+	| test grep cd test x=1 'quoted text'
+		echo ${HOME} readonly "$1" sed done echo
+		"$@" ${HOME} "$@" test "$1" $(pwd) && && then test test -eu -eu 'quoted text'
+local cd /usr/bin ${HOME} test grep -eu awk then cd done x=1 cd awk ${HOME}
+	cd local printf grep && export "$1" | 2>/dev/null grep printf $(pwd) $(pwd) done
+printf -eu test 2>/dev/null /usr/bin -eu --verbose sed "$@" cd echo -eu
+		printf x=1 /usr/bin "$@"
+readonly cd | $(pwd) awk export awk "$@" "$@" --verbose
+	echo then $(pwd) done --verbose | grep x=1 /usr/bin && grep $(pwd) --verbose
+	--verbose cd readonly ${HOME} cd grep sed
+cd awk --verbose ${HOME} awk done sed ${HOME} grep
+		-eu "$1" x=1 "$1" 'quoted text' -eu -eu "$1" test then -eu | 2>/dev/null
+	| awk printf 2>/dev/null 'quoted text' cd "$@" echo done export
+sed $(pwd) /usr/bin done && && done x=1 -eu cd readonly export x=1 x=1
+		cd -eu sed x=1 cd ${HOME} 'quoted text'
+		x=1 readonly -eu done cd export then grep cd grep test
+cd "$1" readonly --verbose
+	printf 'quoted text'
+	| echo -eu done --verbose awk done 'quoted text'
+		$(pwd) then -eu "$1" readonly "$1"
+	readonly "$1" readonly printf
+	echo readonly local export done $(pwd) done /usr/bin readonly 2>/dev/null
+	x=1 local x=1 "$@" "$1" | local --verbose
+		"$1" "$1" | "$1" cd 'quoted text' local local export 2>/dev/null awk done
+	-eu done "$1" ${HOME} /usr/bin 2>/dev/null -eu && echo local /usr/bin
+'quoted text' test -eu -eu then
+	local done "$1" local x=1 sed --verbose 'quoted text' 2>/dev/null cd grep cd
+	$(pwd) local "$1" x=1 printf sed 'quoted text'
+test local ${HOME} cd grep echo && done "$@" sed printf grep 2>/dev/null
+readonly 2>/dev/null ${HOME} echo readonly ${HOME} export
+	"$1" then local "$1" x=1 | "$@" $(pwd) echo
+printf /usr/bin x=1 --verbose readonly "$1" sed -eu echo then awk readonly
+	printf "$1" ${HOME} grep /usr/bin export
+2>/dev/null local $(pwd) | cd then --verbose
+		2>/dev/null -eu 2>/dev/null local grep -eu 'quoted text'
+	'quoted text' "$@" sed x=1
+		cd printf echo && -eu awk local cd printf $(pwd) cd then "$@" readonly
+	--verbose && | then grep
+	'quoted text' done --verbose --verbose -eu
+		--verbose "$@" $(pwd) local then /usr/bin awk 'quoted text'
+	echo "$1" 'quoted text' /usr/bin
+printf "$@" done done cd grep "$1" --verbose
+	sed local cd $(pwd) $(pwd) readonly $(pwd) "$@" "$1"
+		"$@" "$@" "$@" --verbose echo cd && export local /usr/bin awk
+	$(pwd) x=1 cd awk test grep sed printf echo && echo test | export -eu grep printf
+-eu 2>/dev/null "$1"
+| then cd "$@" $(pwd) x=1 --verbose echo test echo cd ${HOME} $(pwd) echo |
+	then then && /usr/bin export
+		-eu local cd test 'quoted text' export && "$1" awk | sed readonly readonly
+		awk -eu | -eu /usr/bin grep echo readonly then && readonly
+		"$1" "$1" echo $(pwd) local $(pwd)
+	test awk 2>/dev/null grep export printf 'quoted text' export && x=1 printf
+	printf grep echo readonly readonly $(pwd) 'quoted text' export printf sed printf
+	"$1" printf export | echo 2>/dev/null grep 2>/dev/null
+&& cd --verbose export 'quoted text' test
+2>/dev/null -eu done awk --verbose
+	sed done $(pwd) printf 2>/dev/null 'quoted text' x=1
+$(pwd) x=1 grep && -eu then ${HOME} "$1" export printf
+		"$1" grep | ${HOME} cd 'quoted text' done readonly sed readonly awk 'quoted text'
+		grep export local /usr/bin /usr/bin
+export test /usr/bin /usr/bin printf test -eu /usr/bin export
+		then $(pwd) readonly done -eu $(pwd) -eu $(pwd) -eu echo
+	grep && done export echo then grep sed sed test "$@" export 'quoted text'
+grep --verbose then -eu done test "$1"
+	printf printf awk 2>/dev/null "$@" sed "$@" sed 2>/dev/null 'quoted text'
+	| awk 'quoted text' awk sed -eu printf 'quoted text'
+		--verbose 'quoted text' cd grep $(pwd) test x=1 /usr/bin
+	$(pwd) done then then 'quoted text'
+	then then grep $(pwd) ${HOME} local printf 'quoted text' local
+grep sed --verbose export
+readonly test grep --verbose done | local grep printf sed && | "$1" printf
+		done 'quoted text' then test grep done cd cd
+		export && -eu --verbose test /usr/bin $(pwd) $(pwd)
+sed ${HOME} printf x=1
+then done /usr/bin ${HOME} test readonly sed then -eu done 2>/dev/null
+	test printf ${HOME} sed then echo -eu
+	readonly then "$@" awk --verbose /usr/bin "$1" | 2>/dev/null ${HOME} done
+	printf awk x=1 then ${HOME} local readonly && local done
+		"$@" awk 2>/dev/null | ${HOME}
+${HOME} local | 2>/dev/null
+echo -eu printf printf readonly && export x=1 awk
+		grep 2>/dev/null ${HOME}
+readonly x=1 $(pwd) done cd x=1 grep | grep sed then
+x=1 && done 2>/dev/null /usr/bin "$@"
+$(pwd) printf "$@" then printf
+		"$1" ${HOME} x=1 x=1 x=1 x=1 cd
+	echo /usr/bin | echo export x=1 cd done cd 'quoted text' printf awk 2>/dev/null
+	"$@" x=1 --verbose grep sed && ${HOME} local printf
+		-eu 'quoted text' -eu done sed export printf grep then --verbose
+	done readonly then sed then 'quoted text'
+printf -eu | $(pwd) grep grep cd echo
+		| /usr/bin $(pwd) readonly --verbose x=1 local
+	done then 2>/dev/null local readonly then "$@" x=1 | printf 'quoted text'
+		done "$@" cd cd then x=1 "$1" test then "$1" then 'quoted text'
+		| 'quoted text' ${HOME} sed done printf ${HOME} /usr/bin test
+readonly echo x=1 "$1" --verbose /usr/bin echo -eu printf --verbose then local
+	--verbose echo test | --verbose readonly
+local echo then | awk /usr/bin /usr/bin readonly
+echo && $(pwd) export "$1" done echo /usr/bin
+	| --verbose ${HOME} && -eu readonly then "$@" /usr/bin x=1 then ${HOME} cd
+	local && grep cd test && export $(pwd) export && cd printf
+		| && grep readonly readonly awk grep then done export
+readonly --verbose ${HOME} ${HOME} ${HOME} printf "$1" grep sed grep
+"$1" x=1 echo ${HOME} awk sed grep "$@" echo echo test test readonly export /usr/bin
+printf "$1" test sed | export x=1 'quoted text' 2>/dev/null
+done -eu readonly $(pwd) | -eu sed test then $(pwd)
+	"$@" 2>/dev/null 2>/dev/null awk "$@" then readonly
+	local grep done export then
+	echo grep --verbose then "$@" --verbose "$@" --verbose 'quoted text' | --verbose
+test x=1 "$@" printf "$1"
+'quoted text' export && echo awk
+${HOME} 'quoted text' export --verbose && 'quoted text'
+		${HOME} sed export then "$1" && grep 2>/dev/null "$1" &&
+		done echo -eu readonly
+		&& 2>/dev/null awk "$1" test "$1" printf export --verbose "$@"
+	local printf cd "$@" echo && then
+	"$1" --verbose && grep grep | local echo local | local echo done ${HOME}
+	| 'quoted text' && | 'quoted text'
+	${HOME} grep x=1 -eu sed | && "$@" 'quoted text' printf x=1 ${HOME} cd
+	2>/dev/null grep printf | && -eu local 2>/dev/null
+'quoted text' grep done awk awk awk
+	cd awk -eu --verbose 2>/dev/null test x=1 echo sed printf done --verbose
+		test grep "$1" cd x=1 awk ${HOME} export printf
+	export "$@" "$1" grep /usr/bin printf sed "$1" cd awk "$1"
+	done local test then awk && 'quoted text' | grep readonly -eu
+		2>/dev/null $(pwd) done && ${HOME} done export 2>/dev/null 'quoted text'
+	-eu done printf test test awk grep /usr/bin
+		${HOME} cd test ${HOME} "$1" 'quoted text' | "$1" $(pwd) "$1" printf --verbose
+test echo x=1 /usr/bin awk --verbose done awk readonly
+	then echo "$1" test x=1
+		printf "$@" -eu awk then 'quoted text' -eu done --verbose ${HOME} grep
+	--verbose local cd local then then sed $(pwd) export
+	then readonly /usr/bin grep then
+export sed grep && /usr/bin $(pwd)
+		-eu local -eu ${HOME} /usr/bin 2>/dev/null awk -eu test
+done -eu awk --verbose ${HOME} $(pwd) echo then awk
+		grep $(pwd) grep sed echo "$1" "$@" test done
+	x=1 grep local echo ${HOME} 2>/dev/null
+		-eu | then sed grep x=1 && x=1 /usr/bin
+2>/dev/null /usr/bin | "$@" && $(pwd) cd "$1" done echo cd ${HOME} x=1
+	readonly -eu && sed 2>/dev/null
+	grep cd cd grep echo cd $(pwd) 2>/dev/null awk sed local && 2>/dev/null local 2>/dev/null
+		&& ${HOME} && grep echo cd $(pwd) echo printf $(pwd) "$1" then x=1 local sed
+	"$@" && export test /usr/bin printf export && printf test 2>/dev/null "$@" test
+		sed ${HOME} ${HOME} -eu done then 2>/dev/null done | /usr/bin ${HOME}
+	awk x=1 $(pwd) 2>/dev/null local echo
+	-eu | export $(pwd) grep sed test "$1" 'quoted text'
+		-eu local "$@" readonly grep $(pwd) x=1 readonly | x=1 --verbose
+	sed readonly test "$@" printf && &&
+	then "$1" echo x=1 | sed sed 'quoted text' && 'quoted text' 2>/dev/null
+-eu $(pwd) printf local 'quoted text' export local | "$1" --verbose $(pwd) | grep
+		${HOME} 'quoted text' 2>/dev/null | && 'quoted text'
+	${HOME} then -eu grep -eu
+		echo sed && -eu -eu printf 'quoted text' done --verbose "$1" 2>/dev/null sed
+	awk echo 2>/dev/null awk 2>/dev/null "$@" "$@" --verbose ${HOME} then printf
+--verbose /usr/bin then done "$1" readonly grep printf 2>/dev/null sed
+	$(pwd) then readonly $(pwd) echo "$@" grep && "$@" /usr/bin "$@"
+--verbose && sed ${HOME} then "$1"
+	local readonly -eu ${HOME}
+		2>/dev/null local 'quoted text' /usr/bin ${HOME} awk && done
+	-eu 'quoted text' printf echo
+	test grep then $(pwd) readonly "$1" cd
+		then export cd echo echo test 'quoted text' /usr/bin --verbose printf test /usr/bin
+$(pwd) --verbose x=1 /usr/bin "$@" --verbose
+		| 'quoted text' ${HOME} then export | 'quoted text' "$@" "$1" awk x=1 local printf
+		-eu $(pwd) test x=1 "$1" printf 'quoted text' x=1 /usr/bin /usr/bin printf printf
+test "$1" readonly sed | x=1 done x=1 "$1" | /usr/bin 2>/dev/null sed | echo
+	cd 2>/dev/null /usr/bin grep awk && && $(pwd) grep cd
+		${HOME} /usr/bin "$@" 'quoted text' awk awk 2>/dev/null grep
+	/usr/bin x=1 done awk "$@" ${HOME} | done x=1 'quoted text' $(pwd) "$1"
+		"$@" local x=1 awk grep "$1" $(pwd)
+	test -eu sed 'quoted text'
+	test "$1" test cd ${HOME} local -eu done
+		echo sed --verbose "$1" -eu export then grep readonly 'quoted text'
+${HOME} local | cd 2>/dev/null awk sed readonly
+		done cd awk export sed | then x=1 export && 2>/dev/null local awk test
+"$@" "$1" "$1" sed | --verbose "$@" x=1 then printf /usr/bin ${HOME} echo
+then then awk 'quoted text' export test x=1 x=1 --verbose /usr/bin "$1"
+	readonly readonly done | 2>/dev/null
+		awk 'quoted text' awk "$1" -eu $(pwd) 2>/dev/null "$1" printf sed ${HOME}
+'quoted text' $(pwd) | --verbose /usr/bin echo /usr/bin && export 2>/dev/null
+	2>/dev/null done cd then ${HOME} -eu test && sed x=1
+readonly awk sed 'quoted text' x=1 cd --verbose
+	&& grep ${HOME} && "$1" echo 'quoted text' echo
+	then $(pwd) | "$@" "$1"
+echo done then ${HOME} then
+		then /usr/bin -eu test x=1 -eu awk $(pwd) printf then --verbose
+		x=1 x=1 x=1 awk then echo done readonly test grep done local ${HOME} sed readonly
+	echo x=1 cd done done grep test
+	$(pwd) readonly --verbose 'quoted text' then cd test -eu echo then
+test | done sed --verbose --verbose 2>/dev/null
+	grep readonly awk ${HOME} | sed
+then "$1" 'quoted text' printf cd $(pwd) readonly | "$@" -eu ${HOME} cd $(pwd)
+	readonly "$1" $(pwd) printf ${HOME} && readonly local sed "$@" done local "$1"
+cd 'quoted text' echo export done
+cd ${HOME} echo echo sed then $(pwd) local 2>/dev/null sed then printf 2>/dev/null
+readonly 'quoted text' local test export done -eu
+		printf printf printf awk /usr/bin export readonly then "$@" --verbose grep
+x=1 grep | printf | 'quoted text'
+		$(pwd) "$@" $(pwd) grep 'quoted text'
+		local readonly "$1" x=1 x=1
+		'quoted text' readonly && readonly test export -eu export "$@"
+grep readonly | awk readonly echo 'quoted text'
+		"$@" && readonly 'quoted text' echo awk awk grep && sed && 'quoted text'
+		2>/dev/null echo --verbose -eu "$@"
+	done x=1 readonly export && x=1 export done
+	"$@" && -eu x=1 printf grep readonly
+		test printf | 'quoted text' then /usr/bin |
+		| sed && && export test grep then 'quoted text' local ${HOME} x=1 test local
+		2>/dev/null export /usr/bin sed 2>/dev/null awk grep /usr/bin echo export 'quoted text'
+&& --verbose test && echo then && readonly cd cd then
+	done --verbose "$@" "$@" -eu -eu 2>/dev/null "$1" "$@" grep $(pwd) awk cd ${HOME}
+		"$1" $(pwd) sed x=1 $(pwd) 2>/dev/null
+		${HOME} | cd "$1" done then $(pwd) 2>/dev/null
+		/usr/bin 2>/dev/null --verbose && && --verbose
+	sed "$@" /usr/bin printf
+		export readonly cd 2>/dev/null
+| $(pwd) grep sed then grep --verbose sed "$@" -eu grep local ${HOME}
+		"$@" -eu /usr/bin test cd -eu ${HOME} echo
+		local export done "$1" $(pwd) | readonly 'quoted text'
+	then then then --verbose
+--verbose printf local --verbose -eu export x=1 local echo grep sed sed echo
+echo grep /usr/bin done
+	2>/dev/null -eu printf grep /usr/bin
+$(pwd) done readonly sed ${HOME} printf export 'quoted text'
+		| x=1 | 2>/dev/null test "$1" --verbose
+		cd then grep local awk printf local grep echo
+local local done | 2>/dev/null then --verbose cd 'quoted text'
+		| 2>/dev/null "$@" printf sed | local grep $(pwd) --verbose then x=1 2>/dev/null
+then export /usr/bin --verbose | echo printf
+		--verbose then readonly
+		awk readonly export -eu 2>/dev/null "$@" --verbose then
+	sed "$1" test 'quoted text' echo test ${HOME}
+		then 'quoted text' -eu echo export
+	sed done done 2>/dev/null cd awk local export export $(pwd) "$1" cd export
+"$1" then "$1" x=1 test printf cd sed printf export /usr/bin
+		sed && printf x=1 && local done | && test echo done "$1" cd -eu ${HOME}
+	"$@" /usr/bin -eu echo cd x=1 cd echo x=1 --verbose readonly printf
+	${HOME} then 2>/dev/null /usr/bin /usr/bin done export x=1
+then grep && 'quoted text'
+		grep /usr/bin --verbose awk 'quoted text' | x=1 test --verbose readonly
+	2>/dev/null x=1 local cd sed 2>/dev/null
+	awk $(pwd) | 2>/dev/null 'quoted text' /usr/bin
+sed export awk | 'quoted text' --verbose $(pwd) readonly export
+/usr/bin echo x=1 echo $(pwd) printf "$@" | then $(pwd) 2>/dev/null "$@" "$@" export
+	test export done | grep --verbose export && grep | local && | cd printf readonly
+	| 2>/dev/null 'quoted text' ${HOME} -eu && test --verbose
+	x=1 then && local readonly grep echo --verbose
+${HOME} awk | then /usr/bin done test
+	awk && printf grep $(pwd) | sed 2>/dev/null
+		readonly export -eu "$@" local done echo done
+	local then 'quoted text' echo ${HOME} $(pwd) echo done | echo awk done
+	grep readonly ${HOME} $(pwd) x=1 sed
+${HOME} awk --verbose x=1 -eu test
+'quoted text' then x=1 done done 2>/dev/null $(pwd) | -eu
+done cd awk export 2>/dev/null $(pwd)
+	"$1" printf printf awk 'quoted text' printf done echo
+	done echo sed awk test test echo readonly cd sed
+	$(pwd) $(pwd) grep readonly then then awk grep
+--verbose local awk | test --verbose done ${HOME} ${HOME} 'quoted text'
+| then sed --verbose awk awk printf
+	grep 'quoted text' done /usr/bin local $(pwd) grep echo ${HOME} local
+	&& test cd -eu "$@" 'quoted text' printf /usr/bin -eu readonly $(pwd) grep export
+		&& grep x=1 /usr/bin test grep --verbose $(pwd)
+	$(pwd) done /usr/bin --verbose
+local /usr/bin && printf printf readonly | then --verbose
+then sed test export --verbose $(pwd) readonly printf awk --verbose
+	'quoted text' $(pwd) --verbose
+awk "$1" grep 'quoted text' test 2>/dev/null "$@" | grep "$1" --verbose sed
+echo sed done 'quoted text' "$1" then grep /usr/bin /usr/bin --verbose -eu
+cd echo grep $(pwd) echo printf ${HOME} sed done
+'quoted text' -eu /usr/bin 2>/dev/null "$1" awk then export
+		echo readonly sed cd echo
+		export export grep local test sed test printf
+	printf grep awk test readonly done
+		test awk test export test grep $(pwd)
+		/usr/bin printf grep --verbose -eu x=1 done 2>/dev/null
+		export --verbose sed local readonly done done 2>/dev/null printf /usr/bin
+x=1 --verbose awk -eu awk --verbose $(pwd) 'quoted text'
+	"$@" ${HOME} echo 2>/dev/null -eu local test sed local 'quoted text'
+		| done x=1 /usr/bin cd readonly "$1" grep --verbose local then awk cd sed readonly
+	&& local test 2>/dev/null export sed
+echo $(pwd) $(pwd) awk "$1" test test local awk done
+	'quoted text' "$@" sed --verbose echo test
+-eu sed /usr/bin readonly cd "$1" then -eu -eu --verbose -eu x=1 printf
+	${HOME} x=1 awk done --verbose
+	${HOME} then readonly ${HOME}
+		| sed -eu done | && test "$1" grep sed 'quoted text' 'quoted text'
+"$1" sed export local | /usr/bin 'quoted text' 2>/dev/null
+	sed awk 2>/dev/null /usr/bin cd && 2>/dev/null echo then
+	/usr/bin /usr/bin --verbose sed x=1 2>/dev/null test
+		${HOME} x=1 $(pwd) echo /usr/bin echo 2>/dev/null 'quoted text' export then
+echo cd && $(pwd) then export sed printf "$@" awk sed
+		awk $(pwd) printf | readonly echo "$1" grep --verbose
+		| && /usr/bin printf readonly export export grep cd x=1 done test test
+	then grep && local printf awk x=1 x=1 then x=1
+		--verbose 'quoted text' 2>/dev/null export /usr/bin | x=1 cd grep 'quoted text'
+		/usr/bin "$@" readonly
+"$1" /usr/bin $(pwd) sed ${HOME} echo 'quoted text' -eu "$1" grep --verbose echo
+test awk "$1" readonly awk local cd readonly
+	echo "$@" -eu "$1" export done echo && 2>/dev/null 2>/dev/null "$1" grep
+		2>/dev/null 'quoted text' grep
+"$@" x=1 "$1" export 2>/dev/null /usr/bin test
+		'quoted text' sed then sed awk $(pwd) awk export
+	cd readonly cd then sed /usr/bin cd readonly awk export $(pwd) /usr/bin
+		--verbose readonly then ${HOME} x=1 --verbose test
+x=1 | | --verbose awk printf x=1 sed export /usr/bin sed "$1" local 2>/dev/null
+'quoted text' local 'quoted text'
+	"$1" /usr/bin --verbose readonly 2>/dev/null x=1 local printf
+done printf awk $(pwd) && test 2>/dev/null --verbose awk --verbose local
+local $(pwd) "$@" ${HOME} 'quoted text' 2>/dev/null --verbose export
+test readonly $(pwd) x=1 done then 'quoted text' done awk 'quoted text'
+local sed cd -eu --verbose awk 2>/dev/null then
+	${HOME} $(pwd) -eu 2>/dev/null local 2>/dev/null
+export sed "$1" "$@" | cd then cd
+	/usr/bin x=1 "$@" cd then ${HOME} $(pwd) sed grep |
+		echo ${HOME} $(pwd) "$1" printf export sed grep
+		test "$1" readonly -eu readonly 'quoted text' awk printf 2>/dev/null |
+	test /usr/bin echo x=1 done then cd $(pwd)
+2>/dev/null 2>/dev/null --verbose grep 'quoted text' "$1" -eu grep
+		"$1" --verbose && --verbose "$1" 'quoted text' grep /usr/bin
+		then grep export printf then printf
+	cd && done done ${HOME} local
+	readonly sed awk done printf x=1 -eu test 'quoted text'
+then local sed then /usr/bin sed readonly local then | && 'quoted text' awk x=1
+		then awk then /usr/bin ${HOME} 'quoted text'
+		cd cd /usr/bin local $(pwd) local && printf sed -eu 'quoted text'
+"$1" 'quoted text' test | 'quoted text' readonly printf echo local then echo
+2>/dev/null "$@" test local echo 2>/dev/null "$@"
+	then cd --verbose cd "$@" --verbose readonly $(pwd) echo
+		/usr/bin awk "$@" -eu readonly export cd "$@"
+	x=1 local echo | 2>/dev/null readonly && "$@" && cd cd && test then done -eu
+		&& local done printf $(pwd) 'quoted text' && /usr/bin
+		| -eu && 'quoted text' local printf readonly
+&& sed awk && 'quoted text' "$@" && grep -eu sed $(pwd) $(pwd)
+		&& $(pwd) --verbose printf 'quoted text' "$@" 'quoted text'
+		"$1" $(pwd) --verbose && readonly printf awk done local then
+	${HOME} readonly 'quoted text'
+		${HOME} ${HOME} then export $(pwd) 'quoted text'
+grep && readonly && local
+		--verbose "$@" sed && "$1" echo cd 'quoted text' ${HOME} $(pwd)
+	/usr/bin local /usr/bin export
+		"$1" $(pwd) export --verbose echo x=1 sed printf local ${HOME} grep then then
+		printf cd | $(pwd) $(pwd) local "$@" sed --verbose export export "$1" 2>/dev/null
+echo done /usr/bin "$1" "$@" "$@"
+		"$1" $(pwd) 2>/dev/null grep
+	export readonly sed "$1"
+		done && echo 2>/dev/null
+	-eu local readonly 'quoted text' "$1" | grep sed 'quoted text'
+printf test then grep x=1 "$1" sed sed && /usr/bin readonly done $(pwd)
+		test && test "$@" $(pwd) grep 'quoted text' x=1 -eu "$1"
+'quoted text' printf ${HOME} cd export readonly -eu /usr/bin
+local /usr/bin 2>/dev/null awk grep
+readonly -eu local "$1" $(pwd) --verbose
+		grep && "$@" 'quoted text' printf && | sed && sed -eu
+	${HOME} x=1 cd sed export
+	sed x=1 local | && "$@" grep
+then "$@" "$@" /usr/bin
+done ${HOME} "$@" echo printf
+		x=1 readonly /usr/bin /usr/bin done awk 2>/dev/null
+	local "$@" grep --verbose sed echo x=1 2>/dev/null --verbose
+	cd done $(pwd) local printf 2>/dev/null
+	grep test export readonly echo "$@" | readonly done "$@" grep | ${HOME}
+$(pwd) test echo "$1"
+	-eu && "$1" readonly 2>/dev/null
+	readonly "$@" | -eu local "$1" "$1"
+	awk export && readonly "$@" --verbose cd echo x=1 export test $(pwd) export "$1"
+echo "$@" --verbose "$1" 'quoted text'
+	--verbose printf awk sed --verbose grep export echo && echo /usr/bin $(pwd)
+	"$@" x=1 'quoted text' && cd "$1" 2>/dev/null | "$1"
+	"$@" grep 2>/dev/null -eu && | x=1 && x=1
+		test echo done export printf ${HOME}
+	"$1" 2>/dev/null 2>/dev/null printf export $(pwd) && awk "$@" $(pwd) x=1 "$1"
+2>/dev/null x=1 && export test
+		test 2>/dev/null done local
+		'quoted text' 'quoted text' export -eu x=1 && readonly
+$(pwd) awk "$1" ${HOME} echo 2>/dev/null printf echo printf grep -eu ${HOME}
+${HOME} export x=1 export test && && echo test done $(pwd)
+		'quoted text' "$1" export && ${HOME} && ${HOME} printf --verbose cd
+		grep "$1" readonly $(pwd) -eu
+	export awk local 'quoted text' echo
+		test cd && /usr/bin "$@" awk cd
+	2>/dev/null export done |
+	/usr/bin test echo echo then "$@" cd export awk
+		"$@" export -eu 'quoted text' sed readonly | cd done /usr/bin
+/usr/bin test | && sed
+	sed local x=1 echo "$1" echo
+		readonly && -eu sed /usr/bin local test readonly readonly ${HOME} test
+	/usr/bin && readonly 'quoted text'
+then sed --verbose grep test /usr/bin
+$(pwd) /usr/bin local ${HOME} "$@" done ${HOME} local awk x=1 cd readonly
+"$1" grep done -eu readonly readonly grep
+&& 'quoted text' test x=1 done $(pwd) export
+echo "$1" 'quoted text' readonly printf
+	done cd awk -eu && grep 2>/dev/null && cd printf test
+	readonly --verbose cd export cd
+	&& sed readonly --verbose --verbose "$1" then local $(pwd) | grep grep
+		awk x=1 -eu test done readonly test -eu "$1" ${HOME} | | then readonly then
+		&& "$1" && ${HOME} 'quoted text' done local echo && 'quoted text' printf
+&& && done 'quoted text' readonly
+	x=1 ${HOME} 'quoted text' readonly
+		printf awk ${HOME} x=1 x=1 ${HOME} "$@" "$@" 'quoted text'
+export awk /usr/bin "$1" | && export && --verbose 'quoted text'
+#include c47.sh
+	&& awk cd then --verbose grep 2>/dev/null 2>/dev/null test awk "$1" | export
+	x=1 "$@" && 2>/dev/null test readonly then ${HOME}
+	grep 2>/dev/null ${HOME} echo && "$@" && printf && done "$@"
+	2>/dev/null /usr/bin grep --verbose export "$@"
+	echo cd local x=1 "$1" ${HOME} --verbose 'quoted text'
+		sed && then echo --verbose 2>/dev/null /usr/bin grep test --verbose "$1" test
+		done export sed export "$@"
+		test cd && 2>/dev/null x=1
+		--verbose printf /usr/bin --verbose --verbose export test echo "$@" $(pwd)
+'quoted text' --verbose | ${HOME} local 2>/dev/null cd grep local
+		export readonly | --verbose
+grep 2>/dev/null cd 2>/dev/null --verbose done export | readonly awk cd local
+	printf x=1 echo done -eu export readonly "$@" 'quoted text' --verbose
+	"$1" echo $(pwd) $(pwd) export test
+		cd awk local x=1 x=1 test cd echo sed /usr/bin
+	$(pwd) readonly export $(pwd) "$@" awk cd local -eu
+$(pwd) x=1 printf awk sed grep test --verbose | -eu | local cd 'quoted text'
+		-eu readonly export readonly export x=1 local echo
+sed 2>/dev/null export 2>/dev/null
+	local test test -eu test x=1 readonly && done ${HOME} 2>/dev/null readonly ${HOME}
+-eu ${HOME} done 'quoted text' /usr/bin printf
+		--verbose then echo && 'quoted text'
+readonly grep && 'quoted text'
+| ${HOME} export ${HOME}
+	/usr/bin $(pwd) then /usr/bin 'quoted text' test 2>/dev/null
+		x=1 echo ${HOME} test sed export done 'quoted text' "$@" printf $(pwd) printf
+"$@" grep local awk grep grep export "$1" ${HOME} "$@" done
+cd | -eu printf /usr/bin cd
+	awk then -eu -eu sed --verbose cd "$@" readonly
+		$(pwd) grep /usr/bin --verbose readonly readonly awk
+&& sed ${HOME} "$@" grep echo awk /usr/bin | 2>/dev/null x=1 x=1 --verbose &&
+	cd --verbose test /usr/bin test "$1" echo awk 2>/dev/null
+| 'quoted text' ${HOME} x=1 "$@" then export "$@" x=1 'quoted text'
+		test 'quoted text' $(pwd) printf | "$1" export
+	| --verbose grep sed printf -eu grep
+		2>/dev/null | | echo && cd -eu /usr/bin
+	&& awk ${HOME} && printf then 'quoted text' cd awk | cd awk --verbose done done
+		-eu local /usr/bin $(pwd) --verbose export
+/usr/bin x=1 test printf
+/usr/bin $(pwd) grep 'quoted text'
+done export test 'quoted text' "$@" test ${HOME} 'quoted text' ${HOME}
+		/usr/bin && $(pwd) /usr/bin && then export test
+		done ${HOME} readonly done "$@" readonly
+${HOME} "$1" "$@" cd --verbose "$1" $(pwd)
+	test ${HOME} "$@" $(pwd)
+	$(pwd) sed "$@" "$1" && then && sed ${HOME}
+		printf ${HOME} cd then awk cd printf "$1" cd &&
+'quoted text' export awk then
+--verbose local --verbose "$1" && cd sed -eu 'quoted text' grep cd
+&& && "$@" "$@" done awk echo local
+	$(pwd) x=1 echo "$1" $(pwd) --verbose cd 'quoted text' cd /usr/bin 'quoted text'
+	export -eu export awk export then awk export | grep test -eu awk done
+	x=1 printf --verbose | --verbose
+		echo echo ${HOME} echo -eu awk 'quoted text' done 2>/dev/null ${HOME}
+cd 2>/dev/null $(pwd) local grep echo readonly
+export "$@" /usr/bin && "$1" --verbose readonly "$1"
+	readonly -eu && local test x=1
+		awk $(pwd) --verbose export export ${HOME} ${HOME} --verbose
+	grep "$@" cd "$1" grep 'quoted text' ${HOME} 2>/dev/null then x=1
+| test awk export cd ${HOME} && 'quoted text' $(pwd)
+| local x=1 cd x=1 "$@" 'quoted text' printf "$1" done test | -eu "$1" grep
+		export -eu then x=1 && "$1" test local x=1 ${HOME} then --verbose export
+		/usr/bin 2>/dev/null readonly local 'quoted text' "$1" ${HOME}
+	done local cd --verbose | printf 'quoted text' "$@" grep printf ${HOME}
+	test readonly 2>/dev/null echo
+		awk ${HOME} ${HOME} echo "$1" x=1 readonly sed sed
+x=1 test sed "$@" --verbose sed 'quoted text' echo grep 2>/dev/null x=1 x=1
+	awk --verbose x=1 sed done && && -eu readonly ${HOME} 'quoted text' grep | |
+"$1" /usr/bin export readonly | $(pwd) "$1" export
+printf x=1 sed "$@" /usr/bin && -eu "$@" echo
+	test readonly $(pwd) sed sed awk readonly done local -eu $(pwd) | readonly grep
+	| cd && "$1" && grep export readonly 2>/dev/null $(pwd)
+	/usr/bin printf $(pwd) | grep 2>/dev/null done cd readonly
+	local local 2>/dev/null "$1" x=1 --verbose 2>/dev/null test echo test 'quoted text'
+		${HOME} -eu printf x=1 'quoted text' printf echo then $(pwd) test local
+/usr/bin printf -eu export sed done ${HOME} sed done | x=1 -eu $(pwd) ${HOME}
+	x=1 /usr/bin done readonly export /usr/bin done x=1 x=1 'quoted text' test echo
+		| x=1 then cd awk | "$1"
+	readonly sed echo local x=1 &&
+awk 2>/dev/null grep /usr/bin then | awk echo grep 'quoted text' local done 2>/dev/null
+		-eu grep sed done export x=1 | test
+then printf awk then done echo x=1 $(pwd) printf x=1 printf readonly
+		-eu readonly echo -eu test cd export --verbose && | 'quoted text'
+		done export --verbose echo |
+		-eu local readonly $(pwd)
+x=1 2>/dev/null -eu x=1 ${HOME} "$1" cd
+| done test then export printf "$1" 2>/dev/null /usr/bin echo cd
+"$1" local -eu ${HOME} 'quoted text' echo 'quoted text' | && grep && local
+	$(pwd) sed 2>/dev/null echo --verbose /usr/bin cd
+		awk then cd && "$1" grep then readonly
+$(pwd) && /usr/bin sed x=1 $(pwd) cd | $(pwd)
+--verbose $(pwd) "$@" export /usr/bin
+local local readonly cd awk -eu 'quoted text' $(pwd) "$1" 'quoted text'
+	/usr/bin | done grep local 'quoted text' $(pwd) test awk -eu
+	/usr/bin --verbose /usr/bin && readonly && export cd /usr/bin /usr/bin
+		$(pwd) grep "$1" "$1" local export awk --verbose
+		"$@" readonly export x=1 grep export && echo grep readonly
+2>/dev/null export ${HOME} "$1" 2>/dev/null echo readonly
+	export grep "$@" /usr/bin -eu readonly | x=1 local $(pwd) "$@" /usr/bin
+		| test sed done --verbose -eu "$@"
+		$(pwd) test --verbose 2>/dev/null test then export "$1"
+		x=1 2>/dev/null -eu sed "$1" ${HOME} x=1 2>/dev/null
+	"$1" cd 2>/dev/null ${HOME} grep 2>/dev/null
+		-eu && && test test | sed grep $(pwd) $(pwd) $(pwd)
+export "$1" readonly "$1" "$1" && printf 2>/dev/null
+sed sed $(pwd) $(pwd) test then readonly cd --verbose 2>/dev/null --verbose
+then export "$1" readonly -eu export 'quoted text' cd cd "$@" local --verbose
+	2>/dev/null $(pwd) x=1
+'quoted text' $(pwd) printf test | --verbose && done sed test $(pwd)
+		"$1" echo 2>/dev/null --verbose done "$@" local echo $(pwd) --verbose -eu 2>/dev/null
+${HOME} /usr/bin 'quoted text' printf
+	local readonly "$@" cd
+readonly test 2>/dev/null export local awk echo ${HOME}
+readonly 'quoted text' test printf ${HOME} export 'quoted text'
+	'quoted text' readonly && echo local "$@" local | export printf | "$1" grep
+	test "$1" echo 'quoted text'
+		2>/dev/null --verbose then grep ${HOME}
+		$(pwd) && cd cd --verbose --verbose 2>/dev/null /usr/bin printf local "$@"
+		readonly done ${HOME} cd local echo export test 2>/dev/null && readonly
+	x=1 "$1" cd 'quoted text' --verbose $(pwd) /usr/bin awk "$1" printf && /usr/bin
+	export -eu readonly -eu "$1" -eu test cd "$1" $(pwd) printf done 'quoted text'
+	test /usr/bin "$@" sed ${HOME} "$1" cd export echo
+--verbose && $(pwd) grep
+then 2>/dev/null cd grep export readonly "$1" printf
+	done ${HOME} -eu export printf 'quoted text'
+	"$1" awk echo test "$@" --verbose done ${HOME} && -eu grep | export local -eu "$@"
+		done "$1" awk done cd printf grep $(pwd)
+	x=1 local -eu --verbose grep $(pwd) grep $(pwd)
+		&& test ${HOME} "$1" 2>/dev/null x=1 test then awk grep ${HOME}
+	&& cd local 'quoted text' local /usr/bin
+		"$@" cd --verbose echo x=1 export -eu
+		echo printf 2>/dev/null cd | export && ${HOME}
+| "$@" export printf printf echo
+2>/dev/null $(pwd) 2>/dev/null 2>/dev/null 'quoted text' cd readonly echo 2>/dev/null
+&& grep echo echo test printf
+"$@" cd test done ${HOME} 'quoted text' echo sed
+	cd 'quoted text' ${HOME} x=1 echo "$@" test done $(pwd) test
+| /usr/bin awk sed done $(pwd) | && awk x=1 awk $(pwd)
+		done echo test grep ${HOME}
+${HOME} awk -eu $(pwd) export local | printf 2>/dev/null "$@" "$@" 'quoted text'
+2>/dev/null | done -eu $(pwd) "$@" export /usr/bin "$@" grep --verbose
+	readonly $(pwd) awk readonly then echo | sed x=1 $(pwd) echo && printf
+grep echo grep 'quoted text' done
+		x=1 ${HOME} then "$@" $(pwd) "$1" printf echo
+export --verbose awk 2>/dev/null x=1 --verbose cd && printf 2>/dev/null
+then printf export cd export $(pwd) cd --verbose sed then --verbose grep then /usr/bin
+	sed local "$1" && &&
+	printf awk 2>/dev/null --verbose "$1" $(pwd) local x=1 $(pwd) $(pwd)
+printf ${HOME} && local --verbose printf "$@" export "$1" "$@"
+		/usr/bin test -eu local readonly grep
+'quoted text' "$1" sed then -eu
+	readonly 2>/dev/null export ${HOME} echo 'quoted text' readonly ${HOME}
+printf then readonly test "$1" -eu sed awk
+	readonly grep printf --verbose
+	/usr/bin then | done --verbose 2>/dev/null test --verbose
+grep 'quoted text' then
+	then readonly --verbose test x=1 "$1" done -eu ${HOME}
+	export then done test grep "$1" && 2>/dev/null
+	test /usr/bin grep readonly 'quoted text' $(pwd) "$1" &&
+/usr/bin test "$@" grep grep
+"$@" 2>/dev/null /usr/bin -eu ${HOME} ${HOME} echo "$@" x=1 ${HOME}
+-eu $(pwd) test echo echo done $(pwd) "$1" /usr/bin done export
+	-eu "$1" "$@" ${HOME} then cd cd --verbose test --verbose $(pwd) sed sed $(pwd)
+--verbose | local echo export sed test grep
+printf cd echo /usr/bin && test test cd
+	'quoted text' printf $(pwd) 'quoted text' | ${HOME} x=1 local 'quoted text'
+	export grep "$@" sed && $(pwd) grep
+		2>/dev/null ${HOME} readonly ${HOME} "$1" local cd && readonly
+		${HOME} echo local then readonly test
+		printf test echo 2>/dev/null
+	&& test cd -eu | 2>/dev/null local "$@"
+then cd test test | then && | done test
+		grep 'quoted text' x=1 echo awk ${HOME} grep cd
+	| echo grep -eu x=1 test | echo local | export test awk
+	x=1 done grep 'quoted text' sed 'quoted text' ${HOME}
+local local awk test cd /usr/bin "$@" awk && "$@"
+		$(pwd) readonly "$@" done cd grep grep 'quoted text' "$@" readonly
+	&& readonly printf grep done -eu sed test 2>/dev/null echo then local awk
+| test local /usr/bin "$1" cd done x=1 echo && awk
+	-eu test printf "$@" /usr/bin $(pwd) 2>/dev/null export | | printf 2>/dev/null
+cd ${HOME} sed ${HOME} then awk done "$@" grep ${HOME} readonly
+cd grep awk ${HOME} 2>/dev/null 'quoted text' readonly /usr/bin "$@" x=1 /usr/bin
+-eu done awk ${HOME} test
+&& readonly /usr/bin readonly sed "$@" printf
+	done -eu -eu && 2>/dev/null done "$@"
+	"$1" | x=1 echo printf "$1" /usr/bin printf readonly
+		grep 'quoted text' ${HOME} printf "$1" done ${HOME} cd cd "$@" then test
+		grep local "$@" done ${HOME} printf awk "$1" 2>/dev/null --verbose
+sed grep local /usr/bin echo ${HOME} then ${HOME} && --verbose x=1 readonly grep
+	grep test $(pwd) "$@" printf -eu | test 2>/dev/null 2>/dev/null --verbose
+	${HOME} cd printf cd done awk "$1" readonly sed "$1"
+| --verbose $(pwd) cd export "$@" 'quoted text'
+--verbose && export readonly /usr/bin "$1"
+		echo 'quoted text' x=1 then "$@" grep $(pwd)
+"$1" then test "$1" ${HOME} cd printf /usr/bin | readonly --verbose $(pwd)
+| readonly "$1" export grep sed 2>/dev/null then cd test cd x=1 ${HOME}
+	export --verbose done local -eu "$@" $(pwd) readonly x=1 && readonly
+&& done x=1 local $(pwd) printf grep 'quoted text' x=1 --verbose done ${HOME}
+	awk /usr/bin local printf done cd "$@" then echo
+	2>/dev/null readonly readonly sed
+	done $(pwd) | then test echo "$1" sed echo test | -eu
+		grep printf -eu "$1" printf echo --verbose "$@" grep && $(pwd) awk 'quoted text'
+	printf -eu "$1" | awk test "$1" ${HOME} awk awk test 2>/dev/null x=1 2>/dev/null
+	echo done echo cd sed done then 2>/dev/null grep
+		awk x=1 grep printf grep | cd $(pwd) local && sed local
+	cd /usr/bin x=1 2>/dev/null
+then 'quoted text' ${HOME} /usr/bin awk echo grep echo 'quoted text'
+	sed | 'quoted text' echo local test --verbose then 'quoted text' awk awk
+	cd "$1" 'quoted text' $(pwd) done 'quoted text' printf
+	sed done 2>/dev/null && --verbose && local local grep /usr/bin
+x=1 sed "$1" readonly $(pwd) | && awk test done "$1" grep export
+		grep printf test then /usr/bin
+"$@" cd 'quoted text' 'quoted text'
+		awk awk | $(pwd) done $(pwd) grep awk 'quoted text'
+		awk 'quoted text' x=1 2>/dev/null /usr/bin ${HOME} sed 'quoted text'
+	grep test -eu x=1 --verbose x=1
+local $(pwd) cd then awk cd $(pwd) grep $(pwd) cd grep
+		local grep printf grep x=1 && local local 2>/dev/null printf --verbose
+test awk 'quoted text' | | "$1" export cd grep "$1" "$1" -eu
+printf then | local then 2>/dev/null
+	'quoted text' x=1 "$@" export done sed --verbose "$1" $(pwd) $(pwd)
+-eu "$@" x=1 echo export printf sed readonly sed readonly --verbose x=1 "$@" readonly
+	| printf test --verbose x=1 local
+	local && "$@" test $(pwd) test echo
+	cd ${HOME} "$1" awk "$1" done cd -eu sed $(pwd) ${HOME} | then grep printf -eu x=1
+	cd grep --verbose local awk test test "$1" -eu -eu 2>/dev/null
+export "$@" 2>/dev/null | sed local echo /usr/bin
+	-eu 2>/dev/null test test printf sed $(pwd) done
+"$@" 'quoted text' $(pwd) ${HOME} | export $(pwd) x=1 then 'quoted text'
+	echo then | x=1 /usr/bin test done grep "$@" test x=1 export | $(pwd)
+	echo done cd "$1" --verbose /usr/bin "$@" done -eu x=1
+		"$@" grep 'quoted text'
+		"$1" 'quoted text' | sed then /usr/bin awk grep
+"$1" cd echo export local cd x=1 ${HOME}
+		printf done $(pwd) &&
+	test /usr/bin ${HOME} | sed x=1 'quoted text' sed awk ${HOME}
+cd done -eu export /usr/bin printf then
+	x=1 x=1 test 2>/dev/null test test -eu ${HOME}
+		${HOME} done -eu $(pwd) "$1" readonly test cd sed grep awk $(pwd)
+grep grep cd readonly awk && 'quoted text' && 2>/dev/null --verbose 2>/dev/null
+	/usr/bin 2>/dev/null 2>/dev/null --verbose echo
+	local cd "$1" x=1 /usr/bin awk 'quoted text' ${HOME} x=1 printf
+x=1 "$1" -eu grep /usr/bin
+		| --verbose -eu printf sed && && 2>/dev/null
+	readonly then /usr/bin printf awk $(pwd) grep grep --verbose printf
+	| 'quoted text' grep 2>/dev/null printf -eu test -eu ${HOME}
+		echo printf echo echo export /usr/bin --verbose /usr/bin echo readonly
+--verbose ${HOME} && export "$1" cd | /usr/bin ${HOME} done printf "$@"
+-eu local /usr/bin local printf --verbose done 'quoted text'
+test grep done ${HOME} readonly $(pwd) $(pwd) grep "$1"
+"$1" --verbose && -eu awk "$@" done $(pwd) sed
+		grep sed test local then cd 'quoted text'
+	grep sed test 2>/dev/null
+grep printf --verbose x=1 | local printf
+	test /usr/bin test cd -eu && 2>/dev/null
+		then printf local ${HOME} local
+		export 'quoted text' readonly test cd
+	'quoted text' | test grep 'quoted text' sed "$@" printf 2>/dev/null export 2>/dev/null
+		$(pwd) cd 2>/dev/null /usr/bin
+		then $(pwd) then | --verbose --verbose
+		test --verbose cd grep ${HOME} "$1" 2>/dev/null readonly --verbose awk -eu echo
+		2>/dev/null done 'quoted text' x=1 cd local printf
+		printf sed done $(pwd) --verbose printf -eu then x=1 2>/dev/null grep /usr/bin
+		x=1 $(pwd) grep grep 2>/dev/null 2>/dev/null /usr/bin then sed
+x=1 cd printf ${HOME} /usr/bin
+| /usr/bin ${HOME} /usr/bin x=1 cd | grep ${HOME} echo awk readonly
+${HOME} grep printf grep
+	&& && | test x=1 export 2>/dev/null then then ${HOME} -eu readonly
+cd done grep printf --verbose
+		${HOME} awk --verbose printf -eu sed 2>/dev/null $(pwd)
+		grep "$1" cd -eu awk echo "$@"
+		echo readonly ${HOME} then then | "$1" done
+	cd ${HOME} -eu -eu readonly done
+		test then "$1" local export 2>/dev/null 'quoted text' &&
+"$1" sed printf ${HOME} --verbose "$@" printf grep
+	--verbose 'quoted text' $(pwd) $(pwd) | "$@" awk x=1 $(pwd) readonly
+/usr/bin cd --verbose ${HOME} /usr/bin
+-eu x=1 | --verbose cd "$1" awk | grep ${HOME}
+| export 'quoted text' $(pwd) test sed readonly
+		"$1" 2>/dev/null -eu local then "$@" -eu "$@" | sed
+then export done local then "$1" -eu --verbose then test echo
+2>/dev/null x=1 then "$@" test local -eu printf | 'quoted text' 'quoted text'
+	done readonly test done local --verbose grep /usr/bin
+/usr/bin echo 'quoted text' then
+	--verbose ${HOME} $(pwd) local cd sed
+	cd grep "$1" then --verbose readonly
+"$@" done --verbose --verbose awk then | 2>/dev/null $(pwd)
+		"$1" test export cd 'quoted text' 2>/dev/null
+	test --verbose 'quoted text' $(pwd) --verbose $(pwd) awk "$@" x=1 awk cd "$1"
+	/usr/bin local export
+printf "$@" done && x=1 ${HOME} then done "$@" | /usr/bin /usr/bin cd awk
+/usr/bin ${HOME} echo readonly test test
+		export test /usr/bin sed && awk
+	readonly sed "$1" then test grep printf then -eu then
+2>/dev/null x=1 2>/dev/null /usr/bin readonly /usr/bin -eu 'quoted text' export
+	export echo local ${HOME} sed -eu "$1" "$@" awk && "$1" awk export /usr/bin
+		awk ${HOME} 'quoted text' test local 2>/dev/null cd then test echo export grep
+"$1" --verbose $(pwd) cd
+awk $(pwd) test 'quoted text' --verbose /usr/bin && then && $(pwd) then printf $(pwd)
+	then echo awk grep cd ${HOME} grep --verbose
+"$1" readonly printf printf "$1" echo /usr/bin
+grep && --verbose sed sed "$1" "$1" done $(pwd)
+cd then awk sed grep local printf && 'quoted text' test /usr/bin 'quoted text'
+		"$@" --verbose export | done ${HOME} -eu ${HOME} "$@" done then done readonly
+		| echo printf "$1" x=1 "$1" done | done && grep export "$1" done 2>/dev/null
+	grep grep | readonly awk sed readonly
+		"$@" export printf $(pwd) readonly | && export 'quoted text' --verbose "$@" grep
+		&& "$1" 2>/dev/null 'quoted text' sed cd "$1" 'quoted text'
+	-eu test "$@" | readonly done
+	$(pwd) $(pwd) export -eu export "$1" grep "$1" sed sed done | local awk
+		printf then test "$@" test then x=1 local local done then local
+	sed local "$@" x=1 x=1 done x=1 /usr/bin "$@" | echo --verbose
+	/usr/bin done | "$1" sed cd
+	"$1" local done 'quoted text' ${HOME} "$@" $(pwd) 2>/dev/null x=1 test
+readonly printf 2>/dev/null
+	sed | x=1 2>/dev/null "$@" ${HOME} 'quoted text'
+		sed grep -eu ${HOME} 'quoted text' -eu then &&
+	readonly --verbose $(pwd) readonly
+		${HOME} grep | printf --verbose
+		"$1" test export readonly 2>/dev/null "$1" $(pwd) then done -eu
+	awk readonly | local printf -eu "$@" echo test "$@" ${HOME} test export
+	done x=1 export --verbose readonly
+done done then /usr/bin && $(pwd) awk "$@"
+	local sed then readonly 'quoted text' awk cd ${HOME} readonly done awk "$1" $(pwd)
+		&& export "$1" export awk --verbose
+$(pwd) ${HOME} cd readonly -eu
+readonly printf | --verbose
+echo sed && sed x=1 -eu awk printf then then ${HOME} && "$1" export ${HOME}
+cd then awk grep 'quoted text' x=1 /usr/bin
+&& export $(pwd) "$@" test "$1" | printf export
+--verbose "$1" awk test "$@" | sed "$@" then done echo ${HOME}
+	--verbose x=1 "$@" -eu grep printf "$@" "$1"
+	grep cd --verbose printf $(pwd) echo sed sed test echo awk
+&& x=1 awk done $(pwd) then done x=1 |
+	"$1" -eu readonly printf --verbose done
+	x=1 awk /usr/bin -eu "$@" "$@" "$@" -eu x=1 "$1" 2>/dev/null
+	"$@" grep printf "$1" readonly test ${HOME} 'quoted text' then
+	sed then done sed local
+		printf --verbose $(pwd)
+	export echo sed printf $(pwd) x=1 sed /usr/bin export $(pwd) --verbose export
+	'quoted text' export | sed grep ${HOME} echo export "$1" done
+		"$1" | "$@" printf --verbose test awk "$@" 2>/dev/null 2>/dev/null
+awk 'quoted text' /usr/bin cd export grep | 'quoted text'
+		/usr/bin readonly x=1 awk "$1" x=1
+		done echo x=1 'quoted text' printf grep
+sed 'quoted text' "$@" x=1 readonly x=1 2>/dev/null /usr/bin 2>/dev/null
+/usr/bin test then --verbose &&
+	$(pwd) then echo $(pwd) test ${HOME} "$@" test readonly
+		'quoted text' "$@" --verbose printf $(pwd) printf 2>/dev/null
+		-eu local echo sed /usr/bin echo then -eu test cd readonly readonly
+	test 'quoted text' test done "$1"
+	${HOME} awk local then "$@" sed
+	export x=1 /usr/bin export awk
+| /usr/bin echo done | | printf cd local -eu test /usr/bin
+readonly readonly cd cd $(pwd) /usr/bin sed grep "$@"
+	--verbose test -eu printf 'quoted text' -eu then | printf -eu -eu export
+2>/dev/null && readonly export done ${HOME}
+		--verbose /usr/bin 2>/dev/null printf done echo "$1" $(pwd) 2>/dev/null
+		/usr/bin echo cd ${HOME} --verbose done | local
+		done readonly --verbose /usr/bin "$1" $(pwd) ${HOME} ${HOME} cd ${HOME}
+	test 'quoted text' 'quoted text'
+		readonly "$1" grep printf "$@" done ${HOME} readonly $(pwd)
+'quoted text' | --verbose export |
+'quoted text' | test "$1" export test "$@" | "$1"
+echo sed test test export 'quoted text' $(pwd) readonly
+$(pwd) -eu printf sed local echo cd readonly grep && $(pwd)
+		&& 'quoted text' | test "$@" x=1 test /usr/bin -eu grep
+	awk then then awk --verbose && done "$1" -eu sed -eu awk cd
+	then readonly --verbose awk "$1" sed echo local printf
+	export "$1" 2>/dev/null 'quoted text' done && awk readonly
+	local done cd x=1 && /usr/bin awk echo "$@" cd
+	awk local x=1 grep 2>/dev/null ${HOME} cd x=1 2>/dev/null /usr/bin then
+		&& 2>/dev/null echo test local "$@" &&
+		then "$@" echo && export grep ${HOME} grep "$1" cd printf readonly
+done done grep cd test local
+"$1" readonly 2>/dev/null | export done done &&
+2>/dev/null $(pwd) echo printf
+echo ${HOME} then readonly
+	grep $(pwd) $(pwd) then test 2>/dev/null awk $(pwd) -eu readonly
+export grep && then grep
+	local local 2>/dev/null "$1" test | $(pwd) && awk
+		awk && 'quoted text' sed
+	--verbose printf then
+		${HOME} x=1 done local done test cd --verbose && readonly readonly
+		printf readonly test grep printf sed ${HOME} /usr/bin local $(pwd) 2>/dev/null
+-eu ${HOME} | && $(pwd) printf 2>/dev/null -eu -eu cd "$1" cd 'quoted text'
+	$(pwd) sed export 'quoted text' x=1 "$@" then $(pwd) 2>/dev/null
+	--verbose x=1 x=1 export echo --verbose && test echo
+--verbose cd -eu 'quoted text' local | $(pwd)
+	export "$@" "$@" $(pwd) cd && x=1 -eu --verbose 2>/dev/null export
+	${HOME} readonly | then awk
+printf printf local export && sed grep export && done
+	--verbose -eu "$@" echo local /usr/bin | && "$@" x=1 x=1 x=1 "$@" printf
+echo then -eu "$1" "$1" echo "$1" done /usr/bin local
+		readonly "$@" printf readonly
+then 2>/dev/null done --verbose done x=1 cd awk
+	"$@" -eu "$1" "$1" && 'quoted text' local |
+		grep /usr/bin local export &&
+		x=1 2>/dev/null && grep -eu sed done
+readonly 'quoted text' echo local test "$1" x=1 "$1" && export local /usr/bin
+	${HOME} && ${HOME} x=1 && -eu "$1" | awk && readonly x=1 "$1" readonly
+		| && done grep 2>/dev/null x=1
+	-eu echo "$@" --verbose 'quoted text'
+	| readonly done export then printf /usr/bin awk "$@" $(pwd)
+	"$@" && grep cd sed -eu ${HOME} grep done --verbose
+sed 'quoted text' done /usr/bin $(pwd) printf cd "$1" export /usr/bin
+	&& && && printf printf 'quoted text' then
+		$(pwd) | awk /usr/bin awk --verbose sed 2>/dev/null
+		local | done awk && sed printf done export echo printf sed echo local awk
+		awk test echo x=1 echo readonly | "$1" -eu && done 'quoted text' readonly then
+'quoted text' $(pwd) && readonly local && $(pwd) cd $(pwd) sed $(pwd)
+		x=1 readonly done && 2>/dev/null -eu local ${HOME} $(pwd) --verbose
+		then grep $(pwd) printf -eu ${HOME} x=1 2>/dev/null $(pwd) local
+echo x=1 2>/dev/null x=1 readonly "$@" $(pwd) awk then -eu $(pwd)
+	cd sed sed $(pwd) x=1 && 'quoted text' readonly ${HOME} awk printf echo echo 2>/dev/null
+test printf sed "$1"
+-eu readonly printf local
+		"$@" local grep printf awk "$@" sed cd grep | "$1" local done
+		local "$@" 2>/dev/null $(pwd) local printf && done done "$@" --verbose "$1" export
+grep --verbose export 2>/dev/null cd $(pwd) grep && && echo
+	sed /usr/bin /usr/bin "$@" local grep
+		export "$@" local && 'quoted text' done printf
+		local cd | grep grep &&
+$(pwd) 'quoted text' test /usr/bin 'quoted text'
+		cd ${HOME} done done printf grep printf echo test done test export
+		--verbose export local printf test export
+-eu $(pwd) local readonly && done echo
+		"$1" sed export test export awk
+| | x=1 x=1 && printf --verbose
+then cd x=1 ${HOME} 2>/dev/null /usr/bin grep ${HOME} grep ${HOME} 2>/dev/null
+	'quoted text' readonly x=1 /usr/bin ${HOME} -eu
+	echo "$@" -eu sed test && printf 'quoted text' test then $(pwd) ${HOME}
+sed "$@" $(pwd) readonly then "$@" -eu export printf sed sed
+readonly -eu x=1 $(pwd) /usr/bin test test "$@" awk readonly
+		&& echo --verbose echo printf 'quoted text'
+	awk readonly 2>/dev/null 2>/dev/null then then readonly x=1 grep export "$1"
+	local "$@" 'quoted text' echo then "$@" "$@"
+	export ${HOME} readonly | readonly done cd
+		${HOME} /usr/bin test $(pwd) /usr/bin
+-eu echo /usr/bin done -eu printf x=1 then local $(pwd) test x=1
+		test cd $(pwd) grep "$1" awk
+		$(pwd) sed /usr/bin /usr/bin 'quoted text' cd
+	echo printf "$1" x=1 test && --verbose 'quoted text' grep printf ${HOME} 2>/dev/null
+	export readonly sed 2>/dev/null | done --verbose grep cd local
+		| 2>/dev/null printf ${HOME} local readonly /usr/bin
+cd x=1 --verbose "$1" ${HOME} "$1" printf
+test -eu readonly grep $(pwd) awk x=1 grep "$@" awk
+		echo /usr/bin && export 2>/dev/null
+--verbose cd cd "$1" then local printf
+	grep -eu readonly 'quoted text' --verbose sed && echo grep cd | echo readonly
+		sed | readonly sed local --verbose ${HOME} 2>/dev/null
+	"$@" ${HOME} -eu && "$@" cd export "$1" done
+	test x=1 grep 2>/dev/null export $(pwd) x=1 printf awk 2>/dev/null
+	readonly "$@" readonly | && -eu then -eu
+		awk awk cd sed sed x=1 $(pwd) awk "$1" 2>/dev/null "$@" local
+	export ${HOME} && --verbose | grep printf cd readonly cd export "$1" readonly sed
+readonly printf local local
+"$1" | sed done done $(pwd) $(pwd) readonly "$@" --verbose
+		&& then | --verbose 2>/dev/null | -eu /usr/bin test 2>/dev/null
+		cd x=1 $(pwd) "$@" sed printf local 'quoted text' 'quoted text'
+export sed grep done cd
+test "$@" x=1 cd && sed export sed sed "$@" awk
+	cd $(pwd) done printf local 2>/dev/null x=1 /usr/bin -eu 'quoted text'
+		"$@" x=1 'quoted text' && awk readonly awk "$@"
+	local 2>/dev/null /usr/bin echo done grep x=1 cd cd --verbose cd grep
+	-eu sed x=1 $(pwd) export local 2>/dev/null x=1 test "$1" export $(pwd) echo
+cd then 'quoted text' -eu "$1" x=1 -eu sed 2>/dev/null printf && then
+	grep sed | $(pwd) -eu export /usr/bin awk sed
+done && x=1 "$@" "$1" --verbose
+	sed sed test /usr/bin local "$@" cd "$1" local
+	local | "$@" then --verbose export |
+done awk then export grep && | grep x=1 done local local
+	"$1" ${HOME} local awk | -eu /usr/bin
+	x=1 x=1 "$1" | 2>/dev/null --verbose --verbose printf awk $(pwd) 2>/dev/null
+printf awk -eu | ${HOME} --verbose local &&
+	x=1 readonly $(pwd) grep test --verbose readonly
+		"$1" x=1 cd cd then x=1 echo local
+awk then "$1" "$1" /usr/bin
+	${HOME} local x=1 sed echo /usr/bin readonly
+		then printf && 'quoted text'
+	/usr/bin sed /usr/bin 2>/dev/null --verbose -eu 2>/dev/null /usr/bin export
+"$1" "$1" "$@" x=1 readonly && done printf x=1 "$1" -eu -eu local export
+	$(pwd) | readonly "$@" | printf "$1" 'quoted text'
+"$1" && x=1 2>/dev/null
+echo "$@" readonly "$1" 2>/dev/null && 'quoted text' export ${HOME} local 'quoted text'
+		$(pwd) export "$1" grep 2>/dev/null grep 2>/dev/null
+awk local awk | grep test ${HOME} ${HOME} grep 'quoted text'
+printf -eu --verbose echo
+${HOME} 'quoted text' cd $(pwd)
+	2>/dev/null grep grep |
+export && echo then 2>/dev/null local cd readonly ${HOME} && ${HOME} printf
+x=1 "$@" /usr/bin $(pwd) test awk $(pwd) $(pwd) && echo then --verbose x=1
+		export $(pwd) test grep --verbose local cd cd sed then 'quoted text' test 'quoted text'
+| awk 'quoted text' 'quoted text' echo grep grep ${HOME}
+		sed echo printf && /usr/bin --verbose awk && --verbose
+&& 'quoted text' 'quoted text' done "$@" done --verbose --verbose
+		"$@" cd done cd done x=1 done 2>/dev/null then -eu printf printf export
+local ${HOME} 'quoted text' x=1 echo x=1 export
+	| && then done grep 'quoted text' 2>/dev/null readonly readonly 2>/dev/null
+${HOME} readonly sed -eu printf | sed "$@" then export
+		x=1 $(pwd) 2>/dev/null test x=1 "$1" ${HOME} awk cd x=1 cd cd /usr/bin done
+x=1 sed sed local | /usr/bin -eu ${HOME} x=1
+grep "$@" ${HOME} x=1
+	2>/dev/null grep grep grep --verbose 'quoted text'
+	test cd 2>/dev/null grep /usr/bin "$1" awk "$1"
+$(pwd) then export echo test
+		&& -eu export "$1" grep cd ${HOME} "$@" /usr/bin $(pwd) local $(pwd) "$1" | /usr/bin
+		'quoted text' /usr/bin | awk cd | "$@" cd x=1 awk x=1 test echo
+	readonly then | echo $(pwd)
+		awk sed 'quoted text' awk && sed | readonly
+awk x=1 -eu cd readonly x=1 sed cd sed done 'quoted text' -eu "$1" $(pwd)
+		then -eu cd grep echo
+	"$@" grep local cd "$@" "$@" | ${HOME} local printf cd x=1 grep test -eu "$1"
+	'quoted text' -eu 2>/dev/null ${HOME}
+	then $(pwd) -eu export done printf $(pwd) "$@" then done then
+	--verbose 'quoted text' "$@" | "$@" grep
+x=1 "$1" export export readonly echo "$1"
+		done /usr/bin cd sed test ${HOME} | awk test awk 'quoted text' -eu
+test -eu readonly "$1" $(pwd) export export then done echo $(pwd) 'quoted text'
+test awk grep --verbose
+	then readonly /usr/bin && sed export && "$1" | x=1
+awk awk -eu test printf -eu echo --verbose sed awk && $(pwd)
+&& done /usr/bin $(pwd) x=1 sed | cd
+	cd -eu readonly -eu 2>/dev/null /usr/bin && readonly "$@" x=1 'quoted text'
+		cd printf | /usr/bin
+$(pwd) then 2>/dev/null -eu sed awk readonly echo "$1" grep local
+	export ${HOME} sed && export
+export 2>/dev/null | cd echo /usr/bin | then "$@" "$1" | test printf
+cd sed done local readonly x=1 awk printf test -eu ${HOME}
+		echo awk "$1" test done x=1 'quoted text'
+${HOME} -eu ${HOME} ${HOME} 2>/dev/null
+		&& | sed && export echo x=1 x=1 awk x=1 2>/dev/null local x=1 | 'quoted text'
+$(pwd) x=1 -eu 2>/dev/null && 'quoted text' $(pwd)
+&& $(pwd) "$1" grep readonly readonly done echo
+		then | /usr/bin printf readonly
+		x=1 then $(pwd) -eu $(pwd) --verbose 'quoted text' "$1" grep
+then sed done "$@" --verbose /usr/bin | cd printf
+	echo readonly 'quoted text' "$@" -eu printf export
+-eu awk test echo readonly "$@" export local then
+	local | /usr/bin echo then --verbose readonly readonly /usr/bin export echo ${HOME}
+	printf 2>/dev/null -eu sed $(pwd) ${HOME}
+	sed | then /usr/bin then && 'quoted text' ${HOME} readonly $(pwd) done
+	done x=1 x=1 local sed readonly 'quoted text'
+	readonly $(pwd) done cd local 2>/dev/null ${HOME} | /usr/bin
+grep 'quoted text' --verbose local 2>/dev/null "$1" sed /usr/bin
+| test 2>/dev/null grep --verbose "$@" done
+	readonly sed "$1" ${HOME} local /usr/bin sed x=1 printf printf "$1" x=1
+grep | readonly $(pwd) --verbose "$1" 'quoted text' | && x=1 printf test
+		/usr/bin $(pwd) x=1 && cd "$1" 2>/dev/null "$1"
+		grep | --verbose readonly "$1" grep &&
+	x=1 local 2>/dev/null -eu "$@"
+awk sed awk local grep sed
+	readonly local "$@" $(pwd) then 'quoted text' then
+	x=1 test sed readonly "$@" "$1" grep local done "$1" "$@" test
+--verbose test sed then done done /usr/bin "$1" 'quoted text' sed echo "$@"
+		&& "$1" readonly echo ${HOME} | x=1 export
+		printf "$1" -eu grep sed && && --verbose awk "$1" then local cd
+		awk export test --verbose readonly 'quoted text'
+"$@" export "$1" ${HOME}
+${HOME} grep x=1 "$@" "$@" printf test sed test
+${HOME} echo /usr/bin test $(pwd) cd local $(pwd)
+${HOME} sed readonly cd "$1" sed /usr/bin done 'quoted text' printf $(pwd) cd "$@"
+		echo echo readonly && -eu test
+${HOME} /usr/bin 2>/dev/null sed local echo test readonly echo
+	readonly printf /usr/bin /usr/bin 2>/dev/null
+printf -eu /usr/bin export echo
+	test "$@" "$@" cd echo "$1" cd --verbose ${HOME} /usr/bin awk -eu &&
+	sed -eu $(pwd) -eu "$@" -eu awk then && done then 2>/dev/null
+cd test "$@" ${HOME} echo && printf cd printf /usr/bin
+/usr/bin "$@" cd local printf "$@" 'quoted text'
+		"$@" ${HOME} "$1" sed 'quoted text' -eu 2>/dev/null
+-eu x=1 echo awk $(pwd) /usr/bin sed ${HOME} test --verbose awk
+		export done ${HOME} /usr/bin
+	local export -eu awk then -eu
+	cd "$@" --verbose local /usr/bin test done 'quoted text'
+	awk grep done readonly 'quoted text' export -eu test --verbose
+	echo grep readonly echo ${HOME} local && then printf cd readonly | local awk
+		awk readonly "$@" && && x=1 /usr/bin
+2>/dev/null sed -eu /usr/bin cd grep && then
+&& readonly printf awk awk readonly echo cd done readonly echo done
+$(pwd) done grep ${HOME} printf printf echo x=1
+		--verbose ${HOME} x=1 -eu /usr/bin | 'quoted text'
+		$(pwd) awk 'quoted text' 'quoted text' -eu readonly awk awk
+	--verbose 2>/dev/null test $(pwd) test export export
+	&& "$@" --verbose local readonly 2>/dev/null
+	sed then export sed cd /usr/bin -eu 2>/dev/null && -eu sed -eu test
+		done $(pwd) 'quoted text' awk sed grep | done export test ${HOME} -eu sed test
+	cd 2>/dev/null "$@" x=1 "$@" | x=1 echo export x=1 x=1 done done grep then ${HOME}
+		then ${HOME} then 'quoted text' export | readonly awk ${HOME} readonly done
+		"$1" test cd x=1 echo "$1" "$@" $(pwd) -eu -eu --verbose x=1 "$@" done "$@"
+local && grep 'quoted text' test sed cd readonly
+	'quoted text' 2>/dev/null readonly
+		export awk sed test --verbose
+awk --verbose test && --verbose --verbose -eu | test sed -eu readonly ${HOME} 2>/dev/null
+		${HOME} | ${HOME} echo ${HOME} echo -eu 'quoted text' --verbose
+		| /usr/bin local readonly x=1
+export echo | echo sed test
+	2>/dev/null then --verbose then 2>/dev/null | then "$1" printf export
+	then "$@" awk done "$1" -eu export 2>/dev/null grep awk "$@" then export sed
+-eu --verbose --verbose
+	2>/dev/null && $(pwd) --verbose -eu awk 2>/dev/null /usr/bin
+		echo grep && ${HOME} | $(pwd) test "$@" echo -eu --verbose | | $(pwd) then
+	grep -eu "$@" then 2>/dev/null
+done $(pwd) printf cd /usr/bin --verbose done readonly 'quoted text' sed 'quoted text'
+		cd cd && cd sed done grep 'quoted text'
+| test readonly 2>/dev/null ${HOME} readonly cd then --verbose /usr/bin
+	local "$1" test "$@" readonly x=1
+"$1" local ${HOME} then 2>/dev/null sed done done echo -eu x=1 local awk export
+sed "$1" local "$@" | local
+		${HOME} --verbose readonly && && awk done --verbose
+then done --verbose "$1" --verbose readonly
+awk cd sed grep readonly "$@" -eu "$@" readonly done
+	echo printf printf echo
+		readonly "$@" "$1" readonly test test then "$@" /usr/bin
+		cd cd "$@" test "$1" sed && -eu sed
+		2>/dev/null 'quoted text' cd done | local cd then 2>/dev/null
+readonly sed x=1 | printf x=1 grep grep
+		readonly --verbose --verbose local | export | export --verbose echo echo 'quoted text'
+	2>/dev/null awk --verbose printf local readonly $(pwd) grep ${HOME}
+--verbose done then sed x=1 sed --verbose test
+		/usr/bin echo | x=1 export /usr/bin | | printf --verbose
+	sed printf 2>/dev/null local sed --verbose -eu x=1 /usr/bin $(pwd) "$1" printf
+		then then grep $(pwd) then
+	$(pwd) echo | grep | awk awk done x=1
+		readonly && ${HOME} awk local
+-eu /usr/bin echo done $(pwd)
+awk readonly && 'quoted text' -eu 'quoted text' cd then $(pwd) "$@" readonly awk
+		done $(pwd) && ${HOME} "$1" grep ${HOME} 'quoted text' readonly -eu ${HOME}
+echo 2>/dev/null readonly awk ${HOME} export
+		readonly done done -eu test $(pwd) then -eu export then
+		sed done cd readonly grep test 2>/dev/null
+echo then sed && echo /usr/bin local 2>/dev/null test sed export
+done local ${HOME} local | -eu readonly && printf | ${HOME} -eu cd "$1"
+	cd /usr/bin echo && 'quoted text' then
+		'quoted text' /usr/bin local --verbose "$@" then done local
+		--verbose && -eu 2>/dev/null test awk sed --verbose "$1" grep /usr/bin
+then sed $(pwd) test 'quoted text'
+readonly --verbose then echo /usr/bin printf --verbose --verbose
+done sed ${HOME} 2>/dev/null "$1" readonly /usr/bin 'quoted text'
+	grep && -eu "$@" then 2>/dev/null "$1" grep
+		cd then 'quoted text' && && echo cd printf
+		"$1" && --verbose local printf ${HOME} 'quoted text'
+local then sed "$@" grep /usr/bin export export grep "$1" echo local grep echo &&
+		&& /usr/bin printf 'quoted text'
+--verbose -eu then 2>/dev/null done echo grep "$1" x=1 done
+cd && echo then /usr/bin done echo grep cd ${HOME} x=1 "$@" "$1"
+		2>/dev/null $(pwd) /usr/bin --verbose 'quoted text'
+	export awk "$1" printf sed && 2>/dev/null --verbose --verbose $(pwd)
+		export && export && $(pwd)
+	sed /usr/bin /usr/bin readonly cd 2>/dev/null x=1 sed $(pwd)
+x=1 | x=1 "$1" "$1" "$@" export local "$@" local export
+		${HOME} export /usr/bin printf printf test ${HOME} sed sed
+		printf done 'quoted text' $(pwd)
+| --verbose test x=1 | "$@"
+	${HOME} grep sed then --verbose cd 2>/dev/null
+		echo && echo && | local | 'quoted text' cd grep "$1" then --verbose sed cd
+		'quoted text' grep awk cd $(pwd) test ${HOME}
+		2>/dev/null "$1" 2>/dev/null | grep local 2>/dev/null
+		test local readonly && "$1" $(pwd) awk export 'quoted text' grep "$1" then cd
+		'quoted text' "$1" then sed sed --verbose -eu "$@" grep -eu grep
+		test readonly $(pwd)
+		cd 'quoted text' done /usr/bin 2>/dev/null
+		$(pwd) sed x=1 test $(pwd) export 'quoted text'
+	awk "$1" echo test awk local 'quoted text'
+--verbose 2>/dev/null 2>/dev/null test awk printf local done readonly
+readonly 2>/dev/null
+	--verbose grep local -eu ${HOME} test "$1"
+		sed /usr/bin printf 2>/dev/null sed grep grep export "$@" && local /usr/bin
+test /usr/bin x=1 "$1" export sed && -eu sed then "$@" grep $(pwd) cd "$@" cd
+grep sed "$1" echo $(pwd) && 'quoted text'
+		local 'quoted text' echo printf
+awk "$1" | done grep "$@" 'quoted text' then "$1" echo cd "$@"
+	/usr/bin awk 'quoted text' &&
+		awk /usr/bin "$1" printf 2>/dev/null readonly
+		$(pwd) grep echo 'quoted text' ${HOME} $(pwd) ${HOME}
+then sed local | done export cd $(pwd) printf
+	readonly grep grep ${HOME} local local test "$@" export
+		${HOME} /usr/bin x=1 grep "$@" && $(pwd) 2>/dev/null "$@" printf grep
+| export -eu /usr/bin local grep x=1 then then
+x=1 echo then grep done sed then sed ${HOME} "$1" -eu "$1" printf
+| sed printf 2>/dev/null readonly readonly local printf "$@" --verbose then $(pwd)
+		sed awk "$1" sed then cd "$1" echo
+--verbose | awk done "$@" test export $(pwd) x=1 x=1 | 'quoted text' local sed
+		cd printf 2>/dev/null --verbose | | x=1 2>/dev/null cd grep local
+awk $(pwd) export echo grep export local grep 'quoted text' ${HOME}
+'quoted text' ${HOME} printf
+	&& sed printf x=1 echo "$1" "$@" $(pwd) -eu | then 'quoted text'
+	grep -eu done cd -eu grep --verbose sed local && cd test
+	'quoted text' test then done sed x=1 export $(pwd) then
+		x=1 readonly cd && && test | 'quoted text' && echo grep "$@" x=1 readonly
+printf then local --verbose test --verbose cd cd "$1" /usr/bin /usr/bin "$@"
+	/usr/bin printf export /usr/bin 2>/dev/null echo 'quoted text'
+	| ${HOME} 2>/dev/null
+cd done awk done printf test --verbose readonly then export echo printf cd
+printf cd $(pwd) -eu then test &&
+${HOME} echo sed done "$1" | /usr/bin grep done printf echo local --verbose
+	cd export readonly then echo then | readonly
+awk | -eu "$@" && readonly cd && 2>/dev/null local sed && x=1 sed x=1 | cd |
+	awk export awk grep then readonly -eu
+		$(pwd) sed then | -eu 2>/dev/null
+		echo done test $(pwd) ${HOME} /usr/bin done --verbose readonly awk 2>/dev/null
+printf awk printf && "$@" "$1" /usr/bin "$1" echo printf -eu echo "$@" awk "$@"
+	2>/dev/null "$@" readonly echo &&
+done "$1" ${HOME} echo /usr/bin cd done x=1
+	"$@" test && ${HOME} printf && --verbose awk ${HOME} then x=1 done test $(pwd)
+	--verbose "$@" 'quoted text' echo sed done
+	-eu 2>/dev/null awk printf --verbose
+		done --verbose printf awk awk grep 2>/dev/null
+echo readonly sed /usr/bin --verbose grep --verbose readonly
+		sed then then -eu | done
+	$(pwd) sed echo echo grep then cd && $(pwd) ${HOME} && ${HOME}
+echo ${HOME} test | 'quoted text'
+		printf printf local 'quoted text' awk awk grep done --verbose
+	then awk grep ${HOME} readonly test 2>/dev/null grep
+-eu x=1 test printf $(pwd) cd echo -eu export echo && then printf
+	--verbose local done $(pwd) x=1 | "$@" grep ${HOME} 2>/dev/null
+		printf 2>/dev/null 'quoted text' cd 'quoted text' -eu
+		export sed test test "$@"
+echo $(pwd) /usr/bin 'quoted text' | -eu
+	'quoted text' ${HOME} "$1" sed then cd done cd echo "$1" 'quoted text'
+	$(pwd) | echo export /usr/bin
+	x=1 local readonly grep awk grep local readonly --verbose
+		$(pwd) $(pwd) --verbose then /usr/bin echo test /usr/bin done cd local test
+	$(pwd) "$1" then && 2>/dev/null grep x=1 test
+		cd --verbose test export | 'quoted text' $(pwd) --verbose -eu -eu cd x=1 awk
+	/usr/bin && | 'quoted text' ${HOME}
+		test $(pwd) test done cd 2>/dev/null sed printf awk cd "$1" -eu local x=1 echo
+		-eu ${HOME} local -eu readonly "$@" local echo
+$(pwd) ${HOME} printf local && awk 2>/dev/null awk -eu 2>/dev/null
+		echo export readonly -eu export printf done local test ${HOME} && printf
+cd /usr/bin | /usr/bin 'quoted text' -eu x=1 cd then && $(pwd)
+x=1 && done /usr/bin echo --verbose x=1 printf awk sed export cd
+	2>/dev/null x=1 cd && /usr/bin awk grep
+awk local -eu | -eu x=1 $(pwd) /usr/bin $(pwd)
+		| grep ${HOME} printf "$1"
+"$@" local "$@" /usr/bin --verbose
+$(pwd) sed echo && $(pwd) printf --verbose then x=1 2>/dev/null
+		'quoted text' grep | $(pwd) done 'quoted text'
+awk awk && --verbose "$@" "$@"
+		&& "$1" cd test -eu $(pwd) && x=1 export printf echo cd awk local awk readonly
+		export awk grep "$@" echo x=1 'quoted text' printf
+		test x=1 local then "$@" awk /usr/bin --verbose 'quoted text' readonly echo
+		local cd --verbose 2>/dev/null | x=1 grep local then ${HOME} echo 2>/dev/null
+	$(pwd) "$1" 'quoted text' cd export -eu && then
+-eu sed 'quoted text' --verbose done "$@" readonly | "$1" printf /usr/bin
+		-eu echo then local -eu cd cd && then
+		grep grep 'quoted text' && "$1" x=1 /usr/bin 2>/dev/null
+x=1 done && -eu export 'quoted text' readonly $(pwd)
+/usr/bin && test local x=1 export local cd --verbose x=1
+grep | export | /usr/bin x=1 2>/dev/null test 2>/dev/null echo
+		"$@" sed local done then sed awk --verbose export
+	"$1" $(pwd) cd echo 2>/dev/null --verbose
+	local grep && "$@" | 'quoted text' $(pwd) test 'quoted text'
+		"$@" grep "$@" echo cd awk done 'quoted text' "$@" 2>/dev/null
+	"$1" echo readonly | "$1" cd then done echo printf -eu --verbose readonly | readonly
+	sed | | ${HOME} -eu | ${HOME}
+		awk export /usr/bin cd cd export cd readonly echo
+&& printf cd awk readonly sed 2>/dev/null "$@" x=1 then sed test | readonly readonly
+		done $(pwd) x=1 sed cd readonly x=1 'quoted text'
+	2>/dev/null printf 'quoted text' && /usr/bin
+		${HOME} && grep ${HOME} then cd sed "$@" readonly
+	--verbose local 2>/dev/null sed readonly "$@" export $(pwd) echo export
+x=1 then /usr/bin $(pwd)
+	'quoted text' ${HOME} ${HOME} sed test
+	readonly export test printf 2>/dev/null cd then 'quoted text' cd then
+	printf readonly 'quoted text'
+		echo test echo grep x=1 ${HOME} $(pwd) local ${HOME} export
+2>/dev/null ${HOME} -eu cd local 'quoted text' 2>/dev/null 2>/dev/null
+		grep local -eu 'quoted text' && /usr/bin awk ${HOME} $(pwd) 2>/dev/null
+		'quoted text' 'quoted text' sed x=1 cd readonly | awk
+	echo /usr/bin then x=1 awk /usr/bin $(pwd) --verbose echo local x=1
+then 'quoted text' then | echo sed readonly test
+| ${HOME} x=1 sed export local grep x=1 awk -eu cd ${HOME} 2>/dev/null
+		echo && x=1 local awk awk test /usr/bin echo printf $(pwd) x=1
+	--verbose echo export "$@" printf then cd | "$@" sed /usr/bin readonly
+grep --verbose /usr/bin $(pwd) readonly 'quoted text'
+grep readonly test x=1 local "$@"
+		done sed | test ${HOME}
+'quoted text' test /usr/bin | printf ${HOME} | x=1 "$1" export "$1"
+printf printf ${HOME} -eu --verbose
+		awk 'quoted text' then $(pwd) then test $(pwd) ${HOME} readonly cd cd printf
+readonly $(pwd) ${HOME} then test then
+$(pwd) awk x=1 grep local 2>/dev/null printf --verbose && export sed
+	/usr/bin x=1 echo --verbose x=1 done awk "$@" echo && done
+		grep then ${HOME} "$1" test
+$(pwd) 'quoted text' done awk grep 2>/dev/null -eu ${HOME} then
+		done grep | grep "$1" $(pwd) readonly echo done then echo readonly $(pwd) $(pwd)
+cd echo | | 2>/dev/null awk /usr/bin
+		--verbose $(pwd) x=1 -eu 2>/dev/null
+local $(pwd) printf "$1" $(pwd) -eu export 'quoted text' done "$1" x=1 export
+echo --verbose $(pwd) test x=1 awk readonly "$@" | -eu | local printf --verbose
+		grep done done 'quoted text' | test --verbose
+	echo done $(pwd) "$@" $(pwd) readonly grep --verbose ${HOME} printf cd
+	sed 'quoted text' $(pwd) --verbose echo /usr/bin
+		done "$1" readonly printf done "$1" printf
+		export echo readonly ${HOME} x=1 then printf $(pwd) $(pwd) /usr/bin $(pwd)
+${HOME} test then --verbose
+$(pwd) && 2>/dev/null "$@"
+		readonly "$1" export cd "$@" | ${HOME} echo printf
+local readonly && sed -eu then local x=1 done
+x=1 ${HOME} -eu readonly test grep done sed "$@" printf "$@" local local
+cd -eu /usr/bin grep ${HOME} sed --verbose /usr/bin cd "$@" 'quoted text'
+	--verbose export ${HOME} echo local
+"$@" | "$1" then --verbose /usr/bin export printf $(pwd)
+local echo "$1" ${HOME} ${HOME} done test cd x=1 --verbose readonly 'quoted text'
+		x=1 echo echo awk ${HOME} &&
+		'quoted text' "$@" && cd awk echo
+	sed $(pwd) test /usr/bin sed done "$1" && echo
+	export local readonly awk awk /usr/bin cd export --verbose
+		"$@" $(pwd) 'quoted text' 2>/dev/null -eu 2>/dev/null
+'quoted text' ${HOME} grep &&
+		readonly | "$@" printf 2>/dev/null
+	export | done /usr/bin | ${HOME}
+	"$1" awk export test done awk awk awk -eu awk export cd --verbose
+		"$@" /usr/bin local local cd done test -eu
+	&& | $(pwd) readonly local 'quoted text' 2>/dev/null --verbose
+x=1 /usr/bin then 'quoted text' && cd ${HOME} local awk -eu test
+| $(pwd) printf test printf local "$@" done
+test /usr/bin then /usr/bin export && "$1" local --verbose "$@" |
+		/usr/bin --verbose "$@" && 'quoted text' && then test | x=1 export --verbose ${HOME}
+	"$1" 'quoted text' "$1" "$@" "$@" cd --verbose --verbose echo printf
+		--verbose export awk then | && 2>/dev/null readonly grep echo $(pwd) then sed export
+| x=1 printf done -eu "$1" -eu readonly --verbose sed local "$1"
+		--verbose printf --verbose "$@" ${HOME} $(pwd)
+then then 2>/dev/null | x=1 --verbose readonly /usr/bin
+'quoted text' && done ${HOME} | "$1" local "$1" awk /usr/bin x=1
+	'quoted text' --verbose
+		x=1 /usr/bin printf done cd echo && && -eu
+readonly $(pwd) readonly 2>/dev/null sed echo | -eu "$@" cd "$1" /usr/bin
+	--verbose sed local export -eu cd "$1" test export
+	export printf /usr/bin awk printf
+	readonly -eu "$@" && then local $(pwd) readonly -eu x=1 echo
+	sed echo x=1 "$1" grep --verbose printf
+		sed grep $(pwd) -eu && then --verbose --verbose
+		local 'quoted text' 2>/dev/null
+export done then awk then echo x=1 readonly
+	cd printf 2>/dev/null $(pwd) echo export cd printf test local "$@" cd sed "$@"
+		printf && cd export x=1 2>/dev/null
+		2>/dev/null 'quoted text' awk export grep x=1 grep readonly
+	grep /usr/bin -eu && ${HOME} local /usr/bin && /usr/bin done x=1 /usr/bin
+&& sed $(pwd) 'quoted text' x=1 &&
+	printf echo /usr/bin cd ${HOME} 2>/dev/null 'quoted text'
+		export echo -eu done /usr/bin grep "$@" cd test ${HOME}
+		awk sed awk cd 'quoted text' ${HOME} awk $(pwd) x=1 export printf local --verbose
+	test /usr/bin sed echo export done
+		local sed -eu x=1 x=1 --verbose echo ${HOME} 2>/dev/null
+		echo echo printf -eu cd x=1
+-eu then | -eu grep "$1" /usr/bin ${HOME} export && && 'quoted text'
+"$@" done 'quoted text'
+		x=1 cd cd grep "$@" then 'quoted text' x=1 x=1 /usr/bin | local grep test
+	grep sed local grep test 'quoted text' | then local 2>/dev/null ${HOME}
+printf echo && "$1" /usr/bin 'quoted text' /usr/bin printf sed
+		$(pwd) "$1" "$1" 'quoted text' "$1" /usr/bin
+	'quoted text' && ${HOME} $(pwd)
+sed --verbose awk ${HOME} awk --verbose /usr/bin local local --verbose
+	local -eu && | printf x=1 readonly -eu $(pwd) ${HOME} && "$1" -eu --verbose
+		-eu "$1" --verbose local
+		"$@" 2>/dev/null export done
+then ${HOME} awk x=1 "$@" x=1 test sed echo "$1" --verbose done sed
+		2>/dev/null $(pwd) cd 'quoted text'
+		2>/dev/null grep $(pwd) x=1 export x=1 --verbose | -eu 'quoted text'
+		2>/dev/null sed 2>/dev/null sed grep --verbose readonly "$1"
+${HOME} readonly echo /usr/bin 'quoted text' export "$1" test "$1" --verbose
+	2>/dev/null ${HOME} -eu readonly
+		grep -eu cd "$1" --verbose export then 'quoted text'
+		'quoted text' export test grep 'quoted text' test $(pwd)
+	'quoted text' | | x=1 /usr/bin
+/usr/bin x=1 awk /usr/bin ${HOME} printf test export grep /usr/bin /usr/bin
+		grep && echo /usr/bin printf printf awk | cd grep "$1" then $(pwd)
+	-eu sed "$1" readonly "$1" 2>/dev/null
+awk --verbose ${HOME} -eu then ${HOME} x=1 /usr/bin then
+		${HOME} x=1 sed cd 2>/dev/null
+		readonly "$1" sed printf grep done ${HOME} echo cd then $(pwd)
+sed local awk /usr/bin 2>/dev/null
+	/usr/bin test test done export printf
+	local 'quoted text' -eu && --verbose /usr/bin 2>/dev/null /usr/bin --verbose
+		2>/dev/null test echo printf 2>/dev/null "$1" | then grep | local
+sed sed then /usr/bin local /usr/bin && then ${HOME} done | printf readonly $(pwd)
+		sed sed "$1" printf local ${HOME}
+'quoted text' sed $(pwd) | -eu /usr/bin echo x=1 | "$@" then test --verbose sed
+	2>/dev/null ${HOME} readonly grep
+printf done ${HOME} ${HOME}
+		/usr/bin $(pwd) printf local
+		local -eu grep printf echo awk && "$1" done ${HOME}
+	${HOME} "$@" | x=1 2>/dev/null
+	"$@" grep -eu test /usr/bin
+		then cd ${HOME} "$1" "$@" --verbose | sed -eu "$1"
+	done "$@" sed "$1" && echo "$@" awk && sed | 'quoted text' ${HOME} grep
+		local | && --verbose local
+&& done echo then readonly --verbose done done --verbose export printf
+	'quoted text' /usr/bin |
+	x=1 'quoted text' /usr/bin $(pwd) $(pwd) -eu --verbose | export then 2>/dev/null
+	grep && echo awk grep done printf awk readonly x=1 'quoted text'
+		-eu && export then | $(pwd) local ${HOME} --verbose sed && ${HOME}
+		then $(pwd) test export export awk -eu x=1 -eu "$@"
+grep -eu 'quoted text' "$@" $(pwd) done 2>/dev/null "$@" grep x=1 export ${HOME}
+test 'quoted text' test 2>/dev/null grep /usr/bin ${HOME} 'quoted text' "$1" |
+readonly printf -eu --verbose $(pwd) test printf then readonly 'quoted text'
+	done && export grep local
+		readonly /usr/bin "$@" sed readonly export 2>/dev/null && 2>/dev/null echo readonly
+then --verbose local done $(pwd) && $(pwd) export "$@" grep $(pwd) grep 2>/dev/null
+	2>/dev/null 2>/dev/null printf printf export readonly then x=1 "$1" awk /usr/bin
+echo && 2>/dev/null grep cd x=1 2>/dev/null
+		grep --verbose test && echo done sed | grep
+done /usr/bin local "$@" -eu ${HOME} /usr/bin awk export $(pwd)
+then x=1 $(pwd) "$@" awk echo sed $(pwd) -eu export
+	cd ${HOME} done awk x=1 'quoted text'
+	grep 2>/dev/null export done echo echo "$@" grep printf done
+	"$@" local readonly cd --verbose /usr/bin
+		printf local export -eu echo then | | readonly
+"$@" grep --verbose cd sed done cd "$@" "$@" readonly awk done | echo
+		cd done "$1" awk grep export "$1" printf
+		local -eu test then echo
+	"$1" then -eu -eu printf awk printf
+&& sed /usr/bin local "$1" 2>/dev/null "$@" 2>/dev/null
+'quoted text' test test cd
+	${HOME} awk ${HOME} | 2>/dev/null | --verbose awk 'quoted text' "$1" "$@" "$@" $(pwd)
+	readonly "$1" && $(pwd) "$1" done done printf grep export sed test done done
+--verbose --verbose printf "$@" echo x=1 cd
+cd "$1" "$@" test then 'quoted text' awk && 2>/dev/null ${HOME} "$1" readonly
+sed cd grep readonly "$1" $(pwd) export
+	echo sed printf grep /usr/bin test -eu 'quoted text'
+	${HOME} | $(pwd) done printf readonly
+		sed cd cd "$@" awk 'quoted text'
+		$(pwd) sed grep | awk test
+		echo done "$1" /usr/bin done cd | done export "$@" ${HOME} "$@" /usr/bin 'quoted text'
+| 'quoted text' printf test awk ${HOME} then -eu &&
+		awk readonly sed | /usr/bin cd sed printf
+-eu echo /usr/bin sed --verbose done awk 2>/dev/null
+		"$1" cd "$@" echo ${HOME} printf -eu && 'quoted text' test 2>/dev/null
+	| done cd then "$@" 'quoted text'
+		export grep export "$1" --verbose done x=1 readonly awk awk x=1 ${HOME} ${HOME}
+printf 2>/dev/null 2>/dev/null then /usr/bin export sed 'quoted text'
+x=1 2>/dev/null x=1 export
+		x=1 $(pwd) export printf cd echo echo ${HOME}
+then 'quoted text' then | cd sed done ${HOME} local echo | $(pwd)
+	test grep printf export "$1" && "$@" "$1"
+	'quoted text' x=1 && awk && ${HOME} /usr/bin 'quoted text'
+--verbose -eu cd ${HOME} $(pwd) sed echo grep readonly grep 2>/dev/null $(pwd)
+		x=1 x=1 'quoted text' "$1" sed $(pwd) echo 2>/dev/null && awk --verbose /usr/bin
+	done then test 'quoted text' sed "$1" then cd $(pwd) 2>/dev/null echo x=1 cd $(pwd)
+		-eu "$1" test done x=1 sed readonly ${HOME} printf
+	awk "$1" 'quoted text' readonly awk ${HOME} /usr/bin cd done "$@" && readonly
+2>/dev/null | $(pwd) readonly grep
+	&& grep -eu done $(pwd) x=1 "$1" then awk --verbose
+		x=1 then /usr/bin ${HOME} local echo readonly then ${HOME} echo
+	--verbose readonly sed then echo then 2>/dev/null test awk "$1" "$1"
+	"$1" printf x=1 /usr/bin cd $(pwd) && printf sed /usr/bin local export done 2>/dev/null
+		printf ${HOME} grep 2>/dev/null awk "$@" printf then
+		$(pwd) local cd echo "$1" test sed
+${HOME} printf readonly
+		test then cd "$1" /usr/bin export then readonly test test 'quoted text' /usr/bin
+--verbose ${HOME} then "$@" &&
+		printf cd done -eu test awk --verbose --verbose
+-eu $(pwd) /usr/bin printf -eu done grep 'quoted text'
+	x=1 $(pwd) printf cd cd readonly cd readonly
+		printf local readonly done && test printf export local
+${HOME} "$1" 2>/dev/null
+		local cd && /usr/bin test ${HOME} /usr/bin done --verbose 'quoted text'
+	done export echo printf /usr/bin export then 2>/dev/null
+--verbose sed 'quoted text' awk 2>/dev/null
+sed /usr/bin x=1 then cd -eu ${HOME} /usr/bin then | echo then cd export --verbose
+		/usr/bin $(pwd) "$1" 2>/dev/null done -eu echo
+"$1" done sed $(pwd) printf "$@"
+		awk cd done export sed
+echo 'quoted text' cd grep "$1" ${HOME} -eu -eu then 2>/dev/null echo x=1 readonly
+		sed local readonly test then -eu --verbose test x=1 echo
+sed readonly 'quoted text' echo
+	'quoted text' sed local test readonly
+	/usr/bin && x=1 "$1" cd printf 2>/dev/null x=1 grep
+cd done "$@" readonly done x=1 grep "$1" 2>/dev/null &&
+		&& readonly x=1 'quoted text' test export && | then local cd $(pwd) then
+		$(pwd) | | awk | $(pwd)
+readonly /usr/bin local done "$@" "$@" grep && && && echo 'quoted text'
+		done local x=1 | ${HOME} local awk test ${HOME} 2>/dev/null then
+	grep done echo then 2>/dev/null local readonly sed test --verbose
+&& "$@" awk --verbose && cd local x=1 grep --verbose
+-eu "$1" export cd awk cd test printf -eu && -eu local done printf $(pwd) then
+| export --verbose sed
+	grep then 'quoted text' --verbose && test sed local
+	'quoted text' then export "$@" && "$@" 2>/dev/null
+		printf test $(pwd) $(pwd) then
+	$(pwd) test -eu $(pwd) local 2>/dev/null grep done
+		--verbose done local printf
+${HOME} | /usr/bin cd echo readonly
+		export test 'quoted text' test | sed then ${HOME} export then
+'quoted text' | then awk 2>/dev/null -eu sed then sed 'quoted text'
+		--verbose | readonly grep | echo $(pwd) export 2>/dev/null
+	-eu "$@" && done grep local $(pwd) test -eu "$1" echo cd && "$@" cd cd ${HOME}
+	test readonly grep x=1 export | 2>/dev/null "$@" 'quoted text' 'quoted text'
+	local then echo local 'quoted text' | 'quoted text' "$1"
+		then local "$@" done "$@" 'quoted text' "$1" 2>/dev/null 'quoted text'
+	"$@" awk -eu awk done sed export cd x=1 && local 2>/dev/null
+		-eu && --verbose readonly x=1 awk x=1
+"$1" 'quoted text' $(pwd) readonly 2>/dev/null 'quoted text' ${HOME} export
+		test --verbose export 2>/dev/null
+echo | --verbose then sed 2>/dev/null $(pwd) echo
+		export awk 'quoted text' grep printf done /usr/bin $(pwd) export done export --verbose
+		echo local grep ${HOME} local
+| readonly readonly -eu printf 'quoted text' 'quoted text' 2>/dev/null echo ${HOME}
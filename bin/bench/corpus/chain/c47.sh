@@ -0,0 +1,2001 @@
+		'quoted text' export $(pwd)
+	-eu then -eu sed then echo | $(pwd) 2>/dev/null 2>/dev/null
+		cd "$1" ${HOME} 2>/dev/null
+	| x=1 readonly $(pwd) echo /usr/bin -eu "$@" 2>/dev/null && then
+| 'quoted text' echo "$1" echo grep ${HOME} printf "$1" test
+		| printf sed sed /usr/bin awk printf
+then && sed && awk done | sed sed awk grep 2>/dev/null
+awk printf -eu done 2>/dev/null readonly
+		cd | done /usr/bin && && ${HOME} readonly 'quoted text'
+		readonly 2>/dev/null awk && grep -eu echo x=1 readonly export
+		then "$@" -eu 2>/dev/null 'quoted text' 'quoted text' printf sed
+$(pwd) --verbose -eu local grep grep
+cd ${HOME} --verbose done ${HOME} | export sed && awk
+test readonly -eu $(pwd) && local && readonly
+		"$1" then test then "$@" $(pwd) | && -eu echo $(pwd) echo $(pwd) "$@"
+	done "$@" 'quoted text' grep export export && local && local done sed "$1"
+	then export printf "$1" | -eu cd echo
+		echo x=1 "$1" then x=1 done x=1 -eu cd ${HOME} test 'quoted text' grep $(pwd)
+		sed | cd echo "$@" done 'quoted text'
+"$@" then cd echo grep cd cd 2>/dev/null
+		test done "$1" done done | test done grep $(pwd) -eu 2>/dev/null 'quoted text'
+x=1 then export x=1 printf
+		-eu printf awk then done -eu
+&& "$1" "$@" test && --verbose echo 'quoted text'
+2>/dev/null "$1" && "$1" export grep $(pwd) local printf readonly x=1 readonly
+	done done $(pwd) grep | then --verbose | local $(pwd) $(pwd)
+${HOME} x=1 done readonly && echo export 'quoted text'
+		then x=1 test export 2>/dev/null cd then "$1" done grep --verbose -eu export
+	echo "$1" /usr/bin ${HOME} grep test printf | $(pwd) --verbose /usr/bin
+		-eu readonly awk then --verbose grep
+2>/dev/null then local "$1" | -eu local test
+	printf echo 2>/dev/null export | local cd grep ${HOME} $(pwd) |
+	| then /usr/bin echo grep "$1" --verbose
+		sed test export grep done local 'quoted text' ${HOME} &&
+		printf local printf 'quoted text'
+	test 'quoted text' 2>/dev/null 'quoted text' local local $(pwd) x=1 "$@"
+	/usr/bin done "$1" test /usr/bin ${HOME} awk export --verbose
+printf awk cd 2>/dev/null printf 2>/dev/null done
+		2>/dev/null ${HOME} "$@" grep local test | readonly /usr/bin "$@" "$1" grep local
+awk ${HOME} done grep | "$@" -eu local /usr/bin
+	'quoted text' -eu grep done 2>/dev/null 'quoted text' "$1" ${HOME} "$@" readonly
+		-eu -eu | sed then readonly export ${HOME} readonly ${HOME} "$1" | done sed
+	x=1 $(pwd) done readonly
+	'quoted text' grep ${HOME} then 2>/dev/null | printf
+		echo test /usr/bin --verbose sed $(pwd) then printf $(pwd) x=1 then sed sed "$1"
+		'quoted text' grep /usr/bin done 2>/dev/null -eu /usr/bin local
+	${HOME} -eu "$1" -eu x=1 $(pwd) | cd awk echo /usr/bin | local /usr/bin
+	local 2>/dev/null grep done then --verbose sed "$1" local x=1 export awk
+	--verbose $(pwd) --verbose readonly grep $(pwd) awk $(pwd) ${HOME} -eu printf
+		"$@" test 2>/dev/null done then
+printf "$@" ${HOME} $(pwd)
+	&& "$1" cd sed readonly awk --verbose cd "$@" local /usr/bin readonly "$1"
+/usr/bin printf test "$1" sed -eu echo local echo $(pwd)
+	done "$@" "$1" done "$@" done sed
+		2>/dev/null sed grep "$@" && 2>/dev/null
+-eu --verbose 2>/dev/null /usr/bin awk /usr/bin readonly | test local
+		x=1 x=1 export test --verbose
+--verbose ${HOME} "$1" local --verbose
+then ${HOME} | "$@" awk --verbose 'quoted text'
+	local test x=1 local x=1 awk export x=1 test 2>/dev/null local grep && && awk
+		readonly $(pwd) awk /usr/bin "$1" local 2>/dev/null
+sed cd awk done grep "$1"
+	readonly local done local "$1" $(pwd) $(pwd) | echo "$@" ${HOME} grep "$@" $(pwd)
+&& local /usr/bin local | && readonly x=1 ${HOME} sed sed done test
+cd -eu readonly | then grep test sed
+echo x=1 | && 2>/dev/null ${HOME} echo local -eu 'quoted text' /usr/bin 'quoted text'
+| grep --verbose | 'quoted text' --verbose printf local
+	readonly echo -eu export readonly sed export awk sed && x=1 grep export /usr/bin
+		2>/dev/null cd && 2>/dev/null -eu /usr/bin readonly echo awk 'quoted text'
+	export local local /usr/bin
+2>/dev/null cd then "$1" x=1 $(pwd) export test readonly local awk $(pwd) awk
+	/usr/bin readonly -eu printf
+		local sed | cd "$@" /usr/bin then echo awk done "$@" readonly "$1" -eu
+	x=1 | && then done --verbose $(pwd) 'quoted text'
+		sed local awk 'quoted text' local 'quoted text'
+		export echo then -eu test ${HOME}
+		echo "$@" cd "$@" "$1" && sed local
+	$(pwd) grep export --verbose test $(pwd) $(pwd) sed cd
+		| 'quoted text' && | grep printf test
+	-eu readonly then awk then printf -eu --verbose
+		&& 'quoted text' | done
+then echo then readonly cd 2>/dev/null
+| awk x=1 "$1" export echo $(pwd) $(pwd) local $(pwd)
+		"$@" "$@" -eu 2>/dev/null "$1" local done x=1 echo 2>/dev/null $(pwd)
+	export cd $(pwd) export x=1
+		test awk /usr/bin awk 'quoted text' "$@" then local echo echo --verbose "$@" |
+	| cd printf -eu sed echo local
+		done sed local done 'quoted text'
+		readonly awk then local ${HOME} done x=1
+"$1" | test ${HOME} "$1" x=1 /usr/bin
+echo "$@" then grep printf test 2>/dev/null readonly export x=1 sed
+		done 'quoted text' | && local then cd awk x=1 grep awk grep test x=1 -eu 'quoted text'
+done && echo test done grep then export "$1" --verbose export && 2>/dev/null readonly
+		2>/dev/null export export awk export -eu "$1" done printf ${HOME} 'quoted text'
+		echo --verbose done echo
+		2>/dev/null $(pwd) 2>/dev/null --verbose 2>/dev/null ${HOME} 2>/dev/null test
+		echo test then | && x=1
+test echo grep echo done cd /usr/bin $(pwd) --verbose
+test "$1" readonly sed cd
+	awk -eu | echo test | "$1" 2>/dev/null local x=1 readonly $(pwd) -eu printf printf
+	x=1 && -eu printf | sed sed -eu echo /usr/bin x=1 /usr/bin
+readonly echo awk "$1" && -eu sed done "$1" local
+		test --verbose 'quoted text' local $(pwd) awk awk echo "$@" then -eu $(pwd) test
+	echo | export "$1" then -eu then echo awk test 'quoted text' readonly 'quoted text'
+	${HOME} ${HOME} then | ${HOME} local
+	&& echo done sed test 'quoted text' | $(pwd) sed | "$@" -eu ${HOME}
+		readonly cd --verbose local export
+-eu && -eu ${HOME} grep awk 2>/dev/null
+	export --verbose "$@" 2>/dev/null local
+	sed | then "$@" ${HOME} done test cd echo 2>/dev/null
+		'quoted text' /usr/bin "$1" "$@" | 'quoted text' && sed && grep 'quoted text'
+	$(pwd) echo --verbose done "$@" 'quoted text' "$@"
+"$@" then done "$1" | grep $(pwd) export 2>/dev/null /usr/bin export
+$(pwd) echo then --verbose "$@" "$1" -eu $(pwd) "$@" "$@"
+--verbose "$1" awk awk cd && cd then "$1" ${HOME} done echo
+sed ${HOME} /usr/bin echo
+		awk "$@" grep then /usr/bin x=1 awk 2>/dev/null sed then | printf
+	sed "$1" cd test printf ${HOME} echo cd done ${HOME} 2>/dev/null
+	local export ${HOME} "$1" /usr/bin done /usr/bin grep grep
+	/usr/bin printf echo local "$1" then cd then x=1 /usr/bin
+test && 2>/dev/null done grep 2>/dev/null -eu
+	grep export ${HOME} 'quoted text' then x=1 awk $(pwd) $(pwd)
+'quoted text' | ${HOME}
+	test echo "$1" "$1" readonly /usr/bin export | export test -eu sed printf $(pwd)
+2>/dev/null "$1" test
+	2>/dev/null 'quoted text'
+		$(pwd) sed $(pwd) x=1 "$@" 'quoted text' done printf | sed 'quoted text' 2>/dev/null
+2>/dev/null test && local $(pwd) "$1" "$1" test "$@" awk 'quoted text'
+then 2>/dev/null sed x=1
+	| local printf printf /usr/bin grep echo sed --verbose --verbose
+	local grep "$1" "$@" /usr/bin -eu done readonly export then
+	export awk export ${HOME} echo && ${HOME} done local
+		"$@" 2>/dev/null ${HOME} printf --verbose export awk export cd --verbose
+$(pwd) done "$1" -eu 'quoted text' $(pwd)
+then sed test echo then "$1" done cd "$1" 'quoted text'
+		echo | readonly done awk ${HOME} readonly 'quoted text' 'quoted text' done
+	export ${HOME} 2>/dev/null awk cd
+		export readonly export /usr/bin grep "$1" done awk grep --verbose cd /usr/bin
+		sed && x=1 echo x=1 grep done
+		echo --verbose $(pwd) ${HOME} 2>/dev/null --verbose printf grep && -eu grep
+	--verbose /usr/bin cd test --verbose readonly
+		printf done readonly cd echo | test done ${HOME}
+'quoted text' "$1" | then local awk then x=1 -eu ${HOME} $(pwd) $(pwd)
+	test echo awk /usr/bin then "$@" echo ${HOME} export
+	x=1 ${HOME} sed cd | --verbose done then "$@" ${HOME} ${HOME}
+	echo awk $(pwd) /usr/bin --verbose
+		--verbose --verbose printf
+		local test done export /usr/bin then 2>/dev/null cd | && readonly $(pwd)
+	/usr/bin readonly | grep sed sed test local | grep --verbose
+"$1" done then test "$@" 'quoted text' printf
+-eu && ${HOME} $(pwd) local
+"$@" echo "$@" then 2>/dev/null done | $(pwd) readonly
+		${HOME} ${HOME} x=1 then x=1 x=1 export test readonly $(pwd) $(pwd) ${HOME}
+	done /usr/bin | grep ${HOME} grep "$@" /usr/bin local then readonly echo 'quoted text'
+	printf /usr/bin 2>/dev/null && "$@" ${HOME}
+	echo export printf $(pwd) $(pwd) echo readonly printf readonly
+echo x=1 readonly printf 'quoted text' test "$@" test "$@"
+local printf then done awk -eu -eu "$1" cd | "$1" x=1 x=1 x=1 then x=1 -eu echo
+		| cd awk --verbose local /usr/bin
+	--verbose awk then export x=1 cd done 2>/dev/null export
+		done ${HOME} -eu $(pwd) ${HOME} grep then --verbose
+grep -eu && ${HOME} cd echo readonly
+	"$1" test readonly done "$@" /usr/bin awk sed local
+	then grep grep then | | 'quoted text' $(pwd) grep readonly $(pwd) grep "$@"
+		'quoted text' /usr/bin sed "$@" ${HOME} 2>/dev/null /usr/bin --verbose
+		"$1" echo && export echo | echo
+printf echo "$1" then "$1" sed "$1" cd local then -eu 2>/dev/null 'quoted text'
+"$1" sed | | export | | echo echo local 'quoted text' awk local
+		cd sed grep 'quoted text' readonly "$@" sed cd x=1 && echo x=1
+2>/dev/null readonly awk 2>/dev/null cd grep && awk
+	2>/dev/null $(pwd) local "$1" sed | 'quoted text'
+/usr/bin grep local then | 'quoted text'
+	$(pwd) /usr/bin test x=1 export
+sed done echo local /usr/bin -eu 2>/dev/null 'quoted text' export
+${HOME} "$@" && echo x=1 $(pwd) /usr/bin awk -eu export test
+	test | printf "$1" 2>/dev/null && ${HOME} local x=1 'quoted text' cd x=1 export
+"$1" "$@" | sed "$1" then local --verbose export "$1" --verbose
+		| echo export --verbose $(pwd) "$1" 2>/dev/null 'quoted text'
+	test sed grep 'quoted text'
+		--verbose $(pwd) -eu readonly cd &&
+-eu | test "$@" | $(pwd) /usr/bin $(pwd)
+readonly readonly awk
+then readonly readonly sed /usr/bin && x=1 && grep
+		cd printf && && then /usr/bin echo "$1" grep export grep test printf export
+		x=1 $(pwd) printf echo $(pwd) --verbose awk cd --verbose export
+		local "$1" sed | && --verbose
+		test grep then "$@" test -eu readonly awk
+	readonly done 2>/dev/null
+		sed && then x=1 echo 'quoted text' then --verbose
+	-eu 'quoted text' 'quoted text' readonly local $(pwd) test 2>/dev/null
+	printf | echo echo && done awk x=1 cd 'quoted text'
+		cd readonly --verbose awk "$@" cd x=1 sed x=1 --verbose 2>/dev/null -eu
+		cd "$1" awk then export test cd x=1 $(pwd) printf cd local sed | && 'quoted text'
+		x=1 local /usr/bin x=1 export | then /usr/bin | | then | cd local
+	local echo | $(pwd) awk awk done 'quoted text'
+cd done ${HOME} "$1" $(pwd) cd sed done -eu printf
+		cd readonly then export grep readonly $(pwd) -eu "$1" "$@" ${HOME} 'quoted text'
+"$@" && local | /usr/bin ${HOME} x=1 2>/dev/null done && ${HOME}
+	--verbose grep x=1 && test readonly
+	x=1 done 'quoted text' sed 'quoted text' grep then awk 'quoted text' | export x=1
+	2>/dev/null cd /usr/bin x=1
+&& 2>/dev/null ${HOME} && /usr/bin readonly --verbose readonly 2>/dev/null
+local | cd "$@" "$1" 2>/dev/null
+	echo -eu done | --verbose 2>/dev/null
+		2>/dev/null readonly cd && readonly
+	&& "$1" echo | && x=1 "$@" cd readonly /usr/bin "$@" sed
+	export awk local test readonly --verbose sed
+	test | x=1 export ${HOME} x=1 x=1 x=1 echo test
+		/usr/bin export done test ${HOME}
+$(pwd) then grep awk /usr/bin /usr/bin x=1 cd grep local "$1"
+	$(pwd) sed awk /usr/bin -eu 'quoted text' local
+		${HOME} ${HOME} local --verbose local -eu local "$1" readonly
+readonly awk /usr/bin "$1" 'quoted text' readonly
+		"$1" && grep --verbose cd "$1" test
+		"$@" | awk readonly test then --verbose | && test
+	2>/dev/null local readonly sed local ${HOME} /usr/bin
+'quoted text' grep | 2>/dev/null grep echo local
+-eu 'quoted text' "$1" readonly awk | "$@" test then then /usr/bin then
+${HOME} cd local echo grep printf printf --verbose export echo /usr/bin
+cd && ${HOME} ${HOME} 2>/dev/null grep | 'quoted text' -eu ${HOME}
+		'quoted text' 2>/dev/null --verbose done 'quoted text' grep
+	echo ${HOME} /usr/bin then sed | then printf
+	sed printf awk 'quoted text' then && done sed grep -eu sed
+-eu /usr/bin 2>/dev/null ${HOME} | awk /usr/bin echo cd $(pwd) echo --verbose
+cd sed then readonly export
+	awk 'quoted text' ${HOME} -eu /usr/bin | "$1" readonly sed | done ${HOME}
+		2>/dev/null "$1" 'quoted text' x=1
+test x=1 'quoted text' grep awk 'quoted text'
+	cd echo test "$@" --verbose printf && test sed | x=1
+		awk && && echo x=1 /usr/bin -eu test "$1" grep -eu done -eu
+		awk echo /usr/bin $(pwd) local
+		"$1" x=1 "$@" --verbose 'quoted text' local local 2>/dev/null
+		2>/dev/null echo --verbose /usr/bin cd && grep
+"$1" sed "$@" sed grep /usr/bin $(pwd)
+test $(pwd) then -eu --verbose "$1" cd /usr/bin
+&& $(pwd) /usr/bin "$@" "$@" awk $(pwd) sed x=1 export then
+		export 2>/dev/null done 2>/dev/null echo then x=1 grep export test $(pwd)
+awk local | local local --verbose done 'quoted text'
+	grep done cd readonly "$1" awk awk readonly --verbose sed export printf then
+		sed cd | export 'quoted text' "$@" sed /usr/bin && /usr/bin sed done
+	${HOME} awk "$@" export x=1 2>/dev/null $(pwd) test local
+	cd | ${HOME} ${HOME} /usr/bin done echo printf 'quoted text' export $(pwd)
+"$@" grep x=1 $(pwd) $(pwd) x=1 "$@" $(pwd)
+		| x=1 ${HOME} printf -eu x=1 sed done grep 2>/dev/null local "$1"
+		$(pwd) echo printf | done export | grep cd 2>/dev/null | /usr/bin done 'quoted text'
+		local --verbose && --verbose grep readonly awk -eu 'quoted text' readonly
+		'quoted text' awk echo
+echo --verbose done grep ${HOME} "$1" local | sed | 'quoted text' export -eu
+		&& sed printf | ${HOME} grep "$1" awk cd /usr/bin
+	/usr/bin "$1" awk local $(pwd) && "$1" readonly ${HOME} test readonly done
+		test "$1" awk 'quoted text' -eu --verbose echo export
+-eu awk grep done then then done --verbose export --verbose x=1 echo
+sed 2>/dev/null test awk local done echo && cd readonly export test && test
+		| ${HOME} --verbose --verbose -eu "$@" x=1 printf | "$@" "$1" ${HOME}
+-eu $(pwd) ${HOME} then
+| && ${HOME} | "$1" "$@" local 'quoted text' ${HOME} export export
+	"$1" -eu && | $(pwd) awk
+	${HOME} local sed --verbose readonly "$@" readonly echo awk done
+	"$@" -eu -eu then 'quoted text' -eu done x=1 --verbose -eu x=1 'quoted text'
+$(pwd) export -eu "$1" cd done x=1 test cd /usr/bin
+	local awk ${HOME} readonly "$1"
+		"$@" && | done 2>/dev/null
+printf 2>/dev/null 'quoted text' done test
+	| sed cd ${HOME} -eu ${HOME} echo |
+		"$1" test 'quoted text' $(pwd) readonly grep ${HOME} readonly 2>/dev/null "$@"
+2>/dev/null 2>/dev/null grep export then "$1" readonly -eu readonly cd export
+"$@" | 'quoted text' echo
+		then test cd awk -eu awk cd local 'quoted text' cd local
+		done echo && local done readonly x=1 && -eu readonly echo readonly
+then ${HOME} --verbose |
+		'quoted text' readonly --verbose awk && --verbose export then /usr/bin
+${HOME} && ${HOME} export awk
+test then readonly x=1 echo grep printf export readonly
+		sed | printf /usr/bin --verbose ${HOME}
+	x=1 /usr/bin local grep grep -eu ${HOME} printf
+		'quoted text' cd --verbose awk /usr/bin test readonly && sed then $(pwd)
+	local grep && echo ${HOME} "$@"
+	-eu /usr/bin "$@" done awk 2>/dev/null test printf /usr/bin 2>/dev/null
+	| readonly x=1 done -eu && local echo grep 2>/dev/null
+then printf 2>/dev/null export printf 'quoted text'
+		${HOME} done then test 2>/dev/null && echo | echo
+2>/dev/null && printf cd x=1 ${HOME} ${HOME}
+	readonly "$@" | local test 'quoted text' cd readonly $(pwd) | | cd ${HOME}
+export x=1 "$@" "$@" export grep readonly grep echo 'quoted text' cd test
+		&& sed local /usr/bin then --verbose $(pwd) "$@" then /usr/bin
+	$(pwd) test | awk | cd x=1 readonly echo awk sed /usr/bin
+done then | grep sed sed test && | | local local --verbose "$1"
+		awk printf grep export grep awk printf | readonly done 'quoted text'
+x=1 /usr/bin export echo export
+		test export readonly x=1 local 2>/dev/null test ${HOME} /usr/bin
+		grep test "$1" "$@" | x=1 -eu "$1" awk 2>/dev/null 'quoted text'
+	done grep cd grep echo done readonly x=1 echo /usr/bin
+	2>/dev/null "$1" x=1 test 'quoted text' $(pwd) 2>/dev/null awk "$1" | test
+		awk && then local 2>/dev/null echo $(pwd) "$1" "$1"
+		cd --verbose printf && awk 'quoted text' test
+	export local x=1 -eu | done $(pwd) x=1 'quoted text' x=1 'quoted text' export
+		| export echo readonly printf && $(pwd)
+		then sed "$@" 2>/dev/null $(pwd) readonly "$@" 'quoted text'
+		echo awk export echo /usr/bin "$@" && /usr/bin
+'quoted text' printf printf done "$@" readonly "$1" awk done export 2>/dev/null
+		'quoted text' | ${HOME} -eu /usr/bin readonly
+		-eu awk local then "$@" then "$@" cd "$1" -eu
+		"$1" x=1 "$@" | export readonly export local x=1 | readonly
+		--verbose export "$@" local readonly
+		"$1" awk readonly cd cd printf | $(pwd) 2>/dev/null ${HOME} 'quoted text'
+		${HOME} grep grep sed $(pwd)
+		x=1 $(pwd) then then && -eu "$1" echo grep test grep -eu awk echo
+		/usr/bin awk printf 2>/dev/null grep /usr/bin test x=1
+/usr/bin /usr/bin sed then | done "$@" --verbose ${HOME} grep 2>/dev/null "$1"
+	awk local test done -eu then && 'quoted text' local $(pwd) awk $(pwd) -eu awk $(pwd)
+	echo grep export then readonly x=1 "$@" done "$@"
+cd cd echo 'quoted text' cd $(pwd) "$1"
+		readonly -eu readonly && ${HOME} grep echo -eu printf $(pwd)
+		done done /usr/bin && | "$@" sed && cd | cd --verbose x=1 "$1" /usr/bin /usr/bin
+readonly cd | --verbose --verbose local /usr/bin printf "$1" export printf
+		cd export grep done --verbose sed $(pwd) grep --verbose
+	awk printf printf test /usr/bin echo -eu test
+	$(pwd) done "$@" 2>/dev/null test "$@" grep done 2>/dev/null x=1
+/usr/bin export export printf | "$@" "$1" then local x=1 "$@" export then
+	then x=1 awk "$1" export x=1 /usr/bin "$1" &&
+	export "$1" sed export test "$1" /usr/bin export --verbose 'quoted text'
+		export readonly then /usr/bin ${HOME} local && x=1 sed echo local
+	local "$@" && test export 2>/dev/null done 2>/dev/null test done ${HOME} printf
+export | --verbose "$1" /usr/bin && grep "$@"
+grep then printf -eu
+$(pwd) sed printf readonly grep
+/usr/bin 2>/dev/null x=1 "$@" "$@" "$1" /usr/bin export -eu /usr/bin ${HOME}
+		/usr/bin done cd readonly /usr/bin && /usr/bin && awk x=1 local 2>/dev/null then
+		$(pwd) "$@" export awk sed 'quoted text' "$1" | awk | printf
+$(pwd) cd export 2>/dev/null grep &&
+	"$@" --verbose 2>/dev/null readonly
+	awk sed printf cd --verbose | -eu -eu then export echo readonly $(pwd) awk "$@"
+	grep 'quoted text' 2>/dev/null
+	-eu -eu | $(pwd) readonly ${HOME} awk "$@" test readonly | test 'quoted text'
+	done grep $(pwd) grep readonly readonly 'quoted text' 'quoted text' $(pwd)
+		--verbose done test && printf test sed printf "$@" -eu
+		$(pwd) x=1 "$@" local "$1" done local test awk | x=1 test
+		${HOME} x=1 readonly && 2>/dev/null awk readonly awk "$@" awk printf "$@" test
+echo sed sed "$@" printf
+echo | cd $(pwd) $(pwd)
+'quoted text' "$1" /usr/bin | 'quoted text'
+	awk --verbose "$1" done export awk | /usr/bin
+	"$1" sed ${HOME} grep then && 2>/dev/null "$@" ${HOME} test awk test
+echo awk 'quoted text' echo done
+local --verbose && export /usr/bin "$1" 'quoted text'
+		/usr/bin then --verbose cd /usr/bin
+	export sed export test 'quoted text' ${HOME} && awk printf
+	"$@" ${HOME} then x=1 done
+	printf "$1" && $(pwd) readonly sed "$1" /usr/bin awk readonly $(pwd) awk
+	2>/dev/null "$1" readonly echo then /usr/bin
+2>/dev/null "$@" then ${HOME} "$1" readonly --verbose done
+2>/dev/null /usr/bin "$1" sed then $(pwd) $(pwd) | readonly
+		printf then --verbose ${HOME} /usr/bin /usr/bin "$1" 'quoted text' $(pwd)
+&& 2>/dev/null "$1" | awk cd
+	echo 2>/dev/null 'quoted text' grep $(pwd)
+	/usr/bin readonly export cd sed "$1" --verbose
+		x=1 --verbose readonly $(pwd) done
+export /usr/bin /usr/bin /usr/bin echo sed test x=1 "$1" --verbose sed grep
+	$(pwd) echo export "$@" --verbose local cd 'quoted text'
+	&& $(pwd) ${HOME} done 'quoted text' /usr/bin -eu 2>/dev/null
+printf test grep grep -eu 2>/dev/null echo x=1 export "$1" $(pwd)
+		--verbose echo printf $(pwd) grep 2>/dev/null ${HOME} then
+	$(pwd) grep echo /usr/bin && "$@" export
+		$(pwd) "$@" "$1" test done awk cd printf sed "$1" done
+"$@" ${HOME} --verbose cd -eu /usr/bin 2>/dev/null local 2>/dev/null
+| grep $(pwd) awk readonly ${HOME} readonly test done x=1 test done awk done
+	'quoted text' grep printf sed sed "$@" x=1 'quoted text' test /usr/bin
+		x=1 'quoted text' awk local test cd readonly awk ${HOME}
+	done then "$@" export cd 2>/dev/null /usr/bin printf 'quoted text'
+		echo export local then readonly local
+	--verbose test awk cd "$1" then cd "$1" grep awk sed echo test cd grep
+		'quoted text' 2>/dev/null
+sed cd cd ${HOME} --verbose done 'quoted text' awk $(pwd) "$1" printf printf
+$(pwd) -eu $(pwd) cd -eu "$@" $(pwd)
+		/usr/bin | echo 2>/dev/null
+		then 'quoted text' $(pwd) awk --verbose | test printf done
+--verbose "$1" sed readonly /usr/bin x=1 test 'quoted text' local | -eu readonly
+awk "$1" sed 2>/dev/null grep
+local test cd && test cd grep "$1" local 2>/dev/null
+		| echo -eu x=1 grep "$1" test 2>/dev/null awk ${HOME} -eu $(pwd) printf readonly
+local "$@" echo then printf local x=1 /usr/bin -eu -eu local x=1 awk -eu
+echo readonly export | cd $(pwd) $(pwd)
+		-eu /usr/bin "$@" then "$@" ${HOME} 'quoted text' 2>/dev/null
+"$1" /usr/bin done $(pwd) | | -eu -eu cd "$@" sed $(pwd) echo grep 2>/dev/null
+	sed --verbose --verbose && && done cd "$@"
+		done 2>/dev/null then
+	sed done x=1 --verbose printf -eu x=1 export then printf cd cd /usr/bin "$@" |
+local echo cd local awk --verbose
+"$@" done /usr/bin readonly /usr/bin local
+	${HOME} $(pwd) readonly then ${HOME} && 'quoted text' 'quoted text'
+		| "$@" cd done -eu --verbose printf echo done then "$@" ${HOME}
+grep "$@" "$@" $(pwd) export ${HOME} then readonly $(pwd) test export
+-eu awk awk ${HOME} done 2>/dev/null | awk grep cd readonly
+	| local done /usr/bin --verbose 'quoted text' awk $(pwd)
+		--verbose awk readonly sed echo && --verbose grep 2>/dev/null
+local export "$@" local cd sed
+		/usr/bin export test test $(pwd) | awk 2>/dev/null "$1" /usr/bin printf
+		--verbose then --verbose --verbose done && readonly local $(pwd) ${HOME} export
+		2>/dev/null --verbose done
+test && "$@" then readonly 2>/dev/null then "$1" 2>/dev/null && && done "$@"
+		then test cd done $(pwd) | cd awk 2>/dev/null x=1 echo
+	cd "$1" 2>/dev/null grep && "$1" export /usr/bin && x=1 -eu cd
+"$1" grep "$1" -eu ${HOME} awk local
+	"$@" x=1 readonly test local $(pwd) 'quoted text' export "$1"
+	| cd $(pwd) && readonly 'quoted text' ${HOME} printf 2>/dev/null /usr/bin export
+	cd then $(pwd) && && done done && local export cd | export printf x=1 /usr/bin
+	$(pwd) 'quoted text' then 'quoted text' readonly /usr/bin readonly
+		grep readonly "$1" export
+		echo sed /usr/bin test readonly x=1 2>/dev/null x=1
+sed 2>/dev/null "$@" printf -eu /usr/bin
+grep /usr/bin test ${HOME} | && sed x=1 then -eu awk printf export -eu -eu export
+	readonly --verbose grep export readonly export | && done grep
+-eu sed readonly | echo
+	--verbose x=1 /usr/bin | /usr/bin cd --verbose test
+		$(pwd) readonly && local --verbose echo | done --verbose --verbose
+		--verbose --verbose 2>/dev/null export sed
+$(pwd) --verbose printf awk ${HOME}
+		echo $(pwd) ${HOME} "$1" readonly x=1 printf --verbose --verbose
+	2>/dev/null "$1" "$1" "$@" grep $(pwd) sed cd $(pwd) readonly
+readonly /usr/bin "$@" x=1 local | done awk echo 'quoted text' sed "$@" x=1
+	/usr/bin ${HOME} readonly
+		sed local printf awk -eu cd | export
+	then -eu local --verbose /usr/bin readonly "$@" grep -eu
+		sed local local -eu then --verbose --verbose 'quoted text' awk 2>/dev/null
+		/usr/bin then done readonly
+		x=1 awk 2>/dev/null && "$1"
+/usr/bin printf && 'quoted text' ${HOME}
+readonly --verbose "$@" --verbose 'quoted text' cd --verbose $(pwd)
+	-eu export cd test done ${HOME} 2>/dev/null &&
+		sed local "$1" -eu --verbose grep $(pwd)
+		local "$@" done echo grep readonly 'quoted text' /usr/bin /usr/bin
+		export done grep sed awk readonly grep && done "$1"
+local done $(pwd) printf printf | -eu then local then /usr/bin | done
+		&& readonly $(pwd) cd done awk local printf $(pwd) awk then cd 'quoted text'
+		printf awk && 2>/dev/null export ${HOME} echo readonly printf
+		cd 2>/dev/null done then grep readonly x=1
+-eu done sed "$1" done done x=1 --verbose grep done -eu test
+	$(pwd) | then && export "$1"
+		grep -eu printf $(pwd) -eu /usr/bin local
+${HOME} "$@" 'quoted text' export
+	local && 2>/dev/null 2>/dev/null --verbose readonly
+	-eu printf ${HOME} local export
+	export readonly grep x=1 sed && printf 'quoted text' /usr/bin --verbose
+	done "$@" export /usr/bin echo local | then && -eu && test local export 2>/dev/null
+"$1" test local sed 'quoted text' local grep echo printf local
+	sed readonly 2>/dev/null export --verbose export | 'quoted text'
+		echo export sed readonly ${HOME} x=1 awk --verbose
+	grep --verbose /usr/bin readonly test $(pwd) echo ${HOME} local
+-eu local awk echo cd
+		${HOME} 2>/dev/null -eu $(pwd) cd /usr/bin sed $(pwd) 'quoted text' "$@"
+		awk test && | "$@" local 'quoted text' sed 2>/dev/null awk local
+		&& grep grep ${HOME} printf printf && readonly test cd sed then 2>/dev/null
+		sed "$1" echo ${HOME} && | echo && 2>/dev/null
+echo && | ${HOME} x=1 | /usr/bin done test x=1 grep done
+sed then "$@" then 'quoted text' "$@" cd "$@" $(pwd) 'quoted text'
+	echo "$@" local "$@" $(pwd) 2>/dev/null done $(pwd) printf echo export
+cd echo printf done x=1 echo local echo "$@" export
+	'quoted text' 'quoted text' export done then --verbose sed readonly
+	/usr/bin -eu printf test -eu awk | | echo grep export test "$@" readonly awk "$@"
+grep grep cd export sed
+	done $(pwd) cd | ${HOME} $(pwd) $(pwd) done | cd then echo | readonly
+cd x=1 ${HOME} "$@" awk "$1" sed /usr/bin
+		echo 'quoted text' test echo
+	-eu cd --verbose --verbose
+		-eu ${HOME} -eu printf /usr/bin
+	-eu /usr/bin 2>/dev/null "$@"
+$(pwd) /usr/bin sed test then x=1 "$@" /usr/bin x=1 then local awk
+	| export awk echo then
+	"$1" "$1" && && echo export printf
+local printf $(pwd) echo "$1" export && ${HOME}
+-eu grep test readonly cd -eu printf | ${HOME}
+		local done x=1 awk done "$1" -eu grep local printf test ${HOME} ${HOME}
+		| printf done -eu /usr/bin | "$1" local awk x=1 "$1"
+$(pwd) export x=1 "$1" then "$@" sed readonly "$1" grep awk &&
+	grep export 2>/dev/null test awk $(pwd) printf awk
+/usr/bin --verbose && test cd "$1" sed test
+		sed $(pwd) sed $(pwd) x=1 $(pwd) local done test "$@" /usr/bin local echo 2>/dev/null
+		printf 2>/dev/null -eu 'quoted text' awk sed x=1 then done
+	$(pwd) awk --verbose ${HOME} printf sed export grep printf cd echo
+/usr/bin -eu then "$@" local grep echo echo then test done sed echo
+-eu awk echo echo local | echo ${HOME} cd echo ${HOME}
+	${HOME} $(pwd) "$1" awk 2>/dev/null 'quoted text'
+&& readonly | && $(pwd) export
+	echo echo ${HOME} x=1 printf 'quoted text'
+		--verbose ${HOME} cd x=1 echo
+		export printf awk ${HOME} then grep "$@" then 2>/dev/null
+$(pwd) && readonly && grep --verbose export && 'quoted text' ${HOME}
+	done | readonly awk readonly 'quoted text' | && printf $(pwd) 'quoted text'
+	$(pwd) printf sed sed awk -eu
+		then /usr/bin | | done grep | readonly local local then done
+	-eu sed awk "$@" done readonly
+	/usr/bin --verbose --verbose
+x=1 test cd --verbose -eu
+"$1" "$@" "$1" --verbose echo awk -eu printf readonly export test
+	-eu "$@" ${HOME} -eu /usr/bin | grep --verbose
+		-eu cd printf printf test readonly -eu then printf export export awk
+	done sed $(pwd) awk test grep cd 2>/dev/null test awk x=1 ${HOME}
+		&& --verbose | printf "$1" test 2>/dev/null
+/usr/bin && test ${HOME} printf test /usr/bin ${HOME} 'quoted text' ${HOME}
+		then 'quoted text' ${HOME} grep echo
+	echo printf then export 'quoted text' 'quoted text' printf
+	echo cd "$1" echo /usr/bin readonly | x=1
+$(pwd) --verbose grep x=1 /usr/bin echo done $(pwd)
+	"$@" 'quoted text' "$@" -eu --verbose cd local -eu "$1" readonly
+"$@" 2>/dev/null | awk then "$@" awk grep && 2>/dev/null then
+		"$1" 2>/dev/null printf local --verbose --verbose cd 'quoted text' export
+	done echo done readonly && sed cd "$1" x=1 -eu $(pwd) printf
+		"$@" sed grep then && && readonly x=1 'quoted text'
+awk /usr/bin cd $(pwd) && 'quoted text' done | local cd | printf
+	echo 'quoted text' --verbose --verbose
+	$(pwd) 2>/dev/null $(pwd) awk done 2>/dev/null
+export sed readonly "$1" grep --verbose then -eu sed && export then ${HOME} "$@"
+	"$@" /usr/bin local then test export
+2>/dev/null export 'quoted text' echo 2>/dev/null --verbose
+		x=1 ${HOME} local "$@" /usr/bin && echo "$1" && "$@" && x=1 grep
+--verbose awk grep export "$@"
+		then --verbose | cd cd grep local then printf && awk /usr/bin export 'quoted text'
+		grep grep -eu echo test "$@" test printf x=1 done 2>/dev/null /usr/bin
+		/usr/bin $(pwd) printf /usr/bin export
+x=1 --verbose awk cd local "$@" sed sed | then sed awk
+2>/dev/null ${HOME} 2>/dev/null $(pwd) awk echo --verbose
+		&& test then echo --verbose export && local 2>/dev/null $(pwd) sed
+		| $(pwd) test awk done
+		echo | sed --verbose 'quoted text' --verbose | --verbose
+	done -eu $(pwd) 2>/dev/null -eu
+test sed 2>/dev/null then ${HOME} "$1"
+then then && readonly cd
+		sed --verbose awk readonly cd sed sed 'quoted text' local "$@" "$@" /usr/bin sed
+sed readonly awk "$@" x=1 $(pwd) && -eu then echo ${HOME} $(pwd)
+--verbose export "$1" sed sed $(pwd) /usr/bin 'quoted text' done
+		${HOME} local export echo
+		"$1" echo test local grep test x=1
+	sed echo 2>/dev/null "$1" grep 'quoted text' sed printf done grep -eu readonly
+		then printf echo then --verbose -eu | x=1 test -eu ${HOME} cd 2>/dev/null
+	echo test "$@" printf x=1 "$1" cd "$@" awk done
+		then "$@" -eu export "$1" export
+		| printf ${HOME} -eu ${HOME} done
+"$@" sed sed | sed test /usr/bin
+"$1" 2>/dev/null --verbose local readonly 'quoted text' grep awk
+	2>/dev/null export then test printf && ${HOME} grep local
+	"$@" grep readonly --verbose ${HOME} --verbose -eu $(pwd) && cd "$1" local cd |
+	"$1" done -eu export test /usr/bin 2>/dev/null
+		&& local 2>/dev/null done
+		${HOME} done -eu -eu done echo "$@" "$1" -eu "$1"
+&& sed 2>/dev/null test cd
+echo then local 'quoted text' done
+		export then -eu echo awk done /usr/bin local
+	"$@" 2>/dev/null test | printf awk readonly echo 2>/dev/null local /usr/bin $(pwd)
+echo grep "$1" readonly local -eu ${HOME} export then $(pwd) awk done
+		cd --verbose "$@" then x=1 --verbose --verbose "$@" ${HOME} then printf | sed
+		test export $(pwd) 'quoted text' x=1 "$@" grep cd $(pwd) sed "$1"
+$(pwd) x=1 --verbose readonly /usr/bin awk $(pwd) /usr/bin
+		then && awk x=1 printf 'quoted text' $(pwd) test ${HOME} export grep sed "$@"
+	test printf -eu grep grep $(pwd) readonly /usr/bin
+		"$@" test && 'quoted text' && test awk
+	${HOME} /usr/bin echo then readonly ${HOME} 'quoted text'
+	test /usr/bin /usr/bin then $(pwd) echo | readonly | echo
+		"$1" awk test x=1 | 2>/dev/null echo ${HOME} -eu test echo
+	local grep printf /usr/bin done local sed test --verbose && ${HOME} sed readonly
+$(pwd) test 'quoted text' echo awk awk export done && grep
+		done $(pwd) "$1" x=1 | echo --verbose
+		local "$@" awk done echo && sed cd
+	"$@" 2>/dev/null echo "$1" done sed local awk sed
+		awk test 'quoted text' done cd 'quoted text' x=1 done cd printf &&
+		--verbose "$@" printf 'quoted text' then "$@" grep --verbose sed test ${HOME}
+"$1" $(pwd) ${HOME} $(pwd) -eu export then --verbose then ${HOME} | 2>/dev/null
+	cd done local && sed
+		"$1" printf -eu "$@" $(pwd) echo $(pwd) x=1 awk local --verbose
+	"$1" 'quoted text' | cd echo "$@" local -eu awk echo export
+--verbose grep && echo cd /usr/bin grep "$1" --verbose $(pwd) --verbose grep
+	then done "$1" x=1 2>/dev/null awk sed
+test x=1 "$1" then -eu grep done then export grep ${HOME} local
+		sed -eu && export printf /usr/bin /usr/bin local export $(pwd) echo
+		"$@" export printf && echo test
+&& sed --verbose sed && 'quoted text'
+${HOME} echo && readonly $(pwd) && then done 2>/dev/null cd "$@" "$1" "$@"
+--verbose local sed -eu then echo readonly grep echo export | 2>/dev/null
+done grep "$1" test $(pwd) test /usr/bin printf printf grep &&
+/usr/bin -eu && $(pwd) 'quoted text'
+--verbose && echo x=1 "$1"
+	"$1" 'quoted text' 'quoted text' sed grep "$1" export
+awk "$@" 'quoted text' --verbose
+grep sed export grep x=1
+		grep 2>/dev/null sed
+		-eu $(pwd) test && /usr/bin "$@" local
+	-eu --verbose sed awk readonly 'quoted text' local "$@" /usr/bin
+	awk ${HOME} && | echo | "$@" $(pwd) awk -eu cd ${HOME} && local cd
+		cd | -eu "$@" "$1" x=1 $(pwd) 2>/dev/null
+	echo ${HOME} echo test | then /usr/bin sed local test "$@"
+		done echo test sed x=1 2>/dev/null
+echo 'quoted text' -eu | x=1 x=1 sed
+		/usr/bin readonly "$@" readonly
+	2>/dev/null readonly 'quoted text' sed 2>/dev/null printf ${HOME}
+sed done -eu --verbose
+$(pwd) && ${HOME} printf echo && printf | && x=1 && awk awk cd "$@" ${HOME} "$1"
+	printf 2>/dev/null "$1" cd printf
+	sed awk sed "$1" 2>/dev/null 'quoted text'
+printf 'quoted text' printf export x=1 test /usr/bin grep test
+sed readonly $(pwd) "$@" | 'quoted text'
+		$(pwd) "$@" 2>/dev/null done local "$1" 2>/dev/null
+x=1 then local echo test -eu -eu "$@" cd grep "$@" "$@"
+		&& "$1" 'quoted text' local && /usr/bin
+grep -eu cd x=1 awk "$@" printf $(pwd) cd --verbose export --verbose then
+	awk test 2>/dev/null export "$@" 2>/dev/null && x=1 sed x=1
+sed grep sed printf /usr/bin test test then -eu local awk grep ${HOME} "$@"
+&& echo readonly echo awk awk done $(pwd) printf export echo 2>/dev/null
+	grep readonly | 'quoted text' "$@" test test 2>/dev/null "$1" echo local done
+	2>/dev/null then && test /usr/bin echo $(pwd) ${HOME} then
+	readonly test --verbose ${HOME} echo $(pwd) -eu printf
+sed | -eu "$@" readonly test sed --verbose readonly sed awk | ${HOME} 'quoted text'
+| done echo sed ${HOME} ${HOME} --verbose sed | "$@" ${HOME} 'quoted text'
+		grep --verbose done echo printf /usr/bin test printf awk /usr/bin
+	export cd then export done ${HOME} -eu printf /usr/bin /usr/bin
+		cd "$@" sed test 2>/dev/null test --verbose ${HOME} test awk -eu
+readonly x=1 --verbose x=1 printf /usr/bin "$@" cd | 'quoted text'
+/usr/bin $(pwd) --verbose $(pwd) ${HOME}
+		readonly awk printf ${HOME} grep
+/usr/bin grep "$1" awk export
+		| test done $(pwd) "$@" -eu done && /usr/bin "$@" x=1 sed awk
+	grep $(pwd) sed --verbose x=1 printf
+		| echo export export local grep cd test awk && ${HOME} done cd echo
+$(pwd) -eu export sed $(pwd) echo /usr/bin
+	then /usr/bin test printf then sed then readonly x=1 echo
+grep done sed test --verbose grep export awk then test readonly x=1 /usr/bin
+		then grep export awk ${HOME} "$@"
+	echo done | -eu ${HOME} /usr/bin /usr/bin printf 'quoted text' readonly
+--verbose done awk 'quoted text' ${HOME} "$1" export "$1" grep $(pwd) |
+		cd export done local sed export /usr/bin -eu then readonly $(pwd) grep printf
+"$@" echo x=1 $(pwd) readonly | sed cd test | &&
+-eu sed | /usr/bin /usr/bin 2>/dev/null printf done
+		-eu 2>/dev/null $(pwd) sed echo export
+	test printf test "$1" && /usr/bin && grep printf
+	test x=1 echo cd "$@" cd "$1" --verbose
+2>/dev/null --verbose local "$1" cd ${HOME}
+		${HOME} readonly | grep readonly /usr/bin echo local then done
+	"$1" x=1 grep 'quoted text' x=1 'quoted text' then $(pwd) readonly --verbose
+		${HOME} "$@" cd echo -eu --verbose printf echo -eu cd "$@" /usr/bin "$1" --verbose
+		${HOME} 'quoted text' 'quoted text' $(pwd) readonly && test 2>/dev/null
+		echo && test 2>/dev/null 'quoted text'
+		grep x=1 export export done "$@" --verbose
+	echo export echo x=1 | then "$@"
+	export --verbose printf done export readonly x=1 x=1 local local "$1" export then
+sed done && /usr/bin test done $(pwd) 2>/dev/null
+--verbose "$1" sed done 2>/dev/null then
+&& test $(pwd) done x=1
+	&& -eu $(pwd) readonly && echo 'quoted text'
+		printf -eu /usr/bin test grep then && readonly export
+export test --verbose "$1" then awk grep
+		test x=1 && 'quoted text' $(pwd) 2>/dev/null 2>/dev/null
+readonly sed done | cd readonly 'quoted text' done cd $(pwd)
+	local "$1" "$1" 'quoted text'
+	test -eu -eu 2>/dev/null /usr/bin readonly | done grep /usr/bin
+	--verbose | echo printf done
+	-eu sed ${HOME} local then sed
+	--verbose echo 'quoted text' 2>/dev/null
+		printf awk test ${HOME} --verbose --verbose
+${HOME} readonly then /usr/bin echo "$1" done | grep printf
+		sed sed readonly readonly $(pwd) local then /usr/bin "$1" printf printf 2>/dev/null
+	"$@" readonly -eu -eu && done
+		then /usr/bin && -eu sed
+		| echo printf test local local test test readonly
+		grep test sed 2>/dev/null awk 2>/dev/null
+/usr/bin test 2>/dev/null && export cd --verbose sed local sed 2>/dev/null
+		printf "$@" x=1 export "$@" --verbose
+local $(pwd) sed grep
+cd printf --verbose local export 'quoted text' --verbose
+		awk cd "$1" 2>/dev/null | "$@" "$@" "$@" export local 'quoted text' then -eu
+		readonly awk "$1" && && test test $(pwd) grep sed printf /usr/bin
+${HOME} && export /usr/bin ${HOME} ${HOME}
+	done sed then | then "$1" 2>/dev/null cd 'quoted text'
+printf --verbose printf -eu "$1" then sed x=1 then readonly then grep readonly
+		--verbose $(pwd) --verbose /usr/bin ${HOME} export echo grep /usr/bin test -eu
+then "$@" test -eu /usr/bin sed x=1 | awk test export
+	x=1 test /usr/bin && /usr/bin echo | grep && | 2>/dev/null export --verbose
+$(pwd) | "$1" cd ${HOME} sed --verbose
+	${HOME} "$1" 2>/dev/null local done
+		"$1" then test done /usr/bin
+		echo --verbose ${HOME}
+		'quoted text' then -eu && &&
+		readonly test x=1 sed "$@"
+--verbose sed x=1 local cd $(pwd) printf x=1
+readonly && 2>/dev/null then
+		/usr/bin local x=1 export done && | echo sed "$@" /usr/bin
+"$1" then 2>/dev/null export then
+		${HOME} $(pwd) 2>/dev/null --verbose $(pwd) sed printf export "$1"
+${HOME} "$1" 2>/dev/null 'quoted text'
+2>/dev/null grep sed test && "$@" local
+	"$@" $(pwd) x=1 readonly
+test export -eu && x=1 --verbose awk $(pwd) readonly "$@" cd
+		readonly -eu | test awk /usr/bin awk | /usr/bin 'quoted text' then
+	done 2>/dev/null then test cd ${HOME} --verbose sed local printf
+/usr/bin $(pwd) | | ${HOME} test test cd printf done sed --verbose then "$1"
+	2>/dev/null done printf "$@" x=1 x=1 "$1" done sed export
+		printf export x=1 2>/dev/null ${HOME} local -eu 2>/dev/null
+export --verbose test | grep "$@" cd then 'quoted text' $(pwd) cd test
+		-eu test printf --verbose sed awk --verbose -eu | 'quoted text'
+	"$1" readonly sed done printf $(pwd) grep "$1" sed ${HOME}
+		2>/dev/null "$@" sed test then grep
+cd -eu local then $(pwd) printf cd echo readonly test
+	&& && --verbose awk printf export readonly then 2>/dev/null
+		x=1 awk 'quoted text' local echo sed 'quoted text'
+		cd awk grep local local readonly echo --verbose x=1 x=1 local test then
+export /usr/bin done then readonly --verbose printf
+printf 2>/dev/null /usr/bin --verbose
+	"$1" ${HOME} "$1" readonly cd $(pwd) && -eu printf "$@"
+		printf x=1 printf local /usr/bin
+		printf export x=1 grep local | awk -eu /usr/bin && 'quoted text' printf grep
+		/usr/bin awk 'quoted text' sed --verbose $(pwd) grep && cd awk -eu echo awk
+		"$1" grep ${HOME} then grep local sed "$@" ${HOME} readonly cd x=1 done
+test local --verbose && then | 'quoted text' cd
+	/usr/bin readonly cd /usr/bin 'quoted text' x=1 test readonly
+		$(pwd) cd $(pwd) done $(pwd) x=1 $(pwd) /usr/bin x=1 then "$1" -eu "$@" --verbose
+		x=1 awk printf "$@" export sed then test then
+		test awk | "$@" ${HOME} export local | grep echo x=1 && echo "$1" local
+cd | | $(pwd) printf sed
+	'quoted text' 2>/dev/null --verbose readonly awk readonly --verbose
+		export export cd echo local printf export /usr/bin test done $(pwd) echo
+awk then done local echo grep local 'quoted text' test x=1 2>/dev/null done
+export readonly readonly done ${HOME} 'quoted text' $(pwd)
+	"$1" "$@" -eu && export && sed | $(pwd)
+	then && printf awk sed 2>/dev/null test awk --verbose
+	2>/dev/null awk x=1 ${HOME} export then 'quoted text'
+		&& cd awk x=1 readonly x=1 awk $(pwd) "$1" "$1"
+	done 2>/dev/null | awk local cd $(pwd) $(pwd) x=1 then ${HOME} $(pwd)
+	readonly done x=1 then x=1 grep export sed
+		"$@" local 2>/dev/null export 2>/dev/null
+	&& cd awk cd 'quoted text' test
+$(pwd) && 2>/dev/null then then x=1 export "$@" -eu
+	cd test $(pwd) && "$1" printf --verbose
+2>/dev/null ${HOME} done 2>/dev/null 'quoted text'
+'quoted text' cd | sed grep test grep cd done
+awk ${HOME} readonly 'quoted text' -eu $(pwd)
+		sed -eu $(pwd) grep echo -eu $(pwd) "$1" && x=1 -eu awk printf && --verbose
+	echo readonly printf grep "$@"
+done awk | cd && x=1 echo 'quoted text' printf grep "$1" /usr/bin
+		--verbose done 2>/dev/null /usr/bin ${HOME} printf sed
+grep cd printf then 'quoted text' done cd awk echo 'quoted text' "$@"
+grep done /usr/bin && cd | x=1 "$1" done then $(pwd)
+	grep printf x=1 then 2>/dev/null "$1" grep readonly sed 'quoted text'
+	readonly -eu local x=1 done done "$@" cd grep grep | --verbose x=1 2>/dev/null
+		sed done /usr/bin ${HOME} readonly
+		test --verbose readonly grep | echo
+	"$1" awk readonly x=1 echo ${HOME} grep $(pwd) 'quoted text' readonly
+printf 'quoted text' done $(pwd) readonly x=1 "$1" -eu /usr/bin cd export
+	-eu /usr/bin x=1 -eu $(pwd) 2>/dev/null
+		local then awk x=1 cd export cd | ${HOME} 2>/dev/null | x=1 "$1"
+	cd "$1" done done awk | sed $(pwd) local "$@"
+	done ${HOME} && echo "$@"
+		cd printf sed "$@" then local then awk 2>/dev/null export
+	2>/dev/null x=1 export test "$@" then
+		then | x=1 cd local /usr/bin ${HOME} "$1" -eu cd /usr/bin readonly
+		test test | readonly 'quoted text' test awk && -eu x=1 printf ${HOME}
+	export sed && x=1 awk export ${HOME} grep
+		done grep "$1" echo done
+		export "$@" "$1" export export
+then /usr/bin | grep readonly then "$@" then -eu --verbose awk "$1" done grep ${HOME}
+grep echo awk test --verbose
+	x=1 ${HOME} | x=1 local -eu "$@" readonly printf
+		"$@" cd readonly /usr/bin "$1" readonly
+test && 2>/dev/null $(pwd) done export &&
+		grep readonly | cd /usr/bin -eu printf 'quoted text'
+	readonly "$@" cd "$1" sed test $(pwd) "$@"
+	/usr/bin "$1" | test 'quoted text'
+	-eu test | grep then grep done
+	&& sed 'quoted text' $(pwd) printf 'quoted text'
+x=1 'quoted text' local
+	'quoted text' sed echo awk cd printf "$1" && echo "$@" sed done | done ${HOME}
+		${HOME} sed $(pwd) then $(pwd) |
+		&& echo 'quoted text' x=1 $(pwd) && then && export sed x=1 'quoted text'
+printf 'quoted text' $(pwd) /usr/bin
+		"$1" echo test printf ${HOME} awk done test
+then $(pwd) x=1 local awk "$@" export ${HOME}
+done "$@" | sed "$1" local export done echo grep
+'quoted text' echo readonly ${HOME} grep /usr/bin
+	"$1" && local --verbose $(pwd) grep | 'quoted text'
+grep cd sed --verbose readonly test awk then 'quoted text'
+$(pwd) "$1" test "$1" ${HOME} && readonly $(pwd)
+	then /usr/bin ${HOME} 'quoted text'
+		"$@" cd $(pwd) local "$@"
+		printf local awk --verbose
+	sed test grep then done printf 'quoted text' then
+	export test test grep
+	printf test ${HOME} local x=1 export cd
+	awk ${HOME} awk grep grep echo | 'quoted text'
+	-eu 2>/dev/null done "$1"
+		echo echo 'quoted text' echo ${HOME} test export x=1 local
+"$@" x=1 awk 'quoted text' awk local 'quoted text'
+grep export ${HOME} sed sed
+-eu done readonly done done x=1 "$1" then printf
+		readonly echo readonly done && "$@"
+-eu "$@" awk grep -eu sed
+	cd 'quoted text' echo /usr/bin printf "$1" 'quoted text' awk
+	&& then 'quoted text' sed "$1" sed cd 2>/dev/null then sed
+	"$@" test "$1" 'quoted text' done && done printf echo -eu
+	then echo printf "$1" "$@"
+	cd done 'quoted text' test | -eu then ${HOME} -eu $(pwd) | printf awk "$@"
+	"$1" /usr/bin -eu ${HOME} 2>/dev/null "$1" local
+x=1 "$@" /usr/bin test | && "$1" && ${HOME} readonly "$@" sed "$@"
+/usr/bin 'quoted text' /usr/bin 'quoted text' readonly 'quoted text' 'quoted text'
+	/usr/bin test then local | "$1" 'quoted text'
+&& test 'quoted text' 2>/dev/null printf $(pwd) && sed
+		$(pwd) "$@" | cd echo "$1"
+		sed test sed ${HOME} printf "$1" -eu
+cd /usr/bin echo $(pwd) $(pwd) --verbose test grep "$1" readonly && grep
+	2>/dev/null "$1" "$1" && grep && "$@" test test test cd test
+test 2>/dev/null cd 'quoted text'
+printf "$1" readonly then done x=1 && "$1" $(pwd) test -eu sed
+then "$@" done test then export ${HOME} /usr/bin done
+		awk 'quoted text' readonly local && readonly /usr/bin done readonly
+		"$@" echo && test ${HOME} -eu
+		--verbose && done echo done ${HOME} awk "$1" -eu
+		--verbose /usr/bin "$@" grep
+	grep $(pwd) local local -eu
+echo --verbose grep 'quoted text'
+	echo && "$@" "$1" awk /usr/bin printf cd echo ${HOME} 2>/dev/null readonly
+		export "$1" printf cd -eu export done grep
+		"$1" export "$@" local "$1"
+	--verbose cd 2>/dev/null && test sed
+		readonly sed ${HOME} readonly cd echo 2>/dev/null then
+echo sed ${HOME} 2>/dev/null awk
+/usr/bin /usr/bin | then 'quoted text' 'quoted text'
+--verbose then echo awk ${HOME} "$1" echo
+	done 'quoted text' readonly
+		"$@" awk "$@" test grep export sed -eu grep | -eu test -eu
+		| --verbose sed | | test printf 'quoted text'
+test readonly awk export "$@" test $(pwd)
+	"$@" echo x=1 done /usr/bin readonly
+local printf sed --verbose --verbose -eu "$1"
+		--verbose then grep readonly
+x=1 then -eu x=1 grep test | "$@" printf printf x=1 then then 2>/dev/null
+done local sed test --verbose
+'quoted text' 2>/dev/null --verbose ${HOME}
+-eu test echo ${HOME} "$@"
+	then | /usr/bin --verbose /usr/bin "$1" export -eu cd cd "$@" && printf
+		-eu -eu "$@" export x=1 then ${HOME} printf x=1 | done $(pwd)
+		/usr/bin sed x=1 cd -eu $(pwd) "$@"
+--verbose done export awk "$@" local "$@" local printf /usr/bin echo done done
+	$(pwd) sed printf "$@" cd 'quoted text' export export
+done | && echo done sed test --verbose
+x=1 sed then | cd awk 'quoted text' -eu x=1
+'quoted text' $(pwd) && printf $(pwd) x=1 grep 2>/dev/null test printf --verbose
+		local --verbose 'quoted text' echo sed sed | cd
+local -eu readonly grep --verbose
+	local readonly -eu readonly cd /usr/bin ${HOME} local "$1" sed
+		printf grep -eu cd && done
+		test sed test awk echo done 2>/dev/null $(pwd) cd --verbose
+x=1 /usr/bin x=1 'quoted text' sed printf 'quoted text' then 'quoted text' awk
+readonly test then ${HOME}
+	printf printf awk /usr/bin && x=1
+2>/dev/null echo $(pwd) test -eu 'quoted text' cd /usr/bin done && done grep
+2>/dev/null 2>/dev/null "$1" test cd test "$@" grep grep cd local
+		${HOME} ${HOME} /usr/bin then grep | | test /usr/bin awk $(pwd) test sed
+		printf awk && 'quoted text' grep ${HOME} && "$1" awk && readonly
+	export $(pwd) /usr/bin "$1" -eu
+		&& x=1 printf --verbose cd
+	2>/dev/null | export ${HOME} printf readonly /usr/bin 'quoted text'
+	awk export printf x=1 done x=1 $(pwd) "$@" local
+		x=1 awk done sed echo printf 2>/dev/null ${HOME} local cd grep $(pwd) local 'quoted text'
+"$@" --verbose readonly $(pwd) echo "$@" x=1 'quoted text'
+	| test printf printf $(pwd) $(pwd) cd grep | "$1" 2>/dev/null export
+		printf printf local 2>/dev/null printf local then "$@"
+	"$@" && done 'quoted text' "$1" echo export x=1 -eu echo 2>/dev/null 'quoted text'
+"$1" /usr/bin x=1 "$@" local && /usr/bin
+		$(pwd) done --verbose x=1 local then awk printf sed done
+	readonly awk printf | echo
+	"$@" && printf /usr/bin 2>/dev/null printf then
+test ${HOME} then | readonly
+		local sed && | test export
+		printf x=1 awk cd 2>/dev/null && $(pwd) done echo "$1" 2>/dev/null --verbose x=1
+		--verbose 'quoted text' test /usr/bin
+/usr/bin local readonly printf "$1" | ${HOME} awk awk awk export $(pwd)
+	then local ${HOME} "$@"
+echo | "$@" $(pwd) -eu /usr/bin "$@" x=1 test printf printf -eu && | export
+	'quoted text' printf $(pwd) then grep echo
+	2>/dev/null printf x=1
+readonly printf --verbose
+	x=1 grep "$@" echo | 2>/dev/null "$1"
+-eu echo | && --verbose "$@" cd ${HOME} grep then awk readonly export
+	cd export ${HOME} export $(pwd) done then 2>/dev/null "$1" --verbose
+	'quoted text' awk --verbose awk /usr/bin printf "$1" test readonly
+	grep ${HOME} echo 'quoted text' cd local -eu ${HOME}
+"$@" "$1" export "$@" readonly
+	'quoted text' test && then -eu echo sed ${HOME} 2>/dev/null awk /usr/bin
+	export 'quoted text' "$@" "$1" awk test awk export cd
+		'quoted text' /usr/bin | then -eu test echo
+awk /usr/bin $(pwd) -eu 'quoted text' "$@" -eu && cd awk x=1
+		&& ${HOME} 2>/dev/null export done "$@" 'quoted text' echo done "$1" test &&
+done "$@" then 'quoted text' printf &&
+		2>/dev/null -eu --verbose -eu
+		sed /usr/bin x=1 export $(pwd) $(pwd) local echo ${HOME} && ${HOME}
+		then echo printf "$@" "$1" test ${HOME} && sed
+	x=1 awk export local
+x=1 | ${HOME} ${HOME} cd awk && awk test --verbose export
+"$@" grep -eu printf local cd test
+local printf cd -eu "$1" $(pwd) printf grep
+	grep printf 'quoted text' awk /usr/bin echo 2>/dev/null
+		x=1 "$1" && --verbose &&
+		x=1 readonly cd local "$1" --verbose 2>/dev/null done cd $(pwd) | echo local
+		printf sed | && -eu then grep export
+--verbose "$@" "$@" "$1" 'quoted text'
+		| --verbose awk sed grep readonly &&
+	sed /usr/bin printf ${HOME}
+		--verbose $(pwd) -eu -eu echo ${HOME} x=1 "$@" x=1 echo --verbose local
+local /usr/bin /usr/bin "$@" sed awk 'quoted text'
+		printf ${HOME} x=1 echo sed then $(pwd)
+		"$@" test x=1 echo --verbose awk | test $(pwd) 2>/dev/null cd test /usr/bin
+		grep $(pwd) grep && local /usr/bin echo 'quoted text' cd echo
+x=1 --verbose cd --verbose
+		cd echo 2>/dev/null 'quoted text' | then "$@" $(pwd) ${HOME}
+	$(pwd) grep grep --verbose "$1" then then 2>/dev/null
+		${HOME} ${HOME} readonly awk then grep local "$1" $(pwd)
+		awk "$@" cd /usr/bin "$1" test done --verbose -eu
+	echo awk x=1 -eu -eu /usr/bin 2>/dev/null ${HOME} --verbose x=1
+printf done awk export ${HOME} -eu ${HOME}
+"$@" test cd test readonly 2>/dev/null -eu "$@" x=1 echo 2>/dev/null
+echo then | "$1" local | printf ${HOME} /usr/bin &&
+		2>/dev/null grep awk /usr/bin | ${HOME} x=1 cd 'quoted text' printf
+		cd readonly sed 'quoted text'
+	sed done test "$1" local $(pwd) readonly x=1 test 2>/dev/null && -eu
+local 'quoted text' && 'quoted text' test -eu -eu done | --verbose cd "$@" done
+		"$1" /usr/bin $(pwd) $(pwd) /usr/bin
+done && "$1" /usr/bin cd "$1" sed --verbose "$1" printf grep "$1"
+2>/dev/null 'quoted text' cd ${HOME} sed 2>/dev/null
+${HOME} local test sed awk export local
+		then test export test readonly done $(pwd) | --verbose printf
+		printf printf | sed awk
+2>/dev/null grep grep export "$1" $(pwd) $(pwd) "$@" /usr/bin cd ${HOME} &&
+	-eu echo ${HOME} $(pwd) export | done 2>/dev/null -eu 2>/dev/null $(pwd) grep readonly
+cd "$@" grep cd $(pwd) sed $(pwd)
+		--verbose local local --verbose "$1" awk "$@" 2>/dev/null local echo local local
+--verbose readonly echo ${HOME} sed $(pwd) awk "$1" awk awk printf
+	printf -eu local done /usr/bin -eu local
+		test "$@" 'quoted text' printf
+awk ${HOME} /usr/bin $(pwd) 2>/dev/null
+readonly echo 'quoted text' 'quoted text' sed | | "$1" then awk |
+		$(pwd) $(pwd) readonly 'quoted text' awk && -eu "$@" grep
+${HOME} export | test && x=1 cd
+		x=1 /usr/bin done --verbose && --verbose
+	"$1" echo "$1" printf | readonly --verbose 'quoted text'
+		/usr/bin test "$@" readonly sed ${HOME} export 'quoted text' printf 'quoted text'
+printf && "$1" readonly grep test awk done
+${HOME} /usr/bin && cd 'quoted text' $(pwd) $(pwd) "$@" $(pwd)
+readonly "$@" readonly && readonly awk
+"$@" x=1 "$1" --verbose then local then then
+--verbose 'quoted text' --verbose local --verbose -eu awk --verbose | sed 'quoted text'
+		sed | awk /usr/bin grep sed | x=1 | local
+	awk "$@" test awk export echo sed --verbose local | && grep |
+		'quoted text' then test export $(pwd) | && --verbose /usr/bin
+x=1 $(pwd) readonly -eu ${HOME}
+		echo export && done "$@" then $(pwd) export readonly
+		$(pwd) export local then done ${HOME} grep test
+		awk "$1" printf cd awk 2>/dev/null
+	-eu test printf "$1" sed 'quoted text' "$@" && --verbose 2>/dev/null
+		$(pwd) test ${HOME} cd -eu sed 'quoted text' printf 2>/dev/null /usr/bin
+		readonly -eu "$@" "$@" done
+	readonly -eu readonly local test /usr/bin readonly |
+--verbose awk --verbose x=1 x=1 "$@" ${HOME} test --verbose
+local printf grep 2>/dev/null
+	test x=1 awk --verbose awk x=1 && echo x=1 | --verbose -eu --verbose
+		grep 2>/dev/null 'quoted text'
+		&& "$1" x=1 sed local x=1 test grep
+$(pwd) --verbose done then done "$1" grep echo printf | echo
+&& grep test --verbose sed 2>/dev/null
+		| -eu grep ${HOME} sed -eu && test grep export
+then $(pwd) local printf local echo
+	$(pwd) then && sed "$1" local -eu && -eu
+$(pwd) 2>/dev/null sed "$1" printf cd test "$1" done | then $(pwd)
+	test -eu local then then readonly done awk cd
+		local cd $(pwd) 2>/dev/null 2>/dev/null && "$@" --verbose cd /usr/bin --verbose
+sed printf x=1 grep then grep
+		done then grep then grep export "$@"
+		test x=1 x=1 local local x=1 cd printf grep "$1"
+echo readonly /usr/bin 'quoted text' 'quoted text' && local echo test printf sed
+readonly "$1" awk sed ${HOME} sed -eu --verbose cd done --verbose
+		local /usr/bin printf "$@" local --verbose printf sed echo cd test grep $(pwd) -eu
+		echo export done printf readonly
+"$1" then $(pwd) echo local sed && && test awk "$@" 2>/dev/null --verbose awk
+		$(pwd) 'quoted text' awk
+	grep "$1" -eu "$1" $(pwd) x=1
+		--verbose cd awk echo echo sed -eu echo
+&& "$1" export done done --verbose /usr/bin awk awk test cd /usr/bin awk awk "$1"
+--verbose --verbose local /usr/bin done test 'quoted text'
+		readonly readonly cd 2>/dev/null --verbose | x=1
+	done sed readonly 2>/dev/null
+	'quoted text' 2>/dev/null test local
+printf local "$1" x=1 then local "$@" test ${HOME} /usr/bin 2>/dev/null done --verbose
+		--verbose && export 'quoted text'
+${HOME} 'quoted text' cd sed /usr/bin export -eu /usr/bin
+	echo /usr/bin 'quoted text' cd echo done /usr/bin readonly cd then cd
+	echo "$@" printf --verbose awk /usr/bin sed printf ${HOME} done local x=1
+		| /usr/bin | printf test printf /usr/bin 'quoted text'
+		&& local readonly grep && | "$@"
+	${HOME} && 2>/dev/null /usr/bin
+readonly ${HOME} ${HOME} readonly /usr/bin printf printf awk
+	sed x=1 local done test
+readonly "$1" /usr/bin -eu x=1 && $(pwd) /usr/bin
+grep printf awk "$@" cd "$1" x=1 export awk
+		local printf local export &&
+		"$@" 2>/dev/null --verbose /usr/bin && done readonly
+sed ${HOME} && then "$1" ${HOME} cd "$@" | -eu /usr/bin 'quoted text'
+#include c48.sh
+grep /usr/bin 2>/dev/null "$@" printf printf done
+		sed awk export "$@" /usr/bin awk -eu 'quoted text' test sed readonly test 2>/dev/null
+		awk cd x=1 done grep then "$@" x=1
+then && && --verbose -eu "$@" "$@" done awk x=1 test cd $(pwd)
+		done export $(pwd) "$1" &&
+&& 'quoted text' | readonly | awk readonly test then cd local
+	-eu done x=1 sed "$@" echo -eu
+'quoted text' readonly --verbose
+		printf "$1" $(pwd) "$@" 'quoted text' "$1" sed "$@" |
+echo done then printf sed local "$@" local grep grep readonly
+readonly then awk --verbose grep -eu sed sed then $(pwd)
+		&& cd /usr/bin 2>/dev/null x=1 grep
+		sed 2>/dev/null "$@" -eu echo -eu echo grep cd && local
+	export /usr/bin x=1 'quoted text' then ${HOME} awk done
+	sed --verbose test export $(pwd) | "$@" cd test ${HOME}
+		readonly /usr/bin printf "$@"
+printf test readonly printf 2>/dev/null
+	"$@" -eu 2>/dev/null then $(pwd) 2>/dev/null
+	printf && 'quoted text' grep sed -eu export && cd -eu --verbose ${HOME}
+	/usr/bin sed "$1" done local "$1" export test done echo sed -eu $(pwd) sed done
+	test awk 2>/dev/null export
+then "$@" 'quoted text' echo 2>/dev/null 'quoted text' echo $(pwd) grep local
+'quoted text' -eu -eu test x=1 printf 2>/dev/null printf readonly |
+${HOME} $(pwd) export done ${HOME}
+--verbose readonly export grep $(pwd) --verbose /usr/bin
+	x=1 readonly $(pwd) /usr/bin -eu grep --verbose ${HOME} x=1 --verbose
+		--verbose readonly readonly x=1 awk done 'quoted text' printf then readonly
+2>/dev/null 2>/dev/null && 'quoted text'
+grep x=1 readonly 'quoted text' echo /usr/bin ${HOME} x=1 test cd test ${HOME}
+	"$@" awk printf sed then -eu ${HOME} local 'quoted text' done export 2>/dev/null
+	grep cd 'quoted text' 2>/dev/null
+		readonly 'quoted text' export /usr/bin readonly ${HOME} 2>/dev/null 'quoted text'
+		echo ${HOME} "$1" echo "$1" --verbose -eu cd 'quoted text' "$@" export --verbose
+$(pwd) done | "$@" cd echo printf -eu 'quoted text' readonly
+		readonly /usr/bin local done ${HOME} echo then cd sed cd "$1" cd export export
+	--verbose "$@" -eu awk export grep then local test 'quoted text' cd
+"$1" ${HOME} test $(pwd) test
+	| --verbose local "$@" echo | echo cd
+| --verbose sed 'quoted text' 2>/dev/null done 2>/dev/null done
+cd export echo local $(pwd) then "$@" /usr/bin
+	echo $(pwd) test awk grep sed readonly -eu awk | test | local 2>/dev/null "$1"
+export | "$@" sed done ${HOME}
+	test -eu readonly echo "$@" echo "$1" cd then
+		$(pwd) readonly | then awk ${HOME} --verbose readonly /usr/bin
+$(pwd) sed sed readonly awk "$@" /usr/bin printf grep awk export
+	awk "$1" test awk cd 'quoted text' test test $(pwd)
+	local done readonly &&
+"$1" -eu grep "$@" done test sed awk && 2>/dev/null local local | cd echo
+	x=1 readonly awk -eu sed grep readonly | echo readonly
+-eu "$@" | "$@" grep
+		"$@" | export && test /usr/bin
+		sed 'quoted text' local test readonly
+		grep test ${HOME} && -eu && readonly -eu echo then
+		readonly x=1 x=1 /usr/bin && done export local
+		--verbose awk readonly 2>/dev/null 'quoted text' 'quoted text' x=1 /usr/bin
+"$1" done then "$1" grep | /usr/bin local x=1 done x=1 cd -eu
+printf then export grep
+	&& export then printf /usr/bin
+		2>/dev/null ${HOME} 'quoted text'
+	printf cd grep | $(pwd) echo export
+	cd --verbose cd /usr/bin cd test "$1" awk
+		&& echo sed readonly "$@" $(pwd) export
+'quoted text' x=1 sed grep grep && awk local done --verbose
+-eu --verbose x=1 x=1 && grep
+grep grep printf /usr/bin $(pwd) ${HOME} done readonly
+	then sed x=1 $(pwd) then /usr/bin 'quoted text' printf awk local echo ${HOME}
+		readonly ${HOME} -eu awk |
+		done /usr/bin "$@" /usr/bin 'quoted text' ${HOME} echo 2>/dev/null grep then
+	| && -eu "$@" awk 2>/dev/null awk 2>/dev/null -eu 2>/dev/null echo /usr/bin
+		&& && 'quoted text' "$@" sed ${HOME} cd "$@" -eu export
+		${HOME} "$1" | sed local test awk grep sed "$@" ${HOME} ${HOME}
+-eu /usr/bin ${HOME} readonly ${HOME}
+&& awk 'quoted text' sed readonly test | echo
+	awk test then $(pwd) export
+grep readonly cd -eu test "$1" "$1" && ${HOME} -eu sed
+	test | done sed local local sed 'quoted text'
+local printf test export $(pwd) $(pwd) "$@" readonly 'quoted text'
+	'quoted text' sed "$@" local $(pwd) && /usr/bin -eu $(pwd) local echo
+	local readonly test then $(pwd) export local /usr/bin awk /usr/bin
+	cd x=1 test echo grep --verbose printf /usr/bin 'quoted text' export
+done echo $(pwd) $(pwd) x=1 -eu /usr/bin cd /usr/bin /usr/bin --verbose
+		local ${HOME} ${HOME} --verbose echo printf awk x=1 printf cd test
+	cd readonly cd && x=1 export -eu then sed ${HOME} printf -eu -eu x=1 readonly
+	-eu test ${HOME} readonly "$1" && | -eu --verbose && && "$1" awk
+		printf grep sed readonly /usr/bin
+		$(pwd) && "$@" test /usr/bin 2>/dev/null then cd then -eu
+	${HOME} ${HOME} "$1" export && "$@" && done && export 'quoted text' ${HOME} -eu
+	${HOME} echo printf /usr/bin awk x=1
+cd export --verbose | 2>/dev/null "$@" done local
+'quoted text' readonly cd sed printf --verbose
+	printf $(pwd) local grep "$@" /usr/bin
+	awk 'quoted text' 2>/dev/null /usr/bin x=1 local | local | test export -eu test
+		export -eu echo readonly "$@" grep -eu x=1
+'quoted text' x=1 local sed grep x=1 "$@" sed echo 2>/dev/null done
+		then cd test "$1" then done -eu sed | "$1"
+echo | --verbose 2>/dev/null grep -eu 'quoted text' -eu done sed printf
+		"$@" done "$@" grep "$@" export
+	then awk test grep -eu -eu cd readonly ${HOME}
+	"$@" printf "$@" echo export awk -eu /usr/bin test local x=1 grep
+		then ${HOME} x=1 then test sed "$@" --verbose
+export 2>/dev/null x=1 echo $(pwd) "$1"
+test /usr/bin ${HOME} done "$1" && local && ${HOME} awk && /usr/bin awk && ${HOME}
+		'quoted text' export local
+"$@" --verbose then -eu cd cd then
+echo --verbose "$@" printf done 'quoted text' readonly
+sed cd ${HOME} printf export "$@" local cd local --verbose
+done -eu x=1 echo sed -eu ${HOME}
+		sed | cd done local 'quoted text' printf sed 'quoted text'
+		"$1" /usr/bin echo ${HOME} "$1" "$1" /usr/bin export 'quoted text'
+		sed 'quoted text' export "$1"
+	"$1" x=1 "$1" x=1 2>/dev/null | export cd "$@"
+awk && x=1 cd "$@" x=1 local 2>/dev/null
+	2>/dev/null /usr/bin | /usr/bin sed
+x=1 sed 'quoted text' test awk export
+	&& x=1 2>/dev/null "$@" /usr/bin
+		x=1 echo 'quoted text' grep ${HOME}
+	echo awk then readonly ${HOME} --verbose sed 2>/dev/null
+| cd /usr/bin sed grep -eu x=1 readonly export "$@" 'quoted text'
+		echo grep grep then grep sed sed then sed test sed cd
+		${HOME} -eu --verbose "$1" grep x=1 local awk "$1" ${HOME} export /usr/bin
+	then && 2>/dev/null "$1" 'quoted text' done /usr/bin test test readonly "$1" 2>/dev/null
+export then --verbose | | then ${HOME} "$@" -eu then
+	local 'quoted text' "$@" export printf -eu "$@" sed -eu cd
+| && && "$1" && cd test then -eu readonly 2>/dev/null --verbose readonly
+"$1" 'quoted text' "$@" done && --verbose cd | -eu ${HOME}
+		printf 'quoted text' readonly echo /usr/bin $(pwd) awk test ${HOME}
+--verbose awk cd readonly -eu -eu "$@" x=1 echo then cd local test done
+	cd readonly cd test local ${HOME}
+	${HOME} && test "$1" ${HOME} echo
+		-eu -eu grep readonly awk done awk /usr/bin export -eu
+	readonly test printf x=1 then 2>/dev/null
+done $(pwd) export local awk cd
+done echo x=1 $(pwd) /usr/bin export 'quoted text'
+then && && export "$1" /usr/bin 'quoted text' "$@" awk ${HOME} readonly
+readonly test then readonly
+readonly awk then sed export test grep printf "$1" readonly readonly 2>/dev/null
+		echo | local -eu --verbose -eu ${HOME}
+export 2>/dev/null done grep then -eu done "$@" readonly export x=1 /usr/bin
+	cd then printf | x=1 /usr/bin
+	${HOME} printf local then printf awk done -eu readonly /usr/bin
+awk grep "$1" cd done export && /usr/bin awk sed /usr/bin cd "$1" then grep
+then "$1" export 'quoted text' 'quoted text' 'quoted text' awk
+readonly | grep export readonly local printf readonly then
+	readonly then awk cd awk && --verbose /usr/bin then sed
+		echo && 'quoted text' then export export $(pwd) sed readonly -eu
+readonly readonly "$1" 2>/dev/null local -eu local
+		cd $(pwd) done local
+"$1" sed x=1 awk printf cd 'quoted text'
+	'quoted text' /usr/bin printf ${HOME} /usr/bin
+	-eu cd sed $(pwd) $(pwd) awk echo ${HOME} local echo then x=1 ${HOME} -eu
+	'quoted text' cd 2>/dev/null
+		${HOME} awk export | awk /usr/bin awk --verbose 'quoted text'
+	x=1 done "$@" test then echo | then && /usr/bin ${HOME} 2>/dev/null
+	sed grep | x=1 local echo /usr/bin grep ${HOME}
+	'quoted text' cd "$1" sed
+$(pwd) $(pwd) test /usr/bin test
+		"$@" "$@" && 'quoted text' 'quoted text' printf -eu ${HOME} cd echo
+test | && grep x=1 2>/dev/null readonly printf awk x=1 export echo done export
+done 'quoted text' grep printf grep sed printf 'quoted text'
+		readonly echo readonly && echo printf x=1 readonly
+	${HOME} readonly export grep 2>/dev/null x=1 "$1"
+	done | && && sed -eu export && ${HOME} readonly ${HOME} local 2>/dev/null
+		${HOME} $(pwd) grep sed | /usr/bin readonly "$1"
+	sed test $(pwd) && | ${HOME} then done /usr/bin "$1" readonly echo grep x=1
+--verbose test && echo && && export && 'quoted text' export cd sed test
+		| printf x=1 'quoted text' then local | 'quoted text' then "$1" cd 2>/dev/null
+	$(pwd) local local test -eu x=1
+-eu "$1" x=1 | then export
+	echo local -eu ${HOME} 'quoted text' local
+$(pwd) local --verbose local printf printf
+	sed /usr/bin | test -eu $(pwd) then grep "$1" 'quoted text'
+/usr/bin "$@" test done awk /usr/bin "$1" /usr/bin $(pwd) -eu
+		$(pwd) | readonly | --verbose && cd 2>/dev/null awk awk -eu
+	--verbose x=1 printf
+grep echo done then done -eu "$@" "$1" echo cd 2>/dev/null
+	readonly ${HOME} readonly $(pwd) --verbose local /usr/bin test && done
+		"$1" $(pwd) echo then export x=1 x=1 --verbose
+		grep /usr/bin --verbose test x=1 | ${HOME} then export && 2>/dev/null printf test
+		"$@" "$1" /usr/bin printf then /usr/bin local /usr/bin --verbose
+	2>/dev/null test awk awk
+		awk sed $(pwd) "$@" sed x=1 -eu && sed printf then 'quoted text'
+		'quoted text' | grep 2>/dev/null 'quoted text' x=1 test ${HOME}
+test "$@" done done /usr/bin echo && sed x=1 "$@" /usr/bin --verbose --verbose
+	-eu sed test test echo --verbose done awk
+then $(pwd) /usr/bin && x=1 readonly
+		test $(pwd) cd export 'quoted text' --verbose 2>/dev/null "$@" test
+awk --verbose sed /usr/bin /usr/bin
+		--verbose ${HOME} test awk "$1" -eu cd then then $(pwd) 'quoted text'
+		x=1 readonly | | readonly sed 2>/dev/null printf readonly sed echo local grep
+export printf local | 2>/dev/null -eu | then cd awk 'quoted text'
+/usr/bin test test "$@" | "$@" -eu
+	'quoted text' | "$@" ${HOME}
+"$1" echo | | then 2>/dev/null local ${HOME} cd cd x=1 -eu
+	awk 'quoted text' grep echo ${HOME} test
+		/usr/bin 'quoted text' test 2>/dev/null printf x=1
+		grep grep 'quoted text' x=1 | done done -eu sed awk |
+	"$1" printf ${HOME} ${HOME} echo ${HOME} local "$@" | /usr/bin
+		awk printf 2>/dev/null --verbose cd x=1 ${HOME} | test readonly
+		readonly --verbose done
+done x=1 echo awk /usr/bin
+		printf | "$@" && cd awk && cd /usr/bin printf test export && 2>/dev/null
+		/usr/bin --verbose done "$1" x=1 readonly cd readonly ${HOME} done
+$(pwd) && ${HOME} $(pwd) local ${HOME} awk sed --verbose -eu -eu then
+		--verbose sed /usr/bin echo 'quoted text' test local
+${HOME} "$@" export --verbose 2>/dev/null
+then -eu "$@" done test cd 2>/dev/null --verbose
+		"$@" export readonly readonly export x=1
+cd ${HOME} -eu local -eu | ${HOME}
+${HOME} 'quoted text' test | export
+	export test 'quoted text' sed cd export readonly echo 2>/dev/null export && $(pwd)
+	then /usr/bin local then awk cd 2>/dev/null
+	done awk 'quoted text' "$1" x=1 awk x=1
+	echo sed && /usr/bin /usr/bin 2>/dev/null | "$@" $(pwd) /usr/bin -eu "$@"
+		grep --verbose echo ${HOME} local done done export sed
+	$(pwd) grep then cd --verbose "$1" $(pwd) /usr/bin readonly local "$1" sed ${HOME}
+	${HOME} "$@" sed export cd --verbose 'quoted text' awk -eu
+		grep grep sed cd 2>/dev/null x=1 test -eu then
+		readonly done $(pwd) done ${HOME} done
+	| ${HOME} 2>/dev/null 'quoted text' && readonly printf
+	2>/dev/null cd awk "$1" /usr/bin printf && grep --verbose
+	-eu "$@" "$@" then | then then sed local
+x=1 $(pwd) --verbose ${HOME} done 2>/dev/null 2>/dev/null then
+local printf local printf -eu ${HOME} "$@" 'quoted text'
+		&& export printf /usr/bin "$1" test
+		| 'quoted text' $(pwd) ${HOME}
+	then -eu local echo cd done 'quoted text'
+| sed ${HOME} export $(pwd) "$@" x=1 grep /usr/bin --verbose local
+		local /usr/bin grep export "$1" /usr/bin local
+&& 'quoted text' export printf test "$@" echo done then test $(pwd) grep
+	2>/dev/null -eu x=1 $(pwd) && && /usr/bin printf && 'quoted text' printf "$1"
+		${HOME} echo echo printf
+		local /usr/bin "$1" ${HOME} x=1 cd echo 'quoted text' cd
+		cd 2>/dev/null printf done && $(pwd) then 'quoted text' "$@" done 2>/dev/null
+	"$1" x=1 x=1 export /usr/bin -eu 'quoted text'
+"$1" $(pwd) -eu echo x=1 echo && 2>/dev/null 2>/dev/null && && 'quoted text'
+&& ${HOME} && printf cd done | cd && --verbose done x=1 local -eu
+-eu ${HOME} && then echo
+	"$@" sed && x=1 2>/dev/null $(pwd) local && && --verbose
+	awk echo && 2>/dev/null /usr/bin readonly | "$@" 2>/dev/null
+	"$@" sed local && "$@" awk -eu | done -eu test --verbose
+	sed | && done "$@" test
+	printf 'quoted text'
+	$(pwd) local 'quoted text' "$@" echo cd then done /usr/bin
+then printf 'quoted text' x=1 /usr/bin --verbose awk export
+		$(pwd) cd ${HOME} 'quoted text' "$@" x=1 readonly | readonly
+		test awk test then done cd "$1" $(pwd)
+	printf 'quoted text' readonly | "$@" /usr/bin /usr/bin
+	local "$@" "$@" echo echo grep cd && 2>/dev/null
+		&& /usr/bin then x=1 --verbose echo $(pwd) --verbose test grep 'quoted text'
+	-eu $(pwd) ${HOME} then then "$1" --verbose sed x=1 /usr/bin ${HOME} "$1" local
+		"$1" readonly x=1 "$@" -eu export && then
+		"$1" && grep --verbose x=1 export ${HOME} sed sed 2>/dev/null
+		x=1 2>/dev/null cd $(pwd) 'quoted text' "$@" ${HOME} awk local readonly
+cd done cd test 'quoted text' 2>/dev/null
+done "$1" "$@" echo awk done then 2>/dev/null ${HOME}
+"$1" then grep x=1 readonly printf cd |
+		awk $(pwd) "$1" -eu /usr/bin
+	grep /usr/bin "$@" && then $(pwd) "$@"
+	grep then local "$@" printf then 2>/dev/null
+		done x=1 printf $(pwd) then printf done x=1 | grep test readonly
+	local | 'quoted text' $(pwd) readonly 'quoted text' awk --verbose
+		export echo "$1" local | 'quoted text'
+		2>/dev/null 2>/dev/null then test "$@" awk
+test x=1 awk local awk awk printf echo then then 'quoted text' done -eu
+		export /usr/bin cd 'quoted text' "$1" /usr/bin
+	then cd --verbose 'quoted text' local $(pwd) done cd && done "$1" -eu
+	--verbose echo ${HOME} --verbose cd && "$@" local --verbose x=1 then --verbose
+		2>/dev/null 2>/dev/null test 2>/dev/null --verbose
+	readonly | | local echo ${HOME} ${HOME} /usr/bin /usr/bin /usr/bin -eu grep
+cd local cd && test 2>/dev/null
+		x=1 && $(pwd) /usr/bin -eu "$@"
+		-eu then 'quoted text' && sed grep sed test cd x=1 /usr/bin
+test --verbose -eu echo printf awk sed test local "$1" /usr/bin test 'quoted text'
+"$@" readonly ${HOME} | x=1 cd
+		x=1 echo then $(pwd) x=1 awk local local test done export awk sed readonly && ${HOME}
+"$@" export grep sed then
+		sed grep x=1 'quoted text' ${HOME} echo "$1" | --verbose echo $(pwd)
+"$1" "$1" then $(pwd) "$@" "$1" sed export
+export export cd grep readonly grep test sed 'quoted text' done
+&& sed done --verbose $(pwd) awk
+grep readonly "$@" | /usr/bin awk local export readonly printf awk then awk
+		| test "$1" 2>/dev/null
+	test test done printf "$1" ${HOME}
+2>/dev/null ${HOME} then | /usr/bin
+echo x=1 "$1" ${HOME} && /usr/bin
+		export 2>/dev/null 2>/dev/null readonly /usr/bin done sed ${HOME} /usr/bin awk
+&& --verbose grep "$1" 2>/dev/null test x=1 "$1" && && --verbose grep
+		then local printf $(pwd) "$1" | ${HOME} cd awk $(pwd) -eu cd
+		echo /usr/bin /usr/bin -eu then local && | then "$@" "$@"
+		&& local printf printf 'quoted text' x=1 cd -eu 2>/dev/null
+sed | sed "$1" printf $(pwd)
+		echo awk awk $(pwd) -eu export grep
+		-eu export -eu done &&
+		x=1 sed readonly x=1 printf x=1 sed echo $(pwd) /usr/bin "$1"
+		export printf export printf -eu cd -eu printf /usr/bin "$1" test export --verbose
+		done -eu "$@" printf && x=1 readonly 2>/dev/null /usr/bin
+	echo printf then done -eu 'quoted text' | 'quoted text' awk
+		readonly local --verbose 'quoted text'
+		done && local readonly grep -eu grep "$@" --verbose -eu done then --verbose
+		awk export sed ${HOME} sed $(pwd)
+		export echo -eu done readonly --verbose x=1 echo 'quoted text' "$1" done
+		grep cd ${HOME} awk "$@" done /usr/bin
+		x=1 x=1 && local 'quoted text' then test $(pwd) | done readonly
+then --verbose sed -eu /usr/bin printf ${HOME} done ${HOME} ${HOME} ${HOME}
+local "$@" -eu | ${HOME} "$1" | -eu awk cd grep 2>/dev/null cd ${HOME} grep
+		test test x=1 -eu "$@" cd export "$@" printf
+	/usr/bin ${HOME} grep "$1" $(pwd) &&
+	grep "$1" $(pwd) 'quoted text' readonly
+	&& --verbose 'quoted text' 'quoted text' 2>/dev/null cd readonly
+		awk $(pwd) echo test local --verbose $(pwd) "$@" 'quoted text'
+"$1" cd "$@" sed | printf "$1" | cd --verbose done "$@" grep echo done 'quoted text'
+		$(pwd) ${HOME} awk "$1" done local
+		"$@" "$@" "$@" export 'quoted text'
+readonly 'quoted text' local x=1 /usr/bin printf then "$@" then
+2>/dev/null x=1 && "$@" grep awk sed cd echo "$@" $(pwd) done
+		awk 2>/dev/null -eu then printf test x=1 then --verbose grep ${HOME} "$@" x=1
+	| x=1 && readonly printf 2>/dev/null cd ${HOME} grep 2>/dev/null echo
+	$(pwd) echo $(pwd) 2>/dev/null
+		-eu test local then printf "$1" $(pwd) then local | echo cd cd /usr/bin
+		$(pwd) readonly x=1 | echo 'quoted text' "$1" 2>/dev/null -eu | --verbose
+		$(pwd) readonly test x=1 echo --verbose awk cd test cd test local /usr/bin
+		export cd grep test ${HOME} echo awk $(pwd) echo 'quoted text'
+		local local -eu /usr/bin done "$@" done -eu cd ${HOME}
+readonly sed test cd readonly "$@" 'quoted text'
+-eu done grep cd 2>/dev/null 2>/dev/null "$1" grep echo 2>/dev/null export | x=1
+		test printf 2>/dev/null | "$@" "$1" 'quoted text'
+		/usr/bin --verbose ${HOME} awk test "$1" grep &&
+		grep readonly local echo 2>/dev/null 'quoted text'
+done grep printf grep --verbose | -eu "$@" --verbose --verbose
+printf local printf echo "$1"
+		${HOME} sed -eu && x=1 $(pwd) "$1" cd echo awk sed readonly
+${HOME} awk sed | "$@" 2>/dev/null
+export | "$1" then local && readonly printf | cd /usr/bin
+		then sed && "$1" "$1" awk echo cd $(pwd) then "$@" grep
+	test test echo x=1 echo && test export x=1 "$@" "$@" ${HOME} grep
+	printf "$@" echo --verbose done local cd printf --verbose "$@" then done ${HOME}
+	printf printf "$1" grep "$@"
+	local sed readonly "$1" "$1" "$@" "$1" export then
+		printf then then awk x=1 /usr/bin 2>/dev/null "$@"
+		'quoted text' echo "$@" cd printf
+	| then sed ${HOME} 'quoted text'
+awk "$1" sed -eu awk "$@" /usr/bin printf && "$@" echo echo 'quoted text'
+&& 'quoted text' | $(pwd) grep awk ${HOME} done done
+$(pwd) -eu export then 2>/dev/null sed -eu "$1" grep printf x=1
+	${HOME} | done local -eu done "$1" sed
+	"$@" $(pwd) done ${HOME} 'quoted text' local
+		$(pwd) 'quoted text' readonly then -eu /usr/bin x=1 awk -eu -eu x=1 'quoted text'
+sed grep "$@" sed done x=1 "$@"
+sed then sed $(pwd) printf "$1" -eu /usr/bin $(pwd) -eu then $(pwd)
+echo | && 2>/dev/null --verbose grep
+	test ${HOME} "$@" test $(pwd) grep printf
+$(pwd) --verbose 'quoted text' readonly sed $(pwd) echo -eu export echo --verbose
+echo $(pwd) grep done $(pwd) 'quoted text' $(pwd) test then grep
+		&& x=1 2>/dev/null | "$@" readonly done sed
+		done then test grep /usr/bin -eu local
+		--verbose printf then readonly export printf export
+	"$1" 2>/dev/null /usr/bin then 'quoted text'
+--verbose ${HOME} sed | sed awk --verbose sed x=1 /usr/bin ${HOME}
+		$(pwd) test ${HOME} $(pwd) awk
+		echo local --verbose -eu && $(pwd) 'quoted text' "$1" echo 2>/dev/null done grep
+		"$@" cd "$1" /usr/bin echo local awk && -eu $(pwd) readonly test grep && then
+echo | | --verbose readonly echo ${HOME}
+readonly done && export printf /usr/bin $(pwd) | -eu readonly test
+/usr/bin ${HOME} | cd | -eu awk test awk -eu /usr/bin && then
+	readonly sed then grep 2>/dev/null then
+sed -eu sed "$1" test -eu awk -eu readonly
+sed echo -eu awk done -eu echo /usr/bin 2>/dev/null cd export | printf
+	readonly "$1" sed /usr/bin export x=1 $(pwd)
+	cd "$@" x=1 $(pwd) cd awk /usr/bin then export && x=1
+	done "$1" -eu "$@" 'quoted text' sed ${HOME} -eu readonly && echo -eu awk
+	"$@" echo 'quoted text' -eu /usr/bin grep awk ${HOME} export --verbose grep
+/usr/bin -eu grep 'quoted text' export
+	then echo && grep "$1" local then
+"$@" && 'quoted text' export 'quoted text' local "$@" sed printf
+${HOME} "$@" $(pwd) x=1 /usr/bin "$1" local "$1" "$@" done
+	export 'quoted text' --verbose
+		grep awk ${HOME} $(pwd) $(pwd) "$1" x=1 && $(pwd) -eu $(pwd)
+		sed export readonly export export grep local
+${HOME} "$@" awk | -eu "$1" $(pwd) x=1 --verbose
+		${HOME} printf --verbose
+	then --verbose test && $(pwd) then done ${HOME} ${HOME} cd |
+		export ${HOME} -eu echo -eu grep ${HOME} ${HOME} ${HOME} 'quoted text'
+local $(pwd) 'quoted text' printf
+done --verbose && 2>/dev/null 2>/dev/null done readonly
+	--verbose echo sed 'quoted text' sed awk $(pwd) sed awk cd "$@" sed x=1 |
+		${HOME} grep /usr/bin /usr/bin --verbose export
+		&& readonly | then cd readonly export && && local readonly "$1" grep ${HOME}
+	'quoted text' sed "$@" | 2>/dev/null local
+	done cd -eu local export export "$@"
+	then "$@" sed "$1" --verbose export
+cd 2>/dev/null -eu -eu
+| then -eu echo --verbose "$@" $(pwd)
+		test && local ${HOME} "$1" echo then x=1 -eu test awk --verbose done grep
+'quoted text' local 'quoted text' && readonly /usr/bin echo printf local
+&& echo export /usr/bin
+grep --verbose "$1" | 2>/dev/null local then 2>/dev/null test
+	${HOME} awk && -eu 'quoted text' awk $(pwd) 'quoted text' -eu cd awk 'quoted text'
+	done cd local x=1 done && $(pwd) test /usr/bin sed done
+		test echo /usr/bin sed readonly readonly 2>/dev/null export
+		x=1 export done grep test
+	x=1 'quoted text' --verbose $(pwd) "$1" /usr/bin awk 'quoted text'
+		-eu 2>/dev/null readonly 2>/dev/null readonly x=1 readonly --verbose printf &&
+done grep --verbose /usr/bin grep "$@" grep $(pwd) then 2>/dev/null $(pwd) cd
+2>/dev/null awk 'quoted text' 2>/dev/null 2>/dev/null
+		echo --verbose --verbose sed printf printf "$1" local --verbose | x=1 done readonly
+		-eu echo "$@" ${HOME} readonly $(pwd) printf "$@" "$@" sed --verbose export "$1"
+		then "$1" | --verbose --verbose "$1" then then awk "$1" sed local 2>/dev/null
+	cd printf "$@" 2>/dev/null printf then printf grep /usr/bin printf local
+	then local export 2>/dev/null sed then x=1 | export 2>/dev/null
+		printf --verbose "$@" -eu cd -eu local done 2>/dev/null printf done 'quoted text'
+		2>/dev/null 'quoted text' x=1 printf 2>/dev/null
+		$(pwd) local printf export "$@" -eu printf
+		sed 'quoted text' 2>/dev/null
+-eu -eu readonly echo "$@" echo export readonly done "$1" "$1" export ${HOME}
+		/usr/bin sed 2>/dev/null done
+local done export done sed readonly --verbose
+cd grep "$1" then sed "$1" 'quoted text' awk printf test cd && "$1"
+sed x=1 | $(pwd) printf 'quoted text'
+		/usr/bin then awk 2>/dev/null test printf $(pwd) ${HOME} awk
+	| sed echo export 'quoted text'
+		x=1 readonly "$1" 2>/dev/null export done "$1" ${HOME} && cd awk
+		test local 'quoted text' awk local /usr/bin 2>/dev/null
+	readonly cd export export awk grep
+export export "$1" $(pwd) grep
+		| | 2>/dev/null | 'quoted text' grep
+echo "$1" 2>/dev/null then "$@" && test done "$1" echo readonly 2>/dev/null
+		readonly 'quoted text' grep then "$@" test
+		| done --verbose test test "$@" | "$@" && test then cd then
+		"$@" done readonly "$@" x=1 'quoted text' sed test sed echo sed then
+$(pwd) x=1 done "$@" /usr/bin
+		then --verbose local echo echo awk 2>/dev/null $(pwd) -eu done x=1 cd
+		${HOME} done sed 'quoted text' awk export test sed readonly 2>/dev/null "$@" --verbose
+	&& then export 2>/dev/null readonly 'quoted text' && awk -eu -eu --verbose
+	done sed export echo cd local $(pwd)
+export grep | printf | 2>/dev/null
+/usr/bin sed x=1 awk 2>/dev/null
+		sed 2>/dev/null 2>/dev/null --verbose
+		'quoted text' export "$1" test done 2>/dev/null echo /usr/bin export test
+		"$1" 'quoted text' /usr/bin && local $(pwd) && readonly x=1
+	/usr/bin "$1" test readonly
+		| test /usr/bin export x=1 then local echo ${HOME}
+		local --verbose x=1 export then /usr/bin x=1 ${HOME}
+		local echo /usr/bin local
+		then echo awk export /usr/bin
+		done "$@" "$1" "$1" then
+${HOME} && readonly readonly | sed sed
+	sed local export readonly local awk -eu cd export 2>/dev/null
+	/usr/bin export | export then test 'quoted text' export readonly -eu
+	${HOME} cd "$@" "$@" readonly 'quoted text' -eu 'quoted text' 'quoted text' /usr/bin
+		echo /usr/bin "$@" done -eu ${HOME}
+		'quoted text' echo printf $(pwd) "$1" "$1" export cd "$@" /usr/bin echo | --verbose
+		readonly awk echo printf x=1 done
+	grep x=1 "$@" export 2>/dev/null export sed echo -eu awk echo /usr/bin
+2>/dev/null readonly test x=1 'quoted text'
+		-eu | | printf echo sed sed printf local x=1 test "$@" then -eu 'quoted text'
+		| local "$1" && 'quoted text' | awk 'quoted text' local | -eu &&
+cd echo export x=1 && cd grep cd ${HOME} export sed 2>/dev/null
+	grep | | "$1" then echo done && awk
+		/usr/bin | export x=1 --verbose -eu x=1 "$@" "$1" echo local ${HOME} awk x=1 printf
+		&& x=1 done -eu 2>/dev/null printf
+		local 2>/dev/null readonly x=1 /usr/bin "$1" export "$1" echo
+2>/dev/null x=1 -eu test /usr/bin
+	readonly "$@" -eu 2>/dev/null sed &&
+local export 2>/dev/null 2>/dev/null test printf export grep
+		export grep /usr/bin then "$@" 2>/dev/null sed then cd 'quoted text'
+	test | done --verbose sed --verbose sed $(pwd) echo awk -eu test "$1"
+		x=1 printf 2>/dev/null then readonly
+		then -eu ${HOME} readonly echo printf
+		"$1" grep x=1 readonly 2>/dev/null /usr/bin grep awk export cd test -eu
+grep x=1 grep $(pwd) && done
+	sed 2>/dev/null local printf printf echo
+	grep local printf /usr/bin export printf awk "$@" /usr/bin printf done cd /usr/bin
+	then ${HOME} ${HOME} sed then grep printf --verbose
+	printf $(pwd) 2>/dev/null test $(pwd) -eu readonly
+$(pwd) ${HOME} ${HOME} && echo cd cd
+"$1" grep x=1 2>/dev/null awk 'quoted text' --verbose
+	echo | done then ${HOME} -eu awk readonly printf x=1 awk done $(pwd)
+local awk && -eu | grep "$1" ${HOME} test echo local sed done
+&& "$@" | then "$1" test -eu cd then echo
+"$@" | sed && --verbose | test -eu
+		--verbose --verbose --verbose then
+	| "$1" | 'quoted text' then /usr/bin -eu
+	--verbose grep grep "$@" ${HOME}
+	grep 2>/dev/null sed echo cd 'quoted text' /usr/bin readonly
+		/usr/bin ${HOME} cd grep grep
+		-eu printf sed $(pwd) x=1 2>/dev/null readonly
+/usr/bin awk echo local && "$1" $(pwd) /usr/bin export x=1 done ${HOME} -eu
+	echo test export "$1" grep /usr/bin --verbose && readonly awk x=1 | --verbose
+	-eu export done 'quoted text' awk
+local --verbose awk x=1 && x=1 -eu 'quoted text' -eu | cd x=1
+	| 2>/dev/null && sed local x=1 cd -eu then then test && local && x=1
+		"$1" | sed "$@" test sed && echo cd /usr/bin "$@" cd test "$1" printf
+&& /usr/bin echo local grep 2>/dev/null done "$1" done local grep 2>/dev/null
+		${HOME} "$@" done test local | grep echo cd &&
+		test readonly grep printf sed x=1 grep cd ${HOME}
+	--verbose sed "$1" readonly sed
+		echo --verbose awk awk 2>/dev/null echo printf cd test 2>/dev/null
+		local $(pwd) --verbose $(pwd) test local test 'quoted text' sed /usr/bin
+		local export sed 'quoted text' then printf
+2>/dev/null local sed done
+	--verbose --verbose ${HOME} sed printf cd sed | "$1"
+echo sed test $(pwd) test export 'quoted text'
+		&& awk sed awk 2>/dev/null /usr/bin ${HOME}
+${HOME} local printf ${HOME} awk 'quoted text' --verbose
+	'quoted text' echo sed
+sed grep done 'quoted text' $(pwd) grep 'quoted text' $(pwd) ${HOME}
+	then -eu | done readonly
+2>/dev/null then done grep sed then $(pwd) done test
+	--verbose && 'quoted text' ${HOME} 'quoted text' /usr/bin
+		"$1" "$1" cd readonly "$1" sed then x=1 "$@" 'quoted text'
+	/usr/bin sed echo then test 2>/dev/null export
+		x=1 && 2>/dev/null export cd
+	echo test -eu $(pwd) /usr/bin $(pwd) then
+"$@" x=1 "$@" /usr/bin grep echo /usr/bin
+	export "$1" then grep local 2>/dev/null
+printf -eu 2>/dev/null "$1" && done 2>/dev/null cd ${HOME} echo cd printf
+grep /usr/bin ${HOME} cd local cd printf
+		-eu 2>/dev/null printf readonly
+then $(pwd) done done printf x=1 sed done
+		awk --verbose done 'quoted text'
+sed awk echo "$@" grep cd readonly sed ${HOME} printf &&
+	cd --verbose $(pwd) $(pwd) echo /usr/bin grep grep local local "$1" --verbose
+		local $(pwd) $(pwd) grep && x=1 |
+cd "$1" ${HOME} 'quoted text' /usr/bin export printf then "$@" 'quoted text'
+		test echo echo printf && --verbose /usr/bin "$@" --verbose && "$1" ${HOME}
+	readonly 'quoted text' -eu
+	done && -eu | grep test awk readonly x=1 printf 2>/dev/null export sed test -eu
+readonly 'quoted text' local awk printf readonly && echo $(pwd) x=1 test 'quoted text'
+	-eu 'quoted text' | readonly
+	| x=1 2>/dev/null | "$1" local local
+		${HOME} grep grep cd /usr/bin 2>/dev/null export echo $(pwd)
+	grep sed sed then grep --verbose "$1" /usr/bin then x=1 then 'quoted text' 'quoted text'
+printf && export -eu $(pwd) printf 'quoted text' 'quoted text' readonly
+		| cd "$1" sed 'quoted text' "$@" ${HOME} 2>/dev/null x=1 awk grep
+		-eu export done x=1 export awk -eu $(pwd) done sed then $(pwd)
+	--verbose readonly export cd "$1" awk
+done -eu awk x=1 test $(pwd) then awk -eu sed
+	sed printf echo then -eu 2>/dev/null x=1 "$@"
+&& cd && "$1" export local && 2>/dev/null "$@" readonly awk ${HOME} x=1 sed
+		| $(pwd) 2>/dev/null | x=1
+	| then local 2>/dev/null x=1 $(pwd) /usr/bin 'quoted text' /usr/bin
+| export grep x=1 && printf sed -eu "$1" then cd
+	echo /usr/bin | awk | ${HOME} grep grep
+	/usr/bin $(pwd) echo then test ${HOME} test | cd "$1" -eu 2>/dev/null
+		local x=1 && 'quoted text' echo echo "$@" printf "$1" readonly "$1"
+	done 2>/dev/null /usr/bin ${HOME} then | grep awk export awk && 'quoted text' 'quoted text'
+done $(pwd) sed 'quoted text' ${HOME} /usr/bin printf "$1" 'quoted text'
+	readonly -eu echo readonly then
+--verbose 2>/dev/null export x=1 test --verbose $(pwd) readonly export
+		'quoted text' ${HOME} "$1"
+2>/dev/null printf readonly --verbose 'quoted text' sed --verbose test -eu local
+		--verbose then printf | printf "$@" export grep
+	echo grep "$@" | /usr/bin export -eu test ${HOME} local -eu /usr/bin -eu test
+"$1" -eu "$1" --verbose | test echo awk /usr/bin done 'quoted text'
+/usr/bin grep 'quoted text'
+	printf sed grep printf &&
+export then awk local 'quoted text' readonly
+'quoted text' test done "$@" grep grep ${HOME}
+	export 'quoted text' "$@" echo 2>/dev/null ${HOME} readonly
+| readonly echo 2>/dev/null sed 2>/dev/null printf sed 'quoted text' printf readonly
+		export 2>/dev/null then readonly readonly test --verbose readonly
+		$(pwd) cd sed export ${HOME} --verbose "$1" /usr/bin test && local
+		test ${HOME} awk 'quoted text' sed printf echo | 'quoted text'
+	readonly /usr/bin test readonly cd done
+	sed -eu "$@" $(pwd) --verbose -eu grep "$@" -eu --verbose x=1 'quoted text'
+test then $(pwd) | && /usr/bin printf "$@" /usr/bin done --verbose grep
+	then echo then /usr/bin -eu
+	echo cd printf && then -eu done local
+	--verbose $(pwd) | /usr/bin local
+	2>/dev/null && done then local
+grep export ${HOME} printf then "$1" ${HOME} test awk readonly
+	readonly x=1 awk -eu
+	"$1" test cd grep --verbose "$1" -eu $(pwd) && cd x=1 --verbose && done echo readonly
+		readonly export "$@" echo test /usr/bin x=1 test test
+printf then cd then test echo
+awk then $(pwd) x=1 echo sed local then grep $(pwd) "$@" cd "$1" awk
+	test && $(pwd) readonly --verbose test done test test && "$@"
+2>/dev/null x=1 2>/dev/null then cd /usr/bin done "$1"
+		/usr/bin 'quoted text' x=1 "$1" test
+sed readonly $(pwd) cd /usr/bin "$1" sed | /usr/bin printf 'quoted text'
+	done 'quoted text' export 'quoted text' "$@"
+done x=1 /usr/bin && then export x=1 "$@" "$1" cd | then grep export --verbose
+/usr/bin ${HOME} then 'quoted text' export x=1 && test sed echo "$1" awk
+	awk && test ${HOME} -eu test "$@" readonly ${HOME} export "$1" $(pwd) readonly
+2>/dev/null readonly test cd sed then
+		"$@" printf -eu 'quoted text' 2>/dev/null "$@"
+	--verbose printf cd echo "$1" "$1" done 2>/dev/null -eu "$1" $(pwd) then cd
+		| cd done done 'quoted text' cd cd | readonly && 'quoted text'
+		grep /usr/bin x=1 sed x=1 $(pwd) x=1 && grep
+	printf cd readonly "$@" --verbose "$1"
+local printf x=1 grep then cd test cd 'quoted text'
+		local /usr/bin grep &&
+	--verbose --verbose test 'quoted text' x=1 printf awk sed | export
+	then && local local --verbose 'quoted text' sed echo export 2>/dev/null
+	x=1 $(pwd) printf | export && --verbose
+-eu cd awk echo 'quoted text' then local 2>/dev/null
+--verbose x=1 sed ${HOME} --verbose ${HOME} -eu then
+	--verbose awk "$1" sed "$1"
+	then x=1 printf "$@" --verbose
+--verbose local cd export then /usr/bin
+	/usr/bin ${HOME} x=1
+	--verbose && 'quoted text' 2>/dev/null
+sed "$1" test | /usr/bin then then /usr/bin ${HOME}
+&& then | done awk --verbose sed then x=1 local local "$@" x=1
+		export && grep export echo && 2>/dev/null awk awk
+	test grep ${HOME} printf 'quoted text' 'quoted text'
+sed $(pwd) readonly x=1 sed grep
+	"$1" done awk readonly echo /usr/bin $(pwd) 'quoted text'
+	--verbose 'quoted text' "$1" --verbose local /usr/bin
+		'quoted text' "$1" "$@" "$1" ${HOME} -eu 'quoted text'
+export grep local then 'quoted text'
+		sed export $(pwd) && "$1" $(pwd) export cd echo | $(pwd) printf /usr/bin
+	awk local readonly ${HOME} ${HOME} cd export
+		printf "$1" x=1 'quoted text' $(pwd) && "$@" 'quoted text' cd export
+-eu 'quoted text' echo /usr/bin /usr/bin echo sed "$1" cd export
+| --verbose "$1" "$1" sed done local test --verbose printf test sed
+	x=1 local then echo $(pwd)
+grep sed --verbose echo | done x=1 sed echo 'quoted text' printf
+	| "$@" "$1" grep grep $(pwd) -eu $(pwd)
+	/usr/bin printf readonly awk test printf -eu /usr/bin then $(pwd)
+	test ${HOME} grep "$@" export && -eu readonly then echo cd done
+&& && ${HOME} sed awk test "$@" "$1"
+	${HOME} 'quoted text' printf "$@" local "$@" test readonly export | sed test
+"$@" awk && printf echo
+		--verbose "$@" then && /usr/bin echo 2>/dev/null
+		export --verbose "$@" && --verbose
+	test x=1 then | sed && -eu x=1 cd printf export then sed echo test test x=1 'quoted text'
+	cd grep ${HOME} ${HOME} test cd echo done grep local sed
+		echo "$1" "$1" sed | $(pwd) 2>/dev/null
+x=1 "$1" 'quoted text' test done /usr/bin echo printf ${HOME}
+printf | 'quoted text' done sed then grep 2>/dev/null "$1"
+x=1 awk grep printf -eu -eu
+export awk done "$1" printf && printf "$@" $(pwd)
+awk --verbose 'quoted text' x=1 echo "$@" x=1 done
+	cd $(pwd) grep ${HOME} "$1" x=1 test ${HOME} sed -eu
+		x=1 "$1" then awk /usr/bin
+local then done done done local -eu local then x=1 grep test
+awk "$@" sed echo echo test x=1 ${HOME} | x=1 sed done 'quoted text'
+2>/dev/null then cd grep /usr/bin test ${HOME} readonly ${HOME}
+		"$@" | x=1 --verbose echo
+	done --verbose /usr/bin "$@" 'quoted text' "$@" 'quoted text' cd then "$@"
+grep /usr/bin export 2>/dev/null done readonly readonly
+x=1 --verbose 'quoted text' done 2>/dev/null ${HOME} "$1" "$1" then done grep cd
+	$(pwd) "$@" sed readonly done ${HOME}
+/usr/bin "$1" local printf done /usr/bin && cd then -eu readonly -eu
+		then "$@" --verbose 2>/dev/null echo done printf | then ${HOME} x=1
+		/usr/bin 2>/dev/null 'quoted text' 'quoted text' printf
+	&& readonly x=1 --verbose
+	'quoted text' readonly sed 2>/dev/null grep | cd cd export "$@"
+		$(pwd) grep 2>/dev/null --verbose x=1 -eu sed local local echo | "$@" "$@" done
+		sed "$@" export cd ${HOME} printf
+printf grep | /usr/bin "$1" test "$@" | grep $(pwd) /usr/bin
+		cd then done readonly cd -eu --verbose readonly echo ${HOME} "$1" -eu echo /usr/bin
+		cd done readonly local local awk 2>/dev/null readonly local /usr/bin ${HOME}
+	readonly grep then grep export && 2>/dev/null /usr/bin 2>/dev/null -eu sed $(pwd)
+| -eu x=1 x=1 --verbose sed && export sed local
+	local $(pwd) | printf |
+		local test ${HOME} && $(pwd)
+${HOME} grep -eu /usr/bin /usr/bin awk export
+	grep -eu echo 2>/dev/null readonly
+&& x=1 readonly grep echo -eu sed test 'quoted text'
+export && export ${HOME} "$@" test done 'quoted text' grep awk
+		then awk then then | local
+&& readonly x=1 cd grep echo 2>/dev/null cd 2>/dev/null "$@" done awk then printf
+	| "$@" then export 'quoted text'
+	export ${HOME} "$1" then echo
+readonly 'quoted text' readonly printf awk /usr/bin
+	${HOME} readonly x=1 then grep
+	printf sed test then then 'quoted text' --verbose grep
+		export "$1" x=1 "$@" -eu -eu "$1"
+grep "$@" then 2>/dev/null cd | awk --verbose
+	| | 2>/dev/null "$1" then | --verbose cd then grep
+${HOME} awk done $(pwd) | /usr/bin ${HOME} ${HOME} | 2>/dev/null then grep
+test grep sed --verbose x=1 x=1 cd echo -eu && echo done "$1" && local
+	$(pwd) /usr/bin export 2>/dev/null ${HOME}
+x=1 -eu then /usr/bin --verbose "$@" then awk export
+	"$@" test printf printf printf then
+	x=1 "$1" export $(pwd) "$1" $(pwd) | "$@" readonly grep cd --verbose 'quoted text'
+export /usr/bin echo done awk
+	grep awk $(pwd) "$1" x=1 /usr/bin
+"$1" "$@" local then "$1" test $(pwd) 2>/dev/null export
+		${HOME} && -eu && | ${HOME} --verbose then ${HOME} x=1 then "$@"
+	&& -eu --verbose && sed then echo
+		"$@" then grep sed && readonly && -eu printf done readonly export | ${HOME}
+	test 'quoted text' "$@" /usr/bin
+		$(pwd) awk export "$1" done test && "$1" then "$@" echo local
+		"$@" cd readonly done 'quoted text'
+		then 'quoted text' "$@" printf "$1" 2>/dev/null
+		-eu 2>/dev/null export /usr/bin then local
+test x=1 $(pwd) --verbose echo then
+	echo x=1 sed 'quoted text' $(pwd) export then local awk export local awk done
+readonly /usr/bin /usr/bin x=1 printf
+	then test | printf printf awk printf -eu 2>/dev/null 2>/dev/null
+grep readonly printf "$1" printf
+sed /usr/bin --verbose /usr/bin 2>/dev/null done local | test --verbose printf
+		local awk "$@" cd local -eu x=1 "$@" --verbose | printf ${HOME} | | --verbose
+	grep done awk printf awk done done grep
+printf x=1 done awk printf readonly && ${HOME} /usr/bin | grep "$1" "$1"
+sed local sed then && test
+		cd --verbose test grep -eu test $(pwd) | 'quoted text' $(pwd) readonly 'quoted text'
+	printf printf "$1" echo
+		| 2>/dev/null export -eu awk 2>/dev/null /usr/bin
+'quoted text' 'quoted text' ${HOME} local printf awk sed echo "$1" test
+		x=1 /usr/bin printf && --verbose export local
+	-eu ${HOME} && test -eu cd -eu local
+readonly cd -eu sed "$1" 'quoted text' local
+grep ${HOME} test then --verbose
+		done readonly x=1 ${HOME} echo --verbose
+	$(pwd) then x=1 readonly ${HOME} ${HOME} then done "$1" --verbose
+--verbose "$@" local
+	grep printf echo $(pwd) export /usr/bin | echo awk $(pwd) grep
+	local done 2>/dev/null export "$1" --verbose
+	grep test "$1" local | "$1" echo local grep --verbose then cd
+local 2>/dev/null --verbose readonly done grep
+		readonly 'quoted text' -eu 2>/dev/null grep "$1" 2>/dev/null 2>/dev/null
+&& 2>/dev/null readonly local grep awk "$1" && "$1" x=1 then echo done test
+	test awk && 'quoted text' && "$@" readonly $(pwd) |
+		/usr/bin --verbose printf $(pwd) ${HOME}
+		echo test 'quoted text' $(pwd) done $(pwd)
+		then 2>/dev/null sed cd && -eu 2>/dev/null --verbose -eu $(pwd) x=1
+		$(pwd) /usr/bin printf then grep
+		x=1 echo --verbose local x=1 cd printf
+	printf test $(pwd) $(pwd) /usr/bin echo echo -eu 'quoted text'
+awk readonly readonly --verbose "$1" -eu
+		awk readonly local echo 2>/dev/null "$1" --verbose export cd && $(pwd) "$@" $(pwd)
+	"$@" "$1" sed grep readonly | sed $(pwd)
+	done && && then $(pwd) export grep test
+| sed awk 2>/dev/null /usr/bin 2>/dev/null /usr/bin export 'quoted text'
+sed grep | done "$1" printf export export x=1
+	done /usr/bin "$1" export awk ${HOME} 'quoted text'
+	'quoted text' export /usr/bin
+	x=1 readonly readonly test
+export /usr/bin /usr/bin grep x=1 echo grep && "$@" "$@" | "$@"
+	x=1 2>/dev/null 2>/dev/null x=1 done
+/usr/bin grep x=1 /usr/bin --verbose local local
+	x=1 export "$1" done "$1" "$1" 'quoted text'
+		"$1" ${HOME} local done cd sed export ${HOME}
+		echo x=1 readonly local 2>/dev/null | test
+	grep 'quoted text' sed awk sed test cd "$1" x=1 grep done echo cd
+$(pwd) test 'quoted text' /usr/bin /usr/bin /usr/bin | -eu
+sed sed awk readonly echo "$1" 2>/dev/null export -eu | "$1"
+		awk | $(pwd) grep 2>/dev/null 2>/dev/null awk 'quoted text' $(pwd)
+	echo echo "$@" cd then | "$1" -eu && /usr/bin grep 2>/dev/null echo echo then
+		/usr/bin sed cd x=1 local printf
+	"$1" 'quoted text' 'quoted text' local $(pwd) echo ${HOME} sed ${HOME}
+	| 2>/dev/null "$1" 'quoted text' 'quoted text' readonly
+	printf ${HOME} -eu 'quoted text' "$@" | $(pwd) cd "$1"
+	${HOME} /usr/bin export ${HOME} then done local $(pwd) --verbose echo readonly
+	test readonly printf | sed echo cd "$1" local
+test done awk $(pwd) /usr/bin "$1" "$@" | "$1"
+readonly local readonly readonly readonly readonly sed 2>/dev/null printf
+	"$1" readonly -eu x=1 grep cd --verbose echo test 2>/dev/null
+		done done -eu 'quoted text' export export echo
+export $(pwd) awk x=1 -eu local done test ${HOME} && 2>/dev/null --verbose
+		2>/dev/null local "$@" echo then -eu readonly
+		"$@" readonly sed 'quoted text' && ${HOME} 2>/dev/null "$1"
+${HOME} local then x=1 | ${HOME} printf /usr/bin && local
+	grep awk $(pwd) awk grep test cd
+$(pwd) "$1" x=1 --verbose
+sed -eu cd then sed local echo && x=1 'quoted text' export -eu sed "$1" grep
+	${HOME} $(pwd) -eu $(pwd) readonly /usr/bin /usr/bin -eu /usr/bin
+cd | x=1 'quoted text' ${HOME} ${HOME} -eu awk && then grep then local
+	&& test | export echo readonly $(pwd) 2>/dev/null readonly export
+"$@" 2>/dev/null grep printf 'quoted text' 2>/dev/null grep &&
+		awk ${HOME} echo echo then -eu 'quoted text'
+	-eu done local $(pwd)
+	"$@" printf ${HOME} printf $(pwd) "$@" && && echo awk --verbose
+		echo then 2>/dev/null export /usr/bin sed echo readonly done && test
+		echo cd "$1" x=1 cd done
+grep --verbose grep grep readonly export /usr/bin test
+test /usr/bin "$1" ${HOME} readonly then
+	local export printf echo cd grep && awk test echo then done readonly
+test done 'quoted text' cd grep done 'quoted text'
+local sed 'quoted text' --verbose printf
+		test printf | printf test printf
+	$(pwd) | test grep 'quoted text' 2>/dev/null printf test ${HOME} local
+		x=1 -eu -eu export awk grep local readonly printf /usr/bin then then 'quoted text'
+		x=1 && awk --verbose 'quoted text' $(pwd) awk | grep local /usr/bin
+grep $(pwd) sed -eu 2>/dev/null x=1 'quoted text' --verbose /usr/bin /usr/bin
+		grep printf then ${HOME} echo sed
+echo sed && ${HOME} echo
+export ${HOME} readonly echo /usr/bin then "$@" $(pwd) printf local done 'quoted text'
+		x=1 local 'quoted text' $(pwd)
+		-eu /usr/bin readonly readonly printf "$@" 'quoted text' "$@"
+${HOME} 2>/dev/null cd export && | /usr/bin ${HOME} && --verbose then -eu ${HOME}
+test "$1" then /usr/bin test "$1" x=1 readonly "$@" readonly && $(pwd)
+-eu 'quoted text' test cd
+&& readonly echo done printf
+&& 2>/dev/null "$@" awk "$@" test x=1 x=1 'quoted text' 2>/dev/null grep $(pwd)
+	2>/dev/null ${HOME} readonly /usr/bin "$@" test 'quoted text' "$1" done
+		printf grep && then "$@" | echo export 'quoted text' x=1 && grep
+	echo --verbose sed --verbose -eu test sed grep echo done ${HOME} cd
+		"$@" $(pwd) --verbose printf printf -eu grep then cd awk && -eu
+	2>/dev/null && then 'quoted text' sed echo readonly "$1"
+		echo $(pwd) 'quoted text' "$@" local && x=1 sed sed "$@"
+		-eu --verbose echo then sed --verbose /usr/bin 2>/dev/null
+sed readonly | readonly | "$1" 2>/dev/null local
+	"$1" export 'quoted text' "$1" && 'quoted text' echo | 2>/dev/null
+	awk "$@" echo test then then echo 'quoted text' sed export -eu
+'quoted text' echo then 'quoted text' 2>/dev/null && | export local ${HOME}
+	test && $(pwd) "$@" sed sed
+		awk then ${HOME} printf test && --verbose export local "$1" export
+		done $(pwd) done test $(pwd) awk /usr/bin printf
+		done "$1" --verbose test echo $(pwd) $(pwd) x=1 local awk export "$@" 2>/dev/null
+		then "$1" cd -eu grep
+		${HOME} export done export cd export "$@" local readonly then $(pwd)
+		&& printf local "$@" "$1"
+echo awk done sed x=1 ${HOME} x=1 &&
+awk grep /usr/bin && local $(pwd)
+		"$@" sed "$@" awk grep sed sed printf
+/usr/bin "$1" awk --verbose
+		"$@" printf x=1 grep export test $(pwd) awk ${HOME} $(pwd)
+-eu test cd echo && "$@" cd readonly "$@" ${HOME} $(pwd)
+2>/dev/null -eu local
+		export 'quoted text' -eu export sed x=1
+		$(pwd) 2>/dev/null $(pwd) test --verbose echo
+		local "$@" sed export 2>/dev/null 2>/dev/null ${HOME} readonly --verbose
+		export echo | grep printf /usr/bin sed then --verbose export
+		--verbose printf "$@" export "$1" x=1
+	printf readonly sed readonly awk done && "$@" cd test "$@" -eu x=1 echo
+&& --verbose echo | grep "$1" -eu readonly then 2>/dev/null
+	2>/dev/null readonly printf done awk x=1 cd -eu local | printf readonly
+done grep sed /usr/bin /usr/bin
+		cd sed 'quoted text' | | test readonly
+2>/dev/null grep ${HOME} -eu && test | test -eu readonly
+	--verbose cd x=1 /usr/bin
+		test -eu local 2>/dev/null echo -eu cd then printf grep sed --verbose ${HOME}
+		awk then -eu then | readonly awk --verbose then export ${HOME}
+	readonly awk 'quoted text' /usr/bin --verbose readonly export export done sed
+then "$@" $(pwd) $(pwd) /usr/bin
+	awk done $(pwd) "$@" local
+	-eu && then then export export /usr/bin x=1 "$1" |
+		'quoted text' local test --verbose --verbose awk
+	test 2>/dev/null "$@" test x=1 && printf
+	local done sed then -eu $(pwd) grep then -eu local x=1 test grep -eu local
+		x=1 "$1" cd | printf echo $(pwd) then readonly
+"$@" done test test "$1" /usr/bin
+	x=1 test | awk $(pwd) export && cd cd $(pwd) x=1 && "$@"
+	"$1" sed "$1" "$@" printf grep cd 2>/dev/null local cd awk
+	&& $(pwd) echo then "$@" x=1 -eu 'quoted text' "$@" ${HOME} done
+		echo "$@" readonly --verbose /usr/bin 'quoted text' | &&
+sed "$@" $(pwd) $(pwd) /usr/bin "$1" | local && done "$1" then
+	${HOME} grep ${HOME} | --verbose readonly 'quoted text'
+		"$@" done sed grep readonly test ${HOME} awk echo ${HOME} -eu 'quoted text'
+readonly 'quoted text' $(pwd)
+&& sed grep $(pwd) sed sed -eu done $(pwd) --verbose -eu && test export
+"$1" done test -eu 'quoted text' local echo done && && && sed $(pwd) && export -eu
+local 'quoted text' printf then export
+	grep /usr/bin printf local "$1" done local && echo --verbose
+		'quoted text' 'quoted text' x=1 'quoted text' echo grep test 2>/dev/null
+export cd cd /usr/bin /usr/bin sed $(pwd) | "$1" "$@"
+		${HOME} echo awk done test && x=1 test done
+	&& printf x=1 --verbose test 2>/dev/null printf
+		"$1" 2>/dev/null /usr/bin test echo 2>/dev/null -eu export "$@" "$1" local
+/usr/bin --verbose export then | local done
+		&& "$@" export ${HOME} export done then 2>/dev/null ${HOME}
+	printf then sed test /usr/bin 'quoted text' "$1" sed
+		--verbose 2>/dev/null sed awk --verbose x=1
+		"$1" test 'quoted text' cd && && && "$1" /usr/bin readonly done
+--verbose printf 'quoted text'
+		"$@" then export local $(pwd) readonly && test --verbose
+		'quoted text' grep echo
+	x=1 ${HOME} readonly ${HOME} 'quoted text' -eu "$@" /usr/bin printf
+	'quoted text' x=1 $(pwd) 'quoted text'
+		awk local ${HOME} local printf ${HOME} "$1" test $(pwd)
+	$(pwd) 2>/dev/null printf -eu readonly /usr/bin $(pwd) && echo printf
+done grep readonly awk && printf ${HOME}
+echo 'quoted text' awk 2>/dev/null
+	$(pwd) 'quoted text' cd echo --verbose printf printf 2>/dev/null
+	/usr/bin x=1 test cd | echo | "$1" then export ${HOME} grep x=1
+	$(pwd) readonly /usr/bin
+	x=1 x=1 | "$@" cd "$1" readonly local -eu export readonly x=1 ${HOME} $(pwd)
+		"$1" "$@" done | "$1" 'quoted text' $(pwd) --verbose done x=1 test
+then "$1" test then awk export printf 2>/dev/null sed 'quoted text' readonly cd
+		"$1" readonly --verbose then "$1" export grep echo ${HOME}
+		sed x=1 done --verbose sed x=1
+export local "$1" x=1 /usr/bin readonly
+--verbose local 2>/dev/null grep printf -eu local
+		${HOME} awk "$@" -eu cd "$1"
+	sed 2>/dev/null "$1" "$@" $(pwd) then grep
+	echo | readonly && --verbose | 'quoted text'
+		printf grep echo x=1 'quoted text' | --verbose
+		2>/dev/null then awk local done cd /usr/bin
+		"$@" done readonly grep then /usr/bin local
+		done 2>/dev/null 2>/dev/null
+${HOME} "$1" x=1 grep "$1" "$1" grep
+-eu $(pwd) done "$@" "$@" ${HOME}
+		readonly 'quoted text' sed export cd && $(pwd) 2>/dev/null done
+		then "$1" export /usr/bin then
+grep readonly printf $(pwd) --verbose ${HOME} /usr/bin
+	done then echo test sed readonly
+	${HOME} echo grep then "$@" -eu "$@" -eu /usr/bin printf
+	export --verbose export && "$1" done test
+		export export ${HOME} --verbose "$1" readonly
+		cd 2>/dev/null 'quoted text' -eu
+		local export local echo "$@" ${HOME} printf echo -eu 'quoted text' echo
+		2>/dev/null 'quoted text' test
+done local cd echo test then | $(pwd) local readonly done | "$1" readonly && awk
+x=1 $(pwd) && sed sed grep cd 2>/dev/null test --verbose
+	'quoted text' then --verbose x=1 then cd 2>/dev/null
+echo /usr/bin "$1" readonly printf
+/usr/bin readonly /usr/bin ${HOME}
+		cd 'quoted text' "$@" readonly echo sed ${HOME}
+echo echo 'quoted text' | local /usr/bin local sed &&
+	awk export cd test --verbose sed then -eu then grep
+		| local 2>/dev/null $(pwd) printf $(pwd) local "$1" $(pwd) then $(pwd)
+$(pwd) && grep -eu --verbose printf ${HOME} test -eu local readonly
+${HOME} 'quoted text'
+	${HOME} local done printf -eu printf x=1 test done awk export && awk done
+		| readonly ${HOME} grep awk x=1 grep | then then readonly "$1"
+	${HOME} sed done cd && readonly then 2>/dev/null
+"$@" --verbose && && grep | sed 2>/dev/null
+		'quoted text' -eu "$@" /usr/bin
+		--verbose /usr/bin test --verbose grep local awk 2>/dev/null
+		cd /usr/bin "$1" test cd --verbose "$@" echo && grep local local --verbose
+	sed then grep then /usr/bin cd export | test x=1 x=1 && 'quoted text' done $(pwd)
+		"$1" readonly --verbose x=1 &&
+		"$@" local export ${HOME}
+then $(pwd) 2>/dev/null echo echo export printf | | -eu grep awk awk "$@"
+	$(pwd) 'quoted text' test grep cd then /usr/bin export grep export ${HOME}
+	test echo ${HOME} printf --verbose cd awk done cd && /usr/bin $(pwd)
+echo ${HOME} cd $(pwd) x=1 "$1" ${HOME} && export test
+cd $(pwd) $(pwd) 2>/dev/null cd echo --verbose "$1" --verbose "$@"
+"$1" -eu && && ${HOME} test then readonly awk awk
+	${HOME} local "$@" "$@" sed test export sed export --verbose "$1" printf
+printf && x=1 -eu printf printf | sed
+		echo then awk awk echo $(pwd) $(pwd) | $(pwd) ${HOME} "$1" -eu echo readonly
+		-eu cd echo done sed local -eu test 'quoted text' $(pwd)
+"$1" --verbose /usr/bin -eu | readonly 'quoted text' printf
+	"$1" -eu local cd readonly cd 2>/dev/null readonly ${HOME} "$1" --verbose 'quoted text'
+	export /usr/bin printf sed "$1" /usr/bin
+	grep done echo done && --verbose export | ${HOME} echo grep "$1"
+	| && done ${HOME} $(pwd) then && -eu done test grep -eu x=1 grep
+	readonly | local done awk ${HOME} local readonly
+"$@" -eu test then 2>/dev/null then echo test awk
+		readonly awk local printf -eu $(pwd) /usr/bin readonly 'quoted text'
+	-eu then -eu -eu | awk test sed -eu cd x=1 'quoted text' $(pwd) grep
+		"$1" /usr/bin x=1 export $(pwd) --verbose /usr/bin 'quoted text' "$@" readonly
+readonly /usr/bin "$1" | grep sed
+	cd && export 2>/dev/null |
+sed 2>/dev/null then ${HOME} cd "$1" "$1" awk | -eu
+		&& cd readonly /usr/bin readonly
+	export /usr/bin export local printf "$@" printf cd 2>/dev/null
+	local /usr/bin | "$1" && echo grep awk "$@" "$@" then && readonly
+	x=1 "$1" ${HOME} readonly test sed "$1" | grep
+sed then sed cd printf "$1" export && && printf && export grep sed -eu readonly
+local test "$@" $(pwd) && export awk /usr/bin --verbose
+		grep && --verbose cd done "$1" test awk "$@" echo local local local 2>/dev/null
+export $(pwd) && "$1" printf then done | $(pwd) grep export
+readonly grep cd printf /usr/bin && local export "$1" 2>/dev/null echo
+	test readonly "$@" cd local "$@" export grep sed grep done echo echo readonly
+		export "$1" grep cd 'quoted text' export
+	local --verbose --verbose done export awk export awk 2>/dev/null --verbose
+2>/dev/null --verbose && /usr/bin awk --verbose ${HOME} local printf
+	'quoted text' $(pwd) "$1" cd x=1
+	"$@" readonly && --verbose | grep && then test && -eu local printf "$1" sed
+		| done --verbose grep cd
+	${HOME} x=1 then then test x=1 $(pwd) 2>/dev/null
+		cd done then "$1" cd sed 2>/dev/null
+	$(pwd) /usr/bin 2>/dev/null grep awk grep $(pwd) cd echo local $(pwd)
+	$(pwd) printf export 'quoted text' && cd readonly export test printf awk export
+| "$@" 2>/dev/null cd export /usr/bin then readonly then sed
+'quoted text' /usr/bin $(pwd) --verbose $(pwd) "$1" && grep test
+-eu x=1 -eu awk local 2>/dev/null ${HOME} export test -eu echo test readonly
+grep -eu /usr/bin -eu cd awk printf 'quoted text'
+then | readonly /usr/bin
+		2>/dev/null echo ${HOME} test test
+		/usr/bin "$1" readonly 'quoted text' done -eu readonly $(pwd) cd && test
+echo ${HOME} --verbose "$@" /usr/bin ${HOME} export | | | 'quoted text'
+		/usr/bin readonly then test && /usr/bin
+		| awk ${HOME} echo --verbose
+		then done sed "$1" | local $(pwd) && printf 2>/dev/null x=1 sed --verbose
+		x=1 x=1 local then --verbose ${HOME} "$1" done readonly local
+x=1 -eu sed ${HOME} then ${HOME} echo x=1
+		local "$@" /usr/bin awk echo awk --verbose printf printf grep 2>/dev/null
+		'quoted text' then "$@" sed sed 'quoted text'
+		test 'quoted text' export 2>/dev/null echo $(pwd) export then ${HOME} then
+		done 'quoted text' sed && echo | 'quoted text' 2>/dev/null
+		printf echo $(pwd) readonly readonly test
+sed "$1" 2>/dev/null done cd printf && "$1"
+		"$1" $(pwd) --verbose x=1 x=1 sed "$1" x=1 cd && /usr/bin ${HOME} test |
+		echo printf ${HOME} | done 'quoted text' 2>/dev/null
+		&& test local x=1 sed export export sed $(pwd) && grep
+x=1 echo -eu "$1" readonly -eu
+sed echo -eu 'quoted text' cd ${HOME} grep awk export grep $(pwd) "$1"
+$(pwd) echo export /usr/bin printf then sed --verbose
+'quoted text' awk readonly export test
+cd test -eu x=1 x=1 ${HOME} /usr/bin
+		readonly 'quoted text' /usr/bin -eu /usr/bin export | then
+		-eu /usr/bin && done grep then 'quoted text' printf
+		sed sed 'quoted text' printf test
+		cd --verbose "$@" test then done awk awk "$@" local done
+		/usr/bin /usr/bin x=1 export done done 'quoted text' && then
+printf "$@" cd then awk "$1"
+	sed local local -eu printf sed readonly
+		grep awk | ${HOME} grep awk x=1 | cd done export echo readonly
+		--verbose awk cd test printf then echo then printf /usr/bin /usr/bin
+${HOME} awk cd | 2>/dev/null $(pwd) 'quoted text' then printf
+$(pwd) ${HOME} 'quoted text' ${HOME} 2>/dev/null -eu
+		echo then readonly $(pwd)
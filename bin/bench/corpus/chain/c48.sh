@@ -0,0 +1,2001 @@
+		grep then 2>/dev/null printf awk local x=1 --verbose
+	done | "$@" "$1" "$@" && /usr/bin local done && 2>/dev/null $(pwd)
+'quoted text' | sed $(pwd) x=1 cd cd printf
+		$(pwd) | local printf printf
+'quoted text' echo $(pwd) 2>/dev/null sed 2>/dev/null done test
+		done test x=1 ${HOME} && && "$1" -eu "$@" /usr/bin export readonly
+	readonly "$@" printf local $(pwd) cd cd
+printf cd 'quoted text' grep && readonly 'quoted text' done
+awk readonly local "$1" then readonly awk grep -eu
+		&& local awk "$@" done awk --verbose 2>/dev/null
+	-eu x=1 'quoted text' x=1 ${HOME} "$1" test then then -eu readonly x=1 x=1 awk
+		done grep grep "$@" "$@" export
+	${HOME} --verbose | sed $(pwd) && echo ${HOME} grep
+		2>/dev/null echo | done grep sed sed cd && cd -eu
+		awk printf "$1" ${HOME} ${HOME} export --verbose local $(pwd) test done
+		${HOME} export sed --verbose | "$@" then export -eu done cd | local 2>/dev/null
+awk printf awk 2>/dev/null awk /usr/bin
+cd test -eu /usr/bin 'quoted text' ${HOME}
+	export echo ${HOME} test export cd ${HOME} 'quoted text'
+		'quoted text' -eu --verbose local $(pwd) export done ${HOME}
+		readonly then "$@" readonly "$1" sed
+		awk | cd export ${HOME} local /usr/bin echo -eu &&
+local "$@" --verbose awk | local ${HOME} -eu ${HOME}
+	$(pwd) /usr/bin then x=1 'quoted text' export export
+awk ${HOME} "$1" sed "$1" -eu && x=1 ${HOME} "$@" $(pwd) x=1 --verbose done
+		2>/dev/null printf "$1" "$1" then "$@" "$@" 'quoted text'
+echo test printf && "$1" 2>/dev/null | cd done grep ${HOME} then 'quoted text'
+	grep x=1 "$1" -eu && awk x=1 --verbose
+	'quoted text' readonly awk export export $(pwd) ${HOME}
+	sed "$@" --verbose && x=1 awk 2>/dev/null 2>/dev/null "$1" x=1
+'quoted text' local --verbose --verbose echo then awk "$1" awk awk | echo
+cd "$1" ${HOME} "$1" sed 'quoted text' then test grep "$1" then
+	--verbose -eu | -eu && 2>/dev/null
+		grep | x=1 $(pwd) done --verbose grep x=1 /usr/bin
+	grep then -eu awk -eu &&
+local readonly ${HOME} ${HOME} grep 'quoted text' -eu /usr/bin
+	then echo readonly cd -eu test
+	echo 2>/dev/null 2>/dev/null then "$1" --verbose 2>/dev/null
+		-eu printf export export then /usr/bin $(pwd) && done awk cd --verbose | awk
+		cd "$1" 2>/dev/null cd -eu local echo x=1 cd ${HOME} sed grep | grep | done
+grep 'quoted text' awk /usr/bin x=1 printf test --verbose grep 2>/dev/null sed
+		cd | "$1" export then 'quoted text' test 'quoted text'
+	awk echo cd x=1 echo && local local export
+		cd awk printf -eu done readonly && x=1 echo --verbose 'quoted text'
+echo printf "$@" $(pwd) awk export then
+${HOME} echo --verbose cd
+		$(pwd) 'quoted text' -eu printf | x=1 grep -eu x=1
+test sed done --verbose echo awk | "$@" && export
+	| "$1" awk test printf && awk -eu 2>/dev/null readonly test test x=1 sed
+	--verbose | /usr/bin 'quoted text' -eu grep export /usr/bin x=1 $(pwd) cd "$@"
+	test | cd 'quoted text' /usr/bin "$@"
+	local printf $(pwd) /usr/bin "$@" grep sed
+		"$1" "$@" local x=1 && cd sed "$1" echo
+		/usr/bin grep sed grep export $(pwd) | |
+	export -eu cd readonly then $(pwd) --verbose --verbose x=1 done 'quoted text'
+	$(pwd) "$@" export readonly
+export x=1 test cd --verbose readonly "$1" then "$@" &&
+'quoted text' grep then x=1 | grep -eu && "$@" sed awk
+	grep sed "$1" awk "$@" cd local | awk cd done export /usr/bin
+cd grep x=1 2>/dev/null echo awk x=1 --verbose 2>/dev/null
+		then printf then export printf "$@"
+echo local local grep "$@" cd printf
+--verbose "$@" 'quoted text' /usr/bin
+		$(pwd) cd done 'quoted text' /usr/bin awk $(pwd) 'quoted text'
+		sed && && $(pwd) cd 2>/dev/null 'quoted text' | | test awk cd && -eu export
+		done awk x=1 printf ${HOME} done "$1" test -eu 2>/dev/null -eu grep $(pwd)
+printf | cd local test sed $(pwd) sed ${HOME} -eu ${HOME} then local
+	printf readonly && "$@" | 2>/dev/null 'quoted text' test
+"$1" /usr/bin then readonly
+	local "$@" local cd cd echo echo 'quoted text' local
+then "$1" echo "$1" x=1
+	/usr/bin readonly "$1" ${HOME} echo && export 'quoted text' &&
+	test readonly 'quoted text' done 'quoted text' printf export local
+"$@" x=1 x=1 | 2>/dev/null printf sed && cd then
+awk local x=1 awk --verbose printf cd test then "$1"
+		then && local 'quoted text'
+	-eu local /usr/bin -eu ${HOME} x=1 "$1" 2>/dev/null
+	sed x=1 'quoted text' && export then | readonly printf $(pwd) echo
+	${HOME} sed printf x=1 test /usr/bin
+		'quoted text' readonly local readonly $(pwd)
+x=1 && /usr/bin --verbose awk 2>/dev/null | echo printf grep --verbose done
+"$1" 2>/dev/null then grep "$@" x=1
+	2>/dev/null local export 'quoted text' /usr/bin sed then | done --verbose
+		/usr/bin local readonly
+	--verbose local local "$@" 2>/dev/null
+		printf cd $(pwd) | echo
+awk grep cd done 'quoted text' ${HOME} printf awk local export ${HOME}
+		$(pwd) printf "$1" readonly done done cd $(pwd)
+--verbose -eu ${HOME} test $(pwd) cd 2>/dev/null printf
+		/usr/bin test && printf grep ${HOME} cd grep local test sed local
+	awk 2>/dev/null 2>/dev/null
+		printf $(pwd) printf --verbose | done local then -eu 2>/dev/null done cd ${HOME}
+	sed ${HOME} --verbose printf awk export --verbose grep -eu printf && ${HOME}
+		2>/dev/null grep cd $(pwd) export | ${HOME} 'quoted text'
+	printf "$@" x=1 && --verbose /usr/bin readonly sed export
+		done | /usr/bin sed ${HOME} /usr/bin -eu 'quoted text' "$@" grep "$@" echo x=1
+	awk awk test | sed /usr/bin --verbose $(pwd)
+"$@" ${HOME} then done ${HOME} done "$1"
+awk | readonly "$@" 'quoted text' 2>/dev/null
+		test readonly 'quoted text' /usr/bin grep
+then 'quoted text' "$1" sed && x=1 --verbose "$1" sed grep printf
+		then "$1" then "$@" 2>/dev/null grep echo done -eu 2>/dev/null done -eu
+	&& readonly "$1" echo sed ${HOME} sed then "$@" --verbose cd
+	grep && printf grep --verbose readonly sed
+	| ${HOME} ${HOME} then
+	done "$1" --verbose sed ${HOME} cd "$1" --verbose printf awk ${HOME} local
+	echo export then readonly "$1" && 'quoted text' done export grep /usr/bin
+		"$1" "$1" awk local readonly "$1" 'quoted text' cd x=1 printf | sed local readonly
+2>/dev/null echo "$1" 'quoted text' /usr/bin then $(pwd) awk done
+readonly cd --verbose x=1 ${HOME} export && awk "$1" x=1 | grep printf grep readonly
+		$(pwd) sed -eu local 2>/dev/null sed | awk test $(pwd) | x=1 cd awk
+		"$@" awk export echo /usr/bin 'quoted text' local ${HOME} "$@"
+	| printf $(pwd) sed "$@" "$@" /usr/bin
+test x=1 echo x=1 awk --verbose --verbose
+x=1 "$@" | cd 2>/dev/null /usr/bin export sed sed
+		done --verbose done $(pwd) sed test 2>/dev/null $(pwd)
+	grep cd test --verbose then sed sed test "$@" | grep --verbose
+		export --verbose 2>/dev/null && | done export done export
+		${HOME} test "$1" sed 2>/dev/null readonly -eu test echo
+"$1" cd 2>/dev/null -eu /usr/bin grep x=1 $(pwd) readonly local "$1"
+	'quoted text' ${HOME} echo printf grep ${HOME} $(pwd) echo /usr/bin
+-eu x=1 ${HOME} grep /usr/bin "$@" then then cd done local "$@" /usr/bin
+	"$@" ${HOME} ${HOME} "$1" local printf -eu 2>/dev/null
+x=1 "$@" export echo 'quoted text' 2>/dev/null "$1" local "$@" sed 2>/dev/null
+	readonly | 'quoted text' 2>/dev/null printf
+		sed done then echo echo x=1 ${HOME} -eu grep | -eu
+then --verbose export readonly done printf sed
+awk local awk test && 2>/dev/null $(pwd)
+awk readonly /usr/bin | then $(pwd) x=1 x=1 then "$1" echo
+	readonly cd done | "$1" |
+	2>/dev/null x=1 /usr/bin --verbose then
+	"$@" | readonly "$1" 2>/dev/null x=1 test /usr/bin /usr/bin
+		awk /usr/bin test 2>/dev/null 2>/dev/null awk sed local echo local
+		"$1" grep -eu $(pwd) x=1 printf 2>/dev/null local 'quoted text'
+then test x=1 test then printf ${HOME}
+cd "$@" /usr/bin --verbose grep
+	&& readonly sed export readonly | test test awk awk "$@" echo /usr/bin
+test "$1" 2>/dev/null then 'quoted text' local ${HOME} readonly "$1" cd grep 'quoted text'
+	then --verbose echo done ${HOME} -eu done cd 'quoted text'
+	awk done cd sed 2>/dev/null --verbose printf && "$@" test $(pwd) export echo
+		awk sed test sed 2>/dev/null
+	grep 'quoted text' done test $(pwd) -eu test done -eu ${HOME}
+| done test ${HOME} local cd /usr/bin /usr/bin
+export sed sed 'quoted text' "$1"
+sed done --verbose "$@" | printf $(pwd)
+		done ${HOME} test | local $(pwd) readonly
+		done done && "$1" $(pwd) "$@" | done printf --verbose readonly x=1 $(pwd) sed
+		--verbose printf | export export 2>/dev/null awk done
+then export awk done && readonly 2>/dev/null /usr/bin readonly
+test -eu "$1" | x=1 echo done local --verbose printf "$1" done x=1 $(pwd) test
+		/usr/bin printf 'quoted text'
+$(pwd) ${HOME} 'quoted text' grep sed "$@" $(pwd) then "$1" 'quoted text'
+printf test grep readonly test "$@" export
+	'quoted text' --verbose
+	grep grep "$1" echo --verbose /usr/bin awk export | /usr/bin
+		then done -eu --verbose | sed readonly
+cd readonly readonly echo echo x=1 'quoted text' 'quoted text'
+		| local "$1" "$1" awk $(pwd) "$1" printf then /usr/bin test awk x=1 x=1
+readonly "$1" test "$@" awk echo
+		test local /usr/bin "$@"
+		/usr/bin && printf cd x=1 -eu awk
+		export $(pwd) x=1 local -eu 2>/dev/null --verbose echo
+readonly ${HOME} ${HOME} "$1"
+		'quoted text' export export | grep cd -eu /usr/bin printf
+		2>/dev/null printf readonly $(pwd) then local x=1 x=1
+		-eu grep x=1 sed -eu /usr/bin printf
+grep "$@" cd sed then sed "$1" | ${HOME} x=1 done test -eu && 'quoted text'
+	local -eu $(pwd) export /usr/bin | grep
+test ${HOME} then printf $(pwd) export test
+	local test 'quoted text' grep export grep grep -eu x=1 then "$@" 'quoted text'
+		then sed done then "$1" "$@" printf echo | ${HOME} "$1" printf
+		printf "$1" "$@" x=1 readonly local ${HOME} echo done
+	awk --verbose then 'quoted text' && echo readonly then 2>/dev/null /usr/bin
+		--verbose --verbose 'quoted text' 2>/dev/null export -eu test "$1" sed local
+		"$1" printf | then --verbose echo --verbose done && awk
+x=1 test /usr/bin 'quoted text' cd
+		grep x=1 export local --verbose done $(pwd) "$1" "$@" "$1" $(pwd) echo
+	printf "$1" test sed echo
+		--verbose export export printf "$1" /usr/bin test 'quoted text' /usr/bin
+		local --verbose echo 'quoted text' --verbose sed grep export
+		readonly /usr/bin printf | -eu /usr/bin awk 2>/dev/null done /usr/bin "$1"
+		awk ${HOME} $(pwd) test cd local $(pwd) x=1 2>/dev/null cd export
+	x=1 then test echo done test done "$1" /usr/bin
+--verbose x=1 "$1" | then "$@" local local export test test
+		-eu cd "$1" | -eu export $(pwd) x=1 export grep local
+	--verbose readonly awk cd | echo x=1 readonly
+| x=1 -eu echo echo cd cd
+		cd /usr/bin /usr/bin "$@"
+		-eu -eu local "$@" x=1 /usr/bin printf && -eu then readonly local
+		"$@" readonly x=1 /usr/bin -eu printf "$1"
+		| ${HOME} export grep
+	'quoted text' --verbose 'quoted text' | done sed test
+2>/dev/null test test echo 'quoted text' --verbose sed done "$@" then
+		${HOME} ${HOME} then printf echo 'quoted text' "$1" local export && then
+		local "$1" && export 'quoted text' printf 'quoted text'
+		echo done readonly x=1 && "$@" printf local echo
+	echo /usr/bin then --verbose 2>/dev/null ${HOME} done 2>/dev/null
+	done cd local --verbose then cd echo readonly ${HOME} then echo
+local "$@" printf 'quoted text' cd ${HOME} grep ${HOME} x=1 cd then grep
+	local x=1 2>/dev/null "$1" | "$@" /usr/bin /usr/bin printf readonly
+		readonly grep x=1 && printf && printf /usr/bin
+	cd "$1" "$@" | sed "$@"
+$(pwd) sed | test --verbose /usr/bin grep sed "$1" | printf local
+sed /usr/bin local sed "$@" readonly grep cd
+cd readonly cd cd && -eu $(pwd) awk -eu -eu && /usr/bin 2>/dev/null grep ${HOME}
+	x=1 ${HOME} test test --verbose /usr/bin echo ${HOME} test then test sed export
+echo 2>/dev/null export 2>/dev/null
+		${HOME} then "$@" test $(pwd) | 'quoted text' readonly
+'quoted text' local /usr/bin /usr/bin export readonly
+		grep grep x=1 x=1 local 'quoted text' grep "$1" --verbose
+done && ${HOME} sed x=1 export echo && /usr/bin -eu awk local readonly 'quoted text'
+export cd printf x=1 printf -eu awk export -eu 'quoted text'
+	awk grep 2>/dev/null "$1" readonly "$1" readonly --verbose cd local 'quoted text'
+	echo then --verbose export /usr/bin
+		${HOME} awk test --verbose sed export --verbose "$@" done done local x=1 then grep
+		readonly cd local done test $(pwd) test 'quoted text'
+		sed "$1" 2>/dev/null awk $(pwd) readonly --verbose "$@" |
+	done x=1 done then 'quoted text' |
+cd awk $(pwd) export export sed readonly export && readonly
+	test 'quoted text' $(pwd)
+		test && "$1" ${HOME} /usr/bin cd awk 2>/dev/null export
+		| ${HOME} local grep printf $(pwd)
+local | /usr/bin then grep printf /usr/bin $(pwd) 2>/dev/null
+"$@" then sed done readonly
+	awk cd local && cd readonly
+		grep awk 'quoted text' local /usr/bin x=1
+${HOME} | cd done 'quoted text' grep "$@" printf ${HOME} then --verbose x=1 local
+		cd export --verbose cd printf printf local then --verbose
+"$@" 'quoted text' /usr/bin x=1 2>/dev/null export grep local x=1 export printf
+${HOME} cd grep then local
+		-eu readonly | ${HOME} printf local 'quoted text'
+	test 2>/dev/null ${HOME} 2>/dev/null
+-eu cd grep grep grep echo ${HOME} "$1" sed
+		$(pwd) 2>/dev/null /usr/bin x=1 readonly awk 'quoted text' done "$1" "$1" | 2>/dev/null
+	&& sed 2>/dev/null | --verbose export awk -eu done awk 'quoted text'
+readonly "$@" /usr/bin /usr/bin local ${HOME} then | local printf 'quoted text'
+export echo awk export done echo echo $(pwd)
+		2>/dev/null readonly /usr/bin ${HOME} /usr/bin "$@" && -eu printf readonly
+awk 'quoted text' /usr/bin x=1 "$1" && awk | local "$@" awk "$@" grep x=1 printf
+		readonly grep export $(pwd) grep "$@" test /usr/bin export sed local test
+		export done -eu readonly grep done grep echo then 'quoted text' "$@" ${HOME}
+	sed && export "$@" grep /usr/bin && test "$@" awk $(pwd)
+	-eu readonly local -eu --verbose ${HOME} "$1" 'quoted text' -eu && /usr/bin
+		| test $(pwd) "$@" && cd done awk test sed -eu --verbose awk && echo echo "$@"
+		x=1 'quoted text' -eu test grep $(pwd) sed sed readonly "$1" "$1" "$@" done
+done readonly sed cd x=1 ${HOME} grep -eu echo done --verbose
+		x=1 2>/dev/null | "$@" printf x=1 cd /usr/bin cd | -eu echo /usr/bin
+	&& 2>/dev/null test cd 'quoted text'
+'quoted text' grep $(pwd) sed 'quoted text' local
+		x=1 local "$@" awk $(pwd) 2>/dev/null local -eu --verbose awk 2>/dev/null readonly
+-eu "$1" | $(pwd) local then --verbose grep export export then x=1 'quoted text'
+	'quoted text' cd done readonly echo done
+printf printf readonly
+	--verbose then /usr/bin 'quoted text' echo readonly 2>/dev/null ${HOME} done
+		test grep export x=1 grep --verbose printf sed export then grep awk echo "$1"
+		echo --verbose x=1 done && -eu then --verbose && awk grep --verbose cd printf awk
+awk readonly | x=1 cd "$1" readonly && printf "$1" export
+		x=1 readonly $(pwd) then 'quoted text' "$1" x=1 'quoted text'
+awk x=1 readonly then $(pwd) test
+	/usr/bin readonly echo cd cd 'quoted text' printf | --verbose 'quoted text' 'quoted text'
+	2>/dev/null && printf && -eu export --verbose ${HOME} then 'quoted text' ${HOME}
+		${HOME} export x=1 $(pwd) then 'quoted text'
+		grep printf test awk 'quoted text' x=1 cd test 'quoted text' ${HOME} echo
+$(pwd) readonly readonly x=1 done cd test export sed grep awk printf 2>/dev/null
+		&& test "$@" 2>/dev/null | 2>/dev/null
+	then | then "$@" printf test export then $(pwd) grep done --verbose --verbose
+	'quoted text' grep ${HOME} done 'quoted text' cd 'quoted text' --verbose
+grep $(pwd) 2>/dev/null 'quoted text'
+echo 'quoted text' then printf
+	2>/dev/null "$1" --verbose && printf
+	--verbose && /usr/bin
+		'quoted text' sed -eu /usr/bin /usr/bin sed "$1" cd awk 2>/dev/null printf cd readonly
+		"$1" done cd test | export readonly
+	2>/dev/null echo 'quoted text' $(pwd) done printf
+then /usr/bin | | printf echo sed
+&& cd "$@" /usr/bin /usr/bin /usr/bin local
+	then awk printf --verbose $(pwd) --verbose local grep
+		-eu | "$1" readonly x=1 grep awk "$1" x=1 x=1 export
+	${HOME} sed test local | readonly local cd readonly
+grep "$1" 2>/dev/null awk | then x=1 /usr/bin -eu /usr/bin
+		${HOME} then printf 2>/dev/null
+	$(pwd) cd export /usr/bin
+	"$@" /usr/bin printf && |
+		test done printf 2>/dev/null cd x=1 'quoted text' 'quoted text'
+	test $(pwd) awk $(pwd) export --verbose |
+	| "$1" "$@" ${HOME} cd grep $(pwd)
+	grep readonly ${HOME} awk echo 2>/dev/null export awk 2>/dev/null "$@" "$@"
+		awk local "$@" readonly readonly local "$@" awk printf
+"$@" && then grep 'quoted text' --verbose x=1 printf "$1"
+	done | export "$1" 2>/dev/null then
+		echo 'quoted text' /usr/bin sed 'quoted text' $(pwd) sed ${HOME} local
+	echo test "$@" --verbose /usr/bin readonly
+		${HOME} 2>/dev/null -eu local --verbose | awk
+| printf local then export test -eu "$1"
+		$(pwd) -eu awk grep awk printf /usr/bin export x=1 x=1
+| readonly echo | readonly done -eu done $(pwd) /usr/bin printf
+		echo "$1" export 'quoted text' x=1 echo x=1 --verbose 'quoted text'
+	readonly local /usr/bin readonly --verbose
+${HOME} awk printf then
+"$@" 2>/dev/null echo -eu $(pwd) cd local ${HOME}
+		echo test export && test test awk -eu -eu 'quoted text'
+echo 2>/dev/null grep awk export 'quoted text' local
+	-eu echo x=1 --verbose done cd grep "$1" | done -eu sed
+local cd --verbose test --verbose "$@" test readonly
+cd $(pwd) cd grep "$1" readonly "$1" printf export local "$1" readonly --verbose
+		readonly $(pwd) then grep x=1 "$1"
+export done export done -eu cd --verbose ${HOME} --verbose export "$@" sed
+		-eu grep ${HOME} "$@" "$1" grep awk
+		$(pwd) awk -eu sed grep
+		--verbose awk sed readonly "$1" sed echo | | then then
+	done test ${HOME} "$1" | then awk --verbose
+		local done 2>/dev/null grep test done grep local
+&& then | | "$@" 'quoted text' readonly cd sed then local readonly test export
+"$@" 2>/dev/null ${HOME} local grep 2>/dev/null local
+echo test | test --verbose x=1 'quoted text'
+	'quoted text' 2>/dev/null 2>/dev/null $(pwd) | -eu test grep
+	test -eu 'quoted text' -eu then echo 'quoted text' readonly "$@" grep export
+-eu /usr/bin && $(pwd) && grep && "$@" && awk
+'quoted text' ${HOME}
+echo /usr/bin -eu awk done /usr/bin 'quoted text' cd cd printf
+then "$@" local | "$@" export grep
+grep | --verbose 'quoted text' grep x=1 echo x=1 "$1"
+grep sed --verbose grep -eu x=1 sed printf
+	--verbose -eu "$@" 'quoted text' grep
+		awk awk test /usr/bin awk done then ${HOME}
+| 'quoted text' && $(pwd) | cd | test printf
+	'quoted text' --verbose printf awk readonly ${HOME} | then
+		| echo sed "$@" readonly done
+		readonly grep && done && done | 2>/dev/null
+"$@" | && -eu && "$@" "$@" test -eu 2>/dev/null awk awk
+${HOME} -eu printf grep sed /usr/bin "$@" | grep echo
+	--verbose -eu sed && grep &&
+x=1 printf export | readonly --verbose
+	local then sed export local x=1 export cd readonly
+		"$1" awk $(pwd) cd grep printf
+		${HOME} local /usr/bin "$1" then ${HOME} cd ${HOME} | local echo |
+		printf printf | 2>/dev/null then local cd $(pwd) local "$@" sed "$@" test grep
+		printf grep 'quoted text'
+		"$@" sed | grep echo 2>/dev/null
+| 'quoted text' /usr/bin test &&
+		then ${HOME} test && 'quoted text' 'quoted text' test done local local
+		${HOME} x=1 export cd cd /usr/bin local grep
+	readonly printf && $(pwd) | | --verbose -eu local "$1" --verbose "$@" echo export
+	echo grep 'quoted text' -eu 2>/dev/null awk local "$1"
+local echo awk && && echo -eu | /usr/bin export readonly printf readonly cd
+cd test && done printf && export export
+		&& export "$@" 2>/dev/null test | -eu --verbose "$1" "$@" 2>/dev/null
+	${HOME} "$@" then awk cd awk "$1" echo awk "$@" 2>/dev/null
+		'quoted text' && --verbose local test && readonly
+${HOME} cd test "$@" 'quoted text' cd test done /usr/bin 2>/dev/null done 2>/dev/null
+	"$@" -eu awk echo x=1 printf 2>/dev/null | printf test cd 2>/dev/null readonly
+		&& awk readonly echo $(pwd) 'quoted text'
+	&& 2>/dev/null test "$@" --verbose sed x=1 'quoted text' --verbose
+		export ${HOME} printf $(pwd) x=1 printf /usr/bin
+local echo sed cd /usr/bin ${HOME} --verbose cd "$@" "$@" then --verbose &&
+	cd sed ${HOME} done readonly echo --verbose printf printf export test
+	sed $(pwd) readonly then grep test
+"$1" "$@" readonly -eu 2>/dev/null 2>/dev/null local local echo
+grep && awk x=1 cd local grep echo "$@" "$@" local "$1" done --verbose
+test "$@" "$1" /usr/bin $(pwd) sed sed awk -eu
+grep grep -eu sed export printf "$1" printf x=1 grep -eu
+cd --verbose export --verbose $(pwd) echo
+		| test test local x=1 "$@" && "$@" -eu cd grep
+	| echo "$1" then printf cd "$1"
+		--verbose 2>/dev/null readonly test readonly grep printf echo sed 2>/dev/null
+		--verbose printf awk /usr/bin printf then x=1 2>/dev/null
+	--verbose && then sed 2>/dev/null echo --verbose
+/usr/bin sed /usr/bin grep grep
+		| $(pwd) grep awk 2>/dev/null | export x=1 printf /usr/bin sed
+echo x=1 done "$1" 'quoted text' ${HOME} ${HOME} "$1" ${HOME}
+then grep export /usr/bin test done then done 2>/dev/null
+		local then -eu readonly sed readonly
+		grep readonly /usr/bin
+	readonly $(pwd) readonly local
+		/usr/bin echo readonly 'quoted text' echo local then "$@"
+/usr/bin $(pwd) | && then -eu 2>/dev/null then $(pwd)
+	"$1" --verbose "$1" $(pwd) printf done grep test echo readonly test /usr/bin
+	then "$@" /usr/bin /usr/bin grep export printf /usr/bin x=1 awk printf 2>/dev/null
+${HOME} x=1 echo printf cd x=1 done
+	grep sed cd /usr/bin done $(pwd) echo | && x=1 ${HOME} cd awk --verbose
+	$(pwd) && --verbose then done cd ${HOME} grep printf
+	local | test x=1 "$1" "$1" printf && && readonly grep | then x=1 -eu /usr/bin
+	sed && /usr/bin | printf /usr/bin /usr/bin done grep done local awk then x=1
+	sed export grep printf
+'quoted text' test 2>/dev/null export x=1 2>/dev/null x=1 --verbose readonly
+	done $(pwd) sed "$1" /usr/bin
+	${HOME} -eu x=1 cd done cd echo "$1" grep | test readonly sed printf x=1
+		x=1 "$@" "$1" export && readonly -eu && $(pwd) done done | --verbose awk &&
+		-eu 'quoted text' | | echo | 'quoted text'
+		local $(pwd) then | printf
+		"$@" export 2>/dev/null "$@" sed test sed export printf
+$(pwd) done sed -eu -eu printf export /usr/bin awk 'quoted text' "$1" "$1" cd "$@"
+		-eu echo export test "$1" 'quoted text'
+$(pwd) awk 2>/dev/null test export echo sed /usr/bin
+echo -eu export && | export done test
+		done $(pwd) echo done done &&
+	-eu 'quoted text' ${HOME} test ${HOME} sed sed sed cd /usr/bin "$@" readonly
+	| && test export && echo
+		"$@" awk 'quoted text' /usr/bin "$@" local cd /usr/bin
+2>/dev/null printf cd awk 2>/dev/null
+| local --verbose $(pwd)
+	then then echo grep local awk /usr/bin
+2>/dev/null sed -eu test sed
+	sed awk | grep awk x=1 sed "$@" cd "$@" echo readonly readonly sed && 'quoted text'
+${HOME} echo && 'quoted text' awk 'quoted text'
+		"$@" done --verbose grep --verbose done then then cd awk local "$1" ${HOME}
+	-eu export test /usr/bin grep export $(pwd) sed grep test done awk ${HOME} readonly
+		sed export echo done 2>/dev/null sed sed && test export $(pwd) export
+		/usr/bin sed -eu --verbose
+		"$@" ${HOME} | sed "$1" export /usr/bin x=1 local --verbose ${HOME} -eu
+		"$@" $(pwd) 'quoted text' readonly awk grep "$1" readonly
+	test | awk $(pwd) 2>/dev/null "$1" 2>/dev/null readonly $(pwd) 2>/dev/null /usr/bin
+"$1" awk "$1" cd -eu 2>/dev/null
+$(pwd) $(pwd) 'quoted text'
+	export grep then -eu ${HOME} export cd cd -eu local local /usr/bin
+		export local x=1 "$@" $(pwd) echo 2>/dev/null then $(pwd) test awk &&
+	test 'quoted text' printf
+	2>/dev/null echo && "$1" done readonly 'quoted text' &&
+		"$1" sed printf export 2>/dev/null
+awk "$1" /usr/bin then "$1" awk cd cd cd echo ${HOME}
+		2>/dev/null grep $(pwd) 2>/dev/null
+	x=1 echo | /usr/bin -eu --verbose --verbose && | ${HOME}
+done /usr/bin && export -eu -eu echo |
+	--verbose ${HOME} 2>/dev/null local test test --verbose local
+	"$1" local cd | export cd awk done cd ${HOME} && ${HOME} ${HOME} then
+cd | then export "$@" cd readonly test --verbose ${HOME}
+	| test sed echo local ${HOME} readonly readonly
+x=1 "$1" && done "$@" 2>/dev/null --verbose && test ${HOME}
+-eu /usr/bin awk then --verbose then cd then done local ${HOME} $(pwd) x=1
+		then "$1" done "$1" cd test echo sed echo x=1 && x=1 test 2>/dev/null
+	sed then ${HOME} local --verbose printf readonly
+		grep && cd local x=1 cd 'quoted text' /usr/bin "$1" done
+echo "$1" readonly then test ${HOME} /usr/bin awk readonly "$@" "$@" then |
+		${HOME} echo then 'quoted text' "$1" grep && x=1 printf readonly
+	done cd --verbose test x=1 local grep done cd sed grep
+		| --verbose 2>/dev/null awk $(pwd) local 2>/dev/null local grep then
+		then x=1 local "$@" --verbose
+		$(pwd) export "$1" "$@" test $(pwd)
+| | 2>/dev/null export && cd cd $(pwd)
+		x=1 'quoted text' test x=1 printf local | sed cd 2>/dev/null
+	"$@" /usr/bin x=1 readonly then "$1" 2>/dev/null x=1 then echo -eu | 2>/dev/null
+sed done then local "$1" 'quoted text' cd ${HOME} export echo "$@" --verbose
+	x=1 "$@" export local && cd printf echo "$1"
+		| done export /usr/bin sed readonly
+		&& awk cd "$@" grep test 'quoted text' 'quoted text'
+		/usr/bin 2>/dev/null && ${HOME} printf
+	printf then echo ${HOME} echo 2>/dev/null export echo printf sed then "$@"
+		-eu ${HOME} readonly --verbose sed | $(pwd) cd export -eu sed printf grep
+	-eu 'quoted text' 'quoted text' $(pwd) test readonly echo sed
+	local 2>/dev/null ${HOME} x=1 grep 2>/dev/null test $(pwd) local then
+	--verbose --verbose then cd -eu -eu -eu export $(pwd) $(pwd) "$1" x=1
+| export sed ${HOME} awk done | && $(pwd) readonly echo
+	local $(pwd) export awk ${HOME} 'quoted text' /usr/bin
+	export then "$1" 'quoted text' x=1 readonly export
+'quoted text' sed --verbose
+		"$@" cd "$1" export "$@" export test
+	printf | "$1" "$@" --verbose "$@" "$@" done
+sed test /usr/bin --verbose then -eu && /usr/bin
+		local "$1" $(pwd) readonly "$@" grep cd -eu local "$@"
+	readonly | x=1 then done awk "$@"
+		x=1 grep ${HOME} printf cd $(pwd) then local
+sed --verbose 'quoted text' awk
+		| /usr/bin 'quoted text' "$1"
+'quoted text' grep awk 2>/dev/null "$@"
+"$1" "$1" then test x=1 "$1" local cd | $(pwd) sed
+		awk -eu && then $(pwd) $(pwd) --verbose printf
+${HOME} -eu $(pwd) sed grep 2>/dev/null
+/usr/bin ${HOME} | && "$1" readonly x=1 test x=1 awk && ${HOME} awk export
+		test "$@" 'quoted text' local --verbose $(pwd)
+		test then cd 2>/dev/null "$1" done "$@" done readonly "$@" ${HOME} --verbose
+	| 2>/dev/null awk x=1 sed -eu x=1 printf cd ${HOME} awk local test "$@" /usr/bin
+	printf printf awk 2>/dev/null "$1" | ${HOME} awk ${HOME}
+$(pwd) echo export "$@" x=1 --verbose printf readonly | awk grep awk sed
+		"$1" then x=1 "$@" | "$1" local test
+		| ${HOME} printf | export test then local echo then "$1" grep
+	${HOME} x=1 2>/dev/null 2>/dev/null -eu
+		${HOME} x=1 $(pwd) $(pwd) -eu && sed /usr/bin --verbose 'quoted text'
+done x=1 sed local test | cd
+	/usr/bin awk echo cd test awk
+	2>/dev/null /usr/bin -eu x=1 'quoted text' 'quoted text'
+x=1 local 2>/dev/null grep && cd -eu
+/usr/bin grep "$@" "$@" awk
+	grep printf test sed ${HOME}
+	'quoted text' test echo
+		'quoted text' "$@" --verbose export ${HOME} export -eu local
+	-eu 'quoted text' then done echo "$@" x=1 export "$1"
+x=1 grep -eu sed readonly export then $(pwd) 'quoted text' -eu export grep "$@"
+	--verbose local -eu export x=1 --verbose then | /usr/bin "$1" readonly
+		-eu -eu then 2>/dev/null 2>/dev/null
+	printf echo export local && 'quoted text'
+test "$@" /usr/bin awk --verbose
+	sed echo grep sed readonly "$@" awk "$@" sed test local -eu
+	printf 2>/dev/null export export then /usr/bin "$1" sed
+		echo ${HOME} | "$1" readonly --verbose 2>/dev/null | "$1"
+	x=1 x=1 sed readonly sed ${HOME} --verbose "$1" "$@"
+	$(pwd) $(pwd) done sed export readonly 'quoted text'
+done local awk | local awk /usr/bin export export $(pwd) done printf export
+-eu "$@" printf /usr/bin
+	local grep local grep && sed
+awk test --verbose echo grep readonly 'quoted text'
+		readonly then cd then "$@" x=1 test grep
+local grep ${HOME} && /usr/bin test "$1" printf -eu test ${HOME} --verbose -eu
+x=1 'quoted text' then cd sed grep $(pwd) /usr/bin readonly
+grep awk echo 'quoted text' 'quoted text'
+		done echo readonly /usr/bin ${HOME}
+test | "$@" "$@" | ${HOME} ${HOME} grep
+$(pwd) cd $(pwd) done && test export test | printf echo done
+awk cd "$1" local $(pwd) "$@" --verbose
+	${HOME} done readonly cd then
+then export 'quoted text' | export
+	2>/dev/null grep ${HOME} -eu $(pwd) "$@" done grep "$@" 2>/dev/null
+	"$@" -eu echo sed printf cd
+	&& local && done /usr/bin /usr/bin --verbose
+		readonly echo export local grep |
+| printf 2>/dev/null readonly -eu done cd /usr/bin
+then then 2>/dev/null local cd grep test test
+--verbose export ${HOME} export $(pwd) cd -eu $(pwd)
+cd | x=1 printf 2>/dev/null echo readonly
+		cd -eu "$@" ${HOME} done && -eu "$@" -eu test x=1 printf awk sed
+		printf cd grep readonly done cd test cd "$1" --verbose "$1" $(pwd)
+	done "$1" 'quoted text' readonly
+	&& | -eu then x=1 test --verbose --verbose done 2>/dev/null && then done
+2>/dev/null export awk $(pwd) done echo /usr/bin printf 'quoted text' "$@"
+2>/dev/null local "$@" sed local -eu export grep test
+	2>/dev/null sed /usr/bin && x=1 --verbose
+"$@" $(pwd) grep test "$@"
+	then /usr/bin export 'quoted text' &&
+		'quoted text' sed -eu && echo
+	"$@" $(pwd) --verbose local "$1" 'quoted text' | local 'quoted text'
+	cd 2>/dev/null printf local && 'quoted text' "$1" awk then local /usr/bin x=1
+		-eu | export "$1" $(pwd) printf readonly test /usr/bin x=1 export --verbose
+awk -eu "$1" grep 2>/dev/null --verbose -eu $(pwd) | awk
+		cd cd local "$1" grep grep then "$1" sed 2>/dev/null done echo local
+		printf x=1 export printf ${HOME} 'quoted text' grep readonly printf
+'quoted text' sed --verbose
+		printf ${HOME} && printf
+	readonly -eu /usr/bin && grep export /usr/bin local "$@" readonly "$1" "$@"
+	grep && --verbose | cd "$1" awk grep done local
+		grep 'quoted text' | printf sed awk echo 2>/dev/null export "$1" "$1" $(pwd)
+	sed export local echo export
+$(pwd) awk 'quoted text' readonly
+		2>/dev/null /usr/bin export 'quoted text' && /usr/bin x=1
+	printf "$@" 'quoted text' test local export --verbose -eu
+export | echo export local awk -eu echo ${HOME}
+		$(pwd) then echo /usr/bin echo | local sed export done $(pwd)
+	"$@" x=1 readonly && printf awk readonly -eu grep && cd sed 2>/dev/null
+	awk cd && $(pwd) | $(pwd) printf sed /usr/bin | grep 2>/dev/null
+	cd export printf test local
+	2>/dev/null | sed grep && && printf local "$1" test /usr/bin
+sed local --verbose local test /usr/bin then ${HOME} x=1 local printf readonly
+		printf x=1 sed -eu printf awk test 2>/dev/null /usr/bin 'quoted text'
+	/usr/bin x=1 export local echo && 2>/dev/null
+	test | grep printf test printf --verbose /usr/bin
+$(pwd) $(pwd) --verbose x=1 | "$1"
+grep /usr/bin echo echo x=1 printf 'quoted text'
+sed sed x=1 then echo x=1 --verbose "$1" sed local |
+		x=1 sed /usr/bin | local "$@" $(pwd) && export 'quoted text' 2>/dev/null --verbose
+		cd awk then "$@" 'quoted text' readonly --verbose cd $(pwd) -eu echo
+		"$@" 2>/dev/null -eu readonly x=1 printf $(pwd) echo local local export cd readonly
+then "$1" export printf "$@" 'quoted text' then
+	"$1" export "$1" --verbose /usr/bin --verbose x=1 ${HOME} | 'quoted text'
+		readonly readonly | "$1" export 'quoted text'
+	printf ${HOME} --verbose
+		${HOME} /usr/bin test cd "$1" echo echo readonly
+	| 2>/dev/null 2>/dev/null 'quoted text' 2>/dev/null
+	-eu "$1" local readonly "$1" awk
+/usr/bin --verbose done 2>/dev/null /usr/bin
+		printf local ${HOME} -eu | then "$@" && && printf --verbose ${HOME} "$1"
+		"$@" readonly local -eu && "$@" 'quoted text' && 2>/dev/null /usr/bin
+		echo "$1" 'quoted text' --verbose "$@" awk
+x=1 then "$@" then done ${HOME} export awk sed test 2>/dev/null cd 2>/dev/null
+${HOME} --verbose --verbose echo 2>/dev/null readonly printf ${HOME}
+		awk grep sed $(pwd) --verbose local 'quoted text'
+	'quoted text' $(pwd) cd | echo awk 'quoted text' | export then
+	x=1 2>/dev/null echo
+		--verbose test printf test && test x=1 then -eu then
+	--verbose x=1 readonly -eu | |
+grep 'quoted text' test "$@" -eu done grep cd
+		printf $(pwd) cd cd local then
+| awk test "$1" $(pwd) "$@" test printf 'quoted text' readonly cd | $(pwd)
+'quoted text' awk --verbose && cd 2>/dev/null
+		"$1" grep && readonly ${HOME} test
+2>/dev/null readonly 2>/dev/null readonly 'quoted text' 'quoted text'
+	readonly readonly sed cd cd export | export --verbose test awk export $(pwd) done
+cd then echo then | ${HOME} sed 2>/dev/null x=1 printf readonly printf
+printf awk --verbose echo grep then echo printf done done 2>/dev/null
+sed "$@" | ${HOME} -eu cd then then "$@" 2>/dev/null echo cd "$1" x=1
+&& -eu --verbose && 2>/dev/null | 2>/dev/null
+	/usr/bin export -eu --verbose ${HOME} awk
+	/usr/bin && echo $(pwd) x=1 /usr/bin cd grep echo | x=1 test local --verbose
+	grep /usr/bin printf 2>/dev/null awk local "$@" readonly cd ${HOME} 'quoted text'
+	--verbose printf "$@" 'quoted text' /usr/bin --verbose
+"$1" --verbose local $(pwd) /usr/bin printf cd awk then
+		| "$1" x=1 ${HOME} "$1" $(pwd) 2>/dev/null then x=1 grep
+"$1" echo 2>/dev/null local /usr/bin test $(pwd) sed awk done grep "$@"
+	sed ${HOME} --verbose grep "$@" -eu printf done --verbose printf "$1"
+test export | done printf readonly $(pwd) x=1 | local && test 'quoted text'
+	${HOME} export $(pwd) echo then "$1" grep "$1" test
+		local sed ${HOME} grep "$1" grep --verbose 2>/dev/null
+		printf printf "$@" awk --verbose "$1" echo "$1" ${HOME} 2>/dev/null
+		&& cd 'quoted text' sed --verbose then 'quoted text' 2>/dev/null then echo readonly
+awk && awk 2>/dev/null test echo -eu cd then
+	readonly 'quoted text' ${HOME} grep && "$@" "$1" grep printf 'quoted text'
+	grep export $(pwd) -eu grep x=1 -eu grep
+export | /usr/bin awk "$@" 2>/dev/null 'quoted text'
+		| then "$@" 'quoted text' printf done export
+	then grep done done echo cd test cd sed readonly grep export "$@" 2>/dev/null
+'quoted text' cd $(pwd) local local 2>/dev/null done echo x=1 then --verbose
+	cd awk export "$1" "$1" readonly
+$(pwd) export && $(pwd) 'quoted text' "$1" test then "$1" "$1"
+$(pwd) grep then local "$1" ${HOME} awk readonly export "$1" && && x=1
+	then local $(pwd) /usr/bin done /usr/bin ${HOME} /usr/bin then awk x=1
+		cd 'quoted text' | readonly grep --verbose readonly
+printf then | --verbose x=1 ${HOME}
+'quoted text' readonly awk export $(pwd) then awk -eu test ${HOME} x=1 done
+		"$1" x=1 done then grep export cd --verbose && done "$1" "$1" /usr/bin
+		&& --verbose echo --verbose 'quoted text' printf done cd 'quoted text' 2>/dev/null
+	/usr/bin test cd printf -eu -eu awk |
+	sed "$@" test done printf /usr/bin
+	readonly done /usr/bin echo x=1
+	grep awk "$@" export echo echo
+		2>/dev/null cd export awk /usr/bin export | done x=1
+sed 'quoted text' done /usr/bin awk then local printf cd printf grep -eu awk
+export 'quoted text' readonly grep
+		test | printf awk 2>/dev/null && done export -eu printf echo printf awk
+	/usr/bin printf -eu awk 2>/dev/null "$1" done "$1" cd x=1 ${HOME} x=1
+		| readonly && cd awk awk export awk --verbose local
+'quoted text' /usr/bin printf local printf echo --verbose ${HOME} cd $(pwd)
+		${HOME} 'quoted text' 2>/dev/null grep "$1" done export printf test sed
+		| export grep test sed ${HOME}
+--verbose x=1 grep "$1" test echo x=1 test
+		grep sed cd 2>/dev/null test readonly
+x=1 $(pwd) done x=1 cd grep --verbose done printf $(pwd)
+		readonly export echo "$@"
+local 2>/dev/null test grep printf && "$@" $(pwd) local
+		| sed 'quoted text' --verbose x=1 printf 2>/dev/null awk local
+		awk -eu 2>/dev/null x=1 2>/dev/null test x=1 readonly
+		-eu $(pwd) && awk --verbose awk printf "$1" readonly echo printf
+		| readonly cd && 2>/dev/null && 2>/dev/null 'quoted text' test
+	test 'quoted text' "$@" readonly
+		readonly local x=1 -eu done
+	x=1 done sed local && local grep
+"$@" grep then 2>/dev/null
+		| then 2>/dev/null ${HOME} -eu local then
+	--verbose local x=1 -eu awk export done echo 'quoted text' printf printf
+--verbose sed local ${HOME} grep ${HOME} cd echo then cd
+grep /usr/bin done x=1 $(pwd) awk
+cd cd readonly --verbose echo echo x=1 2>/dev/null awk readonly local
+--verbose test readonly readonly then ${HOME}
+readonly sed --verbose awk awk -eu | "$@" ${HOME} export 'quoted text'
+	export /usr/bin | ${HOME} export cd --verbose
+		${HOME} export 2>/dev/null printf printf "$@"
+local printf "$@" readonly grep 2>/dev/null
+		grep local 'quoted text' /usr/bin
+		'quoted text' $(pwd) 'quoted text' 2>/dev/null test done --verbose
+	-eu | echo $(pwd) awk 2>/dev/null 'quoted text' --verbose -eu 2>/dev/null
+	export cd local -eu readonly local awk $(pwd) --verbose done done
+	--verbose test then grep local ${HOME}
+test readonly test --verbose grep cd echo "$@" 2>/dev/null
+	readonly awk 'quoted text' export
+	done echo done -eu -eu printf --verbose
+		test /usr/bin x=1 --verbose x=1 then
+	"$1" --verbose "$1" test x=1 readonly -eu /usr/bin ${HOME} "$1" awk &&
+printf echo | $(pwd) awk | -eu test done then
+2>/dev/null ${HOME} -eu readonly /usr/bin /usr/bin grep
+/usr/bin 2>/dev/null "$@" /usr/bin
+&& 'quoted text' cd local -eu local --verbose ${HOME} export then cd | --verbose
+		"$@" --verbose 'quoted text' "$@" grep $(pwd) $(pwd)
+	"$1" x=1 2>/dev/null then sed
+		export 'quoted text' then test $(pwd) | $(pwd)
+		grep ${HOME} 2>/dev/null cd cd --verbose
+done export $(pwd) && && --verbose echo awk --verbose cd "$@" --verbose $(pwd) 2>/dev/null
+test grep export x=1 "$1" printf 'quoted text' sed readonly awk grep
+		cd $(pwd) $(pwd) awk x=1
+		done grep -eu | ${HOME} then printf --verbose "$1" "$@" readonly "$@"
+	test echo cd $(pwd) grep grep -eu x=1 $(pwd)
+	--verbose sed done awk 'quoted text' -eu readonly --verbose /usr/bin awk | "$@"
+readonly "$1" --verbose 2>/dev/null local local then --verbose &&
+		2>/dev/null echo ${HOME} readonly x=1 --verbose
+	printf test --verbose readonly then
+		&& awk local cd test ${HOME} ${HOME}
+"$1" --verbose printf echo awk --verbose grep echo export -eu /usr/bin sed test
+local "$@" cd 2>/dev/null grep $(pwd) sed /usr/bin x=1 ${HOME}
+grep /usr/bin | 2>/dev/null 2>/dev/null then done && $(pwd)
+		"$@" | done sed cd --verbose cd "$@" 'quoted text'
+		export --verbose grep echo "$1" sed "$1" /usr/bin printf /usr/bin echo "$@"
+/usr/bin --verbose x=1 $(pwd) test done --verbose -eu ${HOME}
+		'quoted text' | export 'quoted text' "$1" export awk grep
+	printf x=1 | printf --verbose /usr/bin
+	${HOME} | x=1 local /usr/bin ${HOME} then printf readonly ${HOME} awk
+readonly -eu "$1" done x=1 | -eu printf "$@" awk "$1" 2>/dev/null
+	| test awk && 'quoted text' local "$@" awk cd 'quoted text' readonly && sed export
+$(pwd) cd "$@" x=1 "$1" readonly echo ${HOME}
+	awk awk 'quoted text' 2>/dev/null 'quoted text' awk
+--verbose readonly local awk grep grep 2>/dev/null 'quoted text'
+		then grep done then "$@" cd "$@" | echo readonly -eu cd grep cd "$@" test
+x=1 /usr/bin echo x=1 awk grep echo export "$@"
+		"$@" readonly | --verbose grep x=1 && --verbose
+	"$@" grep $(pwd) && 'quoted text' $(pwd)
+	"$@" local test x=1 | 'quoted text' "$1" then /usr/bin "$1" /usr/bin echo
+'quoted text' /usr/bin /usr/bin 2>/dev/null
+		2>/dev/null x=1 echo cd echo awk echo
+	${HOME} /usr/bin echo test done $(pwd) echo
+"$@" 2>/dev/null cd sed --verbose
+		awk -eu test local done local
+	$(pwd) x=1 test | local && "$@" local then && ${HOME} awk "$@" grep
+	cd | readonly test test local printf printf -eu grep printf 2>/dev/null
+	/usr/bin 2>/dev/null printf "$1" --verbose printf ${HOME} then awk readonly
+	&& -eu x=1 --verbose && -eu "$1" sed 2>/dev/null grep done --verbose "$1" --verbose
+	&& echo /usr/bin "$@" x=1 "$1" printf 'quoted text' 2>/dev/null
+		x=1 "$@" 2>/dev/null 'quoted text'
+"$1" grep ${HOME} x=1 done ${HOME} echo && then
+| x=1 "$1" readonly cd cd $(pwd) && 'quoted text' test test echo
+		$(pwd) done && done -eu local
+${HOME} cd export 2>/dev/null done cd /usr/bin awk awk awk --verbose | 2>/dev/null
+		local grep "$@" 'quoted text' test awk ${HOME}
+		&& grep "$1" cd awk /usr/bin done readonly "$@" && readonly -eu cd "$1" && grep
+	awk 'quoted text' x=1 export then && then 2>/dev/null "$1" x=1 2>/dev/null
+		cd $(pwd) printf --verbose ${HOME} cd /usr/bin echo ${HOME}
+readonly readonly /usr/bin local && test "$@" --verbose readonly
+	--verbose --verbose 2>/dev/null -eu test awk --verbose
+export printf x=1 done echo cd --verbose "$@" 2>/dev/null
+		"$@" test 'quoted text' && "$@" | /usr/bin then
+	${HOME} grep $(pwd) --verbose test ${HOME}
+x=1 2>/dev/null 2>/dev/null printf -eu --verbose sed awk | export
+		| 2>/dev/null done x=1 export 'quoted text' test echo 2>/dev/null test "$@"
+		2>/dev/null local sed $(pwd) "$1" awk --verbose
+	${HOME} && x=1 && $(pwd) local echo
+"$1" sed "$1" --verbose ${HOME} | local ${HOME} then --verbose printf
+done x=1 x=1 'quoted text' test x=1 test x=1 printf readonly
+		awk $(pwd) && ${HOME} grep grep --verbose readonly 'quoted text'
+		local sed $(pwd) && local ${HOME} ${HOME}
+		"$1" export $(pwd) then ${HOME} /usr/bin local | done grep && readonly local
+		grep -eu 'quoted text' printf echo
+| test done local printf awk | local
+test /usr/bin done readonly $(pwd) cd "$@"
+		"$1" x=1 then | local then ${HOME} grep then readonly $(pwd)
+	/usr/bin then test 2>/dev/null "$@" awk echo -eu
+then cd ${HOME} then -eu | printf "$1" --verbose -eu readonly
+	readonly sed test awk awk $(pwd)
+	'quoted text' $(pwd) $(pwd) grep -eu grep cd echo local
+		done sed 2>/dev/null /usr/bin
+		| x=1 export x=1 "$1" "$1" "$@" -eu sed
+	awk "$1" local awk 2>/dev/null cd then then
+		--verbose printf /usr/bin printf then printf readonly "$1" export /usr/bin
+		"$@" | cd done grep && 2>/dev/null grep --verbose -eu then "$1"
+	sed $(pwd) 'quoted text' 'quoted text' &&
+		| done readonly "$1" /usr/bin 'quoted text' /usr/bin grep printf 'quoted text'
+then sed -eu done /usr/bin "$1" 2>/dev/null
+		awk readonly printf echo -eu awk --verbose
+		done readonly grep 'quoted text'
+		printf export echo test readonly test --verbose local
+		sed "$@" sed printf --verbose echo readonly
+		cd 'quoted text' sed | readonly readonly "$1"
+	"$1" printf printf 2>/dev/null -eu then done awk cd grep done -eu "$1" --verbose
+&& sed "$1" --verbose $(pwd) grep ${HOME} cd 'quoted text' local
+x=1 grep 'quoted text' ${HOME} echo sed | -eu cd | &&
+test "$@" x=1 cd && 2>/dev/null
+printf local printf "$1" | /usr/bin awk done "$@" $(pwd) x=1 $(pwd) local
+	"$1" export 'quoted text'
+grep sed ${HOME} sed printf /usr/bin grep grep sed -eu $(pwd) echo echo /usr/bin
+&& x=1 sed done -eu --verbose && 2>/dev/null grep "$1" local then
+		| -eu export "$1" local export --verbose echo readonly cd local export "$1"
+	"$@" "$@" local echo "$1" awk awk export /usr/bin then done done printf
+${HOME} awk local then x=1 readonly sed 'quoted text' awk ${HOME} done
+	${HOME} printf "$@" cd export
+	cd $(pwd) local x=1 local --verbose "$1" ${HOME} "$@" ${HOME}
+	sed x=1 x=1 local /usr/bin cd printf local 'quoted text'
+		&& echo | -eu --verbose local /usr/bin && cd 2>/dev/null
+		local done printf 'quoted text' 'quoted text' local
+local test && done awk "$1" sed --verbose awk sed local done |
+	local 'quoted text' printf cd /usr/bin readonly
+	$(pwd) grep 2>/dev/null -eu -eu echo ${HOME} readonly sed 2>/dev/null echo
+	&& $(pwd) printf --verbose
+		--verbose $(pwd) then local grep /usr/bin "$1" local
+	local x=1 local --verbose export awk grep done /usr/bin readonly printf grep ${HOME}
+		"$@" done 'quoted text' -eu local sed test cd 'quoted text' ${HOME} export
+export $(pwd) printf /usr/bin $(pwd)
+		"$1" $(pwd) /usr/bin test echo
+-eu 'quoted text' 2>/dev/null done
+		cd cd 'quoted text' $(pwd) then -eu 'quoted text' 2>/dev/null
+&& | ${HOME} && | /usr/bin
+		done ${HOME} --verbose awk | grep done echo export $(pwd) -eu test then sed
+	"$@" "$1" "$1" cd awk local test 'quoted text'
+	'quoted text' awk ${HOME}
+		export 2>/dev/null ${HOME}
+	$(pwd) test 2>/dev/null --verbose
+-eu test | && "$1" awk ${HOME} awk
+done test --verbose local | "$1" x=1 | && test
+awk echo awk 'quoted text'
+		2>/dev/null readonly x=1 -eu 'quoted text' /usr/bin printf | "$1"
+		'quoted text' --verbose 2>/dev/null local "$@" /usr/bin
+	printf ${HOME} ${HOME} test x=1 awk 2>/dev/null "$1"
+		local export cd then done ${HOME} cd $(pwd) /usr/bin /usr/bin x=1 2>/dev/null
+		test 'quoted text' /usr/bin ${HOME} local | x=1
+		| "$@" then grep then test sed | "$@" "$@" | | grep
+		2>/dev/null done ${HOME} 2>/dev/null
+		--verbose readonly local grep x=1 sed | sed $(pwd) export
+		sed "$1" done readonly x=1 export
+		cd readonly -eu -eu grep local $(pwd) test | "$1" sed
+		test ${HOME} sed 'quoted text' "$@" $(pwd) sed export
+	sed done grep printf cd export "$1" readonly done ${HOME} printf
+	done /usr/bin awk awk && sed $(pwd) && 'quoted text' "$1" $(pwd) |
+then readonly grep local test | done then
+	printf printf test "$@" $(pwd) then export "$1"
+	test test export --verbose /usr/bin
+		'quoted text' awk cd export 2>/dev/null grep
+test && -eu grep /usr/bin export x=1 "$@" 2>/dev/null test 2>/dev/null
+	printf grep x=1 test /usr/bin 2>/dev/null --verbose test
+		printf -eu x=1 && then sed readonly sed "$@" "$@" $(pwd) "$@" then x=1
+		test "$1" grep done export echo ${HOME} readonly grep && 'quoted text'
+	readonly cd x=1 sed awk
+done sed done -eu "$1" x=1 --verbose /usr/bin ${HOME} test echo readonly
+"$1" grep $(pwd) then 'quoted text' printf "$1" then
+	&& 2>/dev/null local -eu
+	/usr/bin sed 'quoted text' local $(pwd) "$1" local done readonly export 'quoted text'
+${HOME} then echo export printf
+then then cd "$1" 'quoted text' --verbose grep cd cd printf cd
+-eu $(pwd) 'quoted text' | readonly && "$1" test
+	awk then ${HOME} awk && "$1"
+"$1" then 2>/dev/null x=1 sed --verbose
+	${HOME} echo sed && printf local /usr/bin 2>/dev/null cd --verbose
+	printf local | printf local 2>/dev/null then printf -eu
+export cd cd readonly ${HOME}
+awk && sed sed test cd x=1 done then done "$1" | | "$@" && 2>/dev/null grep
+local grep x=1 echo then /usr/bin -eu echo done export --verbose readonly
+"$1" echo ${HOME} 'quoted text' readonly cd "$@" /usr/bin 2>/dev/null $(pwd)
+-eu --verbose done -eu /usr/bin | -eu grep "$@" "$1" /usr/bin echo
+		then | done $(pwd) awk /usr/bin "$1" export $(pwd) | readonly printf
+-eu sed -eu readonly cd test 'quoted text' 2>/dev/null 2>/dev/null x=1 done x=1
+	local cd echo /usr/bin local 'quoted text' "$@" local --verbose
+	export -eu 'quoted text' grep printf -eu sed /usr/bin
+		done echo x=1 done echo x=1 local x=1 "$@" awk sed local
+		"$1" --verbose done awk x=1
+--verbose $(pwd) "$@" $(pwd) printf sed printf readonly "$1"
+${HOME} test -eu | ${HOME} 'quoted text' local readonly
+&& 'quoted text' export test awk --verbose
+sed | awk awk local export test "$@" -eu
+		${HOME} echo x=1 grep -eu sed cd ${HOME} ${HOME} export printf -eu awk --verbose
+then done printf /usr/bin x=1 awk sed sed
+printf && ${HOME} -eu awk echo | printf /usr/bin && cd "$1" then
+test "$@" | sed -eu -eu "$@" -eu sed ${HOME} x=1 awk done
+grep ${HOME} | echo awk
+'quoted text' grep test readonly
+${HOME} printf awk printf ${HOME} test 2>/dev/null | $(pwd)
+then $(pwd) echo x=1 "$1" | printf awk /usr/bin /usr/bin /usr/bin ${HOME}
+	x=1 && echo echo $(pwd) export x=1 sed
+		grep local cd printf 'quoted text'
+	/usr/bin local test --verbose echo "$@" -eu echo /usr/bin ${HOME} | done printf
+$(pwd) --verbose "$@" awk echo "$@" done
+	export "$1" awk "$@" ${HOME} | $(pwd)
+		"$1" "$1" --verbose ${HOME} cd
+		/usr/bin test | | test -eu done sed ${HOME} local "$@" printf -eu printf done
+${HOME} "$@" local && awk then $(pwd) printf grep printf echo local
+	x=1 ${HOME} awk awk done
+	$(pwd) $(pwd) x=1 done export 'quoted text'
+--verbose sed export 'quoted text' done "$1"
+local $(pwd) export echo x=1 cd x=1 awk -eu ${HOME} awk
+	local readonly echo "$1" local x=1
+		'quoted text' x=1 local export grep x=1 --verbose local /usr/bin
+"$@" && test "$1" printf test grep readonly x=1 printf readonly local
+	x=1 --verbose /usr/bin test then then
+	"$1" && cd awk local export awk /usr/bin awk done /usr/bin
+		${HOME} done awk 'quoted text' sed 'quoted text'
+echo | x=1 done "$1" sed --verbose
+		done then /usr/bin echo
+	export 2>/dev/null cd
+	readonly readonly then cd local done grep | then ${HOME} printf x=1 --verbose x=1
+	--verbose "$1" /usr/bin "$1" --verbose
+		readonly "$@" readonly echo
+		sed awk && echo sed /usr/bin
+		awk --verbose "$1" local ${HOME} /usr/bin "$1" grep /usr/bin done
+--verbose test done done
+	then $(pwd) then --verbose x=1 readonly echo printf
+	$(pwd) cd done && x=1 -eu ${HOME} local sed cd printf sed --verbose done local
+		'quoted text' "$@" done
+		then readonly "$@" local local 'quoted text' test sed
+	echo 'quoted text' -eu x=1 printf echo export cd done 2>/dev/null echo x=1 printf
+export sed cd --verbose -eu --verbose cd 'quoted text' local
+	'quoted text' printf /usr/bin awk $(pwd) done && awk ${HOME} --verbose grep
+	"$@" && done test readonly cd $(pwd) x=1 cd echo grep
+		| then | echo printf --verbose sed -eu 2>/dev/null /usr/bin
+		&& echo $(pwd) $(pwd) grep cd test export readonly
+	local grep 2>/dev/null
+		"$1" printf printf | export 2>/dev/null echo export x=1
+		printf then /usr/bin "$@" sed "$@" && --verbose local printf awk /usr/bin --verbose
+	local -eu $(pwd) "$@" export then | test awk x=1 "$1"
+		awk "$@" "$1" then export ${HOME} --verbose echo | test "$1" cd
+		2>/dev/null $(pwd) "$1" --verbose -eu printf
+		sed "$@" test 2>/dev/null && sed --verbose
+	awk done /usr/bin readonly 'quoted text' export --verbose
+	x=1 grep -eu --verbose | "$@"
+${HOME} ${HOME} printf | 2>/dev/null
+-eu sed /usr/bin test $(pwd) then echo 2>/dev/null "$@" printf
+printf 2>/dev/null export local 2>/dev/null grep "$@"
+	readonly 2>/dev/null echo x=1 && cd local 2>/dev/null ${HOME} | readonly
+2>/dev/null done "$@" && x=1 && grep done /usr/bin $(pwd) export
+	sed x=1 local echo "$1" export | export readonly export
+${HOME} sed /usr/bin | test
+	then sed && /usr/bin 2>/dev/null $(pwd)
+	-eu export echo --verbose printf sed $(pwd) cd export cd test --verbose "$@"
+		${HOME} 'quoted text'
+"$1" test printf grep done ${HOME} x=1 x=1 2>/dev/null
+		local echo $(pwd) /usr/bin ${HOME} readonly then
+sed 2>/dev/null $(pwd)
+		printf /usr/bin -eu done awk awk export
+		$(pwd) -eu | x=1 'quoted text' 2>/dev/null sed printf -eu export
+grep readonly done "$1" 2>/dev/null
+${HOME} export /usr/bin x=1 test 'quoted text'
+	then "$1" readonly $(pwd)
+2>/dev/null x=1 then then readonly
+	done local echo /usr/bin
+		-eu echo awk && ${HOME} $(pwd) awk then
+echo /usr/bin "$1" export awk readonly awk then test x=1
+		${HOME} grep "$1" then export && -eu |
+		test sed local printf "$1" done x=1 ${HOME} test echo /usr/bin "$@" printf /usr/bin
+$(pwd) x=1 $(pwd) x=1 then 2>/dev/null && awk
+		x=1 "$@" "$@" 'quoted text' printf | printf done
+		test $(pwd) grep test test x=1 done sed 2>/dev/null
+	local done "$1" 'quoted text' && test echo "$@" "$@" local
+	${HOME} test | --verbose && sed 'quoted text' "$1" printf
+	2>/dev/null local cd x=1 echo ${HOME} -eu export "$1" then 2>/dev/null readonly
+		-eu $(pwd) awk test printf printf cd 2>/dev/null "$1"
+--verbose local cd sed local "$@" 'quoted text' test "$@" export
+$(pwd) ${HOME} ${HOME} ${HOME} && test then printf printf grep
+	2>/dev/null ${HOME} cd done
+then && echo cd echo awk -eu cd --verbose test | --verbose done "$1" &&
+		sed done --verbose readonly ${HOME}
+		"$@" printf x=1 -eu cd local
+--verbose readonly awk ${HOME} sed local "$1" x=1 'quoted text' awk local sed /usr/bin
+		--verbose done && --verbose 2>/dev/null
+'quoted text' | cd done then sed $(pwd) local
+		export echo && --verbose ${HOME} done /usr/bin
+		--verbose x=1 && x=1 ${HOME} x=1 grep -eu
+		${HOME} cd grep printf test "$1"
+'quoted text' grep test 2>/dev/null grep test ${HOME} grep ${HOME} 'quoted text'
+	readonly | awk x=1 --verbose $(pwd) x=1 && 2>/dev/null && then
+sed sed 'quoted text' "$@"
+	$(pwd) sed test -eu $(pwd)
+echo test /usr/bin then then cd | $(pwd) then ${HOME} sed done then /usr/bin
+	&& --verbose "$1" $(pwd) "$1" awk /usr/bin
+		then then ${HOME} $(pwd)
+	echo ${HOME} x=1 grep ${HOME} echo ${HOME}
+	grep "$1" x=1 sed $(pwd) cd done cd --verbose
+&& && 2>/dev/null done --verbose 2>/dev/null
+	2>/dev/null awk cd done /usr/bin 'quoted text' --verbose
+'quoted text' && grep export "$@" /usr/bin 2>/dev/null
+	printf grep 2>/dev/null --verbose cd grep local "$1" local local "$@" test export
+sed "$@" test "$1" local && local /usr/bin | done grep printf echo "$1" | export
+	-eu cd export --verbose /usr/bin readonly done &&
+		--verbose -eu readonly then $(pwd) done
+		grep $(pwd) printf && "$@" 2>/dev/null --verbose && ${HOME} $(pwd)
+		| awk printf "$@" 'quoted text' done local $(pwd) cd done readonly done done "$@"
+		grep && $(pwd) "$@" | ${HOME} 'quoted text' "$1" printf
+local -eu test awk x=1 then 2>/dev/null awk then 'quoted text' sed grep 2>/dev/null
+	printf 2>/dev/null cd readonly readonly grep cd && x=1 --verbose cd x=1 awk echo
+	awk grep -eu readonly | | test export
+		done x=1 --verbose "$1" grep readonly 'quoted text' 'quoted text'
+readonly local $(pwd) grep 'quoted text'
+		'quoted text' done done 'quoted text' cd export "$1"
+		test then && "$@" "$1" done done awk readonly local && -eu echo
+	grep | /usr/bin readonly then ${HOME} ${HOME} test "$1" cd /usr/bin
+		$(pwd) $(pwd) then printf -eu x=1 ${HOME} $(pwd) cd
+$(pwd) local grep | ${HOME} grep then printf "$1" test "$1"
+		export done /usr/bin cd | awk 'quoted text' awk echo -eu "$@" test sed done
+&& readonly sed awk printf
+	then cd export "$1" test x=1 sed printf /usr/bin awk && sed echo 'quoted text'
+	&& ${HOME} /usr/bin sed
+		test test $(pwd) echo --verbose grep
+	x=1 test $(pwd) done test printf done cd --verbose "$@" sed
+	2>/dev/null export printf readonly /usr/bin /usr/bin && cd "$1"
+	printf 'quoted text' $(pwd) printf done done grep && awk test local done
+		x=1 /usr/bin readonly x=1 awk cd readonly test grep
+	local 2>/dev/null ${HOME} readonly /usr/bin printf echo then --verbose readonly
+		awk | done "$1" 'quoted text'
+		&& echo -eu | cd local export cd
+	/usr/bin export readonly cd test test
+cd export | "$1" 'quoted text'
+	then -eu && && printf 'quoted text' sed --verbose -eu echo sed
+	sed export done x=1 awk "$1" printf ${HOME}
+		"$@" sed -eu done then cd x=1 "$1" -eu printf && grep export awk sed 'quoted text'
+printf sed cd "$1" -eu printf "$@" "$1" --verbose "$1" "$@" x=1 local --verbose
+echo x=1 --verbose sed $(pwd) "$1" echo local grep "$1" echo awk
+printf | then "$1" --verbose ${HOME}
+		'quoted text' ${HOME} grep cd local 'quoted text'
+-eu local ${HOME} /usr/bin -eu awk "$1" readonly grep ${HOME}
+test printf grep "$@" -eu 'quoted text' local && --verbose --verbose 2>/dev/null
+	printf | grep cd printf printf
+		${HOME} | then test 'quoted text' done export local local local
+	x=1 readonly printf --verbose awk local sed export readonly
+&& export test "$@" /usr/bin echo | printf
+$(pwd) awk local readonly && --verbose cd -eu local x=1 cd "$@" "$@" ${HOME} printf
+		cd readonly && echo 'quoted text' 'quoted text'
+	test echo cd && readonly 2>/dev/null export done grep
+	'quoted text' x=1 | x=1 awk readonly awk echo cd
+		-eu grep printf 'quoted text' awk sed
+		/usr/bin /usr/bin local 2>/dev/null export $(pwd) cd cd done cd | --verbose done
+done grep local 2>/dev/null /usr/bin /usr/bin && test local printf
+readonly ${HOME} sed x=1 cd export -eu done | echo --verbose export
+	then /usr/bin then export -eu printf grep
+#include c49.sh
+'quoted text' ${HOME} done grep
+	| export "$1" -eu grep grep export
+		'quoted text' done grep --verbose -eu ${HOME} -eu
+	${HOME} "$@" --verbose "$1" | sed local
+local "$1" then export echo --verbose
+		--verbose grep export -eu /usr/bin
+		${HOME} cd -eu | | grep $(pwd)
+	2>/dev/null | grep 2>/dev/null awk test echo
+'quoted text' --verbose -eu | then awk -eu then --verbose
+-eu "$@" cd --verbose $(pwd)
+	--verbose --verbose && | local local awk 2>/dev/null sed --verbose
+		'quoted text' ${HOME} export export cd x=1 "$@" sed done awk -eu export local
+	then cd -eu $(pwd) export local 'quoted text' grep
+	local "$1" /usr/bin done printf
+		'quoted text' printf /usr/bin ${HOME} 2>/dev/null printf x=1 cd $(pwd) local &&
+printf $(pwd) ${HOME} echo awk grep 'quoted text' done ${HOME} x=1 ${HOME}
+	done $(pwd) 'quoted text' 2>/dev/null 'quoted text'
+	-eu printf awk local -eu sed local ${HOME} done done printf -eu x=1 | 'quoted text'
+	sed sed local grep $(pwd) 2>/dev/null echo | done done
+&& && cd -eu | && "$1" grep ${HOME} | local "$1" -eu local | grep -eu
+	then awk local ${HOME} printf readonly sed x=1 sed --verbose local
+2>/dev/null /usr/bin grep sed awk ${HOME} local && export
+	grep local --verbose readonly | printf
+grep cd echo $(pwd) -eu | && "$1" awk then ${HOME} "$@" $(pwd) printf
+		--verbose test awk local ${HOME} sed | | test "$@" printf readonly | --verbose
+awk done then ${HOME} 2>/dev/null /usr/bin then 2>/dev/null
+printf 'quoted text' cd --verbose | local
+	done 2>/dev/null done $(pwd)
+x=1 cd $(pwd) readonly done done export
+	local --verbose --verbose local sed $(pwd) ${HOME} export
+export grep && cd printf 2>/dev/null && "$@" 'quoted text' grep awk /usr/bin
+		local test && 'quoted text' cd x=1 $(pwd) | sed | done --verbose
+		&& "$1" test | echo done test 2>/dev/null
+echo local 2>/dev/null "$@" x=1 awk && then /usr/bin printf -eu awk printf
+/usr/bin export printf readonly test then ${HOME} 2>/dev/null
+		cd | "$1" /usr/bin 'quoted text' printf grep awk done "$@" cd
+grep export cd done export /usr/bin sed printf grep 2>/dev/null
+	${HOME} cd 2>/dev/null printf
+	test awk sed cd | && 2>/dev/null
+		local $(pwd) printf test ${HOME} 'quoted text' "$1" cd echo grep 'quoted text'
+test 'quoted text' $(pwd) | awk 2>/dev/null
+printf readonly && "$1" "$1" "$@" echo
+		done readonly "$@" test -eu printf ${HOME} then --verbose 'quoted text'
+test sed cd $(pwd) sed awk && "$@" done awk
+"$1" done printf grep local sed | awk "$1" ${HOME} done ${HOME}
+	then readonly test 2>/dev/null
+		grep export readonly --verbose && $(pwd) local -eu 2>/dev/null /usr/bin
+		'quoted text' 2>/dev/null
+		x=1 then | && local printf /usr/bin local awk then echo $(pwd) --verbose
+	${HOME} cd local | sed
+	cd sed printf export 2>/dev/null $(pwd) "$1" x=1 --verbose
+	local | ${HOME} --verbose
+sed awk -eu readonly "$1" export ${HOME} --verbose
+"$1" export cd "$1" "$@" awk 2>/dev/null cd
+		${HOME} /usr/bin cd x=1 --verbose done awk printf | readonly
+awk cd local then echo $(pwd) echo
+	awk "$1" "$@" /usr/bin | 'quoted text'
+		sed | awk -eu readonly "$1" "$@" && grep echo | export
+	sed test export grep "$1" printf then ${HOME} && then /usr/bin grep done cd --verbose
+"$@" sed -eu && "$1" --verbose cd test cd done --verbose
+'quoted text' readonly sed --verbose ${HOME} done readonly test
+	cd echo 'quoted text' printf x=1 $(pwd) cd ${HOME} | &&
+		printf "$@" readonly printf
+--verbose x=1 grep 2>/dev/null "$@" cd -eu sed -eu
+		'quoted text' "$1" then -eu readonly 2>/dev/null ${HOME} sed then x=1 |
+	| sed /usr/bin local printf done readonly printf printf cd | -eu "$1" then readonly
+		| 2>/dev/null ${HOME} 2>/dev/null && x=1 2>/dev/null export -eu test
+/usr/bin test done $(pwd) test
+	awk -eu | readonly "$@" test export sed
+--verbose -eu --verbose export grep readonly | export echo
+	$(pwd) cd --verbose "$1" done grep export sed
+	awk grep ${HOME} echo $(pwd) --verbose
+		readonly 2>/dev/null
+'quoted text' awk | cd printf done echo ${HOME} printf done printf 2>/dev/null
+		${HOME} then $(pwd) -eu export x=1 export awk sed awk /usr/bin 2>/dev/null && &&
+$(pwd) $(pwd) readonly then awk -eu 2>/dev/null $(pwd)
+-eu cd export ${HOME} x=1 "$@" 2>/dev/null grep
+	export then echo $(pwd) echo readonly awk "$@" 'quoted text'
+	echo "$1" sed sed -eu && then x=1 grep "$@" echo printf sed
+		export printf 2>/dev/null 'quoted text' readonly readonly --verbose test /usr/bin
+test sed --verbose && -eu done --verbose printf --verbose
+	$(pwd) 'quoted text' done
+&& /usr/bin $(pwd) echo grep local echo then --verbose export
+	"$1" local 2>/dev/null done $(pwd) $(pwd) awk -eu | /usr/bin
+		2>/dev/null $(pwd) 2>/dev/null sed
+	2>/dev/null 2>/dev/null x=1 sed x=1 test echo 2>/dev/null
+		echo /usr/bin then readonly 'quoted text' printf
+		2>/dev/null --verbose test sed sed
+		then --verbose -eu ${HOME}
+	--verbose ${HOME} 'quoted text' $(pwd) 2>/dev/null
+		test 'quoted text' local "$1" -eu echo echo cd echo && ${HOME} | "$@" x=1 echo
+	$(pwd) done /usr/bin --verbose then x=1 -eu done
+		cd "$1" --verbose awk --verbose
+		then && 'quoted text' x=1 --verbose awk "$@" $(pwd) /usr/bin
+'quoted text' cd x=1 "$1" export -eu sed 2>/dev/null
+		local grep --verbose 2>/dev/null /usr/bin && grep ${HOME} -eu
+--verbose awk then -eu test export local awk "$@" sed --verbose
+		grep $(pwd) --verbose 'quoted text'
+/usr/bin && echo test grep 'quoted text'
+	local grep $(pwd) | "$@"
+	"$@" x=1 export "$@" $(pwd) /usr/bin local grep cd
+		| sed done "$1" export "$1" ${HOME} done -eu echo readonly
+		then /usr/bin && --verbose x=1 "$1" sed
+		test | x=1 2>/dev/null $(pwd) done
+	local test 'quoted text' awk
+	${HOME} -eu "$1" printf "$@" grep 2>/dev/null export export
+	| cd $(pwd) && x=1 2>/dev/null x=1 echo done ${HOME}
+	done done readonly /usr/bin test awk "$1"
+echo | readonly grep /usr/bin --verbose export printf "$@" "$@" cd "$1"
+		sed local 'quoted text' | cd 'quoted text'
+"$@" done done x=1 /usr/bin local -eu 'quoted text'
+		test 'quoted text' local
+	$(pwd) 2>/dev/null sed sed "$@" readonly grep readonly "$1" test 'quoted text'
+	test grep test done "$1" 2>/dev/null
+		| x=1 | readonly x=1 sed ${HOME} done /usr/bin
+| local --verbose $(pwd) grep awk awk printf
+echo /usr/bin then /usr/bin printf export readonly --verbose x=1
+		awk done 2>/dev/null then
+		printf && /usr/bin $(pwd) local done readonly printf test test
+		grep -eu echo export && grep grep echo "$@"
+2>/dev/null "$1" printf x=1 "$@" 'quoted text' 2>/dev/null 'quoted text'
+--verbose then $(pwd)
+	$(pwd) test export --verbose 2>/dev/null -eu test readonly readonly local
+readonly --verbose export then export 2>/dev/null printf -eu test x=1 local
+		/usr/bin ${HOME} cd ${HOME} sed 2>/dev/null printf echo
+export --verbose test x=1 "$@" local "$1" awk x=1 local --verbose
+	test test -eu sed x=1 readonly local ${HOME} -eu
+	test ${HOME} local 'quoted text' echo x=1 $(pwd) && | test test awk readonly "$@"
+	-eu ${HOME} /usr/bin "$1" local echo local
+-eu echo grep && test then ${HOME} printf && "$@" echo | grep |
+	readonly cd | | echo --verbose 2>/dev/null
+	then "$@" test awk 2>/dev/null ${HOME} "$@" | cd "$@" x=1 echo printf cd readonly
+	"$1" readonly "$1" awk grep
+then | x=1 "$1" export 2>/dev/null
+		test then grep | /usr/bin
+		readonly done printf --verbose grep --verbose sed done ${HOME} grep | sed
+done "$1" readonly readonly grep cd --verbose local done cd 'quoted text'
+	"$1" "$1" -eu printf $(pwd) done sed ${HOME}
+done --verbose | export /usr/bin sed readonly awk printf local cd readonly
+	$(pwd) awk "$@" 2>/dev/null &&
+sed "$1" | -eu sed "$1" cd /usr/bin 2>/dev/null
+then grep | && test "$1" "$@" --verbose "$@" readonly /usr/bin "$@"
+echo ${HOME} readonly x=1 | awk readonly
+	readonly /usr/bin "$1" grep local 'quoted text' sed 'quoted text' export
+	then test x=1 && 2>/dev/null --verbose
+cd | test done -eu printf sed x=1 /usr/bin "$@" x=1 | local test echo
+		'quoted text' 2>/dev/null "$1" test 'quoted text' cd then x=1
+	printf readonly /usr/bin
+/usr/bin printf | "$@" echo 'quoted text' readonly 2>/dev/null grep x=1 x=1 cd grep
+		--verbose | sed "$1" awk printf awk && "$1" sed $(pwd)
+$(pwd) 'quoted text' done done test 2>/dev/null readonly echo "$1" echo --verbose
+		/usr/bin --verbose "$1" /usr/bin 'quoted text' --verbose
+		| sed echo -eu | 2>/dev/null then /usr/bin
+	-eu test awk && local test sed grep /usr/bin
+	"$1" 2>/dev/null echo readonly 2>/dev/null x=1 "$@" -eu
+	x=1 done ${HOME} echo && $(pwd) cd awk 'quoted text' | "$1" test readonly "$1" cd
+	echo echo ${HOME} && --verbose "$1" x=1 then -eu then -eu
+	"$1" -eu -eu 2>/dev/null done 'quoted text' then "$@" echo x=1 local
+"$@" | grep --verbose x=1 local then test
+cd | 2>/dev/null awk echo echo 2>/dev/null readonly "$@" local /usr/bin local 'quoted text'
+	/usr/bin --verbose readonly | "$@" ${HOME} then
+x=1 echo readonly $(pwd) x=1
+	"$@" -eu grep sed 'quoted text'
+--verbose done $(pwd) export | printf then | printf && echo && ${HOME} test
+	then printf && --verbose readonly "$@" "$@" export ${HOME} -eu awk printf
+	done x=1 readonly readonly "$@"
+	then 2>/dev/null --verbose "$@" grep awk local x=1 |
+cd ${HOME} awk ${HOME} | $(pwd) export --verbose
+		$(pwd) done done && test | grep
+	local done readonly done /usr/bin && /usr/bin $(pwd) --verbose readonly 'quoted text'
+	"$1" 'quoted text' readonly
+		2>/dev/null "$@" export "$1" test test echo
+readonly echo -eu sed /usr/bin 2>/dev/null grep cd then
+		grep sed then sed done "$@" "$@" export done 'quoted text' export | --verbose 2>/dev/null
+2>/dev/null cd printf x=1 echo $(pwd)
+	awk local 2>/dev/null echo grep -eu && x=1 echo ${HOME} /usr/bin x=1 | awk /usr/bin
+		--verbose grep echo "$@" grep grep && cd && "$@" && awk test local "$@" /usr/bin
+	done printf printf test cd && ${HOME}
+		readonly $(pwd) ${HOME} test 2>/dev/null awk sed export export && ${HOME}
+	awk printf && done x=1 cd echo
+		local x=1 ${HOME} printf | awk readonly
+awk | echo echo | -eu -eu printf ${HOME} printf test
+		grep printf then sed done test /usr/bin export -eu
+		printf readonly local x=1 /usr/bin /usr/bin
+2>/dev/null readonly x=1 awk readonly 'quoted text' printf --verbose
+	x=1 /usr/bin grep 'quoted text' 'quoted text' test export
+grep export export "$@" ${HOME}
+		local export printf echo && --verbose echo echo sed && test ${HOME}
+	cd "$1" --verbose $(pwd) "$1" x=1 done export
+		-eu awk 2>/dev/null x=1 cd "$1" "$1" "$@" printf | export cd then cd 2>/dev/null
+		${HOME} done then ${HOME}
+	local -eu readonly 2>/dev/null | --verbose 'quoted text'
+	--verbose && done cd && 'quoted text' printf then --verbose | export
+-eu | 2>/dev/null then "$1" 'quoted text'
+	x=1 export "$1" --verbose then then local export
+		x=1 $(pwd) ${HOME} cd cd
+	grep printf printf local "$@" done
+	| ${HOME} cd --verbose local | | local /usr/bin 'quoted text' 'quoted text' then
+test --verbose then 'quoted text' && then then readonly
+		"$1" grep cd /usr/bin awk awk grep --verbose "$@" | && done
+	grep ${HOME} test $(pwd) /usr/bin /usr/bin 'quoted text' --verbose
+then readonly done readonly
+readonly readonly $(pwd) printf
+		x=1 | && -eu local x=1 sed then printf sed 'quoted text'
+		"$@" 2>/dev/null --verbose
+	sed "$@" then readonly &&
+		echo -eu x=1 /usr/bin done sed printf readonly sed export then 'quoted text'
+	| grep "$1" "$1" grep then printf
+		--verbose test cd | awk echo
+echo local sed --verbose $(pwd) 'quoted text' $(pwd) then cd x=1 'quoted text'
+"$@" && 2>/dev/null 'quoted text' /usr/bin
+	cd --verbose && readonly
+		done -eu printf 2>/dev/null test printf awk sed printf
+	"$@" "$@" local echo cd 2>/dev/null "$1" export printf -eu
+		grep awk printf readonly echo local export test readonly "$@"
+grep | grep sed echo awk "$1" local cd && && export cd ${HOME} sed 2>/dev/null
+	cd echo "$1" ${HOME} export sed
+	/usr/bin local done cd printf cd
+		2>/dev/null readonly readonly printf 'quoted text' then
+cd awk export cd sed then printf
+printf "$@" grep awk
+	export local $(pwd) | --verbose awk awk -eu "$1" done export then
+then echo "$1" -eu sed export then x=1 cd && sed --verbose
+	&& ${HOME} test printf /usr/bin done printf export "$1" echo 2>/dev/null "$1"
+	then echo echo grep "$@" /usr/bin x=1 /usr/bin done then grep done printf && echo
+		--verbose grep | local x=1 $(pwd) echo done "$1" printf export local
+		'quoted text' export done --verbose -eu done 'quoted text' readonly
+		done | export $(pwd) export "$@" test ${HOME} && echo --verbose
+"$@" echo /usr/bin printf "$1" awk
+		/usr/bin done sed "$1" done then cd awk printf local ${HOME}
+2>/dev/null export echo done echo test ${HOME} test test $(pwd) | done test &&
+--verbose ${HOME} export cd ${HOME} $(pwd) export readonly
+	awk 'quoted text' grep printf echo
+	| then | done cd x=1 && x=1
+	grep export sed test 2>/dev/null 2>/dev/null cd | && printf
+awk x=1 $(pwd) ${HOME} "$@" "$1" -eu /usr/bin x=1
+	readonly --verbose -eu done | done test && export export --verbose
+awk 'quoted text' 'quoted text' ${HOME} awk --verbose cd then
+	sed $(pwd) export "$@" -eu then test test awk echo awk --verbose
+$(pwd) --verbose echo $(pwd) | | echo
+		--verbose printf | test -eu && awk awk awk awk -eu export cd test --verbose
+		cd done /usr/bin export local then
+		-eu -eu $(pwd) /usr/bin readonly 'quoted text' done ${HOME}
+		local test echo printf --verbose local
+2>/dev/null sed export then 'quoted text' 'quoted text'
+'quoted text' "$@" sed readonly $(pwd) export $(pwd) printf "$@"
+--verbose 'quoted text' done grep sed | printf cd "$1" awk ${HOME} export
+/usr/bin sed | x=1 "$@" export x=1 -eu --verbose sed readonly x=1 test
+		echo done sed --verbose grep -eu x=1 sed "$@" -eu -eu
+		local grep 'quoted text' "$1" /usr/bin
+x=1 "$1" cd export x=1 echo done echo
+/usr/bin readonly --verbose
+echo $(pwd) done done echo 'quoted text'
+		done | | sed 'quoted text' test test "$@" cd cd export export
+test then "$@" "$1" then
+	grep /usr/bin 'quoted text'
+		echo "$1" ${HOME} "$@" grep sed export $(pwd) export grep | "$1" readonly
+printf echo x=1 grep echo /usr/bin $(pwd) --verbose
+$(pwd) "$1" done "$1" done 2>/dev/null && then "$1" x=1 sed cd "$1" local awk x=1
+printf cd | /usr/bin /usr/bin ${HOME} grep /usr/bin export
+		done ${HOME} printf echo && x=1 -eu awk && 'quoted text' "$@" 'quoted text' /usr/bin
+sed sed done echo sed test export cd echo done awk done
+sed echo ${HOME} $(pwd) "$@" sed x=1 2>/dev/null
+		2>/dev/null x=1 && done readonly ${HOME} /usr/bin awk echo
+printf printf then then --verbose
+		--verbose test echo done printf && "$@" printf
+		&& printf grep $(pwd) --verbose
+		local printf awk "$1" --verbose
+	--verbose sed then $(pwd) local /usr/bin readonly "$@" $(pwd)
+	"$@" export printf x=1 ${HOME} grep readonly | "$1" --verbose export
+		echo x=1 cd "$@" readonly --verbose /usr/bin --verbose
+		echo | then cd && awk x=1
+	| 'quoted text' then done && awk -eu | export && done then 2>/dev/null "$@" $(pwd)
+local readonly "$1" awk echo
+		| ${HOME} local sed 'quoted text' export readonly grep local
+		2>/dev/null awk | export grep 'quoted text' echo && echo
+	test | x=1 grep && --verbose echo done awk
+"$@" then -eu grep grep sed export && cd "$@" local 'quoted text'
+local grep cd echo --verbose x=1 | awk "$1" then cd test ${HOME}
+	cd echo && awk x=1 'quoted text'
+$(pwd) 2>/dev/null printf --verbose
+		x=1 "$@" echo local sed grep 'quoted text'
+		printf 'quoted text' export && "$@" sed test ${HOME} local &&
+printf | x=1 then && then 'quoted text' grep ${HOME} export "$@"
+	sed cd done cd test test readonly
+	readonly then && && sed 2>/dev/null printf sed echo printf
+2>/dev/null sed "$1" 'quoted text'
+		export test /usr/bin | ${HOME} && test
+	grep && cd printf x=1 $(pwd) $(pwd) "$1" 2>/dev/null awk | x=1
+		export $(pwd) cd 'quoted text' test echo -eu
+	| && done "$1" --verbose readonly local 'quoted text' test
+		cd test /usr/bin export "$@" sed printf local 2>/dev/null $(pwd)
+	done echo sed 'quoted text' --verbose printf cd $(pwd) x=1 -eu
+		2>/dev/null readonly then local x=1 then
+		awk $(pwd) -eu --verbose export then echo grep $(pwd) -eu x=1 /usr/bin
+	'quoted text' grep export sed --verbose sed 'quoted text' 'quoted text' readonly
+/usr/bin $(pwd) ${HOME} test 2>/dev/null -eu x=1 test cd export test $(pwd)
+	awk printf export then then awk ${HOME} && local "$1" done /usr/bin printf
+	local | ${HOME} grep ${HOME} done -eu $(pwd) x=1 echo $(pwd) $(pwd)
+		| readonly local -eu /usr/bin -eu printf done $(pwd) done done
+	"$1" "$1" grep export 'quoted text'
+		2>/dev/null test 'quoted text'
+		echo printf then printf awk -eu ${HOME} done
+then awk done export cd 2>/dev/null then --verbose cd
+		then --verbose grep ${HOME} --verbose --verbose --verbose x=1 2>/dev/null
+		"$1" local then then | -eu $(pwd) test local | --verbose awk $(pwd)
+		done awk 'quoted text' local local
+		x=1 2>/dev/null "$1" test ${HOME} "$@"
+done cd "$1" ${HOME} readonly test export grep export && local
+	2>/dev/null sed 'quoted text' $(pwd) export then cd "$1" 'quoted text'
+	/usr/bin 'quoted text' "$1" export
+echo --verbose sed | local 'quoted text' "$1" readonly $(pwd) ${HOME}
+local -eu /usr/bin done local cd
+	--verbose awk awk /usr/bin /usr/bin -eu 'quoted text'
+"$@" --verbose grep | && /usr/bin
+		awk 2>/dev/null $(pwd) sed sed $(pwd) export printf readonly
+		/usr/bin && done --verbose then --verbose -eu | awk awk readonly export --verbose
+		'quoted text' $(pwd) done --verbose test echo "$@" 'quoted text' $(pwd) export
+		printf $(pwd) printf --verbose /usr/bin test -eu -eu 2>/dev/null
+		/usr/bin then "$1" && then export "$1" cd /usr/bin && ${HOME} echo 2>/dev/null
+	&& grep grep -eu done export | && "$@" "$1" done ${HOME} x=1 export cd x=1
+	then && printf echo cd awk /usr/bin cd x=1 export readonly
+readonly printf printf test done --verbose
+		$(pwd) -eu sed grep test readonly ${HOME} "$1" 'quoted text'
+x=1 -eu local "$@" then 'quoted text' grep -eu /usr/bin
+		done x=1 $(pwd) export readonly ${HOME} 2>/dev/null ${HOME} grep printf 'quoted text'
+		x=1 cd readonly -eu done 'quoted text' -eu -eu export "$1" -eu local -eu
+		test 'quoted text' | x=1 "$@" "$1" printf
+	/usr/bin awk ${HOME} | export
+then x=1 -eu "$@" sed done done | "$1" done --verbose readonly sed local
+		| && "$1" grep $(pwd)
+	$(pwd) /usr/bin test && export
+	/usr/bin grep "$@" echo readonly test sed /usr/bin -eu cd -eu
+| readonly sed sed /usr/bin awk readonly awk grep && then sed "$1" readonly --verbose
+awk -eu awk && local -eu | 2>/dev/null then grep
+/usr/bin done cd printf 2>/dev/null /usr/bin
+		local export "$@" awk "$1"
+	printf export cd then export then $(pwd) test printf ${HOME}
+sed /usr/bin awk awk "$@" echo "$@"
+		grep /usr/bin 2>/dev/null 'quoted text' "$1" readonly done &&
+		$(pwd) 2>/dev/null cd done $(pwd) cd echo ${HOME} grep printf --verbose
+	then cd x=1 && /usr/bin 'quoted text' test "$1"
+	&& ${HOME} cd readonly
+then local local "$1" $(pwd) local awk sed test then ${HOME} then -eu
+		"$1" then export 2>/dev/null && "$1" -eu
+	sed x=1 grep grep $(pwd) export ${HOME} done $(pwd) test printf readonly "$@" "$1"
+		'quoted text' --verbose "$1" echo
+		printf x=1 then local && echo export "$@" $(pwd) readonly
+	echo /usr/bin | ${HOME} 'quoted text'
+		awk grep x=1 cd ${HOME} done 2>/dev/null
+${HOME} printf test 'quoted text' done cd readonly then 'quoted text'
+	2>/dev/null --verbose "$1" && ${HOME}
+		sed x=1 $(pwd) 'quoted text' 2>/dev/null printf $(pwd) local local
+| grep sed echo done export sed then /usr/bin 'quoted text' /usr/bin grep
+		"$1" x=1 cd /usr/bin test echo $(pwd)
+| echo local printf local printf echo export
+export readonly "$1" 'quoted text' ${HOME} echo echo 'quoted text' then printf
+	--verbose 2>/dev/null echo test cd cd 2>/dev/null
+	cd grep export $(pwd) --verbose done --verbose /usr/bin local then awk
+		sed echo 2>/dev/null readonly cd
+	export x=1 done $(pwd)
+		-eu -eu ${HOME} awk done
+	"$@" $(pwd) -eu $(pwd)
+	| grep $(pwd) ${HOME} && readonly readonly then printf echo /usr/bin
+-eu export local done --verbose -eu "$@" export --verbose done $(pwd) -eu x=1 done
+readonly 2>/dev/null sed | |
+		'quoted text' awk then readonly local 2>/dev/null
+	local "$1" readonly sed "$1" echo awk cd x=1 grep
+		echo /usr/bin readonly 'quoted text' "$1" ${HOME} && x=1 'quoted text' && /usr/bin
+'quoted text' "$1" readonly
+	echo /usr/bin cd printf && 'quoted text' sed "$@" $(pwd) echo done readonly
+		awk -eu test "$1" --verbose
+done 'quoted text' sed x=1 sed --verbose then ${HOME} "$1" export &&
+	-eu echo export | | --verbose readonly /usr/bin
+	then "$@" echo /usr/bin grep $(pwd) x=1 /usr/bin then export
+		2>/dev/null $(pwd) ${HOME} && &&
+test $(pwd) echo readonly && 2>/dev/null grep cd /usr/bin
+		x=1 done awk readonly "$1" then test ${HOME} ${HOME} grep readonly
+export local cd /usr/bin printf "$@" &&
+		done done export -eu -eu local | echo grep x=1 2>/dev/null
+		"$1" export "$@" 'quoted text'
+	$(pwd) test $(pwd) -eu echo grep
+		"$1" export local 2>/dev/null "$@" readonly readonly export $(pwd) "$@"
+	readonly sed then $(pwd) 2>/dev/null ${HOME} cd $(pwd) echo -eu | export
+	-eu printf grep | 'quoted text' echo x=1 -eu 2>/dev/null readonly local local "$1"
+	2>/dev/null x=1 sed cd 2>/dev/null | -eu | readonly cd ${HOME} printf && awk
+export && x=1 "$@" echo export --verbose then echo printf ${HOME} local grep /usr/bin
+	grep | echo sed && done readonly awk | done && $(pwd)
+done test printf cd --verbose | echo test x=1 /usr/bin echo awk then &&
+		readonly export printf
+sed echo ${HOME} grep --verbose /usr/bin x=1 -eu then
+	test grep grep echo done local grep && done $(pwd)
+test 'quoted text' done | x=1 echo local awk -eu then sed local then "$1" cd $(pwd)
+		awk /usr/bin sed && local ${HOME} ${HOME}
+${HOME} -eu done $(pwd) sed -eu --verbose "$@" local
+		grep --verbose cd $(pwd) | cd
+		readonly sed "$@" /usr/bin local && && printf 'quoted text' && echo readonly
+		2>/dev/null && -eu $(pwd) sed "$@" grep local 'quoted text' export cd cd | && readonly
+	"$1" grep -eu sed -eu ${HOME} echo ${HOME} done echo awk | test -eu "$@"
+		| readonly export sed $(pwd) | local sed done "$@" "$1"
+	readonly --verbose then -eu "$@" && done test /usr/bin local /usr/bin
+--verbose "$@" export /usr/bin ${HOME} --verbose grep 'quoted text'
+	'quoted text' awk sed 2>/dev/null
+		printf readonly sed readonly sed "$1" x=1 grep $(pwd) "$1" readonly sed -eu
+		/usr/bin --verbose export ${HOME}
+	&& awk "$1" --verbose "$@"
+		cd $(pwd) export local ${HOME}
+		/usr/bin sed "$1" -eu echo awk local "$1"
+-eu 'quoted text' 'quoted text' -eu 2>/dev/null test echo "$1" printf sed export
+	"$@" "$@" sed ${HOME} x=1 --verbose test | ${HOME} 2>/dev/null test printf
+		local --verbose echo ${HOME} 'quoted text'
+		awk /usr/bin --verbose x=1 ${HOME} | readonly $(pwd)
+	then && printf sed "$1" printf --verbose 2>/dev/null 2>/dev/null ${HOME}
+export /usr/bin ${HOME} sed cd printf cd done printf
+		awk | x=1 2>/dev/null cd echo cd readonly grep
+x=1 x=1 test echo test echo 'quoted text'
+	x=1 | -eu echo sed /usr/bin $(pwd) 2>/dev/null test
+printf 2>/dev/null /usr/bin x=1 | | /usr/bin -eu 2>/dev/null
+| /usr/bin -eu awk printf "$@" ${HOME} done x=1 && -eu printf local sed
+		x=1 echo echo ${HOME} && test "$1" 2>/dev/null --verbose
+	test printf test x=1 cd ${HOME}
+'quoted text' sed "$1" grep printf echo --verbose -eu ${HOME} -eu cd printf
+	then "$@" echo 2>/dev/null
+		awk --verbose "$@" /usr/bin echo x=1 cd local
+	x=1 sed local readonly awk readonly && sed then test ${HOME} test x=1
+then grep "$@" ${HOME} sed 'quoted text' x=1 grep -eu "$@"
+	--verbose done awk grep 2>/dev/null grep printf sed --verbose "$@" printf printf
+	--verbose local $(pwd) cd export $(pwd)
+then done 'quoted text' export && printf test
+/usr/bin ${HOME} -eu /usr/bin | ${HOME} test test
+	readonly grep then | -eu local "$1" | then
+awk 2>/dev/null test done | done
+		"$@" $(pwd) --verbose printf | -eu "$@" && && ${HOME}
+		"$1" && grep ${HOME} 2>/dev/null "$1" local "$@" then done | readonly
+	echo awk 'quoted text' | grep readonly sed awk export local local
+	--verbose done done /usr/bin awk export "$1" echo | readonly "$1" echo
+		${HOME} 'quoted text' export
+		test grep export readonly grep x=1 && done readonly
+	echo export --verbose local readonly sed then awk x=1 cd | printf
+	test export --verbose
+		readonly "$1" test $(pwd) echo "$@" awk && test then ${HOME} --verbose printf
+	2>/dev/null && local x=1 |
+export grep && then "$@" sed
+		printf 2>/dev/null awk "$@" ${HOME} echo cd --verbose
+2>/dev/null && done "$1" "$1" sed then 2>/dev/null test ${HOME}
+2>/dev/null export done /usr/bin local
+	/usr/bin "$1" "$1" done 'quoted text' export |
+		'quoted text' grep $(pwd) /usr/bin grep
+	$(pwd) local readonly readonly /usr/bin test
+	-eu /usr/bin "$1" && grep "$1" && | "$1" grep awk test ${HOME} then
+	echo local -eu "$1" | "$1" grep -eu $(pwd) local "$@"
+		-eu grep cd local "$@" readonly export "$1"
+export export export test x=1
+		grep "$@" export printf --verbose x=1 | export local -eu /usr/bin local
+		2>/dev/null x=1 readonly
+	/usr/bin export sed 'quoted text' "$@" awk awk /usr/bin
+local 'quoted text' cd $(pwd) cd readonly --verbose echo cd x=1 readonly $(pwd)
+		'quoted text' ${HOME} /usr/bin then readonly printf
+	grep printf grep /usr/bin export && "$1" -eu -eu "$@"
+printf 2>/dev/null local
+	/usr/bin local $(pwd) "$1" && awk "$1" grep printf
+	2>/dev/null test echo then export readonly
+	${HOME} cd grep done cd cd ${HOME} | done
+2>/dev/null printf printf awk ${HOME} ${HOME}
+		local ${HOME} readonly /usr/bin "$1" 'quoted text'
+-eu grep local 2>/dev/null -eu | awk && awk readonly
+		awk && printf cd test echo awk awk readonly readonly /usr/bin local &&
+	echo 'quoted text' "$1" grep ${HOME} | $(pwd) awk 2>/dev/null
+/usr/bin 'quoted text' -eu export then /usr/bin --verbose
+	'quoted text' | $(pwd) done readonly export export x=1 --verbose ${HOME} /usr/bin
+	"$1" then "$1" 2>/dev/null "$@" && test 2>/dev/null "$@" x=1 && x=1 done test local
+"$1" 'quoted text' export 2>/dev/null done test 2>/dev/null
+echo ${HOME} then ${HOME} ${HOME} 2>/dev/null --verbose
+		readonly awk readonly echo "$@" grep | then x=1 printf -eu local printf
+		test test cd | 'quoted text' local awk done
+	local export $(pwd) /usr/bin
+	| then sed cd 2>/dev/null $(pwd) awk "$1"
+${HOME} --verbose "$1" done 2>/dev/null then echo --verbose
+2>/dev/null $(pwd) printf test ${HOME}
+	2>/dev/null ${HOME} local then grep test
+	grep export ${HOME} && 2>/dev/null | done sed then "$1" --verbose
+	done ${HOME} grep printf grep local "$@"
+	--verbose "$@" awk 2>/dev/null "$@"
+	then x=1 printf $(pwd) -eu awk --verbose "$1" | --verbose
+sed 'quoted text' && test cd
+	done printf then grep -eu -eu echo | $(pwd) && ${HOME} 'quoted text' 2>/dev/null
+2>/dev/null sed printf --verbose --verbose
+-eu awk 'quoted text' sed "$1" export $(pwd)
+	awk done | x=1 x=1 --verbose test "$@" ${HOME} /usr/bin ${HOME}
+	"$1" ${HOME} grep "$1" 2>/dev/null
+	${HOME} x=1 x=1 awk readonly 'quoted text' 2>/dev/null $(pwd) printf $(pwd)
+	&& && -eu $(pwd) ${HOME} "$1" /usr/bin $(pwd) done
+	$(pwd) ${HOME} ${HOME} -eu grep
+-eu $(pwd) test "$@" $(pwd) && echo sed
+cd awk printf && && then then awk -eu $(pwd) cd readonly
+	${HOME} done "$1" cd "$1" $(pwd)
+-eu | readonly done test awk sed x=1
+2>/dev/null cd sed grep export "$@" $(pwd) $(pwd) done cd awk -eu printf
+	grep | "$1" local /usr/bin test x=1 local local then x=1 grep 2>/dev/null
+		sed awk "$@" sed "$1" done /usr/bin
+		export -eu printf ${HOME} cd | then "$@" readonly printf && /usr/bin
+		done x=1 "$@" local 2>/dev/null echo $(pwd) sed cd echo
+		export local readonly /usr/bin awk --verbose /usr/bin awk --verbose 'quoted text'
+--verbose && | 'quoted text' readonly done then --verbose -eu 'quoted text'
+		export done 2>/dev/null grep 'quoted text' sed readonly test cd echo
+printf export echo -eu readonly then sed cd done export done
+	$(pwd) /usr/bin echo 2>/dev/null sed echo "$1" $(pwd)
+	local then -eu grep x=1 'quoted text' export awk | cd cd 2>/dev/null
+		awk ${HOME} /usr/bin "$1"
+	-eu test -eu "$@" -eu && $(pwd)
+		readonly --verbose "$1" x=1 grep then export 2>/dev/null grep | --verbose
+		/usr/bin && $(pwd) && ${HOME}
+	awk local done "$@" "$@" $(pwd) done grep done awk done
+done readonly test printf 2>/dev/null done && -eu then readonly --verbose
+	"$1" readonly x=1 then "$@" cd cd printf then 'quoted text' $(pwd) $(pwd) test
+-eu x=1 "$@" x=1 echo "$1" local | $(pwd) 'quoted text' grep 'quoted text'
+	export sed 'quoted text' && 2>/dev/null then && "$@" "$1" awk local
+	${HOME} 'quoted text' export sed ${HOME} done printf awk && export
+echo $(pwd) /usr/bin test done echo done "$@" test done | done export
+	&& | --verbose local /usr/bin && local test readonly
+${HOME} 2>/dev/null awk x=1 printf /usr/bin sed local local 'quoted text'
+${HOME} --verbose 'quoted text' 2>/dev/null --verbose sed "$@"
+		grep | --verbose readonly
+		x=1 local test sed test $(pwd) "$1" &&
+	sed grep /usr/bin done export ${HOME} --verbose sed printf
+x=1 /usr/bin cd "$@" && x=1 2>/dev/null export --verbose
+		2>/dev/null local local 2>/dev/null export sed 2>/dev/null grep ${HOME}
+		--verbose test grep printf done /usr/bin
+		2>/dev/null printf done x=1 echo $(pwd) export printf
+test 2>/dev/null export local printf grep awk -eu readonly
+printf ${HOME} | then
+	--verbose sed grep ${HOME} -eu
+grep "$@" cd readonly "$@" /usr/bin cd printf printf
+		| x=1 sed | ${HOME} readonly | grep awk /usr/bin local 'quoted text'
+	done 2>/dev/null echo 'quoted text' x=1 sed done printf /usr/bin
+	echo && /usr/bin "$@" ${HOME} test
+	$(pwd) --verbose echo 2>/dev/null sed /usr/bin /usr/bin echo then |
+done echo sed cd && readonly 2>/dev/null
+${HOME} | /usr/bin ${HOME} readonly
+		printf x=1 ${HOME} --verbose done 'quoted text' | -eu ${HOME} then printf
+	$(pwd) local printf "$@" "$@"
+		done printf printf readonly /usr/bin export then then
+		local -eu printf local
+	"$1" && ${HOME} | echo then done /usr/bin
+sed cd 'quoted text' cd cd | sed x=1 awk ${HOME}
+	--verbose -eu /usr/bin "$1" --verbose
+grep ${HOME} then -eu "$1" 2>/dev/null local $(pwd)
+		grep /usr/bin "$@" local -eu "$@"
+	| export && readonly 2>/dev/null
+export -eu && -eu ${HOME} printf $(pwd)
+		| sed 'quoted text' "$@" printf 'quoted text' | local readonly done
+		local test "$@" x=1 $(pwd) sed test done printf "$1" sed 2>/dev/null
+	--verbose sed export | cd readonly "$1"
+	"$1" "$1" ${HOME} x=1 | "$1" local
+	export grep printf $(pwd) && --verbose
+		--verbose test --verbose $(pwd) "$1"
+-eu echo local done "$@" "$@" grep echo 'quoted text'
+echo echo -eu awk sed -eu export "$@" printf
+		| $(pwd) 'quoted text' 2>/dev/null
+awk 'quoted text' readonly /usr/bin readonly $(pwd) cd awk local "$1" $(pwd) printf
+| "$1" grep awk && printf test export done --verbose -eu local
+		awk sed | ${HOME} && ${HOME} test /usr/bin test
+--verbose && "$1" "$@" --verbose "$1" sed grep --verbose x=1 'quoted text' &&
+/usr/bin 'quoted text' --verbose done echo "$@" x=1 grep done export readonly cd
+sed "$1" awk awk "$@" export readonly
+awk ${HOME} "$@" -eu 2>/dev/null cd printf x=1 readonly
+		then "$@" readonly grep
+local "$1" grep $(pwd) && && --verbose --verbose
+	cd export grep test test && x=1 local
+	-eu printf /usr/bin echo /usr/bin grep -eu x=1 printf "$@" 'quoted text'
+local then sed grep ${HOME} -eu $(pwd) readonly sed -eu echo $(pwd) test cd printf
+	"$@" grep 2>/dev/null
+	awk "$1" test cd x=1 --verbose 2>/dev/null --verbose
+| 2>/dev/null cd 'quoted text' echo done | | /usr/bin done cd export
+		done x=1 export x=1 x=1 then $(pwd) sed awk readonly
+readonly 'quoted text' local grep grep local 2>/dev/null &&
+		2>/dev/null printf --verbose "$1" then /usr/bin
+	&& "$@" 'quoted text' done 2>/dev/null 'quoted text' "$@"
+	export grep cd | local export "$@" | x=1 export test awk "$@" grep echo
+		--verbose x=1 -eu local 'quoted text' -eu ${HOME} $(pwd) $(pwd) awk &&
+		"$1" test 2>/dev/null 'quoted text' local grep
+"$1" grep ${HOME} && sed --verbose | echo $(pwd) test -eu && x=1 sed
+"$1" export echo readonly "$1" local ${HOME} -eu awk ${HOME} awk ${HOME} echo
+	/usr/bin "$@" && "$1" "$1" x=1 local 2>/dev/null cd local ${HOME} readonly
+		${HOME} 'quoted text' /usr/bin $(pwd) readonly 'quoted text' printf
+cd awk /usr/bin then printf "$@" -eu done x=1 then
+		printf && then /usr/bin export
+	-eu ${HOME} grep -eu awk 'quoted text' export "$1" test /usr/bin readonly
+	--verbose echo "$1" then -eu awk $(pwd) cd ${HOME} printf -eu 'quoted text'
+	2>/dev/null awk then echo -eu then
+		--verbose /usr/bin ${HOME}
+	"$1" $(pwd) && readonly cd readonly local $(pwd) echo grep printf --verbose x=1
+	readonly 2>/dev/null awk sed readonly --verbose awk readonly /usr/bin "$1"
+		awk 2>/dev/null done then && 2>/dev/null --verbose --verbose -eu && test readonly
+x=1 | ${HOME} test printf $(pwd) $(pwd)
+	done 'quoted text' readonly -eu echo "$1" test ${HOME} echo done echo /usr/bin
+${HOME} done 2>/dev/null /usr/bin -eu x=1 | done sed "$@" 2>/dev/null &&
+	then local && sed -eu && "$1" "$@" awk then -eu then
+done sed $(pwd) echo sed 2>/dev/null
+	--verbose sed 'quoted text' x=1 awk
+echo $(pwd) && 'quoted text' -eu readonly
+	sed printf echo --verbose "$1"
+awk /usr/bin 'quoted text' test sed "$@" readonly --verbose
+	"$@" "$@" && "$@" done "$@" test 'quoted text' grep awk
+--verbose sed "$@" export /usr/bin
+		'quoted text' echo awk grep
+	sed cd readonly 2>/dev/null export sed test grep "$@" grep | && then readonly
+	"$@" 'quoted text' echo ${HOME} echo printf --verbose test
+&& | $(pwd) 2>/dev/null | /usr/bin -eu awk awk
+	awk awk $(pwd) cd 2>/dev/null printf /usr/bin done -eu $(pwd) printf test | echo
+		${HOME} | export local done readonly /usr/bin
+		cd sed readonly echo local awk test cd /usr/bin local readonly | $(pwd) 'quoted text'
+		printf "$1" printf grep /usr/bin
+2>/dev/null export | awk x=1 readonly readonly "$@" printf readonly
+		grep then readonly 'quoted text' $(pwd) echo
+'quoted text' /usr/bin readonly 2>/dev/null 2>/dev/null readonly done
+cd echo /usr/bin grep readonly "$1" grep readonly local readonly
+sed awk x=1 x=1 awk 'quoted text'
+		"$1" --verbose awk test -eu 'quoted text'
+		grep awk --verbose --verbose --verbose | ${HOME} grep export
+$(pwd) awk --verbose awk test /usr/bin then --verbose $(pwd) ${HOME}
+printf && && $(pwd) export ${HOME} readonly awk ${HOME} -eu 2>/dev/null 2>/dev/null
+readonly cd local --verbose | sed
+		"$@" cd echo sed --verbose "$@" test awk echo
+readonly "$@" /usr/bin /usr/bin 'quoted text' export
+--verbose echo grep 2>/dev/null --verbose | export "$@"
+	-eu $(pwd) printf export echo cd | local && printf 'quoted text'
+awk x=1 cd printf readonly echo export
+	export $(pwd) | readonly awk && local | 2>/dev/null printf && then local
+		export readonly grep readonly "$@"
+		test -eu export then "$1" "$@" $(pwd) 'quoted text' | grep grep $(pwd) cd printf
+		$(pwd) test "$@" /usr/bin 'quoted text'
+		&& 'quoted text' x=1 "$@" local grep local sed grep done awk | done
+echo | 2>/dev/null --verbose done |
+		--verbose done export test grep 'quoted text' ${HOME} 2>/dev/null | readonly
+	then export sed test export sed "$1" grep /usr/bin -eu echo 'quoted text'
+	| export grep | sed 2>/dev/null ${HOME} printf "$1" --verbose
+x=1 --verbose -eu then
+		--verbose "$@" "$1" /usr/bin
+'quoted text' 'quoted text'
+	local grep echo echo cd /usr/bin done echo -eu -eu
+	echo echo readonly $(pwd) done $(pwd) $(pwd) 2>/dev/null cd done "$1" ${HOME} /usr/bin
+		test 'quoted text' 'quoted text' "$1" echo $(pwd) cd $(pwd)
+x=1 printf readonly readonly readonly readonly $(pwd) cd test then "$1" --verbose
+	'quoted text' $(pwd) ${HOME} echo --verbose | && x=1 local --verbose "$@" cd &&
+	awk grep "$1" /usr/bin -eu grep echo readonly awk printf cd readonly
+$(pwd) grep sed x=1 done awk "$1" then export ${HOME}
+&& done awk "$1" /usr/bin 2>/dev/null echo /usr/bin --verbose
+done export echo --verbose done grep /usr/bin test
+		readonly 'quoted text' export x=1 grep 'quoted text' 'quoted text' -eu ${HOME}
+	"$@" 2>/dev/null && grep cd x=1 | --verbose echo
+grep local 'quoted text' | then test local && "$@" | test
+| && --verbose local /usr/bin
+cd 'quoted text' -eu -eu grep sed done | 2>/dev/null --verbose "$1" export
+"$@" local | test awk && local
+readonly ${HOME} cd $(pwd) | --verbose x=1 printf "$1" done
+	sed --verbose printf "$1" test done 2>/dev/null && done
+cd cd echo awk echo -eu awk echo $(pwd) done "$@" 'quoted text'
+	then ${HOME} x=1 "$1" --verbose "$@" sed
+		'quoted text' /usr/bin && sed echo awk
+	readonly test echo grep -eu local
+		then 'quoted text' | --verbose && test --verbose && printf
+	then echo local "$1" -eu "$@" -eu done $(pwd) export
+	done 'quoted text' ${HOME} local cd --verbose printf 2>/dev/null && ${HOME} /usr/bin
+		echo sed -eu echo ${HOME} "$@" ${HOME} test ${HOME} local local
+	echo --verbose export local
+$(pwd) 'quoted text' awk test --verbose $(pwd) | done export echo export
+	x=1 test ${HOME} $(pwd) 2>/dev/null sed cd sed printf
+then --verbose then then | readonly /usr/bin
+		&& | cd "$@" -eu "$1" done 2>/dev/null 'quoted text'
+		&& printf --verbose &&
+		sed grep -eu sed export -eu "$1" readonly
+then test done 'quoted text' export sed echo x=1 "$@"
+awk local "$1" grep done awk then --verbose sed 'quoted text' | done ${HOME} sed
+	/usr/bin then sed readonly "$@"
+	2>/dev/null printf test local -eu sed
+	/usr/bin | printf "$1" printf test sed grep | then 'quoted text'
+		grep 2>/dev/null then cd
+${HOME} 'quoted text' cd grep -eu --verbose printf
+		then cd local done x=1 local "$@" "$1" then echo | done
+cd 'quoted text' then
+		| "$1" grep done echo
+		cd awk grep $(pwd) "$@" grep "$@" test export 2>/dev/null export
+	'quoted text' $(pwd) test export local $(pwd) awk cd export awk done
+	/usr/bin -eu $(pwd) 2>/dev/null
+	export echo then && $(pwd) 2>/dev/null x=1 export
+		"$@" sed $(pwd) "$@" done "$@" export /usr/bin awk ${HOME} -eu cd $(pwd) | |
+readonly 'quoted text' 'quoted text'
+		sed cd readonly export
+	awk then echo -eu echo && x=1 /usr/bin sed 2>/dev/null $(pwd)
+	x=1 printf local --verbose echo
+	test /usr/bin printf test cd "$@" --verbose "$1" export 2>/dev/null
+grep | x=1 'quoted text' sed "$@" -eu local "$1" ${HOME} awk grep ${HOME}
+2>/dev/null grep done cd readonly $(pwd) "$1" /usr/bin then "$@" 2>/dev/null
+		echo readonly cd --verbose
+x=1 cd grep | printf test "$@" echo done "$1"
+"$@" ${HOME} -eu --verbose | && export
+readonly | "$@" 'quoted text' done "$@"
+		'quoted text' ${HOME} awk "$@" "$@" && echo ${HOME} readonly
+echo echo readonly x=1 && && grep echo echo 2>/dev/null "$@"
+		test export 'quoted text' -eu
+		--verbose grep test echo -eu then test local echo sed readonly
+		$(pwd) | export printf done awk done
+&& test printf /usr/bin cd awk | readonly done "$1" cd 2>/dev/null
+		echo "$1" local && 'quoted text'
+then && printf "$1" export 'quoted text' readonly -eu printf x=1 then "$1"
+		"$@" echo awk done sed test local --verbose then "$@" $(pwd) 2>/dev/null
+	$(pwd) $(pwd) | --verbose /usr/bin then printf awk /usr/bin
+--verbose export "$1" $(pwd) -eu ${HOME}
+		"$1" sed export "$1" /usr/bin "$@"
+		-eu local test export "$@" echo -eu local readonly
+		local awk export local done done x=1 /usr/bin done $(pwd) readonly --verbose
+local ${HOME} --verbose printf awk sed
+readonly export -eu ${HOME} test export echo | export cd && /usr/bin readonly
+		export test && -eu "$1" sed /usr/bin test /usr/bin grep | printf cd
+		grep awk cd | readonly grep -eu 'quoted text'
+		$(pwd) "$@" 2>/dev/null readonly echo 2>/dev/null 2>/dev/null
+x=1 $(pwd) | $(pwd) echo awk 'quoted text' printf
+		done /usr/bin done && "$@" grep "$@" ${HOME} /usr/bin
+	readonly && test $(pwd) sed 'quoted text' export readonly --verbose
+/usr/bin "$@" export $(pwd) 'quoted text' echo "$1" export export
+	2>/dev/null | "$@" then x=1 test export "$@" "$1" export "$@" sed --verbose
+	"$1" | readonly 2>/dev/null done ${HOME} sed echo test export local 'quoted text'
+	'quoted text' cd && test awk x=1 --verbose
+$(pwd) then done ${HOME}
+		awk -eu "$@" done 'quoted text' 2>/dev/null /usr/bin | echo | export
+"$1" /usr/bin readonly 'quoted text' export echo && /usr/bin readonly
+		/usr/bin local "$@" cd awk && export sed test ${HOME} $(pwd)
+/usr/bin test x=1 export 'quoted text' && readonly /usr/bin "$1" | local local
+		then "$1" cd $(pwd) && test "$@" echo done "$@" | --verbose
+local echo "$1" /usr/bin test /usr/bin
+		readonly sed sed local echo $(pwd) --verbose -eu readonly $(pwd)
+		&& grep printf $(pwd) done
+		printf echo /usr/bin done printf echo awk cd | /usr/bin sed
+		--verbose 'quoted text' done 'quoted text' 2>/dev/null
+	grep $(pwd) done | grep $(pwd) export awk awk | then 2>/dev/null
+		then $(pwd) sed ${HOME} ${HOME} --verbose
+	echo local "$1" local export 2>/dev/null awk echo
+	readonly done | "$1" readonly
+export grep ${HOME} local /usr/bin local done grep -eu /usr/bin readonly
+export then "$@" "$1" "$@" grep "$1" "$@" "$@" | then local grep "$@"
+		'quoted text' readonly local ${HOME} &&
+done "$@" "$1" echo grep "$1" echo x=1 2>/dev/null 2>/dev/null --verbose
+echo export export -eu awk test sed export ${HOME}
+		echo 'quoted text' | "$@"
+grep echo 2>/dev/null "$1" grep 2>/dev/null "$1" test 2>/dev/null | 2>/dev/null
+export ${HOME} readonly 'quoted text' test awk 2>/dev/null
+"$1" done export --verbose awk ${HOME} "$1" 'quoted text'
+		2>/dev/null grep echo readonly
+		export "$@" cd sed readonly 2>/dev/null sed $(pwd)
+		printf test | $(pwd) -eu -eu | test printf echo ${HOME} test cd printf
+		export export "$1" -eu 'quoted text' awk printf grep -eu grep "$1"
+	-eu printf 'quoted text' | cd "$1" $(pwd) /usr/bin 'quoted text'
+	2>/dev/null readonly local 2>/dev/null
+		echo $(pwd) local ${HOME} echo && "$1" cd --verbose
+test | export 'quoted text' export local echo ${HOME}
+		echo done test && /usr/bin
+	then -eu "$@" "$1" | 2>/dev/null printf
+		test | local sed echo readonly | then 2>/dev/null ${HOME} test 'quoted text'
+		sed 'quoted text' echo "$@" grep then 2>/dev/null
+		grep ${HOME} $(pwd) cd echo readonly |
+${HOME} readonly echo $(pwd) export
+		2>/dev/null local ${HOME} local
+	awk export x=1 2>/dev/null "$1" then $(pwd) sed export && |
+"$1" printf sed $(pwd) grep
+		-eu | "$@" readonly "$@" echo 2>/dev/null
+		echo | && $(pwd) awk export grep cd local 'quoted text' x=1
+awk -eu 2>/dev/null "$@" x=1 "$@" cd echo ${HOME} x=1 then local x=1 && | local
+	awk cd x=1 && --verbose done
+		"$@" && export echo /usr/bin "$@" local local then cd -eu 2>/dev/null
+		local 'quoted text' && "$@" && cd | -eu sed "$@" cd $(pwd) 2>/dev/null
+then done ${HOME} && awk readonly
+		-eu test cd local 2>/dev/null
+		cd echo "$1" sed grep then sed grep ${HOME} printf export "$@" 2>/dev/null x=1
+x=1 grep --verbose ${HOME} -eu sed sed then then |
+		&& "$@" 2>/dev/null --verbose export "$1" x=1
+	export readonly grep ${HOME}
+		done 2>/dev/null $(pwd) | --verbose then x=1 2>/dev/null
+	'quoted text' awk $(pwd)
+x=1 | cd sed --verbose "$@" awk x=1 export $(pwd) -eu && --verbose local
+	$(pwd) -eu | then /usr/bin readonly printf sed $(pwd)
+printf x=1 "$1" 'quoted text' "$1" 'quoted text' 2>/dev/null local export
+${HOME} sed --verbose printf echo x=1 test echo --verbose
+"$@" sed test && sed echo 2>/dev/null
+	cd local readonly then test test cd echo --verbose /usr/bin awk export cd
+		readonly then done printf | cd export sed "$@" grep x=1
+	awk && echo done awk ${HOME} done "$1"
+	/usr/bin local local "$1" 'quoted text' echo
+		-eu && cd x=1 sed && $(pwd) export
+		then cd $(pwd) "$@" ${HOME} && | -eu
+		test $(pwd) done -eu -eu /usr/bin
+		$(pwd) ${HOME} 'quoted text' printf
+		/usr/bin /usr/bin | grep 2>/dev/null then awk "$@" --verbose x=1
+		then export readonly && cd export && x=1 echo then /usr/bin
+		readonly 2>/dev/null 'quoted text' &&
+	${HOME} | | "$@" export 2>/dev/null test
+		awk | sed export $(pwd) /usr/bin -eu echo then
+x=1 awk echo grep grep 'quoted text'
+		"$@" done done 2>/dev/null
+echo $(pwd) sed 2>/dev/null awk then /usr/bin
+		x=1 2>/dev/null done --verbose printf $(pwd) echo then 2>/dev/null readonly then
+		"$@" 2>/dev/null printf /usr/bin done
+&& /usr/bin -eu -eu /usr/bin
+	local x=1 then && 2>/dev/null 2>/dev/null grep x=1 /usr/bin x=1 awk
+		--verbose ${HOME} readonly /usr/bin
+		readonly done local then cd /usr/bin $(pwd) grep "$@" | echo cd printf
+		'quoted text' ${HOME} printf ${HOME} cd awk "$1" | $(pwd) local "$1" test
+	$(pwd) | printf ${HOME} "$1" export | cd x=1 test printf then
+		x=1 done awk /usr/bin ${HOME} ${HOME} --verbose echo "$1" export printf awk /usr/bin
+		readonly /usr/bin grep 'quoted text' "$@" | ${HOME} 2>/dev/null
+		'quoted text' "$1" done /usr/bin 'quoted text'
+	printf 2>/dev/null 2>/dev/null grep x=1 2>/dev/null x=1 echo
+	$(pwd) ${HOME} sed /usr/bin test "$1"
+2>/dev/null export echo grep -eu local
+		then then && grep printf sed ${HOME}
+awk --verbose readonly grep cd /usr/bin echo --verbose
+"$1" echo sed local printf sed readonly 'quoted text'
+awk printf awk /usr/bin | ${HOME} then /usr/bin grep |
+		-eu | | then readonly then "$@" export "$1" done readonly
+${HOME} sed $(pwd) cd "$1" sed then local x=1
+	-eu --verbose local done | readonly "$1" /usr/bin
+sed local "$1" echo -eu $(pwd) sed ${HOME} -eu | export && done "$@" then
+echo cd readonly readonly $(pwd) grep cd && -eu sed 2>/dev/null
+-eu /usr/bin local awk x=1 -eu readonly echo && "$@" local grep | grep
+	awk cd --verbose 2>/dev/null cd echo -eu | "$@" readonly cd test
+	$(pwd) "$1" done | $(pwd) && readonly readonly
+echo "$1" 'quoted text' sed "$@" local sed $(pwd) "$1" awk | $(pwd)
+	"$@" grep --verbose local
+		-eu && printf /usr/bin test ${HOME} "$@" 'quoted text'
+		--verbose local 2>/dev/null local readonly && grep ${HOME} | readonly
+		export grep test grep then --verbose
+		${HOME} --verbose readonly ${HOME} cd --verbose 2>/dev/null | sed printf 'quoted text'
+	2>/dev/null done --verbose -eu
+	printf echo local done
+&& x=1 awk local export test 'quoted text' --verbose $(pwd)
+local printf local /usr/bin
+	$(pwd) "$@" | sed "$@" readonly "$1" readonly sed awk $(pwd) "$@" 2>/dev/null
+	readonly sed cd grep 2>/dev/null export
+	-eu printf readonly grep awk printf ${HOME} test -eu | readonly export local $(pwd)
+2>/dev/null then cd sed "$@" "$1" --verbose test 'quoted text' "$1" "$1"
+	test done $(pwd) --verbose printf
+		2>/dev/null done test done --verbose sed printf export test -eu $(pwd) local &&
+readonly export readonly && grep cd cd export echo readonly x=1 -eu x=1 $(pwd)
+		sed then && grep local
+		| "$@" "$@" 'quoted text' --verbose | ${HOME} printf
+	'quoted text' x=1 readonly awk readonly -eu test -eu 2>/dev/null 'quoted text'
+	done && x=1 sed | grep "$1" grep export readonly && printf
+"$1" -eu /usr/bin -eu done echo printf
+	"$@" ${HOME} printf "$@" /usr/bin
+	/usr/bin $(pwd) /usr/bin x=1 echo 'quoted text' export 'quoted text'
+	sed "$@" --verbose readonly x=1 x=1
+	cd done -eu cd -eu echo sed 2>/dev/null grep x=1 | "$1" && test x=1 test
+		then 2>/dev/null && -eu done echo ${HOME} /usr/bin then done grep
+local && 2>/dev/null x=1 "$1"
+	export grep /usr/bin 2>/dev/null 'quoted text' done grep | echo readonly
+	-eu done test $(pwd) | | readonly 'quoted text' echo
+cd test local "$1" $(pwd) x=1 -eu sed awk --verbose /usr/bin && 'quoted text' then
+		sed printf echo echo x=1 $(pwd) /usr/bin echo "$1" printf x=1 | $(pwd)
+-eu 'quoted text' sed -eu && 'quoted text' -eu local --verbose readonly
+	then "$@" 'quoted text' export $(pwd) x=1 "$@" export -eu 'quoted text' export
+	cd 2>/dev/null x=1 printf --verbose
+		/usr/bin x=1 sed --verbose x=1
+		&& test echo awk "$@" 'quoted text' "$1" sed | /usr/bin x=1 readonly readonly
+		local --verbose --verbose awk test "$@" cd $(pwd) 2>/dev/null
+		| -eu ${HOME} -eu && /usr/bin local export
+		x=1 "$1" x=1 grep "$1" then sed $(pwd) x=1 "$1"
+awk readonly grep printf x=1 sed printf "$@" --verbose done printf awk /usr/bin
+'quoted text' test echo -eu ${HOME} printf echo done
+	sed ${HOME} cd local && --verbose
+	export then then grep "$1" | --verbose done 'quoted text' grep awk sed
+	local sed ${HOME} local
+	-eu x=1 awk echo then && "$1" export readonly sed /usr/bin "$1" &&
+		export local 'quoted text'
+echo "$@" $(pwd) "$@" --verbose local sed | done 'quoted text' ${HOME}
+| && then sed $(pwd) then 2>/dev/null test | $(pwd)
+	"$@" x=1 | grep "$@" --verbose /usr/bin local --verbose
+		-eu done awk 2>/dev/null 2>/dev/null sed -eu grep
+		awk then echo readonly && /usr/bin
+-eu ${HOME} echo -eu 'quoted text' "$@" then && sed awk ${HOME} --verbose
+2>/dev/null then --verbose 'quoted text' --verbose
+	&& x=1 readonly ${HOME} 2>/dev/null test sed echo local
+	printf /usr/bin && -eu done -eu | echo awk /usr/bin sed
+&& grep && "$1" awk $(pwd) export echo ${HOME} local test
+		&& readonly 2>/dev/null echo then "$@"
+2>/dev/null cd x=1 $(pwd) | echo && $(pwd) readonly export -eu "$@" "$@" x=1 readonly
+		x=1 "$@" printf 2>/dev/null cd printf
+		"$1" then $(pwd) local awk test "$1" x=1 && $(pwd) readonly $(pwd)
+		echo done then then 'quoted text' local readonly $(pwd)
+		x=1 awk --verbose ${HOME} readonly
+	done sed test printf test
+cd 2>/dev/null export 2>/dev/null -eu readonly "$1"
+		| done sed "$@" awk ${HOME} | sed local | && printf echo /usr/bin
+2>/dev/null $(pwd) done x=1 awk 2>/dev/null printf | readonly "$@" readonly /usr/bin
+		/usr/bin "$1" grep export x=1 'quoted text'
+then echo | readonly ${HOME} export x=1 /usr/bin local printf
+		echo printf readonly $(pwd) ${HOME} readonly ${HOME} $(pwd)
+		x=1 "$@" printf echo sed x=1 'quoted text' echo grep
+		cd "$@" "$@" 'quoted text' 2>/dev/null &&
+$(pwd) && "$@" -eu grep 2>/dev/null x=1 | && && ${HOME} && /usr/bin readonly
+test done 2>/dev/null done then -eu "$@" ${HOME} 'quoted text'
+	${HOME} "$1" -eu done local readonly awk
+${HOME} cd grep readonly readonly ${HOME}
+readonly x=1 && "$1" ${HOME} --verbose ${HOME} local x=1 /usr/bin printf then
+		grep "$@" --verbose printf echo then ${HOME}
+		cd "$1" done 'quoted text' --verbose $(pwd)
+	test cd echo printf --verbose local "$@"
+test && 'quoted text' 2>/dev/null
+		done local echo test 'quoted text' | -eu done printf -eu local cd | done grep
+"$1" then readonly | cd export x=1 ${HOME} && awk done awk 2>/dev/null
+		'quoted text' local echo x=1 --verbose printf echo
+		2>/dev/null test $(pwd) awk echo && "$1"
+	local | /usr/bin sed done echo
+		printf local test cd test ${HOME} ${HOME} awk x=1
+	$(pwd) grep export -eu --verbose && local ${HOME} local -eu --verbose
+then printf && then readonly
+		printf then then sed test local then done 2>/dev/null then /usr/bin
+	x=1 local -eu done local done echo | 2>/dev/null then /usr/bin 'quoted text' readonly
+		echo 'quoted text' "$@" awk 2>/dev/null
+		readonly echo ${HOME} "$@" then x=1 x=1 ${HOME} x=1 readonly
+	grep sed printf $(pwd) "$@" && /usr/bin
+	--verbose sed 2>/dev/null echo echo | ${HOME} $(pwd) 'quoted text'
+		/usr/bin then done done /usr/bin -eu sed "$1" 'quoted text' printf
+		&& cd done printf grep echo -eu | awk /usr/bin "$@" printf echo
+	| readonly grep echo $(pwd) 'quoted text' export "$1" && local |
+	sed grep /usr/bin "$1" cd /usr/bin
+$(pwd) cd awk ${HOME} readonly | export
+		export 'quoted text' cd grep local test local
+	-eu --verbose sed done "$1" readonly && awk
+	printf cd cd grep 'quoted text' awk --verbose 2>/dev/null x=1
+	done test grep then 2>/dev/null printf awk | /usr/bin
+		2>/dev/null export 'quoted text' --verbose then x=1 $(pwd) awk /usr/bin
+	$(pwd) grep export readonly ${HOME} "$@" x=1 local | "$@"
+		/usr/bin grep "$1" 'quoted text' /usr/bin "$@"
+		grep test readonly cd local test awk test printf done readonly readonly 'quoted text'
+	'quoted text' && sed | done | test | test test 'quoted text'
+		"$1" sed 'quoted text' /usr/bin export local 2>/dev/null cd 'quoted text' --verbose
+awk local $(pwd) echo 'quoted text' test && x=1 -eu printf -eu printf
+		awk printf -eu "$@" grep cd && echo | && $(pwd) grep cd echo test
+	x=1 x=1 $(pwd) then && $(pwd)
+${HOME} sed then done export --verbose test cd local ${HOME} cd awk 'quoted text'
+	cd awk && awk -eu cd | printf | "$@" 'quoted text'
+		cd grep --verbose x=1 x=1 local readonly grep export local
+$(pwd) 2>/dev/null local --verbose cd | readonly cd then then readonly
+${HOME} 2>/dev/null sed readonly 2>/dev/null
+-eu -eu export readonly done test
+	&& ${HOME} awk 2>/dev/null awk then $(pwd) 'quoted text'
+	'quoted text' awk sed -eu awk readonly /usr/bin
+readonly readonly sed grep 2>/dev/null -eu done
+echo /usr/bin test test readonly local 2>/dev/null
+	'quoted text' && /usr/bin echo readonly "$1" awk ${HOME}
+	test grep ${HOME} done "$1" 2>/dev/null | 'quoted text' test $(pwd)
+2>/dev/null --verbose then /usr/bin test readonly grep 'quoted text'
+	readonly -eu $(pwd) local /usr/bin "$@" readonly x=1 'quoted text'
+${HOME} /usr/bin cd "$1" cd 2>/dev/null |
+	${HOME} test readonly echo "$1" done 'quoted text' /usr/bin "$1"
+		export export 'quoted text' test cd "$@" local "$1"
+		readonly local /usr/bin 2>/dev/null
+	--verbose sed sed --verbose --verbose export 2>/dev/null awk sed && 'quoted text'
+	x=1 echo sed "$1" ${HOME} sed && test cd -eu readonly
+	| readonly "$@" && x=1 grep local printf echo sed 2>/dev/null then grep
+		echo "$@" "$1" -eu ${HOME} export 2>/dev/null x=1 2>/dev/null test local
+		local sed grep | echo /usr/bin test grep | then awk && "$@" /usr/bin /usr/bin readonly
+	"$1" grep echo && then ${HOME} --verbose done x=1 | grep x=1 "$@" awk
+		test ${HOME} grep $(pwd) export cd 2>/dev/null grep | done test x=1 grep $(pwd)
+		x=1 --verbose "$@" echo 2>/dev/null echo readonly --verbose then
+		/usr/bin printf | test printf printf sed printf printf then $(pwd) "$@"
+printf "$@" test "$1"
+		| "$@" "$1" readonly awk ${HOME} -eu printf
+	sed test | -eu -eu export cd awk local readonly
+		2>/dev/null cd then then x=1 test 2>/dev/null grep
+		done echo 2>/dev/null export local
+		-eu local && --verbose "$1" cd ${HOME} --verbose $(pwd) then awk $(pwd) 'quoted text'
+echo awk grep grep printf x=1 sed readonly "$1" awk -eu echo done
+	awk -eu | -eu cd "$@" printf cd local 2>/dev/null ${HOME}
+${HOME} "$@" --verbose awk
+/usr/bin echo ${HOME} 'quoted text' printf awk ${HOME} then 'quoted text' && readonly
+grep then sed ${HOME} done --verbose -eu -eu | local awk readonly "$1"
+export "$@" readonly
+$(pwd) echo grep export
+	2>/dev/null echo | --verbose -eu ${HOME} sed
+	awk ${HOME} 2>/dev/null --verbose
+	--verbose "$@" ${HOME} 'quoted text' --verbose
+		${HOME} done --verbose ${HOME} sed $(pwd) sed readonly done "$1" grep 'quoted text'
+	--verbose -eu 'quoted text' --verbose --verbose done test && /usr/bin
+		${HOME} | grep awk awk $(pwd) /usr/bin sed
+	then grep 2>/dev/null
+"$@" awk done 'quoted text' x=1 cd sed printf test awk echo
+		'quoted text' test $(pwd) "$1" export /usr/bin done 2>/dev/null "$@"
+	/usr/bin printf export $(pwd) $(pwd) echo test /usr/bin then "$1" awk awk
+readonly x=1 | /usr/bin then
+	printf readonly then ${HOME} done local sed && echo sed
+		echo test 2>/dev/null echo && done printf 2>/dev/null sed 2>/dev/null
+	"$1" $(pwd) ${HOME} 2>/dev/null export "$@" cd | export awk sed done then grep
+		x=1 echo echo awk then ${HOME}
+"$@" export grep printf /usr/bin readonly --verbose grep
+cd awk then printf -eu export readonly && "$1" | x=1 $(pwd)
+sed echo local printf cd --verbose sed readonly readonly
+		sed test printf grep 2>/dev/null | 'quoted text'
+		test $(pwd) printf "$1" cd 2>/dev/null readonly
+readonly awk $(pwd) printf
@@ -0,0 +1,2001 @@
+		printf ${HOME} test sed done | done $(pwd) && echo "$@" awk "$@" "$1"
+		grep ${HOME} -eu 2>/dev/null
+		&& "$1" /usr/bin $(pwd) done -eu sed test test 2>/dev/null done readonly grep
+then done -eu awk $(pwd)
+		"$@" export then grep -eu -eu && x=1 'quoted text' test readonly
+	printf grep ${HOME} &&
+	cd x=1 awk "$1" -eu then 2>/dev/null done local "$1" "$1" | grep 'quoted text'
+"$@" | "$1" "$1" echo --verbose export ${HOME} done | export sed 'quoted text'
+then then /usr/bin echo cd grep sed x=1 2>/dev/null &&
+		readonly && | 'quoted text' readonly awk x=1 "$@" grep local /usr/bin --verbose
+	-eu export export readonly --verbose cd ${HOME} | "$@" 2>/dev/null
+		export awk ${HOME} echo echo cd done 'quoted text'
+	"$1" x=1 && 2>/dev/null ${HOME}
+sed $(pwd) --verbose $(pwd) 2>/dev/null test
+	2>/dev/null -eu then | echo cd "$1" grep
+		-eu $(pwd) 2>/dev/null "$@" echo $(pwd) x=1 && ${HOME} && "$1"
+	sed "$1" local /usr/bin "$@" grep echo
+		then done $(pwd) readonly &&
+		printf /usr/bin awk export
+	done /usr/bin export export -eu "$1"
+	printf 'quoted text' printf
+		'quoted text' printf -eu 'quoted text' then "$@" 2>/dev/null
+${HOME} awk 'quoted text' x=1 /usr/bin $(pwd) ${HOME} -eu
+	awk 2>/dev/null --verbose printf "$1"
+	sed test -eu sed cd test printf done
+done && test && | ${HOME} $(pwd) echo export "$1" readonly ${HOME}
+		awk export --verbose --verbose grep local local local x=1
+	x=1 "$1" | done grep /usr/bin && && "$1" sed x=1 && local awk
+		'quoted text' /usr/bin cd
+grep ${HOME} printf 2>/dev/null export /usr/bin | readonly
+		done ${HOME} "$@" awk test /usr/bin
+		&& -eu 2>/dev/null | $(pwd) && done "$@" "$1" "$1" export
+		cd x=1 readonly export && done 2>/dev/null && "$1" echo ${HOME}
+		${HOME} ${HOME} /usr/bin | "$1" test cd | /usr/bin /usr/bin sed "$@" /usr/bin
+"$@" local sed cd done local --verbose | -eu /usr/bin grep
+x=1 printf /usr/bin awk ${HOME} --verbose | then echo "$1" --verbose local
+		done ${HOME} done /usr/bin && export printf done awk export echo | "$@" "$1" export
+	local export readonly 2>/dev/null | $(pwd) sed grep "$@" then "$1" ${HOME} "$1"
+awk "$@" done test && local 'quoted text' cd grep readonly 2>/dev/null then local
+awk && "$@" then awk local sed readonly
+	readonly /usr/bin "$@" readonly "$@" ${HOME} $(pwd) "$@" done echo printf
+	x=1 x=1 local ${HOME} readonly
+		echo -eu then done && sed grep && grep "$1"
+		cd readonly done test export sed local | && then done && then sed test awk
+x=1 local then x=1 2>/dev/null test
+		local local done then sed --verbose sed test --verbose grep
+"$1" printf then local awk -eu 'quoted text' "$@"
+		-eu ${HOME} 'quoted text' readonly
+		local then awk then 'quoted text'
+local --verbose cd x=1 | ${HOME} 2>/dev/null && 'quoted text'
+${HOME} -eu local grep then readonly | test then 2>/dev/null awk --verbose export
+local $(pwd) /usr/bin | x=1 -eu | local echo $(pwd) | grep export
+	"$@" done test sed 'quoted text' /usr/bin --verbose | "$1" local --verbose "$1"
+local $(pwd) done printf x=1 sed readonly export
+	grep 2>/dev/null sed 2>/dev/null -eu "$1" ${HOME} then && done grep | sed readonly
+		grep sed awk readonly "$@" && then | export -eu
+		"$1" awk readonly $(pwd) ${HOME}
+	readonly 'quoted text' sed done then cd | test "$@" test "$1" grep echo
+	--verbose "$1" readonly test then local echo
+	then done 2>/dev/null | cd cd -eu
+		printf x=1 local --verbose sed sed "$@" -eu && local "$1" cd test then grep sed
+		| x=1 grep export echo x=1 cd 2>/dev/null "$1" awk "$1" grep |
+		done ${HOME} | done readonly | export grep $(pwd)
+	&& sed x=1 | local | local
+	done -eu sed then readonly ${HOME} x=1 'quoted text' "$@"
+grep then export "$@" printf
+	awk readonly readonly readonly /usr/bin "$1" local sed
+x=1 export local 2>/dev/null "$1"
+		readonly 'quoted text' echo "$1" /usr/bin
+		x=1 2>/dev/null | x=1 cd then export
+printf test export test grep export
+'quoted text' "$@" 'quoted text' --verbose
+	cd printf x=1 sed "$1" "$@" $(pwd)
+		echo $(pwd) && ${HOME} $(pwd) /usr/bin test done | /usr/bin ${HOME} 2>/dev/null
+	sed ${HOME} awk x=1 cd echo export then readonly --verbose awk
+		grep grep x=1 printf echo local --verbose
+	test && done "$1" readonly -eu done "$@" sed
+		x=1 local "$@" 2>/dev/null local done 2>/dev/null export
+		readonly export x=1 sed && test export && ${HOME} printf 2>/dev/null
+		then /usr/bin echo --verbose test /usr/bin awk awk
+| $(pwd) grep sed echo export ${HOME} 2>/dev/null -eu | && export done
+	readonly && test "$1" readonly readonly 2>/dev/null
+	2>/dev/null /usr/bin export "$@" /usr/bin "$@" "$1" /usr/bin | "$@" |
+&& cd export "$1" grep "$1" ${HOME} cd echo && /usr/bin then
+local awk "$@" readonly then echo test export printf 2>/dev/null ${HOME} readonly
+--verbose done $(pwd) grep printf $(pwd) local /usr/bin sed && local 'quoted text'
+		readonly 2>/dev/null grep echo
+		printf export cd sed printf local x=1 /usr/bin ${HOME} 'quoted text'
+	'quoted text' | /usr/bin readonly echo done echo echo sed -eu /usr/bin 'quoted text'
+	then awk local "$1" /usr/bin ${HOME} | $(pwd) echo grep then
+		"$@" readonly "$1" $(pwd) -eu -eu -eu grep x=1
+		-eu grep $(pwd) printf ${HOME} | --verbose export readonly /usr/bin | local
+	2>/dev/null sed export export done && test
+	-eu ${HOME} local cd done test ${HOME} --verbose $(pwd) export
+export grep && export "$@" printf 2>/dev/null
+		then /usr/bin then export test "$@" cd x=1 then ${HOME} -eu ${HOME}
+	--verbose -eu local then grep local awk | "$1" "$1" "$1" local test readonly "$1"
+sed --verbose | export /usr/bin ${HOME} -eu
+		'quoted text' $(pwd) "$1" then grep echo $(pwd) done ${HOME} printf -eu then 2>/dev/null
+	2>/dev/null ${HOME} then --verbose echo 'quoted text' grep
+$(pwd) $(pwd) readonly echo sed "$@" then done grep local sed 2>/dev/null
+		then done echo then x=1 local 2>/dev/null echo "$@" && x=1 readonly printf cd
+	"$@" test export test local readonly done $(pwd) "$1" export
+	done echo --verbose ${HOME} grep 'quoted text' sed && awk "$@" printf
+	printf | sed done && echo export
+grep "$1" local 2>/dev/null
+		then test printf "$1" "$@" awk sed done | sed
+	${HOME} ${HOME} local -eu echo $(pwd) ${HOME} 'quoted text' x=1 readonly
+awk /usr/bin "$1" 2>/dev/null ${HOME} echo cd "$1" readonly
+	local ${HOME} test x=1
+-eu grep "$1" 2>/dev/null --verbose
+&& ${HOME} x=1 done echo $(pwd) cd "$1" test grep
+		test export echo printf awk echo 'quoted text'
+		export test x=1 --verbose printf $(pwd)
+test 2>/dev/null awk | 'quoted text' awk /usr/bin export "$@" readonly
+	'quoted text' "$@" awk
+		printf -eu ${HOME} 2>/dev/null 2>/dev/null
+export cd && && echo cd printf --verbose
+local done -eu "$@" 2>/dev/null awk awk echo x=1 2>/dev/null
+		readonly "$1" then export readonly | 2>/dev/null "$1" "$@"
+$(pwd) awk && then sed x=1 local printf x=1 cd printf echo then /usr/bin
+grep x=1 done $(pwd) "$@" /usr/bin echo "$1" --verbose awk echo echo done local
+	export "$@" cd ${HOME} "$1" $(pwd) readonly -eu local
+	"$@" readonly | ${HOME} 2>/dev/null
+	sed echo "$1" awk cd | /usr/bin awk ${HOME} printf cd x=1 grep awk |
+$(pwd) x=1 -eu echo "$1" echo done
+		"$1" printf x=1 test /usr/bin
+readonly 'quoted text'
+		&& 2>/dev/null cd 'quoted text' | -eu -eu
+	2>/dev/null x=1 "$1" test
+then grep then x=1 echo cd 'quoted text' printf sed awk cd
+local x=1 && x=1 /usr/bin then done "$1"
+awk printf cd $(pwd) test done cd -eu | $(pwd) $(pwd)
+${HOME} "$1" readonly awk
+export $(pwd) | local
+		/usr/bin export /usr/bin 2>/dev/null
+		sed | grep x=1 done awk printf local sed --verbose -eu | test ${HOME}
+printf sed done "$@" then done && echo 2>/dev/null echo export
+		local test readonly test grep x=1 test "$@" export --verbose $(pwd)
+	test "$@" test awk --verbose sed && then
+		sed /usr/bin $(pwd) grep test 2>/dev/null
+		&& x=1 test test "$1"
+		echo printf x=1 test then "$1" "$@" && then printf 'quoted text'
+		printf grep then x=1
+-eu echo local --verbose "$@" /usr/bin
+echo done "$1" "$1" readonly && local "$1" "$@" grep "$@" then printf
+printf then local awk cd /usr/bin test local readonly cd local then --verbose
+test 'quoted text' echo
+		done done cd -eu && grep -eu 'quoted text' then
+done --verbose /usr/bin 'quoted text' test done /usr/bin
+	readonly && -eu /usr/bin x=1 test
+		printf && /usr/bin readonly x=1 --verbose sed && echo ${HOME} readonly grep
+	&& test sed then local "$1"
+	${HOME} export cd x=1 "$@" export $(pwd) done /usr/bin 2>/dev/null then
+sed export 'quoted text' --verbose local export cd
+	awk readonly local "$1" --verbose ${HOME} "$1" readonly then
+-eu x=1 | 'quoted text' printf /usr/bin
+		${HOME} "$@" 2>/dev/null test -eu /usr/bin "$@" echo awk 'quoted text' -eu "$@"
+	/usr/bin then | local sed ${HOME} done readonly local then
+local "$1" -eu /usr/bin grep readonly echo "$@"
+	${HOME} && && readonly printf local ${HOME}
+		| grep $(pwd) awk readonly export x=1 'quoted text' grep grep | -eu "$@" ${HOME}
+'quoted text' echo sed grep $(pwd) printf && "$1" 'quoted text'
+"$@" $(pwd) --verbose then 'quoted text'
+sed printf test grep cd then grep printf awk "$@" cd x=1 $(pwd) sed echo x=1
+grep then 'quoted text' export echo -eu --verbose 'quoted text' printf 2>/dev/null
+	local $(pwd) grep "$@" 2>/dev/null
+		done then then --verbose | echo ${HOME} sed "$@" "$1" echo x=1 'quoted text'
+		x=1 -eu && printf "$@" cd done grep printf && | cd "$1" grep test "$@" ${HOME}
+		"$@" export /usr/bin export done | | done
+		/usr/bin readonly && 2>/dev/null then "$1" done
+	echo cd cd sed x=1 sed printf printf echo
+sed --verbose sed -eu sed 2>/dev/null
+		local $(pwd) ${HOME} sed 'quoted text' 2>/dev/null sed done "$1"
+echo grep echo export echo then && "$@" "$@" ${HOME} readonly -eu $(pwd)
+	--verbose "$@" /usr/bin sed "$@" done 2>/dev/null 'quoted text' /usr/bin
+		done export echo "$1" -eu 'quoted text' x=1 --verbose local
+	awk /usr/bin printf 2>/dev/null readonly
+awk cd awk && 'quoted text' done
+	done $(pwd) $(pwd) "$@" awk
+		echo sed 2>/dev/null /usr/bin
+	'quoted text' export grep "$@" 2>/dev/null done $(pwd)
+		then 'quoted text' | "$@" | /usr/bin grep 2>/dev/null
+		grep grep grep done 2>/dev/null test x=1 2>/dev/null -eu && /usr/bin $(pwd)
+	then ${HOME} test grep done awk
+grep $(pwd) x=1 sed 2>/dev/null echo --verbose ${HOME} echo ${HOME} awk ${HOME}
+	x=1 grep /usr/bin ${HOME} -eu cd | cd readonly --verbose "$1" cd
+		/usr/bin && --verbose then --verbose "$1" 'quoted text' | --verbose cd && then
+then | test ${HOME} ${HOME} x=1 local && --verbose test
+		| -eu then $(pwd) -eu done test awk --verbose $(pwd) && local $(pwd)
+	-eu $(pwd) test test "$@" then 'quoted text' export cd -eu --verbose readonly grep
+		awk --verbose local awk && cd done done cd readonly | cd | printf
+	/usr/bin cd done "$@" done then done then readonly cd "$@" local
+	grep 2>/dev/null | test export $(pwd) echo local --verbose ${HOME}
+		local sed readonly x=1 --verbose ${HOME} sed 'quoted text'
+	test export /usr/bin 2>/dev/null x=1 -eu
+x=1 -eu -eu "$@" 'quoted text' grep done --verbose readonly
+echo grep printf --verbose 'quoted text'
+	printf sed then awk /usr/bin 2>/dev/null
+	x=1 sed ${HOME} test "$@" --verbose echo --verbose printf | ${HOME} | -eu
+		'quoted text' ${HOME} printf then readonly 'quoted text' /usr/bin ${HOME} readonly
+printf x=1 awk "$@" printf
+&& /usr/bin echo | "$1" x=1 /usr/bin | --verbose x=1 test ${HOME} /usr/bin
+		printf | export echo echo echo 'quoted text'
+		echo done && echo --verbose -eu /usr/bin awk then test export
+	test test test && grep printf done awk done
+		grep "$@" "$@" sed 2>/dev/null 'quoted text'
+	&& "$1" ${HOME} done $(pwd) done $(pwd) "$@"
+	grep then "$1" echo echo --verbose | --verbose
+	local | local && test ${HOME} -eu echo done -eu ${HOME} &&
+	test $(pwd) && readonly local then echo test x=1 echo
+	readonly "$@" done sed -eu readonly grep | $(pwd)
+		export && test export test && then awk ${HOME} readonly 2>/dev/null 'quoted text'
+export ${HOME} "$1" printf 'quoted text'
+		export ${HOME} grep x=1 -eu | sed ${HOME} && | --verbose -eu -eu readonly local
+	sed grep echo x=1 'quoted text' 2>/dev/null
+	$(pwd) | done 'quoted text' local
+	"$@" -eu --verbose echo cd x=1 $(pwd)
+x=1 readonly export -eu printf /usr/bin printf $(pwd) local
+	printf grep then && x=1 ${HOME}
+printf grep test "$1" sed grep printf "$@" && readonly
+		-eu | awk -eu -eu awk echo grep x=1 awk -eu
+		| grep local readonly 2>/dev/null
+test printf x=1 ${HOME} awk
+'quoted text' | ${HOME} sed | done ${HOME} readonly "$1" x=1 "$1"
+export grep cd local then /usr/bin then "$1" /usr/bin readonly sed
+		-eu echo x=1 cd 2>/dev/null cd test "$@"
+		done "$1" -eu echo --verbose printf echo sed "$@" x=1 2>/dev/null "$1"
+-eu readonly test test /usr/bin /usr/bin awk awk $(pwd) printf "$@" $(pwd) "$1"
+/usr/bin awk cd ${HOME} "$1" 'quoted text'
+grep ${HOME} "$1" 'quoted text'
+		then $(pwd) readonly "$@" then local local 2>/dev/null $(pwd) --verbose
+		test "$@" ${HOME} done && awk && /usr/bin echo awk $(pwd) then ${HOME}
+		/usr/bin $(pwd) "$1" x=1 x=1 awk then then $(pwd)
+	grep --verbose local done && /usr/bin $(pwd) $(pwd) 2>/dev/null
+		awk "$@" "$@" "$1" then "$@" && cd done echo grep
+"$1" then /usr/bin | "$1" local ${HOME} grep | --verbose sed 'quoted text'
+cd && | test | $(pwd)
+	grep $(pwd) done printf --verbose -eu test
+		awk "$@" sed && | ${HOME} 2>/dev/null test echo ${HOME} echo --verbose
+"$1" --verbose "$1" "$1" 2>/dev/null | sed x=1 test
+		&& "$1" echo "$1" export ${HOME} grep echo sed grep 2>/dev/null
+		$(pwd) test -eu printf readonly cd
+		sed then printf awk cd grep sed --verbose test awk | -eu 'quoted text'
+${HOME} "$1" "$1" "$1" -eu readonly | --verbose -eu readonly echo grep
+		awk then awk $(pwd) then ${HOME} awk x=1 -eu grep |
+	export $(pwd) then sed grep --verbose printf ${HOME} awk
+		done readonly 2>/dev/null local -eu echo sed
+		-eu x=1 x=1 && --verbose export sed x=1 done 'quoted text'
+		done && sed grep awk 'quoted text'
+"$1" local --verbose test export ${HOME} cd && "$1" cd | local -eu
+		export $(pwd) $(pwd) grep
+cd local cd /usr/bin $(pwd) 2>/dev/null "$1" | awk "$1" /usr/bin printf ${HOME}
+	'quoted text' ${HOME} sed | $(pwd) cd awk cd 'quoted text'
+		printf local $(pwd) --verbose printf $(pwd)
+	sed x=1 'quoted text' 2>/dev/null ${HOME} "$1" | done done $(pwd) sed awk ${HOME}
+		2>/dev/null readonly && -eu -eu /usr/bin "$1" echo done readonly local 2>/dev/null
+		awk awk local done printf 2>/dev/null
+		| sed 2>/dev/null /usr/bin x=1 cd
+echo done --verbose 2>/dev/null /usr/bin x=1
+$(pwd) -eu then ${HOME} printf
+export /usr/bin export 2>/dev/null "$@" /usr/bin
+export -eu 2>/dev/null && "$1"
+	sed -eu /usr/bin awk grep | "$1" test then cd 'quoted text'
+printf $(pwd) cd local "$1" then echo &&
+		export /usr/bin x=1 printf -eu export test sed -eu "$1" sed sed done sed printf
+		then awk cd readonly ${HOME} -eu ${HOME}
+cd -eu then cd sed awk ${HOME} done ${HOME} | $(pwd)
+x=1 printf 2>/dev/null ${HOME} sed --verbose then
+		"$@" 'quoted text' "$@" awk echo test --verbose local cd sed echo
+/usr/bin grep 2>/dev/null && local && 2>/dev/null
+	cd echo done x=1 ${HOME} then
+		echo readonly readonly grep awk
+		&& "$@" | ${HOME} grep echo
+		'quoted text' 2>/dev/null cd "$1" readonly
+	x=1 $(pwd) echo && ${HOME} export sed test $(pwd) 2>/dev/null && export | x=1
+	${HOME} && readonly 'quoted text'
+		&& export readonly "$@" "$1" sed export test 2>/dev/null
+		"$1" sed -eu cd x=1 export cd 2>/dev/null
+	"$1" /usr/bin ${HOME} readonly awk grep -eu then export readonly sed
+		-eu awk done test printf cd local
+		then readonly && printf
+${HOME} sed x=1 then local awk --verbose $(pwd) x=1 cd $(pwd)
+done "$@" "$@" x=1 then then $(pwd) --verbose 2>/dev/null "$1" $(pwd) readonly
+	awk awk -eu 'quoted text' -eu echo --verbose done 'quoted text' ${HOME} export
+x=1 $(pwd) grep 2>/dev/null then --verbose && && then then done 2>/dev/null
+		cd "$@" "$@" | printf 'quoted text'
+&& $(pwd) test export printf grep cd "$@" "$1" cd cd local
+&& sed | ${HOME} local grep
+	| ${HOME} then test readonly
+	cd -eu then | then readonly && echo |
+		x=1 "$@" | --verbose x=1 ${HOME}
+		cd --verbose --verbose then "$@" echo grep then test $(pwd)
+	test grep x=1 echo ${HOME} readonly 2>/dev/null test local && sed echo
+local readonly done ${HOME} then export
+&& local 'quoted text' -eu | ${HOME} test readonly then 'quoted text'
+	x=1 readonly $(pwd) sed readonly test printf
+		cd done done $(pwd) "$@" x=1 sed && $(pwd)
+		test awk /usr/bin cd done export echo ${HOME} awk x=1 awk --verbose
+		test x=1 printf -eu --verbose
+		${HOME} -eu "$@" "$@" done test grep | local && then /usr/bin
+		done then "$@" cd awk -eu awk then echo readonly
+	| && export && echo "$@" "$@" /usr/bin && local 'quoted text' done cd cd printf
+	"$1" cd local test readonly 'quoted text' -eu
+		echo ${HOME} local export local "$@" -eu then 'quoted text' sed awk /usr/bin
+/usr/bin --verbose export export 2>/dev/null
+| $(pwd) done then "$@" "$@" grep 'quoted text' done local done |
+		| x=1 /usr/bin && "$@" 'quoted text' 2>/dev/null
+	test -eu readonly printf -eu -eu 'quoted text' | cd cd awk -eu
+		'quoted text' x=1 export sed awk sed cd test readonly
+		cd grep "$1" "$@" readonly
+export local $(pwd) && awk awk | && "$1" readonly --verbose printf --verbose
+		printf /usr/bin ${HOME} -eu printf && export $(pwd)
+readonly printf awk "$1" "$1" ${HOME}
+	"$@" echo cd /usr/bin $(pwd)
+test awk ${HOME} export
+| | && && $(pwd) cd grep grep cd
+		local readonly sed --verbose 'quoted text' /usr/bin "$@" sed x=1 ${HOME}
+		-eu -eu "$1" readonly echo 2>/dev/null 2>/dev/null 'quoted text'
+	local ${HOME} x=1 local cd export test --verbose awk $(pwd) "$1" then then
+		"$@" "$1" readonly sed /usr/bin "$@" then then done awk
+		"$1" local then readonly export echo export -eu | awk printf echo -eu
+2>/dev/null 'quoted text' cd printf
+echo "$1" "$1" then "$1" sed 'quoted text' -eu
+done grep --verbose printf
+	local "$@" x=1 --verbose
+		done x=1 2>/dev/null $(pwd) /usr/bin | done "$@" 'quoted text' readonly
+	2>/dev/null "$@" readonly local sed grep local printf --verbose
+		/usr/bin /usr/bin test
+		x=1 2>/dev/null grep
+		&& 2>/dev/null 2>/dev/null x=1 done
+cd ${HOME} | test "$@" "$@" $(pwd) 'quoted text'
+		| 2>/dev/null --verbose then $(pwd) test cd done
+	cd ${HOME} 'quoted text' "$@" x=1 ${HOME}
+	'quoted text' awk "$1" done done $(pwd) $(pwd) && cd
+| 'quoted text' local "$1" readonly
+export ${HOME} $(pwd) sed 'quoted text' | grep ${HOME} then
+		--verbose grep echo sed $(pwd) then
+		"$1" done then | | echo
+${HOME} readonly export readonly /usr/bin /usr/bin echo
+	test && 'quoted text' awk readonly
+	local grep readonly sed export "$@" && && cd x=1 awk test printf test
+export && readonly printf printf readonly export && awk then
+	export local echo 'quoted text' "$1" ${HOME}
+	grep "$@" then 2>/dev/null 2>/dev/null -eu -eu printf 2>/dev/null test |
+cd test readonly -eu ${HOME}
+		then local local readonly export /usr/bin -eu 2>/dev/null
+	then printf --verbose done ${HOME} printf test "$@" readonly grep
+	2>/dev/null echo done --verbose awk awk then -eu sed
+echo awk test done ${HOME}
+		test test local done x=1 --verbose local cd readonly
+2>/dev/null printf --verbose --verbose 'quoted text' ${HOME} && export printf
+2>/dev/null test printf grep readonly done ${HOME} grep
+		sed $(pwd) printf cd echo cd export test local cd readonly ${HOME} awk
+	echo cd /usr/bin -eu x=1 --verbose "$1" ${HOME} /usr/bin | $(pwd) && /usr/bin
+	-eu 'quoted text' sed then awk $(pwd) && printf | |
+	$(pwd) -eu 2>/dev/null readonly "$@" | grep /usr/bin "$1" cd sed
+	echo "$1" local -eu 2>/dev/null
+	local -eu "$1" | 2>/dev/null --verbose "$@" cd test readonly awk test cd printf
+${HOME} printf local awk && done cd && $(pwd)
+-eu echo cd ${HOME} local grep -eu
+readonly | "$1" printf -eu sed printf
+		2>/dev/null readonly ${HOME} x=1 && sed done grep -eu readonly
+	2>/dev/null 'quoted text' cd echo export 2>/dev/null readonly x=1 printf
+	/usr/bin sed sed /usr/bin echo echo /usr/bin /usr/bin cd
+		x=1 "$1" 2>/dev/null -eu awk echo local "$1"
+	&& test export grep local local then
+		| sed /usr/bin 2>/dev/null
+	| echo done then awk test && ${HOME} echo
+local done test sed then --verbose x=1 /usr/bin
+	${HOME} local grep && printf 'quoted text'
+	printf --verbose "$1" sed 2>/dev/null
+	echo readonly readonly &&
+	echo && grep export ${HOME} printf grep 'quoted text' cd 'quoted text' awk "$1"
+	local test done 2>/dev/null
+		2>/dev/null then /usr/bin grep x=1 /usr/bin /usr/bin echo printf
+		'quoted text' local ${HOME} x=1 /usr/bin awk && echo export 'quoted text' "$1" /usr/bin
+		x=1 printf awk sed test local done ${HOME} 2>/dev/null then echo 'quoted text'
+		&& cd printf echo | "$1"
+		echo x=1 "$@" echo x=1 test "$1" --verbose awk $(pwd)
+$(pwd) echo done | --verbose && 'quoted text'
+	x=1 && then then echo cd $(pwd) test "$1" && "$1"
+test cd awk "$@" 2>/dev/null done awk readonly cd &&
+'quoted text' x=1 "$1" readonly ${HOME} readonly readonly
+-eu --verbose local "$1" then --verbose ${HOME} readonly
+	printf ${HOME} sed ${HOME} | sed
+		$(pwd) -eu cd then local cd readonly
+	"$@" sed -eu "$@" ${HOME} printf grep echo
+		local test awk readonly /usr/bin
+		"$1" "$1" /usr/bin $(pwd) export done --verbose
+	readonly "$1" 2>/dev/null 'quoted text' && $(pwd)
+--verbose 'quoted text' grep 2>/dev/null 2>/dev/null 'quoted text'
+		$(pwd) printf readonly /usr/bin "$1" printf "$1" cd /usr/bin ${HOME}
+	&& -eu && cd echo $(pwd) local echo x=1 2>/dev/null
+		| done awk printf x=1 cd test echo --verbose 'quoted text' awk --verbose
+	grep x=1 done then ${HOME}
+	awk ${HOME} then $(pwd) x=1 /usr/bin export then export | "$1" x=1 "$@" awk | x=1
+		test $(pwd) ${HOME} && "$1" 2>/dev/null then /usr/bin
+x=1 -eu $(pwd) 'quoted text'
+grep test echo -eu then then /usr/bin readonly "$1" "$1" 'quoted text'
+	/usr/bin /usr/bin $(pwd) sed sed ${HOME} then test
+2>/dev/null | then "$1" then && readonly grep echo awk "$@" readonly cd
+export then $(pwd) printf cd "$@" grep && readonly grep ${HOME} $(pwd) export
+		export readonly 2>/dev/null && --verbose "$1" cd done sed sed sed awk | 'quoted text'
+		then "$@" printf sed | "$1" 'quoted text' x=1 | "$1"
+	sed readonly | $(pwd) test awk
+		cd then export test done then grep 'quoted text'
+		&& --verbose && then --verbose ${HOME} awk
+	-eu then local export then "$1" --verbose printf readonly
+	"$@" ${HOME} local $(pwd) ${HOME} "$@" readonly then grep echo "$@" awk 'quoted text'
+		'quoted text' 2>/dev/null export export test test then sed grep
+done 2>/dev/null x=1 test
+		done local && done "$1" | done
+		readonly local grep "$@" done readonly cd test sed printf "$@" | printf x=1 echo
+		cd ${HOME} awk grep done local
+-eu readonly $(pwd) --verbose then export
+	x=1 awk grep printf | then | readonly
+		cd local then then test "$1" cd && | printf cd awk
+		readonly $(pwd) /usr/bin grep printf "$@" | -eu export --verbose awk 2>/dev/null
+		awk -eu echo | "$1" && x=1 test awk $(pwd) "$@" then
+		$(pwd) local then test cd test $(pwd) grep local "$@"
+		local /usr/bin cd cd x=1 cd $(pwd) 2>/dev/null | "$@"
+		test "$@" "$@" "$1" done done awk /usr/bin --verbose
+	2>/dev/null echo cd then printf
+		test "$@" then | test awk grep "$1"
+	"$@" awk x=1 "$1" /usr/bin
+$(pwd) && 2>/dev/null printf
+	grep local 2>/dev/null cd 'quoted text'
+/usr/bin | echo echo ${HOME}
+		then $(pwd) export readonly 'quoted text' --verbose grep done | $(pwd) echo /usr/bin
+		then ${HOME} && printf 2>/dev/null
+		$(pwd) test ${HOME} 2>/dev/null printf /usr/bin x=1 done
+/usr/bin done export sed && local --verbose && $(pwd) ${HOME} printf x=1
+'quoted text' "$1" then readonly done printf awk "$@" export
+		awk 2>/dev/null --verbose /usr/bin 2>/dev/null sed "$@" then done sed &&
+		cd ${HOME} ${HOME} test &&
+	grep "$@" ${HOME} local then local
+	cd 2>/dev/null "$1" /usr/bin then 'quoted text' then && x=1 -eu
+	echo && grep awk printf echo 'quoted text' -eu done awk local awk sed $(pwd) x=1
+grep grep test cd -eu 2>/dev/null 'quoted text' export done
+	sed done "$@" --verbose echo sed sed then
+| local $(pwd) 'quoted text' /usr/bin 2>/dev/null 'quoted text' ${HOME} test
+"$1" cd 'quoted text' --verbose && echo "$@" grep then
+		done $(pwd) test local
+		--verbose sed readonly && echo then cd local $(pwd)
+		done done $(pwd) "$@" $(pwd) | done export then
+		readonly local | $(pwd) 2>/dev/null
+-eu then | export test -eu printf
+	sed 'quoted text' then --verbose /usr/bin sed | -eu "$1" -eu
+		| done echo awk printf "$1" export printf
+		done sed --verbose cd printf readonly -eu 'quoted text' ${HOME} --verbose
+		sed ${HOME} /usr/bin readonly "$1" | cd done
+test --verbose --verbose then | printf 'quoted text' test test done test awk
+	then awk $(pwd) x=1 && printf &&
+		echo sed ${HOME} && 2>/dev/null -eu x=1 /usr/bin $(pwd) 2>/dev/null
+	then 2>/dev/null "$1" grep test $(pwd) test export 'quoted text' x=1 cd cd
+	local readonly cd && ${HOME} && sed 'quoted text' | readonly local
+awk then readonly /usr/bin export | echo then ${HOME}
+| | grep awk cd done then cd echo && /usr/bin export awk
+printf /usr/bin 'quoted text' cd $(pwd) readonly
+	then "$@" ${HOME} readonly sed then test
+	echo ${HOME} sed 'quoted text' local
+2>/dev/null done -eu $(pwd) --verbose then export done
+	readonly done awk 2>/dev/null cd 'quoted text' /usr/bin --verbose awk printf
+	&& 'quoted text' readonly export x=1 /usr/bin
+	&& /usr/bin export "$1"
+	-eu ${HOME} | cd then "$1" 2>/dev/null printf then readonly 'quoted text' ${HOME}
+		--verbose awk sed done $(pwd)
+then sed grep done local echo /usr/bin $(pwd) &&
+		done "$@" "$1" -eu local --verbose test ${HOME} echo && $(pwd) 2>/dev/null
+"$1" | readonly grep "$@" echo && -eu 'quoted text' ${HOME}
+-eu sed ${HOME} readonly export --verbose readonly sed x=1 /usr/bin -eu readonly
+sed 2>/dev/null -eu awk export 2>/dev/null then x=1 echo |
+'quoted text' cd /usr/bin --verbose 'quoted text' 2>/dev/null
+	cd echo $(pwd) "$1" grep && 2>/dev/null local sed local awk done readonly "$@"
+		${HOME} sed cd 2>/dev/null grep cd | done x=1 echo
+		cd $(pwd) echo done --verbose sed "$1"
+		sed done /usr/bin 'quoted text' cd | 'quoted text' cd
+'quoted text' done "$1" --verbose export awk -eu printf local local
+		x=1 | && ${HOME} echo sed "$1" -eu done test readonly readonly && "$@" | readonly
+"$@" && sed --verbose awk
+		echo done /usr/bin cd then cd $(pwd) sed "$1" cd export | grep x=1
+	$(pwd) grep test readonly then export
+/usr/bin export cd sed test test | test /usr/bin echo
+	--verbose --verbose /usr/bin then local 'quoted text' export
+		export x=1 echo readonly --verbose printf test export $(pwd) then --verbose
+		${HOME} test cd export x=1 2>/dev/null readonly
+		echo /usr/bin then 'quoted text' x=1 /usr/bin | --verbose "$1" export echo local
+		'quoted text' --verbose | | then && 'quoted text' test x=1 sed
+		awk done cd printf x=1
+		echo printf export readonly awk echo x=1 /usr/bin 2>/dev/null |
+'quoted text' grep ${HOME} awk "$@" "$1" 'quoted text'
+		sed /usr/bin awk then grep done "$@" $(pwd) 'quoted text' -eu echo then echo
+		2>/dev/null --verbose --verbose
+2>/dev/null x=1 readonly readonly
+		/usr/bin "$@" export 'quoted text' cd echo "$@"
+	$(pwd) done grep "$@" && export echo export printf
+		2>/dev/null awk -eu "$@"
+	printf cd done | && x=1 "$1" test sed "$1" /usr/bin echo ${HOME} 2>/dev/null
+	--verbose printf "$1" local "$1" awk grep 'quoted text'
+	2>/dev/null -eu 'quoted text' ${HOME} test "$1" awk 'quoted text'
+		then grep 'quoted text' 2>/dev/null -eu -eu export $(pwd)
+		awk "$@" printf done 2>/dev/null readonly local
+		&& then test local grep local --verbose
+| 'quoted text' echo done
+		-eu done "$@" /usr/bin /usr/bin 2>/dev/null sed /usr/bin done then echo export
+		grep test export export 2>/dev/null then 'quoted text' echo printf && echo
+x=1 $(pwd) /usr/bin -eu "$@" cd -eu awk then x=1 awk "$@" printf --verbose
+	then awk 2>/dev/null test then then /usr/bin export
+	cd awk /usr/bin --verbose -eu cd readonly cd -eu done /usr/bin /usr/bin "$1"
+	readonly x=1 local sed cd sed
+		awk grep -eu 'quoted text' /usr/bin readonly
+	export grep awk 2>/dev/null then /usr/bin /usr/bin printf "$@" export
+sed ${HOME} echo test
+		-eu "$1" x=1 | --verbose test 'quoted text' cd && then && awk
+	${HOME} x=1 export grep sed "$1" --verbose local -eu local cd | echo
+		cd printf readonly local -eu grep done export awk export ${HOME} export "$1" sed
+		"$1" -eu | readonly local $(pwd) ${HOME} /usr/bin
+		export x=1 'quoted text' -eu export
+	"$@" awk local "$@" cd /usr/bin
+${HOME} test "$1" test -eu "$1" ${HOME} sed --verbose -eu -eu /usr/bin printf /usr/bin
+		test local printf 2>/dev/null "$1" awk sed
+		-eu -eu x=1 "$@" "$@" 2>/dev/null echo local -eu done &&
+/usr/bin "$@" x=1 then cd 2>/dev/null test
+x=1 -eu local echo --verbose -eu | $(pwd) --verbose
+		echo done && echo | awk "$@" 2>/dev/null | grep --verbose $(pwd) ${HOME}
+	export | local ${HOME} --verbose 'quoted text' && cd printf
+echo -eu then --verbose cd "$@"
+		cd 'quoted text' $(pwd) x=1 sed local awk grep awk x=1 --verbose
+		cd then readonly 2>/dev/null echo done local /usr/bin
+-eu export awk awk | local && sed then sed /usr/bin echo test
+--verbose "$1" then 2>/dev/null echo | export sed --verbose "$1" $(pwd) local done
+		&& then test test x=1 /usr/bin grep --verbose grep "$@" "$@" |
+&& readonly /usr/bin ${HOME}
+	readonly "$@" "$@" $(pwd) echo x=1 grep "$@" | then test && sed awk ${HOME}
+		$(pwd) 'quoted text' local 'quoted text' | -eu /usr/bin
+cd "$1" ${HOME} 2>/dev/null
+	--verbose done x=1 "$@" test
+		sed readonly && "$@" /usr/bin export awk
+		printf "$1" | test /usr/bin 2>/dev/null awk done echo --verbose
+		$(pwd) test local grep 'quoted text' echo awk | 2>/dev/null readonly
+export && x=1 --verbose readonly sed "$1" then grep 2>/dev/null
+		export /usr/bin echo "$@" printf "$@" then -eu -eu $(pwd) $(pwd) 2>/dev/null
+		local 2>/dev/null -eu then echo /usr/bin
+		$(pwd) 'quoted text' ${HOME} ${HOME} --verbose cd cd $(pwd) "$1" | ${HOME} $(pwd)
+awk readonly local 'quoted text' echo /usr/bin
+		done 'quoted text' local readonly export ${HOME} 'quoted text' sed "$@" && test
+		cd -eu local echo | 2>/dev/null -eu x=1 ${HOME} grep x=1
+	local then grep then grep local
+	awk $(pwd) readonly /usr/bin local then local /usr/bin && /usr/bin -eu | readonly
+&& "$@" cd --verbose sed test printf x=1 'quoted text' --verbose
+	"$@" awk "$@" sed test 'quoted text' done test ${HOME} "$1" --verbose echo
+'quoted text' 'quoted text' $(pwd) ${HOME} done local echo $(pwd) 'quoted text'
+	test awk then echo test -eu test ${HOME} --verbose
+	sed cd sed --verbose 'quoted text' grep | readonly grep 2>/dev/null readonly
+	x=1 --verbose awk 'quoted text' x=1 | $(pwd) 2>/dev/null export
+	cd ${HOME} printf awk
+readonly "$1" /usr/bin 2>/dev/null printf 'quoted text'
+-eu $(pwd) ${HOME} test sed then
+&& export awk 'quoted text' "$1" sed "$1"
+		sed | printf local "$@" sed | ${HOME} grep
+		'quoted text' printf printf cd --verbose done "$@" 2>/dev/null printf
+	grep 2>/dev/null cd export echo echo printf awk | ${HOME}
+cd then grep cd readonly ${HOME} --verbose local 'quoted text' $(pwd)
+sed readonly "$@" && | local "$1" export
+echo --verbose then 'quoted text' test cd awk x=1 2>/dev/null readonly "$@"
+		readonly | "$@" then awk echo && /usr/bin echo export -eu local
+export "$1" grep "$@" readonly
+&& -eu cd cd 2>/dev/null $(pwd) grep awk cd readonly local done local local
+-eu cd "$@" done export /usr/bin local then "$@" 2>/dev/null
+	cd 2>/dev/null --verbose "$1" test
+	'quoted text' then grep 2>/dev/null 2>/dev/null cd echo
+		readonly && -eu then && grep done
+--verbose ${HOME} "$@" "$@" readonly sed test && 'quoted text'
+		done readonly sed echo /usr/bin
+		test sed 'quoted text'
+		"$@" && echo export 2>/dev/null "$1" sed
+	/usr/bin grep test sed "$1" grep ${HOME} | && export
+	"$1" echo 'quoted text' cd 2>/dev/null
+		$(pwd) x=1 done x=1 printf readonly
+'quoted text' "$@" && echo ${HOME}
+/usr/bin -eu x=1 "$1" $(pwd)
+"$1" awk local echo local readonly && "$@" "$1" x=1 | done $(pwd) sed
+sed local 2>/dev/null cd readonly cd x=1
+x=1 'quoted text' export export export x=1 done sed ${HOME}
+local sed | export printf readonly x=1 echo export
+test readonly then | --verbose test && -eu grep sed --verbose
+readonly test local x=1 export | done /usr/bin /usr/bin done sed echo "$1" cd &&
+$(pwd) printf --verbose readonly
+${HOME} test 2>/dev/null
+	readonly sed x=1 test local 'quoted text' "$1"
+x=1 then /usr/bin sed x=1 then then | 'quoted text'
+		$(pwd) --verbose sed /usr/bin printf ${HOME}
+	sed echo done $(pwd) cd && readonly "$@" $(pwd) -eu echo
+		done 'quoted text' export readonly 2>/dev/null local --verbose
+		sed grep awk x=1 test ${HOME} test --verbose
+		-eu cd awk export && done readonly
+	&& 2>/dev/null | then then ${HOME} readonly "$1" grep done cd
+	| 'quoted text' "$@" local --verbose
+'quoted text' "$1" ${HOME}
+	x=1 "$1" x=1 "$1" -eu grep -eu done echo awk local
+	2>/dev/null ${HOME} $(pwd) x=1 readonly -eu ${HOME} then /usr/bin -eu 2>/dev/null
+	x=1 -eu -eu export $(pwd)
+	"$1" done x=1 'quoted text' printf -eu export "$@" -eu /usr/bin && --verbose &&
+local ${HOME} sed 2>/dev/null readonly ${HOME} ${HOME} && 2>/dev/null
+	export test grep | grep echo grep --verbose --verbose
+	echo readonly readonly 2>/dev/null
+		"$1" "$1" sed echo readonly x=1 sed export local awk "$1"
+	'quoted text' | 2>/dev/null awk export -eu readonly x=1
+	-eu test awk | echo sed 'quoted text' done local
+x=1 --verbose test /usr/bin local 'quoted text'
+		test -eu 2>/dev/null grep /usr/bin "$@" test
+		-eu done sed export readonly && done | local 2>/dev/null "$1" -eu 2>/dev/null
+		printf $(pwd) readonly then then test "$@"
+&& /usr/bin | | grep printf printf x=1
+	${HOME} done awk ${HOME}
+		readonly done "$1" $(pwd) 'quoted text' | "$1" | readonly grep ${HOME} x=1 "$@"
+	cd $(pwd) awk grep local grep $(pwd) cd 'quoted text' test -eu
+test test awk then --verbose
+		readonly "$@" local $(pwd) | export test printf awk
+		then printf 'quoted text' -eu export grep /usr/bin
+	x=1 then /usr/bin done 'quoted text' | "$1" local x=1 $(pwd) awk ${HOME}
+x=1 test 'quoted text'
+	| printf 2>/dev/null 'quoted text' 2>/dev/null 2>/dev/null
+		echo cd awk ${HOME} $(pwd) export /usr/bin | test
+	x=1 export then sed "$1" readonly |
+	echo local "$@" && 'quoted text' local 'quoted text'
+	readonly $(pwd) grep printf sed "$1" test /usr/bin 'quoted text' /usr/bin | test
+		local sed sed readonly | test 'quoted text' | "$@" ${HOME} ${HOME} "$@" "$1"
+	$(pwd) then --verbose "$1" local local x=1 | printf 2>/dev/null
+	export | local -eu done export 2>/dev/null cd "$1" export
+x=1 ${HOME} "$@" readonly "$1"
+		test x=1 --verbose test readonly 2>/dev/null done | --verbose && --verbose
+then local "$@" ${HOME} 'quoted text' sed then x=1 "$@" | done grep ${HOME} ${HOME}
+	export "$1" 'quoted text' | "$1" then && sed
+	&& then grep cd "$1" ${HOME} readonly test /usr/bin | /usr/bin &&
+		/usr/bin 2>/dev/null -eu $(pwd) "$1" 2>/dev/null local local -eu
+	x=1 | readonly local
+	grep then --verbose 2>/dev/null readonly cd readonly "$@" cd printf 'quoted text'
+local | /usr/bin awk x=1 $(pwd)
+	"$1" then export test sed readonly export -eu
+$(pwd) /usr/bin readonly local cd "$1" ${HOME} test awk
+/usr/bin echo echo x=1 printf
+printf -eu | printf -eu done --verbose cd readonly done local readonly "$1"
+	| awk | readonly | sed test sed
+	&& -eu 2>/dev/null echo grep
+/usr/bin readonly --verbose done local "$@" done readonly "$@" export then then
+		local export done done then
+printf ${HOME} export "$1" test 2>/dev/null | x=1 export && sed readonly
+local printf && | test 'quoted text' -eu done
+		${HOME} done "$1" export awk local 'quoted text' -eu printf printf printf test
+	-eu cd 'quoted text' x=1 printf && $(pwd) awk
+	sed readonly echo && "$@" ${HOME}
+	/usr/bin ${HOME} 2>/dev/null test echo "$1" readonly done local "$@"
+	local "$1" cd printf readonly 2>/dev/null x=1
+	grep cd then --verbose -eu ${HOME} awk sed readonly readonly test
+	sed grep export "$@" | "$@" 'quoted text' grep ${HOME}
+		-eu export -eu /usr/bin "$1" x=1 -eu export sed
+echo printf cd cd /usr/bin
+		done readonly -eu x=1 2>/dev/null 'quoted text'
+		cd awk then grep done ${HOME} test /usr/bin
+	cd readonly ${HOME} grep ${HOME}
+"$@" -eu export "$@" x=1 export -eu x=1 readonly ${HOME} ${HOME}
+awk "$1" awk done /usr/bin x=1 readonly done printf ${HOME} done
+	grep cd printf done then then done ${HOME} /usr/bin echo then
+	$(pwd) && 2>/dev/null grep "$1" awk /usr/bin "$@" then then
+	readonly x=1 awk printf | awk && local then printf 2>/dev/null done
+done $(pwd) then $(pwd) done echo sed && sed && export /usr/bin
+local readonly cd test && 'quoted text'
+	cd cd cd 'quoted text' $(pwd) "$1" awk 'quoted text'
+	printf sed -eu --verbose awk
+"$1" /usr/bin -eu done printf local done | $(pwd) $(pwd)
+test sed /usr/bin | "$1" export cd "$1" test "$1" cd
+		export awk echo done "$@" x=1 done sed test "$1" printf
+	$(pwd) -eu $(pwd) 'quoted text' "$1" then | done x=1
+	&& | 'quoted text' printf export | printf export printf readonly "$1"
+		done | local grep x=1 sed x=1 && test 'quoted text' export grep
+	sed x=1 printf 2>/dev/null | "$1" sed --verbose --verbose
+		printf cd awk grep | then x=1 -eu && sed sed --verbose
+		then cd printf $(pwd) | && export done 'quoted text' printf then ${HOME} -eu readonly
+		2>/dev/null then readonly grep 2>/dev/null grep /usr/bin "$1"
+&& local --verbose --verbose 2>/dev/null
+	/usr/bin ${HOME} printf sed 'quoted text' x=1 2>/dev/null then awk -eu
+	done local ${HOME} 'quoted text' export grep 2>/dev/null echo then
+2>/dev/null export $(pwd) then readonly ${HOME} cd sed
+		&& 2>/dev/null awk export
+		printf x=1 x=1 readonly | 2>/dev/null
+		| echo x=1 then local export
+done echo --verbose printf test readonly cd 2>/dev/null
+2>/dev/null $(pwd) test printf $(pwd) test && grep
+"$1" then "$1" x=1 && echo grep sed done
+	--verbose 'quoted text' 2>/dev/null
+	test x=1 readonly local printf done
+		echo test 2>/dev/null printf x=1 done $(pwd) printf /usr/bin test printf $(pwd)
+	--verbose --verbose echo | --verbose && then test export grep $(pwd) /usr/bin
+	then local "$@" 'quoted text' "$@" sed
+		printf then grep && readonly readonly
+		&& && 'quoted text' printf "$1" printf
+		printf printf "$1" 'quoted text' /usr/bin printf 'quoted text' 2>/dev/null
+		grep grep "$@" | cd --verbose -eu sed awk then readonly test sed
+readonly x=1 printf "$@" then x=1 done echo local | then
+		| $(pwd) export test printf
+		printf "$1" sed /usr/bin 2>/dev/null "$1" ${HOME}
+		'quoted text' "$1" /usr/bin "$@" "$@" export
+export readonly grep echo /usr/bin | grep 2>/dev/null printf
+readonly awk && done echo export 2>/dev/null
+/usr/bin printf $(pwd) | test grep
+		then readonly test local then export 2>/dev/null $(pwd) $(pwd)
+	awk cd export printf /usr/bin echo 2>/dev/null
+		2>/dev/null $(pwd) && then done --verbose
+$(pwd) 'quoted text' ${HOME} | | local && done sed grep /usr/bin &&
+	grep "$@" readonly awk printf awk
+	readonly grep sed 'quoted text' echo "$@" awk | "$@" "$1" | printf grep
+	test 2>/dev/null 'quoted text' then 'quoted text' "$@" --verbose
+		grep echo -eu --verbose awk readonly cd test 2>/dev/null "$1" 'quoted text' 2>/dev/null
+	&& done "$@" x=1 test printf 'quoted text'
+		"$@" sed --verbose done export x=1 2>/dev/null
+	-eu echo done local readonly echo && | "$@" echo ${HOME} | done
+	'quoted text' grep "$1" x=1 /usr/bin local --verbose
+	cd --verbose awk local ${HOME} sed --verbose local
+	printf /usr/bin ${HOME} /usr/bin cd local sed sed 2>/dev/null test --verbose grep
+	grep ${HOME} readonly awk "$@" /usr/bin 'quoted text'
+		2>/dev/null $(pwd) 'quoted text' echo test export export ${HOME} awk -eu echo cd
+		${HOME} then /usr/bin --verbose then 'quoted text' --verbose 2>/dev/null
+	grep awk x=1 $(pwd) $(pwd) awk "$1" readonly export export cd &&
+"$@" sed /usr/bin echo cd grep grep grep printf grep
+x=1 echo && export local done
+	/usr/bin 'quoted text' && local local cd $(pwd) awk -eu echo readonly $(pwd)
+		printf ${HOME} 'quoted text' done -eu "$@" done
+cd then ${HOME} $(pwd) done -eu
+		sed sed | "$@" 2>/dev/null 2>/dev/null sed test then x=1 test cd /usr/bin 2>/dev/null
+		awk $(pwd) ${HOME} x=1 2>/dev/null $(pwd)
+	$(pwd) test -eu && then
+echo "$1" "$@" $(pwd) then local done
+'quoted text' 2>/dev/null then export /usr/bin "$@" "$1" "$1" done done
+export "$@" awk grep $(pwd) echo && 'quoted text' export then cd then
+test export local "$1" 'quoted text' local && echo
+		export cd readonly --verbose --verbose --verbose 2>/dev/null test
+		printf /usr/bin "$@" -eu sed local $(pwd) echo
+	'quoted text' "$@" ${HOME} 'quoted text' readonly "$1" "$@" test grep
+&& grep && done ${HOME} && x=1 awk
+		| readonly cd 'quoted text' | echo /usr/bin
+| awk | "$1" | | 'quoted text' grep readonly "$1" local sed echo && then
+	cd --verbose readonly /usr/bin 2>/dev/null printf done then
+		sed export "$1" printf -eu then echo test done
+done -eu grep 2>/dev/null export
+	done $(pwd) $(pwd) | sed && local
+		${HOME} test | local --verbose x=1 /usr/bin echo 'quoted text' test
+--verbose | echo awk then "$@" echo 'quoted text' export --verbose
+	local "$1" && 'quoted text' x=1 cd test done test "$@" export /usr/bin
+		printf export cd $(pwd)
+		--verbose printf test done 2>/dev/null "$1" printf ${HOME}
+	2>/dev/null export echo readonly sed printf done cd &&
+	$(pwd) 2>/dev/null readonly /usr/bin | test -eu grep awk awk test local cd
+	grep echo export readonly test test "$1" && 2>/dev/null $(pwd) $(pwd) ${HOME}
+readonly --verbose -eu "$1" sed $(pwd)
+		$(pwd) test && 2>/dev/null then readonly -eu local "$@"
+		then --verbose --verbose test echo 'quoted text' /usr/bin echo echo printf
+		done --verbose 'quoted text' x=1 /usr/bin
+| "$1" readonly "$1" -eu $(pwd) | test --verbose readonly done
+	-eu /usr/bin cd echo "$@" grep sed
+	"$@" "$@" sed test ${HOME} --verbose /usr/bin sed
+		-eu --verbose 2>/dev/null test 'quoted text' then export echo awk export
+		/usr/bin | ${HOME} -eu printf ${HOME} x=1 readonly echo then
+		test /usr/bin --verbose sed /usr/bin printf --verbose test | then "$1"
+	$(pwd) export 'quoted text' && grep cd | ${HOME} awk 2>/dev/null
+	-eu test /usr/bin -eu "$1" test echo grep "$@"
+	export | local done cd 2>/dev/null 2>/dev/null
+printf ${HOME} && cd x=1 awk test 'quoted text'
+		readonly x=1 done 'quoted text' sed awk then
+test cd 2>/dev/null done --verbose "$@" grep export grep grep
+export cd done && then 2>/dev/null
+-eu 2>/dev/null local export /usr/bin
+${HOME} cd 2>/dev/null
+"$@" -eu && echo --verbose ${HOME} 2>/dev/null
+		printf test 'quoted text' 2>/dev/null $(pwd)
+		&& "$@" test 'quoted text' "$@" echo "$@" /usr/bin && ${HOME} test printf
+local sed | grep readonly "$@" 'quoted text' "$@" then echo | x=1 sed
+'quoted text' then 2>/dev/null "$@" readonly
+then -eu "$@" awk ${HOME} done x=1 x=1 test
+		--verbose then local printf sed sed
+| x=1 test "$@" --verbose $(pwd) printf readonly 'quoted text' && sed && 'quoted text'
+		${HOME} echo "$1" test 2>/dev/null "$@" x=1 | echo 2>/dev/null /usr/bin
+		-eu printf ${HOME} then "$@" /usr/bin
+then | | printf && sed printf test ${HOME} 'quoted text'
+	then done 'quoted text' printf then readonly
+		-eu "$1" 2>/dev/null export cd export --verbose
+		"$1" -eu printf sed printf
+test 'quoted text' --verbose 2>/dev/null export -eu 2>/dev/null 'quoted text'
+	grep sed readonly done awk
+		2>/dev/null 'quoted text' printf
+		'quoted text' -eu local /usr/bin printf export done awk test /usr/bin test
+	${HOME} "$@" 2>/dev/null export export 'quoted text'
+	sed | && printf "$1" printf
+export export test --verbose && sed 2>/dev/null awk 2>/dev/null "$1" export
+x=1 then awk local | 'quoted text' 2>/dev/null
+		${HOME} "$@" done awk awk then -eu readonly /usr/bin awk 'quoted text'
+	x=1 "$1" --verbose 'quoted text' then cd && x=1 cd -eu "$1" readonly "$1" export
+	then | -eu "$@" "$@" then -eu
+		/usr/bin 'quoted text' $(pwd) /usr/bin awk export
+	| then /usr/bin "$1" --verbose test
+local readonly /usr/bin readonly ${HOME}
+		2>/dev/null cd /usr/bin | $(pwd)
+	"$@" -eu "$@" export /usr/bin &&
+--verbose sed --verbose ${HOME} | "$1" test awk "$1" cd --verbose printf $(pwd)
+		sed "$@" --verbose x=1 'quoted text' export done && awk then ${HOME}
+	local export test --verbose then sed
+		echo ${HOME} readonly ${HOME} "$1" cd "$@" awk /usr/bin | sed
+		printf cd ${HOME} --verbose local echo /usr/bin x=1 awk | "$1"
+"$@" "$@" cd awk && then -eu | /usr/bin
+	readonly grep $(pwd) done cd local printf
+-eu ${HOME} -eu ${HOME} awk
+	export printf grep printf 'quoted text'
+		awk 'quoted text' && ${HOME} echo "$@" printf export local done awk echo "$1"
+	printf echo | 'quoted text' x=1 readonly readonly 2>/dev/null
+${HOME} ${HOME} export /usr/bin
+		sed "$@" local "$@" printf echo x=1 then echo local
+then readonly export local local
+	readonly sed 2>/dev/null -eu then
+$(pwd) awk readonly echo && "$1" readonly 'quoted text' 2>/dev/null --verbose
+	"$@" /usr/bin -eu awk printf local done --verbose | ${HOME}
+--verbose 'quoted text' done test test cd done done &&
+		| -eu done done grep printf "$@" export sed done
+echo $(pwd) grep done printf 'quoted text' printf test
+	${HOME} local --verbose
+		/usr/bin x=1 done 2>/dev/null -eu awk
+		export -eu /usr/bin grep sed then cd grep export -eu $(pwd)
+	x=1 ${HOME} readonly export
+		| ${HOME} "$@" done $(pwd)
+		'quoted text' 'quoted text' $(pwd) grep cd 'quoted text'
+		${HOME} | /usr/bin echo grep
+		then -eu ${HOME} && $(pwd) ${HOME} 2>/dev/null test awk "$1"
+	--verbose export local x=1 cd export ${HOME}
+	export ${HOME} ${HOME} sed -eu --verbose x=1 && local done printf
+		test --verbose x=1 local x=1 local echo export /usr/bin 'quoted text'
+| 'quoted text' 'quoted text' grep grep
+done sed cd done local "$@" test
+sed "$1" grep echo local x=1 'quoted text'
+"$@" /usr/bin then cd 2>/dev/null
+	$(pwd) && printf printf "$@" sed -eu sed x=1 $(pwd) then sed
+		/usr/bin sed -eu "$@" | $(pwd) cd readonly | echo
+		--verbose "$@" $(pwd) 2>/dev/null done local "$@" printf
+	sed -eu sed 2>/dev/null readonly done && ${HOME}
+/usr/bin $(pwd) printf && then awk sed 'quoted text' x=1 /usr/bin
+	cd 'quoted text' 2>/dev/null 2>/dev/null ${HOME} 'quoted text' -eu awk $(pwd)
+	cd export echo /usr/bin x=1 |
+${HOME} readonly sed cd printf done local
+	x=1 done awk 2>/dev/null test 2>/dev/null printf echo
+	x=1 done x=1 -eu sed ${HOME}
+		printf && then readonly /usr/bin export $(pwd) $(pwd) x=1 sed sed cd
+		cd test "$@" "$@" 'quoted text' 'quoted text' "$@" then done -eu | cd local cd test
+		sed sed awk 'quoted text' && ${HOME}
+	grep sed "$@" awk then --verbose x=1
+"$1" cd cd printf -eu "$@" | test /usr/bin test
+"$1" local -eu export
+		cd 2>/dev/null cd sed 'quoted text' 'quoted text'
+sed local | echo echo $(pwd) local "$1" --verbose
+&& 2>/dev/null --verbose 'quoted text' x=1 then local readonly export readonly
+sed awk readonly done && /usr/bin then -eu "$@" printf
+	sed local test 2>/dev/null "$@" done done sed printf 'quoted text' /usr/bin
+		&& && then readonly 2>/dev/null
+	test local then x=1 then cd "$1" "$@" "$@" | $(pwd) | /usr/bin
+		test sed test 2>/dev/null x=1
+		"$1" | /usr/bin echo done export readonly then export
+printf 'quoted text' "$@" --verbose readonly awk | sed ${HOME} printf
+		readonly echo echo /usr/bin echo then $(pwd) sed x=1
+x=1 awk ${HOME} printf test 2>/dev/null
+	${HOME} ${HOME} test done then printf cd cd /usr/bin
+		"$@" 'quoted text' | sed then readonly && $(pwd) local done test
+	echo 'quoted text' $(pwd) local | $(pwd) grep
+	2>/dev/null cd $(pwd) -eu ${HOME} test --verbose x=1 "$@" 2>/dev/null
+	done done | /usr/bin
+		grep --verbose awk awk sed -eu printf grep "$1"
+	"$1" ${HOME} /usr/bin done local awk 2>/dev/null -eu echo sed && -eu sed x=1 'quoted text'
+sed grep $(pwd) && && test && 2>/dev/null done export 2>/dev/null
+awk awk 2>/dev/null printf x=1 "$1" /usr/bin test awk -eu && -eu "$@" then awk
+	test test /usr/bin $(pwd) $(pwd)
+		sed then sed -eu test /usr/bin readonly
+		/usr/bin -eu grep test export local 2>/dev/null local x=1 sed done --verbose
+$(pwd) export -eu sed export | export "$@" sed done 'quoted text'
+'quoted text' -eu export done
+		$(pwd) --verbose sed 2>/dev/null grep
+	-eu -eu readonly ${HOME} --verbose echo
+	readonly done then /usr/bin /usr/bin x=1 echo
+	/usr/bin "$@" -eu ${HOME} "$1" /usr/bin cd readonly awk 2>/dev/null
+test /usr/bin --verbose ${HOME} echo | | echo
+		2>/dev/null done x=1 x=1 done ${HOME}
+done --verbose /usr/bin ${HOME} sed readonly
+	-eu sed x=1 -eu test -eu done test "$1" /usr/bin
+		cd --verbose readonly 2>/dev/null
+	cd export local 'quoted text' cd 'quoted text'
+		sed grep local 'quoted text' cd echo 2>/dev/null
+--verbose printf x=1 --verbose $(pwd) awk cd "$1" sed |
+printf export "$1" printf printf sed 'quoted text' local x=1 --verbose 'quoted text'
+${HOME} awk /usr/bin --verbose "$1" && sed | "$@" test awk awk --verbose
+"$1" awk -eu sed ${HOME} x=1 ${HOME} /usr/bin "$1" export readonly
+		"$1" local awk then cd local /usr/bin 'quoted text'
+sed test "$@" echo printf 'quoted text' 'quoted text'
+sed 2>/dev/null ${HOME}
+then 2>/dev/null grep export then && printf
+	sed --verbose 'quoted text' grep 'quoted text' | ${HOME}
+		echo readonly ${HOME} done awk -eu ${HOME} grep 'quoted text'
+grep | cd done grep /usr/bin readonly -eu ${HOME} | sed 2>/dev/null
+	printf local then "$@" grep readonly 'quoted text' 2>/dev/null | 2>/dev/null
+		grep readonly cd readonly cd "$@" local x=1
+	| $(pwd) readonly readonly 'quoted text'
+	$(pwd) $(pwd) -eu "$1" local printf sed grep
+	sed grep 'quoted text' echo done grep 2>/dev/null |
+	readonly cd $(pwd) done | printf /usr/bin x=1 sed | cd readonly && --verbose grep
+		-eu "$1" test echo echo -eu 'quoted text'
+		$(pwd) $(pwd) cd local x=1 ${HOME} /usr/bin
+printf ${HOME} -eu export 2>/dev/null ${HOME} /usr/bin then 'quoted text'
+		sed /usr/bin echo 2>/dev/null readonly grep grep local
+sed done 'quoted text' -eu
+		then awk /usr/bin 'quoted text'
+	cd grep x=1 -eu cd /usr/bin ${HOME} test
+| --verbose test /usr/bin /usr/bin --verbose local ${HOME} readonly
+		${HOME} echo done $(pwd) grep x=1 export awk echo --verbose grep
+2>/dev/null ${HOME} sed sed ${HOME}
+then --verbose then then 'quoted text' | sed
+awk --verbose readonly x=1 2>/dev/null
+		"$1" 'quoted text' grep cd then x=1 local
+		echo 2>/dev/null -eu cd then then echo ${HOME} x=1
+done grep 2>/dev/null "$@" -eu |
+	grep "$1" /usr/bin local readonly
+	2>/dev/null then then ${HOME} ${HOME} "$@" x=1 "$1" grep $(pwd)
+export "$1" then test ${HOME} x=1 | export export cd printf 'quoted text' ${HOME}
+done --verbose -eu /usr/bin
+test done "$1" local /usr/bin "$@" && --verbose "$1" x=1 && readonly "$1" then "$@"
+| readonly --verbose 2>/dev/null | printf
+sed done /usr/bin -eu awk
+	export grep cd && x=1 export printf --verbose $(pwd) 2>/dev/null printf
+		'quoted text' export --verbose done /usr/bin cd | local readonly &&
+printf x=1 "$@" $(pwd) "$@" readonly printf 2>/dev/null --verbose then
+		| "$@" done test local done | -eu | done
+		local cd --verbose x=1 --verbose test ${HOME} $(pwd) ${HOME} "$@" ${HOME}
+		done echo -eu readonly | then "$@"
+	/usr/bin | printf | /usr/bin -eu test | sed 'quoted text' "$1" --verbose
+	test x=1 awk grep echo cd "$1" "$@" done --verbose test export -eu cd ${HOME}
+	local export $(pwd) 2>/dev/null
+echo && readonly readonly cd x=1 cd printf
+-eu printf 'quoted text' /usr/bin
+		then local printf then then "$1" /usr/bin $(pwd)
+	sed "$@" x=1 /usr/bin "$1" x=1 readonly -eu then then "$1" --verbose
+	"$1" readonly cd awk awk grep --verbose /usr/bin | | test ${HOME}
+		2>/dev/null then "$1" readonly readonly cd -eu
+	"$@" "$@" 2>/dev/null "$@" $(pwd) cd then cd sed "$1"
+	&& /usr/bin export local x=1 2>/dev/null grep done echo /usr/bin cd --verbose
+done 2>/dev/null grep ${HOME} done cd export $(pwd) test x=1 cd
+awk 2>/dev/null x=1 -eu ${HOME} local cd "$@" ${HOME} ${HOME} x=1 readonly
+"$@" grep && awk export
+	cd -eu awk readonly export x=1 'quoted text'
+	${HOME} x=1 | grep "$1" --verbose
+		sed 'quoted text' printf x=1 ${HOME} sed $(pwd) "$@" $(pwd) 2>/dev/null
+${HOME} 'quoted text' --verbose awk -eu test awk |
+	cd export ${HOME} $(pwd) sed export test then ${HOME} 2>/dev/null -eu
+	"$1" 2>/dev/null readonly --verbose done | sed --verbose local test cd sed readonly
+--verbose export ${HOME} | echo "$1" "$1" printf "$1" "$@" "$1" x=1
+	-eu ${HOME} --verbose "$@" | && printf then grep
+		sed sed && x=1 printf -eu 'quoted text' sed "$1" -eu local echo cd cd export awk
+| export echo local echo "$1" cd "$@" /usr/bin ${HOME}
+		x=1 done -eu $(pwd) | -eu local -eu "$1" "$@" 'quoted text' done local
+	"$1" /usr/bin printf ${HOME}
+	'quoted text' printf /usr/bin
+'quoted text' local "$@" then test "$1" 2>/dev/null x=1 x=1 sed cd awk readonly
+	done sed "$1" sed --verbose grep 2>/dev/null
+printf cd cd then 2>/dev/null --verbose "$@" /usr/bin test local
+	--verbose printf "$@" ${HOME} export 'quoted text' ${HOME} 'quoted text'
+sed export ${HOME} printf awk readonly sed ${HOME}
+		"$@" done sed ${HOME} "$@" 2>/dev/null /usr/bin
+		grep -eu done printf grep export -eu /usr/bin "$@"
+/usr/bin grep readonly ${HOME} done && "$@" x=1
+printf grep --verbose echo 2>/dev/null "$1" readonly
+	awk "$1" test readonly readonly && --verbose
+done ${HOME} then then echo sed done /usr/bin
+	local readonly x=1 ${HOME} 'quoted text' test $(pwd) local readonly local "$@"
+		cd awk --verbose "$1" $(pwd) test export /usr/bin $(pwd)
+	'quoted text' awk echo 2>/dev/null awk x=1 'quoted text'
+		done --verbose echo | test then then ${HOME}
+| && export cd /usr/bin readonly "$@" local cd then | ${HOME}
+	"$1" $(pwd) | | readonly cd &&
+	then ${HOME} readonly -eu "$@" "$@" ${HOME} --verbose ${HOME} ${HOME} --verbose
+| echo local export export 2>/dev/null local -eu --verbose
+		cd grep -eu sed $(pwd) x=1 echo
+	"$1" x=1 && test readonly /usr/bin --verbose printf -eu sed
+		2>/dev/null ${HOME} 2>/dev/null test printf
+		printf grep "$@" sed ${HOME} grep x=1 ${HOME} echo echo
+	then cd 2>/dev/null -eu printf cd
+	/usr/bin cd && | grep then grep then --verbose readonly | echo ${HOME}
+printf sed --verbose printf && awk then $(pwd) && --verbose /usr/bin
+	export "$1" test awk echo 'quoted text' "$@" done test printf /usr/bin --verbose
+	x=1 ${HOME} test | "$1" --verbose /usr/bin
+		echo then "$@" "$@" 2>/dev/null && ${HOME} /usr/bin ${HOME} then --verbose echo
+local 2>/dev/null && "$@" grep
+	x=1 grep /usr/bin 2>/dev/null
+&& sed test export x=1 /usr/bin echo local
+/usr/bin sed -eu export $(pwd) then --verbose done local x=1
+&& 2>/dev/null 'quoted text' $(pwd) "$@" then export done "$@"
+	$(pwd) echo local | test ${HOME} grep && "$1"
+		"$@" ${HOME} | "$@" 'quoted text' export -eu local
+#include c50.sh
+-eu "$1" echo local test done then
+printf test test then awk -eu sed | test cd $(pwd)
+	/usr/bin x=1 /usr/bin printf "$1" 'quoted text' "$@" $(pwd) done
+sed && echo | $(pwd) /usr/bin -eu cd test /usr/bin awk
+	then test && "$@" ${HOME} ${HOME} --verbose export export
+		x=1 cd grep 2>/dev/null printf printf printf "$@"
+then readonly cd cd echo sed x=1
+		test then grep local | -eu awk local test -eu done awk /usr/bin readonly 2>/dev/null
+		--verbose cd /usr/bin && cd test x=1 /usr/bin
+		awk readonly "$@" /usr/bin printf | done then &&
+	awk done "$@" ${HOME} && export export awk $(pwd) echo 'quoted text' awk 'quoted text'
+echo echo sed x=1 -eu 'quoted text' export awk done /usr/bin /usr/bin
+	sed sed ${HOME} /usr/bin 2>/dev/null readonly && done
+		2>/dev/null echo $(pwd) awk awk test /usr/bin echo
+	sed printf -eu test readonly | -eu then then x=1 echo 2>/dev/null
+		/usr/bin echo echo ${HOME} test -eu echo "$1" x=1 /usr/bin
+&& readonly grep ${HOME} "$@" done readonly sed | export
+		awk --verbose -eu ${HOME} local --verbose echo "$@" -eu 'quoted text' awk
+	&& 2>/dev/null export 2>/dev/null then then $(pwd) $(pwd) test
+	/usr/bin /usr/bin 2>/dev/null printf 2>/dev/null test -eu "$@" x=1
+	printf "$1" $(pwd) local grep | /usr/bin x=1 |
+	'quoted text' cd ${HOME} && cd cd printf cd
+		local done | done readonly readonly | $(pwd) -eu awk | grep then 'quoted text'
+		"$@" echo && /usr/bin sed 'quoted text' "$@" then test test done ${HOME} readonly
+		$(pwd) sed 2>/dev/null echo /usr/bin
+	-eu 2>/dev/null -eu /usr/bin 2>/dev/null x=1 awk /usr/bin
+	--verbose $(pwd) export test ${HOME} | ${HOME} local 2>/dev/null "$1"
+	then -eu local "$@" done grep /usr/bin done grep "$@" /usr/bin test x=1 local
+		&& -eu x=1 2>/dev/null readonly export x=1 | export printf
+		export -eu done $(pwd) done readonly x=1 awk export "$1"
+${HOME} export && test grep printf grep ${HOME} && sed /usr/bin printf
+	--verbose awk | /usr/bin
+		2>/dev/null "$1" export test ${HOME} /usr/bin grep ${HOME}
+"$1" grep x=1 ${HOME} grep x=1 sed
+| | 2>/dev/null 'quoted text' "$@" export && "$1"
+&& printf 'quoted text' sed sed export /usr/bin ${HOME}
+/usr/bin ${HOME} grep /usr/bin cd
+'quoted text' awk awk && | awk x=1 echo --verbose
+		done "$@" "$1" | awk done awk test x=1 sed grep x=1
+	then 2>/dev/null $(pwd) echo $(pwd) ${HOME} | ${HOME} printf
+		then local -eu 2>/dev/null echo grep cd then cd local grep sed 2>/dev/null
+	"$1" "$@" test sed | cd "$@" $(pwd) printf | local printf 2>/dev/null --verbose
+"$1" then then /usr/bin x=1 /usr/bin && "$1" sed printf grep grep --verbose
+"$@" grep 'quoted text' -eu cd x=1 done local && readonly "$@" 'quoted text'
+local $(pwd) sed $(pwd) export cd test echo cd $(pwd)
+		readonly 'quoted text' readonly 2>/dev/null
+-eu x=1 2>/dev/null readonly && export |
+	then test cd x=1 local && && sed done "$@" &&
+	"$@" $(pwd) && | local sed test "$@" "$@" awk local test 2>/dev/null done
+	$(pwd) -eu cd && awk printf | printf
+"$@" then awk --verbose readonly awk then export grep
+		grep /usr/bin done local 2>/dev/null 2>/dev/null x=1 -eu x=1 --verbose done
+		echo cd -eu echo --verbose x=1 -eu 'quoted text' echo echo local printf
+		2>/dev/null cd 2>/dev/null done sed local && local export "$1" "$@" grep -eu done
+		export "$1" readonly grep readonly "$@" readonly test $(pwd) printf
+export "$@" $(pwd) -eu x=1
+		/usr/bin echo printf local printf | /usr/bin --verbose
+/usr/bin local $(pwd) $(pwd) cd x=1 x=1
+| /usr/bin /usr/bin printf test local then
+		export 2>/dev/null 2>/dev/null 2>/dev/null done ${HOME} test
+		awk readonly printf "$@" --verbose $(pwd) 2>/dev/null "$1" readonly
+		local grep && $(pwd) sed done && ${HOME} local
+		sed readonly | -eu export awk x=1 $(pwd)
+2>/dev/null 'quoted text' -eu echo sed
+	/usr/bin echo grep $(pwd) -eu -eu ${HOME} echo x=1 -eu
+echo grep echo "$1" awk printf then ${HOME} && readonly
+${HOME} test cd | -eu 'quoted text' echo readonly sed test test awk export echo
+readonly $(pwd) | then 2>/dev/null local
+	x=1 printf x=1 2>/dev/null cd ${HOME} ${HOME} local 2>/dev/null printf | x=1 grep
+		export && 2>/dev/null then "$1" "$@" && x=1 -eu | test echo /usr/bin
+export done grep "$1" sed done local 2>/dev/null --verbose --verbose grep
+		test --verbose x=1 cd x=1 -eu 2>/dev/null readonly /usr/bin && x=1 | /usr/bin
+--verbose $(pwd) done | ${HOME} | x=1 ${HOME}
+		awk printf local /usr/bin sed /usr/bin && cd test x=1 readonly test | echo
+	${HOME} x=1 cd 2>/dev/null "$1"
+		'quoted text' local 2>/dev/null grep done awk awk x=1 cd done
+	2>/dev/null awk readonly readonly /usr/bin sed 'quoted text' then
+	| awk | local /usr/bin x=1 sed done 2>/dev/null "$1" ${HOME} $(pwd)
+		echo "$1" readonly 2>/dev/null
+		test awk | done 2>/dev/null
+	export ${HOME} then awk grep awk grep printf readonly | sed x=1 local && 2>/dev/null
+		--verbose done grep sed $(pwd) local $(pwd) --verbose
+		echo test "$@" "$1" readonly && local echo done echo $(pwd)
+awk --verbose local 'quoted text'
+sed -eu "$@" test 2>/dev/null awk echo then awk
+"$1" 'quoted text' /usr/bin local cd x=1 | export "$1" x=1
+		then printf cd awk readonly "$1" ${HOME} && local "$1" 2>/dev/null
+		&& --verbose /usr/bin readonly
+grep 'quoted text' /usr/bin export && echo --verbose "$1" test awk 'quoted text'
+	then | $(pwd) cd /usr/bin $(pwd) echo readonly ${HOME}
+	"$1" printf readonly 2>/dev/null then printf test then grep echo 2>/dev/null
+	sed then "$1" $(pwd) 'quoted text' done "$@" printf
+	sed done && then 'quoted text' /usr/bin "$@" test /usr/bin
+		$(pwd) ${HOME} "$@" "$@" then grep 'quoted text' done
+"$1" local && export readonly "$@" sed 'quoted text' --verbose $(pwd) x=1
+	sed 'quoted text' local 'quoted text'
+	test x=1 --verbose printf | printf "$@"
+	${HOME} | test then then x=1 $(pwd) readonly test test "$@"
+		grep /usr/bin "$@" sed awk printf "$@" done 2>/dev/null then
+	grep export "$1" cd export grep grep export |
+$(pwd) done -eu -eu echo x=1 test | cd readonly x=1
+	readonly echo printf readonly 2>/dev/null cd sed && sed cd cd | awk echo "$@"
+done done "$@" local sed --verbose cd "$1" && awk 'quoted text' sed done
+	readonly /usr/bin $(pwd) awk /usr/bin 2>/dev/null ${HOME} grep /usr/bin
+		$(pwd) done sed x=1 'quoted text' -eu /usr/bin awk sed /usr/bin
+		--verbose | ${HOME} sed /usr/bin test then cd grep x=1 test | --verbose 2>/dev/null
+		"$@" -eu done done ${HOME} 'quoted text' grep
+cd 'quoted text' readonly "$@" cd local
+		| local $(pwd) cd sed --verbose readonly "$1" "$1" -eu x=1 echo -eu x=1 local
+	readonly --verbose done "$1" done awk 2>/dev/null
+	${HOME} x=1 2>/dev/null 2>/dev/null test readonly awk sed local export ${HOME}
+$(pwd) awk 'quoted text' readonly |
+/usr/bin export printf /usr/bin test --verbose $(pwd) ${HOME} "$1" /usr/bin sed
+		--verbose sed "$@" done ${HOME} /usr/bin then readonly $(pwd)
+local cd export 2>/dev/null
+	readonly grep | test local
+grep x=1 export | 2>/dev/null
+echo && then "$@" sed && echo export -eu --verbose
+export /usr/bin echo cd test 2>/dev/null ${HOME} 'quoted text' export $(pwd)
+		&& printf | && /usr/bin "$@" ${HOME} printf && && export grep test
+		printf awk /usr/bin echo "$@" "$1" $(pwd) grep export "$1" ${HOME} "$1"
+		test grep 'quoted text' test printf local readonly && 'quoted text'
+	then x=1 grep local /usr/bin x=1 && cd /usr/bin
+	export 2>/dev/null local local /usr/bin done readonly && awk cd /usr/bin 'quoted text'
+		echo "$1" -eu readonly echo cd x=1 cd then --verbose "$1"
+		| && $(pwd) cd ${HOME} | printf && test cd --verbose then $(pwd) x=1 cd
+		echo cd 2>/dev/null 'quoted text' 'quoted text' sed awk /usr/bin echo 2>/dev/null
+	sed awk grep "$1" local test export
+		sed echo then grep sed done 2>/dev/null &&
+	export 2>/dev/null export
+	export 'quoted text' && x=1 | awk sed &&
+	x=1 echo ${HOME} $(pwd) printf export
+test 2>/dev/null cd 2>/dev/null | 'quoted text' test sed readonly echo grep grep
+	printf "$1" done grep cd sed -eu -eu x=1 "$@" "$1" 2>/dev/null
+		/usr/bin x=1 /usr/bin ${HOME} printf sed && export awk readonly
+	"$@" /usr/bin done "$@" printf | && export grep done -eu 'quoted text'
+readonly && printf x=1 awk test grep x=1 grep cd 2>/dev/null
+		awk && printf grep echo "$1" /usr/bin 'quoted text' sed awk readonly
+"$1" /usr/bin $(pwd) 'quoted text' 2>/dev/null && | sed sed "$1" sed done then
+awk --verbose "$1" $(pwd)
+	then "$1" export "$1" test
+	"$1" then cd sed readonly
+"$@" export | -eu -eu sed
+	--verbose x=1 x=1 ${HOME} echo 2>/dev/null
+	$(pwd) 2>/dev/null ${HOME} awk cd --verbose readonly grep
+	&& "$1" "$@" export --verbose export echo x=1 then /usr/bin ${HOME} "$1" export
+echo --verbose x=1 /usr/bin 2>/dev/null local then done ${HOME} test local
+		then cd awk 'quoted text' awk test $(pwd) && echo awk ${HOME} && then
+		echo /usr/bin local then
+		'quoted text' done | sed "$@" ${HOME} echo
+export $(pwd) then && printf $(pwd) printf "$@" echo local
+-eu sed --verbose | printf
+		${HOME} readonly export
+sed local "$@" "$@" echo printf printf x=1 /usr/bin test export done grep
+		'quoted text' "$@" | /usr/bin export && /usr/bin "$1" done local
+	readonly readonly --verbose echo ${HOME} cd sed
+test awk readonly && grep done x=1
+		then | "$1" ${HOME} export local
+	| printf awk awk awk /usr/bin && "$@" done x=1 x=1
+	readonly printf export | echo grep printf 'quoted text' "$1" grep test "$@" --verbose
+"$@" grep then && printf $(pwd) readonly
+		export --verbose -eu | "$1" "$1" "$@"
+--verbose | $(pwd) test awk /usr/bin
+		cd then -eu cd printf "$1" "$1" readonly x=1
+		done ${HOME} "$@" $(pwd) local
+--verbose export ${HOME} local echo --verbose
+	"$@" cd export --verbose "$@" /usr/bin "$1" -eu "$1" -eu --verbose 2>/dev/null
+		--verbose grep ${HOME} local 'quoted text' test && x=1 export grep
+	2>/dev/null 'quoted text'
+	'quoted text' ${HOME} 2>/dev/null x=1
+	"$@" $(pwd) grep --verbose echo /usr/bin cd && "$@" local awk /usr/bin /usr/bin
+	cd echo /usr/bin printf /usr/bin && grep local grep
+		sed local 'quoted text' cd then -eu /usr/bin x=1 export "$@" echo
+	grep --verbose "$@" test
+$(pwd) local | "$@" grep && sed && $(pwd)
+		--verbose x=1 sed awk local /usr/bin sed test --verbose export local
+		grep $(pwd) grep local "$@" cd /usr/bin
+&& then ${HOME} readonly /usr/bin 'quoted text' test done
+		awk then | | readonly local test readonly awk | $(pwd) ${HOME} --verbose grep readonly
+| "$@" cd printf -eu printf test && && $(pwd) 2>/dev/null | awk ${HOME}
+cd x=1 | "$@" ${HOME} 'quoted text'
+then sed printf && | 'quoted text' printf export then echo ${HOME}
+		sed sed | done local grep 2>/dev/null export
+"$1" then test readonly 2>/dev/null
+		export ${HOME} -eu test 'quoted text' --verbose | 'quoted text'
+local "$1" ${HOME} $(pwd) done then
+		'quoted text' && 'quoted text' sed /usr/bin local test awk readonly grep
+		"$1" "$1" /usr/bin done
+		echo local && printf printf x=1 then "$1" test cd --verbose then
+	readonly "$1" "$1" && readonly "$1" --verbose then export
+	&& readonly && x=1 then
+-eu && sed 'quoted text' awk printf && grep
+		echo "$@" test local sed 'quoted text' done 2>/dev/null
+		sed | readonly /usr/bin ${HOME} "$@" printf cd done
+printf printf -eu sed grep readonly cd "$@" readonly
+	done "$@" awk --verbose
+	done sed -eu test cd -eu && "$1" printf grep -eu cd then
+		2>/dev/null "$1" test then grep printf cd x=1 awk cd "$@" awk ${HOME} test readonly
+	-eu readonly | grep | test
+export /usr/bin test 'quoted text' readonly
+'quoted text' local test readonly -eu printf x=1 --verbose --verbose echo
+		$(pwd) ${HOME} printf "$1"
+		done export /usr/bin local readonly --verbose echo ${HOME}
+		2>/dev/null -eu then
+	then awk local /usr/bin 'quoted text' test ${HOME} 2>/dev/null 'quoted text'
+&& "$1" grep readonly --verbose cd grep test readonly then $(pwd) "$@"
+		"$@" /usr/bin grep "$@" | done
+| echo local test 'quoted text'
+	$(pwd) then x=1 done printf then x=1 | local
+		${HOME} sed sed "$@" export 'quoted text' -eu awk
+	done | && sed $(pwd) && printf --verbose | cd --verbose -eu done readonly
+	grep echo -eu sed | "$1" "$@" readonly
+	awk 2>/dev/null awk echo grep readonly test | "$1" /usr/bin local
+| readonly export export x=1
+		x=1 test 2>/dev/null 'quoted text'
+		echo readonly done export readonly && printf awk test echo | $(pwd)
+awk grep awk grep then grep test test x=1 then
+	-eu cd -eu ${HOME} /usr/bin
+		2>/dev/null && 2>/dev/null "$1" --verbose $(pwd) sed && sed grep 2>/dev/null
+	/usr/bin awk && cd 'quoted text'
+&& export grep printf then && test ${HOME} ${HOME}
+'quoted text' printf export
+	-eu 2>/dev/null --verbose export awk
+		"$1" x=1 && then sed printf -eu --verbose
+		--verbose test "$@" test
+		local readonly awk sed test echo "$1" local local
+'quoted text' echo /usr/bin 2>/dev/null
+	printf -eu -eu 2>/dev/null -eu
+cd ${HOME} && local awk local grep 'quoted text'
+	readonly "$@" x=1 "$@" 2>/dev/null --verbose then
+		local "$1" grep $(pwd) "$1" 'quoted text'
+		grep awk cd done test sed export 2>/dev/null printf 2>/dev/null
+then --verbose && local cd readonly local readonly ${HOME} && local
+		| done test export sed ${HOME}
+		$(pwd) --verbose readonly | local /usr/bin awk
+/usr/bin && | 'quoted text' cd -eu -eu $(pwd) done awk cd
+	${HOME} echo ${HOME} /usr/bin --verbose "$1" cd && sed $(pwd) $(pwd) --verbose
+	2>/dev/null $(pwd) /usr/bin 'quoted text' awk test
+	done ${HOME} grep readonly done done && && "$@" cd local
+--verbose done export done 'quoted text' && echo
+	echo "$@" -eu "$1" grep local 2>/dev/null
+		echo grep done cd export "$1" done echo
+"$@" grep | then awk export /usr/bin
+	x=1 echo && /usr/bin x=1 awk readonly $(pwd)
+	cd "$@" cd ${HOME} ${HOME} cd awk "$1" cd
+$(pwd) then readonly export 2>/dev/null
+		grep grep | | /usr/bin awk -eu | 2>/dev/null
+		local 'quoted text' test 2>/dev/null
+		$(pwd) cd && | --verbose "$@" ${HOME} export grep
+	readonly x=1 x=1 && printf echo local "$@" readonly grep "$1" -eu local
+&& then 2>/dev/null grep && awk test | echo grep | echo test /usr/bin export
+'quoted text' /usr/bin "$1" $(pwd)
+		'quoted text' /usr/bin -eu x=1 "$1" 'quoted text' &&
+		readonly cd printf x=1 printf readonly local then export then test export
+		done test 'quoted text'
+	local readonly /usr/bin | ${HOME}
+printf cd echo x=1 x=1 cd /usr/bin
+	'quoted text' | -eu cd test $(pwd) && 2>/dev/null echo readonly ${HOME} awk $(pwd)
+"$1" cd ${HOME} export 2>/dev/null
+		cd "$@" 2>/dev/null local test -eu done echo x=1 $(pwd) awk -eu then
+		echo local 'quoted text' readonly export grep x=1 "$@" | /usr/bin cd done printf
+	${HOME} "$1" grep then "$1"
+		-eu local then -eu export local && &&
+local printf sed test readonly "$@" "$@" export && then 2>/dev/null /usr/bin
+		/usr/bin && cd test printf sed 'quoted text'
+		--verbose && readonly "$@" awk sed 2>/dev/null readonly
+	--verbose echo ${HOME} echo then "$1" /usr/bin --verbose ${HOME} readonly x=1
+"$1" local test -eu awk echo "$@" && "$@" export $(pwd)
+$(pwd) ${HOME} ${HOME} $(pwd) $(pwd) awk 2>/dev/null echo grep readonly
+done then ${HOME} then done x=1
+printf test done printf && readonly echo "$1" export readonly awk ${HOME} && $(pwd)
+2>/dev/null 'quoted text' done sed
+| x=1 $(pwd) test test awk -eu
+	then 'quoted text' local readonly printf then awk &&
+		export echo "$@" echo sed test "$1"
+test test readonly grep
+		| export then --verbose x=1 echo /usr/bin done local
+	awk $(pwd) "$1" && 'quoted text' x=1 $(pwd) done ${HOME} $(pwd) "$1"
+awk | local ${HOME} local /usr/bin --verbose then awk $(pwd)
+		export --verbose "$1" $(pwd)
+		$(pwd) --verbose grep && export test export test then echo -eu
+'quoted text' printf local x=1 $(pwd) $(pwd) -eu test
+	"$1" x=1 2>/dev/null readonly then
+	readonly /usr/bin && x=1
+		"$1" ${HOME} then export 'quoted text'
+		then -eu export readonly cd then local
+		-eu local x=1 'quoted text'
+		cd then done --verbose then --verbose
+	'quoted text' done sed ${HOME} cd
+		-eu 2>/dev/null $(pwd) export x=1 /usr/bin x=1 x=1 x=1 sed x=1 "$@" grep grep
+		local sed "$1" 'quoted text' ${HOME} printf
+	done then then "$@" "$@" -eu cd
+&& --verbose /usr/bin ${HOME} awk 2>/dev/null
+-eu 2>/dev/null x=1 local "$1" then 2>/dev/null then
+x=1 'quoted text' then ${HOME} echo export readonly -eu cd test awk
+then "$1" printf grep --verbose grep ${HOME} done
+local local printf sed cd ${HOME} test | /usr/bin readonly
+		--verbose "$1" "$@" x=1 test ${HOME}
+	-eu "$1" "$1" done && && "$1" local 'quoted text' printf test x=1 $(pwd)
+x=1 | 'quoted text' then 'quoted text' | awk --verbose sed local "$1"
+	done 'quoted text' && local test echo printf "$@" cd readonly
+		| grep grep /usr/bin printf x=1 $(pwd) printf
+printf -eu /usr/bin && 'quoted text'
+	"$1" awk awk /usr/bin export echo ${HOME} && done --verbose | && readonly
+		$(pwd) local "$@" cd -eu echo /usr/bin done printf test
+awk done /usr/bin 2>/dev/null ${HOME} x=1 $(pwd) printf printf cd local readonly
+		grep /usr/bin /usr/bin sed local "$@" awk
+	--verbose | export cd -eu | x=1 $(pwd) | then -eu $(pwd) cd sed export
+	${HOME} echo /usr/bin x=1 $(pwd) sed test done x=1 done sed local ${HOME} --verbose
+-eu -eu | sed | then 2>/dev/null export
+export "$1" ${HOME} x=1 -eu local --verbose
+	grep sed printf echo grep export $(pwd) test export $(pwd) "$1" 'quoted text' export
+	echo local 2>/dev/null
+${HOME} awk local -eu then test "$1" test "$@" grep local awk export grep
+	export | -eu local -eu 'quoted text'
+		export 2>/dev/null local "$1"
+	cd echo grep local grep test ${HOME} done done cd --verbose then awk 'quoted text'
+		export sed 'quoted text' && grep /usr/bin x=1 cd local /usr/bin
+-eu grep x=1 -eu export echo grep --verbose printf done /usr/bin done 2>/dev/null
+		grep cd 'quoted text' echo 2>/dev/null /usr/bin "$1" cd x=1
+		$(pwd) && sed sed readonly ${HOME} --verbose /usr/bin
+		sed grep | $(pwd) | "$@" grep
+--verbose "$@" -eu done $(pwd) 2>/dev/null ${HOME} 'quoted text'
+	cd cd 'quoted text' done --verbose local $(pwd) test
+2>/dev/null then 'quoted text' printf cd sed
+${HOME} $(pwd) -eu sed | $(pwd)
+cd -eu && 2>/dev/null then
+		| 'quoted text' 'quoted text' 'quoted text' $(pwd) export --verbose
+done test then 'quoted text' -eu awk 2>/dev/null
+		/usr/bin | "$@" then local printf cd export x=1 grep 'quoted text'
+'quoted text' x=1 2>/dev/null --verbose
+'quoted text' test readonly grep done ${HOME} -eu done printf "$1" -eu -eu
+sed done then sed grep echo 'quoted text'
+	grep export printf $(pwd) --verbose export echo "$1" --verbose cd | -eu -eu
+	&& awk x=1 "$1" cd 'quoted text' 'quoted text' readonly --verbose
+	${HOME} /usr/bin then grep local
+		cd /usr/bin 2>/dev/null printf echo printf && cd --verbose
+	2>/dev/null x=1 "$@"
+readonly echo /usr/bin echo
+2>/dev/null "$@" ${HOME}
+		sed $(pwd) x=1 2>/dev/null x=1 awk -eu "$1" "$@" "$@" --verbose cd test
+		x=1 then $(pwd) cd cd readonly $(pwd) /usr/bin ${HOME}
+		then -eu cd test sed "$@"
+		printf cd --verbose 2>/dev/null 'quoted text' local then $(pwd)
+	then cd | | "$1" sed /usr/bin $(pwd) done --verbose echo printf "$@" cd done
+/usr/bin "$1" 2>/dev/null | done echo echo && 2>/dev/null "$1"
+		&& 'quoted text' | -eu x=1 printf && sed 2>/dev/null "$1" 'quoted text' echo "$@"
+		2>/dev/null 'quoted text' test local "$1" then x=1 local 'quoted text' /usr/bin
+	/usr/bin sed /usr/bin --verbose sed printf then export grep x=1
+	&& --verbose "$1" export echo 'quoted text'
+2>/dev/null "$1" awk 2>/dev/null awk cd 2>/dev/null grep "$@"
+	--verbose --verbose test "$@" awk --verbose | then $(pwd) done "$@" ${HOME}
+		test cd export export grep ${HOME}
+	sed --verbose --verbose --verbose 2>/dev/null 2>/dev/null readonly 'quoted text'
+	-eu "$@" ${HOME} export 2>/dev/null -eu x=1 -eu grep local 2>/dev/null
+		-eu cd local awk done grep "$@" -eu
+| "$1" "$@" ${HOME} export | test | local echo printf $(pwd)
+		| | readonly /usr/bin readonly printf ${HOME} printf printf --verbose printf printf
+2>/dev/null echo && --verbose local 'quoted text' grep -eu cd
+	"$@" 2>/dev/null /usr/bin "$@"
+	then x=1 -eu /usr/bin 2>/dev/null grep done | local test local && sed
+		then export /usr/bin then && echo && "$1" sed --verbose
+cd test && local local ${HOME} then "$1" && -eu ${HOME} done "$1"
+	x=1 local then done 2>/dev/null
+	done /usr/bin echo then x=1 readonly ${HOME} -eu -eu $(pwd) printf
+		2>/dev/null sed test echo sed done then 'quoted text' local
+	grep echo sed x=1 printf | 2>/dev/null --verbose done "$@" done
+printf 'quoted text' 2>/dev/null $(pwd) "$@" 2>/dev/null
+	sed --verbose "$@" awk /usr/bin local "$@" grep $(pwd) awk printf x=1 /usr/bin
+	cd 'quoted text' local printf cd cd awk grep x=1 x=1
+		2>/dev/null x=1 printf x=1 echo -eu 2>/dev/null cd --verbose
+		"$1" "$@" local export cd
+	'quoted text' --verbose 'quoted text' cd cd echo test
+-eu export local 'quoted text'
+grep 'quoted text' | local 2>/dev/null test printf grep --verbose | then done
+2>/dev/null $(pwd) -eu $(pwd) done "$@" local $(pwd) x=1 --verbose
+		then ${HOME} test printf local grep done printf printf test "$@" 2>/dev/null
+| --verbose x=1 x=1 grep | x=1 grep -eu -eu printf x=1
+	echo readonly && done cd -eu ${HOME}
+	-eu done sed awk --verbose readonly ${HOME} "$1" "$@" 2>/dev/null &&
+		sed awk /usr/bin readonly x=1 && printf sed cd readonly
+		/usr/bin test "$@" local readonly x=1 then "$1" readonly cd
+	'quoted text' cd done -eu grep "$1"
+		'quoted text' readonly ${HOME} readonly
+		| sed ${HOME} "$1" $(pwd) readonly 'quoted text' "$@" "$1"
+cd | -eu ${HOME} grep test then
+export echo $(pwd) --verbose /usr/bin
+	"$1" --verbose sed $(pwd) sed export then
+&& ${HOME} --verbose awk
+awk awk "$1" | readonly 'quoted text' sed --verbose $(pwd) cd "$@" "$@" "$1"
+		x=1 ${HOME} ${HOME} echo
+		sed x=1 "$1" "$1" 'quoted text' $(pwd) | sed --verbose | cd $(pwd)
+2>/dev/null awk $(pwd) done awk sed printf /usr/bin
+test --verbose /usr/bin x=1 grep $(pwd) cd test printf ${HOME} -eu
+readonly test "$@" cd $(pwd) readonly readonly | x=1 then
+	sed done && local "$1" $(pwd) /usr/bin cd -eu
+		grep && /usr/bin grep x=1 /usr/bin echo "$1" && awk && printf test --verbose
+	done printf awk ${HOME} export "$1" sed then x=1 --verbose
+	awk && /usr/bin $(pwd) && "$1" printf readonly
+"$1" echo grep /usr/bin -eu x=1 && /usr/bin && ${HOME}
+		${HOME} "$1" | done test grep 2>/dev/null grep "$@" $(pwd)
+	$(pwd) | local printf $(pwd) && cd then
+	| local echo grep cd readonly $(pwd) ${HOME} /usr/bin local
+	--verbose then done "$@" "$1" export "$1" -eu "$1" --verbose
+	x=1 sed awk | 'quoted text'
+		"$1" test -eu then --verbose grep grep 2>/dev/null printf local printf
+then local grep x=1 | x=1 ${HOME} then sed && /usr/bin awk grep
+-eu 'quoted text' test "$1" sed echo done 2>/dev/null
+	"$1" done "$1" && echo $(pwd) echo sed readonly readonly
+	-eu cd | 2>/dev/null ${HOME} readonly export ${HOME} then test
+	-eu /usr/bin awk export cd export
+	readonly 'quoted text' grep test "$@" $(pwd) sed test | echo test readonly
+		-eu export | echo then grep grep --verbose done ${HOME} printf done
+	"$1" -eu "$@" ${HOME} done readonly test ${HOME}
+		$(pwd) printf local /usr/bin 2>/dev/null 2>/dev/null then "$1" then
+test /usr/bin x=1 local awk $(pwd)
+		export ${HOME} grep grep echo /usr/bin
+		then $(pwd) grep then && readonly local readonly
+sed readonly local cd x=1 export sed -eu /usr/bin local x=1 export
+echo | sed | test echo | cd --verbose -eu | "$1" sed
+		awk then -eu x=1 -eu | 2>/dev/null ${HOME}
+	grep "$@" test ${HOME} echo done sed "$1" awk done -eu
+sed awk awk grep export done done cd /usr/bin
+	echo 'quoted text' x=1 readonly
+export 'quoted text' export printf printf local local
+		done then $(pwd) then echo | "$1" x=1 printf x=1 $(pwd)
+	&& export local ${HOME} then
+	grep sed | 'quoted text' ${HOME} ${HOME} /usr/bin "$@" x=1
+	echo --verbose | cd | sed | x=1
+then cd -eu x=1 | test sed | $(pwd) 2>/dev/null /usr/bin x=1 --verbose
+printf "$1" "$@" then done --verbose
+		cd $(pwd) $(pwd) echo ${HOME}
+	test done -eu export readonly ${HOME} ${HOME} | 2>/dev/null
+	cd ${HOME} awk test awk 2>/dev/null x=1 awk grep "$1" grep printf
+	"$1" | cd then ${HOME} test --verbose
+local ${HOME} | ${HOME} printf 2>/dev/null cd | | "$@" echo then /usr/bin
+then cd printf readonly
+"$1" sed 'quoted text' && | "$@" ${HOME} --verbose x=1 -eu awk then $(pwd)
+	"$1" readonly printf sed export "$1" then export awk
+		x=1 done test sed printf $(pwd) $(pwd) done echo printf
+		$(pwd) cd 'quoted text'
+export /usr/bin echo printf ${HOME} test printf | readonly
+readonly export "$1" $(pwd) x=1 2>/dev/null | sed sed printf awk
+	${HOME} printf ${HOME} cd ${HOME} then test && 2>/dev/null
+		readonly then /usr/bin echo export x=1 export
+	done "$@" ${HOME} "$@" sed 2>/dev/null && echo | && 2>/dev/null /usr/bin
+	done done --verbose -eu done grep $(pwd) sed grep $(pwd) done
+	sed done 'quoted text' x=1 'quoted text' x=1 /usr/bin grep readonly then $(pwd)
+-eu 'quoted text' cd then ${HOME} local
+awk "$@" --verbose done -eu
+	$(pwd) | done --verbose && test sed printf x=1 local local && /usr/bin $(pwd)
+		awk printf echo echo ${HOME} done export sed 'quoted text' "$1" export
+sed -eu -eu ${HOME} | --verbose export /usr/bin "$@"
+		/usr/bin cd /usr/bin echo awk x=1 ${HOME}
+echo printf readonly then local readonly then | grep local readonly 2>/dev/null
+		then done echo x=1 done
+		echo awk sed 'quoted text' grep --verbose 2>/dev/null export
+		--verbose 2>/dev/null done readonly x=1 awk $(pwd) echo
+	${HOME} 2>/dev/null x=1 then 2>/dev/null
+sed export -eu sed | echo
+	readonly printf awk export
+	$(pwd) echo 2>/dev/null $(pwd) "$@"
+		grep echo cd -eu /usr/bin done then awk -eu grep export
+	$(pwd) test done test printf
+-eu 2>/dev/null echo 2>/dev/null export
+	| /usr/bin echo grep
+	&& sed ${HOME} readonly
+	printf export x=1 "$@" then grep
+printf 2>/dev/null $(pwd) /usr/bin local
+		readonly -eu /usr/bin done done "$1" 'quoted text'
+	"$1" "$1" sed --verbose ${HOME}
+	awk local && printf x=1 --verbose "$@" printf /usr/bin cd awk | done
+x=1 export "$@" 2>/dev/null "$@"
+&& 'quoted text' readonly test /usr/bin
+		x=1 | "$@" | done export then -eu
+	${HOME} done ${HOME} readonly -eu "$1"
+	-eu readonly x=1 then
+sed && readonly /usr/bin echo done ${HOME} "$1" && && /usr/bin x=1 local
+	then $(pwd) local && cd
+x=1 | x=1 x=1 local x=1 && done && "$@" | sed | test export awk
+		readonly /usr/bin ${HOME} 2>/dev/null sed 2>/dev/null
+test ${HOME} | done $(pwd) echo printf
+test echo echo readonly printf $(pwd) &&
+"$1" export grep export grep then -eu "$@" | 'quoted text'
+"$1" $(pwd) printf done 'quoted text' 2>/dev/null
+		cd done readonly cd awk test $(pwd) /usr/bin cd echo 'quoted text'
+	grep && grep sed -eu local cd
+	sed /usr/bin x=1 ${HOME} readonly echo | $(pwd) $(pwd) echo |
+	printf then && --verbose | test
+| 'quoted text' printf ${HOME}
+"$1" sed readonly ${HOME} x=1 awk | sed
+	export $(pwd) -eu done /usr/bin x=1
+		done printf -eu ${HOME} "$@" 2>/dev/null -eu ${HOME} 2>/dev/null export x=1
+then echo export -eu &&
+readonly grep echo x=1 -eu test
+echo sed && readonly x=1 local /usr/bin grep && grep "$@"
+	"$1" test && local local -eu local done then local -eu
+grep "$1" 'quoted text' local printf done 'quoted text'
+local 'quoted text' sed -eu printf echo $(pwd) 2>/dev/null sed test -eu --verbose
+$(pwd) --verbose cd | printf
+		| cd then 2>/dev/null 2>/dev/null sed $(pwd) grep /usr/bin 'quoted text' "$@"
+local echo --verbose echo "$@" then echo
+		done /usr/bin cd $(pwd) echo then 2>/dev/null test
+test "$1" $(pwd) ${HOME}
+	'quoted text' readonly grep && "$@" /usr/bin -eu x=1 --verbose echo test
+		&& && -eu 2>/dev/null awk 2>/dev/null
+		/usr/bin "$1" "$@" ${HOME} readonly local 2>/dev/null
+	&& $(pwd) cd done awk printf 2>/dev/null "$1" $(pwd) test -eu printf local
+readonly ${HOME} | 'quoted text' --verbose local awk printf 2>/dev/null "$@" sed
+	$(pwd) x=1 printf then
+	${HOME} printf sed "$1" grep --verbose x=1 grep ${HOME} ${HOME} readonly
+		${HOME} grep echo && 'quoted text' $(pwd) grep local
+		-eu "$@" grep sed x=1 $(pwd)
+printf done echo --verbose 'quoted text'
+x=1 "$@" then done "$1" readonly -eu local echo 'quoted text' export
+	awk $(pwd) then echo readonly then cd x=1 && export export x=1 sed grep
+	"$@" /usr/bin "$@" grep echo | ${HOME} readonly x=1 export
+2>/dev/null && && done 2>/dev/null grep grep ${HOME}
+done grep && cd --verbose ${HOME}
+		x=1 x=1 grep grep && cd -eu "$1" sed 2>/dev/null
+$(pwd) grep -eu test 'quoted text' grep local "$@" cd then
+export echo | done -eu -eu cd "$1" "$1" "$1" --verbose
+	printf && x=1 local 'quoted text'
+	${HOME} done awk echo echo && awk 2>/dev/null
+		-eu "$@" "$1" test readonly $(pwd) local
+&& 2>/dev/null test local 'quoted text' printf grep then cd awk "$1" awk
+	${HOME} /usr/bin printf printf "$@" readonly
+		done done readonly test "$@" export /usr/bin awk done sed ${HOME} echo "$@" 2>/dev/null
+		test 'quoted text' ${HOME}
+	"$@" "$@" then readonly readonly && export export export "$@" "$@" --verbose
+	sed echo /usr/bin grep done
+done grep $(pwd) "$@" echo local cd /usr/bin export export $(pwd)
+		sed done --verbose then awk
+| $(pwd) sed test done local | x=1 done awk done export
+	"$@" "$1" && local -eu awk local "$@" "$1" grep -eu "$1" &&
+cd --verbose ${HOME} 2>/dev/null /usr/bin -eu cd then printf 'quoted text' &&
+"$@" x=1 -eu test $(pwd) "$1" 2>/dev/null x=1 "$@" cd cd /usr/bin
+grep cd local $(pwd) 2>/dev/null
+		$(pwd) awk -eu readonly awk done local
+done sed readonly && test ${HOME} local -eu done printf ${HOME}
+printf && cd "$1" printf
+test 2>/dev/null x=1 local | "$1" awk local export local "$1" done "$@" then local
+		--verbose sed | printf
+		'quoted text' --verbose awk local "$@" printf
+'quoted text' 'quoted text' -eu --verbose 'quoted text' test ${HOME}
+	&& awk awk export export "$1" -eu "$1" --verbose -eu
+		done done --verbose "$@" ${HOME} done "$1" awk then done 'quoted text'
+	| cd awk done --verbose
+	local 2>/dev/null -eu && readonly grep && grep cd echo |
+		&& local grep done /usr/bin "$1" grep awk "$1" /usr/bin
+grep 2>/dev/null export 'quoted text' grep -eu done 2>/dev/null
+	awk export done echo awk "$@" | echo export sed
+grep sed 'quoted text' 'quoted text' ${HOME}
+		done /usr/bin --verbose echo --verbose /usr/bin
+	'quoted text' sed done && export $(pwd) readonly 'quoted text'
+	&& ${HOME} test test && x=1 cd sed local --verbose -eu --verbose done grep x=1
+		awk awk readonly -eu "$1" 'quoted text' ${HOME} 'quoted text' "$@"
+		/usr/bin ${HOME} "$1" "$@" awk done x=1 export "$@" 'quoted text' ${HOME}
+$(pwd) && x=1 /usr/bin readonly
+	done awk cd && export ${HOME}
+		2>/dev/null printf sed test then sed --verbose /usr/bin && export x=1 sed
+$(pwd) | "$@" "$1" $(pwd) "$1" 2>/dev/null
+cd /usr/bin done cd printf
+	&& "$1" test 'quoted text' $(pwd) ${HOME} printf
+$(pwd) echo ${HOME} local done "$1" cd sed /usr/bin
+		/usr/bin -eu awk cd awk "$1" then 'quoted text' -eu x=1 "$1" 2>/dev/null "$1" x=1
+	done 2>/dev/null "$@" -eu grep -eu echo
+		export ${HOME} -eu export export echo 2>/dev/null local /usr/bin awk x=1 ${HOME}
+		--verbose "$1" ${HOME} /usr/bin
+		cd printf | ${HOME} && export grep done
+	"$@" -eu ${HOME} ${HOME} printf 2>/dev/null 2>/dev/null
+	/usr/bin grep grep && export readonly 2>/dev/null test sed 2>/dev/null
+	then | awk sed $(pwd) sed "$@" /usr/bin | grep done done ${HOME}
+export -eu "$1" sed echo --verbose "$@" cd 'quoted text'
+		done x=1 -eu | export $(pwd) awk printf 'quoted text' sed | grep
+		2>/dev/null echo test sed grep && x=1 && ${HOME} local cd $(pwd)
+	&& | $(pwd) ${HOME} 'quoted text' "$1" ${HOME} "$@" then then 'quoted text'
+2>/dev/null 'quoted text' -eu x=1 readonly
+	printf sed test readonly "$@" sed
+		export && ${HOME} ${HOME} -eu grep "$1"
+		${HOME} 2>/dev/null --verbose sed sed
+		then --verbose then $(pwd) && echo
+"$1" readonly export then ${HOME}
+	printf test then done grep awk done sed export readonly "$@" export 'quoted text'
+	grep | --verbose 'quoted text' 'quoted text'
+then 2>/dev/null echo /usr/bin done awk awk test cd done echo awk
+	readonly sed export /usr/bin
+2>/dev/null test then test sed echo ${HOME} "$1" done done printf
+		| -eu done echo cd ${HOME}
+	'quoted text' test 'quoted text' then x=1 cd echo export local done && &&
+	echo /usr/bin ${HOME} echo grep sed 2>/dev/null -eu export readonly printf
+		"$@" test awk | $(pwd) sed echo -eu
+echo grep ${HOME} sed grep "$1" sed printf
+		echo local "$@" done sed grep printf echo then -eu | test printf export 2>/dev/null
+/usr/bin then $(pwd) local grep printf | x=1 readonly && "$1"
+	${HOME} awk printf done then
+--verbose local test local export awk 'quoted text'
+&& done echo grep | printf then done then ${HOME}
+		x=1 /usr/bin printf | export -eu && -eu x=1
+	echo 2>/dev/null "$@" sed x=1 export local $(pwd) readonly awk then printf $(pwd)
+		"$1" cd printf 2>/dev/null x=1 | x=1 -eu 2>/dev/null printf
+	grep x=1 && 2>/dev/null grep -eu --verbose local && "$1" ${HOME} /usr/bin awk &&
+	'quoted text' printf export
+then test done x=1 readonly
+-eu "$1" x=1 awk awk then readonly readonly "$@" "$@" sed
+		&& && 'quoted text' 2>/dev/null export
+	test echo $(pwd) readonly export printf 'quoted text'
+/usr/bin awk sed awk sed echo done "$@" cd done export
+		$(pwd) "$1" test readonly then
+&& test && 2>/dev/null 'quoted text' $(pwd) 2>/dev/null cd
+/usr/bin 2>/dev/null then "$1" test readonly then -eu done
+	test /usr/bin grep && local
+	$(pwd) -eu local sed 2>/dev/null readonly done local test
+${HOME} awk && done printf export sed $(pwd) -eu
+cd | 2>/dev/null 'quoted text'
+		2>/dev/null ${HOME} 2>/dev/null cd $(pwd)
+	"$@" grep grep printf grep cd "$@" 2>/dev/null printf then sed "$1"
+	$(pwd) "$1" export 'quoted text' x=1 /usr/bin "$@" 'quoted text'
+		--verbose printf $(pwd) cd 2>/dev/null /usr/bin
+		-eu awk cd /usr/bin 2>/dev/null echo "$@" export echo
+		sed test test 'quoted text'
+	cd export grep echo printf --verbose "$@" then
+		| -eu $(pwd) ${HOME} awk echo grep grep
+		printf then done --verbose echo --verbose then
+	$(pwd) done x=1 2>/dev/null
+echo --verbose 'quoted text' done | x=1 printf --verbose ${HOME} export
+		x=1 cd -eu && x=1 "$@" x=1 grep sed "$@" "$1" 2>/dev/null then export /usr/bin
+		readonly ${HOME} -eu local sed /usr/bin
+		$(pwd) "$@" 'quoted text' "$@" && && x=1 2>/dev/null
+	--verbose /usr/bin then awk
+then export /usr/bin "$@" ${HOME} export sed grep
+cd 2>/dev/null /usr/bin $(pwd) "$1" sed printf then awk && $(pwd) then
+		--verbose 'quoted text'
+		/usr/bin printf -eu | cd then $(pwd) /usr/bin x=1 printf 2>/dev/null |
+		&& sed x=1 awk then export | then "$@" awk test -eu ${HOME} echo
+	done ${HOME} /usr/bin /usr/bin grep | -eu printf "$1" "$1" cd | local x=1
+	--verbose x=1 "$1" cd local 2>/dev/null done local test awk readonly readonly
+test done sed $(pwd) export | test
+	| cd ${HOME} ${HOME} cd "$@" done $(pwd)
+		local printf readonly done
+		readonly echo local local
+readonly /usr/bin echo 'quoted text' done local done done "$@" x=1 echo sed "$1"
+/usr/bin export x=1 done x=1 /usr/bin "$@"
+	--verbose readonly then /usr/bin echo then local
+/usr/bin | | echo test awk "$@" done -eu "$1" export echo echo echo awk "$@"
+grep | export /usr/bin then sed test grep echo printf awk then echo
+		cd "$1" local --verbose | then "$1" grep "$1" echo sed && /usr/bin
+		/usr/bin sed && then | readonly 'quoted text' "$1" cd
+		x=1 done "$@" then cd echo
+/usr/bin awk | local "$@" cd "$1"
+'quoted text' then grep readonly local readonly "$@" "$1" test printf sed awk done
+	--verbose /usr/bin local sed -eu echo ${HOME} printf
+$(pwd) $(pwd) grep "$@" readonly "$1" "$@" && grep $(pwd) readonly
+"$1" | ${HOME} "$1" cd --verbose 'quoted text' -eu readonly awk test
+		cd readonly then "$1" 'quoted text' --verbose
+		done /usr/bin "$1" awk -eu ${HOME} printf && x=1 --verbose grep "$1" grep
+export done readonly export && -eu awk readonly 2>/dev/null --verbose "$1"
+test /usr/bin 'quoted text' cd x=1 /usr/bin printf -eu x=1
+x=1 sed ${HOME} echo /usr/bin then cd then && done 2>/dev/null /usr/bin export
+		${HOME} "$1" "$@" done x=1 echo "$1" readonly x=1
+	| then local cd ${HOME} /usr/bin && x=1 | &&
+		--verbose x=1 readonly
+/usr/bin local local sed ${HOME} x=1 "$1" then /usr/bin
+&& printf $(pwd) -eu grep awk sed
+	awk | x=1 'quoted text' "$@" x=1 readonly
+&& 2>/dev/null done 2>/dev/null -eu && "$1" cd /usr/bin
+		echo then test | echo | readonly
+		then test 2>/dev/null test
+	"$@" printf echo local sed local
+	$(pwd) $(pwd) done "$1" printf
+	"$1" | 'quoted text' && 'quoted text' cd printf
+"$1" 'quoted text' done -eu test ${HOME} 2>/dev/null
+awk awk awk | grep /usr/bin /usr/bin 'quoted text' awk 2>/dev/null
+	readonly "$1" | then
+		then awk echo 2>/dev/null then test export echo sed
+	&& done 2>/dev/null then "$@" sed readonly
+		| test ${HOME} -eu cd sed echo awk echo echo -eu echo
+"$@" sed $(pwd) 2>/dev/null echo done printf
+		--verbose && 2>/dev/null readonly "$1" x=1 done 2>/dev/null
+printf 2>/dev/null $(pwd) printf echo "$1" export
+		readonly --verbose done && "$@" local x=1 test test
+then ${HOME} -eu -eu "$@" then ${HOME} export && cd x=1 echo cd --verbose 2>/dev/null
+		-eu grep test export "$1" local x=1 local "$@" "$1" done done export sed
+	then cd cd "$1" "$1" awk
+done 'quoted text' $(pwd) "$@" export then
+grep && x=1 && local printf
+		echo grep && awk printf 'quoted text' x=1 ${HOME} export
+grep printf awk -eu echo test | 'quoted text'
+	${HOME} $(pwd) local grep
+'quoted text' grep 2>/dev/null
+	"$@" /usr/bin && then | 2>/dev/null $(pwd) printf
+--verbose sed "$@" /usr/bin readonly awk sed "$@" $(pwd) test done readonly
+	| 'quoted text' test local ${HOME} | 'quoted text' printf x=1 $(pwd) done then
+		| sed sed ${HOME} 2>/dev/null 2>/dev/null
+		local --verbose x=1 then /usr/bin "$1" export printf
+	--verbose x=1 readonly printf -eu echo sed ${HOME} echo then then /usr/bin
+"$@" | readonly x=1 'quoted text' /usr/bin test readonly ${HOME}
+'quoted text' -eu test x=1 local $(pwd) export
+export echo /usr/bin --verbose done test $(pwd) 2>/dev/null
+		printf -eu -eu "$1" test local x=1 printf printf printf 2>/dev/null sed x=1 cd
+	awk $(pwd) readonly grep printf --verbose readonly 'quoted text'
+		readonly $(pwd) then sed && grep $(pwd) x=1 "$1"
+	then x=1 "$1" 'quoted text' "$1"
+		grep awk cd then echo "$1" | export 2>/dev/null
+'quoted text' cd done readonly
+	"$1" -eu && test "$1" then sed echo then x=1 2>/dev/null && awk -eu
+		"$@" sed -eu readonly local test
+	${HOME} | test -eu $(pwd) export 'quoted text' ${HOME}
+"$@" done $(pwd) readonly awk ${HOME} test x=1 x=1 done
+		x=1 done readonly done && grep x=1 /usr/bin /usr/bin
+	| x=1 ${HOME} "$@" --verbose test x=1 ${HOME} cd then echo /usr/bin cd
+${HOME} done -eu 'quoted text' 2>/dev/null x=1 grep "$@" export
+	2>/dev/null grep sed echo --verbose echo | 'quoted text'
+	done x=1 "$@" export test && export sed /usr/bin
+"$@" sed x=1 "$1" $(pwd) then -eu export
+	--verbose 'quoted text' echo $(pwd)
+		readonly /usr/bin export "$1" awk | 'quoted text' 2>/dev/null ${HOME} 2>/dev/null
+	--verbose sed grep -eu 2>/dev/null echo ${HOME} local awk | cd
+	-eu printf cd printf grep readonly 'quoted text' sed
+	"$@" printf readonly -eu echo --verbose awk cd test && x=1 export
+		done --verbose awk awk --verbose x=1 done
+	sed readonly && | grep | ${HOME} 2>/dev/null printf ${HOME} export
+"$@" readonly "$@" grep export
+	then $(pwd) printf && test ${HOME} -eu then ${HOME} ${HOME} test done local
+		-eu "$1" /usr/bin /usr/bin printf x=1 done "$@"
+		done | awk $(pwd) export export awk sed echo && awk cd /usr/bin && grep test 'quoted text'
+echo sed /usr/bin test -eu echo --verbose
+	awk /usr/bin x=1 ${HOME}
+echo ${HOME} "$@" export "$@" -eu echo test then printf
+export done local awk grep "$@" test printf
+"$@" echo "$1" $(pwd) x=1
+	grep printf test echo ${HOME} echo -eu | grep
+		&& echo x=1 cd "$@" &&
+		x=1 x=1 grep x=1 grep sed 2>/dev/null -eu then test
+printf local export test
+		sed then awk cd then grep cd grep "$1"
+	| sed "$1" --verbose sed -eu -eu echo cd done /usr/bin
+	awk cd x=1 x=1 --verbose $(pwd) echo x=1 cd ${HOME} echo
+cd local printf then test done --verbose readonly
+	sed "$1" grep export "$@" grep done sed readonly
+		--verbose -eu then x=1 cd echo 'quoted text'
+	readonly "$@" test sed "$1" -eu | test sed 2>/dev/null ${HOME} /usr/bin
+/usr/bin 2>/dev/null ${HOME} "$1" ${HOME} 'quoted text' ${HOME} test echo then
+		local ${HOME} --verbose
+	grep printf --verbose $(pwd)
+local then echo | grep 'quoted text' then export | printf -eu then
+		'quoted text' cd "$1" ${HOME} --verbose test sed -eu grep
+then done "$1" "$1" then export "$@" printf printf "$@" printf
+	x=1 2>/dev/null done 'quoted text' echo x=1 x=1 "$@" readonly
+	test 'quoted text' printf test | test export then $(pwd)
+/usr/bin -eu local printf 'quoted text' export then grep echo
+	done sed 2>/dev/null 2>/dev/null 2>/dev/null --verbose printf ${HOME}
+${HOME} test 'quoted text' /usr/bin grep $(pwd) && local
+	grep -eu x=1 && /usr/bin "$@" "$1" local x=1 | 2>/dev/null 2>/dev/null
+		printf sed ${HOME} test readonly 2>/dev/null export printf then sed && 'quoted text'
+x=1 --verbose ${HOME} "$1"
+		'quoted text' cd | echo sed
+	$(pwd) awk cd sed local
+		local | "$@" 'quoted text' -eu done sed
+	readonly echo export cd ${HOME} awk "$1" "$1"
+	grep ${HOME} sed grep "$@" sed 2>/dev/null local then ${HOME}
+	&& echo /usr/bin export "$1" "$1" && grep /usr/bin printf && "$@"
+	/usr/bin then echo export grep local awk done local done printf
+		local /usr/bin sed test cd | printf awk cd 'quoted text' awk "$@" &&
+	readonly && "$1" cd 'quoted text' readonly test && local export
+		awk $(pwd) -eu sed then done ${HOME} test
+cd then then -eu local echo grep
+${HOME} && echo x=1 done export x=1 local awk /usr/bin "$1" local printf --verbose
+		"$1" -eu 'quoted text' echo done x=1 then printf
+		x=1 cd /usr/bin grep cd 'quoted text' 2>/dev/null
+		done cd echo done export 2>/dev/null $(pwd) sed
+/usr/bin cd export 2>/dev/null awk "$1" 2>/dev/null local
+	'quoted text' ${HOME} cd printf --verbose /usr/bin readonly printf local grep
+${HOME} x=1 --verbose && cd --verbose 2>/dev/null 2>/dev/null --verbose sed
+		${HOME} /usr/bin "$1" x=1
+		printf $(pwd) export echo | ${HOME} $(pwd) then
+		test "$1" --verbose grep "$1"
+sed cd cd --verbose | | 'quoted text'
+		grep printf "$@" export "$1" readonly awk cd then 'quoted text' echo && done
+	done awk -eu "$@" local x=1 "$@" ${HOME} then grep
+		2>/dev/null && local echo --verbose then printf -eu $(pwd) x=1 /usr/bin
+"$1" awk 2>/dev/null | printf grep test export ${HOME}
+	x=1 printf x=1 && | ${HOME} printf
+then printf grep | then 2>/dev/null done printf echo --verbose
+		| "$@" "$@" then ${HOME} "$1" readonly echo
+	--verbose 2>/dev/null && sed "$@" | done
+		${HOME} cd $(pwd) && done then cd | done export test
+-eu test --verbose /usr/bin cd done
+		sed cd done "$@" local
+$(pwd) printf cd "$1" echo "$1" done | readonly
+	x=1 readonly "$@" echo 2>/dev/null grep
+		&& test && echo sed --verbose then -eu grep
+grep --verbose awk 'quoted text' -eu | --verbose $(pwd) $(pwd)
+	"$@" "$1" cd printf cd awk x=1 echo done -eu -eu grep
+	2>/dev/null test ${HOME} test readonly local
+	grep $(pwd) then "$1" --verbose "$1" 2>/dev/null ${HOME} echo --verbose
+		&& && test /usr/bin 2>/dev/null "$1" -eu test done ${HOME} echo local -eu ${HOME}
+		| test | --verbose then | awk $(pwd) && -eu
+	readonly test x=1 -eu x=1 then "$1"
+		sed readonly printf "$@" echo sed
+echo "$@" local done awk | then 2>/dev/null cd "$1" export
+		/usr/bin done 'quoted text' 2>/dev/null local
+then /usr/bin 'quoted text' sed cd export "$@" test local | echo | /usr/bin awk
+x=1 then done && && test readonly
+export export done ${HOME} 'quoted text' grep grep
+	sed printf -eu export -eu "$@" "$1" "$1" $(pwd)
+	printf && ${HOME} "$1" 'quoted text' export echo "$@" --verbose
+| awk sed -eu readonly --verbose
+		grep 2>/dev/null cd export | 2>/dev/null ${HOME} 'quoted text'
+		&& 2>/dev/null $(pwd) /usr/bin
+	then x=1 -eu "$1" /usr/bin --verbose local done export
+	2>/dev/null x=1 local "$1" -eu
+		readonly --verbose export
+&& awk export then 'quoted text' -eu local "$@"
+	grep cd printf "$@" readonly && && export
+		'quoted text' cd -eu then echo 'quoted text' "$1" && local
+		cd x=1 awk local then local | sed /usr/bin | cd done "$1" readonly awk local
+		printf && -eu then && 'quoted text' awk done test
+export 2>/dev/null "$1" 'quoted text'
+		readonly done ${HOME} test
+	x=1 ${HOME} awk $(pwd) x=1 | grep $(pwd) cd
+	-eu done readonly awk grep readonly "$1" | done echo "$@" sed test
+done "$1" -eu && "$1" echo cd echo $(pwd) ${HOME} && grep ${HOME} printf "$@"
+		test 'quoted text' "$@" -eu awk grep local echo sed "$1"
+| grep -eu readonly cd "$@" local readonly readonly --verbose readonly local
+		2>/dev/null local "$1" "$@" "$@" echo grep 2>/dev/null
+		x=1 export echo x=1 /usr/bin sed
+		readonly test echo printf /usr/bin then $(pwd)
+	--verbose then export --verbose "$1" x=1 echo 'quoted text' /usr/bin sed local
+	printf done && --verbose 2>/dev/null export local 'quoted text'
+	local cd printf cd grep && -eu
+local test -eu -eu sed
+		test | local /usr/bin cd
+${HOME} | x=1 then /usr/bin
+cd local grep printf test && | echo ${HOME} | "$@"
+"$@" | | local --verbose printf echo && 2>/dev/null
+	--verbose echo | 'quoted text' "$@" $(pwd) cd
+"$@" sed 2>/dev/null && done ${HOME} && 2>/dev/null
+echo then 'quoted text' x=1 --verbose readonly --verbose then "$1"
+readonly local "$@" readonly test test "$1" --verbose cd cd cd local export
+		| -eu /usr/bin readonly test cd "$@" then "$1" x=1 -eu 2>/dev/null
+x=1 then "$@" x=1 export && ${HOME} | readonly
+-eu "$@" -eu done cd 'quoted text' $(pwd) echo && awk $(pwd)
+	test done cd sed $(pwd) "$1" $(pwd) done && local x=1
+2>/dev/null local awk /usr/bin | "$@" "$1" then
+"$@" "$@" local sed --verbose -eu readonly local grep x=1 /usr/bin "$@"
+2>/dev/null 2>/dev/null && local cd grep | printf
+		"$@" printf "$@" sed awk then export 2>/dev/null export
+	'quoted text' then --verbose test /usr/bin echo "$1" test echo
+	local readonly grep -eu done x=1 -eu
+		awk test done 2>/dev/null 2>/dev/null $(pwd) local "$@" echo /usr/bin export
+	test 'quoted text' sed && echo ${HOME} $(pwd) grep sed
+		--verbose && readonly ${HOME} awk awk ${HOME} | then test
+	export printf done x=1 test 'quoted text' "$@" "$@" grep cd sed $(pwd)
+		--verbose done test done "$1" sed | test 2>/dev/null done
+	cd $(pwd) then | printf --verbose cd sed -eu then && awk $(pwd)
+export --verbose /usr/bin "$1" ${HOME} $(pwd) cd | -eu /usr/bin
+'quoted text' ${HOME} grep printf "$@" "$1"
+	"$1" 2>/dev/null grep "$1" 2>/dev/null done export local echo --verbose
+	grep test sed /usr/bin done --verbose
+		readonly "$@" awk done ${HOME}
+then export readonly readonly awk "$1" -eu local awk $(pwd)
+cd -eu /usr/bin printf -eu /usr/bin
+-eu echo then export sed echo cd grep 'quoted text' ${HOME}
+	printf /usr/bin ${HOME} 'quoted text' $(pwd) "$1" cd "$@"
+	export printf cd echo "$@" 2>/dev/null
+printf /usr/bin sed 'quoted text' "$@" test done readonly sed test && done cd then
+	${HOME} -eu grep grep echo done local
+		awk done 2>/dev/null sed readonly x=1
+test && test --verbose /usr/bin
+		$(pwd) "$@" done --verbose && "$1" readonly local
+	--verbose | awk awk 'quoted text' && export 2>/dev/null awk awk readonly sed printf
+	${HOME} test then && && -eu x=1 /usr/bin "$1" awk local export test cd
+		x=1 "$1" --verbose sed $(pwd) | "$@" && local awk "$@"
+		test grep x=1 -eu ${HOME}
+x=1 | done "$@" $(pwd) cd -eu x=1 local /usr/bin --verbose
+	readonly "$@" export && "$1"
+	/usr/bin "$1" 2>/dev/null grep cd grep "$1" sed "$@" -eu
+	x=1 export readonly --verbose -eu grep 'quoted text'
+		'quoted text' cd awk "$@" cd -eu 'quoted text' 2>/dev/null
+		sed && export && /usr/bin 2>/dev/null readonly
+"$@" --verbose awk awk -eu grep cd &&
+		cd done $(pwd) echo cd awk printf readonly awk awk sed
+	&& /usr/bin x=1 then ${HOME} local 2>/dev/null test 2>/dev/null | local 2>/dev/null
+grep "$@" echo "$1" test echo /usr/bin then grep echo sed local test
+export --verbose ${HOME} echo echo x=1 --verbose grep grep ${HOME} --verbose
+2>/dev/null cd 'quoted text' awk ${HOME} sed "$1" "$1" sed export export
+$(pwd) --verbose && --verbose readonly
+"$@" -eu ${HOME} grep 'quoted text'
+		x=1 cd test && x=1 local "$1" /usr/bin -eu "$@" grep local
+	"$1" x=1 readonly printf
+done ${HOME} export export ${HOME} "$1" 'quoted text'
+done --verbose then printf sed $(pwd) -eu readonly printf x=1 sed && test "$1"
+	--verbose 'quoted text' test 'quoted text' && && 'quoted text' local cd
+	then | 2>/dev/null test local test echo 'quoted text'
+	export "$@" --verbose | local grep /usr/bin 'quoted text'
+	awk awk ${HOME} ${HOME} awk 'quoted text'
+cd /usr/bin then && && readonly --verbose
+		local local x=1 test
+"$1" done && $(pwd) export 2>/dev/null echo done $(pwd) cd cd | -eu sed done
+	--verbose 2>/dev/null grep test && done x=1
+		printf "$@" cd && done 'quoted text' 'quoted text' local 'quoted text'
+		local | x=1 $(pwd) "$1" 2>/dev/null readonly $(pwd)
+local "$1" 'quoted text' --verbose 'quoted text'
+	test then "$@" cd x=1 "$1" /usr/bin
+export "$@" && 'quoted text' /usr/bin awk ${HOME} /usr/bin
+		&& awk local | test printf 'quoted text' 'quoted text' grep
+		2>/dev/null readonly $(pwd)
+--verbose $(pwd) printf then then x=1 -eu then --verbose then test
+sed grep grep "$1" "$1" done /usr/bin 2>/dev/null
+then "$1" | 'quoted text' cd echo /usr/bin sed /usr/bin done ${HOME}
+--verbose cd export readonly
+		then 2>/dev/null --verbose 2>/dev/null | cd x=1 "$1" local
+		grep sed --verbose sed sed && test readonly "$@" -eu echo && "$@" &&
+sed x=1 awk /usr/bin 'quoted text' x=1 then
+printf printf "$@" sed "$1" echo grep export sed local
+	-eu "$@" local "$1" $(pwd)
+	-eu /usr/bin echo 2>/dev/null test local then
+		&& ${HOME} grep 'quoted text' | "$@" awk -eu local awk local x=1 export printf
+echo "$@" done test "$1"
+		cd | --verbose --verbose awk readonly
+	local printf | x=1 -eu readonly 2>/dev/null -eu readonly $(pwd) readonly
+	printf --verbose -eu grep ${HOME} then done test && $(pwd)
+	echo | -eu /usr/bin "$1"
+	"$@" "$@" awk 2>/dev/null --verbose --verbose test --verbose printf
+		"$1" awk "$1" sed x=1 "$1" x=1 export then | sed awk ${HOME} --verbose
+	2>/dev/null /usr/bin grep
+	sed "$1" printf then && done $(pwd) --verbose && awk local -eu -eu export
+	test export -eu "$@" local done x=1 local ${HOME} local "$@" && printf &&
+	local readonly /usr/bin readonly "$1" grep 2>/dev/null "$@" && grep &&
+		printf | local "$@" && export then grep x=1 sed 2>/dev/null awk then ${HOME}
+		x=1 'quoted text' echo --verbose
+		'quoted text' 'quoted text'
+	&& readonly readonly 2>/dev/null local ${HOME} "$@" sed -eu ${HOME} awk
+		${HOME} sed "$@" grep $(pwd) awk
+	done && local --verbose 2>/dev/null grep x=1 x=1 done /usr/bin cd
+grep local | done export -eu awk then "$@"
+		| then awk printf printf export
+--verbose ${HOME} ${HOME} then readonly readonly done /usr/bin sed /usr/bin
+		"$1" | 'quoted text' grep grep test ${HOME}
+		cd --verbose --verbose $(pwd) x=1 grep "$1"
+		/usr/bin test -eu printf printf | 'quoted text' 'quoted text'
+	"$1" x=1 echo $(pwd) $(pwd) awk local 2>/dev/null grep "$@" ${HOME} "$@"
+cd echo cd "$1" printf ${HOME}
+		readonly "$@" $(pwd) test sed x=1 echo
+		2>/dev/null cd ${HOME} done echo $(pwd) --verbose ${HOME}
+		export | 2>/dev/null ${HOME} && /usr/bin export 2>/dev/null
+		test echo local ${HOME} ${HOME}
+${HOME} awk test 2>/dev/null readonly echo && $(pwd)
+	grep export test test --verbose sed local echo "$@" 2>/dev/null -eu readonly
+	&& 'quoted text' printf -eu echo --verbose |
+		done x=1 echo echo $(pwd)
+awk "$1" "$1" cd | local && "$@" && local && printf x=1
+grep $(pwd) export grep
+	--verbose printf $(pwd) 'quoted text' local | then 2>/dev/null
+	printf printf test ${HOME} echo x=1
+	printf done $(pwd) printf 2>/dev/null
+	readonly $(pwd) $(pwd) done "$@" printf
+		-eu printf "$1" export 'quoted text' then -eu x=1
+		/usr/bin done && readonly sed test 'quoted text'
+cd | "$1" 2>/dev/null x=1 sed | 'quoted text' awk /usr/bin printf $(pwd)
+	local printf echo && readonly && local sed then cd
+		export local echo readonly sed ${HOME}
+		echo x=1 && /usr/bin | export grep test grep | &&
+done grep "$1" echo then awk "$@" /usr/bin test grep awk --verbose sed test &&
+/usr/bin done "$@" local /usr/bin -eu x=1 /usr/bin "$@" done /usr/bin
+		cd printf awk | readonly | x=1 export x=1 then printf local export $(pwd)
+	&& cd printf -eu local /usr/bin readonly /usr/bin
+-eu printf && --verbose $(pwd) "$@" awk local export /usr/bin local
+test then | grep "$@" "$1" local --verbose awk 2>/dev/null
+	grep grep readonly 2>/dev/null 'quoted text' 'quoted text'
+--verbose 'quoted text' printf grep printf "$1" x=1 -eu awk 2>/dev/null
+	| printf -eu done 2>/dev/null | awk grep $(pwd) then $(pwd) && ${HOME}
+		awk | -eu awk ${HOME} 'quoted text' printf $(pwd) 'quoted text' export
+	x=1 | "$1" test export sed /usr/bin x=1 printf 'quoted text' "$1" then printf
+	echo echo && 'quoted text' "$1" cd -eu sed $(pwd) sed /usr/bin export
+		x=1 sed && printf printf done test "$1" test 2>/dev/null | | readonly
+	'quoted text' echo echo 2>/dev/null && readonly -eu test awk --verbose "$@"
+	local done -eu ${HOME} printf
+	printf local readonly grep local "$@"
+2>/dev/null local -eu -eu done awk export test done
+	--verbose /usr/bin local 'quoted text'
+2>/dev/null x=1 "$1" /usr/bin "$@" cd "$@" cd "$@" readonly --verbose
+		local done export --verbose --verbose | 2>/dev/null
+		| test "$1" "$@" printf && then printf --verbose "$1" 2>/dev/null x=1 /usr/bin
+readonly echo readonly && $(pwd) -eu 'quoted text' x=1 "$1" grep test "$@"
+-eu export 2>/dev/null 2>/dev/null -eu readonly sed awk --verbose readonly export
+	test --verbose x=1 echo $(pwd) cd && then printf export local then local then
+		$(pwd) sed grep 'quoted text' done cd 'quoted text'
+		awk awk ${HOME} "$@"
+	$(pwd) printf test --verbose "$@" then local readonly 'quoted text' -eu && -eu
+	/usr/bin ${HOME} awk local -eu "$1" awk
+	local | sed $(pwd) awk grep then "$1" then then local
+	/usr/bin done printf printf 2>/dev/null then $(pwd) x=1
+/usr/bin grep cd -eu grep "$1" grep local done sed echo
+		| export cd 2>/dev/null --verbose ${HOME} export
+		readonly 2>/dev/null grep 'quoted text'
+	readonly awk sed -eu --verbose export
+2>/dev/null echo cd /usr/bin /usr/bin && echo sed
+'quoted text' /usr/bin grep printf -eu 'quoted text'
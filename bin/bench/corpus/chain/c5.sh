@@ -0,0 +1,2001 @@
+--verbose export awk cd | cd echo grep "$1" test $(pwd) grep 2>/dev/null awk 'quoted text'
+		"$@" printf then local ${HOME} 2>/dev/null
+	/usr/bin test then then x=1 local "$1" $(pwd) && export | | &&
+	x=1 -eu export readonly -eu printf "$@" test printf x=1 grep awk sed x=1
+cd readonly cd x=1 readonly then done "$1" sed $(pwd)
+		"$1" printf printf cd /usr/bin x=1 x=1 then printf $(pwd) local "$@" x=1 export
+then readonly /usr/bin "$1" cd then echo 2>/dev/null export
+grep $(pwd) $(pwd) then ${HOME} $(pwd) export && $(pwd) | /usr/bin readonly ${HOME}
+	awk local done -eu sed /usr/bin sed "$@" done export grep
+		printf export $(pwd) "$@"
+readonly "$1" /usr/bin
+printf --verbose cd -eu -eu /usr/bin x=1 export
+		"$@" && 2>/dev/null printf 'quoted text' && "$@" 2>/dev/null test then sed grep
+	'quoted text' -eu "$1" $(pwd) readonly cd readonly awk echo local cd --verbose
+		local && export "$@" x=1 -eu --verbose echo cd "$1" 'quoted text'
+		2>/dev/null sed echo readonly cd -eu | -eu export
+		"$1" cd done "$@" "$@" "$@" done done && 'quoted text' -eu then | local
+		awk 'quoted text' test && "$@" "$1"
+| "$@" $(pwd) /usr/bin "$@" grep 'quoted text' export 2>/dev/null
+		local export grep 2>/dev/null sed
+	"$@" then readonly export then 2>/dev/null && 'quoted text'
+		&& ${HOME} ${HOME} local -eu ${HOME} readonly "$1" cd awk ${HOME} then $(pwd) $(pwd)
+		done sed 2>/dev/null printf --verbose export sed local done awk "$@"
+	then done then 'quoted text'
+	awk test $(pwd) && "$@" cd -eu "$1" $(pwd) sed printf "$1" 'quoted text'
+		readonly 'quoted text' sed readonly /usr/bin "$1" && -eu "$@" x=1 /usr/bin
+-eu export done 'quoted text' "$1" 'quoted text'
+/usr/bin 2>/dev/null $(pwd) 2>/dev/null x=1 | printf awk
+readonly test readonly then export
+x=1 | echo 2>/dev/null awk "$1" /usr/bin 'quoted text' $(pwd) test $(pwd) awk
+cd test /usr/bin test -eu && local ${HOME} | echo sed | ${HOME} export sed
+		echo sed local "$1" --verbose -eu export
+	test -eu then --verbose x=1 readonly /usr/bin --verbose && readonly
+--verbose ${HOME} 2>/dev/null test ${HOME} awk cd
+		--verbose awk export -eu awk cd cd cd "$1" 'quoted text' grep &&
+test "$@" then /usr/bin | then printf "$1" test $(pwd) | readonly sed "$@"
+	grep grep ${HOME} -eu --verbose then ${HOME} &&
+	awk && -eu 'quoted text' grep "$1" 'quoted text' export
+"$@" "$@" sed local /usr/bin | test "$@" readonly grep
+		sed export grep "$@" 'quoted text' sed
+		${HOME} 2>/dev/null export local x=1 grep /usr/bin printf printf ${HOME}
+export --verbose sed | $(pwd) && && && done export test
+grep && sed /usr/bin 'quoted text' readonly test grep
+awk /usr/bin readonly -eu -eu echo $(pwd) then "$1" "$1" 'quoted text' printf
+		awk awk then echo local x=1 $(pwd) awk
+		awk 'quoted text' cd local "$@" -eu && 'quoted text' printf ${HOME} echo
+	then echo test readonly grep "$1" printf test echo echo $(pwd) export
+	$(pwd) -eu "$@" then export export && 2>/dev/null then export sed --verbose
+x=1 "$@" sed done 'quoted text' readonly | echo -eu ${HOME}
+		/usr/bin 'quoted text' x=1 -eu "$@" $(pwd) local sed 2>/dev/null
+		export echo /usr/bin cd 2>/dev/null
+		export 'quoted text' done -eu "$@" /usr/bin cd 'quoted text' 'quoted text'
+		'quoted text' cd grep test then && grep
+	2>/dev/null echo printf 2>/dev/null
+	printf done test cd 2>/dev/null test printf -eu | /usr/bin sed export local
+		sed sed echo ${HOME} awk
+printf readonly then --verbose 'quoted text' done --verbose
+/usr/bin /usr/bin export cd sed done grep export /usr/bin
+		-eu test awk x=1 awk x=1 ${HOME} $(pwd) echo cd "$@" ${HOME} grep
+		/usr/bin awk grep printf test local test
+	sed x=1 local 'quoted text' ${HOME} $(pwd) x=1 export done grep local
+cd 'quoted text' done export 2>/dev/null
+	| 'quoted text' && | 'quoted text' 2>/dev/null local
+sed && readonly awk ${HOME} export /usr/bin ${HOME} sed
+	$(pwd) printf x=1 echo readonly "$1" local grep "$@" --verbose --verbose 'quoted text'
+		"$@" 2>/dev/null "$1" && test printf local $(pwd) printf -eu
+		done export "$1" echo sed export "$@"
+		"$@" echo --verbose cd echo
+local --verbose test grep printf sed local ${HOME} done
+cd then export export done done -eu done export 2>/dev/null
+	readonly -eu 2>/dev/null
+	"$1" sed then $(pwd) | local awk
+		export awk 'quoted text' test --verbose cd | -eu -eu readonly local
+	local 'quoted text' x=1 --verbose
+	${HOME} x=1 ${HOME} awk
+done export local grep local local 2>/dev/null x=1 -eu
+test local test test && && echo local /usr/bin 'quoted text' then "$@" then awk
+		grep /usr/bin "$@" test --verbose
+sed then then --verbose "$1" $(pwd) printf | local | /usr/bin grep ${HOME}
+		readonly grep x=1 -eu -eu ${HOME} -eu
+		awk printf test local "$@" test cd test export echo "$@" awk grep
+		&& grep -eu done && then "$1" 'quoted text' $(pwd) 'quoted text' 'quoted text'
+	$(pwd) echo printf "$@" export
+cd test $(pwd) printf readonly grep
+	/usr/bin && awk 'quoted text' "$@"
+		echo done && -eu 'quoted text' $(pwd) -eu done --verbose
+		'quoted text' $(pwd) "$@" 2>/dev/null then awk
+then done -eu /usr/bin test test
+		"$1" ${HOME} -eu "$@" "$1" | "$@" "$@" x=1 "$@" 2>/dev/null awk ${HOME} "$@" --verbose
+	2>/dev/null && "$@" "$1" -eu -eu ${HOME} sed printf
+		readonly grep grep export export | local readonly readonly echo test done &&
+		--verbose echo cd printf "$1" x=1 sed
+		2>/dev/null sed then /usr/bin 'quoted text' echo grep
+	2>/dev/null x=1 -eu "$1" done sed echo x=1 -eu echo "$@" $(pwd) -eu 'quoted text'
+$(pwd) test printf local 'quoted text'
+| echo "$1" export local then grep awk cd grep done 2>/dev/null
+local printf x=1 sed local "$1" then "$1" local
+$(pwd) ${HOME} $(pwd) "$1"
+${HOME} $(pwd) 2>/dev/null local test 2>/dev/null local && printf readonly
+		local --verbose echo readonly ${HOME} && "$1" | x=1 --verbose
+	--verbose readonly grep | --verbose export x=1 2>/dev/null
+sed -eu grep then -eu --verbose x=1 done grep /usr/bin | -eu echo
+	${HOME} cd 2>/dev/null x=1 /usr/bin cd -eu -eu grep done then 2>/dev/null
+	export local readonly --verbose readonly sed
+	test test --verbose echo
+export sed sed sed grep cd 2>/dev/null $(pwd) printf
+	printf grep cd then $(pwd) $(pwd) &&
+		"$1" local echo -eu -eu then cd readonly export | "$@"
+	-eu export sed export done 'quoted text'
+	awk 'quoted text' | then grep "$1" /usr/bin awk -eu "$1" "$@" ${HOME} 2>/dev/null
+	awk awk /usr/bin then /usr/bin
+readonly "$@" x=1 && -eu printf x=1 then echo printf x=1 && ${HOME} grep 2>/dev/null
+		grep then local cd done --verbose && 2>/dev/null then 'quoted text' -eu test
+local then local awk awk export then test local
+printf $(pwd) 2>/dev/null $(pwd) export /usr/bin
+	export export && cd 2>/dev/null export awk export
+	-eu "$@" printf "$@" x=1 grep sed "$1" -eu ${HOME} $(pwd) x=1 $(pwd) local cd |
+		/usr/bin --verbose /usr/bin && export $(pwd) export | done local printf
+awk readonly $(pwd) $(pwd)
+	cd awk then /usr/bin && "$1" && local --verbose test
+		printf $(pwd) done done printf grep 'quoted text' /usr/bin 'quoted text'
+--verbose echo /usr/bin done -eu
+	test --verbose | then ${HOME} cd export --verbose grep
+		/usr/bin local echo | | echo 'quoted text' 'quoted text' | local | cd printf sed
+done grep ${HOME} ${HOME} echo x=1
+		export sed | ${HOME} readonly
+| awk done $(pwd) sed && $(pwd) then "$@"
+		&& then printf -eu awk /usr/bin --verbose 2>/dev/null
+'quoted text' --verbose grep ${HOME} x=1 then
+		"$1" grep --verbose echo -eu
+		"$@" sed test | ${HOME} -eu awk
+	sed readonly grep x=1 /usr/bin
+x=1 sed $(pwd) x=1 --verbose
+	${HOME} ${HOME} "$1" $(pwd) echo -eu sed
+		test done readonly x=1 'quoted text' /usr/bin
+	$(pwd) printf -eu --verbose ${HOME} then
+readonly sed export test cd "$@" grep /usr/bin
+		test $(pwd) /usr/bin done export 2>/dev/null x=1 sed "$1"
+	cd 2>/dev/null sed grep echo echo echo | | cd $(pwd) --verbose readonly ${HOME}
+		&& /usr/bin $(pwd) test local $(pwd) --verbose ${HOME} x=1 "$1" ${HOME}
+		${HOME} 'quoted text' 2>/dev/null done "$1" x=1 ${HOME} done done printf
+&& /usr/bin x=1 echo cd then 2>/dev/null "$@"
+"$@" $(pwd) echo then -eu "$1"
+awk 2>/dev/null done cd then $(pwd) /usr/bin 2>/dev/null
+	test --verbose -eu 'quoted text' sed "$@" ${HOME} local printf "$1"
+then export export test $(pwd) then done local
+	awk "$@" x=1 printf -eu && echo $(pwd) readonly
+		grep "$1" ${HOME} awk sed x=1 export /usr/bin ${HOME}
+${HOME} grep export $(pwd) then test echo && awk then
+		"$1" x=1 done sed | sed x=1
+	"$@" && "$1" echo --verbose local then --verbose "$1" awk | awk ${HOME}
+readonly ${HOME} awk then local x=1 $(pwd) grep "$1" test /usr/bin "$1" "$1"
+		then local ${HOME} echo local ${HOME} "$@" local && then printf
+	test -eu done x=1 awk export
+	export 2>/dev/null "$1" $(pwd) ${HOME}
+printf sed done --verbose "$@" "$@" printf "$1"
+		"$@" cd sed | -eu awk then sed local awk "$@" /usr/bin export /usr/bin -eu
+	printf done ${HOME} sed then && 2>/dev/null "$1" cd sed grep
+	then x=1 awk then $(pwd)
+echo then cd cd --verbose printf
+export sed then $(pwd) cd x=1 readonly "$@" echo grep echo $(pwd)
+		test cd 'quoted text' done local awk $(pwd) x=1 ${HOME} "$1" test $(pwd) /usr/bin
+local grep "$@" --verbose "$@" done -eu test /usr/bin test &&
+		-eu 2>/dev/null echo --verbose
+	awk readonly 'quoted text' done ${HOME} awk
+	"$1" export x=1 'quoted text' grep sed 'quoted text'
+	export "$1" ${HOME} echo --verbose 'quoted text'
+		cd | x=1 test ${HOME} 'quoted text'
+		readonly ${HOME} 2>/dev/null then --verbose
+-eu cd readonly x=1 -eu readonly then --verbose "$@" awk -eu export
+		"$@" x=1 sed /usr/bin --verbose
+	-eu test test test export && $(pwd) printf
+	/usr/bin -eu $(pwd) && --verbose
+		&& then echo sed printf echo export && echo --verbose
+readonly --verbose $(pwd) then | sed ${HOME} awk local -eu x=1 x=1 -eu "$1"
+		"$1" $(pwd) echo $(pwd) x=1 test -eu 'quoted text' echo ${HOME} done export done
+	/usr/bin | test 2>/dev/null 2>/dev/null
+		x=1 2>/dev/null done "$@" printf echo 2>/dev/null
+		'quoted text' 2>/dev/null --verbose grep
+'quoted text' readonly export grep printf | export
+		awk 2>/dev/null cd --verbose /usr/bin "$1" |
+		--verbose --verbose readonly /usr/bin awk then ${HOME}
+		/usr/bin test test awk ${HOME} readonly local 'quoted text'
+sed printf | export grep echo test done /usr/bin echo export echo | then
+		"$1" awk printf awk && printf | sed test 2>/dev/null cd "$@" "$1" then
+	$(pwd) test $(pwd) readonly local && echo done 'quoted text'
+${HOME} 'quoted text' "$@" test cd echo grep x=1 --verbose echo
+	sed "$1" | readonly -eu sed readonly | | $(pwd) --verbose "$1"
+		$(pwd) ${HOME} done -eu
+	-eu readonly "$@" test
+| /usr/bin | 'quoted text' readonly 'quoted text' local
+	then "$@" 2>/dev/null $(pwd) x=1 x=1 export local --verbose | cd x=1 2>/dev/null
+	sed && $(pwd) test 'quoted text' export test
+	$(pwd) $(pwd) done test then "$@" awk | local "$1" test test echo export
+		"$@" 2>/dev/null -eu local printf && "$1"
+		cd awk printf done && && -eu grep readonly printf awk sed export
+	sed local readonly && echo cd "$@" -eu readonly &&
+echo 'quoted text' local done cd "$@" done printf done cd
+done && export echo cd x=1 cd && -eu 'quoted text' readonly "$@"
+${HOME} "$@" | cd printf test then printf
+	/usr/bin done --verbose -eu
+		&& awk then echo /usr/bin readonly 'quoted text' export /usr/bin "$@"
+printf $(pwd) -eu ${HOME} "$1" /usr/bin
+		grep 2>/dev/null --verbose grep --verbose printf grep 'quoted text'
+-eu -eu local readonly "$1" 'quoted text' $(pwd) && ${HOME} "$1"
+	"$@" then ${HOME} printf --verbose
+export readonly grep sed printf && -eu ${HOME} done "$@" --verbose export /usr/bin
+		readonly | sed awk done /usr/bin | 2>/dev/null local x=1
+sed ${HOME} sed "$@" $(pwd) | $(pwd) awk grep printf done && cd 'quoted text'
+	${HOME} export echo done /usr/bin sed grep ${HOME} 'quoted text'
+export test local && ${HOME} -eu ${HOME}
+awk 2>/dev/null | "$1" sed /usr/bin x=1 $(pwd) "$@" test ${HOME} "$@" 2>/dev/null
+		done $(pwd) && done | sed local /usr/bin -eu awk sed 'quoted text' ${HOME}
+	grep echo local test --verbose printf export x=1 echo echo
+export x=1 "$1" printf readonly readonly "$@" 2>/dev/null
+		"$1" "$@" awk --verbose /usr/bin done readonly test
+awk -eu done && test grep export | "$1" x=1
+${HOME} readonly "$@" | "$@" | readonly awk 2>/dev/null
+	export local echo &&
+		grep /usr/bin --verbose local x=1 grep awk cd
+export readonly x=1 "$1" x=1 test grep -eu /usr/bin cd | "$@" echo local
+		"$@" 2>/dev/null printf && | "$@" test cd --verbose readonly
+		awk 2>/dev/null "$1" done ${HOME} readonly
+		test sed 2>/dev/null cd 2>/dev/null
+		'quoted text' readonly export export
+		$(pwd) local grep done x=1 $(pwd) then export -eu x=1 'quoted text' echo
+	&& cd local sed ${HOME} "$@" $(pwd) done ${HOME} printf x=1
+	${HOME} $(pwd) "$@" printf "$@" export echo "$@" echo --verbose /usr/bin
+	&& $(pwd) export $(pwd) ${HOME} 2>/dev/null /usr/bin export
+'quoted text' -eu $(pwd) 'quoted text'
+		'quoted text' cd export ${HOME} test cd export "$1"
+	$(pwd) "$1" | cd | /usr/bin grep 2>/dev/null printf local x=1 printf ${HOME} test
+local | then 'quoted text' 'quoted text' then local "$1" test local awk sed
+echo then --verbose then printf test --verbose
+		echo "$@" awk done -eu readonly printf /usr/bin 'quoted text'
+		readonly readonly && /usr/bin readonly printf
+		| printf done test readonly "$@" readonly
+		printf 'quoted text' --verbose readonly 'quoted text' readonly done && readonly
+	readonly | ${HOME} 'quoted text' "$@" -eu export export -eu grep --verbose
+		local --verbose "$1" -eu awk cd $(pwd) test
+		&& $(pwd) printf readonly awk local $(pwd) --verbose "$1"
+	then sed awk "$1" readonly grep cd -eu sed /usr/bin
+	done "$@" local local local test
+sed awk x=1 test cd echo
+	export cd x=1 | then $(pwd) printf &&
+		/usr/bin /usr/bin 'quoted text' ${HOME} sed -eu && export --verbose
+done | -eu 'quoted text' /usr/bin readonly awk --verbose
+		'quoted text' --verbose local "$@" && cd "$@" awk then | && "$@" |
+	awk x=1 awk 'quoted text' printf printf awk done export "$@" 2>/dev/null
+| ${HOME} cd /usr/bin "$1" readonly local
+	&& done -eu /usr/bin && printf --verbose local /usr/bin echo export
+| echo printf --verbose "$1" $(pwd) 2>/dev/null printf test cd
+		done -eu x=1 | local $(pwd) x=1 'quoted text' | readonly 'quoted text' && "$1"
+	"$1" x=1 sed export printf awk then awk /usr/bin printf ${HOME} "$1" done echo
+	${HOME} local readonly /usr/bin
+		--verbose $(pwd) export printf grep "$1" 2>/dev/null
+	echo ${HOME} $(pwd) $(pwd)
+printf /usr/bin /usr/bin --verbose then readonly
+	done sed ${HOME} readonly -eu then ${HOME}
+x=1 x=1 cd readonly $(pwd) 2>/dev/null /usr/bin
+export x=1 grep ${HOME} -eu 'quoted text'
+	| | -eu | done ${HOME} readonly sed ${HOME}
+/usr/bin 'quoted text' 2>/dev/null
+		/usr/bin local /usr/bin $(pwd) x=1 readonly --verbose
+then sed then local | | readonly awk 2>/dev/null test &&
+export "$1" "$@" test printf 2>/dev/null export && readonly
+	/usr/bin readonly test "$1" /usr/bin && cd grep readonly | "$1" then $(pwd)
+	2>/dev/null && sed 2>/dev/null $(pwd)
+	"$1" then x=1 --verbose then
+		/usr/bin test ${HOME} sed
+	test ${HOME} readonly "$1" /usr/bin echo "$@" printf cd cd grep grep
+		export done "$1" grep $(pwd) grep awk test then --verbose
+	"$@" done -eu test "$1" "$1" ${HOME} ${HOME} "$1" 'quoted text' --verbose
+	echo ${HOME} awk then then -eu "$1"
+&& readonly ${HOME} test --verbose readonly 'quoted text'
+	&& && ${HOME} then --verbose test -eu
+	"$1" printf readonly readonly local 'quoted text' "$1"
+	2>/dev/null --verbose $(pwd) local | x=1 echo --verbose test /usr/bin 'quoted text'
+'quoted text' echo sed -eu && -eu 2>/dev/null ${HOME} --verbose 'quoted text'
+		export local local $(pwd) export "$1" test "$@" local | cd --verbose x=1
+		echo sed x=1 /usr/bin echo export /usr/bin test cd done "$1" x=1
+	local --verbose local then /usr/bin then export
+--verbose x=1 --verbose awk /usr/bin test
+	sed local | -eu export --verbose
+readonly && -eu | local
+		done sed --verbose | done readonly
+/usr/bin x=1 "$@" /usr/bin -eu export 2>/dev/null -eu then
+	"$1" 2>/dev/null "$1" then cd 'quoted text' "$1" echo ${HOME} cd sed then readonly
+	-eu test 2>/dev/null "$1" sed local then && printf export cd awk
+	"$@" awk echo --verbose local cd 'quoted text' done sed && $(pwd)
+readonly 'quoted text' x=1 $(pwd) "$@" readonly 2>/dev/null -eu
+'quoted text' export done export | done export
+	${HOME} "$1" ${HOME} echo "$@" cd x=1
+		readonly 'quoted text' x=1 test grep sed local | then $(pwd) echo x=1 2>/dev/null
+readonly && 'quoted text' --verbose $(pwd) echo
+		done readonly echo local cd -eu /usr/bin 'quoted text'
+/usr/bin "$1" test /usr/bin ${HOME} grep done -eu echo
+export awk done -eu readonly -eu 'quoted text' sed
+		echo 'quoted text' then $(pwd) -eu --verbose sed 'quoted text'
+		/usr/bin "$1" --verbose ${HOME} /usr/bin 'quoted text' cd then printf "$1" cd
+		sed awk awk && /usr/bin printf export --verbose | ${HOME}
+	grep echo readonly then
+	/usr/bin && ${HOME} readonly --verbose -eu "$@" $(pwd) $(pwd)
+		echo -eu 2>/dev/null -eu --verbose
+		export 'quoted text' x=1 grep "$1" then
+	"$@" test done "$@" "$@" readonly "$@" --verbose ${HOME}
+	/usr/bin cd ${HOME} awk awk done then
+	"$@" then -eu && done cd "$@" 2>/dev/null "$@" readonly --verbose ${HOME}
+local 'quoted text' -eu cd grep x=1 'quoted text'
+		$(pwd) done cd --verbose -eu awk awk
+	test 2>/dev/null grep then cd export local x=1 sed cd 2>/dev/null
+		echo test awk cd printf readonly echo done
+		sed 2>/dev/null 2>/dev/null
+	printf 'quoted text' awk awk x=1
+	test | "$@" ${HOME} && "$1" test
+	"$@" grep then && "$@" | "$@" cd "$1" x=1 -eu "$1" 2>/dev/null local $(pwd)
+		printf "$@" echo 'quoted text' $(pwd) /usr/bin 2>/dev/null cd awk echo
+		"$@" sed export readonly readonly 2>/dev/null /usr/bin x=1 done
+	| cd ${HOME} 'quoted text' x=1 ${HOME} grep readonly ${HOME}
+	test export printf "$1" -eu grep test cd grep
+$(pwd) test echo && && grep grep && grep readonly | test -eu --verbose
+		| "$1" && 'quoted text' x=1 | export done then sed /usr/bin -eu printf
+		sed readonly export printf ${HOME}
+/usr/bin test "$@" sed x=1 $(pwd) -eu "$1" "$1" $(pwd)
+		/usr/bin $(pwd) awk echo /usr/bin
+		"$1" x=1 cd done /usr/bin
+| x=1 export && /usr/bin done grep sed && $(pwd) ${HOME} "$1" ${HOME}
+		${HOME} | export awk -eu 'quoted text' cd sed printf && grep
+readonly --verbose cd | 2>/dev/null 'quoted text' 'quoted text'
+		export printf echo cd -eu -eu export sed readonly
+		/usr/bin done $(pwd) export awk "$@" -eu
+2>/dev/null printf --verbose
+awk cd $(pwd) 'quoted text' $(pwd) "$@" &&
+then then sed --verbose && $(pwd) --verbose then /usr/bin --verbose x=1
+readonly export grep $(pwd) 2>/dev/null x=1 done /usr/bin
+	/usr/bin done then | printf "$@" printf 2>/dev/null readonly done "$@" 2>/dev/null
+	"$1" | --verbose cd printf ${HOME} && && $(pwd) && "$1"
+	| export $(pwd) readonly "$@" local "$1" $(pwd) "$@" local x=1
+		then export "$1" /usr/bin $(pwd) /usr/bin awk "$1" 'quoted text'
+local sed sed x=1 /usr/bin 2>/dev/null done $(pwd) awk && -eu
+		export printf x=1 | 'quoted text'
+	readonly local "$1" export readonly printf sed then x=1
+printf | test grep cd awk 'quoted text' export "$1" then
+		printf /usr/bin | sed
+sed readonly printf $(pwd) ${HOME} printf cd --verbose readonly sed 'quoted text'
+	${HOME} readonly test 2>/dev/null
+		-eu | cd export | /usr/bin
+		"$@" test local "$1" export grep --verbose readonly "$@" local && "$1"
+		export test cd /usr/bin 'quoted text'
+	cd local 2>/dev/null awk sed export test cd cd echo && 2>/dev/null
+		| test | test -eu --verbose
+		sed test cd readonly cd grep then done /usr/bin done ${HOME}
+done test printf grep 'quoted text' awk 'quoted text' x=1 then
+| "$1" test echo cd $(pwd) "$1" printf -eu sed |
+	printf 'quoted text' "$1" done
+'quoted text' then cd /usr/bin "$@" done echo
+	echo $(pwd) "$@" "$1" done
+	echo printf $(pwd) x=1 /usr/bin grep local 'quoted text'
+echo awk printf local $(pwd) | export 'quoted text' $(pwd) 2>/dev/null
+-eu export awk "$@" /usr/bin done cd export readonly export "$1" x=1 local
+	done -eu sed cd "$@" done printf --verbose 2>/dev/null export done sed -eu
+	--verbose cd readonly /usr/bin "$@" && sed "$1" ${HOME}
+	2>/dev/null echo 2>/dev/null $(pwd) | | ${HOME}
+		$(pwd) grep && ${HOME} $(pwd) grep
+sed | && grep x=1 local /usr/bin
+	done test $(pwd) test printf "$@" grep done $(pwd) local echo && "$@" sed ${HOME}
+		| 'quoted text' && sed $(pwd) $(pwd)
+		done $(pwd) cd /usr/bin $(pwd)
+	export && ${HOME} $(pwd) then 2>/dev/null local local ${HOME}
+	grep | echo --verbose "$@"
+export echo | test $(pwd) printf echo "$1" echo test x=1 readonly
+	export echo ${HOME} echo
+| export ${HOME} | sed $(pwd)
+	printf grep export test cd echo | printf test
+		test /usr/bin | echo "$1" $(pwd) local 2>/dev/null
+		done 'quoted text' printf
+cd | readonly grep 2>/dev/null export export local
+--verbose 2>/dev/null local awk
+		$(pwd) 'quoted text' ${HOME} 2>/dev/null 'quoted text'
+	$(pwd) test done ${HOME} /usr/bin "$1" "$@" test
+		--verbose sed | cd readonly --verbose
+	| | export echo awk --verbose readonly then local local export
+	"$@" "$@" sed printf awk done -eu
+		-eu -eu 2>/dev/null sed ${HOME} && --verbose test && sed && 'quoted text'
+	x=1 x=1 echo 'quoted text' "$@" cd then "$@" "$1" 'quoted text' done local
+	local -eu cd then -eu --verbose cd | awk test
+	then --verbose 2>/dev/null
+	/usr/bin "$1" "$@" echo test | sed -eu readonly /usr/bin export sed "$1" echo
+	printf printf x=1 cd done x=1 printf awk readonly 'quoted text'
+	--verbose 2>/dev/null sed readonly grep printf --verbose awk done && "$1"
+	--verbose echo $(pwd) grep /usr/bin x=1 echo x=1 'quoted text'
+-eu test printf local awk x=1 | then | -eu local --verbose sed awk grep
+then ${HOME} export test | done ${HOME} readonly
+		"$@" 'quoted text' echo && "$1" && "$1"
+		export 'quoted text' grep 'quoted text' sed /usr/bin ${HOME} sed
+		x=1 sed done --verbose && sed test && echo local
+2>/dev/null ${HOME} cd grep test --verbose
+	/usr/bin $(pwd) readonly local readonly sed sed x=1 local | then x=1 grep
+	local sed "$@" grep test $(pwd) test test awk echo local
+		x=1 done -eu /usr/bin /usr/bin export "$@" 2>/dev/null
+		$(pwd) test | -eu && "$1" awk /usr/bin 'quoted text' printf awk -eu
+		awk sed "$@" cd echo | cd cd ${HOME} $(pwd) "$@" cd -eu && x=1 'quoted text'
+test /usr/bin sed /usr/bin
+	grep local 2>/dev/null -eu printf then test 'quoted text' | then printf printf
+		grep ${HOME} x=1 -eu && x=1 "$1" 2>/dev/null
+$(pwd) done && 2>/dev/null | echo
+		printf then 'quoted text' /usr/bin --verbose --verbose
+2>/dev/null x=1 cd -eu grep 'quoted text'
+		export grep | "$1" echo -eu
+		"$@" done then $(pwd) | ${HOME} "$@" x=1 ${HOME}
+	then /usr/bin -eu $(pwd) sed && cd awk 'quoted text'
+		--verbose | test grep echo x=1 printf && done
+		readonly sed && --verbose ${HOME} awk
+		cd | x=1 -eu "$1" "$@" readonly 'quoted text' grep /usr/bin
+readonly | grep echo ${HOME} -eu test --verbose && awk ${HOME} sed grep
+	echo && cd $(pwd) && "$1" $(pwd) 2>/dev/null readonly
+sed grep | readonly then sed local awk export cd test -eu ${HOME} sed 'quoted text'
+| -eu sed -eu --verbose readonly
+		--verbose 'quoted text' "$1" awk -eu done cd then
+	&& then test 'quoted text' done then cd readonly awk 'quoted text' ${HOME}
+		"$1" printf | echo printf sed ${HOME} readonly sed x=1 "$1" --verbose 'quoted text'
+		test --verbose 2>/dev/null 'quoted text'
+		${HOME} ${HOME} -eu "$1" "$@" awk readonly "$1" sed --verbose done
+	--verbose 'quoted text' grep | "$@" readonly test
+done -eu && awk ${HOME} x=1 "$1"
+	--verbose ${HOME} cd readonly
+		2>/dev/null 2>/dev/null sed sed readonly
+		cd local printf done awk echo ${HOME} export | readonly 2>/dev/null sed 'quoted text'
+readonly readonly awk done grep x=1 --verbose
+${HOME} -eu --verbose ${HOME}
+	x=1 then cd --verbose ${HOME} -eu x=1 printf "$@"
+		export ${HOME} 'quoted text'
+		test grep 2>/dev/null then "$@" "$1" 2>/dev/null $(pwd) sed 2>/dev/null export echo
+	then then local 2>/dev/null cd awk done /usr/bin x=1 grep
+	-eu "$1" 'quoted text' && $(pwd) && local 'quoted text'
+	echo awk export local echo | done test "$1" echo $(pwd) test test
+		/usr/bin --verbose $(pwd) readonly then --verbose echo readonly
+test grep | grep sed x=1 cd printf -eu export
+"$1" test 2>/dev/null --verbose
+		2>/dev/null ${HOME} "$@" sed
+then --verbose ${HOME} local export ${HOME}
+	'quoted text' test 2>/dev/null "$@" sed "$@" grep | awk done
+		2>/dev/null local /usr/bin echo done
+	| then /usr/bin $(pwd) x=1 'quoted text'
+		$(pwd) --verbose then done test local "$@" | 'quoted text' x=1 && then export
+		x=1 then test "$1" x=1 grep done done x=1 $(pwd) ${HOME} --verbose
+	printf then echo grep 2>/dev/null 'quoted text' local
+		export then test sed -eu printf /usr/bin then --verbose
+	2>/dev/null | awk "$@" ${HOME} /usr/bin then awk
+		$(pwd) printf "$@" && 2>/dev/null printf printf $(pwd) export && &&
+		readonly -eu printf ${HOME} cd ${HOME} && "$@" ${HOME} 'quoted text'
+	&& local -eu local | printf 'quoted text' 'quoted text'
+	2>/dev/null ${HOME} 2>/dev/null awk --verbose done
+		/usr/bin /usr/bin printf 'quoted text' printf
+/usr/bin test && awk printf 'quoted text' $(pwd) "$@" local cd printf
+${HOME} printf sed x=1 then done -eu $(pwd)
+	cd awk 2>/dev/null --verbose --verbose
+		readonly -eu 'quoted text' sed 'quoted text' export
+	"$@" | | then $(pwd) export grep grep "$1" local awk
+	"$1" --verbose && --verbose sed 2>/dev/null done /usr/bin test $(pwd) | grep
+	echo then grep --verbose --verbose done done x=1 local export "$1" done
+		"$@" readonly awk 2>/dev/null "$1" | echo | grep then "$@"
+	| done grep printf -eu export | test 2>/dev/null readonly grep local
+	local local --verbose grep local
+--verbose export -eu $(pwd)
+echo $(pwd) "$@" local done -eu test --verbose "$1"
+	-eu --verbose printf ${HOME} 2>/dev/null | -eu "$@" readonly
+	done ${HOME} /usr/bin awk local then &&
+x=1 x=1 echo 'quoted text'
+		local /usr/bin $(pwd) 2>/dev/null x=1 -eu done 2>/dev/null local printf sed
+		2>/dev/null --verbose /usr/bin
+done done printf -eu x=1 done
+		${HOME} local echo 'quoted text' -eu local && local
+		x=1 "$@" "$1" $(pwd) x=1 done | cd /usr/bin "$@"
+sed /usr/bin readonly 'quoted text'
+	awk local --verbose /usr/bin x=1 $(pwd) "$@" test --verbose
+readonly --verbose export ${HOME} local /usr/bin "$@" && readonly readonly
+$(pwd) 'quoted text' echo 'quoted text'
+		--verbose done local /usr/bin
+	sed local /usr/bin readonly
+	--verbose -eu cd -eu echo
+	echo local test export then local --verbose | export -eu done sed then
+	printf 'quoted text' x=1 $(pwd) --verbose sed
+	&& $(pwd) local 2>/dev/null /usr/bin awk test | local 2>/dev/null 2>/dev/null
+cd test then sed grep $(pwd) readonly done 2>/dev/null
+| export ${HOME} && printf "$@" | --verbose --verbose --verbose
+	x=1 | then -eu awk cd "$1" -eu /usr/bin awk sed local cd cd ${HOME} sed export
+	cd | echo && then awk local "$1" then done
+"$@" export && 2>/dev/null test awk 'quoted text'
+		"$@" && 2>/dev/null printf then then ${HOME} "$1" printf test sed test
+		test grep readonly done $(pwd) x=1 /usr/bin x=1 export && ${HOME} cd
+		&& grep then /usr/bin local printf
+awk --verbose echo | --verbose 2>/dev/null
+	export then "$@" then -eu -eu $(pwd) 2>/dev/null
+sed 2>/dev/null sed grep --verbose --verbose /usr/bin printf 'quoted text'
+	printf local awk --verbose printf
+	sed ${HOME} -eu local 2>/dev/null $(pwd) $(pwd) sed "$@" grep 'quoted text'
+		printf x=1 export && printf done readonly | awk /usr/bin cd grep ${HOME}
+		sed "$@" "$1" && awk sed grep 2>/dev/null /usr/bin ${HOME} printf
+		readonly grep local local test local --verbose x=1 local 2>/dev/null
+export printf echo export cd -eu -eu "$1" --verbose echo sed ${HOME} --verbose
+	grep "$1" | export && | export local printf 'quoted text' test sed then
+cd x=1 | && --verbose "$1"
+	then then /usr/bin then x=1 readonly
+	/usr/bin && ${HOME} -eu echo -eu cd then grep -eu --verbose local printf cd export
+		readonly --verbose sed cd local -eu && "$@"
+2>/dev/null ${HOME} -eu then export then 'quoted text' /usr/bin
+	'quoted text' && 'quoted text'
+printf /usr/bin export --verbose test $(pwd) readonly awk readonly done | 2>/dev/null
+	grep local printf local x=1 export awk "$1" x=1 cd awk "$@" cd "$@" 'quoted text'
+--verbose x=1 grep "$@" sed sed "$@" /usr/bin -eu echo
+	'quoted text' x=1 awk "$@"
+		echo done /usr/bin export sed cd | export "$1"
+export echo export echo then then "$1"
+		sed && 2>/dev/null | "$1" readonly $(pwd) local /usr/bin /usr/bin | readonly
+	grep && $(pwd) export done cd sed --verbose "$@" readonly sed then printf
+awk 'quoted text' export | local export 'quoted text' then | "$@" "$1"
+		"$1" readonly echo && echo -eu
+		| then local test -eu grep "$1" "$@" local readonly "$@" "$1"
+	${HOME} "$1" echo $(pwd) 'quoted text' 'quoted text'
+"$@" readonly sed cd cd then "$1"
+		export readonly --verbose "$1" "$1" $(pwd) readonly | | --verbose done sed
+"$@" -eu readonly echo -eu ${HOME} export
+		-eu echo 'quoted text' then grep && grep readonly
+		x=1 echo local then /usr/bin echo sed grep
+	local 2>/dev/null done grep then printf
+cd --verbose export "$@" done 2>/dev/null ${HOME}
+	sed test /usr/bin test grep --verbose 2>/dev/null sed /usr/bin
+	sed 2>/dev/null test sed printf 'quoted text' done "$1" | 2>/dev/null
+echo grep then x=1 then "$1" local 'quoted text' then
+	readonly && readonly "$@"
+local "$1" test printf | "$@" awk then done 'quoted text' ${HOME}
+	x=1 printf cd grep x=1 printf && "$1"
+readonly grep printf export x=1
+	export cd echo $(pwd) sed x=1 grep readonly --verbose
+	echo "$1" cd test echo x=1 --verbose printf -eu "$@" sed sed sed 2>/dev/null
+	done readonly $(pwd) sed && 'quoted text' then
+		/usr/bin 'quoted text' $(pwd) cd ${HOME} -eu local ${HOME} readonly | 'quoted text'
+		2>/dev/null test readonly $(pwd) --verbose local test 'quoted text'
+	x=1 && /usr/bin awk awk 'quoted text' local && /usr/bin awk
+	sed readonly 2>/dev/null local cd --verbose
+		export awk ${HOME} cd /usr/bin -eu cd | export && then awk
+		readonly cd cd awk cd "$1" echo x=1 local then readonly grep "$@" echo
+$(pwd) then awk local awk done $(pwd) ${HOME} /usr/bin printf
+		/usr/bin export test "$@" 'quoted text' sed "$@" awk
+	-eu "$1" done sed -eu awk echo printf $(pwd) /usr/bin "$1" "$1" | cd | sed local
+		done local 2>/dev/null local then echo then
+		echo test done "$@" 2>/dev/null printf "$1"
+		&& /usr/bin echo ${HOME} done cd done export "$1" local 2>/dev/null
+	/usr/bin "$1" export "$@" 'quoted text' "$@" then done echo
+		--verbose sed ${HOME} 2>/dev/null -eu -eu | export "$@" 2>/dev/null | ${HOME}
+		/usr/bin --verbose 'quoted text'
+"$@" 'quoted text' "$1" ${HOME} /usr/bin --verbose
+	"$@" --verbose 'quoted text' local "$1" test echo awk then
+sed then local done local test readonly x=1 local test && echo
+	awk --verbose echo 2>/dev/null
+	echo sed awk "$1" "$@" printf "$@" then |
+		test --verbose printf test | then 2>/dev/null && awk echo
+		'quoted text' cd echo cd cd readonly x=1
+		$(pwd) sed "$1" x=1 cd echo 2>/dev/null grep done local &&
+	then ${HOME} then --verbose | /usr/bin awk ${HOME} $(pwd) "$@" $(pwd)
+		'quoted text' /usr/bin done local
+awk 'quoted text' readonly
+	export 2>/dev/null 2>/dev/null export $(pwd) /usr/bin sed ${HOME} $(pwd) "$1" echo
+	"$@" echo ${HOME} $(pwd) && x=1
+	&& --verbose echo --verbose awk 'quoted text' x=1 2>/dev/null "$1" test /usr/bin
+"$@" test "$1" --verbose && sed printf then /usr/bin |
+	sed sed "$1" sed 2>/dev/null --verbose grep cd --verbose grep test
+	readonly -eu --verbose $(pwd) "$@" awk echo local local then export export && grep
+2>/dev/null 2>/dev/null awk -eu
+		sed /usr/bin export 'quoted text' sed ${HOME} test
+		done awk test local then done $(pwd)
+grep then --verbose export 'quoted text' local test && /usr/bin echo /usr/bin
+x=1 readonly done && |
+		"$@" done test cd then 'quoted text' export 2>/dev/null $(pwd) grep &&
+		printf 2>/dev/null test && export readonly --verbose echo /usr/bin export 'quoted text'
+	$(pwd) 2>/dev/null 'quoted text' export x=1 ${HOME} "$@" -eu --verbose $(pwd)
+	"$@" && readonly /usr/bin "$@" readonly /usr/bin
+		done | --verbose printf done awk done printf 2>/dev/null
+x=1 readonly awk readonly -eu awk done done export x=1 'quoted text'
+&& readonly "$@" test then ${HOME} $(pwd) echo readonly "$@"
+		local sed local readonly
+sed printf then readonly 2>/dev/null "$1" /usr/bin grep test 'quoted text'
+	/usr/bin /usr/bin then then "$@"
+	local | 'quoted text' | cd then done
+grep then "$@" grep readonly test test sed 'quoted text' x=1 --verbose
+	&& --verbose 'quoted text'
+${HOME} -eu --verbose echo $(pwd) /usr/bin
+		| readonly $(pwd) -eu awk "$@" cd --verbose
+	done then --verbose $(pwd)
+	'quoted text' 2>/dev/null && done 'quoted text' grep "$@" | awk ${HOME} grep
+		"$1" && readonly readonly x=1 readonly
+test sed sed -eu "$@" /usr/bin 'quoted text' "$@" test $(pwd) --verbose
+	$(pwd) grep awk export --verbose cd echo
+"$1" 2>/dev/null grep done --verbose sed && ${HOME} test
+		&& grep "$@" cd cd /usr/bin --verbose
+"$1" $(pwd) --verbose && /usr/bin && done local awk $(pwd)
+	&& sed sed --verbose sed echo $(pwd) 'quoted text' -eu then "$1" "$1"
+		grep 2>/dev/null grep echo x=1 $(pwd) && echo grep grep export grep
+	/usr/bin ${HOME} export | $(pwd) awk
+export grep -eu --verbose ${HOME} cd test awk ${HOME} cd printf ${HOME} 2>/dev/null
+2>/dev/null awk 'quoted text' -eu export ${HOME} ${HOME} printf echo x=1 printf
+		| x=1 local "$@" $(pwd) --verbose export local ${HOME} x=1 ${HOME}
+		awk grep x=1 --verbose "$1"
+	printf "$@" awk grep | export x=1 readonly done /usr/bin sed
+/usr/bin "$1" && -eu -eu $(pwd) cd "$@" $(pwd) cd readonly $(pwd) 'quoted text'
+	2>/dev/null -eu awk local && readonly test "$1" test && 2>/dev/null echo
+	local echo x=1 ${HOME} cd awk "$@" then ${HOME} && ${HOME} printf readonly &&
+	&& && done --verbose /usr/bin local
+		$(pwd) ${HOME} test printf local --verbose then ${HOME}
+	x=1 printf local sed 2>/dev/null 'quoted text' sed local -eu test "$1" grep export
+grep done "$1" grep cd | x=1 "$1" ${HOME}
+	| ${HOME} $(pwd) "$1" "$1" then done local local ${HOME} /usr/bin
+		local /usr/bin --verbose --verbose ${HOME} ${HOME} x=1 "$@" -eu && && cd 'quoted text'
+done 2>/dev/null printf "$@" local --verbose /usr/bin export --verbose
+2>/dev/null grep export done "$1" test awk cd
+/usr/bin /usr/bin local readonly
+-eu x=1 | /usr/bin --verbose
+	local $(pwd) sed export "$@" 2>/dev/null ${HOME}
+	--verbose cd local test cd | /usr/bin "$@" awk "$1" then 'quoted text'
+		readonly printf export local cd readonly readonly test -eu done --verbose
+	then grep test ${HOME} ${HOME} test
+done && echo test export -eu && echo cd | local x=1
+		export ${HOME} sed "$1" test
+	&& readonly export --verbose $(pwd) 2>/dev/null -eu ${HOME} export echo export sed
+echo "$@" export -eu test /usr/bin
+'quoted text' printf $(pwd) readonly "$@"
+-eu printf && grep | /usr/bin "$1" test x=1 "$@"
+	local x=1 printf 2>/dev/null ${HOME} echo --verbose awk local
+	&& done local | 'quoted text' done -eu $(pwd) echo echo test
+		x=1 local awk "$1" 'quoted text' sed 'quoted text' && "$1" "$1" test /usr/bin awk
+	$(pwd) printf sed 2>/dev/null readonly
+	-eu cd done readonly awk "$@" export $(pwd) 2>/dev/null 'quoted text' $(pwd)
+	-eu --verbose sed ${HOME}
+	printf | sed 'quoted text' && cd
+	x=1 export export awk test export done
+-eu "$@" test grep test ${HOME} cd x=1 ${HOME} && readonly && 2>/dev/null
+	$(pwd) then x=1 /usr/bin
+		$(pwd) ${HOME} /usr/bin "$@"
+		&& x=1 test awk $(pwd) 2>/dev/null
+		export export grep -eu 2>/dev/null
+	export readonly -eu --verbose local printf readonly then local
+		test echo $(pwd) sed readonly x=1 x=1 x=1 --verbose -eu awk $(pwd) --verbose
+awk local | readonly test x=1 printf grep export export /usr/bin done "$1"
+		sed echo "$@" --verbose 2>/dev/null x=1 done "$@" &&
+$(pwd) 'quoted text' /usr/bin
+		grep $(pwd) echo x=1 printf 2>/dev/null export "$@" grep /usr/bin
+--verbose "$1" && 'quoted text' sed then $(pwd) x=1
+	done echo test "$@" $(pwd) x=1 && printf done ${HOME} --verbose grep grep then
+		"$1" awk --verbose ${HOME} done -eu -eu awk
+cd readonly $(pwd) "$@" /usr/bin cd readonly
+	&& export export local "$@" ${HOME} $(pwd) 2>/dev/null export 'quoted text'
+&& echo ${HOME} cd readonly ${HOME} grep done local
+		done awk awk done export /usr/bin ${HOME} printf local
+2>/dev/null -eu local ${HOME} printf echo
+		echo && ${HOME} awk done 2>/dev/null
+	grep echo "$1" "$@" echo | printf ${HOME} sed 2>/dev/null
+done readonly test | --verbose -eu readonly export /usr/bin && sed
+		cd | $(pwd) | grep test local readonly
+		"$1" 'quoted text' test cd test local &&
+	&& done "$@" ${HOME} "$1" && test "$1" ${HOME} x=1 echo test --verbose /usr/bin
+cd then x=1 /usr/bin --verbose sed "$@" then | /usr/bin -eu
+	&& | 2>/dev/null sed /usr/bin /usr/bin
+| printf cd --verbose awk echo --verbose 2>/dev/null /usr/bin test test echo
+	sed grep printf "$1" /usr/bin $(pwd) "$1"
+	awk -eu "$@" 'quoted text' export 'quoted text' /usr/bin /usr/bin
+	then ${HOME} "$1" && "$@" | printf test x=1 grep
+	| sed export readonly x=1 /usr/bin local echo sed "$1" printf then | printf echo
+echo export grep /usr/bin awk && export && "$@" $(pwd)
+	cd $(pwd) | --verbose cd x=1 --verbose printf
+"$@" awk && sed sed "$1" ${HOME} readonly cd && done "$@" test ${HOME}
+$(pwd) cd cd "$@" x=1 "$1"
+	echo 2>/dev/null "$1" -eu "$1" && printf export test | $(pwd) local "$1"
+&& --verbose awk printf | test
+	grep local "$1" echo readonly printf x=1 grep test export
+then printf "$@" "$@" --verbose printf grep readonly
+done /usr/bin export ${HOME} awk /usr/bin "$1"
+	printf local cd && awk test
+$(pwd) $(pwd) awk echo 'quoted text' printf printf
+| /usr/bin echo ${HOME} done 2>/dev/null
+done --verbose | "$1" echo ${HOME} ${HOME}
+		cd cd $(pwd) "$1" cd printf x=1 grep 'quoted text' test printf 'quoted text' printf
+	then && readonly /usr/bin printf cd 'quoted text'
+awk export && sed /usr/bin cd done echo test readonly
+	cd printf local -eu "$1" x=1 "$@" ${HOME} readonly x=1
+	awk printf $(pwd) readonly && -eu cd export printf cd --verbose
+		sed --verbose grep $(pwd) printf
+		then 2>/dev/null sed "$1" $(pwd) -eu done echo && done done
+		&& && test /usr/bin test 2>/dev/null
+	/usr/bin printf $(pwd) grep 'quoted text' then sed "$1" awk grep $(pwd)
+test $(pwd) --verbose && test awk sed cd awk /usr/bin test
+		2>/dev/null ${HOME} readonly awk x=1 ${HOME} export 2>/dev/null 2>/dev/null -eu
+		cd | grep | local cd done grep test --verbose then "$@" x=1 | awk then done "$1"
+	&& 2>/dev/null | then $(pwd) -eu done 'quoted text'
+		printf echo "$1" readonly | awk "$@" --verbose
+	echo echo /usr/bin "$@" /usr/bin 2>/dev/null
+		sed grep $(pwd) --verbose ${HOME} 2>/dev/null grep cd then
+		x=1 sed "$@" ${HOME} printf
+		&& cd 'quoted text' grep | then "$@" x=1 /usr/bin |
+	$(pwd) ${HOME} printf $(pwd) local
+		awk export /usr/bin |
+	done readonly grep 2>/dev/null "$@"
+| | && cd export | $(pwd) && echo awk readonly --verbose
+		grep $(pwd) /usr/bin ${HOME} then sed local |
+	awk 2>/dev/null done x=1 "$1" 'quoted text' test local "$1"
+&& /usr/bin 'quoted text' /usr/bin "$@" "$1" done export
+	$(pwd) echo 'quoted text' "$@" echo && -eu printf
+"$@" x=1 "$1" grep --verbose grep --verbose grep "$@" -eu 'quoted text'
+	--verbose x=1 -eu "$@" sed sed awk sed 'quoted text'
+		test | local | grep --verbose export x=1 export grep
+		/usr/bin 'quoted text' x=1 test 2>/dev/null readonly grep 'quoted text' sed
+-eu local readonly /usr/bin cd "$@"
+/usr/bin && done "$@" "$@" $(pwd) /usr/bin grep | &&
+	test -eu | printf /usr/bin grep "$@" 2>/dev/null then grep readonly done
+	export ${HOME} "$1" grep test echo done readonly
+		echo --verbose "$@" /usr/bin "$1"
+sed local done $(pwd) "$1" "$1" --verbose /usr/bin grep 2>/dev/null
+		2>/dev/null done echo "$1" printf test | then local grep
+x=1 | grep 'quoted text' readonly cd sed grep readonly x=1 ${HOME} &&
+		printf "$@" awk 'quoted text' readonly
+grep --verbose then x=1 printf local grep $(pwd) then --verbose done
+		2>/dev/null sed echo printf /usr/bin grep echo
+		awk && test readonly grep printf 2>/dev/null done /usr/bin readonly 2>/dev/null
+		x=1 local printf grep 'quoted text' 2>/dev/null
+	local 'quoted text' sed | printf test
+	local | then cd | 'quoted text'
+		/usr/bin export && then sed awk local awk awk -eu "$@" "$@" "$1" $(pwd)
+echo x=1 $(pwd) -eu done /usr/bin readonly x=1 --verbose |
+-eu "$@" local cd 'quoted text' test ${HOME} then /usr/bin
+		local then echo local $(pwd) /usr/bin "$1"
+cd 2>/dev/null awk echo
+	${HOME} echo then 2>/dev/null echo export && $(pwd) printf then
+	printf readonly | echo local then ${HOME} --verbose "$1" "$@" awk x=1 2>/dev/null
+	then && /usr/bin 'quoted text'
+	local ${HOME} test done /usr/bin $(pwd) test ${HOME} "$@" then test ${HOME} "$@"
+		${HOME} sed -eu sed | sed && ${HOME} grep printf x=1 --verbose ${HOME} export
+		printf awk -eu ${HOME} cd ${HOME} grep | awk | done
+	$(pwd) sed echo | local local local 'quoted text' readonly x=1 x=1 /usr/bin
+$(pwd) export done export awk echo
+sed test echo local ${HOME} printf
+		${HOME} readonly awk printf sed then -eu -eu echo
+	| test cd local printf -eu | | echo --verbose 'quoted text' &&
+readonly awk /usr/bin | local x=1 grep export done x=1 printf /usr/bin
+	2>/dev/null local awk sed grep readonly
+-eu sed printf 'quoted text' echo "$1" $(pwd)
+sed "$1" | ${HOME} 'quoted text' -eu 'quoted text'
+	awk --verbose 'quoted text' printf "$1" /usr/bin
+awk "$@" test test -eu
+		/usr/bin sed 'quoted text' test "$@" "$@" | ${HOME} export --verbose done
+		${HOME} cd readonly printf grep cd printf $(pwd) awk && 2>/dev/null printf
+		printf 2>/dev/null ${HOME} local export --verbose grep $(pwd) sed /usr/bin
+	-eu local /usr/bin readonly readonly local local --verbose
+		$(pwd) sed x=1 'quoted text' sed $(pwd) printf
+	--verbose cd printf 'quoted text' sed 'quoted text' | 2>/dev/null $(pwd)
+printf sed $(pwd) printf test
+	printf "$@" -eu -eu awk x=1 sed test -eu -eu 'quoted text'
+		2>/dev/null "$@" ${HOME} -eu echo ${HOME} export -eu
+		test grep && | sed -eu done done export readonly export export "$@"
+	'quoted text' echo then 'quoted text' echo
+		test /usr/bin "$@" | done "$1" 'quoted text' grep export grep
+sed | export local "$@" $(pwd) 2>/dev/null 2>/dev/null
+	echo /usr/bin --verbose cd
+	| -eu grep /usr/bin export local 'quoted text' sed x=1 printf --verbose 'quoted text'
+/usr/bin grep ${HOME} "$1" sed echo && /usr/bin printf /usr/bin
+		readonly test echo grep export printf echo
+	${HOME} cd export done 'quoted text'
+	test && readonly 2>/dev/null
+	x=1 --verbose echo local x=1 | -eu awk 'quoted text' $(pwd) test
+	--verbose /usr/bin sed "$@" && | "$1" export 'quoted text'
+export test 'quoted text'
+	readonly /usr/bin 'quoted text' awk echo sed then local
+	${HOME} x=1 sed x=1 readonly ${HOME} local && done awk export
+		&& -eu 'quoted text' cd local readonly test printf -eu
+	--verbose printf -eu local grep x=1 local
+		cd && local test then x=1 ${HOME} $(pwd)
+--verbose /usr/bin export && cd
+	printf -eu 'quoted text' awk && grep test x=1 printf /usr/bin
+cd 'quoted text' /usr/bin x=1 grep
+	&& 2>/dev/null $(pwd) export $(pwd) then printf
+		cd awk /usr/bin awk done then
+	${HOME} 2>/dev/null done 'quoted text'
+	2>/dev/null awk export export printf
+		2>/dev/null done --verbose done $(pwd) -eu
+"$@" "$@" && export x=1 cd sed readonly
+| $(pwd) $(pwd) /usr/bin 'quoted text' cd echo
+printf awk "$@" && 'quoted text' -eu awk && ${HOME} | x=1 then && cd test 'quoted text'
+		$(pwd) 'quoted text' sed "$1" /usr/bin local && ${HOME} $(pwd)
+readonly test sed local awk export echo
+		| then --verbose /usr/bin
+	${HOME} | then 'quoted text' | printf ${HOME} -eu printf --verbose
+		echo sed grep x=1 'quoted text'
+		awk echo /usr/bin ${HOME} then test | echo
+		printf "$@" ${HOME} x=1 -eu /usr/bin then echo then sed done
+	local then x=1 then /usr/bin test
+--verbose 2>/dev/null cd sed cd 2>/dev/null
+	echo printf sed && ${HOME} done
+	cd export awk export $(pwd) grep printf && | readonly 2>/dev/null
+		local && done "$@" local --verbose test 'quoted text'
+		sed "$1" cd cd ${HOME} | "$@" cd awk awk
+$(pwd) echo grep grep then echo && | test 2>/dev/null export 'quoted text'
+		printf 2>/dev/null -eu && awk
+		-eu readonly printf grep echo -eu readonly
+	/usr/bin test test sed echo "$1" 'quoted text' grep
+		2>/dev/null local done -eu done $(pwd) done
+${HOME} && 'quoted text' $(pwd) then 2>/dev/null 'quoted text'
+	${HOME} ${HOME} 'quoted text' awk echo $(pwd) grep
+"$@" -eu /usr/bin awk && test printf "$1" 2>/dev/null
+		x=1 sed 2>/dev/null 'quoted text' /usr/bin "$1" cd -eu /usr/bin done -eu printf
+awk readonly "$@" $(pwd) -eu cd test export sed
+echo ${HOME} local then grep --verbose sed
+		cd "$1" test cd --verbose echo test /usr/bin done x=1 ${HOME} local test readonly
+	"$@" readonly $(pwd) local grep | printf 'quoted text' sed cd grep -eu
+		/usr/bin && sed cd -eu
+		grep x=1 then cd then 2>/dev/null --verbose
+sed 'quoted text' 'quoted text' cd $(pwd) done echo | $(pwd)
+printf local readonly readonly --verbose
+		-eu cd 'quoted text' cd then | echo "$@"
+	cd awk -eu "$@" 'quoted text' x=1 done
+	echo | cd -eu x=1 sed 'quoted text' --verbose x=1 done local |
+	export ${HOME} test awk -eu x=1 'quoted text' done ${HOME} | | local printf grep
+		readonly sed -eu 'quoted text' 'quoted text'
+2>/dev/null x=1 cd export test then local --verbose awk readonly
+	| done then test echo ${HOME} /usr/bin && "$@" 2>/dev/null && printf echo printf
+&& sed printf awk printf local 2>/dev/null $(pwd) sed 2>/dev/null readonly
+	test -eu test -eu cd printf | done --verbose awk && awk printf $(pwd)
+sed | sed x=1 'quoted text' ${HOME} sed export test then $(pwd) $(pwd)
+2>/dev/null export awk printf "$1" done /usr/bin export
+		awk readonly --verbose -eu local "$1" ${HOME}
+		awk | /usr/bin ${HOME} /usr/bin 'quoted text' && echo
+		printf readonly $(pwd) sed awk "$1" -eu
+"$@" test --verbose ${HOME} && echo export export $(pwd) 'quoted text' echo
+	'quoted text' -eu 'quoted text' then
+	local 'quoted text' ${HOME} ${HOME} "$1" cd | | "$1" sed
+echo test readonly | ${HOME}
+2>/dev/null echo export then echo grep then local done test cd && echo --verbose
+local export 2>/dev/null printf 2>/dev/null
+	"$1" "$1" sed x=1 "$@" x=1 export ${HOME}
+		--verbose && /usr/bin echo cd $(pwd) | export echo
+sed "$@" sed printf x=1 readonly done
+x=1 2>/dev/null test readonly
+		&& ${HOME} 'quoted text' "$1" local --verbose local "$@"
+readonly 2>/dev/null ${HOME}
+		/usr/bin x=1 -eu export 2>/dev/null
+		$(pwd) /usr/bin grep --verbose test 2>/dev/null
+		printf printf sed /usr/bin sed grep x=1 -eu | echo test /usr/bin ${HOME} &&
+	--verbose x=1 local then x=1 printf sed done "$@" test sed /usr/bin done
+	export $(pwd) x=1 x=1
+		"$@" "$1" local | "$1" test done && export |
+	'quoted text' done && ${HOME} 2>/dev/null 2>/dev/null
+test done printf printf x=1 x=1 "$1" /usr/bin echo cd
+		&& -eu echo $(pwd) 'quoted text' done
+	export grep sed cd /usr/bin test test grep 2>/dev/null local 'quoted text'
+		grep -eu "$1" cd x=1 test x=1 | "$@" "$1" "$@" done 2>/dev/null
+$(pwd) && printf --verbose x=1 echo sed /usr/bin test 'quoted text'
+$(pwd) 'quoted text' "$@" 2>/dev/null
+		sed && printf /usr/bin awk --verbose grep
+	${HOME} 2>/dev/null "$1" cd printf && /usr/bin -eu sed export --verbose "$@" "$@"
+	awk done -eu "$@" echo cd 2>/dev/null local 'quoted text'
+	'quoted text' done ${HOME} | /usr/bin -eu test then $(pwd) /usr/bin export
+test | ${HOME} cd done "$@" /usr/bin awk --verbose "$1"
+		2>/dev/null 2>/dev/null echo /usr/bin
+readonly local awk && && grep
+&& 2>/dev/null grep /usr/bin 'quoted text' export /usr/bin grep test test readonly
+$(pwd) "$@" echo 'quoted text' local
+		x=1 printf test 'quoted text' then echo awk 2>/dev/null local then readonly
+	-eu -eu export x=1 x=1 ${HOME} $(pwd) /usr/bin $(pwd) echo printf
+readonly x=1 export && /usr/bin export "$@" done "$1" &&
+printf --verbose $(pwd) -eu test --verbose /usr/bin -eu &&
+	test x=1 "$1" ${HOME} "$@" 2>/dev/null
+	/usr/bin done cd done test --verbose $(pwd) printf test then then x=1 --verbose
+'quoted text' 2>/dev/null sed local readonly
+		echo test test "$1" /usr/bin printf
+	'quoted text' --verbose test --verbose "$@" "$@" ${HOME}
+"$@" 'quoted text' | sed 'quoted text' | -eu test | /usr/bin
+	"$@" cd "$1" && x=1 readonly awk done $(pwd) -eu /usr/bin grep
+		sed export | --verbose cd &&
+		sed ${HOME} /usr/bin awk local cd && | readonly awk awk
+		export printf done grep readonly sed echo --verbose
+printf then test x=1
+x=1 && --verbose && readonly
+	$(pwd) --verbose 2>/dev/null printf "$1" cd sed | grep ${HOME} |
+		echo grep 'quoted text'
+	awk test grep --verbose done $(pwd) -eu then
+	"$1" 2>/dev/null echo sed "$1" x=1 | "$1" $(pwd) --verbose
+	local ${HOME} ${HOME} "$@" local awk local grep $(pwd) 2>/dev/null
+export ${HOME} "$@" readonly 'quoted text'
+&& grep ${HOME} ${HOME} echo x=1 --verbose
+--verbose done echo echo 'quoted text' grep 'quoted text' && then x=1 2>/dev/null
+		-eu "$@" export export readonly ${HOME} test | -eu | "$@" done cd
+		'quoted text' sed local 2>/dev/null awk readonly
+		readonly awk then printf
+echo 2>/dev/null ${HOME} done done /usr/bin 'quoted text' local /usr/bin
+		test readonly test x=1 "$1"
+then test /usr/bin printf awk x=1 grep
+2>/dev/null echo test
+	2>/dev/null x=1 /usr/bin awk echo local x=1 $(pwd)
+--verbose && echo printf 'quoted text' done 2>/dev/null
+		cd readonly cd x=1 x=1 printf grep && /usr/bin awk "$1" sed x=1 ${HOME} readonly
+		test $(pwd) /usr/bin
+		/usr/bin echo "$1" 2>/dev/null /usr/bin 'quoted text' then && /usr/bin
+		then --verbose 2>/dev/null
+		-eu done export then awk $(pwd) /usr/bin cd then "$@" --verbose then "$@" done
+		export then grep local awk test x=1 local -eu 'quoted text' readonly
+	x=1 echo done cd printf export $(pwd) readonly ${HOME} -eu test
+then 2>/dev/null local awk $(pwd)
+		echo sed then test local readonly awk done | test echo done -eu local | "$@"
+		local sed readonly cd awk test "$@"
+	export ${HOME} export "$@" sed && cd ${HOME} printf cd | x=1 /usr/bin done grep
+		| done cd "$@" && | grep
+	printf | && 'quoted text' "$@" local cd ${HOME} done cd --verbose printf
+	readonly printf /usr/bin export
+		"$1" local -eu grep 2>/dev/null
+	echo export local -eu sed done 2>/dev/null awk ${HOME} 'quoted text'
+printf x=1 echo readonly done $(pwd) /usr/bin export
+	printf 2>/dev/null --verbose grep export done /usr/bin echo -eu
+		local "$1" "$@" $(pwd) "$1" "$1" $(pwd) 2>/dev/null cd awk export | echo
+"$@" 2>/dev/null readonly readonly grep export --verbose readonly
+		then "$1" readonly done ${HOME} awk export local echo --verbose
+done | grep awk sed | x=1 -eu | printf export
+		--verbose /usr/bin cd local grep "$1" sed ${HOME}
+		-eu export && ${HOME} cd echo test ${HOME} && && readonly x=1
+	| awk "$1" 2>/dev/null && | | cd sed -eu test /usr/bin printf /usr/bin then
+		"$@" 'quoted text' awk test done 2>/dev/null && awk export then
+awk grep echo "$1" printf --verbose "$@" grep then "$@" cd awk "$@" $(pwd)
+printf ${HOME} test cd /usr/bin $(pwd) | && 'quoted text' cd 2>/dev/null
+'quoted text' | -eu export && && x=1 grep echo "$1" echo "$@" grep
+"$1" $(pwd) ${HOME} $(pwd) -eu --verbose
+	-eu | local --verbose 'quoted text' readonly grep export 'quoted text'
+	grep "$@" then grep grep echo export /usr/bin done
+	test echo ${HOME} printf echo then export done done -eu --verbose ${HOME}
+		"$1" 2>/dev/null ${HOME} --verbose
+	&& 'quoted text' && -eu readonly 2>/dev/null readonly "$1" readonly
+		${HOME} && export test 'quoted text' --verbose
+	-eu ${HOME} | awk local 2>/dev/null export local ${HOME} --verbose --verbose
+		'quoted text' printf -eu cd readonly
+		test sed sed 2>/dev/null x=1 echo echo test cd sed printf cd test echo
+	printf | ${HOME} ${HOME} /usr/bin local -eu && 'quoted text' | "$1" awk test local
+	sed then $(pwd) echo "$1" printf | --verbose echo /usr/bin
+	test test printf readonly cd readonly
+		$(pwd) && $(pwd) printf /usr/bin export
+"$@" grep && then then /usr/bin | ${HOME} awk cd "$1" "$@" x=1 2>/dev/null done
+then done local && printf local ${HOME}
+test 2>/dev/null -eu 'quoted text' 'quoted text' awk cd "$@" printf local readonly
+	"$1" 'quoted text' awk echo "$1" local x=1 awk x=1 awk test "$@" --verbose 2>/dev/null
+		awk printf && --verbose local 'quoted text' | cd | export x=1 sed readonly
+	--verbose then readonly awk ${HOME} --verbose "$1" grep awk local sed sed echo
+cd && sed printf --verbose then grep done "$@" /usr/bin $(pwd) echo printf 2>/dev/null
+	${HOME} readonly x=1 x=1 ${HOME} $(pwd) x=1
+2>/dev/null sed test && readonly
+${HOME} /usr/bin --verbose && done printf local "$1" sed echo 2>/dev/null --verbose
+-eu done readonly && /usr/bin echo 'quoted text'
+		awk --verbose echo readonly
+		local then export "$1" 2>/dev/null 'quoted text' --verbose sed --verbose
+	cd /usr/bin && 2>/dev/null awk cd readonly
+awk export && x=1 echo x=1
+$(pwd) ${HOME} --verbose "$@" echo printf
+-eu grep /usr/bin /usr/bin -eu && "$1" readonly awk | grep sed
+export grep grep 2>/dev/null sed 2>/dev/null -eu ${HOME}
+		x=1 then /usr/bin 'quoted text' echo
+echo cd | grep && --verbose
+"$1" export x=1 grep && ${HOME} --verbose $(pwd) awk local sed -eu | grep test
+		--verbose --verbose done 2>/dev/null
+		then 2>/dev/null echo "$1"
+		export 'quoted text' ${HOME} --verbose
+	-eu | cd -eu 2>/dev/null "$1" x=1 -eu cd $(pwd) done export
+-eu "$@" grep readonly --verbose echo && export && 2>/dev/null
+	sed awk --verbose sed -eu test x=1 2>/dev/null
+	local 'quoted text' "$@" --verbose 2>/dev/null
+		cd cd $(pwd) && "$1" "$1" done 2>/dev/null
+	done done awk sed 'quoted text' done && 'quoted text'
+	printf x=1 printf --verbose sed 2>/dev/null sed && /usr/bin | export readonly
+	-eu grep "$1" export 'quoted text' sed --verbose export then local $(pwd) ${HOME}
+	| grep sed | readonly grep local cd
+	sed "$@" --verbose && $(pwd) && local test /usr/bin ${HOME} then then
+		2>/dev/null -eu then ${HOME} echo printf cd test | local sed
+	echo then export $(pwd) ${HOME} "$1" awk local
+${HOME} && local && --verbose done awk test -eu then readonly --verbose "$@"
+	x=1 -eu cd done awk export
+	awk | sed 2>/dev/null then $(pwd) grep export && grep
+$(pwd) $(pwd) echo /usr/bin
+"$1" readonly test local
+	local then "$@" test echo grep 2>/dev/null
+	"$1" $(pwd) /usr/bin done ${HOME} export cd local readonly echo
+	&& --verbose then ${HOME} | export x=1 | x=1 && -eu echo echo --verbose
+		then x=1 && "$1" echo then --verbose readonly --verbose
+		readonly readonly | "$@" 2>/dev/null /usr/bin test /usr/bin
+		export && "$1" cd local -eu $(pwd) -eu echo readonly
+	'quoted text' --verbose local | | && /usr/bin awk x=1 | && echo --verbose 2>/dev/null
+	cd "$@" local then export printf
+		test echo then cd $(pwd) readonly cd then awk cd
+x=1 --verbose printf awk ${HOME} -eu --verbose export cd --verbose
+test local local then sed -eu ${HOME} "$@" | x=1 local then then echo
+	${HOME} "$1" cd 2>/dev/null "$@" "$1" -eu
+		printf test --verbose x=1 local then -eu 'quoted text'
+"$@" "$1" "$1" cd "$1" done then
+	&& "$@" --verbose local && sed awk 'quoted text'
+	cd export --verbose --verbose grep --verbose cd | 2>/dev/null
+	test then -eu cd grep && local grep cd -eu -eu 'quoted text'
+	then --verbose ${HOME}
+		grep cd && grep && x=1 export "$1"
+#include c6.sh
+cd local -eu -eu sed ${HOME} test x=1
+then 2>/dev/null ${HOME} x=1 done
+local 2>/dev/null "$@" awk readonly awk test echo
+	done grep sed -eu export test 'quoted text'
+		"$@" readonly awk -eu export 'quoted text' ${HOME} export
+	echo printf awk sed /usr/bin
+	readonly done "$@" $(pwd) && /usr/bin
+		then x=1 readonly printf echo then "$@" printf export local printf
+sed 'quoted text' readonly /usr/bin 2>/dev/null 'quoted text'
+		grep "$1" x=1 test export
+grep -eu then 2>/dev/null
+	sed test awk $(pwd) 2>/dev/null
+		2>/dev/null printf done -eu printf
+/usr/bin done done x=1 "$@" awk
+		grep /usr/bin cd readonly ${HOME} export
+done cd grep grep cd --verbose awk grep done 2>/dev/null
+		sed "$1" /usr/bin x=1 done "$1" echo readonly local cd then && awk "$1" local
+	--verbose then test echo 'quoted text'
+	&& sed $(pwd) -eu ${HOME} export | test &&
+local local 2>/dev/null "$@" echo && "$@" -eu
+	/usr/bin $(pwd) test -eu cd readonly
+		&& -eu -eu export && | export readonly -eu | 2>/dev/null
+	&& export test test 2>/dev/null
+	'quoted text' done echo 2>/dev/null printf x=1 | --verbose
+		/usr/bin && 'quoted text' "$@"
+then done sed local local /usr/bin readonly echo readonly done
+	&& readonly awk done ${HOME} 2>/dev/null
+then 'quoted text' echo grep ${HOME} local x=1 awk 2>/dev/null /usr/bin
+	2>/dev/null local awk grep then --verbose grep 'quoted text' 'quoted text'
+	"$1" "$@" local 2>/dev/null printf awk --verbose
+"$1" test 2>/dev/null test | readonly
+readonly /usr/bin --verbose export printf $(pwd) then echo export "$@" then
+	&& 'quoted text' "$@" local 2>/dev/null local | $(pwd) $(pwd) test /usr/bin
+		${HOME} export export local ${HOME} test echo 2>/dev/null local "$@" then
+		grep | 2>/dev/null done "$@" 'quoted text' sed done x=1 'quoted text' grep
+		readonly -eu ${HOME} | 'quoted text'
+awk test --verbose then $(pwd) printf | $(pwd) --verbose
+	grep grep then echo printf local printf
+	then printf $(pwd) grep awk sed
+x=1 /usr/bin grep local 2>/dev/null --verbose readonly sed test &&
+		&& grep 2>/dev/null readonly 'quoted text' cd cd awk grep -eu readonly
+	then 'quoted text' ${HOME} test grep /usr/bin awk echo then
+done awk awk "$@" $(pwd) printf $(pwd) ${HOME} readonly 2>/dev/null
+		readonly printf printf done
+x=1 grep 2>/dev/null ${HOME} sed cd x=1
+	done test | ${HOME} cd readonly x=1 | local cd echo test ${HOME}
+readonly --verbose 'quoted text' readonly "$@" 'quoted text'
+| 2>/dev/null done 2>/dev/null --verbose x=1 export readonly sed grep
+"$@" 'quoted text' awk echo ${HOME} echo export sed ${HOME} 2>/dev/null
+$(pwd) local done sed x=1 -eu
+2>/dev/null $(pwd) grep printf 2>/dev/null ${HOME} | awk 'quoted text'
+		echo "$@" awk | 2>/dev/null /usr/bin | /usr/bin ${HOME} printf
+	local "$@" 2>/dev/null sed printf
+	$(pwd) done awk | 'quoted text' "$@" grep awk test
+done && ${HOME} 2>/dev/null -eu "$@" --verbose
+		printf then test cd x=1 grep
+	"$1" local sed grep then | done "$1" printf "$@" -eu local ${HOME}
+/usr/bin echo x=1 cd awk /usr/bin -eu --verbose ${HOME} --verbose
+2>/dev/null $(pwd) done test && "$1" echo 2>/dev/null /usr/bin cd | "$@"
+	2>/dev/null awk then -eu cd "$@" "$@" echo -eu 'quoted text' echo printf export
+	readonly grep test printf printf ${HOME} cd -eu sed
+	done test 2>/dev/null && /usr/bin test local sed --verbose test readonly
+	${HOME} then 2>/dev/null
+		/usr/bin "$@" | ${HOME} /usr/bin -eu echo x=1 'quoted text' awk $(pwd) "$1" 'quoted text'
+	${HOME} 2>/dev/null --verbose |
+	"$@" --verbose x=1 /usr/bin 'quoted text' | awk
+x=1 export $(pwd) local awk && | x=1 ${HOME} readonly echo
+awk "$@" "$@" $(pwd) grep ${HOME}
+		'quoted text' -eu echo /usr/bin
+/usr/bin echo 2>/dev/null printf ${HOME} readonly done | ${HOME} "$@" then /usr/bin
+grep sed 'quoted text' echo | test
+		cd | && readonly sed awk
+		x=1 awk x=1 test readonly -eu awk done then && export
+		echo test "$1" x=1 $(pwd) 2>/dev/null export $(pwd) echo
+done grep && /usr/bin ${HOME} /usr/bin readonly test
+	&& /usr/bin done echo test readonly
+$(pwd) 'quoted text' "$@" sed "$@" awk awk
+| then local readonly done $(pwd) x=1 /usr/bin
+then printf cd ${HOME} export /usr/bin awk done -eu then grep done $(pwd)
+	sed cd "$1" export awk printf
+		grep then echo awk "$1" export /usr/bin "$1"
+		'quoted text' /usr/bin &&
+		| x=1 2>/dev/null "$@" | --verbose
+	-eu x=1 -eu cd x=1 export | local $(pwd) --verbose ${HOME} -eu export
+		test ${HOME} -eu printf awk done
+	export ${HOME} && echo | /usr/bin 2>/dev/null local && cd grep readonly
+sed | grep export cd $(pwd) local /usr/bin
+		/usr/bin readonly cd export test 'quoted text' test echo 'quoted text' awk ${HOME}
+		"$@" -eu "$@" -eu && ${HOME} && readonly then sed "$@" local done
+2>/dev/null -eu local x=1 | "$1" $(pwd) then printf readonly
+done --verbose awk ${HOME}
+printf "$@" cd cd then $(pwd) echo 2>/dev/null awk $(pwd) readonly -eu
+		export readonly echo ${HOME} readonly 'quoted text'
+awk readonly echo done --verbose $(pwd) $(pwd)
+		awk local cd awk /usr/bin "$1" --verbose && printf printf -eu
+		readonly -eu 'quoted text'
+done x=1 --verbose grep echo export awk ${HOME} "$1" --verbose 2>/dev/null
+		| export "$1" 2>/dev/null echo readonly readonly grep
+done export ${HOME} $(pwd) done echo -eu -eu sed "$@" grep && readonly
+readonly printf $(pwd) cd sed local && /usr/bin printf test 2>/dev/null
+2>/dev/null cd && cd | --verbose 2>/dev/null $(pwd) --verbose readonly
+	--verbose done cd "$@" then local 2>/dev/null | --verbose cd
+	done cd && --verbose cd done ${HOME}
+| local export local
+		local done -eu "$@" /usr/bin 'quoted text' export 2>/dev/null
+	test local printf | /usr/bin printf --verbose --verbose
+	-eu printf 2>/dev/null x=1 2>/dev/null x=1 | printf "$1" sed test export
+&& cd | /usr/bin /usr/bin && "$@" awk grep x=1 sed x=1 | sed local echo
+${HOME} "$@" export sed readonly 'quoted text' $(pwd) | done awk /usr/bin then
+		${HOME} $(pwd) x=1 then 2>/dev/null &&
+		$(pwd) test $(pwd) -eu -eu cd ${HOME} x=1 export printf
+		&& /usr/bin grep --verbose
+${HOME} && readonly test
+		sed $(pwd) -eu done done grep x=1 test 2>/dev/null grep echo echo then
+	export 2>/dev/null awk export
+done grep readonly local local
+	test done x=1 then done && grep then | awk readonly sed awk 2>/dev/null /usr/bin
+		"$@" "$1" "$1" awk export 2>/dev/null --verbose export --verbose printf export
+		"$1" grep then --verbose x=1 readonly grep
+	x=1 readonly then echo done
+	$(pwd) cd 'quoted text' readonly
+		local "$@" echo sed -eu /usr/bin /usr/bin
+-eu 2>/dev/null /usr/bin /usr/bin --verbose -eu &&
+	-eu | "$@" /usr/bin && cd printf readonly "$1" | grep
+/usr/bin test cd local x=1 | "$@" printf /usr/bin
+		"$1" grep ${HOME} awk 'quoted text' $(pwd)
+	| sed sed sed 'quoted text' && 'quoted text' 2>/dev/null --verbose cd x=1
+		--verbose 'quoted text' local x=1 awk "$1" && --verbose cd --verbose
+		&& readonly readonly cd ${HOME} | "$@" test ${HOME} x=1 test --verbose $(pwd)
+		${HOME} cd /usr/bin && cd sed x=1 readonly test 'quoted text' && "$1" echo cd
+printf grep $(pwd) 'quoted text' 'quoted text' 'quoted text' $(pwd) printf
+		sed echo 2>/dev/null printf "$@" --verbose
+	awk -eu then echo sed sed 'quoted text' echo readonly grep x=1 "$1" sed $(pwd)
+	"$@" x=1 "$@" done sed readonly echo
+	'quoted text' awk awk | awk echo | --verbose printf | done cd
+	export 2>/dev/null $(pwd) 'quoted text' grep readonly test x=1
+	printf /usr/bin echo "$1" $(pwd)
+--verbose $(pwd) --verbose ${HOME} ${HOME}
+		&& --verbose /usr/bin | export awk $(pwd) x=1 'quoted text'
+-eu sed export "$@" /usr/bin sed readonly x=1 --verbose 2>/dev/null 'quoted text'
+then readonly cd ${HOME} -eu "$1" 'quoted text'
+&& awk "$1" 2>/dev/null 2>/dev/null | --verbose echo /usr/bin
+then -eu awk /usr/bin awk awk "$@" test echo
+		-eu x=1 x=1 echo && x=1 test sed then test
+	&& cd sed x=1 echo then printf $(pwd) /usr/bin awk grep
+		--verbose cd /usr/bin && "$@" cd local
+		'quoted text' test then | /usr/bin /usr/bin | 2>/dev/null
+--verbose 'quoted text' "$1" export printf echo 'quoted text'
+	test ${HOME} --verbose sed "$1" awk 2>/dev/null
+		"$@" then "$@" done export awk export ${HOME}
+		$(pwd) done x=1 cd && $(pwd)
+	&& $(pwd) printf local | "$@" /usr/bin 2>/dev/null grep local |
+		$(pwd) cd 'quoted text' local then | echo grep printf echo "$@"
+-eu && --verbose --verbose 2>/dev/null
+		echo echo 2>/dev/null $(pwd) "$@" | grep export
+	&& sed $(pwd) printf /usr/bin awk echo 2>/dev/null local readonly printf grep
+		then | "$@" done local "$@" $(pwd) local --verbose 'quoted text'
+	cd echo -eu "$@" export then cd && ${HOME} cd ${HOME} /usr/bin readonly
+then "$@" -eu x=1 grep $(pwd) | echo local -eu test printf awk ${HOME}
+	test $(pwd) test printf "$@" test grep awk sed "$@" echo grep readonly
+		done $(pwd) 'quoted text' "$1" printf "$1" local ${HOME} ${HOME}
+		cd done sed 'quoted text' && && test echo awk grep | sed "$1" x=1
+	done local done && | then
+	'quoted text' test printf
+		| done done $(pwd) grep grep | x=1
+	${HOME} cd cd && /usr/bin && grep local
+local --verbose awk "$@" export done $(pwd)
+		done 2>/dev/null echo 2>/dev/null x=1 echo | done readonly printf -eu -eu --verbose
+test 2>/dev/null printf
+		readonly $(pwd) local local grep
+	| | && "$1" awk test cd export then
+export done && --verbose
+test -eu then /usr/bin 2>/dev/null &&
+printf cd printf echo /usr/bin awk --verbose sed && 'quoted text' $(pwd)
+	"$1" | export $(pwd) readonly then 2>/dev/null | test $(pwd) 2>/dev/null
+		x=1 echo x=1 echo ${HOME} x=1 --verbose -eu -eu "$@" grep cd "$1" 2>/dev/null
+	$(pwd) /usr/bin readonly && 'quoted text' echo grep export
+	done -eu printf printf echo
+awk done cd "$1" --verbose x=1 ${HOME} 'quoted text' 'quoted text'
+	/usr/bin && awk x=1 awk readonly done echo then local
+		${HOME} printf done 2>/dev/null local export echo local export
+		| readonly "$1" sed 2>/dev/null echo "$1" x=1 /usr/bin readonly --verbose $(pwd)
+		echo $(pwd) grep | readonly awk
+		echo printf && local cd 'quoted text' cd readonly "$1" 'quoted text' -eu
+sed local test $(pwd) 'quoted text' 2>/dev/null
+		"$1" "$1" done $(pwd) done x=1 | grep "$1" -eu $(pwd) then ${HOME} test awk
+		x=1 'quoted text' then test
+	grep && local grep -eu 'quoted text' done grep echo echo
+| ${HOME} && /usr/bin awk --verbose | ${HOME} export 'quoted text' | /usr/bin
+	printf ${HOME} "$1" export
+		2>/dev/null export --verbose
+then awk local test done cd 2>/dev/null sed -eu grep printf -eu done 'quoted text'
+| grep test sed -eu ${HOME} --verbose -eu $(pwd) done $(pwd)
+cd 'quoted text' done --verbose --verbose grep then ${HOME} $(pwd)
+-eu /usr/bin /usr/bin printf printf
+	${HOME} "$@" "$1" 'quoted text' -eu test awk x=1 test /usr/bin
+$(pwd) ${HOME} test "$1"
+	test then export "$@" readonly
+	&& done "$1" ${HOME} printf
+		"$1" | | sed | ${HOME} -eu sed cd local printf test -eu echo grep test
+${HOME} 2>/dev/null ${HOME} -eu $(pwd) && -eu --verbose test sed 'quoted text' then
+		then awk 'quoted text' "$1" export printf && sed grep 'quoted text' "$@" --verbose
+	cd grep --verbose grep -eu
+	2>/dev/null "$1" | && readonly test printf test grep printf "$@" awk $(pwd) 'quoted text'
+	cd 2>/dev/null printf $(pwd) awk --verbose
+done && export "$@" "$@" x=1 local
+/usr/bin export done export echo
+local grep echo | readonly -eu && 2>/dev/null then then
+then -eu echo readonly awk done 'quoted text'
+	awk | | /usr/bin x=1 printf | echo echo x=1 local
+		sed done && echo then grep sed ${HOME} "$@"
+		--verbose awk export grep then
+	sed then 2>/dev/null export test ${HOME}
+		cd cd | cd 2>/dev/null awk x=1 "$1" "$1" readonly
+-eu -eu sed local echo local $(pwd) then export
+	sed $(pwd) cd "$1" awk -eu done -eu 'quoted text' echo sed test
+	local $(pwd) "$1" "$1" /usr/bin 'quoted text' -eu $(pwd) /usr/bin --verbose
+-eu awk x=1 | local --verbose $(pwd) $(pwd) 2>/dev/null -eu "$1" test --verbose
+${HOME} x=1 $(pwd) local readonly
+readonly --verbose && readonly && 'quoted text'
+		awk -eu 2>/dev/null awk 'quoted text' "$@" -eu "$1" printf && awk readonly
+	"$@" sed "$1" readonly cd "$1" 'quoted text' local "$1" "$1"
+		${HOME} sed echo awk grep local test --verbose $(pwd) "$@" -eu done grep echo
+	2>/dev/null "$@" then export && cd done test awk sed
+	cd readonly "$@" && && test 'quoted text' /usr/bin
+readonly -eu && local 'quoted text' echo $(pwd) readonly then ${HOME} done
+	printf && x=1 'quoted text'
+	done -eu done cd sed "$@" grep
+		${HOME} readonly | $(pwd) x=1 -eu sed printf "$@"
+		'quoted text' printf readonly local awk /usr/bin "$1" local local /usr/bin
+		"$@" local export | sed awk | sed "$@" 'quoted text' | echo sed 2>/dev/null export
+		test "$1" printf 2>/dev/null then 'quoted text' echo
+		test /usr/bin then | grep --verbose "$1" 'quoted text' local
+		local readonly 2>/dev/null "$@" readonly
+	'quoted text' printf done awk --verbose 2>/dev/null
+"$@" && "$@" 'quoted text' awk "$1" local grep x=1 'quoted text'
+		grep done printf && 'quoted text'
+test echo sed sed done --verbose cd
+	"$1" | readonly export test printf cd /usr/bin awk done printf
+	${HOME} x=1 2>/dev/null printf --verbose
+		local done 2>/dev/null grep
+done readonly /usr/bin printf && "$@"
+	| "$1" && ${HOME} grep readonly printf
+		echo export | "$1" $(pwd) cd 'quoted text' export 2>/dev/null
+then && readonly then printf 2>/dev/null $(pwd) printf --verbose cd ${HOME}
+		done export export "$@" --verbose readonly grep "$1" sed printf readonly
+	grep $(pwd) "$@" && $(pwd) "$@" x=1 then | ${HOME}
+readonly --verbose | echo ${HOME} awk cd /usr/bin "$1" 2>/dev/null
+		test "$1" "$@" printf local | local "$@" sed export $(pwd) 'quoted text'
+	export then --verbose /usr/bin 2>/dev/null --verbose $(pwd)
+		done export test readonly -eu 2>/dev/null
+	x=1 then --verbose then "$1" x=1 /usr/bin test $(pwd) x=1 test awk local | then
+$(pwd) grep done printf x=1 2>/dev/null $(pwd) awk $(pwd) "$1" x=1 /usr/bin done
+		&& /usr/bin test export "$1" -eu | export x=1 awk -eu -eu --verbose grep
+		&& local done then then export cd --verbose && printf && "$@" export local "$1"
+	readonly /usr/bin done grep -eu echo |
+test x=1 done 'quoted text' then /usr/bin ${HOME} cd
+| printf readonly "$1" then
+echo | local /usr/bin -eu /usr/bin sed readonly printf sed && readonly
+		awk awk "$1" readonly "$1" "$@" 2>/dev/null test grep echo
+	/usr/bin x=1 export "$1"
+	export ${HOME} $(pwd) awk | done
+		printf grep x=1 /usr/bin
+		readonly -eu done cd local
+	x=1 cd --verbose echo && 'quoted text'
+	&& then grep printf echo 2>/dev/null -eu sed /usr/bin
+		"$1" test --verbose test echo readonly done cd
+	echo ${HOME} $(pwd) ${HOME} "$@" x=1 && --verbose 'quoted text'
+	done sed test readonly && /usr/bin 'quoted text' readonly
+	$(pwd) awk awk 'quoted text' cd echo readonly cd
+		/usr/bin 'quoted text' test grep awk "$@" echo awk cd "$1" grep
+${HOME} 2>/dev/null -eu "$1" done then x=1 awk x=1
+		test grep /usr/bin ${HOME} -eu awk readonly printf done
+| echo sed | -eu test "$1" && grep 'quoted text'
+	echo /usr/bin test export "$@" x=1 2>/dev/null awk then
+	&& export 2>/dev/null export
+		then && echo $(pwd) 2>/dev/null 'quoted text' printf $(pwd) cd local
+		awk then --verbose local test ${HOME} readonly /usr/bin 2>/dev/null -eu
+	"$@" printf export /usr/bin 'quoted text' | "$1" export 2>/dev/null -eu
+		awk -eu test ${HOME} local 'quoted text'
+		-eu readonly echo sed 'quoted text' "$1" then grep sed cd done cd x=1
+		test "$1" ${HOME} 2>/dev/null done -eu
+then grep then 2>/dev/null cd test grep cd ${HOME} printf ${HOME} echo x=1 echo
+		'quoted text' echo && x=1 then then done grep "$1" test | local
+		done 'quoted text' sed sed "$@" cd x=1 -eu echo grep local -eu local test
+	x=1 ${HOME} $(pwd) grep readonly then x=1 "$@" "$1" export ${HOME} $(pwd)
+cd --verbose 'quoted text' export
+	grep grep test -eu printf test grep
+		$(pwd) readonly echo awk readonly
+readonly && echo printf awk readonly --verbose
+	printf 2>/dev/null done local cd -eu 'quoted text' echo
+cd ${HOME} done cd x=1 local printf readonly echo "$1" cd grep test grep 2>/dev/null
+	printf grep export awk
+		'quoted text' readonly printf export
+	done then readonly awk sed
+		2>/dev/null 2>/dev/null && | readonly "$@" "$@" sed --verbose
+		"$1" sed echo local "$@" x=1 local done local "$@" && x=1 "$@" -eu | sed
+	${HOME} | 2>/dev/null x=1 -eu export printf 2>/dev/null
+		"$1" 'quoted text' -eu "$@" "$@" done "$@" cd ${HOME} ${HOME} awk grep /usr/bin
+then && grep printf readonly export | | printf readonly readonly
+		readonly local echo && "$@" then 'quoted text' ${HOME}
+"$@" && test 'quoted text' 'quoted text'
+	"$1" echo -eu 'quoted text' "$1" && | echo | export && /usr/bin --verbose
+	"$1" -eu 2>/dev/null "$@" x=1 test cd 'quoted text' /usr/bin local test cd grep
+	-eu printf sed grep 2>/dev/null /usr/bin local awk | x=1 cd then sed
+		$(pwd) 2>/dev/null "$1" sed x=1 test $(pwd)
+		then "$1" --verbose done done then then | --verbose | "$1" --verbose printf
+	grep "$@" /usr/bin readonly && done export 2>/dev/null "$1"
+	sed readonly x=1 --verbose then grep printf cd -eu done /usr/bin $(pwd) && awk
+'quoted text' echo printf readonly
+	sed | local 'quoted text' --verbose grep 2>/dev/null printf 2>/dev/null 'quoted text'
+		then printf 2>/dev/null local x=1 echo export test grep ${HOME}
+		cd grep local ${HOME} printf
+		local "$1" "$@" local grep 'quoted text'
+	export local cd /usr/bin && "$1" "$@" awk done
+	&& 'quoted text' "$@" 2>/dev/null readonly x=1 -eu awk grep
+	local $(pwd) sed printf 'quoted text' 'quoted text'
+		'quoted text' export readonly
+	printf $(pwd) 2>/dev/null --verbose 2>/dev/null && --verbose grep
+	test readonly --verbose printf "$@" readonly /usr/bin awk then export
+"$@" test ${HOME} echo echo done readonly readonly 'quoted text' 2>/dev/null
+		printf 2>/dev/null --verbose -eu ${HOME} readonly $(pwd) export "$1" |
+	"$@" echo test sed "$@" echo 2>/dev/null printf printf "$@"
+		awk cd ${HOME} awk test x=1 'quoted text' cd test --verbose | test /usr/bin
+awk /usr/bin echo export --verbose
+		printf sed && done /usr/bin -eu "$1" --verbose /usr/bin echo printf
+	echo "$@" awk "$1" "$@" done cd test ${HOME}
+		-eu grep $(pwd) readonly --verbose
+	-eu grep test cd then
+	"$@" local ${HOME} && then "$@" printf sed "$1" cd sed && "$@" printf 2>/dev/null
+echo echo echo $(pwd) ${HOME} printf sed x=1 --verbose test
+--verbose sed sed then 2>/dev/null then then "$1" ${HOME} /usr/bin "$@"
+		echo --verbose cd grep echo grep awk 'quoted text' then awk done /usr/bin
+		local $(pwd) test done done grep local then
+	export -eu then grep test local | grep ${HOME} then && test x=1 awk export /usr/bin
+'quoted text' && "$1" cd $(pwd) grep cd "$@" /usr/bin done export
+		sed cd | --verbose done | &&
+x=1 done | readonly printf then readonly
+	awk 'quoted text' test sed | awk test local -eu ${HOME}
+	grep | x=1 'quoted text' printf ${HOME} awk "$@" ${HOME} ${HOME} export 2>/dev/null
+	"$1" 'quoted text' export
+		"$1" 2>/dev/null "$@" && cd | -eu sed ${HOME} -eu ${HOME} --verbose && /usr/bin
+		'quoted text' done --verbose $(pwd) x=1 grep 2>/dev/null
+	| test 'quoted text' x=1 printf "$@" export | cd grep x=1 $(pwd)
+		echo printf /usr/bin sed $(pwd)
+then test export echo printf sed
+awk local $(pwd) | | -eu printf readonly x=1 awk echo --verbose "$1"
+	readonly readonly sed "$@" grep test
+	&& done /usr/bin local ${HOME} echo sed /usr/bin /usr/bin
+cd readonly echo /usr/bin printf readonly
+2>/dev/null "$1" "$1" --verbose 2>/dev/null
+then then ${HOME} sed && && test 2>/dev/null grep 'quoted text' 2>/dev/null
+printf then echo --verbose test
+	local 'quoted text' cd -eu readonly local && 'quoted text'
+cd -eu | then /usr/bin 2>/dev/null local "$@"
+sed cd local awk ${HOME} echo --verbose ${HOME}
+		done readonly sed sed readonly && export awk ${HOME}
+--verbose "$@" readonly local
+		export 'quoted text' awk 2>/dev/null
+		$(pwd) x=1 /usr/bin then
+	$(pwd) awk "$1" grep printf cd done export then awk awk
+"$@" echo --verbose sed 'quoted text' 2>/dev/null
+		"$@" cd then 'quoted text' /usr/bin done sed $(pwd) sed printf
+	readonly /usr/bin /usr/bin grep "$@" 2>/dev/null 'quoted text' export $(pwd)
+2>/dev/null grep printf echo | x=1 $(pwd) readonly 'quoted text' $(pwd) export
+cd /usr/bin x=1 then "$@" done test 2>/dev/null export echo done x=1 /usr/bin
+	"$@" readonly -eu "$1" export 'quoted text' --verbose printf then done then ${HOME}
+-eu 'quoted text' "$1" cd --verbose | test sed cd local $(pwd)
+test -eu /usr/bin 'quoted text' printf grep grep && cd |
+		cd grep && printf "$@" test
+	grep cd --verbose test echo grep cd
+		&& --verbose 2>/dev/null "$1" test | grep $(pwd)
+${HOME} done --verbose grep $(pwd) /usr/bin grep local then sed then
+		readonly "$1" "$1" then done 2>/dev/null
+&& "$@" local printf /usr/bin $(pwd) test /usr/bin "$1" then
+		${HOME} grep "$@" export ${HOME} -eu printf "$@" awk grep readonly echo 2>/dev/null
+	then local grep ${HOME} sed "$1" ${HOME} --verbose | "$@" readonly sed export
+	-eu "$@" -eu echo x=1 export grep local grep x=1 --verbose printf echo then
+		2>/dev/null cd awk 'quoted text' export "$1" echo | | sed done -eu x=1
+	"$@" x=1 'quoted text' test readonly 2>/dev/null
+		then $(pwd) grep && done $(pwd) "$1" $(pwd) done readonly test sed grep | local
+&& x=1 | grep 2>/dev/null readonly awk printf ${HOME} export grep
+	export "$1" x=1 test --verbose test grep --verbose
+$(pwd) awk sed test && --verbose 2>/dev/null -eu "$1" | -eu
+		test cd grep cd done then "$1" ${HOME}
+		export "$@" -eu done sed
+echo 2>/dev/null readonly then 'quoted text' done
+		2>/dev/null export echo sed done | 2>/dev/null /usr/bin $(pwd) awk /usr/bin
+	printf test $(pwd) readonly --verbose ${HOME} $(pwd)
+	&& readonly x=1 grep echo awk local 2>/dev/null
+	"$1" ${HOME} grep sed done done sed done -eu test cd "$@" ${HOME}
+'quoted text' sed cd readonly 'quoted text' "$1" 2>/dev/null
+done readonly cd then then $(pwd)
+		x=1 "$@" grep awk --verbose 2>/dev/null
+"$@" 'quoted text' echo echo ${HOME}
+		&& awk sed readonly --verbose
+/usr/bin --verbose then done then readonly done x=1 "$@" 'quoted text'
+-eu grep --verbose ${HOME} && done then --verbose ${HOME}
+done x=1 done --verbose
+		echo then sed readonly 2>/dev/null
+	echo "$1" grep awk x=1 "$@" ${HOME} "$@" | test grep local
+		--verbose x=1 /usr/bin ${HOME} --verbose then /usr/bin local
+	$(pwd) -eu --verbose grep -eu done
+		done awk "$@" "$1" export cd printf done done 'quoted text' export awk
+	grep export printf then --verbose readonly echo
+then && echo 2>/dev/null $(pwd) 'quoted text'
+'quoted text' awk export done --verbose ${HOME}
+	awk /usr/bin readonly -eu x=1 --verbose 2>/dev/null echo
+printf cd x=1 "$1" --verbose then echo ${HOME}
+export export sed "$1" -eu echo --verbose "$@" grep "$1" x=1 --verbose && echo
+echo printf --verbose "$1" /usr/bin | && sed | cd -eu test printf
+		cd "$1" $(pwd) local && local --verbose local -eu test
+		${HOME} sed printf echo readonly | --verbose "$1" grep ${HOME} "$@" sed
+test 2>/dev/null export "$1" &&
+		2>/dev/null && -eu readonly test /usr/bin "$1" && local x=1
+		cd -eu ${HOME} awk x=1 --verbose ${HOME} && | sed && "$1" | --verbose
+	-eu 2>/dev/null local sed | && 2>/dev/null local -eu readonly grep ${HOME}
+grep 'quoted text' && /usr/bin "$@"
+	"$1" --verbose /usr/bin /usr/bin local echo && export
+		grep printf | local /usr/bin
+	grep local ${HOME} done | && sed local x=1 test grep ${HOME} test "$@" 'quoted text'
+		-eu test done then /usr/bin cd /usr/bin x=1 'quoted text' echo "$@" echo
+$(pwd) | $(pwd) --verbose echo | done --verbose $(pwd) "$@" awk ${HOME} "$@"
+done 2>/dev/null "$1" readonly 2>/dev/null /usr/bin export /usr/bin --verbose
+	$(pwd) awk x=1 ${HOME} export
+readonly printf /usr/bin then local --verbose && done /usr/bin $(pwd)
+readonly cd test /usr/bin awk /usr/bin -eu | x=1 "$1" -eu | "$1" export done
+		--verbose /usr/bin /usr/bin then x=1 done /usr/bin
+local -eu -eu | echo --verbose "$1" && && printf && readonly | local "$@"
+	"$1" 2>/dev/null export --verbose printf done "$1" $(pwd) 'quoted text'
+printf done "$1" x=1 awk sed
+cd readonly test x=1 export sed
+"$@" -eu "$@" 2>/dev/null echo -eu printf sed export 2>/dev/null
+		"$1" "$1" "$1" then | "$@" 'quoted text'
+export then 'quoted text' echo then "$@" readonly --verbose |
+		cd "$@" echo export ${HOME} cd
+	printf then local done "$@" "$@" --verbose grep -eu
+	${HOME} x=1 local cd x=1 export readonly
+sed echo echo $(pwd) -eu 2>/dev/null echo
+	sed 2>/dev/null && --verbose 2>/dev/null
+	&& cd local grep x=1 echo test "$1" 2>/dev/null printf | 2>/dev/null
+	sed cd test $(pwd) printf --verbose
+	&& $(pwd) -eu --verbose ${HOME} /usr/bin $(pwd) then --verbose ${HOME}
+	$(pwd) printf ${HOME} grep && 2>/dev/null 2>/dev/null
+	'quoted text' readonly "$@" 2>/dev/null printf --verbose x=1 "$@"
+2>/dev/null printf "$@" echo grep awk test "$1" local --verbose
+		&& $(pwd) readonly $(pwd) 2>/dev/null
+		then sed cd done sed -eu 'quoted text'
+		${HOME} /usr/bin awk echo export awk test x=1 then 2>/dev/null && awk
+local && | grep && "$@" readonly "$1" grep -eu "$@" -eu /usr/bin
+${HOME} echo | local readonly local 2>/dev/null $(pwd) $(pwd)
+		readonly "$@" && ${HOME} test && readonly x=1 x=1
+printf ${HOME} cd $(pwd) then awk 'quoted text'
+&& -eu | "$@" | export x=1 x=1 /usr/bin cd export done export
+export 2>/dev/null | x=1 x=1 x=1 2>/dev/null
+awk local 2>/dev/null 2>/dev/null 2>/dev/null --verbose done $(pwd) test sed
+	2>/dev/null sed printf export test "$1" x=1 && 'quoted text'
+		'quoted text' grep "$@" "$@" ${HOME} done awk
+'quoted text' 2>/dev/null --verbose readonly printf /usr/bin && -eu sed readonly
+$(pwd) 2>/dev/null cd echo && printf "$1" /usr/bin cd
+	grep sed $(pwd) printf && test local 2>/dev/null ${HOME} local done
+	"$1" --verbose echo -eu 2>/dev/null && done then done then printf 2>/dev/null ${HOME}
+	cd $(pwd) cd 'quoted text' x=1 then | then cd local
+	$(pwd) $(pwd) readonly awk 2>/dev/null
+awk echo --verbose -eu readonly
+		-eu local done then printf then sed ${HOME} grep /usr/bin done "$@" 'quoted text'
+	printf sed export -eu | $(pwd) readonly /usr/bin test
+	printf 2>/dev/null awk local /usr/bin --verbose awk --verbose
+	2>/dev/null && "$1" --verbose echo awk "$@" test
+printf grep printf export echo -eu echo "$1" test "$1"
+	$(pwd) x=1 'quoted text' then x=1 -eu | -eu
+		printf /usr/bin | -eu "$1" && then cd grep then /usr/bin 'quoted text'
+	'quoted text' --verbose $(pwd) $(pwd) echo test | 'quoted text' $(pwd) sed
+	readonly && cd /usr/bin test grep "$@" cd then
+	--verbose x=1 ${HOME} | 'quoted text' ${HOME} $(pwd) test 2>/dev/null
+	'quoted text' grep ${HOME}
+"$1" printf $(pwd) cd ${HOME}
+	'quoted text' "$1" echo && 'quoted text' test "$1" -eu ${HOME}
+cd 2>/dev/null --verbose ${HOME} x=1 awk -eu done awk /usr/bin
+		| test "$1" printf -eu test "$@" printf "$1" && -eu then printf printf
+	| && -eu local done ${HOME} /usr/bin done
+	done $(pwd) && test x=1 awk && sed then
+"$@" "$@" readonly done echo readonly
+		"$@" export export | && | |
+	local test readonly printf done 'quoted text'
+sed 2>/dev/null awk then 'quoted text' sed -eu readonly -eu
+	cd "$@" ${HOME} export /usr/bin export
+	awk && cd grep printf
+	cd readonly awk && /usr/bin awk
+	then cd printf echo "$1" grep | test local $(pwd) --verbose /usr/bin
+	"$@" done /usr/bin 'quoted text' test grep | x=1 cd cd $(pwd) "$1" export
+		local ${HOME} 2>/dev/null cd | 'quoted text' 'quoted text' test echo
+local then ${HOME} && echo 2>/dev/null readonly $(pwd)
+--verbose 'quoted text' test && /usr/bin 'quoted text' $(pwd) /usr/bin
+		readonly awk ${HOME} "$1" | "$@" x=1
+		"$1" then then grep export done $(pwd) echo ${HOME} readonly
+sed "$1" $(pwd) printf "$@" ${HOME} grep printf "$1" x=1 awk export awk awk --verbose
+&& && 'quoted text' --verbose
+		awk x=1 "$1" --verbose printf export && local sed sed | && "$1" sed
+	test local then "$1" printf then /usr/bin then | | && done cd /usr/bin $(pwd)
+	awk "$1" 2>/dev/null ${HOME} --verbose $(pwd) done cd $(pwd) cd "$@"
+		'quoted text' && grep $(pwd) export done then local export $(pwd) --verbose
+$(pwd) -eu awk export awk sed -eu && 2>/dev/null
+test echo "$@" grep then cd export "$1" ${HOME} sed ${HOME}
+	test x=1 2>/dev/null test | test "$1" -eu "$1"
+/usr/bin && 'quoted text'
+	--verbose awk ${HOME} test $(pwd) 2>/dev/null -eu "$@"
+		"$1" readonly 2>/dev/null test /usr/bin export export cd "$@" "$@"
+| export 2>/dev/null grep $(pwd) done test local 2>/dev/null printf /usr/bin
+2>/dev/null readonly --verbose -eu -eu | done $(pwd) "$@" /usr/bin awk done
+	local echo sed -eu awk test then
+echo echo /usr/bin | test $(pwd) $(pwd) --verbose 2>/dev/null sed && local
+$(pwd) -eu awk sed 2>/dev/null "$1" "$1" local echo done cd then done cd /usr/bin
+then echo ${HOME} echo local export $(pwd) grep x=1
+2>/dev/null -eu cd "$1" then export sed readonly printf export test $(pwd)
+		export cd export export local
+&& then -eu --verbose echo export readonly readonly echo local |
+$(pwd) awk 2>/dev/null printf awk sed --verbose test "$1" readonly export printf
+2>/dev/null local cd export $(pwd) 'quoted text' $(pwd) 'quoted text' ${HOME}
+		cd then readonly then echo
+		done local -eu awk awk ${HOME} x=1 && done $(pwd) /usr/bin
+readonly -eu cd --verbose x=1 && done done $(pwd) readonly readonly
+	"$@" export && 2>/dev/null --verbose grep 2>/dev/null x=1 cd -eu | echo $(pwd)
+		$(pwd) ${HOME} echo $(pwd) && "$1" && ${HOME} 2>/dev/null sed done 'quoted text'
+	x=1 ${HOME} export ${HOME}
+		/usr/bin done awk local export echo && "$1" /usr/bin "$@" -eu echo test | ${HOME}
+	-eu -eu 'quoted text' x=1 | grep readonly export 'quoted text' local -eu cd
+		printf export export cd | -eu "$@" cd ${HOME} readonly
+x=1 && then && echo echo | x=1 ${HOME} echo echo awk export "$1" awk
+$(pwd) ${HOME} awk grep ${HOME} then echo
+	--verbose $(pwd) $(pwd) "$@" then && --verbose | ${HOME}
+'quoted text' --verbose readonly awk test then grep cd | done x=1 echo "$1"
+$(pwd) export "$@" readonly ${HOME} test
+	test | local -eu -eu echo --verbose done x=1 "$1" 'quoted text' ${HOME} cd
+	sed 2>/dev/null cd "$@" readonly grep local printf /usr/bin
+/usr/bin grep then $(pwd)
+		awk ${HOME} x=1 -eu awk done awk x=1 'quoted text' && sed --verbose then
+		"$@" | local local grep 2>/dev/null echo printf /usr/bin grep 'quoted text'
+	${HOME} -eu --verbose 2>/dev/null sed "$1" printf --verbose
+echo sed $(pwd) /usr/bin &&
+	export x=1 -eu --verbose test cd | x=1 echo x=1 /usr/bin --verbose
+-eu cd readonly local -eu cd --verbose
+"$@" cd -eu test awk
+		echo | readonly /usr/bin && "$1" "$1" awk
+	x=1 -eu 'quoted text' | local readonly echo
+printf grep echo sed cd -eu local test && /usr/bin "$@" $(pwd)
+	-eu 'quoted text' echo grep 'quoted text'
+echo --verbose | readonly echo "$@" && | done
+		$(pwd) readonly awk printf local done awk "$@" test printf test x=1 export cd
+x=1 "$@" test 'quoted text' echo readonly 'quoted text'
+echo cd "$1" local | done export /usr/bin printf "$@" -eu ${HOME} sed readonly
+	sed echo done x=1 test printf then "$1" grep -eu test done readonly
+		"$@" local 'quoted text' then done 'quoted text'
+		"$@" cd | "$@" done "$1" "$1" test grep "$1" cd export x=1 awk export
+		then && && echo readonly x=1 'quoted text' ${HOME}
+		awk grep && awk /usr/bin readonly cd -eu x=1 -eu printf echo awk then test
+		2>/dev/null sed $(pwd) 'quoted text'
+local sed test $(pwd) x=1 /usr/bin awk --verbose awk then readonly sed "$1"
+	${HOME} then sed readonly awk readonly $(pwd) echo sed 2>/dev/null | done
+${HOME} local awk echo ${HOME} cd echo | test echo -eu x=1 cd grep export
+then --verbose awk awk -eu 2>/dev/null && x=1 'quoted text' 2>/dev/null echo awk
+done "$@" done export test /usr/bin
+		then done readonly sed export echo -eu grep | | ${HOME} 2>/dev/null $(pwd) "$@"
+-eu test 2>/dev/null $(pwd) export sed printf --verbose done
+		local | "$@" sed test readonly printf 'quoted text' ${HOME}
+awk sed grep x=1 then cd sed "$1" /usr/bin grep
+--verbose cd $(pwd) --verbose 'quoted text'
+	2>/dev/null | -eu printf
+printf | cd then printf
+	then 'quoted text' 'quoted text' printf ${HOME} --verbose readonly ${HOME} "$1"
+	"$@" then grep $(pwd) export /usr/bin -eu sed printf && local done ${HOME}
+| -eu x=1 sed 2>/dev/null x=1 /usr/bin "$1" grep then $(pwd) printf x=1 && cd
+	readonly grep ${HOME} test && grep "$@" /usr/bin /usr/bin echo && -eu grep
+	grep grep | "$@" ${HOME} done grep $(pwd) "$1"
+	local readonly export readonly
+readonly echo $(pwd) cd printf "$1" done 'quoted text' export
+-eu x=1 x=1 $(pwd) done x=1 2>/dev/null | cd "$1" then 'quoted text'
+		local echo 2>/dev/null export $(pwd) echo sed | 'quoted text'
+	$(pwd) -eu test printf then echo grep awk && echo
+export x=1 then 2>/dev/null
+cd $(pwd) test x=1 | && "$@" then --verbose export /usr/bin echo 'quoted text'
+	${HOME} awk local 'quoted text' grep done done -eu "$1" 2>/dev/null
+		--verbose -eu $(pwd) sed x=1 export "$1" ${HOME}
+cd grep then -eu $(pwd) sed "$1" $(pwd) && awk /usr/bin ${HOME} readonly x=1 'quoted text'
+		cd awk echo readonly echo cd local test cd done ${HOME} then done --verbose
+		x=1 local -eu export done "$@" $(pwd) -eu $(pwd) local readonly
+		test && --verbose /usr/bin -eu grep && done grep x=1 local
+done --verbose cd $(pwd) then x=1 done x=1 -eu --verbose x=1 $(pwd)
+	$(pwd) sed awk echo readonly x=1 --verbose 2>/dev/null readonly
+	grep grep "$1" printf "$@" done
+	awk printf awk grep --verbose printf
+	test --verbose 'quoted text' && then export export && cd
+		-eu awk -eu done export "$1" "$1" | && sed printf -eu $(pwd) grep local -eu
+		'quoted text' readonly /usr/bin 'quoted text' then sed sed
+	grep 2>/dev/null cd cd awk ${HOME} cd readonly
+awk | export readonly local echo grep ${HOME} -eu done test done --verbose
+	2>/dev/null test export printf "$@" cd done "$@" 2>/dev/null sed 'quoted text'
+	done awk -eu | local export "$@" 'quoted text'
+"$1" then then x=1 2>/dev/null 2>/dev/null grep $(pwd)
+sed echo printf 'quoted text' done local
+sed then readonly test echo "$@" grep done local
+export test $(pwd) $(pwd) $(pwd) cd printf 2>/dev/null && awk 2>/dev/null
+-eu --verbose $(pwd) export echo x=1 done printf && 'quoted text'
+grep echo then /usr/bin readonly grep "$1" /usr/bin ${HOME} /usr/bin
+$(pwd) "$@" -eu $(pwd) $(pwd) /usr/bin | "$@" "$@" test "$1"
+test ${HOME} sed "$1" then done &&
+--verbose | | sed cd test then --verbose
+cd "$1" test "$@" export ${HOME} done x=1 $(pwd) grep | $(pwd)
+	cd sed x=1 2>/dev/null grep ${HOME} $(pwd) ${HOME} test && --verbose
+grep test local cd cd 2>/dev/null echo readonly && /usr/bin -eu
+	sed test ${HOME} awk &&
+	--verbose awk && $(pwd) printf printf "$@" $(pwd) local 'quoted text' &&
+	${HOME} local -eu 2>/dev/null "$1" awk /usr/bin cd -eu grep local
+	echo -eu | test readonly && then $(pwd)
+	cd $(pwd) cd grep "$@" /usr/bin
+test ${HOME} x=1 2>/dev/null
+		"$1" awk readonly && "$@"
+	then x=1 2>/dev/null 2>/dev/null
+		'quoted text' readonly --verbose grep "$@" --verbose export ${HOME} test export
+		x=1 --verbose $(pwd) awk | | cd && local echo
+		"$@" test "$@" awk readonly $(pwd) 2>/dev/null 'quoted text' echo
+"$@" --verbose echo local 2>/dev/null | export
+		printf cd awk export "$@" cd
+export | "$1" -eu --verbose "$@" /usr/bin -eu $(pwd) $(pwd) local
+cd --verbose 'quoted text' then ${HOME} "$@" $(pwd) printf ${HOME}
+x=1 2>/dev/null grep sed then ${HOME} sed "$@" printf
+readonly "$@" local | then awk ${HOME} export
+"$1" grep cd done printf ${HOME} /usr/bin /usr/bin sed x=1 export
+		echo 'quoted text' 'quoted text' x=1 ${HOME} $(pwd)
+x=1 awk /usr/bin grep done export readonly $(pwd)
+$(pwd) then then export $(pwd) test --verbose "$@" export
+	$(pwd) export done test x=1 $(pwd) local readonly
+grep --verbose 2>/dev/null echo cd -eu echo sed then 2>/dev/null
+		--verbose test --verbose
+		local readonly $(pwd) "$@" "$1" done local ${HOME} sed "$1" /usr/bin
+	done -eu local /usr/bin -eu ${HOME}
+		/usr/bin && "$1" -eu x=1 cd cd readonly test --verbose | sed
+		test awk local grep then "$1" 2>/dev/null
+		grep test done "$@" 2>/dev/null awk -eu
+$(pwd) 2>/dev/null | && --verbose
+		"$@" 'quoted text' 'quoted text' sed grep echo sed /usr/bin grep
+		test printf $(pwd) $(pwd) test && 'quoted text' && sed awk $(pwd) /usr/bin
+	grep 'quoted text' readonly x=1 echo $(pwd) export 2>/dev/null -eu
+	awk then export test --verbose
+	cd then x=1 printf readonly "$1" | printf
+2>/dev/null 'quoted text' /usr/bin
+	awk "$1" /usr/bin "$1" x=1 "$1" x=1 awk
+		test 2>/dev/null x=1 --verbose
+		sed awk --verbose x=1 then then --verbose echo 'quoted text'
+-eu 'quoted text' echo printf then cd 2>/dev/null --verbose export $(pwd) /usr/bin
+	x=1 grep 2>/dev/null then 'quoted text' ${HOME} export "$1"
+	x=1 -eu ${HOME} "$1" /usr/bin "$@" x=1 then -eu readonly
+	export printf "$@" awk 'quoted text' "$1" /usr/bin echo local
+--verbose done export
+		cd && ${HOME} --verbose test done printf "$1" /usr/bin sed cd local
+		sed grep cd 'quoted text' sed
+	| --verbose cd --verbose done readonly -eu local export cd "$@" ${HOME}
+		grep 'quoted text' "$@" awk echo 'quoted text' grep printf local --verbose
+		done -eu echo echo grep /usr/bin echo then "$@"
+done x=1 awk test echo $(pwd) then
+	grep done 2>/dev/null then then --verbose grep $(pwd) && grep
+	export $(pwd) | sed done "$@" 'quoted text'
+		&& && "$@" test awk | 'quoted text' grep local 'quoted text' grep $(pwd)
+| && "$@" "$1" | readonly /usr/bin -eu x=1 readonly
+then --verbose grep | $(pwd) test && sed 'quoted text' | awk
+		then -eu printf && -eu grep local "$1" then
+	"$@" printf ${HOME} sed done awk "$@" "$@" export test
+		| printf --verbose x=1 export then | done --verbose -eu "$@" export readonly
+--verbose readonly echo readonly
+	awk /usr/bin readonly test $(pwd) cd && | grep printf
+--verbose --verbose $(pwd) x=1 | grep grep local $(pwd) done
+		readonly -eu $(pwd) awk done printf awk 'quoted text' /usr/bin | sed echo x=1
+	${HOME} test readonly 2>/dev/null export | grep /usr/bin awk --verbose
+		"$1" | && then ${HOME} awk $(pwd) && test grep export
+		local /usr/bin | 'quoted text'
+printf /usr/bin test -eu 'quoted text' readonly sed then local
+${HOME} 'quoted text' | /usr/bin | awk awk
+/usr/bin --verbose sed "$@" readonly "$@" then then x=1
+'quoted text' "$1" /usr/bin 2>/dev/null 'quoted text' readonly cd done 2>/dev/null
+		echo && | cd printf ${HOME} /usr/bin
+local then /usr/bin 'quoted text' done /usr/bin && --verbose local test awk x=1
+echo && grep readonly echo
+printf grep readonly 2>/dev/null | done ${HOME} test readonly printf echo -eu
+/usr/bin | awk cd export then x=1 --verbose
+cd sed "$@" | $(pwd) 'quoted text' done "$@" && "$@"
+		export 2>/dev/null test x=1 printf 2>/dev/null --verbose $(pwd) cd
+		&& cd "$@" local 2>/dev/null sed local
+&& local 'quoted text' then | $(pwd) done echo 2>/dev/null test sed
+	"$@" test | sed /usr/bin grep echo -eu test printf done --verbose grep
+	export $(pwd) ${HOME} /usr/bin 'quoted text' ${HOME} echo printf ${HOME} "$@"
+	'quoted text' -eu echo then
+	'quoted text' -eu && -eu echo grep grep export ${HOME} cd test then "$1"
+		awk done done echo sed | 'quoted text' "$@"
+	then awk then "$@" then
+export export test grep then /usr/bin && x=1 -eu printf sed | "$@" --verbose
+grep sed x=1 "$1" local "$1" sed done | "$1" /usr/bin /usr/bin 'quoted text'
+"$@" $(pwd) $(pwd) sed "$1" readonly test then -eu 'quoted text' && -eu "$1"
+"$@" 'quoted text' "$@" 2>/dev/null 'quoted text'
+	export --verbose $(pwd) ${HOME} ${HOME} --verbose
+"$@" local echo readonly $(pwd) done test export echo awk "$1" export then /usr/bin
+	awk 2>/dev/null x=1 local readonly local
+	x=1 test printf local ${HOME} "$1" 2>/dev/null echo
+	awk echo printf cd readonly then export "$@" awk awk local -eu
+done test ${HOME} x=1 2>/dev/null
+	export -eu x=1 --verbose
+		awk then then $(pwd) test | cd --verbose
+	test "$1" awk ${HOME} 'quoted text' ${HOME} | ${HOME} echo 2>/dev/null readonly
+	local && 'quoted text' grep /usr/bin x=1 'quoted text'
+		cd cd /usr/bin test printf
+	| printf then echo 2>/dev/null | -eu -eu "$1" grep echo
+		/usr/bin readonly echo
+sed cd grep ${HOME} cd "$1" echo /usr/bin x=1 2>/dev/null /usr/bin
+		echo cd && grep "$@" test /usr/bin cd cd done -eu --verbose --verbose
+		"$@" grep sed ${HOME} x=1 ${HOME} && test printf
+	printf && "$@" "$@" 2>/dev/null /usr/bin 2>/dev/null "$@" printf $(pwd)
+	awk /usr/bin 'quoted text' test export cd | x=1 done "$@" test ${HOME} cd
+&& 'quoted text' sed /usr/bin
+	x=1 printf echo "$@" --verbose
+		export done grep "$@" grep "$@" 'quoted text' 'quoted text'
+		2>/dev/null x=1 echo cd "$@" cd 2>/dev/null $(pwd) awk test
+2>/dev/null cd 2>/dev/null
+		${HOME} printf "$@" --verbose cd && grep "$@"
+		$(pwd) "$1" | export cd sed printf test readonly && /usr/bin local ${HOME}
+test awk done $(pwd) grep awk readonly
+'quoted text' "$@" done 'quoted text' --verbose done x=1 awk "$1" echo local
+	cd test $(pwd) sed cd grep | export done $(pwd) sed awk export printf then
+		-eu -eu done -eu export | awk 2>/dev/null cd readonly awk 'quoted text'
+| -eu 2>/dev/null cd local &&
+		grep awk awk then "$1" grep
+then x=1 grep done printf "$1" grep ${HOME} test echo done x=1 printf
+x=1 /usr/bin grep $(pwd) && && cd awk echo
+grep $(pwd) then grep "$@" local printf -eu cd sed && x=1 awk cd done 'quoted text'
+'quoted text' ${HOME} echo 'quoted text' export export "$1" 'quoted text' test
+		done /usr/bin test "$@" && export --verbose
+		x=1 test "$1" readonly && $(pwd) 2>/dev/null
+		"$@" && local printf /usr/bin 2>/dev/null 2>/dev/null
+		then "$1" grep done && $(pwd) done then ${HOME} readonly 2>/dev/null && readonly
+		test | x=1 && awk readonly readonly echo local echo | then then echo /usr/bin
+		&& $(pwd) 2>/dev/null readonly awk awk local
+		cd export done echo --verbose local -eu
+		--verbose --verbose x=1 grep printf readonly
+&& "$1" echo && -eu /usr/bin $(pwd) awk cd "$1" local
+	printf readonly /usr/bin
+	-eu export cd x=1 --verbose
+		local grep echo readonly cd $(pwd) done $(pwd) local
+		--verbose x=1 cd --verbose $(pwd)
+cd export local $(pwd) local "$1" then done done local cd x=1 done 'quoted text'
+		--verbose then export "$@" grep done export 'quoted text'
+--verbose ${HOME} && test "$@" done sed x=1 "$@" then sed local export sed
+	printf "$1" -eu 'quoted text' grep | export
+local printf local sed echo awk $(pwd) ${HOME} printf
+	then grep sed export /usr/bin printf printf $(pwd) sed
+	/usr/bin done "$@" -eu awk printf sed grep done
+	awk readonly printf readonly | /usr/bin done printf | then readonly 2>/dev/null
+echo export grep 'quoted text' done sed echo 2>/dev/null -eu --verbose
+/usr/bin done | export readonly
+	export cd --verbose then 'quoted text' -eu /usr/bin 2>/dev/null
+		sed awk -eu $(pwd) local x=1 $(pwd) echo grep
+	$(pwd) sed 2>/dev/null ${HOME} /usr/bin
+"$1" "$@" "$@" readonly "$@" "$1"
+	--verbose done export && then "$1" test
+		${HOME} printf -eu $(pwd)
+	awk grep readonly 2>/dev/null "$@" readonly
+$(pwd) ${HOME} -eu then cd --verbose sed && then
+local x=1 ${HOME} echo readonly sed -eu grep 2>/dev/null local $(pwd) 2>/dev/null
+		"$1" x=1 x=1 /usr/bin -eu --verbose grep
+/usr/bin -eu $(pwd) x=1 sed 2>/dev/null /usr/bin
+	awk x=1 awk --verbose && export local test "$@" | && /usr/bin printf 'quoted text'
+	-eu printf test ${HOME} grep local test local | "$1" 'quoted text' ${HOME} -eu
+		export test | printf 'quoted text' "$1" grep echo $(pwd) "$1" printf |
+		grep "$@" echo --verbose "$@" awk "$1" ${HOME} awk "$1" 'quoted text'
+	| 'quoted text' readonly sed cd && -eu readonly ${HOME} printf
+$(pwd) 'quoted text' echo awk /usr/bin export grep && "$1" | /usr/bin "$@" x=1
+		/usr/bin local cd grep | printf
+		-eu printf "$1" then x=1 --verbose "$1" export sed grep then export local
+	x=1 -eu grep | local export grep local
+	$(pwd) /usr/bin done
+| ${HOME} done --verbose
+		local ${HOME} awk "$1" --verbose test "$@" 'quoted text'
+/usr/bin export -eu ${HOME}
+printf "$@" test awk done
+		readonly then export grep cd --verbose && done && printf
+then "$1" done "$@" ${HOME} grep | then 2>/dev/null test
+		--verbose local readonly then /usr/bin then export printf export grep
+	$(pwd) done 2>/dev/null /usr/bin sed /usr/bin
+	"$@" ${HOME} export echo then awk $(pwd) x=1 awk && awk
+		cd 2>/dev/null printf 2>/dev/null then cd then
+	sed awk -eu printf $(pwd) $(pwd) sed readonly "$1" -eu export
+		done sed x=1 && done $(pwd) | 2>/dev/null && done --verbose test 'quoted text' |
+printf 'quoted text' 2>/dev/null
+echo "$1" -eu cd printf ${HOME} |
+		| done $(pwd) "$@" "$1" ${HOME}
+	/usr/bin readonly cd printf &&
+		-eu $(pwd) --verbose readonly readonly
+		"$@" && 2>/dev/null local sed | x=1 then |
+		2>/dev/null 2>/dev/null 2>/dev/null
+$(pwd) export printf done grep awk | grep $(pwd) awk cd
+	export cd "$1" then 'quoted text' "$@" "$1" "$1" |
+		sed /usr/bin x=1 test awk grep
+'quoted text' sed echo cd sed sed | local "$1" $(pwd) && x=1 local ${HOME}
+	| --verbose done x=1 test
+	test cd export && -eu readonly local done -eu /usr/bin
+		printf | "$@" 'quoted text' "$1" test grep && "$@" echo
+	cd echo "$@" -eu then readonly cd --verbose 'quoted text' sed
+then --verbose $(pwd) "$@" -eu
+readonly "$@" then 2>/dev/null then --verbose -eu awk cd grep local echo /usr/bin
+		/usr/bin "$@" 2>/dev/null done "$@" printf test x=1 $(pwd)
+		sed 'quoted text' then then 2>/dev/null then
+	'quoted text' x=1 printf printf sed -eu sed && echo --verbose
+readonly grep x=1 sed grep awk -eu "$@" export 'quoted text' -eu
+	done && awk readonly --verbose
+	'quoted text' 'quoted text'
+"$1" 2>/dev/null | 2>/dev/null 2>/dev/null "$@" --verbose cd then ${HOME}
+		then test export printf 2>/dev/null
+	awk done echo sed test --verbose test awk done then
+		readonly | ${HOME} test readonly grep $(pwd)
+then --verbose 2>/dev/null
+		--verbose readonly awk | ${HOME} readonly "$@" then done
+	test 'quoted text' "$1" x=1 then $(pwd) ${HOME} echo "$@"
+		cd -eu && printf "$@" x=1 local | --verbose $(pwd)
+export awk 2>/dev/null test then sed && $(pwd) x=1
+export then echo cd done ${HOME} then | test $(pwd)
+		${HOME} grep ${HOME} export then $(pwd) echo grep awk export $(pwd)
+	test /usr/bin awk --verbose
+echo /usr/bin test awk 2>/dev/null grep 'quoted text' x=1 ${HOME} readonly
+		grep grep 'quoted text'
+		then test $(pwd) then sed 'quoted text' "$@"
+		readonly "$@" readonly sed ${HOME} printf "$1" export
+done done printf export ${HOME} awk echo -eu export
+	x=1 printf printf export test x=1 x=1 then x=1 --verbose
+test awk test | x=1 | local then 'quoted text' ${HOME} sed local local sed 2>/dev/null
+	done done $(pwd) export "$@" then /usr/bin "$@" "$1" | readonly
+	grep "$@" | local && 2>/dev/null
+--verbose $(pwd) ${HOME} "$@" /usr/bin 'quoted text' local
+	sed ${HOME} export && | sed grep $(pwd) export local
+	2>/dev/null then awk --verbose then 2>/dev/null echo
+$(pwd) x=1 printf 'quoted text' done -eu 2>/dev/null
+x=1 'quoted text' sed | ${HOME} then printf then "$@" done awk sed
+		awk readonly 'quoted text' x=1
+		x=1 done test $(pwd) grep test --verbose cd
+	--verbose grep "$@" local && 'quoted text' -eu -eu awk $(pwd) /usr/bin
+-eu --verbose test awk -eu export awk
+export --verbose test then
+		printf x=1 -eu | -eu ${HOME} test local 2>/dev/null ${HOME}
+	$(pwd) /usr/bin done test
+done "$1" "$@" 'quoted text' awk readonly -eu ${HOME} | -eu test readonly echo
+	"$1" -eu x=1 test printf grep cd echo
+		$(pwd) echo 2>/dev/null | && echo x=1 2>/dev/null
+&& $(pwd) -eu done ${HOME} 'quoted text'
+	export --verbose export 2>/dev/null
+	${HOME} -eu && /usr/bin "$@" sed
+		--verbose readonly sed && "$@" --verbose 'quoted text' ${HOME}
+grep && awk && 2>/dev/null done "$1" test readonly | -eu
+	| $(pwd) --verbose "$@" ${HOME} readonly awk && && ${HOME}
+		/usr/bin readonly cd printf awk $(pwd) sed --verbose
+		x=1 /usr/bin && -eu /usr/bin
+		| "$1" "$1" then $(pwd) test $(pwd)
+done 2>/dev/null echo cd readonly test && local
+| x=1 sed test x=1 && -eu awk ${HOME}
+2>/dev/null done -eu -eu then "$@" && /usr/bin
+	test 'quoted text' "$@" test 2>/dev/null echo readonly && x=1 2>/dev/null
+		cd test --verbose | && 'quoted text' /usr/bin done | then
+		then /usr/bin 2>/dev/null --verbose cd "$@" /usr/bin
+	awk "$1" then printf
+	"$@" 'quoted text' x=1 ${HOME} printf awk grep
+	awk awk sed -eu && $(pwd) -eu local 'quoted text' 2>/dev/null
+	/usr/bin awk export "$@" export
+printf local then --verbose
+		grep export local ${HOME}
+	"$1" -eu sed local $(pwd) done
+x=1 -eu echo echo $(pwd) /usr/bin && --verbose -eu printf
+cd 2>/dev/null "$@" export cd done --verbose |
+grep 'quoted text' printf cd echo sed then printf --verbose
+readonly x=1 sed sed "$@" export --verbose
+		echo -eu 2>/dev/null /usr/bin $(pwd) grep
+		"$1" x=1 2>/dev/null sed 2>/dev/null -eu cd cd /usr/bin readonly
+	printf local "$1" x=1 printf cd 2>/dev/null -eu export ${HOME} printf
+2>/dev/null awk printf ${HOME} x=1 | && -eu local "$@" printf then
+		grep sed done echo "$1" 2>/dev/null 'quoted text' readonly
+	'quoted text' ${HOME} then && -eu grep /usr/bin sed
+then "$1" 'quoted text' local readonly 2>/dev/null "$1" sed | echo readonly &&
+		| then printf 2>/dev/null x=1 awk 2>/dev/null 'quoted text' grep | export sed
+	local | then && done cd $(pwd) ${HOME} 2>/dev/null -eu && x=1 awk sed readonly
+/usr/bin $(pwd) grep cd done echo 2>/dev/null done && x=1 local ${HOME} readonly
+		export grep awk --verbose && test 2>/dev/null /usr/bin
+readonly $(pwd) && && x=1 /usr/bin echo && $(pwd) cd cd --verbose && printf ${HOME}
+		2>/dev/null grep echo 'quoted text'
+	grep test /usr/bin then $(pwd) awk
+		${HOME} && | 2>/dev/null done readonly 2>/dev/null 'quoted text' grep
+		'quoted text' && $(pwd) "$1" ${HOME} printf echo -eu cd cd $(pwd) local
+	&& cd x=1 $(pwd) ${HOME} x=1 printf "$@" echo | readonly --verbose printf
+&& local export echo printf echo x=1 && --verbose
+	test "$1" sed awk 'quoted text' readonly awk 2>/dev/null
+&& readonly local -eu awk 2>/dev/null x=1 | grep cd export printf
+	local cd echo cd export echo
+--verbose sed echo sed sed | -eu printf "$@" ${HOME} "$1" echo printf readonly
+	-eu test export readonly 'quoted text'
+	sed readonly x=1 2>/dev/null grep /usr/bin sed printf 2>/dev/null then local
+	echo $(pwd) "$1" /usr/bin cd
+	-eu "$1" -eu export readonly cd export /usr/bin && 'quoted text'
+sed x=1 x=1 test export -eu cd
+test && ${HOME} 2>/dev/null done export cd ${HOME} then echo
+		$(pwd) "$1" local readonly ${HOME} cd -eu cd echo | cd
+x=1 then x=1 readonly then awk --verbose printf
+		| "$1" 'quoted text' "$@" sed "$1" local test $(pwd) export
+export local "$@" export sed $(pwd) /usr/bin export "$@" 2>/dev/null && awk
+		&& cd x=1 --verbose cd printf cd printf
+		'quoted text' sed done cd /usr/bin sed local grep sed echo awk done
+	'quoted text' printf test then local $(pwd) awk echo ${HOME} awk x=1 && export
+x=1 2>/dev/null local | ${HOME} export readonly
+awk $(pwd) sed -eu /usr/bin printf /usr/bin local awk
+		--verbose 'quoted text' 2>/dev/null awk --verbose
+/usr/bin printf grep grep awk "$1" -eu readonly ${HOME} cd readonly
+		cd export ${HOME} then awk readonly | awk local awk export 'quoted text'
+		${HOME} | && "$1" 2>/dev/null sed then readonly /usr/bin readonly awk sed ${HOME}
+		readonly 'quoted text' -eu printf 'quoted text' -eu done 'quoted text'
+| $(pwd) local -eu --verbose awk $(pwd) -eu x=1 ${HOME}
+	grep then grep $(pwd) ${HOME} | cd 'quoted text' echo done -eu $(pwd) ${HOME}
+readonly grep then done ${HOME} 2>/dev/null "$1" cd test -eu awk cd test then
+		readonly "$@" && echo awk "$1"
+		awk | local done | readonly 2>/dev/null x=1 --verbose echo x=1
+	echo ${HOME} export test "$@" export cd then /usr/bin "$@" -eu
+		sed grep x=1 awk test sed
+	printf "$@" $(pwd) then grep readonly -eu grep
+		-eu export | $(pwd) awk done 2>/dev/null "$@" 2>/dev/null
+	2>/dev/null && $(pwd) x=1
+	then test then ${HOME} $(pwd)
+		"$1" && x=1 && cd x=1 --verbose 'quoted text' $(pwd) readonly ${HOME} printf x=1
+		grep x=1 'quoted text' sed
+		echo grep | -eu then readonly then cd printf $(pwd) $(pwd)
+cd x=1 echo $(pwd) x=1 "$1"
+		| local --verbose && test
+${HOME} readonly echo sed then awk sed
+		local "$1" grep cd done grep
+/usr/bin awk 'quoted text' readonly
+	--verbose $(pwd) grep "$@" 'quoted text' 'quoted text'
+"$@" 'quoted text' sed x=1 sed sed awk test && grep readonly x=1 grep -eu awk
+	printf "$@" local local readonly then $(pwd) cd 'quoted text' printf printf
+		${HOME} grep $(pwd) "$1" | "$1" sed echo printf cd readonly "$1" $(pwd) cd "$1"
+		grep grep grep 2>/dev/null
+awk test done readonly grep $(pwd) | 'quoted text' export /usr/bin
+2>/dev/null test ${HOME} -eu then grep "$1" done export 2>/dev/null
+	then "$@" | && printf | -eu 'quoted text' 2>/dev/null
+		readonly "$@" grep export && readonly test /usr/bin
+	| grep awk ${HOME} grep 2>/dev/null x=1 export | export "$@" | export x=1 $(pwd)
+		grep export "$1" local grep local | /usr/bin
+	$(pwd) ${HOME} grep | export | export sed
+		${HOME} "$@" && sed sed x=1 cd then /usr/bin
+	then done $(pwd) readonly 'quoted text'
+	cd grep x=1 /usr/bin printf -eu export test test ${HOME} x=1 printf then --verbose
+2>/dev/null ${HOME} echo export cd /usr/bin test readonly /usr/bin
+	local then "$1" cd "$@" cd 'quoted text' done x=1 printf "$@" "$1"
+| $(pwd) && echo then -eu 2>/dev/null &&
+	awk | local then then echo --verbose -eu test test awk
+--verbose test then 'quoted text' echo
+local local x=1 echo && --verbose "$@" test test echo -eu printf
+/usr/bin then grep awk done 2>/dev/null sed --verbose awk --verbose
+	sed /usr/bin $(pwd) 'quoted text' "$1" ${HOME} x=1
+		printf ${HOME} "$@" sed awk /usr/bin
+		&& awk ${HOME} 2>/dev/null "$@" echo then ${HOME}
+		-eu /usr/bin | 2>/dev/null ${HOME}
+		then && -eu echo 2>/dev/null readonly && echo && printf "$@" printf
+	&& 2>/dev/null cd 2>/dev/null awk && --verbose --verbose
+		"$1" local $(pwd) | awk "$@" readonly done
+sed "$@" sed cd printf | echo printf -eu printf export readonly
+		$(pwd) -eu ${HOME} "$@" | ${HOME}
+x=1 cd x=1 2>/dev/null printf | grep export --verbose
+'quoted text' ${HOME} $(pwd)
+grep && "$@" sed awk export | test 'quoted text' local
+	echo "$@" ${HOME} grep "$1" x=1 "$@" | "$@"
+	sed sed printf 'quoted text' -eu
+test x=1 "$@" /usr/bin cd echo -eu ${HOME} --verbose $(pwd)
+-eu grep cd cd sed && grep | done printf echo
+	${HOME} awk -eu | --verbose printf cd 'quoted text' readonly sed | | printf
+		local printf local echo /usr/bin ${HOME} ${HOME}
+		grep ${HOME} done | 'quoted text' $(pwd) cd | "$@" echo && 'quoted text' test
+&& 2>/dev/null test 2>/dev/null readonly local ${HOME} "$1" ${HOME} export
+		"$1" echo readonly && export
+		2>/dev/null grep export ${HOME}
+		/usr/bin export sed && 'quoted text' x=1 && --verbose "$@" /usr/bin awk
+		done then cd && cd grep "$@" printf sed "$@" local 2>/dev/null
+	${HOME} local grep sed ${HOME} ${HOME} ${HOME} test
+	x=1 echo -eu /usr/bin cd echo | then readonly
+		--verbose printf test
+test test cd "$@" export readonly
+grep 2>/dev/null awk x=1 then 2>/dev/null test cd then sed x=1 local $(pwd)
+printf x=1 done printf echo then "$@" printf
+		export awk test --verbose done /usr/bin ${HOME}
+/usr/bin && grep | 'quoted text' 2>/dev/null
+test done "$@" readonly && /usr/bin
+/usr/bin cd echo ${HOME} --verbose sed 2>/dev/null
+	$(pwd) /usr/bin $(pwd) printf && $(pwd) /usr/bin local
+"$1" sed local awk echo awk | | "$@" /usr/bin cd awk -eu readonly
+		2>/dev/null awk done 'quoted text' done -eu "$1" awk printf 'quoted text'
+		--verbose readonly grep ${HOME} "$@" local
+		cd local "$@" cd export
+		"$1" "$@" --verbose test sed 'quoted text'
+		then 2>/dev/null readonly -eu done --verbose then -eu ${HOME} readonly
+2>/dev/null "$@" ${HOME} | local export /usr/bin grep
+	sed sed awk awk $(pwd)
@@ -0,0 +1,2001 @@
+		echo "$1" then --verbose cd "$@" test local "$@" "$@"
+	done $(pwd) 'quoted text' "$1" grep | && sed && -eu then local awk
+	'quoted text' export 'quoted text' --verbose
+	cd printf x=1 sed x=1 test 'quoted text' | sed cd $(pwd) $(pwd)
+	test readonly done "$@" done done 2>/dev/null --verbose --verbose
+	then -eu sed awk | grep echo echo test && then x=1 done then
+	sed ${HOME} test ${HOME} printf $(pwd) x=1
+	then $(pwd) 'quoted text' -eu 2>/dev/null
+		${HOME} && | | export | then sed printf echo printf "$1" "$1" 2>/dev/null
+	sed sed cd grep "$@" done awk ${HOME} -eu && sed $(pwd) 'quoted text'
+	"$1" 'quoted text' 'quoted text' x=1 sed -eu awk done printf
+		local local cd && 2>/dev/null readonly x=1 --verbose
+		local "$@" | done ${HOME} test printf --verbose "$1" | "$@" test done
+	"$1" test awk local x=1 grep "$@" ${HOME} /usr/bin grep awk
+		readonly | local cd | sed x=1 /usr/bin
+	x=1 then echo then /usr/bin readonly
+		'quoted text' 'quoted text' ${HOME}
+"$@" printf -eu -eu export printf "$@" echo awk 'quoted text'
+'quoted text' grep echo && ${HOME}
+cd $(pwd) echo -eu grep cd ${HOME} cd export echo printf echo sed /usr/bin
+	cd "$1" done awk local local 'quoted text' echo ${HOME} echo "$@"
+		done cd awk sed cd cd ${HOME} && "$@" local
+awk 'quoted text' /usr/bin -eu grep "$@" cd test
+grep $(pwd) printf sed
+	| x=1 readonly "$@" awk done done export "$@" $(pwd) 2>/dev/null --verbose
+		x=1 $(pwd) && cd cd --verbose test $(pwd) 2>/dev/null
+	test /usr/bin printf 'quoted text' 2>/dev/null 'quoted text' done
+x=1 grep /usr/bin awk ${HOME} echo sed --verbose $(pwd) awk then && readonly
+"$@" /usr/bin 2>/dev/null cd done "$1" awk
+	grep $(pwd) grep | sed awk && export
+		/usr/bin -eu 'quoted text' echo grep
+	local && awk "$@" local then && && export && 2>/dev/null "$1" cd local
+		test readonly && $(pwd) local x=1 'quoted text'
+grep cd 2>/dev/null 'quoted text' 2>/dev/null | awk then "$1"
+	readonly test cd export then readonly
+x=1 done sed cd cd /usr/bin echo $(pwd) /usr/bin then "$1"
+	$(pwd) export 2>/dev/null 2>/dev/null
+grep export --verbose export
+		${HOME} | echo ${HOME} cd ${HOME}
+&& --verbose printf sed then "$1" /usr/bin done ${HOME}
+		cd readonly awk x=1 export x=1 2>/dev/null "$1" export | 'quoted text' 'quoted text'
+	done /usr/bin "$@" readonly "$1"
+	grep "$1" printf awk
+'quoted text' ${HOME} test export readonly grep test --verbose
+		| then -eu x=1 export grep
+	awk 2>/dev/null readonly printf -eu --verbose readonly
+		printf readonly 'quoted text' | cd cd readonly --verbose export /usr/bin
+		test cd && printf awk printf sed "$@" --verbose printf 'quoted text' export |
+		echo awk $(pwd) --verbose export test -eu done export && done | done sed
+		"$@" grep 'quoted text' && grep
+-eu --verbose export readonly awk local && test
+printf test then test done awk $(pwd) 'quoted text' /usr/bin printf export $(pwd)
+		awk awk && awk echo echo cd "$1" 2>/dev/null readonly "$1" then 2>/dev/null
+		sed 2>/dev/null $(pwd) cd -eu cd cd awk then export --verbose export --verbose
+		$(pwd) awk -eu local 'quoted text'
+--verbose "$1" done readonly "$1" | grep --verbose "$1" test ${HOME} then grep
+	$(pwd) awk "$@" 'quoted text' 'quoted text' readonly /usr/bin printf readonly awk
+	export x=1 2>/dev/null -eu readonly grep awk then "$@"
+local readonly $(pwd) -eu grep
+	local echo "$@" cd cd "$1" x=1 "$1" awk "$1" test $(pwd)
+		echo export printf echo awk export 2>/dev/null -eu
+	--verbose "$@" test awk printf /usr/bin $(pwd) -eu x=1 done cd 'quoted text'
+		x=1 | && grep 2>/dev/null -eu
+cd readonly test then && awk && 2>/dev/null printf x=1 cd done x=1 done export
+	--verbose then "$1" /usr/bin -eu ${HOME} -eu done | "$@" --verbose "$@" | readonly
+export echo local readonly -eu 2>/dev/null printf done echo 2>/dev/null local
+	local ${HOME} /usr/bin awk x=1 local readonly "$@" awk local
+		&& 'quoted text' $(pwd) test export
+	/usr/bin --verbose then sed then ${HOME} -eu cd printf done |
+'quoted text' | $(pwd) 'quoted text' echo
+		test $(pwd) test sed "$@" --verbose
+sed sed 'quoted text' export "$1" local
+		cd --verbose && 2>/dev/null && export ${HOME} local
+/usr/bin done "$1" cd export test 2>/dev/null ${HOME} && test awk
+	printf readonly readonly then && ${HOME} local "$@" | readonly done
+	echo grep "$1" x=1 grep 2>/dev/null ${HOME}
+echo test --verbose x=1 /usr/bin --verbose cd printf
+		echo 'quoted text' echo readonly
+	"$@" ${HOME} export /usr/bin test sed grep "$1" then test export
+export | awk grep "$1" --verbose
+		${HOME} $(pwd) test readonly then
+	echo 2>/dev/null 'quoted text' export | "$1" then ${HOME} /usr/bin
+--verbose 2>/dev/null ${HOME} then -eu export sed done test
+	/usr/bin then then cd
+		readonly local awk --verbose /usr/bin printf awk awk test grep
+	local 'quoted text' then -eu cd 2>/dev/null
+-eu test ${HOME} x=1 test local grep sed then
+2>/dev/null readonly "$1" awk x=1 printf local awk
+	readonly x=1 test | done export -eu | ${HOME} "$@" grep test cd
+	"$1" ${HOME} sed grep sed && test then awk cd local 'quoted text' test
+	then | 'quoted text' sed cd x=1 export readonly x=1 && printf "$1" --verbose | 'quoted text'
+		"$@" ${HOME} done done --verbose done
+| ${HOME} then "$@" export
+printf then test grep "$1" "$1" awk then --verbose 2>/dev/null grep | 2>/dev/null
+	readonly "$@" 'quoted text' printf then grep done | done export -eu readonly
+	'quoted text' ${HOME} /usr/bin
+	'quoted text' x=1 "$1" local export
+		$(pwd) cd sed printf cd test awk local 2>/dev/null x=1 local sed 2>/dev/null
+${HOME} readonly "$@"
+sed test "$1" 'quoted text' 'quoted text' printf 2>/dev/null readonly echo
+	2>/dev/null readonly printf printf /usr/bin -eu local "$@" --verbose -eu && /usr/bin
+	cd -eu "$1" then cd sed grep awk ${HOME}
+"$1" local then echo then readonly "$@"
+echo /usr/bin echo && echo done test done cd test done
+"$1" /usr/bin /usr/bin echo && sed &&
+	$(pwd) --verbose -eu /usr/bin export 'quoted text'
+	echo /usr/bin grep 2>/dev/null awk "$@" printf sed | 'quoted text' -eu -eu local
+		-eu cd cd 2>/dev/null x=1 --verbose /usr/bin then 2>/dev/null done -eu
+x=1 done echo awk 2>/dev/null
+	printf --verbose ${HOME} printf
+awk printf done local $(pwd) readonly echo then then grep --verbose cd --verbose
+awk | export && "$1" ${HOME}
+	printf --verbose "$@" local then 2>/dev/null "$1"
+	grep "$1" grep | x=1 then grep "$@" "$@" && --verbose
+	grep $(pwd) printf "$1" 2>/dev/null 2>/dev/null
+	2>/dev/null && grep local ${HOME} grep sed
+		&& test ${HOME} -eu readonly done && cd echo readonly && local readonly
+		| sed "$1" readonly test x=1 | ${HOME} $(pwd) "$1" 2>/dev/null awk sed printf
+$(pwd) export awk done echo x=1 cd then cd && grep "$@"
+test $(pwd) echo then printf readonly /usr/bin ${HOME} local
+	/usr/bin --verbose readonly printf awk 2>/dev/null
+		then then -eu readonly export -eu
+local cd | 'quoted text' export --verbose
+	$(pwd) 'quoted text' test local
+${HOME} "$1" | echo export 2>/dev/null
+$(pwd) grep sed done done then cd x=1 -eu
+	readonly 2>/dev/null --verbose $(pwd) &&
+	export awk ${HOME} "$@" |
+	/usr/bin | sed -eu test awk awk /usr/bin $(pwd) local x=1 sed "$@"
+export printf $(pwd) 2>/dev/null
+	awk then -eu sed && test echo --verbose done sed
+	"$1" | echo export sed "$1" readonly awk grep | $(pwd) 2>/dev/null sed printf
+	echo x=1 printf printf local
+	awk | then | printf readonly
+		cd $(pwd) export | /usr/bin $(pwd) 2>/dev/null echo readonly /usr/bin ${HOME}
+	sed /usr/bin x=1 $(pwd)
+		test | ${HOME} x=1 "$@" --verbose
+		2>/dev/null x=1 printf
+&& grep ${HOME} 2>/dev/null 'quoted text' test ${HOME}
+	"$1" awk local test | $(pwd) -eu export && /usr/bin sed /usr/bin grep awk |
+export done x=1 then "$@" local cd then readonly
+	printf local --verbose 2>/dev/null awk export
+	export ${HOME} grep done readonly $(pwd) sed ${HOME} 'quoted text'
+	${HOME} | | /usr/bin printf "$1" $(pwd) sed
+		cd export awk test printf 'quoted text' readonly
+2>/dev/null && x=1 readonly "$@" local "$@" cd test $(pwd) --verbose
+awk --verbose test &&
+		$(pwd) cd 2>/dev/null | cd -eu 2>/dev/null then | x=1 then "$1" && readonly
+	$(pwd) cd local 2>/dev/null then local done -eu | then cd /usr/bin grep
+	grep && export readonly $(pwd)
+		'quoted text' grep echo
+/usr/bin 'quoted text' ${HOME} done && ${HOME}
+2>/dev/null grep then x=1 readonly
+${HOME} then grep "$@" ${HOME} "$@" 'quoted text'
+local "$@" 2>/dev/null x=1 done
+	sed ${HOME} "$@" --verbose grep "$1" $(pwd) export 'quoted text'
+	${HOME} awk done -eu local test &&
+echo "$1" ${HOME} test $(pwd) 'quoted text' "$1" awk x=1 $(pwd) local /usr/bin
+	${HOME} | && test $(pwd) awk $(pwd) && grep printf
+		done readonly ${HOME} done "$1"
+		/usr/bin --verbose awk grep local printf
+then 2>/dev/null cd then awk --verbose ${HOME} "$1" printf $(pwd) readonly
+		| x=1 cd local printf
+		test -eu cd /usr/bin "$1" x=1 then readonly
+	then --verbose x=1 -eu export export | $(pwd) | 2>/dev/null then x=1 x=1 $(pwd)
+		--verbose cd done --verbose echo readonly local && --verbose local
+		sed awk cd echo export echo then -eu sed then 'quoted text' "$@" readonly ${HOME}
+		2>/dev/null export readonly echo export
+x=1 && "$1" then local awk x=1 awk sed && export awk awk 'quoted text'
+export then ${HOME} echo cd 2>/dev/null -eu cd && then
+	x=1 readonly ${HOME} --verbose "$1" cd sed done then
+then done x=1 export | cd && 'quoted text'
+		--verbose readonly local test 2>/dev/null "$@" then readonly 2>/dev/null
+	/usr/bin local 'quoted text' awk printf "$1" -eu /usr/bin readonly "$1" readonly
+		test $(pwd) | cd /usr/bin ${HOME}
+	readonly "$@" "$@" printf done awk export ${HOME} &&
+x=1 test 'quoted text' awk export --verbose done echo
+done export cd awk done ${HOME} 'quoted text' awk
+		"$1" 2>/dev/null test "$1" then export local awk --verbose
+	--verbose awk echo grep then awk ${HOME} export -eu | && readonly
+		| echo | then "$@" &&
+	/usr/bin --verbose test done export && awk sed "$1" | x=1 ${HOME} awk
+		| "$1" --verbose -eu "$1" ${HOME} $(pwd) "$1" -eu -eu printf done echo
+		'quoted text' sed | cd export export 2>/dev/null "$1" $(pwd)
+	echo 2>/dev/null grep x=1 readonly done grep grep echo -eu $(pwd)
+	grep echo export sed cd -eu x=1 ${HOME}
+	cd sed "$@" export "$1" 2>/dev/null
+	cd then -eu local then $(pwd) test && sed ${HOME} cd
+printf echo awk readonly && test --verbose awk grep --verbose sed printf --verbose
+		done export -eu then echo 'quoted text' ${HOME} x=1 cd && | $(pwd) | ${HOME} x=1
+		awk | -eu printf $(pwd) printf echo
+--verbose x=1 sed awk && --verbose printf sed echo | "$1" "$1" grep
+local sed readonly printf && then 'quoted text'
+echo printf --verbose awk printf sed export
+		/usr/bin 'quoted text' --verbose
+export then 2>/dev/null test local test cd cd /usr/bin 'quoted text' && then
+then readonly 'quoted text' && 'quoted text'
+		/usr/bin --verbose | grep /usr/bin printf echo
+		$(pwd) readonly "$1" && && printf "$1" $(pwd) --verbose
+test ${HOME} ${HOME} "$1" --verbose
+/usr/bin --verbose done "$@" "$1" "$1" ${HOME} ${HOME} /usr/bin 2>/dev/null
+	'quoted text' cd "$1" -eu 'quoted text' /usr/bin
+	"$@" sed awk ${HOME} readonly test x=1 --verbose
+	| $(pwd) x=1 2>/dev/null --verbose --verbose awk local 2>/dev/null
+	'quoted text' printf "$1" done --verbose --verbose
+readonly cd | grep 'quoted text' "$1" 'quoted text' done --verbose echo
+	awk done readonly then then awk x=1 /usr/bin printf
+printf $(pwd) x=1 done done printf cd /usr/bin "$@" echo
+	x=1 readonly grep | "$1" $(pwd) $(pwd) cd 2>/dev/null cd
+--verbose && ${HOME} "$1" x=1 'quoted text' grep
+done --verbose | ${HOME}
+/usr/bin | 2>/dev/null then 2>/dev/null
+then 'quoted text' 2>/dev/null done printf
+	printf "$@" echo export $(pwd) "$1" grep
+	done cd printf "$@" 'quoted text' readonly &&
+		&& "$1" 'quoted text'
+	$(pwd) | awk export printf && test export sed 'quoted text' "$@"
+	export local awk 2>/dev/null --verbose
+		| 2>/dev/null && -eu $(pwd) && test then
+		| echo ${HOME} awk sed awk ${HOME} echo readonly cd test then printf echo 2>/dev/null
+$(pwd) awk echo readonly echo export cd && x=1 test grep x=1 test /usr/bin
+	done "$1" test cd readonly && local local cd export && echo
+		test cd ${HOME} && 2>/dev/null | sed -eu $(pwd) -eu sed sed grep
+local cd echo test local /usr/bin
+	2>/dev/null ${HOME} grep export
+	printf x=1 local echo ${HOME} --verbose
+	"$1" $(pwd) then then grep --verbose
+sed "$@" then "$@" test 'quoted text' export ${HOME} sed test "$@" 'quoted text'
+		grep local -eu echo 2>/dev/null printf local $(pwd)
+printf then grep && -eu && x=1 -eu
+		"$1" cd 'quoted text' | 'quoted text' 2>/dev/null grep
+	sed && local local local | && --verbose sed then
+		| "$1" ${HOME} 2>/dev/null done 2>/dev/null then 2>/dev/null && "$@" 'quoted text'
+	&& $(pwd) then cd readonly test
+		'quoted text' sed --verbose cd
+/usr/bin cd "$@" $(pwd) ${HOME} $(pwd) test "$@"
+		awk cd 2>/dev/null -eu done x=1 $(pwd) sed cd &&
+	&& /usr/bin export test local "$1" /usr/bin
+export echo cd echo x=1 -eu 2>/dev/null "$1" 2>/dev/null
+2>/dev/null "$@" awk
+test && grep "$@" $(pwd) echo | -eu export cd export test | cd | x=1 grep
+	"$@" /usr/bin -eu grep 2>/dev/null echo 2>/dev/null grep local --verbose done
+	$(pwd) local test 'quoted text' local "$1" done --verbose
+printf sed export printf x=1 "$1" echo x=1
+test 'quoted text' test 'quoted text' "$@" "$1" echo --verbose test -eu awk "$1"
+	echo export export $(pwd) x=1 sed x=1 printf local 'quoted text' echo "$1"
+	"$@" && && 2>/dev/null cd then done test cd local then local sed x=1 echo
+awk ${HOME} "$@" 'quoted text' /usr/bin done export --verbose x=1 awk
+-eu $(pwd) printf awk awk printf printf grep then echo ${HOME}
+		/usr/bin | && ${HOME} | sed awk grep 2>/dev/null
+"$@" x=1 done $(pwd) printf
+	--verbose grep awk "$@" sed sed echo printf | -eu local local echo cd $(pwd) awk
+cd awk awk -eu printf echo awk x=1 awk && "$@" sed sed /usr/bin
+	"$1" "$1" --verbose echo export /usr/bin --verbose
+	echo awk test /usr/bin readonly readonly 'quoted text'
+		'quoted text' --verbose "$1" awk 'quoted text' 'quoted text'
+		then readonly local export awk "$@" "$@" 'quoted text'
+printf && test $(pwd) printf readonly ${HOME}
+local cd then /usr/bin 2>/dev/null $(pwd) ${HOME} readonly printf ${HOME} sed
+		'quoted text' done 2>/dev/null then grep && export /usr/bin
+printf "$@" "$@" cd then echo cd --verbose ${HOME} sed export
+		"$@" readonly cd printf sed 'quoted text'
+		2>/dev/null then ${HOME} 2>/dev/null "$@"
+	export awk test printf $(pwd) awk cd sed done -eu | done 2>/dev/null
+	x=1 awk | readonly awk awk test echo && && test test
+	done ${HOME} ${HOME} printf
+		'quoted text' sed echo
+	"$@" readonly && export ${HOME} | local printf
+		then $(pwd) -eu cd -eu printf test "$1" 2>/dev/null
+		done export done test cd grep 'quoted text' printf x=1 "$1" echo
+		local x=1 done sed grep then test 'quoted text' readonly sed --verbose "$@" cd
+echo -eu test then printf sed $(pwd) x=1 "$@" ${HOME} then | cd && -eu readonly
+	then sed /usr/bin ${HOME} 2>/dev/null local test echo sed -eu local "$@" "$1"
+	done ${HOME} echo cd export -eu
+export --verbose "$@" echo printf "$1"
+	grep then sed echo ${HOME} ${HOME} $(pwd) sed $(pwd) x=1 x=1 "$@"
+		&& export local echo
+		$(pwd) && awk 2>/dev/null "$1" && $(pwd) 2>/dev/null && ${HOME}
+x=1 "$1" /usr/bin 'quoted text'
+	local 2>/dev/null x=1 awk --verbose x=1 $(pwd) x=1 test done
+cd $(pwd) cd done then test sed
+		--verbose echo -eu "$1" "$@"
+echo -eu sed echo local echo x=1 --verbose | ${HOME} 2>/dev/null
+echo && local | "$1" && | local cd | then awk x=1 grep
+		/usr/bin sed awk echo local && "$@"
+	local $(pwd) /usr/bin ${HOME} && $(pwd) 2>/dev/null test /usr/bin echo
+test $(pwd) x=1 awk -eu -eu -eu x=1 awk echo sed 2>/dev/null
+		then ${HOME} awk $(pwd) grep -eu echo test 'quoted text'
+		| test ${HOME} $(pwd) x=1 2>/dev/null echo awk "$@" printf then echo
+	cd "$@" && readonly x=1 ${HOME} && sed export printf
+	echo | grep | && readonly
+/usr/bin grep $(pwd)
+/usr/bin local $(pwd) test grep --verbose x=1 printf readonly readonly
+	echo grep sed && | --verbose export sed sed /usr/bin $(pwd) $(pwd) "$@" cd "$@"
+	&& "$@" && 2>/dev/null readonly grep echo /usr/bin --verbose grep
+"$@" -eu local grep awk --verbose grep -eu 2>/dev/null | done 2>/dev/null
+awk && --verbose $(pwd) readonly
+grep -eu ${HOME} "$1" /usr/bin
+test readonly grep -eu "$@" test
+		sed grep then cd -eu /usr/bin && then awk --verbose
+$(pwd) ${HOME} echo then | echo export done awk 'quoted text' -eu sed -eu 'quoted text'
+		&& local -eu printf sed
+	'quoted text' cd then /usr/bin
+		| readonly -eu -eu "$@" x=1 awk
+	${HOME} local readonly
+		$(pwd) cd readonly sed -eu then done export readonly local "$1" ${HOME}
+	${HOME} export sed x=1 readonly grep sed sed sed sed test test test readonly
+'quoted text' awk readonly echo export
+		readonly --verbose -eu ${HOME} "$@" local then x=1 --verbose
+		grep ${HOME} $(pwd) export 'quoted text' then -eu
+'quoted text' $(pwd) /usr/bin done test 2>/dev/null cd cd cd -eu test
+--verbose printf $(pwd)
+"$@" x=1 sed test --verbose done printf -eu printf 'quoted text' awk ${HOME}
+		awk "$1" test && done sed --verbose then cd cd $(pwd) awk awk 'quoted text'
+	/usr/bin done test export then sed awk 'quoted text' sed local printf
+	"$1" printf "$1" export --verbose ${HOME} 'quoted text' local
+	--verbose sed ${HOME} && 'quoted text'
+	&& | local awk sed && | export --verbose x=1 /usr/bin done x=1 sed
+	&& 2>/dev/null cd $(pwd) $(pwd) ${HOME} $(pwd) && done ${HOME}
+	| --verbose x=1 2>/dev/null readonly test ${HOME} && && 2>/dev/null "$1" cd -eu
+		readonly 'quoted text' "$1" awk
+		grep ${HOME} printf 'quoted text'
+		2>/dev/null 2>/dev/null "$1" "$1" x=1 awk grep "$@" readonly
+		'quoted text' readonly --verbose local 2>/dev/null --verbose
+&& | grep "$@" 2>/dev/null $(pwd) -eu /usr/bin export done
+	cd then && done && | --verbose awk local 'quoted text' test "$1" readonly
+		grep $(pwd) cd export "$1" done echo /usr/bin ${HOME} echo && done /usr/bin
+		local $(pwd) awk x=1 && cd printf 2>/dev/null
+/usr/bin 'quoted text' printf
+printf -eu printf done readonly --verbose sed
+	cd 2>/dev/null test /usr/bin echo sed sed "$1" &&
+x=1 ${HOME} && printf "$1" awk | readonly "$1" export then grep
+	echo 2>/dev/null --verbose "$@" "$1" "$1" readonly
+test "$@" x=1 $(pwd) | "$1" then local grep echo then cd 2>/dev/null grep --verbose
+/usr/bin /usr/bin done ${HOME} && /usr/bin done "$1" x=1 && 'quoted text'
+/usr/bin $(pwd) printf && cd -eu sed local /usr/bin readonly sed
+		'quoted text' cd "$1" 'quoted text' done /usr/bin awk export readonly $(pwd) done
+done echo printf 'quoted text' x=1 'quoted text' 2>/dev/null cd local
+	'quoted text' grep export readonly local $(pwd) --verbose
+then then /usr/bin $(pwd) echo "$1" export "$@" /usr/bin x=1
+	/usr/bin export -eu 2>/dev/null -eu 2>/dev/null
+		sed 'quoted text' 'quoted text' cd then
+		cd printf test done test cd echo -eu grep 2>/dev/null awk --verbose sed
+grep grep readonly && "$@" then echo -eu 'quoted text' cd grep cd --verbose
+		printf done /usr/bin local x=1 && | cd ${HOME} export x=1 done
+export ${HOME} sed awk && | | 'quoted text' x=1 $(pwd) then $(pwd) 2>/dev/null
+then | export $(pwd) 2>/dev/null
+		| -eu done $(pwd) x=1 echo
+grep sed /usr/bin grep "$1" export && grep done echo | export
+	echo then && ${HOME} echo $(pwd) test "$@" && printf -eu |
+	2>/dev/null readonly awk ${HOME} 'quoted text'
+--verbose --verbose printf $(pwd)
+	export cd export local
+"$@" cd readonly x=1 readonly "$@"
+'quoted text' 2>/dev/null $(pwd) --verbose /usr/bin grep grep readonly
+then 2>/dev/null "$1" 'quoted text' 2>/dev/null | awk done
+--verbose x=1 x=1 then printf then ${HOME} -eu -eu export readonly ${HOME}
+		then awk done ${HOME} then | test $(pwd) awk export 2>/dev/null "$@" 2>/dev/null
+export && "$1" grep sed done x=1 then export --verbose 'quoted text'
+printf "$1" ${HOME} 2>/dev/null "$@"
+		echo --verbose 'quoted text' ${HOME} export "$@"
+then readonly sed export $(pwd) 'quoted text' "$@" readonly | 'quoted text' &&
+| 2>/dev/null readonly ${HOME} 2>/dev/null awk
+	grep && done 'quoted text' | /usr/bin echo
+		'quoted text' -eu 2>/dev/null test /usr/bin -eu grep | local then "$1"
+	'quoted text' grep ${HOME} ${HOME} ${HOME} --verbose
+		'quoted text' echo cd /usr/bin sed local test awk /usr/bin
+	/usr/bin then echo --verbose
+	/usr/bin grep then "$@" grep 'quoted text' x=1 /usr/bin x=1 /usr/bin /usr/bin
+		test /usr/bin x=1 readonly then echo echo readonly
+		then awk test "$@" /usr/bin -eu && /usr/bin readonly | cd export
+		x=1 $(pwd) readonly grep && test test local cd awk 2>/dev/null printf 'quoted text'
+	done cd | 'quoted text' sed ${HOME} cd local --verbose
+		2>/dev/null 'quoted text' cd ${HOME} cd --verbose
+sed export readonly done | ${HOME} 2>/dev/null then awk grep cd 'quoted text'
+	--verbose "$@" x=1 --verbose printf --verbose local
+		&& x=1 then grep "$1" -eu -eu
+$(pwd) printf $(pwd) | cd done printf grep 'quoted text' grep
+		--verbose 'quoted text' cd -eu -eu | && 2>/dev/null /usr/bin | cd done -eu &&
+		"$1" echo echo /usr/bin printf export echo test /usr/bin grep ${HOME}
+export grep done then --verbose ${HOME} x=1 cd test readonly -eu
+	local /usr/bin cd 2>/dev/null echo cd cd "$1"
+"$@" readonly readonly done
+		-eu "$@" printf ${HOME} | awk
+	local && sed -eu 2>/dev/null ${HOME} /usr/bin
+sed sed --verbose x=1 export grep then x=1 x=1 $(pwd) x=1 export test then
+"$1" then "$@" printf "$@" "$1" printf -eu grep test /usr/bin -eu 2>/dev/null
+		| done "$@" -eu awk then
+	-eu "$@" sed test /usr/bin 'quoted text' ${HOME} $(pwd)
+		"$@" 'quoted text' && grep export awk "$1" "$@" test "$1" $(pwd)
+--verbose test /usr/bin readonly done local echo printf 2>/dev/null "$@" sed done
+		-eu cd echo "$@" /usr/bin cd | 2>/dev/null local grep echo -eu cd 'quoted text'
+local local then x=1 x=1 export | echo --verbose local printf --verbose
+	readonly 'quoted text' awk test "$1" | -eu then x=1 x=1 2>/dev/null then printf
+-eu done "$1" grep awk
+		&& readonly -eu export test done awk then awk $(pwd) --verbose $(pwd)
+x=1 readonly $(pwd) "$@" |
+		2>/dev/null local --verbose local export "$@" awk -eu $(pwd)
+"$1" ${HOME} 2>/dev/null "$1" cd local readonly
+	echo 'quoted text' test --verbose && --verbose 'quoted text'
+&& awk printf done 'quoted text' --verbose readonly --verbose
+2>/dev/null ${HOME} --verbose
+-eu $(pwd) done test "$@" ${HOME} then x=1 printf | export /usr/bin grep
+echo awk /usr/bin grep cd grep /usr/bin | -eu done export /usr/bin && done test
+	echo echo "$1" ${HOME} 'quoted text' then test
+		test awk "$@" sed "$@" readonly awk local 2>/dev/null
+/usr/bin readonly awk sed && --verbose 2>/dev/null
+x=1 x=1 readonly local grep 2>/dev/null echo -eu 'quoted text' 2>/dev/null --verbose
+x=1 readonly "$@" ${HOME} then sed
+sed export readonly export then cd done readonly grep then then $(pwd) "$1" test
+		'quoted text' "$1" local
+		sed -eu test 2>/dev/null /usr/bin "$@" local printf 2>/dev/null "$1" test echo |
+readonly ${HOME} x=1 readonly && sed sed "$1" cd awk
+sed export ${HOME} 'quoted text'
+awk | | then 2>/dev/null
+	| echo echo ${HOME} "$@" grep readonly -eu ${HOME} readonly sed | | -eu /usr/bin
+	grep test export 2>/dev/null sed then x=1 echo echo
+	cd export "$1" /usr/bin
+	-eu x=1 "$1" readonly awk sed /usr/bin
+	echo readonly $(pwd) test ${HOME} then | x=1 $(pwd) echo printf
+$(pwd) "$1" ${HOME} --verbose grep | x=1
+		done 2>/dev/null | awk grep 2>/dev/null
+-eu test "$1" sed | -eu grep --verbose test printf "$1" awk "$@" echo
+	grep readonly grep ${HOME} readonly readonly -eu readonly "$1" x=1 /usr/bin
+	/usr/bin /usr/bin -eu test sed x=1 then "$@" readonly
+		awk && $(pwd) $(pwd) | ${HOME} cd $(pwd) awk "$1"
+--verbose printf && sed 2>/dev/null grep
+x=1 "$1" echo then readonly done "$@" export
+grep test ${HOME} ${HOME} "$@" done test echo "$@" readonly local
+	then /usr/bin export printf printf 'quoted text'
+		test then /usr/bin readonly --verbose
+		awk "$@" "$@" cd /usr/bin &&
+		${HOME} grep grep grep sed export printf sed "$1" export x=1 | local export $(pwd)
+2>/dev/null then then ${HOME} "$@"
+		"$1" "$@" $(pwd) x=1 local $(pwd)
+echo printf ${HOME} /usr/bin 'quoted text'
+	test export test echo sed && done sed
+	"$@" sed "$1" test readonly awk export local && sed done
+	cd readonly then grep ${HOME} local
+grep done cd && "$1" ${HOME}
+cd 2>/dev/null printf -eu "$1" | export readonly
+	echo cd echo $(pwd) local && cd x=1 local x=1 --verbose "$1"
+		'quoted text' --verbose | cd printf local x=1 2>/dev/null cd printf
+$(pwd) sed /usr/bin /usr/bin printf $(pwd) x=1 --verbose -eu
+	&& $(pwd) "$@" 2>/dev/null --verbose grep -eu then --verbose 2>/dev/null
+	awk echo x=1 echo sed && 2>/dev/null sed cd $(pwd) readonly cd && export echo
+	done x=1 /usr/bin /usr/bin awk readonly /usr/bin -eu
+test sed $(pwd) export done echo local 'quoted text'
+export readonly awk local
+"$1" x=1 2>/dev/null "$@" printf /usr/bin
+		$(pwd) && done done export | "$1" echo 'quoted text'
+	x=1 grep $(pwd) sed cd "$1" done sed awk $(pwd)
+	2>/dev/null $(pwd) --verbose "$1" grep 'quoted text'
+		x=1 /usr/bin awk $(pwd) then x=1 'quoted text' sed --verbose cd "$1"
+awk grep grep grep | printf && export local -eu 2>/dev/null $(pwd)
+		sed local echo --verbose 2>/dev/null cd export printf "$@" /usr/bin
+		echo readonly echo --verbose 2>/dev/null /usr/bin done readonly
+"$1" ${HOME} 'quoted text' && -eu sed readonly ${HOME} | 'quoted text'
+		test local ${HOME} 'quoted text' -eu "$@" &&
+"$1" 'quoted text' echo echo echo --verbose awk
+	grep then /usr/bin x=1 "$@"
+		'quoted text' printf grep x=1 --verbose x=1 cd awk "$1" "$1" -eu cd -eu then
+		${HOME} cd "$1" echo then | "$@" export /usr/bin test test --verbose | cd
+x=1 x=1 sed 2>/dev/null -eu
+		--verbose x=1 local $(pwd) export grep
+awk grep done 2>/dev/null ${HOME}
+printf export grep test done readonly $(pwd) done "$@" x=1 --verbose test -eu |
+done "$@" && x=1 grep ${HOME} /usr/bin
+		x=1 readonly cd x=1 sed && grep
+'quoted text' --verbose x=1 then x=1 $(pwd) -eu then
+export then echo echo ${HOME} readonly awk "$@" --verbose -eu
+export test awk grep "$1" done readonly | echo 'quoted text'
+| && "$@" ${HOME} && test &&
+echo x=1 ${HOME} awk readonly done then
+grep $(pwd) readonly "$@" --verbose "$1" test local readonly 'quoted text'
+		sed readonly "$@" /usr/bin x=1 2>/dev/null done cd ${HOME} 'quoted text' --verbose
+	local printf grep x=1 "$@" readonly test readonly $(pwd) | "$1" ${HOME} ${HOME}
+sed echo done 2>/dev/null local && local then x=1
+		&& | cd 'quoted text' readonly "$1"
+printf | /usr/bin "$1" cd
+	${HOME} test --verbose awk && --verbose test local printf export 'quoted text'
+		| "$@" cd 2>/dev/null local cd local "$1"
+&& readonly "$1" echo awk "$1" awk cd then awk awk cd --verbose grep grep $(pwd)
+		done done readonly x=1
+	"$@" printf echo 'quoted text' then /usr/bin
+		x=1 done $(pwd) "$1" export /usr/bin /usr/bin x=1 sed local --verbose
+		-eu ${HOME} grep 'quoted text' cd grep -eu "$@" local grep 2>/dev/null
+local awk printf echo "$@" sed | 'quoted text' /usr/bin test && echo 2>/dev/null
+$(pwd) $(pwd) cd local then local "$@" && awk ${HOME}
+		awk 'quoted text' 2>/dev/null echo sed sed sed /usr/bin x=1 2>/dev/null
+"$1" export readonly test test "$1" local -eu | sed -eu printf 'quoted text'
+	printf echo && /usr/bin 2>/dev/null
+		awk cd x=1 test && "$1" -eu &&
+2>/dev/null test done awk x=1
+		-eu grep test printf echo --verbose | then export sed echo
+	test 'quoted text' cd echo /usr/bin $(pwd)
+		awk "$1" test sed "$1" then 'quoted text' echo then
+export 2>/dev/null "$@" -eu export echo -eu ${HOME} x=1 ${HOME} local
+test echo local 'quoted text' --verbose "$@" 2>/dev/null /usr/bin awk test cd readonly
+grep --verbose export done done -eu done && ${HOME} $(pwd) "$@" x=1 cd
+	grep sed local | echo cd && "$1" x=1 -eu then -eu export
+		'quoted text' $(pwd) -eu 'quoted text' --verbose
+--verbose sed /usr/bin 2>/dev/null | "$@" && 'quoted text'
+then 'quoted text' grep cd "$@" ${HOME} $(pwd)
+	local export | echo 'quoted text'
+done then /usr/bin test printf $(pwd) local sed printf "$1" ${HOME} $(pwd)
+	done && export --verbose readonly $(pwd)
+		export echo sed "$@" local test /usr/bin printf $(pwd) test echo echo cd
+		awk sed grep then && ${HOME} printf printf $(pwd) readonly cd
+		-eu export printf cd 2>/dev/null
+printf -eu /usr/bin $(pwd) grep then
+printf then "$1" $(pwd) export printf
+		${HOME} | printf --verbose printf
+readonly 'quoted text' grep test | readonly ${HOME}
+		-eu echo | -eu echo x=1 'quoted text'
+		export x=1 echo -eu && cd "$@"
+local printf 2>/dev/null sed /usr/bin readonly
+	grep && readonly readonly printf && /usr/bin sed local ${HOME} /usr/bin
+	$(pwd) && $(pwd) --verbose -eu printf readonly /usr/bin $(pwd) "$1" test
+	local export test test then &&
+		done test cd /usr/bin && 2>/dev/null && $(pwd) ${HOME} --verbose
+--verbose && ${HOME} test --verbose
+	| "$1" done ${HOME} && sed export 'quoted text' $(pwd) 2>/dev/null
+	${HOME} "$@" | /usr/bin && --verbose awk echo && export export "$1"
+		&& done --verbose cd readonly 'quoted text'
+'quoted text' 'quoted text' local ${HOME} 2>/dev/null 'quoted text'
+| /usr/bin 2>/dev/null 'quoted text' && "$1" test readonly
+echo readonly test --verbose local /usr/bin 2>/dev/null printf && sed x=1 2>/dev/null
+		sed 2>/dev/null | export local /usr/bin test test ${HOME}
+"$1" printf $(pwd) "$@"
+local sed sed "$1" --verbose done "$@" awk done 2>/dev/null export done local
+| grep && --verbose export "$@" test printf
+		echo /usr/bin $(pwd) echo export readonly local cd /usr/bin --verbose
+		done awk x=1 echo --verbose | | /usr/bin cd 'quoted text' grep --verbose
+	"$@" awk 'quoted text' | cd readonly x=1 then -eu awk test awk cd 2>/dev/null
+test done printf grep readonly done x=1 done
+		then "$1" cd export 2>/dev/null /usr/bin printf echo "$1" cd | "$1"
+$(pwd) -eu ${HOME} printf "$@" sed cd test | export
+local awk && export 2>/dev/null test sed
+		sed awk echo x=1 grep "$@" ${HOME} echo then then 'quoted text'
+		cd /usr/bin readonly x=1 grep x=1 "$1" | && $(pwd) export "$1" printf
+		$(pwd) cd /usr/bin test $(pwd) local --verbose 2>/dev/null ${HOME}
+then done done done | test ${HOME} && $(pwd) "$@" local "$@" 'quoted text'
+	--verbose export x=1 local echo
+grep ${HOME} ${HOME} x=1 grep grep readonly --verbose 2>/dev/null readonly -eu sed
+		test ${HOME} $(pwd) && readonly
+'quoted text' export printf test 2>/dev/null
+		echo $(pwd) -eu && -eu $(pwd) "$1" test cd grep done
+		grep local 2>/dev/null | x=1 grep && -eu sed echo "$1" ${HOME}
+	--verbose grep | export awk x=1 cd awk done local "$1" ${HOME}
+		-eu ${HOME} local cd then ${HOME} 2>/dev/null
+	'quoted text' test readonly $(pwd) done local export printf
+		'quoted text' x=1 test -eu
+"$@" then && local --verbose ${HOME} done printf grep awk -eu export done test
+		-eu x=1 export printf printf
+test awk /usr/bin --verbose
+	done cd export done sed ${HOME} -eu test
+	--verbose test echo done /usr/bin 'quoted text' "$1" export cd 'quoted text'
+$(pwd) echo echo then local
+local 2>/dev/null grep -eu "$1" then
+test ${HOME} cd grep then export x=1 awk "$@" local readonly then
+--verbose export && 'quoted text' printf export "$@"
+		/usr/bin grep sed done
+	"$1" $(pwd) awk && 2>/dev/null echo x=1 ${HOME} done 'quoted text' printf
+	grep && /usr/bin && --verbose readonly x=1 /usr/bin
+		test sed awk x=1 'quoted text'
+		done && local cd -eu | | sed local 2>/dev/null
+		local sed test awk -eu test test "$1" done && cd sed | test cd ${HOME} readonly
+	2>/dev/null $(pwd) x=1 'quoted text'
+	test printf readonly --verbose ${HOME}
+	x=1 2>/dev/null /usr/bin printf /usr/bin x=1 "$@" $(pwd) then 'quoted text'
+echo $(pwd) | "$1" -eu awk 'quoted text' 'quoted text' awk awk "$@" done |
+	"$@" echo export export printf 'quoted text' test readonly -eu
+		printf /usr/bin grep grep x=1 --verbose done test cd &&
+	cd "$1" readonly echo ${HOME} grep then "$@" && x=1 /usr/bin awk -eu printf
+		awk printf "$@" | export | --verbose ${HOME} sed readonly sed sed &&
+readonly 'quoted text' -eu done /usr/bin
+$(pwd) && x=1 sed cd echo | "$1" 2>/dev/null
+	local | "$1" $(pwd) awk x=1 awk local export | cd 'quoted text'
+		sed 2>/dev/null x=1 'quoted text'
+		2>/dev/null export echo x=1 --verbose cd cd awk | readonly --verbose
+	| sed export printf awk --verbose grep done && cd "$@" test cd readonly
+	| echo export /usr/bin --verbose readonly "$1" 2>/dev/null --verbose 2>/dev/null
+	cd ${HOME} awk export readonly local local printf "$@" readonly cd
+		export printf awk ${HOME} then $(pwd) | cd
+	"$@" --verbose 2>/dev/null "$1" $(pwd) readonly 2>/dev/null
+		done cd grep /usr/bin then printf export test ${HOME} -eu |
+	${HOME} /usr/bin --verbose "$1" ${HOME} grep x=1 2>/dev/null readonly
+		"$@" --verbose -eu export
+		test export "$@" echo /usr/bin -eu x=1 grep done export 2>/dev/null
+awk $(pwd) cd | done local --verbose local
+&& x=1 export readonly /usr/bin then "$@" --verbose grep 2>/dev/null
+		cd "$@" x=1 'quoted text'
+	/usr/bin then | readonly awk $(pwd) cd readonly
+		/usr/bin export -eu echo local "$1" then awk "$@" $(pwd) printf
+then done local export "$1" done then sed /usr/bin
+local readonly $(pwd) "$@" export test export
+		cd done then test done awk "$@" "$1" then
+	$(pwd) awk export ${HOME} test "$@"
+		${HOME} grep | ${HOME} /usr/bin test local 2>/dev/null cd grep $(pwd) echo
+/usr/bin readonly cd test $(pwd) ${HOME}
+export && ${HOME} echo readonly "$@" awk --verbose --verbose awk /usr/bin
+		local $(pwd) --verbose && done "$1" readonly $(pwd) "$@" | x=1
+	${HOME} --verbose $(pwd) grep export export -eu printf cd
+		readonly && export $(pwd) test
+	export "$1" /usr/bin export test awk --verbose --verbose grep
+echo cd cd ${HOME} cd printf readonly --verbose /usr/bin
+done test echo awk grep
+test done "$@" -eu local test | "$1" local test then 2>/dev/null
+	&& cd export | x=1 done /usr/bin /usr/bin 'quoted text' 2>/dev/null
+	printf export 'quoted text' "$@" "$1" x=1 | echo /usr/bin /usr/bin "$@" readonly
+		done /usr/bin ${HOME} 2>/dev/null grep "$1" --verbose
+		${HOME} ${HOME} --verbose "$1" | | && done then done awk -eu -eu
+		-eu /usr/bin sed -eu "$@" readonly && 'quoted text' done ${HOME} test /usr/bin
+2>/dev/null readonly $(pwd) test /usr/bin "$@" x=1 echo 'quoted text'
+"$@" 2>/dev/null readonly awk grep
+		x=1 printf | cd then printf local grep
+	export done /usr/bin then x=1 then local echo 2>/dev/null awk &&
+	&& readonly export echo /usr/bin x=1 /usr/bin local && 2>/dev/null
+		"$@" --verbose && | then local printf echo /usr/bin
+export ${HOME} 2>/dev/null printf then 'quoted text'
+	sed sed printf /usr/bin x=1 awk
+| $(pwd) sed sed export -eu -eu printf export test --verbose done readonly export
+		grep test /usr/bin cd && cd $(pwd) grep "$@" export cd | export --verbose &&
+		test "$1" readonly awk echo printf done && done ${HOME} $(pwd) $(pwd) --verbose
+	-eu printf local $(pwd) cd readonly
+	"$1" printf local readonly local export sed printf
+awk local test test done done 'quoted text'
+-eu x=1 test | $(pwd) x=1 -eu printf
+$(pwd) | "$@" awk awk "$1" "$1" printf
+"$1" done readonly "$@" sed
+	grep done then x=1 /usr/bin test printf | done readonly echo -eu 'quoted text'
+test "$@" printf sed grep --verbose
+printf done sed done sed 2>/dev/null readonly "$@" 2>/dev/null x=1 2>/dev/null
+	--verbose | --verbose ${HOME} then done && | "$1" -eu printf /usr/bin
+then "$@" --verbose 2>/dev/null
+"$@" echo cd $(pwd) 'quoted text' then sed ${HOME} printf ${HOME} | awk
+		export ${HOME} -eu $(pwd) -eu
+	sed ${HOME} test $(pwd) test 2>/dev/null
+/usr/bin readonly printf grep echo then cd
+echo then | cd grep | x=1 then --verbose awk
+	${HOME} printf done /usr/bin /usr/bin ${HOME} "$@" && 2>/dev/null export /usr/bin
+	export && cd --verbose export echo
+	local readonly /usr/bin local -eu readonly
+| export awk cd $(pwd) cd /usr/bin 2>/dev/null 'quoted text' awk
+	readonly readonly done --verbose cd local && $(pwd) 2>/dev/null --verbose "$@"
+		grep "$@" -eu then x=1 -eu echo 2>/dev/null 2>/dev/null export
+		x=1 test "$1" 'quoted text' test done then | local x=1 2>/dev/null
+	local sed sed --verbose cd readonly export /usr/bin && local
+printf "$1" done printf |
+	awk awk $(pwd) --verbose "$1" sed readonly --verbose
+	done "$1" | 2>/dev/null 'quoted text' sed
+	&& | "$@" test local $(pwd) awk "$@" then "$@" export $(pwd) $(pwd) /usr/bin $(pwd)
+	"$@" awk test done "$@"
+	${HOME} readonly sed ${HOME} "$@" printf readonly "$@"
+		cd done done -eu 2>/dev/null 2>/dev/null echo $(pwd)
+	local "$@" ${HOME} local done local then grep local 'quoted text'
+printf ${HOME} readonly && "$@" | -eu x=1 test
+	"$1" x=1 ${HOME} ${HOME} local awk echo readonly &&
+	cd 'quoted text' | readonly
+"$1" echo ${HOME} --verbose | echo /usr/bin test printf
+		export grep printf then cd "$@" --verbose x=1 readonly x=1 &&
+echo sed 'quoted text' done 'quoted text' $(pwd) x=1 test done
+"$@" local -eu 'quoted text' 2>/dev/null
+		cd x=1 "$@" printf /usr/bin then && export "$1" -eu
+	local ${HOME} test -eu --verbose done sed then x=1 sed grep /usr/bin --verbose
+grep sed printf awk then "$1"
+done 2>/dev/null && test --verbose
+	--verbose "$@" 'quoted text' readonly printf awk ${HOME}
+	grep local test printf | test $(pwd) /usr/bin printf readonly
+/usr/bin readonly sed sed -eu --verbose
+export printf then | grep 'quoted text' /usr/bin cd ${HOME}
+	then -eu 2>/dev/null local /usr/bin
+		--verbose ${HOME} export /usr/bin --verbose 2>/dev/null
+	--verbose done test printf "$1" readonly cd cd test sed | echo | | cd export $(pwd)
+	sed && x=1 done && $(pwd) -eu done ${HOME} readonly
+		--verbose sed cd "$@" "$@" echo cd cd sed --verbose
+readonly test -eu printf $(pwd) test sed "$@" /usr/bin echo 'quoted text' -eu
+	--verbose sed cd export readonly echo ${HOME} done sed echo && && && | sed
+	sed /usr/bin readonly then "$1" "$1"
+	then echo "$@" /usr/bin ${HOME} readonly /usr/bin x=1 x=1
+sed echo && local --verbose printf grep $(pwd) awk readonly x=1 test readonly
+"$@" --verbose printf | /usr/bin -eu ${HOME} awk
+	readonly cd readonly cd printf then
+	| cd local /usr/bin done echo 'quoted text' -eu 'quoted text' |
+		--verbose | ${HOME} /usr/bin
+		local /usr/bin sed grep readonly $(pwd)
+		-eu echo --verbose cd grep export readonly sed grep "$@" grep ${HOME} done readonly
+		export readonly cd cd awk "$@" | x=1 cd readonly |
+		"$@" sed 2>/dev/null /usr/bin test
+	| then -eu "$1" | -eu readonly
+2>/dev/null done sed $(pwd) x=1 export 2>/dev/null done "$@" local
+		cd printf echo sed $(pwd) | awk 2>/dev/null ${HOME} readonly awk $(pwd) echo
+		then export ${HOME} /usr/bin
+cd awk x=1 printf then &&
+		echo | cd readonly grep cd export
+	sed "$@" | sed printf 2>/dev/null then grep export printf
+	test awk ${HOME} 2>/dev/null sed then readonly local
+		-eu ${HOME} 'quoted text'
+	done printf && x=1 awk x=1 export then readonly | ${HOME} -eu
+	x=1 echo then sed | --verbose
+done -eu awk export "$@" readonly x=1 then
+	done export "$@" test 2>/dev/null x=1 then sed readonly 'quoted text' local done
+	"$@" && test /usr/bin && | 2>/dev/null ${HOME} && echo
+		grep sed x=1 "$1" && 'quoted text' "$1" readonly -eu "$@" ${HOME} -eu
+	local /usr/bin readonly "$1" echo | "$1" cd
+	test local readonly "$1"
+-eu awk --verbose then ${HOME} "$1" sed
+sed $(pwd) 2>/dev/null ${HOME} awk | done --verbose readonly awk
+	${HOME} awk done readonly "$@" export local sed -eu done local
+done sed done 2>/dev/null | test printf done
+'quoted text' sed done
+	awk export awk then ${HOME} awk "$1" | $(pwd)
+awk cd local echo then 2>/dev/null /usr/bin
+	"$@" 2>/dev/null $(pwd)
+sed /usr/bin awk -eu "$@" && test awk 2>/dev/null
+	test local $(pwd) awk | export 2>/dev/null 'quoted text' /usr/bin readonly
+echo done awk echo sed x=1
+	test readonly awk 2>/dev/null 2>/dev/null && 'quoted text' "$@" "$@" done
+sed grep sed awk cd echo readonly
+	printf grep && export ${HOME}
+2>/dev/null $(pwd) sed grep grep printf readonly export export "$1" /usr/bin
+${HOME} grep readonly ${HOME} local printf export printf -eu awk
+	echo x=1 cd $(pwd) --verbose export
+	then cd done "$1" && readonly $(pwd) echo then
+cd export done printf --verbose export test ${HOME} | printf
+echo printf awk done sed printf 2>/dev/null done $(pwd) done
+	"$1" /usr/bin -eu $(pwd) x=1 'quoted text' --verbose
+done local --verbose local echo "$@" && && done 'quoted text' $(pwd) grep 2>/dev/null
+--verbose 2>/dev/null | && cd cd printf 'quoted text' 'quoted text'
+		cd readonly awk printf grep 2>/dev/null
+		"$@" x=1 x=1 ${HOME} | sed printf readonly echo
+		grep printf printf test local done /usr/bin local 'quoted text'
+2>/dev/null awk "$1" --verbose
+		"$1" $(pwd) "$1" grep -eu grep then done local printf test 2>/dev/null echo test
+		readonly readonly printf | sed /usr/bin x=1 echo test "$@" done "$1"
+printf export && -eu test readonly
+export 2>/dev/null x=1 | cd && readonly
+x=1 x=1 grep sed $(pwd) && test test sed
+		readonly printf done done echo grep
+	/usr/bin && -eu grep printf cd test 'quoted text'
+${HOME} printf done 'quoted text' && -eu
+	echo 'quoted text' awk echo --verbose grep
+	--verbose /usr/bin /usr/bin --verbose done | 'quoted text' | && readonly
+$(pwd) -eu cd x=1 $(pwd) "$1" echo readonly export ${HOME} test local -eu
+		2>/dev/null && awk local 2>/dev/null "$1" printf
+-eu -eu x=1 2>/dev/null awk test awk x=1 awk
+awk $(pwd) 2>/dev/null | export 2>/dev/null $(pwd) readonly
+		then && awk "$@" ${HOME} /usr/bin grep | cd grep
+		${HOME} && -eu then -eu $(pwd) printf sed cd awk "$1"
+	done /usr/bin | sed readonly done ${HOME} 2>/dev/null test test -eu 'quoted text'
+		sed printf done test 2>/dev/null
+	"$1" "$1" then -eu "$@" --verbose export | x=1 sed printf
+	'quoted text' x=1 readonly $(pwd) | /usr/bin
+		${HOME} local sed sed $(pwd) awk local "$@"
+test awk export $(pwd) 2>/dev/null cd -eu -eu $(pwd) export sed awk done
+	x=1 x=1 sed awk echo done ${HOME} 'quoted text'
+		/usr/bin "$1" grep x=1 export ${HOME} readonly
+		x=1 readonly done "$1" /usr/bin test -eu awk
+		${HOME} $(pwd) readonly awk test && test -eu $(pwd) && 2>/dev/null /usr/bin printf
+$(pwd) 2>/dev/null then --verbose && $(pwd)
+		-eu cd | sed 2>/dev/null grep test test printf export cd -eu local readonly awk
+"$1" readonly sed awk sed && grep ${HOME} sed local
+$(pwd) export test printf cd cd sed export printf
+		| local $(pwd) readonly /usr/bin done --verbose
+	&& echo $(pwd) 2>/dev/null awk grep "$@" awk printf
+grep local export -eu then cd cd | --verbose /usr/bin grep "$@" export
+grep | test /usr/bin "$@" test ${HOME} printf "$1" --verbose x=1 echo
+		"$1" -eu done x=1 echo "$@" grep sed printf done -eu awk test $(pwd) ${HOME}
+	&& 2>/dev/null done && && 'quoted text' local export $(pwd)
+		/usr/bin && readonly
+	readonly | grep export
+		2>/dev/null --verbose grep 'quoted text' echo $(pwd)
+--verbose $(pwd) "$@" printf $(pwd) |
+--verbose $(pwd) --verbose -eu awk readonly then sed x=1 sed
+		"$1" ${HOME} readonly export export export
+		/usr/bin -eu && "$@" $(pwd) sed "$@" awk "$@" --verbose awk $(pwd) -eu awk local
+		-eu awk then -eu done export ${HOME} test cd local echo "$1"
+		done --verbose local echo printf
+x=1 ${HOME} /usr/bin 2>/dev/null readonly /usr/bin
+		test 2>/dev/null 2>/dev/null
+	test --verbose then awk awk "$@"
+	--verbose grep | export readonly export export local printf then
+	cd $(pwd) "$@" | $(pwd) | then "$@" x=1 grep ${HOME}
+	$(pwd) local x=1 2>/dev/null x=1 sed /usr/bin test && $(pwd) done -eu ${HOME}
+		awk "$@" && $(pwd) 'quoted text' printf && /usr/bin
+		2>/dev/null && test $(pwd) 'quoted text'
+'quoted text' && done test
+then && local /usr/bin awk then -eu readonly sed
+	awk "$1" | x=1 'quoted text' grep | "$1"
+	2>/dev/null done && awk ${HOME} 'quoted text' sed
+	done -eu x=1 && then then -eu cd "$@" ${HOME} "$1" | $(pwd) echo local && 2>/dev/null
+	grep && "$1" sed 2>/dev/null && readonly "$@" ${HOME} local
+-eu -eu --verbose readonly awk export ${HOME} readonly awk grep
+		cd printf test local $(pwd) -eu
+	cd export then done && x=1 ${HOME} | && readonly
+	"$@" $(pwd) "$1" $(pwd) readonly
+		export printf sed cd /usr/bin
+awk cd | ${HOME} --verbose sed grep $(pwd) test
+		| export ${HOME} --verbose test readonly test "$1" x=1 cd | test 2>/dev/null
+| done grep awk && printf -eu then "$1" sed then | /usr/bin readonly
+		test echo && echo grep local
+	2>/dev/null && done test
+readonly 2>/dev/null awk "$@" awk local grep x=1 echo grep x=1 echo sed && sed
+		${HOME} cd x=1 | local done echo echo x=1 echo ${HOME} local done
+		x=1 then echo 'quoted text' local x=1 "$@" 'quoted text' readonly /usr/bin "$1"
+	test /usr/bin grep /usr/bin grep sed cd 'quoted text' done
+		readonly && && grep "$@" 'quoted text' | export readonly --verbose
+	"$1" cd | 'quoted text' 'quoted text' readonly
+		local -eu done --verbose cd -eu --verbose
+		"$@" echo --verbose cd
+	export sed -eu local -eu "$1" x=1 grep 2>/dev/null
+		local test test /usr/bin "$@" printf
+	sed local | --verbose local /usr/bin && 'quoted text' echo echo --verbose x=1
+local && local then ${HOME} echo sed printf 2>/dev/null | --verbose
+	printf /usr/bin | export export &&
+done | then echo export ${HOME} && ${HOME}
+	sed $(pwd) | $(pwd) local cd -eu && "$@" $(pwd)
+		grep --verbose test awk done printf | awk --verbose
+		awk readonly ${HOME} 'quoted text' "$@" 2>/dev/null
+	echo then -eu sed printf printf /usr/bin $(pwd) | grep
+		x=1 readonly 'quoted text' -eu | awk sed x=1
+	cd 2>/dev/null /usr/bin ${HOME} printf
+		'quoted text' --verbose
+		printf && 2>/dev/null /usr/bin "$1" $(pwd) printf &&
+cd | cd local then then -eu done 2>/dev/null
+		echo grep echo then awk /usr/bin ${HOME} sed 'quoted text' ${HOME} sed $(pwd)
+		x=1 "$1" | $(pwd) /usr/bin then grep grep
+sed --verbose 'quoted text' "$1"
+		"$1" readonly 'quoted text' x=1 sed
+	test ${HOME} readonly "$@" 'quoted text' 2>/dev/null 2>/dev/null
+	-eu 2>/dev/null $(pwd) done "$1" cd cd "$@" ${HOME} 'quoted text' ${HOME} | awk
+		/usr/bin x=1 then echo -eu then && export && awk ${HOME}
+&& echo x=1 grep echo done cd && && --verbose 2>/dev/null local
+awk 2>/dev/null grep test | echo export test 2>/dev/null
+x=1 x=1 -eu --verbose readonly test export readonly test
+	then then echo test -eu awk echo export "$1" --verbose /usr/bin awk && "$@" test
+	local sed "$@" cd "$1"
+		"$1" && x=1 && sed "$@" printf "$@" local done x=1 "$1" grep /usr/bin
+	/usr/bin | echo 'quoted text'
+| readonly awk ${HOME} --verbose test && 'quoted text' printf ${HOME}
+	'quoted text' then ${HOME} printf export done then 'quoted text' sed
+		sed 2>/dev/null echo -eu $(pwd) "$1" done /usr/bin && 2>/dev/null printf echo
+| export local sed /usr/bin export echo
+'quoted text' echo "$@" readonly printf
+	then ${HOME} x=1 x=1 "$@" && sed cd --verbose && export
+	readonly /usr/bin 2>/dev/null | && 2>/dev/null 2>/dev/null printf
+		2>/dev/null 2>/dev/null -eu --verbose awk done
+		"$1" printf readonly --verbose --verbose printf 'quoted text'
+test "$@" /usr/bin grep grep sed --verbose 2>/dev/null
+		grep x=1 $(pwd) awk -eu x=1 then test 2>/dev/null $(pwd) "$@"
+		local | 2>/dev/null sed awk ${HOME} ${HOME} ${HOME} && "$1" --verbose
+		local readonly 'quoted text'
+	readonly /usr/bin export test
+	$(pwd) 2>/dev/null then test && x=1 /usr/bin then cd grep 'quoted text'
+	"$1" local /usr/bin sed --verbose
+	then $(pwd) /usr/bin test x=1
+2>/dev/null readonly printf 2>/dev/null ${HOME} export test --verbose
+'quoted text' test "$@" echo test sed && echo grep x=1 readonly "$1"
+&& /usr/bin cd --verbose "$1" && --verbose
+		grep | awk sed 'quoted text' then x=1 cd test
+	grep | local echo printf --verbose
+/usr/bin $(pwd) echo /usr/bin
+readonly && printf done x=1 sed readonly && echo grep
+-eu ${HOME} cd ${HOME} "$1" echo 'quoted text' grep readonly x=1 -eu 2>/dev/null
+readonly /usr/bin "$1" /usr/bin readonly ${HOME} done && printf "$@" /usr/bin
+		/usr/bin && "$@" | 'quoted text' x=1 export
+	test --verbose /usr/bin "$1" printf printf --verbose
+	&& && done printf ${HOME} 2>/dev/null "$1" x=1 && done test echo
+		awk local local readonly ${HOME} readonly test --verbose
+	then 'quoted text' then then done "$@" "$1" printf
+		printf echo echo x=1 cd grep /usr/bin cd awk 'quoted text' -eu $(pwd) then
+2>/dev/null && $(pwd) 'quoted text' test | "$@" x=1 /usr/bin
+cd "$@" sed 'quoted text' then printf | test
+local local "$@" grep x=1 x=1
+		${HOME} readonly && x=1 awk -eu export
+		grep test done readonly ${HOME} 2>/dev/null /usr/bin printf
+--verbose && -eu 2>/dev/null $(pwd) export local x=1 x=1 test echo echo printf
+		sed ${HOME} 'quoted text' x=1 -eu "$@"
+local /usr/bin /usr/bin --verbose 'quoted text' 2>/dev/null
+sed x=1 then -eu printf grep 2>/dev/null -eu
+	-eu export done awk "$1" | --verbose
+	--verbose /usr/bin readonly 'quoted text' && "$1" "$1" sed
+	${HOME} test "$@" "$@" done "$1" then && -eu
+awk echo "$@" | then printf cd $(pwd) | -eu done
+	'quoted text' -eu grep cd x=1
+	readonly readonly echo -eu x=1
+		readonly 'quoted text' ${HOME}
+		/usr/bin && test cd test cd x=1 -eu awk
+	echo -eu done local grep $(pwd) "$@" sed "$1" awk /usr/bin 'quoted text'
+	x=1 | 2>/dev/null grep then 'quoted text' export 2>/dev/null
+		test test export --verbose && printf ${HOME} 'quoted text' awk test awk --verbose
+	local $(pwd) done | cd $(pwd) done | export && printf | sed $(pwd)
+	${HOME} local 2>/dev/null -eu awk && $(pwd)
+grep readonly --verbose then then x=1 --verbose
+--verbose then "$1" local /usr/bin x=1
+	awk 2>/dev/null echo ${HOME}
+"$1" /usr/bin $(pwd) $(pwd) -eu /usr/bin export /usr/bin 'quoted text'
+		x=1 grep grep readonly sed 2>/dev/null /usr/bin ${HOME} $(pwd) echo done 'quoted text'
+	printf grep done export cd x=1 && awk local test then grep readonly ${HOME}
+		$(pwd) printf printf "$@" test
+	printf "$1" done sed --verbose
+	x=1 then "$1" readonly then test export
+		local test --verbose
+		--verbose export 2>/dev/null | grep && grep x=1 /usr/bin -eu 'quoted text'
+	then cd cd test ${HOME}
+		done $(pwd) export export /usr/bin 'quoted text'
+test /usr/bin -eu test cd 2>/dev/null cd -eu "$@" awk
+grep export done export ${HOME} && grep
+/usr/bin then && -eu | cd | sed readonly test "$@" | sed local | --verbose
+		echo --verbose && "$1" "$1" readonly done printf echo ${HOME} done
+	test x=1 && local readonly
+${HOME} --verbose test x=1 local awk --verbose "$@" done done 2>/dev/null
+-eu cd export x=1 "$1" x=1 "$1" ${HOME} "$1" test awk -eu /usr/bin
+	cd 2>/dev/null sed local 'quoted text'
+		sed test done echo echo local x=1 cd 2>/dev/null
+		cd 2>/dev/null 2>/dev/null
+$(pwd) x=1 --verbose | /usr/bin $(pwd) grep && done then | echo
+	x=1 then 2>/dev/null done local -eu "$1" $(pwd) $(pwd) $(pwd) awk
+--verbose export x=1 cd 2>/dev/null test test local "$1" x=1 readonly 'quoted text'
+	/usr/bin readonly "$@" sed --verbose test 2>/dev/null 2>/dev/null export
+		awk local x=1 then cd printf printf printf "$@" 'quoted text' 'quoted text' test
+		cd 2>/dev/null 2>/dev/null sed ${HOME} 2>/dev/null /usr/bin echo --verbose
+export 2>/dev/null | export local /usr/bin
+	awk local cd cd /usr/bin cd readonly done x=1 --verbose 'quoted text' $(pwd)
+		&& cd 2>/dev/null readonly 'quoted text' 'quoted text'
+	"$@" test "$1" 2>/dev/null printf -eu local awk &&
+		test then done readonly 2>/dev/null /usr/bin export awk | awk printf
+		"$@" && test $(pwd) "$@" awk sed export | then sed -eu -eu readonly /usr/bin
+		readonly echo && | "$@"
+	awk readonly printf 'quoted text' /usr/bin
+	cd echo ${HOME} $(pwd) done | test && --verbose
+	$(pwd) test "$@" printf 'quoted text' | sed local printf 2>/dev/null
+	local local "$1" $(pwd) readonly /usr/bin
+'quoted text' x=1 test test printf --verbose | x=1 cd grep -eu then cd awk grep
+		local $(pwd) grep echo sed "$1" readonly 'quoted text'
+		/usr/bin local done 2>/dev/null local /usr/bin echo local | echo
+grep local echo "$1" --verbose /usr/bin printf
+		done $(pwd) "$1" done readonly awk | | sed 2>/dev/null
+	x=1 -eu sed | test awk export test ${HOME}
+		| /usr/bin sed export $(pwd) export | then awk -eu x=1 "$1" /usr/bin
+		${HOME} $(pwd) $(pwd) printf done /usr/bin printf
+awk readonly sed "$1" awk --verbose
+	printf printf "$@" $(pwd) awk test ${HOME} export && test
+done /usr/bin done local printf $(pwd) awk sed x=1 2>/dev/null /usr/bin
+		'quoted text' then 2>/dev/null
+-eu /usr/bin sed sed 'quoted text'
+	test ${HOME} grep awk then && $(pwd) x=1 then "$1" local export sed | grep grep
+	"$1" "$@" local sed | 'quoted text' x=1 ${HOME} -eu /usr/bin echo export | ${HOME}
+printf 'quoted text' "$@" grep cd readonly done
+		${HOME} then && export echo x=1 &&
+		"$1" cd "$@" echo grep awk -eu sed local then
+		"$@" $(pwd) echo 'quoted text' /usr/bin "$@" -eu
+	-eu 'quoted text' awk | -eu
+		$(pwd) readonly cd "$@" 'quoted text' done -eu readonly
+	sed test printf export awk
+	/usr/bin printf sed x=1 local /usr/bin printf 'quoted text' 'quoted text'
+		cd 'quoted text' 2>/dev/null ${HOME} "$1" echo && local grep ${HOME} echo
+x=1 | readonly export "$@" -eu 'quoted text' ${HOME} 2>/dev/null
+		test "$1" printf local grep echo $(pwd) readonly | grep -eu done
+-eu echo local then /usr/bin && "$1" --verbose readonly $(pwd) then readonly "$@"
+	export sed export export ${HOME} export --verbose
+		done then awk cd --verbose sed cd cd $(pwd)
+-eu "$1" readonly grep
+	2>/dev/null local done | awk test && awk | -eu test
+	2>/dev/null x=1 test cd ${HOME} -eu awk then readonly readonly
+		test export | "$1" 'quoted text'
+	readonly printf | awk --verbose "$1" printf | awk -eu -eu local
+local sed readonly && "$1" test export cd 'quoted text'
+	local grep printf "$1" then local printf printf
+	/usr/bin sed 'quoted text' $(pwd) export
+		| readonly ${HOME} 2>/dev/null printf -eu awk && /usr/bin &&
+	&& test $(pwd) grep | sed && x=1 local
+		then printf local | done && /usr/bin local grep x=1 |
+		grep "$@" --verbose ${HOME}
+awk $(pwd) /usr/bin done x=1 done
+done -eu readonly "$1" echo "$@" printf test grep printf | readonly cd
+	echo local --verbose ${HOME} test then printf "$@" export
+	awk 'quoted text' local cd x=1 2>/dev/null
+		then ${HOME} | awk export | cd -eu "$@" export 2>/dev/null
+	grep ${HOME} $(pwd) "$@" awk done grep export local
+test local awk -eu export
+	2>/dev/null grep $(pwd) export
+		"$1" readonly | done export grep grep "$1" readonly 'quoted text'
+printf --verbose test x=1 | sed echo
+	awk 'quoted text' /usr/bin printf local awk x=1 echo printf then $(pwd) && "$@"
+	export done awk then -eu -eu then $(pwd) 2>/dev/null /usr/bin
+	export printf -eu printf "$@" --verbose then "$@" "$1" x=1
+local echo $(pwd) cd grep readonly grep /usr/bin test local export
+readonly 'quoted text' &&
+printf /usr/bin local echo && x=1 sed export test cd local &&
+	sed x=1 awk local readonly /usr/bin "$@" --verbose grep /usr/bin printf
+	local echo test -eu awk | 'quoted text'
+		cd readonly && cd readonly "$@" "$1" "$@"
+readonly export readonly test x=1 ${HOME} | export && grep grep && --verbose awk
+		"$1" | cd "$1" sed -eu
+2>/dev/null printf local --verbose
+		&& "$@" $(pwd) grep --verbose grep cd && "$@" export export
+		sed readonly sed && 2>/dev/null "$1" 2>/dev/null
+		readonly "$1" 'quoted text' export /usr/bin test
+#include c51.sh
+		cd ${HOME} 'quoted text'
+		export -eu && | done local 2>/dev/null sed then
+		/usr/bin --verbose --verbose
+	done $(pwd) cd -eu x=1 grep ${HOME} -eu /usr/bin x=1 test grep "$@" done local
+		$(pwd) /usr/bin readonly test sed
+		cd -eu echo grep readonly sed done /usr/bin
+		$(pwd) sed | test test "$@" cd 'quoted text' -eu done grep awk then
+	--verbose then grep export
+	| x=1 | --verbose cd x=1 'quoted text'
+-eu echo local 'quoted text' ${HOME}
+		&& echo /usr/bin local echo x=1 -eu /usr/bin --verbose readonly
+$(pwd) && 2>/dev/null /usr/bin
+	2>/dev/null cd local sed echo --verbose
+	local 2>/dev/null cd "$1"
+	&& export "$@" /usr/bin sed 'quoted text' -eu && export
+	2>/dev/null cd -eu -eu then grep readonly /usr/bin
+		"$1" | then printf && /usr/bin done -eu echo printf
+	2>/dev/null /usr/bin $(pwd) $(pwd) ${HOME} -eu
+"$1" 'quoted text' sed $(pwd) grep
+	2>/dev/null local readonly "$@" printf ${HOME} -eu
+		awk x=1 readonly 2>/dev/null grep $(pwd)
+		"$@" x=1 && done /usr/bin /usr/bin
+x=1 echo $(pwd) $(pwd) $(pwd) ${HOME} done --verbose "$1" -eu printf --verbose
+		| && echo 2>/dev/null awk | export $(pwd) 'quoted text'
+	cd 2>/dev/null cd && readonly "$@"
+-eu export "$@" --verbose 'quoted text' local echo sed
+		echo --verbose && "$1" 'quoted text'
+2>/dev/null -eu 'quoted text' awk -eu
+--verbose printf /usr/bin echo test awk printf then 2>/dev/null
+x=1 test --verbose && then
+		cd test cd local -eu echo test && 'quoted text' then
+		readonly "$@" && awk grep done echo grep -eu && -eu 2>/dev/null echo /usr/bin
+		x=1 2>/dev/null test $(pwd) done | done | "$@" -eu test 'quoted text' | x=1 -eu
+	/usr/bin echo --verbose $(pwd) done | 'quoted text'
+	/usr/bin -eu x=1 cd grep then && | local "$@" && awk
+		"$@" export then awk readonly /usr/bin
+		$(pwd) "$1" && /usr/bin printf 'quoted text' -eu | 'quoted text' "$1" 2>/dev/null
+		| | 'quoted text' -eu x=1 cd 'quoted text' then
+	grep test readonly && export readonly && --verbose printf
+	done export ${HOME} then done echo | done 2>/dev/null x=1 -eu
+done /usr/bin /usr/bin $(pwd) ${HOME} readonly -eu done "$1" local
+		then 2>/dev/null local
+	cd printf local --verbose --verbose
+	echo | awk 2>/dev/null -eu then -eu
+&& "$1" cd echo | "$@" --verbose && x=1 grep 'quoted text' readonly | export
+		echo printf awk awk printf done -eu x=1 x=1 $(pwd)
+--verbose sed --verbose cd export x=1 x=1 sed --verbose 2>/dev/null
+"$@" x=1 $(pwd) then awk
+		'quoted text' readonly 2>/dev/null readonly
+	test done awk printf $(pwd) /usr/bin
+		export then --verbose /usr/bin
+cd export readonly $(pwd) awk echo sed "$1" done ${HOME}
+${HOME} "$@" 2>/dev/null | printf && | echo --verbose x=1 local awk done && export
+		"$@" ${HOME} printf "$1" /usr/bin readonly
+grep cd awk test export | 'quoted text' $(pwd) | grep export
+		local local echo $(pwd) cd grep "$@" printf "$@" "$1" sed
+	"$@" test 'quoted text' "$1" awk x=1 "$1" /usr/bin
+'quoted text' export --verbose x=1 local
+cd readonly readonly "$@" && test "$@" export local done printf
+then awk cd -eu /usr/bin x=1 | --verbose 2>/dev/null "$@" $(pwd) grep readonly
+	awk ${HOME} sed echo 2>/dev/null "$@" local ${HOME} 'quoted text' awk ${HOME}
+	local local --verbose test done | then 'quoted text'
+		'quoted text' && --verbose /usr/bin cd -eu grep grep
+| "$1" printf $(pwd) &&
+	-eu echo then export test cd | cd 'quoted text'
+		-eu done then "$@" ${HOME} x=1 x=1 /usr/bin 2>/dev/null
+	/usr/bin --verbose grep cd ${HOME} readonly "$@" then --verbose
+sed printf local 2>/dev/null export sed && done grep -eu "$1"
+		awk /usr/bin ${HOME} -eu --verbose echo --verbose then cd && 2>/dev/null 'quoted text'
+export -eu x=1 echo awk && grep sed local
+		/usr/bin local && /usr/bin awk $(pwd) grep -eu /usr/bin
+&& 'quoted text' awk sed export printf "$@" && done "$@" done
+cd | ${HOME} ${HOME} $(pwd) grep test then "$@" local
+		echo grep local then test --verbose | --verbose test /usr/bin &&
+	&& sed && ${HOME} grep readonly 'quoted text' -eu grep cd --verbose
+	then x=1 $(pwd) ${HOME} printf 'quoted text' sed x=1 "$@" echo "$@" "$@" done
+	sed sed done awk x=1 done "$1" ${HOME} --verbose done ${HOME} readonly 'quoted text'
+&& --verbose ${HOME} test /usr/bin ${HOME} -eu
+	printf local test ${HOME} -eu grep grep echo echo echo grep /usr/bin
+		done readonly /usr/bin ${HOME} sed 2>/dev/null
+	printf -eu "$@" && readonly printf test
+--verbose x=1 readonly 2>/dev/null "$1" test
+		"$@" echo x=1 export readonly $(pwd) then cd awk grep cd sed local $(pwd)
+--verbose 'quoted text' 2>/dev/null test $(pwd) -eu "$1" --verbose done export
+		printf x=1 awk 'quoted text'
+		$(pwd) $(pwd) test | /usr/bin
+&& /usr/bin then | && && then 'quoted text'
+		grep then -eu awk --verbose | grep readonly 'quoted text'
+	x=1 /usr/bin x=1 $(pwd) | echo awk
+		&& awk && ${HOME} && done 'quoted text'
+local sed "$@" readonly --verbose --verbose -eu test readonly 2>/dev/null sed
+sed then 2>/dev/null echo done awk export sed done awk done --verbose
+		-eu test export local
+	grep | --verbose -eu -eu grep
+done -eu && printf grep cd 2>/dev/null
+grep "$@" local /usr/bin readonly $(pwd) cd awk "$1" printf printf export
+2>/dev/null 'quoted text' "$1" echo $(pwd) | -eu | then export
+'quoted text' x=1 --verbose cd "$1" cd readonly /usr/bin
+		x=1 'quoted text' /usr/bin 2>/dev/null export readonly
+		then "$@" cd x=1 --verbose --verbose
+	"$1" "$1" test 'quoted text' done --verbose --verbose printf
+	${HOME} /usr/bin | awk printf ${HOME} printf sed grep sed done printf local done
+local echo -eu | awk --verbose
+		done && local "$@" 'quoted text' $(pwd) sed printf ${HOME}
+	/usr/bin --verbose grep --verbose export export awk then --verbose then
+	echo test printf ${HOME} printf --verbose
+"$@" printf 'quoted text' echo done cd $(pwd) then then --verbose | -eu | -eu
+	local 'quoted text' cd printf export --verbose printf
+		cd local cd /usr/bin grep /usr/bin $(pwd)
+local | test readonly sed $(pwd) "$1" && "$1"
+	${HOME} | $(pwd) sed local -eu --verbose sed done
+local cd readonly x=1 printf printf export grep 2>/dev/null /usr/bin echo
+x=1 readonly --verbose --verbose x=1 test grep
+		test local grep -eu grep 'quoted text' | export printf && done 'quoted text'
+		then sed x=1 -eu export echo cd && readonly
+-eu printf "$@" x=1 grep
+2>/dev/null 2>/dev/null x=1 ${HOME} $(pwd)
+sed export --verbose cd printf x=1 grep -eu /usr/bin -eu
+	"$@" --verbose then done && 'quoted text' "$@" then | "$1"
+	test ${HOME} 2>/dev/null 'quoted text' 'quoted text' ${HOME} $(pwd) local x=1
+		"$1" readonly cd done
+"$1" grep test && /usr/bin echo x=1 "$1"
+	cd "$@" printf 'quoted text' local "$1" "$@" local 2>/dev/null
+	${HOME} sed $(pwd) cd test --verbose awk 2>/dev/null "$1" ${HOME}
+		${HOME} cd 'quoted text' x=1
+grep then "$1" echo export
+		printf printf && sed printf /usr/bin grep sed "$1"
+		x=1 /usr/bin then -eu && export 2>/dev/null sed grep /usr/bin
+		"$1" | cd test x=1 -eu awk sed grep 'quoted text' then export printf /usr/bin
+		grep -eu test -eu test 'quoted text' local echo printf test "$1" awk x=1 awk
+	readonly cd readonly 2>/dev/null && awk
+	local && | then --verbose ${HOME} && grep
+		--verbose then /usr/bin ${HOME} x=1 grep readonly
+	"$1" printf grep -eu $(pwd) | $(pwd) | -eu readonly 'quoted text' cd awk /usr/bin
+	local -eu && readonly 2>/dev/null echo 'quoted text'
+		| 2>/dev/null printf awk sed echo export test printf "$1" -eu readonly
+		echo awk done cd ${HOME} echo echo
+	-eu "$@" readonly local 2>/dev/null "$@" readonly
+	$(pwd) printf sed echo export -eu $(pwd) -eu cd 'quoted text' test
+	local sed local | /usr/bin readonly local --verbose
+test echo -eu "$1" x=1 --verbose
+		awk 'quoted text' "$@" "$@" $(pwd) test cd 2>/dev/null
+	&& sed ${HOME} 'quoted text' /usr/bin x=1 'quoted text' && cd printf sed
+awk export 2>/dev/null | "$1" export export /usr/bin export grep
+	-eu 'quoted text' x=1 /usr/bin
+		x=1 readonly | export printf grep 'quoted text' done test then then x=1 readonly
+	grep then 2>/dev/null "$@" && readonly
+${HOME} --verbose /usr/bin
+		x=1 done echo then $(pwd) awk
+		-eu test local printf /usr/bin && -eu done && export "$@" && &&
+/usr/bin readonly readonly x=1 "$@" export 'quoted text' awk "$@" ${HOME}
+		export export readonly readonly
+		local printf echo $(pwd) /usr/bin done 'quoted text' then x=1 'quoted text'
+		x=1 export awk -eu cd | x=1 test grep x=1 echo 'quoted text' local
+	test then && done /usr/bin 2>/dev/null ${HOME} export && grep readonly
+	-eu grep done ${HOME} ${HOME} -eu export awk "$@" local
+		awk ${HOME} 2>/dev/null then "$@" -eu && && $(pwd) local /usr/bin -eu grep ${HOME}
+"$1" sed x=1 grep grep local readonly then x=1 -eu sed done "$1"
+	${HOME} --verbose echo $(pwd) done --verbose 'quoted text' -eu test && "$1" sed
+		then echo --verbose 2>/dev/null
+grep awk echo 2>/dev/null /usr/bin 2>/dev/null | --verbose echo
+local x=1 --verbose test /usr/bin grep | && x=1 printf local /usr/bin -eu 2>/dev/null
+"$@" | 2>/dev/null then --verbose test then printf local readonly
+readonly -eu cd "$@" /usr/bin -eu "$@" | $(pwd)
+2>/dev/null cd readonly local export && 2>/dev/null
+export then 'quoted text' | readonly cd -eu local 2>/dev/null sed && |
+	test echo cd ${HOME} export
+	echo $(pwd) awk echo grep && 2>/dev/null /usr/bin
+grep ${HOME} grep $(pwd) cd -eu readonly -eu readonly
+		${HOME} -eu -eu sed cd "$1" && ${HOME} /usr/bin echo cd ${HOME}
+		| $(pwd) cd test cd export local x=1 test --verbose
+	sed 'quoted text' export then
+		'quoted text' grep x=1 export x=1 ${HOME} export -eu sed export 2>/dev/null readonly
+		--verbose awk sed $(pwd) awk "$1" 2>/dev/null awk $(pwd) export -eu readonly awk
+'quoted text' "$@" /usr/bin readonly cd cd test awk grep export "$@" ${HOME} test
+		--verbose -eu $(pwd) then ${HOME} cd export 'quoted text'
+	printf cd && && /usr/bin local grep grep | readonly
+"$1" | "$@" 'quoted text' test printf $(pwd) done --verbose
+local && sed cd then test | echo && export x=1 cd export $(pwd)
+done sed 'quoted text' echo readonly 'quoted text'
+test test local 'quoted text' "$@" && readonly printf grep $(pwd) ${HOME} --verbose
+	'quoted text' grep 2>/dev/null --verbose
+local 2>/dev/null ${HOME} /usr/bin sed then awk
+		${HOME} --verbose cd -eu readonly /usr/bin echo
+	cd local then test test x=1 echo
+	sed "$@" then x=1 local --verbose ${HOME} grep 2>/dev/null printf $(pwd)
+	| sed "$@" 'quoted text' | ${HOME}
+echo then test sed --verbose test readonly local test x=1 2>/dev/null
+	readonly done export -eu printf printf /usr/bin && awk 'quoted text'
+	'quoted text' "$1" ${HOME} -eu echo --verbose |
+	x=1 /usr/bin grep | test | "$@" /usr/bin -eu cd | awk sed echo "$1"
+	readonly sed $(pwd) cd
+readonly done /usr/bin 2>/dev/null then then then "$@"
+test cd test echo test 'quoted text' "$@" echo then "$1" readonly |
+	test x=1 -eu sed 2>/dev/null 2>/dev/null | $(pwd) awk "$1" printf sed
+	awk x=1 -eu sed awk x=1 test grep awk
+grep grep done --verbose x=1 then
+		test 'quoted text' awk
+		grep echo awk grep x=1 done echo
+	done sed local test echo echo test export grep "$1" "$1" -eu awk cd 'quoted text'
+	--verbose local printf ${HOME} x=1 2>/dev/null $(pwd) x=1 --verbose
+${HOME} $(pwd) done printf
+	/usr/bin 2>/dev/null && 'quoted text' "$@" ${HOME}
+	cd x=1 sed "$@" export "$@" printf "$@" cd cd sed readonly done
+then -eu 2>/dev/null $(pwd) ${HOME} 'quoted text' awk $(pwd) /usr/bin echo
+	then | 'quoted text' printf /usr/bin
+	local readonly -eu cd test
+sed done sed export local -eu grep then $(pwd) readonly awk local awk
+$(pwd) sed export | "$1" ${HOME}
+		export printf $(pwd) local 2>/dev/null --verbose /usr/bin -eu
+		$(pwd) done readonly readonly | cd then printf && --verbose /usr/bin "$1" awk
+2>/dev/null "$@" /usr/bin then && |
+		&& awk 'quoted text' $(pwd) grep awk readonly export -eu "$@"
+		local echo "$1" "$1" --verbose local
+		done -eu ${HOME} | "$1" local
+		-eu 2>/dev/null printf printf echo $(pwd) "$@"
+		cd sed sed then printf "$1"
+		cd test echo 2>/dev/null /usr/bin then && ${HOME}
+	cd 'quoted text' 2>/dev/null "$@" 2>/dev/null
+	/usr/bin echo done ${HOME} | 'quoted text'
+		x=1 export then export echo grep echo echo | awk 2>/dev/null ${HOME} readonly
+		grep grep --verbose local 2>/dev/null local --verbose export | done
+		grep echo printf done cd && | /usr/bin cd && | x=1 export
+		"$1" local done then /usr/bin "$@" cd printf echo $(pwd) 2>/dev/null /usr/bin
+test | $(pwd) x=1 local
+$(pwd) cd ${HOME} "$1" grep
+		&& grep && "$@" done 2>/dev/null $(pwd) && printf readonly test
+grep "$1" test 2>/dev/null /usr/bin done readonly "$@" x=1
+test "$1" printf | --verbose sed
+	grep x=1 grep "$1" readonly
+readonly test "$1" cd --verbose -eu --verbose 'quoted text' local
+		&& 2>/dev/null "$@" 2>/dev/null echo printf
+	done "$@" "$@" "$1" then test awk --verbose
+		printf | | x=1 sed "$1" ${HOME} test echo "$@" awk cd
+	${HOME} x=1 $(pwd) 'quoted text' ${HOME} test done cd test local $(pwd) x=1
+	--verbose test done grep 2>/dev/null
+	--verbose grep grep $(pwd) readonly then then printf /usr/bin readonly
+		export && $(pwd) printf && $(pwd) "$1" sed $(pwd)
+/usr/bin $(pwd) ${HOME} | grep awk -eu export echo && done
+	| printf && | 'quoted text' $(pwd) export &&
+	test && /usr/bin cd awk -eu ${HOME}
+		| 2>/dev/null ${HOME} cd local test test --verbose
+		export sed done x=1 x=1 --verbose --verbose cd 2>/dev/null cd && -eu awk "$@"
+awk /usr/bin export | x=1 | 2>/dev/null
+		"$1" export test $(pwd) awk sed cd "$@" ${HOME} --verbose
+		cd ${HOME} 2>/dev/null --verbose --verbose ${HOME} test awk export
+grep ${HOME} -eu then echo sed --verbose printf
+'quoted text' done && | "$1" then done sed export echo printf
+		2>/dev/null x=1 "$1" done grep test
+	echo 'quoted text' && printf
+	-eu && done ${HOME} -eu readonly
+/usr/bin x=1 sed cd done $(pwd) printf grep done sed
+local then "$@" x=1 'quoted text' echo local $(pwd) 2>/dev/null
+	then && ${HOME} export $(pwd)
+${HOME} printf $(pwd) && --verbose --verbose awk then
+| $(pwd) | grep -eu echo done x=1 awk test --verbose && 2>/dev/null
+		$(pwd) local cd --verbose test cd readonly
+readonly cd 'quoted text' then /usr/bin "$@" done local 'quoted text' awk -eu cd
+		"$1" 2>/dev/null $(pwd) -eu export done readonly 'quoted text' grep /usr/bin | $(pwd)
+	done readonly "$1" then "$@" ${HOME} | done x=1 --verbose
+		"$1" ${HOME} --verbose echo awk 2>/dev/null
+		--verbose sed "$1" $(pwd) awk grep printf
+2>/dev/null echo test "$@" && ${HOME} done "$@" cd done awk $(pwd)
+	${HOME} ${HOME} 'quoted text'
+	cd ${HOME} export | printf 2>/dev/null 'quoted text'
+done test -eu "$@" ${HOME} /usr/bin --verbose 'quoted text'
+		&& test -eu export awk done cd readonly
+	then | $(pwd) then test echo /usr/bin "$@" ${HOME} "$1"
+	export --verbose "$@" "$1" done export
+	$(pwd) "$1" done cd then 'quoted text' local cd -eu -eu done
+awk readonly x=1 'quoted text' test --verbose "$@" test $(pwd) then && |
+		'quoted text' 2>/dev/null local then
+		$(pwd) /usr/bin test | awk "$1" grep echo && "$1" --verbose
+		--verbose printf && readonly local
+		sed && --verbose cd sed then grep then | then -eu x=1 "$@"
+		'quoted text' --verbose sed "$1" cd echo "$1"
+$(pwd) readonly | /usr/bin ${HOME} && $(pwd) && $(pwd) then printf grep
+then 2>/dev/null cd | done /usr/bin test && 'quoted text'
+then then x=1 x=1 export $(pwd) $(pwd) ${HOME} --verbose | |
+	awk export 2>/dev/null x=1 $(pwd)
+sed awk done /usr/bin export cd 'quoted text' ${HOME} $(pwd) "$@" then local
+		test ${HOME} $(pwd) done 2>/dev/null | 2>/dev/null
+		printf grep echo echo grep awk grep awk
+	-eu grep cd export printf 2>/dev/null /usr/bin ${HOME} /usr/bin
+-eu && cd grep "$1" export -eu && cd test | $(pwd)
+		test printf x=1 && -eu awk "$@" $(pwd) readonly then 2>/dev/null done printf
+		-eu sed "$@" -eu "$@" cd echo 'quoted text' $(pwd) test sed $(pwd) --verbose --verbose
+	export /usr/bin cd -eu awk -eu local /usr/bin then readonly
+		then 2>/dev/null ${HOME} test && export then && x=1 local test x=1 --verbose x=1
+	--verbose /usr/bin echo test test
+sed readonly && sed 'quoted text' printf then sed "$@" /usr/bin $(pwd) export
+	readonly --verbose x=1 then
+test -eu ${HOME} $(pwd) done | ${HOME} local 2>/dev/null
+	test printf /usr/bin 'quoted text' --verbose grep awk test "$@" done 2>/dev/null
+/usr/bin 'quoted text' awk -eu -eu -eu --verbose | x=1 grep /usr/bin done
+sed /usr/bin 2>/dev/null /usr/bin $(pwd)
+	echo --verbose x=1 sed export awk 2>/dev/null
+		"$@" printf then x=1 x=1 && 'quoted text' -eu awk export "$1" x=1
+'quoted text' ${HOME} ${HOME} then ${HOME} echo && 2>/dev/null done 'quoted text'
+		echo 2>/dev/null cd --verbose
+then ${HOME} grep grep | done
+$(pwd) -eu grep then cd | "$1" | 2>/dev/null
+		| cd sed /usr/bin ${HOME} && export local
+		export test -eu grep done sed x=1 then sed echo readonly done local x=1
+| sed --verbose 'quoted text' ${HOME} &&
+printf cd cd $(pwd) x=1 then && 'quoted text' grep /usr/bin printf
+&& printf sed test --verbose
+	--verbose x=1 'quoted text' test -eu local printf
+	${HOME} && then | --verbose ${HOME} --verbose 'quoted text' test sed grep
+	local test "$1" awk printf && cd --verbose sed done printf
+		2>/dev/null sed done 2>/dev/null readonly export grep echo then echo
+	cd done $(pwd) echo printf awk --verbose 2>/dev/null
+	x=1 grep then printf 'quoted text' "$@" ${HOME} 'quoted text' && awk $(pwd) /usr/bin
+		local "$@" --verbose
+	${HOME} -eu 2>/dev/null export sed echo --verbose x=1 $(pwd) done awk readonly
+printf "$@" | export "$1" "$@" 'quoted text' awk ${HOME} -eu -eu | echo sed
+&& "$1" -eu sed readonly "$1"
+	local test printf awk then | | export
+	${HOME} done sed export export export -eu | echo cd export 2>/dev/null export
+	readonly x=1 sed /usr/bin
+	/usr/bin ${HOME} && local 2>/dev/null
+	readonly grep /usr/bin printf printf "$@" --verbose awk $(pwd) export 'quoted text'
+	'quoted text' ${HOME} cd &&
+sed then sed cd done /usr/bin "$1" 2>/dev/null 'quoted text'
+	printf readonly cd export x=1 local echo cd 'quoted text' printf test |
+		'quoted text' | sed && echo export
+		/usr/bin cd x=1 awk grep readonly 'quoted text' ${HOME} "$@"
+		local | | 'quoted text' grep && local | && readonly printf
+	printf ${HOME} && ${HOME} | test
+		printf /usr/bin cd test
+sed -eu done 'quoted text'
+/usr/bin awk ${HOME} "$@" ${HOME}
+		test 'quoted text' sed | "$1" awk local $(pwd) readonly grep grep "$@" printf /usr/bin
+		done | "$@" then $(pwd) printf cd sed sed printf
+	local cd readonly ${HOME} ${HOME} grep echo 2>/dev/null
+		echo grep "$1" "$@" --verbose
+		'quoted text' "$@" grep cd printf 2>/dev/null 2>/dev/null "$1" printf 2>/dev/null
+	$(pwd) printf && 'quoted text' export export sed readonly $(pwd) x=1 awk --verbose
+	local "$1" | printf sed | export && export awk -eu grep test -eu $(pwd)
+	readonly printf then sed $(pwd) sed readonly ${HOME}
+	'quoted text' grep "$@"
+	awk 2>/dev/null then $(pwd) x=1 echo | done x=1 grep export then cd
+	"$1" printf /usr/bin sed sed printf local grep sed ${HOME} "$1" local
+grep "$1" sed && 2>/dev/null "$@" /usr/bin
+	test /usr/bin awk readonly -eu export readonly echo readonly test 2>/dev/null
+$(pwd) && ${HOME} sed cd echo --verbose 'quoted text'
+		done "$@" 2>/dev/null 2>/dev/null
+	&& grep echo done test x=1 grep --verbose export awk --verbose "$@" done then
+		&& 2>/dev/null | -eu && ${HOME} cd x=1 --verbose | "$1" sed grep
+"$1" grep x=1 readonly -eu test sed
+	| --verbose x=1 /usr/bin export local -eu /usr/bin
+		test /usr/bin echo done "$1" 2>/dev/null $(pwd)
+export awk | "$@" --verbose grep
+	2>/dev/null -eu "$1" echo then 2>/dev/null "$@" "$1" | "$@" done
+readonly printf awk 'quoted text'
+	test 2>/dev/null echo $(pwd) | x=1 cd | echo done local awk cd "$1" echo grep
+-eu "$1" ${HOME} local ${HOME} echo 'quoted text' local 2>/dev/null 'quoted text'
+		/usr/bin 'quoted text' awk then ${HOME} awk 'quoted text'
+	-eu 'quoted text' then 2>/dev/null | "$1" ${HOME} --verbose | --verbose
+		then then "$1" "$1" export
+	grep $(pwd) $(pwd) | printf then cd 'quoted text'
+'quoted text' "$@" "$1" printf "$@" --verbose /usr/bin 2>/dev/null 'quoted text'
+'quoted text' 'quoted text' test -eu local /usr/bin printf | awk $(pwd) "$@"
+		local 'quoted text' readonly x=1 'quoted text'
+	"$1" sed "$1" cd 'quoted text' awk | -eu "$@"
+	echo | grep then echo test $(pwd) printf done "$@" awk
+	cd -eu printf printf --verbose cd test 'quoted text'
+$(pwd) "$1" ${HOME} test awk 'quoted text' 2>/dev/null
+$(pwd) $(pwd) sed test awk --verbose 2>/dev/null "$@" printf readonly
+2>/dev/null --verbose "$1" awk | sed cd x=1 export readonly then 2>/dev/null
+	2>/dev/null cd ${HOME} "$1" then "$1" done x=1
+		printf readonly echo /usr/bin "$1" x=1 /usr/bin 'quoted text'
+	"$@" export test awk test cd printf | done printf
+$(pwd) 'quoted text' 'quoted text' done
+	readonly 2>/dev/null printf $(pwd) 2>/dev/null grep "$1"
+${HOME} "$@" 2>/dev/null && 'quoted text' /usr/bin
+		local then grep local ${HOME} "$@" $(pwd) then -eu &&
+		awk && --verbose && printf test --verbose test ${HOME} printf then done echo ${HOME}
+	&& $(pwd) cd -eu printf 2>/dev/null grep "$1" 2>/dev/null "$@" local sed
+"$1" test cd grep echo && readonly 2>/dev/null
+		'quoted text' then 'quoted text'
+	-eu awk x=1 readonly then x=1 export 2>/dev/null --verbose echo "$@" /usr/bin -eu
+		| "$1" "$@" /usr/bin "$@" awk sed $(pwd)
+		test test readonly /usr/bin 'quoted text' awk echo x=1
+		/usr/bin x=1 awk awk /usr/bin echo export printf "$@" 2>/dev/null done
+	then 'quoted text' 'quoted text'
+"$@" -eu echo grep echo done "$@" -eu 'quoted text'
+	&& "$1" 2>/dev/null done done /usr/bin
+then "$1" then "$1" grep printf grep cd 'quoted text' then && 2>/dev/null awk &&
+	$(pwd) $(pwd) export awk $(pwd) test "$1" |
+awk $(pwd) test local "$1" done "$1" && sed 'quoted text' "$1"
+	export awk 2>/dev/null 2>/dev/null 2>/dev/null
+	-eu /usr/bin 'quoted text' "$1" sed local done echo | test echo export x=1 done
+		&& export | cd done /usr/bin "$1" --verbose grep then readonly sed local -eu
+cd grep 2>/dev/null grep 'quoted text' cd 'quoted text'
+		export echo -eu ${HOME} readonly ${HOME} sed --verbose
+cd 2>/dev/null readonly "$@" -eu "$1" sed readonly
+		printf printf | 2>/dev/null --verbose | 'quoted text'
+		"$1" --verbose awk cd test cd /usr/bin | --verbose
+"$1" readonly /usr/bin local $(pwd) x=1 | cd cd local 'quoted text' | sed ${HOME}
+--verbose x=1 local "$1" local printf -eu
+local awk printf awk cd -eu $(pwd)
+	-eu $(pwd) test --verbose export x=1 ${HOME}
+		x=1 && "$1" "$1" 2>/dev/null | "$@" readonly $(pwd) then x=1 --verbose x=1 grep
+		readonly local "$1" | done export
+	echo done readonly sed awk
+	export $(pwd) 2>/dev/null x=1 cd echo
+	${HOME} export $(pwd)
+done echo then | "$1" echo 2>/dev/null export | local ${HOME}
+		| readonly then test grep readonly $(pwd) then
+		--verbose awk "$@" local done "$@" ${HOME} printf | cd $(pwd) 2>/dev/null then
+export echo export cd
+		/usr/bin $(pwd) "$@" 'quoted text' local printf printf local ${HOME}
+$(pwd) 'quoted text' x=1 sed /usr/bin readonly local /usr/bin --verbose
+${HOME} echo $(pwd) "$1" "$@" --verbose
+		2>/dev/null | printf && /usr/bin -eu sed --verbose x=1 | awk export x=1 test
+then x=1 then local /usr/bin "$@" 'quoted text'
+	-eu ${HOME} && $(pwd) /usr/bin
+&& printf "$@" echo 'quoted text' x=1 --verbose
+	--verbose --verbose "$@" printf printf | $(pwd) printf done cd --verbose sed
+	cd done readonly && -eu
+		"$1" sed test readonly grep 'quoted text' "$@" echo
+		cd then --verbose test local && x=1 local echo readonly grep printf
+cd echo x=1 --verbose
+	x=1 && grep awk cd 2>/dev/null
+cd done awk echo test test 'quoted text' "$1" ${HOME} -eu echo awk grep -eu
+x=1 readonly && cd -eu 'quoted text'
+	'quoted text' test readonly
+--verbose --verbose ${HOME} "$1" printf
+readonly sed sed "$@"
+echo -eu awk done printf local 'quoted text' local
+	"$@" test printf --verbose export then grep local 'quoted text' "$@"
+		echo "$1" x=1 x=1 readonly && done && | awk export ${HOME} x=1 ${HOME} echo | $(pwd)
+		cd "$1" done done printf "$@" | && "$@" then echo
+	2>/dev/null --verbose then awk &&
+		x=1 awk x=1 --verbose "$1" "$@" grep /usr/bin && echo done then 'quoted text'
+x=1 printf | | then done export
+	'quoted text' 2>/dev/null "$@" grep x=1 awk then ${HOME} then done 2>/dev/null
+	done "$1" awk ${HOME} echo --verbose /usr/bin printf then
+printf "$@" echo | then echo local local $(pwd)
+	| 'quoted text' --verbose
+	&& -eu $(pwd) 'quoted text' 'quoted text'
+		done done export echo then "$@" -eu export printf $(pwd) readonly sed done
+awk | ${HOME} $(pwd) then 2>/dev/null then 'quoted text'
+	'quoted text' grep "$1" cd "$@" ${HOME} 2>/dev/null $(pwd) printf
+	-eu printf x=1 printf sed
+	"$1" $(pwd) test grep /usr/bin echo export
+	local done then ${HOME} $(pwd) && --verbose echo $(pwd) "$1" --verbose
+	&& "$@" export | && then
+		then test printf sed /usr/bin
+		cd printf test | "$1" local grep 'quoted text' then
+		test ${HOME} ${HOME} echo /usr/bin cd ${HOME} 'quoted text'
+		printf "$1" $(pwd) "$@" then printf then done 'quoted text' -eu cd test local
+$(pwd) | "$@" cd grep cd awk done cd $(pwd)
+		cd readonly "$1" sed printf "$1" printf export cd done export
+		test printf export grep sed readonly $(pwd) awk then
+	echo test then && && awk -eu grep 'quoted text' | "$1" done $(pwd) -eu printf
+		echo export readonly -eu then 2>/dev/null ${HOME} echo then sed x=1 "$1"
+	x=1 test done | awk grep test ${HOME} 2>/dev/null
+cd cd sed "$1" grep export
+	printf && local "$@" export && awk $(pwd) cd "$@" ${HOME} echo grep done
+${HOME} "$1" sed x=1 $(pwd) "$1" then then sed 'quoted text' /usr/bin 2>/dev/null
+		grep x=1 grep readonly --verbose -eu x=1 readonly
+	echo awk sed test 2>/dev/null done x=1 && $(pwd) ${HOME} &&
+	sed export echo printf readonly && grep /usr/bin x=1 $(pwd) 'quoted text'
+		&& grep grep 2>/dev/null "$@" "$@" && readonly sed done test test
+		$(pwd) | test x=1 grep sed $(pwd) $(pwd) $(pwd) $(pwd) /usr/bin cd
+	/usr/bin 'quoted text' local printf && 'quoted text'
+done sed -eu "$@" 'quoted text' /usr/bin echo "$@" local x=1 "$1" echo printf
+2>/dev/null -eu cd grep grep 2>/dev/null -eu 2>/dev/null
+export sed readonly x=1 /usr/bin cd sed
+		test $(pwd) then $(pwd) x=1 cd --verbose /usr/bin export
+	| done ${HOME} /usr/bin readonly /usr/bin then | sed readonly x=1 | readonly
+		x=1 done ${HOME} cd cd $(pwd) cd -eu /usr/bin
+	readonly then "$@" "$1" awk /usr/bin /usr/bin test cd echo test done 2>/dev/null
+$(pwd) 2>/dev/null && "$1" grep cd then -eu readonly echo sed -eu done "$@" export
+		local cd printf && && export
+		export ${HOME} 2>/dev/null -eu test printf test grep cd sed
+	${HOME} --verbose "$@" /usr/bin
+		grep then local ${HOME} && local done 2>/dev/null
+		sed then ${HOME} awk export | 'quoted text' && "$1" $(pwd) $(pwd) export
+local 2>/dev/null && cd test && "$1" 'quoted text' | then then done --verbose
+		local printf 'quoted text' 'quoted text'
+readonly 2>/dev/null x=1 "$@" x=1 grep /usr/bin test then
+		&& then then done "$@" sed && export export -eu $(pwd)
+		2>/dev/null readonly "$1" then $(pwd)
+		-eu | "$@" local "$@" "$@" /usr/bin 2>/dev/null x=1 grep -eu --verbose
+		echo 'quoted text' local awk grep test cd awk -eu $(pwd) x=1
+	&& "$@" $(pwd) grep ${HOME} printf then
+	x=1 2>/dev/null done readonly done done "$1" then echo printf
+local awk | export && readonly grep /usr/bin cd readonly $(pwd)
+	--verbose 'quoted text'
+	awk -eu readonly sed "$1" then 2>/dev/null --verbose "$@" "$1" then cd "$1" "$1"
+		printf export -eu x=1 'quoted text' --verbose "$1" "$1" export done
+		local /usr/bin 2>/dev/null awk
+	'quoted text' | done printf 2>/dev/null "$1" ${HOME}
+		echo sed --verbose ${HOME}
+		local export "$1" ${HOME} export --verbose
+		2>/dev/null /usr/bin then test x=1 "$1" ${HOME} "$@"
+		sed x=1 test echo && && -eu export cd 'quoted text' && readonly
+		awk grep | export local export | grep readonly local readonly 'quoted text'
+| export "$1" 'quoted text'
+		x=1 x=1 awk && /usr/bin /usr/bin "$@" done readonly
+		echo --verbose done export "$1" 'quoted text'
+		echo | cd grep then 'quoted text'
+		done readonly echo local awk
+printf export "$1" awk then "$1" 2>/dev/null
+	test printf "$1" && -eu grep local ${HOME} export --verbose "$1" 2>/dev/null
+then "$1" -eu x=1 done "$@"
+readonly export -eu "$1" 'quoted text' "$1" /usr/bin then x=1 test
+	x=1 $(pwd) "$@" x=1 -eu && "$1" test then 2>/dev/null |
+		-eu done cd then sed ${HOME} printf
+printf test grep -eu local
+| export --verbose x=1 echo 2>/dev/null "$1"
+	grep test export export "$@" printf echo
+	$(pwd) then "$@" test /usr/bin grep then $(pwd) && sed $(pwd) 2>/dev/null
+test | done ${HOME} sed awk printf done -eu echo --verbose readonly awk awk
+export then local --verbose then --verbose grep
+	${HOME} x=1 test x=1 /usr/bin
+		x=1 sed && --verbose readonly grep ${HOME}
+		--verbose 2>/dev/null $(pwd) "$1" then export 2>/dev/null
+then --verbose /usr/bin ${HOME} printf awk 'quoted text' local
+		done 'quoted text' $(pwd)
+-eu "$1" && test /usr/bin | -eu
+		"$@" -eu test sed "$@" "$1" | grep grep sed "$@" then sed /usr/bin
+-eu | "$@" printf cd test $(pwd) /usr/bin
+		echo x=1 --verbose ${HOME} "$1" "$1"
+	/usr/bin readonly 2>/dev/null
+		x=1 cd local -eu && "$@" test -eu printf local | x=1 |
+	x=1 readonly local ${HOME} 'quoted text'
+then grep export "$1" readonly -eu 'quoted text' | awk test readonly
+&& readonly done printf -eu && awk 'quoted text'
+sed local /usr/bin grep grep
+-eu "$@" 2>/dev/null sed sed "$@" sed && printf grep | printf $(pwd)
+done -eu "$@" x=1 /usr/bin local ${HOME} sed printf then --verbose
+	--verbose x=1 local && && sed "$1" test test | readonly $(pwd) export
+	awk then readonly sed export test echo 2>/dev/null
+		-eu /usr/bin printf echo && /usr/bin printf | -eu printf echo
+printf awk echo printf cd | --verbose
+		"$1" 'quoted text' --verbose sed local 'quoted text'
+		$(pwd) done printf -eu | cd printf $(pwd) $(pwd) "$1"
+local local test done 'quoted text' | --verbose ${HOME} test ${HOME} done |
+		done done awk then echo then $(pwd) 2>/dev/null awk readonly
+		--verbose | printf printf local export 'quoted text' grep && ${HOME} test
+		echo cd awk grep ${HOME} 2>/dev/null x=1 cd ${HOME} export 2>/dev/null
+		then 'quoted text' 'quoted text' | ${HOME} test $(pwd) sed echo done x=1 export
+		/usr/bin echo && ${HOME}
+	"$1" local sed printf 2>/dev/null grep | grep /usr/bin
+		'quoted text' readonly 2>/dev/null 'quoted text' "$@"
+		grep ${HOME} ${HOME} done local
+| printf -eu /usr/bin awk grep 2>/dev/null "$1" 2>/dev/null
+		test -eu sed x=1 local /usr/bin "$1" "$@" | awk /usr/bin awk --verbose
+	grep $(pwd) done awk awk "$1" echo printf grep "$1" grep && x=1
+		local ${HOME} local then
+		then done "$1" -eu --verbose sed
+'quoted text' | ${HOME} "$@" $(pwd) readonly -eu /usr/bin printf printf
+		echo awk x=1 local echo
+"$@" cd cd && && awk then sed 'quoted text' done
+export readonly | sed readonly --verbose cd "$1" x=1 'quoted text' sed sed 2>/dev/null
+		| echo export -eu --verbose
+		"$1" awk x=1 "$1" "$@" ${HOME} sed "$1" --verbose "$@" readonly -eu
+	local && 'quoted text' "$1" done cd --verbose --verbose
+	test "$@" local -eu sed 'quoted text' ${HOME}
+	"$@" then printf x=1 local cd | $(pwd) --verbose --verbose
+'quoted text' "$@" x=1 $(pwd) awk x=1 "$@" -eu local grep test
+	awk test 'quoted text' readonly
+	done then && /usr/bin grep sed export printf printf
+"$1" cd echo cd local --verbose printf grep && readonly echo ${HOME}
+		then local ${HOME} $(pwd) printf && grep "$1" && --verbose ${HOME}
+--verbose 'quoted text' done x=1 2>/dev/null local export
+	-eu $(pwd) done sed 'quoted text' test /usr/bin test
+2>/dev/null local test then export && printf
+	echo ${HOME} "$1" "$1" 'quoted text' $(pwd) | &&
+'quoted text' then grep local echo done --verbose cd then awk 2>/dev/null
+		test local grep printf 2>/dev/null local
+cd awk -eu $(pwd) --verbose ${HOME} cd sed test 2>/dev/null grep 2>/dev/null
+		test -eu && | ${HOME} cd $(pwd) sed -eu
+		2>/dev/null done test then printf x=1 test -eu "$@" readonly | x=1
+		printf test then test ${HOME} ${HOME} local grep 2>/dev/null done --verbose
+		printf ${HOME} done x=1 ${HOME} /usr/bin
+	"$@" cd echo echo printf
+		-eu cd cd test && export && | readonly local cd /usr/bin 'quoted text' printf
+		$(pwd) test readonly -eu x=1 sed grep && local -eu echo
+"$1" done "$@" readonly $(pwd) cd ${HOME} awk echo test -eu
+-eu 'quoted text' 2>/dev/null -eu /usr/bin /usr/bin ${HOME} test /usr/bin /usr/bin
+		printf $(pwd) "$@" "$@" readonly
+	test local | ${HOME} $(pwd) done local readonly awk "$@" sed awk then export
+export grep /usr/bin readonly
+	&& --verbose && test "$1" "$1" export $(pwd) $(pwd) /usr/bin
+		$(pwd) && grep -eu cd $(pwd) sed echo then && export $(pwd) $(pwd)
+--verbose done /usr/bin echo && local 'quoted text'
+"$1" --verbose "$@" ${HOME} -eu sed
+	--verbose | "$@" local /usr/bin | awk x=1 printf "$1" sed ${HOME} $(pwd)
+		then printf 'quoted text' cd done printf && "$1" sed awk grep awk
+cd local done /usr/bin done "$1" sed sed "$1" then
+	test readonly x=1 readonly then test "$1" local --verbose cd local 2>/dev/null "$@"
+		grep readonly then --verbose awk readonly export --verbose
+		cd 'quoted text' awk x=1 awk readonly -eu readonly cd 'quoted text'
+		test -eu printf sed printf 'quoted text' done
+	$(pwd) "$@" echo sed printf echo -eu --verbose ${HOME} sed local printf | ${HOME}
+	printf done echo && "$@" awk x=1 then --verbose sed then | "$@" test 2>/dev/null
+	$(pwd) x=1 2>/dev/null sed echo export cd grep done
+		'quoted text' --verbose
+		$(pwd) then sed ${HOME} && -eu printf x=1 /usr/bin
+-eu 'quoted text' cd grep
+readonly then local -eu echo x=1 then x=1 && sed | readonly -eu readonly
+"$@" && test test x=1 awk grep test export awk awk echo x=1 | ${HOME}
+'quoted text' $(pwd) then done -eu then "$1" "$1" grep cd then printf
+2>/dev/null printf awk local printf --verbose -eu ${HOME} local
+	export awk cd grep sed 'quoted text'
+--verbose -eu sed "$1"
+		grep | done grep -eu printf test grep
+x=1 readonly 2>/dev/null local 2>/dev/null printf
+export sed export 'quoted text' readonly --verbose
+		then awk && $(pwd) done readonly --verbose
+		printf then | x=1 then $(pwd) readonly then sed export sed test "$@" 2>/dev/null
+awk sed grep && --verbose cd then grep echo awk readonly "$@" done
+		sed | && export /usr/bin "$@" "$@" 'quoted text' sed done
+	"$@" cd "$1" $(pwd) && printf local grep test export $(pwd) test printf
+	${HOME} 'quoted text' then -eu
+	printf 2>/dev/null then grep /usr/bin
+	2>/dev/null test cd export done | $(pwd)
+	x=1 then $(pwd) && && readonly --verbose && $(pwd) echo
+		awk | "$1" test "$1" --verbose cd export then -eu --verbose
+		printf "$1" awk "$1" $(pwd) printf echo "$@" |
+	x=1 ${HOME} 'quoted text' -eu test local --verbose test
+	then ${HOME} 'quoted text' done ${HOME} sed local /usr/bin
+	awk && test && awk export then
+	printf test sed printf awk ${HOME} readonly echo x=1 export | done x=1 sed
+	/usr/bin --verbose printf "$1" /usr/bin /usr/bin
+test printf printf ${HOME} done 'quoted text' then grep ${HOME}
+	then $(pwd) export $(pwd) done cd sed 'quoted text' export x=1 local 'quoted text'
+		| grep echo printf | && export 2>/dev/null awk $(pwd) | $(pwd) echo 'quoted text'
+readonly "$@" 'quoted text' | 2>/dev/null --verbose cd
+"$@" then readonly cd "$1" awk ${HOME} /usr/bin "$1" awk "$1" --verbose 2>/dev/null
+	/usr/bin "$@" x=1 cd local echo x=1 ${HOME} readonly ${HOME} -eu
+		"$@" test then -eu /usr/bin
+	x=1 /usr/bin 'quoted text' printf --verbose && cd export readonly echo -eu 'quoted text'
+	cd 2>/dev/null export 2>/dev/null test export
+	| sed then | echo readonly awk $(pwd) /usr/bin grep ${HOME}
+$(pwd) echo cd grep x=1 test
+		grep printf ${HOME} --verbose
+		local $(pwd) done cd test 'quoted text'
+	| ${HOME} export test grep test sed printf echo | local
+done 2>/dev/null 2>/dev/null export done ${HOME}
+	x=1 --verbose cd local export printf
+echo test --verbose export && grep echo 'quoted text' $(pwd) export /usr/bin
+		cd test 'quoted text' sed sed local then "$1" "$@" $(pwd) ${HOME}
+	export grep test /usr/bin | ${HOME} local 'quoted text' printf --verbose ${HOME}
+		$(pwd) test 2>/dev/null
+cd sed x=1 local 2>/dev/null 2>/dev/null /usr/bin /usr/bin printf "$1" x=1 x=1
+	local printf | printf "$@" then x=1 /usr/bin ${HOME} printf "$@" local
+	awk "$@" $(pwd) awk local -eu /usr/bin echo cd --verbose
+	cd local /usr/bin "$@" x=1 export then | export x=1
+	readonly --verbose 'quoted text' | "$@" && x=1 then test |
+	then local /usr/bin test 2>/dev/null cd done
+	export cd cd sed 'quoted text'
+awk /usr/bin 'quoted text' $(pwd) | done
+		| echo ${HOME} awk cd 2>/dev/null 'quoted text' readonly
+		echo --verbose cd /usr/bin $(pwd) cd "$1"
+		$(pwd) $(pwd) grep readonly done sed cd echo sed $(pwd)
+	local $(pwd) | ${HOME} --verbose "$1" "$@" readonly -eu local echo awk "$1"
+$(pwd) $(pwd) echo readonly | done awk export
+--verbose then awk $(pwd) /usr/bin local | | && && sed echo
+	test $(pwd) local x=1 | --verbose local export 'quoted text'
+	"$@" grep printf 2>/dev/null grep test | "$@" x=1 export $(pwd) awk "$1" then /usr/bin
+	&& local 'quoted text' test readonly "$1" 2>/dev/null "$1" local /usr/bin
+		local ${HOME} | export cd 2>/dev/null
+	awk --verbose grep 2>/dev/null | grep sed
+	&& local test -eu readonly $(pwd)
+	export awk sed && done ${HOME} export | awk sed -eu readonly
+		cd 2>/dev/null sed then 'quoted text' 2>/dev/null -eu sed 'quoted text'
+--verbose readonly local "$@" $(pwd) printf
+	2>/dev/null ${HOME} $(pwd) 2>/dev/null "$@" cd && ${HOME} test 2>/dev/null
+		readonly $(pwd) cd done sed printf
+/usr/bin test && -eu 'quoted text' --verbose grep awk
+	'quoted text' test sed grep 'quoted text'
+local echo -eu local test
+	sed $(pwd) -eu -eu -eu done $(pwd) export export export 'quoted text' -eu
+	cd $(pwd) grep printf /usr/bin local
+		cd "$@" export x=1 local --verbose sed test /usr/bin
+		${HOME} 'quoted text' cd test && 2>/dev/null
+		/usr/bin 'quoted text' sed printf echo
+	2>/dev/null local awk 2>/dev/null then x=1 ${HOME} done x=1
+	"$1" awk cd echo echo printf 2>/dev/null 'quoted text' awk ${HOME}
+echo ${HOME} 'quoted text' x=1 readonly test sed printf cd ${HOME} | "$@" awk readonly
+done 2>/dev/null ${HOME}
+		local export --verbose echo 2>/dev/null echo grep && then 'quoted text' --verbose
+		'quoted text' echo -eu test x=1 awk | cd readonly 2>/dev/null export grep
+done /usr/bin 2>/dev/null test test 2>/dev/null awk awk done
+		| grep /usr/bin printf "$@" awk -eu x=1 local x=1 grep "$@" 2>/dev/null 2>/dev/null
+		then local done ${HOME} sed printf
+	printf readonly awk x=1 grep
+&& echo then -eu ${HOME} awk -eu
+	done echo done /usr/bin -eu x=1 printf export
+	2>/dev/null sed && && test echo --verbose
+x=1 test export test | test
+	sed && /usr/bin echo printf "$@" awk echo echo local
+	"$@" readonly sed grep grep export
+	$(pwd) "$1" $(pwd) then
+	x=1 ${HOME} awk grep export cd then test done local $(pwd) readonly $(pwd)
+	-eu printf $(pwd) printf cd local cd
+sed grep $(pwd) "$@" local readonly echo | readonly
+		&& sed | export "$1" | -eu done
+local awk 'quoted text' | ${HOME} done /usr/bin $(pwd) $(pwd) local && /usr/bin
+	-eu x=1 export grep test "$@"
+		"$@" awk "$1" -eu sed printf
+		cd ${HOME} awk -eu -eu readonly readonly awk x=1 "$1" /usr/bin 2>/dev/null
+		${HOME} x=1 'quoted text' /usr/bin export then ${HOME} && grep 'quoted text'
+	-eu x=1 echo done | 'quoted text' then then x=1
+${HOME} grep --verbose
+'quoted text' --verbose readonly echo test printf awk done cd sed $(pwd) $(pwd)
+		local grep ${HOME} "$@" printf export test local && --verbose
+grep export done 'quoted text' printf --verbose ${HOME} echo 'quoted text'
+		export ${HOME} 2>/dev/null sed 'quoted text' | && | cd local
+-eu then cd local ${HOME}
+		done test "$@" grep 2>/dev/null "$1" -eu ${HOME} printf readonly export
+		$(pwd) test /usr/bin /usr/bin | readonly export grep sed ${HOME}
+awk echo test grep printf
+awk awk -eu /usr/bin cd | --verbose $(pwd) && readonly then
+	echo "$1" awk then 'quoted text' --verbose $(pwd) --verbose then test 'quoted text'
+		2>/dev/null done cd && --verbose /usr/bin cd x=1 printf awk x=1
+		${HOME} ${HOME} "$1" "$1" /usr/bin awk echo "$@" --verbose
+2>/dev/null done printf "$1" test 2>/dev/null grep echo | done echo
+		test readonly export "$1" | cd && sed printf ${HOME} $(pwd)
+		then echo then local x=1 -eu && test grep && -eu readonly /usr/bin grep grep
+	&& --verbose export 2>/dev/null awk -eu grep cd | -eu done 2>/dev/null
+		export local && $(pwd) then readonly export
+		grep sed $(pwd) -eu -eu -eu "$@" echo readonly -eu done "$1"
+"$@" /usr/bin && done then $(pwd) && grep /usr/bin ${HOME}
+		2>/dev/null done | printf ${HOME} readonly
+/usr/bin x=1 then printf printf
+	| done "$1" then export done local ${HOME} sed awk printf "$@" x=1
+		| printf then 'quoted text' x=1 x=1
+		echo echo /usr/bin grep x=1 then
+'quoted text' -eu grep --verbose | /usr/bin export sed printf
+	'quoted text' && sed
+	then awk then cd ${HOME} test /usr/bin then done sed grep
+	local $(pwd) ${HOME} 2>/dev/null export printf -eu
+		2>/dev/null grep /usr/bin done /usr/bin awk done ${HOME} --verbose x=1 -eu
+	grep local local 2>/dev/null sed local $(pwd) 'quoted text' ${HOME} "$1" grep
+-eu 2>/dev/null local 2>/dev/null grep -eu 'quoted text' -eu "$@" "$1" |
+	then cd done then "$@" 2>/dev/null
+	cd printf $(pwd) --verbose done local grep local export
+	awk export 2>/dev/null then grep sed done "$1" x=1 -eu && && x=1 -eu | grep
+		&& --verbose 2>/dev/null && printf printf "$1" cd
+cd awk echo ${HOME} sed grep
+then 'quoted text' cd sed test
+	local readonly echo /usr/bin export 2>/dev/null --verbose readonly
+	then done && awk && echo readonly ${HOME} /usr/bin awk "$1" && 'quoted text'
+"$@" done $(pwd) $(pwd) | printf --verbose 2>/dev/null local
+export echo x=1 && x=1
+/usr/bin /usr/bin echo --verbose 'quoted text' -eu ${HOME} then local echo
+--verbose | printf && local
+${HOME} "$@" ${HOME} && then -eu cd readonly export | echo printf
+	done 2>/dev/null ${HOME} echo "$1" $(pwd) --verbose
+x=1 export readonly 'quoted text' echo sed && grep
+	| awk --verbose readonly export awk readonly sed --verbose $(pwd)
+/usr/bin echo /usr/bin $(pwd) sed
+		test $(pwd) x=1 x=1 cd ${HOME} -eu -eu done --verbose ${HOME} done done
+		2>/dev/null "$@" grep /usr/bin --verbose sed sed test cd $(pwd) local done
+	--verbose echo | /usr/bin -eu ${HOME} test ${HOME}
+		readonly readonly printf -eu cd "$1" export
+	readonly /usr/bin x=1 test /usr/bin grep /usr/bin done
+	"$@" ${HOME} done export then && /usr/bin ${HOME} && printf
+"$1" "$1" /usr/bin echo $(pwd) printf printf
+sed "$1" local --verbose
+		then test 'quoted text' x=1 ${HOME} then local then --verbose sed
+		done && printf 2>/dev/null --verbose sed 'quoted text'
+	test /usr/bin test "$@" printf awk test cd "$@" grep sed
+		'quoted text' readonly printf ${HOME} awk local
+'quoted text' "$1" done printf 2>/dev/null /usr/bin $(pwd)
+	sed "$1" "$1" | --verbose
+--verbose /usr/bin 2>/dev/null 2>/dev/null --verbose x=1 then sed local
+		test -eu $(pwd) ${HOME} "$1" echo x=1 readonly ${HOME} $(pwd) $(pwd)
+	export --verbose | local cd 2>/dev/null readonly local
+		sed done ${HOME} test | export && cd test 2>/dev/null -eu then echo | "$1" "$@"
+	| x=1 "$1" 2>/dev/null readonly export done "$1" --verbose sed
+		-eu 2>/dev/null readonly echo echo /usr/bin $(pwd) local echo grep sed &&
+	done && readonly | 'quoted text' && grep -eu "$1" export readonly then x=1
+	| && export test /usr/bin
+	"$@" done "$1" readonly -eu && awk test
+	/usr/bin awk ${HOME} 'quoted text' readonly
+	grep readonly printf grep sed cd readonly "$1"
+	2>/dev/null cd ${HOME} $(pwd) $(pwd) -eu awk /usr/bin then
+		readonly -eu sed --verbose /usr/bin
+export done test x=1 export "$1" /usr/bin ${HOME} -eu export
+echo local sed 'quoted text' /usr/bin then cd test local echo echo
+		--verbose /usr/bin $(pwd) "$@" test "$1" --verbose
+		printf printf --verbose | export 'quoted text' | x=1 readonly
+	readonly | x=1 export $(pwd) then 'quoted text' x=1 done export | echo
+		| readonly grep && 2>/dev/null readonly x=1 --verbose grep local export
+	then x=1 echo test -eu -eu awk local echo
+	echo then cd -eu 'quoted text'
+	printf export --verbose | local
+awk grep ${HOME} 'quoted text' "$@" -eu 2>/dev/null export | readonly
+	printf done local printf --verbose $(pwd) sed x=1 printf done
+	$(pwd) readonly "$1" |
+		/usr/bin printf cd export $(pwd) readonly then
+	x=1 grep export ${HOME} --verbose
+sed /usr/bin 2>/dev/null -eu && | && -eu awk awk cd 'quoted text'
+	printf && grep $(pwd) sed grep $(pwd) 'quoted text'
+		"$1" done export $(pwd) | grep --verbose grep awk
+then $(pwd) 'quoted text' -eu | ${HOME} echo -eu sed
+		"$1" echo x=1 x=1 2>/dev/null then cd 2>/dev/null done | local 'quoted text'
+printf "$@" -eu echo x=1 2>/dev/null --verbose &&
+test | ${HOME} 'quoted text' local && 2>/dev/null
+		"$1" 'quoted text' && export 'quoted text' local cd $(pwd) ${HOME} local x=1
+printf x=1 sed --verbose echo test local "$@" /usr/bin
+		x=1 printf 2>/dev/null -eu grep "$@" ${HOME} 'quoted text' /usr/bin export &&
+		echo $(pwd) 'quoted text' --verbose /usr/bin test 2>/dev/null "$@"
+		$(pwd) /usr/bin then $(pwd) /usr/bin -eu local printf local "$1" --verbose 'quoted text'
+"$@" $(pwd) readonly awk
+readonly awk export 2>/dev/null
+awk && printf 'quoted text' sed 'quoted text'
+		test printf done done /usr/bin echo && --verbose
+printf echo then test grep && then
+	printf ${HOME} local done ${HOME} | --verbose x=1 2>/dev/null
+		"$@" export then local 2>/dev/null
+		readonly "$1" sed | printf export sed grep printf export -eu "$@" test ${HOME}
+		then 'quoted text' test grep "$1" printf grep echo "$1" printf then
+/usr/bin && ${HOME} local local && /usr/bin x=1 2>/dev/null ${HOME} echo
+sed 2>/dev/null cd awk readonly awk 2>/dev/null
+		"$@" cd -eu sed "$1" sed
+sed test sed --verbose --verbose local local then done
+		printf test | 2>/dev/null "$@" grep 'quoted text'
+done readonly "$1" "$1" printf "$1" sed --verbose -eu --verbose
+		export "$@" 2>/dev/null x=1
+		| local "$@" echo | awk cd $(pwd) done ${HOME} sed | test printf "$@" grep
+		done -eu 'quoted text' grep -eu done --verbose && sed then then "$1"
+echo readonly printf /usr/bin
+		echo 2>/dev/null sed done grep
+| ${HOME} sed | cd --verbose /usr/bin
+	then "$@" -eu then then $(pwd) "$1" readonly done
+printf done | sed echo x=1 ${HOME} local sed
+	then -eu test 2>/dev/null 'quoted text' "$@" readonly ${HOME} 2>/dev/null
+		sed x=1 awk grep printf "$@" local
+	${HOME} done then grep done -eu grep /usr/bin
+		echo --verbose -eu grep x=1 "$1" test then --verbose cd awk "$1" ${HOME}
+test awk ${HOME} export printf done awk 'quoted text' && && echo sed export local
+printf sed --verbose "$1"
+		&& grep "$1" 'quoted text' x=1 -eu 'quoted text' $(pwd) && grep printf
+x=1 /usr/bin done awk 'quoted text'
+done test awk "$1" grep echo done && sed sed
+	${HOME} done ${HOME} 2>/dev/null --verbose done done x=1 export
+done awk grep && "$@" test grep printf -eu -eu printf printf printf
+grep -eu "$@" ${HOME} grep 'quoted text' echo "$@"
+		--verbose "$1" local grep test 2>/dev/null cd | echo 2>/dev/null 'quoted text'
+	&& && grep grep awk grep -eu echo
+	local $(pwd) test && "$@" x=1 $(pwd) x=1 local "$1"
+		export local 2>/dev/null "$1" readonly 'quoted text' x=1 grep export -eu echo
+	2>/dev/null && awk --verbose test ${HOME}
+readonly x=1 grep 'quoted text' /usr/bin --verbose 'quoted text'
+done $(pwd) echo readonly -eu printf
+		printf then echo then ${HOME} 2>/dev/null sed ${HOME} readonly
+		--verbose local printf readonly 2>/dev/null then sed
+		-eu x=1 "$1" grep export cd /usr/bin /usr/bin
+		test "$1" $(pwd) grep --verbose awk | "$1" cd "$@" /usr/bin x=1 readonly
+| --verbose x=1 --verbose local echo readonly echo
+	awk readonly /usr/bin printf
+	x=1 printf 2>/dev/null ${HOME} done x=1
+done done "$@" cd "$1"
+	/usr/bin "$@" $(pwd) awk && then
+test then printf | then printf /usr/bin
+	| local cd ${HOME} | awk local test ${HOME} /usr/bin "$@" done /usr/bin $(pwd)
+	printf x=1 "$@" 'quoted text' printf printf /usr/bin "$@" printf "$1" "$1" "$1"
+	/usr/bin test /usr/bin sed echo local awk | $(pwd) 'quoted text'
+		sed then export "$@" awk 2>/dev/null echo x=1 done sed then then ${HOME} readonly
+export awk grep sed grep
+	awk 2>/dev/null local ${HOME} cd local x=1 done $(pwd) done grep echo
+		grep "$1" cd echo "$@" x=1 "$1"
+		x=1 "$1" "$@" "$1" ${HOME} test export done -eu awk $(pwd) cd cd
+awk then export "$1" echo local ${HOME} printf local | echo test echo
+		export "$1" awk "$1" echo 'quoted text' printf
+		| x=1 | "$@" echo 'quoted text' readonly -eu 2>/dev/null
+printf --verbose | local awk test export then --verbose echo readonly
+		cd cd awk grep /usr/bin --verbose -eu | sed export x=1
+x=1 grep "$@" ${HOME} x=1 readonly readonly grep -eu done
+	done awk readonly echo | && -eu cd sed echo cd grep sed
+"$1" sed "$1" -eu 'quoted text' then --verbose
+"$@" "$1" | awk ${HOME} "$@"
+		grep sed 'quoted text' then grep -eu echo "$@" $(pwd) test
+grep local test "$1" "$1" && export && "$1" grep test export $(pwd)
+	grep export local done then &&
+		local ${HOME} local | && grep
+	&& export readonly printf readonly x=1 /usr/bin printf grep x=1 readonly
+	| "$1" $(pwd) then local $(pwd) done -eu readonly sed printf && sed
+		${HOME} sed /usr/bin $(pwd) 2>/dev/null
+$(pwd) done printf awk echo 'quoted text' test sed awk local
+2>/dev/null x=1 then $(pwd) /usr/bin "$@" 'quoted text' --verbose echo ${HOME}
+		'quoted text' "$@" local ${HOME} ${HOME}
+		export sed test sed done x=1 awk x=1 $(pwd) && --verbose
+x=1 | then awk printf "$1" "$@" /usr/bin
+	grep echo 2>/dev/null ${HOME} readonly /usr/bin awk -eu
+		x=1 test ${HOME} | test 2>/dev/null echo then && "$@" x=1 'quoted text'
+	'quoted text' awk local | $(pwd)
+		| awk --verbose readonly x=1 grep then awk |
+		local test "$1" 2>/dev/null test echo done --verbose x=1 "$1" "$@" | awk then
+		--verbose awk | echo
+local readonly test /usr/bin echo test cd | grep ${HOME}
+		export awk 'quoted text'
+then echo readonly sed 2>/dev/null sed ${HOME} local sed "$@" echo "$@"
+		awk printf -eu 2>/dev/null done "$@" 2>/dev/null grep cd "$@" | awk grep
+		then | x=1 2>/dev/null /usr/bin | "$@"
+		x=1 "$1" echo then "$1" "$1" /usr/bin printf | awk done
+		${HOME} test cd test 2>/dev/null local test x=1 && /usr/bin local | && "$1"
+/usr/bin ${HOME} grep 'quoted text' cd /usr/bin
+then grep 'quoted text' -eu x=1 x=1 x=1 /usr/bin local grep 2>/dev/null awk
+		readonly then -eu awk readonly local "$@" $(pwd) "$1" "$@" echo echo "$@" "$1"
+	awk done local "$@" test
+	done 'quoted text' echo 'quoted text' export && grep
+	readonly readonly echo awk --verbose local && echo
+-eu 'quoted text' $(pwd) -eu export
+		then x=1 test "$1" readonly $(pwd) local sed done | export | sed --verbose
+${HOME} sed export 2>/dev/null
+printf readonly ${HOME} awk
+		then --verbose "$@" && x=1 -eu | /usr/bin "$@"
+echo 2>/dev/null "$@" 2>/dev/null x=1 then sed 'quoted text' ${HOME}
+-eu x=1 echo --verbose
+--verbose grep /usr/bin -eu echo awk --verbose && then then printf readonly "$1"
+		x=1 printf | && x=1 "$1" export "$@" test sed cd | 'quoted text'
+	printf test echo /usr/bin echo $(pwd) grep /usr/bin echo --verbose
+		local ${HOME} cd "$@" "$1" echo | "$@" readonly readonly
+x=1 local sed $(pwd) /usr/bin test "$1" local sed "$@" 'quoted text' --verbose
+		cd ${HOME} ${HOME} --verbose
+local sed printf 2>/dev/null test export | export
+		$(pwd) "$1" --verbose done | sed
+		echo | local printf grep sed x=1 readonly 'quoted text' "$1" readonly
+		${HOME} --verbose ${HOME} "$1" done local 2>/dev/null 'quoted text'
+test awk --verbose "$1" | export echo awk echo local done
+		2>/dev/null then test $(pwd) 'quoted text' cd x=1 'quoted text'
+	2>/dev/null local done "$@" | ${HOME}
+	echo export -eu printf $(pwd)
+"$@" awk test then printf "$@" $(pwd) 'quoted text'
+-eu then -eu printf readonly
+		'quoted text' sed 2>/dev/null x=1 'quoted text' awk done cd awk
+		sed /usr/bin "$1" then | x=1 $(pwd)
+done local done | awk export 2>/dev/null
+printf && --verbose && echo $(pwd)
+	done export x=1 2>/dev/null printf cd local ${HOME} sed ${HOME}
+"$@" "$1" local echo $(pwd) x=1 -eu "$1"
+		awk done "$1" x=1 grep && readonly local local readonly $(pwd)
+	${HOME} /usr/bin sed --verbose "$1" readonly sed x=1 ${HOME} awk then
+		printf 'quoted text' echo ${HOME} "$@" /usr/bin readonly echo $(pwd)
+	done grep | then test "$@" | grep local "$@" "$1" test
+test sed local done grep readonly awk "$1" $(pwd) /usr/bin &&
+	then then awk -eu --verbose $(pwd)
+		cd "$1" export awk then /usr/bin test awk -eu | sed /usr/bin echo
+		$(pwd) "$1" | ${HOME} 'quoted text' && awk then then test 'quoted text' done
+then "$1" echo readonly done then echo $(pwd) done awk 2>/dev/null local
+		cd test test "$@" &&
+	$(pwd) awk "$@" grep then 'quoted text' "$@" &&
+--verbose sed x=1 x=1 $(pwd) /usr/bin
+	--verbose test --verbose test sed "$1" "$1" 'quoted text' test && 'quoted text'
+	"$1" echo echo "$@" 2>/dev/null $(pwd) cd awk awk
+then test sed 2>/dev/null
+printf done 2>/dev/null export "$@" --verbose sed "$@" && local --verbose
+		x=1 && 'quoted text' test x=1 sed x=1 export
+| then -eu grep "$1" awk test | echo | awk done readonly $(pwd)
+echo grep local local -eu then grep --verbose echo then |
+	&& -eu "$@" echo "$@" 2>/dev/null test readonly then export 'quoted text' | export
+--verbose x=1 readonly printf /usr/bin -eu readonly
+	| readonly -eu echo "$1" "$1" --verbose cd
+	echo grep grep grep echo /usr/bin 2>/dev/null readonly "$@"
+	then "$@" local $(pwd) ${HOME} x=1 echo && then /usr/bin sed test && printf 2>/dev/null
+then awk test 2>/dev/null local readonly sed echo $(pwd)
+&& ${HOME} test done /usr/bin $(pwd)
+"$1" printf $(pwd) --verbose /usr/bin
+cd ${HOME} && /usr/bin test 2>/dev/null export -eu "$1" "$1" $(pwd)
+	-eu printf --verbose 'quoted text'
+		test printf echo awk echo cd grep printf | printf grep echo && sed awk 'quoted text'
+printf awk echo local $(pwd) /usr/bin echo 'quoted text'
+	--verbose done x=1 local /usr/bin 2>/dev/null
+		sed --verbose 2>/dev/null sed -eu
+		then ${HOME} readonly &&
+		${HOME} 2>/dev/null awk printf && 2>/dev/null echo /usr/bin x=1 done printf
+	done x=1 grep $(pwd) x=1 done 'quoted text' 2>/dev/null /usr/bin printf 'quoted text'
+		x=1 awk then export ${HOME}
+		done cd 'quoted text' $(pwd) sed "$1" then export test done
+		2>/dev/null printf -eu local x=1 ${HOME} 2>/dev/null grep sed /usr/bin /usr/bin
+		export $(pwd) awk $(pwd) done /usr/bin export printf 2>/dev/null "$@"
+done "$1" export 'quoted text' | "$1" local /usr/bin
+		/usr/bin export "$@" | --verbose grep && && -eu readonly printf
+	/usr/bin grep && local grep "$@" --verbose ${HOME}
+test --verbose sed test ${HOME} echo local --verbose echo $(pwd) export
+	grep && ${HOME} sed local then "$1" done ${HOME}
+	x=1 $(pwd) printf && "$1" --verbose echo
+		2>/dev/null sed done awk --verbose 2>/dev/null ${HOME} /usr/bin printf x=1
+		export | echo 'quoted text' test readonly /usr/bin test --verbose 2>/dev/null
+		export 2>/dev/null | $(pwd) local
+		echo export x=1 done test grep 'quoted text'
+'quoted text' readonly test "$@"
+	--verbose -eu "$1" 2>/dev/null /usr/bin --verbose 'quoted text'
+		/usr/bin done $(pwd) printf local export cd && echo 'quoted text' $(pwd)
+grep echo awk readonly then --verbose -eu --verbose done export
+done x=1 then test sed sed sed then readonly
+readonly 2>/dev/null readonly readonly | "$@" cd x=1 && | local -eu
+local echo grep grep test /usr/bin
+		$(pwd) test -eu "$@" printf export $(pwd) $(pwd) | printf
+		grep then awk grep 'quoted text' done readonly grep $(pwd)
@@ -0,0 +1,2001 @@
+	done awk echo then test echo | then 2>/dev/null
+	printf ${HOME} | "$@" --verbose readonly sed x=1 | 2>/dev/null -eu 'quoted text'
+${HOME} printf | ${HOME} cd then $(pwd) ${HOME} local done /usr/bin
+${HOME} cd x=1 printf ${HOME} /usr/bin $(pwd) 'quoted text'
+		export done /usr/bin 2>/dev/null echo then echo cd sed printf sed cd sed
+		then grep then done ${HOME} 2>/dev/null -eu x=1 && test readonly
+	printf cd local /usr/bin printf 'quoted text'
+	/usr/bin grep -eu --verbose ${HOME}
+		awk done x=1 awk "$1" cd export 2>/dev/null | sed then cd
+	'quoted text' ${HOME} /usr/bin
+sed export test 2>/dev/null $(pwd) cd
+'quoted text' then x=1
+		done readonly -eu awk ${HOME}
+	sed readonly sed local done awk 2>/dev/null done local local printf
+cd export cd cd echo sed sed x=1 --verbose printf then && 2>/dev/null readonly
+	cd | 2>/dev/null "$@" "$@" echo | test export
+2>/dev/null "$@" local cd awk 2>/dev/null --verbose printf grep
+		/usr/bin export x=1 'quoted text' /usr/bin export
+	'quoted text' awk test x=1 "$@" "$1" local "$1" && awk cd 2>/dev/null
+		readonly printf | 2>/dev/null $(pwd)
+"$@" local awk done --verbose 2>/dev/null
+		done done export grep then echo done then local x=1 printf --verbose test
+	2>/dev/null $(pwd) "$@" printf | echo
+	sed test | --verbose sed --verbose "$@" readonly echo
+		x=1 grep readonly local
+x=1 'quoted text' echo -eu $(pwd) sed then echo
+local grep --verbose 'quoted text' "$1" 'quoted text' grep echo
+	done local 'quoted text' readonly --verbose -eu
+	local cd -eu cd $(pwd) 'quoted text' test readonly | echo awk grep
+		$(pwd) "$@" printf grep 'quoted text' "$1" x=1 grep "$1" && test
+${HOME} && x=1 local -eu | | "$1" x=1 printf echo done | test printf
+	"$1" /usr/bin ${HOME} done 'quoted text'
+		printf $(pwd) x=1 && /usr/bin awk cd 'quoted text'
+		printf $(pwd) "$@" 'quoted text' | test printf done "$1" sed done
+	export -eu && then "$1"
+		x=1 x=1 local sed $(pwd) sed $(pwd)
+	grep "$@" --verbose 'quoted text'
+		done && then --verbose echo && x=1 done echo then then cd --verbose
+	'quoted text' | done awk 'quoted text' done "$@" --verbose /usr/bin
+		2>/dev/null echo cd grep ${HOME} "$@" "$1" cd | export
+	| --verbose cd 'quoted text' --verbose cd test
+"$1" done 'quoted text' 'quoted text' /usr/bin
+"$@" readonly /usr/bin "$@" | /usr/bin local 'quoted text'
+x=1 echo 2>/dev/null "$1" awk readonly $(pwd) awk "$1"
+		printf sed && done export printf sed 'quoted text' echo 'quoted text'
+	echo awk 2>/dev/null /usr/bin --verbose "$@" then 'quoted text'
+	2>/dev/null x=1 then x=1 echo $(pwd) ${HOME} test
+		readonly done 2>/dev/null 2>/dev/null $(pwd)
+		"$@" 2>/dev/null --verbose
+		echo && awk 2>/dev/null readonly 'quoted text' printf
+	x=1 | && --verbose awk readonly then local
+		"$@" grep -eu grep --verbose -eu ${HOME}
+awk && test grep "$1" 2>/dev/null
+		grep 2>/dev/null readonly 'quoted text' awk test "$@" test --verbose $(pwd)
+		$(pwd) cd export | /usr/bin 2>/dev/null
+		-eu $(pwd) 2>/dev/null --verbose --verbose 'quoted text' readonly export x=1 x=1
+sed "$@" echo sed && echo echo /usr/bin echo /usr/bin x=1 | awk readonly
+		"$@" awk local && echo grep 'quoted text'
+		local then test && echo readonly
+		awk readonly && cd 2>/dev/null
+		done --verbose -eu sed --verbose 'quoted text' x=1 ${HOME}
+	x=1 | --verbose /usr/bin x=1 x=1 'quoted text' awk "$@" && /usr/bin
+		${HOME} export $(pwd) | sed sed readonly cd | sed | --verbose
+		done readonly /usr/bin export echo then 'quoted text' awk
+export "$@" | awk sed sed test "$@" readonly export printf readonly
+	| ${HOME} cd printf --verbose 'quoted text' sed -eu
+		--verbose $(pwd) | echo awk x=1 printf test
+readonly --verbose | then echo cd awk
+awk 'quoted text' 2>/dev/null echo 2>/dev/null
+	'quoted text' x=1 x=1 "$@" done /usr/bin done then
+readonly cd "$@" 'quoted text' 2>/dev/null 2>/dev/null
+	awk done $(pwd) printf export export grep then done "$@" readonly 'quoted text'
+		/usr/bin /usr/bin test /usr/bin sed x=1 test cd awk | test ${HOME} "$1"
+export local | awk -eu "$1" $(pwd) printf local "$@" 'quoted text'
+	sed ${HOME} "$1" 'quoted text' | $(pwd) 'quoted text' printf | "$1" echo
+	'quoted text' --verbose && 'quoted text'
+		'quoted text' test 'quoted text' sed $(pwd) grep awk local readonly
+		"$1" then && readonly 2>/dev/null --verbose && done local
+		done ${HOME} test readonly | awk 'quoted text'
+done --verbose readonly | grep local grep
+		test ${HOME} export 2>/dev/null
+		$(pwd) "$@" export printf awk ${HOME} && 'quoted text'
+x=1 done --verbose | echo awk printf then done ${HOME}
+	--verbose $(pwd) "$1" local | | cd cd echo
+	printf then "$1" printf awk readonly /usr/bin
+then local grep echo "$@" "$@" test echo grep
+		awk local test x=1 grep test "$@" cd cd
+-eu && ${HOME} x=1 grep grep readonly 'quoted text' | test local --verbose
+	local "$@" "$@" cd $(pwd) local sed 2>/dev/null echo sed |
+	readonly cd cd grep grep done readonly 'quoted text'
+		| done export export 'quoted text'
+	/usr/bin grep then done 'quoted text' "$1" cd export && x=1 local
+	$(pwd) /usr/bin "$1" "$@" 'quoted text'
+	printf ${HOME} test $(pwd) readonly --verbose echo
+| -eu | 'quoted text' x=1 readonly local
+		echo /usr/bin grep grep 2>/dev/null grep
+	--verbose export done local
+then awk grep x=1 echo awk sed awk $(pwd) local | ${HOME}
+		--verbose --verbose ${HOME} -eu grep $(pwd) local
+		cd awk -eu cd then readonly x=1 readonly x=1
+		x=1 done && "$@" ${HOME}
+		&& printf then x=1 "$1" then x=1 | 'quoted text' sed readonly
+	&& readonly grep sed grep x=1 done 2>/dev/null x=1 local echo
+--verbose /usr/bin ${HOME} /usr/bin
+test $(pwd) -eu | awk $(pwd) --verbose
+	export printf then readonly 'quoted text' sed $(pwd) readonly readonly 'quoted text'
+'quoted text' done --verbose "$@" sed local readonly cd $(pwd) 2>/dev/null
+		local "$1" awk readonly /usr/bin && grep $(pwd) cd && --verbose
+		readonly --verbose | /usr/bin
+	echo export sed printf $(pwd) $(pwd) && /usr/bin done "$@" awk
+		/usr/bin | then sed printf $(pwd) test ${HOME}
+	awk /usr/bin test echo test printf sed then x=1 $(pwd) then -eu | "$@"
+	printf 2>/dev/null export awk | done export
+	printf 'quoted text' printf export printf done /usr/bin ${HOME}
+		--verbose | echo "$1" then "$1" /usr/bin cd ${HOME} && && echo readonly then "$1"
+		"$1" /usr/bin x=1 "$@" grep grep readonly export x=1 -eu 'quoted text'
+	&& && 'quoted text' local sed | grep then done echo && then done readonly
+cd -eu $(pwd) local export readonly awk && -eu | sed local
+	echo printf export test then /usr/bin -eu 'quoted text'
+	local sed grep local then 2>/dev/null test && readonly export local
+--verbose test cd $(pwd) "$@" 'quoted text' /usr/bin $(pwd) then
+test awk x=1 -eu export
+local grep 2>/dev/null x=1 -eu -eu grep && $(pwd) | awk
+awk "$@" 2>/dev/null | 2>/dev/null
+$(pwd) sed echo local readonly awk sed
+	x=1 -eu $(pwd) "$1" export -eu -eu 2>/dev/null readonly
+		--verbose -eu 2>/dev/null local
+	then done cd 2>/dev/null --verbose grep test x=1 ${HOME} "$@" readonly
+	"$@" x=1 done && -eu 2>/dev/null grep local && awk --verbose
+	export printf sed readonly && x=1 printf x=1
+"$1" -eu ${HOME} awk 2>/dev/null 'quoted text' 2>/dev/null
+--verbose printf echo grep then cd ${HOME} "$1"
+test ${HOME} cd x=1 echo $(pwd) test x=1 --verbose
+		export $(pwd) echo ${HOME} ${HOME} -eu readonly sed
+	'quoted text' test export | test awk echo | "$@" grep -eu "$1" then done
+	echo printf done 2>/dev/null test --verbose 2>/dev/null readonly test
+readonly "$@" cd $(pwd) $(pwd) 2>/dev/null $(pwd) ${HOME}
+	'quoted text' /usr/bin
+	"$@" $(pwd) then awk then printf sed export | 'quoted text'
+		awk awk done -eu ${HOME} readonly
+	local printf awk ${HOME} awk then printf export 'quoted text'
+	readonly printf /usr/bin local echo then "$@" 'quoted text' "$@"
+"$@" local printf "$@" sed
+		printf 2>/dev/null grep 'quoted text' echo --verbose
+	'quoted text' local readonly 2>/dev/null |
+		echo "$@" printf && $(pwd) && sed grep
+"$@" x=1 2>/dev/null "$@" local echo x=1 /usr/bin test test
+"$@" && 'quoted text' export ${HOME} printf readonly x=1 -eu "$1" 'quoted text'
+	test x=1 cd cd -eu "$1" local export sed --verbose "$1" then sed then --verbose
+	"$@" echo ${HOME} -eu printf
+	/usr/bin printf then -eu readonly 'quoted text' ${HOME} 'quoted text' done readonly
+printf $(pwd) done done --verbose /usr/bin
+		export | 'quoted text' && printf ${HOME} sed echo | 'quoted text' $(pwd) awk
+		x=1 test test && local /usr/bin then test
+		x=1 echo --verbose x=1 ${HOME} x=1 sed cd done "$@"
+	'quoted text' "$@" --verbose echo
+	2>/dev/null sed | awk | --verbose echo local
+export 'quoted text' awk readonly $(pwd) printf then -eu
+$(pwd) grep printf sed "$@" 2>/dev/null cd "$@" --verbose
+	test "$@" --verbose | --verbose local "$1" done "$@" done x=1
+	then 'quoted text' echo "$@" cd ${HOME} local grep readonly 'quoted text'
+printf "$1" -eu awk && grep x=1 x=1 -eu then 2>/dev/null
+grep echo printf sed -eu
+	"$@" readonly 'quoted text' local x=1 sed $(pwd)
+	| sed /usr/bin 'quoted text'
+	sed "$@" 'quoted text' readonly then
+		cd "$1" "$@" awk 2>/dev/null awk -eu sed
+$(pwd) "$@" "$1" echo grep export export test then $(pwd)
+"$@" grep "$@" cd | local done "$@" | awk /usr/bin --verbose test then "$1" export
+	grep "$1" --verbose sed 'quoted text' 2>/dev/null x=1 /usr/bin echo
+		cd test --verbose -eu "$@" then -eu /usr/bin grep -eu done readonly
+${HOME} | /usr/bin ${HOME} readonly local ${HOME} 'quoted text'
+		&& 2>/dev/null export "$@" readonly printf ${HOME} | echo echo test --verbose
+export | printf x=1 then -eu x=1 /usr/bin ${HOME} "$1"
+echo test /usr/bin test -eu grep echo 'quoted text' export $(pwd) && 'quoted text'
+	$(pwd) local sed x=1 export sed ${HOME} -eu local "$1" -eu
+"$1" 'quoted text' local /usr/bin cd export grep
+	local export grep test --verbose printf done 'quoted text' awk
+		local grep test /usr/bin test printf
+	2>/dev/null /usr/bin awk sed awk | --verbose then done /usr/bin
+	2>/dev/null $(pwd) ${HOME} echo then x=1 printf
+		sed $(pwd) done readonly -eu printf "$1"
+		$(pwd) local test -eu awk 2>/dev/null
+		"$@" | 2>/dev/null grep && export ${HOME} --verbose x=1 'quoted text' export
+	test readonly sed awk export echo $(pwd) awk ${HOME} then done echo "$1"
+local && "$@" then printf cd --verbose readonly local
+	2>/dev/null 'quoted text' --verbose 'quoted text' $(pwd) "$1" "$1" cd -eu
+test ${HOME} ${HOME} readonly test /usr/bin printf sed printf
+	x=1 && grep 2>/dev/null "$@"
+		cd awk awk --verbose export | x=1 then x=1 printf cd cd awk done
+	--verbose grep test then && grep printf
+export "$1" export -eu "$1" "$@" 'quoted text' cd
+-eu cd ${HOME} 'quoted text' sed
+		--verbose "$1" sed printf ${HOME}
+		cd x=1 2>/dev/null "$1" /usr/bin then test "$1" sed ${HOME} "$1" awk
+		--verbose test export 'quoted text' /usr/bin
+		&& x=1 2>/dev/null grep $(pwd) && local readonly done "$@" $(pwd)
+	then "$1" 'quoted text' "$@" test
+	local export x=1 | grep 2>/dev/null x=1 "$1"
+done "$1" 2>/dev/null
+		local && $(pwd) 'quoted text' /usr/bin
+	export done readonly readonly /usr/bin export
+		'quoted text' ${HOME} "$@" /usr/bin export 'quoted text'
+		printf 'quoted text' then
+		cd 'quoted text' awk && echo local
+		grep 2>/dev/null ${HOME} test | ${HOME} test
+	awk done | sed local | readonly done && printf --verbose
+sed | | export -eu echo ${HOME} | local done export
+	then grep | test | 2>/dev/null "$@" echo awk local "$@" --verbose |
+done 'quoted text' -eu --verbose "$@" then
+/usr/bin -eu 'quoted text' then readonly local |
+	printf ${HOME} --verbose printf $(pwd) | /usr/bin "$@" grep --verbose local |
+		2>/dev/null "$@" ${HOME} cd x=1 "$@" /usr/bin echo $(pwd) /usr/bin x=1 readonly
+		/usr/bin echo | ${HOME} && readonly | echo sed $(pwd) $(pwd)
+		&& -eu done $(pwd) grep x=1 x=1 sed awk /usr/bin 2>/dev/null
+	export echo 2>/dev/null awk export sed printf
+	grep x=1 printf /usr/bin && 2>/dev/null
+x=1 cd sed 2>/dev/null 2>/dev/null sed
+	local cd /usr/bin | done sed -eu
+&& "$1" -eu local cd $(pwd) cd then sed "$1" x=1 x=1 | then
+readonly awk echo sed 'quoted text' && && $(pwd)
+		/usr/bin 2>/dev/null 2>/dev/null "$@" export
+		"$@" && "$@" | -eu printf readonly && --verbose cd readonly then printf $(pwd)
+		printf awk && sed readonly
+	/usr/bin done --verbose
+sed echo "$@" x=1 -eu ${HOME} echo test export
+		-eu && && $(pwd) echo "$1" cd &&
+	${HOME} cd sed | printf 2>/dev/null
+	export x=1 x=1 "$@" grep 'quoted text' then cd | &&
+		then done echo 'quoted text' 2>/dev/null
+	$(pwd) grep ${HOME} $(pwd) awk then then x=1 sed "$@" then
+"$@" | printf then echo
+		echo echo readonly cd export
+echo printf printf test 'quoted text' printf "$1" ${HOME} &&
+		test readonly "$1" export /usr/bin
+		then 'quoted text' readonly grep
+export 'quoted text' grep | export -eu 'quoted text'
+	"$1" && ${HOME} -eu local sed local awk $(pwd)
+	sed echo /usr/bin done --verbose local awk 'quoted text'
+		export 'quoted text' x=1 awk awk "$@" | --verbose local -eu $(pwd) 'quoted text'
+/usr/bin $(pwd) local "$1" cd done --verbose cd 2>/dev/null
+x=1 /usr/bin grep awk then /usr/bin
+readonly /usr/bin then awk && done 'quoted text' echo grep x=1
+echo sed printf test sed local done && echo done then done
+		${HOME} "$@" cd --verbose then && /usr/bin printf -eu local
+printf | /usr/bin && local 2>/dev/null readonly x=1 echo 'quoted text' --verbose
+		readonly printf awk readonly grep awk
+		grep then /usr/bin 2>/dev/null | then 2>/dev/null && cd then printf readonly
+export "$1" x=1 export local cd then export
+	readonly x=1 echo local 'quoted text' ${HOME} export ${HOME}
+	local -eu awk export grep test 'quoted text' $(pwd) echo
+2>/dev/null $(pwd) $(pwd) export cd export local "$@" -eu /usr/bin grep printf
+$(pwd) && cd "$@" local -eu "$1" sed readonly local awk "$1" export
+		echo cd /usr/bin "$1" x=1 export cd -eu 'quoted text' 'quoted text'
+x=1 export printf done then "$1" $(pwd) $(pwd) done
+&& printf 2>/dev/null awk "$@" && done printf local readonly echo printf done
+	export local awk then -eu awk "$@" readonly grep
+	then then then --verbose sed awk then grep | "$@"
+		| 'quoted text' readonly
+	-eu | --verbose readonly then ${HOME} local ${HOME} local && ${HOME}
+		echo 2>/dev/null x=1
+	done /usr/bin x=1 | x=1 $(pwd) done && echo "$1" sed
+'quoted text' readonly | x=1 | sed export --verbose && export --verbose
+	export && readonly printf $(pwd) $(pwd) -eu
+	'quoted text' readonly 'quoted text' ${HOME}
+printf local "$1" -eu local
+	${HOME} export export "$1" local done --verbose
+local local -eu test then | done x=1 awk done done grep awk grep cd "$1" "$@"
+		-eu 'quoted text' ${HOME} local ${HOME} printf cd $(pwd)
+	/usr/bin readonly grep x=1 --verbose printf $(pwd)
+$(pwd) test awk 'quoted text' echo cd ${HOME} 2>/dev/null -eu ${HOME} $(pwd) /usr/bin
+readonly ${HOME} sed cd "$1" printf && 2>/dev/null
+/usr/bin --verbose 'quoted text' then 2>/dev/null cd
+		export done sed 2>/dev/null cd "$@" cd then /usr/bin --verbose awk | test
+readonly /usr/bin printf --verbose
+	done /usr/bin echo ${HOME} --verbose ${HOME}
+		--verbose && /usr/bin then
+	-eu sed ${HOME} -eu && "$@" awk "$@" 2>/dev/null && grep |
+		export readonly $(pwd) echo /usr/bin
+--verbose 2>/dev/null printf | 2>/dev/null
+	printf local cd printf --verbose "$@"
+	/usr/bin /usr/bin "$@" readonly "$1" $(pwd) 2>/dev/null
+	'quoted text' 2>/dev/null --verbose ${HOME} 2>/dev/null
+x=1 echo done | grep cd /usr/bin
+		sed export /usr/bin export
+	"$@" grep $(pwd) then awk 'quoted text'
+	printf sed 'quoted text'
+		$(pwd) "$@" export then -eu
+		test then /usr/bin readonly "$@" test
+	cd grep then test done echo export awk && "$1" echo $(pwd)
+		then then then -eu "$@" printf test
+&& local sed --verbose done
+"$@" done ${HOME} ${HOME} local "$@" local && grep && done 'quoted text'
+	printf "$1" then awk -eu cd printf export x=1 local
+${HOME} && then 2>/dev/null then test done
+	cd done ${HOME} --verbose then
+		&& | ${HOME} done sed grep test cd readonly
+&& grep local local "$@" -eu test local && export readonly sed
+		--verbose grep then "$@" 2>/dev/null | printf "$1" && printf $(pwd) $(pwd)
+	awk -eu cd grep test export x=1 printf
+		| cd local then /usr/bin readonly grep --verbose
+printf | | done && test awk printf "$@"
+		2>/dev/null cd export sed grep 'quoted text' grep
+	--verbose --verbose printf 'quoted text'
+$(pwd) "$@" cd local x=1 local test 'quoted text'
+		"$1" test grep then x=1 && | x=1 $(pwd) local --verbose local cd "$1" --verbose
+echo readonly 2>/dev/null
+		echo grep --verbose then test 'quoted text'
+export test $(pwd) 'quoted text' done ${HOME} echo 'quoted text'
+		$(pwd) | $(pwd) 2>/dev/null $(pwd)
+		/usr/bin export x=1 export 2>/dev/null local && sed readonly then 2>/dev/null
+		export export done done readonly readonly
+$(pwd) $(pwd) 2>/dev/null printf $(pwd) local local x=1
+		done grep echo printf 'quoted text' cd | awk --verbose then local 2>/dev/null
+	local echo readonly readonly
+cd awk cd printf printf
+	awk then && local sed /usr/bin done grep readonly
+'quoted text' "$@" -eu grep sed "$1" done 'quoted text'
+done -eu ${HOME} 'quoted text' printf echo --verbose x=1 printf awk test readonly
+2>/dev/null ${HOME} "$1" test --verbose
+/usr/bin local then readonly 'quoted text' $(pwd) $(pwd) local printf sed $(pwd)
+	2>/dev/null cd /usr/bin 'quoted text' x=1
+		then printf then sed test | local test -eu test | then && awk |
+local 'quoted text' "$@" "$@" readonly done "$@" 2>/dev/null
+		then grep sed x=1 2>/dev/null printf awk done then $(pwd)
+	"$1" then awk -eu cd done x=1 "$1" awk then 'quoted text'
+	echo /usr/bin printf x=1 'quoted text' readonly done
+readonly cd done "$1" then "$@" printf $(pwd)
+	local /usr/bin printf echo grep "$@" x=1 "$1" grep readonly $(pwd) echo
+&& | readonly readonly echo 'quoted text' "$1"
+awk echo done cd x=1 printf echo /usr/bin grep awk "$@"
+awk printf done export awk sed sed done -eu then test
+	awk cd "$@" readonly then "$@" /usr/bin echo sed cd 2>/dev/null
+2>/dev/null awk 2>/dev/null readonly test
+	x=1 grep ${HOME} local
+		x=1 test --verbose done
+	"$@" cd | test x=1 'quoted text' local local 'quoted text' awk x=1 "$@" local
+		export local | done local export -eu readonly 2>/dev/null
+x=1 test readonly cd then export test $(pwd) x=1 cd awk /usr/bin /usr/bin
+	"$@" sed 'quoted text' grep done 'quoted text' -eu then done /usr/bin
+	echo /usr/bin local --verbose 'quoted text'
+"$1" then sed /usr/bin then | 'quoted text'
+		--verbose awk /usr/bin local sed cd export
+	grep sed && /usr/bin readonly local export
+	cd local test echo 2>/dev/null
+test then printf 'quoted text' export local /usr/bin x=1 | awk 2>/dev/null
+		x=1 ${HOME} cd echo local | local | 'quoted text' test
+done readonly 2>/dev/null
+	done "$1" --verbose printf 2>/dev/null
+grep readonly then awk local 'quoted text' test 'quoted text' && test -eu readonly
+		--verbose readonly then 2>/dev/null
+		--verbose cd 'quoted text' test ${HOME} ${HOME} sed cd 2>/dev/null export
+	--verbose local sed local
+		done -eu cd x=1 printf -eu $(pwd) | x=1 | printf export --verbose
+		local grep "$@" export "$@"
+-eu && | "$1" ${HOME} /usr/bin then 2>/dev/null
+		awk done $(pwd) readonly readonly -eu | && | echo /usr/bin readonly --verbose
+done /usr/bin cd done
+-eu /usr/bin 2>/dev/null && ${HOME}
+	local -eu "$1" 'quoted text' -eu "$@" printf 2>/dev/null 2>/dev/null x=1
+"$1" $(pwd) 2>/dev/null --verbose "$@" then
+		cd test -eu export && done
+	x=1 $(pwd) | then 2>/dev/null --verbose $(pwd) -eu awk test x=1 /usr/bin
+	then /usr/bin /usr/bin /usr/bin
+done 2>/dev/null x=1 then x=1
+		x=1 grep 2>/dev/null printf --verbose
+	$(pwd) echo then sed | readonly /usr/bin
+'quoted text' local | 'quoted text'
+	&& x=1 --verbose printf x=1 awk ${HOME} /usr/bin
+		'quoted text' test 'quoted text' /usr/bin x=1 | echo printf 'quoted text' 'quoted text'
+local /usr/bin readonly | sed sed done done grep then ${HOME} local
+2>/dev/null ${HOME} | "$1" x=1 awk | readonly
+		--verbose test --verbose echo
+2>/dev/null x=1 then --verbose
+"$1" local $(pwd) printf "$1" then --verbose
+--verbose | then done -eu echo -eu echo
+	/usr/bin x=1 echo test
+		local cd echo x=1 "$1"
+"$@" ${HOME} grep test readonly
+"$@" local --verbose export local then ${HOME} cd awk done
+readonly cd $(pwd) && "$1" --verbose "$1" grep | printf export "$1" --verbose
+		$(pwd) ${HOME} done printf
+	readonly test then "$@" local
+	'quoted text' readonly x=1 | done cd
+printf --verbose "$@" export echo | ${HOME}
+		printf x=1 $(pwd) then 2>/dev/null 2>/dev/null && "$@" -eu x=1
+'quoted text' sed readonly grep $(pwd) printf | readonly then
+echo ${HOME} ${HOME} 'quoted text' "$1" 2>/dev/null -eu
+		-eu /usr/bin cd awk "$@" 2>/dev/null echo cd "$@" ${HOME} -eu done /usr/bin | sed
+"$@" awk sed local cd ${HOME} cd "$@" "$1" /usr/bin /usr/bin |
+	export done --verbose ${HOME}
+		${HOME} cd ${HOME} /usr/bin && /usr/bin 'quoted text'
+		then readonly local | done -eu printf export | readonly "$@" sed | cd
+-eu $(pwd) export printf
+		echo && "$@" "$1" x=1 cd awk grep export export 2>/dev/null export /usr/bin
+	cd readonly printf -eu echo ${HOME} done readonly
+then ${HOME} ${HOME} -eu done echo /usr/bin
+"$@" $(pwd) /usr/bin export 'quoted text' grep echo
+	export x=1 readonly --verbose x=1 'quoted text' export
+"$@" "$@" echo --verbose $(pwd) 2>/dev/null printf readonly
+then "$1" "$1" done | local ${HOME} awk 'quoted text' then then | && export
+	2>/dev/null cd 2>/dev/null sed echo sed printf local export "$@"
+	-eu --verbose echo done cd local local
+'quoted text' awk && /usr/bin ${HOME}
+	grep echo echo ${HOME} /usr/bin
+	export then awk --verbose x=1 done -eu -eu done readonly
+		--verbose | export $(pwd) "$@" readonly $(pwd) $(pwd) readonly x=1 printf
+		local && grep 'quoted text' "$1" 'quoted text'
+done x=1 cd readonly test $(pwd) | "$1" "$@"
+echo && $(pwd) export local 'quoted text'
+test grep echo && --verbose then 2>/dev/null
+	--verbose ${HOME} cd cd
+		awk x=1 local readonly ${HOME} 2>/dev/null "$@" readonly printf 2>/dev/null
+export done readonly /usr/bin readonly "$@" grep done | | x=1 x=1
+	'quoted text' -eu | --verbose export $(pwd) printf sed --verbose awk test
+		'quoted text' /usr/bin "$@" --verbose export
+		&& export --verbose awk --verbose | done $(pwd) sed
+		x=1 ${HOME} awk sed 'quoted text' done -eu 2>/dev/null --verbose echo | | -eu
+	| | export echo ${HOME} readonly
+	'quoted text' /usr/bin -eu "$@" | "$@" grep export "$1" | --verbose printf x=1
+x=1 done local "$1" "$@" -eu /usr/bin
+done x=1 cd /usr/bin -eu test ${HOME} /usr/bin
+		"$@" readonly echo $(pwd) local test -eu local "$@" awk -eu
+		local cd readonly "$1" readonly
+	/usr/bin sed export awk /usr/bin done x=1 -eu export "$1" local
+	"$1" then then sed -eu "$@" --verbose cd -eu ${HOME} test /usr/bin
+grep x=1 cd done echo 'quoted text' $(pwd) sed
+		cd sed && "$@" /usr/bin x=1
+	'quoted text' echo done 2>/dev/null local cd
+		export 2>/dev/null readonly export /usr/bin -eu test grep /usr/bin done
+readonly ${HOME} --verbose "$1" -eu "$@"
+	done $(pwd) --verbose done sed "$1" echo -eu $(pwd) echo ${HOME}
+	"$@" echo && readonly ${HOME} $(pwd) $(pwd) echo printf
+	cd x=1 then test $(pwd) $(pwd) && | test
+		2>/dev/null | test awk export /usr/bin "$@" local then readonly done $(pwd)
+then printf echo 2>/dev/null printf "$@" --verbose printf && "$1"
+	/usr/bin && printf export "$1" cd grep test
+	awk | && x=1 | "$@" /usr/bin --verbose echo $(pwd) awk readonly -eu cd $(pwd) |
+	"$@" /usr/bin done | grep then x=1 then && sed 'quoted text'
+	then test done /usr/bin --verbose export echo readonly
+		awk $(pwd) -eu then | sed printf -eu grep $(pwd) $(pwd)
+cd done done | awk && test awk export
+grep "$1" export x=1 echo $(pwd) awk then | && ${HOME} export x=1 | $(pwd)
+${HOME} echo printf ${HOME} "$1" awk "$@" test --verbose test 'quoted text'
+	sed sed readonly && -eu grep /usr/bin cd sed printf export echo
+		"$1" grep "$@" readonly cd sed $(pwd) $(pwd) 'quoted text'
+x=1 cd 'quoted text' export --verbose grep
+2>/dev/null then local readonly test done $(pwd) cd "$@"
+2>/dev/null done x=1 done cd then echo -eu grep ${HOME} | -eu -eu ${HOME}
+	printf "$1" readonly grep /usr/bin done 2>/dev/null /usr/bin
+		readonly "$1" grep sed then "$1" export --verbose x=1 ${HOME} && readonly sed
+		/usr/bin grep "$@" x=1 done grep 2>/dev/null then test printf printf "$1"
+	--verbose | cd -eu sed "$@" export readonly
+	done x=1 cd 'quoted text' export printf test local 'quoted text'
+		x=1 export 2>/dev/null grep ${HOME} --verbose
+	--verbose echo printf && cd export --verbose sed echo "$1" x=1 grep cd
+2>/dev/null "$@" sed $(pwd) x=1 --verbose readonly printf
+		2>/dev/null -eu -eu -eu readonly --verbose export ${HOME} done
+		'quoted text' done | cd awk test printf then --verbose ${HOME} export
+"$@" echo export ${HOME} 2>/dev/null
+	$(pwd) "$1" sed readonly -eu --verbose readonly -eu x=1
+done -eu 'quoted text' echo /usr/bin
+	-eu test --verbose then echo | /usr/bin /usr/bin -eu local /usr/bin ${HOME}
+	readonly x=1 echo readonly readonly
+grep printf 'quoted text' local && "$@" printf cd printf local x=1 ${HOME}
+		'quoted text' -eu export test x=1 && --verbose "$@" -eu readonly sed cd cd
+	readonly && 2>/dev/null /usr/bin 'quoted text' --verbose
+export echo test printf $(pwd) 'quoted text'
+	--verbose local "$1" echo done awk
+"$@" x=1 'quoted text' $(pwd) 'quoted text' export export cd local $(pwd) ${HOME}
+		"$@" | "$1" && awk export
+		cd $(pwd) done | && x=1 printf readonly 'quoted text'
+		-eu -eu readonly printf /usr/bin awk printf printf
+		readonly "$@" 2>/dev/null --verbose
+| export /usr/bin "$1" local sed then "$1" ${HOME}
+"$@" done | awk echo x=1 sed echo export x=1 x=1 awk $(pwd) sed "$@" echo export
+	test done cd 2>/dev/null done grep /usr/bin && awk 2>/dev/null
+&& test done --verbose | then cd export -eu
+		"$1" && cd echo && readonly grep awk cd /usr/bin -eu x=1 done "$1" test
+		-eu 'quoted text' "$1" printf "$@" 'quoted text' printf
+	done grep awk 2>/dev/null done local && test /usr/bin | 'quoted text'
+then --verbose "$@" echo x=1 "$1" $(pwd) cd -eu export test cd -eu
+awk export "$1" 2>/dev/null -eu $(pwd) done /usr/bin /usr/bin 'quoted text'
+	printf 2>/dev/null local readonly
+	then $(pwd) awk sed cd local cd then printf $(pwd) cd --verbose test
+	then ${HOME} /usr/bin readonly /usr/bin readonly cd 2>/dev/null then |
+	x=1 ${HOME} sed "$1" | readonly export local local local grep x=1 -eu x=1
+done printf /usr/bin then
+	cd awk echo "$@" "$@" local 'quoted text' "$1" echo awk local cd then done
+echo 'quoted text' -eu | /usr/bin sed | test -eu export printf
+	-eu "$@" export 2>/dev/null $(pwd) ${HOME} x=1 export /usr/bin && export local
+		grep done grep local then /usr/bin 'quoted text' "$1" | | printf done
+		done -eu 2>/dev/null 'quoted text' export printf
+export "$1" -eu && $(pwd) readonly | $(pwd) ${HOME} export then readonly -eu |
+${HOME} then /usr/bin cd x=1 x=1 'quoted text' grep done /usr/bin local export x=1
+		/usr/bin awk /usr/bin export "$@" cd $(pwd) $(pwd)
+		"$@" --verbose awk done && then export /usr/bin $(pwd)
+'quoted text' ${HOME} && "$1"
+		echo 'quoted text' x=1 done local | test /usr/bin "$1" awk &&
+	done readonly awk done 2>/dev/null export
+grep -eu grep done cd &&
+		echo 'quoted text' ${HOME} awk && 'quoted text'
+		export cd && x=1 test grep readonly |
+	${HOME} awk -eu "$@" 'quoted text' && grep
+2>/dev/null echo $(pwd) printf
+		-eu done "$1" "$1" then -eu -eu | grep grep local grep |
+$(pwd) "$@" echo 'quoted text' && test printf && awk ${HOME} 'quoted text'
+	${HOME} grep echo $(pwd) "$1" ${HOME} $(pwd) done
+"$@" /usr/bin cd /usr/bin printf "$1" x=1 then done then then then awk -eu
+	2>/dev/null 'quoted text' awk done x=1 local readonly
+| awk grep then local readonly done done
+	grep local /usr/bin cd export $(pwd)
+'quoted text' echo printf grep 'quoted text'
+	awk sed -eu cd export 2>/dev/null cd readonly --verbose x=1 sed
+test $(pwd) done "$@" "$1" x=1 cd test --verbose 'quoted text'
+		echo "$1" done "$1" done echo grep 'quoted text' export
+		test awk "$@" done awk -eu cd 2>/dev/null | 2>/dev/null test "$1" printf
+		test /usr/bin "$@" awk x=1 sed && $(pwd) /usr/bin /usr/bin
+test done x=1 done test awk grep cd -eu then readonly readonly
+	readonly | && test then 2>/dev/null $(pwd) then -eu 2>/dev/null
+readonly x=1 | | --verbose printf cd &&
+		| -eu then cd then | readonly && 'quoted text'
+	cd ${HOME} local $(pwd) echo done && echo sed | done done -eu
+		awk --verbose test cd 2>/dev/null export readonly sed 2>/dev/null
+then test test "$@" printf then printf 2>/dev/null
+		then done local echo local grep "$1" --verbose printf then
+		done ${HOME} --verbose
+	sed ${HOME} readonly done x=1 $(pwd) local test --verbose export $(pwd) && /usr/bin
+&& test "$@" awk 2>/dev/null && echo awk test | ${HOME} echo printf
+		export 'quoted text' $(pwd) --verbose
+		-eu export done sed $(pwd)
+/usr/bin $(pwd) printf 'quoted text' | --verbose
+sed -eu sed && && | done | "$1" "$@" cd cd && "$@" then export
+awk readonly awk $(pwd) printf $(pwd) && printf "$1" local 2>/dev/null
+test "$1" /usr/bin x=1 then 'quoted text' cd "$1" sed
+	test test test echo done test
+	-eu --verbose grep local "$@"
+awk 2>/dev/null --verbose -eu /usr/bin
+| test ${HOME} x=1 readonly -eu awk cd && test && --verbose test
+export readonly && 2>/dev/null --verbose 'quoted text' 'quoted text' -eu test done
+2>/dev/null grep printf echo | echo
+	--verbose then $(pwd)
+	echo ${HOME} -eu x=1 readonly "$1" | ${HOME} readonly "$1" 2>/dev/null -eu
+awk ${HOME} cd done "$@" -eu grep
+	export && grep awk grep $(pwd) -eu awk "$1" x=1 done "$@" "$@" cd test ${HOME}
+		cd /usr/bin && readonly x=1 cd "$1" | $(pwd)
+	-eu /usr/bin cd local 'quoted text' echo readonly readonly
+		${HOME} /usr/bin $(pwd) "$1"
+		done $(pwd) echo -eu test 2>/dev/null echo awk $(pwd) x=1
+		done | test --verbose printf export -eu
+export echo x=1 done "$@"
+		/usr/bin 2>/dev/null awk awk && echo
+		grep -eu cd /usr/bin export printf cd && && then sed ${HOME}
+2>/dev/null cd x=1 "$@" readonly x=1 'quoted text' 2>/dev/null
+		sed cd export echo ${HOME}
+	local && /usr/bin 'quoted text' 2>/dev/null 'quoted text'
+&& $(pwd) "$@" -eu $(pwd)
+cd ${HOME} sed readonly
+		printf readonly "$1" "$@"
+		--verbose test /usr/bin cd /usr/bin /usr/bin
+		2>/dev/null export awk -eu awk printf
+		printf sed ${HOME} ${HOME} && local
+		--verbose then -eu printf && echo ${HOME} x=1 echo printf cd "$1" printf $(pwd)
+"$@" local export "$@" export
+${HOME} readonly -eu test then
+		-eu --verbose ${HOME} --verbose -eu
+-eu 'quoted text' | sed "$1" --verbose -eu "$@" ${HOME} readonly
+${HOME} sed grep $(pwd) | $(pwd) --verbose "$1" test 2>/dev/null test done
+--verbose cd -eu readonly awk --verbose
+sed cd grep sed 2>/dev/null grep printf local "$@" awk
+	/usr/bin 'quoted text' sed test | $(pwd) printf x=1 test
+test | local 2>/dev/null
+--verbose readonly sed echo local local "$@" local echo
+	local grep $(pwd) ${HOME} sed "$1" then "$1" export
+		$(pwd) grep test printf $(pwd) readonly
+| echo $(pwd) --verbose cd 'quoted text'
+		echo done readonly $(pwd) ${HOME} /usr/bin local 2>/dev/null "$1" --verbose ${HOME}
+		printf ${HOME} cd awk export
+	then 2>/dev/null ${HOME} readonly x=1 test then then /usr/bin
+-eu echo printf "$1" grep awk
+		export "$1" cd | grep "$1" echo | -eu && printf | 2>/dev/null -eu cd
+	done grep grep local local echo --verbose grep
+	readonly then echo export
+	${HOME} cd $(pwd) "$@" cd test
+| $(pwd) done grep 2>/dev/null printf printf test cd 2>/dev/null local $(pwd)
+	"$1" -eu /usr/bin printf done --verbose export done "$@" cd export
+	sed sed echo --verbose local grep 'quoted text'
+cd done printf --verbose cd then done /usr/bin
+		"$@" printf readonly && 'quoted text' $(pwd) done cd $(pwd) sed sed
+	printf awk test grep x=1 x=1 test readonly
+"$1" readonly x=1 export 'quoted text'
+		"$1" sed $(pwd) | --verbose done x=1 && ${HOME} ${HOME} cd cd awk
+	local -eu $(pwd) local | "$1" readonly echo then && grep cd grep printf $(pwd)
+	--verbose && awk then awk awk
+echo && readonly export awk export then -eu then local -eu $(pwd) && -eu local
+grep | test && x=1 --verbose | then 'quoted text' readonly
+	grep readonly then $(pwd)
+	$(pwd) ${HOME} /usr/bin awk then printf readonly
+		local test 'quoted text' echo readonly test cd awk "$@" export
+	readonly 'quoted text' done "$1" cd cd awk done local x=1 | cd && /usr/bin
+$(pwd) && | done cd export
+--verbose readonly x=1 ${HOME} "$@"
+then "$@" cd local $(pwd)
+	'quoted text' export done ${HOME} x=1 /usr/bin readonly
+	awk sed echo done awk cd 'quoted text' printf test "$@"
+"$@" export local printf
+'quoted text' export 2>/dev/null cd awk grep local x=1 sed local x=1 sed cd x=1
+sed sed local | "$@" /usr/bin
+	"$@" | grep grep echo &&
+x=1 readonly && grep sed cd $(pwd) echo
+		export sed 'quoted text' ${HOME} ${HOME} then
+		export sed /usr/bin readonly
+	test /usr/bin local "$@" && "$1" test readonly --verbose
+		printf && test /usr/bin test printf local export "$1" 'quoted text' test "$1"
+	awk cd /usr/bin printf test -eu /usr/bin --verbose echo
+	$(pwd) local awk sed done printf then 2>/dev/null printf $(pwd) awk
+2>/dev/null local ${HOME} test "$@" then grep $(pwd) echo done then then local
+	/usr/bin "$@" printf done local "$@" grep echo /usr/bin "$1" test cd "$@"
+local 2>/dev/null "$@" printf "$@" $(pwd) export x=1 "$@" |
+		printf $(pwd) "$1" sed echo printf export "$@" | local
+		then local && awk printf awk printf sed -eu export /usr/bin
+| local awk 2>/dev/null then done cd grep printf
+	/usr/bin printf sed done grep ${HOME} printf echo echo /usr/bin
+	test 2>/dev/null readonly test x=1 cd done awk test local
+	| x=1 --verbose test awk /usr/bin export local readonly --verbose awk then 'quoted text'
+/usr/bin echo /usr/bin | then
+	"$@" done done sed -eu done cd local && readonly -eu 2>/dev/null
+	${HOME} --verbose local echo cd printf local x=1 2>/dev/null 'quoted text'
+echo cd done "$1" --verbose "$1" ${HOME} readonly export then 2>/dev/null x=1 export
+	'quoted text' local ${HOME} awk export | x=1 then 'quoted text' | 'quoted text'
+x=1 cd | cd grep 'quoted text' done 2>/dev/null 'quoted text' export
+	grep done && $(pwd) awk cd awk done x=1 echo cd ${HOME} sed printf "$1" x=1 2>/dev/null
+		"$@" done local test | --verbose $(pwd) local
+		awk x=1 ${HOME} 'quoted text' "$1" readonly "$@" printf printf echo "$@" x=1 grep
+done "$@" printf x=1 && cd done ${HOME} 2>/dev/null
+echo export x=1 $(pwd) --verbose sed export done awk
+	grep local cd then 2>/dev/null 2>/dev/null echo export 'quoted text'
+printf export "$1" done awk readonly awk grep
+test -eu readonly readonly
+	readonly test ${HOME} then "$@" 2>/dev/null
+	sed cd x=1 "$1" then
+		test printf grep $(pwd) local
+		done printf | grep -eu test | export test "$1" cd "$@" |
+	grep && && "$@" grep -eu done --verbose $(pwd) awk "$@" readonly
+	export awk grep $(pwd) $(pwd) readonly x=1 /usr/bin 'quoted text' 2>/dev/null
+	printf | readonly 2>/dev/null printf -eu test echo --verbose
+	local && "$1" printf local && "$@"
+	local then 2>/dev/null --verbose
+	readonly 2>/dev/null grep $(pwd) sed -eu readonly -eu $(pwd)
+		${HOME} 'quoted text' "$1" local ${HOME} 2>/dev/null
+	&& /usr/bin export && grep | -eu -eu -eu readonly /usr/bin x=1 readonly
+	${HOME} $(pwd) export cd $(pwd) done cd 2>/dev/null
+	"$1" sed local printf export cd
+	| && 2>/dev/null $(pwd) --verbose
+		cd readonly 2>/dev/null echo
+	/usr/bin grep cd ${HOME} echo printf && local
+| "$1" -eu --verbose cd readonly ${HOME} sed local -eu awk echo -eu -eu local
+	then "$1" /usr/bin done -eu then 2>/dev/null then && readonly
+sed -eu 'quoted text' 2>/dev/null
+cd 2>/dev/null --verbose sed | "$@" "$1" readonly
+		printf ${HOME} local local local |
+	/usr/bin $(pwd) && && cd printf cd && /usr/bin $(pwd)
+readonly cd ${HOME} 2>/dev/null then awk --verbose readonly awk readonly
+done x=1 | ${HOME} && sed cd -eu export | then local
+	&& /usr/bin printf "$1" 2>/dev/null && test readonly then $(pwd)
+	| cd echo local --verbose readonly printf x=1 awk
+	cd /usr/bin local sed $(pwd) ${HOME} -eu done -eu -eu echo -eu
+sed ${HOME} readonly "$@" 'quoted text' grep $(pwd) $(pwd) cd
+${HOME} -eu ${HOME} cd "$1" printf export
+	done test "$1" -eu /usr/bin "$1"
+sed "$1" readonly "$1" grep grep printf --verbose cd printf "$1" ${HOME}
+	then ${HOME} 'quoted text' readonly
+'quoted text' awk "$1"
+		cd printf export test test "$1" cd printf readonly grep $(pwd)
+	cd ${HOME} ${HOME} -eu && x=1 sed 'quoted text' 'quoted text' readonly --verbose
+	--verbose -eu -eu printf --verbose -eu
+	local ${HOME} test && done sed -eu --verbose | then printf export done
+	export test printf -eu sed cd "$@" "$@" /usr/bin | printf x=1 |
+"$@" then then readonly 'quoted text' x=1 -eu done 2>/dev/null "$1" "$1" --verbose
+| "$1" "$1" echo done echo /usr/bin | -eu /usr/bin then --verbose
+		awk test -eu | 2>/dev/null | x=1 | sed
+'quoted text' -eu done x=1 --verbose $(pwd) awk x=1 then grep
+-eu $(pwd) --verbose ${HOME} cd $(pwd) 'quoted text'
+		done export /usr/bin 2>/dev/null
+	sed ${HOME} done 2>/dev/null readonly --verbose ${HOME} 2>/dev/null local
+echo "$@" awk printf then echo -eu
+	x=1 $(pwd) "$1" && "$@" sed -eu
+then echo && echo echo -eu x=1 "$@" | $(pwd) 'quoted text'
+$(pwd) echo grep cd | awk | -eu printf
+	test "$1" ${HOME} x=1 --verbose 2>/dev/null
+	local readonly sed -eu -eu grep printf
+		awk awk -eu "$@" /usr/bin /usr/bin -eu cd done awk cd done
+	local $(pwd) --verbose printf test
+		2>/dev/null && --verbose | local grep sed
+done /usr/bin | then "$@" grep awk --verbose echo echo then 'quoted text'
+&& "$1" readonly 2>/dev/null
+${HOME} cd 'quoted text' /usr/bin grep awk ${HOME} readonly
+	$(pwd) grep readonly then
+		--verbose -eu readonly printf /usr/bin -eu && $(pwd) /usr/bin
+	2>/dev/null -eu awk readonly awk 2>/dev/null -eu printf done "$1" 2>/dev/null
+	sed grep readonly cd test done test sed printf local done 'quoted text'
+	cd /usr/bin /usr/bin 'quoted text' printf
+	&& then cd $(pwd) "$@" --verbose $(pwd) 2>/dev/null $(pwd) --verbose
+	'quoted text' ${HOME} local
+	printf | -eu x=1 $(pwd) --verbose && printf sed done /usr/bin
+	| x=1 grep readonly 'quoted text' sed readonly x=1 awk
+		2>/dev/null export echo x=1 -eu $(pwd)
+	export && ${HOME} grep local "$@" && done x=1 cd $(pwd) awk then --verbose done
+		printf $(pwd) 2>/dev/null 2>/dev/null $(pwd)
+readonly awk | "$1" done grep export grep local grep
+	-eu --verbose then printf echo awk done local grep sed
+	/usr/bin "$@" echo /usr/bin -eu test grep x=1 x=1 echo
+		2>/dev/null export "$1" cd "$1" ${HOME} cd
+done grep "$@" cd --verbose awk /usr/bin /usr/bin
+	cd "$1" sed cd x=1 'quoted text' done /usr/bin local
+	| grep ${HOME} x=1 echo | "$@" "$@" ${HOME} cd readonly
+| --verbose test --verbose
+	${HOME} test readonly x=1 'quoted text' 'quoted text' local | done then
+	awk grep $(pwd) --verbose x=1 printf grep local readonly /usr/bin --verbose
+	$(pwd) 2>/dev/null echo "$@" "$@" export | grep /usr/bin
+cd "$@" "$1" $(pwd) cd printf
+"$1" --verbose --verbose && $(pwd) readonly
+		"$1" local "$1" export awk export grep
+done echo "$@" local readonly test ${HOME} echo 'quoted text' --verbose
+	--verbose --verbose 'quoted text' export | local done cd
+2>/dev/null echo -eu /usr/bin
+sed readonly test | export
+	echo grep -eu 2>/dev/null && | done local done
+		/usr/bin && printf export
+	&& && ${HOME} grep 'quoted text'
+	-eu then cd done sed "$1" local
+		2>/dev/null -eu grep "$@" | then export then 'quoted text' $(pwd) -eu $(pwd) readonly
+	x=1 -eu echo --verbose "$@" ${HOME} 2>/dev/null
+		--verbose x=1 --verbose && -eu printf readonly export echo local 2>/dev/null &&
+	'quoted text' readonly | x=1 ${HOME} "$1" local 'quoted text' readonly
+		cd echo | done then grep --verbose ${HOME} export "$@"
+readonly readonly ${HOME} -eu "$@" grep "$@" echo 'quoted text' && "$1" test
+"$1" test then -eu --verbose /usr/bin x=1 2>/dev/null
+grep sed readonly | sed && grep export cd printf
+	then grep grep printf sed /usr/bin /usr/bin | -eu sed
+		&& grep test done export $(pwd) awk --verbose export
+	awk -eu 'quoted text' printf echo grep && echo x=1 sed -eu grep /usr/bin
+	test --verbose local export export cd printf
+x=1 grep 2>/dev/null printf then --verbose cd then echo echo "$@" --verbose
+	&& 2>/dev/null then done
+$(pwd) cd 2>/dev/null readonly export /usr/bin test cd grep readonly export
+printf x=1 "$1" /usr/bin --verbose "$@" awk 2>/dev/null "$1"
+		"$1" sed sed --verbose --verbose --verbose --verbose then && awk | cd ${HOME}
+awk echo sed 'quoted text' grep ${HOME} readonly printf $(pwd)
+	test -eu "$@" test local
+		| | done awk "$@" --verbose ${HOME} -eu | "$1" sed && printf local
+		test grep $(pwd) -eu echo 2>/dev/null x=1 'quoted text'
+		--verbose cd awk --verbose printf grep awk
+		printf done printf $(pwd) echo grep x=1 sed
+done awk 2>/dev/null --verbose
+	&& awk done done printf then
+	--verbose export 2>/dev/null sed ${HOME}
+		-eu echo "$1" sed local
+'quoted text' 2>/dev/null 'quoted text'
+${HOME} "$1" grep echo local $(pwd) -eu readonly test cd done then | "$1"
+	sed export echo "$1" $(pwd)
+	readonly 'quoted text' export then 'quoted text'
+"$1" printf "$1" && 'quoted text'
+	then echo 'quoted text' readonly "$@" sed $(pwd) done grep
+awk awk /usr/bin then done local x=1 sed
+export && test && && ${HOME} grep /usr/bin awk cd 'quoted text'
+| local | readonly sed | export $(pwd) done
+		local -eu export "$@" printf 'quoted text' readonly --verbose "$@" /usr/bin
+'quoted text' printf awk x=1 echo -eu
+	"$@" ${HOME} export cd printf x=1 export
+$(pwd) 2>/dev/null "$@" | awk --verbose sed |
+grep grep "$1" grep awk ${HOME} -eu echo done ${HOME}
+	echo $(pwd) then && "$@" 2>/dev/null sed echo done
+		echo "$1" local export
+		test "$@" test echo printf echo
+		${HOME} test 2>/dev/null $(pwd) echo grep test /usr/bin cd echo
+	"$1" && echo cd then local
+		printf test printf cd cd
+grep awk -eu echo ${HOME} | -eu && /usr/bin test | awk
+local sed sed export "$1"
+	test --verbose 2>/dev/null sed "$@" readonly echo then sed $(pwd) done &&
+		| $(pwd) 2>/dev/null then echo local test --verbose
+		awk | /usr/bin grep && | awk echo --verbose x=1
+		printf ${HOME} then 'quoted text' grep "$1" "$1" $(pwd) echo local
+local x=1 then 'quoted text' -eu test "$1" then echo awk -eu readonly && cd local
+		printf cd | printf -eu && then readonly && 'quoted text' | awk && echo printf
+"$1" "$1" cd readonly "$@" local "$1" cd awk && ${HOME} grep
+cd done --verbose "$1" -eu then readonly sed 'quoted text' "$@" sed
+		${HOME} local done --verbose sed
+		then ${HOME} sed done local sed test cd then /usr/bin
+	done $(pwd) export echo grep test export grep readonly ${HOME}
+		/usr/bin | sed $(pwd) x=1 done local ${HOME} done sed /usr/bin
+		echo "$1" $(pwd) grep 'quoted text' local readonly $(pwd) awk awk sed 'quoted text'
+${HOME} readonly done then
+${HOME} awk grep --verbose cd local -eu then 2>/dev/null "$1" test
+| local "$@" $(pwd) grep --verbose x=1 --verbose
+		cd sed x=1 awk x=1 awk awk $(pwd) "$1" readonly cd then
+printf readonly sed echo
+"$1" cd $(pwd) export x=1 $(pwd) "$1"
+"$@" && export done sed && && "$1" /usr/bin 'quoted text' ${HOME}
+	| | x=1 "$@" -eu then printf awk printf echo "$1"
+export ${HOME} printf cd && 'quoted text' -eu cd done | test readonly
+		readonly then sed 2>/dev/null then printf done export test local
+		cd test echo sed 'quoted text' | done echo $(pwd) "$1"
+cd echo done done local $(pwd) cd && |
+	"$@" "$@" test "$@" then awk cd sed ${HOME} test cd "$1" &&
+test $(pwd) done cd export --verbose cd printf printf awk then "$1" export awk
+echo then awk -eu 'quoted text' | --verbose "$1" cd | then ${HOME} "$@"
+		readonly "$@" "$@" "$@" echo $(pwd) -eu
+		/usr/bin "$@" 'quoted text' echo
+"$1" then echo | echo local local && export
+		| printf && $(pwd) ${HOME}
+		echo printf printf local grep awk "$@" then awk --verbose
+		sed test export && export x=1 x=1 "$1" done
+	"$1" echo 2>/dev/null test /usr/bin x=1 done -eu test local readonly sed grep
+		'quoted text' 2>/dev/null done then -eu && echo
+	printf printf readonly test printf printf echo echo 2>/dev/null --verbose done
+	done | done -eu printf printf printf "$@" sed x=1 --verbose x=1 awk grep awk
+	"$1" export test export export echo 2>/dev/null
+then "$1" readonly then awk awk printf cd "$@"
+		&& | readonly echo awk then export /usr/bin grep done 'quoted text' ${HOME}
+awk | done sed export done test echo echo local "$@" $(pwd)
+	local --verbose $(pwd) echo "$1" export
+'quoted text' test then readonly ${HOME} 2>/dev/null
+		cd done "$@" -eu echo /usr/bin
+		2>/dev/null local local 2>/dev/null
+		| echo "$@" -eu 2>/dev/null
+		test sed 2>/dev/null && | && x=1 cd awk sed ${HOME} x=1
+&& local then 2>/dev/null
+awk ${HOME} readonly /usr/bin -eu sed && sed echo -eu sed printf local sed /usr/bin
+		$(pwd) "$@" 2>/dev/null /usr/bin local done && "$1" test then /usr/bin done |
+		printf $(pwd) /usr/bin /usr/bin && readonly
+"$1" 2>/dev/null $(pwd) cd done 'quoted text' ${HOME} 2>/dev/null
+x=1 $(pwd) && sed printf then readonly awk then local sed
+	-eu $(pwd) local $(pwd) x=1 "$@"
+	2>/dev/null && 'quoted text' x=1 echo | && "$1"
+then --verbose local printf | $(pwd) local 2>/dev/null
+export "$@" local echo sed | 'quoted text'
+		--verbose 'quoted text' echo
+		--verbose cd && cd --verbose
+	| "$@" ${HOME} test /usr/bin "$@" "$1" ${HOME} /usr/bin ${HOME} "$1" "$@" echo
+		done sed sed sed ${HOME} grep sed 'quoted text' awk echo then cd grep sed test
+		printf awk done 'quoted text' | ${HOME} then $(pwd) export sed grep then cd $(pwd)
+then local grep | done 'quoted text' && sed grep awk sed x=1 then printf -eu
+		then local test done ${HOME} "$1" done 2>/dev/null
+	$(pwd) "$@" 2>/dev/null "$@" && x=1 grep then done readonly grep
+	&& cd local -eu printf ${HOME} "$@"
+		"$1" readonly x=1 --verbose cd "$@" printf sed "$1" local echo
+local readonly awk $(pwd) readonly && --verbose ${HOME} -eu grep printf
+	'quoted text' export | done awk export
+	export ${HOME} grep awk test sed test done test 'quoted text' export
+	printf /usr/bin ${HOME} then
+test echo ${HOME} 2>/dev/null x=1 "$@" 2>/dev/null
+		$(pwd) -eu /usr/bin grep | readonly
+&& export | /usr/bin local ${HOME} grep done awk
+x=1 "$@" && /usr/bin 'quoted text' done 'quoted text' ${HOME}
+		/usr/bin /usr/bin export && ${HOME} sed -eu x=1 | grep done
+	readonly --verbose echo then local done 2>/dev/null x=1 | local sed awk
+		local --verbose awk 2>/dev/null export cd x=1 "$@"
+		'quoted text' local -eu export local then grep -eu | /usr/bin --verbose cd printf
+awk | ${HOME} x=1 grep
+		2>/dev/null done sed --verbose test
+		test local test cd --verbose --verbose
+	cd "$1" /usr/bin && awk echo | --verbose test awk 'quoted text'
+		sed echo cd /usr/bin --verbose
+--verbose sed ${HOME} ${HOME} $(pwd) 'quoted text'
+		sed "$1" awk "$1" "$1" | readonly "$@" readonly
+export then grep cd "$1" $(pwd) test --verbose
+	echo test $(pwd) "$@" && grep cd x=1 "$@" x=1 cd cd
+done "$@" echo -eu awk 'quoted text' local printf | sed grep /usr/bin cd grep then
+	${HOME} "$@" export local 'quoted text' "$1"
+	then /usr/bin awk && "$@" ${HOME} done "$@" $(pwd) ${HOME}
+	then test --verbose "$1" done -eu /usr/bin -eu local
+-eu echo export done -eu /usr/bin $(pwd)
+cd ${HOME} local sed "$1" --verbose $(pwd) test --verbose
+		printf ${HOME} grep cd test "$1"
+		-eu /usr/bin done grep export then x=1 /usr/bin
+		--verbose test "$@" echo "$1" ${HOME} done echo printf
+		--verbose 'quoted text' grep cd "$@" $(pwd)
+		local printf | awk printf sed "$1" 2>/dev/null awk
+--verbose readonly export awk then "$@" then "$1" echo cd grep grep export
+		2>/dev/null -eu "$1" 2>/dev/null then | done --verbose test $(pwd) && 2>/dev/null
+sed readonly ${HOME} sed cd local local then done -eu && cd readonly sed -eu readonly
+x=1 test && echo | 2>/dev/null sed /usr/bin
+awk $(pwd) then sed -eu cd echo readonly
+		-eu -eu local cd /usr/bin 2>/dev/null export cd
+		-eu "$1" "$1" && cd grep /usr/bin then /usr/bin
+	&& test && local local | "$1" test 2>/dev/null
+test then awk then sed -eu --verbose echo x=1 'quoted text' test readonly
+		awk 2>/dev/null local local x=1 "$@" local 2>/dev/null echo 2>/dev/null
+		${HOME} test grep done cd $(pwd) ${HOME} printf grep cd && printf done readonly
+done cd done "$1" echo ${HOME} /usr/bin
+	2>/dev/null awk ${HOME} 'quoted text' $(pwd) "$1" sed && awk echo
+echo 2>/dev/null && then cd export -eu test | 2>/dev/null
+		--verbose readonly 2>/dev/null export sed echo sed ${HOME} && 2>/dev/null 2>/dev/null
+	then echo echo done printf grep "$@"
+${HOME} printf test /usr/bin
+		"$1" export "$@" done 2>/dev/null export -eu "$1" done ${HOME} echo 'quoted text'
+		-eu -eu awk test ${HOME} cd sed "$1" 2>/dev/null
+	echo --verbose done 'quoted text'
+		--verbose echo "$1" /usr/bin local ${HOME}
+		local -eu | export readonly then | /usr/bin local done export
+"$@" "$1" then done "$1" ${HOME} sed 2>/dev/null -eu "$1" ${HOME} "$1" cd
+		--verbose 'quoted text' x=1 'quoted text' --verbose export
+		echo -eu --verbose 2>/dev/null "$1" x=1 cd grep
+		-eu awk ${HOME} test awk | /usr/bin awk cd --verbose "$1" export --verbose
+	local ${HOME} "$@" --verbose test awk 2>/dev/null done "$1"
+	&& 'quoted text' /usr/bin -eu awk
+	/usr/bin ${HOME} then | then test 2>/dev/null 2>/dev/null
+	local local && test && "$1" 'quoted text'
+		--verbose awk grep echo -eu x=1 /usr/bin
+/usr/bin cd done -eu x=1 && then |
+	$(pwd) ${HOME} sed -eu "$@" --verbose --verbose
+$(pwd) export awk "$1" done
+		${HOME} then | ${HOME} cd then "$@" done 2>/dev/null /usr/bin | | 'quoted text'
+		printf 2>/dev/null -eu | printf
+		/usr/bin 'quoted text' ${HOME} x=1
+		'quoted text' ${HOME} 'quoted text' grep "$@" 2>/dev/null grep
+&& -eu export "$@" "$@" -eu 2>/dev/null test then --verbose sed --verbose
+/usr/bin printf cd $(pwd) 'quoted text' $(pwd) readonly -eu 2>/dev/null grep
+	'quoted text' then awk 'quoted text'
+"$@" done | 2>/dev/null 2>/dev/null
+		cd export export | "$1" ${HOME} grep awk "$1"
+		"$@" then done | "$1" echo -eu --verbose sed printf done awk "$@"
+	printf test 2>/dev/null $(pwd) && &&
+	cd then "$1" x=1 "$1" /usr/bin -eu grep printf sed printf
+/usr/bin readonly && "$1" /usr/bin export "$1" echo
+		"$1" $(pwd) 2>/dev/null done local 'quoted text'
+	local test sed then --verbose
+done done local printf printf test local /usr/bin export readonly $(pwd) readonly
+	&& && sed --verbose 2>/dev/null done 'quoted text' x=1 export ${HOME} done printf
+		export -eu | --verbose echo printf --verbose
+		$(pwd) sed x=1 2>/dev/null 2>/dev/null 'quoted text'
+	readonly then x=1 echo x=1 && $(pwd) 'quoted text'
+		sed 2>/dev/null awk ${HOME} printf cd printf then 2>/dev/null printf cd x=1 "$1"
+		sed -eu export --verbose $(pwd) test --verbose | done "$1" then echo
+		sed ${HOME} x=1 | --verbose ${HOME} 2>/dev/null
+		test --verbose "$1" "$1" $(pwd) printf then then cd /usr/bin sed && | export
+sed /usr/bin -eu test -eu "$1" "$@" awk --verbose
+	2>/dev/null cd grep export grep 2>/dev/null echo printf ${HOME}
+	x=1 done x=1 then awk export ${HOME}
+-eu | then test 2>/dev/null printf $(pwd) | -eu 'quoted text'
+	grep -eu $(pwd) 'quoted text' printf readonly
+		$(pwd) 'quoted text' "$1"
+	local x=1 /usr/bin "$@" done /usr/bin && -eu
+		x=1 $(pwd) awk ${HOME} local grep | printf | sed awk echo "$@" &&
+awk done printf 'quoted text' readonly sed 2>/dev/null grep
+	| test --verbose 2>/dev/null | -eu --verbose awk local | x=1 x=1
+		"$@" x=1 "$1" && readonly grep x=1 export && then
+		sed readonly | done test 2>/dev/null 'quoted text' echo
+		then /usr/bin x=1 sed /usr/bin readonly test x=1 ${HOME} then
+		| $(pwd) 2>/dev/null x=1 | awk test x=1 ${HOME} $(pwd) grep 'quoted text'
+		-eu readonly "$1" ${HOME} | -eu /usr/bin echo
+	grep readonly && ${HOME} 'quoted text' | then grep "$@" -eu
+then --verbose echo /usr/bin printf then test | done grep done | local echo -eu
+	readonly awk then printf && then &&
+	export printf | awk then then && 2>/dev/null "$1" $(pwd) 2>/dev/null x=1
+x=1 printf "$@" 'quoted text' cd --verbose 2>/dev/null test 2>/dev/null test
+&& export sed grep local local "$@" -eu cd awk readonly --verbose export
+		/usr/bin "$1" | echo ${HOME} readonly printf echo | && readonly done -eu
+export /usr/bin -eu $(pwd) test --verbose
+echo ${HOME} 'quoted text' grep awk
+	printf | grep sed printf export test test | /usr/bin 2>/dev/null
+		echo sed --verbose then readonly
+-eu $(pwd) | readonly readonly printf then export
+		export "$1" && readonly echo "$1" local "$@" --verbose 2>/dev/null then "$1"
+"$1" "$@" 2>/dev/null && then --verbose 'quoted text' printf then
+		export $(pwd) 'quoted text' test sed printf $(pwd) 'quoted text' readonly
+	done && 2>/dev/null 'quoted text' export sed test 'quoted text' | "$@" $(pwd)
+		-eu -eu $(pwd) readonly "$@" $(pwd) then
+		then export grep readonly export printf echo awk
+		test "$@" ${HOME} awk "$1" 2>/dev/null
+printf && readonly 'quoted text' --verbose cd awk x=1 awk $(pwd) /usr/bin
+"$1" 2>/dev/null readonly then "$1"
+		test && sed grep grep cd readonly $(pwd) --verbose export
+	printf | x=1 local readonly
+cd export local then readonly
+		done 2>/dev/null cd ${HOME} /usr/bin ${HOME} export $(pwd)
+	--verbose --verbose | cd 'quoted text' export 'quoted text'
+		| /usr/bin echo cd readonly printf 'quoted text'
+	readonly then x=1 cd sed local
+then then sed -eu local
+	${HOME} cd cd local -eu x=1 /usr/bin echo
+		printf $(pwd) "$1" readonly "$1" 'quoted text' && local ${HOME}
+"$@" sed export x=1 "$@" test cd awk 'quoted text' x=1 then /usr/bin
+2>/dev/null grep echo $(pwd) grep
+		${HOME} -eu -eu local readonly -eu sed
+awk && printf --verbose cd -eu test && export then 'quoted text' then readonly awk
+	export ${HOME} test -eu echo && "$@" | ${HOME} cd cd echo
+local echo test "$1" 2>/dev/null sed printf "$@" -eu
+export 'quoted text' cd -eu local cd awk
+		"$1" -eu x=1 'quoted text' export grep local grep printf
+	readonly /usr/bin | "$@" --verbose $(pwd)
+		export --verbose echo 'quoted text' 'quoted text' grep printf | echo x=1 &&
+	2>/dev/null 2>/dev/null | echo -eu && local printf printf done
+	awk ${HOME} 2>/dev/null readonly printf
+		readonly test "$@" grep x=1 printf 'quoted text' "$1" then awk
+		-eu grep 2>/dev/null --verbose then grep
+	/usr/bin done grep --verbose
+--verbose awk local readonly test grep | 'quoted text'
+#include c52.sh
+		--verbose local 2>/dev/null
+	printf "$1" --verbose $(pwd) export
+then "$@" --verbose test --verbose test 2>/dev/null sed test --verbose | /usr/bin
+${HOME} export test grep
+		export "$1" test x=1 $(pwd) "$1" "$@" --verbose
+	/usr/bin 'quoted text' 'quoted text' export $(pwd) readonly
+		x=1 "$1" && grep "$1" printf test
+then "$1" --verbose 'quoted text' && test echo awk ${HOME} 2>/dev/null done
+		&& readonly local 2>/dev/null cd echo /usr/bin local sed --verbose
+awk | | "$1" $(pwd) awk test /usr/bin --verbose && | "$1" 2>/dev/null
+		readonly -eu 'quoted text' sed readonly /usr/bin
+	awk && grep $(pwd) ${HOME} then x=1 awk -eu "$@" "$1" printf "$1" sed
+	echo $(pwd) ${HOME} local x=1 | && done 'quoted text' x=1
+echo cd x=1 grep grep export 'quoted text'
+export test test cd then grep $(pwd)
+"$1" export awk printf $(pwd) printf awk x=1 --verbose
+		-eu -eu -eu | "$1" done "$@" sed && awk x=1 echo x=1 'quoted text' 2>/dev/null
+	done cd $(pwd) done awk ${HOME} --verbose sed
+		local 2>/dev/null done ${HOME} 2>/dev/null
+	/usr/bin grep /usr/bin test /usr/bin echo printf done printf export
+--verbose then -eu | --verbose
+	export cd export && /usr/bin export grep echo &&
+echo then $(pwd) 2>/dev/null readonly echo
+		done readonly 'quoted text'
+done x=1 done && echo test then test
+grep | awk 'quoted text' 'quoted text' sed then
+	-eu x=1 cd x=1 /usr/bin 'quoted text' 'quoted text' | awk
+	awk "$@" 2>/dev/null export then "$1"
+		&& "$1" test 'quoted text' --verbose awk echo readonly ${HOME} cd grep /usr/bin
+		/usr/bin | | "$1" --verbose 2>/dev/null printf echo then
+then readonly | /usr/bin ${HOME} awk "$@" then "$@"
+2>/dev/null "$@" --verbose x=1
+		${HOME} -eu --verbose x=1 sed printf &&
+		awk readonly --verbose export 'quoted text' grep "$1"
+	readonly printf readonly
+	x=1 grep ${HOME} done 2>/dev/null
+| 'quoted text' | "$@"
+	${HOME} then then done
+		printf cd printf grep local
+&& grep && sed "$1" "$1" local printf x=1 ${HOME} x=1 && cd readonly
+-eu awk test x=1 sed ${HOME} cd && awk cd
+		"$1" test | export "$1" local $(pwd) readonly
+		'quoted text' | | printf x=1 --verbose sed ${HOME} -eu ${HOME} x=1
+	echo then "$@" /usr/bin 'quoted text' && cd "$1" "$1" grep readonly | "$1"
+&& done done "$@" done grep "$1" "$1" ${HOME} echo readonly
+		cd printf printf printf "$1"
+		/usr/bin "$1" printf | done -eu test "$1" local local local
+		test cd "$@" then "$1" 2>/dev/null $(pwd) | x=1 local done test "$@" -eu readonly
+cd sed "$1" local readonly printf 'quoted text' ${HOME} && then printf
+	--verbose printf local x=1 then grep readonly && test /usr/bin /usr/bin
+	done export $(pwd) local readonly printf -eu awk awk -eu -eu "$1" "$1"
+		local grep | x=1 readonly /usr/bin /usr/bin
+		"$1" --verbose readonly sed
+	readonly --verbose | 'quoted text' 2>/dev/null
+		$(pwd) "$@" 'quoted text' echo awk -eu printf done
+	export cd then done --verbose -eu $(pwd) 'quoted text'
+	then done cd cd "$1" x=1
+	--verbose $(pwd) && cd
+test cd 2>/dev/null export ${HOME} -eu test echo /usr/bin
+x=1 awk /usr/bin export test ${HOME} | test sed local | | && export ${HOME} awk
+	printf grep /usr/bin local "$@" printf "$@" readonly 2>/dev/null
+		then done readonly --verbose grep $(pwd) 'quoted text' then grep echo x=1 &&
+	&& "$@" cd export then 2>/dev/null grep "$@" local
+	then cd $(pwd) printf
+	then local readonly echo x=1 -eu "$@"
+awk done "$1" sed sed grep test printf printf cd ${HOME} awk sed
+		-eu sed ${HOME} then /usr/bin $(pwd) printf
+	x=1 awk -eu ${HOME} grep 'quoted text'
+		local -eu 2>/dev/null grep sed export "$1" 2>/dev/null then
+		--verbose test "$@" grep cd --verbose
+local "$@" && local cd test echo | cd
+		export 2>/dev/null 'quoted text' readonly
+		x=1 --verbose done cd x=1 | 'quoted text' ${HOME} 2>/dev/null
+"$@" 'quoted text' && /usr/bin cd done
+		test -eu export readonly echo x=1 export
+		readonly local ${HOME} echo
+-eu && 2>/dev/null x=1 test
+echo grep test grep awk /usr/bin
+		/usr/bin local ${HOME}
+readonly sed --verbose "$@" echo export cd then | sed done sed test
+		'quoted text' $(pwd) | local 'quoted text' echo export
+'quoted text' test -eu done cd "$1" &&
+"$@" echo readonly local done /usr/bin done $(pwd) then "$1" printf done
+&& | $(pwd) done echo $(pwd) 'quoted text' 2>/dev/null
+	sed sed -eu ${HOME} printf 'quoted text' ${HOME}
+		${HOME} readonly ${HOME} "$1" 'quoted text' 2>/dev/null "$@" awk done /usr/bin
+local && printf "$@" test && grep
+	export awk readonly 2>/dev/null
+	then then 2>/dev/null echo 2>/dev/null
+		then 2>/dev/null then
+export done ${HOME} | && "$@" done then --verbose awk 2>/dev/null "$1" echo
+		${HOME} --verbose /usr/bin ${HOME}
+	readonly awk --verbose export cd "$1" $(pwd) done "$@" echo printf ${HOME}
+		x=1 local 'quoted text' "$@" printf cd sed --verbose ${HOME} "$@" $(pwd) test
+		awk then done printf done local
+	--verbose printf printf cd 'quoted text' --verbose echo "$@" "$1"
+'quoted text' awk --verbose /usr/bin 'quoted text' "$1" test test local
+		&& readonly 2>/dev/null export then printf
+awk --verbose sed test awk /usr/bin printf "$1"
+-eu $(pwd) grep ${HOME} grep
+	-eu grep 2>/dev/null test /usr/bin "$1" then echo grep 'quoted text'
+		-eu export -eu && sed cd 'quoted text' grep test printf | awk awk "$1"
+		${HOME} && grep /usr/bin sed "$1" && --verbose ${HOME} grep -eu
+$(pwd) printf echo ${HOME} "$1" then
+		then awk ${HOME} awk sed --verbose
+	"$@" cd sed echo "$1" $(pwd) && awk test | ${HOME} cd -eu test readonly readonly
+printf echo sed --verbose "$1" then echo
+		$(pwd) local done awk then sed cd echo readonly printf
+		'quoted text' "$1" "$@" 2>/dev/null /usr/bin printf 2>/dev/null cd awk done
+"$1" awk 2>/dev/null export x=1 x=1 | 2>/dev/null test then -eu cd
+| cd printf --verbose && test done 'quoted text' x=1
+	test export /usr/bin ${HOME}
+"$1" sed "$@" done --verbose
+		echo echo "$@" x=1 test done echo printf grep &&
+		printf done "$@" ${HOME} | ${HOME} printf
+		&& done awk --verbose awk --verbose export sed -eu grep test echo x=1 echo
+echo -eu export && -eu export 'quoted text' done done cd export grep "$@" echo
+'quoted text' "$@" --verbose 2>/dev/null -eu /usr/bin then export awk
+	/usr/bin echo done | /usr/bin 2>/dev/null --verbose
+${HOME} ${HOME} export readonly printf && done
+		then echo done test -eu then x=1
+		cd then cd printf --verbose awk -eu test sed then echo printf local ${HOME} x=1
+--verbose test 'quoted text' awk printf awk -eu awk readonly x=1 done
+		-eu sed 'quoted text' export $(pwd) "$@" 'quoted text' 'quoted text' printf
+x=1 sed --verbose "$1" | sed x=1 | sed echo /usr/bin printf
+| sed echo && then 'quoted text'
+		"$@" --verbose then 2>/dev/null echo
+	readonly test cd local 2>/dev/null | printf echo
+"$@" 2>/dev/null $(pwd) /usr/bin done then then ${HOME}
+/usr/bin local x=1 --verbose "$@" $(pwd)
+	$(pwd) sed awk "$1" local
+		$(pwd) local ${HOME} x=1 -eu ${HOME} awk "$1" then test
+	/usr/bin then /usr/bin grep sed --verbose | $(pwd) /usr/bin
+"$1" "$1" cd 'quoted text' "$1" echo "$1" then printf sed x=1
+		/usr/bin $(pwd) $(pwd) echo "$1" "$@" &&
+		2>/dev/null 2>/dev/null printf 2>/dev/null export done $(pwd) 'quoted text' 'quoted text'
+	-eu done --verbose -eu awk cd --verbose echo 2>/dev/null
+	'quoted text' 'quoted text' test 2>/dev/null 2>/dev/null
+	printf --verbose awk test ${HOME} /usr/bin -eu test echo test "$@" 'quoted text'
+		-eu done local awk grep sed "$@" test
+		| done sed grep | cd ${HOME}
+		x=1 cd then "$@" echo local 2>/dev/null | 2>/dev/null cd "$1"
+x=1 'quoted text' -eu ${HOME}
+	done /usr/bin | test local
+2>/dev/null 2>/dev/null ${HOME} cd -eu ${HOME} then -eu x=1 then
+	"$@" -eu -eu echo -eu
+		cd grep --verbose then $(pwd) grep 'quoted text' echo
+| -eu then x=1 /usr/bin then test /usr/bin "$1" | x=1 && awk "$1" 2>/dev/null
+		"$@" cd 'quoted text' -eu -eu local 'quoted text'
+		then ${HOME} --verbose 'quoted text' readonly x=1 done cd grep
+	| 2>/dev/null && 'quoted text' test grep then readonly export 'quoted text'
+		local 2>/dev/null "$@" | echo echo
+echo | -eu test && export x=1 "$@" done test cd then then && then test "$1" x=1
+		'quoted text' readonly awk grep awk echo && then -eu done 'quoted text'
+grep awk 'quoted text' test
+		echo 'quoted text' /usr/bin awk --verbose
+| awk echo 'quoted text' x=1 export
+echo grep 'quoted text' ${HOME} readonly done 2>/dev/null cd export
+		cd && && ${HOME} /usr/bin --verbose then awk local export cd -eu /usr/bin
+'quoted text' | -eu --verbose $(pwd)
+		| done test grep x=1 readonly ${HOME} done readonly ${HOME} export && | local
+	done echo cd grep awk ${HOME} "$1" $(pwd)
+	--verbose ${HOME} then 'quoted text' ${HOME} readonly then && "$1" "$1" 2>/dev/null
+	-eu then 2>/dev/null 2>/dev/null printf x=1 ${HOME} /usr/bin then
+	${HOME} then grep | "$1" local sed $(pwd) cd cd printf "$@" $(pwd) 'quoted text'
+		grep sed export done "$1" grep | --verbose -eu done "$@" test test grep "$1"
+"$@" cd $(pwd) printf "$@" $(pwd) 2>/dev/null
+		export awk | test x=1 --verbose then x=1 /usr/bin cd export 'quoted text' && "$1"
+	test printf local export export
+	x=1 /usr/bin x=1 then printf -eu -eu 'quoted text' done /usr/bin cd readonly
+	sed sed cd test && 2>/dev/null echo $(pwd) then then grep
+&& test test /usr/bin 'quoted text' ${HOME} 2>/dev/null echo
+cd $(pwd) "$1" echo readonly 'quoted text'
+	sed local printf | "$1" $(pwd) "$1"
+		readonly x=1 /usr/bin ${HOME} sed printf readonly awk --verbose
+test 'quoted text' --verbose
+		local /usr/bin $(pwd) ${HOME} readonly cd then grep 'quoted text' -eu awk
+	2>/dev/null export readonly 2>/dev/null
+	local 2>/dev/null ${HOME}
+	"$1" sed "$1" echo "$@" grep cd export done 'quoted text' "$@" done done ${HOME}
+	| "$@" readonly sed awk "$1" "$@" test printf
+	then ${HOME} done /usr/bin "$@" grep printf 2>/dev/null
+		grep x=1 sed | ${HOME} ${HOME} grep printf test x=1 "$@"
+		/usr/bin "$1" grep | | printf x=1 grep
+		then x=1 "$1" 'quoted text' /usr/bin --verbose done test && test sed
+	"$1" $(pwd) | done cd 2>/dev/null cd | grep local ${HOME} test test --verbose cd
+		/usr/bin test $(pwd) done done 'quoted text' done -eu x=1 /usr/bin sed
+	&& cd printf 2>/dev/null "$@" "$1" grep grep echo
+		'quoted text' $(pwd) echo awk 'quoted text' export done printf grep
+x=1 ${HOME} sed 'quoted text' sed /usr/bin 2>/dev/null /usr/bin -eu test
+		cd awk ${HOME} && && readonly test | $(pwd) sed echo x=1 /usr/bin test echo export
+--verbose 'quoted text' test --verbose
+		--verbose x=1 then export sed sed cd
+2>/dev/null readonly ${HOME}
+		$(pwd) --verbose | export 'quoted text' done | sed echo x=1 sed cd local
+	2>/dev/null ${HOME} x=1 printf echo done cd awk done 2>/dev/null 2>/dev/null
+"$1" /usr/bin $(pwd) awk readonly export test x=1 grep export -eu "$1"
+export && 2>/dev/null printf -eu $(pwd) 2>/dev/null
+	sed "$1" "$@" | done export 'quoted text' sed local
+	awk && then awk --verbose && grep
+	done ${HOME} && export -eu && export readonly && test then
+		'quoted text' local x=1 ${HOME} x=1 "$@" then -eu echo x=1 "$@" echo | grep ${HOME}
+		cd local then $(pwd) echo cd readonly
+		test 'quoted text' x=1 sed test 'quoted text' ${HOME} sed 'quoted text' echo then
+x=1 -eu readonly && && $(pwd) $(pwd) "$1" | --verbose
+	readonly 2>/dev/null 'quoted text' | 'quoted text'
+	echo "$@" "$@" printf grep 'quoted text' $(pwd) 'quoted text' $(pwd)
+	export ${HOME} grep -eu echo "$@" /usr/bin ${HOME} x=1 sed "$1"
+	echo && done then && grep local /usr/bin ${HOME} 'quoted text' -eu export
+	local 'quoted text' echo /usr/bin cd
+-eu /usr/bin sed printf done $(pwd) --verbose test "$1" readonly
+		| test readonly /usr/bin grep
+		2>/dev/null export local ${HOME}
+		/usr/bin 'quoted text' sed sed "$@" 2>/dev/null cd export 'quoted text'
+	local local readonly then done | export done cd "$@" grep $(pwd)
+export sed readonly | grep x=1 ${HOME} "$@" cd "$@" -eu
+local "$@" /usr/bin export 'quoted text' x=1 /usr/bin
+${HOME} then readonly grep 2>/dev/null readonly 2>/dev/null x=1
+'quoted text' 2>/dev/null ${HOME} x=1 | x=1 awk $(pwd)
+	grep local echo && printf cd "$@" -eu export done $(pwd) "$1" then printf
+		2>/dev/null | | awk /usr/bin grep -eu && awk "$1" 2>/dev/null && printf then
+	done export /usr/bin "$1" test 2>/dev/null done
+		x=1 then export readonly --verbose then grep export $(pwd) then grep test printf
+		done -eu 'quoted text' 2>/dev/null && x=1 then export "$1" echo then cd "$1" "$@"
+readonly cd then --verbose --verbose cd awk cd
+		x=1 local | grep readonly local echo local x=1 export x=1
+		--verbose local echo && then sed done local "$1" x=1 export
+"$1" -eu printf "$1" | test x=1 --verbose "$1" 'quoted text' export "$@"
+	/usr/bin "$@" "$@" "$1" export echo --verbose
+		printf 'quoted text' --verbose readonly
+	done cd done export readonly x=1 export
+done grep cd echo $(pwd)
+/usr/bin done -eu --verbose sed /usr/bin &&
+		x=1 ${HOME} export echo "$1" "$@" done /usr/bin export local grep "$1"
+done x=1 export done --verbose /usr/bin then then && then -eu echo /usr/bin /usr/bin
+	readonly --verbose awk awk ${HOME} cd "$@" test echo $(pwd) grep $(pwd) echo printf
+then | "$1" then then awk then "$@" x=1 readonly 2>/dev/null
+	done ${HOME} then cd -eu "$1" done /usr/bin /usr/bin echo sed cd printf
+		-eu awk sed x=1 "$@" sed | "$1" then
+	echo awk --verbose export /usr/bin ${HOME} $(pwd) "$1" local local x=1 export awk
+done | done "$@" $(pwd)
+grep printf "$1" local -eu "$1" cd /usr/bin ${HOME} "$1" grep /usr/bin
+	--verbose ${HOME} printf grep ${HOME} 'quoted text' local
+	done echo "$@" x=1 then done cd sed grep --verbose sed
+	x=1 then | "$@" "$1" && 'quoted text' awk ${HOME} export cd 'quoted text'
+		printf done $(pwd) done x=1 && readonly
+		"$1" $(pwd) | printf && "$@" && test echo /usr/bin
+	"$@" test grep test echo export ${HOME} sed readonly export echo echo 'quoted text'
+	'quoted text' export then "$1" -eu 2>/dev/null local export done /usr/bin readonly
+	then x=1 then | /usr/bin then
+	grep 'quoted text' | local --verbose cd awk export readonly "$@"
+		grep "$@" && export test /usr/bin grep && $(pwd) printf 'quoted text'
+		-eu $(pwd) | then printf readonly
+	/usr/bin | awk then $(pwd) --verbose 'quoted text'
+		2>/dev/null && && done -eu "$1" awk
+		sed sed ${HOME} cd local grep
+	test ${HOME} x=1 ${HOME} then 2>/dev/null test "$1" local cd 2>/dev/null
+done readonly "$1" 2>/dev/null 'quoted text'
+${HOME} sed $(pwd) export | test readonly
+		-eu ${HOME} done done 2>/dev/null "$@" $(pwd) ${HOME} sed export 'quoted text'
+	cd x=1 | "$@" -eu grep done -eu printf printf
+		grep test echo x=1 ${HOME} x=1 grep && readonly printf echo &&
+		x=1 local x=1 /usr/bin /usr/bin
+		&& sed readonly 'quoted text'
+	"$1" sed | "$@" export export done echo echo
+		'quoted text' 'quoted text' -eu ${HOME} x=1 "$@" awk sed printf "$1" awk done
+		$(pwd) sed ${HOME} --verbose | test echo sed test /usr/bin && $(pwd) sed
+		x=1 x=1 awk "$1" cd --verbose "$1" ${HOME} sed
+"$1" "$1" echo $(pwd) echo 2>/dev/null ${HOME}
+-eu x=1 cd ${HOME} awk "$1" done then
+/usr/bin | 2>/dev/null "$@" awk done grep printf printf then x=1 readonly
+		'quoted text' readonly -eu test 2>/dev/null echo
+	grep then x=1 test export readonly "$1" printf
+	awk then done --verbose 'quoted text'
+cd | cd $(pwd) printf printf $(pwd)
+readonly sed ${HOME} sed local 2>/dev/null ${HOME} 'quoted text' readonly sed
+		${HOME} test readonly | x=1 printf
+$(pwd) | "$@" readonly readonly local export /usr/bin local "$1" sed cd "$1"
+	export export $(pwd) --verbose "$@" done 'quoted text'
+		awk x=1 "$1" done 2>/dev/null
+		then "$@" 2>/dev/null done | readonly sed
+readonly x=1 readonly grep sed readonly export grep /usr/bin cd sed
+	echo 'quoted text' echo done done cd echo ${HOME} echo
+		-eu sed "$@" grep sed echo echo 2>/dev/null
+	printf /usr/bin awk && --verbose cd then | then local test printf readonly
+"$@" 2>/dev/null done x=1 x=1
+| echo x=1 && $(pwd) ${HOME} ${HOME} && "$1" printf --verbose
+	export sed done "$@" printf echo readonly local grep ${HOME} "$@" --verbose
+		'quoted text' 'quoted text'
+	local awk "$1" export | test "$@" test test /usr/bin -eu 2>/dev/null
+sed readonly readonly cd echo test /usr/bin then ${HOME} ${HOME} --verbose
+		"$1" | "$1" test ${HOME} "$@" cd "$@" sed echo 'quoted text'
+grep printf | test sed x=1 then -eu $(pwd) readonly
+	grep "$1" local then awk 'quoted text'
+		test "$@" | | cd then grep /usr/bin sed 2>/dev/null
+	--verbose awk echo && done awk /usr/bin x=1 printf -eu
+		sed && sed local readonly cd --verbose -eu 2>/dev/null 'quoted text' && -eu $(pwd)
+		"$1" readonly then sed done --verbose 'quoted text' awk ${HOME}
+readonly -eu readonly x=1 cd local ${HOME} 2>/dev/null printf sed 'quoted text'
+	$(pwd) done export $(pwd)
+	&& grep export cd local test 'quoted text' 'quoted text' then -eu
+-eu 2>/dev/null readonly
+	printf --verbose --verbose sed grep done echo grep
+sed awk 'quoted text' export
+	&& awk grep then printf -eu echo --verbose then -eu
+cd && cd test echo test "$@"
+	-eu "$1" done echo test
+export done x=1 test -eu x=1
+then $(pwd) echo && test
+	awk --verbose 'quoted text' readonly local -eu "$@" then | readonly
+		sed && readonly | --verbose $(pwd) test -eu export sed sed awk 'quoted text'
+		2>/dev/null x=1 export then --verbose
+	readonly && then "$1" export -eu /usr/bin echo readonly test 2>/dev/null
+		$(pwd) -eu awk $(pwd) grep x=1 "$1" /usr/bin "$@" "$1" 'quoted text'
+		/usr/bin --verbose ${HOME} x=1 'quoted text' | 'quoted text' /usr/bin
+		$(pwd) /usr/bin 2>/dev/null
+	grep /usr/bin ${HOME} cd cd -eu /usr/bin $(pwd) x=1
+	test export x=1 --verbose 2>/dev/null cd local
+		test && --verbose awk test sed && printf x=1 local x=1 "$1" /usr/bin
+	"$@" grep awk done -eu readonly
+		done then grep awk sed grep cd grep done
+	sed $(pwd) test && sed "$@" test then
+	x=1 export cd $(pwd) test sed readonly echo "$@" x=1
+		test && grep -eu awk 2>/dev/null --verbose grep cd | -eu "$1"
+	/usr/bin -eu sed readonly
+		test export local printf
+${HOME} | test -eu | done | | grep --verbose local printf grep
+	-eu -eu sed --verbose
+		| "$@" export 'quoted text' export 2>/dev/null export echo echo echo --verbose
+export readonly "$@" $(pwd) awk | 'quoted text'
+		readonly done grep test $(pwd) && ${HOME}
+'quoted text' /usr/bin $(pwd) sed | printf "$@" readonly
+		&& 2>/dev/null | && 2>/dev/null /usr/bin x=1 printf $(pwd)
+	--verbose sed x=1 "$1" grep $(pwd) test grep export
+		printf export /usr/bin done sed
+	export local | /usr/bin echo printf 'quoted text'
+	then grep grep awk done cd printf -eu awk 2>/dev/null 2>/dev/null
+		readonly ${HOME} 'quoted text' 2>/dev/null echo -eu 'quoted text'
+| 2>/dev/null then readonly done "$1" -eu echo 2>/dev/null cd $(pwd)
+		x=1 done done /usr/bin sed export "$@"
+		/usr/bin readonly done echo local cd cd 'quoted text' --verbose -eu
+	"$@" echo printf awk readonly x=1 /usr/bin
+export printf awk sed $(pwd) 'quoted text'
+		--verbose -eu awk 'quoted text' export cd "$1" -eu 'quoted text' sed -eu
+	grep local "$@" | && | x=1 'quoted text' -eu ${HOME} /usr/bin test -eu /usr/bin
+done /usr/bin export --verbose ${HOME} printf 2>/dev/null export ${HOME}
+	test awk "$@" "$1" ${HOME} /usr/bin
+		grep echo grep "$1" "$@" echo | export "$1" awk x=1 readonly echo
+		then echo ${HOME} local then $(pwd) && | | awk local local ${HOME}
+	&& --verbose cd export x=1 printf
+		echo "$1" -eu 'quoted text' x=1 export --verbose && /usr/bin readonly done
+		local -eu readonly sed /usr/bin ${HOME}
+	export 2>/dev/null "$1" 2>/dev/null x=1 export /usr/bin done -eu
+sed grep $(pwd) 2>/dev/null
+	echo echo test 'quoted text' export $(pwd) 2>/dev/null
+--verbose local cd done --verbose readonly
+&& $(pwd) grep $(pwd) -eu 'quoted text' ${HOME} "$1"
+"$1" done readonly then
+readonly x=1 /usr/bin sed x=1 done --verbose $(pwd) then
+	cd /usr/bin 2>/dev/null awk | readonly x=1 && --verbose echo
+${HOME} "$@" grep /usr/bin "$1" -eu | -eu then
+	echo -eu grep local sed $(pwd) "$1" done done then local ${HOME} grep 'quoted text'
+awk "$1" --verbose then /usr/bin export grep | x=1 /usr/bin export readonly
+		--verbose /usr/bin ${HOME} "$1" awk x=1 export cd -eu $(pwd) export test
+	/usr/bin grep then test test test 2>/dev/null readonly
+cd "$1" done test sed sed -eu
+		awk echo $(pwd) ${HOME} sed export --verbose $(pwd) printf ${HOME} /usr/bin cd
+	test 'quoted text' local test printf -eu echo && grep ${HOME} --verbose && 2>/dev/null
+		$(pwd) done local test --verbose done /usr/bin 'quoted text' /usr/bin local
+		then -eu /usr/bin done x=1 export $(pwd) awk printf then then export 'quoted text'
+printf 'quoted text' | export -eu
+'quoted text' echo export local done
+		2>/dev/null done export --verbose
+		echo awk | export grep x=1 /usr/bin
+'quoted text' grep 'quoted text' x=1
+	${HOME} "$1" ${HOME} export sed sed | sed --verbose -eu | --verbose
+local --verbose -eu --verbose local
+		${HOME} test test cd /usr/bin x=1 x=1 export cd local | && export
+-eu sed cd x=1 2>/dev/null export readonly cd cd echo 'quoted text' grep
+"$1" local echo "$@" test --verbose -eu && readonly
+x=1 grep "$1" /usr/bin local readonly then done && $(pwd) grep --verbose && /usr/bin
+-eu x=1 && "$@" "$@" grep awk local -eu awk 2>/dev/null "$1" echo
+	done --verbose --verbose /usr/bin x=1 grep
+--verbose x=1 --verbose 'quoted text' awk
+printf test test "$1" 2>/dev/null printf done
+printf 2>/dev/null "$@" sed then awk | /usr/bin
+	test export -eu then sed awk cd grep -eu $(pwd) sed done then --verbose printf
+		printf grep "$1" -eu sed test sed "$1" printf |
+		${HOME} awk --verbose 2>/dev/null sed
+	grep test grep local "$@" ${HOME} 2>/dev/null sed /usr/bin "$1" x=1
+| && awk then "$@" && echo 'quoted text' $(pwd)
+done && grep cd done | $(pwd) -eu
+2>/dev/null /usr/bin x=1 echo --verbose then grep readonly "$1"
+	export -eu $(pwd) then then export local && export ${HOME} readonly test
+		x=1 -eu 2>/dev/null /usr/bin
+		local sed /usr/bin $(pwd) | --verbose
+		local -eu --verbose awk cd && "$1" -eu done readonly local local export
+	printf ${HOME} export local export sed | test grep && "$1" awk
+	| readonly test "$@" 'quoted text' | grep local
+		$(pwd) sed readonly -eu test "$@" done
+"$1" readonly printf test then | && | | awk printf done --verbose
+/usr/bin echo echo 2>/dev/null sed /usr/bin | then sed echo then cd $(pwd) echo
+done done awk /usr/bin 'quoted text'
+test $(pwd) printf test
+	${HOME} && "$@" done grep printf sed then "$1" 'quoted text'
+		echo test /usr/bin awk -eu $(pwd) && echo
+		then 'quoted text' x=1 export --verbose export --verbose | 2>/dev/null local
+		-eu echo --verbose cd then local
+		-eu awk $(pwd) 'quoted text' awk 2>/dev/null then grep $(pwd) "$@" readonly x=1
+		'quoted text' && readonly 2>/dev/null then x=1 'quoted text' printf awk done
+readonly "$1" "$1" "$@" 2>/dev/null
+		echo x=1 then then grep printf then ${HOME}
+	2>/dev/null awk printf | echo echo --verbose test
+		--verbose -eu export --verbose "$1" &&
+	local test grep export "$1" then | 2>/dev/null
+		-eu 'quoted text' cd printf echo -eu && echo && export
+	&& cd sed $(pwd) then "$1" echo test awk 2>/dev/null | local cd echo
+"$@" && ${HOME} "$1" export sed x=1 ${HOME} test local grep && test x=1 cd
+	| then ${HOME} awk | sed 'quoted text' 'quoted text'
+grep 'quoted text' $(pwd) 'quoted text' echo awk echo
+printf /usr/bin ${HOME} printf -eu $(pwd) sed cd | | test then "$@"
+echo "$@" ${HOME} && printf test sed $(pwd) x=1 then printf
+		2>/dev/null grep export && echo grep
+		echo readonly export /usr/bin "$@" 2>/dev/null
+local sed -eu test 'quoted text' awk done
+		readonly x=1 && local grep "$1"
+		--verbose local ${HOME} echo echo "$@" awk
+| cd cd sed sed printf printf local | 2>/dev/null readonly sed sed 2>/dev/null
+	"$1" test sed printf | echo "$1" "$@" "$@" awk ${HOME}
+	-eu --verbose x=1 -eu &&
+	2>/dev/null "$@" printf 2>/dev/null then 'quoted text' grep ${HOME} sed 2>/dev/null
+readonly "$1" x=1 printf 2>/dev/null -eu then ${HOME}
+	test 'quoted text' then printf test -eu $(pwd) 'quoted text' echo &&
+/usr/bin test sed ${HOME} then cd test local
+		echo $(pwd) 2>/dev/null -eu readonly
+		sed test then x=1 awk $(pwd) export -eu 2>/dev/null ${HOME}
+"$@" sed /usr/bin export /usr/bin
+grep ${HOME} echo 2>/dev/null test -eu 2>/dev/null printf
+sed echo $(pwd) 'quoted text' x=1 "$1" test grep readonly && cd
+		--verbose 2>/dev/null && | x=1 $(pwd) $(pwd) 'quoted text'
+	test then printf "$1" -eu printf grep local ${HOME} grep $(pwd) -eu "$1" local
+printf grep done then 2>/dev/null "$1" readonly awk /usr/bin readonly
+	test -eu x=1 printf test test
+	x=1 local -eu awk then printf cd cd test awk ${HOME} printf test
+echo 'quoted text' "$1" x=1 2>/dev/null "$1" export test --verbose sed local
+--verbose "$1" | export ${HOME} "$@" -eu local
+	/usr/bin printf local printf --verbose ${HOME}
+	-eu readonly /usr/bin cd --verbose ${HOME} echo
+	x=1 then local grep && x=1 'quoted text' cd
+	cd 'quoted text' awk cd cd then $(pwd)
+printf 2>/dev/null cd readonly /usr/bin awk $(pwd) -eu --verbose grep
+		2>/dev/null echo echo $(pwd) then "$1" ${HOME}
+2>/dev/null printf printf echo 'quoted text' local
+test cd /usr/bin test then --verbose
+		printf ${HOME} | $(pwd) local && sed local awk then echo awk
+local && --verbose $(pwd) cd /usr/bin
+		$(pwd) grep ${HOME} grep $(pwd) 2>/dev/null
+--verbose ${HOME} readonly printf test cd printf "$1" done readonly --verbose
+cd 'quoted text' printf | printf "$1" awk -eu printf sed test awk 'quoted text'
+--verbose readonly "$@" 'quoted text' printf awk
+	grep "$@" printf -eu printf cd test 'quoted text' "$@" /usr/bin --verbose |
+"$@" x=1 $(pwd) export $(pwd) awk -eu done /usr/bin export then
+| && "$@" awk /usr/bin readonly -eu | export 'quoted text' test test /usr/bin sed
+	&& --verbose awk | sed "$@" cd
+		test grep printf ${HOME} && "$@" export
+	2>/dev/null --verbose export export grep /usr/bin ${HOME} test
+awk awk | ${HOME} awk
+		| sed ${HOME} -eu 2>/dev/null $(pwd) test | echo awk readonly /usr/bin then
+		"$@" "$@" x=1 --verbose done | test sed | export readonly local $(pwd) ${HOME}
+	2>/dev/null --verbose
+		-eu "$@" readonly 'quoted text' /usr/bin
+readonly --verbose "$1" 'quoted text' export -eu /usr/bin $(pwd) "$@" printf
+	readonly awk 2>/dev/null 2>/dev/null "$@" grep /usr/bin
+	-eu -eu --verbose 'quoted text' grep "$@" --verbose sed
+	--verbose /usr/bin sed awk | -eu test
+		--verbose x=1 sed -eu export 2>/dev/null
+	-eu done 'quoted text' "$1" local --verbose | "$1" awk 2>/dev/null
+		grep export then --verbose | awk 'quoted text' sed 2>/dev/null
+		x=1 test echo echo | export local --verbose printf local | printf ${HOME} printf
+	&& echo ${HOME} /usr/bin $(pwd) --verbose done awk local 2>/dev/null
+		2>/dev/null done grep 2>/dev/null readonly readonly sed "$@" done
+	printf awk && grep -eu readonly printf 2>/dev/null test
+		then "$1" && echo --verbose x=1 sed done /usr/bin cd readonly
+		2>/dev/null done && "$@" | $(pwd) "$@" | cd
+		2>/dev/null 2>/dev/null | /usr/bin
+export cd "$1" | local awk 'quoted text' sed sed 2>/dev/null
+		echo cd cd 2>/dev/null 'quoted text'
+	echo 'quoted text' $(pwd) -eu sed export
+	readonly echo done grep grep x=1 export /usr/bin printf awk /usr/bin
+	then 2>/dev/null printf done then awk echo 2>/dev/null
+		${HOME} 2>/dev/null echo | grep --verbose test -eu done
+		printf /usr/bin echo 2>/dev/null "$@" -eu cd
+		export x=1 /usr/bin test | | 'quoted text' 2>/dev/null -eu 2>/dev/null cd x=1
+echo -eu readonly ${HOME}
+printf local echo | --verbose ${HOME} then x=1 printf x=1 x=1 cd
+		local 'quoted text' echo printf x=1 awk $(pwd) cd | done
+	$(pwd) export "$@" "$1" "$1" done readonly printf 2>/dev/null
+cd --verbose "$@" $(pwd) done done x=1 && local grep 'quoted text'
+awk "$@" "$1" x=1 local awk $(pwd)
+local --verbose test test "$@" 'quoted text' cd | test
+	cd then ${HOME} "$@" awk 2>/dev/null printf -eu cd $(pwd) x=1 cd
+		echo ${HOME} --verbose grep readonly
+&& sed readonly --verbose sed 2>/dev/null -eu grep
+	local | printf sed ${HOME}
+	| | x=1 /usr/bin then export cd "$1" --verbose
+		&& "$@" | cd 2>/dev/null export && -eu 'quoted text'
+	printf --verbose | "$1" && then awk then local 2>/dev/null
+/usr/bin "$@" local x=1 awk then grep awk export -eu
+| --verbose done "$1" test
+sed readonly 'quoted text' sed 2>/dev/null
+	"$@" test done printf readonly local
+$(pwd) then grep then x=1 2>/dev/null /usr/bin
+awk then "$1" -eu | awk echo $(pwd) "$1" test done printf && awk printf /usr/bin
+	awk echo cd then sed x=1 -eu
+	&& printf /usr/bin && sed
+	done readonly -eu cd "$1" /usr/bin printf sed $(pwd) && | | cd printf cd
+	x=1 readonly 'quoted text' 'quoted text' 2>/dev/null printf
+	awk -eu 2>/dev/null ${HOME} test x=1 "$@" 'quoted text' && grep
+&& -eu "$@" test readonly readonly echo --verbose done /usr/bin export local x=1
+then grep x=1 sed awk ${HOME} &&
+then export test local 2>/dev/null "$@" sed
+		&& awk export --verbose export then 'quoted text' local "$1" sed awk export printf
+		awk | "$1" printf grep
+${HOME} /usr/bin ${HOME} export
+test export $(pwd) echo $(pwd) readonly ${HOME} echo -eu $(pwd) cd
+	'quoted text' test then sed -eu readonly 2>/dev/null "$@" then
+	| then ${HOME} x=1 "$1" /usr/bin | 'quoted text' test /usr/bin 'quoted text'
+done export x=1 2>/dev/null
+"$1" awk ${HOME} /usr/bin printf grep | -eu grep grep 2>/dev/null cd echo
+	sed grep readonly done done readonly x=1 grep $(pwd) test printf | x=1
+	echo done "$@" test echo
+		'quoted text' $(pwd) --verbose "$1" cd "$@" /usr/bin local /usr/bin
+	'quoted text' ${HOME} awk then "$@" grep local /usr/bin && "$1" readonly
+cd $(pwd) -eu test awk "$@" 'quoted text' $(pwd) -eu
+--verbose "$@" readonly ${HOME} "$1" $(pwd) /usr/bin
+		done done sed local sed "$@" ${HOME} --verbose sed echo echo -eu --verbose export
+$(pwd) sed grep export -eu awk grep readonly echo --verbose
+	sed | "$@" test sed 2>/dev/null "$1" readonly $(pwd) echo test "$@" $(pwd)
+		printf local "$@" local
+test echo x=1 "$1" local x=1 "$@" sed grep
+		"$1" readonly done | "$1"
+		--verbose sed local "$@" test
+-eu grep | && printf -eu ${HOME} cd ${HOME} --verbose "$@"
+'quoted text' local export --verbose echo "$1" local done
+${HOME} then /usr/bin grep 2>/dev/null
+		local export export export | export export $(pwd) ${HOME} echo
+		x=1 awk cd printf | done test grep awk grep ${HOME} x=1 awk "$1" local local
+	grep /usr/bin "$1" -eu "$1" sed 2>/dev/null grep echo
+	awk "$1" then done done
+	"$@" done 2>/dev/null sed sed $(pwd)
+		test awk x=1 done $(pwd) sed test echo "$@" 'quoted text' --verbose
+$(pwd) awk test test done then printf ${HOME} ${HOME} x=1 $(pwd)
+sed -eu "$1" printf x=1 test
+	awk grep 2>/dev/null x=1 grep local x=1 export awk
+$(pwd) done 2>/dev/null $(pwd) &&
+	printf printf -eu test awk cd local echo && && printf 'quoted text'
+		| $(pwd) $(pwd) export /usr/bin
+		sed done && 2>/dev/null 2>/dev/null $(pwd) printf
+	--verbose then awk test awk ${HOME} readonly
+	then | --verbose export sed --verbose x=1 --verbose
+		export $(pwd) --verbose | -eu $(pwd) echo "$1" local
+		/usr/bin cd sed test --verbose cd done
+	$(pwd) local local -eu --verbose $(pwd) "$1" | sed
+"$@" -eu 'quoted text' local
+	2>/dev/null cd export "$1" grep cd x=1 $(pwd) --verbose grep 2>/dev/null
+		| local "$@" "$@" -eu cd --verbose -eu awk $(pwd) $(pwd) grep test "$1" 2>/dev/null
+	${HOME} /usr/bin x=1 |
+		echo local x=1 -eu --verbose x=1 cd 'quoted text'
+	printf && echo done then && ${HOME}
+		printf $(pwd) echo then
+	$(pwd) | done test "$@" cd 2>/dev/null echo 2>/dev/null printf awk -eu awk ${HOME}
+	grep awk $(pwd) then then sed echo test && -eu printf | echo readonly
+	readonly then then awk cd "$1" awk 2>/dev/null
+		--verbose ${HOME} 2>/dev/null 2>/dev/null "$1" x=1 /usr/bin local awk grep "$1"
+	then local test 2>/dev/null awk local "$@"
+local "$1" x=1 | -eu done 2>/dev/null done | export
+done "$1" --verbose && local 2>/dev/null
+echo readonly ${HOME} sed done 2>/dev/null "$@"
+	export grep awk --verbose done
+	'quoted text' "$@" awk --verbose
+	2>/dev/null then 'quoted text' cd then echo 2>/dev/null readonly | x=1 | 2>/dev/null
+		local $(pwd) printf done then echo $(pwd) local "$1"
+	printf && export $(pwd) -eu then 'quoted text' | local 2>/dev/null ${HOME} export
+| && awk "$@" export local sed grep x=1 2>/dev/null $(pwd)
+	x=1 /usr/bin local awk awk echo "$@" readonly test "$1" /usr/bin "$1" echo &&
+		| /usr/bin grep /usr/bin sed /usr/bin
+	done 'quoted text' local
+	x=1 2>/dev/null printf x=1 "$1" awk "$1" test /usr/bin 'quoted text' done
+-eu /usr/bin local x=1 cd /usr/bin "$@" -eu "$@" test
+| /usr/bin then ${HOME} $(pwd) export sed --verbose readonly | x=1 readonly
+	test sed "$1" /usr/bin local cd local && --verbose printf -eu && then cd local
+	local | --verbose local -eu local
+grep sed test done then --verbose
+	echo printf awk /usr/bin "$1" printf --verbose 'quoted text'
+	done $(pwd) awk awk awk ${HOME}
+'quoted text' /usr/bin sed "$1" echo $(pwd) export export 'quoted text'
+	printf /usr/bin "$1" $(pwd) "$@" | sed
+		"$1" local "$1" then then --verbose
+		"$1" cd local -eu export cd test "$@" then
+	x=1 'quoted text' && -eu
+		x=1 grep 2>/dev/null readonly 2>/dev/null
+		$(pwd) local 'quoted text' 'quoted text' then /usr/bin | then 'quoted text'
+done --verbose local
+		&& sed | done "$1" | cd grep -eu /usr/bin | -eu sed cd -eu | then
+sed 2>/dev/null readonly && export echo sed
+		done | /usr/bin "$1" -eu "$@" echo done "$@" | ${HOME} "$1"
+		${HOME} ${HOME} --verbose
+		sed 2>/dev/null test &&
+export local local printf | cd export test "$1" 'quoted text'
+sed /usr/bin --verbose -eu sed test done sed echo
+		"$@" grep printf awk grep -eu $(pwd) --verbose ${HOME} readonly printf
+		then "$@" readonly export then awk cd | test then 'quoted text' -eu awk
+	/usr/bin grep readonly 2>/dev/null
+grep then --verbose --verbose printf /usr/bin
+x=1 sed | local echo "$1" done -eu "$1" 'quoted text'
+export $(pwd) && -eu sed ${HOME}
+	'quoted text' --verbose "$@" local -eu export 2>/dev/null cd cd then
+	&& $(pwd) --verbose $(pwd) 'quoted text' 2>/dev/null 'quoted text'
+		test export echo "$1" ${HOME} readonly test awk awk -eu export cd /usr/bin cd
+then 2>/dev/null local $(pwd) export then "$1" /usr/bin
+local grep then && printf $(pwd) | sed cd printf && $(pwd) grep x=1
+		$(pwd) awk sed export then test -eu
+export -eu echo sed readonly done cd && readonly --verbose ${HOME} "$1" |
+		sed --verbose cd done local -eu && 2>/dev/null
+		| "$1" local "$1" "$@" printf "$@" "$@" export $(pwd) && ${HOME} sed -eu
+		echo && test awk sed test grep ${HOME}
+		x=1 x=1 'quoted text' | printf echo --verbose -eu $(pwd) "$@"
+	x=1 echo then grep local echo sed cd cd /usr/bin 2>/dev/null
+		x=1 && 2>/dev/null /usr/bin x=1 /usr/bin
+--verbose awk awk readonly export sed "$1" "$1" test "$1" done 2>/dev/null
+"$@" readonly --verbose 2>/dev/null "$@" -eu /usr/bin "$@" grep test echo ${HOME}
+| | export 'quoted text' -eu x=1 -eu grep
+	-eu grep readonly readonly done echo export readonly | /usr/bin echo readonly
+&& -eu $(pwd) echo /usr/bin printf sed
+		| sed /usr/bin cd 2>/dev/null grep "$@" local 'quoted text'
+	2>/dev/null readonly export
+	local grep local then grep
+		echo grep echo sed && | then awk $(pwd)
+-eu printf test cd "$1" cd done x=1
+sed "$@" readonly -eu x=1 'quoted text' readonly ${HOME} done
+echo | printf -eu sed readonly x=1 x=1 echo /usr/bin cd grep
+local --verbose -eu x=1 printf sed printf 2>/dev/null readonly echo && "$1"
+		grep ${HOME} cd 'quoted text' "$@" awk $(pwd)
+		$(pwd) grep ${HOME} ${HOME} test test echo && export --verbose
+	done "$@" | 2>/dev/null grep $(pwd) test printf readonly export grep x=1 --verbose
+&& test 2>/dev/null readonly $(pwd) $(pwd) cd test printf -eu && "$1" 2>/dev/null
+"$@" sed x=1 'quoted text' "$@" "$@" awk readonly echo then --verbose
+&& | echo | echo && $(pwd) awk then $(pwd) &&
+		"$@" grep ${HOME} echo done 'quoted text'
+	cd then $(pwd) grep then $(pwd) --verbose -eu 2>/dev/null
+		local | sed 'quoted text' ${HOME} && cd cd 2>/dev/null test 2>/dev/null grep
+		2>/dev/null then x=1
+		| local ${HOME} test /usr/bin awk grep export export $(pwd) readonly cd && test
+		sed 2>/dev/null 2>/dev/null
+		--verbose local /usr/bin x=1 && echo
+		$(pwd) echo awk awk then "$@" awk x=1 && local readonly "$1" sed ${HOME}
+		2>/dev/null | echo x=1 ${HOME} then && test 'quoted text' cd
+export /usr/bin 2>/dev/null | 2>/dev/null
+		cd ${HOME} --verbose
+	export done "$@" ${HOME} -eu readonly | 'quoted text' done export /usr/bin &&
+		"$1" "$@" printf $(pwd) sed then printf $(pwd) "$@" -eu test --verbose
+	readonly 2>/dev/null "$1" "$1" echo --verbose
+		x=1 echo local "$1" done awk echo --verbose export $(pwd) awk grep --verbose
+		${HOME} /usr/bin "$1" 'quoted text' /usr/bin "$1"
+		cd grep local awk done
+	grep "$1" /usr/bin cd 2>/dev/null -eu && 'quoted text' cd x=1 ${HOME} cd 'quoted text'
+	cd | && /usr/bin done local "$1" $(pwd) 'quoted text' x=1 cd 'quoted text'
+	sed x=1 | awk "$@" $(pwd)
+	awk && ${HOME} sed x=1 | /usr/bin done
+-eu done -eu "$1" x=1 readonly 2>/dev/null "$@" awk awk grep x=1 "$1" echo readonly
+		test 2>/dev/null awk x=1 export done "$1" cd local ${HOME} export ${HOME}
+	grep -eu cd --verbose --verbose
+		| export --verbose --verbose export readonly grep sed test done ${HOME} awk
+printf /usr/bin ${HOME} |
+		/usr/bin ${HOME} grep echo -eu /usr/bin
+	grep ${HOME} "$1" "$@" export && && && 2>/dev/null | -eu 2>/dev/null | echo
+-eu sed --verbose $(pwd) 2>/dev/null echo grep grep awk "$1" --verbose /usr/bin
+	x=1 sed ${HOME} --verbose --verbose &&
+		awk echo local $(pwd) local ${HOME} && readonly "$@" printf "$@" x=1 sed printf
+&& 2>/dev/null ${HOME} && printf
+	export printf --verbose ${HOME} local 2>/dev/null cd -eu
+		"$1" 'quoted text' sed local /usr/bin $(pwd)
+	cd then $(pwd) echo sed export ${HOME}
+	${HOME} $(pwd) cd export --verbose readonly then awk awk printf done "$@" --verbose
+'quoted text' export export "$1"
+	readonly cd ${HOME} test done printf export $(pwd) --verbose "$@" local
+/usr/bin ${HOME} awk export "$1" 'quoted text'
+2>/dev/null /usr/bin test cd ${HOME} done x=1 sed sed 2>/dev/null
+-eu awk printf printf -eu
+awk sed 2>/dev/null cd
+test "$@" printf /usr/bin 'quoted text' sed ${HOME} $(pwd) -eu && cd ${HOME}
+	-eu test $(pwd) cd -eu readonly 2>/dev/null | local "$@" export export "$@"
+"$1" echo done test $(pwd) echo
+		&& export echo export awk export 2>/dev/null echo ${HOME}
+/usr/bin awk -eu -eu export local readonly
+done /usr/bin "$@" 2>/dev/null done cd then ${HOME} $(pwd) -eu then grep 'quoted text'
+x=1 | /usr/bin ${HOME} local && printf readonly cd x=1 2>/dev/null
+		cd x=1 export --verbose echo
+		| && test printf readonly
+		&& $(pwd) echo $(pwd) echo --verbose readonly printf /usr/bin export
+		$(pwd) -eu --verbose awk -eu "$@" done export
+--verbose printf 2>/dev/null | readonly ${HOME}
+2>/dev/null && echo printf printf 2>/dev/null --verbose
+"$@" && -eu 'quoted text' "$@" cd -eu grep | x=1 export -eu && $(pwd) readonly
+	'quoted text' $(pwd) local echo
+		| 'quoted text' cd /usr/bin then
+	x=1 grep awk awk -eu awk test && $(pwd)
+		&& test export "$@" echo /usr/bin
+	readonly "$@" 'quoted text' x=1
+		readonly "$1" "$1" && sed test | sed sed "$1" "$1"
+&& && grep --verbose then local "$@" x=1 "$@" export awk grep 'quoted text'
+		${HOME} test test grep grep then
+		$(pwd) | 2>/dev/null export cd test 'quoted text' "$@" $(pwd) x=1
+	&& cd readonly 'quoted text' export --verbose readonly local
+	printf export cd local export cd then --verbose
+		local export export $(pwd) grep then test && 2>/dev/null 'quoted text'
+$(pwd) sed && cd awk /usr/bin printf export local --verbose x=1
+test x=1 printf | --verbose cd $(pwd) done export local 2>/dev/null
+	awk readonly 'quoted text' | /usr/bin | printf echo "$1" -eu --verbose
+	then && $(pwd) cd x=1 done done local "$1"
+		done | $(pwd) -eu && export grep test x=1 done ${HOME} --verbose /usr/bin local
+	"$@" done $(pwd) 'quoted text' awk 2>/dev/null /usr/bin
+	awk --verbose local && echo readonly --verbose
+	&& test export ${HOME} "$1" --verbose 2>/dev/null
+		awk "$1" export | /usr/bin && "$1" && $(pwd) done awk $(pwd)
+		printf --verbose echo && 'quoted text' /usr/bin
+		&& test 'quoted text' 'quoted text' "$@" 2>/dev/null | local test
+		cd test local then echo -eu echo awk 'quoted text' ${HOME} /usr/bin
+awk printf /usr/bin printf /usr/bin "$1" x=1 printf 2>/dev/null echo
+		local done | then test --verbose export
+local -eu 2>/dev/null printf cd -eu grep 'quoted text' test done
+		${HOME} export x=1 $(pwd) "$1" ${HOME} cd ${HOME} printf x=1 ${HOME}
+-eu "$1" grep $(pwd) 'quoted text'
+| printf | export grep awk readonly && then "$1" test
+		/usr/bin 2>/dev/null x=1 -eu grep --verbose test sed "$1" | test
+		'quoted text' x=1 awk && x=1 cd echo "$@" cd --verbose
+		x=1 $(pwd) -eu cd then done x=1
+	$(pwd) echo printf done echo export test /usr/bin
+x=1 export awk /usr/bin
+		${HOME} /usr/bin ${HOME} printf -eu echo
+done printf readonly test done awk sed 2>/dev/null x=1 "$@" -eu | ${HOME}
+cd printf --verbose test cd
+	awk --verbose $(pwd) cd sed cd "$@" 'quoted text' "$1" | | --verbose awk x=1 "$1"
+		printf /usr/bin local "$1" grep test
+$(pwd) echo done sed awk x=1 echo export sed ${HOME} local awk test && done -eu
+		| | "$@" cd then "$1" | -eu local --verbose export | awk printf $(pwd) sed
+		--verbose 2>/dev/null local
+		cd | "$@" && "$@" echo done local | then sed sed
+	-eu "$1" readonly grep done | then then && local printf local done local
+		grep echo done export "$1" done | $(pwd) cd sed x=1 --verbose
+	printf readonly ${HOME} 2>/dev/null /usr/bin then local
+${HOME} && /usr/bin cd export export x=1 grep 'quoted text'
+		test cd --verbose | printf --verbose readonly test
+	done "$@" grep readonly done
+printf cd x=1 export done done test local x=1 cd echo sed "$1" -eu printf sed
+	| 2>/dev/null 2>/dev/null echo grep
+		&& sed 2>/dev/null x=1 done
+		echo -eu "$1" ${HOME} then --verbose 'quoted text' -eu then then cd cd readonly
+	then x=1 && local "$1" then ${HOME} export
+		2>/dev/null ${HOME} printf then 'quoted text' $(pwd) "$1" grep --verbose awk $(pwd)
+	echo then echo test && ${HOME} awk &&
+		echo "$1" done --verbose -eu readonly sed /usr/bin
+	/usr/bin --verbose cd 2>/dev/null | readonly 2>/dev/null readonly
+then awk awk cd then grep | /usr/bin
+		-eu sed $(pwd) awk && "$1" && "$1" -eu "$1" test then ${HOME}
+--verbose 'quoted text' /usr/bin ${HOME} export $(pwd)
+cd readonly sed 2>/dev/null local
+	-eu test cd then | "$@" awk x=1 echo x=1 ${HOME} readonly
+	local --verbose x=1 'quoted text' printf
+		/usr/bin sed "$1" sed export
+	x=1 ${HOME} readonly printf grep grep
+test printf cd 'quoted text' echo $(pwd) && local ${HOME}
+	x=1 && 2>/dev/null --verbose | "$@" ${HOME}
+$(pwd) readonly awk $(pwd) ${HOME} then && readonly
+		readonly printf 'quoted text' awk grep 'quoted text' $(pwd) x=1 test sed
+awk | cd --verbose done 2>/dev/null --verbose
+done then readonly sed "$1" done "$@" $(pwd) done
+readonly | "$1" "$1" export
+	export ${HOME} --verbose $(pwd) echo sed "$1" awk 2>/dev/null
+	$(pwd) echo $(pwd) done then &&
+		local export && readonly 2>/dev/null export -eu x=1 && "$@"
+"$@" export export awk then
+then "$@" printf "$1" sed | x=1 ${HOME} --verbose --verbose && 'quoted text' -eu
+		sed | awk --verbose "$1" done readonly done then
+		-eu then awk $(pwd) grep --verbose ${HOME} cd "$@" printf "$@" x=1 'quoted text'
+2>/dev/null --verbose then $(pwd)
+		echo ${HOME} sed local then cd cd 'quoted text' cd | export done
+$(pwd) 2>/dev/null "$1"
+| 2>/dev/null done -eu | echo $(pwd) "$1" local then readonly
+		'quoted text' readonly test "$@" printf test local -eu export then
+	--verbose --verbose "$1"
+		$(pwd) sed echo readonly sed test --verbose readonly cd | $(pwd) done done
+printf ${HOME} ${HOME}
+		'quoted text' readonly $(pwd)
+	grep x=1 grep done -eu
+	echo cd test local && awk /usr/bin test then done $(pwd) grep test "$@"
+test echo ${HOME} ${HOME} -eu awk printf ${HOME} test "$1" 'quoted text'
+		export readonly -eu printf x=1
+	awk local done -eu "$1" -eu readonly done then export
+	"$1" 2>/dev/null cd | done echo x=1 test "$1" done done 2>/dev/null -eu
+		local 2>/dev/null printf $(pwd) sed
+awk cd printf cd readonly cd "$@" --verbose test test
+		$(pwd) && readonly ${HOME}
+		readonly grep -eu -eu x=1 readonly sed export readonly readonly --verbose
+${HOME} done grep readonly readonly
+		echo export 'quoted text' done sed local | sed export printf local | sed readonly
+2>/dev/null x=1 printf && 2>/dev/null
+		"$1" done -eu test test awk /usr/bin readonly x=1 then awk "$@"
+done echo $(pwd) local printf ${HOME} -eu echo
+/usr/bin printf test awk export
+	test printf 'quoted text' /usr/bin cd "$1" done | --verbose done | sed
+$(pwd) readonly "$1" | /usr/bin | 'quoted text' sed --verbose
+${HOME} $(pwd) | awk $(pwd) $(pwd) 'quoted text' 2>/dev/null
+		| && ${HOME} then local done export /usr/bin && | then cd
+	x=1 "$1" "$1" test && sed local awk | done done sed 'quoted text'
+${HOME} 2>/dev/null /usr/bin printf then
+	echo 'quoted text' 2>/dev/null
+	done ${HOME} done --verbose grep printf /usr/bin
+		grep 2>/dev/null grep grep then done awk ${HOME} -eu -eu $(pwd) local "$@"
+export /usr/bin local awk cd awk test
+		then "$1" test ${HOME} && ${HOME} ${HOME} "$@" "$@" | 2>/dev/null
+cd $(pwd) 2>/dev/null cd /usr/bin "$1" "$1"
+awk "$1" local export done -eu "$@" export then && /usr/bin done | awk
+-eu 2>/dev/null $(pwd) sed --verbose /usr/bin ${HOME}
+done awk "$@" awk "$1" then -eu x=1 -eu "$@" cd done "$1" cd --verbose
+grep grep "$@" $(pwd) /usr/bin --verbose
+		cd "$1" | && test sed | $(pwd) --verbose
+		| ${HOME} export "$1" 'quoted text'
+cd awk test $(pwd) x=1 done ${HOME}
+		echo done -eu grep --verbose
+		local 2>/dev/null | 'quoted text'
+cd echo "$@" done "$1" x=1 -eu -eu local export /usr/bin ${HOME}
+	| readonly ${HOME} | --verbose readonly "$1" local cd
+		test local | x=1 printf 2>/dev/null printf done done -eu export
+		awk cd | readonly 'quoted text' done | 'quoted text' "$@" --verbose
+		${HOME} 2>/dev/null then "$1" local "$1" local printf 'quoted text'
+	"$@" 2>/dev/null export awk done test grep | printf grep
+		echo readonly then done ${HOME} 2>/dev/null export done 'quoted text' "$@"
+${HOME} ${HOME} 2>/dev/null
+	cd /usr/bin "$1" awk -eu ${HOME} echo
+	export awk 'quoted text' "$@" sed "$1"
+		done 2>/dev/null 2>/dev/null printf x=1 ${HOME} | | | 2>/dev/null echo sed
+	grep $(pwd) test | ${HOME} ${HOME} x=1 grep then test ${HOME} cd
+| "$@" cd sed printf export 2>/dev/null ${HOME} local export "$@" local
+		$(pwd) ${HOME} x=1 grep export printf then grep sed local printf "$@"
+printf /usr/bin readonly done --verbose x=1 cd then sed test && printf -eu test
+	grep export done | readonly test $(pwd) printf awk done x=1 2>/dev/null
+local x=1 --verbose printf
+'quoted text' sed awk cd sed /usr/bin awk
+/usr/bin "$1" done ${HOME} local grep test | "$@" printf x=1 cd x=1 export 2>/dev/null
+sed export local "$@" done "$1"
+"$@" test done readonly $(pwd) | "$@" && export grep ${HOME} x=1
+	2>/dev/null $(pwd) awk then sed ${HOME} local "$1" sed done local
+		echo 2>/dev/null && 'quoted text'
+		2>/dev/null test then local x=1 echo x=1
+		done --verbose 2>/dev/null then --verbose --verbose grep "$1" --verbose |
+	${HOME} -eu $(pwd) ${HOME} printf awk --verbose "$1" && export 2>/dev/null
+	grep printf awk then export
+		done sed export "$1" sed $(pwd)
+	"$1" /usr/bin "$1" $(pwd) export x=1
+--verbose x=1 awk | export 'quoted text' sed awk "$@" | then
+	grep x=1 "$1" x=1 $(pwd) ${HOME} -eu ${HOME} echo printf -eu ${HOME} then local
+sed done && 'quoted text'
+	done | then readonly sed test 'quoted text' echo x=1 ${HOME} "$1"
+	local test grep sed "$@" 'quoted text'
+		test echo cd ${HOME} $(pwd) --verbose then 2>/dev/null export awk 2>/dev/null
+		x=1 readonly sed && --verbose
+"$@" "$1" printf done then cd
+	/usr/bin "$@" readonly printf cd /usr/bin $(pwd)
+done sed readonly test --verbose
+	then --verbose grep 2>/dev/null
+	--verbose && && && "$@" readonly printf sed /usr/bin "$@" local cd | --verbose
+	awk then then printf printf then /usr/bin "$1" export
+-eu "$@" /usr/bin printf ${HOME} cd 'quoted text' then echo --verbose
+	printf /usr/bin export $(pwd) cd "$1" done awk done "$1" "$1" echo grep
+-eu grep && && /usr/bin local
+"$@" readonly --verbose awk local echo $(pwd) local 2>/dev/null
+x=1 'quoted text' grep readonly -eu 'quoted text' then
+		/usr/bin ${HOME} "$1" --verbose
+then "$1" test -eu /usr/bin export export -eu awk
+		"$1" $(pwd) 'quoted text' then awk grep "$1" 2>/dev/null 2>/dev/null test
+	sed grep echo readonly
+		export $(pwd) done /usr/bin then grep 2>/dev/null -eu
+		sed done then echo x=1 'quoted text'
+		local 'quoted text' "$1"
+test test echo sed x=1 export export /usr/bin "$@" ${HOME}
+grep export printf done && --verbose awk
+	printf grep cd sed sed && x=1 readonly test export local $(pwd)
+		then done x=1 export echo sed -eu printf cd -eu echo | awk printf /usr/bin
+		| | $(pwd) 2>/dev/null then grep awk
+x=1 readonly "$@" $(pwd) | --verbose done ${HOME} x=1 -eu $(pwd)
+		echo "$1" local 2>/dev/null 'quoted text' test done 2>/dev/null 'quoted text' export
+'quoted text' printf "$@" /usr/bin && "$@" sed && --verbose
+readonly readonly && readonly awk local
+'quoted text' ${HOME} echo | $(pwd) /usr/bin $(pwd) echo readonly
+| 2>/dev/null export local test printf local test
+		/usr/bin | -eu done test export printf /usr/bin
+	2>/dev/null grep test
+${HOME} /usr/bin $(pwd) printf /usr/bin sed ${HOME}
+	export | grep 'quoted text' "$1" ${HOME} ${HOME} "$@" test "$@" 2>/dev/null
+		readonly && then $(pwd) local "$1" && x=1 readonly cd sed /usr/bin sed --verbose
+		printf echo test readonly then cd 2>/dev/null printf 2>/dev/null done 'quoted text'
+		"$1" $(pwd) grep awk test 2>/dev/null then readonly awk /usr/bin "$@" done sed
+local --verbose 2>/dev/null "$1" && readonly local printf printf
+local readonly 2>/dev/null done ${HOME} then
+	done cd x=1 ${HOME} "$@" && done x=1 cd then 'quoted text'
+then 'quoted text' test x=1 x=1 'quoted text' "$1" "$@" -eu $(pwd) readonly
+		printf awk | local 2>/dev/null export "$@" export export grep export 2>/dev/null
+	awk export readonly export && done /usr/bin $(pwd) echo cd local local "$@"
+-eu $(pwd) "$1" --verbose readonly "$1" local 'quoted text'
+	"$1" -eu $(pwd) "$@" local test then --verbose grep echo echo printf
+		x=1 local --verbose awk grep awk "$1" 2>/dev/null echo
+		x=1 done awk done awk done && 2>/dev/null --verbose
+	sed sed printf awk done "$@" "$@"
+	local "$1" /usr/bin x=1 --verbose done "$@" 'quoted text' ${HOME}
+$(pwd) awk && cd done && grep | then cd done $(pwd) test "$@" done
+		${HOME} $(pwd) echo export grep awk done 'quoted text'
+		$(pwd) "$@" export 2>/dev/null then 'quoted text'
+	awk cd "$1" printf && test
+-eu -eu "$@" printf local sed "$@" printf 2>/dev/null cd then readonly
+export "$@" ${HOME} readonly test --verbose /usr/bin "$@" grep x=1 then
+	${HOME} local -eu "$@" && && --verbose x=1 then done /usr/bin /usr/bin
+"$1" export local | awk cd local $(pwd) ${HOME}
+x=1 cd awk printf --verbose ${HOME} --verbose printf /usr/bin then
+		sed awk | /usr/bin "$@" printf local && local printf "$1"
+		readonly ${HOME} cd local 2>/dev/null
+--verbose test test test readonly "$@"
+readonly awk $(pwd) | sed done "$@" 2>/dev/null "$@"
+	"$1" awk $(pwd) echo -eu "$1" "$@" export printf 'quoted text'
+printf --verbose done -eu echo
+	2>/dev/null awk done then
+readonly done x=1 sed echo 'quoted text' readonly 2>/dev/null sed ${HOME}
+		$(pwd) && local 2>/dev/null $(pwd) printf printf && export && "$@" $(pwd) export
+	printf sed && 2>/dev/null local
+		| -eu echo "$@" 2>/dev/null ${HOME} export $(pwd) then
+		2>/dev/null grep sed then --verbose cd done test readonly "$@"
+'quoted text' readonly
+$(pwd) "$1" export 'quoted text'
+	echo done readonly "$1" echo printf /usr/bin sed
+		"$@" | echo grep echo x=1 'quoted text'
+		export 'quoted text' "$@" test "$@" "$@" local 'quoted text' echo
+"$1" readonly local --verbose
+test "$@" grep "$1" test /usr/bin $(pwd) --verbose export
+	sed readonly 'quoted text' export
+2>/dev/null && export /usr/bin /usr/bin /usr/bin cd -eu
+sed grep /usr/bin readonly
+		test printf ${HOME} --verbose 'quoted text'
+| 'quoted text' --verbose readonly cd test echo $(pwd) awk -eu -eu "$@"
+echo cd local && /usr/bin readonly
+		printf awk 'quoted text' 2>/dev/null 'quoted text'
+--verbose -eu awk | printf export test
+	&& 2>/dev/null test 'quoted text' $(pwd) grep then -eu readonly
+	"$1" export local 2>/dev/null awk "$1" | ${HOME} readonly ${HOME} grep 'quoted text'
+	readonly 'quoted text' "$1" /usr/bin local
+	echo sed 'quoted text' cd local done readonly 'quoted text' printf "$@"
+		| && export 2>/dev/null ${HOME}
+	x=1 -eu test 'quoted text' readonly then x=1 grep -eu local | printf sed
+	x=1 echo && 2>/dev/null
+	done export x=1 printf $(pwd) -eu x=1 -eu sed 'quoted text' done grep $(pwd)
+echo export $(pwd) && 2>/dev/null echo sed ${HOME} "$1" echo 2>/dev/null
+export 2>/dev/null 'quoted text'
+"$1" -eu grep echo echo x=1 $(pwd) printf printf 'quoted text' --verbose
+		sed 2>/dev/null "$@" grep "$1" done local export awk sed
+"$1" "$1" $(pwd) /usr/bin done 'quoted text' --verbose printf x=1 'quoted text'
+	grep ${HOME} -eu --verbose done x=1 && sed | export 2>/dev/null
+	$(pwd) "$1" "$@" --verbose sed echo local 'quoted text' "$@" x=1 "$1" ${HOME}
+		| 2>/dev/null 2>/dev/null && readonly
+	--verbose local $(pwd) 2>/dev/null local --verbose 2>/dev/null done
+$(pwd) /usr/bin cd $(pwd) --verbose
+	${HOME} export $(pwd) then done grep local 'quoted text' && "$@" "$1"
+	$(pwd) done export export 'quoted text'
+	printf "$1" awk $(pwd) export "$@" -eu
+	grep --verbose sed /usr/bin grep then --verbose sed "$@" $(pwd) 'quoted text'
+	--verbose export awk printf /usr/bin
+	2>/dev/null done test "$1" then then "$1" readonly /usr/bin "$@"
+	sed "$1" -eu local x=1 printf
+		2>/dev/null /usr/bin ${HOME} echo cd echo $(pwd) sed 2>/dev/null
+"$@" --verbose sed test local sed grep x=1 then "$1" "$1" cd local 2>/dev/null
+		printf printf echo readonly test then awk 'quoted text'
+--verbose readonly $(pwd) "$@"
+printf /usr/bin echo && "$1" "$1" "$@" printf 'quoted text' test
+-eu | readonly | export
+		&& "$@" -eu "$1" /usr/bin "$@" 2>/dev/null
+2>/dev/null awk | cd done "$@" export 'quoted text' --verbose local echo grep
+		cd x=1 awk test readonly cd awk x=1 --verbose 'quoted text'
+		sed 2>/dev/null grep && sed readonly done 2>/dev/null ${HOME} sed test readonly
+		-eu x=1 echo then readonly ${HOME} | grep cd 2>/dev/null export grep done --verbose
+echo then cd && "$1" grep awk sed cd printf &&
+		then printf printf then -eu | readonly export && cd "$1" done
+	-eu $(pwd) "$@" 'quoted text' readonly ${HOME}
+		$(pwd) -eu test done
+$(pwd) ${HOME} local x=1
+		grep "$@" -eu 2>/dev/null && export --verbose local printf printf
+		-eu x=1 export cd 2>/dev/null readonly awk
+		"$1" --verbose ${HOME} | local -eu then 2>/dev/null readonly grep grep awk
+	| -eu 2>/dev/null $(pwd) test grep
+cd printf 'quoted text' -eu readonly -eu cd "$1" | export awk "$@" "$1" done
+		readonly test | | 2>/dev/null sed test 'quoted text' local x=1 echo echo
+		sed echo ${HOME} x=1 $(pwd) 'quoted text'
+then cd ${HOME} then echo test ${HOME} echo
@@ -0,0 +1,2001 @@
+		test "$1" && -eu "$@" 'quoted text' awk ${HOME} ${HOME} grep export
+2>/dev/null "$@" cd 'quoted text' cd local readonly
+	printf | --verbose echo /usr/bin echo sed
+| /usr/bin | printf awk echo 'quoted text' test $(pwd) grep $(pwd) cd grep
+"$@" x=1 --verbose x=1 printf grep "$1" done /usr/bin ${HOME} $(pwd)
+		-eu && --verbose && readonly ${HOME} ${HOME} 'quoted text' ${HOME}
+		readonly test 2>/dev/null
+"$1" "$@" -eu $(pwd) "$@" /usr/bin && printf
+| done cd x=1 /usr/bin ${HOME} "$@" export done sed then echo "$@"
+	'quoted text' then echo export echo x=1 -eu 2>/dev/null printf
+	"$@" $(pwd) 2>/dev/null --verbose readonly test
+		'quoted text' awk | 2>/dev/null ${HOME} sed
+grep done test | /usr/bin -eu $(pwd) readonly
+		then 'quoted text' sed done then /usr/bin "$1" printf
+	&& printf -eu && -eu grep test cd --verbose printf sed grep
+		cd && | test sed 'quoted text' local /usr/bin local local test && ${HOME} awk /usr/bin
+		"$1" done echo export --verbose
+		then printf test test "$@" && then printf printf 2>/dev/null /usr/bin
+	awk test readonly /usr/bin /usr/bin cd readonly test "$1" /usr/bin /usr/bin
+		grep then "$@" export /usr/bin | echo grep "$1" local ${HOME} echo test
+$(pwd) | printf | echo --verbose readonly | 'quoted text' then grep
+	x=1 export | /usr/bin done readonly local readonly
+		test local local && export then grep then export local
+		printf -eu $(pwd) readonly echo test readonly echo -eu x=1 grep grep ${HOME} ${HOME}
+| $(pwd) && sed --verbose
+	readonly 2>/dev/null | && awk 'quoted text' 'quoted text' local 2>/dev/null
+		echo export x=1 --verbose printf "$@" local $(pwd) 'quoted text' && x=1 "$1"
+readonly /usr/bin grep --verbose "$@" cd x=1 && readonly -eu && local
+	cd export awk cd "$1" /usr/bin
+		sed grep -eu 'quoted text' 'quoted text' --verbose sed sed 2>/dev/null
+test /usr/bin $(pwd) /usr/bin -eu cd --verbose grep && then awk "$1"
+		$(pwd) cd awk cd --verbose x=1 awk x=1 then done awk echo readonly cd
+awk test test x=1 sed sed grep && -eu readonly $(pwd) x=1 'quoted text'
+	&& done && "$1" printf ${HOME} && | awk grep x=1 local readonly --verbose
+	"$@" echo -eu && then export "$@" && readonly x=1 local 'quoted text' "$1" local
+		&& x=1 "$1" x=1 -eu grep readonly
+	"$1" 'quoted text' $(pwd) sed cd /usr/bin $(pwd) export x=1 cd
+	"$1" readonly 2>/dev/null test ${HOME} export
+done $(pwd) 'quoted text' 2>/dev/null test done /usr/bin local && echo then awk
+| test && && done /usr/bin 'quoted text' done local
+test echo && readonly test test $(pwd) readonly /usr/bin
+	| export "$@" x=1 done test test cd export printf
+	grep && --verbose 2>/dev/null
+--verbose /usr/bin ${HOME} 'quoted text' export cd awk cd
+then readonly printf readonly /usr/bin
+then echo && printf &&
+		done test 2>/dev/null x=1 $(pwd) printf readonly --verbose x=1 awk awk | sed
+		done -eu readonly "$@"
+	/usr/bin export x=1 local -eu | "$@" "$@" -eu
+	&& echo $(pwd) sed local awk -eu "$1" 'quoted text' local
+	&& | export printf grep cd test -eu "$@" -eu grep "$@" 'quoted text'
+	local --verbose then export awk
+	cd export 'quoted text' then test -eu &&
+		echo echo ${HOME} "$1" && readonly
+	export ${HOME} test && awk -eu
+	"$@" /usr/bin --verbose 'quoted text'
+	export && then local cd then sed
+		--verbose "$1" --verbose | echo local --verbose local done
+	"$1" awk readonly 'quoted text'
+	cd 'quoted text' done cd then "$@" -eu grep x=1 /usr/bin x=1 $(pwd) readonly
+		grep "$@" -eu printf printf sed "$@" then x=1 cd | done ${HOME} --verbose
+		"$1" --verbose printf readonly x=1 'quoted text' "$1"
+test cd && | $(pwd) cd readonly then readonly local done done -eu grep
+echo "$@" 'quoted text' awk cd /usr/bin local x=1 readonly
+		echo /usr/bin "$@" test "$@" "$@" 2>/dev/null ${HOME}
+	done readonly cd readonly sed $(pwd) awk then printf grep
+	"$@" cd grep x=1 sed grep /usr/bin ${HOME} && local $(pwd)
+		'quoted text' local -eu readonly
+		local --verbose local printf local grep && | sed test
+		done readonly cd grep test printf /usr/bin 'quoted text' cd "$@" ${HOME} test
+		x=1 then cd $(pwd) && $(pwd) ${HOME} x=1 && "$1"
+| printf then --verbose -eu test /usr/bin grep --verbose "$1" "$1" local
+		'quoted text' --verbose "$1"
+		grep 2>/dev/null 'quoted text'
+sed /usr/bin echo echo export ${HOME} cd $(pwd)
+$(pwd) && "$1" readonly
+/usr/bin echo export printf sed /usr/bin "$1" readonly then /usr/bin awk
+		done awk "$@" sed && sed 'quoted text' export done --verbose then && 2>/dev/null
+"$@" | && && $(pwd) echo
+"$1" | export echo sed 'quoted text' export $(pwd) "$@" local |
+	sed test readonly then 2>/dev/null then test readonly --verbose sed "$@"
+local readonly $(pwd) test export x=1 done 2>/dev/null 'quoted text' sed
+	test local | -eu readonly $(pwd) grep then
+local "$@" echo -eu /usr/bin export -eu -eu local test awk done
+	printf ${HOME} awk done echo 'quoted text' local sed ${HOME} printf $(pwd) --verbose
+echo 2>/dev/null sed test then 2>/dev/null
+test sed -eu 'quoted text' cd then "$1" 'quoted text' printf
+		"$1" printf "$@" local cd 'quoted text'
+		-eu "$@" awk cd x=1 grep done --verbose printf readonly
+	-eu --verbose "$@" --verbose ${HOME} "$@" done && "$1" awk 2>/dev/null
+		then export "$@" ${HOME} echo 'quoted text' cd "$1" sed /usr/bin done export ${HOME}
+	sed then test $(pwd) printf
+		2>/dev/null 2>/dev/null printf echo $(pwd) "$@" $(pwd)
+		awk ${HOME} "$1" test grep cd cd ${HOME} test sed ${HOME}
+&& "$1" local "$1" test echo echo local /usr/bin then awk 2>/dev/null
+${HOME} ${HOME} printf
+	$(pwd) sed printf -eu cd then
+		$(pwd) grep sed done && echo && | $(pwd) x=1 readonly cd sed readonly x=1 done
+		test readonly test ${HOME} echo x=1 "$@"
+		readonly /usr/bin x=1 printf local /usr/bin done then done /usr/bin
+	readonly test ${HOME} awk then done
+		test printf -eu cd cd echo "$1" "$1" "$@" cd test
+$(pwd) -eu test 2>/dev/null ${HOME} then grep then cd grep "$1" sed echo "$@"
+	| awk local && | && echo
+&& x=1 readonly echo export 2>/dev/null cd echo /usr/bin sed /usr/bin | cd "$@"
+		--verbose printf -eu echo awk local cd $(pwd) 'quoted text'
+		done export export "$1" echo cd export awk cd cd local $(pwd) 2>/dev/null 'quoted text'
+2>/dev/null "$@" grep | test 'quoted text' 2>/dev/null x=1 cd $(pwd) done then
+		${HOME} "$@" "$@" test done export | test sed done
+	| test grep printf printf awk "$1" echo /usr/bin then x=1 ${HOME} -eu test
+		sed && readonly 2>/dev/null --verbose cd "$@" then "$@" echo "$@" done test readonly
+	2>/dev/null echo /usr/bin 'quoted text' readonly
+	sed test test --verbose "$@" readonly x=1
+	&& grep ${HOME} sed /usr/bin /usr/bin 'quoted text' export grep
+	2>/dev/null "$@" awk grep
+	2>/dev/null x=1 x=1 ${HOME} local printf $(pwd) sed "$1" $(pwd)
+	-eu printf -eu "$@" "$@" ${HOME} 2>/dev/null && -eu ${HOME} readonly "$@" 2>/dev/null
+		done x=1 then sed --verbose
+	/usr/bin "$@" readonly awk 2>/dev/null readonly -eu "$@" grep echo cd test
+	export "$1" x=1 --verbose --verbose awk test /usr/bin grep --verbose
+		sed x=1 done "$@" done --verbose 'quoted text' "$@" | then x=1
+		'quoted text' cd ${HOME} echo sed awk $(pwd) awk echo
+&& 2>/dev/null $(pwd)
+	2>/dev/null 2>/dev/null test x=1 'quoted text' readonly | /usr/bin ${HOME} |
+	then $(pwd) ${HOME} test 'quoted text'
+$(pwd) -eu 2>/dev/null ${HOME} test awk export done /usr/bin
+	--verbose test /usr/bin 'quoted text' "$@"
+${HOME} && export --verbose | readonly
+		awk cd cd $(pwd) sed cd --verbose grep | | awk grep grep then then
+/usr/bin -eu grep done done -eu
+		printf 'quoted text' |
+	printf "$@" -eu grep readonly cd grep export
+	test echo printf echo ${HOME} cd printf $(pwd) 'quoted text'
+	test grep /usr/bin cd sed readonly done "$@"
+-eu test ${HOME} /usr/bin x=1 'quoted text' 2>/dev/null
+		${HOME} echo "$@" -eu export echo readonly awk sed "$@"
+	'quoted text' $(pwd) | "$@" sed
+	'quoted text' sed && "$1" /usr/bin 2>/dev/null
+		awk then 'quoted text' "$@" done printf "$@" && sed echo export
+	local 2>/dev/null then sed cd grep --verbose
+		&& then | "$@" then x=1 $(pwd)
+	awk "$1" && export export printf | ${HOME} grep /usr/bin echo --verbose ${HOME}
+then /usr/bin sed $(pwd)
+	local then $(pwd) /usr/bin sed /usr/bin "$@" local
+	/usr/bin then done readonly sed awk test
+		&& 'quoted text' --verbose x=1 local 2>/dev/null
+${HOME} grep | export "$1" echo printf --verbose 2>/dev/null
+		then cd 'quoted text' done cd local cd | "$@" awk "$1" awk 2>/dev/null /usr/bin
+$(pwd) ${HOME} ${HOME} /usr/bin
+done | --verbose /usr/bin /usr/bin -eu then $(pwd) /usr/bin
+cd then /usr/bin cd test 'quoted text' grep test "$@" "$1"
+		awk grep $(pwd) "$1" && -eu x=1 -eu x=1 --verbose "$1" sed
+		2>/dev/null grep /usr/bin
+"$@" --verbose -eu readonly x=1 'quoted text' -eu
+	&& 2>/dev/null local done then cd -eu cd && x=1 test awk ${HOME}
+		&& test && /usr/bin readonly test cd sed $(pwd) cd ${HOME} printf 'quoted text'
+2>/dev/null sed grep readonly
+	'quoted text' export "$@" $(pwd) awk 'quoted text'
+	'quoted text' readonly 2>/dev/null export
+	"$1" 'quoted text' ${HOME} --verbose readonly
+"$1" --verbose ${HOME} && then | sed "$1" then -eu local --verbose "$1"
+		sed 2>/dev/null test $(pwd) -eu $(pwd) --verbose | test awk
+	cd "$1" 'quoted text' local test awk awk 'quoted text' --verbose -eu printf
+		echo 'quoted text' test -eu sed 2>/dev/null
+2>/dev/null | /usr/bin x=1
+	readonly test sed -eu --verbose
+		"$1" cd export test "$1"
+echo test test export -eu && printf
+	2>/dev/null export $(pwd) --verbose 'quoted text' test
+		export -eu /usr/bin && && 'quoted text'
+export cd export && -eu /usr/bin x=1 ${HOME} 2>/dev/null sed test readonly
+sed done readonly "$1" /usr/bin cd x=1 done test printf 'quoted text' -eu
+done "$1" done ${HOME} awk
+	"$@" /usr/bin /usr/bin x=1 sed local -eu sed then | grep cd then export awk
+		echo cd printf cd then test --verbose
+	/usr/bin then --verbose
+		'quoted text' done sed grep sed 'quoted text' "$@" test /usr/bin
+		--verbose local $(pwd) awk "$@" "$1" 'quoted text' readonly --verbose 'quoted text'
+		export test | && 'quoted text' printf $(pwd)
+	"$1" sed | awk x=1 local export cd test 2>/dev/null echo "$@" readonly && grep test
+		export "$@" cd sed then export x=1 && /usr/bin local then
+	grep test && then awk /usr/bin
+	test cd 'quoted text' && sed printf
+	test $(pwd) --verbose then "$@" x=1 done --verbose export then printf test
+		-eu grep | test awk "$@" "$1" -eu then test $(pwd) awk -eu 2>/dev/null echo
+	${HOME} --verbose readonly
+/usr/bin "$@" cd "$1" 'quoted text' printf
+	2>/dev/null readonly $(pwd) $(pwd) 2>/dev/null
+		--verbose sed ${HOME} done then "$1" test -eu printf 'quoted text'
+	$(pwd) sed readonly local --verbose then
+$(pwd) "$1" 'quoted text' 'quoted text' awk test
+		readonly grep ${HOME} cd "$1" 2>/dev/null --verbose --verbose
+	sed -eu "$1" --verbose grep then $(pwd) export export then done -eu "$@"
+		then export -eu echo 2>/dev/null
+awk -eu printf cd | sed "$1" $(pwd) --verbose test
+		"$1" ${HOME} "$@" echo --verbose "$1" "$@" $(pwd) local printf /usr/bin
+	then | awk && grep | echo awk "$1" test grep then && export readonly x=1 local
+		export && awk then /usr/bin 2>/dev/null --verbose
+		export done /usr/bin 'quoted text' echo
+		test 2>/dev/null done export echo readonly && $(pwd) /usr/bin done grep "$1"
+	awk local -eu "$1" grep cd readonly "$@" -eu && sed $(pwd) $(pwd) ${HOME}
+	-eu | /usr/bin /usr/bin cd sed "$1" local local --verbose
+2>/dev/null local awk grep printf printf printf x=1 echo 'quoted text' test
+		awk ${HOME} grep echo 2>/dev/null
+		| then printf then done echo ${HOME} sed && then 2>/dev/null
+	| test local /usr/bin local sed /usr/bin echo done done readonly test sed
+	'quoted text' && 2>/dev/null grep cd 'quoted text' readonly 2>/dev/null
+		"$1" local awk test -eu
+		cd readonly awk sed cd awk && | x=1
+		--verbose cd awk export local sed printf 'quoted text'
+readonly x=1 | cd test test 2>/dev/null "$@" /usr/bin "$1" 2>/dev/null
+sed then -eu done "$@" x=1 --verbose
+	2>/dev/null readonly then sed awk readonly printf then /usr/bin
+		&& test grep -eu | ${HOME} "$1" export "$1" local 2>/dev/null
+	2>/dev/null readonly &&
+	-eu x=1 cd "$@" readonly then sed echo echo /usr/bin 'quoted text'
+	-eu export awk local test | 'quoted text' --verbose grep 'quoted text'
+	awk 'quoted text' awk cd | && $(pwd) | sed ${HOME} test readonly
+	$(pwd) awk awk | /usr/bin
+	local 2>/dev/null printf 'quoted text' printf "$@" done -eu done
+		sed ${HOME} 'quoted text' printf $(pwd) then
+local ${HOME} | x=1 x=1 sed
+	then && $(pwd) readonly
+readonly $(pwd) "$1" "$@" &&
+$(pwd) -eu --verbose local 2>/dev/null "$@"
+		-eu export awk export && awk local -eu && -eu printf
+		$(pwd) $(pwd) grep x=1
+		printf "$1" 'quoted text' x=1 grep sed && then grep then x=1 test | && 'quoted text'
+	${HOME} readonly --verbose then | -eu x=1 grep
+	cd ${HOME} && echo --verbose 'quoted text'
+		test 2>/dev/null then grep sed then --verbose
+	${HOME} | 'quoted text' --verbose |
+		${HOME} --verbose test
+test --verbose grep ${HOME} --verbose cd "$1" readonly
+		then printf "$1" $(pwd) 'quoted text' printf readonly | "$1" | then sed -eu &&
+	done readonly sed x=1 --verbose sed && 2>/dev/null test cd | /usr/bin
+cd awk cd 2>/dev/null /usr/bin "$@" readonly grep -eu /usr/bin
+done printf grep "$@" done | readonly ${HOME} | local sed 2>/dev/null
+	&& 2>/dev/null grep sed grep -eu x=1 awk
+	-eu printf | sed && 'quoted text' then x=1 local then cd 'quoted text'
+	then sed done --verbose -eu
+		--verbose export 2>/dev/null local test printf 'quoted text' ${HOME} cd |
+	readonly test "$1" | 'quoted text' grep local then "$1"
+	${HOME} 'quoted text' x=1 echo -eu echo -eu awk printf then
+awk awk | -eu 2>/dev/null grep export readonly then
+"$1" ${HOME} sed grep 'quoted text' && cd
+${HOME} then printf printf | | && /usr/bin echo awk --verbose
+		readonly "$@" echo /usr/bin /usr/bin /usr/bin --verbose cd local /usr/bin
+	then test local /usr/bin "$@" readonly
+		x=1 then readonly -eu done local readonly
+"$@" then "$1" test x=1 "$1" local local "$@" test
+		2>/dev/null echo "$1" | cd echo "$1" 'quoted text' -eu
+| awk printf cd awk "$@" readonly
+		| done printf -eu | --verbose
+		cd 'quoted text' 2>/dev/null -eu x=1 x=1 readonly
+printf readonly -eu --verbose 2>/dev/null export -eu | sed x=1 "$@" sed
+	"$1" 'quoted text' 'quoted text' then && "$1"
+		${HOME} "$1" local printf sed && && 2>/dev/null x=1 readonly test sed
+x=1 readonly local /usr/bin -eu 'quoted text' && done --verbose local cd
+		"$1" | /usr/bin $(pwd) x=1 done && readonly -eu x=1
+--verbose echo "$@" export
+--verbose x=1 -eu test done done "$@" 2>/dev/null test readonly
+done "$@" echo readonly test readonly test readonly readonly 'quoted text' "$1"
+	test awk "$@" readonly -eu --verbose
+${HOME} test x=1 'quoted text'
+		"$@" $(pwd) sed && cd ${HOME} | grep
+	'quoted text' cd --verbose "$@" -eu test ${HOME}
+	readonly printf test $(pwd) -eu "$1" local
+	"$@" test test "$@" "$1" grep local export x=1 echo -eu --verbose
+		-eu then ${HOME} test $(pwd) grep "$1" --verbose cd awk test
+		cd cd x=1 export /usr/bin
+test awk 2>/dev/null local | awk "$1" test grep /usr/bin 2>/dev/null
+done $(pwd) x=1 cd done x=1 'quoted text' | sed awk grep done
+		printf 'quoted text' 'quoted text'
+		${HOME} 2>/dev/null cd then echo | sed /usr/bin
+-eu test readonly "$1" --verbose && local awk local ${HOME} x=1
+	export readonly -eu $(pwd) --verbose "$1" $(pwd) then readonly "$1"
+		local grep 'quoted text' export /usr/bin local 'quoted text' "$@" 2>/dev/null
+	/usr/bin && ${HOME} done printf ${HOME} then test cd test
+		grep $(pwd) printf export sed 2>/dev/null
+		cd export /usr/bin /usr/bin --verbose
+'quoted text' /usr/bin printf 2>/dev/null /usr/bin then
+	printf $(pwd) "$1" readonly | export test then
+	echo /usr/bin /usr/bin awk done ${HOME} x=1
+		cd done readonly && done 2>/dev/null
+		2>/dev/null local grep done -eu readonly x=1 done
+	${HOME} test 'quoted text'
+${HOME} export awk /usr/bin awk 'quoted text' && $(pwd) /usr/bin
+	| ${HOME} 2>/dev/null -eu | printf "$@" local
+test && readonly then /usr/bin test readonly awk | && awk | done -eu local grep
+2>/dev/null grep 2>/dev/null $(pwd) done "$1" cd | test 'quoted text'
+		"$1" echo --verbose 'quoted text'
+echo export export awk
+"$1" export --verbose 'quoted text'
+local cd echo local $(pwd) cd then cd local --verbose
+x=1 /usr/bin local "$@" readonly -eu sed
+		test ${HOME} then readonly --verbose
+awk test | -eu "$1" local echo test
+		local done --verbose | -eu -eu cd "$@" test && "$1"
+		export ${HOME} cd | printf test 'quoted text' cd awk test "$@"
+awk "$1" cd awk done --verbose --verbose
+--verbose awk done --verbose | "$1" export test grep
+	"$@" printf 2>/dev/null awk local ${HOME} /usr/bin test
+grep ${HOME} done readonly export grep /usr/bin then --verbose
+		$(pwd) 2>/dev/null /usr/bin sed 2>/dev/null
+		${HOME} "$@" x=1 --verbose --verbose
+-eu test export export "$@"
+		$(pwd) awk cd ${HOME} test -eu ${HOME}
+test local "$@" awk 'quoted text' $(pwd) local -eu local
+local printf | "$1" grep echo grep
+	sed $(pwd) 2>/dev/null x=1 echo then 2>/dev/null cd grep echo x=1 echo $(pwd) sed
+	printf "$1" cd 'quoted text' echo export grep
+	local $(pwd) | /usr/bin
+	local && readonly awk then /usr/bin $(pwd) then $(pwd)
+&& | && 2>/dev/null readonly echo ${HOME} /usr/bin && echo x=1 then 'quoted text'
+echo printf grep readonly && | sed
+	2>/dev/null grep --verbose
+readonly done cd test cd -eu | readonly x=1 --verbose 2>/dev/null done x=1 |
+		echo awk grep "$1" readonly | --verbose ${HOME}
+	&& -eu --verbose local cd sed done then sed
+grep echo | awk cd && then then local x=1 awk
+		printf local cd $(pwd)
+	"$@" && test 'quoted text' | --verbose "$1" printf then
+	cd grep test --verbose --verbose $(pwd)
+echo /usr/bin ${HOME} done
+| 'quoted text' -eu "$1" --verbose ${HOME}
+${HOME} test readonly local test done export 'quoted text' "$@"
+'quoted text' && ${HOME} echo awk --verbose export && cd --verbose
+test awk ${HOME} local
+		awk export --verbose export /usr/bin -eu /usr/bin
+		export && cd ${HOME} -eu "$1" /usr/bin -eu 'quoted text' --verbose
+		export "$@" $(pwd) $(pwd) ${HOME}
+		readonly -eu printf 'quoted text' -eu 2>/dev/null
+	done test -eu readonly awk && grep awk grep
+		"$1" readonly done sed && sed test echo 'quoted text' test
+test export readonly x=1 cd "$1" && printf echo printf grep "$1" then x=1
+		"$@" test --verbose echo sed | "$1" awk cd 'quoted text'
+export then readonly ${HOME} 2>/dev/null | then printf
+	echo local export test $(pwd) sed "$1" test then printf readonly | "$@" printf
+		"$1" sed 'quoted text' done
+${HOME} | && local then awk export readonly 'quoted text'
+'quoted text' $(pwd) awk cd grep | x=1 local
+	export cd /usr/bin 'quoted text' done $(pwd)
+		$(pwd) | then /usr/bin $(pwd) "$@" local sed cd printf 2>/dev/null 'quoted text'
+'quoted text' $(pwd) "$1" -eu cd 'quoted text' grep | $(pwd)
+"$@" "$1" | done printf $(pwd) grep
+		then done 'quoted text' --verbose echo awk 'quoted text' 2>/dev/null
+		export /usr/bin x=1 grep readonly "$@" printf | 2>/dev/null 'quoted text'
+&& && --verbose --verbose ${HOME} && test echo $(pwd) local $(pwd)
+	"$1" cd "$1" test --verbose && printf | 'quoted text'
+	"$@" echo export | --verbose ${HOME} -eu "$@" cd | cd printf
+| test sed local "$1" --verbose 2>/dev/null
+cd 'quoted text' 2>/dev/null export grep x=1 readonly x=1 /usr/bin
+	--verbose cd sed then export sed && | done --verbose sed
+	2>/dev/null ${HOME} awk x=1 -eu --verbose
+&& "$1" local export local readonly done cd x=1 'quoted text' && printf
+x=1 cd --verbose local readonly $(pwd) -eu && echo export local
+	&& cd --verbose test $(pwd) grep then echo grep local 2>/dev/null && 'quoted text'
+| grep && | && export ${HOME}
+	| echo cd export && "$1" && then cd $(pwd) echo 2>/dev/null export
+echo "$@" export then 'quoted text' |
+	test awk /usr/bin sed test awk "$@"
+		&& echo $(pwd) echo 'quoted text'
+		-eu echo done 2>/dev/null export done
+${HOME} readonly -eu export /usr/bin export ${HOME} test $(pwd)
+	awk $(pwd) sed export test |
+		2>/dev/null local test -eu grep done then 2>/dev/null
+		/usr/bin export $(pwd) --verbose x=1 && | -eu | sed "$1" 2>/dev/null "$1" "$@"
+	"$@" "$@" cd "$@" cd test $(pwd) | awk "$@" 2>/dev/null x=1
+		"$@" readonly $(pwd) | done /usr/bin 'quoted text' | --verbose "$1" then echo
+local grep x=1 grep cd 2>/dev/null done && --verbose cd echo grep done |
+$(pwd) $(pwd) grep sed echo
+-eu grep | awk local local && done local readonly x=1 -eu && printf x=1 done export
+"$@" sed grep grep echo then awk 2>/dev/null readonly 2>/dev/null
+		${HOME} && printf --verbose local local then printf $(pwd) done x=1 printf --verbose
+	awk -eu cd "$1" x=1 readonly
+	awk ${HOME} done printf echo echo "$@" awk done x=1 printf
+awk printf sed "$@" cd awk local -eu test local
+		-eu 2>/dev/null export local -eu /usr/bin -eu
+	/usr/bin printf done cd 2>/dev/null
+	-eu grep cd readonly grep done test then "$1" && sed ${HOME} "$1" 2>/dev/null
+	"$@" $(pwd) done grep local ${HOME}
+	test x=1 "$@" 'quoted text' done export test
+2>/dev/null local 'quoted text' export x=1 echo
+	export done ${HOME} printf /usr/bin
+	'quoted text' cd then x=1 export done local 'quoted text'
+	| cd grep sed done | 2>/dev/null awk -eu then |
+	/usr/bin | cd -eu cd readonly export ${HOME} echo sed cd 2>/dev/null
+	x=1 2>/dev/null && cd test cd -eu echo --verbose | sed |
+	--verbose /usr/bin readonly "$1" "$@" awk $(pwd)
+printf "$1" "$@" local then cd echo "$1" sed grep && then | export local sed
+"$@" done /usr/bin awk export 'quoted text' local /usr/bin test
+		cd local 'quoted text' export test | "$@" grep sed 2>/dev/null printf
+printf local done export $(pwd)
+grep | "$1" local cd sed $(pwd) 'quoted text' 2>/dev/null --verbose
+echo -eu done $(pwd) then echo && ${HOME} local printf $(pwd) && && readonly
+	"$1" awk grep local readonly done "$@" sed 'quoted text'
+	then readonly printf echo then | $(pwd) 2>/dev/null done | readonly x=1 2>/dev/null
+	--verbose /usr/bin "$@" cd
+		'quoted text' | sed local test
+"$1" printf x=1 $(pwd) | /usr/bin export "$@" grep export cd
+	&& test ${HOME} /usr/bin printf "$1" echo then
+		--verbose test ${HOME} $(pwd) awk local x=1 awk
+$(pwd) sed test then 2>/dev/null "$@" local 2>/dev/null
+	| $(pwd) done export grep awk
+		test | echo printf export ${HOME} $(pwd) readonly && ${HOME} "$@"
+	${HOME} export 'quoted text' $(pwd) printf echo
+	test --verbose | ${HOME} "$@" test then | && done cd echo "$@" done
+-eu ${HOME} grep test
+		"$@" cd cd --verbose ${HOME} | 'quoted text' readonly sed "$@" --verbose
+		/usr/bin done 2>/dev/null
+		"$@" 2>/dev/null "$@" cd $(pwd) done awk
+${HOME} awk /usr/bin cd $(pwd) ${HOME} export
+	readonly | readonly -eu -eu $(pwd) 2>/dev/null
+	test printf printf /usr/bin
+		awk /usr/bin 2>/dev/null --verbose x=1 local cd | x=1 | $(pwd) | $(pwd) local
+		-eu ${HOME} "$@" "$@" --verbose | $(pwd) -eu && test
+export done awk 'quoted text' done
+	/usr/bin readonly 2>/dev/null $(pwd) cd ${HOME}
+		/usr/bin "$@" 2>/dev/null
+"$1" "$@" cd done local
+		echo grep printf | "$@"
+"$1" "$@" local awk then sed test cd printf done printf "$1" && | awk
+		--verbose grep | sed /usr/bin 2>/dev/null grep sed ${HOME} 'quoted text'
+		/usr/bin x=1 x=1 done export /usr/bin done local ${HOME} "$@" 'quoted text' cd
+echo local "$1" "$@" --verbose printf
+		2>/dev/null readonly done
+	x=1 "$1" 2>/dev/null | x=1 -eu export
+		test then cd -eu 'quoted text' export $(pwd) then "$@" done export echo -eu sed
+| --verbose $(pwd) "$@" 'quoted text' grep
+-eu done sed "$1" printf test | | cd readonly /usr/bin echo done 'quoted text'
+	'quoted text' printf readonly
+	grep 'quoted text' sed "$@" --verbose cd awk /usr/bin cd test 2>/dev/null
+		'quoted text' awk "$1" export
+	'quoted text' printf done -eu cd cd local ${HOME} --verbose local "$1" "$@"
+	| cd cd "$@" readonly 2>/dev/null grep -eu "$@" --verbose 2>/dev/null "$@"
+	test sed export printf local test $(pwd) ${HOME} x=1
+	then printf ${HOME} cd 'quoted text' awk export echo /usr/bin -eu
+	local --verbose cd export printf
+x=1 printf done done export awk $(pwd) then done readonly && grep printf test
+&& $(pwd) && /usr/bin --verbose sed "$1" /usr/bin -eu && printf grep 2>/dev/null
+readonly grep awk $(pwd) local cd
+	local "$@" --verbose $(pwd) export awk readonly printf local printf
+		$(pwd) done cd printf readonly "$1" | sed sed && --verbose $(pwd)
+	$(pwd) ${HOME} grep cd done local sed
+		$(pwd) cd x=1 $(pwd) awk -eu printf x=1 2>/dev/null sed $(pwd) $(pwd) 'quoted text'
+	'quoted text' ${HOME} ${HOME} export export && x=1 readonly --verbose local
+		"$1" test printf ${HOME} "$1" x=1 -eu echo awk local "$1" $(pwd)
+	printf readonly local awk -eu $(pwd) done 'quoted text' 2>/dev/null
+-eu test | /usr/bin cd --verbose then $(pwd) x=1 'quoted text' awk 'quoted text'
+		local cd 'quoted text' echo -eu readonly $(pwd) printf $(pwd) printf export "$@"
+${HOME} then export 2>/dev/null ${HOME} && echo 'quoted text' -eu done
+		2>/dev/null grep sed echo $(pwd) x=1
+		/usr/bin -eu -eu | 2>/dev/null 'quoted text' | cd x=1 cd sed cd echo && --verbose
+	2>/dev/null printf done grep test
+sed cd done ${HOME} $(pwd) cd ${HOME} 2>/dev/null $(pwd) printf
+		done readonly cd done x=1 --verbose printf --verbose export awk
+	2>/dev/null sed cd export 2>/dev/null printf cd
+		export awk 2>/dev/null | ${HOME} sed cd ${HOME}
+		--verbose "$1" sed ${HOME} awk readonly then awk | then "$1" cd "$@" /usr/bin
+then "$1" awk awk --verbose export ${HOME} x=1 local cd then
+		x=1 done -eu sed cd $(pwd) local echo then --verbose && grep cd then "$1"
+	x=1 local "$@" --verbose readonly awk ${HOME}
+		'quoted text' x=1 local cd local test local printf $(pwd) cd echo "$@"
+'quoted text' grep done export $(pwd) && /usr/bin | 2>/dev/null
+	readonly -eu $(pwd) export export | --verbose
+	test -eu readonly printf local readonly grep | x=1 | 2>/dev/null
+		sed echo then sed readonly | 'quoted text' cd local
+	"$@" "$@" done x=1 2>/dev/null --verbose sed grep -eu /usr/bin local ${HOME}
+	done grep /usr/bin $(pwd) awk export "$@" "$@" local $(pwd) --verbose
+	printf awk 2>/dev/null -eu ${HOME} local ${HOME} echo /usr/bin -eu
+	| | 'quoted text' awk printf then sed readonly readonly $(pwd) sed
+2>/dev/null echo grep x=1 "$1" then "$@" local
+		x=1 done && -eu x=1 'quoted text' export /usr/bin | "$@" "$1" cd local 2>/dev/null
+	awk 'quoted text' -eu local then --verbose 'quoted text' sed ${HOME}
+	| done sed printf test local "$1"
+	local "$1" done 'quoted text' awk echo && cd --verbose
+awk --verbose readonly test awk && grep sed export awk test "$@" awk sed cd --verbose
+	-eu --verbose --verbose -eu echo test local local
+$(pwd) -eu /usr/bin then then echo
+cd "$@" "$1" export -eu "$@" printf then && 'quoted text'
+	grep awk "$@" echo "$1" readonly x=1 readonly ${HOME} awk export
+	x=1 grep 'quoted text' ${HOME} $(pwd) echo 2>/dev/null
+local x=1 ${HOME} 'quoted text' | -eu -eu
+	test 2>/dev/null "$@" awk
+		printf --verbose grep $(pwd) -eu "$1" x=1 "$@" export |
+	${HOME} local --verbose | ${HOME} grep local /usr/bin && | /usr/bin cd 'quoted text'
+sed | cd ${HOME} --verbose echo cd sed printf echo 'quoted text'
+export readonly | 'quoted text' grep --verbose then -eu then grep ${HOME} ${HOME}
+echo then "$@" ${HOME} cd then cd && printf test $(pwd) && echo printf then
+		done awk "$1" awk test
+"$@" 'quoted text' export readonly awk
+$(pwd) sed --verbose readonly test
+	echo readonly test 'quoted text' cd "$1" readonly 'quoted text' x=1 printf
+	echo then readonly local | grep
+2>/dev/null then export && then sed printf | readonly cd /usr/bin ${HOME} "$@"
+| /usr/bin | cd grep 'quoted text'
+'quoted text' $(pwd) 2>/dev/null x=1
+test --verbose | $(pwd) && 'quoted text' then x=1 ${HOME} cd
+		echo awk x=1 'quoted text' awk "$@" test $(pwd) "$1" done export x=1 awk printf
+	export | cd ${HOME} -eu sed then local done | x=1 grep
+		${HOME} --verbose grep local done 2>/dev/null $(pwd) --verbose test
+	-eu then done local local readonly && 'quoted text' /usr/bin printf "$1"
+$(pwd) ${HOME} test "$@" /usr/bin then && --verbose
+		x=1 /usr/bin cd local
+	local | "$@" | done "$1" echo x=1 -eu awk "$@"
+'quoted text' && 'quoted text' printf && "$1"
+		-eu && test printf x=1 export
+local && local then "$1" done 2>/dev/null && grep $(pwd)
+	grep x=1 test "$@" 2>/dev/null echo done grep echo -eu | "$1"
+		printf local --verbose 'quoted text' "$1" printf done 2>/dev/null
+		| --verbose && test cd $(pwd) test sed 2>/dev/null
+echo "$@" readonly -eu cd
+		echo --verbose awk test then export $(pwd) 2>/dev/null
+--verbose sed "$@" grep /usr/bin sed printf | | done 2>/dev/null grep sed
+	&& printf /usr/bin "$@" --verbose echo ${HOME} then 'quoted text'
+$(pwd) "$@" -eu grep | "$1"
+"$@" sed awk echo -eu local echo /usr/bin then x=1 export
+done && readonly printf 2>/dev/null printf -eu local
+echo export 'quoted text' readonly ${HOME}
+		$(pwd) 'quoted text' cd printf ${HOME}
+	awk readonly echo x=1 $(pwd) "$1"
+		grep test awk local then 2>/dev/null
+		echo awk "$@" | then grep /usr/bin echo printf "$@" printf
+	&& $(pwd) && test sed x=1 && "$@" awk | 2>/dev/null ${HOME} printf sed 2>/dev/null
+		then $(pwd) sed ${HOME} ${HOME} then printf 2>/dev/null
+		| && sed -eu "$1" readonly cd grep
+awk export export grep 'quoted text' | && grep then -eu sed
+grep 2>/dev/null awk then -eu local $(pwd) "$@" 'quoted text' x=1 $(pwd)
+grep readonly "$@" sed grep 'quoted text' && local ${HOME} test /usr/bin
+	printf | && sed "$@" sed 'quoted text' sed grep ${HOME} 'quoted text'
+		local | readonly "$1" "$1" | awk x=1 grep
+		'quoted text' awk 2>/dev/null 2>/dev/null
+	${HOME} then awk "$1" "$1" x=1 test printf awk /usr/bin
+		printf cd grep --verbose cd $(pwd) "$1" "$@" cd
+	$(pwd) --verbose local 2>/dev/null then 'quoted text' done export
+	readonly ${HOME} awk "$1" printf readonly $(pwd) --verbose
+	'quoted text' done cd awk ${HOME}
+	| && 2>/dev/null x=1 grep cd "$@" "$@" printf
+		| then "$1" "$@" ${HOME} | $(pwd) 2>/dev/null "$@" 'quoted text'
+$(pwd) cd test $(pwd) done ${HOME} then readonly && && grep readonly
+	test grep -eu 'quoted text' /usr/bin /usr/bin
+local 'quoted text' x=1 then then grep 2>/dev/null "$@" echo grep local $(pwd)
+		'quoted text' | echo export 'quoted text'
+	--verbose x=1 && "$1" readonly
+"$@" echo cd x=1 /usr/bin 2>/dev/null x=1 x=1 && grep grep --verbose
+/usr/bin && $(pwd) readonly /usr/bin "$1" cd sed printf local test && export done
+		"$@" grep cd ${HOME} cd sed ${HOME} test
+	$(pwd) ${HOME} 2>/dev/null
+2>/dev/null -eu readonly x=1 done awk done awk /usr/bin export echo printf
+	$(pwd) 2>/dev/null done
+	/usr/bin ${HOME} "$@" x=1 && --verbose readonly cd done $(pwd) readonly
+		awk local --verbose export "$1" 'quoted text'
+	cd readonly $(pwd) printf --verbose x=1 grep
+local "$@" echo echo done --verbose | local
+	/usr/bin echo "$1" 2>/dev/null | echo "$1" | && | "$1" readonly local grep
+local 2>/dev/null awk && -eu readonly
+	sed sed cd /usr/bin grep printf /usr/bin x=1 cd sed readonly export /usr/bin sed
+		| ${HOME} ${HOME} readonly && "$1" /usr/bin local 'quoted text'
+export readonly -eu "$1" "$1" readonly
+export then grep readonly printf /usr/bin local printf
+local -eu sed -eu echo "$1" export ${HOME} done local done x=1 then 2>/dev/null
+		echo test /usr/bin "$@" printf "$1" printf | awk cd printf test
+${HOME} grep "$@" sed done test /usr/bin
+-eu "$1" -eu echo printf export grep test sed then
+		printf done 2>/dev/null cd -eu export ${HOME} readonly 2>/dev/null printf
+"$@" test -eu --verbose then done "$1" 2>/dev/null -eu readonly $(pwd)
+-eu | printf printf sed then --verbose then
+then grep done printf $(pwd) "$1" echo && awk echo ${HOME}
+		'quoted text' export | x=1 readonly sed "$1" then export awk test export
+		sed done 'quoted text' --verbose && -eu export
+	readonly grep 'quoted text' readonly
+		export && 2>/dev/null awk export --verbose awk ${HOME}
+	awk local /usr/bin /usr/bin grep awk ${HOME} grep done test
+		export printf 'quoted text' awk | done && grep export echo -eu ${HOME}
+	then done cd printf local | && |
+x=1 && echo 'quoted text' ${HOME}
+	-eu awk x=1 ${HOME} cd $(pwd)
+	/usr/bin --verbose ${HOME}
+	| printf --verbose local "$@" awk "$@" -eu "$1" local | test readonly
+		$(pwd) 'quoted text' 2>/dev/null x=1 grep
+		$(pwd) local "$1" "$1"
+then cd grep awk sed local /usr/bin 'quoted text' x=1 /usr/bin sed local $(pwd)
+| printf done "$1" /usr/bin printf awk 2>/dev/null then ${HOME}
+		grep test -eu /usr/bin local echo local ${HOME}
+	"$1" local grep 'quoted text' sed ${HOME} printf local $(pwd)
+	$(pwd) printf awk printf then printf grep $(pwd) awk cd done
+	then -eu $(pwd) ${HOME} -eu then awk 'quoted text'
+"$@" grep done 2>/dev/null && then x=1
+		--verbose | -eu test | --verbose 'quoted text' --verbose cd grep sed -eu
+"$1" cd echo local -eu grep | --verbose grep echo
+	test /usr/bin -eu cd 2>/dev/null
+	readonly awk cd ${HOME} &&
+$(pwd) then -eu x=1 local
+		local done -eu -eu local /usr/bin
+		test ${HOME} "$@" && test x=1 "$1" test "$1"
+		$(pwd) then grep readonly x=1 awk readonly sed | echo | /usr/bin ${HOME} echo
+"$@" then readonly | echo /usr/bin grep
+		awk 'quoted text' 2>/dev/null $(pwd) | grep
+		"$1" then 2>/dev/null 'quoted text' $(pwd)
+		-eu sed test export 'quoted text' ${HOME} "$1" -eu |
+		--verbose local | --verbose test local | x=1 sed 2>/dev/null
+"$1" export test "$1" cd done grep then sed --verbose x=1 --verbose
+echo 'quoted text' echo
+		export "$1" cd "$@" && x=1 grep
+"$@" ${HOME} printf awk -eu /usr/bin 'quoted text' local grep printf $(pwd) awk
+	sed sed 2>/dev/null then sed 'quoted text' cd 2>/dev/null -eu export done
+then 2>/dev/null 'quoted text' grep export done echo
+local done local 2>/dev/null 2>/dev/null x=1 x=1 grep grep /usr/bin
+		/usr/bin test ${HOME} "$1" /usr/bin then --verbose | then echo 'quoted text'
+		${HOME} "$1" "$1" | 2>/dev/null ${HOME} printf sed
+		then -eu readonly "$1" test $(pwd) done export
+| echo ${HOME} local awk grep awk --verbose
+test -eu && "$1" "$1" readonly ${HOME} sed test readonly 2>/dev/null
+	test --verbose "$@" echo echo awk "$1" 'quoted text'
+"$@" /usr/bin then 2>/dev/null --verbose && echo done printf -eu sed export
+		readonly cd --verbose done 2>/dev/null 'quoted text' then x=1 && awk $(pwd)
+awk local --verbose "$@" export export done done "$@" -eu "$@" local -eu then printf
+		printf done cd readonly 'quoted text' $(pwd) -eu | test sed readonly printf grep
+test grep /usr/bin --verbose grep $(pwd) | ${HOME} then test grep grep
+		then then 2>/dev/null ${HOME} echo
+$(pwd) done cd -eu awk 2>/dev/null && test sed export
+2>/dev/null "$@" "$@" echo -eu cd grep &&
+$(pwd) export -eu ${HOME} printf --verbose "$1" 'quoted text' "$@" printf
+'quoted text' grep sed
+		'quoted text' readonly ${HOME} cd 'quoted text'
+		cd "$1" sed test "$@" | echo ${HOME} printf $(pwd)
+	test grep /usr/bin local "$1"
+done done local 2>/dev/null | --verbose $(pwd)
+		printf test && /usr/bin then sed echo local && | cd /usr/bin ${HOME} sed "$1" sed
+--verbose $(pwd) && grep then grep printf 'quoted text' "$@" sed done printf
+	--verbose awk "$@" done 2>/dev/null local
+		echo 'quoted text' /usr/bin
+-eu -eu x=1 test export printf sed
+	grep --verbose "$@" printf && done | 2>/dev/null cd sed readonly
+		--verbose export sed sed x=1 "$@"
+cd cd ${HOME} then 2>/dev/null
+		echo awk | then "$@" grep export done -eu done 'quoted text'
+	-eu -eu | test grep local && readonly then --verbose 2>/dev/null
+	| readonly && 'quoted text' "$@" test done cd
+	awk "$@" done | printf 'quoted text' printf
+	local /usr/bin printf $(pwd) 'quoted text'
+	2>/dev/null echo export printf | $(pwd) awk 'quoted text' |
+		local ${HOME} "$1" 2>/dev/null &&
+$(pwd) ${HOME} readonly done echo cd ${HOME} -eu test ${HOME} 'quoted text'
+local -eu test $(pwd) "$@" 2>/dev/null export
+	&& 'quoted text' awk printf echo "$1" /usr/bin printf x=1
+-eu printf 2>/dev/null | | --verbose local echo awk
+export done awk then 2>/dev/null | /usr/bin 2>/dev/null /usr/bin ${HOME} x=1 export
+	local --verbose 'quoted text'
+	grep printf "$1" /usr/bin 2>/dev/null
+	/usr/bin --verbose printf
+then && sed sed grep "$1" test
+		/usr/bin export grep then "$1" local test cd -eu grep &&
+'quoted text' echo readonly export 'quoted text' then x=1 /usr/bin readonly
+	${HOME} test 2>/dev/null
+sed export printf $(pwd)
+	x=1 sed x=1 && cd readonly awk echo $(pwd) 'quoted text' cd export 2>/dev/null
+		cd && export && done awk 2>/dev/null /usr/bin x=1 --verbose "$1" awk
+		x=1 /usr/bin | ${HOME} readonly readonly
+		x=1 "$1" "$1" echo test cd readonly readonly printf
+&& grep local ${HOME} cd
+"$@" | cd /usr/bin 'quoted text' x=1 | /usr/bin echo then test "$1"
+	--verbose then "$@" export export /usr/bin
+export "$1" "$1" /usr/bin readonly
+-eu printf $(pwd) -eu cd local awk grep x=1 | "$1" x=1 done 'quoted text'
+	'quoted text' grep && /usr/bin printf export
+	'quoted text' 2>/dev/null
+		done $(pwd) "$1" 'quoted text'
+local test $(pwd) -eu awk -eu x=1 cd then grep -eu
+	export then then "$1" done /usr/bin export -eu "$1" ${HOME} readonly export 2>/dev/null
+		-eu printf grep /usr/bin test 2>/dev/null
+cd /usr/bin awk x=1 then && then 2>/dev/null done | cd
+x=1 $(pwd) /usr/bin then awk
+		"$1" local printf local test done x=1 2>/dev/null -eu | &&
+${HOME} printf echo export sed local ${HOME}
+test sed | grep local ${HOME}
+| cd readonly 'quoted text' "$1" awk cd sed awk
+echo 'quoted text' ${HOME} export awk 'quoted text'
+	-eu printf readonly 'quoted text' done | "$1" 2>/dev/null | sed export done
+		"$@" | -eu export test awk cd "$@" | --verbose awk "$1" --verbose readonly local
+		x=1 x=1 "$1" test awk printf x=1 done then then x=1 "$1" echo 'quoted text'
+		2>/dev/null | echo cd cd $(pwd) /usr/bin
+sed "$1" sed awk "$1" | done sed echo "$@"
+		--verbose x=1 echo | done export
+test | 'quoted text' grep cd 'quoted text' printf cd local -eu
+		x=1 readonly test readonly printf cd && | "$1" local 2>/dev/null ${HOME} --verbose
+/usr/bin printf awk printf ${HOME} ${HOME} 'quoted text' local awk
+		then -eu sed | | grep x=1 printf done export ${HOME} printf printf export cd $(pwd)
+readonly ${HOME} then && local $(pwd) awk export --verbose && "$1" sed cd export
+	&& test | /usr/bin test --verbose sed
+--verbose | awk awk then $(pwd) $(pwd) export export
+'quoted text' readonly --verbose && $(pwd) sed /usr/bin ${HOME}
+x=1 "$@" 2>/dev/null printf local | && "$@" grep && 2>/dev/null local
+	"$1" && cd && test sed "$@"
+test test 'quoted text'
+	'quoted text' readonly ${HOME} "$1" && cd && -eu sed done
+	grep echo grep "$1" done && "$@" | cd cd x=1 -eu -eu "$1" 'quoted text' grep 'quoted text'
+then test "$1" 'quoted text' --verbose
+	${HOME} awk "$1" export echo export 'quoted text' grep
+		"$1" 'quoted text' grep test cd && printf export then
+	echo "$1" && 'quoted text' cd x=1 --verbose test printf sed
+		&& local echo --verbose ${HOME} cd | printf -eu "$@" /usr/bin test
+	-eu cd grep export readonly
+--verbose --verbose /usr/bin
+	${HOME} echo grep cd && cd done printf echo ${HOME} && x=1 local
+	${HOME} sed grep local -eu 2>/dev/null
+cd | sed cd done 2>/dev/null "$1" readonly --verbose
+		sed "$@" done export /usr/bin /usr/bin done cd export
+		'quoted text' echo "$@" x=1 cd then 2>/dev/null done
+2>/dev/null -eu export cd "$@" cd 2>/dev/null "$1"
+		/usr/bin echo done -eu then && 2>/dev/null ${HOME} "$1" local grep grep done
+	cd -eu then awk grep echo &&
+	'quoted text' cd && then
+&& done x=1 printf grep | export 'quoted text' echo
+		'quoted text' $(pwd) x=1 export "$@" awk
+		test sed grep test readonly
+	test echo cd printf test
+$(pwd) echo 2>/dev/null "$1" export x=1 2>/dev/null
+		| then cd 2>/dev/null /usr/bin
+readonly awk /usr/bin 2>/dev/null ${HOME} && | 2>/dev/null awk done echo
+	done grep && 2>/dev/null 2>/dev/null
+then | readonly readonly ${HOME} done 'quoted text'
+		cd -eu readonly ${HOME} --verbose x=1 sed -eu grep printf
+		echo then cd echo ${HOME} sed /usr/bin
+		"$@" readonly && "$1" then test printf --verbose cd
+	| "$@" "$@" $(pwd) 'quoted text' && echo
+printf printf x=1 cd export local x=1 echo then "$@" | printf
+		test done printf then test 'quoted text'
+		export "$1" awk test ${HOME} done
+	printf test "$@" awk -eu x=1 'quoted text' "$@" x=1 && $(pwd) "$1" printf sed
+printf grep ${HOME} 'quoted text'
+'quoted text' $(pwd) -eu "$@" "$1" "$@" | sed done "$1" -eu export grep
+		${HOME} echo cd /usr/bin
+		/usr/bin x=1 printf printf "$@" 2>/dev/null
+	sed awk x=1 "$1" done test
+		awk then echo ${HOME} --verbose && echo sed x=1 'quoted text'
+| cd sed 2>/dev/null $(pwd) grep "$@"
+local echo printf printf grep sed
+		printf test /usr/bin /usr/bin test awk export
+		local then | ${HOME}
+echo echo /usr/bin readonly -eu $(pwd) awk test sed | ${HOME} sed && x=1
+	${HOME} echo ${HOME} -eu awk && export -eu readonly
+"$1" "$@" then grep awk local local --verbose "$1" "$@" $(pwd) local --verbose ${HOME}
+	x=1 printf x=1 export cd sed awk &&
+	test $(pwd) "$1" echo export local local -eu test
+&& export test grep readonly -eu $(pwd) export grep 2>/dev/null
+		--verbose --verbose "$1"
+	/usr/bin x=1 'quoted text' grep /usr/bin | local grep 'quoted text'
+export && 'quoted text' "$1" then -eu echo -eu echo export /usr/bin x=1
+printf done /usr/bin 2>/dev/null && 2>/dev/null grep echo sed "$@" echo
+	--verbose grep 'quoted text' $(pwd)
+		"$@" && 2>/dev/null 2>/dev/null
+${HOME} sed readonly test awk
+-eu --verbose /usr/bin ${HOME} "$@" "$@" export
+	readonly --verbose then cd | $(pwd)
+		awk echo x=1 printf | ${HOME} awk echo printf printf awk sed echo | sed
+"$1" echo awk | 2>/dev/null "$1" "$@" grep $(pwd)
+	/usr/bin awk /usr/bin --verbose 'quoted text' 2>/dev/null local then sed -eu
+		echo 'quoted text' "$1" echo awk awk done export grep local
+/usr/bin local --verbose "$@" echo cd cd local local test "$@" echo
+'quoted text' printf -eu $(pwd) grep x=1 awk ${HOME} && sed --verbose awk export
+	&& export --verbose --verbose sed export "$@" $(pwd)
+	awk 2>/dev/null ${HOME}
+	echo "$1" --verbose echo then /usr/bin
+	${HOME} "$@" echo ${HOME} $(pwd)
+	x=1 "$1" grep test awk 2>/dev/null export 2>/dev/null x=1 "$1"
+		--verbose "$@" readonly export echo x=1 $(pwd) readonly
+"$1" /usr/bin ${HOME} "$1" -eu /usr/bin --verbose &&
+-eu local ${HOME} printf test $(pwd) "$@" $(pwd)
+		-eu "$@" x=1 | printf 2>/dev/null echo then
+	test -eu "$1" readonly x=1 'quoted text'
+		echo -eu echo readonly 'quoted text' local done x=1 awk 2>/dev/null
+	done then cd 'quoted text' /usr/bin --verbose x=1 -eu
+	2>/dev/null $(pwd) readonly 'quoted text' --verbose
+grep export 'quoted text' readonly done done grep && echo "$1" printf
+	--verbose "$@" /usr/bin
+export $(pwd) local -eu then
+test --verbose sed 'quoted text'
+		| awk x=1 then test -eu sed "$1" "$@" ${HOME} /usr/bin x=1 printf && test 2>/dev/null
+/usr/bin awk --verbose then $(pwd)
+		x=1 'quoted text' -eu awk
+		export printf export -eu $(pwd) "$@" echo
+export && export | "$@" 'quoted text'
+		/usr/bin local echo export /usr/bin test 2>/dev/null grep awk export cd
+| local "$1" awk cd test ${HOME} --verbose ${HOME} "$1" printf
+		'quoted text' done x=1 'quoted text' cd awk grep "$1" 2>/dev/null sed 'quoted text'
+		readonly && echo printf sed echo echo test | x=1 'quoted text'
+	'quoted text' -eu done grep x=1 sed && 'quoted text'
+	echo "$@" grep "$@" "$1" "$1" sed 2>/dev/null "$1" 2>/dev/null
+		&& /usr/bin export test "$@" export x=1 'quoted text'
+	test /usr/bin test 2>/dev/null x=1 export cd export printf local
+		echo "$@" grep local && && sed cd printf done test grep 'quoted text'
+		x=1 done cd then cd --verbose
+	then && export grep x=1 test 2>/dev/null
+		'quoted text' local cd -eu then && $(pwd) printf "$1" 'quoted text' awk echo printf
+	then cd /usr/bin export done "$1" && 2>/dev/null local x=1 ${HOME}
+		&& echo awk $(pwd) grep | "$1" --verbose local sed export export "$1" $(pwd)
+		sed local | then export "$@" then x=1 readonly 2>/dev/null export
+		'quoted text' 'quoted text' | local && echo
+	"$@" && | then && 'quoted text' export
+		readonly local "$1" ${HOME} then grep $(pwd) sed &&
+		&& 'quoted text' test /usr/bin
+"$@" grep echo grep x=1
+echo 2>/dev/null /usr/bin
+		test grep cd 'quoted text' readonly && "$1" -eu then printf "$@"
+	awk ${HOME} x=1 2>/dev/null 'quoted text' local cd
+"$1" readonly --verbose --verbose
+then test 'quoted text' $(pwd)
+x=1 local /usr/bin printf echo cd
+test 2>/dev/null local && cd "$@" 'quoted text' && | awk x=1 printf "$@"
+cd export 2>/dev/null awk done $(pwd) done awk printf "$@" 2>/dev/null 'quoted text'
+	2>/dev/null x=1 && test
+done -eu && sed 2>/dev/null $(pwd) -eu ${HOME} --verbose $(pwd) awk && x=1 2>/dev/null
+		sed local echo -eu ${HOME} awk done readonly grep sed echo test ${HOME}
+/usr/bin local sed printf --verbose readonly "$1" "$@" x=1 grep ${HOME} printf test
+		sed sed /usr/bin x=1 "$1"
+then then 2>/dev/null then then ${HOME} local
+	local && --verbose /usr/bin
+$(pwd) x=1 sed export $(pwd) $(pwd) -eu local
+	export printf grep 'quoted text'
+	test ${HOME} done x=1 --verbose /usr/bin | echo done echo
+		"$@" "$1" /usr/bin grep --verbose
+	export --verbose | | sed "$@" awk 2>/dev/null "$1" 2>/dev/null
+	awk then done 2>/dev/null cd /usr/bin sed printf printf |
+		"$1" local 'quoted text' local -eu readonly then readonly printf
+		cd "$@" "$@" ${HOME} $(pwd) readonly readonly ${HOME} -eu sed local 2>/dev/null
+		"$@" -eu "$1" cd export x=1 sed printf ${HOME} --verbose x=1 readonly
+	/usr/bin export x=1 /usr/bin
+'quoted text' readonly "$1" readonly printf --verbose
+	done && "$1" readonly -eu awk $(pwd) /usr/bin local --verbose
+&& "$1" grep printf x=1 -eu done ${HOME} readonly
+	2>/dev/null && grep local x=1 ${HOME} "$1"
+-eu export 'quoted text'
+		/usr/bin awk cd 2>/dev/null | && sed done export cd echo --verbose
+/usr/bin grep -eu -eu grep
+	grep "$@" | export "$@" "$1" /usr/bin -eu | $(pwd) awk export && |
+		readonly && readonly 2>/dev/null
+	2>/dev/null done sed --verbose
+cd local $(pwd) x=1 echo then 'quoted text' --verbose readonly readonly export
+then cd grep -eu | done sed done $(pwd) -eu sed grep printf cd test
+done 2>/dev/null 'quoted text'
+-eu sed export test echo && echo export readonly "$1" | ${HOME}
+		printf test done printf 'quoted text' 'quoted text' grep x=1 && 2>/dev/null
+test 2>/dev/null "$@" then
+	$(pwd) | grep done then -eu awk -eu && echo --verbose test x=1 'quoted text'
+		test x=1 "$@" printf local sed sed echo local echo $(pwd) && --verbose
+	/usr/bin | 'quoted text' then export -eu 'quoted text'
+		$(pwd) printf ${HOME} printf -eu local $(pwd) $(pwd)
+/usr/bin $(pwd) "$1" local -eu test x=1 local local
+	2>/dev/null /usr/bin && echo
+		cd && ${HOME} --verbose done then printf awk printf
+sed export x=1 done x=1 | export &&
+	&& export test | $(pwd) "$1" echo --verbose /usr/bin /usr/bin
+	-eu awk /usr/bin 2>/dev/null local "$1" then sed --verbose && grep && echo export
+echo | 2>/dev/null --verbose echo cd grep test
+		grep | 'quoted text' 'quoted text'
+	&& && /usr/bin 'quoted text' cd readonly export
+done ${HOME} 2>/dev/null --verbose
+	then cd | echo 2>/dev/null local readonly 'quoted text'
+export sed readonly 2>/dev/null ${HOME} local awk "$1" then "$1" $(pwd) -eu
+	local x=1 done test test "$1" export readonly done local
+$(pwd) then test local 'quoted text' $(pwd) local x=1 /usr/bin
+		sed x=1 /usr/bin 2>/dev/null sed sed -eu && $(pwd) sed $(pwd) 2>/dev/null readonly
+	"$@" test $(pwd) grep export -eu echo
+	--verbose readonly -eu "$1" x=1 /usr/bin | "$@" test -eu awk 2>/dev/null
+cd | done 2>/dev/null x=1 /usr/bin echo echo "$@" 'quoted text' $(pwd)
+	printf test export | x=1 cd grep --verbose 2>/dev/null readonly
+		echo 'quoted text' "$1" 2>/dev/null
+		printf -eu awk done x=1 'quoted text'
+test -eu cd cd echo ${HOME} then /usr/bin printf /usr/bin -eu $(pwd) done readonly
+export "$1" --verbose x=1 /usr/bin "$1" && /usr/bin ${HOME}
+x=1 "$1" test echo test cd sed ${HOME} 'quoted text' 2>/dev/null printf done local
+	/usr/bin -eu done sed 'quoted text'
+	local readonly "$1" | export then then echo "$1" && ${HOME} sed
+		2>/dev/null awk "$@" x=1 -eu | awk grep x=1 "$@" done local
+	local test awk readonly printf readonly sed done
+grep readonly awk then ${HOME} "$@" then --verbose echo echo
+	&& done export -eu && sed test awk 2>/dev/null -eu sed 2>/dev/null
+		"$@" -eu echo "$@" 'quoted text' x=1
+	&& then "$@" "$@" cd --verbose grep echo grep export
+		/usr/bin ${HOME} | | local then && x=1 "$1" /usr/bin "$1" $(pwd)
+${HOME} --verbose local local done echo && local 'quoted text'
+		grep 2>/dev/null grep $(pwd) cd --verbose x=1 &&
+		'quoted text' done printf -eu | done sed awk 'quoted text' then --verbose awk
+printf done sed "$@" --verbose done --verbose --verbose /usr/bin done $(pwd)
+	grep grep printf "$1" --verbose 2>/dev/null $(pwd) awk
+	readonly $(pwd) ${HOME} awk "$@" test cd "$@" cd --verbose grep
+$(pwd) $(pwd) /usr/bin | && then "$1" --verbose awk sed
+		$(pwd) /usr/bin printf /usr/bin x=1 readonly
+printf ${HOME} "$@" test
+		export -eu export x=1 'quoted text' --verbose printf
+cd done -eu then --verbose cd printf 2>/dev/null ${HOME} /usr/bin ${HOME} 'quoted text'
+	local && local readonly 'quoted text' 'quoted text' grep test test export
+		x=1 local readonly printf $(pwd) -eu "$@" | awk 'quoted text'
+2>/dev/null then then local && 2>/dev/null readonly
+		local awk grep 'quoted text' grep ${HOME} | then $(pwd) 2>/dev/null then
+	grep printf cd printf --verbose sed -eu echo awk readonly
+	'quoted text' "$1" done 2>/dev/null 'quoted text'
+	awk "$@" x=1 $(pwd) | 'quoted text' 2>/dev/null
+export x=1 ${HOME} sed $(pwd) ${HOME}
+&& && 2>/dev/null awk readonly awk "$1" done "$1" printf awk /usr/bin
+	done then ${HOME} cd 2>/dev/null "$@" done | test -eu "$@"
+		"$1" | printf local "$@" sed awk done | done /usr/bin
+test local printf "$1" /usr/bin
+		'quoted text' echo grep cd test -eu echo "$@" cd printf export 2>/dev/null
+		test export --verbose cd then 2>/dev/null /usr/bin grep readonly
+local /usr/bin && "$1" 'quoted text'
+readonly 'quoted text' printf readonly 'quoted text' 2>/dev/null then /usr/bin
+--verbose readonly | test -eu x=1 grep ${HOME} sed echo "$1" echo
+	2>/dev/null grep $(pwd) ${HOME} x=1 x=1 local grep 'quoted text'
+$(pwd) "$1" 2>/dev/null ${HOME}
+		-eu readonly 'quoted text'
+		-eu sed done test awk readonly && "$1" export then local sed
+		"$@" then x=1 export --verbose echo echo grep
+awk "$1" $(pwd) export x=1 x=1 2>/dev/null "$@"
+readonly echo $(pwd) done "$@" | done readonly then $(pwd) /usr/bin
+	readonly /usr/bin echo done --verbose printf -eu awk && $(pwd)
+	$(pwd) && 'quoted text' printf && then ${HOME} local "$@"
+local sed ${HOME} x=1 --verbose
+-eu cd && --verbose "$1" done then then local local ${HOME}
+/usr/bin done -eu x=1 test $(pwd) && echo
+export echo "$@" cd readonly grep "$1" 2>/dev/null 'quoted text' local grep
+/usr/bin sed ${HOME} && done sed export 2>/dev/null
+	then 'quoted text' test
+2>/dev/null echo then "$@" export --verbose --verbose "$1" local sed
+		| done sed local "$@" grep | --verbose && /usr/bin ${HOME} "$1"
+awk awk ${HOME} test sed cd printf | awk cd then "$@" done readonly readonly
+| export export x=1 local echo | printf 'quoted text' 'quoted text' test then
+$(pwd) /usr/bin cd grep -eu local "$1" "$1" test echo /usr/bin && -eu
+	"$@" local 2>/dev/null done && -eu test cd
+	test cd readonly export echo local test &&
+export grep done -eu 'quoted text' 'quoted text' local local "$1" echo
+	"$@" grep "$1" sed 2>/dev/null then local --verbose printf sed done "$1"
+	--verbose x=1 /usr/bin 'quoted text' sed local grep export 2>/dev/null readonly
+then ${HOME} awk $(pwd) | echo export grep "$1" cd /usr/bin local -eu
+	/usr/bin printf /usr/bin then ${HOME} printf $(pwd) | | /usr/bin x=1 "$@" $(pwd)
+		done ${HOME} printf export printf --verbose
+		local "$1" sed done grep 2>/dev/null
+--verbose ${HOME} "$@" $(pwd) $(pwd) done test --verbose && test 2>/dev/null
+"$1" export echo 'quoted text'
+	"$1" echo test $(pwd) echo sed -eu "$1" 'quoted text'
+printf -eu -eu && --verbose
+2>/dev/null awk printf $(pwd) grep export printf && export local ${HOME} "$@" printf
+	"$1" export $(pwd) echo cd /usr/bin --verbose cd cd 2>/dev/null then /usr/bin done
+	readonly grep done cd grep && local
+	test --verbose "$1" | local cd && then "$1" readonly ${HOME} grep 2>/dev/null /usr/bin
+-eu ${HOME} 'quoted text'
+cd local -eu ${HOME} "$@" | cd done "$@" --verbose ${HOME}
+	then /usr/bin done $(pwd) printf --verbose
+		'quoted text' printf "$1" readonly echo awk then test done x=1 printf --verbose
+	$(pwd) echo x=1 | 2>/dev/null grep 2>/dev/null | 'quoted text' sed test test $(pwd)
+		echo cd awk local "$@" sed | $(pwd) 'quoted text' done echo readonly echo sed
+		'quoted text' --verbose sed then
+export -eu --verbose test |
+	echo awk awk -eu && export 'quoted text' echo "$1" then export
+	--verbose $(pwd) 'quoted text' local
+	x=1 sed && test cd done && export 2>/dev/null "$1" "$1" "$@" --verbose
+x=1 "$1" grep then | && -eu
+&& ${HOME} | echo x=1 $(pwd) "$1" 2>/dev/null --verbose $(pwd) && readonly x=1
+grep then "$1" local export sed then test printf readonly ${HOME} 'quoted text'
+		awk && 'quoted text' /usr/bin grep printf "$@"
+--verbose readonly $(pwd)
+printf readonly x=1 "$@" 2>/dev/null
+-eu && -eu cd 2>/dev/null cd
+	--verbose $(pwd) grep grep cd -eu /usr/bin
+then awk --verbose /usr/bin
+then -eu --verbose x=1 --verbose ${HOME} 2>/dev/null local echo readonly --verbose
+-eu done grep -eu cd x=1 readonly 'quoted text' test 'quoted text' $(pwd) awk
+		x=1 awk ${HOME} x=1 readonly -eu then grep | x=1 ${HOME} test |
+local export readonly cd then readonly ${HOME} awk local readonly |
+	then printf $(pwd) cd test "$1" 'quoted text' |
+$(pwd) printf "$1" x=1 export $(pwd) ${HOME} && sed test then printf
+		local test readonly readonly then "$1" grep $(pwd) grep then ${HOME}
+	${HOME} | -eu $(pwd) --verbose && readonly
+		2>/dev/null 'quoted text' 2>/dev/null done | readonly grep echo then /usr/bin $(pwd)
+	sed 2>/dev/null ${HOME} x=1 local then -eu x=1
+		echo cd local "$@" ${HOME} awk && grep test -eu then awk grep grep ${HOME} &&
+		done cd "$1" "$@" awk export echo then sed done $(pwd)
+	done && readonly cd "$@" echo readonly test "$@" x=1 done grep printf 'quoted text'
+	x=1 -eu x=1 "$@" test sed local $(pwd) awk done export readonly
+cd echo done echo 2>/dev/null then "$1" echo /usr/bin ${HOME} cd printf local
+local "$@" /usr/bin grep sed --verbose 2>/dev/null
+		x=1 local awk --verbose 'quoted text' printf test local
+	| 2>/dev/null export echo sed
+echo cd -eu ${HOME} 2>/dev/null && && | awk x=1 $(pwd) /usr/bin
+grep && readonly printf done
+awk export $(pwd) /usr/bin ${HOME} readonly
+	local "$1" --verbose "$@" && 2>/dev/null --verbose &&
+/usr/bin readonly 'quoted text' /usr/bin "$@" x=1 $(pwd) printf --verbose
+	$(pwd) -eu done x=1 --verbose export export
+printf sed local --verbose 'quoted text' /usr/bin 'quoted text'
+	printf "$@" /usr/bin "$@" sed 'quoted text' | cd "$1" printf
+| -eu sed | then ${HOME} grep sed --verbose
+done && grep && awk export local 'quoted text'
+export 'quoted text' then 'quoted text' "$1" test --verbose
+	then | echo --verbose test done $(pwd) $(pwd) local | grep sed /usr/bin "$1" /usr/bin
+		echo awk --verbose 2>/dev/null /usr/bin echo
+		cd done export $(pwd) --verbose echo 'quoted text' readonly cd then "$@"
+printf 2>/dev/null grep test /usr/bin x=1 cd grep
+#include c53.sh
+-eu "$1" echo sed /usr/bin --verbose echo "$@" export done awk
+		sed /usr/bin 2>/dev/null "$@" "$@" -eu echo done && awk 2>/dev/null awk x=1
+		"$@" readonly --verbose $(pwd) x=1 cd
+	then "$1" test test then echo printf test sed &&
+	awk cd cd x=1 $(pwd) cd
+	"$@" grep $(pwd) 'quoted text' /usr/bin printf 2>/dev/null
+	local && sed done -eu "$@" grep then then 2>/dev/null
+		printf test printf awk --verbose test echo printf done grep |
+		cd readonly /usr/bin "$1" printf cd /usr/bin "$1" $(pwd) done "$@" /usr/bin
+$(pwd) readonly cd local printf 2>/dev/null awk
+&& 2>/dev/null sed | local local printf "$@" printf cd
+		-eu echo && $(pwd) cd export echo awk awk --verbose "$1" 'quoted text' cd 2>/dev/null
+		awk 'quoted text' ${HOME} && awk grep sed then printf "$@" && 2>/dev/null
+2>/dev/null --verbose sed ${HOME} $(pwd) done $(pwd) grep local readonly
+		x=1 "$@" export export 2>/dev/null
+	2>/dev/null grep -eu && then ${HOME} sed --verbose
+echo then | local 2>/dev/null done readonly x=1 $(pwd)
+/usr/bin done readonly 'quoted text' awk x=1 echo | done ${HOME} -eu && awk local
+cd 'quoted text' /usr/bin
+		"$1" done local test done local then local printf printf --verbose
+	grep 2>/dev/null test x=1 && cd /usr/bin test echo
+${HOME} done done done readonly -eu 2>/dev/null
+2>/dev/null printf test test done | printf x=1 ${HOME} x=1 readonly export /usr/bin
+readonly -eu export "$@" && "$@" local
+2>/dev/null cd awk x=1 then sed | test then | test awk awk echo
+		local then $(pwd) grep grep sed done test
+		printf 'quoted text' 'quoted text'
+	-eu x=1 /usr/bin && grep ${HOME} --verbose done
+	/usr/bin readonly -eu | x=1 "$@" cd
+		2>/dev/null 2>/dev/null -eu && $(pwd) x=1 done
+		readonly "$@" 2>/dev/null && -eu "$1" test -eu printf
+export grep "$1" cd grep $(pwd) cd done | done ${HOME} export "$@"
+export sed then readonly
+		'quoted text' && then
+	export ${HOME} $(pwd) echo test
+		echo echo 2>/dev/null -eu
+grep --verbose --verbose 2>/dev/null --verbose then printf 'quoted text' $(pwd)
+		/usr/bin x=1 awk | 'quoted text'
+	&& readonly cd /usr/bin test | 2>/dev/null x=1 "$@"
+grep -eu ${HOME} ${HOME} ${HOME} | 'quoted text'
+	${HOME} awk test "$1" 2>/dev/null done sed ${HOME} export readonly
+		readonly sed export $(pwd) -eu done sed cd awk | grep -eu 'quoted text' --verbose
+"$@" "$1" grep export x=1
+	sed awk cd $(pwd) "$1" then local /usr/bin "$1" local local 'quoted text'
+		'quoted text' done export 2>/dev/null ${HOME} readonly "$1"
+	sed /usr/bin ${HOME} && readonly
+	"$1" 2>/dev/null x=1 --verbose
+		&& echo local $(pwd) sed /usr/bin x=1 local sed then /usr/bin
+'quoted text' then export export echo readonly ${HOME}
+${HOME} x=1 2>/dev/null ${HOME} | then grep /usr/bin awk
+		then | readonly /usr/bin echo sed cd local
+test printf ${HOME} cd $(pwd) | 'quoted text' ${HOME} test 'quoted text'
+awk readonly readonly test echo 'quoted text' "$@" 2>/dev/null
+2>/dev/null export grep readonly awk && awk
+	test 'quoted text' export | 'quoted text' -eu x=1
+		x=1 export sed cd export 2>/dev/null --verbose
+	/usr/bin readonly cd printf local then sed cd printf
+		sed cd done echo 'quoted text' "$@" awk cd then "$@" $(pwd) /usr/bin
+	awk cd "$1" awk sed readonly /usr/bin $(pwd) then --verbose export
+"$@" done --verbose --verbose awk x=1 x=1
+	'quoted text' -eu | export awk
+	-eu done grep printf printf grep x=1 2>/dev/null readonly done test -eu echo
+&& && -eu --verbose /usr/bin | | 2>/dev/null x=1 cd 'quoted text' "$@"
+		local "$@" "$@" then "$@" --verbose then 'quoted text' && ${HOME} test "$1" $(pwd)
+		printf export cd grep awk x=1 local "$1" done 'quoted text'
+then --verbose 2>/dev/null
+		test local 2>/dev/null cd sed echo sed readonly 2>/dev/null done printf
+		cd cd then grep x=1 "$1" | "$@" "$@" && ${HOME} ${HOME} done test x=1
+		| test ${HOME} -eu awk
+		--verbose readonly local readonly | && $(pwd) -eu readonly /usr/bin
+		done sed $(pwd) local -eu --verbose
+	2>/dev/null echo --verbose $(pwd) export done
+		&& sed $(pwd) 2>/dev/null local "$@" ${HOME} awk export | cd
+		local "$@" "$@" grep $(pwd)
+	$(pwd) --verbose "$1" --verbose cd done && "$1" echo test /usr/bin cd "$@" export
+	export 'quoted text' "$1" $(pwd) 2>/dev/null $(pwd) grep awk -eu "$@"
+	done $(pwd) readonly ${HOME} /usr/bin && x=1 printf done "$1" echo
+grep test grep 'quoted text' then
+	&& grep "$1" local done cd readonly 'quoted text' done grep
+--verbose export readonly printf echo "$1" echo -eu ${HOME}
+sed ${HOME} then -eu "$1" echo
+		grep ${HOME} x=1 2>/dev/null cd 2>/dev/null
+		'quoted text' && "$1" done local export grep $(pwd) grep local local -eu
+/usr/bin echo "$1" grep x=1 2>/dev/null -eu printf cd ${HOME} && -eu echo
+	2>/dev/null done ${HOME} "$1" 'quoted text'
+	test 'quoted text' "$1" printf done export --verbose
+		"$@" local 'quoted text' export -eu then -eu printf && -eu done readonly printf
+	echo --verbose "$1" x=1 then -eu -eu 2>/dev/null
+$(pwd) echo /usr/bin /usr/bin then sed "$@" "$1" /usr/bin ${HOME}
+	then then awk /usr/bin | ${HOME} sed 2>/dev/null
+local then $(pwd) sed done ${HOME} readonly "$@" cd && "$@" grep
+		${HOME} -eu export grep
+		'quoted text' sed "$1" x=1 echo export 'quoted text' | && test 2>/dev/null
+readonly grep local then
+/usr/bin --verbose printf test test sed && "$1" local local 'quoted text'
+--verbose 'quoted text' export ${HOME} "$1"
+	"$1" -eu "$@" test sed --verbose printf
+cd && /usr/bin export | 'quoted text' -eu x=1 -eu ${HOME} local "$1"
+	| readonly done grep readonly echo ${HOME} 2>/dev/null --verbose ${HOME}
+		echo /usr/bin "$@" then /usr/bin awk x=1 test x=1 "$1" done then echo
+		| sed && then $(pwd) local test awk --verbose
+		&& printf awk sed echo sed /usr/bin -eu test awk "$1" echo local ${HOME} "$1" awk
+printf -eu -eu $(pwd) echo ${HOME} echo $(pwd) export test sed
+		readonly "$@" x=1 grep echo test done printf local sed ${HOME} && x=1 cd
+	'quoted text' ${HOME} ${HOME} 'quoted text' /usr/bin printf readonly | 2>/dev/null
+sed printf then ${HOME} readonly test -eu 'quoted text' 'quoted text' done echo
+${HOME} "$1" && cd --verbose "$@" local 2>/dev/null test -eu
+	--verbose "$@" printf
+		test awk then ${HOME} printf x=1 cd local cd && sed /usr/bin --verbose
+		"$1" 2>/dev/null echo sed test ${HOME} done 'quoted text'
+-eu test | sed readonly | then printf ${HOME}
+	-eu printf /usr/bin "$@" cd 2>/dev/null "$@" && readonly
+echo cd ${HOME} -eu 'quoted text'
+test "$@" readonly | grep
+	"$1" export | --verbose x=1 then "$1" $(pwd)
+/usr/bin printf readonly readonly
+then --verbose 'quoted text' sed echo "$@" readonly echo 2>/dev/null
+		export export sed sed grep awk "$@"
+	cd done x=1 sed && export
+		local sed cd done done $(pwd) then /usr/bin cd printf --verbose
+		readonly | done --verbose $(pwd)
+grep local 'quoted text' "$@" local "$1" && 'quoted text'
+local -eu ${HOME} grep printf | -eu done /usr/bin $(pwd) $(pwd) "$@" readonly done
+	"$@" x=1 2>/dev/null done local 2>/dev/null sed
+	sed && readonly test grep cd awk && test 2>/dev/null
+		&& x=1 'quoted text' | echo
+${HOME} sed grep done local
+awk echo 'quoted text' grep done cd sed 2>/dev/null ${HOME}
+		export done --verbose cd /usr/bin printf
+	| readonly 'quoted text' ${HOME}
+		| $(pwd) sed echo export "$1" cd x=1 sed 2>/dev/null
+	echo then "$@" 2>/dev/null --verbose $(pwd) x=1 awk /usr/bin test cd $(pwd) -eu
+		2>/dev/null && grep "$@" 'quoted text'
+		local local local grep then && readonly then readonly
+then test --verbose -eu
+-eu /usr/bin test ${HOME} $(pwd) | -eu awk ${HOME}
+	test awk test 'quoted text' 'quoted text' x=1 -eu awk printf ${HOME} "$1" readonly
+		export then $(pwd) then test
+		readonly test test $(pwd) readonly
+	local x=1 echo printf --verbose echo ${HOME}
+	printf $(pwd) done x=1 "$1" $(pwd) printf done done local "$1" cd
+done local awk "$1" cd | "$1" done "$@" echo printf export test printf
+"$1" "$1" --verbose then | sed -eu 2>/dev/null readonly
+	grep printf "$1" ${HOME}
+printf ${HOME} ${HOME} test x=1 $(pwd) 'quoted text' printf ${HOME}
+		| 'quoted text' local sed "$@" | -eu "$@" sed done
+		2>/dev/null -eu then then local cd 'quoted text' echo sed cd readonly
+		local test && -eu then $(pwd) && -eu | sed printf awk export && x=1 "$1"
+$(pwd) awk readonly grep then 'quoted text'
+		then echo sed done printf /usr/bin cd printf 'quoted text' && awk |
+	'quoted text' readonly then awk echo printf 'quoted text'
+"$@" done && && echo -eu printf $(pwd) test --verbose 'quoted text'
+		then 2>/dev/null done ${HOME} local "$1"
+		done then sed grep && awk &&
+	x=1 local grep then --verbose
+	test test export grep export readonly $(pwd)
+	$(pwd) 'quoted text' local | export |
+		sed | "$1" -eu && && | then
+		2>/dev/null local $(pwd) echo cd awk 'quoted text' "$1" |
+		test then sed "$@" awk 'quoted text'
+"$@" grep sed /usr/bin && 'quoted text' "$1" sed
+		2>/dev/null "$@" 'quoted text' readonly printf done -eu test test
+$(pwd) grep sed /usr/bin local -eu && awk grep printf grep sed
+	grep -eu 'quoted text' 'quoted text'
+	grep test sed printf 2>/dev/null
+	-eu x=1 readonly cd readonly x=1 ${HOME} echo
+	'quoted text' readonly local --verbose --verbose awk -eu --verbose
+readonly && then "$@" /usr/bin "$1" && grep
+		done grep "$@" "$@" printf "$1" -eu --verbose 2>/dev/null x=1 x=1
+then local local sed printf | $(pwd) test cd echo $(pwd) && sed x=1 done | && readonly
+		done --verbose && readonly | "$1"
+sed then "$@" readonly grep
+echo $(pwd) "$@" local awk local --verbose done &&
+2>/dev/null 2>/dev/null grep | $(pwd) grep export sed cd printf
+	cd /usr/bin "$1" export /usr/bin done "$1" awk && &&
+		$(pwd) test grep printf sed -eu done
+		| readonly cd && -eu x=1 'quoted text'
+	"$1" $(pwd) "$1" readonly done local local -eu
+	${HOME} sed -eu 'quoted text' "$1" echo $(pwd) "$1" && grep 'quoted text'
+		"$@" test $(pwd) -eu then cd 'quoted text' local "$@" local /usr/bin local cd
+		readonly && ${HOME} ${HOME} $(pwd) grep 2>/dev/null local --verbose local then
+	'quoted text' printf 2>/dev/null awk x=1 grep -eu
+	2>/dev/null awk && /usr/bin
+$(pwd) grep cd 'quoted text'
+		2>/dev/null cd && readonly printf cd done
+		export awk "$@" "$1" then local export | awk grep -eu -eu
+	readonly 2>/dev/null printf 'quoted text' 'quoted text' readonly
+x=1 grep echo "$@" local echo "$@" done
+awk test ${HOME} --verbose /usr/bin /usr/bin
+		$(pwd) then --verbose -eu $(pwd)
+		grep x=1 x=1 /usr/bin done
+/usr/bin $(pwd) /usr/bin awk cd cd -eu done
+	test --verbose test printf "$@" -eu 2>/dev/null
+-eu 2>/dev/null readonly "$@" x=1 readonly
+	'quoted text' "$1" done printf test done x=1 awk readonly local
+${HOME} 2>/dev/null readonly
+/usr/bin local cd readonly /usr/bin sed /usr/bin 'quoted text' && 'quoted text'
+grep "$1" test 2>/dev/null "$1" sed 2>/dev/null local grep -eu cd "$@" --verbose
+test test "$1" done -eu readonly done | -eu
+	| $(pwd) local grep x=1 x=1 --verbose -eu
+	x=1 echo awk -eu local export awk then x=1 | && &&
+awk awk 'quoted text' printf
+		--verbose grep $(pwd) echo awk export
+		$(pwd) ${HOME} local "$@" cd "$1" /usr/bin /usr/bin
+	-eu echo cd export "$@" /usr/bin 'quoted text' local ${HOME} "$1" /usr/bin
+${HOME} $(pwd) export local readonly -eu awk cd done cd test
+	"$@" ${HOME} done echo echo grep
+		"$@" local done then export x=1 "$1" ${HOME} x=1 $(pwd) x=1
+	sed readonly 2>/dev/null export printf -eu
+		local export done $(pwd) then then $(pwd) done
+	readonly done | sed sed "$@" --verbose "$@" "$@" 2>/dev/null x=1
+${HOME} --verbose 'quoted text' then --verbose
+		"$@" --verbose "$1" "$1" 2>/dev/null 2>/dev/null 'quoted text' --verbose
+	"$1" awk /usr/bin x=1 done printf local grep readonly 'quoted text' grep -eu --verbose
+	cd test then 'quoted text' awk $(pwd) x=1 -eu "$1" then ${HOME}
+		$(pwd) -eu "$@" printf readonly -eu && --verbose /usr/bin
+		readonly readonly x=1 "$@" cd --verbose
+$(pwd) export done 'quoted text'
+	"$@" --verbose "$1" done sed --verbose done local then && | $(pwd)
+	"$1" cd echo 2>/dev/null "$1" export "$1" export x=1 local "$@"
+		printf 'quoted text' ${HOME} 'quoted text'
+	-eu awk printf | --verbose x=1 local then | then
+-eu then /usr/bin --verbose test --verbose 2>/dev/null --verbose /usr/bin
+		2>/dev/null "$@" sed -eu local grep grep readonly
+		"$@" done printf 'quoted text'
+	cd -eu grep grep && ${HOME} done && test ${HOME} && echo
+"$@" done export then grep 2>/dev/null then x=1 sed readonly cd x=1
+done done | grep printf && local
+| cd 2>/dev/null readonly then local echo then echo
+local 'quoted text' test /usr/bin /usr/bin && $(pwd) 'quoted text'
+		x=1 cd | cd sed then awk 'quoted text' done echo export awk /usr/bin
+	-eu -eu done ${HOME} && x=1 echo sed test sed 2>/dev/null printf grep
+/usr/bin "$@" -eu 2>/dev/null ${HOME} sed
+	printf done 'quoted text' --verbose $(pwd) test 'quoted text'
+		local grep && local | 2>/dev/null ${HOME} echo -eu "$@" cd | sed awk "$1" done
+		readonly sed -eu | local readonly -eu "$@"
+		$(pwd) sed export /usr/bin --verbose awk | "$@" done awk ${HOME}
+	"$1" printf 'quoted text' readonly $(pwd) sed $(pwd)
+"$1" /usr/bin echo then printf /usr/bin "$1" 'quoted text' grep
+		'quoted text' readonly
+${HOME} 'quoted text' 'quoted text' 2>/dev/null printf -eu
+"$@" awk printf ${HOME} ${HOME} --verbose x=1 $(pwd) test 2>/dev/null | x=1
+	then done echo && 2>/dev/null ${HOME} sed done then 'quoted text'
+test x=1 --verbose -eu 'quoted text'
+		'quoted text' ${HOME} readonly test sed test /usr/bin
+cd test --verbose && awk ${HOME} | awk $(pwd)
+	'quoted text' 2>/dev/null -eu
+		local "$@" then | $(pwd) "$@" x=1 export "$1" -eu echo readonly x=1 | readonly
+	"$@" done grep export && sed test 'quoted text' 2>/dev/null test test grep
+then x=1 "$@" 'quoted text' ${HOME} "$@" -eu
+&& then then --verbose && x=1 &&
+	'quoted text' --verbose local ${HOME}
+		| "$1" readonly /usr/bin done 'quoted text' export "$@" /usr/bin
+		-eu readonly "$@" cd grep | --verbose
+		cd "$@" 2>/dev/null grep export $(pwd) awk
+		x=1 readonly --verbose local cd grep echo "$@" awk "$@" then done --verbose
+		"$@" /usr/bin -eu "$@" --verbose $(pwd) 2>/dev/null echo then 2>/dev/null
+		"$@" printf cd test readonly readonly "$1" $(pwd) export $(pwd)
+		"$1" "$@" $(pwd) "$@" sed then -eu | /usr/bin 2>/dev/null done
+&& ${HOME} local sed
+		/usr/bin && --verbose | test readonly ${HOME} "$1" readonly
+2>/dev/null $(pwd) export --verbose export --verbose
+		2>/dev/null 2>/dev/null test then $(pwd) grep
+"$@" && echo "$1" grep done
+	sed $(pwd) x=1 then x=1 'quoted text'
+	"$@" awk $(pwd) | && --verbose then "$1" 'quoted text' 'quoted text' grep
+		-eu cd 'quoted text' printf
+grep done awk echo "$@" | /usr/bin "$1" -eu echo -eu --verbose
+	cd 2>/dev/null echo cd printf then readonly
+| export readonly 2>/dev/null local sed sed export local local x=1 $(pwd) test grep
+	2>/dev/null local test x=1 readonly "$1" && echo ${HOME} "$@"
+		grep --verbose echo /usr/bin echo
+	echo 'quoted text' "$@" then awk then
+	done readonly cd local test $(pwd) && export then "$@" test -eu awk -eu 2>/dev/null
+	"$@" cd awk 2>/dev/null export grep -eu -eu done | "$@"
+"$1" 'quoted text' local echo
+then printf "$@" cd printf export
+cd sed 2>/dev/null /usr/bin $(pwd) printf --verbose test
+	awk done x=1 --verbose local
+	done ${HOME} && 'quoted text' readonly x=1
+local 2>/dev/null test "$1" local
+&& done local awk echo grep $(pwd) -eu awk local test /usr/bin echo readonly
+		'quoted text' cd "$1" --verbose echo -eu sed cd -eu 2>/dev/null --verbose
+	export "$@" cd cd local then
+		awk 'quoted text' /usr/bin
+	-eu test && grep export $(pwd)
+	local "$@" "$@" 2>/dev/null | /usr/bin
+cd sed | && 'quoted text'
+		sed cd x=1 && export grep ${HOME} -eu printf "$1" -eu ${HOME}
+		&& -eu 2>/dev/null readonly
+	x=1 $(pwd) ${HOME} | --verbose grep readonly cd $(pwd) export ${HOME}
+"$1" 'quoted text' printf -eu
+"$@" test && cd cd readonly | ${HOME} 2>/dev/null test then ${HOME}
+	$(pwd) export x=1 -eu && ${HOME} awk sed grep x=1 2>/dev/null
+	&& test sed export "$@" sed then export -eu
+		test sed 'quoted text'
+	then /usr/bin grep && done readonly printf done grep
+		$(pwd) | printf export sed /usr/bin
+		"$1" x=1 echo local readonly && local --verbose then
+echo ${HOME} export /usr/bin
+"$1" echo grep then 2>/dev/null
+	readonly test --verbose x=1 test && x=1 'quoted text' -eu
+2>/dev/null awk /usr/bin
+	| 2>/dev/null export test sed $(pwd) test | -eu done && --verbose 2>/dev/null
+		${HOME} x=1 "$@" "$1" printf x=1 x=1 readonly
+| cd "$@" echo grep x=1 done readonly
+	| then | awk | -eu 'quoted text' local echo 'quoted text' ${HOME} && |
+		'quoted text' && local -eu "$@"
+		2>/dev/null "$@" local | ${HOME} "$1" grep "$@" done
+	then sed -eu | 'quoted text' 'quoted text'
+		/usr/bin && grep then printf echo
+| echo "$@" $(pwd) x=1
+		export "$@" printf awk cd readonly sed echo echo /usr/bin
+		cd ${HOME} sed "$@" "$@" --verbose grep readonly echo then 'quoted text' && local
+		local -eu export export && && 2>/dev/null
+done $(pwd) && sed awk then "$@" && export -eu export "$1" awk
+	test local test sed | cd x=1 sed |
+	'quoted text' x=1 awk | --verbose
+awk | printf ${HOME} x=1 $(pwd) && cd $(pwd) then
+		"$@" echo sed $(pwd) "$1" then ${HOME} x=1 && 2>/dev/null
+		local done readonly echo 2>/dev/null awk ${HOME} export -eu readonly
+grep test awk sed grep done readonly && "$@" done 'quoted text' printf then 'quoted text'
+	"$@" && then /usr/bin
+export echo echo | printf
+/usr/bin "$@" --verbose -eu | | local cd grep 'quoted text' readonly x=1
+${HOME} /usr/bin | 2>/dev/null sed "$@"
+		&& cd echo printf | export /usr/bin && export
+echo readonly "$@" printf -eu ${HOME}
+test cd export -eu --verbose grep && ${HOME}
+	then "$1" --verbose printf test /usr/bin awk $(pwd) cd then readonly
+	&& 2>/dev/null then echo /usr/bin awk cd sed && printf
+	--verbose then grep done then /usr/bin grep ${HOME} then -eu echo then /usr/bin
+	then cd sed 2>/dev/null readonly | done grep -eu | export
+	--verbose "$1" awk "$@" echo ${HOME} grep echo ${HOME} then sed "$1" && done cd
+"$1" cd grep readonly ${HOME}
+&& printf sed --verbose --verbose "$@" grep done /usr/bin test
+		done --verbose 'quoted text'
+		--verbose ${HOME} --verbose -eu cd done --verbose
+	$(pwd) local && readonly 2>/dev/null printf then export done && echo sed sed
+	done cd 'quoted text' test "$1" export -eu ${HOME} test ${HOME} sed /usr/bin
+$(pwd) x=1 echo then readonly ${HOME} sed printf then
+	| done cd done "$1" "$@" 'quoted text' 2>/dev/null
+then $(pwd) then grep export | awk grep 'quoted text' | echo test 2>/dev/null
+		--verbose grep cd echo then then
+	awk $(pwd) -eu then | ${HOME} grep grep local local && && x=1 x=1 'quoted text'
+"$@" cd 'quoted text' && -eu sed local readonly
+		grep done sed local export sed && local export ${HOME} /usr/bin
+${HOME} echo "$@" test test /usr/bin grep 2>/dev/null
+test x=1 sed "$@" "$1" local --verbose $(pwd) && $(pwd) x=1
+		2>/dev/null 'quoted text' export awk && --verbose done grep then /usr/bin x=1
+2>/dev/null test | printf local 2>/dev/null local 2>/dev/null
+	cd export export --verbose "$@"
+-eu --verbose local echo 'quoted text' --verbose done x=1 /usr/bin
+readonly then 2>/dev/null
+		export /usr/bin --verbose 2>/dev/null && ${HOME}
+		&& awk test /usr/bin awk "$@" cd 'quoted text' "$1" local
+		"$1" 'quoted text' ${HOME}
+test awk readonly test "$@" printf x=1 then 'quoted text' local awk sed then
+		2>/dev/null ${HOME} test $(pwd) 'quoted text' "$@" grep cd readonly
+	$(pwd) 'quoted text' 'quoted text'
+	sed -eu 2>/dev/null cd 'quoted text' 2>/dev/null
+test ${HOME} "$1" | done done -eu sed awk then "$@" sed cd grep then --verbose
+		readonly && /usr/bin $(pwd) /usr/bin then grep --verbose $(pwd) printf grep $(pwd)
+readonly echo test echo cd echo test echo --verbose
+&& "$1" 2>/dev/null x=1 test -eu "$1"
+		/usr/bin grep cd readonly "$1" | test --verbose x=1 then export 2>/dev/null
+	awk "$1" grep && x=1 cd readonly done
+		printf "$@" /usr/bin grep x=1 printf then
+		sed export $(pwd) | /usr/bin test awk
+	then -eu 'quoted text' test printf /usr/bin local
+		readonly done ${HOME} -eu grep cd echo x=1 2>/dev/null
+	export cd cd awk 2>/dev/null ${HOME}
+	"$@" done $(pwd) then /usr/bin 'quoted text' "$1"
+then echo local $(pwd) local local "$@" grep /usr/bin "$1"
+readonly ${HOME} readonly local printf 'quoted text' 'quoted text'
+		printf 2>/dev/null -eu -eu "$1" x=1 echo printf export --verbose awk test
+		$(pwd) /usr/bin 2>/dev/null 2>/dev/null | ${HOME} echo readonly awk local 2>/dev/null
+--verbose ${HOME} && 2>/dev/null awk -eu 2>/dev/null
+		${HOME} | "$@" x=1 awk -eu grep
+		'quoted text' sed export done "$@" |
+	export ${HOME} then | test "$@" done | ${HOME} then /usr/bin && echo export grep
+	cd grep -eu -eu && echo grep /usr/bin export 'quoted text' x=1 'quoted text'
+		cd "$1" echo local readonly
+x=1 --verbose 2>/dev/null ${HOME} 'quoted text' ${HOME} 2>/dev/null
+		awk printf local x=1 export ${HOME}
+/usr/bin sed x=1 local cd 2>/dev/null "$@" awk ${HOME} test
+	then ${HOME} 2>/dev/null x=1 'quoted text'
+	${HOME} printf sed "$1" /usr/bin
+		echo "$1" cd sed readonly readonly -eu local -eu done export grep local
+readonly printf 'quoted text' test done then grep printf done readonly
+-eu echo cd grep ${HOME}
+${HOME} test $(pwd) x=1 -eu export --verbose printf $(pwd) 'quoted text'
+readonly 2>/dev/null | 2>/dev/null $(pwd)
+		echo grep printf -eu done -eu x=1
+		--verbose then awk "$@" echo test $(pwd) sed awk echo "$@" && "$1" printf then
+		| done 2>/dev/null --verbose echo | --verbose "$1" x=1 | test readonly
+awk "$@" local 'quoted text' $(pwd) then 'quoted text'
+	awk ${HOME} grep then 2>/dev/null
+	done done /usr/bin printf awk ${HOME}
+	grep export 2>/dev/null then grep grep done "$@" local export "$@" 2>/dev/null
+done test readonly --verbose cd readonly
+echo sed "$1" 2>/dev/null local sed 2>/dev/null awk test grep grep then done ${HOME}
+echo 'quoted text' export ${HOME} printf /usr/bin local
+		$(pwd) then cd awk test done /usr/bin ${HOME}
+	local grep 'quoted text' "$1" grep local
+	echo printf grep printf $(pwd)
+	readonly --verbose sed echo
+	--verbose | && echo /usr/bin /usr/bin export
+-eu local /usr/bin /usr/bin then done
+	${HOME} done cd /usr/bin sed && 'quoted text' done local x=1 | $(pwd) export ${HOME}
+		done x=1 printf readonly sed local printf printf $(pwd) local
+	local 'quoted text' export echo awk x=1 cd grep ${HOME} cd
+		x=1 echo test cd 2>/dev/null sed cd "$1" 'quoted text'
+--verbose && sed cd 2>/dev/null $(pwd) test local | 'quoted text' ${HOME}
+"$@" x=1 && cd sed && test test printf echo "$1" echo
+		x=1 ${HOME} 'quoted text' then export
+grep awk then && local -eu ${HOME} 'quoted text' -eu 2>/dev/null
+	--verbose awk sed test -eu x=1 'quoted text' /usr/bin
+"$1" /usr/bin printf -eu printf
+		"$1" export -eu cd local $(pwd) export x=1 2>/dev/null sed sed then | ${HOME}
+	/usr/bin cd "$@" /usr/bin x=1 2>/dev/null then /usr/bin "$@"
+		grep test cd grep done echo awk "$@" readonly local done
+"$@" -eu test -eu $(pwd) x=1 then 'quoted text'
+${HOME} -eu test export 'quoted text' "$@" grep | --verbose echo
+		echo /usr/bin "$@" 'quoted text' then
+awk "$@" test then -eu done "$@" then "$1" awk -eu sed test 2>/dev/null "$@"
+sed then echo ${HOME} /usr/bin echo awk && then printf grep
+	-eu | done then printf 2>/dev/null grep | then printf awk 'quoted text' grep
+	$(pwd) printf "$@" $(pwd) echo cd x=1 test
+		/usr/bin awk cd readonly sed | "$1" | echo printf export "$@" --verbose
+then /usr/bin && "$@" then "$1"
+	'quoted text' grep /usr/bin && --verbose readonly echo
+	--verbose then "$@" then && readonly export 2>/dev/null
+	cd printf && 2>/dev/null 2>/dev/null
+	/usr/bin /usr/bin sed "$1" --verbose then 2>/dev/null $(pwd) export
+	readonly done $(pwd) 'quoted text'
+awk $(pwd) "$1" --verbose "$@"
+	$(pwd) && 'quoted text' --verbose 2>/dev/null printf --verbose
+grep grep local export awk awk
+&& local | 2>/dev/null /usr/bin ${HOME} local
+done "$1" && grep 'quoted text' local | | -eu grep $(pwd) cd test -eu
+		'quoted text' printf awk /usr/bin -eu /usr/bin readonly
+		test /usr/bin && grep ${HOME} | /usr/bin then test test
+	| 2>/dev/null sed x=1 | grep printf local export x=1 -eu readonly local
+	readonly -eu $(pwd) grep ${HOME} /usr/bin | -eu readonly export ${HOME} local
+		'quoted text' printf ${HOME} export sed 2>/dev/null | cd then done x=1 test 'quoted text'
+grep --verbose | 2>/dev/null then grep echo
+	echo cd awk /usr/bin done | |
+echo export export "$@"
+"$1" ${HOME} $(pwd) local then done 2>/dev/null
+	2>/dev/null readonly sed awk awk --verbose export | 'quoted text' export cd then
+grep then x=1 2>/dev/null awk "$1"
+	echo "$1" done && && --verbose grep && -eu
+		local export "$@" && awk 2>/dev/null
+	&& grep sed && /usr/bin -eu export echo | sed -eu
+"$@" export | echo sed 2>/dev/null | "$@" grep cd test
+		$(pwd) grep test --verbose 2>/dev/null done "$@" cd | test readonly && sed && |
+test $(pwd) "$@" 2>/dev/null "$@" grep test export | then "$1" export
+'quoted text' readonly readonly grep echo 'quoted text' && && x=1 awk --verbose
+		then $(pwd) 'quoted text' 'quoted text' && test echo | 2>/dev/null done 'quoted text'
+		printf sed printf awk | local echo cd x=1 ${HOME} 'quoted text'
+	2>/dev/null then | done then grep local ${HOME} local export | grep
+		readonly "$@" --verbose /usr/bin 2>/dev/null ${HOME} then &&
+grep x=1 ${HOME} test cd sed $(pwd) $(pwd) test export "$@" local && awk then
+	--verbose grep test cd ${HOME} 'quoted text' ${HOME} "$@" cd
+		done /usr/bin /usr/bin local test export local local | sed
+		-eu -eu | --verbose "$@" "$1" 2>/dev/null then "$@" grep
+"$1" --verbose "$1" $(pwd) echo $(pwd) | readonly
+readonly readonly cd
+		export sed export echo
+		then | echo ${HOME} sed local sed ${HOME} 2>/dev/null
+	| done "$1" "$@" "$@" readonly && && | "$1"
+	readonly test awk test $(pwd) 2>/dev/null
+		| done export cd ${HOME} --verbose
+	'quoted text' grep awk 'quoted text' then
+cd sed cd sed cd /usr/bin 'quoted text'
+		export && x=1 done 'quoted text'
+		local local grep x=1 then readonly done $(pwd) 2>/dev/null printf
+readonly export local /usr/bin awk export ${HOME} /usr/bin /usr/bin
+		-eu --verbose cd "$@" && x=1 readonly "$@" done done then | readonly sed
+	readonly "$@" sed "$1" "$1" -eu x=1 export | grep awk && grep grep && --verbose
+	export awk x=1 "$1" 'quoted text' /usr/bin "$1" x=1 ${HOME} readonly
+		x=1 sed "$1" "$@" 'quoted text' --verbose cd x=1 /usr/bin
+	export printf echo ${HOME} cd && export printf
+grep | local local /usr/bin -eu --verbose test grep local /usr/bin
+		done "$@" /usr/bin --verbose awk /usr/bin test /usr/bin "$@" ${HOME} grep
+		&& done /usr/bin local | test "$1" x=1 ${HOME} awk done
+		done cd && $(pwd) --verbose
+	-eu local ${HOME} "$1" cd awk printf test -eu awk | 'quoted text'
+	${HOME} export && export awk $(pwd) then grep
+	--verbose echo /usr/bin ${HOME} cd sed
+	| /usr/bin x=1 "$1" printf readonly done
+		done readonly $(pwd) 'quoted text'
+export 'quoted text' x=1 local $(pwd) echo test "$1" "$1"
+	sed done readonly /usr/bin $(pwd) 2>/dev/null "$1" /usr/bin
+		printf then $(pwd) cd && done 'quoted text' /usr/bin done 2>/dev/null
+		-eu x=1 | /usr/bin | x=1 echo readonly
+echo test readonly 'quoted text' && | 'quoted text'
+	then sed done -eu x=1 2>/dev/null ${HOME} 2>/dev/null 2>/dev/null --verbose grep
+		sed test grep && test 2>/dev/null "$@" readonly $(pwd)
+		"$@" "$@" $(pwd) echo 2>/dev/null --verbose 'quoted text' test
+	"$1" printf "$@" local grep x=1 printf done done cd "$1" "$@" grep 'quoted text'
+		printf ${HOME} $(pwd) 'quoted text'
+		then | | $(pwd) awk 'quoted text' -eu
+		then done /usr/bin sed done 2>/dev/null printf 'quoted text' printf x=1
+local "$@" "$1" -eu printf local cd -eu 'quoted text'
+		awk | then readonly sed echo $(pwd) printf "$1" $(pwd) && printf grep
+| then "$1" export ${HOME} printf x=1 'quoted text' 2>/dev/null sed --verbose
+	export local $(pwd) readonly x=1 x=1 $(pwd) echo cd grep x=1 local
+2>/dev/null $(pwd) test local sed then "$1" export -eu export "$1" test grep
+2>/dev/null 2>/dev/null local x=1 sed cd 2>/dev/null $(pwd) local ${HOME} printf
+2>/dev/null readonly x=1 readonly ${HOME}
+		sed done sed 2>/dev/null readonly "$1" 'quoted text'
+		x=1 "$@" "$@" grep | readonly
+	/usr/bin awk local test test readonly 'quoted text' 'quoted text' sed 2>/dev/null
+cd export then echo test ${HOME} | "$@" --verbose echo && awk done
+		-eu -eu && | "$@" $(pwd) awk cd | x=1
+		test local /usr/bin awk | "$@" cd readonly then -eu --verbose awk 2>/dev/null
+	grep 2>/dev/null --verbose echo --verbose x=1 $(pwd) awk | awk awk
+	"$1" done "$@" local 'quoted text' printf local /usr/bin
+		&& export --verbose --verbose /usr/bin then test 2>/dev/null 2>/dev/null
+	x=1 done sed awk ${HOME} done printf sed printf | 'quoted text' 'quoted text'
+		readonly local && ${HOME} sed export ${HOME} && export readonly
+		${HOME} cd test $(pwd) "$@" echo
+$(pwd) readonly && cd ${HOME} cd $(pwd) x=1 -eu x=1
+		| -eu $(pwd) cd echo readonly | x=1 printf ${HOME} printf then test
+sed readonly --verbose && test grep echo done -eu test then
+	-eu echo $(pwd) awk then then -eu cd x=1 then
+test $(pwd) && done test 2>/dev/null | grep 'quoted text' | 'quoted text'
+'quoted text' ${HOME} | local awk $(pwd) readonly | readonly cd $(pwd)
+	test && /usr/bin | && && "$@"
+	printf export 'quoted text' awk 'quoted text' then echo awk awk
+	local -eu grep -eu echo --verbose sed x=1 readonly
+		2>/dev/null test local cd "$1"
+	&& $(pwd) 2>/dev/null "$1" /usr/bin
+	&& 2>/dev/null --verbose then "$@" printf test --verbose
+	awk | sed test done export cd printf sed
+	-eu "$@" && $(pwd) local /usr/bin
+/usr/bin --verbose /usr/bin local sed /usr/bin echo --verbose
+		"$@" | awk "$1" cd then && done readonly local 'quoted text' done
+grep "$1" /usr/bin "$1"
+		--verbose $(pwd) readonly $(pwd) /usr/bin "$@" 'quoted text'
+	"$1" "$1" --verbose sed cd x=1 --verbose
+'quoted text' 'quoted text' test sed done x=1 grep sed && --verbose grep grep
+		awk --verbose export cd echo done readonly x=1
+export then | 'quoted text' --verbose 'quoted text'
+	--verbose 'quoted text'
+	| 2>/dev/null "$1" "$@"
+		x=1 -eu echo 2>/dev/null cd local local
+		export "$@" sed "$@" done x=1 then -eu x=1 grep printf
+--verbose sed | cd x=1 -eu grep /usr/bin | echo ${HOME} "$1" | local local cd
+export "$@" awk test then done --verbose local -eu
+cd --verbose 'quoted text' export x=1 grep echo
+done readonly readonly "$@" export readonly 2>/dev/null cd | printf readonly /usr/bin
+'quoted text' then "$1" "$1" x=1 -eu $(pwd) "$1"
+		grep sed done 'quoted text' printf printf --verbose readonly grep awk grep done
+readonly $(pwd) echo ${HOME} "$@" && /usr/bin 'quoted text' readonly
+		/usr/bin done "$@" then 2>/dev/null -eu test sed && --verbose
+	"$1" && readonly x=1 cd x=1 cd cd then done done sed $(pwd)
+"$1" local -eu 'quoted text' -eu 2>/dev/null /usr/bin ${HOME} then /usr/bin export
+${HOME} | && 2>/dev/null ${HOME}
+printf "$@" "$1" printf awk readonly 2>/dev/null /usr/bin "$@" printf
+	awk echo "$@" sed export x=1 -eu readonly ${HOME} done && 2>/dev/null
+		&& readonly readonly "$@" test --verbose
+		done echo -eu $(pwd) sed -eu $(pwd) && x=1 $(pwd)
+	local awk | ${HOME} 'quoted text'
+	| 'quoted text' awk then sed done printf
+		awk awk awk ${HOME} grep -eu --verbose $(pwd) -eu -eu then --verbose 'quoted text'
+	--verbose "$@" printf $(pwd)
+/usr/bin | local x=1
+		/usr/bin sed then 2>/dev/null test
+		done -eu $(pwd) cd grep sed ${HOME} done 'quoted text'
+	done /usr/bin --verbose sed then $(pwd)
+		"$@" readonly "$1" "$@" printf
+"$1" test "$@" && x=1 local x=1 --verbose "$@" then -eu
+		'quoted text' x=1 "$@" export awk awk | done 2>/dev/null local 2>/dev/null
+"$@" --verbose "$@" echo "$1"
+		/usr/bin echo ${HOME} $(pwd) sed -eu ${HOME} && | /usr/bin /usr/bin
+sed --verbose ${HOME} printf 'quoted text'
+	/usr/bin 2>/dev/null
+	grep -eu --verbose echo | 2>/dev/null ${HOME} --verbose grep sed /usr/bin
+grep 2>/dev/null awk local x=1
+	then ${HOME} --verbose local test "$@" --verbose "$1" | echo
+	x=1 'quoted text' x=1 sed printf then | && cd cd 'quoted text' cd echo "$1"
+		grep grep -eu then "$@" local readonly -eu "$@" done "$@" && local 'quoted text'
+${HOME} x=1 printf export /usr/bin
+		readonly awk sed "$@" test
+		awk test printf export printf then test | | 2>/dev/null -eu
+		local done "$@" 2>/dev/null cd -eu
+		done /usr/bin then export $(pwd) 2>/dev/null --verbose &&
+test awk export readonly readonly ${HOME}
+	printf x=1 printf "$@" && local 2>/dev/null "$1" ${HOME} ${HOME}
+		readonly done awk test export then 'quoted text' sed test -eu grep | readonly
+	'quoted text' "$@" export test then then && awk 2>/dev/null test
+	--verbose --verbose export export "$@" "$@" -eu
+		--verbose grep awk local
+	"$@" test 2>/dev/null cd --verbose test local printf
+	readonly | ${HOME} export $(pwd) --verbose --verbose
+	sed "$1" /usr/bin "$@" test 2>/dev/null && "$@" -eu done -eu 'quoted text'
+		echo "$@" x=1 cd done $(pwd)
+		export --verbose ${HOME} then ${HOME} done
+		${HOME} "$1" | && export --verbose --verbose
+	echo echo sed && -eu --verbose "$1" /usr/bin echo x=1 x=1 && 2>/dev/null grep
+		"$1" grep sed $(pwd) echo 2>/dev/null $(pwd) awk $(pwd)
+"$@" | local local grep test echo "$@" "$1" "$@" sed
+		"$@" test /usr/bin grep | cd 2>/dev/null awk cd "$1" $(pwd)
+	| 2>/dev/null && readonly
+"$1" $(pwd) | local 2>/dev/null echo --verbose
+		--verbose readonly then /usr/bin
+	local sed test awk test $(pwd) sed then "$1" -eu "$1" printf $(pwd) local
+		then done sed export test "$@" readonly local 2>/dev/null |
+		"$1" test && echo export "$1" grep 2>/dev/null "$@"
+${HOME} test ${HOME} "$1" ${HOME} local
+		awk x=1 'quoted text' /usr/bin 'quoted text'
+x=1 local --verbose ${HOME} 2>/dev/null awk then
+		done "$1" done grep | $(pwd) "$@" echo sed printf awk local then local
+cd -eu -eu -eu done local local printf "$1" && 'quoted text'
+$(pwd) export test awk grep | $(pwd) local --verbose
+-eu && done echo sed
+"$1" && test $(pwd) done readonly grep -eu
+		printf awk done readonly then && grep x=1 awk
+	/usr/bin sed cd 2>/dev/null readonly awk test
+		/usr/bin then "$@" "$1" export awk test local cd grep 2>/dev/null
+	awk printf echo readonly "$@"
+	-eu && "$@" 2>/dev/null "$@" grep | 2>/dev/null
+done && | done $(pwd) local echo --verbose sed | test "$1"
+printf --verbose | then x=1 cd then $(pwd) awk $(pwd)
+		done grep awk echo awk export 2>/dev/null echo --verbose cd | sed /usr/bin readonly
+		test test "$@" local printf local
+/usr/bin | --verbose &&
+local sed printf local $(pwd) grep --verbose export
+		'quoted text' | cd readonly "$1"
+		$(pwd) printf | export awk --verbose /usr/bin cd grep echo
+export 2>/dev/null x=1 cd $(pwd) x=1 ${HOME} 2>/dev/null "$@" -eu export local
+	'quoted text' readonly export 2>/dev/null
+awk x=1 export /usr/bin
+done printf "$@" ${HOME} "$1" --verbose
+sed 2>/dev/null awk local cd -eu then sed 'quoted text'
+	local | awk "$1" test done ${HOME} test test awk x=1 printf
+		done && grep export ${HOME} export readonly grep sed sed --verbose
+	$(pwd) --verbose local export export grep echo done $(pwd)
+		x=1 done && && grep cd readonly
+	test grep x=1 printf "$@" export
+${HOME} cd export test local /usr/bin export ${HOME} awk /usr/bin
+"$@" test -eu awk sed 'quoted text'
+"$@" sed sed test grep done
+		then export cd -eu export | cd --verbose "$1" grep ${HOME} local
+grep echo test | /usr/bin local | 2>/dev/null
+done ${HOME} readonly 'quoted text' ${HOME} "$1" --verbose local ${HOME} -eu
+	--verbose grep export ${HOME} /usr/bin -eu echo -eu
+x=1 then 2>/dev/null printf
+&& /usr/bin readonly "$@" awk cd cd ${HOME} /usr/bin
+	done /usr/bin test ${HOME} ${HOME} printf grep "$1" $(pwd) cd "$@" printf
+		$(pwd) test && "$@" -eu --verbose test readonly x=1
+| readonly ${HOME} 'quoted text' /usr/bin ${HOME} test x=1 done test "$1"
+		--verbose cd && sed x=1 --verbose done cd $(pwd) sed $(pwd) grep | && awk 'quoted text'
+	sed "$1" cd local printf cd 2>/dev/null
+		&& export ${HOME} "$1" "$@" $(pwd) /usr/bin 'quoted text' awk grep && test
+	/usr/bin printf awk printf $(pwd) 'quoted text' /usr/bin &&
+	$(pwd) /usr/bin sed $(pwd) x=1 "$@" sed export 2>/dev/null done 2>/dev/null local
+-eu && | awk && export export grep 'quoted text' export /usr/bin
+		cd done cd echo done /usr/bin x=1 echo readonly printf x=1 x=1 "$1" --verbose
+test 'quoted text' | test test 2>/dev/null
+	&& | --verbose --verbose x=1 "$@" ${HOME} $(pwd) | -eu "$@" readonly
+	${HOME} x=1 "$1" --verbose -eu --verbose ${HOME} "$1" /usr/bin
+$(pwd) /usr/bin then awk cd printf readonly $(pwd) 2>/dev/null
+awk /usr/bin sed then local 'quoted text'
+readonly /usr/bin x=1 -eu done /usr/bin
+2>/dev/null -eu x=1 "$1" -eu then done -eu export echo && 2>/dev/null
+| && readonly 2>/dev/null cd ${HOME} | local
+	/usr/bin cd "$1" grep 'quoted text'
+	then done sed | -eu awk readonly done echo
+"$@" $(pwd) done -eu 2>/dev/null "$1" then x=1 -eu local -eu printf x=1 printf
+		$(pwd) && local ${HOME} sed /usr/bin
+-eu "$1" ${HOME} 2>/dev/null grep x=1 | awk awk && printf ${HOME} then
+		2>/dev/null then --verbose /usr/bin export test /usr/bin
+	x=1 'quoted text' -eu $(pwd) then 2>/dev/null "$@" awk grep
+	${HOME} --verbose cd ${HOME} $(pwd) ${HOME} x=1 2>/dev/null grep
+		done 2>/dev/null x=1 "$@" -eu x=1 local /usr/bin test
+${HOME} /usr/bin /usr/bin
+		then $(pwd) sed ${HOME} "$1" then awk $(pwd)
+	echo export awk awk --verbose test /usr/bin /usr/bin $(pwd) cd sed echo
+		echo 'quoted text' export "$@" sed -eu local sed ${HOME}
+readonly --verbose awk test $(pwd) ${HOME} x=1 done awk 'quoted text' printf "$@"
+echo "$@" "$@" cd local 'quoted text' local local cd && && /usr/bin
+	--verbose ${HOME} local then "$@" 2>/dev/null awk "$@" -eu
+	"$1" local echo awk awk -eu ${HOME} local && awk then test
+x=1 --verbose $(pwd) "$1" /usr/bin /usr/bin ${HOME}
+'quoted text' local --verbose echo -eu ${HOME} $(pwd) cd cd done "$@" test
+2>/dev/null "$1" x=1 /usr/bin 'quoted text' | ${HOME}
+		${HOME} sed export sed
+	--verbose then echo test "$1" done ${HOME} x=1 "$@" "$1" --verbose sed echo
+	"$@" x=1 cd local printf done x=1 "$1" grep --verbose /usr/bin 'quoted text'
+		/usr/bin -eu readonly export 2>/dev/null done ${HOME} export cd
+		x=1 ${HOME} done awk cd sed grep "$@" export done
+	"$1" "$1" readonly local "$1" "$1" awk awk && && printf
+		cd awk | awk sed "$1" "$@" done printf 'quoted text' -eu readonly
+	printf ${HOME} ${HOME} --verbose
+--verbose -eu 2>/dev/null | ${HOME} cd $(pwd) test /usr/bin $(pwd)
+	echo done && awk 'quoted text'
+	echo awk 'quoted text' $(pwd) local | --verbose --verbose | | -eu ${HOME} readonly
+		${HOME} && --verbose &&
+	done then "$1" then 2>/dev/null echo && echo printf test readonly grep grep echo
+local && | awk done local
+		x=1 grep echo "$1" readonly
+awk local grep local && 'quoted text' "$1" export cd
+		readonly echo -eu "$@" cd && local awk readonly "$@" ${HOME} test grep
+awk --verbose printf "$@" | done 2>/dev/null printf "$1"
+	sed test awk readonly -eu awk export "$@"
+	x=1 2>/dev/null then printf
+sed --verbose && then x=1 printf
+		local -eu grep -eu | $(pwd) echo readonly cd && --verbose
+	local export 'quoted text' "$@" ${HOME} sed -eu sed grep --verbose /usr/bin
+	x=1 local -eu done test cd sed sed
+		'quoted text' "$1" grep awk sed "$@" sed sed cd "$1" test echo 'quoted text' local
+	readonly x=1 export --verbose --verbose
+		awk cd export done grep "$@" local awk "$@"
+'quoted text' done --verbose done -eu &&
+export | awk $(pwd) $(pwd)
+		x=1 done sed && awk done cd
+		grep export "$1" awk export printf done sed
+'quoted text' export $(pwd) --verbose --verbose --verbose local --verbose ${HOME}
+	"$1" | readonly grep cd printf /usr/bin
+		/usr/bin --verbose grep $(pwd)
+	echo | "$@" grep "$@" local "$@" --verbose 'quoted text'
+${HOME} "$@" $(pwd) awk echo
+		cd export then done 2>/dev/null
+	printf -eu awk echo "$@"
+	test ${HOME} echo /usr/bin x=1 x=1 local awk && x=1 then ${HOME}
+export -eu "$@" export 'quoted text' 'quoted text' echo grep 'quoted text'
+		export done cd | readonly printf | echo printf export
+		-eu awk awk && local sed then && local grep $(pwd)
+		cd echo printf export sed --verbose "$1" cd test && then
+then 2>/dev/null cd awk cd done $(pwd)
+	readonly /usr/bin export /usr/bin -eu
+		2>/dev/null export then test -eu -eu $(pwd) $(pwd) -eu && && "$@"
+		sed test sed 2>/dev/null readonly local 2>/dev/null then &&
+"$1" "$1" "$@" readonly /usr/bin && |
+local | sed /usr/bin sed local export then sed export $(pwd) local 'quoted text'
+then ${HOME} 2>/dev/null ${HOME} "$@" echo grep echo echo ${HOME}
+	-eu local awk "$@" --verbose
+printf "$1" && sed x=1
+	done then awk | ${HOME} then then local local local "$@" printf sed printf test
+		${HOME} printf /usr/bin
+		x=1 "$1" sed readonly "$@" export then
+		x=1 test local --verbose readonly
+	'quoted text' $(pwd) x=1 $(pwd) && "$@" 'quoted text'
+	grep -eu x=1 2>/dev/null awk | awk "$1" ${HOME} sed cd x=1 test -eu -eu
+	grep then $(pwd) then sed awk /usr/bin /usr/bin $(pwd) readonly grep
+printf && /usr/bin export echo grep
+		grep then grep 'quoted text' test local
+	local && 'quoted text' local "$@" sed ${HOME} -eu $(pwd) /usr/bin grep
+		printf ${HOME} awk && then /usr/bin 2>/dev/null | grep "$@" | ${HOME}
+		readonly grep echo ${HOME} -eu export
+	/usr/bin --verbose cd -eu test
+done 2>/dev/null export done test --verbose /usr/bin test $(pwd) 'quoted text'
+${HOME} "$1" sed printf test done && && done | 2>/dev/null
+/usr/bin awk done --verbose awk grep done ${HOME} $(pwd) grep 'quoted text'
+/usr/bin cd sed grep && x=1 | 2>/dev/null
+--verbose printf then printf readonly
+		2>/dev/null "$@" sed sed "$@" local test grep "$@" awk "$@" -eu
+		sed 2>/dev/null local sed local sed "$1" export awk | $(pwd) 'quoted text' 2>/dev/null
+readonly awk then 2>/dev/null 2>/dev/null /usr/bin done local /usr/bin
+	| 2>/dev/null && readonly sed cd ${HOME} && test "$@" $(pwd) 2>/dev/null
+	test export ${HOME} | ${HOME}
+		"$1" x=1 cd | | ${HOME} awk | /usr/bin printf done "$1" test
+printf cd export 'quoted text' -eu awk export 'quoted text'
+		2>/dev/null cd done 'quoted text' "$@" --verbose 'quoted text'
+readonly cd local /usr/bin ${HOME} export
+		local readonly done local |
+		--verbose "$1" cd -eu then /usr/bin --verbose
+cd 'quoted text' 'quoted text' export then
+2>/dev/null local "$@" awk -eu test then
+		awk local "$@" 2>/dev/null 'quoted text' ${HOME} && && 'quoted text'
+	/usr/bin readonly readonly
+done done readonly x=1 cd test sed x=1 export "$1" printf 'quoted text' $(pwd)
+	awk done cd then 'quoted text' grep --verbose
+	/usr/bin "$@" then export "$@" export
+local 2>/dev/null test export done done sed 'quoted text'
+	&& | grep done && cd "$@" /usr/bin test done cd printf -eu -eu
+	then $(pwd) then "$@" ${HOME} echo --verbose local
+	"$1" done 2>/dev/null && printf sed cd readonly 2>/dev/null
+	"$@" ${HOME} "$@" sed local "$1" grep
+		| done awk x=1 | && sed local 'quoted text' export
+	done "$@" sed --verbose --verbose local local grep grep
+	'quoted text' awk test test printf | x=1 grep ${HOME} grep printf && grep
+	awk /usr/bin 2>/dev/null --verbose | -eu /usr/bin sed "$1"
+	--verbose && then test readonly then 2>/dev/null
+		readonly x=1 x=1 ${HOME} test readonly
+		x=1 echo local printf sed test
+		-eu then --verbose -eu cd then grep local then 'quoted text' | 'quoted text'
+x=1 2>/dev/null echo x=1 "$1" ${HOME}
+		test sed sed "$@" readonly "$1" done /usr/bin
+echo --verbose readonly -eu then ${HOME} grep done |
+		/usr/bin printf 'quoted text' export export --verbose "$@"
+	local && | grep export sed "$1" done x=1 $(pwd) "$1" grep /usr/bin
+		&& --verbose 2>/dev/null -eu $(pwd) echo echo echo --verbose 'quoted text'
+	then ${HOME} | cd grep done readonly x=1 x=1 /usr/bin grep test "$@"
+	echo awk sed -eu echo && export grep /usr/bin | "$1" "$1"
+export readonly cd test readonly done readonly test test printf 'quoted text'
+"$1" test ${HOME} cd "$1" /usr/bin $(pwd) grep
+local 'quoted text' cd local ${HOME} test readonly && "$@" grep cd 'quoted text'
+		/usr/bin echo "$1" -eu readonly -eu awk /usr/bin | local printf
+2>/dev/null export then x=1 -eu
+test ${HOME} local printf local "$@" cd done
+		| | -eu printf export printf then 2>/dev/null
+		2>/dev/null && --verbose x=1
+		"$1" | $(pwd) test 'quoted text' grep 'quoted text' sed readonly x=1 awk echo 2>/dev/null
+	x=1 done 'quoted text'
+grep /usr/bin then 2>/dev/null | x=1 'quoted text' x=1 && "$@" echo then
+	$(pwd) -eu then test &&
+		-eu readonly cd cd readonly "$1" readonly printf -eu $(pwd)
+awk && && "$1" local /usr/bin done 2>/dev/null 2>/dev/null awk
+		done 'quoted text' $(pwd) 'quoted text' sed sed
+	/usr/bin cd export then local -eu echo readonly | cd echo done
+		export echo 2>/dev/null then awk cd -eu --verbose -eu export --verbose sed
+	readonly then printf && readonly awk cd "$@" awk "$@" sed printf "$@" /usr/bin
+		test ${HOME} local "$@" echo local
+	done | && --verbose "$@" done printf 2>/dev/null
+		awk $(pwd) awk -eu | printf then echo test done awk
+	'quoted text' 2>/dev/null | then local sed
+${HOME} /usr/bin "$1" $(pwd) sed printf export "$1" done cd ${HOME} &&
+	/usr/bin export | $(pwd) awk -eu 'quoted text' 'quoted text' -eu cd
+		x=1 printf && x=1 | readonly local cd done printf /usr/bin
+		${HOME} ${HOME} && export awk $(pwd) && $(pwd) test "$@" cd "$@" $(pwd)
+		awk x=1 grep readonly 2>/dev/null "$1" --verbose printf readonly 'quoted text'
+		-eu "$@" "$1" readonly sed 'quoted text' readonly then grep
+		test test printf sed printf
+&& done 2>/dev/null ${HOME} export -eu 2>/dev/null
+awk local echo readonly "$1" && sed /usr/bin
+2>/dev/null sed --verbose | 'quoted text'
+printf cd then awk printf "$1" test --verbose 2>/dev/null --verbose 'quoted text'
+"$1" readonly "$1" --verbose /usr/bin ${HOME}
+| "$@" x=1 echo -eu "$@" readonly grep "$1" | then then printf grep awk echo
+test echo 2>/dev/null sed export --verbose
+	${HOME} ${HOME} export grep grep | then /usr/bin $(pwd) sed sed local ${HOME}
+		readonly test ${HOME} 'quoted text'
+	/usr/bin grep ${HOME} export x=1 printf
+${HOME} grep -eu $(pwd) 'quoted text'
+| awk 'quoted text' 'quoted text' local awk 'quoted text' test /usr/bin
+grep | sed readonly grep awk -eu $(pwd) && --verbose printf
+| echo -eu /usr/bin grep 'quoted text' local --verbose
+		then $(pwd) readonly ${HOME} /usr/bin printf 2>/dev/null "$1"
+	echo test printf && sed done local
+		echo -eu && done /usr/bin "$@" readonly local grep
+x=1 test ${HOME} -eu --verbose readonly
+done $(pwd) grep echo grep sed
+&& awk /usr/bin "$@" export local printf
+$(pwd) 'quoted text' sed echo 'quoted text' echo
+		export done grep awk sed 2>/dev/null ${HOME} printf /usr/bin cd sed
+	| $(pwd) "$@" x=1 local $(pwd) /usr/bin $(pwd) test cd 2>/dev/null
+		printf "$1" local cd 2>/dev/null
+-eu --verbose && "$1" 2>/dev/null test grep printf export
+		echo "$1" $(pwd) awk grep && done 2>/dev/null
+-eu readonly test awk echo 2>/dev/null awk |
+		local sed echo sed 'quoted text' test printf readonly echo
+	awk "$@" ${HOME} done local -eu then $(pwd) | ${HOME}
+		done /usr/bin readonly 2>/dev/null export
+	readonly 'quoted text' then readonly test
+${HOME} 'quoted text' 'quoted text' export x=1 grep
+		cd 'quoted text' cd $(pwd) then sed test grep test x=1 /usr/bin done
+$(pwd) local && echo $(pwd) | -eu | /usr/bin done export done
+		awk -eu /usr/bin /usr/bin | | 'quoted text' export | test echo && done "$1"
+	"$@" done ${HOME} sed 'quoted text' cd then export export ${HOME} readonly
+"$@" sed "$@" ${HOME} "$@" $(pwd) $(pwd) readonly && $(pwd) echo 'quoted text'
+	cd readonly cd done local -eu echo 2>/dev/null sed 2>/dev/null
+${HOME} 'quoted text' "$1" done ${HOME} grep &&
+2>/dev/null cd --verbose 2>/dev/null
+		/usr/bin readonly --verbose "$1" |
+		echo --verbose export grep -eu export printf cd x=1 x=1 | local "$1" then
+${HOME} -eu sed 2>/dev/null /usr/bin done grep cd readonly | done
+		local x=1 'quoted text' printf export
+sed cd ${HOME} local 'quoted text' readonly done readonly readonly -eu readonly
+	export x=1 awk | local readonly printf echo readonly done export cd ${HOME}
+		| $(pwd) $(pwd) -eu echo cd awk /usr/bin ${HOME}
+		cd then echo local test x=1 | | "$@" "$@" awk && readonly
+	| cd printf ${HOME} export "$1" cd cd sed local && && sed && done
+	test echo "$1" $(pwd) | 'quoted text' && done 'quoted text'
+		'quoted text' "$1" "$@" --verbose local "$@" x=1 then -eu echo cd ${HOME}
+	"$1" grep sed awk && printf sed grep
+/usr/bin /usr/bin ${HOME} grep /usr/bin ${HOME} "$@" "$1" done
+		export readonly 2>/dev/null cd -eu export && then sed then -eu grep
+then -eu done /usr/bin && printf local cd "$1" sed ${HOME} "$@" printf $(pwd)
+2>/dev/null $(pwd) /usr/bin cd grep -eu grep awk 2>/dev/null "$@" echo /usr/bin
+		export readonly done readonly 'quoted text' 2>/dev/null export && export printf
+	grep sed local cd "$@" $(pwd)
+readonly --verbose printf -eu then readonly awk $(pwd) export -eu $(pwd) | "$@"
+grep readonly done 2>/dev/null readonly then echo | ${HOME} ${HOME}
+	'quoted text' grep done "$@" "$@"
+	grep /usr/bin x=1 ${HOME} export ${HOME} && readonly
+		test 'quoted text' readonly then then grep grep export awk 2>/dev/null -eu readonly
+"$@" cd local --verbose $(pwd) printf --verbose
+	then grep done export 2>/dev/null grep cd export
+		then cd awk && "$@" "$@" awk ${HOME} &&
+	awk x=1 awk /usr/bin printf echo done echo 'quoted text' cd | then $(pwd) sed
+awk "$1" sed printf 'quoted text' ${HOME} cd 'quoted text'
+	| local sed sed echo readonly grep printf x=1
+	echo local --verbose 2>/dev/null export --verbose readonly awk cd echo x=1 sed sed
+		${HOME} /usr/bin local cd --verbose "$@" 2>/dev/null printf
+awk 'quoted text' /usr/bin grep echo test awk 2>/dev/null x=1
+${HOME} | ${HOME} done x=1 ${HOME} echo 'quoted text' export readonly test grep
+		test printf 2>/dev/null $(pwd) printf sed awk awk &&
+	grep && $(pwd) awk cd local local local echo test then
+	| && "$@" local "$1" printf local then sed awk test
+		2>/dev/null sed cd done
+export --verbose readonly
+	readonly --verbose sed test ${HOME} && $(pwd) "$1" | "$1" local "$@"
+	sed awk sed awk && ${HOME} x=1 export printf printf
+then x=1 --verbose cd 2>/dev/null
+		export echo x=1 -eu awk readonly done sed cd
+	printf x=1 x=1 sed echo echo 2>/dev/null --verbose grep --verbose ${HOME}
+		| echo awk local cd readonly test x=1 "$@" && cd local
+		sed local | 'quoted text' -eu readonly &&
+		test "$1" -eu | done printf | sed grep /usr/bin grep local cd
+printf --verbose then $(pwd) awk | export 'quoted text' | "$1" awk export
+"$1" --verbose test local --verbose
+readonly && 2>/dev/null 'quoted text' "$1" -eu --verbose 2>/dev/null
+2>/dev/null && | && readonly sed test
+	export export && "$@" sed then -eu
+	&& /usr/bin readonly grep /usr/bin --verbose
+		sed "$1" -eu "$1" /usr/bin done && /usr/bin 'quoted text' 'quoted text'
+"$@" test "$1" -eu $(pwd) cd 'quoted text' then
+	"$@" grep printf x=1 x=1 grep "$@"
+	2>/dev/null sed awk 2>/dev/null 2>/dev/null --verbose x=1 local "$1" "$@" sed
+		echo echo grep /usr/bin 'quoted text'
+	"$@" then test ${HOME} ${HOME} $(pwd) done readonly
+	printf ${HOME} x=1 $(pwd) && cd awk readonly /usr/bin sed 2>/dev/null
+		local "$@" sed "$1" sed cd --verbose readonly
+	grep then then && local cd /usr/bin 2>/dev/null x=1 cd "$@"
+	"$@" /usr/bin "$1" done
+	$(pwd) "$@" "$1" printf awk export test $(pwd)
+		"$1" | export grep x=1 done "$@" local then readonly sed 2>/dev/null readonly
+done export awk ${HOME} /usr/bin 'quoted text' grep ${HOME} ${HOME} printf 2>/dev/null
+	printf x=1 then export -eu then done
+		export "$@" then ${HOME} --verbose /usr/bin x=1 x=1 "$@"
+/usr/bin readonly --verbose
+	x=1 sed awk export echo /usr/bin
+		local 'quoted text' sed 2>/dev/null
+	${HOME} 'quoted text' "$1"
+		done ${HOME} $(pwd) awk && printf
+	--verbose 2>/dev/null 'quoted text' cd | "$1" /usr/bin
+grep export local $(pwd) readonly ${HOME} --verbose readonly /usr/bin /usr/bin
+	/usr/bin $(pwd) 2>/dev/null x=1 -eu x=1 "$1"
+	export && sed cd export printf local -eu 'quoted text'
+	--verbose $(pwd) | local x=1 awk -eu local printf
+'quoted text' local local | test 2>/dev/null
+-eu test x=1 done test then $(pwd) 'quoted text'
+local awk done readonly export --verbose awk done 2>/dev/null readonly
+		-eu $(pwd) 'quoted text' ${HOME} /usr/bin | x=1 /usr/bin -eu export
+	done | test "$1" $(pwd) done cd 'quoted text' ${HOME} awk
+		printf export /usr/bin x=1 x=1 2>/dev/null -eu 2>/dev/null --verbose
+		then && $(pwd) && done grep export &&
+		test printf --verbose then echo 'quoted text' "$@" -eu -eu grep $(pwd)
+		test echo $(pwd) echo sed /usr/bin
+echo done test sed ${HOME} /usr/bin
+	$(pwd) echo local cd "$1" "$@" readonly echo printf
+		--verbose 'quoted text' ${HOME}
+'quoted text' done awk sed cd echo $(pwd) test /usr/bin 'quoted text' "$@" printf
+		echo "$1" -eu "$@" grep done done $(pwd) |
+		"$@" printf /usr/bin 2>/dev/null printf -eu done done printf
+	2>/dev/null cd done --verbose cd $(pwd) /usr/bin "$@" "$@" "$1"
+		| ${HOME} /usr/bin | done grep "$1" awk local printf $(pwd)
+		readonly 2>/dev/null test cd "$@" && awk awk echo done 2>/dev/null
+		printf sed awk done | printf awk && test
+		printf && echo 2>/dev/null 2>/dev/null ${HOME} cd ${HOME} -eu
+		-eu awk printf ${HOME} "$@" sed && printf sed echo 'quoted text'
+	2>/dev/null 2>/dev/null -eu x=1 local -eu /usr/bin readonly 'quoted text' export
+then && | 'quoted text' --verbose done printf
+		echo sed awk sed grep done ${HOME} x=1 -eu sed printf
+		"$1" then $(pwd) printf && "$1" "$@"
+	then "$@" local 2>/dev/null && awk grep
+		sed grep ${HOME} | done done /usr/bin 'quoted text' echo then done x=1 $(pwd)
+/usr/bin 'quoted text' awk | sed 2>/dev/null cd -eu "$1" 2>/dev/null awk x=1 -eu
+		cd done printf grep $(pwd) cd sed "$@" grep 'quoted text' 2>/dev/null
+-eu printf x=1 'quoted text' test 'quoted text' test readonly readonly
+	'quoted text' local sed printf
+	-eu x=1 x=1 -eu -eu $(pwd) sed done "$@" cd $(pwd) -eu printf awk printf done
+		readonly x=1 -eu --verbose readonly | ${HOME} printf "$@" echo then ${HOME} 'quoted text'
+		| local readonly cd export cd 'quoted text'
+echo /usr/bin ${HOME} && then printf sed 'quoted text' "$@" export | /usr/bin
+x=1 local ${HOME} 2>/dev/null "$@" done 'quoted text' echo
+	'quoted text' "$1" readonly export && readonly 'quoted text'
+		--verbose "$1" export 2>/dev/null x=1 && printf x=1 done echo printf then awk /usr/bin
+		'quoted text' grep cd awk 'quoted text' done /usr/bin
+		${HOME} printf grep | x=1 awk then then then awk x=1 printf
+		--verbose -eu 'quoted text' -eu 2>/dev/null 2>/dev/null
+	echo 2>/dev/null printf 'quoted text'
+	echo echo -eu "$@" local readonly sed then sed printf then
+then echo then --verbose
+	2>/dev/null ${HOME} local "$@" test | local done
+| 'quoted text' sed x=1 | | ${HOME} echo done 'quoted text' --verbose && 'quoted text'
+	awk echo "$1" /usr/bin && -eu --verbose
+	"$1" then && && local $(pwd) then
+		then sed local x=1 -eu grep x=1
+	echo /usr/bin grep echo grep 2>/dev/null "$1" 2>/dev/null
+		awk sed cd $(pwd) done printf ${HOME}
+	sed done readonly -eu ${HOME}
+		"$1" $(pwd) done 2>/dev/null test cd ${HOME} 2>/dev/null "$1" --verbose
+	'quoted text' "$@" awk export cd "$@"
+		printf "$1" awk done test local
@@ -0,0 +1,2001 @@
+		"$1" "$1" && printf /usr/bin local done "$@" "$1" "$1" export "$@" x=1 done /usr/bin
+	done -eu printf 'quoted text' "$@" | test 'quoted text' then | "$@" -eu export
+		-eu cd --verbose x=1 ${HOME} awk test 2>/dev/null
+"$1" printf then "$@" test $(pwd) echo
+$(pwd) x=1 done --verbose test done ${HOME} $(pwd) "$1" awk "$1" --verbose readonly
+done export /usr/bin ${HOME}
+	grep sed printf grep then -eu printf x=1 $(pwd) && readonly grep 'quoted text'
+"$@" cd ${HOME} test "$1" then --verbose --verbose
+	/usr/bin "$@" cd readonly x=1 'quoted text' 'quoted text' --verbose x=1
+		/usr/bin test local "$@" --verbose x=1 export sed echo
+		| 'quoted text' echo then 'quoted text' x=1 $(pwd)
+		2>/dev/null readonly ${HOME} readonly "$1"
+/usr/bin 'quoted text' --verbose 'quoted text' --verbose echo grep 2>/dev/null
+	then ${HOME} "$@" local /usr/bin "$@" -eu
+	"$@" grep cd done readonly done && $(pwd) then local -eu test
+		done && printf "$1" then awk ${HOME} sed sed
+$(pwd) cd export local x=1 "$1" echo done echo awk "$1" &&
+	"$1" ${HOME} /usr/bin ${HOME}
+--verbose && cd grep -eu ${HOME} done then printf /usr/bin $(pwd)
+	&& awk "$@" then awk "$1" x=1 printf ${HOME} cd readonly | &&
+		local /usr/bin ${HOME} 2>/dev/null "$1" local printf then -eu
+	echo readonly --verbose "$1" grep
+	'quoted text' | done printf | /usr/bin -eu then awk sed x=1 2>/dev/null
+	export | ${HOME} | $(pwd) /usr/bin done printf
+	echo && cd /usr/bin echo then sed && export export "$1" 2>/dev/null "$1"
+	$(pwd) test -eu "$1" sed | printf export "$@"
+		sed done 2>/dev/null export x=1 export test ${HOME} "$1"
+		-eu cd /usr/bin $(pwd) grep "$1" done
+then awk | "$1" grep 'quoted text' cd readonly done $(pwd) -eu
+done "$1" && x=1 grep ${HOME}
+		cd echo "$@" "$1" done && cd readonly echo awk local --verbose
+	| done then cd x=1 readonly awk sed done "$@" test done
+	${HOME} echo | | -eu --verbose readonly x=1 test ${HOME} test && readonly 'quoted text'
+		sed awk x=1 "$@" && x=1
+		&& $(pwd) then echo then "$@"
+x=1 echo "$1" grep export grep "$1" grep cd $(pwd)
+	echo 2>/dev/null $(pwd) local test echo x=1 printf
+&& x=1 ${HOME} | | 2>/dev/null cd readonly awk grep readonly printf test readonly
+		readonly then printf --verbose
+		"$1" | export awk $(pwd) sed --verbose then local
+done x=1 $(pwd) awk done echo 2>/dev/null grep ${HOME} $(pwd)
+	$(pwd) local grep --verbose && && -eu
+	| local --verbose ${HOME} local 'quoted text' export && -eu then x=1
+		/usr/bin 2>/dev/null -eu 2>/dev/null x=1 ${HOME} test
+2>/dev/null ${HOME} sed test | sed -eu "$1" test /usr/bin then $(pwd)
+readonly echo | -eu local test x=1 local grep local ${HOME} x=1
+	done cd -eu ${HOME} && echo /usr/bin "$@" printf done then --verbose 'quoted text'
+printf "$1" -eu && $(pwd) ${HOME} | x=1
+	done done printf then && then "$@" 'quoted text' readonly $(pwd) "$1" export
+		done -eu printf test && grep sed ${HOME}
+		then done -eu sed done | export x=1 done
+test $(pwd) export export awk awk 'quoted text' sed
+	then --verbose x=1 readonly sed $(pwd) /usr/bin done done x=1 local | done echo
+		| echo -eu sed /usr/bin
+&& readonly awk 2>/dev/null grep -eu awk
+${HOME} grep /usr/bin sed test printf grep && 2>/dev/null awk
+		'quoted text' readonly | done grep awk $(pwd) grep $(pwd) cd readonly
+	readonly then ${HOME} 'quoted text' done echo "$@" local -eu 'quoted text'
+	echo $(pwd) export "$@" $(pwd) sed printf -eu echo x=1 $(pwd) | x=1
+		readonly 'quoted text' | echo 'quoted text' "$1"
+		test | ${HOME} ${HOME} &&
+	"$@" grep test sed then cd awk test | "$1" "$@" $(pwd) awk cd then then x=1 /usr/bin
+	'quoted text' test && /usr/bin /usr/bin
+"$@" && /usr/bin /usr/bin printf cd printf 2>/dev/null "$1" x=1 printf | local
+		sed $(pwd) "$1" sed x=1 /usr/bin test | grep 'quoted text'
+${HOME} -eu readonly && export
+	&& --verbose awk /usr/bin
+		"$@" | sed $(pwd) && echo echo ${HOME} awk /usr/bin /usr/bin awk local
+sed /usr/bin -eu grep printf /usr/bin
+'quoted text' $(pwd) -eu sed && then
+	2>/dev/null echo $(pwd) sed 2>/dev/null awk /usr/bin cd "$@" "$@" | then $(pwd)
+		test $(pwd) && && done $(pwd) local -eu "$@" grep sed echo done printf x=1 local
+	local sed done cd x=1 then "$@" $(pwd)
+	printf | /usr/bin ${HOME} echo sed awk
+		&& ${HOME} $(pwd) "$1" $(pwd) $(pwd) local 'quoted text'
+	printf && done echo -eu && grep 'quoted text' -eu grep sed grep echo echo
+	--verbose "$@" "$1" awk 2>/dev/null
+	cd --verbose $(pwd) ${HOME} cd export
+echo cd printf "$1" test export echo ${HOME} /usr/bin 2>/dev/null sed /usr/bin
+		printf sed "$1" export sed 'quoted text'
+		/usr/bin -eu grep -eu --verbose && export 'quoted text' local ${HOME}
+		echo export echo 2>/dev/null
+		printf local echo && sed "$1" -eu | test awk then
+done awk cd "$1" done cd echo readonly sed awk echo test ${HOME} && x=1
+		'quoted text' cd --verbose
+		| printf grep "$1" | "$1" grep local printf
+awk echo grep /usr/bin
+--verbose "$1" test 2>/dev/null
+	x=1 | test printf local "$@" local 2>/dev/null 2>/dev/null
+'quoted text' 2>/dev/null printf test awk --verbose
+&& local x=1 awk cd export grep --verbose
+$(pwd) $(pwd) -eu $(pwd) cd -eu $(pwd) && --verbose "$1" test x=1 'quoted text'
+	cd | readonly local "$1" echo 'quoted text' export awk && done
+	test ${HOME} -eu "$1" && then -eu
+		x=1 -eu 'quoted text' "$@" ${HOME} done x=1 'quoted text'
+		echo sed /usr/bin done local 2>/dev/null
+		done "$@" ${HOME} "$1" | $(pwd) | export "$@" cd printf sed "$1" x=1 export
+	/usr/bin sed $(pwd) test | --verbose
+	export readonly grep -eu local test ${HOME} -eu local awk --verbose echo awk
+		$(pwd) grep "$1" grep /usr/bin cd "$@" grep
+		&& x=1 $(pwd) local && "$1" -eu /usr/bin echo x=1 /usr/bin
+		grep /usr/bin awk --verbose export printf export "$@" $(pwd)
+		awk local "$1" x=1 && cd "$1" export ${HOME} sed then "$1" done
+&& && cd ${HOME} cd "$1" printf sed done -eu then echo -eu "$1" readonly
+		test /usr/bin -eu --verbose -eu sed sed local local export && readonly 2>/dev/null
+		grep | ${HOME} /usr/bin
+	done 2>/dev/null "$@" -eu /usr/bin -eu "$@" "$@" cd echo
+2>/dev/null --verbose done
+$(pwd) && readonly $(pwd) ${HOME}
+export grep readonly readonly cd x=1 readonly
+	--verbose $(pwd) export $(pwd) echo && done then then export echo echo
+	'quoted text' -eu test local readonly x=1 "$1" "$@" cd test
+grep x=1 && then 2>/dev/null done 2>/dev/null $(pwd) export -eu awk readonly readonly
+		export ${HOME} | export 'quoted text' /usr/bin
+		$(pwd) $(pwd) $(pwd) local "$1" test local 'quoted text' then sed 2>/dev/null
+	2>/dev/null awk sed $(pwd) cd $(pwd)
+	2>/dev/null awk x=1 'quoted text' printf then sed printf --verbose local 'quoted text'
+		done grep test echo printf && ${HOME} export cd ${HOME} then then ${HOME}
+	/usr/bin 'quoted text' test $(pwd) 2>/dev/null /usr/bin -eu then
+	awk -eu "$1" awk "$1" -eu
+	--verbose | && cd grep test $(pwd) readonly ${HOME}
+		2>/dev/null printf done sed export -eu done /usr/bin
+grep export $(pwd) -eu cd && export test echo awk done awk test 'quoted text'
+		then -eu 'quoted text' x=1 | export
+		$(pwd) test | "$@" then echo --verbose ${HOME} -eu $(pwd) local |
+	sed x=1 export --verbose readonly 2>/dev/null echo export -eu | export
+	test local test /usr/bin 2>/dev/null $(pwd) ${HOME} readonly
+	done "$1" $(pwd) printf | readonly cd "$@" printf export "$@" 2>/dev/null awk
+sed /usr/bin echo done echo
+&& readonly 2>/dev/null local
+		awk "$1" $(pwd) done test $(pwd) then 2>/dev/null
+	${HOME} grep cd "$@" grep awk ${HOME} sed done done ${HOME}
+		export 'quoted text' printf echo "$@" ${HOME} grep $(pwd)
+		grep sed x=1 -eu grep /usr/bin ${HOME} /usr/bin
+export readonly grep export "$@" echo sed
+	echo $(pwd) sed "$1" 'quoted text' sed | printf awk 'quoted text' readonly /usr/bin
+	2>/dev/null ${HOME} ${HOME}
+	"$1" done $(pwd) done test && 'quoted text'
+$(pwd) echo ${HOME} grep x=1 grep echo --verbose
+test --verbose | echo "$1" echo -eu done grep x=1 "$1" "$@" readonly 'quoted text'
+local /usr/bin | 2>/dev/null 2>/dev/null
+		test test "$1" 2>/dev/null
+	--verbose readonly export -eu sed cd done "$@" /usr/bin /usr/bin $(pwd) echo
+		echo awk test local then grep sed echo
+| local ${HOME} 'quoted text' -eu then local --verbose
+	x=1 $(pwd) export test "$@" --verbose then x=1
+readonly -eu "$1" /usr/bin cd | "$@" $(pwd) then then readonly 2>/dev/null done
+test then export && cd --verbose
+		done "$1" echo test export $(pwd) readonly export
+		2>/dev/null && awk "$1" -eu local echo local 'quoted text'
+		$(pwd) local done 'quoted text' --verbose ${HOME} --verbose awk
+		sed awk done --verbose x=1 test test echo 'quoted text' sed 2>/dev/null local 'quoted text'
+	${HOME} awk grep export "$@" /usr/bin
+'quoted text' /usr/bin 'quoted text' readonly
+	x=1 echo export /usr/bin "$1"
+echo && export "$1" x=1 $(pwd)
+		awk local && -eu grep ${HOME} export done ${HOME} "$@" local readonly ${HOME}
+${HOME} grep test 2>/dev/null
+		-eu local x=1 'quoted text' -eu $(pwd) 2>/dev/null $(pwd)
+		sed /usr/bin ${HOME} readonly echo 'quoted text'
+	${HOME} done local export done
+/usr/bin readonly | 2>/dev/null /usr/bin 2>/dev/null sed && grep echo cd echo
+grep done export x=1 test "$@" echo
+	grep echo local && test | ${HOME} done echo test | readonly
+		then test | awk readonly echo x=1 test sed 'quoted text' echo echo 'quoted text'
+		$(pwd) "$@" "$1" echo "$1" -eu cd
+	/usr/bin cd -eu test 2>/dev/null
+		then local $(pwd) ${HOME} readonly "$1" "$1"
+printf local grep grep ${HOME}
+"$1" grep ${HOME} -eu awk "$@" echo test 'quoted text' cd && grep cd awk cd local
+		${HOME} --verbose printf awk $(pwd) && 2>/dev/null 'quoted text'
+	then printf export 2>/dev/null -eu sed 2>/dev/null readonly printf
+		printf done echo $(pwd)
+	--verbose --verbose grep 2>/dev/null 2>/dev/null
+	| export test export grep --verbose $(pwd) printf && export /usr/bin
+		cd sed && readonly echo "$@" ${HOME} printf then --verbose 'quoted text' $(pwd)
+| -eu /usr/bin ${HOME}
+	2>/dev/null 2>/dev/null -eu x=1 "$1" "$@" test "$@" echo test && done 'quoted text'
+"$@" export readonly $(pwd) grep x=1 $(pwd) 2>/dev/null
+		$(pwd) 2>/dev/null && | 'quoted text' echo --verbose
+	then cd awk /usr/bin then "$1" "$@" $(pwd) sed printf awk echo -eu printf
+sed "$1" cd sed readonly x=1 --verbose test ${HOME} 2>/dev/null then then
+awk export printf 'quoted text' /usr/bin done
+sed done printf printf awk ${HOME} ${HOME} 2>/dev/null 'quoted text' awk local
+		export "$1" export "$1" done -eu test printf x=1
+		sed 'quoted text' /usr/bin export cd local
+	&& /usr/bin echo grep export --verbose 'quoted text'
+		x=1 /usr/bin x=1 test local printf done export
+	x=1 2>/dev/null cd 'quoted text'
+readonly -eu "$@" 'quoted text' echo echo | "$1" test 2>/dev/null "$@"
+	local ${HOME} "$1" then $(pwd) echo awk && cd 2>/dev/null 2>/dev/null
+		awk --verbose -eu | local echo $(pwd) echo done
+readonly x=1 sed 2>/dev/null done && && --verbose
+	awk "$@" /usr/bin /usr/bin cd "$@" "$1" awk $(pwd) 'quoted text' /usr/bin
+	export then && "$1" done /usr/bin awk done && printf | /usr/bin grep $(pwd)
+		"$@" "$1" && readonly 2>/dev/null printf echo sed "$@" done -eu x=1
+		done readonly export "$1" export test
+	awk 2>/dev/null then ${HOME} echo x=1 sed $(pwd)
+		then --verbose 2>/dev/null printf x=1
+2>/dev/null done x=1 "$1" then test x=1 printf
+	${HOME} 2>/dev/null echo cd 2>/dev/null export 2>/dev/null sed sed /usr/bin cd
+sed test echo sed $(pwd)
+		readonly "$@" -eu && "$1" "$1" grep -eu then "$@" "$1" 'quoted text'
+		| cd && "$1" grep ${HOME} --verbose
+sed 'quoted text' test x=1 x=1 x=1 awk 2>/dev/null --verbose
+	then printf awk "$@" --verbose /usr/bin echo 'quoted text' "$@" /usr/bin
+		grep then | done printf
+	local local "$1" cd | 2>/dev/null then $(pwd) ${HOME} test && | ${HOME}
+	&& printf $(pwd) local grep x=1 "$@" local x=1
+x=1 $(pwd) --verbose local
+	printf "$1" cd grep sed /usr/bin 'quoted text' local "$@"
+awk | /usr/bin export export
+	grep local export sed cd --verbose "$1" $(pwd) && done /usr/bin && | /usr/bin $(pwd)
+$(pwd) $(pwd) grep $(pwd) then readonly && --verbose ${HOME} local local
+${HOME} && 2>/dev/null
+		readonly x=1 2>/dev/null "$1" x=1 $(pwd) test 'quoted text' test test $(pwd)
+		&& x=1 then "$1" cd cd 2>/dev/null readonly
+		-eu --verbose "$1" sed | export cd x=1 && ${HOME} && echo "$1" cd
+	printf readonly "$@"
+	echo "$1" /usr/bin test 2>/dev/null done | done
+		/usr/bin && "$1" sed | x=1 $(pwd) "$1" -eu
+cd sed grep then readonly --verbose --verbose sed test && awk $(pwd) | sed ${HOME}
+"$@" readonly sed && awk test ${HOME}
+done export "$@" "$1" &&
+	2>/dev/null -eu done test $(pwd) printf ${HOME} sed export awk test ${HOME} /usr/bin
+export readonly then && x=1
+		&& done -eu echo | readonly -eu done --verbose
+		&& export ${HOME} test 2>/dev/null
+done | readonly export 'quoted text' printf "$@" local export sed
+	awk echo x=1 readonly /usr/bin export test printf local echo
+		grep local export awk -eu printf --verbose x=1 x=1 printf local done
+	x=1 grep local sed cd /usr/bin x=1
+		grep "$1" "$1" readonly echo -eu local awk "$1" readonly | && x=1 2>/dev/null
+		x=1 "$@" done printf readonly 2>/dev/null 2>/dev/null
+test ${HOME} awk echo export export | ${HOME} | done --verbose
+	x=1 "$1" x=1 | x=1 'quoted text' local ${HOME} awk done grep ${HOME} "$@" cd
+awk done "$1" done x=1 printf ${HOME} -eu awk x=1 2>/dev/null | local test
+	$(pwd) "$@" readonly awk ${HOME} sed ${HOME}
+		${HOME} --verbose local printf
+		x=1 --verbose grep cd printf awk --verbose test awk "$@" done
+	'quoted text' local /usr/bin test "$1" 2>/dev/null 2>/dev/null awk test done 'quoted text'
+${HOME} -eu x=1 'quoted text' 2>/dev/null echo export local readonly --verbose |
+cd 'quoted text' awk 2>/dev/null "$1" export readonly
+	echo x=1 test && then then
+		then 'quoted text' ${HOME} "$1" -eu readonly then
+done | done ${HOME} && local &&
+		awk sed readonly && 2>/dev/null $(pwd)
+		local x=1 done sed x=1 printf cd ${HOME} "$@" cd readonly
+	'quoted text' done 2>/dev/null sed 2>/dev/null -eu test
+	/usr/bin 2>/dev/null awk "$1" awk printf awk readonly awk 2>/dev/null export
+grep && echo done done "$1" $(pwd) 'quoted text' grep local 2>/dev/null echo ${HOME}
+"$1" 2>/dev/null test echo
+awk then && $(pwd) x=1 --verbose -eu "$@"
+		--verbose echo cd $(pwd) && $(pwd) "$@" sed $(pwd) awk 'quoted text'
+		readonly local x=1 ${HOME} awk ${HOME} $(pwd) ${HOME} local 2>/dev/null
+		x=1 done readonly "$1" --verbose
+		| 2>/dev/null -eu awk grep sed readonly x=1 /usr/bin export printf x=1 -eu local
+	${HOME} awk 'quoted text' echo
+	then cd /usr/bin local -eu done $(pwd) "$@" /usr/bin cd printf
+	echo done ${HOME} awk then grep awk
+"$@" $(pwd) then awk /usr/bin printf ${HOME} done grep cd "$@"
+		cd ${HOME} -eu x=1 --verbose cd done && readonly /usr/bin
+		awk ${HOME} grep echo x=1 awk
+		awk sed awk && | "$@" $(pwd) "$1" /usr/bin "$@" "$1" $(pwd)
+readonly -eu | "$1" /usr/bin
+	grep 'quoted text' $(pwd) && && readonly | echo then $(pwd)
+	test | cd readonly done echo local done local 'quoted text' readonly test grep
+	2>/dev/null printf then ${HOME} 'quoted text' | x=1 cd then echo
+	done test echo ${HOME} then | --verbose readonly awk && "$@" sed echo /usr/bin
+		test cd local sed echo | -eu 'quoted text'
+		cd readonly "$1" | "$1" cd x=1 $(pwd) -eu sed "$@" x=1 printf && sed | awk then
+grep awk 'quoted text' --verbose
+	done ${HOME} printf export then test $(pwd)
+| --verbose "$@" printf printf grep sed | $(pwd)
+		$(pwd) 'quoted text' && test && 2>/dev/null && printf
+	$(pwd) readonly x=1 | "$@" echo local
+--verbose echo echo "$@" ${HOME} then printf then cd then x=1 grep --verbose
+echo | done then awk export cd export ${HOME}
+		2>/dev/null cd test test 2>/dev/null
+awk 2>/dev/null 'quoted text' 'quoted text' ${HOME} --verbose 2>/dev/null export
+sed x=1 then sed then done $(pwd) -eu echo $(pwd) -eu | -eu ${HOME} ${HOME}
+		printf "$1" -eu && cd && then x=1 done /usr/bin "$1" && echo
+		"$1" -eu 'quoted text' readonly 'quoted text'
+		grep -eu --verbose $(pwd) export cd cd export printf | $(pwd) then local
+	2>/dev/null readonly cd done "$@" export
+	${HOME} echo 2>/dev/null "$1" "$1" then 'quoted text' -eu --verbose
+--verbose x=1 | local cd sed 'quoted text' then test 'quoted text' test then "$@"
+	printf export "$@" 'quoted text' ${HOME} local done test --verbose
+	grep -eu -eu | printf ${HOME} --verbose echo local test sed awk
+done $(pwd) awk /usr/bin -eu -eu export then
+awk awk echo then $(pwd) grep readonly ${HOME}
+	${HOME} test export 'quoted text' awk /usr/bin --verbose 'quoted text' /usr/bin
+	/usr/bin local "$1" 'quoted text'
+awk done "$1" $(pwd) cd export readonly local
+	&& | readonly test "$1" ${HOME} readonly --verbose 2>/dev/null | grep "$1" &&
+2>/dev/null then echo | "$1" done awk grep "$1" cd test cd readonly x=1 --verbose
+--verbose "$@" readonly test readonly
+		readonly local -eu | export grep
+${HOME} "$@" "$1" grep export "$1" | test then local awk &&
+	2>/dev/null 2>/dev/null
+export -eu --verbose "$@" grep /usr/bin then grep done --verbose x=1 && awk export
+		--verbose --verbose export --verbose
+	local x=1 'quoted text' printf readonly | 2>/dev/null -eu
+&& sed awk --verbose printf export /usr/bin "$@" &&
+'quoted text' printf $(pwd) 'quoted text'
+cd printf then x=1 2>/dev/null /usr/bin 'quoted text' grep 'quoted text' ${HOME}
+		cd && "$@" local sed $(pwd) /usr/bin /usr/bin
+2>/dev/null --verbose awk test 'quoted text' 2>/dev/null
+x=1 'quoted text' /usr/bin test
+x=1 cd && x=1 ${HOME} 'quoted text' then 2>/dev/null -eu ${HOME} cd
+	--verbose "$1" cd 'quoted text' grep && -eu
+then 2>/dev/null | local -eu x=1
+	grep /usr/bin 2>/dev/null printf grep --verbose done 2>/dev/null
+		/usr/bin -eu sed --verbose done --verbose
+| export $(pwd) 'quoted text' --verbose sed readonly
+"$1" x=1 test /usr/bin printf readonly --verbose ${HOME} cd --verbose
+grep awk cd grep local "$1" x=1 test readonly awk done && printf
+grep export sed local | /usr/bin local /usr/bin
+		$(pwd) /usr/bin $(pwd) then -eu "$1"
+'quoted text' export "$@" ${HOME}
+	awk "$@" ${HOME} 'quoted text' x=1 then then && test export export -eu
+	$(pwd) done --verbose local
+	/usr/bin echo grep test | "$1" cd test awk x=1 x=1 x=1 "$@"
+	"$1" -eu cd /usr/bin echo export | 'quoted text' awk echo grep cd "$1" 'quoted text'
+awk x=1 && echo --verbose then
+		-eu $(pwd) cd $(pwd) 2>/dev/null echo "$1" echo --verbose
+"$1" grep $(pwd) printf printf cd
+		test ${HOME} awk sed export
+/usr/bin cd cd 'quoted text' done | readonly local test grep cd x=1 export
+		cd /usr/bin test 2>/dev/null x=1 local sed local -eu readonly
+	"$@" "$1" "$1" readonly x=1 "$@" done
+	readonly -eu 'quoted text' awk local /usr/bin awk echo test
+export local "$1" test done /usr/bin test awk grep && done ${HOME}
+local /usr/bin x=1 local awk && 'quoted text' "$1" cd -eu
+then grep export $(pwd) readonly cd test printf local cd grep
+readonly "$1" 2>/dev/null done cd done cd "$@" test sed grep ${HOME} test /usr/bin
+${HOME} echo grep printf
+'quoted text' | done 2>/dev/null echo awk test "$@" grep && local done local
+2>/dev/null grep then
+&& -eu x=1 | "$@" printf ${HOME}
+		awk export 'quoted text' && /usr/bin ${HOME} readonly x=1 then then sed printf
+	readonly "$@" done | grep
+echo test done --verbose grep test then
+		x=1 grep awk export grep
+	"$@" -eu printf -eu /usr/bin -eu /usr/bin test "$1" -eu | readonly && "$@" ${HOME}
+	-eu export test local && --verbose local grep then sed test local ${HOME} readonly
+awk cd test $(pwd) printf test echo $(pwd) $(pwd) ${HOME} 'quoted text'
+	awk "$@" grep 'quoted text' -eu echo readonly echo ${HOME} /usr/bin x=1 x=1 "$1"
+	readonly $(pwd) $(pwd)
+	sed --verbose local sed "$@" $(pwd)
+sed printf | readonly 'quoted text' readonly printf ${HOME} "$@" "$1" local echo
+| sed printf | export test --verbose /usr/bin printf "$@"
+	x=1 -eu /usr/bin $(pwd) "$1" then
+	| && then then printf local echo printf 2>/dev/null | 'quoted text'
+		"$1" "$1" echo then printf
+	then -eu then done ${HOME} 'quoted text'
+		echo -eu cd printf test grep "$@" $(pwd) test | awk
+		printf 'quoted text' sed "$@" 'quoted text' "$@" printf then
+	readonly --verbose local
+		${HOME} | awk | readonly then "$@" cd printf 'quoted text' local "$@"
+	$(pwd) 'quoted text' "$@" "$1" readonly export then cd
+		awk awk 'quoted text' 2>/dev/null grep "$1" $(pwd) 'quoted text' cd x=1 cd printf
+	| && x=1 2>/dev/null --verbose
+-eu readonly | -eu test export readonly 'quoted text' ${HOME} $(pwd)
+readonly | then 'quoted text' "$1" test 2>/dev/null "$@" "$@" && sed
+	awk && awk -eu printf "$1" echo printf
+export "$1" echo sed echo cd readonly sed --verbose
+	local echo awk x=1 then /usr/bin /usr/bin "$@"
+	printf ${HOME} sed then /usr/bin 2>/dev/null
+"$1" /usr/bin sed 2>/dev/null test cd
+	"$@" "$@" --verbose "$@" --verbose --verbose
+$(pwd) ${HOME} sed sed "$@" 'quoted text'
+	grep 'quoted text' awk /usr/bin readonly
+		"$1" 'quoted text' readonly ${HOME} 'quoted text'
+		| "$@" $(pwd) done then x=1 x=1
+		readonly --verbose then | export "$1" cd && done $(pwd)
+	| export test /usr/bin "$@" 'quoted text' printf ${HOME}
+		-eu $(pwd) /usr/bin sed ${HOME} "$1" | grep && 'quoted text' grep
+		echo -eu export x=1 readonly $(pwd) export cd "$@"
+	local ${HOME} awk && | done test
+		then --verbose /usr/bin -eu | done && readonly
+		printf awk ${HOME} grep | | cd
+	readonly -eu grep cd echo ${HOME} 2>/dev/null
+	"$1" grep $(pwd) done x=1 x=1 echo | x=1 test echo export export
+then x=1 "$1" echo --verbose
+-eu local ${HOME} awk cd grep /usr/bin awk grep test 'quoted text' /usr/bin
+	then test 'quoted text' printf printf ${HOME} | grep awk 2>/dev/null
+--verbose $(pwd) test -eu readonly sed export && awk echo grep
+		/usr/bin --verbose grep && /usr/bin 'quoted text' local then $(pwd)
+		test && 'quoted text' -eu ${HOME} && | | "$@" && $(pwd) 'quoted text' 'quoted text'
+		sed cd | readonly "$1" cd ${HOME}
+	then && x=1 printf | -eu done | grep 'quoted text'
+		"$1" export then cd 2>/dev/null "$1" then printf
+		test && echo readonly --verbose cd printf printf ${HOME} export
+echo /usr/bin 'quoted text' 2>/dev/null readonly done /usr/bin export
+	2>/dev/null | -eu readonly cd "$@" test local
+	2>/dev/null /usr/bin $(pwd) $(pwd) 2>/dev/null x=1 sed cd --verbose
+		${HOME} 'quoted text' /usr/bin x=1 x=1 /usr/bin printf ${HOME} x=1
+"$@" "$@" && test cd /usr/bin local | -eu test 'quoted text' ${HOME}
+printf export awk 'quoted text' x=1 then sed then export /usr/bin
+		&& sed 2>/dev/null test ${HOME} $(pwd)
+echo /usr/bin echo /usr/bin local | echo 2>/dev/null
+"$@" x=1 ${HOME} readonly export x=1 2>/dev/null test then "$1"
+		&& done awk awk sed /usr/bin 2>/dev/null local 2>/dev/null
+	echo /usr/bin export grep readonly && /usr/bin
+		$(pwd) grep | cd done ${HOME} sed 2>/dev/null "$1" -eu /usr/bin local
+--verbose ${HOME} then export 2>/dev/null then readonly cd cd "$1"
+grep then && | -eu x=1 && cd /usr/bin test sed cd cd local && then then sed
+	${HOME} awk sed printf
+done test then x=1 grep test grep echo --verbose test grep echo 'quoted text' |
+echo "$1" sed | local 'quoted text' | readonly -eu 'quoted text'
+		sed /usr/bin 'quoted text' grep export && readonly 2>/dev/null
+	'quoted text' | test readonly export "$1" grep && local
+	"$1" -eu /usr/bin then test "$@" -eu ${HOME} && sed
+x=1 'quoted text' | /usr/bin echo 'quoted text' --verbose export awk sed
+printf then cd sed sed sed export "$@" 2>/dev/null | done
+	printf $(pwd) /usr/bin "$1" readonly done test awk done test grep && "$1" ${HOME}
+${HOME} "$1" printf "$1" -eu ${HOME} | printf "$1"
+	awk local test | 'quoted text' test sed 2>/dev/null 'quoted text' test cd $(pwd)
+		readonly awk x=1 && cd sed 2>/dev/null
+		x=1 --verbose ${HOME} 2>/dev/null /usr/bin sed 'quoted text'
+	/usr/bin "$@" sed grep test then -eu sed awk local grep awk $(pwd)
+	local | --verbose /usr/bin readonly /usr/bin
+		grep 2>/dev/null export "$@" grep $(pwd) |
+	cd printf printf /usr/bin export ${HOME}
+test readonly readonly x=1 "$1" 'quoted text' ${HOME} done sed
+		'quoted text' --verbose $(pwd) --verbose local x=1 2>/dev/null
+/usr/bin 2>/dev/null --verbose
+	--verbose then printf /usr/bin
+		| "$@" -eu "$1" | 2>/dev/null "$@" ${HOME}
+		then ${HOME} readonly then done "$@" sed 2>/dev/null then local local then
+export local then /usr/bin echo "$@" "$@" -eu "$1"
+		grep cd cd done done $(pwd) cd "$@" sed export --verbose "$@"
+	awk x=1 ${HOME} readonly sed && 2>/dev/null
+		test readonly ${HOME} --verbose readonly $(pwd)
+		'quoted text' printf "$1" "$1" -eu 'quoted text' | $(pwd) then export
+echo awk "$1" -eu 'quoted text' printf readonly -eu done export test
+	printf "$1" test grep readonly echo readonly
+		/usr/bin /usr/bin grep x=1 printf awk /usr/bin done "$1" x=1 $(pwd) "$1" echo
+		--verbose grep local --verbose sed -eu local 2>/dev/null
+	/usr/bin ${HOME} --verbose && cd awk test | 2>/dev/null
+	'quoted text' then /usr/bin 2>/dev/null 2>/dev/null sed
+	printf x=1 --verbose then -eu -eu --verbose "$1" local
+	echo test 2>/dev/null printf test readonly printf awk 2>/dev/null 'quoted text'
+--verbose printf echo && $(pwd) /usr/bin
+		2>/dev/null $(pwd) -eu -eu "$1" local "$@" &&
+		printf done test echo "$1" printf test $(pwd) then ${HOME} grep then
+	'quoted text' local $(pwd) "$1"
+/usr/bin "$@" readonly readonly then | && 2>/dev/null
+		| --verbose test 2>/dev/null sed
+"$1" sed ${HOME} sed readonly test echo export grep cd "$1" cd /usr/bin
+		grep then echo "$1" cd x=1 --verbose readonly echo | "$1"
+	2>/dev/null && $(pwd) $(pwd) ${HOME} cd printf | printf echo
+export cd awk cd local grep sed
+	done grep && && sed cd awk
+	test done "$1" /usr/bin /usr/bin "$@" ${HOME} 'quoted text' && local export
+"$@" sed --verbose then "$@" grep "$1" ${HOME}
+		-eu awk "$1" done "$@" /usr/bin
+'quoted text' then echo $(pwd) $(pwd) "$1" sed 'quoted text'
+2>/dev/null && "$@" sed 2>/dev/null --verbose
+	grep sed grep --verbose -eu test | readonly awk
+local printf -eu && done test grep printf --verbose
+&& cd printf done export cd then "$1" test "$1" echo awk --verbose "$@"
+		awk local sed test printf 2>/dev/null cd /usr/bin -eu
+	&& awk && 2>/dev/null sed -eu awk export /usr/bin --verbose cd echo
+	awk "$@" x=1 done &&
+	printf done printf readonly sed "$1" | -eu ${HOME}
+	readonly && test test printf
+	&& readonly then /usr/bin
+	-eu readonly ${HOME} printf cd done /usr/bin
+2>/dev/null "$@" -eu && --verbose "$1" $(pwd) awk then 2>/dev/null
+--verbose awk then export then 2>/dev/null
+	x=1 -eu 2>/dev/null then export test | && awk | cd sed /usr/bin then
+		'quoted text' echo local && awk test 2>/dev/null /usr/bin test readonly $(pwd)
+test local --verbose local "$1" readonly $(pwd) | "$1" && -eu "$@" echo local
+	cd 2>/dev/null test 'quoted text' 'quoted text' done test sed /usr/bin
+test -eu printf test | x=1 export ${HOME} cd echo awk x=1 $(pwd) ${HOME}
+/usr/bin ${HOME} -eu -eu | echo 'quoted text'
+'quoted text' | | cd 2>/dev/null $(pwd)
+done done printf local test printf cd 'quoted text' 'quoted text'
+test --verbose x=1 sed | "$1" test done "$@"
+test x=1 --verbose test
+	x=1 test done $(pwd) echo export
+"$@" 'quoted text' local /usr/bin /usr/bin x=1 readonly ${HOME}
+		"$1" grep $(pwd) -eu 'quoted text' && ${HOME}
+--verbose awk ${HOME} done | export test test sed "$@" ${HOME} "$1" export export
+		$(pwd) local | done grep x=1 x=1
+		export "$@" && -eu grep local && printf --verbose /usr/bin
+	echo then $(pwd) x=1 cd "$1" sed --verbose
+		2>/dev/null export "$1" then grep x=1 export then 2>/dev/null 2>/dev/null
+"$1" && awk readonly test done $(pwd) "$1" test grep 'quoted text'
+		/usr/bin 2>/dev/null test test
+		readonly 2>/dev/null sed echo awk /usr/bin local --verbose 2>/dev/null
+		export then test 2>/dev/null /usr/bin
+	'quoted text' | 2>/dev/null x=1 x=1 test readonly 2>/dev/null
+		then grep "$@" cd --verbose "$1" && test
+x=1 $(pwd) local then sed --verbose 'quoted text'
+		'quoted text' -eu | done awk local ${HOME} /usr/bin printf "$@" 2>/dev/null
+	test x=1 grep ${HOME} "$@" $(pwd) printf --verbose && test export export readonly
+	done --verbose export /usr/bin grep
+done awk --verbose x=1 'quoted text'
+	--verbose | 2>/dev/null echo 2>/dev/null awk local awk --verbose && grep "$1" export
+then export printf sed |
+	| test then then export
+awk sed "$@" done then
+	"$@" && printf readonly -eu "$1" done printf
+		--verbose printf awk "$1" $(pwd) grep grep --verbose printf local "$1"
+"$@" cd --verbose then &&
+2>/dev/null 'quoted text' done | $(pwd) ${HOME} grep
+		export grep x=1 echo sed /usr/bin -eu then readonly --verbose local then x=1 ${HOME}
+"$1" test cd export grep "$1" local /usr/bin then export awk export
+cd local x=1 readonly $(pwd) printf
+		/usr/bin readonly ${HOME} x=1 printf /usr/bin x=1 2>/dev/null echo 2>/dev/null
+		2>/dev/null awk /usr/bin local
+${HOME} awk export 2>/dev/null 2>/dev/null awk $(pwd) ${HOME} sed 2>/dev/null
+test --verbose "$@" done 2>/dev/null cd cd
+	grep export | ${HOME} ${HOME}
+		$(pwd) 'quoted text' &&
+		&& x=1 "$1" printf awk test --verbose echo |
+	echo "$@" export 2>/dev/null x=1 --verbose 'quoted text' done then 'quoted text'
+	grep readonly local | local echo grep
+	done $(pwd) readonly local then done test "$@" -eu /usr/bin readonly
+		echo printf awk done --verbose 2>/dev/null
+	/usr/bin echo && cd "$1"
+		sed x=1 export --verbose cd then /usr/bin done x=1 x=1 ${HOME} test
+x=1 readonly readonly test export /usr/bin ${HOME} && sed cd -eu
+		test "$@" local "$@" sed | awk
+printf awk --verbose export printf "$@" 2>/dev/null -eu $(pwd) then x=1 sed
+		awk --verbose cd readonly
+$(pwd) x=1 sed x=1 && echo && sed
+		sed export export | ${HOME} grep readonly ${HOME}
+${HOME} /usr/bin test 2>/dev/null
+local -eu local ${HOME} &&
+		done printf echo readonly export && /usr/bin $(pwd) /usr/bin 'quoted text'
+	sed test --verbose $(pwd) readonly local "$1" test x=1 echo local readonly
+'quoted text' ${HOME} "$1" sed && $(pwd) ${HOME} test
+		done /usr/bin $(pwd) && ${HOME} sed cd && --verbose done then 'quoted text' 2>/dev/null
+	-eu && test --verbose $(pwd) && echo awk "$1" test "$1" readonly echo then && local
+	printf 'quoted text' 2>/dev/null
+	done readonly cd export /usr/bin 'quoted text'
+		--verbose /usr/bin printf "$1" test --verbose "$1" --verbose
+${HOME} | /usr/bin $(pwd) then $(pwd) cd readonly "$@" "$@" x=1 x=1
+'quoted text' && 2>/dev/null echo cd $(pwd) readonly
+		${HOME} -eu local ${HOME} test --verbose 'quoted text' ${HOME}
+	-eu && export "$@" then | 'quoted text' grep && -eu awk x=1 $(pwd) echo
+	done --verbose -eu --verbose export x=1 test && $(pwd)
+x=1 x=1 export echo && export "$1" readonly export 'quoted text' export then test
+	cd done | 'quoted text' test done grep ${HOME} x=1
+		readonly 'quoted text' awk
+	sed "$@" done cd local echo printf 2>/dev/null echo
+		/usr/bin printf done local done "$1" echo /usr/bin cd $(pwd) awk
+then --verbose grep awk 'quoted text' sed -eu --verbose ${HOME}
+	done ${HOME} -eu local x=1
+		local grep test ${HOME} cd printf
+	'quoted text' then export grep | test ${HOME} -eu
+2>/dev/null x=1 $(pwd) --verbose /usr/bin
+	cd $(pwd) /usr/bin awk /usr/bin x=1 grep printf sed $(pwd)
+		test readonly printf $(pwd) echo "$@"
+		awk awk /usr/bin && --verbose done -eu export "$@" --verbose | echo | awk
+local ${HOME} done --verbose && --verbose grep --verbose --verbose readonly
+		${HOME} echo export $(pwd)
+		readonly "$@" --verbose then then
+		-eu -eu --verbose local printf grep echo && cd grep ${HOME} ${HOME} awk printf
+	readonly then 'quoted text'
+"$1" | done cd -eu -eu grep -eu "$@" && sed printf "$@" && "$1"
+	$(pwd) readonly "$1" local export 'quoted text'
+	printf test | grep test
+		export | | "$@" then ${HOME} done printf $(pwd) sed
+	/usr/bin /usr/bin local x=1 awk readonly
+printf awk sed awk test grep 'quoted text' printf
+	--verbose x=1 x=1 test printf local readonly x=1 sed sed
+	${HOME} test ${HOME} echo 2>/dev/null
+		echo export --verbose cd test done printf test | sed $(pwd) then /usr/bin
+awk sed printf "$@" && cd printf $(pwd)
+		"$1" sed printf 'quoted text' then test echo local
+		$(pwd) export awk x=1 /usr/bin then awk x=1 sed 'quoted text' local
+		x=1 $(pwd) done done local then grep /usr/bin 'quoted text' x=1
+cd test /usr/bin then 2>/dev/null | /usr/bin test /usr/bin ${HOME} cd /usr/bin
+--verbose sed grep $(pwd)
+-eu "$1" 'quoted text' echo | test then readonly readonly
+		export export /usr/bin
+		awk --verbose export awk done "$1" then printf | export
+	done x=1 -eu grep test | 2>/dev/null "$1" echo cd awk
+	export | then done local
+sed --verbose -eu test | done
+		2>/dev/null cd echo 2>/dev/null done -eu -eu -eu ${HOME} sed awk && "$@" --verbose
+printf --verbose test -eu printf test --verbose sed then printf
+		-eu grep $(pwd) --verbose then ${HOME}
+/usr/bin | /usr/bin export echo $(pwd) /usr/bin "$1" printf printf /usr/bin cd
+		sed printf test && readonly -eu local ${HOME} 'quoted text' grep "$1"
+$(pwd) "$1" done then printf $(pwd) printf printf then $(pwd) 2>/dev/null --verbose
+	$(pwd) done "$@" x=1 "$1" $(pwd) $(pwd)
+local $(pwd) ${HOME} grep ${HOME} x=1 grep readonly /usr/bin
+sed printf x=1 export $(pwd) "$@" 2>/dev/null
+		$(pwd) -eu /usr/bin echo 'quoted text'
+	-eu grep local /usr/bin awk local
+	printf printf echo x=1 x=1 done awk done echo sed && local readonly
+		/usr/bin cd export cd done readonly grep /usr/bin "$@" test
+		done printf printf | then $(pwd)
+		export then ${HOME} done "$@" && test cd | ${HOME} "$@"
+		grep "$1" --verbose local echo | 'quoted text' $(pwd) "$1" 2>/dev/null
+"$@" done local x=1 echo
+grep local done echo | grep export
+readonly readonly "$1" readonly 2>/dev/null readonly
+		&& && $(pwd) -eu local "$1" local echo then /usr/bin
+	done && export 'quoted text' local | 2>/dev/null test local test $(pwd) echo
+	x=1 -eu $(pwd) "$1" printf | | /usr/bin | -eu sed x=1 2>/dev/null
+$(pwd) cd | --verbose echo "$@" export 'quoted text' $(pwd) export then
+		x=1 test sed local then cd sed
+	sed sed ${HOME} test done sed done done 2>/dev/null
+		$(pwd) grep then cd sed echo | echo echo echo grep 'quoted text' /usr/bin cd local
+	--verbose 2>/dev/null $(pwd)
+	x=1 sed 'quoted text' -eu 'quoted text' "$@" $(pwd) export echo "$1"
+	$(pwd) --verbose local 'quoted text' && "$1" $(pwd)
+		awk --verbose done 'quoted text' done export
+	| done done "$@" sed ${HOME} &&
+	| cd local -eu && ${HOME} echo
+		awk done awk x=1 'quoted text' x=1 sed echo grep done | | -eu readonly
+	x=1 2>/dev/null --verbose readonly local echo local test grep
+"$@" export "$@" echo | 2>/dev/null --verbose
+&& && awk done readonly printf local cd export -eu test awk /usr/bin
+	-eu | 2>/dev/null x=1 --verbose done |
+	then printf printf awk awk grep readonly sed
+-eu $(pwd) x=1 awk printf && test /usr/bin awk then --verbose
+		then $(pwd) export 'quoted text' ${HOME} 2>/dev/null grep cd | && ${HOME}
+done "$@" x=1 awk awk readonly printf echo cd "$@" then
+		| sed readonly awk sed done | --verbose
+cd 'quoted text' "$@" grep readonly cd ${HOME} export 2>/dev/null $(pwd)
+		--verbose test then x=1 2>/dev/null 2>/dev/null done --verbose
+| cd sed local "$1" /usr/bin --verbose printf 'quoted text' ${HOME} && then
+echo $(pwd) local done sed ${HOME} -eu export "$1" $(pwd) done readonly echo "$@"
+grep then ${HOME} x=1 done -eu --verbose 'quoted text' /usr/bin
+printf ${HOME} x=1 && test "$@" local
+		${HOME} printf /usr/bin echo | --verbose --verbose test /usr/bin
+local | grep "$@" test cd && && "$1" ${HOME} ${HOME} sed grep 'quoted text'
+done sed readonly 2>/dev/null export printf /usr/bin
+	grep export "$@" ${HOME}
+	then "$@" sed /usr/bin awk export local awk
+then export --verbose export "$1" export
+		readonly ${HOME} export done --verbose /usr/bin
+		export export echo /usr/bin readonly /usr/bin printf | "$@"
+then /usr/bin sed test 2>/dev/null --verbose /usr/bin x=1
+	done /usr/bin x=1 done /usr/bin 'quoted text' && --verbose awk echo ${HOME} /usr/bin
+		$(pwd) --verbose sed readonly grep awk awk | -eu grep "$@" "$1" cd
+	grep readonly awk readonly -eu test echo local sed | 'quoted text' ${HOME}
+then printf --verbose readonly --verbose
+	$(pwd) -eu -eu ${HOME} -eu && echo cd done x=1 "$@" x=1 awk
+grep local test done
+	awk then echo && ${HOME} "$@"
+printf 2>/dev/null cd readonly export test /usr/bin 2>/dev/null 'quoted text'
+&& $(pwd) "$1" local "$1" /usr/bin
+		| x=1 $(pwd) awk cd grep printf printf x=1 done
+	x=1 -eu x=1 local 2>/dev/null $(pwd) | local | ${HOME}
+test ${HOME} --verbose ${HOME} done $(pwd) 2>/dev/null
+		--verbose x=1 done /usr/bin 'quoted text' 'quoted text' export $(pwd) local 2>/dev/null
+		-eu echo printf test cd grep && x=1 "$1" --verbose "$@"
+	grep then | && readonly --verbose readonly x=1 done done
+done printf grep printf awk | 'quoted text'
+	local awk x=1 "$1" cd export done "$1"
+awk x=1 'quoted text' ${HOME} local
+		$(pwd) then "$1" test done sed -eu readonly $(pwd) $(pwd) 2>/dev/null $(pwd)
+readonly $(pwd) 'quoted text' | && --verbose
+	awk then awk grep sed sed -eu --verbose
+2>/dev/null x=1 x=1 grep ${HOME} sed printf readonly done "$1"
+readonly | cd echo grep echo x=1 && grep --verbose "$1" --verbose
+		readonly export done echo local "$1" then ${HOME}
+		| "$1" awk 'quoted text' 2>/dev/null $(pwd)
+		2>/dev/null -eu cd && sed grep done x=1
+		${HOME} "$1" -eu done | grep then then -eu
+		then printf ${HOME} 2>/dev/null 'quoted text' sed 2>/dev/null export export ${HOME}
+	/usr/bin awk awk "$1" $(pwd) /usr/bin 2>/dev/null cd export cd 'quoted text' ${HOME}
+then test local export 'quoted text'
+printf ${HOME} "$@" 2>/dev/null export awk printf
+		readonly printf x=1 local export done 'quoted text'
+	sed -eu $(pwd) | readonly local && /usr/bin export awk awk "$@"
+x=1 $(pwd) "$@" cd 'quoted text' && $(pwd) 'quoted text'
+		-eu --verbose ${HOME} x=1 printf then /usr/bin /usr/bin "$1" echo
+		$(pwd) --verbose && export printf ${HOME}
+	| && 2>/dev/null printf "$@" /usr/bin awk readonly "$@" readonly then test
+		sed && done test 2>/dev/null export $(pwd) "$1" awk && --verbose awk done /usr/bin
+		$(pwd) done ${HOME} 'quoted text'
+"$1" printf echo "$1"
+export && | $(pwd) printf "$@"
+done export 'quoted text' x=1
+	--verbose awk -eu readonly readonly /usr/bin 'quoted text'
+	| then printf sed readonly x=1 local export sed 2>/dev/null | awk | |
+		&& done test "$1" export --verbose printf then x=1 | ${HOME} "$1"
+echo done "$1" grep export -eu readonly then x=1 then /usr/bin awk
+/usr/bin ${HOME} sed
+then $(pwd) -eu sed cd -eu test test ${HOME} 'quoted text'
+readonly -eu done cd 2>/dev/null
+		echo export awk grep cd cd ${HOME} test 2>/dev/null "$1" x=1 /usr/bin
+		test done echo awk && printf then sed readonly printf
+		sed --verbose --verbose x=1
+	"$1" awk "$@" awk printf -eu grep --verbose cd ${HOME} /usr/bin local -eu /usr/bin
+	then $(pwd) cd 2>/dev/null /usr/bin
+cd "$@" -eu grep "$@" 'quoted text'
+--verbose && /usr/bin then /usr/bin
+	test printf ${HOME} sed export echo echo grep grep /usr/bin x=1 2>/dev/null
+	echo ${HOME} ${HOME} grep "$@" readonly --verbose && -eu test then
+		$(pwd) test -eu && cd $(pwd) && awk readonly local "$1" sed echo
+		-eu | "$@" export test echo then local export then export && --verbose x=1 "$1"
+"$1" && ${HOME} /usr/bin
+		2>/dev/null local test done $(pwd) grep 2>/dev/null --verbose
+	"$@" 2>/dev/null x=1 "$1" sed test "$@" "$@" echo -eu
+	2>/dev/null $(pwd) test | printf grep then
+	grep ${HOME} ${HOME}
+		test 2>/dev/null then test x=1 done echo grep cd "$1" 2>/dev/null
+		/usr/bin printf x=1 x=1 $(pwd) awk export grep 'quoted text'
+		&& | x=1 && sed 2>/dev/null local export && done printf x=1 2>/dev/null
+	/usr/bin local --verbose
+| awk sed done "$@" test then echo
+	"$1" readonly | /usr/bin 2>/dev/null -eu then readonly && "$1" x=1 export then $(pwd)
+		done readonly 'quoted text' grep then export -eu readonly then --verbose
+	sed printf done done readonly printf 2>/dev/null
+		grep then ${HOME} x=1 x=1 x=1 /usr/bin --verbose &&
+		done 'quoted text' awk ${HOME} "$@" sed "$@" printf 2>/dev/null -eu grep
+'quoted text' then | grep then test -eu cd 2>/dev/null awk local grep 'quoted text'
+grep -eu grep ${HOME} cd printf
+echo | sed /usr/bin cd /usr/bin grep 2>/dev/null
+		cd "$@" -eu then sed "$@" ${HOME} --verbose --verbose
+		then -eu ${HOME} "$1" readonly readonly --verbose
+	awk readonly grep 2>/dev/null
+		grep grep awk "$@" echo 2>/dev/null 'quoted text' /usr/bin test 'quoted text'
+	sed $(pwd) 'quoted text' grep 2>/dev/null "$1" x=1 2>/dev/null && readonly
+		'quoted text' && test local test 2>/dev/null /usr/bin
+	export done printf $(pwd) && 2>/dev/null && export export && | then 'quoted text'
+"$@" cd && --verbose local 2>/dev/null
+	then echo test $(pwd) "$@" && echo readonly && then &&
+		grep printf ${HOME} /usr/bin "$1" --verbose
+		printf sed $(pwd) x=1
+	then $(pwd) | 'quoted text' -eu export
+echo /usr/bin test /usr/bin awk -eu export x=1
+	-eu $(pwd) -eu grep then
+		x=1 awk export awk | awk --verbose readonly /usr/bin then sed readonly echo
+		sed done printf "$@" sed export
+echo 2>/dev/null --verbose test printf 2>/dev/null readonly readonly /usr/bin
+done ${HOME} /usr/bin test "$@" | test sed
+	local 2>/dev/null test x=1 && 2>/dev/null && && "$1"
+	test done $(pwd) && readonly readonly
+then --verbose | grep "$1" /usr/bin test readonly
+	${HOME} export export 'quoted text' && | --verbose printf
+/usr/bin grep x=1 export grep local | awk
+		readonly test x=1 grep /usr/bin
+$(pwd) sed printf printf readonly printf -eu $(pwd) $(pwd) "$1"
+${HOME} $(pwd) 'quoted text' awk && readonly
+"$@" $(pwd) && "$@" then 2>/dev/null
+		export $(pwd) --verbose readonly 'quoted text' then printf $(pwd)
+		-eu cd then /usr/bin export x=1 "$1" "$@" grep $(pwd) /usr/bin echo export $(pwd)
+		&& export test then ${HOME} grep -eu cd readonly 'quoted text' -eu
+		/usr/bin 'quoted text' -eu "$@" x=1 test | /usr/bin test && cd
+		local ${HOME} --verbose readonly | 'quoted text' && --verbose --verbose
+		'quoted text' 'quoted text' cd x=1 "$@" -eu /usr/bin
+		readonly x=1 grep sed export && /usr/bin then
+		"$1" "$@" printf printf sed "$1" awk printf then | ${HOME} local ${HOME}
+--verbose | test 'quoted text' readonly sed awk "$1" sed
+		| local local done test sed grep
+	grep | x=1 -eu --verbose 'quoted text' local sed x=1 && /usr/bin "$1" local
+		printf sed printf 'quoted text' readonly "$@" 2>/dev/null ${HOME} echo
+	then then "$@" | export awk printf grep $(pwd) ${HOME}
+x=1 ${HOME} /usr/bin $(pwd) sed
+| printf && grep "$1" "$@" -eu 'quoted text' 'quoted text' $(pwd)
+export then x=1 awk | 2>/dev/null "$1" readonly $(pwd)
+/usr/bin sed $(pwd) 2>/dev/null
+export sed ${HOME} local test $(pwd) done $(pwd) cd export printf test sed
+		sed readonly grep echo x=1 /usr/bin /usr/bin echo 'quoted text'
+	printf test printf awk cd local
+local awk $(pwd) /usr/bin | "$1" test && ${HOME} --verbose "$@" cd /usr/bin
+| /usr/bin | -eu /usr/bin done echo grep /usr/bin ${HOME} grep -eu | 'quoted text'
+--verbose grep test echo --verbose ${HOME}
+	2>/dev/null done "$@" /usr/bin sed -eu && awk /usr/bin awk awk "$@" echo done
+| -eu readonly local done readonly grep &&
+/usr/bin "$1" -eu --verbose then
+/usr/bin cd /usr/bin "$@" cd sed local /usr/bin x=1 ${HOME} echo
+"$@" -eu grep printf printf "$1" printf 'quoted text' done | 2>/dev/null
+		x=1 --verbose $(pwd) local test printf
+		done cd "$1" printf "$@" "$@" local "$@" && "$@"
+	&& done /usr/bin done export
+test 2>/dev/null test 2>/dev/null readonly readonly x=1
+x=1 printf local && test x=1 printf "$@"
+${HOME} -eu "$1" grep sed -eu grep grep "$1" cd awk 'quoted text' cd | readonly
+	| /usr/bin x=1 then /usr/bin
+	-eu $(pwd) sed && /usr/bin readonly
+		then /usr/bin "$1" /usr/bin 'quoted text' -eu /usr/bin
+echo -eu test readonly | ${HOME} then ${HOME} grep local "$1" -eu awk
+	-eu echo printf --verbose 'quoted text'
+		'quoted text' grep grep "$1" export /usr/bin ${HOME} export cd
+		cd grep -eu export | --verbose 2>/dev/null -eu "$1" sed sed x=1
+		export -eu cd ${HOME} -eu test
+	"$@" "$@" $(pwd) && ${HOME} echo test export done grep $(pwd) echo ${HOME}
+-eu 'quoted text' export && sed -eu local --verbose --verbose && test 2>/dev/null
+		readonly | x=1 ${HOME} local --verbose "$@" readonly |
+$(pwd) 'quoted text' /usr/bin ${HOME}
+"$1" export then ${HOME} grep
+		/usr/bin test cd cd | then then cd readonly --verbose --verbose
+	awk sed echo ${HOME} ${HOME}
+$(pwd) | $(pwd) "$1" awk local | grep done x=1 x=1 x=1 x=1 done grep grep "$@"
+	awk "$@" export local local
+		awk printf awk test "$1" awk x=1 x=1 cd readonly /usr/bin sed printf
+	"$1" test | 'quoted text'
+local done readonly x=1 done 'quoted text'
+		local $(pwd) 2>/dev/null
+	done -eu echo then -eu test
+done readonly export grep grep x=1 /usr/bin
+		echo 'quoted text' 2>/dev/null sed sed | "$1" cd sed && export
+		x=1 export | $(pwd) sed grep sed then 2>/dev/null
+	test x=1 'quoted text' echo | x=1 cd echo grep -eu export 2>/dev/null --verbose
+		awk done awk | | -eu test sed
+		awk 'quoted text' sed "$1" "$@" --verbose awk --verbose
+| 2>/dev/null readonly x=1 'quoted text' done done test
+		local /usr/bin printf echo
+x=1 awk echo local --verbose $(pwd) sed cd printf echo ${HOME}
+		grep 'quoted text' printf then awk then --verbose -eu
+		| test $(pwd) then printf
+		${HOME} -eu && sed printf printf -eu then then x=1 awk export cd test
+	local && printf test grep --verbose -eu 2>/dev/null x=1
+		then /usr/bin export export 2>/dev/null "$1" --verbose cd "$@" readonly $(pwd)
+		${HOME} sed $(pwd) echo 'quoted text' sed awk 2>/dev/null /usr/bin $(pwd)
+"$1" printf local done readonly --verbose done 2>/dev/null sed 2>/dev/null
+		$(pwd) x=1 cd readonly export ${HOME} local x=1 grep then readonly done printf
+	cd printf then 2>/dev/null ${HOME} /usr/bin | 2>/dev/null
+		x=1 done readonly sed grep sed "$@" echo --verbose && sed done "$@"
+	"$@" then grep "$1" cd done grep && -eu --verbose grep
+"$@" | -eu awk ${HOME} done sed awk -eu && printf
+	'quoted text' --verbose then export
+		&& sed x=1 printf export && echo -eu
+	printf && -eu | /usr/bin cd | done ${HOME} x=1
+	test 'quoted text' test 2>/dev/null ${HOME} -eu /usr/bin x=1 readonly
+	--verbose 'quoted text' awk "$@" cd grep cd 2>/dev/null test |
+sed grep export 'quoted text' "$1" then -eu readonly printf ${HOME} awk
+	x=1 "$1" -eu $(pwd) export echo "$@" printf done "$@" "$@" awk sed --verbose
+	--verbose /usr/bin printf then awk echo -eu "$@" awk /usr/bin test -eu sed then
+		/usr/bin /usr/bin "$1"
+	local echo 'quoted text' /usr/bin readonly x=1 /usr/bin
+		echo then ${HOME} "$@" /usr/bin /usr/bin awk
+	printf export x=1 done $(pwd) readonly "$1" readonly
+	echo readonly /usr/bin && export
+		--verbose readonly x=1 echo
+awk -eu -eu test 'quoted text' /usr/bin readonly /usr/bin && ${HOME} 'quoted text'
+		cd && echo export 2>/dev/null done export
+		"$@" awk awk done | "$@" local
+${HOME} export grep local awk --verbose cd printf then local && local 2>/dev/null
+2>/dev/null printf --verbose $(pwd) 2>/dev/null && then awk done | cd
+		2>/dev/null cd done "$@" then printf cd test "$@" $(pwd) echo
+sed "$1" cd $(pwd) printf --verbose printf 2>/dev/null then &&
+		test 'quoted text' grep | -eu --verbose "$1" then
+test "$@" sed -eu export test done x=1 --verbose then echo "$@" && done 'quoted text'
+then "$@" grep "$1" "$1" $(pwd) x=1 'quoted text' "$@" test | 'quoted text'
+		awk local cd 'quoted text'
+x=1 export 2>/dev/null --verbose x=1 && x=1
+		-eu export "$1" then awk | printf cd $(pwd) then 2>/dev/null
+	local export -eu grep --verbose sed 2>/dev/null awk /usr/bin
+		'quoted text' --verbose done "$1" test
+		&& "$1" readonly "$1" ${HOME} 2>/dev/null --verbose
+sed | ${HOME} x=1 $(pwd) export $(pwd) /usr/bin grep printf 2>/dev/null readonly
+	-eu cd sed $(pwd) x=1 -eu export readonly && ${HOME}
+		done sed cd 'quoted text' test -eu test local $(pwd) export ${HOME}
+export /usr/bin echo "$@"
+		done local | grep | readonly cd
+		/usr/bin 'quoted text' echo readonly -eu then "$@" echo | 2>/dev/null -eu $(pwd)
+/usr/bin "$1" $(pwd) echo local x=1 2>/dev/null x=1 cd x=1 cd 2>/dev/null
+&& echo echo /usr/bin 2>/dev/null
+	grep export && awk | x=1 sed export export local -eu printf
+"$@" export printf test grep done printf export echo /usr/bin -eu -eu readonly
+		&& -eu export grep awk awk done done readonly local export "$1" "$@" "$1"
+-eu "$1" 2>/dev/null done "$@" local export awk sed cd 2>/dev/null $(pwd) then
+		$(pwd) sed x=1 -eu done --verbose echo x=1 ${HOME} export grep
+x=1 "$1" grep -eu local echo "$1" sed test -eu ${HOME}
+		then && sed "$@" cd && --verbose | then grep test /usr/bin
+		/usr/bin 'quoted text' $(pwd) then 2>/dev/null "$1"
+	'quoted text' awk && 'quoted text' 'quoted text' grep --verbose /usr/bin done printf
+		'quoted text' && | cd readonly export
+	x=1 x=1 test "$@" test grep export grep "$1" 'quoted text' "$@"
+		'quoted text' then "$@" echo 'quoted text' x=1 cd
+${HOME} printf /usr/bin -eu /usr/bin x=1 "$@" -eu
+		| cd -eu $(pwd) 2>/dev/null printf
+		'quoted text' "$@" printf 'quoted text' export export 'quoted text' --verbose test
+	cd printf printf -eu --verbose
+awk test grep readonly local x=1 x=1 done /usr/bin --verbose sed /usr/bin
+		${HOME} grep readonly $(pwd) $(pwd) export
+	/usr/bin done "$@" done sed grep -eu echo /usr/bin
+	| | printf then sed | export done then -eu
+local local done --verbose -eu "$1" echo 'quoted text'
+		echo ${HOME} "$@" export | 'quoted text' local 'quoted text' printf
+cd "$@" export "$@" awk $(pwd)
+		--verbose --verbose | grep done 'quoted text' | $(pwd) local x=1 awk 'quoted text'
+export grep printf cd "$@" done local readonly ${HOME}
+	echo sed then sed cd then awk 2>/dev/null then
+	--verbose awk done readonly sed $(pwd) readonly
+export grep sed done | local local
+readonly export ${HOME} sed ${HOME} grep printf readonly grep test /usr/bin
+export echo /usr/bin /usr/bin $(pwd) ${HOME} grep /usr/bin "$@"
+	| -eu local then export then grep printf then
+	-eu "$1" local readonly done "$1" then sed
+		then readonly -eu | test && "$@" --verbose export
+x=1 ${HOME} | local | "$@" export test x=1 echo -eu local -eu --verbose export
+		'quoted text' x=1 export then printf test x=1 "$1" -eu /usr/bin ${HOME} 2>/dev/null
+	--verbose echo x=1 grep printf
+done export | /usr/bin then done export /usr/bin ${HOME} --verbose
+	"$@" grep cd printf -eu awk printf
+	/usr/bin "$@" export x=1
+	sed test | cd $(pwd) 2>/dev/null readonly && ${HOME}
+		sed && /usr/bin /usr/bin local
+-eu then -eu -eu awk x=1 done export echo
+awk grep "$1" $(pwd) ${HOME} "$1" sed
+$(pwd) export 2>/dev/null sed cd then export && echo 'quoted text'
+printf grep readonly grep ${HOME} $(pwd) printf && 'quoted text'
+export local test && test
+		x=1 test export /usr/bin sed export -eu sed ${HOME} done sed awk |
+x=1 "$1" local readonly export "$@" readonly "$@" then done
+	"$@" test x=1 grep sed awk local printf export echo
+	echo then then | | --verbose | -eu && x=1 sed printf 2>/dev/null
+	local echo then -eu cd awk readonly | "$1" ${HOME}
+		sed -eu echo ${HOME} --verbose ${HOME} grep
+		&& readonly local printf --verbose
+"$@" printf "$@" /usr/bin test sed /usr/bin
+	awk "$@" && test export grep --verbose -eu $(pwd) grep local test echo done
+		awk local test "$1" cd local --verbose then cd done && ${HOME}
+done test echo then --verbose /usr/bin "$1" x=1 && "$1" sed export
+export awk "$1" | -eu x=1 done /usr/bin x=1 --verbose
+-eu export && printf | then
+	x=1 export "$1" && --verbose "$@" --verbose
+	local "$@" echo grep "$@" --verbose test "$1" "$1" "$@"
+echo then --verbose grep x=1 && "$@" grep grep /usr/bin /usr/bin echo ${HOME}
+		cd "$@" cd 2>/dev/null $(pwd) then 2>/dev/null
+	2>/dev/null | ${HOME} then $(pwd)
+		-eu x=1 printf --verbose ${HOME} printf
+	test $(pwd) | sed printf && -eu -eu 'quoted text'
+		sed awk printf /usr/bin awk 'quoted text' "$@" | awk
+		"$1" grep done $(pwd) && /usr/bin
+		done printf grep echo printf local -eu $(pwd)
+	sed printf -eu $(pwd) then export
+	local x=1 $(pwd) && x=1 ${HOME} 'quoted text' 2>/dev/null "$1"
+${HOME} export readonly 2>/dev/null export | -eu awk 'quoted text'
+${HOME} "$1" --verbose cd ${HOME} sed -eu grep 2>/dev/null "$1" sed
+		| | x=1 | | echo | --verbose && /usr/bin test test
+	echo --verbose cd "$@"
+grep ${HOME} 'quoted text' "$@" done /usr/bin echo && -eu | done echo 'quoted text'
+	test cd 'quoted text' awk -eu then
+		done --verbose /usr/bin sed export cd x=1 ${HOME}
+awk && /usr/bin $(pwd) && sed done --verbose
+sed "$1" export sed test echo -eu grep ${HOME} grep
+	done && sed cd "$1" | ${HOME} grep test readonly
+sed grep -eu export readonly printf "$1" echo -eu awk then local
+		&& grep 'quoted text' /usr/bin
+echo && then | && readonly printf printf grep ${HOME} -eu "$@" printf sed
+	"$1" 2>/dev/null 'quoted text' readonly
+	$(pwd) awk local sed cd -eu test 'quoted text'
+	$(pwd) -eu 2>/dev/null $(pwd) |
+	'quoted text' -eu "$1" "$@" x=1 local then $(pwd) ${HOME} then x=1 readonly "$@"
+		/usr/bin "$1" readonly -eu printf 'quoted text'
+	/usr/bin x=1 2>/dev/null test printf
+grep then ${HOME} echo 'quoted text' x=1
+		export && "$@" x=1 --verbose "$@" awk echo cd readonly
+printf $(pwd) | /usr/bin 2>/dev/null --verbose 'quoted text'
+	cd ${HOME} echo | -eu /usr/bin test 'quoted text' export "$@"
+	sed "$@" --verbose export | x=1 | grep done && echo then
+		grep "$1" --verbose awk local sed 'quoted text'
+	x=1 $(pwd) | then && x=1 readonly echo
+"$@" readonly x=1 readonly && awk printf cd && $(pwd)
+		export printf printf readonly awk 2>/dev/null
+	done grep echo awk awk x=1
+	test grep readonly | --verbose then export ${HOME} test 'quoted text' 2>/dev/null
+		/usr/bin "$1" done readonly -eu ${HOME} readonly local
+${HOME} printf awk /usr/bin grep sed test done | done awk local
+	local grep test 2>/dev/null grep --verbose
+		2>/dev/null | then awk grep then printf
+		echo /usr/bin then "$1" printf sed done | ${HOME} done -eu
+	done readonly readonly --verbose
+		"$1" test "$@" awk test 'quoted text' test -eu "$1" "$1"
+	--verbose "$1" then awk printf printf $(pwd) -eu /usr/bin
+${HOME} ${HOME} local printf awk printf && --verbose 2>/dev/null awk --verbose
+echo grep then 2>/dev/null "$1" 2>/dev/null
+	"$@" export sed readonly /usr/bin --verbose /usr/bin
+		then x=1 then ${HOME} awk && echo "$1" ${HOME} /usr/bin 2>/dev/null
+readonly 'quoted text'
+		sed awk local && export 2>/dev/null "$1"
+	then "$@" "$1" --verbose
+		test awk readonly 2>/dev/null
+'quoted text' then x=1 cd ${HOME} export | 'quoted text' | /usr/bin ${HOME}
+	cd printf --verbose then x=1 2>/dev/null
+	"$1" $(pwd) -eu "$1" grep -eu printf local test $(pwd) local
+awk export --verbose ${HOME} -eu sed test printf awk done sed /usr/bin sed
+	&& printf "$@" then ${HOME}
+"$@" cd ${HOME} $(pwd) 2>/dev/null printf export readonly local done
+2>/dev/null local $(pwd) cd ${HOME}
+&& sed ${HOME} | awk test ${HOME} awk then local "$@" && done
+then | 'quoted text' cd 'quoted text' 'quoted text' echo sed &&
+grep -eu && grep readonly cd then
+		sed 2>/dev/null sed "$1" 'quoted text' awk cd done local then $(pwd)
+x=1 --verbose x=1 && sed --verbose -eu grep $(pwd) test 2>/dev/null | 'quoted text'
+	"$1" "$@" 2>/dev/null $(pwd) sed 'quoted text' x=1 awk echo --verbose
+		local ${HOME} -eu grep test -eu /usr/bin
+		sed /usr/bin export /usr/bin "$@" --verbose "$@" local test test sed
+	awk "$@" then $(pwd) $(pwd) sed -eu
+	&& done printf && 2>/dev/null $(pwd) local
+&& && | 'quoted text'
+	--verbose ${HOME} then
+		then ${HOME} --verbose readonly "$1" export --verbose echo $(pwd) echo
+	x=1 x=1 printf echo "$@" 2>/dev/null local grep $(pwd) local cd local done
+#include c54.sh
+	| -eu local --verbose /usr/bin | awk | && "$@" grep "$1"
+export /usr/bin | /usr/bin awk ${HOME} cd cd 2>/dev/null
+		-eu printf sed cd -eu readonly then printf echo then 2>/dev/null
+&& done $(pwd) $(pwd) done x=1 --verbose && -eu grep awk grep "$@" 2>/dev/null
+		printf test grep echo done $(pwd) ${HOME} readonly | 2>/dev/null
+	then echo local grep 2>/dev/null | echo awk $(pwd) $(pwd) printf "$1" awk
+"$1" sed /usr/bin "$1" then -eu readonly done readonly readonly
+	test printf then 'quoted text' cd 'quoted text' cd && x=1 sed | readonly
+cd grep 2>/dev/null "$@" cd awk awk printf then test readonly test
+		$(pwd) sed 2>/dev/null sed printf echo 'quoted text'
+	2>/dev/null ${HOME} 2>/dev/null readonly
+	printf awk -eu /usr/bin local cd awk | --verbose test grep
+		| --verbose /usr/bin --verbose
+		local sed printf test sed readonly
+printf 2>/dev/null x=1 -eu | test echo done echo awk export 'quoted text' $(pwd)
+	-eu printf grep sed | "$1" then export 2>/dev/null $(pwd) -eu x=1 readonly
+	--verbose grep $(pwd) done test "$1"
+"$1" export --verbose awk $(pwd) printf then readonly sed -eu --verbose $(pwd)
+x=1 "$@" then $(pwd) "$1" | cd test 'quoted text' /usr/bin
+$(pwd) grep && grep 'quoted text' "$@" grep && echo test | local &&
+	| printf "$@" "$@" echo
+		echo readonly x=1 'quoted text' awk -eu
+	grep done && --verbose local 'quoted text' cd 2>/dev/null $(pwd)
+		grep "$@" ${HOME} export -eu readonly local export
+		&& printf echo 'quoted text' /usr/bin done local grep x=1 --verbose 2>/dev/null
+then ${HOME} x=1 grep /usr/bin ${HOME} $(pwd) 2>/dev/null /usr/bin
+	done "$@" sed "$@" printf cd done 'quoted text'
+		"$1" test awk readonly readonly echo printf
+local echo test grep 2>/dev/null cd then x=1 ${HOME} "$1" "$@" ${HOME} then
+	printf && && export x=1 -eu
+		test 'quoted text' then
+	done then printf $(pwd) /usr/bin done test ${HOME} "$1" cd
+then echo export local grep printf done readonly "$@" 'quoted text' grep
+	"$@" printf "$@" x=1 | export sed ${HOME} grep grep readonly -eu "$@"
+		/usr/bin && grep --verbose then export printf --verbose
+	sed "$1" x=1 ${HOME} echo /usr/bin
+	grep echo -eu 'quoted text' test grep 'quoted text' && echo cd echo --verbose
+		"$@" cd sed sed 'quoted text' test 'quoted text' cd echo then /usr/bin |
+		test cd grep $(pwd) readonly $(pwd) printf echo awk export && printf readonly
+		'quoted text' printf 'quoted text' then readonly 2>/dev/null x=1 2>/dev/null
+--verbose "$1" export printf readonly cd --verbose local grep &&
+		--verbose grep | --verbose ${HOME} $(pwd)
+	printf done 2>/dev/null | 'quoted text' --verbose cd && cd local 2>/dev/null printf
+		--verbose -eu /usr/bin export readonly
+		'quoted text' --verbose &&
+	x=1 -eu ${HOME} grep local
+	printf 2>/dev/null printf local printf $(pwd) | done readonly
+	x=1 sed 2>/dev/null readonly then then awk $(pwd) "$1" awk export then
+	then "$1" x=1 readonly -eu $(pwd) "$1" "$1" --verbose export printf x=1
+	"$@" "$@" export grep -eu test ${HOME} printf "$1" echo cd x=1 "$1"
+awk /usr/bin done done --verbose $(pwd) cd --verbose x=1 readonly
+		then grep /usr/bin local x=1 ${HOME} local "$@" echo 'quoted text' then
+		"$@" "$@" ${HOME} $(pwd) test x=1 "$1" sed --verbose --verbose
+echo cd then ${HOME} local grep "$1"
+test -eu x=1 'quoted text' "$@" grep 2>/dev/null
+		--verbose cd cd test | /usr/bin then | done x=1 cd done && echo printf --verbose
+	"$@" local export && x=1 printf 'quoted text' x=1 test echo | then
+cd "$1" "$1" && test export 'quoted text'
+grep && then readonly 'quoted text' "$@" echo ${HOME}
+	echo sed | 2>/dev/null readonly test echo ${HOME} grep sed "$1" awk
+x=1 x=1 sed then done grep awk "$@" awk "$@" "$@"
+	2>/dev/null export done /usr/bin "$@" test printf
+		sed ${HOME} $(pwd) $(pwd)
+		sed done export grep done
+then cd "$1" readonly then | done --verbose
+	"$1" local 'quoted text' | readonly test
+awk local cd x=1 x=1 ${HOME} echo $(pwd) -eu && ${HOME}
+	then done && 'quoted text' "$1" grep "$@" &&
+"$1" grep sed sed test /usr/bin
+sed awk local sed grep /usr/bin
+local awk 2>/dev/null | |
+	/usr/bin then then x=1 /usr/bin --verbose
+	2>/dev/null ${HOME} done --verbose && x=1 x=1 local |
+| printf cd /usr/bin local x=1 -eu "$1" done done "$1" ${HOME} 'quoted text'
+readonly --verbose 'quoted text' | 2>/dev/null
+	sed && "$@" printf "$1" $(pwd) sed done
+-eu readonly $(pwd) readonly 2>/dev/null local | test ${HOME} test grep echo done
+		local local done 2>/dev/null 'quoted text' then && echo -eu
+then echo "$@" --verbose
+		/usr/bin export 2>/dev/null cd grep 'quoted text' "$1" ${HOME} "$@" 'quoted text'
+		then x=1 grep ${HOME} $(pwd) ${HOME} printf then | ${HOME} done export
+		awk local done printf cd 2>/dev/null
+	sed echo | 2>/dev/null awk && -eu 2>/dev/null "$@" awk
+	&& | grep printf $(pwd) cd sed awk ${HOME} | -eu then then &&
+		readonly grep && export export test && "$@" then x=1 test 2>/dev/null
+sed awk "$1" 2>/dev/null "$1" "$1" --verbose | printf done then sed "$1" readonly
+	then ${HOME} test printf local "$@" "$@"
+	echo -eu x=1 local done sed && export $(pwd)
+		"$@" grep sed local 'quoted text'
+"$@" readonly 2>/dev/null echo sed -eu then | 'quoted text' 'quoted text'
+sed export test done &&
+"$1" then grep -eu "$@" awk readonly
+-eu "$1" cd "$1" printf printf "$1" $(pwd) /usr/bin ${HOME} $(pwd) | awk 'quoted text'
+		done x=1 done readonly done local printf $(pwd) done | ${HOME} printf | readonly
+	then done 2>/dev/null "$@" --verbose $(pwd) ${HOME} "$1" $(pwd) test --verbose readonly
+		grep cd test $(pwd) --verbose "$1" cd
+	"$1" then done && 2>/dev/null printf -eu printf then printf
+	${HOME} then then then $(pwd) "$@" done printf x=1 then /usr/bin --verbose
+printf /usr/bin then echo 2>/dev/null sed sed printf
+printf 'quoted text' /usr/bin ${HOME} printf cd awk
+then echo export -eu printf
+local export grep "$@" --verbose | $(pwd) 'quoted text'
+		"$@" done | /usr/bin /usr/bin sed "$1" "$1" $(pwd)
+	&& local printf 'quoted text' 2>/dev/null
+		grep printf done "$@" x=1 echo 'quoted text'
+		/usr/bin test --verbose cd printf x=1 printf -eu local -eu readonly then
+--verbose echo ${HOME} && $(pwd) /usr/bin readonly
+cd test printf "$@" awk readonly done printf /usr/bin 2>/dev/null
+echo test sed readonly echo /usr/bin x=1 'quoted text' grep cd $(pwd)
+	2>/dev/null | printf -eu grep readonly
+"$1" sed $(pwd) ${HOME} ${HOME} export |
+x=1 'quoted text' then grep /usr/bin /usr/bin "$1" | then echo | ${HOME}
+	echo ${HOME} export "$1" 2>/dev/null then && cd "$@" grep awk "$1" "$@"
+cd /usr/bin | sed done --verbose && $(pwd) awk 'quoted text' $(pwd) then
+		2>/dev/null grep export printf echo grep && && --verbose test 'quoted text'
+		readonly | "$1" $(pwd) ${HOME} printf --verbose
+	local done /usr/bin $(pwd) "$@" printf /usr/bin x=1 /usr/bin | echo printf 'quoted text'
+	done printf local echo export && /usr/bin echo && "$1" grep grep x=1 grep
+		export echo then | /usr/bin 2>/dev/null
+		&& local then 'quoted text'
+	printf x=1 test ${HOME} -eu cd printf && sed ${HOME} test
+-eu test sed then ${HOME} && awk
+	"$1" | | && -eu readonly then sed | -eu readonly printf
+	cd printf -eu $(pwd) then $(pwd) /usr/bin | awk
+cd $(pwd) printf -eu local ${HOME} sed sed grep && 'quoted text' sed "$1" grep
+	-eu cd cd grep --verbose test | grep then test | export test then x=1
+	2>/dev/null --verbose && done --verbose && readonly
+	"$1" 2>/dev/null 2>/dev/null cd /usr/bin "$@"
+sed readonly "$1" local
+"$1" /usr/bin ${HOME} | done | $(pwd)
+	-eu export x=1 awk printf sed ${HOME} "$1" && ${HOME} 'quoted text' "$1" ${HOME}
+grep $(pwd) cd "$@" "$@" 2>/dev/null cd "$@" export -eu awk -eu cd cd 2>/dev/null
+	readonly && /usr/bin $(pwd) x=1 awk awk
+cd awk /usr/bin readonly printf 2>/dev/null x=1 --verbose $(pwd)
+		/usr/bin $(pwd) cd cd then export awk then local
+		echo then done && then $(pwd) | "$@" 2>/dev/null
+test grep sed grep "$1" printf awk x=1 then grep test awk then
+		$(pwd) local ${HOME} printf sed "$@" 'quoted text' sed "$1" printf $(pwd) printf
+	printf sed x=1 grep 2>/dev/null grep -eu sed "$1" printf echo local
+		$(pwd) cd | done export done awk 'quoted text' ${HOME} 'quoted text'
+export echo sed cd cd sed $(pwd) $(pwd)
+	sed | 'quoted text' sed -eu && 2>/dev/null | |
+	done 2>/dev/null "$@" cd 2>/dev/null --verbose --verbose awk
+		awk 'quoted text' awk done | $(pwd) test -eu export grep x=1 x=1 then | grep
+		$(pwd) readonly /usr/bin printf x=1 awk 'quoted text' "$1" grep && ${HOME}
+cd | export "$1" $(pwd) export ${HOME}
+readonly --verbose echo /usr/bin grep
+		'quoted text' x=1 grep "$@" --verbose -eu ${HOME} $(pwd) -eu "$@"
+	2>/dev/null printf x=1 cd -eu 'quoted text'
+		&& /usr/bin /usr/bin | sed then
+$(pwd) export echo export printf 2>/dev/null local 2>/dev/null -eu
+	cd $(pwd) ${HOME} "$1"
+		$(pwd) grep echo awk "$1" $(pwd) readonly
+	"$1" x=1 'quoted text' -eu 2>/dev/null
+	awk x=1 grep local awk test cd printf -eu 2>/dev/null 2>/dev/null done 2>/dev/null
+	"$@" printf "$1" readonly done
+$(pwd) ${HOME} "$@" local -eu --verbose cd --verbose export "$@" ${HOME}
+export printf 2>/dev/null --verbose /usr/bin then
+	sed && printf ${HOME} x=1 local export test && export "$@" 'quoted text'
+	done grep 'quoted text' && grep cd "$1"
+		"$@" done done sed printf cd echo cd $(pwd)
+		/usr/bin cd 'quoted text' readonly $(pwd) readonly 'quoted text'
+	printf readonly "$@" 2>/dev/null export cd local cd 2>/dev/null sed
+&& && && x=1 x=1 cd x=1
+x=1 -eu grep printf local | -eu ${HOME} echo | then x=1 && --verbose readonly
+test sed --verbose /usr/bin | export then then && --verbose test local
+		x=1 grep --verbose done 2>/dev/null /usr/bin /usr/bin $(pwd) awk echo -eu done
+	x=1 done && readonly $(pwd)
+		local "$@" && --verbose then | 2>/dev/null | /usr/bin
+		local cd "$1" export done 2>/dev/null "$1" x=1 then sed ${HOME} 2>/dev/null 2>/dev/null
+readonly x=1 "$1" done | sed then printf done --verbose -eu local
+--verbose cd readonly local test -eu printf 'quoted text' awk $(pwd)
+	&& printf cd "$1" 'quoted text' test echo local && then $(pwd) sed -eu "$@" test
+		$(pwd) done readonly readonly 2>/dev/null printf $(pwd) grep x=1 2>/dev/null
+	&& | grep ${HOME} cd 2>/dev/null then "$1" ${HOME} "$1" | | 'quoted text'
+awk cd x=1 /usr/bin awk test x=1 sed "$1" local $(pwd) echo grep
+		$(pwd) echo && /usr/bin echo then $(pwd) ${HOME} awk local
+sed --verbose readonly -eu 2>/dev/null echo | /usr/bin && test
+	grep 'quoted text' --verbose awk /usr/bin
+	echo $(pwd) -eu awk | done test 2>/dev/null local "$1" awk printf
+	--verbose local "$@" 2>/dev/null ${HOME} | $(pwd) printf local export $(pwd)
+		then done echo $(pwd) printf -eu "$@"
+	test 2>/dev/null 2>/dev/null readonly
+		"$1" local then printf && $(pwd) done -eu local readonly
+	"$@" test then 'quoted text' "$1" awk $(pwd) ${HOME} /usr/bin cd /usr/bin -eu
+		grep done cd 'quoted text' "$@" "$@" done grep x=1 awk export
+	--verbose && done 2>/dev/null 'quoted text' $(pwd)
+		--verbose local done local "$1" | $(pwd) local
+	"$@" done grep then then --verbose awk export /usr/bin --verbose sed --verbose
+		/usr/bin -eu ${HOME} awk "$@" grep
+	cd then | | --verbose echo --verbose then awk x=1 then readonly then
+	${HOME} then test echo grep && && $(pwd) "$@" "$@" done awk ${HOME}
+		echo local -eu && /usr/bin export readonly "$@" /usr/bin 'quoted text'
+		test grep done echo | ${HOME} ${HOME}
+		awk then /usr/bin echo grep echo && grep export readonly export sed cd
+${HOME} sed ${HOME} "$@" cd && | x=1
+	cd -eu && "$1" then x=1 sed printf && --verbose "$@" --verbose
+	done local 'quoted text' $(pwd) x=1 cd x=1 printf echo export 'quoted text'
+	echo "$@" "$@" cd echo cd test 'quoted text' && 'quoted text' done --verbose awk
+"$1" "$@" --verbose /usr/bin "$@" ${HOME} "$1" x=1
+	"$@" "$1" awk readonly awk
+"$1" done 2>/dev/null -eu done printf
+	grep grep /usr/bin -eu export /usr/bin printf awk && awk "$@" "$@"
+2>/dev/null echo x=1 awk awk | && grep awk readonly printf export
+	2>/dev/null x=1 echo sed sed --verbose -eu x=1 echo echo
+echo grep echo grep 2>/dev/null --verbose local $(pwd) "$@" x=1 2>/dev/null
+-eu cd /usr/bin "$@" x=1 then grep echo
+	"$@" 2>/dev/null ${HOME} "$@" test && /usr/bin "$@" cd done | 2>/dev/null "$@"
+	readonly /usr/bin echo ${HOME} "$@" $(pwd) test local sed 'quoted text' done
+	'quoted text' ${HOME} done x=1 sed x=1 then $(pwd) --verbose local -eu then done
+		"$1" 'quoted text' echo sed echo -eu 2>/dev/null grep echo done
+--verbose export then then 2>/dev/null grep test ${HOME} /usr/bin then -eu cd
+	cd 'quoted text' readonly -eu printf | test
+/usr/bin done x=1 "$@" && x=1 local awk awk | -eu x=1 printf
+	awk 2>/dev/null && export
+		"$1" "$1" grep cd cd 2>/dev/null echo && export local
+"$@" cd printf awk done echo ${HOME} "$1" -eu
+		readonly $(pwd) grep && x=1 "$1" echo -eu -eu $(pwd) $(pwd)
+		done x=1 $(pwd) sed /usr/bin export 'quoted text' -eu 'quoted text' awk local
+		printf sed "$@" ${HOME} --verbose done /usr/bin printf 2>/dev/null
+		'quoted text' "$1" /usr/bin --verbose test "$@" export then readonly && printf
+echo done ${HOME} && cd -eu "$@" echo "$@" awk sed grep export
+		readonly $(pwd) done export && /usr/bin -eu then grep
+		export | export x=1 |
+		done readonly test printf | 'quoted text' awk ${HOME} ${HOME} && echo | x=1
+	printf then grep printf /usr/bin local 2>/dev/null x=1 2>/dev/null grep then
+	&& printf readonly x=1 cd $(pwd) -eu export sed && done then /usr/bin
+printf grep echo readonly
+		"$@" test --verbose && export echo && 2>/dev/null "$1" && 2>/dev/null 2>/dev/null
+		x=1 'quoted text' printf && "$1" readonly echo
+		/usr/bin done --verbose /usr/bin
+		x=1 printf then cd then "$1" | sed --verbose /usr/bin | /usr/bin
+	"$@" readonly ${HOME} echo x=1 printf "$1" awk 'quoted text'
+		2>/dev/null sed /usr/bin x=1 local --verbose ${HOME} /usr/bin
+		sed && printf && ${HOME} then ${HOME} export /usr/bin
+x=1 then "$@" /usr/bin -eu -eu
+		cd printf export then grep test --verbose
+		$(pwd) cd "$1" printf && local --verbose awk printf sed local
+--verbose awk printf --verbose echo "$1" 2>/dev/null test
+	${HOME} --verbose 2>/dev/null 2>/dev/null &&
+	test printf -eu $(pwd) $(pwd) -eu test ${HOME} -eu readonly grep /usr/bin then x=1
+		export export readonly x=1 ${HOME} export echo grep --verbose | -eu local | test
+		'quoted text' readonly grep awk echo
+		--verbose | readonly "$@" then x=1 sed done "$@" readonly awk
+	"$@" 2>/dev/null export "$1" 2>/dev/null --verbose
+	"$@" -eu done --verbose "$@"
+sed | test export "$@" -eu
+		'quoted text' && echo readonly export
+cd then grep export then test echo export 2>/dev/null 'quoted text'
+	x=1 grep printf cd then x=1 local ${HOME} ${HOME} printf
+export cd local awk then printf
+	grep echo "$@" /usr/bin then "$1"
+		grep export awk test && then
+		cd -eu "$@" printf "$@" "$1" /usr/bin
+	cd echo then $(pwd) export
+		then 2>/dev/null sed x=1 test --verbose "$@" grep
+--verbose done x=1 local "$@" -eu /usr/bin test
+${HOME} sed | local $(pwd) "$@" printf /usr/bin grep |
+test grep && grep cd local local /usr/bin | 'quoted text' sed done
+	export awk echo -eu x=1 printf
+sed printf printf test 'quoted text'
+		done | done | ${HOME} x=1
+	"$@" $(pwd) local | /usr/bin "$1" $(pwd) local |
+echo 'quoted text' cd && "$1" 2>/dev/null | && 'quoted text' &&
+	awk ${HOME} 2>/dev/null export "$1" 2>/dev/null readonly echo
+	local 2>/dev/null 2>/dev/null "$1" && ${HOME} && sed done 'quoted text'
+	test then && x=1 export test -eu 2>/dev/null
+	2>/dev/null grep then &&
+		| 'quoted text' 'quoted text' -eu then -eu echo test 'quoted text' echo
+&& cd "$1" "$1" test cd export 'quoted text' x=1 "$1" test
+done 2>/dev/null && /usr/bin x=1 sed
+local 2>/dev/null /usr/bin "$@" "$@" cd sed grep done echo ${HOME} awk grep printf
+		"$1" --verbose ${HOME} readonly cd printf readonly sed
+	local test readonly "$@" then "$@" grep local cd local
+		-eu cd x=1 "$1" printf awk awk sed awk 'quoted text'
+		"$@" grep printf grep export
+grep local grep && local "$1" readonly "$@" export
+	-eu x=1 test cd "$1" local export
+		&& /usr/bin ${HOME} then
+/usr/bin ${HOME} --verbose export 'quoted text' /usr/bin printf
+	&& printf done export echo sed | sed awk done
+		printf cd awk cd | local readonly grep | |
+		export printf echo readonly awk readonly
+then -eu export -eu 'quoted text'
+export "$@" /usr/bin export sed
+	&& -eu readonly readonly local
+sed "$1" 2>/dev/null 'quoted text' then
+done && "$1" printf then -eu local then ${HOME} done local
+	echo "$@" test 2>/dev/null done grep then cd 2>/dev/null local /usr/bin | awk
+		awk && --verbose export export grep
+then printf cd "$1" echo local "$@" 'quoted text'
+		echo /usr/bin local ${HOME}
+		done $(pwd) done x=1 $(pwd) --verbose -eu
+		$(pwd) | awk grep -eu -eu /usr/bin
+	then -eu -eu awk $(pwd) local local $(pwd) awk test cd 'quoted text' |
+grep sed 2>/dev/null then && local "$1" 'quoted text' | "$@"
+		awk && awk then test &&
+done --verbose grep printf
+		$(pwd) x=1 cd "$1" test | --verbose -eu sed local awk echo x=1 cd -eu && export
+		${HOME} sed $(pwd) && export "$1" printf local test && "$1"
+x=1 -eu sed --verbose
+${HOME} printf 2>/dev/null grep sed -eu 2>/dev/null test |
+		grep sed 2>/dev/null awk 2>/dev/null /usr/bin
+		test export readonly -eu x=1 local | "$1" test ${HOME} awk "$1"
+'quoted text' && sed "$@" x=1 $(pwd) sed test cd readonly then
+grep done && sed grep --verbose && "$1" "$@" 'quoted text' done && readonly
+	/usr/bin local /usr/bin
+then ${HOME} grep /usr/bin echo
+		$(pwd) then export --verbose --verbose awk ${HOME} -eu awk
+readonly grep cd printf 2>/dev/null readonly
+echo awk /usr/bin x=1 2>/dev/null 'quoted text' x=1 readonly "$@" sed 2>/dev/null
+		readonly | awk ${HOME} then test 2>/dev/null 'quoted text'
+| $(pwd) grep awk export --verbose sed /usr/bin 'quoted text'
+	/usr/bin 2>/dev/null "$@" "$1" x=1 2>/dev/null --verbose 2>/dev/null then echo
+export local cd sed done -eu awk ${HOME} local awk -eu then grep grep awk
+test ${HOME} "$1" grep done
+| -eu then export sed && 'quoted text' then local test cd local -eu sed
+	x=1 "$@" readonly -eu "$@"
+| 'quoted text' then "$1" test export sed | grep | "$1" done export ${HOME} 'quoted text'
+cd sed --verbose cd $(pwd) x=1 "$1" cd cd echo $(pwd)
+		readonly grep grep -eu done ${HOME} readonly
+		x=1 echo readonly echo awk --verbose $(pwd) 2>/dev/null -eu then
+export 2>/dev/null 2>/dev/null 2>/dev/null
+/usr/bin export sed then cd x=1 "$1" "$1" printf sed cd
+grep /usr/bin readonly printf $(pwd) "$1" sed | test "$@"
+$(pwd) export 'quoted text' x=1 sed ${HOME}
+		then cd printf && | echo test echo done cd awk $(pwd) /usr/bin
+	local then awk test 'quoted text' && readonly && 'quoted text'
+	--verbose printf "$@" printf "$@" $(pwd) && done readonly 2>/dev/null /usr/bin
+		export "$@" 2>/dev/null "$1" then
+	2>/dev/null done grep ${HOME} printf printf sed -eu grep
+	export export awk readonly cd sed --verbose
+	| done ${HOME} then --verbose ${HOME}
+"$@" awk grep grep local x=1 sed | echo 2>/dev/null
+"$@" "$1" "$@" /usr/bin /usr/bin sed 2>/dev/null
+sed -eu "$@" readonly grep awk sed /usr/bin grep local echo
+	"$@" 'quoted text' $(pwd) cd echo readonly $(pwd) && local awk 'quoted text'
+	printf 'quoted text' printf test /usr/bin
+"$@" done -eu test then awk | "$1" ${HOME}
+	awk ${HOME} awk $(pwd)
+	$(pwd) x=1 printf $(pwd) echo
+		printf | && then 'quoted text' 'quoted text' 2>/dev/null
+	/usr/bin then | x=1 readonly done ${HOME}
+x=1 awk --verbose sed && awk test local then awk test 2>/dev/null
+		local then $(pwd) local "$@" -eu grep $(pwd) done echo x=1 --verbose
+x=1 awk $(pwd) | "$@" "$@" export
+	export ${HOME} awk $(pwd) readonly echo 'quoted text' -eu readonly
+		done && printf "$1" | readonly echo cd then echo echo export sed export sed
+		| local local "$@" -eu 'quoted text' test printf | awk sed sed
+		grep done printf printf x=1 ${HOME}
+		-eu grep "$1" /usr/bin
+		local then done sed --verbose "$1"
+	then 2>/dev/null -eu -eu /usr/bin echo echo x=1 printf
+${HOME} /usr/bin test grep "$1" echo --verbose
+		export printf | export --verbose 2>/dev/null 2>/dev/null then echo
+	-eu awk $(pwd) awk sed && -eu -eu | cd export test
+	cd -eu "$@" then /usr/bin | local
+	-eu test x=1 awk echo 2>/dev/null echo test x=1
+	done "$1" awk cd then test done ${HOME} echo 'quoted text'
+then --verbose export x=1 "$1" echo export ${HOME}
+--verbose /usr/bin readonly 2>/dev/null --verbose
+	then -eu export x=1 $(pwd) done "$@" | grep ${HOME} done export done done done /usr/bin
+/usr/bin /usr/bin ${HOME} test done test printf
+		done local "$1" x=1 then local 2>/dev/null export /usr/bin 2>/dev/null export
+		test awk test echo $(pwd) && echo x=1
+		done echo | "$@" export --verbose local $(pwd) "$@" export
+	| done grep 'quoted text' | test cd && then 2>/dev/null x=1 export ${HOME} printf
+	"$1" "$1" local "$1" then
+	local -eu --verbose local && $(pwd) echo ${HOME} export -eu then 2>/dev/null
+		"$@" "$1" local | done then test 2>/dev/null cd "$@" sed test export
+then export export ${HOME}
+	'quoted text' export test awk && readonly && cd awk ${HOME}
+	cd | /usr/bin sed -eu test done echo /usr/bin && awk readonly && -eu --verbose
+		sed sed 2>/dev/null x=1 /usr/bin -eu 'quoted text' awk awk $(pwd)
+	"$@" -eu ${HOME} "$1" --verbose "$1" echo export readonly | grep sed ${HOME}
+&& "$1" then x=1 sed test grep printf --verbose --verbose then /usr/bin
+	x=1 awk | && 2>/dev/null readonly
+	"$1" /usr/bin awk "$1" awk | --verbose awk --verbose
+		"$1" --verbose "$1" "$@" ${HOME} done && readonly
+		export printf awk && awk $(pwd) grep awk $(pwd) test
+	done cd awk echo --verbose then -eu "$@" local
+	awk 'quoted text' awk ${HOME}
+	x=1 2>/dev/null $(pwd) "$@"
+2>/dev/null grep grep 2>/dev/null /usr/bin grep then x=1
+		readonly "$1" "$@" $(pwd)
+		&& grep test then export export awk cd test 2>/dev/null done
+	export test -eu grep ${HOME}
+-eu x=1 test ${HOME} local export readonly sed --verbose export printf &&
+		"$@" --verbose | echo done
+'quoted text' test && x=1 2>/dev/null
+${HOME} local printf done then test -eu | test -eu "$@" cd
+	test test ${HOME} grep x=1 x=1 -eu printf then --verbose cd
+		&& export local /usr/bin "$@" readonly local
+		readonly "$1" /usr/bin readonly
+		${HOME} -eu cd readonly 'quoted text' grep sed ${HOME} done sed echo
+	&& x=1 /usr/bin test 2>/dev/null && --verbose printf "$@" done "$@" $(pwd)
+	"$@" echo grep --verbose --verbose --verbose | test
+		x=1 $(pwd) then echo /usr/bin
+	"$1" -eu 2>/dev/null export
+		then done x=1 ${HOME} x=1 cd "$1" --verbose 'quoted text'
+	then local cd ${HOME} test "$1" | printf done x=1 $(pwd) 2>/dev/null
+cd test && | local --verbose export grep 'quoted text' /usr/bin 2>/dev/null
+	then cd test done then $(pwd) local "$1" grep printf readonly --verbose | done echo
+		sed --verbose | printf --verbose
+"$@" 'quoted text' done test
+		test then /usr/bin /usr/bin done ${HOME} -eu -eu test done
+readonly cd 2>/dev/null printf echo && && sed x=1 grep cd grep &&
+printf 2>/dev/null 'quoted text' echo -eu $(pwd) sed grep
+| "$@" local readonly "$@" 2>/dev/null local readonly 2>/dev/null
+"$@" then && x=1 x=1 printf grep export
+	done "$@" && then -eu ${HOME} echo -eu cd sed sed readonly readonly
+cd /usr/bin 'quoted text' $(pwd) sed awk x=1 'quoted text'
+		printf 2>/dev/null then x=1 test test cd then
+		| export export then cd done echo readonly 2>/dev/null x=1
+	local then -eu echo 2>/dev/null /usr/bin done test
+		| $(pwd) echo echo local grep
+		echo sed && echo sed sed $(pwd) x=1 done awk awk | test grep done
+		then then "$1" echo done -eu grep printf done "$@" -eu 2>/dev/null
+$(pwd) local ${HOME} ${HOME} $(pwd) "$@" x=1 | x=1 | local
+		"$@" export "$1" "$@" /usr/bin readonly /usr/bin
+2>/dev/null 2>/dev/null local done done $(pwd) 2>/dev/null
+export then "$@" readonly sed export
+	--verbose ${HOME} 'quoted text'
+		-eu -eu 'quoted text' test /usr/bin local 'quoted text' local
+	then --verbose | grep 'quoted text' "$1" awk
+	echo "$1" export then && printf "$1" sed && && $(pwd) x=1 printf
+local test sed printf /usr/bin -eu --verbose
+		2>/dev/null 'quoted text'
+	printf 'quoted text' grep test 2>/dev/null /usr/bin
+cd $(pwd) cd ${HOME} x=1 -eu export
+		/usr/bin export | "$@" ${HOME} 'quoted text'
+		cd export readonly grep
+	awk done echo -eu export export
+	"$1" test export echo -eu ${HOME} && 2>/dev/null grep
+grep echo then $(pwd) 'quoted text'
+	"$1" 2>/dev/null "$@" awk readonly local printf $(pwd) --verbose --verbose /usr/bin
+	/usr/bin && /usr/bin "$@" 2>/dev/null && cd cd
+	/usr/bin then printf echo export && sed
+		cd sed sed --verbose readonly 'quoted text' &&
+	printf awk then readonly 2>/dev/null -eu "$@" 2>/dev/null
+	local export then then 'quoted text' echo 2>/dev/null && local local 2>/dev/null
+		grep $(pwd) && readonly
+	echo then ${HOME} sed done
+&& 2>/dev/null --verbose then -eu
+	${HOME} done then grep --verbose readonly
+		2>/dev/null $(pwd) | && awk -eu cd | sed grep test local readonly
+	${HOME} $(pwd) 'quoted text' echo printf ${HOME}
+		| --verbose --verbose readonly x=1 | readonly x=1
+		echo --verbose sed local /usr/bin
+	awk echo sed sed done local x=1 && /usr/bin export ${HOME} 'quoted text'
+		done echo local done "$1" 'quoted text' 'quoted text' -eu cd printf cd && 2>/dev/null
+	"$1" awk -eu && printf "$1" ${HOME}
+		cd sed test && && then -eu "$@" sed echo && then $(pwd) ${HOME} x=1 --verbose
+		&& -eu done readonly sed printf
+${HOME} && "$1" | /usr/bin "$@" printf done --verbose -eu --verbose "$1"
+		test -eu --verbose --verbose grep && /usr/bin
+	echo | then awk cd export local then grep 2>/dev/null | grep grep
+| | local "$1" done x=1
+		| | awk 'quoted text' grep --verbose
+	$(pwd) cd ${HOME} readonly cd readonly then "$1" export "$@" 'quoted text' done
+	"$1" $(pwd) printf ${HOME} 2>/dev/null "$1" --verbose grep --verbose
+awk --verbose ${HOME} | $(pwd) && "$@" $(pwd) export done -eu
+		sed x=1 'quoted text' --verbose 'quoted text' && 'quoted text' |
+	readonly $(pwd) grep cd awk "$@" local ${HOME} export -eu ${HOME} | x=1
+printf then "$1" $(pwd) -eu --verbose awk test 'quoted text'
+"$@" 2>/dev/null sed local export test --verbose
+		printf -eu "$1" readonly readonly then "$@" echo test awk sed ${HOME} 2>/dev/null
+	export sed | && printf && | sed ${HOME} echo local --verbose $(pwd) cd | export
+/usr/bin --verbose export $(pwd) && x=1 --verbose
+2>/dev/null "$1" readonly 'quoted text' local sed echo
+		done awk printf sed done echo echo && sed printf local ${HOME}
+"$@" sed "$@" --verbose /usr/bin echo sed "$1" $(pwd)
+		done | grep ${HOME} test /usr/bin
+		sed -eu then $(pwd) sed "$1" export /usr/bin "$1" export
+then printf 2>/dev/null
+cd --verbose "$@" 2>/dev/null test "$@" printf
+export done cd -eu test readonly "$1" readonly cd 'quoted text'
+		export awk readonly grep export ${HOME} /usr/bin export 'quoted text'
+| ${HOME} x=1 /usr/bin test x=1 && | cd $(pwd) readonly
+done then && 2>/dev/null cd
+printf | | 'quoted text'
+		cd $(pwd) 'quoted text' then test && ${HOME} x=1 "$@" grep cd
+		readonly done && local 2>/dev/null cd cd /usr/bin echo grep "$1" cd
+		'quoted text' 'quoted text'
+	awk 'quoted text' && /usr/bin
+	'quoted text' 2>/dev/null
+&& test awk /usr/bin done /usr/bin done awk printf
+	done cd x=1 export cd done -eu export --verbose --verbose /usr/bin
+-eu --verbose ${HOME} test then echo readonly "$@" echo local
+x=1 then readonly "$1" | printf --verbose
+$(pwd) --verbose "$1" $(pwd) && "$@" printf export
+		done --verbose $(pwd) readonly -eu done && done echo 'quoted text'
+	$(pwd) 2>/dev/null printf test then sed test done
+		&& /usr/bin done test "$@" | 'quoted text' then
+readonly sed grep | 'quoted text'
+	| -eu then cd | awk awk x=1 && 2>/dev/null then printf 2>/dev/null awk --verbose
+	cd grep && test test local grep
+	export grep -eu echo
+grep cd done printf /usr/bin
+readonly && x=1 readonly readonly printf
+	-eu "$@" x=1 printf && echo cd awk "$@" $(pwd) --verbose printf
+		then --verbose awk export readonly ${HOME} && test awk sed 'quoted text'
+	export 2>/dev/null sed ${HOME} echo test echo awk 2>/dev/null
+		/usr/bin export ${HOME} export grep 2>/dev/null printf
+		grep done 'quoted text' 2>/dev/null awk done grep 'quoted text' then $(pwd)
+grep 'quoted text' test test awk | | echo
+		then -eu && 2>/dev/null | ${HOME} /usr/bin grep $(pwd)
+	readonly sed cd awk export local cd sed
+		test sed done "$1" readonly sed
+test 'quoted text' then echo printf /usr/bin /usr/bin
+${HOME} ${HOME} | -eu printf x=1 2>/dev/null -eu local -eu ${HOME} export
+		test --verbose $(pwd) "$1" -eu --verbose test /usr/bin
+		/usr/bin grep test cd grep && printf cd
+		cd x=1 printf /usr/bin 2>/dev/null
+	${HOME} --verbose test grep x=1 --verbose cd && test
+x=1 then x=1 readonly x=1 echo 2>/dev/null printf printf "$@" "$@" echo --verbose
+	printf --verbose --verbose /usr/bin "$@" $(pwd) /usr/bin
+export awk test done ${HOME} sed done test 2>/dev/null /usr/bin
+	readonly --verbose x=1 test test ${HOME} done --verbose 'quoted text' then $(pwd)
+x=1 grep awk -eu 2>/dev/null local x=1 grep done echo -eu -eu /usr/bin
+	-eu ${HOME} local "$1" 2>/dev/null readonly
+		sed x=1 readonly "$1" "$1" ${HOME} cd x=1 then then /usr/bin -eu 2>/dev/null
+	&& && then echo test "$@" cd && sed cd echo
+		-eu 2>/dev/null $(pwd) $(pwd) done readonly | -eu /usr/bin grep /usr/bin then
+	sed awk && -eu then /usr/bin --verbose
+		cd then x=1 "$@" cd done awk cd && /usr/bin cd awk readonly grep grep
+	$(pwd) "$1" 2>/dev/null export "$1" |
+	grep --verbose local echo test sed ${HOME} sed test $(pwd) test $(pwd) export
+		--verbose local | sed done && then printf --verbose
+		&& /usr/bin 'quoted text'
+		'quoted text' sed local "$@" 'quoted text' | cd then local
+		--verbose ${HOME} "$@" then then sed $(pwd)
+		awk 'quoted text' -eu /usr/bin local echo && test
+"$1" printf /usr/bin /usr/bin local x=1 test 2>/dev/null sed awk readonly /usr/bin
+| 'quoted text' 'quoted text' ${HOME} && x=1 --verbose /usr/bin awk "$@" export
+		"$1" cd 'quoted text' -eu printf x=1 cd ${HOME}
+		--verbose x=1 --verbose grep printf printf
+		-eu x=1 'quoted text' 'quoted text'
+	export done awk --verbose && -eu
+		echo local readonly done grep /usr/bin | sed x=1 grep && printf "$@"
+	2>/dev/null ${HOME} /usr/bin 2>/dev/null awk && then export "$@"
+		test then printf echo test && /usr/bin ${HOME} "$@" readonly $(pwd)
+done local printf cd && 'quoted text'
+		'quoted text' printf "$@" local echo cd 2>/dev/null
+		printf then "$1" export grep export grep
+		echo local 2>/dev/null readonly | export /usr/bin "$1" test readonly echo ${HOME}
+echo export done printf readonly export "$1" readonly
+	printf then awk ${HOME} x=1 "$@" export readonly echo printf
+printf echo --verbose
+-eu test local /usr/bin 'quoted text' $(pwd) 2>/dev/null x=1 export sed
+		"$@" done /usr/bin printf
+		sed "$@" -eu test sed ${HOME} /usr/bin
+		test awk export /usr/bin && --verbose local sed "$1" local sed local local
+		x=1 $(pwd) --verbose --verbose ${HOME} awk sed local
+		cd ${HOME} --verbose | 'quoted text'
+	$(pwd) --verbose ${HOME} local done --verbose -eu ${HOME} grep --verbose
+'quoted text' -eu sed "$1" x=1 --verbose readonly done --verbose && x=1 2>/dev/null
+	cd && then printf && readonly export /usr/bin | done then printf echo
+${HOME} sed done cd "$1"
+		-eu ${HOME} echo "$@" ${HOME} cd sed x=1 ${HOME} done
+then then test -eu x=1 local
+		then test ${HOME} $(pwd) readonly -eu readonly grep done "$1" local cd sed test
+		awk done grep | echo ${HOME} awk sed --verbose
+echo sed grep "$1" sed printf /usr/bin cd | sed grep
+	"$@" 'quoted text' sed ${HOME} "$1"
+readonly export export local echo $(pwd) cd done local "$1"
+		export $(pwd) 'quoted text' 'quoted text'
+echo 'quoted text' $(pwd) --verbose export test sed
+	/usr/bin ${HOME} | && /usr/bin readonly
+	-eu | echo | 2>/dev/null "$1" export
+2>/dev/null ${HOME} awk sed echo
+	sed --verbose /usr/bin $(pwd) && test /usr/bin done
+		$(pwd) | 2>/dev/null cd then /usr/bin "$1" x=1 && grep --verbose
+grep printf ${HOME} export local grep echo && | --verbose grep
+done awk local test "$@" echo sed printf local export readonly
+		echo && readonly 'quoted text' cd "$1" done sed && readonly echo readonly
+		${HOME} sed echo "$1" x=1 grep "$1" then cd "$@" "$@" --verbose | "$1"
+	cd local readonly $(pwd) --verbose done test $(pwd) export /usr/bin
+cd 2>/dev/null done $(pwd) x=1 sed ${HOME}
+	--verbose test /usr/bin $(pwd) cd "$@"
+		"$1" echo x=1 test "$@" && -eu
+	/usr/bin && 2>/dev/null then local grep cd --verbose then
+		${HOME} grep awk printf x=1 sed export x=1 then test grep cd && 'quoted text'
+		${HOME} readonly printf printf /usr/bin --verbose local then
+	2>/dev/null -eu export local echo local $(pwd) ${HOME}
+--verbose done export cd readonly /usr/bin
+printf readonly -eu 'quoted text' ${HOME} | --verbose awk $(pwd) cd ${HOME}
+	$(pwd) readonly test /usr/bin sed x=1 && x=1 printf printf --verbose ${HOME}
+		then $(pwd) sed awk && ${HOME} test "$1" local | sed ${HOME} printf echo done test
+	export readonly printf then /usr/bin grep "$@"
+	2>/dev/null sed ${HOME} test awk -eu cd 2>/dev/null ${HOME}
+	'quoted text' printf sed x=1 -eu /usr/bin then | && --verbose
+		then local echo printf test export && "$1" | $(pwd) cd ${HOME} /usr/bin ${HOME}
+		${HOME} export | local sed x=1 $(pwd) $(pwd) && "$@" 'quoted text'
+		done 2>/dev/null done printf then test awk "$1" "$@" -eu && 'quoted text'
+		then readonly test done grep local done | $(pwd) ${HOME} -eu cd "$1"
+	x=1 echo then grep "$1" awk readonly $(pwd) $(pwd)
+&& readonly 'quoted text' ${HOME} export
+${HOME} sed readonly x=1 done 'quoted text' echo cd ${HOME} 'quoted text'
+		printf x=1 $(pwd) && sed "$1" printf x=1 2>/dev/null
+	x=1 cd printf && ${HOME} -eu x=1 ${HOME} sed local /usr/bin
+		readonly 2>/dev/null 2>/dev/null $(pwd) 2>/dev/null then 'quoted text'
+	echo && /usr/bin ${HOME} awk echo ${HOME} "$@" done
+	--verbose cd --verbose readonly awk && x=1
+	x=1 done --verbose /usr/bin local 2>/dev/null ${HOME} echo
+		${HOME} -eu cd --verbose done && /usr/bin x=1 cd
+	/usr/bin test grep sed | echo test
+$(pwd) cd cd test x=1 | -eu then readonly
+readonly then echo -eu --verbose then --verbose
+		printf x=1 export $(pwd) test ${HOME} sed ${HOME} done export ${HOME}
+	$(pwd) test export $(pwd)
+		--verbose awk 'quoted text' | printf cd then export x=1 -eu export "$1"
+		grep printf | -eu /usr/bin grep test -eu $(pwd) ${HOME} grep done /usr/bin echo
+		then export -eu local /usr/bin ${HOME} done awk printf "$1" x=1 sed
+	&& 2>/dev/null done && printf printf test
+		"$@" export cd -eu grep test test local x=1 local 'quoted text' --verbose x=1
+		"$@" local readonly /usr/bin test sed && awk
+then x=1 export export test echo -eu -eu "$1" 'quoted text' cd readonly x=1
+awk 'quoted text' local grep
+	$(pwd) readonly "$@" ${HOME}
+		"$1" cd $(pwd) printf grep printf | "$@" --verbose sed readonly cd -eu
+-eu x=1 --verbose test local readonly grep test /usr/bin then $(pwd) 2>/dev/null
+	--verbose -eu echo export -eu
+		| 'quoted text' "$@" 'quoted text' grep x=1 readonly grep 'quoted text'
+${HOME} --verbose 2>/dev/null && -eu && --verbose
+		sed --verbose -eu awk done 2>/dev/null
+echo 2>/dev/null $(pwd) printf echo sed 2>/dev/null 'quoted text'
+	"$1" cd printf 2>/dev/null 2>/dev/null $(pwd) 2>/dev/null local
+	-eu awk "$1" "$1" "$1" sed test "$@" $(pwd) grep --verbose
+		local readonly "$@" awk
+		awk $(pwd) && /usr/bin -eu --verbose /usr/bin then sed | 2>/dev/null
+then awk cd | local cd cd
+	-eu test /usr/bin grep local then -eu test awk local done
+local x=1 awk local --verbose
+		echo grep test awk "$@" done awk
+		local local ${HOME} && export 'quoted text' printf local grep sed printf export
+test ${HOME} | "$@" /usr/bin
+sed local readonly local done $(pwd) sed
+		2>/dev/null $(pwd) readonly awk echo
+		readonly /usr/bin && | $(pwd) -eu awk printf
+	then 'quoted text' /usr/bin readonly $(pwd) grep ${HOME} grep readonly
+printf -eu awk printf x=1 awk x=1 /usr/bin
+		"$1" && test readonly "$@" /usr/bin | &&
+test awk test ${HOME} -eu 'quoted text' ${HOME} cd test "$@" export
+	"$1" grep printf awk done done
+	grep x=1 awk local cd test sed | "$@" x=1
+	cd | awk "$1" --verbose --verbose awk sed cd cd x=1 cd $(pwd) echo 2>/dev/null
+test export -eu 'quoted text' done grep 'quoted text' 2>/dev/null
+	sed then | "$@" export done
+export ${HOME} local then 2>/dev/null
+	test awk 'quoted text' -eu /usr/bin printf "$@" "$1" sed 'quoted text' --verbose
+"$@" grep sed "$1" -eu sed
+readonly x=1 export awk -eu && -eu $(pwd)
+readonly readonly 'quoted text' 'quoted text' /usr/bin printf "$1" then
+		grep && | && export | readonly echo
+		sed ${HOME} printf --verbose
+then "$@" "$@" && x=1 x=1 export
+	--verbose echo | && $(pwd) readonly $(pwd) test | printf 2>/dev/null local sed
+2>/dev/null sed /usr/bin --verbose
+sed readonly readonly sed -eu export done done "$@"
+		printf cd done x=1 grep "$@" done /usr/bin test export sed echo readonly ${HOME}
+	"$@" then "$@" "$1" printf
+	/usr/bin 'quoted text' /usr/bin
+	"$@" $(pwd) then 2>/dev/null test cd export && $(pwd) then | $(pwd) awk echo grep
+x=1 test $(pwd) /usr/bin 2>/dev/null test --verbose done "$1" 'quoted text'
+	readonly && then --verbose 2>/dev/null
+	&& /usr/bin | cd "$@" awk grep 'quoted text'
+		printf /usr/bin export done 2>/dev/null /usr/bin
+		${HOME} local "$@" sed "$@" grep local --verbose
+	&& 2>/dev/null $(pwd) && sed --verbose $(pwd) "$1" awk done sed -eu /usr/bin
+grep x=1 && export $(pwd) export "$1" 'quoted text' /usr/bin "$1" sed done
+/usr/bin cd --verbose $(pwd)
+echo readonly -eu "$1" && && && echo sed "$@" then -eu test -eu 2>/dev/null
+'quoted text' cd printf readonly --verbose grep echo done x=1 local "$1" test
+	$(pwd) --verbose export /usr/bin sed -eu 2>/dev/null
+	'quoted text' readonly then echo --verbose /usr/bin 'quoted text'
+		2>/dev/null "$@" grep "$@" cd sed cd ${HOME} grep test
+readonly local awk local readonly x=1 printf "$1" then local
+		'quoted text' test sed x=1 test
+		| x=1 | ${HOME} test | "$1" readonly export sed -eu --verbose /usr/bin
+	'quoted text' sed "$@" sed sed export x=1 ${HOME} 2>/dev/null ${HOME} export
+		"$1" x=1 local $(pwd) && printf 2>/dev/null printf echo export 2>/dev/null
+	echo ${HOME} export printf then 'quoted text' ${HOME} sed 2>/dev/null x=1
+		printf | $(pwd) 2>/dev/null then
+awk "$@" grep "$@" --verbose cd --verbose 'quoted text'
+then "$@" --verbose awk x=1 ${HOME} then test "$1" --verbose
+	export awk 2>/dev/null "$@" grep && /usr/bin cd echo x=1
+		'quoted text' ${HOME} $(pwd) printf --verbose -eu && && then export grep
+		local "$1" && printf $(pwd) printf export 'quoted text'
+test sed readonly x=1 then done awk --verbose --verbose then done $(pwd)
+	2>/dev/null /usr/bin export printf printf export
+${HOME} echo "$1" -eu sed
+		$(pwd) ${HOME} local export x=1
+then x=1 then awk "$@" readonly
+	| | test printf local $(pwd) "$1" && "$1" "$1" $(pwd) printf
+local test awk test | -eu done readonly
+	${HOME} local done "$@" cd printf x=1 echo export && then 'quoted text'
+test x=1 'quoted text' ${HOME} echo $(pwd) ${HOME}
+	--verbose x=1 --verbose --verbose awk echo export export
+		readonly grep readonly "$1" /usr/bin awk echo $(pwd) cd grep | -eu grep readonly
+		x=1 -eu grep --verbose readonly x=1 awk test local
+		--verbose --verbose "$1" export printf 2>/dev/null
+cd | x=1 grep --verbose echo "$@" | 2>/dev/null
+		export echo cd "$1" --verbose
+		grep 2>/dev/null "$1" awk done awk
+	grep "$1" && test export "$@" $(pwd) done grep "$@" /usr/bin $(pwd) --verbose
+awk --verbose grep awk $(pwd) -eu grep readonly echo done cd 'quoted text'
+	${HOME} printf cd ${HOME} test sed local x=1 sed 'quoted text'
+	export cd done done ${HOME} local 2>/dev/null sed --verbose local cd
+then grep | x=1 cd done readonly awk $(pwd)
+awk $(pwd) | done ${HOME} sed $(pwd) then
+	sed echo "$@" readonly x=1 2>/dev/null 2>/dev/null cd printf test $(pwd)
+--verbose -eu echo then -eu "$@" export grep 'quoted text' "$1" "$1"
+'quoted text' sed then /usr/bin printf 2>/dev/null then | $(pwd)
+		printf $(pwd) sed done | test /usr/bin printf $(pwd) local sed done
+--verbose local 2>/dev/null $(pwd) cd /usr/bin printf && grep cd
+"$@" x=1 $(pwd) sed "$@" sed test | test
+	grep printf local 2>/dev/null | | export $(pwd) then local test awk ${HOME}
+		--verbose awk cd printf "$1" echo "$1" /usr/bin
+	grep 'quoted text' 'quoted text' awk --verbose
+		${HOME} local --verbose --verbose 'quoted text' then sed sed
+/usr/bin awk 2>/dev/null done
+readonly grep && printf "$@" printf
+		$(pwd) 'quoted text' awk "$1" --verbose test
+	cd /usr/bin -eu grep test readonly 'quoted text'
+"$1" -eu --verbose ${HOME}
+'quoted text' export && /usr/bin x=1 sed $(pwd) printf 2>/dev/null /usr/bin /usr/bin
+	done && echo "$1" --verbose
+		readonly then && 2>/dev/null "$1"
+		readonly 'quoted text' x=1 2>/dev/null grep "$@" test
+then $(pwd) && && test
+printf /usr/bin test /usr/bin -eu awk export then local echo awk 'quoted text'
+export sed "$1" x=1 cd done "$@" readonly printf local $(pwd)
+grep -eu ${HOME} echo 2>/dev/null
+		x=1 | echo then echo awk | echo 2>/dev/null
+	printf export $(pwd) done awk /usr/bin test cd then --verbose
+2>/dev/null echo sed export
+	printf x=1 then --verbose "$1" "$@" cd
+2>/dev/null cd cd | "$@" 2>/dev/null 2>/dev/null awk echo readonly "$1" export
+	printf done echo cd awk $(pwd)
+		--verbose /usr/bin "$1" test export
+		grep export 2>/dev/null | local done $(pwd) test $(pwd) "$1" export then done
+		sed x=1 | --verbose "$1" x=1 test export printf awk ${HOME} printf
+	local echo then test echo | cd x=1 grep |
+		done echo local grep local && 2>/dev/null
+awk 2>/dev/null cd grep done && --verbose && /usr/bin echo local
+test "$@" grep "$1" then readonly grep sed
+	/usr/bin /usr/bin x=1 readonly "$1" | --verbose ${HOME} -eu ${HOME}
+printf local then $(pwd) sed | --verbose "$@" | then
+		done | echo ${HOME} done ${HOME} done $(pwd) "$1" --verbose 2>/dev/null ${HOME}
+		cd test export --verbose
+	grep cd 'quoted text' sed then x=1 "$1" ${HOME} $(pwd) local
+	printf grep && then /usr/bin /usr/bin 2>/dev/null "$@" export -eu then "$@"
+'quoted text' /usr/bin 2>/dev/null
+awk "$1" test "$1" local export x=1 sed 2>/dev/null echo done -eu && echo | printf
+		export --verbose grep awk sed
+--verbose ${HOME} $(pwd) && sed "$1" $(pwd) --verbose test
+	-eu x=1 done ${HOME} local cd echo "$@" 'quoted text' done $(pwd) export done
+		then export readonly --verbose | done --verbose
+	| ${HOME} --verbose -eu then ${HOME} echo 2>/dev/null -eu ${HOME} printf 'quoted text'
+	&& 2>/dev/null $(pwd) 2>/dev/null --verbose --verbose
+		${HOME} x=1 echo 2>/dev/null /usr/bin
+		cd x=1 done /usr/bin grep test && test local ${HOME} -eu done sed /usr/bin
+x=1 printf grep done 'quoted text' /usr/bin echo readonly echo "$1" 'quoted text'
+awk && "$@" /usr/bin then -eu /usr/bin /usr/bin | cd test "$1"
+	readonly grep --verbose printf sed
+		&& 2>/dev/null awk cd /usr/bin
+	'quoted text' -eu /usr/bin "$@" /usr/bin awk
+	/usr/bin && export 'quoted text'
+		${HOME} awk readonly then x=1 | sed "$1" "$@"
+		${HOME} $(pwd) awk test $(pwd) "$1" x=1
+$(pwd) -eu | local awk "$1" readonly
+	echo "$@" | $(pwd) then then
+	"$@" sed "$1" echo then "$1" $(pwd) then cd grep grep
+		grep "$1" | $(pwd) | grep /usr/bin --verbose $(pwd) "$1"
+		${HOME} grep --verbose readonly grep local local
+| | grep && | -eu done $(pwd)
+"$1" /usr/bin cd ${HOME} sed /usr/bin done export /usr/bin "$@" x=1 $(pwd) printf
+"$1" export done 2>/dev/null readonly ${HOME} "$1" x=1 echo 2>/dev/null
+		"$1" readonly ${HOME} readonly --verbose
+	echo && | 2>/dev/null
+	echo 'quoted text' grep x=1 | local ${HOME}
+	printf test export local 'quoted text'
+cd cd done cd -eu $(pwd) "$1" && local 'quoted text' done ${HOME} |
+| "$@" x=1 grep sed -eu "$@" awk | "$1" ${HOME}
+		x=1 cd "$1" export $(pwd) export sed ${HOME} readonly echo printf
+echo "$1" | export readonly
+		printf grep "$@" echo cd | x=1 2>/dev/null sed printf
+		grep awk grep x=1 export test
+x=1 echo ${HOME} 'quoted text' 'quoted text' && --verbose done --verbose
+		local export sed --verbose then | awk && export /usr/bin then && && $(pwd)
+	"$1" 'quoted text' done local readonly done grep && export
+		/usr/bin --verbose test 'quoted text' then awk awk | "$@"
+sed | readonly done sed awk readonly then
+		"$@" -eu && x=1 | grep 2>/dev/null
+		-eu then $(pwd) awk test
+	then local done && echo x=1 ${HOME}
+	cd done export "$1" export && echo
+	echo cd /usr/bin cd sed 2>/dev/null sed sed done --verbose
+	2>/dev/null grep 'quoted text'
+	grep cd done "$@" --verbose local local cd --verbose 'quoted text'
+	export -eu test -eu done 2>/dev/null export -eu && export | &&
+grep awk | x=1 readonly printf local
+grep -eu "$@" printf && export then
+	cd x=1 && then -eu /usr/bin then readonly "$@" 2>/dev/null x=1
+		&& x=1 "$1" 2>/dev/null printf "$@" export printf
+		sed 2>/dev/null grep "$1" export 2>/dev/null ${HOME} cd /usr/bin test cd /usr/bin
+	x=1 sed local echo -eu done 'quoted text' test cd echo
+	echo 'quoted text' cd | $(pwd) export
+	echo 'quoted text' sed printf x=1
+		x=1 grep printf 'quoted text'
+&& x=1 && 2>/dev/null ${HOME} export test $(pwd)
+		-eu && readonly 'quoted text' grep ${HOME} test test && readonly /usr/bin
+		test printf && cd grep 2>/dev/null x=1 --verbose | done printf printf
+"$@" "$@" | $(pwd) | --verbose
+test done x=1 | readonly -eu --verbose ${HOME}
+		printf sed cd then export grep 2>/dev/null && then export test ${HOME} ${HOME}
+	2>/dev/null awk cd | 2>/dev/null -eu readonly | ${HOME} sed -eu $(pwd) cd --verbose
+		'quoted text' done done local "$@" test $(pwd)
+		x=1 grep then "$@" grep -eu "$@" local "$@" export awk -eu 2>/dev/null
+cd && awk cd grep "$@" $(pwd) | echo grep echo printf export 'quoted text' done
+	/usr/bin "$1" "$1" -eu x=1 echo grep $(pwd) grep then $(pwd) grep 2>/dev/null
+		cd ${HOME} 2>/dev/null "$@" 2>/dev/null test test grep --verbose
+	then "$1" /usr/bin readonly readonly
+sed grep cd ${HOME} awk 2>/dev/null sed | 'quoted text'
+	local ${HOME} x=1 ${HOME} grep
+	&& done awk done test /usr/bin
+	readonly 'quoted text' printf -eu | then x=1 then
+"$1" awk test export local | ${HOME} readonly "$1" test then 'quoted text'
+x=1 | 2>/dev/null --verbose -eu printf 'quoted text' --verbose
+		printf && printf echo
+sed awk sed printf "$@" echo readonly x=1 ${HOME} export
+		then echo cd sed 2>/dev/null ${HOME} x=1 grep done
+grep x=1 --verbose export then ${HOME} local
+		--verbose "$1" printf "$1" echo --verbose readonly
+		done ${HOME} --verbose sed readonly local x=1 export && then "$1"
+--verbose 2>/dev/null sed && test && grep
+		${HOME} "$1" ${HOME} test then test x=1 $(pwd) --verbose 2>/dev/null --verbose
+	"$@" cd local echo "$@" grep --verbose sed printf echo x=1 export
+| grep printf ${HOME} 2>/dev/null 2>/dev/null --verbose done export
+		grep local awk && cd x=1 | grep grep cd echo
+'quoted text' sed then local readonly printf
+awk "$1" cd x=1 grep "$1" --verbose /usr/bin done sed x=1 then -eu x=1 "$1"
+	printf && test "$@" readonly /usr/bin printf /usr/bin -eu ${HOME} grep
+cd /usr/bin cd echo "$@" | then
+	&& awk 'quoted text' local sed $(pwd) 'quoted text'
+	export | echo "$1" | export
+		sed 'quoted text' done && && grep /usr/bin sed awk 2>/dev/null local -eu 2>/dev/null
+	--verbose readonly -eu printf grep 'quoted text'
+		&& $(pwd) awk sed export local 2>/dev/null test awk 2>/dev/null
+2>/dev/null printf test
+"$@" echo echo printf ${HOME} x=1 export -eu
+	"$1" "$1" /usr/bin "$@" sed sed 2>/dev/null $(pwd) readonly $(pwd)
+then -eu cd echo printf test ${HOME} echo 2>/dev/null 2>/dev/null && -eu
+awk readonly export -eu awk && then x=1 'quoted text' awk 2>/dev/null
+	then $(pwd) 2>/dev/null export echo then "$1"
+	/usr/bin local readonly
+x=1 && echo --verbose "$1" echo echo "$1" sed | /usr/bin
+grep printf readonly && x=1 test
+	$(pwd) $(pwd) export done awk | grep ${HOME} && /usr/bin --verbose | "$1" $(pwd)
+2>/dev/null then x=1 --verbose done echo "$1" grep $(pwd) && sed done | x=1 --verbose
+		grep test /usr/bin awk readonly x=1 --verbose
+echo sed x=1 --verbose -eu awk 'quoted text' | export sed test awk
+		then grep cd -eu export -eu test "$1" $(pwd) sed done sed cd done | echo
+	x=1 then export printf export /usr/bin "$@" test && ${HOME} cd test printf
+		then "$1" $(pwd) printf echo readonly done "$@" export | x=1 "$1"
+	${HOME} grep "$1" readonly readonly cd test then
+readonly test x=1 done local 'quoted text' "$@" && export /usr/bin "$@"
+echo | x=1 grep --verbose /usr/bin --verbose awk echo ${HOME} x=1
+--verbose --verbose 'quoted text' | cd /usr/bin sed "$@"
+awk readonly echo then sed cd "$@" 2>/dev/null
+	printf grep --verbose x=1 export then then then test
+		done -eu 2>/dev/null $(pwd) then
+		'quoted text' printf echo
+	$(pwd) awk export cd x=1 printf ${HOME} sed
+readonly cd ${HOME} readonly $(pwd) export && "$1" "$1" $(pwd) local
+grep then && "$1" local printf "$@"
+		--verbose --verbose then "$1" sed readonly -eu ${HOME} echo cd grep x=1 readonly
+readonly awk "$@" echo
+printf grep sed 2>/dev/null && 2>/dev/null local
+	x=1 awk export x=1 'quoted text' echo sed /usr/bin
+--verbose printf sed 2>/dev/null
+		awk "$@" /usr/bin done "$1" local readonly
+	"$@" 'quoted text' done printf $(pwd) then awk echo then
+		'quoted text' $(pwd) printf $(pwd) export ${HOME} /usr/bin test
+		local 2>/dev/null && then done 'quoted text' x=1 grep echo /usr/bin awk sed
+	awk --verbose ${HOME} x=1 ${HOME} awk grep local "$1" && cd
+	then sed cd awk $(pwd) "$1" "$@" x=1 grep echo readonly $(pwd) sed 2>/dev/null printf
+		printf done && | awk "$@" $(pwd) done /usr/bin
+		export export /usr/bin sed printf -eu ${HOME} done echo grep sed
+		echo /usr/bin | /usr/bin grep $(pwd) x=1 local test done printf
+	| x=1 printf /usr/bin test then | x=1 sed 'quoted text' ${HOME} sed x=1
+	echo local test done grep --verbose | done --verbose awk
+	"$@" printf $(pwd) awk "$@" $(pwd) cd ${HOME} $(pwd)
+	${HOME} awk 'quoted text' echo echo awk echo
+2>/dev/null | -eu "$@"
+	export grep /usr/bin ${HOME} ${HOME} x=1 "$@"
+"$1" 2>/dev/null /usr/bin
+done test /usr/bin grep x=1 "$@" x=1 then 2>/dev/null cd
+	"$@" readonly 2>/dev/null cd grep
+"$@" cd local export $(pwd) grep $(pwd)
+cd readonly test 2>/dev/null printf
+"$1" 'quoted text' 'quoted text'
+		echo x=1 sed local -eu awk local | awk 'quoted text'
+	"$@" | | && readonly
+	&& "$@" done sed then ${HOME} local awk -eu grep /usr/bin && printf
+	local ${HOME} x=1 && $(pwd)
+	export export 2>/dev/null 2>/dev/null
+/usr/bin x=1 $(pwd) local -eu /usr/bin grep then && && then awk
+	done grep | x=1 --verbose $(pwd)
+		printf sed awk test /usr/bin sed grep | awk ${HOME} 2>/dev/null
+	export x=1 then local x=1 ${HOME} local
+"$@" local "$@" local awk readonly cd local --verbose
+		2>/dev/null export then then --verbose
+	&& sed export $(pwd) /usr/bin -eu | grep && "$1" grep awk local then
+	sed then awk "$1" awk local local
+-eu test -eu && printf && -eu awk -eu "$1" $(pwd) sed "$1" awk echo "$1"
+		awk grep awk echo | && ${HOME} "$1" then
+"$@" | printf done 'quoted text' then done
+	echo test test $(pwd) $(pwd) && 'quoted text' cd sed test | ${HOME} "$1"
+	local sed x=1 readonly then printf 2>/dev/null 2>/dev/null awk
+export "$1" -eu readonly done ${HOME}
+	x=1 'quoted text' $(pwd) test sed "$1" "$1"
+	done then -eu | awk "$1" readonly local printf "$@" 'quoted text' local "$1"
+sed awk export --verbose export
+		readonly done grep $(pwd) test
+"$1" x=1 x=1 'quoted text' readonly cd "$1"
+	printf /usr/bin done x=1 readonly cd /usr/bin
+	&& export then && then
+	"$@" && echo $(pwd) x=1 | cd "$1" | cd cd && -eu test awk sed "$1" --verbose
+		export /usr/bin echo -eu grep && local readonly
+	cd ${HOME} "$1" 'quoted text' "$@" /usr/bin --verbose && cd && x=1 readonly
+	$(pwd) "$1" local && awk done awk awk x=1
+	/usr/bin --verbose --verbose | grep sed grep 'quoted text'
+		printf printf cd then | printf echo 'quoted text' && export 2>/dev/null
+	then | | printf x=1 test grep "$@" "$1" printf
+	${HOME} sed export /usr/bin 'quoted text' printf export then
+		${HOME} printf printf export awk /usr/bin
+	then "$1" $(pwd) cd test export awk x=1 echo x=1 $(pwd) -eu sed | && $(pwd)
+	x=1 done echo $(pwd) awk cd cd 'quoted text' printf
+		${HOME} grep && 2>/dev/null grep grep ${HOME} cd "$1" --verbose readonly
+	cd 2>/dev/null "$@" done --verbose
+test "$1" export export sed x=1
+	/usr/bin ${HOME} readonly "$@" /usr/bin -eu x=1 grep x=1 printf
+"$1" 'quoted text' sed | 2>/dev/null echo -eu 'quoted text'
+	printf printf $(pwd) --verbose
+		sed cd then 'quoted text' test "$@" readonly then readonly x=1 cd printf grep cd
+		printf 'quoted text' x=1 readonly -eu --verbose --verbose
+	done readonly "$1" printf then "$@" 'quoted text' done export
+	sed echo export /usr/bin --verbose ${HOME} 2>/dev/null ${HOME} sed "$@"
+	-eu ${HOME} -eu x=1 printf export && local local
+		--verbose 2>/dev/null "$1" | echo x=1 export
+&& ${HOME} "$1" local done --verbose done x=1 -eu export --verbose && done
+		then export x=1 "$1" done readonly done --verbose
+$(pwd) echo | 'quoted text' then export -eu
+		awk && --verbose ${HOME} readonly readonly -eu printf $(pwd) grep awk
+		cd 2>/dev/null then 'quoted text' "$1" --verbose "$@" -eu && export
+	readonly then local local export export done awk grep cd printf x=1 $(pwd)
+| done --verbose 2>/dev/null readonly cd x=1 echo ${HOME} "$@" cd awk
+| ${HOME} /usr/bin grep 'quoted text' 'quoted text' ${HOME}
+		${HOME} readonly && local --verbose
+	printf "$1" "$1" 2>/dev/null 'quoted text'
+&& done local --verbose awk export "$1" grep sed 2>/dev/null sed test "$@"
+		-eu --verbose -eu local
+sed then && "$@" then $(pwd) ${HOME} "$@" -eu printf /usr/bin
+&& 'quoted text' readonly | grep printf
+$(pwd) 2>/dev/null printf sed done sed | echo --verbose
+		"$1" x=1 /usr/bin readonly 2>/dev/null --verbose export
+grep --verbose ${HOME} local -eu printf $(pwd) cd "$@" x=1 'quoted text'
+		--verbose grep x=1 awk awk 2>/dev/null done awk awk awk && readonly | $(pwd)
+"$@" awk done done ${HOME} export
+	-eu done local "$1" then ${HOME} awk printf "$@" echo local then x=1
+	readonly x=1 "$1" --verbose $(pwd) | cd 2>/dev/null echo "$@" printf /usr/bin
+		${HOME} /usr/bin "$1" 'quoted text' /usr/bin
+		"$1" /usr/bin "$@" --verbose "$1" sed -eu awk
+x=1 sed awk grep test "$1" --verbose "$@" -eu "$@" cd |
+		test --verbose cd test "$@" x=1 | echo done | && "$@" 2>/dev/null
+	grep && 2>/dev/null --verbose | local test -eu
+		readonly export printf then && $(pwd) 2>/dev/null
+$(pwd) "$1" done sed 'quoted text'
+		echo ${HOME} then x=1 /usr/bin -eu -eu printf readonly $(pwd) ${HOME}
+local readonly readonly x=1 ${HOME} cd cd sed echo --verbose sed grep "$@"
+	done sed test awk &&
+		x=1 local ${HOME} 2>/dev/null
+		test test x=1 printf x=1 2>/dev/null ${HOME} done local -eu "$1" -eu "$@"
+	cd && x=1 /usr/bin /usr/bin sed
+	--verbose awk --verbose readonly export
+	2>/dev/null -eu export 2>/dev/null 2>/dev/null 2>/dev/null ${HOME}
+	&& grep echo grep x=1 printf readonly
+	| 'quoted text' local sed test done printf | "$1" test "$1" sed
+	readonly && && then cd export sed /usr/bin cd local -eu cd grep test
+x=1 echo export $(pwd) ${HOME} && done "$1" /usr/bin &&
+	export ${HOME} && local --verbose done export
+	${HOME} cd readonly readonly | export grep readonly "$1" "$@" grep export awk --verbose
+		cd sed echo && 'quoted text'
+		cd local 2>/dev/null x=1 'quoted text' test ${HOME} "$@" local $(pwd) echo grep
+		then awk readonly sed grep --verbose
+-eu "$@" local local echo -eu then
+cd export done echo done
+		export ${HOME} $(pwd) grep $(pwd) 'quoted text' then /usr/bin --verbose
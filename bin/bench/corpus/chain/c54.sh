@@ -0,0 +1,2001 @@
+		done "$1" && -eu then "$1" then /usr/bin readonly x=1 x=1
+		-eu echo printf -eu printf printf then $(pwd)
+		"$@" "$1" "$1" ${HOME} |
+		&& cd grep 'quoted text' /usr/bin local "$@" local readonly
+		export $(pwd) test 2>/dev/null $(pwd) ${HOME} $(pwd) awk 2>/dev/null
+		/usr/bin then export printf printf echo "$@" export done
+	done echo local "$1" "$@" readonly 2>/dev/null grep printf /usr/bin /usr/bin
+		'quoted text' $(pwd) /usr/bin ${HOME} local --verbose x=1 "$@"
+		test "$1" cd "$1" export x=1 | | 2>/dev/null 2>/dev/null cd then echo
+	local "$@" local && | $(pwd) && readonly awk awk local -eu printf sed -eu printf
+	$(pwd) printf printf $(pwd) export export
+	sed $(pwd) --verbose "$@"
+	printf ${HOME} sed done then export "$@" 2>/dev/null
+awk test export 'quoted text' -eu export awk sed grep cd ${HOME}
+test grep test echo 2>/dev/null awk test export awk awk local -eu x=1 && 2>/dev/null
+		--verbose | "$1" cd then --verbose done then -eu readonly
+		'quoted text' cd printf printf "$1" $(pwd) then
+	awk && grep done --verbose /usr/bin
+/usr/bin grep --verbose "$1" 'quoted text' /usr/bin
+		"$@" export echo export export
+		--verbose then 2>/dev/null cd done done local && x=1
+		done sed | 'quoted text' --verbose 2>/dev/null
+-eu printf "$@" local -eu | readonly printf awk 'quoted text' |
+	export x=1 "$1" sed cd $(pwd) echo export
+'quoted text' 2>/dev/null sed "$@" sed 2>/dev/null export
+	'quoted text' sed ${HOME}
+	-eu x=1 2>/dev/null x=1 | printf grep done
+2>/dev/null grep export "$@" sed 2>/dev/null printf done "$1" $(pwd) readonly
+		test "$@" 'quoted text'
+	then --verbose "$1" -eu local $(pwd) ${HOME} grep test ${HOME} sed --verbose
+	| | readonly 'quoted text' $(pwd) export done then sed then
+printf && export 'quoted text' -eu --verbose 'quoted text' "$@" test
+		/usr/bin ${HOME} && awk grep
+		printf ${HOME} test 2>/dev/null done
+	| -eu 2>/dev/null cd && cd awk grep x=1 -eu
+		cd sed ${HOME} awk printf then local "$1" "$1" --verbose
+		export readonly 'quoted text' done local 'quoted text' x=1 "$@" --verbose "$1"
+		test readonly && x=1 test export cd export --verbose
+		then x=1 'quoted text' done readonly
+	export printf /usr/bin test grep echo local printf
+		sed $(pwd) | 'quoted text' --verbose && --verbose local 'quoted text'
+awk sed -eu 'quoted text' | readonly $(pwd)
+		sed --verbose "$@" printf /usr/bin cd /usr/bin local --verbose
+&& && printf printf /usr/bin 2>/dev/null
+	-eu test echo done $(pwd) readonly
+	x=1 printf && sed local ${HOME} done local | 'quoted text'
+	cd readonly && -eu sed export "$@" "$1" grep
+	"$@" ${HOME} $(pwd) sed /usr/bin grep done local -eu awk then 'quoted text'
+	${HOME} 2>/dev/null local then &&
+		done 2>/dev/null | done "$1" cd awk test x=1 readonly
+done done 'quoted text' && "$1" local
+		${HOME} local && $(pwd) "$1" grep /usr/bin
+		sed x=1 x=1 'quoted text' $(pwd) local
+"$1" done /usr/bin readonly echo ${HOME} | done && --verbose
+	then cd readonly "$@" awk done &&
+	sed export --verbose export
+		test printf ${HOME} readonly 'quoted text' 2>/dev/null
+		readonly printf readonly "$@" then sed ${HOME}
+	"$@" 2>/dev/null ${HOME} /usr/bin
+	-eu sed | export done test 'quoted text' sed $(pwd) -eu local "$1" $(pwd)
+		cd $(pwd) 2>/dev/null 'quoted text' | --verbose $(pwd) -eu $(pwd)
+		"$1" | --verbose echo printf --verbose 'quoted text'
+		done readonly "$@" x=1 cd /usr/bin $(pwd) "$1" 2>/dev/null "$@"
+	done then --verbose grep "$@" readonly
+	"$@" done && export "$1" | echo test ${HOME} "$@"
+		printf awk echo export
+printf sed test $(pwd) done ${HOME} export "$@" "$1" | | && sed grep local cd
+	x=1 'quoted text' | test x=1 'quoted text' test awk
+grep 'quoted text' echo $(pwd)
+	printf echo printf done local /usr/bin echo --verbose sed
+		printf /usr/bin local ${HOME}
+	awk test grep then "$1" | -eu "$1" sed 'quoted text'
+echo echo sed 2>/dev/null cd export $(pwd) readonly local | $(pwd) cd export
+test -eu done then sed test ${HOME} readonly
+	local awk cd -eu && /usr/bin x=1
+	sed then readonly done ${HOME} done 'quoted text' | local 2>/dev/null
+echo done /usr/bin x=1
+		export awk "$1" "$@" readonly 2>/dev/null done |
+		&& "$1" | local | -eu $(pwd) done | sed 2>/dev/null
+"$@" local && local test printf /usr/bin /usr/bin | | then
+'quoted text' 'quoted text' cd local local && 2>/dev/null
+'quoted text' $(pwd) x=1 x=1 echo && readonly ${HOME}
+		sed echo x=1 echo done "$@" x=1 local grep sed
+$(pwd) $(pwd) 'quoted text' $(pwd) done 2>/dev/null ${HOME} echo readonly "$1"
+--verbose | sed sed test local "$1" done then then -eu readonly
+cd | then test test --verbose
+		'quoted text' test readonly then awk sed grep ${HOME} -eu ${HOME} ${HOME} "$@"
+	$(pwd) 2>/dev/null sed x=1 /usr/bin 2>/dev/null
+		sed "$1" | x=1 printf local 'quoted text'
+	/usr/bin readonly export
+	awk "$@" $(pwd) sed && grep readonly then /usr/bin
+		/usr/bin readonly /usr/bin --verbose
+	cd $(pwd) readonly readonly ${HOME} x=1 -eu --verbose
+${HOME} export && /usr/bin sed | sed
+		&& export cd grep "$1" sed $(pwd) "$1" export printf then export sed ${HOME}
+		'quoted text' export -eu printf && $(pwd) 'quoted text' "$1" "$@" cd done
+local printf 2>/dev/null printf readonly
+"$@" /usr/bin cd 2>/dev/null "$1" cd && && | -eu awk test 'quoted text' $(pwd)
+		'quoted text' ${HOME} 'quoted text' sed --verbose local && test
+	cd 'quoted text' export --verbose then awk "$@" grep
+		--verbose then then 'quoted text'
+-eu $(pwd) local done awk local awk echo awk then && done /usr/bin x=1 x=1
+export && "$1" then 'quoted text'
+		test 2>/dev/null sed echo /usr/bin printf local | ${HOME} x=1 ${HOME} 'quoted text'
+done then $(pwd) done -eu printf -eu readonly export local done echo 2>/dev/null
+	/usr/bin then local then
+	'quoted text' "$1" printf printf local grep export
+cd readonly 'quoted text' done echo test 'quoted text' grep
+	/usr/bin sed then ${HOME} 'quoted text' export test -eu awk "$@" && test
+	&& $(pwd) then --verbose --verbose grep awk cd ${HOME} "$1" awk $(pwd) 'quoted text'
+		echo ${HOME} readonly 2>/dev/null grep /usr/bin printf
+		"$@" ${HOME} $(pwd) 'quoted text' --verbose cd /usr/bin grep
+"$@" readonly /usr/bin export sed grep grep sed
+-eu echo echo printf x=1 $(pwd) | local x=1 2>/dev/null 2>/dev/null readonly
+		then 'quoted text' test ${HOME} --verbose printf cd awk --verbose $(pwd)
+--verbose awk "$@" "$@" $(pwd)
+	sed /usr/bin $(pwd) export grep cd cd ${HOME} 2>/dev/null done
+		&& sed test test then awk 'quoted text' ${HOME} 2>/dev/null | --verbose | | done
+		&& ${HOME} readonly grep sed ${HOME} local && awk $(pwd) $(pwd) "$1"
+x=1 && grep ${HOME} $(pwd) x=1 /usr/bin 2>/dev/null 2>/dev/null grep && sed "$1"
+		export awk then -eu && /usr/bin readonly 2>/dev/null
+		export x=1 test -eu "$1" cd echo 2>/dev/null test
+		local cd && readonly printf readonly awk then done awk
+		local 'quoted text' x=1 "$@" 'quoted text'
+		&& local printf /usr/bin 2>/dev/null
+/usr/bin && 2>/dev/null local then /usr/bin --verbose then
+	test /usr/bin printf awk "$1" "$1"
+	readonly --verbose -eu
+		| done readonly test then sed test "$1" --verbose cd $(pwd) readonly
+	'quoted text' 'quoted text' then readonly done
+		awk printf then export sed ${HOME} readonly echo -eu "$1" grep /usr/bin "$1" |
+x=1 grep -eu /usr/bin /usr/bin grep awk --verbose 'quoted text' 'quoted text'
+$(pwd) done printf cd export x=1
+"$@" -eu local | echo | $(pwd) "$1" cd sed && awk
+"$@" grep | --verbose then cd 2>/dev/null then echo && 'quoted text' awk
+	&& grep echo awk sed echo readonly
+		local grep then test then | $(pwd) 2>/dev/null readonly cd 'quoted text' sed
+then export echo 2>/dev/null sed /usr/bin echo -eu && && grep printf 'quoted text'
+	done 2>/dev/null $(pwd) $(pwd) test -eu -eu echo grep printf grep
+export cd /usr/bin sed 'quoted text' /usr/bin
+	printf "$@" awk ${HOME} awk "$@" readonly echo local
+-eu export export local cd local
+		grep then /usr/bin x=1 sed --verbose
+2>/dev/null ${HOME} && x=1 2>/dev/null $(pwd)
+	x=1 grep 2>/dev/null 'quoted text' local x=1 ${HOME} then test test ${HOME}
+	awk sed test echo test test $(pwd) /usr/bin printf
+	done "$1" readonly /usr/bin readonly
+'quoted text' test /usr/bin $(pwd)
+		export 2>/dev/null grep grep readonly "$1" readonly x=1 x=1 -eu printf /usr/bin
+	test "$1" grep /usr/bin 2>/dev/null | printf
+		printf ${HOME} local "$@" cd 2>/dev/null && && echo done "$1" 'quoted text'
+&& export readonly && -eu ${HOME} $(pwd) "$@" printf cd then
+	| "$@" --verbose test 2>/dev/null local
+	then cd readonly && sed
+	'quoted text' --verbose 2>/dev/null "$@" awk sed done printf /usr/bin
+		2>/dev/null --verbose echo test x=1
+--verbose -eu 2>/dev/null echo /usr/bin 'quoted text' "$1" x=1 'quoted text' &&
+printf 2>/dev/null --verbose -eu cd awk && cd ${HOME} readonly
+	local cd done cd "$1" done local readonly grep then local
+		grep grep sed then test --verbose 'quoted text'
+	printf export 'quoted text' done cd sed x=1 export "$@"
+done done /usr/bin grep 'quoted text' readonly
+2>/dev/null | 'quoted text' /usr/bin "$@" $(pwd) "$@" cd
+printf awk cd -eu readonly --verbose
+	done export readonly sed "$@" echo grep sed grep
+		"$1" sed sed grep cd done grep readonly /usr/bin /usr/bin printf --verbose |
+done readonly -eu /usr/bin echo printf echo done ${HOME} grep 'quoted text'
+	'quoted text' done x=1 then test 'quoted text' "$@" cd
+		sed $(pwd) done ${HOME} -eu "$@" && 'quoted text' awk --verbose local
+		&& /usr/bin test /usr/bin
+		then x=1 --verbose 'quoted text' "$1" x=1 cd then ${HOME} test done
+	printf export 2>/dev/null "$1" test "$1" export grep 2>/dev/null
+	| done done cd -eu && $(pwd) then then awk printf && test 2>/dev/null
+"$@" 'quoted text' awk x=1
+		local -eu 2>/dev/null test "$1" done sed
+local readonly test x=1
+$(pwd) 'quoted text' test done done readonly test
+	test printf x=1 awk awk
+	'quoted text' sed ${HOME} local local "$1" cd | -eu x=1 echo local
+	printf then -eu "$1" printf echo awk "$@" $(pwd)
+	sed && grep /usr/bin $(pwd) export local awk | -eu /usr/bin
+		/usr/bin 'quoted text'
+"$@" sed readonly echo test sed x=1 /usr/bin cd --verbose "$1" cd export x=1 2>/dev/null
+		sed cd export "$@" grep x=1 local 'quoted text'
+		export | then /usr/bin cd && grep sed cd printf x=1 | 2>/dev/null
+		$(pwd) readonly ${HOME} && test then ${HOME} "$1" | then local test
+--verbose 2>/dev/null grep ${HOME} $(pwd) $(pwd) then test 2>/dev/null $(pwd) --verbose
+	export awk cd "$@" "$@" sed --verbose | "$@"
+	"$1" && printf "$@" --verbose echo echo 2>/dev/null
+	local "$@" ${HOME} test test echo 2>/dev/null
+	echo 2>/dev/null printf "$@" export
+'quoted text' then | cd cd x=1 awk 2>/dev/null done ${HOME} &&
+	test "$1" /usr/bin sed then /usr/bin /usr/bin x=1 test
+	grep $(pwd) then /usr/bin 2>/dev/null sed ${HOME} x=1 awk readonly
+		| $(pwd) && then printf
+printf | awk $(pwd) then x=1 printf ${HOME} ${HOME} done echo
+		2>/dev/null "$1" && then printf | export
+		awk $(pwd) --verbose printf 'quoted text' && sed 2>/dev/null grep readonly --verbose
+		| | awk | printf export 'quoted text' local
+grep 2>/dev/null test readonly "$@" "$@" printf && test printf printf
+local sed "$1" | 'quoted text' ${HOME}
+		| echo 'quoted text' 2>/dev/null | | echo awk awk -eu | local
+		printf "$1" readonly grep "$1"
+	grep ${HOME} grep grep "$@" | "$1" grep ${HOME} done x=1 local test local printf
+	printf "$@" --verbose echo test
+		printf ${HOME} | test readonly
+		2>/dev/null 2>/dev/null printf -eu "$1" test /usr/bin /usr/bin
+		| readonly | echo grep $(pwd) 'quoted text' && printf &&
+-eu then grep export ${HOME}
+	| export done local --verbose grep cd --verbose $(pwd) done
+		grep ${HOME} /usr/bin /usr/bin
+"$1" test cd "$@" && $(pwd) "$@" && awk done done --verbose grep export echo awk
+&& printf test awk /usr/bin readonly export | /usr/bin | 'quoted text'
+echo cd | awk then readonly | "$@" awk | --verbose --verbose sed
+	--verbose cd | local /usr/bin "$@" then | grep |
+x=1 readonly $(pwd) sed grep --verbose 2>/dev/null then printf
+		grep sed 2>/dev/null local | ${HOME} $(pwd) test
+		${HOME} "$1" grep then
+${HOME} sed --verbose test 2>/dev/null 2>/dev/null
+		readonly readonly ${HOME} echo then 'quoted text' ${HOME}
+	-eu x=1 2>/dev/null "$@" grep grep grep --verbose awk "$@" 'quoted text'
+	then $(pwd) -eu ${HOME} -eu -eu test echo -eu readonly "$1" sed -eu awk sed echo
+	${HOME} 2>/dev/null cd printf awk
+test sed grep | export export grep ${HOME} "$1" printf grep 'quoted text'
+awk grep /usr/bin "$1" /usr/bin export x=1 awk
+		local readonly | --verbose sed 2>/dev/null
+		then export 2>/dev/null 'quoted text' 'quoted text' sed ${HOME}
+readonly $(pwd) /usr/bin local 2>/dev/null echo local echo
+-eu /usr/bin | sed 'quoted text' $(pwd) /usr/bin --verbose | $(pwd)
+$(pwd) 2>/dev/null readonly awk "$@" /usr/bin ${HOME} ${HOME} local
+	local $(pwd) awk export && 2>/dev/null
+	-eu local test x=1 2>/dev/null sed ${HOME} | && x=1 $(pwd)
+		${HOME} done ${HOME} awk grep -eu $(pwd) cd sed cd -eu 'quoted text'
+		-eu "$1" echo ${HOME} sed test done | ${HOME} $(pwd) | "$1" echo then test 'quoted text'
+	local test test echo cd "$1" done | cd "$1" "$1" x=1 export && x=1
+-eu -eu 2>/dev/null | ${HOME} cd x=1 "$@"
+		&& | 'quoted text' test done
+		$(pwd) 'quoted text' $(pwd) "$@" /usr/bin export then -eu
+		$(pwd) readonly 2>/dev/null "$@" export local x=1
+		grep done sed echo -eu 2>/dev/null grep --verbose
+export /usr/bin /usr/bin 2>/dev/null -eu 2>/dev/null
+'quoted text' then x=1 && awk then x=1 done 'quoted text'
+${HOME} 2>/dev/null ${HOME} | grep 2>/dev/null
+		sed export awk --verbose export done awk
+	${HOME} | grep 2>/dev/null sed
+/usr/bin -eu done awk --verbose awk cd grep $(pwd) readonly echo sed
+		-eu && printf $(pwd) ${HOME} 'quoted text' readonly done readonly ${HOME} ${HOME}
+		export test awk ${HOME} sed local readonly printf && /usr/bin
+	&& 'quoted text' $(pwd) && test export cd && -eu grep local local
+		"$@" --verbose 2>/dev/null -eu
+local && sed then printf awk 'quoted text' done /usr/bin awk echo 'quoted text'
+&& -eu $(pwd) sed $(pwd) "$1"
+done cd printf sed "$1" --verbose /usr/bin echo
+	awk echo "$1" --verbose awk "$@" | done x=1 --verbose local then echo echo
+	done 'quoted text' 'quoted text'
+	${HOME} -eu $(pwd) echo && | "$1" --verbose
+	readonly done awk echo then echo "$@" 'quoted text' echo export readonly sed
+then readonly /usr/bin "$@" printf grep done $(pwd) 'quoted text' /usr/bin
+done | && $(pwd) --verbose /usr/bin && "$1" x=1 --verbose
+		| grep /usr/bin local done grep test local | $(pwd) -eu awk $(pwd) x=1 | && echo
+	then local x=1 -eu sed 'quoted text' export "$1" test then test
+2>/dev/null "$1" cd "$1"
+		done 2>/dev/null awk 2>/dev/null
+	printf export then cd cd && printf cd readonly
+"$@" echo | 'quoted text' cd | echo then && ${HOME} grep
+		${HOME} -eu x=1 awk | | cd 2>/dev/null test x=1 awk --verbose "$1" -eu --verbose
+	/usr/bin "$1" sed 2>/dev/null echo grep "$@" | then
+	cd "$1" "$@" $(pwd) /usr/bin "$1"
+	$(pwd) $(pwd) ${HOME} cd "$@" --verbose ${HOME} /usr/bin sed 'quoted text'
+	local -eu ${HOME} export test printf 'quoted text' sed test
+		'quoted text' test | && readonly export readonly
+	&& awk --verbose echo --verbose export echo
+awk x=1 | --verbose && 2>/dev/null /usr/bin x=1
+		| $(pwd) "$1" x=1 local 'quoted text' local 'quoted text'
+&& 2>/dev/null ${HOME} | $(pwd) && 'quoted text'
+	awk echo ${HOME} local
+	test printf | grep && 'quoted text' printf test 'quoted text'
+		local printf awk printf ${HOME} /usr/bin local then
+	readonly done $(pwd) local
+		local grep x=1 then awk | grep test
+	x=1 x=1 printf test ${HOME} grep echo awk
+export awk export -eu 'quoted text' 2>/dev/null ${HOME}
+"$1" awk ${HOME} cd --verbose x=1 done done
+		cd | awk --verbose --verbose $(pwd) x=1 && "$1"
+	/usr/bin readonly done &&
+${HOME} awk test test readonly then
+	--verbose "$1" x=1 "$1" sed test x=1 && printf "$@" $(pwd)
+		echo done test ${HOME} && echo then ${HOME} cd | test 2>/dev/null
+		"$@" local local awk grep test && | && export
+		printf export export 'quoted text' -eu $(pwd) 'quoted text' -eu "$@"
+	readonly then /usr/bin $(pwd)
+	| grep local cd 2>/dev/null then awk
+	sed then $(pwd) echo "$@" local then local
+	export 'quoted text' local test cd $(pwd) -eu
+		printf grep awk sed "$1" 'quoted text' && done grep grep
+		/usr/bin export awk -eu cd done && echo test awk 2>/dev/null printf && |
+	echo local echo 2>/dev/null
+		test printf --verbose -eu done $(pwd) | 'quoted text'
+		printf ${HOME} "$1" x=1 'quoted text' && x=1 local
+echo | local printf $(pwd)
+	'quoted text' "$@" "$1" --verbose | local sed printf x=1 --verbose
+printf ${HOME} test /usr/bin | |
+	sed "$@" "$1" export 'quoted text' printf done 2>/dev/null
+	sed cd readonly | 2>/dev/null test "$1" done test awk "$1" -eu grep
+echo ${HOME} readonly 2>/dev/null 2>/dev/null /usr/bin done /usr/bin local then
+sed export 2>/dev/null awk 2>/dev/null "$@" local -eu export --verbose
+x=1 sed awk "$1" local
+	local -eu --verbose "$@" grep then -eu 2>/dev/null
+		sed awk export test grep readonly $(pwd) then grep test cd readonly cd
+	awk --verbose echo "$1" then sed
+		2>/dev/null grep test && readonly
+	awk $(pwd) awk done ${HOME} echo /usr/bin test echo echo
+--verbose ${HOME} export -eu | cd -eu "$@" grep "$1" | "$@" --verbose -eu && sed
+awk /usr/bin readonly "$@" grep | then "$1" done --verbose sed
+--verbose && done echo $(pwd) printf
+		grep 'quoted text' 2>/dev/null
+"$1" 2>/dev/null --verbose done --verbose
+		awk 2>/dev/null && ${HOME} cd --verbose local -eu then ${HOME}
+${HOME} ${HOME} 2>/dev/null
+$(pwd) 2>/dev/null x=1 done readonly && ${HOME} 2>/dev/null
+${HOME} && --verbose | grep 2>/dev/null "$@" x=1 "$1" ${HOME} "$1" 'quoted text'
+		printf $(pwd) | "$@" 'quoted text'
+done "$@" $(pwd) cd $(pwd) printf
+	printf cd export && done /usr/bin && cd 'quoted text' -eu -eu
+then ${HOME} done x=1 -eu 2>/dev/null sed
+		awk ${HOME} -eu sed --verbose local awk
+		${HOME} -eu --verbose 'quoted text' grep export cd && local
+	grep printf 'quoted text' | local 'quoted text' cd x=1 | x=1 --verbose
+		done grep export $(pwd) | export "$1" "$1" echo
+test echo | echo printf then awk "$@" local $(pwd) "$@" ${HOME}
+		cd --verbose test echo --verbose $(pwd)
+--verbose | -eu "$1"
+	grep x=1 && /usr/bin test local grep cd then /usr/bin
+	local 'quoted text' awk printf
+awk then "$1" /usr/bin cd local "$@" && readonly 2>/dev/null
+		grep -eu readonly x=1 grep $(pwd) done then | grep ${HOME}
+grep done printf ${HOME}
+	&& printf "$1" printf echo --verbose x=1 cd
+'quoted text' ${HOME} 'quoted text'
+sed sed done --verbose $(pwd)
+awk export cd -eu /usr/bin /usr/bin --verbose awk ${HOME} 2>/dev/null
+	"$@" sed awk awk printf --verbose
+${HOME} && /usr/bin /usr/bin --verbose awk -eu 2>/dev/null ${HOME} test
+	cd sed local --verbose done --verbose
+		sed --verbose 'quoted text' "$1" 'quoted text' --verbose sed
+		x=1 printf 'quoted text' | grep test -eu done echo sed
+	$(pwd) "$1" --verbose ${HOME} -eu 2>/dev/null local printf && done test $(pwd)
+cd 2>/dev/null -eu cd x=1 x=1 "$@" done "$1" echo printf sed $(pwd) cd cd
+	"$1" 'quoted text' echo test
+'quoted text' $(pwd) test $(pwd) $(pwd) $(pwd) cd $(pwd) | grep $(pwd)
+		"$@" "$@" 'quoted text' sed x=1 "$@" /usr/bin awk
+		readonly printf ${HOME} local
+	"$1" /usr/bin test "$1" ${HOME} ${HOME} local 2>/dev/null awk
+	| ${HOME} grep local 'quoted text' grep readonly $(pwd) "$@" $(pwd)
+		| local 'quoted text' local 2>/dev/null "$1" && $(pwd)
+--verbose --verbose x=1 test grep && | grep local
+		x=1 -eu export | ${HOME} --verbose
+	sed && 2>/dev/null x=1 $(pwd) readonly echo then 'quoted text'
+local echo export -eu $(pwd) 2>/dev/null
+		local cd $(pwd) export test $(pwd) 'quoted text' done awk sed 2>/dev/null
+	readonly test local awk printf
+echo grep -eu then readonly printf $(pwd) | grep sed 'quoted text'
+then done $(pwd) awk done ${HOME} && ${HOME} export echo
+		local /usr/bin /usr/bin x=1 --verbose --verbose then echo sed x=1 test
+		local awk printf echo "$1" sed export --verbose 'quoted text'
+	${HOME} test cd printf done cd then awk test
+local /usr/bin done && 'quoted text' test -eu grep printf && done
+x=1 then 'quoted text' /usr/bin test 2>/dev/null /usr/bin export awk "$@" $(pwd)
+-eu | then --verbose grep then -eu 2>/dev/null test test grep
+"$1" 2>/dev/null "$1" awk readonly "$1" grep test local
+		local awk sed --verbose readonly --verbose done "$1" | && ${HOME} grep 2>/dev/null
+awk --verbose echo 2>/dev/null done local echo x=1 done local then printf
+printf x=1 "$@" local local sed 'quoted text' grep 'quoted text'
+		grep grep | x=1 local printf grep local && ${HOME} cd ${HOME} printf readonly
+"$@" readonly $(pwd) awk $(pwd) ${HOME}
+echo readonly x=1 "$1" && "$@" echo -eu "$@"
+--verbose "$1" echo /usr/bin ${HOME} --verbose sed test local echo --verbose
+	echo done test echo "$@" grep readonly echo | -eu then | "$@" $(pwd)
+		x=1 /usr/bin test cd cd cd readonly
+cd 'quoted text' cd x=1 | ${HOME} --verbose printf sed done
+		-eu cd 2>/dev/null then 2>/dev/null
+$(pwd) echo readonly test && cd cd "$1" 2>/dev/null $(pwd)
+	cd 2>/dev/null $(pwd) | ${HOME} awk --verbose done
+"$@" 2>/dev/null | sed grep &&
+		$(pwd) x=1 $(pwd) --verbose done then && &&
+-eu | "$1" /usr/bin --verbose | x=1 local cd echo 'quoted text'
+	grep export readonly printf 'quoted text'
+	echo sed then | -eu | sed then readonly echo
+sed readonly sed awk echo local && && sed "$@" 'quoted text' done "$@" "$1" local
+test then | $(pwd) -eu readonly printf local ${HOME}
+	--verbose cd x=1 2>/dev/null then x=1 /usr/bin then
+	x=1 export "$@" export cd test /usr/bin readonly
+		local "$1" then cd sed then sed readonly sed grep awk ${HOME} /usr/bin /usr/bin
+		--verbose "$@" "$@" local then "$@" test then
+		/usr/bin awk export local
+| && sed ${HOME} sed sed
+x=1 export 'quoted text' grep -eu grep --verbose printf then sed ${HOME} /usr/bin
+sed local 'quoted text' then readonly printf --verbose 'quoted text'
+		"$@" printf test awk -eu "$1" x=1 --verbose
+	cd $(pwd) then | then cd "$1" sed 2>/dev/null
+	2>/dev/null awk | export $(pwd) -eu /usr/bin test && "$1" 'quoted text'
+	done printf | 2>/dev/null ${HOME} done "$@" && -eu readonly
+x=1 test "$@" done ${HOME} --verbose ${HOME} ${HOME} readonly awk echo 'quoted text'
+	readonly "$@" cd sed local ${HOME} --verbose
+	cd -eu sed /usr/bin x=1 grep $(pwd) cd printf export awk cd x=1 $(pwd)
+		x=1 && export /usr/bin echo local -eu -eu 'quoted text' x=1
+		local "$1" && done /usr/bin 'quoted text' local local --verbose $(pwd) echo --verbose
+		echo "$1" "$1" --verbose "$@" "$@" sed echo local
+/usr/bin done "$@" "$@"
+	2>/dev/null ${HOME} echo then $(pwd)
+printf ${HOME} "$1" echo /usr/bin
+		cd -eu export 'quoted text' | -eu --verbose local x=1
+${HOME} grep | x=1 then 'quoted text' | export then x=1
+echo $(pwd) cd -eu ${HOME} done && printf "$@" export grep done done "$@"
+'quoted text' readonly -eu
+printf awk "$1" && "$@" readonly /usr/bin --verbose grep | test grep cd
+	then x=1 && $(pwd) ${HOME} printf 'quoted text'
+	done test printf --verbose | 'quoted text' 2>/dev/null local local test cd printf
+	cd --verbose && local 2>/dev/null "$1" cd ${HOME} /usr/bin ${HOME} done
+x=1 sed /usr/bin awk $(pwd) readonly "$1" awk "$@" 2>/dev/null
+		&& --verbose printf |
+		/usr/bin export -eu echo $(pwd) export export -eu grep local && --verbose
+	'quoted text' $(pwd) 'quoted text'
+		x=1 2>/dev/null $(pwd) awk printf cd sed done 2>/dev/null && --verbose readonly
+		$(pwd) readonly echo "$@" && awk test done
+		sed echo sed awk --verbose | sed
+		awk test 'quoted text' grep grep export test printf readonly
+	cd then readonly "$@" export $(pwd) -eu sed grep export $(pwd)
+		local "$1" "$@" then ${HOME} 'quoted text' $(pwd) /usr/bin awk readonly
+	2>/dev/null export | cd -eu cd | done 2>/dev/null test done
+		then readonly local cd ${HOME} ${HOME} grep -eu x=1 "$@" export --verbose
+		then $(pwd) "$@" export x=1
+		then then sed awk export $(pwd) test local readonly
+	&& && x=1 sed --verbose 2>/dev/null 'quoted text' printf cd -eu cd awk
+readonly readonly echo grep -eu test $(pwd)
+	awk local then 'quoted text'
+	$(pwd) "$@" test 2>/dev/null test "$@"
+		--verbose grep ${HOME}
+cd --verbose 2>/dev/null | export && export export ${HOME} test grep | | readonly
+done && awk "$@" local && done printf done
+"$1" done "$1" "$1" done 'quoted text' && 2>/dev/null then echo local
+'quoted text' then readonly "$1"
+	sed $(pwd) done test -eu grep awk readonly printf -eu export sed local
+| local done 2>/dev/null then --verbose local &&
+		$(pwd) ${HOME} test | grep 2>/dev/null 2>/dev/null ${HOME}
+x=1 $(pwd) awk then cd readonly &&
+		test | $(pwd) grep readonly
+		&& 'quoted text' x=1 cd "$@" done
+	then echo 'quoted text' ${HOME} echo
+		"$1" then && /usr/bin awk /usr/bin
+		2>/dev/null grep "$1" --verbose x=1 x=1 "$@" 'quoted text' 2>/dev/null
+		$(pwd) sed local done "$@" "$@" && export export
+2>/dev/null --verbose $(pwd) "$@" done done $(pwd) echo
+export --verbose --verbose local readonly cd test | "$@"
+x=1 'quoted text' x=1 echo cd -eu -eu "$1" "$@" -eu "$@" local
+		grep "$1" 2>/dev/null export sed /usr/bin sed printf | 2>/dev/null
+		readonly "$@" | "$1" && export x=1 && ${HOME} | x=1 | test "$1" /usr/bin
+test "$1" local ${HOME} export /usr/bin sed $(pwd) export local && $(pwd) sed
+then "$@" && -eu printf | then printf printf
+		test test export ${HOME} printf 'quoted text' | then then test awk awk awk printf
+	cd readonly local x=1 printf ${HOME} --verbose test grep | export grep $(pwd)
+--verbose echo $(pwd) | $(pwd) 'quoted text' 'quoted text'
+	readonly awk then export x=1 readonly export echo ${HOME} sed done --verbose
+		/usr/bin sed export "$1" readonly && && 'quoted text' awk local "$@" ${HOME}
+		printf then $(pwd) "$@" then --verbose done "$1" $(pwd) 2>/dev/null
+		awk sed sed echo 'quoted text' --verbose
+local awk ${HOME} -eu test printf printf echo | grep 2>/dev/null "$1" cd grep then
+	"$@" grep printf done "$1" local /usr/bin
+	&& readonly test export 'quoted text' "$@" cd done printf export readonly
+		${HOME} sed | echo echo -eu /usr/bin
+	grep test then /usr/bin | -eu export
+		local grep "$1" $(pwd) printf cd
+echo ${HOME} test readonly x=1 done grep /usr/bin -eu $(pwd) readonly
+	awk "$1" /usr/bin printf ${HOME} -eu awk test readonly done
+		"$@" test printf 'quoted text' local 2>/dev/null
+		x=1 'quoted text' $(pwd) done /usr/bin local x=1 --verbose grep 2>/dev/null
+		done | echo 'quoted text' then "$@" echo readonly grep
+sed "$1" && done sed awk | 2>/dev/null | cd x=1 "$@" printf
+	| test awk export cd --verbose
+		then x=1 $(pwd) printf awk readonly --verbose
+sed cd done x=1 --verbose test $(pwd) | cd test
+	&& readonly x=1 'quoted text' local printf --verbose echo export 'quoted text'
+	-eu ${HOME} printf "$1"
+	/usr/bin printf "$@" cd /usr/bin echo
+$(pwd) 2>/dev/null awk then
+grep readonly 'quoted text' x=1 && grep x=1 grep $(pwd) printf echo --verbose echo
+	$(pwd) $(pwd) && sed then printf 2>/dev/null |
+	test "$1" printf 'quoted text'
+		local && local awk echo 'quoted text' -eu "$@" grep -eu grep
+export | sed && | "$1" test awk -eu $(pwd)
+		$(pwd) -eu then 'quoted text'
+		| "$@" | /usr/bin --verbose done grep printf test awk /usr/bin ${HOME}
+"$@" "$1" grep done then then test echo --verbose x=1 | done 2>/dev/null
+		&& 'quoted text' printf | 'quoted text' grep "$1" ${HOME}
+		"$@" test readonly echo cd sed 'quoted text'
+-eu 2>/dev/null "$1" export
+		grep x=1 --verbose export
+		--verbose -eu -eu echo
+cd echo "$@" | -eu $(pwd) $(pwd)
+	$(pwd) 2>/dev/null cd 2>/dev/null 'quoted text' "$1" sed "$@" |
+		${HOME} export && $(pwd) x=1 echo "$1" grep local test export | -eu cd local ${HOME}
+		echo x=1 test echo && grep echo readonly cd sed | printf | -eu test local x=1
+	${HOME} done 2>/dev/null then awk x=1 printf
+		"$1" export "$@" | | $(pwd) local printf "$@" --verbose "$@" && 'quoted text'
+		local x=1 grep $(pwd) x=1 -eu local
+		| 'quoted text' 'quoted text'
+		&& printf --verbose "$1" local echo test "$@" | awk 2>/dev/null test
+		cd --verbose "$1" echo echo ${HOME} then 2>/dev/null readonly | then "$1"
+$(pwd) ${HOME} "$@" && test 'quoted text' done "$@" export awk sed
+echo --verbose x=1 readonly -eu ${HOME} grep awk $(pwd) /usr/bin /usr/bin
+&& | grep echo printf awk x=1 ${HOME} | done test local local
+	echo printf /usr/bin grep
+cd export 2>/dev/null ${HOME} x=1 then "$@" awk done grep $(pwd) /usr/bin
+'quoted text' grep 'quoted text'
+--verbose "$1" "$@" sed "$@" && local x=1 "$@" export local export
+	$(pwd) ${HOME} --verbose && "$1" sed "$@"
+	--verbose $(pwd) done && ${HOME} printf x=1
+		$(pwd) done echo local cd "$@" $(pwd) 'quoted text' --verbose
+		export test 2>/dev/null then
+		sed 'quoted text' 'quoted text' x=1 && /usr/bin &&
+"$@" | | local /usr/bin "$@" 'quoted text' sed x=1
+readonly then test | x=1 then 'quoted text'
+	-eu sed /usr/bin && ${HOME} "$@" "$1" grep then awk $(pwd)
+		local echo sed /usr/bin echo sed grep | test x=1 /usr/bin "$1" $(pwd) export
+		x=1 && grep /usr/bin cd ${HOME} "$1" export readonly "$@" ${HOME}
+2>/dev/null /usr/bin grep "$1" done $(pwd) && -eu test && /usr/bin
+	cd sed | "$1" then x=1 -eu 'quoted text' test test cd 'quoted text' -eu export
+		-eu && then local --verbose awk x=1
+export "$1" local echo 'quoted text' && 2>/dev/null test
+${HOME} 2>/dev/null test grep printf echo 2>/dev/null grep done printf grep "$@"
+echo done readonly "$1" | echo printf /usr/bin sed && export sed
+grep cd cd --verbose local export awk sed sed readonly cd 'quoted text'
+&& local --verbose x=1
+--verbose --verbose test ${HOME} awk "$1" grep
+then grep test test echo echo -eu -eu echo export -eu | grep ${HOME} x=1 export
+printf -eu export local awk ${HOME}
+readonly then ${HOME} /usr/bin export readonly printf test --verbose $(pwd)
+awk -eu --verbose printf sed --verbose then echo
+awk cd then sed /usr/bin /usr/bin
+		sed -eu $(pwd) printf ${HOME} export 2>/dev/null
+		--verbose | cd ${HOME} -eu printf awk then | $(pwd) echo grep then
+	/usr/bin readonly test | printf test
+	'quoted text' done then done sed
+sed x=1 cd echo grep && then
+		| /usr/bin 2>/dev/null then printf export then
+awk sed sed grep -eu export x=1
+		printf 2>/dev/null echo local /usr/bin cd $(pwd) grep ${HOME} x=1
+export echo /usr/bin cd 2>/dev/null | grep $(pwd)
+	cd ${HOME} sed "$@" --verbose | done
+done sed $(pwd) export local 2>/dev/null
+		done grep --verbose ${HOME} --verbose
+$(pwd) x=1 grep readonly ${HOME} echo done
+		| "$1" 'quoted text' echo
+cd /usr/bin cd then && $(pwd) | && /usr/bin readonly && ${HOME} sed readonly
+		readonly then cd echo echo "$1" cd 'quoted text' 'quoted text' ${HOME}
+${HOME} /usr/bin "$@" 2>/dev/null export
+&& readonly $(pwd) /usr/bin $(pwd)
+		x=1 test export done echo sed printf sed ${HOME} test ${HOME} printf $(pwd)
+		| grep /usr/bin --verbose printf /usr/bin export local && local x=1 --verbose
+test 2>/dev/null x=1 --verbose 2>/dev/null | cd done /usr/bin
+		readonly 'quoted text' 'quoted text' && -eu echo readonly 'quoted text'
+-eu 'quoted text' 'quoted text' "$@" readonly x=1 sed echo 2>/dev/null
+	then test -eu 2>/dev/null "$1" echo -eu -eu test 2>/dev/null
+-eu then cd "$1" export printf $(pwd) --verbose $(pwd) awk sed x=1
+	awk echo done printf local sed grep export "$1"
+		| -eu awk printf readonly -eu then
+then grep && /usr/bin /usr/bin
+	test --verbose -eu && -eu readonly awk grep x=1 && grep x=1 "$1" done test
+	export 2>/dev/null $(pwd) test && then $(pwd) export 2>/dev/null
+		2>/dev/null done sed done
+	"$@" x=1 printf done grep && 'quoted text'
+		sed /usr/bin readonly sed -eu --verbose
+	echo "$@" 2>/dev/null 'quoted text'
+		--verbose 'quoted text'
+		sed | && "$1" ${HOME} | cd
+"$@" "$@" -eu done printf ${HOME} cd -eu -eu export
+		local awk ${HOME} -eu awk test grep /usr/bin cd done cd ${HOME} $(pwd)
+	awk echo "$1" $(pwd) ${HOME} then export export cd local -eu -eu readonly sed -eu
+"$@" /usr/bin test ${HOME} -eu readonly | "$@" 2>/dev/null awk "$@" $(pwd) "$@"
+		${HOME} && 2>/dev/null x=1 echo readonly 2>/dev/null awk grep $(pwd)
+		&& 'quoted text' awk awk 2>/dev/null printf printf 'quoted text' --verbose $(pwd)
+	&& printf readonly done then printf sed | && awk -eu printf
+grep readonly export | 'quoted text' done
+&& 'quoted text' x=1 /usr/bin sed
+export 'quoted text' test grep "$1" ${HOME} ${HOME} printf cd
+printf grep 'quoted text' readonly grep 'quoted text' cd
+	--verbose done --verbose cd printf
+$(pwd) export --verbose done readonly cd readonly cd done then "$1" 'quoted text'
+test cd done printf "$1" --verbose local $(pwd) grep "$1"
+	"$1" readonly x=1 readonly local printf | test x=1
+	"$@" -eu ${HOME} x=1 then export "$@"
+	/usr/bin | printf export /usr/bin
+		echo local awk -eu grep then "$1"
+		${HOME} x=1 grep "$@" x=1 echo --verbose
+	cd cd "$@" local test awk "$1" test test export local grep awk sed | test
+		local -eu done readonly
+		export | done local echo 'quoted text'
+		export readonly ${HOME} grep /usr/bin /usr/bin cd awk 2>/dev/null export
+local | | sed | local "$1" 'quoted text' "$@" cd | awk /usr/bin done
+		&& && x=1 && /usr/bin cd 2>/dev/null cd local printf then
+	"$1" echo done readonly echo
+		awk done readonly local sed && | printf --verbose printf
+	local awk local ${HOME} test 'quoted text'
+		${HOME} local then ${HOME} 2>/dev/null
+	${HOME} done --verbose done printf done grep --verbose local && x=1 | /usr/bin
+	test then --verbose export local | && | && test test
+	&& sed $(pwd) /usr/bin cd export $(pwd) "$1" test
+	/usr/bin 'quoted text' -eu export readonly ${HOME} done
+	grep | "$1" printf | echo readonly
+	done 'quoted text' && readonly 'quoted text' | "$1" 'quoted text' cd grep 2>/dev/null
+		then export --verbose "$1" -eu ${HOME} local x=1 cd "$1" readonly 'quoted text'
+test grep "$@" | -eu grep
+		${HOME} x=1 grep "$1" readonly x=1 "$1" awk $(pwd) 2>/dev/null
+| x=1 | printf awk export echo "$@" /usr/bin readonly
+	'quoted text' then 'quoted text' cd local "$1" printf echo done 2>/dev/null -eu
+	export x=1 $(pwd) done
+$(pwd) readonly "$1" sed && 'quoted text' printf cd 'quoted text' export readonly
+	"$1" --verbose "$1" -eu /usr/bin --verbose
+		| echo printf ${HOME} awk local && done /usr/bin "$@" 'quoted text' "$@" awk
+| readonly | --verbose then $(pwd) /usr/bin local ${HOME}
+		test awk cd export awk /usr/bin
+echo sed grep grep grep $(pwd) readonly 2>/dev/null
+		test printf && x=1 && 2>/dev/null ${HOME} awk done --verbose --verbose
+		export "$1" --verbose -eu x=1 /usr/bin echo 'quoted text' echo
+| done export ${HOME} $(pwd) grep
+		"$1" 'quoted text' "$@" "$1" done "$@"
+		echo | 'quoted text' cd awk done grep -eu printf "$1"
+	x=1 ${HOME} 2>/dev/null awk
+		export export then "$@" printf
+sed sed && 'quoted text' $(pwd) grep $(pwd) $(pwd) awk export readonly readonly
+	/usr/bin test echo | | cd
+		echo x=1 x=1 && 'quoted text'
+		"$@" echo done printf local ${HOME} ${HOME} "$1" && x=1 x=1 $(pwd) cd /usr/bin
+"$1" sed 'quoted text' x=1 2>/dev/null "$1" grep test $(pwd) local printf
+		x=1 ${HOME} 2>/dev/null && && 'quoted text'
+	x=1 "$1" 2>/dev/null 2>/dev/null awk | printf grep sed printf grep --verbose
+	${HOME} -eu awk then sed done
+		--verbose printf done sed
+grep test export local sed test sed ${HOME} sed ${HOME} grep 2>/dev/null test
+	"$1" export test cd x=1 then "$1" /usr/bin done cd x=1 /usr/bin "$@" test -eu
+	"$1" "$@" local then x=1 && -eu | && readonly
+	then -eu 'quoted text' "$@" test -eu 'quoted text' cd grep local echo awk x=1 'quoted text'
+	done /usr/bin grep then | done "$@"
+	$(pwd) && readonly $(pwd) local --verbose printf x=1
+	${HOME} $(pwd) grep echo then "$1"
+		| -eu "$1" && test "$@" test done printf done done test echo --verbose
+	sed local 2>/dev/null 2>/dev/null
+		&& | export export "$@" cd | readonly | --verbose readonly
+--verbose sed then printf -eu | ${HOME} x=1 'quoted text' cd $(pwd)
+		"$1" 'quoted text' cd -eu local test 'quoted text'
+'quoted text' cd readonly awk local | echo --verbose printf
+	/usr/bin -eu grep | readonly sed cd printf "$@" test $(pwd) local 2>/dev/null
+		"$1" "$1" echo && 'quoted text' ${HOME}
+		export "$1" local && -eu "$1" local echo
+| readonly -eu -eu && ${HOME} printf &&
+| cd test /usr/bin grep -eu grep -eu "$@" grep
+		done sed test done -eu 2>/dev/null ${HOME} | 'quoted text'
+cd awk export ${HOME} test export local --verbose readonly
+done test 'quoted text' done printf awk x=1 sed echo awk ${HOME}
+	/usr/bin | 'quoted text' | test printf x=1 grep ${HOME} done
+	cd grep done | "$1" printf done -eu local
+-eu awk 'quoted text' test echo printf printf done sed && --verbose
+	| readonly ${HOME} done /usr/bin local then ${HOME} "$1" | 2>/dev/null
+		done "$1" sed test local export
+		then grep && | /usr/bin sed cd printf echo -eu -eu done 2>/dev/null "$1"
+		printf test 2>/dev/null x=1 'quoted text' "$@" --verbose /usr/bin
+done -eu "$@" echo local readonly
+2>/dev/null grep "$@" | "$@" awk done readonly echo -eu echo
+		"$1" done export "$@" then
+	${HOME} | echo && /usr/bin cd x=1 grep echo readonly
+echo 2>/dev/null x=1 $(pwd) $(pwd) $(pwd) x=1 echo sed --verbose
+	cd done local export sed "$@" export
+	$(pwd) 2>/dev/null 'quoted text' --verbose
+		test | "$@" grep printf printf
+&& then test $(pwd) --verbose done x=1 $(pwd) -eu done
+		"$1" "$@" $(pwd) awk printf
+		local $(pwd) 2>/dev/null x=1 readonly && 2>/dev/null done /usr/bin "$1" cd &&
+	"$1" test --verbose then then && x=1 2>/dev/null
+		done test ${HOME} x=1 x=1 'quoted text' local /usr/bin ${HOME}
+	&& local x=1 sed | 2>/dev/null "$1" echo readonly /usr/bin
+then echo /usr/bin "$@" x=1 grep then test cd awk
+	grep | 'quoted text' && done | sed
+	awk printf "$1" /usr/bin "$@" -eu 'quoted text'
+then cd then grep $(pwd) | -eu local --verbose test "$@" sed
+	sed 2>/dev/null done done readonly
+	awk then $(pwd) cd grep readonly done --verbose
+"$@" echo ${HOME} readonly
+		then then readonly test readonly export
+	'quoted text' /usr/bin echo | | awk echo
+	"$1" test export echo readonly done "$1" /usr/bin | /usr/bin export ${HOME} "$1"
+${HOME} -eu grep 2>/dev/null -eu 2>/dev/null
+		echo 'quoted text' awk $(pwd) -eu readonly | "$1" done
+		$(pwd) --verbose local printf "$@"
+		export "$1" then "$1" echo done | /usr/bin
+		x=1 local x=1 | readonly | done echo awk then | 'quoted text' export
+		${HOME} ${HOME} printf | && done /usr/bin local "$1" --verbose
+		-eu ${HOME} --verbose test --verbose 'quoted text' ${HOME} ${HOME} --verbose
+	| then grep 2>/dev/null then readonly --verbose 'quoted text' done --verbose
+		x=1 echo | 'quoted text' 2>/dev/null
+	sed readonly echo local echo readonly
+		/usr/bin $(pwd) export "$@" then then grep grep
+	"$@" local | --verbose
+		x=1 /usr/bin printf done "$@" 2>/dev/null && awk 2>/dev/null
+		printf 2>/dev/null && x=1 awk printf 'quoted text'
+export | export readonly | ${HOME} && done $(pwd)
+		printf -eu "$1" && "$@" -eu cd sed x=1 -eu test cd && awk
+	/usr/bin echo | 2>/dev/null export x=1 2>/dev/null && --verbose
+		local done x=1 --verbose ${HOME} export then
+		2>/dev/null then sed "$1" sed printf done | sed
+		awk 'quoted text' 2>/dev/null readonly | | "$@"
+	| grep readonly echo 2>/dev/null | test readonly sed $(pwd) | x=1 "$1"
+$(pwd) export $(pwd) 2>/dev/null $(pwd) -eu awk
+export sed x=1 awk printf readonly x=1
+		'quoted text' "$1" "$1"
+then ${HOME} "$@" x=1 printf done local grep "$@" && echo grep grep
+| test cd $(pwd) && grep done done | printf 'quoted text'
+test $(pwd) printf local ${HOME} grep echo 2>/dev/null
+		${HOME} export -eu echo /usr/bin
+"$@" printf 2>/dev/null printf
+--verbose "$1" && | test 'quoted text'
+	sed readonly then "$@" printf local 2>/dev/null $(pwd) $(pwd)
+		printf printf printf | && x=1 $(pwd) then
+	x=1 printf "$1" ${HOME} then "$1" /usr/bin
+	| $(pwd) done done awk echo $(pwd) "$1"
+	| export then -eu then /usr/bin
+		echo awk done x=1 test test | "$@" sed | 'quoted text' -eu sed --verbose then
+	/usr/bin then cd echo x=1 "$@" done printf echo export | local $(pwd) then
+		done export "$@" 'quoted text' | -eu $(pwd) grep test
+		awk 2>/dev/null test | test ${HOME} cd | local 2>/dev/null "$1" 2>/dev/null
+x=1 /usr/bin | test export
+	/usr/bin sed awk printf export grep -eu --verbose 2>/dev/null cd done &&
+		x=1 $(pwd) echo -eu awk done readonly -eu done | x=1 awk printf sed $(pwd)
+	"$1" export readonly "$1" 'quoted text' "$@"
+local "$1" test done $(pwd)
+		| cd readonly then ${HOME} test local x=1 "$1" sed $(pwd) 'quoted text'
+2>/dev/null readonly x=1 --verbose "$1" 2>/dev/null ${HOME} x=1 -eu "$@" done
+	done 'quoted text' done 2>/dev/null awk --verbose printf x=1 &&
+sed readonly | test -eu
+	awk export done /usr/bin done
+	echo 2>/dev/null sed awk x=1 "$1" ${HOME} ${HOME}
+	/usr/bin 'quoted text' $(pwd) $(pwd) done test readonly printf && --verbose
+		echo /usr/bin sed ${HOME} /usr/bin | export x=1
+	${HOME} 2>/dev/null -eu
+		| ${HOME} && echo done printf
+		| "$@" export readonly awk test grep grep echo echo cd echo echo export | -eu local
+x=1 then echo "$@" /usr/bin printf sed 2>/dev/null /usr/bin test test
+2>/dev/null 2>/dev/null /usr/bin
+	x=1 2>/dev/null -eu /usr/bin x=1 'quoted text' 'quoted text' --verbose grep
+		local echo then readonly grep /usr/bin --verbose echo /usr/bin
+		-eu "$1" printf 'quoted text' "$@" x=1 test /usr/bin
+"$@" test "$@" echo 2>/dev/null readonly export test grep "$@" "$@"
+		export $(pwd) test 2>/dev/null awk | local
+--verbose printf && | && $(pwd) $(pwd)
+	test then 'quoted text' test $(pwd) x=1 ${HOME} --verbose printf /usr/bin --verbose
+		$(pwd) local echo printf --verbose
+		local "$@" "$1" /usr/bin test "$1" done sed local
+		test | local "$1" echo $(pwd) -eu --verbose done
+	grep echo && test test awk echo cd
+then awk /usr/bin && echo readonly
+test "$1" 'quoted text' ${HOME} then | done ${HOME} cd $(pwd) grep 'quoted text'
+		echo --verbose echo grep echo done 'quoted text' 'quoted text'
+"$1" | test then x=1 /usr/bin 'quoted text' --verbose
+	-eu local x=1 'quoted text' export
+| echo local --verbose test "$1" | export export echo x=1 /usr/bin
+'quoted text' then 2>/dev/null awk grep test 'quoted text' 'quoted text'
+		$(pwd) local sed x=1 --verbose
+		| --verbose "$@" --verbose 2>/dev/null
+"$@" ${HOME} $(pwd) awk printf cd /usr/bin | sed ${HOME}
+	awk x=1 done x=1 printf 2>/dev/null
+		2>/dev/null 'quoted text' grep x=1 cd then
+readonly "$@" echo | "$@" then printf sed printf
+$(pwd) && cd && readonly | ${HOME} | readonly "$1" -eu sed export "$1"
+	awk /usr/bin grep 2>/dev/null 2>/dev/null $(pwd)
+		grep sed cd 2>/dev/null export
+local ${HOME} awk done 2>/dev/null
+	printf ${HOME} | /usr/bin ${HOME} ${HOME} echo echo done ${HOME} printf /usr/bin
+	$(pwd) "$1" awk then --verbose --verbose
+	/usr/bin echo readonly
+	--verbose test readonly awk done "$@"
+x=1 sed /usr/bin echo export readonly -eu ${HOME} printf
+	--verbose done ${HOME} grep then | | awk test awk
+	sed printf export --verbose sed | /usr/bin sed 'quoted text' export /usr/bin test
+	&& "$1" 'quoted text' test then export
+cd done echo ${HOME} /usr/bin sed export x=1 local 2>/dev/null
+then "$1" sed cd 2>/dev/null /usr/bin /usr/bin "$@" && /usr/bin
+		local ${HOME} 2>/dev/null local export $(pwd) "$1" x=1 readonly
+	done $(pwd) echo cd sed test grep test then grep && then ${HOME}
+'quoted text' sed -eu awk export --verbose "$1"
+	sed | x=1 cd x=1 -eu 2>/dev/null --verbose x=1 2>/dev/null
+then echo && "$@" && "$@" awk
+		readonly --verbose printf "$1" 2>/dev/null printf -eu then "$1" grep test echo x=1
+	export 2>/dev/null cd printf && "$1" ${HOME} 2>/dev/null
+		x=1 'quoted text' done done readonly export |
+		cd $(pwd) "$1" cd readonly local x=1 cd ${HOME} $(pwd) $(pwd) -eu ${HOME} 'quoted text'
+	-eu x=1 done sed "$1" test /usr/bin 'quoted text' x=1 awk
+		done && && printf 2>/dev/null grep && grep "$@" export "$1" sed then -eu --verbose
+done -eu local -eu | /usr/bin sed $(pwd) test
+--verbose | echo awk -eu
+	cd -eu 2>/dev/null 2>/dev/null ${HOME} test readonly $(pwd) $(pwd) "$1"
+		local | -eu && --verbose done cd echo readonly /usr/bin x=1 ${HOME} export grep
+	&& printf 2>/dev/null local $(pwd) echo && $(pwd) --verbose x=1 $(pwd) echo "$1"
+	| then export "$1" readonly awk test
+		printf | "$@" cd "$1" "$1" x=1 $(pwd) -eu
+grep x=1 'quoted text' && "$@" sed 'quoted text'
+		echo | readonly /usr/bin done local "$@"
+awk -eu grep cd test x=1 $(pwd) sed echo then $(pwd) export grep local "$1" echo
+	&& --verbose readonly test /usr/bin /usr/bin "$@" 'quoted text'
+test test done echo 2>/dev/null "$1" local -eu --verbose
+		2>/dev/null x=1 local ${HOME} x=1 ${HOME} --verbose $(pwd) $(pwd)
+	sed printf readonly &&
+		| local 'quoted text' local | && "$@" 2>/dev/null -eu test grep done
+&& --verbose printf printf && -eu echo
+&& $(pwd) awk x=1 /usr/bin local test | x=1 $(pwd)
+	then -eu $(pwd) done &&
+	grep $(pwd) ${HOME} local $(pwd) printf $(pwd) -eu done local && && && ${HOME}
+		sed local export sed -eu -eu then done "$@" grep
+sed grep local $(pwd) -eu --verbose grep x=1
+		-eu awk ${HOME} test echo 2>/dev/null | export grep awk && "$1"
+| /usr/bin 'quoted text' x=1 | --verbose && 2>/dev/null sed echo export
+		| grep $(pwd) --verbose test /usr/bin test
+		local grep export /usr/bin x=1 |
+		-eu sed ${HOME} x=1 x=1 x=1 "$@" done -eu $(pwd) grep "$1" 2>/dev/null
+		"$1" 2>/dev/null && x=1 "$@" && /usr/bin echo local cd x=1 printf
+2>/dev/null done "$1" x=1 /usr/bin --verbose test 2>/dev/null
+		test local -eu echo readonly
+export $(pwd) ${HOME} echo awk echo ${HOME} then grep
+	--verbose cd then export done echo --verbose --verbose 'quoted text' export
+"$@" && export | readonly export "$1" test grep $(pwd)
+	sed test "$@" grep test printf then then printf -eu printf && $(pwd)
+printf test grep export done export --verbose done done grep cd cd | x=1 && ${HOME}
+${HOME} readonly test sed cd -eu local 'quoted text'
+	--verbose --verbose awk "$1" sed $(pwd)
+	"$1" readonly 'quoted text' $(pwd) "$@"
+"$1" readonly done 2>/dev/null ${HOME} 2>/dev/null
+-eu done && readonly readonly | done printf /usr/bin ${HOME} $(pwd) sed
+echo grep /usr/bin awk test
+	echo | done test readonly --verbose | /usr/bin export
+	x=1 then x=1 "$@" | "$1" 2>/dev/null
+/usr/bin then ${HOME} ${HOME}
+2>/dev/null awk test | 2>/dev/null /usr/bin
+"$1" -eu readonly sed done printf echo $(pwd) 'quoted text' grep cd done
+		2>/dev/null readonly && | done x=1 2>/dev/null printf printf
+done local $(pwd) export
+	cd grep then 'quoted text' 2>/dev/null readonly local ${HOME}
+x=1 sed -eu then done 'quoted text' -eu ${HOME} printf sed 2>/dev/null
+		&& local done printf --verbose grep local
+	--verbose then /usr/bin test echo done printf readonly
+	awk then readonly 'quoted text'
+		local then test 'quoted text' printf "$@" printf
+	local --verbose "$1" local done done readonly $(pwd) export /usr/bin $(pwd)
+--verbose "$1" && ${HOME}
+&& readonly ${HOME} cd readonly 2>/dev/null cd -eu -eu 2>/dev/null
+"$1" --verbose "$@" readonly 'quoted text' 2>/dev/null cd
+cd cd 'quoted text' x=1 "$1" export |
+	2>/dev/null readonly && awk done done "$@" x=1 export readonly 2>/dev/null
+		printf "$1" -eu 2>/dev/null
+-eu "$@" test readonly echo awk $(pwd) "$1" 'quoted text' sed /usr/bin
+	x=1 && -eu awk "$1" --verbose x=1 sed 'quoted text' | export awk awk local x=1
+		printf test grep test | printf 2>/dev/null $(pwd) sed readonly ${HOME}
+	export local grep local "$1" -eu ${HOME}
+		--verbose test readonly 2>/dev/null
+$(pwd) echo --verbose "$@" awk cd echo
+	$(pwd) local /usr/bin | "$1" /usr/bin "$1" --verbose --verbose 2>/dev/null |
+	awk printf 2>/dev/null test 'quoted text'
+readonly then | echo awk $(pwd) echo grep awk local echo echo readonly
+	test echo export cd $(pwd) --verbose cd cd echo
+		done sed local -eu sed /usr/bin cd ${HOME}
+		done awk grep 2>/dev/null && printf
+	'quoted text' test export /usr/bin done | && /usr/bin -eu printf
+	${HOME} sed printf --verbose cd 2>/dev/null
+	export "$@" awk test | done "$1" "$1" export then "$@" "$@" cd readonly --verbose
+		awk | "$1" done $(pwd) awk printf export /usr/bin printf ${HOME}
+	"$1" sed echo done | -eu sed grep ${HOME} | readonly readonly echo
+		echo awk export "$@" "$@" 'quoted text' 'quoted text' then && grep -eu 'quoted text'
+x=1 /usr/bin --verbose readonly && ${HOME} awk test then "$1" sed printf cd awk
+"$@" | && -eu test local | test --verbose 2>/dev/null local 2>/dev/null
+	&& && "$1" cd test | ${HOME} awk local
+	cd ${HOME} /usr/bin export --verbose ${HOME} $(pwd) --verbose
+		sed readonly export "$1" -eu
+		export sed /usr/bin readonly | x=1 $(pwd) -eu cd readonly then
+local ${HOME} printf then grep -eu sed cd sed 'quoted text'
+export echo -eu x=1 $(pwd) awk 2>/dev/null then ${HOME} done echo
+		test ${HOME} "$1" readonly -eu cd readonly | x=1
+	| ${HOME} cd --verbose ${HOME} && export sed 2>/dev/null then local done
+echo | echo && grep done printf -eu sed --verbose
+		/usr/bin awk echo --verbose
+		/usr/bin 2>/dev/null local ${HOME}
+	-eu sed readonly && && test 'quoted text' "$@" 'quoted text' -eu /usr/bin
+		echo "$@" ${HOME} cd && done then "$@" "$@" echo grep echo
+then | | export -eu --verbose readonly /usr/bin && -eu then
+	"$@" | readonly ${HOME} echo "$1" 2>/dev/null 'quoted text' ${HOME} printf /usr/bin
+"$1" export awk readonly echo --verbose echo 'quoted text' printf
+		${HOME} x=1 x=1 -eu && echo readonly
+&& readonly "$@" export $(pwd) export | $(pwd)
+		"$1" ${HOME} export cd "$1" /usr/bin --verbose /usr/bin cd grep ${HOME} && sed
+test grep echo && $(pwd)
+2>/dev/null readonly awk
+	2>/dev/null $(pwd) "$@" printf /usr/bin
+		then echo echo /usr/bin then done x=1 'quoted text' grep
+		echo printf 2>/dev/null /usr/bin awk sed --verbose then --verbose
+	"$1" x=1 done test "$1" local -eu cd then && printf
+done -eu "$@" readonly sed sed readonly ${HOME} then then -eu
+test local ${HOME} awk --verbose done test export printf cd "$@" sed done done
+	| sed done test 2>/dev/null -eu $(pwd) local echo
+export /usr/bin awk grep then "$1" ${HOME}
+--verbose echo "$@" "$1" -eu then | readonly grep -eu $(pwd)
+	${HOME} --verbose ${HOME} then 2>/dev/null 'quoted text'
+-eu | test local --verbose sed then sed $(pwd) 'quoted text'
+		then "$1" && sed echo echo && -eu local readonly && echo "$@" 2>/dev/null
+	"$@" done "$1" "$@" sed
+/usr/bin 2>/dev/null "$@" 'quoted text' "$1" readonly
+	readonly printf readonly $(pwd) readonly export 'quoted text'
+readonly 'quoted text' printf readonly cd $(pwd) done echo echo /usr/bin
+	2>/dev/null $(pwd) "$1" 2>/dev/null ${HOME} ${HOME}
+		export printf local local
+	/usr/bin $(pwd) awk $(pwd) local grep test |
+/usr/bin sed grep 2>/dev/null echo | readonly 'quoted text'
+		then --verbose /usr/bin test $(pwd) readonly
+echo done grep echo readonly "$@" && readonly
+	${HOME} && 'quoted text' ${HOME} 2>/dev/null
+readonly "$1" -eu | | printf local awk readonly "$@"
+		sed $(pwd) /usr/bin "$1" readonly -eu "$@"
+	export echo local x=1 "$1" grep $(pwd) "$@" | sed export test local --verbose
+	"$@" sed then then sed ${HOME} 2>/dev/null && /usr/bin && done readonly
+then -eu x=1 x=1 readonly /usr/bin
+		| | -eu export 2>/dev/null && /usr/bin 2>/dev/null
+	2>/dev/null grep $(pwd) printf done then cd /usr/bin printf 'quoted text' printf
+echo --verbose sed printf ${HOME} readonly
+	local grep ${HOME} echo $(pwd)
+then local 2>/dev/null && 2>/dev/null sed readonly "$1" x=1 -eu $(pwd)
+--verbose then --verbose "$1"
+grep readonly x=1 done x=1
+cd | 2>/dev/null | ${HOME} grep printf
+	x=1 sed --verbose echo --verbose ${HOME} -eu --verbose
+	test local readonly test awk 2>/dev/null
+	echo echo 'quoted text' x=1 sed
+echo --verbose "$@" done export awk echo local 2>/dev/null
+export sed awk awk done | done cd readonly
+sed "$1" local ${HOME} grep test done cd "$@" export
+x=1 then --verbose readonly /usr/bin 2>/dev/null 2>/dev/null
+printf x=1 then $(pwd) "$1" printf /usr/bin grep 'quoted text'
+		&& done $(pwd) readonly then grep $(pwd) x=1 -eu --verbose "$1" 2>/dev/null
+		sed "$@" sed "$1" "$@" local $(pwd) awk printf 'quoted text'
+		2>/dev/null $(pwd) awk
+	'quoted text' printf then printf then printf $(pwd)
+		| "$1" done -eu test sed
+	/usr/bin local test "$1" awk then && && awk && 2>/dev/null "$1"
+	cd cd grep grep then 2>/dev/null then echo echo then test done
+		then cd "$@" 2>/dev/null
+export ${HOME} 'quoted text' export echo local export x=1 -eu
+	cd done x=1 printf 'quoted text' | printf x=1 echo done x=1 printf
+		--verbose $(pwd) local cd 'quoted text' export ${HOME} printf ${HOME} then
+		x=1 -eu awk readonly echo test echo
+	then && --verbose then
+test && cd /usr/bin sed printf 2>/dev/null x=1 "$1"
+		${HOME} then cd done 'quoted text' printf readonly local
+&& ${HOME} awk -eu -eu | readonly
+		$(pwd) "$1" export -eu
+	| $(pwd) /usr/bin export awk $(pwd) done x=1 awk cd echo then
+readonly | $(pwd) $(pwd) ${HOME} 'quoted text' /usr/bin
+	cd then --verbose cd cd done "$@" x=1 "$@" $(pwd) "$1"
+	echo printf test cd ${HOME} then $(pwd) sed
+grep | && --verbose ${HOME} x=1 echo "$1" 2>/dev/null $(pwd) x=1 -eu $(pwd) x=1
+		"$1" grep "$@" | ${HOME} x=1 "$@" -eu readonly echo awk
+	done | -eu test /usr/bin readonly
+		$(pwd) done "$@" awk "$1" x=1 &&
+		x=1 echo | local 'quoted text' x=1 printf
+	x=1 test ${HOME} | 'quoted text' sed cd "$1" 'quoted text'
+| local grep test sed grep then grep /usr/bin local
+	done && readonly x=1 && 2>/dev/null done ${HOME} grep printf --verbose "$@"
+		x=1 2>/dev/null grep | ${HOME}
+readonly x=1 -eu awk && echo -eu "$1" $(pwd) x=1 export 'quoted text'
+	local cd 2>/dev/null
+	"$1" readonly test 'quoted text' export local
+		grep && grep "$@" awk 'quoted text'
+		export && /usr/bin cd 2>/dev/null printf -eu then
+		-eu test && awk local printf && sed --verbose && ${HOME} cd printf "$1"
+	'quoted text' local test export x=1 --verbose printf
+	${HOME} -eu x=1 sed local x=1 /usr/bin 2>/dev/null -eu /usr/bin
+	$(pwd) /usr/bin local local 2>/dev/null
+		done done 'quoted text' /usr/bin
+test 2>/dev/null printf local then
+		readonly --verbose then ${HOME} cd | cd && /usr/bin echo done grep
+	2>/dev/null ${HOME} && local sed $(pwd) readonly cd x=1 printf cd test
+		--verbose -eu && test export grep then ${HOME}
+	2>/dev/null -eu "$1" x=1 echo $(pwd) ${HOME}
+	awk sed then ${HOME} 2>/dev/null then "$@" 2>/dev/null echo && cd x=1
+		grep $(pwd) readonly awk then
+'quoted text' 'quoted text' export "$@" | x=1 done /usr/bin 2>/dev/null
+		/usr/bin grep /usr/bin printf awk done /usr/bin printf readonly "$@"
+		| local readonly "$1" --verbose ${HOME} 2>/dev/null --verbose
+	then --verbose test export -eu grep x=1 awk && test 'quoted text' then
+	printf cd echo grep done 'quoted text' "$@" readonly && /usr/bin | &&
+		grep x=1 printf $(pwd) | readonly grep ${HOME} | "$1" printf
+	"$1" /usr/bin export "$1" grep && ${HOME} awk export grep 'quoted text'
+		grep readonly printf "$1" && export ${HOME} /usr/bin
+'quoted text' 'quoted text' $(pwd) | --verbose
+		test sed x=1 printf grep && printf local done echo printf ${HOME} cd 2>/dev/null
+	then "$1" readonly grep readonly $(pwd) then 'quoted text' -eu done test |
+	cd $(pwd) then then "$@" $(pwd)
+#include c55.sh
+		x=1 sed /usr/bin | echo --verbose /usr/bin
+		export echo 2>/dev/null ${HOME} | readonly echo ${HOME} awk
+		readonly && done sed awk
+		export x=1 "$1" done 'quoted text' grep export then -eu
+	export $(pwd) /usr/bin 2>/dev/null 2>/dev/null sed sed export readonly "$@" export
+	sed readonly x=1 done /usr/bin then grep awk grep 'quoted text'
+	$(pwd) export "$1" && cd --verbose test printf awk "$1" $(pwd)
+local && printf x=1 grep done $(pwd) sed local awk 'quoted text'
+		-eu && x=1 sed $(pwd) readonly test
+	then | local --verbose $(pwd) "$1" && 2>/dev/null then "$@" grep -eu | --verbose
+		x=1 sed --verbose export /usr/bin --verbose
+echo "$@" "$1" | | 'quoted text' then ${HOME} ${HOME} /usr/bin
+		readonly local "$1" echo readonly echo x=1 awk $(pwd)
+	2>/dev/null -eu local "$1" /usr/bin printf
+	awk awk readonly x=1 echo printf readonly
+--verbose "$1" done echo
+		then sed ${HOME} readonly printf 'quoted text' --verbose export --verbose --verbose
+"$1" cd echo local awk printf 'quoted text' cd grep ${HOME} done readonly
+	echo -eu grep readonly /usr/bin -eu printf --verbose
+	${HOME} -eu then export test 2>/dev/null | 'quoted text' --verbose
+echo grep then sed readonly | printf
+		then done x=1 awk | 'quoted text' then then 'quoted text' "$@" 2>/dev/null
+	sed echo && x=1 then then $(pwd) x=1 printf awk | readonly then local "$1"
+	2>/dev/null then readonly "$@" local printf -eu local /usr/bin
+$(pwd) /usr/bin local /usr/bin
+		"$1" x=1 sed --verbose $(pwd) 'quoted text'
+	readonly test --verbose ${HOME} sed done 2>/dev/null sed --verbose x=1 -eu test
+export printf printf 'quoted text' /usr/bin done export
+awk /usr/bin export ${HOME} | cd "$1" --verbose | test /usr/bin readonly readonly
+	awk readonly cd "$1" readonly export 'quoted text' echo
+		readonly local printf /usr/bin --verbose export | local grep awk --verbose echo
+-eu $(pwd) awk 2>/dev/null cd then 'quoted text' "$@"
+	/usr/bin $(pwd) "$@" --verbose -eu 'quoted text' 'quoted text' --verbose $(pwd)
+	printf export printf then export /usr/bin | printf cd ${HOME} done && sed && grep
+	export grep sed echo -eu awk then export then
+	"$@" then readonly cd "$@" $(pwd) echo && 2>/dev/null
+		'quoted text' $(pwd) export
+| cd echo then /usr/bin awk local -eu grep then --verbose -eu then
+	readonly x=1 2>/dev/null done $(pwd) --verbose grep local $(pwd) then x=1
+	sed "$@" ${HOME} "$1" -eu -eu 'quoted text' 2>/dev/null
+	/usr/bin 'quoted text' export echo then done grep readonly done
+	sed ${HOME} -eu "$@" export test done && export && -eu then -eu test echo echo
+awk printf 'quoted text' echo grep "$@"
+	"$1" sed grep --verbose -eu test local printf test echo --verbose export
+--verbose -eu 'quoted text'
+	| 'quoted text' -eu export && done done /usr/bin
+		done | export export ${HOME}
+readonly && then readonly
+	x=1 then local x=1 'quoted text' grep "$@" -eu | then cd "$1" test
+${HOME} grep readonly sed 'quoted text'
+	export | | --verbose x=1 printf 2>/dev/null cd "$@"
+	"$@" "$1" local sed /usr/bin then "$@" readonly readonly -eu 'quoted text'
+&& grep then x=1 readonly $(pwd) --verbose
+		-eu done "$1" ${HOME} local 'quoted text' done | cd
+	then then test --verbose && x=1 "$1" -eu x=1 ${HOME}
+		2>/dev/null x=1 then -eu 2>/dev/null 2>/dev/null | 'quoted text'
+		x=1 sed then | ${HOME} "$@" readonly
+		&& sed && -eu x=1 awk && && x=1 done export
+local "$@" --verbose cd local test
+then printf --verbose test local
+cd sed x=1 then sed 'quoted text'
+x=1 done grep test ${HOME} "$1" 2>/dev/null cd
+		readonly | "$@" 2>/dev/null -eu 2>/dev/null awk
+		done then /usr/bin then -eu 2>/dev/null 'quoted text'
+		printf -eu /usr/bin ${HOME} printf 'quoted text'
+	awk -eu export cd grep /usr/bin printf
+awk -eu ${HOME} then --verbose /usr/bin && cd -eu sed "$@" x=1
+cd export awk export test printf /usr/bin ${HOME} --verbose --verbose "$@" printf
+done done ${HOME} && sed && local
+		readonly awk printf 2>/dev/null --verbose
+cd -eu then 2>/dev/null $(pwd) | done
+	grep /usr/bin 2>/dev/null then x=1 "$@"
+	2>/dev/null | sed readonly awk test sed
+done sed -eu "$1" "$1" && awk && local | sed /usr/bin "$1" done export
+x=1 done /usr/bin then && readonly grep echo grep
+		export /usr/bin done test sed && grep readonly "$@" awk export -eu -eu
+		'quoted text' awk readonly local && done "$@" grep export
+		2>/dev/null "$1" /usr/bin x=1 readonly export /usr/bin test test -eu
+	done local 'quoted text' && "$1" awk sed cd ${HOME}
+	| done printf x=1 then ${HOME} grep
+	grep -eu awk "$1" $(pwd) test sed 'quoted text' done test 'quoted text'
+echo then export x=1 readonly then -eu printf done printf cd ${HOME} x=1
+"$1" readonly "$1" --verbose
+	/usr/bin grep test 2>/dev/null --verbose test && local cd then
+2>/dev/null x=1 "$1" 'quoted text' readonly
+grep "$1" test -eu readonly 2>/dev/null
+	awk awk ${HOME} cd -eu grep ${HOME} sed printf 2>/dev/null
+sed /usr/bin then local echo "$1" --verbose -eu then printf
+	x=1 done x=1 printf then sed | $(pwd) -eu /usr/bin done readonly printf 'quoted text'
+	sed x=1 x=1 printf awk ${HOME} "$@" grep test /usr/bin 'quoted text'
+		export test "$@" $(pwd) /usr/bin x=1 echo && /usr/bin
+local --verbose "$@" --verbose --verbose ${HOME} echo
+	x=1 | "$1" export echo
+		'quoted text' test "$@" local && --verbose "$1" x=1 cd cd -eu --verbose ${HOME}
+	'quoted text' $(pwd) done --verbose sed
+$(pwd) cd echo x=1 --verbose
+sed then done awk 2>/dev/null x=1 echo $(pwd) --verbose then printf x=1 ${HOME}
+	/usr/bin "$@" --verbose ${HOME} 'quoted text' sed grep
+'quoted text' done local "$@" cd cd "$@" local
+		'quoted text' "$@" sed 'quoted text' sed /usr/bin readonly
+	export awk 'quoted text' cd ${HOME} "$1" "$1" --verbose test ${HOME}
+		awk "$@" x=1 local 2>/dev/null then cd | 2>/dev/null printf $(pwd) test done
+/usr/bin test sed test | x=1 test
+awk test local $(pwd) --verbose "$@" -eu awk printf ${HOME} ${HOME} $(pwd)
+	export grep cd 2>/dev/null
+	2>/dev/null "$@" done x=1 "$1"
+grep | done --verbose $(pwd) then export
+	/usr/bin printf then 'quoted text' 'quoted text'
+		'quoted text' local --verbose echo export
+cd -eu ${HOME} /usr/bin -eu awk echo sed "$1"
+	x=1 echo ${HOME} --verbose cd awk grep
+		readonly | test && --verbose x=1 2>/dev/null --verbose | | cd
+	--verbose && cd test then test cd sed x=1 | grep test
+	"$1" local "$1" /usr/bin && "$1" cd printf 2>/dev/null -eu --verbose echo sed
+$(pwd) sed x=1 x=1 printf then cd x=1 done | $(pwd) cd readonly readonly
+printf x=1 done cd done
+"$1" cd 'quoted text' $(pwd) sed done export --verbose then "$@" | 'quoted text'
+"$@" awk test | "$@" --verbose export grep then
+	&& test cd /usr/bin "$1" awk awk cd test "$1" export printf "$@" export
+	export | export cd $(pwd) echo sed local 2>/dev/null | $(pwd)
+cd -eu grep printf 'quoted text' && then test readonly
+cd 2>/dev/null x=1 grep cd 2>/dev/null --verbose done -eu
+echo | "$1" --verbose | 'quoted text'
+	-eu /usr/bin test readonly printf
+	sed x=1 echo awk "$@" -eu grep done
+		&& && echo "$1" 2>/dev/null echo sed /usr/bin
+export awk && x=1 $(pwd) awk && readonly test sed then 'quoted text' test local
+	printf $(pwd) then "$1" | done
+		"$1" "$@" local "$@" 2>/dev/null x=1 2>/dev/null /usr/bin sed "$1" $(pwd) --verbose
+		--verbose awk && local 2>/dev/null printf "$@"
+echo sed export test echo && printf && "$@" -eu 'quoted text'
+	readonly 'quoted text' echo sed --verbose export local
+		2>/dev/null x=1 "$1" 'quoted text' --verbose ${HOME}
+printf done printf printf && readonly then
+2>/dev/null local | printf local done local
+${HOME} && grep done cd local sed then && /usr/bin --verbose export "$1" printf
+	done test sed readonly readonly
+then $(pwd) x=1 sed done && /usr/bin "$@" test "$@" "$@" 2>/dev/null "$1" /usr/bin
+		| && awk 'quoted text' awk echo --verbose then | | cd printf then "$1" then
+x=1 "$1" local test awk /usr/bin $(pwd) readonly | sed
+export 'quoted text' printf x=1 x=1 export 2>/dev/null --verbose $(pwd) sed export
+		/usr/bin x=1 -eu | "$@" ${HOME} cd "$1" done "$@" grep sed readonly export test
+	&& printf | x=1 sed then -eu printf
+	"$@" cd | "$1" ${HOME} echo x=1 readonly printf
+| sed 'quoted text' readonly --verbose 'quoted text' --verbose "$@"
+		"$@" done test printf export then -eu /usr/bin "$@" 'quoted text'
+		awk then test printf $(pwd) done -eu --verbose then sed readonly
+	grep $(pwd) local then then /usr/bin
+"$1" "$1" local awk test sed "$1" "$1" cd "$@" test
+--verbose local grep $(pwd) printf --verbose "$@" "$1" "$@" echo
+		done echo readonly awk sed ${HOME} $(pwd) 'quoted text' $(pwd) x=1
+		printf echo x=1 local ${HOME} done "$@" test export
+${HOME} cd readonly 2>/dev/null sed "$1" "$1" 'quoted text' -eu readonly
+		cd $(pwd) x=1 "$@" sed /usr/bin
+/usr/bin export test test local sed local done $(pwd)
+${HOME} readonly /usr/bin printf 'quoted text' && cd && printf awk sed && printf
+	sed grep ${HOME} grep x=1 printf readonly local $(pwd)
+		grep /usr/bin -eu $(pwd) 'quoted text' echo local sed ${HOME} sed "$1" x=1
+	printf export /usr/bin local "$1" /usr/bin grep awk /usr/bin readonly -eu 'quoted text'
+	"$@" sed awk 'quoted text' 'quoted text' x=1 done test then test
+then awk -eu 2>/dev/null then test "$1" sed /usr/bin
+	echo --verbose local then readonly
+	'quoted text' /usr/bin done test export then "$1" 'quoted text'
+		--verbose | $(pwd) echo printf export awk -eu echo --verbose
+--verbose "$1" grep -eu cd grep awk && && local done awk x=1
+		sed test /usr/bin echo $(pwd) x=1 ${HOME} $(pwd) sed local then then export
+		--verbose export | sed -eu -eu test /usr/bin printf readonly
+		'quoted text' "$@" sed done echo readonly local | /usr/bin "$@"
+	--verbose local readonly readonly grep then 2>/dev/null
+	$(pwd) test "$1" "$@" | $(pwd) $(pwd) awk 2>/dev/null awk "$1"
+export printf "$1" then printf && 'quoted text' local 2>/dev/null
+done 'quoted text' echo 2>/dev/null
+		&& test x=1 grep export ${HOME} export echo "$1" sed 'quoted text'
+x=1 local awk x=1 test local grep awk readonly readonly 2>/dev/null x=1 then
+	x=1 done && x=1 echo --verbose local 2>/dev/null then | export local -eu cd
+--verbose test $(pwd) $(pwd) export
+echo export $(pwd) test | 2>/dev/null ${HOME} && test | echo && -eu $(pwd)
+		then 2>/dev/null sed printf --verbose /usr/bin
+		'quoted text' export /usr/bin grep readonly
+-eu done cd -eu local done done export test | readonly export
+		$(pwd) /usr/bin sed 2>/dev/null sed "$1" printf "$1" 'quoted text'
+	| awk /usr/bin test readonly done --verbose x=1 x=1 && --verbose
+	$(pwd) awk awk | 'quoted text' export readonly "$@" 'quoted text' sed then echo
+x=1 'quoted text' test | 'quoted text' $(pwd)
+		local then export 2>/dev/null printf "$@" awk
+readonly local x=1 --verbose
+		&& ${HOME} cd && test 2>/dev/null done x=1 'quoted text' $(pwd)
+	readonly readonly && sed "$1" awk ${HOME} test printf
+done "$@" echo "$1" test $(pwd) readonly printf | 2>/dev/null | done then
+x=1 export "$1" ${HOME}
+local 2>/dev/null done then printf "$@" ${HOME} local grep
+	local sed cd then done cd then $(pwd) then awk local then
+awk done -eu --verbose "$1" x=1 && grep 'quoted text'
+	awk && echo "$@" readonly echo export --verbose sed x=1 "$@"
+	$(pwd) sed | $(pwd) grep ${HOME} && echo /usr/bin
+${HOME} echo echo $(pwd) grep "$@" | -eu printf 2>/dev/null --verbose
+		sed printf grep 'quoted text'
+	$(pwd) $(pwd) /usr/bin awk sed awk "$@" | printf local x=1 "$@" local printf then
+cd --verbose x=1 readonly ${HOME} $(pwd) done ${HOME}
+		echo readonly cd | test x=1 done sed done awk --verbose
+	cd | -eu then 2>/dev/null readonly && awk | grep
+		${HOME} then "$@" $(pwd) "$1" done "$1" echo "$1" /usr/bin 'quoted text'
+		done | x=1 && grep cd x=1 2>/dev/null done /usr/bin $(pwd) printf export 'quoted text'
+	then echo printf awk awk 2>/dev/null |
+x=1 then && cd done readonly readonly printf printf
+	done "$1" 2>/dev/null && then | export echo
+		then sed test sed -eu cd sed sed 'quoted text'
+	/usr/bin "$1" --verbose
+'quoted text' "$@" echo && --verbose /usr/bin sed readonly --verbose x=1
+		echo x=1 && | done export "$1" sed grep done readonly "$@" 2>/dev/null |
+	test && printf export "$@" /usr/bin && 'quoted text'
+cd | | sed 'quoted text' ${HOME} $(pwd)
+		"$1" sed awk --verbose readonly echo --verbose local
+		/usr/bin printf cd grep test export cd sed export awk "$1" echo local | -eu
+		readonly sed x=1 | sed test test cd test $(pwd) 'quoted text' ${HOME} 2>/dev/null
+	local echo --verbose "$@" test && echo $(pwd) cd local
+		sed printf "$1" grep then
+'quoted text' 2>/dev/null /usr/bin readonly grep then printf $(pwd)
+local 'quoted text' readonly sed done readonly printf
+test 2>/dev/null $(pwd) --verbose
+		'quoted text' | local | --verbose
+		cd grep echo -eu -eu awk "$@" -eu /usr/bin /usr/bin
+	'quoted text' /usr/bin test awk /usr/bin
+export echo $(pwd) readonly "$1" sed 2>/dev/null grep --verbose sed awk export echo
+$(pwd) grep grep printf grep 2>/dev/null
+	local cd awk | "$1" export
+	sed test $(pwd) grep "$@" awk readonly -eu local
+		'quoted text' readonly ${HOME} 2>/dev/null done test export | 2>/dev/null readonly
+	&& | /usr/bin export ${HOME} awk done echo export grep export x=1 --verbose local
+		done grep sed && "$1" done
+		echo "$@" echo awk 'quoted text' printf echo | awk awk
+	grep && done | ${HOME} ${HOME} local local cd 'quoted text'
+	--verbose 2>/dev/null x=1 --verbose /usr/bin readonly grep
+		-eu /usr/bin --verbose echo
+	/usr/bin grep printf 2>/dev/null "$1" cd done done ${HOME} x=1 local
+	sed --verbose --verbose cd export echo printf && done $(pwd)
+	echo --verbose sed test /usr/bin grep
+	cd --verbose awk | x=1 x=1
+-eu "$@" -eu test /usr/bin
+	local local -eu && -eu local -eu test
+		-eu readonly x=1 printf $(pwd) | $(pwd) 2>/dev/null cd readonly && readonly
+$(pwd) grep | local 'quoted text' grep 'quoted text' printf export
+echo cd $(pwd) | echo "$1" $(pwd) local 2>/dev/null
+	&& echo echo "$1" cd && x=1 grep && printf awk export test /usr/bin awk 2>/dev/null
+	$(pwd) cd $(pwd) cd | grep |
+	sed then && awk --verbose 2>/dev/null
+		"$@" readonly "$@" echo ${HOME} then done -eu test echo done
+		2>/dev/null | done /usr/bin
+grep -eu /usr/bin sed local grep cd x=1 -eu
+	cd readonly echo cd printf 'quoted text' 'quoted text' ${HOME} cd done then
+		$(pwd) export test export awk
+test /usr/bin "$@" /usr/bin then
+	| awk -eu local then 'quoted text' 'quoted text'
+${HOME} local 'quoted text'
+		| $(pwd) "$@" local $(pwd) -eu readonly "$1" "$1" echo
+	'quoted text' && 'quoted text' -eu --verbose && 'quoted text' && $(pwd)
+$(pwd) grep x=1 cd test x=1 export readonly
+		echo 2>/dev/null cd export /usr/bin $(pwd) cd cd
+	'quoted text' echo "$1" echo done | | cd then test && /usr/bin then
+	| 'quoted text' x=1 sed "$1" "$1"
+sed awk "$1" grep $(pwd) export /usr/bin "$@" printf test
+	/usr/bin "$@" sed -eu && 2>/dev/null
+	x=1 cd 2>/dev/null done -eu /usr/bin then "$1" sed "$@" ${HOME} done printf
+${HOME} 'quoted text' export ${HOME}
+		local 'quoted text' grep
+grep "$1" awk cd && grep done /usr/bin export
+	sed grep | "$@" echo export then cd $(pwd) done -eu | test grep readonly
+"$1" done awk sed grep echo | x=1 'quoted text' local 2>/dev/null -eu && export
+	| sed x=1 cd done export "$1" 2>/dev/null
+sed done x=1 && done printf && local echo done printf test --verbose x=1 test
+export --verbose local sed cd x=1 grep
+--verbose export --verbose ${HOME} printf | export
+| x=1 local readonly "$@" awk grep
+		'quoted text' done 2>/dev/null then "$1" $(pwd) 'quoted text' $(pwd)
+sed --verbose --verbose grep | test x=1 "$1" $(pwd)
+echo "$1" test && cd 2>/dev/null /usr/bin
+"$1" 2>/dev/null $(pwd) && echo x=1 -eu
+${HOME} | "$@" sed cd echo export --verbose $(pwd) "$@" 'quoted text' /usr/bin
+x=1 sed test $(pwd) 'quoted text' echo done cd x=1 | local export test "$1" /usr/bin
+cd 2>/dev/null -eu ${HOME} $(pwd) printf printf /usr/bin
+	cd "$1" grep printf done printf export "$1"
+		x=1 done "$1" && ${HOME} readonly then awk -eu 'quoted text' test 2>/dev/null
+awk $(pwd) local export ${HOME} /usr/bin cd | && sed awk echo cd -eu "$@"
+	"$@" export local 'quoted text' $(pwd) local printf cd | cd local -eu
+	awk sed then test -eu /usr/bin --verbose "$@" --verbose $(pwd) grep test
+printf printf "$1" then "$@" export 'quoted text' echo x=1 done
+	$(pwd) && then export && && echo test export echo cd /usr/bin test &&
+	then cd x=1 cd "$1" | $(pwd) /usr/bin /usr/bin 'quoted text'
+		${HOME} /usr/bin 2>/dev/null export then local | echo readonly cd $(pwd) 2>/dev/null
+	&& done cd && --verbose 'quoted text' 2>/dev/null done
+	'quoted text' echo sed
+	--verbose printf grep && "$@" --verbose then
+export $(pwd) | then export cd sed local export then | export
+		/usr/bin 'quoted text' test x=1 sed | local grep done local awk cd then /usr/bin
+	/usr/bin awk export export 'quoted text' grep cd sed local cd
+| done sed awk x=1 $(pwd) -eu x=1 "$1" /usr/bin then printf
+	&& grep $(pwd) printf export $(pwd) export grep export 2>/dev/null --verbose
+		test 'quoted text' printf export | ${HOME} echo then awk grep && printf x=1
+--verbose readonly awk done awk "$1" "$1" readonly sed
+	x=1 -eu local x=1 "$@" test 'quoted text' local test
+		echo -eu echo then -eu $(pwd) awk ${HOME} done $(pwd) readonly "$1" |
+		readonly then "$@" && then 'quoted text'
+	readonly grep 2>/dev/null -eu /usr/bin printf "$1" && $(pwd)
+	printf --verbose /usr/bin 'quoted text' grep echo export 'quoted text' printf
+	grep export && 2>/dev/null --verbose awk printf 2>/dev/null ${HOME} /usr/bin sed
+	| grep then test done printf awk --verbose
+		2>/dev/null echo $(pwd) "$@" x=1 $(pwd)
+		${HOME} -eu export test $(pwd) done test
+--verbose awk printf awk test test
+&& readonly 2>/dev/null export then then 'quoted text' "$1" && done
+	'quoted text' awk test 'quoted text' done 'quoted text' awk done x=1 then export
+/usr/bin "$@" "$@" echo | readonly printf /usr/bin "$1" echo sed then
+		2>/dev/null -eu test $(pwd) readonly printf test --verbose
+		${HOME} printf printf readonly /usr/bin test readonly done grep "$@"
+	grep export sed 2>/dev/null && grep echo export local
+		--verbose x=1 /usr/bin done awk test cd done
+		&& readonly "$1" then 2>/dev/null printf test && awk "$1" echo "$1" awk "$1"
+cd then ${HOME} grep "$@" x=1 --verbose $(pwd) awk test 2>/dev/null | awk then
+		cd && readonly export echo sed grep ${HOME} awk 'quoted text'
+		awk local local sed printf awk
+		"$@" 'quoted text' "$@" awk sed | /usr/bin then export && awk ${HOME} local && 'quoted text'
+	| 2>/dev/null 2>/dev/null then -eu cd then /usr/bin
+		readonly 'quoted text' "$@" /usr/bin && && then cd done && "$@" done
+		then 2>/dev/null 2>/dev/null grep $(pwd) x=1 readonly
+then local grep grep sed -eu printf
+	local done awk test ${HOME} printf $(pwd)
+		'quoted text' ${HOME} local export sed printf printf /usr/bin
+		local $(pwd) -eu local
+--verbose "$@" | 2>/dev/null 2>/dev/null
+2>/dev/null /usr/bin && cd export readonly
+	--verbose 'quoted text' "$@" test "$@" ${HOME}
+		| readonly "$@" echo then | "$1" x=1 --verbose /usr/bin && /usr/bin 2>/dev/null
+		sed -eu awk x=1 then ${HOME} && --verbose grep
+		readonly export 2>/dev/null 2>/dev/null printf echo grep x=1 export
+export then "$1" grep sed $(pwd) /usr/bin 2>/dev/null | "$1" cd -eu
+	test done --verbose sed export "$@"
+local ${HOME} -eu 'quoted text' | 2>/dev/null readonly $(pwd) export x=1 /usr/bin
+"$1" "$1" x=1 $(pwd) 2>/dev/null "$1" --verbose
+		echo "$@" awk && printf then done ${HOME} then then 'quoted text'
+	2>/dev/null sed readonly cd x=1
+	$(pwd) /usr/bin -eu $(pwd) ${HOME} local awk local
+		then done 2>/dev/null &&
+$(pwd) | ${HOME} sed done -eu printf $(pwd) 2>/dev/null cd "$1" then &&
+	then 2>/dev/null printf readonly --verbose --verbose awk "$1" $(pwd)
+-eu && ${HOME} grep awk echo local readonly awk cd "$1" -eu 'quoted text'
+export grep "$1" readonly test $(pwd) export then && cd
+	'quoted text' ${HOME} local echo echo test
+readonly ${HOME} cd ${HOME} /usr/bin sed echo ${HOME} readonly 'quoted text'
+		sed awk && "$1" export awk "$@" cd 2>/dev/null | test done 2>/dev/null "$@" export
+| "$1" readonly 'quoted text' | then
+then /usr/bin echo /usr/bin x=1 then 2>/dev/null x=1 "$@" grep /usr/bin
+		2>/dev/null echo | cd x=1 then export -eu sed ${HOME} && awk awk --verbose
+		export then test -eu printf
+done sed 2>/dev/null readonly
+echo grep -eu done local
+		test "$1" grep grep sed then | $(pwd) printf
+	-eu $(pwd) -eu done grep
+	cd export echo /usr/bin cd
+-eu "$1" echo cd printf 2>/dev/null
+echo readonly 2>/dev/null sed printf
+${HOME} readonly "$1" sed && | /usr/bin --verbose
+	echo grep echo && | done --verbose ${HOME} /usr/bin && x=1 /usr/bin ${HOME}
+--verbose printf local sed cd | --verbose local ${HOME} local local printf x=1
+	printf test awk done &&
+	then then readonly then -eu awk 2>/dev/null
+		--verbose ${HOME} x=1 done
+'quoted text' x=1 printf printf readonly -eu $(pwd)
+		-eu | /usr/bin | $(pwd)
+	printf grep then $(pwd) readonly sed sed /usr/bin | sed /usr/bin readonly grep done
+		grep "$@" -eu 2>/dev/null --verbose
+		2>/dev/null 2>/dev/null awk
+then ${HOME} | 2>/dev/null local | local
+"$@" "$1" -eu $(pwd) && 2>/dev/null grep cd x=1
+	| ${HOME} 2>/dev/null ${HOME} sed x=1 then
+awk cd "$1" then readonly sed grep
+	then 'quoted text' --verbose x=1 awk -eu "$@" --verbose cd 'quoted text'
+&& then 'quoted text' sed "$1"
+		x=1 -eu x=1 "$1" 'quoted text' "$1" 'quoted text' ${HOME}
+		test 'quoted text' ${HOME} export -eu "$@"
+"$@" done "$@" printf awk "$1" | then
+	$(pwd) ${HOME} printf printf && done echo 2>/dev/null
+	awk printf "$@" 'quoted text' --verbose
+sed 'quoted text' && 2>/dev/null 2>/dev/null
+		x=1 'quoted text' readonly -eu then ${HOME} sed
+	grep then /usr/bin 2>/dev/null sed local readonly sed 2>/dev/null
+		then test $(pwd) 2>/dev/null -eu ${HOME} | then ${HOME} local x=1 sed "$@"
+--verbose awk "$1" grep && export && test /usr/bin "$@" echo test cd 2>/dev/null
+${HOME} 2>/dev/null $(pwd) local done awk echo local readonly
+cd 'quoted text' grep echo awk test x=1 2>/dev/null
+		export x=1 /usr/bin -eu x=1 sed export | 'quoted text'
+		printf x=1 --verbose done x=1 "$1"
+	grep 2>/dev/null then readonly 'quoted text' echo -eu
+	readonly | -eu export
+		"$@" grep | -eu then awk
+	awk "$1" ${HOME} | done sed && grep x=1 2>/dev/null /usr/bin
+local -eu x=1 2>/dev/null ${HOME} cd $(pwd) 2>/dev/null
+	x=1 readonly x=1 "$@" /usr/bin awk 'quoted text'
+readonly grep done readonly | | sed
+		$(pwd) | && --verbose done $(pwd) readonly -eu printf 'quoted text' grep
+		&& awk readonly cd | local test "$@" x=1 $(pwd) cd local grep ${HOME} readonly
+then /usr/bin --verbose cd -eu grep sed $(pwd) done test local then 'quoted text'
+	&& grep then -eu 2>/dev/null ${HOME} $(pwd) export readonly
+		'quoted text' awk x=1 $(pwd) --verbose export ${HOME} -eu --verbose
+	grep done test "$1" cd | 'quoted text' then "$1" $(pwd)
+test then test export $(pwd)
+echo echo /usr/bin ${HOME} readonly
+		local | done cd test "$1" local readonly --verbose echo
+		'quoted text' test "$1" cd | "$@" cd
+		$(pwd) printf echo /usr/bin test "$1"
+	then local readonly | export "$@" /usr/bin ${HOME} -eu then done printf | -eu
+sed --verbose grep | awk /usr/bin local
+readonly awk "$@" then done done 'quoted text'
+done cd then "$1" | test "$@" ${HOME} sed 'quoted text' printf cd $(pwd) cd
+test test awk $(pwd) done done -eu && sed -eu cd "$1" /usr/bin
+2>/dev/null "$1" x=1 printf $(pwd) sed "$1"
+/usr/bin "$1" test $(pwd) 2>/dev/null "$1" --verbose done test /usr/bin cd echo
+		$(pwd) export then 'quoted text'
+export sed done cd -eu grep grep x=1 echo
+	-eu -eu && test readonly grep grep -eu
+		'quoted text' --verbose ${HOME} $(pwd) -eu test "$1" 'quoted text' echo | 'quoted text'
+		echo "$@" done -eu cd 'quoted text' done 'quoted text'
+	grep readonly /usr/bin awk -eu then test
+	then "$1" awk -eu sed $(pwd) && 'quoted text' -eu local /usr/bin
+		export x=1 "$@" grep echo
+		export | cd 2>/dev/null x=1 local | x=1
+		| | printf && --verbose
+		"$@" && ${HOME} echo export sed cd --verbose then ${HOME} done export readonly
+test echo 'quoted text' 'quoted text' awk awk /usr/bin && echo | sed printf |
+	grep then local $(pwd) -eu done export ${HOME} sed "$@" ${HOME}
+	sed test -eu 2>/dev/null && /usr/bin x=1 grep -eu 2>/dev/null
+cd readonly export local ${HOME} 'quoted text' $(pwd) test readonly
+done -eu test readonly 2>/dev/null test x=1 "$@" sed -eu "$1" grep
+	grep readonly 2>/dev/null x=1 printf --verbose sed then "$1" 'quoted text'
+	grep cd local "$1" readonly 2>/dev/null x=1 done x=1 'quoted text' done readonly
+cd /usr/bin && sed "$@" && sed -eu "$@" | 'quoted text'
+	--verbose $(pwd) sed ${HOME} -eu && --verbose awk /usr/bin
+	done then done done && grep then sed awk /usr/bin sed done
+		export "$1" --verbose 'quoted text' "$@"
+		$(pwd) test /usr/bin cd cd local grep | -eu -eu ${HOME} 'quoted text'
+		printf && grep "$@" printf ${HOME} done echo then cd done grep "$@" test &&
+printf /usr/bin x=1 test awk
+awk local | ${HOME} test echo | awk awk awk grep
+	local then | done done readonly local $(pwd) "$1" | x=1 grep
+&& echo && cd "$@" sed
+/usr/bin readonly "$1" cd "$@" cd |
+	x=1 2>/dev/null | echo sed done sed $(pwd) echo cd grep echo export
+	readonly x=1 echo && then done 'quoted text' done printf
+		-eu --verbose echo readonly grep
+	2>/dev/null "$1" -eu --verbose local --verbose awk
+'quoted text' /usr/bin test printf printf then x=1 export
+		printf export --verbose then local $(pwd) /usr/bin
+	done export --verbose done readonly then -eu printf
+	then && "$1" "$1" && "$1" grep 2>/dev/null
+		export --verbose | /usr/bin $(pwd) awk ${HOME}
+$(pwd) 2>/dev/null | cd test
+	--verbose 2>/dev/null printf sed echo ${HOME} export | sed export
+	2>/dev/null echo cd -eu cd test --verbose
+	$(pwd) "$1" /usr/bin sed cd x=1 awk printf --verbose
+		2>/dev/null export && export test | --verbose
+	readonly ${HOME} printf ${HOME} export echo export "$@" done $(pwd) test
+	done && sed x=1 export
+/usr/bin printf /usr/bin 2>/dev/null echo test done
+		'quoted text' "$@" awk printf printf --verbose
+	sed "$@" cd && readonly printf readonly sed cd cd "$1"
+		"$1" $(pwd) readonly test awk done "$@" $(pwd) /usr/bin printf export | done printf
+x=1 export 2>/dev/null cd local 'quoted text'
+	cd sed printf test cd test export test "$@"
+		&& test grep awk cd test | "$@" 2>/dev/null readonly /usr/bin echo done printf
+	--verbose cd 2>/dev/null readonly readonly sed "$@" --verbose sed local readonly
+x=1 test readonly test then cd grep then ${HOME} ${HOME} export cd 2>/dev/null
+		"$@" awk "$1" && /usr/bin grep -eu | sed 2>/dev/null -eu /usr/bin done
+	"$@" "$@" 'quoted text' ${HOME} grep -eu awk sed readonly done awk --verbose
+| echo $(pwd) --verbose && readonly --verbose "$1" 'quoted text'
+		${HOME} echo "$1" && cd local local done grep sed && cd --verbose /usr/bin
+		echo 'quoted text' test test /usr/bin printf $(pwd)
+grep awk 2>/dev/null test printf "$@" $(pwd) 2>/dev/null sed ${HOME}
+printf sed 'quoted text' 2>/dev/null export
+--verbose done then sed "$@" -eu && done $(pwd) cd awk test && readonly | grep ${HOME}
+		local x=1 grep $(pwd)
+		awk 2>/dev/null done ${HOME}
+'quoted text' readonly "$@" then done then
+		sed then && "$1" test then && /usr/bin --verbose
+	readonly "$@" "$1" /usr/bin awk | && grep && 2>/dev/null && ${HOME}
+2>/dev/null sed then "$@" echo readonly done "$@" grep -eu awk
+	readonly grep local x=1 done cd /usr/bin "$1" local test done
+cd grep export grep $(pwd) printf ${HOME} "$@"
+		"$1" then printf $(pwd) then then cd | printf && grep
+	cd cd sed 2>/dev/null x=1 2>/dev/null
+printf 'quoted text' done -eu
+		"$1" echo x=1 export export | | done echo "$1" test readonly $(pwd) printf
+--verbose | awk "$1" 'quoted text'
+		x=1 -eu -eu export readonly done export "$1" "$@" "$1" ${HOME} |
+	test | awk then echo --verbose
+		"$1" local "$@" "$1" local then "$@" 'quoted text' 2>/dev/null -eu "$1" readonly
+'quoted text' cd /usr/bin test cd readonly ${HOME}
+		then | | done --verbose printf echo
+	'quoted text' sed "$@" 'quoted text' &&
+	/usr/bin ${HOME} then --verbose echo x=1 /usr/bin
+		${HOME} "$@" grep grep export test
+	then export $(pwd) echo local readonly
+	"$@" --verbose ${HOME} grep test 2>/dev/null x=1 then x=1 && done 2>/dev/null &&
+	"$@" test --verbose local export 2>/dev/null ${HOME}
+grep export done && done readonly && test 2>/dev/null "$@" --verbose
+	cd export awk readonly x=1 sed
+		2>/dev/null && x=1 then echo "$@" --verbose --verbose ${HOME}
+		cd x=1 2>/dev/null echo --verbose readonly -eu && && && echo 2>/dev/null
+	sed -eu x=1 awk readonly echo export sed done export
+		done cd $(pwd) readonly grep $(pwd) /usr/bin grep echo readonly
+		test ${HOME} | && then 'quoted text'
+		awk x=1 --verbose --verbose echo --verbose -eu /usr/bin 2>/dev/null cd -eu
+/usr/bin local done export sed ${HOME} cd awk 'quoted text' grep
+		readonly -eu x=1 export /usr/bin x=1 cd 2>/dev/null
+		readonly ${HOME} grep awk ${HOME} && sed done 'quoted text' -eu
+		local && | printf readonly "$1" 'quoted text' $(pwd) cd grep local grep
+		| test grep 'quoted text' export done test 2>/dev/null then /usr/bin
+		"$@" grep cd "$@" 2>/dev/null readonly ${HOME} 2>/dev/null /usr/bin | 2>/dev/null
+		--verbose /usr/bin /usr/bin done ${HOME} "$@" -eu export test local
+		printf echo readonly sed awk awk printf && sed cd -eu cd $(pwd) local
+2>/dev/null readonly 'quoted text'
+awk && grep printf ${HOME} | x=1 readonly
+${HOME} cd awk "$@" "$@" printf
+	awk test test awk -eu local -eu $(pwd) && x=1 then
+	grep && grep --verbose cd "$@" local echo --verbose
+&& readonly $(pwd) -eu printf | $(pwd) readonly echo 2>/dev/null
+	cd sed "$1" done 2>/dev/null grep export $(pwd) $(pwd)
+	x=1 export export echo 2>/dev/null $(pwd) && grep printf readonly export $(pwd)
+$(pwd) ${HOME} "$1" readonly grep
+		test -eu sed printf done export
+		local sed cd grep export --verbose "$@" ${HOME}
+/usr/bin /usr/bin 'quoted text' local awk -eu
+		| grep grep $(pwd) then /usr/bin echo grep printf 2>/dev/null local readonly
+	cd readonly "$1" then grep $(pwd) /usr/bin grep sed readonly sed
+		-eu printf grep -eu then local "$1" 'quoted text'
+done "$1" && | echo -eu | 'quoted text' printf "$1" "$1" printf export --verbose
+test 'quoted text' sed awk "$1" then 2>/dev/null &&
+printf sed --verbose export readonly /usr/bin then && local cd local local
+		--verbose test | sed echo "$@" local
+then grep 2>/dev/null 'quoted text' /usr/bin "$@" test --verbose
+		export export then test 'quoted text' local export
+-eu 'quoted text' export -eu readonly sed --verbose ${HOME}
+"$1" test && sed printf
+		awk done | /usr/bin sed x=1 $(pwd) | done awk export done awk ${HOME} echo | cd
+		grep "$@" local -eu export "$@" grep echo /usr/bin then sed $(pwd) -eu 2>/dev/null
+cd "$1" && echo test export readonly $(pwd) --verbose
+export local 'quoted text' && | "$1"
+	done test 2>/dev/null x=1 && cd
+	"$@" "$1" "$1" sed local /usr/bin
+		printf awk awk local ${HOME} cd && readonly 2>/dev/null
+	awk $(pwd) /usr/bin readonly
+		/usr/bin 2>/dev/null test --verbose then 'quoted text' grep /usr/bin
+	export 2>/dev/null echo test readonly --verbose
+2>/dev/null readonly test "$@" ${HOME}
+		$(pwd) then 'quoted text' "$1" awk
+	grep $(pwd) ${HOME} 2>/dev/null ${HOME}
+	awk $(pwd) --verbose readonly local grep readonly | x=1 2>/dev/null
+	awk echo 'quoted text' echo grep "$@" local
+		awk ${HOME} echo test grep local -eu $(pwd) local x=1
+-eu --verbose 'quoted text' then sed local cd /usr/bin && done export | x=1
+test ${HOME} awk "$@" | 2>/dev/null local sed $(pwd) $(pwd) sed "$1" $(pwd)
+	--verbose cd -eu "$@" readonly awk
+x=1 then --verbose echo --verbose test readonly 2>/dev/null
+--verbose echo | test "$@" "$@" local then x=1 test 2>/dev/null -eu /usr/bin
+	local $(pwd) && grep export cd -eu && local -eu /usr/bin local cd && awk
+		done test printf 'quoted text' readonly
+	local 2>/dev/null --verbose then ${HOME} "$@" echo test ${HOME}
+	/usr/bin 'quoted text' awk "$1" && -eu x=1 'quoted text'
+		echo awk --verbose 'quoted text'
+	-eu echo "$@" | "$1" readonly
+		| $(pwd) readonly grep done && -eu
+readonly export x=1 export x=1 | "$@" 2>/dev/null $(pwd) test "$1" cd sed readonly
+	"$1" -eu printf "$@" done grep printf
+readonly echo x=1 printf export "$@"
+	cd /usr/bin $(pwd) local
+grep "$1" 2>/dev/null readonly $(pwd) | -eu --verbose && /usr/bin
+	test /usr/bin readonly ${HOME} | && /usr/bin test grep --verbose "$1" |
+		grep 2>/dev/null readonly awk -eu echo echo | -eu then
+-eu done done | readonly awk readonly "$@" test printf $(pwd) then 'quoted text'
+printf printf done 2>/dev/null
+		"$@" printf $(pwd) readonly | --verbose $(pwd)
+		awk local 'quoted text' cd then $(pwd) /usr/bin grep
+	"$1" --verbose -eu test && /usr/bin && awk then test sed |
+-eu --verbose then cd
+/usr/bin grep readonly -eu /usr/bin
+	2>/dev/null cd then "$1" local readonly
+echo --verbose sed grep sed "$@" local awk "$@"
+		done 'quoted text' sed echo "$@" printf done done sed /usr/bin ${HOME}
+grep | ${HOME} --verbose "$1" echo cd echo cd | 2>/dev/null grep "$1" &&
+done grep test /usr/bin export "$@" $(pwd) $(pwd) 'quoted text' sed echo | ${HOME}
+	sed cd -eu 2>/dev/null printf awk
+	cd grep "$1" "$1" -eu sed /usr/bin
+		"$1" /usr/bin sed --verbose $(pwd) then done test
+		--verbose done then /usr/bin
+		x=1 readonly | awk "$@" cd printf
+readonly sed local ${HOME} | --verbose export
+	"$@" test $(pwd) readonly export printf ${HOME} echo "$1" && 2>/dev/null export
+		-eu "$@" printf x=1 &&
+| 2>/dev/null | grep test
+		"$@" sed x=1 awk echo local 2>/dev/null
+		cd done 'quoted text' "$1" then "$@" "$@" cd sed /usr/bin -eu
+	grep awk 'quoted text'
+test printf -eu test /usr/bin | sed x=1 awk then awk printf 2>/dev/null
+	| "$1" $(pwd) export then --verbose
+		echo $(pwd) then printf 2>/dev/null -eu cd 2>/dev/null
+	then "$@" && 2>/dev/null "$@" && then then done ${HOME} readonly test export
+sed --verbose export 2>/dev/null x=1
+local test x=1 awk "$@" echo readonly --verbose printf done done
+	grep grep sed | /usr/bin done 2>/dev/null done readonly readonly "$1" awk x=1 test
+	awk "$@" "$@" | ${HOME}
+test $(pwd) $(pwd) --verbose local test $(pwd) test export sed $(pwd) export
+		| cd --verbose ${HOME} printf local 2>/dev/null sed 'quoted text'
+	"$1" local grep && then readonly done grep echo awk test
+printf $(pwd) sed readonly then "$1" $(pwd) export "$@"
+		printf echo done 2>/dev/null --verbose -eu readonly && ${HOME}
+	"$@" -eu 'quoted text' | cd readonly readonly export 'quoted text'
+	awk done --verbose "$1" 'quoted text' grep then cd -eu 2>/dev/null ${HOME}
+	'quoted text' then cd
+		cd 2>/dev/null -eu grep
+	then $(pwd) 'quoted text'
+grep printf "$@" "$1" /usr/bin "$1"
+sed -eu 2>/dev/null readonly echo && printf readonly
+test echo awk then "$@" cd "$@" --verbose cd /usr/bin /usr/bin sed $(pwd)
+		$(pwd) echo sed "$1" readonly done x=1 $(pwd) cd "$1" 2>/dev/null
+sed grep x=1 then -eu ${HOME} readonly && x=1 && sed test
+		"$@" | awk | "$@" 'quoted text'
+awk readonly cd -eu then local
+grep echo $(pwd) grep && 'quoted text' export "$1" -eu "$1" --verbose
+	then $(pwd) grep readonly
+	| printf then 'quoted text'
+		${HOME} --verbose grep then then | --verbose done "$@" x=1 && x=1
+	printf export "$@" x=1 $(pwd) "$1" export then then --verbose export
+	&& then sed export -eu && x=1 printf "$1" -eu "$1" test export x=1
+	&& sed local $(pwd) $(pwd) x=1 then /usr/bin awk test 'quoted text'
+		"$1" export $(pwd) done x=1 2>/dev/null 'quoted text'
+		done 2>/dev/null -eu $(pwd) -eu awk local ${HOME} echo 'quoted text' local cd done
+done readonly && "$@" cd 2>/dev/null && export | "$1" "$1" && grep 2>/dev/null
+	test x=1 $(pwd) | x=1 "$1" -eu
+readonly "$@" test ${HOME} then grep 2>/dev/null awk 'quoted text' done
+$(pwd) "$1" echo done then /usr/bin --verbose
+		"$@" -eu 2>/dev/null sed export /usr/bin
+test then then | -eu -eu
+	--verbose awk done local cd grep -eu
+	-eu && printf && ${HOME} local
+	2>/dev/null --verbose grep x=1 done awk export ${HOME} $(pwd) printf
+	done $(pwd) && echo ${HOME} sed &&
+		| grep && -eu sed then 'quoted text' | awk printf printf 2>/dev/null cd "$@" 'quoted text'
+	then awk readonly $(pwd) echo --verbose && 'quoted text' && -eu
+"$@" printf printf | | awk
+		awk ${HOME} --verbose sed 2>/dev/null
+	"$1" x=1 -eu $(pwd) printf ${HOME} $(pwd)
+		2>/dev/null x=1 | | 2>/dev/null && grep sed "$@"
+		"$@" ${HOME} sed --verbose -eu -eu local 'quoted text'
+		then echo "$1" then $(pwd) ${HOME} local readonly $(pwd) echo grep
+readonly awk | then local "$@" done echo "$@" echo test printf printf cd local
+--verbose test /usr/bin && then ${HOME} local
+		export /usr/bin export
+export --verbose && cd $(pwd) awk -eu "$@" x=1 test export
+		readonly local sed -eu sed 2>/dev/null sed 'quoted text' "$1" then
+	cd 'quoted text' -eu then "$@" | --verbose 'quoted text' "$@" local
+test readonly && readonly
+'quoted text' printf $(pwd) sed 2>/dev/null && printf $(pwd) -eu 'quoted text'
+then -eu printf readonly echo 2>/dev/null
+x=1 ${HOME} "$@" && then grep | sed sed "$1" awk "$@" && local
+$(pwd) x=1 cd $(pwd) printf test 'quoted text'
+then sed test done -eu done x=1 ${HOME}
+	then --verbose test sed $(pwd) test && grep --verbose "$1" readonly "$1"
+$(pwd) && /usr/bin "$@" readonly "$@" 2>/dev/null export awk /usr/bin
+"$1" -eu sed | test sed | $(pwd) 2>/dev/null x=1 $(pwd) ${HOME} cd x=1
+"$@" | test && awk 2>/dev/null | printf | done /usr/bin "$1" -eu local printf
+	printf "$@" -eu && grep cd export test "$1" printf grep
+printf export ${HOME} ${HOME}
+	${HOME} ${HOME} sed ${HOME} printf sed grep readonly test
+'quoted text' awk cd cd grep $(pwd) $(pwd) grep
+	test "$1" "$1" grep printf local x=1 --verbose readonly
+		local awk test printf test ${HOME} local export x=1 echo ${HOME} $(pwd)
+	"$1" cd local printf --verbose /usr/bin
+"$1" ${HOME} $(pwd) "$1" printf | ${HOME} cd sed local
+	grep $(pwd) --verbose --verbose 'quoted text'
+	then local "$1" $(pwd) then -eu x=1 x=1 x=1 "$@" export export
+	echo ${HOME} local export grep
+	/usr/bin | then readonly /usr/bin /usr/bin $(pwd) sed $(pwd) echo done
+readonly ${HOME} "$1" done $(pwd) "$1" --verbose echo "$1" test echo printf
+${HOME} echo && 'quoted text'
+		/usr/bin x=1 /usr/bin printf
+printf printf printf grep echo sed cd then 2>/dev/null cd local "$1" x=1
+	done local ${HOME} printf ${HOME} done x=1 done "$1" export export then x=1 export
+-eu local -eu ${HOME} "$1" local sed done echo "$@"
+		"$@" x=1 export ${HOME} grep /usr/bin
+	grep "$@" x=1 done "$@" -eu x=1 sed && then $(pwd)
+x=1 --verbose grep test ${HOME} grep awk && /usr/bin done echo 2>/dev/null
+export export grep x=1 -eu export sed awk x=1 | 'quoted text' x=1 sed | then local
+	readonly ${HOME} awk ${HOME} grep | export --verbose export done x=1 && local
+	local awk 2>/dev/null export "$1" "$1" && awk printf
+${HOME} printf -eu |
+${HOME} export | export x=1
+done && "$1" && x=1 x=1 export
+2>/dev/null && 'quoted text'
+"$1" $(pwd) 'quoted text'
+		then then "$1" --verbose -eu "$1" grep 2>/dev/null local -eu local /usr/bin
+	grep printf | 2>/dev/null awk then cd
+cd /usr/bin "$1" -eu && $(pwd) | 'quoted text' done --verbose "$@" "$1"
+		"$1" x=1 ${HOME} "$1" 'quoted text' "$@" $(pwd) "$1"
+$(pwd) printf x=1 done && --verbose -eu awk test
+"$1" 2>/dev/null sed $(pwd) test "$1" readonly readonly
+		"$@" test && -eu readonly "$@" /usr/bin && sed x=1 local awk -eu
+test 'quoted text' /usr/bin done done export printf | 2>/dev/null
+"$1" 'quoted text' $(pwd) 2>/dev/null printf 2>/dev/null "$1" ${HOME} then
+		cd --verbose readonly test /usr/bin sed "$@" echo x=1 test
+&& sed cd ${HOME} grep /usr/bin -eu
+	grep x=1 ${HOME} local cd $(pwd) | export then grep grep
+		--verbose printf $(pwd) | test 2>/dev/null
+	--verbose export echo --verbose && test
+		--verbose 'quoted text' ${HOME}
+	export | local ${HOME} x=1 "$1" printf
+		"$1" local test awk printf export grep local && 'quoted text' ${HOME} grep
+awk ${HOME} -eu then grep
+local echo && local awk export "$1" echo awk 2>/dev/null
+	readonly sed done echo local "$1" done
+/usr/bin "$1" /usr/bin 'quoted text' printf "$1" /usr/bin
+$(pwd) 'quoted text' ${HOME} sed
+"$1" then readonly "$@" /usr/bin $(pwd) sed
+| $(pwd) sed $(pwd) $(pwd) x=1 then "$1" export echo
+		local grep export && $(pwd)
+		readonly then "$1" --verbose /usr/bin "$1" "$1" done "$1" done grep
+		local "$1" && done --verbose sed sed $(pwd)
+		echo 2>/dev/null "$@" 2>/dev/null done "$@" readonly export "$1"
+2>/dev/null then cd && "$1"
+		awk local printf --verbose /usr/bin sed export ${HOME} /usr/bin
+	cd export local echo readonly awk test $(pwd) ${HOME} grep
+-eu test "$1" readonly /usr/bin
+export 'quoted text' awk "$1" echo x=1 done && sed
+awk grep sed readonly sed 2>/dev/null done x=1 "$1" 2>/dev/null echo 'quoted text'
+		"$1" export printf "$@" grep sed && -eu /usr/bin printf "$@" awk /usr/bin 2>/dev/null
+		"$@" sed echo export local cd cd "$1" $(pwd) grep 'quoted text' readonly $(pwd)
+	export grep -eu cd cd local x=1 done "$1" --verbose then echo $(pwd) | local 'quoted text'
+/usr/bin --verbose /usr/bin test $(pwd)
+	done | | /usr/bin awk cd local sed
+2>/dev/null cd test printf test /usr/bin "$@" x=1 2>/dev/null
+		readonly then echo 2>/dev/null $(pwd) test done
+printf echo "$1" --verbose --verbose
+	printf && --verbose "$1" printf sed $(pwd) && readonly
+	--verbose printf test -eu "$1" sed local awk &&
+	echo then echo -eu $(pwd) "$1" readonly
+		"$1" ${HOME} sed 2>/dev/null readonly then echo done echo "$1" local echo "$1" local
+-eu "$@" /usr/bin grep -eu awk 'quoted text'
+	sed then $(pwd) test local local | grep sed x=1
+grep && x=1 readonly awk 'quoted text' grep grep x=1 done -eu done echo export
+${HOME} readonly "$1" | sed "$@" x=1 test x=1 printf echo "$1"
+cd awk /usr/bin -eu export | | sed --verbose done sed -eu -eu cd local then &&
+/usr/bin cd then -eu | done readonly local done
+	| then test test grep ${HOME} then ${HOME} && grep x=1 printf done
+		test 'quoted text' done "$1" awk awk
+	--verbose cd printf test export
+		then echo done "$@" && then local readonly -eu
+grep readonly $(pwd) /usr/bin export echo cd then echo local "$1" sed --verbose
+		&& --verbose echo && export --verbose done then --verbose /usr/bin "$@" "$@"
+		"$1" "$1" test readonly
+cd --verbose sed grep export
+		then grep 'quoted text' --verbose local
+	echo echo test local printf test
+then 'quoted text' awk ${HOME}
+	then "$1" cd cd sed test sed ${HOME} && echo 2>/dev/null echo local
+		x=1 readonly && awk "$@" test -eu "$@" 2>/dev/null 2>/dev/null 'quoted text' test
+test $(pwd) 2>/dev/null 'quoted text' readonly && && "$@" echo /usr/bin --verbose
+		done awk grep done readonly then grep --verbose "$1" "$@" --verbose
+		test cd 2>/dev/null echo
+		cd export sed -eu export export ${HOME} "$@" 'quoted text' | sed && "$@"
+${HOME} grep $(pwd) "$@" --verbose && local 2>/dev/null local done cd
+	&& -eu x=1 done -eu readonly && export 'quoted text' cd "$1" done echo ${HOME}
+		test test test test readonly
+printf $(pwd) local && export ${HOME} local readonly readonly $(pwd) awk
+/usr/bin sed echo readonly --verbose sed 'quoted text'
+		grep readonly $(pwd) sed 'quoted text' --verbose "$@" 'quoted text'
+	/usr/bin x=1 cd cd x=1 ${HOME}
+2>/dev/null grep x=1 && then
+-eu -eu --verbose "$@" 2>/dev/null
+	--verbose "$1" "$@" $(pwd) /usr/bin $(pwd)
+	local grep ${HOME} /usr/bin local
+	grep /usr/bin printf cd echo awk && | 2>/dev/null export then readonly | &&
+		'quoted text' sed -eu && sed cd printf --verbose export && done
+		done 2>/dev/null 2>/dev/null "$1" x=1 echo
+	-eu 'quoted text' && test awk grep $(pwd) sed sed done "$1" readonly
+	"$1" --verbose --verbose ${HOME} ${HOME} -eu then printf
+		local grep local cd local sed "$1" 2>/dev/null "$1" printf done 2>/dev/null
+--verbose "$1" "$@" cd then test | "$1" readonly -eu "$@" grep export /usr/bin
+		"$1" awk then x=1 grep "$@" -eu test && "$@"
+$(pwd) local "$1" && local echo local export $(pwd) "$1" 'quoted text' --verbose
+	done --verbose && sed awk ${HOME} "$1" test test
+test ${HOME} && && readonly awk grep $(pwd) awk
+		2>/dev/null "$@" | then $(pwd) printf x=1 -eu && "$1" local awk export --verbose
+		${HOME} awk 2>/dev/null x=1 'quoted text' then echo | export local
+		awk test local cd export && export readonly done /usr/bin done sed
+	${HOME} $(pwd) sed sed /usr/bin ${HOME} sed
+	readonly ${HOME} export readonly 2>/dev/null 2>/dev/null "$@" printf awk readonly
+		$(pwd) sed awk | export /usr/bin ${HOME} "$@" export ${HOME}
+| -eu 'quoted text' done test x=1 /usr/bin 'quoted text' "$@" ${HOME} cd
+	echo printf test awk echo grep --verbose "$1" cd 'quoted text' | "$1" local "$@"
+| /usr/bin grep -eu grep grep cd grep "$@" 'quoted text' grep && x=1 -eu 'quoted text'
+	done "$1" 'quoted text' export -eu done /usr/bin done done 'quoted text'
+	${HOME} sed echo | && done echo | ${HOME} readonly local then
+		| "$1" sed 2>/dev/null sed 2>/dev/null sed "$1" grep grep --verbose
+		cd ${HOME} $(pwd) x=1 $(pwd) x=1 printf | then cd /usr/bin x=1 awk grep
+		printf $(pwd) 2>/dev/null 'quoted text'
+	then local 2>/dev/null
+		&& test 'quoted text' readonly
+	grep done then sed "$@" 'quoted text' cd readonly -eu && x=1 x=1
+	awk $(pwd) local --verbose test 'quoted text' && && "$@"
+x=1 sed cd | $(pwd) export export test awk sed echo sed awk
+--verbose "$@" awk then 2>/dev/null local x=1 /usr/bin
+	cd awk local local echo local x=1 done printf printf
+x=1 sed sed echo -eu sed | && $(pwd) "$@" |
+		2>/dev/null /usr/bin /usr/bin "$1" sed sed cd && awk "$1" grep | "$@" echo
+	"$@" /usr/bin done $(pwd) && grep
+	awk -eu 2>/dev/null x=1 test && readonly 2>/dev/null ${HOME} sed --verbose readonly
+readonly cd 'quoted text' grep echo 'quoted text' x=1 export export done export
+		readonly $(pwd) grep /usr/bin -eu "$1" then "$@" done awk local awk
+	export --verbose cd sed printf -eu echo 'quoted text' x=1 ${HOME} local "$1" 'quoted text'
+${HOME} export done then 2>/dev/null "$1" awk
+		then printf readonly /usr/bin $(pwd) awk && && done ${HOME} | grep
+	awk done "$@" x=1 /usr/bin cd /usr/bin
+sed readonly $(pwd) $(pwd) --verbose -eu sed 'quoted text'
+		2>/dev/null -eu --verbose done cd && printf 2>/dev/null ${HOME} 'quoted text'
+local printf local x=1 "$1" local 2>/dev/null x=1 awk 2>/dev/null &&
+	$(pwd) "$1" -eu awk export /usr/bin && "$@" 'quoted text' x=1 sed /usr/bin
+export $(pwd) | x=1 && 2>/dev/null
+		sed "$1" readonly ${HOME} grep
+		'quoted text' done test export local local | grep readonly |
+		&& local readonly done sed printf printf
+/usr/bin ${HOME} -eu "$1" sed "$@" test ${HOME} then ${HOME}
+		done && -eu "$@" cd ${HOME}
+	echo "$1" x=1 echo sed export done /usr/bin test
+sed readonly printf echo export /usr/bin 'quoted text'
+		printf && ${HOME} then "$@" | local x=1 sed
+	export local 'quoted text' grep cd 'quoted text' awk 'quoted text' ${HOME}
+	done export test grep awk sed 'quoted text' export
+	sed "$@" --verbose --verbose readonly
+then test x=1 x=1 echo ${HOME} local readonly -eu $(pwd) x=1 && -eu
+		echo cd 'quoted text' readonly 2>/dev/null
+		$(pwd) 'quoted text' grep readonly -eu -eu ${HOME} export
+	/usr/bin export grep -eu local sed /usr/bin && $(pwd) ${HOME} /usr/bin
+	x=1 echo --verbose $(pwd) awk ${HOME} cd /usr/bin then
+	done 2>/dev/null ${HOME} /usr/bin ${HOME} | then ${HOME} $(pwd) 2>/dev/null local
+		test awk local --verbose $(pwd) then /usr/bin sed local export x=1 ${HOME} sed
+	sed x=1 /usr/bin echo echo x=1 awk && --verbose "$1" test
+		${HOME} printf "$@" && readonly awk then /usr/bin sed sed grep
+$(pwd) sed printf readonly then readonly test
+-eu $(pwd) echo grep printf cd done local $(pwd) echo local --verbose
+	| test echo export readonly done -eu cd /usr/bin --verbose
+awk 'quoted text' -eu x=1 /usr/bin
+		done $(pwd) /usr/bin echo printf "$@" $(pwd) | --verbose readonly
+awk "$1" "$@" local 'quoted text' test 'quoted text' echo
+	${HOME} x=1 | -eu -eu awk /usr/bin
+		x=1 && grep "$1" printf sed && local $(pwd) "$1" "$1"
+	grep then $(pwd) local "$1" test test export test echo
+		'quoted text' export $(pwd) && awk | "$@"
+	local x=1 export ${HOME} $(pwd) cd /usr/bin cd
+		test | -eu x=1 $(pwd) --verbose test 2>/dev/null awk done grep local
+		$(pwd) 2>/dev/null $(pwd) 'quoted text' --verbose
+		/usr/bin 'quoted text' | 'quoted text'
+	cd test readonly cd echo "$@" 'quoted text' awk "$@"
+		-eu grep "$1" 2>/dev/null | cd "$@" /usr/bin "$@"
+	cd "$1" local local x=1 awk && test done echo | awk printf echo
+--verbose "$1" /usr/bin cd export export local echo && | local 2>/dev/null -eu
+"$@" cd export $(pwd) then cd echo echo test
+	/usr/bin -eu local echo local
+	${HOME} 2>/dev/null $(pwd) cd done --verbose
+/usr/bin grep readonly -eu | export x=1 --verbose grep
+	--verbose done "$1" sed --verbose
+		'quoted text' 2>/dev/null test
+	printf --verbose done printf then 'quoted text'
+		echo $(pwd) -eu 2>/dev/null -eu && 2>/dev/null
+		--verbose --verbose test export
+"$1" x=1 "$1" readonly cd sed test cd cd printf 'quoted text' export echo
+	${HOME} && then awk x=1 local /usr/bin test test --verbose && readonly
+		-eu grep x=1 cd test x=1 ${HOME} 2>/dev/null -eu done then 2>/dev/null done
+	test && done grep test
+x=1 | $(pwd) printf done echo
+		-eu echo /usr/bin "$1" $(pwd)
+${HOME} printf | cd done ${HOME} --verbose
+"$1" -eu cd /usr/bin then printf
+	-eu | sed "$@" local printf export readonly ${HOME} done &&
+cd printf ${HOME} -eu && sed 'quoted text'
+		x=1 printf --verbose sed printf cd 'quoted text' | grep printf --verbose ${HOME}
+		echo 2>/dev/null cd "$1" printf local readonly export awk grep x=1 then
+	then -eu --verbose && | cd | echo $(pwd) "$1" $(pwd) export
+/usr/bin then --verbose grep "$@" test done --verbose local --verbose "$1"
+test && readonly grep export "$@" awk && export cd x=1 then export
+		x=1 test cd "$1" --verbose $(pwd) $(pwd) --verbose local 'quoted text' "$1" &&
+	-eu readonly ${HOME} export 2>/dev/null grep 'quoted text' -eu test done ${HOME}
+printf export "$@" grep
+2>/dev/null | cd -eu done cd readonly 'quoted text' grep cd printf $(pwd)
+awk ${HOME} done echo export sed /usr/bin "$1"
+"$@" awk printf /usr/bin 2>/dev/null && "$@" $(pwd) 2>/dev/null cd && ${HOME}
+	| readonly readonly x=1 grep local awk "$@" && -eu
+		test x=1 x=1 $(pwd) x=1 sed | grep 2>/dev/null
+		&& ${HOME} test echo test readonly
+		cd "$@" 'quoted text' local
+	then /usr/bin cd test readonly | "$@" $(pwd) local -eu $(pwd) then --verbose
+	| sed cd cd "$@" -eu echo && -eu && done x=1 local test test export
+printf readonly done printf
+	/usr/bin --verbose grep /usr/bin awk readonly echo --verbose
+		sed ${HOME} x=1 printf x=1 test ${HOME} cd export "$1" x=1
+		printf printf awk | "$@" sed | 2>/dev/null grep 'quoted text' test
+2>/dev/null --verbose grep printf sed /usr/bin export ${HOME} /usr/bin /usr/bin
+	x=1 | "$1" sed x=1 awk awk
+$(pwd) ${HOME} | test cd export
+	"$1" x=1 "$1" readonly done x=1 2>/dev/null 2>/dev/null
+	2>/dev/null ${HOME} readonly export grep x=1 awk printf
+	/usr/bin grep "$@" cd done 'quoted text' then awk local
+	x=1 && awk sed echo sed 'quoted text' x=1
+	'quoted text' local ${HOME} /usr/bin done x=1 grep test local
+		readonly 2>/dev/null "$1" "$1" done done test -eu "$1" export x=1 2>/dev/null
+	readonly "$1" echo | ${HOME}
+	echo done export test x=1 grep
+2>/dev/null export readonly --verbose
+		${HOME} x=1 /usr/bin 2>/dev/null awk awk ${HOME} local
+	2>/dev/null printf test -eu $(pwd)
+local done echo "$@" /usr/bin then "$@" export awk "$@"
+${HOME} local x=1 done x=1 cd echo test $(pwd) | && echo echo export sed &&
+		"$@" awk $(pwd) ${HOME} sed -eu readonly
+&& local /usr/bin "$1" cd | --verbose
+		export --verbose 'quoted text' local && /usr/bin |
+cd then 2>/dev/null | awk cd echo test x=1 sed
+echo echo done --verbose --verbose grep "$@" 2>/dev/null cd && grep -eu
+	local readonly && awk awk 2>/dev/null
+	"$1" done printf sed grep echo 2>/dev/null then ${HOME} local -eu
+		then grep 'quoted text' readonly printf grep export export local
+	test then -eu "$@" "$@" printf
+		echo && 'quoted text' $(pwd) printf $(pwd) 2>/dev/null
+"$1" 'quoted text' echo grep export echo then then &&
+	$(pwd) then printf | echo readonly test "$@" 'quoted text' grep test -eu awk export
+		cd local local awk x=1 | export "$@" awk cd /usr/bin then && cd -eu done printf
+"$1" /usr/bin grep $(pwd) test $(pwd) "$1" "$@" sed sed grep x=1 2>/dev/null
+		/usr/bin local "$1" "$1" cd then printf printf 'quoted text'
+export grep "$1" then /usr/bin export x=1 "$1" awk | | /usr/bin echo cd test
+		sed x=1 "$@" x=1 cd echo export | 2>/dev/null sed printf grep awk cd export "$1"
+	export x=1 printf done && echo sed -eu x=1 echo
+		'quoted text' test export readonly /usr/bin x=1 'quoted text'
+sed -eu $(pwd) && sed awk then sed printf
+printf printf then echo && 2>/dev/null
+		--verbose "$@" 2>/dev/null x=1
+	2>/dev/null && && done test printf -eu cd | then 2>/dev/null --verbose "$1"
+readonly sed -eu 2>/dev/null done x=1
+		test test cd printf /usr/bin ${HOME} printf awk && "$1"
+		echo sed ${HOME} then /usr/bin | readonly 2>/dev/null | $(pwd) ${HOME} cd then
+		'quoted text' sed cd 2>/dev/null --verbose done printf echo awk grep
+		sed then ${HOME} 'quoted text' awk "$@" cd 'quoted text' test $(pwd) --verbose
+	--verbose | readonly "$@" then cd x=1
+then --verbose export --verbose sed test -eu export -eu
+	/usr/bin then local echo -eu && -eu $(pwd) readonly done 2>/dev/null -eu
+cd test | printf sed "$@" 2>/dev/null export "$@"
+printf && && && $(pwd) x=1 ${HOME} "$1" $(pwd)
+done done 2>/dev/null
+"$1" export printf 2>/dev/null --verbose export 'quoted text' local sed
+sed && export cd echo $(pwd) 'quoted text' --verbose awk x=1 awk
+	&& -eu local cd test x=1 cd --verbose
+	${HOME} test /usr/bin "$1" then $(pwd) test /usr/bin "$@"
+	x=1 ${HOME} "$@" grep printf ${HOME} export && sed x=1
+		test local export | --verbose && | test x=1 "$@" x=1 readonly export --verbose &&
+		done 2>/dev/null awk local done awk | grep readonly "$@" "$@" printf -eu
+		export 2>/dev/null cd test
+	awk -eu awk export export 2>/dev/null cd echo --verbose
+	'quoted text' then && --verbose 2>/dev/null $(pwd) local printf
+then x=1 readonly grep 'quoted text' sed echo
+2>/dev/null sed /usr/bin /usr/bin "$1" export | cd &&
+		-eu ${HOME} -eu awk readonly /usr/bin --verbose echo printf 2>/dev/null local ${HOME}
+done cd cd "$1" "$1" done $(pwd) $(pwd) -eu export printf sed printf
+	test 2>/dev/null $(pwd) readonly ${HOME}
+	&& sed printf -eu $(pwd) ${HOME} "$@" printf test x=1 sed --verbose | done
+local test $(pwd) local -eu test sed echo 'quoted text'
+		'quoted text' 'quoted text' export printf local x=1 $(pwd) /usr/bin readonly awk
+		2>/dev/null export "$@" done cd && export "$@" "$@" grep --verbose awk done 'quoted text'
+grep cd echo printf awk "$1" $(pwd) sed local
+$(pwd) test local "$@" readonly
+	--verbose local export "$1"
+-eu then then 2>/dev/null then 2>/dev/null /usr/bin 2>/dev/null local test -eu
+"$1" "$@" sed local readonly sed "$@" -eu local
+	echo readonly --verbose "$1" then test ${HOME} grep 2>/dev/null
+		/usr/bin $(pwd) "$1" /usr/bin && awk -eu /usr/bin "$@"
+	printf $(pwd) x=1 test "$1" readonly local
+		&& done done readonly --verbose ${HOME} grep sed "$@" "$@"
+'quoted text' local -eu cd ${HOME} then cd
+	"$@" ${HOME} test echo "$@" readonly 'quoted text' then readonly
+		"$1" readonly local /usr/bin && $(pwd) | -eu export test --verbose "$1"
+	| readonly x=1 "$1" 2>/dev/null /usr/bin awk awk | | && x=1
+		x=1 awk done 'quoted text' cd $(pwd) awk done local
+		&& awk 'quoted text' x=1 "$1" --verbose
+		awk cd 'quoted text' -eu "$@" readonly 2>/dev/null echo 2>/dev/null
+		test "$@" "$@" grep sed readonly /usr/bin --verbose sed -eu readonly
+		"$@" $(pwd) 'quoted text' /usr/bin grep done cd /usr/bin
+echo done readonly | test printf awk ${HOME} test
+		readonly sed 'quoted text' "$@" | --verbose printf grep
+	"$1" awk -eu 'quoted text' 2>/dev/null test export && export echo
+	local cd export readonly x=1 /usr/bin
+		sed local 2>/dev/null "$@" && $(pwd) | "$1" test
+	then test done /usr/bin "$1" local then echo /usr/bin
+	test echo ${HOME} && then ${HOME} test export local sed cd export --verbose
+		$(pwd) "$1" sed sed "$1" 'quoted text' "$1" export done "$1"
+		grep export echo export sed x=1 test done --verbose $(pwd) grep 2>/dev/null --verbose
+		$(pwd) | then test --verbose
+		readonly 'quoted text' sed done readonly
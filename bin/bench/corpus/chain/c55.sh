@@ -0,0 +1,2001 @@
+		cd -eu cd echo "$@" cd x=1 cd grep printf
+2>/dev/null readonly done test x=1 export readonly
+${HOME} then "$1" awk 2>/dev/null
+done sed x=1 -eu cd printf ${HOME} done ${HOME} /usr/bin
+		${HOME} | x=1 sed done $(pwd) awk "$1" cd "$1" ${HOME} awk x=1 grep /usr/bin
+	test ${HOME} "$@" done cd x=1 done | -eu 'quoted text' && 'quoted text'
+awk awk "$@" test local $(pwd) local | && "$1"
+		"$1" readonly cd echo && --verbose 2>/dev/null --verbose
+		2>/dev/null "$1" cd sed echo done x=1 test export
+	2>/dev/null cd test sed readonly 2>/dev/null x=1 export echo --verbose ${HOME}
+		&& printf ${HOME} test grep ${HOME} $(pwd)
+		&& "$1" "$@" cd sed awk done ${HOME} --verbose
+	"$@" $(pwd) -eu "$1" grep echo && 'quoted text' printf "$@" echo awk
+	readonly grep export done ${HOME} x=1 x=1 awk export x=1 grep printf done local
+		test done grep then "$1" echo "$1" awk
+"$1" awk && ${HOME} cd sed sed local
+/usr/bin && ${HOME} then printf "$1" $(pwd) -eu
+	&& && printf cd x=1 && export --verbose awk test local 'quoted text'
+then done test grep printf -eu && x=1 grep && echo export
+		then readonly 'quoted text' awk export readonly readonly -eu x=1
+		"$1" "$1" test -eu grep "$@" grep | $(pwd) awk /usr/bin
+printf grep awk "$1" && grep $(pwd) printf
+		"$1" done grep export then 2>/dev/null readonly "$@" done
+		local cd ${HOME} cd then ${HOME} printf $(pwd) "$@" local export then readonly
+		printf sed printf readonly grep done ${HOME} export /usr/bin 2>/dev/null
+		x=1 "$@" "$@" 2>/dev/null readonly "$@" grep ${HOME} echo
+		grep | grep done readonly echo sed -eu
+	2>/dev/null $(pwd) echo "$@" grep printf "$1" x=1 grep readonly | | --verbose
+	x=1 && -eu readonly "$@" printf readonly
+2>/dev/null test local then ${HOME} &&
+	/usr/bin printf printf --verbose 'quoted text' readonly
+	'quoted text' readonly /usr/bin
+		echo grep test grep --verbose --verbose echo -eu sed printf
+printf | sed local then -eu done "$@" then echo "$@" awk && test grep
+		test ${HOME} awk 2>/dev/null awk x=1 'quoted text' $(pwd)
+	grep && export 2>/dev/null local printf test "$1" awk sed "$@" 2>/dev/null
+		"$1" local -eu local printf awk local -eu /usr/bin
+echo 2>/dev/null x=1 'quoted text' -eu test then "$@" "$@" $(pwd) sed "$@" awk
+	then --verbose x=1 local "$1" --verbose local cd printf -eu 2>/dev/null done
+		2>/dev/null --verbose readonly awk awk awk /usr/bin local |
+x=1 ${HOME} /usr/bin /usr/bin | readonly -eu | | export
+		readonly && 'quoted text' "$1" then 'quoted text'
+		export -eu grep "$@" && "$1" --verbose && $(pwd) --verbose
+		| | x=1 2>/dev/null | "$@" awk 'quoted text' export && -eu x=1
+	"$1" awk ${HOME} "$@" echo --verbose local then printf export
+	grep printf 'quoted text' "$@"
+	test sed "$@" then | ${HOME}
+&& then readonly awk then ${HOME} export ${HOME}
+test grep "$1" then done && $(pwd) done
+		export cd x=1 done readonly local sed x=1 cd | then grep "$@"
+x=1 x=1 "$1" -eu --verbose cd && 2>/dev/null
+	| cd "$@" "$1" | awk x=1 export && readonly printf 'quoted text' sed cd "$1" sed
+		grep awk echo cd -eu ${HOME} 2>/dev/null $(pwd) | && test printf
+		"$@" readonly local -eu -eu done "$@" | | cd echo test /usr/bin printf cd $(pwd)
+"$1" grep /usr/bin test 2>/dev/null awk printf export cd --verbose
+		'quoted text' -eu | /usr/bin
+	export awk "$@" x=1 --verbose
+	then "$1" x=1 2>/dev/null
+		printf sed && x=1 $(pwd) x=1 ${HOME} --verbose cd --verbose
+-eu /usr/bin echo cd $(pwd) cd | ${HOME} "$@" local local $(pwd) then -eu &&
+		grep && && awk sed "$1"
+		"$@" && echo ${HOME} x=1 && echo --verbose grep local printf 2>/dev/null
+		awk export "$@" "$@" /usr/bin sed done done 'quoted text' done && done then export
+&& grep export cd test sed echo
+		grep | readonly "$1" "$1" printf
+		readonly x=1 -eu x=1 sed done awk sed local && --verbose sed /usr/bin 2>/dev/null
+grep printf export printf echo echo echo
+	grep ${HOME} echo cd x=1 /usr/bin local awk --verbose done "$@"
+cd --verbose && sed 'quoted text' then grep $(pwd) x=1 "$1"
+awk cd sed grep "$1" $(pwd) grep test printf -eu x=1 && x=1 x=1 awk "$1"
+	$(pwd) "$@" test printf | echo && sed grep ${HOME} sed sed /usr/bin --verbose
+		x=1 done sed done export /usr/bin sed then ${HOME} done $(pwd) export
+sed $(pwd) done $(pwd) 'quoted text' sed then -eu --verbose ${HOME} grep
+${HOME} then echo export
+	"$1" awk awk "$1" test
+	--verbose ${HOME} && x=1 test
+| && x=1 "$@" x=1 $(pwd) awk awk x=1 sed printf | export local awk "$@" x=1 readonly
+then sed 2>/dev/null /usr/bin "$@" then | 'quoted text' cd then /usr/bin $(pwd)
+	echo readonly echo 'quoted text' | done $(pwd) export
+then export printf printf done 2>/dev/null
+	readonly local 'quoted text' 2>/dev/null "$1"
+	then --verbose printf | then "$1" cd
+	| awk "$1" local then done "$@" 2>/dev/null
+		done echo 'quoted text' --verbose -eu -eu printf 'quoted text'
+	readonly readonly | -eu then test | grep ${HOME} /usr/bin
+printf 2>/dev/null grep x=1
+$(pwd) "$1" $(pwd) grep printf | && readonly -eu sed cd sed export
+	grep then cd x=1 then sed "$@" awk
+		test awk then cd sed --verbose test printf grep grep && | readonly "$@"
+readonly -eu 'quoted text' ${HOME} local then readonly echo test x=1 "$@"
+	readonly 2>/dev/null printf grep x=1 | awk | "$1" local "$@" readonly cd cd
+	2>/dev/null /usr/bin -eu /usr/bin then
+"$1" echo && /usr/bin $(pwd) ${HOME} then x=1 /usr/bin local echo ${HOME}
+export "$1" x=1 cd readonly readonly 'quoted text' && --verbose ${HOME} grep
+	printf export echo -eu cd grep
+		-eu echo then export done echo ${HOME} -eu && done awk x=1 done echo export
+	sed x=1 cd $(pwd) x=1 && then /usr/bin | | cd "$@" then echo /usr/bin awk 2>/dev/null
+awk --verbose ${HOME} sed "$1" 2>/dev/null
+-eu 'quoted text' done ${HOME} sed local printf cd readonly
+	-eu readonly --verbose grep local then
+printf readonly && printf 2>/dev/null grep
+		grep --verbose $(pwd) --verbose then "$@" -eu 'quoted text' done done
+echo done awk echo && printf
+awk test -eu 2>/dev/null -eu readonly sed --verbose readonly "$1" grep x=1
+'quoted text' export x=1 -eu
+readonly readonly export grep
+	$(pwd) 'quoted text' --verbose readonly "$1" --verbose 'quoted text' local echo
+	awk "$1" echo /usr/bin then 2>/dev/null
+2>/dev/null grep x=1 done --verbose $(pwd) echo
+then printf ${HOME} ${HOME} export x=1 2>/dev/null
+		'quoted text' printf test printf echo --verbose && 'quoted text' "$1" grep grep
+	"$1" 'quoted text' test awk sed && $(pwd) sed -eu cd 2>/dev/null
+2>/dev/null "$@" "$@" sed export
+		then printf then ${HOME} printf ${HOME} | grep test
+	grep export awk 2>/dev/null export awk readonly 2>/dev/null "$1" "$@"
+	grep -eu --verbose echo echo /usr/bin
+$(pwd) "$@" --verbose readonly cd --verbose /usr/bin then ${HOME} readonly cd --verbose
+cd echo then grep --verbose -eu readonly
+		x=1 cd 2>/dev/null -eu x=1 /usr/bin awk -eu awk grep 'quoted text' sed && awk
+	grep "$@" | ${HOME} printf test awk "$@" -eu x=1 sed printf local
+	done echo done "$1" ${HOME} x=1 done && export --verbose readonly test
+then 2>/dev/null done -eu "$@" x=1
+	echo 2>/dev/null export x=1 "$@" -eu /usr/bin 2>/dev/null printf x=1 "$@"
+| grep $(pwd) cd local sed test grep then export local "$1" 'quoted text' sed x=1
+test sed -eu x=1 then -eu cd | done "$1" sed /usr/bin then echo awk
+		readonly local local then x=1 'quoted text' -eu | 2>/dev/null
+$(pwd) export && 2>/dev/null ${HOME} export cd test awk echo printf 2>/dev/null
+test awk "$@" --verbose
+		2>/dev/null echo cd "$1" ${HOME} then
+		"$@" then "$1" ${HOME} 2>/dev/null awk | ${HOME} printf then
+	awk then 'quoted text' x=1 $(pwd) | done x=1 grep then $(pwd)
+-eu | $(pwd) -eu --verbose /usr/bin /usr/bin
+		then grep | test && grep
+		sed 2>/dev/null cd sed | ${HOME} export sed cd done test
+	then && local grep -eu sed x=1 $(pwd) "$1" "$@" x=1 awk awk grep awk
+		| -eu cd /usr/bin grep "$@" 'quoted text' echo && awk
+		&& --verbose /usr/bin test 'quoted text' printf --verbose "$@" done |
+export | then /usr/bin && awk $(pwd)
+		"$1" then export local $(pwd)
+		done cd local ${HOME} then done sed echo
+		"$1" x=1 "$@" then /usr/bin echo awk --verbose $(pwd) "$@"
+	x=1 awk test "$1" test | x=1 printf done done then cd export 2>/dev/null
+$(pwd) local && 2>/dev/null grep "$@" grep echo echo
+'quoted text' export --verbose awk 2>/dev/null x=1 local
+		echo then test x=1 x=1 ${HOME} sed ${HOME} done readonly export sed test
+	&& "$1" $(pwd) "$@" $(pwd) | ${HOME} ${HOME} -eu /usr/bin export readonly
+		&& "$@" awk -eu export readonly local grep test then 2>/dev/null
+	$(pwd) done /usr/bin /usr/bin sed
+		x=1 test then then printf x=1
+		"$@" 2>/dev/null cd -eu | sed ${HOME} /usr/bin awk cd /usr/bin | $(pwd)
+/usr/bin $(pwd) x=1 sed "$1" "$1" "$@" test /usr/bin --verbose
+then readonly test x=1 "$@" printf ${HOME} export local -eu echo cd
+	--verbose done local done -eu local
+	x=1 local then awk $(pwd) --verbose local "$@"
+	2>/dev/null sed printf 'quoted text' | readonly readonly --verbose
+/usr/bin x=1 test --verbose readonly test /usr/bin ${HOME} test
+	done then /usr/bin test --verbose x=1 printf /usr/bin |
+then readonly done | grep echo sed x=1 export cd 2>/dev/null
+printf $(pwd) && "$@" /usr/bin grep echo /usr/bin x=1 test done $(pwd) echo | sed
+$(pwd) sed then ${HOME} 'quoted text' --verbose
+		printf x=1 test done --verbose done $(pwd) cd /usr/bin "$@" local --verbose
+local 2>/dev/null cd $(pwd) ${HOME}
+readonly ${HOME} printf --verbose test echo
+&& readonly cd grep --verbose $(pwd) $(pwd) echo "$@" /usr/bin
+&& -eu | done then 'quoted text' -eu test ${HOME} awk then
+${HOME} cd /usr/bin done grep cd
+	-eu "$1" x=1 grep x=1 local 'quoted text'
+	export | 2>/dev/null cd --verbose x=1 export readonly awk
+		-eu && -eu cd && readonly
+		| 'quoted text' "$@" 2>/dev/null --verbose sed echo
+	/usr/bin export printf 2>/dev/null echo /usr/bin
+		$(pwd) "$@" ${HOME} done test then /usr/bin "$1" awk --verbose
+2>/dev/null | "$@" "$@" grep printf
+		2>/dev/null printf printf
+		&& export | && export x=1 'quoted text' --verbose printf
+		2>/dev/null sed /usr/bin readonly && awk "$@" awk test "$@" local cd local local
+		local "$@" 'quoted text' | "$@" sed then cd x=1 2>/dev/null
+		$(pwd) --verbose export $(pwd) "$1" cd grep grep done then |
+printf --verbose then 'quoted text' --verbose local test export
+	test x=1 | -eu -eu /usr/bin "$@" | then
+		sed -eu -eu grep /usr/bin && grep "$1" sed awk /usr/bin
+	--verbose "$@" done --verbose export /usr/bin done sed done readonly
+		$(pwd) "$@" local local 'quoted text' 2>/dev/null export export /usr/bin
+		export local printf then | readonly done "$1"
+		${HOME} local then 'quoted text' grep "$1" 'quoted text' --verbose readonly
+	| "$1" grep grep printf -eu | 'quoted text' export --verbose
+		then echo && export then echo then cd readonly | grep export
+echo -eu grep local cd local
+	sed readonly $(pwd) sed cd | echo ${HOME} | export $(pwd)
+	test test then 2>/dev/null 2>/dev/null
+$(pwd) test printf && 2>/dev/null sed && grep done 'quoted text'
+	printf "$1" export done local done 'quoted text' sed export then 2>/dev/null --verbose
+printf "$@" sed x=1 'quoted text'
+	done grep printf x=1 sed
+grep done x=1 local $(pwd) "$1" test readonly test awk --verbose ${HOME}
+grep then cd sed readonly /usr/bin 2>/dev/null sed then $(pwd) ${HOME} "$@"
+		grep then && x=1 done "$@"
+		cd "$1" readonly sed && sed --verbose
+grep "$@" -eu x=1 "$@" done x=1 awk
+	x=1 cd cd && /usr/bin && awk export && "$1" x=1 cd readonly "$@"
+		x=1 | 'quoted text' grep sed $(pwd) grep done --verbose x=1 sed awk
+"$1" 'quoted text' test
+	echo awk readonly readonly $(pwd) printf ${HOME} local local --verbose
+test readonly sed then $(pwd) cd x=1 sed sed then x=1
+	printf x=1 --verbose x=1 "$1" 2>/dev/null echo printf grep $(pwd)
+		2>/dev/null then local awk $(pwd) -eu sed local cd local printf
+cd local printf | readonly $(pwd) cd readonly awk export then then && x=1 readonly
+	export sed --verbose x=1 done /usr/bin printf echo then -eu 'quoted text'
+	| done printf $(pwd) echo readonly --verbose local then "$1" printf grep
+		$(pwd) "$1" "$@" done x=1 printf then
+	&& printf -eu && echo export export echo sed ${HOME} -eu /usr/bin | 2>/dev/null
+		then ${HOME} 'quoted text' readonly
+echo -eu echo readonly cd then test test awk grep grep 2>/dev/null
+		&& "$1" $(pwd) echo cd -eu test test $(pwd)
+'quoted text' "$@" "$@" cd then test export -eu "$@"
+		awk && --verbose printf /usr/bin printf
+readonly sed grep -eu grep local $(pwd) printf readonly echo --verbose cd printf
+		${HOME} printf grep test --verbose "$1" readonly echo test
+		echo echo $(pwd) printf grep && test printf sed echo cd /usr/bin grep then
+		test cd grep export then $(pwd) done x=1 printf
+/usr/bin done printf "$1" export $(pwd) && --verbose
+printf echo 'quoted text' ${HOME} /usr/bin export then local export export
+${HOME} ${HOME} /usr/bin sed awk done test sed 2>/dev/null && -eu | -eu
+"$@" | then -eu && export --verbose --verbose "$1" "$@" then done
+sed then test | --verbose | ${HOME}
+		readonly then -eu 'quoted text' ${HOME} printf /usr/bin 2>/dev/null then readonly
+	sed awk sed then "$1" export readonly
+		-eu awk export printf --verbose --verbose
+	${HOME} printf local 2>/dev/null 2>/dev/null
+echo then local $(pwd) done -eu grep cd x=1 readonly &&
+	sed test && x=1 2>/dev/null $(pwd) awk local
+		"$@" ${HOME} test 'quoted text'
+echo | 'quoted text' 'quoted text' $(pwd) &&
+then printf 2>/dev/null cd ${HOME}
+'quoted text' --verbose local local export /usr/bin --verbose && export
+| export $(pwd) | then export sed "$@" cd && --verbose 'quoted text'
+		$(pwd) local "$1" | test awk grep -eu ${HOME}
+	-eu awk readonly "$@" x=1
+	test readonly "$@" sed echo cd
+readonly 'quoted text' cd ${HOME} "$@" printf
+		done --verbose grep local export export "$1" --verbose --verbose cd --verbose
+x=1 --verbose "$@" --verbose done x=1 ${HOME} test echo
+printf "$1" "$@" && 2>/dev/null then /usr/bin ${HOME} sed readonly
+--verbose x=1 cd "$1" 2>/dev/null
+		cd x=1 echo readonly $(pwd) -eu local echo readonly echo
+	/usr/bin then "$1" printf done
+		"$1" "$@" /usr/bin local $(pwd) && grep readonly readonly readonly | done
+		export 2>/dev/null done ${HOME} | 'quoted text' local 'quoted text' "$1" "$@"
+/usr/bin ${HOME} local 'quoted text' 'quoted text' | | printf x=1 --verbose
+"$1" && sed export test && echo --verbose sed | "$1"
+	/usr/bin ${HOME} grep awk grep awk x=1 readonly
+	-eu grep -eu | && x=1 /usr/bin $(pwd) /usr/bin printf x=1 export "$1" 2>/dev/null
+	2>/dev/null done -eu ${HOME} sed printf sed x=1 then ${HOME} awk &&
+	done sed -eu printf | 2>/dev/null printf test
+	echo ${HOME} | x=1 "$1" "$1" -eu awk /usr/bin /usr/bin
+echo && echo test ${HOME} && x=1 grep $(pwd) /usr/bin done ${HOME}
+	/usr/bin test echo then
+"$1" readonly readonly local && printf | grep echo -eu done readonly sed cd -eu
+&& readonly done && -eu export x=1 export "$1"
+test 'quoted text' readonly 'quoted text'
+		printf 'quoted text' awk | awk then readonly echo 2>/dev/null 2>/dev/null
+test "$@" && export x=1 awk "$@" 2>/dev/null awk $(pwd) local
+	&& export test cd && 'quoted text' "$1" grep --verbose test
+/usr/bin printf readonly readonly test "$1" -eu
+	2>/dev/null grep test readonly
+	"$1" 'quoted text' grep "$@"
+-eu echo printf 2>/dev/null 2>/dev/null -eu $(pwd)
+		x=1 && --verbose echo done
+		awk ${HOME} grep done | awk --verbose | export grep
+		x=1 | "$1" | echo && 'quoted text' grep x=1 echo $(pwd) "$1" /usr/bin echo
+		export -eu x=1 'quoted text' readonly then x=1 printf
+	"$1" 'quoted text' 'quoted text' x=1 "$@" 'quoted text' x=1 &&
+		'quoted text' cd export cd
+local "$1" local sed 'quoted text'
+&& done -eu x=1 'quoted text' echo test
+	"$1" --verbose | ${HOME} --verbose && echo test $(pwd) $(pwd)
+$(pwd) -eu $(pwd) --verbose echo 2>/dev/null
+	readonly | | readonly "$1" -eu 'quoted text' /usr/bin
+	readonly done $(pwd) 2>/dev/null awk printf $(pwd) local $(pwd) "$1"
+	"$1" test done local export done export
+		x=1 sed | export $(pwd) cd | | x=1 then "$1" 2>/dev/null export ${HOME}
+then local printf | ${HOME}
+		x=1 awk && awk printf echo "$@" then
+		2>/dev/null local readonly && x=1
+		awk awk echo readonly 2>/dev/null echo
+		sed echo -eu sed test awk sed export readonly
+		awk cd then && --verbose --verbose $(pwd)
+	$(pwd) "$@" test cd awk done
+	local test 'quoted text' --verbose
+	${HOME} echo $(pwd) grep 'quoted text' readonly
+		x=1 readonly x=1 local ${HOME} /usr/bin x=1
+		local echo then done cd printf
+		&& ${HOME} 'quoted text' then -eu export -eu cd printf --verbose
+awk $(pwd) local --verbose export grep x=1 -eu "$1" awk export
+then local --verbose sed x=1 "$1" ${HOME} readonly "$1" awk readonly
+	awk cd | done grep awk --verbose
+		test printf cd ${HOME} done sed --verbose x=1 awk x=1 export
+'quoted text' echo local x=1 grep printf 2>/dev/null && done /usr/bin
+	echo $(pwd) "$1" printf --verbose ${HOME} ${HOME} test
+		done && "$@" /usr/bin cd done ${HOME} 2>/dev/null
+"$@" sed sed grep /usr/bin export 2>/dev/null
+		awk readonly done then cd done then local /usr/bin
+		$(pwd) local cd -eu awk && | "$@" grep awk export echo
+	test && x=1 --verbose printf $(pwd) then && x=1 awk grep
+	readonly local then awk && x=1 $(pwd)
+	grep readonly ${HOME} $(pwd) -eu x=1 echo echo readonly --verbose local
+		'quoted text' printf | -eu cd "$1" printf "$@"
+$(pwd) then -eu grep local echo && && -eu cd ${HOME} grep
+--verbose done --verbose cd
+	readonly test | ${HOME} done
+"$@" readonly --verbose done --verbose
+	printf printf echo grep --verbose awk
+		echo sed done /usr/bin | grep readonly grep | $(pwd)
+	local /usr/bin "$@" "$1" printf readonly cd
+	awk sed 'quoted text' 'quoted text'
+		$(pwd) export grep awk $(pwd) /usr/bin x=1 test
+		export sed done -eu "$1" x=1 export $(pwd) "$@" --verbose echo grep x=1 then --verbose
+		2>/dev/null x=1 | 'quoted text' | | cd x=1 'quoted text' done
+		grep cd local awk "$1" done readonly "$@" $(pwd) $(pwd) 'quoted text' && printf
+		then --verbose "$1" $(pwd) "$@" "$1" readonly then 2>/dev/null sed 'quoted text'
+'quoted text' | echo export
+		$(pwd) $(pwd) test $(pwd) echo echo sed ${HOME} done x=1 /usr/bin
+		echo grep grep $(pwd) 2>/dev/null readonly echo local --verbose
+	${HOME} echo then | local grep grep test 'quoted text'
+	"$@" $(pwd) ${HOME} sed printf then ${HOME} done test
+		sed done 2>/dev/null --verbose "$1"
+'quoted text' cd awk x=1 --verbose awk /usr/bin $(pwd)
+		then printf -eu local readonly
+		"$1" export -eu sed && printf -eu 2>/dev/null $(pwd) grep x=1
+	readonly 2>/dev/null awk sed /usr/bin
+		/usr/bin /usr/bin -eu "$1" local --verbose grep echo sed | test
+test printf -eu "$1" $(pwd)
+	"$@" readonly /usr/bin "$1" test /usr/bin awk x=1 local
+		test /usr/bin echo sed test "$1" x=1 local $(pwd) readonly
+grep echo 2>/dev/null export printf printf test ${HOME} done -eu
+	awk x=1 -eu then test grep printf x=1 ${HOME} "$1" x=1 "$1" "$@" sed "$1"
+	then -eu readonly ${HOME} $(pwd) sed export then
+$(pwd) sed sed grep 'quoted text' 'quoted text'
+"$@" echo 2>/dev/null test awk $(pwd) test ${HOME}
+-eu x=1 | --verbose echo x=1 cd 'quoted text' export --verbose cd then
+-eu cd printf local --verbose grep test ${HOME} "$@" | --verbose /usr/bin grep readonly
+/usr/bin printf | --verbose | then cd grep 'quoted text' "$@"
+cd local --verbose printf done "$@" awk cd 2>/dev/null $(pwd) | printf
+	then printf grep test | && cd
+&& export $(pwd) && sed sed
+| ${HOME} readonly -eu grep && /usr/bin done | echo /usr/bin
+2>/dev/null && /usr/bin --verbose
+	done 'quoted text' cd && cd then done local
+	printf --verbose 2>/dev/null then ${HOME} -eu 2>/dev/null --verbose readonly
+	awk export -eu grep sed ${HOME} cd "$@" --verbose $(pwd) cd "$@"
+2>/dev/null $(pwd) cd "$1" x=1 sed 2>/dev/null
+'quoted text' ${HOME} cd grep "$1" test export test
+&& $(pwd) --verbose $(pwd) 'quoted text' then local 'quoted text'
+		${HOME} echo -eu "$@" x=1 "$@" then
+	echo test /usr/bin /usr/bin | 2>/dev/null
+		'quoted text' 2>/dev/null "$1" local local
+&& 'quoted text' --verbose -eu echo /usr/bin "$1"
+		export "$1" --verbose 2>/dev/null && 2>/dev/null $(pwd) "$1"
+"$@" 'quoted text' cd then test "$@" printf -eu x=1 --verbose done "$@" test
+		done $(pwd) grep $(pwd) "$1" sed && 'quoted text' 'quoted text'
+done | cd export ${HOME} $(pwd) 2>/dev/null --verbose readonly &&
+echo "$1" local "$@" export $(pwd) --verbose echo x=1 | test --verbose
+		| export "$1" test echo export "$1" | grep echo echo grep done
+done x=1 echo "$1" echo sed echo "$1"
+	'quoted text' ${HOME} then -eu readonly /usr/bin ${HOME} then cd echo
+'quoted text' | -eu grep grep --verbose readonly local
+$(pwd) /usr/bin --verbose 'quoted text' /usr/bin --verbose printf
+	grep export && readonly
+		"$1" -eu 'quoted text' cd
+	x=1 local readonly ${HOME} awk done ${HOME} x=1 export $(pwd) awk "$@" "$1" x=1
+echo 2>/dev/null x=1 cd readonly local local local $(pwd)
+then test ${HOME} readonly cd then test x=1 --verbose 'quoted text'
+test sed then grep && grep "$@" -eu ${HOME} "$1" then
+	cd grep awk awk local local readonly
+	&& 'quoted text' --verbose export
+then export ${HOME} "$1" 2>/dev/null "$1"
+export "$@" awk sed then
+	done cd && ${HOME} 'quoted text' readonly
+	done readonly 'quoted text' printf grep echo
+		readonly test sed test "$1"
+	test | "$1" "$@" ${HOME} 'quoted text' test ${HOME} x=1
+$(pwd) sed && readonly readonly test export |
+	export "$@" test test done then sed
+printf echo then $(pwd)
+	$(pwd) cd grep && "$1" && echo "$1" /usr/bin sed sed $(pwd) grep
+	echo /usr/bin local 2>/dev/null --verbose $(pwd) | echo 'quoted text'
+	"$@" export export ${HOME} -eu && awk /usr/bin "$1" ${HOME}
+readonly 2>/dev/null then "$1"
+		"$1" readonly /usr/bin 2>/dev/null
+	2>/dev/null readonly x=1
+	'quoted text' then 'quoted text' 'quoted text' local /usr/bin then sed printf
+	"$1" printf export | cd export
+cd /usr/bin $(pwd) --verbose -eu --verbose echo "$1" printf | x=1
+x=1 awk awk then x=1 "$1" | echo awk -eu local export local readonly "$@"
+		local done sed "$1" $(pwd) /usr/bin printf "$1" $(pwd) cd readonly
+then /usr/bin done done grep 2>/dev/null "$@" "$1" awk
+		local test --verbose --verbose &&
+${HOME} sed --verbose "$1" awk $(pwd) readonly awk x=1 awk $(pwd)
+		done grep x=1 "$@" "$@" then cd ${HOME} test 'quoted text' done readonly
+		done --verbose /usr/bin readonly
+		local cd awk grep --verbose 2>/dev/null
+	"$@" ${HOME} awk $(pwd)
+then done ${HOME} echo 2>/dev/null --verbose
+'quoted text' cd /usr/bin "$1" && printf --verbose sed 'quoted text' /usr/bin test
+	printf awk echo | 2>/dev/null | sed "$1" readonly
+		export "$@" readonly "$1" then awk "$1" test
+		| echo 'quoted text' printf 'quoted text'
+		readonly done --verbose then cd readonly | awk "$1" cd awk ${HOME} "$1" cd
+	grep grep sed x=1 2>/dev/null then $(pwd) then local export && done cd grep local
+		x=1 printf awk grep local "$@" --verbose
+"$1" | ${HOME} export -eu "$@" | test done $(pwd) sed 'quoted text' ${HOME} --verbose
+		sed -eu | $(pwd) 'quoted text'
+		printf echo -eu x=1 2>/dev/null local 'quoted text' awk awk | test
+	readonly 2>/dev/null awk test
+	&& cd "$1" test sed printf $(pwd)
+		-eu cd test ${HOME} --verbose x=1 x=1 test grep test sed cd echo 2>/dev/null
+		x=1 ${HOME} printf | $(pwd) x=1 test sed /usr/bin
+	awk 2>/dev/null local "$1" local done sed | then 2>/dev/null
+	test test export echo echo printf export $(pwd) export
+		-eu local printf done "$1" $(pwd) 2>/dev/null /usr/bin
+	$(pwd) done local ${HOME}
+		printf 2>/dev/null done done x=1 grep "$@" "$@" --verbose sed sed x=1 echo --verbose
+		awk echo export test echo --verbose | 'quoted text' "$@" sed
+$(pwd) local printf export "$@" cd export 'quoted text' sed test ${HOME} readonly
+		awk /usr/bin then && then $(pwd) "$@" --verbose cd local sed local "$1"
+printf then x=1 && "$@" 'quoted text' | x=1 --verbose echo cd /usr/bin done "$@"
+		printf 'quoted text' /usr/bin | readonly done | -eu grep 2>/dev/null echo
+		echo test --verbose ${HOME} "$1" cd awk cd
+		"$@" "$@" --verbose "$1" echo
+'quoted text' /usr/bin "$@" 'quoted text'
+		readonly grep --verbose local
+		x=1 readonly --verbose awk readonly export --verbose -eu --verbose
+awk | done then cd test /usr/bin awk grep readonly sed awk export echo
+		readonly x=1 readonly test ${HOME} cd done printf test grep -eu awk grep -eu
+$(pwd) readonly readonly then cd ${HOME} grep sed x=1 "$1"
+'quoted text' "$1" test then then test "$@" && -eu
+"$1" export $(pwd) /usr/bin printf printf cd
+		sed printf export x=1 awk "$@" "$1" $(pwd) ${HOME} grep cd ${HOME} && 'quoted text'
+	-eu x=1 grep echo ${HOME} /usr/bin printf export echo ${HOME} export 2>/dev/null
+"$@" sed /usr/bin readonly grep -eu grep && readonly export ${HOME} -eu
+	$(pwd) done x=1 /usr/bin printf awk echo awk test echo
+	printf 2>/dev/null --verbose readonly then ${HOME} -eu
+		-eu | sed local "$1" echo 2>/dev/null /usr/bin readonly
+	then then 'quoted text' then 'quoted text'
+	sed sed printf local printf cd x=1 ${HOME} cd
+	-eu --verbose test "$1"
+"$1" "$1" 2>/dev/null && test "$1" readonly
+	"$1" sed 'quoted text' "$@" x=1 export 2>/dev/null 'quoted text' --verbose
+sed awk test then | 'quoted text' readonly done /usr/bin "$@" 'quoted text' export
+	&& "$1" 2>/dev/null "$1" /usr/bin awk then /usr/bin readonly grep then sed grep
+		sed "$1" test echo | done export sed && "$@" --verbose && echo --verbose grep
+	-eu awk echo grep && --verbose 2>/dev/null test cd --verbose
+cd cd awk readonly "$1"
+	-eu awk printf x=1 readonly ${HOME} awk echo printf awk
+awk 'quoted text' test
+test grep local test $(pwd) test
+	readonly printf then readonly "$1"
+done cd ${HOME} --verbose && && "$@" "$@" --verbose /usr/bin
+		"$@" "$1" local --verbose x=1 export readonly
+&& 'quoted text' 2>/dev/null local "$1" x=1 then "$@" sed x=1 test
+	export 2>/dev/null 2>/dev/null then then x=1 /usr/bin then done export
+		sed && echo echo test test done sed printf grep echo test local cd
+		local | echo "$1" echo awk
+		/usr/bin readonly /usr/bin && readonly then /usr/bin sed "$1"
+readonly -eu "$@" "$1" 2>/dev/null "$@" /usr/bin $(pwd) local local grep printf
+2>/dev/null /usr/bin "$1" $(pwd) done ${HOME} cd cd done | &&
+echo echo && -eu --verbose export
+export cd | "$1" local awk "$@" 2>/dev/null done then $(pwd) $(pwd)
+		--verbose cd x=1 x=1 ${HOME} x=1 /usr/bin readonly
+		awk printf export then readonly readonly grep local
+	x=1 readonly -eu cd /usr/bin
+	'quoted text' sed x=1 "$1" $(pwd)
+	/usr/bin grep sed && awk done grep -eu printf printf test x=1 cd echo "$1" local
+		awk readonly "$1" x=1 ${HOME} cd ${HOME}
+${HOME} $(pwd) 'quoted text' "$1" | "$1" awk &&
+	export /usr/bin grep "$1" printf grep 'quoted text' | export local
+	grep 2>/dev/null x=1 awk done cd --verbose /usr/bin done "$1" "$@" ${HOME}
+sed readonly sed | readonly 2>/dev/null
+echo --verbose /usr/bin cd grep x=1 ${HOME} 'quoted text'
+		awk | printf --verbose 'quoted text' | done readonly
+	$(pwd) sed x=1 /usr/bin
+	local done grep && $(pwd) printf --verbose awk awk "$1" --verbose export
+-eu $(pwd) export cd x=1 | $(pwd) echo grep
+printf sed 'quoted text' "$@" sed then "$1"
+$(pwd) "$@" grep cd --verbose $(pwd)
+local && cd export readonly -eu cd 2>/dev/null local "$@" 2>/dev/null "$1" -eu
+		-eu | readonly ${HOME} "$@" -eu "$1" && sed grep then sed
+"$1" /usr/bin /usr/bin cd 'quoted text'
+2>/dev/null then 'quoted text' /usr/bin "$@" printf readonly
+	2>/dev/null then done printf echo grep readonly /usr/bin
+	&& grep then --verbose $(pwd) /usr/bin ${HOME} printf &&
+"$1" awk "$@" ${HOME} | 'quoted text' && cd printf sed ${HOME} ${HOME}
+	export | grep 2>/dev/null | &&
+		"$@" grep x=1 2>/dev/null printf readonly grep --verbose
+		test | "$1" && "$@" test 2>/dev/null
+x=1 export -eu then "$1" done --verbose awk "$1" grep 'quoted text' test
+"$@" test grep -eu | echo "$@" | /usr/bin
+	grep 'quoted text' then
+	done --verbose local /usr/bin sed local
+sed -eu test export done then ${HOME} then grep
+	sed && && --verbose export
+	2>/dev/null "$@" ${HOME} -eu "$@" $(pwd) 'quoted text' 2>/dev/null
+awk then 'quoted text' done "$@" test awk 2>/dev/null && echo x=1
+/usr/bin echo grep grep awk cd grep --verbose /usr/bin
+		--verbose sed readonly then | sed | $(pwd)
+cd 'quoted text' cd 2>/dev/null --verbose --verbose
+		readonly $(pwd) then x=1 test "$1" grep |
+grep cd x=1 grep export test -eu awk export echo done sed cd test
+	readonly cd -eu && cd then x=1 cd 2>/dev/null
+	| local printf awk $(pwd)
+		cd printf -eu "$1" "$1" local x=1 echo done 2>/dev/null -eu --verbose
+	-eu && -eu cd printf readonly printf ${HOME} awk 'quoted text'
+	grep $(pwd) | /usr/bin x=1 export && awk
+		"$1" "$@" "$1" $(pwd) | ${HOME} echo awk "$@" cd
+		2>/dev/null done sed test readonly /usr/bin 'quoted text'
+		awk -eu /usr/bin then readonly 2>/dev/null grep sed echo && "$1"
+	awk grep | 2>/dev/null $(pwd) local awk then 2>/dev/null
+	"$1" /usr/bin x=1 grep "$1" -eu 'quoted text' ${HOME} /usr/bin local sed "$1"
+$(pwd) then | awk export
+	local x=1 echo done export x=1 then --verbose grep
+		| --verbose echo "$@" /usr/bin
+		-eu printf local ${HOME} && && grep && && done done
+		local 2>/dev/null grep
+	done test readonly printf --verbose
+		readonly "$1" | sed "$@" x=1 grep ${HOME}
+${HOME} $(pwd) cd test "$@" export "$1" x=1
+		awk printf 'quoted text' 'quoted text' ${HOME}
+	x=1 awk local printf | /usr/bin --verbose export readonly ${HOME}
+	cd "$@" grep ${HOME} export
+export /usr/bin grep | readonly "$@" "$1" sed awk export 'quoted text'
+	grep | grep | /usr/bin done $(pwd) local grep grep "$1" -eu echo | then sed sed
+		readonly "$1" 2>/dev/null readonly
+		echo "$@" sed sed --verbose grep "$@" --verbose grep --verbose x=1 readonly
+then && awk && --verbose -eu && sed "$1" awk
+		then echo && grep then 'quoted text' && 2>/dev/null && | done "$1" grep 2>/dev/null
+		"$1" 'quoted text' && done export
+	grep --verbose readonly awk sed local $(pwd) sed awk grep --verbose && awk export
+	test readonly local local sed && cd then local
+	local readonly sed && export "$@" && sed "$@" done awk
+	$(pwd) export echo --verbose --verbose then
+sed x=1 done done grep -eu 'quoted text' echo | 'quoted text'
+		awk x=1 "$@" local done x=1 | -eu test | -eu
+'quoted text' $(pwd)
+"$1" -eu -eu export $(pwd) && x=1 'quoted text'
+	sed -eu -eu -eu | done cd cd sed --verbose
+| readonly echo 2>/dev/null grep $(pwd) export awk ${HOME}
+	export $(pwd) export test
+		printf /usr/bin 'quoted text' | | grep printf --verbose
+		"$@" grep "$@" awk local -eu readonly test x=1 sed then 'quoted text' --verbose
+	awk echo cd sed export "$1" --verbose sed then 2>/dev/null echo | $(pwd)
+	"$1" export "$@" 'quoted text' --verbose
+echo 'quoted text' then readonly local 'quoted text'
+	then printf then then then $(pwd) && readonly
+		then $(pwd) then test | "$1" ${HOME} cd --verbose printf
+--verbose "$@" local sed done test done "$@" local -eu /usr/bin
+	local done sed sed local readonly
+		"$1" $(pwd) "$@" "$@" 2>/dev/null | | --verbose
+readonly $(pwd) | local "$@" $(pwd) x=1 awk "$1"
+		grep readonly x=1 "$1" x=1 done $(pwd) local | echo
+		printf -eu done export
+then cd local x=1 cd then cd cd printf | done | grep grep
+		-eu $(pwd) ${HOME} echo
+	x=1 grep export | $(pwd) printf test grep "$1" ${HOME} then && cd | 2>/dev/null
+done printf "$1" cd 2>/dev/null test 2>/dev/null /usr/bin
+test sed | cd /usr/bin -eu readonly cd then $(pwd) 2>/dev/null x=1 'quoted text'
+		test printf echo then export "$1" awk then readonly cd x=1
+-eu ${HOME} cd done echo readonly -eu 'quoted text'
+	grep x=1 test cd readonly 2>/dev/null && $(pwd) cd test grep --verbose $(pwd)
+		| "$@" "$1" echo /usr/bin 2>/dev/null echo local grep -eu readonly
+	2>/dev/null 'quoted text' awk awk printf done
+		export echo "$@" "$1" awk ${HOME}
+	then "$@" printf 'quoted text'
+export cd "$1" -eu then awk awk cd /usr/bin --verbose
+		x=1 then local 'quoted text' /usr/bin echo
+&& 2>/dev/null "$1" /usr/bin 2>/dev/null --verbose local
+cd export $(pwd) printf 'quoted text'
+	| | sed "$@" $(pwd) cd 'quoted text' export -eu sed local
+		echo readonly | export && 'quoted text'
+cd awk awk "$1" awk /usr/bin && -eu test "$@" --verbose
+-eu $(pwd) export ${HOME} done printf /usr/bin $(pwd) cd |
+	--verbose x=1 ${HOME} "$@" $(pwd) printf $(pwd) printf
+		sed local 'quoted text' && printf "$1" then /usr/bin -eu local cd grep
+		echo cd test ${HOME} ${HOME} 'quoted text'
+	test "$@" test test sed "$1" 2>/dev/null --verbose
+	cd echo x=1 printf cd local awk test test && then grep $(pwd) ${HOME} sed cd
+	echo readonly x=1 -eu readonly -eu /usr/bin grep
+"$@" awk echo "$@" && readonly $(pwd) /usr/bin $(pwd) printf awk then "$@" --verbose
+done "$1" cd -eu /usr/bin cd
+local "$1" 2>/dev/null -eu && x=1 "$1" printf "$@" && "$1"
+		awk cd echo readonly test
+"$@" ${HOME} "$1" -eu -eu --verbose "$1" awk x=1 2>/dev/null test "$1" && awk
+	'quoted text' | 'quoted text' test --verbose $(pwd) &&
+export cd grep readonly printf cd echo sed done -eu export | export cd | "$@"
+	${HOME} export done -eu
+test x=1 readonly then | | done
+		grep readonly --verbose echo 'quoted text' 'quoted text' then $(pwd)
+grep local ${HOME} ${HOME} awk ${HOME} local /usr/bin "$1" ${HOME} --verbose
+awk /usr/bin x=1 done $(pwd) "$1" local
+		2>/dev/null export --verbose done /usr/bin local --verbose test ${HOME} | echo
+&& then local then 'quoted text'
+		| "$@" awk 2>/dev/null test
+		"$@" local | "$@" done local done cd 'quoted text' ${HOME}
+--verbose cd grep local done local done printf echo grep sed
+	sed && ${HOME} done test printf
+	$(pwd) "$@" test 'quoted text' $(pwd) local awk awk && &&
+		"$@" sed ${HOME} --verbose $(pwd) done ${HOME} 2>/dev/null
+	x=1 grep -eu | readonly printf && x=1 | && then
+readonly test done grep $(pwd) done printf /usr/bin
+	"$1" export cd $(pwd) cd | printf test 'quoted text' && export awk done
+		cd then awk "$1" test local cd /usr/bin grep export export -eu echo --verbose
+	&& "$1" -eu local 2>/dev/null done ${HOME}
+"$1" readonly echo grep
+	awk --verbose export
+		local 2>/dev/null | x=1 x=1 echo "$@" echo ${HOME} done
+	export test | && x=1 grep grep local "$1" then cd grep export done then 'quoted text'
+--verbose then export grep then --verbose then echo "$1" grep awk
+		/usr/bin ${HOME} readonly grep test then readonly printf "$1" &&
+		/usr/bin export && export printf
+readonly cd local done echo x=1 then grep cd "$@" "$1"
+	--verbose export grep sed "$1"
+	$(pwd) printf $(pwd) done
+		&& export x=1 test ${HOME} then "$1" x=1 --verbose $(pwd)
+		--verbose test $(pwd) -eu | x=1 readonly
+		-eu 'quoted text' "$1" echo grep cd $(pwd) | ${HOME} x=1 then | 'quoted text'
+cd "$@" x=1 ${HOME} printf
+-eu grep -eu readonly echo local export "$@" printf "$1" --verbose -eu
+awk $(pwd) $(pwd) | 'quoted text'
+		done "$@" cd echo "$@" awk awk
+		sed test grep /usr/bin x=1 && ${HOME}
+echo && sed /usr/bin $(pwd)
+	printf export cd cd sed then test awk done "$@" /usr/bin
+	"$1" awk test readonly --verbose sed --verbose sed && x=1 test ${HOME}
+awk sed --verbose done then && && printf cd | | readonly && test && x=1
+| echo local -eu | test done x=1 && 'quoted text'
+test 'quoted text' grep && export
+	done sed printf echo x=1
+		cd grep ${HOME} 2>/dev/null
+		| awk /usr/bin test 'quoted text' --verbose ${HOME} awk printf
+cd ${HOME} local -eu cd -eu x=1 awk
+x=1 -eu "$@" && -eu done /usr/bin
+	export ${HOME} awk x=1 sed x=1 printf
+		then -eu "$1" ${HOME} --verbose cd then ${HOME} sed cd awk sed sed export
+	"$@" x=1 | && local $(pwd) "$@" $(pwd) local echo 'quoted text' readonly then
+		export export grep ${HOME}
+		test --verbose && 2>/dev/null 2>/dev/null done echo
+	grep --verbose /usr/bin
+	awk "$1" $(pwd) local
+		x=1 ${HOME} 'quoted text' readonly printf done && export export "$1" readonly
+/usr/bin echo ${HOME} --verbose "$@" x=1 sed sed ${HOME} readonly readonly local
+		sed ${HOME} done ${HOME} $(pwd) && $(pwd)
+		export "$@" --verbose local 'quoted text' $(pwd) printf -eu awk
+readonly echo grep sed | x=1 awk ${HOME} readonly /usr/bin
+		${HOME} $(pwd) /usr/bin sed readonly /usr/bin x=1
+	&& | test printf printf x=1 2>/dev/null echo
+| ${HOME} 2>/dev/null 'quoted text'
+	then local ${HOME} echo 'quoted text' -eu "$@" sed
+echo then $(pwd) && /usr/bin -eu "$1" cd test done ${HOME} export ${HOME}
+		${HOME} --verbose 2>/dev/null /usr/bin ${HOME} $(pwd) -eu && | x=1 grep grep -eu
+grep --verbose cd "$1" ${HOME} sed
+		x=1 | done done 2>/dev/null grep --verbose readonly then cd readonly --verbose
+	done ${HOME} --verbose test 2>/dev/null local echo "$@" printf
+/usr/bin then grep done awk
+2>/dev/null $(pwd) echo then
+	local awk --verbose ${HOME} test 'quoted text' | awk done 2>/dev/null
+	--verbose awk --verbose -eu local ${HOME} readonly /usr/bin test export echo 2>/dev/null
+		$(pwd) sed local x=1 test
+		grep "$1" readonly grep cd test readonly grep &&
+		${HOME} then sed "$@" 2>/dev/null test | test 'quoted text' -eu done | --verbose
+		${HOME} "$@" test grep then echo local
+		--verbose grep "$@" readonly
+	'quoted text' -eu awk /usr/bin "$1" "$1" sed
+		grep | echo echo | "$@" 2>/dev/null | local -eu "$@" export x=1 $(pwd) awk
+	done echo -eu sed ${HOME} -eu $(pwd) cd /usr/bin
+	readonly x=1 "$1" x=1 $(pwd) cd | 'quoted text' printf 2>/dev/null local 'quoted text'
+		readonly "$@" awk ${HOME} 'quoted text' "$@" readonly | "$@" --verbose printf
+-eu 2>/dev/null --verbose | --verbose /usr/bin echo 'quoted text' $(pwd)
+printf local grep test grep readonly
+x=1 'quoted text' 2>/dev/null --verbose local printf
+		&& readonly local 2>/dev/null readonly $(pwd) done "$1" echo then /usr/bin export
+	echo printf export && then 2>/dev/null printf "$@" awk echo printf -eu test
+		-eu | then /usr/bin grep done
+		/usr/bin "$1" test 'quoted text' x=1 awk printf $(pwd) --verbose
+		-eu "$1" && ${HOME} | && echo ${HOME} $(pwd) --verbose printf
+test && local | 2>/dev/null "$@" -eu $(pwd)
+		x=1 $(pwd) printf echo "$1" test /usr/bin readonly 2>/dev/null export
+	grep then sed $(pwd) | readonly local "$1" awk test
+2>/dev/null printf $(pwd) && 2>/dev/null
+	then /usr/bin /usr/bin 2>/dev/null $(pwd) $(pwd) "$@" x=1 x=1 sed
+		then readonly -eu $(pwd) --verbose readonly printf awk $(pwd)
+		$(pwd) echo echo --verbose readonly awk 'quoted text' x=1 -eu
+	"$@" ${HOME} $(pwd) echo 2>/dev/null $(pwd)
+	test cd test grep /usr/bin done "$@" x=1 grep ${HOME} "$@" export --verbose test
+		&& then --verbose 'quoted text'
+	grep /usr/bin then printf
+		local "$1" 2>/dev/null -eu
+		"$1" --verbose 'quoted text' x=1 /usr/bin cd $(pwd) -eu then cd
+	done /usr/bin export export x=1 /usr/bin 2>/dev/null done echo echo readonly
+$(pwd) sed readonly echo | -eu --verbose "$1" local echo $(pwd)
+	x=1 /usr/bin local && grep ${HOME} done "$@" grep test x=1 --verbose cd then
+cd then sed "$@" printf sed x=1 then /usr/bin | readonly export "$@" ${HOME}
+printf && test then | echo cd grep | readonly 'quoted text'
+		local /usr/bin readonly export
+readonly 'quoted text' --verbose "$@" awk
+	2>/dev/null awk export --verbose
+	test local && export done then ${HOME}
+	echo /usr/bin export local
+		2>/dev/null awk echo local grep |
+	2>/dev/null 2>/dev/null awk echo $(pwd)
+	&& && done "$@" "$@" printf then
+		local done local test echo done
+x=1 cd test then local x=1 && 2>/dev/null printf
+		echo done export awk grep done 2>/dev/null export then && awk
+		'quoted text' ${HOME} x=1 grep -eu sed printf x=1 sed
+	local 'quoted text' printf /usr/bin --verbose printf
+	-eu x=1 $(pwd) cd 'quoted text' -eu then | cd 'quoted text' | $(pwd) done test
+	printf 2>/dev/null grep cd 'quoted text' printf "$@" $(pwd) &&
+		-eu -eu 'quoted text' printf local
+	--verbose awk done $(pwd) x=1 && "$@" ${HOME} $(pwd) $(pwd) export done
+	&& | printf grep 'quoted text' "$1" local
+		export cd --verbose | | x=1 then 'quoted text' --verbose
+		&& echo | | $(pwd) ${HOME} x=1 "$@" sed 'quoted text' 'quoted text'
+sed cd printf printf printf then $(pwd) | awk ${HOME}
+${HOME} --verbose -eu x=1 test sed awk 2>/dev/null awk -eu done -eu
+		/usr/bin $(pwd) sed done -eu printf test "$@" sed -eu
+		export x=1 --verbose awk awk sed x=1 export -eu
+		"$1" export done export printf test 2>/dev/null
+		test $(pwd) done export sed x=1 echo --verbose
+	echo awk echo local -eu
+		then cd "$@" --verbose printf "$@" readonly "$1" grep done
+	test -eu echo local "$1" 2>/dev/null echo /usr/bin | /usr/bin
+	export echo --verbose export /usr/bin
+		echo export sed | -eu echo sed 'quoted text' $(pwd) test ${HOME} printf ${HOME}
+	${HOME} -eu readonly "$@" then &&
+$(pwd) then -eu cd && -eu
+		"$@" "$@" sed x=1 echo ${HOME} ${HOME} done x=1 && &&
+	cd x=1 "$1" grep | | grep done readonly grep ${HOME} ${HOME} --verbose /usr/bin
+	grep then 2>/dev/null 2>/dev/null grep /usr/bin
+	cd done -eu && awk printf --verbose
+	done && readonly ${HOME} awk printf -eu 'quoted text' "$@" /usr/bin then
+--verbose cd 'quoted text' /usr/bin
+	then -eu local 2>/dev/null done -eu sed awk grep | ${HOME}
+done --verbose export cd "$1" /usr/bin | echo -eu export echo
+	"$1" local readonly awk awk
+		${HOME} | x=1 echo readonly grep | "$1" 2>/dev/null cd then 'quoted text'
+"$@" grep export grep done local "$@" printf
+	done | "$@" cd test export cd 2>/dev/null --verbose local ${HOME}
+readonly done | 'quoted text' then sed readonly
+	"$@" "$@" export printf "$1" awk $(pwd) /usr/bin
+	export "$1" sed /usr/bin "$1" && readonly readonly printf 2>/dev/null sed
+	local && grep "$1" then --verbose ${HOME} && then cd done export 'quoted text'
+$(pwd) then 'quoted text' cd awk "$@" echo awk 'quoted text'
+		local test && x=1 export | sed /usr/bin then "$1" done /usr/bin done "$@"
+	&& done then x=1 then -eu awk export
+local local test cd -eu
+	"$@" /usr/bin echo local echo -eu -eu "$@" -eu x=1 then then cd 'quoted text'
+		2>/dev/null test test export test 2>/dev/null done cd
+'quoted text' then cd x=1 && printf --verbose then echo && "$@" && 'quoted text'
+		| /usr/bin export local test "$@" /usr/bin readonly 'quoted text' done
+	'quoted text' /usr/bin done echo --verbose readonly ${HOME} done && 'quoted text'
+	done "$1" local grep done | then test && --verbose then
+	&& | done --verbose 2>/dev/null "$@" --verbose test 'quoted text' && export awk
+test "$1" grep && x=1 echo done then test "$@" echo 2>/dev/null export "$1" &&
+		--verbose awk grep echo | x=1 2>/dev/null 'quoted text' && sed then x=1 "$1"
+		grep ${HOME} -eu then /usr/bin ${HOME} -eu cd --verbose readonly
+		'quoted text' grep 'quoted text' 2>/dev/null | -eu "$@" grep ${HOME}
+		&& x=1 -eu printf grep done && printf then export local export x=1
+		sed grep sed -eu ${HOME} -eu sed awk then local local readonly sed
+	&& grep 'quoted text' /usr/bin readonly local cd readonly 2>/dev/null grep
+		done sed --verbose test "$@" /usr/bin ${HOME} then grep readonly 2>/dev/null
+	echo ${HOME} "$@" local cd ${HOME} printf
+	echo cd $(pwd) --verbose echo done /usr/bin 'quoted text'
+readonly /usr/bin export done cd ${HOME} 'quoted text' export
+	&& printf local readonly $(pwd) "$1" awk done 'quoted text' $(pwd)
+		--verbose "$1" "$@" /usr/bin done test $(pwd) awk --verbose && --verbose
+	$(pwd) "$@" 'quoted text' /usr/bin $(pwd) awk echo
+"$@" -eu readonly 'quoted text' readonly /usr/bin sed printf | local $(pwd)
+	awk ${HOME} printf export "$1" local 'quoted text'
+&& cd grep -eu /usr/bin
+export -eu awk ${HOME} awk x=1 sed done grep --verbose export echo
+		"$1" 'quoted text' -eu printf ${HOME} 2>/dev/null
+		local awk readonly && sed export "$1" ${HOME} sed cd cd "$@" echo export x=1
+	"$1" -eu echo 'quoted text' test printf cd printf export sed local
+	done cd export && export export
+sed "$@" -eu "$1" | done "$1"
+cd | sed 'quoted text' done
+		$(pwd) 2>/dev/null done local && && done -eu "$1"
+	test awk export echo cd
+	done then -eu cd awk 'quoted text'
+	'quoted text' $(pwd) /usr/bin grep ${HOME} 'quoted text' echo printf
+"$1" x=1 && sed readonly cd /usr/bin ${HOME} 'quoted text'
+-eu --verbose --verbose sed | readonly $(pwd) done cd /usr/bin
+	/usr/bin 2>/dev/null done
+	cd x=1 export && 'quoted text' echo test "$1" done readonly grep cd done "$1" then
+	'quoted text' "$1" /usr/bin awk /usr/bin ${HOME}
+x=1 2>/dev/null sed local done
+		echo awk then local then $(pwd) x=1 ${HOME} "$@" cd "$1" $(pwd) sed
+	awk readonly done cd local &&
+$(pwd) grep local local 'quoted text'
+		/usr/bin ${HOME} -eu && cd -eu /usr/bin
+	'quoted text' export test printf echo "$1"
+	2>/dev/null --verbose x=1 ${HOME} then /usr/bin "$@" export
+		sed then -eu --verbose "$@" | grep
+	echo ${HOME} "$@" --verbose --verbose
+| $(pwd) "$1" --verbose grep printf test grep
+	--verbose "$@" readonly echo 2>/dev/null echo && then printf $(pwd)
+		&& then /usr/bin local readonly "$@" printf
+		&& echo local && then
+	2>/dev/null "$1" grep 'quoted text'
+	--verbose cd $(pwd) && 2>/dev/null test --verbose
+then 'quoted text' test done $(pwd) printf
+		local 2>/dev/null readonly printf done -eu export $(pwd) $(pwd)
+test printf readonly --verbose grep readonly 2>/dev/null awk x=1 2>/dev/null
+test /usr/bin done $(pwd) /usr/bin
+		--verbose awk 2>/dev/null 2>/dev/null
+	x=1 readonly sed grep awk 'quoted text' &&
+'quoted text' 'quoted text' done local $(pwd) && sed
+		awk x=1 'quoted text' sed --verbose "$1" printf cd
+x=1 done cd "$@" printf -eu cd $(pwd) --verbose x=1 then readonly
+&& | cd grep "$1" grep ${HOME} test
+	"$@" ${HOME} x=1 export export
+'quoted text' local echo export export echo sed
+	x=1 x=1 echo --verbose export x=1 ${HOME} test "$@" --verbose
+test cd test && && --verbose --verbose done printf "$@" local -eu "$@" export
+"$@" sed $(pwd) x=1 x=1 done sed export export -eu | then grep 2>/dev/null
+		test && 2>/dev/null grep printf done sed "$1" then && $(pwd) x=1
+	readonly readonly echo -eu sed sed done local
+		then 'quoted text' cd $(pwd) "$@" x=1 local $(pwd) awk | 2>/dev/null x=1
+		-eu $(pwd) done export echo then sed local /usr/bin printf /usr/bin 2>/dev/null
+	readonly local -eu --verbose local sed "$@" sed 2>/dev/null local
+then sed x=1 then 'quoted text' export grep ${HOME} 'quoted text' 'quoted text'
+		test "$1" done awk ${HOME} 2>/dev/null && 2>/dev/null
+	'quoted text' /usr/bin grep awk then --verbose readonly export done 2>/dev/null
+	test "$1" grep export then -eu && "$1" 2>/dev/null
+		2>/dev/null grep local cd -eu 'quoted text'
+	then printf sed sed | "$1" export 'quoted text' test local x=1 "$1"
+test done sed readonly $(pwd) $(pwd) local x=1 ${HOME}
+	-eu && ${HOME} 2>/dev/null then
+	echo --verbose local "$@" then "$@" --verbose && awk && && -eu printf
+	x=1 && echo /usr/bin "$1" --verbose done x=1 local awk echo
+		$(pwd) -eu x=1 test "$1" && /usr/bin
+	export printf grep | "$1" local then ${HOME} --verbose test /usr/bin
+&& 2>/dev/null local printf grep
+		printf ${HOME} 'quoted text' --verbose --verbose
+cd awk done printf x=1
+-eu -eu readonly then -eu && then
+${HOME} export ${HOME} export "$1" grep cd grep 'quoted text'
+/usr/bin | $(pwd) && 'quoted text' 'quoted text' then "$@" echo
+		then done done test | grep "$@" sed then cd sed 2>/dev/null
+		x=1 test echo "$1" $(pwd) done 'quoted text'
+		$(pwd) /usr/bin "$1" $(pwd) && printf grep echo test done /usr/bin
+		| local sed -eu printf 2>/dev/null awk grep
+	local local --verbose
+	&& test $(pwd) $(pwd) "$1" && printf then test local cd ${HOME}
+	sed readonly export printf cd | x=1 local echo "$1" 2>/dev/null grep then /usr/bin
+echo grep sed ${HOME} && awk ${HOME} "$@" done awk
+		grep cd then done echo readonly /usr/bin then /usr/bin done
+x=1 2>/dev/null local "$@" then then then && awk && local printf x=1 cd
+	done 'quoted text' readonly "$1" -eu --verbose echo awk --verbose 2>/dev/null
+	local done 'quoted text' /usr/bin
+	2>/dev/null && grep --verbose grep 'quoted text'
+		local awk --verbose 'quoted text' then x=1 "$@" cd export
+	| "$1" awk "$1" "$@" "$@" && then "$1"
+		--verbose then local | sed
+		2>/dev/null done printf sed 2>/dev/null grep $(pwd) readonly | $(pwd)
+		export x=1 'quoted text' -eu then awk 2>/dev/null
+		readonly -eu printf cd x=1 $(pwd) done | $(pwd) printf
+		export | ${HOME} "$@" awk local cd test /usr/bin --verbose printf -eu
+	--verbose 2>/dev/null then test echo ${HOME} grep local grep
+${HOME} awk sed "$1" && sed 'quoted text' readonly readonly
+	${HOME} sed grep "$1" grep 2>/dev/null -eu grep cd --verbose then then "$1" 'quoted text'
+		&& awk /usr/bin | local -eu sed
+		x=1 && printf --verbose cd done -eu 'quoted text'
+	${HOME} 2>/dev/null ${HOME} grep "$@" -eu -eu && /usr/bin printf
+	echo awk echo echo export --verbose local x=1 $(pwd) --verbose /usr/bin && echo
+then && $(pwd) sed echo readonly x=1 cd grep "$@" sed && && && then
+	"$1" /usr/bin awk 'quoted text' 'quoted text' $(pwd)
+	x=1 -eu "$1" readonly test -eu echo && "$1" --verbose x=1 x=1 cd done
+x=1 local test /usr/bin 2>/dev/null 'quoted text' export ${HOME} 2>/dev/null
+${HOME} --verbose sed then | then done && then
+| "$@" -eu /usr/bin --verbose
+"$1" printf then printf 2>/dev/null && cd export 'quoted text'
+	| sed -eu cd | readonly "$1" echo test 2>/dev/null
+	sed done "$@" --verbose awk --verbose -eu done /usr/bin 2>/dev/null
+sed grep echo -eu | readonly --verbose
+		cd sed $(pwd) test && 'quoted text' export "$1" &&
+		-eu 2>/dev/null "$@" ${HOME} then "$@" --verbose "$@" && x=1 test then | then
+		/usr/bin --verbose x=1 local test readonly printf
+		done grep "$@" readonly --verbose ${HOME} $(pwd) 'quoted text'
+	sed ${HOME} echo x=1 local 2>/dev/null printf sed
+		${HOME} done -eu --verbose export 'quoted text'
+		${HOME} 2>/dev/null export 2>/dev/null
+	--verbose -eu local "$@" ${HOME} 2>/dev/null ${HOME} "$@" printf printf export
+grep x=1 x=1 "$@" echo awk readonly echo 2>/dev/null
+"$@" awk ${HOME} -eu 'quoted text' ${HOME} export
+'quoted text' -eu test --verbose x=1 2>/dev/null && done
+	x=1 printf printf ${HOME} /usr/bin -eu "$@" 'quoted text' && export awk --verbose
+		export echo then echo then awk awk sed 2>/dev/null done then x=1 -eu "$1"
+	awk grep | | cd grep $(pwd) && && $(pwd) sed
+	local "$@" local /usr/bin local 2>/dev/null
+readonly cd 'quoted text' 'quoted text' -eu done && cd awk cd printf --verbose
+		done test "$@" && sed
+	grep echo awk readonly grep grep 'quoted text'
+	x=1 printf $(pwd) export test -eu done
+export 'quoted text' grep cd awk | /usr/bin then printf cd sed
+		$(pwd) echo ${HOME} grep
+	echo grep readonly $(pwd) cd /usr/bin /usr/bin then ${HOME} && grep
+		$(pwd) grep 'quoted text' printf /usr/bin
+cd /usr/bin printf "$1" $(pwd) 'quoted text'
+awk sed "$1" "$1" local "$1" export x=1 awk echo grep printf --verbose
+		echo then -eu readonly export awk printf $(pwd) export test
+export "$@" printf 'quoted text'
+	x=1 -eu local $(pwd) -eu "$1" "$@" /usr/bin awk "$1" 'quoted text' readonly ${HOME}
+&& /usr/bin ${HOME} readonly "$@" 'quoted text' grep grep $(pwd) test export
+		done awk && 'quoted text' $(pwd) x=1 'quoted text' cd local x=1 awk x=1 $(pwd)
+	sed ${HOME} x=1 export -eu test
+2>/dev/null "$@" 'quoted text' "$@" printf grep
+--verbose grep ${HOME} $(pwd) awk
+		&& | test -eu awk test then grep sed $(pwd) "$@" readonly
+		then -eu export test export readonly x=1 -eu 2>/dev/null -eu "$1" local
+	--verbose done done "$1" x=1 "$1" 2>/dev/null
+	readonly 2>/dev/null sed echo awk grep printf ${HOME} "$1" then
+	"$@" readonly 2>/dev/null /usr/bin export test | /usr/bin
+2>/dev/null test then "$@" printf "$@" awk done echo done done sed ${HOME}
+		x=1 awk "$1" then echo grep test local echo
+	2>/dev/null ${HOME} "$@"
+	export --verbose printf sed ${HOME} cd x=1 2>/dev/null /usr/bin ${HOME} --verbose
+	echo readonly x=1 export cd 2>/dev/null done x=1 /usr/bin
+		readonly export awk cd && printf cd cd then -eu printf && --verbose ${HOME}
+	-eu && -eu --verbose
+		sed "$1" then cd export -eu sed /usr/bin echo cd $(pwd) readonly
+local x=1 | 'quoted text' local "$1" "$@" grep readonly test
+-eu sed "$1" printf readonly $(pwd) x=1 cd cd --verbose awk then local x=1
+		'quoted text' printf echo ${HOME}
+		printf /usr/bin -eu /usr/bin ${HOME} printf test echo done printf "$@" -eu awk
+sed "$@" $(pwd) grep grep readonly echo echo /usr/bin local echo --verbose
+		&& sed 'quoted text' awk | readonly done export /usr/bin $(pwd)
+		2>/dev/null printf sed export $(pwd) && | then /usr/bin
+	readonly $(pwd) 'quoted text' awk /usr/bin "$1" && ${HOME} -eu --verbose
+		$(pwd) 'quoted text' $(pwd) done cd --verbose --verbose
+	"$@" readonly 'quoted text' test cd 'quoted text' grep local
+x=1 cd -eu printf export grep awk cd "$1"
+	awk cd "$1" 2>/dev/null printf
+		cd "$1" $(pwd) echo ${HOME} "$1"
+		| --verbose "$1" "$1" --verbose grep test "$@" export awk awk 2>/dev/null
+		cd export "$1" local --verbose
+	${HOME} awk 'quoted text' -eu /usr/bin 'quoted text' done grep done test
+test ${HOME} local awk 2>/dev/null
+		&& && && echo awk done
+	readonly sed cd export "$@"
+		/usr/bin 'quoted text' | 2>/dev/null
+| ${HOME} export echo test "$1" printf done echo local $(pwd) test echo then &&
+	sed sed done /usr/bin $(pwd) echo readonly /usr/bin
+	readonly then x=1 && 'quoted text' "$@" local readonly
+local x=1 --verbose -eu "$1" done echo 2>/dev/null | awk
+		/usr/bin && cd $(pwd) --verbose echo printf local --verbose "$1"
+	'quoted text' export awk grep awk cd cd local printf
+		| grep "$@" echo cd echo local awk
+'quoted text' awk then export --verbose
+		then then done sed grep readonly test 2>/dev/null 'quoted text'
+	"$@" printf done readonly /usr/bin
+	/usr/bin awk test && 'quoted text' /usr/bin | -eu ${HOME}
+		awk -eu sed export export ${HOME} sed $(pwd) --verbose
+| && readonly x=1 x=1 awk grep /usr/bin x=1 /usr/bin printf readonly -eu /usr/bin
+		test local $(pwd) local $(pwd) done cd && 'quoted text'
+		| x=1 ${HOME} readonly "$@" readonly
+		x=1 $(pwd) cd --verbose
+	done | 'quoted text' "$@" $(pwd) echo x=1 "$1" printf 2>/dev/null
+		"$@" cd x=1 then local awk --verbose 2>/dev/null printf
+then x=1 && readonly export echo /usr/bin test --verbose
+	done && "$@" local local &&
+	${HOME} done -eu /usr/bin && echo x=1 | done
+		printf test --verbose sed $(pwd) cd awk awk
+		--verbose && $(pwd) export ${HOME} local export
+		--verbose --verbose | $(pwd) sed readonly ${HOME} done then 'quoted text'
+	--verbose local x=1 x=1 awk cd cd -eu grep
+'quoted text' x=1 $(pwd) awk && grep -eu cd echo $(pwd)
+		readonly $(pwd) echo -eu 2>/dev/null "$@"
+export awk && 2>/dev/null then cd sed readonly
+/usr/bin | awk && 2>/dev/null 2>/dev/null
+${HOME} printf | x=1 "$@" done printf x=1
+		grep /usr/bin test /usr/bin grep done $(pwd) -eu sed
+	test local x=1 readonly then --verbose cd cd &&
+		/usr/bin awk $(pwd) $(pwd) ${HOME} printf x=1 then readonly grep done -eu x=1
+	"$@" $(pwd) test echo x=1 | 2>/dev/null cd readonly "$@" 'quoted text'
+&& export --verbose | export x=1 export cd --verbose --verbose then 2>/dev/null
+		done grep done -eu then "$1" then
+&& then "$@" x=1 readonly export local "$1" sed cd
+	test readonly $(pwd) local 2>/dev/null printf 2>/dev/null --verbose
+	awk && /usr/bin ${HOME} cd -eu local 'quoted text' done
+	/usr/bin | cd done -eu --verbose then
+		echo "$@" "$@" "$@" /usr/bin cd echo &&
+		x=1 /usr/bin then printf cd sed "$@" local x=1 | cd local | --verbose
+	local cd sed readonly | ${HOME} export
+echo ${HOME} 2>/dev/null
+2>/dev/null local done echo
+	/usr/bin "$@" done export printf done printf -eu echo
+	--verbose x=1 "$1" "$@" then ${HOME} --verbose --verbose -eu
+test export printf cd -eu
+	$(pwd) "$@" then $(pwd) -eu && "$1" printf
+--verbose 2>/dev/null echo awk
+#include c56.sh
+--verbose x=1 export awk -eu cd readonly printf test /usr/bin export local
+	echo /usr/bin done -eu "$@" "$1" echo ${HOME} --verbose done export
+x=1 -eu grep then -eu "$@" --verbose cd 2>/dev/null 'quoted text' |
+	local ${HOME} ${HOME} -eu cd --verbose echo export | | x=1 ${HOME} echo sed
+	"$1" --verbose && /usr/bin sed done
+		| -eu printf 'quoted text'
+	echo local | echo echo
+		-eu --verbose printf export cd /usr/bin done "$1" printf
+	2>/dev/null 'quoted text' readonly "$1" x=1 readonly test
+		local "$@" -eu local local done readonly x=1 && local 'quoted text' 'quoted text'
+	"$1" && echo && /usr/bin /usr/bin
+		${HOME} --verbose then export ${HOME} "$1" awk && test 2>/dev/null
+2>/dev/null done x=1 && --verbose sed 'quoted text'
+	local ${HOME} cd test echo cd --verbose export -eu --verbose $(pwd)
+	$(pwd) && export printf ${HOME} /usr/bin grep
+		sed "$@" done 'quoted text'
+grep 'quoted text' 2>/dev/null export 'quoted text' grep
+	awk "$@" /usr/bin export export | $(pwd) test done
+export grep | 'quoted text' 2>/dev/null --verbose
+	test export printf "$1" && printf grep "$1" -eu cd echo
+'quoted text' then grep --verbose then
+		2>/dev/null ${HOME} -eu readonly
+	-eu done awk | echo export
+	done $(pwd) cd && /usr/bin sed local && local x=1 /usr/bin grep -eu 2>/dev/null
+test cd test sed x=1 local "$@" cd grep awk $(pwd) && done "$@" /usr/bin
+	$(pwd) sed -eu printf
+-eu cd x=1 done test 'quoted text' awk 2>/dev/null grep export
+then /usr/bin -eu 2>/dev/null
+		"$@" done local 2>/dev/null "$1" export | awk
+	"$1" $(pwd) 'quoted text' grep done 2>/dev/null printf printf printf
+		test test local grep --verbose sed | readonly then
+		'quoted text' local sed "$1" sed printf "$@" 'quoted text'
+"$@" grep grep 'quoted text' echo test && --verbose
+		cd && && done | $(pwd) awk 2>/dev/null ${HOME} | $(pwd) 2>/dev/null
+		&& echo test 2>/dev/null x=1 test 2>/dev/null "$1"
+	grep --verbose cd local echo then "$@" ${HOME}
+		echo then --verbose --verbose -eu --verbose /usr/bin | $(pwd) "$@"
+readonly "$1" test x=1 export "$@" test | "$@" "$@" "$1" printf done
+	"$@" "$@" printf test x=1 x=1 printf
+		done awk | 'quoted text' -eu grep
+		done test ${HOME} then x=1 cd
+	2>/dev/null test then local export
+	&& x=1 /usr/bin test "$@" --verbose "$@" printf test grep "$1"
+		/usr/bin grep awk echo cd cd cd export |
+-eu -eu 2>/dev/null grep 2>/dev/null 'quoted text' done done /usr/bin
+		&& cd cd local /usr/bin -eu -eu local cd | /usr/bin test /usr/bin local --verbose
+	${HOME} sed /usr/bin done printf "$@"
+		export "$@" -eu cd readonly
+	export x=1 awk then && grep printf printf /usr/bin export local readonly /usr/bin
+$(pwd) 'quoted text' cd
+--verbose printf awk echo /usr/bin -eu awk --verbose
+"$@" test cd then 'quoted text' test --verbose 2>/dev/null "$@" $(pwd) grep readonly
+then /usr/bin $(pwd) sed --verbose 2>/dev/null readonly "$1" then x=1 x=1
+	/usr/bin --verbose readonly $(pwd) then x=1 local $(pwd) 2>/dev/null
+		done /usr/bin test "$1" | ${HOME}
+	printf /usr/bin x=1 printf ${HOME}
+	/usr/bin test export readonly 'quoted text' export awk "$1" grep echo 'quoted text'
+	&& -eu printf test && cd test
+		then "$@" -eu && 'quoted text'
+		readonly done local awk printf then && awk -eu 2>/dev/null "$@" readonly echo
+local sed printf test echo --verbose -eu "$@" -eu 2>/dev/null /usr/bin -eu 2>/dev/null
+local grep 2>/dev/null cd "$@" grep
+	-eu local /usr/bin test -eu $(pwd) 2>/dev/null
+		sed | x=1 'quoted text' readonly awk sed export echo | ${HOME} printf ${HOME} ${HOME}
+		awk ${HOME} cd grep sed ${HOME} "$@" /usr/bin -eu -eu && ${HOME} awk $(pwd) export
+		awk then done awk sed "$@" sed ${HOME} export
+	-eu "$1" printf --verbose -eu printf printf export
+	2>/dev/null done -eu | local --verbose awk awk then
+	"$@" -eu test test done export --verbose printf x=1 sed
+		-eu echo readonly $(pwd) ${HOME} then printf done local x=1 echo --verbose
+		&& sed && readonly printf $(pwd) sed -eu
+		sed awk x=1 test grep --verbose
+readonly readonly x=1 $(pwd) sed grep
+	x=1 --verbose $(pwd) -eu grep "$@"
+		echo 'quoted text' done cd awk sed cd "$1" local export | "$@" x=1
+	${HOME} export export done
+2>/dev/null && export 'quoted text' export awk x=1 grep 2>/dev/null
+then "$1" cd export echo ${HOME} -eu cd grep -eu echo local
+		2>/dev/null then readonly 2>/dev/null cd 'quoted text' readonly echo echo
+"$@" 2>/dev/null "$@" 2>/dev/null printf
+		done grep done "$@" printf --verbose grep "$1" grep 2>/dev/null ${HOME}
+x=1 /usr/bin && readonly "$@" printf cd $(pwd) -eu sed ${HOME}
+then printf ${HOME} export echo then "$@" -eu -eu test readonly x=1
+		local x=1 -eu cd 2>/dev/null -eu 'quoted text' awk
+${HOME} echo --verbose ${HOME}
+		readonly test -eu echo sed --verbose -eu | $(pwd) "$@" readonly grep --verbose
+done -eu test x=1 2>/dev/null readonly then
+	awk /usr/bin echo && test grep done readonly local
+	"$@" ${HOME} 2>/dev/null done test "$1"
+		printf ${HOME} awk test echo
+2>/dev/null $(pwd) export cd local 'quoted text' ${HOME}
+/usr/bin test sed cd readonly | cd cd local echo -eu test /usr/bin test 'quoted text'
+	test echo echo printf 2>/dev/null -eu 'quoted text'
+		'quoted text' then echo printf awk --verbose echo
+"$1" ${HOME} printf $(pwd) grep | ${HOME} local
+'quoted text' awk "$@" "$@" "$1" test -eu $(pwd) export
+		--verbose ${HOME} | then $(pwd) done sed -eu export /usr/bin && "$1" sed "$1"
+	'quoted text' -eu x=1 readonly && echo local
+		"$1" cd 2>/dev/null awk grep ${HOME} readonly local 'quoted text'
+		x=1 awk awk x=1 export grep
+&& echo -eu cd sed -eu | && ${HOME} | | sed cd printf
+	printf sed done awk && echo printf | export cd
+		grep x=1 && readonly ${HOME}
+	echo test echo -eu printf 'quoted text' 2>/dev/null ${HOME}
+		echo export sed 2>/dev/null | grep 2>/dev/null
+	done grep export && ${HOME} && done sed then export "$@" readonly
+test -eu /usr/bin x=1 local
+test && ${HOME} $(pwd) && /usr/bin
+--verbose cd $(pwd) test done | test test cd 'quoted text' | --verbose
+| local ${HOME} "$@" done && 2>/dev/null | --verbose printf $(pwd) -eu sed
+		${HOME} 'quoted text' -eu cd printf awk 'quoted text'
+echo sed cd 'quoted text' "$@" $(pwd) -eu 2>/dev/null
+	"$1" awk done "$@" && ${HOME}
+		${HOME} grep | sed cd echo export
+"$1" then -eu test cd printf --verbose
+		then done --verbose cd printf --verbose
+printf echo sed ${HOME} then then done local "$1" local /usr/bin 'quoted text'
+local grep $(pwd) "$@" ${HOME}
+		-eu awk x=1 grep 2>/dev/null
+awk cd $(pwd) 'quoted text'
+export -eu then x=1 sed echo ${HOME} echo grep sed then printf
+	-eu done x=1 --verbose cd "$@" ${HOME}
+		local $(pwd) grep -eu /usr/bin sed sed done -eu awk --verbose sed 2>/dev/null
+	export --verbose "$1" 2>/dev/null printf
+$(pwd) export "$1" test
+	readonly done ${HOME} "$@" test printf $(pwd) $(pwd) local
+	$(pwd) 'quoted text' --verbose done
+	local echo grep done
+	then 2>/dev/null then --verbose
+$(pwd) "$1" | then --verbose readonly export echo -eu test
+-eu 'quoted text' /usr/bin ${HOME} echo cd sed test $(pwd) ${HOME} 'quoted text'
+	then readonly | ${HOME} readonly echo | test
+	local 'quoted text' grep cd export grep && 2>/dev/null
+sed 'quoted text' /usr/bin test then 2>/dev/null 2>/dev/null awk --verbose local
+	awk ${HOME} 2>/dev/null export
+	printf printf printf "$1" done then $(pwd) awk sed | --verbose
+		| local local test export test $(pwd) 2>/dev/null x=1 $(pwd) /usr/bin
+2>/dev/null awk done ${HOME} local && cd readonly then export grep test
+	'quoted text' x=1 --verbose ${HOME} "$1" done test echo
+grep then -eu --verbose /usr/bin -eu 2>/dev/null | | | -eu awk echo then
+		/usr/bin 2>/dev/null readonly | --verbose export && -eu 2>/dev/null
+	${HOME} $(pwd) printf --verbose export -eu
+		"$@" grep /usr/bin --verbose readonly --verbose x=1 "$@" echo /usr/bin then local
+then 2>/dev/null /usr/bin --verbose --verbose test && printf 'quoted text'
+	-eu awk echo readonly export printf
+		sed "$1" /usr/bin local cd cd then readonly
+		2>/dev/null readonly cd ${HOME} /usr/bin
+local x=1 readonly echo export sed "$1" then printf echo cd && /usr/bin
+	/usr/bin readonly && echo readonly && test cd sed 'quoted text' "$@"
+		test | printf "$1" then /usr/bin awk cd | "$@" readonly --verbose
+	then printf printf grep && "$1" printf sed ${HOME} "$@"
+&& done local readonly cd done 2>/dev/null test done echo
+		$(pwd) done echo $(pwd) "$@" sed "$@" echo -eu /usr/bin done awk
+	local printf | 2>/dev/null local
+		then /usr/bin "$1" "$@" done 2>/dev/null sed grep echo
+	then then echo grep ${HOME} export | done x=1
+	readonly echo 2>/dev/null
+	$(pwd) /usr/bin "$1"
+grep grep awk sed printf 'quoted text' cd local readonly echo export -eu
+2>/dev/null 2>/dev/null -eu sed printf ${HOME} && /usr/bin | echo 2>/dev/null
+		--verbose | awk export $(pwd) test 'quoted text'
+		| awk 'quoted text' x=1 /usr/bin test readonly "$1" /usr/bin -eu awk
+"$1" /usr/bin echo -eu && && export 2>/dev/null
+export readonly 2>/dev/null grep then export readonly sed "$@"
+	"$@" $(pwd) /usr/bin sed grep grep "$1" ${HOME}
+		${HOME} echo local "$1" $(pwd) $(pwd) then export 'quoted text' then 2>/dev/null
+--verbose test echo echo $(pwd) printf grep $(pwd) 2>/dev/null readonly x=1
+printf export "$1" cd readonly awk "$@" && done awk && ${HOME} -eu /usr/bin
+grep ${HOME} cd x=1 | 2>/dev/null 2>/dev/null x=1 then awk export
+done printf echo x=1 ${HOME} /usr/bin local
+	/usr/bin 'quoted text' --verbose awk local readonly --verbose --verbose
+	"$1" local sed | cd sed cd cd $(pwd) export
+	/usr/bin export | && "$1" -eu 'quoted text' $(pwd) "$1" 2>/dev/null done
+	'quoted text' "$1" 2>/dev/null && awk 2>/dev/null
+	echo awk /usr/bin done printf | sed 2>/dev/null
+	-eu --verbose printf done
+	"$1" printf --verbose $(pwd) readonly then 2>/dev/null
+${HOME} printf cd ${HOME} test awk echo awk /usr/bin readonly export "$@"
+	x=1 sed "$@" export sed awk && local $(pwd) done --verbose test local test | /usr/bin
+	"$1" 2>/dev/null && awk 2>/dev/null 2>/dev/null awk 'quoted text'
+local readonly grep "$1" test x=1 && | test
+	then printf 'quoted text' done local echo grep
+		$(pwd) "$1" "$@" -eu then test ${HOME} done 2>/dev/null done $(pwd) grep
+		readonly echo printf test awk readonly --verbose
+	--verbose | -eu awk | -eu sed echo awk then local ${HOME} awk then grep 'quoted text'
+	"$@" echo awk --verbose cd 'quoted text' local
+		test local "$1" --verbose
+sed sed export ${HOME} -eu && echo sed /usr/bin -eu ${HOME} done /usr/bin
+	done cd "$@" $(pwd) && awk grep cd -eu "$1" grep then --verbose
+	grep --verbose done done grep -eu printf 2>/dev/null "$@" printf ${HOME}
+	| grep 'quoted text' echo 'quoted text'
+		| export | ${HOME} echo ${HOME} "$@" "$@" grep sed $(pwd) printf "$@"
+"$@" echo -eu readonly readonly
+printf local "$1" done /usr/bin 2>/dev/null --verbose
+	readonly /usr/bin -eu ${HOME} && 'quoted text'
+sed printf -eu grep && "$@" cd -eu | && /usr/bin 'quoted text'
+	2>/dev/null cd ${HOME} | readonly
+	printf cd grep sed export awk $(pwd) readonly --verbose printf awk
+	-eu /usr/bin --verbose
+	printf 2>/dev/null echo echo -eu done export
+		readonly "$@" -eu "$1" --verbose sed /usr/bin cd printf readonly --verbose
+	test $(pwd) done "$1" export "$1" sed | "$1" x=1 cd && echo "$@"
+		| sed echo awk && x=1 local readonly
+export printf | -eu | 'quoted text' cd sed 'quoted text' echo test
+	awk local readonly grep echo then
+local grep cd && local readonly "$1" && 'quoted text'
+	2>/dev/null done | --verbose echo cd && 'quoted text' 'quoted text'
+awk readonly done printf then "$@" cd export && local echo
+		readonly -eu grep cd sed awk x=1 done "$1" /usr/bin
+sed "$1" "$@" echo $(pwd)
+	test | grep awk grep 'quoted text'
+	-eu -eu then x=1 "$@" | echo /usr/bin 2>/dev/null
+		export 'quoted text' ${HOME} | test local
+	done x=1 readonly && done cd export export | $(pwd) -eu
+sed done local cd -eu
+readonly /usr/bin echo 2>/dev/null then sed && "$1" sed
+| | readonly test echo "$1" test 'quoted text'
+		${HOME} printf $(pwd) local local sed readonly 'quoted text' local
+printf ${HOME} export | 2>/dev/null done 2>/dev/null
+		--verbose readonly $(pwd) | done echo x=1 readonly
+${HOME} --verbose then "$@" $(pwd) awk test echo grep sed ${HOME} $(pwd) 'quoted text'
+sed && "$@" echo echo local x=1 sed ${HOME}
+	grep local x=1 export printf printf &&
+		export $(pwd) sed echo then test -eu && $(pwd) export cd then --verbose awk local
+	local | awk 'quoted text' && grep && awk
+	/usr/bin 2>/dev/null then local
+	-eu && readonly awk "$1" "$@" printf
+-eu /usr/bin echo printf grep x=1 /usr/bin
+	"$1" local cd 'quoted text' && sed printf test --verbose
+export 'quoted text' /usr/bin local 2>/dev/null awk -eu /usr/bin
+x=1 test test echo readonly -eu /usr/bin test readonly
+	2>/dev/null /usr/bin export "$@" ${HOME} 2>/dev/null ${HOME} local
+		awk grep local --verbose then 'quoted text' 2>/dev/null $(pwd)
+${HOME} awk 2>/dev/null grep local /usr/bin
+	| x=1 2>/dev/null -eu
+$(pwd) printf --verbose then sed sed $(pwd) awk sed | "$@" grep 2>/dev/null
+local --verbose local $(pwd) -eu printf echo then sed ${HOME} "$@" test --verbose
+--verbose echo 2>/dev/null /usr/bin
+	| export export 2>/dev/null | 2>/dev/null -eu grep printf /usr/bin local local
+printf -eu sed ${HOME} "$@" done 2>/dev/null readonly "$1"
+test ${HOME} done --verbose then --verbose ${HOME} sed export $(pwd) "$@"
+		local done cd grep cd done echo $(pwd) done "$1" --verbose test | "$1" grep
+	printf && readonly echo $(pwd) cd -eu | grep awk local cd && && /usr/bin
+	readonly -eu done test |
+		echo "$@" cd done /usr/bin -eu 'quoted text' cd printf "$@" --verbose x=1
+"$1" /usr/bin -eu then printf 2>/dev/null | -eu sed --verbose cd
+		'quoted text' --verbose cd readonly
+		grep sed grep local --verbose grep 2>/dev/null local | "$@"
+		"$1" && "$1" sed cd $(pwd) test local cd export 2>/dev/null
+	${HOME} sed readonly sed awk $(pwd) 'quoted text'
+sed "$@" 'quoted text' 2>/dev/null
+done $(pwd) ${HOME} cd ${HOME} /usr/bin /usr/bin -eu | "$1" test "$@"
+then awk readonly then | printf 'quoted text' then sed | $(pwd) 2>/dev/null test
+		"$1" /usr/bin /usr/bin | $(pwd) sed printf readonly printf local readonly
+		2>/dev/null "$@" awk done && awk "$@" 2>/dev/null /usr/bin | then readonly
+test 2>/dev/null grep grep 'quoted text' cd x=1 | | | --verbose awk 2>/dev/null
+"$@" && | x=1 && readonly
+2>/dev/null && echo readonly /usr/bin local --verbose cd cd "$1" awk grep test
+	export sed x=1 "$@" sed awk done x=1 ${HOME} x=1 x=1 $(pwd) "$1" 2>/dev/null
+| "$@" --verbose -eu x=1 grep echo 'quoted text'
+	x=1 test grep sed sed local -eu -eu cd then | grep export awk /usr/bin
+		"$1" ${HOME} && readonly ${HOME} cd ${HOME} -eu echo cd local x=1
+awk echo "$@" sed local ${HOME}
+		| grep done ${HOME} "$@" export echo local --verbose printf printf cd
+	2>/dev/null --verbose awk --verbose grep
+		--verbose done echo echo awk 'quoted text'
+	cd local grep grep echo "$@" export
+		printf --verbose x=1 printf echo 'quoted text' cd readonly cd -eu
+		| ${HOME} && | /usr/bin readonly echo
+readonly /usr/bin done --verbose "$1" 'quoted text' x=1 awk | echo
+'quoted text' test awk -eu export export done $(pwd) /usr/bin
+	then "$1" 'quoted text' ${HOME} export 'quoted text' ${HOME} --verbose cd "$@"
+		local done | && readonly --verbose "$@" x=1 awk cd done local
+		grep $(pwd) local echo test
+2>/dev/null printf 2>/dev/null --verbose $(pwd) 2>/dev/null
+		${HOME} && --verbose export ${HOME} "$@" then echo export
+	local ${HOME} "$@" ${HOME} awk cd readonly echo | export "$1"
+	echo awk sed cd && readonly printf printf export | $(pwd) local |
+${HOME} done x=1 test && export -eu /usr/bin local then "$@" /usr/bin /usr/bin
+		grep "$1" 'quoted text' 'quoted text' /usr/bin echo
+		done awk readonly --verbose --verbose local /usr/bin
+		"$1" x=1 then 2>/dev/null local done sed "$@" test "$@" | echo test grep
+x=1 'quoted text' /usr/bin cd --verbose
+	local grep /usr/bin 2>/dev/null 'quoted text' printf x=1
+$(pwd) grep 'quoted text' grep
+	${HOME} 2>/dev/null 2>/dev/null "$@" echo
+		sed 2>/dev/null awk 'quoted text' printf export then -eu sed |
+		$(pwd) printf sed | test ${HOME} grep local $(pwd)
+		echo test 'quoted text' test "$@" test 2>/dev/null export
+echo x=1 echo test "$1" x=1 "$@"
+	printf ${HOME} readonly
+-eu 2>/dev/null 2>/dev/null x=1 done x=1 local /usr/bin cd test
+/usr/bin $(pwd) -eu test
+		"$1" then && | cd grep sed 'quoted text' 'quoted text' test
+	$(pwd) --verbose printf then "$@" -eu grep local export local awk
+'quoted text' grep -eu x=1 "$1" grep "$1" 'quoted text' -eu readonly echo
+	test | ${HOME} -eu readonly readonly done ${HOME} grep
+		printf /usr/bin $(pwd) then 2>/dev/null printf
+then grep done 2>/dev/null test /usr/bin --verbose "$@" export awk /usr/bin awk
+x=1 ${HOME} -eu /usr/bin
+	-eu grep $(pwd) test done grep 'quoted text'
+		-eu | && "$@" 'quoted text' | "$@" /usr/bin printf
+	printf awk local /usr/bin printf ${HOME}
+		&& test && export export done "$@" printf ${HOME} local then && 2>/dev/null
+x=1 "$1" 'quoted text' 2>/dev/null 'quoted text' 'quoted text' --verbose 2>/dev/null
+'quoted text' awk sed
+	printf printf /usr/bin && | sed $(pwd) && "$@"
+grep cd export cd done grep export && test
+echo --verbose export 2>/dev/null 'quoted text' | printf local /usr/bin export
+	sed | export --verbose
+		local printf sed && done awk | grep echo 'quoted text' 'quoted text'
+$(pwd) "$@" $(pwd) awk "$1" -eu /usr/bin 'quoted text' awk echo
+		local printf then --verbose test test -eu local awk x=1 printf
+	&& | done "$@" sed /usr/bin /usr/bin -eu && ${HOME}
+		| 2>/dev/null "$1" cd local -eu && sed grep | cd /usr/bin
+		'quoted text' printf 'quoted text' local /usr/bin x=1 -eu done
+"$@" --verbose readonly | && cd then
+	x=1 /usr/bin grep 'quoted text'
+${HOME} 2>/dev/null 2>/dev/null grep -eu
+	local awk 'quoted text' "$@" x=1 awk 2>/dev/null
+'quoted text' test $(pwd) 'quoted text' 'quoted text'
+	'quoted text' && done
+		echo x=1 sed 'quoted text' done -eu && /usr/bin "$@" --verbose --verbose
+cd readonly export sed "$1" local echo awk awk | cd grep -eu export --verbose
+-eu readonly then grep awk 'quoted text' export -eu readonly sed
+$(pwd) grep readonly done $(pwd)
+	echo readonly cd sed --verbose local 2>/dev/null
+	/usr/bin && && awk /usr/bin echo
+		"$@" --verbose 2>/dev/null grep awk --verbose test awk 2>/dev/null
+		${HOME} && readonly 'quoted text'
+	sed /usr/bin test 'quoted text' readonly 'quoted text' --verbose
+		export ${HOME} | && awk cd --verbose sed /usr/bin test local
+test /usr/bin then 2>/dev/null && 2>/dev/null cd "$1" done test /usr/bin
+"$@" "$@" readonly cd readonly cd 'quoted text' x=1 export "$@"
+x=1 --verbose --verbose printf x=1 then awk $(pwd)
+"$@" then $(pwd) local && | --verbose "$1" sed $(pwd) --verbose 'quoted text' 'quoted text'
+		grep test sed echo | 2>/dev/null -eu /usr/bin
+	test echo 2>/dev/null ${HOME} && export "$@" export 2>/dev/null done 2>/dev/null
+		test ${HOME} local local 2>/dev/null
+	x=1 test export $(pwd) test sed export
+		readonly sed export /usr/bin -eu /usr/bin awk done test -eu awk then local
+	--verbose echo readonly "$@" cd test ${HOME}
+		readonly x=1 export /usr/bin x=1 awk | printf export "$1" cd "$@" readonly
+	| then 'quoted text' export test
+"$@" printf --verbose awk --verbose
+	$(pwd) local $(pwd) ${HOME}
+		"$1" local /usr/bin awk 'quoted text' cd 'quoted text'
+	$(pwd) | | readonly test /usr/bin export printf readonly local
+test 2>/dev/null "$@" echo readonly
+	awk 'quoted text' x=1 awk 'quoted text' --verbose sed ${HOME} test printf awk
+	--verbose done grep test grep && export local test grep
+	| awk x=1 sed x=1 printf test
+	${HOME} local readonly grep test $(pwd)
+printf echo /usr/bin x=1 "$1" -eu "$@" --verbose export sed "$@" printf
+--verbose export "$1" $(pwd) cd printf -eu && grep sed && "$1"
+echo readonly -eu readonly test 'quoted text'
+	done awk 2>/dev/null test
+--verbose echo local && /usr/bin test then grep /usr/bin ${HOME} $(pwd) echo
+		printf cd --verbose /usr/bin 2>/dev/null local cd
+		&& $(pwd) local awk test "$1" 2>/dev/null
+2>/dev/null && printf local cd printf | $(pwd)
+&& $(pwd) 2>/dev/null
+	readonly "$@" ${HOME} --verbose x=1 awk test readonly
+	$(pwd) "$@" then local | sed awk done 'quoted text'
+	test --verbose printf $(pwd) awk then test
+		awk $(pwd) "$1" cd readonly test printf /usr/bin export readonly
+$(pwd) done /usr/bin /usr/bin readonly "$@"
+		"$@" $(pwd) readonly done then sed "$1" | then export test echo --verbose
+	awk 'quoted text' export sed
+	$(pwd) ${HOME} | "$@" "$@" "$1" 2>/dev/null && readonly | sed --verbose
+"$@" awk && 'quoted text' done $(pwd) then "$@" $(pwd) local --verbose
+printf echo awk 2>/dev/null test 2>/dev/null 2>/dev/null
+readonly then 'quoted text' grep x=1 cd cd --verbose test cd -eu done
+	${HOME} export cd echo -eu grep export "$@" echo awk && /usr/bin
+cd grep done ${HOME} "$1"
+	export echo 2>/dev/null sed
+| grep awk test --verbose
+	then ${HOME} 2>/dev/null awk 2>/dev/null -eu sed awk printf 'quoted text'
+| ${HOME} echo readonly test local
+		&& local x=1 "$1" | local --verbose
+		test /usr/bin x=1 2>/dev/null ${HOME} echo "$@"
+	"$@" readonly | | /usr/bin "$1" echo && /usr/bin 'quoted text' ${HOME}
+| grep done printf 'quoted text'
+		2>/dev/null 2>/dev/null | $(pwd) --verbose $(pwd) awk "$@" -eu | 'quoted text'
+		'quoted text' grep local printf |
+		printf export grep grep ${HOME} export test ${HOME}
+		then done sed "$1" | | cd "$@" printf | /usr/bin done
+/usr/bin sed && -eu /usr/bin sed $(pwd) readonly -eu test | sed --verbose
+--verbose --verbose cd
+done | export printf
+echo -eu then "$1" x=1 printf "$1" readonly && export cd readonly /usr/bin printf
+&& | cd -eu test | cd export cd -eu awk && --verbose | x=1 readonly readonly
+	"$@" --verbose /usr/bin done x=1 readonly "$1" "$1" 'quoted text' 2>/dev/null
+$(pwd) $(pwd) export awk | ${HOME} x=1 test -eu echo
+	grep sed | local | --verbose | local 2>/dev/null
+"$1" --verbose sed test "$1" export $(pwd) test ${HOME}
+sed readonly -eu export
+		| && done cd done local "$@" 'quoted text' grep cd
+		cd "$1" grep | then | done && -eu export ${HOME}
+		done /usr/bin -eu local 'quoted text' local -eu export
+		2>/dev/null then test readonly /usr/bin
+| echo /usr/bin awk "$1" export printf | "$1" cd | echo local &&
+"$@" echo echo /usr/bin && then cd ${HOME}
+	readonly awk -eu cd "$1" grep "$@" test cd readonly grep
+		"$@" then ${HOME} done cd grep && | $(pwd) && printf test sed done
+cd then echo done sed awk awk grep
+awk | $(pwd) readonly done echo /usr/bin ${HOME} then
+	printf sed printf /usr/bin echo then test grep echo echo grep test ${HOME}
+grep $(pwd) readonly then "$1"
+readonly grep export && local awk 2>/dev/null done readonly /usr/bin
+		cd --verbose sed readonly awk awk echo -eu ${HOME} $(pwd) "$@" export readonly
+	grep 'quoted text' sed | then awk $(pwd)
+${HOME} printf export 2>/dev/null sed $(pwd) cd "$1" 'quoted text' --verbose then
+		readonly test then echo ${HOME} cd && "$@" 2>/dev/null
+		--verbose cd -eu && test test test $(pwd) "$1" cd readonly sed
+	sed grep x=1 "$@" 2>/dev/null awk --verbose grep cd --verbose done /usr/bin
+		then grep ${HOME} --verbose ${HOME} "$@" echo done cd && ${HOME} -eu ${HOME}
+	/usr/bin then echo "$1" /usr/bin
+"$@" "$1" -eu test test | /usr/bin sed $(pwd)
+cd --verbose done test test "$1" test readonly
+	done awk awk "$@" $(pwd) test test x=1 grep x=1 "$1" 'quoted text'
+		${HOME} readonly 2>/dev/null 2>/dev/null "$@" export then sed printf 'quoted text'
+		x=1 local export $(pwd) grep test then local export
+		awk 'quoted text' -eu grep then cd grep /usr/bin 'quoted text'
+	2>/dev/null then "$1" /usr/bin -eu awk $(pwd) cd /usr/bin
+printf test | local ${HOME}
+		'quoted text' x=1 x=1 'quoted text'
+"$1" --verbose cd test sed test local local printf test cd readonly
+		test grep grep echo x=1 --verbose | done --verbose echo 2>/dev/null
+		done readonly 'quoted text' printf
+		cd export && && && $(pwd) $(pwd) $(pwd) sed "$1" "$1" sed export 2>/dev/null $(pwd)
+done grep | ${HOME} /usr/bin | done | sed local local
+test && x=1 readonly local && -eu grep grep | echo 'quoted text'
+	-eu "$@" /usr/bin 'quoted text'
+		$(pwd) printf printf /usr/bin local awk 2>/dev/null | --verbose export /usr/bin
+		"$1" cd "$1" awk printf awk grep awk | readonly
+	readonly && sed "$1" test export 2>/dev/null done
+	'quoted text' 'quoted text' "$@" done | "$1" echo x=1 x=1 | readonly "$1" done done
+grep $(pwd) -eu | then 'quoted text'
+		/usr/bin $(pwd) then local then "$@" && ${HOME} done
+		"$@" ${HOME} then --verbose && $(pwd)
+	local printf export -eu cd $(pwd) x=1 $(pwd) grep local 'quoted text' &&
+	$(pwd) sed done echo then && | /usr/bin awk | ${HOME} sed
+		awk printf cd "$@" | 'quoted text' awk "$@" printf -eu test $(pwd) | |
+	then "$1" /usr/bin printf echo /usr/bin readonly sed ${HOME} $(pwd) 'quoted text'
+	then 'quoted text' $(pwd) &&
+readonly && printf grep 2>/dev/null cd /usr/bin grep
+		then | test test sed x=1 ${HOME}
+	export && --verbose ${HOME}
+	grep printf -eu echo 'quoted text' grep export 2>/dev/null printf test ${HOME}
+		2>/dev/null "$@" awk && done ${HOME} && cd "$@"
+grep grep awk awk -eu local
+| printf --verbose -eu /usr/bin then awk echo "$@" --verbose | 2>/dev/null
+		x=1 awk -eu -eu grep export x=1 done awk $(pwd) readonly ${HOME} export
+		then printf done ${HOME} local test cd grep 'quoted text'
+awk done ${HOME} | echo
+		sed cd "$1" "$@" export
+		${HOME} done grep test 'quoted text' printf x=1 sed 'quoted text'
+	| $(pwd) && $(pwd) echo -eu 2>/dev/null
+	test --verbose awk $(pwd) test && echo test done "$@" echo
+| --verbose -eu then printf done awk x=1 awk cd
+grep && | echo "$@" awk echo readonly cd "$@" done grep -eu cd printf x=1
+| | x=1 --verbose 'quoted text' $(pwd) x=1 $(pwd) echo test done && grep "$@"
+		"$@" awk sed x=1 ${HOME} done local "$1" then $(pwd) --verbose 2>/dev/null
+	sed ${HOME} 2>/dev/null grep grep test printf sed 2>/dev/null -eu -eu readonly
+"$1" awk 2>/dev/null done $(pwd) awk grep sed -eu then x=1 ${HOME} printf printf
+		then "$1" $(pwd) ${HOME} 2>/dev/null $(pwd) awk
+		/usr/bin local cd ${HOME} export
+	/usr/bin -eu readonly done | grep 2>/dev/null export /usr/bin
+	readonly echo -eu $(pwd) test sed --verbose | | done then export
+		2>/dev/null sed cd then
+	-eu x=1 grep /usr/bin echo ${HOME} printf test && | "$@" 'quoted text'
+	--verbose -eu | then --verbose
+then "$@" printf x=1 printf 2>/dev/null then "$1" printf readonly
+	/usr/bin then local done && -eu echo local local ${HOME} --verbose test
+		done sed grep done && $(pwd) | grep echo awk
+		-eu -eu awk readonly 'quoted text' local $(pwd) $(pwd) awk then then --verbose
+	$(pwd) printf sed -eu && /usr/bin awk ${HOME} awk cd
+		/usr/bin grep grep local echo export
+		"$@" $(pwd) x=1 'quoted text' readonly awk awk x=1 echo grep
+	local awk $(pwd) /usr/bin $(pwd)
+then x=1 /usr/bin && "$1" ${HOME} sed --verbose done echo
+		echo /usr/bin done awk
+		awk $(pwd) cd done x=1 ${HOME} echo --verbose /usr/bin export sed readonly
+		&& local 2>/dev/null "$@" printf | 'quoted text' --verbose sed "$1" "$@" readonly
+test x=1 -eu $(pwd) 2>/dev/null then export 2>/dev/null $(pwd)
+grep sed ${HOME} | cd export 2>/dev/null
+export local /usr/bin awk test "$@" $(pwd) printf then export
+		"$@" "$1" then then readonly
+--verbose "$1" $(pwd) --verbose x=1 test 'quoted text'
+		"$1" test $(pwd) 2>/dev/null readonly | ${HOME} "$@"
+		'quoted text' sed awk sed readonly awk cd printf awk then then export
+		readonly awk /usr/bin $(pwd) 'quoted text' /usr/bin /usr/bin ${HOME} then
+	echo readonly "$@" export sed 2>/dev/null
+		${HOME} /usr/bin -eu awk 2>/dev/null done
+export $(pwd) --verbose $(pwd) ${HOME} "$@" && readonly sed done $(pwd) $(pwd)
+		export cd /usr/bin grep export &&
+	sed | | readonly && awk echo "$@" readonly "$1" sed "$1"
+		done readonly readonly sed /usr/bin "$@" export ${HOME} --verbose -eu cd cd
+		| export readonly /usr/bin /usr/bin readonly
+		-eu --verbose then test $(pwd) 2>/dev/null
+$(pwd) readonly -eu /usr/bin 2>/dev/null grep --verbose | x=1 -eu done "$@"
+	echo readonly 'quoted text' | && ${HOME}
+	then local printf $(pwd) 'quoted text'
+		export then done $(pwd) export export ${HOME}
+	$(pwd) 2>/dev/null ${HOME}
+	&& "$1" awk grep test awk && sed --verbose then -eu done "$1" printf
+		sed 'quoted text' ${HOME} awk grep local
+		then local 'quoted text' then "$1" | x=1 --verbose /usr/bin
+	$(pwd) --verbose export --verbose test printf /usr/bin export
+	"$@" local test grep echo echo grep readonly
+-eu sed then | export readonly "$1" ${HOME} readonly $(pwd) done
+		printf | readonly awk x=1 2>/dev/null
+		then "$@" /usr/bin echo --verbose x=1 -eu $(pwd) -eu export --verbose printf
+	then cd /usr/bin export x=1 "$1" awk printf $(pwd) local then printf
+		cd $(pwd) then done | awk $(pwd) sed cd cd 2>/dev/null cd "$1" 'quoted text'
+	then ${HOME} --verbose /usr/bin 'quoted text'
+		2>/dev/null export --verbose grep readonly cd ${HOME} && /usr/bin then &&
+		| --verbose echo --verbose 2>/dev/null grep && 'quoted text' readonly
+	--verbose && then "$1" 'quoted text' echo 'quoted text' 2>/dev/null "$@"
+		awk -eu 'quoted text' echo done test printf grep printf
+	"$@" awk awk "$1" readonly "$@" "$1"
+printf local --verbose awk local test grep
+	sed local -eu readonly "$@" "$@" echo printf --verbose ${HOME} printf sed $(pwd)
+	"$@" "$1" test printf 2>/dev/null sed echo "$1" 'quoted text' cd readonly
+$(pwd) /usr/bin echo "$1" |
+		printf | then local "$1" $(pwd) "$1" printf test
+	local echo $(pwd) /usr/bin done 2>/dev/null done
+		echo "$1" x=1 --verbose then
+		'quoted text' | done grep x=1 'quoted text' 'quoted text'
+	cd "$1" done "$@" "$1" export readonly
+/usr/bin test && 'quoted text' x=1 "$@" done ${HOME} 'quoted text'
+then "$1" | $(pwd) local | ${HOME} awk "$@" -eu 2>/dev/null
+		/usr/bin test 'quoted text' awk then sed local done sed export
+-eu sed --verbose readonly 'quoted text'
+	2>/dev/null echo && 2>/dev/null ${HOME}
+		"$1" --verbose grep sed ${HOME} 2>/dev/null grep x=1 $(pwd) printf
+		printf && done done cd "$1" echo readonly done echo $(pwd) | export echo
+awk readonly cd "$1" done export
+		| --verbose awk --verbose local ${HOME} printf then sed readonly grep awk --verbose
+		x=1 readonly export "$@"
+	cd sed ${HOME} readonly export /usr/bin export
+	"$@" echo export /usr/bin "$1" echo /usr/bin printf
+	--verbose $(pwd) /usr/bin then grep sed $(pwd) 'quoted text' cd export
+x=1 x=1 2>/dev/null test then echo local local $(pwd) &&
+		readonly /usr/bin printf -eu echo $(pwd) readonly grep ${HOME} x=1 local
+&& cd cd sed -eu /usr/bin grep export "$@" "$@" export
+then export /usr/bin "$1" --verbose 'quoted text' --verbose
+		cd cd sed then echo /usr/bin cd 'quoted text' export export x=1
+"$@" /usr/bin /usr/bin sed done printf export
+	echo "$1" sed printf && "$@" $(pwd) printf && -eu "$1" export -eu local
+		"$1" export test -eu test "$1" 2>/dev/null 'quoted text' "$@"
+local cd export done grep
+	then 'quoted text' printf "$@" $(pwd) /usr/bin && 'quoted text'
+test cd | printf export readonly | then 2>/dev/null
+'quoted text' local readonly -eu $(pwd) 'quoted text'
+	awk "$1" then 2>/dev/null | local -eu && $(pwd) awk /usr/bin "$1"
+grep x=1 $(pwd) 'quoted text' ${HOME} x=1 cd
+		$(pwd) awk cd grep "$1" then | 2>/dev/null sed 'quoted text' /usr/bin 'quoted text'
+	printf 2>/dev/null echo readonly && awk --verbose
+		then export 'quoted text' echo --verbose "$@" && "$@" done
+	$(pwd) local 2>/dev/null printf sed "$@" "$@" "$@" 'quoted text' "$@" sed
+		sed 'quoted text' $(pwd) echo done "$@" local export 2>/dev/null "$1" 'quoted text'
+		$(pwd) test cd "$1" done export
+	test x=1 export 2>/dev/null && 2>/dev/null
+	/usr/bin echo $(pwd) grep export export -eu
+		local grep cd export export $(pwd) "$1" local export printf
+grep --verbose 'quoted text' awk test cd
+		printf $(pwd) --verbose x=1 local $(pwd) && | 'quoted text' export echo
+		then local echo | echo ${HOME} && awk -eu local x=1 'quoted text' local then "$@"
+echo -eu ${HOME} test printf
+	readonly 2>/dev/null export
+&& echo export grep $(pwd) test ${HOME} cd local 'quoted text'
+		${HOME} 2>/dev/null done --verbose
+$(pwd) local sed "$@" x=1 export
+grep test --verbose 2>/dev/null --verbose $(pwd) 'quoted text' test cd "$1" echo
+	--verbose ${HOME} export readonly echo --verbose "$@" x=1 ${HOME}
+		/usr/bin ${HOME} export done
+		sed 'quoted text' cd | local | 2>/dev/null -eu && /usr/bin printf
+		${HOME} -eu sed cd echo --verbose done echo done sed grep
+	$(pwd) "$1" && "$@" printf local
+	cd then echo ${HOME} ${HOME} && cd cd "$@" x=1 | 'quoted text' then && 'quoted text'
+		cd cd export cd && -eu ${HOME} then echo echo local $(pwd)
+	test local test then awk ${HOME} | 'quoted text' grep 2>/dev/null --verbose &&
+awk readonly && done 'quoted text' test readonly --verbose then
+&& printf printf 'quoted text' cd ${HOME} cd x=1 done | --verbose
+		-eu 2>/dev/null | x=1 "$1" "$@" readonly awk /usr/bin "$@"
+2>/dev/null grep ${HOME} 'quoted text' /usr/bin
+	&& x=1 && -eu then done then
+		x=1 $(pwd) cd x=1 local printf cd 2>/dev/null
+		sed awk then "$1" 'quoted text' done 2>/dev/null readonly
+then | awk grep echo 'quoted text' sed local x=1 --verbose
+	| -eu done && grep readonly grep | export readonly ${HOME} export |
+		&& $(pwd) $(pwd) 2>/dev/null test /usr/bin
+		/usr/bin test --verbose --verbose test local -eu grep printf local |
+		'quoted text' sed --verbose sed test 'quoted text' echo sed | awk grep then 2>/dev/null
+	echo --verbose && done | printf cd ${HOME} awk export test cd local echo "$1"
+		local /usr/bin printf sed 2>/dev/null
+export sed 'quoted text' export
+		$(pwd) export test cd "$1" cd readonly cd $(pwd) readonly
+		local && readonly && /usr/bin 'quoted text' x=1 export | printf 'quoted text'
+	-eu awk /usr/bin local readonly "$1" 2>/dev/null local x=1 "$1" cd
+sed && && "$@" ${HOME} grep export awk sed printf then /usr/bin 'quoted text'
+	printf readonly "$1" awk grep printf then --verbose awk x=1 -eu $(pwd) 'quoted text'
+	local then /usr/bin 2>/dev/null 2>/dev/null
+-eu cd ${HOME} /usr/bin
+done | "$1" sed x=1 local awk cd done $(pwd) cd awk --verbose
+	test then printf then ${HOME} printf grep cd "$1"
+readonly x=1 export x=1 export
+	readonly test 'quoted text'
+done -eu then 'quoted text' -eu 'quoted text' done --verbose "$@" local 2>/dev/null
+"$@" test 2>/dev/null /usr/bin /usr/bin ${HOME} done && awk echo awk
+		${HOME} "$@" $(pwd) then printf export
+		'quoted text' $(pwd) then export done echo readonly
+readonly 2>/dev/null ${HOME} 'quoted text' cd ${HOME} "$1" 'quoted text'
+		test 2>/dev/null 2>/dev/null sed --verbose cd awk /usr/bin --verbose
+'quoted text' echo sed -eu "$1" 2>/dev/null
+		2>/dev/null cd $(pwd) local /usr/bin $(pwd) cd readonly
+	awk "$1" readonly grep /usr/bin --verbose
+		-eu /usr/bin grep | $(pwd)
+		readonly awk echo x=1 cd export x=1 2>/dev/null
+grep export cd "$@" echo
+	echo ${HOME} $(pwd) "$@" "$1"
+	"$@" | cd $(pwd) $(pwd) | 2>/dev/null
+		"$1" "$@" | 'quoted text' echo /usr/bin "$@" ${HOME} echo
+test 'quoted text' && grep $(pwd) echo
+2>/dev/null $(pwd) awk "$@" then export grep readonly x=1 | export
+		| "$@" x=1 | sed ${HOME} cd
+		cd 'quoted text' printf ${HOME}
+		2>/dev/null readonly done done x=1 "$1" grep cd test test cd
+	x=1 -eu local ${HOME} --verbose /usr/bin x=1 2>/dev/null
+"$1" cd then --verbose
+$(pwd) printf x=1 -eu done && "$@" echo -eu /usr/bin "$@" ${HOME} cd cd then then
+		printf cd 'quoted text' && echo
+		echo -eu then | printf printf done done 'quoted text'
+	2>/dev/null $(pwd) --verbose then local sed /usr/bin $(pwd)
+		$(pwd) -eu "$1" 'quoted text' /usr/bin --verbose then sed --verbose cd
+x=1 grep -eu x=1 'quoted text' 2>/dev/null -eu readonly
+		/usr/bin test -eu done 2>/dev/null printf $(pwd) x=1 printf 'quoted text'
+	"$1" --verbose local --verbose echo done done
+${HOME} -eu readonly sed $(pwd) ${HOME} awk local "$@"
+done local --verbose test
+	/usr/bin -eu "$1" readonly readonly export 'quoted text' 2>/dev/null -eu done
+local --verbose /usr/bin grep ${HOME} -eu readonly "$1" awk echo /usr/bin
+local 2>/dev/null "$@" ${HOME} done echo printf then $(pwd) then readonly x=1 then
+	x=1 x=1 echo | export printf 2>/dev/null && then x=1 "$@" --verbose
+grep sed --verbose done
+		${HOME} ${HOME} $(pwd) /usr/bin cd awk
+	$(pwd) awk done echo ${HOME} sed -eu --verbose 2>/dev/null
+	export ${HOME} 2>/dev/null "$1" | /usr/bin --verbose && local /usr/bin $(pwd)
+$(pwd) test | 'quoted text' done sed "$1" 'quoted text'
+		done sed 'quoted text' x=1 | printf x=1 | done ${HOME} cd
+$(pwd) --verbose local 'quoted text' --verbose -eu grep 'quoted text' awk test
+x=1 then -eu printf 'quoted text' x=1 cd && local 'quoted text' sed cd --verbose
+${HOME} --verbose test 2>/dev/null
+		test -eu echo grep /usr/bin then $(pwd) --verbose
+	export /usr/bin 2>/dev/null
+		readonly local ${HOME} | then then -eu done && 2>/dev/null readonly local echo sed
+		done && test awk done x=1 readonly awk "$@" | done then 'quoted text' | test
+	$(pwd) grep /usr/bin x=1 grep echo test "$1" x=1 | -eu printf $(pwd)
+local done test export local awk awk export x=1 --verbose
+		grep cd cd 'quoted text' "$1" awk then sed -eu
+	echo then echo "$@" readonly echo printf
+		done local $(pwd) 2>/dev/null then sed done sed --verbose
+sed "$@" local then then "$@" then awk --verbose 'quoted text' x=1 export 'quoted text'
+	cd 2>/dev/null export |
+	test cd cd sed "$@" --verbose cd | test -eu -eu
+		awk --verbose $(pwd) x=1 export
+		| export 'quoted text' x=1 test done test "$1" test then ${HOME} |
+"$@" -eu then cd local x=1
+		awk 2>/dev/null echo --verbose
+echo x=1 grep done "$@" local echo
+&& --verbose local "$1" && readonly grep 2>/dev/null 2>/dev/null
+done /usr/bin "$1" local echo ${HOME} grep readonly echo | awk echo grep
+		readonly ${HOME} awk --verbose ${HOME} test 'quoted text'
+	readonly ${HOME} -eu | echo sed && awk cd | test done awk sed 2>/dev/null
+		${HOME} sed local "$@" echo printf
+		$(pwd) --verbose awk export
+2>/dev/null awk sed done 'quoted text'
+local echo echo then echo awk echo -eu "$1" grep /usr/bin grep 'quoted text'
+	readonly awk then -eu && /usr/bin | awk | readonly --verbose
+		test 'quoted text' /usr/bin
+--verbose --verbose "$@" ${HOME} /usr/bin done "$1" printf
+	x=1 grep 'quoted text' grep "$1" $(pwd) "$1" sed echo -eu
+		/usr/bin then awk export
+		'quoted text' readonly printf readonly
+		"$1" printf x=1 --verbose 2>/dev/null 'quoted text' done
+	"$@" grep --verbose &&
+| "$@" sed echo local cd done $(pwd) -eu /usr/bin $(pwd) && 2>/dev/null
+		${HOME} "$@" && local grep &&
+		echo cd ${HOME} cd printf local -eu /usr/bin export --verbose "$1" ${HOME} /usr/bin
+&& local | 'quoted text' local
+printf /usr/bin local sed x=1 'quoted text' cd
+	2>/dev/null export ${HOME} then awk readonly
+then export x=1 -eu $(pwd) && printf /usr/bin
+&& readonly local -eu then 2>/dev/null
+	readonly && | x=1 done sed readonly "$@" 'quoted text' printf
+	sed "$@" export 2>/dev/null readonly x=1 && readonly
+	x=1 echo ${HOME} export then
+then 'quoted text' 2>/dev/null --verbose
+"$@" readonly | test cd cd test
+"$1" 'quoted text' readonly
+	grep /usr/bin printf 2>/dev/null done export "$@" "$@"
+2>/dev/null -eu x=1 done printf cd
+		printf -eu cd done 2>/dev/null "$@" "$@" export ${HOME}
+&& test done x=1 /usr/bin test --verbose cd echo 'quoted text' 2>/dev/null
+	/usr/bin ${HOME} grep local -eu printf -eu
+	sed 2>/dev/null ${HOME} ${HOME} test /usr/bin | grep grep -eu
+		&& test 2>/dev/null test "$@" cd
+readonly readonly awk done cd
+export printf && echo done readonly | ${HOME} 2>/dev/null "$1" |
+then done sed sed readonly x=1 "$1" | 'quoted text'
+		echo test 'quoted text' | readonly
+--verbose sed echo -eu printf sed "$1" then done
+		test /usr/bin --verbose x=1 then
+export local awk done &&
+	${HOME} /usr/bin x=1 awk --verbose readonly export test /usr/bin
+	| awk echo /usr/bin "$1" echo printf | | --verbose x=1 printf grep readonly "$1"
+printf done /usr/bin x=1 --verbose awk | test sed --verbose $(pwd)
+"$1" "$1" && cd ${HOME} done $(pwd) 2>/dev/null done then /usr/bin ${HOME} done
+	echo readonly "$1" cd readonly done sed 2>/dev/null sed 2>/dev/null done
+	--verbose test printf --verbose --verbose | then ${HOME} done cd sed local "$1"
+		&& printf printf 2>/dev/null test $(pwd) local | export sed x=1 awk $(pwd) export
+		local 'quoted text' "$1" echo | readonly grep | test cd readonly echo && ${HOME}
+		/usr/bin 'quoted text' export /usr/bin && ${HOME} awk "$1" x=1 awk
+		test grep cd done done /usr/bin done $(pwd) "$1" /usr/bin
+		x=1 local grep -eu "$1" "$@" sed $(pwd) local 'quoted text' ${HOME} 'quoted text'
+done sed && test 2>/dev/null "$1" ${HOME} $(pwd) "$@" "$@"
+	2>/dev/null done x=1 /usr/bin done local done sed printf then grep $(pwd)
+		$(pwd) printf | | cd ${HOME} x=1 sed /usr/bin 'quoted text' local "$1"
+echo /usr/bin printf -eu x=1 then export -eu /usr/bin done grep
+		-eu "$1" --verbose export awk --verbose test cd ${HOME} /usr/bin --verbose export
+2>/dev/null echo /usr/bin
+	${HOME} -eu ${HOME} /usr/bin /usr/bin -eu "$@" done 2>/dev/null /usr/bin then
+		then "$1" | then $(pwd) printf grep printf /usr/bin "$1" awk ${HOME}
+	$(pwd) echo 'quoted text' --verbose | done done cd /usr/bin -eu export ${HOME}
+		--verbose readonly awk ${HOME} "$1" | x=1 readonly
+	&& 'quoted text' x=1 | $(pwd) echo --verbose echo ${HOME} sed ${HOME}
+	"$@" /usr/bin readonly ${HOME} && && -eu echo
+	x=1 then | cd cd x=1 | sed grep 'quoted text' | local && 'quoted text' $(pwd)
+${HOME} -eu test && export awk local grep
+		printf x=1 && printf --verbose local done cd
+done then cd x=1 "$@" cd 'quoted text' cd sed done printf
+grep ${HOME} done cd | -eu | test grep cd && $(pwd) -eu 2>/dev/null x=1 printf
+	"$@" "$1" ${HOME} cd local then
+	export printf awk sed done --verbose
+$(pwd) /usr/bin test done export 'quoted text'
+	$(pwd) /usr/bin 'quoted text' --verbose --verbose /usr/bin sed
+	readonly then export -eu grep "$@" grep echo
+cd cd then printf export
+echo -eu --verbose && test
+'quoted text' grep then sed grep
+	echo $(pwd) $(pwd) then --verbose
+		| sed /usr/bin 'quoted text' ${HOME}
+-eu sed readonly printf export x=1 done sed ${HOME} local cd 2>/dev/null
+		readonly awk cd "$@" then cd printf echo
+"$1" "$1" grep -eu "$1" $(pwd) printf printf ${HOME} sed readonly && "$@" sed
+		${HOME} printf -eu printf grep
+		export ${HOME} $(pwd) awk then ${HOME} cd $(pwd)
+		done then "$@" echo && then then done --verbose 2>/dev/null echo && echo done
+		'quoted text' 2>/dev/null $(pwd) readonly
+&& test done export readonly then test 2>/dev/null ${HOME}
+		-eu $(pwd) export 2>/dev/null printf ${HOME} echo readonly "$@" $(pwd)
+	sed /usr/bin 'quoted text' then
+export x=1 echo $(pwd)
+	-eu done $(pwd) $(pwd) done ${HOME} ${HOME} cd done && && readonly | done 2>/dev/null
+		test printf --verbose grep | "$1" echo printf
+/usr/bin sed -eu | echo readonly
+	2>/dev/null ${HOME} -eu test /usr/bin
+		then export -eu 2>/dev/null readonly | then ${HOME} "$@" /usr/bin --verbose awk
+		"$1" "$1" sed ${HOME} printf "$1" | echo cd
+	"$@" --verbose x=1 grep export awk x=1 sed
+done "$1" /usr/bin "$1" awk local "$1" | x=1 'quoted text' test "$@"
+	done && awk 2>/dev/null echo then then then /usr/bin
+		done done ${HOME} local $(pwd) then done
+&& /usr/bin /usr/bin
+	test 'quoted text' done ${HOME} then printf -eu export local readonly
+	/usr/bin test printf printf x=1 grep readonly sed awk $(pwd) export && readonly
+		2>/dev/null && test readonly $(pwd) $(pwd) "$1" && -eu grep x=1 grep
+local 'quoted text' && printf -eu x=1 printf cd printf |
+awk "$@" && x=1 /usr/bin awk local export
+		"$@" awk 2>/dev/null 'quoted text'
+	test 2>/dev/null 2>/dev/null
+done echo x=1 export $(pwd) "$@" local --verbose sed
+	'quoted text' && cd test
+		export test test && cd awk
+test sed -eu local printf | 'quoted text' grep done export --verbose export
+		cd then x=1 grep echo && awk local cd 2>/dev/null readonly $(pwd) printf
+		done sed 'quoted text'
+		-eu "$@" test readonly then test "$@" 'quoted text'
+	"$1" "$1" awk readonly done
+-eu printf grep /usr/bin --verbose $(pwd) printf then grep -eu sed awk && | |
+--verbose local awk x=1
+	printf /usr/bin -eu then grep 'quoted text' export ${HOME} awk sed x=1 -eu grep
+	readonly grep then test then ${HOME}
+		echo $(pwd) awk local readonly ${HOME} -eu awk readonly
+		echo -eu ${HOME} --verbose |
+		sed readonly printf 'quoted text' echo
+	"$1" "$1" /usr/bin then $(pwd)
+		| $(pwd) --verbose ${HOME} -eu local
+	export sed export awk /usr/bin --verbose cd --verbose export
+		-eu export grep cd ${HOME} x=1 $(pwd) echo | $(pwd) sed "$1" then --verbose
+x=1 grep --verbose sed 2>/dev/null readonly | cd
+		x=1 "$1" "$@" ${HOME} ${HOME} 'quoted text'
+	"$1" | export -eu 'quoted text' cd export printf local "$1" cd --verbose
+done "$@" test $(pwd) 2>/dev/null --verbose grep done "$1" cd
+		test 'quoted text' local awk readonly cd "$@" done "$1" export
+		&& local "$1" cd /usr/bin 2>/dev/null test x=1 && test echo 2>/dev/null grep
+	export sed "$1" readonly "$1" 'quoted text' readonly "$1" echo readonly done
+-eu ${HOME} cd /usr/bin "$@" $(pwd) --verbose -eu then readonly
+	--verbose grep export then
+	grep printf grep x=1 "$1" ${HOME} cd sed "$1" echo readonly x=1 $(pwd) awk
+--verbose test /usr/bin cd | export echo
+	${HOME} grep ${HOME} cd
+		local local then "$1" printf done then then 'quoted text' ${HOME} sed &&
+		"$1" | printf ${HOME} $(pwd)
+export then $(pwd) $(pwd) cd /usr/bin $(pwd) export readonly
+	done test && /usr/bin ${HOME} 2>/dev/null $(pwd) $(pwd) awk cd readonly
+	--verbose ${HOME} "$@" echo /usr/bin &&
+done local 'quoted text'
+		then sed cd && test printf "$1" $(pwd)
+	grep printf test -eu --verbose
+export grep 'quoted text'
+&& && x=1 ${HOME} grep grep $(pwd) | sed then
+	sed --verbose /usr/bin then readonly
+		x=1 printf "$1" ${HOME} -eu readonly sed && "$1" done 'quoted text'
+done ${HOME} -eu /usr/bin x=1 -eu then cd awk "$@" sed "$@" "$@" x=1
+	sed | then x=1 | "$1" export | && x=1 && "$1" sed sed "$@" grep --verbose /usr/bin
+test x=1 "$1" && 2>/dev/null && "$1" echo "$1" then ${HOME} sed 2>/dev/null
+awk readonly 'quoted text' "$@" test --verbose local 2>/dev/null
+"$@" 2>/dev/null ${HOME} test echo x=1 export
+		'quoted text' cd cd sed | "$1" echo
+	-eu ${HOME} grep --verbose
+"$1" -eu -eu $(pwd) /usr/bin sed readonly --verbose test then local done "$1"
+	/usr/bin -eu $(pwd) --verbose "$1" local 'quoted text' ${HOME}
+		sed ${HOME} -eu cd 'quoted text'
+		x=1 ${HOME} "$@" /usr/bin then sed ${HOME} $(pwd) 'quoted text'
+		readonly "$@" 'quoted text' sed 2>/dev/null
+	'quoted text' sed --verbose
+	echo && ${HOME} "$@" x=1 readonly /usr/bin
+	${HOME} done 'quoted text'
+	echo test x=1 $(pwd) readonly
+--verbose --verbose /usr/bin
+	then readonly sed "$@" ${HOME} test local echo 'quoted text' --verbose
+		&& readonly cd test readonly ${HOME} x=1 -eu grep cd "$@" | done export
+	${HOME} printf printf local --verbose
+		local then /usr/bin $(pwd) ${HOME}
+	-eu "$1" sed done then "$1" awk then | done printf test sed
+-eu --verbose 'quoted text' test
+	then /usr/bin 2>/dev/null sed "$@" "$1" "$1" 'quoted text' test /usr/bin
+	x=1 ${HOME} x=1 readonly echo 2>/dev/null --verbose cd x=1 echo test sed
+		2>/dev/null grep --verbose && cd "$1" cd 'quoted text' 2>/dev/null
+	sed local readonly ${HOME} $(pwd) test && grep sed 2>/dev/null test
+		export /usr/bin local sed && local && x=1 /usr/bin --verbose export
+awk grep export export cd && ${HOME} grep cd /usr/bin && -eu
+		sed echo sed done "$@" cd -eu printf awk done cd /usr/bin
+		test local then done readonly 'quoted text' cd
+	printf "$@" grep --verbose
+		--verbose awk 2>/dev/null local
+"$@" && echo done awk done sed "$1" awk
+export cd test awk local "$1" done | echo ${HOME} ${HOME}
+	/usr/bin echo then readonly x=1 test -eu
+	then done "$@" printf x=1 2>/dev/null done $(pwd) then
+		test echo "$1" awk && readonly x=1 x=1 readonly "$1" /usr/bin export cd ${HOME}
+		done --verbose readonly echo $(pwd) export "$1" | ${HOME}
+		${HOME} /usr/bin ${HOME} local ${HOME} done | /usr/bin
+		awk local echo x=1 cd ${HOME} done -eu --verbose ${HOME}
+$(pwd) /usr/bin cd then "$@" 2>/dev/null
+		&& export local --verbose ${HOME} readonly ${HOME} awk
+${HOME} "$@" awk 'quoted text' cd export --verbose $(pwd) done sed "$1" 'quoted text'
+	cd local /usr/bin "$@" /usr/bin then awk test "$1" then /usr/bin x=1 x=1 done
+	"$@" test "$@" $(pwd) then readonly then test local 2>/dev/null
+done export awk export export grep local sed grep 'quoted text' export
+		awk cd grep local printf x=1 then --verbose 2>/dev/null then $(pwd)
+	awk $(pwd) cd done "$1" 'quoted text' printf echo -eu local test test printf
+		echo -eu awk export sed "$1" x=1 then export
+		grep local readonly awk export done /usr/bin
+| export readonly done grep ${HOME} --verbose "$1" awk echo export
+		test echo grep && local 'quoted text' cd awk awk 'quoted text' 2>/dev/null
+	-eu readonly 'quoted text' then then "$1" && cd "$1" done ${HOME} printf sed &&
+	then test 'quoted text' --verbose
+--verbose cd cd cd readonly "$@" local $(pwd) then done
+-eu $(pwd) awk x=1 && grep --verbose cd awk &&
+readonly | 2>/dev/null echo done cd export
+		cd "$@" -eu printf /usr/bin ${HOME} export echo export readonly
+	$(pwd) --verbose then printf 'quoted text' local export then | done /usr/bin
+		'quoted text' /usr/bin $(pwd)
+	done --verbose x=1 test export done x=1 sed grep then 2>/dev/null "$1" grep
+	local then $(pwd) /usr/bin && then awk
+		$(pwd) readonly grep awk x=1 | echo "$1" local awk printf
+	/usr/bin | echo echo printf "$@" && readonly && cd export ${HOME} then sed
+echo x=1 then 2>/dev/null readonly && cd local readonly -eu awk echo awk -eu test
+	"$@" then 2>/dev/null /usr/bin
+"$1" then printf then 2>/dev/null 2>/dev/null awk "$1"
+-eu -eu awk test cd x=1 done $(pwd) /usr/bin 2>/dev/null awk "$@" ${HOME} 'quoted text'
+local 2>/dev/null readonly $(pwd) -eu echo x=1 "$1" then then ${HOME} test
+		test 2>/dev/null && $(pwd) done test echo x=1 echo 2>/dev/null
+echo grep "$@" -eu done echo /usr/bin echo echo
+export awk && export export sed 2>/dev/null printf --verbose /usr/bin done
+	"$1" cd grep && 'quoted text' grep echo $(pwd) echo then x=1 awk local
+	$(pwd) "$1" awk echo grep done && done cd $(pwd) done grep
+		&& printf test local --verbose ${HOME}
+		2>/dev/null then sed test awk test export then
+then readonly sed ${HOME} ${HOME} ${HOME} 2>/dev/null grep
+	grep $(pwd) cd /usr/bin "$@" -eu $(pwd) 2>/dev/null $(pwd) then printf
+	${HOME} 2>/dev/null "$1" printf test -eu
+	printf then then grep echo x=1 "$@" export 'quoted text' x=1 $(pwd) x=1
+	sed echo x=1 sed $(pwd) 2>/dev/null export --verbose "$@" "$@"
+	&& export readonly --verbose cd 'quoted text' x=1 readonly && 2>/dev/null -eu
+		echo x=1 export local | done | "$@" grep 'quoted text' "$1" readonly $(pwd) printf
+		then awk readonly local local awk test -eu 'quoted text'
+printf done && grep "$@" "$@" readonly cd then done printf cd -eu | 2>/dev/null
+	x=1 "$1" /usr/bin 2>/dev/null local 2>/dev/null -eu ${HOME} | local awk done
+	/usr/bin && local readonly --verbose /usr/bin 2>/dev/null
+	test x=1 awk 2>/dev/null
+		"$1" grep then sed test test "$1" x=1 "$1" --verbose -eu
+x=1 test && x=1 cd readonly readonly grep
+		$(pwd) grep /usr/bin 2>/dev/null /usr/bin
+	"$1" echo "$1" 'quoted text' export ${HOME} | 'quoted text'
+	then 'quoted text' $(pwd) --verbose
+	/usr/bin x=1 local "$1" && 2>/dev/null export | x=1 grep readonly "$1" | --verbose
+	/usr/bin $(pwd) ${HOME} printf /usr/bin local | readonly && local 2>/dev/null awk
+export | test then local export echo grep && readonly
+x=1 2>/dev/null echo /usr/bin local "$@" done test sed cd awk | test sed then
+		then grep export "$1" /usr/bin ${HOME} 'quoted text'
+	| "$1" 'quoted text' local done then ${HOME} local sed export "$1" "$1"
+		-eu --verbose x=1 then printf 2>/dev/null
+export 2>/dev/null sed grep readonly local /usr/bin local done && grep --verbose
+--verbose export /usr/bin grep printf
+	sed 2>/dev/null -eu echo "$1" awk --verbose 2>/dev/null cd "$1"
+"$1" ${HOME} | x=1 export ${HOME} grep
+'quoted text' done 'quoted text' 2>/dev/null sed cd local "$@" "$1" readonly export
+printf sed ${HOME} sed test cd $(pwd) then "$@" -eu 'quoted text'
+	&& printf ${HOME} "$1" then awk cd cd
+		then && cd && echo readonly cd ${HOME} /usr/bin test "$1" test "$1"
+	then 'quoted text' ${HOME} then local 2>/dev/null
+		$(pwd) && -eu export 'quoted text' 2>/dev/null "$1" awk "$1" grep readonly
+awk /usr/bin && cd printf grep then x=1 done export then echo test $(pwd)
+	${HOME} done x=1 "$1" awk 'quoted text' readonly x=1
+		| x=1 | | grep /usr/bin then test test printf 'quoted text'
+	then test && export sed sed cd 'quoted text' awk local test test then x=1
+	export readonly printf echo cd
+echo -eu && test awk ${HOME} "$@" $(pwd) /usr/bin ${HOME}
+		sed 'quoted text' 2>/dev/null 2>/dev/null done
+		${HOME} ${HOME} x=1 /usr/bin -eu grep readonly /usr/bin sed 'quoted text'
+-eu grep grep --verbose "$1" grep 'quoted text'
+"$@" -eu /usr/bin "$@" /usr/bin
+sed export done && done ${HOME} cd $(pwd) ${HOME} echo test --verbose
+readonly 'quoted text' 2>/dev/null readonly "$1" grep
+		'quoted text' --verbose grep
+${HOME} printf cd "$1" && awk "$@" test local done test "$@" 2>/dev/null -eu
+test x=1 cd --verbose awk $(pwd) $(pwd) x=1 awk export --verbose
+&& 2>/dev/null grep x=1 x=1 awk ${HOME}
+x=1 "$@" $(pwd) "$@" printf 'quoted text'
+		echo -eu printf 2>/dev/null $(pwd)
+		"$1" export done test echo grep local | "$@" 'quoted text'
+then "$1" --verbose echo done
+2>/dev/null export export $(pwd)
+	2>/dev/null 2>/dev/null "$1" export $(pwd)
+	$(pwd) 2>/dev/null printf "$1" $(pwd) test cd --verbose --verbose awk ${HOME} grep
+	| test echo awk x=1 /usr/bin cd $(pwd) -eu local echo sed awk then grep
+		/usr/bin grep readonly echo | 'quoted text' printf
+	awk x=1 local awk "$1" --verbose | readonly sed | && local test echo ${HOME}
+		grep x=1 printf -eu cd /usr/bin test cd local export
+		-eu printf export done export -eu ${HOME}
+sed cd x=1 | test x=1 done printf | x=1 echo x=1 then "$1"
+		then && readonly readonly cd x=1 export 2>/dev/null sed $(pwd) 'quoted text'
+-eu grep sed 2>/dev/null 2>/dev/null "$@" $(pwd) export then cd
+		| sed then export "$1" x=1 x=1 'quoted text' grep export printf "$1" done cd $(pwd)
+'quoted text' printf echo "$1" sed ${HOME} /usr/bin 'quoted text'
+		awk $(pwd) test echo sed printf test --verbose then echo local test then
+	2>/dev/null --verbose export 2>/dev/null local
+	2>/dev/null grep -eu "$1" local x=1 cd | done && 'quoted text' -eu test sed -eu
+local export cd ${HOME} local echo
+"$@" export 2>/dev/null done then printf
+/usr/bin "$@" $(pwd) then readonly then sed "$@" | ${HOME} |
+$(pwd) sed --verbose x=1 && sed cd
+	${HOME} cd "$1" echo
+		then --verbose ${HOME} "$@" ${HOME} cd x=1 x=1 2>/dev/null x=1 test export | then
+	${HOME} 2>/dev/null --verbose export grep "$@" sed test readonly
+		"$@" ${HOME} $(pwd) echo sed "$@" $(pwd) --verbose then /usr/bin export echo
+	${HOME} && local then sed | 2>/dev/null echo grep -eu -eu && echo grep 2>/dev/null
+	| --verbose /usr/bin done local printf awk -eu "$1" 'quoted text'
+		"$1" /usr/bin printf readonly sed echo x=1
+	-eu echo echo ${HOME} echo 'quoted text' awk --verbose 2>/dev/null x=1
+	test -eu "$@" && readonly "$1" echo x=1
+	"$@" -eu local $(pwd) echo 'quoted text' 2>/dev/null "$@" done "$@" x=1 local
+		done export echo "$1" 'quoted text' && cd then --verbose awk cd cd
+	$(pwd) echo $(pwd) --verbose 'quoted text' && $(pwd) 2>/dev/null printf then
+		printf sed grep export sed 2>/dev/null export 'quoted text' done
+&& sed test x=1 -eu "$1" echo
+| grep /usr/bin sed 2>/dev/null ${HOME} 'quoted text' 2>/dev/null --verbose
+then ${HOME} export 2>/dev/null
+"$1" cd export readonly then "$1" done | && export
+'quoted text' 2>/dev/null --verbose
+&& awk /usr/bin done done
+		printf 2>/dev/null sed 2>/dev/null /usr/bin x=1 && grep then "$1"
+	/usr/bin printf local sed | awk test x=1 done && readonly
+&& | export echo x=1 test
+		"$@" readonly sed /usr/bin printf --verbose cd
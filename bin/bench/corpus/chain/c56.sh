@@ -0,0 +1,2001 @@
+	sed export ${HOME} /usr/bin echo grep x=1 "$1" ${HOME} grep -eu
+	readonly cd export then sed printf --verbose | /usr/bin -eu echo grep
+	sed x=1 export then done --verbose
+--verbose done --verbose sed ${HOME} printf local
+export "$1" cd $(pwd) then test done
+	local awk sed --verbose
+printf done x=1 done test "$1" grep --verbose 'quoted text' "$1" awk done /usr/bin
+		export -eu awk echo | grep
+	--verbose "$1" done ${HOME} x=1 -eu echo
+	local printf --verbose $(pwd) 2>/dev/null "$@" local /usr/bin echo awk && export
+	export 2>/dev/null x=1
+	x=1 "$1" /usr/bin "$1" -eu grep awk then --verbose | 2>/dev/null 2>/dev/null
+awk local done 2>/dev/null x=1 awk echo --verbose
+--verbose echo 2>/dev/null | -eu cd 2>/dev/null
+${HOME} printf ${HOME} -eu -eu done "$@" test ${HOME} | "$1" "$@" grep done
+		"$1" | local ${HOME} cd x=1 done 2>/dev/null -eu test printf
+	-eu sed "$1" && /usr/bin done -eu 2>/dev/null x=1 "$1"
+--verbose 2>/dev/null echo cd | done done
+cd && local && readonly $(pwd) awk 2>/dev/null -eu "$@" grep then grep
+		echo sed awk 2>/dev/null awk 2>/dev/null "$1" readonly readonly $(pwd) grep
+	grep export cd "$@" readonly | readonly x=1 "$1" --verbose then
+		/usr/bin local echo /usr/bin /usr/bin "$@" awk
+	x=1 readonly printf done
+	done ${HOME} echo then done 'quoted text' grep x=1 | /usr/bin echo "$1" "$1"
+		| ${HOME} "$@" 2>/dev/null
+		-eu "$1" echo | "$1" && cd awk local cd
+	printf --verbose x=1 done cd local sed | printf local 2>/dev/null local
+	x=1 local cd grep done readonly ${HOME} echo sed -eu ${HOME} echo then
+		then "$@" grep x=1 readonly -eu "$@" awk /usr/bin readonly | "$1" 2>/dev/null
+		readonly && printf "$1" printf -eu x=1 --verbose 'quoted text' 'quoted text'
+		export ${HOME} "$@" done echo
+test cd printf x=1 -eu -eu local readonly done sed && sed cd /usr/bin ${HOME}
+		'quoted text' "$@" | ${HOME} local --verbose $(pwd) "$@" --verbose
+then $(pwd) echo --verbose cd local done -eu done done test
+done then "$1" done echo "$@" x=1 --verbose
+	"$1" sed sed grep --verbose
+then --verbose $(pwd) test 2>/dev/null then cd export
+"$1" 'quoted text' /usr/bin x=1 grep x=1 2>/dev/null ${HOME} --verbose && cd awk
+		cd awk local readonly then awk then test --verbose
+		${HOME} | | then printf export export --verbose "$1" 2>/dev/null
+&& "$1" test && -eu printf x=1 ${HOME}
+		local done test | export awk then readonly 2>/dev/null "$1" "$1"
+cd export awk test then && && export awk cd cd ${HOME} ${HOME} --verbose ${HOME}
+x=1 awk x=1 2>/dev/null /usr/bin cd 2>/dev/null
+local /usr/bin echo /usr/bin sed then test --verbose printf
+		cd | then "$@" ${HOME} grep /usr/bin 'quoted text' readonly test
+	echo "$1" test -eu sed export /usr/bin | printf /usr/bin
+	awk "$@" printf ${HOME} 'quoted text' test
+echo | 'quoted text' $(pwd) | 2>/dev/null
+test "$@" grep ${HOME}
+	awk "$1" $(pwd) ${HOME} --verbose
+$(pwd) ${HOME} test grep test cd sed done sed cd sed "$1" local -eu && done done
+'quoted text' 'quoted text' 2>/dev/null
+	| sed cd grep echo echo
+		awk awk --verbose test printf
+	-eu then ${HOME} --verbose
+	| /usr/bin printf sed x=1 ${HOME} && "$@" --verbose
+'quoted text' && 'quoted text' ${HOME}
+then x=1 | echo 2>/dev/null done | 'quoted text' 'quoted text' local done
+"$@" echo cd "$1" ${HOME} sed then local 'quoted text' ${HOME}
+${HOME} awk echo "$@" export printf done -eu ${HOME} test
+echo -eu readonly sed done ${HOME} "$@" test done
+	--verbose printf local "$@" readonly && grep grep
+		/usr/bin then printf "$@"
+export 'quoted text' "$@" $(pwd) sed awk test
+"$@" -eu ${HOME} test test sed /usr/bin ${HOME} 2>/dev/null x=1
+	test cd sed ${HOME} done /usr/bin
+--verbose && -eu -eu $(pwd) 2>/dev/null "$@" then echo -eu sed
+grep | ${HOME} local cd then $(pwd) sed echo ${HOME} test
+printf 2>/dev/null echo "$1" $(pwd) grep && test /usr/bin awk
+		'quoted text' -eu local test printf
+		grep 'quoted text' $(pwd) printf printf sed sed 'quoted text' --verbose
+	${HOME} echo sed test printf && &&
+	"$1" | export -eu "$@"
+2>/dev/null awk --verbose cd "$@" --verbose
+	-eu done -eu then 2>/dev/null
+cd export sed "$@" 2>/dev/null /usr/bin printf awk -eu echo 2>/dev/null x=1
+	"$@" | then then test $(pwd) cd ${HOME} "$1" test echo -eu sed -eu
+	export printf 2>/dev/null export local then
+		2>/dev/null cd done test ${HOME} $(pwd) 'quoted text'
+	/usr/bin then ${HOME} /usr/bin | echo grep | 'quoted text'
+		done export -eu test test export test ${HOME} /usr/bin
+cd | 'quoted text' printf "$1" sed "$@" --verbose ${HOME} 'quoted text'
+	readonly --verbose printf | test ${HOME} 2>/dev/null
+		grep /usr/bin --verbose --verbose
+	/usr/bin local then /usr/bin printf "$@" | done
+"$@" sed "$1" local "$1" /usr/bin grep && sed | --verbose | awk
+		grep awk local 'quoted text' test cd local 2>/dev/null
+		export -eu "$1" sed printf local readonly
+-eu grep cd && "$1" grep sed readonly ${HOME} then readonly
+local x=1 printf awk | awk /usr/bin 'quoted text' then -eu -eu test
+	printf | local then /usr/bin test sed && $(pwd)
+"$1" | /usr/bin "$1"
+"$1" cd test $(pwd) printf cd | done then "$@" echo local --verbose
+	then $(pwd) /usr/bin readonly export done sed 'quoted text' cd then 'quoted text'
+		then ${HOME} echo printf x=1 done then echo echo then --verbose
+	'quoted text' export $(pwd) printf -eu ${HOME} $(pwd) --verbose
+export --verbose ${HOME} | --verbose "$1" export x=1 grep awk local
+	'quoted text' cd && --verbose grep && readonly ${HOME}
+	'quoted text' --verbose "$@" --verbose
+printf --verbose x=1 test done && printf echo
+		awk x=1 "$1" then awk cd -eu
+	--verbose grep --verbose grep sed grep cd then
+		echo then done grep awk then export "$@" 'quoted text' $(pwd) 'quoted text' 2>/dev/null
+		readonly | $(pwd) export awk sed | && "$@" test "$@" awk grep | "$@" | echo
+/usr/bin local ${HOME} ${HOME} readonly grep export readonly
+| x=1 printf && $(pwd) grep && local 2>/dev/null /usr/bin -eu readonly
+		awk then test | --verbose local echo 2>/dev/null
+$(pwd) -eu /usr/bin | | 'quoted text' 2>/dev/null
+grep cd /usr/bin then echo echo 'quoted text'
+awk local readonly sed awk /usr/bin 'quoted text'
+"$1" /usr/bin export test grep "$1" echo | then
+	test ${HOME} "$@" local export local grep awk
+		${HOME} awk --verbose $(pwd)
+	| --verbose /usr/bin $(pwd) sed x=1 grep done
+		&& done "$1" done /usr/bin done | readonly
+--verbose ${HOME} grep ${HOME} test sed
+		$(pwd) 2>/dev/null | x=1 local
+		--verbose readonly | local grep test done 'quoted text'
+	"$@" -eu 2>/dev/null "$1" cd /usr/bin
+$(pwd) test $(pwd) &&
+	awk 2>/dev/null then --verbose "$@" 'quoted text' "$@" then
+'quoted text' "$@" ${HOME} && awk printf /usr/bin sed awk 'quoted text'
+	| awk local "$@" local 'quoted text'
+&& /usr/bin echo local local "$1" printf 'quoted text'
+	done x=1 grep grep x=1 test x=1 2>/dev/null
+local grep 2>/dev/null test && --verbose /usr/bin --verbose
+		export grep local echo readonly 2>/dev/null
+		'quoted text' export && && ${HOME}
+local done local $(pwd) grep awk "$@" local && sed awk
+--verbose "$1" grep readonly
+	cd echo printf grep done printf printf ${HOME} "$@" readonly x=1 awk then local
+		awk "$@" local | "$1" sed sed /usr/bin
+		readonly 'quoted text' x=1 "$1" 2>/dev/null
+		export "$@" grep -eu 'quoted text' sed x=1 local
+-eu local awk then export ${HOME} sed && "$1" grep && test printf test then
+readonly sed ${HOME} 'quoted text'
+cd export readonly done done 'quoted text' && test | printf local
+	2>/dev/null export $(pwd) -eu $(pwd) x=1 test grep
+		done -eu done "$@" test echo
+	done 2>/dev/null grep readonly
+printf local printf --verbose --verbose
+/usr/bin "$1" echo local sed grep export sed
+${HOME} | test /usr/bin /usr/bin printf 'quoted text'
+		2>/dev/null awk "$@" "$@" && "$@" && "$1" grep cd
+	--verbose --verbose readonly 'quoted text' 2>/dev/null cd printf grep $(pwd)
+		"$1" -eu readonly printf
+		local $(pwd) test local test /usr/bin cd /usr/bin --verbose readonly awk
+	'quoted text' /usr/bin 2>/dev/null ${HOME} awk export local --verbose awk
+	readonly sed test && readonly awk ${HOME} --verbose cd printf sed
+	cd printf grep sed then done
+		grep then ${HOME} sed echo x=1 export ${HOME} x=1 test export
+	cd echo "$1" sed grep && awk x=1 done | printf awk -eu readonly
+2>/dev/null --verbose | | printf "$@" /usr/bin
+grep awk --verbose awk /usr/bin test readonly ${HOME} printf --verbose 2>/dev/null
+export /usr/bin 'quoted text'
+		export --verbose "$@" && readonly readonly "$@" "$@"
+	| sed then ${HOME} test then | then $(pwd) $(pwd) test sed grep local
+		sed export done ${HOME}
+grep /usr/bin export x=1 ${HOME} ${HOME} grep echo | awk
+sed && done echo awk 2>/dev/null readonly ${HOME} test "$1" "$1" ${HOME} sed
+	'quoted text' "$@" grep test /usr/bin 2>/dev/null echo -eu 'quoted text'
+	"$@" cd sed "$1" /usr/bin
+done readonly test x=1 $(pwd) awk /usr/bin
+| 'quoted text' grep 'quoted text' --verbose
+&& $(pwd) sed --verbose done
+--verbose then -eu && sed echo "$1" then test printf test ${HOME}
+echo cd $(pwd) done done x=1 sed export -eu then
+		2>/dev/null | local x=1 ${HOME} then --verbose then --verbose
+done "$@" done "$1" export awk awk /usr/bin done sed ${HOME} sed readonly
+${HOME} sed awk echo --verbose cd awk 'quoted text' echo
+grep grep then ${HOME} then readonly 'quoted text' x=1 ${HOME} ${HOME}
+"$1" --verbose awk && echo grep "$@" $(pwd)
+sed then | 'quoted text' x=1 awk /usr/bin awk then sed
+	grep awk printf 2>/dev/null test export grep
+	"$@" sed local | "$1" printf
+	export && 2>/dev/null && "$@" -eu --verbose test export ${HOME} ${HOME}
+	"$1" local then /usr/bin local 2>/dev/null test echo echo test readonly readonly
+		2>/dev/null x=1 done then cd cd printf export
+	test -eu "$1" then && test ${HOME}
+	$(pwd) $(pwd) x=1 'quoted text' awk cd sed -eu printf /usr/bin x=1
+		$(pwd) 2>/dev/null 'quoted text' 2>/dev/null awk test grep
+		'quoted text' echo export then done local "$@" 'quoted text' test 'quoted text'
+	sed grep "$@" awk ${HOME} readonly echo 2>/dev/null 2>/dev/null "$@" awk test
+		"$1" $(pwd) 'quoted text' && readonly /usr/bin --verbose -eu 2>/dev/null
+		done printf /usr/bin export awk export "$1" cd 2>/dev/null echo grep sed
+	local ${HOME} grep grep cd
+&& 2>/dev/null -eu && printf 2>/dev/null done
+'quoted text' test readonly 2>/dev/null
+		--verbose sed "$1" echo echo -eu done "$@" sed -eu printf then done then -eu
+		--verbose --verbose grep then sed "$1" 'quoted text' export "$1"
+		echo sed test then readonly
+echo "$1" export /usr/bin $(pwd) sed
+		done && awk then printf ${HOME}
+		done then grep then x=1 test
+		--verbose --verbose 'quoted text' done $(pwd) /usr/bin /usr/bin
+		${HOME} -eu "$1" | -eu sed sed readonly
+then && $(pwd) "$1" grep
+		&& && local 2>/dev/null && test
+	sed readonly "$1" | printf local export -eu x=1 then 2>/dev/null
+"$@" then then cd 2>/dev/null x=1 x=1 --verbose then echo export 2>/dev/null
+test cd printf -eu --verbose && ${HOME}
+${HOME} /usr/bin cd --verbose awk "$1" x=1 readonly "$@"
+echo done readonly 'quoted text' "$@" | awk readonly
+/usr/bin readonly --verbose |
+	&& done -eu x=1 export -eu cd local export cd readonly 'quoted text' sed -eu
+	&& ${HOME} awk test then done && -eu cd --verbose
+	echo readonly then sed readonly /usr/bin 'quoted text' ${HOME} awk printf
+local x=1 printf "$1" $(pwd) done && sed 2>/dev/null awk /usr/bin test
+	sed grep awk readonly then then local test awk 'quoted text'
+${HOME} 'quoted text' echo test cd && --verbose ${HOME} "$@"
+	$(pwd) printf echo && grep local $(pwd) --verbose && grep 'quoted text' 'quoted text'
+		x=1 sed readonly 2>/dev/null then ${HOME} /usr/bin
+	"$@" && ${HOME} --verbose $(pwd) grep done "$1" x=1 ${HOME} "$1" -eu then
+$(pwd) cd readonly /usr/bin printf local
+$(pwd) local && local done "$@" 2>/dev/null
+	sed test sed cd | --verbose awk ${HOME} awk export 2>/dev/null grep | test
+	x=1 2>/dev/null awk echo 'quoted text' | /usr/bin | "$1" --verbose
+2>/dev/null export awk -eu --verbose
+		$(pwd) x=1 && $(pwd) --verbose cd "$1" printf && -eu $(pwd) $(pwd)
+"$1" printf 'quoted text' && -eu "$1" $(pwd) local
+| 2>/dev/null local then printf "$@" 'quoted text'
+		'quoted text' $(pwd) -eu 2>/dev/null awk x=1 sed printf
+x=1 --verbose awk $(pwd)
+		-eu test awk export sed export export then
+		readonly sed --verbose awk | echo export done cd $(pwd) cd ${HOME} readonly
+	awk 2>/dev/null awk /usr/bin readonly "$1" done x=1 "$1" | ${HOME}
+"$1" sed test "$1" printf --verbose echo 'quoted text' echo printf echo
+readonly x=1 "$@" $(pwd) -eu awk && /usr/bin | 2>/dev/null grep echo
+		-eu $(pwd) | -eu --verbose
+${HOME} done export --verbose printf --verbose export 2>/dev/null
+	printf sed export sed x=1 export echo
+--verbose done printf 2>/dev/null /usr/bin
+2>/dev/null then done 'quoted text' | x=1
+		done cd printf | $(pwd) cd 2>/dev/null ${HOME} 2>/dev/null
+	| "$1" 2>/dev/null local | done export echo awk
+		then 2>/dev/null 'quoted text' awk then local done 'quoted text'
+		then | printf $(pwd) printf ${HOME}
+$(pwd) -eu export echo readonly
+		printf x=1 'quoted text' test done cd 2>/dev/null && export /usr/bin -eu | cd export
+	$(pwd) export done /usr/bin export cd -eu
+	sed "$1" printf | export "$1" cd "$@" awk grep awk
+	printf && awk --verbose -eu && printf && done
+		sed "$@" printf awk readonly cd "$@" "$1" "$1" x=1
+		--verbose "$1" -eu 'quoted text' cd --verbose --verbose export ${HOME} "$@"
+	cd cd 'quoted text' printf echo test local --verbose echo
+sed local x=1 -eu sed 2>/dev/null $(pwd) "$1" grep cd /usr/bin $(pwd)
+		/usr/bin export 'quoted text' cd 'quoted text' then export
+printf 'quoted text' --verbose x=1 -eu && "$@" -eu test -eu done done
+		done printf && sed 2>/dev/null -eu grep --verbose 2>/dev/null
+	readonly echo cd "$1" -eu x=1 /usr/bin && | echo
+2>/dev/null 2>/dev/null export -eu done "$1"
+	export 'quoted text' ${HOME} "$@" printf cd awk 2>/dev/null /usr/bin awk
+	x=1 -eu --verbose readonly && grep $(pwd) printf local awk
+	cd cd done test -eu 'quoted text'
+	${HOME} -eu done 2>/dev/null /usr/bin && test "$@" echo x=1 ${HOME}
+		grep local printf echo readonly export echo | ${HOME}
+"$1" test "$1" awk printf ${HOME} grep
+'quoted text' | awk sed
+'quoted text' echo -eu then done awk grep "$@" local | local
+	2>/dev/null echo grep 'quoted text' -eu 'quoted text' export
+	awk grep $(pwd) $(pwd) test readonly
+		cd ${HOME} sed grep "$1" done test then printf --verbose then done then
+		/usr/bin 2>/dev/null "$1"
+		printf printf sed 2>/dev/null local "$@"
+${HOME} "$@" && "$1" readonly echo cd | ${HOME} | ${HOME} sed &&
+echo then | "$@" 2>/dev/null awk --verbose ${HOME}
+		awk awk export done awk "$1" /usr/bin
+	"$@" test done "$@" "$1" ${HOME} x=1 local | $(pwd) printf sed
+	x=1 --verbose awk "$@" && done "$1" local
+	export readonly sed && cd /usr/bin ${HOME} && cd awk local awk test export
+		| readonly -eu echo awk readonly grep 2>/dev/null 'quoted text'
+		printf && | 2>/dev/null done && readonly awk && export /usr/bin printf readonly
+		--verbose 'quoted text'
+export done && && cd done x=1 -eu grep awk && sed "$@"
+		x=1 && ${HOME} "$@" then
+echo 2>/dev/null awk grep
+	&& $(pwd) --verbose "$1" test then
+	-eu 'quoted text' done | test test grep local -eu x=1 /usr/bin awk 'quoted text'
+	printf sed -eu done grep "$@" then 2>/dev/null readonly local sed echo -eu && 'quoted text'
+		${HOME} test cd 2>/dev/null echo x=1 grep 'quoted text' grep --verbose grep
+"$@" awk echo done local echo -eu local export test /usr/bin ${HOME} | 'quoted text'
+	local $(pwd) x=1 grep && local local "$@" readonly then grep "$1"
+	local then 'quoted text' export "$@" $(pwd)
+test x=1 --verbose -eu local | test | local printf sed test done /usr/bin readonly
+then 2>/dev/null then $(pwd) /usr/bin /usr/bin sed
+	echo printf /usr/bin local sed
+	--verbose readonly 2>/dev/null
+readonly "$1" 'quoted text' $(pwd) /usr/bin local done local then awk export
+		cd readonly sed export export -eu export "$1" grep export -eu echo
+	then test | ${HOME} ${HOME} "$1" "$1" done then "$1" 2>/dev/null
+	local "$@" "$@" && /usr/bin export local then /usr/bin
+	readonly done 'quoted text' test printf "$@" --verbose then "$@" then
+/usr/bin test && && $(pwd) export /usr/bin sed $(pwd) local "$1" awk cd sed
+"$1" grep --verbose printf
+sed test grep "$1" printf --verbose | 2>/dev/null | then done | sed "$@" && | "$1"
+x=1 'quoted text' local
+		grep /usr/bin 'quoted text' ${HOME} --verbose ${HOME} "$1" grep 2>/dev/null
+/usr/bin local printf printf grep
+| local grep cd export | 'quoted text' 'quoted text' awk test printf
+done ${HOME} sed /usr/bin grep printf then grep x=1 cd | test
+	then "$@" 'quoted text' "$1" printf && readonly printf x=1 x=1 'quoted text' 2>/dev/null
+&& test 2>/dev/null --verbose export printf -eu then sed 'quoted text'
+'quoted text' echo /usr/bin grep "$1" export "$@" export 2>/dev/null
+	test ${HOME} && x=1 | awk 2>/dev/null echo local readonly
+		local && "$@" cd 2>/dev/null awk test echo
+		readonly done /usr/bin echo readonly
+		done test --verbose 'quoted text' done ${HOME} ${HOME} readonly "$@" 2>/dev/null
+	awk $(pwd) x=1 | export
+	cd readonly echo | | readonly | test export x=1 then readonly
+		${HOME} "$@" sed --verbose readonly
+	| test x=1 "$1" 2>/dev/null grep then 'quoted text' -eu
+	-eu /usr/bin ${HOME} "$1" readonly
+		readonly export -eu x=1 test readonly echo x=1 printf
+&& test 'quoted text' done | then
+	export printf awk | 'quoted text' grep echo /usr/bin "$1" grep x=1 2>/dev/null
+		readonly local 2>/dev/null x=1 && "$@" grep then echo 'quoted text' export grep
+		awk -eu "$1" "$1" sed export then sed "$1" export export printf local x=1 printf
+		2>/dev/null echo awk local && done cd grep $(pwd) export done
+'quoted text' sed printf local
+	| then "$1" then 'quoted text' then export test
+		${HOME} ${HOME} sed echo $(pwd) sed --verbose x=1 | done /usr/bin 2>/dev/null
+then echo $(pwd) then 2>/dev/null
+		${HOME} | test "$@" awk export sed printf /usr/bin
+		awk local 'quoted text' printf
+cd done && export then test
+	/usr/bin 'quoted text' "$1" then ${HOME} 2>/dev/null echo local grep readonly &&
+$(pwd) then 'quoted text' | 'quoted text'
+		/usr/bin export grep --verbose test
+		| readonly 'quoted text' then "$1"
+	| test sed "$@" x=1 readonly done --verbose && readonly --verbose
+		then readonly $(pwd) $(pwd) printf readonly x=1 /usr/bin
+&& x=1 export 2>/dev/null then x=1 awk && && /usr/bin done --verbose
+$(pwd) done echo && export 'quoted text' readonly cd local --verbose export
+		${HOME} printf grep test --verbose 'quoted text' sed "$@" | printf ${HOME} cd
+		"$1" sed test --verbose $(pwd) echo
+$(pwd) awk /usr/bin --verbose x=1 &&
+	"$1" "$1" readonly && export cd readonly sed grep export "$1"
+		test "$1" printf echo && -eu grep sed cd | "$1" /usr/bin then export
+&& test awk $(pwd) then local "$1"
+		test test /usr/bin readonly local $(pwd) --verbose done $(pwd)
+	grep | then grep readonly awk /usr/bin | "$@" export
+--verbose | -eu 2>/dev/null then cd x=1
+then export readonly "$@" awk sed local test awk "$1" done 'quoted text'
+		grep "$@" 2>/dev/null local x=1 cd "$@" echo done x=1 ${HOME} /usr/bin export
+		--verbose "$@" ${HOME} $(pwd) local local "$@" echo export 'quoted text'
+readonly readonly $(pwd) | cd ${HOME} local readonly echo && "$@" export "$@"
+		$(pwd) readonly | -eu ${HOME} && then 'quoted text' "$@" cd sed local readonly
+		local awk export printf --verbose readonly
+		--verbose awk $(pwd) awk cd
+		-eu 'quoted text' --verbose
+	${HOME} | --verbose x=1
+	'quoted text' printf readonly local cd
+'quoted text' x=1 readonly cd done
+	then then test test grep readonly 2>/dev/null
+&& $(pwd) && done | cd ${HOME} 'quoted text' done -eu --verbose
+		'quoted text' /usr/bin "$@" done | 2>/dev/null sed
+		$(pwd) "$@" test awk sed ${HOME} "$1" cd awk cd local 'quoted text' --verbose
+	done | ${HOME} echo /usr/bin then "$1" readonly readonly then test export readonly
+	'quoted text' sed local cd awk x=1 --verbose
+	'quoted text' done /usr/bin ${HOME}
+sed "$1" export | echo x=1 'quoted text' 2>/dev/null $(pwd) -eu /usr/bin
+$(pwd) done $(pwd) && 'quoted text' $(pwd) 2>/dev/null -eu done ${HOME} cd sed
+		"$@" | "$@" test $(pwd) printf $(pwd) | && export cd done $(pwd) /usr/bin x=1
+	"$@" "$1" 'quoted text' grep -eu
+		echo "$1" /usr/bin 2>/dev/null echo ${HOME} 'quoted text'
+	'quoted text' cd x=1 $(pwd) -eu
+/usr/bin awk readonly 'quoted text'
+	"$@" grep export test local awk then "$@" cd then
+	grep 2>/dev/null x=1 local grep then done test | readonly --verbose x=1 test cd
+	then 'quoted text' /usr/bin x=1 ${HOME} --verbose "$1"
+	${HOME} -eu && awk then ${HOME} --verbose | 2>/dev/null test "$1" readonly
+export then && sed "$@" ${HOME} grep awk test export
+		| export ${HOME} 2>/dev/null 2>/dev/null
+	test "$@" "$1" printf $(pwd) && local sed "$1"
+		2>/dev/null awk && test $(pwd) | && done export && awk awk
+		local readonly x=1 export /usr/bin && test --verbose then
+		cd --verbose done export export
+&& && export && local ${HOME} done then 'quoted text' done x=1 "$@"
+		grep ${HOME} readonly x=1 export "$1" --verbose awk done printf x=1 "$1" then
+	printf && $(pwd) sed && --verbose then awk | "$1" export 2>/dev/null
+	export local sed sed local sed then "$@" export "$1" --verbose
+		"$1" "$@" export test 'quoted text' printf /usr/bin local --verbose && --verbose
+	printf $(pwd) export "$@"
+export then 2>/dev/null done x=1 grep 'quoted text' "$1" | readonly
+	"$1" /usr/bin ${HOME} 'quoted text' 2>/dev/null
+	test "$1" $(pwd) grep /usr/bin export local | 2>/dev/null
+'quoted text' awk ${HOME} awk sed 'quoted text' &&
+		awk "$1" --verbose "$@" readonly x=1 sed "$1" printf printf
+	${HOME} | done "$1" then x=1 cd local test local "$@" 'quoted text'
+		"$1" /usr/bin echo test ${HOME} ${HOME} cd echo grep ${HOME}
+x=1 && readonly "$@" 'quoted text' x=1 ${HOME} x=1 test then 'quoted text'
+awk grep && ${HOME} -eu then --verbose then
+		${HOME} then x=1 /usr/bin grep export cd "$1" "$1" local
+export local printf $(pwd) readonly $(pwd) --verbose && awk | "$1" sed
+	grep 'quoted text' test "$@"
+		--verbose "$@" --verbose awk "$1" && "$@" && && echo test then export printf
+&& local grep "$1" --verbose awk
+	then -eu printf echo then cd cd cd && cd /usr/bin local
+		cd $(pwd) local printf awk grep | grep 2>/dev/null readonly ${HOME} test $(pwd)
+		then 'quoted text' | | 2>/dev/null ${HOME} echo printf
+	cd $(pwd) grep /usr/bin 2>/dev/null
+	grep /usr/bin grep grep x=1 | grep --verbose cd done done "$1"
+	$(pwd) && "$@" printf cd
+local export x=1 | 'quoted text' 'quoted text'
+--verbose grep "$@" && cd && --verbose
+		$(pwd) then echo ${HOME} test 'quoted text' export
+	"$1" "$1" printf && done test
+	done --verbose | | done "$@" 2>/dev/null $(pwd) export grep x=1 done x=1
+	/usr/bin -eu x=1 printf
+	echo grep readonly readonly readonly echo echo
+		cd 2>/dev/null test --verbose
+$(pwd) export readonly -eu x=1
+	local x=1 "$@" readonly test /usr/bin cd | 'quoted text'
+sed "$1" grep --verbose echo test test echo export && "$1" done cd
+	grep done ${HOME} 2>/dev/null x=1 2>/dev/null "$@" sed test 2>/dev/null &&
+"$1" readonly "$@" echo readonly 'quoted text' x=1 grep
+		awk x=1 && echo local printf $(pwd) awk $(pwd) grep /usr/bin
+		test done done -eu local x=1 local /usr/bin printf -eu done 2>/dev/null -eu printf
+		/usr/bin done test -eu done 2>/dev/null printf $(pwd) echo
+test awk $(pwd) "$1" "$1" 'quoted text' then 'quoted text' echo
+		grep -eu 'quoted text' -eu then cd x=1 echo /usr/bin
+	grep "$@" 2>/dev/null "$@" export 2>/dev/null
+then grep "$@" sed | "$1" local 2>/dev/null
+	sed $(pwd) | /usr/bin -eu 'quoted text' awk sed local --verbose
+		"$@" | then ${HOME} && export ${HOME} ${HOME}
+x=1 "$1" -eu -eu x=1 | && then then /usr/bin local /usr/bin export
+		printf "$1" "$1" 2>/dev/null export awk | grep readonly
+	echo --verbose 2>/dev/null /usr/bin ${HOME}
+	/usr/bin | | local echo echo | | "$1" "$@"
+		echo sed then grep printf export /usr/bin test export 'quoted text'
+	--verbose 2>/dev/null /usr/bin echo /usr/bin awk | | readonly done -eu "$@"
+printf "$@" local then done test "$@" ${HOME} cd
+		local -eu ${HOME} done | test
+		grep --verbose | then cd readonly ${HOME} --verbose cd readonly /usr/bin
+local echo printf then $(pwd) done readonly export
+	done sed --verbose test | export done $(pwd) grep test export
+		printf $(pwd) 2>/dev/null "$@" done test -eu then && test local cd --verbose 2>/dev/null
+	echo | echo ${HOME} export
+	echo printf local /usr/bin && -eu $(pwd) 'quoted text' sed $(pwd) "$@" ${HOME}
+${HOME} then export "$@" sed x=1 "$1" grep cd &&
+		-eu /usr/bin && grep "$1" && grep ${HOME}
+-eu ${HOME} echo ${HOME} cd
+test "$1" export "$@" "$1" grep ${HOME} export 'quoted text' 2>/dev/null
+echo /usr/bin x=1 sed | "$@" readonly | export
+| local -eu then done 2>/dev/null sed ${HOME} printf export /usr/bin --verbose
+	| then awk x=1 then --verbose | "$1" printf export | sed readonly then
+	then /usr/bin | "$1" x=1 --verbose -eu /usr/bin ${HOME} readonly
+	&& $(pwd) printf ${HOME} $(pwd) sed export readonly 'quoted text' export
+		"$1" readonly ${HOME} printf
+		| grep cd /usr/bin -eu
+${HOME} export -eu --verbose ${HOME}
+	test 'quoted text' 2>/dev/null awk | ${HOME} test done readonly
+		awk cd export local "$@"
+		sed then sed -eu $(pwd) 2>/dev/null done | /usr/bin $(pwd) "$@" 'quoted text'
+	export awk 'quoted text'
+	x=1 2>/dev/null printf sed -eu | readonly printf
+		printf grep local echo done readonly ${HOME}
+		grep ${HOME} export 2>/dev/null
+	-eu printf test done readonly "$@" grep -eu /usr/bin
+"$1" 'quoted text' x=1
+| "$@" && test 'quoted text' 2>/dev/null
+		echo readonly local | done ${HOME}
+		$(pwd) local done x=1 test 2>/dev/null done grep && 'quoted text'
+	'quoted text' awk x=1 && test ${HOME} awk grep "$1" local readonly
+awk x=1 awk ${HOME} export then done test -eu then echo 'quoted text'
+/usr/bin sed awk 2>/dev/null
+	x=1 --verbose -eu "$1" "$1" awk grep then export done
+	| "$@" x=1 awk $(pwd) | /usr/bin 'quoted text' --verbose
+		local grep printf | 'quoted text' printf | sed printf
+| cd done readonly printf && awk /usr/bin
+x=1 export ${HOME} "$1" ${HOME} readonly done x=1 /usr/bin grep printf
+	-eu "$1" then /usr/bin readonly echo ${HOME} sed then cd test done export
+2>/dev/null -eu "$1" ${HOME}
+export --verbose grep $(pwd) done printf local -eu x=1
+	printf test cd "$1" then
+	done "$@" printf x=1 printf cd awk cd readonly
+		2>/dev/null /usr/bin -eu readonly 'quoted text'
+echo $(pwd) printf && test ${HOME} 2>/dev/null 2>/dev/null sed ${HOME}
+echo | readonly grep "$1" local ${HOME} done | done |
+		cd grep /usr/bin 2>/dev/null export
+	'quoted text' 'quoted text'
+	-eu echo sed printf local
+	sed awk grep -eu cd grep
+	echo then ${HOME} "$1" "$1"
+sed export test -eu $(pwd) ${HOME} test cd $(pwd)
+local /usr/bin then 2>/dev/null "$1" readonly -eu done ${HOME} "$@" && x=1 --verbose
+$(pwd) ${HOME} grep 'quoted text' "$1"
+		local grep "$@" export grep 2>/dev/null "$1" -eu done
+sed /usr/bin -eu grep -eu readonly | && export
+		done 2>/dev/null --verbose -eu then local -eu cd -eu --verbose 'quoted text'
+${HOME} test "$@" -eu && echo 'quoted text'
+	cd export 'quoted text' echo grep
+		then ${HOME} "$@" sed test -eu
+	cd sed then test "$@" printf
+		then cd local cd done local echo | "$@" "$1" ${HOME} /usr/bin awk cd "$1" export
+	| /usr/bin printf -eu && 'quoted text'
+x=1 cd cd /usr/bin x=1 readonly && --verbose printf /usr/bin
+	then -eu 'quoted text' export x=1 sed grep x=1
+	2>/dev/null echo /usr/bin -eu "$1" export awk readonly
+| echo && 'quoted text' export printf && -eu
+		/usr/bin cd grep awk local --verbose readonly 'quoted text' export test readonly
+	awk printf 2>/dev/null local echo awk echo --verbose
+	$(pwd) then export awk ${HOME} done local test local awk $(pwd) done local sed
+		export grep export x=1 -eu --verbose /usr/bin local
+		test sed "$1" echo grep then "$1" 2>/dev/null ${HOME} /usr/bin && sed "$1"
+		"$@" grep "$@" 2>/dev/null done && 2>/dev/null "$1"
+		$(pwd) -eu cd export export $(pwd)
+--verbose echo local local "$@" printf export x=1 awk test echo &&
+		grep /usr/bin awk export 2>/dev/null | grep printf test x=1 test done /usr/bin then
+done printf $(pwd) then --verbose test export
+		&& -eu echo export grep && $(pwd) /usr/bin && echo &&
+		done then && 'quoted text' cd && sed 'quoted text' | | --verbose
+	$(pwd) done printf -eu $(pwd) then grep 2>/dev/null $(pwd)
+	cd x=1 printf awk export "$1" echo --verbose grep $(pwd) ${HOME} && 'quoted text'
+		sed 'quoted text' "$@" sed done 'quoted text' "$@" local --verbose "$@"
+'quoted text' local /usr/bin local done awk awk awk "$@" $(pwd) --verbose
+	${HOME} ${HOME} && "$1" local cd && $(pwd) awk export 2>/dev/null
+		printf cd done then x=1
+x=1 $(pwd) x=1 /usr/bin export done then $(pwd)
+		${HOME} then then printf && | "$@" $(pwd)
+	-eu x=1 $(pwd) readonly local test --verbose
+		printf done then local sed export && echo | awk local done
+	/usr/bin --verbose then "$1" /usr/bin -eu sed /usr/bin test awk /usr/bin
+	2>/dev/null | then echo local
+	printf /usr/bin 2>/dev/null awk | done sed awk --verbose -eu /usr/bin
+awk then "$1" test -eu | awk ${HOME} grep /usr/bin 'quoted text'
+		'quoted text' ${HOME} done printf done | | readonly /usr/bin x=1 readonly
+	'quoted text' readonly 2>/dev/null readonly
+	echo | $(pwd) readonly grep 'quoted text'
+		echo sed -eu done awk grep ${HOME} ${HOME} 2>/dev/null echo cd $(pwd) done
+2>/dev/null grep "$@" | 2>/dev/null 'quoted text' then printf
+		$(pwd) local sed export then
+local done | sed --verbose readonly
+sed awk cd export awk awk export echo sed $(pwd) "$1" 2>/dev/null sed local "$@"
+	test sed local $(pwd) --verbose
+	"$1" export "$1" then readonly then x=1 echo $(pwd)
+		2>/dev/null ${HOME} awk $(pwd) echo $(pwd) | ${HOME} $(pwd) test grep readonly
+"$1" then printf -eu sed then /usr/bin "$@" echo awk
+	readonly readonly /usr/bin awk
+then echo ${HOME} 2>/dev/null 2>/dev/null |
+		export export awk -eu /usr/bin export && 2>/dev/null
+		x=1 $(pwd) 'quoted text' && x=1
+		done 2>/dev/null sed "$1" $(pwd) grep ${HOME} test x=1 | -eu
+		${HOME} 'quoted text' sed done test grep 2>/dev/null /usr/bin "$@" grep
+		"$@" --verbose -eu test && -eu --verbose sed test -eu
+	x=1 cd 'quoted text' "$1" echo cd export -eu
+$(pwd) | printf ${HOME} && grep --verbose export --verbose $(pwd) "$1" "$1" -eu
+done 2>/dev/null 'quoted text' /usr/bin
+sed | ${HOME} ${HOME} readonly && /usr/bin $(pwd) printf
+	| awk /usr/bin -eu && -eu 2>/dev/null
+&& done 'quoted text' then sed printf sed printf grep $(pwd) done sed echo &&
+	awk printf readonly $(pwd) --verbose x=1 /usr/bin test done printf $(pwd) $(pwd)
+		2>/dev/null "$1" 2>/dev/null awk "$@" done ${HOME} test --verbose sed
+		local /usr/bin x=1 -eu && sed "$@" -eu readonly $(pwd) && done test
+then cd && && | local sed echo
+		grep x=1 2>/dev/null readonly
+		printf -eu x=1 awk local /usr/bin x=1 export /usr/bin test printf $(pwd) ${HOME}
+"$@" "$1" x=1 "$1" | readonly test "$@" grep 'quoted text' 2>/dev/null
+		grep && awk 2>/dev/null "$1" --verbose
+2>/dev/null --verbose x=1
+	test "$1" 2>/dev/null "$@"
+		export --verbose -eu "$1"
+	export /usr/bin local awk /usr/bin "$1" cd x=1 && "$@" /usr/bin grep then
+		| "$1" $(pwd) "$@" cd "$@"
+	cd local ${HOME} x=1 --verbose readonly | export awk done
+local cd printf 'quoted text' export cd cd 'quoted text' ${HOME} export
+	--verbose done then --verbose echo 'quoted text' printf
+		cd local && /usr/bin $(pwd) | printf then --verbose 'quoted text'
+		/usr/bin readonly awk && --verbose && printf "$1" awk /usr/bin readonly
+	readonly "$1" printf done -eu --verbose then && 2>/dev/null x=1
+		"$@" echo done export awk sed | 'quoted text' 2>/dev/null
+echo x=1 cd /usr/bin 'quoted text' && export readonly
+	&& test readonly done && $(pwd)
+	cd echo -eu "$@" "$@" awk sed $(pwd) then then awk -eu /usr/bin test
+readonly awk export export "$@" printf --verbose --verbose 2>/dev/null
+printf export | | "$@" done test then test sed "$1" grep && ${HOME}
+		"$@" x=1 export x=1 readonly --verbose ${HOME} "$1" done 2>/dev/null /usr/bin
+x=1 then /usr/bin export x=1 "$@" 'quoted text' x=1 "$@" "$@"
+&& test test $(pwd) sed -eu cd grep
+		then cd "$@" done && readonly readonly ${HOME} && cd grep && echo export /usr/bin
+	"$1" printf -eu 'quoted text'
+		'quoted text' --verbose $(pwd) done $(pwd) 'quoted text'
+"$1" 'quoted text' "$@" && readonly test test sed 'quoted text'
+		"$@" 2>/dev/null ${HOME} done "$1" done
+		cd awk local printf echo | sed -eu
+		/usr/bin export awk echo test ${HOME} --verbose ${HOME} done cd echo echo
+		&& ${HOME} export x=1 done local then then local echo x=1 --verbose awk then
+	sed then then cd ${HOME} "$1" grep
+$(pwd) 'quoted text' printf
+		'quoted text' local && ${HOME} cd
+${HOME} 'quoted text' && "$@" sed export
+		'quoted text' printf -eu done readonly
+		done ${HOME} local echo
+/usr/bin ${HOME} x=1 grep echo 'quoted text' -eu
+		'quoted text' then 2>/dev/null then /usr/bin 2>/dev/null --verbose
+test cd export -eu echo then "$@" "$@" readonly readonly "$1" readonly readonly
+&& | /usr/bin -eu -eu local --verbose x=1 /usr/bin export /usr/bin readonly
+		awk printf readonly printf | | then sed 'quoted text'
+x=1 cd local && 2>/dev/null | | printf ${HOME} then ${HOME} x=1 echo
+x=1 | $(pwd) "$@" awk export cd 'quoted text' ${HOME}
+	printf --verbose x=1 cd
+	| grep export | done ${HOME} "$@" "$@" awk then grep cd local test
+	test printf /usr/bin "$1" cd local 'quoted text' "$1" "$1" awk test export -eu
+		--verbose && x=1 readonly "$@" "$@" grep cd && awk
+export --verbose $(pwd) echo readonly
+	grep echo export -eu grep readonly && x=1 -eu 'quoted text' $(pwd) export
+	awk test local "$1" /usr/bin echo -eu then 'quoted text'
+--verbose -eu -eu "$@" export done cd export sed readonly
+		| export cd ${HOME} 'quoted text'
+2>/dev/null local x=1 then | then 'quoted text' /usr/bin
+		printf test --verbose export "$1" 'quoted text' awk then echo
+x=1 $(pwd) 'quoted text' test
+		readonly $(pwd) "$@" 'quoted text'
+test "$@" test sed printf x=1
+		/usr/bin "$@" "$1" ${HOME}
+	&& ${HOME} echo 'quoted text' "$@" awk -eu then $(pwd) done 2>/dev/null
+	/usr/bin && ${HOME} /usr/bin $(pwd) "$1" then then then cd 'quoted text' ${HOME}
+		| printf done 'quoted text' x=1 echo
+$(pwd) grep test test && 2>/dev/null
+cd sed local awk local local
+	grep 2>/dev/null -eu export --verbose
+	--verbose 2>/dev/null "$1" && test /usr/bin ${HOME}
+	export $(pwd) "$1" $(pwd) /usr/bin ${HOME} x=1 test 2>/dev/null
+"$1" awk "$@" 2>/dev/null done x=1 grep ${HOME}
+$(pwd) "$@" sed "$1" /usr/bin | readonly local -eu x=1 test readonly |
+awk "$@" "$1" cd test echo /usr/bin
+		printf | test --verbose
+	x=1 "$@" sed "$@" 2>/dev/null export local "$@" x=1
+		"$@" && done -eu readonly done readonly "$@"
+	done x=1 readonly awk /usr/bin 2>/dev/null
+sed ${HOME} $(pwd) 2>/dev/null test awk ${HOME}
+	$(pwd) ${HOME} readonly 2>/dev/null 'quoted text' -eu x=1 local then done "$@"
+		cd export "$1" echo then && $(pwd)
+	echo 2>/dev/null 'quoted text' ${HOME} done
+	sed -eu cd grep then "$@" awk 'quoted text'
+test -eu 'quoted text' sed && echo grep export ${HOME}
+echo x=1 && "$1" done $(pwd) /usr/bin "$1" then
+		test then printf 'quoted text' | printf grep
+grep x=1 && readonly awk x=1 --verbose | done -eu grep done
+done "$@" sed then "$1"
+	local test echo ${HOME}
+	| cd 'quoted text' sed printf 2>/dev/null sed echo cd 'quoted text' 'quoted text'
+	readonly x=1 ${HOME} readonly "$@" $(pwd) sed && readonly
+	awk && && test export echo done cd "$1"
+		awk "$@" done test local awk ${HOME}
+	'quoted text' ${HOME} --verbose sed ${HOME}
+		then x=1 local readonly 2>/dev/null -eu awk --verbose done /usr/bin cd 'quoted text'
+		test grep printf test x=1 local awk then "$1" readonly printf test 'quoted text'
+	local /usr/bin -eu awk grep test 2>/dev/null export
+	printf && "$@" --verbose echo ${HOME} readonly done readonly
+	"$@" /usr/bin --verbose grep grep echo 'quoted text'
+	local x=1 "$@" "$@" grep printf &&
+${HOME} awk "$1" ${HOME}
+	${HOME} 2>/dev/null 'quoted text' x=1 cd grep -eu $(pwd) awk | $(pwd)
+${HOME} "$@" printf then printf test echo "$@"
+	$(pwd) local test 2>/dev/null
+awk then sed grep $(pwd) awk && && | local echo export sed done ${HOME} test |
+	/usr/bin done local sed sed | -eu ${HOME} "$1" printf x=1 --verbose "$@" -eu
+		${HOME} export x=1 "$@" done --verbose readonly sed
+then "$@" 2>/dev/null ${HOME} printf then && grep $(pwd) export local x=1 "$@"
+		"$1" sed x=1 local cd --verbose readonly
+		2>/dev/null /usr/bin 2>/dev/null -eu /usr/bin && cd "$1" x=1 /usr/bin
+	done then readonly /usr/bin grep test echo
+		local "$@" | local cd 'quoted text' grep "$@" "$1" echo echo "$@" grep && --verbose
+'quoted text' awk -eu $(pwd) && cd --verbose done --verbose
+	local "$1" done cd printf && /usr/bin x=1 done 'quoted text' test $(pwd) printf
+	--verbose "$1" printf 'quoted text' ${HOME} | "$@" /usr/bin
+		| -eu printf | "$1" done
+	'quoted text' && local then && echo sed -eu | "$1" && local
+echo ${HOME} readonly cd | "$@" export 'quoted text'
+		&& readonly "$1" "$1" | export printf done sed sed x=1 then readonly
+		&& x=1 done awk printf test "$1" $(pwd) /usr/bin "$1"
+	| local grep test awk /usr/bin
+"$@" grep | | -eu printf local 'quoted text' 2>/dev/null x=1 done sed 'quoted text'
+		test export printf "$1" 'quoted text'
+		${HOME} cd sed grep test ${HOME} $(pwd) --verbose --verbose
+	/usr/bin 2>/dev/null && --verbose /usr/bin echo sed "$1" /usr/bin grep
+		"$@" -eu "$1" /usr/bin "$1"
+done --verbose ${HOME} "$1" export
+export cd x=1 'quoted text' 'quoted text'
+| readonly test $(pwd) 2>/dev/null
+	grep printf local printf local /usr/bin cd sed ${HOME} | sed test done done
+	x=1 readonly -eu export test 2>/dev/null echo grep export local then
+then export local -eu then grep
+	&& local 2>/dev/null cd
+| readonly "$1" -eu echo
+-eu done ${HOME} 2>/dev/null x=1 "$1" grep then sed $(pwd) awk sed
+cd echo echo test readonly | --verbose readonly
+		grep export grep sed "$@" grep $(pwd) ${HOME} awk printf --verbose | export $(pwd)
+	"$1" $(pwd) /usr/bin done && then "$1" -eu 'quoted text'
+	grep grep export export | echo local | -eu test 2>/dev/null "$@" "$1" local
+2>/dev/null 2>/dev/null && | test
+&& "$@" $(pwd) sed -eu sed "$1"
+-eu $(pwd) --verbose "$@" "$@" "$@" done awk x=1 then $(pwd) printf
+	test x=1 x=1 awk /usr/bin
+2>/dev/null echo | $(pwd) grep done sed
+	printf export 'quoted text' -eu echo | cd echo 'quoted text'
+"$@" && --verbose done $(pwd) "$@" awk -eu printf readonly export awk
+		/usr/bin x=1 sed grep /usr/bin done
+-eu awk 2>/dev/null 2>/dev/null
+	sed grep test cd awk ${HOME} -eu done grep then $(pwd) test 2>/dev/null
+	--verbose echo "$@" done sed "$@" grep echo printf local export
+	2>/dev/null $(pwd) x=1 --verbose ${HOME} test /usr/bin readonly
+| $(pwd) sed grep awk done
+readonly readonly test grep 2>/dev/null
+| echo local x=1 export 'quoted text' cd done
+grep && export printf printf printf
+		local done printf --verbose $(pwd) --verbose "$@" | --verbose printf $(pwd)
+| "$1" printf "$@" sed
+		grep "$@" local 'quoted text' echo --verbose
+	| --verbose -eu sed echo awk | x=1 done ${HOME} "$@" x=1 x=1 && $(pwd)
+	local /usr/bin export && "$@" |
+		awk cd ${HOME} $(pwd) sed sed 2>/dev/null | then export printf /usr/bin &&
+	/usr/bin x=1 -eu done -eu grep $(pwd) cd sed x=1 sed && local readonly done
+	awk "$1" printf printf /usr/bin done echo && && "$1" done && grep /usr/bin
+		then --verbose printf readonly then readonly "$@" /usr/bin
+	awk sed $(pwd) && then | done --verbose readonly
+sed test x=1 --verbose done test
+cd | "$@" sed grep -eu echo test export printf
+		test local /usr/bin readonly sed ${HOME} --verbose /usr/bin local
+	&& local sed && 'quoted text' 'quoted text' readonly /usr/bin "$@"
+		export "$@" export then sed $(pwd) $(pwd) readonly | -eu then export "$1"
+		awk "$@" ${HOME} done x=1 test then |
+	cd export sed 'quoted text' export ${HOME} sed grep 'quoted text'
+&& export | awk sed |
+	"$1" export 2>/dev/null readonly "$1" echo
+	sed 2>/dev/null -eu "$1" -eu x=1 ${HOME} awk
+	'quoted text' printf 2>/dev/null test
+		'quoted text' echo then cd
+cd echo then done | then
+		$(pwd) done test /usr/bin --verbose 'quoted text'
+		-eu --verbose 2>/dev/null "$1" readonly
+2>/dev/null -eu "$1" /usr/bin "$@"
+2>/dev/null awk printf ${HOME} local cd cd test
+-eu done grep printf sed cd cd "$1" then cd ${HOME} done
+		'quoted text' test 2>/dev/null echo awk --verbose "$@" local readonly "$@" &&
+${HOME} /usr/bin sed grep done | x=1 cd then then cd
+test sed test readonly then /usr/bin
+sed $(pwd) printf | x=1
+	$(pwd) then done "$1" cd echo "$@" sed -eu grep echo sed --verbose 'quoted text'
+echo local awk test readonly cd /usr/bin "$1" ${HOME} /usr/bin
+&& awk readonly 'quoted text'
+		local 2>/dev/null test awk "$1"
+		local | grep printf grep && "$@" x=1 test local | cd && cd
+&& $(pwd) "$@" grep test awk readonly
+		| cd -eu 2>/dev/null && --verbose echo ${HOME} /usr/bin -eu --verbose
+		local | x=1 cd echo readonly 'quoted text' 'quoted text' --verbose
+		printf local --verbose ${HOME} export ${HOME}
+	$(pwd) awk -eu ${HOME} echo --verbose awk "$@" x=1 test ${HOME}
+		then | readonly | cd | printf $(pwd)
+2>/dev/null printf 2>/dev/null x=1 then done readonly sed printf "$@" $(pwd)
+	export done local cd && sed echo printf && -eu awk && export -eu
+		"$1" 2>/dev/null x=1 --verbose awk "$@" cd local 'quoted text' echo then
+	&& 'quoted text' ${HOME} -eu readonly done test printf 2>/dev/null
+		printf cd "$@" echo grep "$1" && |
+readonly --verbose grep 2>/dev/null
+done sed $(pwd) local -eu --verbose "$1" $(pwd) then local awk
+grep test 2>/dev/null awk export export test ${HOME} --verbose "$@"
+	readonly test && ${HOME} -eu awk grep local "$1" local export local ${HOME}
+"$@" "$@" /usr/bin echo grep $(pwd) x=1 test printf --verbose sed export
+		"$@" grep -eu /usr/bin done grep "$1" sed export done 2>/dev/null then
+export echo /usr/bin grep |
+	readonly done grep ${HOME} cd
+		echo x=1 printf /usr/bin cd ${HOME}
+	done $(pwd) -eu /usr/bin 2>/dev/null grep -eu "$1" --verbose echo sed $(pwd)
+		${HOME} awk test -eu local echo ${HOME} ${HOME} readonly
+${HOME} export grep 2>/dev/null /usr/bin -eu export cd awk
+test export sed done sed awk done sed 'quoted text'
+		local 'quoted text' then readonly readonly
+	export sed --verbose x=1 printf awk local local readonly awk
+		&& "$@" --verbose awk sed &&
+	readonly "$@" then $(pwd)
+		sed --verbose 2>/dev/null sed
+		"$1" printf 2>/dev/null 'quoted text' /usr/bin
+		cd /usr/bin sed -eu /usr/bin then echo echo
+		/usr/bin x=1 echo -eu echo ${HOME} 'quoted text' 2>/dev/null
+	echo sed test $(pwd) /usr/bin $(pwd) "$@" 2>/dev/null ${HOME}
+grep cd 2>/dev/null cd then export then ${HOME} /usr/bin 'quoted text'
+	grep $(pwd) | | -eu printf /usr/bin x=1 | --verbose
+		${HOME} ${HOME} -eu -eu
+/usr/bin "$1" && -eu 2>/dev/null done "$@" ${HOME} "$@" --verbose readonly local
+	| /usr/bin && 'quoted text' printf done sed x=1 then test done "$1"
+sed "$@" test /usr/bin then && 'quoted text' local cd --verbose
+x=1 /usr/bin && 'quoted text' echo
+	/usr/bin && printf readonly -eu done test sed test cd then "$@"
+		-eu echo cd -eu export local
+		'quoted text' then grep export 2>/dev/null grep done && 2>/dev/null
+	awk export awk then | grep 2>/dev/null "$1" then printf awk 2>/dev/null local |
+'quoted text' "$1" echo awk 2>/dev/null && -eu done | sed readonly local readonly
+| sed "$1" -eu 2>/dev/null -eu test readonly done ${HOME} x=1 'quoted text' then
+printf x=1 then awk sed test ${HOME}
+grep test 2>/dev/null grep
+		x=1 export "$@" 'quoted text'
+done | done 2>/dev/null printf sed 2>/dev/null x=1 2>/dev/null
+	--verbose ${HOME} | --verbose then local awk awk
+	done grep --verbose readonly $(pwd) local local | x=1 $(pwd) readonly
+grep sed grep sed x=1 | export then "$1" "$@" done "$1"
+		cd grep /usr/bin 2>/dev/null
+	"$@" ${HOME} "$@" | done awk printf grep
+readonly echo --verbose export
+echo export echo printf export local export "$@"
+&& grep 'quoted text' cd $(pwd) sed export awk sed
+| "$@" 2>/dev/null | x=1 sed done local echo -eu echo test x=1 then
+		done readonly readonly /usr/bin --verbose
+	done sed done /usr/bin then $(pwd) echo echo printf
+		then readonly cd "$@" export ${HOME} $(pwd) grep done "$@" done local sed $(pwd)
+	"$@" 'quoted text' test
+	then cd then readonly then "$@" done 2>/dev/null
+	"$1" awk readonly done
+		&& "$@" sed awk export "$@" printf printf
+	${HOME} "$@" cd -eu "$1" grep printf cd "$@" awk /usr/bin readonly
+	readonly printf done echo x=1 awk sed grep ${HOME} $(pwd)
+cd done 2>/dev/null $(pwd)
+done "$@" test printf
+		cd grep printf awk local ${HOME} | $(pwd) 'quoted text' && "$@" awk
+done $(pwd) "$1" 'quoted text' cd printf
+	echo 'quoted text' -eu echo sed export
+printf x=1 done cd /usr/bin awk
+2>/dev/null | --verbose test awk grep | echo
+	x=1 printf $(pwd) | && readonly export | test
+		then $(pwd) 2>/dev/null echo | grep -eu awk ${HOME}
+-eu | sed done sed 'quoted text' printf "$1" && readonly printf
+--verbose awk | export readonly
+		echo 'quoted text' test | then grep
+		then then $(pwd) then grep sed /usr/bin readonly $(pwd) readonly done echo
+		${HOME} x=1 --verbose local "$1" awk
+		awk ${HOME} | grep sed && then
+awk 'quoted text' export /usr/bin echo "$@" then
+export local awk done 2>/dev/null
+	"$@" "$1" $(pwd) grep sed | && grep -eu awk printf x=1 ${HOME} printf
+"$@" | 'quoted text' $(pwd) printf ${HOME}
+--verbose printf cd export cd local grep echo then -eu $(pwd)
+		echo 'quoted text' grep printf readonly local --verbose local cd then sed
+	printf local local done awk 2>/dev/null printf $(pwd) printf ${HOME}
+x=1 local cd ${HOME} sed x=1 | -eu sed sed test --verbose grep /usr/bin
+		${HOME} test echo $(pwd)
+		2>/dev/null awk x=1 test readonly ${HOME} printf ${HOME} ${HOME}
+		'quoted text' test | printf $(pwd) export readonly readonly
+sed printf echo 2>/dev/null cd test export && done awk | test
+	$(pwd) 'quoted text' 'quoted text' 2>/dev/null sed echo 'quoted text'
+		grep done 2>/dev/null --verbose done
+	2>/dev/null 2>/dev/null awk 2>/dev/null cd $(pwd)
+	--verbose then | test test 'quoted text' cd ${HOME} /usr/bin && | /usr/bin
+export | test -eu printf
+		"$@" cd grep readonly local test "$1" && "$@" then 2>/dev/null
+then done $(pwd) | 2>/dev/null echo test --verbose x=1 "$1"
+	${HOME} test "$1" test
+	--verbose | x=1 done printf 'quoted text' x=1
+		cd && printf printf "$@"
+	x=1 "$1" awk ${HOME} ${HOME} 'quoted text' printf
+		$(pwd) /usr/bin x=1 done done done | readonly $(pwd) 'quoted text' | readonly
+		export -eu ${HOME} test -eu then test | grep grep
+local 'quoted text' && readonly
+readonly export done |
+	export "$@" readonly "$1" readonly "$@" cd then done
+	test echo "$@" --verbose readonly echo grep "$1"
+x=1 ${HOME} awk done local $(pwd)
+		-eu then sed test x=1 2>/dev/null cd && awk grep done ${HOME}
+	x=1 ${HOME} 'quoted text' 2>/dev/null "$1" | --verbose
+"$1" printf sed done "$1" echo "$1" export ${HOME} local
+	--verbose "$1" cd ${HOME} done && 2>/dev/null local
+/usr/bin 2>/dev/null sed
+		readonly cd | awk awk x=1
+		export -eu && printf readonly awk --verbose "$1" awk ${HOME} echo --verbose
+'quoted text' test $(pwd) sed "$1"
+$(pwd) 2>/dev/null awk done && cd |
+	then then 2>/dev/null --verbose grep /usr/bin
+		printf sed | printf | readonly
+sed && readonly && -eu 'quoted text'
+x=1 sed awk -eu then --verbose awk readonly sed 2>/dev/null && grep
+	&& local && readonly -eu $(pwd) done local -eu cd awk 2>/dev/null
+	x=1 cd /usr/bin cd && | ${HOME} printf x=1 --verbose readonly grep /usr/bin
+	'quoted text' 'quoted text' echo readonly
+	test readonly "$@" --verbose 'quoted text' && $(pwd) grep sed /usr/bin
+	2>/dev/null | export sed 2>/dev/null
+	done ${HOME} done done done "$1" && sed local x=1 then local local done ${HOME}
+--verbose | "$1" "$@" done x=1 | && then -eu local test
+	x=1 readonly /usr/bin awk /usr/bin
+| sed x=1 /usr/bin local | ${HOME} done x=1 x=1 && "$1" cd cd readonly local 'quoted text'
+2>/dev/null then /usr/bin awk done then printf echo cd
+		export "$1" echo --verbose export export then 2>/dev/null ${HOME} &&
+		-eu && x=1 -eu sed test cd cd done --verbose printf printf "$@" &&
+	2>/dev/null 2>/dev/null sed --verbose 'quoted text' cd export
+		export done export readonly awk
+	export test printf sed $(pwd) readonly printf export $(pwd) | grep cd && /usr/bin
+	awk export -eu ${HOME} x=1 -eu test ${HOME} "$@" "$1" sed -eu 2>/dev/null test awk
+"$@" /usr/bin 2>/dev/null
+test /usr/bin 2>/dev/null sed "$@" done cd 'quoted text' cd echo && "$@"
+	$(pwd) sed x=1 -eu $(pwd) "$1" --verbose "$1" -eu printf -eu 2>/dev/null readonly
+		readonly then echo local
+printf test cd /usr/bin ${HOME} done x=1 test readonly printf
+		-eu 'quoted text' readonly && | then done 2>/dev/null
+		cd test echo printf 'quoted text' sed "$@" $(pwd) readonly awk test done "$@"
+$(pwd) test awk done $(pwd) && export 2>/dev/null readonly cd
+		awk readonly /usr/bin printf -eu ${HOME} then -eu 2>/dev/null
+awk "$@" x=1 --verbose | echo -eu x=1 --verbose $(pwd) cd sed awk
+	test grep /usr/bin ${HOME} -eu | /usr/bin grep export
+sed readonly test cd then local test cd
+		${HOME} grep local then
+export test done grep --verbose -eu "$@" "$1" "$1" ${HOME} cd then ${HOME}
+		/usr/bin "$@" cd 'quoted text' |
+2>/dev/null -eu ${HOME} readonly echo done awk cd && readonly
+		echo ${HOME} echo -eu done && 'quoted text' then test
+		-eu echo ${HOME} "$1" 'quoted text' ${HOME} |
+		export | "$1" awk printf /usr/bin cd echo $(pwd) ${HOME} done
+	sed export x=1 printf awk then then grep grep echo
+		grep 2>/dev/null readonly --verbose cd cd test 'quoted text'
+	x=1 sed printf -eu "$1" && $(pwd)
+		2>/dev/null test "$1" && printf /usr/bin sed
+	--verbose echo then done
+		/usr/bin && then printf printf "$1" readonly readonly --verbose grep
+		local sed awk $(pwd) test local sed /usr/bin 2>/dev/null
+		'quoted text' sed | cd
+	printf sed then echo | done && /usr/bin "$@" done
+	"$1" local --verbose "$1" $(pwd) readonly ${HOME} 'quoted text' export then
+		-eu sed echo && && then 2>/dev/null
+		&& done 2>/dev/null 'quoted text'
+	export /usr/bin -eu "$1" 2>/dev/null 'quoted text' ${HOME}
+		"$@" "$1" test done local echo sed 2>/dev/null
+&& then test export export test readonly
+	done export --verbose then awk $(pwd) | local -eu cd echo
+		printf | "$@" cd printf "$@" cd "$@" 'quoted text' sed test "$1"
+--verbose readonly echo test
+	then printf then then $(pwd) ${HOME} done 2>/dev/null |
+	sed local ${HOME} sed then "$1" grep grep test export "$@" 'quoted text' "$1"
+$(pwd) done --verbose && sed cd local test local $(pwd) echo | awk 2>/dev/null
+$(pwd) 'quoted text' "$@" x=1 2>/dev/null
+	then done cd grep x=1 done echo export export then 2>/dev/null
+		| | 2>/dev/null readonly
+	"$1" sed done --verbose ${HOME} && 2>/dev/null test cd readonly export /usr/bin
+		then readonly grep "$@" sed local --verbose
+readonly "$@" test printf
+		grep export x=1 local 2>/dev/null echo local --verbose $(pwd) printf 'quoted text'
+	readonly 2>/dev/null done test
+		done then export export test -eu local done echo
+	grep printf cd cd then 'quoted text' x=1 x=1 then export
+--verbose && 'quoted text' --verbose sed "$@"
+	readonly test --verbose test 'quoted text'
+awk local printf -eu test -eu -eu "$1" grep then
+echo done echo then | test printf /usr/bin 2>/dev/null awk --verbose echo 'quoted text'
+	$(pwd) awk "$1" 2>/dev/null test awk echo ${HOME} -eu -eu readonly && sed 'quoted text'
+	printf && echo && export local local --verbose $(pwd) 'quoted text'
+export sed done then /usr/bin
+"$1" && ${HOME} --verbose awk echo "$@" then
+		$(pwd) && x=1 x=1 test awk then $(pwd) echo printf readonly "$@" --verbose test
+grep 'quoted text' local /usr/bin "$1" 'quoted text'
+	${HOME} 'quoted text' awk cd readonly | export then | ${HOME}
+	-eu done grep /usr/bin /usr/bin grep printf
+	grep x=1 test awk echo printf | local x=1 ${HOME} /usr/bin
+printf && then | -eu local done "$@"
+		awk export 2>/dev/null printf -eu -eu awk local test "$1"
+	local && export ${HOME}
+	cd 2>/dev/null done /usr/bin test cd sed ${HOME} 'quoted text'
+		done test -eu 2>/dev/null 2>/dev/null
+		cd "$1" /usr/bin then echo 'quoted text' done done
+local export cd /usr/bin then -eu ${HOME} ${HOME} "$1" /usr/bin test
+	cd printf awk done x=1 ${HOME} sed echo printf readonly cd echo -eu done
+	echo ${HOME} 2>/dev/null awk awk readonly ${HOME} && cd readonly readonly sed x=1
+		--verbose "$1" | sed 'quoted text'
+	sed awk test /usr/bin test $(pwd) "$1" echo --verbose local
+		echo local echo echo local then "$1" awk
+		done printf 2>/dev/null grep $(pwd) printf "$@"
+		2>/dev/null 2>/dev/null ${HOME} x=1 /usr/bin
+		x=1 "$1" "$1" $(pwd) && ${HOME} x=1 -eu grep /usr/bin 'quoted text' 2>/dev/null
+	"$@" /usr/bin printf 2>/dev/null
+	export grep done test | /usr/bin
+	export grep $(pwd) -eu awk /usr/bin x=1 echo /usr/bin
+	${HOME} local local -eu test local
+		&& grep ${HOME} 'quoted text'
+		--verbose -eu && x=1 "$@" --verbose 2>/dev/null printf "$1" cd printf
+	done echo cd grep && $(pwd) then --verbose awk printf && echo
+		"$1" $(pwd) /usr/bin "$@" $(pwd) cd /usr/bin cd $(pwd) 'quoted text' then export
+/usr/bin awk 'quoted text' x=1 ${HOME} awk
+	| 2>/dev/null cd local 2>/dev/null | "$@" grep 'quoted text' done | /usr/bin
+		| cd local done done echo -eu local 'quoted text' "$@"
+	local "$@" "$@" -eu echo readonly
+grep test test --verbose $(pwd)
+	echo ${HOME} --verbose local
+		then ${HOME} | && grep $(pwd) x=1 2>/dev/null "$@" && --verbose ${HOME} then
+readonly export grep cd cd grep x=1 grep --verbose /usr/bin local echo
+-eu test done done test grep -eu printf
+		test "$1" awk test grep printf ${HOME}
+	then --verbose readonly $(pwd) echo ${HOME} grep "$@" awk printf then
+${HOME} "$1" awk "$@" x=1 'quoted text'
+	2>/dev/null ${HOME} "$@" ${HOME} 'quoted text' --verbose ${HOME} -eu | ${HOME}
+cd ${HOME} echo grep then && grep cd cd --verbose local 'quoted text' echo done
+readonly -eu 2>/dev/null x=1 local x=1 cd test readonly ${HOME}
+	grep echo grep grep 2>/dev/null $(pwd) sed grep 2>/dev/null then 2>/dev/null $(pwd)
+$(pwd) 2>/dev/null ${HOME} printf
+	test | cd awk 2>/dev/null
+		| -eu --verbose $(pwd) echo echo "$@" ${HOME}
+"$@" test "$@" -eu ${HOME} sed && --verbose done -eu sed
+		"$1" | done printf awk grep $(pwd) "$1" x=1 awk awk | readonly export
+	&& cd printf sed test grep grep then sed "$1" readonly export $(pwd) echo 2>/dev/null
+--verbose test $(pwd) cd | test awk "$@" export cd 2>/dev/null -eu "$@" cd --verbose
+	sed --verbose test export "$1" printf local sed | 2>/dev/null 'quoted text'
+	done then local printf 2>/dev/null 'quoted text'
+	then x=1 readonly export x=1 sed export
+echo 'quoted text' /usr/bin echo
+#include c57.sh
+grep /usr/bin --verbose 2>/dev/null 2>/dev/null
+readonly 2>/dev/null --verbose --verbose local export then grep printf 2>/dev/null
+echo && grep then --verbose
+sed printf x=1 readonly /usr/bin awk export $(pwd)
+		"$1" 2>/dev/null -eu x=1 echo
+	x=1 'quoted text' -eu readonly 2>/dev/null | 2>/dev/null printf
+	| ${HOME} x=1 2>/dev/null
+	| ${HOME} grep "$1" $(pwd) /usr/bin x=1 export
+	${HOME} test --verbose sed done 'quoted text' echo
+		-eu 'quoted text' cd echo /usr/bin
+local readonly test && 'quoted text'
+		2>/dev/null cd "$@" 'quoted text' 2>/dev/null && 2>/dev/null
+	| && sed grep "$@" cd sed then then echo readonly "$1" "$@" export 'quoted text'
+grep /usr/bin echo cd
+		"$1" done -eu cd "$@" $(pwd) done local then /usr/bin cd "$1" x=1 -eu echo grep
+--verbose then 2>/dev/null
+	x=1 local export awk readonly -eu -eu test --verbose local /usr/bin 2>/dev/null
+	grep ${HOME} "$1" done 'quoted text' then export /usr/bin
+	then "$1" awk && awk local
+echo test "$1" 'quoted text' printf --verbose $(pwd) readonly -eu
+	then awk "$1" grep readonly done | "$1" "$1" sed "$1" cd | printf
+	"$1" "$1" --verbose x=1 | grep $(pwd) ${HOME} && echo test then then --verbose export
+"$1" 'quoted text' then 'quoted text' done && cd export awk echo
+	sed | $(pwd) "$@" /usr/bin printf && done |
+	test -eu grep then grep 2>/dev/null awk done echo then printf
+		readonly x=1 printf 2>/dev/null && 2>/dev/null grep | echo $(pwd) export done
+	"$1" readonly $(pwd) sed sed
+printf | 'quoted text' /usr/bin
+-eu | awk echo 'quoted text' | x=1 grep
+	echo cd && sed | && x=1 'quoted text' export
+		readonly then | ${HOME} readonly /usr/bin 2>/dev/null x=1 printf echo &&
+	printf ${HOME} /usr/bin awk && done
+		2>/dev/null -eu 2>/dev/null
+		then "$@" then x=1 'quoted text' then "$@" x=1 readonly /usr/bin && then
+		$(pwd) 2>/dev/null --verbose ${HOME} --verbose 'quoted text'
+/usr/bin -eu --verbose awk $(pwd)
+	export 'quoted text' sed ${HOME} "$1" --verbose $(pwd) -eu && ${HOME} | awk printf
+--verbose --verbose done --verbose && /usr/bin echo
+		awk echo | && printf readonly
+	export cd export awk echo /usr/bin -eu ${HOME} --verbose printf $(pwd)
+	'quoted text' | 2>/dev/null printf -eu local sed test
+sed sed $(pwd) | ${HOME}
+		-eu /usr/bin x=1 readonly 'quoted text' ${HOME}
+		printf test readonly && 'quoted text' sed awk "$1" echo $(pwd) -eu
+-eu /usr/bin echo local "$1"
+2>/dev/null /usr/bin echo &&
+	test 2>/dev/null export x=1 printf printf /usr/bin readonly x=1 sed
+	cd "$1" ${HOME} | && "$@" grep 2>/dev/null "$1" printf readonly
+	printf 2>/dev/null 2>/dev/null
+	-eu test $(pwd) && 'quoted text' && | x=1
+export echo grep export | cd /usr/bin
+	test 'quoted text' local echo | echo -eu awk "$@" sed sed export |
+"$1" export && echo $(pwd) then
+		--verbose cd ${HOME} then
+		"$1" "$1" done && x=1 --verbose cd -eu -eu grep test ${HOME} readonly 2>/dev/null
+		grep done awk readonly local sed local /usr/bin --verbose
+		done /usr/bin local grep test | "$1" && $(pwd) done /usr/bin
+	readonly cd /usr/bin 2>/dev/null && | test ${HOME}
+	${HOME} grep --verbose readonly --verbose "$@" $(pwd) cd
+-eu "$1" printf /usr/bin -eu
+local "$@" local x=1 ${HOME} test sed sed 'quoted text' cd "$1"
+"$@" "$@" 'quoted text' ${HOME} && test ${HOME} ${HOME} done
+		| awk && cd x=1 -eu --verbose printf local printf | sed awk awk sed $(pwd)
+sed --verbose /usr/bin cd 'quoted text' ${HOME} test
+'quoted text' x=1 cd 2>/dev/null done ${HOME} -eu -eu x=1 2>/dev/null
+x=1 sed "$@" && $(pwd) awk export cd then readonly test readonly cd done
+		grep grep --verbose 2>/dev/null --verbose $(pwd) readonly $(pwd) "$1"
+		"$1" --verbose "$1" x=1 readonly export cd grep test printf
+sed -eu --verbose $(pwd) ${HOME} printf -eu && 2>/dev/null | readonly export
+		awk ${HOME} 2>/dev/null done /usr/bin |
+then /usr/bin sed $(pwd)
+	grep | done cd "$1" export 2>/dev/null test awk -eu 2>/dev/null
+	"$1" "$1" | test readonly "$1" echo &&
+		x=1 test $(pwd) done cd cd ${HOME} readonly grep "$@" "$1" export "$@" | local
+/usr/bin then cd x=1 done 2>/dev/null "$1" local
+test echo 'quoted text' done done "$1" ${HOME} "$@" test "$1" then 2>/dev/null
+	x=1 -eu sed $(pwd) test cd && sed | 2>/dev/null
+	'quoted text' -eu sed 2>/dev/null grep test awk
+	'quoted text' done 'quoted text' "$@" sed grep "$@"
+		awk /usr/bin sed sed 'quoted text' -eu
+	x=1 readonly test awk -eu /usr/bin
+| 'quoted text' echo grep then /usr/bin "$1" printf export "$1" --verbose "$1"
+awk x=1 done done /usr/bin | then readonly "$@" printf echo test echo awk
+		--verbose ${HOME} --verbose sed printf "$@" cd --verbose --verbose
+done awk $(pwd) printf done test cd readonly
+test test done x=1 done done cd grep local echo done printf --verbose $(pwd)
+	sed 2>/dev/null grep 'quoted text' &&
+	$(pwd) done readonly 'quoted text' && 2>/dev/null /usr/bin
+		| "$@" x=1 sed echo test ${HOME} printf echo 2>/dev/null
+$(pwd) cd $(pwd) --verbose /usr/bin done export | $(pwd) $(pwd) done echo export
+		x=1 local sed test readonly
+	echo -eu test "$1" 'quoted text' --verbose echo readonly
+export done printf local sed cd cd "$@" readonly readonly
+'quoted text' sed grep
+| && test test grep | /usr/bin 'quoted text' 'quoted text' /usr/bin readonly
+		| readonly ${HOME} && readonly
+	printf readonly cd local local done 'quoted text'
+	/usr/bin "$@" sed "$1" awk -eu local && awk "$1" done grep export 2>/dev/null
+		test 'quoted text' awk $(pwd) "$@" export | ${HOME}
+		export -eu grep "$1" /usr/bin "$1" --verbose
+$(pwd) 'quoted text' /usr/bin local done export printf /usr/bin --verbose
+	grep printf export local /usr/bin
+	done readonly test export "$1" export readonly /usr/bin
+then ${HOME} sed "$1" local done /usr/bin /usr/bin
+	$(pwd) "$1" cd local local && "$1" "$@" then
+'quoted text' --verbose "$1" echo echo cd "$1" sed readonly
+x=1 ${HOME} readonly && test readonly 'quoted text' awk "$1"
+	then -eu printf export "$@" done
+printf then 'quoted text' sed 2>/dev/null done
+	2>/dev/null | "$1" && $(pwd)
+readonly "$@" 2>/dev/null export && 2>/dev/null x=1 'quoted text' 2>/dev/null
+	2>/dev/null local local "$@" 'quoted text' 2>/dev/null cd then
+readonly awk sed cd test test --verbose "$1" echo grep awk done -eu
+&& 2>/dev/null ${HOME} && 'quoted text' export | && sed
+grep 2>/dev/null "$@" grep
+		then "$1" | "$1" | x=1 x=1 $(pwd)
+'quoted text' echo echo $(pwd) sed grep 2>/dev/null /usr/bin $(pwd)
+2>/dev/null /usr/bin $(pwd) /usr/bin local local
+	export 'quoted text' 2>/dev/null --verbose /usr/bin x=1 | awk echo
+	${HOME} cd ${HOME} 2>/dev/null "$@" "$@"
+export echo local $(pwd) | test then readonly /usr/bin grep 2>/dev/null
+		"$1" /usr/bin x=1 --verbose sed "$@" done -eu $(pwd) awk
+		/usr/bin | awk echo 'quoted text' x=1 2>/dev/null readonly x=1
+/usr/bin cd $(pwd) sed cd then x=1 readonly test
+		x=1 --verbose then export printf export /usr/bin sed grep test cd "$1" "$@" readonly
+		-eu ${HOME} grep 2>/dev/null done
+		x=1 test printf grep --verbose
+--verbose | /usr/bin cd sed x=1 sed
+		--verbose test 'quoted text' awk sed /usr/bin local sed awk --verbose readonly
+local grep "$@" export awk -eu /usr/bin
+	cd "$@" "$@" && export -eu &&
+		grep -eu | done echo "$1" 2>/dev/null 2>/dev/null
+	echo cd sed && && | -eu "$@"
+	awk local $(pwd) cd "$@" -eu readonly "$@" awk done ${HOME}
+		"$1" "$@" $(pwd) then -eu | -eu grep &&
+		test readonly 'quoted text' printf awk printf "$@" cd "$1"
+	sed | printf 'quoted text' export && ${HOME} $(pwd) local cd 'quoted text'
+	x=1 printf readonly cd ${HOME} done printf x=1
+echo test /usr/bin ${HOME} x=1 --verbose /usr/bin grep "$@" 2>/dev/null
+local /usr/bin 2>/dev/null | cd test "$1" awk "$@" "$1" readonly awk awk
+		test then "$@" awk -eu --verbose then -eu export
+		| 'quoted text' sed local done --verbose awk cd
+'quoted text' echo -eu export --verbose
+		printf && 2>/dev/null /usr/bin cd export sed then awk awk 'quoted text'
+		"$@" /usr/bin grep -eu | echo awk cd /usr/bin grep 2>/dev/null
+	| | | awk cd then "$1" then ${HOME} sed cd done /usr/bin
+	-eu test local awk printf awk local then -eu echo | $(pwd)
+		&& /usr/bin awk test sed then
+"$@" readonly "$@" "$@" x=1 "$1" x=1 echo | && sed awk grep awk grep done grep
+	done cd done grep 2>/dev/null
+'quoted text' then grep 'quoted text' then /usr/bin printf
+		-eu "$@" --verbose awk ${HOME} done /usr/bin export
+/usr/bin | awk readonly then export 2>/dev/null test
+		awk --verbose "$1" grep | done "$@" echo "$1" "$1" grep -eu local
+echo x=1 x=1 cd "$1" 'quoted text' cd then "$@" then local
+		x=1 "$@" $(pwd) 2>/dev/null grep -eu readonly awk 'quoted text' printf sed cd --verbose
+printf awk done readonly test && "$@" printf cd 'quoted text' -eu export x=1 awk
+		export 2>/dev/null --verbose
+	${HOME} "$@" printf "$@" export x=1 done "$1" "$1" printf "$@" |
+awk /usr/bin ${HOME} then printf $(pwd) /usr/bin 'quoted text'
+	echo local | | printf export | 'quoted text' "$@" "$1" cd
+local sed local "$1" sed -eu test && $(pwd) "$1" echo 2>/dev/null
+		printf grep 2>/dev/null export | 'quoted text' cd | | echo
+	export awk export awk readonly 2>/dev/null done | --verbose done cd |
+		--verbose "$@" then --verbose | ${HOME} sed done /usr/bin --verbose awk
+awk --verbose x=1 export echo /usr/bin cd && then printf x=1 local
+readonly printf then | then --verbose
+	printf sed cd printf local 2>/dev/null export "$1"
+		local -eu ${HOME} 2>/dev/null
+| sed -eu x=1 "$1" echo 'quoted text' --verbose
+		"$@" cd --verbose "$@" cd | "$@" awk
+	${HOME} ${HOME} sed $(pwd) cd x=1 "$@" awk --verbose echo done then readonly
+-eu | 'quoted text' test export export readonly
+	printf grep readonly | 2>/dev/null
+	sed done then -eu x=1 --verbose | -eu --verbose grep
+x=1 'quoted text' sed grep grep x=1 && echo readonly
+&& --verbose local readonly 'quoted text' readonly && export
+	test echo "$@" -eu -eu && -eu done x=1 sed done cd readonly 'quoted text' done
+"$1" /usr/bin cd grep done
+export 'quoted text' local echo
+		echo awk -eu /usr/bin "$@" ${HOME} /usr/bin local 2>/dev/null "$@"
+$(pwd) | awk /usr/bin readonly --verbose -eu | 'quoted text' local awk
+		&& | | | printf cd x=1 'quoted text' 2>/dev/null 'quoted text' $(pwd)
+	then -eu "$1" | "$1" test then ${HOME} printf then sed | sed cd "$@" test awk grep
+local && --verbose echo cd sed --verbose grep
+		test test 2>/dev/null ${HOME} "$@" "$1" | awk cd "$@"
+	export x=1 2>/dev/null $(pwd) -eu local "$1" --verbose
+2>/dev/null cd sed -eu --verbose ${HOME} $(pwd) && $(pwd)
+		"$@" grep test done "$1" local readonly then "$1" /usr/bin --verbose
+		cd x=1 ${HOME} "$@" | cd --verbose /usr/bin readonly "$@"
+		test test cd x=1 "$@" local export | $(pwd) "$@" local
+"$1" 'quoted text' "$@" -eu && ${HOME} x=1 then echo
+		readonly 'quoted text' grep awk then --verbose
+	-eu export x=1 export done | x=1 "$@" printf /usr/bin "$1" cd export
+export | echo sed 'quoted text' -eu x=1 $(pwd) | | "$@" ${HOME} echo $(pwd)
+	${HOME} sed ${HOME} && export
+grep readonly sed readonly done $(pwd) test | /usr/bin
+		cd 2>/dev/null ${HOME} done local test "$1" ${HOME} | cd cd
+	--verbose export then $(pwd)
+$(pwd) test $(pwd) grep printf cd export
+-eu cd sed local done -eu test printf export 'quoted text'
+		test echo ${HOME} "$@" | && awk | && "$@" awk "$@"
+then readonly test then /usr/bin --verbose awk readonly export ${HOME} --verbose
+x=1 readonly cd grep $(pwd) 'quoted text' grep /usr/bin
+	echo readonly 2>/dev/null readonly then echo /usr/bin -eu "$1" &&
+grep /usr/bin 2>/dev/null local | grep
+	--verbose cd && then --verbose
+		--verbose 'quoted text' | "$@" | $(pwd) readonly grep export
+	"$@" x=1 awk local x=1 then 'quoted text' --verbose
+	local sed awk "$1" done /usr/bin then 2>/dev/null x=1
+awk then ${HOME} 'quoted text'
+		'quoted text' printf x=1 --verbose
+		local echo "$1" awk 'quoted text' "$1" | export $(pwd) --verbose cd then readonly
+	| /usr/bin /usr/bin && printf grep -eu
+"$@" ${HOME} echo awk readonly printf printf | ${HOME} test |
+		echo "$@" echo x=1 --verbose "$1" export sed echo export test done
+sed grep readonly cd $(pwd) export "$1"
+readonly /usr/bin readonly then
+		--verbose awk awk sed cd -eu "$1" -eu x=1 then x=1 $(pwd) test awk cd
+		-eu -eu done local export $(pwd) local printf
+| 2>/dev/null "$1" printf echo test export done | x=1 cd done sed
+	echo awk 2>/dev/null 'quoted text' readonly 'quoted text' local
+	${HOME} echo readonly done "$@" export x=1
+		$(pwd) cd | | done local export ${HOME} grep -eu
+then | && printf ${HOME} awk 2>/dev/null 2>/dev/null ${HOME} sed grep 2>/dev/null
+x=1 awk test grep test grep test "$@" /usr/bin --verbose -eu "$1" readonly
+		local echo echo grep done test cd
+then "$@" then "$@" | readonly
+	then ${HOME} sed awk "$1" done /usr/bin
+		"$1" x=1 ${HOME} "$1" --verbose ${HOME} /usr/bin readonly
+		&& export done test "$1" 2>/dev/null then | "$1" readonly
+		x=1 echo grep cd cd --verbose --verbose $(pwd) "$1"
+	--verbose then $(pwd) 2>/dev/null "$@" cd grep /usr/bin
+x=1 && local readonly awk 'quoted text' | x=1 --verbose
+	&& "$@" x=1 "$@" sed readonly -eu 2>/dev/null sed done
+	x=1 test 'quoted text' "$1" echo -eu local "$1" sed cd grep $(pwd) --verbose
+		"$@" 2>/dev/null | echo test awk awk "$@" /usr/bin
+	grep "$1" 2>/dev/null local cd "$1" done readonly done printf 'quoted text'
+2>/dev/null then sed $(pwd) printf -eu 'quoted text' echo $(pwd) | $(pwd)
+		grep --verbose sed "$1" /usr/bin grep export /usr/bin readonly ${HOME}
+		awk cd 'quoted text' 'quoted text' cd -eu awk
+then ${HOME} --verbose && -eu echo test
+echo "$@" --verbose x=1 $(pwd) printf 2>/dev/null $(pwd) then | awk printf && 2>/dev/null
+| printf sed local done then "$1" local
+		readonly sed local "$1" /usr/bin export ${HOME} && grep sed sed | "$1" awk
+		'quoted text' && /usr/bin ${HOME} ${HOME} 2>/dev/null
+	sed export /usr/bin | sed -eu echo done
+		local then --verbose ${HOME} cd printf cd ${HOME} $(pwd)
+		'quoted text' grep 'quoted text' test $(pwd) export sed readonly local ${HOME}
+/usr/bin then && cd grep done 2>/dev/null 2>/dev/null
+${HOME} /usr/bin $(pwd) "$1" x=1 then awk readonly
+-eu test grep readonly --verbose x=1 2>/dev/null "$@" awk
+	readonly sed ${HOME} "$@"
+	"$1" -eu $(pwd) export cd
+/usr/bin | 2>/dev/null /usr/bin -eu done readonly && export --verbose
+	| local export "$@" "$1" x=1 --verbose echo ${HOME} awk grep "$@" test readonly
+		echo -eu --verbose 2>/dev/null done
+		export "$@" 'quoted text' printf -eu local sed
+echo 'quoted text' readonly
+		echo x=1 -eu sed "$1" sed -eu readonly
+grep ${HOME} 2>/dev/null "$1" grep done done
+readonly export "$@" -eu 2>/dev/null --verbose
+x=1 x=1 -eu local export
+	then sed "$@" done 'quoted text' cd readonly "$1" cd test readonly
+		${HOME} && | 'quoted text' 2>/dev/null grep printf x=1 done "$@"
+sed grep test printf 2>/dev/null cd /usr/bin "$@" x=1 local /usr/bin printf
+${HOME} local sed "$@" grep local && -eu test ${HOME} "$1" then &&
+export then "$@" $(pwd) grep --verbose 'quoted text'
+x=1 local local cd | then 'quoted text' /usr/bin sed readonly sed
+then readonly then cd cd -eu "$1" grep -eu $(pwd) --verbose sed
+	export && "$@" awk done local grep "$@"
+grep then grep readonly then -eu 2>/dev/null
+	${HOME} then sed x=1 grep
+	&& x=1 grep ${HOME} export sed awk cd sed
+		${HOME} -eu 'quoted text' printf
+$(pwd) echo "$@" | export awk "$1" done export "$1" 'quoted text' export "$1"
+	/usr/bin "$@" /usr/bin test test x=1 /usr/bin
+&& 'quoted text' awk sed $(pwd) "$1" 'quoted text'
+	echo /usr/bin "$1" local readonly -eu grep ${HOME}
+		printf | | -eu readonly && 'quoted text' done printf cd -eu && /usr/bin
+	echo sed sed printf cd local test grep "$1" 2>/dev/null $(pwd) then test readonly
+		done then export $(pwd) then x=1 printf then then echo 'quoted text'
+/usr/bin && ${HOME} 'quoted text' printf $(pwd) export then export x=1
+		x=1 printf echo | printf -eu 'quoted text' cd /usr/bin && ${HOME}
+	printf 2>/dev/null 'quoted text'
+		$(pwd) 'quoted text' --verbose then local /usr/bin
+	awk readonly export 'quoted text' awk --verbose
+	x=1 local "$1" echo -eu awk 'quoted text' && grep local then done "$1" -eu
+		'quoted text' "$@" && export /usr/bin then cd printf
+	"$@" --verbose awk export grep cd $(pwd) x=1 sed -eu $(pwd) printf && export
+	cd --verbose | | then printf -eu | "$@" grep 'quoted text' "$@" "$@" $(pwd) printf
+		2>/dev/null local grep "$1" && local done && && "$1" $(pwd) local | test
+	grep cd export export 'quoted text' -eu "$1" --verbose && export -eu /usr/bin
+'quoted text' "$1" readonly printf printf printf -eu && awk done
+	export local x=1 x=1 then x=1 grep /usr/bin awk local $(pwd) local "$@" local
+$(pwd) "$@" 2>/dev/null cd -eu export
+	&& /usr/bin echo && -eu local "$@"
+		local grep 2>/dev/null echo "$1" test /usr/bin "$1" printf
+	$(pwd) 2>/dev/null $(pwd) --verbose grep ${HOME} readonly grep echo
+	sed /usr/bin | readonly echo --verbose test readonly && done then test --verbose
+		readonly 'quoted text' -eu export $(pwd) "$1"
+		x=1 -eu ${HOME} printf local "$1" "$1" "$@" /usr/bin
+	echo test | ${HOME} x=1 sed sed grep echo x=1 cd local
+$(pwd) $(pwd) echo ${HOME} test grep
+		| echo --verbose awk "$1" cd cd "$1" "$@" $(pwd) sed then test -eu cd /usr/bin
+		cd readonly export printf local then export echo cd "$@" printf then done
+		/usr/bin /usr/bin awk -eu && readonly sed local --verbose cd printf
+		echo ${HOME} "$1" done then --verbose then --verbose | grep cd
+printf grep export ${HOME}
+awk grep awk done | printf sed && && "$1" --verbose --verbose test
+	local "$@" /usr/bin --verbose
+	--verbose echo printf -eu grep /usr/bin --verbose cd && && x=1
+		"$1" local -eu readonly readonly "$1" test test sed then "$1" x=1 echo printf
+	/usr/bin awk ${HOME} $(pwd) x=1 then grep done
+	x=1 printf done local | echo grep awk awk echo "$1" x=1 test
+sed --verbose 2>/dev/null 'quoted text'
+		x=1 test echo then | grep sed ${HOME} |
+"$1" "$1" "$1" done readonly -eu done export echo --verbose "$@" | 2>/dev/null
+export sed export --verbose && printf readonly export ${HOME} ${HOME}
+	sed ${HOME} "$1" export
+	'quoted text' --verbose
+		done grep -eu grep --verbose | test 'quoted text' /usr/bin
+		printf ${HOME} export --verbose -eu /usr/bin "$1" --verbose
+awk ${HOME} ${HOME} ${HOME} awk
+		"$@" printf 'quoted text' export then local readonly
+	then printf test done printf echo ${HOME}
+		"$@" 'quoted text' "$1" 'quoted text' 'quoted text' then 'quoted text'
+		| && echo echo grep done -eu grep 2>/dev/null
+grep test --verbose ${HOME} ${HOME} 2>/dev/null test cd --verbose readonly x=1
+	sed "$1" echo | printf --verbose export "$@"
+		echo x=1 $(pwd) "$1" /usr/bin 2>/dev/null -eu $(pwd) cd 'quoted text'
+	echo | printf sed printf ${HOME} grep printf
+	echo awk grep printf ${HOME} 2>/dev/null echo sed 2>/dev/null
+		| --verbose local local $(pwd) | -eu $(pwd)
+		readonly grep test cd --verbose
+	"$1" done awk 'quoted text' printf cd x=1 2>/dev/null test
+		export "$1" local 'quoted text' && -eu /usr/bin local done readonly --verbose
+--verbose test readonly then echo done --verbose -eu export "$1"
+"$@" && printf -eu cd 2>/dev/null test local "$1" | test && "$1" export && printf
+	"$1" awk 'quoted text' done x=1 awk -eu "$@"
+&& 2>/dev/null /usr/bin printf | && -eu
+		cd done 'quoted text' cd -eu local
+	grep local printf echo 2>/dev/null readonly awk -eu --verbose
+	'quoted text' readonly printf "$@" readonly readonly local | export then
+		awk ${HOME} test grep ${HOME} cd 'quoted text' $(pwd)
+x=1 'quoted text' "$@" readonly 'quoted text' grep /usr/bin then cd export grep
+	"$1" ${HOME} export done
+		"$1" grep $(pwd) $(pwd) then test "$1" 'quoted text' readonly echo grep
+| then grep "$1" cd grep -eu "$@" -eu -eu local x=1 &&
+"$1" "$1" awk "$1" then grep local test printf
+printf cd "$@" $(pwd) --verbose
+		${HOME} cd "$1" export test grep "$@" "$@" x=1 --verbose "$@" export
+		sed /usr/bin --verbose export --verbose done x=1 readonly
+	echo echo x=1 "$@" cd $(pwd) cd ${HOME} ${HOME} x=1 awk x=1
+		'quoted text' /usr/bin x=1 grep --verbose "$@" | x=1 $(pwd) --verbose
+	sed --verbose readonly cd && grep test cd awk x=1 test 'quoted text'
+	"$1" readonly printf echo export -eu "$1" export /usr/bin
+printf sed local local x=1 $(pwd) done -eu echo -eu readonly 2>/dev/null x=1
+	-eu then echo echo "$1" ${HOME} 'quoted text' done done grep done /usr/bin
+	x=1 awk echo echo $(pwd) "$1" 2>/dev/null --verbose printf
+	then "$@" && 'quoted text' test --verbose sed /usr/bin done printf |
+"$@" test cd printf 2>/dev/null echo -eu export
+		test 2>/dev/null 2>/dev/null grep "$1"
+		-eu $(pwd) readonly $(pwd) local awk readonly -eu $(pwd) | printf /usr/bin
+		/usr/bin readonly "$1" ${HOME} done readonly test awk --verbose sed test
+	test "$@" export 2>/dev/null local local then awk /usr/bin --verbose
+printf awk readonly | readonly x=1 test "$@" x=1 | &&
+	printf "$@" && test done | then $(pwd) x=1
+	test local $(pwd) awk && sed done
+		then /usr/bin $(pwd) /usr/bin
+cd then $(pwd) readonly then local done sed && /usr/bin
+	--verbose ${HOME} sed --verbose "$1" export /usr/bin ${HOME} cd | "$1" --verbose
+	grep printf "$1" test printf x=1 printf
+	$(pwd) printf sed $(pwd) 2>/dev/null
+	x=1 $(pwd) | local cd ${HOME} test cd export echo $(pwd) done
+	&& x=1 && then /usr/bin
+	--verbose sed then export grep x=1 export
+		readonly done export sed printf "$@" "$1" && -eu local done echo local --verbose
+	${HOME} 2>/dev/null && "$@" export export local printf
+		2>/dev/null && readonly && 'quoted text'
+awk local sed local done awk export sed "$1" ${HOME} test sed echo export
+	| 'quoted text' ${HOME} local | | export
+		awk "$@" x=1 awk "$1" && test && && done -eu export "$1" -eu echo local $(pwd)
+	cd sed local grep cd printf
+grep grep test printf export ${HOME} cd readonly
+-eu done --verbose ${HOME} printf 'quoted text'
+		--verbose local && -eu && "$1" grep "$1" "$1" -eu | printf then done &&
+	local done readonly && grep cd 2>/dev/null
+	2>/dev/null x=1 done test grep then
+		printf then "$1" $(pwd) && echo sed echo awk
+		sed && then done test 2>/dev/null sed done "$1"
+		echo ${HOME} grep | -eu
+	"$1" /usr/bin 2>/dev/null 'quoted text' grep x=1 2>/dev/null
+"$1" readonly done x=1 printf readonly export grep "$@" grep
+	&& "$1" printf echo grep grep --verbose awk then
+	echo test && done x=1 /usr/bin cd awk export
+--verbose "$1" "$1" done "$@"
+cd printf cd /usr/bin
+	awk 'quoted text' $(pwd) then "$@" --verbose export
+		${HOME} $(pwd) ${HOME}
+	then x=1 | ${HOME} done sed | 2>/dev/null 'quoted text' cd then test "$1" grep
+${HOME} readonly done 'quoted text' local x=1 readonly then "$1" 'quoted text'
+--verbose awk done --verbose
+		export "$1" local "$@" echo sed cd $(pwd) && "$@" then readonly "$@" then && --verbose
+		sed "$@" sed 'quoted text' readonly
+	--verbose printf printf done echo x=1 grep "$1"
+"$@" --verbose echo 2>/dev/null 'quoted text' then "$1" test local
+		echo "$1" echo 'quoted text' cd printf
+	sed $(pwd) -eu 2>/dev/null 'quoted text' ${HOME} x=1 ${HOME} | echo x=1 x=1 x=1
+		&& export export | ${HOME} echo awk x=1 echo
+	-eu | 2>/dev/null cd done local --verbose 'quoted text' $(pwd) --verbose $(pwd)
+		grep sed "$1" local "$@" ${HOME}
+	readonly cd done | "$1" done && 2>/dev/null "$1" awk done awk export "$@" readonly
+	done $(pwd) -eu $(pwd) "$1" done 2>/dev/null
+		export readonly awk grep export sed local awk ${HOME} && done awk
+	--verbose && cd local x=1 "$1" export done /usr/bin readonly then readonly
+		echo readonly printf /usr/bin done
+-eu "$1" echo /usr/bin 2>/dev/null
+		/usr/bin "$1" local /usr/bin "$1" ${HOME} awk
+	readonly done test sed
+--verbose readonly /usr/bin
+		cd $(pwd) cd echo then readonly
+&& local awk x=1 ${HOME} -eu done then then
+echo x=1 local && printf -eu then export $(pwd) $(pwd)
+	"$@" then done --verbose readonly done test
+	| then readonly ${HOME} cd test "$1" /usr/bin echo export | grep sed -eu | $(pwd)
+	sed "$1" "$@" 2>/dev/null echo cd done then cd done
+		| | test /usr/bin awk readonly awk done /usr/bin done test
+		--verbose x=1 -eu sed
+		then awk export && readonly ${HOME} /usr/bin && $(pwd) grep
+	awk $(pwd) test -eu $(pwd)
+		export grep -eu test -eu --verbose -eu sed | 'quoted text'
+	awk awk printf then awk export then printf test local export readonly
+awk printf "$1" "$1" test echo "$1" 2>/dev/null 'quoted text' ${HOME} readonly
+		grep export $(pwd) printf ${HOME} readonly | 'quoted text'
+		$(pwd) test readonly "$1" x=1 test /usr/bin x=1 echo grep 2>/dev/null --verbose
+	/usr/bin --verbose | cd then export echo 2>/dev/null awk readonly "$@"
+&& $(pwd) export test ${HOME} sed "$1" readonly --verbose
+		echo test "$@" | | $(pwd) cd $(pwd) 'quoted text'
+	/usr/bin | grep test then test -eu "$1" 'quoted text'
+${HOME} && export -eu 'quoted text' cd /usr/bin
+	"$1" local printf "$@" 2>/dev/null export awk echo export readonly
+	/usr/bin && grep export echo local "$@" export export "$1" printf &&
+		/usr/bin cd then awk "$1" /usr/bin ${HOME} | readonly --verbose
+		| awk x=1 awk "$1" | done 'quoted text' printf
+		x=1 echo done awk "$1" $(pwd) x=1
+$(pwd) 2>/dev/null 2>/dev/null && local export -eu ${HOME} readonly
+		done cd x=1 ${HOME} | test cd done "$1" x=1 local echo 2>/dev/null awk export
+${HOME} local test grep && /usr/bin
+		test awk cd $(pwd) && awk readonly /usr/bin grep -eu
+	readonly ${HOME} echo printf ${HOME} $(pwd) && "$@" test local ${HOME}
+$(pwd) done 2>/dev/null cd 2>/dev/null | /usr/bin x=1 local --verbose
+		echo export -eu | 2>/dev/null
+	x=1 "$1" printf export && x=1 && /usr/bin x=1
+	"$1" awk local && --verbose awk
+		x=1 local echo echo && echo test export echo $(pwd) grep x=1 test $(pwd)
+	grep export echo --verbose done awk cd sed cd done cd -eu readonly then sed x=1
+"$1" printf "$1" $(pwd) export test -eu
+	done printf 'quoted text' then $(pwd) test x=1 --verbose 2>/dev/null "$1" "$1"
+&& awk done printf $(pwd) && x=1 readonly 2>/dev/null
+		echo "$@" export awk test export then export cd "$1" 'quoted text'
+		done done ${HOME} echo cd awk awk echo sed echo readonly sed $(pwd) cd
+		/usr/bin /usr/bin done
+grep $(pwd) local grep "$1" done x=1 printf
+	${HOME} && $(pwd) readonly local
+		-eu readonly 'quoted text' x=1 --verbose -eu 'quoted text'
+		readonly sed cd 2>/dev/null awk 'quoted text' 'quoted text' printf
+	2>/dev/null "$1" x=1 printf && grep "$1" awk readonly && awk
+echo awk | ${HOME} --verbose readonly
+	readonly test awk x=1 "$@" "$@"
+	echo local then done "$@" --verbose
+	test echo done --verbose $(pwd) &&
+cd && test | grep grep readonly awk --verbose then /usr/bin
+/usr/bin export "$1" awk readonly 'quoted text' local readonly
+	cd $(pwd) "$1" 2>/dev/null -eu --verbose cd "$1" && 'quoted text' $(pwd)
+export readonly ${HOME} -eu x=1 export | -eu | | export | | printf echo
+printf /usr/bin printf --verbose cd export printf && test $(pwd) grep ${HOME}
+		--verbose then test local awk export
+	grep grep test 2>/dev/null /usr/bin /usr/bin 'quoted text' x=1
+'quoted text' && x=1 cd && readonly --verbose
+		echo printf grep 2>/dev/null ${HOME} --verbose done /usr/bin && export 'quoted text'
+		readonly local ${HOME} local "$1" /usr/bin ${HOME}
+	-eu echo "$@" echo done "$@" sed "$1" sed export
+	-eu local /usr/bin local test local ${HOME} 2>/dev/null
+"$1" test && -eu then awk cd ${HOME} "$1" grep --verbose
+	done done printf done local -eu "$1"
+"$1" ${HOME} --verbose | x=1 awk "$@" awk | | echo local printf -eu
+		| x=1 2>/dev/null $(pwd) sed x=1 ${HOME} "$1" 'quoted text'
+-eu echo readonly x=1 -eu then ${HOME} "$1" /usr/bin local printf
+sed && then awk then printf --verbose awk /usr/bin
+test ${HOME} local done ${HOME} $(pwd) /usr/bin
+		'quoted text' x=1 sed cd x=1 printf readonly
+cd export grep "$1" export ${HOME}
+${HOME} 2>/dev/null done && export then test $(pwd) "$1" printf
+	cd | -eu ${HOME} $(pwd)
+	grep test x=1 'quoted text' ${HOME} /usr/bin
+grep grep x=1 test export
+		--verbose test awk sed x=1 local then awk
+		grep $(pwd) sed grep awk readonly done awk then $(pwd) | &&
+		grep ${HOME} then "$@" then sed awk "$@" readonly
+then done readonly test x=1 local ${HOME} export
+		--verbose --verbose then "$1" -eu ${HOME} grep done awk -eu done | --verbose
+'quoted text' x=1 printf ${HOME} export awk echo export printf -eu cd 'quoted text'
+	| export ${HOME} done done grep local export | $(pwd)
+${HOME} /usr/bin 'quoted text' grep printf
+sed /usr/bin --verbose /usr/bin local 2>/dev/null 'quoted text'
+	readonly | ${HOME} -eu |
+cd 'quoted text' echo printf printf awk --verbose
+	echo cd 'quoted text' | export cd "$@" readonly
+	cd sed done done sed export printf 2>/dev/null x=1 $(pwd) "$1" /usr/bin |
+printf test done test | --verbose readonly "$@" then readonly
+	done done echo done grep $(pwd)
+| sed -eu && test $(pwd) --verbose
+	local && && /usr/bin
+		readonly sed 2>/dev/null sed echo -eu sed echo echo
+'quoted text' readonly "$@" export ${HOME} --verbose
+		| then x=1 test 2>/dev/null readonly export
+		done x=1 /usr/bin readonly test then awk awk cd --verbose -eu awk
+	cd readonly --verbose 'quoted text'
+		$(pwd) "$@" && && ${HOME} sed "$1" "$1" | export 2>/dev/null
+	grep echo readonly printf
+local --verbose 2>/dev/null test readonly 'quoted text'
+readonly printf ${HOME}
+		then done && 'quoted text'
+	test cd "$1" done 2>/dev/null $(pwd) sed readonly ${HOME}
+	then printf readonly printf $(pwd) && cd /usr/bin echo | $(pwd)
+		&& then sed then "$1" /usr/bin
+		export ${HOME} 2>/dev/null 2>/dev/null export export
+export 2>/dev/null && readonly echo --verbose ${HOME} awk ${HOME}
+	export 2>/dev/null local readonly -eu "$@" && $(pwd) -eu sed done | printf echo
+$(pwd) /usr/bin readonly sed "$@" | $(pwd) $(pwd) && -eu -eu && grep 2>/dev/null
+"$1" -eu export then awk | done -eu && /usr/bin ${HOME} x=1 local
+then /usr/bin local readonly
+		sed /usr/bin && local | test then x=1 /usr/bin grep --verbose
+awk $(pwd) "$1" /usr/bin echo then "$1" /usr/bin
+		awk done ${HOME} | awk "$@" cd 2>/dev/null echo
+	/usr/bin echo | /usr/bin 'quoted text' cd "$1" awk
+		test readonly echo 'quoted text' echo done test test local 2>/dev/null
+	grep && export printf /usr/bin ${HOME} x=1 --verbose
+		readonly echo /usr/bin "$1" test /usr/bin echo /usr/bin $(pwd) $(pwd) "$1"
+		then -eu echo then /usr/bin | /usr/bin
+	| ${HOME} "$1" then done awk readonly
+	${HOME} sed readonly echo 2>/dev/null 'quoted text'
+	| grep 2>/dev/null readonly --verbose x=1 && "$1" test
+	${HOME} --verbose then && done readonly printf
+	then printf export $(pwd) grep ${HOME}
+		&& /usr/bin $(pwd) local printf sed | sed 2>/dev/null ${HOME}
+	"$@" sed 'quoted text' "$1" awk
+		"$@" "$1" | test test done
+	then ${HOME} "$1" local then then && && echo
+		${HOME} cd 'quoted text' x=1 local 2>/dev/null ${HOME} done
+	done "$1" /usr/bin ${HOME} "$1" "$@" readonly ${HOME}
+		"$1" && "$1" echo printf awk test -eu && readonly grep x=1 && readonly
+	sed local 2>/dev/null awk local done awk 'quoted text'
+	2>/dev/null 'quoted text' cd
+		awk done --verbose "$@"
+		2>/dev/null $(pwd) $(pwd) 2>/dev/null
+		sed awk /usr/bin && && then $(pwd) "$@" awk done x=1 --verbose
+/usr/bin --verbose local
+	--verbose /usr/bin x=1 cd ${HOME} | then && 2>/dev/null test | /usr/bin awk
+readonly done then x=1 export local $(pwd) ${HOME} 2>/dev/null && "$1"
+		/usr/bin then x=1 echo export "$1" done --verbose cd "$1"
+readonly $(pwd) $(pwd) local done -eu export readonly export $(pwd) awk -eu then
+		awk 2>/dev/null -eu then -eu 2>/dev/null
+	/usr/bin sed test export 2>/dev/null printf grep
+		readonly echo && done | done grep cd x=1 $(pwd) $(pwd) then then --verbose
+	awk "$@" readonly "$@" ${HOME}
+	${HOME} --verbose cd echo cd --verbose readonly awk 2>/dev/null
+sed echo cd sed sed && | printf -eu "$1" awk && && awk local then | "$@"
+&& readonly done $(pwd) local printf sed "$@"
+grep 2>/dev/null printf printf
+sed --verbose "$1" 'quoted text'
+	awk export $(pwd) 'quoted text' -eu sed --verbose grep 'quoted text' "$1"
+	2>/dev/null sed "$1" echo
+	echo printf echo printf "$@" local local test -eu printf $(pwd) done readonly
+		printf --verbose "$@" 'quoted text' $(pwd) $(pwd)
+		then test --verbose echo cd then readonly
+| printf test echo /usr/bin -eu sed
+		"$@" local "$@" /usr/bin sed ${HOME} "$@" /usr/bin cd awk "$1" -eu x=1 'quoted text'
+then | test -eu && export
+grep test cd grep x=1 readonly done
+	2>/dev/null "$1" $(pwd) -eu "$@" ${HOME}
+	sed grep "$1" 'quoted text'
+		cd "$@" | /usr/bin -eu awk | $(pwd) "$1" -eu printf "$1"
+grep local then | "$@" | 'quoted text' then grep printf
+grep ${HOME} && 2>/dev/null && echo sed sed $(pwd)
+		${HOME} "$1" local sed
+		readonly "$1" printf
+export grep /usr/bin "$@" then &&
+cd cd done echo printf printf "$@" done done -eu printf
+	test readonly test export && --verbose awk
+		local cd $(pwd) local /usr/bin grep export ${HOME} |
+cd awk done export "$1" x=1 | cd then sed export then ${HOME} export
+	${HOME} ${HOME} grep 2>/dev/null
+--verbose awk sed $(pwd) $(pwd)
+"$1" x=1 local awk printf local $(pwd) "$@" test --verbose local echo
+	cd && | readonly awk | then done local cd grep
+		/usr/bin "$1" local test local
+&& sed sed | export "$1" 'quoted text' ${HOME} printf
+	"$@" echo sed local local sed test 'quoted text' sed ${HOME}
+	/usr/bin then awk done -eu done 'quoted text'
+done "$1" grep && local awk "$1" x=1 readonly then printf export export
+		sed readonly 'quoted text'
+/usr/bin && awk done sed /usr/bin test "$1" 2>/dev/null sed then local sed "$@"
+		2>/dev/null then test grep x=1 sed local local awk && && 'quoted text'
+	then -eu grep grep grep ${HOME} test then awk done
+	| -eu echo | --verbose cd /usr/bin cd -eu export local $(pwd) readonly
+	test export $(pwd) readonly awk sed /usr/bin cd done sed ${HOME}
+	echo 'quoted text' $(pwd)
+		done printf --verbose "$@" ${HOME}
+		echo /usr/bin local -eu done
+		then $(pwd) 'quoted text' printf 2>/dev/null "$@" echo export "$@" | 'quoted text'
+		"$1" && echo -eu /usr/bin $(pwd)
+		&& awk 'quoted text' sed ${HOME} "$@" grep readonly 'quoted text'
+	"$1" "$@" test done ${HOME} ${HOME} && done then 2>/dev/null
+	sed --verbose printf && sed "$1" && x=1
+	local && local done grep test 'quoted text'
+		local cd -eu -eu 'quoted text' printf readonly echo && $(pwd) echo
+test cd 2>/dev/null 'quoted text' /usr/bin test ${HOME} && 'quoted text' test printf
+${HOME} $(pwd) readonly grep | export export then done ${HOME} "$@" readonly
+	test /usr/bin "$1" printf local
+		$(pwd) sed | local "$1" sed export
+	--verbose cd export | | "$@" 2>/dev/null
+/usr/bin && then sed then ${HOME} x=1
+grep cd 'quoted text' awk grep $(pwd) grep "$1" "$1"
+		echo echo test grep sed | --verbose
+	$(pwd) grep "$1" readonly 2>/dev/null
+"$@" $(pwd) "$1" 2>/dev/null
+		echo /usr/bin x=1 local -eu 2>/dev/null
+		-eu "$1" export "$1" export export then readonly x=1 done --verbose
+		&& cd awk printf && echo awk /usr/bin test 2>/dev/null "$@" | "$1" test export
+	'quoted text' && awk done
+		| then awk done done /usr/bin
+done "$1" awk awk then -eu export
+		then "$@" x=1 local -eu grep x=1 && 'quoted text'
+		then sed 2>/dev/null x=1 done 'quoted text' done "$1" sed /usr/bin
+		then && then test export
+-eu grep | $(pwd) -eu cd --verbose | 2>/dev/null
+	&& readonly printf printf echo $(pwd) cd "$1" sed cd "$1" ${HOME} $(pwd) /usr/bin
+		sed local grep "$1" "$1" "$1" | awk readonly awk "$1"
+		${HOME} printf | $(pwd) "$@" awk --verbose echo 'quoted text'
+export done "$1" test awk
+		| sed readonly "$@" export printf sed && -eu then printf "$1" echo cd echo done
+	&& echo awk echo done -eu awk done echo export "$1" $(pwd) 2>/dev/null
+		awk sed test sed $(pwd) cd 2>/dev/null /usr/bin -eu done awk grep && export
+	"$1" 'quoted text' /usr/bin cd
+readonly && done readonly -eu ${HOME} grep awk awk local
+		test then 2>/dev/null local 2>/dev/null ${HOME} ${HOME} then local done /usr/bin
+		$(pwd) readonly sed awk test 'quoted text' && ${HOME} cd $(pwd) x=1 local && local
+	| local ${HOME} && awk /usr/bin /usr/bin x=1 x=1 2>/dev/null -eu && printf
+		--verbose export "$@" ${HOME} /usr/bin ${HOME} -eu 2>/dev/null
+		readonly "$@" 2>/dev/null ${HOME} 'quoted text' x=1 local x=1
+echo "$@" local readonly cd sed printf ${HOME} awk
+		2>/dev/null export --verbose local echo 'quoted text' local
+	"$1" grep /usr/bin export printf
+2>/dev/null awk --verbose printf "$1" | done -eu readonly /usr/bin
+	-eu echo $(pwd) /usr/bin awk -eu awk cd local
+${HOME} echo grep 2>/dev/null "$1" /usr/bin sed --verbose grep x=1 "$@"
+		&& export --verbose then $(pwd) then -eu done && x=1 | local cd 2>/dev/null
+--verbose "$1" sed readonly "$@" export --verbose
+	test echo $(pwd) awk --verbose -eu x=1 awk 'quoted text'
+		x=1 sed | test awk /usr/bin -eu
+	grep printf local export printf export ${HOME} printf | echo 2>/dev/null
+		echo echo ${HOME} local $(pwd)
+		"$1" awk awk printf && "$@" local grep local
+		export ${HOME} $(pwd) done x=1 test sed -eu
+	done && test && sed ${HOME} "$1" export ${HOME} 'quoted text'
+	cd then sed echo -eu $(pwd)
+-eu sed printf test local grep --verbose
+		x=1 test cd $(pwd) 'quoted text' printf test "$@" --verbose "$@"
+2>/dev/null "$@" sed grep "$@" "$@" "$1" ${HOME} then 'quoted text' -eu
+		echo -eu x=1 echo echo "$@"
+--verbose | local "$@" "$1"
+		x=1 then && --verbose 2>/dev/null then "$@"
+	export | then 'quoted text' readonly done "$1"
+x=1 | ${HOME} test test readonly
+	local && -eu -eu export cd then -eu $(pwd)
+"$1" /usr/bin readonly local sed awk $(pwd) ${HOME} "$@" echo
+		test $(pwd) ${HOME} "$@" && done echo done 2>/dev/null
+		/usr/bin --verbose grep x=1 2>/dev/null
+		${HOME} cd then $(pwd) "$1" 'quoted text' --verbose export echo echo grep printf
+awk grep echo "$@" ${HOME} grep
+	&& && && then "$1" printf "$1" $(pwd) "$@" "$@" ${HOME} test
+export echo --verbose -eu
+	$(pwd) done local readonly && "$1"
+readonly then $(pwd) /usr/bin
+	local local done cd sed done then echo | -eu --verbose && readonly
+done /usr/bin ${HOME} 2>/dev/null printf | printf echo cd --verbose
+"$1" sed cd --verbose cd sed sed && then --verbose
+${HOME} --verbose grep /usr/bin /usr/bin -eu --verbose && test sed | /usr/bin 'quoted text'
+	then grep export x=1 && | /usr/bin awk readonly
+		echo then awk -eu x=1 local /usr/bin
+/usr/bin | then /usr/bin cd echo --verbose awk sed
+	"$@" "$1" printf /usr/bin export done | cd cd
+		readonly done echo test
+-eu grep ${HOME} echo local done x=1 printf
+		done awk ${HOME} $(pwd) x=1 grep echo
+		cd echo awk awk local cd local /usr/bin then /usr/bin 'quoted text' $(pwd)
+	sed $(pwd) | --verbose --verbose echo done then --verbose $(pwd) && x=1 done
+		grep --verbose 2>/dev/null && awk sed then -eu -eu echo grep -eu --verbose --verbose
+		"$1" 'quoted text' test awk grep sed -eu test test
+		test grep then sed x=1 x=1 cd $(pwd) ${HOME} echo
+"$@" awk --verbose && 'quoted text' x=1 test readonly ${HOME}
+	/usr/bin x=1 grep 2>/dev/null grep readonly && -eu sed
+"$1" readonly -eu done $(pwd) $(pwd)
+		&& done printf --verbose $(pwd) "$@" then -eu
+		sed 2>/dev/null echo $(pwd) && /usr/bin sed /usr/bin "$1" grep then awk grep
+		sed /usr/bin ${HOME} done | grep test
+		then "$1" cd readonly printf awk $(pwd) 'quoted text' -eu |
+		readonly export $(pwd) /usr/bin grep
+		--verbose "$@" sed "$1" done 'quoted text' x=1 'quoted text' 2>/dev/null
+done "$1" readonly "$1"
+grep export ${HOME} ${HOME} "$1" | $(pwd) -eu $(pwd) readonly
+		echo sed echo local | --verbose /usr/bin "$@" 'quoted text'
+		grep "$@" $(pwd) done -eu /usr/bin printf readonly
+	x=1 /usr/bin $(pwd) -eu && /usr/bin grep "$@" "$@" x=1
+		"$@" sed "$1" grep | && ${HOME} /usr/bin echo
+	--verbose -eu printf local | test echo ${HOME}
+--verbose "$1" "$@" -eu "$@" export 2>/dev/null
+cd && && sed then -eu grep awk
+	--verbose test test 2>/dev/null "$1" sed --verbose grep readonly test
+${HOME} printf readonly "$@" grep local cd sed /usr/bin printf sed echo then
+		--verbose then x=1 2>/dev/null then
+	sed 'quoted text' 2>/dev/null test awk 2>/dev/null && local -eu
+&& then $(pwd) done && /usr/bin printf 2>/dev/null readonly --verbose "$@" readonly
+		grep test "$1" 2>/dev/null -eu x=1 $(pwd)
+		${HOME} 'quoted text' echo x=1 sed test local -eu printf
+	echo local "$@" 2>/dev/null
+		printf local 2>/dev/null echo && printf
+	grep /usr/bin x=1 then then test --verbose && echo
+| "$1" done printf $(pwd) ${HOME} | &&
+readonly readonly x=1 sed awk --verbose x=1 done 'quoted text'
+	--verbose export local
+		sed | && awk $(pwd) local done done grep --verbose printf | test && $(pwd)
+		&& grep "$1" awk awk && "$1" export test /usr/bin && local
+	-eu "$@" "$@" test | x=1 -eu --verbose /usr/bin export
+		local echo cd /usr/bin "$@" cd export sed x=1
+		-eu done /usr/bin export /usr/bin
+		local 'quoted text' x=1 awk sed -eu
+	printf --verbose "$1" -eu then "$1" echo
+${HOME} "$1" grep awk "$1" /usr/bin sed
+2>/dev/null sed "$@" "$@" printf $(pwd)
+	${HOME} && cd "$@" "$1" /usr/bin 'quoted text'
+cd readonly $(pwd) &&
+		awk then && readonly cd then awk test "$@" x=1 readonly then
+	export echo ${HOME} --verbose x=1 'quoted text'
+		| "$1" $(pwd) "$1" | "$1" readonly "$1" 2>/dev/null
+grep sed awk readonly echo export test
+export "$@" x=1 | printf $(pwd) $(pwd)
+		test -eu | sed done /usr/bin
+	&& --verbose grep then | x=1 ${HOME} --verbose $(pwd) &&
+	-eu test done export readonly sed "$@" awk local then local sed
+		/usr/bin && test sed ${HOME} --verbose
+		awk export grep x=1 ${HOME} cd printf sed -eu printf $(pwd) $(pwd) readonly
+printf echo echo -eu "$@" 2>/dev/null grep | && ${HOME} sed 2>/dev/null
+awk "$@" printf readonly sed awk /usr/bin awk --verbose
+		$(pwd) local cd cd && cd ${HOME} ${HOME} sed sed ${HOME}
+		local 'quoted text' cd sed --verbose x=1 "$@"
+local -eu echo && cd "$1" 'quoted text' 2>/dev/null local sed
+		sed awk | 'quoted text' printf -eu 2>/dev/null $(pwd) 2>/dev/null test then
+	grep "$@" -eu printf export done --verbose "$1" 'quoted text' local echo | readonly
+	${HOME} sed echo cd sed test | test ${HOME}
+		awk "$1" | -eu $(pwd) 'quoted text' printf test /usr/bin | then export done --verbose
+		/usr/bin export done ${HOME} readonly --verbose test test
+	"$@" /usr/bin local 2>/dev/null grep "$@" awk $(pwd) 'quoted text' sed export
+	awk grep -eu /usr/bin -eu && x=1
+	-eu $(pwd) awk && 2>/dev/null cd printf ${HOME} export $(pwd) awk cd /usr/bin
+		cd "$1" && -eu x=1 test --verbose | 2>/dev/null
+		export export then awk grep /usr/bin awk echo /usr/bin
+grep local echo done echo
+		then $(pwd) x=1 done local -eu grep 2>/dev/null
+		--verbose ${HOME} then --verbose cd done && x=1 'quoted text' local cd sed awk
+		'quoted text' -eu awk done "$1" /usr/bin /usr/bin "$@" x=1 printf then sed
+test then readonly $(pwd) --verbose
+$(pwd) -eu 'quoted text' | "$1" export test printf x=1 done
+	2>/dev/null /usr/bin /usr/bin test "$@" then cd grep then printf
+'quoted text' done printf test "$1" cd readonly
+"$1" printf local sed grep sed $(pwd) --verbose | printf readonly "$1"
+grep "$1" export ${HOME} -eu
+sed 'quoted text' && readonly
+		$(pwd) && 2>/dev/null $(pwd)
+	"$@" then "$1" readonly | done "$1" | 'quoted text' cd sed printf cd $(pwd) -eu
+"$1" $(pwd) done test sed done
+"$@" awk -eu x=1 $(pwd) cd --verbose
+	echo local | | test | echo "$@" export test echo
+test -eu ${HOME} local 'quoted text' local "$1" 'quoted text' grep ${HOME}
+		-eu x=1 "$@" printf export
+	export cd printf cd done readonly
+	x=1 printf sed export
+done grep /usr/bin x=1 "$1" test sed echo
+		"$1" 'quoted text' 2>/dev/null $(pwd) 'quoted text' --verbose test done local
+local test grep local 'quoted text' echo &&
+		$(pwd) awk grep --verbose
+		2>/dev/null echo -eu test /usr/bin awk --verbose then done export
+		printf sed readonly readonly | -eu grep
+		done echo $(pwd) done | local 'quoted text' export
+	printf awk && --verbose 'quoted text' grep awk cd /usr/bin /usr/bin
+	${HOME} | then ${HOME} | /usr/bin --verbose cd x=1 ${HOME}
+'quoted text' --verbose echo awk $(pwd) local then awk "$1" /usr/bin
+	| echo export 'quoted text' ${HOME} export local /usr/bin export readonly test
+printf x=1 sed 'quoted text' 2>/dev/null grep "$1" readonly printf --verbose
+		-eu ${HOME} "$1" --verbose -eu readonly printf ${HOME} then x=1 cd "$@"
+		local 2>/dev/null export 'quoted text'
+	x=1 | /usr/bin /usr/bin then local
+		sed 2>/dev/null $(pwd) grep echo readonly done printf ${HOME} sed readonly
+	&& export x=1 export 'quoted text' grep
+		sed /usr/bin "$@" ${HOME} --verbose test export /usr/bin sed readonly "$@" -eu
+	grep && --verbose printf readonly $(pwd) x=1 echo
+		2>/dev/null awk "$@" then sed ${HOME}
+	/usr/bin ${HOME} "$1" awk test cd cd cd readonly cd then -eu -eu cd ${HOME}
+		--verbose $(pwd) x=1 ${HOME} cd printf $(pwd) 2>/dev/null && grep /usr/bin --verbose
+	"$@" grep --verbose awk echo | awk ${HOME} done $(pwd) ${HOME} && --verbose
+	x=1 awk printf readonly cd grep | export x=1 ${HOME}
+		"$@" echo done | && local cd "$1" export 2>/dev/null $(pwd) $(pwd) awk local
+		readonly then awk readonly "$@" 'quoted text'
+--verbose awk readonly local awk 'quoted text' 2>/dev/null
+test cd test x=1 | echo "$@" /usr/bin
+"$1" -eu $(pwd) local export 'quoted text' readonly
+	'quoted text' 2>/dev/null test grep printf
+	test "$1" sed local "$1" ${HOME} then
+$(pwd) test "$1" "$1" "$1"
+x=1 --verbose then cd /usr/bin printf && -eu | cd -eu 2>/dev/null
+		sed | test cd 'quoted text' cd 2>/dev/null local then done grep "$1"
+		then $(pwd) | --verbose ${HOME} local "$1"
+		export local then local readonly sed sed
+		2>/dev/null echo 2>/dev/null echo grep test local then
+2>/dev/null then cd | then awk readonly then | sed | 2>/dev/null awk 2>/dev/null
+		sed then | cd -eu sed printf /usr/bin -eu awk readonly printf
+	2>/dev/null local readonly --verbose
+	"$@" /usr/bin --verbose 2>/dev/null
+		sed 2>/dev/null done grep $(pwd) -eu
+	done "$1" grep && grep done --verbose echo
+		/usr/bin printf $(pwd)
+		readonly cd ${HOME} export sed readonly grep printf
+	local 'quoted text' awk 'quoted text'
+		local grep grep --verbose export cd test
+		/usr/bin cd local $(pwd) "$@" echo cd export sed
+		"$@" ${HOME} done && x=1 grep 'quoted text'
+	grep ${HOME} x=1 grep printf awk | done 'quoted text' "$1"
+		then echo /usr/bin cd $(pwd) local --verbose ${HOME} readonly -eu test
+sed $(pwd) done x=1 'quoted text' done echo readonly && $(pwd) 'quoted text'
+${HOME} $(pwd) local $(pwd) cd $(pwd) "$1" cd ${HOME} 'quoted text'
+2>/dev/null cd x=1 export 2>/dev/null awk "$1" sed -eu /usr/bin 2>/dev/null
+		grep export printf 2>/dev/null local local grep awk grep printf $(pwd)
+		grep --verbose "$1" printf readonly then /usr/bin 2>/dev/null && grep echo
+		awk local awk then sed "$1" grep sed sed printf test
+		local | echo echo 'quoted text' --verbose
+"$1" readonly 'quoted text'
+		--verbose test "$@" 'quoted text' test test then then local then $(pwd) printf
+		grep then local echo grep export echo awk test then printf && sed /usr/bin
+'quoted text' echo test echo && cd sed done then
+then x=1 echo grep $(pwd) readonly
+	${HOME} export "$@" sed $(pwd) sed | $(pwd) awk $(pwd) &&
+	2>/dev/null readonly printf && awk echo cd local -eu echo cd && done 2>/dev/null
+-eu done sed /usr/bin -eu x=1 echo local export "$1" readonly export --verbose "$1"
+		awk "$1" -eu echo awk && -eu "$@" && "$1" "$@" -eu $(pwd)
+	grep echo 'quoted text' export | 'quoted text' "$@" ${HOME}
+	test then -eu export x=1 ${HOME} "$1" grep then --verbose ${HOME} printf
+	export readonly export export 2>/dev/null local ${HOME} sed export
+awk echo printf test 2>/dev/null 'quoted text' ${HOME} -eu /usr/bin
+		2>/dev/null x=1 export --verbose x=1 "$@" ${HOME} echo /usr/bin
+	-eu export echo ${HOME} $(pwd)
+		"$1" grep /usr/bin readonly export echo done export 2>/dev/null --verbose local
+	-eu grep ${HOME} "$1" /usr/bin -eu /usr/bin
+		local | readonly | readonly
+		$(pwd) -eu sed readonly --verbose done --verbose
+-eu awk export /usr/bin sed "$@" 2>/dev/null printf 'quoted text'
+		"$@" done readonly echo "$@" local ${HOME} local done
+sed 'quoted text' /usr/bin printf 'quoted text'
+		cd grep && $(pwd) "$1" /usr/bin readonly awk done
+	$(pwd) local test done local export export export 'quoted text'
+	awk export "$1" then local then "$1" ${HOME} -eu then
+	--verbose grep export && && cd /usr/bin && cd export ${HOME} readonly readonly
+		$(pwd) cd | sed /usr/bin then then
+cd sed cd readonly /usr/bin test
+local export /usr/bin then x=1 | && test cd local $(pwd)
+2>/dev/null local --verbose cd
+readonly cd test && ${HOME} -eu | awk printf 'quoted text' && cd /usr/bin
+	/usr/bin /usr/bin printf 'quoted text' "$@" local awk cd printf
+"$@" printf test then then cd printf cd then export -eu | echo sed cd grep /usr/bin
+	test x=1 test sed | 2>/dev/null
+	| | readonly sed x=1 sed ${HOME} "$@" && "$@" $(pwd)
+	done ${HOME} --verbose ${HOME} $(pwd) sed sed /usr/bin cd readonly
+| && cd then $(pwd) echo
+${HOME} sed readonly awk echo cd x=1 local export done cd echo "$1" $(pwd)
+&& --verbose sed ${HOME} x=1 2>/dev/null $(pwd) /usr/bin --verbose --verbose
+awk 'quoted text' sed "$1" -eu grep export 2>/dev/null
+		| /usr/bin /usr/bin && export "$1" | then done $(pwd)
+	echo export awk ${HOME} then done && sed echo awk -eu cd sed readonly export test
+"$@" -eu "$1" test printf | $(pwd) x=1 --verbose then echo export grep
+		x=1 readonly --verbose /usr/bin local readonly -eu ${HOME} test echo sed test
+	sed -eu -eu x=1 ${HOME} /usr/bin
+		--verbose awk then done grep printf /usr/bin && sed
+-eu --verbose cd grep x=1 grep
+	echo test cd && awk grep 'quoted text' grep /usr/bin printf export grep | -eu
+	"$@" export grep 'quoted text' ${HOME} --verbose "$1" "$@" 2>/dev/null
+		then awk echo | done done /usr/bin then "$1" 'quoted text' readonly | done readonly
+		| printf "$1" "$1" echo "$@" -eu sed x=1 cd sed done 'quoted text' 2>/dev/null
+		then awk sed "$@" 'quoted text' sed then echo cd cd
+printf && --verbose echo grep /usr/bin
+local done 2>/dev/null local done x=1 ${HOME} echo
+		&& --verbose awk printf awk /usr/bin -eu && --verbose --verbose /usr/bin
+		${HOME} sed test awk -eu then printf test readonly printf -eu ${HOME} && ${HOME}
+echo x=1 grep test && sed readonly printf /usr/bin x=1 x=1 2>/dev/null
+	echo && local local $(pwd)
+$(pwd) readonly "$1" sed test then --verbose "$1"
+	/usr/bin /usr/bin grep cd 2>/dev/null
+export x=1 grep x=1 ${HOME} sed -eu printf ${HOME}
+local ${HOME} && echo | x=1 'quoted text' sed 'quoted text' 2>/dev/null awk cd
+	then --verbose done printf "$@" "$1" awk awk -eu grep done readonly && export
+		| grep sed export export done /usr/bin | local sed ${HOME} grep test local $(pwd)
+	x=1 ${HOME} printf x=1 "$@" export ${HOME} ${HOME} /usr/bin
+	"$@" readonly /usr/bin awk printf /usr/bin -eu x=1 -eu 2>/dev/null
+then | echo 2>/dev/null cd 2>/dev/null then $(pwd)
+		"$@" 2>/dev/null x=1 export 'quoted text' $(pwd) sed -eu
+	"$@" 'quoted text' cd 'quoted text'
+		$(pwd) /usr/bin then sed 2>/dev/null "$@" sed
+local "$1" 'quoted text' $(pwd) echo
+	"$@" && printf grep "$1" local x=1 awk local "$1" && 2>/dev/null printf -eu /usr/bin
+	awk /usr/bin test sed then -eu $(pwd) grep grep awk echo local x=1 then
+done --verbose readonly echo x=1 printf sed --verbose 2>/dev/null
+		readonly readonly "$1" 2>/dev/null sed readonly 2>/dev/null test &&
+then && local then "$1" 2>/dev/null 'quoted text' sed /usr/bin export
+		grep 2>/dev/null "$@" --verbose $(pwd) local 'quoted text'
+export "$@" cd cd cd $(pwd) 2>/dev/null
+then awk && printf cd ${HOME} printf awk 'quoted text'
+"$1" ${HOME} awk "$1" "$1" readonly local | export echo export
+then "$1" 'quoted text' 'quoted text'
+		test "$@" local | -eu readonly /usr/bin readonly "$1" && $(pwd) local cd
+	printf awk ${HOME} export 2>/dev/null readonly "$@"
+	awk -eu "$@" 'quoted text' "$@" cd export done 2>/dev/null
+readonly -eu ${HOME} test
+echo test export 2>/dev/null
+| "$@" 2>/dev/null ${HOME} 'quoted text'
+	printf cd "$@" then ${HOME} sed && export
+	--verbose /usr/bin test test ${HOME}
+	'quoted text' 2>/dev/null export printf 'quoted text'
+${HOME} "$1" && printf x=1 ${HOME} --verbose
+x=1 cd && grep --verbose readonly x=1
+	readonly "$@" 'quoted text' | cd "$@" export 2>/dev/null local --verbose sed
+'quoted text' x=1 && printf test echo export --verbose
+$(pwd) "$@" grep printf -eu echo export ${HOME}
+x=1 && local grep "$@" 'quoted text' x=1 "$@" ${HOME} -eu
+| 'quoted text' sed then
+		sed test export then echo $(pwd) --verbose cd done
+		${HOME} readonly cd printf | readonly x=1 | export cd export export local
+done cd test sed /usr/bin grep then printf
+--verbose /usr/bin test export done $(pwd) echo ${HOME} x=1 awk
+		then printf sed | && sed && printf
+	2>/dev/null $(pwd) ${HOME} sed awk readonly "$1" | then local -eu
+${HOME} --verbose local "$@" "$1" 2>/dev/null printf 2>/dev/null sed echo
+	$(pwd) then x=1 test 'quoted text' awk -eu awk | "$1" x=1 awk "$@"
+		echo sed readonly local 'quoted text' readonly &&
+		| grep grep -eu 'quoted text' /usr/bin
+-eu awk | 2>/dev/null 'quoted text' sed then sed /usr/bin "$@" && /usr/bin
+grep awk $(pwd) --verbose export test export
+	sed $(pwd) done grep 'quoted text'
+		${HOME} sed then readonly
+		2>/dev/null 'quoted text' x=1 $(pwd) 2>/dev/null
+'quoted text' x=1 "$1" ${HOME} ${HOME} -eu awk readonly -eu "$1"
+		printf printf cd x=1 then "$@" then
+	export && then test /usr/bin 2>/dev/null
+		awk -eu done ${HOME} /usr/bin grep readonly printf
+cd ${HOME} "$@" export test cd test
+	cd 'quoted text' "$@" then printf grep x=1
+		local | "$@" | "$@" 'quoted text'
+done test test readonly && "$1"
+test $(pwd) grep sed 2>/dev/null grep then test awk --verbose --verbose x=1 echo
+	'quoted text' local $(pwd) && | $(pwd) awk
+"$@" 2>/dev/null done done sed
+		x=1 && --verbose awk printf local 2>/dev/null printf
+		done echo "$@" ${HOME} sed
+		${HOME} "$@" --verbose ${HOME}
+done then x=1 done &&
+	${HOME} local $(pwd) x=1 | ${HOME} awk ${HOME} 2>/dev/null "$@"
+		-eu | /usr/bin /usr/bin -eu --verbose 'quoted text'
+	readonly --verbose awk local
+	awk then done printf
+printf then x=1 ${HOME}
+		"$1" awk | x=1 sed -eu export printf test x=1 sed ${HOME}
+		"$@" local ${HOME} 2>/dev/null awk $(pwd) $(pwd) -eu x=1 /usr/bin awk x=1 ${HOME}
+2>/dev/null readonly && awk grep "$@" ${HOME} done printf
+	export awk then /usr/bin $(pwd) "$@" test x=1
+		printf sed then grep x=1 --verbose -eu grep -eu 2>/dev/null
+done printf local printf x=1
+	"$@" then then echo readonly local export /usr/bin test && "$@" grep
+readonly printf && -eu
+	grep then echo then awk /usr/bin test cd readonly && /usr/bin "$1"
+test /usr/bin -eu 2>/dev/null done local echo readonly $(pwd) export --verbose
+		-eu readonly --verbose done
+	"$1" /usr/bin awk awk cd test ${HOME} then done x=1 sed cd grep test --verbose
+		printf cd && /usr/bin test -eu test | 'quoted text' | export ${HOME}
+awk $(pwd) "$@" cd -eu export cd
+		export done | $(pwd) then 2>/dev/null
+	export && x=1 test ${HOME} readonly /usr/bin
+		done readonly grep local
+${HOME} test export "$1" echo ${HOME} && cd /usr/bin "$1" --verbose readonly grep
+	${HOME} | sed then 'quoted text' 2>/dev/null ${HOME} 'quoted text'
+	local && cd $(pwd) "$@" "$@" test sed readonly 'quoted text'
+grep "$1" "$@" sed export
@@ -0,0 +1,2001 @@
+&& 2>/dev/null echo awk &&
+	$(pwd) printf "$1" grep ${HOME} printf && sed cd local local -eu awk local
+		"$1" grep then 'quoted text' "$1" x=1
+readonly echo grep && then cd | | 2>/dev/null readonly && sed --verbose
+		"$1" done "$@" cd local "$@" export cd 'quoted text' export
+&& echo "$@" test done x=1 -eu x=1 && cd test /usr/bin
+sed "$@" sed | -eu "$1" /usr/bin echo readonly then --verbose -eu -eu $(pwd)
+done -eu printf local test --verbose awk grep 'quoted text'
+export 2>/dev/null export "$1" cd then export local /usr/bin grep --verbose
+	echo echo ${HOME} "$1" && /usr/bin "$1" readonly
+	x=1 awk --verbose export /usr/bin 'quoted text' grep ${HOME} x=1 x=1 -eu "$1"
+		2>/dev/null local "$@" awk
+--verbose then test sed ${HOME} echo
+printf readonly 2>/dev/null cd test
+then done "$1" -eu "$@" "$@" && "$1" awk 'quoted text' /usr/bin done
+--verbose /usr/bin "$1" ${HOME} awk "$@" export | --verbose cd && then "$1" sed
+		&& grep /usr/bin "$1" ${HOME} done | then done $(pwd) local awk grep awk cd x=1
+	test "$@" 'quoted text' printf --verbose
+${HOME} test && x=1 echo 2>/dev/null sed x=1 readonly cd local readonly
+		2>/dev/null test then readonly $(pwd) x=1
+		sed test 2>/dev/null 2>/dev/null grep $(pwd)
+	done 'quoted text' | echo
+		done readonly ${HOME} readonly --verbose then --verbose
+	grep local && 2>/dev/null
+		local $(pwd) export --verbose
+	local /usr/bin "$@" cd readonly /usr/bin readonly grep printf | echo local
+x=1 && 'quoted text' --verbose then
+		sed then && then x=1 readonly done local awk then $(pwd) | --verbose
+	${HOME} ${HOME} 2>/dev/null -eu --verbose | $(pwd) "$@"
+	--verbose awk | test "$@" | ${HOME} -eu --verbose /usr/bin local export
+	--verbose && sed cd export && grep
+		&& local $(pwd) x=1 sed test done | grep $(pwd) 'quoted text'
+		2>/dev/null readonly export sed awk && cd
+	grep 'quoted text' 2>/dev/null
+&& /usr/bin cd ${HOME} -eu awk readonly "$@" test
+	-eu x=1 readonly grep | --verbose
+awk awk && grep && done "$1" 'quoted text'
+		"$@" "$1" && 2>/dev/null "$1" /usr/bin sed export local cd local
+-eu echo -eu readonly "$@"
+	"$@" then test readonly grep | sed | --verbose -eu awk $(pwd) /usr/bin local
+		2>/dev/null done --verbose sed
+readonly 'quoted text' awk readonly "$1" readonly
+done "$@" --verbose export | | --verbose awk
+--verbose done "$@" ${HOME} "$@" /usr/bin -eu then export
+'quoted text' x=1 grep /usr/bin --verbose
+	local $(pwd) "$@" 2>/dev/null printf ${HOME} 2>/dev/null
+	-eu export echo x=1 $(pwd)
+	-eu 2>/dev/null grep "$@" | 2>/dev/null
+		readonly 'quoted text' && sed readonly ${HOME}
+	x=1 2>/dev/null x=1 2>/dev/null local printf "$1" test printf sed
+"$1" printf | done 'quoted text' cd && -eu x=1 --verbose awk cd test printf
+	-eu export awk echo cd $(pwd) grep ${HOME} $(pwd) | /usr/bin export /usr/bin | -eu
+	done "$1" 2>/dev/null local ${HOME} -eu --verbose cd grep
+printf x=1 "$@" /usr/bin | printf 'quoted text' grep printf printf test then
+readonly echo ${HOME} readonly
+	/usr/bin && -eu -eu cd test -eu done printf then grep sed cd awk
+		readonly --verbose then $(pwd) "$@" && done
+		$(pwd) grep echo cd awk $(pwd) done sed ${HOME} cd -eu "$@" ${HOME}
+done 'quoted text' echo "$@" echo export | awk --verbose
+		'quoted text' awk awk local 2>/dev/null awk local | then
+		2>/dev/null awk | --verbose x=1 "$1" readonly echo then
+local --verbose && ${HOME} && local x=1 | echo x=1 "$1" x=1 then then
+"$1" local local printf 'quoted text' export test "$@"
+	sed ${HOME} | local ${HOME} printf /usr/bin 'quoted text' $(pwd)
+	| x=1 /usr/bin x=1 /usr/bin then --verbose awk then test $(pwd)
+		done grep x=1 $(pwd) test ${HOME}
+$(pwd) | printf && done -eu $(pwd) then echo local local
+&& echo local x=1 grep 'quoted text'
+		test "$@" 2>/dev/null printf grep
+--verbose local cd 2>/dev/null
+	${HOME} test cd $(pwd) test done && export sed | x=1 --verbose export /usr/bin
+	cd cd then x=1 done done grep
+grep test 'quoted text' cd sed readonly cd 2>/dev/null
+/usr/bin done "$1" && sed 'quoted text' | && cd awk done readonly readonly test
+x=1 /usr/bin local grep cd cd readonly
+		| ${HOME} cd ${HOME} 2>/dev/null
+		local done test awk echo | "$@" sed export ${HOME} "$1" test
+		done -eu test | ${HOME} | $(pwd) x=1 x=1 2>/dev/null
+	sed cd --verbose 2>/dev/null
+		"$@" awk --verbose done then awk echo sed cd 2>/dev/null && test echo $(pwd)
+		${HOME} /usr/bin $(pwd) 'quoted text' "$1" grep then --verbose "$@"
+		awk 2>/dev/null test | then 2>/dev/null then -eu awk done echo cd cd x=1 2>/dev/null
+"$@" readonly cd awk | ${HOME} $(pwd) then local
+-eu 'quoted text' test
+test "$@" sed awk ${HOME} sed $(pwd) cd sed ${HOME}
+-eu && test --verbose "$@" "$1" readonly ${HOME} export readonly local
+		awk x=1 done "$@" ${HOME} 2>/dev/null readonly export -eu readonly
+		test "$@" -eu done $(pwd) $(pwd) sed --verbose grep
+		| echo && ${HOME} awk --verbose -eu --verbose 2>/dev/null
+		--verbose local ${HOME} --verbose
+		$(pwd) x=1 awk "$1" export "$@" $(pwd) && local x=1 cd readonly then $(pwd)
+	printf sed /usr/bin && local "$1" readonly export
+		grep "$@" done echo cd awk "$@" /usr/bin done
+		echo test local ${HOME} 2>/dev/null $(pwd) "$@" 2>/dev/null printf
+'quoted text' awk printf export -eu sed readonly local readonly $(pwd)
+		'quoted text' /usr/bin x=1 --verbose readonly printf "$@"
+-eu | echo "$1" test echo awk sed cd "$1" readonly cd grep
+		"$@" export /usr/bin grep grep ${HOME} local $(pwd) | && cd 2>/dev/null
+		-eu x=1 "$1" done $(pwd) then export "$@" export 2>/dev/null "$@" cd
+sed local sed awk readonly x=1
+		--verbose 2>/dev/null test $(pwd)
+	&& local echo 'quoted text' local /usr/bin cd "$1" 2>/dev/null 2>/dev/null
+	-eu done awk "$@" && export 2>/dev/null test && awk --verbose
+/usr/bin sed 2>/dev/null cd --verbose /usr/bin &&
+		/usr/bin then awk $(pwd) /usr/bin
+	test local -eu 'quoted text' export --verbose test printf export | test
+	then 'quoted text' && local && echo /usr/bin
+	--verbose cd -eu -eu local done $(pwd)
+	cd && export printf export ${HOME} | local x=1 local awk printf -eu
+	x=1 --verbose $(pwd) awk grep cd 'quoted text' test -eu -eu
+		then "$@" grep -eu cd
+	done x=1 'quoted text' cd cd
+		local /usr/bin x=1 echo x=1 'quoted text' --verbose then "$@" printf
+		| done printf x=1 sed --verbose printf cd $(pwd)
+		then 2>/dev/null awk grep echo printf test
+	| | grep --verbose 2>/dev/null sed -eu --verbose echo --verbose grep /usr/bin
+		export $(pwd) ${HOME} echo readonly 'quoted text' test echo echo "$1" cd "$1" /usr/bin
+&& -eu "$1" sed /usr/bin export cd 2>/dev/null
+	-eu local "$@" echo readonly --verbose "$@" sed "$1" grep test done $(pwd)
+	awk then then cd ${HOME} x=1 -eu
+		sed grep test sed "$1" readonly readonly awk $(pwd) --verbose sed -eu test
+	'quoted text' done /usr/bin sed printf &&
+		&& local local -eu export export "$1" sed then "$@" then && echo awk printf "$1"
+	printf readonly sed cd local $(pwd) x=1 ${HOME} sed
+	grep "$@" done then /usr/bin done printf 2>/dev/null -eu done readonly
+	local export export cd readonly
+	awk "$@" local "$@" local done echo --verbose 2>/dev/null -eu --verbose "$@" x=1
+	'quoted text' printf awk readonly cd -eu && sed local $(pwd)
+	awk /usr/bin /usr/bin 'quoted text' && /usr/bin
+	test --verbose echo /usr/bin sed sed && /usr/bin "$@" printf echo
+	/usr/bin "$1" local local
+x=1 ${HOME} grep $(pwd) printf | | awk
+		echo x=1 readonly ${HOME} awk x=1 export $(pwd)
+	printf /usr/bin -eu "$1" awk
+'quoted text' x=1 && awk "$1" done grep local $(pwd) "$1" /usr/bin test /usr/bin
+done /usr/bin 2>/dev/null | 'quoted text' done --verbose
+test $(pwd) grep /usr/bin "$1" export done export then
+		"$1" export x=1 grep
+	done done awk && "$@" ${HOME} /usr/bin sed local $(pwd) sed sed
+		2>/dev/null done test | export readonly "$@" grep export ${HOME}
+	'quoted text' /usr/bin --verbose /usr/bin awk 'quoted text' -eu printf
+$(pwd) --verbose x=1 | cd &&
+	readonly 2>/dev/null "$1" export 'quoted text' 2>/dev/null echo
+	test | echo then sed local
+		local cd test then x=1 local local readonly
+printf ${HOME} sed awk sed export -eu awk 'quoted text' then "$1" -eu ${HOME}
+"$1" awk sed printf printf
+readonly grep sed ${HOME} grep test 'quoted text'
+then && local "$1" test printf -eu
+'quoted text' done sed 2>/dev/null
+		-eu export local echo -eu -eu local && printf x=1 "$@" --verbose ${HOME} printf
+test grep ${HOME} "$1" x=1 "$@"
+	grep echo ${HOME} ${HOME} awk ${HOME} /usr/bin
+test sed then "$@" --verbose readonly test /usr/bin $(pwd) 2>/dev/null test --verbose
+	echo 'quoted text' awk export
+"$@" /usr/bin 2>/dev/null && awk -eu then x=1 grep
+		printf 2>/dev/null x=1 $(pwd) | local then --verbose /usr/bin sed local
+	2>/dev/null then done | grep /usr/bin 'quoted text' echo "$1" "$@"
+'quoted text' $(pwd) && local --verbose -eu "$@" -eu
+		grep readonly && readonly test
+| sed "$1" done /usr/bin -eu echo ${HOME}
+/usr/bin done | test 2>/dev/null export $(pwd) /usr/bin "$@" "$1" printf readonly
+		printf ${HOME} local
+	-eu "$@" cd local 'quoted text'
+export grep export -eu test then |
+		$(pwd) 2>/dev/null local x=1 awk test 'quoted text'
+	grep cd | then export test 'quoted text'
+	x=1 | readonly 2>/dev/null awk grep -eu awk "$@" sed -eu sed "$@" cd printf
+	then cd "$1" --verbose ${HOME} test test echo awk
+	sed "$@" | grep "$1" local cd grep "$1"
+		-eu echo && local cd done 2>/dev/null
+		/usr/bin | cd cd printf /usr/bin $(pwd) then done $(pwd)
+	${HOME} sed -eu echo export cd "$@"
+test | x=1 "$1" ${HOME} | readonly
+		grep done /usr/bin x=1 then echo awk 'quoted text' "$1" $(pwd) $(pwd)
+grep 2>/dev/null readonly then && echo ${HOME}
+		grep | 2>/dev/null --verbose -eu export "$1" readonly -eu awk test echo x=1 "$1"
+		| $(pwd) "$@" | echo "$1" /usr/bin
+	then awk local 'quoted text'
+"$1" $(pwd) echo x=1 readonly
+&& done | echo $(pwd) then sed --verbose --verbose echo "$1" "$1" "$1" 2>/dev/null
+		cd test "$1" $(pwd) "$@" then "$1"
+		$(pwd) x=1 sed && 2>/dev/null -eu -eu sed printf ${HOME} cd -eu 'quoted text'
+'quoted text' /usr/bin echo --verbose grep done /usr/bin grep | grep echo
+		readonly ${HOME} 2>/dev/null ${HOME} cd x=1 cd 2>/dev/null cd $(pwd)
+		'quoted text' then export | export
+2>/dev/null local $(pwd) done
+		'quoted text' readonly then printf 2>/dev/null awk 'quoted text'
+		&& awk /usr/bin "$@" 2>/dev/null && "$@" x=1 local done sed "$1" export
+	done | readonly then cd printf 'quoted text' -eu local $(pwd) done grep
+"$@" echo local "$1" then x=1 ${HOME} x=1 test ${HOME} && export
+awk | export echo x=1 awk "$@" --verbose sed
+	printf "$1" local grep &&
+		| x=1 /usr/bin $(pwd) $(pwd) awk awk done ${HOME} ${HOME} sed echo -eu
+		readonly 2>/dev/null awk done && "$@" readonly printf
+		readonly /usr/bin awk local grep printf | sed $(pwd) "$1" readonly
+/usr/bin test -eu && export 2>/dev/null "$1" local ${HOME} export "$@" | "$@"
+-eu then ${HOME} grep export grep x=1
+	export test done readonly 2>/dev/null 2>/dev/null
+	grep export echo | 2>/dev/null 2>/dev/null
+		/usr/bin sed grep printf "$@"
+		/usr/bin x=1 cd && then --verbose then export export "$@" 2>/dev/null
+	test printf then awk export test "$@" 'quoted text' then export
+export $(pwd) printf $(pwd) then &&
+		then && test x=1 -eu 'quoted text' local $(pwd) local
+printf 2>/dev/null "$1" 2>/dev/null grep /usr/bin
+	| local --verbose 'quoted text' && x=1 export && local "$1" && printf
+&& readonly -eu readonly grep $(pwd)
+'quoted text' /usr/bin echo /usr/bin readonly printf echo
+		-eu printf | 2>/dev/null --verbose $(pwd) && readonly /usr/bin
+then readonly --verbose ${HOME} 2>/dev/null $(pwd) readonly x=1 readonly
+awk export $(pwd) 'quoted text'
+	'quoted text' $(pwd) --verbose
+printf "$@" && awk ${HOME} $(pwd) /usr/bin awk cd
+	| 'quoted text' cd then | -eu export awk $(pwd) printf /usr/bin
+	awk export then x=1 grep "$1" done x=1 "$@" 'quoted text' grep ${HOME} 'quoted text'
+$(pwd) cd readonly "$1" "$1" done 'quoted text'
+		'quoted text' -eu x=1 test printf readonly "$@" local | printf $(pwd) 2>/dev/null
+then -eu $(pwd) local done local 'quoted text' | export && &&
+	"$1" --verbose echo then "$1" test done ${HOME} export x=1 test
+"$1" export sed && readonly
+&& then /usr/bin "$1" "$@" sed then ${HOME} done -eu --verbose
+	'quoted text' done awk /usr/bin printf readonly ${HOME} 'quoted text' --verbose
+echo --verbose "$@" | test printf local
+		"$1" local ${HOME} 2>/dev/null sed grep awk -eu $(pwd) echo "$1"
+	-eu "$1" export -eu echo 2>/dev/null
+		"$@" "$@" local $(pwd) /usr/bin printf $(pwd) awk sed -eu cd "$@"
+${HOME} cd 'quoted text' -eu
+		sed local then export readonly awk echo sed then
+		local then test done --verbose -eu ${HOME}
+echo export 2>/dev/null x=1 'quoted text' ${HOME} $(pwd)
+	sed -eu done then export grep ${HOME} awk "$@" awk grep cd ${HOME}
+		$(pwd) -eu "$@" printf 2>/dev/null "$@" then grep 'quoted text'
+cd x=1 'quoted text' x=1 cd "$@" x=1 "$@"
+	"$@" printf --verbose sed x=1 'quoted text' printf test /usr/bin /usr/bin
+	export then then sed -eu --verbose
+		sed -eu export test && 'quoted text'
+	&& "$1" done "$@" printf 2>/dev/null "$@" | | | export && export
+	| | --verbose x=1 $(pwd) then ${HOME} /usr/bin "$@" /usr/bin $(pwd) 'quoted text'
+2>/dev/null awk -eu /usr/bin test then local "$1" "$@" export export readonly
+		printf readonly && test "$@" then done sed
+	--verbose then --verbose --verbose
+export | "$1" ${HOME} 'quoted text' awk sed
+${HOME} readonly export $(pwd) x=1
+local ${HOME} $(pwd) cd ${HOME} --verbose readonly test
+	then done sed printf echo
+		/usr/bin then ${HOME} "$1" ${HOME} x=1 local readonly | &&
+		local ${HOME} "$1" ${HOME} 2>/dev/null grep "$@" done ${HOME} then printf cd local
+	2>/dev/null 2>/dev/null /usr/bin 2>/dev/null /usr/bin sed export -eu readonly printf
+		$(pwd) "$1" grep ${HOME} && done local printf --verbose grep 2>/dev/null
+		then $(pwd) 2>/dev/null awk
+x=1 ${HOME} local then test $(pwd) "$1" export 2>/dev/null | "$@"
+	grep 2>/dev/null sed export $(pwd) sed 2>/dev/null
+		'quoted text' x=1 echo grep x=1 | | | x=1 grep 'quoted text' grep export cd -eu
+		printf 2>/dev/null ${HOME} done &&
+		export test 2>/dev/null echo 'quoted text'
+		then ${HOME} local --verbose local --verbose
+		printf "$@" x=1 cd 2>/dev/null --verbose ${HOME}
+done readonly readonly done |
+	awk /usr/bin && --verbose printf | | "$@" sed 'quoted text' "$@" --verbose
+	echo | awk echo ${HOME} && local
+		-eu && --verbose readonly cd readonly done | --verbose
+		done local cd sed local done readonly test test printf /usr/bin grep export
+	x=1 && sed sed --verbose --verbose done x=1 /usr/bin x=1 | /usr/bin
+		$(pwd) --verbose ${HOME} printf printf 'quoted text'
+	printf printf ${HOME} 2>/dev/null /usr/bin grep cd readonly done
+		readonly && "$1" x=1 printf then local "$@"
+"$@" "$1" 'quoted text'
+		--verbose done $(pwd) printf
+	echo -eu ${HOME} x=1 -eu test
+done local then printf local cd grep --verbose echo /usr/bin grep
+	local | 'quoted text' $(pwd) 2>/dev/null &&
+-eu test sed "$@" --verbose && && && cd readonly
+	echo ${HOME} grep $(pwd) echo | grep && 2>/dev/null "$1" echo awk
+	"$@" --verbose ${HOME} 'quoted text' then awk | --verbose
+'quoted text' awk && 'quoted text'
+"$1" readonly echo | test -eu && /usr/bin awk
+	${HOME} "$1" grep cd "$@"
+	awk awk done --verbose done $(pwd) local "$1" "$1"
+		| then then cd echo $(pwd) local export $(pwd) $(pwd) grep awk "$@" $(pwd) test
+		| done sed ${HOME} 2>/dev/null && export echo then | then
+		"$@" 'quoted text' "$@" echo then "$@"
+	| 'quoted text' printf 2>/dev/null
+	2>/dev/null 2>/dev/null "$@" cd grep --verbose sed 'quoted text' echo
+"$1" printf | cd printf x=1 done local "$1" cd readonly
+	x=1 printf awk /usr/bin
+		done readonly local grep
+	test ${HOME} done export echo -eu grep | | awk readonly grep awk 2>/dev/null
+	| done cd done echo awk
+		"$1" done sed | cd then $(pwd) | echo 'quoted text'
+		| local printf echo 2>/dev/null grep readonly | local "$1" "$1" export test
+		sed readonly 'quoted text' printf grep "$1" grep local
+${HOME} "$@" local ${HOME} test
+		awk printf "$1" sed /usr/bin x=1 echo "$@" grep echo echo
+local 2>/dev/null && 'quoted text' done "$1" sed |
+--verbose -eu "$1" export test "$@" "$@" |
+		| | "$@" 2>/dev/null local
+	done done cd "$@" export --verbose ${HOME} then done local readonly cd /usr/bin
+	export export done --verbose grep ${HOME} "$1" export readonly "$1" x=1
+--verbose -eu local 'quoted text'
+		--verbose 2>/dev/null echo test -eu grep then 2>/dev/null
+	echo --verbose ${HOME} /usr/bin && ${HOME} done x=1 printf
+	then x=1 2>/dev/null then ${HOME} "$1" test "$1" "$1"
+	"$@" printf grep -eu $(pwd) $(pwd) done local |
+$(pwd) export -eu 2>/dev/null then
+readonly test local cd --verbose x=1 --verbose local printf -eu "$@" export
+		'quoted text' /usr/bin readonly | x=1 | cd /usr/bin
+		-eu cd 2>/dev/null test --verbose grep ${HOME} /usr/bin printf
+echo export local --verbose export
+test $(pwd) readonly "$@" --verbose 'quoted text' done --verbose
+	${HOME} x=1 grep | | x=1 done ${HOME} awk export
+		grep cd export 'quoted text' x=1 && then test grep "$@" export grep |
+		cd readonly | grep test done "$@" x=1 x=1 /usr/bin
+	${HOME} --verbose awk 'quoted text'
+echo local --verbose local "$1" 2>/dev/null /usr/bin | printf ${HOME}
+then "$@" ${HOME} readonly | && local ${HOME}
+test local | 'quoted text' grep 2>/dev/null 'quoted text' "$1" x=1 echo --verbose
+/usr/bin && $(pwd) awk x=1 /usr/bin --verbose --verbose "$1"
+	&& /usr/bin cd cd cd
+	done x=1 test /usr/bin grep --verbose
+	2>/dev/null sed | local export | | printf cd test echo && 'quoted text'
+done echo then | done $(pwd) /usr/bin awk printf grep x=1 then x=1 then
+	&& then && -eu sed && && x=1 x=1 local
+		&& grep sed cd cd ${HOME} --verbose done then export
+local 2>/dev/null cd sed -eu x=1 done /usr/bin | grep
+"$1" ${HOME} grep export /usr/bin test 'quoted text' | ${HOME} readonly
+| | awk local printf | printf
+	readonly local --verbose | sed 'quoted text'
+		grep done printf x=1 -eu export && /usr/bin
+		x=1 done "$@" x=1 ${HOME} /usr/bin export --verbose cd 'quoted text' printf printf
+	cd ${HOME} -eu export x=1 /usr/bin -eu "$1" -eu local printf "$1" /usr/bin
+	then 'quoted text' -eu "$1" /usr/bin
+	grep x=1 done /usr/bin sed --verbose done "$@" readonly ${HOME}
+	-eu x=1 awk 'quoted text' -eu x=1
+done grep export $(pwd) "$@" cd test x=1 export cd printf --verbose test
+	grep grep export --verbose local local x=1 $(pwd) 2>/dev/null
+	local export test grep /usr/bin
+	x=1 echo printf readonly grep --verbose export awk local done awk cd readonly "$1"
+		sed grep printf $(pwd) echo | -eu cd local
+	local $(pwd) --verbose sed sed | && export
+		local ${HOME} "$@" test sed echo grep && -eu local --verbose
+	"$1" readonly grep readonly
+		2>/dev/null echo && sed -eu $(pwd) local /usr/bin | printf
+x=1 done then local grep done local $(pwd) done --verbose
+	${HOME} test -eu "$@" --verbose printf
+		/usr/bin echo x=1 awk cd
+$(pwd) local && export x=1 'quoted text' 2>/dev/null readonly done 'quoted text'
+	$(pwd) "$@" -eu then test "$1" | --verbose cd -eu -eu
+	printf export then "$1" readonly local echo local "$1" then "$1" local
+export printf && -eu echo 2>/dev/null ${HOME} 'quoted text' 2>/dev/null
+	"$1" | awk done && -eu export local && --verbose ${HOME}
+		printf | local awk | then
+		'quoted text' cd $(pwd) $(pwd) /usr/bin 'quoted text' /usr/bin readonly
+	$(pwd) && local then
+2>/dev/null readonly x=1 cd sed grep local then echo 'quoted text' cd --verbose
+	done cd done export ${HOME} sed /usr/bin cd awk test cd 'quoted text'
+local | local "$@" readonly then export awk
+		echo grep cd $(pwd) --verbose export local && | echo ${HOME}
+		-eu grep /usr/bin then grep
+	&& awk then sed printf readonly sed | test -eu | readonly sed readonly x=1
+		| cd | && && ${HOME} sed done awk 'quoted text' then then x=1 2>/dev/null
+	2>/dev/null 2>/dev/null printf && -eu ${HOME} cd "$1" readonly then
+	test test 'quoted text' | readonly printf && && awk ${HOME} local --verbose
+		readonly grep cd $(pwd) x=1 ${HOME}
+	echo cd -eu && ${HOME} cd && 2>/dev/null ${HOME} done /usr/bin done sed
+		readonly then 2>/dev/null "$1" && 'quoted text' 'quoted text' export export
+	readonly local | --verbose
+	readonly done printf 2>/dev/null done x=1 -eu "$1" -eu
+'quoted text' $(pwd) grep $(pwd) ${HOME} ${HOME} then then -eu readonly echo
+2>/dev/null --verbose "$1" && cd x=1 printf --verbose --verbose readonly then readonly
+		2>/dev/null readonly "$@" printf && $(pwd)
+	-eu export echo cd -eu sed x=1
+	"$1" done | x=1 -eu test -eu | then grep grep 2>/dev/null
+-eu printf 'quoted text' grep $(pwd) grep 'quoted text'
+	printf grep $(pwd) export "$@" then grep |
+	"$1" echo readonly $(pwd) printf done sed --verbose |
+		readonly done x=1 "$@" done ${HOME} local test echo export | | local printf
+done x=1 $(pwd) test && 2>/dev/null /usr/bin then
+		readonly done && x=1 "$1" printf 'quoted text' && then test "$1" 'quoted text'
+then -eu ${HOME} echo readonly 'quoted text' ${HOME} $(pwd) local grep sed
+	| "$1" local awk echo export done -eu export 'quoted text'
+x=1 echo x=1 readonly cd $(pwd) local ${HOME}
+'quoted text' grep "$@"
+	"$@" | awk done "$1" grep 'quoted text' 2>/dev/null x=1 "$@"
+		--verbose local | x=1 export cd then test $(pwd)
+	then sed ${HOME} $(pwd) cd done 2>/dev/null echo
+		'quoted text' export ${HOME} done then local cd -eu --verbose
+		$(pwd) --verbose $(pwd) "$1" /usr/bin export
+		${HOME} awk --verbose | "$1" x=1 ${HOME} readonly
+		x=1 "$@" grep -eu 2>/dev/null done -eu readonly readonly sed readonly then &&
+	cd done $(pwd) && $(pwd) | done printf 'quoted text' sed && echo printf export
+	${HOME} 2>/dev/null export $(pwd) 'quoted text' -eu export then
+local 2>/dev/null local ${HOME}
+	done then -eu $(pwd) sed done export
+	sed local done 'quoted text' cd echo
+	sed -eu 2>/dev/null ${HOME} awk 'quoted text' -eu awk sed
+		--verbose then | awk then awk x=1 readonly awk
+grep then $(pwd) test ${HOME} printf done --verbose sed local /usr/bin
+local readonly cd /usr/bin cd readonly ${HOME} cd ${HOME} "$1" ${HOME} 2>/dev/null
+	"$1" -eu -eu ${HOME} 'quoted text' grep awk
+	then then export ${HOME}
+	&& printf /usr/bin /usr/bin
+	export "$@" 2>/dev/null --verbose 'quoted text' test
+sed echo grep printf -eu sed grep test awk done done $(pwd) cd -eu $(pwd)
+	readonly ${HOME} sed export readonly
+	readonly --verbose cd done | grep && printf
+		$(pwd) done "$@" test grep test then 2>/dev/null
+readonly 'quoted text' --verbose echo x=1 done
+		readonly test $(pwd) done 'quoted text' /usr/bin x=1 "$@" awk "$@" -eu export
+-eu cd done awk printf "$1"
+		export ${HOME} /usr/bin "$@"
+-eu 2>/dev/null 2>/dev/null "$@" cd | local x=1 --verbose x=1
+"$@" grep x=1 then grep readonly export | export $(pwd) ${HOME}
+		printf done $(pwd) /usr/bin --verbose | readonly $(pwd) | 2>/dev/null "$1" readonly
+| $(pwd) "$1" "$@" x=1 && cd /usr/bin local
+	${HOME} awk echo export test
+	readonly done export /usr/bin /usr/bin
+"$1" export sed ${HOME} "$@" /usr/bin test printf
+	$(pwd) && x=1 ${HOME} $(pwd) test "$@" local | /usr/bin | | sed local
+	cd $(pwd) export grep grep
+	readonly x=1 'quoted text' local "$1" "$@" $(pwd) $(pwd) "$@"
+		echo awk cd then -eu grep "$@"
+	export export ${HOME} $(pwd) 'quoted text' -eu x=1
+	/usr/bin --verbose /usr/bin
+"$1" "$@" $(pwd) local 2>/dev/null sed 'quoted text' x=1
+	2>/dev/null export | local "$@" readonly "$@" echo cd grep ${HOME} awk $(pwd) readonly
+	| printf $(pwd) && --verbose --verbose --verbose sed awk then echo
+	$(pwd) | --verbose export test then 'quoted text' then echo then
+	&& -eu echo ${HOME} -eu | $(pwd)
+		sed "$1" readonly awk test printf --verbose printf cd --verbose x=1 done ${HOME}
+-eu $(pwd) 2>/dev/null "$1" -eu -eu /usr/bin sed && "$1"
+		export then printf then
+	echo $(pwd) 'quoted text' awk cd done | test printf
+	grep -eu printf x=1 ${HOME} sed "$@" cd
+	$(pwd) test -eu 2>/dev/null 'quoted text'
+	&& 2>/dev/null test $(pwd) local echo
+-eu && 2>/dev/null printf sed 2>/dev/null "$1" /usr/bin local $(pwd)
+	"$@" 2>/dev/null echo "$@" /usr/bin ${HOME} $(pwd) "$@" test x=1
+		&& done "$@" done echo echo local then
+	--verbose 2>/dev/null | && | done local /usr/bin $(pwd) awk -eu && then && local
+awk | readonly 'quoted text'
+$(pwd) awk 'quoted text' ${HOME} printf then "$@" echo then export grep
+	x=1 ${HOME} "$1" test -eu then "$@"
+/usr/bin local x=1 sed "$1" x=1 && readonly 'quoted text' readonly
+		echo grep grep x=1 printf "$@" grep echo $(pwd) 2>/dev/null awk done /usr/bin
+		local printf 2>/dev/null export $(pwd) 2>/dev/null done -eu
+	done | export 2>/dev/null
+x=1 cd -eu -eu echo | 2>/dev/null "$1" $(pwd) /usr/bin
+"$@" grep 'quoted text' 2>/dev/null export
+printf readonly echo echo test $(pwd) --verbose printf --verbose readonly then
+	${HOME} readonly readonly x=1 x=1 then export local grep printf grep 2>/dev/null
+		echo awk "$1" then test /usr/bin export
+		grep "$1" test done | readonly -eu /usr/bin
+		cd | local awk $(pwd) 2>/dev/null then -eu x=1 printf local
+		readonly echo x=1 2>/dev/null printf done ${HOME} | "$@"
+		readonly readonly test printf
+-eu 2>/dev/null x=1 echo 'quoted text' printf
+&& sed awk export | 2>/dev/null
+--verbose && sed | test ${HOME}
+	-eu x=1 grep $(pwd) sed 'quoted text' test 2>/dev/null --verbose grep
+${HOME} readonly grep ${HOME}
+| -eu readonly grep && && cd "$1" done 2>/dev/null | cd
+	"$1" $(pwd) sed grep export test 2>/dev/null
+&& cd $(pwd) "$@" export grep -eu readonly "$@" printf 2>/dev/null && readonly
+	"$1" ${HOME} awk $(pwd) readonly then $(pwd) -eu --verbose
+2>/dev/null cd --verbose echo printf 2>/dev/null -eu ${HOME}
+		${HOME} -eu --verbose x=1 awk done cd test printf local export cd export export
+	awk | 'quoted text' sed readonly readonly sed
+	sed 'quoted text' && cd done && x=1 "$1" x=1 awk done
+		'quoted text' /usr/bin local readonly ${HOME} -eu cd
+	| then -eu awk cd ${HOME} 2>/dev/null
+-eu | test 2>/dev/null ${HOME} 2>/dev/null readonly "$1" test
+"$1" "$1" ${HOME} /usr/bin "$@" grep $(pwd) readonly 2>/dev/null cd readonly
+		local readonly then x=1
+2>/dev/null | $(pwd) awk cd export "$@" readonly then /usr/bin $(pwd) x=1
+		'quoted text' 2>/dev/null ${HOME} sed echo 'quoted text'
+	printf "$@" readonly | x=1
+	2>/dev/null readonly awk $(pwd) $(pwd)
+	awk && readonly readonly --verbose --verbose "$@" done
+		&& 2>/dev/null grep && echo 2>/dev/null x=1 readonly awk readonly
+		done local $(pwd) local "$1" &&
+${HOME} "$1" readonly test grep /usr/bin awk 2>/dev/null "$1"
+echo cd ${HOME} then && --verbose
+	local printf | export echo /usr/bin
+readonly | readonly /usr/bin /usr/bin
+	cd done 2>/dev/null test then done -eu x=1 test "$@"
+	export x=1 "$1" then then x=1 done echo awk "$1" 'quoted text'
+	cd "$@" local "$1" awk then "$1" echo -eu
+	2>/dev/null --verbose $(pwd)
+	| grep $(pwd) export 'quoted text' 'quoted text' && -eu /usr/bin cd | | sed local
+		grep awk 2>/dev/null 'quoted text' /usr/bin 'quoted text'
+"$1" | sed && --verbose 2>/dev/null "$1" readonly "$1" -eu sed then echo
+	awk | "$1" cd test "$1" && awk "$@" | done test test ${HOME}
+		x=1 | sed echo x=1 awk $(pwd) awk ${HOME}
+readonly local local local sed /usr/bin 'quoted text'
+		test $(pwd) readonly /usr/bin | "$1" "$1" 'quoted text' grep
+		echo readonly test /usr/bin | -eu "$1" readonly printf -eu ${HOME} printf
+		2>/dev/null awk | && test printf
+		export 'quoted text' "$1" | 'quoted text' "$@" -eu test printf printf -eu "$@"
+"$1" awk local cd sed 2>/dev/null 'quoted text' awk awk grep --verbose then |
+		-eu awk "$1" 2>/dev/null export "$@" "$@" printf printf done -eu
+	cd printf | done -eu readonly "$@" readonly echo 2>/dev/null "$1"
+	| $(pwd) printf sed && grep
+		grep "$@" && /usr/bin local
+	2>/dev/null && cd 'quoted text' readonly
+awk echo awk $(pwd) x=1 2>/dev/null grep "$@" local sed sed 'quoted text' cd grep
+	x=1 'quoted text' done echo 2>/dev/null -eu done
+		test /usr/bin echo ${HOME}
+	export /usr/bin -eu test echo readonly
+		"$@" then grep readonly awk $(pwd) readonly ${HOME} ${HOME} ${HOME} "$@"
+	x=1 -eu export "$@" /usr/bin x=1 -eu
+sed readonly && --verbose printf ${HOME} "$@" sed 2>/dev/null readonly
+	-eu echo grep echo sed
+	2>/dev/null done export sed -eu done test | echo
+		export --verbose awk sed 2>/dev/null -eu ${HOME} export
+		--verbose | "$1" cd "$@" && | awk cd 2>/dev/null
+		then then "$@" --verbose export -eu 'quoted text'
+	export 2>/dev/null awk x=1 "$1" export
+		x=1 'quoted text' sed grep awk awk awk
+sed 'quoted text' printf echo echo local 2>/dev/null /usr/bin awk
+		awk done export awk 2>/dev/null sed local printf
+"$1" sed grep awk ${HOME} | test grep 'quoted text'
+	cd cd "$1" printf /usr/bin 2>/dev/null && sed sed --verbose awk
+then sed export --verbose grep $(pwd) 2>/dev/null
+		awk done export "$1" 'quoted text' then sed printf cd $(pwd) -eu
+	"$1" grep then readonly 2>/dev/null 2>/dev/null readonly cd && test local 'quoted text'
+cd done ${HOME} printf local --verbose
+	echo grep /usr/bin "$1" | 2>/dev/null && then
+&& printf grep cd local x=1
+	x=1 $(pwd) 'quoted text'
+	x=1 grep /usr/bin export ${HOME} export --verbose -eu "$1" export
+	local 2>/dev/null && done x=1 --verbose -eu then 'quoted text' grep
+test then 2>/dev/null echo --verbose
+		${HOME} echo done 2>/dev/null "$1" | 2>/dev/null sed
+		sed awk cd grep awk ${HOME} x=1 x=1
+	grep echo "$@" | 'quoted text' --verbose readonly then $(pwd)
+grep test /usr/bin then $(pwd) echo |
+${HOME} readonly x=1 then x=1 readonly printf sed printf |
+		"$1" "$@" | | echo ${HOME} | then cd sed 2>/dev/null -eu test && &&
+	echo x=1 -eu ${HOME}
+grep then ${HOME} echo 'quoted text' sed && then done readonly
+2>/dev/null && $(pwd) grep 'quoted text' awk echo then 'quoted text'
+| 'quoted text' printf 2>/dev/null echo "$@" --verbose
+	${HOME} "$1" "$@" awk ${HOME} x=1 awk
+		2>/dev/null then local -eu sed local
+	grep echo x=1 x=1 'quoted text'
+		--verbose /usr/bin x=1 awk x=1
+		"$@" 'quoted text' "$@" && "$1"
+		'quoted text' && | local
+		grep grep echo local local grep ${HOME} --verbose done 2>/dev/null
+		$(pwd) --verbose done local --verbose --verbose awk
+	"$1" $(pwd) /usr/bin 'quoted text' export -eu
+		test "$1" --verbose grep readonly test awk cd local readonly 'quoted text' -eu
+$(pwd) /usr/bin /usr/bin 'quoted text' awk /usr/bin --verbose 2>/dev/null
+local local /usr/bin && ${HOME}
+readonly then cd "$1" sed 2>/dev/null "$1" ${HOME}
+	2>/dev/null test | 2>/dev/null 2>/dev/null $(pwd) "$@" 'quoted text'
+		2>/dev/null cd && sed "$1" grep "$1" cd sed echo x=1
+		'quoted text' -eu cd then && test readonly /usr/bin readonly test 'quoted text'
+done --verbose sed grep echo local ${HOME}
+readonly readonly $(pwd) test 'quoted text' "$@" |
+awk sed --verbose -eu $(pwd) test
+sed "$1" echo awk 'quoted text' grep cd $(pwd) test $(pwd)
+	x=1 -eu printf | local echo /usr/bin $(pwd) -eu local x=1 ${HOME} "$1" --verbose
+		awk printf --verbose $(pwd) -eu x=1 printf awk done sed && ${HOME} export |
+export $(pwd) /usr/bin then /usr/bin /usr/bin sed printf
+$(pwd) readonly --verbose "$1" grep --verbose
+		done 'quoted text' local
+		sed test then $(pwd)
+		sed $(pwd) x=1 local "$1" /usr/bin && readonly then readonly
+	| "$@" done local then done done --verbose
+	cd -eu 2>/dev/null ${HOME} "$1" x=1 printf
+		/usr/bin test /usr/bin | -eu sed test --verbose sed && "$1" local "$@" 'quoted text'
+local readonly 2>/dev/null x=1
+done grep | && cd local cd x=1 cd && grep then cd local --verbose printf "$@"
+	echo echo x=1 -eu export -eu
+	cd test "$1" /usr/bin local then readonly awk then echo
+	awk 'quoted text' printf "$@" ${HOME} grep then $(pwd) done then
+	&& export export done cd x=1 then --verbose
+		| test printf -eu echo 'quoted text' test printf ${HOME} x=1
+--verbose "$@" ${HOME}
+	test done 2>/dev/null --verbose printf ${HOME} "$1" done | -eu -eu local sed test
+		export printf printf local ${HOME}
+		cd | awk ${HOME} done echo
+	export 'quoted text' "$1"
+		awk readonly printf -eu done readonly grep $(pwd) test 2>/dev/null
+$(pwd) then x=1 grep 2>/dev/null && 'quoted text'
+	x=1 test local && x=1 $(pwd) done readonly | 2>/dev/null ${HOME}
+	| && --verbose /usr/bin done then echo "$@" awk awk $(pwd) readonly local
+2>/dev/null && then then
+		'quoted text' | ${HOME} --verbose $(pwd) readonly "$1" x=1 test && awk "$1" 2>/dev/null
+	local readonly sed export test | printf
+	| -eu printf && && 2>/dev/null
+	done sed $(pwd) done grep ${HOME}
+--verbose readonly x=1 "$1" awk done readonly test --verbose
+local local 2>/dev/null "$@" ${HOME} test "$@"
+		awk test grep && --verbose $(pwd) printf && x=1 $(pwd) 2>/dev/null
+		awk grep grep 2>/dev/null local
+		export "$1" | "$@" local 2>/dev/null
+-eu then sed sed -eu local 'quoted text' && export printf x=1 -eu "$@"
+--verbose --verbose test | | 'quoted text' awk export 2>/dev/null 'quoted text'
+"$1" -eu grep ${HOME} /usr/bin sed
+	/usr/bin --verbose 2>/dev/null
+		cd done cd 'quoted text'
+		/usr/bin -eu --verbose printf ${HOME} "$@" -eu
+		cd 2>/dev/null grep grep "$@" && sed test grep | ${HOME} x=1 then awk
+x=1 && readonly && x=1 'quoted text' --verbose "$1" printf readonly
+2>/dev/null echo done --verbose --verbose ${HOME} then /usr/bin && "$1"
+	cd readonly -eu echo x=1 local "$@" $(pwd)
+		grep readonly then "$1" ${HOME} echo sed --verbose
+	/usr/bin /usr/bin local test test test sed awk -eu echo sed
+2>/dev/null --verbose awk sed echo readonly && test
+		printf 'quoted text' | cd 'quoted text' then 'quoted text' && 2>/dev/null
+	"$1" && ${HOME} 'quoted text' echo readonly local "$1" readonly && grep grep
+sed "$@" readonly grep "$1" && cd "$@" &&
+	x=1 "$1" /usr/bin echo done cd "$1" --verbose grep 2>/dev/null "$1" awk awk local
+	"$1" "$@" readonly export printf /usr/bin grep echo -eu sed
+		${HOME} done echo "$1" printf "$1" readonly test 'quoted text'
+	"$1" "$@" echo /usr/bin x=1 "$@" $(pwd)
+	-eu /usr/bin cd "$1" | done then $(pwd) printf export done printf "$@"
+${HOME} "$@" printf cd test -eu "$@" && then /usr/bin printf
+		test export done test | printf --verbose
+		sed ${HOME} export | $(pwd) test
+		"$1" ${HOME} then | ${HOME} "$1" export &&
+	export /usr/bin 2>/dev/null export "$1" /usr/bin
+		"$1" local export --verbose | grep echo "$1" 2>/dev/null grep 'quoted text'
+		"$1" done test readonly echo | | /usr/bin /usr/bin
+		done "$1" $(pwd) done sed && --verbose "$1" awk "$@" "$@" --verbose
+$(pwd) done export grep 'quoted text' sed | done
+		done 'quoted text' cd export ${HOME} grep cd 'quoted text'
+printf done cd /usr/bin "$@" ${HOME} $(pwd) awk echo printf cd
+	readonly sed | awk test ${HOME} | "$1" 'quoted text' |
+		then awk ${HOME} "$@" echo ${HOME}
+then export 2>/dev/null grep done grep "$1"
+		$(pwd) echo -eu "$1" cd local echo test 2>/dev/null then export
+	grep echo "$@" done test && sed printf x=1 done local ${HOME} $(pwd)
+done "$@" "$1" then 2>/dev/null then
+		awk 'quoted text' test cd x=1 | then
+		then sed awk then done then cd then awk ${HOME} --verbose
+		printf ${HOME} -eu /usr/bin "$1" printf
+	'quoted text' echo printf ${HOME} x=1 -eu
+		"$1" && done export grep cd sed local cd x=1 --verbose local /usr/bin
+		cd grep -eu | && x=1 'quoted text'
+		then ${HOME} "$@" "$@" export done export printf
+	| --verbose sed x=1 local test x=1 grep export grep "$@" "$1"
+	readonly "$1" "$1" export
+		grep then $(pwd) done 2>/dev/null x=1 && | printf echo "$1" 2>/dev/null local
+		'quoted text' cd 2>/dev/null
+		--verbose test cd 2>/dev/null 'quoted text'
+		-eu -eu && done readonly local x=1 then x=1 printf
+		--verbose done done sed local local && 'quoted text' --verbose -eu grep readonly
+	${HOME} sed readonly then
+local && --verbose sed grep sed /usr/bin
+"$1" -eu grep && printf export "$1" readonly then then "$@" sed local x=1
+		test "$1" "$@" export 'quoted text' local ${HOME} 2>/dev/null | awk
+	done printf && then export -eu && sed then /usr/bin cd export --verbose
+		$(pwd) local "$1" printf
+	2>/dev/null then 'quoted text' | 2>/dev/null grep $(pwd)
+&& -eu "$@" echo "$1" printf cd "$@" -eu --verbose grep | done
+	"$1" readonly $(pwd) test echo test sed local | "$1" readonly 2>/dev/null
+2>/dev/null $(pwd) then 2>/dev/null echo
+	"$@" readonly | 2>/dev/null done cd grep -eu --verbose
+	${HOME} local then "$@" awk -eu sed local printf done x=1 ${HOME} echo done
+&& -eu printf local local sed local cd "$@" 2>/dev/null readonly
+	grep done && export $(pwd) x=1 && cd cd grep done
+	"$@" "$1" x=1 test cd then
+${HOME} "$@" && awk export local 2>/dev/null
+		cd export 2>/dev/null grep readonly grep then x=1 grep x=1 then "$1"
+		--verbose echo "$@" /usr/bin printf
+readonly echo cd sed awk --verbose x=1 grep grep cd done 'quoted text'
+echo --verbose sed "$@" grep 'quoted text' &&
+	--verbose && 2>/dev/null
+printf && readonly grep && --verbose printf readonly then readonly grep grep
+		cd then readonly echo test export
+"$@" echo grep readonly "$@" 'quoted text' echo
+		printf /usr/bin && then sed local done done export 'quoted text' $(pwd) done
+		&& "$1" 'quoted text' $(pwd) $(pwd) && x=1 $(pwd) printf cd ${HOME} 2>/dev/null
+	then ${HOME} ${HOME} then cd test then ${HOME} --verbose grep then test
+	"$1" x=1 then x=1 then --verbose local $(pwd) readonly $(pwd) 'quoted text' "$@"
+	--verbose 'quoted text' done "$@" awk -eu export readonly &&
+		printf cd sed grep "$1" grep $(pwd) sed test "$1" x=1 awk
+		sed "$@" awk x=1 test export
+		done test local --verbose ${HOME} ${HOME}
+	then "$@" then /usr/bin done ${HOME} cd printf awk local done grep --verbose
+		test test test && "$@" "$@" echo 'quoted text'
+	awk 2>/dev/null local cd grep printf | -eu 2>/dev/null "$@"
+		&& sed 'quoted text' echo
+		| export x=1 ${HOME} "$@" sed done "$@" "$1" grep test local awk --verbose readonly
+	printf $(pwd) cd then 'quoted text' --verbose $(pwd) "$@" local
+		readonly export export grep cd echo done $(pwd) /usr/bin done local $(pwd) | 2>/dev/null
+	readonly "$@" local readonly 'quoted text'
+	cd readonly -eu readonly x=1 $(pwd) -eu 'quoted text' --verbose "$@" x=1 echo 'quoted text'
+		'quoted text' test && echo --verbose echo done "$1" 'quoted text' "$@" printf
+		grep --verbose awk then 2>/dev/null awk --verbose export readonly printf
+/usr/bin "$@" /usr/bin test awk printf cd | echo ${HOME} 'quoted text'
+sed echo x=1 done local --verbose x=1 grep test awk ${HOME} grep -eu
+		printf "$1" sed 2>/dev/null
+	test ${HOME} $(pwd) 2>/dev/null
+readonly done 'quoted text' 2>/dev/null cd then | "$@" then -eu $(pwd)
+	&& "$@" 'quoted text' "$@" "$@" "$1" -eu $(pwd) -eu
+	| 2>/dev/null readonly "$1" --verbose
+	| cd "$1" echo "$@" readonly x=1 printf printf readonly x=1 done echo "$1"
+	2>/dev/null printf sed cd "$@" | ${HOME} "$1" -eu grep awk grep
+echo then /usr/bin echo then
+	test "$@" readonly local
+sed local sed readonly done sed && -eu "$1" done cd echo "$@" --verbose
+"$@" readonly | echo && --verbose
+	--verbose ${HOME} ${HOME} $(pwd) done $(pwd) 'quoted text' printf grep done /usr/bin
+	echo export test awk local grep --verbose x=1 ${HOME} cd
+		readonly && readonly "$@" grep readonly "$@"
+	done done $(pwd) -eu 2>/dev/null awk && test x=1 awk echo 'quoted text'
+		'quoted text' /usr/bin then
+&& local 'quoted text' -eu awk awk && then x=1 then readonly grep | $(pwd)
+		done sed done export -eu test cd --verbose
+	"$1" $(pwd) -eu then export sed awk
+printf -eu x=1 printf sed ${HOME} "$1"
+		x=1 "$@" "$1" && 'quoted text' grep | export printf
+&& readonly test local then awk cd echo /usr/bin x=1 sed
+printf x=1 echo sed $(pwd) then sed
+	then --verbose /usr/bin ${HOME} 'quoted text'
+		export 'quoted text' cd grep | $(pwd) | test 'quoted text' "$1" ${HOME}
+		grep x=1 then "$@" 2>/dev/null
+&& printf echo x=1 test local
+	readonly | cd ${HOME} x=1 echo $(pwd) "$1" ${HOME} "$@" grep | "$@" cd awk "$1"
+	grep 2>/dev/null /usr/bin x=1 --verbose awk awk then -eu && ${HOME}
+		'quoted text' ${HOME} local | && -eu "$1" /usr/bin
+	export export "$1" | /usr/bin --verbose 2>/dev/null
+		"$@" --verbose local sed printf sed export printf echo --verbose
+	cd "$1" $(pwd) grep test && cd --verbose
+	export x=1 && test ${HOME} x=1 export
+	"$1" && readonly local && x=1 && then /usr/bin $(pwd) 'quoted text'
+	"$1" echo && sed done grep local readonly -eu
+	awk x=1 test "$1" cd echo cd local && echo readonly printf
+		&& -eu printf export 2>/dev/null awk --verbose $(pwd) awk done "$@" 'quoted text'
+	echo | echo sed ${HOME} awk 2>/dev/null "$1" -eu echo "$@" "$@" grep 'quoted text'
+		x=1 local readonly /usr/bin ${HOME} local
+	then "$1" cd printf grep done echo "$@" x=1 then
+printf awk 2>/dev/null export cd $(pwd) readonly awk then printf
+	x=1 /usr/bin export then export && "$@" readonly awk | printf && printf
+cd -eu 2>/dev/null "$@" printf test /usr/bin --verbose -eu | 'quoted text'
+sed && then then grep local /usr/bin readonly done --verbose x=1
+		-eu 2>/dev/null x=1 done then then
+local local done -eu 2>/dev/null -eu -eu 'quoted text'
+		done 2>/dev/null done cd awk echo test
+	-eu x=1 2>/dev/null done sed done 2>/dev/null
+readonly cd export x=1 echo "$1" awk 'quoted text'
+		done grep "$@" --verbose
+--verbose local cd local echo "$@" done | $(pwd) then
+	"$@" --verbose --verbose then test grep then /usr/bin printf 2>/dev/null then
+echo $(pwd) -eu -eu local awk 2>/dev/null
+echo readonly done readonly
+	"$@" /usr/bin 'quoted text' "$@" echo echo && && | "$1" local
+grep printf "$1" awk "$1" /usr/bin
+		x=1 local then && export -eu then /usr/bin /usr/bin local awk $(pwd) "$@" cd
+	local local x=1 2>/dev/null then export readonly export 'quoted text' 2>/dev/null
+	/usr/bin readonly -eu cd export ${HOME} awk echo then readonly
+	-eu awk -eu echo printf $(pwd) sed "$1" "$1" echo | done "$1" cd 'quoted text' &&
+	&& readonly 'quoted text' $(pwd) echo x=1 -eu --verbose printf
+	then test "$1" --verbose
+		x=1 export 'quoted text' sed --verbose $(pwd) | sed --verbose -eu
+	export x=1 test grep && export cd --verbose "$1" local cd grep 'quoted text'
+"$1" export x=1 done /usr/bin "$@" | ${HOME} 'quoted text'
+		awk /usr/bin /usr/bin local echo 2>/dev/null
+		${HOME} sed readonly test readonly local export -eu readonly
+	2>/dev/null "$1" grep then $(pwd) && "$@" done /usr/bin
+		| then | then awk printf && export $(pwd) /usr/bin readonly && $(pwd) local
+		cd export grep test ${HOME} ${HOME} test 2>/dev/null --verbose
+	printf && readonly grep echo | sed | grep then sed awk | ${HOME} awk | "$1"
+grep "$1" 2>/dev/null | printf
+printf printf /usr/bin "$@" then "$1" then $(pwd) -eu sed
+	&& /usr/bin cd $(pwd) test 'quoted text'
+	grep grep local && x=1 --verbose ${HOME} /usr/bin readonly | local readonly
+	test done 'quoted text' grep done ${HOME} done export $(pwd) grep done local
+	printf then "$1" "$1" test echo --verbose --verbose ${HOME}
+sed local sed -eu 'quoted text' 'quoted text'
+/usr/bin readonly readonly "$@" grep readonly export 'quoted text'
+		test $(pwd) /usr/bin "$1" "$@" | 2>/dev/null -eu 2>/dev/null --verbose
+/usr/bin grep $(pwd) awk | awk $(pwd) test readonly export local
+--verbose sed | 2>/dev/null
+	grep then --verbose "$@"
+		then && then "$@" export
+		x=1 && | x=1 ${HOME} done cd 'quoted text' "$@" test x=1 printf ${HOME}
+	&& done then $(pwd) 2>/dev/null echo awk export x=1 export x=1 "$1"
+		"$1" "$@" | "$@" $(pwd) 'quoted text' test /usr/bin
+readonly test local local test test awk "$@" x=1 done "$1" $(pwd)
+		| /usr/bin --verbose cd "$@" $(pwd)
+	printf "$@" -eu 2>/dev/null /usr/bin printf printf local test sed cd $(pwd)
+		-eu grep ${HOME} local | printf -eu x=1 test --verbose
+		&& local && -eu cd printf "$@" grep
+		local "$1" --verbose | export done readonly echo | $(pwd) cd
+		'quoted text' echo -eu 'quoted text' echo sed x=1 printf 'quoted text'
+		$(pwd) done export | x=1 export
+	| 2>/dev/null export 2>/dev/null x=1 "$1" local 2>/dev/null
+echo -eu /usr/bin sed /usr/bin export readonly /usr/bin
+	export cd grep 'quoted text' x=1 printf export local sed export
+		-eu cd grep cd 'quoted text' | done "$1" 'quoted text' --verbose test x=1
+		export 2>/dev/null -eu awk
+	"$1" sed ${HOME} awk | test x=1
+		2>/dev/null -eu x=1 grep echo
+	export grep x=1 readonly export "$1" export test 'quoted text'
+		local test export /usr/bin echo 2>/dev/null
+	export "$1" x=1 cd "$1" printf then /usr/bin "$@" 2>/dev/null -eu --verbose printf
+x=1 --verbose "$1" sed done 2>/dev/null sed echo
+	printf | grep sed then printf && grep then --verbose && | -eu printf cd echo
+		2>/dev/null ${HOME} local awk -eu
+printf printf 'quoted text' printf /usr/bin "$1" /usr/bin
+		x=1 "$@" | && /usr/bin awk grep printf ${HOME} printf cd && 2>/dev/null awk grep
+	then --verbose sed local awk readonly && sed "$1" 2>/dev/null
+	echo export x=1 x=1 then --verbose
+	"$1" export then done printf then test 'quoted text' sed
+	sed cd "$@" grep "$1" /usr/bin grep awk cd x=1
+local grep awk local awk $(pwd) then 'quoted text'
+--verbose echo 2>/dev/null cd 2>/dev/null | test export /usr/bin -eu --verbose
+&& grep cd | export | local /usr/bin x=1 readonly && $(pwd)
+	echo x=1 grep done -eu
+$(pwd) "$@" x=1 test "$1" ${HOME} sed
+	sed 2>/dev/null $(pwd) sed local "$@" ${HOME} test local
+		&& export readonly && sed printf grep "$1" "$@" test local
+	&& && | 'quoted text' $(pwd) test | && --verbose done 2>/dev/null | 2>/dev/null
+2>/dev/null $(pwd) export -eu --verbose
+	test "$1" printf cd "$1" 'quoted text' done cd | 'quoted text'
+x=1 echo export awk awk cd awk && -eu awk export
+&& | "$@" --verbose /usr/bin
+	&& local | "$@" local "$@" 2>/dev/null && | printf $(pwd) | cd "$@" test
+	x=1 done cd grep printf 2>/dev/null sed x=1 "$1" local sed
+		$(pwd) 2>/dev/null awk
+	&& export readonly sed printf test test cd cd x=1
+-eu x=1 x=1 readonly echo
+	then 2>/dev/null /usr/bin export 2>/dev/null export
+echo && done x=1 2>/dev/null test sed -eu done
+	then readonly echo echo /usr/bin -eu "$1" -eu /usr/bin /usr/bin cd ${HOME}
+		readonly printf awk local --verbose
+then && 'quoted text' $(pwd) $(pwd) ${HOME} done
+		grep "$@" done --verbose done printf
+	"$1" then | readonly test "$@" export -eu printf 'quoted text' awk grep /usr/bin
+echo $(pwd) done printf export awk test
+&& awk test x=1 && test | done "$1" $(pwd) grep echo local
+		awk echo then printf "$1" test printf && printf sed -eu | x=1
+x=1 local readonly cd ${HOME} |
+-eu test awk sed grep | /usr/bin grep "$@" test
+'quoted text' x=1 local local "$1" sed printf then "$1" grep awk awk grep grep
+		then "$1" "$@" cd done sed export "$1" awk local test ${HOME}
+&& /usr/bin awk sed cd $(pwd)
+		local /usr/bin grep printf "$1" $(pwd) grep sed export
+	done -eu done 2>/dev/null | 2>/dev/null readonly
+		test "$1" ${HOME} done readonly
+printf $(pwd) awk done grep x=1 /usr/bin ${HOME} cd awk readonly
+grep --verbose awk && 'quoted text'
+		printf ${HOME} cd readonly 'quoted text'
+		grep done --verbose && then -eu grep test |
+	2>/dev/null x=1 $(pwd) /usr/bin cd && --verbose && | | -eu test "$1"
+	test sed "$@" test | export | -eu && $(pwd)
+sed $(pwd) echo "$1" /usr/bin
+	echo ${HOME} then printf && --verbose done "$1"
+	&& $(pwd) 'quoted text' test | x=1 -eu awk test $(pwd) -eu cd local x=1
+		readonly 'quoted text' | readonly ${HOME}
+		local 'quoted text' x=1 awk echo x=1 echo --verbose
+readonly /usr/bin "$@" test /usr/bin grep readonly awk awk -eu
+		$(pwd) $(pwd) echo sed -eu "$1" 'quoted text' $(pwd) test
+		then ${HOME} -eu ${HOME} cd $(pwd) grep then --verbose
+		cd sed done | test then cd then echo grep export
+	local "$1" grep /usr/bin $(pwd) &&
+		awk x=1 done ${HOME} cd /usr/bin export cd
+"$1" $(pwd) printf 'quoted text' export "$@"
+awk 'quoted text' --verbose $(pwd) export && done printf -eu "$@" then awk
+	-eu | | | && 'quoted text' && cd test 2>/dev/null sed 'quoted text'
+	readonly /usr/bin then test && x=1 readonly 'quoted text' done x=1 --verbose
+echo local | x=1 readonly cd sed readonly grep | | echo readonly readonly
+		"$1" "$1" && | "$1" awk sed x=1 done test --verbose local x=1 test done test
+		test --verbose /usr/bin done sed ${HOME} --verbose &&
+		awk "$1" grep && local /usr/bin &&
+	--verbose export grep sed -eu "$1" ${HOME}
+	printf x=1 sed awk printf "$@" --verbose -eu printf awk 2>/dev/null
+		--verbose sed local awk "$1" test 'quoted text' cd done local
+	$(pwd) /usr/bin x=1 local "$1"
+		/usr/bin local | x=1 2>/dev/null local sed
+&& readonly $(pwd) --verbose
+		$(pwd) grep readonly --verbose grep | printf /usr/bin then | done
+		echo "$1" "$1" "$@" grep "$@"
+local export cd | "$@" && done
+readonly cd export "$1" awk cd readonly local 'quoted text'
+	cd "$1" export test done
+		$(pwd) x=1 done --verbose --verbose /usr/bin x=1
+	| printf ${HOME} | export
+		$(pwd) local x=1 export done awk echo | $(pwd) done $(pwd) test /usr/bin
+"$@" -eu local --verbose readonly sed /usr/bin printf
+		local 2>/dev/null done printf ${HOME} 'quoted text' readonly
+	cd printf local test test | 'quoted text' 2>/dev/null
+cd cd /usr/bin readonly export | sed --verbose /usr/bin x=1 && && | done /usr/bin
+	&& | -eu -eu | then printf then "$1" readonly
+	"$1" local printf ${HOME} awk "$@" local --verbose test | -eu local readonly export
+	/usr/bin awk "$@" 'quoted text' test
+		$(pwd) 2>/dev/null ${HOME} --verbose export sed grep 'quoted text'
+		cd export done -eu echo -eu grep /usr/bin ${HOME}
+	echo "$@" awk x=1 ${HOME}
+$(pwd) "$1" test ${HOME} /usr/bin
+local awk "$1" 2>/dev/null /usr/bin "$@" -eu
+		local export "$1" -eu -eu local 'quoted text'
+	-eu awk then 2>/dev/null -eu | ${HOME}
+-eu printf "$1" x=1 /usr/bin export -eu
+	printf "$@" done "$1" | printf
+"$1" local /usr/bin export local printf awk "$@" -eu
+	sed "$@" cd 2>/dev/null local
+	grep /usr/bin export 2>/dev/null
+awk 2>/dev/null cd local grep 2>/dev/null
+	cd -eu test /usr/bin && grep | awk sed then && --verbose 'quoted text'
+sed echo export 'quoted text' grep && export
+	then 2>/dev/null test && | x=1 awk 'quoted text' $(pwd) x=1 $(pwd) echo echo awk
+sed | cd -eu local then 2>/dev/null
+		echo done awk readonly echo -eu echo "$@" sed "$@" $(pwd) -eu
+cd -eu printf "$@" local --verbose 'quoted text' -eu && export ${HOME}
+	x=1 grep readonly --verbose "$@"
+2>/dev/null -eu x=1 'quoted text' local printf
+		/usr/bin sed && x=1 export sed --verbose cd "$@"
+		'quoted text' local export "$1" echo /usr/bin sed awk test -eu 'quoted text'
+		then done | 2>/dev/null sed then $(pwd)
+	sed export awk $(pwd) cd then | $(pwd) 2>/dev/null --verbose && $(pwd)
+		2>/dev/null echo done /usr/bin "$1" grep
+'quoted text' test 2>/dev/null cd
+		test grep readonly cd ${HOME} "$1" /usr/bin test -eu then local
+	readonly then grep done echo -eu grep export test "$1" 'quoted text'
+		/usr/bin cd done then ${HOME} $(pwd)
+	'quoted text' echo --verbose local ${HOME} readonly 'quoted text'
+		--verbose then printf 'quoted text' $(pwd)
+done echo done $(pwd) then x=1 echo grep 'quoted text' export -eu x=1 echo
+	printf local x=1 /usr/bin --verbose -eu
+cd 2>/dev/null x=1 'quoted text' echo "$1" readonly echo then export
+$(pwd) then x=1 printf readonly grep 2>/dev/null local echo
+		local /usr/bin done "$1"
+		${HOME} grep && "$1" local sed
+	cd done && test --verbose awk
+	test x=1 | | test echo printf
+		"$1" awk cd done test 'quoted text' --verbose then cd readonly test awk test $(pwd)
+		done -eu sed -eu $(pwd) && 2>/dev/null -eu x=1 test awk readonly
+		-eu --verbose $(pwd) readonly test awk "$@" --verbose
+		awk 'quoted text' grep -eu --verbose export $(pwd) x=1 printf
+		$(pwd) done test then test
+		echo | awk && done && "$@" | $(pwd)
+		x=1 readonly sed /usr/bin local $(pwd) -eu $(pwd) echo local "$@" readonly
+'quoted text' awk && done sed /usr/bin done
+	printf printf | -eu --verbose
+	local 'quoted text' awk -eu --verbose printf readonly readonly | then then
+$(pwd) 'quoted text' awk x=1 done
+		"$@" x=1 $(pwd) readonly echo cd && test --verbose
+awk readonly ${HOME} readonly
+	then $(pwd) --verbose -eu sed done "$1" -eu $(pwd) x=1 test
+		--verbose export cd | grep 'quoted text' /usr/bin
+x=1 awk then cd 'quoted text'
+		export echo done cd printf sed sed readonly cd 2>/dev/null /usr/bin done
+		export "$@" awk -eu "$1" "$@" -eu sed $(pwd)
+		sed cd -eu x=1 done x=1 x=1 readonly --verbose
+&& x=1 "$@" printf printf sed 2>/dev/null
+awk $(pwd) && -eu 'quoted text' done | local x=1 grep | $(pwd) readonly
+awk local echo --verbose cd echo then local --verbose
+		-eu awk x=1 printf -eu "$1" printf sed local 2>/dev/null
+	&& | /usr/bin sed echo awk $(pwd)
+	/usr/bin done local echo x=1 'quoted text' && /usr/bin
+${HOME} ${HOME} grep 2>/dev/null
+		"$@" $(pwd) $(pwd) test export
+		&& -eu && && sed test && awk 2>/dev/null "$@" 'quoted text' x=1
+		sed -eu export $(pwd) sed sed printf ${HOME} test done export /usr/bin sed local
+		grep x=1 sed echo export test "$@" then 'quoted text' x=1 "$1" grep
+	local $(pwd) grep --verbose grep $(pwd) then awk export "$@" cd 2>/dev/null
+readonly -eu --verbose sed --verbose 'quoted text' awk
+&& sed /usr/bin test done sed readonly && /usr/bin ${HOME} local
+	'quoted text' ${HOME} "$1" then sed done then --verbose "$1" --verbose
+		| then | test then | $(pwd) && | 2>/dev/null ${HOME} echo then export "$1"
+local readonly readonly && && /usr/bin ${HOME} echo sed
+"$@" readonly ${HOME} x=1 then sed echo export && local cd done then
+		test local then readonly | readonly
+		-eu cd /usr/bin local then --verbose 'quoted text' 2>/dev/null awk --verbose --verbose
+readonly cd ${HOME} done cd /usr/bin -eu then 2>/dev/null
+&& printf local 2>/dev/null && "$1" &&
+		awk 'quoted text' 2>/dev/null export /usr/bin local awk --verbose
+	done 'quoted text' /usr/bin
+test "$1" done "$1" && --verbose
+	export 2>/dev/null then then awk done "$@" 'quoted text' then echo "$@" 2>/dev/null
+	"$1" ${HOME} 2>/dev/null -eu test /usr/bin -eu test
+done then test export ${HOME}
+export 2>/dev/null test /usr/bin | awk echo ${HOME}
+'quoted text' sed 'quoted text' --verbose
+/usr/bin sed local && 2>/dev/null readonly echo -eu readonly cd echo done
+		readonly echo sed -eu && 'quoted text' | printf "$1" x=1 echo awk 'quoted text'
+		grep && sed test cd awk 2>/dev/null readonly test
+		awk /usr/bin $(pwd) --verbose /usr/bin "$@" && sed awk 'quoted text' /usr/bin
+	cd --verbose "$@" 'quoted text' done readonly 2>/dev/null
+	readonly awk test $(pwd) export && 'quoted text' ${HOME}
+2>/dev/null x=1 grep printf "$1" echo sed 'quoted text'
+${HOME} echo grep -eu 'quoted text' -eu
+readonly --verbose test ${HOME} test ${HOME} && sed test &&
+	'quoted text' then readonly && "$@" cd /usr/bin test
+		cd awk $(pwd) --verbose 'quoted text'
+	"$@" test grep sed cd readonly $(pwd) export echo x=1 printf x=1 cd done
+export --verbose $(pwd) test "$1" done x=1 export
+	local cd echo x=1 /usr/bin /usr/bin awk readonly
+readonly 'quoted text' grep
+	printf awk done readonly | "$1" x=1
+		| ${HOME} $(pwd) --verbose test -eu export
+		printf 2>/dev/null 2>/dev/null awk local local ${HOME} "$1" x=1 printf
+'quoted text' && "$@" test "$@" ${HOME} echo ${HOME} test local
+#include c58.sh
+	'quoted text' 2>/dev/null "$1" | test printf
+	sed printf "$1" 'quoted text' /usr/bin && sed export then sed
+	export test cd echo -eu &&
+		'quoted text' "$1" "$@" grep cd awk "$1"
+export sed 'quoted text' printf readonly $(pwd) "$1" 2>/dev/null "$1" echo x=1
+x=1 --verbose sed test local export readonly echo 'quoted text' -eu grep
+	then export ${HOME} sed then 2>/dev/null
+		readonly readonly 2>/dev/null printf grep cd | echo "$@" cd echo --verbose sed
+	readonly awk x=1 -eu export
+sed local ${HOME} local
+		awk | x=1 done test awk
+	2>/dev/null "$1" readonly sed --verbose awk then
+	"$@" awk x=1 'quoted text' done && $(pwd) "$1" "$@" export export local export
+	&& 2>/dev/null --verbose grep && && | test readonly export | printf
+	-eu echo cd grep sed cd test export -eu --verbose export
+		done printf ${HOME} "$1" local cd local
+		'quoted text' | ${HOME} sed readonly then cd then -eu test
+		local local /usr/bin 'quoted text' then readonly --verbose
+		done test x=1 cd test ${HOME} test done local
+cd x=1 $(pwd) test awk test 'quoted text' cd x=1
+		awk printf printf | grep awk test --verbose 2>/dev/null
+		--verbose export local x=1 $(pwd) /usr/bin
+$(pwd) 2>/dev/null readonly awk --verbose
+readonly test $(pwd) 2>/dev/null $(pwd)
+		-eu "$1" /usr/bin done x=1 then | local "$@" -eu 2>/dev/null test "$1" echo then
+		then readonly 'quoted text' cd done
+	awk ${HOME} --verbose sed x=1 then awk $(pwd)
+	"$1" export -eu local /usr/bin
+	export printf -eu grep && then x=1 sed
+		"$1" readonly && printf awk 'quoted text' echo ${HOME}
+		"$@" echo then local printf printf "$@" -eu && grep echo awk done printf local
+awk --verbose -eu cd && done "$1" sed sed
+grep && $(pwd) echo test export done x=1 && test cd 2>/dev/null
+		x=1 x=1 done test sed -eu
+	test x=1 /usr/bin "$1" "$@"
+local export | -eu export -eu readonly
+$(pwd) --verbose echo /usr/bin -eu --verbose -eu /usr/bin
+		then sed /usr/bin done sed --verbose local grep "$1" grep export $(pwd) && test
+		${HOME} readonly cd cd printf
+		&& 'quoted text' 2>/dev/null cd echo x=1 /usr/bin done 2>/dev/null /usr/bin
+		${HOME} echo "$@" test x=1 "$@" local export /usr/bin /usr/bin -eu $(pwd) cd
+	echo "$@" x=1 printf awk grep sed 2>/dev/null /usr/bin -eu 'quoted text'
+	"$@" local /usr/bin -eu | | -eu echo export sed sed sed awk 2>/dev/null "$@" "$1"
+	"$1" readonly echo then | local "$1" export then readonly --verbose
+		sed printf -eu $(pwd) then printf
+local --verbose $(pwd) 'quoted text' test /usr/bin awk ${HOME}
+--verbose x=1 -eu $(pwd) -eu ${HOME} /usr/bin 2>/dev/null grep "$1"
+	cd ${HOME} grep sed --verbose
+	"$1" 'quoted text' $(pwd) test
+x=1 readonly ${HOME} ${HOME} && local && sed readonly && done 2>/dev/null
+then echo readonly 'quoted text' x=1 local x=1 printf $(pwd) 2>/dev/null
+grep cd $(pwd) readonly && awk 2>/dev/null
+		then local readonly then
+done x=1 "$1" echo then sed "$1" local
+awk echo printf && printf sed $(pwd)
+		-eu printf $(pwd) -eu 'quoted text' $(pwd) /usr/bin
+2>/dev/null "$@" "$1" | echo done grep x=1 'quoted text'
+	done --verbose "$1" "$@" ${HOME} sed done export 'quoted text'
+--verbose done $(pwd) --verbose ${HOME} "$1" export
+		grep 'quoted text' | done
+readonly 2>/dev/null awk printf && test && printf && echo /usr/bin awk
+$(pwd) | grep export --verbose cd printf | 2>/dev/null
+| done printf test awk local 2>/dev/null
+	x=1 ${HOME} then sed "$@" printf /usr/bin awk
+	awk 'quoted text' local "$1" awk readonly "$1" cd then printf $(pwd)
+		$(pwd) "$@" export | "$@" awk 'quoted text' $(pwd)
+| done printf 'quoted text' sed
+	/usr/bin $(pwd) grep | local sed "$1" then "$1" ${HOME} export
+-eu "$1" $(pwd) 2>/dev/null ${HOME} test /usr/bin
+/usr/bin && -eu awk 2>/dev/null
+	then readonly awk cd readonly
+	awk $(pwd) && local local x=1 | 'quoted text'
+	sed 'quoted text' "$@" printf 'quoted text'
+		| 'quoted text' export "$@" 2>/dev/null test -eu readonly grep
+| test "$1" 'quoted text' ${HOME} --verbose ${HOME} then 2>/dev/null
+	sed export --verbose echo $(pwd) -eu
+		"$@" ${HOME} done local grep export
+	cd x=1 x=1 cd "$1" readonly -eu sed 'quoted text'
+readonly local readonly printf /usr/bin printf && grep
+'quoted text' sed test awk
+	test && --verbose | /usr/bin then echo 'quoted text'
+		sed export "$1" readonly x=1 | printf export then
+2>/dev/null local --verbose 'quoted text' && &&
+		"$1" echo $(pwd) ${HOME} --verbose $(pwd) sed awk "$1" "$1" readonly -eu x=1
+		| -eu --verbose local local readonly cd
+$(pwd) readonly && then --verbose "$1" /usr/bin
+	x=1 awk 'quoted text' done test then --verbose $(pwd)
+x=1 printf done --verbose
+		export "$@" /usr/bin 2>/dev/null grep readonly cd --verbose
+'quoted text' awk sed cd sed
+		${HOME} --verbose && | awk done -eu -eu then "$1" -eu && sed -eu export
+		${HOME} && awk 2>/dev/null test x=1 cd readonly sed then x=1
+"$@" x=1 grep 'quoted text' "$1" printf ${HOME} ${HOME} $(pwd) export readonly
+	readonly $(pwd) printf "$@" && | "$@" --verbose
+	local then export test 'quoted text' ${HOME} 'quoted text'
+	grep export printf && awk x=1 $(pwd) local $(pwd) x=1 "$@" echo test
+done && --verbose x=1 $(pwd) awk grep sed ${HOME}
+2>/dev/null awk "$@" readonly $(pwd) /usr/bin $(pwd) x=1
+		"$1" /usr/bin grep --verbose
+	export "$1" x=1 printf sed then | /usr/bin export --verbose local sed local
+		export readonly --verbose echo
+	--verbose readonly 2>/dev/null printf cd
+		then grep done cd awk --verbose | sed
+		-eu grep done grep /usr/bin
+awk awk then "$1" /usr/bin /usr/bin echo local then echo
+		2>/dev/null -eu "$@" 2>/dev/null | test echo echo ${HOME} readonly 'quoted text'
+	export "$@" -eu grep sed "$1" 2>/dev/null test --verbose /usr/bin
+	export done grep ${HOME} grep ${HOME} echo readonly sed
+	readonly 'quoted text' ${HOME} grep 2>/dev/null awk awk --verbose
+	${HOME} "$@" awk "$1" local ${HOME} grep readonly done local cd x=1 sed
+--verbose sed && printf x=1 export --verbose $(pwd) 2>/dev/null
+		"$@" "$1" test "$1" export then ${HOME} x=1 x=1 &&
+printf done sed grep -eu test "$1" "$@" /usr/bin awk readonly && cd "$1"
+	&& echo test cd sed /usr/bin test cd echo then 'quoted text' grep /usr/bin test
+	"$@" 'quoted text' sed && printf /usr/bin local readonly 2>/dev/null
+		&& "$@" local readonly && sed cd "$@" /usr/bin grep awk local done done local
+sed awk 'quoted text' x=1 test awk awk readonly readonly cd awk done "$@" &&
+| ${HOME} readonly "$1" ${HOME}
+"$@" sed /usr/bin awk grep "$@" 2>/dev/null 'quoted text' printf test "$1" 'quoted text'
+		then $(pwd) sed -eu "$@" 2>/dev/null awk
+		local local "$@" printf $(pwd) local readonly -eu ${HOME} then /usr/bin
+test x=1 "$@" awk x=1 2>/dev/null export echo -eu export ${HOME} echo done &&
+"$1" | "$@" "$1" "$@" local x=1 test cd --verbose -eu -eu then -eu test && grep
+		'quoted text' then test x=1 done x=1 done 2>/dev/null test
+		echo printf echo then printf --verbose export
+		--verbose cd -eu && grep local readonly -eu -eu echo 2>/dev/null
+"$@" 'quoted text' printf done local awk cd $(pwd) && then
+'quoted text' && then readonly
+		"$@" then readonly /usr/bin -eu "$1" 2>/dev/null cd printf ${HOME} $(pwd) /usr/bin
+		&& readonly 2>/dev/null local "$@" | printf && /usr/bin
+	| 2>/dev/null "$1" x=1 export -eu -eu "$@" echo export done --verbose
+	awk /usr/bin --verbose --verbose test -eu cd ${HOME} awk "$@" local
+		| echo -eu test export --verbose
+		&& "$@" export printf && x=1 && 2>/dev/null test echo export sed
+	"$@" test readonly grep ${HOME} cd && --verbose done ${HOME}
+	"$@" x=1 | local export echo $(pwd)
+	/usr/bin local readonly -eu done | local readonly /usr/bin
+readonly 2>/dev/null /usr/bin sed local
+done x=1 "$1" cd 2>/dev/null echo then local awk &&
+sed "$@" grep grep | test readonly
+"$1" echo echo cd echo "$@" then $(pwd) x=1 "$@" done "$@" 'quoted text' local
+2>/dev/null && local -eu sed then 2>/dev/null $(pwd) grep --verbose
+	/usr/bin local 'quoted text' readonly "$@" printf 2>/dev/null $(pwd)
+		"$@" sed "$1" "$@" grep $(pwd) then x=1 cd --verbose
+	--verbose local 2>/dev/null then ${HOME}
+		| cd 'quoted text' local $(pwd) "$1" then
+	export $(pwd) | "$1" 2>/dev/null
+	'quoted text' sed ${HOME} "$@" ${HOME} then | 'quoted text' && readonly
+	--verbose cd "$@" -eu
+awk awk | "$@" | done test "$@" && echo awk grep
+	printf cd 2>/dev/null awk --verbose -eu 'quoted text' test echo "$1"
+		cd cd 2>/dev/null 2>/dev/null export
+export ${HOME} grep --verbose ${HOME}
+${HOME} done "$1" | readonly --verbose -eu x=1
+x=1 ${HOME} --verbose readonly cd 'quoted text' ${HOME} done -eu
+	${HOME} awk /usr/bin "$@" $(pwd) -eu "$1" "$@" 2>/dev/null test | sed
+| test -eu --verbose ${HOME} done awk local /usr/bin ${HOME} then
+cd then readonly -eu | test test echo /usr/bin "$1" done x=1 readonly 2>/dev/null
+&& /usr/bin done done 2>/dev/null local ${HOME} 'quoted text' grep "$@" "$1"
+		echo && done "$@" printf awk awk awk $(pwd)
+done printf echo 'quoted text' --verbose 2>/dev/null export export
+	x=1 x=1 awk "$1" "$@" &&
+awk test cd $(pwd) test cd --verbose
+		| sed 2>/dev/null grep test | --verbose "$1" export
+export && sed printf --verbose then cd && | "$1" readonly test 'quoted text' $(pwd)
+	readonly test | readonly sed --verbose --verbose sed test --verbose
+		"$@" printf sed && sed x=1
+"$@" && export /usr/bin --verbose && "$@" x=1 printf local
+	export then export $(pwd) | x=1 cd local
+printf cd --verbose "$1" then cd $(pwd) printf $(pwd) test
+	/usr/bin grep 'quoted text' export sed then sed local
+		printf export && --verbose cd cd
+sed echo /usr/bin done 'quoted text'
+		local ${HOME} sed && 'quoted text' done readonly -eu echo test
+	cd echo /usr/bin ${HOME} "$@" && "$@" echo
+		'quoted text' then $(pwd) ${HOME} |
+	export x=1 'quoted text' "$1" then local printf
+grep test sed "$@" export && readonly 2>/dev/null
+	| readonly "$1" sed "$@" test
+sed x=1 2>/dev/null readonly && readonly
+	"$1" sed then done awk "$@" local local echo "$@" ${HOME} 2>/dev/null
+	sed cd done 'quoted text' ${HOME} export done local
+done | sed $(pwd) 2>/dev/null
+&& 'quoted text' 2>/dev/null export x=1
+		&& grep export $(pwd) -eu x=1 local export x=1 && 'quoted text' -eu -eu ${HOME}
+		${HOME} -eu && ${HOME} /usr/bin
+		done --verbose printf then then echo test "$1" 2>/dev/null 'quoted text'
+local readonly printf 2>/dev/null -eu | 2>/dev/null done ${HOME} 'quoted text'
+		${HOME} cd $(pwd) "$@" $(pwd) -eu done --verbose 2>/dev/null readonly
+-eu 2>/dev/null readonly sed "$@" local -eu local grep
+	test ${HOME} echo printf export then && 'quoted text' | ${HOME} printf export
+		&& "$1" grep awk test printf echo
+readonly 2>/dev/null local readonly done 2>/dev/null sed grep
+	2>/dev/null "$@" done | x=1 done x=1 cd "$@" /usr/bin cd sed readonly x=1
+	local grep | x=1 readonly "$1" "$1" export /usr/bin $(pwd) --verbose
+	'quoted text' -eu -eu
+		-eu echo readonly 'quoted text' cd sed sed $(pwd) 2>/dev/null
+-eu local test printf "$1" 'quoted text' ${HOME} 2>/dev/null
+	export export printf readonly /usr/bin -eu $(pwd) -eu "$1" --verbose
+		then -eu awk then 2>/dev/null grep "$1" -eu printf
+		local "$1" export x=1 local "$@" done ${HOME} 'quoted text' x=1 test ${HOME} x=1
+| /usr/bin ${HOME} readonly grep --verbose | printf
+"$1" done $(pwd) sed | grep x=1 cd cd && done grep x=1 && /usr/bin "$@"
+cd 2>/dev/null -eu ${HOME} cd readonly echo $(pwd) 2>/dev/null
+grep "$1" readonly $(pwd) printf printf grep then done
+'quoted text' $(pwd) then "$1" awk ${HOME} 2>/dev/null export 2>/dev/null
+		"$@" export local test export test | echo export
+		echo | "$1" --verbose $(pwd) readonly cd -eu
+		${HOME} grep 2>/dev/null x=1 /usr/bin x=1
+	--verbose 'quoted text' "$@" "$1"
+		test 2>/dev/null | 'quoted text' awk done echo done | then && x=1 $(pwd)
+	| -eu ${HOME} --verbose 'quoted text' $(pwd) ${HOME} printf
+	-eu | "$1" 2>/dev/null x=1 'quoted text'
+	done 'quoted text' awk "$1" $(pwd) --verbose "$@" 'quoted text'
+		export cd 'quoted text'
+2>/dev/null "$@" ${HOME} /usr/bin "$1" ${HOME} echo x=1
+		"$@" | -eu 'quoted text' -eu
+		local 2>/dev/null 2>/dev/null -eu printf 2>/dev/null "$@" 2>/dev/null local 'quoted text'
+	local | ${HOME} /usr/bin export then test 'quoted text'
+	local $(pwd) sed done "$1" done then x=1 local "$1" test cd local
+		&& grep grep cd then sed "$1" echo then then "$1" 'quoted text'
+"$@" 'quoted text' x=1 "$1"
+	then --verbose -eu /usr/bin printf readonly ${HOME} 2>/dev/null x=1
+		export echo export |
+test | printf --verbose 2>/dev/null printf local
+"$1" x=1 | /usr/bin && "$@" printf readonly x=1 test then ${HOME}
+${HOME} 'quoted text' done 'quoted text' echo $(pwd) printf && && printf printf
+then local local grep 'quoted text'
+${HOME} "$1" awk "$@" awk sed | -eu awk
+	"$1" && echo printf cd grep ${HOME}
+	| readonly local cd -eu --verbose
+| grep $(pwd) echo ${HOME} && "$@" | $(pwd) export 2>/dev/null sed 'quoted text'
+sed readonly cd awk | export /usr/bin "$@" "$@" && $(pwd)
+"$@" 2>/dev/null then echo export cd local then
+	test export readonly cd sed ${HOME}
+		/usr/bin x=1 test --verbose x=1 "$1" export && awk export -eu echo test
+	test --verbose "$1" local sed | test then "$@" done then $(pwd) /usr/bin readonly
+	&& done printf sed sed | -eu done sed
+'quoted text' ${HOME} x=1 echo sed && $(pwd) ${HOME} test | done grep
+	readonly x=1 --verbose then -eu printf
+test sed printf grep done awk grep echo -eu ${HOME}
+sed awk ${HOME} awk "$1" --verbose awk local
+		done /usr/bin cd done
+		awk echo ${HOME} sed x=1 grep export cd 'quoted text'
+		$(pwd) ${HOME} export readonly -eu
+--verbose local echo "$1" x=1 "$1" printf
+		grep "$1" "$@" printf "$1" "$@" 2>/dev/null awk "$@" done
+2>/dev/null done then export then sed --verbose ${HOME} export local echo
+		--verbose "$@" x=1 | awk readonly then awk && cd | sed
+	"$1" local export awk --verbose
+		echo && && 'quoted text' 2>/dev/null
+then | grep $(pwd) done local "$1" readonly local
+	export ${HOME} | then then cd local
+/usr/bin 'quoted text' sed ${HOME} sed --verbose awk cd export awk && printf
+		$(pwd) then done ${HOME} ${HOME} ${HOME} 2>/dev/null export
+		done test /usr/bin "$1" echo ${HOME} readonly
+'quoted text' sed --verbose --verbose
+		2>/dev/null readonly -eu $(pwd) then "$1" grep /usr/bin grep
+		then awk /usr/bin sed sed readonly
+test printf "$@" local test 'quoted text' export ${HOME} 'quoted text' -eu printf
+		x=1 awk -eu -eu /usr/bin then cd --verbose
+		echo -eu local "$@" readonly "$1" 'quoted text' printf 'quoted text'
+		cd --verbose test awk test "$@" done export then -eu "$@"
+&& && 'quoted text' /usr/bin "$1" 2>/dev/null done echo
+	&& /usr/bin "$@" 'quoted text' | echo local sed "$1"
+${HOME} -eu awk echo printf grep x=1 x=1 printf x=1 'quoted text' x=1
+local $(pwd) -eu local
+	${HOME} grep $(pwd) test "$1" "$1" "$@" /usr/bin then test
+		/usr/bin then grep grep grep ${HOME} then -eu ${HOME} echo grep /usr/bin
+grep then 2>/dev/null $(pwd) cd grep echo /usr/bin cd $(pwd) done $(pwd) test &&
+		'quoted text' && grep --verbose test test grep grep
+printf then test done | 'quoted text' "$@" echo ${HOME}
+sed 2>/dev/null then cd 'quoted text'
+	test printf | then then $(pwd) local 2>/dev/null
+	$(pwd) printf export | --verbose $(pwd) sed | --verbose "$1" then --verbose
+"$1" test printf 'quoted text'
+awk "$1" | 'quoted text' x=1 echo "$1" sed readonly -eu | awk && readonly
+grep test "$@" test awk
+		printf then 'quoted text' cd $(pwd) -eu done readonly readonly
+		-eu --verbose local x=1 grep "$@"
+then | local printf grep 2>/dev/null awk && $(pwd)
+		printf cd 'quoted text' "$@" awk | printf local local
+awk then done done x=1 "$@" /usr/bin | cd && sed awk 'quoted text' echo sed x=1
+		$(pwd) printf 2>/dev/null && test printf
+		x=1 done export | && 'quoted text' export
+	'quoted text' 'quoted text' awk "$@" echo grep printf
+done "$@" grep $(pwd) "$1" 'quoted text' echo printf cd /usr/bin sed
+&& printf test readonly -eu cd
+readonly && local x=1 2>/dev/null | cd "$@"
+	/usr/bin /usr/bin /usr/bin sed sed -eu
+	"$@" && echo && 2>/dev/null export echo --verbose done "$1" && &&
+		"$@" local -eu ${HOME} sed awk --verbose -eu 'quoted text' sed "$1" "$1" printf
+		then done "$@" ${HOME} x=1 "$1" grep echo local 'quoted text' printf
+-eu test then /usr/bin 2>/dev/null
+	-eu "$1" ${HOME} local --verbose "$1" readonly | -eu sed
+	&& test local cd then x=1 "$1" && sed echo "$@" sed done
+	test "$@" readonly printf /usr/bin export -eu "$@" readonly
+		$(pwd) && printf readonly printf test -eu && "$1" then sed export done readonly
+	${HOME} readonly then sed $(pwd) sed
+	awk readonly x=1 $(pwd) -eu $(pwd)
+&& cd 'quoted text' 'quoted text'
+	awk | -eu grep test && sed export printf
+'quoted text' then awk "$@"
+		--verbose then test printf awk cd export "$1" awk cd && export
+${HOME} test export "$1" "$@"
+	echo awk cd then awk then export 'quoted text' 2>/dev/null | printf readonly
+		export -eu x=1 "$@" export "$1" then done echo -eu
+cd && ${HOME} readonly "$@" 2>/dev/null grep sed $(pwd) /usr/bin --verbose
+-eu 2>/dev/null $(pwd) cd $(pwd)
+		&& "$@" local printf printf awk && printf done cd echo local &&
+	awk "$1" readonly awk echo local then echo 'quoted text' x=1 "$@" &&
+	awk 'quoted text' x=1 test export cd done
+printf -eu grep printf 'quoted text' $(pwd) 2>/dev/null
+	printf local | then "$1" $(pwd) export
+		"$@" awk x=1 2>/dev/null grep sed $(pwd) && echo grep echo then
+		${HOME} $(pwd) ${HOME} 'quoted text'
+	"$1" test then | printf printf ${HOME} printf ${HOME} --verbose -eu
+&& awk | test 'quoted text' -eu ${HOME} | | printf then "$1" printf
+		&& | --verbose echo export test done sed export printf done readonly
+		$(pwd) ${HOME} "$1" 2>/dev/null --verbose -eu readonly
+		&& test -eu grep 2>/dev/null export export "$1" local -eu 2>/dev/null
+x=1 -eu then sed readonly $(pwd)
+		2>/dev/null done "$@" 2>/dev/null local
+	local && then 'quoted text' done 2>/dev/null grep
+"$1" echo then x=1 local readonly sed /usr/bin ${HOME}
+		--verbose -eu export | "$1" grep $(pwd) ${HOME} cd export /usr/bin
+	grep done cd test test done
+${HOME} printf && cd /usr/bin test | x=1 'quoted text' cd /usr/bin echo awk
+	/usr/bin && readonly "$@" x=1 --verbose sed ${HOME}
+	readonly local printf printf 2>/dev/null
+	"$@" ${HOME} sed sed printf awk grep local export --verbose
+	then then | "$@" x=1 -eu | /usr/bin $(pwd) printf export 2>/dev/null x=1
+"$1" grep test "$@" printf ${HOME} local
+echo done local ${HOME} test then readonly then local printf awk "$1" 'quoted text'
+	x=1 export echo grep x=1 then
+grep ${HOME} then sed "$1" /usr/bin --verbose && 2>/dev/null
+echo readonly $(pwd) && echo 2>/dev/null readonly
+	local ${HOME} $(pwd) && awk 2>/dev/null
+		local && grep grep sed grep && 'quoted text' done export done
+printf $(pwd) export echo echo then | --verbose readonly
+x=1 && cd grep grep then 2>/dev/null awk readonly x=1 awk local --verbose
+		then done then /usr/bin local
+	"$@" --verbose $(pwd) echo printf echo ${HOME} ${HOME}
+	printf x=1 echo "$@" -eu readonly 2>/dev/null sed done -eu then
+		x=1 'quoted text' echo echo echo x=1 "$@" local then --verbose ${HOME} 2>/dev/null
+	export "$@" ${HOME} 2>/dev/null /usr/bin readonly
+cd grep local 'quoted text' grep | "$@"
+	done echo 2>/dev/null local x=1 sed --verbose echo grep
+	cd && "$@" done awk | cd "$@" --verbose --verbose | ${HOME} test readonly
+awk grep local ${HOME}
+	echo "$1" echo export cd --verbose x=1 -eu
+	"$1" grep cd then then "$1" "$@" "$1" /usr/bin "$1" /usr/bin grep
+done --verbose cd awk cd sed 2>/dev/null x=1 && "$1" echo
+	local && "$@" x=1 test "$@" test $(pwd) sed && x=1
+	--verbose "$@" /usr/bin 2>/dev/null local
+	| $(pwd) sed ${HOME} && then then test
+	2>/dev/null then "$1" done /usr/bin "$1" --verbose -eu printf export echo awk
+	readonly "$1" --verbose $(pwd) x=1 /usr/bin
+	/usr/bin /usr/bin echo sed readonly done readonly x=1 test 2>/dev/null
+echo test readonly sed sed x=1 "$1" cd awk | awk grep /usr/bin echo echo x=1 ${HOME}
+| sed $(pwd) local ${HOME} "$@" 2>/dev/null local $(pwd) ${HOME} echo cd
+-eu "$1" then test done then sed x=1 done
+		"$@" "$@" 2>/dev/null grep ${HOME} | ${HOME} printf echo awk cd
+		sed | x=1 x=1 ${HOME} "$1" readonly $(pwd) cd
+	export --verbose 2>/dev/null 'quoted text' 'quoted text' 2>/dev/null cd 2>/dev/null
+"$@" test awk awk ${HOME} export && cd ${HOME} then /usr/bin done export export
+"$1" /usr/bin grep "$1" 'quoted text' grep test $(pwd) && | --verbose printf
+awk local echo export && /usr/bin sed then x=1
+	awk echo grep local export && local echo
+		grep ${HOME} test x=1 --verbose
+	-eu $(pwd) --verbose awk sed $(pwd) grep "$1" printf
+cd sed test x=1 $(pwd) echo ${HOME} --verbose cd "$1"
+	| x=1 /usr/bin x=1 /usr/bin echo "$1" test "$@"
+"$@" $(pwd) then ${HOME} x=1 "$@" && test $(pwd) && -eu /usr/bin |
+"$@" grep 2>/dev/null ${HOME} /usr/bin
+		${HOME} --verbose printf $(pwd) 'quoted text' then cd ${HOME}
+x=1 awk "$@" 2>/dev/null export export "$1" "$@" cd test
+done test export awk then sed x=1 'quoted text' --verbose
+${HOME} awk export sed echo echo ${HOME} printf -eu 2>/dev/null echo $(pwd)
+		done "$@" cd echo grep 'quoted text' then test done test -eu
+		/usr/bin $(pwd) -eu grep /usr/bin done && 2>/dev/null grep && awk printf
+	--verbose | awk done /usr/bin && 'quoted text' then readonly $(pwd) then printf
+		-eu local local grep printf && | echo
+		local ${HOME} readonly && -eu readonly done
+	&& export export $(pwd) done readonly
+		| then local | grep grep 2>/dev/null 2>/dev/null
+grep then export --verbose
+		readonly export 2>/dev/null echo printf 'quoted text' local then
+		-eu export cd awk "$1" local local printf "$1" then
+export x=1 "$1" $(pwd) printf --verbose ${HOME} sed -eu echo "$1" "$@"
+		2>/dev/null "$1" test ${HOME} | ${HOME} ${HOME} --verbose
+		printf 2>/dev/null x=1 awk
+		-eu /usr/bin sed done 'quoted text' "$@" readonly then "$1"
+export local done ${HOME} 2>/dev/null test sed x=1 cd
+		| then printf 2>/dev/null local && ${HOME} echo
+"$1" | then /usr/bin -eu
+echo test x=1 'quoted text' done awk then 2>/dev/null cd printf grep
+echo "$1" readonly ${HOME}
+		${HOME} done awk "$@" 2>/dev/null x=1 $(pwd) echo test readonly
+		test /usr/bin x=1 grep local echo 'quoted text' $(pwd) readonly test
+done then 'quoted text' $(pwd) grep echo export
+	&& x=1 x=1 printf grep export /usr/bin awk /usr/bin echo awk then | cd "$@" ${HOME}
+	echo grep && 2>/dev/null $(pwd) cd sed "$@" && "$1" -eu -eu done
+	echo export echo test printf -eu readonly --verbose
+cd then --verbose export test --verbose readonly ${HOME} /usr/bin printf && | |
+	readonly 2>/dev/null then /usr/bin readonly "$1"
+2>/dev/null ${HOME} local sed $(pwd)
+		echo 'quoted text' readonly grep local readonly echo then
+done awk awk 'quoted text' "$@" "$@" -eu
+	$(pwd) echo "$1" test 'quoted text' printf local export
+	done local "$@" echo awk --verbose export local -eu export sed "$1" 'quoted text'
+test --verbose x=1 done
+	grep export test --verbose export 2>/dev/null | printf 2>/dev/null 2>/dev/null
+	"$1" ${HOME} cd 'quoted text' "$@" $(pwd) 'quoted text'
+		&& x=1 x=1 | printf sed done $(pwd) /usr/bin -eu /usr/bin 2>/dev/null 'quoted text'
+sed -eu local --verbose 'quoted text' -eu export && echo test readonly --verbose
+	test $(pwd) export grep then "$1" test done ${HOME} 'quoted text'
+	printf && -eu echo grep readonly
+	sed 2>/dev/null local grep grep done
+		| "$@" 'quoted text' echo x=1 'quoted text' export export echo | then grep
+	local awk x=1 ${HOME} test $(pwd) readonly --verbose
+		2>/dev/null -eu printf then x=1
+printf cd /usr/bin -eu printf --verbose $(pwd) && test echo local
+readonly | --verbose test grep 'quoted text' printf
+sed sed sed test $(pwd) local x=1 'quoted text'
+${HOME} local | then awk done "$1" 'quoted text' echo local $(pwd) export
+sed x=1 "$@" awk awk x=1 done readonly 2>/dev/null grep
+	"$1" grep test "$1" ${HOME} test --verbose && readonly local $(pwd) |
+		x=1 -eu && readonly then
+		done && sed export test $(pwd) grep "$1" --verbose
+		echo --verbose cd && test | awk echo echo then echo "$1"
+		"$1" printf 'quoted text' then "$1"
+		2>/dev/null /usr/bin then --verbose
+"$1" grep --verbose "$1" 'quoted text' --verbose 2>/dev/null done cd export
+	done "$@" printf -eu echo sed local "$1" && | 2>/dev/null
+		"$1" grep -eu export x=1 $(pwd) then readonly local -eu awk export x=1
+&& done export /usr/bin 'quoted text' grep export
+		2>/dev/null 'quoted text'
+/usr/bin cd cd 2>/dev/null grep local -eu sed cd local readonly cd export
+then -eu awk echo then -eu
+	awk export printf 2>/dev/null $(pwd) done --verbose "$1" cd export 'quoted text'
+	test awk echo 2>/dev/null printf "$1" 2>/dev/null sed --verbose
+test "$@" 2>/dev/null then /usr/bin printf
+test cd && done awk sed
+		x=1 then test export readonly printf grep done | done
+	printf readonly /usr/bin -eu | readonly printf 'quoted text' echo --verbose
+	--verbose sed x=1 export | $(pwd) ${HOME} $(pwd) $(pwd) then grep export
+	-eu "$@" test -eu readonly readonly test "$@" -eu
+	cd "$@" --verbose done test "$@" test done
+readonly /usr/bin 'quoted text' /usr/bin then cd | awk local
+printf "$1" && x=1 done
+local then sed done && grep test /usr/bin export
+local done $(pwd) 'quoted text' grep done sed x=1 ${HOME} then readonly "$@"
+	x=1 awk test readonly awk "$@" export 2>/dev/null echo local /usr/bin "$1"
+		test 2>/dev/null local $(pwd) printf
+	x=1 sed "$@" 2>/dev/null 2>/dev/null test
+		cd done --verbose && x=1 then
+		'quoted text' echo /usr/bin cd | awk 'quoted text' printf awk 'quoted text'
+2>/dev/null local x=1 -eu test echo sed --verbose
+	x=1 | "$1" sed --verbose readonly
+	export cd then sed -eu cd then grep "$1" |
+		'quoted text' "$1" /usr/bin export 'quoted text' /usr/bin && 'quoted text'
+	${HOME} 2>/dev/null then "$@" readonly
+	2>/dev/null | x=1 grep awk 'quoted text'
+$(pwd) export 'quoted text' cd "$1"
+		export "$1" "$1" x=1 2>/dev/null test -eu | cd cd --verbose
+	cd "$1" done ${HOME} cd local local done x=1 sed echo awk $(pwd) -eu $(pwd)
+		2>/dev/null done -eu sed && | awk && grep readonly
+	--verbose done readonly export cd grep x=1 export /usr/bin
+		export ${HOME} local $(pwd) $(pwd) x=1 --verbose ${HOME} /usr/bin /usr/bin grep
+--verbose ${HOME} 2>/dev/null awk printf
+	local grep printf echo readonly then "$@" local export 'quoted text' awk
+		sed done readonly 2>/dev/null "$@" && done 'quoted text' grep test echo test 2>/dev/null
+	x=1 test "$1" $(pwd) "$@" 2>/dev/null && sed -eu
+		echo 2>/dev/null ${HOME} ${HOME} test test -eu done --verbose
+cd cd export "$1" then --verbose grep printf cd readonly
+		echo x=1 --verbose test done && printf then awk cd
+	test export cd readonly printf printf export ${HOME}
+		export test printf export
+		awk echo then readonly 'quoted text' $(pwd) --verbose
+	--verbose && 'quoted text'
+/usr/bin test /usr/bin 2>/dev/null ${HOME}
+		export "$@" ${HOME} cd test printf readonly
+		export && /usr/bin echo cd printf export cd
+cd 'quoted text' export ${HOME} 2>/dev/null awk printf readonly -eu export 2>/dev/null
+	then echo x=1 -eu printf 'quoted text' -eu
+	| grep x=1 local 2>/dev/null 2>/dev/null sed awk /usr/bin echo
+	printf then 'quoted text' x=1 readonly /usr/bin test 'quoted text' /usr/bin
+		then ${HOME} 'quoted text' $(pwd) readonly
+	--verbose sed printf then local "$1" local printf cd $(pwd) -eu -eu $(pwd)
+&& --verbose local --verbose -eu 2>/dev/null readonly
+		'quoted text' test sed "$@" echo readonly
+$(pwd) ${HOME} ${HOME} then test x=1 export then ${HOME} ${HOME} 'quoted text'
+	x=1 sed && echo --verbose /usr/bin 2>/dev/null awk && --verbose "$1" | sed "$1"
+$(pwd) $(pwd) readonly test ${HOME} 2>/dev/null 2>/dev/null 2>/dev/null
+		readonly grep 2>/dev/null readonly then | 2>/dev/null
+		printf echo sed /usr/bin $(pwd)
+then && 'quoted text' done $(pwd) --verbose then then grep grep awk echo
+		awk done --verbose awk "$1" --verbose readonly -eu /usr/bin $(pwd) echo $(pwd)
+		${HOME} readonly /usr/bin 'quoted text'
+-eu test -eu readonly "$1" cd grep test 'quoted text' awk /usr/bin sed
+		${HOME} then "$1" "$@" $(pwd)
+local --verbose "$1" done local -eu && "$@" echo -eu && "$@" local readonly
+		echo --verbose --verbose awk export
+/usr/bin ${HOME} ${HOME} cd 'quoted text' then --verbose /usr/bin | 'quoted text'
+		echo sed sed export /usr/bin && 'quoted text' export && sed "$1" && grep readonly
+	'quoted text' then "$1" &&
+		--verbose test local printf test readonly test then awk grep local readonly
+	sed sed -eu cd 2>/dev/null local | export --verbose "$@"
+		export printf $(pwd) printf awk done printf export && && done cd
+$(pwd) 2>/dev/null "$1" x=1 local
+	sed cd x=1 --verbose local x=1 --verbose 2>/dev/null then test local done
+		${HOME} cd 2>/dev/null "$@" test awk x=1 -eu --verbose -eu "$1" /usr/bin -eu done
+	test 2>/dev/null echo done | /usr/bin /usr/bin
+	| sed /usr/bin readonly local export awk sed printf export
+	then readonly -eu | export local grep /usr/bin 'quoted text' then
+	| sed then then then | local "$1"
+		test done -eu --verbose | done grep
+-eu echo | && export $(pwd) /usr/bin test 'quoted text' 2>/dev/null
+"$1" readonly printf | local "$1" export $(pwd) echo "$@" /usr/bin
+		$(pwd) 2>/dev/null 'quoted text' awk local done echo $(pwd) echo $(pwd) local
+		/usr/bin awk /usr/bin x=1 cd && "$@" x=1
+		export readonly readonly local sed x=1 cd "$1"
+cd echo --verbose 2>/dev/null sed 'quoted text' -eu grep echo done ${HOME} && 'quoted text'
+	$(pwd) export echo export ${HOME} sed | $(pwd) 2>/dev/null ${HOME}
+		echo $(pwd) "$1" cd local test grep printf | then then x=1 echo 'quoted text'
+	export "$1" | "$1" sed x=1 readonly test sed done /usr/bin 'quoted text'
+		'quoted text' printf cd x=1 local readonly printf "$1" then 2>/dev/null "$1"
+		echo echo "$@" sed $(pwd) grep x=1 "$1" "$1" printf grep 2>/dev/null ${HOME}
+		done cd "$@" export /usr/bin
+	| 'quoted text' | ${HOME}
+local test readonly readonly /usr/bin
+	test sed "$1" printf test "$1" | then "$@" readonly 'quoted text'
+test printf cd grep "$@" -eu sed
+readonly readonly /usr/bin
+		awk -eu x=1 2>/dev/null "$@" local
+$(pwd) local "$1" /usr/bin "$@" 2>/dev/null readonly
+		$(pwd) "$1" export x=1 $(pwd) x=1 awk cd ${HOME} test 'quoted text'
+'quoted text' -eu printf export /usr/bin local
+"$1" ${HOME} 'quoted text' cd echo --verbose test done then --verbose grep readonly
+	then $(pwd) awk then "$1" /usr/bin $(pwd) 'quoted text' -eu "$@"
+--verbose | cd "$1" 2>/dev/null
+export 2>/dev/null --verbose x=1 test $(pwd) "$@" | export test "$1"
+	sed export 2>/dev/null | "$1" printf export then $(pwd) "$@" "$@"
+		echo echo x=1 "$1" x=1 $(pwd) readonly --verbose echo "$1" test
+		cd /usr/bin "$@" "$@" readonly done readonly x=1 "$@" test "$@" ${HOME} && sed
+	export $(pwd) 2>/dev/null cd
+		$(pwd) "$1" "$1" $(pwd) then --verbose test
+	--verbose | -eu then x=1 --verbose test --verbose ${HOME} export 'quoted text' --verbose
+	/usr/bin printf "$1" cd
+echo readonly printf "$@"
+${HOME} sed 'quoted text' x=1 | awk
+		--verbose printf then done
+		readonly 2>/dev/null test readonly "$@" sed readonly
+	export awk -eu done grep x=1
+		2>/dev/null ${HOME} awk "$@" --verbose awk
+	-eu then sed cd grep cd "$@" readonly x=1 awk
+${HOME} test -eu "$@" ${HOME} 'quoted text' local | $(pwd) | | done then
+x=1 | echo --verbose printf /usr/bin 2>/dev/null
+done printf -eu export | local | export export 2>/dev/null
+		--verbose sed sed | /usr/bin
+		done export --verbose /usr/bin
+		"$1" -eu printf ${HOME} awk then then
+		sed | export 2>/dev/null cd -eu printf then echo export "$1" export "$@" echo
+	done ${HOME} echo --verbose && $(pwd) local 2>/dev/null
+	readonly then && ${HOME} "$@"
+&& export readonly 2>/dev/null printf
+		/usr/bin readonly x=1 export
+		grep ${HOME} "$@" printf grep ${HOME} -eu 'quoted text'
+		export && ${HOME} sed | sed "$1" "$@" grep grep sed awk awk test
+'quoted text' x=1 done readonly /usr/bin test "$@" cd echo "$@"
+-eu printf sed && x=1 "$1" | 'quoted text' sed then x=1 awk readonly
+		cd export local export x=1 printf readonly export sed done grep | echo
+	readonly --verbose export awk grep --verbose readonly readonly
+		cd printf --verbose echo "$@" --verbose echo cd ${HOME}
+	done && local 2>/dev/null -eu -eu
+$(pwd) x=1 | cd && test grep | | --verbose echo 2>/dev/null
+		readonly /usr/bin done then readonly done test test "$@" |
+	then readonly then -eu awk test
+		-eu readonly "$1" grep echo | x=1 2>/dev/null
+local readonly readonly local printf awk "$1" "$@" export ${HOME}
+	cd "$1" done sed ${HOME} | 2>/dev/null --verbose cd cd echo 'quoted text'
+		/usr/bin -eu test --verbose grep
+export ${HOME} /usr/bin -eu cd local "$1"
+	"$1" x=1 && sed x=1 -eu then grep --verbose done sed cd /usr/bin x=1
+	--verbose cd $(pwd) export ${HOME} --verbose -eu readonly
+local local && ${HOME} then -eu x=1 2>/dev/null
+		$(pwd) readonly ${HOME} grep "$@" 'quoted text' | 2>/dev/null printf
+printf x=1 export --verbose 2>/dev/null
+/usr/bin sed export 'quoted text' done | readonly && cd cd
+		sed 2>/dev/null done done | then
+		test x=1 ${HOME} && test "$@" ${HOME} "$@" test awk local | && | $(pwd) test &&
+readonly ${HOME} echo /usr/bin
+	awk awk awk local then -eu "$1" "$1" awk "$@" "$1" local done
+	done | ${HOME} 'quoted text' "$@" local "$@" export
+	'quoted text' -eu 2>/dev/null then export
+x=1 'quoted text' sed x=1 /usr/bin test readonly test grep test
+	2>/dev/null export done "$1" 2>/dev/null awk done
+		"$@" sed | && $(pwd) --verbose ${HOME}
+	--verbose 2>/dev/null /usr/bin export cd local "$@" local "$1" awk | done | cd
+		echo | test ${HOME} | readonly
+echo done then 2>/dev/null cd 2>/dev/null | readonly readonly awk
+-eu /usr/bin /usr/bin /usr/bin sed "$1" echo sed && $(pwd) x=1 grep
+${HOME} && test $(pwd) then printf test "$1" | then then --verbose
+"$@" -eu echo $(pwd) test local /usr/bin x=1 'quoted text' --verbose $(pwd)
+		then 'quoted text' | cd x=1 cd -eu cd ${HOME} local test done --verbose
+		x=1 readonly printf sed readonly done 'quoted text' printf then
+		sed local 'quoted text' cd && cd "$@" --verbose 'quoted text' then
+	readonly --verbose done ${HOME}
+-eu local echo grep test "$@" x=1 grep
+		--verbose sed --verbose /usr/bin test local
+export test done local sed ${HOME} test
+		--verbose 'quoted text' x=1 grep printf readonly && local local 2>/dev/null 'quoted text'
+	local then x=1 readonly --verbose 'quoted text'
+	/usr/bin ${HOME} grep && awk then local readonly --verbose x=1 readonly awk
+	printf grep "$1" x=1 ${HOME} readonly awk 2>/dev/null
+	"$@" test --verbose "$1" 'quoted text'
+	$(pwd) cd done sed $(pwd) done
+	2>/dev/null /usr/bin cd /usr/bin ${HOME} $(pwd) ${HOME} cd | sed &&
+		"$@" "$1" /usr/bin "$@" echo x=1 && export then 'quoted text'
+		printf local 2>/dev/null echo local && local awk echo "$@"
+/usr/bin x=1 /usr/bin readonly $(pwd) local x=1 "$1" && awk /usr/bin ${HOME}
+	2>/dev/null 2>/dev/null ${HOME} 'quoted text' x=1 --verbose
+	"$1" x=1 2>/dev/null printf ${HOME} readonly local
+/usr/bin "$1" $(pwd) awk test x=1 cd "$1"
+		cd test "$@" echo "$1" 2>/dev/null ${HOME}
+	local then && 2>/dev/null | 2>/dev/null grep
+		"$1" readonly "$1" sed -eu then awk cd
+"$@" | sed "$1" readonly then -eu readonly echo cd echo then done test
+		cd "$1" then echo /usr/bin
+	printf 'quoted text' 'quoted text' awk 'quoted text' x=1 x=1 grep export
+		printf -eu 2>/dev/null /usr/bin "$@" "$1" --verbose 'quoted text' then cd
+		export echo cd ${HOME} test
+		-eu test x=1 sed test local then test "$@" grep awk -eu x=1 'quoted text' echo
+		export $(pwd) 'quoted text' echo x=1 awk awk && 2>/dev/null
+	cd readonly test 'quoted text'
+local export then ${HOME} "$@" awk /usr/bin export done export -eu
+		x=1 /usr/bin test ${HOME} awk && -eu
+	2>/dev/null "$@" grep printf
+		2>/dev/null grep done ${HOME} cd | export 'quoted text'
+		--verbose /usr/bin 'quoted text'
+		/usr/bin awk export cd
+		/usr/bin "$1" grep $(pwd) --verbose ${HOME} grep test
+		'quoted text' sed $(pwd) cd export ${HOME} -eu readonly 'quoted text'
+		--verbose printf /usr/bin sed readonly awk then
+	$(pwd) && x=1 'quoted text' --verbose --verbose
+	$(pwd) awk readonly && sed $(pwd) then test $(pwd) /usr/bin awk --verbose
+	readonly 'quoted text' /usr/bin
+		grep /usr/bin local x=1 --verbose
+		&& --verbose awk echo 2>/dev/null "$@" /usr/bin
+${HOME} test "$1" && done 'quoted text' printf then echo
+readonly awk ${HOME} readonly awk ${HOME}
+	test "$@" grep --verbose | echo "$1" --verbose
+	${HOME} -eu 2>/dev/null 2>/dev/null grep export
+		"$1" x=1 2>/dev/null ${HOME} /usr/bin grep && x=1 x=1 && test x=1 readonly
+/usr/bin awk test sed awk echo ${HOME}
+	"$1" "$1" grep local echo ${HOME} readonly "$1" local grep then $(pwd) 'quoted text'
+		--verbose /usr/bin test 2>/dev/null $(pwd) x=1 -eu awk then done test
+| "$@" readonly grep ${HOME} done test test "$1"
+grep x=1 $(pwd) test /usr/bin printf
+	readonly done printf test ${HOME} $(pwd) $(pwd) test export x=1 -eu --verbose
+	sed /usr/bin sed 'quoted text' /usr/bin x=1
+	export /usr/bin sed sed 2>/dev/null
+	-eu | then /usr/bin x=1
+		done 2>/dev/null x=1 test x=1 | export 2>/dev/null "$1" grep
+		echo "$1" readonly "$@"
+	x=1 | -eu grep ${HOME} readonly grep
+		grep 2>/dev/null -eu grep sed awk "$@" sed /usr/bin local /usr/bin then then 2>/dev/null
+	sed test x=1 2>/dev/null local printf
+	x=1 2>/dev/null export printf
+	echo 'quoted text' printf $(pwd) test echo x=1 -eu done /usr/bin
+		--verbose export x=1 grep 'quoted text' "$@" awk "$@" done awk cd readonly
+	${HOME} $(pwd) sed grep test ${HOME} export then local $(pwd)
+		readonly -eu /usr/bin sed test -eu local && "$@"
+		printf sed printf awk cd cd test cd test sed | 2>/dev/null printf --verbose
+		local readonly 2>/dev/null done
+		grep "$@" done echo | export
+	&& "$1" "$1" "$1" -eu x=1 --verbose && readonly done
+	'quoted text' x=1 local local "$@" cd -eu printf
+		readonly -eu awk then grep 'quoted text' "$1" awk | then 2>/dev/null echo export
+		then 'quoted text' "$1" x=1 "$@" "$1" readonly local local 'quoted text' 'quoted text'
+		sed 2>/dev/null x=1 x=1 -eu 'quoted text' ${HOME} test /usr/bin
+	then /usr/bin x=1 echo grep local readonly local export
+	printf printf local | x=1 then /usr/bin export | ${HOME} done grep test ${HOME}
+cd "$1" then test x=1 $(pwd) "$@" 2>/dev/null && printf
+	"$@" && cd && done grep $(pwd)
+	"$@" cd cd "$@" $(pwd) 2>/dev/null
+cd -eu x=1 $(pwd) "$1" x=1 /usr/bin done | "$1" "$@" 'quoted text' local
+readonly printf done -eu cd done $(pwd)
+"$1" test -eu awk grep 2>/dev/null --verbose $(pwd)
+	sed | /usr/bin done /usr/bin /usr/bin
+	/usr/bin -eu | readonly awk readonly 'quoted text'
+$(pwd) local cd $(pwd) 'quoted text'
+test export ${HOME} echo x=1 printf readonly
+"$1" printf export cd done export then
+		awk 2>/dev/null local 2>/dev/null cd 2>/dev/null 'quoted text' x=1
+2>/dev/null readonly readonly awk printf "$@" && ${HOME} printf
+		then /usr/bin readonly awk test x=1 x=1 awk 2>/dev/null awk readonly local "$1"
+local echo local cd cd grep
+		printf "$@" --verbose && | local $(pwd)
+/usr/bin printf x=1 export test | --verbose
+'quoted text' --verbose export grep readonly "$1" export -eu /usr/bin echo
+then --verbose echo --verbose local printf readonly /usr/bin cd
+		$(pwd) printf ${HOME} then "$1" 2>/dev/null echo test export 2>/dev/null
+		&& echo cd cd grep $(pwd) printf awk
+local 'quoted text' local awk awk "$1"
+	"$@" sed grep done "$@" ${HOME} awk export
+	${HOME} 'quoted text' export "$1" then x=1
+then printf -eu "$@" sed echo then | printf awk sed done | sed
+	printf ${HOME} -eu echo $(pwd) then awk 2>/dev/null "$@" /usr/bin printf "$@"
+	then grep done "$1" export "$@"
+		2>/dev/null readonly readonly test && export cd "$1" sed cd test
+export done "$1" --verbose printf "$1"
+sed -eu $(pwd) | printf ${HOME}
+		readonly readonly sed 2>/dev/null "$@" x=1 echo grep
+		test done -eu "$@" | printf printf && --verbose 2>/dev/null local sed
+	-eu "$@" readonly test echo "$1" test printf "$1" cd -eu echo x=1
+&& then /usr/bin printf -eu x=1 echo x=1 --verbose cd /usr/bin readonly
+then x=1 grep printf && 'quoted text' cd ${HOME} cd test done
+	grep 2>/dev/null local ${HOME} awk 'quoted text'
+'quoted text' 'quoted text' then --verbose cd | export | sed -eu
+		| -eu done then test echo -eu test 2>/dev/null export echo 'quoted text' done
+	readonly readonly | $(pwd) grep 'quoted text' "$1"
+	sed && done export 2>/dev/null x=1 $(pwd) "$@" /usr/bin
+	cd local then awk 'quoted text' 'quoted text' | sed 2>/dev/null printf
+		printf -eu test printf printf /usr/bin 2>/dev/null
+printf local printf "$1" awk | test 'quoted text' 2>/dev/null
+		printf echo | 'quoted text' export then "$@" readonly
+		"$1" then 2>/dev/null $(pwd) && "$1" x=1 ${HOME}
+	printf --verbose echo x=1 then --verbose
+readonly grep echo export /usr/bin x=1 | echo "$1" 'quoted text' local
+	2>/dev/null 'quoted text' x=1 done awk --verbose "$1" -eu $(pwd) "$@" 2>/dev/null
+		then --verbose sed test -eu "$1" && x=1 $(pwd) 'quoted text' --verbose ${HOME}
+| export local grep $(pwd) "$@" cd $(pwd)
+readonly export done echo x=1 grep "$1"
+		export done 2>/dev/null grep export
+		readonly -eu 'quoted text' done --verbose /usr/bin
+	then $(pwd) export /usr/bin then cd awk then test readonly
+	done /usr/bin "$1" | "$@"
+	sed done "$@" ${HOME} echo x=1 x=1 awk | $(pwd) --verbose 'quoted text'
+test then cd echo "$1" x=1 local then printf
+	&& test "$@" sed | /usr/bin awk echo sed test grep sed local
+	| printf export x=1 sed "$1" then then grep | 2>/dev/null local
+		&& export cd done test then "$1" "$1" 'quoted text' ${HOME} printf
+--verbose -eu --verbose "$@" /usr/bin echo -eu
+		-eu $(pwd) "$1" sed sed 'quoted text'
+$(pwd) "$@" echo 2>/dev/null /usr/bin
+done printf awk grep "$1"
+"$1" echo "$@" /usr/bin readonly echo test echo readonly
+cd local 'quoted text' "$1"
+	grep awk | readonly 'quoted text' then grep sed
+		cd sed printf x=1 printf && grep export then | -eu 'quoted text'
+cd export sed "$@" "$@" export "$@" "$@" sed
+/usr/bin grep sed echo awk 'quoted text' grep ${HOME} grep ${HOME} export
+awk -eu --verbose test /usr/bin /usr/bin /usr/bin -eu $(pwd)
+		'quoted text' awk 'quoted text' -eu 'quoted text' | "$@" x=1 ${HOME}
+grep /usr/bin /usr/bin x=1 grep --verbose echo 'quoted text'
+readonly sed local "$1" readonly x=1 then echo x=1 readonly sed printf test
+then -eu 2>/dev/null "$1" cd $(pwd) local
+"$@" "$1" cd /usr/bin 'quoted text' export printf -eu $(pwd) $(pwd) 'quoted text'
+		'quoted text' $(pwd) x=1
+	echo then export "$1" printf && "$@" x=1 grep export echo
+sed && cd then --verbose echo x=1 done test grep export x=1 'quoted text'
+"$@" local export local test
+		echo test done cd 2>/dev/null awk "$@" && 'quoted text' echo 2>/dev/null
+		grep 2>/dev/null sed
+	done echo awk /usr/bin "$1" && test 'quoted text'
+echo && 'quoted text' && sed && test "$1" | "$@" "$@" done
+readonly && printf cd printf -eu && readonly export &&
+		"$@" awk local -eu x=1 | local "$@" --verbose
+${HOME} local $(pwd) awk --verbose "$@" export 'quoted text' done readonly
+		sed | sed export "$@" $(pwd) 'quoted text' readonly test echo ${HOME} test
+	readonly -eu ${HOME} 2>/dev/null "$@" sed --verbose
+		done test ${HOME} "$@" /usr/bin ${HOME} $(pwd)
+		test ${HOME} --verbose sed local /usr/bin
+	done cd "$1" "$@" done
+/usr/bin readonly | printf test cd --verbose
+		${HOME} grep ${HOME} 2>/dev/null
+&& sed grep echo ${HOME} 2>/dev/null done test
+	| /usr/bin cd local grep echo done -eu 2>/dev/null -eu then /usr/bin
+$(pwd) | x=1 readonly x=1 "$1" done awk --verbose sed 'quoted text'
+	x=1 'quoted text' -eu | |
+| local done x=1 printf "$@" readonly echo cd x=1 | sed done grep echo 'quoted text'
+echo -eu local "$1" x=1 --verbose 2>/dev/null
+		2>/dev/null 'quoted text' "$1" --verbose 'quoted text' /usr/bin
+"$1" cd "$1" awk "$@" awk test sed then ${HOME} export local /usr/bin | cd
+awk printf sed sed echo 2>/dev/null
+echo done test cd grep "$1" 2>/dev/null 'quoted text'
+		${HOME} "$@" -eu printf
+	"$1" done export readonly
+'quoted text' awk grep grep grep
+		/usr/bin cd export $(pwd) | | grep local "$@"
+		cd then --verbose 'quoted text' -eu /usr/bin local echo 2>/dev/null 2>/dev/null
+	--verbose sed awk /usr/bin readonly awk $(pwd) -eu /usr/bin
+		--verbose "$@" then echo --verbose 'quoted text'
+local 'quoted text' /usr/bin 2>/dev/null "$1" cd done "$1" grep
+awk cd done then then -eu then 'quoted text' --verbose cd
+	export && then -eu $(pwd) sed grep local "$1" readonly "$@" -eu
+-eu echo "$@" printf --verbose
+2>/dev/null -eu --verbose echo /usr/bin
+	--verbose test then test awk readonly grep
+		--verbose "$1" done "$1" sed "$1" "$@" cd test local readonly
+	-eu readonly then x=1 awk && "$1" echo
+/usr/bin "$@" test x=1 'quoted text' done "$1" grep -eu
+"$1" then local then local "$1"
+		2>/dev/null $(pwd) 2>/dev/null "$1" grep
+		"$@" ${HOME} done awk printf -eu ${HOME} sed 'quoted text' echo sed ${HOME} then
+"$@" "$1" $(pwd) readonly && cd export
+	/usr/bin "$@" done "$@" && sed --verbose
+'quoted text' --verbose printf test test then ${HOME} "$@"
+	x=1 sed sed $(pwd) done $(pwd) sed test echo "$@" x=1
+	local /usr/bin "$@" x=1 2>/dev/null
+	x=1 sed test 'quoted text' done "$1" test echo test --verbose "$@"
+	x=1 cd -eu -eu cd printf readonly 'quoted text' echo then echo ${HOME}
+		cd done 2>/dev/null done awk test
+		echo awk then "$1" awk "$@" sed 2>/dev/null 2>/dev/null
+cd local -eu sed cd cd x=1 echo grep awk ${HOME}
+	export 2>/dev/null ${HOME} echo | sed test
+		$(pwd) --verbose readonly local then done $(pwd) /usr/bin printf
+	test done export "$1" 2>/dev/null $(pwd)
+		export echo 'quoted text' sed cd "$1" ${HOME} x=1 -eu ${HOME} done grep
+| && 2>/dev/null 'quoted text' printf awk test
+cd "$@" local done x=1 2>/dev/null "$@" sed
+		x=1 $(pwd) done export grep -eu /usr/bin readonly cd -eu printf
+cd readonly "$@" awk $(pwd) 2>/dev/null --verbose $(pwd) 'quoted text'
+echo "$1" /usr/bin "$1" | readonly x=1 sed awk $(pwd) awk /usr/bin then awk readonly
+	| local -eu grep $(pwd) "$1" then printf readonly 2>/dev/null
+${HOME} -eu 'quoted text' awk printf done -eu done sed grep grep cd awk sed
+	"$1" done -eu "$@" awk then $(pwd) && -eu --verbose
+		'quoted text' 2>/dev/null cd |
+	&& cd "$@" sed /usr/bin local $(pwd) export readonly sed 2>/dev/null
+/usr/bin /usr/bin export
+local ${HOME} -eu readonly $(pwd) echo sed && $(pwd)
+	x=1 /usr/bin | done echo "$@" then -eu /usr/bin
+	printf "$1" 'quoted text' cd export -eu 'quoted text'
+		/usr/bin "$@" awk 'quoted text'
+/usr/bin echo printf echo grep
+		2>/dev/null 'quoted text' awk
+		echo 2>/dev/null 2>/dev/null
+	'quoted text' local echo "$@" sed 2>/dev/null local awk echo then 2>/dev/null
+echo $(pwd) then | "$@" sed "$@" awk --verbose awk readonly cd 'quoted text'
+		readonly readonly readonly 2>/dev/null cd 2>/dev/null test /usr/bin 2>/dev/null
+		$(pwd) then readonly awk local
+	sed then -eu x=1 sed readonly
+-eu sed x=1 -eu printf && "$1" awk sed then "$@" /usr/bin
+	--verbose /usr/bin "$@" "$1" export 2>/dev/null
+		'quoted text' sed local
+		local && 'quoted text' -eu sed printf x=1 echo then --verbose
+	'quoted text' /usr/bin local
+		awk echo sed grep readonly export grep 2>/dev/null
+		test --verbose 2>/dev/null then /usr/bin export readonly awk readonly -eu
+	${HOME} done | cd cd 2>/dev/null /usr/bin 2>/dev/null 'quoted text'
+2>/dev/null "$1" ${HOME} grep cd then 2>/dev/null 2>/dev/null sed 'quoted text'
+sed x=1 /usr/bin /usr/bin ${HOME} ${HOME} -eu grep
+	'quoted text' printf -eu readonly | then
+	cd "$1" echo done $(pwd) 'quoted text' 2>/dev/null 'quoted text' sed "$1" | x=1
+	${HOME} && cd test printf cd printf ${HOME} readonly awk readonly echo local
+export "$1" echo --verbose
+	echo $(pwd) printf done &&
+		| test ${HOME} grep | && awk grep then done -eu export
+	/usr/bin printf local x=1 readonly "$@" "$1"
+2>/dev/null 2>/dev/null $(pwd) sed export
+	&& 2>/dev/null export "$1" /usr/bin grep
+	$(pwd) echo ${HOME} grep | /usr/bin
+		/usr/bin && "$1" done $(pwd) | local grep "$@" readonly done x=1 then grep
+'quoted text' local 'quoted text' readonly -eu
+--verbose export && awk export echo local /usr/bin
+		-eu awk test x=1 "$1" ${HOME} test 2>/dev/null 2>/dev/null done --verbose grep export
+		sed 2>/dev/null $(pwd) x=1 /usr/bin 'quoted text' printf x=1 readonly echo local
+		printf 'quoted text' sed local
+sed echo | then printf ${HOME}
+'quoted text' | && --verbose printf awk
+		readonly /usr/bin 2>/dev/null x=1 local printf ${HOME} readonly echo
+/usr/bin $(pwd) printf readonly
+	/usr/bin 'quoted text' export x=1 test then 2>/dev/null done 2>/dev/null 'quoted text'
+	-eu sed grep done readonly $(pwd) echo cd export
+	${HOME} "$@" && ${HOME} 2>/dev/null
+"$@" 'quoted text' echo cd printf
+done echo /usr/bin --verbose -eu then --verbose 2>/dev/null /usr/bin | grep grep
+		'quoted text' readonly test grep then /usr/bin
+	done x=1 awk ${HOME} test grep local x=1 local 2>/dev/null "$@" |
+&& grep sed 'quoted text' x=1 test --verbose ${HOME} awk 2>/dev/null
+		cd ${HOME} grep | awk "$@" cd && awk x=1
+		-eu -eu awk 2>/dev/null echo -eu local -eu awk done 'quoted text'
+	x=1 then cd cd export 'quoted text' local
+	/usr/bin awk "$@" sed awk ${HOME} --verbose
+	local 2>/dev/null readonly printf /usr/bin
+		"$1" "$@" | grep test cd local done -eu printf grep then ${HOME}
+	echo 2>/dev/null --verbose 2>/dev/null -eu echo
+		$(pwd) && export ${HOME} cd export && sed printf $(pwd)
+		sed grep done "$1" readonly -eu sed && then awk
+	-eu | test /usr/bin 2>/dev/null && 2>/dev/null /usr/bin done "$@" cd printf
+		&& "$@" export -eu &&
+	export local then | && | then export cd
+	sed readonly printf /usr/bin awk awk 2>/dev/null | x=1 export -eu &&
+		-eu readonly test $(pwd) export sed ${HOME} /usr/bin
+	"$@" | x=1 'quoted text' printf grep ${HOME}
+	&& done && done local x=1 test "$1" grep export
+		awk printf $(pwd) /usr/bin "$1" "$@" /usr/bin sed "$1" done local sed echo
+echo then | -eu test done -eu | --verbose done
+	printf /usr/bin awk sed "$@" 2>/dev/null "$1" printf $(pwd) $(pwd) printf echo 2>/dev/null
+-eu --verbose 'quoted text' "$@" | | && 'quoted text'
+		/usr/bin && cd ${HOME} awk && 2>/dev/null awk
+	local awk -eu && --verbose
+sed "$1" test echo "$@" then --verbose "$@"
+		| cd awk grep ${HOME} readonly
+		done | awk awk sed done |
+		export "$1" done x=1 test 'quoted text' 'quoted text' local done echo awk && "$1"
+	awk test sed x=1 --verbose sed /usr/bin
+awk readonly 'quoted text' "$1" && grep &&
+then export "$1" readonly awk
+		"$@" then | 'quoted text' /usr/bin
+	grep printf | cd && done done grep 2>/dev/null
+cd readonly 2>/dev/null "$@" | readonly sed sed export echo "$@" sed 'quoted text'
+	x=1 ${HOME} "$@" $(pwd) && "$1"
+	printf 2>/dev/null $(pwd) then -eu 'quoted text'
+		"$1" /usr/bin local printf 2>/dev/null done cd done 'quoted text' done
+/usr/bin $(pwd) cd -eu -eu readonly then -eu "$1" readonly done ${HOME}
+local -eu "$1" done done local grep && echo --verbose 'quoted text' awk cd
+		x=1 grep /usr/bin $(pwd) 2>/dev/null grep
+/usr/bin readonly sed test grep &&
+	then grep awk /usr/bin x=1 "$1" ${HOME}
+readonly local "$@" $(pwd) "$@" sed /usr/bin readonly
+		'quoted text' 2>/dev/null grep
+		export readonly awk $(pwd) test "$@" x=1 2>/dev/null --verbose --verbose
+test $(pwd) local echo cd done "$@"
+		"$@" local 2>/dev/null && readonly
+		/usr/bin --verbose "$@" export sed -eu 2>/dev/null && | test
+-eu $(pwd) /usr/bin awk cd "$@" "$@" | ${HOME}
+	x=1 | awk readonly then done test
+		readonly "$@" --verbose "$1" sed
+'quoted text' cd --verbose local
+2>/dev/null test test "$@" -eu export then sed readonly echo x=1 cd -eu then 2>/dev/null
+		x=1 --verbose 'quoted text'
+local readonly echo local readonly x=1 "$1" -eu
+/usr/bin "$@" 'quoted text' ${HOME}
+	&& export local export "$1" && /usr/bin $(pwd)
+	/usr/bin readonly | cd test "$1" -eu done cd $(pwd) "$@" then sed cd
+		grep awk 2>/dev/null local x=1 | test --verbose x=1 ${HOME} local | $(pwd) readonly
+		sed "$1" test printf --verbose 'quoted text' export -eu awk "$@" test done "$@"
+test /usr/bin cd "$@" "$@" cd ${HOME} test | $(pwd) readonly
+	cd x=1 grep test test | 2>/dev/null
+export "$@" "$1" 2>/dev/null grep | grep readonly "$@"
+	"$1" "$@" then $(pwd) /usr/bin
+	sed "$@" cd | echo export readonly sed test cd
+awk $(pwd) -eu "$@" then -eu
+| cd 'quoted text' -eu sed $(pwd) echo grep "$1" local echo ${HOME}
+	/usr/bin printf /usr/bin awk "$@" &&
+		--verbose then /usr/bin export then readonly --verbose
+printf sed cd 2>/dev/null "$1" 2>/dev/null $(pwd) "$1" /usr/bin printf
+| sed test /usr/bin local awk local --verbose export
+cd ${HOME} /usr/bin $(pwd) "$@"
+		awk | local ${HOME} x=1 then local local local
+	printf done local 2>/dev/null local /usr/bin done echo $(pwd) ${HOME} --verbose
+	2>/dev/null ${HOME} &&
+local | readonly --verbose /usr/bin export x=1 readonly
+x=1 x=1 2>/dev/null x=1 sed $(pwd) | echo then printf ${HOME} cd
+&& test test awk --verbose | grep "$1" test sed
+		printf 'quoted text' readonly 'quoted text'
+$(pwd) | && && cd "$1" "$1" test $(pwd) && done --verbose 2>/dev/null
+		'quoted text' printf --verbose sed echo printf
+	test printf echo -eu printf | readonly test local awk done grep printf then x=1
+local then grep $(pwd) echo readonly /usr/bin grep $(pwd) 2>/dev/null
+		${HOME} export done cd then /usr/bin awk | 'quoted text' /usr/bin $(pwd)
+		done readonly printf readonly grep cd grep /usr/bin readonly $(pwd) readonly
+	| export export x=1 printf
+readonly ${HOME} /usr/bin 'quoted text' echo printf export
+x=1 x=1 "$1" 2>/dev/null export cd then | && --verbose --verbose
+		&& local | "$1" local test sed "$@" sed then && "$1" awk test then -eu &&
+		readonly export done && cd test
+		sed done cd --verbose /usr/bin printf x=1 2>/dev/null "$@"
+		2>/dev/null then x=1 awk "$@" export 2>/dev/null | sed "$1" sed
+		&& "$@" 'quoted text' --verbose readonly "$@"
+/usr/bin echo awk echo local grep sed /usr/bin
+		-eu | && awk done "$@" sed -eu "$1" -eu cd && 'quoted text' grep |
+		&& "$@" 'quoted text' then "$1" awk sed $(pwd) -eu awk export
+	printf | "$@" local export | -eu && grep $(pwd) "$1" 2>/dev/null awk "$@" echo export
+-eu local 'quoted text' then local 2>/dev/null done local 2>/dev/null grep awk
+	echo grep 2>/dev/null cd
+${HOME} done /usr/bin "$@" export /usr/bin "$@" 2>/dev/null
+export 2>/dev/null --verbose readonly
+		"$@" done | export --verbose readonly 2>/dev/null readonly
+grep /usr/bin readonly x=1 ${HOME} && ${HOME} export
+$(pwd) sed && export test | --verbose cd
+	done "$1" readonly --verbose done "$@" grep then done "$@" 'quoted text' $(pwd)
+		cd "$1" readonly ${HOME} readonly $(pwd) printf grep "$1" && test /usr/bin
+		echo echo 'quoted text' printf && | cd sed --verbose "$@" sed grep 2>/dev/null
+	x=1 /usr/bin "$1" --verbose | sed
+	--verbose export $(pwd)
+		&& x=1 sed printf awk sed "$1" /usr/bin
+	| $(pwd) && cd cd "$1" -eu "$1" grep printf -eu ${HOME} awk printf "$@" --verbose
+	cd -eu echo "$@" $(pwd) 'quoted text' echo "$@" 'quoted text' -eu
+		local | -eu echo "$1" && echo 2>/dev/null
+	'quoted text' printf readonly
+		done $(pwd) 'quoted text'
+grep grep printf --verbose then printf
+cd 'quoted text' 'quoted text' echo local then x=1 sed --verbose
+done local test grep printf readonly && test $(pwd) echo "$@" "$@"
+awk /usr/bin "$1" 2>/dev/null -eu "$@" -eu test -eu printf x=1 local x=1 "$1"
+"$1" --verbose echo test /usr/bin "$@" export then x=1 cd $(pwd)
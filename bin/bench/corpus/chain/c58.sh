@@ -0,0 +1,2001 @@
+		echo 'quoted text' /usr/bin
+x=1 --verbose /usr/bin "$1" $(pwd)
+		| cd --verbose 'quoted text'
+	cd ${HOME} awk awk | readonly
+	then $(pwd) export $(pwd) ${HOME} grep test
+		x=1 cd export readonly "$@" --verbose local --verbose
+		x=1 test x=1 /usr/bin x=1 'quoted text' x=1 --verbose local
+	-eu $(pwd) /usr/bin x=1 'quoted text' grep local -eu readonly
+"$1" local cd sed sed sed readonly x=1 && $(pwd) ${HOME} local
+	"$1" /usr/bin --verbose done export local readonly --verbose
+		"$1" export export awk -eu 2>/dev/null
+"$@" $(pwd) readonly /usr/bin
+'quoted text' local /usr/bin export | "$@" 'quoted text'
+		2>/dev/null awk echo 'quoted text' cd -eu grep --verbose /usr/bin --verbose x=1
+		'quoted text' test x=1 awk $(pwd) test readonly &&
+		readonly | done local echo
+grep cd readonly then
+	readonly "$@" $(pwd) $(pwd) then "$1" x=1 && 2>/dev/null
+		2>/dev/null echo echo test /usr/bin && "$1" readonly test
+		${HOME} export export "$@" "$1" 2>/dev/null $(pwd) -eu cd cd export
+&& cd && && | | -eu --verbose sed 'quoted text'
+2>/dev/null ${HOME} then "$@" echo echo test echo x=1 grep ${HOME} /usr/bin
+	sed grep | "$@" sed echo awk then "$1" export
+printf readonly 'quoted text' test cd $(pwd)
+		$(pwd) sed ${HOME} ${HOME} readonly | awk done test "$1"
+export test 2>/dev/null grep readonly cd && /usr/bin
+		"$@" /usr/bin cd grep | -eu "$@" && /usr/bin
+export 'quoted text' ${HOME} awk -eu | "$@" echo $(pwd) done x=1 'quoted text' 2>/dev/null
+	local grep local "$1" /usr/bin && cd export --verbose 2>/dev/null
+		x=1 'quoted text' export 'quoted text' -eu
+	| | cd ${HOME} then && x=1 $(pwd) cd | sed done then
+	export printf printf export
+		grep readonly then "$@" 2>/dev/null 'quoted text' "$@" -eu -eu echo &&
+sed -eu done $(pwd) --verbose 2>/dev/null test
+	$(pwd) readonly && sed local grep "$@"
+	local --verbose echo /usr/bin then then sed /usr/bin
+		then -eu echo && export 'quoted text' local ${HOME} x=1 local
+	sed grep $(pwd) printf done then
+	test $(pwd) export ${HOME}
+	sed export | && readonly echo local -eu printf | readonly --verbose | /usr/bin
+	done echo cd cd readonly "$@" cd "$1" printf /usr/bin echo test done awk
+		"$1" awk $(pwd) | export -eu $(pwd) | | && && export printf && test x=1 | cd
+		"$1" local printf && local
+		'quoted text' readonly export | test 2>/dev/null awk done --verbose
+		echo 2>/dev/null x=1 2>/dev/null && "$1" cd test export 'quoted text'
+		readonly -eu done $(pwd) then
+export x=1 /usr/bin export /usr/bin ${HOME} sed readonly | export $(pwd)
+	awk echo 2>/dev/null test
+&& 2>/dev/null sed 2>/dev/null "$@" sed echo $(pwd) printf $(pwd) export export
+	--verbose test sed "$1" $(pwd) sed $(pwd) test then export
+		awk grep $(pwd) -eu "$@" sed export
+sed 'quoted text' readonly grep "$@" readonly "$1" awk grep
+	grep cd sed ${HOME} "$@" readonly then export grep export --verbose cd 2>/dev/null
+		printf awk sed | $(pwd) && x=1 sed export done 'quoted text'
+	"$@" --verbose sed export
+		2>/dev/null $(pwd) 'quoted text'
+		sed 'quoted text' /usr/bin echo local "$1" grep echo echo printf && | printf
+local "$1" done printf sed x=1 /usr/bin export echo local 'quoted text' grep 2>/dev/null
+	${HOME} test test $(pwd) sed
+| echo export readonly -eu
+		echo x=1 | export 2>/dev/null
+awk local sed x=1 && export then -eu printf 2>/dev/null local echo export
+		"$1" readonly "$1" cd x=1 awk ${HOME} --verbose "$@"
+x=1 $(pwd) echo $(pwd) local printf "$1" 2>/dev/null ${HOME} export 'quoted text'
+	done -eu sed readonly 2>/dev/null
+		${HOME} echo awk 2>/dev/null
+	cd /usr/bin echo done ${HOME} done "$@" printf ${HOME} export ${HOME}
+export /usr/bin echo $(pwd) /usr/bin "$@" test done
+		sed cd /usr/bin | -eu "$1" export /usr/bin "$@"
+awk export /usr/bin && -eu 2>/dev/null
+awk 'quoted text' printf echo export test export x=1 local
+cd ${HOME} --verbose && echo grep test | readonly
+/usr/bin 'quoted text' local printf then done /usr/bin then $(pwd) --verbose grep
+		$(pwd) done grep --verbose 2>/dev/null echo 'quoted text' 2>/dev/null
+	cd /usr/bin readonly $(pwd) cd
+	$(pwd) grep x=1 | awk cd && then done -eu "$1" echo test sed test printf
+		grep then 'quoted text'
+	done cd local local test ${HOME} printf
+	printf printf --verbose 2>/dev/null | awk $(pwd) then x=1
+		sed "$1" /usr/bin local | ${HOME} ${HOME} | sed "$1" cd $(pwd) "$@" test
+	2>/dev/null readonly readonly 2>/dev/null
+		done 2>/dev/null | test grep sed readonly cd awk cd echo x=1 'quoted text'
+		test printf grep x=1 x=1
+	sed sed echo awk $(pwd) /usr/bin cd "$1" cd "$1" /usr/bin x=1
+--verbose readonly "$@" test
+		readonly readonly "$1" test local done export "$@" printf /usr/bin 'quoted text'
+	readonly local | cd printf x=1 'quoted text'
+&& awk | /usr/bin local export awk -eu awk --verbose /usr/bin
+2>/dev/null local $(pwd) printf x=1 cd then
+	readonly $(pwd) cd printf "$@" sed && --verbose ${HOME} then ${HOME} awk ${HOME}
+		grep local -eu readonly
+| printf cd done && x=1 --verbose && export 2>/dev/null export then
+	/usr/bin | printf readonly cd echo && 'quoted text'
+--verbose 2>/dev/null done sed
+		then local printf "$1" local /usr/bin 2>/dev/null done --verbose grep
+	${HOME} awk --verbose grep
+		test test -eu export x=1 readonly echo 2>/dev/null awk | && -eu "$1"
+"$@" printf cd && then --verbose "$@" export grep cd 2>/dev/null
+'quoted text' | | x=1 local echo test ${HOME} readonly
+		sed | done "$1" --verbose | "$@" test grep "$@" "$1" cd ${HOME}
+		2>/dev/null cd ${HOME} --verbose cd -eu $(pwd)
+	'quoted text' printf /usr/bin cd 'quoted text' "$@" /usr/bin 2>/dev/null
+readonly local | grep
+	2>/dev/null local export | && awk 2>/dev/null $(pwd)
+x=1 done && test grep x=1 local
+	2>/dev/null local then 'quoted text' awk readonly && echo export -eu
+		x=1 grep test cd echo 2>/dev/null echo then 'quoted text'
+		grep test cd printf x=1
+	$(pwd) 2>/dev/null | -eu printf test ${HOME}
+		local cd -eu --verbose "$1" "$1" 2>/dev/null
+cd then "$@" 'quoted text' cd echo "$@" $(pwd) /usr/bin
+	echo done /usr/bin | echo "$1" echo ${HOME} -eu local export done
+"$1" export then $(pwd) 'quoted text'
+	then /usr/bin ${HOME} readonly | x=1 2>/dev/null "$@" ${HOME}
+export "$@" echo 'quoted text' printf /usr/bin cd then x=1 then 'quoted text'
+		2>/dev/null export 'quoted text'
+--verbose then ${HOME} done 2>/dev/null awk readonly "$1" "$@"
+	'quoted text' readonly
+2>/dev/null local 2>/dev/null local
+cd ${HOME} cd awk 2>/dev/null $(pwd) printf done then
+	cd awk done echo "$1" printf echo echo
+	echo test echo --verbose
+$(pwd) --verbose cd sed
+	&& /usr/bin sed ${HOME} $(pwd) grep export /usr/bin && then printf done then
+	sed printf --verbose test
+	2>/dev/null sed | awk awk awk export
+test cd 2>/dev/null "$@" readonly | local printf 'quoted text' 'quoted text'
+		x=1 cd 2>/dev/null export x=1 done sed /usr/bin -eu -eu x=1 ${HOME}
+		printf --verbose printf echo && --verbose echo done 'quoted text'
+"$@" export readonly done "$1" export "$@" --verbose /usr/bin grep
+		echo | test ${HOME} $(pwd) | cd 'quoted text' done 2>/dev/null awk sed
+	"$1" "$1" 'quoted text' && local
+then echo then /usr/bin awk 'quoted text'
+test && 'quoted text' x=1 "$@" awk readonly
+		done ${HOME} grep 2>/dev/null grep cd 'quoted text' && export
+		grep test readonly done --verbose
+&& 2>/dev/null "$@" grep --verbose awk readonly
+-eu printf "$@" readonly export printf then -eu ${HOME} ${HOME} then "$@" local
+	echo "$1" local cd then /usr/bin x=1 export
+		readonly "$1" awk "$1" grep test /usr/bin printf awk 'quoted text' awk local /usr/bin
+grep export echo grep sed
+		"$@" grep -eu printf local
+	| sed echo local -eu "$1" export ${HOME} ${HOME} grep 2>/dev/null && "$@"
+x=1 awk then grep "$1" done -eu export printf "$@" "$@" ${HOME} /usr/bin
+	local "$1" x=1 echo readonly test awk local
+		/usr/bin test --verbose 'quoted text'
+x=1 local cd test /usr/bin
+	echo $(pwd) -eu "$1" printf 2>/dev/null && "$1" 2>/dev/null
+		"$1" && /usr/bin awk sed sed 2>/dev/null
+	--verbose "$@" export --verbose awk "$1" done then then
+	| cd awk grep then local "$1" -eu /usr/bin --verbose readonly --verbose
+		sed awk "$@" cd then $(pwd)
+		cd "$1" awk grep readonly 2>/dev/null x=1 printf -eu
+grep sed ${HOME} "$1" | -eu echo && awk $(pwd) "$@" "$1" -eu readonly --verbose
+	test awk 'quoted text' "$1" test printf
+2>/dev/null awk sed sed --verbose "$@" 'quoted text' test printf -eu
+/usr/bin awk $(pwd) 2>/dev/null ${HOME}
+'quoted text' | "$1" $(pwd) sed "$@" 2>/dev/null
+		--verbose ${HOME} readonly
+		then -eu local cd "$1" readonly "$1" $(pwd) 2>/dev/null local test
+	-eu | /usr/bin grep awk $(pwd) test grep 2>/dev/null
+	$(pwd) printf test done then $(pwd) "$@" sed -eu --verbose -eu readonly
+	"$@" -eu 'quoted text' x=1
+| $(pwd) && $(pwd) awk sed $(pwd) grep
+	grep && "$@" cd ${HOME} done test
+	&& done --verbose "$1" awk awk test x=1 ${HOME} grep -eu then --verbose
+	printf local awk readonly 'quoted text' grep sed && | test 2>/dev/null printf /usr/bin
+		&& 'quoted text' /usr/bin awk test export printf ${HOME}
+export printf 2>/dev/null awk then x=1 done
+	sed echo echo /usr/bin $(pwd) ${HOME} "$@"
+done 'quoted text' "$1" test ${HOME} done printf echo x=1 local
+		test done readonly /usr/bin && && -eu readonly
+test "$1" grep 'quoted text' "$1" --verbose export readonly -eu grep "$@"
+		$(pwd) printf echo | x=1 | --verbose sed
+		-eu cd && local 2>/dev/null
+	"$@" "$@" then /usr/bin 'quoted text' /usr/bin cd
+	readonly 2>/dev/null printf --verbose
+${HOME} test | 2>/dev/null $(pwd) -eu sed 'quoted text' -eu 'quoted text'
+$(pwd) printf /usr/bin
+		'quoted text' printf printf 'quoted text' $(pwd) done sed echo awk readonly | x=1
+		&& /usr/bin 'quoted text' echo sed 2>/dev/null && export 'quoted text' local
+	then awk "$@" readonly
+2>/dev/null export && then echo x=1 echo cd "$1" grep awk
+	echo awk done grep | -eu --verbose
+		--verbose -eu local awk -eu 2>/dev/null
+	echo "$1" sed x=1 | x=1 "$@" printf $(pwd) |
+		printf $(pwd) | then 2>/dev/null x=1 -eu --verbose -eu then && grep | sed ${HOME}
+done export x=1 local | grep printf x=1 "$@" grep printf /usr/bin
+	printf done then $(pwd) awk $(pwd) awk sed then --verbose
+	/usr/bin cd --verbose awk x=1
+		'quoted text' 2>/dev/null x=1 |
+		grep export cd done 'quoted text' awk echo done
+local --verbose grep --verbose -eu sed cd done test ${HOME} $(pwd)
+echo x=1 x=1 test sed printf awk $(pwd) awk "$1" sed sed
+	${HOME} cd export awk test
+		readonly readonly readonly 'quoted text' $(pwd) 'quoted text'
+'quoted text' 2>/dev/null
+${HOME} grep $(pwd) printf test 'quoted text' printf test
+		printf "$1" 'quoted text' "$@" -eu 2>/dev/null
+		/usr/bin local | 'quoted text' x=1 cd /usr/bin $(pwd) ${HOME} |
+printf "$@" echo $(pwd) cd -eu --verbose
+"$@" -eu x=1 local x=1 -eu test "$@"
+printf -eu local "$@" readonly | then
+	readonly "$1" -eu test awk printf | then
+	/usr/bin grep echo /usr/bin export
+		${HOME} local then printf $(pwd) echo readonly printf $(pwd) sed
+awk export x=1 x=1 --verbose
+		&& grep x=1 awk --verbose "$@" "$1" -eu done printf printf | && && "$1" printf local
+	done "$1" then sed printf 2>/dev/null "$1" x=1 "$1" printf /usr/bin cd
+		-eu readonly x=1 -eu grep ${HOME} /usr/bin
+	grep 2>/dev/null local export x=1 done 'quoted text' awk /usr/bin
+		then readonly then readonly /usr/bin
+		awk grep readonly grep test 'quoted text'
+		then 2>/dev/null test export 'quoted text'
+&& done local -eu x=1 printf | test $(pwd) local sed awk readonly "$1"
+	grep printf "$1" | then
+	done echo 2>/dev/null | "$@" ${HOME} | sed --verbose local grep "$1" sed
+		local -eu then && printf then echo
+	local x=1 "$@" "$1" sed cd 'quoted text'
+		printf export "$1" sed awk /usr/bin ${HOME} done then $(pwd) grep export then
+export "$@" && cd cd cd x=1 $(pwd)
+		awk done awk cd && $(pwd) test | && echo && "$@" x=1
+readonly grep "$@" test sed 2>/dev/null
+		"$1" then done then --verbose -eu && "$1" && echo /usr/bin grep then awk "$1"
+/usr/bin -eu /usr/bin "$@" test /usr/bin test sed -eu
+	done $(pwd) -eu 'quoted text' export --verbose | echo
+x=1 ${HOME} 2>/dev/null export cd
+$(pwd) -eu && awk grep && --verbose "$@" echo
+	| "$1" sed /usr/bin 2>/dev/null readonly sed -eu then sed test done 'quoted text'
+echo readonly | --verbose $(pwd) "$1" 'quoted text'
+		then -eu "$@" $(pwd) printf cd test export cd
+		sed export printf &&
+		| sed grep "$1" | grep then done export x=1 --verbose local
+	echo cd "$@" readonly awk x=1 test 'quoted text' then "$@" -eu awk x=1
+		test | done awk 2>/dev/null done echo grep 'quoted text'
+/usr/bin ${HOME} test 'quoted text' test cd sed
+		${HOME} 'quoted text' echo awk ${HOME}
+export -eu | ${HOME} local 'quoted text' cd sed 'quoted text' export 'quoted text'
+	'quoted text' awk awk sed 2>/dev/null
+	then test --verbose | "$@" cd "$1" test 2>/dev/null "$1" printf "$1" -eu --verbose
+-eu then /usr/bin | --verbose test $(pwd) && "$@" 2>/dev/null
+	awk 2>/dev/null "$@" x=1 printf echo -eu test x=1 | then ${HOME} "$@" export
+/usr/bin x=1 test "$1" 2>/dev/null export echo ${HOME}
+readonly /usr/bin | -eu 2>/dev/null $(pwd) | grep "$@"
+		2>/dev/null export 2>/dev/null /usr/bin sed readonly ${HOME}
+	| x=1 awk awk /usr/bin /usr/bin x=1 "$@" printf echo awk ${HOME} 2>/dev/null
+	| local printf readonly x=1 printf 2>/dev/null then
+x=1 export -eu grep ${HOME} readonly done $(pwd) | /usr/bin
+	&& then --verbose readonly awk /usr/bin /usr/bin readonly $(pwd) local |
+	local x=1 done cd "$@" then local "$@"
+		sed awk then done done test echo sed "$@" cd 'quoted text'
+	grep grep 2>/dev/null done
+	cd /usr/bin awk -eu /usr/bin && x=1 grep x=1 sed $(pwd) 'quoted text' done grep
+		"$@" ${HOME} $(pwd) ${HOME} --verbose cd test printf --verbose "$@" ${HOME}
+	local readonly "$1" $(pwd)
+${HOME} grep 'quoted text' x=1 -eu x=1 /usr/bin
+&& export -eu 2>/dev/null 'quoted text' local export | test 'quoted text'
+	x=1 /usr/bin awk done -eu
+		done then -eu echo -eu && awk grep export local echo
+	| readonly $(pwd) local && test
+	x=1 "$1" /usr/bin /usr/bin | $(pwd)
+		${HOME} readonly local test ${HOME} then cd
+		readonly sed done --verbose grep
+	-eu | sed $(pwd) cd -eu export test cd export printf "$@" -eu
+	then readonly then then sed printf
+		${HOME} then export x=1 "$@" grep --verbose
+printf | grep export --verbose
+		"$@" x=1 "$@" printf local cd sed && printf "$1" x=1 "$1"
+		readonly $(pwd) && 'quoted text' then grep "$@" echo
+	echo awk && -eu 'quoted text' /usr/bin | 'quoted text'
+		x=1 -eu && 'quoted text' local sed awk sed awk local --verbose
+--verbose $(pwd) export local
+		| x=1 cd && cd readonly $(pwd) sed x=1 grep done "$1"
+/usr/bin printf export x=1 /usr/bin $(pwd) sed export
+		"$@" then echo sed done printf echo printf && 2>/dev/null local test 'quoted text'
+local && cd test done | echo -eu then
+export echo awk test -eu export local test $(pwd) -eu printf then -eu then
+"$1" && ${HOME} readonly export echo
+		'quoted text' /usr/bin "$1" -eu "$1" --verbose done readonly
+	--verbose ${HOME} 2>/dev/null test "$@" 'quoted text'
+awk echo 2>/dev/null readonly
+-eu printf "$@" $(pwd) -eu export 'quoted text' "$@" "$@" cd | done then |
+	sed done done printf export awk readonly printf
+	"$@" 2>/dev/null grep 'quoted text' readonly "$1" ${HOME} | &&
+2>/dev/null cd done readonly ${HOME} export x=1 "$1" "$@"
+	"$@" 2>/dev/null awk export "$1" --verbose "$@" test &&
+done 2>/dev/null 2>/dev/null ${HOME} then export 'quoted text' && sed then then
+	cd | awk "$@" | && grep echo -eu "$@" readonly awk x=1 ${HOME} then --verbose
+	$(pwd) local --verbose 2>/dev/null "$1" | sed 'quoted text'
+		/usr/bin done $(pwd) export then $(pwd) && cd export 'quoted text' cd printf readonly
+		sed grep then && awk 2>/dev/null "$@" --verbose awk 2>/dev/null
+	${HOME} 2>/dev/null | -eu /usr/bin --verbose /usr/bin | "$@" ${HOME} x=1 $(pwd)
+'quoted text' 'quoted text' ${HOME}
+		/usr/bin 2>/dev/null $(pwd) readonly
+	-eu | test 'quoted text' printf
+	sed printf /usr/bin local
+2>/dev/null awk readonly
+		cd readonly echo -eu export export cd then x=1 'quoted text'
+	local /usr/bin && cd cd readonly x=1 "$1" 2>/dev/null done printf echo "$1"
+	${HOME} echo && readonly printf awk x=1 ${HOME} cd $(pwd)
+	| "$@" readonly --verbose |
+cd readonly --verbose $(pwd) "$1" 'quoted text' cd 'quoted text' done
+x=1 --verbose -eu local
+		readonly export 2>/dev/null echo done
+		$(pwd) done "$1" local export cd printf then grep sed && ${HOME} /usr/bin
+-eu sed x=1 cd -eu printf then | 2>/dev/null awk 'quoted text' then
+		cd "$1" local cd echo printf printf x=1 "$@" | x=1 2>/dev/null $(pwd) then
+	local grep 2>/dev/null export local "$1" grep cd /usr/bin "$@"
+		"$1" 'quoted text' 2>/dev/null x=1 test done test
+export --verbose then then done 2>/dev/null cd grep local cd -eu && awk
+| | then readonly done local local grep export awk 2>/dev/null echo /usr/bin
+		-eu | $(pwd) ${HOME} | 2>/dev/null x=1 && test printf $(pwd) grep 'quoted text'
+	--verbose test -eu | /usr/bin done export
+		sed --verbose done awk && /usr/bin && echo local $(pwd) printf
+		readonly awk --verbose awk x=1 test && sed x=1 "$1" 2>/dev/null /usr/bin 2>/dev/null
+grep then awk grep test test $(pwd) local done export 2>/dev/null 2>/dev/null
+awk "$@" -eu "$1" && awk "$1" 2>/dev/null && "$1" echo /usr/bin "$1" readonly
+"$@" test export export | 2>/dev/null cd --verbose echo -eu x=1 | sed test
+	x=1 && done echo export && done cd then
+	export test --verbose readonly
+awk "$@" sed | "$@" "$@" printf local
+/usr/bin local x=1 | ${HOME} 2>/dev/null 'quoted text' echo ${HOME} done
+readonly readonly ${HOME} 'quoted text' echo "$@" sed | -eu
+	awk test cd echo && "$@" printf done grep sed 2>/dev/null "$@" ${HOME} readonly
+		cd x=1 awk -eu --verbose export 2>/dev/null "$@" ${HOME} -eu printf ${HOME}
+/usr/bin awk x=1 sed
+		local local local sed "$@" printf echo then ${HOME} echo
+	${HOME} then readonly sed && grep done done awk grep cd printf
+	'quoted text' /usr/bin -eu -eu x=1 export
+		| x=1 then export --verbose ${HOME} | 2>/dev/null export 2>/dev/null local
+--verbose $(pwd) local "$@" grep --verbose
+		then sed grep $(pwd) 2>/dev/null
+	test readonly awk 2>/dev/null test grep done printf then
+		readonly awk /usr/bin
+	test 'quoted text' 'quoted text' -eu
+		then 2>/dev/null "$1" 'quoted text' /usr/bin done 'quoted text' sed
+"$@" cd $(pwd) cd sed readonly done 2>/dev/null
+2>/dev/null --verbose echo printf 'quoted text' sed -eu -eu test $(pwd) $(pwd) test
+	| readonly --verbose done
+		/usr/bin "$1" test "$1" 2>/dev/null printf /usr/bin ${HOME} local
+	then | test echo awk 'quoted text' cd sed ${HOME}
+		done x=1 'quoted text' &&
+	/usr/bin 'quoted text' then done printf export x=1 done
+		done /usr/bin $(pwd) 2>/dev/null grep ${HOME} /usr/bin /usr/bin
+	${HOME} /usr/bin then cd printf "$@" cd "$1" test printf
+		cd readonly done then x=1 2>/dev/null readonly $(pwd) cd
+		-eu printf printf cd echo
+		"$@" 'quoted text' cd | 'quoted text' ${HOME} -eu ${HOME} && ${HOME} export
+echo done 2>/dev/null "$1"
+/usr/bin --verbose 'quoted text' 2>/dev/null
+test test 2>/dev/null test x=1 --verbose export /usr/bin
+then done -eu $(pwd) $(pwd) grep cd test /usr/bin "$@" | "$1" ${HOME} sed
+echo /usr/bin x=1 | x=1 2>/dev/null then test -eu | | | "$@" |
+	printf "$@" printf test && /usr/bin "$1" | $(pwd)
+	echo cd -eu local ${HOME}
+	&& 2>/dev/null && ${HOME} printf
+		"$@" echo x=1 'quoted text' --verbose readonly $(pwd) "$@" then 2>/dev/null
+		-eu printf local ${HOME} | ${HOME} -eu
+printf done 'quoted text' grep && echo | 2>/dev/null /usr/bin awk ${HOME} && -eu
+test readonly -eu cd "$@" -eu echo 'quoted text' then cd -eu local
+	done done --verbose x=1 export -eu echo done $(pwd) local $(pwd) "$@" ${HOME}
+printf echo cd 'quoted text' -eu local done grep -eu test x=1 'quoted text' &&
+		${HOME} "$1" local | grep "$@"
+	then awk --verbose readonly -eu --verbose -eu 2>/dev/null export --verbose "$1"
+grep "$@" -eu ${HOME} 2>/dev/null test 'quoted text'
+		local local done | cd local 2>/dev/null ${HOME} test ${HOME} 'quoted text' export
+		sed /usr/bin "$1" export -eu done readonly
+		${HOME} -eu test local ${HOME} sed $(pwd) awk ${HOME} /usr/bin
+		sed ${HOME} then "$@" printf -eu printf "$1" "$1" export grep local readonly awk
+readonly $(pwd) /usr/bin export test |
+x=1 awk sed sed grep x=1 grep cd awk grep grep readonly x=1 $(pwd)
+		"$1" test sed local sed 2>/dev/null
+	--verbose ${HOME} 'quoted text'
+		${HOME} local grep x=1 -eu cd "$1" grep ${HOME} | printf printf
+	test "$@" echo x=1 local | test
+	| 'quoted text' 'quoted text' 2>/dev/null $(pwd)
+export "$@" | && printf
+		then 2>/dev/null /usr/bin /usr/bin
+		'quoted text' -eu /usr/bin awk grep && awk test "$1"
+awk done -eu then "$@" export echo printf printf grep -eu
+2>/dev/null --verbose then | && printf $(pwd) then $(pwd) | sed then $(pwd)
+		x=1 && test printf readonly | then export printf
+	export cd local -eu "$@"
+		/usr/bin then 2>/dev/null --verbose
+-eu -eu test "$1" "$@" 2>/dev/null test done
+	--verbose readonly test /usr/bin sed export --verbose
+export x=1 cd echo test readonly /usr/bin && "$@" /usr/bin grep "$1"
+	"$@" /usr/bin test 'quoted text'
+		"$@" grep /usr/bin test test sed
+		"$1" ${HOME} 'quoted text' printf | $(pwd) ${HOME} sed --verbose "$@"
+	sed ${HOME} sed --verbose cd export echo 2>/dev/null 2>/dev/null readonly "$1"
+${HOME} ${HOME} awk -eu sed done && "$@" ${HOME} "$@"
+printf echo /usr/bin sed "$@" readonly sed /usr/bin -eu "$1"
+	echo cd 'quoted text' "$@" printf awk --verbose 2>/dev/null sed echo
+		printf --verbose printf
+/usr/bin | && export export awk readonly "$@"
+	$(pwd) | 'quoted text' 'quoted text'
+		${HOME} cd test awk ${HOME} export done grep printf x=1 x=1 "$@" export "$1" then
+		$(pwd) test "$1" $(pwd) -eu | cd test done -eu cd echo /usr/bin readonly
+		export local /usr/bin | --verbose
+		done 'quoted text' && export grep x=1 done then
+-eu x=1 sed done local local export | awk && "$1"
+	test cd 'quoted text' awk $(pwd) grep -eu local local | readonly
+		cd grep cd | grep $(pwd) done x=1 && printf /usr/bin --verbose readonly
+		grep 'quoted text' done ${HOME} "$1" local 2>/dev/null grep echo && export sed /usr/bin
+	readonly -eu -eu "$@" done 'quoted text' done export && echo printf sed x=1
+2>/dev/null test sed -eu "$1" x=1 ${HOME} done awk sed 'quoted text'
+	/usr/bin /usr/bin --verbose 2>/dev/null
+		then test 'quoted text' printf
+$(pwd) x=1 export cd test test readonly sed x=1 "$1" printf
+cd "$1" sed 2>/dev/null | 'quoted text'
+'quoted text' && sed ${HOME} && echo --verbose awk --verbose printf cd done sed
+	/usr/bin test x=1 2>/dev/null
+		printf grep done sed "$1" readonly export ${HOME} "$1" then 'quoted text'
+		2>/dev/null echo 2>/dev/null export "$1" -eu "$@" x=1 x=1 readonly
+	grep -eu "$@" local ${HOME} 2>/dev/null cd then test grep 2>/dev/null
+	"$1" export -eu export ${HOME}
+${HOME} done $(pwd) ${HOME} ${HOME}
+printf -eu 2>/dev/null /usr/bin 2>/dev/null x=1 /usr/bin
+grep local cd -eu --verbose
+		awk 'quoted text' ${HOME} -eu printf 'quoted text' x=1 /usr/bin
+	$(pwd) export | awk done ${HOME}
+	-eu "$@" --verbose ${HOME} -eu && 2>/dev/null 2>/dev/null export /usr/bin
+		cd 2>/dev/null sed | 2>/dev/null done | 2>/dev/null "$@" readonly "$1" "$@"
+$(pwd) cd export "$1" 2>/dev/null grep "$1" --verbose -eu local ${HOME} printf
+		x=1 test export 2>/dev/null /usr/bin
+		echo -eu local -eu /usr/bin then local 'quoted text'
+	-eu awk $(pwd) printf && readonly /usr/bin
+	local -eu then readonly awk && 'quoted text' /usr/bin "$1" --verbose grep
+	"$@" /usr/bin cd local -eu /usr/bin
+/usr/bin "$@" ${HOME} && sed /usr/bin local ${HOME} done "$1" echo "$1" $(pwd)
+then test export ${HOME} test sed grep local
+		&& && 'quoted text' test test export
+		${HOME} 'quoted text' awk printf printf $(pwd)
+	&& echo 2>/dev/null 'quoted text' ${HOME} 2>/dev/null
+/usr/bin | grep printf awk x=1 "$@" grep | 2>/dev/null test x=1 ${HOME} printf /usr/bin
+	"$@" local x=1 -eu 'quoted text' "$1" 'quoted text' local echo
+/usr/bin then 'quoted text' export -eu cd done -eu
+'quoted text' echo /usr/bin "$1" /usr/bin --verbose
+		"$1" echo readonly sed awk test cd 'quoted text' x=1 /usr/bin
+"$1" sed /usr/bin grep --verbose x=1 echo "$@" sed "$@"
+readonly ${HOME} test cd readonly
+		x=1 printf printf sed awk /usr/bin export 2>/dev/null
+	done ${HOME} x=1 $(pwd) grep then
+	/usr/bin then printf echo grep --verbose --verbose test "$@" echo sed
+| then readonly "$1" awk && done -eu x=1 'quoted text' grep cd 2>/dev/null
+		export readonly | x=1 ${HOME} test cd -eu
+'quoted text' export -eu 2>/dev/null local && ${HOME} -eu --verbose
+	awk export grep "$1" && 2>/dev/null readonly sed sed local
+	cd printf "$1" export x=1 x=1 cd | readonly then cd ${HOME}
+/usr/bin /usr/bin --verbose x=1 "$@" --verbose
+	2>/dev/null ${HOME} sed awk awk printf local printf printf
+		then sed export "$@" cd local done ${HOME}
+		--verbose | grep 2>/dev/null test ${HOME} export
+	"$1" && test && -eu "$@" readonly
+/usr/bin --verbose ${HOME} done echo then | && && -eu "$1" done
+"$1" test x=1 awk awk done
+"$@" then export cd sed grep && awk /usr/bin test cd $(pwd) ${HOME} echo
+sed ${HOME} --verbose --verbose -eu
+test $(pwd) readonly printf printf awk 'quoted text' test awk 2>/dev/null
+done cd 2>/dev/null /usr/bin export ${HOME}
+	"$1" awk -eu done 'quoted text' $(pwd) grep test
+		export $(pwd) 2>/dev/null $(pwd)
+readonly readonly done cd echo && sed cd $(pwd) cd 'quoted text'
+	test printf printf then done x=1 export sed readonly readonly
+		$(pwd) then $(pwd) grep --verbose sed test ${HOME} echo "$1"
+		${HOME} printf done "$@" "$@" local 2>/dev/null $(pwd) ${HOME} "$@" done 'quoted text'
+	| "$@" "$1" printf readonly sed && cd | "$1"
+	$(pwd) printf /usr/bin "$1" /usr/bin x=1 cd "$1" printf
+-eu awk x=1 cd "$@" ${HOME} --verbose test export grep local awk ${HOME}
+	sed grep --verbose x=1 echo /usr/bin readonly echo test -eu ${HOME} done grep
+	| x=1 echo /usr/bin test echo awk && done ${HOME} printf "$@"
+		local awk ${HOME} | then echo && printf awk "$1" "$@" grep awk | readonly
+		grep 2>/dev/null sed done | local 2>/dev/null done /usr/bin ${HOME} sed ${HOME}
+	"$1" 'quoted text' x=1 /usr/bin 2>/dev/null local && 'quoted text'
+		| 'quoted text' local 2>/dev/null 'quoted text' export 2>/dev/null ${HOME}
+		2>/dev/null done awk readonly --verbose echo ${HOME} ${HOME} export
+then echo test readonly "$1" "$1" sed
+		cd then "$1" export done /usr/bin /usr/bin
+	--verbose x=1 -eu && "$@" awk printf /usr/bin
+	--verbose local grep printf
+		"$@" echo awk | "$@" --verbose awk cd 2>/dev/null "$@"
+printf printf | "$1" done | cd
+	$(pwd) printf done "$1" then --verbose done 2>/dev/null
+readonly "$1" awk /usr/bin then --verbose "$@" readonly "$@" ${HOME} local
+	&& && awk x=1 | done printf sed 2>/dev/null readonly
+	--verbose then | --verbose
+--verbose ${HOME} x=1 export --verbose cd
+	$(pwd) --verbose local export then -eu readonly
+	then then done "$@" then local "$1" sed && awk 2>/dev/null ${HOME} then
+		test 'quoted text' done readonly then cd then
+		&& "$1" then "$@" done echo printf x=1 local 2>/dev/null -eu then
+	'quoted text' echo && grep 'quoted text' local && | local readonly --verbose
+"$@" printf then | "$1" grep ${HOME} /usr/bin "$@" done
+		--verbose then --verbose "$1" cd export then printf
+done sed x=1 test 'quoted text' /usr/bin /usr/bin test | echo
+/usr/bin && /usr/bin && grep done done && echo echo echo x=1 test export export
+sed 'quoted text' ${HOME} "$1" ${HOME} $(pwd) test export local x=1 -eu
+$(pwd) test x=1 -eu grep cd x=1 awk -eu
+	grep export cd then cd grep $(pwd) && "$1"
+sed 2>/dev/null sed awk test test "$1" done "$@" -eu "$1" echo
+"$1" done awk | printf $(pwd) readonly
+		echo "$1" cd grep export && local
+		$(pwd) then awk grep 'quoted text' cd -eu -eu
+		echo 'quoted text' -eu grep printf then echo | echo /usr/bin /usr/bin &&
+		--verbose test printf "$1"
+	$(pwd) printf readonly -eu grep cd awk -eu "$1" && "$@" 2>/dev/null
+/usr/bin 2>/dev/null "$@" echo
+2>/dev/null echo x=1 'quoted text'
+	readonly then ${HOME} -eu | 2>/dev/null sed
+cd cd cd done x=1 done $(pwd) 2>/dev/null sed cd ${HOME} grep local
+	&& -eu 2>/dev/null --verbose $(pwd) --verbose x=1 $(pwd) done sed sed $(pwd) cd
+cd "$@" printf readonly
+--verbose printf readonly cd ${HOME} export echo readonly
+		| then printf readonly "$@" sed test
+		--verbose ${HOME} grep x=1 $(pwd) printf && readonly --verbose export
+		export printf x=1 sed | awk 2>/dev/null sed awk readonly -eu done $(pwd)
+x=1 sed export | | x=1 local cd echo $(pwd) printf sed done
+	awk ${HOME} 2>/dev/null sed then 2>/dev/null 'quoted text' then test local
+sed | sed grep readonly sed ${HOME} echo printf test -eu /usr/bin
+	readonly grep sed sed 2>/dev/null /usr/bin grep $(pwd) | export
+		done -eu grep && echo --verbose "$@" 'quoted text' $(pwd) readonly ${HOME}
+		test -eu 'quoted text' done --verbose sed ${HOME} --verbose
+	"$@" && | -eu echo -eu test done 'quoted text' then sed 2>/dev/null ${HOME}
+		sed export export done done test ${HOME} ${HOME}
+	| 'quoted text' 2>/dev/null ${HOME} grep echo "$1"
+	x=1 x=1 readonly cd local -eu "$1" test -eu "$@" "$1" ${HOME} /usr/bin | local
+	echo grep 2>/dev/null printf "$@" awk 'quoted text' "$@" then "$1" -eu
+	done cd -eu x=1 --verbose test /usr/bin grep 'quoted text'
+	"$@" /usr/bin --verbose -eu cd $(pwd) $(pwd) &&
+		--verbose then && export export grep
+then printf ${HOME} done done ${HOME} done /usr/bin -eu
+	"$1" x=1 "$1" | printf ${HOME} && /usr/bin $(pwd) export
+x=1 local printf ${HOME} test | sed -eu 'quoted text' 'quoted text' done test echo
+		awk && sed cd | 'quoted text' x=1 sed ${HOME} -eu awk ${HOME} test
+	--verbose sed | $(pwd) echo done
+readonly 'quoted text' cd 'quoted text' | x=1 && && awk ${HOME}
+	"$1" $(pwd) 'quoted text' 2>/dev/null test $(pwd) "$@" &&
+	cd 2>/dev/null cd local | ${HOME} sed test
+		export then && 2>/dev/null -eu grep --verbose 2>/dev/null grep cd cd --verbose
+		$(pwd) readonly echo printf grep test -eu awk $(pwd) && test 2>/dev/null test echo
+		awk echo readonly test readonly /usr/bin echo
+		x=1 sed "$@" 'quoted text' export export
+	'quoted text' ${HOME} "$@" sed done echo -eu 2>/dev/null
+| ${HOME} readonly && test test done | 'quoted text' then then 'quoted text' done
+		done grep then done x=1 x=1 test --verbose 'quoted text' "$@" local $(pwd) $(pwd)
+| cd 2>/dev/null readonly 'quoted text' local awk echo 2>/dev/null
+	-eu readonly x=1 done $(pwd) /usr/bin readonly 'quoted text' ${HOME}
+$(pwd) export then export
+	x=1 then local readonly local && sed x=1 sed /usr/bin
+		export grep then -eu printf $(pwd)
+"$1" | "$1" test done x=1 then $(pwd) "$1"
+		x=1 done done export done | 2>/dev/null echo done done
+	"$@" cd --verbose done done x=1 cd readonly
+	-eu "$1" ${HOME} | 'quoted text'
+	sed /usr/bin -eu grep 2>/dev/null
+x=1 -eu grep 2>/dev/null export
+grep done done --verbose "$1" local 2>/dev/null sed 'quoted text'
+		local export awk | x=1 then grep local sed readonly 'quoted text' "$1"
+		"$1" $(pwd) sed "$@" /usr/bin cd cd "$1" /usr/bin echo echo local
+		| ${HOME} done then done && export -eu
+	test echo /usr/bin printf "$1"
+		local 'quoted text' local x=1 ${HOME} test
+	2>/dev/null awk "$@" done x=1 'quoted text' local local
+		"$@" "$1" printf export cd readonly 2>/dev/null
+	test awk then export cd readonly 2>/dev/null echo export echo
+	export && test -eu sed x=1 'quoted text'
+		"$1" 'quoted text' x=1 | $(pwd) readonly export export then done -eu ${HOME} --verbose
+$(pwd) 'quoted text' echo export
+		local --verbose | sed ${HOME} /usr/bin readonly /usr/bin done /usr/bin awk 'quoted text'
+	-eu ${HOME} "$1" awk export then grep && 'quoted text' readonly
+	cd "$@" readonly 2>/dev/null ${HOME} "$1" /usr/bin sed cd x=1
+		$(pwd) "$@" export && test ${HOME} $(pwd) cd export then
+local done 'quoted text' $(pwd) grep --verbose "$@" awk --verbose -eu awk ${HOME}
+	x=1 "$1" cd -eu 2>/dev/null --verbose cd $(pwd) | export
+		'quoted text' export grep "$@" "$1" /usr/bin /usr/bin "$@"
+		--verbose done "$@" && $(pwd)
+	$(pwd) 'quoted text' local x=1 --verbose then echo --verbose
+x=1 export "$1" printf | $(pwd) grep test --verbose
+		printf "$@" && | cd grep $(pwd)
+	awk $(pwd) 'quoted text' /usr/bin test awk | --verbose
+	grep echo $(pwd) x=1 readonly x=1 local | test then
+--verbose -eu 2>/dev/null --verbose 2>/dev/null cd cd ${HOME} sed
+		'quoted text' "$1" "$@" cd | $(pwd)
+		local then /usr/bin printf
+	-eu "$@" && done grep 2>/dev/null /usr/bin $(pwd) then printf
+-eu cd 2>/dev/null --verbose awk done sed && cd
+	-eu export echo -eu /usr/bin
+x=1 then local test cd echo printf --verbose then $(pwd) $(pwd) 'quoted text'
+	--verbose && readonly --verbose
+| awk "$@" && "$@" cd awk readonly && ${HOME} 'quoted text'
+	printf sed readonly test | export --verbose then "$1" x=1
+		2>/dev/null readonly awk ${HOME} 'quoted text'
+		done sed printf local --verbose x=1 --verbose export --verbose sed awk 2>/dev/null
+done echo x=1 2>/dev/null /usr/bin
+	2>/dev/null awk ${HOME} export
+		readonly $(pwd) /usr/bin /usr/bin sed $(pwd)
+	-eu sed sed sed readonly 2>/dev/null printf
+		--verbose readonly export | x=1 'quoted text' test sed then | &&
+	cd local --verbose awk echo 'quoted text' export 2>/dev/null
+	"$1" $(pwd) printf cd -eu awk then -eu && then sed local
+	-eu $(pwd) ${HOME} test readonly "$@" --verbose done export ${HOME} awk then readonly
+-eu && $(pwd) --verbose --verbose awk then 2>/dev/null
+	grep "$@" "$1" export echo -eu /usr/bin sed ${HOME} --verbose local 2>/dev/null
+		echo "$@" 2>/dev/null cd $(pwd) -eu /usr/bin export "$1" | test /usr/bin readonly
+	${HOME} export $(pwd) done grep test "$@" 'quoted text' grep export sed readonly
+-eu "$1" "$1" "$@" printf sed $(pwd) printf /usr/bin ${HOME}
+		export echo cd printf local done 'quoted text' printf x=1 test grep test
+	'quoted text' local --verbose -eu 'quoted text'
+		then cd export test sed "$@" -eu 'quoted text'
+		"$@" readonly /usr/bin local then "$@" awk x=1 grep --verbose
+	export readonly /usr/bin 2>/dev/null then 'quoted text' grep printf x=1
+	done sed local --verbose -eu then sed "$1" echo sed
+		done grep sed "$@" local grep done readonly
+		-eu | ${HOME} cd test test echo && && 'quoted text' ${HOME} local x=1 -eu export
+	-eu --verbose grep | 2>/dev/null $(pwd) export && export $(pwd) |
+		$(pwd) printf && grep "$@" grep "$@" printf echo $(pwd) && --verbose
+	test ${HOME} ${HOME} cd 2>/dev/null
+export "$1" x=1 test x=1 test -eu ${HOME}
+$(pwd) export readonly /usr/bin readonly $(pwd) /usr/bin /usr/bin
+"$1" | sed grep -eu local "$@" local --verbose
+		| 2>/dev/null sed cd awk $(pwd) -eu cd $(pwd) test grep --verbose "$@"
+	-eu local cd | done | 2>/dev/null sed sed /usr/bin echo cd sed cd cd test
+	'quoted text' then readonly
+	echo 'quoted text' test "$1" ${HOME} awk /usr/bin ${HOME}
+cd local printf "$1" then && local awk --verbose sed grep "$1" sed local
+	cd $(pwd) ${HOME} "$1" printf $(pwd) 2>/dev/null 2>/dev/null
+	&& export grep grep done
+		x=1 grep local x=1 "$@" x=1
+		-eu /usr/bin --verbose x=1 "$1" test readonly
+awk local printf local --verbose --verbose "$@" && sed && | export 2>/dev/null
+		sed local awk /usr/bin x=1 then printf
+	x=1 "$@" x=1 then 2>/dev/null sed cd && | awk
+$(pwd) ${HOME} "$1" then cd 'quoted text' sed awk ${HOME}
+sed readonly -eu 'quoted text' readonly readonly echo done --verbose ${HOME}
+/usr/bin $(pwd) grep sed awk -eu ${HOME} /usr/bin
+	'quoted text' echo ${HOME} ${HOME} printf sed awk -eu local
+echo "$@" 2>/dev/null && ${HOME}
+| 2>/dev/null awk --verbose cd sed --verbose && x=1 "$@" then /usr/bin &&
+	test readonly x=1 echo then then --verbose test /usr/bin done $(pwd) readonly
+	local grep 2>/dev/null awk 'quoted text' "$1" 'quoted text' "$1" printf readonly
+		${HOME} ${HOME} -eu test echo sed /usr/bin
+	done then export local export
+	--verbose && "$@" sed readonly ${HOME} done --verbose $(pwd) 'quoted text'
+		then test x=1 export test "$1" --verbose "$1" readonly $(pwd) cd printf $(pwd)
+2>/dev/null then 2>/dev/null cd --verbose --verbose
+		echo export cd echo 2>/dev/null $(pwd) x=1 sed echo &&
+		readonly --verbose local
+	/usr/bin printf ${HOME}
+	awk cd --verbose readonly awk echo
+		$(pwd) echo local echo then sed && printf then sed test
+		readonly done 2>/dev/null
+	export sed readonly echo | printf -eu echo done cd "$1" 2>/dev/null x=1 sed sed
+awk grep cd $(pwd) x=1 --verbose 2>/dev/null done export sed -eu done
+	echo grep ${HOME} "$@" sed readonly export printf readonly awk readonly "$1" 'quoted text'
+awk echo $(pwd) done
+readonly readonly && test 'quoted text' 'quoted text' local "$@"
+2>/dev/null "$@" 'quoted text'
+local cd | 2>/dev/null | local printf "$@" x=1 --verbose
+	&& grep x=1 readonly -eu 'quoted text' cd then "$1" awk printf
+		export /usr/bin "$@" && "$@" "$@" "$1"
+	$(pwd) sed cd then cd -eu grep "$1" awk local ${HOME} "$@" echo
+"$1" "$@" done --verbose && done test x=1 export --verbose
+"$1" done /usr/bin | | then echo | --verbose local ${HOME}
+		cd x=1 "$1" then ${HOME} printf awk "$1" && 2>/dev/null test printf
+"$@" sed export grep "$1" ${HOME} && grep ${HOME} local test ${HOME}
+		readonly -eu $(pwd) x=1 'quoted text'
+	grep 2>/dev/null "$@" "$1" $(pwd)
+	x=1 local sed test done "$1" x=1 x=1
+	$(pwd) && 2>/dev/null grep && "$1" ${HOME} sed test -eu x=1 test x=1
+	sed awk --verbose ${HOME} sed cd test 'quoted text' --verbose 'quoted text'
+printf cd /usr/bin done
+	$(pwd) local export done test echo cd sed -eu readonly
+	echo -eu readonly cd 2>/dev/null
+	"$1" "$@" readonly 2>/dev/null &&
+printf printf printf --verbose "$1" /usr/bin /usr/bin then /usr/bin readonly 2>/dev/null
+$(pwd) 2>/dev/null export export test
+	cd -eu /usr/bin "$@" awk grep --verbose echo
+	readonly $(pwd) echo $(pwd) export printf sed --verbose local awk --verbose
+	done cd $(pwd) sed local ${HOME} && /usr/bin test grep
+		x=1 test test then sed x=1 -eu --verbose
+	readonly readonly && grep 2>/dev/null awk sed 2>/dev/null
+		cd ${HOME} done readonly test /usr/bin $(pwd) "$1" local readonly
+		readonly /usr/bin cd sed --verbose "$@"
+$(pwd) $(pwd) -eu grep then ${HOME} local test
+		test printf grep $(pwd) grep local "$1" 'quoted text' echo local ${HOME}
+		"$1" ${HOME} local 'quoted text' export
+		'quoted text' cd "$@" /usr/bin -eu sed printf done done 2>/dev/null
+${HOME} test x=1 -eu $(pwd) readonly sed "$@" export local --verbose
+"$1" local "$1" 2>/dev/null awk then grep -eu -eu /usr/bin done
+/usr/bin --verbose export cd printf local "$@" sed
+	${HOME} "$@" echo x=1 done printf export "$1" $(pwd)
+readonly 2>/dev/null /usr/bin 2>/dev/null 2>/dev/null echo
+awk printf test && | -eu test
+${HOME} "$1" export then then printf done ${HOME} then x=1 -eu readonly
+test x=1 | "$1" done cd awk local "$1" done
+done readonly 2>/dev/null "$@" ${HOME} local done
+		| $(pwd) "$@" && $(pwd) $(pwd) x=1 grep -eu
+	x=1 2>/dev/null export --verbose && /usr/bin $(pwd) | | then $(pwd) | cd readonly
+		grep | cd printf /usr/bin 'quoted text' ${HOME} awk --verbose done "$@"
+&& local done --verbose --verbose grep x=1 | 2>/dev/null -eu
+		printf -eu --verbose test && cd $(pwd) | $(pwd) $(pwd)
+		then done $(pwd) "$@" readonly sed grep && -eu --verbose
+printf $(pwd) printf "$1" awk 2>/dev/null
+		--verbose 2>/dev/null awk grep grep local /usr/bin $(pwd) -eu -eu then |
+	&& /usr/bin ${HOME} then $(pwd) x=1
+done "$1" export then local --verbose done x=1 export test | 2>/dev/null
+	"$1" && -eu echo then x=1 |
+&& awk readonly "$1" export
+"$1" x=1 2>/dev/null printf /usr/bin "$1" "$@" -eu cd -eu
+	cd test done ${HOME} sed sed printf | printf
+export x=1 | && -eu then | export -eu $(pwd) "$1" echo && readonly readonly --verbose
+		readonly | test awk && awk && x=1 local && | sed && && /usr/bin then "$1" ${HOME}
+		printf -eu -eu sed ${HOME} "$1" 'quoted text' -eu local
+	export sed | readonly "$@" "$1" then 'quoted text' export sed -eu cd
+		| "$1" -eu x=1 awk /usr/bin /usr/bin $(pwd) 'quoted text' awk ${HOME} awk then
+	local done && /usr/bin && readonly sed sed readonly -eu
+		then && --verbose x=1 2>/dev/null sed ${HOME} && 'quoted text' grep then |
+	"$1" x=1 sed sed /usr/bin "$@" --verbose test sed | 'quoted text'
+	${HOME} cd | awk && 2>/dev/null local readonly
+then x=1 test 'quoted text' readonly ${HOME} ${HOME} echo "$1" ${HOME} $(pwd)
+test awk printf 2>/dev/null test readonly
+"$1" $(pwd) && cd "$@" /usr/bin --verbose x=1 "$@" "$1" grep readonly
+		| printf "$@" --verbose grep | grep 2>/dev/null
+		--verbose 2>/dev/null "$1" 'quoted text' | /usr/bin then 'quoted text'
+x=1 "$1" done then --verbose grep && printf $(pwd)
+		'quoted text' done readonly export $(pwd) echo cd x=1 ${HOME}
+		"$1" printf "$1" grep grep test done awk then
+&& then done 'quoted text' | local "$1" local --verbose
+-eu grep "$@" --verbose readonly --verbose export | "$@" readonly
+	export | "$1" awk sed "$1" export && -eu printf x=1 done && $(pwd) test awk
+printf cd x=1 test local test "$@" printf sed echo printf --verbose
+	export && -eu "$@" 'quoted text' awk local 'quoted text' export awk then | grep
+		'quoted text' readonly x=1 local export
+readonly done $(pwd) -eu done
+	test sed | grep printf | | printf readonly echo test -eu "$1"
+	2>/dev/null printf test "$1" echo | "$1" x=1 echo ${HOME} cd "$1" "$@"
+$(pwd) awk test "$@" && printf
+	export --verbose then /usr/bin cd done | done test awk local
+		'quoted text' done x=1 "$@" 'quoted text' readonly | grep -eu printf
+		test echo sed $(pwd) printf
+		cd test $(pwd) "$1" /usr/bin && $(pwd) $(pwd) 'quoted text' test
+${HOME} printf grep && ${HOME} "$1"
+	done local -eu test readonly /usr/bin
+	local sed 'quoted text' then "$@" $(pwd) "$1" ${HOME} test done "$1"
+--verbose && 2>/dev/null 'quoted text'
+	done "$@" export printf awk && test
+| grep echo 2>/dev/null export -eu test /usr/bin 'quoted text' awk $(pwd)
+echo export -eu && readonly 'quoted text' | && test /usr/bin
+		"$@" | x=1 echo test then export sed |
+		echo export /usr/bin | awk -eu && | echo 'quoted text' echo awk x=1 sed &&
+$(pwd) sed echo test "$1" "$@" test awk --verbose x=1
+2>/dev/null local -eu "$@" -eu local then export then -eu "$@" then done
+${HOME} --verbose x=1 cd test then
+${HOME} | then grep sed then -eu --verbose -eu
+	| local cd done "$1" cd readonly echo grep -eu $(pwd) ${HOME}
+x=1 grep export printf
+		awk printf && done "$@" readonly
+echo "$1" 2>/dev/null sed export printf
+'quoted text' awk 2>/dev/null "$@" done x=1 | x=1 awk done
+	local && "$1" then export printf && | /usr/bin
+sed 'quoted text' grep local $(pwd) --verbose && awk export cd test
+	sed cd done 'quoted text' -eu x=1 grep ${HOME}
+	--verbose awk $(pwd) test test local x=1 && 'quoted text' 2>/dev/null readonly
+	"$1" done test grep "$1" export && "$1" 2>/dev/null export
+		"$@" done 2>/dev/null /usr/bin
+	printf --verbose && done /usr/bin then $(pwd) -eu --verbose
+		--verbose readonly "$1" cd --verbose --verbose cd ${HOME}
+	--verbose test echo test $(pwd) -eu done test --verbose x=1
+	"$1" && "$1" done readonly --verbose 2>/dev/null 'quoted text' && "$@" ${HOME} readonly
+"$1" sed && --verbose -eu
+	'quoted text' x=1 && | echo 2>/dev/null
+		${HOME} sed "$1" grep export then local sed 2>/dev/null then cd then
+$(pwd) printf awk && then sed grep /usr/bin
+	${HOME} 2>/dev/null ${HOME} export
+	| local "$@" $(pwd) readonly then readonly local then test -eu
+2>/dev/null && | -eu echo then export then export then
+		| "$@" && sed -eu readonly local ${HOME} "$1" 2>/dev/null grep $(pwd)
+		&& sed | $(pwd) test test
+		export "$@" readonly $(pwd)
+		${HOME} x=1 'quoted text' then printf export test /usr/bin readonly 2>/dev/null
+		printf 2>/dev/null grep done printf local
+export $(pwd) ${HOME} 2>/dev/null
+		/usr/bin grep -eu $(pwd) && -eu readonly local done ${HOME}
+	done "$1" && && --verbose export done readonly
+		printf /usr/bin ${HOME} ${HOME} | printf ${HOME} | "$@" sed done grep /usr/bin
+	export done $(pwd) local /usr/bin $(pwd) test done sed $(pwd) --verbose readonly
+	readonly awk test grep
+	then done --verbose ${HOME} readonly local grep $(pwd)
+done done x=1 sed x=1 echo export
+	echo "$@" $(pwd) readonly | then "$1" then export 'quoted text' -eu awk x=1
+$(pwd) -eu local readonly grep printf
+	| | "$1" ${HOME} -eu | echo readonly export && --verbose
+"$1" awk export done local --verbose cd
+	"$@" sed done ${HOME} 2>/dev/null 'quoted text' export
+${HOME} 2>/dev/null readonly
+		--verbose x=1 ${HOME} done grep x=1
+	-eu -eu then -eu grep x=1 x=1 done "$1" local $(pwd)
+	done | printf && /usr/bin --verbose test printf echo "$@" "$@"
+	| local printf then /usr/bin done readonly then "$1"
+	-eu cd 'quoted text' awk
+	test && export done awk "$1" grep readonly grep "$@"
+		${HOME} | echo done 'quoted text' "$@" | "$@" echo x=1 then grep
+test /usr/bin printf ${HOME} echo x=1 /usr/bin then sed
+	2>/dev/null sed done test --verbose $(pwd) /usr/bin 'quoted text' /usr/bin
+	grep -eu "$1" /usr/bin printf local then test
+	done grep $(pwd) 2>/dev/null && test
+		done "$1" $(pwd) && cd 'quoted text'
+		'quoted text' readonly ${HOME} grep 'quoted text' ${HOME} $(pwd)
+	x=1 2>/dev/null /usr/bin
+		2>/dev/null -eu awk 'quoted text' grep $(pwd) /usr/bin
+	local local && "$1" cd then awk readonly printf && readonly $(pwd) grep "$1" "$@"
+		${HOME} export readonly printf test awk done cd then
+		${HOME} then | x=1 -eu "$@"
+		export local "$1" done local ${HOME} test awk
+	awk done -eu --verbose awk && printf then cd test 2>/dev/null cd && then -eu
+	then awk x=1 2>/dev/null 'quoted text' readonly --verbose then echo "$1" 'quoted text'
+	/usr/bin printf readonly echo $(pwd) "$1" readonly 'quoted text' done
+	"$@" echo ${HOME} readonly "$@" x=1 'quoted text' "$1" cd grep "$1"
+		'quoted text' cd "$@" --verbose "$1" -eu 'quoted text' --verbose awk
+		x=1 grep sed test local
+	-eu grep -eu local cd ${HOME} && -eu grep 'quoted text' 2>/dev/null | --verbose
+export export /usr/bin "$1" "$@" printf ${HOME} && "$1" grep grep grep x=1
+	done x=1 x=1 --verbose 'quoted text' --verbose -eu "$1"
+		then -eu ${HOME} echo | sed -eu cd x=1 done
+	export "$@" export printf sed echo 'quoted text'
+	readonly /usr/bin awk /usr/bin
+	cd 2>/dev/null grep local awk grep grep x=1 -eu "$@" local
+		echo awk -eu test ${HOME} local sed /usr/bin printf
+		2>/dev/null printf cd
+		$(pwd) cd 2>/dev/null "$1" cd
+--verbose then export $(pwd) 'quoted text' readonly then "$@" 2>/dev/null
+done export -eu x=1 local 'quoted text'
+		grep --verbose $(pwd) sed 2>/dev/null &&
+then /usr/bin readonly export && echo done local $(pwd) grep x=1 | test ${HOME}
+	cd ${HOME} $(pwd) "$@" sed
+		printf readonly "$1" | printf awk sed /usr/bin 'quoted text'
+	--verbose printf local sed readonly x=1 "$1" echo test done sed readonly awk
+		sed --verbose cd -eu printf
+		awk && "$1" -eu readonly && "$@" then 2>/dev/null $(pwd)
+local "$@" export && "$1"
+$(pwd) $(pwd) && | printf grep
+		readonly x=1 cd | --verbose test $(pwd) test awk
+		cd $(pwd) then awk echo test "$@" local 2>/dev/null test echo
+	x=1 2>/dev/null sed -eu | grep
+	"$1" cd x=1 'quoted text' -eu | 'quoted text'
+	"$1" x=1 -eu local then && "$1" 2>/dev/null 'quoted text' done
+awk test local x=1 test printf
+${HOME} x=1 "$@" cd then -eu local export -eu "$1"
+		grep "$@" test sed 2>/dev/null
+		grep echo cd cd cd $(pwd) sed
+${HOME} grep $(pwd) cd | 'quoted text' done awk sed x=1 | test
+	${HOME} cd export local sed --verbose awk /usr/bin ${HOME} readonly
+'quoted text' "$1" 'quoted text'
+--verbose awk /usr/bin $(pwd) then
+"$@" $(pwd) $(pwd) done sed
+	done && /usr/bin then "$@" -eu /usr/bin x=1 export cd -eu awk then export --verbose
+	readonly && grep /usr/bin /usr/bin "$@" /usr/bin ${HOME}
+		2>/dev/null test -eu "$1" echo | done then awk local cd readonly printf | export
+done awk awk && local 'quoted text' "$@" ${HOME}
+'quoted text' --verbose && local ${HOME} ${HOME} &&
+	then && test /usr/bin awk | echo 'quoted text' /usr/bin
+	x=1 'quoted text' $(pwd) readonly export
+		--verbose --verbose done 2>/dev/null test done | cd
+	--verbose "$1" done done then "$@" "$@" sed $(pwd) | awk printf "$1"
+		'quoted text' $(pwd) printf
+		2>/dev/null "$@" cd test cd $(pwd) | local
+		sed "$1" --verbose $(pwd) test "$@" printf "$1" /usr/bin
+-eu 2>/dev/null 'quoted text'
+2>/dev/null local $(pwd) ${HOME} ${HOME} echo -eu test "$1"
+		/usr/bin local test 'quoted text'
+		awk printf "$1" "$@" export readonly
+		export "$@" 'quoted text'
+		'quoted text' local local
+		echo -eu echo $(pwd) 'quoted text'
+		"$@" export done sed printf $(pwd) ${HOME} -eu sed | export grep
+		x=1 | | echo && local echo
+	$(pwd) ${HOME} done test done 2>/dev/null
+	$(pwd) sed echo then cd sed export done awk readonly readonly
+	/usr/bin --verbose then awk
+	| /usr/bin cd printf grep "$1" cd sed then && ${HOME} /usr/bin -eu -eu printf
+	sed done readonly local local sed printf then 2>/dev/null grep
+		sed "$@" ${HOME} 2>/dev/null cd 2>/dev/null -eu ${HOME} awk echo
+	sed $(pwd) && 'quoted text' grep printf | grep then then 2>/dev/null &&
+	$(pwd) then --verbose "$@" --verbose readonly test sed x=1 test local
+then then export /usr/bin test cd 'quoted text' /usr/bin
+2>/dev/null local local x=1 then "$1" grep ${HOME} readonly ${HOME} --verbose
+	awk 'quoted text' | then /usr/bin then /usr/bin printf awk 2>/dev/null echo --verbose
+printf | /usr/bin readonly ${HOME} && then printf cd
+	readonly sed test then grep grep 'quoted text' --verbose
+export x=1 sed test done x=1 "$@" /usr/bin "$@" then export x=1 export
+	"$1" | awk grep 'quoted text' 2>/dev/null &&
+		awk printf x=1 | echo export awk echo | test -eu
+	2>/dev/null --verbose && | sed test export
+${HOME} awk | done 'quoted text'
+done 2>/dev/null sed echo ${HOME} --verbose x=1 test
+printf printf && awk --verbose grep readonly cd -eu then printf -eu 'quoted text'
+		x=1 done 2>/dev/null -eu | printf 'quoted text'
+	$(pwd) readonly export test export printf x=1
+		local | /usr/bin grep printf
+	| test done awk "$1" 'quoted text' test 'quoted text' test && "$@"
+/usr/bin --verbose done echo printf cd /usr/bin $(pwd) test "$@" then "$1" test
+	'quoted text' 'quoted text'
+"$@" done echo local 2>/dev/null local grep
+echo /usr/bin cd grep "$@"
+	x=1 ${HOME} x=1 2>/dev/null test && readonly && 2>/dev/null 2>/dev/null
+	cd awk cd 2>/dev/null readonly export
+	echo "$@" printf cd test then test echo
+	awk $(pwd) "$1" echo /usr/bin
+printf local test test then x=1 'quoted text' 2>/dev/null echo | --verbose cd
+	--verbose export ${HOME} "$1" readonly 'quoted text' 2>/dev/null echo
+2>/dev/null 2>/dev/null grep | | echo "$@" awk
+	2>/dev/null && $(pwd) "$@" test cd export export "$1" grep echo local "$1"
+done then printf x=1 x=1 readonly 'quoted text' $(pwd) ${HOME} | x=1
+	grep $(pwd) echo ${HOME} cd ${HOME} readonly test "$1" $(pwd) --verbose --verbose
+		readonly "$@" readonly x=1 export && && local ${HOME}
+		local /usr/bin cd 2>/dev/null ${HOME} done local export echo readonly grep ${HOME}
+		export done export test | "$1" readonly printf
+-eu test printf printf readonly 'quoted text' then sed $(pwd) | awk --verbose sed
+		then $(pwd) test && then export export readonly "$1"
+local 'quoted text' readonly
+	| readonly cd -eu && "$1" printf cd sed "$1" local then && && cd 'quoted text'
+echo sed sed $(pwd) /usr/bin --verbose
+		2>/dev/null echo echo readonly grep 'quoted text' cd
+	$(pwd) --verbose printf readonly "$1" && 'quoted text' local 2>/dev/null
+/usr/bin awk test 'quoted text' echo awk "$@" x=1 then "$@" then "$@" local then
+awk awk done local local awk /usr/bin "$1" export
+readonly local local echo echo sed -eu && test done | then /usr/bin
+		&& export export -eu &&
+| awk ${HOME} && test readonly readonly printf sed ${HOME}
+	"$@" x=1 done echo /usr/bin -eu x=1 'quoted text' printf
+"$@" cd --verbose x=1 printf x=1 ${HOME} && --verbose /usr/bin done awk cd
+	2>/dev/null sed done ${HOME} local
+	&& x=1 x=1 /usr/bin -eu cd export "$1" "$@" export export
+		"$@" echo test ${HOME} && done && $(pwd) $(pwd) echo done local printf "$1" grep
+	export cd $(pwd) test | printf awk grep awk printf --verbose /usr/bin &&
+local ${HOME} "$1" | x=1 "$1" test && export 2>/dev/null printf done x=1
+	grep ${HOME} 2>/dev/null printf 2>/dev/null
+	test readonly -eu /usr/bin --verbose echo then cd sed sed printf
+		"$@" test readonly sed 2>/dev/null | done $(pwd) ${HOME}
+		-eu 2>/dev/null done then
+		"$@" && $(pwd) --verbose ${HOME} awk printf
+		2>/dev/null readonly
+--verbose then awk cd done 2>/dev/null
+local /usr/bin $(pwd) x=1 /usr/bin printf "$1" /usr/bin | 2>/dev/null grep readonly
+		/usr/bin | readonly ${HOME} then $(pwd) && then awk local awk echo x=1
+		then | --verbose "$1" "$@" readonly cd printf
+	test /usr/bin test && | readonly
+		cd local export 'quoted text' test "$@" echo awk 'quoted text'
+		awk 2>/dev/null 'quoted text' $(pwd) | --verbose local local | sed cd "$@" --verbose
+export sed && cd x=1 then 'quoted text'
+	/usr/bin --verbose ${HOME} export
+	"$@" grep then ${HOME} --verbose | x=1
+		-eu export export echo export export $(pwd)
+--verbose readonly -eu -eu ${HOME} printf
+		grep x=1 --verbose 2>/dev/null -eu "$1" done --verbose x=1 ${HOME}
+		-eu ${HOME} printf ${HOME} "$@" readonly $(pwd) | echo "$@" 2>/dev/null awk echo
+grep sed "$@" --verbose x=1 -eu grep readonly x=1
+then export local echo --verbose "$1"
+	cd printf 'quoted text' local echo test then ${HOME}
+	test readonly local readonly
+	"$1" cd local awk && --verbose
+	-eu "$1" test | awk 2>/dev/null
+cd test cd cd 2>/dev/null test x=1 local | done
+	sed test grep 2>/dev/null x=1 cd local x=1 && readonly echo "$@" 2>/dev/null
+		x=1 export /usr/bin grep ${HOME} local "$1" local test --verbose
+readonly export readonly |
+	'quoted text' && test done awk 2>/dev/null | awk then printf export echo done
+		export done sed --verbose printf readonly readonly
+	--verbose printf $(pwd) 'quoted text' readonly done export "$@" |
+		test test test readonly "$@" "$@" cd ${HOME} 2>/dev/null 2>/dev/null 2>/dev/null
+export echo -eu grep awk test sed awk x=1
+	awk ${HOME} $(pwd) x=1 -eu
+		then "$@" echo $(pwd) 'quoted text'
+| && cd local -eu awk cd $(pwd) $(pwd) | echo
+		sed sed x=1 "$@" ${HOME} sed done 'quoted text'
+		cd echo sed sed 'quoted text' 'quoted text' printf /usr/bin
+&& ${HOME} | -eu ${HOME} /usr/bin 2>/dev/null done -eu $(pwd) "$@" -eu "$@" $(pwd)
+	export $(pwd) done then done printf printf cd /usr/bin cd 'quoted text'
+'quoted text' test /usr/bin "$@" readonly 'quoted text' printf x=1
+	"$@" $(pwd) cd done && printf &&
+	| 2>/dev/null done awk
+	cd export /usr/bin "$@" echo "$@" export local echo sed ${HOME} grep -eu
+awk sed echo cd awk 'quoted text' x=1 x=1 sed grep grep echo "$@" --verbose
+	| local then then done --verbose ${HOME}
+done readonly test | sed export test echo then | then $(pwd) grep cd
+	${HOME} "$1" /usr/bin printf x=1 awk
+	readonly ${HOME} local readonly
+	then cd "$1" "$1" "$1" export
+	export 2>/dev/null sed done sed 2>/dev/null test export
+		then grep echo done grep && 2>/dev/null then && sed then test readonly
+awk -eu cd echo grep /usr/bin -eu 'quoted text' then
+	${HOME} /usr/bin sed export
+		readonly readonly ${HOME} readonly local sed grep local "$@"
+echo 2>/dev/null readonly readonly --verbose /usr/bin local ${HOME}
+	| 'quoted text' cd /usr/bin local x=1 local $(pwd) test /usr/bin
+	"$1" test export readonly -eu sed export test readonly readonly && local export
+	"$1" readonly sed x=1 && 'quoted text' printf --verbose
+		done awk 'quoted text' sed "$@" sed printf local 'quoted text' && export
+readonly ${HOME} echo "$@" | echo /usr/bin awk readonly test printf ${HOME}
+#include c59.sh
+	'quoted text' echo done "$@" "$@" sed x=1
+	"$@" ${HOME} "$@" /usr/bin readonly && && local
+	/usr/bin readonly awk
+	then 2>/dev/null local /usr/bin 'quoted text' "$@" 'quoted text'
+-eu 2>/dev/null export 'quoted text' 'quoted text' "$1"
+	grep && awk "$@" /usr/bin --verbose test | x=1 then test awk echo "$1" /usr/bin
+	then 2>/dev/null sed cd "$@" ${HOME} local
+		cd local awk "$1" --verbose && grep
+x=1 $(pwd) 'quoted text' awk --verbose awk sed export local echo -eu grep "$1"
+		/usr/bin $(pwd) -eu printf readonly
+local $(pwd) --verbose sed done cd done x=1
+		then --verbose -eu awk -eu readonly
+		printf --verbose | test "$1" then export
+	echo --verbose 2>/dev/null -eu &&
+		--verbose ${HOME} cd 'quoted text' --verbose test 'quoted text' /usr/bin
+	2>/dev/null 2>/dev/null cd && readonly awk
+&& done cd /usr/bin 2>/dev/null then export
+	x=1 test && printf /usr/bin /usr/bin then local
+echo x=1 sed | done awk sed /usr/bin
+		${HOME} && sed export done 'quoted text'
+		readonly "$@" 'quoted text' --verbose
+	printf sed -eu 'quoted text' --verbose awk -eu cd $(pwd) printf sed
+	test | awk then /usr/bin ${HOME} "$1" export awk
+	2>/dev/null --verbose local printf /usr/bin | readonly $(pwd)
+		sed printf | readonly echo "$@" "$@" grep $(pwd) x=1 readonly
+		printf "$@" 'quoted text' done x=1
+	| 2>/dev/null x=1 then then x=1 grep cd --verbose x=1 --verbose local local export
+		-eu "$@" x=1 ${HOME} echo export local 2>/dev/null
+	"$1" -eu x=1 sed done sed 'quoted text' awk x=1 --verbose x=1 awk
+echo "$@" 'quoted text' "$@" x=1 grep --verbose then --verbose | echo then echo
+		cd "$@" x=1 printf x=1 2>/dev/null
+	${HOME} then $(pwd) x=1 'quoted text'
+x=1 $(pwd) "$@" 2>/dev/null
+x=1 /usr/bin grep export | --verbose -eu then && export
+		sed local sed printf 2>/dev/null && test local echo --verbose
+done 'quoted text' readonly echo /usr/bin ${HOME} echo export
+	'quoted text' | test && 'quoted text' 'quoted text' && && cd done ${HOME} "$1"
+${HOME} readonly cd awk | printf
+		x=1 grep done sed test --verbose /usr/bin cd 'quoted text' local x=1
+test cd "$1" readonly $(pwd) "$1" 2>/dev/null awk
+		&& test readonly cd "$1" "$@" test
+cd test cd $(pwd) && ${HOME} sed grep echo
+		grep "$1" "$1" printf x=1 test
+		cd then -eu 'quoted text'
+		x=1 cd export x=1 sed awk x=1 readonly local test readonly /usr/bin
+	sed && | printf x=1 then cd && ${HOME} cd 2>/dev/null
+	"$1" ${HOME} sed -eu &&
+	readonly then then -eu readonly -eu -eu done local grep readonly echo
+printf 'quoted text' then $(pwd) ${HOME} "$1" readonly then | test
+		export local test done grep printf readonly "$@" -eu -eu done 'quoted text'
+echo | printf readonly then printf | readonly
+		${HOME} echo cd readonly done awk --verbose
+printf x=1 test done export && /usr/bin done "$1" $(pwd) export export cd &&
+		awk awk awk echo && | sed | $(pwd)
+	"$@" | cd 'quoted text' readonly echo test printf
+'quoted text' export /usr/bin
+		cd awk && awk 'quoted text' "$1" x=1 sed export
+		'quoted text' export export | --verbose
+		local readonly && export /usr/bin
+		local 'quoted text' /usr/bin -eu "$1" -eu
+		grep then awk | | local "$1" -eu readonly export 2>/dev/null
+export -eu ${HOME} readonly /usr/bin --verbose printf awk done -eu 2>/dev/null
+		x=1 /usr/bin then "$1" readonly grep cd 2>/dev/null
+	| then export && done -eu /usr/bin "$@" -eu echo done sed readonly awk "$@" /usr/bin
+		sed x=1 $(pwd) ${HOME} "$1" |
+		/usr/bin 2>/dev/null -eu then awk test then awk local test grep 'quoted text'
+	awk --verbose echo 'quoted text' "$@" done /usr/bin cd $(pwd) printf "$@" | then
+		done grep test cd awk cd
+		sed then printf | test printf awk -eu "$1"
+		--verbose printf then -eu
+	grep -eu then ${HOME} "$1" awk printf cd "$@" export 'quoted text' export
+local x=1 | ${HOME} | x=1 ${HOME} grep | &&
+		sed echo --verbose printf sed readonly 'quoted text' then
+	test 'quoted text' 'quoted text'
+	${HOME} readonly -eu -eu grep echo ${HOME} $(pwd) | local ${HOME}
+	grep cd /usr/bin "$@" then test awk
+	grep ${HOME} --verbose -eu printf test "$1"
+		awk /usr/bin 2>/dev/null --verbose "$@" --verbose readonly 'quoted text'
+done test then $(pwd) local then "$@" readonly x=1
+--verbose "$@" export export --verbose --verbose grep -eu sed sed
+		&& x=1 --verbose $(pwd) then sed --verbose export awk x=1 cd
+	"$@" "$1" -eu && local
+"$1" readonly $(pwd) --verbose local echo
+		readonly -eu local done "$@"
+	printf export test printf done x=1 echo
+	${HOME} /usr/bin echo awk export /usr/bin done $(pwd)
+x=1 local "$@" --verbose export echo && cd cd done echo test
+	test echo then /usr/bin && 2>/dev/null cd && 'quoted text'
+	cd done /usr/bin sed local | echo --verbose
+		local grep "$@" 2>/dev/null awk awk grep | export "$@" 'quoted text' readonly
+	-eu | ${HOME} $(pwd) local 'quoted text' printf readonly 'quoted text'
+awk x=1 local then printf /usr/bin x=1 $(pwd) test grep ${HOME} awk | ${HOME}
+echo "$1" echo -eu "$1" && "$@" x=1 local readonly && 2>/dev/null ${HOME} printf
+	| 'quoted text' 'quoted text' export x=1 sed export "$1"
+		local printf then test -eu export grep cd printf printf && ${HOME}
+	"$@" then printf export /usr/bin | test local "$@"
+local 'quoted text' "$1" done done ${HOME} local done local && echo cd sed
+	done done readonly export 'quoted text' local
+	printf readonly cd "$@" x=1 done x=1 x=1 grep "$@" && && ${HOME} then
+		grep x=1 x=1 2>/dev/null grep "$1" ${HOME} && "$1"
+		readonly 'quoted text' cd done printf "$1" "$@"
+	'quoted text' && "$1" readonly --verbose cd "$1" $(pwd) ${HOME}
+	x=1 x=1 x=1 ${HOME} printf
+		$(pwd) cd printf sed "$1" done cd test 2>/dev/null
+2>/dev/null readonly printf done
+		'quoted text' test echo "$@" readonly $(pwd) echo 'quoted text'
+	&& test /usr/bin done done 'quoted text' 2>/dev/null export "$@" then cd
+	local x=1 --verbose 2>/dev/null
+		done cd then awk $(pwd) "$1" readonly echo 2>/dev/null readonly "$1" ${HOME}
+		sed echo local -eu then
+		done printf "$@" then readonly echo $(pwd) cd readonly
+		test readonly 2>/dev/null $(pwd) --verbose "$1" | test --verbose done "$@" "$@"
+cd "$1" $(pwd) "$@" awk 2>/dev/null test
+"$1" done "$1" test export export /usr/bin done --verbose 'quoted text'
+"$1" "$1" awk | "$1" then "$1" x=1 done -eu /usr/bin x=1 "$1" grep 'quoted text'
+/usr/bin sed 'quoted text' --verbose --verbose export /usr/bin
+	"$@" then local | 2>/dev/null test test readonly
+		grep sed echo then local 2>/dev/null awk x=1 --verbose
+test done grep $(pwd) 2>/dev/null /usr/bin printf
+then 'quoted text' 2>/dev/null
+		done cd cd $(pwd) | | readonly | readonly test $(pwd) 2>/dev/null
+		local --verbose ${HOME} x=1 readonly
+readonly then awk awk export printf local
+export -eu done then readonly ${HOME} done 'quoted text'
+		test 'quoted text' x=1 $(pwd)
+		done sed test | then -eu | ${HOME} /usr/bin then 2>/dev/null sed
+	echo 2>/dev/null $(pwd) grep "$1" printf && printf export $(pwd)
+| sed | -eu printf cd echo 'quoted text' | $(pwd) 2>/dev/null x=1 grep test
+		test --verbose 'quoted text' export "$@" awk cd -eu sed -eu then done x=1
+"$1" printf x=1 "$1"
+then then grep x=1 test sed readonly /usr/bin /usr/bin readonly
+export grep 2>/dev/null 'quoted text' awk 2>/dev/null ${HOME} printf local
+${HOME} /usr/bin $(pwd) | then ${HOME} "$1" | grep
+		${HOME} then then sed test -eu 'quoted text' /usr/bin |
+	grep "$1" sed "$1" readonly 2>/dev/null "$@" | ${HOME} ${HOME}
+echo "$1" done echo readonly echo test $(pwd) 2>/dev/null awk "$1" cd local
+sed local test export readonly echo -eu "$@" && cd export --verbose
+	"$@" | done echo then test $(pwd) grep --verbose && 'quoted text' &&
+	x=1 "$@" local ${HOME} echo x=1 x=1 | /usr/bin
+		2>/dev/null echo 'quoted text'
+2>/dev/null readonly $(pwd) x=1 then cd /usr/bin echo cd printf
+		done -eu $(pwd) 2>/dev/null export then -eu | awk sed export readonly
+		grep test "$@" readonly
+	grep && --verbose "$1" export && -eu | readonly x=1 2>/dev/null
+	local -eu $(pwd) "$@" test done | x=1 --verbose "$1" local
+		$(pwd) 2>/dev/null /usr/bin
+awk x=1 local grep 2>/dev/null ${HOME} test grep test --verbose
+	"$1" 'quoted text' test $(pwd) "$@" -eu then | echo --verbose 'quoted text'
+		sed test "$@" -eu "$1"
+		grep readonly awk export | 'quoted text' | -eu done | "$@" awk local
+&& "$@" | export --verbose "$1"
+		"$1" done $(pwd) /usr/bin 'quoted text' grep | "$@" grep readonly | 'quoted text'
+		cd --verbose 2>/dev/null export readonly && 'quoted text'
+local then | printf --verbose "$@" $(pwd) | && x=1 printf sed
+	$(pwd) sed local "$@" export cd printf
+printf "$@" 'quoted text' | 2>/dev/null sed then 'quoted text' /usr/bin
+	"$@" grep 'quoted text' && grep 2>/dev/null && /usr/bin
+		"$@" grep $(pwd) export x=1 | 'quoted text' "$@" ${HOME}
+	"$1" && printf /usr/bin "$1" test echo -eu readonly "$@"
+		"$1" $(pwd) done -eu &&
+		cd | x=1 sed -eu export | /usr/bin
+| awk "$1" sed cd "$1" done
+	| 2>/dev/null awk -eu 2>/dev/null "$@" ${HOME} then ${HOME}
+printf export 'quoted text' echo local /usr/bin done export ${HOME}
+		"$@" grep ${HOME} && local /usr/bin grep test 2>/dev/null grep
+'quoted text' printf grep
+	test 2>/dev/null test $(pwd) -eu echo then cd then printf
+${HOME} 2>/dev/null $(pwd) --verbose done
+x=1 "$1" --verbose test "$@" grep cd 2>/dev/null
+	done local 2>/dev/null printf test
+	local 'quoted text' readonly ${HOME} "$@" /usr/bin sed readonly cd test
+test grep local "$@" local | ${HOME}
+		--verbose awk local test
+		echo ${HOME} && | printf $(pwd)
+	--verbose 'quoted text' "$@" | -eu ${HOME} printf cd
+		"$1" $(pwd) cd printf done
+	export printf && | -eu $(pwd) 2>/dev/null /usr/bin
+	$(pwd) && then cd x=1 -eu then 2>/dev/null
+/usr/bin x=1 echo cd readonly $(pwd)
+		sed "$@" local /usr/bin /usr/bin cd | echo echo $(pwd) readonly export
+	readonly awk --verbose readonly echo readonly test readonly ${HOME} export
+then printf done sed then 'quoted text'
+export grep 2>/dev/null done
+	${HOME} 'quoted text' cd readonly done 'quoted text' printf done
+		x=1 local 2>/dev/null printf -eu $(pwd) readonly then
+		test grep done "$1" $(pwd) awk /usr/bin export
+		| 2>/dev/null grep /usr/bin done then x=1
+&& ${HOME} 'quoted text' grep then | cd ${HOME} /usr/bin readonly cd x=1
+	printf 'quoted text' awk test | echo 2>/dev/null /usr/bin && "$1" awk 2>/dev/null
+	awk then "$1" cd readonly | awk $(pwd)
+readonly awk && ${HOME} echo --verbose cd test $(pwd) grep awk cd awk | "$1" readonly
+x=1 done 'quoted text' --verbose
+	${HOME} && awk printf ${HOME} --verbose sed | && $(pwd) then done && 2>/dev/null
+		readonly test sed 'quoted text' cd -eu 'quoted text'
+	test "$@" --verbose local local echo x=1 "$1" && done export "$@" local then
+		export local | 2>/dev/null echo sed echo export
+	printf "$1" && sed | then | && test
+		test echo --verbose then then echo export cd done readonly local readonly
+done then "$1" --verbose cd && grep sed 2>/dev/null test local
+printf --verbose ${HOME} 'quoted text'
+		readonly then echo then x=1 "$1" local $(pwd) awk test
+		-eu sed 'quoted text' | "$@" /usr/bin printf test "$1" readonly test 2>/dev/null
+echo && && $(pwd) readonly grep awk 2>/dev/null && --verbose && done /usr/bin readonly
+		export x=1 readonly 2>/dev/null $(pwd) echo --verbose printf $(pwd)
+	/usr/bin test awk grep readonly $(pwd) 'quoted text' && /usr/bin
+	cd awk | && /usr/bin sed "$1" export && sed then
+	grep -eu done then /usr/bin test --verbose 'quoted text'
+		sed grep x=1 grep then
+	$(pwd) done done awk "$@" cd then 2>/dev/null test ${HOME} echo
+	x=1 | 'quoted text' && cd && "$1" echo sed --verbose printf grep && awk sed --verbose
+	'quoted text' $(pwd) 2>/dev/null /usr/bin
+	cd -eu echo "$@" x=1 done /usr/bin local | done
+		export --verbose ${HOME} -eu /usr/bin local /usr/bin grep ${HOME} -eu x=1 cd ${HOME}
+		cd printf test printf /usr/bin done 2>/dev/null -eu 2>/dev/null 2>/dev/null
+		echo x=1 grep test ${HOME} sed "$1" sed "$@" $(pwd)
+		readonly "$1" awk && --verbose x=1 export ${HOME} 2>/dev/null readonly
+done local -eu 'quoted text' --verbose readonly cd grep $(pwd) test sed x=1 x=1
+	&& | /usr/bin then cd readonly ${HOME}
+	cd echo /usr/bin | done cd "$@" 'quoted text' cd sed
+readonly test cd cd --verbose | test cd export echo awk x=1 && && 'quoted text'
+	grep && --verbose $(pwd) then readonly test "$1" export x=1 printf |
+	then echo cd "$@" test sed "$@" /usr/bin awk /usr/bin
+	x=1 "$@" 'quoted text' awk 2>/dev/null x=1 /usr/bin grep export
+	test sed done /usr/bin "$@" grep sed grep "$1" $(pwd) |
+x=1 awk ${HOME} --verbose local printf "$@" 2>/dev/null -eu
+		cd 'quoted text' cd -eu 'quoted text' then then done readonly sed
+awk /usr/bin export then local "$@" | --verbose /usr/bin sed awk cd cd 'quoted text'
+		grep -eu $(pwd) --verbose "$1" printf readonly awk
+		| $(pwd) grep "$1" done x=1 test
+		x=1 "$1" local | | ${HOME} export
+	printf readonly printf "$1" ${HOME} /usr/bin awk "$1" awk "$1" echo printf export
+		done awk $(pwd) export && echo 2>/dev/null $(pwd)
+echo && x=1 2>/dev/null x=1 grep readonly
+echo readonly sed awk | $(pwd) "$1" export | "$@" && sed
+	echo | cd cd x=1 "$1" "$@" then "$@" /usr/bin test sed test 'quoted text'
+		'quoted text' local --verbose x=1 --verbose sed && local sed test /usr/bin
+then echo 2>/dev/null /usr/bin done $(pwd) | | cd 'quoted text'
+		echo "$@" "$1" sed sed cd then done 2>/dev/null cd | grep && $(pwd) printf 2>/dev/null
+${HOME} /usr/bin cd sed printf then /usr/bin
+		"$1" export awk cd test then
+		&& "$1" cd --verbose grep 2>/dev/null test $(pwd) test
+grep x=1 echo local then 'quoted text'
+then readonly x=1 then done export local 2>/dev/null $(pwd) && sed test && "$1"
+	sed "$@" x=1 ${HOME} && test x=1 test "$@" 'quoted text' ${HOME} "$@" $(pwd)
+	"$@" awk echo export 'quoted text' printf local 'quoted text' ${HOME}
+	grep /usr/bin local x=1 'quoted text' 2>/dev/null "$@" -eu grep x=1
+	"$@" 2>/dev/null echo done 'quoted text' sed done -eu grep echo cd 2>/dev/null
+	grep && 'quoted text' done x=1 'quoted text' then $(pwd) $(pwd) done |
+		--verbose awk -eu 'quoted text' /usr/bin -eu sed echo x=1 "$1" | readonly readonly
+2>/dev/null sed ${HOME} /usr/bin
+		$(pwd) ${HOME} export export x=1 2>/dev/null 2>/dev/null --verbose 'quoted text'
+x=1 local readonly "$1" export -eu $(pwd)
+printf printf test awk cd x=1 readonly done
+awk "$1" ${HOME} printf done --verbose test sed awk
+		echo x=1 /usr/bin ${HOME} /usr/bin sed | cd
+	"$1" "$1" | awk printf printf 'quoted text' /usr/bin "$1" 2>/dev/null done
+awk local cd /usr/bin done -eu readonly readonly
+"$@" printf awk 2>/dev/null grep
+"$1" then /usr/bin 'quoted text' 'quoted text' readonly done $(pwd) local
+	export x=1 | export export /usr/bin $(pwd)
+	sed ${HOME} test 2>/dev/null printf
+	sed --verbose $(pwd) 2>/dev/null && then
+		x=1 -eu && "$@" test awk printf sed then readonly export $(pwd) printf
+	local && grep printf x=1 "$1" grep 'quoted text' awk export
+		/usr/bin --verbose done cd echo printf
+		done ${HOME} "$1" | sed cd 2>/dev/null export ${HOME} readonly then /usr/bin
+	2>/dev/null grep x=1 done
+		local && done | "$1" cd then echo
+		${HOME} readonly -eu 'quoted text' 2>/dev/null "$1"
+	awk then local $(pwd) --verbose x=1 awk local
+		printf /usr/bin "$@" sed cd --verbose $(pwd) printf test &&
+&& cd sed export 2>/dev/null 2>/dev/null done grep "$@" readonly
+	--verbose --verbose 2>/dev/null /usr/bin | sed $(pwd) | done then $(pwd)
+	/usr/bin echo ${HOME} 2>/dev/null | | 'quoted text' test 'quoted text' | && cd
+	echo sed "$@" done awk
+		2>/dev/null test -eu sed | readonly then then -eu -eu then | /usr/bin
+	done export --verbose done cd --verbose x=1 awk /usr/bin x=1
+then ${HOME} echo "$@" readonly x=1
+		cd done | local /usr/bin x=1 2>/dev/null 'quoted text' --verbose
+readonly "$1" -eu /usr/bin "$@" --verbose awk awk
+		local $(pwd) sed sed echo export done
+		--verbose cd sed readonly test done echo printf then "$1" "$1"
+	/usr/bin test echo printf then | | --verbose
+		'quoted text' "$@" $(pwd) ${HOME} x=1 sed test done x=1 ${HOME} grep echo readonly
+	cd x=1 local 2>/dev/null test $(pwd) && "$@" 2>/dev/null readonly
+		grep --verbose sed -eu
+		grep | grep "$@" echo "$@" 'quoted text' printf -eu -eu local | ${HOME} ${HOME}
+		&& sed local printf awk printf -eu && -eu /usr/bin
+local && --verbose grep | local "$1" awk "$@" $(pwd) /usr/bin
+	local readonly 2>/dev/null -eu grep x=1 local
+	then 'quoted text' /usr/bin
+		| readonly readonly | --verbose awk echo x=1 sed echo
+	/usr/bin $(pwd) done /usr/bin 'quoted text' cd echo "$@" done "$1" /usr/bin done
+	/usr/bin x=1 "$1" | cd "$1" done
+| /usr/bin readonly readonly
+cd -eu /usr/bin local echo echo 2>/dev/null local && "$@" test
+cd x=1 local 'quoted text' printf sed "$@" 2>/dev/null "$@" 'quoted text'
+		then x=1 test then --verbose 'quoted text'
+/usr/bin cd export awk
+	export ${HOME} --verbose export export cd done /usr/bin ${HOME}
+printf readonly export test done | sed $(pwd)
+${HOME} && $(pwd) $(pwd) "$@" "$@" 2>/dev/null ${HOME} x=1 echo sed
+	'quoted text' readonly then --verbose x=1
+2>/dev/null "$1" echo ${HOME} sed local then local ${HOME} --verbose
+		sed $(pwd) test sed readonly export 'quoted text' test
+		printf export echo --verbose done /usr/bin
+awk x=1 && /usr/bin x=1 'quoted text' printf "$1" echo ${HOME} done done echo
+	cd 'quoted text' x=1 then test grep 2>/dev/null 2>/dev/null local 2>/dev/null
+readonly $(pwd) then 2>/dev/null grep ${HOME}
+		$(pwd) grep cd -eu ${HOME} sed x=1 -eu awk readonly | && cd "$1" awk 'quoted text'
+'quoted text' printf test done "$1" sed test
+printf then $(pwd) $(pwd) --verbose $(pwd) printf readonly done
+		/usr/bin /usr/bin cd readonly --verbose
+		awk local $(pwd) cd export test test ${HOME} grep /usr/bin
+	printf readonly sed awk "$1" done sed export /usr/bin $(pwd) -eu
+${HOME} local export local
+test test x=1 $(pwd) cd /usr/bin test grep "$1" awk ${HOME} done done done readonly
+	then $(pwd) x=1 'quoted text' $(pwd) test
+	export -eu "$@" awk test export /usr/bin printf | done local /usr/bin
+	cd && echo "$@" sed awk export
+		x=1 printf echo awk x=1 echo --verbose ${HOME} printf x=1 ${HOME} printf
+		local 'quoted text' local | grep ${HOME}
+-eu printf local test sed export 2>/dev/null readonly sed &&
+'quoted text' --verbose | $(pwd) "$@" /usr/bin
+	"$@" -eu export cd /usr/bin $(pwd) ${HOME} /usr/bin
+		test readonly "$1" /usr/bin --verbose | awk awk
+cd echo export sed then -eu readonly $(pwd) -eu cd echo 2>/dev/null "$1" grep
+/usr/bin export readonly export $(pwd)
+	then then then cd "$1" &&
+		2>/dev/null | export export grep
+	2>/dev/null /usr/bin cd 'quoted text' done
+		| "$@" /usr/bin grep readonly $(pwd) awk sed grep
+		2>/dev/null test echo "$1" grep readonly export echo echo echo /usr/bin
+	| && awk sed "$1" /usr/bin $(pwd) readonly --verbose 2>/dev/null "$@"
+sed | 2>/dev/null && "$1" 2>/dev/null
+	then "$1" local grep x=1 awk /usr/bin --verbose test export && 2>/dev/null
+	echo "$1" 2>/dev/null "$@" /usr/bin then /usr/bin
+	cd printf printf test $(pwd) test 'quoted text'
+	2>/dev/null export then $(pwd) "$1" sed "$1" --verbose done sed | "$1"
+| 'quoted text' 'quoted text' grep awk then 'quoted text' then
+'quoted text' cd $(pwd) ${HOME} 'quoted text' /usr/bin export awk cd
+	-eu ${HOME} /usr/bin --verbose /usr/bin
+printf x=1 /usr/bin test $(pwd) then printf
+		$(pwd) echo 2>/dev/null | grep
+		printf cd --verbose awk "$@" test grep readonly 'quoted text' 'quoted text' local
+		'quoted text' && then awk --verbose -eu &&
+	echo -eu -eu "$@" cd awk 2>/dev/null | done --verbose
+echo grep 'quoted text' $(pwd) done grep echo | $(pwd) /usr/bin local ${HOME}
+		awk local test then test printf grep "$@" 'quoted text' 2>/dev/null "$1" x=1 2>/dev/null
+	export 2>/dev/null /usr/bin echo readonly
+echo echo /usr/bin 2>/dev/null
+		${HOME} --verbose 'quoted text' then test
+		'quoted text' test export "$1" printf done 'quoted text' done && x=1 2>/dev/null
+		'quoted text' then printf awk
+		printf done ${HOME} | | grep "$@" export awk sed test
+"$1" awk done "$@" 2>/dev/null awk ${HOME} /usr/bin sed echo then "$@" grep $(pwd)
+'quoted text' && sed echo local printf
+		sed -eu | x=1 awk -eu 2>/dev/null "$@" awk /usr/bin ${HOME} echo then
+	'quoted text' --verbose sed local export ${HOME} ${HOME} printf && x=1 ${HOME}
+		cd "$@" -eu then grep --verbose && 2>/dev/null /usr/bin
+		/usr/bin --verbose 'quoted text' && readonly | awk printf readonly
+	&& 2>/dev/null ${HOME} then | done test /usr/bin echo "$@" |
+		local --verbose && readonly local -eu 'quoted text' "$@"
+	2>/dev/null "$@" echo export awk awk ${HOME} ${HOME}
+	-eu cd readonly "$1" --verbose readonly 'quoted text' cd && | $(pwd)
+&& awk "$@" $(pwd) printf test printf cd "$@" ${HOME}
+"$1" "$@" local "$@" grep grep --verbose sed -eu then echo 'quoted text'
+	-eu ${HOME} printf export done "$@" export /usr/bin cd done 2>/dev/null
+--verbose cd 2>/dev/null echo "$@" "$@" then done /usr/bin
+	awk 2>/dev/null -eu cd awk -eu test done | | sed -eu export done $(pwd) |
+"$1" sed done done $(pwd) awk cd export done
+"$1" $(pwd) local --verbose && 'quoted text' ${HOME} grep
+	test done done x=1 export "$@" 'quoted text' printf test
+-eu awk then | "$@" readonly
+	grep cd awk printf "$1" export
+	echo awk grep sed "$@" -eu grep
+		local | x=1 --verbose --verbose sed test local /usr/bin | x=1 awk x=1 ${HOME}
+		2>/dev/null done "$@" local grep "$1" cd &&
+&& ${HOME} grep && && readonly && local export
+		| ${HOME} ${HOME} test awk echo $(pwd) printf
+		cd --verbose sed $(pwd) "$1" grep ${HOME} local /usr/bin printf | ${HOME} "$@"
+x=1 --verbose /usr/bin local -eu "$1" "$1" echo
+		"$@" x=1 ${HOME} cd done 'quoted text' printf $(pwd) | readonly
+		then echo local --verbose | readonly && done cd then grep $(pwd) echo 2>/dev/null
+	-eu export x=1 cd then
+		test | awk $(pwd) x=1 cd grep 'quoted text'
+	awk grep && done readonly
+		${HOME} echo printf --verbose test local readonly test local echo cd awk
+	echo "$1" 'quoted text' /usr/bin readonly && test && cd then
+2>/dev/null $(pwd) 2>/dev/null
+'quoted text' ${HOME}
+test "$@" printf x=1 ${HOME} && "$@" done grep test local grep
+		printf printf "$1" "$1" awk readonly echo sed export --verbose cd 'quoted text'
+		"$@" --verbose done 2>/dev/null export $(pwd) cd local "$@" | printf --verbose
+local x=1 "$1" cd $(pwd) 2>/dev/null sed then 2>/dev/null && grep | |
+"$@" ${HOME} test grep && sed x=1 "$@" x=1 --verbose ${HOME}
+		"$@" $(pwd) "$1" awk ${HOME} | done export
+	x=1 sed "$@" then -eu 2>/dev/null $(pwd) readonly x=1 readonly readonly grep readonly
+	2>/dev/null readonly done && | --verbose
+	echo grep grep -eu x=1 ${HOME} $(pwd) then $(pwd) | done x=1 ${HOME} "$@" readonly
+		/usr/bin "$@" done "$1" test sed test "$@" test echo printf readonly export
+	readonly cd test --verbose
+	awk readonly ${HOME} | | $(pwd) /usr/bin &&
+	awk 'quoted text' /usr/bin x=1 echo then printf done sed awk 2>/dev/null
+	&& cd grep 'quoted text' $(pwd) local
+	export printf | sed then /usr/bin cd 2>/dev/null sed "$1" local
+	cd 'quoted text' echo 'quoted text' /usr/bin
+test grep grep done sed $(pwd) echo | $(pwd) | | test sed $(pwd)
+		/usr/bin export echo done "$@" 'quoted text' ${HOME} --verbose -eu
+then done sed 2>/dev/null /usr/bin grep grep --verbose "$@" "$@"
+		'quoted text' sed sed export export printf | /usr/bin x=1 2>/dev/null
+echo readonly 'quoted text' done then 2>/dev/null echo printf printf
+	cd readonly -eu $(pwd) echo done
+		echo --verbose && awk "$@" "$1" "$1" 'quoted text' test -eu 2>/dev/null
+		sed test done test 2>/dev/null local 'quoted text' done --verbose /usr/bin export
+test readonly readonly done printf 'quoted text'
+		echo done x=1 x=1 && readonly
+$(pwd) echo done /usr/bin readonly 2>/dev/null --verbose then grep --verbose awk
+done done cd cd printf /usr/bin --verbose
+x=1 /usr/bin cd 2>/dev/null printf -eu local local then test "$1" &&
+export "$@" test test test -eu ${HOME} cd x=1 sed $(pwd) readonly "$@" awk
+	done 'quoted text' cd "$1" sed 2>/dev/null
+/usr/bin | export grep sed grep ${HOME} x=1 readonly
+		-eu readonly --verbose readonly done -eu && test
+		awk --verbose $(pwd) readonly
+		x=1 'quoted text' "$1" cd awk cd readonly 2>/dev/null $(pwd) test
+		then && x=1 | | -eu --verbose
+		local done awk "$@" && done --verbose done ${HOME} done echo
+2>/dev/null cd | 'quoted text'
+cd export export local ${HOME} printf
+2>/dev/null printf ${HOME} x=1 grep then
+	readonly export test awk /usr/bin
+2>/dev/null echo then test export test 2>/dev/null 2>/dev/null "$@"
+	/usr/bin x=1 done --verbose then ${HOME} test "$@" "$1" then
+	grep printf test 'quoted text' export "$@" done /usr/bin
+	/usr/bin 2>/dev/null echo printf
+	"$1" awk test 'quoted text' "$1" "$@" export done x=1 "$1" "$1" export && awk
+	sed $(pwd) test local && printf echo
+		&& $(pwd) cd readonly && printf /usr/bin echo test export "$1" local
+	echo x=1 /usr/bin ${HOME} then -eu && /usr/bin 'quoted text'
+	"$@" grep $(pwd) "$1" echo 2>/dev/null
+| export printf 'quoted text' && "$1" cd sed $(pwd)
+export "$@" 'quoted text'
+grep cd then "$1" ${HOME} -eu --verbose /usr/bin
+	printf readonly export --verbose
+		printf x=1 test 2>/dev/null then test export
+	printf cd printf -eu done --verbose 'quoted text'
+	x=1 cd x=1 2>/dev/null echo then "$@" awk sed done echo "$@" local
+| export then echo /usr/bin readonly
+	-eu | echo 'quoted text' "$@" $(pwd) local
+	"$@" done /usr/bin grep 2>/dev/null $(pwd) "$@" x=1 export 'quoted text'
+		then echo grep "$@" ${HOME} "$1" -eu $(pwd) | printf 2>/dev/null | "$1" grep
+	then $(pwd) && test grep -eu awk x=1 awk ${HOME} x=1 -eu --verbose then
+		test ${HOME} grep done ${HOME} printf grep $(pwd)
+		done "$1" ${HOME} printf --verbose x=1 printf awk $(pwd) /usr/bin echo
+"$@" ${HOME} printf test sed -eu
+		${HOME} "$@" -eu --verbose test && /usr/bin
+/usr/bin $(pwd) 'quoted text' 'quoted text'
+		&& export done 2>/dev/null export "$@" 'quoted text'
+	cd 'quoted text' $(pwd) test /usr/bin
+	"$@" 'quoted text' x=1 then "$@" && grep ${HOME}
+2>/dev/null echo $(pwd) sed && -eu export echo
+		/usr/bin "$1" cd test
+&& | x=1 -eu done --verbose echo readonly export
+		printf 2>/dev/null -eu cd sed $(pwd) grep echo
+		"$@" export --verbose --verbose printf 'quoted text' $(pwd) echo --verbose
+${HOME} && x=1 awk "$1" -eu grep $(pwd) then
+		${HOME} readonly sed cd printf awk export echo local $(pwd) 'quoted text' then
+		x=1 echo --verbose "$@" awk export grep readonly
+x=1 awk grep done $(pwd) test cd && grep x=1
+sed 'quoted text' test |
+		printf x=1 then export 'quoted text'
+	2>/dev/null | awk | export awk
+	--verbose grep then printf && then 'quoted text' echo printf cd done
+printf --verbose grep echo readonly /usr/bin grep echo $(pwd) --verbose test
+	echo /usr/bin | && then "$1" --verbose "$@" cd test | export grep cd awk awk |
+then grep -eu local readonly readonly local echo sed "$@" "$@" sed -eu
+"$@" grep -eu --verbose
+	export "$1" /usr/bin test x=1 sed
+	readonly printf 2>/dev/null then done grep | printf 2>/dev/null
+	then sed /usr/bin 'quoted text' -eu printf done "$1" /usr/bin done $(pwd) cd awk
+printf echo | grep awk done "$1" -eu local ${HOME} ${HOME} -eu grep "$1" awk $(pwd)
+		"$@" test "$1" ${HOME} readonly
+local grep grep 'quoted text' && /usr/bin done | 'quoted text' ${HOME}
+| 'quoted text' --verbose | "$1" echo test
+	${HOME} /usr/bin 'quoted text' done | readonly 2>/dev/null cd export readonly
+	local -eu $(pwd) && grep cd sed done --verbose
+x=1 $(pwd) grep sed local printf "$1" "$@" $(pwd) grep
+local readonly readonly echo then printf 'quoted text' grep grep sed cd 'quoted text'
+	sed grep x=1 echo /usr/bin grep then test
+		done 2>/dev/null test echo echo done /usr/bin then ${HOME} sed
+then --verbose 'quoted text' /usr/bin && sed $(pwd) "$1" x=1 done cd done
+		done --verbose --verbose "$1" test export echo && grep echo ${HOME} printf /usr/bin
+	awk && readonly | echo --verbose echo x=1 echo
+test printf awk readonly --verbose ${HOME} test | 2>/dev/null
+'quoted text' export /usr/bin "$@"
+		done sed done ${HOME} $(pwd) -eu
+echo awk cd x=1 "$1" $(pwd) echo test cd | readonly awk | grep cd x=1 --verbose
+	sed 'quoted text' /usr/bin 'quoted text'
+		then export done && then | export -eu 'quoted text'
+		--verbose "$1" -eu printf ${HOME} /usr/bin
+	&& "$@" 2>/dev/null export --verbose /usr/bin cd 2>/dev/null $(pwd) 'quoted text'
+		printf done grep grep done awk local
+&& done $(pwd) grep echo grep readonly
+x=1 /usr/bin ${HOME} && | test echo then
+	&& export "$@" test cd export
+test -eu -eu 2>/dev/null export x=1 "$1" x=1 cd echo
+| sed ${HOME} --verbose local $(pwd) x=1
+	readonly && export /usr/bin readonly printf && 2>/dev/null --verbose "$1" readonly
+		-eu cd echo export "$@" local readonly export printf printf "$@" "$1"
+	local "$1" echo awk x=1 'quoted text' export test local -eu printf cd --verbose
+x=1 awk -eu ${HOME} 'quoted text' sed | done then --verbose export ${HOME} printf
+	printf --verbose local local x=1 readonly echo cd -eu done local "$@" echo
+	&& /usr/bin readonly -eu awk echo /usr/bin export
+	cd 'quoted text' readonly test
+		done /usr/bin awk -eu 'quoted text' export 2>/dev/null export $(pwd) printf 2>/dev/null
+		echo readonly | && && export $(pwd) 'quoted text'
+	then "$@" cd test printf echo
+		2>/dev/null ${HOME} ${HOME}
+	| 'quoted text' 2>/dev/null 2>/dev/null then local /usr/bin readonly 2>/dev/null
+| awk 'quoted text' sed x=1 && $(pwd) --verbose
+echo "$@" test readonly ${HOME} "$1" readonly export export
+	sed cd 'quoted text' export |
+done /usr/bin x=1 'quoted text' test echo
+printf awk test cd /usr/bin readonly readonly cd printf done awk
+	-eu readonly 2>/dev/null awk "$@" local grep awk -eu done --verbose
+		&& readonly && x=1 done done printf awk "$1" && $(pwd) $(pwd) ${HOME}
+		readonly echo echo 2>/dev/null /usr/bin then
+grep local cd sed 'quoted text' ${HOME} grep sed
+		x=1 'quoted text' && test printf x=1
+--verbose "$1" readonly then test
+${HOME} x=1 printf then 'quoted text' printf && cd awk
+		"$1" | grep --verbose /usr/bin
+then "$1" awk "$@" 2>/dev/null
+		awk readonly then /usr/bin ${HOME} 'quoted text'
+	2>/dev/null awk $(pwd) done 'quoted text' echo
+	'quoted text' echo -eu export 'quoted text' 2>/dev/null
+	$(pwd) local x=1 x=1 grep && grep --verbose
+	&& awk | 2>/dev/null printf cd | 'quoted text' --verbose 'quoted text'
+	then 2>/dev/null grep ${HOME} then
+-eu && /usr/bin $(pwd) ${HOME} | -eu grep printf 'quoted text' "$1" then
+${HOME} $(pwd) awk "$1" export $(pwd) sed cd | /usr/bin sed "$1" -eu
+		sed local grep 'quoted text' echo printf && then local
+/usr/bin "$@" then | "$@" done readonly 'quoted text' local sed && awk grep
+sed $(pwd) test export
+	sed /usr/bin && grep local export x=1
+		sed 'quoted text' /usr/bin awk printf awk test /usr/bin echo /usr/bin grep "$@"
+done done "$@" local local "$@" grep cd /usr/bin "$1" cd && echo cd --verbose
+	"$1" echo sed sed echo then sed ${HOME} $(pwd) echo printf 'quoted text' grep
+		$(pwd) /usr/bin ${HOME} local 'quoted text' "$@" sed 2>/dev/null
+		readonly sed /usr/bin | test echo test "$@" | awk --verbose
+		"$1" grep cd echo echo --verbose
+		test 2>/dev/null && cd /usr/bin
+		-eu $(pwd) sed readonly readonly ${HOME} "$1" --verbose local
+		printf echo printf awk && | ${HOME} $(pwd) $(pwd)
+done --verbose 2>/dev/null test -eu done && cd 2>/dev/null
+		echo local grep && ${HOME} x=1 test done $(pwd) && sed done awk /usr/bin
+sed && export done sed ${HOME} cd local --verbose ${HOME} awk test && readonly
+		${HOME} cd done done "$1" local
+		echo 'quoted text' | 'quoted text' x=1 test
+test "$@" x=1 ${HOME} --verbose cd /usr/bin &&
+		grep "$@" test test x=1 'quoted text' echo 'quoted text' printf then printf -eu
+&& done && readonly grep
+cd 'quoted text' | grep test printf sed
+test 'quoted text' done "$@" local -eu local
+sed -eu -eu "$1" done $(pwd) | test "$@" awk done export ${HOME}
+printf grep && | test "$@" 2>/dev/null cd ${HOME}
+		echo /usr/bin echo x=1 --verbose export
+echo 'quoted text' "$1" -eu printf -eu $(pwd) && | done readonly awk 2>/dev/null
+$(pwd) readonly printf 'quoted text' $(pwd) /usr/bin | "$@" cd test test
+	cd awk test then x=1 "$@" /usr/bin x=1 then
+		printf readonly printf "$@" export
+	${HOME} echo done 2>/dev/null test readonly | test 'quoted text' then
+	"$1" done printf && ${HOME} local cd -eu sed cd "$1" "$@" x=1 --verbose
+	/usr/bin --verbose $(pwd) && 'quoted text' /usr/bin then local export sed ${HOME}
+-eu cd local | ${HOME} /usr/bin done
+done 2>/dev/null printf local local | printf export grep && awk cd -eu echo
+		'quoted text' local 'quoted text'
+	$(pwd) 2>/dev/null printf
+	cd export grep $(pwd) test
+	"$1" $(pwd) cd $(pwd) test
+		done x=1 && export printf cd 2>/dev/null cd ${HOME} "$1" then export
+		cd sed 2>/dev/null "$1" then echo && "$1" readonly -eu --verbose then
+		cd | x=1 --verbose echo 'quoted text' then local grep 2>/dev/null
+		-eu cd "$1" sed "$1" readonly |
+		&& | "$@" echo $(pwd) "$1" 2>/dev/null | echo printf 'quoted text'
+		sed grep $(pwd) readonly cd "$1" readonly done
+	2>/dev/null readonly ${HOME} ${HOME} -eu /usr/bin readonly grep done
+x=1 'quoted text' printf /usr/bin test grep awk
+grep done 2>/dev/null 'quoted text' grep printf -eu 'quoted text'
+		2>/dev/null echo $(pwd) sed --verbose then then
+&& test printf -eu $(pwd) local
+--verbose then && printf cd then x=1 awk 2>/dev/null
+		| $(pwd) | "$@" then local "$1" --verbose "$1" | cd sed 2>/dev/null
+		x=1 done test sed x=1 awk "$@"
+	export && echo ${HOME} echo local ${HOME} awk
+/usr/bin && printf echo 'quoted text'
+	local local "$1" x=1 local sed "$@" sed "$1" -eu
+| && then -eu then --verbose done x=1 --verbose
+		echo $(pwd) test x=1 test | 'quoted text' && --verbose
+done "$@" sed readonly then --verbose -eu done
+		"$@" then test "$1" -eu "$@"
+	$(pwd) 2>/dev/null then "$1" 2>/dev/null awk export x=1 "$1"
+		done /usr/bin done echo local 2>/dev/null 2>/dev/null then
+| -eu && x=1 "$1" x=1 cd cd x=1 2>/dev/null then --verbose export "$@"
+	awk export echo $(pwd) ${HOME} printf printf echo grep /usr/bin ${HOME}
+		readonly then "$1" 'quoted text' export ${HOME}
+	"$1" printf x=1 /usr/bin ${HOME} "$1" "$@" && export
+test export printf x=1 2>/dev/null printf test sed
+	echo && x=1 export echo echo printf --verbose "$@" export "$@"
+	"$1" 'quoted text' x=1 sed --verbose --verbose "$@" | readonly done && printf
+readonly "$@" then --verbose
+awk local export | $(pwd) export test readonly
+$(pwd) cd --verbose echo grep sed printf x=1
+sed -eu x=1 readonly test | $(pwd) grep export 'quoted text' ${HOME}
+	done grep && "$1" x=1 x=1 done export && "$@" then
+		printf then then local then grep
+	grep grep cd awk local -eu cd 'quoted text' --verbose
+sed sed 'quoted text' x=1 2>/dev/null 2>/dev/null --verbose -eu x=1 sed echo
+		'quoted text' | grep sed cd
+x=1 | then -eu readonly printf local --verbose 'quoted text' /usr/bin
+		cd then sed test "$@" 2>/dev/null -eu readonly &&
+'quoted text' then readonly
+	'quoted text' $(pwd) export $(pwd) --verbose
+	--verbose x=1 then then /usr/bin
+	echo awk readonly done printf echo -eu sed ${HOME} /usr/bin && && cd
+&& then echo cd 'quoted text' x=1 x=1 awk --verbose ${HOME} awk readonly
+		/usr/bin sed awk x=1 then ${HOME} x=1
+		export printf --verbose awk 2>/dev/null ${HOME} done
+	test echo cd local /usr/bin /usr/bin -eu sed echo $(pwd) test --verbose
+	sed 2>/dev/null readonly awk 'quoted text'
+		awk "$1" export awk | test local 2>/dev/null 2>/dev/null done sed then
+	echo grep "$@" printf
+	echo /usr/bin then $(pwd) printf | grep done printf && export printf
+		test local echo sed cd 'quoted text'
+	cd /usr/bin x=1 x=1 "$@" 'quoted text' printf | x=1 test "$@" grep local then $(pwd)
+		test awk export "$@" printf
+	sed test ${HOME} --verbose 2>/dev/null 2>/dev/null
+test awk export export grep 'quoted text'
+&& test export | cd x=1 "$@" test echo readonly x=1 "$1" 'quoted text' ${HOME}
+	echo 'quoted text' --verbose printf cd done $(pwd) ${HOME}
+printf then echo done "$1"
+-eu awk local "$1" | "$@" export done x=1 export "$@" then grep
+readonly x=1 x=1 done echo cd
+	'quoted text' awk then "$1" then printf | | ${HOME}
+awk 'quoted text' readonly
+${HOME} cd --verbose 2>/dev/null test 'quoted text' 'quoted text'
+"$@" $(pwd) cd readonly -eu "$@" cd cd echo echo export sed cd /usr/bin
+	&& grep sed sed echo test awk /usr/bin "$@" export
+| "$@" printf awk export "$1" grep readonly --verbose "$@" readonly x=1
+		x=1 echo | grep -eu $(pwd) then then $(pwd) sed ${HOME} | $(pwd) sed
+	&& grep export export export then "$@" $(pwd) && $(pwd) 2>/dev/null 'quoted text'
+"$1" ${HOME} | awk /usr/bin && | then x=1 awk --verbose awk then "$@"
+	local awk test echo 'quoted text' x=1 cd 2>/dev/null 'quoted text'
+	/usr/bin 2>/dev/null done local "$@" ${HOME} done "$1" ${HOME}
+then ${HOME} /usr/bin | awk "$1" cd -eu then "$@" "$@" 'quoted text' cd | 'quoted text'
+grep x=1 echo printf "$@" local ${HOME} export "$1" ${HOME} then && local echo
+	printf printf | x=1 test
+	cd echo && | sed "$@" test
+		printf cd --verbose readonly sed "$1" && cd "$@"
+		'quoted text' "$@" --verbose --verbose --verbose --verbose 2>/dev/null
+	| local awk cd echo $(pwd) test echo cd awk 'quoted text'
+cd export --verbose x=1 | readonly
+		"$@" ${HOME} grep awk sed done test "$1" done test sed awk -eu awk | "$@" done
+grep ${HOME} local "$@" readonly cd && local $(pwd) -eu | readonly readonly
+		$(pwd) then awk sed 2>/dev/null | grep printf echo
+	echo --verbose x=1 "$@" /usr/bin
+		local 'quoted text' awk echo /usr/bin 'quoted text' export |
+		| "$@" local done -eu --verbose test -eu 2>/dev/null
+sed export done --verbose test echo x=1
+		/usr/bin "$1" test | export 2>/dev/null
+	awk 2>/dev/null readonly 2>/dev/null 'quoted text'
+awk /usr/bin test export printf && test awk test "$1"
+&& $(pwd) | printf awk -eu /usr/bin done
+'quoted text' "$@" printf | && cd 2>/dev/null test
+		| then -eu "$@" sed awk readonly then $(pwd) "$@" && grep ${HOME} ${HOME} -eu
+	done ${HOME} "$1" echo 2>/dev/null 'quoted text'
+		/usr/bin sed 2>/dev/null "$1"
+		awk printf $(pwd) cd test test test printf
+printf printf readonly echo "$@" 2>/dev/null awk $(pwd)
+	then echo -eu x=1 sed local ${HOME} awk then x=1 -eu | sed echo /usr/bin echo "$1"
+readonly | cd echo cd --verbose x=1 --verbose local
+"$@" $(pwd) printf 2>/dev/null | local --verbose awk
+		local readonly | grep 'quoted text' test test "$@" 2>/dev/null && then printf
+		"$@" test cd then sed
+echo printf 'quoted text' cd grep export 'quoted text'
+		grep awk echo -eu done -eu readonly ${HOME} test ${HOME} done cd 'quoted text'
+x=1 ${HOME} test 'quoted text' printf awk 2>/dev/null
+		then test | echo ${HOME} 'quoted text' then export /usr/bin "$@" awk
+		grep readonly /usr/bin grep grep printf 'quoted text' 2>/dev/null export
+		${HOME} 2>/dev/null local grep x=1 $(pwd) done echo
+x=1 done test grep done 2>/dev/null "$1" export
+	--verbose printf && done | test
+		then printf echo test 'quoted text' | export "$@" "$@"
+	"$@" awk grep -eu awk | sed then 'quoted text' -eu cd 2>/dev/null export
+	| /usr/bin "$@" cd printf
+	2>/dev/null readonly | local $(pwd) readonly test echo --verbose /usr/bin done
+$(pwd) printf printf done "$@" grep printf then "$1" ${HOME}
+		printf | readonly export "$1" -eu ${HOME} awk --verbose
+	readonly cd 2>/dev/null readonly 'quoted text' | 2>/dev/null
+		--verbose local $(pwd) export
+		done cd awk --verbose awk sed grep cd $(pwd) done readonly then sed
+	x=1 /usr/bin $(pwd) awk 2>/dev/null "$1" "$1" test sed /usr/bin
+	/usr/bin sed readonly local sed 2>/dev/null -eu local -eu 2>/dev/null
+	grep -eu sed -eu export then "$1" grep export then awk cd 'quoted text'
+		-eu echo /usr/bin echo awk cd test /usr/bin "$1" --verbose x=1
+	cd "$@" echo sed x=1 awk test awk test echo readonly
+	| grep $(pwd) then --verbose readonly then /usr/bin $(pwd) test 'quoted text' x=1
+echo grep $(pwd) test
+--verbose test "$@" 'quoted text' awk cd --verbose /usr/bin export
+/usr/bin readonly readonly readonly sed export 2>/dev/null awk
+done export test readonly
+	echo | /usr/bin "$@" -eu 'quoted text' $(pwd) test x=1 -eu x=1
+	test $(pwd) readonly 'quoted text' "$1" 2>/dev/null
+		done --verbose cd ${HOME} printf cd ${HOME} $(pwd)
+	then -eu | $(pwd) /usr/bin grep 2>/dev/null x=1 x=1 "$1" x=1 grep -eu
+awk cd echo 'quoted text' $(pwd)
+&& | cd cd sed | | test awk "$@" cd --verbose then 2>/dev/null grep /usr/bin
+echo -eu /usr/bin sed cd "$1" echo then /usr/bin cd readonly test then cd 'quoted text'
+test --verbose echo "$@" 2>/dev/null "$1" | "$1" local $(pwd) 'quoted text' "$1"
+		test done x=1 /usr/bin cd export export sed done cd
+		printf local x=1 then "$@" 'quoted text' ${HOME}
+	grep --verbose echo /usr/bin
+		&& x=1 "$@" sed -eu && export
+		export test | cd readonly ${HOME} | printf x=1 2>/dev/null -eu sed printf
+	-eu 2>/dev/null printf done awk x=1 done readonly "$1" $(pwd)
+		--verbose --verbose local x=1 ${HOME} 2>/dev/null x=1 cd | test cd "$@"
+	sed echo export 'quoted text' echo $(pwd) test then then x=1 sed printf
+		--verbose printf then done echo
+	"$1" -eu && --verbose $(pwd) && cd 2>/dev/null done then && printf
+export echo "$@" $(pwd) /usr/bin readonly
+		printf x=1 sed x=1 "$1" local -eu echo | sed sed --verbose readonly readonly
+done then 2>/dev/null local -eu
+		"$@" x=1 test "$@" "$1" /usr/bin readonly export "$@" x=1 2>/dev/null
+	local printf sed && && | --verbose grep ${HOME}
+		2>/dev/null ${HOME} done grep export echo export
+"$1" --verbose 'quoted text' cd cd --verbose && && && test "$@" grep printf $(pwd)
+	export /usr/bin | $(pwd) && test echo done -eu sed
+		--verbose x=1 --verbose
+echo "$@" done test local then printf test awk
+		x=1 /usr/bin "$@" $(pwd) 'quoted text' printf 'quoted text' sed local
+		-eu test ${HOME} && x=1 --verbose
+export && export && --verbose export cd grep cd sed ${HOME} --verbose
+$(pwd) 2>/dev/null 'quoted text' --verbose
+	readonly export local "$1" local 2>/dev/null
+	-eu | /usr/bin echo readonly
+		then --verbose 2>/dev/null ${HOME} readonly printf ${HOME} "$1" -eu awk
+		$(pwd) grep --verbose then then cd | export x=1 local
+x=1 local "$@" "$1" then "$1" done -eu
+		'quoted text' readonly x=1 readonly ${HOME} then --verbose |
+		/usr/bin cd | -eu -eu cd readonly $(pwd) $(pwd)
+| test ${HOME} then /usr/bin 'quoted text' done -eu ${HOME} -eu | "$@" "$1"
+sed local cd echo export | "$@" 2>/dev/null ${HOME} ${HOME} --verbose
+		grep readonly export x=1 x=1 -eu && done cd grep done | export
+		echo printf 'quoted text' "$1" test
+		'quoted text' "$1" "$@" test done printf
+		sed /usr/bin grep $(pwd) grep awk $(pwd) grep printf $(pwd) sed
+		export test done cd | -eu ${HOME} 2>/dev/null readonly local
+		| 2>/dev/null then cd ${HOME} then local ${HOME} /usr/bin
+then awk echo x=1 "$@" && && awk "$1" done "$@" done /usr/bin "$1"
+	--verbose | test /usr/bin printf
+"$@" local cd local "$1" then "$1" printf then ${HOME} "$1" | x=1 -eu done
+x=1 --verbose grep && ${HOME} "$@" readonly cd x=1 awk done "$1" x=1
+	2>/dev/null 2>/dev/null 'quoted text' readonly && done sed readonly
+	x=1 && --verbose test 'quoted text'
+'quoted text' cd ${HOME} test export cd | | --verbose
+local "$1" echo /usr/bin then $(pwd) -eu export x=1 cd awk "$1" printf export
+cd echo $(pwd) -eu printf /usr/bin grep /usr/bin echo
+	echo /usr/bin readonly /usr/bin ${HOME} echo && 'quoted text' "$1"
+	2>/dev/null --verbose printf then then sed readonly
+export "$@" ${HOME} local $(pwd) local 'quoted text' $(pwd)
+&& grep x=1 2>/dev/null export && then $(pwd) done then sed
+	test && sed $(pwd) test "$@" --verbose "$@" grep sed cd grep --verbose export
+	"$1" /usr/bin 'quoted text' export awk $(pwd) "$@" 'quoted text'
+		-eu x=1 printf | echo export local sed 'quoted text' grep && "$@"
+	x=1 readonly done cd -eu export 2>/dev/null
+	/usr/bin && | test cd $(pwd) then 2>/dev/null
+sed awk "$@" printf 2>/dev/null | "$@" -eu --verbose
+		&& $(pwd) then sed ${HOME} printf -eu echo /usr/bin grep
+local "$@" done local readonly then 2>/dev/null && echo grep then local
+	awk then --verbose && awk x=1 echo "$1" "$1"
+		${HOME} "$1" ${HOME} ${HOME}
+test "$@" && cd | "$@" done | then test test cd $(pwd) | test local
+test "$@" $(pwd) local cd "$1" /usr/bin local grep awk "$@"
+"$@" printf cd done then printf
+	echo readonly awk done x=1 -eu local echo /usr/bin sed 'quoted text'
+		&& "$1" done grep && sed ${HOME} cd
+	"$1" && 2>/dev/null done 2>/dev/null export 2>/dev/null sed $(pwd) "$1" x=1 sed
+		printf test ${HOME} echo -eu $(pwd) test grep "$@" readonly awk cd "$1" && local
+	printf then then && grep
+		awk "$@" /usr/bin 'quoted text' grep $(pwd) 2>/dev/null then
+	then done test cd local -eu
+	done -eu cd grep "$1" export 2>/dev/null "$@" ${HOME} sed awk export test
+		sed readonly readonly -eu "$1" export done local -eu test
+		grep grep ${HOME} -eu local 2>/dev/null "$1" grep done && sed --verbose local
+		'quoted text' ${HOME} done done && local ${HOME} ${HOME} && printf
+sed 'quoted text' --verbose ${HOME} "$1" printf -eu cd test echo
+		sed sed export x=1 awk 2>/dev/null /usr/bin --verbose printf local printf
+		awk 2>/dev/null ${HOME}
+	awk then then ${HOME} ${HOME} then
+done $(pwd) echo $(pwd) echo $(pwd) 'quoted text'
+	2>/dev/null -eu echo sed then ${HOME} x=1 "$1" test -eu 'quoted text'
+x=1 ${HOME} readonly printf | printf awk "$@" then && test --verbose test test
+		$(pwd) ${HOME} local awk --verbose done
+awk sed -eu export echo readonly 2>/dev/null echo cd echo ${HOME}
+		${HOME} && done awk 'quoted text' -eu 2>/dev/null --verbose then x=1 echo
+--verbose done cd x=1 2>/dev/null then
+		x=1 cd -eu export && | "$1" cd --verbose "$@" export
+		'quoted text' printf echo "$@" 'quoted text' local
+test echo printf then then
+		export test 'quoted text' x=1 readonly && /usr/bin 'quoted text' "$@" test
+		export then grep test /usr/bin test
+		"$1" printf awk grep -eu done sed | --verbose sed awk /usr/bin sed /usr/bin &&
+	printf awk sed then x=1
+grep "$1" grep echo cd then export grep readonly local cd export printf cd
+	export awk && then 2>/dev/null "$1" awk "$@"
+test local "$1" readonly -eu
+		--verbose echo && -eu readonly printf export -eu cd "$1" sed grep 'quoted text'
+		/usr/bin "$@" echo cd local ${HOME} --verbose
+		echo export "$1" done $(pwd) readonly
+	| ${HOME} -eu --verbose -eu cd | printf cd
+		&& echo cd --verbose 'quoted text'
+	--verbose printf x=1 $(pwd) readonly "$1" export --verbose "$@" echo
+| readonly --verbose readonly local grep && $(pwd) echo readonly
+${HOME} | $(pwd) --verbose sed
+	readonly -eu awk export grep 2>/dev/null /usr/bin 2>/dev/null done export
+echo local then "$@" local -eu local /usr/bin awk printf -eu
+grep cd "$1" grep && -eu "$1" awk -eu /usr/bin
+	| local readonly ${HOME} /usr/bin
+		done x=1 awk awk readonly sed "$@" | 'quoted text'
+	then 2>/dev/null test echo then cd sed &&
+		'quoted text' echo cd awk /usr/bin then
+		"$@" 'quoted text' local 'quoted text' "$1" | then && x=1
+done done "$@" then -eu --verbose printf test "$@" -eu && done awk readonly $(pwd)
+	$(pwd) echo "$@" /usr/bin --verbose local awk "$1" export --verbose
+		echo /usr/bin awk x=1 echo 2>/dev/null ${HOME} /usr/bin grep --verbose test
+		printf 'quoted text' -eu x=1 echo test
+		x=1 | printf cd ${HOME} echo echo cd | export then ${HOME}
+		cd done ${HOME} "$1" cd "$1" 2>/dev/null | --verbose 2>/dev/null "$@" ${HOME}
+&& test test && $(pwd) then echo "$@" && done
+	echo "$@" readonly ${HOME} sed ${HOME}
+'quoted text' 2>/dev/null ${HOME} && done | x=1
+"$1" --verbose ${HOME} && 'quoted text'
+export 'quoted text' printf "$@"
+test | | sed local sed awk echo cd done cd "$1" -eu /usr/bin grep done
+local "$1" && /usr/bin
+grep x=1 && /usr/bin -eu "$@" 2>/dev/null
+	$(pwd) grep x=1 $(pwd) printf 'quoted text'
+		x=1 --verbose && echo readonly test | ${HOME} && awk -eu test export cd echo
+x=1 --verbose cd then ${HOME} ${HOME} x=1 readonly x=1 readonly /usr/bin then
+		printf | done test cd x=1 local printf ${HOME} local "$1" export cd local
+"$@" local "$@" cd printf && readonly grep "$@" echo local
+		"$1" grep then local 2>/dev/null echo cd | && readonly sed "$1"
+	cd ${HOME} "$1" printf && local then
+	test /usr/bin readonly "$@" readonly $(pwd) printf --verbose
+awk ${HOME} 2>/dev/null sed readonly /usr/bin
+	/usr/bin "$@" --verbose "$1" x=1 | && printf readonly grep test $(pwd)
+	done x=1 "$1" --verbose sed printf $(pwd) export 2>/dev/null
+	"$1" "$1" grep done test then -eu then "$@" export export
+	then x=1 2>/dev/null then
+	-eu local "$@" ${HOME}
+		printf awk readonly | local "$@" 2>/dev/null
+sed cd echo sed 'quoted text' -eu done printf | sed x=1 /usr/bin ${HOME}
+cd "$@" sed cd done && && &&
+cd echo --verbose -eu test 2>/dev/null sed sed 2>/dev/null
+		${HOME} then echo awk printf ${HOME} done --verbose 2>/dev/null
+		"$@" echo --verbose ${HOME} done test "$1" awk "$@" $(pwd) grep grep readonly
+		done readonly "$1" 'quoted text'
+/usr/bin export && 2>/dev/null ${HOME} && /usr/bin then export -eu "$1" sed "$@"
+		/usr/bin then 'quoted text' &&
+${HOME} "$@" x=1 && sed export sed "$1" "$@" $(pwd) --verbose done 2>/dev/null
+test echo export then printf $(pwd) then "$1" done
+printf "$1" ${HOME} $(pwd) echo readonly --verbose printf $(pwd) ${HOME} done
+sed -eu "$1" then echo
+x=1 x=1 readonly && 2>/dev/null -eu | test
+$(pwd) ${HOME} local 2>/dev/null
+	&& awk sed x=1 $(pwd) | x=1 $(pwd) "$1" local | "$@" readonly 2>/dev/null | cd
+	| local awk export --verbose | /usr/bin "$@" ${HOME} test export local
+	echo /usr/bin 2>/dev/null ${HOME} export x=1 | /usr/bin
+export --verbose x=1 "$1" cd grep local --verbose
+	x=1 export "$@" $(pwd)
+		${HOME} | export "$1" then | echo -eu local grep /usr/bin 'quoted text'
+then 2>/dev/null /usr/bin test then 'quoted text' awk /usr/bin
+		"$1" && -eu then grep printf -eu && export /usr/bin export ${HOME}
+		'quoted text' test cd done
+done export "$1" /usr/bin -eu "$1" export
+then /usr/bin -eu cd ${HOME} $(pwd)
+		"$1" && test awk sed &&
+	local printf test 'quoted text' echo -eu x=1 readonly
+	"$@" ${HOME} x=1 $(pwd) printf x=1 local $(pwd) sed && echo grep
+	awk && echo -eu "$@" echo 'quoted text' cd /usr/bin
+	test /usr/bin --verbose ${HOME} "$1" 2>/dev/null local ${HOME} local
+test then cd readonly | "$1" test /usr/bin test x=1 | && ${HOME} test $(pwd) sed
+	/usr/bin --verbose x=1 export awk x=1 2>/dev/null 'quoted text'
+	--verbose readonly readonly test "$@" --verbose then then
+		done grep echo grep then printf
+	"$1" --verbose --verbose test test local grep test "$1" printf awk -eu grep
+	done x=1 echo 'quoted text' local x=1 ${HOME} && 'quoted text'
+	then local grep ${HOME} 2>/dev/null printf
+	sed $(pwd) then sed && cd done cd then readonly awk -eu printf done
+	$(pwd) -eu --verbose awk "$@" test | sed
+printf cd awk 'quoted text' echo sed && grep echo /usr/bin /usr/bin "$@" 2>/dev/null
+	"$1" /usr/bin grep ${HOME} ${HOME}
+awk export sed cd local awk echo ${HOME} readonly
+		done -eu test "$@" awk export
+	2>/dev/null "$@" done | sed x=1 cd printf --verbose | "$@" 2>/dev/null
+echo done x=1 "$@" 2>/dev/null 'quoted text' | 2>/dev/null
+awk cd 2>/dev/null done then /usr/bin done --verbose then
+&& | -eu && sed "$@" done x=1 export done grep done ${HOME} cd
+"$1" cd then $(pwd) | cd ${HOME} && readonly sed then grep
+	${HOME} 2>/dev/null 'quoted text' echo x=1 sed | $(pwd) ${HOME} cd && test grep
+grep grep done "$1" "$@"
+awk grep | /usr/bin ${HOME} -eu export "$1" done 'quoted text'
+'quoted text' grep echo echo sed sed cd echo awk 2>/dev/null && printf export
+--verbose "$1" "$@" awk local 2>/dev/null
+		readonly grep then printf && /usr/bin sed /usr/bin readonly 2>/dev/null 'quoted text'
+	then $(pwd) test readonly x=1 ${HOME}
+export done awk done awk ${HOME} local echo readonly echo
+		then local ${HOME} echo printf export -eu readonly
+		awk | printf echo then
+&& test done 2>/dev/null awk done export local 'quoted text' --verbose
+"$@" printf 'quoted text' readonly
+		2>/dev/null readonly ${HOME}
+	--verbose grep $(pwd) x=1
+		"$@" 2>/dev/null test --verbose export --verbose sed -eu grep && ${HOME}
+echo echo sed 'quoted text' export cd readonly done | "$@"
+		grep test export /usr/bin
+		$(pwd) --verbose then cd /usr/bin ${HOME} x=1
+export 2>/dev/null echo export awk echo && export echo test export 'quoted text'
+		x=1 then --verbose printf echo "$1" readonly cd cd local
+	x=1 printf echo done -eu then cd $(pwd) /usr/bin awk x=1 test
+| awk test echo 2>/dev/null
+		2>/dev/null | /usr/bin | ${HOME} sed x=1 x=1 cd then readonly /usr/bin "$1" local
+/usr/bin cd x=1 $(pwd) -eu 'quoted text' 'quoted text' export ${HOME} ${HOME}
+	test | /usr/bin -eu $(pwd)
+	/usr/bin 2>/dev/null echo local && export --verbose local ${HOME}
+	sed sed 'quoted text' "$1" local printf sed export 2>/dev/null echo
+		"$@" done awk cd export sed && test && "$@" cd echo local readonly then then
+	"$1" awk test ${HOME} ${HOME} done 2>/dev/null && x=1
+		cd local /usr/bin readonly
+	echo test test && export | grep export 2>/dev/null | "$@" /usr/bin |
+		${HOME} echo "$1" --verbose x=1
+		--verbose test /usr/bin | "$@" awk ${HOME} printf printf grep then "$@" "$@"
+local 'quoted text' 2>/dev/null echo --verbose
+--verbose /usr/bin -eu
+	--verbose "$1" grep cd awk x=1 x=1 sed --verbose | ${HOME} export 2>/dev/null
+	then sed awk grep readonly 'quoted text' |
+		echo echo readonly "$1" cd ${HOME} sed /usr/bin test sed 'quoted text'
+		local printf "$1" /usr/bin awk grep 2>/dev/null done echo awk |
+		test readonly $(pwd) local local | | "$@" /usr/bin readonly "$1" --verbose 'quoted text'
+cd && 2>/dev/null -eu readonly local /usr/bin test -eu test readonly test awk then
+	grep printf 2>/dev/null done test && readonly cd
+	--verbose -eu local local --verbose done
+--verbose done done printf local ${HOME}
+		awk -eu sed /usr/bin && --verbose ${HOME} export printf 'quoted text'
+		| then ${HOME} cd then awk awk awk x=1 2>/dev/null 'quoted text'
+	${HOME} -eu export local ${HOME} done ${HOME} 'quoted text'
+		sed done $(pwd) --verbose "$1" "$1" awk | cd local cd && readonly printf ${HOME}
+grep "$1" ${HOME} grep && ${HOME} export
+		local done test awk $(pwd) then sed done sed done
+	echo | grep | local awk export export
+	echo "$1" printf cd $(pwd) ${HOME} ${HOME} local awk grep readonly
+		'quoted text' echo x=1 | --verbose local "$@" ${HOME}
+grep local local 2>/dev/null && /usr/bin "$@"
+		/usr/bin readonly ${HOME} "$@" -eu awk local ${HOME}
+		cd done echo "$1" local $(pwd) export awk 'quoted text'
+	done sed 'quoted text' grep echo 'quoted text'
+echo cd then --verbose readonly
+/usr/bin cd cd then sed "$1" export
+&& | /usr/bin "$@" ${HOME} x=1 -eu test awk local 2>/dev/null | done
+done /usr/bin "$@" 'quoted text' x=1 echo
+		"$1" && 'quoted text' -eu 2>/dev/null "$1" $(pwd) -eu 'quoted text' --verbose
+"$@" && readonly printf --verbose x=1 ${HOME} cd 2>/dev/null x=1
+grep /usr/bin sed awk then test printf local
+readonly test /usr/bin "$1" | --verbose
+	$(pwd) "$@" && then 'quoted text' cd 2>/dev/null sed $(pwd) &&
+${HOME} && sed 2>/dev/null awk local
+	/usr/bin grep -eu && local -eu local 'quoted text'
+export grep then export
+sed && cd done cd awk sed --verbose printf && "$@" test export then
+		echo 'quoted text' && readonly | then x=1 export then
+		local printf && readonly printf $(pwd) x=1 "$@" grep -eu
+"$1" grep && local printf
+x=1 /usr/bin "$1" export grep done printf $(pwd) $(pwd)
+export awk done | -eu export 2>/dev/null printf "$1" cd awk 'quoted text'
+	echo x=1 grep "$1" done cd export "$1" sed
+	done export done grep $(pwd) awk awk x=1 local export
+done awk 2>/dev/null --verbose then $(pwd) done -eu then $(pwd) && x=1 | sed
+		awk x=1 echo local cd test done
+then local ${HOME} then --verbose readonly grep $(pwd) grep export && test echo
+${HOME} test "$1" && awk ${HOME}
+		&& $(pwd) "$1" --verbose cd --verbose readonly ${HOME} done awk -eu | -eu readonly
+echo ${HOME} readonly 2>/dev/null /usr/bin then "$@" done cd /usr/bin sed 2>/dev/null
+	printf $(pwd) --verbose | | export /usr/bin --verbose && $(pwd) printf /usr/bin
+		then 'quoted text' --verbose
+		2>/dev/null echo $(pwd) echo --verbose readonly
+-eu echo grep /usr/bin export ${HOME} cd "$@" printf done echo "$1"
+		sed cd 2>/dev/null done readonly export cd x=1 sed ${HOME} 2>/dev/null
+export grep | --verbose then awk local ${HOME} --verbose local
+$(pwd) 'quoted text' done && --verbose test --verbose $(pwd) awk /usr/bin
@@ -0,0 +1,2001 @@
+done --verbose then 'quoted text' cd done sed "$1" /usr/bin grep && cd
+	echo sed readonly 2>/dev/null | --verbose
+	x=1 --verbose --verbose
+	| /usr/bin && 'quoted text' 'quoted text' export
+		cd /usr/bin export x=1 printf x=1
+test "$1" echo && cd awk test
+		'quoted text' 2>/dev/null 2>/dev/null ${HOME} --verbose test ${HOME} -eu
+	cd ${HOME} printf export
+		${HOME} -eu | && 2>/dev/null done /usr/bin cd | ${HOME} | cd grep export sed sed
+		done -eu local --verbose then done
+		grep sed local $(pwd) echo 2>/dev/null --verbose
+2>/dev/null local | | "$1" /usr/bin cd "$@" readonly
+		done readonly printf ${HOME} cd local local && "$@" then printf then
+		test test export "$1" cd awk readonly export done x=1 cd echo 'quoted text' 'quoted text'
+		awk && echo then awk 'quoted text'
+		done cd local 'quoted text' ${HOME}
+	export x=1 | local "$@" $(pwd) done -eu sed | /usr/bin then awk
+		${HOME} -eu $(pwd) cd | test $(pwd) | sed | "$1" readonly awk
+	/usr/bin $(pwd) 'quoted text' cd test x=1 awk readonly --verbose
+sed ${HOME} $(pwd) --verbose /usr/bin
+	then $(pwd) 'quoted text' $(pwd) && test export export then 'quoted text' test 2>/dev/null
+		then export 'quoted text' $(pwd) cd sed 2>/dev/null
+		2>/dev/null -eu --verbose
+		2>/dev/null /usr/bin export 'quoted text' "$1" --verbose | then "$1" -eu "$@"
+	test then printf readonly $(pwd) 'quoted text' readonly export --verbose 2>/dev/null
+readonly 2>/dev/null printf "$1" grep --verbose -eu test && /usr/bin grep ${HOME}
+| echo --verbose awk "$@" --verbose awk x=1 -eu
+${HOME} local awk -eu ${HOME} |
+2>/dev/null "$@" sed --verbose
+		cd "$@" cd then awk grep $(pwd)
+	2>/dev/null grep ${HOME} cd sed local then then "$1" 'quoted text' test
+	&& test "$1" ${HOME} grep "$1" /usr/bin sed --verbose awk printf cd ${HOME}
+		echo printf cd | readonly
+		cd printf "$1" test x=1 awk then
+	x=1 2>/dev/null "$1"
+x=1 "$1" readonly awk sed "$@" | 'quoted text' export ${HOME}
+	test then export readonly "$1" grep 'quoted text' && && 2>/dev/null
+	$(pwd) readonly sed sed
+done test then grep 'quoted text'
+	awk | printf -eu printf echo -eu grep && |
+&& done echo --verbose $(pwd) echo then 'quoted text' done sed 2>/dev/null
+		| "$1" $(pwd) export test then then ${HOME} echo x=1 grep done && 2>/dev/null
+		local echo x=1 /usr/bin ${HOME} sed echo "$1" ${HOME}
+		/usr/bin readonly readonly "$@" "$@" test echo
+		then cd local then test local "$@"
+	echo local x=1 && && x=1
+		readonly "$@" grep test --verbose readonly ${HOME} --verbose
+--verbose export --verbose -eu cd done && $(pwd) -eu grep export sed
+	x=1 -eu then $(pwd) "$@" 2>/dev/null
+		"$1" done $(pwd) && cd ${HOME} test grep $(pwd) test printf | x=1 x=1 then readonly
+	export 'quoted text' "$1" && printf local "$1"
+		--verbose x=1 $(pwd)
+sed test --verbose x=1 test export grep "$1" test "$1" sed export && export
+$(pwd) | --verbose /usr/bin done 2>/dev/null && then $(pwd)
+		awk grep $(pwd) readonly --verbose
+		done readonly | | done printf -eu grep -eu /usr/bin
+		2>/dev/null "$1" 2>/dev/null 2>/dev/null
+		x=1 test done $(pwd) --verbose --verbose
+x=1 readonly done | && 2>/dev/null "$1" --verbose 2>/dev/null
+"$@" done "$1" local ${HOME} $(pwd)
+	test $(pwd) "$@" && awk then local readonly /usr/bin --verbose /usr/bin | awk export
+		/usr/bin "$@" done echo local cd ${HOME} printf ${HOME} test /usr/bin
+-eu 'quoted text' awk /usr/bin
+		printf sed -eu readonly sed printf --verbose
+		"$1" awk local echo grep 2>/dev/null
+| readonly && printf ${HOME} then "$1" done
+		2>/dev/null ${HOME} then 'quoted text' done test 'quoted text' local ${HOME}
+grep 2>/dev/null done | printf | | x=1 printf export 'quoted text'
+		$(pwd) readonly && printf awk
+	&& -eu 'quoted text' x=1 ${HOME} $(pwd) && grep grep readonly
+	done ${HOME} "$1" 2>/dev/null ${HOME}
+		printf export | echo cd --verbose test | ${HOME} cd $(pwd)
+		--verbose echo done && then "$@" then cd 'quoted text' /usr/bin
+		sed 2>/dev/null ${HOME} sed printf export 2>/dev/null
+printf awk readonly sed awk cd "$@" sed -eu 'quoted text' "$1" x=1
+	x=1 sed 2>/dev/null local /usr/bin /usr/bin export
+	test echo $(pwd) && export -eu
+		test test 2>/dev/null 'quoted text' && -eu /usr/bin local 2>/dev/null done echo
+	"$1" sed done local 2>/dev/null
+2>/dev/null ${HOME} 'quoted text' done
+then export sed local grep 'quoted text' $(pwd) 2>/dev/null cd echo -eu
+&& x=1 2>/dev/null test "$1" grep
+		sed sed ${HOME} printf $(pwd) echo && printf
+		${HOME} -eu x=1 printf /usr/bin export awk /usr/bin $(pwd) "$@" local /usr/bin
+	| ${HOME} /usr/bin && sed /usr/bin done sed
+		then echo sed ${HOME} printf local readonly
+		then done /usr/bin /usr/bin done done done $(pwd) x=1 | grep
+		export 'quoted text' && sed $(pwd) echo -eu test export cd "$@" --verbose
+	$(pwd) test x=1 local then -eu $(pwd)
+awk grep export /usr/bin done grep ${HOME} printf cd cd "$@" $(pwd) sed awk awk
+done ${HOME} | && echo 2>/dev/null x=1 done "$@" $(pwd) cd awk export local printf
+	then 'quoted text' x=1 ${HOME} | -eu 2>/dev/null 2>/dev/null echo sed
+readonly local sed local ${HOME} /usr/bin 2>/dev/null "$1" -eu
+2>/dev/null cd "$1" readonly
+		"$1" | echo "$1" export readonly echo $(pwd) /usr/bin readonly "$1"
+	cd $(pwd) x=1 printf "$1" --verbose done /usr/bin x=1 ${HOME}
+	awk $(pwd) awk echo echo 'quoted text' done sed
+'quoted text' awk readonly | awk echo printf ${HOME}
+		test then ${HOME} /usr/bin $(pwd) x=1 --verbose
+		local --verbose echo readonly printf | ${HOME} sed /usr/bin ${HOME} echo printf
+		"$@" && echo /usr/bin 'quoted text' grep && "$@"
+-eu local cd cd /usr/bin done test x=1 && --verbose 2>/dev/null /usr/bin 2>/dev/null
+		grep /usr/bin 'quoted text' "$1" /usr/bin local && grep cd export 'quoted text'
+		cd then export 'quoted text' ${HOME}
+	| "$1" "$1" -eu ${HOME} then export awk "$@" | && echo /usr/bin 2>/dev/null printf
+	sed readonly x=1 $(pwd) "$@" sed x=1 $(pwd) --verbose awk done grep "$@" awk | local
+"$@" awk 2>/dev/null | x=1 test ${HOME} done -eu echo grep
+	sed then awk printf 'quoted text' local local x=1 local -eu export cd cd
+		/usr/bin done cd x=1 test readonly then
+	readonly readonly 'quoted text' test | | | sed "$@"
+printf 'quoted text' then printf "$@" --verbose x=1 $(pwd) awk /usr/bin
+	export readonly printf | test && sed then 2>/dev/null "$@" "$@"
+		sed printf x=1 cd --verbose 2>/dev/null then then then && grep
+done awk awk then done export /usr/bin ${HOME} 2>/dev/null
+		-eu grep sed x=1 /usr/bin sed local 'quoted text' grep echo then grep 2>/dev/null
+'quoted text' printf printf local test && "$@" readonly
+&& then echo echo cd grep readonly /usr/bin readonly ${HOME} /usr/bin sed cd grep
+sed ${HOME} done done 2>/dev/null x=1 ${HOME} "$1" grep cd /usr/bin -eu then
+	x=1 /usr/bin 'quoted text' "$1" 'quoted text' cd awk 'quoted text'
+	'quoted text' cd then 'quoted text'
+		x=1 $(pwd) $(pwd) $(pwd) awk cd $(pwd) -eu cd | $(pwd) export /usr/bin
+		readonly "$@" sed /usr/bin | 'quoted text'
+		sed ${HOME} && -eu ${HOME} x=1 ${HOME} --verbose test 2>/dev/null 2>/dev/null
+local then awk x=1 x=1 test "$@" sed awk x=1 /usr/bin test export x=1 echo /usr/bin
+awk test grep printf test awk | 2>/dev/null cd --verbose cd cd
+	"$1" cd sed /usr/bin $(pwd)
+awk export $(pwd) then 'quoted text' readonly -eu 2>/dev/null x=1 done grep
+	then 'quoted text' then "$1" ${HOME} then
+		export "$@" awk "$@" awk readonly done echo "$@" awk done echo
+$(pwd) $(pwd) x=1 "$@" --verbose "$@"
+	printf 'quoted text' printf && cd "$@" local --verbose 'quoted text'
+		$(pwd) echo --verbose grep then echo export export grep 'quoted text' x=1
+/usr/bin "$1" | readonly local 'quoted text'
+		| x=1 awk export echo 'quoted text' x=1 test local
+	/usr/bin local 'quoted text' && done x=1 echo grep echo -eu
+		2>/dev/null ${HOME} then readonly
+		${HOME} test done /usr/bin "$1"
+$(pwd) --verbose x=1 --verbose
+		${HOME} printf sed readonly -eu readonly $(pwd) awk 'quoted text'
+		local -eu test 'quoted text' $(pwd) | printf ${HOME} sed
+local && | -eu cd cd then export /usr/bin echo local ${HOME} $(pwd) 'quoted text'
+		sed done 'quoted text' export
+local export local "$1" local "$@" x=1 "$1" x=1 /usr/bin 2>/dev/null
+		test local then /usr/bin awk 2>/dev/null ${HOME} x=1 $(pwd) sed -eu
+	&& 'quoted text' awk -eu "$@" 'quoted text' sed test x=1 "$1" local
+then "$@" test grep local --verbose && done ${HOME} && then $(pwd)
+2>/dev/null -eu | sed done -eu awk readonly done
+done awk "$1" && 'quoted text' test
+	grep 2>/dev/null printf "$@" /usr/bin "$1" 'quoted text' sed test
+		export x=1 readonly 2>/dev/null /usr/bin ${HOME} export sed 2>/dev/null
+-eu echo --verbose /usr/bin export | then cd | then
+"$1" 'quoted text' local cd x=1 /usr/bin "$@" "$1" x=1 then -eu 'quoted text'
+export -eu local $(pwd) sed then test "$@" cd 2>/dev/null 2>/dev/null | cd echo
+printf $(pwd) export export /usr/bin local done export /usr/bin
+		--verbose $(pwd) 'quoted text'
+	'quoted text' 'quoted text' readonly x=1 grep printf -eu "$1" printf $(pwd)
+		&& $(pwd) -eu --verbose | ${HOME} 2>/dev/null "$1" local
+		$(pwd) grep && echo local test | echo 'quoted text' readonly awk | -eu "$@"
+		echo grep -eu local 2>/dev/null awk "$@"
+export /usr/bin -eu && $(pwd) readonly 2>/dev/null test
+		2>/dev/null | printf sed ${HOME} sed awk local
+readonly test 'quoted text'
+		then grep done x=1 local -eu "$@" && done x=1 "$@" sed export readonly x=1
+		&& readonly echo cd 'quoted text' local
+		readonly "$@" "$@" export printf grep "$@"
+export "$1" /usr/bin "$@" sed && printf | grep printf ${HOME}
+export local x=1 --verbose sed sed &&
+	then then awk "$1" echo $(pwd) local
+		/usr/bin --verbose test /usr/bin
+${HOME} $(pwd) /usr/bin readonly "$@" grep x=1 2>/dev/null then --verbose grep
+	&& 'quoted text' $(pwd) && | 2>/dev/null 2>/dev/null printf
+		-eu "$@" "$1" done --verbose /usr/bin
+	awk awk printf -eu local sed && "$@" 2>/dev/null 2>/dev/null
+test | ${HOME} done cd sed cd local
+	printf printf && | 2>/dev/null readonly local 'quoted text' "$1"
+	"$1" printf sed x=1 ${HOME} local 2>/dev/null ${HOME}
+		x=1 2>/dev/null 2>/dev/null test && local x=1 && "$1"
+		printf $(pwd) | && test
+local $(pwd) 'quoted text' "$@" grep
+awk sed export 'quoted text' readonly 'quoted text' /usr/bin readonly cd sed
+		/usr/bin x=1 then printf
+		awk local "$@" "$1" echo cd grep printf /usr/bin sed /usr/bin -eu done
+		sed grep grep echo x=1 "$@" $(pwd) ${HOME} 2>/dev/null &&
+		export "$1" $(pwd) test
+-eu awk x=1 "$@" sed done 2>/dev/null cd --verbose cd sed awk ${HOME}
+	awk && -eu $(pwd) echo export ${HOME}
+	| "$1" "$1" then "$@" $(pwd) local local printf && 'quoted text' printf --verbose
+export 'quoted text' printf readonly
+cd done ${HOME} && local then ${HOME} then ${HOME} readonly "$@"
+	2>/dev/null sed cd then then "$1" ${HOME} cd $(pwd)
+grep && /usr/bin printf x=1 awk sed ${HOME} readonly done local --verbose
+/usr/bin export then readonly export /usr/bin $(pwd) ${HOME} 2>/dev/null /usr/bin
+	echo x=1 /usr/bin 'quoted text' | grep readonly local
+"$1" ${HOME} 2>/dev/null export printf awk 'quoted text' /usr/bin
+readonly local sed grep readonly done
+test echo --verbose 2>/dev/null
+		| cd echo grep "$1" sed export --verbose -eu -eu "$@"
+	x=1 local then grep "$@"
+sed local cd x=1 export ${HOME} then $(pwd) readonly "$@"
+	${HOME} --verbose cd then grep "$@" awk echo | ${HOME} --verbose
+grep done cd "$1" "$@" --verbose echo readonly local done
+then ${HOME} cd sed "$@" readonly 2>/dev/null x=1
+	&& export export /usr/bin sed readonly && /usr/bin "$1"
+	&& "$@" export echo 'quoted text' -eu
+		test local done --verbose printf 2>/dev/null && --verbose test
+	x=1 cd test --verbose 2>/dev/null export 2>/dev/null echo export 'quoted text'
+	done readonly readonly | && awk --verbose /usr/bin && local
+		-eu 2>/dev/null | test "$1" cd /usr/bin 'quoted text' printf x=1 x=1
+		local cd export test -eu
+	readonly awk -eu echo grep -eu sed
+	-eu done grep done sed readonly
+		done test then local sed
+&& readonly echo 2>/dev/null echo ${HOME}
+		x=1 | done grep readonly /usr/bin --verbose test 2>/dev/null
+test "$@" "$@" "$1" | grep "$1" readonly echo export
+then local cd cd awk readonly local echo x=1
+readonly 'quoted text' readonly --verbose awk awk awk "$@"
+then x=1 /usr/bin awk grep cd "$@" sed done -eu cd -eu test --verbose
+	printf then done export awk export printf readonly
+	cd export local cd --verbose printf awk
+	export ${HOME} -eu test done done export | 2>/dev/null echo done local test
+	&& export /usr/bin local local -eu 'quoted text'
+	printf 2>/dev/null printf 2>/dev/null | printf
+cd echo test awk 2>/dev/null test then
+	readonly printf cd readonly echo "$@" readonly $(pwd) "$1" /usr/bin
+	cd export awk "$1" echo --verbose test
+cd sed export ${HOME} export test --verbose local
+export readonly -eu x=1 test 2>/dev/null x=1 local 2>/dev/null then
+readonly $(pwd) grep ${HOME} 2>/dev/null awk "$@"
+awk 2>/dev/null sed 2>/dev/null "$1" printf local printf x=1 --verbose cd
+then ${HOME} printf local printf awk grep then export
+-eu x=1 --verbose 2>/dev/null | -eu test "$1" local export
+"$1" done -eu && done "$@" $(pwd) -eu printf 'quoted text' test $(pwd) echo
+$(pwd) test --verbose $(pwd) /usr/bin --verbose sed readonly test
+	awk /usr/bin sed x=1 --verbose ${HOME} ${HOME}
+	/usr/bin && 2>/dev/null x=1
+	2>/dev/null --verbose sed 2>/dev/null ${HOME} sed
+	$(pwd) readonly local local grep test
+		"$1" | -eu ${HOME} sed -eu
+		$(pwd) $(pwd) $(pwd) 'quoted text' && awk --verbose /usr/bin sed
+test grep test then | done grep awk done $(pwd)
+	-eu ${HOME} then local awk export
+echo done done awk cd sed done /usr/bin
+		test "$@" "$@" -eu sed | "$@" test
+	'quoted text' $(pwd) done then done ${HOME} "$@"
+	-eu grep x=1 done local
+	awk cd x=1 | x=1 test /usr/bin x=1 grep grep export test echo awk ${HOME} "$1"
+		test | $(pwd) /usr/bin $(pwd) -eu "$1"
+'quoted text' -eu awk then "$@" grep x=1 echo grep 2>/dev/null --verbose
+| -eu | awk ${HOME} "$1" ${HOME} sed $(pwd) readonly 'quoted text'
+	$(pwd) -eu readonly "$@" 2>/dev/null export echo readonly 2>/dev/null
+then /usr/bin sed sed awk export readonly ${HOME} --verbose $(pwd)
+		test grep x=1 export | export
+		test sed echo "$@" 2>/dev/null
+echo 'quoted text' 'quoted text' test printf sed awk 2>/dev/null
+		grep 2>/dev/null echo $(pwd) x=1 printf "$1" /usr/bin readonly
+test && | readonly readonly sed local 2>/dev/null
+		readonly readonly done
+	2>/dev/null | 'quoted text'
+		&& export done "$1" -eu local then awk readonly -eu && --verbose
+&& cd done test | awk sed done printf sed cd && sed then readonly 2>/dev/null
+		printf && 'quoted text' echo -eu local 'quoted text'
+	2>/dev/null then | x=1 --verbose awk /usr/bin 'quoted text' /usr/bin ${HOME}
+&& local && 'quoted text' $(pwd) done done --verbose
+	local done test printf --verbose printf sed readonly /usr/bin
+		"$@" x=1 echo 2>/dev/null ${HOME}
+	'quoted text' x=1 /usr/bin $(pwd) $(pwd) -eu printf printf 'quoted text'
+2>/dev/null export cd grep printf $(pwd) x=1 -eu ${HOME} x=1 x=1 then
+	local x=1 /usr/bin echo
+	"$@" done readonly echo readonly ${HOME} grep /usr/bin
+'quoted text' --verbose | --verbose grep then readonly
+'quoted text' done done echo echo | && grep then && "$1" printf x=1 -eu grep
+	local then export readonly -eu local "$@" ${HOME} | grep then printf && "$1" grep
+		local -eu --verbose -eu --verbose x=1 awk x=1 /usr/bin
+	-eu x=1 readonly x=1 | -eu && ${HOME} -eu awk /usr/bin /usr/bin
+	printf sed -eu "$@" 2>/dev/null done "$1" echo --verbose
+	test --verbose | local
+	'quoted text' cd grep 'quoted text' printf $(pwd)
+	export done ${HOME} /usr/bin awk awk /usr/bin ${HOME}
+	echo "$@" grep readonly
+		$(pwd) then grep test /usr/bin /usr/bin local cd /usr/bin $(pwd) sed ${HOME}
+	'quoted text' awk && /usr/bin --verbose echo echo test x=1 "$1" --verbose
+		done echo local done x=1 local done /usr/bin
+	2>/dev/null | local ${HOME} echo printf --verbose ${HOME}
+		$(pwd) sed $(pwd) sed ${HOME}
+	--verbose readonly /usr/bin sed readonly $(pwd)
+	${HOME} done /usr/bin export then /usr/bin "$@"
+		test "$1" $(pwd) --verbose -eu readonly done then grep cd && -eu local /usr/bin
+	"$@" readonly test -eu && cd -eu $(pwd) done grep $(pwd) local readonly done ${HOME}
+	cd printf printf 2>/dev/null x=1 "$@" then 'quoted text'
+	$(pwd) test ${HOME} then 'quoted text' $(pwd) | done
+		readonly done 2>/dev/null /usr/bin test ${HOME}
+		"$1" cd 'quoted text' awk | ${HOME}
+--verbose --verbose --verbose "$@" && && cd "$1"
+| -eu /usr/bin "$1" | sed done export then $(pwd) 2>/dev/null
+	cd done printf /usr/bin sed sed then sed | | 'quoted text' 'quoted text' test
+		sed /usr/bin /usr/bin done 2>/dev/null 'quoted text' local
+x=1 cd echo cd echo "$1" readonly $(pwd) | "$1"
+then grep sed | echo 'quoted text'
+		awk awk grep readonly grep 2>/dev/null
+		"$@" -eu sed && x=1 cd sed --verbose grep cd --verbose then $(pwd) | cd x=1 "$1"
+&& readonly --verbose $(pwd) sed readonly
+	--verbose readonly "$1" readonly
+"$1" 'quoted text' && cd sed $(pwd) "$1" /usr/bin --verbose | ${HOME}
+2>/dev/null readonly /usr/bin export done /usr/bin
+		2>/dev/null | ${HOME} grep $(pwd) -eu "$1"
+	| $(pwd) export then x=1 | /usr/bin
+	-eu x=1 then then then "$1" echo "$@" export
+awk 'quoted text' | x=1 x=1 "$@"
+local export local 2>/dev/null 'quoted text'
+	sed test -eu $(pwd) 'quoted text' "$1" grep "$@" export echo grep "$1" --verbose
+		$(pwd) test printf then awk
+/usr/bin 'quoted text' x=1 'quoted text'
+	readonly cd grep grep sed x=1 | done sed /usr/bin grep
+-eu grep awk sed $(pwd) sed then cd done
+$(pwd) $(pwd) "$1" /usr/bin sed then /usr/bin --verbose
+	"$1" readonly && | awk x=1 2>/dev/null /usr/bin
+"$1" 2>/dev/null then
+"$@" -eu then $(pwd) -eu && awk $(pwd)
+$(pwd) -eu 'quoted text' x=1 /usr/bin echo then done local
+2>/dev/null sed echo local echo $(pwd) | then echo 'quoted text'
+cd printf --verbose done
+	local /usr/bin --verbose echo --verbose
+		sed /usr/bin sed awk printf export 'quoted text' ${HOME} --verbose
+		done 2>/dev/null readonly readonly |
+	readonly done "$1" sed "$@" local ${HOME} ${HOME} local
+		&& -eu export sed "$@" test then /usr/bin awk 2>/dev/null --verbose && /usr/bin
+| sed then then done 2>/dev/null 'quoted text' | 2>/dev/null && awk "$1"
+	awk local /usr/bin "$1" printf | "$@" cd
+test /usr/bin printf ${HOME} readonly export local printf /usr/bin export ${HOME}
+		printf test done && printf
+	'quoted text' awk sed "$@" --verbose local "$@" |
+export grep 2>/dev/null | awk export sed sed grep 2>/dev/null
+		grep readonly "$@" done | awk test ${HOME} --verbose /usr/bin then 'quoted text'
+	| -eu echo x=1 2>/dev/null "$1"
+echo export local ${HOME} then grep then printf | done "$1" 'quoted text'
+	done x=1 && --verbose && x=1 /usr/bin readonly "$@"
+	readonly "$@" cd grep $(pwd)
+		"$@" sed && "$1" "$1" cd cd awk
+local $(pwd) cd | sed done -eu sed cd "$1"
+		2>/dev/null done done |
+	$(pwd) export local "$1" $(pwd) grep 'quoted text' sed x=1 echo x=1 sed --verbose
+sed ${HOME} 2>/dev/null "$1" readonly printf ${HOME}
+		/usr/bin grep $(pwd) 2>/dev/null --verbose done awk export && export
+test echo export grep "$@" "$@" 2>/dev/null printf 'quoted text' done
+		export --verbose x=1 x=1 --verbose "$@" readonly
+"$@" echo "$@" printf && 'quoted text' then grep "$@" printf cd export
+	then "$@" ${HOME} readonly "$1" done | | -eu
+	--verbose printf "$@"
+"$1" awk && -eu local export ${HOME} local && grep
+export "$1" done x=1 export local /usr/bin then grep awk echo grep
+	done $(pwd) local echo awk ${HOME} sed local
+		x=1 --verbose readonly ${HOME} grep printf cd grep ${HOME} /usr/bin
+awk | then export done cd "$@" | printf --verbose -eu awk "$@" export /usr/bin
+"$@" "$@" cd $(pwd) local
+	sed printf x=1 echo echo printf grep then --verbose readonly done
+	"$1" sed | readonly 2>/dev/null echo /usr/bin
+test --verbose readonly 'quoted text' then x=1 sed test --verbose
+	"$1" test export echo local sed
+		${HOME} $(pwd) "$1" export test export
+		sed echo 'quoted text' --verbose
+	${HOME} sed --verbose "$@" done ${HOME} $(pwd) then --verbose ${HOME}
+	| ${HOME} "$1" grep 2>/dev/null echo
+&& "$@" && then 'quoted text' "$1" sed then 'quoted text' -eu
+"$@" grep -eu done done readonly && local "$1" "$1" "$1" grep 2>/dev/null --verbose
+	'quoted text' export -eu && cd then --verbose -eu ${HOME} && "$@" readonly
+	echo /usr/bin awk ${HOME} readonly local 2>/dev/null cd 'quoted text' cd "$@" echo
+		'quoted text' x=1 "$@" done 2>/dev/null ${HOME}
+'quoted text' printf -eu "$@" x=1 cd ${HOME} x=1 local && -eu export "$1"
+		-eu then -eu 'quoted text' --verbose
+		$(pwd) $(pwd) /usr/bin sed 'quoted text'
+		grep ${HOME} -eu local cd $(pwd) export | export |
+		$(pwd) 'quoted text' "$@" ${HOME} x=1
+	$(pwd) local export && "$@" 'quoted text' echo /usr/bin "$1" "$@" grep
+	then -eu "$1" --verbose --verbose readonly
+	sed --verbose cd grep test awk export
+		'quoted text' local && test /usr/bin done ${HOME} sed -eu echo export
+printf awk echo awk printf then test done 'quoted text' --verbose sed done $(pwd)
+	&& x=1 echo "$@" && x=1 && echo printf /usr/bin printf local export
+-eu test done readonly then echo test test
+	grep readonly | cd test -eu export /usr/bin echo
+&& $(pwd) && sed 'quoted text' done x=1 sed ${HOME} awk -eu ${HOME}
+	-eu 'quoted text' --verbose local "$1" done cd --verbose "$@" && 'quoted text'
+	-eu done /usr/bin "$@" "$1"
+2>/dev/null export x=1 2>/dev/null
+	awk test cd printf test
+	grep printf 2>/dev/null 2>/dev/null | export x=1 grep
+	"$@" then cd cd printf x=1 /usr/bin $(pwd) --verbose export ${HOME}
+	readonly $(pwd) x=1 ${HOME} test readonly "$@" -eu local done "$@" done done done
+readonly then test printf 2>/dev/null test --verbose
+| ${HOME} then $(pwd) "$1" then | awk
+	'quoted text' readonly --verbose done awk echo 'quoted text'
+grep /usr/bin echo cd echo
+readonly export --verbose printf && readonly export -eu cd x=1 ${HOME} ${HOME}
+		'quoted text' ${HOME} ${HOME} printf --verbose --verbose
+		printf 'quoted text' 2>/dev/null test then test --verbose done done
+$(pwd) local "$1" test grep echo cd
+-eu && awk --verbose 2>/dev/null test 'quoted text' && "$@" test /usr/bin awk
+'quoted text' x=1 then
+test x=1 local 'quoted text' 2>/dev/null 'quoted text' "$@" printf grep sed --verbose
+	test done grep x=1 printf 'quoted text'
+	--verbose cd export done | grep -eu 2>/dev/null readonly | 2>/dev/null
+	printf | "$1" x=1 && awk sed readonly "$1" "$1" test -eu readonly echo grep
+		${HOME} ${HOME} printf | done x=1 /usr/bin 2>/dev/null | test ${HOME}
+		export echo ${HOME} printf 2>/dev/null local /usr/bin /usr/bin |
+"$@" "$@" export awk then sed cd x=1 x=1 printf readonly | | $(pwd) -eu sed
+	2>/dev/null grep awk -eu x=1 'quoted text'
+	local sed then -eu $(pwd) /usr/bin | export readonly "$1"
+		readonly local grep x=1 --verbose | export local cd "$@" 'quoted text'
+		--verbose -eu "$@" echo then awk sed then export "$1" printf
+	$(pwd) export 'quoted text' /usr/bin -eu readonly --verbose -eu --verbose
+	cd "$@" readonly grep sed $(pwd) 'quoted text' "$@" "$1" then
+		grep /usr/bin then local 2>/dev/null then ${HOME} test 2>/dev/null
+	then readonly done sed 'quoted text' /usr/bin
+cd --verbose awk local then /usr/bin x=1 "$1" /usr/bin
+	done printf then done sed export awk
+/usr/bin "$1" then ${HOME} export then sed cd echo && printf
+$(pwd) echo 'quoted text' x=1 echo grep export printf --verbose awk x=1
+local then "$1" awk --verbose && cd
+	-eu -eu done /usr/bin grep sed test grep $(pwd)
+sed test "$1" printf test then test "$@"
+	local && local "$1" echo
+		export echo 2>/dev/null 2>/dev/null /usr/bin $(pwd)
+		awk "$1" cd grep printf | | then cd --verbose done
+echo 'quoted text' grep done printf | 2>/dev/null
+		echo printf "$@" --verbose echo awk /usr/bin
+		echo | /usr/bin 2>/dev/null sed test readonly && local -eu --verbose
+	sed -eu /usr/bin done
+	-eu | 2>/dev/null 'quoted text' done cd 'quoted text' cd test --verbose grep
+		| awk echo x=1 echo awk sed | sed 'quoted text' echo readonly
+done readonly /usr/bin $(pwd) sed cd --verbose
+	then | awk printf test | then done cd then
+cd 2>/dev/null awk local done 'quoted text' "$@" 'quoted text' 2>/dev/null
+		-eu sed "$@" && grep --verbose readonly x=1 x=1 "$1" test /usr/bin
+	test --verbose printf export 2>/dev/null "$1" readonly
+		cd sed | x=1 ${HOME} $(pwd) 'quoted text' done done cd awk sed $(pwd) cd --verbose
+	"$1" readonly 'quoted text' cd /usr/bin
+		test "$1" x=1 /usr/bin grep printf "$@" --verbose then grep
+	awk cd test --verbose sed grep echo printf "$1" "$@" awk $(pwd) echo then
+		-eu "$@" ${HOME} "$1" x=1 "$1"
+printf echo awk 'quoted text' $(pwd) "$1" echo "$1"
+		-eu grep | test && x=1 "$1" | $(pwd) awk --verbose
+sed printf done then x=1 then sed $(pwd) && awk cd grep 2>/dev/null readonly
+		local && --verbose 'quoted text' awk readonly test "$@" | awk local
+		readonly "$@" readonly -eu grep sed ${HOME} --verbose | test "$@" 2>/dev/null
+		grep printf readonly x=1 x=1 printf "$1" 2>/dev/null "$@" done
+test -eu | x=1 --verbose awk then 2>/dev/null
+then "$@" | -eu 'quoted text'
+		export && 2>/dev/null done sed
+	sed && "$1" --verbose grep x=1
+printf ${HOME} | awk -eu then
+	x=1 | /usr/bin "$@" readonly grep done
+-eu $(pwd) done printf "$@" /usr/bin ${HOME}
+readonly cd "$@" cd done export done "$1" cd 2>/dev/null local printf local
+	local cd readonly x=1 && | grep && | cd readonly
+		'quoted text' "$@" test /usr/bin then awk test "$1" x=1 -eu readonly cd cd
+	2>/dev/null grep | x=1 | "$1" readonly test
+	x=1 'quoted text' &&
+	"$@" readonly echo --verbose
+"$@" local local local awk -eu done export
+awk && "$@" grep $(pwd) $(pwd) | "$1" grep done
+2>/dev/null sed printf --verbose readonly awk -eu "$@" --verbose 2>/dev/null
+	2>/dev/null grep x=1 ${HOME} -eu --verbose | printf
+		readonly export awk grep then -eu -eu 2>/dev/null
+	$(pwd) awk then local cd "$1"
+"$1" -eu | cd echo echo
+	sed $(pwd) local then export then sed done "$1" 'quoted text' -eu done 2>/dev/null
+grep -eu readonly "$@" 2>/dev/null -eu awk && cd local printf
+		readonly readonly local 'quoted text'
+	/usr/bin done done --verbose 'quoted text'
+	then test 'quoted text' printf local local printf /usr/bin
+		--verbose awk "$@" ${HOME} cd done echo 2>/dev/null &&
+local then && readonly --verbose cd sed && readonly && | "$@" local && --verbose
+done awk then test x=1 sed echo readonly x=1 grep sed readonly
+${HOME} test 2>/dev/null local x=1 "$@" | "$1" grep &&
+		"$@" 'quoted text' done $(pwd)
+| export "$1" && -eu --verbose "$@" sed sed "$@" sed
+	export grep export && done local local sed readonly printf sed "$@" "$@" --verbose
+	echo x=1 -eu $(pwd) x=1 x=1 then 'quoted text' local | 2>/dev/null
+then readonly export --verbose ${HOME} sed
+		awk printf local "$1" printf grep
+	| sed && --verbose local readonly && sed cd local readonly then 2>/dev/null
+"$@" test printf grep local export awk 'quoted text'
+	| done test done sed ${HOME} x=1 "$@" ${HOME} sed sed grep done
+		cd "$@" done done export ${HOME} 'quoted text'
+		-eu awk "$1" $(pwd) test 2>/dev/null --verbose --verbose sed -eu export
+done -eu "$1" -eu && $(pwd) local /usr/bin $(pwd) grep done cd 2>/dev/null echo
+		"$@" export then -eu -eu local 'quoted text' $(pwd) ${HOME} "$@" local 'quoted text'
+	2>/dev/null "$1" then readonly $(pwd) ${HOME} cd ${HOME} ${HOME} done then
+	"$@" | ${HOME} 2>/dev/null cd /usr/bin
+export export cd printf
+'quoted text' && -eu 2>/dev/null
+	readonly "$@" -eu local echo "$@"
+		grep $(pwd) sed -eu export | then test -eu
+	&& && && printf printf 'quoted text'
+awk awk then /usr/bin local 2>/dev/null then then && x=1 printf awk echo
+	then $(pwd) export printf awk echo 'quoted text'
+/usr/bin grep "$@" cd $(pwd) x=1 && --verbose && x=1
+	${HOME} cd echo --verbose | "$@" done "$@" then done cd cd done
+		x=1 -eu --verbose ${HOME} $(pwd) export cd -eu -eu export "$1" done
+		done done /usr/bin x=1 local export
+		2>/dev/null --verbose -eu then sed $(pwd) | "$1" | /usr/bin --verbose "$@" --verbose
+		'quoted text' export then printf /usr/bin cd 'quoted text' "$1"
+		printf x=1 2>/dev/null $(pwd) 'quoted text' --verbose sed awk awk
+-eu /usr/bin $(pwd) | 2>/dev/null -eu "$1"
+test ${HOME} ${HOME} cd test --verbose sed awk -eu x=1 |
+	echo export 2>/dev/null 2>/dev/null printf grep 2>/dev/null
+echo grep local grep $(pwd) printf | cd && "$@" local 'quoted text' grep
+/usr/bin "$1" 2>/dev/null x=1 $(pwd) --verbose
+--verbose sed echo then 'quoted text' local export
+&& sed printf | then then "$@" printf 'quoted text' /usr/bin
+		"$@" readonly x=1 'quoted text'
+	'quoted text' printf sed && test test export | && printf "$@" /usr/bin |
+local readonly ${HOME} done x=1 readonly
+		-eu | "$1" 'quoted text' /usr/bin grep
+local 'quoted text' awk x=1 -eu grep grep "$@" local
+$(pwd) -eu readonly | --verbose "$@" x=1 --verbose | local sed /usr/bin
+-eu local echo 2>/dev/null /usr/bin printf ${HOME}
+x=1 then cd ${HOME} awk grep 2>/dev/null ${HOME} test printf
+	--verbose /usr/bin 2>/dev/null
+then x=1 test grep grep done local awk "$@"
+		| sed && grep ${HOME} "$1" printf | x=1 readonly -eu $(pwd) export "$1" test
+	&& 2>/dev/null local $(pwd) then x=1 then | x=1 test $(pwd) done "$1" "$1" then
+	"$@" /usr/bin test printf local echo grep
+		--verbose "$@" -eu echo local -eu grep 2>/dev/null
+echo x=1 'quoted text' --verbose "$1" done test grep -eu ${HOME} readonly
+		sed -eu ${HOME} test "$1" -eu then done
+		done sed && readonly 'quoted text' test export
+		local test x=1 2>/dev/null then then --verbose local ${HOME}
+done echo sed -eu done $(pwd) "$1" "$@" "$1" x=1 "$@"
+${HOME} | && readonly | local
+cd echo -eu awk cd 2>/dev/null awk
+		grep && /usr/bin "$1" done -eu "$1" "$1" x=1 "$1" /usr/bin cd readonly local
+		'quoted text' $(pwd) 'quoted text' sed
+	-eu $(pwd) test export "$@" -eu x=1 2>/dev/null /usr/bin -eu 'quoted text'
+		| done /usr/bin then "$1" local && sed | done -eu test
+local export grep | then done local | | cd "$@" /usr/bin sed 'quoted text'
+	export x=1 echo "$@" /usr/bin cd $(pwd)
+		grep done x=1 echo --verbose sed -eu -eu
+		test test 2>/dev/null /usr/bin ${HOME} printf ${HOME} sed &&
+cd && local && -eu --verbose printf | readonly
+2>/dev/null readonly local echo /usr/bin readonly export done 'quoted text' | cd
+	done cd readonly x=1 -eu export sed "$1" /usr/bin -eu
+		readonly -eu /usr/bin $(pwd)
+readonly sed echo -eu done readonly readonly /usr/bin printf ${HOME}
+		then echo grep -eu printf ${HOME} then && && $(pwd)
+	"$1" --verbose 2>/dev/null then grep sed
+local && then awk grep echo --verbose grep
+echo awk $(pwd) /usr/bin
+	export test x=1 export x=1 | cd ${HOME} cd --verbose readonly 'quoted text' then
+then sed && printf awk &&
+done ${HOME} grep test sed | -eu "$1" printf -eu local
+'quoted text' "$@" printf -eu "$@" grep | readonly x=1 2>/dev/null grep
+printf x=1 cd printf x=1 | echo
+		'quoted text' 'quoted text' ${HOME} -eu $(pwd) /usr/bin "$1"
+		awk /usr/bin /usr/bin $(pwd) sed x=1 test test export x=1 2>/dev/null test $(pwd)
+		grep | test then cd local $(pwd) readonly -eu "$@"
+sed -eu 'quoted text' sed 2>/dev/null grep echo cd 2>/dev/null awk done
+		then grep 'quoted text' && printf readonly
+		grep -eu "$1" test | readonly "$1" /usr/bin
+'quoted text' test "$1" echo -eu awk sed cd readonly done "$@" then
+		awk 2>/dev/null "$1" then x=1 export 2>/dev/null printf
+cd done "$1" readonly && $(pwd) && sed
+		&& 2>/dev/null grep "$1"
+${HOME} sed | 2>/dev/null x=1 export then /usr/bin ${HOME} grep && grep $(pwd)
+-eu ${HOME} ${HOME} test ${HOME} printf --verbose
+&& | && 2>/dev/null -eu grep --verbose
+		'quoted text' 'quoted text' awk readonly $(pwd)
+	sed awk 'quoted text' 'quoted text' -eu sed grep export | /usr/bin
+		readonly -eu readonly cd local awk $(pwd) export 2>/dev/null
+| awk "$1" && $(pwd) ${HOME} "$@" x=1 printf
+then && -eu export test 2>/dev/null /usr/bin awk $(pwd)
+export echo export 'quoted text' x=1 echo test echo awk -eu x=1 awk
+"$1" ${HOME} -eu printf 2>/dev/null
+--verbose done --verbose cd echo --verbose /usr/bin
+		test && ${HOME} cd 'quoted text'
+	&& --verbose awk ${HOME} echo --verbose "$1" "$1" /usr/bin
+	2>/dev/null cd -eu done
+	export printf ${HOME} test echo ${HOME} sed local
+		done done "$@" --verbose x=1 "$1"
+done export ${HOME} | "$@"
+		-eu export readonly $(pwd)
+		"$@" awk local awk | | printf export readonly $(pwd) -eu then grep awk "$@" "$1"
+	done && 'quoted text' | ${HOME} test 'quoted text' done "$1" local grep test
+then readonly "$@" readonly readonly
+| 'quoted text' 2>/dev/null test export
+	grep /usr/bin "$1" 2>/dev/null readonly "$1" x=1 'quoted text' "$@"
+export then grep printf export $(pwd) x=1 local x=1 sed 'quoted text' sed then
+		/usr/bin cd "$1" x=1 --verbose "$@" | printf local --verbose echo export local
+awk "$@" x=1 grep "$@" 2>/dev/null printf echo x=1
+	${HOME} then grep then readonly /usr/bin awk export
+sed | sed --verbose 2>/dev/null && | "$1" "$@" local sed -eu "$1" cd
+	"$1" export grep $(pwd) test x=1 $(pwd) export awk "$@" /usr/bin readonly
+	--verbose $(pwd) printf --verbose && x=1 printf | test done test "$@" && "$1"
+	-eu echo && 'quoted text' echo 2>/dev/null && printf awk -eu "$@" awk -eu
+		local "$@" awk 2>/dev/null printf local readonly /usr/bin
+	printf export export "$@"
+/usr/bin awk --verbose
+	"$1" echo 'quoted text' "$@" 2>/dev/null sed | /usr/bin 2>/dev/null
+2>/dev/null echo ${HOME} then --verbose "$@" $(pwd) printf done /usr/bin /usr/bin
+done | 'quoted text' --verbose local
+-eu export export echo awk 'quoted text' echo printf
+-eu /usr/bin ${HOME} done "$1" printf
+		awk && "$@" grep $(pwd) /usr/bin
+		| grep 2>/dev/null awk grep 2>/dev/null
+-eu "$1" | sed cd cd cd 2>/dev/null printf && --verbose test
+test && 'quoted text' "$@" x=1 test then sed
+then cd sed x=1 cd cd test cd
+${HOME} | 'quoted text' && $(pwd) sed ${HOME} awk
+		export /usr/bin echo "$@" -eu ${HOME} echo -eu printf printf then export
+&& 'quoted text' local readonly readonly x=1 done export awk printf
+| local cd local grep export export printf export awk awk cd
+	-eu --verbose --verbose --verbose sed "$@" "$@" /usr/bin "$1" export
+		-eu 'quoted text' export test | awk | $(pwd) /usr/bin readonly grep "$1" 2>/dev/null
+	then test echo then 2>/dev/null -eu /usr/bin
+	'quoted text' echo cd | x=1 test | 'quoted text' x=1 'quoted text' export test
+	--verbose done readonly "$@" export 'quoted text'
+		local grep "$@" 2>/dev/null 2>/dev/null local -eu && "$1"
+	printf 2>/dev/null 2>/dev/null 'quoted text' 2>/dev/null
+/usr/bin test x=1 readonly 2>/dev/null then x=1 | "$@" && printf cd done echo $(pwd)
+x=1 /usr/bin sed then readonly export && cd then then grep done --verbose cd "$1"
+echo printf -eu then -eu "$@"
+	awk test export 2>/dev/null $(pwd) x=1 -eu
+2>/dev/null done "$1" 2>/dev/null "$1" local
+	--verbose | done 2>/dev/null
+export x=1 test ${HOME} grep -eu grep ${HOME}
+	&& ${HOME} local "$@" "$1" x=1 'quoted text' local -eu 2>/dev/null
+printf ${HOME} echo export test 2>/dev/null then 2>/dev/null && echo ${HOME} --verbose
+	then 2>/dev/null $(pwd) && awk awk local done "$1" --verbose done && cd sed test
+"$@" awk then $(pwd) test
+	echo -eu $(pwd) /usr/bin test 'quoted text'
+	| sed "$@" -eu then /usr/bin grep | cd "$1" ${HOME}
+		then then && "$1" printf 'quoted text' echo
+$(pwd) local "$@" printf sed export /usr/bin 'quoted text'
+--verbose | --verbose
+	test cd grep x=1 then grep then -eu local done | echo echo readonly sed "$@"
+/usr/bin "$@" local x=1 export "$1" grep ${HOME} | /usr/bin /usr/bin
+		echo $(pwd) done test x=1 'quoted text' /usr/bin local test && cd
+	grep | $(pwd) | test echo local "$@" "$1" ${HOME} awk cd ${HOME} "$@" $(pwd)
+	"$@" then 2>/dev/null && x=1 done && 2>/dev/null cd x=1
+	sed x=1 local local 'quoted text'
+	"$1" printf cd cd sed 'quoted text'
+	| && /usr/bin printf ${HOME} "$1" local local $(pwd)
+		2>/dev/null test cd "$@" done
+		test test /usr/bin && 2>/dev/null test readonly done printf | x=1
+		cd --verbose grep $(pwd) --verbose 'quoted text'
+-eu ${HOME} sed $(pwd) 'quoted text'
+		readonly awk grep --verbose x=1 -eu echo awk 2>/dev/null /usr/bin "$1" done sed
+	x=1 | echo test readonly cd then then $(pwd) printf cd
+		done x=1 -eu test test printf 'quoted text'
+	"$1" echo 2>/dev/null x=1 'quoted text' cd | 2>/dev/null cd printf
+	-eu echo printf done then ${HOME} 'quoted text' 2>/dev/null "$1" /usr/bin
+	| 2>/dev/null sed export then 'quoted text' awk 2>/dev/null
+	-eu cd readonly | x=1
+x=1 local done awk grep sed 'quoted text' local then "$1" --verbose
+		'quoted text' test -eu done
+		-eu --verbose $(pwd) /usr/bin test ${HOME} 2>/dev/null ${HOME} echo
+	"$1" ${HOME} echo local cd -eu -eu $(pwd) ${HOME} printf awk cd "$1" readonly
+		${HOME} cd grep 2>/dev/null 2>/dev/null && sed "$1" --verbose export done grep printf
+	$(pwd) | readonly test local 2>/dev/null
+	x=1 grep /usr/bin printf | /usr/bin
+		&& ${HOME} export 2>/dev/null done grep grep 2>/dev/null test
+awk x=1 "$@" 'quoted text' readonly local then
+	/usr/bin | -eu grep awk x=1 "$@" then
+		--verbose $(pwd) && printf local $(pwd) $(pwd) ${HOME}
+| grep test awk 'quoted text'
+grep "$@" "$@" 'quoted text' done cd sed
+	$(pwd) grep 2>/dev/null "$@" sed local "$1"
+	echo ${HOME} "$1" printf "$1" x=1 test --verbose | sed
+	${HOME} "$1" x=1 test local
+		x=1 echo awk ${HOME} cd x=1 readonly --verbose readonly -eu && echo
+	"$1" test sed x=1 -eu awk test 'quoted text'
+		| grep /usr/bin printf --verbose | sed
+grep echo && -eu -eu 2>/dev/null awk then
+readonly awk local export
+		| local x=1 test test x=1 sed awk echo $(pwd) /usr/bin
+"$@" done $(pwd) 'quoted text'
+		test readonly --verbose sed "$@" /usr/bin 2>/dev/null
+export "$@" "$@" && printf 2>/dev/null --verbose $(pwd) /usr/bin done "$1"
+&& x=1 $(pwd) 2>/dev/null 2>/dev/null printf test export
+	"$1" && /usr/bin "$@" $(pwd) test done export
+		awk -eu sed "$@" 2>/dev/null echo $(pwd) awk cd && && test $(pwd)
+		test -eu awk echo export grep awk && --verbose local then && -eu
+printf export export grep awk ${HOME} done export "$@"
+then "$@" /usr/bin -eu test 2>/dev/null /usr/bin
+grep done then grep 2>/dev/null then done
+	sed $(pwd) && $(pwd) --verbose readonly printf export
+	--verbose cd "$1" | && echo | x=1 x=1
+		&& test cd 2>/dev/null export cd /usr/bin
+		-eu "$@" readonly -eu awk ${HOME} 2>/dev/null $(pwd)
+		--verbose cd -eu ${HOME} --verbose done "$1" readonly
+		done | cd "$@" /usr/bin -eu --verbose 2>/dev/null
+readonly -eu ${HOME} awk
+		sed test then cd export && "$1" awk sed -eu ${HOME}
+		| /usr/bin && "$@" echo
+		cd -eu printf grep 2>/dev/null awk cd echo /usr/bin "$@" 2>/dev/null
+'quoted text' awk 'quoted text'
+		echo done sed --verbose "$@" readonly readonly echo cd done "$1" local local
+		"$@" $(pwd) done ${HOME} --verbose
+		readonly -eu 'quoted text' x=1 awk $(pwd) 2>/dev/null
+		sed done $(pwd) printf printf x=1 $(pwd)
+		cd -eu $(pwd) | -eu readonly echo readonly "$1" test -eu grep done export 'quoted text'
+		sed test ${HOME} "$@" -eu ${HOME} test local -eu ${HOME}
+local then grep export echo x=1
+	-eu grep $(pwd) 'quoted text' -eu
+	"$1" printf local readonly export "$1" "$1" local "$@"
+	grep | awk awk 2>/dev/null done $(pwd) cd readonly
+	grep test readonly -eu sed local
+local 2>/dev/null echo x=1 && /usr/bin export test test
+		then grep done "$1" done printf --verbose readonly local -eu | | "$@" sed test
+		export x=1 /usr/bin readonly $(pwd) x=1 'quoted text'
+		sed printf sed done printf then "$@" cd awk 2>/dev/null
+	then local x=1 then echo local cd test grep grep "$1" && -eu done grep
+	test $(pwd) awk "$1" cd sed "$1" ${HOME} awk $(pwd) printf awk test cd done ${HOME}
+export then sed export | readonly
+'quoted text' sed export then $(pwd) then test awk -eu --verbose /usr/bin
+		local printf printf "$1" ${HOME} 'quoted text' test sed export
+		$(pwd) export /usr/bin "$@" readonly -eu readonly awk -eu | local printf test
+		echo cd done local ${HOME} x=1 grep then
+		'quoted text' readonly export ${HOME} && export local readonly grep awk printf
+/usr/bin test grep /usr/bin cd x=1 $(pwd) "$1" then
+	awk awk | then | x=1 echo "$@" -eu ${HOME} sed ${HOME} sed $(pwd) grep | printf
+		"$1" test test grep -eu sed 'quoted text' ${HOME} readonly
+	${HOME} ${HOME} local && printf local then "$@" local ${HOME} test && $(pwd)
+grep "$1" $(pwd) /usr/bin test ${HOME} ${HOME} 2>/dev/null
+		-eu cd ${HOME} /usr/bin "$1" && test --verbose | then then
+	| ${HOME} readonly then local readonly /usr/bin $(pwd) x=1 2>/dev/null awk "$1"
+&& awk export 2>/dev/null sed "$@" sed printf
+echo echo 2>/dev/null 'quoted text'
+		export "$@" "$@" cd 'quoted text'
+		--verbose cd readonly --verbose grep 'quoted text' "$@" | awk | "$1"
+'quoted text' echo done x=1 'quoted text' awk --verbose echo /usr/bin "$1" then
+"$@" "$@" readonly | ${HOME} | cd "$1" echo sed grep export "$1" && readonly
+		then $(pwd) awk done done "$@" readonly
+	local done readonly | "$1" /usr/bin export cd echo 2>/dev/null
+	grep -eu local test && cd readonly "$1" readonly -eu
+grep sed local && -eu /usr/bin "$1" /usr/bin 2>/dev/null
+printf | --verbose awk export
+${HOME} test then && printf /usr/bin --verbose $(pwd) sed $(pwd)
+-eu "$1" test "$1" && 'quoted text' | | echo --verbose x=1 awk
+		| --verbose cd echo sed ${HOME} 2>/dev/null
+		"$1" grep sed 2>/dev/null then echo ${HOME} ${HOME} --verbose sed grep printf
+		2>/dev/null sed test | -eu then done grep --verbose
+		export && cd -eu echo local 'quoted text'
+/usr/bin "$@" then done test printf readonly awk awk awk done /usr/bin
+		then done export --verbose /usr/bin then "$1" 2>/dev/null grep -eu grep awk export
+		export export /usr/bin --verbose
+grep cd export -eu sed local "$1" sed grep cd 'quoted text' readonly x=1
+grep ${HOME} sed 2>/dev/null 'quoted text'
+	"$@" 'quoted text' grep "$1" done export awk
+		$(pwd) /usr/bin local --verbose 2>/dev/null /usr/bin
+cd sed | $(pwd) x=1 then awk 2>/dev/null | "$@" ${HOME} done test "$@" "$1"
+echo "$@" 2>/dev/null readonly x=1 then --verbose ${HOME} "$1" && sed
+	$(pwd) "$@" export awk $(pwd)
+		cd test awk export ${HOME} readonly sed && readonly
+		then | && 'quoted text' x=1 cd "$1" awk printf cd echo "$@"
+	cd "$1" 'quoted text' ${HOME} grep then readonly --verbose
+		test readonly x=1 $(pwd) 2>/dev/null export test then readonly
+&& grep test echo 'quoted text'
+	export /usr/bin x=1 2>/dev/null
+$(pwd) /usr/bin --verbose cd /usr/bin test /usr/bin export $(pwd) "$@"
+		local readonly -eu && awk "$@" x=1 done "$@" --verbose awk local grep
+grep /usr/bin | | --verbose "$1" cd cd 'quoted text' "$1" -eu sed 2>/dev/null
+local 'quoted text' export printf --verbose /usr/bin local
+	grep test readonly test "$1" then --verbose
+x=1 --verbose && cd printf awk
+	readonly readonly printf echo local "$1"
+		local cd && && && /usr/bin --verbose echo export cd done cd ${HOME} awk |
+		echo -eu -eu sed | && && /usr/bin awk &&
+sed --verbose printf then 'quoted text' grep && printf export sed 2>/dev/null
+	2>/dev/null $(pwd) /usr/bin
+/usr/bin done ${HOME} /usr/bin echo cd echo ${HOME} grep && grep done | ${HOME}
+		cd local sed ${HOME} /usr/bin
+-eu sed $(pwd) $(pwd) test "$1" 'quoted text'
+	awk test test then sed &&
+	x=1 sed printf sed "$1" local printf 2>/dev/null
+&& -eu 2>/dev/null awk echo
+	grep printf ${HOME} "$@"
+printf awk 2>/dev/null echo cd test ${HOME} awk echo awk 'quoted text'
+		printf local sed cd | -eu test x=1 -eu "$@" 'quoted text' export
+${HOME} x=1 $(pwd) -eu then &&
+export -eu 'quoted text' "$@"
+		sed local | sed --verbose
+		| echo then /usr/bin grep "$@" cd --verbose
+	test $(pwd) sed awk /usr/bin test && "$1" done test local
+	awk --verbose 'quoted text' /usr/bin "$@" awk done
+then && readonly awk then 2>/dev/null grep grep done cd 2>/dev/null
+	-eu done "$@" | local x=1 $(pwd) printf readonly $(pwd) ${HOME} "$@"
+readonly done && "$@" --verbose 2>/dev/null "$1" --verbose
+	"$@" ${HOME} cd then done readonly "$1" && export
+		done cd "$@" done test awk ${HOME} done && echo 2>/dev/null "$1"
+then -eu x=1 then 'quoted text'
+&& local -eu "$@" then ${HOME} sed x=1 "$1" /usr/bin local awk 2>/dev/null
+awk cd export printf printf printf cd done local $(pwd) && $(pwd) &&
+		--verbose 'quoted text' export | local 'quoted text' "$@" printf echo 2>/dev/null
+	2>/dev/null "$@" test $(pwd)
+		then 'quoted text' printf printf awk
+/usr/bin "$@" done export
+2>/dev/null $(pwd) sed printf
+	done awk done then /usr/bin ${HOME}
+printf ${HOME} --verbose sed 2>/dev/null "$1" printf
+		$(pwd) /usr/bin $(pwd) 'quoted text'
+	awk done "$@" printf $(pwd)
+"$1" then 2>/dev/null /usr/bin export export && /usr/bin
+	x=1 sed 'quoted text' sed --verbose export readonly $(pwd) then printf export printf
+	--verbose grep grep -eu awk cd grep "$@" done local cd $(pwd) export then
+		'quoted text' awk "$@" ${HOME} ${HOME}
+		"$@" export done export printf $(pwd) echo -eu "$@" -eu printf
+sed --verbose echo -eu local
+		cd local awk "$@" "$@" readonly then "$1" printf -eu x=1 'quoted text'
+		$(pwd) done test test export cd awk x=1 then
+	sed export readonly export export
+		&& /usr/bin export ${HOME} grep -eu awk grep
+awk awk 2>/dev/null --verbose 'quoted text'
+	grep "$@" awk --verbose --verbose
+		/usr/bin grep x=1 cd x=1 "$@" test | test export sed "$@"
+	cd | awk cd grep --verbose && ${HOME} $(pwd) x=1 -eu "$@" -eu awk
+sed cd | --verbose awk $(pwd) 'quoted text' sed && && awk
+		local x=1 $(pwd) $(pwd)
+		"$1" 2>/dev/null test 'quoted text' -eu 2>/dev/null
+	x=1 2>/dev/null echo sed 'quoted text'
+	$(pwd) then sed | /usr/bin "$@" -eu readonly x=1 then
+	export 2>/dev/null | sed awk -eu | "$1"
+		then grep printf cd | "$@" cd printf readonly
+		2>/dev/null "$@" test /usr/bin /usr/bin printf ${HOME} test readonly local
+	test | | "$1" /usr/bin x=1 cd ${HOME} echo /usr/bin "$@" "$1" readonly export
+	$(pwd) done awk export then 2>/dev/null done "$1" --verbose cd -eu | --verbose
+		readonly -eu awk grep /usr/bin x=1 x=1 | sed && export x=1 2>/dev/null awk && printf
+test 'quoted text' cd -eu | sed grep
+		readonly 2>/dev/null then awk echo -eu 'quoted text' test sed grep sed
+'quoted text' echo 2>/dev/null 'quoted text' test done printf export -eu
+	-eu then -eu x=1 2>/dev/null -eu $(pwd) 2>/dev/null readonly "$1" -eu
+		test awk -eu printf readonly && echo $(pwd) readonly "$1"
+		local | ${HOME} sed $(pwd) 'quoted text' x=1 'quoted text'
+		then export cd then echo "$@" "$1" cd "$@"
+2>/dev/null echo && export ${HOME} | 'quoted text'
+		grep "$1" awk readonly x=1 echo echo 2>/dev/null awk ${HOME} $(pwd) | "$1"
+		done 'quoted text' /usr/bin awk /usr/bin awk $(pwd) "$@" /usr/bin readonly
+		local echo sed export "$1" export local ${HOME} awk | "$1" "$1" readonly grep
+	readonly 2>/dev/null 2>/dev/null grep
+	--verbose 'quoted text' cd --verbose
+		echo x=1 export grep /usr/bin "$1" | 'quoted text' test
+grep sed && then 2>/dev/null printf 'quoted text'
+sed ${HOME} export sed sed readonly | done
+	2>/dev/null /usr/bin echo && sed "$@" echo && awk
+		done readonly export printf readonly 2>/dev/null "$@" local
+		x=1 "$1" local 'quoted text' then 2>/dev/null echo echo x=1 readonly cd cd done
+	-eu 2>/dev/null local ${HOME} | test done
+-eu test cd awk test -eu awk "$@" printf 2>/dev/null "$@" printf 2>/dev/null
+'quoted text' ${HOME} then then | readonly done /usr/bin test test test awk
+		grep printf echo x=1 sed $(pwd) readonly 2>/dev/null readonly test
+		"$1" grep && export then printf 'quoted text'
+	then "$1" then "$1" printf readonly sed
+sed -eu echo local x=1 done sed && | awk
+		grep "$@" printf ${HOME} local
+	'quoted text' --verbose then "$@" --verbose ${HOME} echo grep
+		-eu "$1" "$1" && local export done grep then "$1" then readonly |
+	"$1" local export local grep --verbose sed x=1 'quoted text'
+		export "$1" /usr/bin local export
+| readonly done --verbose printf x=1 readonly then printf local "$@" && 2>/dev/null
+		export $(pwd) local x=1 "$@" | readonly -eu cd $(pwd) then
+"$1" $(pwd) printf grep --verbose "$@" echo
+2>/dev/null -eu awk awk
+&& grep "$1" $(pwd) echo grep
+	echo x=1 "$1" local --verbose ${HOME} test awk "$@" readonly
+	done "$1" export test then awk cd && export && $(pwd) readonly grep 2>/dev/null
+awk done test readonly "$@" ${HOME}
+		$(pwd) then echo | 'quoted text' local | | awk x=1 awk
+--verbose -eu done "$@" echo
+		local /usr/bin grep && done -eu | 2>/dev/null grep local sed test readonly
+x=1 export "$@" export 'quoted text' && done ${HOME} "$1" "$@" $(pwd)
+local "$1" "$@" cd --verbose 2>/dev/null ${HOME} sed done echo test && cd test
+	test --verbose grep && "$@" $(pwd)
+grep /usr/bin export export && local awk test printf
+"$1" /usr/bin cd "$@" /usr/bin 2>/dev/null
+	grep grep printf --verbose | then ${HOME} /usr/bin grep /usr/bin && 'quoted text'
+	| then /usr/bin then done "$1" test $(pwd) "$1" echo 2>/dev/null then then
+--verbose done | export local cd /usr/bin | --verbose grep
+		&& x=1 echo --verbose 2>/dev/null export 'quoted text' /usr/bin /usr/bin
+		awk grep 'quoted text' printf echo x=1 -eu cd "$1" test
+-eu cd "$@" grep grep sed readonly awk readonly x=1 | "$1" local 2>/dev/null
+readonly export printf readonly
+	--verbose local | "$1" echo done "$1" -eu awk printf x=1 printf
+	'quoted text' -eu "$@" -eu -eu "$@" 'quoted text'
+	2>/dev/null && printf test awk test --verbose export local grep | sed "$@" &&
+	readonly export $(pwd) x=1 "$1" "$1"
+| x=1 test printf /usr/bin local echo x=1 grep "$1" $(pwd)
+		grep && printf local "$@" cd $(pwd) export
+test test export 'quoted text' $(pwd) sed /usr/bin done
+		--verbose -eu grep cd /usr/bin test
+		${HOME} $(pwd) test echo printf test $(pwd) grep then --verbose
+	local "$@" awk $(pwd) /usr/bin /usr/bin done local ${HOME} done x=1 then cd /usr/bin
+printf x=1 echo grep $(pwd) export sed "$@" ${HOME} --verbose $(pwd) export done
+	printf -eu sed $(pwd) done && "$@"
+	awk x=1 --verbose export 2>/dev/null "$1" -eu
+grep readonly grep echo $(pwd) cd 'quoted text' "$@" --verbose
+cd echo | sed printf ${HOME} done $(pwd) awk export cd && -eu "$1" export
+printf awk local echo
+		readonly 'quoted text' -eu $(pwd) 'quoted text' echo "$1" readonly
+		x=1 cd 2>/dev/null export done test grep
+--verbose test $(pwd) local awk $(pwd) x=1 && then test "$@"
+	echo -eu local done then readonly sed test
+		sed cd cd "$1" cd local "$@" && | local local x=1
+		'quoted text' | "$@" x=1 printf done -eu "$1" &&
+		"$1" printf $(pwd) cd done echo grep local export 'quoted text' -eu 2>/dev/null
+		cd 2>/dev/null 2>/dev/null awk cd echo echo && $(pwd) 'quoted text' then
+awk done awk cd 2>/dev/null x=1 | printf printf "$@" -eu
+	"$@" ${HOME} --verbose grep $(pwd) | echo grep --verbose
+		done printf "$1" then "$@" export ${HOME}
+	awk local /usr/bin readonly | && ${HOME}
+		local && export "$@" x=1 && readonly echo
+		readonly -eu "$1" done echo "$1" && cd
+		test 'quoted text' 2>/dev/null sed 'quoted text' &&
+		export local printf $(pwd) $(pwd) printf x=1 "$1"
+	-eu local sed cd "$@" /usr/bin 'quoted text' "$1" 'quoted text' grep
+$(pwd) done sed cd local grep && cd "$1" grep x=1 test --verbose "$1"
+"$@" awk test 2>/dev/null
+		/usr/bin | awk -eu --verbose readonly sed --verbose | /usr/bin
+		x=1 sed grep done cd 2>/dev/null
+		awk awk 'quoted text' 'quoted text' && $(pwd)
+	x=1 'quoted text' $(pwd) grep
+then "$1" 2>/dev/null export 2>/dev/null readonly done cd export "$1" sed
+		x=1 test && echo x=1 "$@" cd grep --verbose echo test
+	--verbose echo export $(pwd) echo local test "$@" "$1" --verbose
+		grep 2>/dev/null readonly 2>/dev/null | readonly
+| sed --verbose printf -eu awk awk grep && | sed echo && sed x=1 | echo x=1
+${HOME} sed x=1 echo printf
+		x=1 then -eu echo /usr/bin --verbose cd 'quoted text' test cd sed export local
+		2>/dev/null local grep 'quoted text' readonly "$@" -eu sed readonly
+		--verbose && then readonly && -eu 'quoted text' awk awk x=1 cd printf
+		export done $(pwd) then ${HOME} && ${HOME} $(pwd) ${HOME}
+	/usr/bin "$1" done grep && echo 2>/dev/null cd printf done 2>/dev/null
+printf --verbose "$1" | cd echo export
+| readonly printf /usr/bin 'quoted text'
+	export ${HOME} echo $(pwd) test 2>/dev/null awk grep x=1
+		/usr/bin echo cd "$@" local
+then $(pwd) 'quoted text' test -eu
+local echo "$@" echo then readonly
+	| echo awk done 2>/dev/null sed -eu grep 2>/dev/null
+local -eu ${HOME} /usr/bin sed "$1" export awk "$1" &&
+--verbose test -eu ${HOME} ${HOME} -eu && x=1 | export done "$@" | 'quoted text'
+	"$1" $(pwd) x=1 awk "$@"
+	then x=1 'quoted text' test printf echo "$1" --verbose
+		/usr/bin readonly cd /usr/bin &&
+-eu export printf "$1" ${HOME}
+	"$1" test export done sed printf $(pwd)
+		done test 'quoted text' "$@"
+		local local | --verbose done "$@" ${HOME} --verbose -eu -eu
+	done "$1" 'quoted text' ${HOME} echo done
+		-eu export -eu "$1" readonly
+		"$1" printf && cd echo && && /usr/bin printf grep then "$1" sed echo 'quoted text'
+		2>/dev/null -eu 2>/dev/null 'quoted text'
+	readonly 'quoted text' "$1" then 2>/dev/null export readonly && cd readonly
+readonly export ${HOME} sed grep export echo export 'quoted text'
+	/usr/bin 'quoted text' local sed x=1 readonly sed &&
+echo test $(pwd) /usr/bin awk x=1 "$@" "$@" cd cd test grep test echo then
+	readonly ${HOME} local $(pwd)
+		test --verbose cd $(pwd) grep printf |
+		awk local test "$@" export | cd --verbose local awk && cd --verbose export 2>/dev/null
+		/usr/bin x=1 export /usr/bin "$@" printf
+		readonly "$@" ${HOME} test export && ${HOME} 'quoted text' readonly sed local
+"$1" sed $(pwd) grep /usr/bin
+	awk local "$1" "$1" 2>/dev/null
+	/usr/bin "$1" echo printf --verbose | printf test done /usr/bin echo | "$@"
+printf -eu then x=1 grep "$1" /usr/bin && 'quoted text' "$1" "$1" export
+sed 'quoted text' ${HOME} --verbose 2>/dev/null
+		cd -eu readonly printf cd cd | $(pwd) sed "$1"
+${HOME} "$@" done "$1" 2>/dev/null sed
+test && grep && --verbose awk --verbose
+		test local "$1" then echo 2>/dev/null grep awk ${HOME}
+	--verbose | $(pwd) | local /usr/bin $(pwd)
+		done -eu /usr/bin 2>/dev/null export ${HOME} --verbose /usr/bin export
+		2>/dev/null readonly "$@" awk local | echo then ${HOME} grep
+&& ${HOME} export local done && "$1"
+		$(pwd) 'quoted text' -eu awk cd echo /usr/bin --verbose -eu grep
+		2>/dev/null "$@" --verbose $(pwd) --verbose x=1 done local -eu --verbose sed sed
+echo awk printf sed 'quoted text' cd sed ${HOME} | done ${HOME} local echo test
+		${HOME} 2>/dev/null test 2>/dev/null grep then 'quoted text' 2>/dev/null
+	&& readonly && --verbose 2>/dev/null export sed &&
+	"$@" awk readonly done -eu x=1 awk && --verbose --verbose
+		"$1" "$1" then "$1" printf echo awk grep ${HOME} local "$1" --verbose echo
+		grep awk "$@" awk readonly "$@" -eu printf
+	test "$1" then 'quoted text' sed sed x=1 | /usr/bin
+		-eu test readonly $(pwd) grep local $(pwd) printf printf sed sed export
+		'quoted text' then ${HOME} cd readonly
+		cd awk | 2>/dev/null export grep --verbose
+		test --verbose then grep -eu local
+	sed $(pwd) local export cd ${HOME} /usr/bin echo $(pwd)
+	test awk ${HOME} 'quoted text' then readonly
+	printf $(pwd) | | done x=1 grep ${HOME} 'quoted text' cd then /usr/bin
+	| ${HOME} test sed && grep && test echo $(pwd) "$@" test | printf -eu -eu
+'quoted text' | "$@" export "$@" sed | cd "$@"
+	"$1" done 2>/dev/null readonly "$1" then -eu --verbose | /usr/bin /usr/bin
+	$(pwd) 2>/dev/null then then 2>/dev/null
+	grep --verbose 2>/dev/null awk
+		awk awk export && echo ${HOME} local printf cd cd "$@" cd 2>/dev/null
+		test -eu x=1 -eu 2>/dev/null printf awk && export
+	x=1 cd 2>/dev/null "$@" local "$1" printf && "$1" done 2>/dev/null local
+done sed $(pwd) awk $(pwd) echo
+		printf --verbose && 'quoted text' x=1 echo | x=1 then
+#include c60.sh
+		echo cd cd done local 'quoted text' test /usr/bin
+local /usr/bin readonly
+	x=1 printf /usr/bin sed /usr/bin 'quoted text' | readonly printf awk
+readonly cd --verbose /usr/bin x=1 "$1" x=1
+	"$1" export export "$@" done "$@" cd | done
+	| test then echo export test
+	then test sed cd 2>/dev/null x=1 local grep
+grep /usr/bin then test
+sed test --verbose -eu "$@" then -eu grep export sed
+		local /usr/bin done printf ${HOME} echo local ${HOME} then ${HOME} echo
+	--verbose "$1" 2>/dev/null "$1" test sed 'quoted text' --verbose local
+	test | echo done ${HOME} $(pwd) $(pwd) --verbose $(pwd) cd "$1" local x=1
+		cd then --verbose --verbose 'quoted text' sed export
+printf x=1 awk done 2>/dev/null
+	readonly && --verbose 2>/dev/null test /usr/bin x=1 local ${HOME} printf && printf
+"$@" readonly -eu 2>/dev/null export echo test sed then
+| "$1" test sed echo 2>/dev/null export "$@" test local export echo awk x=1
+		${HOME} then -eu grep local
+	grep ${HOME} 2>/dev/null sed -eu cd export done && done $(pwd) && --verbose $(pwd)
+		awk /usr/bin "$@" readonly --verbose printf awk grep export
+	cd echo "$1" | done test export then 2>/dev/null
+	--verbose -eu $(pwd) cd done | readonly test export
+2>/dev/null ${HOME} readonly 'quoted text' /usr/bin
+		export $(pwd) printf echo
+		&& printf | cd printf --verbose
+		"$1" ${HOME} "$@" awk
+		"$1" export "$@" "$@" ${HOME} x=1 'quoted text' /usr/bin 2>/dev/null $(pwd)
+	${HOME} /usr/bin done cd /usr/bin printf readonly local readonly
+	-eu 2>/dev/null grep then "$@" "$@" x=1 && | cd local && | echo
+local 'quoted text' local awk ${HOME} --verbose export -eu ${HOME}
+		/usr/bin readonly 'quoted text' cd export && export then /usr/bin x=1
+		awk awk awk -eu cd --verbose grep -eu local 'quoted text' export readonly
+		&& grep | printf /usr/bin grep $(pwd) -eu then 2>/dev/null awk sed
+local cd && && ${HOME} /usr/bin -eu test && sed local printf echo $(pwd)
+	${HOME} && done 2>/dev/null sed /usr/bin printf 2>/dev/null local
+$(pwd) /usr/bin /usr/bin ${HOME} | test ${HOME} done cd ${HOME} 'quoted text'
+test then readonly --verbose test "$1" && 'quoted text' -eu awk grep
+		test done then grep sed readonly 'quoted text'
+		-eu -eu printf --verbose
+sed && "$1" test export 'quoted text'
+	readonly "$1" /usr/bin sed "$@"
+done then -eu then && local awk sed /usr/bin awk printf
+	2>/dev/null export && export awk then "$@" $(pwd) export "$1"
+printf done /usr/bin /usr/bin ${HOME} readonly 2>/dev/null
+&& cd printf | local $(pwd) x=1 test 2>/dev/null | 2>/dev/null
+	echo sed -eu export test 2>/dev/null then x=1 sed grep export 2>/dev/null 'quoted text'
+	grep $(pwd) | && sed && 'quoted text'
+	readonly export | ${HOME} export test done "$1" -eu grep 2>/dev/null
+-eu --verbose local printf ${HOME} then $(pwd) then
+${HOME} "$@" /usr/bin x=1 awk x=1
+		printf --verbose 'quoted text' export
+cd x=1 -eu cd printf test $(pwd) export "$@" done done
+echo "$@" 2>/dev/null grep --verbose export && $(pwd) local local awk
+		done export sed echo -eu echo echo then done then done "$@" "$@"
+| done done "$@" printf 2>/dev/null readonly readonly awk done
+		&& $(pwd) /usr/bin cd && sed test 2>/dev/null test ${HOME} cd && done |
+done grep echo local echo cd local -eu "$1" sed then then "$1" test
+export test 2>/dev/null local /usr/bin grep echo | echo
+--verbose $(pwd) test printf
+	then "$@" /usr/bin --verbose
+		done && "$@" -eu export
+		'quoted text' "$1" sed readonly | x=1
+printf cd /usr/bin cd $(pwd) /usr/bin | printf local sed readonly
+	echo /usr/bin 2>/dev/null cd -eu
+-eu && "$@" 'quoted text' ${HOME} test /usr/bin 'quoted text'
+		grep cd echo export x=1
+readonly -eu local $(pwd) test x=1 $(pwd)
+echo "$@" ${HOME} grep /usr/bin sed done awk 'quoted text' /usr/bin
+		"$@" done "$1" && --verbose && done grep test 2>/dev/null "$@" test done "$@"
+		${HOME} | done /usr/bin --verbose x=1 local grep 2>/dev/null
+then /usr/bin printf 2>/dev/null awk x=1 -eu grep
+		grep done local $(pwd) "$1" done /usr/bin done done
+	grep /usr/bin awk /usr/bin && && done
+&& grep test local 'quoted text' | /usr/bin export export readonly readonly "$@"
+printf x=1 && sed --verbose $(pwd) 2>/dev/null /usr/bin done
+	test --verbose -eu | -eu done | grep
+	'quoted text' test sed test
+		printf done "$@" local /usr/bin
+		export done grep --verbose $(pwd) echo ${HOME} echo done -eu test grep cd
+	$(pwd) "$1" --verbose 'quoted text' then cd $(pwd) printf grep x=1 ${HOME} x=1
+		$(pwd) test x=1 "$@" done readonly then export then $(pwd) x=1 readonly
+		/usr/bin local ${HOME} local && "$@" sed | readonly readonly grep "$@" -eu
+	| ${HOME} test $(pwd) printf /usr/bin grep
+awk $(pwd) "$@" --verbose then "$1" /usr/bin /usr/bin readonly done readonly
+/usr/bin grep $(pwd) x=1 "$@" ${HOME} ${HOME} | sed --verbose
+	sed readonly && $(pwd) 'quoted text' awk done -eu && | readonly test
+	echo grep | cd grep 2>/dev/null | grep cd | cd && 2>/dev/null "$1" 'quoted text'
+	--verbose test local "$1" readonly grep
+	"$@" test printf done /usr/bin ${HOME}
+	printf x=1 x=1 awk 2>/dev/null |
+	then "$1" --verbose 2>/dev/null readonly "$1"
+sed then done then "$@" /usr/bin $(pwd) printf "$1" test export | && "$1"
+readonly grep ${HOME} x=1 readonly sed
+2>/dev/null cd grep -eu awk | 'quoted text' printf 'quoted text'
+x=1 "$1" && ${HOME} readonly
+x=1 -eu then "$1" x=1 x=1 export /usr/bin awk test
+		readonly cd awk | echo printf "$@" /usr/bin readonly grep
+	awk readonly --verbose 2>/dev/null 2>/dev/null /usr/bin /usr/bin
+		then x=1 cd export cd 2>/dev/null 2>/dev/null
+		--verbose ${HOME} ${HOME}
+		| && readonly /usr/bin x=1 "$1" /usr/bin
+sed printf $(pwd) ${HOME} -eu then test then $(pwd) export ${HOME} x=1 export
+	readonly x=1 test -eu --verbose
+"$1" --verbose awk cd 'quoted text' done "$@" awk "$@"
+		echo printf 'quoted text' 2>/dev/null awk && local | sed done grep test
+		done printf 'quoted text' && done then /usr/bin x=1 local ${HOME} -eu
+| --verbose done awk && then local grep
+		echo "$1" then local printf test ${HOME}
+x=1 then -eu $(pwd) --verbose && sed awk printf 'quoted text' export ${HOME}
+		local readonly "$1" x=1 printf readonly grep "$1" ${HOME} done 2>/dev/null
+2>/dev/null local | cd --verbose | local && test cd && | sed "$1" -eu
+$(pwd) done sed readonly local --verbose -eu echo $(pwd) x=1 printf "$@" "$1"
+	--verbose cd "$@" done 2>/dev/null "$@" 'quoted text' sed "$@" 'quoted text'
+awk local done export x=1 -eu test
+	export | ${HOME} readonly export done export ${HOME} $(pwd) 2>/dev/null /usr/bin
+	awk awk x=1 | ${HOME} printf x=1 done "$1" awk -eu | test
+		test done grep readonly echo export export | local | ${HOME} printf
+$(pwd) ${HOME} local && $(pwd) awk local test readonly readonly 'quoted text'
+		printf /usr/bin -eu /usr/bin sed -eu 'quoted text' "$@" $(pwd) 2>/dev/null
+	2>/dev/null sed $(pwd)
+	$(pwd) --verbose done --verbose local readonly
+echo && --verbose test awk /usr/bin then
+	test | /usr/bin done echo
+		echo $(pwd) cd --verbose | "$@"
+		"$@" -eu x=1 local /usr/bin x=1 test && then awk ${HOME} -eu
+	awk done /usr/bin "$1" done cd cd | "$@"
+done echo export grep printf 2>/dev/null export test awk x=1 'quoted text' local
+--verbose | printf cd -eu "$@"
+	--verbose sed | test &&
+	"$1" 'quoted text' 2>/dev/null cd done then sed "$@" cd then "$@" echo cd
+	grep $(pwd) export -eu | grep /usr/bin export 2>/dev/null | --verbose
+		-eu test test $(pwd) ${HOME} 'quoted text'
+	test $(pwd) local "$@" x=1 && local | 'quoted text' && sed /usr/bin cd ${HOME}
+	"$@" test grep sed 2>/dev/null 'quoted text'
+		test readonly cd 'quoted text' $(pwd) printf 2>/dev/null /usr/bin
+		/usr/bin sed then local cd "$1" $(pwd) echo "$1" /usr/bin && printf
+		grep awk "$1" "$1" export echo x=1 cd "$1" sed done 2>/dev/null
+"$@" sed then && sed | && /usr/bin /usr/bin 2>/dev/null ${HOME}
+		&& echo "$1" readonly | 2>/dev/null
+	done "$@" sed "$1" awk then readonly $(pwd) then export
+	'quoted text' done | $(pwd) export --verbose
+| sed /usr/bin && printf x=1 | printf
+		$(pwd) 2>/dev/null test /usr/bin printf
+done $(pwd) /usr/bin ${HOME} && test readonly && --verbose
+		x=1 $(pwd) sed sed 2>/dev/null readonly x=1 export test export grep sed printf
+		awk ${HOME} && grep | /usr/bin cd "$@" 2>/dev/null export test done
+local awk echo --verbose awk echo readonly $(pwd) local /usr/bin "$@" echo
+		sed cd x=1 ${HOME} sed "$1" && done "$1" "$@" | "$1" grep local && cd test
+	| echo awk "$1" | done cd then test x=1 "$1" "$@" then cd "$1" $(pwd)
+		$(pwd) 'quoted text' local /usr/bin
+		/usr/bin awk awk 2>/dev/null readonly awk "$1" "$1" --verbose
+	awk test ${HOME} 2>/dev/null then && /usr/bin test "$1" --verbose "$@" /usr/bin
+	export export --verbose local test done -eu && awk echo sed --verbose sed
+	$(pwd) -eu cd local awk --verbose
+cd sed done 2>/dev/null test 2>/dev/null
+	export export done -eu echo && $(pwd) -eu grep $(pwd) x=1 grep done $(pwd) awk 'quoted text'
+echo 2>/dev/null /usr/bin --verbose
+	/usr/bin done x=1 export grep && readonly local "$1" | $(pwd) --verbose
+x=1 grep && cd then x=1 test echo cd 'quoted text' cd 'quoted text'
+		&& "$1" grep | x=1 done "$1" && grep x=1 grep printf printf ${HOME} test
+		$(pwd) printf cd "$@" "$@" --verbose 'quoted text' done | printf echo &&
+grep --verbose "$1" awk | then done && | echo readonly "$@" then cd
+	&& awk 2>/dev/null export test "$1" 2>/dev/null ${HOME} && "$1" --verbose
+		${HOME} export grep && 2>/dev/null sed printf "$1" $(pwd) x=1 grep
+	2>/dev/null --verbose 'quoted text' $(pwd)
+printf && done local local readonly --verbose $(pwd) ${HOME}
+	readonly -eu grep test "$1"
+	'quoted text' cd done ${HOME} printf echo then x=1 readonly
+		sed awk sed echo 'quoted text' /usr/bin 'quoted text' ${HOME} cd ${HOME}
+x=1 -eu export grep $(pwd) printf
+	done test awk grep done "$1" $(pwd) && sed readonly grep 'quoted text'
+		printf && done | $(pwd) grep printf printf 'quoted text' readonly grep
+		done x=1 test "$1" awk "$1" ${HOME} /usr/bin
+export awk 2>/dev/null then 2>/dev/null
+		export grep sed x=1 local 'quoted text'
+readonly x=1 done $(pwd) x=1 x=1 /usr/bin
+		$(pwd) x=1 cd -eu test $(pwd) 'quoted text' ${HOME} awk --verbose x=1
+local printf echo 'quoted text'
+	printf done readonly x=1 --verbose --verbose awk printf test
+"$1" | ${HOME} -eu readonly
+	grep done x=1 "$1" awk ${HOME}
+awk --verbose ${HOME} "$@" awk /usr/bin x=1 -eu 2>/dev/null grep echo echo done
+		local && test | -eu awk local awk test /usr/bin -eu | 2>/dev/null | x=1 x=1
+	done ${HOME} test printf 'quoted text' --verbose done then cd readonly awk
+	$(pwd) cd 2>/dev/null
+&& test cd test grep sed $(pwd) done local
+-eu | sed awk "$@" "$1" sed printf && ${HOME} local
+	grep /usr/bin "$@" 'quoted text' 'quoted text' readonly printf
+	$(pwd) echo -eu "$@" sed readonly -eu echo "$1" 2>/dev/null
+		sed cd sed --verbose grep awk readonly sed /usr/bin
+echo x=1 /usr/bin | local then export | grep && printf printf
+sed 'quoted text' then export
+awk "$@" done done export /usr/bin | awk && export export -eu
+$(pwd) awk && awk "$@" ${HOME}
+local 2>/dev/null && --verbose cd 2>/dev/null echo then echo
+	cd -eu 2>/dev/null then && 'quoted text' printf $(pwd) --verbose
+cd echo | export then export -eu x=1 'quoted text'
+	"$1" --verbose --verbose &&
+grep export export x=1 ${HOME} 2>/dev/null test then sed
+export awk echo printf export
+	awk "$1" awk test | "$@" x=1 readonly test awk grep ${HOME}
+awk $(pwd) printf 2>/dev/null ${HOME} grep test export sed readonly local printf
+| cd printf export grep done /usr/bin then
+	--verbose 'quoted text' && awk "$@" x=1 $(pwd) then readonly
+-eu printf echo readonly printf ${HOME}
+		"$@" export 2>/dev/null export
+		"$@" then test "$@" 2>/dev/null 2>/dev/null
+	/usr/bin $(pwd) grep test "$1" 2>/dev/null --verbose
+--verbose ${HOME} -eu 'quoted text'
+	grep | "$1" --verbose printf x=1 echo readonly export echo done ${HOME}
+test /usr/bin ${HOME} "$@" printf 'quoted text'
+"$@" 2>/dev/null test 'quoted text' echo
+export ${HOME} test then awk -eu local $(pwd) done cd /usr/bin --verbose
+	readonly /usr/bin "$@" "$@" readonly 2>/dev/null readonly x=1 then sed echo
+	2>/dev/null export "$@" && "$1" done printf export
+	-eu ${HOME} echo -eu test readonly sed readonly awk 'quoted text' test $(pwd)
+printf "$@" 'quoted text' x=1 local "$1" "$@" && done then
+		"$@" -eu "$1" printf echo done 'quoted text' 'quoted text' x=1 "$@" ${HOME}
+		'quoted text' export echo then then
+		${HOME} "$1" /usr/bin export printf cd "$@" export
+echo x=1 cd "$1" "$1" ${HOME} readonly local $(pwd) x=1 --verbose ${HOME} export
+x=1 --verbose awk 'quoted text' | 'quoted text' 'quoted text'
+	local local cd ${HOME} cd --verbose --verbose 2>/dev/null 'quoted text'
+	$(pwd) awk $(pwd) ${HOME} echo echo done echo printf
+	echo printf && test test readonly $(pwd) --verbose local test cd -eu x=1
+		grep awk readonly 2>/dev/null
+	/usr/bin "$1" then $(pwd) "$@" test sed test
+		cd awk && grep echo 'quoted text' readonly /usr/bin "$1" cd 'quoted text'
+		2>/dev/null sed readonly echo done && then cd -eu grep
+		'quoted text' /usr/bin
+		grep | local export sed export
+		export ${HOME} && echo x=1 /usr/bin /usr/bin
+		readonly "$@" cd /usr/bin echo
+'quoted text' test printf --verbose
+		cd 'quoted text' $(pwd) export echo /usr/bin | then "$1" echo | then | done then
+cd --verbose then echo
+		| readonly readonly local sed $(pwd) && grep readonly
+awk printf echo sed then $(pwd) ${HOME}
+		cd awk awk sed echo test | printf local done cd $(pwd)
+		readonly grep /usr/bin 'quoted text' ${HOME} && $(pwd) cd && readonly /usr/bin
+		sed grep done printf echo 'quoted text' echo -eu cd test then
+	2>/dev/null done x=1 'quoted text' $(pwd) "$@" 2>/dev/null ${HOME}
+sed grep 'quoted text' && "$1" test | -eu x=1 then
+	&& && cd export x=1 grep "$@"
+export --verbose echo "$@" -eu sed "$1" echo 2>/dev/null ${HOME} local |
+export then readonly printf /usr/bin
+		awk grep local export -eu cd sed && ${HOME} 'quoted text' "$@" cd printf
+| export ${HOME} $(pwd) done export
+--verbose printf then echo sed x=1 ${HOME} export "$1" x=1 export sed x=1 2>/dev/null
+| then done $(pwd) test local
+	test x=1 test 'quoted text' 'quoted text' done echo
+	printf cd && "$1" && test ${HOME} readonly awk --verbose then
+		test grep && && "$1" 'quoted text' cd cd export -eu "$1" 2>/dev/null 2>/dev/null
+grep | echo $(pwd) echo "$1" grep then awk 2>/dev/null
+	sed export test | "$1" then awk && local grep ${HOME} cd local echo
+	readonly test then x=1 "$@" "$@" local test cd printf printf "$1" -eu
+	echo cd && -eu x=1 grep sed $(pwd) x=1 && sed sed local
+	readonly --verbose awk printf
+		2>/dev/null readonly printf /usr/bin echo "$1" --verbose "$@" then awk
+&& local done --verbose --verbose 'quoted text'
+"$@" x=1 cd cd printf -eu $(pwd) "$@"
+	done /usr/bin awk export readonly
+	-eu test test sed echo ${HOME} -eu x=1 'quoted text' 'quoted text'
+		then test x=1 | "$@" readonly x=1 | /usr/bin /usr/bin
+		sed 2>/dev/null awk -eu cd
+		export readonly local "$@" grep 'quoted text'
+	"$@" readonly ${HOME} ${HOME} $(pwd) export
+	awk 'quoted text' cd awk done then local --verbose local $(pwd)
+	2>/dev/null awk printf awk done --verbose export x=1 ${HOME} test
+	${HOME} test sed $(pwd) | 'quoted text' $(pwd) export grep -eu
+${HOME} /usr/bin -eu done
+	export readonly && done "$@" printf -eu x=1 test "$@"
+	cd export ${HOME} local 2>/dev/null "$1" /usr/bin done
+sed /usr/bin local 'quoted text' readonly
+echo $(pwd) | && 'quoted text' local echo && test echo ${HOME} | local
+		| /usr/bin /usr/bin && /usr/bin grep 2>/dev/null /usr/bin then sed grep awk printf
+	2>/dev/null test done awk ${HOME} printf readonly then local
+		test echo cd "$@" --verbose /usr/bin awk ${HOME}
+	| "$@" done echo | --verbose printf cd echo cd echo done echo
+	'quoted text' then sed | sed echo export
+	grep readonly "$@" echo export --verbose
+${HOME} 'quoted text' local "$1" done "$@" --verbose "$@"
+		&& sed echo "$@" $(pwd) grep export 'quoted text' printf
+grep $(pwd) then echo --verbose
+		local test $(pwd) "$1" && local "$@" | "$1" && 'quoted text' "$1" echo
+printf $(pwd) awk awk | "$1" x=1
+	sed then && 'quoted text' then
+		printf readonly grep $(pwd) && cd x=1 printf grep local | test && printf
+		printf -eu x=1 then 2>/dev/null | export "$1" | echo test export
+local "$1" && 2>/dev/null grep x=1 test 2>/dev/null
+		sed grep sed /usr/bin ${HOME} local grep "$1"
+cd | -eu then local | export sed sed cd -eu awk test awk local
+printf | local echo test echo | done
+		echo done $(pwd) $(pwd) done -eu 'quoted text' done local "$@" 2>/dev/null
+'quoted text' "$@" test --verbose
+done then && -eu x=1 sed ${HOME} then "$@" x=1 readonly ${HOME} done
+	cd && sed | | /usr/bin && ${HOME} awk --verbose
+done ${HOME} grep echo echo 'quoted text' "$@" local local --verbose
+		| --verbose grep 'quoted text' |
+	${HOME} 2>/dev/null grep echo cd echo
+		awk echo ${HOME} printf then
+	2>/dev/null then printf ${HOME} -eu done x=1 'quoted text' 'quoted text'
+		echo ${HOME} cd && export && "$1" --verbose
+test then local 'quoted text' readonly cd
+	export test awk readonly 2>/dev/null "$@" grep 'quoted text'
+	/usr/bin local local x=1 2>/dev/null
+		echo x=1 ${HOME} "$@" then export && sed 'quoted text' && cd | done $(pwd)
+		then test echo echo export then local ${HOME} echo
+	then ${HOME} then && cd done awk "$1" export "$@" ${HOME}
+		'quoted text' printf readonly 2>/dev/null readonly ${HOME} --verbose
+${HOME} 'quoted text' -eu -eu --verbose
+		readonly awk 'quoted text' echo && echo /usr/bin
+printf | cd readonly /usr/bin x=1 | printf local sed | $(pwd)
+	&& && done test cd x=1 /usr/bin printf && -eu readonly done then 'quoted text'
+		"$@" 2>/dev/null echo then printf x=1 && printf 'quoted text' 2>/dev/null
+	export grep && "$1" test -eu /usr/bin --verbose --verbose
+		'quoted text' 2>/dev/null cd ${HOME} readonly then | local ${HOME} "$1"
+"$1" | readonly readonly | "$@" done
+		echo --verbose echo $(pwd) grep printf -eu $(pwd) /usr/bin "$1" test ${HOME} grep
+"$@" ${HOME} then awk grep -eu
+		"$@" /usr/bin export sed sed export export 2>/dev/null 'quoted text'
+	'quoted text' $(pwd) echo echo
+	test x=1 done done sed -eu readonly ${HOME} then 'quoted text' awk then "$@" "$1"
+	-eu echo ${HOME} then && $(pwd) awk echo
+		sed -eu local $(pwd) $(pwd) export "$@" 'quoted text' readonly &&
+	local | $(pwd) printf echo export sed
+	then readonly "$@" "$@"
+echo -eu readonly grep then done && then x=1
+		${HOME} echo 'quoted text' local $(pwd) export
+$(pwd) readonly "$1" cd test
+	echo then $(pwd) cd && echo cd --verbose /usr/bin 'quoted text' then cd echo
+	test "$1" printf ${HOME}
+	printf $(pwd) readonly local echo 'quoted text'
+	$(pwd) awk export $(pwd) printf printf local x=1 printf echo "$1"
+	printf echo --verbose $(pwd) 'quoted text'
+done printf x=1 "$1" "$@" ${HOME} && awk
+		$(pwd) echo --verbose cd 'quoted text' then then ${HOME} | x=1 $(pwd)
+		local /usr/bin 2>/dev/null awk ${HOME} && export
+		&& printf --verbose done x=1
+		sed readonly "$@" 'quoted text'
+	-eu cd local ${HOME} grep $(pwd) | then
+	sed ${HOME} --verbose -eu $(pwd) awk -eu $(pwd) "$1"
+	done readonly $(pwd) cd && 'quoted text'
+	test x=1 /usr/bin 2>/dev/null
+	"$1" readonly /usr/bin export grep
+		$(pwd) x=1 2>/dev/null "$1" "$1" $(pwd) cd
+then grep "$@" && /usr/bin sed export ${HOME} readonly x=1 x=1 printf "$1" 2>/dev/null
+		| -eu test ${HOME} ${HOME} x=1 then printf 'quoted text' grep "$@" --verbose
+cd /usr/bin export && ${HOME} echo echo "$@" then printf
+	"$1" /usr/bin && 2>/dev/null echo echo && /usr/bin done | sed cd
+	| readonly sed grep $(pwd) test "$1" 2>/dev/null 'quoted text' then /usr/bin
+$(pwd) grep done grep sed --verbose 2>/dev/null
+	local grep done grep x=1 echo --verbose cd echo "$@" readonly
+		local echo ${HOME} sed /usr/bin /usr/bin local -eu readonly printf
+'quoted text' awk then grep sed awk --verbose then sed cd | readonly
+	then sed -eu export sed export | grep "$@"
+sed then -eu x=1 $(pwd) --verbose | 'quoted text'
+--verbose 'quoted text'
+	grep done "$1" "$1" awk test x=1 cd x=1 grep sed grep 'quoted text' x=1 ${HOME}
+	x=1 && local echo /usr/bin "$@" /usr/bin grep -eu x=1 printf -eu awk
+	2>/dev/null test test ${HOME} then -eu
+	export echo export sed ${HOME} cd && "$@" /usr/bin | -eu $(pwd) done
+		"$@" done 2>/dev/null then then awk done ${HOME}
+		-eu && -eu local cd awk done x=1 done
+local 'quoted text' "$@"
+awk readonly /usr/bin x=1 cd "$1"
+		local | echo $(pwd) ${HOME} && -eu x=1 test /usr/bin && then
+-eu readonly x=1 "$1" 'quoted text'
+		export then printf readonly cd "$@"
+		readonly echo test cd done | --verbose sed grep "$1" readonly echo /usr/bin echo
+	x=1 sed $(pwd) --verbose ${HOME} local "$1" sed 'quoted text'
+	then | | readonly echo | test readonly "$@" test 2>/dev/null export $(pwd)
+/usr/bin x=1 ${HOME} awk && $(pwd) "$@" cd sed done -eu awk 'quoted text'
+		done && "$1" /usr/bin readonly 2>/dev/null test "$1"
+awk readonly export cd $(pwd) awk cd cd "$1" 'quoted text' "$1"
+$(pwd) grep "$1" ${HOME} -eu $(pwd) sed echo readonly test awk
+echo -eu ${HOME} grep awk cd 2>/dev/null echo cd
+		sed sed printf export -eu 2>/dev/null --verbose export grep local awk printf
+		${HOME} && readonly 'quoted text' -eu grep
+	printf echo /usr/bin "$@" "$1"
+	printf $(pwd) export -eu export printf x=1 $(pwd) 2>/dev/null printf test --verbose
+	sed then export cd | 'quoted text' "$1" export ${HOME} cd
+	grep test echo -eu 2>/dev/null
+		sed sed local sed 2>/dev/null | done $(pwd)
+		export | 'quoted text' | /usr/bin
+$(pwd) /usr/bin 'quoted text' grep | printf local
+export echo awk done printf /usr/bin sed "$@" sed -eu
+	"$1" && $(pwd) 2>/dev/null x=1 -eu "$@" && test echo sed echo "$1" -eu 'quoted text'
+"$@" ${HOME} --verbose ${HOME} $(pwd) 2>/dev/null
+$(pwd) --verbose x=1 | 2>/dev/null
+${HOME} /usr/bin "$@" | local 2>/dev/null
+	/usr/bin "$@" $(pwd) done echo then --verbose x=1 /usr/bin
+sed sed readonly export && printf grep 'quoted text' ${HOME} readonly
+then printf "$@" ${HOME} -eu printf ${HOME} printf
+	&& readonly && then --verbose printf | export
+then sed echo test printf 2>/dev/null cd grep &&
+export then 'quoted text' | test test | test "$@" done ${HOME} && && then |
+sed 2>/dev/null $(pwd) $(pwd) x=1 echo echo sed cd
+x=1 echo readonly export x=1 export then awk
+--verbose 2>/dev/null 2>/dev/null $(pwd) then $(pwd) grep
+		awk cd --verbose awk sed cd | echo ${HOME} printf printf -eu "$1"
+		readonly grep "$1" "$@" --verbose test sed "$@"
+		cd --verbose $(pwd) then 'quoted text' readonly export cd --verbose echo
+grep -eu cd export printf
+		done export -eu 2>/dev/null readonly x=1 /usr/bin x=1 2>/dev/null echo test
+		readonly awk && x=1 export echo cd x=1
+	echo cd /usr/bin $(pwd)
+'quoted text' export export readonly && export "$@" local echo x=1 printf
+"$1" "$1" $(pwd) echo -eu done
+		2>/dev/null then 2>/dev/null $(pwd) done "$@" ${HOME} export ${HOME}
+	x=1 echo 2>/dev/null echo x=1 $(pwd) --verbose echo | -eu && 'quoted text'
+	cd awk ${HOME} grep --verbose && "$@" printf "$@" local grep x=1 cd sed then
+	"$@" sed /usr/bin awk ${HOME}
+	echo x=1 test 2>/dev/null && --verbose
+	echo sed grep echo readonly && readonly
+	--verbose 'quoted text' then 2>/dev/null
+		/usr/bin $(pwd) awk sed done grep
+		--verbose grep done | test
+awk export cd /usr/bin grep then sed readonly /usr/bin && grep 'quoted text'
+		2>/dev/null done ${HOME} 2>/dev/null echo readonly /usr/bin awk 2>/dev/null
+		grep readonly grep cd readonly x=1 | awk grep
+	local && export /usr/bin local /usr/bin "$1"
+		"$1" awk sed readonly test -eu local /usr/bin
+		sed export ${HOME} done "$@" "$1"
+-eu local 'quoted text' "$1" x=1 'quoted text' | --verbose
+2>/dev/null readonly | test --verbose --verbose sed 'quoted text' readonly printf
+		$(pwd) --verbose echo "$1" local 'quoted text' | --verbose grep 2>/dev/null
+sed grep local grep ${HOME} test --verbose -eu grep --verbose
+		${HOME} grep sed sed grep sed
+	--verbose x=1 $(pwd) $(pwd) 2>/dev/null /usr/bin sed grep "$@" -eu $(pwd) sed x=1
+test echo grep /usr/bin --verbose echo "$1" -eu $(pwd) --verbose /usr/bin
+printf ${HOME} printf 'quoted text' echo ${HOME} "$@" $(pwd) $(pwd)
+	awk printf test 'quoted text'
+	awk ${HOME} ${HOME} --verbose
+awk -eu local echo "$1" cd cd && $(pwd) 'quoted text'
+x=1 printf grep /usr/bin x=1 | -eu /usr/bin sed printf echo && /usr/bin awk
+&& | $(pwd) && 'quoted text' $(pwd) -eu 2>/dev/null
+		${HOME} test "$1" 'quoted text'
+| $(pwd) "$1" sed awk export && /usr/bin printf
+	sed cd --verbose printf printf cd grep 2>/dev/null -eu
+		${HOME} | readonly readonly grep grep grep "$@" done done test test ${HOME}
+grep local grep local readonly done -eu /usr/bin test then
+awk printf "$1" -eu readonly /usr/bin grep local then export then export /usr/bin
+		sed /usr/bin x=1 $(pwd) sed
+cd local | 'quoted text' /usr/bin | export $(pwd) x=1
+	-eu "$@" done | export x=1 "$@" ${HOME} readonly | /usr/bin ${HOME} cd
+		${HOME} sed awk --verbose echo $(pwd) export ${HOME} 'quoted text' -eu | awk grep
+cd echo --verbose -eu /usr/bin grep "$@" echo $(pwd) $(pwd) &&
+2>/dev/null printf | local echo export $(pwd)
+local cd echo grep test cd local /usr/bin
+done cd readonly && x=1 x=1 test readonly test
+printf printf cd -eu echo then awk grep then --verbose done 'quoted text'
+	2>/dev/null done local done $(pwd) then grep export x=1 /usr/bin | -eu
+		2>/dev/null echo ${HOME} --verbose local grep echo ${HOME}
+		printf cd 2>/dev/null
+		test test then readonly 2>/dev/null awk --verbose x=1 "$1" cd
+	grep $(pwd) cd echo export
+'quoted text' grep local "$@" done printf x=1 "$1" "$1" "$@" --verbose && printf
+		export "$1" -eu then test x=1 "$1"
+	cd $(pwd) "$@" cd --verbose done echo --verbose then export local
+		grep grep local $(pwd) --verbose
+	printf export grep sed local | -eu
+		'quoted text' echo "$1" printf x=1 cd --verbose cd awk ${HOME}
+	sed -eu printf test cd | $(pwd) printf awk "$@" -eu awk export "$@" then
+	x=1 ${HOME} test 2>/dev/null "$@" sed readonly export /usr/bin
+	"$1" grep sed local printf local readonly
+		echo export "$1" 'quoted text' x=1 'quoted text'
+		/usr/bin /usr/bin local
+	2>/dev/null then export test local export awk test --verbose 2>/dev/null
+	readonly test sed /usr/bin printf -eu sed export
+		local "$@" then then grep done echo /usr/bin done 'quoted text' "$@" export test
+$(pwd) 2>/dev/null grep --verbose done
+	"$1" 'quoted text' printf local
+awk grep /usr/bin x=1 /usr/bin test awk x=1 export /usr/bin
+	| then sed $(pwd) 'quoted text' awk local done
+		then "$@" /usr/bin awk test done -eu /usr/bin done done "$@" && export
+	then | test grep echo echo /usr/bin 'quoted text' sed && --verbose awk --verbose
+	cd export --verbose printf $(pwd) then ${HOME} export
+	/usr/bin then $(pwd) 2>/dev/null readonly 2>/dev/null
+		readonly $(pwd) then x=1 awk /usr/bin
+		&& then "$1" test printf done then test readonly readonly cd grep "$1" done export
+/usr/bin readonly 2>/dev/null grep test "$@" /usr/bin --verbose
+		"$@" export export --verbose 2>/dev/null
+		${HOME} "$@" 'quoted text' awk ${HOME} sed --verbose "$1"
+printf --verbose sed cd grep 'quoted text' && done x=1 sed
+		printf --verbose printf local test x=1 | awk
+		'quoted text' printf --verbose /usr/bin
+	-eu readonly 2>/dev/null && "$@" /usr/bin "$@" && sed --verbose 'quoted text'
+printf --verbose --verbose cd -eu cd ${HOME} -eu
+	2>/dev/null 'quoted text' echo $(pwd) then 2>/dev/null sed x=1 2>/dev/null export
+grep done cd "$1" awk --verbose grep grep "$@" $(pwd)
+	export $(pwd) 2>/dev/null
+		then x=1 ${HOME} && 2>/dev/null
+	"$1" grep echo && test export $(pwd) | ${HOME} echo 2>/dev/null
+		printf echo local ${HOME} && sed printf --verbose -eu
+		'quoted text' 'quoted text' done cd printf "$@"
+	done cd "$@" "$@" readonly "$1"
+$(pwd) | 'quoted text' --verbose test /usr/bin 2>/dev/null grep
+'quoted text' "$@" "$1" local cd x=1 | -eu grep cd 'quoted text'
+printf --verbose echo cd echo x=1 cd readonly "$@" --verbose
+	${HOME} printf export then -eu printf "$1" echo
+		/usr/bin -eu sed printf test && export
+	&& "$@" test 2>/dev/null
+		"$@" then --verbose -eu printf local export printf awk readonly cd ${HOME}
+		2>/dev/null local | "$1" 'quoted text' $(pwd) export export -eu cd $(pwd) sed
+&& readonly grep done "$@" "$1" test
+		2>/dev/null 'quoted text' | sed sed cd then --verbose then grep
+	'quoted text' export printf ${HOME} then x=1 |
+awk x=1 printf test /usr/bin
+awk readonly awk ${HOME} test $(pwd) && && && test "$1" echo "$@" &&
+	'quoted text' test then printf && echo
+	sed local && && --verbose "$@" done
+/usr/bin --verbose 'quoted text' --verbose 'quoted text' ${HOME} ${HOME} 2>/dev/null
+		$(pwd) local ${HOME} grep local
+echo x=1 "$@" | sed /usr/bin 'quoted text' "$1" $(pwd)
+	test /usr/bin test --verbose 'quoted text' 2>/dev/null
+		| | export then -eu 'quoted text' export readonly 2>/dev/null
+	${HOME} -eu printf -eu printf grep grep && 'quoted text'
+	awk then done "$@" awk done readonly x=1 /usr/bin then echo awk ${HOME} readonly
+	x=1 readonly 'quoted text' 'quoted text' "$1"
+export -eu grep -eu awk readonly then && | /usr/bin "$@" -eu
+	grep printf test export -eu x=1 printf --verbose ${HOME} awk && cd | "$1" local
+	export && export local readonly export then done -eu echo done export
+"$@" sed | "$@" /usr/bin -eu readonly printf --verbose
+	sed then cd -eu readonly export | x=1 x=1 |
+	test grep grep cd done awk x=1 local sed readonly "$@" done 'quoted text' readonly
+	$(pwd) then | 'quoted text' x=1 /usr/bin 'quoted text' 'quoted text'
+		grep readonly done export export sed grep /usr/bin export echo grep sed printf
+	2>/dev/null /usr/bin $(pwd) printf cd
+		&& grep awk then x=1 then export sed /usr/bin "$1" && 'quoted text'
+	grep readonly ${HOME} cd echo local done ${HOME} sed cd
+readonly done 'quoted text' cd
+	test --verbose ${HOME} x=1 -eu x=1 x=1 "$1" cd then -eu printf grep sed
+--verbose 'quoted text'
+cd && local 'quoted text'
+cd then --verbose "$1" && | local
+printf "$@" local printf local x=1 ${HOME} export sed readonly readonly echo grep
+	export grep grep readonly "$1" readonly $(pwd) echo printf readonly echo then
+"$1" awk export | 2>/dev/null "$@" grep && echo -eu ${HOME} ${HOME} done grep local
+done readonly printf && && 'quoted text'
+		&& | cd export -eu test readonly printf $(pwd) /usr/bin
+		test cd 2>/dev/null $(pwd)
+	'quoted text' readonly "$@" cd test x=1
+	/usr/bin && test grep local
+export x=1 | 'quoted text' printf --verbose "$1" $(pwd) test
+x=1 "$1" $(pwd) done then grep echo "$@"
+		local && 2>/dev/null &&
+		x=1 done && export echo --verbose
+'quoted text' ${HOME} --verbose
+	export $(pwd) cd awk --verbose test echo 'quoted text' ${HOME}
+	-eu 2>/dev/null readonly | done ${HOME} awk sed 'quoted text' --verbose
+	awk cd cd echo && "$1" readonly
+then --verbose | 'quoted text' cd 'quoted text' x=1 2>/dev/null $(pwd)
+		| test test sed local && awk
+&& ${HOME} cd local $(pwd) awk done 'quoted text' 2>/dev/null echo sed printf
+	local grep /usr/bin -eu grep cd readonly printf && | done sed echo
+echo echo test cd 'quoted text' ${HOME} then awk local then cd export
+	"$@" --verbose readonly local export readonly then grep grep cd
+	'quoted text' test ${HOME} "$1" -eu cd "$1"
+	$(pwd) cd x=1 done $(pwd) awk x=1 x=1 'quoted text' then
+	printf 'quoted text' /usr/bin awk sed "$1" 'quoted text' grep
+		cd "$1" | then && | then sed ${HOME} | --verbose
+test local done grep /usr/bin ${HOME} local -eu "$@"
+		export cd readonly echo export readonly
+		printf --verbose | $(pwd) then
+	| --verbose x=1 local ${HOME} "$@" -eu local grep --verbose
+sed cd sed done 'quoted text'
+		test export "$@" export done local $(pwd) x=1 /usr/bin then then -eu grep /usr/bin
+'quoted text' then ${HOME} done awk done echo x=1 sed 2>/dev/null
+	--verbose then --verbose $(pwd) then -eu awk then $(pwd) readonly $(pwd)
+		awk then --verbose local 2>/dev/null awk
+2>/dev/null -eu $(pwd) ${HOME} cd then awk local ${HOME} done --verbose
+test cd --verbose then echo "$1"
+	done done done ${HOME} export done export $(pwd) --verbose printf
+	${HOME} readonly | 2>/dev/null awk cd "$@" sed grep | then x=1 printf
+	printf $(pwd) local "$1" done sed "$@" x=1 printf
+	local grep readonly /usr/bin cd grep | /usr/bin test then readonly 'quoted text'
+	test readonly local x=1 ${HOME} cd "$@" export x=1 echo
+"$1" cd "$1" done cd 2>/dev/null $(pwd) export cd 'quoted text'
+		'quoted text' && -eu "$1" export grep export 2>/dev/null cd && 'quoted text'
+	sed printf echo 'quoted text' readonly "$@" ${HOME} readonly export sed
+		-eu local 'quoted text' $(pwd)
+local echo "$1" "$@" --verbose awk sed --verbose && $(pwd) export local test
+x=1 test test then printf "$@" "$@" done test grep 'quoted text'
+	cd cd --verbose && local cd -eu local
+	"$1" cd 'quoted text' 'quoted text'
+		${HOME} printf --verbose 'quoted text' -eu x=1 cd -eu local echo "$1" 'quoted text'
+	then | grep --verbose test 'quoted text'
+		-eu /usr/bin --verbose done readonly
+		done awk awk then test local 'quoted text' then /usr/bin printf cd done
+	'quoted text' cd awk test /usr/bin local --verbose /usr/bin printf $(pwd) ${HOME}
+		2>/dev/null x=1 'quoted text' export 2>/dev/null grep "$1" export ${HOME} cd -eu
+		awk grep sed local x=1 echo "$1" printf x=1 then sed sed "$1" readonly
+		--verbose printf printf awk 'quoted text' sed grep --verbose echo cd "$@" cd test
+	cd grep "$@" | /usr/bin "$1" --verbose cd && printf /usr/bin
+		&& sed ${HOME} export "$1" grep -eu "$@" x=1
+	${HOME} readonly /usr/bin then test && | | $(pwd)
+printf awk echo -eu -eu test then local "$1" /usr/bin grep
+x=1 echo printf done printf | done 2>/dev/null cd sed "$@" "$1" export
+		-eu | 'quoted text' sed "$1" && printf 2>/dev/null readonly $(pwd)
+then ${HOME} 2>/dev/null local then && 2>/dev/null readonly
+$(pwd) cd 'quoted text' done cd 'quoted text' export && 2>/dev/null 2>/dev/null
+printf sed done readonly sed done --verbose readonly
+echo && done -eu 'quoted text' echo
+		grep $(pwd) awk -eu /usr/bin sed
+printf readonly local awk then
+echo | && x=1 /usr/bin export test /usr/bin
+done sed && "$1" x=1 'quoted text'
+		--verbose awk "$1" awk 2>/dev/null /usr/bin ${HOME}
+	x=1 local && "$1" | --verbose then ${HOME} -eu
+		test local cd "$@" ${HOME} cd grep 'quoted text' $(pwd) ${HOME}
+	2>/dev/null cd grep "$1" --verbose -eu ${HOME} sed
+		x=1 --verbose readonly /usr/bin sed --verbose sed
+done "$@" readonly export
+	test ${HOME} awk grep /usr/bin x=1 echo -eu test printf x=1 --verbose
+	sed | cd printf done 'quoted text' sed grep sed | then readonly awk &&
+export 2>/dev/null sed "$1" then done 'quoted text'
+	echo test then $(pwd) | /usr/bin echo local -eu $(pwd) "$1" && then "$@" && -eu
+export printf x=1 grep --verbose cd ${HOME} "$@" test
+/usr/bin local cd x=1 | "$@" 'quoted text' /usr/bin
+	$(pwd) cd sed local 2>/dev/null -eu printf 2>/dev/null
+${HOME} ${HOME} awk /usr/bin export -eu 2>/dev/null local test
+x=1 then $(pwd) "$@" echo sed sed then printf /usr/bin echo --verbose
+--verbose "$1" /usr/bin export sed printf readonly
+		then /usr/bin "$1" && printf
+	echo done "$1" /usr/bin readonly printf -eu test grep echo export
+		grep cd ${HOME} ${HOME} $(pwd) readonly
+readonly --verbose test cd "$@" export local
+then "$1" x=1 'quoted text' awk done 'quoted text' cd --verbose
+2>/dev/null then printf sed grep sed done printf
+	done 'quoted text' then test then | done done 'quoted text' awk $(pwd) "$@"
+	cd readonly export grep done then "$1" awk 'quoted text' "$@" "$@" printf
+"$@" grep sed done printf cd 'quoted text' | local local printf
+		$(pwd) echo cd local grep && $(pwd) $(pwd) "$1" export "$@" printf
+test && cd x=1 $(pwd) echo $(pwd) -eu printf x=1 2>/dev/null then awk --verbose
+		echo sed printf local awk 'quoted text' local $(pwd) echo 'quoted text'
+		printf sed "$1" export cd ${HOME} 2>/dev/null printf printf "$@" $(pwd)
+	'quoted text' "$@" 'quoted text' grep export
+	readonly && "$1" x=1 x=1 echo test echo done
+		cd awk x=1 cd awk then --verbose sed cd -eu printf cd readonly $(pwd) then then
+		grep | | export -eu 'quoted text' echo cd echo --verbose then "$1"
+printf | then sed test ${HOME} local --verbose
+	&& grep /usr/bin "$@" printf /usr/bin ${HOME}
+"$1" | done done "$@" local echo && sed
+	"$@" 'quoted text' "$1" export
+	local printf export 2>/dev/null "$@" --verbose
+	done $(pwd) x=1 cd --verbose /usr/bin 2>/dev/null readonly export
+	grep printf "$@" --verbose 'quoted text' -eu grep then "$1" printf --verbose done
+	echo awk "$@" --verbose && export test x=1 printf 2>/dev/null x=1 x=1
+printf | sed cd /usr/bin "$@" done
+	-eu done grep export printf 2>/dev/null
+	'quoted text' 2>/dev/null printf $(pwd) $(pwd) && done "$1" | printf
+		readonly 'quoted text' awk printf
+| x=1 test then local && 2>/dev/null ${HOME}
+sed done then $(pwd) sed 'quoted text' --verbose printf
+$(pwd) export readonly done test ${HOME}
+		cd && cd ${HOME} awk local "$1" grep readonly local printf
+		printf test | cd | && local grep export grep grep
+	/usr/bin 2>/dev/null done $(pwd) /usr/bin export done --verbose readonly
+	export 'quoted text' /usr/bin then --verbose done /usr/bin
+	${HOME} 'quoted text' /usr/bin | grep ${HOME} && ${HOME} local done
+		--verbose "$1" /usr/bin sed ${HOME} readonly
+&& 2>/dev/null then 'quoted text' sed --verbose 2>/dev/null x=1 then export
+		done 2>/dev/null cd test
+local --verbose -eu 2>/dev/null export grep x=1 done
+readonly 'quoted text' "$@"
+	local local cd export && /usr/bin
+2>/dev/null cd x=1 2>/dev/null awk /usr/bin && sed 2>/dev/null | -eu &&
+	| | readonly grep $(pwd) done echo cd
+	grep "$1" cd --verbose | -eu x=1 awk cd done "$@" --verbose
+done /usr/bin sed awk done readonly "$@" sed | --verbose
+		x=1 awk x=1 printf grep then echo
+| echo sed readonly then | done cd "$@" 'quoted text' done echo
+	echo "$@" cd then 'quoted text' -eu test | cd sed test cd sed "$@"
+		--verbose $(pwd) /usr/bin --verbose 2>/dev/null echo
+test -eu x=1 grep "$1" ${HOME} "$@" && 2>/dev/null x=1
+x=1 done export test |
+		local cd local ${HOME} && cd /usr/bin local test awk awk 'quoted text'
+		&& cd x=1 /usr/bin test grep 2>/dev/null $(pwd)
+		x=1 sed && $(pwd) sed done printf "$@" test awk
+sed export test "$@" $(pwd) echo grep --verbose
+		$(pwd) cd "$1" readonly readonly awk $(pwd) echo
+awk -eu ${HOME} local grep "$@" echo
+local then awk printf --verbose cd && then 'quoted text' printf
+	&& local grep export then printf --verbose awk printf ${HOME}
+	'quoted text' echo && ${HOME} echo sed /usr/bin readonly grep sed done local ${HOME}
+		export /usr/bin echo "$1" export
+		export cd export then local export local grep $(pwd) $(pwd)
+		export test local $(pwd) cd cd --verbose -eu "$1" grep sed
+awk $(pwd) "$1" /usr/bin x=1 ${HOME} 'quoted text' printf done x=1 -eu done
+		"$@" && grep then grep local printf printf --verbose
+	export printf test test test cd
+&& && ${HOME} grep grep "$1" "$@" -eu --verbose
+"$1" then export x=1 printf ${HOME}
+cd then $(pwd) ${HOME} --verbose
+	| 'quoted text' && grep printf
+	--verbose "$@" 'quoted text' "$1" awk x=1 /usr/bin readonly --verbose /usr/bin
+&& test local echo /usr/bin | ${HOME} echo "$1" "$@"
+"$@" && --verbose /usr/bin local && 'quoted text' 'quoted text' $(pwd) 'quoted text'
+"$1" cd local $(pwd) 2>/dev/null 'quoted text' "$1" sed printf
+	x=1 echo ${HOME} test printf /usr/bin
+		"$@" ${HOME} test --verbose
+		cd 2>/dev/null x=1 awk sed echo 'quoted text' grep $(pwd)
+	readonly 'quoted text' readonly cd then &&
+	then "$1" x=1 | echo "$@" awk printf --verbose local "$1" awk cd "$1" -eu
+	"$1" && grep done grep x=1 local export
+		local "$@" grep && local readonly then -eu "$1" test
+	${HOME} echo readonly "$1" ${HOME} ${HOME} $(pwd) --verbose
+		printf --verbose sed done grep
+		export $(pwd) /usr/bin local x=1 readonly test "$1" awk cd test &&
+		printf "$1" --verbose ${HOME} /usr/bin | export
+done 'quoted text' test $(pwd) cd -eu
+		test printf 2>/dev/null test ${HOME} --verbose 'quoted text'
+2>/dev/null x=1 /usr/bin -eu grep
+		awk echo printf local grep /usr/bin local
+		printf local printf "$1" readonly
+		cd grep then test && | "$@" local readonly 2>/dev/null && grep | $(pwd)
+-eu /usr/bin && then printf sed | "$@" /usr/bin | then /usr/bin && readonly
+&& local --verbose x=1 x=1 then then --verbose x=1 x=1 --verbose
+		cd /usr/bin ${HOME} printf then --verbose
+		echo printf && grep |
+'quoted text' "$@" && test
+		&& local $(pwd) done 'quoted text' && x=1 export "$1" 'quoted text'
+export && x=1 sed grep cd 'quoted text'
+		x=1 "$@" sed /usr/bin local | awk --verbose local | /usr/bin && export
+		--verbose then done --verbose /usr/bin done 2>/dev/null 2>/dev/null readonly
+"$1" "$@" && done x=1 --verbose grep export 2>/dev/null sed
+sed "$@" && printf awk 'quoted text' readonly "$1" "$1" export then
+	${HOME} --verbose $(pwd) "$1" cd then done grep ${HOME} x=1 local --verbose
+	${HOME} grep -eu && printf "$@" --verbose -eu done
+'quoted text' cd grep | "$1" | then grep "$1"
+sed then test ${HOME} --verbose --verbose /usr/bin
+	&& grep echo "$@" x=1 grep 'quoted text'
+	awk $(pwd) cd sed sed
+		printf readonly /usr/bin --verbose readonly awk $(pwd)
+	| 'quoted text' cd 2>/dev/null && test $(pwd) sed x=1 awk grep printf cd 2>/dev/null
+	sed --verbose grep 2>/dev/null cd ${HOME} sed x=1
+	grep -eu then export local
+	done 'quoted text' readonly cd sed /usr/bin
+		export readonly grep ${HOME} printf -eu printf
+--verbose done echo 'quoted text'
+	sed then awk then /usr/bin x=1 && x=1 readonly
+	local && grep then /usr/bin && --verbose sed 2>/dev/null $(pwd) readonly 'quoted text'
+		--verbose local "$@" printf local local "$1" awk done && grep 2>/dev/null && x=1
+	&& grep grep 2>/dev/null
+		grep echo "$1" "$1" grep cd | local sed export printf
+grep x=1 awk test -eu 'quoted text' x=1 awk readonly grep
+	--verbose --verbose printf echo 'quoted text' done readonly then "$1" local &&
+"$1" sed | export "$1" awk export /usr/bin test
+	awk local grep ${HOME} sed local grep echo readonly cd
+		sed export $(pwd) readonly 'quoted text' -eu readonly then sed x=1 'quoted text'
+	&& done --verbose printf done sed cd then
+		2>/dev/null && 'quoted text' --verbose x=1 local
+	| "$1" 'quoted text' awk ${HOME}
+	done export sed /usr/bin echo done --verbose then /usr/bin
+	${HOME} readonly cd $(pwd) local "$@" -eu echo readonly
+		&& --verbose local /usr/bin
+test -eu then export sed local printf | grep local /usr/bin readonly
+	${HOME} test $(pwd) "$@"
+	sed 2>/dev/null export local $(pwd)
+export ${HOME} x=1 $(pwd) grep 2>/dev/null
+		"$@" printf 2>/dev/null 'quoted text' printf
+		done export cd grep 2>/dev/null test $(pwd) cd && awk
+-eu 'quoted text' then readonly "$@" printf
+then awk 2>/dev/null cd x=1 local --verbose grep echo then
+		${HOME} && awk | local cd local sed "$@" 2>/dev/null
+		-eu test $(pwd) 2>/dev/null done readonly readonly export readonly "$1" sed
+"$@" "$@" $(pwd) local &&
+		${HOME} -eu x=1 | 2>/dev/null && test ${HOME} sed then readonly grep readonly
+		"$@" -eu printf sed "$1" cd local
+	--verbose cd test --verbose x=1 printf 2>/dev/null then "$@" awk "$@"
+sed --verbose 2>/dev/null
+cd $(pwd) grep 'quoted text' cd test local 2>/dev/null readonly "$@" "$1"
+		${HOME} local x=1 local then && $(pwd) printf -eu then done "$@" cd
+2>/dev/null readonly readonly $(pwd) 'quoted text' readonly 'quoted text'
+		2>/dev/null && --verbose then "$@" && ${HOME} then readonly
+readonly awk 'quoted text' "$@" /usr/bin "$1" -eu local
+		cd readonly awk local --verbose 'quoted text' 'quoted text' export
+	| test --verbose --verbose
+		"$1" test ${HOME} local cd awk grep $(pwd)
+printf local sed export printf readonly "$1" 2>/dev/null 'quoted text'
+sed cd "$1" ${HOME} -eu
+	done done | sed export cd | "$1" 'quoted text' 2>/dev/null |
+-eu awk $(pwd) "$@" local
+		/usr/bin --verbose echo done cd
+	-eu echo then "$@" ${HOME} local test $(pwd)
+	then done -eu printf | sed $(pwd) done test echo awk
+cd -eu $(pwd) ${HOME} ${HOME} 2>/dev/null
+		--verbose grep done -eu "$@" export printf
+printf "$1" printf printf then
+	--verbose "$@" $(pwd) 'quoted text' sed /usr/bin
+cd $(pwd) printf done cd awk && x=1 x=1 ${HOME} export x=1
+$(pwd) 'quoted text' && "$@" $(pwd) ${HOME} cd then done -eu /usr/bin "$1" grep
+	/usr/bin $(pwd) ${HOME} && printf x=1 --verbose grep local && $(pwd) grep
+test then -eu echo ${HOME}
+	grep ${HOME} awk done 'quoted text'
+	sed grep --verbose test awk sed 'quoted text'
+| "$@" then && sed x=1 sed awk 'quoted text' "$1" test then awk test "$@"
+		&& grep echo 'quoted text' |
+then local local $(pwd) cd grep local ${HOME} printf "$@" /usr/bin 'quoted text'
+		2>/dev/null printf ${HOME} -eu then echo 2>/dev/null printf readonly
+-eu ${HOME} | done grep -eu cd 2>/dev/null | $(pwd) grep
+	printf cd awk "$@" $(pwd) sed 2>/dev/null export 'quoted text' $(pwd) --verbose
+readonly | -eu -eu ${HOME} grep "$1" done printf echo readonly
+		&& echo 2>/dev/null cd test -eu printf readonly printf sed printf test test &&
+	cd printf awk $(pwd) echo $(pwd) /usr/bin 2>/dev/null test done
+		$(pwd) --verbose printf && | "$@" /usr/bin 'quoted text' awk $(pwd) local 'quoted text'
+"$@" -eu printf done echo --verbose
+/usr/bin 2>/dev/null readonly 'quoted text' printf
+		echo $(pwd) 'quoted text' done --verbose /usr/bin
+		$(pwd) 'quoted text' /usr/bin "$@" then grep printf "$1" local 2>/dev/null
+	then test grep -eu /usr/bin x=1 --verbose
+	local | awk --verbose sed | local --verbose
+		$(pwd) echo ${HOME} /usr/bin
+	"$1" export test test test -eu done done "$1" 2>/dev/null
+		export sed grep echo "$@" "$@" --verbose ${HOME} echo -eu 2>/dev/null "$1" && grep
+x=1 | x=1 printf export cd
+	awk printf grep | | sed done --verbose
+	done --verbose local printf &&
+		readonly test cd export printf awk done echo ${HOME} /usr/bin
+		$(pwd) echo then -eu && printf x=1 -eu cd readonly local cd -eu "$1"
+	| done /usr/bin 'quoted text'
+$(pwd) test cd awk /usr/bin printf local local | then local x=1 awk $(pwd)
+		done export readonly $(pwd) export sed --verbose $(pwd) --verbose | test --verbose
+		printf readonly printf && $(pwd) readonly
+		cd echo 2>/dev/null test -eu done "$@" awk | done
+printf local && export
+		${HOME} then local | ${HOME}
+	local 'quoted text' then printf sed cd then && done
+	test x=1 echo awk && | done then
+		"$1" test awk $(pwd) --verbose
+done ${HOME} && printf test
+		-eu echo "$@" | "$@" --verbose
+then 'quoted text' export x=1 then then 'quoted text' x=1 "$@"
+${HOME} echo "$1" awk "$1" readonly printf sed local x=1 then
+&& then /usr/bin then "$1" test readonly test sed test
+	awk /usr/bin --verbose printf
+		then 2>/dev/null -eu $(pwd)
+${HOME} && printf then
+	local && "$1" -eu echo cd ${HOME} 'quoted text' --verbose
+"$@" readonly && printf export 'quoted text' readonly then
+/usr/bin ${HOME} echo 'quoted text' printf 2>/dev/null
+	sed printf $(pwd) $(pwd)
+x=1 2>/dev/null | export sed echo
+"$@" "$@" echo 'quoted text'
+	-eu ${HOME} /usr/bin $(pwd)
+		echo test $(pwd) x=1 "$@" printf $(pwd)
+	grep readonly cd then export grep awk done echo 'quoted text'
+		/usr/bin --verbose then cd test done test && readonly
+-eu grep 2>/dev/null local -eu test printf awk done echo ${HOME}
+echo cd ${HOME} readonly x=1 $(pwd) -eu
+echo -eu x=1 x=1 'quoted text'
+echo $(pwd) | echo && printf printf cd
+		then --verbose export && sed 2>/dev/null $(pwd) /usr/bin done -eu echo
+	export sed "$@" ${HOME} sed done /usr/bin | --verbose
+	x=1 --verbose $(pwd) readonly && x=1 then -eu echo readonly cd
+	| export grep ${HOME} then "$1" grep awk test echo then test echo x=1 cd 2>/dev/null
+		awk && test then "$1" $(pwd) /usr/bin && | test
+		| -eu "$1" done then $(pwd) "$1" "$1" readonly x=1
+		'quoted text' 'quoted text' 'quoted text'
+	--verbose readonly $(pwd) /usr/bin then grep sed --verbose 2>/dev/null cd /usr/bin
+		/usr/bin done && grep "$1"
+		'quoted text' $(pwd) | /usr/bin then readonly echo && && $(pwd)
+then local grep sed printf $(pwd) done ${HOME} awk
+	${HOME} ${HOME} awk "$1" && -eu printf -eu
+	grep ${HOME} readonly $(pwd) readonly --verbose 2>/dev/null
+-eu echo && done 2>/dev/null cd echo && x=1 "$1" grep echo readonly "$@"
+	${HOME} cd -eu printf ${HOME} printf awk 'quoted text' then readonly
+	readonly $(pwd) awk /usr/bin readonly
+	sed grep grep cd echo && "$@" export done printf sed
+done printf 2>/dev/null "$1" then then 2>/dev/null 'quoted text' then
+done echo --verbose ${HOME} 'quoted text' readonly grep export export test x=1
+		-eu awk /usr/bin 2>/dev/null ${HOME} --verbose && 2>/dev/null
+		done done && --verbose $(pwd) test "$@"
+'quoted text' local then export 'quoted text' --verbose
+	local awk -eu ${HOME} local "$1" --verbose
+2>/dev/null done /usr/bin | && readonly
+	${HOME} ${HOME} 2>/dev/null export "$1" echo 2>/dev/null
+printf && awk && -eu /usr/bin ${HOME} export $(pwd) grep x=1
+	then then $(pwd) sed "$1" x=1 cd test done echo awk
+		then 2>/dev/null cd /usr/bin readonly $(pwd) cd then $(pwd)
+		"$@" /usr/bin done ${HOME}
+	"$1" awk sed "$@" 2>/dev/null local then 2>/dev/null --verbose test printf
+		done 'quoted text' grep | 2>/dev/null export then "$@"
+		printf cd test $(pwd) printf $(pwd) -eu readonly sed grep printf
+		then "$@" --verbose export
+	export local && echo && cd sed --verbose ${HOME}
+		-eu --verbose grep printf
+	-eu sed readonly export readonly 2>/dev/null cd echo && readonly
+${HOME} done echo "$@" local "$@" 'quoted text' sed /usr/bin
+&& "$1" readonly echo sed sed x=1
+	${HOME} 'quoted text' cd test printf
+	awk "$1" -eu test --verbose test
+		grep 'quoted text' grep sed sed | && 'quoted text' local | printf awk cd --verbose
+	"$@" "$@" test done test grep
+-eu local -eu then grep grep ${HOME} --verbose
+		--verbose sed x=1 /usr/bin x=1 --verbose | "$@" "$@" && "$1" && "$1"
+	$(pwd) awk local then --verbose echo
+readonly | "$1" 2>/dev/null "$@" | then && readonly then $(pwd) && ${HOME}
+	2>/dev/null 'quoted text' then 2>/dev/null /usr/bin awk 'quoted text'
+		'quoted text' done /usr/bin printf test ${HOME}
+	x=1 --verbose ${HOME} readonly 'quoted text' /usr/bin readonly
+local "$1" && x=1 sed "$@" 2>/dev/null $(pwd) x=1
+		cd /usr/bin --verbose readonly readonly | 'quoted text' x=1 done export
+		readonly awk sed done then echo 2>/dev/null "$1" then local x=1 then printf readonly
+		grep export cd then 'quoted text' && ${HOME} done && -eu test
+	sed echo echo awk test ${HOME} echo printf x=1 "$@" && "$@" $(pwd) | && grep 'quoted text'
+		&& grep | && && echo sed ${HOME} done export cd | -eu then sed ${HOME} cd local
+	2>/dev/null printf "$1" test $(pwd) --verbose
+	x=1 | done then local
+	| /usr/bin -eu done --verbose $(pwd) echo
+		--verbose sed cd "$@" sed "$@" grep /usr/bin && "$@" && $(pwd)
+		readonly x=1 | readonly done "$1" x=1 printf ${HOME}
+	$(pwd) done readonly export echo ${HOME} && "$@" -eu local /usr/bin | 2>/dev/null
+sed x=1 x=1 && cd 'quoted text' grep printf 'quoted text'
+$(pwd) "$1" cd test cd 'quoted text'
+grep test /usr/bin | test "$1" export "$1" test ${HOME} then
+	| then $(pwd) readonly "$1" ${HOME} export
+		'quoted text' awk readonly awk test 2>/dev/null echo "$@" $(pwd) cd grep sed "$@"
+	"$1" $(pwd) done x=1 ${HOME} test local printf awk echo x=1 $(pwd) $(pwd) local
+		cd -eu cd 'quoted text' ${HOME} "$1" -eu -eu cd local
+readonly readonly done done sed readonly readonly export /usr/bin
+		printf x=1 ${HOME} --verbose export x=1 $(pwd) -eu "$1"
+		--verbose "$@" readonly echo && then readonly printf done
+		"$@" local cd done "$@" done readonly && --verbose
+		grep then export done echo then awk 2>/dev/null x=1 then /usr/bin && -eu
+		test --verbose grep --verbose 'quoted text' ${HOME} grep
+		$(pwd) 2>/dev/null printf ${HOME} --verbose cd awk then 'quoted text'
+		"$1" done awk "$@" then "$1" "$1" done grep sed awk awk readonly
+	--verbose 2>/dev/null 'quoted text' awk "$@" export done echo sed
+	export printf && grep then then readonly then
+		-eu done awk --verbose | done sed echo 2>/dev/null 2>/dev/null
+	readonly then test | printf printf -eu grep test test printf ${HOME}
+	x=1 'quoted text' echo then | && local --verbose
+&& x=1 ${HOME} done local test 2>/dev/null ${HOME}
+	2>/dev/null cd done export export | export
+		printf test | sed grep x=1 echo x=1 sed /usr/bin local echo
+	${HOME} export export "$@" grep done readonly sed echo awk grep /usr/bin --verbose
+	'quoted text' cd export
+		cd --verbose "$@" -eu cd cd echo x=1 local
+	cd /usr/bin readonly 2>/dev/null test grep && done 'quoted text' -eu
+		| readonly x=1 | cd printf test readonly readonly "$@" ${HOME}
+		x=1 'quoted text' $(pwd) cd
+	sed -eu echo $(pwd) /usr/bin x=1 awk sed printf "$@" done
+&& "$@" local "$1" cd test ${HOME} awk printf /usr/bin grep then "$1" done
+	/usr/bin && | ${HOME} 'quoted text'
+"$@" local awk "$1" 2>/dev/null ${HOME} done -eu
+	done -eu 'quoted text' echo export && "$@" 'quoted text'
+/usr/bin /usr/bin && && test "$@"
+	x=1 "$1" --verbose 2>/dev/null -eu then then x=1 printf $(pwd) $(pwd)
+	--verbose 'quoted text' grep readonly $(pwd) local && done --verbose
+	x=1 awk "$@" "$1" ${HOME} 'quoted text'
+		done | readonly $(pwd) 'quoted text' "$1" readonly --verbose --verbose
+		/usr/bin cd -eu ${HOME} sed
+sed $(pwd) "$@" cd && local readonly 'quoted text'
+	${HOME} echo then sed /usr/bin printf -eu 2>/dev/null
+	x=1 grep test echo done --verbose printf
+	"$1" awk | cd done readonly
+	${HOME} "$@" awk 'quoted text' grep /usr/bin
+${HOME} cd grep 'quoted text' echo 'quoted text' /usr/bin $(pwd)
+	sed /usr/bin sed sed 'quoted text' echo grep done awk x=1 then then -eu awk -eu
+	awk readonly readonly test x=1 x=1 export sed $(pwd) &&
+local then printf echo readonly then /usr/bin ${HOME} x=1 "$1" echo export done
+	--verbose "$1" -eu then export ${HOME} && awk $(pwd) awk
+	'quoted text' "$1" x=1 2>/dev/null | sed test x=1 "$1" local "$@" printf
+/usr/bin test then 'quoted text' local
+	--verbose printf export test
+	test "$1" "$1" test echo export "$@" then done | /usr/bin printf $(pwd) ${HOME}
+export ${HOME} local ${HOME} | ${HOME} 2>/dev/null | && 2>/dev/null
+		test 2>/dev/null sed &&
+	local then --verbose then ${HOME} --verbose
+| "$@" | test && $(pwd) $(pwd) ${HOME}
+	readonly --verbose test 'quoted text'
+		awk echo 2>/dev/null 'quoted text' ${HOME} 'quoted text' && "$@" echo printf
+		&& then cd 'quoted text' printf "$1"
+		test /usr/bin $(pwd) x=1 'quoted text' "$@"
+$(pwd) grep export && -eu awk echo "$@" printf local "$@" $(pwd)
+"$1" $(pwd) /usr/bin "$1" /usr/bin test printf awk sed printf --verbose
+		"$@" 2>/dev/null 'quoted text' "$1"
+		test export ${HOME} cd ${HOME} x=1 | ${HOME} $(pwd) then local -eu done /usr/bin
+		local /usr/bin echo readonly then 'quoted text' $(pwd)
+		"$1" 'quoted text' x=1 2>/dev/null done /usr/bin $(pwd) $(pwd) 2>/dev/null
+		-eu printf readonly then test export echo | ${HOME} printf
+		-eu sed grep x=1 "$1" 2>/dev/null then
+'quoted text' done -eu
+		readonly local "$1" then
+then 'quoted text' && $(pwd) printf -eu awk sed local awk sed
+		/usr/bin readonly test && then readonly
+2>/dev/null export readonly test $(pwd) readonly x=1 "$@" sed x=1 done $(pwd)
+		2>/dev/null ${HOME} --verbose grep sed ${HOME} 2>/dev/null then 'quoted text'
+	"$1" 2>/dev/null cd grep --verbose echo grep "$@" && readonly export ${HOME}
+2>/dev/null done | echo /usr/bin awk "$1" /usr/bin
+&& test $(pwd) echo -eu
+		2>/dev/null ${HOME} -eu | test local x=1
+-eu ${HOME} echo local grep /usr/bin /usr/bin cd 2>/dev/null awk
+x=1 2>/dev/null $(pwd) -eu 2>/dev/null ${HOME}
+		cd printf 2>/dev/null 2>/dev/null $(pwd) | 2>/dev/null local grep grep
+		&& -eu export "$1" 2>/dev/null 2>/dev/null
+		printf then test --verbose printf export
+	printf $(pwd) sed test
@@ -0,0 +1,2001 @@
+	local /usr/bin /usr/bin test awk
+		"$1" "$1" | echo sed 'quoted text' 'quoted text'
+		printf local /usr/bin export | 2>/dev/null grep "$@" sed printf
+		-eu then sed 2>/dev/null done --verbose export sed done then -eu echo $(pwd) -eu
+	printf ${HOME} printf printf /usr/bin test cd x=1 cd then 'quoted text' sed
+	local echo 'quoted text' readonly export --verbose test
+--verbose 'quoted text' local -eu
+grep printf "$@" cd $(pwd) done local sed ${HOME} cd then "$@" $(pwd)
+sed -eu /usr/bin printf done 'quoted text' echo readonly cd echo
+'quoted text' test export awk export -eu && 2>/dev/null then sed cd local done
+	cd test test local local printf
+	-eu done x=1 printf && readonly awk grep "$@" then then x=1 export cd done cd grep
+$(pwd) $(pwd) 'quoted text' $(pwd) "$1" echo export
+		local $(pwd) local /usr/bin x=1 grep printf done
+	&& 2>/dev/null $(pwd) | test sed --verbose | /usr/bin
+		local done test "$1" local
+	'quoted text' x=1 $(pwd) 'quoted text'
+		${HOME} local "$@" /usr/bin 2>/dev/null
+	| awk | then --verbose sed local test cd x=1 $(pwd) echo printf /usr/bin 'quoted text'
+	cd 'quoted text' sed && x=1 grep && --verbose
+"$@" $(pwd) $(pwd) sed ${HOME} --verbose
+readonly awk then printf echo then cd sed $(pwd) "$@" readonly
+		cd | | --verbose readonly then done cd sed local $(pwd) | ${HOME} $(pwd) -eu
+	cd done x=1 && 'quoted text' 2>/dev/null
+done grep --verbose | export printf 2>/dev/null
+		'quoted text' sed printf awk ${HOME} readonly | then awk
+		local export echo local ${HOME} readonly cd && export awk -eu
+echo && | printf | readonly && $(pwd) -eu done local -eu echo export readonly
+	awk /usr/bin sed $(pwd) cd cd x=1 2>/dev/null printf then
+2>/dev/null export $(pwd) readonly ${HOME} sed
+	-eu $(pwd) 'quoted text' awk cd --verbose --verbose done printf --verbose
+awk printf $(pwd) | 'quoted text' readonly test --verbose
+	awk done readonly $(pwd) /usr/bin ${HOME}
+		local echo echo && test cd echo ${HOME}
+grep test 'quoted text' sed
+		echo 'quoted text' | local $(pwd) sed $(pwd) grep awk
+		done $(pwd) echo && 2>/dev/null x=1 2>/dev/null local
+sed local && awk ${HOME} --verbose 'quoted text' x=1 echo $(pwd) test /usr/bin 2>/dev/null
+	local export x=1 grep
+		readonly -eu && printf sed -eu -eu
+		grep ${HOME} "$@" export 2>/dev/null $(pwd)
+done awk && ${HOME} local done
+	-eu /usr/bin x=1 x=1 done echo local readonly
+/usr/bin ${HOME} readonly 2>/dev/null local export "$@" &&
+awk 2>/dev/null | --verbose $(pwd) then 'quoted text' /usr/bin sed --verbose
+$(pwd) x=1 ${HOME} "$@" -eu cd test && readonly local cd ${HOME} export $(pwd) done
+echo 2>/dev/null export local awk local $(pwd) awk 2>/dev/null
+"$1" | && cd readonly --verbose --verbose local /usr/bin "$@" && 'quoted text'
+		/usr/bin --verbose "$1" 2>/dev/null
+done x=1 --verbose $(pwd)
+export test && echo $(pwd) grep export && awk export readonly sed printf /usr/bin
+| echo cd echo "$@" test printf sed && echo -eu --verbose cd readonly
+		echo ${HOME} /usr/bin test --verbose done 'quoted text' && test
+2>/dev/null $(pwd) 'quoted text' sed && done
+sed then 2>/dev/null grep grep then echo $(pwd) x=1 2>/dev/null then "$@" test
+'quoted text' grep printf x=1 test awk --verbose sed export readonly test 'quoted text'
+/usr/bin "$@" 2>/dev/null 2>/dev/null --verbose
+		--verbose test local sed "$1" x=1 sed export printf "$@" "$1" -eu
+sed 2>/dev/null readonly grep export ${HOME} test
+		sed local test 2>/dev/null 'quoted text' && "$1" readonly
+	-eu x=1 /usr/bin then grep awk /usr/bin
+'quoted text' ${HOME} 2>/dev/null 2>/dev/null --verbose sed 'quoted text' | 2>/dev/null
+grep $(pwd) 2>/dev/null
+2>/dev/null awk 2>/dev/null
+		| readonly sed | local -eu "$@" "$@" then "$1" test cd printf 'quoted text' done
+		-eu "$@" done "$1" printf awk done
+2>/dev/null local "$@" 'quoted text' awk export readonly &&
+	'quoted text' done test
+grep test grep done $(pwd) 'quoted text'
+		--verbose test x=1 test | $(pwd) ${HOME}
+'quoted text' x=1 --verbose printf test && local then readonly
+grep ${HOME} "$@" local sed && "$1" printf ${HOME} then && echo x=1 readonly
+--verbose $(pwd) "$1" grep echo | /usr/bin /usr/bin /usr/bin
+"$1" -eu echo awk x=1 done ${HOME} 2>/dev/null
+done ${HOME} done cd $(pwd) $(pwd) cd
+--verbose cd 'quoted text' printf
+		"$@" then $(pwd) x=1 export grep $(pwd) x=1 | --verbose /usr/bin 'quoted text'
+		grep --verbose | --verbose echo -eu test -eu $(pwd) sed grep
+then test 2>/dev/null -eu echo --verbose echo $(pwd) ${HOME} --verbose
+		readonly readonly test && "$@" /usr/bin --verbose test
+"$1" sed sed $(pwd) | --verbose sed
+	$(pwd) sed printf "$1" ${HOME}
+	echo awk /usr/bin grep | "$@" | sed grep echo
+	-eu /usr/bin ${HOME} "$@" awk "$1" x=1
+		test "$1" echo cd --verbose
+	x=1 | export cd readonly local readonly --verbose awk 2>/dev/null 'quoted text'
+		done local echo cd && $(pwd) 2>/dev/null done x=1 && 'quoted text' $(pwd)
+x=1 awk 'quoted text' done test
+	$(pwd) done export /usr/bin "$@" -eu x=1 -eu cd grep ${HOME} "$@" "$1" -eu -eu
+		"$1" "$1" sed test printf -eu awk sed readonly 'quoted text'
+-eu then local | test printf test x=1 echo 2>/dev/null
+		--verbose ${HOME} sed test
+/usr/bin x=1 "$@" 2>/dev/null -eu then /usr/bin done export done done
+	$(pwd) $(pwd) test $(pwd) then sed readonly readonly then x=1 test test
+		test printf | /usr/bin printf 'quoted text' "$1" --verbose
+then x=1 /usr/bin ${HOME} local ${HOME} 2>/dev/null grep cd readonly awk
+awk /usr/bin 2>/dev/null ${HOME} echo awk "$1" export | 2>/dev/null
+&& grep --verbose 'quoted text' 'quoted text' --verbose
+		printf test then grep -eu grep sed cd /usr/bin grep done ${HOME}
+		"$@" export --verbose --verbose echo | cd x=1 'quoted text' readonly then 2>/dev/null
+test "$@" "$1" /usr/bin $(pwd) "$@" ${HOME}
+then echo echo test x=1 readonly 2>/dev/null sed readonly $(pwd) echo
+	"$1" "$@" echo /usr/bin | sed "$@" export 'quoted text' test && x=1 -eu ${HOME}
+"$@" printf printf sed test
+		x=1 awk printf readonly local --verbose && printf test done local
+	$(pwd) echo 'quoted text' local 2>/dev/null local grep cd | 2>/dev/null
+printf 2>/dev/null echo --verbose "$@" 'quoted text'
+		| 'quoted text' echo "$1" && 2>/dev/null then x=1 cd done local
+$(pwd) 'quoted text' done export -eu && x=1 x=1 "$@" -eu "$@" awk
+	--verbose grep x=1 export -eu readonly 'quoted text' 2>/dev/null
+		export cd then awk x=1 2>/dev/null "$@" && done sed x=1 sed 'quoted text' test
+&& sed ${HOME} readonly $(pwd) -eu 'quoted text' -eu "$@" 'quoted text' "$1" 'quoted text'
+x=1 printf sed 2>/dev/null grep local echo test cd local --verbose then awk done
+2>/dev/null grep 'quoted text' printf
+	test grep export cd $(pwd) grep 2>/dev/null local ${HOME} 2>/dev/null "$@" && /usr/bin
+	2>/dev/null x=1 done local "$@"
+	local $(pwd) cd then | --verbose
+	echo cd grep | done awk "$1" export printf
+cd ${HOME} test awk && x=1 sed $(pwd) ${HOME} echo -eu local printf grep
+		2>/dev/null 'quoted text' /usr/bin 'quoted text' --verbose /usr/bin cd readonly
+then && sed "$@" --verbose $(pwd) "$1" echo readonly 'quoted text'
+		| --verbose done local
+		&& cd done awk 2>/dev/null done grep cd x=1 "$@"
+		sed grep echo test /usr/bin echo
+	done grep /usr/bin ${HOME} && 2>/dev/null -eu "$1"
+	'quoted text' $(pwd) done $(pwd) $(pwd) x=1 -eu grep then echo
+	--verbose echo done ${HOME} echo echo readonly then printf $(pwd) --verbose
+| test export 'quoted text' "$1" printf ${HOME} cd then "$1" && &&
+	&& 'quoted text' cd printf cd sed "$1" echo readonly local
+		test grep && printf --verbose
+		echo sed cd --verbose printf sed test cd cd sed "$@" local local "$@"
+"$1" export 2>/dev/null ${HOME} ${HOME} grep sed readonly 'quoted text'
+	$(pwd) test ${HOME} cd "$1" awk grep done readonly
+readonly then -eu cd then cd | local local echo echo printf cd "$@" |
+cd local && test --verbose readonly 'quoted text' && 2>/dev/null && sed
+		done awk cd | "$@" readonly 2>/dev/null
+		x=1 -eu "$1" ${HOME} echo x=1 done /usr/bin
+	"$@" test then done --verbose local ${HOME} then $(pwd) sed cd readonly
+	$(pwd) "$@" && echo $(pwd) local $(pwd) --verbose done "$1" 2>/dev/null
+--verbose 'quoted text' grep "$@" sed --verbose
+	grep echo | "$1" -eu ${HOME} | ${HOME} readonly -eu
+	${HOME} awk 'quoted text' local -eu test 'quoted text' "$@" 'quoted text'
+echo grep awk 2>/dev/null readonly test echo "$1" test then
+		grep "$1" -eu awk cd then echo "$@" && echo 'quoted text' | && --verbose
+--verbose readonly ${HOME} cd && then sed done
+		export readonly cd | -eu sed local "$1" export -eu x=1 export /usr/bin --verbose
+sed then x=1 2>/dev/null done
+--verbose grep ${HOME} && cd readonly sed 2>/dev/null
+done sed export then cd test awk awk x=1 printf local test awk awk "$1" test | printf
+	awk printf -eu echo awk readonly "$@" done 'quoted text' sed test
+/usr/bin sed test cd /usr/bin export | 2>/dev/null awk echo
+		test && done done "$1" "$1" /usr/bin done
+		"$1" -eu local cd --verbose -eu x=1 --verbose
+echo cd grep sed /usr/bin | | --verbose awk --verbose
+	printf sed sed && done sed local awk grep
+		| grep echo --verbose "$1" echo 'quoted text' cd local awk grep "$@"
+		test local "$1" $(pwd)
+		| export awk grep "$1" x=1 awk sed done printf cd "$1"
+	--verbose sed readonly export $(pwd)
+'quoted text' 'quoted text' local ${HOME} --verbose done "$1" -eu && 'quoted text'
+	"$1" $(pwd) --verbose
+	2>/dev/null printf 'quoted text' "$@" local
+then | echo -eu grep "$1"
+sed 2>/dev/null 2>/dev/null cd then x=1 'quoted text' "$@" | "$1" cd local
+		--verbose 2>/dev/null 2>/dev/null x=1 grep sed -eu local readonly
+	echo x=1 cd then "$@" | cd 2>/dev/null "$1" -eu done then x=1
+		${HOME} --verbose grep readonly ${HOME} echo $(pwd) --verbose -eu "$1" $(pwd)
+	echo done | awk --verbose echo "$@" grep | readonly "$@" echo "$1" export /usr/bin
+"$1" done 'quoted text' cd awk then awk cd $(pwd) 'quoted text' grep $(pwd)
+		grep -eu x=1 readonly
+	"$1" export x=1 "$1" printf echo /usr/bin export
+	local cd "$@" local -eu -eu printf | sed
+	grep test "$1" x=1 done $(pwd) "$1" |
+		cd echo "$1" printf ${HOME} x=1 local $(pwd) printf then test printf /usr/bin
+	x=1 'quoted text' 'quoted text' "$1" echo cd echo
+'quoted text' export test $(pwd) --verbose grep -eu
+		export "$@" test -eu --verbose export printf 'quoted text' cd 2>/dev/null && echo
+		export ${HOME} printf readonly "$1" --verbose
+		then done local echo local local /usr/bin "$@" export grep local
+	local | awk sed /usr/bin 'quoted text' /usr/bin cd grep --verbose grep
+x=1 2>/dev/null ${HOME} grep | -eu test /usr/bin grep 'quoted text' printf
+		$(pwd) export -eu && 'quoted text' done readonly
+		test done printf $(pwd) | printf 'quoted text'
+	"$1" 'quoted text' /usr/bin done x=1 -eu ${HOME}
+	sed echo export $(pwd) 2>/dev/null -eu
+	readonly -eu readonly test
+	grep then readonly cd then x=1 printf 'quoted text' test 2>/dev/null sed 'quoted text'
+		readonly echo test printf done done 'quoted text' echo echo then printf
+$(pwd) done | /usr/bin test ${HOME} done then readonly "$@" && &&
+		--verbose $(pwd) "$@"
+	&& 'quoted text' | /usr/bin && done cd --verbose
+done "$1" x=1 readonly 2>/dev/null "$@" printf awk done $(pwd) test awk local local
+		echo | "$@" local -eu local | "$1" test awk done
+	| export echo then --verbose export $(pwd) && export
+readonly /usr/bin test grep "$@" then 'quoted text' /usr/bin && sed then
+sed echo /usr/bin "$@" sed then done 'quoted text' done x=1 export then 2>/dev/null
+$(pwd) sed "$@" ${HOME} -eu cd printf 2>/dev/null | "$1" readonly "$1" echo
+		--verbose 2>/dev/null cd --verbose x=1 /usr/bin readonly done $(pwd)
+'quoted text' local -eu test export "$@" then printf
+| ${HOME} "$@" awk cd export echo
+	/usr/bin /usr/bin | /usr/bin
+		cd /usr/bin echo awk test 2>/dev/null
+${HOME} readonly 2>/dev/null cd "$1" done "$@" grep "$@" x=1 readonly
+echo "$@" --verbose readonly -eu awk done local readonly | then --verbose grep cd
+		/usr/bin 2>/dev/null "$1" readonly x=1 awk sed 2>/dev/null
+	x=1 --verbose --verbose
+	test ${HOME} export grep done "$@" --verbose awk sed readonly
+	-eu | ${HOME} /usr/bin "$1" cd done --verbose
+local | cd sed /usr/bin grep printf -eu awk ${HOME} ${HOME} awk echo /usr/bin
+		2>/dev/null grep && 'quoted text' grep --verbose "$@"
+	/usr/bin awk then 2>/dev/null
+echo printf cd export "$1" test /usr/bin /usr/bin
+	| 'quoted text' readonly --verbose awk $(pwd) 'quoted text' $(pwd)
+"$@" local && printf | | cd done grep && local 2>/dev/null grep
+		grep | ${HOME} --verbose printf |
+'quoted text' then /usr/bin then echo ${HOME}
+		x=1 cd local test echo test
+local x=1 export /usr/bin && sed ${HOME} readonly
+done then x=1 2>/dev/null grep 2>/dev/null then printf printf sed done
+| ${HOME} "$@" awk then then | done echo | 2>/dev/null
+	local "$1" $(pwd) $(pwd) /usr/bin export cd -eu awk | test "$1" readonly
+	x=1 --verbose "$@" && x=1 done 2>/dev/null -eu ${HOME}
+		sed echo local | /usr/bin awk 'quoted text'
+	/usr/bin -eu export export awk $(pwd) export
+echo test "$1" test cd ${HOME} export ${HOME} local
+		-eu echo "$1" -eu sed cd done echo -eu then readonly x=1
+	--verbose echo awk grep && local x=1 sed -eu export
+		-eu && 'quoted text' "$1" printf 2>/dev/null grep
+		readonly local x=1 awk /usr/bin awk x=1 /usr/bin
+		/usr/bin $(pwd) export sed /usr/bin "$1" "$1" --verbose
+		&& awk readonly done then /usr/bin readonly local 'quoted text' awk sed "$@"
+		done export --verbose sed -eu && cd
+	x=1 awk sed x=1 | grep -eu readonly
+x=1 2>/dev/null awk done --verbose cd ${HOME} done
+		-eu awk ${HOME} "$1" done "$1" /usr/bin
+		'quoted text' sed && "$1" local | printf readonly "$@" export --verbose
+	echo printf && 2>/dev/null readonly echo printf
+		--verbose local "$@" /usr/bin then -eu export --verbose 2>/dev/null "$@"
+		awk done | x=1 --verbose ${HOME} readonly local local grep | export
+		sed then 2>/dev/null cd --verbose done test
+cd $(pwd) ${HOME} awk cd done /usr/bin cd cd
+done cd grep grep $(pwd) -eu local test 2>/dev/null $(pwd) | done cd grep local
+2>/dev/null test then --verbose && cd then
+'quoted text' 2>/dev/null 2>/dev/null
+		export export $(pwd) cd grep local awk x=1 test 2>/dev/null readonly then
+&& echo "$1" then export local /usr/bin 2>/dev/null 'quoted text' grep -eu
+x=1 local then local | 'quoted text' then sed -eu | 'quoted text' done sed x=1 |
+	"$1" "$@" "$1" cd local "$1" cd "$1"
+	&& "$1" sed $(pwd) 2>/dev/null sed
+	test sed printf readonly --verbose then printf
+		local ${HOME} --verbose printf 2>/dev/null done echo export $(pwd) &&
+	x=1 echo echo && | $(pwd) ${HOME} printf cd 'quoted text'
+		grep 2>/dev/null then readonly && && grep grep local awk local "$@" test "$1"
+		"$1" grep echo && x=1 'quoted text'
+	export && x=1 export echo readonly $(pwd) -eu /usr/bin then 2>/dev/null
+		done "$1" awk awk -eu awk awk | "$1" cd local echo $(pwd) 'quoted text' local
+		&& echo -eu -eu 2>/dev/null readonly cd local
+'quoted text' grep then $(pwd) cd "$@" $(pwd)
+		readonly "$1" awk 'quoted text' "$@" export x=1 sed 2>/dev/null
+		export done | $(pwd) test | --verbose awk then
+printf x=1 x=1 cd sed local 'quoted text' 'quoted text' cd 'quoted text'
+		export then "$1" export
+printf export readonly -eu x=1 /usr/bin "$@" --verbose sed done awk then
+	cd x=1 "$1" /usr/bin --verbose
+		sed 2>/dev/null 2>/dev/null cd ${HOME} grep "$@"
+	'quoted text' "$@" && readonly 'quoted text' /usr/bin 'quoted text'
+		grep done ${HOME} | 2>/dev/null --verbose ${HOME} export done echo grep readonly
+test ${HOME} /usr/bin 'quoted text' done && grep readonly
+readonly && grep $(pwd) && cd -eu echo "$@" $(pwd) then export --verbose
+		"$@" ${HOME} sed --verbose $(pwd) --verbose then "$1" done sed ${HOME}
+cd export x=1 $(pwd) &&
+echo export && done /usr/bin export /usr/bin | readonly
+	local | cd test grep --verbose
+2>/dev/null awk "$1" -eu readonly awk cd cd done $(pwd) $(pwd)
+sed cd && awk local "$@" --verbose test local test sed test
+		test "$@" && "$@" "$1" 'quoted text' $(pwd) "$1" 2>/dev/null x=1 'quoted text'
+echo echo && then 2>/dev/null && && &&
+printf /usr/bin sed --verbose
+test ${HOME} test then readonly grep grep
+		cd printf | test && awk | | test then local
+		"$@" "$@" x=1 cd $(pwd) "$1" 'quoted text' -eu local "$@"
+		readonly awk grep then --verbose
+	export local /usr/bin done awk /usr/bin
+		then echo grep awk "$1" /usr/bin /usr/bin readonly
+"$1" "$@" $(pwd) --verbose $(pwd) | cd cd /usr/bin |
+	then printf /usr/bin "$@" --verbose &&
+		| done "$@" echo test cd x=1 awk 'quoted text' readonly "$@" printf
+		export x=1 | -eu grep export echo ${HOME} $(pwd)
+	readonly "$@" printf 2>/dev/null
+		done done grep ${HOME} cd $(pwd) awk
+	printf ${HOME} grep cd | awk /usr/bin then cd
+sed $(pwd) local "$1" printf && test | 2>/dev/null readonly x=1 --verbose 'quoted text'
+awk | export test --verbose cd 2>/dev/null then test printf printf 2>/dev/null
+	-eu "$1" then "$1" printf sed
+&& done ${HOME} 2>/dev/null /usr/bin
+export ${HOME} "$@" sed readonly echo grep grep /usr/bin printf
+		local | cd $(pwd) grep awk 'quoted text'
+	'quoted text' export sed ${HOME} test sed export done --verbose grep cd test
+		2>/dev/null --verbose /usr/bin awk "$1"
+		done cd && then cd test --verbose ${HOME}
+	| 'quoted text' done readonly readonly local
+&& local "$1" grep /usr/bin --verbose && --verbose
+	x=1 local grep sed "$@" 'quoted text'
+	local --verbose echo echo "$1"
+${HOME} "$1" cd 2>/dev/null -eu 'quoted text' echo then awk awk
+	cd export 'quoted text' test && "$@" 'quoted text' done
+	x=1 ${HOME} "$@" grep
+		done | 2>/dev/null 'quoted text' /usr/bin
+cd awk 2>/dev/null printf cd $(pwd) x=1 echo done $(pwd)
+	--verbose --verbose awk readonly "$1" local
+	--verbose x=1 "$@" && sed 'quoted text' sed 'quoted text'
+	cd export "$@" /usr/bin && cd | $(pwd)
+		test then export awk -eu done 2>/dev/null
+test printf x=1 then | done echo grep done readonly
+		| $(pwd) "$@" && /usr/bin
+grep printf grep echo 'quoted text' 2>/dev/null local cd &&
+$(pwd) && && x=1 "$@" 'quoted text' "$@" "$1" "$@" sed export done
+	&& printf $(pwd) printf x=1 "$@" x=1 | sed then
+/usr/bin cd test | local test export "$@" | /usr/bin
+		-eu echo grep && 'quoted text' "$@" export "$@" x=1 cd echo ${HOME}
+export cd cd local readonly x=1 x=1 sed then
+	sed "$@" awk 2>/dev/null /usr/bin grep awk ${HOME} sed local echo sed "$@"
+awk cd test x=1 done readonly then echo test /usr/bin && done
+	"$@" 2>/dev/null -eu printf | readonly test local done "$1" echo && printf
+	echo | done then ${HOME} readonly ${HOME} -eu
+readonly -eu test export | export export $(pwd) -eu
+test /usr/bin $(pwd) then readonly echo export sed $(pwd) ${HOME} test local grep
+	sed printf awk then grep readonly "$1" "$1" -eu "$@" | local ${HOME} 2>/dev/null
+sed local "$1" | && done done /usr/bin --verbose grep echo sed 2>/dev/null
+		"$1" awk 2>/dev/null 2>/dev/null then x=1 && done
+		--verbose --verbose readonly -eu
+	awk | echo "$1" "$@" ${HOME} cd "$1" cd echo 'quoted text' /usr/bin
+awk done "$1" ${HOME} && then local 'quoted text' --verbose
+	done && done sed x=1 && 'quoted text' printf grep printf $(pwd) sed | --verbose
+		"$@" done 2>/dev/null && | grep readonly echo | export awk /usr/bin
+	${HOME} export local $(pwd) readonly done -eu $(pwd)
+"$@" echo $(pwd) 'quoted text' readonly then done
+		--verbose ${HOME} grep awk 2>/dev/null --verbose
+	x=1 -eu awk -eu $(pwd) "$@" export test ${HOME} x=1 2>/dev/null
+done readonly && x=1 "$@" local --verbose 'quoted text'
+	export 'quoted text' && 2>/dev/null readonly local &&
+	$(pwd) echo cd test local ${HOME} "$1" 'quoted text' echo sed cd
+	echo $(pwd) awk printf cd local
+	"$1" 2>/dev/null x=1 printf /usr/bin 2>/dev/null "$1" --verbose x=1 export
+		done $(pwd) x=1 | echo x=1 /usr/bin ${HOME} && grep grep awk local
+export | | ${HOME} && grep cd "$1" x=1 cd /usr/bin 'quoted text'
+	/usr/bin | local readonly export && grep | local then x=1 --verbose
+printf 2>/dev/null "$@" "$@" -eu awk && 2>/dev/null 'quoted text' grep done
+| cd "$@" $(pwd) 2>/dev/null export "$1" cd x=1 readonly cd echo && export
+cd 'quoted text' echo test done done
+sed awk echo then sed "$1"
+cd cd cd "$@" grep 'quoted text' | local awk /usr/bin awk test
+		-eu local --verbose done x=1 ${HOME} && echo -eu readonly --verbose grep
+awk done cd --verbose "$@" "$@" 'quoted text' "$@" "$1" && /usr/bin awk awk "$1"
+readonly done test -eu ${HOME} cd -eu "$1" /usr/bin then
+	then x=1 --verbose awk && echo cd cd grep --verbose ${HOME} echo done local
+	cd "$@" awk ${HOME} local 'quoted text' 2>/dev/null printf $(pwd) export done
+		test echo ${HOME} && -eu -eu sed echo "$@" "$@" 'quoted text'
+echo 2>/dev/null 'quoted text' sed "$1" test $(pwd) 2>/dev/null grep grep readonly
+	/usr/bin then 2>/dev/null && "$@" cd 'quoted text' $(pwd) 2>/dev/null
+		readonly cd $(pwd) done ${HOME} "$1" echo
+2>/dev/null | $(pwd) echo $(pwd) && sed readonly 'quoted text'
+done /usr/bin ${HOME} -eu printf x=1 grep 'quoted text' done ${HOME}
+	&& ${HOME} | awk 'quoted text' "$@" | cd local 'quoted text' "$@"
+		then /usr/bin 'quoted text' 'quoted text'
+		sed then /usr/bin --verbose "$@" export "$@" cd "$1" readonly
+	"$1" | "$1" | x=1 x=1 "$@" 2>/dev/null x=1 "$@" echo local done x=1 "$1"
+export ${HOME} 2>/dev/null x=1 ${HOME} $(pwd)
+/usr/bin 2>/dev/null | grep readonly then | -eu --verbose then 'quoted text'
+	local awk awk done /usr/bin readonly /usr/bin
+"$1" ${HOME} ${HOME} 'quoted text' --verbose then done then
+readonly "$@" export | awk done &&
+	readonly readonly $(pwd) $(pwd)
+		export export then | grep local $(pwd) printf | local done "$@" grep "$1" "$1"
+local --verbose printf "$1" test ${HOME} /usr/bin $(pwd) ${HOME} printf
+done -eu "$@" "$@" grep readonly awk
+		'quoted text' readonly && --verbose
+		/usr/bin echo 2>/dev/null export cd "$@"
+done cd -eu printf && /usr/bin x=1 echo cd "$@" test $(pwd) --verbose
+	readonly printf 2>/dev/null -eu ${HOME} done "$1" sed -eu grep | awk sed
+'quoted text' printf -eu done grep x=1 done cd -eu done -eu sed grep
+"$1" 2>/dev/null "$1"
+test cd 2>/dev/null 'quoted text' ${HOME} readonly /usr/bin
+	export awk sed printf /usr/bin ${HOME} cd sed
+		2>/dev/null "$1" printf readonly done 2>/dev/null 'quoted text'
+		cd local then x=1 x=1 done cd --verbose
+		2>/dev/null 2>/dev/null 'quoted text' "$1" then 2>/dev/null x=1 "$@"
+		local local "$@" cd "$1" done test 'quoted text'
+	sed x=1 "$@" -eu readonly x=1 export readonly local 2>/dev/null
+$(pwd) "$1" && 'quoted text' sed local awk sed | readonly done /usr/bin
+$(pwd) sed sed ${HOME} done export sed test test local
+	readonly grep export grep &&
+		"$1" grep test awk /usr/bin awk ${HOME} "$1"
+	export done test awk x=1 | "$@" 'quoted text' | sed
+	"$@" "$@" local export x=1 readonly --verbose 2>/dev/null
+printf /usr/bin grep 2>/dev/null | -eu cd x=1 x=1
+| export ${HOME} then readonly 'quoted text'
+	local printf printf printf export printf
+		--verbose 'quoted text' local x=1 --verbose "$1" printf awk cd grep export
+	| $(pwd) $(pwd) awk && local printf -eu $(pwd) echo sed readonly done grep "$@"
+		"$1" printf ${HOME} $(pwd) readonly --verbose "$@" test 'quoted text'
+		test --verbose then && awk
+	readonly export 2>/dev/null $(pwd)
+		2>/dev/null export test "$@" 2>/dev/null | $(pwd) 2>/dev/null
+${HOME} readonly test 'quoted text' sed 'quoted text' $(pwd) $(pwd) | --verbose
+		local awk ${HOME} cd grep -eu test then printf
+	awk ${HOME} $(pwd) --verbose /usr/bin
+readonly -eu sed | then --verbose awk local --verbose "$1" 2>/dev/null
+	echo -eu sed printf /usr/bin /usr/bin --verbose
+		$(pwd) "$@" readonly ${HOME} printf --verbose awk grep readonly 2>/dev/null
+local 'quoted text' grep
+		test && sed 'quoted text' --verbose "$@" -eu --verbose
+		done | ${HOME} sed -eu /usr/bin test
+		x=1 2>/dev/null $(pwd) test awk test -eu 2>/dev/null && readonly
+		readonly awk printf sed done sed --verbose && --verbose --verbose
+	"$1" "$@" $(pwd) done x=1 x=1 sed local awk ${HOME} echo 2>/dev/null
+		grep 'quoted text' readonly ${HOME} echo | | 'quoted text' sed local sed echo
+sed -eu && /usr/bin readonly 2>/dev/null
+		&& export --verbose cd awk 2>/dev/null $(pwd) ${HOME} --verbose
+awk /usr/bin test export /usr/bin ${HOME} sed export echo && && export test 2>/dev/null
+then echo $(pwd) sed -eu awk grep --verbose done test 2>/dev/null printf sed
+then then cd local --verbose "$@" ${HOME}
+"$1" readonly then x=1 'quoted text' 2>/dev/null cd test | -eu
+export ${HOME} done done "$1" --verbose $(pwd) done grep export && $(pwd)
+awk cd ${HOME} $(pwd) awk 2>/dev/null
+		readonly && x=1 $(pwd) printf -eu grep cd done && cd cd awk export --verbose sed
+sed && cd $(pwd) test x=1 echo "$1" "$1" grep --verbose local
+		then done then $(pwd) export echo readonly echo readonly grep cd
+		"$1" && $(pwd) sed cd export sed --verbose test --verbose test echo "$1" "$1"
+	grep printf echo -eu printf x=1 test
+	grep 2>/dev/null 2>/dev/null
+		done local "$@" echo "$1" "$@" awk ${HOME} readonly |
+	| "$1" echo && -eu --verbose cd | 2>/dev/null
+		readonly $(pwd) --verbose test printf
+	-eu readonly printf --verbose then "$@"
+	/usr/bin --verbose readonly --verbose
+"$1" local 'quoted text' "$1" ${HOME} "$1" --verbose ${HOME}
+		printf /usr/bin sed grep awk
+		done then 'quoted text' export export done cd | ${HOME} "$@" x=1
+then printf local done readonly readonly 'quoted text'
+	local awk "$@" "$1" export | readonly 2>/dev/null --verbose sed readonly echo
+	--verbose $(pwd) test readonly awk test --verbose "$@" done /usr/bin test
+"$@" grep && echo -eu awk 'quoted text' then ${HOME} /usr/bin cd export
+/usr/bin | 2>/dev/null test local done | 'quoted text' | readonly
+	readonly readonly 'quoted text' test 'quoted text'
+		${HOME} "$@" 'quoted text' local $(pwd) "$1" --verbose
+--verbose "$1" local grep | -eu "$@" 2>/dev/null printf local /usr/bin cd --verbose
+		x=1 'quoted text' sed printf -eu
+printf "$@" | then | awk readonly local -eu 2>/dev/null done test "$1" awk -eu |
+		then | echo "$@" $(pwd) --verbose
+		done then test x=1 done /usr/bin --verbose export export --verbose
+cd 2>/dev/null printf x=1 2>/dev/null x=1 test x=1
+'quoted text' export done x=1 done local then /usr/bin awk | grep awk
+		cd | grep echo x=1 --verbose sed 'quoted text' x=1 | x=1
+	2>/dev/null | awk 2>/dev/null
+	export | x=1 -eu readonly 2>/dev/null "$1" awk /usr/bin /usr/bin
+awk "$@" x=1 x=1 readonly grep -eu grep readonly $(pwd) then "$@" --verbose
+	$(pwd) "$@" 'quoted text' $(pwd) "$@" ${HOME} --verbose $(pwd) 'quoted text'
+		cd 2>/dev/null export /usr/bin --verbose
+	sed export awk | "$1" then -eu -eu "$@" readonly
+	/usr/bin | -eu printf --verbose sed printf -eu printf
+grep $(pwd) awk then ${HOME} $(pwd) then readonly "$1" export cd --verbose
+	$(pwd) done done done --verbose export grep /usr/bin | test "$@" readonly x=1
+	printf 2>/dev/null --verbose "$1" | sed &&
+-eu -eu export && 'quoted text' grep grep
+"$1" ${HOME} then x=1 cd done /usr/bin
+$(pwd) ${HOME} export awk
+		done done "$1" echo x=1 then readonly export printf test "$@" 2>/dev/null
+		&& then $(pwd) /usr/bin then local "$1" 2>/dev/null export 2>/dev/null
+-eu readonly echo readonly then then x=1 sed
+	--verbose export "$1" done --verbose done 'quoted text' test -eu readonly
+		${HOME} | cd done ${HOME} grep readonly
+	| sed -eu "$1" "$1" echo export sed $(pwd)
+		readonly && "$1" test 2>/dev/null test ${HOME} done
+	echo && 2>/dev/null /usr/bin "$1" && export
+	awk 'quoted text' /usr/bin | grep done export "$@" 2>/dev/null | && "$1"
+	| sed /usr/bin printf 2>/dev/null echo 'quoted text' cd echo
+"$1" local cd -eu -eu local -eu -eu done && done --verbose local sed 'quoted text'
+	echo done -eu cd "$@" done 2>/dev/null
+grep readonly readonly printf readonly $(pwd)
+awk grep /usr/bin awk echo cd then cd done "$1" && sed -eu | test test done 'quoted text'
+	printf then test -eu readonly --verbose && then readonly "$@" && && /usr/bin
+printf awk "$1" cd $(pwd) "$1" "$@" test cd grep 2>/dev/null
+		then test "$@" 'quoted text' test
+	then 2>/dev/null export -eu $(pwd) "$1" $(pwd) sed "$@"
+		'quoted text' then | local
+		"$1" 2>/dev/null /usr/bin printf sed cd
+	&& echo $(pwd) --verbose test "$1" printf readonly -eu "$1" sed 'quoted text'
+	'quoted text' --verbose local awk then && -eu then cd then "$@" grep
+	x=1 "$@" local test 'quoted text'
+		export grep /usr/bin export local then
+		sed cd | printf x=1 printf
+		local -eu ${HOME} readonly grep ${HOME} x=1 test &&
+grep cd ${HOME} 'quoted text' cd sed printf export &&
+-eu test awk echo export readonly | sed -eu readonly
+"$1" | --verbose done
+	local -eu "$1" "$1" sed /usr/bin "$@" grep -eu --verbose awk awk | done awk /usr/bin
+	export done 'quoted text' test sed "$@" x=1 printf 'quoted text'
+		| sed | readonly x=1 sed --verbose /usr/bin awk -eu 'quoted text'
+	${HOME} awk | readonly then "$1" done done 'quoted text'
+then "$1" 'quoted text' test
+		&& x=1 then grep 'quoted text' printf test 'quoted text' test awk
+&& x=1 readonly test printf test printf
+	echo then test x=1 "$@" && $(pwd) test readonly local x=1 -eu $(pwd) done
+	/usr/bin | grep "$@" ${HOME} test --verbose then "$1"
+readonly 2>/dev/null awk readonly
+	${HOME} x=1 && test printf grep sed "$@" cd 2>/dev/null /usr/bin ${HOME}
+		sed 'quoted text' done ${HOME} ${HOME} readonly
+"$1" test "$1" 2>/dev/null -eu printf
+	export done "$1" | 2>/dev/null --verbose cd cd grep x=1 local local 'quoted text'
+x=1 $(pwd) local grep printf --verbose
+	export 'quoted text' awk ${HOME}
+	test -eu then $(pwd) readonly "$1" x=1 local $(pwd) "$1" done && printf local
+export | grep awk done test ${HOME} --verbose grep ${HOME} 'quoted text'
+	printf | $(pwd) export sed "$1" sed
+	local "$1" 'quoted text' local
+grep && 'quoted text' ${HOME} $(pwd) sed readonly local sed local
+	export export readonly ${HOME} "$1"
+cd /usr/bin sed | printf x=1 $(pwd) 'quoted text' awk "$@"
+		--verbose ${HOME} awk ${HOME} grep -eu "$1" cd then 'quoted text' printf ${HOME}
+		cd awk 'quoted text' $(pwd) 2>/dev/null awk export 2>/dev/null
+		cd local local && local awk ${HOME} "$@" awk then
+		readonly 'quoted text' then local echo then $(pwd) export
+--verbose readonly && cd sed readonly $(pwd) x=1 && $(pwd) export echo echo test
+	local /usr/bin --verbose "$@" export 2>/dev/null test ${HOME} done
+--verbose /usr/bin | 'quoted text'
+		sed echo && echo "$@" 2>/dev/null 'quoted text' export -eu "$@"
+"$1" | done done "$@" done printf "$1" export
+"$1" x=1 printf local done $(pwd) -eu $(pwd)
+"$@" grep grep done "$@" cd "$1" 'quoted text' awk $(pwd) "$@" 2>/dev/null
+'quoted text' echo $(pwd) && awk --verbose done local
+	2>/dev/null then x=1 export cd 2>/dev/null readonly
+		sed awk awk /usr/bin "$1" grep readonly | x=1 printf "$1" ${HOME}
+	grep cd test echo echo grep local && && $(pwd) ${HOME}
+	&& awk "$@" x=1 sed export 'quoted text' --verbose
+		cd then -eu echo | cd /usr/bin export grep grep --verbose
+		grep then | "$1" $(pwd) export 2>/dev/null echo 'quoted text' export
+		then "$@" "$1" ${HOME} "$@" && export done printf printf
+		/usr/bin $(pwd) $(pwd) local
+2>/dev/null grep | --verbose readonly 2>/dev/null | grep ${HOME} --verbose
+	grep readonly /usr/bin 2>/dev/null export readonly then
+		'quoted text' sed && --verbose /usr/bin cd
+		/usr/bin printf then then 2>/dev/null echo --verbose "$1" "$1" --verbose
+	printf "$1" then readonly
+awk --verbose export printf 'quoted text' done echo && readonly "$1" done
+sed ${HOME} "$@" x=1 x=1 "$@" x=1 -eu /usr/bin && && /usr/bin /usr/bin grep
+	sed | -eu -eu 2>/dev/null -eu sed readonly sed | local && |
+		"$@" awk printf 2>/dev/null grep x=1 cd awk
+2>/dev/null --verbose readonly echo "$1" echo 'quoted text' local cd export
+	test --verbose && readonly --verbose 'quoted text' x=1 /usr/bin
+		"$@" printf sed $(pwd) -eu 'quoted text'
+x=1 cd echo cd | echo printf cd sed test -eu "$1" local x=1 2>/dev/null done -eu
+"$@" && -eu $(pwd) readonly
+		grep printf "$@" grep "$@" cd awk 'quoted text' && grep awk then cd && test
+echo local sed x=1 test grep | done done -eu readonly
+		local "$@" then ${HOME} awk sed /usr/bin test /usr/bin sed cd ${HOME} $(pwd)
+		grep x=1 | "$1" && "$@" echo /usr/bin export -eu sed | "$@"
+'quoted text' -eu /usr/bin printf cd $(pwd) && grep "$@" grep 2>/dev/null
+	test | printf x=1 echo -eu echo "$@" export echo && -eu awk grep cd local
+	x=1 done ${HOME} cd -eu local /usr/bin && $(pwd)
+	echo test readonly ${HOME} echo cd $(pwd) sed awk ${HOME} echo --verbose
+		readonly grep 2>/dev/null 'quoted text' echo
+	"$@" ${HOME} local export "$1" export then && x=1 --verbose awk
+	grep then awk grep readonly -eu echo 'quoted text'
+		${HOME} | 2>/dev/null -eu -eu test ${HOME} cd readonly ${HOME} cd
+2>/dev/null grep --verbose
+readonly -eu printf "$1"
+export 'quoted text' grep
+		then | | "$1" 'quoted text'
+cd x=1 --verbose done && ${HOME} "$1" sed
+&& /usr/bin "$@" /usr/bin then 2>/dev/null "$@"
+	done cd local done done readonly /usr/bin done echo done export
+	x=1 x=1 "$1" x=1 cd x=1 done echo printf sed grep sed --verbose printf sed
+	--verbose export && cd -eu 2>/dev/null readonly "$1" cd /usr/bin
+		export --verbose /usr/bin then echo then x=1 test
+grep "$@" echo x=1 'quoted text' export sed local readonly test "$1" | readonly
+		2>/dev/null x=1 x=1 --verbose /usr/bin then sed x=1 "$@" ${HOME} -eu
+	-eu | /usr/bin grep test done cd done $(pwd) then cd x=1 grep done /usr/bin
+export grep readonly readonly /usr/bin grep sed x=1 "$@" cd test awk done 2>/dev/null
+&& local "$1" 'quoted text' sed grep echo x=1 cd $(pwd) local
+	2>/dev/null | "$@" grep -eu export local && echo printf 'quoted text'
+		x=1 --verbose then test -eu "$@" x=1 x=1 cd $(pwd) export
+then 2>/dev/null printf "$@" $(pwd) cd -eu echo -eu printf 'quoted text'
+		'quoted text' done then echo
+"$@" readonly awk awk readonly then test readonly local $(pwd) cd echo export
+&& awk && printf /usr/bin &&
+	export then --verbose test printf $(pwd)
+	awk readonly sed -eu test $(pwd) local "$1" local printf /usr/bin
+	$(pwd) | cd ${HOME} 'quoted text' awk
+		echo done echo /usr/bin sed done local local awk cd ${HOME} local echo cd then grep
+	grep sed "$1" --verbose echo x=1 2>/dev/null "$@"
+		| cd done x=1 $(pwd) printf done grep printf x=1 'quoted text' done readonly
+	-eu echo grep sed -eu /usr/bin readonly
+		"$1" test && readonly 'quoted text' 'quoted text' cd echo export
+	"$1" cd done "$@" "$@" --verbose echo printf echo readonly test local $(pwd) export
+	"$1" cd readonly awk 'quoted text' export then "$1" test readonly && x=1 2>/dev/null
+		"$@" "$1" export | -eu grep export then then | $(pwd) grep && done
+		| sed "$@" echo 'quoted text' 2>/dev/null "$@" printf 2>/dev/null
+	$(pwd) printf grep "$1" | 'quoted text'
+$(pwd) $(pwd) sed /usr/bin readonly "$@" 'quoted text'
+		/usr/bin awk -eu 'quoted text' $(pwd) local grep local readonly "$1" done
+		echo readonly grep grep
+	"$@" x=1 'quoted text' /usr/bin --verbose printf | "$1" printf test $(pwd)
+	| sed 'quoted text' && --verbose readonly printf test done x=1
+test "$1" printf readonly echo $(pwd) ${HOME} -eu $(pwd) cd printf
+	${HOME} grep awk 'quoted text' export done "$@" && then done grep /usr/bin
+		sed --verbose export "$@" "$@" 2>/dev/null printf echo x=1 ${HOME} echo export
+export "$1" "$@" then
+&& echo "$@" readonly then ${HOME} | /usr/bin then
+then readonly "$@" then | && grep then $(pwd) export
+	"$1" test then cd grep 'quoted text' local export echo local
+	'quoted text' 'quoted text' sed local
+	--verbose awk | sed sed cd then x=1 printf /usr/bin "$1" readonly && --verbose
+	grep then --verbose test awk ${HOME}
+		test printf echo then readonly echo test echo $(pwd)
+	test -eu then && "$1" ${HOME} 'quoted text' local echo local echo
+&& readonly local -eu done
+		'quoted text' $(pwd) x=1 printf export
+readonly grep 'quoted text' cd | done "$1" sed && cd printf "$1" printf
+readonly grep printf grep local done -eu "$@" ${HOME}
+	${HOME} $(pwd) x=1 awk $(pwd) readonly x=1 printf grep sed export
+echo readonly "$@" | awk
+test awk | printf readonly --verbose echo awk
+		${HOME} 2>/dev/null ${HOME}
+cd && cd test "$1" cd 2>/dev/null ${HOME} $(pwd)
+		echo awk printf echo x=1 'quoted text' --verbose printf then "$1" sed $(pwd)
+		grep printf echo --verbose then cd $(pwd) --verbose done sed echo
+'quoted text' test "$@" readonly printf printf --verbose --verbose
+local echo --verbose /usr/bin &&
+echo && 'quoted text' done sed -eu /usr/bin
+		done "$1" test x=1 | printf echo then && 2>/dev/null -eu awk test readonly
+		local 'quoted text' test grep
+		$(pwd) cd printf export 'quoted text' -eu export "$1" /usr/bin test -eu
+	2>/dev/null grep "$@" cd && sed x=1 /usr/bin then done /usr/bin "$1" then done
+&& done "$1" "$@" | 'quoted text' "$1" --verbose 2>/dev/null 2>/dev/null 'quoted text'
+"$1" "$@" 2>/dev/null && x=1 /usr/bin "$@" "$@" /usr/bin echo readonly grep
+		x=1 then echo "$1" local | local sed echo sed ${HOME} x=1 awk export then
+	| export printf test -eu 2>/dev/null | echo ${HOME} grep -eu
+		/usr/bin local /usr/bin 'quoted text'
+		export printf ${HOME} done -eu 2>/dev/null export echo --verbose sed
+	'quoted text' sed done sed -eu x=1 'quoted text'
+&& export test grep grep test sed done
+	--verbose --verbose then done sed grep -eu $(pwd) "$1"
+		echo test --verbose 2>/dev/null readonly
+&& readonly | test sed | echo 2>/dev/null
+		awk -eu local readonly readonly && grep x=1 /usr/bin
+		| && printf readonly readonly
+then x=1 ${HOME} "$@" 2>/dev/null --verbose
+readonly then x=1 x=1 $(pwd)
+		"$1" | && printf printf 'quoted text'
+	"$@" export "$1" then && cd ${HOME} then 'quoted text' test --verbose
+| -eu --verbose | echo cd
+export 'quoted text' | /usr/bin --verbose
+	export ${HOME} -eu done readonly sed $(pwd) readonly 2>/dev/null ${HOME} awk x=1
+		then export "$@" sed readonly local export
+	echo && printf awk local x=1 grep
+	x=1 printf && echo sed done
+	then export x=1 readonly $(pwd) -eu | 2>/dev/null ${HOME} printf export "$1"
+${HOME} --verbose done $(pwd) sed printf awk done
+		printf && readonly awk "$@"
+	"$1" local then readonly cd /usr/bin awk | $(pwd) cd 2>/dev/null 'quoted text'
+		cd printf grep "$1" cd 'quoted text' "$1" grep --verbose
+sed 2>/dev/null ${HOME} grep printf "$1" readonly "$@" grep "$1" test readonly export
+		readonly -eu 2>/dev/null cd ${HOME} cd done ${HOME}
+		done done -eu -eu grep /usr/bin then then printf grep x=1
+		x=1 echo readonly cd && echo test --verbose && 'quoted text'
+| && "$@" test x=1 local "$1" "$@" awk done
+		sed -eu /usr/bin --verbose 2>/dev/null && ${HOME} readonly
+"$1" "$@" | sed --verbose | "$1" awk
+| "$1" 2>/dev/null $(pwd) "$@" 2>/dev/null
+		then $(pwd) awk readonly -eu $(pwd) ${HOME} readonly 'quoted text' printf
+		test readonly readonly done 'quoted text' test
+cd local test ${HOME} local
+		/usr/bin awk grep "$@" grep && ${HOME} then
+readonly awk "$@" then
+		export --verbose 2>/dev/null test readonly
+		then 2>/dev/null readonly | 2>/dev/null printf printf 'quoted text'
+'quoted text' | && /usr/bin
+	/usr/bin $(pwd) --verbose awk x=1 readonly export --verbose
+	export awk grep x=1 --verbose
+		x=1 echo then 'quoted text' $(pwd) local $(pwd) local cd awk export
+	done x=1 grep done done echo "$1" printf ${HOME} ${HOME} 2>/dev/null sed $(pwd)
+		-eu --verbose --verbose cd
+"$@" then -eu local && 2>/dev/null then cd && then && local test grep then
+then cd printf | export sed printf awk cd sed done
+	local 'quoted text' -eu --verbose
+	'quoted text' done done cd 2>/dev/null
+	sed test export echo cd $(pwd) test | local then /usr/bin && cd test then /usr/bin
+	cd grep ${HOME} --verbose awk grep 'quoted text' grep
+	x=1 grep -eu "$1" export x=1 "$@" "$1" | awk printf
+/usr/bin 2>/dev/null printf | export sed done
+then && | "$@" then sed $(pwd) 'quoted text' "$@" export readonly
+	2>/dev/null -eu grep /usr/bin then "$1"
+		x=1 done then local cd --verbose $(pwd) printf
+	&& done -eu then sed ${HOME} echo grep sed local ${HOME} ${HOME} awk readonly
+	-eu "$@" done cd local "$1" grep -eu awk then test echo 'quoted text' sed
+"$@" 2>/dev/null grep /usr/bin --verbose $(pwd) sed export --verbose
+		"$1" -eu "$1" && cd x=1 readonly cd
+		awk && cd $(pwd) test echo readonly readonly
+| ${HOME} local done 2>/dev/null cd x=1 ${HOME}
+test 'quoted text' -eu ${HOME} ${HOME} awk local grep 2>/dev/null
+	/usr/bin x=1 test grep test cd /usr/bin then awk local --verbose
+	"$@" grep -eu export echo /usr/bin test done ${HOME} echo local
+done cd then -eu done readonly
+	"$@" readonly sed local done local
+	--verbose sed 'quoted text' 'quoted text' printf -eu local readonly /usr/bin
+		readonly x=1 sed test then "$@" then awk export
+cd readonly /usr/bin test "$1" "$1"
+	test 2>/dev/null then then ${HOME} printf grep
+	/usr/bin awk test 2>/dev/null 2>/dev/null
+	/usr/bin "$1" awk | $(pwd) -eu then $(pwd) done done
+	"$@" test grep done --verbose printf && 2>/dev/null | "$1" local
+		readonly "$1" | local grep "$@" printf "$1" 'quoted text'
+		readonly local printf x=1 then awk "$1" $(pwd)
+	| 'quoted text' $(pwd) printf done then $(pwd) done echo && cd readonly export
+	"$1" echo printf -eu $(pwd) done ${HOME}
+	local -eu echo test printf
+| then -eu printf x=1 awk printf "$@" 'quoted text' local
+/usr/bin /usr/bin readonly && grep test && awk 'quoted text' local $(pwd)
+grep local 'quoted text' then printf local
+	${HOME} --verbose /usr/bin printf ${HOME}
+readonly 'quoted text' 'quoted text' then printf test ${HOME} | --verbose
+		readonly cd grep done 'quoted text'
+| "$@" done printf done printf grep test cd done readonly && local printf
+		2>/dev/null ${HOME} -eu cd "$@" readonly | $(pwd) /usr/bin ${HOME}
+	-eu sed printf ${HOME} /usr/bin $(pwd)
+/usr/bin x=1 2>/dev/null cd /usr/bin
+	awk export grep printf -eu "$1" then sed test readonly && ${HOME}
+	"$@" awk 'quoted text' 'quoted text'
+	printf printf printf export
+	/usr/bin -eu grep done grep then
+	$(pwd) "$1" /usr/bin && printf cd printf $(pwd) 'quoted text' && readonly
+	export grep grep readonly
+	echo "$@" grep readonly && done --verbose 'quoted text' readonly readonly
+	test 'quoted text' awk then 'quoted text' done done 2>/dev/null
+		test "$1" export readonly sed 2>/dev/null 2>/dev/null done /usr/bin ${HOME}
+	"$1" cd /usr/bin test "$@" test test --verbose && -eu x=1
+		local "$1" 2>/dev/null ${HOME}
+		${HOME} 2>/dev/null /usr/bin "$@" x=1
+	/usr/bin --verbose test --verbose $(pwd)
+grep printf echo awk grep --verbose readonly
+&& export readonly grep x=1
+	printf -eu sed printf /usr/bin
+test printf $(pwd) echo grep ${HOME} grep $(pwd) | local -eu sed cd -eu awk ${HOME}
+-eu test --verbose export
+export cd && then local readonly
+		--verbose "$@" | "$@" 2>/dev/null grep -eu sed /usr/bin local echo echo "$1"
+	$(pwd) export export /usr/bin 2>/dev/null awk --verbose
+printf export then cd sed /usr/bin /usr/bin cd x=1 "$1" x=1 $(pwd) readonly
+grep echo awk echo ${HOME} sed "$1"
+		"$1" $(pwd) done export test --verbose printf "$@" test done export /usr/bin
+	cd "$@" local cd printf 2>/dev/null test echo "$1" readonly
+&& test 2>/dev/null cd "$1" sed echo local test readonly test $(pwd)
+done 'quoted text' sed export
+	export then "$@" /usr/bin
+export /usr/bin test export | export
+echo echo "$1" then 'quoted text' -eu printf && $(pwd)
+	then /usr/bin cd grep test $(pwd) -eu readonly local sed /usr/bin
+cd then "$1" "$1" 'quoted text' && grep ${HOME} $(pwd) then echo
+		2>/dev/null && x=1 "$1" local ${HOME} echo
+"$1" ${HOME} 'quoted text' ${HOME} "$1" && echo "$@" 'quoted text'
+'quoted text' | grep /usr/bin export
+		test echo $(pwd) echo x=1 ${HOME}
+		-eu /usr/bin echo cd export "$@" $(pwd) readonly "$1" echo
+export && cd | echo local
+	cd | then then readonly grep "$@" awk "$1" awk local
+/usr/bin x=1 printf export && "$@" 'quoted text' cd 'quoted text'
+	grep local "$@" then then --verbose readonly export export
+then test readonly printf sed printf $(pwd) export grep ${HOME} "$1" 2>/dev/null
+		$(pwd) sed echo sed readonly && -eu
+		then sed sed done "$@" then local "$@" sed -eu "$@" done
+		sed /usr/bin && "$@" grep awk cd ${HOME}
+		| $(pwd) x=1 grep echo
+${HOME} "$1" export sed | printf x=1 && local awk printf
+local "$@" --verbose 'quoted text' export $(pwd) $(pwd) echo "$1"
+"$1" /usr/bin ${HOME} && | x=1 && "$1" then $(pwd) /usr/bin sed
+	sed 'quoted text' | awk grep local done /usr/bin sed done export
+	sed ${HOME} /usr/bin && $(pwd) sed --verbose && readonly then echo readonly "$1"
+	"$@" local echo local export 2>/dev/null 'quoted text' sed x=1 sed $(pwd)
+		&& readonly local 'quoted text'
+sed readonly && test | | "$1" $(pwd) echo then | export /usr/bin "$1" $(pwd)
+		| && 'quoted text' grep "$1" --verbose
+printf "$@" --verbose "$@" done readonly x=1 printf grep /usr/bin 'quoted text'
+"$@" "$1" ${HOME} cd export ${HOME} 2>/dev/null $(pwd) awk
+export printf local cd
+/usr/bin test awk echo export export printf local readonly
+	"$1" $(pwd) $(pwd) 'quoted text'
+	'quoted text' awk export "$@" x=1 echo
+printf export echo printf
+| && export printf -eu ${HOME} echo -eu test "$1" x=1
+printf x=1 && 'quoted text' "$@" /usr/bin ${HOME} done
+	grep echo --verbose -eu "$1" | /usr/bin sed sed
+		done readonly readonly $(pwd) awk "$1" printf $(pwd) /usr/bin | then
+x=1 $(pwd) sed && 'quoted text' grep done readonly printf
+/usr/bin printf test test && ${HOME} -eu ${HOME} "$1" echo test
+		&& cd x=1 'quoted text' cd local sed grep awk grep
+	echo --verbose printf
+	test "$1" done sed ${HOME} "$1" local readonly done | /usr/bin
+done printf sed ${HOME} x=1 -eu
+export ${HOME} && sed --verbose
+	$(pwd) $(pwd) then awk echo "$@" && readonly sed
+		$(pwd) readonly awk "$@" then
+	printf awk ${HOME} x=1 export /usr/bin echo local
+'quoted text' -eu echo --verbose printf x=1 2>/dev/null /usr/bin then -eu grep
+	grep "$@" then /usr/bin grep 2>/dev/null awk "$1" 2>/dev/null "$1"
+	export then local /usr/bin "$@" grep readonly readonly done
+		--verbose $(pwd) awk "$@" x=1 && cd
+		readonly export --verbose /usr/bin then --verbose
+export 'quoted text' sed awk
+"$@" readonly 2>/dev/null grep test export grep --verbose echo
+		"$1" x=1 local export "$@" then local | $(pwd) "$@" echo local
+		x=1 local done done sed 'quoted text' $(pwd) && "$1" done /usr/bin
+	readonly x=1 awk "$@" awk cd
+	awk local -eu export && cd local local done -eu cd && cd cd && && "$@" /usr/bin
+printf awk sed && printf ${HOME} readonly
+/usr/bin /usr/bin && -eu && "$@" "$1" sed ${HOME} cd 'quoted text' 2>/dev/null
+--verbose x=1 ${HOME} /usr/bin cd printf 'quoted text'
+		'quoted text' then sed echo "$@" done export /usr/bin
+/usr/bin && 2>/dev/null awk ${HOME} cd "$1" sed
+		&& readonly readonly 'quoted text' ${HOME}
+	echo --verbose awk x=1 --verbose
+printf awk /usr/bin test ${HOME}
+	local "$1" cd awk $(pwd) $(pwd) && "$1" && --verbose printf
+		echo $(pwd) awk test -eu
+-eu export printf "$@" then
+	| local printf echo echo "$@" cd then --verbose
+		export ${HOME} local x=1 "$1" cd --verbose sed "$1" done /usr/bin -eu
+	grep "$1" && /usr/bin cd x=1 grep --verbose $(pwd) ${HOME} readonly x=1
+		export cd 2>/dev/null awk -eu &&
+		test "$@" && -eu /usr/bin
+"$@" "$@" awk printf sed 2>/dev/null "$@" local x=1 local
+	| sed printf printf printf test "$@" --verbose
+		grep grep export /usr/bin | test grep 'quoted text'
+	"$@" test then grep 'quoted text'
+&& local test --verbose "$@" local cd printf "$1"
+		2>/dev/null printf /usr/bin grep sed ${HOME} "$@" && grep | 'quoted text'
+		'quoted text' 2>/dev/null $(pwd) test cd export
+x=1 then | "$1" 2>/dev/null | sed "$@" done printf $(pwd)
+		cd -eu 2>/dev/null 2>/dev/null 2>/dev/null
+done | then sed echo 'quoted text' local /usr/bin | export
+		/usr/bin echo cd cd grep --verbose local local
+test then /usr/bin "$@" grep done x=1
+local test ${HOME} then --verbose "$@" then local "$1"
+	printf test readonly then | export cd test x=1 x=1 /usr/bin ${HOME} --verbose
+		sed 'quoted text' sed | sed
+	&& cd /usr/bin done x=1 then 2>/dev/null --verbose && test awk "$1"
+	${HOME} printf local test grep then && local done 'quoted text' ${HOME} echo
+		echo "$@" done printf cd 2>/dev/null 'quoted text' sed
+		-eu done test cd awk local x=1 grep && /usr/bin 'quoted text' readonly
+	printf && | | local export ${HOME} readonly /usr/bin
+readonly --verbose done $(pwd)
+	done awk done /usr/bin then 'quoted text' x=1 test echo done && export
+2>/dev/null then "$1" && ${HOME} "$@" cd sed printf echo 2>/dev/null 'quoted text'
+test echo done echo done export local | then test --verbose | grep
+readonly echo awk --verbose export 'quoted text'
+test cd done done "$1" 2>/dev/null
+sed | then /usr/bin 2>/dev/null ${HOME} 2>/dev/null
+	"$@" $(pwd) | 2>/dev/null --verbose
+/usr/bin grep $(pwd) | awk x=1 $(pwd) "$1"
+		then test readonly $(pwd) readonly | sed 2>/dev/null local awk
+| readonly "$@" readonly grep grep && &&
+--verbose "$@" && | 'quoted text' then awk && cd echo then sed
+$(pwd) readonly 2>/dev/null 'quoted text'
+&& $(pwd) && readonly test local 'quoted text' readonly ${HOME} ${HOME}
+sed readonly -eu 2>/dev/null sed cd && ${HOME} && 'quoted text' grep -eu
+		--verbose "$@" "$@" -eu test x=1 && "$@" && then test | /usr/bin
+/usr/bin --verbose echo -eu
+		export cd | cd readonly --verbose -eu echo
+		grep echo && ${HOME} echo
+	export $(pwd) local then then printf export
+$(pwd) grep x=1 readonly done "$1" grep export export $(pwd) printf
+	"$@" "$@" | readonly readonly --verbose --verbose
+/usr/bin echo $(pwd) 'quoted text' test
+x=1 /usr/bin sed 2>/dev/null local grep
+test ${HOME} /usr/bin grep printf |
+2>/dev/null test "$1" 'quoted text' local grep export "$@" | then $(pwd)
+done /usr/bin 2>/dev/null cd | $(pwd) test local printf awk x=1
+		$(pwd) local --verbose ${HOME}
+	then sed "$1" awk readonly awk printf && --verbose
+cd then "$@" 'quoted text' sed 'quoted text'
+	grep printf readonly awk "$1" export local printf grep
+		${HOME} x=1 && x=1 ${HOME} ${HOME} grep export x=1 export ${HOME} awk export 'quoted text'
+grep "$@" "$1" export "$@" -eu $(pwd) | test /usr/bin 2>/dev/null -eu | then /usr/bin
+	/usr/bin test ${HOME} && 2>/dev/null export sed then
+echo echo "$@" $(pwd) /usr/bin
+		awk 'quoted text' local "$@" cd local $(pwd) cd test $(pwd) /usr/bin $(pwd)
+x=1 'quoted text' 2>/dev/null "$@" local cd -eu readonly x=1 "$@" $(pwd)
+	export done test grep 2>/dev/null
+		export grep | test then && $(pwd) x=1 export printf 2>/dev/null
+	-eu "$1" -eu "$1" "$@" then echo 2>/dev/null
+	awk awk awk -eu cd sed export awk sed 'quoted text' ${HOME}
+	${HOME} "$@" --verbose readonly && test ${HOME} test then cd /usr/bin --verbose
+	"$@" grep 2>/dev/null /usr/bin then then && cd cd sed export cd export cd awk local
+test | grep "$1" | local
+	$(pwd) -eu "$@" $(pwd) export local /usr/bin
+grep $(pwd) --verbose test cd export export done /usr/bin "$@" local echo readonly
+	readonly --verbose sed -eu done awk test
+'quoted text' 2>/dev/null 2>/dev/null readonly && done readonly
+		| "$@" /usr/bin "$@" sed "$1" && sed "$1" awk export readonly readonly then done
+x=1 sed "$@" | grep "$@" "$@" then
+		awk echo /usr/bin test readonly printf echo readonly
+test ${HOME} then 2>/dev/null export -eu ${HOME} awk local x=1 test x=1 --verbose
+	test 'quoted text' ${HOME} cd printf 'quoted text' test ${HOME} cd
+	'quoted text' --verbose grep then readonly local ${HOME} sed echo
+		2>/dev/null && local | --verbose
+		"$1" | /usr/bin test then local | && 'quoted text' 2>/dev/null
+	"$@" export printf $(pwd)
+		local done x=1 then /usr/bin -eu echo "$1" done printf
+	cd /usr/bin && x=1 cd 'quoted text' readonly && 2>/dev/null
+		printf 2>/dev/null then | cd -eu export $(pwd) cd test
+	local grep local grep && 'quoted text'
+	test done then export x=1 /usr/bin readonly
+		printf 2>/dev/null x=1 /usr/bin "$@" 2>/dev/null 2>/dev/null "$@"
+		'quoted text' | sed 2>/dev/null /usr/bin 2>/dev/null "$@" ${HOME} "$@"
+		grep && "$1" echo awk 'quoted text' x=1
+	| 2>/dev/null sed sed "$1" export
+		$(pwd) then test done -eu then x=1 printf local
+"$1" cd && readonly "$1" awk printf local test printf local 2>/dev/null | -eu
+readonly then sed "$1" local "$@" local $(pwd) | 2>/dev/null done then
+		sed awk --verbose grep "$1"
+	test $(pwd) 'quoted text'
+then /usr/bin local x=1
+		| cd && 'quoted text' readonly local /usr/bin -eu "$1" ${HOME} grep local printf
+		readonly readonly done test then 'quoted text' ${HOME}
+	readonly $(pwd) 2>/dev/null
+then done 2>/dev/null x=1
+	sed export cd -eu 'quoted text' ${HOME} "$@" 'quoted text'
+2>/dev/null then printf 2>/dev/null
+	readonly 'quoted text' "$@" grep test local
+sed printf "$1" test awk echo awk $(pwd) && sed 'quoted text' "$@"
+		done export then test awk 2>/dev/null sed | grep echo | readonly /usr/bin
+$(pwd) cd /usr/bin awk $(pwd) ${HOME}
+export printf printf done
+then sed 'quoted text' | ${HOME} grep then "$1" awk | && cd echo
+		-eu | printf cd ${HOME} x=1 local 2>/dev/null
+		"$@" $(pwd) "$1" "$@" echo 2>/dev/null test printf | echo
+awk ${HOME} export x=1 grep /usr/bin --verbose | sed --verbose test 'quoted text'
+"$1" done echo -eu && /usr/bin -eu &&
+	"$@" export --verbose "$@" /usr/bin
+	export x=1 cd printf -eu /usr/bin && readonly 2>/dev/null printf
+		then ${HOME} then "$1" --verbose
+		-eu $(pwd) test "$@" local then --verbose $(pwd) printf ${HOME} /usr/bin 2>/dev/null
+	sed "$1" printf printf
+	"$@" 2>/dev/null --verbose printf cd -eu echo awk $(pwd) done "$@" local 'quoted text'
+| | x=1 export echo --verbose grep cd export export awk export readonly && 'quoted text'
+	/usr/bin sed 2>/dev/null test --verbose x=1 grep x=1 "$1" x=1 -eu "$@" printf
+'quoted text' "$1" --verbose sed local ${HOME} --verbose 'quoted text' -eu echo
+	sed export 'quoted text' 2>/dev/null
+test "$@" grep 2>/dev/null ${HOME} sed export grep done -eu done
+	sed grep cd /usr/bin -eu sed | $(pwd) export grep --verbose grep test --verbose
+	"$1" 2>/dev/null printf -eu cd "$@"
+awk -eu "$@" x=1 grep
+	-eu /usr/bin --verbose done export /usr/bin x=1 2>/dev/null /usr/bin
+"$1" echo grep /usr/bin echo "$@" export /usr/bin
+	'quoted text' 'quoted text' cd done x=1 -eu local local echo
+&& ${HOME} echo -eu export 2>/dev/null --verbose
+	x=1 'quoted text' export | /usr/bin readonly
+readonly awk --verbose readonly "$1" export /usr/bin local "$1" -eu printf
+'quoted text' -eu $(pwd) sed grep local
+&& /usr/bin --verbose | awk grep "$1" | done awk echo test && awk 2>/dev/null
+done x=1 export cd test cd x=1 "$1" | "$1" ${HOME}
+		'quoted text' grep /usr/bin /usr/bin echo local echo
+		export cd awk ${HOME} "$1" sed && 2>/dev/null
+	'quoted text' local ${HOME} "$1" | grep grep then readonly 'quoted text' printf
+'quoted text' 'quoted text' --verbose grep && ${HOME} 'quoted text' $(pwd) local
+readonly export x=1 'quoted text' readonly $(pwd) echo /usr/bin 'quoted text'
+		2>/dev/null test printf -eu -eu test 'quoted text' $(pwd) printf test "$@" echo
+	grep then && cd echo awk --verbose
+	x=1 then readonly echo then x=1 test then
+		"$1" sed 2>/dev/null cd 2>/dev/null readonly ${HOME}
+	done && "$1" -eu $(pwd) 'quoted text'
+	"$1" test readonly ${HOME} x=1 $(pwd) -eu
+x=1 $(pwd) /usr/bin $(pwd) "$@"
+		echo $(pwd) sed then echo
+readonly ${HOME} -eu test | ${HOME} readonly echo "$@" 2>/dev/null
+		'quoted text' -eu 2>/dev/null 'quoted text' readonly /usr/bin readonly
+grep local $(pwd) x=1 awk done -eu ${HOME} && x=1 'quoted text' then --verbose
+	${HOME} sed echo awk export sed && awk --verbose
+	"$@" "$1" 2>/dev/null && then done printf done readonly && "$1" awk | grep $(pwd)
+	'quoted text' --verbose && "$1" $(pwd) sed local awk "$@" --verbose | -eu --verbose
+$(pwd) "$@" 2>/dev/null 2>/dev/null x=1 awk --verbose "$1" readonly
+&& ${HOME} && done ${HOME} ${HOME} export --verbose then printf 2>/dev/null awk
+	'quoted text' readonly printf done /usr/bin x=1 | readonly /usr/bin awk
+		grep | && then -eu cd cd /usr/bin
+	cd && local export printf grep ${HOME} x=1 ${HOME} then done grep &&
+	test $(pwd) export echo $(pwd) test cd printf local ${HOME} grep /usr/bin
+	2>/dev/null $(pwd) 'quoted text'
+	awk | /usr/bin printf /usr/bin --verbose then 'quoted text' /usr/bin awk ${HOME}
+		test export done grep x=1 'quoted text' sed local "$@" local --verbose
+		export grep local cd 'quoted text' $(pwd) 2>/dev/null && $(pwd) /usr/bin
+2>/dev/null /usr/bin awk
+2>/dev/null /usr/bin done 2>/dev/null
+	-eu --verbose /usr/bin | export cd then test
+	cd && 2>/dev/null ${HOME} done test "$@" echo
+		done $(pwd) cd done x=1 'quoted text' readonly -eu echo
+	x=1 then 2>/dev/null | && /usr/bin
+/usr/bin "$@" echo done cd printf readonly "$@" /usr/bin --verbose cd export
+echo readonly readonly | | sed then test && -eu readonly echo | export &&
+--verbose ${HOME} 'quoted text' done 'quoted text'
+	${HOME} local grep echo sed awk ${HOME}
+#include c7.sh
+		echo printf cd done 2>/dev/null x=1 then sed "$@"
+		&& then awk x=1 x=1 x=1 printf awk readonly done --verbose
+"$1" | local local sed cd /usr/bin export done echo test 2>/dev/null "$1"
+/usr/bin 2>/dev/null "$@" ${HOME} done 2>/dev/null then && test -eu x=1 $(pwd)
+		x=1 test x=1 --verbose
+	grep "$1" awk export export local "$@" 2>/dev/null then ${HOME} |
+	/usr/bin cd echo -eu done "$@" --verbose printf /usr/bin test --verbose
+		then ${HOME} export grep -eu ${HOME} x=1 $(pwd) done "$@"
+		cd test "$@" printf local
+	test 2>/dev/null cd awk 2>/dev/null -eu "$1" test sed cd cd test done echo ${HOME}
+readonly local cd then local test --verbose "$1" --verbose x=1 "$@" "$1"
+	x=1 local then cd export then ${HOME} --verbose /usr/bin readonly then ${HOME}
+sed done sed export export local local local test /usr/bin --verbose
+--verbose -eu then $(pwd) printf
+	cd readonly "$@" && echo echo
+		then readonly grep then "$@" -eu "$@" test
+	'quoted text' 2>/dev/null $(pwd) export sed grep /usr/bin local readonly 2>/dev/null
+	echo test /usr/bin awk x=1 --verbose "$@" awk 2>/dev/null readonly done
+	"$@" 2>/dev/null local --verbose cd export export 2>/dev/null /usr/bin printf
+		then /usr/bin test -eu sed readonly cd cd printf echo printf | && sed done
+		--verbose $(pwd) export test readonly | 'quoted text' awk 'quoted text' done
+		"$1" $(pwd) printf readonly export printf awk $(pwd) echo 2>/dev/null echo "$1"
+		export echo && awk awk done sed then ${HOME} local printf awk
+	test readonly /usr/bin grep x=1 local $(pwd) "$1" echo 2>/dev/null
+printf local "$1" grep grep | readonly
+export | ${HOME} done echo local
+readonly -eu export echo x=1 /usr/bin sed | local
+	$(pwd) /usr/bin "$@" /usr/bin "$1" --verbose grep local sed cd sed
+local 2>/dev/null && "$@" -eu "$1" then 2>/dev/null -eu "$1"
+	&& && readonly cd $(pwd) && export then 'quoted text' test then then
+	done --verbose echo 2>/dev/null -eu awk echo test && ${HOME} sed -eu x=1
+2>/dev/null sed printf /usr/bin then awk "$@" cd printf awk echo && "$1" /usr/bin
+		test cd x=1 --verbose printf sed done test local awk -eu --verbose readonly
+then "$@" echo | export "$1"
+		/usr/bin export echo printf grep x=1
+/usr/bin && done "$1" --verbose local local ${HOME} export export
+$(pwd) /usr/bin sed /usr/bin 'quoted text' "$@" ${HOME} then readonly readonly readonly
+	$(pwd) | readonly printf
+	"$1" /usr/bin printf export --verbose done | 2>/dev/null "$1"
+${HOME} printf /usr/bin --verbose export | echo $(pwd) x=1
+		test readonly awk cd export done | export local readonly awk ${HOME}
+	printf 'quoted text' $(pwd) done done cd
+	"$1" readonly x=1 --verbose cd
+		local printf | x=1 && printf x=1 cd "$@" -eu cd test -eu | awk
+done x=1 2>/dev/null --verbose then "$@" then cd then then cd printf done
+		export -eu | printf readonly --verbose $(pwd) local done echo -eu ${HOME}
+		-eu "$@" test x=1 2>/dev/null /usr/bin local $(pwd)
+then done -eu --verbose && && "$1" local
+		$(pwd) $(pwd) $(pwd) readonly | sed $(pwd) | "$@" cd --verbose then test
+		"$1" readonly test 2>/dev/null
+		grep /usr/bin x=1 && sed && local sed -eu awk "$1" sed "$@" "$1" cd
+/usr/bin --verbose grep
+--verbose local cd --verbose test
+		done x=1 local awk $(pwd) -eu cd /usr/bin x=1 2>/dev/null then
+2>/dev/null echo "$@"
+	cd $(pwd) done done sed done grep &&
+${HOME} echo grep $(pwd) $(pwd) readonly 2>/dev/null
+| local "$1" export readonly awk x=1
+	awk local grep cd export "$1" done printf
+$(pwd) ${HOME} /usr/bin grep then local | then | /usr/bin grep
+		export readonly $(pwd) /usr/bin $(pwd) && -eu $(pwd) readonly local -eu
+	readonly export then 2>/dev/null local /usr/bin
+test | sed cd ${HOME} /usr/bin "$1" test sed /usr/bin
+	"$1" "$@" && && | $(pwd) $(pwd) then echo $(pwd) --verbose readonly
+		then ${HOME} grep grep x=1 then local -eu 2>/dev/null
+awk done then x=1 ${HOME} "$1" $(pwd) x=1 -eu cd $(pwd) "$1" $(pwd)
+	-eu $(pwd) done --verbose ${HOME}
+	done sed then grep cd 'quoted text'
+		/usr/bin x=1 | && done "$@" --verbose | 'quoted text' --verbose --verbose
+grep printf grep x=1 2>/dev/null awk awk cd readonly 2>/dev/null
+		'quoted text' test ${HOME} 'quoted text' $(pwd) local readonly -eu test -eu --verbose
+	awk && --verbose x=1 test test "$1" && cd echo && done $(pwd) printf then sed
+	printf ${HOME} test sed cd --verbose test printf test export
+2>/dev/null then /usr/bin "$@" ${HOME} then cd
+2>/dev/null "$1" $(pwd) grep done x=1 -eu
+	local local then printf | -eu /usr/bin
+local cd 2>/dev/null test 'quoted text' sed grep local 2>/dev/null "$@" then
+		x=1 /usr/bin $(pwd) echo /usr/bin 2>/dev/null
+		readonly 'quoted text' x=1 --verbose test && x=1 awk readonly done x=1 done awk
+2>/dev/null x=1 --verbose awk sed echo && then
+sed cd && $(pwd) grep echo echo
+x=1 export awk $(pwd) $(pwd) ${HOME} x=1 then test | echo -eu
+x=1 local ${HOME} cd ${HOME} local done $(pwd) $(pwd)
+	export local echo 2>/dev/null
+	2>/dev/null printf ${HOME} --verbose /usr/bin
+		/usr/bin local grep grep 2>/dev/null
+then 2>/dev/null sed x=1 $(pwd) -eu --verbose
+	awk "$@" grep done printf 2>/dev/null $(pwd) && sed "$1" && $(pwd)
+	then /usr/bin ${HOME} done then local test | local echo "$1" "$1" --verbose
+		printf printf | $(pwd) x=1 then "$@"
+		| readonly ${HOME} local then local
+		printf "$@" cd done echo
+sed cd echo grep --verbose export export x=1 test export grep local export
+		/usr/bin readonly cd readonly printf echo grep test done && grep
+	export printf then && $(pwd) done echo $(pwd) sed 'quoted text' "$1"
+	export | | sed cd echo echo /usr/bin printf export "$@" readonly | readonly
+	readonly "$1" "$1" local 2>/dev/null printf --verbose
+		grep readonly 2>/dev/null
+		echo "$1" readonly local && echo export then test done --verbose 2>/dev/null
+readonly awk printf ${HOME} then readonly echo sed 'quoted text' ${HOME}
+		--verbose "$@" ${HOME} cd
+		$(pwd) then /usr/bin echo "$@" then "$1" $(pwd) $(pwd) echo 2>/dev/null
+		--verbose printf readonly x=1 "$1" then
+	/usr/bin $(pwd) /usr/bin ${HOME} /usr/bin $(pwd) 2>/dev/null "$1" $(pwd) "$@"
+x=1 export then $(pwd)
+		sed x=1 echo printf $(pwd) 'quoted text'
+"$1" test /usr/bin /usr/bin /usr/bin "$@" --verbose export
+sed 2>/dev/null | 'quoted text' ${HOME} 2>/dev/null
+"$@" /usr/bin test then "$1" printf export --verbose export
+echo && -eu x=1 x=1 | local then "$@" /usr/bin $(pwd) | ${HOME} --verbose x=1 awk
+	$(pwd) ${HOME} cd 2>/dev/null
+2>/dev/null x=1 ${HOME} grep ${HOME} cd local -eu "$1" sed /usr/bin $(pwd) test
+	$(pwd) $(pwd) done 2>/dev/null
+		${HOME} --verbose -eu cd "$1"
+	-eu echo -eu $(pwd) 2>/dev/null 2>/dev/null sed awk local "$1" --verbose
+echo $(pwd) test && local $(pwd) /usr/bin
+&& readonly $(pwd) /usr/bin done done /usr/bin -eu | local test && test cd && /usr/bin
+grep echo "$@" -eu "$@" printf then /usr/bin 'quoted text' grep then printf
+&& | local 2>/dev/null "$@"
+		test done $(pwd) /usr/bin "$@" ${HOME} $(pwd) && readonly && echo 2>/dev/null
+	grep readonly | && 'quoted text' grep 'quoted text' /usr/bin $(pwd)
+awk 'quoted text' printf "$1" /usr/bin $(pwd) then
+		/usr/bin ${HOME} test --verbose ${HOME}
+		-eu awk /usr/bin echo cd printf export "$1" "$1" local test sed | $(pwd) readonly
+		sed local -eu -eu --verbose
+		awk echo 'quoted text' | 'quoted text'
+		echo "$@" grep grep && awk cd "$1" x=1 $(pwd) test 'quoted text' && ${HOME}
+	x=1 /usr/bin printf -eu readonly export printf ${HOME} sed export x=1 ${HOME}
+cd local sed | sed 2>/dev/null export "$@" test printf -eu 'quoted text' 2>/dev/null
+	done printf | printf x=1 ${HOME} "$@" local x=1 awk awk | && echo /usr/bin
+&& awk -eu awk sed readonly /usr/bin echo
+grep | | export then "$@" grep 2>/dev/null ${HOME}
+	&& sed --verbose awk x=1 -eu
+		done -eu printf local printf
+		-eu sed "$@" && awk -eu sed 2>/dev/null readonly 2>/dev/null
+	'quoted text' "$@" then test sed | 2>/dev/null x=1 'quoted text'
+	cd ${HOME} echo echo local && | cd printf grep printf
+	awk echo "$1" grep awk 2>/dev/null $(pwd) awk | 2>/dev/null "$1" echo "$1" echo
+	local -eu 2>/dev/null $(pwd) "$1" -eu then && | printf done "$1" /usr/bin
+		| x=1 'quoted text' && echo
+	"$1" echo 2>/dev/null -eu
+	readonly x=1 done | | readonly awk 2>/dev/null | -eu
+| -eu 2>/dev/null "$1" $(pwd) $(pwd) | export
+	$(pwd) && x=1 done echo test done grep
+	done && sed test | sed printf && readonly /usr/bin
+readonly "$1" --verbose awk -eu $(pwd)
+		${HOME} then $(pwd) test "$@" done ${HOME}
+${HOME} -eu --verbose 'quoted text' && ${HOME}
+		| && test grep /usr/bin echo sed $(pwd)
+'quoted text' sed -eu export
+cd /usr/bin echo printf
+	echo --verbose readonly done grep test grep && -eu $(pwd) $(pwd) && 2>/dev/null
+	printf local | -eu awk local
+		local 'quoted text' cd --verbose awk echo cd readonly test 2>/dev/null
+readonly 'quoted text' awk $(pwd) ${HOME} 'quoted text' /usr/bin printf "$1" grep
+-eu local done readonly ${HOME} printf 2>/dev/null && --verbose
+	x=1 then "$@" readonly x=1 cd $(pwd) 2>/dev/null then ${HOME} 2>/dev/null "$1"
+	cd then printf printf | cd $(pwd) awk $(pwd) x=1 | cd && "$1" 2>/dev/null sed
+	cd $(pwd) "$@" 2>/dev/null --verbose awk then test | x=1 && |
+test $(pwd) readonly then --verbose
+x=1 cd "$@" grep printf | x=1 | | "$1" 2>/dev/null
+sed x=1 /usr/bin -eu printf grep echo printf cd echo export "$1" $(pwd) && &&
+/usr/bin 2>/dev/null "$@" "$@" --verbose 'quoted text' ${HOME} x=1 --verbose
+-eu | /usr/bin local local --verbose grep /usr/bin
+	awk cd --verbose then /usr/bin
+		awk test export "$@" readonly
+	grep test 2>/dev/null sed local -eu /usr/bin readonly 2>/dev/null
+x=1 ${HOME} | "$1" echo x=1 test local
+	sed 'quoted text' "$@" grep x=1 /usr/bin | awk
+sed /usr/bin | test then -eu ${HOME} awk awk
+	test x=1 $(pwd) export -eu "$@" | sed export printf
+		grep local --verbose "$@"
+		$(pwd) $(pwd) /usr/bin awk /usr/bin ${HOME}
+local export sed sed 2>/dev/null done awk 'quoted text' /usr/bin
+		--verbose 'quoted text' echo x=1 x=1 x=1 test 2>/dev/null &&
+"$1" awk /usr/bin 'quoted text' readonly | $(pwd) sed awk --verbose grep
+awk readonly test readonly
+		&& | grep | x=1 -eu $(pwd)
+	--verbose "$@" /usr/bin && "$@" then $(pwd) 'quoted text'
+		--verbose grep sed -eu export 2>/dev/null "$@"
+	echo grep done echo $(pwd) ${HOME} sed cd test grep sed test x=1 ${HOME} cd 2>/dev/null
+echo export export "$1" 'quoted text' | test grep $(pwd) -eu
+$(pwd) 2>/dev/null -eu --verbose grep readonly
+-eu 2>/dev/null awk x=1 export && ${HOME}
+		cd export echo $(pwd) sed
+${HOME} readonly /usr/bin 'quoted text' awk cd
+		2>/dev/null $(pwd) done
+		&& sed echo local test -eu
+grep readonly "$@" 'quoted text' printf --verbose grep printf export printf
+		"$1" --verbose echo "$1" test readonly
+printf awk 'quoted text' test --verbose then "$@" --verbose
+test 2>/dev/null "$@" then 2>/dev/null awk local 'quoted text' "$1"
+	cd | sed cd -eu echo printf awk awk "$1" 2>/dev/null && printf && "$@"
+		x=1 awk cd --verbose readonly
+	echo --verbose readonly ${HOME} sed -eu x=1 'quoted text' | | export
+	export cd 'quoted text' ${HOME} test cd ${HOME}
+awk sed printf sed && "$1" cd then echo -eu /usr/bin | grep then sed
+	done -eu x=1 printf grep
+| sed --verbose -eu echo --verbose readonly cd export
+${HOME} 'quoted text' echo --verbose cd cd done x=1 then export printf
+	"$1" readonly readonly 2>/dev/null cd awk local
+		| cd && printf done local printf test done /usr/bin /usr/bin
+	/usr/bin printf && grep --verbose &&
+		--verbose grep $(pwd) $(pwd) ${HOME} readonly
+	cd sed "$@" readonly then "$1" done "$1" test "$@"
+2>/dev/null readonly 'quoted text' local export
+		"$@" 2>/dev/null sed local "$1" 2>/dev/null $(pwd) cd /usr/bin sed /usr/bin -eu
+	&& 'quoted text' then x=1 echo | test --verbose printf --verbose
+2>/dev/null 2>/dev/null then export export then cd printf "$1" 2>/dev/null $(pwd)
+		/usr/bin export --verbose then cd --verbose 2>/dev/null "$1" sed "$@" "$@"
+'quoted text' printf $(pwd) cd echo printf x=1 printf ${HOME} export
+	x=1 2>/dev/null then echo 2>/dev/null local 2>/dev/null
+		/usr/bin printf sed cd x=1 "$@" cd test sed then test then
+	done 2>/dev/null ${HOME} sed
+grep "$1" --verbose $(pwd) test "$1" echo
+		-eu "$1" awk awk | test -eu awk | -eu echo
+	local cd echo --verbose sed test -eu $(pwd) sed $(pwd) then
+	-eu --verbose "$@" -eu echo grep test "$1" local /usr/bin
+	test x=1 ${HOME} "$1" sed awk test 'quoted text' local "$1"
+	"$1" local -eu then "$1" printf "$1"
+printf awk 'quoted text' x=1 readonly x=1 done $(pwd) grep readonly 'quoted text'
+	/usr/bin ${HOME} then echo then grep then "$@" sed awk awk
+	"$@" export 'quoted text' --verbose | x=1
+| "$1" -eu grep | echo "$1" grep echo -eu | | 'quoted text' done awk done
+awk sed export $(pwd) 2>/dev/null "$1"
+	then local sed ${HOME}
+	${HOME} test test grep x=1 awk && export x=1 ${HOME} done --verbose
+	-eu /usr/bin test | | done "$1" x=1 | && readonly sed cd grep 2>/dev/null
+		cd "$@" export done local
+local x=1 then | 'quoted text' readonly 2>/dev/null echo export 2>/dev/null
+$(pwd) -eu grep $(pwd) ${HOME}
+--verbose grep done "$1" "$1" x=1 $(pwd) "$1" "$@" ${HOME} awk
+		test done local --verbose 2>/dev/null local awk awk 'quoted text'
+grep 'quoted text' then test --verbose "$@" test echo $(pwd) ${HOME}
+	/usr/bin 'quoted text' local export "$1" | awk $(pwd)
+$(pwd) ${HOME} sed --verbose -eu local test echo $(pwd) sed printf --verbose
+		then x=1 $(pwd) grep done
+	/usr/bin ${HOME} $(pwd) then 'quoted text'
+"$1" done ${HOME} test
+		-eu "$@" x=1 "$@" grep 'quoted text' echo ${HOME} ${HOME} test
+	done "$@" ${HOME} printf readonly grep local test readonly sed local "$@" 'quoted text'
+	awk sed printf echo ${HOME}
+		grep "$@" | $(pwd) ${HOME} 'quoted text' 'quoted text' "$@" ${HOME}
+	${HOME} export --verbose export && 'quoted text' then "$1" printf "$1" 'quoted text'
+		export $(pwd) "$1" --verbose
+		'quoted text' ${HOME} 'quoted text' export "$1" "$@" $(pwd) done -eu ${HOME}
+		echo printf | export cd --verbose
+		done | printf test cd grep test
+		cd grep 2>/dev/null ${HOME} then -eu 'quoted text'
+	readonly && 'quoted text' "$1" test grep | cd
+	"$1" 'quoted text' then "$1" 2>/dev/null
+		| readonly -eu "$@" "$@" --verbose 2>/dev/null
+grep readonly printf -eu then then -eu && -eu awk readonly
+	readonly printf local "$@" cd ${HOME} sed 2>/dev/null --verbose
+		readonly "$1" ${HOME} 'quoted text' grep | grep printf | export | export --verbose
+		test readonly grep export --verbose grep 2>/dev/null echo "$1" echo grep sed "$@"
+test printf x=1 ${HOME} && && 'quoted text' -eu export done "$@" "$@" grep ${HOME}
+2>/dev/null ${HOME} echo cd x=1 && "$1" $(pwd) 2>/dev/null
+		printf 2>/dev/null -eu "$1" -eu
+-eu cd ${HOME} "$@" $(pwd) --verbose 'quoted text' echo test ${HOME} --verbose
+	--verbose printf && cd "$1" awk sed 2>/dev/null | export x=1 done local ${HOME}
+		export sed readonly ${HOME} $(pwd) grep --verbose
+	grep grep cd /usr/bin awk 'quoted text' | $(pwd) readonly
+		--verbose 'quoted text' x=1 "$@" "$1" /usr/bin awk
+		done done | "$@" test x=1 printf printf awk $(pwd) "$1"
+test -eu "$1" | $(pwd)
+"$1" "$1" -eu "$1" "$1" --verbose
+| ${HOME} 2>/dev/null "$@" done "$1" --verbose
+		"$@" grep ${HOME} sed local /usr/bin printf "$@" test awk ${HOME} "$@"
+	$(pwd) done echo ${HOME} done --verbose && $(pwd) | grep 2>/dev/null
+| /usr/bin echo x=1 grep 'quoted text' awk x=1 awk | readonly grep
+	cd awk awk && test x=1
+'quoted text' --verbose -eu awk awk test "$@"
+-eu x=1 && "$@" awk x=1 ${HOME} test then && x=1 sed $(pwd) export x=1 2>/dev/null
+		| $(pwd) sed ${HOME} x=1 done /usr/bin awk cd cd | x=1 readonly
+	x=1 export $(pwd) readonly
+"$@" export awk --verbose grep $(pwd) /usr/bin --verbose "$1"
+	grep "$1" 2>/dev/null && /usr/bin sed
+		sed then ${HOME} --verbose | && "$1" ${HOME}
+		&& --verbose | 2>/dev/null printf && then test 'quoted text'
+		echo local "$1" && -eu done test
+sed cd printf x=1 'quoted text' awk 2>/dev/null
+	"$1" echo ${HOME} | done export cd --verbose
+	&& sed ${HOME} grep readonly 'quoted text' 'quoted text' 2>/dev/null
+		export test 'quoted text' 2>/dev/null ${HOME}
+export ${HOME} test then
+done printf sed test test "$1" 2>/dev/null cd sed
+		$(pwd) done local sed 'quoted text' --verbose "$1" cd awk
+'quoted text' test test
+	grep then readonly --verbose && cd export "$@" local "$@" done grep cd 2>/dev/null
+		'quoted text' | then printf test done
+	&& "$1" printf -eu "$@" echo x=1 sed /usr/bin awk 'quoted text' "$1" "$@"
+	readonly 2>/dev/null "$1" awk $(pwd) | readonly "$1" ${HOME} done ${HOME} ${HOME}
+	--verbose -eu readonly "$1" sed test readonly
+test && x=1 done cd ${HOME} printf sed export cd --verbose test "$@"
+		-eu | 'quoted text' 2>/dev/null done "$@" "$1" x=1 -eu 'quoted text'
+	&& cd 2>/dev/null grep readonly /usr/bin grep
+		"$1" awk 2>/dev/null | grep then "$@" local "$@" --verbose 2>/dev/null
+done /usr/bin printf x=1 echo 'quoted text' sed 2>/dev/null x=1 ${HOME} cd
+	local | readonly | then "$1" test | printf awk cd test -eu
+	| $(pwd) readonly "$@" --verbose
+		'quoted text' /usr/bin done --verbose 2>/dev/null | $(pwd)
+	${HOME} --verbose "$@" && readonly awk --verbose
+		sed 2>/dev/null sed readonly --verbose /usr/bin then readonly done "$@" 'quoted text'
+&& /usr/bin sed "$1" done | done done done cd
+	2>/dev/null cd readonly 'quoted text' echo ${HOME} && awk grep then
+		printf 'quoted text' readonly "$@" readonly -eu done x=1 grep
+/usr/bin --verbose local grep && $(pwd) 2>/dev/null
+		sed "$@" "$1" ${HOME} 'quoted text' ${HOME} "$@" test 2>/dev/null
+	sed && 'quoted text' "$1" echo
+		local --verbose $(pwd) -eu "$@" sed --verbose 'quoted text' --verbose
+		test /usr/bin sed x=1 && local
+grep ${HOME} test "$1" 'quoted text' 'quoted text' done |
+	-eu --verbose "$@" echo x=1 /usr/bin test x=1 then && 'quoted text' /usr/bin
+	${HOME} | export 'quoted text' x=1 then printf done cd echo ${HOME}
+	-eu 'quoted text' 2>/dev/null x=1 /usr/bin done "$@" awk
+	readonly grep test "$@" echo test $(pwd) 2>/dev/null export done local | /usr/bin
+export -eu cd local sed 'quoted text' printf && test done echo
+	/usr/bin "$1" ${HOME} export 'quoted text' 2>/dev/null local printf 2>/dev/null
+	sed readonly --verbose sed awk x=1 -eu cd ${HOME} export readonly
+		--verbose awk $(pwd) echo --verbose /usr/bin "$@" grep -eu x=1 done cd
+	"$@" awk --verbose | readonly && x=1 awk export && local ${HOME}
+		echo $(pwd) "$@" then && echo 2>/dev/null | readonly "$@" | | --verbose |
+echo readonly then cd awk && ${HOME} test local | -eu
+		"$1" then 'quoted text' -eu sed /usr/bin | export
+test | 'quoted text' echo then done export sed printf sed printf echo
+local 2>/dev/null then local local grep | ${HOME} $(pwd)
+		test echo local readonly export
+cd sed "$@" 'quoted text' /usr/bin --verbose ${HOME} x=1 /usr/bin sed 2>/dev/null
+	export 'quoted text' test && | awk 2>/dev/null
+		&& && 'quoted text' printf "$@" ${HOME} export ${HOME} 'quoted text' ${HOME}
+		local sed && --verbose echo awk /usr/bin x=1 done $(pwd) printf export sed
+	--verbose test --verbose export
+"$1" printf cd local /usr/bin grep sed -eu local --verbose
+cd /usr/bin "$1" "$1" echo x=1
+printf grep readonly "$@" test test 2>/dev/null --verbose
+		export done local --verbose | grep /usr/bin test echo "$1" readonly --verbose /usr/bin
+	&& --verbose -eu "$1" x=1 $(pwd) -eu 2>/dev/null x=1 readonly awk -eu test grep
+"$1" echo x=1 x=1 ${HOME} -eu /usr/bin test awk x=1 grep then echo done "$@"
+		cd readonly -eu --verbose $(pwd) 'quoted text' then then test
+"$@" sed | export ${HOME} echo test ${HOME} awk test then
+		awk && && x=1 readonly sed | local x=1 | 2>/dev/null 2>/dev/null "$1" ${HOME}
+		${HOME} 2>/dev/null | "$1" --verbose /usr/bin ${HOME}
+		"$@" printf 'quoted text' readonly x=1 then awk && local then sed grep awk --verbose
+		sed cd sed readonly "$1" export 2>/dev/null 2>/dev/null 2>/dev/null 'quoted text'
+		test "$1" export && --verbose
+| test /usr/bin x=1 -eu "$@"
+		local /usr/bin -eu grep done sed awk grep ${HOME} printf readonly
+		test readonly grep local cd && export readonly cd
+		${HOME} cd grep $(pwd) "$1" 'quoted text'
+"$1" local 'quoted text' printf awk test export grep -eu
+	local x=1 printf | ${HOME}
+	--verbose 'quoted text' test sed export 2>/dev/null 'quoted text'
+	echo grep x=1 cd --verbose echo && echo x=1
+	test cd then "$@" ${HOME} && ${HOME} --verbose 2>/dev/null echo local printf
+	sed 'quoted text' x=1 $(pwd)
+	"$@" awk sed test grep cd echo 2>/dev/null /usr/bin export printf | then "$@"
+&& | printf /usr/bin cd && /usr/bin x=1 && export then printf awk --verbose
+	done then 2>/dev/null "$@" -eu test sed
+		-eu 'quoted text' "$1" 'quoted text' "$@"
+		local && /usr/bin grep "$1" ${HOME}
+| $(pwd) /usr/bin && readonly test
+readonly then local export local /usr/bin
+done grep | printf test --verbose $(pwd) 'quoted text'
+		then x=1 export echo done
+		sed 'quoted text' x=1 "$@" done echo cd readonly echo readonly printf
+readonly x=1 cd printf 'quoted text'
+	sed -eu readonly $(pwd) readonly
+| 'quoted text' printf grep && test "$1" local 'quoted text'
+	grep 'quoted text' printf printf 'quoted text' -eu &&
+test && sed grep "$1" sed export then "$@" sed sed printf -eu
+/usr/bin && "$1" awk printf $(pwd) awk
+awk printf 'quoted text' grep --verbose -eu /usr/bin cd
+	"$1" 2>/dev/null 2>/dev/null export awk ${HOME} | echo "$1" readonly
+export "$@" | 2>/dev/null
+grep $(pwd) ${HOME} "$@"
+--verbose awk x=1 local grep --verbose 2>/dev/null awk && -eu printf
+	-eu 2>/dev/null "$1" grep -eu awk x=1 /usr/bin sed
+		sed /usr/bin "$@" ${HOME} export 2>/dev/null 2>/dev/null then grep | readonly
+"$@" -eu test readonly local
+grep then "$1" awk && export --verbose 2>/dev/null
+"$1" readonly /usr/bin x=1 | $(pwd) echo
+	awk -eu | grep echo -eu --verbose
+$(pwd) done test sed $(pwd) $(pwd) local then grep local | export 'quoted text'
+	${HOME} $(pwd) $(pwd) export then echo sed local
+	2>/dev/null x=1 grep /usr/bin -eu then printf grep --verbose
+	readonly done x=1 /usr/bin
+done awk done test x=1 echo
+	test local x=1 awk 2>/dev/null "$@" printf test
+		cd 2>/dev/null readonly done "$1" /usr/bin
+		2>/dev/null /usr/bin test sed "$1" cd ${HOME} local export 'quoted text'
+		x=1 "$1" grep 'quoted text' /usr/bin grep | | $(pwd) && local && ${HOME} export
+test ${HOME} export && 'quoted text' "$1"
+'quoted text' /usr/bin done local echo "$1" "$@" printf sed grep |
+export -eu export | done 2>/dev/null
+sed "$1" "$@" ${HOME} 'quoted text'
+	echo awk test x=1 echo ${HOME} done |
+		2>/dev/null 'quoted text' ${HOME} 2>/dev/null then 2>/dev/null
+--verbose 2>/dev/null done test && 'quoted text' cd test
+	'quoted text' done "$1" done /usr/bin x=1 2>/dev/null $(pwd) "$@" "$@"
+	done sed export grep | 2>/dev/null readonly then
+sed -eu $(pwd) ${HOME} awk local && && readonly
+	2>/dev/null -eu then test export test test
+x=1 2>/dev/null 2>/dev/null printf export grep sed cd 2>/dev/null
+readonly cd sed done --verbose then echo echo readonly | readonly done -eu &&
+	readonly then cd readonly printf "$@" --verbose | -eu
+	$(pwd) done x=1 -eu test sed "$1" | --verbose done && test test readonly grep $(pwd)
+	| | sed done /usr/bin printf && |
+		test $(pwd) "$@" grep then 2>/dev/null done
+		/usr/bin "$1" 2>/dev/null readonly grep -eu printf ${HOME}
+	'quoted text' -eu "$1" "$@"
+	then export printf test then
+	2>/dev/null readonly && cd
+then 2>/dev/null | awk /usr/bin sed
+	&& awk echo export "$@" && then $(pwd) awk --verbose ${HOME} printf
+	"$@" 2>/dev/null grep 'quoted text' | sed --verbose awk
+	'quoted text' done && echo /usr/bin export sed printf "$1" test
+$(pwd) printf cd 2>/dev/null local | done test export 2>/dev/null grep export
+	echo /usr/bin $(pwd) sed readonly
+	printf 2>/dev/null && 2>/dev/null $(pwd)
+		readonly -eu 2>/dev/null 'quoted text' -eu x=1 test test | | test grep "$@"
+		--verbose printf 2>/dev/null
+		grep -eu --verbose x=1 'quoted text'
+		-eu printf cd /usr/bin done awk export 'quoted text' 'quoted text' done
+	done --verbose done local
+		2>/dev/null printf cd | && "$1" test done local ${HOME}
+x=1 x=1 | echo && $(pwd) | "$@" printf 'quoted text' then
+--verbose test 2>/dev/null test $(pwd) test $(pwd) /usr/bin echo --verbose
+&& grep x=1 "$1" export sed && "$1" printf then
+		x=1 2>/dev/null 2>/dev/null
+awk -eu sed echo -eu grep echo cd x=1 'quoted text'
+		| && | printf cd awk && local local
+x=1 --verbose cd ${HOME} then export 2>/dev/null cd printf cd -eu
+		test "$1" 2>/dev/null 2>/dev/null grep echo sed 2>/dev/null
+test printf "$1" "$@" cd then
+		'quoted text' echo then readonly awk /usr/bin sed readonly "$1" -eu --verbose
+	"$1" x=1 2>/dev/null printf --verbose
+printf && local /usr/bin test /usr/bin printf awk printf sed export
+		${HOME} echo printf $(pwd) | sed "$@" sed "$@" local --verbose echo
+	/usr/bin test awk sed printf printf printf | && awk done then ${HOME} | export
+	readonly ${HOME} x=1 | printf test "$1" ${HOME} 'quoted text' readonly
+		${HOME} export -eu sed local
+	"$1" cd export echo 2>/dev/null grep && ${HOME} done ${HOME} cd &&
+awk /usr/bin cd local x=1 | readonly done | sed $(pwd) $(pwd) awk sed
+done --verbose grep | export
+sed "$1" export readonly
+${HOME} 2>/dev/null then done awk /usr/bin readonly export export
+		cd test /usr/bin sed "$@" echo "$1" ${HOME}
+	$(pwd) -eu /usr/bin export grep 'quoted text'
+	readonly local $(pwd) $(pwd) --verbose printf 'quoted text' sed
+-eu -eu --verbose echo && /usr/bin ${HOME} done then readonly readonly cd printf
+cd local "$@" --verbose --verbose
+		| printf --verbose --verbose echo ${HOME}
+	${HOME} local && grep $(pwd) 'quoted text'
+	then readonly "$1" test cd && then 2>/dev/null /usr/bin
+	done grep -eu "$1" sed sed awk test x=1 sed sed --verbose awk "$@" readonly
+		--verbose 'quoted text' "$@" --verbose
+	2>/dev/null "$@" && sed done export grep awk printf printf 2>/dev/null /usr/bin
+	2>/dev/null "$@" local then 'quoted text' echo echo --verbose export --verbose
+		| | ${HOME} 'quoted text' export export local export done | x=1
+readonly test 'quoted text' test "$@" cd done --verbose
+then then -eu $(pwd) -eu printf awk printf 2>/dev/null
+	local readonly -eu export "$1" then echo -eu "$1"
+		printf then echo x=1 readonly
+-eu --verbose -eu cd grep --verbose export
+-eu 2>/dev/null ${HOME} "$@" sed
+	readonly $(pwd) -eu readonly $(pwd) x=1 printf && |
+	$(pwd) -eu printf x=1 | then x=1 && "$1" "$1" ${HOME} ${HOME} --verbose
+| x=1 grep && --verbose echo readonly "$@" export cd echo
+	"$@" sed export --verbose && "$@" export 2>/dev/null
+		local "$1" | grep sed x=1 export && readonly && /usr/bin
+	export test 'quoted text' then --verbose
+printf sed readonly 2>/dev/null "$@" then readonly cd "$1"
+		export then "$@" 2>/dev/null
+		${HOME} grep "$@" 'quoted text' echo done &&
+	echo x=1 sed /usr/bin $(pwd) 2>/dev/null && ${HOME} "$@" cd
+	echo grep grep then export echo 2>/dev/null
+		then && readonly && 'quoted text' --verbose echo printf
+	cd && readonly test export 2>/dev/null cd export awk done 'quoted text'
+2>/dev/null 2>/dev/null readonly && printf
+		test sed echo sed export --verbose awk readonly
+		&& "$@" --verbose ${HOME} x=1 printf | local /usr/bin ${HOME} echo
+	"$@" then echo "$1" 2>/dev/null
+	2>/dev/null then /usr/bin done $(pwd)
+		local grep ${HOME} --verbose
+	grep --verbose done | readonly
+	'quoted text' readonly cd | awk
+	printf local "$@" ${HOME} | && echo done local ${HOME} done done then
+	readonly readonly -eu then | "$1" x=1 echo
+done ${HOME} "$1" x=1 echo local /usr/bin 2>/dev/null | awk ${HOME}
+	sed printf /usr/bin done cd -eu && && export x=1 -eu $(pwd) | 'quoted text'
+	2>/dev/null cd | /usr/bin printf local test sed cd 2>/dev/null -eu
+	/usr/bin done --verbose && cd then ${HOME} -eu sed local ${HOME} local
+'quoted text' printf ${HOME} done local printf -eu readonly && ${HOME} /usr/bin
+-eu local echo printf printf export -eu "$1" awk test echo
+		sed test --verbose then /usr/bin "$1" then --verbose test done $(pwd)
+		-eu echo --verbose grep then export readonly
+/usr/bin grep /usr/bin awk "$1"
+	| sed printf done /usr/bin "$1" && export ${HOME} grep sed x=1 "$@" sed sed
+	echo ${HOME} /usr/bin ${HOME} cd then ${HOME} grep
+		readonly printf done -eu $(pwd) "$1" --verbose cd ${HOME} cd /usr/bin
+	printf readonly ${HOME} -eu "$1" then $(pwd) grep printf echo -eu && printf
+		local grep sed printf && ${HOME} --verbose
+awk printf $(pwd) && echo readonly awk then | export then sed --verbose then
+		"$@" sed grep printf /usr/bin && cd test readonly cd "$1" readonly printf 'quoted text'
+		'quoted text' $(pwd) 2>/dev/null x=1 awk then then 2>/dev/null echo $(pwd)
+		local 2>/dev/null | "$@" local then echo /usr/bin | printf
+		--verbose sed sed /usr/bin sed 'quoted text' $(pwd) ${HOME}
+		/usr/bin done export echo test | -eu $(pwd) awk readonly done
+	"$@" "$1" local done local 'quoted text' export "$@" test /usr/bin sed
+2>/dev/null awk test cd ${HOME} echo grep export local "$@" then /usr/bin
+	'quoted text' $(pwd) "$1" /usr/bin -eu readonly
+	grep printf sed test ${HOME} --verbose
+		| sed | -eu 'quoted text' sed -eu $(pwd) grep
+'quoted text' awk echo awk 2>/dev/null cd printf export test $(pwd)
+		"$@" 'quoted text' done /usr/bin ${HOME} sed x=1 2>/dev/null 'quoted text'
+		'quoted text' 2>/dev/null local /usr/bin 2>/dev/null
+	x=1 awk cd local then awk && && awk x=1
+	export | sed /usr/bin
+		| awk printf then echo awk local echo export /usr/bin cd ${HOME} then echo x=1
+		done ${HOME} printf "$1" $(pwd) sed
+		$(pwd) export && grep 'quoted text'
+sed $(pwd) 2>/dev/null sed --verbose "$1" --verbose done -eu --verbose echo
+		| awk x=1 printf 'quoted text' $(pwd) -eu --verbose /usr/bin
+	readonly && sed local done export export sed test local sed echo then $(pwd) "$1"
+	awk --verbose printf done $(pwd) && /usr/bin $(pwd) cd grep ${HOME} "$1" sed
+	/usr/bin ${HOME} x=1 /usr/bin awk | then 2>/dev/null -eu "$1" cd 2>/dev/null
+	then -eu done --verbose cd "$@" | echo then --verbose "$1" awk x=1 done
+	grep "$1" sed test 'quoted text' readonly printf sed && done "$@"
+	done then "$1" "$@" | ${HOME} local awk readonly echo --verbose
+'quoted text' -eu | export | printf local 2>/dev/null sed readonly
+"$1" echo local sed done $(pwd)
+		&& 2>/dev/null 2>/dev/null --verbose
+	'quoted text' sed ${HOME}
+		"$1" then "$1" "$@" printf
+	printf "$@" readonly printf sed x=1 $(pwd) export 2>/dev/null awk test ${HOME}
+	done "$@" "$@" --verbose awk sed -eu "$1" --verbose "$@" sed x=1 --verbose
+&& export grep local done 'quoted text'
+	export -eu test cd 2>/dev/null done x=1 readonly done $(pwd) "$@" $(pwd)
+	-eu --verbose echo -eu grep awk -eu then
+	readonly | ${HOME} grep -eu | --verbose
+	done then readonly --verbose then "$1" 2>/dev/null
+	awk "$@" && /usr/bin sed x=1 2>/dev/null | echo x=1 echo then awk
+$(pwd) ${HOME} echo $(pwd) "$@" sed
+	-eu -eu cd done -eu grep grep 'quoted text' && printf
+	x=1 -eu --verbose test -eu --verbose done "$1" export local -eu 2>/dev/null test
+		done /usr/bin && echo | 'quoted text'
+		"$1" printf export done "$@" awk 'quoted text' 'quoted text' done "$@" -eu readonly
+		printf "$@" && "$1" |
+		printf $(pwd) then then printf "$1" 2>/dev/null
+		grep awk -eu "$1" printf
+cd then sed done | echo export "$1"
+2>/dev/null ${HOME} x=1 'quoted text' "$@" export 2>/dev/null --verbose
+		"$@" -eu then echo 2>/dev/null local test "$@" sed "$@" sed test "$1"
+done test test awk "$1" cd --verbose
+		then cd ${HOME} | "$@"
+grep cd "$1" "$1" sed | printf
+	then $(pwd) then done ${HOME} local x=1 --verbose -eu test $(pwd) sed
+		echo && done --verbose cd sed x=1 grep | sed test ${HOME} && ${HOME} | "$1" $(pwd)
+2>/dev/null test && /usr/bin
+		&& 'quoted text' "$@" --verbose cd /usr/bin -eu done "$1" 2>/dev/null grep
+	${HOME} x=1 grep test 2>/dev/null
+		&& done | "$@" echo cd $(pwd) export test ${HOME} test awk then ${HOME} x=1 echo
+sed export test | "$1" cd grep $(pwd) grep readonly -eu local "$1" $(pwd) --verbose
+	then --verbose local sed 2>/dev/null
+awk --verbose x=1 readonly /usr/bin printf grep -eu --verbose "$1" 2>/dev/null awk
+		local printf readonly && && "$@" -eu grep -eu grep then grep cd ${HOME}
+'quoted text' x=1 "$@" ${HOME} "$@" 'quoted text' /usr/bin
+| then test then "$1" "$1" awk export then | awk 2>/dev/null 'quoted text' "$1"
+	-eu && then | printf export awk awk -eu
+		readonly local ${HOME} test -eu done local then -eu grep echo cd awk printf
+x=1 "$@" readonly --verbose done ${HOME} /usr/bin sed -eu awk sed "$1" export
+local | 2>/dev/null then printf && -eu ${HOME}
+	"$@" && done "$1" readonly local |
+	"$@" test ${HOME} 2>/dev/null
+&& cd | sed 'quoted text' && 2>/dev/null "$@" ${HOME}
+	echo grep printf grep done $(pwd)
+| && --verbose awk local cd "$1" |
+		${HOME} done test 2>/dev/null
+		test | /usr/bin test x=1 grep grep && -eu
+	sed export export $(pwd) -eu test x=1 grep done grep "$@" local "$@" -eu printf
+		export ${HOME} test grep 'quoted text'
+${HOME} "$1" ${HOME} 2>/dev/null awk && grep sed
+$(pwd) $(pwd) readonly /usr/bin && test "$@" $(pwd)
+		sed && then cd $(pwd) done grep
+export ${HOME} | grep
+		done local 'quoted text' "$@" 'quoted text' --verbose sed awk -eu
+		local ${HOME} export && "$@" && 2>/dev/null local test 2>/dev/null
+&& /usr/bin readonly "$1"
+		&& export sed && grep 2>/dev/null
+	-eu "$1" cd -eu cd then awk --verbose 2>/dev/null printf echo ${HOME} grep printf
+		'quoted text' done printf "$@" "$@" | awk test /usr/bin test readonly "$1"
+cd --verbose ${HOME} awk done test | "$1" local && && cd then
+	sed /usr/bin then test sed /usr/bin -eu ${HOME} x=1 done awk "$@" cd then
+		grep then done then grep sed
+	done printf grep x=1 done sed sed grep awk done "$@" awk "$1" export
+	printf local $(pwd) "$1" echo
+x=1 2>/dev/null /usr/bin grep printf local 'quoted text' "$@" sed test 2>/dev/null
+	&& test printf sed readonly grep
+| -eu sed x=1 ${HOME} $(pwd)
+&& done export | "$@" "$1" grep 2>/dev/null "$1"
+	"$@" x=1 done | | ${HOME} /usr/bin done readonly grep /usr/bin test test x=1
+	done "$@" $(pwd) x=1 2>/dev/null sed
+	&& "$1" cd then 'quoted text' grep ${HOME} $(pwd) /usr/bin printf x=1 'quoted text'
+	| | ${HOME} 'quoted text' 'quoted text' "$@" 'quoted text' --verbose local
+	then grep "$@" grep export x=1 readonly printf 'quoted text' sed $(pwd)
+grep "$@" cd -eu "$@" $(pwd) test
+	$(pwd) grep 'quoted text' $(pwd) && x=1 printf "$1" done /usr/bin | -eu
+	"$1" local /usr/bin "$@" 'quoted text'
+	done 2>/dev/null grep echo --verbose "$@" | "$1" "$1" sed then
+	readonly test $(pwd) 2>/dev/null
+2>/dev/null local readonly
+x=1 done -eu awk readonly grep 'quoted text' local |
+awk && 'quoted text' && done 'quoted text'
+	test | export $(pwd) ${HOME} export grep done local printf -eu | x=1 "$@" -eu echo
+		printf | local | /usr/bin printf
+	sed readonly printf grep $(pwd) | done awk export "$1" local 2>/dev/null | | grep
+	done x=1 done then done export /usr/bin done awk echo cd sed ${HOME} --verbose
+		"$@" done done then then "$1" echo then -eu "$1" printf done
+"$@" grep x=1 cd sed local cd 'quoted text' | printf --verbose
+echo cd cd $(pwd) echo "$1" ${HOME} -eu echo 'quoted text' sed /usr/bin ${HOME}
+${HOME} x=1 "$1" echo -eu sed && 2>/dev/null
+		| printf cd sed grep && cd cd --verbose
+readonly /usr/bin printf | && readonly
+'quoted text' 'quoted text' ${HOME} 2>/dev/null sed export x=1
+done test awk "$@" export "$@" /usr/bin
+		/usr/bin | && printf grep grep printf 2>/dev/null export sed then
+printf && printf | awk "$1" local readonly local cd local | done
+	"$1" "$1" grep cd then $(pwd) 2>/dev/null test | --verbose awk echo --verbose
+		"$1" "$1" local "$1" awk then && sed printf awk "$@" awk then 'quoted text' --verbose
+"$1" ${HOME} "$@" done && x=1 -eu export
+	grep local -eu 'quoted text' "$1" export "$1" 'quoted text' echo -eu export
+readonly local x=1 sed printf "$@" "$1" ${HOME}
+$(pwd) "$1" awk && "$1" awk printf
+	$(pwd) /usr/bin | | echo done done then $(pwd)
+	"$@" && --verbose test --verbose "$1" echo /usr/bin export test grep sed
+	--verbose readonly echo local 'quoted text' ${HOME} local echo /usr/bin /usr/bin
+	cd readonly $(pwd) printf -eu | cd 2>/dev/null cd then test echo "$1" done
+"$@" sed ${HOME} readonly $(pwd) readonly cd test sed export
+"$@" then sed --verbose $(pwd) echo /usr/bin /usr/bin
+	printf test export && $(pwd) && test &&
+	/usr/bin x=1 -eu sed sed export printf --verbose printf readonly 'quoted text' then
+"$1" sed export $(pwd) ${HOME} then test 2>/dev/null echo "$@" 'quoted text'
+		/usr/bin && awk 2>/dev/null sed echo ${HOME} "$@" "$1"
+		then grep --verbose sed readonly echo "$@" 'quoted text' 2>/dev/null "$@" done
+done echo "$1" readonly ${HOME} echo grep cd
+		"$1" sed $(pwd) export test "$1" && test $(pwd) 2>/dev/null --verbose | 'quoted text'
+		--verbose x=1 | readonly sed -eu export $(pwd) awk cd 2>/dev/null then
+		export test grep readonly test 2>/dev/null
+	echo "$@" awk /usr/bin /usr/bin
+	cd --verbose "$@" export 2>/dev/null --verbose
+		test -eu export -eu "$@" printf done echo echo echo done | cd
+	echo $(pwd) sed then && awk echo
+		grep then ${HOME} "$@" && awk "$1" echo x=1 --verbose
+	| --verbose local printf && "$@" echo 2>/dev/null 2>/dev/null
+		echo local 2>/dev/null | grep 2>/dev/null "$@" local 2>/dev/null 'quoted text'
+		cd sed sed | "$1" 2>/dev/null 2>/dev/null local ${HOME}
+		"$@" grep /usr/bin cd cd
+	${HOME} && x=1 x=1 test awk readonly readonly done readonly cd cd done
+		&& | then && cd readonly "$1" readonly "$@" grep cd
+	${HOME} awk ${HOME} export done
+		"$@" then x=1 readonly test printf && awk done awk 2>/dev/null
+	then printf printf local then ${HOME} local grep $(pwd)
+		test cd | $(pwd) -eu $(pwd) done readonly "$1" /usr/bin sed -eu 'quoted text'
+	| 'quoted text' cd test then echo cd readonly cd echo $(pwd) $(pwd) printf done
+	awk echo | cd | 2>/dev/null done "$1" grep then x=1 grep 2>/dev/null export
+		'quoted text' "$1" --verbose grep sed
+-eu grep done x=1 x=1 /usr/bin
+awk --verbose readonly | "$@" grep test
+	| then test x=1 local readonly -eu /usr/bin
+/usr/bin local echo && grep x=1 /usr/bin sed "$1" x=1 then "$@" | readonly 2>/dev/null
+	${HOME} | 'quoted text' cd awk local -eu
+	cd 2>/dev/null cd x=1 'quoted text' local local
+	readonly test 2>/dev/null awk x=1 done local x=1 export awk sed $(pwd)
+&& readonly then "$1" cd grep x=1 echo grep --verbose
+${HOME} echo "$@" local "$@" 'quoted text'
+	done "$1" printf then -eu local /usr/bin
+"$@" cd 2>/dev/null export /usr/bin
+	sed x=1 'quoted text' printf && "$@" ${HOME} grep
+	'quoted text' && readonly "$1" echo grep
+sed && export | awk "$@" /usr/bin printf printf awk /usr/bin | grep printf
+export /usr/bin then x=1 grep cd -eu
+/usr/bin 2>/dev/null $(pwd) /usr/bin 2>/dev/null ${HOME} --verbose
+	grep --verbose export cd 'quoted text' echo echo 2>/dev/null ${HOME} grep --verbose
+	printf echo done | local | then cd "$@" then printf local readonly "$@"
+		&& | done grep | echo | cd test | && -eu done printf readonly "$@" test
+${HOME} test --verbose test printf ${HOME} ${HOME} cd readonly sed 2>/dev/null
+	local --verbose "$1" cd "$1" printf export then awk grep then &&
+	test then /usr/bin done echo echo readonly readonly cd && "$@"
+	echo cd && printf echo ${HOME} awk && /usr/bin 'quoted text'
+echo --verbose /usr/bin | /usr/bin
+readonly --verbose sed /usr/bin sed local echo export x=1 x=1
+		awk echo && cd done ${HOME} sed | ${HOME} then export
+		"$1" && sed ${HOME} readonly
+	| 2>/dev/null ${HOME} -eu /usr/bin -eu done --verbose && awk
+	cd grep done "$@" 'quoted text' awk done 'quoted text' export 'quoted text' "$1"
+	--verbose 2>/dev/null done readonly 2>/dev/null then | | -eu x=1
+		export sed grep && "$@" cd | export x=1 'quoted text' grep export printf
+"$@" --verbose -eu x=1 "$@" "$1" sed 'quoted text' grep "$@" then -eu echo
+		awk -eu 2>/dev/null done | "$@"
+		${HOME} | ${HOME} 2>/dev/null
+printf && then && awk | x=1 export
+'quoted text' sed printf $(pwd) "$1" then -eu local 'quoted text' printf
+		"$1" $(pwd) "$1" 'quoted text' && -eu 'quoted text' -eu echo x=1 cd sed then
+--verbose cd | -eu cd $(pwd) done --verbose --verbose "$@" 'quoted text'
+		readonly cd "$@" readonly then 2>/dev/null cd x=1 ${HOME} grep
+		export printf export awk printf
+--verbose test /usr/bin -eu cd
+	2>/dev/null cd "$@" cd awk --verbose grep cd sed done --verbose local
+done cd | | | "$@" --verbose
+		cd 'quoted text' cd /usr/bin
+"$1" grep && readonly --verbose
+		local sed readonly 'quoted text' --verbose
+| /usr/bin done -eu then
+	--verbose -eu 2>/dev/null sed grep then &&
+		cd x=1 x=1 "$@" sed -eu x=1 export /usr/bin readonly awk export echo /usr/bin
+$(pwd) --verbose done --verbose test printf $(pwd) test sed -eu x=1 /usr/bin
+		"$1" && /usr/bin x=1 echo
+/usr/bin echo test readonly done 'quoted text' 'quoted text'
+/usr/bin -eu then readonly local "$1" && x=1 $(pwd) x=1 | 2>/dev/null
+		&& 'quoted text' grep $(pwd)
+		done export 2>/dev/null cd awk --verbose
+"$1" "$1" $(pwd) then /usr/bin $(pwd) && | -eu awk readonly
+	echo /usr/bin ${HOME} /usr/bin sed "$1" 'quoted text' x=1 2>/dev/null
+		printf echo test test grep cd -eu echo 2>/dev/null x=1 && "$@"
+	| done readonly readonly && sed "$@" /usr/bin --verbose "$@" cd "$1" /usr/bin
+&& local | grep $(pwd) printf
+"$1" -eu sed readonly grep --verbose echo "$1" && echo grep local
+		"$1" grep cd --verbose x=1
+${HOME} | awk echo /usr/bin done local /usr/bin 2>/dev/null 'quoted text'
+		local x=1 x=1 test "$@" awk printf
+export "$@" then /usr/bin /usr/bin echo
+readonly done --verbose && 'quoted text' export x=1 sed "$@" local local
+		done $(pwd) readonly 'quoted text' --verbose
+		awk local sed grep grep
+		then readonly export local "$@" cd "$1" echo test test && ${HOME} printf
+then 2>/dev/null export --verbose -eu --verbose readonly x=1 then local
+		2>/dev/null --verbose sed && 2>/dev/null
+	$(pwd) | printf then then "$@" ${HOME} then 2>/dev/null
+		cd export test cd 'quoted text' then --verbose
+grep local ${HOME} "$1" /usr/bin && export export -eu 2>/dev/null $(pwd) readonly
+test 2>/dev/null "$1" && local awk printf
+	local test $(pwd) sed done printf awk cd 2>/dev/null 'quoted text'
+2>/dev/null "$@" x=1 sed && cd
+		$(pwd) && printf -eu done "$1" test
+	readonly sed export --verbose x=1 ${HOME} 'quoted text' done readonly
+		| x=1 then readonly grep echo local awk x=1 "$@"
+readonly $(pwd) /usr/bin ${HOME} echo $(pwd) echo $(pwd) $(pwd)
+		test 'quoted text' /usr/bin echo /usr/bin $(pwd) local $(pwd) ${HOME} echo
+cd "$1" ${HOME} && 2>/dev/null
+"$@" -eu sed "$@" --verbose x=1 grep 'quoted text'
+		echo readonly "$1" && 2>/dev/null && grep | "$1" -eu ${HOME} export "$@"
+		echo readonly 'quoted text'
+		&& grep grep done -eu readonly &&
+		/usr/bin local -eu printf
+		-eu local then then /usr/bin done grep "$1" test /usr/bin test grep /usr/bin
+--verbose --verbose printf local local echo
+-eu echo local | export sed test /usr/bin
+| --verbose /usr/bin 2>/dev/null
+	local ${HOME} "$1" /usr/bin then echo && "$1" /usr/bin echo local 2>/dev/null
+	$(pwd) cd test cd sed 'quoted text' test "$1" /usr/bin local x=1 echo export
+/usr/bin printf "$@" | $(pwd) "$1" grep test 'quoted text'
+	--verbose 'quoted text' test /usr/bin grep then done -eu export | readonly
+		$(pwd) done export "$@" then cd /usr/bin && printf
+--verbose "$@" cd --verbose | "$1" --verbose /usr/bin echo ${HOME} /usr/bin
+		"$@" export "$1" 'quoted text' done
+		export echo printf done 'quoted text'
+grep 'quoted text' | printf
+x=1 'quoted text' x=1 awk done
+	awk then grep echo "$1" printf 'quoted text'
+	${HOME} --verbose done | "$@" 2>/dev/null | cd x=1 "$@" test grep -eu -eu sed
+	sed test "$@" 'quoted text'
+2>/dev/null grep then test && -eu readonly
+		&& done --verbose local done export | /usr/bin
+${HOME} local then awk local sed 2>/dev/null && x=1 /usr/bin echo /usr/bin
+	"$@" "$1" cd readonly local --verbose
+	then awk export "$@" cd sed
+		then ${HOME} | --verbose ${HOME}
+x=1 echo /usr/bin export /usr/bin
+		then test 'quoted text' "$1" --verbose cd
+		local $(pwd) "$@" | test export | --verbose "$@" /usr/bin test $(pwd)
+	"$@" echo export $(pwd) awk export "$@" 'quoted text' $(pwd) echo grep $(pwd)
+		"$1" "$1" && printf test /usr/bin local export test
+--verbose "$1" printf awk -eu && awk -eu test readonly "$@" ${HOME}
+test grep "$1" x=1 printf | local cd test | -eu local awk
+	x=1 'quoted text' x=1 cd x=1 readonly cd -eu readonly 2>/dev/null done ${HOME}
+		&& $(pwd) local -eu ${HOME} x=1 cd ${HOME} export "$1" /usr/bin
+'quoted text' -eu echo "$@" awk awk local sed
+	then echo 'quoted text' 'quoted text' "$1"
+		${HOME} 'quoted text' cd ${HOME} x=1 echo
+cd export 'quoted text' local | done done 'quoted text' "$1" echo
+		local export && "$1" test "$@" && x=1
+/usr/bin && grep "$1" && readonly awk
+done sed /usr/bin export
+sed cd then export awk && then test x=1
+	/usr/bin readonly "$1" 'quoted text' 'quoted text' | && export x=1 grep then
+"$@" --verbose /usr/bin "$@" "$@"
+		"$1" /usr/bin && printf export --verbose "$1" x=1 export
+	2>/dev/null "$@" readonly --verbose 'quoted text' export -eu "$@" x=1 'quoted text'
+	--verbose -eu done 'quoted text' "$@" x=1 --verbose
+readonly grep echo test done "$@" | 2>/dev/null sed $(pwd)
+	"$@" 'quoted text' export "$1" /usr/bin | done cd "$1" $(pwd) -eu -eu
+	cd local 2>/dev/null --verbose printf 'quoted text' cd --verbose cd $(pwd) x=1
+	| grep "$@" x=1 'quoted text' then "$@" "$1" /usr/bin --verbose then printf awk
+		x=1 local export then -eu done ${HOME} "$1" &&
+	sed "$1" --verbose && ${HOME} readonly && | && awk
+	readonly awk "$1" test 2>/dev/null x=1
+	/usr/bin done --verbose x=1 | printf -eu $(pwd) local 'quoted text' x=1
+x=1 sed && cd test ${HOME} --verbose
+grep awk 2>/dev/null cd &&
+		| cd "$@" | "$@" 'quoted text' export local -eu test $(pwd) /usr/bin
+local 'quoted text' "$@" done echo echo
+		"$1" awk "$1" "$@" "$1" -eu done test -eu awk -eu echo readonly | local
+		local readonly readonly printf && $(pwd) then --verbose sed cd /usr/bin
+/usr/bin 2>/dev/null 'quoted text' grep | local awk test test 2>/dev/null
+	local /usr/bin -eu "$@" then "$1" 'quoted text' --verbose done "$@" 2>/dev/null
+		&& sed then readonly "$@" | test 2>/dev/null && then printf
+	echo echo $(pwd) printf awk /usr/bin grep
+		'quoted text' cd test readonly
+	echo sed test echo export ${HOME} cd | ${HOME} /usr/bin 'quoted text'
+	| export grep -eu $(pwd) | printf "$@" x=1 ${HOME} 2>/dev/null "$@" export x=1
+	cd | "$@" && local readonly local
+	awk readonly "$1" echo /usr/bin echo printf 'quoted text' &&
+	done readonly test --verbose "$1" sed export echo export readonly echo --verbose
+	readonly 2>/dev/null 2>/dev/null echo then echo export
+	--verbose "$@" local grep test awk done --verbose cd $(pwd) cd export /usr/bin
+		| "$1" then --verbose
+$(pwd) x=1 "$@" sed $(pwd) readonly
+	/usr/bin awk 2>/dev/null local printf awk sed test ${HOME} done "$1" "$1" readonly
+		echo grep local then --verbose printf "$@" echo then then
+'quoted text' grep $(pwd)
+"$@" export "$1" 2>/dev/null "$@" awk
+		readonly echo cd test then | cd --verbose echo cd 2>/dev/null 2>/dev/null
+test readonly 'quoted text' local grep cd
+echo && cd $(pwd) then "$1" 'quoted text' | &&
+		local 'quoted text' cd done $(pwd) then test "$@" x=1 "$1" local --verbose --verbose
+		export export 'quoted text' ${HOME} $(pwd) export | "$@" $(pwd) x=1 --verbose --verbose
+	grep "$@" grep export -eu cd sed sed printf 2>/dev/null sed
+grep $(pwd) cd echo x=1 cd echo cd /usr/bin
+	test test grep awk -eu 'quoted text'
+	echo awk -eu $(pwd) then | -eu 2>/dev/null 2>/dev/null
+	"$@" echo awk | awk "$1" /usr/bin 2>/dev/null readonly | readonly x=1 $(pwd) grep
+"$@" readonly --verbose $(pwd) 2>/dev/null printf grep printf
+		"$@" --verbose "$1" grep local grep "$@" "$@" sed test printf grep "$1" 'quoted text'
+		sed echo then cd cd ${HOME} $(pwd)
+$(pwd) 2>/dev/null cd
+		"$1" | 2>/dev/null 'quoted text' cd export awk
+	export 'quoted text' 'quoted text' then 2>/dev/null && cd "$1" 2>/dev/null then
+		"$@" --verbose then --verbose /usr/bin x=1 x=1 'quoted text' "$1"
+sed local grep x=1 test /usr/bin /usr/bin
+	cd "$1" cd --verbose x=1
+		2>/dev/null 'quoted text' "$@" sed awk done awk local cd echo
+		x=1 /usr/bin awk -eu "$@" "$1" export -eu readonly && cd grep
+&& test sed printf local && "$@" cd --verbose
+echo && -eu test cd readonly sed export
+	awk then 2>/dev/null export --verbose --verbose done
+	"$@" -eu grep /usr/bin x=1 then "$1" awk "$@"
+		&& export | printf -eu then echo "$@"
+	local /usr/bin 2>/dev/null --verbose x=1 --verbose "$1" $(pwd)
+	test local done export cd x=1 "$@" then
+		export $(pwd) "$@" && awk done local test | grep sed echo
+		| echo --verbose 'quoted text' test && /usr/bin /usr/bin -eu x=1 && "$1" x=1
+		2>/dev/null awk export test -eu -eu done grep ${HOME} --verbose then
+&& 2>/dev/null printf export readonly 2>/dev/null ${HOME} 'quoted text'
+	'quoted text' printf 'quoted text'
+	printf "$1" export printf sed -eu "$@" 'quoted text' then
+-eu x=1 cd export readonly test local sed sed $(pwd) x=1 readonly
+		x=1 ${HOME} readonly "$1" done then cd 'quoted text' echo
+	-eu | x=1 --verbose test readonly export x=1 local 2>/dev/null
+		/usr/bin | ${HOME} -eu readonly readonly test && | "$1"
+	test 2>/dev/null x=1 -eu "$1" "$@" 'quoted text'
+	echo then local sed grep $(pwd)
+	test x=1 "$@" export -eu x=1 2>/dev/null test --verbose grep ${HOME}
+	then $(pwd) ${HOME} ${HOME} local
+		"$1" cd "$@" test ${HOME} && done
+	'quoted text' cd -eu /usr/bin $(pwd) x=1 then
+echo local printf cd x=1 echo "$1"
+		grep readonly printf then "$1" echo printf awk test grep readonly
+		-eu then awk "$@" grep x=1 grep grep "$1" local --verbose 'quoted text'
+| -eu --verbose sed 2>/dev/null --verbose
+		| sed 'quoted text' --verbose awk x=1 then printf -eu
+		--verbose 2>/dev/null x=1 sed -eu printf echo test ${HOME}
+	printf --verbose cd --verbose then | cd --verbose
+		readonly "$1" 'quoted text' printf test awk readonly "$1" done local
+echo /usr/bin awk "$@" /usr/bin "$1" -eu cd
+		done x=1 'quoted text' | 2>/dev/null then printf x=1 x=1 "$@"
+		echo "$@" $(pwd) -eu "$@" test printf ${HOME} $(pwd) ${HOME}
+		echo "$@" 'quoted text' -eu $(pwd) then done local /usr/bin test
+	echo export x=1 awk ${HOME} sed $(pwd) --verbose 2>/dev/null sed
+printf test | 'quoted text' done awk ${HOME}
+printf --verbose export && $(pwd) /usr/bin | x=1 | readonly 2>/dev/null "$1"
+		&& readonly grep awk | "$1" done sed "$1" x=1 'quoted text' sed -eu "$@" -eu
+		test awk done test -eu awk sed grep sed "$1" test --verbose $(pwd) "$1"
+done "$1" local "$1" cd --verbose | "$1" then -eu
+	local -eu "$1" echo x=1 'quoted text' && --verbose
+	then then sed && -eu then 2>/dev/null
+export | sed $(pwd) echo
+		awk sed then awk && then -eu test sed "$@" done
+	&& --verbose /usr/bin 2>/dev/null 'quoted text'
+	"$1" test -eu -eu /usr/bin sed grep then readonly -eu x=1 local awk cd
+		awk /usr/bin test x=1 x=1 "$@"
+		then printf cd && cd /usr/bin
+done readonly $(pwd) cd local /usr/bin -eu local --verbose $(pwd)
+	--verbose echo grep local local /usr/bin ${HOME} ${HOME} awk $(pwd)
+local ${HOME} ${HOME} 2>/dev/null then 2>/dev/null echo "$1" $(pwd) 2>/dev/null
+		"$1" test grep echo local test then --verbose
+		'quoted text' | "$@" test
+	$(pwd) 'quoted text' local --verbose $(pwd) 2>/dev/null done --verbose x=1
+	done cd cd ${HOME} local | local "$@" $(pwd) "$@" ${HOME} local && 'quoted text'
+	$(pwd) test "$1" && x=1 x=1 cd && awk
+&& 'quoted text' test 2>/dev/null done cd test sed --verbose export
+	awk export done sed /usr/bin sed 'quoted text' 2>/dev/null
+		local done | grep local done | --verbose then sed $(pwd) test printf
+		"$1" test export "$1"
+		export 2>/dev/null 'quoted text' done local --verbose
+	x=1 'quoted text' cd echo 'quoted text' local "$@" -eu && local 'quoted text'
+		export 2>/dev/null /usr/bin cd /usr/bin test --verbose printf
+		readonly /usr/bin sed readonly
+	then ${HOME} done --verbose
+done printf ${HOME} local --verbose
+	done && ${HOME} && | --verbose "$1" ${HOME} echo x=1 && $(pwd) done readonly
+&& local awk -eu readonly awk export -eu $(pwd) readonly
+	| ${HOME} 'quoted text'
+--verbose /usr/bin test -eu -eu test grep --verbose "$1" printf printf
+| "$1" 'quoted text' 2>/dev/null echo awk | test export printf
+		export --verbose local grep cd grep
+2>/dev/null | /usr/bin 'quoted text' then test 'quoted text'
+		test echo grep local 2>/dev/null /usr/bin done $(pwd) "$1"
+| 2>/dev/null 2>/dev/null "$1" export x=1 | grep |
+	"$@" cd then test sed --verbose 2>/dev/null
+	-eu 2>/dev/null "$@" x=1 $(pwd) -eu &&
+	readonly x=1 awk printf 2>/dev/null test --verbose x=1 done readonly 2>/dev/null
+test 2>/dev/null echo test "$@" grep /usr/bin
+		"$1" then --verbose | 2>/dev/null "$1" $(pwd) readonly "$1" then then cd /usr/bin
+readonly readonly test --verbose
+	| -eu local local -eu done
+sed local grep printf 'quoted text'
+		2>/dev/null ${HOME} && 'quoted text' | then $(pwd) --verbose
+	$(pwd) ${HOME} printf done 'quoted text' done $(pwd) sed sed
+&& 'quoted text' "$1" | grep x=1
+		$(pwd) sed "$@" local x=1 -eu echo 2>/dev/null | grep printf --verbose 2>/dev/null
+| ${HOME} echo export && 2>/dev/null cd echo readonly
+		grep ${HOME} ${HOME} awk | |
+		${HOME} test readonly sed export
+	awk /usr/bin && awk sed local -eu 2>/dev/null
+		--verbose local printf "$1" && /usr/bin /usr/bin && 2>/dev/null
+		/usr/bin ${HOME} test --verbose 'quoted text' printf 'quoted text'
+		local "$@" | 2>/dev/null
+		&& then awk ${HOME} test | "$1" 2>/dev/null echo done echo x=1 ${HOME}
+sed cd && --verbose x=1 ${HOME} /usr/bin 'quoted text' awk sed ${HOME} "$1"
+	local "$@" test local ${HOME} "$1" /usr/bin test done $(pwd) readonly
+/usr/bin done ${HOME} cd
+| /usr/bin 'quoted text'
+grep done /usr/bin | export echo grep
+	${HOME} /usr/bin 'quoted text' && readonly then then then readonly cd x=1
+		readonly | | then 'quoted text' /usr/bin "$@"
+		-eu && /usr/bin -eu test
+		printf echo x=1 readonly cd x=1 2>/dev/null 'quoted text' | local 'quoted text'
+	grep $(pwd) awk sed echo readonly cd awk local grep "$1" 2>/dev/null
+	cd $(pwd) && 2>/dev/null 'quoted text' then && readonly grep
+printf grep /usr/bin grep "$@"
+printf --verbose then 'quoted text' sed
+export sed /usr/bin "$@" x=1 x=1 ${HOME} sed grep ${HOME} "$1" readonly --verbose
+	"$1" local awk export ${HOME} ${HOME} x=1 'quoted text' done grep
+-eu 2>/dev/null -eu export ${HOME} 2>/dev/null "$@" awk
+		${HOME} ${HOME} /usr/bin -eu $(pwd) sed export "$1" | printf printf $(pwd)
+		2>/dev/null && awk 2>/dev/null && "$1" cd done export x=1 ${HOME} |
+		${HOME} test "$1" ${HOME} && --verbose
+	x=1 printf $(pwd) sed sed grep
+	test ${HOME} | grep | /usr/bin
+${HOME} test grep -eu sed export ${HOME} x=1 ${HOME}
+	/usr/bin sed awk sed printf
+	"$1" done awk "$1" --verbose test readonly echo $(pwd) export echo 'quoted text'
+done done 2>/dev/null ${HOME} ${HOME} --verbose /usr/bin ${HOME} test
+		${HOME} printf $(pwd) done 2>/dev/null sed $(pwd) ${HOME} x=1 echo awk
+	2>/dev/null readonly -eu 'quoted text' cd
+		--verbose local "$@" grep readonly export --verbose
+		/usr/bin local x=1 x=1 | printf ${HOME} && echo
+	x=1 -eu awk /usr/bin | local export /usr/bin test done local
+	awk test 2>/dev/null | printf cd --verbose 'quoted text'
+	awk 'quoted text' then
+	2>/dev/null "$@" x=1 -eu
+		x=1 2>/dev/null -eu &&
+test "$@" test && done test | $(pwd) cd readonly test x=1 | sed
+		done 2>/dev/null /usr/bin test --verbose echo done printf ${HOME}
+		-eu 'quoted text' /usr/bin cd printf printf test printf | test
+"$1" readonly $(pwd) printf
+/usr/bin /usr/bin export
+		x=1 $(pwd) echo ${HOME} sed /usr/bin ${HOME}
+		test awk local printf printf ${HOME} readonly
+		x=1 | printf cd test /usr/bin &&
+		grep sed ${HOME} echo 2>/dev/null
+'quoted text' export 2>/dev/null local readonly -eu
+local --verbose local "$@" "$1"
+	&& awk ${HOME} readonly grep readonly -eu local test
+	&& awk --verbose 'quoted text' 'quoted text'
+	printf test then 2>/dev/null sed test --verbose 'quoted text' -eu
+	| test then ${HOME} then echo "$@"
+	cd /usr/bin && /usr/bin
+	test x=1 test done awk "$@" done 2>/dev/null && readonly local printf readonly
@@ -0,0 +1,2001 @@
+		&& done grep -eu awk && local 'quoted text'
+&& grep -eu -eu export done done test $(pwd) --verbose
+		awk then x=1 2>/dev/null cd printf $(pwd) printf sed && then sed awk done
+		cd $(pwd) grep /usr/bin x=1 ${HOME} /usr/bin done printf done --verbose
+	local x=1 "$1" grep printf echo ${HOME}
+		--verbose /usr/bin grep cd
+local $(pwd) && 'quoted text' export 'quoted text' grep
+	/usr/bin 'quoted text' "$1" local /usr/bin "$1" done | awk
+		&& done test then "$@" "$1" 'quoted text' "$@" then test export
+	cd 2>/dev/null grep 2>/dev/null printf x=1 -eu sed 'quoted text' 'quoted text'
+		/usr/bin "$@" grep 'quoted text' test
+	done /usr/bin 'quoted text'
+| export sed ${HOME} x=1 done
+	sed grep echo then --verbose echo grep grep 2>/dev/null $(pwd)
+	readonly && x=1 x=1 ${HOME} readonly x=1 then readonly 'quoted text'
+		| ${HOME} readonly export awk -eu export x=1 local 2>/dev/null local export
+	${HOME} | grep x=1 local done | grep local |
+| "$@" /usr/bin done 'quoted text' 2>/dev/null grep 'quoted text' export
+		| /usr/bin done sed "$1"
+echo test readonly local x=1 then echo sed | 'quoted text'
+cd cd "$1" printf awk echo -eu then
+		/usr/bin -eu 2>/dev/null readonly
+$(pwd) test export printf -eu $(pwd) --verbose grep
+		echo 'quoted text' done -eu
+	local --verbose 'quoted text'
+		"$@" then local | ${HOME} then
+	local sed --verbose printf $(pwd) ${HOME} "$1" $(pwd) "$1" printf
+		local "$1" done readonly
+done local then && echo /usr/bin awk awk local
+$(pwd) x=1 && test printf $(pwd) "$1" printf "$1" -eu then
+sed "$1" /usr/bin done x=1 readonly --verbose
+| printf && done local echo "$@" sed readonly echo local
+		&& 'quoted text' ${HOME} test done
+	"$1" grep /usr/bin --verbose readonly
+export test && local | echo awk cd export "$@" readonly 2>/dev/null --verbose readonly
+awk -eu 2>/dev/null "$@" readonly $(pwd) -eu cd export x=1
+	x=1 local echo | cd readonly cd -eu cd 2>/dev/null /usr/bin x=1 local readonly
+	'quoted text' done awk "$1" printf ${HOME} "$1" $(pwd) cd ${HOME}
+| "$@" ${HOME} 'quoted text' sed 2>/dev/null -eu --verbose
+	| -eu "$1" sed readonly done printf
+	2>/dev/null --verbose then
+	-eu $(pwd) export /usr/bin x=1 -eu ${HOME} then -eu echo
+&& then grep /usr/bin "$@" cd /usr/bin
+		2>/dev/null printf cd && 2>/dev/null printf test
+test export test && done | cd x=1 readonly grep 'quoted text' grep grep
+--verbose x=1 "$1" x=1 ${HOME}
+	then && 2>/dev/null local readonly --verbose "$@" printf | then
+	${HOME} 2>/dev/null "$@" 2>/dev/null echo test "$1" -eu -eu echo grep x=1 printf
+	&& readonly | | ${HOME} 'quoted text' then ${HOME} test
+		sed /usr/bin --verbose "$1" cd local "$1" cd sed
+	&& ${HOME} echo /usr/bin test awk "$@" done echo
+		test && ${HOME} x=1 grep printf awk done cd && -eu echo test grep && then | | done
+		readonly done then --verbose 'quoted text' ${HOME}
+	done cd | x=1 local echo && echo ${HOME} readonly then
+	printf 2>/dev/null done "$1" 'quoted text' $(pwd) echo cd cd | x=1 done grep
+		2>/dev/null grep grep 'quoted text' "$1" printf grep && cd grep
+	| awk local "$@" cd /usr/bin test ${HOME} --verbose printf
+${HOME} ${HOME} grep test
+$(pwd) -eu /usr/bin sed readonly && awk awk test readonly --verbose x=1 readonly
+"$1" -eu ${HOME} /usr/bin export 'quoted text'
+		&& "$@" "$1" export x=1 ${HOME} | test 2>/dev/null
+awk then then 'quoted text' "$@" "$1" $(pwd) local local grep /usr/bin
+${HOME} test local "$1" && "$@" /usr/bin && && --verbose
+		done x=1 awk done 'quoted text' echo printf awk x=1 grep $(pwd) x=1 'quoted text'
+		readonly echo /usr/bin test "$1" "$@" grep 'quoted text'
+| "$1" readonly ${HOME} | sed
+		2>/dev/null sed done ${HOME} done then cd local local
+	echo sed cd test done
+	$(pwd) printf ${HOME} $(pwd) -eu $(pwd) echo | "$1" ${HOME} -eu
+		printf -eu 2>/dev/null |
+	grep test sed 'quoted text'
+		/usr/bin $(pwd) && printf /usr/bin sed echo $(pwd) x=1
+	$(pwd) x=1 "$@" ${HOME} awk local x=1 awk $(pwd) "$@" test "$1"
+	sed "$1" 'quoted text' printf "$1" ${HOME} x=1 -eu /usr/bin grep $(pwd)
+		sed /usr/bin $(pwd) done --verbose
+		x=1 done "$1" awk x=1 awk test cd
+	local 2>/dev/null sed done x=1 local | ${HOME} export x=1 x=1
+		then test "$1" /usr/bin -eu readonly printf
+	export /usr/bin 'quoted text' $(pwd) | awk grep
+	then && cd --verbose --verbose 2>/dev/null grep -eu | readonly test $(pwd)
+		cd done $(pwd) readonly && echo export echo --verbose ${HOME} then readonly
+		echo cd cd && export "$1" test printf | 2>/dev/null then
+cd echo --verbose $(pwd) /usr/bin
+		awk grep test /usr/bin sed readonly cd 2>/dev/null cd printf
+		sed && x=1 | printf export &&
+		${HOME} -eu 'quoted text' | awk && local grep printf /usr/bin --verbose test grep
+2>/dev/null --verbose cd export ${HOME} && "$@" $(pwd) echo
+	| $(pwd) --verbose echo 2>/dev/null "$1" printf x=1 "$1" grep
+sed --verbose x=1 "$1" local readonly ${HOME} | &&
+		sed echo local echo -eu ${HOME} test /usr/bin
+	"$1" printf | "$@" local awk 2>/dev/null
+		"$@" grep && cd done then export printf | grep 'quoted text'
+test then x=1 -eu -eu 2>/dev/null
+		printf printf sed && x=1 -eu done printf sed "$@" local export awk then ${HOME}
+2>/dev/null 'quoted text' 'quoted text' awk readonly test
+then ${HOME} cd cd | && x=1 cd grep "$1" -eu awk awk && 'quoted text'
+		-eu then grep grep test local sed
+		local 2>/dev/null &&
+	$(pwd) ${HOME} readonly test && x=1 test |
+		--verbose printf then awk done 'quoted text'
+	${HOME} 'quoted text' x=1 printf echo --verbose
+	grep "$@" x=1 then 2>/dev/null --verbose
+	${HOME} local $(pwd) "$1" | x=1 'quoted text' local export
+'quoted text' echo export "$1" printf
+		test readonly && printf ${HOME} local /usr/bin "$1" 'quoted text' echo echo "$@"
+	--verbose 2>/dev/null echo
+test && /usr/bin "$1" cd | 'quoted text' echo done
+		done sed 'quoted text' | 'quoted text' export export "$1" done local
+		then grep --verbose 2>/dev/null local
+		printf --verbose $(pwd) "$@" /usr/bin "$@" "$1" readonly sed --verbose
+	$(pwd) ${HOME} then grep 2>/dev/null sed x=1 'quoted text'
+		readonly 'quoted text' -eu export
+done cd export local x=1 --verbose x=1 done grep --verbose && ${HOME}
+	echo echo then sed --verbose "$@" "$1" -eu -eu "$1" export &&
+		$(pwd) && export /usr/bin printf 'quoted text'
+		echo printf | 2>/dev/null --verbose awk ${HOME} -eu readonly test readonly
+		&& test "$@" 2>/dev/null local cd "$1" | readonly printf "$1" | readonly
+		"$@" $(pwd) 'quoted text' | readonly && 2>/dev/null /usr/bin
+		-eu echo test printf grep printf x=1 test
+		local done printf then
+		awk -eu local ${HOME} "$1" "$@" then && printf && --verbose printf x=1 /usr/bin
+	&& "$@" 2>/dev/null -eu && $(pwd) printf 'quoted text' then
+| echo 2>/dev/null export | echo | readonly test 2>/dev/null
+		then then ${HOME} ${HOME} --verbose ${HOME} /usr/bin done 'quoted text'
+		/usr/bin 2>/dev/null readonly awk --verbose
+		local 2>/dev/null -eu awk && "$1" $(pwd) cd --verbose /usr/bin -eu 'quoted text'
+		/usr/bin grep ${HOME} ${HOME} | "$1" local awk
+		&& done awk 2>/dev/null
+awk /usr/bin printf -eu ${HOME} 2>/dev/null -eu && done 'quoted text' 2>/dev/null
+	/usr/bin readonly x=1 'quoted text' $(pwd) awk --verbose
+	done local done --verbose "$1" /usr/bin -eu $(pwd) printf ${HOME} 2>/dev/null
+		/usr/bin /usr/bin $(pwd) ${HOME} $(pwd)
+export | /usr/bin awk done ${HOME} ${HOME} test sed
+"$@" "$@" "$@" && /usr/bin then done cd -eu test awk /usr/bin -eu /usr/bin | done
+		local test readonly export export sed x=1
+test cd 2>/dev/null sed 2>/dev/null
+	$(pwd) 'quoted text' test local awk 'quoted text' "$1"
+		export "$1" echo readonly 2>/dev/null
+	done printf && "$@" cd echo "$@" 2>/dev/null test
+local && "$@" --verbose 2>/dev/null x=1 sed ${HOME} && sed -eu 2>/dev/null
+awk then --verbose printf "$@" cd 2>/dev/null awk awk grep
+		cd "$@" export local grep done test /usr/bin test sed echo 'quoted text' &&
+test /usr/bin readonly -eu ${HOME} local then local readonly printf sed done
+readonly 2>/dev/null && && /usr/bin $(pwd) "$1" "$@" then awk grep
+printf test test 'quoted text' readonly | echo
+		--verbose -eu "$1" 'quoted text' && cd /usr/bin export
+	"$1" 'quoted text' export 'quoted text' 2>/dev/null
+	then grep "$1" /usr/bin grep --verbose export
+	local sed /usr/bin export awk printf readonly &&
+	/usr/bin export local x=1 && printf awk grep readonly
+		-eu 'quoted text' printf readonly 2>/dev/null && readonly | && "$1" x=1 "$@" ${HOME}
+test cd echo 2>/dev/null --verbose
+readonly awk "$@" done local echo $(pwd) awk grep cd export
+	awk 2>/dev/null /usr/bin $(pwd) export done | sed --verbose "$1"
+${HOME} ${HOME} sed /usr/bin local --verbose && cd && && cd readonly
+	cd && local then 2>/dev/null cd x=1 --verbose local then printf
+cd grep -eu "$@" done ${HOME} cd sed 'quoted text' ${HOME} $(pwd) grep printf
+	then cd | local && test && "$@" echo $(pwd) | export
+		grep echo cd /usr/bin local 'quoted text'
+	grep x=1 awk echo awk awk printf done 'quoted text'
+	'quoted text' 2>/dev/null "$@" printf "$@" test printf
+then && awk test local "$1" echo printf echo 'quoted text'
+	$(pwd) test printf "$@" "$1"
+printf grep --verbose -eu awk $(pwd)
+"$@" echo 'quoted text' ${HOME} /usr/bin readonly awk /usr/bin
+	--verbose ${HOME} done && &&
+then readonly test 2>/dev/null
+| /usr/bin x=1 -eu && -eu 2>/dev/null
+	readonly 2>/dev/null ${HOME}
+	printf x=1 test then printf "$@" readonly grep 2>/dev/null
+cd grep --verbose | && ${HOME} local export
+		${HOME} | local export
+then --verbose x=1 ${HOME} cd awk cd printf |
+awk grep -eu -eu done --verbose
+		cd /usr/bin sed 2>/dev/null $(pwd) printf sed 'quoted text' grep ${HOME} x=1
+		done test cd x=1 readonly ${HOME}
+		"$1" sed && $(pwd) && ${HOME}
+	"$@" cd | "$1" readonly grep readonly
+$(pwd) -eu printf done test 2>/dev/null 2>/dev/null --verbose
+	printf 2>/dev/null sed "$1" 2>/dev/null echo 2>/dev/null /usr/bin printf
+	printf done then /usr/bin "$@" 2>/dev/null | "$1" sed "$@" echo "$1"
+		-eu printf printf done | $(pwd) "$@" $(pwd) local --verbose
+x=1 $(pwd) grep && "$1" 'quoted text' 2>/dev/null sed
+		$(pwd) cd readonly echo $(pwd) x=1
+		$(pwd) awk | -eu export readonly ${HOME} x=1 awk && "$1" printf
+done export $(pwd) awk export readonly | local $(pwd) then awk
+	--verbose -eu "$@" | test $(pwd) 'quoted text' $(pwd) printf "$1" x=1 "$@" test
+	local && readonly -eu echo then printf 2>/dev/null
+		sed sed test done 'quoted text' x=1
+	printf local /usr/bin done then 'quoted text' awk 'quoted text' $(pwd) then awk
+	sed printf -eu ${HOME} test "$@" sed $(pwd) "$1" readonly -eu done 2>/dev/null sed
+		/usr/bin awk /usr/bin sed 2>/dev/null $(pwd) 2>/dev/null
+--verbose readonly local then 2>/dev/null done cd ${HOME} grep
+&& 'quoted text' --verbose cd cd && cd "$@" 'quoted text' "$@" ${HOME}
+-eu "$@" readonly done export "$1" readonly
+	then local printf "$@" 'quoted text' sed && -eu /usr/bin | 2>/dev/null -eu -eu
+${HOME} echo done echo export readonly printf test grep printf cd awk "$@"
+	local awk -eu sed "$1" /usr/bin
+export x=1 grep "$@" test done then local export then grep readonly && "$@"
+	"$@" "$@" 'quoted text' printf test
+	--verbose test readonly x=1 export then test readonly printf x=1
+	printf -eu x=1 export | --verbose cd -eu --verbose
+printf then && "$1" export then /usr/bin /usr/bin local && /usr/bin ${HOME} -eu
+| export "$@" cd --verbose test
+	2>/dev/null done -eu | && | then
+sed 'quoted text' "$@" echo
+		then cd export 2>/dev/null echo grep export export &&
+		-eu 'quoted text' printf | grep 2>/dev/null test sed && local readonly
+		2>/dev/null grep awk then grep done --verbose 'quoted text' awk echo 2>/dev/null
+sed ${HOME} x=1 then cd cd 2>/dev/null
+-eu test x=1 export then done x=1 x=1 local 2>/dev/null test local
+		done cd -eu x=1 grep then echo -eu awk $(pwd) local 'quoted text'
+		| /usr/bin "$@" /usr/bin -eu export awk "$@" --verbose local
+		&& -eu /usr/bin echo /usr/bin -eu $(pwd) /usr/bin cd | "$@" awk then
+-eu local grep grep x=1 /usr/bin then ${HOME}
+		sed 2>/dev/null test local grep cd 2>/dev/null echo "$1" 2>/dev/null printf cd
+	"$1" 2>/dev/null --verbose
+local done -eu then && "$@" /usr/bin "$1" awk test x=1
+"$@" /usr/bin 2>/dev/null "$1"
+printf $(pwd) --verbose -eu --verbose x=1 | sed export
+$(pwd) --verbose /usr/bin then test /usr/bin $(pwd) 2>/dev/null export cd
+		| 'quoted text' grep sed test
+awk cd local then cd local --verbose /usr/bin
+		${HOME} $(pwd) /usr/bin grep "$@" printf export grep "$@" test "$@"
+		readonly && /usr/bin then "$1" --verbose && 'quoted text'
+	"$1" && && awk 2>/dev/null printf --verbose cd export "$1" ${HOME} x=1
+		echo grep local ${HOME} grep readonly "$@" $(pwd) local -eu /usr/bin
+		awk local /usr/bin echo /usr/bin readonly readonly printf then $(pwd) readonly
+	readonly -eu then ${HOME} -eu 'quoted text'
+		then cd readonly printf printf 'quoted text' local
+		awk sed sed awk "$1" "$1" local x=1 | | done
+	x=1 sed ${HOME} printf done 'quoted text' && "$@" awk
+&& printf $(pwd) awk 2>/dev/null export 2>/dev/null x=1 /usr/bin readonly
+cd "$@" echo --verbose
+		${HOME} sed export cd echo -eu printf "$1" test --verbose $(pwd) |
+	sed readonly ${HOME} $(pwd)
+$(pwd) done | local export printf
+2>/dev/null done printf readonly printf printf
+	"$@" done sed | 2>/dev/null "$1" sed
+	${HOME} "$1" 'quoted text' --verbose local "$@" readonly -eu "$@" -eu && cd 'quoted text'
+sed printf cd --verbose done test "$1" echo echo
+awk then awk 2>/dev/null 2>/dev/null | "$1" cd x=1 "$1" readonly printf
+		"$1" awk readonly awk | ${HOME} 2>/dev/null
+		then export local cd printf done echo awk done done echo cd 2>/dev/null done
+		'quoted text' test | readonly "$@" awk && $(pwd) && then "$1" cd test
+2>/dev/null grep then echo grep
+awk echo sed echo "$1" "$@" -eu --verbose
+		${HOME} grep export sed | done readonly then printf readonly 'quoted text'
+	${HOME} echo /usr/bin
+printf echo --verbose local done --verbose cd test "$@" awk 'quoted text' export
+--verbose grep 2>/dev/null done test then -eu | then cd grep --verbose done $(pwd)
+echo $(pwd) awk local -eu | 'quoted text' /usr/bin /usr/bin
+		'quoted text' local && printf cd "$@" | then && sed && --verbose
+test readonly sed /usr/bin
+		grep $(pwd) $(pwd) $(pwd)
+--verbose done "$@" ${HOME}
+	'quoted text' 'quoted text' export --verbose echo then /usr/bin $(pwd) --verbose
+	/usr/bin /usr/bin -eu export && readonly cd "$1" export
+	'quoted text' $(pwd) printf readonly then
+	"$1" x=1 cd --verbose x=1 printf "$@" && export awk readonly
+awk --verbose done done local | $(pwd)
+		echo $(pwd) -eu -eu printf "$1" done awk export sed readonly readonly 2>/dev/null
+sed readonly ${HOME} cd grep "$1" x=1 grep && 2>/dev/null
+	readonly cd ${HOME} /usr/bin x=1 'quoted text' /usr/bin && local ${HOME} sed then
+printf --verbose printf "$1" --verbose sed "$1" ${HOME} $(pwd)
+	cd then "$1" x=1 -eu awk 'quoted text'
+	grep --verbose export awk 2>/dev/null echo export
+readonly && /usr/bin done test /usr/bin /usr/bin -eu && done test /usr/bin printf
+readonly 'quoted text' readonly awk done -eu sed "$1" readonly && awk local
+| && 2>/dev/null -eu echo -eu | x=1 local local sed grep export | cd |
+		x=1 then 'quoted text' -eu $(pwd) "$1" test echo x=1 ${HOME} echo --verbose
+	printf echo 'quoted text' "$1" printf local cd 2>/dev/null awk printf "$@" export
+		local "$@" grep readonly -eu then
+		printf "$1" "$@" | test 'quoted text' $(pwd) local ${HOME} then "$1" | cd 'quoted text'
+		local cd local -eu cd test export x=1 x=1 then awk
+	&& test "$@" echo printf
+"$1" then echo && "$@" --verbose echo /usr/bin
+		cd echo sed $(pwd) ${HOME} | grep printf --verbose /usr/bin readonly 'quoted text'
+		grep local ${HOME} then x=1
+export grep "$@" && printf
+grep test cd sed awk grep
+		echo 2>/dev/null export grep "$@" test -eu 'quoted text'
+	"$@" export sed cd | readonly test x=1
+--verbose local local -eu $(pwd) | export && && sed
+done x=1 $(pwd) | cd done printf
+awk "$@" ${HOME} ${HOME} done
+sed local "$@" 2>/dev/null echo "$@" readonly "$1"
+--verbose done x=1 grep cd 'quoted text' grep test && test
+		x=1 echo 'quoted text' echo readonly "$@" test
+&& awk $(pwd) $(pwd) awk "$@" | sed /usr/bin awk awk export awk "$@" 'quoted text'
+	"$1" ${HOME} "$@" export echo printf done ${HOME} $(pwd) $(pwd) test 2>/dev/null
+	echo /usr/bin grep x=1 "$@"
+	cd | readonly then ${HOME} export cd "$@" done && then awk 2>/dev/null grep
+	$(pwd) readonly && -eu "$@" then echo local awk printf
+		-eu then then export $(pwd) --verbose cd readonly | cd 'quoted text' 2>/dev/null
+	/usr/bin cd "$1" x=1 sed $(pwd) ${HOME} export then $(pwd)
+2>/dev/null sed printf
+	--verbose grep readonly 'quoted text' -eu "$@" echo done
+		| 'quoted text' readonly readonly --verbose "$1" && "$@" grep /usr/bin echo
+	local test local grep ${HOME} 'quoted text' /usr/bin printf "$1"
+sed ${HOME} cd sed awk --verbose | echo echo done
+$(pwd) -eu -eu x=1 'quoted text' "$@"
+		"$1" /usr/bin readonly ${HOME} && --verbose -eu cd local test export &&
+&& then 2>/dev/null printf done sed ${HOME} done printf /usr/bin
+grep printf && ${HOME} readonly
+x=1 sed --verbose printf /usr/bin
+	echo | ${HOME} test then local cd local export done ${HOME} export
+		sed test $(pwd) "$@" readonly x=1 x=1 done echo x=1 x=1
+		local --verbose "$@" x=1 -eu /usr/bin "$1" "$@"
+$(pwd) "$@" done awk echo done "$@" | "$@" --verbose --verbose test
+	printf cd "$@" test && 2>/dev/null "$@" "$1" "$@" 'quoted text'
+		echo export $(pwd) then local && readonly --verbose sed /usr/bin cd
+		2>/dev/null readonly $(pwd) $(pwd) grep awk "$1" 2>/dev/null
+		-eu --verbose && x=1 sed
+	echo $(pwd) test test 'quoted text' test -eu
+		-eu done awk readonly then
+then test grep | 'quoted text' "$1" printf -eu "$1"
+	local local readonly 'quoted text' --verbose awk local ${HOME} local printf /usr/bin
+/usr/bin "$@" printf done test grep cd "$@" "$@" done -eu cd 2>/dev/null
+'quoted text' cd printf | done then local local local
+		$(pwd) $(pwd) test && readonly cd grep ${HOME} -eu
+--verbose /usr/bin readonly x=1 && export x=1 then -eu export
+	x=1 2>/dev/null /usr/bin $(pwd) | grep done grep local &&
+	readonly | --verbose printf "$@" --verbose x=1 then printf
+	awk "$@" 'quoted text' "$1" test "$@" local
+readonly grep then "$1"
+&& echo then x=1 "$1" | "$1"
+	| done $(pwd) readonly grep ${HOME} done then $(pwd) printf grep export awk
+		test awk ${HOME} awk "$1" readonly awk test "$@" 2>/dev/null
+'quoted text' | "$1" cd 'quoted text' --verbose then local $(pwd)
+| x=1 test grep 2>/dev/null grep readonly cd sed export "$@" test
+	sed | 2>/dev/null 'quoted text' local readonly 'quoted text' export -eu && -eu
+		echo --verbose x=1 sed -eu ${HOME} echo "$1" $(pwd) -eu then /usr/bin
+| -eu 2>/dev/null 'quoted text' 2>/dev/null sed local cd && awk "$@"
+done export echo readonly x=1 readonly then
+	"$1" | x=1 -eu "$1" /usr/bin test sed awk readonly
+	${HOME} printf 2>/dev/null test 'quoted text'
+	-eu 'quoted text' printf 2>/dev/null grep sed | ${HOME}
+"$@" export "$1" test echo /usr/bin then
+		sed ${HOME} && then ${HOME} sed grep /usr/bin local 2>/dev/null
+	--verbose cd cd "$@" ${HOME} 'quoted text'
+		x=1 /usr/bin | | -eu printf $(pwd) sed sed && x=1 test local export
+	--verbose awk done -eu cd cd test then | echo && "$1"
+x=1 echo cd awk done 2>/dev/null -eu readonly 2>/dev/null -eu 'quoted text'
+		${HOME} 'quoted text' "$@" printf "$1" cd && --verbose
+	done /usr/bin "$@" cd then $(pwd) -eu grep done && 2>/dev/null /usr/bin
+-eu cd printf --verbose cd $(pwd) ${HOME} ${HOME} /usr/bin
+	export 2>/dev/null echo grep $(pwd) awk awk x=1 -eu cd echo test
+	x=1 sed done --verbose 2>/dev/null export --verbose 2>/dev/null 'quoted text'
+readonly printf 2>/dev/null
+	echo "$@" ${HOME} readonly echo then export export echo then printf
+		export /usr/bin $(pwd) 2>/dev/null | echo
+awk --verbose test --verbose grep "$@" done $(pwd)
+		x=1 readonly done then awk
+		local | "$@" 'quoted text'
+	x=1 /usr/bin readonly printf cd test awk 2>/dev/null --verbose
+&& && printf done --verbose
+	&& done grep readonly "$1" export awk local --verbose
+		x=1 "$1" | "$1" | 'quoted text' "$1"
+	done -eu && 2>/dev/null
+		&& --verbose local | export
+grep local x=1 "$1" awk $(pwd) sed 'quoted text' && then && awk cd
+	done test 2>/dev/null
+	readonly cd /usr/bin 2>/dev/null printf | awk -eu local then done
+cd "$@" awk | sed ${HOME} /usr/bin --verbose
+/usr/bin export readonly /usr/bin cd /usr/bin -eu readonly -eu --verbose
+2>/dev/null x=1 'quoted text' "$1" && readonly | "$1" --verbose sed
+		echo grep | awk awk grep
+	done then ${HOME} | --verbose done readonly cd -eu
+		export $(pwd) echo 2>/dev/null local export
+		2>/dev/null export grep export local "$@" | && 'quoted text'
+then cd | printf -eu "$1" sed echo "$@" sed cd "$1" grep test grep test export
+		2>/dev/null cd && printf printf --verbose -eu $(pwd) cd
+echo ${HOME} -eu "$1" | readonly --verbose -eu x=1 export cd --verbose &&
+		printf then x=1 grep ${HOME} && 2>/dev/null
+	| 'quoted text' echo then then --verbose
+local --verbose test cd readonly
+	printf done "$@" printf test
+		| $(pwd) ${HOME} -eu test --verbose -eu ${HOME} readonly
+echo x=1 echo 2>/dev/null 2>/dev/null /usr/bin grep 'quoted text'
+		&& -eu x=1 /usr/bin echo /usr/bin ${HOME} done ${HOME} 2>/dev/null
+	readonly "$1" sed printf "$@" --verbose
+		-eu 2>/dev/null $(pwd) /usr/bin test export readonly && printf readonly export
+cd | done | readonly test $(pwd) readonly | ${HOME} done
+		&& ${HOME} printf awk && awk $(pwd) printf done "$1" then
+		2>/dev/null | $(pwd) 2>/dev/null -eu $(pwd) 2>/dev/null ${HOME} /usr/bin
+awk "$@" ${HOME} export x=1 x=1 printf --verbose
+	--verbose test x=1 /usr/bin && then
+		| /usr/bin x=1 && sed -eu x=1 && x=1 'quoted text'
+		export then export "$1" "$@"
+		'quoted text' "$1" done readonly then readonly ${HOME} -eu readonly 2>/dev/null
+	'quoted text' "$1" "$1"
+		printf local done then test echo sed ${HOME}
+	printf printf x=1 2>/dev/null echo -eu
+		readonly export ${HOME} then --verbose cd 2>/dev/null
+	sed done cd grep test sed 'quoted text' then echo
+"$@" awk test ${HOME} cd
+	grep -eu local sed /usr/bin
+done export cd "$@" sed
+	test printf 'quoted text' sed echo echo sed --verbose cd readonly echo cd
+	local grep awk x=1 -eu done readonly ${HOME} echo cd done local 'quoted text'
+done "$@" cd 2>/dev/null ${HOME} | export
+	'quoted text' | && local grep printf readonly sed "$1" sed
+		export -eu sed awk local -eu cd sed "$@" printf local -eu /usr/bin
+| cd "$1" sed then $(pwd) local 2>/dev/null awk printf "$1" /usr/bin test /usr/bin
+		readonly 2>/dev/null "$@" 'quoted text' sed test then
+grep then 'quoted text' x=1
+	awk x=1 'quoted text' x=1 readonly
+	/usr/bin cd done then "$@" "$@" 2>/dev/null && sed readonly grep
+		done -eu && test -eu test echo sed cd && | "$@" $(pwd)
+		export 2>/dev/null awk grep ${HOME}
+		-eu --verbose export "$@" x=1 $(pwd)
+$(pwd) readonly -eu sed export -eu |
+grep test test && | x=1 2>/dev/null grep /usr/bin $(pwd) done
+	/usr/bin cd | 2>/dev/null grep "$@" 2>/dev/null --verbose local
+	-eu | "$1" test "$@" grep --verbose sed test | | --verbose | grep |
+	$(pwd) /usr/bin cd x=1 --verbose $(pwd) sed "$1" done awk
+		-eu -eu -eu then "$@" local 'quoted text' cd sed 2>/dev/null
+cd local "$@" x=1 awk $(pwd) grep export grep 2>/dev/null export then
+cd sed 2>/dev/null ${HOME} -eu
+local x=1 sed ${HOME} --verbose x=1 | x=1 | printf printf
+2>/dev/null echo then -eu && -eu export printf ${HOME} $(pwd)
+	$(pwd) 2>/dev/null sed readonly
+		local 'quoted text' --verbose
+--verbose printf grep "$1" $(pwd)
+	grep grep 'quoted text' --verbose
+		done -eu -eu ${HOME} export /usr/bin | readonly && --verbose grep
+	/usr/bin grep then done "$1" 2>/dev/null | then done grep --verbose
+awk | cd echo /usr/bin 2>/dev/null
+grep export /usr/bin export export | "$1" | && done | 'quoted text' test /usr/bin
+	${HOME} test "$@" echo export
+grep "$@" local export grep
+		"$1" export --verbose -eu sed /usr/bin $(pwd)
+	sed printf x=1 readonly cd cd ${HOME} done
+		2>/dev/null "$@" awk ${HOME} awk sed readonly "$@"
+readonly printf -eu sed echo sed
+	"$1" --verbose sed -eu $(pwd) | then -eu test && ${HOME} $(pwd) ${HOME} --verbose
+		| cd readonly then export
+		"$1" "$@" $(pwd) printf grep 2>/dev/null
+2>/dev/null -eu $(pwd) && echo printf local printf
+		-eu local printf done then local /usr/bin --verbose
+test && awk -eu printf then $(pwd)
+	"$@" x=1 cd echo test cd awk test cd test "$@"
+	cd -eu ${HOME} readonly awk -eu sed --verbose /usr/bin readonly
+local export test done --verbose
+	--verbose readonly ${HOME} --verbose
+	test printf local 'quoted text' $(pwd) local sed awk /usr/bin test readonly
+	export awk "$@" test done 2>/dev/null
+		awk echo cd then local /usr/bin test cd
+${HOME} local && readonly done printf
+		x=1 --verbose echo "$@" -eu |
+&& "$1" 'quoted text' $(pwd) export "$@" done "$@"
+	2>/dev/null test printf sed "$1" readonly x=1 | | done readonly
+/usr/bin "$@" 'quoted text' cd awk test /usr/bin cd then test && /usr/bin
+		test then ${HOME} printf grep then -eu then 'quoted text'
+		x=1 then 'quoted text' cd 2>/dev/null local readonly then -eu local sed
+"$@" echo printf "$1" done 2>/dev/null
+		"$1" export /usr/bin $(pwd) awk grep awk 'quoted text' echo
+sed 'quoted text' $(pwd) awk printf && export && 'quoted text' x=1
+		/usr/bin --verbose export awk readonly ${HOME}
+		x=1 cd x=1 'quoted text' echo | "$1" /usr/bin | cd "$@" local sed
+&& readonly cd readonly awk "$1" readonly done
+cd | 2>/dev/null --verbose cd echo $(pwd) local "$@" && 'quoted text'
+	${HOME} 2>/dev/null test sed echo echo $(pwd) awk export grep local awk local /usr/bin
+		cd cd export /usr/bin export 'quoted text' -eu readonly then test /usr/bin
+	sed 2>/dev/null "$@" 2>/dev/null local export
+2>/dev/null ${HOME} readonly sed /usr/bin | 2>/dev/null grep /usr/bin
+"$@" | then local x=1 cd readonly
+2>/dev/null awk export 'quoted text' awk
+		'quoted text' -eu -eu 'quoted text' $(pwd) "$@" local test 'quoted text'
+local test && printf cd echo "$1" export echo printf test then "$1"
+then echo --verbose --verbose then grep --verbose readonly
+	sed awk readonly done echo grep | grep "$1"
+	"$@" readonly "$1" export /usr/bin -eu echo echo test 2>/dev/null
+	"$1" printf sed -eu 2>/dev/null -eu
+	"$1" && done grep | x=1 --verbose cd
+| ${HOME} done x=1 cd -eu -eu cd test sed x=1 /usr/bin export "$@" --verbose
+		export ${HOME} printf $(pwd) echo grep test && 2>/dev/null awk /usr/bin
+		$(pwd) readonly $(pwd) export printf "$1"
+--verbose local "$@" /usr/bin then
+${HOME} --verbose 'quoted text' "$1" echo $(pwd) 'quoted text'
+'quoted text' ${HOME} x=1 --verbose grep 2>/dev/null export cd |
+		"$1" /usr/bin done ${HOME} | export sed && readonly | echo /usr/bin | |
+	-eu 2>/dev/null "$@" readonly
+"$@" $(pwd) then then 'quoted text' local | cd echo readonly
+		cd x=1 printf cd export readonly
+readonly ${HOME} then ${HOME} test x=1 awk printf
+	${HOME} then ${HOME} export $(pwd)
+	${HOME} local printf ${HOME}
+		-eu then $(pwd) x=1 && "$@" sed --verbose test --verbose x=1 && printf done
+	readonly --verbose export
+	cd $(pwd) 'quoted text' "$@"
+	grep export ${HOME} 'quoted text' printf test /usr/bin x=1 cd -eu readonly echo
+		-eu export | printf ${HOME} done | readonly | && readonly
+'quoted text' --verbose 'quoted text' /usr/bin done | --verbose
+readonly awk --verbose printf --verbose done readonly then && "$@" awk local
+	done sed readonly -eu test
+	'quoted text' local && cd done 'quoted text'
+echo sed && 2>/dev/null echo $(pwd) done readonly
+grep local done | "$1" -eu test export echo ${HOME} 'quoted text' x=1 awk
+	awk done x=1 2>/dev/null "$@" --verbose | --verbose "$1" cd awk 'quoted text'
+		export && echo sed test 2>/dev/null
+	awk 2>/dev/null $(pwd) local export echo test /usr/bin 2>/dev/null /usr/bin
+	&& awk "$1" x=1 grep x=1 | "$@" export echo "$@" echo --verbose test export --verbose
+		/usr/bin then done export echo -eu |
+	grep && "$@" -eu sed export grep local 2>/dev/null echo && | test printf cd
+		| $(pwd) /usr/bin export local echo awk 'quoted text' readonly "$1" --verbose
+		$(pwd) x=1 readonly "$@" readonly /usr/bin readonly x=1 sed sed echo
+		x=1 "$1" | ${HOME} 'quoted text'
+		readonly export export echo $(pwd) done | "$1"
+		'quoted text' ${HOME} | --verbose
+--verbose -eu "$1" readonly local
+	"$@" "$@" $(pwd) "$1" export cd readonly export echo cd 'quoted text'
+sed --verbose x=1 local readonly -eu export then sed ${HOME} /usr/bin grep
+	sed local then done sed "$1" echo test
+		| awk printf printf sed "$1" --verbose printf --verbose cd awk cd printf
+2>/dev/null awk grep x=1 cd
+		| "$1" echo && $(pwd) then "$1" test -eu echo 'quoted text'
+		x=1 x=1 --verbose grep sed 2>/dev/null
+grep then 2>/dev/null printf export printf done ${HOME} "$1"
+		-eu "$1" $(pwd) export "$1" $(pwd) ${HOME}
+		cd --verbose -eu printf "$1"
+	/usr/bin $(pwd) done test awk &&
+"$1" --verbose && done done sed
+	export && done 2>/dev/null echo done --verbose
+		"$1" && -eu readonly | "$1" x=1 'quoted text' "$@" "$1" | x=1 readonly
+		echo then export readonly done grep grep
+	-eu | grep cd --verbose printf awk
+		$(pwd) export awk printf $(pwd) --verbose 'quoted text' then sed awk 2>/dev/null
+	printf awk then | printf "$1" echo /usr/bin $(pwd) printf cd && done
+	'quoted text' 2>/dev/null && then /usr/bin 2>/dev/null "$1" cd readonly "$1"
+		test echo sed 'quoted text' --verbose grep local test done grep "$@" export
+		sed $(pwd) /usr/bin 'quoted text' then
+	| grep x=1 local sed cd | "$@" --verbose grep
+	--verbose test cd "$@" && echo | test $(pwd)
+		export $(pwd) awk sed done x=1 echo readonly awk x=1 && 2>/dev/null $(pwd)
+	grep /usr/bin 'quoted text' grep echo
+	$(pwd) --verbose cd | test
+/usr/bin $(pwd) awk test 'quoted text' "$1" | local
+		2>/dev/null cd export readonly test 2>/dev/null
+		'quoted text' awk grep local ${HOME} "$1" "$1" -eu sed ${HOME} readonly awk
+	$(pwd) && "$1" | "$1" export done export $(pwd)
+	printf printf | --verbose local printf done
+awk 'quoted text' printf done readonly sed grep grep export "$1" echo sed
+	'quoted text' --verbose
+		test && /usr/bin | x=1 sed cd echo | --verbose ${HOME} test | done echo x=1 test
+		test 'quoted text' cd test "$1" "$1" --verbose cd && ${HOME} $(pwd) 2>/dev/null
+	| -eu "$1" done awk then grep "$@" export
+	cd test 'quoted text'
+	| echo 2>/dev/null "$@" "$@" ${HOME} ${HOME} 'quoted text'
+	printf echo 'quoted text' 'quoted text' then -eu then printf export /usr/bin local
+		$(pwd) grep "$1" "$1" sed test 2>/dev/null ${HOME} x=1 $(pwd) then grep done
+--verbose readonly | sed
+printf x=1 && /usr/bin ${HOME} x=1 "$@" "$@" 2>/dev/null
+	awk sed then awk /usr/bin grep "$1" printf cd -eu "$1" && grep echo awk "$@"
+		export test "$@" awk local 'quoted text' readonly "$@" &&
+-eu $(pwd) grep test /usr/bin /usr/bin "$@" echo readonly ${HOME} 2>/dev/null
+local awk export "$@" $(pwd) readonly
+"$1" /usr/bin "$1" && sed | 2>/dev/null 'quoted text'
+	$(pwd) "$1" /usr/bin sed "$@" printf then export
+		--verbose export echo 2>/dev/null echo && test "$@" 2>/dev/null ${HOME}
+	2>/dev/null --verbose /usr/bin test printf printf x=1 cd then sed grep done
+	x=1 test "$1" local grep awk $(pwd) local then | readonly 2>/dev/null
+readonly local && local readonly
+awk test -eu && echo $(pwd) "$1" $(pwd) x=1 "$@"
+	printf ${HOME} $(pwd) readonly "$@" ${HOME} "$1" then ${HOME} export export
+		${HOME} /usr/bin | "$1" x=1 /usr/bin
+	--verbose 'quoted text'
+| done /usr/bin && && then done local readonly echo 'quoted text' 2>/dev/null
+readonly /usr/bin "$@"
+	${HOME} $(pwd) awk "$1" ${HOME} echo 2>/dev/null
+	local done then readonly "$@" echo && local awk sed "$1"
+	awk "$@" grep | /usr/bin --verbose grep then done
+	awk 'quoted text' cd -eu readonly
+2>/dev/null echo $(pwd) x=1 sed awk then x=1 $(pwd)
+		&& "$1" 'quoted text' "$1"
+	grep 'quoted text' grep sed readonly done 'quoted text'
+		cd 2>/dev/null | echo | |
+$(pwd) "$1" | && sed grep 2>/dev/null "$@"
+		$(pwd) ${HOME} --verbose && then /usr/bin
+		/usr/bin done readonly echo done local then | then export | x=1 local cd cd --verbose
+	/usr/bin && export -eu test test done
+		test readonly /usr/bin awk "$1" /usr/bin ${HOME} && then local sed grep
+	done && then --verbose local
+"$@" 'quoted text' export printf
+then && export /usr/bin grep test printf 2>/dev/null x=1
+		grep $(pwd) awk 2>/dev/null x=1 && sed test 'quoted text' "$@" $(pwd)
+		"$1" /usr/bin 'quoted text' awk done then ${HOME}
+	--verbose then done 2>/dev/null export
+		echo "$@" grep awk done /usr/bin 2>/dev/null
+		"$1" cd awk x=1 echo printf test $(pwd)
+readonly "$1" 2>/dev/null 2>/dev/null export $(pwd) "$1" -eu cd then local
+	test awk done && 'quoted text' $(pwd) printf printf printf grep --verbose cd
+	"$@" grep 'quoted text' --verbose echo x=1 cd /usr/bin grep readonly
+cd readonly printf readonly "$1" awk "$@" printf 'quoted text'
+		&& printf "$@" 2>/dev/null "$@" test
+x=1 | readonly -eu 2>/dev/null
+then /usr/bin "$1" printf echo 2>/dev/null then 'quoted text' cd cd cd 'quoted text'
+		2>/dev/null --verbose x=1 2>/dev/null $(pwd) done grep /usr/bin &&
+		cd ${HOME} local x=1 x=1 /usr/bin "$1" local "$@" x=1 test cd
+		${HOME} x=1 /usr/bin ${HOME} echo printf 2>/dev/null readonly
+	done -eu grep test &&
+	then test sed | then $(pwd) local awk grep sed -eu then
+		-eu /usr/bin | awk "$1" /usr/bin --verbose /usr/bin done export export
+| sed echo then grep echo local "$@" grep
+--verbose -eu | $(pwd)
+	test grep sed ${HOME} ${HOME} local /usr/bin awk then done readonly
+printf ${HOME} -eu 'quoted text'
+/usr/bin "$@" awk printf then readonly $(pwd) test ${HOME} test printf ${HOME} awk
+		test /usr/bin done cd sed echo /usr/bin "$1" x=1 x=1 local echo
+	printf cd echo ${HOME} "$@" -eu echo "$@" then readonly -eu x=1 sed
+		x=1 cd $(pwd) ${HOME} 'quoted text' && ${HOME} cd "$1"
+		export "$1" cd export local export x=1 x=1
+	readonly 2>/dev/null awk cd printf test $(pwd) "$1" "$@" export printf /usr/bin
+x=1 $(pwd) done cd "$@" cd "$@" 'quoted text' test echo 'quoted text' awk
+then x=1 readonly "$@" test 'quoted text'
+		'quoted text' then export "$@" -eu test done sed cd "$1" readonly then awk
+"$@" printf sed "$@" ${HOME} export printf readonly --verbose done
+		done ${HOME} printf echo export /usr/bin && 2>/dev/null readonly export
+x=1 "$@" "$1" -eu awk cd
+	done --verbose cd "$1" && cd test && printf --verbose
+		${HOME} | awk 'quoted text' grep printf 2>/dev/null
+	awk /usr/bin readonly sed && "$@" "$@" sed sed --verbose awk && -eu export
+		"$@" cd awk local && sed
+&& test "$1" awk && x=1 && "$1" cd ${HOME} grep ${HOME}
+		--verbose done test readonly && 2>/dev/null echo && | -eu sed local local $(pwd)
+	awk done then ${HOME} ${HOME} --verbose test "$@" ${HOME} $(pwd) --verbose
+		"$1" printf readonly && ${HOME} awk "$1" printf cd sed ${HOME}
+		cd 2>/dev/null printf export readonly
+&& then --verbose cd 'quoted text' x=1 | /usr/bin 'quoted text'
+		echo "$1" -eu "$@" x=1 then | && readonly then done -eu
+sed ${HOME} cd readonly 'quoted text' readonly awk local
+		/usr/bin 2>/dev/null -eu done | export awk echo "$@"
+		export readonly -eu | then x=1 done -eu export "$@" then ${HOME} export && x=1
+echo sed export export --verbose
+	'quoted text' awk export cd /usr/bin
+	'quoted text' local awk then then /usr/bin printf
+sed "$@" local echo x=1 readonly test "$@" printf &&
+		x=1 && local sed local ${HOME} grep sed test test
+test done awk test export "$1" --verbose then sed sed $(pwd) "$1" cd then
+"$@" x=1 $(pwd) grep test test grep "$@" x=1 printf echo x=1 grep sed "$@"
+		| "$@" local printf && | -eu 'quoted text' sed printf cd x=1
+test cd && sed local ${HOME} grep "$1" then echo export --verbose
+	&& --verbose --verbose sed x=1 -eu -eu printf cd "$1" export awk local sed sed local
+export local cd | ${HOME} -eu | readonly
+		${HOME} x=1 then "$1" 2>/dev/null done awk && readonly && /usr/bin
+		sed && -eu -eu cd $(pwd) $(pwd) ${HOME} $(pwd) 2>/dev/null
+		sed export echo x=1 grep done "$1" done cd /usr/bin /usr/bin
+echo --verbose sed 'quoted text'
+		--verbose sed readonly "$@" awk -eu --verbose $(pwd)
+		printf then "$@" x=1 && printf export test | grep 2>/dev/null export 'quoted text'
+then test /usr/bin printf
+		printf --verbose /usr/bin 'quoted text'
+	cd --verbose sed local awk done &&
+sed then awk -eu ${HOME} /usr/bin awk awk test sed /usr/bin /usr/bin local -eu local
+done x=1 then "$1" $(pwd) /usr/bin --verbose export 2>/dev/null
+echo /usr/bin printf export | test local 'quoted text'
+${HOME} "$@" awk export && sed local 2>/dev/null sed
+		${HOME} && 2>/dev/null --verbose "$@"
+		then 2>/dev/null grep awk "$@" grep
+"$1" echo x=1 | echo --verbose $(pwd) --verbose --verbose -eu local
+awk export && /usr/bin /usr/bin export
+		cd grep /usr/bin readonly readonly done
+		then export 2>/dev/null sed echo sed --verbose awk readonly | grep grep
+then grep $(pwd) cd cd
+then ${HOME} ${HOME} /usr/bin 2>/dev/null 2>/dev/null
+		awk then /usr/bin --verbose ${HOME} $(pwd) "$1" local
+2>/dev/null -eu | "$@" $(pwd) -eu 'quoted text' /usr/bin sed 2>/dev/null export
+export readonly 'quoted text' then -eu done awk test printf printf
+	grep 2>/dev/null "$@" | "$1" x=1
+${HOME} && awk /usr/bin printf 2>/dev/null readonly ${HOME}
+printf ${HOME} export "$@" -eu x=1 $(pwd) x=1
+	--verbose awk | readonly | readonly "$@" done x=1 2>/dev/null
+		'quoted text' "$1" export done echo /usr/bin $(pwd)
+		$(pwd) /usr/bin ${HOME} done then -eu sed done export test -eu done 2>/dev/null
+	| x=1 local test sed && then -eu readonly then local done ${HOME}
+		done "$1" sed $(pwd) x=1 echo
+test grep local grep /usr/bin 'quoted text' then --verbose ${HOME}
+sed 'quoted text' test x=1 --verbose printf x=1
+	printf 'quoted text' /usr/bin --verbose -eu -eu && awk
+		grep readonly then sed -eu ${HOME} | /usr/bin && export $(pwd) done awk
+then cd 'quoted text' | printf x=1 -eu "$@" test grep
+grep /usr/bin "$@" done echo /usr/bin "$@"
+	"$@" && 2>/dev/null | x=1 readonly local grep awk ${HOME}
+		readonly --verbose 2>/dev/null cd printf then cd
+		grep /usr/bin | ${HOME} export done -eu local && /usr/bin echo | && 'quoted text'
+sed readonly cd sed "$1" cd --verbose echo 'quoted text' x=1 2>/dev/null
+$(pwd) -eu then printf x=1 "$1"
+--verbose cd done /usr/bin test /usr/bin "$1" cd export local test done local
+	"$@" then --verbose /usr/bin -eu ${HOME}
+readonly printf $(pwd) echo readonly awk /usr/bin grep $(pwd) printf
+printf "$@" | sed x=1 printf x=1 "$1" grep -eu --verbose &&
+		"$@" done 2>/dev/null "$1" echo ${HOME}
+		"$@" export /usr/bin
+		&& export -eu echo then done
+	awk x=1 test sed ${HOME} test | | -eu "$@" x=1 cd
+		then && echo cd done 2>/dev/null sed local "$1"
+x=1 done export done export /usr/bin --verbose x=1 done readonly && sed
+		'quoted text' 'quoted text' /usr/bin && readonly "$1" awk "$1" $(pwd) $(pwd)
+'quoted text' sed 'quoted text'
+x=1 done sed && awk ${HOME} --verbose grep done --verbose sed $(pwd) test /usr/bin
+printf 'quoted text' --verbose echo awk cd echo local
+	then 'quoted text' -eu | export
+x=1 printf done export test grep cd 'quoted text' x=1 done 'quoted text' "$@"
+"$@" ${HOME} $(pwd) then "$@" --verbose --verbose /usr/bin 'quoted text' local
+		grep test readonly test 'quoted text' awk
+	2>/dev/null awk x=1 x=1 awk cd ${HOME} $(pwd) grep local 'quoted text'
+&& then && "$1" --verbose
+	echo /usr/bin "$1" grep --verbose --verbose export
+	readonly $(pwd) done local
+2>/dev/null cd | test x=1 test "$1"
+test printf local "$1" ${HOME} sed | ${HOME} echo local x=1 "$1"
+		awk sed echo "$1" readonly 2>/dev/null "$1" /usr/bin
+sed awk readonly cd sed x=1 test export then grep
+	x=1 done readonly 'quoted text' "$@" -eu readonly
+cd export then then readonly export "$1" test && 'quoted text' local
+		| | /usr/bin --verbose ${HOME} "$@" sed done /usr/bin printf --verbose printf awk
+	-eu echo "$@" export -eu 'quoted text' x=1 export sed
+2>/dev/null test | sed 2>/dev/null
+		export local done | test ${HOME} grep done /usr/bin $(pwd) "$1" export test x=1
+then | "$@" echo | readonly ${HOME} readonly
+		export "$1" readonly | --verbose --verbose 'quoted text'
+		${HOME} test -eu ${HOME} printf test /usr/bin
+readonly echo then | && readonly $(pwd) "$1" $(pwd) --verbose $(pwd) --verbose
+	'quoted text' "$@" printf | sed x=1 -eu
+		x=1 printf printf && readonly then --verbose x=1 local 'quoted text' --verbose
+	"$@" cd test $(pwd) grep then "$@" sed "$1" /usr/bin && 2>/dev/null
+		printf --verbose sed ${HOME} sed
+		| cd ${HOME} grep export then awk | test test | test done grep cd
+local test $(pwd) | $(pwd) sed then -eu grep done
+		/usr/bin 'quoted text' test test cd sed local "$@" 2>/dev/null
+'quoted text' sed readonly cd "$@" printf test cd x=1 done && $(pwd)
+		test local ${HOME} export then
+	then local awk --verbose "$1" cd grep
+		echo x=1 -eu "$@" ${HOME} cd ${HOME}
+	readonly local x=1 then | sed local | && local --verbose 2>/dev/null
+		--verbose | awk 'quoted text' done "$1" grep &&
+export awk local done ${HOME} --verbose local
+	readonly local printf
+local sed ${HOME} awk /usr/bin done --verbose then
+--verbose local printf && printf echo ${HOME} "$1" then done awk local /usr/bin
+		-eu local 2>/dev/null then --verbose
+		export export "$@" && then local local -eu 2>/dev/null
+	done sed cd --verbose "$@" 'quoted text' then readonly ${HOME} sed done
+	${HOME} x=1 --verbose "$@" local && ${HOME} local printf printf x=1 readonly "$@"
+	"$@" x=1 export | 'quoted text' --verbose /usr/bin echo
+		"$@" ${HOME} && done done /usr/bin
+	-eu sed "$1" 'quoted text' "$@" printf x=1 | /usr/bin awk -eu --verbose test
+		'quoted text' printf test cd printf
+then sed local test awk --verbose | then /usr/bin echo done 'quoted text'
+then done readonly /usr/bin /usr/bin 2>/dev/null
+	echo done done /usr/bin /usr/bin --verbose done
+grep x=1 | 'quoted text' $(pwd)
+done 'quoted text' | cd "$1" grep "$1" grep && awk test cd awk echo
+	readonly 'quoted text' && $(pwd)
+	export export "$@" echo $(pwd) x=1 done ${HOME} ${HOME} $(pwd) 'quoted text'
+then done printf readonly
+readonly local cd then echo -eu x=1 ${HOME} --verbose local x=1 cd |
+		&& then printf "$@" cd -eu awk local 'quoted text' --verbose x=1 export
+		--verbose "$@" readonly echo -eu done readonly readonly test local printf &&
+		printf /usr/bin sed test sed test export done "$@" --verbose "$1" export
+done -eu cd awk 'quoted text' /usr/bin grep $(pwd) ${HOME}
+	test printf cd test 'quoted text' "$@" 'quoted text' | printf
+	x=1 ${HOME} x=1 && echo /usr/bin "$@" 2>/dev/null && cd cd | local ${HOME} ${HOME}
+		-eu 2>/dev/null | x=1 readonly ${HOME}
+		x=1 then | then -eu then
+		printf "$1" -eu local done "$1" ${HOME} cd "$@"
+		sed && readonly local $(pwd) -eu local grep 'quoted text' 'quoted text' &&
+awk printf && grep 2>/dev/null --verbose grep | done local /usr/bin
+| 'quoted text' -eu then then
+		cd then --verbose $(pwd) echo done --verbose awk then local 'quoted text' awk
+then grep | "$@" -eu then test sed
+		export readonly ${HOME} && grep 'quoted text' printf "$@" -eu awk readonly
+sed sed local sed export x=1 -eu -eu awk printf $(pwd) $(pwd) --verbose
+sed && x=1 test 'quoted text' test /usr/bin ${HOME} | awk 2>/dev/null
+grep printf "$@" | echo
+		'quoted text' test readonly local
+	awk && export /usr/bin &&
+	local cd test readonly local grep --verbose
+		2>/dev/null readonly done test x=1 2>/dev/null
+		"$@" 'quoted text' echo 2>/dev/null test 2>/dev/null 'quoted text'
+-eu echo awk awk then 'quoted text' sed sed grep /usr/bin /usr/bin 'quoted text'
+sed then export x=1 --verbose --verbose "$1" "$@" -eu 'quoted text' sed "$@" &&
+	local | --verbose export cd 2>/dev/null
+		--verbose done local done cd -eu readonly printf printf local sed printf
+		| then | --verbose grep ${HOME}
+		'quoted text' $(pwd) "$@" then
+then sed $(pwd) -eu test
+--verbose 2>/dev/null 'quoted text'
+	| x=1 cd --verbose -eu "$@" echo awk "$1" cd export readonly && sed sed then 2>/dev/null
+	x=1 export x=1 $(pwd) printf done echo ${HOME} /usr/bin x=1 x=1 --verbose
+	$(pwd) $(pwd) sed then --verbose x=1 then $(pwd) then
+	done ${HOME} export ${HOME} $(pwd) then | then export awk grep | 'quoted text'
+	2>/dev/null test -eu $(pwd) local "$@" -eu awk sed ${HOME} then
+	printf "$@" test x=1 --verbose && /usr/bin local test done test --verbose
+"$1" x=1 'quoted text' -eu x=1 x=1 --verbose 2>/dev/null sed awk done -eu
+"$@" done grep export ${HOME} echo readonly -eu x=1 test
+| local sed grep ${HOME} $(pwd)
+	cd 'quoted text' x=1 printf --verbose
+		printf $(pwd) awk && awk local test
+	local local -eu --verbose
+		$(pwd) printf "$1" ${HOME} sed 'quoted text' 2>/dev/null $(pwd) sed $(pwd)
+2>/dev/null then then echo echo done 2>/dev/null | /usr/bin
+	"$1" -eu echo done | && cd printf "$1" readonly local done -eu echo -eu x=1 "$@"
+-eu $(pwd) printf | /usr/bin grep sed printf
+	-eu then cd | grep cd 2>/dev/null
+		sed cd 'quoted text' $(pwd) export sed | echo "$@" --verbose "$@" x=1
+	cd awk x=1 ${HOME} done
+then | awk && $(pwd) ${HOME} x=1 --verbose readonly | | 2>/dev/null
+		&& readonly /usr/bin grep --verbose local /usr/bin "$1" -eu
+	"$1" then /usr/bin sed -eu sed test
+	then printf grep cd $(pwd) --verbose readonly
+	then 2>/dev/null "$@" grep then then export then grep awk
+		cd 'quoted text' grep then -eu sed
+	${HOME} | -eu cd --verbose -eu -eu && "$1" --verbose
+		export 2>/dev/null "$1" done local 'quoted text' /usr/bin
+"$@" 'quoted text' done printf
+readonly readonly $(pwd) readonly "$@" printf readonly done readonly /usr/bin
+sed local "$@" grep ${HOME} ${HOME} ${HOME} | -eu sed ${HOME} test /usr/bin awk
+-eu "$@" && x=1 cd grep readonly
+		'quoted text' test done 2>/dev/null && readonly --verbose echo echo export
+		echo 'quoted text' "$@"
+echo $(pwd) sed "$@" awk 2>/dev/null export $(pwd) readonly export && export done
+		2>/dev/null /usr/bin -eu grep "$1" 'quoted text'
+		$(pwd) grep echo echo -eu ${HOME} --verbose grep ${HOME}
+		cd done export test -eu printf $(pwd) /usr/bin
+		${HOME} done --verbose 'quoted text' && then export awk && $(pwd) awk done
+	printf grep printf grep cd then local ${HOME} /usr/bin x=1
+	2>/dev/null sed "$1" then readonly --verbose done echo | test "$@" /usr/bin printf
+done -eu sed $(pwd) export
+		grep "$@" && | readonly $(pwd) cd $(pwd) cd sed ${HOME} "$1" && echo then 2>/dev/null
+	'quoted text' 'quoted text' done then
+	local awk --verbose printf done ${HOME} done -eu --verbose --verbose
+		grep awk readonly awk cd grep
+	cd sed awk then readonly "$1" echo readonly "$@" -eu
+	$(pwd) readonly "$1" then -eu sed echo && "$@" then ${HOME} cd | 'quoted text'
+-eu 'quoted text' "$1" printf test local -eu --verbose 'quoted text'
+	"$@" echo x=1 sed x=1 'quoted text' test
+	test "$1" awk printf readonly readonly grep sed $(pwd)
+		$(pwd) --verbose export echo --verbose
+		"$1" 'quoted text' awk ${HOME} export x=1 $(pwd) echo 'quoted text'
+		awk | done sed /usr/bin test | ${HOME} ${HOME} "$@" --verbose
+	2>/dev/null local "$@" -eu cd cd echo awk --verbose
+		| ${HOME} "$1" printf local | | /usr/bin 2>/dev/null echo done
+		done $(pwd) "$1" grep x=1 printf local then "$1" awk awk
+printf "$@" done sed
+"$@" done 2>/dev/null && 2>/dev/null
+	grep grep 'quoted text' cd done
+-eu | | 2>/dev/null grep echo "$1" done &&
+| 'quoted text' printf awk 2>/dev/null printf ${HOME}
+	readonly sed echo then then --verbose done sed echo /usr/bin "$1" x=1
+		$(pwd) readonly | 'quoted text' $(pwd) "$@" ${HOME}
+sed "$@" then then ${HOME} then "$@" "$1" printf ${HOME}
+	readonly ${HOME} echo --verbose readonly "$1" cd ${HOME} "$@" test printf
+	-eu echo $(pwd) grep cd x=1 | then $(pwd) readonly
+'quoted text' $(pwd) 2>/dev/null echo readonly local grep export 'quoted text'
+	$(pwd) 2>/dev/null done sed sed "$@" 'quoted text' printf sed /usr/bin $(pwd) "$1"
+	'quoted text' local printf -eu then echo "$@"
+		sed readonly /usr/bin test
+-eu test "$1" test readonly "$@" readonly printf cd $(pwd)
+-eu then && echo -eu
+		test printf then && echo /usr/bin test readonly $(pwd) awk 2>/dev/null export
+	x=1 && awk 'quoted text' "$@" "$@" awk | && --verbose && grep -eu
+		done cd && $(pwd) --verbose done -eu printf -eu /usr/bin 2>/dev/null
+		"$1" cd /usr/bin "$1" $(pwd) && local cd export /usr/bin
+2>/dev/null /usr/bin done 'quoted text' done && $(pwd) | cd
+	printf readonly x=1 then printf readonly cd --verbose "$1" local 2>/dev/null
+	test printf --verbose then awk test cd then
+		-eu done -eu | awk $(pwd)
+		grep printf done sed sed && echo 2>/dev/null export readonly
+		2>/dev/null 2>/dev/null ${HOME} grep ${HOME} $(pwd) sed
+		export grep $(pwd) --verbose $(pwd) x=1 ${HOME} done && printf
+	| 2>/dev/null done export "$1" readonly 2>/dev/null x=1 done
+		test local readonly "$1"
+		done "$@" grep 2>/dev/null $(pwd) grep 2>/dev/null local cd 2>/dev/null sed /usr/bin
+		"$@" then x=1 printf | -eu test -eu
+		${HOME} awk 'quoted text' test
+		readonly export readonly test ${HOME} $(pwd) 2>/dev/null -eu readonly
+		then 2>/dev/null "$@" --verbose local
+	then grep && /usr/bin sed "$1" x=1 --verbose
+'quoted text' printf "$1" then /usr/bin grep
+	sed sed then 2>/dev/null 'quoted text' 2>/dev/null 2>/dev/null
+$(pwd) x=1 then "$@" "$@" | $(pwd) grep grep --verbose x=1
+	echo 2>/dev/null "$@" awk 'quoted text' then "$1"
+	--verbose x=1 "$@" done $(pwd) printf then then
+	readonly $(pwd) "$1" /usr/bin "$1" cd "$1" sed test x=1 "$@" local
+	test cd --verbose | x=1 /usr/bin cd --verbose "$@" awk done /usr/bin readonly
+--verbose done sed printf ${HOME} -eu | | test
+		grep $(pwd) | | grep sed
+	/usr/bin --verbose && cd "$@" awk | local /usr/bin sed test printf -eu sed --verbose
+		grep --verbose readonly && 'quoted text' then $(pwd) sed then cd 'quoted text'
+sed done test awk ${HOME}
+		local "$1" 2>/dev/null sed sed sed done 2>/dev/null
+local grep export "$@" 'quoted text' awk cd && awk done "$@" 2>/dev/null
+		awk then 2>/dev/null -eu cd | test test cd | 2>/dev/null
+	2>/dev/null -eu awk -eu "$@"
+"$1" /usr/bin && sed 'quoted text'
+		readonly local local | | --verbose cd && --verbose local
+		test && then && local | --verbose "$1" "$1" echo 'quoted text'
+sed -eu readonly then printf ${HOME} | then
+		export done local printf done then cd awk
+	cd printf printf 'quoted text'
+		-eu -eu ${HOME} "$1" && grep
+	readonly readonly x=1 'quoted text' 2>/dev/null "$@" readonly
+export local | ${HOME} then "$1" then /usr/bin "$@" | 'quoted text'
+	-eu then echo export ${HOME}
+grep local 'quoted text' test printf "$@" --verbose
+		echo "$@" done /usr/bin readonly
+		readonly ${HOME} echo local test ${HOME} test "$@" ${HOME} x=1
+-eu x=1 'quoted text' cd cd awk -eu --verbose 2>/dev/null test
+echo printf sed awk && awk test test cd && $(pwd) -eu
+x=1 export /usr/bin test | "$1" --verbose done printf ${HOME}
+printf $(pwd) echo && printf
+		echo /usr/bin test then | export
+| grep printf printf sed $(pwd) awk && sed 2>/dev/null
+	"$@" | local "$1" readonly readonly printf readonly readonly then echo | echo
+| -eu ${HOME} local done test ${HOME} awk then
+		&& ${HOME} 2>/dev/null awk readonly grep sed printf /usr/bin "$1" 'quoted text'
+grep "$1" then 2>/dev/null -eu 'quoted text' $(pwd) export
+	awk "$@" local local | 2>/dev/null /usr/bin && ${HOME}
+${HOME} export printf cd "$1" ${HOME}
+		&& test --verbose echo /usr/bin
+	readonly /usr/bin --verbose cd export && echo echo -eu
+then echo "$1" $(pwd) readonly x=1 grep
+export 'quoted text' -eu awk echo -eu printf
+		&& 'quoted text' "$1" x=1 $(pwd) cd --verbose x=1 cd local 'quoted text'
+		test -eu done awk local && printf "$@" awk done | test $(pwd) $(pwd) "$@" $(pwd)
+		"$1" && "$@" printf --verbose echo /usr/bin sed "$1" $(pwd) then echo /usr/bin 'quoted text'
+	done echo local "$1" -eu
+"$@" cd then grep /usr/bin echo cd local x=1 cd --verbose 2>/dev/null
+		awk | "$1" done && sed "$1" x=1 -eu ${HOME} awk 2>/dev/null then 2>/dev/null
+	2>/dev/null sed $(pwd) sed cd $(pwd) cd echo awk 'quoted text'
+readonly 2>/dev/null grep
+	export awk grep awk local /usr/bin sed
+| ${HOME} "$@" | grep cd export 'quoted text' --verbose then grep
+		sed --verbose | grep then sed 'quoted text'
+		'quoted text' cd && grep sed | cd readonly printf local then /usr/bin x=1 sed
+		"$1" cd | then sed cd "$@" sed "$@" sed
+	echo 2>/dev/null -eu printf 2>/dev/null /usr/bin /usr/bin
+		local $(pwd) "$@" | --verbose sed awk "$1" /usr/bin ${HOME} grep grep
+	'quoted text' echo -eu $(pwd) readonly printf test "$1" printf -eu export $(pwd)
+	local -eu | | sed && x=1 awk 'quoted text' && $(pwd) printf ${HOME}
+	2>/dev/null done && printf ${HOME} "$1" done 2>/dev/null
+	| local then readonly sed grep 'quoted text'
+	printf then awk ${HOME}
+readonly printf printf --verbose $(pwd) grep
+		readonly --verbose readonly done x=1 cd $(pwd) 'quoted text' done cd --verbose
+then x=1 echo sed -eu 2>/dev/null 'quoted text'
+	$(pwd) 2>/dev/null /usr/bin
+	echo readonly x=1 "$1" -eu echo awk sed 'quoted text' && 'quoted text' grep -eu
+	| | "$1" 2>/dev/null grep && sed export "$@" test then
+	&& 2>/dev/null done export && "$@"
+done 2>/dev/null sed "$1" $(pwd) cd x=1
+"$@" --verbose cd printf echo "$@" x=1 printf grep "$1" test test "$1"
+		then 'quoted text' 2>/dev/null /usr/bin --verbose 2>/dev/null
+	echo export 2>/dev/null --verbose test printf then
+cd && x=1 && echo | local && 'quoted text'
+	2>/dev/null readonly -eu then export /usr/bin
+grep local -eu printf sed | export export
+	"$@" export ${HOME} 2>/dev/null
+	"$1" x=1 x=1 grep then /usr/bin "$@" "$1" x=1 "$@" echo ${HOME}
+printf x=1 local done 2>/dev/null local grep
+sed then -eu $(pwd) readonly then
+	| sed $(pwd) -eu 2>/dev/null echo
+	${HOME} | && "$1" readonly && echo --verbose ${HOME} | 2>/dev/null
+		"$1" awk done --verbose "$@"
+	test echo done cd 'quoted text' ${HOME} ${HOME} printf /usr/bin
+	2>/dev/null --verbose && "$@" test grep grep then done then test
+awk local x=1 x=1 then /usr/bin | awk sed 'quoted text'
+		local "$1" printf awk printf test x=1 done 'quoted text'
+--verbose x=1 done test done x=1 --verbose sed 2>/dev/null 'quoted text'
+local then --verbose /usr/bin printf
+'quoted text' awk --verbose then local -eu -eu
+readonly $(pwd) test "$1" sed grep -eu
+		cd printf && $(pwd) local done "$1" 2>/dev/null cd -eu grep grep sed x=1 'quoted text'
+grep -eu then 'quoted text' awk echo && "$@"
+		local -eu 2>/dev/null grep sed /usr/bin $(pwd) /usr/bin
+		&& done "$@" 'quoted text' export echo grep
+echo test sed echo export
+	cd /usr/bin -eu $(pwd) sed $(pwd) echo printf awk
+		sed sed 'quoted text' done "$@" done "$1" "$1"
+	${HOME} 2>/dev/null sed done ${HOME} awk $(pwd) readonly 'quoted text'
+echo 'quoted text' grep ${HOME} $(pwd) test printf
+	echo /usr/bin done $(pwd) | --verbose done "$1"
+done done -eu | "$1" test echo ${HOME} test $(pwd)
+	awk then | readonly | "$1" printf --verbose
+-eu "$@" printf test /usr/bin "$@" -eu 'quoted text' && grep "$@"
+echo readonly 2>/dev/null local echo printf 2>/dev/null
+		echo then $(pwd) ${HOME} test && readonly
+	done done grep test sed 'quoted text' test test
+x=1 echo local cd "$1" local "$@" echo -eu grep "$1" 'quoted text'
+done sed done echo 2>/dev/null |
+awk && test ${HOME} then test ${HOME} grep export local
+		&& "$1" $(pwd) test then "$@" 2>/dev/null ${HOME}
+then done && then -eu | ${HOME} 2>/dev/null "$1" ${HOME}
+printf x=1 printf sed --verbose
+		export ${HOME} awk 2>/dev/null && ${HOME} | cd awk 2>/dev/null /usr/bin
+sed "$1" /usr/bin readonly printf && echo sed grep 2>/dev/null
+		export local 'quoted text' readonly
+printf ${HOME} export cd printf 2>/dev/null local
+#include c61.sh
+${HOME} --verbose printf -eu
+		local "$@" cd -eu "$@" --verbose echo sed export 'quoted text'
+	cd /usr/bin 'quoted text' test 'quoted text' then | /usr/bin
+sed test --verbose echo /usr/bin
+		"$1" cd /usr/bin sed readonly "$1" done grep local x=1 cd $(pwd) awk echo readonly
+	printf "$1" --verbose cd cd $(pwd) | | then && cd && export 'quoted text'
+test | && 'quoted text' "$@" readonly && done $(pwd) readonly grep
+		$(pwd) sed -eu local -eu | test
+sed --verbose 'quoted text'
+		sed readonly printf $(pwd) -eu test readonly local printf "$@" | then 2>/dev/null
+	2>/dev/null 'quoted text' x=1 2>/dev/null test test x=1 cd
+	export --verbose --verbose 2>/dev/null done echo /usr/bin
+		--verbose test --verbose then
+		test | x=1 done --verbose local awk readonly printf
+	/usr/bin --verbose printf $(pwd) 2>/dev/null x=1 | done $(pwd) then && echo export
+		awk test $(pwd) grep /usr/bin -eu
+	done --verbose echo awk local grep sed ${HOME} then test awk awk $(pwd) --verbose
+	&& cd printf "$1" "$1" then && -eu && export readonly
+		$(pwd) -eu /usr/bin "$1" 'quoted text' ${HOME}
+${HOME} 2>/dev/null "$@" echo x=1 echo "$@" test export done sed done
+	then "$1" 2>/dev/null export awk 2>/dev/null --verbose
+awk done "$@" /usr/bin export -eu awk 2>/dev/null x=1 ${HOME}
+	test awk sed "$@" /usr/bin echo x=1 then awk ${HOME} 2>/dev/null readonly grep
+| awk ${HOME} grep done cd $(pwd) local then
+printf done "$1" test "$1" && -eu readonly -eu test
+echo printf 2>/dev/null readonly grep 'quoted text'
+	test | | ${HOME} readonly 'quoted text' echo cd /usr/bin echo readonly
+then done awk $(pwd) echo then /usr/bin readonly
+		${HOME} local | && "$@" | export export "$@"
+	/usr/bin grep cd --verbose ${HOME} cd readonly $(pwd)
+	| 'quoted text' | /usr/bin
+	"$@" test done grep | --verbose "$@" grep local echo
+		then /usr/bin "$1" 'quoted text' grep -eu cd $(pwd) | echo $(pwd)
+	${HOME} "$1" done | cd local done
+	grep ${HOME} then export export --verbose local sed 2>/dev/null readonly
+"$@" $(pwd) | sed -eu -eu readonly cd --verbose "$1" done export "$@" test
+	sed echo && | $(pwd) /usr/bin sed test
+cd grep /usr/bin echo --verbose sed cd x=1 -eu $(pwd) grep /usr/bin export -eu
+	/usr/bin local ${HOME} test "$1" grep /usr/bin
+		export awk "$1" ${HOME} cd echo 2>/dev/null ${HOME} /usr/bin grep printf
+	awk | -eu echo 'quoted text' $(pwd) /usr/bin /usr/bin export /usr/bin
+		$(pwd) $(pwd) then /usr/bin --verbose readonly export then 2>/dev/null
+		test cd then 'quoted text' ${HOME} --verbose ${HOME}
+	test export /usr/bin -eu $(pwd) --verbose awk cd then test
+		test local printf && local x=1 'quoted text' local export /usr/bin /usr/bin
+awk -eu grep then cd | 2>/dev/null
+		grep then && $(pwd) printf printf ${HOME} local /usr/bin --verbose
+"$@" $(pwd) --verbose 2>/dev/null "$@" local
+		local /usr/bin sed cd 2>/dev/null local && /usr/bin
+	-eu /usr/bin export local 2>/dev/null sed
+		printf then then done local echo 2>/dev/null grep cd echo local then
+		"$@" sed 'quoted text' echo
+		grep -eu /usr/bin 2>/dev/null done grep
+cd | cd grep "$@" echo "$@" $(pwd) /usr/bin /usr/bin
+x=1 "$1" "$1" local --verbose export -eu cd echo "$1" x=1 2>/dev/null
+		| -eu printf $(pwd) awk 2>/dev/null
+--verbose done -eu "$1" sed | awk 'quoted text'
+readonly sed export "$@" --verbose test |
+	'quoted text' x=1 cd cd done "$1" then test
+		"$1" cd "$1" sed cd test | then export "$@"
+grep && test -eu 'quoted text' ${HOME} && done export ${HOME} awk
+		2>/dev/null && /usr/bin "$1" export 'quoted text' export | "$@" echo "$@" local
+	cd sed done --verbose $(pwd) cd "$1" /usr/bin 'quoted text' "$@" ${HOME}
+	cd "$@" export export grep local echo sed
+		${HOME} printf echo printf export
+2>/dev/null /usr/bin export
+echo done && then readonly awk "$@" | export then test && -eu export cd printf
+	then local x=1 $(pwd) x=1 /usr/bin $(pwd)
+		-eu /usr/bin cd $(pwd) $(pwd) "$1" && grep test printf 2>/dev/null
+done 2>/dev/null 'quoted text'
+		awk $(pwd) && local 'quoted text' export 2>/dev/null test then 2>/dev/null
+	done then 'quoted text' sed ${HOME} | test readonly
+	echo cd awk cd /usr/bin test printf
+test awk local test --verbose export -eu "$@" test readonly cd
+	cd x=1 test test local -eu 2>/dev/null 2>/dev/null "$1" 2>/dev/null
+| sed 2>/dev/null x=1 echo test x=1 "$1" "$@" &&
+	sed awk && echo x=1 grep done && | ${HOME} /usr/bin
+	readonly --verbose --verbose ${HOME} 'quoted text' && awk --verbose done local
+		grep /usr/bin --verbose echo -eu --verbose printf local
+		/usr/bin $(pwd) | "$@" -eu
+	&& 2>/dev/null local readonly awk test
+	awk printf printf | "$@" cd $(pwd) local grep cd awk then ${HOME} grep
+	sed ${HOME} ${HOME} 'quoted text' then cd "$1" test done printf
+		local ${HOME} | 'quoted text' -eu echo then printf sed cd /usr/bin printf
+		export && /usr/bin printf grep ${HOME} echo
+	"$1" -eu --verbose echo 'quoted text' --verbose
+		cd | done ${HOME} local printf ${HOME}
+${HOME} ${HOME} x=1 | "$1" ${HOME} "$@" -eu "$@" awk
+	/usr/bin 2>/dev/null local export
+	--verbose grep | "$@" $(pwd) ${HOME} grep x=1 export
+		$(pwd) cd /usr/bin "$@" -eu 2>/dev/null 'quoted text' awk
+printf 'quoted text' | /usr/bin echo ${HOME} then
+	&& && 'quoted text' "$@" | /usr/bin | /usr/bin
+	then -eu readonly -eu readonly sed
+-eu --verbose done ${HOME}
+/usr/bin awk /usr/bin echo $(pwd) awk echo cd | $(pwd) | grep $(pwd) -eu
+		then | ${HOME} readonly /usr/bin -eu "$1" | test echo printf
+/usr/bin /usr/bin "$1" | local ${HOME} printf -eu awk echo x=1 sed test
+	2>/dev/null /usr/bin test local | --verbose grep then x=1 ${HOME}
+		x=1 then export sed done printf "$@" readonly $(pwd) local -eu cd readonly |
+	test | /usr/bin test x=1 2>/dev/null /usr/bin export -eu ${HOME}
+awk sed /usr/bin done 2>/dev/null -eu cd "$@" local ${HOME} grep awk
+	'quoted text' done --verbose local "$1" test && printf awk "$@" cd then grep readonly
+	-eu | then echo readonly then $(pwd) x=1 echo cd "$@" sed cd | grep "$1" | "$1"
+'quoted text' 'quoted text' then
+		awk grep | x=1 -eu 'quoted text' printf test -eu
+		export "$@" done 2>/dev/null echo x=1 grep
+		cd -eu 'quoted text' test local local printf "$@" then test
+| && export done ${HOME} readonly sed test
+	done readonly $(pwd) "$1" done done | | --verbose cd --verbose
+grep export then cd cd then readonly /usr/bin ${HOME} /usr/bin
+		export && $(pwd) x=1 "$1" && -eu test echo /usr/bin -eu | grep 'quoted text'
+2>/dev/null 2>/dev/null | done then done sed 2>/dev/null
+	readonly && sed local $(pwd) then printf | cd 2>/dev/null export
+		${HOME} echo --verbose "$1" "$@" local x=1 $(pwd)
+		export "$@" readonly printf "$1" local awk x=1 | local local "$1" done
+echo cd printf "$1" && readonly ${HOME} local 2>/dev/null
+	-eu 2>/dev/null $(pwd) | grep
+"$1" $(pwd) echo /usr/bin --verbose
+test && test 'quoted text' | ${HOME} printf "$1" 2>/dev/null
+		2>/dev/null /usr/bin sed
+	local sed cd awk then echo local -eu local test then -eu readonly
+		--verbose echo /usr/bin "$@" 'quoted text' $(pwd) x=1 "$1" readonly
+		cd echo && then | | then readonly export sed
+		2>/dev/null 2>/dev/null -eu test && x=1 sed sed 'quoted text' "$@" 'quoted text'
+$(pwd) echo test local "$@" printf echo test echo awk /usr/bin
+		done 'quoted text' -eu grep --verbose sed | -eu /usr/bin
+		"$1" export ${HOME} /usr/bin 'quoted text' "$1"
+	done awk local printf "$1" $(pwd) | then x=1
+	then done "$@" && 'quoted text' readonly done | x=1 local
+		&& -eu sed "$1" 2>/dev/null $(pwd) export done
+		export ${HOME} grep 'quoted text' done sed -eu printf readonly then cd $(pwd) sed
+'quoted text' cd "$1" test
+	-eu readonly --verbose export cd then then && awk local grep
+export sed /usr/bin $(pwd) readonly export
+		echo printf /usr/bin 'quoted text' done && local export
+export grep && -eu | /usr/bin
+| "$@" ${HOME} export export then readonly readonly x=1 x=1 test
+	&& | grep done then readonly "$1" cd 'quoted text' awk $(pwd)
+		"$1" printf && cd -eu then test $(pwd) local
+	'quoted text' 2>/dev/null then ${HOME} ${HOME} 2>/dev/null
+	readonly printf test export x=1 readonly
+&& 2>/dev/null 2>/dev/null 2>/dev/null /usr/bin awk local grep
+$(pwd) local ${HOME} x=1 awk awk grep awk local /usr/bin
+	then readonly "$1" -eu && echo printf printf done ${HOME} printf done
+		grep && done 2>/dev/null -eu local | 2>/dev/null
+-eu "$@" "$@" done readonly "$@" --verbose --verbose x=1 printf export export
+		local done then echo cd
+$(pwd) 2>/dev/null test grep export "$@" -eu "$1" $(pwd) -eu $(pwd) grep
+		grep 'quoted text' | export && "$@" local cd | /usr/bin done --verbose
+/usr/bin awk /usr/bin awk local awk 2>/dev/null
+	cd done echo ${HOME} $(pwd) sed cd cd test awk
+		x=1 export -eu printf -eu 'quoted text'
+--verbose test echo ${HOME} --verbose cd $(pwd) ${HOME}
+	2>/dev/null test sed local then
+	echo sed awk sed test export local -eu -eu cd /usr/bin --verbose then
+		export ${HOME} grep /usr/bin
+cd x=1 x=1 local && export $(pwd) grep | printf
+grep echo echo export ${HOME} test
+	&& printf 'quoted text' -eu readonly | test
+	"$@" echo cd $(pwd) then
+echo 2>/dev/null ${HOME} grep --verbose x=1 | $(pwd) echo
+		/usr/bin "$@" test echo "$@" export && 2>/dev/null awk x=1
+test local 'quoted text' x=1 echo test test test local export
+		${HOME} | -eu done echo awk $(pwd) awk x=1
+awk -eu /usr/bin /usr/bin --verbose "$1" "$@" ${HOME} grep printf echo -eu x=1 test
+		then then echo done grep done export
+		printf readonly test awk readonly sed grep ${HOME} cd then export 2>/dev/null
+		sed "$1" "$@" "$1" 'quoted text' grep $(pwd)
+	2>/dev/null test awk test x=1 test grep grep export printf "$1" "$@" done "$@"
+export test 'quoted text' -eu test && ${HOME} readonly 'quoted text' -eu
+		grep 2>/dev/null "$@" 'quoted text'
+		readonly cd sed then done printf grep $(pwd) && printf then -eu grep
+readonly -eu awk /usr/bin awk
+"$1" then done awk -eu "$@" done && -eu /usr/bin readonly /usr/bin
+	--verbose --verbose --verbose readonly && && local
+local awk export -eu grep ${HOME} 2>/dev/null
+		${HOME} "$@" -eu ${HOME} grep done | | --verbose -eu && grep then local 'quoted text'
+&& /usr/bin ${HOME} echo grep 'quoted text' grep -eu /usr/bin
+	readonly local done | export &&
+		done $(pwd) export readonly x=1 /usr/bin
+echo cd cd x=1 done local then sed readonly "$@" export
+	'quoted text' echo "$1" "$1" 'quoted text' done done sed && export local
+	| sed "$@" 2>/dev/null grep done ${HOME}
+		cd sed && awk awk readonly -eu --verbose awk test echo awk
+&& x=1 && | local echo -eu "$@" printf
+export export grep grep "$1" /usr/bin readonly "$@" $(pwd) 2>/dev/null done
+		${HOME} "$@" | ${HOME} ${HOME} readonly sed printf --verbose
+		then cd x=1 awk 'quoted text'
+$(pwd) && --verbose 2>/dev/null "$@" test test && "$@" cd
+	local "$1" done --verbose awk 'quoted text'
+'quoted text' x=1 2>/dev/null printf x=1 cd cd export 2>/dev/null export local
+sed 2>/dev/null grep "$1" export
+test awk x=1 done /usr/bin export awk done "$@" echo /usr/bin $(pwd) local
+| done "$1" | export --verbose sed -eu "$@" "$1" then export done "$1" x=1 "$@"
+	cd && "$1" printf 'quoted text' test /usr/bin 2>/dev/null grep cd
+		local --verbose grep then --verbose grep local | --verbose test
+		awk "$@" awk ${HOME} then 2>/dev/null grep ${HOME} $(pwd) -eu local
+--verbose cd ${HOME} /usr/bin printf 'quoted text' cd done ${HOME}
+2>/dev/null /usr/bin echo awk | "$@" local && export && awk awk x=1 local &&
+export printf 2>/dev/null test /usr/bin then "$@" -eu |
+	--verbose && $(pwd) local /usr/bin | sed
+printf local $(pwd) 'quoted text' -eu local printf && done then printf
+	--verbose /usr/bin awk readonly
+	sed done x=1 "$@" $(pwd) 'quoted text'
+		"$@" grep done then 'quoted text'
+		'quoted text' test local cd | /usr/bin echo /usr/bin cd
+	done | x=1 ${HOME} export 2>/dev/null --verbose readonly
+		echo sed && x=1 export /usr/bin export /usr/bin x=1 sed printf
+	$(pwd) x=1 cd sed && readonly && $(pwd) echo
+local "$@" export 'quoted text' x=1 $(pwd) -eu | echo 'quoted text' | 'quoted text'
+local "$1" echo then /usr/bin
+		--verbose $(pwd) "$@" -eu printf test
+readonly sed awk test 'quoted text' --verbose local && x=1 test 'quoted text'
+	$(pwd) done awk 2>/dev/null ${HOME}
+	test test export then printf export ${HOME} ${HOME} local 'quoted text' awk $(pwd)
+	-eu --verbose -eu ${HOME} grep then 'quoted text' /usr/bin ${HOME}
+printf done then echo grep -eu
+	cd awk cd awk | grep "$1" done grep | done | printf
+	readonly x=1 $(pwd) export ${HOME} echo x=1 grep done && readonly
+&& | done -eu local readonly export done cd | echo --verbose
+	${HOME} local --verbose -eu export | export "$@" 2>/dev/null done cd $(pwd)
+cd cd sed export test
+	echo awk -eu -eu | -eu test readonly cd && export echo echo then
+	printf sed cd echo --verbose
+cd /usr/bin printf -eu x=1 local test echo sed | cd "$1" ${HOME}
+		/usr/bin printf ${HOME} 'quoted text' 'quoted text' test echo
+	awk 'quoted text' sed export 2>/dev/null then export test sed sed $(pwd)
+	echo done echo -eu awk printf -eu "$@" -eu echo echo test $(pwd)
+		-eu readonly 'quoted text' -eu $(pwd) "$@" printf export then "$1" cd && ${HOME}
+echo cd then | test | readonly test --verbose "$@" "$1" test 'quoted text'
+then /usr/bin test then cd x=1 /usr/bin "$1" "$@" readonly
+		sed cd done -eu $(pwd) grep export
+	--verbose then awk 2>/dev/null sed "$1" sed done ${HOME} sed awk && "$@"
+		echo | grep -eu printf readonly 'quoted text'
+&& done ${HOME} echo printf awk printf --verbose
+		local awk local awk 2>/dev/null awk awk local 'quoted text' cd 2>/dev/null
+--verbose /usr/bin /usr/bin local export export x=1 local | awk then test
+&& export readonly echo cd done cd printf then done
+		"$@" --verbose echo awk sed then && grep sed
+	x=1 && 'quoted text' then grep --verbose /usr/bin ${HOME} export /usr/bin then
+	&& "$1" && ${HOME} readonly 'quoted text' then grep test -eu
+test "$@" && export $(pwd) 2>/dev/null
+		printf | && readonly -eu $(pwd) echo ${HOME} sed grep ${HOME} export cd
+echo cd | $(pwd) --verbose then ${HOME} && echo x=1 | "$1" $(pwd) export
+grep export export cd echo echo local export sed then
+readonly done --verbose cd done | && awk 2>/dev/null readonly cd readonly done
+		test ${HOME} && echo x=1 local 2>/dev/null
+	local -eu grep && && grep echo $(pwd) cd
+	'quoted text' | "$@" test | done cd ${HOME} printf
+--verbose then 'quoted text' /usr/bin "$1" printf && --verbose done | "$@" printf
+sed printf test "$1" grep grep done
+x=1 test readonly x=1
+	'quoted text' -eu "$@" awk grep awk 'quoted text' 'quoted text'
+		${HOME} 2>/dev/null && printf --verbose
+	--verbose -eu "$1" local readonly
+	echo echo echo echo /usr/bin printf /usr/bin 2>/dev/null ${HOME} done
+		printf export export awk awk ${HOME} test
+	2>/dev/null local -eu -eu "$1" ${HOME} grep /usr/bin 2>/dev/null grep
+test done then done | cd x=1 export 'quoted text' grep $(pwd) "$@" awk awk
+	test /usr/bin 2>/dev/null -eu grep |
+/usr/bin printf printf echo local sed cd /usr/bin ${HOME} $(pwd) --verbose
+done --verbose -eu 'quoted text'
+	"$1" done -eu 2>/dev/null export awk awk
+		$(pwd) 'quoted text' test x=1 "$1" readonly printf
+		done /usr/bin x=1 cd awk printf cd readonly $(pwd) 'quoted text'
+	then x=1 done done readonly
+		then sed 'quoted text' $(pwd) | printf
+	"$1" "$@" "$1" export x=1 grep export printf echo
+$(pwd) grep --verbose cd "$@" /usr/bin $(pwd)
+--verbose cd 'quoted text' $(pwd)
+test /usr/bin readonly | echo | printf awk awk && /usr/bin "$@" readonly local
+		2>/dev/null test done 2>/dev/null
+		x=1 "$@" printf awk ${HOME} | $(pwd) awk -eu
+	$(pwd) cd | 2>/dev/null /usr/bin $(pwd) x=1 | /usr/bin "$@" echo --verbose
+export 2>/dev/null -eu
+then 'quoted text' "$1" local echo x=1
+		grep cd 2>/dev/null done readonly cd 'quoted text' "$1"
+		printf /usr/bin /usr/bin
+cd ${HOME} readonly "$1" --verbose test cd echo 'quoted text' grep
+&& done x=1 && readonly && grep export $(pwd) sed
+readonly ${HOME} -eu 2>/dev/null && "$@" sed
+-eu | --verbose printf sed $(pwd)
+	printf 2>/dev/null $(pwd) $(pwd) ${HOME} && cd "$@" cd | readonly
+	&& "$1" "$@" x=1 readonly grep sed grep local cd printf test
+awk ${HOME} && then export
+done /usr/bin test grep export "$1" grep local -eu grep sed
+	grep sed x=1 | readonly | then local printf local
+done printf printf "$@" grep echo export 2>/dev/null done local "$@" done | 2>/dev/null
+	x=1 ${HOME} test then "$1" ${HOME} -eu $(pwd) echo 2>/dev/null
+		local awk -eu done done readonly readonly ${HOME} done /usr/bin --verbose
+	2>/dev/null done local test local
+		cd test done /usr/bin /usr/bin
+printf /usr/bin readonly "$1" x=1
+		x=1 sed then test /usr/bin local --verbose "$@" -eu 'quoted text'
+	cd cd then sed && 2>/dev/null local readonly /usr/bin "$@" grep --verbose
+	sed then ${HOME} 2>/dev/null "$1" awk export then echo --verbose test
+		sed awk then ${HOME} "$1" "$1" ${HOME} 2>/dev/null ${HOME} export x=1 ${HOME}
+	-eu grep $(pwd) sed "$1" --verbose
+		local sed awk && 'quoted text' x=1 printf then echo
+		export export | local
+	/usr/bin "$1" && --verbose echo grep export
+echo test -eu echo -eu export /usr/bin local done "$1" printf -eu
+		$(pwd) "$1" 'quoted text' cd &&
+		"$1" readonly x=1 'quoted text' /usr/bin
+awk -eu echo grep "$@" cd $(pwd) 2>/dev/null
+		"$1" local && readonly local test sed "$1" "$1" x=1
+	"$1" local awk 'quoted text' awk &&
+	&& export grep printf test ${HOME}
+		x=1 "$@" -eu echo --verbose "$@"
+"$@" grep then ${HOME} cd |
+	2>/dev/null --verbose && export && $(pwd) "$@" --verbose export
+printf echo 2>/dev/null printf /usr/bin printf ${HOME} x=1 --verbose -eu
+local then "$@" readonly $(pwd) local printf --verbose
+		x=1 done ${HOME} then 'quoted text' awk grep -eu | done
+		"$1" awk awk readonly -eu printf
+		'quoted text' /usr/bin local -eu ${HOME} 'quoted text'
+	x=1 then awk echo | | local $(pwd) readonly
+export | printf then local $(pwd) -eu 'quoted text' --verbose
+	awk local test x=1 test done $(pwd) test awk && test $(pwd) local 'quoted text'
+	printf local 2>/dev/null && | /usr/bin test &&
+/usr/bin 'quoted text' local sed | cd awk
+done export echo x=1 --verbose $(pwd) then 2>/dev/null
+printf echo then $(pwd) awk $(pwd) sed awk printf
+	${HOME} export then local | ${HOME}
+'quoted text' printf x=1 2>/dev/null | | readonly -eu awk && awk sed echo test
+local x=1 "$@" 2>/dev/null export x=1 cd printf x=1 -eu export --verbose
+	${HOME} test cd -eu "$@" && ${HOME}
+"$1" grep x=1 $(pwd) then && ${HOME} | done done export then 2>/dev/null
+printf then "$@" 2>/dev/null ${HOME} sed sed /usr/bin
+readonly $(pwd) sed x=1 "$@" ${HOME} printf done echo "$@" x=1 readonly echo
+grep "$@" 'quoted text'
+readonly "$@" ${HOME} echo && /usr/bin 'quoted text' printf && test
+2>/dev/null ${HOME} grep x=1 printf printf sed ${HOME} "$1" then cd
+		then ${HOME} -eu x=1 --verbose 'quoted text'
+then x=1 && cd then awk && -eu
+	&& && 2>/dev/null "$@" sed $(pwd) local readonly | readonly
+		local --verbose && sed sed awk $(pwd) ${HOME} printf 2>/dev/null
+		x=1 "$@" $(pwd) -eu cd ${HOME} done export then then printf local
+	| ${HOME} | "$@" /usr/bin $(pwd) x=1 --verbose printf && ${HOME} -eu done
+		$(pwd) 'quoted text' -eu "$1" /usr/bin
+	grep && | 2>/dev/null sed && awk done cd $(pwd) echo local
+	&& 2>/dev/null --verbose echo $(pwd) then 'quoted text' | awk then "$@" ${HOME}
+test test /usr/bin test then then readonly ${HOME}
+		$(pwd) then cd cd "$1" && echo readonly 'quoted text'
+	/usr/bin | test -eu local $(pwd) | 2>/dev/null x=1 then
+		printf -eu printf ${HOME} awk cd then local local /usr/bin && | local "$@" sed
+		test readonly -eu printf "$@" printf x=1 export awk awk
+"$@" cd 2>/dev/null awk done x=1 /usr/bin readonly export local cd &&
+readonly 'quoted text' cd x=1 &&
+	export && local 2>/dev/null done "$@" ${HOME} then "$1" | 'quoted text'
+&& cd ${HOME} /usr/bin readonly
+		cd cd printf then done then "$1" readonly
+then -eu 2>/dev/null 'quoted text' && local
+		${HOME} 'quoted text' readonly
+printf /usr/bin && local awk ${HOME} --verbose
+| "$@" local $(pwd) test grep cd cd export then 2>/dev/null local x=1 --verbose
+	$(pwd) readonly -eu then "$1" grep test 'quoted text' /usr/bin "$@" /usr/bin
+"$1" /usr/bin 'quoted text' ${HOME} "$1" readonly "$1" 2>/dev/null
+	-eu awk && then && grep then export
+		local export "$1" test /usr/bin /usr/bin echo export
+		"$@" test "$1" done x=1 | local readonly && sed
+done $(pwd) "$@" test $(pwd) grep && done awk test $(pwd)
+	local export printf readonly ${HOME} cd printf "$1" /usr/bin export ${HOME}
+	x=1 readonly export done
+		awk sed 'quoted text'
+	x=1 sed /usr/bin export --verbose 'quoted text' | $(pwd)
+		"$@" && "$@" then $(pwd) "$1" /usr/bin done sed local readonly
+$(pwd) done printf /usr/bin --verbose awk
+		grep sed done && -eu | export
+	x=1 test readonly $(pwd) 'quoted text' then $(pwd) "$1" readonly
+	readonly x=1 readonly | then 'quoted text' && sed printf cd cd /usr/bin cd -eu /usr/bin
+	$(pwd) --verbose local sed readonly local done test 2>/dev/null
+		then done local local awk export &&
+		test && echo sed then ${HOME} cd 2>/dev/null test /usr/bin
+		/usr/bin echo -eu -eu "$@" then "$1" sed | 'quoted text' then $(pwd) awk x=1
+	local test $(pwd) grep "$@" | awk -eu done done cd test local --verbose
+	grep --verbose then -eu "$@" test -eu /usr/bin
+	$(pwd) /usr/bin readonly sed export sed -eu printf 2>/dev/null x=1 "$@" /usr/bin
+	grep ${HOME} cd ${HOME} awk -eu
+then cd --verbose "$1" readonly --verbose -eu
+		x=1 $(pwd) then cd "$1" awk && done
+test "$@" $(pwd) 2>/dev/null cd 2>/dev/null printf
+	'quoted text' readonly $(pwd)
+		local grep awk --verbose "$1" $(pwd) 2>/dev/null
+		2>/dev/null ${HOME} grep 'quoted text' 2>/dev/null &&
+		/usr/bin cd export "$1" --verbose local readonly && then local done /usr/bin /usr/bin
+	$(pwd) readonly done readonly
+	test local -eu sed x=1 --verbose awk 'quoted text' 'quoted text'
+		&& /usr/bin -eu export then printf readonly $(pwd) echo echo && test
+		--verbose readonly "$@" grep local sed local --verbose
+		'quoted text' --verbose awk "$@" /usr/bin "$1" readonly
+	grep 'quoted text' then awk done readonly -eu echo "$@"
+		"$1" 2>/dev/null | && ${HOME} x=1 grep 'quoted text' awk | "$1"
+$(pwd) printf awk echo /usr/bin x=1 then
+	"$@" $(pwd) $(pwd) printf "$@" | -eu awk sed export printf sed $(pwd) "$1" | $(pwd)
+		grep sed /usr/bin -eu awk test /usr/bin then x=1 grep && done export
+		export $(pwd) 2>/dev/null sed x=1 test 2>/dev/null $(pwd) ${HOME} $(pwd)
+		readonly ${HOME} export && sed "$@"
+export $(pwd) --verbose done then done && grep |
+-eu 'quoted text' $(pwd) ${HOME}
+	x=1 'quoted text' 2>/dev/null grep local sed then printf
+local echo x=1 "$1" export test
+	awk "$1" 'quoted text' "$1" sed echo --verbose local done
+		$(pwd) echo 2>/dev/null local export /usr/bin 'quoted text' done 2>/dev/null export
+	2>/dev/null /usr/bin --verbose readonly 2>/dev/null "$@"
+		local -eu awk awk echo local | "$@" export
+readonly cd $(pwd) ${HOME} awk
+	${HOME} && echo $(pwd) then /usr/bin awk 2>/dev/null | | 2>/dev/null
+echo --verbose readonly then export local && cd 2>/dev/null
+${HOME} cd test x=1 --verbose cd
+	test $(pwd) sed $(pwd) awk
+readonly readonly local then local && grep 'quoted text'
+	printf ${HOME} sed awk && && && printf 'quoted text' /usr/bin 'quoted text'
+awk ${HOME} $(pwd) 'quoted text' local awk 2>/dev/null x=1 awk
+	| awk done -eu && $(pwd) ${HOME}
+		"$1" sed then then awk /usr/bin $(pwd) test test 'quoted text'
+then --verbose /usr/bin awk done printf
+		'quoted text' cd "$1" readonly test $(pwd) echo
+printf 'quoted text' /usr/bin
+	"$1" ${HOME} && "$@"
+"$1" done ${HOME} echo export $(pwd) ${HOME} --verbose 2>/dev/null
+		| echo && /usr/bin awk $(pwd) "$1" "$@"
+	cd export sed /usr/bin echo /usr/bin /usr/bin printf readonly x=1 readonly
+		local 2>/dev/null sed readonly 'quoted text' 'quoted text'
+awk then echo -eu && | 2>/dev/null
+grep grep -eu --verbose export --verbose x=1 echo done
+	done export "$1" sed "$@" done && printf --verbose
+	'quoted text' sed 'quoted text' --verbose /usr/bin
+		-eu | ${HOME} cd && test test
+&& $(pwd) sed printf grep export && done /usr/bin cd /usr/bin "$@"
+	"$@" grep 2>/dev/null echo && && cd "$1" &&
+--verbose x=1 test export readonly
+	echo 2>/dev/null local "$1" test export sed cd echo |
+--verbose echo "$@" awk done awk readonly /usr/bin local cd then
+then echo 2>/dev/null
+	| readonly "$1" | 'quoted text' sed readonly | ${HOME} x=1 x=1 && printf cd |
+		readonly cd cd /usr/bin $(pwd) awk | "$1" x=1 && sed printf then then -eu
+done local ${HOME} done --verbose local
+		${HOME} readonly | $(pwd) test local grep then readonly
+| | export then cd awk $(pwd) 'quoted text' /usr/bin
+		cd && "$1" echo "$@" cd x=1
+	/usr/bin awk && "$@" test cd grep then test --verbose
+	then && awk 'quoted text' export awk then done grep
+		2>/dev/null awk /usr/bin test -eu && 'quoted text' && x=1 cd export cd
+$(pwd) done echo local then 2>/dev/null $(pwd) grep
+	$(pwd) /usr/bin export | then
+		"$@" export -eu "$@" cd sed "$1"
+	--verbose 2>/dev/null test 2>/dev/null
+		then 'quoted text' x=1 ${HOME} export 2>/dev/null grep /usr/bin
+		export "$1" --verbose ${HOME} export local --verbose done $(pwd)
+	grep 2>/dev/null | "$@" grep printf readonly cd
+	test -eu 2>/dev/null grep local "$1"
+done 'quoted text' cd 'quoted text' "$1" cd ${HOME}
+	${HOME} | | done -eu cd done cd local local
+"$@" echo /usr/bin /usr/bin
+	done grep sed 2>/dev/null local
+| local "$1" cd "$@" && 'quoted text'
+	"$1" local echo | x=1 /usr/bin
+$(pwd) awk --verbose 2>/dev/null readonly grep && 2>/dev/null
+	/usr/bin test local /usr/bin printf then export -eu readonly
+		| && export /usr/bin $(pwd) awk x=1 --verbose
+		echo local "$@" 2>/dev/null ${HOME} awk 2>/dev/null "$@"
+		2>/dev/null /usr/bin $(pwd) printf x=1 'quoted text'
+grep awk grep "$@" echo /usr/bin readonly sed
+		"$@" export printf "$1" sed | local "$1"
+	export done export test grep $(pwd) then ${HOME} -eu 'quoted text' test
+		'quoted text' echo /usr/bin "$@" grep echo && local --verbose local /usr/bin
+sed $(pwd) --verbose "$1"
+	${HOME} printf sed "$@" local /usr/bin -eu ${HOME} --verbose local awk grep 2>/dev/null
+		"$@" ${HOME} --verbose done 'quoted text' 2>/dev/null
+	echo awk export && grep test grep echo awk export -eu cd done printf
+	done 'quoted text' 'quoted text' "$1" cd | readonly
+		sed "$1" echo sed && echo -eu local awk sed $(pwd) "$1" grep /usr/bin test --verbose
+	'quoted text' printf done then -eu then
+		${HOME} "$1" /usr/bin readonly grep grep && 'quoted text' done
+	${HOME} 2>/dev/null "$@"
+		sed ${HOME} then /usr/bin --verbose /usr/bin $(pwd) export
+${HOME} ${HOME} "$1" cd test printf export export 2>/dev/null $(pwd) awk
+		then printf awk cd ${HOME} | $(pwd) && /usr/bin awk
+${HOME} /usr/bin then sed local "$1" local cd 2>/dev/null readonly
+		export 2>/dev/null 'quoted text' /usr/bin local then && "$1" "$1"
+		x=1 echo echo $(pwd) 2>/dev/null grep awk echo
+| done test awk readonly echo 'quoted text' grep export
+		&& x=1 grep done "$1" awk ${HOME} echo && 2>/dev/null echo x=1 ${HOME} printf
+grep local | ${HOME} x=1 grep ${HOME}
+'quoted text' test cd "$@" echo printf
+	-eu grep awk export -eu cd "$1" 'quoted text'
+		/usr/bin printf -eu local "$1" awk "$@" 'quoted text'
+	${HOME} -eu $(pwd) cd readonly printf then x=1 x=1 -eu 'quoted text' then sed readonly
+$(pwd) $(pwd) export |
+		/usr/bin sed sed done then grep readonly
+		&& "$1" -eu then -eu sed printf "$@" "$1" 'quoted text' readonly
+sed 2>/dev/null echo
+		| test local "$@" done $(pwd) awk export readonly x=1 /usr/bin
+	${HOME} echo export | ${HOME} export
+		'quoted text' printf x=1 && grep done "$1" awk --verbose printf cd
+		echo "$1" --verbose $(pwd) readonly ${HOME} -eu $(pwd) --verbose export printf
+'quoted text' "$1" && done echo export sed echo ${HOME} "$@" cd
+sed then export grep local
+		awk then then test test readonly grep readonly $(pwd) "$@" test local echo && grep
+		/usr/bin 'quoted text' test test grep sed
+		readonly x=1 export 'quoted text'
+		/usr/bin x=1 'quoted text' /usr/bin cd local | readonly 'quoted text'
+	2>/dev/null -eu "$@" | --verbose grep "$@" printf done
+/usr/bin "$1" sed ${HOME} "$1" sed ${HOME} printf cd "$1" x=1 local --verbose
+		grep "$@" sed 'quoted text'
+		readonly -eu export echo cd done test readonly printf x=1 readonly "$1"
+	export x=1 local test --verbose grep grep test 'quoted text' 'quoted text'
+'quoted text' $(pwd) 'quoted text' $(pwd) sed export readonly
+-eu done export echo readonly "$@" x=1 export | printf
+"$1" echo cd local $(pwd) 'quoted text' 2>/dev/null x=1 | x=1 grep 'quoted text'
+	"$1" "$1" sed 'quoted text' "$1" && sed x=1 test "$@" 'quoted text' /usr/bin
+awk --verbose "$1" ${HOME}
+		2>/dev/null ${HOME} then grep awk 'quoted text'
+	echo done && && "$1" test test local readonly --verbose awk awk 2>/dev/null
+		done /usr/bin && --verbose grep echo then test ${HOME} "$@" 'quoted text' test
+"$@" printf sed done | readonly readonly 2>/dev/null done "$@" cd | awk echo
+${HOME} x=1 local "$@" /usr/bin "$@" 2>/dev/null
+	printf cd awk | ${HOME} awk && cd cd /usr/bin grep "$1" then /usr/bin
+printf "$1" grep | export echo x=1 readonly
+		sed then then 2>/dev/null 'quoted text' cd && 2>/dev/null readonly && ${HOME} done
+	echo $(pwd) awk $(pwd) cd $(pwd) 'quoted text' cd -eu |
+		-eu $(pwd) cd export cd
+		test cd then then $(pwd)
+		printf test sed done ${HOME} echo 2>/dev/null x=1 then grep
+		printf "$@" local -eu ${HOME} "$1" --verbose | $(pwd) -eu /usr/bin -eu cd local
+		sed printf -eu x=1 -eu --verbose
+	readonly /usr/bin x=1 "$1" 2>/dev/null ${HOME}
+	"$@" test | printf printf && awk
+		printf sed awk && sed "$@" export done
+	| $(pwd) export echo | ${HOME}
+$(pwd) /usr/bin readonly "$@" -eu 'quoted text' /usr/bin "$@" $(pwd) ${HOME} cd
+grep && export grep "$@"
+| readonly -eu readonly done local then /usr/bin readonly grep awk 'quoted text'
+awk x=1 grep "$1" | cd test printf local done grep "$@" | export echo export
+		readonly test -eu "$1" x=1
+$(pwd) --verbose export awk "$@" ${HOME}
+		local done "$1" done /usr/bin && && | echo
+	"$@" 2>/dev/null 2>/dev/null
+cd --verbose -eu -eu readonly -eu export sed x=1 $(pwd) grep awk printf
+test export x=1 && 'quoted text'
+		-eu local $(pwd) echo readonly /usr/bin awk test $(pwd) | printf |
+readonly local --verbose local echo
+	cd "$1" 'quoted text' readonly sed | "$@" done x=1 "$@" /usr/bin -eu x=1 then
+$(pwd) --verbose grep local | 'quoted text' cd test $(pwd) "$@" awk then
+	readonly && local grep local
+2>/dev/null then --verbose readonly readonly
+printf x=1 x=1 readonly ${HOME} test
+		export cd echo awk 2>/dev/null readonly | ${HOME} then
+		export awk export awk
+		readonly export readonly "$1" printf
+		test export --verbose -eu awk test local local
+		/usr/bin awk done then -eu "$1" echo export grep
+		grep then grep /usr/bin printf
+cd printf cd sed local | "$1" 'quoted text' 'quoted text'
+		echo grep grep awk x=1 awk "$@" cd | sed sed readonly $(pwd)
+		grep -eu done local && local && printf | --verbose printf | 2>/dev/null awk test
+		'quoted text' local echo
+sed export local grep --verbose
+	local "$1" echo sed cd "$1" echo 'quoted text' x=1 export
+	export cd && echo "$@" "$1" echo local test /usr/bin
+${HOME} done echo echo 'quoted text' awk ${HOME} ${HOME}
+	then test x=1 ${HOME} readonly awk --verbose printf
+done "$@" grep | awk "$@" ${HOME} then $(pwd) && $(pwd) -eu | then x=1
+		'quoted text' 'quoted text' readonly x=1 test done "$1" local
+		local "$@" cd $(pwd) printf sed -eu 2>/dev/null | "$1" 'quoted text' && local /usr/bin
+| readonly local "$1" test
+	sed "$1" then then "$@" done /usr/bin
+cd $(pwd) /usr/bin 'quoted text'
+	printf local ${HOME} | x=1 | awk readonly done printf 2>/dev/null ${HOME}
+cd 'quoted text' /usr/bin then
+$(pwd) --verbose readonly 2>/dev/null --verbose test x=1 $(pwd) x=1 --verbose
+	&& "$@" -eu "$@" x=1 then
+	readonly --verbose x=1 && awk x=1
+	grep local -eu grep $(pwd)
+	-eu cd then test x=1 "$@" local test /usr/bin -eu && 'quoted text'
+echo 2>/dev/null grep 'quoted text' local && | local --verbose 2>/dev/null
+		/usr/bin echo -eu 2>/dev/null "$@" grep echo --verbose
+awk 'quoted text' test sed "$1" ${HOME} && done 'quoted text' local
+	done cd /usr/bin ${HOME} && then done awk -eu export sed echo
+then cd export $(pwd) ${HOME} "$@" readonly
+2>/dev/null 2>/dev/null
+	test -eu local x=1 /usr/bin
+local x=1 sed awk /usr/bin cd $(pwd) test cd "$@" "$@" cd /usr/bin
+${HOME} then then echo /usr/bin readonly cd printf
+		"$@" sed x=1 ${HOME} && "$@" /usr/bin "$@" "$1" "$1"
+	"$@" printf awk /usr/bin $(pwd) sed /usr/bin $(pwd) ${HOME} && 'quoted text'
+		&& | printf local sed ${HOME}
+	echo grep "$@" "$@" | grep export 'quoted text'
+		grep local | grep cd -eu ${HOME} --verbose -eu cd "$1" export
+	${HOME} test --verbose then --verbose readonly export awk "$@" x=1 printf |
+	/usr/bin cd done && | --verbose /usr/bin --verbose done awk
+"$1" echo awk local ${HOME}
+readonly test local test echo 'quoted text' echo grep awk printf
+		then --verbose done /usr/bin && export
+		"$1" --verbose && done ${HOME} "$@" 2>/dev/null | /usr/bin
+then cd $(pwd) /usr/bin grep awk "$1" "$1" test echo && readonly /usr/bin
+awk 'quoted text' $(pwd) "$@" then /usr/bin x=1 cd 2>/dev/null readonly awk ${HOME}
+	-eu printf echo readonly && --verbose echo --verbose
+echo ${HOME} 'quoted text' $(pwd)
+"$1" && sed "$1" test echo readonly /usr/bin done ${HOME} $(pwd) /usr/bin
+	"$@" 'quoted text' | $(pwd) "$1" readonly /usr/bin awk readonly
+	"$@" $(pwd) x=1 -eu | 'quoted text' x=1 $(pwd)
+	-eu x=1 --verbose then awk echo awk 'quoted text'
+		--verbose local export grep printf x=1 done -eu 'quoted text'
+	"$1" readonly 2>/dev/null grep --verbose
+	echo echo "$@" x=1 printf local
+	awk sed printf test x=1 then
+/usr/bin echo export -eu export awk
+		"$1" -eu cd 2>/dev/null then
+	${HOME} -eu 2>/dev/null readonly
+x=1 awk cd $(pwd) && /usr/bin cd $(pwd)
+"$@" grep sed readonly local local cd then 2>/dev/null test
+		&& awk "$1" printf $(pwd) done done grep | 2>/dev/null cd | local test then
+		&& test x=1 grep "$1" "$1" -eu
+		printf && --verbose printf local printf export printf done echo test /usr/bin
+	${HOME} ${HOME} export | $(pwd) "$@" awk "$@" test readonly awk $(pwd) -eu
+	"$1" then /usr/bin test echo "$@" readonly "$@" 2>/dev/null echo --verbose
+cd done 'quoted text' 2>/dev/null 2>/dev/null
+	then readonly cd local --verbose "$1" --verbose awk local grep $(pwd)
+	| x=1 ${HOME} test $(pwd) test /usr/bin -eu $(pwd) printf
+		printf x=1 done echo ${HOME} && printf then done sed grep grep --verbose
+	test "$1" | "$@" grep done test
+		awk grep local echo --verbose 'quoted text' readonly echo local 2>/dev/null sed
+	--verbose --verbose "$@" x=1 --verbose echo then done test 'quoted text' readonly
+	echo echo /usr/bin 'quoted text' local -eu 'quoted text' | grep awk echo
+	| $(pwd) sed export "$@" test x=1 export printf "$@"
+	${HOME} grep readonly x=1 | test test -eu && local 'quoted text' grep export
+done printf echo && local done | grep && readonly
+&& 'quoted text' cd "$@" test grep -eu local $(pwd)
+	"$1" x=1 then -eu done awk test awk $(pwd) awk
+	'quoted text' local 'quoted text' local sed | "$1" "$@" awk
+	-eu -eu "$1" 'quoted text' echo x=1 export readonly awk export
+	'quoted text' 'quoted text' cd x=1 echo /usr/bin
+$(pwd) grep done "$1" printf
+export sed $(pwd) | echo x=1 local
+		sed cd echo printf /usr/bin $(pwd)
+	x=1 2>/dev/null 2>/dev/null
+--verbose export cd printf
+	-eu test local && then | $(pwd) ${HOME}
+echo done cd readonly readonly echo x=1 -eu | grep export printf && x=1
+	export /usr/bin done "$@" printf sed echo 2>/dev/null /usr/bin | 2>/dev/null
+	test done local /usr/bin local readonly
+		awk $(pwd) ${HOME} && | --verbose
+	-eu $(pwd) ${HOME} readonly
+	printf test export local then test awk && sed && 2>/dev/null
+	done export echo sed readonly grep 'quoted text' echo "$@" -eu $(pwd) x=1
+	awk x=1 cd 2>/dev/null readonly sed done
+		2>/dev/null /usr/bin local sed -eu x=1 ${HOME}
+"$1" /usr/bin ${HOME} export printf
+	then 2>/dev/null printf
+	${HOME} grep /usr/bin 'quoted text' --verbose then 2>/dev/null ${HOME} then
+	cd --verbose "$@" -eu --verbose export /usr/bin ${HOME} 2>/dev/null
+	printf /usr/bin -eu awk ${HOME} awk readonly awk cd
+&& /usr/bin 'quoted text' cd echo then export local local sed
+$(pwd) "$@" $(pwd) -eu done 'quoted text' cd test "$@" sed "$@" 'quoted text'
+export $(pwd) 'quoted text' printf x=1 "$@" then
+		echo readonly done printf "$1"
+readonly && grep local -eu sed -eu cd | export printf printf echo /usr/bin
+readonly x=1 export done $(pwd) cd done && --verbose
+		"$@" echo | --verbose local 'quoted text'
+		done x=1 $(pwd) && x=1 local $(pwd) grep 2>/dev/null -eu $(pwd) done printf
+		&& printf readonly "$1" $(pwd) echo printf
+		-eu $(pwd) ${HOME} done --verbose 'quoted text' ${HOME} cd && 'quoted text'
+cd sed done -eu -eu | readonly | | done cd -eu -eu test 'quoted text'
+	/usr/bin local && $(pwd)
+		done --verbose 'quoted text' readonly $(pwd) done x=1 --verbose echo --verbose
+		printf awk awk cd x=1 2>/dev/null test &&
+	echo then readonly awk done test printf && --verbose
+	printf done local /usr/bin
+	readonly /usr/bin -eu echo $(pwd) 'quoted text'
+	&& awk sed -eu "$1" test
+	/usr/bin export ${HOME}
+		readonly x=1 x=1 -eu grep printf readonly x=1 | then sed readonly
+awk 2>/dev/null grep --verbose && test "$@" export -eu "$@" 2>/dev/null
+		"$1" | local 'quoted text' | && export awk echo
+		'quoted text' printf cd 'quoted text'
+		-eu sed then then export readonly sed 2>/dev/null readonly --verbose
+grep 'quoted text' cd export
+		done then x=1 local local cd
+	test "$@" test local then | && done printf
+		then "$@" done --verbose 2>/dev/null
+	test export -eu export awk readonly grep done "$1" ${HOME}
+"$1" readonly readonly grep --verbose readonly -eu cd local sed
+		awk $(pwd) sed --verbose
+done printf done done 2>/dev/null awk printf done
+	/usr/bin ${HOME} printf awk $(pwd) printf --verbose done | "$@" /usr/bin
+	then cd done grep $(pwd)
+'quoted text' --verbose test test then 'quoted text' then test /usr/bin
+	sed cd cd sed x=1 "$1" 2>/dev/null x=1 /usr/bin x=1 test awk -eu
+&& /usr/bin && /usr/bin printf export x=1
+	local && sed -eu test local then "$1" echo done $(pwd)
+		&& ${HOME} 2>/dev/null 'quoted text' "$1" echo sed done $(pwd) && "$@" && export
+		| sed then "$@" && printf awk readonly
+	done && 2>/dev/null 'quoted text'
+printf && ${HOME} 'quoted text' $(pwd) echo 2>/dev/null "$1" 'quoted text'
+--verbose sed export printf local 2>/dev/null then readonly printf local
+readonly --verbose --verbose sed 'quoted text' done --verbose
+echo ${HOME} echo sed | cd done then printf && local --verbose
+echo 'quoted text' done x=1 ${HOME} cd && awk local /usr/bin then echo
+/usr/bin readonly "$@" ${HOME}
+local then export 'quoted text' done
+	--verbose readonly then then grep 2>/dev/null | test test local 2>/dev/null
+		2>/dev/null ${HOME} 2>/dev/null -eu /usr/bin test cd
+'quoted text' x=1 printf /usr/bin printf "$1" && x=1 echo export local
+	${HOME} printf -eu export "$1" done x=1 export /usr/bin ${HOME} x=1 "$1" x=1
+	x=1 x=1 export 'quoted text' done done --verbose readonly &&
+awk "$@" awk -eu "$1" "$1" -eu done "$@" x=1 then && /usr/bin
+		local export "$@" echo cd "$@" readonly
+export --verbose echo 'quoted text' test $(pwd) && sed export ${HOME} cd |
+		/usr/bin then then 2>/dev/null test local
+		sed && local 2>/dev/null ${HOME} "$1" "$1" $(pwd) /usr/bin "$@" sed ${HOME} 'quoted text'
+grep && --verbose test local printf | "$1" 2>/dev/null
+		"$@" "$1" 2>/dev/null grep | then /usr/bin && | 'quoted text'
+		"$@" readonly readonly ${HOME} "$@"
+	${HOME} ${HOME} $(pwd) then ${HOME} done 2>/dev/null awk
+		--verbose printf /usr/bin -eu test sed sed --verbose && -eu /usr/bin
+		--verbose test then export sed x=1 $(pwd) $(pwd) echo "$@" echo x=1
+		$(pwd) 'quoted text' awk readonly grep && --verbose "$1"
+		"$@" "$1" printf printf done cd 'quoted text' local "$1" then sed sed /usr/bin
+/usr/bin readonly sed $(pwd) -eu then $(pwd) readonly x=1 2>/dev/null --verbose
+grep 'quoted text' $(pwd) then readonly "$1" "$@" test $(pwd) ${HOME} cd then
+	export test 'quoted text' && x=1 then printf printf --verbose echo
+		export printf "$1" && local "$1"
+	"$1" readonly && /usr/bin && cd "$1" cd readonly
+	${HOME} "$@" printf sed 'quoted text' -eu "$1" printf --verbose
+--verbose then "$@" -eu --verbose sed 2>/dev/null | export export | then /usr/bin
+	/usr/bin cd local /usr/bin test
+'quoted text' 'quoted text' export printf test sed -eu cd local --verbose | 'quoted text'
+	${HOME} test "$@" awk cd $(pwd) $(pwd) cd --verbose export readonly | grep
+export 2>/dev/null grep
+/usr/bin | cd echo printf printf -eu "$1" cd -eu grep local awk --verbose /usr/bin
+		readonly x=1 x=1 x=1 "$1"
+		sed printf | "$@" && grep export ${HOME}
+	-eu "$1" 2>/dev/null cd 2>/dev/null local grep grep "$1" -eu | test $(pwd)
+		cd --verbose readonly 2>/dev/null "$@" test "$@" readonly
+		awk && echo awk x=1 export echo "$1" 'quoted text' -eu
+2>/dev/null $(pwd) ${HOME}
+sed grep 'quoted text' sed awk 'quoted text'
+		done | --verbose grep then
+&& printf readonly export test ${HOME} && local "$1" export
+cd echo x=1 'quoted text' "$1"
+	"$@" test then cd --verbose sed "$@" --verbose x=1 | "$@" && x=1 -eu then
+		&& test local x=1 /usr/bin
+		2>/dev/null then echo readonly
+		awk $(pwd) cd x=1 readonly /usr/bin -eu 'quoted text' echo "$1"
+awk local $(pwd) readonly ${HOME} awk local echo local awk
+	cd "$@" sed && $(pwd) grep awk done "$@" && grep $(pwd)
+-eu echo test $(pwd) "$1" "$1" /usr/bin export sed awk --verbose grep printf
+"$@" cd | grep then then "$1" test awk export && x=1
+-eu --verbose x=1 test awk sed $(pwd) grep done
+	local test printf export sed printf "$1" --verbose local "$1" --verbose
+		2>/dev/null /usr/bin ${HOME} "$1"
+		'quoted text' --verbose && ${HOME} export local
+		grep 'quoted text' cd -eu ${HOME} 'quoted text' -eu echo 2>/dev/null
+		awk --verbose "$@" 'quoted text' local ${HOME} 2>/dev/null && x=1 local -eu "$@"
+	sed "$1" export && --verbose export
+	'quoted text' done x=1 readonly /usr/bin grep printf done
+	printf printf --verbose sed export $(pwd) local
+x=1 && "$@" /usr/bin sed ${HOME} | x=1 ${HOME}
+		done "$1" done 'quoted text' sed 'quoted text'
+x=1 then awk 2>/dev/null | ${HOME}
+		x=1 'quoted text' /usr/bin
+	awk x=1 x=1 "$@" awk x=1 x=1 --verbose
+	/usr/bin x=1 then test /usr/bin printf grep "$1" grep grep then
+		awk export --verbose && awk 2>/dev/null awk --verbose cd grep local
+		&& grep && | grep /usr/bin cd $(pwd) x=1 |
+		'quoted text' then then grep readonly readonly export 2>/dev/null
+		$(pwd) "$@" awk awk "$1" printf ${HOME} --verbose 2>/dev/null awk
+	&& "$@" export done "$@" readonly
+	cd x=1 && "$@" -eu cd then "$@" grep ${HOME}
+		test x=1 cd $(pwd) cd sed test && export /usr/bin local
+"$@" 2>/dev/null then $(pwd) /usr/bin export sed awk export /usr/bin
+$(pwd) sed 'quoted text' printf then
+	echo "$1" sed 'quoted text' cd echo sed printf readonly test printf x=1
+		local done -eu /usr/bin x=1
+cd && -eu echo test grep local
+	${HOME} cd 2>/dev/null export -eu -eu | x=1 local $(pwd) 2>/dev/null
+	${HOME} export cd sed sed x=1 awk 'quoted text' -eu
+		awk | grep /usr/bin cd --verbose 'quoted text' &&
+		readonly "$1" awk test export then readonly $(pwd) && ${HOME}
+		2>/dev/null readonly /usr/bin |
+test then test /usr/bin then then printf
+	-eu 'quoted text' echo $(pwd) 'quoted text' printf
+	--verbose /usr/bin local grep awk "$1" echo --verbose ${HOME} && grep ${HOME} awk
+| "$1" "$1" printf sed cd $(pwd) printf /usr/bin then grep | $(pwd)
+sed x=1 printf local "$@" export | x=1 | -eu done
+&& cd "$@" then "$@" printf
+x=1 echo local --verbose x=1 --verbose export 2>/dev/null test export x=1 --verbose
+		"$@" "$1" readonly "$@"
+		-eu /usr/bin cd readonly awk x=1 x=1 -eu --verbose 2>/dev/null printf
+'quoted text' then && readonly test $(pwd) echo --verbose
+	echo local "$1" cd /usr/bin readonly
+	| printf $(pwd) /usr/bin
+x=1 echo "$1" -eu then "$1" && cd && grep /usr/bin -eu
+	local /usr/bin readonly sed --verbose cd $(pwd) test awk "$@" grep "$@"
+/usr/bin x=1 awk grep readonly -eu printf
+x=1 test cd "$1" done then awk 'quoted text' -eu then && local then ${HOME}
+	test echo "$1" /usr/bin /usr/bin done local then /usr/bin grep $(pwd)
+x=1 awk cd echo then 'quoted text' local grep
+		x=1 "$@" ${HOME} cd $(pwd)
+test 2>/dev/null sed -eu readonly done /usr/bin done export sed local -eu readonly
+		awk sed "$@" /usr/bin 2>/dev/null 2>/dev/null grep grep --verbose
+/usr/bin readonly "$1" cd done "$@" /usr/bin $(pwd)
+test test ${HOME} 2>/dev/null test awk local readonly local export
+		/usr/bin echo export -eu
+sed ${HOME} x=1 && done sed grep -eu && test echo echo 2>/dev/null
+test $(pwd) echo grep
+		"$1" test /usr/bin readonly test --verbose "$@" sed readonly local && readonly
+x=1 export -eu grep --verbose export grep -eu --verbose
+$(pwd) export local printf sed 2>/dev/null --verbose echo 'quoted text'
+		| /usr/bin "$1" /usr/bin --verbose printf done 2>/dev/null cd && x=1
+2>/dev/null 'quoted text' local
+		'quoted text' then then done readonly
+		echo "$1" "$@" cd test sed test | x=1 --verbose then x=1 $(pwd) "$@"
+	grep ${HOME} 'quoted text' "$@" "$1" cd grep done
+	"$1" /usr/bin readonly "$1" echo local grep && && then
+	readonly echo local "$1" export
+	-eu grep | "$1" sed local done
+		echo 'quoted text' grep 'quoted text' | -eu | then local ${HOME} -eu "$@" ${HOME}
+	test then "$@" grep x=1 'quoted text'
+awk --verbose grep printf | echo && local cd done x=1 echo /usr/bin
+	done | --verbose export
+		awk awk sed /usr/bin echo 'quoted text' sed awk x=1 printf then -eu test ${HOME}
+		"$1" grep then echo then export $(pwd) export 'quoted text' ${HOME} && 'quoted text'
+		2>/dev/null "$1" 2>/dev/null done grep && sed echo echo "$1" x=1 cd grep
+	grep $(pwd) 'quoted text' test x=1 ${HOME} readonly
+		echo sed x=1 awk sed 'quoted text' then test
+&& $(pwd) done --verbose test ${HOME} --verbose printf done awk $(pwd)
+test then local cd "$@" then readonly ${HOME} "$@" grep printf
+		2>/dev/null -eu cd $(pwd) x=1
+	'quoted text' /usr/bin ${HOME} x=1 echo awk "$@"
+then test ${HOME} && export --verbose --verbose done -eu x=1
+		| readonly awk then 'quoted text'
+		| local test x=1 "$@" && cd ${HOME} echo local test local "$1" && --verbose
+		$(pwd) done -eu test 2>/dev/null --verbose sed x=1 test 'quoted text' export
+x=1 sed local done 'quoted text' readonly export cd printf
+then 2>/dev/null /usr/bin /usr/bin --verbose x=1 --verbose /usr/bin &&
+	'quoted text' | awk test && ${HOME} 2>/dev/null echo sed
+done awk then done 2>/dev/null "$1" 'quoted text' sed "$1" then | printf test
+	cd export then then cd grep
+	'quoted text' 'quoted text' -eu printf -eu "$@" 'quoted text' local readonly local
+	cd | && | export ${HOME} export x=1 "$@" "$@"
+		then ${HOME} echo 2>/dev/null test
+		/usr/bin --verbose 2>/dev/null done local --verbose sed export grep --verbose
+		test printf then ${HOME} cd then done
+		"$1" done echo $(pwd) test 'quoted text' echo 2>/dev/null
+		awk | $(pwd) ${HOME} /usr/bin grep --verbose
+		cd $(pwd) sed && "$1" 'quoted text'
+&& done --verbose export $(pwd) export readonly readonly | export /usr/bin
+${HOME} awk export "$@" --verbose 2>/dev/null | sed && $(pwd)
+		awk awk export export /usr/bin grep ${HOME}
+	local /usr/bin cd x=1 2>/dev/null export "$@" export && printf x=1 2>/dev/null
+	export 'quoted text' sed 2>/dev/null "$@" x=1 sed then sed x=1
+'quoted text' | export printf $(pwd) $(pwd) test && /usr/bin then $(pwd) &&
+	printf test readonly | "$@" cd x=1 cd | export --verbose
+		then | then readonly local 2>/dev/null sed && grep && -eu "$@" 'quoted text'
+	echo && test /usr/bin echo export && --verbose test
+	done 2>/dev/null export
+		echo "$@" 2>/dev/null done | test export ${HOME} readonly "$1" 'quoted text'
+		readonly "$1" 2>/dev/null printf local 2>/dev/null
+	$(pwd) cd "$@" "$@" ${HOME} --verbose --verbose "$@" test --verbose
+		test && | "$1" "$@" local local sed -eu "$1" --verbose
+		printf export -eu readonly printf printf echo $(pwd) /usr/bin "$1" 2>/dev/null
+	printf -eu readonly 2>/dev/null
+	--verbose /usr/bin x=1 && ${HOME} && -eu ${HOME} export 'quoted text' 2>/dev/null
+	${HOME} "$1" test | $(pwd) x=1 test grep test --verbose
+printf grep $(pwd) x=1 -eu "$@" ${HOME}
+		${HOME} test then "$@" "$@" x=1 then printf
+		export test ${HOME} done && ${HOME} -eu printf
+-eu sed 2>/dev/null 'quoted text'
+		"$1" 'quoted text' x=1 printf -eu -eu --verbose 'quoted text'
+x=1 /usr/bin 'quoted text' /usr/bin $(pwd)
+		awk sed x=1 && $(pwd) $(pwd) then "$@"
+	printf 2>/dev/null ${HOME} test $(pwd) --verbose
+'quoted text' -eu sed $(pwd) | /usr/bin --verbose
+		/usr/bin ${HOME} cd && done | --verbose
+sed then printf readonly && 'quoted text' grep --verbose /usr/bin "$@"
+		$(pwd) cd done | $(pwd) "$@" export test "$1" printf test && sed 'quoted text'
+	| echo && -eu --verbose export 2>/dev/null && printf && --verbose "$@" echo
+	export cd echo && sed $(pwd) "$@" --verbose local x=1 2>/dev/null
+	grep grep "$@" echo test test cd test $(pwd) ${HOME} sed 'quoted text'
+		x=1 && /usr/bin 'quoted text' test cd 'quoted text' 2>/dev/null
+	done | export && grep export local echo export && --verbose readonly
+test ${HOME} test readonly --verbose then
+| ${HOME} /usr/bin readonly "$1" grep --verbose
+	echo awk cd cd /usr/bin | done ${HOME} && local | x=1 x=1
+"$1" grep 'quoted text' ${HOME} && | cd test sed x=1 done 'quoted text'
+	sed sed local test --verbose --verbose ${HOME} -eu awk | printf
+		'quoted text' awk readonly done --verbose && sed /usr/bin | sed printf ${HOME}
+		2>/dev/null test 2>/dev/null "$@" local done grep grep "$@" "$1"
+		readonly test 'quoted text' 'quoted text' && cd 'quoted text' printf /usr/bin
+| | ${HOME} export | $(pwd) 'quoted text' then $(pwd) && awk sed test | -eu export
+	local printf "$@" awk $(pwd) ${HOME}
+		sed then local --verbose printf
+-eu echo test done 2>/dev/null awk | ${HOME} $(pwd) local $(pwd) $(pwd)
+	&& && -eu "$@" $(pwd) "$1" then awk "$1"
+	awk --verbose sed readonly "$1" echo
+	&& printf 2>/dev/null readonly done x=1 'quoted text' local then grep test
+2>/dev/null /usr/bin cd | /usr/bin ${HOME} 2>/dev/null done grep awk
+	test then && | "$1" awk "$1" awk
+		"$@" done grep -eu grep local "$@" export "$@" sed export readonly $(pwd) "$1"
+	${HOME} && then -eu printf 'quoted text' 'quoted text' ${HOME} 'quoted text'
+	/usr/bin printf /usr/bin done echo
+export test x=1 awk readonly done -eu awk ${HOME} test test local
+	/usr/bin local test 'quoted text' ${HOME} readonly readonly -eu sed
+	2>/dev/null -eu $(pwd) local local export
+	"$@" then /usr/bin sed ${HOME}
+		then cd echo /usr/bin -eu cd grep grep
+		sed ${HOME} 2>/dev/null
+	"$@" /usr/bin readonly printf grep awk then export then x=1 test && awk grep
+'quoted text' "$1" -eu x=1 && echo
+		"$@" test test test | 'quoted text' &&
+	test && | ${HOME} printf -eu
+		"$@" echo sed echo /usr/bin export && $(pwd) "$@" grep /usr/bin
+		-eu cd echo && "$@" printf local export awk done local done 2>/dev/null
+	&& "$@" readonly && x=1 then /usr/bin
+2>/dev/null echo 2>/dev/null ${HOME} test /usr/bin cd $(pwd)
+		2>/dev/null echo -eu | export | export
+	cd && 2>/dev/null echo 'quoted text' "$1" ${HOME} && awk then
+	"$1" && awk "$@" x=1 $(pwd) sed
+	x=1 printf grep "$1" "$1" "$@" echo 'quoted text' test sed local sed
+-eu $(pwd) /usr/bin then
+		${HOME} 'quoted text' 'quoted text' --verbose done x=1 'quoted text'
+	${HOME} --verbose 'quoted text' sed cd test grep printf 'quoted text' -eu printf
+	awk cd cd /usr/bin --verbose test cd readonly
+cd "$@" --verbose 'quoted text' echo test | then -eu
+&& printf | 2>/dev/null echo --verbose
+	local "$@" --verbose awk 2>/dev/null && $(pwd) 'quoted text' sed done then 2>/dev/null
+echo echo $(pwd) cd grep 2>/dev/null ${HOME} "$@" echo local --verbose
+export 2>/dev/null test 2>/dev/null done
+grep awk --verbose $(pwd) -eu then x=1
+-eu export x=1 printf awk test && $(pwd) | -eu awk /usr/bin
+export echo 'quoted text' done x=1 grep ${HOME} | /usr/bin -eu then "$@"
+&& readonly /usr/bin echo done
+sed grep then then ${HOME} local ${HOME} --verbose done /usr/bin export sed
+		then done readonly readonly done test /usr/bin sed 2>/dev/null grep
+		export sed --verbose grep 'quoted text'
+x=1 cd grep test 2>/dev/null ${HOME} x=1 grep
+		| sed cd && sed 'quoted text' sed cd | awk local
+	"$@" local /usr/bin test cd test cd -eu --verbose local done done
+	done --verbose done awk ${HOME} /usr/bin local
+	--verbose printf && printf -eu 'quoted text'
+	"$1" echo 'quoted text' $(pwd) then printf 2>/dev/null ${HOME} printf --verbose
+$(pwd) local -eu "$@" printf $(pwd)
+&& echo x=1 && --verbose then --verbose && &&
+	then -eu test "$@" awk | x=1 then then sed /usr/bin /usr/bin
+	done 2>/dev/null done /usr/bin
+		then grep 'quoted text' ${HOME}
+		x=1 -eu "$@" readonly 'quoted text' grep
+	2>/dev/null $(pwd) "$1" ${HOME} local done grep sed test test
+	grep echo then cd export --verbose
+	readonly $(pwd) grep $(pwd) | "$1" echo $(pwd) x=1 'quoted text' sed | /usr/bin
+		then $(pwd) cd local 'quoted text' export | ${HOME} ${HOME} --verbose
+test | $(pwd) echo export && 'quoted text' echo then /usr/bin awk
+echo x=1 awk awk grep printf then awk grep /usr/bin
+		-eu local sed echo cd && 2>/dev/null && grep 2>/dev/null echo 'quoted text'
+		${HOME} ${HOME} done -eu sed test cd then grep echo $(pwd)
+		grep ${HOME} cd 2>/dev/null test x=1 then
+--verbose $(pwd) readonly awk 'quoted text'
+		awk 2>/dev/null awk test local grep -eu /usr/bin test awk echo --verbose
+	"$@" $(pwd) && awk grep ${HOME} x=1 x=1 export
+	$(pwd) test ${HOME} 'quoted text' "$@" then then cd ${HOME} export printf &&
+	then ${HOME} test x=1 export then done "$1" -eu "$1" | "$@" readonly test &&
+		| -eu ${HOME} done done test echo export echo x=1 local -eu
+		x=1 2>/dev/null ${HOME} /usr/bin --verbose then done
+	/usr/bin then cd 'quoted text'
+${HOME} grep cd | "$@" --verbose
+		awk then ${HOME} 'quoted text'
+/usr/bin cd "$1" grep cd -eu local echo local
+-eu local cd local $(pwd) export /usr/bin --verbose cd "$1"
+test ${HOME} local && /usr/bin awk done x=1 done | grep -eu sed local
+	sed x=1 | 2>/dev/null 2>/dev/null grep sed $(pwd) --verbose x=1 grep
+	local grep x=1 ${HOME} ${HOME} "$1" test ${HOME} echo printf
+local printf && awk 'quoted text'
+	| readonly readonly | awk && -eu -eu && ${HOME} awk | grep grep local then
+${HOME} done cd -eu "$@" echo
+	awk test then printf 2>/dev/null readonly printf grep done --verbose /usr/bin
+	readonly | cd export done 'quoted text'
+	sed printf then -eu cd --verbose /usr/bin x=1 'quoted text'
+readonly then -eu printf done "$@" x=1 $(pwd) printf "$@" ${HOME} grep
+		test ${HOME} test $(pwd) echo cd done
+	"$@" "$@" 'quoted text' local /usr/bin local awk /usr/bin -eu $(pwd)
+| -eu && x=1 export then grep awk ${HOME}
+	--verbose echo grep local then -eu "$1" | sed test 'quoted text'
+	2>/dev/null $(pwd) export readonly awk x=1 export export
+	x=1 test export local test
+	x=1 then echo printf done -eu grep "$1" && then done x=1 readonly &&
+		x=1 cd then ${HOME} done --verbose
+		printf "$1" "$@" 'quoted text' "$1" local
+		--verbose awk cd --verbose
+	-eu local sed ${HOME} readonly "$1" $(pwd) done $(pwd) readonly && printf readonly
+		grep ${HOME} awk awk && then x=1 'quoted text'
+-eu test cd "$@" && /usr/bin
+	/usr/bin sed export -eu -eu "$@" echo
+	| local /usr/bin $(pwd)
+	export then /usr/bin awk
+		x=1 sed test awk "$@" echo "$1" sed "$1" ${HOME} then
+	sed --verbose ${HOME} | printf
@@ -0,0 +1,2001 @@
+2>/dev/null /usr/bin sed readonly 'quoted text' export
+echo local --verbose /usr/bin printf then
+&& 'quoted text' | -eu && cd then awk "$1" && test local 'quoted text'
+		'quoted text' | --verbose export /usr/bin echo sed sed 'quoted text' 'quoted text'
+		/usr/bin readonly && "$1" 'quoted text' grep | "$1" --verbose ${HOME}
+| done export x=1 | "$1" echo x=1 2>/dev/null
+2>/dev/null /usr/bin grep readonly grep then
+export then -eu /usr/bin $(pwd) x=1 then "$1" done done cd export done
+--verbose export readonly | "$@" awk export "$1"
+/usr/bin sed echo local "$@"
+		-eu sed local x=1 && then readonly local test
+		local && ${HOME} /usr/bin && echo readonly sed then echo
+	test $(pwd) sed cd echo -eu grep "$@" sed "$1" awk export printf local
+-eu local /usr/bin /usr/bin x=1 test grep export readonly echo
+x=1 --verbose && grep awk
+&& | /usr/bin "$@" sed -eu readonly 2>/dev/null -eu 2>/dev/null | awk "$1" local
+x=1 printf then x=1 grep grep $(pwd) local readonly "$@" test
+	readonly /usr/bin printf "$1" test printf
+echo then "$1" "$1" /usr/bin 2>/dev/null
+	readonly 'quoted text' "$1" | local test ${HOME} $(pwd)
+		--verbose "$@" readonly readonly test printf && -eu
+		echo 2>/dev/null then cd test 'quoted text'
+x=1 readonly 'quoted text' done export "$1"
+		&& done then 2>/dev/null grep x=1 /usr/bin sed
+	-eu "$@" | && | grep "$1" $(pwd) then echo -eu export -eu --verbose
+local grep sed $(pwd) grep awk export "$1" -eu "$1"
+awk -eu ${HOME} $(pwd) then done --verbose awk grep sed awk ${HOME}
+	done export $(pwd) $(pwd) done
+		${HOME} | | ${HOME} "$1" /usr/bin
+		'quoted text' ${HOME} export
+--verbose 'quoted text' export
+		done local grep | -eu printf ${HOME} 2>/dev/null 'quoted text' test
+then && /usr/bin /usr/bin 'quoted text' cd -eu then then
+	'quoted text' then done | grep readonly readonly export
+	'quoted text' echo -eu local printf ${HOME} export ${HOME} test done | done printf
+		'quoted text' echo then && ${HOME} 'quoted text'
+	grep local export echo "$1" | x=1 --verbose printf -eu x=1 awk "$@" /usr/bin
+done x=1 "$@" && /usr/bin && then printf readonly ${HOME} "$1" local "$1"
+	--verbose && | cd x=1 "$1" done export
+	"$@" test -eu export readonly readonly done grep
+	test && $(pwd) cd -eu 'quoted text' /usr/bin /usr/bin cd | export "$1" local
+"$1" test echo awk | /usr/bin export export test local readonly x=1
+		"$@" sed "$1" then --verbose
+${HOME} --verbose -eu sed --verbose "$@" test "$1"
+		"$1" "$1" 2>/dev/null done x=1 | x=1 cd export x=1 local 2>/dev/null 2>/dev/null
+	done && test "$1" | "$@" "$1" sed sed readonly 'quoted text'
+| local awk 2>/dev/null then
+	${HOME} readonly 'quoted text' sed ${HOME} readonly /usr/bin
+		printf | x=1 done /usr/bin && "$1" "$1"
+	-eu 2>/dev/null "$1" readonly --verbose $(pwd) 2>/dev/null
+export | -eu --verbose 2>/dev/null
+done -eu 'quoted text' printf 2>/dev/null x=1 $(pwd) ${HOME} printf local 2>/dev/null
+		done cd local | cd | -eu -eu -eu ${HOME} export $(pwd) local
+	| cd 'quoted text' sed printf 2>/dev/null
+	'quoted text' ${HOME} test | $(pwd) &&
+	echo "$1" done local --verbose grep then | /usr/bin local grep &&
+	awk export awk printf "$@" local then ${HOME} | --verbose "$1" 'quoted text'
+		x=1 then && grep "$1" local x=1 --verbose
+cd $(pwd) grep test && printf export
+	echo -eu /usr/bin "$1" printf --verbose
+	--verbose x=1 awk echo
+		"$1" x=1 local && awk && x=1 local /usr/bin 2>/dev/null local printf export 2>/dev/null
+done 'quoted text' "$@" test awk test printf cd $(pwd)
+	'quoted text' done ${HOME} "$@"
+		/usr/bin "$1" "$1" test sed done $(pwd)
+awk 2>/dev/null awk done -eu && done then ${HOME}
+	| cd 2>/dev/null 2>/dev/null
+		cd readonly echo && sed export "$1"
+		2>/dev/null awk | test grep 'quoted text' |
+		printf printf sed local "$@" cd
+	printf awk done "$@" --verbose -eu readonly local
+		| grep export "$@" export $(pwd) "$1" "$1" "$@" cd --verbose | echo --verbose
+export "$@" "$@" x=1 echo local "$@" export grep
+&& "$@" awk "$1" readonly /usr/bin awk
+	&& readonly 2>/dev/null readonly echo cd && | 2>/dev/null local
+		"$@" test test local $(pwd) export
+		done 2>/dev/null $(pwd) test --verbose cd "$@" printf
+		echo "$@" awk test /usr/bin test printf | -eu
+	/usr/bin --verbose 'quoted text' test sed done sed 'quoted text'
+		--verbose grep echo echo && export cd done --verbose "$1" --verbose
+	test 2>/dev/null done "$1" export export grep x=1 -eu "$1" test /usr/bin
+	grep done cd ${HOME} "$@"
+	${HOME} readonly --verbose sed | 'quoted text' ${HOME}
+printf "$@" grep ${HOME} sed grep /usr/bin test 'quoted text' && export
+		local echo grep 2>/dev/null $(pwd) 2>/dev/null 'quoted text'
+		${HOME} 2>/dev/null grep "$@" | readonly done "$@" awk done
+	then 'quoted text' "$@" grep awk |
+		test /usr/bin sed readonly &&
+	"$@" x=1 sed "$@" grep ${HOME} sed "$1" done
+		then "$1" echo printf "$1"
+local /usr/bin --verbose local
+		echo echo cd | export cd -eu 2>/dev/null "$1" grep "$@" sed 2>/dev/null
+	&& local 2>/dev/null 'quoted text' then
+-eu grep --verbose --verbose sed -eu export "$1" 2>/dev/null test export grep
+		readonly awk 'quoted text' local "$@" "$1" && echo
+"$@" /usr/bin echo readonly export printf -eu export
+	sed --verbose echo 2>/dev/null $(pwd) && 'quoted text' cd printf "$@" $(pwd) -eu
+	readonly printf x=1 awk readonly cd "$@" | "$@"
+	--verbose test 2>/dev/null &&
+/usr/bin && export cd x=1 "$@" -eu test && "$1" sed local
+then && sed echo "$1" cd x=1 /usr/bin
+test /usr/bin /usr/bin export --verbose && "$@" "$1" x=1 echo 'quoted text'
+	awk "$1" export sed echo sed done /usr/bin grep 'quoted text'
+		$(pwd) test | test $(pwd) $(pwd) $(pwd) 2>/dev/null | ${HOME} export
+export 2>/dev/null sed /usr/bin && /usr/bin sed
+| x=1 /usr/bin echo -eu 2>/dev/null local local export readonly readonly sed
+--verbose --verbose test -eu x=1 $(pwd) | readonly ${HOME} -eu local cd x=1
+		$(pwd) 2>/dev/null export cd cd test printf printf
+		test | grep local sed x=1 "$@" --verbose 'quoted text' && $(pwd)
+	"$@" --verbose ${HOME} -eu readonly /usr/bin $(pwd) local
+		awk x=1 'quoted text' local ${HOME} && x=1 ${HOME} | 2>/dev/null printf -eu x=1
+	done x=1 readonly grep $(pwd) echo "$1" x=1 2>/dev/null ${HOME}
+	test then /usr/bin ${HOME} readonly |
+	sed cd ${HOME} $(pwd) grep
+	awk local then && "$@" test then
+		cd "$@" export grep $(pwd) -eu --verbose ${HOME} && | /usr/bin ${HOME}
+		sed | | sed 2>/dev/null "$@" done local sed ${HOME} local echo test
+		export | | export then sed then "$@" && | local awk -eu grep test
+readonly | /usr/bin -eu "$@" "$@"
+&& 2>/dev/null | 'quoted text' --verbose $(pwd) readonly
+		readonly "$1" readonly
+		-eu grep -eu export 2>/dev/null --verbose test grep x=1 then
+		'quoted text' $(pwd) readonly --verbose $(pwd) test
+		"$1" readonly export local /usr/bin printf cd $(pwd) $(pwd) | cd $(pwd)
+	echo export "$@" awk x=1 2>/dev/null 'quoted text'
+		grep sed then readonly done x=1 "$@" x=1 export local echo ${HOME} grep
+-eu printf 2>/dev/null sed printf
+		echo done then readonly awk
+	| sed done 'quoted text' | done | export test done sed cd | awk ${HOME} local
+awk ${HOME} awk $(pwd) &&
+/usr/bin "$1" x=1 && x=1 --verbose 'quoted text' done x=1 2>/dev/null export
+		| ${HOME} cd $(pwd) "$1" sed
+	printf -eu 'quoted text' cd local
+		'quoted text' awk $(pwd) --verbose --verbose --verbose
+	test local sed local printf echo | "$1" local -eu && -eu local readonly cd
+	2>/dev/null "$@" 'quoted text' echo
+		export done sed "$@" cd 2>/dev/null cd sed -eu 'quoted text'
+	2>/dev/null 2>/dev/null cd 2>/dev/null 2>/dev/null
+	--verbose readonly ${HOME} | printf /usr/bin 'quoted text'
+'quoted text' /usr/bin done done readonly cd done x=1 export x=1 --verbose --verbose
+	$(pwd) | readonly awk 2>/dev/null -eu then $(pwd) sed export
+'quoted text' | export then 'quoted text' --verbose ${HOME} ${HOME} 'quoted text'
+printf printf grep x=1 $(pwd) done done export then
+	local cd "$@" done -eu 2>/dev/null /usr/bin
+		/usr/bin local -eu 2>/dev/null
+${HOME} echo awk ${HOME}
+		2>/dev/null && cd local local 'quoted text' -eu ${HOME} --verbose
+		| ${HOME} printf sed /usr/bin $(pwd)
+	/usr/bin echo x=1 -eu
+readonly && cd && cd cd "$1" 2>/dev/null echo
+		| $(pwd) "$1" local local x=1 grep printf grep local done local
+	-eu grep -eu export awk test readonly sed export
+		export 'quoted text' 2>/dev/null $(pwd) awk --verbose
+	${HOME} | awk && ${HOME} /usr/bin && then $(pwd) export
+	x=1 "$1" 'quoted text' awk && cd cd grep test
+awk awk readonly grep printf done x=1 sed export test echo export 2>/dev/null
+		${HOME} sed ${HOME} then awk printf "$@"
+		sed cd printf printf test cd grep readonly && test then awk
+		&& x=1 && && cd /usr/bin x=1 'quoted text' local
+readonly cd awk sed then x=1 grep readonly cd
+	echo cd && 2>/dev/null "$@"
+		export then x=1 "$1" x=1 "$@" export "$1" sed grep then $(pwd)
+	${HOME} 2>/dev/null 'quoted text'
+		printf | awk --verbose grep 'quoted text' "$@" -eu grep cd -eu done grep
+		done echo export printf 'quoted text'
+		readonly ${HOME} $(pwd) readonly | && $(pwd) "$1" local
+		"$@" 'quoted text' | local 'quoted text' |
+	--verbose "$1" "$@" awk grep grep echo awk readonly local "$1"
+	&& ${HOME} ${HOME} && done
+	--verbose --verbose ${HOME} sed | echo echo local grep -eu
+		'quoted text' && sed -eu test local && cd grep "$1" cd then --verbose --verbose
+	&& 'quoted text' export ${HOME} /usr/bin "$@" awk $(pwd) "$1"
+	cd 'quoted text' ${HOME} -eu "$@" sed awk done "$@" $(pwd) ${HOME} done 'quoted text'
+awk && cd readonly --verbose --verbose test test "$1"
+		"$@" then printf 'quoted text'
+		"$1" "$1" readonly readonly awk export readonly
+done echo test readonly readonly -eu echo echo 2>/dev/null printf | then | sed
+	/usr/bin ${HOME} printf ${HOME} -eu echo cd echo 'quoted text' readonly awk
+export /usr/bin test local | /usr/bin
+	local 'quoted text' -eu grep printf done ${HOME}
+	test done readonly && "$@" test /usr/bin then "$1" cd cd 'quoted text' grep
+	-eu echo awk | /usr/bin && sed | -eu -eu printf 'quoted text' then ${HOME} cd |
+		export readonly readonly 'quoted text' | awk grep readonly && cd export $(pwd) -eu
+		'quoted text' "$@" && | --verbose done | test ${HOME} "$@" 'quoted text'
+done /usr/bin ${HOME} x=1
+	readonly sed "$1" then $(pwd) readonly done done
+		"$1" cd -eu "$1" echo then test && && |
+	then grep --verbose test printf readonly
+	printf && awk | done /usr/bin done "$@" done done -eu test done readonly
+"$@" readonly && readonly readonly echo sed export
+		cd | printf then | awk /usr/bin sed cd ${HOME} sed 'quoted text'
+		then ${HOME} readonly "$1" $(pwd) 'quoted text' "$1" test
+		&& x=1 grep && 'quoted text' $(pwd) && done done -eu then test --verbose
+		grep -eu 2>/dev/null grep 2>/dev/null test -eu
+cd ${HOME} sed sed sed test sed -eu && then x=1 /usr/bin
+local /usr/bin "$@" "$1" local printf
+echo "$1" -eu local grep && sed /usr/bin local -eu 'quoted text'
+		| cd echo "$1" | $(pwd) grep test /usr/bin cd cd done
+	done /usr/bin 2>/dev/null "$@" /usr/bin | 'quoted text'
+/usr/bin --verbose 2>/dev/null grep export 'quoted text' 2>/dev/null
+readonly --verbose then local x=1 $(pwd) x=1
+2>/dev/null "$1" done grep
+readonly printf cd /usr/bin $(pwd) $(pwd) awk ${HOME} && /usr/bin test grep
+		readonly readonly "$1" sed awk && /usr/bin awk --verbose
+		"$@" --verbose /usr/bin --verbose
+cd printf 'quoted text' sed && 'quoted text'
+	&& 'quoted text' 2>/dev/null then echo awk -eu printf done test 'quoted text'
+awk && 'quoted text' printf | cd |
+	$(pwd) sed printf awk export grep
+		then readonly 'quoted text' 'quoted text'
+		then "$1" | local sed export awk echo 'quoted text' "$@" export echo awk readonly
+	${HOME} done $(pwd) readonly "$@" cd $(pwd) echo 2>/dev/null
+	done 2>/dev/null cd | -eu cd "$1" | "$1" $(pwd) echo done local x=1 $(pwd) grep
+		"$@" x=1 && ${HOME} readonly /usr/bin awk 2>/dev/null export printf -eu
+		-eu sed test "$@" done export sed then echo sed
+		-eu "$1" printf test readonly test && echo
+	| local $(pwd) cd grep && --verbose awk --verbose
+'quoted text' echo grep
+		--verbose sed -eu then 'quoted text' "$@" done readonly grep sed 2>/dev/null
+		awk grep test printf awk readonly $(pwd) readonly readonly awk sed
+		"$@" grep local -eu --verbose export done local echo "$@" && 2>/dev/null
+--verbose 2>/dev/null test printf
+	export done awk 'quoted text' ${HOME} then x=1 local "$1" export "$@"
+	awk && echo sed "$1" then | $(pwd) && readonly x=1
+	"$1" local export sed local -eu printf /usr/bin
+	echo ${HOME} -eu -eu "$@" readonly test test
+	$(pwd) | "$@" cd grep echo
+	printf printf export done "$@"
+-eu cd readonly -eu done awk $(pwd) "$1" done
+	| && export done test $(pwd) test export local sed test
+/usr/bin echo 2>/dev/null -eu ${HOME} "$1" awk 2>/dev/null
+	-eu then | /usr/bin "$@" then ${HOME} "$@" echo && -eu "$1" grep local
+		cd done test ${HOME} echo echo 2>/dev/null then 2>/dev/null echo 'quoted text'
+	then sed echo grep | test "$1" "$1" ${HOME} readonly echo
+		export then export test -eu cd ${HOME} | export ${HOME}
+	then echo -eu awk readonly printf && ${HOME} --verbose 'quoted text'
+		-eu sed export done readonly sed cd printf test --verbose then
+		| "$@" -eu "$1" readonly x=1 awk -eu test sed | printf --verbose && | 'quoted text'
+x=1 done x=1 done | "$1" --verbose
+		--verbose && cd echo done x=1 export -eu done
+	$(pwd) | then local "$@" echo 'quoted text' "$@"
+	| "$@" --verbose done 'quoted text' ${HOME} sed export grep 'quoted text' grep |
+		'quoted text' ${HOME} && then
+local awk $(pwd) && --verbose grep done readonly && cd 'quoted text'
+local 2>/dev/null then $(pwd) /usr/bin
+	"$@" 2>/dev/null 2>/dev/null echo local
+| -eu -eu cd awk sed local printf done cd "$@"
+	${HOME} export 2>/dev/null
+${HOME} 2>/dev/null 2>/dev/null | cd | ${HOME} | then 2>/dev/null
+awk cd -eu cd "$@" export
+"$@" x=1 grep printf --verbose cd $(pwd) cd done awk export $(pwd)
+		awk export $(pwd) export export ${HOME}
+		readonly 'quoted text' printf then local 'quoted text' "$1" "$1" x=1 printf 2>/dev/null
+	grep then echo 2>/dev/null sed ${HOME} && 2>/dev/null /usr/bin readonly export
+grep | "$1" && 'quoted text' export sed x=1 echo | 2>/dev/null ${HOME} "$@"
+"$1" x=1 export --verbose cd
+awk ${HOME} 'quoted text' readonly grep readonly | -eu x=1 'quoted text'
+done sed "$@" readonly /usr/bin /usr/bin ${HOME} "$1" cd local /usr/bin
+	${HOME} | export local "$1" 2>/dev/null 2>/dev/null
+		grep $(pwd) "$@" done export printf /usr/bin then /usr/bin readonly grep then awk
+		local && -eu echo $(pwd) grep then grep local readonly printf readonly
+	cd --verbose /usr/bin x=1 printf grep then local test
+"$@" --verbose then sed $(pwd) | test local printf
+'quoted text' $(pwd) done | grep "$1" printf x=1
+		${HOME} -eu $(pwd) && export awk "$1" echo local
+		printf grep $(pwd) done local
+	sed sed awk x=1 sed | grep export
+		| echo -eu then sed export /usr/bin export then "$1" readonly
+	--verbose done x=1 echo -eu --verbose && ${HOME} 'quoted text' awk cd
+2>/dev/null && $(pwd) $(pwd) && "$1" | test
+		/usr/bin x=1 grep done x=1 cd x=1 cd "$1" export then | "$1" ${HOME} &&
+		awk | test 'quoted text' then printf
+	"$@" test && sed done echo "$@" printf
+	-eu awk && && sed sed ${HOME} readonly sed
+x=1 readonly | 'quoted text'
+		| awk test -eu export local grep $(pwd) done grep export 'quoted text'
+	local printf | -eu $(pwd) | local && printf
+${HOME} 2>/dev/null done sed && test then then -eu 'quoted text' grep
+	&& ${HOME} cd && test -eu
+'quoted text' --verbose 'quoted text' "$1" /usr/bin export
+		sed export test x=1 readonly x=1 printf 'quoted text'
+		done test printf 2>/dev/null "$@"
+cd echo local sed "$1" -eu
+		done test && test $(pwd) -eu awk && export readonly local test
+"$1" "$@" && "$@" | 2>/dev/null test cd /usr/bin awk test
+		export $(pwd) awk 2>/dev/null x=1 2>/dev/null export
+		/usr/bin echo x=1 /usr/bin sed awk ${HOME} -eu "$1" /usr/bin then /usr/bin
+cd 'quoted text' cd export --verbose grep readonly
+		done local readonly cd ${HOME} "$@"
+		done --verbose echo -eu local printf -eu done test && -eu export $(pwd)
+/usr/bin 2>/dev/null | local 'quoted text' done
+-eu readonly /usr/bin --verbose 2>/dev/null then readonly
+/usr/bin echo | readonly --verbose local -eu --verbose --verbose sed grep then
+grep awk -eu x=1 "$@" sed -eu cd x=1 grep local -eu ${HOME} local sed
+	'quoted text' "$1" x=1
+awk && | $(pwd) --verbose test ${HOME} local "$@"
+	echo "$@" export "$1" grep -eu --verbose
+	'quoted text' ${HOME} grep readonly && echo sed
+	cd && local && -eu ${HOME} then 'quoted text' 'quoted text'
+'quoted text' --verbose then sed awk --verbose
+	awk printf "$1" sed && sed x=1 then "$@" readonly x=1
+-eu done ${HOME} done readonly -eu x=1 then ${HOME}
+'quoted text' 2>/dev/null printf echo
+printf then && x=1 $(pwd) $(pwd) --verbose "$1" 2>/dev/null x=1
+		--verbose --verbose test done awk grep | "$@" echo "$1" ${HOME} echo local
+		echo local $(pwd) 'quoted text' --verbose cd x=1 --verbose "$1" $(pwd) readonly
+		readonly /usr/bin ${HOME} 2>/dev/null printf /usr/bin grep "$@" echo
+grep export readonly /usr/bin 'quoted text'
+	echo 2>/dev/null ${HOME} cd awk /usr/bin echo --verbose readonly "$@" grep
+		-eu --verbose done && && awk ${HOME} --verbose
+	'quoted text' ${HOME} done grep "$1" 2>/dev/null
+sed printf export cd ${HOME}
+		local readonly cd "$1" export echo test /usr/bin
+grep sed grep 2>/dev/null x=1 /usr/bin awk printf sed awk awk test $(pwd) grep
+	printf awk readonly | local done /usr/bin
+		| ${HOME} -eu -eu 'quoted text' "$1" readonly -eu awk "$1" local
+		$(pwd) "$1" | local awk echo echo $(pwd) readonly local 2>/dev/null 2>/dev/null
+	grep export local grep && && "$1" grep printf
+		"$@" 2>/dev/null test sed then echo test
+	printf test export done
+	awk 2>/dev/null local then cd done
+&& awk "$1" test awk 2>/dev/null
+	-eu 'quoted text' local test export
+	done cd "$@" && readonly done $(pwd) sed grep done printf "$1" "$@" ${HOME} printf
+-eu ${HOME} test local done echo
+	printf readonly 2>/dev/null echo
+	"$@" awk x=1 cd | 2>/dev/null export
+		cd 2>/dev/null -eu /usr/bin "$@" grep test ${HOME} printf readonly sed |
+--verbose && --verbose local export local then && "$1" done local local done
+/usr/bin -eu then echo ${HOME} awk then ${HOME} readonly $(pwd) test x=1 test then
+		local ${HOME} /usr/bin | $(pwd) local local awk
+		then "$@" "$1" awk done printf 'quoted text' awk export
+		cd grep test $(pwd) done cd done x=1 cd x=1 ${HOME}
+		awk cd --verbose test sed test cd local | export printf | cd &&
+	done --verbose done echo x=1 "$1" export then -eu printf cd done /usr/bin
+	/usr/bin | $(pwd) awk cd
+	awk export x=1 x=1 grep 'quoted text' -eu | /usr/bin 'quoted text'
+	export $(pwd) done "$1" "$@" 2>/dev/null awk
+		'quoted text' -eu x=1 -eu /usr/bin -eu && done local
+		echo test export 2>/dev/null 2>/dev/null printf /usr/bin
+	x=1 test grep sed grep local
+printf /usr/bin echo && "$1" ${HOME} /usr/bin test
+	then cd export test cd readonly then 'quoted text'
+	&& && sed -eu x=1 sed readonly 2>/dev/null grep
+		--verbose echo test done --verbose then 'quoted text' $(pwd)
+	-eu | done ${HOME} grep awk ${HOME} ${HOME} test 2>/dev/null "$@"
+		2>/dev/null printf "$@" "$1" printf test
+"$1" ${HOME} "$1" sed done "$1" "$@" ${HOME} 2>/dev/null
+		echo -eu test /usr/bin x=1 echo printf
+&& "$@" ${HOME} echo printf printf 'quoted text' awk "$1" export -eu sed done -eu
+x=1 'quoted text' local awk cd --verbose "$1"
+		&& -eu ${HOME} then test "$1" sed && grep 2>/dev/null
+		then ${HOME} done $(pwd) "$@" done $(pwd) local --verbose
+	--verbose 2>/dev/null echo ${HOME} echo
+	| grep "$@" then done x=1 export
+	then 'quoted text' readonly 2>/dev/null cd --verbose x=1 printf sed "$1" echo echo
+	/usr/bin test $(pwd) export ${HOME} export export echo | awk --verbose
+	'quoted text' done && done "$@" "$1"
+		"$@" | | readonly | -eu echo export then | | local then -eu ${HOME} ${HOME} "$@"
+	done /usr/bin test cd readonly 2>/dev/null awk sed readonly
+printf /usr/bin then -eu 2>/dev/null | $(pwd) x=1 "$@" then
+-eu | cd readonly readonly ${HOME} ${HOME} "$@" printf echo 2>/dev/null
+		&& sed sed -eu grep then $(pwd)
+		echo then export $(pwd) echo --verbose | 'quoted text' printf 2>/dev/null
+	x=1 'quoted text' readonly cd 2>/dev/null cd printf awk x=1 cd export
+		local "$@" x=1 2>/dev/null printf echo export local | 2>/dev/null
+readonly ${HOME} cd awk
+		then echo test sed "$@" export && export
+	${HOME} grep && /usr/bin "$1" awk -eu /usr/bin
+		$(pwd) 2>/dev/null export printf export --verbose
+	readonly test sed printf test "$1" readonly printf printf
+'quoted text' "$@" test -eu then x=1 local
+done && done --verbose "$1" done test 'quoted text' "$@"
+local test $(pwd) "$@" local ${HOME} $(pwd) readonly $(pwd) /usr/bin --verbose
+printf export cd "$1" x=1 printf -eu
+	sed "$1" local done awk 'quoted text' 'quoted text' 'quoted text'
+		2>/dev/null | export -eu cd ${HOME} local $(pwd) | sed
+then echo readonly cd awk local x=1 -eu printf
+		${HOME} 'quoted text' "$1" "$@" readonly -eu "$1" readonly cd && --verbose
+	readonly done export 'quoted text' export grep && readonly
+	/usr/bin /usr/bin --verbose test 2>/dev/null "$@" then $(pwd) sed sed
+local test --verbose grep readonly printf "$@" cd 'quoted text'
+cd sed export "$1" cd && 2>/dev/null cd /usr/bin x=1 'quoted text' sed export
+		&& sed 'quoted text' echo cd
+	echo readonly then $(pwd) grep test export local done printf export printf 2>/dev/null
+	'quoted text' x=1 readonly grep
+	'quoted text' awk "$@" && done | $(pwd) && done "$@" /usr/bin
+--verbose "$1" $(pwd) export local x=1 test | printf "$1" && then "$1" 2>/dev/null
+	--verbose awk awk /usr/bin printf grep && cd cd
+		done done test ${HOME} echo ${HOME} /usr/bin -eu sed $(pwd) then --verbose
+test 'quoted text' $(pwd) -eu x=1 done && --verbose --verbose
+	export readonly "$@" printf readonly done |
+grep echo && 'quoted text' sed ${HOME} | then "$@" printf echo awk
+	--verbose ${HOME} readonly --verbose -eu 2>/dev/null then 'quoted text'
+readonly "$@" && ${HOME}
+	local echo grep done /usr/bin local ${HOME} ${HOME} "$1" done 'quoted text' grep
+"$@" echo ${HOME} done ${HOME} && --verbose awk | "$1"
+x=1 | | export x=1 x=1 2>/dev/null
+		then echo /usr/bin --verbose done echo "$1" sed "$@" then readonly
+	awk then done --verbose then $(pwd) readonly
+		/usr/bin sed test then grep readonly $(pwd) "$1" x=1 done ${HOME} local
+		printf --verbose then echo
+	awk done ${HOME} awk readonly $(pwd) then
+	echo "$@" printf && then readonly --verbose
+test then done readonly -eu 'quoted text' grep -eu | grep cd test sed
+		$(pwd) 'quoted text' /usr/bin $(pwd)
+echo ${HOME} && && | ${HOME} 'quoted text' readonly awk then ${HOME} local
+	--verbose test printf --verbose && 'quoted text'
+	readonly then 'quoted text'
+then echo x=1 2>/dev/null
+		"$1" | ${HOME} | --verbose echo cd cd printf "$@" then done echo "$1" | echo echo
+sed 2>/dev/null cd $(pwd) printf test | x=1 done
+		'quoted text' ${HOME} test cd /usr/bin test cd 2>/dev/null | /usr/bin
+		"$@" readonly test done "$@" readonly x=1 sed export
+		echo 'quoted text' export --verbose echo awk test 'quoted text'
+	cd ${HOME} && readonly done test 2>/dev/null
+		/usr/bin awk 2>/dev/null export "$1" local then sed -eu 'quoted text'
+		grep "$@" grep printf /usr/bin test && printf sed sed 2>/dev/null
+	/usr/bin grep ${HOME} done
+		--verbose export cd --verbose "$@" grep "$1" sed 2>/dev/null
+	"$@" -eu --verbose local | cd
+	grep done grep -eu 'quoted text'
+export 'quoted text' x=1
+cd $(pwd) test test awk 'quoted text' readonly export
+	test grep local -eu awk /usr/bin
+	"$1" "$@" 'quoted text' | && && readonly ${HOME}
+		"$@" -eu printf cd ${HOME} && sed echo /usr/bin $(pwd) awk cd "$@" done
+| && then printf then | test 2>/dev/null "$1" grep |
+export x=1 ${HOME} 2>/dev/null cd | "$@" -eu done local done
+		readonly 2>/dev/null awk && then 'quoted text' --verbose
+-eu --verbose && "$1" printf export export ${HOME} grep ${HOME} printf x=1 then
+--verbose sed test && && /usr/bin && then awk test && -eu -eu test ${HOME}
+grep && sed | $(pwd) && sed "$1" 2>/dev/null echo test
+	&& "$@" /usr/bin local && test
+	2>/dev/null then export echo -eu --verbose
+	done test x=1 readonly readonly awk done done /usr/bin ${HOME} $(pwd) /usr/bin then
+	done echo echo x=1 done then printf printf grep export
+	/usr/bin sed test done | --verbose export then
+	printf readonly local 'quoted text'
+	| test --verbose $(pwd) -eu /usr/bin export sed cd sed x=1 local |
+		awk && sed export done 2>/dev/null echo readonly /usr/bin awk local test test
+	-eu --verbose grep export
+readonly then export "$1" --verbose ${HOME} export done --verbose
+	'quoted text' && grep cd 'quoted text'
+	test | /usr/bin then x=1 | readonly awk readonly "$1" && local awk "$1"
+		${HOME} --verbose ${HOME} local sed 2>/dev/null 2>/dev/null sed grep local
+export -eu printf -eu --verbose local grep local
+/usr/bin "$@" export ${HOME} 2>/dev/null readonly ${HOME} 2>/dev/null
+		-eu test $(pwd) test && | sed sed echo awk printf grep /usr/bin -eu grep ${HOME}
+	export && --verbose $(pwd) ${HOME}
+--verbose then cd x=1 echo test ${HOME} cd then
+		$(pwd) -eu -eu then echo 2>/dev/null echo
+		sed cd 'quoted text' awk local $(pwd) local
+export awk -eu grep local sed
+	$(pwd) readonly cd 'quoted text' awk $(pwd) sed /usr/bin done export
+		export sed then "$1" --verbose |
+		"$1" grep echo export sed x=1 x=1 done awk done /usr/bin ${HOME} 2>/dev/null
+	cd ${HOME} /usr/bin done ${HOME} readonly
+	-eu then 'quoted text' 2>/dev/null awk awk echo
+test printf echo && -eu --verbose | test test test export local -eu done --verbose
+		&& grep ${HOME} readonly --verbose | readonly 'quoted text'
+		export 2>/dev/null echo ${HOME} --verbose local /usr/bin
+	echo then local printf printf $(pwd) sed cd 'quoted text'
+"$@" export x=1 printf cd x=1 then /usr/bin -eu $(pwd) 2>/dev/null
+| /usr/bin awk "$@" awk readonly cd --verbose "$@" 'quoted text'
+		-eu /usr/bin $(pwd) readonly awk "$1" cd grep grep | readonly | done 'quoted text'
+cd "$@" test then sed echo export
+echo "$1" $(pwd) | 2>/dev/null echo grep sed x=1 sed
+		&& grep "$@" echo readonly ${HOME} x=1 "$@"
+"$1" echo "$1" export awk 2>/dev/null then
+cd --verbose "$1" && $(pwd) export then ${HOME} "$1" $(pwd) x=1 "$1" local
+		test local -eu 'quoted text' x=1 local | "$@" "$1" echo $(pwd) printf
+		2>/dev/null | 'quoted text' readonly done "$@" --verbose ${HOME} awk
+$(pwd) 'quoted text' grep awk sed local cd readonly 2>/dev/null -eu "$1" awk
+${HOME} && cd 'quoted text' /usr/bin -eu x=1 "$@" awk $(pwd)
+		local cd ${HOME} test readonly x=1
+	cd export 2>/dev/null grep awk
+		"$@" sed export cd ${HOME} "$1" 2>/dev/null /usr/bin
+		echo && 'quoted text' | test
+"$1" 'quoted text' then local 'quoted text'
+	$(pwd) /usr/bin "$1" sed 'quoted text' local
+printf awk test done sed cd ${HOME} done
+		cd 2>/dev/null local local | -eu 2>/dev/null && test test
+	2>/dev/null | readonly 2>/dev/null 2>/dev/null
+printf local grep local $(pwd) /usr/bin
+	&& export && grep x=1 ${HOME} -eu --verbose test "$@" && local --verbose 'quoted text'
+		2>/dev/null "$1" && ${HOME} 2>/dev/null && ${HOME} ${HOME} grep
+	-eu export 2>/dev/null ${HOME} awk sed && --verbose && grep
+		| export /usr/bin $(pwd) export 2>/dev/null "$@" 'quoted text'
+	/usr/bin "$1" "$1" $(pwd) grep awk test readonly -eu ${HOME} -eu
+	--verbose /usr/bin 'quoted text'
+then -eu export && 2>/dev/null "$1" "$@" && sed 2>/dev/null
+	printf $(pwd) -eu local && echo 'quoted text'
+		/usr/bin readonly /usr/bin && && sed x=1 2>/dev/null /usr/bin printf
+	$(pwd) 'quoted text' 2>/dev/null then cd "$@"
+		2>/dev/null cd "$1" x=1
+"$1" sed && --verbose test "$1" printf local test 'quoted text'
+	"$@" test "$1" readonly --verbose export && "$1" /usr/bin x=1 awk
+		cd 'quoted text' grep
+	grep 'quoted text' $(pwd) test | && | then "$@" local cd /usr/bin awk $(pwd)
+	sed $(pwd) /usr/bin awk --verbose "$@" grep sed cd export "$@" grep /usr/bin
+	sed --verbose $(pwd) 'quoted text' echo local && 'quoted text' test then
+		"$@" "$1" grep grep sed sed local local
+		&& cd local cd "$@" then
+grep | sed then readonly 2>/dev/null export
+		sed export printf then done /usr/bin local "$1" -eu awk 'quoted text'
+"$1" local | grep cd local echo 2>/dev/null && | 'quoted text'
+grep ${HOME} && ${HOME} -eu awk sed test --verbose
+		| local done && 2>/dev/null --verbose /usr/bin printf printf
+		&& grep printf -eu $(pwd) ${HOME} grep echo 2>/dev/null
+	/usr/bin /usr/bin | export readonly $(pwd) -eu sed cd -eu "$@" -eu readonly
+	| x=1 "$@" 'quoted text' cd --verbose "$1" && local
+		x=1 /usr/bin local local "$@" done && cd awk local echo $(pwd) |
+	awk | | "$@" $(pwd) 'quoted text' then "$1" done /usr/bin awk /usr/bin $(pwd)
+export sed done | cd /usr/bin "$1" awk 'quoted text'
+"$@" then then grep export "$1" "$@" local -eu
+local 2>/dev/null export
+	grep | -eu grep test -eu awk cd export -eu readonly $(pwd) local local $(pwd)
+		cd 'quoted text' export export x=1 'quoted text'
+	&& 'quoted text' cd /usr/bin
+		x=1 printf $(pwd) test done $(pwd) --verbose | ${HOME}
+	${HOME} done $(pwd) echo "$1"
+/usr/bin --verbose /usr/bin then --verbose -eu cd "$1" -eu
+		sed | ${HOME} "$@" 2>/dev/null
+	2>/dev/null && done done /usr/bin -eu local 2>/dev/null printf awk printf x=1 test
+		"$@" -eu -eu local ${HOME}
+	test && -eu --verbose then grep "$1" && cd 2>/dev/null "$@" "$1" then readonly
+&& "$1" --verbose "$@" then readonly | local "$@" grep cd /usr/bin 2>/dev/null
+	local -eu ${HOME} x=1 export echo --verbose
+sed local -eu -eu done then grep && export /usr/bin 'quoted text'
+	done grep test x=1 "$@" "$1" done local grep
+	echo test 'quoted text' | grep grep && done awk "$1"
+sed "$@" then cd 'quoted text'
+		-eu 2>/dev/null local | "$@" 'quoted text' /usr/bin test printf ${HOME}
+	export then export | ${HOME} /usr/bin printf --verbose
+'quoted text' awk -eu readonly awk | 2>/dev/null echo
+	"$1" /usr/bin done 2>/dev/null "$@" sed
+--verbose awk 'quoted text'
+		done printf export sed local 2>/dev/null test x=1 local /usr/bin
+x=1 "$@" 2>/dev/null "$@" $(pwd) --verbose x=1 grep
+test ${HOME} -eu "$1" 2>/dev/null
+	/usr/bin then readonly grep
+		cd local 2>/dev/null 2>/dev/null sed
+		awk ${HOME} echo then grep
+| readonly && echo cd printf grep
+	awk 'quoted text' "$@" echo grep export x=1 cd /usr/bin | test export /usr/bin
+		readonly done 'quoted text' && "$@" "$1"
+		${HOME} printf -eu readonly sed awk export x=1 x=1 "$@"
+-eu sed $(pwd) 2>/dev/null "$1" --verbose done done
+	"$@" | export ${HOME} local printf -eu $(pwd) export
+		"$@" $(pwd) -eu printf /usr/bin -eu readonly local echo export sed export
+		$(pwd) "$@" echo --verbose
+readonly "$@" && local 2>/dev/null awk echo | printf ${HOME} awk $(pwd) &&
+x=1 && cd readonly sed printf readonly awk grep readonly
+		"$1" cd 'quoted text' local local local test 2>/dev/null echo
+		awk test x=1 'quoted text' -eu done cd readonly sed sed -eu /usr/bin ${HOME}
+		&& export | 2>/dev/null "$1" done done printf awk
+	-eu then local --verbose $(pwd) /usr/bin
+&& "$1" local 'quoted text' then
+awk then x=1 awk /usr/bin sed
+	| -eu done "$@" printf local | 2>/dev/null -eu --verbose printf test
+		'quoted text' export sed /usr/bin
+x=1 export 'quoted text' "$@" 2>/dev/null 2>/dev/null
+	local done && sed export awk --verbose
+"$1" | -eu x=1 "$@" printf "$@" "$@" --verbose export
+	'quoted text' grep && "$@" grep
+	-eu | then "$@" "$1" $(pwd) 2>/dev/null printf printf
+		awk test echo /usr/bin x=1 sed local then | /usr/bin test export cd /usr/bin
+then 2>/dev/null export readonly
+	| "$1" echo export && printf
+		printf local readonly echo printf x=1 &&
+/usr/bin printf done done $(pwd) readonly
+		2>/dev/null echo ${HOME}
+		/usr/bin "$@" x=1 export "$1" | echo "$@" grep /usr/bin ${HOME} awk "$1"
+		| sed test then export echo && 2>/dev/null
+done grep 2>/dev/null /usr/bin export --verbose
+		test | x=1 && && test printf readonly | done "$1" local
+2>/dev/null | | $(pwd) --verbose -eu
+	&& $(pwd) 2>/dev/null done
+		${HOME} done ${HOME} 'quoted text'
+"$@" cd awk "$@" -eu --verbose "$@" local awk --verbose "$1"
+		readonly 'quoted text'
+		local local ${HOME} $(pwd) grep x=1 export x=1 sed "$1" local
+	"$1" "$1" $(pwd) ${HOME} printf test export 2>/dev/null | cd cd
+		--verbose --verbose test && | $(pwd) readonly 'quoted text'
+	echo sed done "$1" -eu export done
+		readonly && /usr/bin echo && grep done printf done $(pwd) done awk export cd done
+		export printf echo local sed cd echo echo && readonly
+-eu echo 'quoted text' /usr/bin printf
+		echo local echo "$1" then sed "$@" -eu grep
+export 2>/dev/null "$@" | -eu $(pwd) grep
+x=1 then 2>/dev/null /usr/bin readonly && echo grep "$@" grep "$1" 2>/dev/null
+"$1" grep awk | "$@" awk -eu 'quoted text' ${HOME}
+	export then $(pwd) done "$@" echo cd local
+2>/dev/null 'quoted text'
+		sed sed | then "$@" $(pwd) ${HOME} 2>/dev/null /usr/bin
+-eu echo && sed printf readonly export | then awk --verbose 'quoted text'
+		printf --verbose "$1" x=1 then readonly
+		| export "$1" | /usr/bin ${HOME}
+		sed $(pwd) "$@" | /usr/bin cd echo "$1" --verbose
+printf done x=1 ${HOME} cd test $(pwd) readonly "$1" && /usr/bin
+		-eu done -eu 2>/dev/null "$@" && readonly ${HOME} cd "$@" | grep --verbose
+		x=1 "$@" echo "$@" printf --verbose
+$(pwd) grep then printf export done test cd 2>/dev/null
+	awk sed ${HOME} 2>/dev/null grep --verbose
+		${HOME} --verbose then --verbose
+printf sed cd test 2>/dev/null printf ${HOME} then awk grep ${HOME}
+"$@" test x=1 /usr/bin
+		echo && ${HOME} | 2>/dev/null | done "$1" /usr/bin --verbose $(pwd)
+		${HOME} echo --verbose $(pwd) awk readonly ${HOME} "$@" cd printf
+	--verbose grep local test --verbose cd done 'quoted text' ${HOME} 2>/dev/null
+	/usr/bin --verbose -eu then /usr/bin
+$(pwd) /usr/bin grep | "$@" export --verbose printf sed | printf readonly
+	${HOME} local 'quoted text' sed done sed echo local && | x=1 printf -eu ${HOME}
+	"$1" $(pwd) then "$@" export | then 'quoted text' echo readonly | echo done local
+		grep readonly export --verbose then
+	2>/dev/null --verbose 2>/dev/null 2>/dev/null
+sed --verbose $(pwd) 2>/dev/null cd x=1 | -eu 2>/dev/null
+		sed x=1 | local "$1" x=1 printf "$@" $(pwd) x=1
+	--verbose x=1 export "$1" | 2>/dev/null
+		echo /usr/bin awk sed then ${HOME} test /usr/bin
+	--verbose x=1 x=1 $(pwd)
+export grep && $(pwd) readonly grep echo ${HOME} &&
+-eu x=1 awk ${HOME} cd test
+/usr/bin --verbose echo 'quoted text' -eu test | awk 'quoted text'
+	| export cd && ${HOME} then $(pwd) then
+		${HOME} awk x=1 sed done readonly grep
+	x=1 cd "$@" echo echo test /usr/bin x=1 readonly 'quoted text' done | local /usr/bin
+		cd x=1 local "$@" ${HOME} /usr/bin ${HOME} done
+		test 2>/dev/null local --verbose $(pwd) done 'quoted text'
+readonly sed echo awk export done
+		then then "$1" then printf local "$1" "$1" test readonly "$1" 'quoted text' done
+		-eu printf export 'quoted text' |
+export echo awk $(pwd) && readonly
+/usr/bin printf test test $(pwd) "$1" sed done grep sed readonly "$1" grep
+then --verbose "$@" -eu "$@" sed --verbose
+		"$@" readonly awk grep done $(pwd) sed ${HOME} local $(pwd) then
+		test | then grep export 2>/dev/null
+		cd grep x=1 ${HOME} echo awk printf /usr/bin
+		test | -eu 'quoted text' /usr/bin done | done test sed x=1 $(pwd) $(pwd)
+		cd done 'quoted text' -eu ${HOME} | $(pwd) --verbose /usr/bin export && cd
+	2>/dev/null cd && local awk test then
+-eu | readonly then "$1" awk x=1 local "$1" readonly
+grep sed sed sed echo x=1 grep local grep done "$@" ${HOME}
+awk && /usr/bin --verbose test local "$1" | sed
+cd export readonly awk && awk $(pwd) test done grep readonly
+	-eu ${HOME} 2>/dev/null "$@" && printf awk --verbose $(pwd) /usr/bin awk export
+	readonly then export printf | | cd /usr/bin export readonly
+echo /usr/bin && awk ${HOME}
+		then | then cd awk -eu done export | cd awk test
+	"$1" done echo test printf done && then
+	&& awk 'quoted text' $(pwd) readonly
+| export /usr/bin sed sed | done
+${HOME} grep ${HOME} -eu -eu awk echo sed
+		'quoted text' $(pwd) -eu $(pwd) $(pwd) export then x=1 awk test 2>/dev/null
+	| 2>/dev/null "$1" then -eu cd then echo $(pwd)
+x=1 ${HOME} && --verbose printf printf echo
+		2>/dev/null -eu && | 'quoted text'
+		sed && awk export "$1" && $(pwd) test ${HOME}
+	printf local --verbose "$@" 2>/dev/null --verbose 'quoted text' readonly
+sed "$@" test grep "$@" "$@"
+		grep 2>/dev/null --verbose readonly $(pwd) grep
+	readonly test local printf
+x=1 x=1 awk "$1" echo
+		local --verbose cd local && && /usr/bin
+echo cd | export grep x=1 -eu local grep ${HOME} "$1" done /usr/bin
+		printf sed "$1" && printf cd sed
+| printf printf sed /usr/bin "$1" export "$1" && &&
+	readonly x=1 then 'quoted text' echo then readonly then $(pwd)
+	export "$1" local readonly readonly "$1" readonly /usr/bin then && printf
+2>/dev/null cd x=1 'quoted text' 2>/dev/null "$1" awk grep && | cd
+		'quoted text' local local "$@" done 'quoted text' ${HOME} sed "$1" done cd
+test local test x=1 local | "$@"
+	${HOME} x=1 --verbose /usr/bin 'quoted text' test
+echo test "$1" then | /usr/bin test then "$1" ${HOME} export
+local awk sed && 'quoted text' awk ${HOME} echo
+	--verbose "$1" printf local grep export cd ${HOME} x=1 then
+	awk cd printf export then | --verbose export local sed done sed awk grep test
+	grep local grep $(pwd) | then ${HOME} readonly
+		| 2>/dev/null x=1 --verbose 2>/dev/null export test
+	echo -eu cd local sed then x=1 test "$1" grep | ${HOME} grep
+	x=1 x=1 grep 'quoted text' && "$1" $(pwd) 'quoted text' x=1 export x=1
+	2>/dev/null "$@" -eu x=1 then ${HOME} --verbose
+| echo sed test "$@" test "$@" printf -eu "$@"
+	"$1" && x=1 echo /usr/bin local $(pwd) /usr/bin printf printf 2>/dev/null
+	echo local printf ${HOME} 'quoted text' printf $(pwd) readonly /usr/bin grep readonly
+"$@" done export $(pwd) x=1 awk test "$@" printf --verbose then grep then 'quoted text'
+		printf 2>/dev/null 'quoted text' 2>/dev/null awk then awk test then local
+	"$1" done | sed && 'quoted text' local test sed test &&
+$(pwd) && sed done export test export echo --verbose sed ${HOME} ${HOME}
+awk | grep cd $(pwd) readonly grep cd && printf
+/usr/bin "$@" | x=1 -eu ${HOME} ${HOME} export 2>/dev/null
+		readonly local && awk | "$1" sed echo "$1" 'quoted text' done 'quoted text'
+	awk 'quoted text' "$1" printf
+	2>/dev/null echo grep sed 'quoted text' awk && sed
+$(pwd) then cd /usr/bin x=1 x=1 && /usr/bin done printf then
+	"$@" "$@" readonly 2>/dev/null ${HOME} 'quoted text'
+	"$1" grep then ${HOME} grep $(pwd) && ${HOME} then echo 2>/dev/null printf --verbose
+		sed sed $(pwd) "$1" local printf 2>/dev/null export test readonly x=1 --verbose
+	done ${HOME} grep && echo
+		'quoted text' $(pwd) local printf && then printf local x=1 export
+	2>/dev/null -eu awk local -eu -eu "$1" export sed
+x=1 cd -eu readonly done /usr/bin cd 'quoted text' then && $(pwd) grep done readonly
+	test export 2>/dev/null "$1" 'quoted text' printf readonly grep test 'quoted text'
+	&& /usr/bin done cd readonly printf grep | --verbose test test | then x=1 $(pwd)
+		export export sed -eu local printf printf
+echo "$1" $(pwd) then
+		echo 2>/dev/null awk printf x=1
+	$(pwd) echo x=1 readonly "$1" ${HOME} "$1" --verbose sed cd
+local sed | ${HOME} "$@" 2>/dev/null ${HOME} echo /usr/bin grep "$@" local
+	export grep ${HOME} /usr/bin echo
+	"$@" then cd awk local local x=1 2>/dev/null x=1 "$1" sed printf -eu test awk readonly
+		then | done x=1 | 'quoted text' awk cd x=1 export
+	"$@" readonly sed && then cd
+	| awk sed done done sed 2>/dev/null
+	readonly 'quoted text' printf && 2>/dev/null 2>/dev/null | ${HOME} printf
+'quoted text' x=1 sed done printf
+"$@" 'quoted text' readonly
+"$@" then 'quoted text' 2>/dev/null export x=1 && "$@" grep /usr/bin /usr/bin ${HOME}
+	grep sed 'quoted text' -eu --verbose ${HOME} 2>/dev/null printf
+/usr/bin -eu local "$1" echo awk "$@" echo $(pwd) sed /usr/bin "$@" sed
+awk local then awk $(pwd) /usr/bin 2>/dev/null test $(pwd) 2>/dev/null sed
+	$(pwd) cd readonly x=1 -eu /usr/bin -eu grep -eu readonly awk 'quoted text'
+then readonly $(pwd) 'quoted text' && test -eu export ${HOME} awk x=1 done
+	then sed then x=1 cd && x=1 test grep grep | local done cd local
+		local /usr/bin -eu test | grep "$@" grep cd then 2>/dev/null x=1
+	x=1 awk x=1 then --verbose "$1" /usr/bin 2>/dev/null grep local "$1" --verbose
+&& ${HOME} sed | --verbose -eu 2>/dev/null /usr/bin grep
+test then x=1 readonly printf done "$1"
+	printf 2>/dev/null 2>/dev/null
+		$(pwd) /usr/bin "$@" --verbose
+x=1 ${HOME} sed cd export 'quoted text'
+$(pwd) "$@" cd --verbose done grep awk test
+		awk "$1" local "$1" export export "$@" grep -eu -eu | "$@" sed "$@" done x=1
+	readonly done echo test /usr/bin
+done local then export grep --verbose --verbose
+		sed x=1 ${HOME} then readonly
+		2>/dev/null done readonly echo grep
+	local 'quoted text' sed "$@"
+&& && grep 2>/dev/null x=1 --verbose local "$1" sed && --verbose
+		awk echo 'quoted text' | export echo 2>/dev/null readonly 'quoted text'
+	cd then printf then local "$@" --verbose --verbose $(pwd) 'quoted text' 'quoted text'
+	test /usr/bin then -eu echo done /usr/bin | local awk done --verbose
+	"$1" echo /usr/bin $(pwd) then then &&
+x=1 test echo && echo sed test /usr/bin done 'quoted text'
+	| x=1 /usr/bin "$1" $(pwd) /usr/bin export grep done -eu export
+		grep | readonly done readonly
+echo -eu export $(pwd) --verbose grep $(pwd)
+		sed x=1 2>/dev/null | && 'quoted text' "$@"
+	"$1" -eu readonly echo grep x=1 cd 'quoted text'
+		echo then grep readonly export test readonly --verbose $(pwd) awk && local | awk
+		${HOME} "$@" | export test && x=1 printf readonly "$1"
+printf /usr/bin local 'quoted text' echo cd awk /usr/bin awk
+	&& printf then "$1" echo "$@" echo
+		"$@" "$@" local /usr/bin "$1" ${HOME} $(pwd) test printf --verbose
+		2>/dev/null export && echo export
+		grep then ${HOME} "$@" 2>/dev/null
+-eu cd ${HOME} -eu printf && local && "$1" --verbose 2>/dev/null
+		readonly done echo grep 'quoted text' --verbose test && cd then ${HOME}
+	/usr/bin cd awk "$@" $(pwd) 'quoted text' local ${HOME}
+	readonly 'quoted text' test then echo x=1
+readonly then cd done echo /usr/bin "$@" ${HOME} && | | $(pwd)
+		local grep 2>/dev/null export local 'quoted text' -eu -eu
+		cd awk local grep 2>/dev/null awk then done x=1 && 2>/dev/null local x=1
+		local local && readonly "$1" -eu
+		/usr/bin "$1" test printf
+		echo then 2>/dev/null awk $(pwd) readonly sed done $(pwd) local --verbose printf
+--verbose -eu grep then 'quoted text'
+	grep -eu cd cd echo 2>/dev/null printf
+done /usr/bin then 'quoted text' ${HOME} ${HOME} test
+	2>/dev/null awk awk 'quoted text' "$1" export 'quoted text'
+2>/dev/null echo readonly "$1" /usr/bin
+		cd --verbose | "$1" grep $(pwd) then test sed then export "$@" --verbose local
+${HOME} awk /usr/bin | --verbose export $(pwd) test --verbose
+	"$@" 'quoted text' awk cd 2>/dev/null awk grep -eu && ${HOME} "$@"
+		done | -eu grep done x=1 echo -eu done "$1" awk
+	2>/dev/null /usr/bin then "$1" local x=1 printf
+$(pwd) | /usr/bin export then "$@" /usr/bin
+	/usr/bin readonly /usr/bin --verbose 2>/dev/null
+		grep awk then local readonly cd grep local -eu export
+	${HOME} local 2>/dev/null /usr/bin
+		grep cd sed cd && grep -eu printf cd echo ${HOME} && 2>/dev/null echo
+local sed local local echo "$@" | x=1
+local "$@" 2>/dev/null -eu done /usr/bin "$1" "$@"
+grep readonly && sed ${HOME} ${HOME}
+		awk export | ${HOME} awk "$@" x=1 readonly 2>/dev/null
+$(pwd) local readonly && printf echo echo | $(pwd) done
+	sed readonly cd readonly 'quoted text' readonly echo 2>/dev/null then done sed
+		$(pwd) | 'quoted text' && done done
+then | grep ${HOME} ${HOME} done echo printf 2>/dev/null
+	then echo /usr/bin --verbose
+		/usr/bin 2>/dev/null export cd | done -eu "$@" cd -eu x=1 sed "$@" /usr/bin
+--verbose echo grep awk
+	printf && -eu ${HOME} 'quoted text'
+		"$1" -eu ${HOME} echo "$1" echo 'quoted text' /usr/bin --verbose x=1 local
+| "$@" -eu $(pwd) "$1" then
+	awk done then done x=1 -eu printf -eu |
+	$(pwd) test | $(pwd) cd export local -eu && export echo 'quoted text' awk
+then /usr/bin $(pwd) printf | --verbose then
+		grep done --verbose --verbose
+		$(pwd) -eu local && awk | && ${HOME}
+cd local && -eu awk "$1" grep /usr/bin done then 'quoted text' && cd ${HOME}
+	${HOME} 2>/dev/null && readonly /usr/bin sed && then /usr/bin
+grep sed grep echo echo $(pwd)
+"$1" cd printf cd /usr/bin /usr/bin
+	2>/dev/null export printf readonly
+		printf | ${HOME} printf --verbose "$1" readonly x=1 ${HOME} done 'quoted text' then
+sed echo $(pwd) && then
+		echo readonly readonly /usr/bin /usr/bin sed x=1 -eu done printf
+readonly x=1 awk ${HOME} && "$@" test done cd && readonly
+	sed test 'quoted text' $(pwd) cd readonly readonly
+echo "$1" then cd 'quoted text' printf 2>/dev/null
+		export | printf test | echo
+		2>/dev/null && --verbose | --verbose 2>/dev/null cd done then --verbose x=1 test
+'quoted text' printf | awk x=1 test && ${HOME} x=1
+/usr/bin test then then && echo local local --verbose readonly grep 2>/dev/null
+		done local $(pwd) -eu cd awk 'quoted text' x=1 'quoted text'
+	printf grep --verbose -eu --verbose export sed cd x=1 /usr/bin sed
+done ${HOME} ${HOME} -eu --verbose "$1" sed "$@" printf cd
+then sed && printf 2>/dev/null 2>/dev/null
+		"$1" /usr/bin "$@" export /usr/bin done sed readonly
+	/usr/bin /usr/bin grep local local --verbose -eu local | test awk
+--verbose 2>/dev/null -eu printf awk --verbose test 'quoted text' grep awk
+		&& | | $(pwd) --verbose | grep local printf && done 'quoted text' ${HOME} /usr/bin
+	done "$@" $(pwd) -eu readonly echo
+	"$@" grep 2>/dev/null grep /usr/bin cd /usr/bin
+		-eu test ${HOME} done -eu && sed echo && awk ${HOME} "$1" grep export 2>/dev/null
+		-eu -eu cd && "$@" export grep test awk export done
+	test "$1" printf local 'quoted text'
+	--verbose printf grep 'quoted text' "$@" /usr/bin 2>/dev/null -eu
+	&& cd 'quoted text' sed grep readonly x=1 "$1"
+		x=1 'quoted text' --verbose done
+	| printf sed --verbose awk readonly /usr/bin sed "$@" x=1 sed
+		"$1" 'quoted text' sed echo && sed export
+	local test done 'quoted text' local "$@" cd test -eu local 'quoted text'
+/usr/bin then then "$@" 2>/dev/null
+		"$1" local ${HOME} echo "$1"
+		"$@" local && done export
+		echo export done /usr/bin awk 'quoted text' done readonly
+echo test "$1" 2>/dev/null export export && x=1 -eu then cd export
+		'quoted text' 2>/dev/null readonly -eu "$1" echo && "$@" printf
+		export test then 'quoted text' then
+	readonly ${HOME} --verbose export --verbose
+		x=1 "$1" /usr/bin -eu 2>/dev/null 2>/dev/null printf awk
+		export x=1 echo /usr/bin local then echo cd awk
+	then awk && echo ${HOME} then -eu 2>/dev/null local done echo echo x=1
+		${HOME} 2>/dev/null export export done awk "$@" grep
+grep && awk "$1" test x=1 done /usr/bin --verbose local --verbose && ${HOME}
+	-eu && 'quoted text' -eu x=1 -eu cd && && done
+		"$@" grep && "$@" --verbose
+	${HOME} done 'quoted text' "$1" --verbose 2>/dev/null printf $(pwd) awk 'quoted text'
+"$@" sed grep test 'quoted text' readonly $(pwd)
+		echo $(pwd) awk ${HOME} cd x=1
+grep printf $(pwd) awk 'quoted text' grep sed && sed /usr/bin awk /usr/bin && 'quoted text'
+	echo $(pwd) test -eu grep test ${HOME} test ${HOME} sed /usr/bin
+	'quoted text' printf 'quoted text'
+		printf local 'quoted text' -eu --verbose awk test then x=1 local x=1
+		2>/dev/null test test cd 'quoted text' 2>/dev/null --verbose 2>/dev/null |
+	echo "$@" ${HOME} 2>/dev/null
+x=1 | | "$@" x=1 "$@" -eu -eu
+	'quoted text' grep /usr/bin 2>/dev/null "$@"
+	test readonly -eu cd x=1 | then 2>/dev/null test readonly
+		&& done x=1 local ${HOME} echo then 2>/dev/null "$1" ${HOME} --verbose
+	readonly done x=1 test | "$1"
+	echo 2>/dev/null --verbose --verbose --verbose grep 2>/dev/null
+done 2>/dev/null sed x=1 cd sed | export "$1" $(pwd) $(pwd) | readonly done export
+sed x=1 "$@" 2>/dev/null 2>/dev/null | printf /usr/bin
+-eu | "$1" | "$1" then done && echo awk export readonly
+	local | ${HOME} "$@" awk "$1" && readonly /usr/bin
+	| awk --verbose "$@" grep 2>/dev/null local "$1" done awk && test
+		then 2>/dev/null x=1 done then | local then printf
+-eu "$@" ${HOME} awk grep "$@" local
+	x=1 | && | | then readonly sed done --verbose export x=1 export x=1 $(pwd) --verbose
+		cd printf -eu echo test printf ${HOME} "$1" done
+${HOME} printf sed printf awk sed awk export $(pwd) /usr/bin && cd -eu "$1" test
+		grep && done -eu then done $(pwd) 2>/dev/null x=1 then local ${HOME} $(pwd)
+	"$1" 'quoted text' export
+		local /usr/bin -eu sed test -eu local "$1" done 2>/dev/null readonly
+echo cd grep 2>/dev/null readonly echo 'quoted text'
+		2>/dev/null local "$1" 'quoted text' export readonly
+x=1 export $(pwd) -eu done 2>/dev/null | -eu
+| readonly test grep done -eu local local && done grep echo cd /usr/bin
+	-eu local printf local "$@" sed 'quoted text' /usr/bin 2>/dev/null
+$(pwd) done export then local
+	"$1" test test awk /usr/bin
+| local grep x=1 /usr/bin export $(pwd)
+		${HOME} 2>/dev/null "$@" -eu
+printf grep printf printf export readonly export 2>/dev/null 'quoted text'
+'quoted text' export readonly
+| | grep test echo done awk
+	-eu sed "$1" cd then -eu x=1 "$1" cd
+		'quoted text' cd local "$1" "$@"
+"$1" ${HOME} --verbose cd grep && echo then test /usr/bin
+		-eu -eu && readonly grep grep test | /usr/bin $(pwd) "$@" cd "$@" done
+	/usr/bin 2>/dev/null export | echo /usr/bin
+then grep then grep sed && then
+		${HOME} then echo local -eu test | x=1 readonly
+printf export local "$1" /usr/bin "$1" sed "$@" export done -eu export
+/usr/bin 2>/dev/null 'quoted text'
+	cd done export sed printf x=1 done then x=1 grep cd cd 'quoted text'
+		"$1" x=1 grep | cd 'quoted text'
+printf then export ${HOME} then local ${HOME} 2>/dev/null
+	/usr/bin 'quoted text' x=1 done ${HOME} then 'quoted text' &&
+"$@" x=1 printf --verbose ${HOME} && && 'quoted text'
+	test echo 2>/dev/null readonly export
+--verbose "$1" "$1" 'quoted text'
+	$(pwd) echo x=1 'quoted text' "$@" export cd 'quoted text' $(pwd) -eu 2>/dev/null
+	awk /usr/bin "$1" test cd | awk x=1 "$1" local
+then ${HOME} echo awk 2>/dev/null | sed test --verbose $(pwd) sed readonly sed
+	cd then readonly sed "$@" $(pwd) sed cd -eu
+		export | echo 2>/dev/null awk printf && 2>/dev/null cd "$@" readonly
+		-eu 2>/dev/null sed sed x=1 && "$@" x=1 -eu -eu printf export printf
+		printf grep | | sed awk done awk
+		local printf readonly $(pwd) "$1" $(pwd) awk | awk sed done
+grep readonly readonly then x=1 2>/dev/null --verbose
+	--verbose /usr/bin export "$1" $(pwd) printf
+	export ${HOME} readonly "$1" --verbose done "$1" ${HOME}
+sed | 'quoted text' echo && grep sed | "$1" "$@" echo sed /usr/bin test $(pwd)
+local readonly "$1" done 'quoted text' --verbose test 'quoted text'
+		cd done "$1" then echo "$@" sed done printf /usr/bin --verbose awk grep readonly
+	${HOME} printf export && test 'quoted text' done --verbose
+	grep readonly /usr/bin ${HOME} then
+echo "$@" | && awk x=1 sed "$@"
+"$1" printf grep -eu export then -eu
+sed sed | test "$1" x=1 -eu x=1
+	sed ${HOME} export readonly | | awk -eu $(pwd)
+		export $(pwd) then then test $(pwd) 'quoted text'
+		printf grep ${HOME} /usr/bin cd grep awk | 2>/dev/null "$@"
+		test then | done grep && | local awk --verbose
+test x=1 readonly -eu ${HOME}
+cd echo "$@" grep && export then -eu "$@" test "$1" sed $(pwd) "$1"
+	&& cd done printf /usr/bin grep $(pwd) "$1" echo
+		--verbose -eu x=1 test ${HOME} ${HOME} "$@"
+	export local $(pwd) ${HOME} awk then
+	"$@" awk 2>/dev/null /usr/bin /usr/bin sed export test -eu --verbose
+	2>/dev/null awk 2>/dev/null -eu -eu ${HOME}
+	readonly readonly | --verbose cd 'quoted text' --verbose
+		awk grep -eu awk done "$@"
+		2>/dev/null local --verbose "$1" -eu -eu
+		then then /usr/bin 'quoted text'
+	/usr/bin 2>/dev/null --verbose
+		${HOME} grep --verbose && echo 2>/dev/null -eu | readonly
+		test cd local sed then readonly echo && && /usr/bin export
+	readonly "$1" cd grep "$@" done 'quoted text' /usr/bin | export "$1" | -eu x=1
+'quoted text' 'quoted text' awk printf 'quoted text' done x=1 done --verbose
+		grep printf test test test /usr/bin $(pwd) done /usr/bin && | awk echo
+awk printf echo local /usr/bin 2>/dev/null export 2>/dev/null printf
+		awk test -eu echo $(pwd) && "$@" --verbose --verbose 2>/dev/null
+		/usr/bin export 2>/dev/null
+		&& test "$@" cd 'quoted text'
+	sed --verbose "$1" then "$1" 'quoted text'
+grep awk export x=1 then done readonly test /usr/bin | sed
+		local then -eu 2>/dev/null cd "$@" && sed then echo &&
+		grep then --verbose | printf && "$1" then x=1 echo
+		/usr/bin 'quoted text' --verbose $(pwd) -eu awk readonly x=1 ${HOME} | sed done
+"$@" -eu | 'quoted text' grep | printf $(pwd) && x=1 local
+export 'quoted text' echo test echo "$1" readonly --verbose | sed
+	export local x=1 | 'quoted text' local --verbose grep | x=1 'quoted text'
+--verbose test awk export then ${HOME} $(pwd) /usr/bin sed $(pwd)
+2>/dev/null awk "$@" && local sed echo sed local done 2>/dev/null
+-eu echo sed local echo done
+	${HOME} -eu grep 'quoted text' sed
+	x=1 "$@" 'quoted text' x=1 local x=1 readonly x=1 done 2>/dev/null --verbose
+'quoted text' echo local
+	${HOME} awk && grep --verbose cd $(pwd) readonly 'quoted text'
+done ${HOME} $(pwd) x=1 cd "$@" "$@" echo | /usr/bin
+		--verbose cd /usr/bin then x=1 printf 2>/dev/null | && export 2>/dev/null
+	export -eu export 2>/dev/null 2>/dev/null -eu echo
+	$(pwd) test grep --verbose then done --verbose --verbose awk test done ${HOME}
+		awk "$@" | --verbose cd
+grep export /usr/bin export readonly grep x=1 2>/dev/null 2>/dev/null -eu
+	done printf local --verbose then && && 'quoted text'
+	done | printf local /usr/bin local printf done | 'quoted text'
+		test export "$1" "$@" x=1 "$@" printf
+	"$1" 'quoted text' | "$1" && && 2>/dev/null test x=1 done export $(pwd)
+	echo /usr/bin | cd -eu test "$1" local echo /usr/bin done readonly awk --verbose
+		printf ${HOME} /usr/bin /usr/bin
+		printf readonly /usr/bin ${HOME} test
+&& done /usr/bin /usr/bin /usr/bin echo export
+		$(pwd) grep && then export sed
+	sed done awk "$@" "$@" awk cd && --verbose && |
+		| /usr/bin /usr/bin x=1 && cd done | ${HOME}
+	then cd 'quoted text' test x=1 &&
+	cd echo --verbose --verbose x=1 cd readonly --verbose x=1 &&
+"$1" readonly x=1 && echo export printf readonly local
+		"$1" $(pwd) readonly sed $(pwd) x=1
+${HOME} echo /usr/bin printf ${HOME} && /usr/bin
+		x=1 2>/dev/null sed done cd
+	then sed "$@" echo cd printf then
+echo grep printf /usr/bin echo echo ${HOME} export ${HOME} $(pwd) 2>/dev/null
+		grep done && 'quoted text' && "$@" "$1" && then
+	${HOME} awk --verbose then | 'quoted text' then
+	2>/dev/null "$@" --verbose "$1" done sed 2>/dev/null
+x=1 then export /usr/bin $(pwd) test readonly grep sed ${HOME}
+		echo --verbose "$1" "$1" 'quoted text' echo echo 'quoted text'
+		"$@" 'quoted text' ${HOME} 'quoted text' | export "$@" awk
+	| then "$@" local -eu then export awk -eu | "$@"
+done "$@" grep 'quoted text' local done echo local sed --verbose local
+cd export $(pwd) x=1 done test grep export x=1 printf "$1" export printf
+	readonly ${HOME} then sed
+#include c62.sh
+	readonly sed echo $(pwd)
+	readonly then echo then local
+		/usr/bin cd test export ${HOME} 'quoted text' export "$1"
+	then export -eu grep $(pwd) -eu export ${HOME} 'quoted text' grep | | cd
+		echo local && 2>/dev/null grep "$1" x=1 export printf
+	local /usr/bin cd awk "$@" done
+-eu /usr/bin sed ${HOME} && sed sed echo readonly "$1" /usr/bin
+| awk && /usr/bin sed --verbose cd 2>/dev/null then --verbose readonly echo
+	echo echo test $(pwd) 2>/dev/null readonly awk local echo sed x=1 readonly
+done 2>/dev/null 2>/dev/null sed awk cd "$@" /usr/bin 'quoted text' done "$@"
+	x=1 grep cd then 'quoted text' 'quoted text' grep --verbose awk
+		x=1 echo ${HOME} local grep grep
+		echo cd printf echo test "$@" x=1 awk $(pwd) local local readonly
+printf then local --verbose -eu $(pwd) /usr/bin x=1 readonly awk 'quoted text'
+		local readonly --verbose then local ${HOME}
+		sed "$@" printf test -eu readonly "$@" local
+		--verbose "$1" -eu 'quoted text'
+&& "$@" $(pwd) grep cd ${HOME} then test local "$@" test
+		export "$1" x=1 local 2>/dev/null | 2>/dev/null
+	2>/dev/null "$@" -eu | "$@" "$@" /usr/bin 'quoted text'
+		export test "$1" "$@" grep
+	-eu echo then echo x=1 /usr/bin | echo done printf -eu done /usr/bin
+	&& --verbose 2>/dev/null | test printf "$@" cd local then sed sed
+--verbose then printf done local $(pwd) && awk then | awk ${HOME}
+	${HOME} export export "$1" cd then printf $(pwd) test awk && printf grep
+		then test sed echo printf done readonly cd printf "$1" done
+	done cd -eu echo | done | -eu printf && 'quoted text' /usr/bin && "$1" --verbose
+	&& awk && then && /usr/bin ${HOME} $(pwd)
+	2>/dev/null x=1 export echo /usr/bin | 'quoted text' test echo cd "$1" printf test
+"$1" x=1 "$@" done local printf grep "$1" then
+		2>/dev/null done sed "$1" ${HOME} --verbose 2>/dev/null /usr/bin awk ${HOME} | readonly
+	$(pwd) -eu "$@" /usr/bin export /usr/bin /usr/bin 'quoted text' awk awk echo &&
+		&& export $(pwd) test ${HOME} local $(pwd)
+		grep awk "$1" cd grep ${HOME} readonly readonly export export cd | -eu
+	--verbose readonly printf test export 2>/dev/null /usr/bin
+		local grep done $(pwd) 2>/dev/null --verbose export
+	printf sed 'quoted text' awk awk -eu test readonly awk local awk --verbose printf
+	then /usr/bin /usr/bin sed done awk
+		| local grep "$1" export awk && -eu
+	x=1 grep "$@" export "$@"
+-eu readonly $(pwd) done grep --verbose -eu 2>/dev/null sed local awk local then
+		--verbose -eu /usr/bin 2>/dev/null --verbose done 'quoted text' printf
+		-eu printf readonly grep printf
+		&& 'quoted text' --verbose
+${HOME} sed done --verbose readonly --verbose
+	local ${HOME} export sed local grep 'quoted text' cd | -eu && | cd cd
+	export echo && /usr/bin done export echo test 2>/dev/null then then local 2>/dev/null
+		2>/dev/null readonly /usr/bin $(pwd) "$1" 'quoted text' x=1 "$1"
+	--verbose && "$@" --verbose awk readonly test printf && -eu readonly awk --verbose
+		then local "$@" test awk cd echo export sed printf /usr/bin ${HOME}
+	printf --verbose awk done "$1" then "$1" "$@" --verbose
+	test readonly /usr/bin then 2>/dev/null "$@" 'quoted text'
+	'quoted text' grep $(pwd)
+test && && --verbose x=1 ${HOME} -eu /usr/bin done local echo test grep awk sed
+		2>/dev/null $(pwd) && x=1 x=1 sed test awk
+	${HOME} readonly ${HOME} export grep test
+printf cd local $(pwd)
+	$(pwd) -eu export awk "$@" 2>/dev/null
+		x=1 awk && grep "$1" readonly export && test
+	printf test test 'quoted text' $(pwd) ${HOME} x=1 'quoted text'
+		awk --verbose test | x=1 /usr/bin
+/usr/bin | then --verbose "$@" $(pwd) "$@" printf --verbose --verbose
+	2>/dev/null sed x=1 && printf /usr/bin "$@" sed echo local export x=1 export 2>/dev/null
+	export -eu export sed "$@"
+--verbose readonly x=1 test --verbose 2>/dev/null then awk "$@"
+grep -eu then "$@" --verbose export sed ${HOME} awk | grep 'quoted text'
+| awk -eu test "$@" readonly -eu /usr/bin done
+sed --verbose local "$@" ${HOME} then echo ${HOME} ${HOME}
+		x=1 cd /usr/bin printf "$@" x=1 | grep ${HOME}
+done -eu local -eu test /usr/bin
+		x=1 "$@" ${HOME} ${HOME} sed printf
+		then awk --verbose x=1 export echo ${HOME} awk && --verbose readonly
+		local $(pwd) | ${HOME} export printf --verbose grep "$@" $(pwd)
+	readonly "$@" test local && --verbose | "$1" && -eu readonly | sed grep /usr/bin
+$(pwd) cd local then --verbose done awk test printf sed "$1" readonly
+		x=1 x=1 -eu && test && test export "$1" readonly
+		$(pwd) readonly then --verbose 2>/dev/null "$@" echo awk -eu printf awk --verbose
+	export ${HOME} printf 2>/dev/null echo | ${HOME}
+--verbose 'quoted text' cd /usr/bin -eu
+	| test | ${HOME} | export test ${HOME}
+"$@" local -eu "$@" grep export "$1" sed then /usr/bin | "$1" done 'quoted text'
+		&& && sed -eu "$1" --verbose && /usr/bin local /usr/bin readonly | -eu
+$(pwd) 2>/dev/null grep x=1 x=1 -eu awk 'quoted text' -eu ${HOME} -eu
+then printf awk awk | local awk "$@" awk test
+	printf test test 'quoted text'
+	2>/dev/null 2>/dev/null /usr/bin then export test /usr/bin | cd
+		printf export --verbose 'quoted text' -eu x=1 'quoted text'
+test sed | cd | printf ${HOME} export && printf --verbose 2>/dev/null
+test echo grep grep done | && /usr/bin "$1" grep
+		${HOME} printf && readonly
+--verbose grep ${HOME} done printf sed printf | cd printf
+	/usr/bin local export && 2>/dev/null
+		sed printf cd printf cd | --verbose --verbose "$1" export local $(pwd) $(pwd)
+	done cd /usr/bin echo 2>/dev/null 'quoted text'
+		--verbose done --verbose export $(pwd) $(pwd) echo ${HOME}
+		sed grep "$1" ${HOME} ${HOME} && && local grep "$1" $(pwd)
+	sed | awk grep /usr/bin "$@"
+	sed ${HOME} 'quoted text' |
+		&& && --verbose then echo export done x=1 done grep awk "$1" | 2>/dev/null
+echo echo ${HOME} /usr/bin
+$(pwd) printf export readonly /usr/bin && test readonly done
+		&& --verbose sed $(pwd) 'quoted text' echo test 'quoted text' | --verbose ${HOME}
+	| ${HOME} "$1" -eu 2>/dev/null /usr/bin /usr/bin readonly && done
+echo "$1" then "$1" --verbose |
+	"$@" cd cd "$@" awk "$1" "$1" readonly cd then /usr/bin --verbose --verbose x=1
+"$@" "$@" test && 2>/dev/null
+echo -eu /usr/bin | then cd export awk grep test echo
+	local ${HOME} sed awk "$@" local 2>/dev/null $(pwd) /usr/bin local
+	&& grep echo 2>/dev/null then -eu printf local cd --verbose grep sed | /usr/bin
+		--verbose && x=1 printf $(pwd) "$1" -eu then sed grep x=1 x=1 local && $(pwd)
+	local 2>/dev/null 'quoted text' 2>/dev/null
+	echo -eu printf ${HOME} awk "$@" /usr/bin
+/usr/bin grep echo cd awk done test local
+		readonly cd 2>/dev/null
+	/usr/bin && echo $(pwd) 'quoted text' grep test /usr/bin done local
+		grep ${HOME} test 2>/dev/null echo done 'quoted text' done awk --verbose
+		"$@" readonly && export ${HOME}
+		"$1" 2>/dev/null awk sed done 'quoted text'
+		then $(pwd) "$@" test 2>/dev/null grep
+	x=1 done "$@" | ${HOME} done printf
+		then "$@" $(pwd) "$1" ${HOME} local done -eu awk 'quoted text'
+x=1 ${HOME} done 2>/dev/null export | echo then && readonly
+awk "$1" --verbose test then done then cd
+"$@" ${HOME} /usr/bin test /usr/bin printf
+		--verbose sed "$1" $(pwd) sed printf && printf done printf "$@" awk export "$1"
+'quoted text' local && x=1 /usr/bin /usr/bin test $(pwd) awk /usr/bin done /usr/bin
+"$@" local cd 'quoted text' $(pwd) done
+	sed "$@" cd awk | readonly test local sed printf "$1" echo cd 2>/dev/null test
+	$(pwd) echo awk export printf --verbose awk /usr/bin grep ${HOME}
+	readonly readonly test readonly --verbose
+		then test test "$1" /usr/bin
+then local test test local cd 2>/dev/null | printf "$@" --verbose
+		local 'quoted text' awk readonly cd done awk ${HOME} 'quoted text'
+cd x=1 2>/dev/null cd export /usr/bin awk x=1 /usr/bin | /usr/bin |
+		done sed --verbose $(pwd) /usr/bin printf 'quoted text' sed -eu 2>/dev/null
+		${HOME} local 2>/dev/null echo --verbose && readonly --verbose /usr/bin
+	export export export 2>/dev/null then "$1" 'quoted text'
+		export echo test sed grep "$1" $(pwd) x=1 readonly
+grep test then awk x=1 && test echo done | printf
+cd grep grep test $(pwd) --verbose test sed readonly $(pwd)
+	2>/dev/null awk test sed --verbose
+		awk readonly readonly | /usr/bin sed 'quoted text' 2>/dev/null cd
+	-eu ${HOME} echo test | | test test x=1 "$@" echo done "$1" && test
+	echo then sed | ${HOME} then sed readonly | export test 'quoted text'
+x=1 ${HOME} then local export awk echo readonly test "$1" local echo test
+readonly awk | && | x=1 -eu "$1" sed --verbose /usr/bin printf && done
+"$1" | $(pwd) test -eu then /usr/bin
+		/usr/bin test "$@" ${HOME} done echo awk 'quoted text' cd readonly
+		/usr/bin export "$@" x=1 then
+/usr/bin local sed -eu done $(pwd) && done awk x=1 2>/dev/null cd local --verbose
+	&& /usr/bin awk grep --verbose done test
+		then grep local then awk test sed then grep --verbose readonly 'quoted text'
+		${HOME} 2>/dev/null cd
+		echo /usr/bin cd --verbose export local x=1 readonly 2>/dev/null export echo
+		cd local ${HOME} /usr/bin done sed
+		done 'quoted text' ${HOME} then grep sed --verbose
+&& $(pwd) --verbose "$1" $(pwd) then x=1 x=1
+"$1" --verbose export $(pwd) then -eu grep
+x=1 awk "$@" 'quoted text' readonly readonly ${HOME} "$@" awk "$1" awk awk done
+		printf 'quoted text' cd x=1
+		$(pwd) 2>/dev/null test printf printf "$@" printf echo cd cd
+		awk 2>/dev/null sed grep x=1 then 'quoted text' readonly local then ${HOME}
+| done /usr/bin grep then export x=1
+	sed echo $(pwd) awk sed test cd readonly /usr/bin
+		echo then "$@" sed 'quoted text' echo cd -eu "$1" x=1 /usr/bin
+	local /usr/bin && --verbose local echo grep export readonly "$1"
+	test printf export printf export x=1 then then
+grep local printf /usr/bin && -eu test "$@" readonly --verbose
+	sed export -eu grep $(pwd) x=1 2>/dev/null "$@" readonly ${HOME}
+sed readonly then /usr/bin
+		printf sed cd 2>/dev/null awk printf 'quoted text' then then "$@"
+cd --verbose -eu 'quoted text' grep test x=1 ${HOME} ${HOME} sed --verbose
+		printf "$@" $(pwd) -eu done "$1" then done grep then $(pwd) x=1 --verbose
+/usr/bin local done --verbose export x=1 2>/dev/null $(pwd) /usr/bin
+		&& x=1 echo -eu export "$1" echo awk then 'quoted text'
+	| -eu export awk --verbose /usr/bin
+	'quoted text' $(pwd) 'quoted text'
+		cd ${HOME} then then printf -eu 'quoted text'
+		/usr/bin cd ${HOME} done awk then local done ${HOME} then
+		sed cd sed export x=1 -eu x=1 'quoted text' | echo export readonly awk
+		${HOME} "$@" test && echo && -eu sed awk done
+| cd 'quoted text' 2>/dev/null "$1" x=1 ${HOME} 'quoted text'
+		sed 'quoted text' printf
+		awk echo "$@" -eu ${HOME} && printf "$@" awk sed then echo -eu /usr/bin
+--verbose printf "$@" | /usr/bin sed x=1 local printf sed then
+		export awk then test ${HOME} done awk 2>/dev/null echo grep 2>/dev/null
+	readonly 2>/dev/null echo done local --verbose test awk sed
+		| sed cd export 'quoted text' ${HOME} echo cd
+		--verbose ${HOME} export 'quoted text' "$@" /usr/bin --verbose test grep
+		| ${HOME} --verbose done
+local && grep then cd sed -eu -eu cd test x=1 test ${HOME} --verbose export
+		echo test printf sed sed $(pwd) | cd 2>/dev/null
+	export && printf && ${HOME}
+printf echo 'quoted text' awk && sed 'quoted text' ${HOME} ${HOME} --verbose
+| sed done done /usr/bin test export awk | $(pwd) grep
+	&& $(pwd) 'quoted text' export test export export
+grep | test ${HOME} "$1" 2>/dev/null
+then printf | "$@" readonly test printf ${HOME} then done 2>/dev/null
+	/usr/bin /usr/bin test cd export 2>/dev/null "$1" | 2>/dev/null local cd
+		echo then | local grep test sed readonly done x=1 /usr/bin
+'quoted text' sed done -eu /usr/bin 2>/dev/null
+	/usr/bin awk test --verbose done done &&
+	"$1" local ${HOME} export /usr/bin
+		awk export --verbose grep "$1" awk && 'quoted text' local
+		printf && export --verbose done && local ${HOME} sed --verbose printf x=1
+	test && sed export ${HOME}
+	/usr/bin then local grep export 2>/dev/null
+--verbose readonly export
+$(pwd) $(pwd) done && export local 2>/dev/null /usr/bin && readonly
+		test x=1 $(pwd) 'quoted text' readonly x=1 grep | 2>/dev/null
+grep readonly grep "$@" 'quoted text' cd then local grep --verbose readonly
+	"$@" echo ${HOME} $(pwd) && --verbose then awk "$1" done -eu
+echo | -eu local 'quoted text'
+	then export cd echo /usr/bin -eu printf 'quoted text' cd grep "$1"
+	'quoted text' grep export test echo "$@"
+export x=1 -eu done sed --verbose "$@" --verbose
+	&& awk -eu --verbose --verbose ${HOME} cd 'quoted text' done && "$@"
+	"$1" grep sed local 'quoted text' awk done -eu test "$1" export
+done -eu && $(pwd) readonly local /usr/bin export "$1" export
+sed ${HOME} x=1 cd $(pwd) grep /usr/bin sed awk test
+		printf cd done "$1" x=1 then printf "$1" 2>/dev/null grep
+		${HOME} export --verbose && | 'quoted text' | ${HOME} "$1" /usr/bin
+		| 'quoted text' test cd "$1" grep done grep 'quoted text'
+	$(pwd) done /usr/bin then 2>/dev/null
+	then grep 2>/dev/null x=1 done 2>/dev/null && cd local export
+		then /usr/bin done 2>/dev/null x=1 "$@"
+${HOME} echo echo then x=1 "$@" 'quoted text'
+export sed "$1" 'quoted text' 'quoted text'
+	'quoted text' grep $(pwd)
+	&& 'quoted text' test $(pwd)
+		| printf printf --verbose && local
+		"$1" export 2>/dev/null
+	grep $(pwd) echo done local awk cd && "$@"
+test /usr/bin --verbose --verbose export test ${HOME} local test printf
+sed test echo printf grep sed -eu done x=1 'quoted text'
+"$1" printf grep --verbose
+&& test 'quoted text' --verbose /usr/bin cd printf grep then grep ${HOME}
+	test readonly ${HOME} | printf awk $(pwd) $(pwd) sed "$@" done $(pwd)
+		grep sed printf then /usr/bin $(pwd) | done cd export
+${HOME} export grep local echo 2>/dev/null echo ${HOME} cd
+	"$@" /usr/bin --verbose $(pwd) cd then && --verbose
+	local done | "$1" readonly echo
+		sed grep ${HOME} cd && | 2>/dev/null test | echo readonly "$1" | awk
+	then readonly | local cd $(pwd)
+	/usr/bin local | 2>/dev/null
+		readonly local local echo echo "$@" readonly printf
+		x=1 done x=1 ${HOME} "$1" then done grep test export grep 2>/dev/null
+	"$1" test /usr/bin 2>/dev/null /usr/bin readonly -eu "$@" 'quoted text' test done
+"$@" -eu sed echo readonly
+	sed then export 2>/dev/null
+		test echo sed "$1" && "$1" echo sed awk ${HOME} "$1" test 2>/dev/null readonly
+		sed x=1 2>/dev/null 'quoted text'
+	'quoted text' -eu echo cd "$1" local
+echo export sed | done | "$@" /usr/bin local then then done -eu local grep
+	echo then && done && echo $(pwd) done printf
+	sed sed grep local test 'quoted text' cd test
+	local awk printf local && x=1 -eu local 2>/dev/null
+x=1 $(pwd) "$1" sed /usr/bin 2>/dev/null x=1 readonly "$@" ${HOME} export
+echo test readonly sed x=1 "$1" /usr/bin readonly /usr/bin
+test export | awk "$1" awk | 'quoted text'
+		printf readonly x=1 export export -eu -eu 2>/dev/null | local -eu export
+	printf readonly x=1 -eu ${HOME} 'quoted text' test -eu 2>/dev/null export
+	awk echo printf --verbose local --verbose printf ${HOME} | ${HOME}
+	--verbose /usr/bin $(pwd) readonly --verbose readonly printf --verbose
+	2>/dev/null sed ${HOME} "$@" readonly | test $(pwd) grep cd && test 2>/dev/null
+&& local local local test awk readonly /usr/bin readonly "$1"
+		local --verbose awk cd "$@" export export -eu readonly
+sed /usr/bin readonly "$1" "$1" cd awk ${HOME} readonly
+readonly then cd 2>/dev/null printf &&
+		grep --verbose echo then "$1" echo cd --verbose 'quoted text' printf printf
+	/usr/bin | | local 2>/dev/null awk printf "$@"
+echo grep readonly grep test awk | awk "$@" test printf
+		echo printf /usr/bin --verbose then export 2>/dev/null test
+	grep done test "$1" sed | --verbose printf readonly test /usr/bin
+${HOME} 'quoted text' --verbose cd export test echo cd | x=1 --verbose
+		"$1" /usr/bin ${HOME} && 2>/dev/null cd cd readonly local readonly export
+local awk grep grep cd cd 'quoted text'
+		echo then "$1" 2>/dev/null test 2>/dev/null
+grep test grep grep local test then
+test /usr/bin done --verbose "$1" && awk then ${HOME} sed x=1 'quoted text'
+awk grep --verbose $(pwd) echo test
+		done done 'quoted text' -eu test
+	| "$1" local awk 'quoted text' grep test /usr/bin && echo awk $(pwd) grep
+awk 'quoted text' cd
+	'quoted text' then $(pwd) x=1 done 2>/dev/null
+		-eu printf echo printf
+	awk echo 2>/dev/null /usr/bin then grep "$1" grep printf grep $(pwd)
+"$1" /usr/bin export /usr/bin test sed x=1 sed "$1" echo 2>/dev/null "$@"
+readonly --verbose grep then && | -eu awk export x=1 'quoted text' echo echo 'quoted text'
+x=1 sed test local echo
+	--verbose && then sed 2>/dev/null then sed 2>/dev/null awk 2>/dev/null sed $(pwd)
+	${HOME} -eu sed grep printf | export
+	grep 'quoted text' test
+		| -eu test /usr/bin && 'quoted text' awk "$@" local cd done
+		readonly --verbose --verbose grep export then "$@" x=1 export
+		x=1 sed "$1" then --verbose
+	"$1" 'quoted text' && local
+x=1 | "$1" grep 'quoted text' awk readonly test sed local --verbose test
+	| export 'quoted text' /usr/bin local readonly -eu grep |
+		--verbose | $(pwd) then "$@" then -eu grep cd then then "$@"
+sed printf --verbose $(pwd) done x=1 cd /usr/bin test done
+readonly | awk -eu /usr/bin
+	echo then -eu grep printf done && && --verbose export 'quoted text'
+2>/dev/null then && --verbose grep "$1" $(pwd)
+		awk -eu printf grep cd printf "$@" "$@" readonly 2>/dev/null "$1" /usr/bin
+	2>/dev/null sed /usr/bin /usr/bin /usr/bin readonly | "$@"
+local cd | 'quoted text' /usr/bin
+readonly $(pwd) sed | printf 2>/dev/null cd x=1 readonly
+	cd && ${HOME} awk then --verbose local test grep x=1 done --verbose
+	echo printf 'quoted text' readonly local /usr/bin && /usr/bin "$@" cd | 2>/dev/null
+/usr/bin /usr/bin ${HOME} 'quoted text' 2>/dev/null ${HOME}
+		| | export --verbose readonly local x=1 | ${HOME} echo readonly
+cd local export grep readonly "$@" readonly "$@"
+		| test readonly sed "$1" &&
+export ${HOME} sed "$@" export done
+		$(pwd) awk ${HOME} && 'quoted text' export
+		&& 2>/dev/null printf "$@" -eu then grep /usr/bin export | echo test done export
+		sed $(pwd) printf x=1 && echo | | /usr/bin "$1" grep
+		| | | echo printf sed readonly awk echo $(pwd) sed "$1" &&
+		| && cd sed 2>/dev/null
+	x=1 2>/dev/null cd done cd 'quoted text' 'quoted text' 'quoted text'
+		grep test cd "$@" then "$1" cd --verbose
+		2>/dev/null -eu cd printf
+		"$@" sed --verbose -eu --verbose
+'quoted text' echo --verbose x=1 && echo "$1" x=1 then then
+	'quoted text' export && $(pwd) cd grep 2>/dev/null
+	-eu "$1" test /usr/bin echo readonly printf
+	2>/dev/null done local --verbose $(pwd)
+	'quoted text' awk grep
+	"$@" -eu $(pwd) | "$1" then export grep export printf then local awk x=1 ${HOME}
+	2>/dev/null && "$@" cd printf awk
+		"$@" -eu grep awk export done echo /usr/bin
+	export local "$@" local export awk local 'quoted text' readonly
+		"$@" sed "$@" | cd 2>/dev/null x=1
+	printf "$1" awk readonly ${HOME} x=1 sed readonly printf printf readonly
+		export export /usr/bin
+	done -eu | local $(pwd) ${HOME} ${HOME} /usr/bin
+		export -eu echo sed cd then test /usr/bin
+	x=1 $(pwd) then x=1 sed "$@" -eu && "$@" export && done export -eu $(pwd)
+		awk local "$1" -eu awk export && "$@" readonly printf echo ${HOME} &&
+		$(pwd) "$@" test grep "$@" readonly local && grep -eu readonly
+		test --verbose then /usr/bin local grep -eu then echo echo ${HOME} "$@" echo then
+/usr/bin ${HOME} "$@" -eu && "$1" readonly -eu done x=1 2>/dev/null then readonly
+		printf && printf grep printf cd local local && cd grep
+		echo echo $(pwd) "$@" ${HOME} cd grep awk sed test --verbose grep 2>/dev/null
+	test x=1 2>/dev/null then sed export 2>/dev/null 2>/dev/null
+		/usr/bin 2>/dev/null grep
+	printf 2>/dev/null then awk readonly --verbose export "$1"
+		x=1 done awk 'quoted text'
+	cd x=1 2>/dev/null then x=1 'quoted text' | ${HOME}
+	| then $(pwd) 'quoted text' grep readonly done export 2>/dev/null -eu local
+grep done x=1 sed grep local && --verbose --verbose $(pwd) /usr/bin
+	readonly | ${HOME} ${HOME} printf ${HOME} done ${HOME}
+		-eu sed cd 'quoted text' --verbose "$@" export "$1"
+	local /usr/bin export /usr/bin export -eu then 2>/dev/null && grep test "$@" -eu
+		test done done 'quoted text' local cd /usr/bin grep $(pwd) printf local
+		readonly | cd 'quoted text' "$@" sed readonly grep test &&
+		sed -eu done "$@" $(pwd) awk | test && printf
+	cd "$@" grep printf cd cd --verbose printf printf ${HOME}
+	export /usr/bin awk --verbose
+	&& x=1 x=1 --verbose sed "$1" && cd echo && $(pwd) /usr/bin cd
+		grep "$@" done grep readonly -eu then && $(pwd) /usr/bin done "$1"
+	readonly -eu 'quoted text'
+	test -eu /usr/bin then ${HOME} export "$1" | then "$@" --verbose --verbose
+done echo done $(pwd) | test --verbose && then "$1"
+x=1 cd test "$@" "$1" "$1" done
+		printf test x=1 readonly && "$@" done $(pwd) echo test
+	readonly x=1 $(pwd) sed local readonly
+$(pwd) readonly 2>/dev/null $(pwd) grep | echo
+		local --verbose 'quoted text' "$@" printf done -eu echo sed then readonly
+		$(pwd) local test /usr/bin
+		$(pwd) 2>/dev/null cd local "$@" ${HOME} /usr/bin export && local
+	/usr/bin echo | export export 'quoted text' "$1" 2>/dev/null done
+	echo | grep printf sed --verbose then local 2>/dev/null
+		-eu test 'quoted text' "$1" cd 'quoted text' 'quoted text' -eu x=1 /usr/bin
+		-eu $(pwd) | x=1 'quoted text'
+		'quoted text' 2>/dev/null | grep echo && 2>/dev/null printf
+		printf test "$1" awk printf then cd "$1" | x=1 awk
+	then /usr/bin $(pwd) readonly sed test printf "$@"
+	readonly printf grep local $(pwd) --verbose echo ${HOME} cd "$1" -eu "$1" cd export
+test done echo grep "$1" "$1" /usr/bin -eu
+	cd "$1" done "$1" && grep 'quoted text' x=1 --verbose export sed readonly | grep
+"$@" "$@" && cd export ${HOME}
+		then sed echo x=1 $(pwd) awk && --verbose readonly "$@" done 2>/dev/null x=1
+	$(pwd) echo test 2>/dev/null 2>/dev/null
+		| $(pwd) -eu x=1 cd cd then x=1 cd && x=1
+done $(pwd) done 'quoted text' /usr/bin | | cd /usr/bin
+grep test then echo 'quoted text'
+		&& | test test printf /usr/bin x=1 ${HOME}
+	| readonly -eu test "$1" done 2>/dev/null
+		${HOME} echo "$@" $(pwd) export "$1" done done then sed x=1 printf | /usr/bin
+	"$1" then export x=1 sed sed then sed $(pwd) x=1 awk /usr/bin readonly | printf
+	"$@" "$@" | echo readonly 'quoted text' 'quoted text'
+	| echo $(pwd) readonly 2>/dev/null echo x=1 && echo printf
+-eu readonly $(pwd) test 'quoted text' | cd done | local -eu
+		2>/dev/null 2>/dev/null -eu done export then
+		readonly done "$@" | x=1 readonly -eu --verbose printf
+done local "$1" 'quoted text' 'quoted text' export
+${HOME} -eu grep cd then done && ${HOME}
+2>/dev/null done export --verbose
+		'quoted text' 'quoted text' 2>/dev/null
+	test grep awk done echo ${HOME} --verbose local && "$1" -eu && export
+x=1 then 2>/dev/null printf printf local echo /usr/bin cd /usr/bin 2>/dev/null
+		--verbose 2>/dev/null |
+	| "$1" local sed test grep "$@" awk awk && | then x=1
+	local -eu $(pwd) --verbose readonly grep ${HOME} 2>/dev/null local /usr/bin
+		$(pwd) "$@" "$1" $(pwd) grep sed | readonly --verbose && awk test ${HOME}
+		export echo echo cd 'quoted text' then local | done then test
+| echo 2>/dev/null export printf x=1
+| && sed awk readonly --verbose sed done
+	${HOME} $(pwd) | x=1 grep --verbose readonly local "$@"
+local done printf grep
+	&& readonly 2>/dev/null --verbose local printf
+	$(pwd) $(pwd) 2>/dev/null sed printf
+--verbose then echo then local | && | readonly readonly sed then
+"$@" $(pwd) done then /usr/bin -eu grep echo "$1" $(pwd) grep x=1 sed local 2>/dev/null
+	| x=1 x=1 -eu /usr/bin &&
+	"$@" /usr/bin local "$@" then printf
+then && done 2>/dev/null | awk grep && readonly 2>/dev/null echo 'quoted text'
+	x=1 'quoted text' && echo test "$@"
+		"$1" awk printf local done sed 'quoted text' ${HOME} cd test "$1"
+		local printf ${HOME} --verbose -eu then done done readonly 'quoted text' --verbose
+grep 2>/dev/null printf printf readonly
+local -eu grep 'quoted text' --verbose cd grep echo printf echo "$@" printf /usr/bin
+		done readonly && --verbose cd local 'quoted text' "$@" test local
+		printf -eu ${HOME} readonly local printf 2>/dev/null --verbose | "$1" printf
+printf done local "$@" 'quoted text'
+	grep grep | export 'quoted text' readonly local readonly echo && then done
+	-eu test 'quoted text' then done printf -eu local ${HOME} x=1
+		/usr/bin done done "$@"
+	sed --verbose test test then $(pwd) ${HOME} 'quoted text' echo done
+	-eu && grep --verbose echo x=1 then export ${HOME}
+		--verbose printf cd 2>/dev/null grep local | then ${HOME} --verbose grep
+		sed done sed "$@" grep 2>/dev/null local $(pwd)
+	export then then grep --verbose export printf $(pwd)
+$(pwd) awk done 'quoted text' then readonly 2>/dev/null
+		2>/dev/null sed $(pwd) sed sed done 2>/dev/null /usr/bin -eu
+	"$@" | printf readonly then
+	export cd sed done -eu cd "$1" $(pwd) grep sed test printf
+		"$@" grep grep | cd awk 'quoted text' then done test grep done sed
+x=1 --verbose echo sed -eu test sed ${HOME} readonly
+		test awk x=1 /usr/bin "$1"
+		'quoted text' $(pwd) x=1 ${HOME}
+printf && then echo sed -eu | -eu "$@" sed then printf awk cd sed grep test ${HOME}
+	&& awk "$@" | export | "$@" ${HOME} sed /usr/bin "$1" readonly 2>/dev/null
+local | 'quoted text' 'quoted text'
+		"$1" && "$@" awk ${HOME} "$@" "$@" then
+test test $(pwd) printf
+2>/dev/null done /usr/bin printf cd
+		2>/dev/null 'quoted text' /usr/bin "$@" local
+		&& awk grep readonly -eu --verbose
+'quoted text' --verbose --verbose local | sed readonly ${HOME} x=1 echo
+then /usr/bin sed grep
+		export 'quoted text' readonly cd "$1" x=1 && 'quoted text'
+export then "$@" then grep 'quoted text' && test ${HOME}
+		--verbose "$@" 2>/dev/null done cd ${HOME} then export
+		cd done done echo export $(pwd) "$1"
+		printf -eu cd local printf $(pwd)
+	printf | sed sed && x=1 | --verbose export "$@"
+echo -eu /usr/bin ${HOME} done ${HOME}
+test printf "$@" "$1" export local
+	export export printf -eu then "$1" ${HOME}
+	awk sed --verbose then -eu grep grep -eu --verbose && cd 2>/dev/null awk done
+	-eu $(pwd) test | awk 'quoted text' test export -eu export
+grep /usr/bin ${HOME} && --verbose printf printf x=1 readonly && readonly
+	"$@" /usr/bin export done cd -eu echo ${HOME}
+readonly echo grep 'quoted text' $(pwd) awk "$@"
+		"$@" export -eu test grep test x=1 $(pwd) done then printf export cd readonly
+	echo 'quoted text' cd cd cd printf && export x=1 awk 2>/dev/null
+		local echo && --verbose test awk "$@"
+	| awk awk readonly awk && && -eu readonly x=1 "$1"
+'quoted text' "$@" x=1 then $(pwd)
+| 'quoted text' awk readonly
+	-eu printf awk printf echo echo local export "$@" 2>/dev/null cd
+then "$1" local cd ${HOME} grep
+2>/dev/null --verbose 2>/dev/null x=1 printf | -eu cd 2>/dev/null ${HOME} local
+local local -eu sed "$1" export
+		printf local ${HOME} export cd | 2>/dev/null | then 2>/dev/null awk printf |
+	-eu -eu --verbose $(pwd)
+		local local "$1" sed -eu
+awk grep export done then done grep x=1 printf sed local awk x=1 export export
+"$@" ${HOME} readonly x=1 then ${HOME} | then local && | 2>/dev/null cd
+awk $(pwd) x=1 "$@" --verbose --verbose "$1" local "$@" awk --verbose
+	--verbose "$@" grep then "$@" test
+		--verbose 'quoted text' grep "$@"
+then printf test --verbose
+${HOME} test | && ${HOME} $(pwd) --verbose --verbose x=1 "$@" done then | done
+	2>/dev/null test 'quoted text'
+	grep && /usr/bin echo then then
+		x=1 ${HOME} done test test grep printf "$1" then 2>/dev/null
+export && 'quoted text' "$1" readonly sed sed awk 2>/dev/null printf
+		${HOME} grep done then done local --verbose --verbose
+		awk /usr/bin sed printf /usr/bin readonly "$@" local
+		echo then 2>/dev/null awk cd sed test then test "$@" 2>/dev/null -eu cd $(pwd)
+2>/dev/null ${HOME} readonly done "$1"
+		"$1" echo readonly && -eu echo awk
+	--verbose --verbose "$1" ${HOME} -eu then readonly 2>/dev/null export
+${HOME} cd grep "$@" x=1 2>/dev/null && --verbose && test
+&& ${HOME} -eu x=1 cd && test awk
+		export printf 'quoted text' ${HOME} sed test test then |
+test --verbose done echo echo --verbose grep sed local $(pwd)
+then /usr/bin printf 2>/dev/null /usr/bin x=1 ${HOME} grep printf --verbose
+-eu x=1 x=1 ${HOME} sed --verbose printf then x=1 export x=1 --verbose
+	/usr/bin awk ${HOME} | export ${HOME} done "$1" cd x=1 ${HOME} x=1
+	sed -eu test awk "$@" "$@" "$@" ${HOME} $(pwd)
+then local readonly x=1 $(pwd) $(pwd) && echo
+	grep readonly done echo awk cd printf $(pwd) -eu local test && then awk readonly
+$(pwd) test -eu local --verbose "$@" test -eu 2>/dev/null sed export sed echo "$1"
+		sed test echo "$1" $(pwd) | echo $(pwd)
+		'quoted text' x=1 | awk 'quoted text' && awk 2>/dev/null
+	printf | 2>/dev/null x=1 'quoted text'
+"$1" ${HOME} | sed printf done
+'quoted text' /usr/bin
+2>/dev/null local x=1 'quoted text' printf test 'quoted text' printf | sed x=1
+x=1 readonly 'quoted text' sed $(pwd) done export | test x=1 | test 2>/dev/null
+&& local "$@" awk /usr/bin "$@" readonly "$@" x=1 2>/dev/null cd 'quoted text'
+	/usr/bin | --verbose $(pwd) echo
+sed 'quoted text' then -eu ${HOME} sed && cd x=1 printf local printf
+	export awk 2>/dev/null --verbose 'quoted text' sed readonly done $(pwd)
+		/usr/bin -eu "$@" --verbose x=1 sed /usr/bin
+	echo $(pwd) 2>/dev/null 2>/dev/null && 'quoted text'
+	$(pwd) done test awk && $(pwd) readonly awk && cd readonly ${HOME}
+sed grep cd "$@" then printf x=1 local grep then test ${HOME} done
+cd then then 2>/dev/null test ${HOME} /usr/bin -eu "$1" grep "$@"
+		export -eu cd /usr/bin local echo cd x=1 ${HOME} -eu export printf
+	awk export awk sed echo test done "$1" printf /usr/bin printf ${HOME}
+		local 2>/dev/null "$1" then --verbose | "$1" 2>/dev/null 'quoted text' echo | test
+		awk 'quoted text' test /usr/bin echo
+	printf cd echo --verbose done
+	cd export readonly "$1" 2>/dev/null grep 'quoted text' grep -eu x=1 "$@" cd
+local export export 'quoted text' --verbose grep | printf
+export ${HOME} test then grep --verbose
+	local 'quoted text' --verbose printf done test sed test -eu echo "$1" then test
+		export export 2>/dev/null
+		sed done then sed export --verbose -eu | ${HOME}
+		2>/dev/null $(pwd) 2>/dev/null awk --verbose && awk echo 'quoted text'
+printf awk grep | 2>/dev/null local --verbose
+	x=1 local "$@" done sed
+readonly 'quoted text' test /usr/bin 'quoted text' local "$@"
+	awk && export /usr/bin ${HOME} local ${HOME} readonly --verbose ${HOME}
+| done /usr/bin "$1" $(pwd) sed sed sed printf local ${HOME} x=1
+	/usr/bin export test "$@" sed $(pwd) "$1"
+--verbose done test /usr/bin /usr/bin | grep | --verbose export
+echo 2>/dev/null "$1" sed | ${HOME} 'quoted text'
+	"$@" readonly export test cd then then then grep
+2>/dev/null grep grep grep awk --verbose then "$@" readonly
+		'quoted text' test done 2>/dev/null $(pwd)
+"$@" | export "$@" 'quoted text' cd --verbose x=1 && /usr/bin echo
+echo x=1 && then "$1" --verbose "$1"
+-eu grep cd local done echo
+sed -eu test echo awk local /usr/bin | sed "$@" cd sed $(pwd) awk test
+		local ${HOME} export ${HOME} 2>/dev/null cd export | | "$@" x=1 readonly
+	"$@" $(pwd) echo && -eu sed && local | "$1" ${HOME} "$1" --verbose -eu readonly
+x=1 -eu grep then done grep 'quoted text' && --verbose ${HOME} sed "$@" printf
+	readonly --verbose awk awk sed x=1 grep local "$@" echo then /usr/bin
+grep "$1" test test sed grep /usr/bin printf sed | done $(pwd)
+done --verbose grep 'quoted text' grep export test
+	${HOME} readonly $(pwd) ${HOME} awk -eu then local echo test "$1"
+	awk -eu $(pwd) sed done
+		echo 2>/dev/null sed readonly
+		awk printf "$1" echo echo | "$1" sed /usr/bin
+	awk awk --verbose 2>/dev/null 2>/dev/null
+sed grep echo -eu awk then && --verbose
+	sed 'quoted text' printf "$1" printf
+		$(pwd) export && local echo
+${HOME} sed 'quoted text' readonly then awk grep
+		then done done ${HOME} local | "$@" "$@" $(pwd) 2>/dev/null
+		/usr/bin /usr/bin grep x=1 x=1 /usr/bin test grep sed export export local
+"$1" test echo 'quoted text' cd grep ${HOME} echo | awk grep export "$@" -eu then
+	"$1" cd x=1 2>/dev/null --verbose 2>/dev/null
+grep | cd /usr/bin done sed "$@" readonly 2>/dev/null done then awk
+		awk grep grep local grep cd done cd echo
+	"$@" awk echo -eu --verbose x=1 grep
+		then 'quoted text' test --verbose "$1" done echo /usr/bin ${HOME}
+		"$1" local --verbose then | 2>/dev/null test --verbose done x=1 echo -eu echo
+printf test done "$1" 2>/dev/null --verbose -eu
+	&& printf -eu then readonly local
+		sed local $(pwd) && && awk cd grep then done
+	--verbose printf sed grep sed && done cd /usr/bin awk done "$@" sed awk local
+local --verbose sed ${HOME} done cd
+printf "$@" "$@" 2>/dev/null | "$@" -eu printf 'quoted text' 2>/dev/null
+		x=1 ${HOME} "$1" $(pwd) export | cd local
+	x=1 then --verbose readonly ${HOME} "$1" cd x=1 local
+test echo x=1 sed ${HOME} --verbose
+cd grep /usr/bin --verbose export x=1 printf -eu done $(pwd)
+	sed "$@" "$@" $(pwd) local "$1" "$1" sed echo && 'quoted text' sed ${HOME}
+		done && | 'quoted text' "$1" /usr/bin test &&
+	printf "$1" cd sed grep "$@" ${HOME} printf $(pwd) readonly export export
+sed echo && $(pwd) cd sed "$@" "$1" awk echo $(pwd)
+		readonly done ${HOME} ${HOME} readonly local done -eu cd printf sed &&
+		cd && ${HOME} test x=1 echo printf echo export 2>/dev/null then printf
+		&& ${HOME} export grep "$@" "$@" -eu "$1" x=1 grep "$@" sed x=1 "$@" "$1"
+	awk /usr/bin local 2>/dev/null ${HOME} awk
+	-eu printf grep export -eu done
+awk "$@" then "$@" -eu done | sed --verbose
+	--verbose ${HOME} ${HOME} echo printf
+		| | echo ${HOME} sed 2>/dev/null local x=1 ${HOME} | export
+test "$@" then echo cd then grep -eu | && &&
+local "$@" test then -eu -eu "$1" echo test "$1" readonly export "$@" readonly
+2>/dev/null 'quoted text' && && then sed sed $(pwd) printf $(pwd) && export
+	'quoted text' 2>/dev/null export export
+echo sed "$1" done "$@" awk then local awk local --verbose export
+		--verbose test test then -eu "$@" local ${HOME}
+		2>/dev/null && sed $(pwd)
+		sed "$@" && && 2>/dev/null test --verbose && cd "$@" 'quoted text'
+x=1 "$@" ${HOME} grep | done grep 2>/dev/null
+	sed local test printf grep "$@" "$@" "$@" done test export
+"$1" done $(pwd) 'quoted text'
+		2>/dev/null cd test 2>/dev/null 2>/dev/null
+	2>/dev/null ${HOME} && -eu /usr/bin 2>/dev/null sed sed grep
+		export grep && 2>/dev/null export awk $(pwd) awk awk
+	grep done done "$@" && 'quoted text' 'quoted text' | -eu x=1 printf awk
+	awk --verbose export echo then --verbose printf "$1" --verbose grep echo 2>/dev/null
+'quoted text' grep then | awk | 'quoted text' cd ${HOME} && --verbose /usr/bin
+grep test --verbose export "$@" readonly sed
+grep cd test x=1 --verbose echo test cd done | x=1 "$1" sed 'quoted text' | printf
+	'quoted text' sed done --verbose "$1" then --verbose
+x=1 2>/dev/null grep | done | ${HOME}
+		done test cd export 'quoted text' printf | -eu readonly echo | --verbose echo sed
+	x=1 x=1 done done 'quoted text' | 2>/dev/null | --verbose
+test && 'quoted text' awk ${HOME}
+	readonly export "$@" "$@" sed "$@"
+		cd --verbose "$1" x=1
+	printf done cd done awk --verbose
+	local && test $(pwd) cd /usr/bin sed x=1 -eu cd then "$@" "$1"
+	${HOME} $(pwd) 2>/dev/null
+	${HOME} | done --verbose echo done x=1 'quoted text'
+	local readonly readonly
+"$@" -eu echo /usr/bin | done
+		"$@" "$1" sed "$@" sed /usr/bin awk sed /usr/bin
+/usr/bin test "$@" && echo awk $(pwd) | sed grep cd sed local | | 'quoted text'
+	export ${HOME} local 2>/dev/null export cd grep done "$1" |
+awk grep grep done 2>/dev/null --verbose echo
+/usr/bin readonly | "$@" then export -eu "$1" 2>/dev/null printf echo
+then | --verbose --verbose test "$@" "$@" test local echo
+	${HOME} test "$1" cd && "$1" export 2>/dev/null awk && local "$@" test --verbose
+		| readonly test "$1" awk readonly
+&& printf x=1 export -eu && | export echo 'quoted text' 2>/dev/null
+cd cd $(pwd) 'quoted text' | local "$@" --verbose ${HOME} done awk && && local
+| local --verbose sed | --verbose test grep "$@" --verbose printf
+-eu "$@" && test -eu --verbose export 'quoted text' -eu x=1 test 2>/dev/null
+		then sed | 'quoted text' | local printf -eu 'quoted text'
+		"$1" echo cd -eu 'quoted text' | readonly grep
+	"$1" && test readonly && 2>/dev/null cd grep | then
+	readonly export x=1 && grep -eu printf | "$@" done grep /usr/bin
+	${HOME} local -eu "$@" then --verbose x=1
+	export echo ${HOME} done
+	| export readonly | -eu
+		&& -eu then "$@" $(pwd)
+		done then sed -eu cd "$1" $(pwd) export "$@" --verbose 2>/dev/null
+		&& then --verbose export
+	-eu "$1" cd readonly done readonly sed 2>/dev/null awk grep /usr/bin test
+	sed grep grep -eu cd printf test
+	$(pwd) export --verbose printf ${HOME}
+	--verbose x=1 $(pwd) 2>/dev/null "$@" then export /usr/bin
+echo "$1" --verbose readonly && x=1 ${HOME}
+		${HOME} printf cd readonly | cd export --verbose test /usr/bin "$1"
+	echo export && -eu then "$1" done | "$@" ${HOME} grep ${HOME} --verbose
+then grep awk printf ${HOME} x=1 local done 2>/dev/null 2>/dev/null $(pwd) x=1
+		grep then ${HOME} "$@" ${HOME}
+	"$1" cd ${HOME} 'quoted text'
+	| done sed awk sed && 2>/dev/null $(pwd)
+		'quoted text' x=1 done $(pwd) grep export $(pwd)
+		/usr/bin x=1 cd grep export --verbose export printf 2>/dev/null
+		export test -eu "$1" ${HOME} cd 'quoted text'
+	"$1" 2>/dev/null 'quoted text' local "$@" test | done "$@" && ${HOME}
+echo readonly export 'quoted text' $(pwd) readonly /usr/bin 2>/dev/null
+awk readonly cd -eu ${HOME} && echo --verbose printf
+		then "$1" readonly export printf cd /usr/bin
+	printf echo then | ${HOME} printf | -eu "$1" 2>/dev/null x=1 cd test grep
+"$1" x=1 sed cd printf readonly /usr/bin ${HOME} x=1 --verbose
+		printf cd /usr/bin cd cd local done printf sed printf x=1 "$1" ${HOME} awk
+		2>/dev/null grep printf ${HOME} echo echo x=1 export | printf "$@" grep grep
+test awk readonly sed ${HOME} ${HOME} $(pwd) x=1 export /usr/bin sed -eu
+		local x=1 done export readonly
+| printf sed $(pwd) x=1 sed grep done then printf /usr/bin then printf echo
+'quoted text' printf "$@" printf x=1 "$1" sed test done printf "$@"
+sed "$1" -eu /usr/bin --verbose test "$1" ${HOME} awk grep sed
+	${HOME} -eu sed /usr/bin grep ${HOME} 2>/dev/null done
+	done sed "$@" /usr/bin && --verbose test echo $(pwd) done
+	awk grep -eu 2>/dev/null done /usr/bin
+"$@" done $(pwd) && test awk readonly
+		$(pwd) local awk "$@" local -eu export echo ${HOME} done sed grep && /usr/bin
+		/usr/bin 'quoted text' done x=1 --verbose --verbose awk test printf readonly
+		2>/dev/null awk && grep 'quoted text' then local echo 2>/dev/null
+		-eu grep --verbose && 2>/dev/null 2>/dev/null -eu "$1" --verbose /usr/bin
+awk | echo $(pwd) "$@" then x=1 sed -eu
+grep "$1" then grep && "$@" awk --verbose
+	echo /usr/bin "$1" "$@" 'quoted text' $(pwd) 2>/dev/null
+/usr/bin -eu done cd /usr/bin local
+${HOME} printf grep 'quoted text'
+		local $(pwd) 'quoted text' done local sed /usr/bin then local done sed
+${HOME} && echo /usr/bin done readonly printf sed x=1 2>/dev/null
+test printf && "$1" echo /usr/bin --verbose local
+	awk sed 'quoted text' --verbose readonly test
+		--verbose test local x=1 local x=1 test --verbose 2>/dev/null | /usr/bin test
+&& ${HOME} | 'quoted text' "$@" "$1" --verbose x=1 "$1" sed --verbose
+		local /usr/bin awk ${HOME} x=1 readonly --verbose "$1"
+echo done done export cd && && sed "$@" ${HOME} grep then export
+		echo 'quoted text' sed echo "$1" echo ${HOME} --verbose cd grep && local
+	&& ${HOME} done $(pwd) sed
+'quoted text' done readonly export && echo sed done
+	2>/dev/null $(pwd) local "$1" echo && printf x=1 readonly
+		2>/dev/null export local done --verbose 2>/dev/null 2>/dev/null sed printf
+x=1 'quoted text' done export local 'quoted text' grep printf 2>/dev/null
+	cd then /usr/bin --verbose x=1 printf export grep echo -eu
+		'quoted text' readonly printf export
+	--verbose --verbose | cd "$1" done
+	test "$1" | x=1 printf sed done 2>/dev/null --verbose -eu cd && printf 'quoted text'
+--verbose awk test cd "$@" /usr/bin
+	$(pwd) | | x=1 local grep 'quoted text' echo "$1"
+		awk x=1 awk test --verbose ${HOME} x=1 x=1 2>/dev/null | "$@" test --verbose
+		printf ${HOME} printf --verbose | 2>/dev/null echo x=1 test
+	grep local local awk cd readonly test local ${HOME} then && then -eu /usr/bin
+		local "$1" awk awk echo $(pwd)
+		&& --verbose cd grep ${HOME} awk cd printf
+		x=1 x=1 done 'quoted text' /usr/bin local 2>/dev/null
+	'quoted text' 2>/dev/null x=1 printf ${HOME} export done
+	&& --verbose "$@" $(pwd) done /usr/bin then x=1 awk sed && -eu grep && "$1" -eu
+| --verbose "$1" "$@" done x=1 export ${HOME} ${HOME} --verbose
+"$1" printf cd x=1 local
+/usr/bin 2>/dev/null | 'quoted text' sed 'quoted text'
+${HOME} 'quoted text' readonly printf local $(pwd)
+		grep "$1" $(pwd) cd --verbose echo done local readonly then "$1"
+test done awk /usr/bin $(pwd) ${HOME} cd awk 'quoted text'
+		awk cd $(pwd) x=1 $(pwd) printf sed
+		$(pwd) ${HOME} export ${HOME}
+		2>/dev/null readonly $(pwd)
+	local && then done --verbose "$1" printf /usr/bin cd export x=1 printf /usr/bin
+local done printf export /usr/bin done
+$(pwd) 2>/dev/null awk printf grep && done $(pwd) ${HOME} 2>/dev/null
+	x=1 && done sed ${HOME} awk local sed ${HOME} done && grep sed
+		readonly printf x=1 --verbose
+		export ${HOME} sed test cd then -eu done readonly echo
+		x=1 "$1" cd test /usr/bin echo | cd done | "$1" /usr/bin 2>/dev/null
+local ${HOME} -eu then sed | $(pwd) readonly
+then ${HOME} "$@" sed awk local x=1 | grep done $(pwd) && -eu --verbose test grep
+		"$1" $(pwd) grep && cd
+	cd local then awk 2>/dev/null sed done readonly
+	test ${HOME} 2>/dev/null then | /usr/bin
+test local test /usr/bin x=1 2>/dev/null && then $(pwd) awk -eu
+		&& awk awk printf readonly 'quoted text' "$@" 2>/dev/null
+		sed done ${HOME} test | | cd
+	test cd grep ${HOME} x=1 test 2>/dev/null 2>/dev/null
+		local printf sed test readonly
+printf cd cd x=1 | sed sed sed grep test test | then grep x=1 /usr/bin
+	done done 'quoted text' sed /usr/bin done 2>/dev/null && x=1 'quoted text'
+		x=1 /usr/bin echo readonly
+		grep /usr/bin /usr/bin --verbose
+		&& echo cd sed -eu local awk readonly -eu 'quoted text' sed readonly
+		then echo x=1 awk "$1" "$1" cd x=1 -eu /usr/bin 'quoted text' echo "$1" --verbose
+	2>/dev/null export "$@" test 'quoted text'
+		local local awk local awk /usr/bin
+		2>/dev/null done | /usr/bin local sed
+	test grep test /usr/bin then && echo awk ${HOME} then awk ${HOME} $(pwd) sed echo
+	grep /usr/bin test 'quoted text' echo "$1" awk awk test $(pwd)
+	/usr/bin | done test printf 2>/dev/null 'quoted text' "$1" ${HOME} awk 2>/dev/null
+${HOME} printf printf then --verbose "$1" "$1" ${HOME} "$@" --verbose 'quoted text'
+&& 'quoted text' && && cd | | /usr/bin 2>/dev/null
+	&& -eu | echo echo grep "$1" | "$@" 2>/dev/null
+	then sed grep ${HOME} -eu export "$@" test local awk awk then | sed /usr/bin
+		/usr/bin | export 'quoted text' grep "$1"
+		-eu ${HOME} test export echo awk
+2>/dev/null grep printf done done x=1 | echo awk ${HOME} /usr/bin /usr/bin
+	cd sed awk echo "$1" --verbose --verbose -eu
+		--verbose | test then local then cd /usr/bin
+		grep 'quoted text' done | sed x=1 -eu "$@" local echo -eu
+done "$1" done 2>/dev/null 2>/dev/null "$@" then && readonly cd cd
+	awk done readonly ${HOME} done /usr/bin sed done x=1 "$@" /usr/bin
+	sed local 2>/dev/null echo | readonly done --verbose -eu x=1
+		local test sed "$1" $(pwd)
+	then grep echo readonly ${HOME} then
+	grep && /usr/bin local export test done ${HOME} ${HOME} --verbose
+'quoted text' | && done "$1" 2>/dev/null
+	x=1 -eu && grep 2>/dev/null done "$1" echo local /usr/bin
+	then then x=1 $(pwd) && x=1 ${HOME} ${HOME} echo --verbose
+'quoted text' readonly $(pwd) cd sed /usr/bin
+sed $(pwd) test then x=1 x=1 ${HOME} printf -eu cd local
+"$1" $(pwd) printf 2>/dev/null
+'quoted text' /usr/bin grep awk 2>/dev/null cd done test echo grep ${HOME} --verbose
+	${HOME} local ${HOME} grep $(pwd) "$1" && | export
+		-eu | local --verbose readonly "$1"
+		x=1 test 2>/dev/null 2>/dev/null 'quoted text' 'quoted text' printf export
+	"$1" x=1 sed --verbose /usr/bin
+		/usr/bin 'quoted text' 2>/dev/null "$@" echo awk $(pwd) 2>/dev/null
+		then ${HOME} cd awk local printf test /usr/bin
+awk $(pwd) export printf awk "$@" printf
+		test 'quoted text' sed done $(pwd) "$@" then local then awk
+--verbose awk $(pwd) export "$@"
+&& local 2>/dev/null test "$@" 2>/dev/null local && printf
+-eu local readonly echo test 'quoted text'
+		${HOME} awk -eu --verbose 'quoted text' "$@"
+	${HOME} "$1" "$1" readonly cd x=1 | -eu --verbose &&
+		local sed $(pwd) 'quoted text' 'quoted text' awk
+-eu echo then test local -eu
+		--verbose 2>/dev/null grep
+test -eu export $(pwd) ${HOME} 'quoted text' test cd /usr/bin
+	2>/dev/null cd "$1" x=1 local /usr/bin printf --verbose | export "$1"
+	-eu 'quoted text' && -eu 'quoted text' readonly "$1" $(pwd) done
+export readonly printf ${HOME} "$1" 2>/dev/null 2>/dev/null awk then sed -eu
+		x=1 $(pwd) | test $(pwd) -eu test test x=1 | "$@" "$@"
+$(pwd) cd 2>/dev/null 'quoted text'
+		${HOME} then $(pwd) local local $(pwd)
+local "$1" | echo -eu done "$1" 2>/dev/null test
+grep /usr/bin export grep test 'quoted text' /usr/bin 2>/dev/null $(pwd) local
+echo cd local local -eu grep cd export readonly readonly && echo 'quoted text'
+	local --verbose cd ${HOME} && 2>/dev/null
+&& -eu | ${HOME} 2>/dev/null "$@"
+'quoted text' 2>/dev/null /usr/bin done 2>/dev/null local test "$1"
+		test cd cd "$@" "$1" cd x=1
+	export printf "$1" readonly printf export "$1" test x=1
+		then 2>/dev/null $(pwd) done 2>/dev/null
+		${HOME} local --verbose x=1 --verbose printf && sed done grep awk
+		$(pwd) local readonly "$1" export
+	x=1 'quoted text' then printf 2>/dev/null echo then echo printf then x=1 printf
+		grep then export 'quoted text' | /usr/bin sed -eu sed awk $(pwd) 2>/dev/null
+		printf grep $(pwd) export local cd echo readonly --verbose |
+	-eu 'quoted text' sed echo then test grep export | "$1" sed printf
+		$(pwd) readonly echo readonly 2>/dev/null
+		awk $(pwd) sed awk printf "$1" readonly && grep local local test readonly
+		readonly | "$@" echo --verbose $(pwd) awk -eu local /usr/bin -eu $(pwd)
+grep done && ${HOME} cd "$@" -eu export sed export
+	test printf then grep then then cd grep done sed "$1" 2>/dev/null
+	sed grep export done export awk cd $(pwd) -eu awk "$@" | 'quoted text'
+then printf -eu awk sed 'quoted text'
+		export && readonly "$@" then
+	/usr/bin 'quoted text' export "$1" cd "$@" /usr/bin
+		2>/dev/null 2>/dev/null ${HOME} "$@" sed 2>/dev/null
+"$1" then --verbose "$1" /usr/bin ${HOME} cd -eu 2>/dev/null $(pwd) ${HOME}
+	done sed && -eu /usr/bin awk readonly 2>/dev/null 2>/dev/null x=1 x=1 export
+	--verbose /usr/bin 2>/dev/null sed sed printf done /usr/bin ${HOME}
+	grep --verbose readonly awk "$@" --verbose
+	/usr/bin /usr/bin export then echo x=1 | readonly --verbose x=1 --verbose
+		"$@" 'quoted text' --verbose grep sed cd printf && cd then
+test cd -eu cd | test | 'quoted text' local "$@" --verbose
+awk readonly echo test 2>/dev/null
+cd ${HOME} printf cd printf local --verbose -eu grep echo 2>/dev/null
+	echo | readonly printf "$@" echo export ${HOME} awk && echo test ${HOME} &&
+sed readonly cd | done test local done "$@" ${HOME} x=1 readonly
+	local done awk "$1" then 'quoted text' ${HOME} --verbose "$1" && --verbose
+		${HOME} done -eu printf
+	test test sed test --verbose
+	then test ${HOME} 2>/dev/null readonly
+		grep $(pwd) awk awk export readonly "$@" --verbose export awk x=1 "$1" then
+echo cd test $(pwd) awk -eu
+${HOME} local echo local printf ${HOME} | local awk export readonly export
+	printf --verbose $(pwd) grep test awk --verbose | then export printf echo grep done
+	--verbose "$@" local
+test local | x=1 && -eu printf "$1" 2>/dev/null test x=1 test && "$1"
+/usr/bin test then done then ${HOME} 'quoted text'
+cd export | sed export
+test | printf --verbose -eu readonly -eu cd "$@"
+	$(pwd) readonly "$@" done local echo 2>/dev/null -eu 'quoted text'
+${HOME} grep --verbose printf local readonly
+		printf then "$1" --verbose -eu 2>/dev/null printf export printf 'quoted text'
+echo $(pwd) "$1" echo x=1 then readonly /usr/bin local "$@" printf --verbose
+		x=1 -eu ${HOME} | "$1" && grep
+	sed cd echo test local printf 2>/dev/null
+	printf 2>/dev/null echo ${HOME}
+cd 'quoted text' echo printf
+		x=1 echo echo printf "$@" | "$@" /usr/bin readonly
+		2>/dev/null 'quoted text'
+	${HOME} | done x=1 done test 'quoted text' printf --verbose | ${HOME}
+	export then 'quoted text' done sed done "$@" "$@" export "$@" /usr/bin
+		-eu echo local awk && /usr/bin local printf /usr/bin awk done
+-eu 2>/dev/null readonly 'quoted text' $(pwd)
+export x=1 grep $(pwd) then cd done ${HOME}
+	readonly -eu printf | awk awk cd 'quoted text' x=1 export ${HOME} echo
+/usr/bin echo test /usr/bin echo
+then "$1" x=1 done sed 2>/dev/null
+echo local awk --verbose -eu $(pwd) cd printf "$1" test awk ${HOME} grep
+		awk && "$1" "$@" 'quoted text' test x=1 test $(pwd) export
+		'quoted text' then export 2>/dev/null local x=1 local --verbose grep $(pwd)
+	awk "$1" && "$@" ${HOME} | 'quoted text'
+		&& ${HOME} done x=1 ${HOME} | printf readonly --verbose cd 'quoted text'
+		'quoted text' awk readonly 2>/dev/null
+readonly && /usr/bin x=1 sed --verbose
+	/usr/bin printf test x=1 'quoted text' test
+awk local awk printf $(pwd) "$1" "$@" 2>/dev/null sed $(pwd) then echo x=1 printf
+	/usr/bin local "$@" printf 2>/dev/null printf | awk test
+--verbose "$1" "$1" awk x=1 /usr/bin done sed
+		grep /usr/bin awk $(pwd) local $(pwd) export && done
+		awk "$@" 'quoted text' && x=1 export printf
+	awk $(pwd) awk -eu sed echo readonly
+${HOME} && /usr/bin 'quoted text' cd 2>/dev/null "$@"
+		| 2>/dev/null 'quoted text' -eu 'quoted text' ${HOME}
+		export x=1 cd sed --verbose
+&& 'quoted text' | sed | grep done readonly 'quoted text' done
+	-eu grep sed done $(pwd) && "$1" 2>/dev/null local /usr/bin $(pwd)
+		grep && 'quoted text' cd 'quoted text' local 'quoted text' awk ${HOME}
+		${HOME} x=1 sed /usr/bin $(pwd) awk 2>/dev/null x=1
+	awk echo | ${HOME} grep ${HOME}
+'quoted text' && test awk "$1" -eu done x=1 printf grep printf
+	x=1 /usr/bin ${HOME} ${HOME} 2>/dev/null -eu $(pwd) 'quoted text'
+	&& /usr/bin ${HOME} export sed done $(pwd) x=1 | printf -eu readonly
+awk local test | readonly sed ${HOME} /usr/bin 2>/dev/null
+local && local echo "$1" grep "$1" && /usr/bin x=1 $(pwd)
+		$(pwd) awk ${HOME} 'quoted text' sed cd 'quoted text' printf 2>/dev/null
+		"$1" printf echo "$@" 2>/dev/null printf then /usr/bin 'quoted text' -eu
+export sed grep ${HOME} printf printf export
+readonly "$@" | "$@" | export | export test cd done done | awk sed grep
+'quoted text' done ${HOME} test test
+	2>/dev/null "$1" "$@" done 'quoted text' 'quoted text'
+"$1" readonly cd test awk cd grep -eu sed local sed sed 'quoted text'
+	--verbose x=1 then then then sed /usr/bin
+'quoted text' sed 2>/dev/null ${HOME} ${HOME}
+		export | --verbose | /usr/bin && export sed "$1" && cd 2>/dev/null
+		printf then local /usr/bin "$@" "$@" sed grep
+awk echo done awk grep local "$1" sed 2>/dev/null
+		test awk then ${HOME} grep
+'quoted text' cd printf "$@" printf
+	sed grep ${HOME} cd "$@" x=1 grep 2>/dev/null local && x=1 export sed /usr/bin
+	${HOME} readonly $(pwd) export readonly x=1 awk
+	--verbose local 2>/dev/null readonly sed then "$1"
+		printf readonly echo $(pwd) -eu -eu then awk "$1" done "$@" $(pwd) ${HOME} cd --verbose
+		"$1" $(pwd) test "$@" --verbose --verbose
+		test then sed /usr/bin 2>/dev/null
+		awk readonly "$@" -eu then ${HOME} export
+		/usr/bin --verbose done "$@" && local $(pwd)
+'quoted text' $(pwd) sed | local 'quoted text' /usr/bin && grep && -eu /usr/bin
+		${HOME} export printf then && export
+	&& awk ${HOME} sed "$1" cd "$1" x=1
+	'quoted text' sed 'quoted text'
+		echo -eu ${HOME} test --verbose $(pwd) test 'quoted text' 2>/dev/null readonly
+		"$1" "$1" local done && ${HOME} awk awk "$1" local "$1" cd && "$@" --verbose
+test echo $(pwd) sed then /usr/bin echo 2>/dev/null echo export $(pwd)
+	--verbose | grep cd ${HOME} echo test
+| echo sed sed sed x=1 -eu printf 2>/dev/null -eu 'quoted text' "$@" grep awk
+	grep && cd sed "$1" -eu echo
+		--verbose cd local done
+echo echo done 'quoted text' printf $(pwd) echo then test echo "$1" -eu local |
+	"$@" readonly "$1" $(pwd) "$1" echo 2>/dev/null "$@" "$1" sed local then
+/usr/bin | printf 'quoted text' test
+	${HOME} | "$@" 'quoted text' sed readonly ${HOME}
+	export 2>/dev/null sed export cd ${HOME} done
+		printf 'quoted text' sed cd readonly printf
+2>/dev/null awk awk /usr/bin echo cd "$1" local $(pwd) && readonly ${HOME} ${HOME}
+		test $(pwd) 2>/dev/null cd local awk echo 2>/dev/null
+	| readonly readonly awk $(pwd) 'quoted text' 2>/dev/null awk
+'quoted text' | grep readonly x=1 && 'quoted text'
+/usr/bin local | then -eu ${HOME} --verbose -eu && local
+	cd --verbose "$1" 2>/dev/null then $(pwd) printf "$@" local export
+local cd grep then export grep $(pwd)
+	grep "$1" /usr/bin 2>/dev/null && 2>/dev/null | && "$1"
+		--verbose echo | 2>/dev/null x=1 'quoted text'
+	then "$@" test readonly | local ${HOME}
+-eu /usr/bin 2>/dev/null done awk
+export -eu "$1" test sed done
+	x=1 printf done printf /usr/bin export --verbose grep test awk x=1 /usr/bin
+		export then /usr/bin $(pwd) readonly cd
+		| grep "$1" cd cd && 'quoted text'
+		echo export 'quoted text' done
+	$(pwd) then ${HOME} && 'quoted text' 'quoted text'
+		printf export -eu "$@" "$1" && export && x=1 sed "$1" -eu --verbose done cd "$1"
+		done test done export 'quoted text' awk 'quoted text'
+	export done && readonly && grep "$@"
+2>/dev/null cd grep 2>/dev/null readonly x=1
+'quoted text' export 2>/dev/null
+		x=1 x=1 x=1 "$1" readonly grep 'quoted text'
+readonly readonly 2>/dev/null echo done
+	2>/dev/null awk sed ${HOME} local
+	"$@" readonly ${HOME} /usr/bin
+$(pwd) "$1" grep grep --verbose "$1" x=1 grep
+		cd -eu export $(pwd) 'quoted text'
+		printf echo -eu && awk | --verbose echo -eu sed "$1"
+${HOME} done sed -eu -eu -eu sed
+	${HOME} /usr/bin printf x=1 2>/dev/null $(pwd)
+	$(pwd) echo done --verbose grep 2>/dev/null
+	readonly awk local echo then printf ${HOME} | local | ${HOME} sed /usr/bin local
+	grep awk --verbose -eu -eu 2>/dev/null ${HOME} printf test "$1" echo
+x=1 echo grep test | 'quoted text' /usr/bin test 'quoted text'
+&& 'quoted text' -eu "$1" grep sed "$1" then awk
+		x=1 'quoted text' cd /usr/bin
+"$@" test readonly printf && x=1 ${HOME} $(pwd) -eu printf
+		x=1 2>/dev/null /usr/bin sed 'quoted text'
+		&& then done && export | test -eu --verbose 'quoted text' echo
+-eu --verbose echo /usr/bin /usr/bin cd | printf echo cd --verbose "$@"
+		| "$1" export cd local export
+"$@" cd cd "$@" $(pwd) readonly awk && done
+	done echo then x=1 local x=1 x=1 | export awk && x=1
+grep x=1 sed export 2>/dev/null
+	$(pwd) "$@" "$1" && grep 2>/dev/null "$@" --verbose
+	$(pwd) sed grep cd cd -eu -eu $(pwd) readonly
+'quoted text' $(pwd) "$1" grep readonly $(pwd) awk echo printf x=1 done printf --verbose
+&& export --verbose done ${HOME} grep /usr/bin sed export "$@" sed && $(pwd)
+export echo --verbose test then printf
+x=1 | done export cd 2>/dev/null done --verbose --verbose test ${HOME}
+		--verbose --verbose "$@" test $(pwd) echo local printf /usr/bin
+		readonly 2>/dev/null && x=1 -eu local printf cd printf 2>/dev/null
+readonly 2>/dev/null local 2>/dev/null readonly $(pwd) then "$@" done ${HOME}
+		--verbose "$1" 2>/dev/null "$1" --verbose --verbose "$1" local --verbose test x=1
+printf /usr/bin --verbose /usr/bin then cd grep $(pwd) x=1 ${HOME} local 2>/dev/null
+	2>/dev/null sed then /usr/bin 2>/dev/null 'quoted text' "$1"
+'quoted text' cd 'quoted text' x=1 2>/dev/null
+		x=1 readonly printf -eu grep x=1 | | $(pwd) echo
+${HOME} -eu --verbose echo echo "$@" 2>/dev/null echo ${HOME} export -eu
+	local /usr/bin test grep done -eu
+test 2>/dev/null 'quoted text' "$1" && /usr/bin --verbose 'quoted text' /usr/bin
+readonly cd && readonly x=1 && grep
+"$@" test "$@" test /usr/bin | -eu /usr/bin -eu grep
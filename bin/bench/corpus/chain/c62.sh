@@ -0,0 +1,2001 @@
+		"$@" done readonly $(pwd) ${HOME} "$1" | readonly cd "$@" ${HOME} local sed $(pwd)
+	/usr/bin grep grep echo /usr/bin awk local && cd export /usr/bin --verbose && cd
+		/usr/bin "$@" /usr/bin cd /usr/bin
+		${HOME} readonly 'quoted text'
+/usr/bin local done awk then sed
+-eu | "$1" "$@" "$@" -eu
+		2>/dev/null x=1 cd sed printf test grep test $(pwd) 'quoted text' ${HOME} "$1"
+sed awk "$@" && echo grep readonly && grep then $(pwd) --verbose 2>/dev/null
+		&& --verbose 2>/dev/null | -eu awk
+	--verbose /usr/bin test "$@" readonly x=1 && && ${HOME} &&
+	test awk /usr/bin && $(pwd) echo awk export readonly cd 2>/dev/null && -eu "$@"
+	| 'quoted text' "$@" printf 2>/dev/null "$@" local awk 'quoted text' | test -eu
+		"$1" ${HOME} local export readonly
+local $(pwd) local cd then x=1 sed cd 2>/dev/null
+2>/dev/null 2>/dev/null $(pwd) awk done done | /usr/bin local
+	grep done sed "$@" sed awk printf $(pwd) && 2>/dev/null ${HOME} local
+x=1 test 2>/dev/null awk grep
+	-eu "$1" grep 2>/dev/null echo cd 2>/dev/null then awk sed local x=1 ${HOME}
+awk --verbose echo readonly awk then | grep 'quoted text'
+		awk 'quoted text' grep && done 2>/dev/null done /usr/bin && cd grep $(pwd)
+	awk && x=1 readonly "$1" done grep local
+"$1" $(pwd) $(pwd) "$1" awk $(pwd) $(pwd)
+	&& "$@" -eu test /usr/bin
+grep /usr/bin printf printf "$1" 2>/dev/null /usr/bin
+	readonly then "$@" then
+		then "$@" /usr/bin printf 2>/dev/null
+| && sed $(pwd) 'quoted text'
+		echo && --verbose cd local export -eu /usr/bin
+		cd cd sed printf local -eu
+		2>/dev/null awk 2>/dev/null
+		readonly 'quoted text' readonly ${HOME} readonly then printf test then
+2>/dev/null | printf readonly /usr/bin $(pwd)
+		$(pwd) test export local -eu -eu test --verbose cd
+cd done x=1 $(pwd) export echo sed done awk "$1" --verbose
+	&& cd "$1" echo grep grep "$1" done 'quoted text' "$@" "$@" && &&
+		2>/dev/null export --verbose done grep export 'quoted text'
+	export 'quoted text' && "$@" readonly grep | ${HOME} awk grep x=1 local
+		$(pwd) test --verbose done local x=1 test then printf ${HOME} && cd 2>/dev/null
+	/usr/bin $(pwd) && test cd 2>/dev/null --verbose done --verbose
+	/usr/bin | grep local then 'quoted text' local -eu grep
+		sed done x=1 readonly then cd | "$@" ${HOME} grep done
+	printf done printf 'quoted text' | readonly "$1" awk /usr/bin then
+		x=1 cd /usr/bin export export x=1 x=1 "$@" local ${HOME}
+		--verbose -eu && grep 'quoted text' --verbose x=1 2>/dev/null printf $(pwd)
+		awk echo readonly /usr/bin -eu done ${HOME} 'quoted text' export $(pwd) && ${HOME}
+	awk ${HOME} $(pwd) export "$@" x=1
+--verbose x=1 2>/dev/null -eu ${HOME} readonly
+	echo done readonly sed sed 'quoted text'
+	"$1" local "$1" then sed local export local then
+	$(pwd) echo sed $(pwd) /usr/bin ${HOME}
+test && 'quoted text' |
+"$1" 'quoted text' $(pwd) sed export "$@" cd test
+--verbose "$@" x=1 /usr/bin 2>/dev/null
+sed ${HOME} export printf readonly ${HOME} then x=1 test 2>/dev/null
+test echo && local echo awk cd -eu printf
+		grep done sed /usr/bin grep test 2>/dev/null test /usr/bin $(pwd)
+	grep echo printf export readonly
+		| "$1" "$1" export local | grep 'quoted text' local cd printf | "$1"
+		'quoted text' then | -eu awk --verbose done
+		export cd awk printf --verbose printf then --verbose 2>/dev/null $(pwd)
+		$(pwd) readonly && "$@"
+	2>/dev/null ${HOME} -eu test test cd export 2>/dev/null
+export readonly --verbose cd 2>/dev/null
+readonly test -eu x=1 sed test test --verbose
+	local 2>/dev/null readonly export 'quoted text' done test test x=1
+done x=1 2>/dev/null 2>/dev/null then -eu 'quoted text' done
+--verbose printf -eu "$@" grep && "$1" "$@" grep awk grep grep
+	grep 2>/dev/null grep cd "$@" done awk export -eu echo --verbose
+grep -eu x=1 x=1 -eu echo | -eu $(pwd) test sed 2>/dev/null sed ${HOME}
+	'quoted text' /usr/bin 2>/dev/null done
+--verbose "$1" -eu /usr/bin sed awk --verbose && grep 2>/dev/null -eu -eu sed 'quoted text'
+	export sed test printf awk test ${HOME} $(pwd) local then readonly
+		test cd 2>/dev/null /usr/bin "$1" cd echo /usr/bin | awk grep
+$(pwd) local readonly printf export export sed printf sed 'quoted text'
+		--verbose test $(pwd) cd awk $(pwd) grep
+	&& | "$@" /usr/bin $(pwd) printf
+	local --verbose $(pwd) 2>/dev/null then
+then --verbose sed cd x=1 export $(pwd) readonly awk awk --verbose ${HOME}
+	awk sed export | -eu cd | x=1 grep x=1 sed x=1
+cd printf grep && --verbose
+grep local x=1 "$@" export --verbose printf |
+	test --verbose 'quoted text' export test printf &&
+export "$@" | | /usr/bin 'quoted text' "$@" awk done readonly |
+	$(pwd) sed awk test 'quoted text' x=1 echo printf ${HOME} "$@" "$1" sed
+--verbose | grep "$@" test then sed grep printf readonly local "$@" -eu ${HOME}
+$(pwd) grep then export &&
+	x=1 export test 'quoted text' sed "$@" /usr/bin local && ${HOME} "$@" grep
+		sed -eu readonly 2>/dev/null
+		test "$1" | $(pwd) x=1 -eu ${HOME} --verbose echo sed readonly 2>/dev/null --verbose
+&& --verbose cd export then | | 'quoted text' /usr/bin
+local printf 'quoted text' "$@" export readonly printf local x=1 printf
+local 'quoted text' | --verbose grep sed && then printf echo ${HOME} awk
+		/usr/bin then --verbose printf test echo awk "$1"
+		&& -eu local | -eu 'quoted text' awk echo export
+	then 'quoted text' /usr/bin export then /usr/bin done -eu test 2>/dev/null
+grep "$@" --verbose cd 'quoted text' 'quoted text'
+		printf awk echo /usr/bin x=1 /usr/bin "$@" "$1" awk /usr/bin local x=1 awk "$1"
+	export -eu 2>/dev/null 2>/dev/null --verbose "$1" sed "$1"
+echo 'quoted text' --verbose ${HOME} readonly x=1 sed echo grep test && ${HOME}
+		sed echo echo sed then sed export "$1" echo && grep ${HOME} /usr/bin sed
+	grep x=1 sed echo | $(pwd)
+	printf "$1" "$1" local printf readonly sed x=1 $(pwd)
+		grep x=1 "$1" local 2>/dev/null "$@" sed readonly printf grep /usr/bin
+$(pwd) $(pwd) echo done local $(pwd) then /usr/bin
+		-eu printf $(pwd) "$@" "$1" --verbose --verbose done sed sed
+"$@" 2>/dev/null cd --verbose x=1 echo readonly $(pwd) -eu x=1 echo export
+	cd echo echo ${HOME} /usr/bin done && && sed && then echo
+	done export test "$@" 'quoted text' readonly test sed test
+	then done "$1" && awk | ${HOME} echo "$@" $(pwd) done -eu --verbose
+		test test x=1 export /usr/bin test ${HOME} grep /usr/bin ${HOME}
+	x=1 --verbose 'quoted text' -eu -eu && grep x=1 "$@" export sed printf
+		x=1 x=1 && && sed export cd 'quoted text' "$1" grep sed
+x=1 && sed 'quoted text' then --verbose -eu
+		then /usr/bin $(pwd) echo -eu 2>/dev/null test && /usr/bin 'quoted text' echo -eu
+	${HOME} then awk | cd --verbose test ${HOME} "$1" --verbose export $(pwd)
+		${HOME} readonly ${HOME} cd echo cd then 2>/dev/null
+	2>/dev/null printf | awk x=1 | $(pwd)
+		"$@" | $(pwd) --verbose "$1" /usr/bin readonly done 'quoted text'
+		/usr/bin "$@" x=1 | local readonly --verbose "$@" then && export ${HOME}
+done /usr/bin 'quoted text' awk awk && export awk readonly --verbose
+$(pwd) sed "$@" && awk then x=1 2>/dev/null && "$@" sed readonly local
+		-eu done sed $(pwd) echo /usr/bin -eu echo sed --verbose
+2>/dev/null echo "$@" export sed then test export x=1 "$1"
+	2>/dev/null | awk done done 2>/dev/null
+		$(pwd) $(pwd) --verbose | sed "$1" echo "$1" ${HOME} local export readonly
+		x=1 sed --verbose export readonly
+local readonly awk sed ${HOME} awk
+${HOME} 2>/dev/null readonly | done echo export | printf
+/usr/bin && echo printf printf
+	$(pwd) cd 2>/dev/null test printf --verbose local local && printf export
+	"$@" grep -eu /usr/bin printf export done -eu --verbose
+awk then $(pwd) x=1 && local printf awk export | "$1" /usr/bin test "$1" && then
+		cd "$1" readonly 2>/dev/null
+	echo grep then done | $(pwd)
+cd /usr/bin sed export awk test printf "$@" "$@" printf readonly
+		cd test test sed cd test echo readonly -eu grep echo then test awk "$@" printf
+	| test then ${HOME} 'quoted text'
+&& grep sed test && awk echo ${HOME} grep
+	-eu $(pwd) "$@" then $(pwd) readonly "$1" then x=1 | grep then
+	2>/dev/null "$@" --verbose ${HOME} -eu printf /usr/bin
+	$(pwd) 'quoted text' --verbose
+		local cd done "$1" then printf cd && /usr/bin 2>/dev/null export $(pwd)
+awk export readonly x=1 x=1 -eu $(pwd) cd echo export printf local
+		${HOME} ${HOME} then --verbose readonly cd readonly
+	cd awk --verbose test "$1" readonly && cd export done export
+		test sed sed "$1" $(pwd) /usr/bin /usr/bin grep --verbose printf
+export printf -eu | export printf then 'quoted text' readonly export
+		then "$1" ${HOME} local /usr/bin awk awk /usr/bin done 'quoted text'
+"$1" $(pwd) grep printf -eu /usr/bin "$@" x=1 readonly 'quoted text'
+		${HOME} | /usr/bin -eu test
+	readonly $(pwd) export 'quoted text'
+-eu -eu && done then done "$1" echo readonly readonly grep awk
+local printf -eu awk cd sed x=1
+		local done printf cd "$1" export
+	'quoted text' | then -eu printf --verbose local export local "$@" awk -eu | --verbose
+		awk export grep cd && readonly /usr/bin test done ${HOME}
+	test cd x=1 grep "$@" test -eu --verbose awk
+		"$1" test printf ${HOME} "$@" readonly x=1 | export printf
+sed 2>/dev/null /usr/bin x=1 "$@" x=1 awk local $(pwd) 'quoted text'
+		x=1 grep "$@" export 2>/dev/null printf done done
+		"$@" sed /usr/bin $(pwd) export $(pwd) printf 'quoted text'
+		readonly x=1 done 'quoted text'
+		printf | "$@" local ${HOME} -eu readonly local test
+	readonly ${HOME} 'quoted text' 2>/dev/null
+		awk x=1 -eu --verbose ${HOME} cd "$1" readonly /usr/bin ${HOME}
+		then | readonly local done 'quoted text' awk -eu printf && 2>/dev/null
+	echo local --verbose
+		&& readonly -eu $(pwd) --verbose printf /usr/bin ${HOME} test local && /usr/bin
+2>/dev/null readonly && cd /usr/bin readonly
+	${HOME} "$@" grep sed "$@" x=1 "$1" then test && cd "$@" done local -eu
+	local /usr/bin local /usr/bin $(pwd)
+-eu /usr/bin awk export test 'quoted text'
+	test cd -eu --verbose test readonly export done
+		'quoted text' 'quoted text' local ${HOME} printf $(pwd) echo /usr/bin printf
+printf "$@" local done --verbose
+	sed "$@" $(pwd) ${HOME} x=1 'quoted text'
+		sed | $(pwd) "$@" | printf cd sed
+		cd cd && printf x=1 -eu $(pwd) ${HOME} awk export "$@" echo test
+		readonly readonly /usr/bin sed |
+		$(pwd) readonly x=1 "$1" ${HOME}
+	then awk then && then sed done 2>/dev/null readonly "$@" readonly -eu
+		printf x=1 readonly awk export ${HOME} local grep | --verbose 'quoted text' printf
+	cd awk "$@" $(pwd) --verbose -eu printf export
+cd 2>/dev/null x=1 2>/dev/null awk ${HOME} export then grep /usr/bin
+/usr/bin ${HOME} ${HOME} export x=1 x=1
+	export local done -eu -eu
+	awk x=1 local test --verbose
+	export --verbose /usr/bin sed test export
+readonly -eu sed "$1" sed "$1" 2>/dev/null && test echo cd
+		2>/dev/null $(pwd) cd "$1" awk 'quoted text' 'quoted text'
+		${HOME} /usr/bin done | readonly 'quoted text' export ${HOME} $(pwd)
+x=1 "$@" echo local --verbose readonly printf awk test 2>/dev/null
+local x=1 echo grep ${HOME}
+		done awk -eu grep 2>/dev/null then && sed
+then /usr/bin | sed grep 'quoted text'
+	then 'quoted text' test -eu 2>/dev/null export printf done
+		&& awk ${HOME} /usr/bin cd test | printf printf awk "$@"
+echo local readonly readonly done echo done $(pwd)
+		/usr/bin x=1 --verbose "$@" awk /usr/bin done awk -eu -eu
+	local /usr/bin "$@" 2>/dev/null | $(pwd) 'quoted text' --verbose cd test $(pwd)
+then grep cd --verbose 2>/dev/null
+		"$@" sed readonly --verbose "$@" awk /usr/bin local test "$@" "$@" && && sed
+		done export -eu x=1 printf local then
+	awk done "$@" then awk $(pwd) readonly 2>/dev/null test done grep test echo
+'quoted text' export readonly /usr/bin -eu local test export ${HOME} echo
+		"$@" test printf | then
+		then && && export local test then -eu sed printf x=1
+export $(pwd) 'quoted text' "$1" $(pwd) --verbose
+		echo readonly test done
+${HOME} $(pwd) ${HOME} sed done 'quoted text'
+	awk done awk printf test /usr/bin done export -eu "$1" && "$@" export x=1 ${HOME}
+	"$@" grep grep 'quoted text' cd sed local ${HOME}
+readonly printf export readonly
+	"$@" echo awk x=1 done 2>/dev/null --verbose then --verbose
+	export 'quoted text' printf
+		/usr/bin | test 'quoted text' "$1"
+		-eu local "$@" grep -eu
+awk readonly test $(pwd) --verbose local export "$1" local "$1" local 'quoted text'
+		printf printf sed --verbose test sed readonly test --verbose /usr/bin
+		export echo | -eu "$@"
+2>/dev/null sed /usr/bin ${HOME} $(pwd)
+		"$@" readonly $(pwd) printf $(pwd) --verbose $(pwd) sed grep
+${HOME} printf test x=1 && "$1"
+		-eu 'quoted text' awk grep export 2>/dev/null sed test
+	| sed export sed readonly grep sed -eu done 2>/dev/null readonly ${HOME}
+grep done awk "$1" cd 2>/dev/null
+$(pwd) | export x=1 ${HOME} 'quoted text'
+	export test | sed then /usr/bin export readonly
+local done | done readonly 2>/dev/null /usr/bin readonly ${HOME}
+		local --verbose x=1 | ${HOME} awk then 'quoted text'
+		readonly readonly local grep $(pwd) test "$@"
+		then $(pwd) readonly "$1" --verbose printf test x=1 echo local -eu "$1" 'quoted text'
+	echo then sed && "$1" && done -eu export cd
+'quoted text' --verbose x=1 "$@" sed export "$1" /usr/bin "$@" ${HOME}
+		/usr/bin && sed 'quoted text' && 2>/dev/null sed "$1" awk readonly echo 2>/dev/null
+	readonly cd && --verbose 'quoted text' "$1" | then echo
+		readonly cd sed grep readonly grep ${HOME} ${HOME} awk x=1 then local local
+		readonly | then "$1" readonly test grep
+$(pwd) 2>/dev/null then local | | awk -eu 'quoted text'
+		/usr/bin --verbose ${HOME} export ${HOME} local 2>/dev/null
+	-eu grep printf echo cd "$@" 'quoted text' --verbose
+test && && sed local sed 2>/dev/null "$@" export done 2>/dev/null readonly
+cd x=1 awk export $(pwd) 'quoted text' 2>/dev/null then cd
+		echo awk cd x=1 grep awk 2>/dev/null /usr/bin cd grep -eu
+	x=1 'quoted text' printf $(pwd) echo
+	sed /usr/bin grep 'quoted text'
+	export $(pwd) 2>/dev/null sed test export -eu
+		test awk cd export $(pwd) && local export x=1 "$1" readonly test echo
+	2>/dev/null --verbose printf printf | printf then -eu && then /usr/bin
+awk x=1 grep sed then "$@" then --verbose --verbose awk $(pwd) printf sed
+	export x=1 "$1" | x=1 "$@" $(pwd) export local
+	cd x=1 $(pwd) && -eu ${HOME} --verbose "$1" $(pwd) 2>/dev/null
+	"$1" awk --verbose done
+		echo --verbose printf printf grep $(pwd) export
+		done | | | cd 'quoted text' && then "$@"
+		${HOME} ${HOME} printf /usr/bin local local
+		grep && done -eu 'quoted text' test "$@" /usr/bin $(pwd) then /usr/bin sed /usr/bin
+export sed printf /usr/bin ${HOME} 2>/dev/null -eu x=1 printf cd export
+		-eu --verbose --verbose "$1" test -eu then then /usr/bin -eu && x=1 then
+${HOME} local done readonly grep printf awk cd done
+--verbose -eu 2>/dev/null export "$1" export $(pwd)
+		"$@" "$@" grep then x=1 done export awk -eu printf ${HOME}
+	/usr/bin x=1 "$1" --verbose cd export /usr/bin ${HOME} then && sed sed printf
+		then done "$1" then -eu x=1 local /usr/bin test
+	sed export awk ${HOME} && $(pwd) grep x=1 done
+sed /usr/bin $(pwd) x=1 printf printf
+	&& x=1 cd $(pwd) ${HOME} cd echo sed $(pwd) "$1"
+	| x=1 "$1" x=1 done awk cd 'quoted text' /usr/bin
+		'quoted text' done /usr/bin local local && "$1" --verbose
+printf cd ${HOME} -eu "$1" readonly done
+		sed "$@" cd ${HOME} --verbose 'quoted text' export readonly
+	awk test echo cd test readonly | sed test grep printf done -eu awk 'quoted text'
+	awk echo --verbose $(pwd) --verbose
+	then ${HOME} grep "$1" local 'quoted text'
+		test "$@" /usr/bin 'quoted text' "$@" && awk
+	echo $(pwd) 'quoted text' grep readonly -eu export grep
+${HOME} "$@" 2>/dev/null 'quoted text' | -eu 2>/dev/null grep cd
+cd local "$1" 2>/dev/null printf
+		'quoted text' x=1 'quoted text' echo $(pwd) --verbose /usr/bin
+echo test --verbose $(pwd) cd --verbose
+		local echo export "$@" done -eu 2>/dev/null 'quoted text' test
+		then grep printf x=1 /usr/bin grep cd printf "$@" local
+done then 'quoted text' awk 'quoted text' local local echo 'quoted text' echo grep
+		--verbose "$1" /usr/bin printf
+2>/dev/null readonly grep export then readonly awk awk x=1
+grep readonly export
+	cd echo echo ${HOME} local ${HOME} awk export "$1" --verbose
+		echo done | printf && "$@" echo then $(pwd) && export cd
+printf echo x=1 readonly done "$@" x=1 x=1 | /usr/bin
+done export $(pwd) $(pwd) awk x=1 then | |
+/usr/bin --verbose cd ${HOME} sed cd ${HOME} | readonly
+	/usr/bin sed awk echo 2>/dev/null printf cd 'quoted text' printf sed
+		| x=1 ${HOME} echo "$1" --verbose export && x=1 "$@" echo | echo test awk &&
+	done then | ${HOME} x=1
+/usr/bin grep then grep test "$@" sed && done printf cd "$@" x=1 "$1" grep $(pwd)
+		'quoted text' local "$1" /usr/bin "$1" local ${HOME} x=1 $(pwd) export
+	sed awk "$1" /usr/bin local cd echo && 'quoted text' cd --verbose "$1"
+		local /usr/bin grep $(pwd) $(pwd) "$@" /usr/bin local printf done sed
+	sed "$@" local printf
+		sed -eu cd 'quoted text' then $(pwd)
+		test "$@" $(pwd) test && test 'quoted text' done printf --verbose
+		awk /usr/bin -eu x=1 sed && test local awk
+${HOME} readonly -eu awk printf echo 2>/dev/null x=1 -eu grep then x=1 |
+	local done /usr/bin 2>/dev/null done then
+-eu && echo local readonly "$@" -eu cd 2>/dev/null then sed -eu awk export
+-eu echo test readonly grep cd "$@" grep printf
+	"$@" -eu then awk local export --verbose
+	2>/dev/null echo && test --verbose echo export /usr/bin done "$1" --verbose
+/usr/bin 2>/dev/null ${HOME} test awk -eu echo local --verbose | && "$1" -eu
+	2>/dev/null ${HOME} grep ${HOME} sed cd awk then
+		readonly awk grep sed ${HOME} cd 2>/dev/null
+	printf awk ${HOME} export && sed then
+x=1 printf | echo local "$1"
+	export 'quoted text' "$@" test "$1"
+x=1 /usr/bin sed local grep sed echo
+		${HOME} /usr/bin grep export cd echo 'quoted text' awk "$@" x=1 'quoted text'
+$(pwd) | printf "$1" readonly
+${HOME} sed && cd 2>/dev/null then "$@" grep awk test local 'quoted text'
+	${HOME} -eu "$@" | grep ${HOME} 2>/dev/null
+done ${HOME} then --verbose "$1" 2>/dev/null
+	awk $(pwd) readonly && local awk ${HOME} awk printf "$@" | "$@" cd
+	local then sed 2>/dev/null readonly
+	2>/dev/null && grep done local 'quoted text'
+	printf export --verbose sed "$1" done -eu -eu grep ${HOME} -eu grep local
+	2>/dev/null 'quoted text' sed readonly then --verbose printf then | readonly &&
+&& "$1" -eu 'quoted text' done awk cd printf local /usr/bin x=1 then
+	$(pwd) $(pwd) "$1" "$1" sed x=1 export then grep then printf | grep --verbose
+${HOME} then "$@" readonly cd -eu $(pwd) done test &&
+		then /usr/bin local local test 2>/dev/null cd echo grep readonly
+		readonly 2>/dev/null grep echo sed cd
+done 2>/dev/null "$@" export "$@" | printf $(pwd)
+		'quoted text' cd --verbose "$1" 2>/dev/null
+/usr/bin /usr/bin -eu "$1" cd x=1 done x=1 &&
+	2>/dev/null awk readonly --verbose x=1 echo && /usr/bin echo cd x=1 test $(pwd)
+		&& "$1" awk "$1" echo sed 'quoted text' local test /usr/bin --verbose
+	"$1" /usr/bin grep /usr/bin
+		cd --verbose then 2>/dev/null export | export && then
+printf sed $(pwd) echo export 'quoted text' 'quoted text' ${HOME}
+		--verbose printf grep 'quoted text' then | "$1" echo awk -eu cd |
+	&& $(pwd) --verbose sed readonly
+		cd "$@" --verbose $(pwd) done -eu cd readonly
+	'quoted text' printf cd ${HOME} x=1
+		-eu printf printf printf && cd "$@" echo /usr/bin
+		--verbose echo -eu $(pwd) $(pwd) ${HOME} printf
+		sed printf echo --verbose export sed then | 2>/dev/null cd export
+test 2>/dev/null local $(pwd) | 2>/dev/null awk echo "$1" -eu
+	done ${HOME} "$1" then
+	test x=1 "$1" x=1 /usr/bin /usr/bin /usr/bin 2>/dev/null sed local
+	&& $(pwd) "$@" ${HOME} printf readonly x=1 | && $(pwd) $(pwd)
+2>/dev/null && --verbose then /usr/bin -eu 2>/dev/null
+	| echo awk export echo 'quoted text'
+&& sed 2>/dev/null cd cd sed "$@" && && "$1" awk
+	2>/dev/null "$1" sed local 2>/dev/null readonly cd readonly done 2>/dev/null ${HOME}
+	/usr/bin sed --verbose x=1 2>/dev/null
+/usr/bin x=1 | -eu -eu sed test 'quoted text' then -eu printf done "$1" -eu 2>/dev/null
+		| "$@" done cd "$@" printf x=1 -eu "$1" | printf test awk "$@"
+	2>/dev/null done "$@"
+		export --verbose done sed awk awk $(pwd) echo awk awk
+	grep && 2>/dev/null sed /usr/bin
+		${HOME} /usr/bin $(pwd) sed done "$1" sed grep "$@" awk test
+		$(pwd) printf | ${HOME} -eu 2>/dev/null awk then done ${HOME} -eu echo /usr/bin
+		"$@" "$@" awk export --verbose $(pwd) echo test ${HOME}
+-eu x=1 "$1" ${HOME} sed sed readonly awk export 'quoted text' && then
+local /usr/bin printf 2>/dev/null echo
+		local local $(pwd) sed $(pwd) cd awk awk awk then /usr/bin -eu echo test x=1
+	local --verbose awk test local echo | /usr/bin
+		| "$1" x=1 awk 2>/dev/null 2>/dev/null sed $(pwd)
+		-eu awk -eu 'quoted text' readonly test 2>/dev/null "$@" grep test awk "$@" echo
+	/usr/bin readonly /usr/bin "$@" $(pwd) then -eu local $(pwd)
+		awk done "$@" | readonly ${HOME} awk 2>/dev/null -eu then awk --verbose "$@"
+x=1 awk printf readonly --verbose awk grep awk | -eu ${HOME} done ${HOME}
+cd sed done printf awk cd grep sed /usr/bin
+		test readonly "$1" x=1 2>/dev/null printf test | test | sed /usr/bin sed $(pwd)
+		done "$1" 2>/dev/null | test local
+local echo awk echo grep echo 'quoted text'
+	$(pwd) | /usr/bin "$1" local awk awk --verbose
+		/usr/bin x=1 ${HOME} grep &&
+		$(pwd) cd /usr/bin 'quoted text' echo sed test 'quoted text' awk x=1 'quoted text'
+	test "$1" grep x=1 done && "$@" echo
+	2>/dev/null "$@" | x=1 x=1
+		&& "$@" ${HOME} x=1 && 2>/dev/null echo && --verbose
+	-eu grep test cd $(pwd) 'quoted text' -eu ${HOME} $(pwd) local local
+	"$1" --verbose ${HOME} awk test "$@" printf then cd awk --verbose
+done grep "$@" then "$@" /usr/bin | test $(pwd)
+done ${HOME} export sed grep local "$@" then test
+		${HOME} cd --verbose echo echo readonly test
+	readonly test "$@" done grep done /usr/bin && 2>/dev/null printf x=1 "$@" then
+	"$@" export /usr/bin /usr/bin local "$1" readonly -eu --verbose ${HOME}
+		export test then $(pwd) | 'quoted text'
+		"$1" && && && --verbose -eu "$@" && /usr/bin cd x=1 --verbose $(pwd) cd printf
+		echo "$@" grep ${HOME} ${HOME} /usr/bin && &&
+		-eu -eu done awk ${HOME} /usr/bin test grep sed /usr/bin /usr/bin
+	sed ${HOME} | 'quoted text' 2>/dev/null
+		${HOME} $(pwd) local echo $(pwd) x=1 ${HOME} $(pwd) ${HOME}
+'quoted text' | /usr/bin done grep --verbose grep x=1 export x=1 grep
+	export done x=1 x=1 printf
+		'quoted text' -eu cd 'quoted text' | -eu ${HOME} grep then readonly
+		echo x=1 ${HOME} | readonly awk "$1" done awk local "$@" && --verbose
+		2>/dev/null "$1" then ${HOME} 'quoted text' done grep awk -eu "$1" 'quoted text'
+	x=1 export "$1" test test grep /usr/bin readonly done cd cd 2>/dev/null
+$(pwd) then $(pwd) local local -eu
+	"$@" readonly then $(pwd) grep then cd ${HOME} "$1" "$1" printf export
+	--verbose $(pwd) ${HOME} printf sed 2>/dev/null
+	cd && grep --verbose --verbose "$@" echo ${HOME} 2>/dev/null local then
+		export done printf 2>/dev/null x=1 done 2>/dev/null cd readonly echo
+local echo ${HOME} local "$1" done "$@" "$1" -eu x=1
+awk 'quoted text' 2>/dev/null awk
+local /usr/bin cd test --verbose
+		readonly "$@" "$@" "$@" grep | 'quoted text' done echo local "$1" cd x=1
+test 'quoted text' local |
+grep awk test cd test
+	local $(pwd) ${HOME} --verbose test awk /usr/bin test grep
+		| then -eu | readonly cd --verbose && |
+&& | sed then sed done done done cd -eu $(pwd) grep | cd "$1" local "$@" then
+echo /usr/bin printf echo x=1 /usr/bin printf cd then test 'quoted text'
+	$(pwd) 'quoted text' && 2>/dev/null 'quoted text' "$1"
+| readonly then /usr/bin /usr/bin
+		awk printf readonly local --verbose x=1 local done 2>/dev/null
+	test "$1" then done sed | sed then export "$@" 'quoted text' /usr/bin | sed readonly
+export ${HOME} readonly printf
+		local grep echo cd ${HOME} && test test done "$@" local
+		-eu -eu then sed ${HOME}
+	$(pwd) readonly 'quoted text'
+x=1 "$@" export export sed "$1" x=1 readonly local test done readonly x=1 done
+cd then $(pwd) grep "$1" "$1" 'quoted text' "$1" then done grep
+done sed ${HOME} 'quoted text' cd local -eu
+/usr/bin x=1 ${HOME} | 2>/dev/null local awk
+	x=1 && export "$@" && ${HOME} -eu export --verbose 2>/dev/null x=1 ${HOME}
+echo $(pwd) printf ${HOME} awk awk x=1 done "$@" 'quoted text'
+local --verbose echo readonly test | test test then "$@" "$@" x=1 | cd $(pwd)
+local x=1 then sed "$1" local /usr/bin export
+${HOME} export awk x=1 done cd $(pwd) "$1" done cd 2>/dev/null
+then && then done ${HOME} readonly test | x=1
+printf "$1" test --verbose 2>/dev/null
+		/usr/bin then "$1" 'quoted text'
+	2>/dev/null 'quoted text' "$@" "$1" export | cd 'quoted text'
+2>/dev/null "$1" 2>/dev/null $(pwd) &&
+--verbose sed cd sed x=1 printf
+	'quoted text' sed && then cd /usr/bin $(pwd) awk "$@" && export printf
+	"$@" test test printf x=1 x=1 ${HOME} export export && echo grep -eu x=1
+	printf -eu grep $(pwd) then x=1 cd
+cd sed then printf readonly echo
+		cd --verbose "$1" done $(pwd) readonly --verbose "$1" 2>/dev/null ${HOME}
+${HOME} local local printf | grep awk export
+		awk export && && cd test "$1" "$@" grep cd test sed local then
+		awk && echo | ${HOME} echo printf $(pwd) -eu ${HOME} $(pwd) sed export test 'quoted text'
+		done x=1 'quoted text' grep x=1 cd printf then then done echo | awk
+		echo export done cd cd 2>/dev/null
+	&& grep test --verbose echo local printf test export echo cd done /usr/bin $(pwd)
+	"$1" | $(pwd) printf done awk readonly && cd cd
+	| export x=1 grep /usr/bin && echo test then x=1 2>/dev/null local awk sed
+		awk 'quoted text' -eu export awk
+	&& x=1 echo local readonly
+		awk then readonly $(pwd) 'quoted text' printf ${HOME} 2>/dev/null
+		'quoted text' readonly /usr/bin 'quoted text'
+	${HOME} readonly $(pwd) | "$1" "$@" | x=1 then "$@" grep | printf printf "$1"
+	$(pwd) -eu /usr/bin local export
+$(pwd) 'quoted text' $(pwd) printf grep done -eu then
+"$@" /usr/bin then then export "$@" 2>/dev/null | grep -eu grep awk cd sed
+		/usr/bin "$1" export printf ${HOME}
+	x=1 test 2>/dev/null -eu --verbose then readonly
+	then 2>/dev/null sed readonly printf "$@" echo -eu "$1" printf ${HOME}
+awk local $(pwd) x=1 export ${HOME} "$1"
+		"$@" sed cd 2>/dev/null done
+		echo grep -eu ${HOME} test /usr/bin "$@"
+		$(pwd) "$@" -eu printf echo x=1 | test sed readonly 'quoted text' awk
+"$@" 'quoted text' printf echo $(pwd) "$@" readonly | cd 2>/dev/null x=1 awk
+-eu test cd test --verbose x=1 sed "$1"
+sed cd local 2>/dev/null then && && test && test x=1 echo |
+	done $(pwd) sed "$1" 'quoted text' "$1" local 2>/dev/null
+	export awk | && ${HOME} sed grep x=1 /usr/bin ${HOME} ${HOME} echo readonly
+		printf readonly | then /usr/bin cd | readonly
+	--verbose readonly test -eu local | -eu sed then 'quoted text'
+"$1" ${HOME} printf "$@" echo | -eu && readonly | -eu test done printf $(pwd) test
+		echo awk awk /usr/bin | done ${HOME} grep cd "$1" "$@" && awk export local
+"$1" /usr/bin x=1 x=1 /usr/bin
+	grep x=1 cd then test local test grep
+	'quoted text' local printf printf grep | test
+	cd /usr/bin cd cd ${HOME} done export echo echo echo
+	cd && 'quoted text' x=1 readonly ${HOME} readonly /usr/bin
+readonly && test x=1 grep --verbose x=1 x=1 x=1
+	cd $(pwd) /usr/bin --verbose local 'quoted text' done
+		cd | readonly grep done "$@" | then x=1 echo export
+readonly | test then cd grep x=1 $(pwd)
+/usr/bin 2>/dev/null $(pwd) $(pwd) then -eu 2>/dev/null
+	echo export then grep $(pwd) export 2>/dev/null export $(pwd) done "$1" /usr/bin
+2>/dev/null "$1" local | /usr/bin /usr/bin grep readonly | printf "$@" x=1
+		${HOME} awk then && sed /usr/bin
+		echo "$1" readonly local grep "$1" x=1 sed awk --verbose sed
+printf ${HOME} "$@" readonly "$@" --verbose readonly done
+	x=1 "$@" export x=1 cd export x=1 grep "$1" "$@" 2>/dev/null
+printf /usr/bin grep --verbose | 'quoted text'
+| cd done local test && sed printf $(pwd) 2>/dev/null
+test && -eu -eu | -eu sed then then cd | local
+	x=1 'quoted text' ${HOME} x=1
+export $(pwd) sed test | readonly readonly awk grep --verbose echo /usr/bin printf
+	"$1" -eu --verbose test /usr/bin
+export echo 2>/dev/null sed awk "$1" "$1"
+export 2>/dev/null local && export export /usr/bin local "$@" x=1 test && /usr/bin
+		printf echo sed -eu local sed /usr/bin
+awk export | export && 2>/dev/null
+2>/dev/null --verbose 2>/dev/null sed local cd export test awk
+	awk echo --verbose 2>/dev/null readonly grep $(pwd)
+export readonly 'quoted text' 'quoted text' awk test readonly then readonly then
+		local local export awk done echo $(pwd) then cd $(pwd) /usr/bin
+		grep ${HOME} --verbose ${HOME} echo local x=1
+	readonly x=1 && then echo && cd cd done x=1 --verbose local
+		| --verbose local grep then $(pwd) "$1" x=1 && &&
+x=1 sed sed grep ${HOME} awk grep && $(pwd) --verbose "$@" -eu "$1"
+awk 2>/dev/null && -eu $(pwd) && "$1"
+$(pwd) done "$@" test /usr/bin
+	readonly export | local x=1 --verbose
+--verbose 2>/dev/null cd awk /usr/bin
+	&& && printf grep $(pwd) x=1 done ${HOME} "$1"
+	cd /usr/bin $(pwd) $(pwd) 2>/dev/null
+		then sed cd grep x=1 then local /usr/bin
+		done printf ${HOME} echo $(pwd) 2>/dev/null test cd x=1 local
+-eu ${HOME} $(pwd) && local --verbose ${HOME} export "$@" ${HOME} x=1 'quoted text'
+x=1 -eu && local | ${HOME} x=1 && test cd readonly "$@" $(pwd) ${HOME}
+		readonly local awk x=1 then echo "$@" local | && done local then
+		${HOME} test done x=1 cd export sed -eu /usr/bin /usr/bin "$@" x=1 then local
+&& echo sed echo sed --verbose "$@" readonly
+--verbose ${HOME} x=1 $(pwd) 'quoted text' test $(pwd) readonly
+		grep x=1 && | x=1 echo /usr/bin $(pwd) grep | "$1" ${HOME} readonly
+	"$1" ${HOME} readonly "$1" done
+	local x=1 && /usr/bin cd | local /usr/bin "$1" test then
+	'quoted text' $(pwd) ${HOME} cd && cd local x=1 test $(pwd)
+$(pwd) printf done local | $(pwd) --verbose /usr/bin -eu export
+${HOME} -eu then grep awk awk 2>/dev/null then "$@" sed
+	&& /usr/bin 'quoted text' -eu | printf readonly x=1 then x=1
+		"$@" done 'quoted text' 'quoted text' export
+	echo 'quoted text' 'quoted text' "$1" cd && grep "$1" x=1
+		local awk | -eu "$1" 'quoted text' export -eu
+	sed | ${HOME} x=1 echo readonly cd x=1 &&
+	"$@" -eu -eu sed /usr/bin /usr/bin && ${HOME}
+		sed 'quoted text' -eu ${HOME}
+		&& cd -eu -eu -eu grep -eu $(pwd) $(pwd) && sed cd then done local
+		${HOME} then ${HOME} x=1 "$1" awk /usr/bin
+		'quoted text' && --verbose cd
+		/usr/bin grep 'quoted text' test printf grep printf
+	'quoted text' test done x=1 local 'quoted text' done then
+echo done "$1" cd x=1 x=1 then | 2>/dev/null
+	&& local ${HOME} $(pwd) ${HOME} awk local 2>/dev/null
+		2>/dev/null done --verbose readonly local x=1 printf
+	readonly ${HOME} | local "$1" test "$1" cd
+${HOME} local readonly grep sed x=1 "$@" -eu done
+		local done 2>/dev/null export grep cd test test cd /usr/bin
+	'quoted text' --verbose "$@"
+		/usr/bin $(pwd) cd echo cd x=1 export -eu local x=1 export
+	grep "$@" export test $(pwd) echo --verbose 'quoted text' test
+cd awk test 'quoted text' done cd | printf $(pwd) printf done test test done ${HOME}
+echo -eu then echo && --verbose readonly --verbose
+	| awk --verbose ${HOME} readonly done
+	export export ${HOME} done test then
+		2>/dev/null then printf 2>/dev/null 2>/dev/null "$@" readonly
+	printf && grep 2>/dev/null --verbose
+awk "$@" export $(pwd) 'quoted text' test | "$@" echo grep
+	done done && cd printf "$1" cd && --verbose echo /usr/bin
+		x=1 sed local echo echo
+--verbose x=1 readonly 2>/dev/null then done test cd cd 2>/dev/null && awk
+then /usr/bin "$1" "$@" done --verbose ${HOME} -eu sed && | printf grep
+		$(pwd) -eu && ${HOME} "$@" 2>/dev/null && cd awk export "$1" "$1" | "$1"
+	local 'quoted text' /usr/bin ${HOME} test
+		grep local ${HOME} done done "$@" awk sed export awk test cd
+	export printf readonly awk -eu test done
+x=1 readonly $(pwd) | && local 'quoted text' | then sed ${HOME}
+'quoted text' done printf awk cd x=1 awk awk then
+		"$1" readonly --verbose done /usr/bin
+	${HOME} $(pwd) awk 2>/dev/null "$@" && | echo "$@" -eu export echo
+	${HOME} cd sed "$@" done -eu then done "$@" local export test done /usr/bin
+		local "$@" --verbose echo "$1" export && export
+		readonly | grep /usr/bin then
+		done 2>/dev/null ${HOME} x=1 x=1 /usr/bin | local grep --verbose -eu --verbose
+${HOME} $(pwd) printf echo && awk
+		sed && && awk $(pwd) -eu /usr/bin | /usr/bin grep sed export grep 2>/dev/null x=1
+		readonly awk 2>/dev/null && "$@" readonly x=1 printf
+		awk x=1 sed done awk ${HOME} then && echo readonly
+done readonly cd "$@" 'quoted text' readonly grep 2>/dev/null x=1 2>/dev/null
+export x=1 echo | grep readonly --verbose test sed "$1" /usr/bin --verbose
+		$(pwd) $(pwd) --verbose test ${HOME} printf $(pwd) grep 2>/dev/null
+		test local 2>/dev/null echo $(pwd)
+		sed test -eu done awk cd
+	-eu grep test 'quoted text' cd done printf then --verbose
+		$(pwd) "$1" readonly readonly
+printf --verbose then x=1 done readonly --verbose -eu $(pwd) printf ${HOME}
+${HOME} $(pwd) -eu sed then then sed
+	echo | local sed 2>/dev/null 'quoted text' --verbose x=1 then grep | done
+		${HOME} cd "$1" local readonly 2>/dev/null done awk x=1 grep
+grep --verbose | ${HOME} "$@" "$1" echo $(pwd) awk x=1
+		test readonly test awk $(pwd)
+	$(pwd) printf export echo -eu "$@" cd printf $(pwd)
+grep --verbose test test --verbose echo export --verbose
+${HOME} then then 'quoted text' grep | $(pwd) awk 'quoted text' awk grep
+		grep -eu readonly "$@" grep | "$@" printf /usr/bin 'quoted text'
+		export sed "$1" -eu && ${HOME} echo x=1 grep 'quoted text' x=1 x=1 printf
+test 2>/dev/null test cd && export | --verbose | done 'quoted text' ${HOME} echo
+	"$1" "$1" | test --verbose export x=1 export -eu
+	readonly sed cd then 2>/dev/null
+	readonly done echo "$@" cd
+		2>/dev/null -eu done --verbose 'quoted text' grep grep && cd sed grep
+	2>/dev/null test export readonly --verbose awk export /usr/bin test $(pwd)
+	test done 2>/dev/null "$@" local "$@" "$@" readonly awk test awk "$1" awk then
+		printf export done /usr/bin sed grep then
+2>/dev/null local printf 'quoted text' | | echo printf then "$1" $(pwd)
+		awk local ${HOME} then readonly | ${HOME} && then /usr/bin 'quoted text'
+		"$1" readonly /usr/bin "$@" grep /usr/bin | -eu awk "$@" grep
+		-eu $(pwd) readonly /usr/bin "$1"
+	&& /usr/bin local grep printf ${HOME} sed printf -eu && x=1 test --verbose
+sed grep grep && $(pwd) 'quoted text' cd grep $(pwd) "$1" cd x=1 --verbose ${HOME}
+		then local ${HOME} echo x=1 'quoted text'
+		readonly && cd $(pwd) --verbose local grep x=1 cd echo then export
+		echo "$1" export 2>/dev/null sed cd echo export && /usr/bin x=1 $(pwd)
+		-eu sed printf | local | --verbose printf /usr/bin
+		then "$1" -eu echo readonly "$@" ${HOME} export --verbose export local
+		grep -eu && sed test echo | x=1
+		"$1" local --verbose x=1 'quoted text'
+		sed local -eu sed readonly
+		then test done x=1 printf echo printf
+		--verbose | echo export ${HOME} sed test 2>/dev/null awk
+export sed 'quoted text' echo /usr/bin 'quoted text' sed -eu /usr/bin &&
+/usr/bin | grep grep --verbose echo "$1" cd local
+"$@" grep $(pwd) /usr/bin printf test "$1" export readonly
+	'quoted text' printf export cd then && printf printf "$1" | sed export 2>/dev/null
+		"$1" sed --verbose awk | x=1 grep && printf
+local done test ${HOME} awk readonly grep $(pwd)
+		"$1" done grep echo local cd -eu local | | grep
+		&& sed readonly x=1 grep then /usr/bin readonly
+sed $(pwd) awk printf echo ${HOME} then | ${HOME} printf cd then "$@" done x=1
+--verbose x=1 ${HOME} printf | 2>/dev/null
+		2>/dev/null echo done && x=1 $(pwd) cd
+	awk local "$@" test readonly --verbose
+2>/dev/null && awk echo ${HOME} echo done grep | 'quoted text'
+| --verbose && local test --verbose grep cd --verbose
+&& cd readonly local printf 2>/dev/null
+		x=1 $(pwd) grep $(pwd) && then printf readonly $(pwd) "$1"
+		--verbose awk sed 'quoted text' "$1" /usr/bin
+		'quoted text' | local && echo cd 2>/dev/null sed ${HOME} && ${HOME} /usr/bin
+	sed 2>/dev/null 'quoted text' x=1 grep sed export local --verbose grep local
+		cd && && grep readonly awk && grep test | | | "$1" "$@" $(pwd)
+		readonly local $(pwd) export "$1" -eu x=1 'quoted text' grep
+	export done /usr/bin test readonly 2>/dev/null grep /usr/bin printf readonly
+		"$@" sed /usr/bin -eu sed test
+/usr/bin x=1 cd ${HOME} --verbose x=1 readonly echo "$1" && done
+	/usr/bin awk "$@" ${HOME}
+		"$1" awk $(pwd) sed echo echo |
+		test 'quoted text' awk "$@" export "$@" grep
+	-eu ${HOME} export "$@" readonly && done awk "$1" sed --verbose
+		&& echo | 2>/dev/null 2>/dev/null test echo $(pwd)
+	done /usr/bin | /usr/bin printf x=1 x=1 "$@" echo
+		printf && grep 2>/dev/null then
+		cd 'quoted text' cd echo x=1 2>/dev/null sed x=1
+		test then done awk cd echo x=1 local
+		echo -eu /usr/bin && "$1" 'quoted text'
+	"$1" "$1" $(pwd) 2>/dev/null | $(pwd) export printf /usr/bin
+	awk awk readonly echo /usr/bin x=1 local | 'quoted text'
+		local done /usr/bin awk --verbose && then
+	local done sed ${HOME} local readonly x=1 $(pwd) done
+grep ${HOME} /usr/bin -eu grep x=1 echo test readonly local
+		$(pwd) then ${HOME} test $(pwd) "$1" export
+2>/dev/null echo echo | 2>/dev/null
+	cd test readonly 2>/dev/null local x=1 $(pwd) export --verbose cd $(pwd)
+	export /usr/bin done "$1" | | done test "$1"
+		${HOME} cd 2>/dev/null export 'quoted text' awk grep local /usr/bin 'quoted text'
+		sed grep && --verbose printf cd readonly ${HOME} "$@" export
+printf grep "$@" awk readonly readonly echo /usr/bin
+		"$1" echo awk "$1" cd then && awk ${HOME} cd readonly -eu test readonly
+	readonly cd printf && --verbose cd awk | --verbose $(pwd)
+local readonly --verbose local 'quoted text' && $(pwd)
+then export | $(pwd) readonly grep $(pwd)
+	cd export sed "$@" "$1" 'quoted text' $(pwd) test
+		${HOME} echo test export export
+	--verbose --verbose ${HOME} printf x=1 --verbose --verbose
+${HOME} "$@" 2>/dev/null awk cd readonly ${HOME}
+awk 2>/dev/null x=1 sed cd 2>/dev/null grep -eu ${HOME}
+	awk | then | done readonly export readonly x=1 /usr/bin sed done /usr/bin &&
+	2>/dev/null 2>/dev/null done x=1 $(pwd) x=1 2>/dev/null /usr/bin readonly
+	awk cd cd test export then "$1" grep /usr/bin
+		"$@" ${HOME} x=1 then
+		sed "$1" 'quoted text' "$@" test
+'quoted text' printf test local 2>/dev/null --verbose -eu awk then
+	| done -eu cd ${HOME} -eu test done
+		then /usr/bin && 2>/dev/null x=1 | done readonly printf /usr/bin "$@" | -eu
+-eu awk ${HOME} $(pwd) && export then | cd
+		x=1 -eu export "$@" grep printf done /usr/bin
+grep x=1 local 2>/dev/null && "$@" $(pwd) test then ${HOME} local $(pwd) |
+done awk | && sed $(pwd) 2>/dev/null
+local ${HOME} "$@" export
+	"$@" && x=1 ${HOME} printf "$1" printf grep cd -eu cd then | --verbose 'quoted text'
+	--verbose awk $(pwd) 2>/dev/null $(pwd) cd $(pwd) local done $(pwd)
+	cd local $(pwd) --verbose
+awk printf local test local "$1" --verbose export awk readonly --verbose ${HOME}
+sed echo "$1" x=1 awk local
+	--verbose grep 'quoted text' --verbose $(pwd) /usr/bin "$@"
+done export done /usr/bin cd sed echo local --verbose local /usr/bin "$@" 2>/dev/null
+		x=1 $(pwd) x=1 done 2>/dev/null 'quoted text' ${HOME} readonly "$1" readonly
+		"$1" $(pwd) x=1 test "$@" | -eu local awk local ${HOME} 'quoted text' echo
+test /usr/bin printf --verbose 2>/dev/null readonly cd 'quoted text' 2>/dev/null
+		"$1" | awk printf printf
+		"$@" readonly --verbose | ${HOME} grep 'quoted text' "$@"
+readonly /usr/bin local echo | 2>/dev/null sed test -eu done printf
+x=1 ${HOME} export awk 2>/dev/null echo /usr/bin test --verbose &&
+printf echo ${HOME} -eu | done "$1" 'quoted text' --verbose
+		test $(pwd) /usr/bin x=1 readonly
+${HOME} echo 2>/dev/null export grep
+		'quoted text' -eu x=1 printf --verbose 'quoted text' local test test cd
+--verbose printf "$1" 'quoted text' local -eu 'quoted text'
+2>/dev/null 'quoted text' x=1 awk export sed --verbose sed grep printf
+cd /usr/bin then --verbose -eu --verbose /usr/bin
+	test --verbose printf x=1
+		echo sed x=1 -eu readonly x=1 -eu done "$@" export "$@" x=1 awk cd cd
+	${HOME} $(pwd) | local 2>/dev/null cd readonly echo then sed
+--verbose "$@" export ${HOME} x=1 $(pwd) --verbose --verbose
+	export grep done "$1"
+	local printf -eu "$@" done awk 2>/dev/null -eu
+readonly /usr/bin cd readonly grep -eu && readonly
+		-eu grep /usr/bin --verbose cd printf ${HOME} export /usr/bin readonly
+x=1 x=1 done echo "$@" 2>/dev/null local ${HOME} "$1" 'quoted text'
+		awk readonly 2>/dev/null cd echo local /usr/bin 2>/dev/null
+	'quoted text' x=1 /usr/bin
+		"$1" "$1" 2>/dev/null --verbose /usr/bin | cd then readonly 'quoted text'
+	export export | echo export "$@" 'quoted text' export "$1" awk export readonly
+		${HOME} awk readonly readonly sed x=1 --verbose
+-eu ${HOME} /usr/bin awk --verbose
+	awk ${HOME} $(pwd) cd grep
+--verbose && then ${HOME}
+	'quoted text' 2>/dev/null -eu cd then then "$@" && ${HOME} sed
+test test then -eu "$@" ${HOME} printf && export ${HOME} -eu | -eu readonly
+	export grep grep export printf ${HOME} "$1" done test cd
+${HOME} test "$1" grep "$@" -eu export
+		x=1 test local --verbose
+printf local local readonly
+'quoted text' cd printf local cd x=1 'quoted text' export
+test sed "$@" readonly then $(pwd) "$@" "$@" "$1" echo --verbose
+echo /usr/bin export test "$1" 'quoted text'
+		test 2>/dev/null $(pwd) 'quoted text'
+	-eu done && --verbose test && printf then printf ${HOME} export
+		awk printf printf local echo "$@" 2>/dev/null echo && test
+		grep grep "$1" | grep "$@" echo then awk grep awk cd ${HOME} --verbose cd export
+	-eu awk && $(pwd) | x=1 $(pwd) export cd --verbose | 2>/dev/null echo
+"$1" sed sed export done echo cd awk done -eu
+	x=1 -eu | sed && | && export
+&& 2>/dev/null "$@" x=1 &&
+		2>/dev/null then -eu printf "$@" "$1" cd ${HOME} -eu | --verbose -eu && awk readonly
+then --verbose ${HOME}
+	local $(pwd) sed 'quoted text'
+	cd -eu done sed -eu test 'quoted text' test | --verbose
+		cd grep awk sed 2>/dev/null cd then && cd awk ${HOME} 'quoted text' 'quoted text'
+${HOME} "$1" "$1" 2>/dev/null
+		/usr/bin -eu && && cd -eu test --verbose 2>/dev/null awk x=1 2>/dev/null 2>/dev/null
+		sed export printf 'quoted text' grep readonly grep sed
+		export done ${HOME} cd | grep then awk
+		$(pwd) | done "$@" 2>/dev/null sed cd && /usr/bin
+	2>/dev/null ${HOME} grep sed cd sed awk /usr/bin
+	sed readonly x=1 /usr/bin grep then local printf && --verbose && "$1"
+		2>/dev/null cd awk "$@"
+	done awk x=1 printf -eu export
+		done cd readonly test "$@" /usr/bin ${HOME} "$1" test
+	-eu done /usr/bin ${HOME} printf grep -eu cd then "$@" echo done export
+		/usr/bin grep | --verbose readonly --verbose sed echo --verbose -eu
+		awk cd echo $(pwd) | test sed cd local 2>/dev/null
+/usr/bin ${HOME} /usr/bin -eu readonly cd 2>/dev/null $(pwd) "$@" -eu "$1" "$@"
+	grep test 'quoted text' x=1 readonly test echo ${HOME}
+	x=1 /usr/bin /usr/bin grep "$@" readonly 2>/dev/null export awk echo 'quoted text'
+done echo "$1" 'quoted text' sed test echo
+	grep export export "$@" grep printf | --verbose /usr/bin 2>/dev/null
+		/usr/bin echo cd sed /usr/bin $(pwd) then "$@"
+	'quoted text' readonly && test && export readonly readonly
+awk --verbose -eu 2>/dev/null
+awk echo readonly x=1 -eu local | grep "$1" local /usr/bin 'quoted text'
+	$(pwd) 'quoted text' "$1" echo
+		'quoted text' printf 'quoted text'
+	readonly local | ${HOME} "$1" x=1 2>/dev/null 2>/dev/null done
+	${HOME} sed 'quoted text' && -eu cd "$@" 'quoted text' | grep done
+		2>/dev/null local | echo $(pwd) 2>/dev/null -eu | /usr/bin ${HOME} test then -eu
+--verbose 2>/dev/null awk "$1" local x=1
+2>/dev/null local test done sed 'quoted text' then "$@" awk x=1 /usr/bin
+	done readonly export x=1
+		$(pwd) cd && && ${HOME} awk
+		export sed "$1" then /usr/bin "$1" -eu sed test "$@"
+done then awk "$@" "$1" readonly x=1 "$@" "$1" && done test sed /usr/bin grep
+grep x=1 && then done export | --verbose then then
+		&& sed test "$1" "$@" local /usr/bin awk ${HOME} | test $(pwd) $(pwd) -eu
+	--verbose then | local export echo printf
+done readonly 2>/dev/null local
+	-eu x=1 /usr/bin /usr/bin 'quoted text' printf && 2>/dev/null 2>/dev/null && "$@"
+		x=1 test test -eu printf ${HOME} "$1" echo awk test "$1" sed
+	readonly $(pwd) awk awk -eu x=1 | | readonly test
+		/usr/bin "$@" --verbose $(pwd) test readonly | "$1" -eu x=1 grep local echo 'quoted text'
+		x=1 ${HOME} 2>/dev/null readonly
+x=1 sed ${HOME} 'quoted text'
+export sed awk done echo "$1" -eu && sed test "$1"
+		export "$@" "$1" --verbose
+	-eu "$@" "$1" /usr/bin grep cd "$1" cd export
+	readonly 'quoted text' ${HOME} echo /usr/bin /usr/bin x=1 readonly done echo
+	printf readonly done awk sed 2>/dev/null
+	echo echo ${HOME} export then 2>/dev/null "$1" ${HOME} export
+	2>/dev/null 2>/dev/null | ${HOME} grep && echo ${HOME} 2>/dev/null
+	printf awk awk 'quoted text'
+readonly printf grep x=1 /usr/bin awk && cd && "$1" -eu x=1 x=1
+export "$@" sed | --verbose grep export cd ${HOME} grep 2>/dev/null
+	cd 2>/dev/null /usr/bin done export then
+	${HOME} -eu test test local | x=1 test done --verbose echo awk echo 'quoted text'
+&& test awk $(pwd) x=1 && echo -eu echo printf
+	export then awk test then readonly sed "$1" readonly | $(pwd)
+	echo x=1 x=1 'quoted text' then export $(pwd) /usr/bin -eu "$@" /usr/bin sed
+		export | export --verbose echo ${HOME} readonly grep awk grep
+-eu awk "$1" && ${HOME} printf echo $(pwd) 2>/dev/null
+cd | --verbose --verbose | "$1" -eu sed local cd
+		printf readonly "$@" local
+$(pwd) && awk /usr/bin
+test ${HOME} --verbose ${HOME} -eu echo echo
+&& -eu "$1" --verbose /usr/bin
+awk ${HOME} printf $(pwd) echo /usr/bin && "$@"
+	| 2>/dev/null export 'quoted text' $(pwd) readonly /usr/bin export
+	export | done readonly "$1" "$@" x=1 cd local -eu then echo
+	awk ${HOME} --verbose export awk test x=1 $(pwd) awk --verbose 'quoted text' $(pwd)
+"$@" ${HOME} 2>/dev/null --verbose
+$(pwd) grep test x=1 readonly cd then | export
+cd | local grep ${HOME} $(pwd) -eu -eu ${HOME} readonly done "$@"
+'quoted text' readonly export 'quoted text' /usr/bin
+test echo ${HOME} 2>/dev/null "$1" export "$@" 'quoted text'
+		grep --verbose /usr/bin 2>/dev/null /usr/bin
+		$(pwd) && printf printf local test done "$1" 2>/dev/null 'quoted text' $(pwd)
+&& then awk /usr/bin "$1" done
+	/usr/bin printf "$1" $(pwd) awk then
+		export "$@" ${HOME} then 2>/dev/null
+		-eu ${HOME} && grep grep 2>/dev/null
+		${HOME} "$@" --verbose /usr/bin "$1" test "$@"
+	2>/dev/null grep echo export /usr/bin
+echo "$@" readonly "$@" 'quoted text' ${HOME} 'quoted text'
+$(pwd) $(pwd) local then 2>/dev/null ${HOME}
+test printf export ${HOME} local test "$@" && "$1" "$1" awk "$1" readonly
+	readonly "$@" | readonly && then sed 2>/dev/null | $(pwd) awk awk echo export --verbose
+		done "$@" /usr/bin grep printf $(pwd)
+		echo $(pwd) printf grep export export --verbose "$1" done /usr/bin
+"$@" x=1 awk echo export readonly
+&& x=1 --verbose echo && local | then --verbose
+	echo done grep "$1" -eu ${HOME}
+	local done echo /usr/bin x=1 test 2>/dev/null "$@" $(pwd)
+	grep | | export then echo grep printf -eu echo awk
+		local --verbose | done grep then
+	readonly ${HOME} printf echo ${HOME} cd
+		sed "$1" ${HOME} awk grep $(pwd) ${HOME} echo grep export 2>/dev/null --verbose
+	"$1" "$1" "$@" "$1" | sed | --verbose "$@" $(pwd) --verbose
+grep 'quoted text' --verbose then local echo done "$@" ${HOME} echo --verbose
+$(pwd) "$1" --verbose awk "$1" cd x=1 $(pwd)
+printf 2>/dev/null --verbose "$@"
+export test echo 2>/dev/null awk echo 'quoted text' --verbose export && $(pwd)
+		echo && then grep awk then sed grep export cd -eu test local | 'quoted text'
+	grep then awk sed | $(pwd) /usr/bin sed
+		then /usr/bin readonly | 2>/dev/null x=1 ${HOME}
+		awk local echo cd readonly x=1 cd sed sed then echo "$@" 2>/dev/null readonly
+awk "$1" /usr/bin | | then echo test /usr/bin awk readonly --verbose grep cd
+		done readonly local export sed local done /usr/bin 2>/dev/null
+	then grep x=1 cd then sed printf "$@" test sed --verbose echo --verbose
+	"$1" 'quoted text' | | $(pwd) "$@" cd "$@" -eu then printf /usr/bin
+	&& --verbose 2>/dev/null ${HOME} local ${HOME} then test "$1"
+		grep cd printf ${HOME} && export -eu x=1 && /usr/bin
+"$1" "$1" 'quoted text' && 'quoted text' | && cd | test readonly
+		/usr/bin -eu | && x=1 local done $(pwd) readonly export local grep -eu local
+		echo export printf /usr/bin grep cd "$1" x=1 export done
+		export $(pwd) test 'quoted text' "$@" |
+	grep local local echo export "$1" done
+	/usr/bin grep 'quoted text' /usr/bin test cd /usr/bin cd "$1"
+	done -eu /usr/bin done printf test
+export printf | readonly && --verbose then grep local
+then /usr/bin done 2>/dev/null done "$1" local grep "$1" /usr/bin readonly local
+		then readonly readonly
+		test grep x=1 ${HOME} "$1" export && test && && $(pwd) printf echo awk "$1"
+		2>/dev/null cd x=1 readonly --verbose sed --verbose done
+printf | "$@" cd local 'quoted text'
+		grep "$@" awk | --verbose done cd then then "$@" local
+	-eu | cd -eu x=1 ${HOME} && | 2>/dev/null
+	local sed readonly -eu awk $(pwd) $(pwd)
+		export /usr/bin cd test && export x=1 readonly export then test
+	done x=1 -eu printf "$1" &&
+test printf /usr/bin test ${HOME} $(pwd) /usr/bin printf
+		/usr/bin readonly 2>/dev/null x=1 readonly then 2>/dev/null
+cd sed | printf /usr/bin ${HOME} 'quoted text' cd then done export | readonly
+	test "$1" local "$1" "$1" 2>/dev/null done
+		echo 'quoted text' sed test export --verbose grep
+	-eu done "$@" 'quoted text' -eu && "$1" test test 'quoted text'
+		echo && then cd sed --verbose x=1 'quoted text'
+	--verbose $(pwd) "$1" local then "$@" sed grep
+awk 2>/dev/null "$@" /usr/bin $(pwd) sed readonly --verbose cd && grep test printf
+		grep awk --verbose --verbose done 'quoted text' echo -eu test ${HOME} "$1"
+cd -eu printf cd x=1 echo export readonly x=1 export done $(pwd) export readonly
+		$(pwd) 'quoted text' | $(pwd)
+	readonly | sed export "$1" "$1" 'quoted text' done done export
+	| $(pwd) && readonly test
+		grep --verbose --verbose
+sed --verbose "$1" && ${HOME} "$1" 'quoted text'
+	$(pwd) 'quoted text'
+	export "$1" export 2>/dev/null grep x=1 then echo --verbose awk
+	cd "$@" done echo echo test $(pwd) && readonly
+	"$@" export -eu awk 2>/dev/null $(pwd) sed sed
+		"$1" "$@" x=1 local cd $(pwd) readonly grep cd /usr/bin
+		x=1 2>/dev/null readonly sed | x=1
+		x=1 2>/dev/null sed awk readonly && cd && awk then -eu --verbose
+awk cd printf | export readonly -eu $(pwd)
+		"$1" awk echo -eu --verbose readonly | grep then readonly echo 'quoted text'
+		$(pwd) | && done done echo x=1 /usr/bin then test test printf $(pwd) export
+echo then sed 'quoted text' $(pwd)
+echo -eu | readonly awk echo x=1 ${HOME} cd sed | "$@" "$1" then readonly
+		readonly $(pwd) --verbose $(pwd) test export printf echo 'quoted text' x=1 done
+		printf && cd readonly local printf
+		x=1 awk -eu test cd test local then grep | then readonly &&
+		test 'quoted text' printf $(pwd) printf -eu 'quoted text'
+		&& 2>/dev/null && grep printf awk "$1" --verbose then
+		grep 'quoted text' printf --verbose
+	awk export echo $(pwd) -eu sed readonly ${HOME}
+	/usr/bin export done grep x=1 then awk && -eu awk awk echo &&
+x=1 local printf -eu awk grep && sed "$1" cd &&
+	&& readonly | --verbose done local test 'quoted text' then sed local "$1" | 'quoted text'
+	done echo | --verbose /usr/bin readonly test sed export
+'quoted text' cd "$1" 'quoted text' "$1" printf /usr/bin then | --verbose
+done $(pwd) | "$@" local printf grep &&
+	test | local done printf /usr/bin "$@" test awk --verbose readonly | 'quoted text'
+2>/dev/null && "$@" readonly x=1 cd readonly local x=1 $(pwd) awk -eu awk -eu --verbose
+		grep local x=1 "$@" "$1" awk ${HOME} local printf
+		readonly sed cd $(pwd) /usr/bin local
+local 'quoted text' ${HOME} grep export "$1" printf
+printf "$@" echo x=1 | 'quoted text' done sed echo cd --verbose cd
+	-eu export local "$@" grep export local readonly ${HOME} 2>/dev/null
+export "$1" "$@" cd | local | "$@" | sed x=1 done
+2>/dev/null test sed && cd $(pwd)
+x=1 'quoted text' 'quoted text' "$1" --verbose test | export x=1 grep ${HOME}
+done "$@" test grep "$@" readonly $(pwd) x=1 sed | printf awk printf sed ${HOME}
+		cd awk $(pwd) export sed echo readonly 'quoted text'
+		"$1" printf echo x=1 echo --verbose cd grep && printf $(pwd) export
+export awk /usr/bin then printf && readonly "$1" "$1" printf
+test printf x=1 printf
+then then test && x=1 --verbose echo ${HOME} awk sed $(pwd) test -eu | grep /usr/bin
+export 'quoted text' local awk test 2>/dev/null readonly grep export then then
+	&& export cd echo cd readonly
+		readonly && /usr/bin echo | "$1" export ${HOME}
+		local 2>/dev/null local printf
+'quoted text' 'quoted text' x=1 -eu $(pwd)
+	export | echo | echo x=1 $(pwd) -eu test ${HOME} "$@" then ${HOME} export printf
+		'quoted text' grep export local printf readonly echo cd 2>/dev/null test
+		-eu local "$@" | export printf
+	awk test && 2>/dev/null /usr/bin local local
+		readonly cd echo awk -eu 2>/dev/null
+sed readonly readonly "$1" -eu /usr/bin
+	| -eu local 'quoted text' local
+	--verbose ${HOME} 'quoted text' ${HOME} done -eu awk test 'quoted text'
+		x=1 done 2>/dev/null x=1 | 2>/dev/null 'quoted text' grep "$1" echo then 'quoted text'
+		$(pwd) "$1" && export "$1" sed ${HOME} "$1" ${HOME} $(pwd) printf $(pwd)
+		cd test x=1 sed $(pwd) -eu sed export -eu "$1" -eu
+	readonly cd | 'quoted text' /usr/bin echo 2>/dev/null test
+&& 2>/dev/null printf grep -eu x=1 | --verbose -eu 2>/dev/null "$@" sed
+$(pwd) 2>/dev/null ${HOME} export awk x=1 "$@" | "$1"
+		readonly awk 2>/dev/null -eu export ${HOME}
+	| --verbose --verbose done 2>/dev/null 2>/dev/null test done then then
+/usr/bin cd "$@" cd done -eu /usr/bin
+"$@" awk echo /usr/bin | 2>/dev/null readonly local --verbose $(pwd) "$@" --verbose
+	cd && echo readonly 2>/dev/null &&
+local cd && awk 2>/dev/null "$@" done "$1"
+--verbose printf "$1" sed "$@" /usr/bin | grep 2>/dev/null
+	echo && then export 'quoted text' $(pwd) 'quoted text' grep "$@" $(pwd) $(pwd)
+		-eu sed done 2>/dev/null "$1" /usr/bin -eu done
+awk test "$1" 'quoted text'
+		then then export local "$1" $(pwd) test "$1" 'quoted text'
+	cd 'quoted text' && grep then local grep readonly
+cd ${HOME} grep 'quoted text' "$1" echo --verbose
+		test printf printf then done printf 'quoted text'
+		| awk then local "$@" readonly | done then | done 2>/dev/null readonly export
+		| "$@" done && local $(pwd) -eu test /usr/bin readonly
+--verbose export "$@" 2>/dev/null ${HOME} sed --verbose
+		printf | "$@" then local printf --verbose awk
+	cd 2>/dev/null -eu -eu "$1" $(pwd) then 'quoted text' x=1 local "$@" "$@" grep
+done readonly ${HOME} awk readonly -eu /usr/bin "$@"
+grep --verbose echo readonly then grep export | --verbose echo sed "$@"
+		sed printf export /usr/bin /usr/bin done cd | "$@" grep then then -eu x=1 2>/dev/null
+$(pwd) 2>/dev/null awk
+"$1" awk && /usr/bin /usr/bin -eu grep sed && awk --verbose cd $(pwd) echo
+	| export ${HOME} | then test awk | 2>/dev/null 'quoted text'
+		&& -eu done readonly readonly -eu "$1" ${HOME}
+	then --verbose && grep then && /usr/bin readonly test 2>/dev/null
+&& awk && "$@" "$1" "$1" $(pwd) test sed echo "$@"
+"$1" --verbose printf awk cd sed sed | grep && --verbose /usr/bin && done awk
+	awk | 'quoted text' cd
+		sed /usr/bin 'quoted text'
+	${HOME} x=1 readonly printf test test x=1
+	cd x=1 "$@" x=1 export sed grep sed && grep echo "$@" --verbose
+'quoted text' sed 2>/dev/null
+		"$1" $(pwd) -eu -eu test "$@" 'quoted text' /usr/bin sed -eu sed
+awk awk printf 2>/dev/null echo grep readonly "$1" --verbose $(pwd)
+		2>/dev/null "$1" done 'quoted text'
+"$1" then sed printf "$@" grep awk done
+	export 2>/dev/null | local grep $(pwd)
+		then grep grep x=1 sed readonly awk sed "$@" then export cd "$@" readonly ${HOME}
+		echo awk test awk x=1 awk echo local cd printf ${HOME} x=1 && && && ${HOME}
+	2>/dev/null -eu "$@" done export grep -eu local test test "$@" cd /usr/bin "$@"
+	printf awk $(pwd) "$@" && 'quoted text'
+		'quoted text' sed local
+		"$1" 2>/dev/null $(pwd) then | 'quoted text'
+		export -eu --verbose echo then x=1 ${HOME}
+	--verbose /usr/bin $(pwd) ${HOME} done grep |
+	-eu | sed $(pwd) local 'quoted text' | | /usr/bin ${HOME} done /usr/bin
+#include c63.sh
+		echo 2>/dev/null cd local awk $(pwd) /usr/bin 'quoted text' printf && cd awk
+	$(pwd) ${HOME} cd then sed local -eu cd awk then cd readonly
+		| 2>/dev/null export 'quoted text' -eu --verbose
+readonly awk echo x=1 $(pwd)
+		"$1" done && echo "$1" | awk | $(pwd)
+	"$@" local $(pwd) && | "$1" export readonly /usr/bin "$@" export cd ${HOME} export
+2>/dev/null "$1" 'quoted text' "$1"
+--verbose echo printf test echo
+printf test ${HOME} $(pwd) sed done && && cd awk grep ${HOME}
+then test awk done && $(pwd) awk &&
+then -eu echo | printf echo x=1 printf && 2>/dev/null "$1" 2>/dev/null readonly
+		grep --verbose 2>/dev/null cd
+		2>/dev/null export echo | cd printf then done |
+2>/dev/null local 2>/dev/null export awk --verbose echo then
+		readonly "$@" then grep "$@" $(pwd) grep awk export printf $(pwd) grep test
+		${HOME} then /usr/bin --verbose sed -eu
+	--verbose echo ${HOME} x=1 done
+		"$@" done /usr/bin "$@" 'quoted text' | printf ${HOME} echo
+	test echo "$@" readonly /usr/bin x=1 export
+		done grep echo 2>/dev/null -eu local
+export -eu then $(pwd) readonly | echo --verbose | ${HOME}
+	export then $(pwd) "$1"
+	-eu awk done -eu -eu sed test awk 2>/dev/null
+		| | readonly -eu --verbose done cd "$@" x=1 grep readonly
+echo test --verbose printf $(pwd)
+/usr/bin readonly then cd "$@" 2>/dev/null export x=1 -eu
+	"$@" test ${HOME} && local | local --verbose test $(pwd)
+		printf ${HOME} x=1 --verbose
+--verbose | 2>/dev/null $(pwd) 2>/dev/null
+		"$1" sed "$1" /usr/bin grep readonly readonly awk sed local && ${HOME}
+		done local $(pwd) printf $(pwd) sed awk printf "$@" then test done $(pwd)
+		/usr/bin ${HOME} "$@" sed /usr/bin
+		local awk grep sed --verbose $(pwd) $(pwd) --verbose grep readonly
+		grep x=1 cd x=1 'quoted text' echo "$1" done
+	/usr/bin echo local awk awk export -eu ${HOME}
+cd /usr/bin export awk ${HOME} "$@" && grep && /usr/bin grep
+local && printf 'quoted text' -eu
+	local readonly grep /usr/bin
+		then /usr/bin awk ${HOME} -eu
+		echo echo --verbose "$@" 'quoted text'
+	| awk ${HOME} $(pwd) 'quoted text' printf test grep && awk /usr/bin
+grep then printf /usr/bin $(pwd) echo done readonly x=1 sed "$1"
+		'quoted text' echo | ${HOME} grep export export echo $(pwd) $(pwd)
+	2>/dev/null "$@" 'quoted text' 2>/dev/null "$1" sed -eu && echo $(pwd) local awk
+	test test done echo | readonly ${HOME} printf grep
+	-eu done local awk test readonly 2>/dev/null grep | awk export
+	"$1" test --verbose test awk x=1 readonly printf
+	test /usr/bin export readonly && x=1 export 2>/dev/null printf "$1"
+		export "$1" "$1" export
+		/usr/bin /usr/bin $(pwd) --verbose ${HOME} x=1 grep && ${HOME} grep printf
+	/usr/bin then -eu awk ${HOME} readonly sed "$1" printf
+		readonly test test 2>/dev/null
+		'quoted text' sed awk --verbose
+	| && | test test export done readonly
+		grep export -eu x=1 awk readonly grep
+$(pwd) local done sed cd done -eu readonly awk
+		2>/dev/null export sed -eu /usr/bin 'quoted text' "$1" export /usr/bin
+	&& --verbose | "$@" cd --verbose sed "$1" local grep "$1"
+		then export test --verbose -eu "$1" echo /usr/bin ${HOME} ${HOME}
+${HOME} readonly && -eu
+readonly cd "$@" ${HOME} awk echo cd && $(pwd) /usr/bin
+	done ${HOME} $(pwd) -eu --verbose done /usr/bin /usr/bin local
+		done sed $(pwd) cd test ${HOME} /usr/bin
+		test grep /usr/bin cd grep /usr/bin 'quoted text' sed then "$1" export --verbose
+	awk export 2>/dev/null sed cd --verbose 'quoted text' readonly export --verbose
+	-eu readonly ${HOME} export --verbose sed --verbose sed /usr/bin && export --verbose
+| x=1 awk x=1 awk ${HOME} | "$@"
+${HOME} $(pwd) /usr/bin
+	&& | | | ${HOME} ${HOME} | $(pwd)
+	sed 2>/dev/null "$@" done then sed x=1 'quoted text' /usr/bin grep then
+	x=1 grep ${HOME} cd echo 'quoted text'
+--verbose "$1" done 2>/dev/null | export "$1" printf --verbose -eu x=1 local
+		grep export then /usr/bin
+	echo 'quoted text' x=1 x=1 "$1" printf x=1 2>/dev/null x=1
+	$(pwd) x=1 printf -eu -eu /usr/bin
+awk export done echo x=1 done "$1" export ${HOME}
+		&& "$@" sed 2>/dev/null 2>/dev/null done "$@" echo done "$@" /usr/bin --verbose
+$(pwd) -eu printf $(pwd) export local
+	then echo sed cd 'quoted text' grep
+printf x=1 --verbose echo && awk
+export $(pwd) export readonly echo sed readonly "$1" 'quoted text' echo
+	awk ${HOME} $(pwd) done
+	grep | cd && -eu | /usr/bin grep "$@" && ${HOME}
+	x=1 && awk done printf /usr/bin "$1" sed &&
+/usr/bin 'quoted text' 'quoted text' -eu local --verbose
+		printf /usr/bin grep /usr/bin
+	--verbose -eu grep /usr/bin -eu && then
+printf ${HOME} cd awk 2>/dev/null
+'quoted text' ${HOME} /usr/bin export -eu local test
+&& && | echo "$@" local ${HOME} sed export cd --verbose sed local
+grep local -eu local test "$@" | grep local awk "$@" ${HOME} && $(pwd) grep
+		readonly /usr/bin local grep /usr/bin then -eu
+/usr/bin export local ${HOME} grep then then readonly /usr/bin x=1
+'quoted text' awk | 'quoted text' |
+done echo done && $(pwd) x=1 2>/dev/null
+	&& -eu sed --verbose echo
+	then done printf 2>/dev/null export $(pwd) then &&
+		awk $(pwd) /usr/bin echo "$1" printf grep test local 'quoted text' local
+	"$@" printf readonly local 2>/dev/null 'quoted text'
+		grep x=1 x=1 sed cd local "$1" then printf /usr/bin 'quoted text' 'quoted text'
+	-eu local cd $(pwd) echo $(pwd) sed awk cd "$1" export && $(pwd)
+		readonly --verbose | local printf
+readonly local && local
+	2>/dev/null grep && /usr/bin -eu /usr/bin ${HOME} test ${HOME} x=1 2>/dev/null
+	local awk 2>/dev/null x=1
+printf echo awk sed -eu cd sed then echo local ${HOME} test "$@" $(pwd) 'quoted text'
+		| -eu cd test cd export
+export done test awk local test && "$1" && done done sed readonly
+	/usr/bin echo --verbose "$@" done export && $(pwd)
+2>/dev/null $(pwd) 2>/dev/null "$1" cd --verbose && 2>/dev/null printf
+| readonly then readonly ${HOME} printf |
+		echo x=1 local done "$1" -eu test printf printf --verbose
+cd readonly printf "$1" "$1" ${HOME}
+		local cd done ${HOME} echo
+readonly "$@" then x=1 test --verbose ${HOME} "$@" cd /usr/bin echo readonly echo
+&& echo echo --verbose "$1" export --verbose "$1" done 'quoted text' | --verbose
+		awk then local $(pwd) cd x=1 x=1 readonly done local
+	"$@" local x=1 grep done test
+| grep grep /usr/bin "$@" --verbose sed 2>/dev/null
+	awk cd readonly local x=1
+	printf /usr/bin echo export
+then "$1" local cd 'quoted text' grep grep awk "$1" echo export readonly
+	cd test x=1 'quoted text' cd local sed sed cd x=1 cd sed awk
+-eu local local done test "$1" grep local 2>/dev/null
+awk awk awk export test /usr/bin printf "$@" cd export readonly
+	test cd readonly awk && $(pwd) readonly "$1" printf -eu printf "$@" "$1" ${HOME}
+	test cd printf $(pwd) 'quoted text'
+		$(pwd) "$@" sed && "$@" x=1 echo
+		-eu 'quoted text' $(pwd) echo /usr/bin awk && /usr/bin
+		export local 2>/dev/null test done "$1" export awk
+		done printf test 'quoted text' 2>/dev/null --verbose $(pwd) 'quoted text'
+		done 2>/dev/null ${HOME} | export 'quoted text' && grep && "$@" sed ${HOME}
+	&& --verbose sed then
+		readonly $(pwd) cd local ${HOME} done cd x=1 |
+readonly -eu printf | test -eu done
+		test done then test cd -eu
+		'quoted text' sed sed done | "$@" "$@" sed x=1 test
+		${HOME} && "$1" && cd then echo 'quoted text' $(pwd) awk ${HOME}
+| && cd printf | 'quoted text' then printf ${HOME} echo local echo export export
+	done | sed done $(pwd) sed
+&& then done 'quoted text' done awk readonly 2>/dev/null $(pwd)
+${HOME} sed done echo local printf local -eu printf local then -eu
+echo export 2>/dev/null $(pwd) && 2>/dev/null then "$@"
+	done grep done printf readonly cd $(pwd) sed printf done
+export local 2>/dev/null cd -eu grep grep "$@" readonly
+	readonly test test done local printf
+sed $(pwd) | $(pwd) $(pwd) export then && sed grep awk /usr/bin -eu grep /usr/bin
+	&& /usr/bin grep ${HOME} -eu done $(pwd) grep && then | ${HOME} -eu ${HOME} awk
+	"$1" ${HOME} "$1" export echo "$1" then local 2>/dev/null cd awk then
+"$@" then sed "$@" --verbose done $(pwd) "$@" cd && done
+	then | /usr/bin x=1 && test "$@" readonly && test ${HOME} ${HOME} |
+		readonly && export ${HOME}
+${HOME} 2>/dev/null 'quoted text'
+printf then | x=1 readonly && $(pwd)
+then /usr/bin 2>/dev/null sed sed cd
+'quoted text' printf printf
+&& echo -eu --verbose grep $(pwd) && grep -eu && && sed
+	$(pwd) $(pwd) done | -eu --verbose then ${HOME}
+		"$@" then export then printf sed x=1 'quoted text'
+	test then ${HOME} test printf echo
+		sed ${HOME} && | x=1 -eu && && awk done test test $(pwd) test x=1 printf
+x=1 done ${HOME} done grep | then /usr/bin $(pwd)
+		x=1 readonly printf echo cd readonly $(pwd)
+	awk done x=1 sed test 2>/dev/null 'quoted text' | export export /usr/bin done
+"$1" awk "$@" awk "$1" $(pwd) echo export 2>/dev/null
+"$1" --verbose test then ${HOME} --verbose local echo readonly done 2>/dev/null
+	local then readonly test "$1" /usr/bin cd grep 'quoted text'
+x=1 sed printf 2>/dev/null done export -eu local grep readonly
+		done 'quoted text' 2>/dev/null 'quoted text'
+export cd grep "$@" "$@" 2>/dev/null then awk x=1 cd 'quoted text' echo 'quoted text'
+		&& test readonly done "$@" 'quoted text' done -eu /usr/bin
+		echo "$@" sed echo done
+	/usr/bin /usr/bin --verbose
+done $(pwd) -eu $(pwd) sed cd sed -eu export test -eu awk "$@"
+	&& test readonly awk | ${HOME} "$@" "$@" /usr/bin local --verbose sed
+	&& echo -eu ${HOME} local 'quoted text'
+		| /usr/bin printf awk grep
+	export then | "$1" && | export $(pwd)
+		then -eu cd export test && --verbose cd /usr/bin x=1 done 2>/dev/null readonly
+		local sed done /usr/bin
+sed "$@" 2>/dev/null
+		-eu "$@" readonly awk export export echo awk readonly awk | printf
+readonly sed local awk awk $(pwd) local "$1" echo printf
+	awk cd readonly sed cd readonly -eu ${HOME} "$@" -eu "$1" 2>/dev/null
+test readonly -eu export awk $(pwd) ${HOME}
+test ${HOME} ${HOME} 2>/dev/null test 'quoted text'
+export 'quoted text' test test sed | --verbose sed ${HOME} awk done $(pwd) 'quoted text'
+	local awk "$@" cd -eu sed -eu done
+		--verbose "$1" 2>/dev/null local
+	--verbose grep awk sed export 2>/dev/null local grep grep /usr/bin /usr/bin
+&& local -eu "$@" export then test /usr/bin
+	printf test /usr/bin | && $(pwd)
+	-eu done local local $(pwd) "$1" "$1" test echo
+	-eu awk --verbose "$@" -eu local && 2>/dev/null done local x=1 x=1
+		cd "$@" done /usr/bin readonly "$1" ${HOME}
+${HOME} readonly then then | "$1" 2>/dev/null && sed
+		echo $(pwd) x=1 printf | "$1" 2>/dev/null $(pwd) $(pwd) 'quoted text'
+		cd 2>/dev/null "$@" --verbose
+		&& then echo awk /usr/bin "$@" $(pwd) --verbose
+local test export 2>/dev/null
+		echo && done sed 'quoted text'
+		${HOME} | --verbose $(pwd)
+then grep readonly printf readonly "$1" --verbose
+	$(pwd) readonly $(pwd) export ${HOME}
+test export 'quoted text' | -eu ${HOME} echo 'quoted text'
+printf x=1 2>/dev/null then "$@" 'quoted text' $(pwd)
+'quoted text' echo /usr/bin | grep printf cd $(pwd) sed "$@" sed -eu "$@"
+-eu local awk /usr/bin "$1" --verbose /usr/bin readonly grep grep done
+		local then awk export cd echo $(pwd)
+printf -eu printf "$@" "$1" "$1" local awk | -eu ${HOME} 'quoted text' grep "$1"
+	| test "$1" && local test && awk
+done 2>/dev/null export $(pwd) "$1" 2>/dev/null
+printf | done cd echo -eu export printf "$1"
+		| test readonly local awk 2>/dev/null grep test
+		grep local local ${HOME} "$@" done "$@" then then && x=1 ${HOME}
+		--verbose /usr/bin x=1 2>/dev/null "$@" awk then sed 2>/dev/null
+		sed sed test && grep $(pwd) $(pwd) /usr/bin done | "$1" &&
+	x=1 ${HOME} echo ${HOME} readonly
+--verbose grep export export
+printf awk done grep cd sed export grep 'quoted text' cd
+--verbose local test | "$1" then echo cd echo sed ${HOME}
+		local sed cd then 'quoted text' readonly export "$1" echo
+	grep then 'quoted text' readonly | sed ${HOME} "$@"
+	$(pwd) $(pwd) x=1 'quoted text'
+	readonly && cd /usr/bin /usr/bin printf ${HOME} cd printf | 2>/dev/null
+2>/dev/null readonly -eu --verbose
+local $(pwd) then && grep /usr/bin
+'quoted text' "$@" --verbose $(pwd) ${HOME} local
+		/usr/bin $(pwd) export 2>/dev/null ${HOME} grep then
+		test echo 'quoted text' then local "$1"
+--verbose grep printf echo printf printf
+		x=1 test printf | done $(pwd) --verbose
+	printf /usr/bin cd x=1 readonly then 2>/dev/null printf test sed export
+		/usr/bin --verbose awk awk grep cd -eu local export "$1" /usr/bin
+sed cd cd done "$1" echo 'quoted text' export test 'quoted text'
+		$(pwd) grep export /usr/bin -eu "$@" "$1" printf done export cd
+	test && | local done done -eu printf
+		then readonly grep sed /usr/bin /usr/bin x=1 awk /usr/bin awk --verbose ${HOME}
+"$@" ${HOME} -eu awk export then readonly x=1 &&
+		echo --verbose cd ${HOME} cd echo x=1 -eu 2>/dev/null then
+		$(pwd) /usr/bin $(pwd)
+		${HOME} ${HOME} --verbose --verbose /usr/bin
+	"$@" "$1" printf "$1" local printf readonly printf export "$@" done
+		${HOME} "$1" printf "$@"
+test test "$@" echo 'quoted text'
+		/usr/bin ${HOME} echo awk ${HOME} "$1" -eu readonly
+		'quoted text' -eu readonly printf test readonly "$1" "$1" then "$@" then
+	&& 'quoted text' | done local awk | 2>/dev/null
+readonly "$@" 2>/dev/null
+test readonly sed "$1" "$@" 2>/dev/null /usr/bin
+		"$@" done printf /usr/bin awk --verbose local -eu
+${HOME} readonly done sed 'quoted text' -eu echo $(pwd) 'quoted text'
+export sed local x=1 sed ${HOME} -eu
+	echo 'quoted text' /usr/bin x=1 awk "$@" -eu
+		readonly "$1" | export cd $(pwd)
+	echo && $(pwd) test cd grep | export printf
+printf awk --verbose && export sed printf printf ${HOME}
+| awk --verbose local printf x=1 ${HOME} cd echo done $(pwd)
+		test && sed --verbose | grep --verbose && test then "$1" export | cd echo
+	$(pwd) echo test readonly
+	grep && "$1" "$@" grep local then local && test 2>/dev/null echo awk | done done
+-eu cd awk done 2>/dev/null 2>/dev/null
+		"$1" sed test readonly "$1" "$1" test export -eu x=1 sed then |
+		/usr/bin grep "$@" x=1 grep echo echo export
+		local --verbose test $(pwd)
+2>/dev/null 2>/dev/null awk
+cd sed $(pwd) 2>/dev/null sed "$@" && /usr/bin
+		-eu -eu --verbose 2>/dev/null --verbose done then local awk echo awk $(pwd)
+'quoted text' local | printf && "$@" x=1 test printf |
+	2>/dev/null && 'quoted text' test --verbose then then
+	done awk /usr/bin && ${HOME}
+readonly sed awk /usr/bin
+then awk echo then done ${HOME} done done /usr/bin
+	done ${HOME} sed sed ${HOME} 2>/dev/null x=1 export
+		x=1 x=1 echo x=1 | "$@" readonly $(pwd) done --verbose
+	test $(pwd) /usr/bin $(pwd) printf -eu export test sed test && readonly
+--verbose printf local /usr/bin | then ${HOME} 'quoted text'
+cd done x=1 "$@" "$1" $(pwd) && | done done x=1 echo awk test awk -eu
+		grep sed done then readonly echo | echo sed sed 'quoted text' $(pwd) 'quoted text'
+	--verbose export cd &&
+		| echo echo /usr/bin 'quoted text' test
+	2>/dev/null "$@" && /usr/bin
+&& $(pwd) local then printf sed x=1 echo | 'quoted text' printf export
+		test | | 2>/dev/null cd export awk local local
+	export echo echo /usr/bin sed -eu /usr/bin "$1" 'quoted text' echo
+printf grep 'quoted text' 2>/dev/null
+2>/dev/null 2>/dev/null "$1" /usr/bin "$1" grep "$1" 'quoted text' ${HOME} done
+2>/dev/null readonly grep cd awk printf -eu
+awk test local sed readonly done echo readonly && 'quoted text'
+		local done sed 'quoted text' awk local ${HOME} ${HOME} /usr/bin
+		printf x=1 | sed grep export then ${HOME} && then test awk export local 'quoted text'
+awk 2>/dev/null printf "$@" test "$1" awk printf awk x=1 grep
+then $(pwd) test --verbose
+		| -eu test && /usr/bin | ${HOME} --verbose sed then x=1 /usr/bin ${HOME}
+		2>/dev/null | | "$@" -eu export export test
+		"$@" then sed x=1 "$@" "$1" 'quoted text' ${HOME}
+'quoted text' export then printf
+	awk x=1 grep echo | sed local /usr/bin "$1" done readonly awk
+	2>/dev/null cd grep /usr/bin
+		echo then -eu 2>/dev/null -eu "$1" "$@" 2>/dev/null
+export cd then local ${HOME} --verbose --verbose test
+	awk "$@" then awk && | -eu local echo && 'quoted text'
+-eu then awk 'quoted text' export echo "$@" x=1 sed
+	export readonly -eu readonly $(pwd) sed cd /usr/bin "$1" && awk export
+"$1" sed --verbose x=1 then printf /usr/bin
+	then 2>/dev/null $(pwd) readonly
+then 'quoted text' "$@" 'quoted text' echo then
+		"$1" cd -eu | ${HOME} | then export "$1"
+		grep 2>/dev/null 'quoted text' $(pwd) done $(pwd) --verbose "$1" local done /usr/bin
+		printf && --verbose && /usr/bin 'quoted text' readonly done
+	then export grep /usr/bin --verbose ${HOME} readonly "$@" echo done grep
+		"$1" "$@" --verbose then
+		'quoted text' local ${HOME}
+		'quoted text' local sed --verbose
+awk readonly export sed $(pwd)
+		grep readonly x=1 -eu $(pwd)
+$(pwd) done echo 2>/dev/null --verbose grep
+	test ${HOME} | done $(pwd)
+		x=1 test grep "$1" $(pwd)
+		"$@" && ${HOME} 'quoted text' --verbose grep ${HOME}
+		/usr/bin printf /usr/bin awk "$@" -eu
+		awk x=1 local readonly $(pwd) cd | --verbose then "$1"
+	sed ${HOME} printf cd echo then 'quoted text' export ${HOME} local
+sed 2>/dev/null sed printf x=1 --verbose
+		$(pwd) cd "$1" then awk readonly ${HOME} then grep /usr/bin printf
+		${HOME} ${HOME} x=1 awk done then /usr/bin --verbose ${HOME} 2>/dev/null
+		2>/dev/null && /usr/bin local | then echo printf --verbose
+		| then then /usr/bin grep -eu x=1 local
+	sed readonly --verbose 2>/dev/null $(pwd)
+&& export | $(pwd) done cd x=1 grep -eu test -eu 2>/dev/null
+		test /usr/bin ${HOME} grep --verbose | /usr/bin && /usr/bin
+	| sed 2>/dev/null echo sed && x=1 --verbose --verbose
+		2>/dev/null $(pwd) printf -eu
+	x=1 echo $(pwd) awk sed sed -eu cd local echo cd 2>/dev/null --verbose /usr/bin
+	sed awk printf cd export
+test && /usr/bin "$1" "$@" cd --verbose echo --verbose 'quoted text' "$@" echo
+	| local local /usr/bin "$@" --verbose local then
+printf | ${HOME} -eu
+echo export echo "$1" -eu test /usr/bin
+awk "$@" grep test x=1 && 2>/dev/null $(pwd) done local then readonly
+	then then ${HOME} export --verbose "$@" awk local
+$(pwd) local readonly then
+		| done echo --verbose readonly readonly
+		cd 2>/dev/null test "$1" /usr/bin /usr/bin | then sed 'quoted text'
+		grep test /usr/bin ${HOME} readonly $(pwd) /usr/bin
+	grep echo grep test /usr/bin readonly /usr/bin grep -eu && | grep readonly cd
+	"$1" "$@" test readonly -eu local then then | test --verbose
+	"$@" printf && grep ${HOME} /usr/bin export 2>/dev/null echo cd -eu cd
+done awk export readonly local done 'quoted text' /usr/bin ${HOME} $(pwd)
+	test done readonly echo printf 'quoted text' 2>/dev/null readonly
+&& local -eu awk local local readonly
+$(pwd) -eu | grep "$1" readonly
+done $(pwd) grep local 'quoted text' 2>/dev/null grep
+		awk local --verbose -eu readonly local | cd ${HOME} grep "$@" && grep $(pwd)
+	| 'quoted text' done | cd cd cd 2>/dev/null x=1 sed readonly readonly --verbose
+		sed ${HOME} "$@" printf sed
+		printf -eu "$@" local -eu $(pwd) echo export test local echo then
+		--verbose --verbose 2>/dev/null local then done echo 'quoted text' |
+| then printf awk $(pwd) readonly 'quoted text' printf then "$1" /usr/bin
+	readonly | sed done grep --verbose
+		| --verbose --verbose cd
+	echo cd cd test ${HOME} "$1" test x=1 $(pwd) then export
+"$@" echo x=1 grep | 'quoted text' | | ${HOME} echo /usr/bin ${HOME} printf 'quoted text'
+| --verbose awk readonly 'quoted text'
+	${HOME} && test -eu grep echo export
+	awk -eu --verbose done local
+	local && --verbose ${HOME} "$1" 2>/dev/null sed /usr/bin 'quoted text' readonly
+-eu ${HOME} | export echo cd echo awk local done sed export 'quoted text'
+		export grep 2>/dev/null && x=1 | -eu awk done 'quoted text' x=1 2>/dev/null $(pwd)
+	'quoted text' $(pwd) readonly
+		"$1" $(pwd) "$1" "$1" $(pwd) readonly then echo "$1" awk /usr/bin test done
+"$@" "$@" 'quoted text' then $(pwd) readonly grep --verbose test --verbose ${HOME}
+	grep -eu && sed printf awk ${HOME} awk | grep $(pwd) && cd cd && export
+		readonly /usr/bin /usr/bin && printf 2>/dev/null
+done grep local done readonly x=1 cd sed echo local then
+		test awk && /usr/bin x=1 'quoted text' cd 2>/dev/null 'quoted text'
+		awk | --verbose awk printf && 'quoted text' --verbose export
+	export $(pwd) 'quoted text' "$1" export "$@" export awk 2>/dev/null printf
+-eu x=1 'quoted text' $(pwd) export echo | awk | export
+	then grep echo x=1 done awk $(pwd) -eu --verbose | $(pwd) -eu -eu
+		2>/dev/null printf done local x=1 "$@" readonly && sed --verbose
+	sed local 'quoted text' 2>/dev/null printf
+	readonly /usr/bin awk done
+	echo readonly | cd cd test --verbose 2>/dev/null
+grep | printf -eu then x=1 "$1" echo sed test $(pwd) cd echo x=1 sed done "$@"
+		then --verbose | "$@" x=1 /usr/bin | --verbose x=1 cd printf export
+		--verbose test test sed 'quoted text' echo echo
+${HOME} readonly x=1 $(pwd) "$1" 2>/dev/null
+		sed $(pwd) | ${HOME} done cd | printf "$1" printf grep local
+	export then readonly echo "$@" then sed test | grep x=1 2>/dev/null
+	"$1" -eu ${HOME} $(pwd) then cd sed "$@" test | /usr/bin
+/usr/bin 'quoted text' $(pwd) | $(pwd) | echo
+/usr/bin done done x=1 x=1 /usr/bin echo echo
+grep done $(pwd) grep --verbose
+export "$1" x=1 --verbose
+	x=1 'quoted text' "$1" done awk local
+"$@" 2>/dev/null awk && cd "$@" cd awk export /usr/bin "$@"
+	'quoted text' 2>/dev/null | cd 2>/dev/null && readonly done readonly ${HOME}
+	grep printf /usr/bin cd then
+		echo ${HOME} done test |
+| 2>/dev/null $(pwd) readonly local sed grep --verbose readonly "$1" local
+		printf echo | -eu test --verbose
+${HOME} grep -eu grep sed "$@" x=1 $(pwd) done 'quoted text'
+grep readonly x=1 local echo
+		-eu done /usr/bin 2>/dev/null
+	"$@" then --verbose readonly grep readonly ${HOME}
+		echo /usr/bin 'quoted text' 2>/dev/null
+		local done -eu export readonly sed local cd |
+		| done 'quoted text' "$@" sed --verbose then "$@" /usr/bin -eu awk && readonly
+		readonly "$@" test then grep printf 'quoted text'
+	x=1 grep grep grep | /usr/bin
+		'quoted text' $(pwd) cd 'quoted text' | && sed cd export /usr/bin sed
+	"$@" | awk --verbose echo local
+		"$1" echo test cd then grep then /usr/bin
+		test --verbose | x=1 echo 2>/dev/null echo
+		cd export test ${HOME} readonly then grep --verbose && awk grep ${HOME} "$1"
+	readonly -eu done sed -eu "$1" local $(pwd) done | then "$1" printf awk
+	2>/dev/null "$1" 'quoted text' grep then | local | x=1 "$1" -eu test | "$@"
+		"$@" /usr/bin 'quoted text' done test x=1 cd then grep -eu readonly echo
+x=1 x=1 then sed "$1" readonly export grep echo x=1 readonly x=1 sed
+		cd 'quoted text' x=1 export
+'quoted text' x=1 test then | x=1 export "$1" printf
+	then --verbose cd then echo "$1" done echo cd -eu ${HOME} | --verbose
+	local test "$@" $(pwd) local
+'quoted text' done /usr/bin test ${HOME}
+	| test "$1" sed grep "$1" printf
+	sed x=1 readonly /usr/bin /usr/bin $(pwd) cd | -eu
+	test printf readonly /usr/bin readonly export local
+	| x=1 "$1" readonly done && sed sed -eu readonly 'quoted text'
+| awk && $(pwd) -eu "$@" local export "$1" done grep $(pwd) grep
+	--verbose -eu -eu awk && --verbose 2>/dev/null -eu sed "$1" && /usr/bin
+		then grep && grep then awk sed "$@" $(pwd) sed -eu test
+cd -eu "$@" "$1" | 'quoted text'
+		| "$@" "$@" readonly then sed 'quoted text' sed ${HOME}
+		2>/dev/null readonly done "$1" 2>/dev/null local then export printf grep
+	-eu "$@" cd local -eu echo sed x=1 echo echo export export
+	test export awk done 2>/dev/null x=1 echo "$1" awk -eu printf /usr/bin
+		| printf -eu /usr/bin 'quoted text' "$1" grep then 2>/dev/null awk grep "$@"
+	echo -eu --verbose "$1"
+		echo && "$1" test 'quoted text'
+printf test done done printf
+--verbose test local 'quoted text' "$@" /usr/bin cd
+sed -eu x=1 done echo --verbose "$@" 2>/dev/null 2>/dev/null "$1"
+	done done awk readonly echo /usr/bin $(pwd) local sed 'quoted text'
+then --verbose done x=1 export /usr/bin /usr/bin
+	grep done grep local printf export echo 'quoted text' 2>/dev/null
+		'quoted text' --verbose && -eu --verbose
+awk local -eu then readonly 2>/dev/null 2>/dev/null test echo sed x=1
+		then sed export awk export readonly printf x=1 readonly /usr/bin
+"$@" awk "$@" grep 2>/dev/null ${HOME} "$@" | done
+	readonly && "$@" "$1" echo grep 'quoted text' | &&
+	grep grep --verbose x=1 done 'quoted text'
+/usr/bin "$@" 'quoted text' -eu grep printf 2>/dev/null cd /usr/bin grep &&
+printf "$@" cd --verbose
+	-eu "$1" done done sed | done readonly
+		"$@" ${HOME} local /usr/bin
+	grep export 'quoted text'
+cd export | ${HOME} 2>/dev/null
+	${HOME} cd readonly sed cd cd /usr/bin readonly | | done grep --verbose awk
+then /usr/bin done /usr/bin 'quoted text' 2>/dev/null export /usr/bin
+	local ${HOME} --verbose local x=1 test test "$1" local --verbose /usr/bin
+		cd "$@" cd && --verbose /usr/bin
+printf echo local then && export /usr/bin awk export /usr/bin
+	"$@" "$@" awk echo x=1 export -eu -eu done echo cd
+local "$@" echo then 2>/dev/null
+	grep "$1" $(pwd) $(pwd) 2>/dev/null
+		then cd then test "$@" ${HOME} test
+		done awk -eu awk printf && $(pwd) 'quoted text' readonly ${HOME} /usr/bin
+	&& ${HOME} 'quoted text' $(pwd) export done cd 2>/dev/null grep
+		/usr/bin echo ${HOME} /usr/bin test 'quoted text' grep export -eu
+		'quoted text' "$@" test then local x=1 && "$1" /usr/bin x=1
+		readonly /usr/bin 'quoted text' && -eu
+	x=1 then done echo local "$1" ${HOME} "$@" ${HOME} local /usr/bin local
+grep --verbose && 2>/dev/null --verbose grep --verbose
+		echo "$1" /usr/bin 2>/dev/null
+echo | awk $(pwd) 'quoted text' x=1 'quoted text' sed
+		printf readonly done -eu readonly echo echo 2>/dev/null
+		printf then 2>/dev/null /usr/bin done done awk printf grep export
+	"$@" "$1" echo grep -eu && cd
+	&& cd readonly printf 2>/dev/null then 'quoted text'
+local /usr/bin $(pwd) export /usr/bin $(pwd) "$@" -eu done
+	/usr/bin printf ${HOME} "$@" -eu sed ${HOME} grep awk test export done
+then /usr/bin test local "$@"
+	2>/dev/null done done
+	${HOME} readonly local local sed && test "$1"
+readonly && "$@" "$1" | awk local 2>/dev/null x=1 echo done
+		test then awk readonly readonly printf "$@" cd echo sed
+"$1" readonly /usr/bin export x=1 /usr/bin x=1 2>/dev/null printf test export
+		cd "$1" awk ${HOME} $(pwd) /usr/bin export done 2>/dev/null x=1
+| ${HOME} test then test export | $(pwd) $(pwd) done
+	local 2>/dev/null done done $(pwd) grep ${HOME}
+	2>/dev/null ${HOME} /usr/bin echo grep done
+awk $(pwd) then -eu x=1 printf
+		/usr/bin readonly && sed && 'quoted text'
+-eu ${HOME} /usr/bin
+	local "$1" | "$@" /usr/bin test ${HOME} done export readonly
+grep readonly local echo --verbose
+	sed /usr/bin && cd | grep grep then
+printf ${HOME} grep sed --verbose done grep then local echo readonly
+	done export done 'quoted text'
+		2>/dev/null test $(pwd) | local local cd "$@" x=1 awk sed sed
+x=1 export | printf | export 'quoted text' sed ${HOME}
+	then test echo local && cd echo export local | cd
+	local && grep grep then "$1" "$1"
+		/usr/bin readonly ${HOME} ${HOME} 2>/dev/null local readonly $(pwd)
+		sed | -eu -eu grep | echo awk --verbose ${HOME} "$1" 2>/dev/null
+		cd "$@" echo 'quoted text' -eu x=1 cd && printf ${HOME} 2>/dev/null
+/usr/bin $(pwd) ${HOME} sed cd then readonly
+	grep x=1 cd then printf awk 2>/dev/null ${HOME}
+		then $(pwd) local /usr/bin printf ${HOME} 'quoted text'
+	cd local export done && printf local 'quoted text'
+	"$1" -eu --verbose ${HOME}
+test awk $(pwd) readonly 'quoted text' test test "$@" x=1 awk then 2>/dev/null
+	readonly export cd $(pwd) $(pwd) ${HOME} && /usr/bin -eu
+		${HOME} "$1" x=1 $(pwd) x=1 /usr/bin test test grep "$@" done
+	2>/dev/null awk cd $(pwd) --verbose /usr/bin | -eu cd test 2>/dev/null && $(pwd)
+echo grep | $(pwd) readonly export then
+		"$1" 'quoted text' cd ${HOME} --verbose
+${HOME} awk | local then "$@" readonly awk ${HOME} $(pwd) 2>/dev/null printf
+	export x=1 /usr/bin sed | -eu readonly 2>/dev/null export ${HOME} grep | then
+		done done 2>/dev/null printf readonly $(pwd) awk 2>/dev/null awk then
+	-eu "$1" -eu x=1 | cd -eu cd | echo then /usr/bin sed printf export $(pwd) sed
+&& | awk $(pwd) echo 2>/dev/null sed 2>/dev/null "$@" test test sed
+&& export cd done ${HOME} $(pwd) $(pwd) then printf cd grep 2>/dev/null
+test readonly grep test --verbose 'quoted text' $(pwd) readonly --verbose |
+	readonly then local echo && test awk "$1" awk x=1 ${HOME} printf "$@" export "$@"
+	test printf test done x=1 cd sed awk "$1" /usr/bin 2>/dev/null $(pwd) test
+		then echo 2>/dev/null /usr/bin 2>/dev/null test awk then then local readonly
+	x=1 awk "$@" awk then printf | sed local export /usr/bin ${HOME}
+export local awk readonly
+		sed $(pwd) cd sed -eu x=1
+readonly --verbose 2>/dev/null x=1 cd /usr/bin local awk | | | export
+echo "$@" export grep
+/usr/bin export grep cd x=1
+cd "$1" test 2>/dev/null export "$@" -eu cd export 'quoted text' echo -eu cd
+		awk echo export sed ${HOME} then echo done 'quoted text' --verbose x=1
+&& && 2>/dev/null $(pwd) 'quoted text' test --verbose 2>/dev/null
+		readonly done 2>/dev/null x=1 echo cd awk $(pwd) && test 'quoted text'
+		| && printf -eu printf done then x=1 sed 'quoted text' | x=1 --verbose
+	$(pwd) 'quoted text' 2>/dev/null && 'quoted text' x=1 grep |
+	readonly printf cd sed local "$@"
+	done | | ${HOME} "$1" 'quoted text' done export ${HOME}
+		2>/dev/null ${HOME} test done awk "$1" sed "$@" readonly
+	awk awk --verbose readonly
+		| grep then 'quoted text'
+		x=1 readonly echo test 'quoted text'
+	${HOME} echo then /usr/bin cd
+		grep $(pwd) --verbose printf
+| "$1" local "$1" test awk 2>/dev/null ${HOME}
+	| --verbose local local grep done -eu
+sed done "$1" local then "$@" 2>/dev/null --verbose 'quoted text' test export
+		test then -eu ${HOME} /usr/bin done $(pwd)
+	$(pwd) && cd sed 2>/dev/null awk grep
+done readonly printf -eu "$@" readonly
+printf "$1" x=1 test local readonly echo /usr/bin 'quoted text' x=1
+/usr/bin /usr/bin -eu readonly
+	grep then cd then then
+	-eu "$1" readonly /usr/bin 'quoted text'
+then done | "$@" ${HOME} grep 'quoted text' 2>/dev/null 2>/dev/null
+done 2>/dev/null -eu -eu x=1 'quoted text' echo x=1
+		export | x=1 | done export
+test test --verbose local | export x=1
+		x=1 test | | | | sed then readonly done --verbose "$1"
+x=1 sed then cd $(pwd) | sed sed --verbose 'quoted text'
+readonly grep export "$@" &&
+	then grep awk "$1" --verbose printf && sed done $(pwd) $(pwd) x=1 sed /usr/bin
+	${HOME} test 2>/dev/null
+		readonly 'quoted text' x=1 echo test ${HOME} --verbose
+2>/dev/null printf cd -eu | x=1 | && cd awk 'quoted text'
+	&& "$@" export printf 2>/dev/null -eu --verbose x=1 $(pwd) test "$@" "$1" 'quoted text'
+	grep then && "$1" 2>/dev/null 2>/dev/null -eu "$1" then echo
+	printf then printf --verbose echo cd 'quoted text' cd export
+	/usr/bin echo echo echo grep 'quoted text'
+	cd echo export "$1" echo ${HOME} && awk grep $(pwd) 'quoted text'
+		${HOME} awk cd $(pwd) ${HOME} &&
+printf readonly local -eu test | echo |
+		2>/dev/null "$@" -eu 2>/dev/null
+		sed done 'quoted text' && 'quoted text' $(pwd) 'quoted text' awk |
+--verbose then "$1" readonly
+	test grep grep 2>/dev/null readonly ${HOME}
+	local sed | awk export "$@" "$@" -eu printf -eu test 'quoted text' -eu test
+	--verbose ${HOME} $(pwd) ${HOME} x=1 "$@" 'quoted text' export $(pwd) awk &&
+	export "$1" --verbose $(pwd) -eu grep test sed cd local then
+	grep "$1" sed sed 'quoted text'
+		test grep awk $(pwd) $(pwd) "$@" "$@"
+	echo done awk sed ${HOME} printf
+	'quoted text' cd x=1 'quoted text' sed awk "$1" --verbose 2>/dev/null
+	readonly export "$1" && local
+printf export | $(pwd) $(pwd) printf
+	done sed readonly cd awk echo awk echo 2>/dev/null /usr/bin 2>/dev/null done readonly
+	done x=1 then ${HOME} awk
+cd awk awk then export
+&& then x=1 && && export ${HOME} | sed -eu test -eu cd grep --verbose readonly
+$(pwd) /usr/bin 2>/dev/null 'quoted text'
+&& echo -eu awk printf printf x=1 then sed echo grep echo
+	/usr/bin readonly export printf local echo x=1 && then "$@" | -eu $(pwd) $(pwd)
+test awk echo local cd 'quoted text' $(pwd) test awk
+printf cd awk grep then "$@" sed grep echo
+| export test grep cd "$@" done -eu
+		"$1" test local "$@" "$@" -eu then --verbose cd | && sed 2>/dev/null awk local |
+| awk readonly $(pwd) cd -eu --verbose 'quoted text' "$1" grep "$@" readonly
+"$@" /usr/bin -eu /usr/bin test "$@" grep x=1 | $(pwd)
+		then echo printf cd sed cd readonly then sed ${HOME} grep sed printf
+	sed $(pwd) $(pwd) export
+done then --verbose /usr/bin && printf awk 'quoted text'
+done printf | awk "$@" x=1 echo export
+		echo && then --verbose "$@" "$1" done sed 'quoted text' awk awk
+cd printf test echo test ${HOME} then
+		grep x=1 echo done "$1" readonly sed
+--verbose test cd test cd 'quoted text' 'quoted text' export
+	done awk x=1 $(pwd) 2>/dev/null | "$@"
+&& grep /usr/bin x=1 /usr/bin echo grep
+		sed then awk $(pwd) cd | 'quoted text' $(pwd) done /usr/bin export
+	| readonly local done then ${HOME} --verbose echo 2>/dev/null
+	done --verbose 2>/dev/null --verbose -eu done export
+	cd grep cd ${HOME} "$1" | test readonly && local then "$1" export
+grep printf then export
+	-eu /usr/bin ${HOME} ${HOME}
+	| /usr/bin done "$1" 'quoted text' export cd $(pwd)
+		printf "$@" "$1" readonly
+echo export export done --verbose printf && awk $(pwd)
+then printf local "$@" $(pwd) readonly | 'quoted text' awk
+	printf | 2>/dev/null $(pwd) readonly && 'quoted text'
+		done /usr/bin /usr/bin "$1"
+	$(pwd) $(pwd) grep /usr/bin echo printf 'quoted text'
+sed cd cd export x=1 sed x=1 printf "$1" 'quoted text'
+		"$@" then then 2>/dev/null sed done 2>/dev/null
+		$(pwd) && echo awk "$1" awk "$1" | echo "$@" && 'quoted text' echo ${HOME} "$@"
+		"$1" grep then 2>/dev/null
+		then $(pwd) $(pwd) export $(pwd) --verbose $(pwd) x=1 readonly
+printf ${HOME} --verbose sed sed done export export test done
+-eu --verbose grep "$@" -eu ${HOME} export cd --verbose
+printf --verbose readonly grep --verbose 2>/dev/null
+	printf && printf 2>/dev/null echo
+	cd grep | then local && x=1 2>/dev/null ${HOME} echo printf
+${HOME} readonly printf sed echo sed then test readonly readonly test
+		readonly grep -eu "$1" && /usr/bin 2>/dev/null 2>/dev/null -eu && 2>/dev/null
+		grep 'quoted text' --verbose grep
+	cd sed then test echo echo
+	then "$@" && done awk then test echo printf
+		awk readonly | --verbose awk --verbose
+	"$1" 2>/dev/null sed echo x=1 test "$1" "$1" 2>/dev/null
+local then test echo | ${HOME} && sed sed cd then
+-eu /usr/bin sed cd "$1" /usr/bin "$@" -eu local
+-eu done test 'quoted text' echo cd cd local
+	cd done test printf 2>/dev/null -eu && done done $(pwd) -eu $(pwd) sed then 2>/dev/null
+		done "$1" grep done /usr/bin awk $(pwd) then grep echo printf
+done readonly export awk 'quoted text'
+		sed 'quoted text' awk 2>/dev/null | then echo awk export then awk then
+then | done 2>/dev/null done then local /usr/bin --verbose && awk x=1
+	--verbose --verbose cd --verbose /usr/bin done --verbose local done test local
+	${HOME} grep ${HOME} awk then test | local awk grep local done
+	awk sed local local 'quoted text' &&
+/usr/bin "$@" grep export
+		readonly awk --verbose echo cd
+grep --verbose 2>/dev/null grep
+export "$1" $(pwd) --verbose done grep --verbose echo echo $(pwd) && x=1 --verbose
+-eu awk cd | -eu awk export printf grep | 'quoted text' local awk test x=1 awk
+'quoted text' "$1" readonly sed local ${HOME}
+		echo ${HOME} cd && grep readonly
+		-eu then local local $(pwd) echo cd grep 'quoted text'
+	&& grep grep | export 2>/dev/null /usr/bin echo echo && sed echo echo --verbose
+test export cd sed done printf grep
+readonly 'quoted text' $(pwd) $(pwd) done --verbose && x=1 done
+		2>/dev/null $(pwd) 2>/dev/null -eu | cd printf printf local cd -eu done printf
+	done readonly /usr/bin local 2>/dev/null
+2>/dev/null grep readonly then readonly then grep
+		test sed "$@" 2>/dev/null x=1 local awk x=1
+	x=1 export then $(pwd) readonly --verbose $(pwd) local $(pwd)
+grep 'quoted text' ${HOME} export
+sed "$1" cd local | && "$@" -eu "$1" 2>/dev/null --verbose "$1" "$@" | 'quoted text'
+	done 'quoted text' test done printf 2>/dev/null --verbose local
+then $(pwd) /usr/bin sed sed
+		export && echo local "$@" done "$@" echo
+done sed --verbose && ${HOME} && awk local echo
+		local ${HOME} --verbose awk readonly 2>/dev/null
+		-eu --verbose -eu cd "$@" then cd $(pwd) awk --verbose
+printf readonly local 2>/dev/null grep "$1" printf $(pwd) /usr/bin -eu
+"$1" $(pwd) /usr/bin done cd "$1" "$@" | $(pwd) $(pwd)
+		test echo 'quoted text' cd $(pwd)
+		local printf ${HOME} export printf "$@" then /usr/bin echo "$@" cd
+	'quoted text' "$@" awk x=1 --verbose --verbose --verbose echo printf then $(pwd)
+		"$1" 'quoted text' -eu "$@" local export --verbose -eu $(pwd)
+	--verbose test then done echo
+sed grep && /usr/bin "$1"
+--verbose "$@" local printf 2>/dev/null cd test echo then readonly
+$(pwd) | $(pwd) && echo readonly | export echo local sed export
+printf cd -eu sed test x=1 /usr/bin -eu
+export cd echo echo printf cd printf /usr/bin "$@" done cd
+		printf test awk "$1" grep awk export 'quoted text' echo
+	| && sed | -eu "$1" done grep then local -eu /usr/bin -eu &&
+		readonly --verbose 'quoted text'
+		local | 2>/dev/null readonly done 2>/dev/null
+	grep echo && echo export cd grep local /usr/bin test $(pwd) export then ${HOME}
+x=1 done $(pwd) "$1" then sed /usr/bin | cd $(pwd) cd
+	/usr/bin "$1" local /usr/bin --verbose /usr/bin --verbose done echo
+| | -eu $(pwd) local | awk | ${HOME} echo cd 'quoted text' awk --verbose
+	then test /usr/bin $(pwd) ${HOME} grep export export | cd
+		${HOME} x=1 done local grep && /usr/bin "$@" 'quoted text'
+x=1 awk "$@" "$@" ${HOME} test --verbose
+	-eu then sed --verbose | 'quoted text' "$1" readonly
+		printf then 2>/dev/null "$@" && readonly then /usr/bin /usr/bin && readonly awk
+cd | "$1" ${HOME} readonly echo 'quoted text' x=1 printf sed | done local $(pwd)
+awk --verbose -eu ${HOME} export readonly
+then readonly "$@" /usr/bin readonly
+2>/dev/null 2>/dev/null cd $(pwd) "$1"
+		done --verbose $(pwd) sed
+	&& sed "$@" readonly printf "$@" then readonly sed 2>/dev/null then $(pwd)
+		then -eu grep printf 'quoted text' cd cd done printf /usr/bin readonly readonly
+	grep 2>/dev/null sed "$1" "$1" $(pwd) local --verbose cd ${HOME} test
+		local cd "$@" 2>/dev/null test readonly -eu local local ${HOME} /usr/bin awk | ${HOME}
+		&& /usr/bin /usr/bin -eu 2>/dev/null
+${HOME} awk done local printf cd /usr/bin x=1 /usr/bin
+sed done printf 2>/dev/null $(pwd) done cd test test $(pwd) /usr/bin "$@" "$@"
+	readonly x=1 x=1 then
+		| "$1" local test /usr/bin awk 'quoted text' echo $(pwd) local local
+x=1 sed local printf grep grep
+		"$@" "$@" echo "$@" ${HOME} awk
+	readonly --verbose 2>/dev/null 'quoted text' printf readonly /usr/bin printf
+	readonly --verbose done then
+	grep | && --verbose x=1 'quoted text' $(pwd) && | then "$@"
+grep 2>/dev/null local test cd printf cd readonly local local
+		${HOME} export test $(pwd) export sed readonly done
+	export /usr/bin printf then sed $(pwd) && cd --verbose "$1"
+--verbose 'quoted text' awk $(pwd) echo "$@" export
+	--verbose -eu grep grep 'quoted text' then printf
+| x=1 2>/dev/null done test $(pwd) 'quoted text' $(pwd) local then sed /usr/bin
+		&& grep then test printf local 'quoted text' "$@" /usr/bin grep test readonly "$1"
+	done 2>/dev/null awk grep grep --verbose && sed export ${HOME}
+	| ${HOME} awk test then test /usr/bin
+cd "$1" cd local sed && echo 'quoted text' "$1" export sed | | local
+	'quoted text' && --verbose | sed x=1 && | readonly grep test "$1" echo
+	x=1 'quoted text' test grep test local -eu -eu local 'quoted text'
+		&& "$@" grep "$1" printf | &&
+	sed awk printf awk $(pwd) 'quoted text' awk sed awk cd printf
+2>/dev/null -eu --verbose done 2>/dev/null sed | cd
+	-eu then done grep export done 2>/dev/null readonly readonly
+	2>/dev/null export test local $(pwd) awk done test local -eu
+		2>/dev/null echo test x=1 ${HOME} grep cd -eu $(pwd) test readonly test
+	sed readonly grep | x=1 $(pwd) $(pwd) x=1
+	$(pwd) ${HOME} ${HOME} /usr/bin -eu echo grep export grep
+	'quoted text' local "$1" 'quoted text' &&
+echo echo "$1" "$@" /usr/bin | printf x=1 x=1 $(pwd) sed sed | && 2>/dev/null
+	/usr/bin done --verbose /usr/bin local 2>/dev/null 'quoted text'
+echo export export export --verbose readonly
+	test | then | -eu printf 'quoted text' sed readonly x=1 'quoted text'
+	sed x=1 test "$1" cd "$@" ${HOME} test echo 2>/dev/null awk x=1 --verbose
+	sed grep -eu 2>/dev/null $(pwd) echo "$1" done
+"$1" then awk $(pwd) grep readonly readonly && done
+		--verbose printf echo test 2>/dev/null -eu grep ${HOME} | cd
+	grep 'quoted text' | 'quoted text' ${HOME}
+		/usr/bin 2>/dev/null 'quoted text' /usr/bin $(pwd) $(pwd) $(pwd)
+	test 2>/dev/null && local test 2>/dev/null 'quoted text' awk echo /usr/bin
+		"$1" && readonly "$1" | grep | export test grep $(pwd)
+		2>/dev/null readonly &&
+		echo done "$@" -eu readonly /usr/bin
+'quoted text' echo sed && x=1 $(pwd) local printf "$1" then
+	awk ${HOME} "$1" done
+		2>/dev/null readonly $(pwd) x=1
+		"$@" awk export grep x=1 /usr/bin -eu 2>/dev/null local cd grep grep
+	then grep "$1" test echo $(pwd) 2>/dev/null awk /usr/bin --verbose
+		sed readonly awk 'quoted text' printf grep && test export readonly echo &&
+	"$@" --verbose done done 2>/dev/null | | |
+		grep -eu "$@" /usr/bin x=1 local -eu sed test done
+| --verbose "$1" ${HOME}
+	$(pwd) echo awk export export then test --verbose 'quoted text' local -eu /usr/bin
+	echo then sed sed $(pwd) --verbose "$1" x=1 ${HOME} local 2>/dev/null local
+-eu x=1 grep sed /usr/bin printf ${HOME}
+'quoted text' awk /usr/bin $(pwd) then "$@" then -eu --verbose grep
+/usr/bin ${HOME} sed && "$1" done echo && echo --verbose
+export grep grep $(pwd) "$@" /usr/bin cd 2>/dev/null then x=1
+		cd export ${HOME} "$@" cd | $(pwd) | echo readonly printf "$@" done awk
+	test sed test ${HOME} readonly grep --verbose then sed 2>/dev/null && /usr/bin
+	${HOME} -eu export --verbose export done --verbose
+x=1 export echo awk sed "$@"
+	| "$1" 2>/dev/null echo "$@" -eu 2>/dev/null printf
+	$(pwd) /usr/bin awk grep
+		readonly echo export ${HOME} && then 'quoted text'
+	local "$@" export -eu
+	export | 2>/dev/null cd test sed ${HOME} "$1" sed --verbose printf $(pwd) done
+	sed readonly sed local $(pwd) -eu "$1"
+		x=1 printf then --verbose sed then
+		printf grep /usr/bin then done --verbose
+	printf /usr/bin echo local "$1"
+echo $(pwd) then done 'quoted text'
+	done -eu x=1 printf -eu printf local readonly test readonly "$1"
+		then ${HOME} 2>/dev/null local local
+		/usr/bin --verbose echo grep $(pwd) x=1 then && echo local x=1 x=1 then
+		local "$1" && done then export
+/usr/bin x=1 done then then "$@" done done --verbose 2>/dev/null readonly
+echo echo export local local awk $(pwd) done readonly then
+"$@" | "$1" grep readonly -eu cd $(pwd) --verbose sed 'quoted text'
+	awk then 2>/dev/null -eu cd -eu local /usr/bin done
+		-eu --verbose echo "$1" local readonly "$1" awk local
+	readonly ${HOME} --verbose --verbose printf cd cd x=1 -eu --verbose
+		-eu echo | test then awk echo export
+-eu printf ${HOME} --verbose && printf export x=1 2>/dev/null readonly printf
+	--verbose cd -eu ${HOME} 'quoted text'
+		${HOME} grep local --verbose 'quoted text' "$1" cd echo cd cd done grep 'quoted text'
+	x=1 'quoted text' test ${HOME}
+		test export /usr/bin grep awk -eu "$1" awk
+-eu cd 'quoted text' cd 2>/dev/null test $(pwd)
+	2>/dev/null done ${HOME} echo test 'quoted text' -eu x=1 /usr/bin export echo
+		then awk --verbose grep readonly readonly
+| $(pwd) local then then export
+		cd ${HOME} | sed readonly readonly && printf sed 'quoted text' "$1" --verbose
+"$@" readonly $(pwd) printf export && test 2>/dev/null ${HOME}
+		sed -eu local readonly cd --verbose /usr/bin readonly done /usr/bin readonly
+	&& /usr/bin ${HOME} local printf echo | 'quoted text' test --verbose
+grep /usr/bin -eu echo test then export local export /usr/bin export
+		-eu echo test grep sed $(pwd) done echo ${HOME}
+then --verbose grep printf |
+"$1" $(pwd) done export "$1" 'quoted text' ${HOME} echo "$1" grep 'quoted text'
+2>/dev/null ${HOME} 2>/dev/null /usr/bin /usr/bin test then then test
+	| cd ${HOME} 'quoted text' | && --verbose -eu
+	/usr/bin -eu --verbose printf grep /usr/bin -eu test --verbose local awk export
+	&& "$@" /usr/bin then ${HOME} sed local $(pwd) 'quoted text' readonly
+"$1" x=1 then $(pwd)
+	$(pwd) then cd grep $(pwd)
+readonly $(pwd) awk 'quoted text' --verbose local --verbose test done
+	echo then grep readonly /usr/bin done readonly
+		done x=1 /usr/bin readonly && export 2>/dev/null
+		x=1 "$1" $(pwd) x=1 test readonly
+	-eu /usr/bin awk local done ${HOME} x=1 ${HOME} ${HOME} readonly
+| x=1 "$1" x=1 then done echo x=1 "$1" 2>/dev/null /usr/bin
+		then then local "$1" x=1 local "$1" --verbose /usr/bin grep grep test
+		then local 'quoted text' "$@" local
+printf 2>/dev/null cd sed 'quoted text' done /usr/bin
+	local x=1 readonly "$@" "$1" test grep "$@" | x=1 readonly
+	cd | cd readonly grep then ${HOME} test
+	"$@" "$1" awk cd "$1" local printf echo 'quoted text' -eu cd "$1" | 'quoted text'
+		2>/dev/null 'quoted text' local awk cd "$@" x=1 printf
+	then 2>/dev/null 2>/dev/null grep "$1" grep then | | /usr/bin ${HOME}
+		/usr/bin x=1 local 'quoted text' test 'quoted text' test 'quoted text'
+	"$1" $(pwd) ${HOME} | 'quoted text' sed grep ${HOME} "$@" 'quoted text' | grep
+done readonly readonly "$1" | grep ${HOME} echo
+test test ${HOME} 'quoted text' --verbose export readonly "$1"
+then awk cd "$@" $(pwd) --verbose
+	export /usr/bin --verbose then test | $(pwd) -eu readonly "$1" cd printf
+		echo -eu readonly 'quoted text' x=1
+		local test local then cd -eu | awk then echo | && -eu sed &&
+		$(pwd) then readonly test awk "$1" awk readonly printf done 2>/dev/null
+		then 2>/dev/null awk "$1" $(pwd) test local done "$1" local x=1 local /usr/bin
+	done readonly awk test $(pwd) 2>/dev/null ${HOME} cd test
+		"$1" | && test readonly $(pwd) 2>/dev/null
+done local local local export -eu $(pwd) x=1 "$@"
+${HOME} then then sed test test echo
+		awk local && x=1 awk "$@" -eu then readonly
+		readonly 2>/dev/null "$1" ${HOME} local then local readonly
+		"$1" -eu /usr/bin test | /usr/bin -eu readonly
+	x=1 -eu /usr/bin export awk 2>/dev/null 2>/dev/null echo echo
+		--verbose readonly | sed $(pwd) /usr/bin
+$(pwd) local test done cd "$@" readonly
+2>/dev/null /usr/bin sed "$@" export sed done 2>/dev/null --verbose
+		then "$@" local x=1 && export cd local
+"$@" export 2>/dev/null "$@" "$1" ${HOME}
+		${HOME} x=1 "$1" then grep awk -eu 2>/dev/null test 'quoted text' test
+	local printf sed printf export
+	x=1 grep -eu ${HOME} | --verbose -eu echo cd -eu $(pwd) cd done
+		awk /usr/bin done awk --verbose --verbose 2>/dev/null
+		cd | export grep echo -eu ${HOME} export local grep cd echo sed && printf done
+sed x=1 && export /usr/bin done local cd && -eu cd "$@" |
+	local /usr/bin cd awk && test echo echo export echo 'quoted text' echo
+		--verbose | x=1 cd readonly readonly done -eu done grep 'quoted text' echo --verbose
+	grep printf local | "$1" && | cd -eu x=1 local | local /usr/bin 2>/dev/null then
+cd awk awk 2>/dev/null cd "$@" $(pwd) sed "$@" export
+	2>/dev/null /usr/bin readonly cd x=1 printf ${HOME}
+done 2>/dev/null test readonly | /usr/bin
+	x=1 "$@" done cd -eu | then
+		"$@" awk 'quoted text' printf && "$1" 'quoted text' done local "$1" "$1" then export
+		done cd printf local grep echo -eu $(pwd)
+	printf | readonly x=1 printf -eu x=1 printf then 'quoted text' 2>/dev/null
+		local ${HOME} --verbose /usr/bin x=1 | && && -eu readonly
+export x=1 sed 'quoted text' && "$@" $(pwd) grep cd sed | sed 'quoted text'
+"$@" "$@" echo ${HOME} --verbose --verbose
+echo done /usr/bin &&
+	"$1" "$@" -eu test export export
+		readonly grep grep readonly echo ${HOME} cd --verbose done awk --verbose
+/usr/bin && /usr/bin cd "$@" cd && 2>/dev/null test $(pwd) x=1 grep printf
+awk export /usr/bin -eu /usr/bin local export cd done
+		$(pwd) printf /usr/bin "$@" cd done local readonly
+		done export test "$1" awk "$@" then test ${HOME} x=1 ${HOME} sed ${HOME}
+	then && test --verbose && export
+		then 2>/dev/null "$1" printf test /usr/bin printf | test
+	${HOME} --verbose "$1" local "$@" x=1 then 'quoted text'
+		"$@" grep /usr/bin sed echo awk done --verbose cd /usr/bin
+		/usr/bin test && 'quoted text' then cd --verbose awk cd readonly
+		"$1" sed "$1" --verbose &&
+		${HOME} 'quoted text' "$@" printf cd then /usr/bin x=1
+'quoted text' done --verbose ${HOME} export "$1" x=1
+"$1" echo /usr/bin local test
+		done ${HOME} cd "$@" awk | cd export export
+| echo done done echo readonly "$@"
+	"$@" x=1 ${HOME} local 2>/dev/null
+	"$1" then cd $(pwd) x=1 |
+	local --verbose printf echo grep
+		x=1 readonly cd readonly done 2>/dev/null
+export done awk $(pwd) awk sed test cd && && sed "$1" test then ${HOME}
+		export done && then test 'quoted text' test
+	done printf "$@" "$@" echo -eu sed cd done 'quoted text' done
+	sed x=1 echo 'quoted text' export 'quoted text' x=1 -eu cd 'quoted text' local
+/usr/bin local printf done export printf test
+		/usr/bin && x=1 && cd local done $(pwd) "$@" $(pwd) test $(pwd) &&
+sed x=1 grep done | 'quoted text' "$@" ${HOME} --verbose then /usr/bin x=1 local
+	"$@" local && test printf readonly 'quoted text' awk printf grep
+	done sed 2>/dev/null awk && /usr/bin "$@" "$@" && /usr/bin
+		x=1 done $(pwd) cd --verbose
+export then awk $(pwd) --verbose export -eu -eu | readonly export
+done echo echo cd $(pwd) export echo cd | 'quoted text' /usr/bin sed readonly
+	done x=1 export --verbose sed then grep done --verbose awk | cd $(pwd)
+	/usr/bin readonly cd "$1" done grep 2>/dev/null
+	&& "$@" grep then --verbose cd "$@" && awk /usr/bin
+		x=1 printf local --verbose "$1" 'quoted text'
+export local "$@" then done export then 2>/dev/null
+	"$1" "$1" readonly --verbose ${HOME} 2>/dev/null 2>/dev/null cd readonly "$1"
+	cd echo done "$@" 2>/dev/null awk --verbose "$1"
+		local --verbose ${HOME} sed test -eu
+		| grep -eu readonly 'quoted text' |
+	x=1 $(pwd) "$@" "$1"
+		cd export $(pwd) "$1" /usr/bin -eu | && readonly
+	awk readonly -eu | then "$@" done readonly $(pwd) done "$@"
+	2>/dev/null export && "$@" 'quoted text' sed /usr/bin readonly
+		local grep export grep && export printf then ${HOME} $(pwd) x=1 &&
+cd awk test then export $(pwd) readonly local && awk printf
+-eu test awk grep && printf printf grep readonly "$1" printf test sed readonly
+echo then test then sed --verbose
+		local local done sed readonly
+		grep awk grep export ${HOME} | export grep printf then | --verbose
+		done readonly /usr/bin x=1 test test awk 2>/dev/null $(pwd)
+	x=1 --verbose printf 2>/dev/null
+	&& cd --verbose 'quoted text' cd -eu $(pwd) done /usr/bin -eu 2>/dev/null
+		'quoted text' | ${HOME} && "$@" echo "$@"
+	grep echo awk export grep grep readonly sed 'quoted text' then 'quoted text'
+-eu -eu /usr/bin "$@" 'quoted text' local
+sed test $(pwd) "$@" 2>/dev/null
+		echo test sed "$1" ${HOME} && readonly "$1" && cd grep done
+		x=1 'quoted text' local export
+		--verbose -eu 2>/dev/null $(pwd) "$@" cd cd cd cd "$@" 2>/dev/null echo grep
+'quoted text' then /usr/bin ${HOME} ${HOME} x=1 cd 2>/dev/null grep
+awk "$1" done "$@" done cd export sed grep ${HOME} grep sed
+	cd local awk $(pwd) -eu then $(pwd) test
+		local "$1" ${HOME} awk cd done 2>/dev/null && && -eu "$@" awk awk
+"$1" -eu cd export x=1 sed local export
+x=1 $(pwd) then 'quoted text' test 2>/dev/null test ${HOME} test local
+	local "$@" awk -eu awk x=1
+then printf echo "$1" x=1 "$@" /usr/bin /usr/bin ${HOME} -eu | printf export 2>/dev/null
+		'quoted text' "$@" x=1 ${HOME} -eu readonly 2>/dev/null | awk
+	'quoted text' 2>/dev/null awk test local echo && -eu && echo test $(pwd) cd "$1"
+sed 2>/dev/null awk done sed
+	$(pwd) test 2>/dev/null /usr/bin printf
+2>/dev/null && ${HOME} -eu
+	test /usr/bin cd /usr/bin x=1 "$@" then local echo -eu echo $(pwd)
+	then 2>/dev/null then x=1 awk
+		local sed test readonly 'quoted text'
+local export awk grep test echo printf --verbose printf
+awk $(pwd) printf -eu -eu 'quoted text' -eu echo ${HOME}
+&& --verbose && export ${HOME} awk printf
+		&& ${HOME} "$@" done printf grep local echo test export
+	cd && x=1 sed echo echo cd readonly
+${HOME} $(pwd) && grep printf grep awk readonly test export /usr/bin
+		export echo grep 'quoted text' --verbose grep /usr/bin
+		"$1" 'quoted text' $(pwd) printf "$@" local && printf sed test x=1 "$1" then x=1
+		-eu ${HOME} "$1" "$@" | readonly | --verbose
+	"$@" awk ${HOME} export readonly local "$@" sed cd grep -eu local "$1" ${HOME}
+		--verbose printf readonly --verbose $(pwd) 'quoted text' awk printf 2>/dev/null
+&& $(pwd) "$@" then local done && | grep ${HOME} done ${HOME} export ${HOME}
+/usr/bin local --verbose export -eu grep | "$1"
+	&& printf /usr/bin local sed
+printf grep | export --verbose sed "$1" echo local
+| export /usr/bin x=1 x=1 ${HOME} && sed 'quoted text' && then
+		local "$1" --verbose "$1" echo
+| local "$@" test grep grep sed test $(pwd) 'quoted text'
+awk | | ${HOME} test export sed readonly
+	then x=1 done "$1" -eu cd grep ${HOME} | 'quoted text' /usr/bin export cd
+done local ${HOME} test ${HOME}
+2>/dev/null "$@" test echo test | printf sed
+		x=1 grep 2>/dev/null printf echo
+printf "$@" "$@" "$@" /usr/bin | --verbose -eu grep --verbose && --verbose
+"$1" x=1 printf grep printf local
+2>/dev/null printf "$@" test local readonly
+grep export local then sed readonly /usr/bin test | sed readonly
+	sed then $(pwd) "$1" 2>/dev/null printf /usr/bin && x=1 ${HOME} /usr/bin
+	then /usr/bin cd && sed $(pwd) done sed sed test awk
+&& printf /usr/bin x=1 2>/dev/null then && sed
+	local "$1" readonly cd | $(pwd) echo 'quoted text' 2>/dev/null 2>/dev/null
+	readonly ${HOME} | then -eu export cd
+"$1" test 'quoted text' ${HOME} --verbose -eu $(pwd) "$@" readonly sed readonly
+	/usr/bin $(pwd) ${HOME}
+x=1 && sed x=1 then -eu readonly 'quoted text'
+	'quoted text' /usr/bin then readonly 2>/dev/null
+echo export -eu /usr/bin
+		printf test && -eu sed awk && export ${HOME} "$1" 'quoted text'
+	cd 'quoted text' "$1" --verbose ${HOME} -eu --verbose && ${HOME}
+-eu export printf echo readonly
+	x=1 awk awk test awk then
+test ${HOME} done local "$1" done then echo $(pwd)
+local --verbose grep echo done "$1" "$1" | grep then "$@"
+		$(pwd) | done cd | --verbose grep
+done x=1 "$@" local 2>/dev/null echo done
+		$(pwd) then | "$1" $(pwd) 'quoted text'
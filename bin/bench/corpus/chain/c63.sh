@@ -0,0 +1,2001 @@
+	export cd sed -eu 'quoted text' sed 'quoted text' awk local
+	export --verbose printf local export printf printf
+"$1" ${HOME} --verbose readonly $(pwd) 2>/dev/null | then awk test
+		2>/dev/null echo "$1" -eu awk $(pwd) x=1 echo x=1 printf
+		2>/dev/null export /usr/bin
+	| ${HOME} "$@" printf $(pwd) x=1 x=1 $(pwd) 2>/dev/null readonly sed
+test printf grep -eu awk test
+		'quoted text' "$@" "$1" && $(pwd) x=1 x=1 && ${HOME} cd test
+	"$@" ${HOME} test "$1" sed printf $(pwd) cd
+	"$1" sed ${HOME} --verbose grep then
+		local "$@" "$@" sed printf printf && && "$@" /usr/bin --verbose
+		cd export test ${HOME}
+		sed grep $(pwd) local 2>/dev/null then "$@" | awk
+		done $(pwd) "$1" done --verbose awk 'quoted text' readonly x=1 grep echo
+		"$1" grep -eu then && && /usr/bin 'quoted text' /usr/bin readonly --verbose
+	2>/dev/null readonly test -eu
+		-eu done sed "$@" x=1 2>/dev/null then grep &&
+		awk --verbose test readonly printf then export cd
+${HOME} $(pwd) sed ${HOME} | /usr/bin "$@" ${HOME}
+	local && echo readonly printf sed --verbose x=1 -eu sed grep export
+	${HOME} ${HOME} local local 2>/dev/null && done test grep $(pwd)
+		awk echo echo test test ${HOME} $(pwd) local
+		export 'quoted text' -eu grep "$1" /usr/bin 2>/dev/null /usr/bin
+	cd && then "$@" echo | done test export 'quoted text' && -eu then awk 2>/dev/null
+	printf cd --verbose --verbose printf x=1 ${HOME} -eu
+	export x=1 export printf -eu done echo --verbose | 'quoted text'
+		| awk printf && printf "$1" sed local cd echo then "$@" export | -eu ${HOME} 2>/dev/null
+&& done sed cd --verbose sed sed printf 'quoted text' sed &&
+test test 2>/dev/null echo "$@" 2>/dev/null awk
+	echo done x=1 export && "$@" then x=1 "$@" "$@" ${HOME} "$1" "$1" then echo then
+		local done local 'quoted text'
+done done 'quoted text' readonly /usr/bin "$@"
+		local cd ${HOME} "$@" then "$@" ${HOME}
+	"$1" "$1" $(pwd) $(pwd) cd "$@" "$1" ${HOME}
+	x=1 then done readonly && "$@" 'quoted text' sed -eu ${HOME} grep "$1" grep
+	awk 2>/dev/null --verbose
+--verbose echo "$@" && export
+"$@" test /usr/bin cd --verbose
+	awk && local readonly $(pwd) 2>/dev/null then -eu $(pwd) x=1 x=1 "$@"
+	printf awk printf /usr/bin && && local 'quoted text' echo /usr/bin
+	| "$1" printf sed done $(pwd) && export --verbose awk x=1
+		echo 'quoted text' 'quoted text' $(pwd) sed $(pwd) x=1 &&
+		"$@" --verbose export then then then export awk 'quoted text' local local local
+${HOME} readonly $(pwd) grep $(pwd) test printf x=1
+	printf /usr/bin "$@" cd local awk 2>/dev/null
+	cd test done /usr/bin --verbose done -eu
+	"$1" "$@" done "$@" x=1 printf then sed awk grep echo cd sed &&
+		x=1 export | then 'quoted text'
+	cd echo local $(pwd) local "$1" echo test readonly sed
+	x=1 ${HOME} readonly readonly
+	done --verbose "$@" "$@"
+		'quoted text' printf $(pwd) $(pwd) export x=1 export | x=1
+	done then echo 2>/dev/null then
+${HOME} "$@" cd /usr/bin test readonly $(pwd) /usr/bin
+	/usr/bin --verbose 2>/dev/null $(pwd) $(pwd) /usr/bin $(pwd) export
+		/usr/bin /usr/bin $(pwd) test $(pwd)
+echo 2>/dev/null local "$@" awk /usr/bin
+		x=1 "$1" awk x=1 local -eu &&
+		'quoted text' readonly "$1" cd test 'quoted text' -eu then test
+awk local grep ${HOME} "$@" $(pwd) sed
+	2>/dev/null 2>/dev/null export test
+	"$@" export /usr/bin local export export
+	then grep sed then then ${HOME} export && x=1 $(pwd) ${HOME} "$1" local
+2>/dev/null grep && -eu then "$@" cd sed /usr/bin
+		sed x=1 readonly 2>/dev/null local grep cd --verbose echo | local grep 'quoted text'
+--verbose awk "$@" "$1" cd $(pwd) echo x=1 | 2>/dev/null test readonly
+		cd cd export test cd cd test | x=1
+--verbose export printf -eu $(pwd) 'quoted text' printf sed --verbose
+	/usr/bin ${HOME} export -eu
+	export -eu test test -eu then --verbose -eu printf "$@"
+	sed sed done local awk export readonly
+		echo export done x=1 ${HOME} --verbose "$1" && x=1 2>/dev/null sed /usr/bin
+2>/dev/null --verbose grep test
+grep /usr/bin sed echo ${HOME} 'quoted text'
+"$@" x=1 then | 'quoted text' 2>/dev/null awk awk | sed then awk awk awk "$1" printf
+	| printf -eu /usr/bin 'quoted text' awk sed export /usr/bin
+printf then done awk ${HOME} /usr/bin grep grep cd test "$1" printf sed -eu done
+	-eu "$1" ${HOME} test printf "$@" local 'quoted text' cd test 'quoted text'
+	awk then 2>/dev/null sed printf "$1" echo "$@"
+	&& cd printf test test
+		${HOME} export $(pwd) /usr/bin local 2>/dev/null /usr/bin local test --verbose
+	x=1 -eu 'quoted text' local awk readonly then
+grep && 'quoted text' local --verbose | readonly awk then x=1 | && sed
+--verbose done local then cd cd readonly x=1 grep x=1 | ${HOME}
+&& readonly cd --verbose printf
+		&& test | sed -eu $(pwd) printf readonly $(pwd)
+-eu -eu sed awk export | then cd awk awk "$@"
+	&& test -eu "$1" done done local && x=1 ${HOME} echo done "$1" test
+x=1 'quoted text' echo sed local && then 'quoted text'
+2>/dev/null local "$@" awk echo $(pwd) 'quoted text' sed sed
+	"$1" export 'quoted text' && 'quoted text' 2>/dev/null local echo "$@"
+	readonly local 'quoted text'
+		$(pwd) then readonly done "$1" 'quoted text' readonly -eu && done readonly
+readonly | 'quoted text' /usr/bin /usr/bin cd sed done sed 2>/dev/null $(pwd)
+	x=1 --verbose 2>/dev/null "$@" readonly 2>/dev/null printf x=1 && --verbose
+	printf --verbose done test cd x=1 --verbose $(pwd) && $(pwd)
+		${HOME} done local -eu | awk printf x=1 sed done "$@" cd
+		-eu "$@" ${HOME} cd 'quoted text'
+/usr/bin $(pwd) $(pwd) local
+		| grep echo "$@" -eu export grep | test
+	readonly $(pwd) export
+		grep "$@" grep 'quoted text' --verbose then cd test readonly grep test /usr/bin
+	2>/dev/null "$1" readonly local | echo echo then -eu
+echo && printf $(pwd) -eu | && done
+	sed readonly awk sed printf /usr/bin --verbose export
+"$@" /usr/bin local export export awk 'quoted text' then printf printf then cd then
+		| && --verbose then x=1 then -eu cd --verbose done && --verbose awk local
+		awk export cd 2>/dev/null -eu "$@" export -eu /usr/bin echo readonly "$@"
+		$(pwd) printf local $(pwd) test readonly awk ${HOME} -eu "$1"
+		grep readonly "$1" cd printf
+done done then echo printf grep x=1
+	echo cd local /usr/bin readonly -eu ${HOME} x=1 "$1" "$@" | printf -eu --verbose
+	x=1 "$1" -eu echo test $(pwd) printf --verbose
+		cd 2>/dev/null "$1" printf done -eu printf grep --verbose 'quoted text'
+		x=1 sed export | local --verbose awk printf --verbose
+2>/dev/null readonly x=1 echo "$1" local 2>/dev/null
+		x=1 test --verbose local | awk /usr/bin echo printf 2>/dev/null
+	done then && --verbose |
+grep x=1 'quoted text' x=1 echo export "$1" 'quoted text'
+		grep $(pwd) readonly "$@" $(pwd) test printf readonly grep readonly
+		$(pwd) 2>/dev/null printf test | test sed local local
+--verbose | x=1 awk /usr/bin
+		"$1" printf "$1" readonly cd --verbose then /usr/bin awk cd sed "$@"
+	2>/dev/null printf 'quoted text'
+local 2>/dev/null printf cd -eu done $(pwd) | echo test grep local ${HOME} --verbose
+		echo 2>/dev/null local | "$1" export done "$1" done done --verbose
+	/usr/bin -eu && echo 'quoted text' then
+	printf then && echo sed
+		/usr/bin x=1 readonly printf &&
+echo "$1" readonly cd sed "$1" export --verbose | --verbose "$@" /usr/bin /usr/bin
+	x=1 awk sed export --verbose sed echo printf test printf test local
+| test awk cd 'quoted text' readonly echo printf --verbose awk /usr/bin
+	"$@" test test && echo $(pwd) | 'quoted text' awk x=1 && then readonly /usr/bin
+	done awk sed x=1 --verbose --verbose 'quoted text'
+2>/dev/null 2>/dev/null
+	${HOME} 2>/dev/null cd $(pwd) done grep printf | readonly 'quoted text'
+		2>/dev/null && cd printf readonly && "$1" cd x=1 -eu x=1 cd /usr/bin && $(pwd) $(pwd)
+readonly $(pwd) printf then "$1" export cd &&
+done sed "$1" printf $(pwd) printf then 2>/dev/null -eu 2>/dev/null
+then /usr/bin awk "$@" --verbose --verbose grep then 2>/dev/null
+--verbose local export "$@"
+		| echo 'quoted text' /usr/bin sed done then sed "$@" | done 2>/dev/null $(pwd)
+		"$1" sed awk --verbose | export && test printf awk /usr/bin echo local -eu ${HOME}
+		"$@" --verbose echo test test printf "$1" grep /usr/bin "$@"
+	'quoted text' awk | printf | $(pwd) local test done then
+local cd "$1" x=1 printf export test --verbose ${HOME} done test -eu "$@"
+	echo $(pwd) $(pwd) 2>/dev/null grep grep cd --verbose && printf 2>/dev/null
+	/usr/bin "$1" grep export && sed export printf "$@" && 2>/dev/null && echo
+x=1 /usr/bin cd $(pwd) 2>/dev/null cd -eu then done export echo grep ${HOME} printf
+		2>/dev/null export 2>/dev/null && ${HOME} "$@" echo printf "$1" done 2>/dev/null
+	done sed /usr/bin sed awk test
+		export 2>/dev/null done export echo
+		-eu echo 'quoted text' /usr/bin cd $(pwd)
+export x=1 printf test -eu sed grep 2>/dev/null
+	sed ${HOME} 'quoted text' printf && --verbose && "$1" awk awk --verbose
+		done sed awk $(pwd) && awk && |
+	&& "$1" --verbose echo printf | --verbose
+local -eu 2>/dev/null test 'quoted text' ${HOME} then "$@"
+		--verbose local && $(pwd) grep "$1" then $(pwd)
+		readonly 'quoted text' echo "$@" sed sed -eu -eu ${HOME}
+		done 2>/dev/null && /usr/bin grep printf /usr/bin test printf done x=1 | sed |
+		awk "$1" $(pwd) x=1 readonly "$@" /usr/bin $(pwd) export
+		$(pwd) done | "$1" $(pwd)
+		test | 2>/dev/null "$1" awk readonly then x=1 --verbose test | ${HOME} local
+		then 'quoted text' readonly -eu printf
+		"$@" done --verbose /usr/bin 2>/dev/null $(pwd) readonly "$@" /usr/bin
+		export readonly && x=1 --verbose
+	-eu grep /usr/bin "$1" -eu
+		"$@" ${HOME} awk cd echo export
+	export -eu echo echo 2>/dev/null
+		cd printf --verbose 2>/dev/null 2>/dev/null
+	printf $(pwd) "$@" readonly test --verbose "$1"
+	then grep readonly local then "$1" $(pwd) /usr/bin awk test /usr/bin echo ${HOME}
+		cd then 2>/dev/null $(pwd)
+	cd printf | done && -eu test x=1 sed ${HOME} 'quoted text'
+	-eu sed printf ${HOME} ${HOME} $(pwd) readonly "$1" |
+x=1 --verbose 'quoted text'
+		"$@" "$@" grep | readonly then 'quoted text' sed
+	"$1" echo done export 'quoted text' -eu --verbose cd grep export
+	$(pwd) ${HOME} x=1 'quoted text' test && x=1 sed readonly 'quoted text'
+	local done "$@" test export
+		readonly then 2>/dev/null x=1 echo
+| $(pwd) echo sed /usr/bin then export readonly then && &&
+	then awk then cd /usr/bin grep 'quoted text' printf --verbose
+	sed then cd local | x=1 grep test printf
+		echo --verbose sed -eu grep | awk awk done
+		test /usr/bin printf printf
+	$(pwd) grep export export then then echo ${HOME} grep && local 2>/dev/null
+-eu export then 2>/dev/null cd "$1"
+	--verbose readonly readonly "$1"
+&& sed 'quoted text' done grep awk "$@" && "$1" "$@" test /usr/bin sed export
+		x=1 echo 'quoted text' /usr/bin 'quoted text' sed
+		test -eu 'quoted text' grep $(pwd) 'quoted text' | sed then &&
+x=1 echo done export cd -eu x=1 2>/dev/null echo "$@" awk && echo export
+	--verbose sed && ${HOME}
+-eu done readonly $(pwd) x=1 local "$1" echo local ${HOME} done done readonly
+	readonly 2>/dev/null local printf grep local awk cd sed test "$@"
+	export "$@" "$1" awk printf echo /usr/bin then 2>/dev/null
+"$1" | "$1" /usr/bin then | awk echo ${HOME} | done $(pwd) awk readonly
+--verbose printf ${HOME} local "$1" ${HOME} 2>/dev/null
+	${HOME} -eu done export "$1" ${HOME} "$1" x=1 printf grep ${HOME} x=1
+	| printf ${HOME} done grep "$@" export local awk
+		local printf grep x=1 then export awk local printf ${HOME} export /usr/bin readonly
+		$(pwd) test --verbose export cd | 2>/dev/null
+${HOME} awk echo 'quoted text' -eu export --verbose "$@" 'quoted text'
+${HOME} echo then && | done 'quoted text'
+export 2>/dev/null local local printf readonly local
+	2>/dev/null x=1 "$1" echo -eu awk test grep
+	/usr/bin "$1" printf
+		'quoted text' "$1" "$1" done
+		echo awk local test readonly
+		cd ${HOME} /usr/bin &&
+		readonly 2>/dev/null /usr/bin cd "$@" done sed -eu 'quoted text'
+	-eu ${HOME} echo done done -eu "$1" "$@"
+	&& /usr/bin echo | && | cd printf
+	sed $(pwd) local --verbose $(pwd) 'quoted text' x=1 readonly | "$@" && awk printf
+	echo test echo $(pwd) x=1 $(pwd) done echo
+sed && grep "$@" test sed ${HOME}
+readonly sed -eu grep test x=1 'quoted text' done 2>/dev/null ${HOME}
+	| $(pwd) done grep printf $(pwd) readonly local ${HOME} --verbose
+test | /usr/bin readonly awk
+		--verbose done -eu then $(pwd)
+		echo | && done grep && --verbose --verbose
+	"$@" -eu /usr/bin | done ${HOME} echo awk cd "$1"
+/usr/bin && then sed printf sed && cd
+	cd awk cd export "$1" then cd -eu $(pwd) echo 'quoted text' awk /usr/bin
+"$@" grep 'quoted text' printf test done awk 'quoted text' &&
+${HOME} export "$@" grep local sed $(pwd) /usr/bin ${HOME} local
+sed done "$1" readonly echo | readonly test export 2>/dev/null
+		readonly local done readonly "$1" | x=1 then &&
+"$1" cd awk local done "$@" test done local test done x=1 "$@" -eu "$1" 2>/dev/null
+"$1" x=1 test cd && local --verbose echo x=1 then test
+'quoted text' 2>/dev/null --verbose then "$@" /usr/bin
+		--verbose ${HOME} sed x=1 --verbose | "$1" export sed local 'quoted text'
+		export ${HOME} cd awk sed "$1" x=1 grep | "$1" export x=1 2>/dev/null done
+		test /usr/bin local awk && test echo $(pwd) test
+		| "$@" done readonly --verbose done 2>/dev/null x=1 "$@" | ${HOME} grep | "$@" ${HOME}
+		awk | then test export sed awk readonly then sed x=1 'quoted text' ${HOME} -eu
+		done | sed local done && 'quoted text' done export -eu | 'quoted text' | printf
+/usr/bin then readonly then "$1" "$@" $(pwd)
+		$(pwd) local grep echo local --verbose
+	"$1" printf printf --verbose && export export
+echo done grep export echo grep echo --verbose readonly x=1 awk printf "$1"
+local "$1" 2>/dev/null "$@" "$@"
+	then done && done x=1 awk "$@" echo readonly
+		2>/dev/null "$@" printf $(pwd) $(pwd) then 2>/dev/null awk
+		grep x=1 'quoted text' "$1" ${HOME} 'quoted text'
+		${HOME} sed readonly sed done $(pwd) x=1 "$1" ${HOME} ${HOME}
+		grep test x=1 grep sed done "$1"
+		-eu --verbose ${HOME} --verbose echo export 'quoted text' -eu "$@" then
+		readonly sed printf ${HOME} local && | sed -eu sed cd cd export
+		2>/dev/null done "$@"
+	&& && "$@" awk /usr/bin readonly cd readonly "$@" grep 2>/dev/null then cd 2>/dev/null
+	grep && then printf -eu then -eu && 2>/dev/null export "$@" $(pwd)
+		'quoted text' && grep awk echo --verbose
+&& export 'quoted text' -eu /usr/bin ${HOME} "$@" local "$@" | readonly
+		&& sed -eu /usr/bin -eu export "$@" printf grep test readonly -eu | readonly
+		| grep local "$1" readonly "$1" echo then "$@" echo x=1 grep done "$1" echo printf
+	"$@" /usr/bin --verbose 2>/dev/null 2>/dev/null sed "$@" test echo cd test
+	sed then grep test then x=1 /usr/bin $(pwd) sed awk && echo ${HOME}
+		awk readonly "$@" | ${HOME} grep then 2>/dev/null done /usr/bin readonly
+awk readonly local test "$1"
+${HOME} && printf then
+	--verbose echo test test 2>/dev/null 'quoted text'
+		grep sed awk grep then "$1" export sed grep $(pwd)
+	| 'quoted text' "$@" x=1 export --verbose local --verbose cd
+export then printf local cd printf
+cd done $(pwd) readonly echo printf grep printf
+${HOME} -eu ${HOME} grep "$@" "$1" x=1 cd test local test -eu --verbose "$@"
+'quoted text' 2>/dev/null x=1 local
+	grep awk "$@" then printf $(pwd) x=1 $(pwd) && --verbose test $(pwd)
+		x=1 ${HOME} && ${HOME} x=1 "$@"
+		grep grep readonly ${HOME} "$1" "$@"
+	"$@" x=1 x=1 -eu "$1" 'quoted text' grep
+		$(pwd) test grep sed export x=1 && | ${HOME} export
+		x=1 local | --verbose --verbose echo --verbose 'quoted text'
+		readonly grep x=1 ${HOME} echo local test | printf
+		done export echo ${HOME}
+$(pwd) "$1" "$1" done then echo echo 2>/dev/null readonly "$1" x=1 cd
+	done x=1 2>/dev/null cd --verbose done 'quoted text' /usr/bin -eu
+		${HOME} then ${HOME} && /usr/bin done $(pwd) 2>/dev/null | && then cd "$1" echo
+	then local test test done echo echo cd readonly cd echo $(pwd)
+readonly "$1" test | 2>/dev/null test cd x=1 "$1" && readonly
+		2>/dev/null /usr/bin ${HOME}
+	echo $(pwd) local --verbose 2>/dev/null
+		awk ${HOME} | export --verbose
+"$@" $(pwd) sed "$1" 2>/dev/null
+test $(pwd) done readonly $(pwd) ${HOME} "$1" cd --verbose "$@"
+awk && test export cd && echo
+	then 'quoted text' "$@" -eu -eu ${HOME} test export sed "$@" printf awk done
+"$1" readonly echo 'quoted text' readonly sed then readonly
+		&& readonly printf local $(pwd)
+test done sed then export printf done awk export readonly sed grep "$1"
+then test then "$@" test x=1 export && export then --verbose
+		&& | $(pwd) test grep awk sed done | sed -eu readonly 'quoted text' | echo "$1"
+		x=1 local -eu test -eu 2>/dev/null 2>/dev/null
+&& $(pwd) x=1 test 2>/dev/null test
+		sed cd 2>/dev/null readonly ${HOME}
+		x=1 x=1 export local | "$@" "$@" --verbose
+'quoted text' export awk && /usr/bin --verbose
+"$1" 2>/dev/null export sed 2>/dev/null
+export 'quoted text' | ${HOME} x=1 ${HOME} $(pwd) && -eu echo 2>/dev/null printf
+	"$1" /usr/bin /usr/bin local
+		grep cd export awk -eu awk test done | awk printf awk 2>/dev/null cd 'quoted text'
+sed awk ${HOME} --verbose ${HOME} && grep then done && "$1" /usr/bin
+	'quoted text' echo grep ${HOME}
+	local | | done ${HOME} 2>/dev/null --verbose test test 2>/dev/null
+	--verbose --verbose /usr/bin cd awk $(pwd)
+		awk grep /usr/bin "$1" -eu
+printf printf done export /usr/bin
+	cd grep readonly test printf printf "$@" && grep -eu awk "$@" grep local echo
+	${HOME} && /usr/bin -eu local awk ${HOME}
+printf printf done sed cd 2>/dev/null readonly echo | done --verbose readonly "$1"
+		grep 'quoted text' then | -eu "$@" test grep test $(pwd)
+	"$@" awk sed then awk $(pwd) printf --verbose
+	-eu grep readonly 2>/dev/null ${HOME} "$1" readonly -eu awk 'quoted text'
+cd x=1 "$1" cd "$@" readonly export grep | done --verbose 'quoted text'
+printf && export /usr/bin 2>/dev/null -eu "$1" local 2>/dev/null
+awk "$@" grep ${HOME} awk x=1 cd | x=1 awk
+local /usr/bin printf cd done | sed | && done 'quoted text' sed ${HOME} local
+	sed $(pwd) /usr/bin 2>/dev/null awk printf test test awk
+		test local -eu awk echo echo
+2>/dev/null echo local ${HOME} x=1 readonly then grep
+	${HOME} done then echo test 'quoted text' export
+	sed done awk cd "$1" /usr/bin /usr/bin 2>/dev/null local local
+		"$1" 'quoted text' --verbose readonly sed ${HOME}
+"$1" "$@" local "$@" | "$1"
+	readonly | | 2>/dev/null printf 2>/dev/null ${HOME} x=1 --verbose
+		-eu grep ${HOME} 2>/dev/null -eu | 2>/dev/null
+| /usr/bin export local sed sed ${HOME} "$1" local cd sed --verbose | then
+cd export echo printf sed grep grep -eu sed cd $(pwd) test test
+		done test export 2>/dev/null echo echo awk --verbose /usr/bin
+x=1 2>/dev/null done --verbose sed export sed echo test && "$@" -eu 'quoted text'
+	-eu /usr/bin export --verbose awk cd
+printf && --verbose echo local awk x=1
+		then /usr/bin then "$@" then test done "$@" x=1 -eu --verbose
+-eu /usr/bin cd grep $(pwd) echo grep grep x=1 | test x=1 -eu
+	awk -eu sed test --verbose readonly test "$1" export export echo
+		"$@" echo -eu --verbose x=1 echo export 'quoted text' --verbose --verbose 'quoted text'
+		grep x=1 export sed awk | then
+	-eu && grep | ${HOME} --verbose
+	test export "$1" ${HOME} $(pwd) done
+		echo && /usr/bin "$1" done $(pwd) local readonly && printf -eu --verbose
+	printf $(pwd) 2>/dev/null cd 2>/dev/null
+		${HOME} printf ${HOME} 'quoted text' 2>/dev/null cd printf /usr/bin
+export export -eu 'quoted text' awk --verbose sed echo -eu 2>/dev/null printf
+-eu | "$1" "$1" /usr/bin awk /usr/bin printf $(pwd)
+	'quoted text' grep "$1" "$@" /usr/bin -eu printf export -eu grep
+--verbose && grep cd local then -eu "$1" | && local readonly test --verbose
+	then export /usr/bin /usr/bin 2>/dev/null sed then echo
+		local 2>/dev/null 2>/dev/null local local export then x=1 awk
+		&& && "$@" sed test grep "$@" awk echo 2>/dev/null local test /usr/bin ${HOME}
+| sed | /usr/bin readonly -eu grep printf done $(pwd) | printf printf
+export awk sed done then cd grep && sed /usr/bin
+	/usr/bin $(pwd) printf sed done
+	printf 2>/dev/null sed $(pwd) cd ${HOME} then local awk grep
+then readonly "$1" "$1" --verbose echo 'quoted text' /usr/bin local ${HOME}
+	'quoted text' 2>/dev/null | export "$1" export done cd export
+awk "$@" ${HOME} | echo && | grep --verbose printf --verbose "$1" readonly test
+	cd sed -eu 2>/dev/null readonly printf 2>/dev/null sed -eu "$1"
+readonly grep test 'quoted text' "$1" --verbose
+		grep export && export "$@" | cd cd printf ${HOME} "$1" "$1" echo
+cd ${HOME} readonly echo 'quoted text' done "$@" /usr/bin /usr/bin done test then
+$(pwd) printf echo x=1 echo ${HOME} test && x=1 "$1" echo then "$1"
+		done /usr/bin awk && /usr/bin
+x=1 /usr/bin x=1 $(pwd) 'quoted text' awk
+		--verbose x=1 --verbose -eu $(pwd) -eu 2>/dev/null
+		${HOME} && cd local printf grep cd 2>/dev/null 'quoted text' 'quoted text'
+	'quoted text' -eu -eu x=1 --verbose ${HOME} then grep test "$@"
+/usr/bin sed -eu echo then -eu && -eu
+		'quoted text' ${HOME} awk cd --verbose grep --verbose x=1 cd echo "$1"
+	printf cd 'quoted text' then awk then 2>/dev/null
+	$(pwd) && then readonly --verbose grep --verbose
+		cd "$1" then $(pwd) export 2>/dev/null
+		test echo -eu ${HOME} sed awk 'quoted text' --verbose /usr/bin
+	$(pwd) cd readonly then "$@" "$@" then local printf sed test 2>/dev/null
+x=1 printf local ${HOME} readonly cd ${HOME} test "$1" export 2>/dev/null
+	"$1" echo grep echo grep "$@" --verbose
+cd x=1 x=1 readonly && printf "$@" local
+awk done x=1 x=1 test local -eu -eu $(pwd) --verbose | ${HOME}
+grep sed "$@" export done sed "$1" awk grep local cd ${HOME} then export
+		"$1" "$@" $(pwd) $(pwd) "$1" -eu -eu local sed -eu 2>/dev/null
+		export readonly grep && "$@" readonly
+"$@" 'quoted text' awk readonly --verbose -eu export readonly | export
+		export $(pwd) cd echo 'quoted text'
+	export then then -eu && "$@" then
+-eu cd grep $(pwd) grep awk x=1 grep "$1"
+	&& -eu "$1" then ${HOME} && | --verbose 2>/dev/null "$1" export 'quoted text'
+		echo echo 'quoted text' "$1" sed local sed 2>/dev/null | printf
+	echo ${HOME} export ${HOME} printf export export /usr/bin /usr/bin "$1"
+	then grep cd cd printf --verbose sed echo --verbose
+		readonly cd test | && echo | readonly test x=1 | | 2>/dev/null
+grep readonly grep 2>/dev/null awk 'quoted text'
+		echo 2>/dev/null x=1 awk test
+test "$1" cd local grep -eu
+		sed "$@" grep done printf grep printf | $(pwd)
+	cd echo printf $(pwd) 2>/dev/null && printf "$1" 'quoted text'
+${HOME} x=1 sed "$@" done ${HOME} grep
+	-eu local --verbose && x=1 cd 'quoted text' then printf awk sed echo ${HOME}
+then 'quoted text' awk x=1 "$@" awk export --verbose
+		"$@" 2>/dev/null awk done export test printf
+		export echo "$@" printf export -eu done |
+-eu /usr/bin test $(pwd) 2>/dev/null "$1" sed sed x=1
+	sed --verbose cd x=1 test echo
+	local /usr/bin awk done --verbose | done
+echo export export sed cd $(pwd) readonly export | done printf ${HOME}
+| sed grep | $(pwd) ${HOME}
+		/usr/bin local 'quoted text' "$@" done grep local 2>/dev/null "$1" -eu 2>/dev/null
+	readonly printf export 2>/dev/null --verbose sed test printf echo test --verbose
+&& export $(pwd) then awk
+${HOME} "$1" echo x=1 2>/dev/null $(pwd) 2>/dev/null sed 'quoted text'
+then "$1" awk && -eu 'quoted text' test
+		'quoted text' 2>/dev/null readonly $(pwd) readonly done -eu grep ${HOME}
+	$(pwd) sed ${HOME} echo 'quoted text' "$@" done printf $(pwd)
+	cd export export && x=1 readonly | cd
+	-eu test 'quoted text' printf
+readonly local /usr/bin 2>/dev/null x=1 done -eu "$1"
+printf sed x=1 sed ${HOME}
+	sed export awk export printf x=1 /usr/bin export
+		x=1 ${HOME} --verbose cd ${HOME} awk
+x=1 x=1 && "$1" then --verbose echo export $(pwd) readonly /usr/bin 2>/dev/null
+	"$@" export sed /usr/bin "$1" -eu "$@" test && echo sed export done local &&
+x=1 printf test echo "$@" cd readonly && --verbose
+| readonly grep --verbose then grep grep | /usr/bin && ${HOME} | /usr/bin
+${HOME} echo 'quoted text' $(pwd) printf && 2>/dev/null && "$@" local grep
+	printf --verbose 'quoted text'
+--verbose done sed $(pwd) /usr/bin 'quoted text' -eu "$@" && | x=1
+		export printf x=1 awk --verbose -eu test -eu "$@" --verbose
+x=1 -eu then sed then export done "$1" 2>/dev/null 'quoted text'
+		| | readonly grep grep local -eu ${HOME}
+		| export echo | echo x=1 | printf then cd "$@" "$@" 'quoted text' 2>/dev/null
+x=1 awk 2>/dev/null echo done
+		${HOME} sed | ${HOME} 2>/dev/null /usr/bin test grep cd "$@" done local 'quoted text'
+		/usr/bin local 'quoted text' readonly awk /usr/bin then then
+readonly 2>/dev/null 2>/dev/null sed "$1"
+	${HOME} | --verbose test "$1" sed --verbose
+		grep test then $(pwd) "$@" export $(pwd) readonly local --verbose "$1"
+${HOME} -eu readonly echo | printf 2>/dev/null | export 'quoted text'
+		$(pwd) -eu cd printf 2>/dev/null then grep cd sed $(pwd) export echo then done
+then sed ${HOME} 'quoted text' ${HOME}
+x=1 then test "$1" cd x=1 cd test then | echo -eu &&
+		export | done sed --verbose "$@" ${HOME} export --verbose echo cd awk
+		2>/dev/null done done | readonly
+		cd -eu -eu $(pwd) cd x=1 awk
+--verbose then "$@" cd "$@" 2>/dev/null /usr/bin
+		-eu then && $(pwd) done x=1 grep "$1"
+		cd /usr/bin sed x=1 2>/dev/null sed export test
+-eu $(pwd) grep --verbose readonly 2>/dev/null export
+		'quoted text' test cd ${HOME} 'quoted text' "$1" readonly cd
+		${HOME} echo done 'quoted text' printf "$@" 'quoted text'
+		test done printf 2>/dev/null test printf 'quoted text' sed --verbose 'quoted text'
+		grep export echo && x=1 --verbose grep echo | sed awk export export && readonly
+		grep "$@" sed && readonly printf export x=1 export
+grep printf sed && echo echo then test | sed 2>/dev/null sed "$@" $(pwd) 2>/dev/null
+'quoted text' "$1" echo done --verbose 'quoted text' "$@" export "$@" -eu readonly
+		then grep done "$@" grep | readonly awk printf 2>/dev/null /usr/bin
+	local then awk export ${HOME} sed export
+	"$1" --verbose --verbose | && | && printf $(pwd) | -eu /usr/bin 2>/dev/null
+	-eu awk grep "$@" done && printf --verbose --verbose then test /usr/bin test
+		${HOME} test sed 2>/dev/null then export readonly $(pwd) 'quoted text' /usr/bin
+	${HOME} ${HOME} 2>/dev/null
+"$1" sed echo export done sed test done test -eu ${HOME} export x=1 echo "$1" awk
+		&& "$1" cd "$1" "$1" then printf ${HOME} echo
+	'quoted text' readonly "$@" 2>/dev/null export ${HOME} 2>/dev/null then
+	readonly && $(pwd) done "$@" cd /usr/bin
+	export $(pwd) $(pwd) awk grep -eu /usr/bin && | "$1" then
+	cd 2>/dev/null local then | test --verbose cd
+'quoted text' 'quoted text' | /usr/bin --verbose local "$1" "$@"
+		then --verbose ${HOME} 2>/dev/null | $(pwd) &&
+		printf x=1 done export /usr/bin --verbose "$@" readonly x=1 /usr/bin $(pwd)
+		-eu cd grep --verbose x=1 "$@" readonly
+sed -eu printf local /usr/bin sed
+--verbose $(pwd) $(pwd) sed
+echo done grep then $(pwd) then sed "$1"
+		echo --verbose "$@" "$@" awk cd -eu 2>/dev/null grep export local /usr/bin &&
+		cd /usr/bin sed -eu echo test /usr/bin --verbose awk sed x=1 then
+	'quoted text' -eu then sed sed awk test done readonly $(pwd) $(pwd) export x=1
+		x=1 done awk | then done | "$@" | && /usr/bin && readonly local
+${HOME} 2>/dev/null 'quoted text' "$@" export done echo grep $(pwd)
+2>/dev/null sed "$@" export cd
+sed echo then 2>/dev/null cd cd cd local done local "$1" local local /usr/bin
+		--verbose "$@" export readonly "$@" local printf export ${HOME}
+	export awk grep test cd sed printf then
+	"$@" -eu then && local
+-eu ${HOME} ${HOME} x=1 "$@" ${HOME} cd
+	awk 2>/dev/null x=1 echo && readonly && awk "$1" -eu cd local "$1" $(pwd)
+grep "$1" 2>/dev/null /usr/bin "$@" cd -eu printf
+		2>/dev/null done 'quoted text' "$@" 'quoted text' "$1" ${HOME} /usr/bin then
+		/usr/bin echo 'quoted text' cd "$1" readonly echo awk done /usr/bin ${HOME} local
+		test x=1 then sed 2>/dev/null grep --verbose echo
+done 'quoted text' 2>/dev/null done readonly | export ${HOME}
+	| readonly export x=1 echo ${HOME} /usr/bin
+	local -eu "$1" cd cd --verbose awk cd "$@" cd then
+| cd test $(pwd) && -eu "$@" $(pwd) 2>/dev/null
+	local done "$@" sed && awk "$@" echo x=1
+		sed printf | ${HOME} ${HOME} awk ${HOME} readonly
+		"$1" export local -eu -eu export "$@" x=1 printf "$@" sed && "$1" "$1" grep
+		'quoted text' then -eu /usr/bin grep grep $(pwd) --verbose 2>/dev/null ${HOME}
+grep done $(pwd) -eu $(pwd) "$1" | /usr/bin printf x=1 export 'quoted text' export
+		export --verbose export
+	local /usr/bin $(pwd) sed $(pwd) done test done local ${HOME} --verbose
+/usr/bin -eu grep $(pwd) awk $(pwd) sed readonly
+	sed local sed cd "$@" local sed local ${HOME} --verbose sed "$@" --verbose echo
+	echo local ${HOME} printf readonly ${HOME} "$1" 'quoted text'
+		done /usr/bin sed done test 'quoted text'
+	x=1 export "$@" | ${HOME} /usr/bin /usr/bin printf -eu "$@" x=1 /usr/bin
+	cd readonly $(pwd) echo local $(pwd) | cd && x=1 done done sed done sed --verbose
+	grep --verbose printf /usr/bin
+		export sed x=1 grep 2>/dev/null
+test /usr/bin | local "$1"
+		sed echo $(pwd) grep awk 2>/dev/null ${HOME}
+		echo printf 2>/dev/null x=1 | sed | 'quoted text' "$1"
+2>/dev/null then sed 2>/dev/null "$1"
+	test /usr/bin --verbose "$@" $(pwd)
+	--verbose "$1" printf "$@" echo cd then x=1 export
+	done export then awk | cd sed "$@" -eu readonly "$1" local ${HOME} 'quoted text'
+		export && ${HOME} local printf printf ${HOME} export
+		awk --verbose sed 'quoted text'
+		grep "$1" grep printf x=1 cd done "$1" grep done 2>/dev/null
+		readonly grep test ${HOME} 'quoted text' $(pwd) && $(pwd) test test --verbose
+echo readonly then printf readonly /usr/bin "$1" echo
+		${HOME} "$1" readonly printf x=1 sed cd test 'quoted text'
+| grep | 'quoted text' $(pwd) test then 2>/dev/null
+		awk 2>/dev/null 2>/dev/null local x=1 /usr/bin test readonly awk "$@"
+'quoted text' 2>/dev/null awk "$@" grep $(pwd)
+		then -eu then /usr/bin echo "$@" 'quoted text' done test 'quoted text' 2>/dev/null
+	--verbose ${HOME} "$@" --verbose readonly done ${HOME} test
+	| "$1" then "$1" printf $(pwd) echo /usr/bin then
+	2>/dev/null /usr/bin $(pwd) "$@" && --verbose 'quoted text' x=1 sed
+		done 2>/dev/null printf then $(pwd) export && | test echo awk --verbose
+		export | /usr/bin 2>/dev/null readonly && "$1" 'quoted text' "$@" local
+		&& 2>/dev/null then 'quoted text' $(pwd) then
+		| ${HOME} grep local printf 2>/dev/null "$@" echo
+done --verbose cd test | grep
+	export $(pwd) ${HOME} 2>/dev/null 2>/dev/null done echo readonly /usr/bin ${HOME}
+		cd -eu test -eu "$1" "$@" x=1 'quoted text' export echo readonly 'quoted text'
+grep done && sed 'quoted text'
+		x=1 $(pwd) -eu echo readonly "$@" test grep sed && -eu echo 'quoted text'
+		then /usr/bin | | $(pwd)
+		local /usr/bin "$1" | $(pwd) readonly 'quoted text' readonly echo --verbose
+		2>/dev/null $(pwd) cd | cd local /usr/bin
+"$@" cd awk --verbose 2>/dev/null sed readonly
+	done 'quoted text' echo 'quoted text'
+	| | "$1" $(pwd) test test done done | grep then --verbose
+		readonly awk cd printf readonly sed "$1" "$@" grep $(pwd) "$1" ${HOME}
+	--verbose local sed test printf export sed echo /usr/bin local readonly test
+printf grep then -eu awk x=1 printf local test printf done
+$(pwd) "$@" --verbose "$@" /usr/bin
+| grep -eu echo x=1 sed $(pwd) grep cd printf 'quoted text' sed
+/usr/bin "$1" export test printf echo grep 2>/dev/null
+printf done && "$1" | grep 'quoted text'
+&& -eu local && echo test export
+grep /usr/bin --verbose "$@" cd --verbose --verbose grep "$1"
+		echo grep awk sed done "$@" grep 2>/dev/null -eu /usr/bin ${HOME}
+		"$@" ${HOME} awk then awk ${HOME} -eu && --verbose | awk | awk "$1"
+		cd test /usr/bin /usr/bin ${HOME} readonly && awk "$@"
+	cd cd x=1 export 2>/dev/null awk sed "$1" "$@" -eu | then --verbose
+local --verbose grep $(pwd) done $(pwd) test &&
+	printf --verbose --verbose "$1" "$@" --verbose /usr/bin /usr/bin done
+		local done grep 'quoted text' --verbose done local -eu
+	grep 2>/dev/null && export echo /usr/bin -eu &&
+		| 'quoted text' local cd awk then then
+"$@" echo $(pwd) $(pwd) /usr/bin && readonly
+x=1 /usr/bin readonly $(pwd) 2>/dev/null
+		2>/dev/null "$1" sed local ${HOME}
+		--verbose done then --verbose
+'quoted text' && $(pwd) export then "$1" -eu test --verbose ${HOME}
+cd && $(pwd) x=1 /usr/bin awk | | export && grep printf grep printf sed export
+readonly "$1" echo /usr/bin ${HOME}
+--verbose echo export "$1" $(pwd) echo done grep --verbose
+$(pwd) && "$@" then readonly --verbose
+	cd --verbose ${HOME} awk $(pwd) 'quoted text' export grep --verbose cd --verbose
+	&& sed "$1" grep test readonly
+	printf local local cd --verbose --verbose local then ${HOME} | "$@"
+local printf done --verbose readonly ${HOME} x=1 "$@" test ${HOME}
+export export then readonly test 'quoted text' "$1" x=1 x=1 /usr/bin
+	'quoted text' /usr/bin "$1" "$@" sed "$1"
+2>/dev/null ${HOME} awk printf echo cd && ${HOME}
+		sed sed 2>/dev/null x=1 ${HOME} echo awk test $(pwd) $(pwd) $(pwd) export done
+	test $(pwd) "$1" -eu -eu x=1
+	"$@" readonly grep ${HOME} test | printf cd
+		${HOME} local x=1 echo /usr/bin local && "$1" readonly && /usr/bin printf
+-eu "$1" echo cd 2>/dev/null export 'quoted text' then -eu 2>/dev/null
+"$1" --verbose readonly x=1 && local then 2>/dev/null && readonly 'quoted text'
+		readonly $(pwd) x=1 echo cd x=1 /usr/bin
+		'quoted text' --verbose "$1" echo test
+x=1 local sed ${HOME} "$1" cd 2>/dev/null echo
+		"$1" "$1" sed --verbose | done ${HOME} readonly done printf readonly
+	readonly printf test sed test then then | readonly
+	awk ${HOME} $(pwd) $(pwd) local
+	"$1" ${HOME} | sed then cd 'quoted text' export $(pwd) --verbose
+		"$1" awk readonly && && "$1" printf awk local 2>/dev/null
+	$(pwd) done test export "$@" sed then x=1 then grep sed |
+&& then 'quoted text' printf /usr/bin export "$@" export sed /usr/bin
+		2>/dev/null local /usr/bin sed
+	-eu echo x=1 && 2>/dev/null | local $(pwd) sed 2>/dev/null 'quoted text' done
+	"$1" 2>/dev/null /usr/bin readonly export echo test -eu sed awk echo
+| sed $(pwd) "$1" readonly then sed /usr/bin done --verbose 'quoted text'
+	--verbose x=1 then x=1 sed 'quoted text' readonly $(pwd) x=1 "$@" export then
+	export test local | $(pwd) &&
+	${HOME} "$@" test 'quoted text' sed cd then x=1 test 'quoted text'
+$(pwd) 2>/dev/null then grep 2>/dev/null echo
+		-eu echo 2>/dev/null "$1" "$@"
+		"$1" readonly && grep 'quoted text' "$1" cd cd ${HOME} test grep "$1" sed 2>/dev/null
+	echo done && 'quoted text'
+grep ${HOME} local ${HOME} sed && export export sed echo
+	done cd "$@" printf test x=1 local export local echo 'quoted text' awk
+		test x=1 done test grep -eu sed x=1 done export $(pwd) then export
+echo --verbose done ${HOME} readonly
+/usr/bin test 2>/dev/null done export printf
+printf x=1 "$1" 2>/dev/null x=1 2>/dev/null x=1 -eu | awk readonly
+		-eu awk cd then | x=1 $(pwd) test printf sed $(pwd) echo awk done $(pwd) readonly
+	cd then && cd --verbose | 2>/dev/null grep x=1 awk -eu -eu ${HOME}
+		grep "$1" 2>/dev/null 2>/dev/null echo export sed "$1" ${HOME} $(pwd)
+		${HOME} 'quoted text' ${HOME} ${HOME} x=1 done done grep && "$1"
+	export ${HOME} cd && export | /usr/bin local grep 'quoted text' readonly $(pwd)
+export $(pwd) echo readonly x=1 sed
+		grep 'quoted text' x=1 test && | then readonly grep
+		local printf readonly cd "$1" 2>/dev/null
+"$@" local grep test awk export
+		"$1" then "$@" readonly && "$@" sed readonly grep then
+		&& 2>/dev/null "$1" --verbose && local done ${HOME} done
+&& x=1 x=1 cd readonly x=1 | readonly "$1" --verbose grep grep 2>/dev/null
+-eu --verbose grep x=1 2>/dev/null --verbose grep then
+printf "$1" 2>/dev/null cd local export ${HOME} "$1" ${HOME} done
+		sed awk | grep "$1" readonly printf export test --verbose printf
+		printf then | readonly printf 'quoted text' /usr/bin
+-eu 2>/dev/null grep sed -eu sed
+		${HOME} 2>/dev/null x=1 ${HOME} done 'quoted text'
+	sed echo sed sed x=1 grep grep readonly printf 2>/dev/null ${HOME} /usr/bin
+	"$1" readonly $(pwd) ${HOME} test $(pwd) export
+		/usr/bin test done then 'quoted text' echo readonly &&
+	awk ${HOME} 2>/dev/null cd --verbose grep echo awk --verbose | "$1" then
+cd then && readonly 'quoted text' "$1" readonly --verbose local "$1" && done
+	&& printf export "$1" -eu /usr/bin then grep
+	x=1 2>/dev/null grep && echo 2>/dev/null printf x=1 cd "$@" done printf readonly
+		--verbose /usr/bin ${HOME} echo
+	printf && --verbose then local /usr/bin | 'quoted text'
+	-eu grep cd readonly && then printf
+		--verbose export $(pwd) --verbose
+	printf then /usr/bin sed && cd then awk --verbose local x=1 then 'quoted text'
+		test local 2>/dev/null local
+| 2>/dev/null --verbose awk readonly awk test ${HOME} sed done local export then
+		-eu grep ${HOME} -eu cd cd 'quoted text'
+	export echo 2>/dev/null
+		printf echo | && test awk 'quoted text' grep ${HOME} local echo /usr/bin test
+cd && 2>/dev/null local awk local then "$1" "$1" local printf
+		x=1 awk --verbose done echo "$@"
+echo --verbose echo readonly | done export awk 'quoted text'
+	done local 2>/dev/null ${HOME} echo cd ${HOME} | sed readonly local
+		"$@" export 'quoted text' $(pwd) -eu then awk x=1 awk 2>/dev/null test 'quoted text'
+	| cd sed cd -eu -eu printf
+	local awk printf | | 'quoted text' then printf
+readonly sed ${HOME} ${HOME} echo echo "$1" x=1 grep ${HOME} 'quoted text' | "$1"
+		"$1" && -eu --verbose /usr/bin awk then 2>/dev/null sed
+	done -eu readonly | 2>/dev/null "$1"
+		x=1 printf readonly sed printf cd ${HOME} echo -eu $(pwd) | x=1 readonly
+		${HOME} local "$1" /usr/bin 2>/dev/null -eu 2>/dev/null printf --verbose export
+	local readonly 'quoted text' then readonly -eu then "$1"
+	"$@" echo 2>/dev/null -eu
+cd awk /usr/bin $(pwd) done echo "$@" grep
+		done test /usr/bin export local ${HOME} "$@" --verbose
+grep | /usr/bin echo x=1 -eu
+sed 2>/dev/null x=1 export
+		x=1 /usr/bin done | 2>/dev/null local $(pwd) ${HOME}
+$(pwd) | 2>/dev/null export --verbose
+/usr/bin done export
+then -eu test local 2>/dev/null --verbose $(pwd) "$1" 'quoted text'
+	${HOME} cd x=1 -eu sed ${HOME} export awk done sed && export
+	| 'quoted text' 'quoted text' export -eu
+		2>/dev/null readonly "$1" 2>/dev/null printf ${HOME}
+x=1 && "$@" awk 'quoted text' && 'quoted text' $(pwd) 2>/dev/null
+	export 2>/dev/null echo local $(pwd) $(pwd) grep test ${HOME} 2>/dev/null done
+		${HOME} local "$1" done ${HOME}
+		test --verbose x=1 /usr/bin
+	x=1 cd echo local done awk sed
+/usr/bin printf $(pwd) done grep "$@" "$1" 'quoted text' done
+		awk sed 'quoted text' readonly
+-eu then x=1 2>/dev/null $(pwd) | -eu
+	printf then --verbose export $(pwd) cd 'quoted text'
+		done grep ${HOME} local readonly
+		--verbose echo 'quoted text' x=1 done $(pwd) cd 'quoted text' done test printf
+	'quoted text' && export x=1 --verbose $(pwd) |
+awk -eu -eu then echo done test "$1" | --verbose 2>/dev/null
+/usr/bin --verbose sed readonly then
+echo -eu then "$1" -eu awk x=1 grep done sed
+	'quoted text' export printf "$@" /usr/bin readonly
+	'quoted text' done -eu
+	printf x=1 /usr/bin grep
+		printf "$1" ${HOME} x=1 $(pwd) then -eu export ${HOME}
+	$(pwd) done printf --verbose done ${HOME} "$@"
+&& --verbose done 'quoted text' echo echo 2>/dev/null x=1 "$@" 'quoted text'
+	printf test echo done export /usr/bin grep "$1" | "$@" $(pwd) -eu
+	${HOME} cd printf -eu local then --verbose && && cd $(pwd) && test "$1"
+x=1 "$1" cd sed | | ${HOME}
+	test /usr/bin test export && awk printf
+		${HOME} "$@" awk awk local $(pwd) echo $(pwd) ${HOME} grep
+awk test printf /usr/bin
+${HOME} then readonly echo sed 'quoted text'
+	grep test readonly /usr/bin echo 2>/dev/null sed grep local
+	grep ${HOME} 2>/dev/null "$1" sed
+${HOME} ${HOME} $(pwd) -eu sed cd 'quoted text'
+	test $(pwd) x=1 then echo "$@" x=1 x=1 echo then 2>/dev/null x=1 $(pwd)
+	printf echo sed /usr/bin printf sed test 'quoted text' cd done then 2>/dev/null
+local grep local x=1 export printf | | "$1" test x=1 'quoted text'
+		/usr/bin grep done 2>/dev/null "$@" local x=1 --verbose 'quoted text'
+printf ${HOME} 'quoted text' cd readonly printf $(pwd) test awk
+		readonly -eu x=1 /usr/bin --verbose export &&
+${HOME} "$@" echo ${HOME} /usr/bin grep 2>/dev/null "$1" "$@" && | test -eu readonly
+	| export -eu ${HOME} readonly done "$1" export export test $(pwd) x=1 "$@"
+	--verbose readonly --verbose local x=1 grep local
+$(pwd) /usr/bin && export grep
+	"$1" printf cd && 'quoted text'
+		grep /usr/bin local then sed done test local awk
+	| 'quoted text' printf "$1" -eu $(pwd)
+		&& test local | test done /usr/bin $(pwd) awk sed
+		cd $(pwd) -eu grep ${HOME} readonly | "$1" local "$1" --verbose
+		printf -eu --verbose echo /usr/bin ${HOME} | test $(pwd) test
+printf 'quoted text' --verbose readonly test 'quoted text' cd awk && ${HOME}
+	test $(pwd) printf $(pwd) readonly /usr/bin
+export $(pwd) then && done ${HOME} --verbose echo sed printf "$1" && export "$1"
+-eu local && readonly x=1 -eu awk test done -eu 'quoted text' x=1 then echo grep
+	sed then x=1 -eu then x=1 test
+	awk export test cd $(pwd)
+		2>/dev/null "$1" sed $(pwd) readonly && local --verbose
+		sed grep printf ${HOME} x=1 'quoted text' local x=1 export
+then /usr/bin && | "$@" | done ${HOME} export
+local "$1" --verbose
+		export 'quoted text' export -eu done local x=1 cd printf 2>/dev/null x=1 readonly
+	| 2>/dev/null cd printf x=1 grep echo cd
+	test done 'quoted text' grep "$@"
+	sed "$@" /usr/bin $(pwd) && 2>/dev/null awk readonly
+sed -eu local $(pwd) x=1 | readonly "$@" | done awk
+sed "$@" grep local echo printf local --verbose printf $(pwd) $(pwd) done
+		test readonly then "$@"
+x=1 done test then export x=1 2>/dev/null
+${HOME} grep done x=1 "$@" readonly /usr/bin
+	"$@" sed printf test && "$@" awk export readonly echo grep then /usr/bin
+	done 2>/dev/null cd local --verbose x=1 "$@" awk then 'quoted text' | "$@"
+	local echo then readonly sed readonly
+| --verbose then -eu readonly export awk 2>/dev/null
+${HOME} then x=1 && done export
+		export "$@" --verbose printf readonly && local test | printf test printf cd
+grep done awk readonly cd $(pwd)
+	echo && | local export ${HOME}
+	x=1 /usr/bin test export local
+	&& | local printf then cd sed echo grep cd "$@" grep then /usr/bin
+printf sed export ${HOME} /usr/bin grep
+2>/dev/null readonly cd readonly local --verbose | then
+cd 'quoted text' 'quoted text' --verbose --verbose sed && awk printf && awk
+then export 'quoted text' printf printf ${HOME}
+		$(pwd) 'quoted text' echo local ${HOME} readonly local x=1 $(pwd)
+-eu cd $(pwd) x=1 readonly grep
+	local printf sed export echo | then
+	printf /usr/bin "$@" awk --verbose | sed
+	local 'quoted text' x=1 $(pwd) 'quoted text'
+	test x=1 $(pwd) awk local "$@"
+'quoted text' --verbose 2>/dev/null --verbose
+awk readonly | "$1" x=1 ${HOME} local ${HOME} export local done x=1 $(pwd) -eu
+	cd $(pwd) awk echo | && cd ${HOME} test printf sed | 'quoted text' --verbose
+	| done 'quoted text' printf readonly x=1 $(pwd) export then
+	local ${HOME} x=1 /usr/bin && 'quoted text'
+echo --verbose printf export awk --verbose ${HOME}
+	"$1" sed grep $(pwd) "$@" test cd local $(pwd)
+		"$1" /usr/bin done awk cd readonly 2>/dev/null 'quoted text' x=1 ${HOME} export
+then printf cd local --verbose 'quoted text' done export
+readonly test export local 2>/dev/null sed "$@" /usr/bin echo -eu test readonly
+		echo --verbose cd 2>/dev/null && -eu local && && local 'quoted text' && awk
+	'quoted text' printf | test $(pwd)
+		cd "$@" && done awk awk then done $(pwd) x=1 x=1 ${HOME} | 2>/dev/null
+--verbose /usr/bin && && sed -eu "$1" 'quoted text'
+		"$1" done ${HOME} | /usr/bin done grep awk | awk echo -eu grep "$@" ${HOME}
+--verbose done "$1" 'quoted text'
+	export grep export echo "$@" test --verbose export
+echo 2>/dev/null x=1 local $(pwd) "$1" cd done
+grep "$1" echo | -eu then 'quoted text' $(pwd) readonly done /usr/bin 'quoted text'
+printf $(pwd) awk cd --verbose ${HOME} sed | grep &&
+	cd test test -eu 'quoted text'
+x=1 ${HOME} done test x=1 grep x=1 -eu && cd awk && x=1
+	test export cd --verbose test echo $(pwd) && "$@" "$1" printf export then
+/usr/bin ${HOME} | 2>/dev/null ${HOME}
+		x=1 sed 2>/dev/null then 2>/dev/null ${HOME} local test $(pwd)
+	"$1" cd | cd cd readonly sed x=1 printf
+		export done x=1 sed cd -eu
+	/usr/bin /usr/bin cd | then "$1" x=1 "$@" sed x=1 done printf "$1" --verbose
+	"$1" | then 2>/dev/null x=1 echo | awk x=1 cd export done done grep grep
+-eu 2>/dev/null ${HOME} 2>/dev/null printf "$1" x=1 sed x=1
+		cd sed echo "$@" then "$@" 'quoted text' cd "$1" "$@" sed
+		readonly /usr/bin done export grep --verbose echo export | /usr/bin
+	'quoted text' "$1" printf readonly
+		awk 2>/dev/null $(pwd) then 'quoted text'
+printf x=1 $(pwd) | test 2>/dev/null | local readonly x=1 "$1" sed /usr/bin
+	&& done local grep && $(pwd) sed ${HOME} -eu "$@" --verbose cd cd x=1 /usr/bin
+	sed "$1" local 2>/dev/null && ${HOME} -eu "$1" local $(pwd) test -eu echo x=1
+		| "$@" -eu done "$@" cd awk echo "$1" "$1" $(pwd) test sed echo /usr/bin
+	$(pwd) grep sed && | "$1" awk --verbose done cd $(pwd) export local ${HOME} printf
+		/usr/bin $(pwd) printf /usr/bin awk cd grep cd done test -eu printf
+		--verbose && /usr/bin awk 2>/dev/null
+local done "$@" test "$1" 'quoted text'
+-eu ${HOME} printf ${HOME} -eu done "$@" sed
+		awk cd test ${HOME} x=1 grep echo export cd printf
+	'quoted text' | local export -eu x=1 export --verbose local
+	'quoted text' done sed $(pwd) /usr/bin
+	cd local /usr/bin export sed test echo
+		${HOME} x=1 test local -eu --verbose "$1" | && local done done cd | test
+&& export 2>/dev/null
+	"$@" test awk $(pwd) done grep 2>/dev/null 'quoted text'
+2>/dev/null --verbose -eu sed && export 2>/dev/null readonly && 'quoted text'
+local $(pwd) 'quoted text' test --verbose -eu "$@" cd "$@" ${HOME} -eu -eu
+		--verbose echo done cd printf
+done echo "$@" -eu echo
+x=1 /usr/bin /usr/bin ${HOME}
+		export | then -eu "$1" && awk awk 'quoted text' -eu grep cd /usr/bin /usr/bin awk
+		test $(pwd) && awk x=1
+		/usr/bin test && done test
+		then 'quoted text' grep cd /usr/bin printf done export then readonly
+	"$@" local local ${HOME} awk
+	export test | 'quoted text' /usr/bin done local echo awk /usr/bin 'quoted text'
+'quoted text' x=1 cd local done
+	--verbose $(pwd) /usr/bin done printf 2>/dev/null done readonly echo |
+		grep -eu -eu | done done awk "$@" /usr/bin
+		2>/dev/null readonly --verbose 'quoted text' "$@" /usr/bin
+	local | | sed x=1 cd /usr/bin grep cd /usr/bin then /usr/bin
+		2>/dev/null --verbose cd "$1" export cd sed
+/usr/bin readonly $(pwd) 2>/dev/null ${HOME} printf x=1 --verbose
+		export ${HOME} 2>/dev/null x=1 then 'quoted text' $(pwd)
+	/usr/bin cd x=1 grep export 2>/dev/null "$@" 2>/dev/null readonly cd &&
+	x=1 test /usr/bin --verbose sed echo export x=1
+local export && "$@" --verbose /usr/bin x=1 export printf grep x=1 awk --verbose
+	&& x=1 'quoted text' "$@" test -eu awk sed | printf x=1 readonly
+grep grep "$1" readonly printf -eu 'quoted text' --verbose
+	local awk /usr/bin echo awk x=1 2>/dev/null |
+grep | "$@" | cd | test test sed done
+	'quoted text' x=1 x=1 ${HOME} /usr/bin
+/usr/bin readonly $(pwd) awk echo export sed grep x=1 test -eu -eu echo cd
+		'quoted text' 'quoted text' test printf then then && printf ${HOME} 'quoted text'
+	export test 2>/dev/null printf cd --verbose then 2>/dev/null test 2>/dev/null
+2>/dev/null awk ${HOME} /usr/bin /usr/bin echo --verbose
+	-eu done test 2>/dev/null x=1 && | x=1 $(pwd) echo printf $(pwd) $(pwd)
+		x=1 cd cd --verbose "$@"
+		'quoted text' 2>/dev/null "$1" local "$1" -eu "$1" "$@" echo test test
+	$(pwd) "$@" sed then awk then test printf -eu local 2>/dev/null done export echo
+	2>/dev/null 'quoted text' then done "$1" export
+	test sed x=1 cd "$1" $(pwd) done grep x=1
+	printf "$@" done ${HOME}
+	-eu sed "$@" --verbose 'quoted text'
+| printf 'quoted text'
+	readonly readonly awk 'quoted text' echo /usr/bin
+		2>/dev/null 2>/dev/null --verbose
+		done 'quoted text' --verbose
+	cd 2>/dev/null /usr/bin sed | grep readonly echo
+awk readonly -eu /usr/bin /usr/bin ${HOME} local "$1" cd then
+	'quoted text' echo ${HOME} grep test "$@" grep export
+	sed /usr/bin "$@" 'quoted text' /usr/bin readonly $(pwd) /usr/bin then
+		done "$@" test --verbose sed "$@" then done x=1 done 2>/dev/null
+	awk grep "$@" done done awk cd "$@" export sed -eu cd 2>/dev/null 2>/dev/null
+/usr/bin local done --verbose $(pwd) then printf readonly | /usr/bin
+sed 2>/dev/null local ${HOME} grep sed | "$1" sed x=1 printf awk
+x=1 export cd 'quoted text' readonly
+		printf then --verbose sed -eu 'quoted text' "$1"
+	"$1" "$1" done local 'quoted text' local test x=1 $(pwd) 2>/dev/null ${HOME}
+		2>/dev/null 'quoted text' && && 'quoted text' then test && local cd
+	${HOME} done export cd sed && "$@" "$@" sed "$@" 2>/dev/null 2>/dev/null | | readonly
+		readonly -eu awk done readonly done local done readonly --verbose done
+'quoted text' local ${HOME} sed sed awk && ${HOME} readonly export
+	--verbose test sed test test
+	'quoted text' "$@" 'quoted text' && | readonly local
+	"$@" 2>/dev/null "$1" local "$@"
+--verbose readonly ${HOME} export /usr/bin sed 'quoted text' test
+&& echo | 2>/dev/null awk "$@" readonly /usr/bin local && 2>/dev/null -eu readonly
+		done ${HOME} --verbose && sed "$1" echo
+		grep printf 'quoted text' export then | -eu awk ${HOME} then cd local printf 2>/dev/null
+	$(pwd) ${HOME} grep then printf awk export
+echo grep /usr/bin printf x=1 readonly done
+then echo sed 'quoted text'
+		x=1 local echo x=1 /usr/bin test cd /usr/bin 2>/dev/null
+		grep | echo /usr/bin "$1" $(pwd) test test done -eu x=1 local $(pwd) export |
+		done sed readonly && --verbose x=1 'quoted text' ${HOME} test readonly --verbose
+--verbose 2>/dev/null | done
+	echo local ${HOME} test "$1" /usr/bin &&
+		export 2>/dev/null then sed ${HOME}
+		cd sed --verbose --verbose --verbose /usr/bin
+	$(pwd) grep local local
+local --verbose test x=1 sed 'quoted text' $(pwd) | test "$1" done readonly /usr/bin
+x=1 "$@" $(pwd) local --verbose -eu "$1" then "$@" printf 'quoted text'
+		${HOME} $(pwd) 2>/dev/null local local
+$(pwd) then export -eu
+2>/dev/null | echo local readonly readonly readonly awk 'quoted text'
+		cd 2>/dev/null export sed grep readonly && 2>/dev/null -eu "$1" --verbose ${HOME}
+sed readonly --verbose readonly printf x=1 grep $(pwd) awk awk
+	2>/dev/null --verbose done readonly "$1" readonly
+export test "$1" grep test echo then readonly
+		then 'quoted text' --verbose x=1 -eu awk
+	--verbose sed $(pwd) then readonly readonly sed test /usr/bin
+&& readonly grep printf printf grep /usr/bin
+/usr/bin done test readonly
+		${HOME} echo | printf awk then -eu ${HOME} printf export
+	| "$1" $(pwd) grep test echo && "$@"
+| printf awk 'quoted text' "$1" test cd /usr/bin 2>/dev/null sed --verbose printf
+		2>/dev/null done --verbose 2>/dev/null "$@" $(pwd) x=1 awk x=1 done cd --verbose
+grep && awk test test done x=1 printf then "$@"
+		x=1 'quoted text' echo ${HOME} "$@" x=1 printf $(pwd) cd test x=1 echo test
+	2>/dev/null awk grep sed export $(pwd) then
+	readonly --verbose grep x=1 x=1 echo
+		printf --verbose export then 'quoted text' --verbose grep
+	sed awk printf local test "$@" 2>/dev/null
+		--verbose test /usr/bin
+	$(pwd) echo x=1 --verbose ${HOME} | then ${HOME}
+	'quoted text' test "$@" readonly readonly 2>/dev/null readonly
+readonly && | -eu readonly $(pwd) "$1" then test
+2>/dev/null "$@" -eu test x=1 2>/dev/null 'quoted text' test readonly 'quoted text'
+export readonly /usr/bin grep | sed $(pwd) 'quoted text' | test then
+	awk local x=1 echo "$1" x=1 printf /usr/bin | awk ${HOME} ${HOME}
+"$1" then done -eu -eu printf local /usr/bin
+	readonly done cd -eu echo test x=1 export ${HOME} 2>/dev/null export
+		| | done $(pwd) 2>/dev/null echo done readonly ${HOME} test awk local 'quoted text'
+	2>/dev/null "$1" -eu then awk awk -eu --verbose /usr/bin &&
+done 2>/dev/null "$1" "$@" "$1" --verbose export | /usr/bin "$1" export
+&& cd awk export cd then "$1"
+	-eu readonly x=1 2>/dev/null $(pwd) grep awk -eu sed /usr/bin "$1" cd test
+		'quoted text' -eu /usr/bin 2>/dev/null
+		'quoted text' 'quoted text'
+	'quoted text' done "$1" -eu && export "$@" "$1" | x=1
+		echo done sed test -eu grep then x=1 test --verbose local
+	printf awk | "$1" test -eu sed local && grep "$1" readonly -eu && grep 2>/dev/null
+--verbose printf 2>/dev/null readonly sed then 2>/dev/null -eu "$@" $(pwd)
+	--verbose test then local $(pwd) readonly
+2>/dev/null /usr/bin done echo cd "$@" ${HOME} /usr/bin
+	2>/dev/null echo sed | ${HOME} awk && x=1 printf
+		test done x=1 x=1 -eu /usr/bin
+	cd -eu local && 2>/dev/null ${HOME} grep && export awk test 'quoted text'
+		export local then sed 'quoted text' 'quoted text'
+	"$@" readonly local printf "$@" sed awk --verbose
+	cd /usr/bin sed x=1 "$1" done export --verbose 'quoted text' local | "$@" $(pwd)
+		then test "$1" "$@" 2>/dev/null printf
+		${HOME} readonly awk printf printf done echo then
+		local done ${HOME} echo sed sed awk x=1 -eu 'quoted text'
+	2>/dev/null done /usr/bin
+x=1 readonly 'quoted text' 'quoted text'
+done | then -eu ${HOME} export
+		-eu "$1" cd echo "$@" "$@" done grep done "$1" grep done "$@"
+printf done printf /usr/bin ${HOME}
+		${HOME} awk x=1 -eu $(pwd)
+	'quoted text' 'quoted text' done sed 2>/dev/null ${HOME} printf printf
+	"$1" x=1 export echo "$@" cd "$@" awk -eu | done local sed grep sed
+	"$1" cd && local ${HOME}
+	awk done awk done echo --verbose then cd 'quoted text' ${HOME}
+		${HOME} && $(pwd) x=1 sed then local export sed test $(pwd) ${HOME} grep grep
+| printf /usr/bin | | grep export readonly grep readonly sed local readonly
+		cd 'quoted text' then -eu $(pwd) "$1"
+echo | readonly 'quoted text' grep --verbose test --verbose ${HOME}
+| sed | 2>/dev/null 'quoted text' grep -eu
+		test $(pwd) echo 'quoted text' echo export printf echo 2>/dev/null "$@"
+	"$@" x=1 sed /usr/bin "$1" 'quoted text' "$@" printf
+--verbose grep cd sed sed sed done &&
+--verbose awk test "$1" local ${HOME} local && printf |
+test $(pwd) readonly --verbose test ${HOME} local 'quoted text'
+cd 'quoted text' 2>/dev/null echo "$1"
+		"$@" x=1 ${HOME} echo sed
+export echo /usr/bin sed done local
+	sed readonly printf "$1" echo 2>/dev/null
+		"$@" awk x=1 | ${HOME} readonly 2>/dev/null then
+	/usr/bin -eu test && cd printf awk x=1
+	local $(pwd) 2>/dev/null sed export
+		2>/dev/null echo 'quoted text' 'quoted text' cd printf
+		cd "$@" awk done /usr/bin
+	'quoted text' sed -eu x=1 echo
+	test "$1" test echo readonly "$@" readonly cd export echo done -eu awk
+readonly export -eu export readonly
+x=1 printf done sed readonly -eu -eu | echo -eu 2>/dev/null cd done
+2>/dev/null done test $(pwd) --verbose
+$(pwd) $(pwd) 'quoted text' cd echo printf grep printf --verbose x=1 cd local
+		"$@" awk ${HOME} /usr/bin | | -eu
+		printf | echo ${HOME} --verbose ${HOME} "$1" then
+		printf printf $(pwd) "$1" local
+/usr/bin -eu 2>/dev/null readonly /usr/bin done -eu test
+		&& then local && awk /usr/bin
+&& 2>/dev/null "$1" --verbose
+test | then test done /usr/bin then done && echo printf "$1" then
+		${HOME} printf -eu $(pwd) "$@"
+&& | --verbose grep local | export
+		test export 2>/dev/null
+	$(pwd) ${HOME} /usr/bin ${HOME} x=1 $(pwd)
+	'quoted text' local awk done export "$@" /usr/bin "$1" local local
+"$@" printf /usr/bin export /usr/bin ${HOME}
+	| x=1 then cd | then --verbose ${HOME} x=1 "$1" readonly
+		x=1 export 2>/dev/null local "$1" done -eu |
+		2>/dev/null --verbose test cd 'quoted text'
+	$(pwd) 2>/dev/null x=1 grep done test -eu awk done 'quoted text' grep ${HOME}
+		2>/dev/null /usr/bin then cd awk ${HOME} "$@" --verbose "$1" && $(pwd) done
+	| 'quoted text' -eu printf awk done sed export 2>/dev/null done $(pwd) grep
+	${HOME} "$@" done --verbose local export 'quoted text' readonly then test cd
+	| && sed echo -eu "$@" /usr/bin printf /usr/bin
+echo grep $(pwd) readonly cd echo && "$1" awk 2>/dev/null export --verbose printf
+	sed 2>/dev/null grep "$@" sed export ${HOME} then done "$@" $(pwd) grep echo echo
+	2>/dev/null x=1 "$@" && && $(pwd) --verbose readonly sed printf | readonly
+-eu done readonly echo ${HOME} | cd export /usr/bin cd $(pwd) "$1" "$1"
+		printf local cd x=1 "$1" sed /usr/bin echo awk local awk | -eu
+		awk "$1" ${HOME} export cd export ${HOME} ${HOME} local x=1 --verbose "$1" --verbose
+	printf test && | x=1 "$@" /usr/bin "$@" local /usr/bin readonly cd done readonly
+#include c64.sh
+	awk test -eu $(pwd) sed | --verbose grep cd x=1 $(pwd) sed
+	-eu "$@" grep then cd ${HOME} then
+		cd sed test grep | -eu awk x=1 ${HOME} sed $(pwd) printf ${HOME} sed cd $(pwd)
+	'quoted text' 'quoted text' "$@" "$1" done then "$@" && done printf $(pwd) /usr/bin
+	$(pwd) $(pwd) 'quoted text' test | readonly 2>/dev/null export local x=1 2>/dev/null
+		2>/dev/null readonly 2>/dev/null
+		readonly && printf "$@" sed cd cd echo test /usr/bin sed export
+	/usr/bin x=1 printf test echo done ${HOME} 2>/dev/null /usr/bin
+	readonly sed export && /usr/bin
+		"$1" 2>/dev/null "$1" 'quoted text' && ${HOME} then 2>/dev/null -eu ${HOME}
+		readonly readonly ${HOME} cd cd 'quoted text' ${HOME} echo 'quoted text'
+--verbose | printf | --verbose
+	export "$1" x=1 && awk sed "$1"
+"$@" x=1 awk done | "$@" echo export 'quoted text' sed $(pwd)
+$(pwd) && cd awk ${HOME} && 'quoted text'
+		"$1" $(pwd) sed --verbose test export test "$@" echo ${HOME} done export export
+	&& then readonly $(pwd) "$1" cd then ${HOME} readonly printf x=1 echo
+		| then then echo cd 2>/dev/null grep --verbose "$1" sed awk -eu --verbose && echo
+		echo readonly $(pwd) 'quoted text' --verbose export
+printf ${HOME} printf /usr/bin --verbose readonly grep "$1" echo export
+		test echo then awk readonly /usr/bin | done sed ${HOME} ${HOME}
+	done $(pwd) printf | local test -eu grep ${HOME} ${HOME}
+	-eu cd /usr/bin "$@" "$1" --verbose export local /usr/bin /usr/bin local
+	$(pwd) test && | "$@" ${HOME} | then then then echo && "$@" "$@" &&
+		| "$@" printf 'quoted text' ${HOME} $(pwd)
+		2>/dev/null /usr/bin $(pwd) --verbose export 2>/dev/null
+${HOME} echo 'quoted text' -eu awk done --verbose test /usr/bin cd $(pwd)
+"$@" test --verbose sed 'quoted text' ${HOME} /usr/bin /usr/bin printf then
+		$(pwd) cd cd "$@" | $(pwd) echo printf awk test local then -eu
+	x=1 | printf /usr/bin $(pwd) --verbose cd done
+	/usr/bin cd test 2>/dev/null then test local sed local echo --verbose grep printf
+		--verbose 'quoted text' && readonly -eu "$@" -eu
+	&& x=1 readonly 'quoted text' 2>/dev/null
+	done 'quoted text' awk ${HOME} x=1 $(pwd)
+	test --verbose --verbose -eu /usr/bin $(pwd) awk -eu grep
+then "$1" printf test "$@" printf grep "$@" /usr/bin /usr/bin ${HOME} -eu printf
+awk export 'quoted text' grep $(pwd) done export "$@" ${HOME} then
+	$(pwd) ${HOME} done sed awk export 2>/dev/null echo $(pwd) "$@" test local
+	-eu /usr/bin | export x=1 sed then -eu test
+		cd grep printf $(pwd) "$@" readonly test -eu awk readonly
+		printf | local x=1 "$@" readonly "$@"
+echo /usr/bin done x=1 awk --verbose --verbose
+	then grep readonly x=1 --verbose ${HOME} then | echo
+-eu "$@" ${HOME} "$@" 2>/dev/null local done awk cd 'quoted text'
+	--verbose -eu ${HOME} printf
+then readonly local echo | | "$1" printf "$1" test sed /usr/bin x=1 done
+	--verbose && local grep printf grep
+	-eu | cd ${HOME} && readonly ${HOME} export -eu | cd local | 'quoted text'
+		-eu printf "$@" local | 2>/dev/null 'quoted text' awk 2>/dev/null "$@" local
+	export awk grep -eu awk export
+		awk cd local echo grep echo echo
+	echo ${HOME} ${HOME} grep 2>/dev/null printf --verbose 2>/dev/null cd 2>/dev/null
+	2>/dev/null ${HOME} printf export echo echo
+local 2>/dev/null sed x=1 printf readonly x=1
+2>/dev/null grep done "$@" -eu 'quoted text' /usr/bin
+cd -eu "$@" "$1" -eu -eu "$@" --verbose export
+"$@" awk "$1" echo x=1 done grep awk
+awk ${HOME} 2>/dev/null then grep "$@" &&
+	x=1 echo printf $(pwd) local x=1 --verbose
+	-eu grep local awk readonly ${HOME} 'quoted text' && $(pwd)
+	local ${HOME} | 2>/dev/null -eu "$1"
+	cd -eu grep echo | x=1 | printf sed test done | awk echo "$@"
+		local readonly x=1 readonly $(pwd) 'quoted text'
+		"$1" 'quoted text' local "$@" | export 'quoted text' "$@" sed then
+	2>/dev/null && readonly x=1 x=1 | --verbose grep printf awk && x=1 printf /usr/bin
+	awk -eu ${HOME} sed "$@" "$@" -eu /usr/bin 2>/dev/null
+		| test "$@" && cd local "$1" test cd /usr/bin 2>/dev/null -eu awk then && /usr/bin
+test echo 'quoted text' && done "$1" echo 'quoted text'
+	test readonly test then grep test sed x=1 $(pwd) && printf "$1" cd
+		readonly --verbose /usr/bin
+	cd echo echo "$1" $(pwd)
+		| --verbose readonly printf /usr/bin | x=1 -eu local sed test
+readonly cd 2>/dev/null "$1" $(pwd) -eu local | grep --verbose
+		'quoted text' "$1" $(pwd) then $(pwd) printf grep test done -eu local --verbose
+	-eu cd done sed export $(pwd) readonly done 2>/dev/null
+	export then x=1 x=1 "$1" && 2>/dev/null /usr/bin
+${HOME} echo readonly /usr/bin -eu x=1 ${HOME} | 2>/dev/null done cd done
+	| | | --verbose 'quoted text' grep test && sed done readonly
+		${HOME} then /usr/bin "$@" test 2>/dev/null --verbose awk sed printf
+--verbose --verbose --verbose 2>/dev/null then x=1 printf sed && done
+		echo "$@" readonly cd "$@" echo "$@" -eu
+x=1 then test echo echo readonly ${HOME} printf
+		cd x=1 --verbose export printf printf cd 'quoted text' x=1
+		--verbose -eu done awk
+	awk echo /usr/bin ${HOME} echo awk echo test | &&
+echo -eu local then awk printf printf done then x=1 ${HOME}
+$(pwd) export -eu awk
+grep test "$@" printf cd ${HOME}
+	local test -eu "$1" $(pwd) export export awk && 'quoted text'
+		&& --verbose "$1" awk "$@"
+	'quoted text' $(pwd) --verbose
+	test awk --verbose && x=1 test "$@" echo
+		cd "$1" grep export -eu && sed grep
+grep sed "$@" local export /usr/bin /usr/bin
+	cd sed export test "$@" printf "$1" cd then grep
+	cd export local -eu | "$1" awk --verbose -eu export /usr/bin "$1" local then
+		done then | $(pwd) sed $(pwd) ${HOME} --verbose then test test /usr/bin
+	"$@" sed sed 2>/dev/null x=1 ${HOME} export "$@" | then
+	sed | 2>/dev/null --verbose
+awk echo cd && local test cd sed export printf
+"$@" | sed x=1 local 'quoted text' grep done awk
+"$@" test && -eu && | -eu x=1
+	printf echo sed sed export "$1"
+	| ${HOME} "$@" -eu | awk "$1" export 2>/dev/null printf x=1 awk done
+	sed ${HOME} 'quoted text' test "$@" 2>/dev/null "$1" done awk cd printf
+awk printf echo cd | ${HOME}
+echo cd echo then readonly
+	readonly -eu readonly awk 'quoted text' -eu "$1" 2>/dev/null export local
+	--verbose export && echo test -eu cd 'quoted text'
+		then x=1 | sed export --verbose
+	printf 'quoted text' "$@" && readonly
+/usr/bin x=1 local readonly export "$@" -eu "$@" cd export
+	awk cd grep $(pwd) sed x=1 readonly 2>/dev/null export --verbose ${HOME}
+	printf ${HOME} "$@" x=1 "$1" "$@" test 2>/dev/null | echo printf
+	"$1" done x=1 cd test x=1 test
+		"$@" local /usr/bin sed printf local grep $(pwd)
+	export local grep readonly $(pwd) sed awk 2>/dev/null test && local grep 2>/dev/null
+	$(pwd) x=1 done | 'quoted text' readonly local
+echo sed x=1 -eu test "$1" "$@" --verbose
+	2>/dev/null readonly | test "$1" done | ${HOME} then then cd cd test ${HOME}
+	export test awk 2>/dev/null -eu sed readonly 2>/dev/null awk test echo readonly
+	'quoted text' "$1" | echo
+"$@" x=1 -eu printf sed | $(pwd) --verbose
+sed | awk "$@" && 'quoted text' readonly awk grep 'quoted text'
+	"$1" $(pwd) then then local done -eu
+		done printf --verbose then local
+		local readonly printf export cd readonly then export test && export printf -eu
+		| 'quoted text' | "$@" export
+	sed grep printf readonly 2>/dev/null 2>/dev/null test -eu
+		'quoted text' cd $(pwd) 'quoted text' local local --verbose
+		$(pwd) export -eu --verbose 'quoted text'
+local "$@" 'quoted text' done "$1" && then x=1 then --verbose echo
+export /usr/bin 2>/dev/null grep awk 2>/dev/null awk grep
+		&& awk cd test --verbose -eu /usr/bin printf 'quoted text'
+		grep sed echo readonly 'quoted text'
+	cd --verbose cd -eu echo echo "$1" 'quoted text'
+		printf readonly -eu | echo export
+	2>/dev/null echo done
+		/usr/bin done | awk awk | export -eu done "$1" 'quoted text'
+		"$1" local /usr/bin 'quoted text' --verbose printf sed "$@" done ${HOME} echo cd
+	2>/dev/null test sed export export test ${HOME} export local /usr/bin sed
+		--verbose -eu awk -eu printf local
+	"$@" grep x=1 --verbose ${HOME}
+export 2>/dev/null echo done done
+		x=1 /usr/bin done readonly grep done /usr/bin printf
+readonly test x=1 then cd cd "$@" && 'quoted text'
+		-eu printf export | 'quoted text' sed && x=1 -eu sed then
+		done awk --verbose local echo
+	sed sed x=1 | readonly done
+		-eu export local readonly 'quoted text' -eu /usr/bin
+	x=1 2>/dev/null -eu "$@" "$1" local export x=1 $(pwd) readonly -eu $(pwd)
+then && sed /usr/bin local then --verbose
+	readonly then grep grep readonly cd && then ${HOME}
+	test -eu printf -eu done echo x=1 /usr/bin 2>/dev/null 'quoted text' "$1"
+		export | readonly awk awk test readonly done "$@" 'quoted text' --verbose | export
+'quoted text' x=1 done 2>/dev/null cd /usr/bin
+	done -eu 'quoted text' /usr/bin -eu 2>/dev/null "$@"
+		sed awk then readonly then
+/usr/bin -eu --verbose readonly
+		${HOME} export -eu && --verbose then
+	| --verbose test echo | x=1 cd
+		-eu 'quoted text' "$1" "$@" local done done export then x=1 'quoted text' printf
+x=1 then echo grep awk --verbose
+-eu && x=1 /usr/bin sed --verbose "$@" cd
+	export -eu grep "$@" readonly sed 'quoted text' local echo --verbose && then
+x=1 -eu cd $(pwd) export && /usr/bin local 2>/dev/null ${HOME} then /usr/bin
+	&& -eu readonly done then ${HOME} && --verbose $(pwd) test
+	&& awk /usr/bin grep --verbose -eu 2>/dev/null sed
+export local 'quoted text' sed 2>/dev/null
+"$1" echo 2>/dev/null /usr/bin "$1" ${HOME} x=1
+'quoted text' grep $(pwd) 2>/dev/null
+	"$@" /usr/bin export $(pwd) 2>/dev/null $(pwd) done -eu cd /usr/bin local 2>/dev/null
+		sed awk sed echo done then done /usr/bin
+	awk echo --verbose readonly local export sed
+	then awk export 2>/dev/null cd test readonly "$@" | 2>/dev/null 2>/dev/null
+"$1" $(pwd) --verbose local then done
+		echo "$1" sed done --verbose local 'quoted text'
+local 2>/dev/null /usr/bin export sed && printf sed | $(pwd)
+		/usr/bin then readonly ${HOME} x=1 | readonly $(pwd) echo test awk --verbose $(pwd)
+		test then -eu done echo x=1 $(pwd) awk
+	local grep $(pwd) $(pwd) cd $(pwd) --verbose done /usr/bin --verbose ${HOME}
+	test cd 'quoted text' 2>/dev/null
+		$(pwd) local printf local /usr/bin sed then grep printf "$@"
+	2>/dev/null sed done ${HOME}
+echo printf --verbose 'quoted text' x=1 done grep 2>/dev/null "$@" sed grep
+&& "$1" x=1 $(pwd) test --verbose printf local done
+x=1 sed export | /usr/bin 2>/dev/null printf local cd sed --verbose
+		2>/dev/null /usr/bin local ${HOME} done
+	/usr/bin awk && x=1 /usr/bin "$1" awk x=1 /usr/bin sed x=1 then cd cd echo
+	export awk | "$@" readonly -eu echo cd "$@" cd echo /usr/bin printf
+		cd done printf ${HOME} --verbose "$@" -eu sed --verbose 2>/dev/null readonly
+	${HOME} test done cd $(pwd) "$@" $(pwd) local
+	awk done sed $(pwd) readonly
+${HOME} echo echo local $(pwd) cd && /usr/bin local
+echo /usr/bin export readonly "$1" 'quoted text' done export done $(pwd)
+/usr/bin printf $(pwd) -eu grep /usr/bin
+		then /usr/bin "$1" cd readonly awk 'quoted text'
+		echo && readonly readonly --verbose local echo echo
+	cd "$@" "$1" export /usr/bin export sed echo then
+	export "$@" test && done ${HOME} $(pwd) | echo "$@" cd done
+	"$@" 'quoted text' readonly 'quoted text' "$1" sed x=1 ${HOME} readonly -eu local
+		$(pwd) sed test 2>/dev/null && | /usr/bin test && sed done local printf --verbose
+	sed /usr/bin export 2>/dev/null sed export && -eu x=1 awk cd sed awk awk done
+	then -eu "$@" && "$1" then --verbose test --verbose readonly "$@" /usr/bin
+&& grep && | --verbose | awk export awk grep grep x=1 /usr/bin
+		printf printf cd readonly -eu readonly -eu && | then --verbose
+printf awk echo "$1" $(pwd) printf then done "$@" grep test cd $(pwd)
+&& local awk "$@" test echo x=1 /usr/bin test then local local printf then
+	printf done && $(pwd) $(pwd) -eu && "$1" "$@" $(pwd) /usr/bin 'quoted text'
+-eu 2>/dev/null cd && readonly x=1 | 'quoted text' export printf 2>/dev/null
+	then $(pwd) then "$@" $(pwd) then $(pwd) --verbose
+		'quoted text' /usr/bin
+	'quoted text' awk $(pwd) "$1" --verbose export local --verbose
+		printf $(pwd) | sed printf awk readonly /usr/bin
+	&& printf done "$@" test printf done | && test readonly "$1" 2>/dev/null
+printf done x=1 awk echo sed | 'quoted text'
+		${HOME} awk | sed printf then awk | -eu sed x=1
+"$@" 'quoted text' && "$@" /usr/bin local echo
+${HOME} export cd "$1" printf
+local done readonly 2>/dev/null 'quoted text' readonly then | "$@" -eu printf /usr/bin
+"$@" && ${HOME} --verbose
+	awk cd export cd done sed
+		local echo 'quoted text' /usr/bin 'quoted text' grep
+	test "$1" "$@" 'quoted text' | 'quoted text'
+-eu -eu sed printf export local printf && $(pwd) test
+	then "$1" /usr/bin && local export local --verbose
+	readonly cd then sed $(pwd) test "$@"
+	awk test export printf
+		&& export readonly grep "$@" then 'quoted text' done export 2>/dev/null | cd local
+/usr/bin echo local cd 'quoted text' grep --verbose
+		test "$@" sed awk grep $(pwd) test then --verbose printf /usr/bin grep
+local sed cd -eu "$@" local "$@"
+	done $(pwd) --verbose cd readonly &&
+'quoted text' 2>/dev/null $(pwd) printf then done awk printf export cd --verbose
+		"$@" /usr/bin then local $(pwd) x=1 'quoted text'
+	sed local 2>/dev/null --verbose grep then 2>/dev/null
+	test 2>/dev/null local sed | ${HOME} x=1 printf echo cd
+readonly -eu ${HOME} awk ${HOME} -eu "$@" $(pwd) "$1"
+then "$@" /usr/bin --verbose then grep
+then echo 'quoted text' 2>/dev/null local
+	cd cd ${HOME} grep grep $(pwd) awk
+	--verbose -eu x=1 "$1" "$1" echo -eu 2>/dev/null && readonly grep local
+'quoted text' then test export
+awk export test ${HOME}
+awk grep "$@" echo local
+	"$1" $(pwd) /usr/bin | --verbose grep grep export cd done awk /usr/bin &&
+		'quoted text' test then export local | test sed export 2>/dev/null printf /usr/bin
+"$1" export -eu x=1 sed test test readonly local test x=1 "$@" $(pwd) x=1 readonly
+	then "$1" printf "$@" done x=1 export awk sed echo
+		cd cd printf printf local local 2>/dev/null export 'quoted text' && && export
+	awk $(pwd) x=1 "$@" sed "$1" -eu printf 'quoted text' -eu printf
+local $(pwd) export --verbose grep local /usr/bin
+	&& 2>/dev/null && ${HOME} && --verbose readonly
+2>/dev/null 2>/dev/null "$@"
+	&& 2>/dev/null | "$1" $(pwd) 2>/dev/null "$1" then | done then | | cd /usr/bin
+		&& readonly 2>/dev/null
+		echo "$@" x=1 2>/dev/null /usr/bin awk && /usr/bin
+	done export 'quoted text'
+	then "$@" x=1 --verbose
+echo x=1 grep readonly then done export echo ${HOME}
+		test -eu test && -eu --verbose
+	local | then | export readonly then ${HOME} 'quoted text' grep export && readonly
+		&& sed 'quoted text' "$@" echo 'quoted text' -eu cd 'quoted text'
+	&& export $(pwd) "$@" -eu export cd readonly done 2>/dev/null then local
+printf && "$1" --verbose then && "$1" readonly echo "$1" export grep
+	printf awk | x=1 then then sed | && "$@" local $(pwd) then
+cd ${HOME} printf echo
+grep done "$@" --verbose export grep 'quoted text' export cd
+$(pwd) $(pwd) printf then /usr/bin awk /usr/bin grep
+	| awk 2>/dev/null cd "$1" done "$1" /usr/bin --verbose local
+grep $(pwd) "$@" /usr/bin
+	printf grep readonly 'quoted text' /usr/bin
+printf /usr/bin export local | export 'quoted text' ${HOME} printf test export x=1
+test | | "$@" grep printf readonly grep
+		test done cd test "$1"
+		2>/dev/null "$@" x=1 |
+done && local awk /usr/bin /usr/bin $(pwd)
+-eu then && echo 2>/dev/null local echo | echo "$1" awk printf done
+		done | "$1" test printf sed | local done sed readonly "$@" $(pwd) done
+	awk test "$@" then | export --verbose --verbose ${HOME} | ${HOME} then 'quoted text'
+		readonly awk echo ${HOME} && "$@" readonly
+	${HOME} printf $(pwd) readonly done 'quoted text' done local ${HOME}
+	x=1 cd ${HOME} awk local 'quoted text' then local
+awk -eu x=1 test /usr/bin cd awk 'quoted text' test cd x=1 'quoted text'
+	readonly --verbose x=1 grep 'quoted text' ${HOME}
+awk /usr/bin echo local 'quoted text'
+grep /usr/bin cd awk x=1 /usr/bin readonly /usr/bin done | awk --verbose
+	2>/dev/null ${HOME} sed
+		then /usr/bin export ${HOME} test test awk "$1" awk export $(pwd)
+	"$@" /usr/bin cd "$1" --verbose grep printf ${HOME} /usr/bin done --verbose
+		echo readonly 2>/dev/null export done sed
+	local | && x=1 /usr/bin grep readonly
+		test sed export readonly done -eu /usr/bin export x=1 --verbose
+grep readonly awk "$1" -eu "$@" $(pwd) 'quoted text' ${HOME} export
+--verbose then then $(pwd) ${HOME} 2>/dev/null
+	grep && 2>/dev/null 2>/dev/null 2>/dev/null awk
+cd $(pwd) 'quoted text' --verbose "$@" 2>/dev/null echo "$@"
+&& --verbose done sed test 'quoted text' --verbose | x=1 2>/dev/null
+test "$@" $(pwd) readonly 'quoted text' "$1" --verbose awk grep cd 'quoted text'
+		export test then readonly 'quoted text'
+done export cd printf x=1 done local done 2>/dev/null printf 2>/dev/null
+		echo echo "$1" x=1 awk echo sed
+	done --verbose grep test x=1 cd
+	awk $(pwd) | sed awk cd | /usr/bin cd grep then test --verbose
+${HOME} --verbose then "$1" done sed
+		"$@" 2>/dev/null readonly export x=1
+&& "$1" cd | -eu --verbose cd --verbose
+	$(pwd) local done readonly awk 2>/dev/null -eu printf export
+grep 2>/dev/null readonly local -eu then printf 'quoted text' done
+		| local $(pwd) printf /usr/bin then -eu 2>/dev/null ${HOME} grep awk sed export
+2>/dev/null ${HOME} -eu 'quoted text' readonly
+	--verbose ${HOME} then 2>/dev/null | sed
+	"$@" x=1 cd grep grep && readonly export
+		2>/dev/null done 2>/dev/null
+cd x=1 readonly echo /usr/bin cd grep local cd "$@" grep /usr/bin
+	&& local echo test ${HOME} local grep then test 2>/dev/null
+	&& ${HOME} cd awk "$1" export grep readonly sed grep printf "$@" grep
+	cd cd x=1 'quoted text' sed test echo x=1 "$1" done "$@" done
+	export done ${HOME} test done then awk ${HOME} --verbose
+test "$@" -eu $(pwd) readonly
+&& test printf printf local && test /usr/bin && cd 'quoted text' "$1"
+	--verbose cd --verbose readonly x=1 ${HOME} ${HOME}
+sed sed /usr/bin grep "$@" done ${HOME} grep "$@" -eu $(pwd) local | grep -eu
+	| "$@" 'quoted text' -eu echo 'quoted text' sed /usr/bin printf "$1" --verbose
+	echo printf local ${HOME} $(pwd) 'quoted text' local then export
+test echo grep test 2>/dev/null local ${HOME} && echo | test 'quoted text'
+	&& ${HOME} local 'quoted text' printf
+	&& && "$@" echo "$1" --verbose x=1 test printf readonly
+	echo | readonly then -eu test ${HOME} test printf 'quoted text'
+	-eu done 2>/dev/null test test grep 2>/dev/null
+	echo readonly /usr/bin sed /usr/bin x=1 awk --verbose 2>/dev/null
+		"$@" -eu cd test /usr/bin $(pwd) -eu cd "$@" awk "$@" ${HOME} $(pwd)
+		"$@" 2>/dev/null 'quoted text' "$1" -eu /usr/bin printf export sed printf && x=1
+		$(pwd) test readonly echo readonly && --verbose 'quoted text' 2>/dev/null awk
+		$(pwd) sed test ${HOME} grep cd 'quoted text'
+echo sed && x=1 grep "$@" echo local "$1" local ${HOME} x=1 && cd
+	x=1 awk test cd "$1" && then sed local && | | then printf 2>/dev/null /usr/bin
+cd "$@" | --verbose grep local x=1 echo x=1 $(pwd) readonly then echo then
+echo echo awk readonly && && "$1"
+${HOME} awk cd "$1" export "$@" echo cd awk echo $(pwd) cd x=1
+| sed test echo $(pwd) printf awk printf -eu "$@" cd awk done "$@"
+"$1" 2>/dev/null && | echo /usr/bin awk then | cd
+	2>/dev/null ${HOME} x=1 awk 'quoted text' local echo cd local
+"$1" /usr/bin done "$1" "$@" awk then 'quoted text'
+	echo ${HOME} cd echo 2>/dev/null
+grep printf /usr/bin 'quoted text'
+	export -eu "$1" && done 2>/dev/null local cd
+"$1" "$@" && test 'quoted text' | done done --verbose
+		awk 2>/dev/null printf export test awk local /usr/bin $(pwd)
+	done && local printf /usr/bin
+	done grep && /usr/bin x=1 ${HOME} && export -eu then
+${HOME} --verbose cd local "$1"
+	local then sed x=1 awk cd sed cd test --verbose
+awk "$1" then x=1 "$@" awk local readonly
+--verbose grep grep printf printf 'quoted text' $(pwd) --verbose $(pwd)
+		2>/dev/null 2>/dev/null awk awk -eu | then 'quoted text' x=1 $(pwd) 2>/dev/null
+		readonly | && -eu test
+	"$1" ${HOME} cd | --verbose | x=1
+export "$1" 'quoted text' 2>/dev/null test awk grep $(pwd) ${HOME} local
+		awk export export ${HOME} -eu done 'quoted text'
+	"$@" readonly /usr/bin "$1" cd
+		&& local -eu -eu then x=1 /usr/bin x=1 done
+grep sed grep awk /usr/bin test
+		test -eu cd cd "$1" 'quoted text' readonly
+	${HOME} /usr/bin && 2>/dev/null awk | grep "$1" sed readonly printf
+/usr/bin --verbose test then echo cd printf --verbose "$1" "$@" export
+		"$1" echo /usr/bin $(pwd) "$1" /usr/bin "$@" done
+	done then readonly test grep test echo && --verbose 'quoted text' ${HOME}
+	"$@" cd export 2>/dev/null sed -eu 2>/dev/null
+		&& readonly && x=1 awk test
+		'quoted text' -eu printf test local printf "$@" | x=1 /usr/bin
+"$1" "$@" x=1 export && grep grep printf done awk
+&& echo awk done /usr/bin
+	"$1" readonly --verbose test --verbose 'quoted text'
+	local sed x=1 x=1 | x=1 test done x=1 /usr/bin -eu printf
+	export cd $(pwd) && awk readonly cd grep awk | x=1 awk readonly
+	${HOME} 'quoted text' awk echo && $(pwd) "$@" cd "$1" $(pwd) export export /usr/bin
+cd x=1 readonly "$1" grep done -eu 2>/dev/null test ${HOME} "$1" awk echo $(pwd)
+		x=1 done cd grep ${HOME} then 2>/dev/null x=1 test done done 2>/dev/null
+	| 2>/dev/null && readonly
+		local awk readonly done done grep ${HOME} test -eu "$1" 2>/dev/null
+		test test then sed test printf --verbose && test grep
+	-eu readonly export cd then local ${HOME} cd && then test
+		--verbose printf -eu $(pwd) $(pwd) awk ${HOME} done | $(pwd) $(pwd) then ${HOME}
+| | "$1" $(pwd) then -eu -eu then export cd cd /usr/bin "$@"
+	x=1 echo --verbose then grep awk "$@" awk cd x=1 && printf done test --verbose
+	local test ${HOME} -eu x=1 ${HOME}
+	readonly 2>/dev/null then awk readonly
+	| sed awk x=1 | 'quoted text' | /usr/bin cd done
+	readonly --verbose printf echo grep 'quoted text'
+| 'quoted text' -eu export /usr/bin sed $(pwd) ${HOME} /usr/bin /usr/bin
+"$@" /usr/bin -eu cd sed export && 2>/dev/null readonly test printf
+		"$1" test echo 'quoted text' "$1" done export
+grep sed "$@" echo test ${HOME} -eu export grep 2>/dev/null
+	/usr/bin | "$@" sed "$@" /usr/bin done local
+then export | test then "$@" grep then grep | local sed 'quoted text'
+		-eu x=1 awk --verbose x=1 2>/dev/null then $(pwd) | ${HOME} 2>/dev/null sed &&
+'quoted text' readonly 'quoted text' x=1 --verbose | grep --verbose done test
+	local 2>/dev/null then then
+printf "$1" $(pwd) local x=1 local "$@" sed --verbose
+export cd $(pwd) done readonly $(pwd) awk --verbose 'quoted text' done 2>/dev/null
+'quoted text' 2>/dev/null -eu sed then then echo x=1
+		"$1" /usr/bin awk "$@" ${HOME} ${HOME} x=1 then
+| export sed readonly local cd $(pwd) "$@" sed "$@" --verbose done test sed | grep
+$(pwd) cd readonly x=1 grep sed echo
+		"$@" 2>/dev/null export sed done --verbose && x=1 cd | readonly
+	test && x=1 cd | sed cd $(pwd) then --verbose
+local --verbose printf && x=1 ${HOME}
+done ${HOME} 2>/dev/null cd done grep $(pwd) && sed readonly "$1"
+		"$@" $(pwd) | ${HOME} ${HOME} cd grep echo awk printf --verbose /usr/bin --verbose
+$(pwd) readonly $(pwd) x=1 x=1 done cd && --verbose grep --verbose --verbose
+	/usr/bin local printf local
+	/usr/bin 2>/dev/null cd /usr/bin then sed ${HOME} grep --verbose
+cd ${HOME} "$1" readonly -eu 'quoted text' /usr/bin 'quoted text' awk &&
+		-eu "$@" grep local then echo && done -eu done grep grep --verbose awk
+	readonly test echo "$@" 2>/dev/null test sed local
+$(pwd) $(pwd) "$@" "$@" 2>/dev/null && | &&
+	-eu "$@" grep export sed ${HOME} done
+		awk export x=1 printf /usr/bin x=1
+		local -eu -eu local grep "$@" grep sed && x=1 x=1 "$1" && "$1"
+		export -eu readonly awk echo cd 2>/dev/null test x=1 && readonly --verbose
+	export readonly x=1 sed export 2>/dev/null 2>/dev/null
+		'quoted text' cd printf
+		cd cd x=1 ${HOME} --verbose ${HOME} /usr/bin 'quoted text'
+		${HOME} $(pwd) | && $(pwd) ${HOME} local x=1 | 2>/dev/null | done cd grep sed
+${HOME} then && "$@" && "$@" --verbose done /usr/bin test grep
+-eu then "$@" "$@" echo x=1 'quoted text'
+		-eu test "$@" ${HOME} done echo then printf awk /usr/bin awk 'quoted text' awk --verbose
+		local 'quoted text' $(pwd) ${HOME} export
+	| "$@" test && "$@" done echo echo /usr/bin 2>/dev/null awk cd --verbose
+	local 2>/dev/null ${HOME} readonly $(pwd) --verbose
+	test then | awk done grep local "$1"
+	readonly | 2>/dev/null sed /usr/bin local readonly sed local awk /usr/bin
+	awk done x=1 echo && then -eu --verbose awk sed ${HOME} readonly 'quoted text'
+	grep ${HOME} awk echo "$1" x=1 x=1 'quoted text' && local grep readonly
+	then echo test export local printf
+	--verbose done 2>/dev/null local echo "$1" $(pwd) local awk "$@" 2>/dev/null
+		cd "$@" 'quoted text' export 'quoted text' 2>/dev/null test && sed readonly
+	/usr/bin sed 2>/dev/null x=1 echo echo echo printf /usr/bin
+export local "$@" printf printf grep 'quoted text' 2>/dev/null
+&& grep x=1 grep "$@" | -eu "$1" ${HOME} awk --verbose -eu -eu cd export awk
+	grep sed | "$@" --verbose then printf 2>/dev/null
+local local test local 'quoted text'
+sed x=1 'quoted text' "$@" sed 2>/dev/null ${HOME}
+		$(pwd) then | -eu awk "$1" | sed "$@" awk grep echo
+2>/dev/null grep && grep awk ${HOME} local awk "$@" then 2>/dev/null
+/usr/bin "$@" local grep done awk then done awk
+	cd -eu readonly echo && $(pwd)
+| "$1" done grep sed 2>/dev/null | 2>/dev/null
+x=1 /usr/bin -eu export sed "$1" printf
+	awk /usr/bin done && readonly then | -eu cd --verbose /usr/bin test export
+done export "$1" local &&
+awk printf "$1" readonly test
+		/usr/bin echo grep readonly "$1" local 'quoted text' sed
+		then grep awk local -eu --verbose awk x=1 2>/dev/null -eu "$@" sed ${HOME} grep
+	2>/dev/null $(pwd) && cd sed --verbose x=1 printf cd then sed "$@" |
+		done | readonly x=1 x=1 "$@" printf sed local /usr/bin
+		awk local grep 2>/dev/null readonly "$@" /usr/bin
+	-eu "$1" "$@" grep ${HOME} done 'quoted text'
+	/usr/bin echo 2>/dev/null
+	echo printf then | readonly cd --verbose
+--verbose cd export awk export then "$@" local test readonly export
+		/usr/bin cd echo done readonly test
+		export -eu 'quoted text' ${HOME} "$1" 'quoted text'
+--verbose grep grep awk local test "$1"
+| export 'quoted text' -eu "$@" 'quoted text'
+--verbose printf readonly printf $(pwd) x=1 awk && /usr/bin echo
+	--verbose "$1" x=1 ${HOME} grep sed cd grep 2>/dev/null |
+		"$@" ${HOME} 'quoted text' awk --verbose cd export
+	cd "$1" /usr/bin awk
+	&& 2>/dev/null && printf x=1 $(pwd) 2>/dev/null
+	cd grep -eu -eu --verbose cd $(pwd) -eu awk -eu $(pwd) then ${HOME}
+$(pwd) grep | 'quoted text'
+	cd printf test 2>/dev/null done export echo --verbose "$1"
+	--verbose 2>/dev/null readonly grep 'quoted text' "$1" grep
+/usr/bin done /usr/bin grep local grep readonly grep test printf
+readonly local sed ${HOME} /usr/bin | | sed awk ${HOME} grep done
+awk "$1" "$1" then grep awk awk
+awk $(pwd) "$1" x=1 sed
+		| 'quoted text' export cd printf printf && ${HOME} -eu readonly readonly 'quoted text'
+	"$@" sed 2>/dev/null echo readonly sed /usr/bin
+		${HOME} --verbose export
+/usr/bin export then "$@" $(pwd) ${HOME}
+	-eu "$1" then done cd cd cd export cd ${HOME} ${HOME}
+/usr/bin ${HOME} grep "$1" export "$1" $(pwd) && awk /usr/bin
+done cd printf $(pwd) "$1" grep 'quoted text'
+		local echo echo 2>/dev/null --verbose awk done --verbose
+		cd 2>/dev/null -eu then readonly grep -eu local
+		'quoted text' local | "$@" done readonly 'quoted text'
+x=1 --verbose "$1" done export "$@" 'quoted text'
+--verbose ${HOME} echo 2>/dev/null 'quoted text' then
+		"$@" grep echo then "$1" $(pwd) x=1 echo local $(pwd) /usr/bin
+	&& printf done /usr/bin done x=1
+		'quoted text' ${HOME} 2>/dev/null ${HOME} $(pwd) sed --verbose
+then readonly | local then awk x=1 cd awk && "$1"
+		-eu | 'quoted text' test test | readonly && awk $(pwd) x=1 &&
+	cd echo --verbose x=1 sed | readonly echo export test 'quoted text'
+	then $(pwd) /usr/bin 2>/dev/null
+	test -eu 'quoted text' "$@" x=1 ${HOME} local x=1 $(pwd) grep
+		2>/dev/null -eu then then
+	printf "$@" x=1 sed local echo then "$1" | then then awk export
+echo 'quoted text' echo cd grep | $(pwd)
+	export /usr/bin x=1 /usr/bin -eu -eu cd export done 'quoted text'
+x=1 grep cd awk 'quoted text' then /usr/bin "$1" local printf /usr/bin
+$(pwd) $(pwd) export --verbose
+	then awk x=1 -eu test then --verbose readonly done test "$@" --verbose
+readonly && ${HOME} $(pwd) readonly ${HOME}
+	x=1 'quoted text' | 2>/dev/null
+awk | $(pwd) $(pwd) "$@"
+		export cd cd && "$@" readonly sed x=1 &&
+	--verbose /usr/bin && |
+/usr/bin -eu local "$1" 2>/dev/null awk ${HOME} readonly test 'quoted text'
+cd readonly 'quoted text' "$@" readonly
+		then x=1 2>/dev/null done done then export -eu readonly "$@" x=1 test then grep
+		| cd done test done echo grep -eu && test $(pwd) awk /usr/bin echo echo
+"$1" "$@" 'quoted text' /usr/bin echo ${HOME} readonly
+		export printf | -eu sed sed --verbose "$1" && && && | 2>/dev/null readonly x=1
+| echo "$@" local cd && ${HOME} export && $(pwd) --verbose --verbose
+		-eu echo echo export grep
+	awk --verbose "$@" grep 2>/dev/null export grep test done
+	&& awk cd $(pwd) printf awk --verbose $(pwd) 2>/dev/null test then local -eu
+${HOME} test echo -eu --verbose "$1" readonly && done "$1" printf 2>/dev/null |
+&& local awk /usr/bin cd 'quoted text'
+cd sed readonly printf awk printf
+	/usr/bin "$@" 'quoted text' /usr/bin
+		x=1 --verbose grep -eu 'quoted text' export readonly | 'quoted text'
+	"$1" done && local grep echo --verbose
+		2>/dev/null $(pwd) --verbose /usr/bin 2>/dev/null -eu && /usr/bin $(pwd)
+${HOME} --verbose test grep awk echo export done local done then --verbose
+	printf "$@" && 2>/dev/null printf cd && -eu 'quoted text'
+	readonly awk printf readonly awk --verbose
+		printf echo 2>/dev/null export test export "$1" 'quoted text' done
+-eu "$@" --verbose test ${HOME}
+export 2>/dev/null export export
+		echo export $(pwd) "$1" done 'quoted text' echo
+		grep x=1 done cd x=1 readonly test test export test 2>/dev/null test
+"$@" local /usr/bin test
+		2>/dev/null x=1 done $(pwd) 'quoted text' done cd "$@" x=1
+	awk "$@" --verbose grep 2>/dev/null test &&
+		"$@" echo local && export cd cd ${HOME} printf done --verbose test
+		awk echo printf --verbose
+		--verbose grep grep "$1" echo --verbose -eu grep echo 'quoted text' x=1 -eu
+	echo awk /usr/bin printf "$1" | test 'quoted text' grep $(pwd) then x=1 local
+	printf then export "$1"
+		"$1" sed --verbose done printf --verbose ${HOME} && ${HOME} test
+	cd grep 'quoted text' "$1" | printf ${HOME} done test then done sed
+		grep echo "$@" -eu /usr/bin local readonly then done
+		export | | test | -eu local readonly sed "$1" readonly -eu
+		grep then grep "$@" cd readonly 'quoted text'
+		| printf && test $(pwd)
+		2>/dev/null readonly | | "$1" sed "$1" export export export ${HOME} $(pwd) |
+		readonly then --verbose ${HOME} -eu /usr/bin awk sed printf x=1 --verbose
+	/usr/bin && printf "$1" | grep cd --verbose
+	'quoted text' cd $(pwd) echo echo export
+	"$@" then readonly grep
+&& then "$@" local test | cd then "$1" local then "$1" | ${HOME} | 2>/dev/null
+	local && local done done "$1" -eu x=1
+	2>/dev/null local 'quoted text'
+grep && --verbose local cd then readonly "$@" 2>/dev/null
+	| then done local | test "$@" x=1 --verbose
+"$@" grep "$1" export local echo awk
+		/usr/bin $(pwd) -eu | $(pwd) ${HOME} awk test 'quoted text' sed cd cd && "$@" 2>/dev/null
+	echo x=1 "$@" done -eu $(pwd) x=1 grep -eu cd x=1
+&& readonly test readonly grep
+	echo "$@" x=1 "$1" | -eu export $(pwd) -eu --verbose sed
+x=1 ${HOME} && sed && 'quoted text' echo -eu
+	then 'quoted text' printf
+$(pwd) "$@" test test "$1" $(pwd)
+printf /usr/bin x=1 done echo export /usr/bin
+sed -eu 2>/dev/null -eu "$@" sed
+		sed 2>/dev/null sed sed cd test $(pwd) /usr/bin
+		cd "$1" -eu test printf cd grep 'quoted text' printf done 'quoted text' export
+	awk done awk grep --verbose
+sed --verbose then 'quoted text' "$@" x=1
+	x=1 ${HOME} "$@" $(pwd) | echo printf then local && ${HOME} 2>/dev/null
+${HOME} 'quoted text' awk echo | 2>/dev/null local awk export /usr/bin done 2>/dev/null
+"$1" 2>/dev/null -eu
+	local ${HOME} "$1" done then "$1" local | readonly echo then readonly
+	&& sed test done export x=1 echo "$1" 'quoted text' sed 2>/dev/null readonly
+"$1" -eu done -eu sed /usr/bin cd local -eu --verbose grep grep 'quoted text'
+$(pwd) $(pwd) $(pwd) --verbose $(pwd) export | done sed
+printf ${HOME} && awk x=1 local awk && 2>/dev/null && awk 2>/dev/null
+awk ${HOME} grep test awk done ${HOME} awk export x=1 local done cd ${HOME}
+	$(pwd) export --verbose 'quoted text' printf $(pwd) echo sed 2>/dev/null
+		echo readonly local --verbose awk awk test awk && sed then test sed
+	then local /usr/bin local export done
+"$1" readonly /usr/bin cd export then | /usr/bin /usr/bin
+	sed grep "$1" -eu "$1" $(pwd) printf awk export test | awk /usr/bin | x=1
+		then sed sed export readonly --verbose ${HOME} | -eu printf x=1
+awk printf awk | readonly x=1 $(pwd) /usr/bin | $(pwd)
+	local $(pwd) | export && 'quoted text'
+	echo x=1 local readonly grep then local $(pwd) test 'quoted text'
+	readonly --verbose grep done /usr/bin
+	sed "$@" "$@" /usr/bin -eu echo && && | --verbose cd then
+		-eu sed done local done 2>/dev/null 2>/dev/null printf
+then readonly sed ${HOME}
+		printf export printf cd 2>/dev/null 'quoted text' printf ${HOME} "$1" && done
+		${HOME} x=1 "$@" export
+	2>/dev/null 'quoted text' -eu && --verbose then --verbose
+		done "$1" export export readonly printf 2>/dev/null --verbose $(pwd)
+"$1" done 2>/dev/null "$@" local then test && -eu "$@" sed -eu
+	${HOME} done x=1 "$@" "$1" ${HOME} --verbose /usr/bin
+		sed test then | printf done grep -eu grep test readonly 'quoted text' test &&
+	cd --verbose | && then test ${HOME}
+'quoted text' "$1" done && then local $(pwd) /usr/bin $(pwd)
+	export done 2>/dev/null -eu -eu | ${HOME} awk /usr/bin
+	x=1 ${HOME} test readonly | readonly
+grep x=1 test cd "$1" 2>/dev/null --verbose --verbose x=1 /usr/bin readonly
+	x=1 printf readonly $(pwd) $(pwd) echo then awk done $(pwd)
+	-eu done 2>/dev/null echo /usr/bin $(pwd) /usr/bin /usr/bin -eu awk grep
+		printf $(pwd) | export "$@" local && -eu $(pwd) "$1" done && --verbose
+"$@" ${HOME} $(pwd) "$@" "$1" "$@" | $(pwd) && awk | 'quoted text'
+	'quoted text' ${HOME} cd "$1" sed --verbose
+		printf test 'quoted text'
+	&& $(pwd) sed printf 2>/dev/null $(pwd) grep "$1"
+	done | 2>/dev/null printf cd "$1" 2>/dev/null printf --verbose | cd echo "$1" ${HOME}
+	$(pwd) && echo 'quoted text' echo then 'quoted text'
+	2>/dev/null awk | echo --verbose ${HOME} && 2>/dev/null -eu
+		cd "$@" && local 'quoted text' echo sed -eu 'quoted text' --verbose
+		/usr/bin $(pwd) sed then grep x=1 test /usr/bin | local $(pwd) echo
+"$@" -eu 2>/dev/null awk then 2>/dev/null export 2>/dev/null -eu $(pwd)
+	then | "$@" sed x=1 x=1 -eu cd
+		sed | "$@" then then --verbose ${HOME} done 2>/dev/null readonly
+	sed local local $(pwd) readonly ${HOME} readonly 'quoted text' 2>/dev/null
+sed --verbose 'quoted text' ${HOME} then 2>/dev/null
+	done x=1 cd $(pwd) then grep -eu | "$@" grep && grep -eu "$1" cd "$1"
+	echo 'quoted text' cd $(pwd) awk awk
+'quoted text' --verbose local $(pwd) printf 2>/dev/null
+-eu test printf x=1 done -eu 'quoted text'
+printf local then export done ${HOME} export ${HOME}
+readonly x=1 2>/dev/null /usr/bin echo echo 2>/dev/null awk awk 2>/dev/null awk
+-eu then $(pwd) done awk cd printf
+	printf -eu --verbose $(pwd)
+${HOME} --verbose printf done --verbose export echo
+sed --verbose x=1 sed grep awk sed printf -eu
+		--verbose && && && done 2>/dev/null --verbose
+	| sed --verbose cd local cd readonly cd printf | printf | awk
+	awk grep test 'quoted text' grep /usr/bin then $(pwd) done
+		x=1 -eu then then $(pwd) && local "$1" readonly "$@" then "$1" test
+	grep "$@" echo | $(pwd) grep grep ${HOME} -eu printf 2>/dev/null
+	"$@" x=1 $(pwd) x=1 | && 2>/dev/null
+"$1" 'quoted text' grep x=1 'quoted text' grep local
+		'quoted text' /usr/bin sed local
+cd | "$@" ${HOME} && /usr/bin then "$@"
+		/usr/bin "$1" "$1" local -eu | "$1" ${HOME} sed test ${HOME}
+	$(pwd) export 2>/dev/null /usr/bin | readonly "$1" sed --verbose
+echo local grep | sed readonly
+	export "$1" grep ${HOME} printf then x=1 | sed
+	'quoted text' $(pwd) "$@" grep echo "$1" grep 'quoted text' test then "$1" ${HOME}
+readonly awk $(pwd) "$@" x=1 "$1" then export
+	test printf sed | ${HOME} local "$@" then
+	printf test awk done test echo -eu then $(pwd) done local --verbose
+test /usr/bin readonly echo $(pwd) cd export grep /usr/bin readonly 2>/dev/null
+	| grep export 2>/dev/null "$1"
+	'quoted text' "$@" "$1" awk | printf && /usr/bin awk done "$1"
+grep printf export && | ${HOME} done | cd x=1 &&
+"$@" local /usr/bin printf -eu local "$1" test test cd then
+awk && sed $(pwd) then readonly
+	$(pwd) ${HOME} ${HOME} /usr/bin sed then cd --verbose then /usr/bin | cd printf
+		done done done local 'quoted text' grep "$@" x=1 --verbose
+	printf ${HOME} 2>/dev/null /usr/bin local awk local $(pwd) ${HOME}
+| sed -eu cd grep /usr/bin "$@"
+		grep ${HOME} awk x=1 grep grep ${HOME} export -eu local then readonly
+		"$@" --verbose --verbose "$1" 'quoted text' grep test /usr/bin done $(pwd) --verbose
+"$@" then x=1 ${HOME} awk x=1 x=1 grep awk /usr/bin cd grep grep
+sed readonly sed then 'quoted text'
+		&& cd echo cd cd export awk && "$1" printf awk -eu awk awk sed then
+"$1" x=1 2>/dev/null test test done cd 2>/dev/null ${HOME} readonly -eu test
+		grep sed -eu ${HOME} x=1 /usr/bin ${HOME} echo ${HOME}
+		then "$1" "$@" -eu test 2>/dev/null "$1" && done && "$@" cd test export --verbose
+sed awk 2>/dev/null cd awk cd export 2>/dev/null 'quoted text' x=1
+	${HOME} $(pwd) ${HOME} export -eu then printf "$1" 'quoted text'
+		export echo cd x=1 awk -eu awk $(pwd) echo done "$@"
+	then "$1" readonly x=1 cd /usr/bin echo -eu
+'quoted text' ${HOME} /usr/bin done
+echo -eu $(pwd) ${HOME} export printf then local printf 2>/dev/null
+&& then sed 2>/dev/null test | printf then &&
+${HOME} echo local export
+sed --verbose awk 'quoted text' $(pwd) 'quoted text' && 2>/dev/null
+	'quoted text' 'quoted text' && x=1 $(pwd) x=1 'quoted text' test done
+	x=1 "$@" echo awk -eu 2>/dev/null cd x=1 | /usr/bin 'quoted text'
+sed $(pwd) 'quoted text' "$1" /usr/bin readonly export awk done readonly
+	export /usr/bin local --verbose cd "$@" awk test export grep sed "$1"
+	sed printf test -eu 'quoted text' readonly sed && done && | printf grep $(pwd)
+test local export cd local $(pwd) then readonly $(pwd) "$@" && printf "$@" x=1 $(pwd)
+	"$1" | -eu -eu readonly "$1" local | x=1 cd cd awk && local awk
+	"$@" 'quoted text' then "$@" sed |
+	-eu readonly grep && awk awk && test "$1" "$1" 2>/dev/null ${HOME} export 'quoted text'
+sed | local && grep printf && | --verbose grep grep | --verbose --verbose
+local x=1 /usr/bin grep $(pwd) /usr/bin
+		test cd /usr/bin echo /usr/bin export printf export
+		&& 'quoted text' "$@" then export | $(pwd) x=1 awk printf /usr/bin done printf
+	/usr/bin --verbose 2>/dev/null readonly
+		local echo $(pwd) echo done "$@" readonly x=1 done -eu $(pwd) awk 2>/dev/null
+		-eu local grep $(pwd) "$@" awk -eu test $(pwd) done
+	&& test test $(pwd) "$1"
+		$(pwd) "$1" test && ${HOME}
+awk sed "$@" done | ${HOME} ${HOME} done cd "$@" 'quoted text' ${HOME} "$@"
+	-eu ${HOME} awk test sed 2>/dev/null
+		'quoted text' "$@" | 'quoted text' printf export 2>/dev/null
+	local -eu --verbose sed printf "$1" | --verbose awk
+	$(pwd) grep echo 'quoted text' --verbose sed "$@" 2>/dev/null local grep echo
+	sed export printf done echo "$1" --verbose -eu cd echo readonly "$1"
+	x=1 local export 2>/dev/null echo && printf ${HOME} ${HOME} 'quoted text' done
+		"$@" printf "$1" test "$@" "$1" local $(pwd) printf
+		export -eu printf grep
+--verbose grep local export | $(pwd) export readonly $(pwd) sed ${HOME} test
+readonly x=1 cd awk "$1" export local $(pwd) 'quoted text'
+'quoted text' done done readonly ${HOME} -eu export local export
+		'quoted text' export --verbose awk ${HOME} cd 2>/dev/null readonly x=1 sed
+		test "$1" echo echo --verbose done 2>/dev/null 2>/dev/null --verbose 'quoted text'
+	2>/dev/null 'quoted text' $(pwd) x=1 printf
+	awk 'quoted text' -eu --verbose | grep 2>/dev/null
+	--verbose then | && sed $(pwd) 2>/dev/null
+/usr/bin echo 'quoted text' 'quoted text' | sed cd local
+	export x=1 ${HOME} -eu /usr/bin /usr/bin grep && export then "$@"
+		test 'quoted text' then -eu test cd
+echo awk && 2>/dev/null echo 'quoted text' sed $(pwd) ${HOME} printf x=1
+		$(pwd) 2>/dev/null "$1" /usr/bin
+echo readonly printf done ${HOME} "$@" /usr/bin
+${HOME} /usr/bin $(pwd) done 'quoted text' /usr/bin
+		/usr/bin printf readonly /usr/bin done export | echo then sed awk done local
+	printf -eu printf test awk 'quoted text' && cd "$@" awk cd
+$(pwd) "$@" 'quoted text' --verbose sed -eu test
+	test done $(pwd) export | awk "$@" /usr/bin sed awk then printf "$@"
+/usr/bin local | ${HOME} ${HOME} | test then sed ${HOME} && --verbose | echo
+export awk -eu cd /usr/bin test 'quoted text' ${HOME} -eu cd /usr/bin
+	| sed /usr/bin readonly 'quoted text' 2>/dev/null export done done sed local test
+		/usr/bin awk $(pwd) 'quoted text' cd sed 2>/dev/null readonly readonly "$1"
+then --verbose ${HOME} local 2>/dev/null readonly
+	"$@" export "$@" 2>/dev/null cd $(pwd) && &&
+		export test "$@" cd test "$1"
+		-eu --verbose "$@" ${HOME} echo readonly local -eu
+'quoted text' cd && /usr/bin /usr/bin "$1" | 'quoted text'
+done x=1 x=1 ${HOME} local "$1" "$1" echo echo "$1" test test && echo -eu awk
+		then "$@" "$@" "$1" export x=1 /usr/bin local
+done grep "$@" export test awk grep printf local
+done printf export -eu "$1" then
+"$1" ${HOME} -eu local 'quoted text' echo done 'quoted text' sed done done |
+-eu export x=1 local done test 'quoted text' test readonly | --verbose test
+		-eu export -eu local $(pwd)
+		${HOME} grep --verbose readonly done 2>/dev/null local printf local done grep
+done /usr/bin grep test | awk 2>/dev/null readonly
+${HOME} x=1 x=1 done test ${HOME} "$@" export "$1"
+	then sed 'quoted text' done 2>/dev/null
+	export x=1 && readonly 2>/dev/null ${HOME} $(pwd) 2>/dev/null "$1" grep done 2>/dev/null
+	'quoted text' readonly | export then --verbose readonly "$@"
+	readonly local export cd
+export /usr/bin /usr/bin $(pwd) awk readonly test
+done echo x=1 export awk | $(pwd) then | --verbose | --verbose 2>/dev/null done
+	-eu awk 2>/dev/null $(pwd) sed done printf
+	awk "$@" /usr/bin done grep printf --verbose printf
+cd x=1 ${HOME} 2>/dev/null sed local x=1 2>/dev/null
+then 'quoted text' /usr/bin --verbose ${HOME}
+	/usr/bin && local then test --verbose
+	--verbose sed 'quoted text' /usr/bin grep test readonly
+	"$1" grep export awk grep cd awk sed x=1 cd
+'quoted text' && ${HOME}
+		'quoted text' "$@" echo x=1 test
+		'quoted text' test printf && && ${HOME} readonly "$@" 'quoted text' "$@"
+		--verbose cd | 2>/dev/null $(pwd) grep test "$1" test
+		-eu /usr/bin x=1 2>/dev/null cd then export test export printf 2>/dev/null
+-eu printf cd "$@" "$1" sed cd cd && ${HOME}
+		sed ${HOME} 'quoted text' /usr/bin | sed && x=1 /usr/bin test -eu
+		local && cd $(pwd) ${HOME} ${HOME} /usr/bin done done | /usr/bin
+		"$@" done -eu x=1 readonly done grep awk 'quoted text' 2>/dev/null test /usr/bin
+		$(pwd) done sed local x=1 local &&
+		$(pwd) done export echo
+		$(pwd) printf 2>/dev/null 'quoted text'
+	--verbose done /usr/bin --verbose ${HOME} printf "$1" done /usr/bin grep
+&& 2>/dev/null && | local local then /usr/bin
+	readonly | local readonly && && done -eu | 2>/dev/null
+	local x=1 | ${HOME} --verbose --verbose /usr/bin
+		local local awk grep printf echo x=1 local
+	awk $(pwd) && ${HOME} sed export grep
+		printf then --verbose 'quoted text' export | 2>/dev/null x=1 x=1 $(pwd)
+		local 'quoted text' awk -eu 'quoted text' test cd 'quoted text' printf grep /usr/bin
+&& echo 'quoted text' export
+$(pwd) cd ${HOME} | -eu 'quoted text' ${HOME} && ${HOME}
+x=1 --verbose "$1" echo sed grep local export --verbose printf && | done
+	local x=1 echo sed /usr/bin 'quoted text' echo 2>/dev/null
+	--verbose printf ${HOME} local --verbose local /usr/bin
+	-eu --verbose readonly local export "$1"
+	$(pwd) ${HOME} done 2>/dev/null awk export 'quoted text' echo && /usr/bin printf
+		awk test $(pwd) 2>/dev/null local local "$1" -eu && $(pwd)
+"$@" done 2>/dev/null ${HOME}
+export "$1" readonly readonly | test -eu sed grep
+	test then /usr/bin "$@"
+	-eu "$@" export 2>/dev/null && "$1" x=1 -eu $(pwd) test $(pwd) local && done
+| then -eu --verbose 'quoted text' --verbose
+	'quoted text' sed --verbose local 2>/dev/null
+readonly "$1" | 2>/dev/null --verbose echo "$1"
+	'quoted text' "$1" echo $(pwd) $(pwd) echo
+	then printf -eu x=1 2>/dev/null echo -eu -eu test "$@" readonly
+		readonly printf 2>/dev/null grep && 'quoted text'
+	x=1 done 'quoted text' grep echo /usr/bin ${HOME}
+		test x=1 grep -eu printf local done local --verbose | export grep printf
+		-eu /usr/bin $(pwd) | x=1
+	sed -eu sed export echo then ${HOME} "$1" 2>/dev/null awk awk -eu sed
+		$(pwd) printf $(pwd) test done grep echo readonly 2>/dev/null printf test |
+x=1 sed awk --verbose echo && | /usr/bin 'quoted text'
+${HOME} 2>/dev/null then ${HOME} awk sed readonly -eu
+	local sed "$1" readonly 'quoted text' readonly ${HOME} x=1 x=1
+	readonly printf readonly export sed $(pwd) $(pwd)
+2>/dev/null awk x=1 grep local 2>/dev/null | --verbose cd then $(pwd) $(pwd) $(pwd)
+		/usr/bin cd --verbose x=1 "$@" "$1" ${HOME} export
+awk echo "$1" export 2>/dev/null
+done "$1" "$@" echo 'quoted text'
+	| --verbose done 'quoted text' done /usr/bin x=1
+printf /usr/bin x=1 grep $(pwd) $(pwd) 2>/dev/null | ${HOME} $(pwd) grep $(pwd)
+$(pwd) echo "$1" && grep
+		&& export /usr/bin awk awk | cd test
+printf local printf echo echo printf
+		2>/dev/null /usr/bin --verbose awk export local readonly x=1 test --verbose
+${HOME} ${HOME} local export then printf 'quoted text' /usr/bin
+		echo awk | /usr/bin done | done "$1"
+	--verbose local -eu done
+	echo echo sed test --verbose ${HOME} cd echo --verbose printf
+sed $(pwd) | export sed awk local readonly test
+-eu ${HOME} /usr/bin x=1 cd x=1 $(pwd)
+		2>/dev/null | then cd echo
+	readonly 2>/dev/null sed local
+	grep echo /usr/bin export $(pwd) readonly 2>/dev/null $(pwd) --verbose
+		local test grep "$@" grep && printf
+	"$1" local cd 'quoted text' | then test --verbose printf
+	-eu then test local "$1"
+"$1" "$1" && | grep cd printf "$1" $(pwd) local cd export ${HOME} -eu 2>/dev/null
+echo local export | echo sed readonly -eu grep then
+test x=1 --verbose cd -eu awk awk /usr/bin -eu ${HOME} 2>/dev/null
+	-eu --verbose /usr/bin cd 2>/dev/null /usr/bin
+		then "$1" cd readonly done printf x=1 sed --verbose
+	--verbose sed | | local "$1" test -eu /usr/bin
+		2>/dev/null then echo awk readonly
+		$(pwd) "$@" $(pwd) export
+	readonly | export awk awk -eu 'quoted text' sed grep ${HOME} sed sed test
+		2>/dev/null grep export cd readonly
+	/usr/bin 2>/dev/null ${HOME} -eu --verbose done --verbose
+"$@" echo --verbose readonly
+export export sed -eu readonly
+	echo | export "$1" then --verbose
+grep 2>/dev/null local 2>/dev/null cd local 'quoted text'
+	'quoted text' awk x=1 awk local -eu
+local local sed ${HOME} printf x=1 then grep
+		/usr/bin test done cd
+	done | awk | --verbose "$1" | x=1 --verbose readonly echo --verbose
+	then && sed printf "$1" | printf
+"$1" grep ${HOME} then echo printf local x=1 done then && --verbose
+	$(pwd) cd readonly && done -eu
+		then done grep then test $(pwd) then
+local readonly | $(pwd)
+		printf x=1 $(pwd) sed 2>/dev/null "$@" |
+	printf "$@" printf ${HOME} readonly /usr/bin $(pwd) x=1 sed --verbose awk
+awk 2>/dev/null -eu 2>/dev/null && 'quoted text'
+grep /usr/bin 'quoted text' readonly sed -eu test cd
+	x=1 'quoted text' readonly -eu ${HOME} printf done "$1" local x=1 awk echo printf
+printf sed grep local awk then test done --verbose then printf echo ${HOME} readonly
+	'quoted text' /usr/bin test -eu /usr/bin echo readonly "$@" x=1 "$@"
+test /usr/bin /usr/bin && $(pwd) local readonly "$1" printf && export
+	sed then printf "$@" $(pwd) local x=1 --verbose done echo readonly
+	echo then done printf $(pwd)
+		local "$1" local | 'quoted text'
+${HOME} awk $(pwd) x=1 $(pwd)
+	readonly printf then "$1" echo done awk x=1 'quoted text'
+		x=1 grep cd test /usr/bin echo export readonly "$1" 'quoted text' -eu /usr/bin
+x=1 readonly $(pwd) ${HOME} cd readonly --verbose
+	--verbose ${HOME} sed "$@" cd -eu printf cd
+	awk && "$1" $(pwd) $(pwd) /usr/bin cd local
+	then export $(pwd) sed cd --verbose grep --verbose --verbose export
+		test "$@" printf echo
+	$(pwd) export readonly && awk test &&
+grep echo "$@" /usr/bin sed test -eu printf sed && export local test --verbose
+--verbose echo $(pwd) grep $(pwd) "$@" 2>/dev/null
+		sed readonly /usr/bin && local echo
+| /usr/bin then grep | local test
+		$(pwd) ${HOME} echo | 2>/dev/null ${HOME}
+-eu /usr/bin ${HOME} --verbose done then readonly 'quoted text' then x=1 test
+		grep awk awk x=1 awk $(pwd)
+	| grep grep then readonly "$1" /usr/bin --verbose |
+		${HOME} then echo grep ${HOME} 2>/dev/null echo x=1 --verbose "$1" "$@" export 'quoted text'
+		readonly grep test grep x=1 && printf done | then ${HOME} $(pwd) echo grep local
+		x=1 test done ${HOME} grep awk /usr/bin | cd 'quoted text' $(pwd) -eu "$@" x=1 x=1
+printf | -eu done $(pwd) local export
+| 'quoted text' grep printf
+	2>/dev/null -eu 2>/dev/null "$1" && readonly x=1 printf grep export && grep
+		awk ${HOME} echo x=1 'quoted text' sed
+	&& -eu readonly --verbose awk sed grep
+${HOME} "$1" done 2>/dev/null echo | printf printf export printf $(pwd) test
+2>/dev/null "$1" local
+		| $(pwd) 2>/dev/null -eu x=1
+	printf echo cd done ${HOME} readonly
+echo "$@" ${HOME} grep grep 2>/dev/null $(pwd) 'quoted text' printf printf readonly
+		--verbose -eu cd cd /usr/bin && --verbose 'quoted text' -eu "$@" sed export 2>/dev/null
+	2>/dev/null 2>/dev/null test test local
+		| echo cd --verbose -eu cd echo --verbose 'quoted text' readonly "$1" 'quoted text'
+		2>/dev/null "$1" $(pwd) 'quoted text' export "$1" 'quoted text'
+		sed 'quoted text' -eu cd "$@" sed echo /usr/bin printf x=1 "$@"
+	cd awk 'quoted text' echo x=1 --verbose test && | grep local x=1 -eu
+	cd -eu readonly 2>/dev/null "$@" $(pwd) echo sed x=1
+	then done printf "$@" | x=1 x=1 ${HOME} echo /usr/bin local
+		sed /usr/bin cd /usr/bin test /usr/bin local awk 'quoted text' awk
+		sed | | "$1" echo awk grep
+		cd ${HOME} $(pwd) done grep --verbose --verbose
+		done cd && done $(pwd) && awk -eu
+		cd export then local local "$1" sed
+export local printf export grep cd 2>/dev/null grep
+		sed export --verbose 2>/dev/null printf
+	done ${HOME} 'quoted text' 2>/dev/null "$@" grep echo ${HOME}
+	test awk --verbose "$@" "$1"
+readonly --verbose awk -eu
+grep readonly cd 2>/dev/null "$1" grep then cd 2>/dev/null ${HOME}
+	"$1" x=1 echo /usr/bin printf awk local $(pwd) cd test "$@"
+$(pwd) done "$@" x=1 export awk export sed x=1 grep
+		-eu test && && local then ${HOME} && 'quoted text' 2>/dev/null
+| ${HOME} | $(pwd) printf -eu
+	2>/dev/null sed --verbose echo sed printf done cd
+		'quoted text' /usr/bin local | -eu export && --verbose && test done printf local
+2>/dev/null "$1" 'quoted text' $(pwd) 'quoted text'
+		readonly grep awk && ${HOME} echo -eu done cd | /usr/bin
+done 2>/dev/null $(pwd) test test readonly 'quoted text'
+	printf ${HOME} grep readonly x=1 done printf then awk grep $(pwd) export
+	local /usr/bin x=1 ${HOME} -eu --verbose "$@" sed "$@" export printf
+		2>/dev/null 'quoted text' 'quoted text' test
+&& 'quoted text' readonly "$1" | ${HOME} done | ${HOME} "$@" readonly -eu
+	echo "$1" export readonly x=1 grep --verbose done $(pwd) "$1" /usr/bin done x=1
+		x=1 "$@" $(pwd) local local
+	grep && -eu then sed 2>/dev/null 'quoted text' printf echo awk test then
+	cd x=1 local $(pwd) $(pwd) awk sed "$@" --verbose $(pwd)
+		printf test -eu | awk cd -eu cd /usr/bin /usr/bin
+	/usr/bin x=1 "$1" awk then "$@"
+	"$1" x=1 /usr/bin readonly ${HOME} sed x=1 then /usr/bin "$1" sed echo cd
+	&& readonly --verbose awk test 2>/dev/null 2>/dev/null -eu
+		$(pwd) -eu grep "$1" test -eu x=1
+| done local export && echo | grep "$1" local
+		grep ${HOME} --verbose echo "$@" export
+		--verbose 'quoted text' echo 'quoted text'
+	echo readonly x=1 | local "$1" && sed then echo then cd x=1 -eu --verbose -eu
+		grep then $(pwd) 'quoted text' sed /usr/bin
+		| -eu && export $(pwd) printf -eu export
+readonly done readonly export $(pwd) x=1 test export done
+| -eu -eu 2>/dev/null | local 2>/dev/null $(pwd)
+x=1 'quoted text' echo | $(pwd) done
+local done local "$@" 2>/dev/null
+	${HOME} 2>/dev/null $(pwd) 'quoted text'
+export 'quoted text' test | && 2>/dev/null x=1 then grep awk
+	echo test readonly grep sed
+	test local $(pwd) echo readonly x=1
+		2>/dev/null "$1" "$@" 2>/dev/null | /usr/bin -eu test test awk
+&& export "$@" /usr/bin awk test cd export export -eu "$@" printf
+test done $(pwd) local ${HOME} 'quoted text'
+	/usr/bin && local echo /usr/bin grep echo
+		readonly cd ${HOME} export grep done echo "$1" "$@" && done | export $(pwd)
+		2>/dev/null "$1" export
+--verbose "$@" grep sed done
+	2>/dev/null x=1 x=1 /usr/bin grep test $(pwd) done test printf
+		printf awk && grep --verbose && sed
+done --verbose && ${HOME} awk printf
+		echo /usr/bin ${HOME} test "$@" then readonly 2>/dev/null
+		-eu cd "$@" done export /usr/bin local export /usr/bin export
+		--verbose ${HOME} printf test printf ${HOME} local done cd local
+		local then export -eu grep ${HOME} /usr/bin 2>/dev/null
+/usr/bin "$1" readonly cd /usr/bin
+echo "$@" grep awk 'quoted text' echo
+	export x=1 export && ${HOME} printf sed "$@" done export awk
+		echo test ${HOME} | echo local then sed test done grep test ${HOME}
+sed --verbose readonly ${HOME} test done
+	2>/dev/null -eu 2>/dev/null
+		done readonly grep -eu export && echo then $(pwd) -eu export $(pwd)
+		| $(pwd) "$@" printf test awk "$1"
+		awk "$1" export cd ${HOME} -eu cd -eu printf && cd cd
+		grep 'quoted text' ${HOME} readonly readonly export && done --verbose
+-eu awk /usr/bin export --verbose
+		| awk cd printf grep 'quoted text' local sed
+readonly readonly readonly readonly
+		${HOME} "$1" grep grep export "$1" 2>/dev/null -eu test printf
+export "$@" export --verbose && 2>/dev/null "$@" echo --verbose
+grep printf awk grep grep --verbose cd ${HOME} "$@"
+		$(pwd) export && export 'quoted text' done echo local x=1 local local --verbose
+-eu local -eu done readonly 'quoted text' "$1"
+export | "$@" local test local /usr/bin readonly
+	-eu awk cd readonly echo $(pwd) | x=1 test
+2>/dev/null export --verbose x=1 --verbose /usr/bin echo |
+		test /usr/bin local | done done /usr/bin
+x=1 echo --verbose cd test local cd --verbose echo 2>/dev/null then
+grep then grep x=1 test awk cd grep 'quoted text'
+		test grep | x=1 echo --verbose $(pwd)
+then local "$@" "$@" && x=1 'quoted text' done /usr/bin echo readonly grep
+	export test 2>/dev/null && local test && sed 'quoted text'
+local echo printf sed ${HOME}
+		echo x=1 "$@" then 'quoted text' ${HOME} test ${HOME} "$@" readonly readonly
+printf done --verbose "$1" done
+	&& "$1" | "$1" awk 'quoted text' 2>/dev/null "$1" local
+		"$1" 2>/dev/null /usr/bin 'quoted text'
+	"$@" grep grep awk readonly 2>/dev/null
+	grep --verbose echo 2>/dev/null local -eu ${HOME} cd printf cd export test local
+"$@" test local local sed test $(pwd) 'quoted text'
+x=1 -eu export local --verbose x=1 sed done "$1" x=1 2>/dev/null echo | echo
+		done echo then $(pwd) -eu /usr/bin export echo
+	| export 2>/dev/null done test test readonly | sed awk /usr/bin echo /usr/bin
+	done test export echo
+	echo && 'quoted text' --verbose 2>/dev/null sed test done then cd $(pwd)
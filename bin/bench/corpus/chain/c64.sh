@@ -0,0 +1,2001 @@
+	then /usr/bin 'quoted text' export sed
+&& /usr/bin sed test done then "$1" then 2>/dev/null echo grep 'quoted text'
+/usr/bin awk cd && grep "$@" readonly
+	done echo cd sed cd x=1 local printf sed ${HOME} | awk local
+	echo -eu -eu 2>/dev/null "$1" printf done done && /usr/bin && /usr/bin printf
+		"$@" cd 'quoted text' local
+		echo export export sed done 'quoted text'
+		then x=1 && ${HOME} ${HOME} echo then ${HOME} done grep then printf 'quoted text'
+"$1" grep grep sed | done "$@" awk -eu done readonly | sed
+	awk readonly awk echo "$1" | ${HOME} --verbose "$@"
+then /usr/bin /usr/bin "$1" readonly test grep echo -eu printf done ${HOME} local
+$(pwd) | sed test awk ${HOME} ${HOME} ${HOME} && awk 2>/dev/null -eu local 2>/dev/null
+	test "$@" --verbose | readonly -eu "$1" readonly "$1" done printf
+		&& grep export ${HOME} readonly cd export "$1" $(pwd) "$1" test
+printf --verbose --verbose printf printf && x=1
+		/usr/bin -eu sed 'quoted text'
+export local done 2>/dev/null echo echo sed /usr/bin --verbose
+local cd sed 'quoted text' readonly
+		--verbose done | | 'quoted text' 'quoted text'
+	2>/dev/null "$@" awk grep 2>/dev/null /usr/bin
+test cd "$1" --verbose
+echo "$1" grep -eu awk -eu test 2>/dev/null
+	x=1 awk /usr/bin "$@" $(pwd)
+	awk /usr/bin "$1" local cd $(pwd) -eu "$1" then /usr/bin $(pwd) grep
+		| 'quoted text' grep
+awk done awk then -eu test sed awk readonly | printf done $(pwd) then --verbose
+		'quoted text' sed 'quoted text'
+		${HOME} then printf cd readonly
+	awk && done $(pwd) awk grep "$@" "$1" printf -eu $(pwd) --verbose
+sed --verbose x=1 awk sed grep done | sed printf grep
+	test awk awk -eu sed -eu ${HOME} echo "$@" 2>/dev/null local $(pwd)
+	2>/dev/null readonly && "$1" local then "$1" "$1" --verbose
+"$@" 'quoted text' awk awk | -eu x=1
+awk grep cd "$@" cd --verbose
+'quoted text' local ${HOME}
+		local readonly $(pwd) export cd sed "$1" "$@" /usr/bin
+printf "$1" | 2>/dev/null cd "$@" ${HOME}
+		grep export $(pwd) --verbose "$@" export -eu done | | awk
+		'quoted text' grep --verbose cd "$@"
+${HOME} test done -eu x=1 2>/dev/null "$@" 2>/dev/null
+	x=1 | -eu echo 2>/dev/null sed --verbose grep
+	| export echo local $(pwd) echo 'quoted text'
+		grep $(pwd) /usr/bin test cd then ${HOME} awk
+	${HOME} | readonly x=1 2>/dev/null grep x=1 | test && ${HOME}
+		"$@" readonly -eu echo && test 2>/dev/null export done "$1" grep $(pwd) printf
+	cd "$@" awk 'quoted text' | test 2>/dev/null printf 'quoted text'
+	awk "$1" then cd local awk -eu printf -eu "$1" awk --verbose /usr/bin
+		&& cd "$@" cd "$@" cd readonly sed readonly --verbose
+	awk x=1 ${HOME} && export done "$1" sed "$@"
+		"$1" $(pwd) "$@" | 'quoted text'
+'quoted text' --verbose "$1" echo printf printf then 2>/dev/null export | echo
+	| sed 'quoted text' -eu printf printf readonly readonly 'quoted text' done cd grep
+		readonly "$@" local && awk echo ${HOME} x=1 'quoted text' then grep readonly
+	cd sed export test /usr/bin grep echo then ${HOME} sed 'quoted text' $(pwd) --verbose
+		| local done done 2>/dev/null /usr/bin 'quoted text' 'quoted text'
+	done "$@" printf $(pwd) | local then "$1" then awk printf
+	$(pwd) "$@" ${HOME} test 2>/dev/null ${HOME} x=1 x=1
+then x=1 test "$@" awk local x=1 --verbose "$1" ${HOME}
+2>/dev/null && printf done 'quoted text' 2>/dev/null 2>/dev/null printf
+	done done --verbose "$@" 'quoted text' "$1" test "$1" /usr/bin "$1" 2>/dev/null
+		then grep cd then "$1" export done
+		--verbose -eu echo "$1"
+	local awk then awk 'quoted text' "$@" grep
+		readonly ${HOME} 2>/dev/null grep sed echo done export echo
+	done --verbose cd && done --verbose $(pwd) done test grep
+	| x=1 cd awk 'quoted text'
+&& export printf "$1" --verbose grep cd ${HOME}
+--verbose --verbose test
+$(pwd) readonly | sed $(pwd) then readonly --verbose ${HOME}
+"$1" test local awk printf awk cd && ${HOME} 2>/dev/null test export | local 2>/dev/null
+$(pwd) x=1 awk cd readonly -eu printf "$@" x=1 && sed $(pwd) /usr/bin 2>/dev/null
+	echo printf "$@" -eu export sed printf 'quoted text'
+	${HOME} /usr/bin ${HOME} && 2>/dev/null
+	done $(pwd) 'quoted text' ${HOME}
+test /usr/bin printf 'quoted text' --verbose export readonly x=1 awk grep
+	local cd sed cd --verbose printf &&
+printf /usr/bin readonly awk awk ${HOME} 2>/dev/null local awk then
+-eu x=1 "$@" cd "$1" cd export && then cd awk x=1 then local test readonly
+readonly test sed done 'quoted text'
+test 'quoted text' echo sed readonly
+		grep --verbose $(pwd)
+		/usr/bin done -eu done ${HOME} test 2>/dev/null --verbose awk --verbose grep
+	test && printf | x=1 done then
+awk --verbose printf | 2>/dev/null then "$@" --verbose awk | awk 2>/dev/null
+		awk echo then "$@" then /usr/bin x=1 x=1 ${HOME} echo readonly
+2>/dev/null readonly grep
+	cd done 'quoted text' echo readonly "$@" cd --verbose
+then "$1" && then cd sed then echo
+		/usr/bin export 2>/dev/null $(pwd) test | local 2>/dev/null | $(pwd)
+local ${HOME} local done grep export local 'quoted text' cd test grep
+awk echo -eu readonly printf export sed "$@" && export
+		--verbose test | echo printf printf -eu awk x=1 'quoted text'
+$(pwd) -eu 2>/dev/null $(pwd) cd "$@" then
+		x=1 --verbose /usr/bin | local local /usr/bin && grep $(pwd) -eu cd 2>/dev/null
+		"$@" sed awk 2>/dev/null ${HOME} awk -eu ${HOME} printf cd then --verbose 'quoted text'
+	echo ${HOME} -eu export
+	${HOME} x=1 | x=1 echo local
+--verbose --verbose /usr/bin "$1" readonly /usr/bin
+local printf x=1 sed "$@"
+		local grep 2>/dev/null "$1" cd ${HOME} awk export
+2>/dev/null test cd awk
+		then done -eu then -eu export | /usr/bin awk awk echo export grep
+'quoted text' sed local
+		cd --verbose echo awk $(pwd) awk "$1" "$1" --verbose
+	$(pwd) "$@" /usr/bin /usr/bin --verbose awk done 'quoted text' export "$1" /usr/bin
+		"$@" sed -eu "$@" "$@" 'quoted text' 'quoted text'
+echo export ${HOME} cd $(pwd) printf 2>/dev/null 'quoted text'
+"$@" done 'quoted text' /usr/bin readonly local grep
+	then ${HOME} test "$1" cd "$1" | sed "$1" 'quoted text'
+		local "$@" readonly 2>/dev/null
+| -eu echo done 2>/dev/null awk grep awk local x=1 echo awk /usr/bin "$@" local
+		| done sed $(pwd) grep 'quoted text' echo grep | "$@" /usr/bin $(pwd) --verbose
+	local x=1 && $(pwd) test readonly printf awk
+	x=1 "$@" local 'quoted text' "$1" && "$1" ${HOME} --verbose "$@" $(pwd)
+	local "$@" done readonly "$1" export
+		"$@" /usr/bin x=1 && /usr/bin cd awk test awk ${HOME}
+	${HOME} readonly readonly | --verbose 2>/dev/null export local
+	/usr/bin cd 'quoted text' /usr/bin done 'quoted text'
+		awk grep cd done x=1 -eu echo -eu "$@" && /usr/bin
+		x=1 "$1" 'quoted text' $(pwd) /usr/bin readonly
+	then | /usr/bin readonly -eu 'quoted text' sed
+	cd | export ${HOME} then
+2>/dev/null then "$1" printf readonly --verbose ${HOME} x=1 ${HOME} -eu readonly
+	"$@" echo awk | sed $(pwd) | echo x=1 awk --verbose
+	awk "$@" printf export --verbose -eu test "$1" ${HOME}
+		cd /usr/bin test sed printf sed 'quoted text' printf sed done "$@" awk then "$@"
+	echo export "$1" cd grep test done export -eu | grep export local ${HOME} sed echo
+	export 2>/dev/null local then grep done -eu -eu local x=1 grep
+	echo export "$@" | grep && --verbose
+	awk then test done echo
+then $(pwd) awk export $(pwd) ${HOME} "$@"
+		echo 'quoted text' cd local cd x=1 grep grep done "$1"
+		$(pwd) "$1" sed sed | grep then readonly "$@" "$@" readonly
+| printf x=1 'quoted text' printf && "$@" test grep
+${HOME} test 2>/dev/null awk readonly then 2>/dev/null
+		&& then sed grep && && /usr/bin
+		readonly ${HOME} grep export
+&& --verbose /usr/bin printf "$@"
+	-eu awk x=1 echo --verbose printf test 'quoted text'
+		sed sed "$1" --verbose printf grep && 'quoted text'
+	2>/dev/null -eu done "$1" $(pwd)
+		'quoted text' -eu done
+x=1 awk "$1" -eu "$@" -eu --verbose $(pwd) local printf then
+		awk 'quoted text' -eu test -eu | export "$1" echo "$1" ${HOME}
+awk && x=1 -eu --verbose $(pwd) sed $(pwd) echo | then awk test | printf 2>/dev/null
+--verbose | /usr/bin "$1" x=1 echo $(pwd)
+		-eu 'quoted text' 2>/dev/null test awk sed "$@"
+		| local && local --verbose then --verbose
+		x=1 awk "$1" "$@" export --verbose done 'quoted text'
+/usr/bin export $(pwd) readonly awk local 'quoted text'
+export sed export -eu
+		done -eu 'quoted text' ${HOME} local --verbose
+echo -eu then && test export printf sed
+2>/dev/null printf $(pwd)
+	| then "$@" | 'quoted text' $(pwd) | $(pwd) -eu echo
+	'quoted text' then | local local grep printf then |
+$(pwd) echo 'quoted text' -eu
+	"$1" /usr/bin ${HOME} && x=1 test echo then cd export test 2>/dev/null 'quoted text'
+	${HOME} grep echo awk 'quoted text' "$1" "$@"
+-eu && 2>/dev/null $(pwd) x=1
+grep local then /usr/bin -eu 2>/dev/null awk
+		$(pwd) 2>/dev/null readonly then printf
+	then cd awk 2>/dev/null done grep
+	${HOME} sed done $(pwd) sed export printf ${HOME} grep echo grep ${HOME}
+$(pwd) 2>/dev/null grep echo "$@"
+		/usr/bin 'quoted text' x=1
+	/usr/bin ${HOME} --verbose "$@" x=1 ${HOME} ${HOME} ${HOME}
+		readonly && "$@" printf -eu --verbose cd grep /usr/bin
+	&& -eu $(pwd) cd 2>/dev/null -eu
+		printf 'quoted text' 'quoted text' $(pwd) 'quoted text' test $(pwd) sed "$@" |
+	readonly && "$1" "$@" -eu then
+		echo readonly done done local printf ${HOME} | awk /usr/bin grep
+	--verbose "$1" && sed "$1" "$1"
+		printf $(pwd) export grep /usr/bin printf && printf
+local 'quoted text' then grep echo printf cd export
+		$(pwd) "$@" echo --verbose | sed --verbose awk local -eu x=1 cd
+	cd echo 'quoted text' sed local export then
+readonly local /usr/bin "$1" "$@" x=1 sed "$@" echo awk --verbose
+then cd printf awk x=1 grep && echo | -eu
+	grep awk | local done "$@" cd readonly grep test $(pwd) export local $(pwd)
+	$(pwd) | "$1" /usr/bin sed echo $(pwd) local cd done 'quoted text' echo $(pwd)
+	echo test | done cd echo echo local 2>/dev/null local
+--verbose awk $(pwd) $(pwd) && export readonly awk grep 2>/dev/null
+	-eu --verbose export grep "$1" sed $(pwd)
+		cd sed && 'quoted text' local local 'quoted text' printf /usr/bin /usr/bin
+		&& && done sed 'quoted text' --verbose 'quoted text' awk "$1" test
+local && printf | export readonly /usr/bin
+readonly 2>/dev/null readonly /usr/bin | &&
+		"$@" export /usr/bin readonly --verbose | test ${HOME} x=1 /usr/bin test /usr/bin
+		local readonly 'quoted text' ${HOME} $(pwd) export awk cd /usr/bin
+	sed readonly cd --verbose 2>/dev/null echo
+x=1 2>/dev/null sed --verbose grep readonly "$@" $(pwd) ${HOME}
+		x=1 /usr/bin awk "$@" then --verbose
+	test printf | awk /usr/bin | export test $(pwd) cd done 'quoted text' "$@" sed
+grep "$@" readonly --verbose && echo "$1" --verbose $(pwd) "$@" --verbose
+/usr/bin "$1" then ${HOME} -eu awk
+${HOME} grep ${HOME} readonly
+	| /usr/bin x=1 $(pwd) "$1" grep local 'quoted text' && $(pwd)
+$(pwd) local --verbose "$1" awk then --verbose
+		/usr/bin x=1 /usr/bin 'quoted text' readonly echo ${HOME} "$@" /usr/bin printf
+		awk done done /usr/bin local done printf awk echo cd cd local readonly
+cd readonly 2>/dev/null | sed -eu test /usr/bin export
+	export "$@" local then sed 2>/dev/null cd done printf
+-eu 'quoted text' ${HOME} -eu sed ${HOME} "$1"
+	2>/dev/null $(pwd) printf then x=1 printf grep done local "$1" then "$1"
+	grep sed --verbose x=1 ${HOME} sed grep "$1" ${HOME} done cd 'quoted text'
+		done x=1 grep echo awk printf then awk x=1 "$@" "$1" "$@"
+	"$@" | -eu && /usr/bin x=1 then grep echo /usr/bin /usr/bin -eu | echo export
+	local printf test done grep then ${HOME} /usr/bin $(pwd) test 2>/dev/null
+x=1 local --verbose $(pwd) done test test done 2>/dev/null -eu
+export awk grep | test
+	echo local done 'quoted text' then readonly
+then ${HOME} $(pwd) grep awk /usr/bin "$1" x=1
+awk -eu awk readonly local export
+cd printf x=1 | "$1" | printf x=1 --verbose readonly export
+	sed --verbose readonly awk export export x=1 awk -eu ${HOME} /usr/bin
+	local $(pwd) awk 'quoted text'
+	grep done sed x=1 readonly local done /usr/bin
+	--verbose awk printf printf
+	$(pwd) done -eu export -eu
+&& then 'quoted text' && ${HOME} /usr/bin grep $(pwd) cd ${HOME} $(pwd) then
+		grep sed cd 'quoted text' 'quoted text' grep
+then awk 'quoted text' && |
+	export export /usr/bin done readonly | done
+		'quoted text' sed | 'quoted text' local export
+		$(pwd) then "$@" test "$@"
+		| then $(pwd) sed -eu 'quoted text'
+	-eu ${HOME} local 'quoted text' done
+		echo x=1 2>/dev/null export "$@" test --verbose | 2>/dev/null "$1" cd && cd printf
+	awk /usr/bin printf awk sed "$1" export ${HOME} export $(pwd) --verbose echo /usr/bin
+awk $(pwd) 2>/dev/null done then export -eu "$@"
+	2>/dev/null export done awk test printf | sed local "$@" /usr/bin
+		sed 2>/dev/null done --verbose /usr/bin /usr/bin readonly -eu local
+		local printf | 'quoted text' /usr/bin test
+"$1" printf $(pwd) | grep x=1 then sed test grep export awk x=1
+cd /usr/bin echo echo | "$@" --verbose /usr/bin
+	&& echo "$@" sed test 'quoted text' $(pwd)
+then sed ${HOME} sed grep x=1 grep export --verbose sed readonly awk test
+		then 'quoted text' export
+-eu x=1 grep $(pwd) -eu ${HOME} grep
+	test 'quoted text' then readonly $(pwd) "$1" done 2>/dev/null
+-eu awk 'quoted text' cd
+		echo awk /usr/bin 2>/dev/null ${HOME} sed done readonly 'quoted text'
+		2>/dev/null /usr/bin readonly local awk
+	$(pwd) -eu echo readonly "$@" sed "$1" then grep && && $(pwd) 2>/dev/null
+	awk "$@" "$1" cd | printf printf $(pwd)
+	--verbose export export grep sed
+		"$@" 2>/dev/null done | grep readonly
+		/usr/bin sed -eu export $(pwd) cd x=1 test ${HOME} awk -eu && awk awk printf
+		printf local 2>/dev/null $(pwd) ${HOME} cd grep ${HOME} 'quoted text'
+	echo readonly $(pwd) && printf printf awk then done
+	echo test done $(pwd) export x=1 "$1" grep 2>/dev/null readonly 2>/dev/null
+	local | x=1 x=1 readonly ${HOME} cd "$1" "$1" "$@"
+	--verbose echo printf cd /usr/bin then sed readonly ${HOME} cd 'quoted text'
+-eu local echo grep "$1" /usr/bin
+		"$1" export cd grep "$@" export grep | ${HOME} 2>/dev/null -eu grep
+	cd -eu x=1 printf | /usr/bin
+test export sed grep done readonly | printf /usr/bin "$1" grep grep $(pwd)
+		export --verbose "$1" x=1 "$1" then "$1" | -eu printf
+		"$@" local 'quoted text' x=1 $(pwd) "$1"
+		$(pwd) readonly 'quoted text' export -eu awk export ${HOME} "$1"
+/usr/bin "$1" export awk echo done sed done
+${HOME} $(pwd) 2>/dev/null done test "$@" "$1" -eu done printf local
+	done /usr/bin | then export --verbose
+echo x=1 echo && "$@" "$1" printf
+		cd test x=1 --verbose then local
+		-eu readonly local --verbose x=1 test done -eu && printf cd
+		'quoted text' /usr/bin ${HOME} cd "$@" "$1" | cd
+then awk printf echo export done 'quoted text' printf x=1 sed $(pwd) sed awk ${HOME}
+		| --verbose x=1 printf 2>/dev/null x=1 cd --verbose sed
+	then cd "$@" -eu grep "$1" export sed then "$@" && --verbose
+		&& ${HOME} echo sed && then ${HOME} test 2>/dev/null
+	| $(pwd) /usr/bin cd 2>/dev/null printf /usr/bin awk "$@" 2>/dev/null ${HOME}
+	| 2>/dev/null "$@" 'quoted text' local 'quoted text' then x=1 echo awk local
+		"$1" "$@" --verbose test echo /usr/bin && x=1 $(pwd) local ${HOME} done x=1 grep
+awk echo cd -eu /usr/bin awk done /usr/bin ${HOME} --verbose
+	'quoted text' $(pwd) cd --verbose x=1 cd "$@" /usr/bin sed 2>/dev/null 2>/dev/null
+		--verbose echo grep grep "$@"
+		readonly --verbose readonly cd then --verbose 2>/dev/null awk
+		echo export local echo done echo readonly awk "$@" export printf "$@" "$1" /usr/bin
+		test 2>/dev/null $(pwd) then awk echo printf local cd "$1" sed echo then
+readonly export -eu printf | local then | then "$@"
+		&& $(pwd) $(pwd) test "$1" export cd "$1" x=1 done cd x=1 test
+	done done "$@" /usr/bin awk --verbose local
+--verbose grep local 2>/dev/null -eu echo cd /usr/bin $(pwd) && x=1 done readonly
+grep 'quoted text' /usr/bin /usr/bin 2>/dev/null export
+2>/dev/null && sed --verbose 2>/dev/null
+	awk then $(pwd) 'quoted text' 'quoted text'
+	awk -eu 'quoted text' $(pwd)
+	local --verbose echo readonly 2>/dev/null && sed test
+	cd echo then then export "$@" done cd readonly && $(pwd) sed -eu "$1" export
+	local grep sed | done $(pwd) 'quoted text' sed x=1 done
+'quoted text' "$1" local cd cd x=1 /usr/bin
+		--verbose printf test printf "$1" readonly
+	awk && export cd test ${HOME}
+--verbose local 2>/dev/null "$1" ${HOME} /usr/bin $(pwd) --verbose /usr/bin | |
+		--verbose readonly 'quoted text'
+	grep done sed printf --verbose awk awk &&
+grep awk /usr/bin printf -eu printf grep ${HOME} 2>/dev/null | --verbose readonly
+&& $(pwd) test grep printf echo ${HOME} 2>/dev/null ${HOME}
+"$@" echo local done | x=1 "$1" local --verbose && done grep && /usr/bin ${HOME}
+readonly --verbose readonly awk done grep printf $(pwd) | -eu 'quoted text'
+	x=1 grep 2>/dev/null | $(pwd) then
+		local | test "$1" /usr/bin sed sed --verbose
+	2>/dev/null x=1 cd "$@" --verbose 'quoted text' local readonly ${HOME} sed then
+	printf local | -eu x=1 -eu echo -eu "$@" local
+	2>/dev/null 2>/dev/null grep "$@" | && && "$@" --verbose "$1" sed grep
+	awk readonly echo printf grep cd $(pwd) local printf grep | "$1" --verbose printf
+	x=1 done readonly /usr/bin
+cd grep -eu awk printf awk export /usr/bin readonly $(pwd) -eu && /usr/bin 'quoted text'
+		done awk x=1 echo printf local grep sed sed | x=1 awk readonly
+	-eu done "$1" 'quoted text' awk then 2>/dev/null
+		${HOME} /usr/bin "$@" /usr/bin && 2>/dev/null $(pwd) $(pwd) export
+		awk grep "$1" "$@" then sed "$1" local echo 2>/dev/null then echo -eu "$@"
+	| 'quoted text' "$@" done 2>/dev/null printf "$@" grep
+		$(pwd) "$@" | echo echo printf cd 'quoted text' /usr/bin x=1 grep echo --verbose
+'quoted text' --verbose "$1" local | 2>/dev/null printf
+	'quoted text' "$@" | grep &&
+x=1 --verbose 'quoted text' && test readonly x=1 x=1 && readonly
+export | 2>/dev/null 2>/dev/null $(pwd) 2>/dev/null grep grep local
+	x=1 | "$1" local && readonly "$@" --verbose --verbose "$@" test --verbose
+	-eu local ${HOME} /usr/bin
+	2>/dev/null grep ${HOME} sed grep "$1" local echo
+"$1" -eu -eu printf then | readonly "$1" readonly -eu
+export export awk 2>/dev/null cd /usr/bin done echo &&
+/usr/bin 2>/dev/null echo readonly 'quoted text' "$1" 2>/dev/null
+'quoted text' sed /usr/bin then
+		printf printf readonly printf | ${HOME} printf "$1" local
+	${HOME} /usr/bin 2>/dev/null -eu "$1" "$@" printf awk "$1" export
+"$1" grep sed printf | ${HOME} | x=1 local echo printf grep grep -eu x=1 &&
+grep export export done $(pwd) sed ${HOME} 'quoted text'
+	echo x=1 printf 'quoted text' export local export /usr/bin
+	done $(pwd) export echo $(pwd) printf printf $(pwd)
+		$(pwd) cd "$1" 'quoted text' x=1 export $(pwd) readonly echo | 'quoted text'
+		sed cd awk sed echo sed -eu printf export test export --verbose
+	done -eu echo -eu echo
+	awk | | /usr/bin done cd cd then "$1" "$1" | cd "$@" then &&
+		export sed --verbose echo echo 'quoted text' local awk --verbose grep
+		/usr/bin cd | "$@" local
+local cd local cd printf /usr/bin ${HOME} grep export grep x=1 "$@"
+	/usr/bin -eu -eu --verbose | && awk $(pwd) 'quoted text'
+/usr/bin awk test sed grep sed local x=1 local $(pwd) sed x=1 | awk -eu 'quoted text'
+		test --verbose echo $(pwd) sed grep | echo 2>/dev/null
+		grep export | readonly --verbose | done /usr/bin grep --verbose
+	'quoted text' test readonly "$1" | --verbose | "$1"
+${HOME} test local -eu 'quoted text' local $(pwd)
+${HOME} cd printf export | && echo echo
+awk "$@" | awk awk cd 2>/dev/null
+	then /usr/bin "$1" test && /usr/bin echo
+	awk | test 2>/dev/null
+	"$@" "$@" ${HOME} test ${HOME} sed "$@" --verbose
+sed export /usr/bin ${HOME} "$@"
+	then done printf sed grep grep "$@" 2>/dev/null 'quoted text' | cd x=1
+/usr/bin then "$1" $(pwd) export
+"$1" 'quoted text' "$@" /usr/bin "$1" printf local 'quoted text'
+	awk grep -eu test sed sed $(pwd) $(pwd) then
+${HOME} $(pwd) local export echo 2>/dev/null 2>/dev/null cd && --verbose
+	done readonly sed | "$1" echo test | then -eu
+	cd "$1" | && && local export --verbose && cd printf readonly
+| | cd -eu | export --verbose sed grep local "$1" then -eu export
+		printf test readonly && && && printf
+	"$1" x=1 sed local grep awk sed "$1" "$@" && done local $(pwd)
+	export echo sed awk | /usr/bin 'quoted text' export grep export
+		sed then "$1" echo sed sed /usr/bin /usr/bin test done awk local |
+		local ${HOME} x=1 echo "$@" sed $(pwd) cd printf -eu /usr/bin
+printf x=1 "$1" cd readonly cd ${HOME} "$1" sed $(pwd)
+	"$1" x=1 "$@" "$@" && 2>/dev/null ${HOME} x=1
+printf export echo then "$@" ${HOME} cd -eu
+readonly && export 'quoted text' && then -eu printf "$1" --verbose printf &&
+echo cd -eu && local export awk export readonly
+x=1 printf then --verbose grep ${HOME} | done done sed
+$(pwd) awk && printf awk 2>/dev/null x=1 then readonly then x=1 export
+		printf "$1" $(pwd) test 'quoted text'
+awk test readonly --verbose done $(pwd) 2>/dev/null readonly cd local "$@"
+		readonly "$1" | 'quoted text' export ${HOME} | 'quoted text'
+		printf ${HOME} echo then
+		"$1" printf grep $(pwd) readonly x=1 done
+test 'quoted text' /usr/bin ${HOME} x=1 done "$@" $(pwd) "$1" printf
+		export then --verbose 'quoted text' awk test
+awk && cd /usr/bin grep --verbose
+		grep echo readonly x=1 export grep -eu printf | -eu | cd "$@"
+	echo "$@" | && -eu readonly test printf "$@" readonly echo export sed awk --verbose
+	/usr/bin ${HOME} cd 2>/dev/null readonly
+		test x=1 2>/dev/null done awk printf readonly $(pwd) test readonly
+		"$@" | echo awk test awk /usr/bin local readonly "$1"
+&& && cd "$1" readonly cd done x=1 "$@" cd local
+	/usr/bin printf test 'quoted text' --verbose then printf
+	printf cd cd readonly $(pwd)
+	$(pwd) sed "$@" readonly test cd -eu printf
+2>/dev/null sed done then 2>/dev/null $(pwd) "$@" "$1"
+		| then --verbose test 2>/dev/null sed --verbose 2>/dev/null
+		/usr/bin cd sed grep then | && ${HOME} test readonly |
+	x=1 sed 'quoted text' | cd local -eu readonly
+then "$@" test 2>/dev/null 'quoted text' "$1" --verbose
+sed readonly "$1" printf -eu 'quoted text' then export test "$1" cd ${HOME} "$@"
+	2>/dev/null -eu done &&
+	"$@" && "$1" --verbose -eu "$1" $(pwd) &&
+	then awk && test grep "$@" grep x=1 printf 2>/dev/null
+	awk "$1" local test | local $(pwd) && | done export sed --verbose
+	$(pwd) grep echo printf ${HOME} echo then $(pwd) echo $(pwd)
+"$@" "$1" /usr/bin done && cd 'quoted text' sed && printf
+		x=1 grep sed printf --verbose printf 'quoted text' /usr/bin
+echo export sed echo -eu printf printf sed -eu printf
+&& && "$1" done && done "$1" export
+	${HOME} "$1" x=1 /usr/bin sed "$@" grep test
+2>/dev/null --verbose export
+	test --verbose x=1 | 2>/dev/null
+	2>/dev/null cd printf echo local --verbose export ${HOME} --verbose
+/usr/bin 2>/dev/null awk then
+	grep | 'quoted text' ${HOME} awk "$@" /usr/bin 2>/dev/null done ${HOME}
+		"$@" readonly && awk test /usr/bin cd
+printf test | ${HOME} "$@" printf done /usr/bin ${HOME} cd export ${HOME}
+		"$@" -eu then test "$@" export export "$1" sed test echo export $(pwd) test awk
+/usr/bin 2>/dev/null export "$@" readonly grep --verbose cd sed grep
+		awk export "$1" echo "$1" 'quoted text' printf 'quoted text'
+	then -eu | /usr/bin && && |
+echo sed 2>/dev/null cd printf && awk printf test $(pwd)
+		then sed then test then echo then
+/usr/bin /usr/bin "$@" "$@" x=1
+		sed && done x=1 then export awk 2>/dev/null readonly done done awk
+		local grep "$1" 'quoted text' x=1 then printf cd echo
+		echo then /usr/bin && then ${HOME} local printf printf /usr/bin ${HOME} echo /usr/bin
+cd "$1" echo "$@" grep 'quoted text' printf
+		export sed then then x=1 export
+	grep -eu | then cd sed printf x=1 "$1" 'quoted text' x=1 | "$@" && "$1"
+	printf "$1" export printf && ${HOME} -eu awk && && done $(pwd) /usr/bin test
+		'quoted text' 'quoted text'
+then 'quoted text' done echo test then -eu "$1" readonly export
+	sed grep awk /usr/bin export "$@" local 2>/dev/null -eu
+		"$1" cd "$1" && && local x=1
+	| $(pwd) test export export done test "$@" local done echo
+	"$@" cd /usr/bin "$1" cd awk | test | local sed x=1 cd /usr/bin cd echo 'quoted text'
+		printf awk then ${HOME} done --verbose "$@" 2>/dev/null
+	readonly done $(pwd) "$1" 2>/dev/null awk local printf test sed
+echo then ${HOME} echo && sed --verbose grep --verbose printf "$@" 'quoted text'
+	"$1" 2>/dev/null --verbose --verbose then |
+		2>/dev/null ${HOME} awk echo "$@"
+		$(pwd) done test /usr/bin readonly
+	echo test cd sed /usr/bin "$1" /usr/bin && --verbose test --verbose
+		"$@" sed readonly printf $(pwd) $(pwd) local
+sed grep $(pwd) echo cd 'quoted text' x=1 ${HOME} grep
+		local done local /usr/bin x=1 awk done local --verbose /usr/bin && --verbose
+		test cd /usr/bin 2>/dev/null /usr/bin grep test
+	'quoted text' cd then printf $(pwd)
+	printf export --verbose printf then -eu "$1" done then done /usr/bin | local
+	sed cd local sed --verbose awk awk | echo 2>/dev/null
+${HOME} 'quoted text' "$@" 2>/dev/null printf
+${HOME} export cd local done
+printf -eu local "$1" export 2>/dev/null awk $(pwd) awk echo /usr/bin 2>/dev/null
+	/usr/bin --verbose $(pwd) local printf x=1 grep printf "$1"
+test x=1 -eu echo 2>/dev/null
+x=1 x=1 sed "$1" cd && x=1 local
+-eu -eu cd then readonly test x=1 sed 'quoted text'
+"$@" local -eu sed /usr/bin export local "$1"
+		readonly 2>/dev/null "$@" 2>/dev/null grep then grep test
+	| --verbose local $(pwd) "$1" printf test sed "$1"
+		x=1 local done 'quoted text' x=1 "$1" --verbose && x=1 "$1"
+	done echo 2>/dev/null 'quoted text' "$1" ${HOME} export echo done
+x=1 grep /usr/bin then readonly sed then readonly x=1 "$1" ${HOME} export ${HOME}
+	--verbose 2>/dev/null -eu "$1" 'quoted text'
+&& $(pwd) done printf ${HOME}
+readonly sed /usr/bin "$@" $(pwd) /usr/bin "$@" 2>/dev/null local
+cd grep -eu cd printf test readonly then printf $(pwd) grep grep printf
+		--verbose printf export printf "$1" sed
+		| /usr/bin readonly "$1"
+local sed local grep
+		'quoted text' "$1" then "$1" x=1 sed --verbose -eu local export | ${HOME} x=1
+		test grep printf done | echo "$1"
+		done "$@" $(pwd) 2>/dev/null then readonly awk -eu /usr/bin | "$1" $(pwd) then
+/usr/bin 'quoted text' local ${HOME} $(pwd) -eu && | cd $(pwd)
+	x=1 $(pwd) -eu $(pwd) printf local readonly 'quoted text' cd "$1" --verbose
+2>/dev/null x=1 cd | readonly
+		echo grep grep --verbose awk "$@" local done && x=1 /usr/bin
+awk echo grep -eu awk
+		$(pwd) --verbose | cd readonly ${HOME} printf export | readonly sed
+export cd awk && 2>/dev/null ${HOME} sed
+then grep | export "$@" sed export awk && export
+		then then /usr/bin export printf then export $(pwd)
+grep -eu | export awk sed test echo readonly -eu test
+export done -eu grep export ${HOME} $(pwd) readonly $(pwd) --verbose /usr/bin
+echo "$1" printf | awk /usr/bin then ${HOME}
+cd /usr/bin local $(pwd) local done /usr/bin awk 2>/dev/null $(pwd) /usr/bin "$@"
+	grep readonly awk --verbose 'quoted text' export local export x=1
+		x=1 -eu awk cd cd local then $(pwd)
+then 2>/dev/null | local export sed /usr/bin then echo export
+		"$1" | local 2>/dev/null $(pwd) 'quoted text'
+printf x=1 -eu --verbose 'quoted text'
+	'quoted text' "$@" done "$1" "$1" && "$@" echo /usr/bin "$1" echo
+local | readonly test 2>/dev/null
+$(pwd) sed /usr/bin awk
+	$(pwd) /usr/bin then readonly readonly printf /usr/bin /usr/bin
+$(pwd) -eu 2>/dev/null -eu -eu /usr/bin --verbose awk -eu sed sed
+'quoted text' local cd $(pwd) then $(pwd) -eu "$@"
+		| x=1 readonly 'quoted text' $(pwd) readonly |
+	local --verbose "$@" done "$1" then
+		awk export local local 'quoted text' /usr/bin
+		"$@" cd cd 2>/dev/null printf 'quoted text' "$@"
+"$1" export test /usr/bin
+		then "$1" grep "$@" && local
+	readonly | && local export awk 'quoted text' 'quoted text'
+		--verbose /usr/bin "$1" 2>/dev/null test
+		export --verbose test "$1" cd done x=1 /usr/bin export 2>/dev/null
+		export sed | then echo export awk awk grep
+-eu ${HOME} -eu "$1" x=1 test 2>/dev/null grep grep && --verbose $(pwd) -eu
+$(pwd) -eu && "$@" cd /usr/bin 'quoted text' 2>/dev/null
+		sed | && awk done sed echo sed awk local grep printf
+		awk 2>/dev/null then local
+echo ${HOME} readonly echo awk test ${HOME} /usr/bin
+x=1 sed ${HOME} 'quoted text' awk /usr/bin
+		--verbose grep echo export "$@" 2>/dev/null --verbose printf local
+	&& test sed then test echo done /usr/bin | 'quoted text' $(pwd) ${HOME} 'quoted text'
+		/usr/bin test -eu done then
+		${HOME} "$@" printf "$@" -eu | sed printf grep | x=1 export
+	'quoted text' done 'quoted text' ${HOME} ${HOME}
+		readonly | grep ${HOME} echo test then echo /usr/bin readonly x=1 ${HOME} grep
+		then export --verbose --verbose -eu $(pwd) then then sed
+	x=1 "$@" printf local awk "$@" sed local $(pwd) local awk
+	'quoted text' $(pwd) 'quoted text'
+then awk x=1 && -eu export echo local && ${HOME} -eu -eu done 2>/dev/null
+	then $(pwd) cd test local readonly
+--verbose /usr/bin ${HOME} 2>/dev/null readonly
+	/usr/bin printf $(pwd) readonly done $(pwd) 2>/dev/null readonly export /usr/bin
+	--verbose export && "$@"
+		&& awk local cd /usr/bin x=1 "$@" readonly "$@" sed
+	done "$@" test done grep awk
+		then 'quoted text' export x=1 export 'quoted text' "$@"
+	-eu export cd && --verbose
+		&& ${HOME} --verbose | printf /usr/bin x=1
+	2>/dev/null local awk /usr/bin export
+	then local x=1 then -eu
+	grep 'quoted text' export 'quoted text'
+		export cd /usr/bin printf
+		-eu test && | 2>/dev/null --verbose grep cd printf export --verbose /usr/bin $(pwd)
+	local printf readonly | -eu x=1 echo sed --verbose awk echo then
+readonly done 2>/dev/null grep && export "$@" local "$@" ${HOME} printf 'quoted text'
+		test -eu "$@" | awk && echo then
+/usr/bin test 'quoted text' test | /usr/bin readonly awk readonly
+		test $(pwd) readonly $(pwd) cd printf
+		awk local --verbose x=1 test printf export |
+	sed grep test | test /usr/bin | -eu
+		/usr/bin /usr/bin 2>/dev/null awk local printf ${HOME} awk --verbose ${HOME}
+echo echo awk printf cd x=1 /usr/bin --verbose x=1
+	${HOME} --verbose && x=1 $(pwd) grep awk readonly
+"$1" echo ${HOME} /usr/bin
+readonly $(pwd) x=1 local --verbose done | done --verbose "$@" x=1
+		"$1" grep echo grep local echo printf cd
+readonly cd sed printf grep 2>/dev/null x=1 readonly $(pwd)
+		readonly x=1 && grep | then /usr/bin then
+		done sed sed test grep "$1" printf
+		test grep --verbose sed then local done readonly --verbose $(pwd) readonly
+		/usr/bin "$@" local awk x=1 local 'quoted text' /usr/bin $(pwd) 2>/dev/null
+		readonly 2>/dev/null echo -eu $(pwd) --verbose
+	x=1 && ${HOME} x=1 then 'quoted text' /usr/bin cd readonly --verbose
+	-eu sed local test /usr/bin awk readonly 'quoted text' -eu ${HOME} local
+	printf then 'quoted text' done echo
+		local -eu ${HOME} x=1 readonly
+	/usr/bin 'quoted text' echo "$1" "$1" export -eu -eu test $(pwd) -eu $(pwd) readonly
+	then done 'quoted text' test
+export $(pwd) --verbose awk "$@" done echo
+--verbose test export sed /usr/bin test sed
+x=1 x=1 --verbose "$@" --verbose | -eu -eu export awk then local grep readonly
+$(pwd) cd /usr/bin -eu export "$@" echo /usr/bin /usr/bin x=1
+-eu --verbose local awk ${HOME} ${HOME} $(pwd) x=1
+	2>/dev/null "$@" 'quoted text' printf awk cd readonly 'quoted text'
+		test done 'quoted text' 'quoted text' ${HOME} x=1 "$1" grep "$@" 2>/dev/null
+	printf cd awk x=1 /usr/bin ${HOME} export readonly sed grep awk
+	$(pwd) cd | --verbose && "$1" | then cd cd "$1" |
+export export x=1 test sed
+"$1" printf cd then readonly "$1" then then cd
+		export | local done 'quoted text' 'quoted text'
+	| readonly x=1 $(pwd) readonly x=1 sed 2>/dev/null export /usr/bin awk -eu printf
+		export -eu local printf /usr/bin done && done
+		'quoted text' | && local 2>/dev/null /usr/bin /usr/bin test &&
+	2>/dev/null echo local sed "$1" 'quoted text'
+	"$@" x=1 cd printf local cd readonly "$@"
+	readonly awk "$1" -eu cd && sed test then ${HOME} readonly
+	echo "$@" --verbose test grep readonly
+	then --verbose 2>/dev/null cd --verbose export && done "$@" ${HOME}
+	| test cd "$@" && awk grep "$1" test x=1 sed -eu sed
+	${HOME} test "$@" done awk export sed then | $(pwd) 'quoted text' -eu readonly
+2>/dev/null "$@" export 'quoted text' local awk | done && echo cd done
+	$(pwd) then $(pwd) "$@" | grep && | sed export local sed
+		&& export $(pwd) done grep echo export "$@" ${HOME} sed awk "$@" printf 2>/dev/null
+		&& export then x=1 then 'quoted text' cd --verbose printf
+		"$@" && "$1" local grep
+		2>/dev/null $(pwd) 2>/dev/null
+-eu && && $(pwd) local --verbose readonly readonly cd
+		"$@" && /usr/bin | 'quoted text' /usr/bin "$@"
+	/usr/bin test cd x=1 --verbose then --verbose "$@" 'quoted text' 'quoted text'
+	2>/dev/null --verbose | test ${HOME} ${HOME} cd printf 2>/dev/null 2>/dev/null
+done /usr/bin local "$1" export --verbose && awk done
+	readonly $(pwd) readonly 2>/dev/null "$@" local echo /usr/bin done
+		local grep grep export x=1 && done $(pwd) awk 2>/dev/null 2>/dev/null
+		awk grep -eu ${HOME} cd --verbose echo cd 'quoted text' | then test | sed echo
+local 2>/dev/null /usr/bin readonly printf
+		--verbose x=1 export --verbose local done 'quoted text'
+	echo sed cd /usr/bin local $(pwd) "$@"
+2>/dev/null cd test "$@" grep echo printf readonly sed /usr/bin | "$@" awk 'quoted text'
+	x=1 done test printf export readonly --verbose "$@" sed printf test local
+	2>/dev/null test "$@" "$@" x=1 readonly
+		awk && | grep "$@" ${HOME} 2>/dev/null "$@" | sed -eu && | 2>/dev/null
+&& 'quoted text' grep
+	cd done --verbose 2>/dev/null done "$@" --verbose readonly
+done test printf -eu 2>/dev/null --verbose
+done 'quoted text' x=1 ${HOME} readonly then 2>/dev/null
+		&& && --verbose readonly 2>/dev/null
+grep cd readonly "$@" local grep 'quoted text' 'quoted text'
+		"$1" 'quoted text' cd grep
+		printf sed "$1" echo /usr/bin echo "$@" --verbose && /usr/bin done "$@"
+	-eu -eu then --verbose export readonly test --verbose awk /usr/bin
+	readonly readonly export && grep
+--verbose then | echo && done test cd && cd && grep "$1" 2>/dev/null
+		| export | ${HOME} ${HOME} "$1" ${HOME} 'quoted text'
+		printf export 'quoted text' sed sed 2>/dev/null grep grep -eu sed
+	grep export && then $(pwd) sed /usr/bin grep
+		x=1 printf test echo /usr/bin $(pwd)
+--verbose x=1 x=1 sed readonly then /usr/bin
+	awk | x=1 && x=1 --verbose 2>/dev/null -eu /usr/bin "$1"
+		done $(pwd) test "$1" -eu export /usr/bin 2>/dev/null
+then cd awk awk export "$1"
+		readonly awk | "$@" sed then cd done then test "$@" ${HOME} awk --verbose
+"$1" then x=1 'quoted text' ${HOME} --verbose
+		-eu echo && then local --verbose local "$1" | echo test awk readonly | sed echo
+	awk "$1" -eu 2>/dev/null cd -eu sed cd then 'quoted text' readonly
+		x=1 $(pwd) export printf done
+		| cd printf grep && 2>/dev/null then 2>/dev/null ${HOME}
+${HOME} "$@" grep printf "$@" local 'quoted text' /usr/bin sed then
+		grep "$1" local -eu ${HOME}
+		"$@" "$@" test printf then export
+	grep 'quoted text' --verbose sed "$@" x=1 echo "$@"
+	test awk grep "$1" $(pwd) "$1" local ${HOME} test /usr/bin echo
+then --verbose export local done export then export local export x=1
+readonly cd 'quoted text'
+		grep 2>/dev/null && "$@" sed printf readonly readonly done printf ${HOME} local
+		| grep ${HOME} test && test awk done then done
+		echo then x=1 then /usr/bin && "$1" export
+		${HOME} --verbose 2>/dev/null then 2>/dev/null /usr/bin sed local
+		&& "$1" -eu "$1" ${HOME} readonly local ${HOME} x=1 local sed sed 2>/dev/null
+"$@" --verbose ${HOME} 'quoted text' --verbose 2>/dev/null 'quoted text'
+then cd export 2>/dev/null export awk ${HOME} 'quoted text'
+		--verbose export | x=1 --verbose done echo printf grep ${HOME}
+"$@" then x=1 -eu ${HOME} echo awk echo 'quoted text'
+		export 'quoted text' "$@" 2>/dev/null "$1" --verbose test x=1
+2>/dev/null -eu readonly --verbose 'quoted text' && ${HOME} readonly "$1" done
+		echo x=1 2>/dev/null "$1" "$@" "$1" awk then cd sed
+local readonly cd test | --verbose export
+	readonly $(pwd) ${HOME}
+/usr/bin test 'quoted text' x=1
+		$(pwd) test --verbose $(pwd) test | ${HOME} done printf then "$@" $(pwd)
+	test then "$@" 2>/dev/null 'quoted text' | export printf awk
+	${HOME} -eu $(pwd) x=1 "$@" readonly export 2>/dev/null done sed export
+printf export grep readonly
+	"$@" && ${HOME} sed x=1 grep --verbose $(pwd) printf export
+'quoted text' test test "$1" awk sed local grep
+		test done awk | cd "$@" awk readonly awk /usr/bin "$1" sed "$@" then --verbose
+done ${HOME} done local x=1 cd "$@" readonly
+${HOME} grep "$@" --verbose "$1" cd 'quoted text'
+	-eu echo x=1 'quoted text' && /usr/bin -eu export
+		cd x=1 test --verbose $(pwd) export "$@" done sed 2>/dev/null
+		local "$@" /usr/bin done grep ${HOME} then 'quoted text' "$@" -eu
+		2>/dev/null test "$@" 2>/dev/null done test done "$@" $(pwd) export $(pwd)
+	--verbose grep /usr/bin done -eu export
+	done export printf &&
+2>/dev/null /usr/bin echo && $(pwd) then -eu echo readonly /usr/bin
+$(pwd) x=1 /usr/bin -eu -eu test
+	$(pwd) grep local 2>/dev/null readonly x=1 ${HOME} sed $(pwd) done echo
+	cd awk ${HOME} /usr/bin &&
+		printf -eu echo -eu printf /usr/bin done cd
+$(pwd) grep cd | grep | $(pwd) && cd local && then 'quoted text' echo 2>/dev/null
+grep test "$1" awk local printf -eu
+printf "$1" $(pwd) sed "$1" readonly
+	test "$1" sed | "$1" -eu echo && ${HOME} sed awk && done 2>/dev/null sed
+	local | "$@" && sed --verbose "$1" local
+		2>/dev/null $(pwd) then $(pwd) local cd -eu
+--verbose cd sed --verbose sed ${HOME} done done then local && 'quoted text' printf
+	"$@" printf sed done $(pwd) -eu | then ${HOME} then ${HOME} readonly $(pwd)
+		-eu awk 2>/dev/null then export $(pwd) sed | /usr/bin ${HOME} test echo "$1" export
+printf && --verbose &&
+		awk cd test -eu x=1 printf printf
+		"$1" && local then 2>/dev/null echo export then sed then | export ${HOME} echo
+	${HOME} && echo readonly && /usr/bin cd --verbose 2>/dev/null
+		readonly awk grep "$@" -eu && x=1 export | ${HOME} cd grep 2>/dev/null x=1 "$1"
+	'quoted text' cd echo printf test cd x=1 local then "$1" 2>/dev/null
+2>/dev/null export then 'quoted text' --verbose
+		${HOME} printf then 'quoted text' cd then printf
+/usr/bin 2>/dev/null /usr/bin readonly && local
+		echo 'quoted text' x=1 -eu then readonly ${HOME} echo 2>/dev/null
+		sed /usr/bin | && test ${HOME} test 2>/dev/null | sed "$1"
+	-eu export "$@" grep 'quoted text' ${HOME} | local
+grep echo 'quoted text' grep printf awk echo sed ${HOME} awk export "$1"
+	grep export ${HOME} test awk echo sed local done
+		then done awk "$1" 2>/dev/null grep "$1" --verbose
+$(pwd) sed 'quoted text' $(pwd) export 2>/dev/null
+cd "$1" sed $(pwd) ${HOME} test | ${HOME}
+		local ${HOME} && | x=1 /usr/bin /usr/bin then sed test -eu then 2>/dev/null
+		readonly awk | readonly /usr/bin export echo awk cd test 'quoted text'
+		cd x=1 'quoted text' local /usr/bin --verbose ${HOME}
+		echo ${HOME} printf "$1" "$1" then $(pwd) --verbose
+		export printf 2>/dev/null $(pwd)
+		grep grep grep $(pwd) /usr/bin sed export
+		&& "$1" $(pwd) --verbose x=1 --verbose x=1 done --verbose sed local sed
+	cd x=1 "$@" && awk then test $(pwd) 2>/dev/null
+local && --verbose | && done printf then 2>/dev/null
+		&& "$@" done test echo --verbose awk done "$1" printf /usr/bin
+/usr/bin | && printf cd printf cd
+		$(pwd) 2>/dev/null 2>/dev/null -eu awk "$@" local echo awk -eu awk && 'quoted text'
+	x=1 awk $(pwd) then --verbose done --verbose printf awk
+test ${HOME} local /usr/bin 2>/dev/null
+		$(pwd) --verbose sed /usr/bin --verbose "$1"
+	$(pwd) local done "$@" ${HOME} awk cd readonly awk
+grep x=1 'quoted text' && $(pwd) then 'quoted text'
+	'quoted text' "$1" grep sed echo "$1" "$@" && x=1 'quoted text' test then 2>/dev/null
+	test "$1" 'quoted text' printf "$1" ${HOME}
+"$1" test "$@" $(pwd) printf | 2>/dev/null cd "$@" test
+		grep /usr/bin done sed readonly x=1 ${HOME} x=1 'quoted text' /usr/bin
+	done done readonly -eu readonly export grep
+"$@" test printf echo | cd /usr/bin x=1
+${HOME} 2>/dev/null readonly "$@" | readonly 'quoted text' cd | -eu
+	-eu local then echo --verbose then test done grep cd local x=1
+printf -eu cd echo && awk export 'quoted text' "$1" && -eu
+	"$1" x=1 grep done ${HOME} echo awk "$1" awk
+"$@" 2>/dev/null cd printf sed 2>/dev/null /usr/bin
+awk grep then export done 'quoted text' -eu
+	"$@" $(pwd) readonly 'quoted text'
+		local sed | | 2>/dev/null cd x=1 2>/dev/null 'quoted text' local local
+		grep echo readonly "$@" "$@" then 2>/dev/null
+		2>/dev/null echo "$1" "$@" 'quoted text' -eu x=1 done sed /usr/bin
+		readonly done test done test cd "$1"
+	awk /usr/bin 'quoted text' local 'quoted text'
+cd "$@" "$@" echo then test
+		local grep sed grep "$1" done
+		sed && ${HOME} "$@" cd | export /usr/bin
+	grep 'quoted text' awk --verbose
+${HOME} "$@" sed done echo export readonly "$@" -eu | echo
+x=1 x=1 readonly readonly -eu --verbose "$1" 2>/dev/null | x=1 x=1
+"$1" then echo "$@" local done done echo 'quoted text' printf
+	then "$1" | awk cd echo --verbose $(pwd) | | then 'quoted text' ${HOME} printf
+		then readonly cd echo --verbose $(pwd) done $(pwd) "$@"
+		cd && | x=1 $(pwd) | x=1 ${HOME} export -eu test
+2>/dev/null --verbose local cd x=1 test export readonly test 2>/dev/null
+		readonly /usr/bin then
+--verbose "$1" grep x=1 | then test x=1 sed
+	--verbose /usr/bin -eu "$@" cd echo && awk
+export printf done 2>/dev/null cd 2>/dev/null
+x=1 printf ${HOME} echo 'quoted text'
+	grep 2>/dev/null /usr/bin done grep --verbose
+	export echo local x=1 local x=1 printf "$@" ${HOME} then export x=1
+		$(pwd) grep /usr/bin 'quoted text'
+		2>/dev/null x=1 export "$@" 'quoted text' -eu && -eu test 'quoted text'
+	'quoted text' && -eu "$1" /usr/bin export
+		cd -eu sed "$1" | grep awk local | -eu grep $(pwd) cd export /usr/bin
+'quoted text' echo export
+	readonly grep /usr/bin readonly awk $(pwd)
+test grep 'quoted text' "$1" grep local grep "$@" /usr/bin grep -eu export -eu $(pwd)
+	2>/dev/null done -eu
+"$@" local /usr/bin --verbose "$1"
+readonly local sed /usr/bin "$@" $(pwd) printf sed x=1 grep
+test test | "$1" | -eu "$1" 'quoted text'
+	then x=1 2>/dev/null ${HOME}
+		export $(pwd) "$@" 2>/dev/null sed "$1"
+sed "$@" awk test test && readonly /usr/bin
+		--verbose then test awk export -eu test 'quoted text' readonly x=1
+		then 2>/dev/null echo --verbose x=1
+	/usr/bin "$1" export local
+	printf x=1 $(pwd) /usr/bin
+		export 'quoted text' 2>/dev/null sed grep awk "$1" test export --verbose done
+/usr/bin /usr/bin grep /usr/bin /usr/bin && local awk "$1"
+cd ${HOME} grep cd -eu printf "$@" 'quoted text'
+	awk 2>/dev/null cd "$1" x=1 --verbose "$@" | grep awk $(pwd) printf cd 2>/dev/null
+cd awk 'quoted text' /usr/bin sed then
+	awk "$1" | 2>/dev/null then |
+	grep then awk -eu awk then then x=1 --verbose then 2>/dev/null 2>/dev/null
+&& awk then export "$@" 2>/dev/null ${HOME}
+	readonly --verbose "$1" 2>/dev/null x=1 'quoted text' 2>/dev/null
+		readonly readonly 2>/dev/null export --verbose test cd export
+	"$@" local then -eu echo sed awk
+		grep cd 'quoted text' $(pwd) x=1 --verbose readonly --verbose export
+readonly "$1" local | printf export 2>/dev/null $(pwd)
+		printf awk "$@" then 'quoted text'
+/usr/bin ${HOME} 'quoted text' 2>/dev/null
+	grep test then 'quoted text' -eu 'quoted text' | awk &&
+	2>/dev/null 2>/dev/null cd cd 2>/dev/null then "$1" printf ${HOME}
+2>/dev/null grep --verbose | x=1 test ${HOME} -eu
+--verbose 'quoted text' -eu export awk 'quoted text' echo awk printf x=1 sed
+x=1 2>/dev/null export | ${HOME} && --verbose 2>/dev/null readonly
+	done -eu test test 2>/dev/null export local awk grep local 'quoted text'
+	echo "$1" 2>/dev/null export --verbose
+		printf awk done $(pwd) && && cd "$@"
+		&& 'quoted text' test
+	sed && then /usr/bin && grep readonly ${HOME}
+test export then x=1 ${HOME} -eu echo done readonly
+		--verbose test done "$1" done -eu "$@" 2>/dev/null /usr/bin local
+		2>/dev/null echo $(pwd) x=1 test echo cd cd && local -eu
+	| local "$1" --verbose $(pwd) grep
+2>/dev/null readonly printf -eu awk
+		then "$1" printf test $(pwd)
+"$1" printf echo && $(pwd)
+	printf awk done 2>/dev/null /usr/bin then test -eu echo then readonly printf
+		&& "$1" awk $(pwd) 2>/dev/null
+		--verbose ${HOME} && done local local $(pwd)
+export export | -eu ${HOME} then 'quoted text' awk then grep echo
+	awk local awk local /usr/bin /usr/bin cd "$@" --verbose -eu
+	cd cd "$@" $(pwd) "$@" export done
+	/usr/bin grep cd 2>/dev/null
+	| done $(pwd) grep grep --verbose "$1" printf
+done echo 'quoted text'
+	2>/dev/null | 'quoted text'
+&& export "$@" export ${HOME}
+grep && sed test 2>/dev/null readonly ${HOME} /usr/bin
+	--verbose 'quoted text' echo then "$1" cd "$1" echo
+	-eu 2>/dev/null ${HOME} grep /usr/bin readonly readonly local
+		"$@" $(pwd) | $(pwd) --verbose 'quoted text'
+	--verbose -eu awk cd printf sed grep
+	grep x=1 done x=1 readonly readonly $(pwd) && echo $(pwd) -eu |
+	export /usr/bin done /usr/bin then printf cd sed --verbose
+'quoted text' x=1 cd readonly sed -eu /usr/bin printf echo printf readonly
+then ${HOME} --verbose 'quoted text' "$@" ${HOME} export export
+	"$@" export then x=1 printf --verbose test /usr/bin local cd
+		readonly grep ${HOME} ${HOME} cd printf export printf "$1" /usr/bin --verbose
+	grep $(pwd) echo && 'quoted text' x=1 readonly 2>/dev/null $(pwd)
+export 2>/dev/null echo awk ${HOME} | 2>/dev/null | then --verbose readonly
+	"$@" echo "$@" ${HOME}
+readonly export readonly | cd x=1 test "$1" -eu /usr/bin && --verbose
+	done 'quoted text' | local && grep readonly
+sed | 'quoted text' echo 2>/dev/null
+readonly ${HOME} printf grep "$@" cd grep test 2>/dev/null
+	"$1" awk grep "$1" printf sed sed echo x=1 local 2>/dev/null readonly
+	| -eu test x=1 awk done 2>/dev/null grep cd "$1" test local
+	export done "$1" $(pwd) -eu && -eu test
+		2>/dev/null "$1" local sed | --verbose 2>/dev/null 'quoted text' ${HOME}
+${HOME} done grep readonly -eu $(pwd) $(pwd) awk done $(pwd) test --verbose
+sed "$1" grep | done test --verbose done test local readonly
+	"$@" awk echo printf && | printf local grep /usr/bin echo
+&& -eu --verbose readonly cd local 2>/dev/null "$1" awk
+		-eu "$@" "$@" done 'quoted text'
+	$(pwd) "$1" awk export ${HOME} printf then "$1" $(pwd) then cd
+sed 2>/dev/null readonly 2>/dev/null $(pwd) x=1 --verbose && export -eu local x=1
+		echo export export done awk 2>/dev/null sed then local awk sed done export 'quoted text'
+	done awk readonly sed sed ${HOME} "$@" 'quoted text' | export cd sed 'quoted text'
+		"$1" grep export then ${HOME}
+		printf ${HOME} | /usr/bin
+		${HOME} 2>/dev/null "$@" -eu done 2>/dev/null ${HOME} x=1 ${HOME} grep
+		local -eu "$1" readonly && readonly 2>/dev/null export | echo readonly then &&
+	printf local ${HOME} cd 'quoted text' sed /usr/bin echo sed grep x=1 'quoted text'
+${HOME} local readonly printf "$@"
+		then done 'quoted text' readonly readonly "$@" grep
+		| grep sed | 'quoted text' test readonly /usr/bin
+		&& x=1 cd "$1" local ${HOME} printf "$@" then cd export 'quoted text' echo
+'quoted text' 2>/dev/null ${HOME} && local then test readonly then | echo && printf
+export then $(pwd) ${HOME} $(pwd) && then then x=1 printf readonly local
+	echo | 2>/dev/null "$1" 'quoted text'
+then sed done $(pwd) awk awk --verbose
+	echo | echo $(pwd) | local awk 'quoted text' awk then x=1
+awk export ${HOME} printf printf printf "$1" then -eu readonly local && $(pwd)
+		local x=1 export then "$1" export grep grep $(pwd) sed then /usr/bin
+	-eu && local ${HOME} test
+	cd done printf --verbose readonly readonly printf ${HOME} awk ${HOME}
+x=1 2>/dev/null grep printf | cd printf
+-eu | "$1" 'quoted text' local test then awk /usr/bin
+		--verbose $(pwd) done readonly export printf readonly $(pwd) -eu
+${HOME} echo "$1" ${HOME} /usr/bin grep grep local
+&& ${HOME} readonly 'quoted text' x=1 && echo export local ${HOME} awk export
+sed printf grep grep x=1 cd local export export cd --verbose then
+-eu echo cd done $(pwd) --verbose echo grep cd sed cd -eu | readonly
+&& x=1 awk && x=1 grep done 'quoted text' 2>/dev/null /usr/bin 2>/dev/null
+		awk readonly x=1 | test test "$1" 'quoted text' --verbose ${HOME}
+export local sed printf echo grep test $(pwd) grep echo
+'quoted text' && ${HOME} --verbose | | cd readonly
+	$(pwd) ${HOME} 'quoted text'
+grep export export done then
+| grep export -eu | local readonly 2>/dev/null
+	--verbose printf $(pwd) export 'quoted text' | cd "$1"
+export then awk sed | readonly
+		x=1 -eu test readonly readonly
+	test readonly sed --verbose --verbose awk printf ${HOME} "$@" printf
+	2>/dev/null x=1 readonly done export "$1" sed readonly grep then
+	--verbose "$1" local grep then | 'quoted text' echo --verbose
+| then | done printf readonly --verbose then 2>/dev/null /usr/bin ${HOME} local
+		done readonly --verbose local $(pwd) && --verbose echo /usr/bin then
+$(pwd) "$@" awk test sed readonly awk export && then --verbose /usr/bin
+"$1" x=1 then 2>/dev/null "$@" grep
+		done ${HOME} cd ${HOME} then local sed 'quoted text' /usr/bin "$1" ${HOME} /usr/bin
+	2>/dev/null --verbose | "$@" /usr/bin awk 2>/dev/null
+		$(pwd) "$@" | local grep test 2>/dev/null
+		-eu /usr/bin $(pwd) printf
+	&& --verbose $(pwd) | "$1" local
+		cd 'quoted text' cd readonly && /usr/bin test
+grep | export export local export && test done then "$@" ${HOME} local "$1"
+	test grep "$1" readonly then /usr/bin | 'quoted text' then x=1
+	printf readonly 2>/dev/null
+		${HOME} | readonly local cd $(pwd) "$1" local then sed done -eu readonly
+--verbose x=1 local printf $(pwd) sed test 2>/dev/null
+		$(pwd) done test sed -eu x=1 then awk
+		grep $(pwd) test then && && "$@" 'quoted text' && "$@"
+		sed | done readonly test -eu "$@" 2>/dev/null "$@" "$1"
+		grep && export local readonly export export done /usr/bin | "$1" local 2>/dev/null
+	cd | 'quoted text' done /usr/bin "$@" $(pwd) && printf sed
+	grep $(pwd) done "$@" --verbose test sed printf -eu | grep local --verbose
+-eu readonly readonly
+		then -eu grep cd sed sed "$1" done 2>/dev/null export
+		export -eu export then x=1
+	done 2>/dev/null 'quoted text' 2>/dev/null test done readonly cd | $(pwd)
+${HOME} cd && ${HOME} cd cd then readonly grep
+		awk ${HOME} echo readonly cd /usr/bin 'quoted text'
+		$(pwd) | $(pwd) printf --verbose printf cd done done /usr/bin
+	-eu && /usr/bin printf printf
+	done "$@" 2>/dev/null && sed 'quoted text' ${HOME} sed 2>/dev/null "$@"
+	"$@" awk test | test printf
+		cd /usr/bin ${HOME} -eu printf 2>/dev/null && local test
+	awk | -eu "$@" cd local x=1 x=1 x=1
+sed 2>/dev/null export readonly
+readonly -eu x=1 && done --verbose
+		-eu 2>/dev/null echo /usr/bin sed -eu -eu "$1" echo "$1" /usr/bin
+-eu -eu echo -eu && 'quoted text'
+	"$1" /usr/bin readonly echo "$@"
+		"$1" | export 'quoted text' grep $(pwd) "$@" ${HOME} test sed
+		cd x=1 "$1" export "$@" 2>/dev/null $(pwd) "$1" awk -eu grep then cd
+awk then done printf ${HOME} 2>/dev/null test grep "$@" printf
+${HOME} $(pwd) ${HOME} awk x=1 readonly
+	--verbose local /usr/bin ${HOME}
+readonly ${HOME} 2>/dev/null echo -eu --verbose cd grep 2>/dev/null printf
+/usr/bin export readonly --verbose
+		then -eu "$@" | ${HOME} export "$@" then printf | readonly $(pwd)
+		${HOME} && /usr/bin grep
+	$(pwd) "$1" -eu sed $(pwd)
+		--verbose then done "$@" 2>/dev/null
+	--verbose | 2>/dev/null 'quoted text'
+'quoted text' test local --verbose && awk awk --verbose cd
+'quoted text' grep then cd readonly cd echo 'quoted text' "$@"
+		'quoted text' local x=1 /usr/bin cd "$1" sed export x=1 echo --verbose
+	$(pwd) test grep && printf 'quoted text' then | && "$1" 'quoted text'
+		2>/dev/null -eu x=1 2>/dev/null &&
+awk "$1" readonly 'quoted text' x=1 | export sed 2>/dev/null -eu | /usr/bin
+	export readonly 'quoted text' -eu $(pwd)
+	$(pwd) x=1 2>/dev/null test local && printf then $(pwd) then
+	&& $(pwd) 2>/dev/null x=1 "$@" "$@" readonly sed
+	--verbose awk test | sed cd "$1" readonly echo readonly
+	printf printf local local
+		'quoted text' "$@" awk &&
+2>/dev/null readonly cd done -eu cd then sed grep cd -eu done echo
+	readonly $(pwd) readonly readonly export
+		&& x=1 cd --verbose 'quoted text'
+&& export --verbose awk test ${HOME} 2>/dev/null test
+'quoted text' x=1 "$@" $(pwd) 2>/dev/null echo echo test ${HOME} | then test
+	then "$@" readonly 'quoted text' sed x=1 export awk -eu
+	printf sed 'quoted text' -eu -eu cd
+printf ${HOME} ${HOME} ${HOME} "$@" printf export awk
+test && "$@" then 2>/dev/null readonly sed printf /usr/bin $(pwd) x=1 'quoted text'
+		2>/dev/null local grep "$@" --verbose done printf awk local x=1 2>/dev/null
+--verbose $(pwd) done grep $(pwd) 2>/dev/null "$@" x=1 test export -eu
+cd $(pwd) --verbose 'quoted text' local --verbose
+echo --verbose --verbose sed echo
+	printf awk 'quoted text' cd ${HOME} printf
+cd 2>/dev/null echo && "$1" cd
+	x=1 test ${HOME} done sed done "$1" local /usr/bin /usr/bin readonly
+$(pwd) test | echo then $(pwd) grep "$1" echo printf awk $(pwd) local "$@"
+	2>/dev/null then printf "$@" grep local /usr/bin sed --verbose "$1" /usr/bin
+$(pwd) then $(pwd) ${HOME} && echo grep /usr/bin awk 'quoted text'
+		x=1 grep | "$1" "$@" "$1" readonly sed readonly
+	readonly export readonly --verbose -eu
+local printf then "$1" grep && && "$@" readonly done x=1 "$1" $(pwd)
+done echo grep | 2>/dev/null export --verbose 'quoted text' "$@" /usr/bin
+	echo | export /usr/bin awk
+	sed echo test grep "$1" awk sed done test x=1 echo
+	done then --verbose /usr/bin readonly test --verbose sed printf cd readonly
+echo 'quoted text' | cd /usr/bin
+echo | 2>/dev/null /usr/bin sed -eu "$1" then done
+"$@" 2>/dev/null x=1 then then then /usr/bin local
+		export echo ${HOME} /usr/bin
+--verbose | export "$@" cd | -eu awk test --verbose 'quoted text' "$1" "$@"
+		--verbose cd 2>/dev/null $(pwd)
+	echo $(pwd) readonly --verbose export awk 'quoted text' | 'quoted text' 2>/dev/null
+"$@" cd | -eu grep "$@" then cd | ${HOME} export && test $(pwd)
+		--verbose export /usr/bin x=1 then "$1" ${HOME} 'quoted text'
+--verbose export 2>/dev/null /usr/bin
+	${HOME} local done x=1 echo
+		awk cd done "$1" done 'quoted text' test done grep sed export --verbose then
+	local x=1 $(pwd) && "$@" /usr/bin local ${HOME}
+		$(pwd) "$1" && cd x=1 && -eu done 'quoted text' export $(pwd) -eu done
+	$(pwd) grep cd sed x=1 printf grep 'quoted text' /usr/bin $(pwd) done ${HOME}
+		x=1 | done printf 2>/dev/null "$1" printf then --verbose -eu grep /usr/bin
+		sed done "$1" /usr/bin ${HOME} "$1" ${HOME} readonly local 'quoted text' readonly
+	export test awk 'quoted text' | 2>/dev/null printf awk --verbose test $(pwd)
+		2>/dev/null awk 2>/dev/null grep "$@"
+		test "$1" printf cd sed echo 'quoted text' 2>/dev/null
+	export echo "$1" grep && 'quoted text'
+	then test x=1 grep done cd cd sed
+		done "$1" -eu && echo echo local x=1 x=1 cd export test 2>/dev/null
+	-eu $(pwd) ${HOME} "$@" --verbose then sed 2>/dev/null
+		-eu 'quoted text' readonly
+		-eu sed grep && then printf awk -eu
+	local --verbose "$1" test export export awk 'quoted text' sed /usr/bin
+		2>/dev/null readonly done test done awk awk "$@" echo "$@" test -eu -eu "$@"
+		| ${HOME} ${HOME} echo "$1" done awk --verbose 2>/dev/null /usr/bin then 2>/dev/null
+/usr/bin grep cd && ${HOME} cd readonly grep cd x=1 2>/dev/null test
+		awk | $(pwd) local cd "$1" export
+test export then "$@" then | "$@" 2>/dev/null
+-eu 'quoted text' /usr/bin sed
+	--verbose printf grep sed readonly 'quoted text'
+		readonly printf printf
+#include c65.sh
+		local $(pwd) x=1 cd -eu
+	then printf x=1 | local --verbose --verbose 2>/dev/null test && echo
+	$(pwd) x=1 grep done 'quoted text' then /usr/bin cd grep ${HOME} | export
+--verbose printf x=1 cd && -eu grep
+	echo cd then 'quoted text'
+	&& local && echo $(pwd) "$@" done --verbose --verbose
+		"$@" awk printf sed 2>/dev/null -eu | 'quoted text' awk printf
+		| sed 'quoted text' -eu grep 2>/dev/null "$@" ${HOME} echo echo -eu export
+test sed ${HOME} /usr/bin
+	cd then grep /usr/bin sed echo sed export grep && /usr/bin echo sed 2>/dev/null
+grep echo --verbose done then &&
+"$1" echo grep done echo sed cd "$1" "$1" $(pwd) printf cd export readonly
+		printf && "$1" local test ${HOME}
+export echo | 2>/dev/null grep echo readonly export "$@"
+"$@" sed $(pwd) && "$@" then "$1" x=1 done export awk && 'quoted text'
+sed $(pwd) | export --verbose readonly "$@" echo --verbose && test export
+		printf local awk echo
+	"$1" "$@" ${HOME} /usr/bin echo then $(pwd) 2>/dev/null
+export 'quoted text' grep | 'quoted text' | x=1 | echo $(pwd) then echo export
+	$(pwd) then readonly && $(pwd) /usr/bin && echo "$@" test
+		'quoted text' && $(pwd) grep cd
+grep /usr/bin then "$@" 'quoted text'
+		| local 2>/dev/null 'quoted text'
+	2>/dev/null "$1" readonly
+		printf then printf printf done then $(pwd) ${HOME} done
+		test 'quoted text' --verbose grep $(pwd) readonly test then export
+	local && -eu ${HOME} echo then "$@" test test --verbose
+	awk $(pwd) x=1 'quoted text' test local export test "$1" printf
+	&& -eu "$@" "$@" && /usr/bin 'quoted text'
+	${HOME} --verbose && x=1 test printf -eu
+	sed local --verbose then done | /usr/bin 2>/dev/null
+	x=1 readonly cd readonly -eu ${HOME}
+		-eu -eu 2>/dev/null | -eu
+"$@" 'quoted text' && test local
+| ${HOME} 2>/dev/null "$@" cd cd x=1 grep x=1 ${HOME} "$1" test printf
+		test 'quoted text' grep 2>/dev/null sed --verbose echo --verbose cd --verbose
+		grep grep then grep readonly /usr/bin "$@" 'quoted text'
+		printf awk then --verbose sed /usr/bin grep 2>/dev/null printf export local
+		$(pwd) readonly ${HOME} awk done -eu x=1 && local 2>/dev/null echo ${HOME}
+	local 2>/dev/null -eu 2>/dev/null export local readonly
+	local /usr/bin then && $(pwd) /usr/bin && 2>/dev/null | ${HOME} 2>/dev/null
+		sed 'quoted text' local test local test sed /usr/bin
+	&& local "$1" test awk /usr/bin awk export sed sed cd test ${HOME}
+grep 2>/dev/null test x=1 grep test sed 2>/dev/null then export echo readonly -eu
+		'quoted text' done done $(pwd) /usr/bin echo /usr/bin
+		"$@" cd /usr/bin local /usr/bin echo local 'quoted text'
+	&& grep x=1 grep --verbose | 2>/dev/null cd test
+	sed sed local "$1" 'quoted text'
+		sed readonly grep "$@" grep echo x=1 -eu x=1 echo 'quoted text' test
+| && x=1 grep && x=1 test echo "$@" /usr/bin local grep done done 'quoted text'
+/usr/bin "$1" /usr/bin done $(pwd) readonly done test cd $(pwd)
+	echo 2>/dev/null grep | | grep
+		readonly x=1 printf /usr/bin
+	"$@" ${HOME} then printf && x=1 "$@" printf
+	sed readonly awk then && readonly local awk
+		/usr/bin test echo sed --verbose
+awk awk echo export grep 2>/dev/null
+	--verbose ${HOME} sed sed local $(pwd) 'quoted text'
+	local sed awk export then --verbose awk awk $(pwd)
+		local "$@" awk --verbose ${HOME}
+&& done readonly test local printf 2>/dev/null test ${HOME}
+export echo -eu | done -eu 'quoted text'
+	&& x=1 then "$@" local
+		test test sed 'quoted text' local | then printf sed 'quoted text'
+readonly ${HOME} cd sed --verbose readonly sed "$1" $(pwd) 'quoted text' /usr/bin
+		"$@" /usr/bin && sed done readonly --verbose 2>/dev/null export
+	'quoted text' 2>/dev/null 'quoted text'
+	${HOME} && | 'quoted text' cd test printf done 2>/dev/null | "$@"
+&& && "$@" export awk awk --verbose 'quoted text' -eu
+		printf export printf test --verbose then
+		$(pwd) -eu $(pwd) "$@" sed test printf grep awk printf grep export
+	then "$1" test x=1 done && cd
+	'quoted text' | /usr/bin grep printf
+	awk && "$1" readonly x=1 export printf readonly done 2>/dev/null
+"$@" readonly 2>/dev/null then
+${HOME} ${HOME} --verbose awk export --verbose sed $(pwd) done
+x=1 "$@" $(pwd) awk "$1" 'quoted text' export "$1" --verbose
+printf x=1 cd --verbose grep ${HOME} printf "$@" test done then
+	test "$1" grep export | 'quoted text' --verbose local awk --verbose
+-eu "$1" && && | export "$1" grep export done sed | echo ${HOME} awk cd 2>/dev/null
+x=1 printf && local export test ${HOME} cd done
+	local ${HOME} -eu readonly --verbose x=1 awk --verbose done echo $(pwd)
+2>/dev/null --verbose cd x=1 ${HOME} && && $(pwd) | && cd ${HOME} test then
+"$@" "$1" printf && 'quoted text' ${HOME} x=1 2>/dev/null x=1
+		readonly -eu "$@" 2>/dev/null then | 2>/dev/null
+		${HOME} test printf 2>/dev/null /usr/bin
+	x=1 -eu awk grep -eu awk local 2>/dev/null && readonly $(pwd)
+		'quoted text' 'quoted text' done -eu awk $(pwd)
+	"$1" awk then 2>/dev/null sed ${HOME} cd readonly
+grep && x=1 awk -eu 2>/dev/null 2>/dev/null 'quoted text' cd done -eu export &&
+		2>/dev/null awk --verbose
+		done -eu && -eu $(pwd) done done grep 'quoted text'
+	x=1 readonly | done "$@" /usr/bin grep cd |
+	cd --verbose 'quoted text' test readonly test grep "$1"
+then echo --verbose sed -eu then printf 2>/dev/null then "$1" printf grep local
+		readonly "$@" cd ${HOME} then x=1 | ${HOME}
+	-eu $(pwd) ${HOME} done 2>/dev/null
+	then --verbose /usr/bin "$1" awk sed then grep $(pwd) export /usr/bin
+	awk x=1 printf "$1" readonly x=1 local echo ${HOME}
+test cd 'quoted text' /usr/bin "$1" && echo
+	/usr/bin ${HOME} test 'quoted text' ${HOME}
+		${HOME} echo 'quoted text' 2>/dev/null
+"$@" 'quoted text' export -eu echo export
+		$(pwd) ${HOME} cd test /usr/bin then "$1" $(pwd) x=1 readonly --verbose
+| /usr/bin readonly readonly
+then export export 2>/dev/null
+awk && "$@" echo -eu 2>/dev/null local echo 'quoted text' awk
+		| /usr/bin cd 'quoted text' grep grep
+		$(pwd) cd readonly "$@" "$@" cd --verbose export grep 2>/dev/null "$@" readonly
+	--verbose echo 2>/dev/null | $(pwd) export "$1" readonly echo /usr/bin
+	-eu | 'quoted text' "$@" "$1" awk -eu --verbose 2>/dev/null local
+	"$1" 2>/dev/null echo sed 2>/dev/null
+-eu cd --verbose then local ${HOME} sed test sed && 'quoted text' 2>/dev/null
+	--verbose ${HOME} export
+printf readonly "$@" done x=1 printf
+done 2>/dev/null done local sed ${HOME} $(pwd) sed && awk
+		--verbose echo cd cd export printf test local 2>/dev/null sed 'quoted text'
+		2>/dev/null grep 'quoted text' local
+awk echo export -eu 'quoted text'
+local readonly local && printf awk local && readonly $(pwd) local "$@"
+		awk /usr/bin /usr/bin && local 2>/dev/null && readonly
+	| awk echo done export
+		x=1 readonly x=1 "$1" sed 'quoted text' ${HOME} 'quoted text' then $(pwd) test
+	cd cd echo echo x=1 -eu readonly && x=1 $(pwd) then then readonly then "$@"
+	done -eu ${HOME} ${HOME} awk -eu --verbose --verbose -eu "$@"
+	done --verbose 2>/dev/null awk cd "$1" -eu /usr/bin && echo awk awk
+	then "$1" sed 'quoted text' local
+		sed "$1" -eu export readonly |
+-eu x=1 readonly readonly "$1" x=1 then -eu "$1" x=1
+| ${HOME} | readonly echo cd 'quoted text' done --verbose then sed 2>/dev/null
+export then /usr/bin readonly $(pwd) --verbose 2>/dev/null printf
+test 'quoted text' $(pwd)
+&& -eu ${HOME} | 'quoted text' test printf readonly
+	echo $(pwd) 'quoted text'
+	"$1" $(pwd) "$@" export /usr/bin /usr/bin done | cd -eu $(pwd) awk
+2>/dev/null 2>/dev/null $(pwd) done && $(pwd) --verbose done
+		-eu && 2>/dev/null test $(pwd) "$1" /usr/bin then
+test 'quoted text' | sed then done /usr/bin export && done
+	2>/dev/null /usr/bin printf
+	$(pwd) cd --verbose readonly awk /usr/bin done $(pwd) sed local test
+printf done --verbose --verbose -eu "$1" sed grep test ${HOME} export sed
+	test x=1 echo "$1" export $(pwd)
+		$(pwd) readonly 2>/dev/null export /usr/bin $(pwd)
+		'quoted text' | readonly printf echo
+readonly printf $(pwd) --verbose "$@" /usr/bin /usr/bin | | awk test
+awk grep readonly /usr/bin done test
+cd /usr/bin | -eu 2>/dev/null $(pwd) test then && cd test $(pwd) done export
+	| 'quoted text' "$@" 'quoted text' |
+		readonly then done | local && export 2>/dev/null "$@" $(pwd) awk
+| -eu -eu && | ${HOME} export | echo /usr/bin | readonly awk /usr/bin 2>/dev/null
+	"$1" "$@" done local 'quoted text'
+	done readonly "$1" --verbose test done
+	x=1 echo /usr/bin then x=1 then grep 'quoted text' printf echo
+		printf x=1 grep grep test
+		test test sed awk -eu sed | $(pwd) then grep x=1 "$1" | && "$1"
+	-eu | echo 'quoted text' $(pwd) grep then readonly | sed
+	awk | 2>/dev/null ${HOME}
+	--verbose /usr/bin /usr/bin echo echo && done test /usr/bin | | /usr/bin
+export --verbose then | -eu x=1
+readonly /usr/bin readonly /usr/bin "$@" x=1 $(pwd) done printf /usr/bin
+printf 2>/dev/null then done "$@" grep ${HOME} echo x=1 --verbose
+	/usr/bin grep readonly
+	2>/dev/null x=1 'quoted text' printf --verbose printf then then && cd | awk
+	awk --verbose grep --verbose -eu $(pwd) readonly
+	echo 2>/dev/null sed test echo awk printf | export "$1" export 2>/dev/null
+/usr/bin ${HOME} $(pwd) grep
+sed grep && /usr/bin -eu ${HOME} grep local 'quoted text' sed "$@" test local done
+		${HOME} sed grep 'quoted text' grep 2>/dev/null x=1 /usr/bin
+		export export | && --verbose /usr/bin done 'quoted text' grep ${HOME}
+	2>/dev/null then ${HOME} grep "$1" sed grep --verbose test "$1" done printf && sed
+echo export /usr/bin echo printf export printf
+then test sed 2>/dev/null then | grep printf
+		readonly $(pwd) cd echo then
+		--verbose awk "$@" cd /usr/bin export awk awk "$1" && $(pwd) sed
+		local then test grep 2>/dev/null
+'quoted text' $(pwd) | ${HOME} test
+		"$1" local awk 'quoted text' sed $(pwd)
+${HOME} then printf | then readonly --verbose && printf echo
+"$@" 'quoted text' export export sed 2>/dev/null grep -eu "$@" "$1"
+"$@" 2>/dev/null cd "$@" && awk test sed done printf | x=1 && printf && &&
+grep ${HOME} echo ${HOME} cd sed awk
+${HOME} grep "$1" readonly export ${HOME} x=1 export | export
+	export test then "$@" "$1" | echo sed "$@" local printf "$@" "$@" cd done
+	"$1" x=1 sed sed ${HOME} readonly printf && awk readonly sed && x=1 "$@" export
+"$1" | 2>/dev/null 2>/dev/null local | | export awk
+test printf then readonly 'quoted text' 'quoted text' "$@"
+/usr/bin 'quoted text' ${HOME} done x=1 sed local export -eu done
+test export then x=1 /usr/bin "$1" -eu test
+--verbose awk then done grep
+awk | awk /usr/bin printf done x=1 && echo printf printf -eu local 2>/dev/null
+	&& printf local && grep 'quoted text' cd 2>/dev/null then awk 'quoted text' echo
+"$1" cd | test -eu awk -eu cd 'quoted text' done cd "$1"
+readonly echo awk local ${HOME} sed "$@" test
+		readonly awk printf export $(pwd) x=1 2>/dev/null /usr/bin export
+		x=1 /usr/bin test -eu then test cd && && export awk echo "$@" awk printf
+	x=1 | cd echo x=1 local /usr/bin echo "$@"
+sed local $(pwd) sed test -eu
+echo /usr/bin echo readonly |
+	x=1 done "$1" $(pwd) x=1 -eu 'quoted text'
+		sed cd $(pwd) 'quoted text'
+		"$@" awk "$@" x=1 && echo printf test "$1" then then
+		x=1 done --verbose 'quoted text' "$@" done /usr/bin 'quoted text'
+	cd x=1 --verbose $(pwd) /usr/bin --verbose
+2>/dev/null --verbose 2>/dev/null export cd
+		export 2>/dev/null done awk grep test
+	&& "$@" grep x=1 'quoted text' --verbose export -eu local
+"$@" echo $(pwd) printf x=1 test readonly
+		&& echo "$@" local then 2>/dev/null readonly
+	local then awk printf cd grep "$1"
+		"$1" readonly then printf grep awk test /usr/bin test
+	cd "$1" readonly | 2>/dev/null "$1" readonly -eu
+		grep x=1 local ${HOME} --verbose then | ${HOME} 'quoted text' x=1 -eu
+"$1" /usr/bin 2>/dev/null cd sed test x=1 ${HOME} x=1 "$@" 'quoted text' then
+	--verbose --verbose done $(pwd) x=1 -eu $(pwd) --verbose
+		&& printf 2>/dev/null export readonly printf export
+		done sed echo test && /usr/bin export x=1 export awk $(pwd) $(pwd)
+local --verbose then grep -eu --verbose readonly
+then -eu then sed sed -eu sed done x=1 | cd ${HOME} -eu
+	awk sed local --verbose readonly $(pwd) 2>/dev/null local /usr/bin cd /usr/bin
+	readonly local local printf && readonly "$@" test
+2>/dev/null 2>/dev/null test ${HOME} printf export "$1" x=1 x=1 'quoted text'
+-eu ${HOME} | 2>/dev/null /usr/bin "$1" test export &&
+		'quoted text' printf -eu done $(pwd) x=1 2>/dev/null -eu $(pwd) readonly
+	awk done awk local grep $(pwd) sed --verbose grep
+		| grep printf readonly "$@" && readonly grep cd awk
+	echo echo printf grep cd sed awk export local
+		--verbose test readonly "$@" then $(pwd)
+echo x=1 echo 'quoted text'
+2>/dev/null grep -eu 2>/dev/null "$1" printf sed
+2>/dev/null grep sed sed done
+readonly "$1" 2>/dev/null | x=1 --verbose "$1" grep grep
+		awk ${HOME} --verbose 'quoted text' printf readonly
+	printf awk echo --verbose export grep readonly readonly && /usr/bin
+		grep && export "$@" ${HOME} readonly && awk && $(pwd) --verbose readonly --verbose
+	awk ${HOME} cd ${HOME} 2>/dev/null | /usr/bin x=1
+then then && | -eu "$@" sed /usr/bin awk /usr/bin grep export export ${HOME}
+${HOME} test ${HOME} test local x=1 x=1 ${HOME}
+		local printf /usr/bin cd sed
+	x=1 $(pwd) done printf cd grep then then echo "$@" --verbose &&
+	awk "$1" ${HOME} x=1 2>/dev/null awk | then then readonly
+		grep 'quoted text' 2>/dev/null then cd && -eu "$@" readonly export
+	printf export x=1 --verbose echo 2>/dev/null readonly done
+	${HOME} 2>/dev/null | then export local 2>/dev/null printf done && grep awk 2>/dev/null
+		grep echo awk x=1 awk 'quoted text' ${HOME} echo done
+		&& sed ${HOME} readonly then
+		| x=1 then local then -eu sed ${HOME} printf then echo --verbose done grep
+		2>/dev/null x=1 && local then "$1" "$1" "$1" readonly
+	"$@" printf | -eu grep -eu && | export --verbose "$@" done "$@" 'quoted text'
+		x=1 -eu test /usr/bin awk then $(pwd) --verbose | /usr/bin && then local local
+	"$1" echo printf /usr/bin echo
+	$(pwd) sed sed sed 'quoted text' 'quoted text' grep cd $(pwd)
+		2>/dev/null then export then test x=1 export sed | | 'quoted text' 'quoted text'
+		--verbose awk "$1" sed test echo /usr/bin test test --verbose --verbose |
+grep && x=1 "$1" grep ${HOME} grep $(pwd) export 'quoted text'
+	${HOME} cd export done
+	printf 'quoted text' readonly awk readonly
+"$@" export sed && $(pwd) printf cd readonly test test sed local
+local $(pwd) x=1 -eu | local --verbose readonly 'quoted text'
+	sed export export cd printf $(pwd) readonly
+		export -eu test local echo local && test --verbose
+		--verbose $(pwd) sed $(pwd) awk -eu sed local /usr/bin
+cd done ${HOME} grep cd --verbose x=1 2>/dev/null
+	test x=1 $(pwd) grep
+'quoted text' ${HOME} $(pwd) /usr/bin readonly
+	then test awk local local $(pwd) "$1" 'quoted text'
+		"$@" readonly --verbose $(pwd) echo
+	grep ${HOME} 'quoted text' --verbose cd 2>/dev/null grep
+-eu /usr/bin && 2>/dev/null grep export done x=1 -eu $(pwd) 'quoted text' done
+	done cd /usr/bin | sed
+	then cd && | $(pwd) 'quoted text' then
+/usr/bin $(pwd) && sed test echo grep echo cd -eu done cd then ${HOME}
+cd cd then grep "$@" sed echo done ${HOME} cd then echo cd then && "$1"
+		grep x=1 local readonly
+		grep | $(pwd) awk /usr/bin readonly --verbose sed
+		awk printf ${HOME} printf printf ${HOME} "$@" export test
+		-eu 2>/dev/null cd 'quoted text'
+	&& cd then ${HOME} readonly export "$@" cd local printf
+	--verbose --verbose cd $(pwd) echo local sed && -eu 2>/dev/null
+		done --verbose 'quoted text' readonly --verbose ${HOME} sed
+'quoted text' then readonly export /usr/bin
+export "$@" /usr/bin && x=1 grep && printf
+	--verbose x=1 awk readonly export readonly $(pwd) grep sed /usr/bin
+	/usr/bin done awk "$1" "$@" echo && "$@" x=1 "$@" readonly
+	test 2>/dev/null readonly | readonly x=1 then done
+	awk awk printf export then printf "$1" sed $(pwd)
+		awk printf "$@" && sed -eu local
+	then awk 2>/dev/null $(pwd) cd 2>/dev/null "$1" sed
+	readonly test sed $(pwd) echo $(pwd) cd then "$@" then echo
+	--verbose 2>/dev/null -eu
+-eu export /usr/bin printf grep then && 'quoted text'
+${HOME} && x=1 "$@" /usr/bin awk grep then printf ${HOME} "$@"
+	cd ${HOME} x=1 export ${HOME} --verbose
+		| "$1" /usr/bin /usr/bin grep export then 2>/dev/null test $(pwd) export grep
+| test -eu then sed local
+		sed /usr/bin awk | sed ${HOME} x=1 "$@" test 2>/dev/null --verbose
+"$@" cd sed 'quoted text' 'quoted text'
+echo sed /usr/bin x=1 sed 'quoted text' -eu then ${HOME} x=1
+	done 2>/dev/null | done "$@" printf local printf "$1" local x=1 export
+	sed | 2>/dev/null -eu && /usr/bin sed 'quoted text' grep
+	'quoted text' | sed /usr/bin --verbose local
+	$(pwd) && 2>/dev/null ${HOME} /usr/bin --verbose ${HOME} test
+		${HOME} printf local sed
+	local local local "$1" readonly
+| readonly | local --verbose sed $(pwd) && printf "$@" | -eu sed
+readonly 'quoted text'
+sed sed done x=1 export 2>/dev/null | test && /usr/bin ${HOME}
+	$(pwd) sed then readonly grep local | x=1 printf grep -eu && test cd test ${HOME}
+$(pwd) 'quoted text' $(pwd) readonly "$1" 'quoted text' "$@" $(pwd) readonly
+		| export awk ${HOME} echo printf && | x=1 'quoted text'
+/usr/bin "$@" x=1 sed 2>/dev/null printf
+local -eu printf "$1" x=1 cd local && "$1" grep
+		$(pwd) local test cd |
+sed printf -eu ${HOME} echo 2>/dev/null local export --verbose export
+	awk | --verbose sed grep readonly test printf local $(pwd) "$1" sed $(pwd)
+	${HOME} $(pwd) -eu export test export 2>/dev/null
+	readonly --verbose awk done echo
+		"$1" && test test readonly 2>/dev/null ${HOME}
+	2>/dev/null test cd readonly
+		"$@" 'quoted text' ${HOME} echo export readonly && | sed sed then
+${HOME} printf 'quoted text' /usr/bin grep 2>/dev/null export "$@" "$1" done
+		"$1" echo sed /usr/bin "$1" && export sed echo grep sed sed ${HOME} done
+		'quoted text' x=1 export "$1" "$@" x=1 /usr/bin grep awk 2>/dev/null /usr/bin
+grep done "$1" cd awk done ${HOME}
+'quoted text' printf sed export ${HOME}
+| export 2>/dev/null sed local echo echo export "$1"
+$(pwd) 'quoted text' "$1"
+		$(pwd) ${HOME} readonly -eu /usr/bin test
+awk readonly ${HOME} $(pwd) done --verbose "$1" ${HOME} readonly
+		grep --verbose 2>/dev/null echo --verbose -eu $(pwd)
+printf "$@" 2>/dev/null x=1 "$@" export 2>/dev/null "$1" $(pwd)
+"$1" ${HOME} 'quoted text' export x=1 done awk cd grep
+	then awk export "$@" ${HOME} awk echo test -eu /usr/bin echo readonly then grep
+		export --verbose sed x=1 && export export
+	-eu ${HOME} $(pwd) test
+${HOME} grep $(pwd) | echo $(pwd) test readonly readonly then $(pwd) 'quoted text'
+	x=1 then "$1" $(pwd) "$@"
+	done 2>/dev/null | /usr/bin
+	'quoted text' /usr/bin /usr/bin ${HOME}
+		grep cd -eu 'quoted text' 2>/dev/null sed
+		2>/dev/null ${HOME} --verbose $(pwd) awk readonly echo
+	| awk "$@" --verbose test /usr/bin $(pwd) test 2>/dev/null
+	x=1 /usr/bin $(pwd) /usr/bin x=1 printf sed then x=1 local
+	${HOME} 2>/dev/null cd /usr/bin echo | done ${HOME} grep && "$@" ${HOME} --verbose
+	&& /usr/bin ${HOME} local x=1 done "$1" "$@" | grep cd printf "$@" 2>/dev/null
+	awk 'quoted text' "$@" awk cd echo echo local "$1"
+		--verbose readonly local printf local then
+		--verbose --verbose awk && $(pwd) "$1" cd printf sed
+		awk echo sed awk /usr/bin readonly 2>/dev/null -eu ${HOME} then printf
+	export /usr/bin test "$@" done readonly x=1 2>/dev/null x=1 $(pwd) /usr/bin x=1
+	export /usr/bin echo /usr/bin then export
+		"$1" export readonly sed 'quoted text' -eu /usr/bin 'quoted text' $(pwd)
+		grep then | /usr/bin ${HOME} sed echo
+		| done cd test awk cd | printf 'quoted text' 'quoted text' sed
+	done then 'quoted text' printf
+&& --verbose test x=1 ${HOME} "$@" echo readonly -eu test export
+	test cd printf "$@" x=1 2>/dev/null ${HOME} x=1 awk printf grep awk echo
+	export echo /usr/bin "$1" x=1
+		grep /usr/bin local export awk test done local && printf test
+x=1 printf cd /usr/bin && awk printf done && grep
+		test done test "$1" printf export $(pwd) awk done export ${HOME}
+&& --verbose 'quoted text' grep grep
+	| cd "$@" 'quoted text' "$1" export
+		-eu cd test | readonly done export --verbose ${HOME} | then "$@" 2>/dev/null done
+		awk 'quoted text' | awk x=1 ${HOME} test ${HOME} "$1"
+	awk then local awk printf x=1 'quoted text' sed then
+	/usr/bin "$1" ${HOME} local &&
+	awk cd | 'quoted text'
+test grep test export printf local printf
+	export cd echo grep -eu --verbose export cd -eu
+'quoted text' "$@" local
+	$(pwd) cd -eu -eu "$1" 'quoted text'
+		x=1 export grep cd --verbose
+		-eu then | awk | readonly "$1" /usr/bin grep test | sed 'quoted text' grep
+	x=1 awk local cd test 'quoted text'
+		export awk awk readonly | -eu grep sed awk sed
+then --verbose echo done echo awk cd test ${HOME} sed local
+		x=1 cd printf export "$@" --verbose "$@"
+		printf "$1" done sed test echo printf
+		x=1 printf 2>/dev/null
+	/usr/bin then then ${HOME} then test then "$@" echo readonly
+	| echo grep export "$@" "$@" 2>/dev/null printf done ${HOME}
+	/usr/bin printf awk "$1" sed printf grep export
+export test /usr/bin done readonly
+		&& printf x=1 "$1" "$1" ${HOME} "$@" ${HOME} printf awk
+		grep 2>/dev/null 'quoted text' x=1 local
+		cd $(pwd) /usr/bin "$@" ${HOME} && 'quoted text' | 2>/dev/null
+export export "$1" grep echo 2>/dev/null
+	/usr/bin $(pwd) -eu && --verbose cd -eu x=1 | -eu printf "$@"
+	awk export -eu readonly export $(pwd) then x=1
+	| printf "$@" $(pwd) grep cd export
+		test awk | x=1 | "$@" readonly ${HOME} 2>/dev/null
+2>/dev/null 2>/dev/null readonly 'quoted text' ${HOME} cd cd export --verbose
+		done cd local 'quoted text' | awk
+grep test | sed x=1 cd readonly sed 2>/dev/null then 'quoted text' 'quoted text'
+"$1" | readonly test printf grep readonly "$1" x=1 "$1" "$@" echo then test sed
+done 'quoted text' export local readonly done done test local "$@" local | x=1
+readonly then -eu "$@" cd $(pwd) then
+"$1" grep echo "$@" cd local local 2>/dev/null x=1 $(pwd) readonly x=1 "$@"
+&& "$@" echo | "$@" ${HOME} local test $(pwd) done | grep | "$@" x=1
+		"$1" sed | | local $(pwd) readonly | done readonly ${HOME} --verbose local
+		echo readonly -eu export
+		printf -eu local --verbose readonly then
+		"$@" -eu done printf done local -eu "$1" "$@" printf test cd 2>/dev/null
+	| 'quoted text' sed cd readonly done test /usr/bin done
+--verbose sed x=1 echo echo cd awk awk | ${HOME} echo && && export 2>/dev/null
+sed done && x=1 -eu | done then x=1 && $(pwd)
+	readonly | $(pwd) "$1" $(pwd) $(pwd) readonly
+	'quoted text' --verbose --verbose ${HOME}
+		2>/dev/null done then "$1" done && ${HOME}
+		--verbose --verbose echo awk
+		--verbose && "$@" 2>/dev/null $(pwd) /usr/bin local
+	sed $(pwd) && "$@" cd cd "$1" "$@" awk awk echo done
+"$@" $(pwd) grep done test local grep test echo
+cd -eu x=1 2>/dev/null "$@" x=1 sed then | ${HOME} $(pwd)
+	then readonly x=1 -eu && | --verbose sed x=1 local ${HOME} $(pwd) done cd
+	2>/dev/null readonly -eu
+		sed 2>/dev/null readonly readonly /usr/bin 2>/dev/null
+	2>/dev/null && /usr/bin readonly /usr/bin
+		test /usr/bin "$1" 'quoted text' ${HOME} ${HOME} local export
+"$@" | && printf --verbose | /usr/bin awk 'quoted text'
+	| done awk then "$1" done
+	then readonly done ${HOME} 'quoted text' x=1 $(pwd) grep
+	'quoted text' echo printf /usr/bin x=1 done | && | done && 2>/dev/null
+| readonly grep -eu -eu && --verbose then
+		"$@" awk readonly then "$@" cd 'quoted text' sed x=1 then 2>/dev/null cd
+		| local export x=1 grep test test sed printf --verbose
+echo && echo x=1 awk done "$1"
+cd then test export "$1" cd awk 'quoted text' sed x=1 --verbose 2>/dev/null printf
+	--verbose "$1" printf printf | sed ${HOME} sed && echo
+		/usr/bin 2>/dev/null test
+	printf /usr/bin 2>/dev/null --verbose "$@" x=1 echo
+--verbose 'quoted text'
+echo && /usr/bin /usr/bin &&
+	sed 'quoted text' $(pwd) /usr/bin && test && | sed && x=1 --verbose readonly
+		export ${HOME} && -eu 2>/dev/null readonly local
+	awk done echo export printf sed printf "$@"
+x=1 cd export | grep | printf
+	x=1 echo readonly awk echo printf printf ${HOME} local /usr/bin then x=1 done
+		2>/dev/null | 2>/dev/null test $(pwd) local | export
+	sed done /usr/bin ${HOME}
+&& local /usr/bin readonly x=1 done --verbose /usr/bin test &&
+${HOME} grep local test echo readonly
+		-eu test 2>/dev/null awk --verbose export && 2>/dev/null
+local export -eu && cd done && sed printf "$1" 2>/dev/null cd grep | --verbose
+	printf 'quoted text' readonly 2>/dev/null
+		test awk awk "$1" /usr/bin
+$(pwd) ${HOME} 'quoted text'
+'quoted text' awk x=1 $(pwd) "$1" "$@" awk /usr/bin
+	"$@" local --verbose "$@" ${HOME} "$@" readonly echo cd x=1 -eu "$@" sed "$@" done
+		--verbose /usr/bin -eu $(pwd)
+		then $(pwd) cd | -eu then 'quoted text'
+		-eu --verbose grep -eu readonly ${HOME}
+	printf && && 2>/dev/null local grep "$1" 'quoted text'
+		awk sed | x=1 export test
+		cd "$@" cd 2>/dev/null "$1" "$1" done printf 2>/dev/null
+done cd export local then | export
+$(pwd) -eu grep $(pwd)
+		test $(pwd) local then /usr/bin export awk | grep ${HOME}
+		awk printf grep done awk
+		"$1" test sed export export cd sed grep x=1 readonly "$@"
+		sed awk printf 2>/dev/null
+		printf /usr/bin "$1" local
+		readonly export awk x=1 echo && $(pwd) "$1" $(pwd) /usr/bin test export
+		local $(pwd) test local printf then --verbose
+	2>/dev/null $(pwd) && awk "$@" x=1 $(pwd) --verbose --verbose grep done "$@"
+		| "$@" /usr/bin "$@" "$1" "$1" 'quoted text' done
+	test test echo ${HOME} cd /usr/bin then 'quoted text'
+sed "$@" local $(pwd) test
+		grep done /usr/bin sed printf $(pwd)
+	test "$1" grep then test
+local 'quoted text' done --verbose done
+		--verbose local cd 'quoted text' test
+		-eu && export awk echo | echo export -eu readonly test sed readonly sed ${HOME}
+	x=1 export export done && echo echo cd "$@" ${HOME} $(pwd) cd printf grep then
+	then $(pwd) local $(pwd)
+&& awk export "$1" 'quoted text'
+	printf cd grep --verbose /usr/bin
+	sed ${HOME} 2>/dev/null test printf --verbose grep cd
+	done sed 'quoted text' $(pwd)
+	'quoted text' test && then export cd 2>/dev/null 'quoted text' grep 'quoted text'
+	echo test 'quoted text' printf 2>/dev/null "$@" -eu test
+"$@" $(pwd) 'quoted text' sed awk awk "$1" --verbose | ${HOME} "$@" then grep
+		echo grep echo -eu echo "$@" && -eu -eu
+		local test | echo /usr/bin test --verbose 2>/dev/null "$1" |
+	cd grep | awk "$@" /usr/bin grep $(pwd)
+awk ${HOME} awk "$@" done
+sed readonly test export printf
+x=1 grep grep 'quoted text' ${HOME}
+		awk echo -eu grep export /usr/bin -eu -eu x=1 echo echo
+		then -eu export -eu local $(pwd)
+export done x=1 readonly x=1 export awk $(pwd) export /usr/bin local
+	&& x=1 "$1" echo awk export "$@" -eu $(pwd) export sed $(pwd) | readonly x=1
+	/usr/bin "$@" cd test printf done done grep grep readonly readonly
+cd test printf 2>/dev/null then local printf
+	"$@" then done && /usr/bin "$1"
+	then 2>/dev/null $(pwd) && x=1 $(pwd) x=1 && /usr/bin
+		${HOME} awk test then readonly
+		cd --verbose export awk | local 'quoted text' awk | printf $(pwd)
+		printf ${HOME} cd readonly printf test cd
+	/usr/bin test readonly readonly ${HOME} test readonly then 2>/dev/null
+	printf then 2>/dev/null | --verbose 'quoted text' "$@" done -eu export | "$@" &&
+	then 2>/dev/null test 2>/dev/null grep 'quoted text' then -eu
+		then done test awk test 2>/dev/null echo 2>/dev/null readonly
+		/usr/bin 2>/dev/null then readonly 'quoted text' -eu && test 2>/dev/null
+	"$@" readonly 2>/dev/null "$1" readonly ${HOME}
+		awk echo cd readonly --verbose
+&& -eu local test $(pwd) $(pwd)
+2>/dev/null /usr/bin "$1" readonly $(pwd)
+local 'quoted text' echo x=1 local
+-eu /usr/bin awk echo test --verbose echo 2>/dev/null grep
+		| /usr/bin --verbose
+'quoted text' | x=1 ${HOME} local ${HOME}
+	export ${HOME} grep echo x=1 ${HOME} -eu | export 'quoted text'
+${HOME} then readonly "$1" $(pwd) /usr/bin grep 'quoted text' sed "$@" x=1 local
+	done done 2>/dev/null grep -eu
+	/usr/bin -eu then $(pwd)
+	| done "$1" echo 'quoted text'
+	awk --verbose x=1 2>/dev/null test export grep 2>/dev/null test
+$(pwd) && then "$1" done x=1 sed x=1
+		| test | $(pwd) echo && --verbose
+--verbose then /usr/bin --verbose 'quoted text' done grep "$@" local sed printf
+| awk -eu | "$1" --verbose printf -eu | --verbose 2>/dev/null
+		sed -eu local printf && --verbose then ${HOME} && /usr/bin readonly -eu ${HOME}
+		/usr/bin then --verbose "$@" 'quoted text' grep awk -eu && readonly
+$(pwd) 'quoted text' export --verbose -eu awk $(pwd) readonly
+"$1" grep $(pwd) export cd export printf --verbose sed --verbose
+	export awk /usr/bin $(pwd)
+		then then cd 'quoted text' "$1" sed readonly local /usr/bin cd
+	awk x=1 done && | "$1" grep 'quoted text'
+	x=1 local awk then printf /usr/bin x=1 awk "$1" export "$@" $(pwd)
+readonly && test echo 2>/dev/null local --verbose
+	export $(pwd) && | x=1 --verbose -eu
+	cd then cd 'quoted text' grep ${HOME} /usr/bin -eu ${HOME} $(pwd) test | local
+"$@" --verbose $(pwd) export cd 'quoted text' then
+		x=1 grep grep awk readonly echo readonly
+"$@" test $(pwd) printf sed printf x=1
+		export cd /usr/bin printf sed "$@" then done 2>/dev/null "$1" echo readonly
+		"$1" 2>/dev/null done done $(pwd) | ${HOME} 'quoted text'
+	echo readonly "$@" 2>/dev/null "$1" echo cd x=1 2>/dev/null && awk printf 2>/dev/null
+awk printf $(pwd) "$1" echo 'quoted text'
+		&& local grep then /usr/bin cd readonly $(pwd) x=1 awk 2>/dev/null done
+"$1" 'quoted text' cd local --verbose readonly
+		sed cd "$@" awk 'quoted text' && export
+		test "$1" $(pwd) export echo -eu 'quoted text' then 2>/dev/null awk /usr/bin
+	awk test printf readonly
+export done && test readonly echo grep "$1" x=1 test --verbose cd
+2>/dev/null readonly ${HOME} readonly readonly $(pwd) ${HOME} readonly export done
+	readonly echo "$@" sed x=1 'quoted text' ${HOME} then
+&& /usr/bin readonly $(pwd) | test cd test readonly | echo done then 2>/dev/null
+		${HOME} sed && --verbose x=1 readonly then /usr/bin cd && test cd && ${HOME}
+		${HOME} test ${HOME} sed export &&
+		x=1 && then "$@" export grep cd /usr/bin /usr/bin -eu 2>/dev/null export
+export "$@" && done "$1" 'quoted text' "$@" sed -eu echo cd 2>/dev/null x=1
+export ${HOME} 'quoted text' printf | export test cd readonly readonly
+		awk test $(pwd) readonly | 2>/dev/null local /usr/bin echo then -eu 2>/dev/null
+	then --verbose /usr/bin "$@" readonly test --verbose cd local test
+	'quoted text' $(pwd) sed cd echo export && export 'quoted text'
+done export printf awk /usr/bin
+&& test then ${HOME} awk then done cd printf sed --verbose
+2>/dev/null x=1 /usr/bin x=1 "$@" --verbose
+		"$@" | printf | then done echo sed "$@"
+	| echo grep readonly awk done | "$1" done
+/usr/bin $(pwd) 'quoted text' $(pwd) printf "$1" ${HOME} sed local done && export
+	2>/dev/null awk "$@" /usr/bin local
+		then x=1 2>/dev/null local then /usr/bin
+	done sed | "$1" local test awk $(pwd) -eu local then export
+done readonly then "$@" export 'quoted text' done 2>/dev/null ${HOME} --verbose
+2>/dev/null readonly sed sed && sed -eu && grep test sed
+	x=1 cd $(pwd) echo sed local --verbose && sed then echo
+		awk cd cd printf printf sed local then
+	grep "$1" x=1 export "$@" 2>/dev/null "$@" grep test export echo echo
+"$@" done | then readonly "$@"
+printf echo 2>/dev/null grep | local
+cd && ${HOME} | readonly ${HOME} grep readonly
+sed then readonly local $(pwd) export
+	awk && awk sed 2>/dev/null && && test echo x=1 --verbose
+	readonly $(pwd) "$1" "$@" sed --verbose sed readonly "$@"
+		export "$1" export 'quoted text' ${HOME} 'quoted text' -eu grep 2>/dev/null cd
+		&& sed grep 2>/dev/null
+		then export x=1 /usr/bin echo | echo
+	grep /usr/bin test /usr/bin
+	export sed then readonly ${HOME} --verbose x=1 /usr/bin ${HOME}
+	echo x=1 -eu ${HOME} "$@" grep 2>/dev/null "$1" && 'quoted text'
+${HOME} "$1" echo grep echo
+	then 'quoted text' 2>/dev/null /usr/bin $(pwd) grep
+	-eu cd "$@" -eu /usr/bin done x=1 && done
+	${HOME} sed x=1 | cd
+		cd "$1" | /usr/bin sed -eu | "$1" test local awk echo && -eu /usr/bin
+		| -eu | local readonly | ${HOME} test
+		echo ${HOME} --verbose local echo 'quoted text'
+	/usr/bin awk cd | ${HOME} | test /usr/bin sed
+	x=1 test --verbose awk 'quoted text' local test "$@" $(pwd)
+		then then printf 2>/dev/null local "$1" sed ${HOME} && $(pwd)
+readonly then readonly $(pwd) export "$1"
+		test ${HOME} export 'quoted text' 'quoted text' done cd
+		$(pwd) grep echo "$1" ${HOME} sed "$@" ${HOME} then && cd /usr/bin
+printf readonly | printf printf --verbose ${HOME} awk readonly printf /usr/bin
+readonly --verbose 2>/dev/null awk --verbose readonly ${HOME} "$1" ${HOME} export
+awk echo | 2>/dev/null "$@" && x=1 &&
+${HOME} sed printf cd grep readonly /usr/bin /usr/bin /usr/bin
+readonly "$@" && --verbose readonly 2>/dev/null --verbose cd readonly
+	printf --verbose grep ${HOME} ${HOME} awk export ${HOME} echo ${HOME} 'quoted text'
+		then cd "$@" -eu "$1" 2>/dev/null $(pwd) /usr/bin readonly readonly awk grep grep
+'quoted text' $(pwd) sed 2>/dev/null 2>/dev/null grep cd 2>/dev/null
+2>/dev/null readonly --verbose echo
+		/usr/bin /usr/bin $(pwd) --verbose /usr/bin test
+"$1" grep 2>/dev/null "$1"
+export $(pwd) test /usr/bin awk $(pwd) ${HOME} 'quoted text' x=1 then /usr/bin
+		grep printf && x=1 printf --verbose 2>/dev/null export grep $(pwd) grep done x=1
+printf local -eu sed | /usr/bin "$@" $(pwd) printf readonly
+		2>/dev/null 2>/dev/null ${HOME} x=1 readonly echo 'quoted text'
+export readonly x=1 done "$1" && 2>/dev/null && local readonly | "$1" echo test
+		sed grep 'quoted text' -eu && "$@" "$1"
+	done "$@" test local
+	grep x=1 grep echo $(pwd) readonly
+x=1 2>/dev/null /usr/bin awk awk | sed $(pwd) printf
+	"$1" sed -eu grep printf $(pwd) | test
+		| awk 'quoted text' && "$1" x=1 $(pwd) x=1 grep 'quoted text'
+		printf grep -eu sed && export done export cd done
+	export "$1" printf | $(pwd) "$1" -eu "$1" done --verbose
+		awk cd echo cd export local done
+	sed done "$1" awk -eu sed | ${HOME} printf export
+| then printf echo local ${HOME} done cd sed && local awk test sed echo test grep
+	$(pwd) echo sed "$@" then "$1" grep awk printf
+		$(pwd) | 2>/dev/null printf "$1" local /usr/bin /usr/bin -eu $(pwd)
+	&& then printf cd printf && 2>/dev/null
+		--verbose | x=1 grep /usr/bin "$@" readonly test readonly
+	echo $(pwd) done 'quoted text' cd 2>/dev/null
+	/usr/bin readonly sed local | 2>/dev/null && local && echo /usr/bin
+then sed /usr/bin echo grep printf
+local "$1" 'quoted text' /usr/bin && sed && grep done 2>/dev/null -eu | then
+		test cd local echo then then done --verbose ${HOME} --verbose
+local /usr/bin test "$1" | | test 'quoted text' printf
+cd readonly "$1" -eu
+	&& local cd sed | "$1" done
+		sed printf --verbose awk /usr/bin readonly readonly echo test echo printf local
+done cd /usr/bin x=1 printf echo grep ${HOME} cd done "$1" ${HOME} grep export
+-eu "$@" -eu readonly export x=1 grep then test cd -eu | local export sed then
+	awk grep printf done readonly "$1" | awk cd $(pwd)
+readonly awk ${HOME} |
+x=1 "$1" "$@" 2>/dev/null --verbose --verbose
+then -eu grep printf test grep awk $(pwd) ${HOME} printf test x=1 "$1"
+		${HOME} $(pwd) test export x=1 test grep
+	${HOME} 'quoted text' "$1" echo sed 'quoted text'
+test export x=1 test local readonly ${HOME} $(pwd) $(pwd)
+	2>/dev/null ${HOME} awk x=1 2>/dev/null && printf
+grep x=1 local awk "$1" grep test ${HOME} sed grep $(pwd) -eu
+-eu x=1 x=1 then grep
+	cd awk cd "$@" sed export done printf
+		&& --verbose ${HOME} echo 'quoted text' 'quoted text' export printf $(pwd)
+		awk 'quoted text' $(pwd) then $(pwd) sed then
+	cd done x=1 "$1" "$@" readonly
+		'quoted text' "$@" export cd printf readonly then "$1" grep x=1 |
+		$(pwd) $(pwd) -eu && printf done awk done then test readonly test && cd
+	${HOME} echo readonly done && --verbose cd ${HOME} 'quoted text' x=1 2>/dev/null
+		2>/dev/null readonly sed "$1" echo
+/usr/bin cd | printf then $(pwd) && x=1 printf echo
+	echo $(pwd) sed sed && 2>/dev/null
+	grep test grep then "$@" printf echo "$1"
+	-eu --verbose 2>/dev/null export $(pwd) x=1 test -eu readonly -eu test --verbose
+then cd done | local $(pwd) --verbose awk 2>/dev/null x=1 grep x=1 /usr/bin
+--verbose 2>/dev/null -eu && cd $(pwd) test grep
+		then sed readonly x=1 ${HOME} 'quoted text' 2>/dev/null echo awk
+	$(pwd) "$1" export then 'quoted text' grep 2>/dev/null && | x=1 ${HOME}
+		sed awk --verbose done --verbose $(pwd) $(pwd)
+		done cd test && -eu $(pwd) then 2>/dev/null -eu && /usr/bin 'quoted text'
+export /usr/bin 'quoted text' grep
+&& --verbose /usr/bin export | local printf local readonly /usr/bin
+cd "$@" /usr/bin export --verbose awk sed /usr/bin awk export
+		&& "$@" test $(pwd) sed
+		${HOME} 'quoted text' cd echo && awk done x=1 /usr/bin
+	| readonly done "$@" test 'quoted text' 'quoted text' printf
+	readonly && && --verbose then awk done readonly
+test /usr/bin done && "$@" --verbose -eu 2>/dev/null "$1" --verbose cd readonly
+2>/dev/null /usr/bin x=1 awk echo printf ${HOME} export echo
+		local x=1 sed readonly grep grep --verbose
+		/usr/bin local awk local 2>/dev/null
+&& x=1 cd awk /usr/bin printf $(pwd) awk awk --verbose x=1 $(pwd) 'quoted text'
+echo export "$@" && /usr/bin | -eu ${HOME}
+		$(pwd) printf test | cd echo grep local $(pwd) /usr/bin awk readonly $(pwd) readonly
+		"$1" printf -eu export test &&
+| printf then sed "$1" $(pwd) test ${HOME} "$1" cd awk && echo x=1 x=1
+		printf "$@" echo ${HOME} local 2>/dev/null 'quoted text'
+		2>/dev/null grep local readonly readonly
+		$(pwd) awk sed "$@" --verbose awk local
+		sed x=1 'quoted text' local printf 'quoted text'
+	grep x=1 grep test awk ${HOME}
+grep 'quoted text' sed 2>/dev/null sed -eu export awk "$1" -eu awk x=1
+	echo ${HOME} awk echo awk printf grep readonly
+readonly "$@" awk $(pwd) $(pwd) grep cd "$1" test cd | readonly && --verbose
+--verbose awk awk awk x=1 cd 2>/dev/null -eu "$1" 2>/dev/null -eu x=1 readonly
+		'quoted text' /usr/bin cd 2>/dev/null local | x=1 "$1" done done readonly
+	2>/dev/null local export
+		echo $(pwd) cd awk readonly sed readonly
+grep awk --verbose cd grep printf "$1" awk 2>/dev/null local echo
+		echo ${HOME} done printf 'quoted text' "$1" ${HOME} readonly cd sed sed cd printf
+	awk | done cd test --verbose awk done awk
+		awk printf | grep | test readonly
+	x=1 "$1" ${HOME} "$@" readonly grep --verbose echo printf &&
+awk awk /usr/bin -eu sed && --verbose grep /usr/bin /usr/bin
+	2>/dev/null then grep grep done printf "$1" 2>/dev/null | then
+	done $(pwd) local $(pwd) "$1" --verbose sed ${HOME}
+		test cd && printf grep export x=1 local local ${HOME} | awk $(pwd) ${HOME}
+readonly -eu ${HOME} | 2>/dev/null x=1
+		'quoted text' grep grep -eu 'quoted text' 'quoted text' echo
+		-eu 'quoted text' "$@" awk && "$1" &&
+		cd cd 'quoted text' readonly && /usr/bin cd then | /usr/bin
+	$(pwd) test done "$1" printf -eu $(pwd) readonly $(pwd) then
+	export cd readonly cd "$@" | then ${HOME} "$@"
+done && cd grep 2>/dev/null --verbose "$1" export --verbose x=1
+	done grep then readonly local export -eu awk sed /usr/bin test "$1"
+		printf printf sed local "$1" printf local /usr/bin
+printf $(pwd) test | 2>/dev/null
+cd cd echo 'quoted text' 2>/dev/null awk /usr/bin
+		printf then -eu x=1 local done x=1 -eu grep "$1"
+		--verbose export "$@" ${HOME} grep "$1" test "$1" grep --verbose
+		--verbose test printf && -eu
+		-eu done test export "$@" $(pwd) done printf readonly done done export
+		awk cd ${HOME} && local grep | local then local 2>/dev/null
+"$1" x=1 'quoted text' done 'quoted text' | --verbose --verbose
+	test export echo then 'quoted text' "$1" echo -eu 2>/dev/null local
+local readonly "$1" printf readonly
+	grep $(pwd) && done 2>/dev/null ${HOME} -eu && printf
+	| $(pwd) test 2>/dev/null printf --verbose 'quoted text'
+local grep awk sed | $(pwd) 'quoted text'
+		&& "$@" 2>/dev/null local "$@" test then -eu then cd
+cd -eu readonly readonly "$@" local local 2>/dev/null local "$@" sed
+		&& --verbose printf $(pwd) grep x=1 cd "$1" sed && test "$@"
+	done awk export readonly export
+	then | echo export sed $(pwd) 2>/dev/null "$1" awk cd "$@" "$1" awk /usr/bin
+		-eu cd test then sed | ${HOME} "$1" export done done
+		test | test test cd 2>/dev/null then "$1" then ${HOME} /usr/bin "$@"
+"$1" printf "$@" done -eu 2>/dev/null ${HOME} /usr/bin printf readonly
+${HOME} /usr/bin awk then test awk
+then "$@" -eu $(pwd) grep | --verbose echo
+| printf test test --verbose && ${HOME} "$@" awk
+		--verbose then echo grep /usr/bin
+	readonly grep "$1" /usr/bin $(pwd) printf
+		test x=1 "$1" printf | local "$@" grep done test awk readonly -eu x=1
+		2>/dev/null $(pwd) $(pwd) | && then test
+"$1" --verbose "$1" -eu sed sed "$@" awk && sed done readonly x=1 export
+	grep done readonly test ${HOME} sed && x=1 "$1" "$1" sed $(pwd) local
+		local grep export test $(pwd)
+	printf export test $(pwd) 2>/dev/null /usr/bin echo
+	echo then --verbose test echo /usr/bin echo 'quoted text' x=1
+		test 'quoted text' awk export grep && $(pwd) /usr/bin $(pwd) /usr/bin x=1 --verbose
+		local ${HOME} --verbose $(pwd) "$1" export sed && "$@" sed cd /usr/bin
+done done awk local grep x=1 grep sed "$1" && | printf 'quoted text'
+		x=1 readonly /usr/bin cd $(pwd) "$1" test && "$1" sed sed
+awk awk 2>/dev/null sed done "$1" test | "$@" && test test then cd |
+local echo ${HOME} awk 2>/dev/null
+		&& 'quoted text' grep "$@" x=1 -eu "$@" awk readonly cd | echo /usr/bin
+		--verbose ${HOME} --verbose
+local "$@" sed test $(pwd) export printf done local cd done -eu then
+then cd then done 2>/dev/null readonly done
+		"$1" -eu local sed --verbose sed export awk done -eu
+		export /usr/bin cd readonly echo /usr/bin printf readonly
+	done export /usr/bin test x=1 sed --verbose cd ${HOME}
+grep export sed readonly /usr/bin "$@" awk sed awk && done 'quoted text'
+	-eu --verbose echo export readonly /usr/bin readonly cd /usr/bin 2>/dev/null
+grep -eu && 2>/dev/null && ${HOME} cd 2>/dev/null 2>/dev/null x=1 export 2>/dev/null
+		then 2>/dev/null export printf done 'quoted text' && grep ${HOME} grep awk awk
+	"$1" ${HOME} printf $(pwd) cd sed awk 2>/dev/null | $(pwd) -eu --verbose
+		done "$1" 2>/dev/null --verbose $(pwd) cd awk done
+	-eu echo | | local -eu readonly then then && x=1 && /usr/bin
+		"$@" x=1 ${HOME} ${HOME} grep 2>/dev/null
+--verbose | "$1" && grep export $(pwd) "$@" echo
+		readonly export grep "$1" /usr/bin echo ${HOME} ${HOME} ${HOME}
+test awk 2>/dev/null done printf done
+echo sed test $(pwd) export /usr/bin | /usr/bin
+	done test "$@" export ${HOME} grep
+test then printf x=1 2>/dev/null export local "$@" export awk
+'quoted text' $(pwd) x=1 readonly -eu x=1
+"$1" "$1" $(pwd) cd && then ${HOME} awk grep && sed echo --verbose
+grep printf test echo -eu "$1" "$1" $(pwd) --verbose 'quoted text'
+	printf 'quoted text' cd test | awk
+then x=1 sed "$1" cd 'quoted text'
+	'quoted text' grep cd export "$1" awk then
+local | x=1 cd then awk /usr/bin readonly "$1" export export
+		${HOME} -eu -eu --verbose /usr/bin cd "$1" printf awk local local x=1
+		'quoted text' 'quoted text'
+test && && ${HOME} awk printf readonly export then then "$1" grep sed done
+	-eu | printf grep test
+		then --verbose done && -eu "$@" export -eu $(pwd) /usr/bin sed "$1" 'quoted text'
+"$1" $(pwd) x=1 echo awk "$@" "$@" awk "$@" x=1 --verbose
+test | then | -eu test | then "$1" 2>/dev/null
+		awk printf grep then --verbose 2>/dev/null
+		&& -eu --verbose readonly sed /usr/bin
+		sed $(pwd) x=1 printf test && test sed -eu test 'quoted text' ${HOME}
+	'quoted text' --verbose x=1
+		grep readonly local local done local export
+${HOME} local test done $(pwd) grep "$1" export echo grep
+		2>/dev/null test && done /usr/bin --verbose done
+2>/dev/null "$1" echo cd /usr/bin test done
+done export export grep "$@" --verbose
+	&& printf /usr/bin printf "$1" "$1" --verbose
+export $(pwd) export grep printf ${HOME} /usr/bin "$@" awk export "$1" x=1
+	grep --verbose x=1 test && export --verbose "$@" then "$@" cd 'quoted text'
+		${HOME} x=1 grep 'quoted text' echo
+		${HOME} awk "$1" printf --verbose x=1 && test x=1 /usr/bin
+		grep printf --verbose
+	readonly -eu -eu ${HOME} echo
+	test export export awk 'quoted text' echo 'quoted text'
+'quoted text' $(pwd) && sed
+	-eu -eu ${HOME} -eu ${HOME}
+		/usr/bin echo readonly test && | printf && awk "$@"
+$(pwd) printf sed cd x=1 "$@" -eu /usr/bin
+grep awk sed "$1" test x=1 sed printf
+	done "$1" done /usr/bin readonly
+echo 2>/dev/null local 'quoted text'
+	-eu 'quoted text' readonly cd /usr/bin cd printf --verbose && x=1 && sed
+	echo "$@" "$1" $(pwd) $(pwd) test then readonly /usr/bin printf printf
+	/usr/bin local -eu export grep readonly local --verbose readonly
+	2>/dev/null done --verbose 'quoted text' awk printf | && local readonly awk printf
+"$1" "$@" x=1 ${HOME}
+2>/dev/null test /usr/bin done awk grep test grep 2>/dev/null local cd
+readonly test /usr/bin cd "$1" x=1 -eu x=1 echo -eu
+	-eu export x=1 then ${HOME}
+		/usr/bin ${HOME} 2>/dev/null 2>/dev/null local x=1 2>/dev/null local awk
+sed 'quoted text' grep test && export
+	2>/dev/null && ${HOME} test && grep readonly ${HOME} && $(pwd) && ${HOME}
+		printf echo sed done 2>/dev/null
+2>/dev/null 'quoted text' $(pwd) done local /usr/bin
+		done && x=1 -eu sed /usr/bin && sed /usr/bin
+	--verbose readonly sed "$1" test /usr/bin 2>/dev/null cd printf && ${HOME}
+'quoted text' sed | readonly sed
+		--verbose x=1 printf --verbose /usr/bin done | done export done
+	cd grep | sed test readonly /usr/bin -eu grep x=1 "$@" $(pwd) "$@" cd /usr/bin
+	test | then printf ${HOME} cd 2>/dev/null readonly | ${HOME}
+	printf --verbose readonly cd awk 2>/dev/null "$1" local
+'quoted text' -eu -eu echo grep
+		/usr/bin "$@" local 2>/dev/null "$1" | -eu ${HOME} ${HOME} ${HOME}
+	2>/dev/null test "$@" echo --verbose readonly 'quoted text' cd grep
+		export export --verbose grep awk
+		&& test sed && "$@" $(pwd) grep
+	grep "$1" | local test awk test /usr/bin local done
+done 'quoted text' && local 'quoted text' then echo printf "$@" -eu | printf
+local -eu local grep --verbose && sed readonly readonly printf export done
+printf then x=1 readonly grep /usr/bin /usr/bin grep /usr/bin /usr/bin
+echo 2>/dev/null done grep | x=1 test /usr/bin | done x=1 export | local readonly
+	--verbose export x=1 echo
+	grep export 'quoted text' $(pwd) cd --verbose
+		"$1" | ${HOME} --verbose grep &&
+${HOME} | 2>/dev/null grep $(pwd) printf then sed cd && sed
+	sed grep sed -eu $(pwd) echo sed x=1
+		cd /usr/bin cd test readonly then "$1" echo | | cd export
+		sed ${HOME} cd then local sed local 2>/dev/null
+	export echo printf $(pwd) export echo then readonly --verbose
+		${HOME} export 2>/dev/null 'quoted text' done && --verbose done awk x=1 -eu 'quoted text'
+		sed 'quoted text' grep readonly -eu then ${HOME} $(pwd) readonly awk cd &&
+	done then local "$1" readonly "$@" $(pwd) 2>/dev/null && x=1 "$1" && done
+2>/dev/null export | | printf echo 'quoted text' 'quoted text' printf
+		$(pwd) "$@" $(pwd) "$1" "$1" then then "$@" 2>/dev/null "$1"
+	/usr/bin x=1 $(pwd) cd 'quoted text' 2>/dev/null then x=1 $(pwd)
+		export x=1 && "$@" x=1 awk sed grep "$1" 2>/dev/null echo
+		then | -eu "$@" awk then "$1" awk cd /usr/bin /usr/bin 2>/dev/null printf
+done --verbose /usr/bin test x=1 then
+		/usr/bin ${HOME} "$@" --verbose x=1 2>/dev/null && -eu x=1
+		&& 'quoted text' echo "$1" | awk "$@" | 2>/dev/null
+		${HOME} --verbose test
+local grep sed -eu sed then echo x=1 export
+		grep "$1" | printf readonly /usr/bin
+awk --verbose | printf x=1 /usr/bin $(pwd) "$@" echo awk readonly
+| readonly awk --verbose x=1 cd test 'quoted text'
+	| grep printf echo x=1 x=1 ${HOME} 'quoted text' echo export awk
+done done test awk grep $(pwd) 2>/dev/null
+		/usr/bin /usr/bin x=1 2>/dev/null
+	$(pwd) local ${HOME} -eu grep --verbose
+		test readonly grep x=1
+&& export awk awk echo export grep "$@" $(pwd)
+		'quoted text' grep 'quoted text' local
+		--verbose printf && --verbose
+2>/dev/null /usr/bin 'quoted text' grep then --verbose
+then x=1 echo done "$1" export
+		&& grep grep test | && && 'quoted text' x=1 test
+		"$1" 2>/dev/null echo x=1 then export echo && /usr/bin
+	/usr/bin $(pwd) "$1" awk 'quoted text' export local grep -eu
+done awk echo then && readonly cd test cd awk cd |
+	--verbose $(pwd) 'quoted text' $(pwd) x=1 awk /usr/bin
+"$@" done cd 2>/dev/null && grep
+	local /usr/bin ${HOME} local -eu local 2>/dev/null
+-eu test 2>/dev/null --verbose
+	echo /usr/bin | awk cd && x=1 $(pwd)
+		then $(pwd) --verbose -eu "$@" "$1" cd sed test 'quoted text'
+		&& export /usr/bin $(pwd) /usr/bin awk readonly
+		test test local cd awk 'quoted text'
+	local $(pwd) local --verbose readonly then export
+	/usr/bin $(pwd) grep echo /usr/bin 'quoted text'
+		| "$1" "$1" sed 2>/dev/null -eu | $(pwd) 'quoted text'
+	'quoted text' printf local | local | then | /usr/bin export printf awk ${HOME}
+	awk awk echo local $(pwd) && /usr/bin sed --verbose cd
+	echo $(pwd) cd cd "$1" sed then "$@"
+	-eu && x=1 echo | /usr/bin --verbose 'quoted text' && ${HOME} && printf test
+		| | -eu | awk && printf
+"$@" readonly && "$1" done $(pwd) ${HOME} done "$@" 'quoted text'
+/usr/bin 2>/dev/null awk awk "$@" $(pwd) "$@" then x=1 local sed 2>/dev/null then
+		2>/dev/null x=1 awk echo --verbose
+	--verbose sed "$@" $(pwd) $(pwd)
+		done $(pwd) export ${HOME} export "$1" cd x=1 -eu -eu && then
+		readonly awk -eu then && test test 2>/dev/null echo export "$1" printf
+"$@" export $(pwd) 2>/dev/null awk echo -eu cd echo | &&
+local "$@" --verbose /usr/bin
+done "$@" --verbose "$@" export
+$(pwd) | done -eu | printf cd grep local 2>/dev/null
+		cd ${HOME} awk test |
+	sed done x=1 awk cd "$1" then "$1" && 'quoted text'
+		$(pwd) readonly readonly | /usr/bin cd && sed grep local grep $(pwd)
+	export local echo 'quoted text' |
+/usr/bin sed 'quoted text' 'quoted text'
+		readonly local 'quoted text'
+		local 'quoted text' test 2>/dev/null
+"$1" 2>/dev/null --verbose cd test "$@" cd sed "$1" echo && /usr/bin ${HOME}
+		cd "$@" sed 'quoted text' printf echo grep then grep grep
+"$@" -eu 2>/dev/null printf cd | grep
+printf 'quoted text' sed 'quoted text' echo $(pwd) test /usr/bin ${HOME}
+	${HOME} "$1" x=1 awk local then "$1" "$@" test printf
+	$(pwd) 'quoted text' grep
+		${HOME} /usr/bin readonly "$@"
+		2>/dev/null echo done cd ${HOME} -eu --verbose 'quoted text'
+$(pwd) /usr/bin cd $(pwd) echo awk $(pwd) printf
+		printf $(pwd) x=1 export -eu grep /usr/bin "$1"
+2>/dev/null export "$@" grep
+		awk echo -eu echo grep 2>/dev/null "$1" 'quoted text' && export echo
+		cd "$1" -eu && printf readonly 2>/dev/null cd -eu printf grep
+local then 2>/dev/null local sed 2>/dev/null done local echo
+	printf readonly readonly $(pwd) "$1" x=1 awk
+	test -eu 'quoted text' export then printf done echo
+	test "$@" printf && $(pwd) echo echo && -eu x=1 2>/dev/null
+	test "$@" 2>/dev/null echo 2>/dev/null awk && 2>/dev/null
+/usr/bin grep readonly 2>/dev/null /usr/bin
+&& echo then "$@" x=1 test export printf /usr/bin
+	'quoted text' 2>/dev/null $(pwd) sed x=1 |
+	cd done done $(pwd) --verbose --verbose readonly /usr/bin export ${HOME} cd
+"$1" grep 2>/dev/null export 'quoted text'
+	x=1 readonly awk -eu 'quoted text' grep x=1 "$@"
+		echo export | echo awk awk done x=1 test 2>/dev/null --verbose 2>/dev/null
+	"$@" readonly "$1" "$@" export -eu 'quoted text' done printf echo -eu "$1"
+		${HOME} ${HOME} done "$1" export then readonly done printf
+	/usr/bin ${HOME} | 2>/dev/null export echo done then export
+		x=1 grep grep grep sed then echo 'quoted text'
+		| ${HOME} then x=1 $(pwd) "$1" --verbose --verbose --verbose printf cd &&
+		sed awk | /usr/bin cd --verbose 'quoted text' sed | --verbose 'quoted text'
+test then | "$1" "$@" --verbose "$@"
+		local --verbose -eu "$1"
+	done sed grep awk /usr/bin export
+		| "$1" 2>/dev/null --verbose && ${HOME} done
+	/usr/bin grep cd done local grep
+	printf x=1 done /usr/bin --verbose sed 2>/dev/null 2>/dev/null echo
+${HOME} | "$1" test | | sed echo
+	2>/dev/null readonly export done 'quoted text' readonly done
+	| cd local --verbose done -eu sed 'quoted text' -eu printf done
+		local 'quoted text' echo local
+		/usr/bin /usr/bin /usr/bin echo
+		grep -eu --verbose ${HOME} then && x=1 readonly done && sed cd x=1
+		echo -eu ${HOME} then grep test
+		printf sed ${HOME} printf ${HOME} | then ${HOME} --verbose && sed ${HOME}
+		"$1" 2>/dev/null echo export export grep cd ${HOME} test
+echo test "$@" grep x=1
+awk export awk done readonly local readonly printf
+		&& | cd test printf readonly cd grep -eu test sed /usr/bin ${HOME} "$@"
+	cd awk export readonly local cd awk $(pwd) readonly cd --verbose local ${HOME}
+test then --verbose "$1" ${HOME} test echo local awk test
+grep 'quoted text' /usr/bin | local echo -eu
+test grep "$1" -eu --verbose
+	awk /usr/bin "$@" printf
+export -eu 2>/dev/null ${HOME} sed sed local ${HOME} echo "$@" x=1 $(pwd)
+	"$@" --verbose test /usr/bin export awk sed local test 2>/dev/null
+		"$@" $(pwd) -eu 2>/dev/null local 2>/dev/null echo then then
+	--verbose "$1" readonly 'quoted text' awk export readonly $(pwd) /usr/bin
+awk $(pwd) && 'quoted text' done
+${HOME} "$1" /usr/bin export
+		$(pwd) 2>/dev/null $(pwd) $(pwd) x=1 then | /usr/bin printf
+		'quoted text' -eu --verbose
+	then awk printf && local
+cd printf export export /usr/bin
+	echo test --verbose && "$@"
+	--verbose then /usr/bin cd awk /usr/bin export awk "$1"
+		readonly awk awk --verbose test test "$@" local $(pwd) done
+		grep | "$@" done printf 2>/dev/null
+cd /usr/bin cd "$@" x=1 | --verbose | &&
+sed /usr/bin /usr/bin
+/usr/bin -eu cd export cd sed | 'quoted text' "$@" grep /usr/bin
+awk 'quoted text' $(pwd) 2>/dev/null && test /usr/bin
+	'quoted text' -eu 2>/dev/null test cd local -eu --verbose --verbose "$1" --verbose
+&& 'quoted text' | awk export --verbose done readonly done
+	test "$@" 'quoted text' | | printf | sed | 2>/dev/null readonly
+		$(pwd) x=1 test local sed 'quoted text' x=1
+		then && cd readonly x=1 "$1" /usr/bin cd awk x=1 -eu |
+		x=1 readonly grep printf printf cd --verbose awk --verbose grep sed then
+	cd --verbose awk 2>/dev/null | export | printf -eu readonly
+then local export local x=1 --verbose
+	| 2>/dev/null "$1" done grep --verbose
+--verbose "$1" done --verbose 'quoted text' grep test printf awk -eu test
+	grep done echo grep /usr/bin --verbose then "$1" readonly echo export
+		echo done && cd && done 2>/dev/null --verbose
+	-eu "$@" /usr/bin done printf "$@" done printf printf then "$1" "$@"
+	$(pwd) 'quoted text' test x=1 'quoted text' /usr/bin
+	"$@" | $(pwd) readonly local "$@" | $(pwd) test cd && test printf "$@" then
+awk && done readonly 2>/dev/null printf
+x=1 done grep "$1" x=1 test export test awk x=1 && readonly && cd echo awk
@@ -0,0 +1,2001 @@
+		then done 'quoted text'
+	--verbose ${HOME} then x=1 -eu 2>/dev/null "$@" --verbose export --verbose
+	grep local | /usr/bin readonly /usr/bin done grep
+| && /usr/bin sed cd "$@" ${HOME} done export
+test /usr/bin done 2>/dev/null && "$@" printf sed -eu "$1" $(pwd) done readonly
+		echo then | cd "$1" sed /usr/bin -eu cd "$@" test $(pwd) 2>/dev/null test
+		${HOME} export done cd awk done /usr/bin grep sed done done /usr/bin
+	-eu | --verbose awk then ${HOME}
+		"$1" 2>/dev/null 'quoted text' local | grep export
+then grep --verbose awk | "$@" sed -eu
+	sed ${HOME} && printf local sed test done && grep
+		| -eu local local ${HOME} ${HOME} /usr/bin && && test 'quoted text'
+	x=1 --verbose 'quoted text' -eu printf ${HOME} "$1" then | printf cd 'quoted text'
+'quoted text' -eu x=1 grep 2>/dev/null export printf export
+readonly x=1 then ${HOME} 'quoted text' "$1" cd local grep x=1 awk 'quoted text'
+${HOME} local grep "$1" then -eu
+		&& 'quoted text' readonly awk awk awk /usr/bin then done
+	"$@" && $(pwd) echo && local readonly test "$@" | cd
+"$1" /usr/bin done "$1" awk 2>/dev/null -eu sed then -eu $(pwd)
+		export printf export x=1 echo -eu /usr/bin done
+		"$1" local cd $(pwd) && sed awk readonly &&
+		export awk awk test --verbose grep "$@"
+done readonly grep printf
+	readonly /usr/bin cd --verbose readonly sed $(pwd) /usr/bin
+		cd ${HOME} done | "$@" x=1 "$1" && echo grep awk -eu && | printf |
+		x=1 awk ${HOME} /usr/bin done x=1
+	&& /usr/bin awk 2>/dev/null done /usr/bin "$1" | 2>/dev/null grep -eu && cd
+--verbose x=1 local export test readonly sed grep x=1 then 'quoted text'
+"$@" -eu then x=1 then cd sed -eu
+		--verbose && test readonly | /usr/bin 'quoted text' 'quoted text' cd 'quoted text'
+	done readonly awk -eu awk then && grep test printf export -eu grep local
+		echo 2>/dev/null 'quoted text' -eu 'quoted text' "$@" done "$@" -eu -eu
+	test sed cd $(pwd) -eu sed --verbose awk 2>/dev/null ${HOME} -eu "$1"
+		${HOME} --verbose test sed then test grep $(pwd) "$@" awk sed
+-eu then 2>/dev/null -eu && /usr/bin sed export "$1" x=1 "$1" then
+	awk cd readonly readonly --verbose
+	done x=1 && 'quoted text' --verbose
+		done readonly export
+then sed --verbose done "$1" test awk echo && ${HOME} -eu awk grep
+	&& readonly "$@" ${HOME} --verbose
+	"$@" && done x=1 sed --verbose
+		$(pwd) --verbose readonly echo
+--verbose test $(pwd) 'quoted text' "$@" 'quoted text'
+		"$@" | local readonly echo /usr/bin
+		then echo --verbose awk test grep test
+	then /usr/bin ${HOME} local cd awk local 'quoted text'
+		'quoted text' --verbose ${HOME} then
+		awk echo readonly /usr/bin --verbose 2>/dev/null readonly export then $(pwd)
+	x=1 readonly $(pwd) grep
+	&& grep | echo test echo
+		local ${HOME} $(pwd) test --verbose
+/usr/bin x=1 -eu "$1"
+		export local 'quoted text' then --verbose
+/usr/bin done grep export x=1 grep x=1 && done grep ${HOME} x=1 printf
+		sed 2>/dev/null export "$@" echo ${HOME} "$@"
+&& $(pwd) x=1 then 2>/dev/null awk awk grep export
+awk $(pwd) $(pwd) done test
+	local ${HOME} $(pwd) "$@" sed then echo printf export
+		x=1 awk "$1" /usr/bin
+	echo "$@" $(pwd) cd | export
+		2>/dev/null 2>/dev/null "$1" /usr/bin ${HOME} awk | x=1 -eu &&
+2>/dev/null | /usr/bin
+	readonly "$1" local local | readonly
+		-eu 'quoted text' readonly then ${HOME} printf x=1 readonly then awk
+	printf done export grep grep local 'quoted text' $(pwd) x=1 cd printf /usr/bin "$@"
+local cd cd then awk cd printf "$1" echo 'quoted text'
+	"$@" && "$1" cd awk 2>/dev/null 'quoted text' ${HOME} echo
+	| local ${HOME} ${HOME}
+then 2>/dev/null awk 2>/dev/null printf cd | 2>/dev/null grep
+		"$1" x=1 ${HOME} grep test cd sed local grep
+	sed 'quoted text' local -eu && $(pwd)
+local 'quoted text' local cd sed x=1 --verbose | $(pwd) | && "$1" x=1
+		2>/dev/null then sed test then export
+"$1" test sed ${HOME} printf readonly printf export
+	/usr/bin echo done $(pwd) readonly
+	grep && /usr/bin test cd "$1" -eu -eu
+	then 2>/dev/null --verbose then then grep ${HOME} --verbose grep test
+	2>/dev/null printf 2>/dev/null awk ${HOME} --verbose
+| ${HOME} test "$1" "$@" printf then | /usr/bin ${HOME} 'quoted text'
+x=1 readonly 2>/dev/null
+	export then grep 2>/dev/null printf | readonly "$@"
+	&& sed awk awk "$1" -eu
+		${HOME} echo 2>/dev/null readonly $(pwd) | sed awk local
+	-eu printf && sed sed done 'quoted text' awk readonly awk "$1" echo grep then
+	printf --verbose $(pwd) readonly
+	/usr/bin awk echo ${HOME} readonly "$@" awk -eu done
+printf $(pwd) cd test printf printf --verbose
+		x=1 2>/dev/null 'quoted text' /usr/bin "$@" local export $(pwd) && echo echo
+grep /usr/bin | x=1 'quoted text' ${HOME} done printf --verbose
+${HOME} -eu "$@" 'quoted text'
+		test 'quoted text' export printf -eu test --verbose && --verbose $(pwd)
+	$(pwd) sed readonly ${HOME}
+export printf export 'quoted text' $(pwd) $(pwd) 2>/dev/null
+local | done -eu readonly readonly
+	-eu then ${HOME} local cd && 2>/dev/null local "$@" --verbose done &&
+echo printf -eu cd x=1 "$@" echo then --verbose test "$@" local test
+/usr/bin done sed readonly $(pwd)
+local ${HOME} test "$@" 'quoted text' $(pwd)
+awk ${HOME} x=1 2>/dev/null test | -eu -eu --verbose --verbose awk /usr/bin echo
+awk ${HOME} test "$1" "$1" export 2>/dev/null $(pwd) 2>/dev/null
+	"$@" done test printf x=1 sed cd && awk awk export then "$1"
+"$1" /usr/bin "$@" 'quoted text' 2>/dev/null sed $(pwd) local grep 'quoted text'
+/usr/bin 2>/dev/null | then "$1" && --verbose /usr/bin
+$(pwd) "$@" 'quoted text' then echo then awk -eu sed $(pwd) 'quoted text' echo
+	export done printf | &&
+| /usr/bin printf cd echo readonly | --verbose local $(pwd) sed
+	&& then "$1" "$@" ${HOME} $(pwd) "$1" cd echo "$1"
+		local local && "$@" /usr/bin | x=1 2>/dev/null test printf -eu test
+/usr/bin --verbose x=1 2>/dev/null 2>/dev/null
+	"$1" then done /usr/bin | ${HOME} then --verbose 2>/dev/null
+&& cd then --verbose /usr/bin awk /usr/bin -eu sed -eu awk local
+		--verbose printf local "$@" test awk 'quoted text' && | readonly
+	&& test x=1 x=1 && echo test x=1 done --verbose done /usr/bin awk local
+	$(pwd) "$@" -eu 2>/dev/null /usr/bin test && && test | echo test --verbose
+		export readonly done /usr/bin grep readonly ${HOME} echo local sed "$@" ${HOME}
+		test -eu -eu "$1" -eu $(pwd)
+	then done awk awk 2>/dev/null local "$@" test ${HOME}
+		/usr/bin -eu test awk x=1 done awk sed test
+	grep ${HOME} then awk printf -eu readonly
+grep cd then local local $(pwd) $(pwd) | grep $(pwd) | $(pwd) /usr/bin
+	"$1" "$@" printf && 2>/dev/null local
+		grep cd $(pwd) /usr/bin echo /usr/bin sed -eu | ${HOME} echo grep
+		--verbose /usr/bin readonly /usr/bin echo x=1 'quoted text'
+	grep echo printf "$1" --verbose done done | ${HOME} $(pwd)
+	$(pwd) --verbose awk export ${HOME} $(pwd) "$1" awk awk awk -eu x=1 done
+		local export awk cd 2>/dev/null -eu then test "$1" 2>/dev/null
+echo sed export "$1" --verbose
+readonly x=1 -eu --verbose "$1"
+done then "$1" --verbose "$@" done 2>/dev/null
+	export done local printf $(pwd) grep test "$1" && && awk printf export echo
+		test | sed ${HOME} sed sed $(pwd) local --verbose grep export /usr/bin sed printf
+		awk cd awk 'quoted text' "$1" "$@" awk export grep
+-eu ${HOME} 'quoted text' then 'quoted text' $(pwd) -eu then "$@"
+		printf printf echo ${HOME} $(pwd) local | "$@"
+		"$@" 2>/dev/null 'quoted text' cd ${HOME} && local echo | readonly -eu export $(pwd)
+		readonly "$1" 'quoted text' readonly done
+	awk done 2>/dev/null "$@" grep echo local readonly
+	'quoted text' 'quoted text' printf --verbose 'quoted text' awk done 2>/dev/null
+	local grep -eu echo printf "$@" printf awk $(pwd) local
+	awk 2>/dev/null $(pwd) | cd "$1"
+then -eu -eu local awk grep echo printf grep 'quoted text' ${HOME} /usr/bin
+		test 2>/dev/null done grep "$@"
+x=1 awk local export ${HOME} | ${HOME} then 2>/dev/null --verbose --verbose
+	--verbose export -eu then printf export printf "$@"
+		local printf done printf sed done then test local
+'quoted text' printf readonly "$1" done && $(pwd) then 2>/dev/null export
+--verbose sed && 'quoted text'
+	$(pwd) "$@" done 2>/dev/null sed --verbose then
+	&& ${HOME} cd local $(pwd) printf x=1 2>/dev/null printf readonly
+grep grep echo export
+	export 2>/dev/null 'quoted text' --verbose
+export export done printf local ${HOME} echo then 2>/dev/null
+grep sed $(pwd) printf "$1" echo local then | /usr/bin ${HOME}
+	echo awk printf ${HOME} 'quoted text' ${HOME} grep done readonly |
+		${HOME} awk awk readonly test done cd
+		x=1 /usr/bin grep local export awk 'quoted text'
+	grep sed echo echo local export
+grep -eu | printf echo cd /usr/bin "$1" echo export && ${HOME} readonly | printf
+		-eu "$1" "$1" 'quoted text'
+done awk cd export /usr/bin &&
+	"$@" readonly readonly --verbose
+awk readonly done then
+		x=1 then /usr/bin $(pwd) awk && $(pwd) printf
+		2>/dev/null then -eu done then printf sed /usr/bin grep -eu
+done cd "$@" x=1 printf | local | then "$@" | grep && awk /usr/bin grep -eu
+then && local readonly grep ${HOME} cd grep sed echo echo $(pwd) printf awk
+		$(pwd) local x=1 "$@" --verbose grep -eu grep ${HOME}
+		done readonly done export -eu "$@"
+x=1 -eu then sed printf done /usr/bin -eu | | then awk echo
+		"$@" readonly ${HOME} echo then
+	$(pwd) && --verbose test "$@"
+"$@" awk ${HOME} awk done done /usr/bin export
+"$@" export grep export --verbose && local sed then /usr/bin
+		$(pwd) $(pwd) printf then echo done $(pwd) -eu && then
+"$1" sed x=1 grep 2>/dev/null
+	sed awk done -eu local awk local echo x=1 export x=1 then -eu
+test echo readonly $(pwd) "$@"
+		2>/dev/null echo export "$@" && export
+2>/dev/null printf awk sed -eu
+x=1 printf echo local printf echo ${HOME} -eu "$1" cd
+local done $(pwd) "$1" /usr/bin "$1" then awk
+		printf readonly 'quoted text' /usr/bin 'quoted text'
+		/usr/bin "$1" cd 'quoted text'
+	echo && test awk sed awk x=1 done then awk ${HOME} awk export 2>/dev/null export
+x=1 ${HOME} echo /usr/bin 'quoted text' then -eu x=1 awk
+		grep 'quoted text' then -eu echo "$1" && -eu /usr/bin 'quoted text'
+echo "$1" x=1 "$1" echo 'quoted text' "$@"
+	&& | done awk awk printf "$1" ${HOME} 'quoted text' -eu 2>/dev/null
+	"$1" $(pwd) printf sed readonly -eu $(pwd)
+		/usr/bin cd "$@" "$@" grep 'quoted text' printf echo -eu
+		&& printf "$@" $(pwd) echo
+		&& awk local printf echo -eu 'quoted text' local printf
+cd awk awk 2>/dev/null test echo cd printf export
+echo echo $(pwd) 2>/dev/null -eu cd echo printf echo done awk readonly echo
+	sed cd -eu export local readonly
+--verbose x=1 "$@" sed ${HOME} /usr/bin | done test local awk grep cd "$@"
+grep && ${HOME} 2>/dev/null x=1 x=1 ${HOME} export
+		2>/dev/null cd --verbose "$@" then then echo awk "$1" test x=1 "$1" "$@"
+	local cd then grep && done then printf | x=1 printf then ${HOME} cd
+x=1 then echo 2>/dev/null grep "$1"
+	2>/dev/null | test -eu export --verbose --verbose
+	printf readonly sed test $(pwd) test test && "$1" awk | | && echo 'quoted text'
+		"$@" grep 2>/dev/null --verbose 'quoted text' |
+	"$1" -eu --verbose x=1 grep "$1" --verbose $(pwd)
+then sed printf ${HOME} awk test | && "$@" echo sed $(pwd)
+	then awk 'quoted text' done local export sed "$@" grep | 'quoted text' export
+	-eu then test test /usr/bin readonly ${HOME} grep printf && cd
+	/usr/bin echo echo export "$@"
+		--verbose sed -eu | sed readonly x=1 done export
+done $(pwd) && export test local
+		printf -eu x=1 /usr/bin ${HOME} /usr/bin
+	then sed "$@" grep export x=1 $(pwd) local 2>/dev/null ${HOME}
+x=1 printf "$@" /usr/bin
+		readonly x=1 | x=1 'quoted text'
+		-eu | ${HOME} printf test sed
+		then $(pwd) sed -eu "$1" 'quoted text' -eu
+	test awk | done grep export cd -eu $(pwd) | printf then grep $(pwd)
+	cd x=1 local && ${HOME} x=1 grep 'quoted text' --verbose sed 2>/dev/null
+	cd /usr/bin test -eu | --verbose awk sed /usr/bin 'quoted text'
+	awk test --verbose then grep -eu $(pwd)
+		local echo --verbose $(pwd) ${HOME} && -eu sed printf "$1" grep
+	sed $(pwd) cd | $(pwd) --verbose | $(pwd) "$1" echo /usr/bin
+| 'quoted text' awk --verbose "$@" --verbose
+	test -eu echo "$1" sed $(pwd) readonly
+	$(pwd) echo test "$1" awk export cd x=1 x=1
+		$(pwd) test && printf test awk ${HOME}
+	"$@" -eu /usr/bin export export --verbose 2>/dev/null /usr/bin
+-eu echo printf test readonly x=1 local awk
+		awk echo 2>/dev/null --verbose then readonly test ${HOME}
+2>/dev/null 2>/dev/null 2>/dev/null cd $(pwd) --verbose
+	readonly export readonly done awk export /usr/bin
+		export done -eu 'quoted text' export x=1 'quoted text' cd cd $(pwd) grep 'quoted text'
+then local test 2>/dev/null "$1" 'quoted text'
+	printf done done && export
+x=1 printf 2>/dev/null "$@" test -eu cd awk then ${HOME} done
+2>/dev/null ${HOME} readonly export done done echo "$@" sed ${HOME} $(pwd)
+	'quoted text' "$@" 'quoted text' printf "$@" 'quoted text' 'quoted text' readonly
+		'quoted text' test 2>/dev/null export test -eu cd grep /usr/bin
+		grep local --verbose echo grep -eu 'quoted text'
+		test then local "$1" test awk | test x=1 /usr/bin cd -eu x=1 then x=1 ${HOME}
+	$(pwd) done grep done printf sed sed local 2>/dev/null x=1 test test cd
+	/usr/bin local ${HOME} export awk then --verbose /usr/bin
+	"$1" sed 'quoted text'
+		-eu ${HOME} ${HOME} then --verbose sed then /usr/bin awk readonly -eu printf
+printf local readonly /usr/bin sed -eu readonly | -eu -eu 'quoted text' &&
+	/usr/bin grep "$1" x=1
+		${HOME} export cd ${HOME} && &&
+	$(pwd) readonly | x=1 cd printf readonly echo sed readonly awk then
+printf 'quoted text' | cd "$@" export test -eu local
+'quoted text' x=1 echo
+		| test x=1 printf 2>/dev/null /usr/bin readonly local awk /usr/bin
+		echo "$@" 2>/dev/null -eu printf --verbose x=1 2>/dev/null $(pwd)
+		--verbose -eu export "$1" "$1" -eu
+grep readonly sed "$@" test && sed awk && ${HOME} | sed && done "$@" -eu
+		local export --verbose "$@" awk printf readonly grep printf sed then x=1 ${HOME}
+printf $(pwd) x=1 echo test echo sed /usr/bin
+grep grep printf grep local
+export readonly x=1 grep && 'quoted text'
+	then ${HOME} -eu printf "$1" && cd test sed "$1"
+		export cd x=1 --verbose export $(pwd) sed readonly local echo
+		awk readonly sed done x=1
+cd export ${HOME} 2>/dev/null export
+	x=1 2>/dev/null cd then ${HOME} readonly readonly 2>/dev/null "$@"
+awk awk --verbose /usr/bin "$1"
+	"$@" done printf cd local done printf 2>/dev/null
+	/usr/bin $(pwd) $(pwd) then 'quoted text'
+	2>/dev/null "$@" x=1 local done test
+x=1 export readonly -eu grep 2>/dev/null --verbose done grep test readonly "$@"
+		test && cd 'quoted text' "$@"
+		sed test then $(pwd) grep readonly
+	sed --verbose echo printf cd echo ${HOME} "$@" done
+	-eu --verbose $(pwd) echo "$@" printf "$1" | readonly x=1 ${HOME} 2>/dev/null
+awk ${HOME} awk local "$@" $(pwd) /usr/bin
+sed done grep readonly $(pwd)
+awk export done printf grep grep printf
+	cd export $(pwd) "$@" grep 'quoted text' 'quoted text'
+readonly export ${HOME} $(pwd) readonly readonly
+$(pwd) $(pwd) readonly /usr/bin "$@"
+	'quoted text' test x=1 cd sed export "$1" x=1 ${HOME}
+		${HOME} then $(pwd) ${HOME} then | "$@" /usr/bin grep 2>/dev/null ${HOME}
+	--verbose cd then ${HOME} export "$1" test $(pwd) then 'quoted text' cd local
+	"$@" then done "$1" done -eu readonly printf readonly done x=1 x=1
+		-eu printf then then cd 'quoted text'
+	| | | grep "$@" | printf "$@" && readonly "$1" 'quoted text' echo printf awk then
+		x=1 ${HOME} -eu grep 'quoted text' --verbose readonly grep &&
+		--verbose readonly done $(pwd) | sed $(pwd) export
+	--verbose export printf then test sed -eu test "$1" printf "$@" $(pwd) -eu
+		local x=1 --verbose /usr/bin printf 2>/dev/null
+	'quoted text' printf 'quoted text' done |
+export && && x=1 "$@" grep | "$@" "$1"
+		awk sed local 'quoted text' 'quoted text'
+		done -eu 'quoted text' done /usr/bin
+readonly $(pwd) 2>/dev/null 'quoted text'
+	x=1 done echo /usr/bin
+		export "$1" echo sed done awk echo local 'quoted text' ${HOME}
+	awk /usr/bin awk sed | -eu -eu 2>/dev/null $(pwd) printf local printf
+		"$1" export $(pwd) awk grep awk "$1"
+sed 2>/dev/null /usr/bin x=1 export ${HOME}
+		sed export readonly | &&
+	printf x=1 x=1 cd 2>/dev/null readonly done awk grep ${HOME} $(pwd)
+		2>/dev/null local ${HOME} awk "$@" x=1 awk echo
+'quoted text' "$@" awk done x=1 done 2>/dev/null echo x=1 export
+x=1 awk 'quoted text' --verbose "$1" printf local 'quoted text' echo $(pwd) echo
+	awk sed then | readonly echo /usr/bin grep /usr/bin cd $(pwd)
+		-eu local --verbose "$1"
+done sed awk then printf
+		| awk echo local ${HOME}
+	echo "$1" readonly readonly local --verbose
+	-eu --verbose test local local ${HOME}
+	awk export then cd grep test /usr/bin | 2>/dev/null then | $(pwd)
+		grep test then -eu awk "$1" ${HOME} test && printf
+sed && printf "$@" local /usr/bin -eu grep echo
+	${HOME} -eu printf && ${HOME} --verbose "$@" $(pwd) "$@" "$@" printf
+		| export "$1" x=1 "$1" && awk cd then then
+		${HOME} sed "$1" grep printf echo done 2>/dev/null awk -eu
+x=1 then echo awk done && then test
+echo | local local export 2>/dev/null 2>/dev/null /usr/bin "$1" --verbose local
+	--verbose local 2>/dev/null "$@" | export done awk /usr/bin cd x=1 sed readonly
+	"$@" local 'quoted text'
+	test export echo ${HOME} export ${HOME} "$1" export done sed export
+		export readonly && done readonly grep 'quoted text' x=1 $(pwd) ${HOME}
+	sed | done --verbose 2>/dev/null
+readonly 2>/dev/null export | && | cd --verbose && ${HOME} local x=1
+x=1 "$1" /usr/bin cd sed 'quoted text'
+		done sed export "$@" 'quoted text' sed done 'quoted text'
+"$@" awk grep echo x=1 cd awk
+cd /usr/bin echo | test "$@" awk "$1" sed "$@"
+		grep --verbose | printf printf
+	printf printf cd local echo ${HOME} echo $(pwd) --verbose
+		$(pwd) /usr/bin 2>/dev/null
+		cd sed readonly -eu "$1" export done grep local echo
+		"$@" 2>/dev/null --verbose then 2>/dev/null
+		local export done awk done local echo && cd x=1
+	done done export grep readonly 2>/dev/null readonly export
+		grep then /usr/bin "$@" then readonly done x=1 | "$@" "$1"
+test cd readonly x=1 sed
+&& export && sed then echo ${HOME} done echo printf local
+	export $(pwd) test done $(pwd) echo "$@"
+		export sed local done /usr/bin export readonly
+		$(pwd) | test test local $(pwd) ${HOME} printf $(pwd) --verbose | cd cd echo
+"$1" cd sed "$1" then cd x=1 done then test $(pwd)
+	done "$1" then grep 'quoted text' echo done x=1 test done
+	awk cd /usr/bin && "$1" | ${HOME} test "$1" "$@" -eu ${HOME} done awk $(pwd)
+		grep 'quoted text' then export
+		done && "$@" "$1" | --verbose
+		echo local "$@" test 2>/dev/null done | sed echo ${HOME} awk x=1 && x=1
+		cd -eu test 'quoted text' printf 'quoted text' cd grep readonly 2>/dev/null
+${HOME} /usr/bin sed | && && export local "$@" export
+		grep echo ${HOME} done $(pwd) then "$1" printf "$1" echo && done sed ${HOME}
+	awk test -eu "$1" && sed
+	echo "$1" cd test 'quoted text' done
+'quoted text' sed "$1" 2>/dev/null readonly "$@" 'quoted text'
+		--verbose sed -eu readonly "$1" | && cd cd /usr/bin && 2>/dev/null "$@" $(pwd)
+		"$@" export test 'quoted text' "$1" x=1 $(pwd) "$1" test grep 2>/dev/null ${HOME}
+test echo printf ${HOME} test
+	sed test 2>/dev/null then grep local sed x=1 /usr/bin 2>/dev/null -eu
+		readonly "$@" ${HOME} x=1 cd && export | -eu 'quoted text' awk 'quoted text'
+| 2>/dev/null local export sed $(pwd) grep "$@" --verbose
+	"$@" x=1 readonly cd then "$1" $(pwd)
+	--verbose cd readonly export done done "$@" $(pwd) readonly 'quoted text'
+		${HOME} awk && 'quoted text' | sed 'quoted text'
+	export "$@" sed && && printf
+/usr/bin ${HOME} "$1" export ${HOME} -eu "$1" 2>/dev/null
+		'quoted text' x=1 $(pwd) 'quoted text' "$1" --verbose --verbose
+	grep grep 'quoted text' printf echo awk export
+done export $(pwd) --verbose
+	grep export --verbose local
+	"$@" && x=1 2>/dev/null export local x=1 cd test -eu cd | test --verbose
+	sed then "$@" "$1" echo sed local $(pwd) | --verbose ${HOME} echo
+awk 2>/dev/null local "$@" --verbose 2>/dev/null
+		awk cd export ${HOME} $(pwd) done x=1 "$1" sed export | test && done then
+${HOME} grep | echo --verbose $(pwd) sed printf
+		${HOME} "$@" then | grep
+	echo done sed printf 'quoted text'
+sed local 2>/dev/null -eu "$1" x=1 test done test awk local -eu local then --verbose
+	local && | --verbose export ${HOME} grep --verbose
+		sed --verbose && printf export
+		printf readonly echo "$@" awk sed /usr/bin
+echo export printf "$@" x=1 | printf
+		--verbose done 2>/dev/null
+done | grep ${HOME} grep printf 'quoted text' test export sed
+		'quoted text' ${HOME} "$1" then -eu /usr/bin -eu -eu 2>/dev/null
+done grep "$@" --verbose sed done
+	"$@" cd 'quoted text' done test cd test printf test --verbose -eu printf "$1" /usr/bin
+		sed test "$1" /usr/bin $(pwd) echo -eu x=1 2>/dev/null --verbose done "$@"
+	| $(pwd) && local done sed "$1" sed
+		sed sed "$@" /usr/bin && export "$@" sed export -eu echo done
+	${HOME} 2>/dev/null --verbose $(pwd) echo grep export 'quoted text' local
+local | $(pwd) 2>/dev/null done done printf echo $(pwd) ${HOME}
+		2>/dev/null | local /usr/bin $(pwd) sed local
+2>/dev/null done readonly x=1 "$1" /usr/bin cd ${HOME} awk && cd "$1" $(pwd)
+	cd ${HOME} --verbose done then cd 2>/dev/null then "$@" $(pwd)
+-eu && done printf "$@" /usr/bin $(pwd)
+	-eu grep printf | cd | 'quoted text' x=1 "$@" then awk printf
+		x=1 printf x=1 "$1" && printf local /usr/bin "$@" /usr/bin
+'quoted text' -eu 2>/dev/null 'quoted text' /usr/bin -eu 'quoted text'
+		$(pwd) printf test --verbose --verbose &&
+		echo 'quoted text' -eu local cd /usr/bin awk && 2>/dev/null sed ${HOME}
+test --verbose ${HOME} export /usr/bin then "$1" awk --verbose x=1 x=1 /usr/bin
+		done sed echo cd then x=1 "$1" cd x=1 test then export sed 'quoted text'
+	readonly /usr/bin "$1" readonly
+		readonly -eu x=1 -eu test /usr/bin "$1" then && 'quoted text' | printf then
+		| $(pwd) 'quoted text' export $(pwd) cd ${HOME} "$1" | 2>/dev/null readonly sed
+		readonly grep 'quoted text' "$@" /usr/bin grep local 2>/dev/null
+done --verbose then "$1"
+		printf x=1 sed export grep done "$1" test grep
+		&& 2>/dev/null /usr/bin $(pwd) readonly "$@" printf | "$@" $(pwd) 2>/dev/null
+		x=1 cd done then 'quoted text'
+		$(pwd) awk /usr/bin echo 'quoted text' -eu
+		x=1 test cd done x=1 --verbose "$1"
+readonly test 'quoted text' x=1 'quoted text' done local export sed 2>/dev/null
+"$1" "$1" cd grep | 'quoted text' 2>/dev/null
+	"$@" awk grep then done
+2>/dev/null 'quoted text' grep echo 'quoted text' test cd 2>/dev/null test ${HOME}
+		done 'quoted text' grep echo 2>/dev/null
+local "$1" "$@" 2>/dev/null ${HOME} ${HOME} done sed 'quoted text' && ${HOME}
+	cd && awk export grep "$1" grep sed export local x=1 export echo
+"$@" "$1" ${HOME} grep --verbose
+	--verbose cd && "$1" test --verbose ${HOME} test then
+		awk /usr/bin sed --verbose printf "$@" done test
+readonly -eu && sed export echo then
+		readonly $(pwd) 'quoted text' sed echo 'quoted text'
+		'quoted text' x=1 ${HOME} printf 2>/dev/null 'quoted text' && grep -eu test
+| test /usr/bin | export then
+	test $(pwd) x=1 local printf done
+		readonly printf then 2>/dev/null
+	printf && readonly sed test ${HOME} export
+	test cd echo 2>/dev/null 2>/dev/null
+| && echo printf 2>/dev/null
+	x=1 'quoted text' 'quoted text' 'quoted text' /usr/bin | awk cd readonly sed 2>/dev/null
+-eu /usr/bin done grep 'quoted text' /usr/bin cd --verbose
+	'quoted text' done local --verbose 2>/dev/null
+	export echo | echo grep
+	export test grep ${HOME} done printf "$@" done printf 2>/dev/null
+		cd "$1" test done sed readonly
+	/usr/bin /usr/bin ${HOME}
+	$(pwd) done awk done "$1" x=1 -eu 'quoted text' echo $(pwd) sed -eu
+		--verbose cd "$@" readonly awk local && $(pwd) /usr/bin &&
+&& 2>/dev/null /usr/bin | &&
+	local x=1 readonly printf -eu --verbose
+	readonly grep "$@" done test done readonly awk
+	echo then "$1" | 'quoted text' /usr/bin then local export sed
+		local test done "$1" 2>/dev/null ${HOME} readonly
+		grep local $(pwd) sed
+		"$@" $(pwd) local readonly
+grep local readonly 'quoted text' x=1 local
+		| cd ${HOME} "$1" done test echo 'quoted text' 'quoted text' "$1"
+	readonly sed x=1 printf 'quoted text' "$1" 'quoted text' ${HOME} test
+		local test 'quoted text' ${HOME} 'quoted text' ${HOME}
+sed readonly cd awk then awk awk readonly
+--verbose 2>/dev/null sed test "$@" /usr/bin awk awk echo awk
+		/usr/bin $(pwd) --verbose done 2>/dev/null
+cd ${HOME} /usr/bin --verbose 'quoted text' x=1 sed readonly /usr/bin 2>/dev/null
+	&& done awk "$1" $(pwd) export $(pwd) awk 'quoted text'
+		'quoted text' local x=1 done readonly
+awk -eu then $(pwd) sed /usr/bin
+--verbose "$@" then sed readonly local readonly "$1" printf && cd test x=1 grep
+	--verbose --verbose printf
+grep local | readonly ${HOME} done
+	"$@" export $(pwd) awk local printf export
+		&& printf printf readonly && grep 2>/dev/null
+	"$1" done printf ${HOME}
+${HOME} /usr/bin then
+		echo x=1 ${HOME} && $(pwd) awk awk grep --verbose test printf local 'quoted text'
+--verbose x=1 && -eu --verbose
+	cd cd echo local "$@"
+	"$@" x=1 x=1 done "$1" 2>/dev/null
+then echo test printf 'quoted text'
+"$1" --verbose $(pwd) test test test local printf x=1 export awk 'quoted text'
+	/usr/bin "$1" test /usr/bin | "$1" "$1" readonly /usr/bin
+	x=1 x=1 x=1 echo sed x=1 2>/dev/null
+		-eu then export readonly local
+		done "$1" awk printf x=1
+		| awk echo /usr/bin --verbose readonly test x=1 "$1" then done
+grep sed done "$1" test 2>/dev/null done ${HOME} done
+x=1 then printf readonly test then /usr/bin ${HOME} awk
+		grep local readonly then | ${HOME} "$@"
+	&& local ${HOME} readonly sed printf grep
+		"$@" --verbose local sed | $(pwd)
+	local then test grep 2>/dev/null
+		test done printf x=1 grep x=1 done | x=1 x=1 test /usr/bin printf cd
+		/usr/bin readonly "$1" local awk && cd sed | $(pwd) 2>/dev/null $(pwd) "$@" awk
+		--verbose ${HOME} "$1" "$@" test readonly cd ${HOME} "$1" grep sed awk 2>/dev/null
+		done $(pwd) --verbose cd /usr/bin 'quoted text' awk
+then done --verbose local sed test ${HOME} | | local
+&& done ${HOME} printf | x=1 done x=1 --verbose
+	-eu && 2>/dev/null x=1 printf grep | 'quoted text' | awk x=1 && then $(pwd) grep
+	export 'quoted text' "$@" --verbose
+"$@" awk done cd test /usr/bin printf
+test readonly && test ${HOME}
+		${HOME} test then awk printf done echo 'quoted text' /usr/bin then awk done
+	-eu "$1" 'quoted text' /usr/bin
+	readonly x=1 "$@" "$@" x=1 test done local /usr/bin --verbose local -eu awk | cd
+	then printf local 2>/dev/null cd $(pwd) sed
+	grep export /usr/bin echo "$@" cd printf
+		sed x=1 awk done "$@" "$@" "$1" 'quoted text' test local
+		&& "$@" "$1" readonly local /usr/bin $(pwd) |
+&& local cd readonly printf 2>/dev/null $(pwd) --verbose 2>/dev/null
+	"$1" ${HOME} ${HOME} 'quoted text'
+		readonly "$@" printf 'quoted text'
+	'quoted text' test sed export readonly 'quoted text'
+	readonly readonly -eu awk /usr/bin printf --verbose "$@" local grep -eu 'quoted text'
+	done "$1" grep export readonly "$1" echo "$1" $(pwd) "$1" "$1"
+printf sed 'quoted text' ${HOME} x=1
+		awk cd x=1 2>/dev/null export printf x=1
+	2>/dev/null then 2>/dev/null echo export test "$1" then printf x=1 x=1 2>/dev/null
+		--verbose cd cd && --verbose
+	readonly $(pwd) readonly "$@"
+	&& && then awk done export readonly "$1" printf 'quoted text'
+2>/dev/null 'quoted text' export printf
+	echo awk x=1 awk then done /usr/bin x=1 sed echo readonly /usr/bin grep awk
+		sed sed done 2>/dev/null $(pwd) x=1 test
+printf 'quoted text' && awk readonly cd done test 2>/dev/null
+--verbose awk /usr/bin grep && && -eu cd awk
+	${HOME} printf 'quoted text' test printf && cd cd cd
+	sed cd "$1" echo 'quoted text'
+		local x=1 ${HOME} grep x=1
+		export /usr/bin -eu && echo
+		--verbose 'quoted text' "$1" echo printf echo sed
+	2>/dev/null 2>/dev/null then 'quoted text' sed
+	readonly local "$@" export -eu
+		cd $(pwd) awk printf then /usr/bin "$@" | ${HOME} done echo "$1" --verbose then
+	export 2>/dev/null ${HOME} 'quoted text' x=1 done | cd --verbose x=1 printf test
+		echo 'quoted text' "$@"
+		x=1 readonly 'quoted text' readonly 2>/dev/null echo
+	${HOME} -eu then -eu sed | "$1" | awk export echo "$1" --verbose
+	x=1 /usr/bin then cd x=1 --verbose awk
+	"$@" "$1" awk 2>/dev/null 'quoted text' "$@" export done /usr/bin
+echo ${HOME} echo ${HOME} done echo | done 'quoted text'
+		'quoted text' "$@" /usr/bin
+	sed then -eu 2>/dev/null echo "$1" cd sed test readonly | 2>/dev/null 'quoted text'
+		&& x=1 'quoted text' x=1 --verbose sed ${HOME} | x=1 "$@" done
+export ${HOME} grep --verbose | ${HOME} then readonly then local
+grep cd sed 'quoted text' x=1 --verbose |
+		echo then echo then 2>/dev/null readonly printf | cd then printf && export readonly
+		${HOME} --verbose cd $(pwd) 'quoted text' x=1 test &&
+		'quoted text' /usr/bin done echo grep $(pwd) $(pwd) /usr/bin
+	"$@" then "$@" cd sed then export 'quoted text' printf readonly
+readonly 'quoted text' grep grep --verbose
+		"$1" 'quoted text' readonly echo 2>/dev/null cd readonly
+	cd x=1 && "$1" $(pwd) 2>/dev/null
+		echo /usr/bin readonly "$1" | echo
+		echo then readonly then ${HOME}
+	test then readonly printf "$1"
+${HOME} --verbose --verbose /usr/bin test
+readonly && printf --verbose &&
+	export readonly 'quoted text' cd 'quoted text'
+		done printf then 'quoted text' echo test
+sed export test 2>/dev/null export readonly
+grep 2>/dev/null x=1 --verbose && /usr/bin
+		$(pwd) readonly sed 'quoted text' "$1" --verbose --verbose
+		$(pwd) ${HOME} done x=1 /usr/bin readonly cd x=1 2>/dev/null
+		printf grep echo $(pwd) done sed echo echo test sed "$1" then
+		-eu "$@" grep test x=1 sed test "$@" readonly
+grep $(pwd) "$@" sed "$@" echo then local done
+--verbose awk awk sed local then done ${HOME} printf then x=1
+	grep awk echo && awk "$@" awk "$@" && export awk 2>/dev/null "$@" printf
+		${HOME} sed then /usr/bin 2>/dev/null && ${HOME} test
+	"$@" readonly 'quoted text'
+local sed 'quoted text'
+	then | "$1" sed | "$1"
+	echo ${HOME} /usr/bin && 2>/dev/null
+export readonly printf "$@" $(pwd) && sed
+	sed -eu readonly sed --verbose 'quoted text' done cd | | -eu 2>/dev/null readonly
+	cd readonly "$1" && | $(pwd) sed
+awk export local /usr/bin "$@" cd "$1" 2>/dev/null awk -eu 2>/dev/null /usr/bin
+2>/dev/null "$1" then sed test 2>/dev/null printf then 'quoted text'
+	"$@" 2>/dev/null ${HOME} then done &&
+		&& x=1 echo cd 2>/dev/null
+test then echo awk /usr/bin && ${HOME} 2>/dev/null $(pwd) then readonly
+		awk -eu "$1" 2>/dev/null done "$@" grep echo 2>/dev/null
+		&& /usr/bin --verbose awk awk "$1" -eu export printf printf 2>/dev/null
+	$(pwd) --verbose sed ${HOME} "$@" |
+	test "$1" x=1 ${HOME} 'quoted text' printf 2>/dev/null && /usr/bin
+2>/dev/null local echo test ${HOME} -eu echo sed awk printf
+	'quoted text' $(pwd) printf x=1 2>/dev/null $(pwd) sed sed then
+/usr/bin 2>/dev/null test local $(pwd) "$@" local export
+	/usr/bin local grep printf
+grep 2>/dev/null test grep grep sed 2>/dev/null -eu 'quoted text' cd cd
+		sed --verbose sed $(pwd) awk done /usr/bin sed ${HOME} ${HOME}
+${HOME} printf "$1" printf cd printf awk grep readonly sed export $(pwd)
+--verbose --verbose && readonly printf "$1" 2>/dev/null -eu $(pwd)
+		x=1 'quoted text' then "$@" && then
+	readonly then cd test --verbose test done
+${HOME} done then test --verbose | printf /usr/bin && then done then sed cd readonly
+readonly /usr/bin && 2>/dev/null
+echo && && x=1 "$1" "$@" && sed printf
+	$(pwd) | grep done "$1" -eu 'quoted text' ${HOME} awk
+/usr/bin 2>/dev/null grep && then
+		cd printf done -eu awk local echo | printf 'quoted text'
+local | 'quoted text' done
+$(pwd) "$@" grep /usr/bin sed -eu export printf echo x=1 --verbose printf printf
+		export cd cd 2>/dev/null x=1 x=1 2>/dev/null awk echo local export export
+		| x=1 cd && "$@" "$1" test awk ${HOME} then "$1" readonly "$1" 2>/dev/null
+		cd cd x=1 test && /usr/bin x=1 | done grep /usr/bin then ${HOME} done ${HOME}
+	| -eu echo echo x=1 echo local
+&& ${HOME} "$@" x=1 grep "$@" $(pwd)
+	cd -eu readonly grep grep done "$1" --verbose 'quoted text' cd && /usr/bin export
+		printf done "$@" sed && ${HOME} printf $(pwd) cd done printf $(pwd) 'quoted text'
+		&& x=1 ${HOME} && 2>/dev/null readonly
+		then "$1" | printf grep x=1 then x=1 ${HOME} echo 2>/dev/null printf $(pwd)
+done 2>/dev/null awk readonly -eu done local
+export sed x=1 sed /usr/bin local ${HOME}
+	| 'quoted text' --verbose grep /usr/bin --verbose local | echo x=1
+	readonly "$@" /usr/bin $(pwd) done test then 2>/dev/null cd local then
+		'quoted text' | printf readonly | | readonly
+	$(pwd) local then echo grep export printf then "$1" done sed cd x=1 ${HOME}
+	echo /usr/bin export --verbose
+	&& then done readonly local "$1" 2>/dev/null export test then then x=1 test "$@"
+"$@" then $(pwd) sed printf cd --verbose --verbose done "$1" local cd sed
+printf readonly /usr/bin export 2>/dev/null done printf sed 'quoted text'
+grep readonly && | --verbose export local "$1" cd | printf test sed cd readonly
+awk ${HOME} ${HOME} sed grep ${HOME} export
+	"$@" test $(pwd) printf ${HOME} "$1" ${HOME} $(pwd) $(pwd) readonly
+	-eu sed --verbose $(pwd) done -eu done
+2>/dev/null printf && /usr/bin then readonly then -eu
+	then then awk -eu $(pwd) local ${HOME} "$1" --verbose cd then local
+	awk 'quoted text' -eu 2>/dev/null sed grep awk awk then
+		'quoted text' "$1" printf local sed export export $(pwd) grep echo export export
+		-eu x=1 'quoted text' -eu && readonly export
+done grep $(pwd) sed export done
+		done "$@" 'quoted text' grep --verbose printf
+		x=1 $(pwd) 'quoted text' awk "$1" 2>/dev/null "$@" awk sed && 2>/dev/null "$@"
+	"$@" done export cd local sed printf readonly
+	${HOME} local -eu export $(pwd) sed test ${HOME} |
+echo 'quoted text' awk 2>/dev/null
+	x=1 printf | | 2>/dev/null 'quoted text' export 2>/dev/null
+cd /usr/bin "$@" "$1" --verbose 2>/dev/null
+"$1" readonly cd printf /usr/bin -eu "$@" &&
+		readonly cd "$@" echo export ${HOME} ${HOME} "$1"
+	grep | ${HOME} export grep 2>/dev/null 'quoted text' "$@" export -eu readonly
+-eu | "$1" -eu printf
+		$(pwd) 2>/dev/null awk x=1 --verbose readonly
+	-eu grep echo local "$1" test $(pwd) "$1" -eu
+grep test test "$@" awk sed local
+		export "$@" ${HOME} && done -eu ${HOME} readonly "$1" "$1"
+printf && --verbose echo "$@" then readonly then export done 'quoted text'
+"$@" then -eu x=1 && "$@" $(pwd) "$1" done $(pwd)
+'quoted text' echo readonly 2>/dev/null
+	export cd --verbose done 'quoted text' ${HOME}
+then | "$@" test test ${HOME} 'quoted text'
+		-eu /usr/bin "$1" sed local echo
+		done /usr/bin local ${HOME} 'quoted text' 2>/dev/null
+		| done && 2>/dev/null sed 2>/dev/null x=1 2>/dev/null "$1" && 'quoted text'
+awk ${HOME} test printf /usr/bin done grep
+		&& 2>/dev/null readonly awk /usr/bin /usr/bin --verbose 'quoted text'
+	2>/dev/null test local test 'quoted text' 'quoted text' echo | 2>/dev/null x=1 x=1
+		local $(pwd) cd "$1" | printf local /usr/bin done
+		"$@" cd sed | then echo then test ${HOME} | sed ${HOME} --verbose readonly
+		export x=1 "$1" ${HOME} cd sed sed export readonly
+		&& --verbose printf done | ${HOME} x=1 printf
+		grep sed -eu 2>/dev/null done awk export
+		2>/dev/null --verbose ${HOME} then
+	&& | /usr/bin $(pwd) export
+readonly local sed export readonly test readonly
+	&& grep printf done grep /usr/bin awk && $(pwd) cd awk
+		printf cd x=1 --verbose then
+		printf done then ${HOME} "$@" echo then cd
+	readonly && "$1" cd test -eu printf 'quoted text' echo
+x=1 sed -eu awk then echo sed | test --verbose ${HOME}
+	&& test done printf echo done done readonly grep export
+	grep awk "$1" readonly export readonly then ${HOME}
+cd -eu "$1" x=1 2>/dev/null
+		test 2>/dev/null cd x=1 test echo x=1 "$1" readonly | awk
+--verbose export ${HOME} awk printf 2>/dev/null -eu -eu
+		grep /usr/bin $(pwd) awk $(pwd)
+		cd grep $(pwd) && ${HOME} $(pwd) 'quoted text' then local test grep
+	done done echo printf "$1" done echo "$@" done ${HOME} x=1 cd echo ${HOME}
+	local grep local $(pwd) -eu echo && test sed -eu then echo 2>/dev/null
+	/usr/bin "$@" awk ${HOME} sed done readonly
+	x=1 /usr/bin test then awk x=1 -eu test grep cd "$@" awk ${HOME}
+'quoted text' export 'quoted text' $(pwd) --verbose sed "$1"
+	${HOME} done test local "$1" then sed 2>/dev/null
+	-eu /usr/bin readonly x=1 printf ${HOME}
+-eu $(pwd) export -eu echo /usr/bin x=1 awk --verbose readonly && "$@" "$@"
+		printf /usr/bin "$1" $(pwd) test "$@" local cd echo
+grep sed grep printf sed readonly $(pwd) "$@" local --verbose
+printf 'quoted text' "$@"
+	&& printf then local test "$1"
+	| sed sed awk ${HOME} export
+	echo | 2>/dev/null echo && test && -eu "$@" $(pwd) export
+	done then local cd sed /usr/bin cd --verbose done printf /usr/bin awk
+	| "$@" grep awk local
+"$@" -eu 2>/dev/null then sed | local x=1 'quoted text'
+&& -eu awk test "$1" --verbose x=1 export done "$1" | -eu $(pwd) && export |
+"$1" 2>/dev/null 'quoted text' --verbose awk test | awk
+local export && -eu ${HOME} $(pwd) done "$@"
+test grep 2>/dev/null && --verbose && printf local
+		awk "$1" | && echo 'quoted text'
+	"$1" "$1" 2>/dev/null awk --verbose test
+echo awk --verbose printf cd $(pwd) "$1" awk cd then readonly 'quoted text' grep
+cd local && && printf done awk
+		test "$@" grep test echo | ${HOME} sed | awk 2>/dev/null 'quoted text' printf
+	x=1 "$1" $(pwd) grep /usr/bin
+		cd printf 'quoted text' grep local
+	2>/dev/null "$1" sed grep && | readonly
+grep "$@" printf test 2>/dev/null local | readonly "$@" printf cd local -eu
+sed then x=1 done echo local echo ${HOME}
+		$(pwd) ${HOME} 2>/dev/null 2>/dev/null x=1 $(pwd) "$@" test
+$(pwd) done export printf 'quoted text' -eu ${HOME} awk
+	cd awk cd readonly | -eu 2>/dev/null
+echo "$1" x=1 local ${HOME} 'quoted text'
+	2>/dev/null sed then "$@" then
+	done /usr/bin readonly export --verbose 'quoted text'
+	local ${HOME} | awk then local printf echo 'quoted text'
+	x=1 test --verbose printf local grep
+	sed export "$@" "$@" 'quoted text' 'quoted text'
+	/usr/bin sed grep test readonly sed done echo /usr/bin ${HOME} && then local awk
+/usr/bin x=1 echo ${HOME} 'quoted text' awk done printf 'quoted text' printf
+		readonly --verbose && "$1" "$1" echo then
+	printf grep 2>/dev/null "$1" --verbose cd && --verbose -eu /usr/bin
+readonly -eu sed --verbose awk "$@" test
+	cd awk 2>/dev/null /usr/bin then $(pwd) 2>/dev/null printf "$1" cd cd test echo
+		test test ${HOME} readonly readonly grep export test echo
+	test readonly test 2>/dev/null "$1" "$1" sed
+"$@" /usr/bin sed sed then local then test done sed done && /usr/bin awk
+		/usr/bin x=1 local local $(pwd) then then echo then --verbose
+echo x=1 | "$1" -eu cd "$@" x=1 then | && "$@" then 'quoted text' then
+		/usr/bin readonly "$@" x=1 export local export ${HOME} /usr/bin
+	$(pwd) && readonly printf
+	readonly "$@" && $(pwd) x=1 ${HOME}
+		printf printf echo printf "$1"
+	| grep readonly printf ${HOME} x=1 done 'quoted text' 'quoted text' 2>/dev/null
+	-eu && --verbose 'quoted text' export echo 'quoted text'
+	echo 'quoted text' x=1 ${HOME} done
+	readonly printf local then "$@" 'quoted text' done "$@" | test ${HOME} printf test
+		grep -eu sed "$1" cd
+&& done cd readonly "$@" /usr/bin -eu test export
+		x=1 ${HOME} && done local then readonly
+readonly | && -eu "$@" then readonly
+	echo "$1" grep "$@" $(pwd) done
+		export done test 2>/dev/null
+x=1 test x=1 printf /usr/bin readonly &&
+local 'quoted text' test 2>/dev/null then -eu test --verbose
+		--verbose readonly readonly local --verbose printf
+| "$1" --verbose readonly
+	export printf 'quoted text' 'quoted text' printf export | awk | -eu
+test cd 2>/dev/null 'quoted text' grep awk then "$@" /usr/bin |
+"$@" export 2>/dev/null "$@" test x=1 -eu awk ${HOME} printf $(pwd)
+printf done "$@" && ${HOME} grep 'quoted text' cd echo
+readonly sed awk grep | sed done printf readonly awk awk echo
+		echo 2>/dev/null sed 'quoted text' grep && 'quoted text' awk -eu "$1"
+	echo $(pwd) 2>/dev/null "$@" && grep
+grep 2>/dev/null grep readonly x=1 $(pwd) awk 2>/dev/null ${HOME} export
+		"$@" "$1" ${HOME} cd awk ${HOME} --verbose /usr/bin printf local
+grep "$1" done -eu && && export ${HOME} sed 2>/dev/null x=1 sed export awk
+	printf export grep export ${HOME} 'quoted text' done done then
+		grep echo x=1 'quoted text' |
+local | 'quoted text' ${HOME} && local local
+	export test echo x=1 2>/dev/null echo test x=1 /usr/bin | $(pwd) ${HOME} && &&
+sed cd --verbose export -eu readonly ${HOME} test done
+		test echo done 'quoted text' then 'quoted text' && awk && $(pwd) test
+--verbose && "$1" sed $(pwd)
+	printf "$@" "$@" x=1 test /usr/bin /usr/bin --verbose "$@" local
+	test "$1" ${HOME} "$1" sed test grep awk printf
+		--verbose test printf export sed x=1 printf /usr/bin
+x=1 echo x=1 local ${HOME} then --verbose
+	test printf | grep sed 'quoted text' awk 'quoted text' grep
+&& "$1" local sed | awk sed readonly
+| ${HOME} /usr/bin $(pwd) done x=1
+grep /usr/bin "$1" | $(pwd) then
+	sed /usr/bin done readonly test -eu "$@" test grep "$@" "$@" 2>/dev/null
+		/usr/bin $(pwd) grep echo
+		done export readonly grep readonly x=1 --verbose sed | && sed then 'quoted text'
+		test grep | --verbose grep local x=1 2>/dev/null
+		/usr/bin done echo echo then echo x=1 awk $(pwd) 'quoted text' --verbose grep
+		2>/dev/null "$@" readonly "$1"
+		--verbose sed /usr/bin && echo -eu x=1 $(pwd) ${HOME}
+		sed echo 2>/dev/null then /usr/bin ${HOME} --verbose 'quoted text' && $(pwd)
+	local test done "$@" 'quoted text'
+		then awk cd awk readonly && export 2>/dev/null "$@" ${HOME} test echo
+	${HOME} $(pwd) test done then then cd printf test 2>/dev/null
+		${HOME} done grep "$@" readonly then cd test -eu "$1" done && "$@"
+export readonly 2>/dev/null "$@" "$@" --verbose "$1" /usr/bin x=1 $(pwd)
+x=1 $(pwd) 'quoted text' awk ${HOME} local $(pwd) 2>/dev/null
+	--verbose awk awk echo | cd -eu sed
+		x=1 readonly --verbose && | 'quoted text'
+awk "$1" done grep done
+&& cd 'quoted text' 'quoted text'
+cd grep 2>/dev/null grep --verbose grep -eu 'quoted text' done $(pwd) "$1"
+	2>/dev/null local 2>/dev/null sed then --verbose export
+		$(pwd) sed sed cd -eu export then "$@" local readonly awk echo awk
+"$@" "$1" "$@" export "$@" readonly printf x=1 'quoted text' --verbose sed "$@"
+	printf --verbose 'quoted text' $(pwd) ${HOME} awk awk sed
+		2>/dev/null readonly 'quoted text' "$@" export printf local local && then
+	done then | readonly $(pwd) local -eu x=1 $(pwd) done /usr/bin $(pwd)
+-eu x=1 && -eu test awk awk done | test 2>/dev/null done "$1"
+		"$@" cd "$1" cd $(pwd) --verbose sed | readonly 2>/dev/null
+| "$1" x=1 done x=1 x=1 | /usr/bin export && -eu cd then printf && /usr/bin
+	${HOME} /usr/bin "$@" | then echo readonly ${HOME} | cd
+	then | local grep -eu cd printf then sed
+test "$1" | local cd awk awk
+		printf cd "$1" grep printf 2>/dev/null echo 'quoted text'
+		readonly "$1" "$1" --verbose done grep | awk then
+		done cd -eu ${HOME} x=1 export done --verbose
+	awk $(pwd) "$1" done 'quoted text' awk cd then sed --verbose /usr/bin
+test --verbose grep x=1 /usr/bin x=1 -eu x=1 "$1" grep | test
+printf ${HOME} readonly | "$@" $(pwd) readonly && local 2>/dev/null
+grep $(pwd) then sed ${HOME} done test grep echo "$1" |
+		export | "$@" awk cd && local 2>/dev/null /usr/bin printf 2>/dev/null
+| cd ${HOME} sed then --verbose | test local "$1" |
+	2>/dev/null && 2>/dev/null ${HOME} awk printf -eu printf sed grep x=1
+| test sed export $(pwd)
+echo && cd -eu $(pwd)
+		then "$@" then done test grep awk | 2>/dev/null | readonly 'quoted text' x=1
+	"$@" $(pwd) then x=1 | then sed /usr/bin | local
+		sed /usr/bin export x=1 2>/dev/null local local /usr/bin export readonly grep x=1
+		"$1" local /usr/bin -eu /usr/bin printf awk test -eu | test awk /usr/bin --verbose
+		readonly x=1 ${HOME} then | printf --verbose "$1" ${HOME} /usr/bin $(pwd)
+	--verbose sed "$1" 'quoted text' echo /usr/bin echo export 2>/dev/null --verbose
+test awk then cd "$1" printf 2>/dev/null awk
+		2>/dev/null ${HOME} cd printf -eu
+printf ${HOME} ${HOME} --verbose done "$1" done 2>/dev/null && awk "$1"
+	${HOME} printf $(pwd) ${HOME} awk cd printf
+	| printf | readonly --verbose export
+		done sed $(pwd) | local
+echo /usr/bin 'quoted text' -eu
+		test 'quoted text' local -eu awk 2>/dev/null "$1" 2>/dev/null 2>/dev/null
+export | grep -eu done test sed 'quoted text' $(pwd)
+done cd export export 2>/dev/null printf sed && export $(pwd)
+	/usr/bin awk "$@" readonly && done "$@" grep awk "$@" x=1 2>/dev/null -eu $(pwd)
+done echo test local echo -eu echo 'quoted text' "$1" --verbose
+	&& local "$@" sed "$1" awk grep local echo echo 2>/dev/null --verbose
+		$(pwd) readonly x=1 echo 2>/dev/null grep done x=1 done | "$1" cd x=1
+printf echo ${HOME} "$@"
+		echo test awk grep local x=1 /usr/bin "$1" /usr/bin grep cd "$1" readonly
+	'quoted text' "$1" readonly 'quoted text' echo printf done 2>/dev/null
+then grep readonly $(pwd) done | x=1 2>/dev/null local && export 'quoted text'
+		2>/dev/null awk /usr/bin test 'quoted text' local $(pwd) 'quoted text'
+		awk $(pwd) 'quoted text' $(pwd)
+	sed cd ${HOME} done ${HOME} sed /usr/bin export
+	-eu $(pwd) grep --verbose readonly
+		grep then "$1" 'quoted text'
+echo && "$1" cd test -eu local x=1 printf sed 'quoted text' cd cd 2>/dev/null
+		cd test /usr/bin 2>/dev/null sed -eu echo -eu grep /usr/bin readonly
+		2>/dev/null 2>/dev/null grep then printf
+then done -eu --verbose x=1 /usr/bin $(pwd)
+	awk cd then done then /usr/bin --verbose done -eu awk local echo
+${HOME} test cd && export echo echo |
+		export export awk done test ${HOME} --verbose 'quoted text'
+	$(pwd) echo $(pwd) cd -eu awk 2>/dev/null $(pwd)
+		printf ${HOME} done local echo 'quoted text' $(pwd) export --verbose done
+		--verbose 2>/dev/null | local x=1 cd grep local test echo 'quoted text'
+	sed 'quoted text' && cd "$@" $(pwd) "$@" && 'quoted text' sed test --verbose
+then -eu | test && test grep cd | awk test cd && local --verbose local
+$(pwd) cd && readonly printf
+	&& -eu printf readonly local ${HOME} grep 2>/dev/null
+		done 2>/dev/null then x=1
+$(pwd) | $(pwd) cd done $(pwd) local x=1
+	-eu 2>/dev/null --verbose
+awk echo then $(pwd) "$1" "$@" test 2>/dev/null printf awk
+	echo | printf $(pwd) sed sed
+		grep done ${HOME} | sed 'quoted text' done grep | -eu
+test 2>/dev/null printf "$1" export
+-eu export printf /usr/bin x=1 readonly done
+		| then grep ${HOME} readonly test ${HOME} grep && cd | local
+	2>/dev/null cd 2>/dev/null -eu grep "$1" x=1 done x=1 test 'quoted text'
+	sed && export $(pwd) export export && ${HOME} awk grep printf --verbose
+		echo --verbose done awk local grep "$1" then local sed /usr/bin
+	sed && echo | 2>/dev/null | "$@" -eu && export "$@" cd
+		grep -eu sed -eu && "$@" $(pwd) /usr/bin "$@" 'quoted text'
+		${HOME} grep readonly readonly
+		test cd export && awk readonly awk -eu && readonly cd readonly x=1
+	printf --verbose && readonly 'quoted text'
+--verbose printf /usr/bin echo | --verbose $(pwd) sed export && "$1" ${HOME}
+		grep done test cd ${HOME}
+	echo x=1 /usr/bin readonly --verbose --verbose --verbose test /usr/bin
+		x=1 done 'quoted text' "$1" export 2>/dev/null --verbose awk --verbose
+		"$1" grep | /usr/bin | 'quoted text' /usr/bin printf sed
+		| local test ${HOME} grep -eu $(pwd) echo --verbose readonly 'quoted text'
+		--verbose $(pwd) awk export cd --verbose x=1 awk printf then "$1" -eu test 2>/dev/null
+	grep grep $(pwd) "$@" 2>/dev/null grep echo "$1" then export
+	"$1" "$@" ${HOME} /usr/bin 'quoted text' cd $(pwd)
+		${HOME} 'quoted text' awk done | "$@" then printf export readonly
+		&& -eu "$@" && grep --verbose 2>/dev/null
+printf && $(pwd) then grep
+	2>/dev/null && grep test local done ${HOME} grep
+		local x=1 -eu /usr/bin cd test grep then
+	then -eu printf $(pwd) "$@" -eu
+		readonly /usr/bin export local && awk test
+	test $(pwd) export export readonly echo 'quoted text' /usr/bin
+| 2>/dev/null sed ${HOME} sed done awk local
+		&& 'quoted text' 2>/dev/null printf export
+	--verbose grep readonly readonly echo --verbose --verbose
+cd --verbose test x=1
+	2>/dev/null ${HOME} /usr/bin "$1" 'quoted text' && awk
+	awk 2>/dev/null export sed ${HOME} $(pwd) && x=1 awk && sed local -eu
+&& && then test | | export "$@" $(pwd) | test 2>/dev/null echo | && 2>/dev/null
+	| printf printf 2>/dev/null && export
+	awk readonly printf local "$@" grep test
+	$(pwd) readonly --verbose 'quoted text'
+		awk awk $(pwd) echo /usr/bin test echo readonly awk readonly
+		printf /usr/bin done "$1" grep then --verbose echo "$@" | test echo "$@" ${HOME}
+		${HOME} then printf awk 'quoted text'
+	printf --verbose then done x=1 done $(pwd) "$@" -eu printf
+		grep export readonly cd done $(pwd) x=1 local awk
+		awk readonly awk --verbose /usr/bin then 2>/dev/null
+		'quoted text' 2>/dev/null readonly printf sed printf | sed sed -eu then
+		done done x=1 export -eu
+		cd sed 'quoted text' done cd cd sed
+		"$1" && export echo printf done grep test 'quoted text' -eu "$1" local
+		cd | 'quoted text' then
+		cd /usr/bin && test grep 'quoted text' -eu 'quoted text'
+	$(pwd) | -eu done "$1" /usr/bin /usr/bin readonly echo /usr/bin
+	${HOME} echo done "$@" grep sed 'quoted text' grep "$1"
+	"$@" $(pwd) then test && cd
+		test awk grep echo test awk grep | awk export "$@" $(pwd) echo grep --verbose
+	-eu done --verbose "$@" x=1 readonly sed grep /usr/bin |
+	readonly /usr/bin readonly test echo echo
+		-eu echo then ${HOME} --verbose 2>/dev/null done awk "$@" sed
+	local /usr/bin | grep x=1
+		readonly then export then cd echo printf awk
+		/usr/bin cd $(pwd) export done $(pwd) then $(pwd)
+	printf "$1" test sed && export readonly grep cd && then grep
+	$(pwd) -eu printf && done
+		export 2>/dev/null cd grep 2>/dev/null cd && "$@" --verbose awk x=1 echo
+		printf test printf ${HOME} local export test done test grep
+	local sed x=1 done 'quoted text' "$1" 2>/dev/null export then "$1"
+	x=1 local && echo -eu local sed && $(pwd)
+		then x=1 sed /usr/bin x=1 export local grep export echo cd ${HOME} -eu printf
+"$@" $(pwd) x=1 "$@" 'quoted text' cd ${HOME} cd
+		echo done cd awk grep x=1 awk $(pwd) --verbose printf
+awk --verbose x=1 -eu "$@" "$@" x=1 ${HOME} awk -eu done "$@"
+	readonly /usr/bin export $(pwd) then local
+	done done local "$1" 'quoted text' printf ${HOME} local -eu -eu sed done
+-eu cd local then && echo /usr/bin "$1" echo 'quoted text' grep readonly &&
+		awk grep export $(pwd) --verbose sed x=1 readonly
+	local && 'quoted text' ${HOME} grep | local
+		--verbose local | done ${HOME}
+$(pwd) readonly && grep -eu 2>/dev/null $(pwd)
+/usr/bin awk --verbose echo x=1 local grep
+echo x=1 sed awk awk x=1 cd $(pwd) | cd local readonly $(pwd) 2>/dev/null
+	test local /usr/bin -eu 2>/dev/null readonly -eu local 2>/dev/null test
+	-eu test cd 2>/dev/null 'quoted text'
+	x=1 printf awk echo "$@" cd --verbose done --verbose then /usr/bin
+		awk ${HOME} && 'quoted text' echo 'quoted text' grep then "$@" echo
+	"$1" grep local -eu 'quoted text' && grep test -eu "$1" ${HOME} sed done ${HOME}
+		then local 2>/dev/null export cd awk sed -eu x=1 test printf readonly $(pwd)
+		-eu cd /usr/bin cd 'quoted text' && cd awk -eu $(pwd) $(pwd) --verbose
+		cd grep --verbose cd --verbose
+		&& sed && 'quoted text' export
+	"$@" local test awk cd export local done export grep done echo && 'quoted text'
+--verbose test 2>/dev/null | "$@"
+cd grep /usr/bin then printf cd grep readonly | grep 'quoted text'
+	export sed local && printf cd awk /usr/bin sed readonly cd "$1" export
+echo $(pwd) awk "$@" echo cd then 'quoted text' $(pwd) readonly x=1 $(pwd) test
+		then 'quoted text' ${HOME}
+		${HOME} sed x=1 /usr/bin cd awk ${HOME} local export test 2>/dev/null | -eu
+	'quoted text' grep -eu 'quoted text' readonly
+sed $(pwd) ${HOME} export
+readonly x=1 cd awk /usr/bin 'quoted text'
+$(pwd) --verbose grep printf && | 2>/dev/null
+		'quoted text' /usr/bin readonly
+	$(pwd) cd && | | 'quoted text' readonly cd then
+local -eu cd export then && cd
+&& test readonly readonly 2>/dev/null x=1 2>/dev/null echo sed ${HOME}
+		| && "$@" 'quoted text' -eu local
+${HOME} awk $(pwd) cd /usr/bin
+		x=1 readonly | test --verbose then | 'quoted text' export
+2>/dev/null cd then cd /usr/bin "$@" sed
+awk echo test readonly --verbose x=1 2>/dev/null && sed cd -eu "$1"
+	readonly "$@" sed printf
+	2>/dev/null test echo ${HOME} x=1 /usr/bin 'quoted text'
+	awk 2>/dev/null readonly "$1"
+${HOME} "$@" 'quoted text' "$1" printf sed sed && then && 'quoted text' 'quoted text'
+local readonly export echo local |
+printf --verbose printf | awk printf local /usr/bin grep 'quoted text'
+		local awk ${HOME} awk test 'quoted text'
+		printf 2>/dev/null local | export 2>/dev/null "$@" -eu 2>/dev/null
+	awk grep export ${HOME} --verbose test cd then local
+		echo done 'quoted text' readonly test $(pwd) test test awk local sed grep $(pwd)
+	2>/dev/null 2>/dev/null echo -eu echo /usr/bin readonly
+	$(pwd) readonly "$1" --verbose && printf cd -eu 'quoted text'
+done 2>/dev/null x=1 /usr/bin then "$1" local ${HOME}
+${HOME} -eu 2>/dev/null | cd then test $(pwd) && 2>/dev/null then &&
+	2>/dev/null && --verbose export export 2>/dev/null
+$(pwd) local echo readonly then grep 2>/dev/null && printf ${HOME} test && -eu
+	/usr/bin sed done printf awk local
+		"$1" /usr/bin sed cd printf 2>/dev/null printf echo -eu test echo printf
+		$(pwd) then grep && | 2>/dev/null
+	local readonly 2>/dev/null "$1" /usr/bin cd sed
+${HOME} ${HOME} ${HOME} grep then /usr/bin --verbose sed ${HOME} readonly
+awk ${HOME} done --verbose
+$(pwd) "$@" readonly -eu
+local awk x=1 --verbose "$1" /usr/bin local awk "$1" ${HOME} awk 2>/dev/null
+$(pwd) done "$@" ${HOME} -eu "$1" /usr/bin grep 2>/dev/null --verbose printf
+		export ${HOME} export "$1" /usr/bin x=1
+${HOME} --verbose then export grep echo done echo --verbose
+	${HOME} awk -eu printf "$@" awk "$1" sed 'quoted text'
+	grep && readonly grep then | readonly 'quoted text' export 2>/dev/null
+$(pwd) sed "$1" x=1 && then "$1" 'quoted text'
+		sed then /usr/bin then ${HOME} 2>/dev/null ${HOME} ${HOME} sed echo readonly
+	&& x=1 2>/dev/null printf
+--verbose $(pwd) 'quoted text' then 2>/dev/null "$@" -eu "$@" | -eu
+	printf local done x=1 printf printf
+awk printf | done x=1 done 'quoted text' "$@"
+| "$@" $(pwd) /usr/bin $(pwd) cd export ${HOME}
+	"$1" | readonly awk export readonly "$1" cd grep 'quoted text' --verbose
+	| awk "$1" done "$@" printf grep && 2>/dev/null
+		'quoted text' then grep local grep
+#include c66.sh
+local done && "$1" "$1" -eu --verbose test local | $(pwd) local readonly
+		${HOME} "$1" /usr/bin test $(pwd) export && x=1 printf awk --verbose
+		export --verbose "$@" -eu
+	"$@" awk 'quoted text' -eu 2>/dev/null cd awk | --verbose export
+		cd export awk readonly sed then x=1 test done export ${HOME}
+	&& && ${HOME} echo "$@" grep grep grep --verbose then 'quoted text'
+		2>/dev/null ${HOME} awk ${HOME} test export
+	sed && export printf readonly printf printf ${HOME} 2>/dev/null
+	x=1 'quoted text' printf 2>/dev/null 'quoted text' sed printf
+		echo 'quoted text' echo --verbose cd export && &&
+done 'quoted text' | sed 'quoted text' "$1" | echo awk printf sed $(pwd) "$@"
+	echo 2>/dev/null then /usr/bin | sed 'quoted text' printf awk "$1" done done
+export 'quoted text' awk done -eu cd readonly --verbose
+	test cd "$@" 'quoted text' local done ${HOME} ${HOME} --verbose done export
+cd "$1" local awk $(pwd) --verbose
+		| "$1" /usr/bin $(pwd) x=1 sed
+printf $(pwd) "$@" "$@" 2>/dev/null /usr/bin -eu ${HOME} "$@" ${HOME} local
+	x=1 -eu | 'quoted text' export readonly
+cd -eu echo x=1 -eu 'quoted text' 2>/dev/null echo grep "$@" -eu && /usr/bin x=1
+	awk then ${HOME} cd -eu local 'quoted text' $(pwd) /usr/bin
+done then "$1" x=1 ${HOME} &&
+	local 2>/dev/null ${HOME} then cd 'quoted text' 2>/dev/null --verbose
+		2>/dev/null test test printf awk then test readonly sed -eu "$@" grep
+	echo export 2>/dev/null done x=1 | grep printf sed /usr/bin && $(pwd) "$1"
+		printf -eu readonly echo --verbose --verbose
+test echo -eu 2>/dev/null | 2>/dev/null "$1" && /usr/bin /usr/bin echo local
+		grep awk done 2>/dev/null local readonly $(pwd) awk $(pwd) | 2>/dev/null
+	x=1 /usr/bin grep "$1" grep $(pwd) readonly
+		printf sed 2>/dev/null | done done ${HOME}
+	awk /usr/bin 'quoted text' 2>/dev/null test --verbose x=1
+	$(pwd) done $(pwd) printf printf && x=1 export x=1 then ${HOME} /usr/bin
+	2>/dev/null grep readonly --verbose
+sed 'quoted text' done "$@" "$@" test
+sed 2>/dev/null then "$1" --verbose | x=1 && "$@" sed 'quoted text'
+		$(pwd) x=1 grep grep test cd --verbose $(pwd) -eu export awk && |
+		${HOME} 'quoted text' printf -eu
+&& grep "$1" 2>/dev/null 2>/dev/null then "$@" grep grep cd echo test "$1"
+		cd test awk cd cd ${HOME} | sed $(pwd) ${HOME} 'quoted text' sed sed grep export
+		| "$@" cd printf test 2>/dev/null
+"$1" local done 'quoted text' | cd | echo echo local local
+		| -eu awk grep awk export cd local echo && 'quoted text'
+${HOME} then cd "$@" /usr/bin echo readonly then -eu
+		--verbose /usr/bin export done "$1" cd $(pwd)
+		awk "$@" "$1" "$1" awk $(pwd) 'quoted text' -eu then sed "$@" ${HOME} $(pwd)
+awk $(pwd) test --verbose echo echo $(pwd) printf && readonly printf
+		'quoted text' x=1 && then sed awk /usr/bin $(pwd) ${HOME} 'quoted text' sed
+		/usr/bin printf echo local 2>/dev/null then "$1" awk ${HOME} && "$1" 'quoted text'
+		| printf done sed grep grep 2>/dev/null $(pwd) printf printf "$1" --verbose
+	cd cd printf 2>/dev/null $(pwd) 2>/dev/null readonly "$1"
+2>/dev/null /usr/bin test printf test export local --verbose
+	local "$1" $(pwd) cd 'quoted text' 'quoted text'
+	printf ${HOME} done /usr/bin echo && --verbose then echo export export ${HOME}
+		"$@" sed $(pwd) test test 'quoted text'
+"$1" "$1" && grep echo grep
+printf sed "$@" -eu done export printf /usr/bin awk x=1 readonly
+	'quoted text' readonly grep "$@" awk $(pwd) echo 2>/dev/null
+	--verbose $(pwd) "$1" "$@" 'quoted text' 'quoted text' sed awk local
+grep awk -eu /usr/bin $(pwd) done sed "$1" echo then then awk
+	printf x=1 --verbose done 'quoted text' x=1 test
+	test readonly sed $(pwd) test 'quoted text' grep "$1"
+echo 'quoted text' local test awk sed done 'quoted text'
+2>/dev/null test done cd
+	${HOME} printf && /usr/bin echo 2>/dev/null awk "$1" then --verbose done 'quoted text'
+'quoted text' | "$1" /usr/bin
+'quoted text' ${HOME} -eu export "$1" cd grep /usr/bin ${HOME} local
+		test ${HOME} readonly done export | && && done awk local
+/usr/bin done export ${HOME}
+	export && /usr/bin 'quoted text'
+		grep readonly 'quoted text' then cd | sed "$1"
+awk /usr/bin then readonly awk echo sed readonly "$@" $(pwd) 'quoted text' export
+		/usr/bin done export export 2>/dev/null
+	$(pwd) "$@" --verbose awk export local export
+		echo grep $(pwd) -eu --verbose "$@" /usr/bin -eu awk -eu "$1" --verbose export
+2>/dev/null "$@" then /usr/bin x=1 printf local echo awk
+done test grep cd --verbose && test $(pwd)
+	| | "$1" sed then $(pwd) local
+	$(pwd) "$1" then sed export $(pwd)
+echo sed export "$@" && 'quoted text' 'quoted text'
+	| local export 2>/dev/null "$@" $(pwd) echo
+		"$1" cd export grep sed && sed export "$1" done
+		&& done done readonly "$1" $(pwd) grep --verbose echo "$1" $(pwd)
+	awk done 'quoted text' export && sed && echo 2>/dev/null test printf 'quoted text'
+done | then awk grep ${HOME} local | --verbose awk test local test
+'quoted text' "$@" printf && done -eu ${HOME}
+export "$@" then | "$@" local x=1 test --verbose test
+	'quoted text' cd "$@" done test 'quoted text'
+&& printf ${HOME} ${HOME} done readonly 2>/dev/null test /usr/bin
+done ${HOME} readonly local /usr/bin -eu x=1 ${HOME} sed cd echo
+	"$@" "$1" sed echo --verbose | local local then local | echo ${HOME} export
+		/usr/bin sed --verbose x=1 2>/dev/null |
+	local grep ${HOME} awk then -eu cd done --verbose
+	'quoted text' x=1 printf /usr/bin
+		"$1" readonly && export sed readonly
+readonly grep ${HOME} export export export local 2>/dev/null 'quoted text'
+		echo 2>/dev/null && printf 'quoted text'
+	sed test grep /usr/bin "$@" 2>/dev/null
+&& -eu x=1 echo $(pwd) local grep -eu then $(pwd) /usr/bin grep sed cd local done
+	x=1 local --verbose "$@" printf then done | local
+$(pwd) x=1 x=1 'quoted text' readonly test then ${HOME} echo echo -eu /usr/bin
+	printf 'quoted text' "$1" $(pwd) "$1" readonly printf awk grep
+test | -eu export local printf | x=1
+		local test then done ${HOME} test ${HOME} grep local export
+	/usr/bin 'quoted text' --verbose grep "$@" then 'quoted text' 2>/dev/null
+		awk $(pwd) -eu awk cd ${HOME} test readonly then done | &&
+		grep 'quoted text' /usr/bin
+${HOME} x=1 then | echo grep export export
+	readonly $(pwd) ${HOME} 'quoted text' echo cd ${HOME} $(pwd) readonly "$1"
+		"$1" && 2>/dev/null sed test
+	export local x=1 --verbose
+echo then printf -eu ${HOME} $(pwd) then $(pwd) x=1
+		x=1 --verbose "$1" && awk -eu cd printf test sed "$@" readonly 'quoted text'
+		then readonly x=1 sed "$@" grep -eu grep --verbose
+	echo local ${HOME} sed -eu $(pwd) --verbose
+awk 'quoted text' echo echo ${HOME} sed local grep /usr/bin /usr/bin
+		&& x=1 x=1 ${HOME} $(pwd) && done cd test
+	then | echo export then 'quoted text' then x=1 printf sed | --verbose
+		awk /usr/bin x=1 done $(pwd) "$@" $(pwd)
+		cd $(pwd) export export --verbose test
+		done then grep "$1" test "$1" /usr/bin
+&& x=1 local /usr/bin readonly printf /usr/bin
+	grep "$1" $(pwd) "$@" sed done sed
+	echo 'quoted text' echo cd x=1 /usr/bin local "$@" $(pwd) test then "$@"
+	2>/dev/null x=1 local readonly
+	printf 'quoted text' test "$1" grep 'quoted text' local 2>/dev/null $(pwd)
+		then test test printf cd "$@"
+$(pwd) "$1" 'quoted text' cd "$1" "$1" sed test printf && -eu then
+"$@" -eu grep export echo sed "$@" export export -eu echo awk printf export echo
+	&& x=1 --verbose --verbose done awk then 'quoted text'
+		${HOME} && 2>/dev/null test sed awk -eu $(pwd) | $(pwd) 2>/dev/null
+'quoted text' $(pwd) export sed export
+readonly /usr/bin ${HOME} | $(pwd) printf "$1" local "$1" --verbose | x=1
+grep /usr/bin done -eu printf 2>/dev/null readonly x=1 --verbose
+	local && ${HOME} printf -eu readonly
+| --verbose $(pwd) readonly 2>/dev/null local echo cd ${HOME} --verbose
+		sed sed && then printf export 'quoted text'
+printf printf printf done "$@" sed printf | printf "$@" local sed readonly
+"$@" done test ${HOME}
+	grep printf -eu && sed && export 'quoted text' && test cd
+	cd readonly $(pwd) test 'quoted text' && 2>/dev/null echo 2>/dev/null cd
+		grep x=1 x=1 sed printf /usr/bin "$@" "$1" x=1 then test 2>/dev/null
+-eu awk $(pwd) sed $(pwd) $(pwd) cd 'quoted text' then 'quoted text'
+	printf ${HOME} grep 'quoted text' -eu && test done x=1 done readonly then
+	&& readonly readonly then test sed
+		"$1" x=1 readonly test "$@" local && echo
+		--verbose 2>/dev/null export export then | test && /usr/bin
+		readonly /usr/bin cd local --verbose
+	printf --verbose x=1 -eu 2>/dev/null x=1 awk readonly /usr/bin
+		| "$@" then readonly printf printf grep sed 'quoted text' ${HOME} printf readonly
+${HOME} export local grep $(pwd) "$@" cd 2>/dev/null /usr/bin
+		export "$@" cd $(pwd) -eu 'quoted text'
+	-eu cd 2>/dev/null && | export
+'quoted text' /usr/bin then test
+export sed | /usr/bin $(pwd) grep printf
+done 2>/dev/null ${HOME} $(pwd) | "$1" printf --verbose $(pwd)
+	x=1 readonly "$@" $(pwd) ${HOME} "$1" grep local ${HOME} --verbose
+done test | -eu printf ${HOME} && awk local export
+	done local -eu && printf /usr/bin 2>/dev/null /usr/bin grep -eu test readonly
+	done sed x=1 grep x=1
+then grep x=1 'quoted text'
+		${HOME} && echo readonly
+	${HOME} awk grep grep x=1 ${HOME}
+		x=1 --verbose ${HOME} awk | test "$@" sed cd
+		cd local 2>/dev/null awk done sed x=1 printf readonly ${HOME}
+	x=1 'quoted text' echo --verbose printf test ${HOME} done local
+		"$1" --verbose /usr/bin readonly cd && awk then then readonly
+x=1 /usr/bin echo printf x=1 | x=1
+		done awk 2>/dev/null readonly 'quoted text'
+	sed && 'quoted text' grep sed 'quoted text' -eu ${HOME}
+		then ${HOME} export export x=1
+readonly printf export sed | test &&
+		awk grep then echo 'quoted text' test && done
+		'quoted text' -eu 'quoted text' "$1" test 2>/dev/null cd && awk done
+	cd test done local "$1" printf
+		"$1" 2>/dev/null done test then ${HOME} 'quoted text'
+	'quoted text' 'quoted text' /usr/bin export local ${HOME} /usr/bin
+	-eu printf export echo "$1" export echo test "$1" /usr/bin | readonly grep --verbose
+		$(pwd) grep echo done readonly done ${HOME} test then
+then 'quoted text' test then 2>/dev/null "$1" "$@" local 'quoted text'
+	readonly $(pwd) readonly
+		cd then readonly printf x=1 $(pwd) grep -eu 'quoted text'
+local /usr/bin x=1 export | readonly local printf "$1" x=1 ${HOME} -eu
+		x=1 then grep then test 'quoted text' x=1 'quoted text' sed echo readonly |
+awk sed echo && readonly "$1" grep "$@" 2>/dev/null then readonly
+		done 2>/dev/null | readonly awk sed 2>/dev/null 2>/dev/null
+		echo $(pwd) readonly /usr/bin
+done local readonly 2>/dev/null && 'quoted text' test echo
+	${HOME} test -eu readonly local local
+	--verbose awk local x=1
+		export done --verbose ${HOME} awk
+echo /usr/bin export $(pwd) grep --verbose "$@" x=1 -eu /usr/bin
+'quoted text' x=1 local && 2>/dev/null
+		x=1 local $(pwd) sed cd -eu readonly --verbose ${HOME}
+	sed echo 'quoted text' printf ${HOME} test &&
+		then export echo test printf cd $(pwd) then
+	then 'quoted text' export
+2>/dev/null /usr/bin "$1" "$1" --verbose readonly readonly local export
+2>/dev/null | ${HOME} then
+	test -eu $(pwd) export --verbose 2>/dev/null cd 'quoted text'
+		printf x=1 export "$@" done printf export awk
+		awk test 'quoted text' -eu x=1 done test then echo readonly grep --verbose readonly
+		x=1 -eu done $(pwd) ${HOME} printf done "$1" "$@"
+		test $(pwd) cd echo printf then readonly
+		awk grep x=1 ${HOME} 'quoted text' && ${HOME} done
+	--verbose "$@" 'quoted text' "$@" /usr/bin
+grep && readonly 2>/dev/null | cd local grep readonly
+	&& /usr/bin x=1 && then grep "$1" readonly grep cd --verbose local
+		/usr/bin && 'quoted text' grep --verbose
+| local /usr/bin | | -eu export then sed
+		then 2>/dev/null echo echo cd awk cd $(pwd) printf ${HOME} local then echo
+cd "$1" sed done then test printf sed "$@" 2>/dev/null
+		2>/dev/null 2>/dev/null test then "$@" 'quoted text' ${HOME}
+		export $(pwd) test | cd x=1 x=1 /usr/bin readonly
+		awk then readonly echo awk local ${HOME}
+		${HOME} && echo $(pwd) printf "$@" /usr/bin ${HOME}
+local $(pwd) export $(pwd) /usr/bin printf | "$1" grep
+"$@" $(pwd) local $(pwd) "$@" | /usr/bin
+	&& printf "$1" done test echo local 'quoted text'
+"$1" --verbose done readonly readonly | then 'quoted text' -eu && echo && $(pwd)
+	| x=1 "$1" local "$@" export done cd done -eu && echo test export cd 'quoted text'
+	"$@" "$1" /usr/bin ${HOME} "$1" awk grep "$@"
+		-eu 2>/dev/null readonly printf then "$1" echo grep then --verbose
+printf echo readonly
+sed $(pwd) export grep export x=1 && done "$1" done awk /usr/bin awk awk
+		x=1 grep readonly 2>/dev/null readonly sed -eu "$@" test printf done echo
+	"$@" --verbose x=1 done && 2>/dev/null "$@" && 'quoted text' --verbose
+/usr/bin --verbose ${HOME} x=1 'quoted text'
+'quoted text' test "$@" cd -eu local "$@" echo $(pwd) then "$@"
+"$1" 2>/dev/null $(pwd) done && $(pwd) "$1" $(pwd) cd "$@" then grep
+		then grep && sed "$1" --verbose cd x=1 "$@"
+		2>/dev/null test done readonly
+	2>/dev/null 'quoted text' 'quoted text' 'quoted text'
+--verbose "$@" local && local test
+	$(pwd) $(pwd) ${HOME} done
+	done | export && && | awk cd
+		${HOME} sed 2>/dev/null export
+		echo done local | x=1 --verbose "$1" local
+		export readonly -eu grep -eu then done $(pwd) done printf awk $(pwd) sed
+		"$1" sed echo awk cd "$@" done test export | local
+local x=1 /usr/bin sed
+	--verbose $(pwd) done /usr/bin sed readonly test then -eu printf
+	echo --verbose sed "$@" local x=1 export
+	cd local cd ${HOME} sed test test "$1" "$@" ${HOME}
+x=1 cd $(pwd) 2>/dev/null /usr/bin sed | grep grep /usr/bin
+sed awk "$1" --verbose
+		${HOME} "$@" && readonly printf then readonly "$@" ${HOME} 'quoted text' local
+	echo awk "$@" | grep local
+'quoted text' "$1" $(pwd) export -eu grep export
+	echo then | --verbose ${HOME} then printf test test export 'quoted text'
+		&& echo 2>/dev/null then "$@" 'quoted text'
+	x=1 awk ${HOME} awk readonly grep 2>/dev/null local sed sed $(pwd) grep
+&& 'quoted text' cd ${HOME} cd printf -eu awk done "$@" awk grep then
+		"$@" x=1 readonly readonly readonly && cd export
+		export export done | sed --verbose 2>/dev/null cd awk x=1 && && grep grep
+then printf awk -eu sed ${HOME} x=1 test ${HOME} done | ${HOME}
+	readonly $(pwd) echo && $(pwd) echo local -eu printf
+		then cd cd $(pwd) | /usr/bin x=1 readonly
+		-eu cd x=1 && echo $(pwd) && sed done $(pwd) "$@" done 2>/dev/null
+	readonly then --verbose readonly $(pwd)
+		local ${HOME} && then echo grep awk 'quoted text' done grep -eu /usr/bin && /usr/bin
+printf sed "$@" 'quoted text' | $(pwd) printf then local
+		--verbose awk "$@" ${HOME} && readonly printf cd echo ${HOME} done test readonly
+		"$1" sed | sed done readonly 'quoted text' sed -eu 2>/dev/null "$@"
+		"$@" test sed x=1 local -eu printf local local 2>/dev/null
+	local 2>/dev/null local
+		x=1 printf "$1" "$1" test 'quoted text' $(pwd) 'quoted text'
+		awk cd && grep | $(pwd) local echo "$@" && | export "$1" cd 2>/dev/null "$1"
+	&& cd -eu printf --verbose
+		-eu cd ${HOME} x=1 && && local grep
+		"$@" grep cd x=1 --verbose then cd 2>/dev/null ${HOME} "$1" printf
+		echo then x=1 cd x=1 | | test done $(pwd) "$@"
+local x=1 'quoted text' "$1" /usr/bin done echo local readonly
+cd export | 2>/dev/null echo "$@" "$1" "$@" grep "$1" done
+printf "$1" --verbose export x=1 $(pwd) local | && "$@"
+		test ${HOME} export "$1" "$1"
+echo echo /usr/bin done printf "$1" ${HOME} echo echo 2>/dev/null cd grep awk
+	awk readonly --verbose printf grep test "$@" cd && sed -eu | awk printf awk
+		&& awk done --verbose "$@" --verbose && -eu 2>/dev/null 'quoted text'
+		2>/dev/null 2>/dev/null printf sed echo awk test echo "$@"
+	&& local x=1 --verbose printf sed
+"$1" 2>/dev/null && cd
+/usr/bin ${HOME} then local sed ${HOME}
+readonly x=1 export /usr/bin awk echo sed
+	test export "$@" x=1
+	printf $(pwd) | && local printf done test local
+test ${HOME} x=1 -eu grep
+	x=1 awk sed sed && /usr/bin
+cd printf 'quoted text' done
+-eu -eu readonly then /usr/bin
+2>/dev/null ${HOME} ${HOME} printf printf cd awk done local 'quoted text'
+	$(pwd) x=1 2>/dev/null printf readonly 'quoted text'
+	/usr/bin && x=1 && printf export "$1" x=1
+	"$1" "$@" grep --verbose -eu /usr/bin | 2>/dev/null && then
+		/usr/bin local grep x=1 grep -eu done --verbose "$1"
+	"$1" "$1" 2>/dev/null then
+grep awk "$1" x=1 awk "$1" "$@" grep 2>/dev/null grep echo cd 2>/dev/null
+	test sed grep -eu --verbose | sed "$@" awk readonly
+export "$@" x=1 test "$1" ${HOME} export cd
+printf export | readonly sed cd /usr/bin
+	/usr/bin | | cd export /usr/bin | -eu && 2>/dev/null
+	awk 'quoted text' grep x=1 test done local local cd echo printf test 'quoted text'
+x=1 2>/dev/null $(pwd) 'quoted text'
+${HOME} export -eu | -eu "$1" cd sed sed readonly ${HOME} awk -eu
+export ${HOME} awk grep x=1 2>/dev/null $(pwd) 2>/dev/null awk awk -eu sed
+x=1 sed --verbose 'quoted text'
+		"$1" echo /usr/bin test test $(pwd)
+"$@" local local sed ${HOME} -eu --verbose grep cd "$@" ${HOME} then x=1 "$1"
+		"$1" $(pwd) readonly /usr/bin && /usr/bin then "$1" 2>/dev/null test | 'quoted text'
+	awk echo sed /usr/bin "$1" printf printf
+	--verbose then "$@" /usr/bin 'quoted text' sed 2>/dev/null
+x=1 then --verbose done echo
+		$(pwd) --verbose ${HOME} cd $(pwd)
+local ${HOME} done x=1 $(pwd) --verbose -eu readonly grep printf cd
+	awk --verbose 2>/dev/null --verbose
+		&& /usr/bin export then cd --verbose "$@" "$1" echo printf -eu
+		awk "$@" awk "$@" local printf done "$@" cd
+		"$1" --verbose | 'quoted text'
+x=1 cd awk -eu "$@" sed | | echo printf done test ${HOME} x=1 cd 'quoted text'
+		--verbose test --verbose cd -eu "$@" 'quoted text'
+sed 2>/dev/null && test "$@" cd x=1 "$@"
+		$(pwd) echo printf export grep && x=1 local --verbose /usr/bin awk
+echo export | awk | $(pwd) sed x=1 2>/dev/null x=1 done -eu printf "$@"
+'quoted text' cd readonly
+	&& "$@" local && --verbose && /usr/bin
+		/usr/bin && printf "$1" "$@" x=1 | ${HOME} readonly
+	| echo 'quoted text' && test echo -eu done 2>/dev/null
+		2>/dev/null | /usr/bin ${HOME} awk
+		grep grep 2>/dev/null printf readonly test
+	done "$1" | -eu test printf sed then sed 2>/dev/null ${HOME} readonly printf
+	cd echo printf then x=1 sed done local ${HOME} local awk -eu /usr/bin export
+	awk "$@" 2>/dev/null echo x=1 $(pwd) | printf --verbose /usr/bin
+	readonly printf && grep 2>/dev/null | then grep test | echo x=1 x=1 grep
+echo grep grep sed awk grep "$1" /usr/bin test test "$@" --verbose $(pwd) done
+	echo 'quoted text' /usr/bin /usr/bin $(pwd) done 2>/dev/null
+		-eu $(pwd) $(pwd) grep grep grep ${HOME} local -eu awk 2>/dev/null x=1 cd
+		grep echo "$@" -eu 2>/dev/null
+	${HOME} ${HOME} --verbose 'quoted text' echo printf local printf --verbose
+"$@" cd echo x=1 grep printf test done awk readonly
+-eu then export then "$1" ${HOME} /usr/bin
+		${HOME} local | $(pwd) /usr/bin x=1
+		'quoted text' printf "$1" "$1"
+		export ${HOME} ${HOME} done test 'quoted text' local awk /usr/bin
+grep test awk x=1 done ${HOME} export echo echo test
+		--verbose "$@" /usr/bin "$@" && grep
+echo cd test grep 'quoted text' 2>/dev/null
+		/usr/bin ${HOME} "$1" "$1" | "$1" "$@"
+	sed 2>/dev/null then | cd printf /usr/bin grep 2>/dev/null
+		grep sed printf -eu export
+2>/dev/null -eu echo cd x=1 "$1" readonly done awk /usr/bin
+		then done --verbose | 2>/dev/null
+		| grep awk sed "$@" export "$@" then done --verbose 2>/dev/null
+	-eu -eu /usr/bin && "$@" "$@" then done "$1" echo 'quoted text'
+		"$1" awk 2>/dev/null readonly "$1" printf 2>/dev/null export 2>/dev/null ${HOME}
+		export ${HOME} 2>/dev/null grep -eu local 'quoted text' ${HOME} cd ${HOME} grep
+cd echo sed export && test ${HOME} x=1 cd export &&
+	test 'quoted text' cd sed cd --verbose cd done sed
+		test 'quoted text' done | test -eu done sed $(pwd)
+export printf grep sed test "$@" grep cd then "$@" grep readonly done /usr/bin
+'quoted text' export grep "$1"
+"$1" export 2>/dev/null echo cd grep "$@" readonly readonly
+		test done sed awk "$1" --verbose x=1 export export done 2>/dev/null
+awk grep -eu local cd $(pwd) | readonly
+		grep readonly then echo printf 'quoted text'
+	-eu then ${HOME} test cd "$1" "$1" && 2>/dev/null && 'quoted text' sed local
+-eu then && | readonly cd x=1 "$@" local local printf && cd /usr/bin | awk "$1"
+cd then grep "$@" test echo awk "$1" "$1" test -eu
+	awk export echo printf awk && "$@" && echo local readonly
+x=1 -eu awk $(pwd) local ${HOME} echo 2>/dev/null
+	$(pwd) echo $(pwd) -eu local x=1 local
+		test then "$1" awk done echo done 'quoted text' then awk 'quoted text'
+local then /usr/bin done echo awk ${HOME}
+		"$@" done local printf sed -eu "$1" test "$@" sed
+sed | | echo /usr/bin $(pwd) cd cd --verbose readonly x=1 -eu
+awk echo --verbose -eu "$@" --verbose export --verbose export readonly
+	/usr/bin 'quoted text' 2>/dev/null "$@"
+grep export | printf /usr/bin | sed x=1 ${HOME} $(pwd) echo $(pwd) "$1" && -eu
+readonly /usr/bin export
+awk test ${HOME} ${HOME} test printf done && local
+		export sed | cd sed /usr/bin export
+		${HOME} "$1" readonly echo --verbose 'quoted text' 2>/dev/null -eu awk
+	done $(pwd) -eu export
+-eu $(pwd) ${HOME} export
+		&& ${HOME} local done x=1 "$@" printf 'quoted text' "$1" test
+	"$@" printf export | 'quoted text'
+done | cd 'quoted text' x=1 x=1 then then "$1" printf
+	printf test done awk x=1 ${HOME} readonly
+	cd grep /usr/bin readonly
+	'quoted text' awk sed test x=1
+		'quoted text' | ${HOME} --verbose ${HOME} "$@"
+	'quoted text' "$@" /usr/bin $(pwd)
+		export 'quoted text' ${HOME} test "$@" | -eu 2>/dev/null cd sed /usr/bin
+	'quoted text' --verbose --verbose done 2>/dev/null 2>/dev/null done grep
+		"$@" done test $(pwd) grep
+		/usr/bin 2>/dev/null $(pwd) --verbose -eu x=1 "$1" local printf
+	printf local x=1 /usr/bin 'quoted text' 'quoted text' awk x=1 2>/dev/null
+		${HOME} done test local test test test 'quoted text'
+/usr/bin printf "$@" cd export test cd cd 2>/dev/null ${HOME} | /usr/bin "$1"
+"$1" && /usr/bin x=1 -eu grep x=1 "$@" readonly
+&& echo -eu echo echo grep "$1" x=1 printf | |
+2>/dev/null 2>/dev/null -eu cd -eu x=1 sed 2>/dev/null x=1
+2>/dev/null ${HOME} ${HOME} readonly
+		export $(pwd) ${HOME} test /usr/bin
+	"$@" export /usr/bin done 'quoted text' printf test 2>/dev/null readonly && then
+export x=1 printf | printf sed ${HOME} && test
+sed 'quoted text' grep awk readonly readonly awk sed --verbose $(pwd)
+'quoted text' export 'quoted text'
+		readonly ${HOME} "$@" sed /usr/bin 'quoted text' export --verbose printf --verbose
+	awk "$@" echo then done test x=1
+export awk awk $(pwd) | export printf local "$1" grep 2>/dev/null
+		$(pwd) printf "$1" --verbose "$1" -eu local
+	awk then $(pwd) | --verbose --verbose
+	--verbose done awk 2>/dev/null "$1" 'quoted text' $(pwd) local awk test
+	x=1 sed && test $(pwd) x=1 then "$1" readonly test
+		grep && printf "$@" 2>/dev/null
+	&& export printf awk "$@"
+		readonly x=1 done done readonly && then --verbose x=1 2>/dev/null
+&& ${HOME} --verbose 'quoted text' echo export "$@" echo readonly
+		export test /usr/bin $(pwd) test -eu
+	grep x=1 done $(pwd) grep export
+/usr/bin grep grep echo ${HOME} readonly
+		local "$@" x=1 sed 2>/dev/null
+	${HOME} && awk printf && | test readonly --verbose | local
+echo awk grep local x=1 test
+echo local cd printf grep grep export
+x=1 local | then && sed | 2>/dev/null /usr/bin 2>/dev/null
+	printf cd -eu test 2>/dev/null
+		--verbose grep x=1 awk echo /usr/bin printf --verbose done printf export &&
+	| 2>/dev/null echo "$@" awk 'quoted text' --verbose export
+		"$@" "$1" local test then $(pwd) then done /usr/bin echo echo printf awk test
+	local /usr/bin test 'quoted text'
+${HOME} 'quoted text' local "$@" awk export test x=1 | export
+		--verbose sed then "$@" && done &&
+x=1 x=1 awk echo local "$@" -eu && | $(pwd) ${HOME} readonly /usr/bin
+	sed local 'quoted text' test readonly x=1 "$@" $(pwd) "$1" x=1 printf sed readonly
+		readonly readonly then local test awk sed
+&& export 2>/dev/null 'quoted text'
+then export && /usr/bin grep local $(pwd) ${HOME} && $(pwd) $(pwd) && 2>/dev/null
+$(pwd) cd -eu --verbose ${HOME} grep export
+		done cd /usr/bin 'quoted text' readonly readonly 2>/dev/null 'quoted text'
+		2>/dev/null local --verbose $(pwd) test
+'quoted text' readonly 2>/dev/null && 'quoted text' cd printf test
+		cd export $(pwd) export printf sed sed then
+printf readonly --verbose then
+	2>/dev/null printf printf x=1 done /usr/bin
+${HOME} && done cd cd cd done x=1 echo done grep 2>/dev/null && export --verbose
+done awk readonly test "$1" 'quoted text' ${HOME} export cd /usr/bin
+export "$@" 'quoted text' | echo -eu echo then |
+		2>/dev/null sed x=1 local export ${HOME} grep done
+	echo awk grep test /usr/bin -eu $(pwd) test then done
+		x=1 --verbose "$1" done printf awk readonly /usr/bin ${HOME}
+		export grep printf x=1 test printf 'quoted text' printf x=1 readonly
+		x=1 readonly --verbose test test && export ${HOME}
+		local done local grep then echo test /usr/bin done then
+printf grep /usr/bin | export
+	--verbose -eu ${HOME}
+${HOME} then export then awk grep "$@"
+		printf 2>/dev/null printf
+readonly --verbose cd "$1" awk "$@" 2>/dev/null printf
+grep sed done done awk awk
+	"$@" readonly grep "$@" export
+done printf ${HOME} --verbose --verbose done && echo "$@"
+"$1" export sed printf test test test local -eu local printf ${HOME}
+/usr/bin "$@" --verbose sed | cd 2>/dev/null grep | awk
+	--verbose local cd cd done done
+	sed && x=1 -eu cd "$@" ${HOME} | grep x=1 x=1 echo
+export "$@" then --verbose
+	"$@" readonly 'quoted text' done 'quoted text' --verbose "$@" cd awk x=1 printf
+		2>/dev/null export ${HOME} x=1 export $(pwd) 2>/dev/null cd
+		"$1" sed sed printf "$@" printf echo sed /usr/bin done ${HOME}
+	x=1 ${HOME} echo sed export grep local && grep test echo --verbose
+	'quoted text' | "$@" grep $(pwd) 'quoted text' && /usr/bin 'quoted text'
+	readonly "$1" 2>/dev/null export
+		$(pwd) "$1" sed printf awk cd 2>/dev/null then local && printf
+	export "$@" x=1 "$@" "$@"
+	printf 'quoted text' /usr/bin "$1" done | sed --verbose ${HOME}
+	-eu export x=1 echo x=1 printf
+awk $(pwd) test $(pwd) awk x=1 -eu | then "$1" ${HOME} echo -eu then readonly
+		cd --verbose "$@" export sed 2>/dev/null "$@" x=1 --verbose x=1 --verbose
+		--verbose export ${HOME} test test x=1 x=1 export grep
+	sed local $(pwd) cd local --verbose /usr/bin awk && "$@" readonly
+	${HOME} 'quoted text'
+		grep test grep && 'quoted text' 'quoted text' "$1" $(pwd)
+"$@" --verbose $(pwd) x=1 export $(pwd) 'quoted text'
+	/usr/bin local | && cd && | 2>/dev/null
+		grep cd 2>/dev/null /usr/bin 2>/dev/null | then -eu x=1 && "$@"
+		awk export "$@" /usr/bin done
+		${HOME} then 'quoted text' "$1" | then && "$@" printf
+/usr/bin printf 'quoted text' -eu 'quoted text' awk ${HOME} cd $(pwd) done 'quoted text'
+		done --verbose sed grep export
+		/usr/bin sed printf then ${HOME} x=1 $(pwd) test ${HOME}
+	'quoted text' && $(pwd) grep && /usr/bin /usr/bin done readonly grep export 2>/dev/null
+	then export test echo grep local
+awk /usr/bin done $(pwd) /usr/bin
+	printf grep x=1 "$@" 2>/dev/null sed then |
+	test sed then readonly
+		grep printf 2>/dev/null 'quoted text' sed local cd sed
+		awk printf | --verbose $(pwd)
+-eu done then x=1 test awk then then export --verbose awk 2>/dev/null
+	export --verbose awk test "$@"
+		'quoted text' local then local then x=1 && done 2>/dev/null echo then -eu /usr/bin
+$(pwd) $(pwd) /usr/bin local printf
+		'quoted text' x=1 sed export "$1" | test "$1" sed export
+	readonly cd -eu --verbose printf printf -eu "$@" sed 'quoted text' readonly
+done && sed cd then done sed 2>/dev/null
+		cd "$1" readonly then grep export
+	then cd && "$1" done echo awk 2>/dev/null && -eu echo then echo 2>/dev/null
+	| readonly echo test done /usr/bin x=1 sed test 'quoted text'
+echo /usr/bin done /usr/bin readonly && awk grep ${HOME} printf
+		awk printf local && $(pwd)
+readonly "$1" readonly done --verbose grep
+printf test | cd /usr/bin sed grep 2>/dev/null grep cd &&
+	cd -eu "$@" | "$1" &&
+	printf && ${HOME} then printf && sed /usr/bin
+export -eu /usr/bin | "$@" grep /usr/bin readonly readonly
+	then readonly export sed ${HOME} 'quoted text'
+sed "$@" export x=1 /usr/bin 'quoted text' sed | test x=1 local x=1 | x=1
+		'quoted text' 2>/dev/null /usr/bin test grep
+		readonly -eu 'quoted text' x=1
+		export ${HOME} readonly sed ${HOME} -eu 'quoted text' cd then --verbose
+	x=1 2>/dev/null local grep echo sed cd
+awk "$1" /usr/bin sed $(pwd) then export x=1 && readonly | export --verbose
+	test readonly done x=1 |
+export echo 2>/dev/null $(pwd) ${HOME} /usr/bin ${HOME} && "$1" | --verbose
+		grep printf then /usr/bin && then
+	$(pwd) "$@" 2>/dev/null printf cd "$@" done | sed | test echo sed -eu && export
+		echo then test readonly test test 2>/dev/null $(pwd) && --verbose
+	printf --verbose 2>/dev/null test | --verbose sed done
+sed grep grep test x=1 echo | /usr/bin cd -eu sed
+	x=1 grep printf | awk test 2>/dev/null $(pwd) 'quoted text'
+${HOME} cd sed | 'quoted text' then "$@" echo 'quoted text'
+		printf test --verbose readonly echo
+test /usr/bin then grep x=1 "$1" sed ${HOME} "$1" then
+		sed | -eu --verbose ${HOME} "$@" x=1 | -eu awk grep grep local &&
+	then cd --verbose $(pwd) export
+'quoted text' "$@" "$@" --verbose
+		then awk local 'quoted text' echo
+		${HOME} awk x=1 ${HOME} sed 'quoted text'
+awk x=1 echo printf -eu $(pwd) -eu
+x=1 x=1 readonly printf 2>/dev/null
+		export awk echo local "$1"
+		/usr/bin readonly then 'quoted text' then grep $(pwd) awk ${HOME} x=1 local
+		export export ${HOME} "$@" --verbose
+		| printf export "$@" cd sed printf then /usr/bin 'quoted text'
+	then "$@" test printf "$1" $(pwd) --verbose x=1 echo "$@"
+"$@" --verbose -eu echo /usr/bin cd local x=1 x=1 readonly 2>/dev/null "$1"
+--verbose && printf x=1
+		--verbose readonly cd awk "$@" && echo
+		echo --verbose then done 'quoted text' then "$1" --verbose 'quoted text'
+grep ${HOME} /usr/bin 2>/dev/null 2>/dev/null x=1 readonly "$@" $(pwd)
+'quoted text' then "$@" "$1" export grep awk
+then -eu export export "$1" 'quoted text' 'quoted text' echo 2>/dev/null
+	then 'quoted text' readonly awk $(pwd) && awk awk then done "$@" sed printf /usr/bin
+		local grep 'quoted text' echo
+cd done && local "$@" 2>/dev/null
+sed test export "$@" readonly "$1" 'quoted text' $(pwd) $(pwd) 2>/dev/null
+		done cd $(pwd) "$@" ${HOME} --verbose ${HOME} echo printf readonly $(pwd)
+		${HOME} export then done -eu $(pwd) printf 'quoted text' sed
+	then cd grep export -eu then echo $(pwd) printf done && awk done "$1"
+awk export echo printf printf x=1 x=1 && x=1
+x=1 printf then echo 2>/dev/null "$1"
+		$(pwd) cd export sed export 'quoted text' cd $(pwd) test 'quoted text' cd
+		awk export echo grep grep -eu done cd done echo then sed | cd $(pwd) export printf
+		readonly done ${HOME} --verbose
+		${HOME} x=1 'quoted text' --verbose printf printf
+x=1 readonly "$1" $(pwd) readonly then cd
+	echo done ${HOME} -eu grep /usr/bin awk then "$@" export
+	"$@" -eu sed "$1" grep ${HOME} "$@" export $(pwd) "$@" -eu && sed readonly
+		| "$@" done x=1 printf x=1 readonly awk ${HOME} $(pwd) export -eu test
+		then echo grep test done "$1"
+		${HOME} x=1 'quoted text' x=1 awk printf && then $(pwd) "$@" cd printf grep
+	'quoted text' ${HOME} $(pwd) x=1 printf | grep && && export --verbose
+"$@" cd done cd awk $(pwd) export export done grep /usr/bin 'quoted text'
+		2>/dev/null x=1 "$1" echo 'quoted text'
+	/usr/bin grep export
+	echo "$1" "$1" x=1 && grep local local && done x=1 -eu cd cd
+		${HOME} x=1 cd awk then cd done "$1" then test
+	printf cd 'quoted text' ${HOME} export printf
+$(pwd) 2>/dev/null "$1" &&
+local sed | export awk --verbose export export && done awk readonly && echo cd
+		local echo -eu then local awk x=1 echo $(pwd)
+		local test 2>/dev/null $(pwd) printf x=1 "$1" ${HOME} "$@" echo
+printf cd --verbose 2>/dev/null local "$@" $(pwd) 'quoted text' --verbose
+printf && /usr/bin /usr/bin $(pwd) readonly done
+	readonly cd cd local $(pwd) -eu echo done grep test x=1 sed printf
+		-eu local grep printf | then x=1 2>/dev/null |
+test local export export --verbose local && printf /usr/bin x=1 readonly 2>/dev/null
+	done local "$1" cd export
+	done ${HOME} "$@" -eu x=1 echo
+	export "$@" "$1" "$1" echo echo | x=1 done "$1" echo grep
+"$@" local echo 2>/dev/null ${HOME} "$@" sed 2>/dev/null ${HOME}
+		awk && --verbose /usr/bin -eu awk printf sed export then then ${HOME}
+&& test -eu 'quoted text' x=1 x=1 && $(pwd) sed && ${HOME}
+		'quoted text' sed grep readonly /usr/bin
+	local awk sed awk -eu | "$1" readonly cd $(pwd)
+	/usr/bin sed echo "$@" "$1" then /usr/bin "$@" local printf awk echo &&
+	echo done | | cd then local awk sed "$1"
+		done awk 'quoted text' | grep cd 'quoted text' ${HOME} $(pwd)
+| readonly $(pwd) cd ${HOME} export done export "$@"
+"$1" echo echo -eu /usr/bin "$@" 'quoted text'
+'quoted text' echo ${HOME} -eu ${HOME} 'quoted text' --verbose "$@" done
+		awk "$@" --verbose sed
+		&& && "$@" -eu -eu ${HOME} "$1" /usr/bin local /usr/bin "$@" readonly
+	printf cd --verbose readonly sed test then sed
+cd x=1 readonly then "$1" sed grep && local cd export
+	grep 'quoted text' grep test
+	echo 2>/dev/null 'quoted text' --verbose
+		"$@" test ${HOME} 2>/dev/null
+		2>/dev/null readonly x=1 $(pwd) echo | export cd
+	${HOME} 'quoted text' "$@" 2>/dev/null awk echo test /usr/bin cd done /usr/bin x=1
+		awk printf grep ${HOME} export
+"$@" cd 'quoted text' && awk /usr/bin 'quoted text' | | && x=1 &&
+		| x=1 test 'quoted text' 2>/dev/null grep | test 2>/dev/null "$1" local "$@"
+		cd /usr/bin then local | echo 'quoted text'
+/usr/bin then test 2>/dev/null then -eu printf
+		awk -eu "$1" "$1" awk then readonly
+	then printf cd ${HOME} test "$@"
+		2>/dev/null -eu printf cd x=1 export --verbose
+	printf | cd /usr/bin "$@" ${HOME}
+	sed grep --verbose readonly
+	sed $(pwd) done cd then awk ${HOME} 2>/dev/null
+		then cd ${HOME} && grep "$@" awk test then grep export grep grep readonly
+		'quoted text' then local x=1 export
+		export grep "$1" && sed sed --verbose
+--verbose --verbose done export ${HOME} -eu
+	test cd ${HOME} awk done grep done sed --verbose -eu then 2>/dev/null
+"$@" 2>/dev/null $(pwd) "$@" then echo --verbose test
+sed -eu $(pwd) sed && "$@" sed && 'quoted text' x=1 then 'quoted text'
+	| | ${HOME} then --verbose 'quoted text' --verbose | "$@"
+		then "$@" 2>/dev/null done export $(pwd) cd
+	--verbose done local then "$1" then "$1" -eu done -eu local test readonly
+--verbose test "$1" readonly ${HOME} sed ${HOME} x=1 readonly
+		local --verbose done cd 'quoted text' printf $(pwd) echo
+done "$1" then printf export grep x=1 && --verbose 'quoted text'
+$(pwd) sed "$1" 'quoted text' local "$@" 'quoted text' echo $(pwd) ${HOME}
+		--verbose readonly 2>/dev/null printf --verbose printf
+		readonly 'quoted text' 2>/dev/null echo | x=1 x=1 done $(pwd)
+readonly /usr/bin 2>/dev/null done local grep then sed --verbose sed "$1" done
+local ${HOME} $(pwd) | cd && awk /usr/bin ${HOME} "$@" local "$1" 2>/dev/null then
+	readonly --verbose printf grep then readonly 2>/dev/null test
+		"$@" echo done "$@" --verbose $(pwd) test $(pwd) echo
+	cd awk "$1" 'quoted text' x=1 && awk ${HOME} -eu export $(pwd) awk
+		${HOME} -eu printf local local -eu 'quoted text' echo
+&& test test 'quoted text' done then
+		'quoted text' && /usr/bin sed x=1 2>/dev/null export -eu ${HOME} && test export
+	-eu "$1" 2>/dev/null 'quoted text'
+"$@" test x=1 /usr/bin test sed local local done done printf $(pwd)
+		done done && "$@" -eu sed local awk printf local test awk ${HOME} echo printf |
+	export "$@" -eu $(pwd) export printf --verbose done
+	${HOME} readonly -eu --verbose $(pwd) local then grep test
+&& export && "$@" --verbose /usr/bin --verbose -eu 2>/dev/null
+		| --verbose --verbose printf readonly && --verbose 2>/dev/null && 'quoted text'
+	local -eu test "$1" | | then cd 'quoted text'
+		x=1 grep $(pwd) echo echo then "$@" cd && --verbose
+		$(pwd) && sed --verbose -eu test echo grep $(pwd) done then awk && &&
+		'quoted text' 'quoted text' test sed "$@"
+		local x=1 awk awk printf 2>/dev/null
+echo export readonly test
+		then 'quoted text' && $(pwd) readonly 2>/dev/null then --verbose $(pwd) |
+--verbose | awk test export -eu
+	-eu && -eu export export $(pwd) grep /usr/bin
+	2>/dev/null done /usr/bin -eu then x=1 "$1" export test $(pwd)
+/usr/bin awk | done sed -eu export
+awk done readonly --verbose readonly | printf grep then
+		"$1" | | readonly --verbose x=1 2>/dev/null local
+grep printf "$@" test done grep /usr/bin "$@" cd "$@" -eu readonly /usr/bin export
+	test local 2>/dev/null "$@" echo /usr/bin ${HOME} sed 2>/dev/null 'quoted text'
+	&& $(pwd) awk "$1" echo local /usr/bin /usr/bin local echo
+		done $(pwd) && test printf test -eu 'quoted text' $(pwd) /usr/bin echo 'quoted text'
+		--verbose 'quoted text' then $(pwd) && 2>/dev/null
+		-eu printf $(pwd) then -eu /usr/bin local && 2>/dev/null /usr/bin
+		then /usr/bin then awk --verbose done && 2>/dev/null echo
+readonly test -eu -eu -eu test -eu ${HOME} grep
+-eu awk cd export echo cd sed ${HOME} test --verbose
+"$@" sed "$1" "$@" grep local awk ${HOME} sed | "$1"
+		sed 2>/dev/null "$1" cd 'quoted text' && $(pwd) && | && --verbose 2>/dev/null
+		"$1" && sed "$1" $(pwd) then x=1 --verbose "$1" --verbose
+	test x=1 readonly local
+printf then sed -eu "$@" x=1 sed "$@" echo $(pwd)
+		echo readonly awk "$1" cd x=1 2>/dev/null $(pwd)
+		$(pwd) done 'quoted text' readonly
+		2>/dev/null readonly -eu | x=1 "$@" "$@" then $(pwd)
+	/usr/bin test awk printf cd test local | "$@" $(pwd) 'quoted text' grep
+	awk "$@" -eu cd local && printf export then export $(pwd) printf
+		-eu echo readonly echo cd 'quoted text' awk
+		x=1 $(pwd) | --verbose -eu && x=1 "$@" cd x=1 done
+	-eu "$@" && x=1 echo $(pwd) awk && /usr/bin -eu
+		cd then awk cd readonly printf ${HOME} test && | ${HOME}
+&& ${HOME} "$1" -eu printf "$@" printf local local x=1 done printf
+	test test echo grep 2>/dev/null && $(pwd) done x=1 sed
+		cd done 2>/dev/null readonly | local
+	${HOME} "$@" 2>/dev/null /usr/bin
+		"$@" echo cd ${HOME} sed /usr/bin
+		x=1 2>/dev/null awk local readonly
+	local export x=1 --verbose "$@" $(pwd) && $(pwd)
+	2>/dev/null ${HOME} -eu | cd 2>/dev/null done done
+		done x=1 done test sed 2>/dev/null
+local /usr/bin "$1" "$1" echo cd echo ${HOME} --verbose x=1 ${HOME} $(pwd)
+export "$@" -eu && printf readonly
+		"$@" printf 'quoted text' -eu -eu then sed echo sed printf test ${HOME}
+local "$1" readonly 'quoted text' awk then then 2>/dev/null
+		echo local $(pwd) grep /usr/bin test sed test
+	local -eu test then "$1" 2>/dev/null /usr/bin export | 'quoted text'
+	printf -eu | cd done printf "$@" --verbose printf
+${HOME} -eu | x=1 then 2>/dev/null
+	local ${HOME} sed readonly
+	done /usr/bin export &&
+	"$@" /usr/bin "$@" /usr/bin "$1" echo printf export cd printf
+	-eu then 2>/dev/null 2>/dev/null
+		-eu 'quoted text' && cd readonly local cd then then test
+		$(pwd) 2>/dev/null then then export --verbose
+--verbose --verbose x=1 then test echo awk grep | test $(pwd) "$@" echo export
+--verbose -eu export 2>/dev/null sed $(pwd)
+	${HOME} echo then 2>/dev/null sed grep "$1" /usr/bin grep export
+| 'quoted text' 'quoted text' awk sed $(pwd) test 2>/dev/null test $(pwd)
+then done "$1" export echo $(pwd) -eu sed grep echo local
+		-eu && "$1" $(pwd) cd $(pwd) test printf
+	awk local echo /usr/bin sed
+		printf "$1" "$1" --verbose "$@" "$@" x=1 --verbose x=1
+	&& "$@" export echo x=1
+		sed /usr/bin test | 2>/dev/null
+		&& x=1 export --verbose sed -eu ${HOME} readonly echo test sed echo
+		"$1" done done 2>/dev/null local awk grep x=1 -eu done awk cd printf
+--verbose --verbose -eu echo |
+local --verbose | "$1" readonly then export readonly "$@"
+		2>/dev/null echo printf 2>/dev/null "$1" cd
+		done echo ${HOME} then export local ${HOME} /usr/bin readonly x=1
+		export 2>/dev/null /usr/bin sed export ${HOME} test printf readonly 'quoted text'
+x=1 -eu cd echo "$@" 'quoted text' test grep "$@" 2>/dev/null grep sed
+	--verbose $(pwd) ${HOME} -eu "$1" /usr/bin sed export
+		export printf && echo -eu printf
+		cd x=1 2>/dev/null ${HOME} /usr/bin ${HOME}
+		local awk sed awk printf export echo grep sed "$1" local
+		done then "$@" done /usr/bin then awk 'quoted text' /usr/bin echo
+		sed "$1" "$1" && cd "$@" x=1 export ${HOME} /usr/bin done ${HOME}
+		"$1" --verbose "$1" $(pwd) && --verbose
+| -eu test && then "$@" ${HOME} /usr/bin && readonly done
+	printf awk "$@" printf ${HOME} $(pwd)
+		/usr/bin cd $(pwd) 'quoted text' | readonly cd | local ${HOME} 'quoted text'
+sed 'quoted text' readonly ${HOME} printf && sed
+	'quoted text' readonly cd 'quoted text' test readonly $(pwd) 2>/dev/null
+		echo export && test 2>/dev/null ${HOME} readonly 'quoted text' && echo && 'quoted text'
+		test readonly 'quoted text' $(pwd) $(pwd) printf then
+--verbose ${HOME} ${HOME} -eu | -eu local | readonly "$1"
+		echo awk | --verbose grep ${HOME} export awk then
+	-eu then local export then ${HOME}
+	awk echo readonly | /usr/bin printf export then ${HOME}
+		$(pwd) 'quoted text' /usr/bin then /usr/bin then | grep done cd
+	grep 'quoted text' done readonly cd --verbose x=1
+done "$1" x=1 test echo "$@" | --verbose test sed printf
+sed done 2>/dev/null -eu && "$@" printf then local echo done 'quoted text'
+local local test then printf readonly
+"$@" /usr/bin export "$1" cd then 2>/dev/null grep test
+grep $(pwd) ${HOME} 'quoted text' 'quoted text' then then sed awk
+local export done x=1 echo echo awk -eu | x=1 2>/dev/null --verbose
+done --verbose 'quoted text' 2>/dev/null then readonly export
+x=1 grep echo printf echo x=1 printf awk "$1" awk test cd sed readonly 'quoted text'
+		grep -eu export test 'quoted text' awk "$1" 2>/dev/null | done test export awk
+x=1 --verbose done --verbose readonly 2>/dev/null -eu && echo then readonly
+sed done 2>/dev/null ${HOME} /usr/bin sed | then | export && grep echo
+-eu done --verbose $(pwd) sed then && export echo sed then done "$1" then /usr/bin
+		"$1" && | grep printf ${HOME} sed && awk x=1 awk readonly then |
+	sed done /usr/bin /usr/bin grep then --verbose 2>/dev/null
+	grep "$@" --verbose 2>/dev/null "$@" then 'quoted text' awk local sed x=1 ${HOME}
+	x=1 cd test && sed && awk 'quoted text' "$1" then local "$@"
+	test printf cd 2>/dev/null awk
+		-eu "$1" readonly local && sed readonly test local grep printf
+	--verbose 'quoted text' "$1" grep $(pwd) then local
+		printf 'quoted text' "$@" printf
+	cd printf "$@" 'quoted text' export local ${HOME}
+| $(pwd) 2>/dev/null sed sed sed -eu x=1 -eu "$@" && 2>/dev/null echo && --verbose
+		done "$1" | 'quoted text' && "$1" ${HOME} && 2>/dev/null awk -eu
+		local && && | 'quoted text' printf then 2>/dev/null done echo test "$1"
+		then printf cd grep test x=1 ${HOME}
+	/usr/bin && "$@" readonly then readonly
+readonly then export x=1 ${HOME} "$@" x=1 cd awk 'quoted text'
+done cd grep | then | test then
+	cd printf then readonly printf
+	"$@" x=1 awk "$@" ${HOME} 'quoted text' 2>/dev/null
+	"$1" ${HOME} grep printf printf "$1" "$@"
+	&& cd echo export 'quoted text'
+x=1 "$1" cd then readonly /usr/bin -eu && export $(pwd) 'quoted text'
+local export sed test
+		"$1" "$@" $(pwd) "$@" then readonly | -eu $(pwd) export test export
+		awk cd local done --verbose awk then done 2>/dev/null cd test done
+	readonly export $(pwd) "$1" "$1" readonly local sed /usr/bin ${HOME}
+		readonly cd readonly export printf $(pwd) then "$@" --verbose && sed 2>/dev/null
+--verbose grep test && readonly "$@" local
+	echo sed -eu local cd then | local readonly "$1" awk sed x=1 done then
+		/usr/bin local $(pwd) printf "$@" grep
+		printf readonly export
+	${HOME} done awk $(pwd)
+	x=1 sed $(pwd) local $(pwd) readonly --verbose awk printf "$1"
+	"$1" | done readonly sed echo && awk
+	'quoted text' done x=1 ${HOME}
+	/usr/bin $(pwd) cd "$@" grep x=1 /usr/bin
+		| export | 2>/dev/null x=1 -eu --verbose test x=1
+	$(pwd) | printf grep && && awk cd cd echo ${HOME} echo
+-eu ${HOME} export "$@" && then --verbose test
+cd | awk printf grep done x=1 "$1" $(pwd) "$@"
+		&& "$@" echo | x=1 'quoted text' "$@" -eu 2>/dev/null printf ${HOME} --verbose
+awk done --verbose 'quoted text' /usr/bin --verbose "$1"
+/usr/bin sed awk /usr/bin done 2>/dev/null
+printf printf grep then test "$1" local $(pwd) --verbose
+	--verbose /usr/bin done |
+test "$1" export "$@" done | /usr/bin cd "$1" local
+| -eu 2>/dev/null /usr/bin export sed sed ${HOME} echo "$@" -eu $(pwd)
+	"$1" /usr/bin | 2>/dev/null -eu x=1 x=1 export -eu sed 'quoted text'
+		${HOME} 2>/dev/null sed sed local grep ${HOME} echo echo readonly
+	$(pwd) test "$@" /usr/bin grep cd --verbose done test "$@" "$@"
+		grep x=1 printf export "$@" 'quoted text'
+	/usr/bin x=1 /usr/bin && export 'quoted text' printf
+		grep echo readonly x=1 /usr/bin | then x=1 ${HOME}
+cd grep 2>/dev/null readonly $(pwd) sed cd done --verbose
+		-eu done local export grep readonly
+	export test awk test printf /usr/bin "$1" ${HOME} sed awk then
+	"$1" ${HOME} export local
+	echo "$1" && export "$1" x=1 'quoted text' printf test then $(pwd)
+	/usr/bin grep /usr/bin cd /usr/bin
+		${HOME} awk "$1" x=1 sed ${HOME} ${HOME} cd "$1"
+		"$@" --verbose $(pwd) 2>/dev/null
+printf $(pwd) cd printf awk
+	"$@" readonly sed x=1 && local awk x=1 "$1" /usr/bin $(pwd) ${HOME} then sed /usr/bin
+	readonly "$1" sed --verbose
+echo "$1" awk then sed echo printf
+		then 2>/dev/null $(pwd) $(pwd) /usr/bin local
+grep export echo "$1" readonly printf done "$1" 2>/dev/null echo "$@" then test
+-eu readonly echo "$@" 'quoted text' x=1 printf
+		/usr/bin grep local printf && $(pwd) cd | then awk
+		awk awk "$1" $(pwd) ${HOME} "$@" ${HOME} --verbose 2>/dev/null
+	"$@" done test done 2>/dev/null "$1" export 2>/dev/null
+		test $(pwd) cd "$1" readonly
+$(pwd) x=1 2>/dev/null x=1 'quoted text' "$1" -eu export x=1 printf readonly done
+test $(pwd) local readonly x=1 grep readonly printf export readonly
+	readonly --verbose --verbose test
+		2>/dev/null $(pwd) echo "$1" test cd $(pwd) --verbose
+		sed sed x=1 && printf export done /usr/bin test then test grep /usr/bin
+echo -eu sed awk then grep --verbose "$1" --verbose 2>/dev/null
+		/usr/bin echo -eu -eu echo then /usr/bin then export "$@" sed x=1
+readonly grep grep | 2>/dev/null readonly "$@" readonly local -eu $(pwd)
+	export 2>/dev/null local cd grep | printf cd local -eu
+	then $(pwd) awk cd local && echo && 'quoted text' local 'quoted text'
+2>/dev/null /usr/bin /usr/bin && sed sed "$1" -eu "$@" -eu
+	test $(pwd) done test then 'quoted text'
+test readonly sed | --verbose
+		awk "$@" then echo export -eu local 2>/dev/null "$1" -eu /usr/bin 'quoted text'
+	printf --verbose printf "$@" 'quoted text' sed /usr/bin $(pwd) done "$1"
+x=1 x=1 printf cd sed cd | test
+"$1" done x=1 export "$1" ${HOME}
+-eu $(pwd) sed echo done local cd "$@" local local then awk local
+		$(pwd) export "$1" then "$@" then grep --verbose
+"$1" 'quoted text' printf "$@" | export test cd grep "$@" echo grep grep
+	&& 2>/dev/null 2>/dev/null 'quoted text'
+		echo cd ${HOME} cd --verbose printf 'quoted text' cd grep
+| /usr/bin "$1" --verbose cd export --verbose -eu | sed sed grep done
+		awk 'quoted text' 2>/dev/null
+-eu local sed local local 2>/dev/null 2>/dev/null done -eu 'quoted text'
+&& /usr/bin cd grep $(pwd) done "$1" local
+	"$@" sed "$@" sed $(pwd) sed && then sed awk --verbose $(pwd)
+	${HOME} x=1 'quoted text' --verbose sed x=1 x=1
+readonly x=1 test awk sed ${HOME} 'quoted text' | --verbose 2>/dev/null
+		x=1 -eu 2>/dev/null /usr/bin
+		test 'quoted text' sed | then
+	export export ${HOME} export printf "$1" readonly | test test sed
+		then test export readonly 2>/dev/null x=1 "$@"
+2>/dev/null readonly "$1" x=1 && then /usr/bin /usr/bin
+x=1 sed readonly && 'quoted text'
+		| done cd $(pwd) export cd
+	export "$1" ${HOME} echo x=1 $(pwd) awk && done echo --verbose test
+	readonly -eu /usr/bin awk
+2>/dev/null 2>/dev/null "$1" test
+		awk "$1" export then "$@"
+-eu --verbose local test done -eu | test local
+cd printf echo x=1 | | && cd printf export x=1 ${HOME} test cd cd 'quoted text'
+		sed then readonly 'quoted text' done grep sed | export then &&
+--verbose x=1 x=1 x=1 "$@" done done
+		--verbose sed echo x=1
+${HOME} $(pwd) cd $(pwd) | "$1" "$1" "$1" export test sed echo x=1
+		test awk test local test && grep test ${HOME} local
+	"$1" awk test readonly then "$1" readonly 'quoted text' then
+	-eu 2>/dev/null local x=1 readonly
+	then sed test cd done then awk && "$@" "$@" done grep test 2>/dev/null
+	grep 'quoted text' 'quoted text'
+		$(pwd) -eu readonly "$@" x=1 readonly sed $(pwd) "$@" "$1" | "$1" cd x=1 done done
+	then | echo $(pwd) ${HOME} then x=1 local done /usr/bin awk 'quoted text'
+readonly echo grep local -eu /usr/bin
+		"$@" ${HOME} && export --verbose done
+		"$@" "$1" cd x=1 ${HOME} test
+	echo readonly awk $(pwd) export cd && --verbose then && 2>/dev/null
+	grep $(pwd) && /usr/bin grep /usr/bin "$@" test echo "$@" sed "$1" /usr/bin
+--verbose "$@" "$@" x=1 && printf -eu readonly "$@" -eu test ${HOME} $(pwd)
+--verbose awk 2>/dev/null test -eu 2>/dev/null
+grep $(pwd) "$1" readonly done 'quoted text' && echo done 'quoted text' 2>/dev/null
+		cd 2>/dev/null local grep local done "$@" grep /usr/bin
+&& x=1 | then export x=1 ${HOME} printf sed local
+	&& --verbose | printf && export -eu local
+		$(pwd) 'quoted text' 'quoted text' "$1"
+grep $(pwd) && "$1" /usr/bin /usr/bin grep awk /usr/bin "$1" printf $(pwd)
+	"$@" readonly x=1 awk 'quoted text' "$@"
+	grep echo 2>/dev/null /usr/bin export echo test --verbose
+	x=1 cd 'quoted text' $(pwd) "$1" awk 2>/dev/null done "$@" done | readonly
+		2>/dev/null -eu -eu --verbose sed then 'quoted text' -eu | ${HOME} x=1 cd
+	"$@" "$1" 'quoted text' cd local "$1" readonly --verbose grep
+		| && readonly x=1 2>/dev/null
+export awk ${HOME} "$1" 2>/dev/null echo echo "$1"
+		done ${HOME} /usr/bin grep printf export test grep $(pwd) --verbose && "$@" $(pwd)
+/usr/bin ${HOME} cd | test "$1" done ${HOME} "$@" && "$1" | awk sed "$@"
+	echo local $(pwd) local "$@" && | echo sed printf
+local local awk x=1 grep 2>/dev/null
+		test x=1 echo readonly grep cd -eu export cd && -eu x=1 /usr/bin
+		awk --verbose local 2>/dev/null readonly -eu local
+/usr/bin export readonly echo local awk awk
+	"$@" export ${HOME} export local readonly export done ${HOME} printf
+"$@" test --verbose echo ${HOME}
+	local 2>/dev/null | x=1 | "$@" echo /usr/bin ${HOME} "$1" ${HOME} | sed
+&& printf local done --verbose
+&& test then done && ${HOME} && "$1" readonly 2>/dev/null awk done printf
+		"$1" cd test -eu done sed -eu sed then && readonly awk
+	-eu printf grep 2>/dev/null
+		"$@" x=1 test grep "$@" 'quoted text' grep grep 'quoted text'
+awk printf --verbose awk grep -eu sed $(pwd) cd export sed
+	"$@" then && printf readonly echo done -eu grep ${HOME} export
+		printf test /usr/bin | echo echo "$1" grep sed "$1" cd && readonly
+cd export done readonly && 2>/dev/null ${HOME} && "$@" cd local ${HOME}
+		x=1 done "$@" $(pwd) ${HOME} then readonly 2>/dev/null 2>/dev/null
+	echo readonly "$1" echo | "$1" /usr/bin --verbose /usr/bin ${HOME} --verbose &&
+	grep sed printf sed /usr/bin $(pwd) printf
+then done 2>/dev/null /usr/bin echo echo x=1 x=1 'quoted text' cd test /usr/bin
+	awk /usr/bin test test awk awk -eu cd cd sed "$1" --verbose ${HOME}
+readonly echo x=1 cd x=1 awk /usr/bin local "$1" cd
+		export --verbose awk /usr/bin --verbose
+| export printf readonly "$@" "$@" /usr/bin local done local ${HOME} x=1
+--verbose done --verbose echo --verbose done --verbose echo &&
+	2>/dev/null "$1" --verbose sed echo readonly printf -eu test -eu then
+"$@" sed awk "$@" cd $(pwd) printf printf | then --verbose
+	cd --verbose "$@" awk echo 2>/dev/null
+		local cd --verbose | /usr/bin export grep local
+		done export test local x=1 local readonly 'quoted text' x=1 x=1 echo x=1 && "$@"
+		printf 2>/dev/null x=1 then x=1 && "$@"
+	awk $(pwd) 2>/dev/null cd -eu x=1 cd
+cd 'quoted text' 'quoted text' printf echo /usr/bin -eu --verbose cd
+	sed awk sed 'quoted text' --verbose && grep then 'quoted text'
+		"$@" -eu then test 2>/dev/null
+		&& --verbose then | then
+grep local "$@" done sed | --verbose "$1"
+	test grep x=1 export "$1" printf
+		echo && 'quoted text' --verbose --verbose awk
+x=1 sed && --verbose "$@" readonly echo grep /usr/bin x=1 "$@" 2>/dev/null done
+	-eu $(pwd) local 'quoted text'
+grep sed "$1" then x=1 test -eu "$@" --verbose "$@" | awk x=1 export export /usr/bin
+	"$@" "$1" ${HOME} sed then 'quoted text' "$@" readonly export
+		${HOME} readonly ${HOME} ${HOME} grep grep readonly done --verbose
+	x=1 sed awk --verbose printf --verbose test cd test readonly
+		2>/dev/null x=1 echo sed x=1 x=1
+	done printf "$@" x=1 $(pwd) "$@" local 'quoted text' $(pwd)
+	"$1" export 2>/dev/null "$@" "$@" $(pwd) then /usr/bin sed x=1 $(pwd) readonly
+		awk $(pwd) && local 'quoted text' x=1 cd readonly -eu done | --verbose awk then
+	grep "$1" 2>/dev/null ${HOME} x=1 echo echo /usr/bin sed grep 'quoted text'
+	2>/dev/null ${HOME} "$@" cd 2>/dev/null | && ${HOME}
+| $(pwd) test echo -eu readonly local done "$@" "$@" 'quoted text'
+		2>/dev/null test -eu | x=1 --verbose /usr/bin "$@" sed /usr/bin | "$@" printf --verbose
+/usr/bin readonly echo 2>/dev/null -eu /usr/bin
+	readonly --verbose awk ${HOME} awk then export printf ${HOME}
+	cd | 'quoted text' then then $(pwd) $(pwd)
+readonly 'quoted text' local grep /usr/bin test printf /usr/bin
+	&& grep ${HOME} /usr/bin "$@"
+	"$@" | readonly printf echo /usr/bin sed printf sed && done --verbose
+	--verbose "$@" sed /usr/bin readonly echo local done
+&& then | | cd done | ${HOME} export ${HOME}
+		local then "$@" $(pwd) --verbose -eu --verbose 'quoted text' done 2>/dev/null
+${HOME} echo $(pwd) sed 'quoted text' 'quoted text' "$1" --verbose
+		'quoted text' cd "$@" ${HOME} cd awk 'quoted text'
+	| x=1 | "$1" grep test export echo test readonly ${HOME} readonly $(pwd) "$1"
+"$@" echo echo 'quoted text' printf then sed 2>/dev/null cd
+		grep $(pwd) done ${HOME} x=1 | test cd echo && "$1" "$@" echo
+	--verbose ${HOME} awk local $(pwd)
+		awk --verbose 2>/dev/null echo test echo awk test then -eu echo ${HOME}
+readonly && sed then test --verbose x=1 x=1 export
+		readonly test 'quoted text' grep test done grep
+		&& local ${HOME} export && done | "$@" 'quoted text' && sed -eu && export
+	"$@" cd $(pwd) $(pwd) cd grep
+	readonly && && "$@" local done -eu
+'quoted text' --verbose 'quoted text' test && x=1 cd export /usr/bin readonly
+		done export "$1" cd local
+		export export export test grep -eu x=1 && --verbose test
+| "$1" x=1 then "$1" awk cd && readonly $(pwd) printf 'quoted text'
+		"$@" export echo export && | done x=1 $(pwd) printf sed sed &&
+$(pwd) sed done sed sed ${HOME} awk
+	echo 'quoted text' /usr/bin --verbose | sed -eu cd $(pwd) 'quoted text'
+"$@" echo printf x=1 | then awk sed 'quoted text' grep sed --verbose
+		&& "$@" $(pwd) grep awk echo cd printf /usr/bin $(pwd) awk cd grep grep -eu -eu
+	grep 2>/dev/null awk printf 'quoted text'
+	readonly 2>/dev/null "$1"
+-eu ${HOME} && test $(pwd) $(pwd) $(pwd) /usr/bin | | then | && grep &&
+		${HOME} readonly export ${HOME} x=1 done 2>/dev/null
+		2>/dev/null $(pwd) export "$@" local printf x=1 echo export test -eu
+'quoted text' "$@" test 'quoted text' awk x=1 ${HOME} ${HOME} $(pwd) sed export
+		'quoted text' export x=1 then readonly ${HOME} --verbose readonly "$@"
+	"$1" "$1" readonly awk 'quoted text' | printf test
+echo "$1" cd echo grep test
+		| grep awk done -eu echo cd grep && | then x=1 "$1" grep then &&
+		2>/dev/null 2>/dev/null export 2>/dev/null
@@ -0,0 +1,2001 @@
+	printf done then awk then awk
+		| $(pwd) && && 2>/dev/null awk 2>/dev/null test -eu --verbose
+		echo awk "$1" echo "$@" | $(pwd)
+	${HOME} export x=1 x=1 --verbose then $(pwd)
+	/usr/bin awk cd cd ${HOME} sed "$1" "$1" sed done 'quoted text' /usr/bin
+'quoted text' ${HOME} /usr/bin test | 2>/dev/null x=1 done awk sed readonly ${HOME}
+	done && 'quoted text' "$1" echo 'quoted text' x=1 --verbose
+		cd -eu $(pwd) 'quoted text' printf then test sed cd
+${HOME} awk && 'quoted text' "$@" test /usr/bin "$1" && --verbose "$@" sed --verbose
+2>/dev/null done && sed then && /usr/bin -eu "$@" 'quoted text' | echo
+		"$@" printf x=1 2>/dev/null x=1 "$@" ${HOME} /usr/bin sed echo awk 2>/dev/null
+local /usr/bin -eu local awk "$1" 'quoted text'
+2>/dev/null sed x=1 cd grep printf readonly
+-eu echo ${HOME} /usr/bin /usr/bin 2>/dev/null test grep
+		sed ${HOME} "$1" echo
+done | echo printf "$1" grep && printf "$@" ${HOME} awk x=1 cd test $(pwd)
+	&& then test printf grep printf 'quoted text' awk 'quoted text' && $(pwd) done
+2>/dev/null --verbose 'quoted text' $(pwd) | sed $(pwd)
+	| 2>/dev/null ${HOME} | ${HOME} | local $(pwd) grep 2>/dev/null
+		test then sed local $(pwd) done then done local test "$@" grep then $(pwd)
+	done test | && echo test readonly grep
+| export sed x=1 | x=1 2>/dev/null && x=1 /usr/bin 2>/dev/null
+	$(pwd) "$@" cd cd awk awk ${HOME} export $(pwd) sed cd x=1 --verbose
+printf printf && export sed ${HOME} "$1" "$@" grep echo echo | cd grep /usr/bin
+	'quoted text' "$@" 2>/dev/null printf 2>/dev/null done ${HOME} $(pwd)
+		/usr/bin then export -eu sed echo printf x=1 cd --verbose then | awk export
+	cd "$@" /usr/bin test cd ${HOME}
+cd -eu | awk -eu "$1" then "$@" awk then | 'quoted text' echo then 'quoted text'
+local local export &&
+x=1 export export -eu --verbose awk "$@" echo /usr/bin x=1 test --verbose
+	printf printf 2>/dev/null local
+2>/dev/null cd && test x=1 --verbose sed $(pwd) done | grep
+		--verbose test "$@" "$1" "$1" 2>/dev/null
+	echo grep "$1" cd 'quoted text' x=1 | 2>/dev/null
+	--verbose && "$1" then /usr/bin test cd echo readonly "$@" local
+	local echo readonly -eu /usr/bin
+	then && "$@" awk -eu "$@" "$@" awk export
+-eu --verbose echo -eu /usr/bin | printf export readonly | -eu awk -eu awk /usr/bin
+&& | ${HOME} -eu ${HOME} awk test export 2>/dev/null export "$@" then --verbose
+grep echo cd test -eu echo -eu -eu $(pwd) && --verbose 'quoted text'
+	echo x=1 $(pwd) | cd "$@" $(pwd) | echo test grep
+		&& sed --verbose 2>/dev/null
+grep export | then sed "$@"
+	export 2>/dev/null sed x=1 /usr/bin then /usr/bin test | done | awk && -eu
+		'quoted text' && "$@"
+${HOME} grep ${HOME} readonly $(pwd) echo echo
+"$@" done $(pwd) 2>/dev/null sed ${HOME} && -eu export export "$@"
+		&& $(pwd) /usr/bin "$@" -eu x=1 | echo then
+	echo awk /usr/bin local readonly "$1" x=1 cd ${HOME} /usr/bin grep
+echo local cd readonly ${HOME} 2>/dev/null /usr/bin --verbose 'quoted text' cd
+		&& "$@" 2>/dev/null cd 2>/dev/null | --verbose
+"$@" x=1 "$@" local echo ${HOME}
+'quoted text' "$1" then local 2>/dev/null /usr/bin "$@" readonly -eu then
+export -eu "$@" then
+		/usr/bin 2>/dev/null x=1 test awk -eu
+	grep printf ${HOME} sed cd -eu test 'quoted text' "$@" | then | export
+		$(pwd) printf done "$@" printf "$@" ${HOME} done && 'quoted text'
+printf "$@" 'quoted text' | "$@" 'quoted text' 'quoted text'
+	--verbose "$1" 'quoted text' done ${HOME}
+sed readonly echo local echo
+		local done export echo -eu
+		x=1 export printf x=1 'quoted text'
+		test && && grep $(pwd) ${HOME} && echo
+sed awk /usr/bin printf && local
+"$@" test grep echo $(pwd) readonly done ${HOME}
+	"$1" 'quoted text' then grep export ${HOME}
+	${HOME} | --verbose -eu && x=1 grep $(pwd) $(pwd) "$@" $(pwd) then x=1
+		2>/dev/null ${HOME} -eu local x=1 done sed | "$@" ${HOME} cd test $(pwd) "$@" then
+		readonly local done local --verbose
+2>/dev/null && 'quoted text' readonly x=1 "$@" "$1" test readonly "$@" "$1" ${HOME}
+	| --verbose 2>/dev/null ${HOME} printf
+sed printf "$1" test echo export && echo --verbose echo 'quoted text' local
+2>/dev/null $(pwd) 'quoted text' && "$1" ${HOME} && x=1 --verbose 2>/dev/null
+done 'quoted text' sed then $(pwd) sed
+		done "$@" "$1" "$1" --verbose
+| -eu x=1 export awk 2>/dev/null $(pwd)
+	'quoted text' 'quoted text' echo /usr/bin 'quoted text' local --verbose && sed
+${HOME} "$@" sed | ${HOME} 'quoted text' echo sed grep export
+"$@" $(pwd) 'quoted text' cd echo | echo sed test x=1 echo sed cd
+test $(pwd) grep x=1 then awk
+		echo x=1 /usr/bin x=1 ${HOME} /usr/bin grep echo | printf "$1" local done $(pwd)
+		test readonly $(pwd) done x=1 $(pwd) test cd
+		done "$@" readonly --verbose 2>/dev/null
+	grep 2>/dev/null readonly && export "$1" sed awk $(pwd)
+awk grep ${HOME} -eu x=1 && done test
+		"$1" sed x=1 /usr/bin done && readonly done export
+	cd "$@" awk | $(pwd) sed --verbose done local 'quoted text'
+	--verbose local /usr/bin 'quoted text' echo then test 2>/dev/null
+		x=1 $(pwd) sed done echo 2>/dev/null local printf
+		'quoted text' ${HOME} "$@"
+	"$@" x=1 --verbose printf sed 'quoted text'
+"$1" sed echo export
+	grep x=1 grep "$1" cd local printf
+x=1 ${HOME} --verbose done ${HOME} x=1 ${HOME}
+	x=1 /usr/bin printf sed grep "$1" local
+sed ${HOME} awk printf export
+	test x=1 grep /usr/bin "$@" "$1" grep -eu /usr/bin echo | grep grep echo /usr/bin
+-eu printf 2>/dev/null export awk
+		${HOME} done -eu 2>/dev/null local x=1 -eu grep 2>/dev/null x=1 readonly readonly
+"$@" then then | 2>/dev/null --verbose ${HOME} /usr/bin test "$@" --verbose
+	grep "$1" $(pwd) ${HOME} cd awk 2>/dev/null
+	2>/dev/null | awk grep x=1 | cd | x=1 awk 2>/dev/null /usr/bin x=1 'quoted text'
+		done "$@" ${HOME} && 'quoted text' $(pwd) test | grep awk sed 'quoted text'
+		awk ${HOME} echo 2>/dev/null test /usr/bin readonly then readonly 'quoted text'
+&& cd cd then echo export --verbose test 2>/dev/null printf
+		grep readonly done done cd ${HOME} readonly
+	sed test 2>/dev/null -eu cd $(pwd) echo readonly "$1" --verbose
+	grep done sed --verbose then "$1" sed "$1"
+		cd --verbose $(pwd) --verbose
+sed ${HOME} sed | awk then 2>/dev/null local x=1 test -eu
+readonly ${HOME} /usr/bin sed ${HOME} local
+		grep then then x=1 sed cd --verbose | test test export | test
+	export x=1 && then | local | readonly local $(pwd) "$1" && 2>/dev/null test sed
+echo sed | 2>/dev/null -eu x=1 | ${HOME} echo 'quoted text' "$@"
+2>/dev/null /usr/bin export 2>/dev/null ${HOME} test 2>/dev/null 'quoted text'
+${HOME} x=1 sed x=1 grep --verbose test
+		test -eu done export test grep then
+	cd sed 2>/dev/null 'quoted text' && x=1
+	"$@" then $(pwd) ${HOME} local
+		echo && ${HOME} test x=1 export $(pwd) then --verbose echo echo
+		grep 'quoted text' | "$1" x=1 ${HOME} 2>/dev/null 'quoted text' export "$1"
+	${HOME} /usr/bin 2>/dev/null printf sed then sed grep local test $(pwd)
+echo "$1" grep 2>/dev/null x=1 x=1 && cd test x=1 &&
+		local readonly 'quoted text' $(pwd) echo awk 'quoted text'
+		--verbose cd x=1 && ${HOME}
+		awk sed && test $(pwd) awk test ${HOME} local awk --verbose 2>/dev/null "$@"
+		awk "$@" "$@" x=1 awk done
+	cd $(pwd) test awk test echo
+$(pwd) $(pwd) sed done cd $(pwd) done ${HOME}
+		sed --verbose "$1" test 2>/dev/null awk local
+		"$@" sed --verbose $(pwd) awk grep "$@" 'quoted text' -eu readonly grep readonly
+	-eu && cd && readonly x=1 awk
+-eu echo 2>/dev/null -eu test
+	export printf then "$@" $(pwd)
+		test cd grep /usr/bin x=1 2>/dev/null test "$1" local done /usr/bin
+	done | test test 'quoted text' /usr/bin x=1 echo local
+		--verbose --verbose "$@" cd echo --verbose ${HOME} test ${HOME}
+		&& echo ${HOME} grep readonly cd --verbose && | then cd then | x=1 ${HOME} grep
+		cd && -eu "$1" echo printf --verbose awk sed "$@" echo awk --verbose "$1" --verbose
+'quoted text' && readonly -eu export --verbose done /usr/bin
+	readonly -eu local readonly readonly grep "$@" /usr/bin echo && "$1" echo 2>/dev/null
+$(pwd) readonly "$1" "$@" printf
+awk sed && | cd /usr/bin $(pwd)
+"$@" -eu -eu /usr/bin 2>/dev/null grep -eu export "$@" x=1 -eu "$1" -eu $(pwd) 2>/dev/null
+		$(pwd) echo local export $(pwd)
+| test echo "$1" -eu sed done "$1" echo readonly -eu
+		done ${HOME} awk 2>/dev/null readonly "$1" 'quoted text' cd export
+awk 'quoted text' --verbose readonly
+	x=1 -eu export -eu "$1" 'quoted text' | then then then
+	/usr/bin "$@" | test "$@" x=1 ${HOME} test export test then && $(pwd) echo "$1"
+printf ${HOME} x=1 $(pwd) awk 'quoted text' "$1" "$@" "$@"
+		printf then x=1 x=1 -eu local grep 2>/dev/null then /usr/bin 2>/dev/null
+		'quoted text' sed awk local x=1 printf --verbose "$@"
+	"$@" $(pwd) export echo ${HOME} && test test then test --verbose
+--verbose grep grep cd echo | cd awk printf test -eu ${HOME}
+"$@" "$1" | printf awk readonly
+	printf -eu then $(pwd) printf sed
+	$(pwd) test "$1" | awk test sed x=1 "$1"
+awk grep && awk "$@" cd local $(pwd) sed done readonly -eu grep echo x=1
+	done 2>/dev/null "$1" sed grep $(pwd) awk test
+	-eu awk && local local -eu cd grep awk ${HOME} -eu done done test -eu awk
+		'quoted text' cd sed 2>/dev/null
+	| done x=1 ${HOME} /usr/bin && ${HOME} 'quoted text' --verbose
+	'quoted text' printf 'quoted text'
+		cd readonly printf && && awk export
+x=1 awk test awk printf done sed 'quoted text' awk export $(pwd)
+| test 2>/dev/null ${HOME} echo grep echo --verbose
+cd 'quoted text' sed $(pwd) sed cd done test grep sed --verbose /usr/bin
+		${HOME} ${HOME} x=1 export
+		echo cd "$1" "$@" done -eu printf cd $(pwd) awk 2>/dev/null export done |
+		--verbose && -eu --verbose --verbose grep export readonly ${HOME} && 'quoted text'
+sed local x=1 local $(pwd) export $(pwd) readonly -eu export done export /usr/bin
+		/usr/bin -eu grep local echo local cd readonly local printf
+		x=1 done then cd local sed sed then && -eu then ${HOME} --verbose echo test local
+--verbose test test awk grep
+/usr/bin /usr/bin grep 'quoted text' $(pwd) cd echo && --verbose 'quoted text'
+		x=1 $(pwd) $(pwd) cd echo
+	export ${HOME} export grep readonly grep cd "$@" test ${HOME} 2>/dev/null
+		done readonly x=1 local x=1 'quoted text' ${HOME}
+awk && then test /usr/bin "$@" export $(pwd) local -eu
+		then "$@" cd $(pwd) 'quoted text' "$@" --verbose local "$1" local
+echo echo sed printf local
+printf local sed cd 'quoted text'
+	'quoted text' readonly x=1 sed cd
+	"$@" export awk grep done "$@" done echo $(pwd) readonly done /usr/bin export
+	x=1 awk $(pwd) ${HOME} export printf awk readonly awk cd cd ${HOME}
+grep /usr/bin local --verbose local
+"$1" export x=1 printf "$1" printf -eu /usr/bin
+	2>/dev/null export test /usr/bin echo readonly awk
+	cd grep echo echo $(pwd) 'quoted text'
+	cd x=1 && echo grep sed "$1"
+x=1 $(pwd) readonly grep done 'quoted text'
+		cd ${HOME} -eu echo --verbose sed 2>/dev/null readonly x=1 2>/dev/null cd
+x=1 | cd awk | && cd sed echo
+	test awk && && echo ${HOME} printf /usr/bin x=1 then cd | 2>/dev/null -eu 'quoted text'
+export /usr/bin 'quoted text' printf
+--verbose echo "$@" readonly && cd $(pwd) local export /usr/bin
+export -eu "$@" cd "$1" $(pwd) done
+		"$1" x=1 sed ${HOME} 2>/dev/null awk --verbose --verbose $(pwd) && then awk done
+	-eu printf cd "$@" && /usr/bin x=1
+	--verbose 2>/dev/null --verbose printf "$1" readonly $(pwd) "$1" printf "$1" awk
+		then $(pwd) echo "$@" | &&
+	local --verbose ${HOME}
+	test /usr/bin "$@" cd printf
+		echo printf 'quoted text'
+	printf $(pwd) printf --verbose done $(pwd)
+readonly done "$@" awk grep && test
+		'quoted text' x=1 awk sed x=1 2>/dev/null
+	grep ${HOME} grep test grep x=1 test /usr/bin x=1 then export --verbose "$@" ${HOME}
+	$(pwd) /usr/bin cd readonly 'quoted text' cd then /usr/bin 'quoted text' $(pwd)
+	sed | printf readonly /usr/bin done cd ${HOME} x=1 awk
+		--verbose -eu "$@" ${HOME} 'quoted text' grep --verbose done | test
+	sed sed sed -eu cd readonly x=1 cd 'quoted text' --verbose $(pwd) 'quoted text'
+		--verbose printf local 'quoted text'
+	readonly grep echo export then
+	export then echo 2>/dev/null 'quoted text' export 'quoted text'
+	then | 'quoted text' && done $(pwd) local $(pwd) cd 2>/dev/null
+		then awk 2>/dev/null readonly done 2>/dev/null 'quoted text' then awk
+		&& x=1 | --verbose then local local /usr/bin 2>/dev/null -eu cd grep
+		"$1" test x=1 sed readonly cd done export cd /usr/bin done --verbose 'quoted text'
+	--verbose "$1" $(pwd) &&
+		x=1 readonly && --verbose 2>/dev/null printf cd readonly "$1" then
+	readonly $(pwd) 2>/dev/null printf $(pwd) -eu x=1 -eu /usr/bin &&
+	${HOME} local 2>/dev/null readonly readonly
+sed awk -eu grep "$@" cd sed ${HOME} 2>/dev/null 2>/dev/null
+		sed 2>/dev/null printf "$@" ${HOME} --verbose awk && printf echo && export
+test "$@" "$@" $(pwd) ${HOME} done test 2>/dev/null
+		'quoted text' done grep $(pwd) "$@" grep awk | sed "$1" readonly x=1 done
+		"$@" x=1 readonly x=1 printf
+	"$1" grep && sed "$1" /usr/bin 2>/dev/null x=1 | | | export
+| /usr/bin test 2>/dev/null "$@" cd export
+'quoted text' local "$1" export | ${HOME}
+	x=1 local awk export 2>/dev/null awk --verbose
+		"$1" test local "$@" local then test cd x=1 /usr/bin sed "$@"
+cd export --verbose cd sed sed test test "$@" readonly cd "$@" sed awk export
+&& readonly $(pwd) -eu then /usr/bin
+	awk test done sed done -eu "$1" sed
+		local | local done printf done 2>/dev/null local
+	--verbose 2>/dev/null "$@" -eu --verbose x=1 printf test awk printf | sed |
+	--verbose x=1 grep "$@" cd "$1" "$@" |
+${HOME} cd "$1" echo printf printf --verbose "$@" -eu printf done
+		x=1 ${HOME} export export ${HOME}
+export 'quoted text' printf cd printf printf "$@" -eu then echo
+	/usr/bin $(pwd) readonly test && -eu /usr/bin 2>/dev/null -eu x=1 export
+		"$1" -eu export export x=1 'quoted text'
+sed 'quoted text' 'quoted text' sed cd -eu $(pwd) local
+	local echo | test sed awk done --verbose ${HOME} --verbose $(pwd) 2>/dev/null
+	then readonly awk 'quoted text' --verbose 2>/dev/null
+	2>/dev/null x=1 done x=1 then /usr/bin
+	test cd export x=1 && ${HOME} grep test | echo | /usr/bin $(pwd) 'quoted text'
+	readonly readonly echo "$@" /usr/bin awk --verbose readonly
+	readonly "$@" x=1 ${HOME}
+	printf /usr/bin 2>/dev/null
+		${HOME} | && readonly 2>/dev/null
+		echo && grep export readonly /usr/bin
+export && export done
+sed then 2>/dev/null local "$1" ${HOME} readonly echo echo export local
+${HOME} && printf done cd printf cd readonly test $(pwd) -eu ${HOME} "$1" export
+		grep done $(pwd) x=1 awk sed x=1 x=1 | test cd 'quoted text'
+		2>/dev/null test sed | grep done | done local 2>/dev/null test awk grep
+test && /usr/bin printf "$1" 'quoted text'
+		/usr/bin awk 2>/dev/null cd && local printf $(pwd) 2>/dev/null 2>/dev/null
+		$(pwd) && "$@" --verbose export then $(pwd) awk /usr/bin "$@" --verbose
+		grep local "$1" /usr/bin readonly
+	-eu export export printf local export $(pwd) 'quoted text' test grep | -eu --verbose
+awk done grep --verbose then 'quoted text'
+	-eu done then $(pwd) sed 2>/dev/null 'quoted text' "$@" ${HOME}
+export "$@" 'quoted text' readonly && done "$@" awk /usr/bin test "$@" 'quoted text'
+"$@" ${HOME} /usr/bin -eu |
+		local "$@" then --verbose cd local ${HOME} echo x=1 2>/dev/null local
+		/usr/bin export sed awk test echo
+&& grep | && $(pwd) grep cd sed | ${HOME} | cd
+&& $(pwd) "$@" readonly then sed export $(pwd) sed cd | done then
+		readonly 'quoted text' awk echo | export sed --verbose && readonly
+	${HOME} -eu printf /usr/bin "$1" "$1" cd local | awk
+		'quoted text' && echo sed export readonly && $(pwd) --verbose && local
+	readonly readonly awk awk "$@" test | --verbose
+	2>/dev/null export local done x=1 local sed ${HOME} x=1 2>/dev/null
+	sed "$@" local x=1 then sed | readonly "$@" 'quoted text'
+	grep cd grep test x=1 sed /usr/bin then "$1" grep local
+	'quoted text' printf x=1 ${HOME} export "$1" echo --verbose sed $(pwd)
+"$@" sed | sed -eu ${HOME} /usr/bin 'quoted text'
+	then test 'quoted text' "$1" $(pwd) test done --verbose "$@" "$1" && ${HOME} "$1"
+sed $(pwd) x=1 echo x=1 done export echo x=1 readonly -eu 2>/dev/null awk ${HOME}
+		readonly -eu 2>/dev/null 2>/dev/null cd readonly
+$(pwd) /usr/bin && "$1" | sed ${HOME} sed /usr/bin printf 2>/dev/null && done /usr/bin
+	'quoted text' --verbose -eu | --verbose echo then test
+"$@" awk "$1" export awk
+	done "$@" local | /usr/bin awk -eu | cd then && 'quoted text' done
+2>/dev/null x=1 2>/dev/null x=1 test 2>/dev/null
+printf sed grep x=1 | ${HOME} readonly local "$@" | $(pwd) export done
+	done sed --verbose done
+local ${HOME} ${HOME} "$@" cd && echo "$@" local --verbose
+awk export /usr/bin "$1" && "$1" && awk
+	local 'quoted text' cd sed done readonly $(pwd) ${HOME} 'quoted text' 'quoted text'
+		/usr/bin local awk 'quoted text' $(pwd)
+'quoted text' "$@" 'quoted text' cd sed --verbose
+"$@" grep && ${HOME} then sed printf
+		done echo --verbose x=1 sed | 2>/dev/null printf | grep test 'quoted text'
+${HOME} grep then echo local $(pwd) "$1" -eu | 'quoted text' grep sed 'quoted text'
+	export && $(pwd) "$@" && awk printf cd "$1" -eu
+		cd --verbose grep test cd readonly "$@" 2>/dev/null
+&& grep /usr/bin && x=1 /usr/bin ${HOME}
+	2>/dev/null grep && local "$@" export -eu --verbose ${HOME} /usr/bin
+-eu "$@" test grep ${HOME} printf awk
+x=1 && awk cd readonly then grep echo "$1" -eu "$1" printf $(pwd) "$@"
+		'quoted text' grep $(pwd) x=1 && sed && awk readonly grep 'quoted text' printf
+		"$1" --verbose export --verbose /usr/bin "$@" awk cd "$1" 'quoted text'
+		cd | 'quoted text' printf 2>/dev/null x=1 /usr/bin
+	test then --verbose readonly export x=1 echo |
+	done test export $(pwd) /usr/bin -eu 'quoted text'
+		echo --verbose "$@" done /usr/bin awk grep export printf sed grep test
+test "$@" export "$@" && $(pwd)
+		printf done readonly printf export $(pwd) | 2>/dev/null grep
+echo && 2>/dev/null cd cd awk local cd local --verbose --verbose test "$@"
+test done sed 2>/dev/null | $(pwd) -eu /usr/bin /usr/bin
+		then 2>/dev/null echo /usr/bin local
+		test local awk sed awk "$@" printf 'quoted text' then $(pwd) then ${HOME}
+cd local cd /usr/bin then "$1" done 'quoted text' echo x=1 && 2>/dev/null x=1
+-eu then 2>/dev/null -eu test printf
+	export ${HOME} && $(pwd) readonly "$@" /usr/bin x=1 awk "$@" sed test x=1 'quoted text'
+		"$1" ${HOME} 2>/dev/null ${HOME} $(pwd) x=1 ${HOME} /usr/bin --verbose readonly
+-eu "$1" "$1" | readonly sed then printf
+		&& grep test awk test 'quoted text' export cd $(pwd) awk "$1" ${HOME}
+	printf 'quoted text' echo /usr/bin readonly then done then $(pwd) sed
+	sed x=1 cd local --verbose printf test local ${HOME} readonly
+	--verbose 'quoted text'
+		| done 'quoted text' -eu echo
+	/usr/bin test x=1 $(pwd) local done readonly -eu "$@" ${HOME}
+		awk 'quoted text' readonly readonly 'quoted text'
+export -eu sed grep x=1 -eu ${HOME} 'quoted text' readonly
+	$(pwd) --verbose "$1" $(pwd) ${HOME} | export | && 'quoted text'
+		/usr/bin --verbose printf -eu export
+&& $(pwd) $(pwd) awk grep sed done "$@" "$1"
+	readonly cd local 'quoted text' export && test printf
+	'quoted text' local "$1" -eu export test && readonly
+	then -eu cd "$1" 'quoted text'
+		2>/dev/null ${HOME} -eu x=1 sed $(pwd)
+local -eu sed then 'quoted text' export export /usr/bin then
+	local grep done printf awk x=1 -eu test export grep cd export export
+cd -eu $(pwd) local -eu /usr/bin done
+	| "$1" grep grep 2>/dev/null 2>/dev/null printf && readonly sed test
+		${HOME} x=1 /usr/bin "$@" 2>/dev/null x=1 sed 2>/dev/null
+		"$@" printf grep grep && 'quoted text' --verbose done awk
+grep done awk "$@" 2>/dev/null x=1 echo /usr/bin
+		x=1 sed /usr/bin ${HOME}
+		"$@" | export export ${HOME} -eu printf
+	${HOME} sed then awk done test cd "$1" sed | awk 2>/dev/null awk 2>/dev/null then
+printf 'quoted text' done 2>/dev/null 2>/dev/null
+2>/dev/null export sed grep --verbose awk local awk -eu $(pwd) grep
+		&& cd /usr/bin readonly cd 'quoted text' 'quoted text' "$@" export "$@" done
+		test "$@" test export "$@" --verbose
+readonly $(pwd) && $(pwd) | x=1 "$@" "$@" -eu /usr/bin 2>/dev/null
+cd local && 2>/dev/null grep | "$1"
+		--verbose --verbose grep /usr/bin readonly "$@" "$1" --verbose
+	readonly export sed -eu x=1 export $(pwd) && 2>/dev/null done
+		/usr/bin "$1" 2>/dev/null | 2>/dev/null
+	"$1" echo x=1 --verbose awk printf --verbose --verbose
+${HOME} /usr/bin $(pwd) /usr/bin --verbose
+		'quoted text' sed $(pwd) 2>/dev/null sed $(pwd) "$@" cd grep export "$1" "$@" x=1
+		cd 2>/dev/null printf readonly cd done readonly local
+${HOME} export --verbose readonly then --verbose then grep
+'quoted text' awk "$@" then "$1" grep readonly
+		$(pwd) ${HOME} done echo
+	$(pwd) | 2>/dev/null -eu
+		sed sed grep local done done x=1
+	-eu --verbose | "$@" grep "$@" done printf readonly --verbose -eu $(pwd)
+		| x=1 local 'quoted text' test ${HOME} local
+awk $(pwd) local --verbose "$1" && readonly local x=1 awk
+	grep --verbose local 'quoted text' 2>/dev/null ${HOME} local test
+	x=1 2>/dev/null local then x=1 ${HOME}
+	/usr/bin | sed readonly local && 2>/dev/null printf --verbose
+		$(pwd) -eu "$@" && printf echo && && /usr/bin then -eu ${HOME} && 2>/dev/null
+&& sed /usr/bin "$@" "$1" $(pwd) sed done $(pwd) "$1"
+'quoted text' /usr/bin done sed export readonly 2>/dev/null --verbose
+	sed "$@" --verbose -eu readonly echo done --verbose $(pwd)
+cd $(pwd) awk then | "$@" | printf done 'quoted text' awk awk cd x=1
+		done readonly awk "$@" echo && test $(pwd)
+	echo $(pwd) /usr/bin "$@" sed sed sed awk then cd /usr/bin --verbose awk 'quoted text'
+printf awk && | x=1 printf awk "$1" 2>/dev/null "$1" export -eu
+		x=1 2>/dev/null "$@" && | printf cd cd "$@" -eu local 2>/dev/null
+		local then echo readonly && export 'quoted text'
+		$(pwd) $(pwd) && --verbose ${HOME}
+test 'quoted text' -eu | then &&
+	$(pwd) /usr/bin awk "$@" -eu $(pwd) -eu 'quoted text' 'quoted text'
+		test readonly --verbose export printf
+	2>/dev/null awk "$@" then "$@" | cd ${HOME} "$@" $(pwd) 'quoted text' $(pwd) cd
+${HOME} printf -eu cd /usr/bin
+	awk export readonly test /usr/bin x=1 export export "$@" awk
+sed /usr/bin then /usr/bin "$1" readonly printf "$@" grep export
+	&& then then test sed export 'quoted text' local
+	"$1" | cd "$@" | done export && sed cd test sed "$1" ${HOME} 2>/dev/null
+x=1 local -eu ${HOME} 'quoted text' ${HOME}
+-eu export sed local printf
+	echo grep 'quoted text' /usr/bin
+cd | local -eu ${HOME}
+export /usr/bin export grep ${HOME} x=1 "$@" awk awk echo cd then $(pwd) awk
+		done cd local x=1 /usr/bin 2>/dev/null sed $(pwd)
+	/usr/bin awk readonly /usr/bin "$1" grep 'quoted text' export
+	cd done grep 'quoted text' printf && export
+		&& cd | && /usr/bin readonly done /usr/bin printf export readonly grep
+export 'quoted text' then then
+	grep && readonly && 2>/dev/null /usr/bin "$@" done readonly "$1"
+		export --verbose grep readonly readonly 2>/dev/null export "$@"
+"$1" echo echo x=1 ${HOME} /usr/bin
+		2>/dev/null echo grep sed && --verbose ${HOME} 'quoted text'
+		echo "$@" "$@" | then readonly "$1" $(pwd) cd | test ${HOME} echo
+		| printf export | && done "$1" "$1" export local | "$1" test $(pwd)
+		&& sed && done then then done 2>/dev/null then readonly
+		sed printf grep 2>/dev/null 2>/dev/null test cd 2>/dev/null
+		| 'quoted text' ${HOME} | readonly printf sed "$@" export x=1 echo
+| printf grep done then cd export grep --verbose awk cd readonly "$@" printf -eu
+grep grep printf 2>/dev/null readonly 2>/dev/null --verbose sed $(pwd) && test
+-eu /usr/bin cd | test sed export $(pwd) readonly
+printf test x=1 "$1" --verbose --verbose x=1 ${HOME} | export
+	done grep test awk sed awk readonly printf
+/usr/bin --verbose ${HOME} --verbose ${HOME} | ${HOME} "$@" /usr/bin
+	test test sed 2>/dev/null 'quoted text' $(pwd) done readonly "$1"
+		export ${HOME} local -eu
+	echo "$1" --verbose $(pwd) echo test then readonly cd $(pwd) /usr/bin then
+		grep test export && grep -eu | 2>/dev/null
+local done then test cd --verbose
+printf done /usr/bin readonly done -eu
+		grep -eu done /usr/bin echo readonly local awk export "$@" export
+&& awk grep echo local "$1"
+		grep sed awk printf x=1 awk 'quoted text' x=1 | local
+	${HOME} printf printf ${HOME} -eu "$@" $(pwd) ${HOME} readonly
+| printf x=1 ${HOME} cd sed ${HOME} -eu test
+		2>/dev/null 'quoted text' 'quoted text' awk
+$(pwd) echo ${HOME} 2>/dev/null x=1 -eu | /usr/bin export test then -eu /usr/bin
+	then "$1" $(pwd) --verbose x=1 awk 'quoted text'
+	local && && sed $(pwd) && | export awk export export ${HOME}
+	printf | cd echo /usr/bin readonly echo awk readonly 2>/dev/null
+-eu "$@" 'quoted text' 'quoted text' readonly grep
+export /usr/bin echo "$@" printf 2>/dev/null cd echo
+$(pwd) "$1" readonly 'quoted text'
+	2>/dev/null readonly /usr/bin printf --verbose readonly
+	-eu printf /usr/bin echo /usr/bin && then x=1 -eu echo && ${HOME}
+awk readonly /usr/bin grep test $(pwd) readonly 'quoted text'
+'quoted text' | sed -eu 2>/dev/null sed grep echo grep "$@" cd
+		printf cd echo && && --verbose then
+	printf cd done "$1" $(pwd)
+	--verbose cd | --verbose "$@" ${HOME} "$1" "$@"
+		/usr/bin export 2>/dev/null sed "$@" 'quoted text'
+		| && /usr/bin cd ${HOME} printf -eu x=1 --verbose 'quoted text'
+${HOME} awk "$1" /usr/bin
+done | done --verbose printf done $(pwd) $(pwd)
+grep test $(pwd) 'quoted text'
+	&& awk grep cd done local echo printf && 'quoted text'
+	awk sed then ${HOME} $(pwd) x=1 test 2>/dev/null $(pwd) "$1" "$@" 2>/dev/null
+		printf then export && sed | then sed "$1" /usr/bin
+	2>/dev/null export done 'quoted text' printf $(pwd) "$1"
+	"$@" echo echo x=1 -eu --verbose sed --verbose test x=1 done 'quoted text'
+		2>/dev/null done 'quoted text' "$@" 2>/dev/null cd export readonly 2>/dev/null
+printf then $(pwd) ${HOME} ${HOME} $(pwd) grep
+		echo ${HOME} export awk echo test awk x=1 2>/dev/null $(pwd) 2>/dev/null
+		test | then 'quoted text' $(pwd) "$@" awk then
+done ${HOME} awk readonly sed /usr/bin 2>/dev/null echo $(pwd) test "$1" echo
+readonly 2>/dev/null -eu && readonly "$@" 'quoted text' -eu awk "$1"
+"$1" x=1 ${HOME} "$@" ${HOME} x=1 awk x=1 'quoted text'
+awk "$@" echo cd export -eu && | -eu done echo then
+		"$1" /usr/bin "$1" cd test 2>/dev/null 2>/dev/null $(pwd) -eu
+	cd readonly cd "$1" x=1 grep sed ${HOME} cd -eu 2>/dev/null
+		"$@" 2>/dev/null | ${HOME} local printf x=1 then
+	export x=1 sed ${HOME} awk -eu --verbose 2>/dev/null export
+test "$1" test done then awk local $(pwd) cd then /usr/bin
+awk then 'quoted text' sed test $(pwd) local ${HOME} "$1" printf export
+local x=1 then x=1 then | awk
+awk export export local printf x=1 awk "$@" $(pwd) cd awk sed && then
+	done echo 'quoted text' ${HOME} test cd 'quoted text' 'quoted text' 'quoted text'
+--verbose test "$1" done 2>/dev/null
+	&& then sed done 'quoted text' test grep local cd done ${HOME} 2>/dev/null
+		awk --verbose x=1 && then done -eu printf /usr/bin local --verbose printf printf
+		sed "$1" "$@" export export $(pwd) --verbose "$@" /usr/bin "$@" $(pwd)
+x=1 "$1" -eu export $(pwd) awk then echo ${HOME} sed readonly ${HOME}
+		grep "$1" 'quoted text' then export /usr/bin "$@" printf | | 'quoted text'
+		awk test --verbose x=1 test ${HOME} grep x=1 printf && $(pwd) test 'quoted text'
+sed test awk -eu $(pwd) /usr/bin
+local cd $(pwd) awk --verbose x=1 done --verbose printf readonly readonly
+		export $(pwd) local then local printf
+		awk awk x=1 -eu /usr/bin echo 'quoted text' 2>/dev/null -eu 2>/dev/null /usr/bin
+		| local export cd local done | test && -eu "$1" echo awk
+--verbose $(pwd) printf 'quoted text' then x=1 readonly
+	-eu printf -eu x=1 grep 'quoted text' test export cd
+		"$1" export "$1" cd local awk done /usr/bin
+		then $(pwd) $(pwd) --verbose test -eu /usr/bin
+local test cd x=1 local export && && echo
+&& local awk printf | | | sed $(pwd) -eu export
+	test "$1" 2>/dev/null grep sed
+test readonly -eu export
+done "$@" 2>/dev/null done "$1" cd printf readonly awk sed printf
+		/usr/bin --verbose 2>/dev/null "$@"
+'quoted text' export sed local | "$@" x=1 ${HOME}
+		--verbose "$1" then --verbose "$@" | /usr/bin done echo
+	/usr/bin --verbose cd printf export
+		/usr/bin -eu readonly then grep && ${HOME} $(pwd) readonly test readonly
+2>/dev/null export /usr/bin --verbose printf ${HOME} grep
+grep printf "$@" $(pwd) 'quoted text'
+	sed -eu "$@" cd cd printf $(pwd) test grep $(pwd) "$@"
+	2>/dev/null x=1 test test printf && $(pwd) awk
+		x=1 ${HOME} export done | export then printf /usr/bin printf awk &&
+$(pwd) x=1 2>/dev/null test readonly echo
+		readonly sed "$1" awk --verbose 'quoted text'
+		printf ${HOME} local cd grep 'quoted text' 'quoted text'
+		/usr/bin test printf 2>/dev/null --verbose sed cd x=1 $(pwd)
+cd "$@" test $(pwd) -eu then test readonly then x=1
+	readonly cd test 'quoted text' /usr/bin echo
+		"$1" echo && "$1" -eu echo local x=1 awk x=1 local then
+	| $(pwd) /usr/bin awk -eu "$@" test sed printf
+	export sed awk export grep sed /usr/bin then then && | 'quoted text'
+	echo | grep echo awk sed
+	-eu export done export --verbose local
+${HOME} cd "$1" -eu && then done awk $(pwd) sed awk cd $(pwd)
+	sed cd cd awk printf 2>/dev/null /usr/bin then done local
+		done then | readonly awk echo printf x=1
+		$(pwd) /usr/bin | then ${HOME}
+		--verbose sed 'quoted text' local test sed 2>/dev/null cd echo $(pwd) ${HOME} test
+		echo grep awk x=1 then echo cd
+done readonly "$@" printf cd readonly local -eu -eu /usr/bin
+	grep local 'quoted text' echo export cd printf
+		printf $(pwd) printf printf 2>/dev/null
+		--verbose $(pwd) echo --verbose $(pwd) 2>/dev/null 'quoted text'
+done 'quoted text' -eu then test /usr/bin grep readonly "$@" "$1" --verbose test
+"$1" "$@" done test printf /usr/bin test ${HOME} "$@"
+	local "$1" awk | /usr/bin ${HOME}
+	export 'quoted text' --verbose | x=1 awk | 2>/dev/null grep grep
+'quoted text' | /usr/bin x=1 ${HOME} export awk |
+	local echo cd /usr/bin "$1" ${HOME} test grep /usr/bin ${HOME} then -eu $(pwd)
+	cd $(pwd) && ${HOME} "$1" sed "$@" sed ${HOME}
+	then 2>/dev/null ${HOME} 2>/dev/null done readonly x=1 awk readonly
+test x=1 | "$@" $(pwd)
+	--verbose 2>/dev/null export awk 2>/dev/null
+${HOME} && printf && --verbose 'quoted text' --verbose export sed | readonly
+		${HOME} cd cd x=1 --verbose --verbose grep sed 'quoted text' done grep 2>/dev/null
+echo 'quoted text' done
+		sed && $(pwd) awk --verbose
+		awk readonly awk cd readonly | test $(pwd) ${HOME} export "$1"
+		'quoted text' -eu local $(pwd) readonly done export
+--verbose test test local 'quoted text' "$@" $(pwd) && ${HOME} 'quoted text' then
+		&& --verbose $(pwd) --verbose
+	| -eu /usr/bin -eu grep ${HOME} /usr/bin -eu $(pwd) done then && sed | x=1
+	done x=1 && test "$1" /usr/bin ${HOME}
+		"$@" "$1" -eu then readonly sed ${HOME}
+	printf -eu local | $(pwd) /usr/bin -eu local local readonly printf awk
+	"$1" "$@" local awk readonly --verbose -eu export --verbose --verbose
+| export sed && done export local readonly "$1" 2>/dev/null echo | | &&
+--verbose then printf echo export | readonly --verbose test 2>/dev/null
+then "$1" "$1" awk echo done 2>/dev/null "$1" x=1 -eu $(pwd) &&
+then local && x=1 --verbose "$@" sed --verbose printf local $(pwd)
+	grep printf 'quoted text' then --verbose /usr/bin
+	--verbose test test --verbose cd "$1" 'quoted text' grep done -eu cd export $(pwd)
+		"$1" $(pwd) awk "$1" ${HOME} readonly
+	sed ${HOME} sed ${HOME} /usr/bin export awk done $(pwd) "$@" $(pwd) ${HOME}
+awk test ${HOME} ${HOME}
+	'quoted text' sed x=1 /usr/bin --verbose awk 'quoted text' --verbose readonly
+		| local "$1" local then printf sed | cd echo /usr/bin "$1" test
+	2>/dev/null local then "$1" done $(pwd) 'quoted text' readonly ${HOME}
+readonly grep export && 2>/dev/null --verbose
+'quoted text' done | printf "$@" export sed 'quoted text'
+	'quoted text' then x=1 /usr/bin printf
+		$(pwd) "$1" done echo readonly printf awk ${HOME}
+&& sed readonly $(pwd) 2>/dev/null
+"$1" printf local then local x=1 echo
+		/usr/bin test 'quoted text'
+then 2>/dev/null /usr/bin done printf ${HOME} done sed "$@" echo sed "$1" then |
+		echo ${HOME} x=1 --verbose ${HOME} && cd /usr/bin
+cd readonly sed -eu "$1" && "$1" 2>/dev/null export export
+		"$1" then done 'quoted text' ${HOME} $(pwd) export | /usr/bin /usr/bin
+		2>/dev/null test awk printf sed then $(pwd)
+		/usr/bin --verbose 'quoted text' "$1" -eu "$@" grep
+		$(pwd) then done local x=1 -eu grep export done && 'quoted text'
+echo printf $(pwd) ${HOME} /usr/bin done awk 2>/dev/null
+		"$1" test x=1 then readonly cd "$@" $(pwd) $(pwd)
+		$(pwd) 'quoted text' sed then -eu ${HOME} 2>/dev/null "$1" ${HOME}
+		printf awk /usr/bin 'quoted text' cd 'quoted text'
+		echo printf "$1" printf echo /usr/bin ${HOME} --verbose 2>/dev/null x=1
+"$1" -eu done grep | local done export done 'quoted text'
+x=1 ${HOME} --verbose 2>/dev/null -eu awk /usr/bin then -eu printf done local
+		grep local readonly && $(pwd) && 2>/dev/null
+		echo "$@" readonly echo 'quoted text'
+		2>/dev/null $(pwd) x=1 local "$@" x=1 grep awk x=1 2>/dev/null
+	${HOME} then x=1 $(pwd) --verbose x=1 x=1 -eu
+	2>/dev/null grep $(pwd) sed grep ${HOME} x=1 --verbose export
+		then cd "$@" test $(pwd) $(pwd) -eu done 'quoted text' echo local 2>/dev/null
+	&& test cd then test 'quoted text' cd done awk x=1 -eu cd 'quoted text'
+	test --verbose done 2>/dev/null && 'quoted text' echo
+		printf awk x=1 printf readonly echo
+${HOME} x=1 grep test "$1" | awk awk local
+--verbose done /usr/bin export --verbose "$1" echo sed $(pwd) awk "$@" 2>/dev/null
+		printf export echo "$1" && local && echo && export
+	awk grep $(pwd) 2>/dev/null
+		&& done printf awk readonly x=1 local cd -eu then --verbose test
+		$(pwd) readonly test then -eu echo echo local --verbose "$@" printf done local test
+cd export 'quoted text' done && && then $(pwd)
+/usr/bin echo $(pwd) done grep test 2>/dev/null 'quoted text' /usr/bin
+		&& -eu printf --verbose awk sed then | done x=1 2>/dev/null
+		readonly --verbose grep grep
+"$@" 2>/dev/null sed && done 'quoted text' 2>/dev/null ${HOME}
+		awk then printf 'quoted text' $(pwd) 2>/dev/null -eu
+	'quoted text' && 'quoted text'
+-eu -eu && then sed done done grep
+		x=1 sed ${HOME} && x=1 /usr/bin awk x=1 x=1 "$1" "$@" $(pwd) sed | done test 'quoted text'
+test printf export awk local local awk cd readonly $(pwd) x=1 2>/dev/null
+	"$@" -eu /usr/bin then "$1" x=1 cd printf --verbose test then
+then then test awk && export && 2>/dev/null cd sed local grep export "$1" -eu sed
+| 'quoted text' --verbose sed done readonly echo test ${HOME} "$@" done
+'quoted text' export --verbose test | then x=1 ${HOME}
+	"$1" ${HOME} "$1" x=1 done --verbose
+local /usr/bin export 2>/dev/null
+	-eu cd printf /usr/bin local grep $(pwd) test printf && "$@"
+	$(pwd) sed 'quoted text' x=1 x=1 sed then done
+	then awk && ${HOME} && printf
+		-eu -eu readonly 2>/dev/null cd done echo "$@" local $(pwd)
+2>/dev/null | local --verbose &&
+	"$@" done sed done export --verbose done | then ${HOME}
+grep then && | grep then local x=1
+	'quoted text' cd then && x=1 readonly
+	"$1" $(pwd) && && x=1 grep echo sed 2>/dev/null then
+		'quoted text' sed 2>/dev/null -eu "$1" cd 'quoted text' then then cd $(pwd) readonly
+readonly /usr/bin readonly $(pwd) "$1" done done export export
+	${HOME} echo grep --verbose | cd --verbose
+printf cd local /usr/bin 2>/dev/null 2>/dev/null printf awk awk
+		printf then "$1" printf /usr/bin /usr/bin local "$1" $(pwd)
+	"$1" echo "$1" done ${HOME}
+		awk && | printf local sed
+${HOME} "$1" --verbose 2>/dev/null sed -eu awk 2>/dev/null x=1 -eu --verbose echo
+x=1 export && cd "$@" test /usr/bin sed echo
+grep then /usr/bin -eu local readonly readonly
+		sed local /usr/bin grep test
+echo readonly 2>/dev/null "$1" printf test test printf grep | echo done -eu
+	-eu readonly awk test /usr/bin awk then export $(pwd) ${HOME} printf
+'quoted text' 2>/dev/null && printf --verbose
+&& grep ${HOME} done --verbose done -eu awk echo | &&
+	x=1 sed cd --verbose local readonly sed /usr/bin then "$1" ${HOME} x=1 test | export
+	done sed "$1" then then --verbose
+		--verbose test local | $(pwd) grep export x=1 --verbose "$@" readonly $(pwd) echo
+		"$@" -eu /usr/bin sed readonly done "$1" 2>/dev/null "$1" x=1 echo
+| local ${HOME} test /usr/bin && /usr/bin printf -eu test done && && ${HOME}
+	${HOME} awk && /usr/bin printf export grep grep && export sed local -eu ${HOME}
+then "$@" && then && 'quoted text' /usr/bin readonly 2>/dev/null
+-eu export then echo "$1" $(pwd) then | done awk test grep && printf sed readonly
+test $(pwd) "$@" x=1 sed ${HOME} test local
+		| $(pwd) then "$1" "$1" export grep
+		then awk && local "$1" /usr/bin
+readonly printf grep printf
+grep --verbose "$@" readonly
+	grep export --verbose 'quoted text' test -eu -eu awk "$1" done sed
+done then 2>/dev/null ${HOME} && test readonly | printf "$@" -eu test
+export && then | then ${HOME} readonly cd sed
+		2>/dev/null sed cd && done export && export 2>/dev/null
+done 2>/dev/null sed cd then /usr/bin awk export 2>/dev/null
+	$(pwd) 2>/dev/null sed $(pwd) -eu echo done --verbose then export
+	--verbose 'quoted text'
+	cd -eu 'quoted text' "$@" 'quoted text' -eu
+2>/dev/null sed sed sed ${HOME}
+		--verbose awk sed /usr/bin /usr/bin ${HOME}
+	&& grep | sed cd sed done --verbose
+		"$@" printf /usr/bin local awk $(pwd) done 2>/dev/null /usr/bin then -eu | |
+local printf 'quoted text' "$1"
+		cd | echo test echo printf cd export && local 2>/dev/null $(pwd) --verbose
+grep printf sed awk 2>/dev/null -eu
+	local 2>/dev/null /usr/bin printf cd "$@" cd grep test
+then grep 'quoted text' -eu export ${HOME} printf cd echo
+	x=1 cd "$1" printf x=1 /usr/bin
+		| 2>/dev/null "$@" sed /usr/bin x=1 x=1 | readonly awk | then 'quoted text' /usr/bin
+		test done printf ${HOME} ${HOME}
+	awk x=1 printf -eu "$1"
+printf "$@" awk --verbose -eu | $(pwd) sed | --verbose
+		"$1" x=1 local awk awk 'quoted text' grep echo echo printf test
+		done export --verbose | local "$1"
+/usr/bin 2>/dev/null cd grep
+	2>/dev/null done -eu 2>/dev/null test && export 2>/dev/null
+echo echo export "$1" "$@" | awk 2>/dev/null cd readonly && local awk
+"$@" x=1 done echo sed then x=1 /usr/bin
+	/usr/bin awk "$1" 2>/dev/null sed ${HOME} && readonly then |
+"$@" x=1 readonly printf
+	x=1 sed grep cd 2>/dev/null | --verbose
+		local cd && ${HOME} ${HOME} done export printf x=1 2>/dev/null awk "$@" | export
+	| local readonly test export done local echo printf 2>/dev/null && --verbose
+		2>/dev/null 'quoted text' $(pwd) -eu local local 2>/dev/null
+	'quoted text' x=1 cd 'quoted text'
+'quoted text' export 'quoted text'
+&& readonly 2>/dev/null local echo test --verbose grep cd done export
+-eu echo x=1 | && /usr/bin --verbose echo then --verbose x=1 done x=1
+done printf grep awk $(pwd) 2>/dev/null awk && awk grep
+	local done local local && | sed printf -eu cd printf export ${HOME} echo
+done x=1 awk x=1 test "$1" export local
+$(pwd) && echo readonly printf
+2>/dev/null printf --verbose x=1 'quoted text'
+		| local 2>/dev/null done /usr/bin ${HOME} sed done 2>/dev/null
+local printf local --verbose --verbose "$@"
+&& test $(pwd) "$1" 2>/dev/null printf awk sed local 'quoted text' --verbose /usr/bin
+	sed cd --verbose 'quoted text'
+"$1" x=1 2>/dev/null local x=1 then local readonly -eu
+		&& local printf && -eu ${HOME} "$1" ${HOME}
+		awk $(pwd) 2>/dev/null awk test test 'quoted text'
+"$1" done "$1" test grep done local echo "$1" | ${HOME} local awk 'quoted text'
+		"$1" && then 'quoted text' x=1 $(pwd) "$@" && export $(pwd) -eu $(pwd) test
+readonly x=1 2>/dev/null test "$@" ${HOME} then
+		then "$@" printf 'quoted text'
+		awk awk -eu cd test export x=1 "$1" test echo then /usr/bin export | awk x=1
+${HOME} ${HOME} then | then $(pwd)
+		awk --verbose 2>/dev/null local $(pwd) readonly done | 2>/dev/null done
+export printf ${HOME} ${HOME}
+cd echo | ${HOME} export
+	awk awk echo "$@" test then && -eu grep
+done 2>/dev/null | sed x=1 "$1" cd 'quoted text' $(pwd)
+	test readonly /usr/bin sed cd "$1" printf | echo echo -eu local done printf --verbose
+		cd -eu --verbose --verbose done export
+done $(pwd) --verbose test sed ${HOME} | "$@" -eu 2>/dev/null
+	2>/dev/null x=1 grep | awk then readonly
+2>/dev/null x=1 cd export --verbose -eu awk then
+-eu printf printf readonly export
+	done x=1 awk | && --verbose 2>/dev/null echo | x=1 then sed 2>/dev/null --verbose
+	2>/dev/null "$1" 'quoted text' x=1 export
+x=1 readonly $(pwd) -eu
+-eu local | sed $(pwd) export -eu cd echo x=1 grep && $(pwd) 'quoted text' 2>/dev/null
+		x=1 echo "$@" /usr/bin | awk -eu /usr/bin local ${HOME}
+		'quoted text' done then
+	x=1 test readonly && grep -eu then $(pwd)
+grep local 'quoted text' readonly 2>/dev/null test export local then awk 'quoted text'
+	--verbose /usr/bin x=1 ${HOME} cd $(pwd) 2>/dev/null &&
+	"$1" sed export ${HOME} /usr/bin readonly echo x=1 x=1 ${HOME} sed "$1" then
+-eu test awk --verbose awk 2>/dev/null awk export -eu -eu printf ${HOME} ${HOME}
+		local ${HOME} -eu printf
+	| 'quoted text' 2>/dev/null export done test
+		x=1 "$1" --verbose done echo "$1" && grep /usr/bin
+		&& -eu grep printf test
+local sed grep /usr/bin test grep printf 2>/dev/null
+"$1" -eu test "$@" -eu sed done | readonly grep test
+	| sed export local /usr/bin
+		printf 'quoted text' test local x=1 /usr/bin export | "$1" $(pwd) printf then test
+	$(pwd) 2>/dev/null export sed export "$1" | $(pwd) awk printf 2>/dev/null
+printf "$1" --verbose && cd -eu cd 2>/dev/null "$1" 'quoted text' ${HOME}
+	awk local "$@" echo done "$1"
+	x=1 export awk done awk echo "$@" -eu -eu 2>/dev/null echo then printf printf
+	printf awk --verbose readonly $(pwd) export
+	'quoted text' 'quoted text' printf | $(pwd) readonly sed x=1 done $(pwd) printf
+"$1" "$@" done cd grep 'quoted text'
+$(pwd) test readonly local grep readonly cd grep "$1"
+	export cd "$1" export x=1 $(pwd) "$1" grep local $(pwd) awk /usr/bin /usr/bin
+test "$@" -eu $(pwd) test local test export echo printf test local
+		test export printf echo then awk "$1" 'quoted text' readonly readonly
+| done -eu then readonly
+$(pwd) ${HOME} 'quoted text' sed local test export awk | /usr/bin
+		sed echo sed -eu printf 2>/dev/null x=1 done printf local test "$1" 2>/dev/null
+		awk $(pwd) "$@" --verbose "$@" grep cd test "$1" export cd x=1 done
+	printf && readonly readonly sed done
+	$(pwd) /usr/bin test awk 2>/dev/null readonly printf test "$@" "$1" local
+$(pwd) test export /usr/bin echo local export /usr/bin
+	sed grep echo then ${HOME} && test --verbose
+cd ${HOME} printf readonly cd awk "$@" "$1" test echo awk readonly awk printf &&
+grep -eu grep && 2>/dev/null -eu cd local awk 'quoted text' done x=1 /usr/bin
+/usr/bin && | | 'quoted text' && ${HOME} then | "$@" -eu ${HOME}
+		sed -eu grep -eu && sed | -eu --verbose done
+	local 2>/dev/null x=1 then --verbose
+	test -eu local -eu 'quoted text' | export cd done ${HOME}
+/usr/bin 2>/dev/null grep
+	"$1" test export --verbose -eu readonly readonly
+	| x=1 | $(pwd) "$1" ${HOME}
+readonly export --verbose
+&& cd local printf -eu --verbose then
+grep 2>/dev/null 2>/dev/null sed awk "$1" 2>/dev/null | | --verbose then $(pwd)
+		awk ${HOME} then echo grep x=1 echo "$@" ${HOME} cd grep && awk echo
+		done | printf cd printf
+	echo cd x=1 && printf 2>/dev/null sed
+		grep "$1" grep readonly "$1" grep ${HOME} 'quoted text' $(pwd)
+	2>/dev/null echo && /usr/bin x=1 readonly
+		export "$@" echo export awk | echo ${HOME} x=1 2>/dev/null
+		grep grep x=1 'quoted text' done then 2>/dev/null &&
+		grep | printf printf readonly "$@" awk $(pwd) export 2>/dev/null x=1 test && printf
+&& sed sed echo sed ${HOME} echo then "$1"
+		/usr/bin --verbose printf test test ${HOME} x=1 $(pwd) awk "$1" && -eu
+		then ${HOME} "$@" x=1 --verbose readonly echo awk
+--verbose 'quoted text' test readonly /usr/bin
+		| echo x=1 'quoted text' --verbose awk readonly
+'quoted text' test readonly && sed readonly 'quoted text' -eu grep readonly /usr/bin
+		local sed "$1" ${HOME} && 'quoted text'
+done awk "$1" readonly test grep --verbose --verbose ${HOME} 'quoted text'
+	x=1 awk done 'quoted text'
+"$1" sed "$@" 'quoted text' export "$@" sed readonly -eu done "$1" sed sed
+"$@" awk echo done grep printf then && "$@" && printf |
+${HOME} test --verbose awk local 2>/dev/null && printf 'quoted text'
+		then $(pwd) cd awk x=1
+	"$@" grep sed $(pwd) done readonly "$1"
+x=1 done readonly local grep then sed 2>/dev/null grep "$@" printf | echo
+x=1 local cd done && export x=1 'quoted text'
+		/usr/bin printf echo local local export /usr/bin done
+		done ${HOME} grep awk ${HOME} grep "$1"
+'quoted text' echo export export readonly
+	/usr/bin then "$@" 2>/dev/null done
+then -eu then readonly readonly local sed "$1" $(pwd)
+	export grep cd 2>/dev/null -eu --verbose
+	test sed cd 2>/dev/null $(pwd)
+	x=1 awk printf x=1 awk cd export 'quoted text' local && ${HOME} echo local
+	/usr/bin local sed printf 2>/dev/null x=1 grep
+export readonly printf export awk -eu --verbose cd then sed then grep
+	x=1 'quoted text' printf | done -eu sed | cd ${HOME} echo done
+sed done x=1 $(pwd) "$1" sed sed readonly
+		2>/dev/null sed 'quoted text'
+x=1 2>/dev/null x=1 ${HOME} && local done 2>/dev/null --verbose "$1" 2>/dev/null
+		export then awk done x=1 sed 2>/dev/null --verbose
+		printf 2>/dev/null local
+		export done readonly sed echo cd awk cd grep printf -eu grep grep --verbose
+echo sed ${HOME} "$1" grep
+		--verbose "$1" ${HOME} && grep done echo 'quoted text' "$@" export test /usr/bin
+		$(pwd) printf awk sed awk $(pwd) then -eu ${HOME} test --verbose
+grep local done cd awk grep $(pwd) -eu
+		awk "$@" echo "$1" test printf cd local printf printf "$1" then "$@"
+test /usr/bin && test done done printf && "$@" x=1
+		sed test 2>/dev/null sed --verbose
+		$(pwd) cd $(pwd) sed 2>/dev/null grep /usr/bin
+cd "$@" cd echo -eu grep --verbose grep echo
+		'quoted text' then && readonly printf then local then export echo 'quoted text'
+sed done $(pwd) --verbose x=1 awk awk printf grep
+--verbose $(pwd) done readonly --verbose && cd
+	done && $(pwd) export ${HOME} cd && readonly "$@" |
+export sed export "$1" "$@" awk --verbose 'quoted text'
+	echo printf "$1" -eu "$1" export echo x=1 grep "$1" ${HOME} test -eu -eu printf
+/usr/bin 2>/dev/null ${HOME} /usr/bin done awk printf then readonly
+		local "$@" test 2>/dev/null -eu test && ${HOME} /usr/bin grep ${HOME} --verbose
+	readonly cd cd test 2>/dev/null
+		/usr/bin test sed done 2>/dev/null done awk
+	then done local sed done test readonly "$1" sed &&
+		&& 2>/dev/null 'quoted text' "$1"
+		awk export 'quoted text' grep 2>/dev/null
+	--verbose 'quoted text' echo done export sed test
+	cd export x=1 local grep x=1 echo $(pwd) done test x=1 "$1" export
+export "$@" echo "$1" awk && | printf "$@" --verbose
+	-eu readonly local && sed done 'quoted text' /usr/bin
+	$(pwd) | readonly 'quoted text' "$1" then grep readonly
+echo echo cd 'quoted text' 'quoted text' readonly
+awk cd /usr/bin sed readonly done grep done "$@"
+		2>/dev/null readonly export test sed echo -eu 2>/dev/null "$@" grep
+		readonly 'quoted text' cd sed printf echo awk ${HOME}
+awk readonly 2>/dev/null "$@" 2>/dev/null
+--verbose awk test awk echo | 'quoted text' /usr/bin -eu x=1 export
+/usr/bin readonly printf printf $(pwd) export test "$@" test printf readonly 'quoted text'
+		local local "$1" grep then grep 'quoted text' printf grep /usr/bin
+	2>/dev/null x=1 --verbose test "$@" "$@" readonly test export printf local --verbose
+'quoted text' 'quoted text'
+	"$1" export | --verbose &&
+	printf export $(pwd) export "$1" grep awk local
+		"$@" | printf then echo local "$@" && export
+	--verbose x=1 done x=1
+		$(pwd) 'quoted text' x=1
+		readonly ${HOME} done && grep | 'quoted text'
+		--verbose grep printf sed
+	--verbose 2>/dev/null 'quoted text' --verbose "$@" && /usr/bin 2>/dev/null
+awk local 2>/dev/null "$@"
+then --verbose "$1" 2>/dev/null
+echo ${HOME} export --verbose local sed awk x=1 2>/dev/null
+		export readonly -eu /usr/bin /usr/bin sed cd readonly 'quoted text'
+readonly ${HOME} x=1 printf && 2>/dev/null printf
+	2>/dev/null "$1" then export "$@" $(pwd) x=1 printf done "$1" ${HOME} readonly
+		grep done --verbose "$@" echo ${HOME} 2>/dev/null sed
+"$@" then printf -eu awk cd
+	printf awk -eu 'quoted text' done local -eu awk $(pwd) test
+	$(pwd) 2>/dev/null && then --verbose
+		'quoted text' -eu "$@" grep "$@" test $(pwd) awk readonly "$1"
+grep ${HOME} x=1 "$@" && ${HOME} echo
+		cd "$1" printf -eu grep ${HOME} x=1 export x=1 printf ${HOME} readonly 'quoted text'
+	"$1" awk test && readonly cd "$@" sed && | $(pwd) -eu done $(pwd)
+		sed | $(pwd) 'quoted text' local readonly
+		$(pwd) "$1" local then echo /usr/bin then export done "$1" readonly
+cd readonly test 'quoted text'
+		local && awk && done 'quoted text' 'quoted text' echo echo
+		--verbose awk then local export test sed "$1" export local -eu
+		test sed test /usr/bin awk /usr/bin printf | grep done
+	2>/dev/null && 'quoted text' $(pwd) /usr/bin readonly
+sed local export 'quoted text' ${HOME} 'quoted text' done "$@" x=1 "$1"
+	${HOME} $(pwd) --verbose printf x=1 test ${HOME} cd -eu /usr/bin "$@" ${HOME}
+		export test readonly --verbose then "$@" grep local done
+grep ${HOME} ${HOME} ${HOME} printf sed 'quoted text' local ${HOME}
+		done 'quoted text' printf && then then echo readonly local
+$(pwd) readonly /usr/bin echo 2>/dev/null --verbose awk
+cd | && grep done "$1" /usr/bin grep /usr/bin
+		| test "$1" $(pwd) sed awk awk readonly ${HOME}
+'quoted text' local awk grep /usr/bin "$@" ${HOME} x=1 'quoted text'
+		2>/dev/null 'quoted text' -eu local readonly 2>/dev/null awk echo /usr/bin
+		2>/dev/null /usr/bin "$1" ${HOME} && /usr/bin done 2>/dev/null
+cd sed local readonly grep -eu x=1 "$1"
+cd readonly ${HOME} --verbose /usr/bin -eu done $(pwd) echo x=1 2>/dev/null
+"$@" done 2>/dev/null ${HOME} $(pwd) "$1" then | -eu echo awk sed x=1 awk
+sed export && done "$1" --verbose --verbose cd grep readonly grep echo "$@" --verbose
+grep done "$@" -eu --verbose && /usr/bin
+| x=1 | /usr/bin | 'quoted text' cd sed test
+		${HOME} readonly local "$@" printf 2>/dev/null ${HOME} $(pwd)
+	local sed test 2>/dev/null ${HOME} "$@" printf "$@" then sed /usr/bin
+		x=1 $(pwd) && "$1" 'quoted text' 'quoted text' export test 2>/dev/null awk local
+	"$@" then awk done grep "$1"
+		readonly "$@" cd echo $(pwd) then echo readonly -eu ${HOME}
+	2>/dev/null test printf --verbose
+	x=1 then --verbose then | done "$1" then -eu /usr/bin local printf
+| /usr/bin sed 2>/dev/null x=1 ${HOME}
+"$@" "$1" local sed cd 2>/dev/null
+		sed then -eu local /usr/bin x=1 x=1 && export cd local "$1" local /usr/bin --verbose
+		test /usr/bin ${HOME} test 2>/dev/null printf
+	$(pwd) test | --verbose x=1 /usr/bin test echo "$@" awk sed
+export "$@" test /usr/bin x=1 done
+		grep readonly sed done readonly
+	'quoted text' x=1 $(pwd) then 'quoted text'
+		done test awk local -eu x=1 echo "$@" readonly $(pwd) done |
+		${HOME} && echo cd -eu 'quoted text' "$@" /usr/bin "$@" -eu "$1" then
+		| echo export --verbose sed readonly x=1 echo 2>/dev/null
+		done | test "$1" /usr/bin "$1" cd grep awk local "$@" printf "$1"
+		echo /usr/bin "$1" -eu 'quoted text' echo | then "$@" export awk &&
+		x=1 sed done --verbose printf then sed --verbose "$1" 'quoted text' readonly
+local awk sed then local 'quoted text' done ${HOME} x=1
+		&& cd "$@" readonly && test "$1" && --verbose test done -eu awk $(pwd) | done x=1
+	-eu cd 2>/dev/null done then done x=1 -eu "$@" awk export printf local echo
+	$(pwd) awk && 'quoted text' "$@" export 2>/dev/null "$1" --verbose --verbose
+		echo && test local echo cd | x=1 'quoted text' export export done
+done sed cd 'quoted text' ${HOME} done --verbose
+	sed sed local --verbose local awk ${HOME}
+grep sed readonly cd echo $(pwd) awk readonly sed awk 'quoted text'
+x=1 x=1 --verbose --verbose -eu readonly /usr/bin printf then x=1 ${HOME}
+"$1" echo | printf readonly then grep done awk ${HOME} "$1" && test
+sed ${HOME} local printf 'quoted text' echo /usr/bin && test x=1 then ${HOME}
+"$1" test $(pwd) && done 2>/dev/null 'quoted text'
+"$1" --verbose $(pwd) x=1 "$@" then && x=1 awk $(pwd) -eu 'quoted text'
+		done export 2>/dev/null "$1" test grep awk export "$@" cd
+	/usr/bin export readonly printf cd cd 2>/dev/null
+		"$@" grep test | sed /usr/bin "$@"
+	x=1 2>/dev/null 'quoted text' "$@" ${HOME} /usr/bin printf readonly readonly
+	${HOME} printf test test awk &&
+	export export cd x=1 x=1 'quoted text' sed done && export /usr/bin
+sed test echo export 'quoted text' --verbose 'quoted text' test ${HOME} 'quoted text'
+"$1" grep grep awk export --verbose export "$1" sed then readonly 'quoted text'
+$(pwd) printf $(pwd) --verbose | "$1" && /usr/bin readonly -eu ${HOME}
+	x=1 $(pwd) echo $(pwd) cd x=1 printf 'quoted text' readonly local then
+local ${HOME} $(pwd) printf export $(pwd)
+		cd 2>/dev/null then printf
+		local ${HOME} printf echo -eu
+		cd "$@" ${HOME} echo readonly ${HOME} cd export --verbose
+${HOME} local readonly export cd && /usr/bin export | "$@" /usr/bin
+		export /usr/bin "$@" sed "$@"
+		awk echo -eu 2>/dev/null -eu "$1" then
+awk sed done /usr/bin local | -eu | ${HOME} && | done 'quoted text'
+	-eu "$@" 'quoted text' ${HOME} local grep $(pwd)
+then test ${HOME} local --verbose readonly
+		-eu export test 2>/dev/null -eu -eu local export local 2>/dev/null then
+then | local done -eu export grep 'quoted text' --verbose test
+		/usr/bin printf done | awk test cd ${HOME} --verbose readonly /usr/bin
+	2>/dev/null printf grep echo export grep "$@" test readonly printf sed
+		readonly "$1" grep echo done 'quoted text'
+		"$@" 2>/dev/null done test x=1 ${HOME} "$1" then --verbose
+		local "$@" /usr/bin ${HOME} x=1 then readonly export done
+	&& export -eu then export readonly cd awk grep done ${HOME}
+	echo awk sed 2>/dev/null && && grep
+	"$1" ${HOME} done --verbose then grep grep readonly done 2>/dev/null
+		"$@" /usr/bin "$1" ${HOME} sed echo /usr/bin
+		printf -eu --verbose "$@" $(pwd) 2>/dev/null local
+		echo 2>/dev/null 2>/dev/null
+	'quoted text' "$@" $(pwd) local --verbose x=1 "$@" ${HOME}
+	cd export --verbose ${HOME} $(pwd) grep $(pwd) echo && readonly
+&& readonly then /usr/bin
+	printf "$1" local 2>/dev/null printf
+	--verbose x=1 /usr/bin --verbose
+	then $(pwd) echo local /usr/bin export && local 'quoted text' test | | readonly
+	"$@" -eu 'quoted text' 'quoted text'
+	readonly printf ${HOME} 2>/dev/null echo export -eu 'quoted text' echo cd sed 'quoted text'
+		done local cd 2>/dev/null "$@" cd local 'quoted text' export awk -eu
+	test grep --verbose "$1" printf 'quoted text'
+		&& then --verbose "$@" printf ${HOME} local cd printf then --verbose | ${HOME}
+--verbose awk sed ${HOME} 2>/dev/null "$@" && "$1" x=1 cd readonly -eu "$@"
+	--verbose --verbose "$1" cd ${HOME} | echo | test 'quoted text'
+&& readonly grep "$1" grep 2>/dev/null && ${HOME}
+	&& echo test done done printf "$1" sed 2>/dev/null
+cd ${HOME} $(pwd) "$1" -eu done -eu export awk test | then export x=1 then
+| done readonly $(pwd) export | "$@" done && $(pwd) "$@" --verbose ${HOME} printf
+	--verbose printf "$1" cd export
+	"$@" sed printf -eu then /usr/bin local $(pwd) done "$@" sed x=1
+	"$1" sed | awk /usr/bin --verbose 2>/dev/null && readonly --verbose echo
+		x=1 | /usr/bin ${HOME} -eu -eu export
+	--verbose grep export ${HOME} "$1"
+	sed sed test cd awk readonly awk -eu local -eu "$@" 2>/dev/null
+	test | 'quoted text' export | --verbose
+		"$@" $(pwd) awk | echo grep "$@" test printf printf 'quoted text'
+		readonly | "$@" x=1 sed && local "$1" cd "$1" then done done
+	2>/dev/null echo && -eu grep
+		grep printf 'quoted text' /usr/bin --verbose cd
+		grep --verbose | 'quoted text' -eu then awk --verbose $(pwd) $(pwd) --verbose
+		/usr/bin grep sed export printf done echo local done test && 'quoted text'
+	cd 'quoted text' echo echo $(pwd)
+	printf done && /usr/bin then export
+		cd readonly cd /usr/bin "$1" x=1
+grep ${HOME} sed export then printf ${HOME}
+		&& $(pwd) export -eu $(pwd) 'quoted text' export
+		readonly | x=1 then -eu
+${HOME} sed ${HOME} local 'quoted text' --verbose
+	export $(pwd) printf
+${HOME} --verbose printf grep
+	done && sed $(pwd) "$@" local
+	"$@" cd test | echo test 'quoted text' cd 2>/dev/null
+| awk awk && $(pwd) test local
+	&& "$1" export cd "$@" -eu echo && --verbose cd awk echo $(pwd) /usr/bin
+	'quoted text' -eu && printf test 'quoted text' export done 2>/dev/null x=1
+		test done grep 2>/dev/null 'quoted text' readonly "$1"
+		awk awk done test x=1 $(pwd) $(pwd) "$1" x=1 /usr/bin done && readonly $(pwd)
+#include c67.sh
+x=1 | $(pwd) "$@" ${HOME} then /usr/bin local x=1 2>/dev/null
+		&& export | done && $(pwd) export done "$@" done "$1"
+	echo -eu printf cd export "$1" readonly && 2>/dev/null
+		/usr/bin -eu done readonly done "$@" -eu
+"$@" readonly 'quoted text' awk grep echo
+test x=1 $(pwd) | 2>/dev/null cd export awk done local &&
+		'quoted text' --verbose cd ${HOME} sed then && | ${HOME} $(pwd)
+| printf sed cd printf then echo then
+		x=1 readonly /usr/bin --verbose sed sed ${HOME} then
+		then --verbose readonly local x=1 ${HOME}
+	echo readonly printf -eu export 2>/dev/null ${HOME} printf && then done
+	-eu 'quoted text' 2>/dev/null grep
+x=1 local && 'quoted text' export 2>/dev/null grep
+	cd export local "$@" local printf ${HOME} readonly grep "$@" |
+	${HOME} "$1" then /usr/bin grep readonly
+2>/dev/null printf | /usr/bin local -eu then && test cd
+"$1" $(pwd) /usr/bin grep "$@" readonly
+$(pwd) local x=1 local grep
+	readonly $(pwd) 2>/dev/null grep echo 2>/dev/null ${HOME} -eu $(pwd) readonly
+&& | 'quoted text' readonly x=1 readonly
+		2>/dev/null readonly cd export x=1 'quoted text' && && "$@" grep 'quoted text'
+"$1" x=1 --verbose done --verbose
+sed echo export grep awk grep /usr/bin awk
+	cd 2>/dev/null 2>/dev/null cd $(pwd) 'quoted text' /usr/bin grep --verbose
+/usr/bin "$1" cd local ${HOME} export echo -eu
+		&& -eu done $(pwd) awk ${HOME} cd echo done cd -eu x=1 grep "$1" test
+$(pwd) | 2>/dev/null | 2>/dev/null cd $(pwd)
+printf export done | ${HOME} --verbose export | "$1" awk local 2>/dev/null
+${HOME} awk && --verbose then 'quoted text' x=1 x=1 'quoted text' readonly
+	${HOME} printf test | /usr/bin readonly 'quoted text' awk awk
+	printf sed | $(pwd) x=1 && "$1" sed then && then awk --verbose awk x=1 done
+echo $(pwd) ${HOME} -eu test 2>/dev/null /usr/bin readonly "$@"
+echo 'quoted text' "$1" /usr/bin ${HOME}
+		$(pwd) $(pwd) readonly | then
+		&& ${HOME} readonly | --verbose /usr/bin | cd export then 2>/dev/null
+	readonly -eu "$@" grep sed "$1" /usr/bin export --verbose then printf
+	${HOME} /usr/bin printf local 'quoted text' -eu | grep x=1
+	export test -eu cd readonly
+'quoted text' /usr/bin "$1" readonly done sed
+		awk "$@" $(pwd) echo cd "$1"
+"$1" readonly awk readonly /usr/bin done
+&& grep /usr/bin ${HOME} x=1 echo echo $(pwd)
+	x=1 grep "$1" "$1" test local then 2>/dev/null $(pwd) done awk && --verbose
+done sed test echo then /usr/bin | ${HOME} grep
+	sed && export printf test /usr/bin
+	${HOME} "$1" done ${HOME} local printf | grep printf
+	--verbose 2>/dev/null "$@" "$1" "$1" export | readonly
+&& "$@" echo sed test awk $(pwd) "$@" awk | readonly printf x=1
+	cd grep /usr/bin "$1" grep awk /usr/bin && sed local
+	'quoted text' awk sed ${HOME} done
+$(pwd) test sed ${HOME} export "$@" grep x=1 grep then done /usr/bin
+"$1" "$1" "$@" 'quoted text' then local done x=1 cd export 'quoted text'
+		cd printf -eu sed cd x=1 |
+done ${HOME} readonly ${HOME} && export | 2>/dev/null
+	"$@" cd $(pwd) /usr/bin
+		echo ${HOME} local | "$1" | --verbose 'quoted text' grep readonly
+	then "$@" local awk ${HOME} local test
+	export printf $(pwd) && awk "$1" x=1 && done echo printf cd
+		$(pwd) ${HOME} cd local /usr/bin | /usr/bin
+	test | awk grep test
+"$1" $(pwd) "$@" echo && test awk "$1"
+$(pwd) printf readonly x=1 cd ${HOME} --verbose "$1" "$1" $(pwd) local then $(pwd)
+echo "$1" && --verbose echo && --verbose then x=1 'quoted text' then "$1" export
+${HOME} 2>/dev/null --verbose
+		--verbose --verbose awk
+local export && $(pwd) printf echo
+	cd "$@" done export x=1 ${HOME} -eu test
+	'quoted text' done "$@" readonly
+| -eu done 2>/dev/null "$1" done grep readonly "$@" -eu done --verbose 'quoted text'
+		x=1 done "$1" | sed && -eu test "$1" export && printf local
+/usr/bin && x=1 && x=1 then sed
+done /usr/bin $(pwd) test done sed done printf
+$(pwd) awk $(pwd) then "$1" test readonly
+		cd echo /usr/bin done --verbose
+	--verbose 2>/dev/null echo done echo "$1" /usr/bin echo printf "$@"
+test 2>/dev/null echo "$1" readonly grep /usr/bin "$@" --verbose "$1" && x=1 test
+		--verbose && | done done test cd "$@" cd cd $(pwd) /usr/bin
+		-eu export local printf sed "$1" cd "$1"
+		"$1" | && -eu /usr/bin "$1" printf 'quoted text' done && then
+		printf $(pwd) then "$@" awk | $(pwd) then printf | 2>/dev/null local cd -eu | then
+x=1 then local 'quoted text' printf $(pwd) -eu export done 'quoted text' done
+printf local printf sed then 'quoted text'
+		export grep "$@" 2>/dev/null 'quoted text' cd $(pwd)
+"$1" sed -eu "$1" 2>/dev/null -eu x=1 test x=1 local | cd local
+		then test x=1 done -eu "$@" printf test readonly then x=1 awk export grep -eu then
+	${HOME} /usr/bin cd 2>/dev/null cd echo 2>/dev/null | cd
+/usr/bin then "$@" printf "$1" done x=1 "$@" x=1 ${HOME} x=1 done sed | printf
+		'quoted text' cd $(pwd)
+	/usr/bin export sed ${HOME} | test ${HOME} "$1" x=1
+${HOME} readonly $(pwd) /usr/bin "$1" $(pwd) cd
+		echo readonly --verbose then "$1" $(pwd) export --verbose "$@" done
+	&& local /usr/bin test echo test | ${HOME} | then -eu
+awk grep ${HOME} 'quoted text' export && cd
+		x=1 printf ${HOME} readonly printf ${HOME} cd sed ${HOME} $(pwd) "$@"
+grep export x=1 export done -eu grep 'quoted text' 'quoted text'
+	&& /usr/bin sed readonly local
+test then ${HOME} echo test
+		grep /usr/bin --verbose printf done done grep test $(pwd) 'quoted text' "$@"
+		awk then cd | echo printf readonly "$1" 2>/dev/null
+		2>/dev/null && local ${HOME} --verbose
+${HOME} echo /usr/bin 2>/dev/null cd
+		then local 2>/dev/null ${HOME} done /usr/bin grep 'quoted text'
+2>/dev/null | sed echo readonly readonly 'quoted text'
+		x=1 local "$@" | test 'quoted text' sed printf
+--verbose x=1 printf grep printf then readonly ${HOME} $(pwd) test cd --verbose
+	export x=1 readonly readonly then awk
+printf x=1 ${HOME} cd readonly && then
+$(pwd) awk | | 2>/dev/null echo awk then local 2>/dev/null
+printf readonly printf readonly ${HOME} awk echo awk 'quoted text'
+		/usr/bin /usr/bin $(pwd) grep sed then awk awk 2>/dev/null
+	echo "$1" $(pwd) 2>/dev/null cd cd
+	-eu 'quoted text' -eu "$@" 'quoted text'
+		2>/dev/null export && echo
+--verbose grep x=1 cd $(pwd) test awk done --verbose ${HOME} echo
+	--verbose cd "$@" printf
+		$(pwd) && 2>/dev/null
+x=1 /usr/bin /usr/bin done 'quoted text' export then done
+| /usr/bin | x=1 ${HOME} $(pwd) test
+	2>/dev/null export $(pwd) cd | 2>/dev/null "$@" cd awk && --verbose
+	--verbose -eu cd x=1 cd $(pwd) export $(pwd)
+		done test 2>/dev/null "$@" "$1" 2>/dev/null $(pwd) cd 'quoted text'
+--verbose echo printf then
+	then sed x=1 test printf | 2>/dev/null
+	then /usr/bin "$1" ${HOME} awk ${HOME} ${HOME} done awk echo "$1" "$@" "$1"
+'quoted text' | done 'quoted text'
+	echo local local $(pwd)
+		done done "$1" test sed $(pwd) export /usr/bin
+		${HOME} | x=1 test printf /usr/bin -eu sed && x=1 then x=1 /usr/bin
+	awk export readonly done x=1 echo | local
+		${HOME} local /usr/bin
+-eu /usr/bin sed -eu /usr/bin echo test "$1"
+-eu && sed --verbose cd printf printf
+		done | x=1 "$1" printf 2>/dev/null ${HOME} readonly
+		'quoted text' sed sed "$@" awk ${HOME} x=1 export ${HOME} -eu "$1" --verbose
+'quoted text' cd && cd && test echo ${HOME} readonly /usr/bin 'quoted text'
+	"$@" export readonly
+readonly readonly && done done echo 'quoted text' awk export
+2>/dev/null grep "$1" awk 'quoted text'
+		--verbose then && x=1 ${HOME} 2>/dev/null /usr/bin
+		| done readonly 2>/dev/null readonly
+		readonly readonly export sed printf sed --verbose "$@" $(pwd) 'quoted text' 'quoted text'
+	done export echo --verbose export export awk readonly awk | local local && 'quoted text'
+${HOME} "$@" ${HOME} local
+	then export cd done "$@" $(pwd) --verbose
+	"$1" -eu then 2>/dev/null 2>/dev/null done ${HOME} test
+		--verbose && && "$@" test 2>/dev/null printf then
+		/usr/bin /usr/bin ${HOME} printf 2>/dev/null sed 2>/dev/null | test readonly
+	'quoted text' readonly ${HOME} 'quoted text' $(pwd) "$@" "$1" "$@"
+export --verbose test "$1" echo "$1" readonly printf |
+		"$@" $(pwd) | readonly printf --verbose test export
+done done "$@" ${HOME} done ${HOME} ${HOME}
+	echo grep && awk awk test -eu --verbose test ${HOME} 'quoted text' readonly
+		test awk x=1 local "$@"
+	grep printf test printf test test /usr/bin export "$1" 'quoted text'
+	then done /usr/bin echo readonly "$1" x=1 grep "$1" export && printf echo export
+	sed 'quoted text' then readonly /usr/bin "$@" 2>/dev/null
+	done | readonly | -eu done | readonly printf then
+		test echo 'quoted text' cd sed x=1 $(pwd)
+grep -eu local echo 'quoted text' cd printf x=1 echo readonly
+		/usr/bin readonly "$@" cd
+		done && sed --verbose cd done local "$@" grep awk readonly ${HOME} local export
+	$(pwd) && x=1 test test then "$@" "$@" -eu done awk --verbose $(pwd) $(pwd)
+	'quoted text' && readonly -eu echo ${HOME} && "$@" -eu 'quoted text' -eu printf
+readonly "$@" grep export done ${HOME}
+		--verbose local "$@" "$1" then 2>/dev/null x=1 printf ${HOME} then
+	$(pwd) -eu 2>/dev/null readonly done awk /usr/bin sed then && &&
+		export x=1 /usr/bin /usr/bin
+grep x=1 test && && test printf "$1" awk cd cd ${HOME} cd awk export local readonly
+		"$@" awk done printf readonly
+awk "$@" test sed readonly export "$1" ${HOME} --verbose /usr/bin sed "$1" -eu
+		$(pwd) local grep export 'quoted text'
+awk | 2>/dev/null "$1" $(pwd)
+	-eu then 2>/dev/null export x=1 | $(pwd) done "$1"
+	sed readonly test 2>/dev/null $(pwd) local "$1" "$@" then $(pwd) done then 'quoted text'
+		echo -eu --verbose | | awk
+	${HOME} x=1 grep 2>/dev/null x=1 --verbose $(pwd) "$@" -eu
+	then -eu "$1" $(pwd) --verbose printf "$@" -eu
+		export "$1" echo ${HOME} local x=1 x=1 $(pwd) $(pwd)
+	${HOME} | ${HOME} readonly readonly then $(pwd) echo test x=1 2>/dev/null
+grep readonly grep printf /usr/bin x=1 printf
+sed export printf $(pwd) awk cd test 'quoted text' 'quoted text' export -eu
+		"$@" printf then | test 2>/dev/null
+then test $(pwd) 2>/dev/null cd sed test echo export $(pwd)
+cd $(pwd) "$@" echo done --verbose
+	$(pwd) cd test export test 'quoted text' done
+readonly && "$1" "$@" "$@" export | -eu cd $(pwd)
+		&& echo $(pwd) ${HOME} /usr/bin then | local cd && export -eu local
+grep readonly | -eu done && $(pwd) && export awk "$1" "$@" awk awk && echo
+	echo local local then cd $(pwd) echo 'quoted text'
+		local printf -eu export echo "$@" /usr/bin && grep $(pwd) awk printf awk $(pwd)
+		${HOME} printf $(pwd) sed && echo | /usr/bin awk --verbose then | then
+	awk local export x=1 /usr/bin ${HOME} done 2>/dev/null
+done 'quoted text' test /usr/bin "$1" x=1 cd "$1" local grep echo ${HOME}
+		grep test "$@" readonly "$@" grep local test | $(pwd) "$1" printf
+		x=1 sed $(pwd) "$1" 2>/dev/null && then
+printf cd | ${HOME} -eu "$@" "$1" cd 'quoted text' && "$@" local export echo
+export $(pwd) /usr/bin && |
+		| done "$@" "$@" -eu $(pwd)
+printf | local awk --verbose x=1 then
+	export ${HOME} grep sed "$1" && done && | cd $(pwd) local readonly
+local x=1 x=1 local $(pwd) $(pwd) | done "$1" then --verbose "$1" /usr/bin 2>/dev/null
+		awk "$@" "$1" printf x=1 x=1 && readonly
+	readonly $(pwd) 2>/dev/null && /usr/bin test --verbose x=1 then printf sed sed
+	'quoted text' "$1" done grep readonly readonly /usr/bin
+| export /usr/bin x=1 export sed /usr/bin test readonly sed /usr/bin echo printf
+		${HOME} --verbose "$@" readonly | ${HOME} readonly local grep then
+	x=1 export "$@" | readonly 2>/dev/null
+| /usr/bin export local export "$1" awk "$1" -eu 2>/dev/null -eu done
+	export /usr/bin 2>/dev/null && /usr/bin printf
+		'quoted text' test "$1" "$@" export cd grep $(pwd) 'quoted text'
+		x=1 && done && | | printf test x=1 "$1" | sed printf awk then
+test x=1 cd local --verbose awk 'quoted text' --verbose 'quoted text'
+${HOME} sed cd /usr/bin x=1 grep echo && awk --verbose
+		&& -eu 2>/dev/null awk ${HOME}
+		readonly cd | "$@" 2>/dev/null
+	echo "$@" /usr/bin "$@" --verbose grep --verbose 'quoted text'
+$(pwd) && export readonly x=1 test "$@" "$@" "$@" && | && done done | 'quoted text'
+	printf && -eu test sed done x=1 $(pwd)
+printf awk "$@" ${HOME} ${HOME}
+	export $(pwd) "$@" /usr/bin x=1 awk --verbose echo test awk
+| 2>/dev/null --verbose 2>/dev/null export
+test export printf done --verbose x=1 && --verbose readonly
+cd test ${HOME} ${HOME} $(pwd) local
+'quoted text' 'quoted text' 2>/dev/null x=1 $(pwd) test && --verbose
+	x=1 readonly done local then
+	done "$1" --verbose 'quoted text' sed sed awk cd ${HOME} 'quoted text'
+	done $(pwd) "$1" ${HOME} ${HOME} grep export 2>/dev/null
+		local readonly /usr/bin readonly printf
+	&& x=1 ${HOME} cd echo grep | echo
+	$(pwd) done "$1" readonly local "$1" | sed grep x=1 done awk
+		| 2>/dev/null test sed readonly | printf printf cd done export grep "$@" printf
+	-eu $(pwd) local sed local
+"$@" echo --verbose local awk
+	"$@" && then | 'quoted text'
+		done /usr/bin readonly && awk awk cd
+	awk "$@" test then grep sed grep
+then awk sed then ${HOME} ${HOME} 2>/dev/null printf echo
+		&& | /usr/bin | "$@" export sed 'quoted text' ${HOME} export awk ${HOME}
+		test then && then done test sed local cd
+	x=1 local 2>/dev/null test
+	sed -eu "$@" -eu "$1" local sed cd $(pwd) | export "$@" x=1
+echo then && done awk x=1 then local --verbose awk --verbose "$1" -eu
+local local --verbose | ${HOME} readonly "$@" ${HOME} then 'quoted text'
+		local 'quoted text' /usr/bin /usr/bin readonly done
+	&& 2>/dev/null 'quoted text' sed && "$@"
+grep 'quoted text' | test "$@" "$1" 'quoted text'
+| && --verbose -eu awk sed ${HOME} x=1 "$@" --verbose
+	-eu printf local readonly /usr/bin sed && x=1 grep
+export --verbose local --verbose echo readonly export $(pwd) cd export done echo
+x=1 sed awk x=1 local -eu printf awk -eu /usr/bin sed awk | $(pwd) "$@"
+done 2>/dev/null grep "$@" test 2>/dev/null grep sed 2>/dev/null && export "$@"
+$(pwd) echo 'quoted text' done grep awk "$1" 'quoted text' printf x=1 && "$1"
+cd $(pwd) "$1" | awk "$1" 2>/dev/null done | then done then printf "$@"
+	local $(pwd) grep && grep sed --verbose cd "$@" grep 2>/dev/null
+readonly -eu -eu && readonly | && echo test printf cd export awk local $(pwd)
+		-eu $(pwd) --verbose grep cd local echo cd "$1" && -eu $(pwd) "$1" export ${HOME}
+		"$@" export 2>/dev/null x=1 awk 'quoted text' ${HOME} 'quoted text' 'quoted text'
+		awk && 'quoted text' awk "$@" then
+		/usr/bin "$@" test printf $(pwd) readonly
+	echo "$@" export printf $(pwd) cd echo 'quoted text' "$1" local "$1" test echo
+		test awk awk "$1" then done
+| then readonly awk 2>/dev/null "$@" | 2>/dev/null printf printf awk "$1" readonly
+		export then --verbose "$1" && local
+	"$1" export cd readonly echo echo --verbose export local "$@"
+		then $(pwd) grep grep && $(pwd) test done --verbose grep -eu readonly ${HOME}
+	"$1" printf echo "$@" awk /usr/bin echo awk "$@" "$@" -eu then done done
+local export --verbose grep readonly | local echo /usr/bin
+	'quoted text' echo readonly --verbose
+		$(pwd) done /usr/bin "$@" readonly local export awk readonly awk done
+$(pwd) export cd && "$1" grep cd local cd grep done then awk readonly
+		then local && test ${HOME}
+x=1 ${HOME} then echo then x=1 cd sed | done grep && -eu printf
+printf then local && then | printf sed | printf printf /usr/bin
+		/usr/bin $(pwd) x=1 /usr/bin | x=1 local x=1
+'quoted text' readonly
+		local export "$1" sed then && grep x=1 x=1 && local "$1" -eu -eu 'quoted text'
+		then test 'quoted text' sed /usr/bin export $(pwd) | 'quoted text'
+| grep sed local awk /usr/bin x=1 grep sed test "$1" $(pwd) 2>/dev/null /usr/bin
+	printf export ${HOME} test "$1" done test 2>/dev/null test ${HOME} cd 2>/dev/null
+		echo test -eu echo test cd $(pwd) | echo printf local sed export ${HOME} awk
+		echo grep --verbose -eu test test printf echo -eu --verbose x=1 && export
+awk echo /usr/bin sed 'quoted text' readonly grep
+		--verbose --verbose test ${HOME} | grep -eu "$1"
+done "$@" then 2>/dev/null
+	local -eu --verbose /usr/bin && sed 2>/dev/null readonly
+	grep readonly "$1" ${HOME} -eu test done sed --verbose --verbose sed test
+	"$1" /usr/bin 'quoted text' /usr/bin
+		"$@" && x=1 --verbose /usr/bin sed
+grep readonly --verbose printf "$@" && /usr/bin cd ${HOME} local test
+	done cd && ${HOME} 2>/dev/null grep
+		/usr/bin 'quoted text' "$@" 2>/dev/null
+then ${HOME} export "$@"
+	done -eu sed "$@" ${HOME} 2>/dev/null
+grep then export awk sed --verbose test awk grep printf export
+	sed -eu grep 'quoted text' test done 2>/dev/null done then 'quoted text'
+then local "$@" cd "$1" "$1" $(pwd) test export then ${HOME} "$@" "$@" 2>/dev/null
+	$(pwd) readonly done readonly "$1" echo $(pwd) | | x=1 ${HOME}
+	readonly sed --verbose ${HOME} test done printf "$@" export echo sed "$@"
+echo printf done "$1" then --verbose "$@" printf echo -eu "$1" /usr/bin cd sed
+		sed 'quoted text' && done
+/usr/bin && | && readonly echo 2>/dev/null cd export $(pwd) awk ${HOME}
+-eu -eu local "$@" test && readonly test
+		| done && --verbose printf
+		-eu printf done sed | awk export ${HOME} then && /usr/bin cd x=1 --verbose x=1
+&& 'quoted text' cd readonly printf printf --verbose done
+	done ${HOME} $(pwd) x=1 && cd export 2>/dev/null
+		grep awk test -eu grep export -eu local ${HOME} 'quoted text'
+local | done $(pwd) local 2>/dev/null && echo printf echo /usr/bin
+	grep export grep x=1
+		test | cd cd echo -eu awk /usr/bin test cd
+		2>/dev/null local test
+2>/dev/null sed ${HOME} /usr/bin --verbose -eu "$@" --verbose grep 2>/dev/null
+		printf --verbose printf x=1 "$@" --verbose awk $(pwd) done &&
+	local then cd 'quoted text' /usr/bin grep 2>/dev/null then /usr/bin cd readonly
+cd "$@" printf && $(pwd) then
+		export then --verbose done sed /usr/bin x=1 test printf 2>/dev/null sed
+cd done done readonly local test echo && export printf
+	$(pwd) 2>/dev/null readonly echo "$1" x=1
+	&& readonly 2>/dev/null
+done test x=1 grep readonly test 2>/dev/null
+	"$@" "$@" printf export readonly 2>/dev/null done && then && -eu ${HOME}
+done export "$@" test grep
+	printf 'quoted text' ${HOME}
+readonly echo cd export awk export echo cd readonly x=1 echo done
+	awk /usr/bin sed sed | done x=1 awk /usr/bin "$1"
+-eu ${HOME} sed cd && "$1" -eu readonly 'quoted text' then
+local local echo echo --verbose export 'quoted text' printf x=1 ${HOME} $(pwd)
+	echo then printf printf 2>/dev/null readonly
+	x=1 then 2>/dev/null "$@" sed then grep
+$(pwd) printf printf | "$1" 2>/dev/null export
+		grep done "$@" "$@" 'quoted text' local "$1" local 2>/dev/null ${HOME} "$1"
+	'quoted text' "$@" printf 2>/dev/null
+		readonly awk --verbose
+		echo printf 2>/dev/null $(pwd) printf grep $(pwd) readonly readonly
+		readonly x=1 echo ${HOME} /usr/bin then awk ${HOME} 2>/dev/null
+cd echo /usr/bin --verbose awk && test cd --verbose
+	grep --verbose --verbose ${HOME} done /usr/bin local --verbose awk "$@"
+	readonly test cd grep ${HOME} 2>/dev/null ${HOME} &&
+		export then export x=1 awk -eu readonly $(pwd) done readonly then done
+	$(pwd) local 2>/dev/null cd readonly printf test done sed --verbose
+		grep -eu ${HOME} x=1 sed done $(pwd) readonly done cd --verbose 'quoted text'
+printf /usr/bin -eu -eu x=1 cd $(pwd) test sed
+"$1" /usr/bin local "$@" $(pwd) awk local "$1"
+		2>/dev/null cd && "$@" test -eu -eu 'quoted text' test -eu "$@"
+	local readonly printf 'quoted text' | printf
+| --verbose awk "$1" | | sed echo local test test
+	'quoted text' | "$1" test export local echo awk
+--verbose readonly "$1" then sed | sed printf
+	--verbose test export 'quoted text' then 2>/dev/null
+&& x=1 printf -eu then && test then readonly
+		cd x=1 'quoted text' local local $(pwd) | && ${HOME}
+		done -eu echo "$1" cd printf cd ${HOME} sed grep "$1" x=1 | --verbose --verbose
+	2>/dev/null /usr/bin "$1" -eu local test local x=1 'quoted text' readonly
+		local cd 2>/dev/null 2>/dev/null awk grep "$1" awk
+		sed readonly | | cd readonly 2>/dev/null "$1" ${HOME} done sed x=1 "$@" | "$1" awk
+printf ${HOME} test 'quoted text'
+&& | 2>/dev/null local "$1" done
+		printf export $(pwd) /usr/bin 2>/dev/null done then | local --verbose ${HOME}
+	then ${HOME} /usr/bin sed 2>/dev/null local printf local $(pwd) awk
+readonly "$1" done done awk | | readonly
+	"$1" $(pwd) printf printf
+	test "$@" "$@" 'quoted text' cd grep awk "$1" then export "$1" local readonly cd
+		export export awk then printf
+		2>/dev/null sed sed 'quoted text' echo /usr/bin grep
+	2>/dev/null --verbose readonly awk readonly | ${HOME} awk grep export -eu awk
+'quoted text' cd grep | ${HOME} then sed "$@" 2>/dev/null
+	sed cd x=1 x=1 2>/dev/null cd awk then --verbose sed readonly $(pwd)
+"$1" printf ${HOME} awk /usr/bin "$@" export echo printf | printf
+	done | /usr/bin echo x=1 | awk 2>/dev/null then local "$1" ${HOME} done
+sed "$1" x=1 echo -eu 'quoted text' $(pwd) /usr/bin
+	--verbose done /usr/bin done
+	export /usr/bin ${HOME} && | --verbose
+	echo export "$@" echo $(pwd) "$1" then export --verbose cd echo
+		cd "$@" local readonly 2>/dev/null /usr/bin | && 2>/dev/null
+		-eu --verbose /usr/bin local grep
+${HOME} --verbose && x=1 awk cd cd 2>/dev/null && sed cd test printf grep done
+	"$@" echo --verbose ${HOME} export x=1 done "$@"
+		local && $(pwd) | printf printf readonly
+--verbose readonly && export
+	&& readonly "$@" 'quoted text' export | readonly
+		cd $(pwd) awk "$1" /usr/bin sed cd 'quoted text' -eu
+	local local then test export 'quoted text'
+&& 'quoted text' cd local $(pwd) /usr/bin $(pwd)
+	printf | awk done awk 'quoted text' --verbose && awk cd test -eu /usr/bin "$@"
+		echo /usr/bin readonly readonly printf
+test 2>/dev/null readonly -eu --verbose
+		cd awk "$@" "$1" | && local -eu echo local readonly test 'quoted text'
+/usr/bin 2>/dev/null 'quoted text' sed grep cd grep readonly
+		awk && awk sed "$1" awk echo grep sed -eu --verbose
+"$@" $(pwd) export | awk grep ${HOME} --verbose
+export 'quoted text' "$1" grep "$1"
+awk local $(pwd) 2>/dev/null ${HOME} 'quoted text' grep grep x=1 x=1 -eu export
+grep -eu -eu then done "$1" done /usr/bin export $(pwd)
+	&& 'quoted text' "$1" grep sed x=1 2>/dev/null | $(pwd)
+printf --verbose echo test then /usr/bin echo awk test local export "$@" export
+	&& grep ${HOME} readonly test
+		-eu local && 'quoted text' "$1"
+printf awk "$1" local 'quoted text' test $(pwd) printf
+		--verbose "$1" printf export awk && awk printf --verbose
+	awk awk $(pwd) grep grep sed $(pwd) -eu
+	export grep 'quoted text' local ${HOME} printf export local awk printf
+	${HOME} awk x=1 grep grep "$1" echo cd && grep test sed ${HOME} "$@" test 2>/dev/null
+	| then && local | done echo -eu readonly readonly "$@" local readonly
+		&& 'quoted text' test "$@" awk done "$1" export x=1 sed "$@" echo 'quoted text'
+$(pwd) x=1 grep $(pwd) x=1 then
+test | 2>/dev/null printf readonly printf local -eu
+	"$1" done printf test x=1 "$1" && echo local grep export
+${HOME} export readonly test -eu "$1" then readonly done "$1" "$@" test echo echo
+		--verbose | -eu printf readonly
+		echo sed /usr/bin then /usr/bin awk --verbose
+	readonly /usr/bin | $(pwd) $(pwd) x=1 'quoted text' local cd done grep x=1
+'quoted text' awk sed done
+	${HOME} | ${HOME} cd ${HOME} done "$@" x=1 done /usr/bin "$1" cd ${HOME}
+		$(pwd) export echo -eu && done ${HOME} ${HOME} readonly "$@" done done export
+	'quoted text' test awk 2>/dev/null grep -eu x=1 cd then "$@" sed 'quoted text'
+	awk grep -eu then done printf 'quoted text' /usr/bin
+		"$@" --verbose printf cd readonly echo readonly && echo echo
+		done | cd -eu | --verbose export cd /usr/bin done "$1" export
+${HOME} x=1 cd x=1 cd local done then --verbose "$@" -eu then export
+		/usr/bin printf --verbose --verbose readonly done printf
+		-eu local sed grep printf x=1 then x=1 --verbose readonly grep "$1"
+		grep then export grep "$@" printf 2>/dev/null
+		echo then local "$1" sed x=1 -eu 'quoted text' --verbose local printf echo ${HOME}
+		export sed x=1 /usr/bin cd x=1 /usr/bin
+$(pwd) sed echo then local
+test sed grep readonly "$1" export -eu local done "$@" x=1 && cd "$1"
+local sed echo x=1 done 2>/dev/null 2>/dev/null
+	awk export then ${HOME} grep "$@" --verbose "$@"
+	x=1 x=1 export echo | | "$@" cd awk sed export x=1 readonly
+	"$1" cd echo awk export 2>/dev/null echo
+		| sed "$@" "$1" printf local "$@" then --verbose -eu "$1" sed then "$@" 'quoted text'
+	--verbose 'quoted text'
+done cd -eu /usr/bin && | $(pwd) readonly export cd "$1" --verbose 'quoted text'
+	-eu local 2>/dev/null 'quoted text' then done | 2>/dev/null
+		readonly awk local export awk
+		&& 2>/dev/null /usr/bin x=1 export done $(pwd) sed echo $(pwd) done
+		export /usr/bin | printf x=1 printf
+| 'quoted text' cd local cd $(pwd) | readonly "$@" test 2>/dev/null test export
+awk && /usr/bin "$@" cd local grep
+"$1" | && then "$1" && printf export sed /usr/bin then && -eu printf $(pwd)
+'quoted text' awk export test ${HOME} grep 'quoted text'
+awk printf sed 'quoted text' "$1" awk test $(pwd) readonly
+	grep test local ${HOME} x=1 printf && then -eu x=1 "$@" readonly
+readonly "$1" 2>/dev/null export
+echo then printf done then ${HOME} then /usr/bin readonly
+		done grep echo 2>/dev/null "$1" "$1" -eu then --verbose $(pwd) sed
+	cd -eu test x=1 $(pwd) /usr/bin
+	done | local test -eu 'quoted text' ${HOME} 2>/dev/null -eu
+x=1 then /usr/bin $(pwd) $(pwd) cd echo
+		"$@" "$1" --verbose "$1" export ${HOME} printf grep | ${HOME} test readonly
+then 2>/dev/null --verbose "$1" $(pwd) -eu "$1" test awk test
+| --verbose printf readonly --verbose sed test -eu
+$(pwd) test | && export 'quoted text' readonly printf grep grep
+	$(pwd) ${HOME} -eu 'quoted text' -eu | test | awk /usr/bin done printf -eu
+		&& cd $(pwd) 2>/dev/null local "$@" sed cd
+$(pwd) "$1" | export 2>/dev/null $(pwd) printf 2>/dev/null $(pwd) $(pwd) export
+		export grep ${HOME} cd 'quoted text' && echo $(pwd) test 2>/dev/null ${HOME}
+	"$@" "$1" 'quoted text' ${HOME} printf echo 2>/dev/null --verbose
+-eu $(pwd) awk awk | "$1" done 'quoted text'
+readonly | test "$@" x=1 /usr/bin
+		"$@" "$1" --verbose ${HOME} grep
+	test export && test $(pwd) readonly -eu done $(pwd) echo
+		-eu echo "$@" echo cd printf 'quoted text' "$1" printf "$1" test ${HOME} "$@"
+		&& readonly printf readonly 'quoted text' && cd /usr/bin
+echo 'quoted text' 'quoted text'
+	&& -eu 'quoted text' awk 2>/dev/null then echo /usr/bin 2>/dev/null &&
+		-eu then --verbose echo test cd 2>/dev/null test local "$1"
+		printf echo grep | -eu local done /usr/bin --verbose then 'quoted text'
+cd cd echo done && export printf readonly done 'quoted text' | done export
+	done printf && -eu x=1 local test --verbose printf
+		"$@" cd echo -eu awk | test
+done 2>/dev/null local awk && 2>/dev/null ${HOME} cd /usr/bin 'quoted text'
+		done x=1 "$@" printf cd 2>/dev/null --verbose 2>/dev/null 'quoted text' grep
+${HOME} done export -eu 'quoted text' ${HOME} &&
+| sed "$1" sed -eu x=1
+"$@" readonly "$1" 2>/dev/null echo done test local then
+	then "$1" local ${HOME} "$1" test sed
+		| local echo $(pwd) x=1 done then
+		sed | test "$@" test grep | | | "$1" then awk x=1
+		x=1 grep -eu /usr/bin
+	echo --verbose x=1 "$@" then | /usr/bin printf
+		awk "$1" $(pwd) sed "$@" cd
+	readonly --verbose cd 2>/dev/null x=1 test --verbose readonly grep
+		${HOME} readonly 'quoted text' local cd --verbose x=1 export
+	'quoted text' sed -eu done x=1 then -eu -eu sed test
+export awk "$1" awk awk --verbose
+test $(pwd) $(pwd) echo "$@" then
+		readonly $(pwd) && awk sed done "$@" done readonly echo -eu "$1" readonly ${HOME}
+	local then "$1" "$@" export
+		awk | then local readonly 'quoted text' 'quoted text' 2>/dev/null
+		then ${HOME} 'quoted text' 2>/dev/null
+	--verbose done then awk
+		$(pwd) "$1" 'quoted text' --verbose export
+	--verbose 2>/dev/null test "$@" && cd awk export 2>/dev/null
+		2>/dev/null printf --verbose /usr/bin "$1" readonly local x=1 sed done awk
+		"$@" awk readonly /usr/bin -eu awk
+awk grep test -eu sed export "$@" 'quoted text'
+	export $(pwd) --verbose 'quoted text' 2>/dev/null
+test readonly && && printf && --verbose 2>/dev/null then
+test /usr/bin "$1" awk done 'quoted text' cd /usr/bin echo then "$@"
+		readonly test awk test echo echo export sed | "$@" -eu
+		| then grep 'quoted text' --verbose echo /usr/bin | && echo
+done "$@" then readonly grep "$@" -eu readonly export done && export
+printf printf cd local done "$@" readonly awk "$@" awk "$1" 2>/dev/null
+		export "$1" local x=1 readonly x=1 -eu done readonly readonly
+		cd 'quoted text' 2>/dev/null ${HOME}
+	$(pwd) cd --verbose then
+	readonly x=1 x=1 --verbose sed grep cd test && done
+-eu awk echo done printf sed grep awk 2>/dev/null grep printf
+awk done grep cd | sed --verbose /usr/bin sed then 2>/dev/null
+$(pwd) $(pwd) -eu cd 'quoted text' ${HOME} 2>/dev/null
+x=1 test printf sed local "$@" awk grep --verbose |
+	x=1 cd && x=1 && grep test echo $(pwd) /usr/bin export "$@" then
+		/usr/bin sed export done 'quoted text' printf $(pwd) awk test && then /usr/bin
+$(pwd) printf x=1 grep 'quoted text' echo awk 2>/dev/null
+printf /usr/bin echo export then && echo -eu done echo printf then printf
+	local --verbose cd ${HOME} | readonly && ${HOME} ${HOME} x=1 done then |
+	/usr/bin done grep grep | done ${HOME} printf cd cd "$@" cd echo readonly
+&& ${HOME} cd grep awk export --verbose done awk test 'quoted text'
+	${HOME} echo 2>/dev/null 2>/dev/null
+		export /usr/bin local printf
+x=1 local x=1 --verbose x=1 'quoted text' /usr/bin && readonly then
+		readonly 2>/dev/null "$1" readonly
+done grep export then done "$@" then sed
+		x=1 /usr/bin | "$@" grep test
+grep -eu printf ${HOME} ${HOME} test done readonly "$1" printf "$@"
+awk local && 'quoted text' cd local $(pwd) then local -eu $(pwd)
+		-eu /usr/bin ${HOME} "$1" grep 2>/dev/null | export grep local 'quoted text'
+sed /usr/bin grep done 2>/dev/null $(pwd) printf awk
+	"$@" $(pwd) echo x=1 "$@" cd -eu x=1 done echo readonly 2>/dev/null readonly echo
+		awk -eu "$@" export cd done /usr/bin ${HOME} sed cd --verbose
+	echo printf grep readonly -eu -eu | $(pwd) printf -eu | export
+awk done "$@" x=1 readonly done x=1 2>/dev/null printf 'quoted text' local
+		/usr/bin ${HOME} grep readonly && local | printf 'quoted text' && then local printf
+		-eu test ${HOME} test printf then readonly 'quoted text' sed -eu -eu done test
+		printf -eu --verbose echo /usr/bin --verbose |
+		| "$@" x=1 echo done $(pwd) 2>/dev/null $(pwd) /usr/bin
+	$(pwd) cd done awk 'quoted text'
+/usr/bin awk export grep --verbose /usr/bin /usr/bin
+| "$1" echo export | readonly $(pwd)
+	"$@" cd 'quoted text' export
+		x=1 local grep x=1 grep done
+	-eu "$1" done 2>/dev/null printf "$@" x=1 2>/dev/null awk
+	-eu test awk | --verbose
+	2>/dev/null sed --verbose grep /usr/bin
+		-eu awk ${HOME} -eu $(pwd) local cd echo 'quoted text' ${HOME}
+printf | "$1" cd test cd printf "$@" then
+		$(pwd) readonly then export grep export
+	echo printf --verbose echo
+echo | x=1 cd cd cd 2>/dev/null printf local
+	awk "$@" 2>/dev/null printf readonly
+export | x=1 cd | | done done x=1
+	--verbose printf readonly grep ${HOME} "$1" printf --verbose then -eu printf ${HOME}
+	grep echo | 2>/dev/null && ${HOME} $(pwd) then "$@" cd --verbose
+		-eu "$@" readonly awk ${HOME} done /usr/bin /usr/bin printf $(pwd) export --verbose
+		printf done -eu /usr/bin grep awk local &&
+		--verbose /usr/bin local 2>/dev/null grep printf cd awk "$@" --verbose
+		grep x=1 2>/dev/null local test sed --verbose ${HOME} | x=1
+	/usr/bin printf | "$1" | "$1" cd cd | ${HOME} 2>/dev/null && "$@" x=1 "$@"
+	--verbose | -eu done sed
+		export ${HOME} "$1" export x=1
+		done /usr/bin echo readonly cd echo /usr/bin 2>/dev/null done
+"$@" cd ${HOME} "$@" then x=1 then /usr/bin awk && /usr/bin "$1"
+	grep grep --verbose cd echo grep && cd grep export
+		'quoted text' readonly then
+		$(pwd) -eu "$1" printf ${HOME} 2>/dev/null printf
+| --verbose printf awk cd 2>/dev/null awk /usr/bin export --verbose
+grep 'quoted text' 2>/dev/null test then sed 'quoted text'
+		'quoted text' then 'quoted text' cd && cd
+		cd -eu then "$1" 2>/dev/null printf "$1" ${HOME} done
+		printf 2>/dev/null $(pwd) awk echo then local x=1 export
+		echo | done && printf /usr/bin local | printf sed $(pwd) $(pwd) "$@" done
+		'quoted text' export x=1 test --verbose $(pwd) printf sed
+	awk grep done --verbose awk -eu
+		"$1" 2>/dev/null "$@" local ${HOME} cd printf awk $(pwd) cd done && printf | awk
+	printf cd local $(pwd) | | done -eu printf printf "$1" sed
+		printf "$1" awk done "$1" then sed awk sed
+	export 'quoted text' cd
+	export ${HOME} "$@" test -eu --verbose 2>/dev/null echo | 2>/dev/null sed
+x=1 done cd echo | readonly --verbose
+$(pwd) && awk $(pwd) done "$@" 2>/dev/null
+	$(pwd) -eu echo test done export
+--verbose then 2>/dev/null 2>/dev/null 2>/dev/null
+	cd 2>/dev/null && test "$@" | "$@" printf --verbose sed export
+		$(pwd) | --verbose done done -eu echo | && done -eu && readonly ${HOME} test grep
+--verbose x=1 export --verbose -eu ${HOME} readonly local -eu && ${HOME}
+	echo sed local test printf $(pwd) readonly
+	then cd 'quoted text' printf "$1" 2>/dev/null
+	| 2>/dev/null $(pwd) test && "$@" echo
+		sed local echo printf "$@" ${HOME} x=1
+	echo "$@" ${HOME} "$@" cd "$@" grep | --verbose "$1" local "$@" $(pwd) "$@"
+	local /usr/bin local 'quoted text' 2>/dev/null done && sed local
+		| --verbose 'quoted text'
+2>/dev/null local /usr/bin --verbose
+then readonly sed grep $(pwd) sed then /usr/bin
+	printf sed done -eu x=1 grep "$@" x=1 2>/dev/null
+		x=1 local then /usr/bin 2>/dev/null then export
+echo then local awk then && ${HOME} export sed -eu done 2>/dev/null
+		$(pwd) /usr/bin "$@" && grep cd export then
+	2>/dev/null then ${HOME} $(pwd) "$@" echo export local sed then ${HOME}
+	test 'quoted text' /usr/bin /usr/bin test x=1 echo
+		"$@" export done "$@" test printf -eu --verbose -eu /usr/bin test then then
+	${HOME} printf 'quoted text' printf ${HOME}
+	test then cd local | 2>/dev/null grep echo && $(pwd)
+done -eu x=1 then readonly printf cd export && grep 2>/dev/null
+test export echo /usr/bin echo -eu cd grep export grep
+	x=1 'quoted text' sed 2>/dev/null 2>/dev/null x=1 | grep test cd && echo && 2>/dev/null
+	"$@" | sed | && test | /usr/bin sed done | then /usr/bin 2>/dev/null
+		echo readonly then done --verbose $(pwd) done grep
+	grep printf cd local && printf x=1 export readonly local "$@" /usr/bin
+		printf /usr/bin 'quoted text' ${HOME} | 2>/dev/null
+		grep then 'quoted text' test then 'quoted text' "$@" 'quoted text' test awk
+		readonly -eu /usr/bin local 2>/dev/null ${HOME} $(pwd) -eu cd | --verbose
+&& x=1 2>/dev/null cd then done /usr/bin test printf -eu
+2>/dev/null "$@" test sed local ${HOME} /usr/bin done printf
+$(pwd) x=1 "$@" x=1 ${HOME} | | x=1 local done /usr/bin "$1" "$@" grep
+	/usr/bin x=1 then "$@" | grep "$1" awk 'quoted text' | $(pwd) local printf
+		test export printf awk x=1 export -eu "$1" grep
+$(pwd) local test sed test && --verbose $(pwd) local
+	grep | "$@" readonly echo | --verbose readonly local "$@" grep test
+x=1 printf 'quoted text' 'quoted text' && done -eu -eu then sed -eu cd
+	&& 2>/dev/null $(pwd) $(pwd) echo done then then sed sed "$1" /usr/bin
+'quoted text' "$1" readonly $(pwd) ${HOME} echo
+	then 'quoted text' ${HOME} local readonly -eu ${HOME} && then && "$1" --verbose
+	-eu && grep cd cd 'quoted text' local then export then then
+		/usr/bin then done "$@" /usr/bin done test 2>/dev/null /usr/bin awk
+local local done then grep awk $(pwd) awk 2>/dev/null && awk
+		$(pwd) awk echo "$1" awk
+then $(pwd) 'quoted text' -eu x=1 readonly export done
+done sed cd export then -eu local "$@" && awk "$@" /usr/bin x=1 export printf
+		${HOME} -eu awk awk ${HOME} echo done 'quoted text' printf "$@" --verbose echo --verbose
+${HOME} -eu cd then 'quoted text' readonly
+| x=1 2>/dev/null grep test cd -eu $(pwd) ${HOME} grep $(pwd) then
+echo then echo 'quoted text' ${HOME}
+		readonly --verbose -eu | cd && then --verbose
+	x=1 /usr/bin /usr/bin done $(pwd) -eu "$1" "$1" 2>/dev/null | printf
+-eu "$1" sed grep printf x=1 'quoted text'
+		test test then x=1 grep -eu
+test echo echo -eu sed then $(pwd) "$@" sed 'quoted text' ${HOME} printf
+		awk echo export --verbose local
+		echo | && sed /usr/bin
+test 2>/dev/null "$@" echo 'quoted text' "$@"
+		/usr/bin echo echo echo --verbose 2>/dev/null "$1" 2>/dev/null
+	then cd export "$1" x=1 | x=1 "$@" local grep "$@" 2>/dev/null
+| local x=1 then && /usr/bin $(pwd) export export export cd readonly readonly
+		printf --verbose readonly
+		sed echo --verbose | x=1 /usr/bin && /usr/bin x=1
+		cd readonly "$1" | "$1" | echo --verbose 'quoted text' "$@" cd readonly -eu &&
+		readonly printf 2>/dev/null "$@" $(pwd) | echo readonly 2>/dev/null printf "$1"
+done 'quoted text' then 2>/dev/null then sed test echo cd | awk cd "$1"
+		-eu export cd awk $(pwd) then test $(pwd)
+		done "$@" /usr/bin 2>/dev/null export done -eu x=1 && x=1
+	export echo then echo -eu then readonly
+	printf sed "$@" x=1 local "$@" sed "$1"
+	export local sed export printf sed sed then "$1" echo readonly
+	test printf printf "$1" 2>/dev/null awk awk "$@" then
+'quoted text' ${HOME} cd x=1 --verbose test
+	/usr/bin cd 2>/dev/null echo
+then -eu 'quoted text' 'quoted text' $(pwd) echo &&
+	test cd local readonly test export 2>/dev/null
+	${HOME} then $(pwd) 'quoted text' printf 'quoted text' printf &&
+		readonly | cd $(pwd) 2>/dev/null $(pwd) "$@" sed awk printf
+	then echo /usr/bin then x=1 -eu echo 2>/dev/null 2>/dev/null | echo | test
+		done 2>/dev/null "$@" "$@" cd printf then readonly awk printf
+	sed 2>/dev/null ${HOME} 'quoted text' awk done readonly 2>/dev/null cd done
+		echo awk grep grep printf /usr/bin "$@" "$1" grep test grep ${HOME} "$@" done
+	grep cd /usr/bin ${HOME} $(pwd) test -eu 2>/dev/null sed $(pwd) ${HOME}
+printf printf local $(pwd) awk
+export | -eu ${HOME} |
+		echo local then $(pwd) done /usr/bin cd cd then done local
+/usr/bin -eu grep cd $(pwd)
+		"$1" test /usr/bin x=1 echo readonly
+		2>/dev/null 2>/dev/null --verbose x=1 x=1 readonly then
+	grep local -eu x=1 /usr/bin awk 2>/dev/null x=1 "$@" "$1" ${HOME} -eu cd export
+	sed ${HOME} 2>/dev/null --verbose && /usr/bin done cd | printf 2>/dev/null local
+	done awk then /usr/bin readonly
+$(pwd) test grep cd sed then x=1 export test | x=1 "$@"
+	grep awk test awk | then grep
+done x=1 "$@" test then local "$1" local test && && cd export
+		2>/dev/null "$@" "$@" local | sed 2>/dev/null 2>/dev/null
+	'quoted text' | sed then 2>/dev/null $(pwd) && readonly && readonly "$@"
+$(pwd) local sed "$1" awk -eu echo printf
+		$(pwd) then printf export readonly printf
+"$1" | done sed printf cd $(pwd) local printf echo ${HOME}
+export local "$@" local local then -eu --verbose
+	echo x=1 sed cd /usr/bin /usr/bin awk && 2>/dev/null /usr/bin sed ${HOME} sed sed
+2>/dev/null ${HOME} local echo "$@" 2>/dev/null /usr/bin
+	cd sed ${HOME} awk export local "$1" done
+	&& --verbose echo ${HOME} /usr/bin echo readonly ${HOME}
+--verbose "$1" && "$@" /usr/bin 2>/dev/null
+local 2>/dev/null 'quoted text' sed cd |
+test local printf test "$@" 'quoted text' "$1" "$@" ${HOME} sed
+		/usr/bin && then cd 2>/dev/null
+	awk ${HOME} export test readonly
+echo "$@" sed test -eu 'quoted text'
+	"$1" /usr/bin then echo grep x=1 $(pwd) grep awk "$1" then awk printf
+		local "$1" printf | cd | ${HOME} awk --verbose
+${HOME} awk readonly 2>/dev/null printf
+/usr/bin done printf readonly "$1" "$1" echo printf
+		x=1 awk /usr/bin --verbose
+		local 'quoted text' done ${HOME} | "$@" --verbose
+	cd done "$1" awk /usr/bin $(pwd)
+		-eu | sed "$@" | then export cd ${HOME} sed export "$@"
+	cd x=1 2>/dev/null x=1 then 'quoted text'
+	echo cd export && printf -eu sed | awk $(pwd) x=1 $(pwd) ${HOME}
+		$(pwd) readonly awk $(pwd) awk $(pwd) -eu
+	cd test awk echo -eu x=1 ${HOME} /usr/bin "$@" done
+printf /usr/bin echo export -eu export $(pwd) /usr/bin x=1
+		--verbose -eu awk "$@" test cd done -eu done grep x=1 | x=1 --verbose
+		done && sed | readonly printf cd local export test sed echo 2>/dev/null -eu x=1
+	"$1" $(pwd) 2>/dev/null | $(pwd) echo -eu echo echo && "$1" export
+		sed "$1" | awk ${HOME} "$1" "$1" 2>/dev/null grep && --verbose then echo
+"$1" "$@" x=1 printf test 2>/dev/null test done sed
+cd test echo done "$1" test export then echo
+	'quoted text' then test x=1 | grep awk sed 2>/dev/null cd grep "$1" printf | |
+	readonly export 'quoted text' done echo --verbose export $(pwd) -eu
+	readonly $(pwd) --verbose
+		/usr/bin 'quoted text' --verbose test && | grep "$@" sed $(pwd) --verbose export
+"$@" x=1 2>/dev/null cd "$@" /usr/bin -eu cd | | 'quoted text'
+printf printf export /usr/bin printf test /usr/bin "$1" awk /usr/bin "$1" "$@"
+	/usr/bin echo cd 2>/dev/null --verbose awk ${HOME} awk "$1" local
+	/usr/bin grep 2>/dev/null done "$@" "$@" 2>/dev/null sed
+"$1" $(pwd) -eu readonly ${HOME} echo grep | awk 2>/dev/null
+	grep printf awk grep 2>/dev/null grep then
+	cd cd test | grep grep then 2>/dev/null echo echo $(pwd) $(pwd) then sed && -eu
+x=1 export 2>/dev/null
+		| awk export "$@" echo x=1 /usr/bin $(pwd) "$@"
+		test done printf export export local export grep export x=1 printf local
+		readonly sed 'quoted text' printf ${HOME}
+	"$1" 2>/dev/null grep readonly && awk local grep ${HOME} "$1" /usr/bin
+		export /usr/bin /usr/bin
+"$@" && x=1 -eu 'quoted text' sed x=1 && readonly 2>/dev/null | printf then cd --verbose
+		readonly test 2>/dev/null cd $(pwd) awk x=1 $(pwd) done x=1 printf -eu /usr/bin
+cd done && 'quoted text' ${HOME}
+		'quoted text' printf then
+$(pwd) then done readonly 'quoted text'
+	${HOME} readonly sed "$1" echo "$@" $(pwd) --verbose --verbose
+'quoted text' readonly -eu done 'quoted text'
+	test 2>/dev/null printf cd export
+export sed x=1 -eu -eu export
+		awk sed grep /usr/bin export
+	sed cd $(pwd) local export echo
+	done local "$@" ${HOME} test then $(pwd) 2>/dev/null
+	test local --verbose readonly
+x=1 sed $(pwd) then 2>/dev/null grep test awk --verbose
+	readonly then local --verbose echo /usr/bin $(pwd) | local
+	--verbose readonly readonly ${HOME}
+	awk 2>/dev/null readonly --verbose test
+		x=1 grep $(pwd) readonly && x=1 export /usr/bin /usr/bin
+	test | awk && local then done grep readonly test local -eu
+"$@" echo | cd ${HOME} printf printf readonly | test grep 'quoted text'
+printf --verbose "$1" &&
+export x=1 "$1" cd echo "$@" printf readonly echo done
+		echo sed && local x=1 | --verbose printf printf local
+readonly grep | x=1 && && /usr/bin 2>/dev/null cd 'quoted text'
+		echo ${HOME} $(pwd) sed
+	x=1 printf /usr/bin then sed --verbose
+/usr/bin done 'quoted text' ${HOME} && "$@" readonly
+2>/dev/null cd 'quoted text' ${HOME} -eu 2>/dev/null "$1" -eu
+		readonly 'quoted text' 'quoted text' test "$1" "$@"
+/usr/bin readonly /usr/bin -eu ${HOME}
+	&& "$1" echo 'quoted text' "$@" --verbose cd --verbose --verbose && awk cd grep
+&& readonly then readonly export "$@" | test done export sed local --verbose
+	echo | printf "$1" sed "$1" export "$1"
+	printf 'quoted text' /usr/bin 2>/dev/null
+	/usr/bin x=1 printf $(pwd) -eu readonly --verbose sed
+export test x=1 printf /usr/bin
+	cd 'quoted text' ${HOME} ${HOME} && x=1 2>/dev/null
+		/usr/bin cd printf cd local export 'quoted text' | readonly echo x=1 then sed
+cd "$@" "$1" | done grep echo test /usr/bin
+printf sed -eu && grep x=1 readonly
+	export 'quoted text' test done 2>/dev/null | /usr/bin
+	awk awk 'quoted text' then local "$1" export export 'quoted text' x=1 2>/dev/null
+		awk /usr/bin local $(pwd) 'quoted text'
+		cd 2>/dev/null | local printf awk readonly /usr/bin | $(pwd) export "$@" readonly
+"$@" test export ${HOME} "$@" "$@" then /usr/bin
+		test awk 'quoted text' -eu ${HOME} $(pwd) && "$1"
+"$@" echo grep local awk -eu 2>/dev/null | "$1" $(pwd) 'quoted text' ${HOME}
+	x=1 then done "$1" test ${HOME} | "$1" "$@" /usr/bin
+	x=1 done /usr/bin readonly /usr/bin
+export export /usr/bin awk --verbose && x=1 then echo x=1 "$@"
+		local local local printf
+	cd printf && ${HOME}
+		"$@" local 2>/dev/null cd $(pwd) /usr/bin "$@" done ${HOME}
+	readonly awk readonly then readonly --verbose x=1 ${HOME}
+2>/dev/null | echo 2>/dev/null 2>/dev/null
+	local "$@" done export echo "$1" readonly -eu readonly $(pwd) | "$@" 2>/dev/null
+	done ${HOME} done $(pwd) printf ${HOME} readonly && local
+		done ${HOME} sed && done sed | readonly test 'quoted text' x=1 sed done "$1"
+	awk readonly awk /usr/bin && printf done export -eu then
+		echo /usr/bin awk sed x=1 sed sed
+	'quoted text' $(pwd)
+	2>/dev/null cd 2>/dev/null echo local -eu grep --verbose
+export done printf local | 2>/dev/null echo 'quoted text' x=1
+	"$@" cd awk done readonly $(pwd) readonly "$1" 2>/dev/null
+x=1 then "$@" x=1 done | -eu done 2>/dev/null | /usr/bin $(pwd) --verbose
+	local done 'quoted text' awk then
+printf awk test -eu ${HOME} awk readonly | 2>/dev/null -eu sed $(pwd) |
+	awk then --verbose /usr/bin x=1 'quoted text' done 'quoted text'
+then $(pwd) "$1" --verbose export grep done
+local then ${HOME} | sed
+	then && && "$1" 'quoted text' then export $(pwd) && | | printf
+		cd then echo cd grep | sed
+local sed 'quoted text' awk grep x=1 -eu
+$(pwd) x=1 "$@" sed then export -eu 2>/dev/null cd local local awk
+$(pwd) sed readonly local cd echo ${HOME} readonly
+	printf export && -eu 2>/dev/null
+then | ${HOME} awk -eu /usr/bin export cd && && && $(pwd) "$@" export --verbose
+	sed export local x=1 "$@" readonly echo awk done 2>/dev/null
+--verbose "$1" echo x=1 done echo local then
+		| awk "$1" "$@" awk | then grep $(pwd) -eu sed export awk "$1" "$1" "$@"
+-eu x=1 && 'quoted text' | -eu echo readonly
+		/usr/bin /usr/bin 'quoted text' local printf --verbose -eu echo done
+	readonly $(pwd) echo awk
+	"$@" printf readonly sed done && sed "$@" "$1" -eu printf grep readonly
+		-eu 'quoted text' ${HOME} local "$@" echo -eu done printf echo ${HOME} export
+awk test grep printf readonly && && 'quoted text' local done local printf
+	then local awk done test sed 'quoted text' "$@" cd && ${HOME}
+'quoted text' echo cd | 2>/dev/null readonly 'quoted text' cd -eu printf "$1"
+test grep grep "$@" done echo
+	grep x=1 $(pwd) 'quoted text' ${HOME} readonly then awk printf sed | 'quoted text'
+		export -eu | echo then ${HOME} $(pwd) x=1 2>/dev/null
+${HOME} -eu local -eu then grep "$@" then ${HOME} "$@" ${HOME} done then
+		"$1" x=1 export | readonly readonly cd "$@" /usr/bin /usr/bin "$1" sed
+	2>/dev/null local test then $(pwd) /usr/bin /usr/bin printf /usr/bin
+echo grep test local export ${HOME} && export printf /usr/bin
+local cd done readonly printf sed /usr/bin $(pwd) "$@" 2>/dev/null
+	"$1" x=1 x=1 -eu 'quoted text' "$1" readonly readonly
+--verbose /usr/bin then
+	x=1 x=1 x=1 printf printf /usr/bin test printf 'quoted text'
+cd 2>/dev/null sed readonly | grep readonly
+		$(pwd) $(pwd) -eu readonly -eu "$@" printf --verbose && done awk printf
+&& x=1 | ${HOME} x=1 -eu sed
+		done readonly --verbose local
+export grep grep 'quoted text'
+	sed test --verbose sed cd && printf /usr/bin printf && local x=1 "$@"
+	2>/dev/null -eu cd -eu $(pwd) grep test readonly local printf done -eu /usr/bin
+x=1 cd export then /usr/bin "$@" awk cd awk ${HOME} then -eu grep sed ${HOME}
+		cd readonly -eu $(pwd) $(pwd) then
+		${HOME} printf 'quoted text'
+	export $(pwd) cd "$@" test $(pwd) local then cd /usr/bin grep
+		2>/dev/null "$1" test /usr/bin awk "$1" $(pwd) 2>/dev/null local
+		-eu ${HOME} test && awk export test
+done test /usr/bin sed
+		x=1 'quoted text' grep export --verbose
+		2>/dev/null "$1" | --verbose
+echo && echo 'quoted text' && -eu test sed 2>/dev/null "$1" x=1 then
+awk x=1 2>/dev/null x=1 then cd | | echo
+-eu grep grep cd test x=1 ${HOME} && export cd echo ${HOME}
+	grep then grep grep x=1 $(pwd)
+	cd 'quoted text' x=1 /usr/bin
+	/usr/bin grep --verbose printf --verbose ${HOME} 2>/dev/null
+"$1" awk -eu readonly local "$@" 'quoted text' cd &&
+printf /usr/bin then awk grep "$1" export $(pwd) printf echo "$@" &&
+	echo ${HOME} awk 'quoted text' test readonly
+		/usr/bin x=1 awk ${HOME} export
+${HOME} x=1 -eu cd $(pwd) 'quoted text'
+"$@" awk sed | 2>/dev/null -eu 'quoted text' test grep test 2>/dev/null
+	export --verbose test "$1" readonly readonly printf -eu done |
+	grep local -eu echo echo grep grep awk sed echo ${HOME}
+	grep | awk cd readonly export done "$@"
+		| | x=1 sed test "$1" $(pwd) cd test printf 'quoted text' && $(pwd) then
+	awk --verbose grep export 2>/dev/null printf 'quoted text' --verbose 2>/dev/null
+x=1 x=1 awk awk && sed awk && -eu readonly grep
+/usr/bin local printf | && local | 2>/dev/null local awk grep awk
+cd sed ${HOME} test --verbose printf then sed sed test 2>/dev/null --verbose readonly
+		export local then echo awk
+"$1" local sed readonly 2>/dev/null cd test $(pwd)
+sed "$@" grep -eu echo 'quoted text' --verbose --verbose "$1" "$@"
+sed | test && test "$@" awk export "$1" 2>/dev/null echo
+	"$1" test done "$@" -eu 'quoted text' 'quoted text' echo printf
+	grep && | x=1 --verbose export "$1" done test | test && $(pwd) printf
+	/usr/bin test ${HOME} --verbose
+		grep readonly local 2>/dev/null echo export && 2>/dev/null echo $(pwd) -eu
+		local sed --verbose sed 'quoted text' --verbose /usr/bin export "$1" export
+$(pwd) echo printf grep x=1
+'quoted text' local awk x=1 grep test ${HOME} --verbose
+'quoted text' local $(pwd) /usr/bin awk done 'quoted text' "$1"
+	/usr/bin x=1 -eu "$@" grep export /usr/bin export echo test
+--verbose grep export cd x=1 -eu awk /usr/bin ${HOME} 'quoted text' export
+		test && && cd echo then cd then done sed "$1"
+sed | "$1" awk -eu grep x=1 cd export
+		x=1 export ${HOME} awk then -eu 2>/dev/null
+		test readonly awk --verbose export 2>/dev/null
+local ${HOME} printf readonly
+	"$1" && 2>/dev/null test echo
+	printf awk "$@" test cd ${HOME} ${HOME} "$@" sed awk export
+echo "$1" readonly /usr/bin echo then
+		readonly --verbose ${HOME} awk -eu local sed ${HOME} | then
+	&& /usr/bin cd readonly echo /usr/bin local done grep -eu then "$1"
+${HOME} && "$@" "$1" && awk
+	done /usr/bin -eu && awk cd | /usr/bin echo $(pwd) 'quoted text' "$@" $(pwd) "$@"
+export "$1" readonly cd awk grep
+	"$1" ${HOME} done | /usr/bin 2>/dev/null
+	"$1" $(pwd) export then grep
+	'quoted text' ${HOME} export done readonly ${HOME} echo export
+	then | --verbose x=1 'quoted text'
+	${HOME} export cd local done 2>/dev/null printf "$1" $(pwd)
+		x=1 x=1 readonly export readonly && x=1 'quoted text' $(pwd) -eu
+		-eu export $(pwd) sed /usr/bin test x=1 awk 'quoted text'
+		--verbose /usr/bin printf "$1" 'quoted text'
+	echo 2>/dev/null export done $(pwd) done x=1 /usr/bin
+	then then "$@" /usr/bin then done && readonly x=1 echo grep
+	export printf then then "$@" then export && | && "$@"
+	readonly "$1" export export --verbose cd
+	export grep echo cd export grep
+	grep sed sed x=1 | ${HOME} cd -eu sed ${HOME} echo ${HOME} done ${HOME} "$@"
+	$(pwd) local "$1" printf sed echo 2>/dev/null readonly "$@" done
+		grep export | 2>/dev/null
+	/usr/bin -eu && $(pwd) test $(pwd)
+printf "$@" sed -eu export | done sed $(pwd) x=1 && -eu grep --verbose
+		| | grep $(pwd) then && "$@" awk
+		cd "$1" $(pwd) sed echo awk
+	export echo test awk ${HOME} $(pwd) then "$@" ${HOME} sed printf
+$(pwd) done export 'quoted text'
+	'quoted text' export && "$@" printf 2>/dev/null
+	| x=1 'quoted text' done local ${HOME} x=1 done cd x=1 ${HOME} ${HOME}
+		x=1 /usr/bin --verbose then
+	printf | grep "$@" test grep
+x=1 ${HOME} local local export local /usr/bin test printf "$1" readonly --verbose
+printf export x=1 grep cd then --verbose local done
+"$@" | sed "$1" local 'quoted text' 'quoted text' echo cd "$@" "$1"
+cd | export -eu awk local ${HOME}
+	-eu "$1" done x=1 cd test grep --verbose && readonly $(pwd) readonly
+		x=1 $(pwd) 2>/dev/null --verbose printf
+	/usr/bin cd cd $(pwd) | 'quoted text' sed | done local -eu
+		export 2>/dev/null test test awk $(pwd) cd 2>/dev/null done "$1" 'quoted text'
+	awk done test done $(pwd) awk $(pwd) "$@" | grep x=1 cd awk
+-eu local printf local | grep && | --verbose ${HOME} $(pwd) then local echo local
+	'quoted text' done export awk cd -eu export
+'quoted text' 2>/dev/null done
+		/usr/bin $(pwd) | then test cd export export $(pwd) readonly
+awk | | export 'quoted text' 'quoted text' -eu
+		test sed --verbose cd cd export sed | ${HOME}
+		"$1" then cd then then 2>/dev/null then sed
+	-eu echo && "$@" sed echo printf export ${HOME}
+-eu done --verbose export sed && | | test done export grep 2>/dev/null
+cd readonly local 2>/dev/null
+&& "$@" "$1" readonly --verbose && local $(pwd)
+-eu 'quoted text' --verbose grep printf x=1 readonly local 2>/dev/null sed
+	&& && "$@" && done --verbose then readonly
+"$1" grep && grep --verbose x=1 'quoted text' echo -eu -eu awk | test
+awk cd test $(pwd) --verbose sed done
+-eu then echo local 'quoted text' | && export cd "$1" echo readonly --verbose
+		/usr/bin local sed --verbose awk done
+&& local "$@" echo done --verbose export printf
+2>/dev/null | "$1" local local cd "$1" x=1 then -eu x=1 ${HOME}
+readonly cd && printf "$@" grep done
+	done && /usr/bin grep "$@" "$@"
+2>/dev/null --verbose local 2>/dev/null && ${HOME} /usr/bin export -eu awk
+		'quoted text' "$1" readonly
+		'quoted text' /usr/bin
+		x=1 grep readonly --verbose
+x=1 $(pwd) test test then && then -eu -eu "$1" 2>/dev/null
+		&& readonly awk printf /usr/bin
+	export ${HOME} printf done ${HOME} readonly awk then sed /usr/bin
+	local --verbose ${HOME} x=1 cd "$1"
+		-eu sed printf && --verbose --verbose $(pwd) --verbose done 'quoted text'
+-eu ${HOME} sed printf -eu "$@" export 2>/dev/null
+local export 2>/dev/null /usr/bin local local export "$1" $(pwd)
+	test cd "$@" test printf cd 'quoted text'
+		2>/dev/null ${HOME} ${HOME} ${HOME} done && echo $(pwd) && ${HOME} "$@" grep awk
+	$(pwd) awk then local $(pwd) awk printf
+	then 'quoted text' x=1
+cd grep -eu readonly sed echo ${HOME}
+	"$1" sed sed local --verbose export done 2>/dev/null
+		done ${HOME} | echo printf echo "$1" local then awk sed
+	${HOME} 2>/dev/null cd printf done
+		$(pwd) 'quoted text' awk && local | 'quoted text' done -eu done | then
+		2>/dev/null grep "$@" --verbose echo awk --verbose local "$@" cd ${HOME} export
+	/usr/bin readonly local local -eu readonly
+	sed test && test && sed sed grep readonly
+		/usr/bin 'quoted text' | -eu then sed $(pwd)
+	/usr/bin then x=1 printf | ${HOME} -eu done cd "$@" done printf
+	2>/dev/null export -eu test local $(pwd)
+	done --verbose then local ${HOME} test done grep sed "$@" cd
+	x=1 -eu 'quoted text' --verbose export 2>/dev/null test printf
+x=1 grep x=1 cd x=1 test then then "$1"
+		then local "$@" 'quoted text' "$@" readonly awk $(pwd) -eu
+	sed awk x=1 -eu /usr/bin then && "$1"
+		'quoted text' export 2>/dev/null
+		awk export cd printf local grep "$@"
+	then $(pwd) --verbose 'quoted text' cd awk then ${HOME} | then ${HOME}
+	export && awk printf ${HOME} test "$1" then awk /usr/bin then "$1" 2>/dev/null
+		awk | echo "$1" echo "$1" 'quoted text' local
+		2>/dev/null readonly then 'quoted text'
+		grep && $(pwd) awk "$1" 'quoted text'
+		-eu ${HOME} then -eu
+	${HOME} $(pwd) | -eu $(pwd)
+	export then $(pwd) test /usr/bin $(pwd) readonly "$1" -eu x=1 readonly
+		"$@" sed then cd x=1 2>/dev/null
+sed 'quoted text' readonly printf
+test test test --verbose -eu x=1 && echo -eu export then /usr/bin sed done
+		export 'quoted text' -eu readonly readonly
+-eu "$@" cd -eu readonly $(pwd) grep then "$1" | 'quoted text'
+	"$1" readonly sed sed awk export sed
+		sed printf "$@" /usr/bin grep done grep awk 2>/dev/null sed readonly local $(pwd)
+		-eu awk done && readonly "$@" cd then cd sed cd
+	test x=1 'quoted text' ${HOME} test grep
+	test && x=1 export test export --verbose x=1 test sed -eu echo ${HOME}
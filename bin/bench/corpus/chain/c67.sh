@@ -0,0 +1,2001 @@
+	&& cd done "$@" cd then "$@" done sed "$1" sed $(pwd) echo sed | cd "$1"
+-eu awk --verbose 2>/dev/null x=1 then printf && readonly
+		cd 'quoted text' cd done sed local cd
+		awk -eu done --verbose
+readonly -eu local /usr/bin readonly "$1" --verbose
+		&& && local export sed | /usr/bin echo export --verbose sed --verbose
+		readonly cd readonly grep cd grep export sed done
+	&& | cd cd --verbose sed ${HOME} /usr/bin
+	printf echo ${HOME} done x=1 test /usr/bin
+"$1" echo 2>/dev/null cd /usr/bin --verbose local awk
+	-eu done done test grep --verbose x=1 -eu 'quoted text' -eu ${HOME} done "$@" awk
+	x=1 --verbose "$@" done local cd |
+		then readonly "$@" sed then "$@" --verbose /usr/bin ${HOME} |
+	cd -eu 'quoted text' sed then "$1" && 2>/dev/null && --verbose local $(pwd) &&
+		local done local echo done done done local && /usr/bin $(pwd) --verbose $(pwd)
+	grep | done awk "$@" local && | printf 'quoted text' && echo
+&& 'quoted text' local local ${HOME}
+		sed grep $(pwd) echo awk
+	'quoted text' readonly | "$1" readonly echo readonly
+	local then done /usr/bin local grep -eu local
+	then && done awk test "$1" --verbose
+then | -eu "$1" ${HOME} grep | "$@" 2>/dev/null -eu &&
+		"$@" && $(pwd) "$@" ${HOME} ${HOME} local ${HOME} readonly awk /usr/bin local
+${HOME} grep "$1" printf ${HOME} "$@"
+readonly local awk $(pwd) echo
+local local cd printf "$@" && 'quoted text' awk "$1" ${HOME} /usr/bin
+		readonly echo "$1" x=1 --verbose cd && export echo test echo --verbose
+		export x=1 cd /usr/bin done && -eu cd x=1 echo sed readonly cd awk
+		sed readonly awk cd /usr/bin && 2>/dev/null 2>/dev/null echo grep
+'quoted text' then local | ${HOME}
+		test cd && test printf 'quoted text'
+		${HOME} x=1 $(pwd) -eu grep /usr/bin then done awk cd /usr/bin
+		grep "$@" cd test printf cd export test awk grep echo $(pwd) printf
+		/usr/bin -eu $(pwd) 'quoted text' export
+	grep --verbose printf $(pwd) $(pwd) sed export
+	"$1" printf test ${HOME} then awk
+		--verbose printf x=1 ${HOME} export then awk test 2>/dev/null &&
+local done $(pwd) $(pwd) test local --verbose export export ${HOME} local test ${HOME}
+x=1 sed printf 2>/dev/null local -eu local
+x=1 awk sed --verbose | done --verbose
+${HOME} | $(pwd) "$@" "$1" ${HOME} echo -eu cd printf x=1
+	'quoted text' "$@" 2>/dev/null
+		export -eu export -eu test grep "$1" export readonly && -eu grep test
+	2>/dev/null 2>/dev/null | --verbose printf -eu
+awk --verbose "$1" test ${HOME} local -eu -eu sed | --verbose
+readonly done awk readonly echo
+		sed -eu printf printf then grep --verbose readonly
+cd $(pwd) 'quoted text'
+cd ${HOME} $(pwd) cd local "$@" readonly export readonly "$@" /usr/bin awk awk
+	&& 'quoted text' readonly 'quoted text' echo then | 2>/dev/null
+		local 2>/dev/null "$1" && -eu 'quoted text' grep ${HOME} export
+	test 'quoted text' 'quoted text' "$1"
+	&& echo grep then printf 2>/dev/null then && "$1" /usr/bin -eu local $(pwd) awk
+	--verbose grep && "$1" 2>/dev/null done done
+		grep local $(pwd) "$1" "$@" /usr/bin ${HOME} local 2>/dev/null printf then ${HOME}
+		-eu x=1 then && grep "$@" readonly
+2>/dev/null | local --verbose
+	--verbose /usr/bin readonly
+	cd then "$@" 'quoted text' x=1 && test cd sed | | x=1 sed test 2>/dev/null
+		echo "$@" | done sed grep export "$@" ${HOME} grep ${HOME}
+	2>/dev/null $(pwd) sed "$1" 2>/dev/null
+done $(pwd) done grep /usr/bin /usr/bin ${HOME} awk --verbose "$@"
+		-eu "$@" /usr/bin 2>/dev/null
+	${HOME} "$1" $(pwd) sed printf cd cd 'quoted text' 2>/dev/null
+echo $(pwd) && $(pwd)
+local test 2>/dev/null readonly local sed
+	2>/dev/null cd | readonly 'quoted text' echo
+	cd local /usr/bin 'quoted text'
+grep awk awk export 2>/dev/null
+		-eu echo "$@" printf && local awk && export
+		x=1 printf local cd /usr/bin
+		printf -eu $(pwd) ${HOME} ${HOME}
+/usr/bin "$1" export printf
+${HOME} export done awk | then printf
+then readonly --verbose export "$1"
+	test -eu printf && export ${HOME} x=1 x=1 grep 2>/dev/null /usr/bin
+$(pwd) sed 'quoted text' 2>/dev/null $(pwd) "$1" "$@" "$1"
+		done 'quoted text' -eu | printf then export "$@" sed test export
+	readonly x=1 export echo /usr/bin then local $(pwd)
+		'quoted text' readonly export readonly $(pwd) cd
+		sed --verbose cd --verbose --verbose /usr/bin 2>/dev/null then
+	2>/dev/null "$1" --verbose cd printf awk local awk done cd cd cd
+		printf && "$@" grep 'quoted text' test |
+-eu local readonly then && 'quoted text' local test x=1 --verbose local cd -eu
+		${HOME} "$@" sed test -eu then cd && awk "$1" 2>/dev/null
+	x=1 x=1 test --verbose then
+		&& cd local readonly $(pwd) grep /usr/bin
+		printf | ${HOME} /usr/bin test x=1 cd
+readonly done sed x=1 $(pwd)
+--verbose test echo readonly test | 2>/dev/null 'quoted text' /usr/bin "$@"
+		readonly -eu /usr/bin -eu export
+	export "$1" && "$1" test $(pwd) done then export
+	done "$@" echo x=1 cd
+		local sed printf -eu then ${HOME} 'quoted text' local
+	grep /usr/bin readonly grep $(pwd) local sed local ${HOME} && cd | "$@"
+		sed /usr/bin | export x=1 "$@" ${HOME}
+		sed readonly readonly --verbose test awk cd readonly cd -eu then "$@" "$@" readonly
+'quoted text' | --verbose sed | cd x=1 "$1" then --verbose sed && 'quoted text'
+		grep local x=1 cd local | -eu
+/usr/bin printf x=1 printf -eu /usr/bin echo awk $(pwd) -eu cd
+		printf "$1" grep "$@" | -eu
+	sed "$1" local grep cd printf local readonly
+'quoted text' awk 'quoted text' awk | /usr/bin printf echo test awk printf
+	printf cd 'quoted text' local export | "$@" printf
+		"$1" --verbose /usr/bin done awk 2>/dev/null $(pwd) 'quoted text' grep
+		'quoted text' awk x=1 "$@" 2>/dev/null 2>/dev/null --verbose "$@" "$@" echo
+local sed ${HOME} "$1" grep
+	2>/dev/null && 2>/dev/null
+	echo printf "$@" printf sed local x=1
+	$(pwd) echo | "$@" -eu local $(pwd) then $(pwd)
+		| awk x=1 sed export test sed local printf "$@" grep
+		then sed $(pwd) awk "$1" | export
+	printf cd grep cd done sed -eu | 2>/dev/null
+-eu done -eu | "$1" 2>/dev/null
+sed grep $(pwd) --verbose local awk cd "$@" grep ${HOME} echo
+	$(pwd) -eu done cd awk echo then local
+	awk awk 'quoted text' --verbose
+		local export done x=1 'quoted text' local | sed "$1" done printf
+		/usr/bin cd sed 2>/dev/null cd
+	2>/dev/null echo $(pwd) "$1" then 'quoted text' | export
+		/usr/bin sed "$1" x=1 echo done --verbose "$1" /usr/bin "$@" export | 2>/dev/null
+		then readonly test && echo "$@" /usr/bin
+	"$1" sed printf echo printf ${HOME} echo grep sed cd "$1" -eu &&
+grep grep "$1" | sed | sed 'quoted text' test && awk done test $(pwd) 'quoted text'
+'quoted text' && && awk
+		then | local export /usr/bin x=1 export -eu test export -eu test test
+'quoted text' then -eu grep x=1 -eu test --verbose && -eu
+		local grep echo "$@" echo printf $(pwd)
+		x=1 grep /usr/bin export echo export echo export
+"$1" cd grep test echo local then 'quoted text'
+echo export cd --verbose -eu 'quoted text' readonly ${HOME} cd &&
+		x=1 $(pwd) printf sed grep done --verbose done test | $(pwd) grep test sed
+	-eu 'quoted text' /usr/bin printf then then printf readonly && sed
+/usr/bin 2>/dev/null
+	| then sed done | "$1" awk && done --verbose && && ${HOME} cd
+	$(pwd) "$@" export "$@" test -eu awk /usr/bin -eu |
+	| readonly then x=1 | readonly -eu awk 'quoted text' grep
+	$(pwd) done readonly -eu 'quoted text'
+	2>/dev/null sed x=1 export test x=1 -eu awk | "$@" -eu
+$(pwd) sed /usr/bin $(pwd) x=1
+	done readonly --verbose | sed --verbose 2>/dev/null readonly
+	$(pwd) x=1 --verbose cd test "$@"
+-eu -eu echo ${HOME} readonly done
+done /usr/bin && --verbose sed grep awk export readonly
+	test readonly /usr/bin $(pwd) printf sed -eu then "$@" grep && $(pwd) -eu
+	&& ${HOME} done "$1" x=1 && $(pwd) -eu $(pwd) 'quoted text' ${HOME} readonly
+		/usr/bin sed test test /usr/bin done ${HOME} $(pwd) 'quoted text' $(pwd)
+	printf local 'quoted text' done awk $(pwd) readonly readonly echo printf
+	| export 'quoted text' --verbose local && $(pwd) "$1" grep export "$@" printf local
+	--verbose export "$1" awk | -eu ${HOME} 2>/dev/null export readonly 'quoted text'
+	done sed ${HOME} | done --verbose test && printf done ${HOME} cd grep readonly
+		then done grep 'quoted text' echo echo 'quoted text'
+export | 'quoted text' local export
+	sed grep grep grep done readonly echo printf local "$1" test
+	grep export test x=1 sed
+		test $(pwd) then export echo 'quoted text' cd
+	x=1 done echo 2>/dev/null echo $(pwd) ${HOME} $(pwd) awk x=1 -eu "$@" grep && &&
+	done done readonly 'quoted text' readonly local 'quoted text'
+		$(pwd) test $(pwd) printf 'quoted text' export $(pwd) then echo x=1 test grep &&
+		readonly /usr/bin "$@" then then done sed 2>/dev/null done local sed printf x=1
+		echo done awk 'quoted text' cd 2>/dev/null
+		x=1 ${HOME} /usr/bin export -eu grep $(pwd) grep readonly "$1" printf -eu
+	&& local export readonly
+		readonly 2>/dev/null "$1" "$@" --verbose
+'quoted text' then /usr/bin cd 2>/dev/null local /usr/bin
+	done printf -eu "$@" sed --verbose awk 2>/dev/null -eu "$1" cd readonly
+/usr/bin --verbose | 'quoted text' --verbose echo
+		local printf local echo readonly --verbose "$@" grep | grep 2>/dev/null $(pwd)
+	x=1 $(pwd) "$@" && /usr/bin x=1 then | grep awk |
+		done readonly x=1 test 'quoted text' -eu
+		/usr/bin x=1 ${HOME} --verbose
+sed grep "$1" | sed cd
+"$@" awk "$1" 2>/dev/null then
+	'quoted text' grep readonly sed 2>/dev/null echo export local sed "$1"
+		then $(pwd) -eu /usr/bin cd | "$1" 'quoted text'
+	sed test export 'quoted text'
+		"$1" then cd | sed export echo "$1"
+${HOME} 2>/dev/null grep "$1" awk done test echo
+	export local --verbose grep --verbose test sed 'quoted text' grep -eu -eu /usr/bin
+	${HOME} test --verbose echo "$1" cd $(pwd) grep awk test 'quoted text'
+		grep "$1" x=1 ${HOME} cd awk $(pwd) cd --verbose then cd ${HOME} ${HOME}
+cd "$@" export -eu local printf --verbose readonly local
+-eu "$1" -eu 'quoted text' done | sed awk done
+		x=1 -eu -eu --verbose grep && then --verbose local $(pwd) | "$@" awk
+	awk then | $(pwd) test $(pwd) then
+done -eu done awk "$@" 2>/dev/null 'quoted text'
+	echo echo "$1" "$@" cd printf --verbose x=1 'quoted text' cd then export
+printf readonly local readonly test 'quoted text'
+	"$1" echo done echo readonly x=1 then 'quoted text' export --verbose
+$(pwd) cd grep x=1 --verbose local then printf -eu 'quoted text' 'quoted text'
+		echo echo "$1" "$@" 2>/dev/null awk sed
+		'quoted text' echo | -eu cd export --verbose 'quoted text'
+		awk test --verbose /usr/bin
+"$1" echo cd /usr/bin cd 2>/dev/null done echo
+		"$1" && $(pwd) /usr/bin $(pwd) awk | x=1 && x=1
+		${HOME} grep 2>/dev/null $(pwd)
+test readonly && -eu 'quoted text' awk ${HOME}
+awk printf 'quoted text' local | sed then cd && /usr/bin done /usr/bin x=1 cd echo
+		export test 2>/dev/null readonly readonly sed sed done readonly
+grep test readonly "$@" 'quoted text' done grep -eu "$@" readonly
+		--verbose 'quoted text' && test printf awk ${HOME} sed done grep -eu then &&
+	sed && test test grep ${HOME} readonly ${HOME} $(pwd) local
+		local x=1 /usr/bin 'quoted text' 2>/dev/null
+		'quoted text' --verbose
+		'quoted text' "$@" local printf && 'quoted text' awk sed test /usr/bin
+		echo && echo x=1 | then 'quoted text' 2>/dev/null echo awk
+printf 'quoted text' test --verbose sed sed cd test /usr/bin
+		"$1" done "$1" x=1 'quoted text' awk grep echo 2>/dev/null -eu local printf
+		$(pwd) | 'quoted text' 2>/dev/null printf
+$(pwd) then $(pwd) awk export printf then export x=1 readonly "$@" printf "$@"
+	'quoted text' test | local 2>/dev/null
+	/usr/bin printf local then 'quoted text' "$@" awk 2>/dev/null
+		grep readonly grep awk grep --verbose ${HOME} done local | /usr/bin printf
+		'quoted text' printf local
+x=1 /usr/bin "$@" grep test && 2>/dev/null
+	'quoted text' export "$1" done && readonly
+	done sed "$1" local "$@" cd "$@" && --verbose x=1 --verbose && && echo 'quoted text'
+		| --verbose "$@" echo grep done printf grep
+test && -eu local grep $(pwd) "$@"
+	echo -eu $(pwd) done test cd then && 'quoted text' 'quoted text'
+	$(pwd) && test 2>/dev/null
+| readonly test printf -eu cd readonly test && --verbose 2>/dev/null
+		printf echo "$@" export
+export export 'quoted text' local export done grep echo "$@"
+done -eu /usr/bin --verbose -eu --verbose && echo && test awk 2>/dev/null
+/usr/bin done echo echo then
+then $(pwd) done local printf export /usr/bin printf printf
+	${HOME} echo then 'quoted text' $(pwd) $(pwd) readonly cd sed
+		&& printf 'quoted text'
+	&& 2>/dev/null awk && printf local
+-eu local ${HOME} -eu local 2>/dev/null ${HOME} done
+-eu && "$@" awk /usr/bin cd $(pwd) local printf 'quoted text'
+	"$@" readonly printf cd cd
+		local local grep printf "$@" test && echo export awk test printf export
+	'quoted text' cd /usr/bin cd "$1" -eu test -eu readonly 'quoted text' ${HOME}
+		$(pwd) $(pwd) sed test test awk printf test $(pwd) grep x=1 test test local
+sed done sed export cd cd "$@" printf /usr/bin 'quoted text' done sed cd &&
+		awk echo done then echo awk
+| "$@" 2>/dev/null 'quoted text' "$1" then done echo awk printf "$1" local $(pwd)
+&& then then x=1 --verbose
+		"$1" 'quoted text' cd | && ${HOME} done
+	local "$1" && test "$1" --verbose "$1" echo
+&& echo 2>/dev/null -eu | 2>/dev/null printf printf printf ${HOME}
+		readonly x=1 export ${HOME} test $(pwd) -eu && 2>/dev/null readonly -eu cd grep
+	'quoted text' && cd 'quoted text'
+&& "$@" local done then local
+		${HOME} export readonly x=1 sed 'quoted text' awk printf sed
+		then 2>/dev/null test 'quoted text' /usr/bin cd sed echo /usr/bin /usr/bin
+	cd echo "$@" export ${HOME} export test --verbose
+"$1" $(pwd) | local local awk readonly test 'quoted text'
+		$(pwd) -eu sed readonly test 2>/dev/null test cd sed 2>/dev/null && && ${HOME}
+		| export then export $(pwd) $(pwd) export readonly
+		sed export x=1 /usr/bin 'quoted text'
+		x=1 --verbose awk $(pwd) x=1 sed | test sed "$1" echo
+		test done "$1" /usr/bin
+	-eu cd printf | export ${HOME} local "$@" 2>/dev/null then && "$@" "$@"
+		sed cd grep -eu local
+		test awk echo "$@" local --verbose 'quoted text' "$@" test cd
+		"$1" /usr/bin /usr/bin grep
+		$(pwd) -eu echo done grep ${HOME}
+	sed "$1" "$1" then && cd sed local 'quoted text' ${HOME}
+echo cd echo "$1" local --verbose grep
+		x=1 "$@" -eu && ${HOME} && | sed -eu sed 'quoted text' "$1" &&
+export -eu ${HOME} export "$@"
+		-eu sed 2>/dev/null readonly local $(pwd) local
+printf 'quoted text' cd echo /usr/bin /usr/bin 2>/dev/null
+		then /usr/bin | then -eu 2>/dev/null printf $(pwd) -eu
+		awk then test then readonly cd done && 2>/dev/null 'quoted text'
+		${HOME} awk cd -eu | done | --verbose local readonly ${HOME} 2>/dev/null
+		-eu then -eu /usr/bin awk grep | test sed 'quoted text' grep ${HOME}
+"$@" done $(pwd) $(pwd) $(pwd) local grep --verbose && sed printf 2>/dev/null
+		test awk && printf --verbose --verbose
+	local export then export --verbose "$@" /usr/bin
+/usr/bin done echo printf done | readonly
+echo "$@" "$1" done $(pwd)
+-eu && --verbose | ${HOME}
+		2>/dev/null then printf ${HOME}
+		--verbose x=1 'quoted text' && sed "$1" 2>/dev/null local readonly
+cd sed x=1 test && "$1" cd "$@" sed "$1"
+| export awk $(pwd) echo printf
+	grep done test local
+		x=1 readonly printf done --verbose cd cd test
+	sed ${HOME} $(pwd) && $(pwd) done "$@" | --verbose
+then 2>/dev/null $(pwd) printf printf printf done
+		readonly --verbose --verbose "$@" "$@" printf ${HOME} | readonly export 'quoted text'
+	"$@" && "$1" sed echo "$1" /usr/bin 'quoted text' /usr/bin
+	'quoted text' /usr/bin "$@" 'quoted text' awk sed 'quoted text' printf then -eu
+	export test done local 'quoted text' "$1" awk
+		grep cd 2>/dev/null cd --verbose "$@" awk then x=1 sed | 'quoted text'
+| "$@" awk export && done
+"$@" cd $(pwd) ${HOME} --verbose then readonly sed test x=1 cd ${HOME}
+grep | awk /usr/bin | 2>/dev/null grep
+awk ${HOME} "$@" "$1" "$@" && && then
+-eu "$1" sed "$1" | local -eu "$1"
+test sed "$1" ${HOME} ${HOME} ${HOME} x=1 'quoted text' printf
+		readonly local echo "$1" printf --verbose | | echo echo /usr/bin sed 2>/dev/null
+--verbose local test printf readonly
+	"$@" "$@" "$1" done sed "$1" /usr/bin --verbose echo cd test --verbose
+sed cd x=1 $(pwd) -eu printf readonly 2>/dev/null
+--verbose awk export
+		printf cd ${HOME} sed export
+	awk /usr/bin && grep grep | -eu "$@" grep cd /usr/bin
+		grep cd readonly echo /usr/bin "$@" readonly awk grep printf
+export && -eu done cd 2>/dev/null
+		test $(pwd) echo printf /usr/bin done echo local echo 2>/dev/null grep /usr/bin
+		--verbose ${HOME} 2>/dev/null awk ${HOME} "$@"
+		"$1" awk cd --verbose local then sed
+	sed test "$1" export "$@"
+		2>/dev/null test --verbose 2>/dev/null "$1" /usr/bin awk awk grep && then grep
+	x=1 then x=1 printf 2>/dev/null
+	2>/dev/null awk --verbose "$@" local | cd "$1" echo "$@" cd export
+	"$@" | grep grep $(pwd) done sed sed -eu 2>/dev/null local
+		"$1" done grep && then
+	printf sed "$1" then ${HOME} readonly $(pwd) $(pwd) "$@"
+		done $(pwd) grep echo printf local grep printf local local printf awk readonly
+	test | awk then done cd cd echo $(pwd) cd "$1" 'quoted text' | -eu grep
+	| readonly "$@" x=1 export ${HOME} printf "$1" cd awk local
+	x=1 "$@" 2>/dev/null grep test "$@" done readonly && printf done export
+		$(pwd) done ${HOME} sed test | sed awk readonly x=1 ${HOME} cd test readonly
+		/usr/bin && cd cd "$1" x=1 readonly x=1 x=1 cd then
+		-eu /usr/bin sed /usr/bin done ${HOME} ${HOME}
+'quoted text' "$1" /usr/bin "$1" done export $(pwd)
+	sed awk | done x=1 "$@" readonly $(pwd) cd | awk local grep $(pwd)
+	printf 2>/dev/null && test /usr/bin ${HOME} | 'quoted text'
+	$(pwd) local $(pwd) 'quoted text'
+	readonly export -eu x=1 awk then | "$1" echo echo ${HOME}
+	'quoted text' readonly sed sed echo | "$1" | $(pwd) -eu awk
+&& readonly /usr/bin --verbose readonly grep
+	grep test /usr/bin -eu grep /usr/bin -eu test sed -eu grep | awk then sed grep
+export && sed grep /usr/bin --verbose then 'quoted text' "$1"
+export "$@" 2>/dev/null printf sed ${HOME} $(pwd) 2>/dev/null "$1" test
+	test test grep echo cd /usr/bin /usr/bin readonly
+	"$1" awk sed done "$1" --verbose then test echo -eu done
+		--verbose "$@" done printf test --verbose echo
+		'quoted text' "$@" test
+	'quoted text' -eu 'quoted text'
+	echo ${HOME} /usr/bin /usr/bin $(pwd) test done test "$1" local export export
+		"$@" sed cd sed $(pwd) test
+	sed done && test grep local ${HOME} then cd && printf readonly --verbose /usr/bin
+		export done test test grep && grep
+	grep grep "$1" done readonly
+		then --verbose then readonly export
+cd x=1 sed then echo 2>/dev/null "$1"
+echo ${HOME} awk "$@" "$@" | ${HOME} local local --verbose | readonly -eu $(pwd)
+x=1 && grep && /usr/bin local local echo grep "$1" x=1
+		then printf --verbose
+		local export awk readonly echo readonly 'quoted text'
+	local $(pwd) /usr/bin "$@"
+then ${HOME} awk 2>/dev/null "$1" then $(pwd) --verbose $(pwd) awk sed $(pwd)
+		grep ${HOME} "$@" local grep "$@" awk
+cd ${HOME} | --verbose && --verbose cd 2>/dev/null grep "$@" 2>/dev/null --verbose
+	then --verbose grep "$1" x=1 cd --verbose ${HOME}
+echo echo grep printf --verbose && sed awk
+&& cd grep && done test | echo /usr/bin readonly local then 2>/dev/null test
+		sed $(pwd) "$1" 'quoted text' ${HOME} awk -eu then
+echo -eu then cd --verbose
+		--verbose printf readonly 2>/dev/null "$1" local grep cd | /usr/bin
+-eu readonly sed printf then -eu local echo echo readonly test readonly
+	cd done done test -eu done local then awk sed "$@" echo
+	/usr/bin grep then -eu grep && readonly $(pwd) cd --verbose
+$(pwd) cd $(pwd) sed /usr/bin "$@" $(pwd) && 'quoted text' grep grep echo
+	local --verbose && ${HOME} "$1" cd printf $(pwd)
+export /usr/bin then local 'quoted text' awk cd grep
+awk awk cd awk | sed | x=1 awk "$@" awk then then echo
+x=1 readonly $(pwd) grep ${HOME}
+	${HOME} "$@" $(pwd) -eu echo -eu ${HOME} 'quoted text'
+"$1" then echo printf export then echo readonly
+readonly && export x=1 then export && export grep ${HOME}
+		printf grep && local /usr/bin
+	readonly printf ${HOME} cd awk printf then ${HOME} readonly | grep 'quoted text'
+	sed export | awk then export export echo $(pwd) /usr/bin
+local awk local sed x=1 "$@"
+		grep export --verbose printf /usr/bin export grep $(pwd) | "$@" echo readonly
+awk export 2>/dev/null echo awk printf test "$1"
+	x=1 2>/dev/null "$@" sed export "$1" -eu $(pwd) local "$@" export /usr/bin local
+echo test --verbose && readonly "$1" export "$@" $(pwd) "$1" done
+		/usr/bin grep "$1" printf printf
+	done "$@" echo awk $(pwd) 2>/dev/null ${HOME} 2>/dev/null "$1" then awk
+export -eu export $(pwd) readonly grep /usr/bin done readonly ${HOME} done
+	readonly readonly done 2>/dev/null echo && /usr/bin awk $(pwd) $(pwd)
+| printf export local cd $(pwd)
+${HOME} && readonly test grep --verbose test cd 'quoted text' export
+		--verbose 2>/dev/null && && -eu cd printf readonly --verbose
+x=1 readonly && awk && "$@" "$1" test grep awk ${HOME} awk 2>/dev/null -eu export
+		"$@" printf local sed 2>/dev/null | | "$@" $(pwd) then --verbose 'quoted text'
+sed awk grep grep "$@" 'quoted text' x=1 then 'quoted text' ${HOME} --verbose
+2>/dev/null readonly -eu --verbose printf "$@" $(pwd) x=1 awk
+"$1" awk cd export --verbose sed local done cd awk x=1 x=1 2>/dev/null x=1
+	grep -eu local test then
+	awk grep -eu -eu printf 2>/dev/null
+${HOME} "$@" test ${HOME}
+x=1 && echo | --verbose printf readonly | local | sed $(pwd)
+	$(pwd) test test sed /usr/bin --verbose /usr/bin "$1" awk "$@" sed && readonly
+readonly /usr/bin | echo readonly done sed done awk -eu
+2>/dev/null cd then /usr/bin printf ${HOME} grep
+	grep 2>/dev/null cd 2>/dev/null echo awk ${HOME} 2>/dev/null then cd done
+	x=1 then && /usr/bin && 2>/dev/null
+grep ${HOME} echo $(pwd) awk "$@" && cd awk $(pwd) echo "$1" $(pwd) ${HOME}
+	export done sed -eu echo awk done 'quoted text'
+		${HOME} /usr/bin /usr/bin
+awk sed "$1" sed grep x=1 printf
+	/usr/bin && awk grep ${HOME} "$@" /usr/bin && && then -eu ${HOME}
+sed export readonly then test 2>/dev/null
+	/usr/bin test awk /usr/bin printf 2>/dev/null export readonly
+"$@" test --verbose /usr/bin 2>/dev/null then 2>/dev/null
+"$1" -eu done && | ${HOME} && /usr/bin "$1" |
+		cd sed /usr/bin grep readonly 'quoted text' 2>/dev/null
+awk x=1 local readonly printf printf then test "$@"
+		"$1" && | then ${HOME} then printf
+$(pwd) /usr/bin x=1 cd "$1" test done sed then test echo then ${HOME} ${HOME}
+		then export awk && then --verbose cd printf /usr/bin -eu readonly
+		-eu 'quoted text' "$@" ${HOME} echo && cd 2>/dev/null printf printf
+	local x=1 export ${HOME} echo | | && grep x=1 then
+		$(pwd) awk echo readonly cd done readonly && /usr/bin /usr/bin echo /usr/bin
+printf local then done export "$@" then echo readonly
+	'quoted text' -eu 2>/dev/null
+		export grep sed printf echo sed local -eu local printf 'quoted text' &&
+then | x=1 test done $(pwd) done cd printf
+	x=1 sed "$@" test local --verbose
+		2>/dev/null "$@" $(pwd) local 'quoted text' --verbose
+		export local then 2>/dev/null cd done x=1 --verbose grep x=1 printf "$1" done
+		printf export $(pwd) awk --verbose test done --verbose
+-eu "$@" | export local grep local --verbose "$@" export
+	export cd 2>/dev/null cd awk --verbose "$@" echo export -eu echo done
+		export /usr/bin done printf ${HOME} test x=1 done && awk --verbose
+		2>/dev/null && 2>/dev/null local cd local echo printf && 'quoted text'
+	local done grep sed sed local awk echo done test 'quoted text'
+--verbose "$@" grep $(pwd)
+${HOME} awk && 2>/dev/null printf test
+		"$1" 'quoted text' x=1 export ${HOME} local then
+/usr/bin sed --verbose sed | "$1" ${HOME} awk echo
+	export printf printf | "$@" cd $(pwd) | -eu
+	&& export $(pwd) awk echo echo 2>/dev/null readonly
+	$(pwd) ${HOME} -eu 'quoted text' awk -eu cd ${HOME}
+		sed ${HOME} local echo ${HOME} | | 'quoted text' $(pwd) readonly printf
+	| -eu "$1" grep x=1 && $(pwd) done cd then -eu | echo sed done then
+		2>/dev/null "$1" x=1 done readonly export local "$@" sed sed
+	cd --verbose awk --verbose | "$1"
+	x=1 then echo then "$1" 'quoted text' | 2>/dev/null
+2>/dev/null "$1" | ${HOME} && printf grep grep
+echo printf -eu "$@" 2>/dev/null -eu cd then --verbose cd echo echo
+		cd grep export test |
+readonly "$1" x=1 x=1 /usr/bin && export readonly && sed export -eu 'quoted text'
+		"$1" local --verbose "$1" grep /usr/bin --verbose
+	| 'quoted text' export printf "$@" ${HOME} test
+"$@" --verbose -eu printf "$@" --verbose local 2>/dev/null
+		echo export grep cd $(pwd)
+		printf "$1" test sed sed awk readonly awk /usr/bin sed ${HOME} /usr/bin
+--verbose grep cd /usr/bin export 2>/dev/null grep printf &&
+local 'quoted text' local done cd then $(pwd)
+	x=1 cd && done && 2>/dev/null echo --verbose awk
+		grep grep cd test 2>/dev/null test /usr/bin awk readonly export
+-eu ${HOME} echo && x=1 /usr/bin export local ${HOME}
+	printf then printf local --verbose echo "$1"
+		"$@" printf 2>/dev/null
+-eu echo --verbose cd then awk readonly sed
+grep awk echo then $(pwd) "$@" then echo then --verbose sed 'quoted text' -eu
+		printf echo sed readonly --verbose sed then 2>/dev/null
+		test then awk then ${HOME} printf readonly "$1" 2>/dev/null
+		readonly echo 2>/dev/null awk && local cd test
+		'quoted text' then done then
+		/usr/bin "$@" "$1" export
+	echo done -eu local --verbose --verbose then printf 'quoted text'
+	'quoted text' $(pwd) -eu printf ${HOME} --verbose "$@" then 2>/dev/null then
+	export "$1" | then echo readonly "$@" $(pwd) 2>/dev/null "$@" local test "$@"
+		then echo awk printf grep "$@" cd cd /usr/bin
+	done done sed 'quoted text' export /usr/bin export readonly
+	echo printf then cd /usr/bin
+		cd test sed x=1 $(pwd) test grep x=1 local readonly printf
+local x=1 then export /usr/bin
+	done echo 'quoted text' && /usr/bin
+	$(pwd) && "$1" local && -eu --verbose && export printf --verbose
+| "$@" /usr/bin echo && then readonly -eu "$@" cd | x=1 /usr/bin "$@"
+		/usr/bin echo sed && cd -eu 2>/dev/null && "$@" cd
+${HOME} "$1" test export echo | "$@"
+		--verbose 'quoted text' cd then --verbose -eu x=1
+| then 2>/dev/null export
+awk readonly echo 'quoted text' done x=1
+-eu awk local ${HOME} sed
+x=1 2>/dev/null --verbose "$@" $(pwd) awk export readonly done /usr/bin printf
+	done awk done $(pwd) /usr/bin grep
+	done "$@" "$@" test export printf
+		--verbose local 'quoted text' ${HOME}
+local && readonly sed
+		grep export -eu "$1" then
+		--verbose "$1" local && printf --verbose "$1" echo | x=1 done
+		| && export | test /usr/bin | local cd "$1" | && 'quoted text'
+	'quoted text' echo /usr/bin
+readonly done --verbose echo 2>/dev/null done cd cd "$@" local cd /usr/bin
+		/usr/bin local --verbose ${HOME} echo grep echo x=1 /usr/bin local "$1"
+		'quoted text' done "$@" echo awk grep "$@"
+echo done printf 'quoted text' readonly cd then
+-eu awk 2>/dev/null local $(pwd) 2>/dev/null
+		awk local test export ${HOME} $(pwd) "$@"
+		local grep "$1" /usr/bin cd | printf | awk
+		'quoted text' ${HOME} 'quoted text' sed /usr/bin export
+		2>/dev/null "$@" -eu 2>/dev/null readonly cd
+	sed ${HOME} "$@" done export test 'quoted text' | x=1 cd "$@"
+		| printf sed local "$@"
+	/usr/bin --verbose cd awk echo export
+	| grep echo ${HOME} then local grep awk grep
+test && /usr/bin local ${HOME} "$@" $(pwd) "$1" printf && grep
+	done 'quoted text' local "$@" cd "$@" 'quoted text' -eu "$@" "$1" && 2>/dev/null
+		done echo awk readonly test x=1 -eu ${HOME} "$1" awk "$1" then grep x=1 && local
+		$(pwd) $(pwd) test printf
+echo readonly "$1" awk 2>/dev/null ${HOME} "$1"
+	cd export && sed x=1 && && | awk | awk
+	test "$@" /usr/bin x=1 done -eu -eu x=1 readonly
+	2>/dev/null $(pwd) local local awk awk test ${HOME} local
+	test /usr/bin /usr/bin --verbose
+		then echo cd done $(pwd) sed ${HOME}
+sed echo 'quoted text' $(pwd)
+		export 2>/dev/null --verbose 2>/dev/null awk printf -eu
+	$(pwd) | && export readonly
+export test printf $(pwd) awk x=1 -eu --verbose
+		| -eu printf /usr/bin | sed printf cd
+		"$@" local export | --verbose -eu done export grep "$@" "$1" /usr/bin /usr/bin
+		'quoted text' local /usr/bin "$@" --verbose ${HOME} printf -eu local $(pwd) --verbose
+		readonly ${HOME} 2>/dev/null echo readonly test x=1
+	awk | readonly sed "$@" export sed /usr/bin /usr/bin "$1"
+		done readonly ${HOME} export
+		"$1" /usr/bin test 2>/dev/null printf -eu done local 2>/dev/null
+		"$1" done /usr/bin && "$@" && && printf 2>/dev/null --verbose sed $(pwd)
+$(pwd) export 2>/dev/null ${HOME}
+	sed -eu && done "$1" local sed $(pwd) awk "$1"
+		local 2>/dev/null cd $(pwd)
+	${HOME} -eu x=1 "$1" awk printf && echo -eu done local readonly $(pwd) echo --verbose
+		2>/dev/null then --verbose printf ${HOME} /usr/bin | | "$1" echo
+	/usr/bin test done --verbose 'quoted text' ${HOME}
+grep "$1" "$1" done printf then echo -eu printf /usr/bin ${HOME}
+		"$1" sed readonly printf -eu printf then test
+&& "$@" echo test done done test && export echo 'quoted text' x=1
+awk | --verbose x=1 "$1" local cd "$@" done readonly "$1" x=1
+	2>/dev/null export | "$1"
+printf | grep printf 'quoted text'
+	2>/dev/null printf x=1 "$@" x=1 ${HOME} test -eu "$1" local
+		awk 2>/dev/null 2>/dev/null && "$1" "$1" 2>/dev/null
+done test readonly sed --verbose awk ${HOME} awk x=1 echo readonly
+	printf /usr/bin /usr/bin x=1 awk local printf cd cd |
+test then $(pwd) 'quoted text'
+	export 2>/dev/null --verbose done grep 'quoted text' test printf 2>/dev/null readonly
+		done $(pwd) 2>/dev/null 'quoted text' --verbose "$1" && printf awk done $(pwd)
+		cd | | 2>/dev/null printf local done grep awk "$1" test --verbose
+	2>/dev/null "$@" grep --verbose
+	--verbose -eu cd grep awk 'quoted text' && then done local ${HOME} printf
+$(pwd) ${HOME} | export $(pwd) 'quoted text' local
+	cd grep ${HOME} -eu awk local cd 'quoted text' 2>/dev/null awk "$@" 'quoted text'
+	"$@" local && awk $(pwd) readonly
+/usr/bin echo /usr/bin done grep sed echo 'quoted text'
+"$1" export "$@" $(pwd) -eu local grep 2>/dev/null
+"$1" 2>/dev/null ${HOME} $(pwd) 2>/dev/null x=1 && echo 'quoted text' && &&
+	"$@" "$1" "$@" --verbose 'quoted text' -eu /usr/bin grep printf 'quoted text'
+x=1 | cd && -eu grep readonly 'quoted text' | "$@" $(pwd) "$1" readonly
+	done local x=1 grep sed "$@" export /usr/bin "$1" done grep cd grep sed test
+	export "$1" x=1 x=1 'quoted text' /usr/bin done cd echo --verbose
+		$(pwd) local 2>/dev/null
+		sed 2>/dev/null test /usr/bin 2>/dev/null grep echo echo test printf ${HOME} readonly
+		grep then cd $(pwd) 2>/dev/null
+	awk then | cd ${HOME} awk 2>/dev/null export 'quoted text'
+		echo grep readonly 'quoted text' --verbose then awk
+		export printf sed printf then
+		cd 'quoted text' | 'quoted text' /usr/bin
+		&& printf "$@" echo cd 'quoted text' done /usr/bin
+'quoted text' awk x=1 then $(pwd) --verbose sed ${HOME} done done /usr/bin x=1
+	readonly export -eu "$1" export test "$1" 'quoted text' cd echo readonly echo
+test x=1 sed ${HOME} 'quoted text'
+	'quoted text' | printf then
+&& printf ${HOME} ${HOME} ${HOME} && ${HOME} "$@" $(pwd) -eu ${HOME} export 'quoted text'
+	export export export $(pwd) x=1 ${HOME} -eu sed
+&& /usr/bin /usr/bin --verbose && x=1 then done /usr/bin "$1" then done
+		grep sed ${HOME} | "$1" ${HOME} test done sed done grep local
+--verbose readonly cd 'quoted text' cd /usr/bin x=1 done cd awk cd 2>/dev/null
+done | "$1" test export
+x=1 -eu grep export awk | /usr/bin readonly
+		2>/dev/null awk --verbose cd echo | $(pwd) $(pwd) printf 2>/dev/null
+	sed then done echo /usr/bin | readonly | -eu x=1 && done --verbose
+2>/dev/null 2>/dev/null readonly && done 2>/dev/null cd ${HOME}
+		$(pwd) 'quoted text' grep | grep "$@" readonly
+	readonly echo "$1" cd -eu ${HOME}
+	&& export cd && test sed printf "$1" "$@" awk echo x=1 ${HOME} "$@"
+x=1 -eu && done -eu echo cd readonly -eu 2>/dev/null printf echo
+		&& 'quoted text' readonly 2>/dev/null readonly
+printf 'quoted text'
+		$(pwd) /usr/bin then readonly ${HOME} grep sed "$1" && then test x=1 "$1"
+		awk -eu export -eu /usr/bin sed | x=1 echo awk grep export x=1 grep 'quoted text'
+	2>/dev/null "$@" grep | $(pwd) printf done
+	--verbose printf -eu echo local 2>/dev/null echo echo x=1 local | --verbose test
+	/usr/bin local printf 'quoted text' ${HOME} sed readonly
+readonly "$@" then x=1 done grep
+		export "$1" cd && "$@" readonly readonly local "$@" -eu test local readonly
+		sed local printf echo x=1 "$1" grep export test grep 'quoted text'
+		"$1" | -eu done /usr/bin then x=1 | awk
+	echo "$1" sed awk -eu printf
+	test printf "$@" test local
+		awk --verbose awk test && printf then /usr/bin local test $(pwd)
+		"$@" echo test echo "$@" awk grep -eu ${HOME} readonly "$@"
+${HOME} $(pwd) x=1 local ${HOME} $(pwd) $(pwd) done done awk $(pwd) /usr/bin test
+	grep echo readonly "$@" done /usr/bin done "$1" readonly /usr/bin
+awk && echo export sed readonly --verbose done cd
+		export awk /usr/bin 2>/dev/null --verbose export awk printf then ${HOME}
+local 'quoted text' 'quoted text' "$1" | 2>/dev/null
+		"$@" -eu $(pwd) cd printf | local /usr/bin grep | $(pwd)
+		/usr/bin /usr/bin done | sed $(pwd) /usr/bin x=1 then export local /usr/bin
+		then "$1" printf "$@" /usr/bin --verbose
+		| x=1 awk done "$1" local grep | /usr/bin sed done cd $(pwd) x=1 2>/dev/null
+x=1 2>/dev/null done grep
+awk 2>/dev/null && ${HOME}
+"$1" test ${HOME} echo "$1" -eu && grep ${HOME} then done done 'quoted text'
+${HOME} local | 2>/dev/null sed x=1 readonly /usr/bin printf
+&& 'quoted text' "$@" ${HOME} | echo "$@" printf
+		'quoted text' && export readonly
+		$(pwd) | cd echo && x=1
+		readonly 2>/dev/null x=1 readonly "$1" "$@" awk "$1" test 'quoted text'
+		readonly "$@" then && export test "$@" then then --verbose awk
+		cd --verbose "$@" printf 2>/dev/null x=1 'quoted text'
+test local local /usr/bin readonly test -eu local
+${HOME} 2>/dev/null grep /usr/bin cd /usr/bin 'quoted text' readonly $(pwd) 2>/dev/null
+	${HOME} x=1 sed && 2>/dev/null printf ${HOME} "$@" ${HOME}
+done then ${HOME} awk printf ${HOME} && x=1 then awk cd printf echo |
+	sed readonly "$1" 2>/dev/null test cd --verbose -eu | ${HOME} grep grep
+	export done echo readonly 2>/dev/null "$1" readonly echo test
+	"$@" && done awk "$@" --verbose /usr/bin awk /usr/bin -eu | cd
+		"$1" /usr/bin export cd then local "$1" echo cd echo --verbose
+		/usr/bin echo --verbose test echo | "$@" printf
+		'quoted text' readonly printf echo
+/usr/bin sed 2>/dev/null then readonly -eu x=1 local x=1 | readonly --verbose
+	--verbose 'quoted text' 2>/dev/null && then awk test --verbose
+		| grep "$1" x=1 readonly sed ${HOME} 2>/dev/null sed then
+		'quoted text' sed "$@" sed $(pwd) /usr/bin
+		/usr/bin "$@" printf $(pwd) readonly
+export readonly awk printf 2>/dev/null && done grep x=1 | $(pwd)
+&& sed printf "$1" cd test ${HOME} $(pwd) export --verbose
+grep /usr/bin 2>/dev/null 2>/dev/null grep 2>/dev/null local
+2>/dev/null readonly --verbose
+done test "$@" then readonly "$1" then 'quoted text'
+local sed 'quoted text' cd printf test
+		printf -eu "$@" awk /usr/bin
+		test done "$@" export grep $(pwd) "$1" then "$1"
+local "$1" && 'quoted text' export grep | echo grep
+	x=1 awk $(pwd) x=1 grep "$1" export export
+		"$1" "$1" | printf readonly | ${HOME}
+		export sed readonly export "$1" cd | sed $(pwd) --verbose 'quoted text'
+	awk --verbose export | -eu
+printf export grep done "$1" -eu 2>/dev/null printf echo grep echo
+then | grep then x=1 awk -eu echo local "$@" && cd done -eu done then -eu "$1"
+	awk local readonly cd | sed readonly | -eu | "$1" --verbose
+	cd && awk done --verbose grep "$1" | /usr/bin
+awk | /usr/bin x=1 ${HOME} |
+		--verbose export 2>/dev/null awk then | grep /usr/bin local
+		local cd && cd x=1 echo awk then
+cd cd grep 2>/dev/null ${HOME} ${HOME} && "$@" readonly -eu
+	'quoted text' $(pwd) "$1" sed export x=1 $(pwd) readonly 2>/dev/null
+	readonly then "$@" | printf -eu done grep -eu --verbose export export 'quoted text'
+	test x=1 test grep test readonly 2>/dev/null ${HOME} printf
+grep then readonly cd awk printf cd x=1
+-eu local printf | 'quoted text' --verbose done then test grep printf awk 2>/dev/null
+		"$1" 'quoted text' export
+	then --verbose /usr/bin grep $(pwd) 2>/dev/null
+		done then readonly --verbose local echo echo $(pwd)
+		done x=1 && x=1 "$1" cd ${HOME} 'quoted text' 'quoted text'
+	"$1" --verbose cd export sed printf x=1 'quoted text' test "$1" done export "$@"
+export && ${HOME} /usr/bin test /usr/bin $(pwd) sed local
+local ${HOME} done test
+	done "$@" "$@" 2>/dev/null grep x=1 then echo "$1" $(pwd) local
+		x=1 && -eu done $(pwd) cd printf done 'quoted text' | --verbose awk grep grep
+	-eu export local cd ${HOME}
+readonly -eu 'quoted text' "$@"
+	readonly "$@" done sed -eu test --verbose && && 2>/dev/null printf "$1" done
+		/usr/bin | ${HOME} local | $(pwd) cd then 2>/dev/null 2>/dev/null
+		local "$@" grep then cd export 2>/dev/null sed echo then readonly then cd echo
+	grep "$1" awk grep test -eu 2>/dev/null readonly "$@" export echo --verbose
+export test -eu test 'quoted text' readonly
+	${HOME} x=1 | awk /usr/bin grep 2>/dev/null
+	test awk sed done ${HOME} /usr/bin && local cd grep test x=1 ${HOME} 2>/dev/null
+		--verbose local grep 'quoted text'
+readonly export | printf export | | test
+-eu local printf done done |
+		/usr/bin readonly && printf -eu && readonly $(pwd) done
+echo "$1" 'quoted text' 2>/dev/null then readonly /usr/bin $(pwd)
+	test -eu printf local test printf $(pwd) awk ${HOME} then awk cd local /usr/bin
+		test awk 2>/dev/null x=1 then -eu /usr/bin 2>/dev/null "$@" test
+		--verbose readonly /usr/bin then then $(pwd) local then sed readonly
+		test grep awk 'quoted text' test x=1 && "$@" -eu | then 2>/dev/null readonly
+	"$@" awk -eu --verbose printf done "$1"
+sed export local echo $(pwd) | ${HOME} test readonly 2>/dev/null /usr/bin
+	2>/dev/null printf test local /usr/bin test printf
+		local && export export
+		"$@" awk ${HOME} 'quoted text' sed -eu
+done printf grep export grep printf local readonly x=1 printf
+	"$@" then "$@" export ${HOME} local cd
+x=1 local "$@" local |
+	grep local ${HOME} readonly -eu done test "$@"
+awk export $(pwd) readonly echo sed
+		awk ${HOME} /usr/bin awk awk echo printf awk --verbose local cd printf awk
+		grep done ${HOME} local
+		${HOME} echo readonly cd ${HOME} && done -eu done readonly --verbose
+		sed cd sed awk "$@" "$@" echo 2>/dev/null x=1 -eu "$@" readonly readonly
+		x=1 readonly 'quoted text' readonly local echo
+done && x=1 --verbose sed echo cd done printf 'quoted text'
+readonly awk ${HOME} $(pwd)
+--verbose /usr/bin --verbose /usr/bin sed local grep -eu then ${HOME}
+	echo readonly "$@" done 'quoted text' awk export printf "$1" sed /usr/bin grep
+	local echo sed test grep test $(pwd) 'quoted text'
+x=1 test grep x=1 then /usr/bin cd -eu awk
+	test local local readonly done echo "$1" grep 2>/dev/null
+-eu /usr/bin /usr/bin done
+		readonly $(pwd) ${HOME} test "$1" printf /usr/bin -eu x=1 grep printf $(pwd)
+printf $(pwd) readonly --verbose ${HOME} readonly test awk 'quoted text'
+--verbose | cd done grep then /usr/bin
+		"$1" "$1" x=1 "$1" | x=1 2>/dev/null local cd printf
+"$1" 'quoted text' done ${HOME}
+		"$1" $(pwd) sed echo awk echo
+		done 2>/dev/null local -eu $(pwd) ${HOME} then /usr/bin
+		test /usr/bin readonly sed
+	/usr/bin printf "$@" "$1" printf
+		sed | $(pwd) export echo ${HOME}
+		readonly awk --verbose
+	2>/dev/null readonly 'quoted text' x=1 sed sed
+	local then x=1 printf ${HOME} printf cd -eu && test
+	'quoted text' readonly local
+${HOME} awk readonly printf 'quoted text'
+-eu export test awk ${HOME} sed --verbose 'quoted text' x=1 /usr/bin
+	"$1" then done sed | printf
+		$(pwd) cd readonly done echo sed --verbose awk sed 'quoted text' 2>/dev/null
+	cd 2>/dev/null echo "$1" done /usr/bin --verbose | 'quoted text' | 2>/dev/null "$1"
+"$1" -eu local echo readonly cd --verbose | printf sed
+	"$1" readonly && /usr/bin -eu 'quoted text' sed
+		local cd | --verbose ${HOME} /usr/bin "$1" "$@" echo echo x=1 test
+	done $(pwd) --verbose "$1" ${HOME} x=1 echo test done
+		then && --verbose test 'quoted text' && x=1 $(pwd) sed x=1
+echo export 'quoted text'
+	export -eu && test sed cd -eu local "$@" 2>/dev/null | x=1 then &&
+	"$@" && /usr/bin "$@" -eu $(pwd) | export && awk cd then ${HOME}
+		awk awk grep done /usr/bin
+		x=1 2>/dev/null 'quoted text'
+done echo "$1" -eu -eu /usr/bin cd --verbose grep done $(pwd) "$1" echo
+		sed done echo "$1" | "$@"
+		local --verbose | local && /usr/bin 'quoted text' test $(pwd) 2>/dev/null then
+readonly 2>/dev/null then -eu $(pwd) /usr/bin printf 2>/dev/null
+$(pwd) ${HOME} $(pwd) ${HOME} "$@" done 2>/dev/null
+/usr/bin /usr/bin && cd printf "$1" 2>/dev/null
+	then awk cd readonly $(pwd) "$1" local ${HOME} local "$@" test "$@" | 2>/dev/null
+	printf "$@" "$1" echo -eu readonly x=1 cd
+	test 2>/dev/null done 'quoted text' readonly -eu
+| "$@" | readonly grep sed printf printf test "$1"
+		readonly --verbose 'quoted text' printf readonly test sed $(pwd)
+	${HOME} -eu local "$@" -eu | awk 2>/dev/null test "$@" && sed $(pwd)
+		grep "$1" | 'quoted text' --verbose "$@" grep then "$1"
+local && local 2>/dev/null "$1" --verbose
+		&& readonly grep -eu awk printf --verbose
+		grep grep then | readonly cd then x=1 readonly
+2>/dev/null ${HOME} 'quoted text'
+		then "$@" 2>/dev/null readonly ${HOME} done 2>/dev/null cd ${HOME} "$1" && "$1"
+$(pwd) test export printf $(pwd) "$@"
+	awk ${HOME} && "$@" then then ${HOME}
+	2>/dev/null ${HOME} /usr/bin echo -eu
+	-eu printf "$@" --verbose printf -eu test | printf export cd | local
+	x=1 test $(pwd) -eu cd | local sed export export sed | "$1"
+	export local echo done then printf then && && printf "$1" 2>/dev/null
+		'quoted text' x=1 | then echo 2>/dev/null cd then && | awk && readonly local
+grep local grep $(pwd) test 'quoted text'
+'quoted text' && x=1 'quoted text' awk "$@" 2>/dev/null
+	sed | ${HOME} "$1" | then echo sed
+		2>/dev/null export ${HOME} readonly
+		printf | 2>/dev/null 2>/dev/null cd awk readonly && then
+		$(pwd) -eu /usr/bin $(pwd) done --verbose -eu awk -eu sed -eu -eu --verbose
+${HOME} --verbose test | cd local grep -eu sed readonly
+		grep | && then export local readonly printf then grep /usr/bin && done x=1 && -eu
+echo /usr/bin then /usr/bin
+local x=1 "$1" readonly
+&& 2>/dev/null --verbose sed /usr/bin && $(pwd) test
+		&& grep awk readonly -eu printf /usr/bin 'quoted text' 2>/dev/null
+--verbose -eu --verbose
+grep -eu readonly readonly "$@" grep 2>/dev/null
+printf 2>/dev/null ${HOME} sed --verbose | "$@" test local --verbose readonly
+'quoted text' sed x=1 /usr/bin ${HOME} x=1 $(pwd) | /usr/bin echo "$1" --verbose
+	"$@" 2>/dev/null --verbose $(pwd) local x=1 done 'quoted text' 'quoted text'
+-eu echo x=1 "$@" 'quoted text' && "$1" readonly 2>/dev/null /usr/bin
+test cd done awk /usr/bin printf 'quoted text'
+	-eu printf ${HOME} grep then /usr/bin sed x=1 then test /usr/bin
+		export awk && cd ${HOME} readonly
+x=1 $(pwd) readonly echo "$@" readonly awk /usr/bin grep grep local && 2>/dev/null
+		test -eu x=1 echo readonly
+		local -eu $(pwd) awk
+		done awk && printf local 2>/dev/null
+done test done /usr/bin then export && /usr/bin 'quoted text'
+		"$@" cd | 2>/dev/null export
+-eu awk ${HOME} awk $(pwd) 'quoted text' 2>/dev/null
+		2>/dev/null /usr/bin "$1" test readonly grep readonly
+	2>/dev/null | && /usr/bin sed | awk --verbose
+$(pwd) /usr/bin "$@" local | then "$@" x=1
+export grep --verbose echo 2>/dev/null "$@" local && test
+		local grep x=1 --verbose export x=1 ${HOME} && 'quoted text' then x=1 echo $(pwd)
+| done readonly -eu awk test 'quoted text' x=1 'quoted text' && cd done export
+		grep readonly cd export printf test grep x=1 test
+	test 'quoted text' grep local | echo "$@" | -eu
+x=1 grep test && export
+	/usr/bin local 2>/dev/null
+		-eu /usr/bin "$@" sed then local $(pwd) export $(pwd) /usr/bin test x=1 -eu done
+	echo "$@" local 2>/dev/null -eu x=1 "$1" then | then x=1
+readonly "$@" 'quoted text' grep test done "$1" | local
+	$(pwd) /usr/bin $(pwd) "$1"
+test -eu test --verbose grep test x=1 awk "$1" test sed /usr/bin cd echo grep
+		/usr/bin | test && 2>/dev/null sed && then export
+		&& readonly cd printf && done 2>/dev/null echo $(pwd)
+	-eu | echo /usr/bin --verbose grep awk printf echo -eu echo x=1
+		&& echo x=1 done /usr/bin "$@" -eu then --verbose "$1" sed &&
+		done echo -eu "$@" "$1" | "$1" "$@" cd |
+	&& echo x=1 readonly 'quoted text' ${HOME} then --verbose
+	done ${HOME} sed done 'quoted text' awk
+		--verbose ${HOME} grep | ${HOME} readonly && grep echo | readonly sed
+		'quoted text' | x=1 awk ${HOME} local done local "$@"
+printf cd --verbose | 2>/dev/null printf grep x=1 printf
+	cd awk 'quoted text' -eu cd grep
+then grep cd done x=1 "$1" grep $(pwd) done "$@"
+then printf | x=1 test readonly && $(pwd) --verbose
+done "$@" --verbose cd then cd grep
+		-eu | $(pwd) 'quoted text' 2>/dev/null
+	2>/dev/null then "$@"
+2>/dev/null -eu test then awk sed -eu 'quoted text' grep | | then 2>/dev/null
+	'quoted text' /usr/bin x=1 --verbose
+	awk /usr/bin grep ${HOME} 2>/dev/null /usr/bin
+cd done awk echo test awk --verbose && sed
+	2>/dev/null ${HOME} -eu x=1 --verbose "$1" 2>/dev/null awk
+		sed readonly && printf x=1 echo grep 2>/dev/null 2>/dev/null done && "$@"
+	readonly "$1" | $(pwd) &&
+	echo --verbose $(pwd) ${HOME} /usr/bin &&
+	test -eu grep then | --verbose done x=1 | -eu grep /usr/bin sed local
+	echo x=1 && done 'quoted text' 2>/dev/null ${HOME} --verbose
+	--verbose x=1 | grep cd -eu then sed ${HOME} sed readonly test 2>/dev/null
+$(pwd) $(pwd) && --verbose $(pwd) local x=1 echo 'quoted text' echo /usr/bin
+| test done cd 'quoted text' grep "$@" x=1 2>/dev/null ${HOME} /usr/bin | "$@"
+		local awk "$@" $(pwd) readonly
+	test --verbose | && "$@"
+	--verbose 'quoted text' then test && 2>/dev/null cd --verbose -eu done
+	-eu $(pwd) | readonly echo -eu echo "$1" 2>/dev/null done grep printf ${HOME}
+	export grep then sed awk grep -eu 'quoted text'
+	2>/dev/null x=1 grep printf --verbose 2>/dev/null ${HOME}
+cd local | "$1" sed then then x=1 awk echo x=1 echo done printf
+	sed ${HOME} done echo $(pwd) x=1 done export echo readonly test test
+"$@" then echo test local export
+	awk -eu --verbose echo awk /usr/bin /usr/bin "$@"
+		done printf export "$@" -eu --verbose -eu sed /usr/bin $(pwd)
+		sed test grep -eu then readonly | then -eu | /usr/bin
+		2>/dev/null cd printf export then "$1" -eu export
+	readonly x=1 ${HOME} | $(pwd)
+readonly sed then export "$1" cd test grep
+		awk grep | "$@" x=1 readonly
+x=1 readonly ${HOME} "$@" readonly 2>/dev/null
+'quoted text' x=1 local 'quoted text' "$1" test
+		done | done readonly 'quoted text' done awk "$1" grep
+	cd 'quoted text' 2>/dev/null x=1 "$1" && awk echo test sed | awk grep cd awk
+		${HOME} cd done echo && /usr/bin
+echo 'quoted text' local && /usr/bin 2>/dev/null
+		"$1" grep sed test && -eu "$@" | export && cd
+		export && x=1 && /usr/bin && cd local
+		done echo printf "$1" "$1" readonly "$@" 2>/dev/null $(pwd) && readonly
+x=1 /usr/bin readonly readonly export ${HOME} echo export cd local
+		export printf readonly test 2>/dev/null | export
+		readonly cd "$1" readonly | -eu 2>/dev/null
+		readonly readonly 2>/dev/null then $(pwd) printf /usr/bin && test
+	| && /usr/bin then echo done | grep ${HOME} echo sed export awk done test
+done "$@" printf 'quoted text' ${HOME} "$1" "$1" /usr/bin 2>/dev/null cd
+--verbose && "$1" awk sed | grep
+		'quoted text' grep 'quoted text' cd
+grep echo $(pwd) | x=1 printf "$@" --verbose grep local echo grep
+		"$1" ${HOME} 2>/dev/null done -eu "$@"
+		export test printf 'quoted text'
+$(pwd) echo echo /usr/bin /usr/bin x=1 echo export then local then "$1" printf
+		-eu grep then "$1" readonly awk $(pwd)
+		grep done "$@" export "$1"
+"$1" export test $(pwd) then
+		/usr/bin --verbose x=1 | printf awk && ${HOME} echo then
+		cd "$1" $(pwd) x=1 test /usr/bin
+	readonly test --verbose awk x=1 && sed /usr/bin grep then --verbose
+done test && test grep grep echo --verbose local /usr/bin awk ${HOME} --verbose
+		export ${HOME} "$1" echo awk sed && cd readonly grep done export x=1 cd grep echo
+		&& /usr/bin then grep
+	&& "$@" -eu cd 'quoted text' | grep cd grep export
+	awk ${HOME} sed echo x=1 printf sed -eu /usr/bin && $(pwd) && cd "$@" sed
+'quoted text' printf | local awk export export "$1" 'quoted text'
+	-eu "$@" /usr/bin then $(pwd) -eu | | test
+		'quoted text' | $(pwd) "$@" -eu local -eu local export -eu
+		readonly /usr/bin cd sed local 'quoted text' && ${HOME} echo
+		test ${HOME} 'quoted text' grep done sed local readonly && echo "$@" "$@"
+		cd done then 2>/dev/null | done local
+awk awk then sed local export
+done export -eu && | sed /usr/bin readonly "$@" && printf
+--verbose -eu -eu "$@" ${HOME} "$1" awk 2>/dev/null
+		export then echo --verbose then local -eu export -eu "$@" 'quoted text'
+	--verbose | grep ${HOME} $(pwd) then --verbose export "$1" "$1" readonly awk
+		done ${HOME} && cd $(pwd) "$1" readonly
+		awk "$1" x=1 --verbose done cd printf /usr/bin 'quoted text' ${HOME}
+sed /usr/bin --verbose -eu test local echo local export && | readonly
+		"$1" x=1 test sed --verbose --verbose
+"$1" /usr/bin && printf readonly printf then
+'quoted text' export awk grep 2>/dev/null ${HOME} echo ${HOME}
+$(pwd) ${HOME} echo done awk -eu
+test --verbose sed printf export
+	"$1" -eu "$1" cd test local "$@"
+"$@" 2>/dev/null local grep
+$(pwd) "$1" echo 2>/dev/null echo $(pwd) "$1" awk then && "$1" "$@"
+		"$@" printf "$@" then $(pwd)
+then ${HOME} x=1 sed sed 2>/dev/null readonly
+	sed | "$@" export readonly 'quoted text' awk printf then test cd && | readonly
+	sed && then grep | then local "$1" 2>/dev/null "$1" --verbose
+		echo echo ${HOME} local --verbose awk echo x=1 "$@" grep
+	$(pwd) echo echo test "$1" "$@" local "$@" $(pwd) export then test -eu
+export ${HOME} readonly "$@" done "$1" awk
+		awk echo -eu test then sed /usr/bin printf grep
+2>/dev/null | --verbose $(pwd) | test export 2>/dev/null
+		printf 'quoted text' "$@" awk test printf echo done $(pwd) export --verbose
+	echo printf x=1 printf readonly --verbose
+then "$@" local 2>/dev/null -eu awk awk x=1 -eu --verbose awk && "$@" then
+		| "$@" -eu x=1 export ${HOME} /usr/bin && sed sed /usr/bin
+2>/dev/null grep echo --verbose printf
+		echo "$1" -eu local "$1" | printf && 2>/dev/null grep test done x=1 | && "$@"
+awk local done sed | done cd sed $(pwd) readonly ${HOME} cd | "$@" local --verbose
+		'quoted text' grep test "$1" 2>/dev/null local readonly $(pwd) awk
+	done cd /usr/bin done export --verbose ${HOME} $(pwd) local
+test test then /usr/bin printf --verbose 2>/dev/null cd --verbose
+		grep done "$@" | cd 2>/dev/null --verbose --verbose | 2>/dev/null
+--verbose then --verbose echo "$1" export
+		then sed ${HOME} x=1 /usr/bin -eu /usr/bin --verbose
+		${HOME} --verbose | --verbose ${HOME}
+grep awk grep 'quoted text' ${HOME} awk
+		&& -eu grep --verbose readonly -eu cd sed 'quoted text'
+	&& x=1 cd then then "$1" test then /usr/bin readonly ${HOME} 'quoted text'
+		awk awk ${HOME} echo -eu $(pwd) "$@" "$1" test test
+	cd test awk printf done "$@" 'quoted text' done then local grep 'quoted text'
+-eu echo then "$1" "$@" ${HOME} && "$@" && echo -eu && "$1" awk "$1" local
+x=1 cd "$1" /usr/bin "$1" /usr/bin /usr/bin grep echo then cd printf
+--verbose --verbose test cd echo $(pwd) "$@" /usr/bin "$1" test --verbose
+-eu --verbose ${HOME} awk
+	${HOME} cd done $(pwd) 'quoted text'
+		${HOME} cd export awk printf && local local done
+"$1" grep --verbose "$1" then 'quoted text' local "$@" "$@" && printf x=1
+	"$@" --verbose -eu $(pwd) -eu "$@" "$1" cd grep -eu done grep
+		local export --verbose -eu x=1 export cd printf 'quoted text' | export
+	export sed readonly readonly $(pwd) "$1" then
+/usr/bin ${HOME} printf echo then awk "$@" x=1 echo local sed export "$@" x=1
+	/usr/bin && sed cd then echo local awk
+echo export ${HOME} cd echo cd echo done awk then x=1 "$@" cd grep
+"$1" "$1" local done test awk "$@" export export 'quoted text' $(pwd)
+--verbose && $(pwd) x=1 "$1" echo $(pwd)
+	$(pwd) 'quoted text' "$1" --verbose
+		$(pwd) ${HOME} local local sed ${HOME} local test local local &&
+cd printf "$@" 'quoted text' test --verbose
+test && $(pwd) export x=1 cd export -eu grep | local
+readonly x=1 "$1" awk test "$1" "$@" "$1" && && local echo
+		x=1 cd "$@" "$@" 2>/dev/null test "$@"
+	test && grep --verbose -eu $(pwd) x=1 "$1" | sed "$@" /usr/bin -eu
+"$1" ${HOME} x=1 -eu local $(pwd) echo && | -eu local --verbose
+		2>/dev/null 'quoted text' x=1 grep | 2>/dev/null printf &&
+printf done --verbose 'quoted text' readonly
+		"$1" x=1 done local echo
+2>/dev/null cd -eu then export grep cd && | echo
+cd 2>/dev/null 'quoted text'
+	grep readonly sed grep readonly
+&& && echo 2>/dev/null local
+		x=1 printf ${HOME} then local "$@" then export cd cd then readonly grep --verbose
+		2>/dev/null sed $(pwd) cd sed
+readonly done done printf "$1" --verbose sed 2>/dev/null
+	test -eu grep local then |
+	local 'quoted text' /usr/bin | echo | readonly
+export echo printf --verbose --verbose sed cd local
+		then echo $(pwd) then $(pwd) $(pwd) | echo && x=1 ${HOME} x=1 local
+		${HOME} /usr/bin "$1" x=1 /usr/bin grep test x=1
+	test grep awk local $(pwd) | export readonly test test
+printf grep printf -eu awk grep
+	"$1" "$@" "$1" "$@" then awk /usr/bin test echo --verbose export
+test then x=1 2>/dev/null echo && printf echo x=1 --verbose
+		&& sed ${HOME} printf ${HOME} "$@" export ${HOME} grep && "$@" -eu then
+	${HOME} x=1 | sed printf 'quoted text'
+	export done then done done ${HOME}
+		'quoted text' /usr/bin --verbose printf x=1 x=1 grep then
+		/usr/bin cd export "$@" "$@" awk cd grep readonly
+done cd "$@" | && && "$1" then "$@" 'quoted text'
+"$@" | readonly export 2>/dev/null -eu
+		| && awk --verbose readonly echo "$@"
+then ${HOME} grep sed $(pwd) --verbose -eu cd $(pwd) -eu ${HOME} "$1" printf then
+		awk && then 2>/dev/null /usr/bin 2>/dev/null printf x=1 /usr/bin |
+grep ${HOME} $(pwd) grep "$@" sed printf && test 2>/dev/null | sed export
+readonly grep grep 'quoted text' readonly grep
+		&& "$@" 'quoted text' cd echo grep readonly
+	${HOME} ${HOME} echo "$@" && done x=1 echo x=1 && printf export -eu 2>/dev/null
+		"$@" readonly && --verbose $(pwd)
+-eu test test sed echo x=1 --verbose -eu cd
+sed local $(pwd) grep "$@" 'quoted text'
+	export local 2>/dev/null ${HOME} "$@"
+	local local echo echo echo /usr/bin /usr/bin done 2>/dev/null ${HOME} && test
+$(pwd) local printf /usr/bin local local done done /usr/bin sed "$1"
+	"$1" grep export then awk ${HOME} local 2>/dev/null
+	awk "$1" test grep 2>/dev/null "$1" -eu readonly echo -eu echo done grep
+		then grep test ${HOME} cd 2>/dev/null done sed printf grep
+/usr/bin test $(pwd) cd /usr/bin done printf sed
+		echo grep ${HOME} /usr/bin 2>/dev/null "$@" /usr/bin | export
+&& readonly x=1 x=1 done | done -eu x=1 echo 'quoted text'
+	$(pwd) test cd awk && -eu sed 2>/dev/null export then x=1 test && awk export
+		readonly -eu printf "$1" "$@" ${HOME} cd /usr/bin
+#include c68.sh
+x=1 printf -eu "$@" awk -eu readonly awk
+	awk 2>/dev/null printf awk local | then | readonly done 2>/dev/null --verbose
+		cd done grep export printf then ${HOME} | "$@" 2>/dev/null
+		--verbose readonly export -eu ${HOME} "$1" test
+&& cd awk "$@" "$@" x=1 grep ${HOME}
+		| echo grep $(pwd) -eu
+	grep done then sed "$1" &&
+done && echo "$1" $(pwd) printf printf export
+		export x=1 | $(pwd) 'quoted text' -eu awk --verbose 'quoted text' 'quoted text'
+sed /usr/bin ${HOME} test
+local "$1" "$@" cd $(pwd) printf --verbose test ${HOME}
+		-eu done awk 2>/dev/null | local ${HOME} 2>/dev/null printf awk sed
+printf /usr/bin "$1" done | awk echo grep "$1" -eu /usr/bin && $(pwd) echo |
+	grep local --verbose test test "$1" sed | --verbose printf "$@"
+| grep export test 'quoted text' "$1" grep awk readonly export test /usr/bin x=1
+	test "$@" awk readonly test
+	'quoted text' local -eu test -eu
+&& done echo then /usr/bin /usr/bin printf awk 'quoted text' --verbose
+	"$1" export done /usr/bin done | printf
+	local cd readonly cd printf
+	-eu -eu done awk "$1" printf -eu export $(pwd) -eu
+		/usr/bin 'quoted text' export test export 2>/dev/null /usr/bin
+"$1" test $(pwd) readonly readonly $(pwd) test 2>/dev/null echo | | | cd echo
+	&& $(pwd) test sed "$@" sed /usr/bin 'quoted text'
+	echo "$1" sed 'quoted text' 2>/dev/null && --verbose
+		2>/dev/null x=1 echo | export echo echo cd readonly /usr/bin
+	done sed "$@" readonly awk x=1 "$1"
+	local -eu && /usr/bin /usr/bin awk | printf echo ${HOME} "$@" grep sed "$@" test
+		local printf | && local | local -eu "$@" local /usr/bin $(pwd) ${HOME}
+local "$@" --verbose x=1 && $(pwd) x=1 ${HOME} 2>/dev/null 2>/dev/null
+		test /usr/bin ${HOME} -eu printf printf
+"$@" /usr/bin sed ${HOME} | awk awk done readonly readonly x=1 echo && |
+		export local awk 'quoted text' -eu $(pwd) x=1
+		test test echo cd $(pwd) cd $(pwd)
+		/usr/bin && -eu echo then --verbose readonly ${HOME} $(pwd) grep "$1" printf
+	readonly "$@" awk ${HOME} 'quoted text' $(pwd)
+awk ${HOME} "$1" sed then test -eu 2>/dev/null
+	export $(pwd) 2>/dev/null test /usr/bin
+	--verbose -eu then printf /usr/bin sed grep cd cd 'quoted text' /usr/bin
+export done "$@" printf readonly local "$@" export ${HOME}
+	test "$@" -eu echo "$@" local
+		--verbose "$1" $(pwd) then grep "$@" printf local 'quoted text'
+		"$1" grep ${HOME} printf --verbose sed cd /usr/bin printf 2>/dev/null
+		--verbose local | export --verbose awk | printf x=1 then cd
+	"$1" x=1 export "$@" "$@" awk $(pwd) readonly && done export
+	readonly test "$1" test then grep &&
+"$@" 'quoted text' --verbose 2>/dev/null /usr/bin x=1 -eu && sed readonly
+		printf "$1" "$1" printf && done && sed && "$1" ${HOME} awk
+export | sed readonly local "$@" -eu printf done && /usr/bin then
+echo && | ${HOME} sed
+--verbose "$@" | --verbose 2>/dev/null done export "$1" grep /usr/bin 2>/dev/null
+x=1 grep | -eu && && "$1" --verbose ${HOME} done local
+		"$@" 2>/dev/null $(pwd) sed | sed "$@" /usr/bin readonly done 2>/dev/null x=1
+	x=1 /usr/bin --verbose local printf 'quoted text' "$@" awk cd x=1
+		done readonly 'quoted text'
+	"$1" $(pwd) | "$1" printf "$1"
+${HOME} "$@" "$@" cd export local test "$@" awk
+"$@" sed /usr/bin /usr/bin | --verbose
+	-eu done printf readonly && 2>/dev/null
+"$1" readonly -eu export
+	done printf export && x=1
+		readonly /usr/bin -eu -eu test export /usr/bin && 2>/dev/null
+	'quoted text' local echo
+local test done -eu 'quoted text' "$@" then sed export
+	readonly 'quoted text' --verbose local awk sed sed sed -eu awk /usr/bin sed
+	printf cd local | export ${HOME}
+		grep -eu | && 2>/dev/null
+"$1" | -eu echo --verbose printf export local done | && sed $(pwd)
+		local echo test 2>/dev/null /usr/bin | --verbose && done --verbose
+| export -eu export awk
+		${HOME} awk "$@" ${HOME} sed
+	"$@" awk x=1 && --verbose /usr/bin
+		'quoted text' local -eu ${HOME} /usr/bin export printf 'quoted text' $(pwd) then
+	printf echo --verbose sed ${HOME} sed "$@" echo awk echo cd
+	x=1 && then --verbose local then /usr/bin
+	"$1" grep ${HOME} 'quoted text' echo export then x=1 test readonly
+	test sed echo awk export
+		done && && export "$1" export done printf echo done
+	done done local awk awk 2>/dev/null then done "$@" sed --verbose | 2>/dev/null
+		&& /usr/bin $(pwd) cd local "$1" ${HOME}
+	--verbose "$1" local "$1" "$@" x=1 readonly done --verbose export $(pwd) readonly
+	local then 2>/dev/null && awk sed "$@" /usr/bin
+		local $(pwd) done done $(pwd) ${HOME} | then local done x=1 cd "$1" $(pwd)
+local && --verbose awk $(pwd) printf 'quoted text'
+		"$1" sed cd awk grep then $(pwd) local done
+"$1" && "$1" 2>/dev/null export --verbose done $(pwd) x=1 then 2>/dev/null
+		readonly then x=1 printf then printf | -eu && 'quoted text' -eu echo
+awk | -eu sed $(pwd) | local ${HOME} $(pwd) ${HOME} readonly /usr/bin echo -eu
+		then ${HOME} $(pwd) $(pwd) 2>/dev/null cd awk grep $(pwd) | 2>/dev/null ${HOME}
+readonly echo --verbose /usr/bin local $(pwd) sed $(pwd)
+		test cd 2>/dev/null sed | local done "$@"
+	grep x=1 && test cd "$@"
+		export "$1" readonly -eu readonly "$1" 'quoted text' printf
+		--verbose done printf "$1" sed sed $(pwd) awk grep sed awk ${HOME} $(pwd)
+		local x=1 sed test ${HOME} then sed "$@" 2>/dev/null
+${HOME} --verbose -eu $(pwd) grep export
+$(pwd) export awk done x=1 printf 2>/dev/null
+/usr/bin ${HOME} "$1" "$1" ${HOME} cd grep awk echo --verbose
+		local awk grep && | 2>/dev/null awk /usr/bin echo --verbose printf ${HOME} x=1
+local done --verbose grep -eu grep --verbose $(pwd)
+	2>/dev/null 'quoted text' "$@" "$@" printf then 2>/dev/null "$1" cd grep
+	x=1 sed done printf --verbose |
+	grep echo "$1" test sed
+	sed "$1" test 'quoted text'
+&& then sed x=1 echo -eu "$1" --verbose
+	"$1" --verbose ${HOME} /usr/bin 2>/dev/null "$@" printf
+	--verbose "$1" grep && test 2>/dev/null test test cd grep
+		--verbose awk grep grep grep 'quoted text' $(pwd) readonly echo
+echo --verbose grep 2>/dev/null export "$1" readonly -eu 2>/dev/null
+'quoted text' 2>/dev/null x=1 2>/dev/null then ${HOME} then $(pwd) test ${HOME}
+	then 2>/dev/null printf printf then $(pwd) "$1" grep cd grep
+export test "$@" printf test echo --verbose
+x=1 -eu "$@" echo echo export
+	"$1" | grep readonly done --verbose export readonly x=1 2>/dev/null sed --verbose
+	awk test printf export "$1" 2>/dev/null ${HOME} 2>/dev/null printf export
+'quoted text' $(pwd) 2>/dev/null
+		test --verbose /usr/bin -eu local
+		'quoted text' cd awk then readonly x=1 readonly grep local test
+"$1" echo grep "$@" "$1"
+awk -eu sed ${HOME} then cd cd x=1 && x=1 printf | x=1 | sed $(pwd) export
+	--verbose sed printf --verbose export
+		x=1 printf 'quoted text' $(pwd) export printf
+"$@" echo printf "$@" -eu ${HOME}
+		&& 'quoted text' echo cd export | done 2>/dev/null $(pwd) cd 2>/dev/null
+	local && $(pwd) "$@" done && grep
+		'quoted text' x=1 awk export
+-eu 2>/dev/null local echo awk done cd ${HOME} "$1" x=1
+		'quoted text' && sed sed printf --verbose --verbose "$@" &&
+cd /usr/bin cd -eu echo grep x=1 then --verbose
+${HOME} done "$@" 2>/dev/null
+	&& 2>/dev/null ${HOME}
+		2>/dev/null 'quoted text' awk
+		awk test test readonly readonly "$@" /usr/bin
+$(pwd) printf && && local && 2>/dev/null
+		then test --verbose -eu echo awk local grep grep
+cd sed && readonly 'quoted text' done readonly export 2>/dev/null printf
+done 'quoted text' export -eu export | printf test -eu /usr/bin
+		| cd readonly cd ${HOME} readonly done /usr/bin
+		&& $(pwd) printf cd export -eu && $(pwd) then "$@" then cd test && sed cd
+		awk "$1" && $(pwd) "$@" $(pwd) "$1" printf done | test
+--verbose awk export $(pwd) local && /usr/bin "$@" x=1 && && 2>/dev/null export
+	'quoted text' awk --verbose cd done echo test --verbose sed
+		readonly awk --verbose printf -eu 2>/dev/null cd printf test test --verbose
+		| ${HOME} $(pwd) then grep -eu
+	echo local --verbose echo printf
+		${HOME} awk echo x=1 && local
+	$(pwd) cd | local --verbose -eu grep cd 'quoted text' local
+$(pwd) export then -eu awk
+	2>/dev/null && then test -eu
+		then --verbose "$1" && echo | x=1 test printf "$1" test "$@" -eu printf sed
+		cd local cd /usr/bin sed test awk then awk | /usr/bin done local 'quoted text'
+-eu x=1 2>/dev/null 2>/dev/null && --verbose x=1 local done echo
+	${HOME} test readonly $(pwd)
+	printf "$@" ${HOME} export --verbose | cd export /usr/bin
+'quoted text' then && done grep
+		local 2>/dev/null 'quoted text' then
+		2>/dev/null -eu -eu x=1 'quoted text'
+	"$@" then awk grep echo readonly x=1 then local ${HOME} /usr/bin then sed
+	done x=1 then readonly 'quoted text' export
+	"$@" printf grep local export x=1 echo --verbose x=1 local 2>/dev/null
+x=1 readonly -eu 2>/dev/null $(pwd) -eu sed x=1
+	sed | test readonly readonly $(pwd)
+	$(pwd) /usr/bin test printf awk export local "$1" grep ${HOME} echo printf
+export ${HOME} /usr/bin printf ${HOME} awk --verbose
+	echo $(pwd) done readonly sed x=1 awk && "$1" | printf 'quoted text' sed done /usr/bin
+	| 'quoted text' export echo /usr/bin local
+then cd local $(pwd) readonly | then cd -eu cd --verbose
+		done 2>/dev/null echo test | sed x=1 ${HOME}
+		"$1" printf x=1 --verbose x=1 sed "$1" echo 2>/dev/null
+readonly "$1" --verbose awk -eu then x=1 done | cd echo readonly
+	then "$@" readonly $(pwd) /usr/bin cd printf grep 'quoted text' "$1" /usr/bin
+		-eu readonly && 'quoted text' then 2>/dev/null 'quoted text' local then --verbose
+	echo cd done ${HOME} cd --verbose test "$@" /usr/bin
+		${HOME} -eu "$@" | --verbose /usr/bin
+/usr/bin done sed cd local
+&& echo echo grep printf export
+		echo local test -eu "$@" done | /usr/bin
+		awk 2>/dev/null -eu sed done
+		2>/dev/null readonly sed done printf
+		local && -eu done readonly local local
+'quoted text' ${HOME} ${HOME} printf printf awk then ${HOME} 2>/dev/null "$@"
+		cd "$@" echo printf export local --verbose sed export x=1 done
+sed x=1 export 'quoted text' then
+		$(pwd) --verbose test "$1" printf "$1" cd grep 2>/dev/null -eu && --verbose x=1
+then x=1 && "$1" $(pwd) echo echo && 2>/dev/null -eu "$@" cd && --verbose
+	-eu then 2>/dev/null echo ${HOME}
+| 2>/dev/null /usr/bin awk test test
+${HOME} export export test then grep echo echo test echo ${HOME} x=1 "$1" grep
+	-eu local grep ${HOME} then echo awk grep /usr/bin 'quoted text' cd "$@"
+	"$@" "$1" | "$1" --verbose 'quoted text' sed
+	printf x=1 ${HOME} export echo && "$1"
+	| export $(pwd) local && awk
+	printf grep -eu "$1" local
+		x=1 export then | done awk readonly 2>/dev/null sed "$1" -eu | /usr/bin sed
+		sed $(pwd) && ${HOME} --verbose done readonly "$1" "$@" $(pwd) /usr/bin cd test
+	${HOME} -eu done | cd readonly echo /usr/bin $(pwd) 2>/dev/null then x=1 -eu 2>/dev/null
+	'quoted text' cd cd printf done 2>/dev/null --verbose x=1
+		-eu sed export x=1 "$@" sed grep cd | x=1 echo "$1" test grep test sed then
+		/usr/bin | local sed -eu 'quoted text' $(pwd) printf x=1 echo grep awk
+	awk --verbose /usr/bin x=1 | done ${HOME} test export cd /usr/bin "$1" 2>/dev/null
+grep test sed then ${HOME} ${HOME} grep awk && done "$1"
+	printf | readonly local local "$1" 'quoted text' "$1" "$1"
+	${HOME} grep readonly "$1" "$1"
+	cd local sed x=1 --verbose done 2>/dev/null -eu grep
+2>/dev/null 'quoted text' 'quoted text' printf readonly --verbose
+	&& 2>/dev/null --verbose cd printf $(pwd) printf "$1" cd
+		2>/dev/null done && grep && -eu export local "$1" done -eu --verbose "$1"
+	then sed && "$@" export 2>/dev/null local $(pwd) --verbose 2>/dev/null
+sed "$1" ${HOME} awk /usr/bin ${HOME} 'quoted text'
+		| 2>/dev/null cd done grep /usr/bin $(pwd) "$@" ${HOME} grep ${HOME}
+		${HOME} "$@" readonly test
+&& 2>/dev/null $(pwd) done "$@" printf ${HOME}
+	awk export -eu $(pwd) printf --verbose "$@" -eu "$@" test ${HOME}
+'quoted text' "$@" grep done local echo printf echo && readonly grep printf
+	sed test printf test ${HOME} printf 2>/dev/null /usr/bin then 'quoted text'
+		x=1 ${HOME} printf cd cd | /usr/bin ${HOME} test ${HOME} readonly
+done echo printf x=1 then awk "$@"
+		'quoted text' readonly awk sed cd /usr/bin
+"$@" cd -eu 2>/dev/null readonly -eu x=1 -eu x=1 sed then --verbose x=1 cd echo
+	2>/dev/null --verbose $(pwd) export
+	"$@" 2>/dev/null ${HOME} ${HOME} --verbose local test "$@" $(pwd) done
+		then /usr/bin test | done $(pwd) "$1" readonly done "$1" local && sed done -eu
+${HOME} sed /usr/bin echo $(pwd) readonly 2>/dev/null $(pwd) sed
+		echo | && "$@" echo cd "$@" 2>/dev/null "$1" cd ${HOME} cd sed
+	then x=1 --verbose x=1 then
+		test --verbose "$@" readonly echo 'quoted text'
+${HOME} test echo local printf ${HOME} awk test
+	test /usr/bin awk printf --verbose
+		2>/dev/null test -eu | export 'quoted text' cd --verbose export
+'quoted text' | local && 2>/dev/null
+		then --verbose 'quoted text' local local 'quoted text' then
+'quoted text' ${HOME} 2>/dev/null
+		echo "$1" cd ${HOME} then cd printf -eu | 2>/dev/null
+		&& 'quoted text' /usr/bin grep
+	export && --verbose awk then done --verbose "$1" test awk --verbose --verbose
+		2>/dev/null /usr/bin 'quoted text' done export /usr/bin grep then x=1 | ${HOME}
+&& cd then ${HOME} --verbose x=1 printf grep cd readonly $(pwd) --verbose
+		test 'quoted text' -eu readonly "$1" | 'quoted text' -eu sed printf 2>/dev/null
+	-eu /usr/bin export 'quoted text'
+	test echo test local /usr/bin && "$@"
+grep 2>/dev/null cd export | "$1" &&
+awk ${HOME} grep awk --verbose $(pwd) | -eu cd -eu sed && grep
+		"$@" ${HOME} ${HOME} export "$1" local 2>/dev/null cd cd done local |
+	readonly 2>/dev/null --verbose x=1 then $(pwd) local local "$@" done --verbose
+	test "$@" "$@" test x=1 'quoted text'
+	echo awk echo grep then awk x=1 test ${HOME}
+$(pwd) && /usr/bin "$1" $(pwd) /usr/bin
+	${HOME} done export cd export x=1 "$@" export x=1 ${HOME}
+readonly grep /usr/bin then cd echo export --verbose
+		grep 2>/dev/null local &&
+	-eu readonly done ${HOME}
+then readonly done export -eu --verbose -eu && ${HOME} 'quoted text' --verbose
+	--verbose -eu ${HOME} && /usr/bin
+$(pwd) "$1" echo export && test cd readonly local x=1
+		| | ${HOME} grep ${HOME} sed ${HOME}
+	'quoted text' $(pwd) printf grep
+		2>/dev/null ${HOME} done -eu export awk 2>/dev/null "$@" readonly printf readonly
+&& x=1 cd cd test readonly /usr/bin 2>/dev/null
+printf -eu done 'quoted text' $(pwd) "$1" --verbose printf
+		test done ${HOME} local
+"$1" sed ${HOME} then printf grep --verbose readonly echo
+echo grep done grep awk ${HOME} --verbose "$@" awk
+done x=1 printf --verbose
+		then then | grep done x=1 2>/dev/null $(pwd) $(pwd) echo done
+	"$1" printf printf "$1" ${HOME} test "$@" /usr/bin "$1" local
+		printf | cd /usr/bin awk test test && 2>/dev/null "$1" echo x=1 done /usr/bin
+	/usr/bin | local ${HOME} test -eu done "$@"
+x=1 test 2>/dev/null -eu && awk --verbose done then echo
+	echo "$@" test echo x=1 test -eu ${HOME} -eu local export
+	cd -eu 'quoted text' 2>/dev/null
+		export readonly test /usr/bin
+awk | then x=1 --verbose
+	cd 2>/dev/null 2>/dev/null 'quoted text'
+	--verbose sed cd cd sed | local $(pwd) echo cd x=1 sed printf
+${HOME} cd "$@" x=1 test echo cd 'quoted text'
+		awk cd test | $(pwd) -eu --verbose export -eu sed "$1" ${HOME}
+		grep then x=1 then export && "$@" grep 2>/dev/null /usr/bin 2>/dev/null | readonly
+		printf export test grep printf -eu grep
+		"$@" test printf | x=1 cd | sed /usr/bin printf printf local
+		x=1 | $(pwd) 2>/dev/null --verbose printf 'quoted text' done cd "$@"
+printf $(pwd) --verbose && readonly ${HOME} $(pwd) ${HOME}
+		x=1 grep cd 'quoted text'
+done local then 2>/dev/null test test done
+	export sed cd test | && --verbose test x=1 printf --verbose
+		awk then readonly readonly ${HOME}
+	| "$1" sed grep x=1 x=1 awk --verbose readonly /usr/bin
+		local grep && 2>/dev/null | $(pwd) test printf --verbose
+		echo --verbose 2>/dev/null ${HOME} x=1 grep sed -eu test then cd x=1
+		"$@" "$@" awk ${HOME} grep && "$1" export grep readonly "$@" cd awk -eu
+2>/dev/null printf -eu local awk /usr/bin cd
+--verbose readonly $(pwd) "$1" grep readonly 'quoted text'
+		echo /usr/bin "$@" "$1"
+		printf awk 2>/dev/null --verbose "$1" printf local 'quoted text' cd then "$1"
+	export done done printf && done && export local local test x=1 test
+/usr/bin sed 'quoted text' x=1 readonly | ${HOME} export grep
+		export local export echo echo sed --verbose
+grep && printf "$1" readonly done /usr/bin printf echo then local done done
+		readonly test readonly && "$1" awk x=1 readonly
+		grep then ${HOME} done awk test local done
+		2>/dev/null test sed grep 'quoted text' cd x=1 "$@" awk readonly
+/usr/bin "$@" $(pwd) cd "$1" ${HOME} test /usr/bin | && then cd export local
+done | 2>/dev/null export sed test "$1" && 'quoted text' "$1" "$@"
+x=1 -eu cd /usr/bin "$1" $(pwd) printf $(pwd) echo && local /usr/bin
+cd x=1 2>/dev/null ${HOME} $(pwd) 'quoted text' then 'quoted text'
+local x=1 ${HOME} printf "$@" "$@" 'quoted text'
+	$(pwd) done then && echo x=1 && -eu awk done
+test --verbose 'quoted text'
+		/usr/bin ${HOME} -eu sed -eu "$1" && | cd -eu
+		grep ${HOME} readonly /usr/bin
+awk then awk ${HOME} 'quoted text' 2>/dev/null local -eu then printf $(pwd)
+		readonly "$@" then printf | && | $(pwd) ${HOME} ${HOME} "$@" export
+-eu printf local awk "$1" sed | test --verbose --verbose
+	cd 2>/dev/null printf 'quoted text' sed $(pwd) $(pwd) readonly readonly grep test
+		printf sed 'quoted text' $(pwd) echo export x=1 awk "$1" readonly "$1"
+		awk | 'quoted text' 2>/dev/null "$@" /usr/bin 2>/dev/null |
+		| /usr/bin grep 2>/dev/null
+then | --verbose x=1 export printf sed 'quoted text' echo awk export
+		x=1 test "$1" -eu x=1 grep sed then ${HOME} printf 2>/dev/null printf local
+	test readonly "$1" grep | $(pwd) readonly x=1 -eu $(pwd) x=1 test echo -eu
+then then x=1 printf | | printf export
+		cd $(pwd) printf "$@" && && test test readonly
+	"$@" 'quoted text' cd readonly done then /usr/bin
+| test done /usr/bin --verbose -eu awk
+done "$@" local /usr/bin sed grep grep test 2>/dev/null
+	cd sed | awk && --verbose echo /usr/bin
+2>/dev/null grep sed "$1" && printf "$@" | 2>/dev/null echo export printf
+	awk sed "$@" awk test "$@" sed ${HOME} done
+		-eu | awk grep local -eu -eu local
+	echo cd 'quoted text' x=1 export export export
+echo /usr/bin /usr/bin "$1" echo cd export "$1" awk test 'quoted text' |
+	done x=1 done awk done done ${HOME}
+sed 'quoted text' cd export "$@"
+	done $(pwd) 'quoted text' then awk /usr/bin
+		| "$@" sed sed 'quoted text' sed && printf awk && x=1 done -eu sed
+/usr/bin cd --verbose awk --verbose /usr/bin && | then --verbose | cd test $(pwd)
+done ${HOME} | printf "$1" local echo readonly -eu
+export awk "$1" && cd /usr/bin test grep "$@" "$1" && readonly
+		echo && local | | echo local cd 2>/dev/null done 'quoted text'
+	test ${HOME} printf local ${HOME}
+		x=1 done /usr/bin local 2>/dev/null done 2>/dev/null cd readonly echo
+	sed "$@" /usr/bin then then "$1" "$1" x=1 local 'quoted text'
+		export 'quoted text' && $(pwd) ${HOME} grep x=1 'quoted text' done $(pwd)
+then test 'quoted text' 'quoted text' echo ${HOME} $(pwd) cd printf echo
+${HOME} x=1 --verbose printf local local
+awk grep echo "$@" echo
+	&& ${HOME} 'quoted text' ${HOME} $(pwd) readonly export awk readonly -eu 2>/dev/null
+	/usr/bin "$@" grep then 'quoted text' "$1" x=1 echo local "$@"
+	export "$@" then -eu 2>/dev/null && echo
+	grep 'quoted text' -eu awk -eu done
+		| | echo 2>/dev/null echo local "$@" | local export
+	'quoted text' | && "$@"
+	"$@" printf cd echo then
+echo /usr/bin && ${HOME} grep && awk cd readonly --verbose
+/usr/bin awk "$1" awk /usr/bin
+	then "$1" awk "$1" /usr/bin /usr/bin
+		'quoted text' grep sed
+	done /usr/bin grep | $(pwd) && 2>/dev/null /usr/bin
+cd && echo x=1 --verbose -eu 'quoted text' test "$@" echo && done
+/usr/bin then awk sed echo && test && test readonly sed
+then 'quoted text' readonly
+		done "$1" awk then "$@" && --verbose
+| /usr/bin "$1" && $(pwd) x=1 "$1" cd /usr/bin export x=1 "$@"
+x=1 grep test x=1 && echo "$@" local test --verbose ${HOME}
+| -eu export printf echo sed grep printf readonly then "$1" done awk
+	-eu printf export printf && grep
+		awk x=1 sed local && /usr/bin --verbose && ${HOME} echo sed done
+"$1" && test printf x=1 sed cd "$@" -eu test local then
+	readonly -eu && ${HOME} then printf printf export "$@" "$@" grep
+		local "$1" && echo 'quoted text'
+| $(pwd) $(pwd) local printf --verbose awk --verbose
+--verbose ${HOME} readonly export sed | export readonly x=1 && $(pwd)
+2>/dev/null echo /usr/bin | cd /usr/bin && readonly ${HOME}
+		test awk export export done 2>/dev/null "$@" cd test sed done --verbose
+		-eu 2>/dev/null export cd local $(pwd) && 2>/dev/null
+	2>/dev/null printf test then readonly
+x=1 awk | x=1 "$@" "$1" 'quoted text' echo grep
+		grep then --verbose export test && -eu test
+	2>/dev/null awk ${HOME} | readonly readonly grep | readonly printf
+$(pwd) --verbose /usr/bin x=1 printf "$1" awk echo cd "$@" cd $(pwd)
+		then awk readonly printf local "$1" "$1" export "$@" && 'quoted text' grep
+		&& /usr/bin done awk --verbose $(pwd) grep local export
+then -eu printf $(pwd) printf "$@" readonly sed --verbose
+echo 'quoted text' cd readonly "$1" echo $(pwd) readonly printf -eu | readonly
+	"$1" 2>/dev/null readonly done export sed readonly 'quoted text'
+	sed printf local cd printf 'quoted text' -eu "$1" test | -eu export
+		sed sed awk printf done /usr/bin test done sed 'quoted text' --verbose
+${HOME} local | | cd echo | && "$1" readonly -eu "$1" 2>/dev/null sed
+done && $(pwd) printf sed test x=1 then then "$@" printf && awk ${HOME}
+	'quoted text' ${HOME} && then readonly awk --verbose
+done x=1 /usr/bin local local grep -eu $(pwd) then "$1" 2>/dev/null | echo
+		'quoted text' printf $(pwd) sed export grep $(pwd) -eu export "$@" test
+		echo cd x=1 "$@" 'quoted text' ${HOME} | $(pwd) x=1 local readonly
+		/usr/bin test && | "$1" sed grep 'quoted text' done --verbose
+		$(pwd) --verbose -eu "$@" /usr/bin $(pwd) echo --verbose sed
+'quoted text' export local "$1" cd |
+sed "$@" 2>/dev/null done printf -eu 2>/dev/null readonly readonly
+		grep -eu echo printf then printf $(pwd) export done /usr/bin
+		readonly cd /usr/bin -eu test sed
+	test -eu sed "$@" done && && 2>/dev/null
+		/usr/bin "$1" echo echo local --verbose
+		sed sed sed sed "$@" x=1 cd ${HOME} cd grep | test
+		"$@" "$1" awk --verbose printf
+		2>/dev/null done x=1 -eu done
+		/usr/bin cd done && 'quoted text' | test "$@" 'quoted text' cd
+--verbose "$1" awk ${HOME} then 2>/dev/null echo "$@" -eu 'quoted text' &&
+x=1 "$1" cd printf && readonly cd sed test echo done | "$1" 'quoted text'
+	/usr/bin cd then sed grep then
+readonly 2>/dev/null 2>/dev/null then
+	2>/dev/null done then grep done x=1 --verbose /usr/bin printf grep export
+'quoted text' -eu export "$@" then "$@"
+'quoted text' echo local echo $(pwd) x=1 --verbose
+	test readonly grep $(pwd) awk done readonly && -eu export /usr/bin export then local
+		printf 2>/dev/null && export | "$@" x=1 grep ${HOME} echo x=1 2>/dev/null
+	printf then && then export && "$@" --verbose sed "$@" grep export $(pwd) --verbose
+export -eu "$@" --verbose |
+		-eu cd grep sed local done /usr/bin --verbose 'quoted text' echo then
+| done ${HOME} then 'quoted text' export export awk echo echo then /usr/bin awk
+	then then grep "$1" | | "$@" /usr/bin | test grep done local $(pwd) $(pwd)
+	awk && 'quoted text' done 2>/dev/null
+	$(pwd) awk | x=1 local echo echo local readonly --verbose local && cd
+	export 2>/dev/null | awk local printf "$@" "$@" done 2>/dev/null
+printf /usr/bin /usr/bin x=1 /usr/bin $(pwd) -eu grep then $(pwd) "$@" test
+		-eu "$1" "$1" /usr/bin 2>/dev/null --verbose
+	sed sed -eu "$1" ${HOME} then "$@" test 2>/dev/null
+	"$1" readonly "$@" -eu test ${HOME}
+/usr/bin "$1" /usr/bin printf "$@" test -eu 2>/dev/null
+		| then sed && "$1" -eu sed "$@"
+	local sed $(pwd) echo echo "$@" echo $(pwd) 2>/dev/null done printf
+		2>/dev/null $(pwd) sed awk then && awk cd -eu "$@" -eu -eu readonly
+	grep then -eu echo export 'quoted text' awk "$1" | then cd echo "$1" grep
+	-eu && printf local && sed
+"$1" -eu sed "$1" "$1" $(pwd) && sed then && awk -eu /usr/bin
+sed --verbose sed "$@" sed "$@" echo local ${HOME} local $(pwd) awk sed
+	$(pwd) printf --verbose
+		done 'quoted text' && echo cd $(pwd) then readonly grep x=1
+		${HOME} local ${HOME} | "$1" printf cd
+done sed cd $(pwd) grep echo "$1" grep --verbose
+	sed local && 2>/dev/null $(pwd) printf && "$@" sed x=1
+awk echo "$1" test sed 'quoted text' --verbose
+		grep 'quoted text' local printf local
+	-eu --verbose && readonly && x=1 2>/dev/null
+| 'quoted text' "$@" 2>/dev/null
+	&& "$1" sed export sed cd 'quoted text' -eu "$@"
+x=1 printf local $(pwd) x=1 -eu -eu 2>/dev/null
+		sed "$1" readonly awk readonly x=1
+x=1 && echo sed sed $(pwd) -eu echo then readonly cd 'quoted text'
+x=1 sed awk awk ${HOME} cd
+	2>/dev/null local ${HOME} printf
+		then printf then 'quoted text' sed | grep then "$@" awk printf test
+"$1" /usr/bin awk export awk 'quoted text'
+	-eu $(pwd) sed local then
+		&& "$1" /usr/bin /usr/bin 'quoted text' --verbose
+export /usr/bin sed grep printf then "$@" 2>/dev/null
+	-eu done printf "$1" 2>/dev/null cd printf -eu test x=1 ${HOME} /usr/bin
+	printf test /usr/bin echo test 2>/dev/null
+x=1 | $(pwd) 'quoted text' export grep export readonly /usr/bin
+	&& echo --verbose export -eu
+-eu $(pwd) then $(pwd) /usr/bin 2>/dev/null test local "$@" "$1"
+	x=1 x=1 | grep 'quoted text'
+	local printf -eu sed ${HOME} cd awk /usr/bin
+	awk export 2>/dev/null grep ${HOME} x=1
+x=1 export --verbose done 2>/dev/null 'quoted text' $(pwd)
+	export sed 2>/dev/null -eu /usr/bin $(pwd) export cd done done
+| printf export awk ${HOME} /usr/bin sed --verbose test x=1 cd readonly
+echo echo -eu /usr/bin export $(pwd) "$@" "$@" ${HOME} && awk x=1 then -eu
+	printf echo $(pwd) && $(pwd)
+		-eu --verbose then && /usr/bin export cd x=1 done -eu $(pwd) test test 2>/dev/null
+		grep readonly cd --verbose then echo -eu
+		x=1 done && && "$@" readonly echo then "$1" export then /usr/bin "$1" "$@" sed
+	"$1" local export test sed sed export ${HOME} cd echo grep printf
+		"$1" | -eu x=1 'quoted text' grep
+		printf | "$@" done "$1" echo ${HOME} cd echo
+done readonly && "$1" 2>/dev/null echo local echo x=1 -eu
+test grep test | 'quoted text' then
+'quoted text' x=1 sed 'quoted text' 'quoted text' awk | --verbose -eu echo
+		echo 'quoted text' 2>/dev/null
+		awk printf x=1 test test done local sed grep x=1 readonly
+x=1 printf done "$@" "$1" && --verbose
+		/usr/bin cd -eu /usr/bin awk echo "$1" $(pwd) 2>/dev/null awk
+${HOME} | ${HOME} ${HOME} 2>/dev/null
+		local sed printf | -eu -eu --verbose --verbose
+		grep | --verbose 'quoted text' test x=1 -eu then ${HOME} export awk echo
+		&& grep && | "$@" | test awk "$1" test $(pwd)
+echo echo done 2>/dev/null cd
+	2>/dev/null cd $(pwd) done cd --verbose readonly | test echo
+		&& $(pwd) local readonly local printf | then
+		| then awk -eu grep ${HOME} readonly grep && $(pwd)
+		local echo printf printf test | | 2>/dev/null
+done echo echo test sed export sed printf -eu --verbose awk then printf
+	export "$1" "$1" readonly /usr/bin printf -eu
+&& sed /usr/bin | awk "$1" /usr/bin
+	readonly echo "$1" export 'quoted text' /usr/bin
+	export -eu $(pwd) -eu && then done readonly "$@" 2>/dev/null x=1 ${HOME} $(pwd)
+	'quoted text' -eu cd awk then echo export awk x=1 --verbose /usr/bin | 2>/dev/null
+	sed 'quoted text' | local
+	readonly 'quoted text' -eu | awk | printf awk | /usr/bin
+	${HOME} | readonly awk /usr/bin
+		grep sed | printf cd ${HOME}
+2>/dev/null && readonly sed /usr/bin export then test | 2>/dev/null grep done
+	done then ${HOME} done && local && printf
+	&& 2>/dev/null cd readonly 'quoted text' | 'quoted text' cd x=1 cd --verbose
+		$(pwd) local "$1" && "$1" "$@" awk "$1"
+	echo --verbose cd 2>/dev/null then
+$(pwd) && "$1" $(pwd) echo echo ${HOME} /usr/bin ${HOME} | test awk | 'quoted text'
+		grep 2>/dev/null export
+	local export --verbose
+export export sed awk --verbose cd 2>/dev/null
+		| $(pwd) "$@" echo awk $(pwd) awk grep printf test "$1" export && $(pwd) && &&
+		&& x=1 -eu | cd | -eu echo "$@" /usr/bin export
+		awk "$@" && "$@" x=1 ${HOME} /usr/bin sed && readonly
+cd done readonly grep local done 'quoted text'
+		echo ${HOME} x=1 readonly x=1 export done ${HOME} test done
+		cd && --verbose sed "$1" "$@" "$1" $(pwd) readonly
+	"$@" test echo printf --verbose | local --verbose local printf 2>/dev/null sed
+| echo x=1 2>/dev/null echo echo awk |
+readonly x=1 awk "$1" "$1" "$1" | $(pwd) local --verbose --verbose --verbose
+| then --verbose grep test "$1" local grep /usr/bin
+		sed --verbose x=1 then printf grep then --verbose &&
+	sed /usr/bin "$1" test local "$1" done test x=1 |
+		local printf printf "$@" grep
+		'quoted text' && 2>/dev/null awk sed "$@"
+	-eu --verbose $(pwd) /usr/bin then $(pwd)
+printf "$@" /usr/bin test done 'quoted text' x=1 awk sed --verbose
+sed export readonly printf --verbose test $(pwd) local | &&
+	--verbose test x=1 cd export awk x=1 --verbose && cd /usr/bin | done
+local 2>/dev/null | ${HOME} $(pwd) export cd -eu local /usr/bin printf "$@" x=1
+		done "$@" "$@" awk | /usr/bin --verbose $(pwd) awk grep sed test
+	'quoted text' 'quoted text' 2>/dev/null done sed | grep
+grep local "$@" cd done ${HOME} $(pwd) local
+export readonly | --verbose
+		done x=1 'quoted text' grep 'quoted text' "$@" /usr/bin echo export printf
+	done -eu 2>/dev/null cd test echo sed --verbose cd awk grep
+		printf | /usr/bin sed then grep /usr/bin
+	then "$@" echo --verbose -eu /usr/bin "$@" "$@"
+		&& printf "$1" "$@" then
+&& sed local 'quoted text' 'quoted text' 'quoted text'
+	sed export x=1 printf printf test "$1" local -eu export && readonly /usr/bin
+printf | --verbose sed sed then awk grep
+		then then awk cd | ${HOME} done readonly test 'quoted text'
+done then "$@" grep printf grep && local then | && done printf "$@" echo done grep
+		then cd "$@" awk 'quoted text' --verbose local /usr/bin --verbose $(pwd) cd
+x=1 echo x=1 sed then
+	/usr/bin then done | --verbose ${HOME} readonly
+		${HOME} test grep sed ${HOME}
+readonly 'quoted text' --verbose | printf 2>/dev/null export sed readonly
+cd $(pwd) x=1 sed cd test printf sed "$1" local --verbose readonly
+		/usr/bin "$1" grep "$@" echo awk grep "$@" "$1" grep cd
+"$1" 2>/dev/null done cd "$1" then x=1 --verbose $(pwd) then export $(pwd)
+	sed export printf test done
+	/usr/bin local 'quoted text' ${HOME}
+		${HOME} then grep ${HOME} | test cd cd test
+done 'quoted text' export
+	x=1 local export --verbose -eu && printf test awk
+		2>/dev/null --verbose /usr/bin $(pwd) "$1" /usr/bin readonly
+		"$@" done done /usr/bin -eu --verbose /usr/bin
+		awk "$@" local echo x=1 awk sed /usr/bin 2>/dev/null
+	echo "$@" echo -eu 2>/dev/null export
+test cd sed 'quoted text' /usr/bin && cd done awk "$@" x=1 'quoted text'
+$(pwd) sed x=1 ${HOME} printf then ${HOME} -eu 2>/dev/null done echo
+		--verbose 2>/dev/null echo ${HOME} 'quoted text'
+then test | $(pwd) ${HOME}
+		-eu then echo readonly
+readonly $(pwd) "$@" readonly
+local test $(pwd) 'quoted text' done printf 2>/dev/null echo 'quoted text' printf
+then then readonly export ${HOME} "$1" done x=1 2>/dev/null
+	--verbose then cd export readonly awk
+		export printf && "$@" done 2>/dev/null "$1" -eu && 'quoted text' grep local
+${HOME} ${HOME} x=1 export 'quoted text'
+test local $(pwd) && done done test local "$@" cd --verbose then
+"$@" -eu "$1" /usr/bin done then -eu &&
+&& sed echo --verbose then -eu local "$1" 'quoted text'
+	-eu 'quoted text' /usr/bin grep
+/usr/bin 'quoted text' -eu grep 'quoted text'
+	&& /usr/bin && ${HOME}
+		'quoted text' sed readonly printf then cd && | grep awk export --verbose
+		'quoted text' --verbose then
+	export awk /usr/bin 'quoted text' /usr/bin
+		echo cd printf 'quoted text' echo --verbose "$1"
+	echo cd ${HOME} x=1 then grep awk cd "$1" grep local test | "$1" | -eu
+	readonly local --verbose "$1"
+export && awk sed 2>/dev/null done readonly "$1" && x=1
+		| cd && echo local && --verbose
+	-eu awk export printf ${HOME} done
+'quoted text' 'quoted text' 'quoted text' /usr/bin
+	| "$@" 2>/dev/null | echo printf 2>/dev/null -eu $(pwd) /usr/bin
+printf ${HOME} sed -eu 'quoted text'
+		'quoted text' then export printf
+awk ${HOME} 'quoted text' printf | 2>/dev/null ${HOME} local && --verbose &&
+	$(pwd) printf x=1 then | readonly
+| readonly && 'quoted text' ${HOME}
+		/usr/bin done readonly $(pwd)
+	export echo /usr/bin cd cd echo awk 'quoted text' then --verbose echo done
+		export && 'quoted text' export ${HOME}
+readonly ${HOME} awk "$@" -eu "$@" test 2>/dev/null sed export export $(pwd) export
+	then then awk "$1" ${HOME} -eu readonly awk echo test --verbose
+		sed 2>/dev/null 'quoted text' /usr/bin done
+$(pwd) && 'quoted text' echo --verbose
+${HOME} printf export awk export local $(pwd) --verbose "$@" $(pwd) readonly
+	2>/dev/null /usr/bin echo local /usr/bin export -eu
+		/usr/bin && 2>/dev/null awk $(pwd) grep done /usr/bin --verbose 'quoted text'
+sed then done && cd done $(pwd) /usr/bin test && done
+		grep sed test -eu 'quoted text' "$@" $(pwd) "$@"
+	-eu 2>/dev/null sed $(pwd) "$@" then done --verbose local sed readonly export
+		awk test --verbose 2>/dev/null
+export /usr/bin --verbose readonly printf /usr/bin
+	local test printf && done --verbose done
+"$1" export test 2>/dev/null x=1
+		$(pwd) "$1" "$1" export && && local $(pwd) "$1" /usr/bin $(pwd) -eu
+	'quoted text' export /usr/bin --verbose printf readonly echo x=1
+echo cd /usr/bin cd && done
+${HOME} "$@" sed local && then printf awk x=1 cd test done printf -eu local
+'quoted text' x=1 local ${HOME} $(pwd)
+	awk 'quoted text' test readonly "$1" cd 2>/dev/null printf --verbose ${HOME} $(pwd)
+2>/dev/null cd -eu $(pwd) cd test /usr/bin 2>/dev/null
+&& "$1" sed awk echo --verbose printf awk grep grep x=1 ${HOME} cd $(pwd) --verbose
+sed 2>/dev/null /usr/bin x=1 2>/dev/null
+		echo ${HOME} ${HOME}
+"$1" 2>/dev/null cd 'quoted text' | ${HOME} printf cd /usr/bin sed 2>/dev/null
+		echo test --verbose ${HOME} /usr/bin ${HOME} cd "$1" test awk | ${HOME} done
+export $(pwd) --verbose /usr/bin x=1 "$@" echo readonly
+then grep sed /usr/bin readonly
+		then grep grep local ${HOME}
+2>/dev/null "$1" ${HOME} sed echo
+		done sed export grep /usr/bin
+	| "$1" awk 2>/dev/null x=1 test echo "$@" x=1 grep echo 2>/dev/null awk $(pwd)
+	export local /usr/bin awk x=1 grep -eu grep echo
+	done local then --verbose
+	-eu test "$1" 'quoted text' "$@" sed | $(pwd) export /usr/bin then sed
+	done export -eu readonly local "$1" --verbose grep --verbose
+	export echo 2>/dev/null test
+		then 'quoted text' printf grep x=1 grep
+then "$@" "$@" grep echo ${HOME} "$@" cd grep 'quoted text'
+	readonly awk | $(pwd) -eu sed "$1" "$1" x=1
+	printf sed sed sed test ${HOME} 'quoted text' "$1" awk test x=1 sed
+x=1 ${HOME} -eu $(pwd)
+local 2>/dev/null grep then ${HOME} "$1" grep
+/usr/bin readonly $(pwd) readonly
+	$(pwd) test echo test readonly x=1
+awk | /usr/bin local awk --verbose /usr/bin 2>/dev/null
+		readonly ${HOME} awk $(pwd) /usr/bin && ${HOME} export --verbose
+		| awk cd export done cd awk x=1 local | sed /usr/bin local then -eu export -eu
+		echo 2>/dev/null sed -eu x=1 | && | /usr/bin printf | x=1 && 'quoted text'
+	done sed local 2>/dev/null /usr/bin "$1" printf test
+${HOME} /usr/bin local
+'quoted text' 'quoted text' printf export | cd printf
+		grep echo readonly 'quoted text' --verbose "$1" -eu test
+		done $(pwd) $(pwd) readonly |
+"$@" done /usr/bin ${HOME} test
+		then /usr/bin sed --verbose then done $(pwd) ${HOME} grep done 2>/dev/null
+readonly ${HOME} 'quoted text'
+	awk echo then $(pwd) printf grep
+then cd "$@" local cd then readonly readonly -eu $(pwd)
+"$@" -eu echo cd export x=1 awk -eu export 'quoted text' /usr/bin done
+	--verbose 'quoted text' export done /usr/bin local printf
+	"$@" test $(pwd) grep 'quoted text'
+	x=1 readonly test readonly /usr/bin | "$@" cd local readonly printf cd x=1
+	-eu "$@" "$1" $(pwd) echo test -eu $(pwd) readonly test "$1" 'quoted text'
+$(pwd) $(pwd) 'quoted text' 'quoted text' -eu $(pwd) /usr/bin echo ${HOME}
+then /usr/bin then sed
+		--verbose grep /usr/bin --verbose
+then readonly | x=1 then done --verbose test then
+	local then export done /usr/bin "$1" readonly
+		readonly cd test $(pwd) $(pwd) -eu /usr/bin
+	"$1" x=1 awk test 'quoted text' $(pwd)
+	${HOME} awk test readonly export
+	"$@" readonly then --verbose 'quoted text' /usr/bin local printf export
+	cd $(pwd) "$1" 'quoted text' readonly && sed
+-eu done done 'quoted text' "$@" printf then "$@" $(pwd) awk echo printf
+| /usr/bin x=1 | echo && 2>/dev/null done readonly | --verbose
+		2>/dev/null awk grep /usr/bin awk x=1 local
+		&& echo "$@" export then then printf echo "$@" then printf printf
+		export -eu awk ${HOME} $(pwd) /usr/bin export printf -eu grep
+		test 'quoted text' printf
+	then --verbose 'quoted text' /usr/bin done
+printf && cd "$@" readonly
+	-eu printf awk 2>/dev/null local | --verbose $(pwd)
+		test -eu | -eu readonly readonly $(pwd) local | 2>/dev/null
+x=1 echo done $(pwd)
+	${HOME} 2>/dev/null x=1 "$1" grep export then /usr/bin "$1" awk
+	echo then printf sed grep 'quoted text' "$1" awk sed done &&
+	grep test /usr/bin done
+| -eu sed | 'quoted text' cd
+local grep -eu done $(pwd) done awk && test --verbose
+		grep readonly done 2>/dev/null 2>/dev/null x=1 ${HOME}
+$(pwd) 'quoted text' 2>/dev/null local && "$1" "$@" ${HOME}
+		"$@" /usr/bin --verbose cd awk test readonly
+	2>/dev/null export test sed printf 'quoted text'
+then 2>/dev/null 'quoted text' x=1 done readonly then -eu grep grep "$@"
+		cd test -eu -eu "$@" export && x=1 "$1" /usr/bin
+--verbose then sed | ${HOME} | readonly then | /usr/bin echo 2>/dev/null
+then local --verbose printf 2>/dev/null
+readonly $(pwd) sed 'quoted text' && 2>/dev/null sed echo "$1" "$1" ${HOME} "$1"
+		/usr/bin ${HOME} "$@" readonly
+grep 'quoted text' done done ${HOME} 'quoted text' then then cd done
+		grep ${HOME} printf test awk && test /usr/bin sed readonly
+		sed awk then export export
+		awk 'quoted text' test printf --verbose
+sed x=1 $(pwd) | readonly "$1" printf test echo readonly | done cd x=1 /usr/bin
+		2>/dev/null | && grep readonly $(pwd) 2>/dev/null test -eu
+	grep "$@" grep 2>/dev/null echo --verbose | 2>/dev/null 'quoted text'
+		&& | "$@" "$1" -eu local
+		printf grep 'quoted text' then local awk
+		echo done test test /usr/bin "$@" sed | export sed $(pwd) ${HOME} cd
+	readonly --verbose test printf $(pwd) 2>/dev/null local 2>/dev/null
+	'quoted text' "$1" && echo x=1 cd x=1 $(pwd) "$1"
+	x=1 awk awk /usr/bin x=1 printf export ${HOME} $(pwd)
+	grep grep local -eu $(pwd) "$@" grep x=1 sed sed ${HOME} | then printf 2>/dev/null
+		${HOME} && local -eu printf && export $(pwd) then cd readonly test "$1" --verbose
+${HOME} ${HOME} 2>/dev/null /usr/bin $(pwd) | x=1 printf
+grep test export --verbose --verbose
+awk test $(pwd) then export && /usr/bin
+export x=1 "$@" /usr/bin export export
+	readonly && export x=1 printf && "$1" x=1 echo done cd --verbose -eu
+2>/dev/null $(pwd) 'quoted text' echo grep "$@" | export grep cd
+local done 2>/dev/null $(pwd) "$@"
+		then cd cd "$@" && test x=1 --verbose "$@" ${HOME} sed --verbose | done --verbose
+		local /usr/bin && readonly cd --verbose echo readonly test && | | "$1"
+	grep sed | sed grep test "$1" cd echo && printf
+		2>/dev/null then echo grep test && | -eu "$@" then 'quoted text' local export
+	done | cd "$@" printf local "$1" test local local
+${HOME} grep | "$@" $(pwd) && echo
+	x=1 | readonly readonly | export
+		readonly local export -eu readonly --verbose
+| sed grep cd ${HOME} 2>/dev/null grep sed grep done then sed
+$(pwd) --verbose && cd cd done -eu 'quoted text' then -eu | done readonly
+		awk echo test sed 'quoted text' ${HOME} x=1 grep echo awk grep local printf
+		$(pwd) "$@" export echo done echo printf && "$@" echo local sed /usr/bin
+	cd | /usr/bin x=1 echo cd awk
+test "$1" awk "$@" sed local ${HOME} export 'quoted text' then readonly
+sed test ${HOME} $(pwd) cd && export x=1 echo
+	--verbose cd sed echo 'quoted text' --verbose /usr/bin
+		${HOME} && "$1" echo ${HOME} /usr/bin grep "$1" 2>/dev/null test
+	readonly ${HOME} test local sed -eu 2>/dev/null -eu grep echo /usr/bin
+	local export local | | cd x=1 && export |
+	local "$@" grep /usr/bin /usr/bin test sed cd done /usr/bin -eu ${HOME} cd
+	/usr/bin grep -eu sed local ${HOME}
+/usr/bin "$1" awk x=1 x=1 then
+printf printf done printf /usr/bin x=1 sed local done
+${HOME} "$@" then 2>/dev/null 2>/dev/null $(pwd) test 2>/dev/null /usr/bin
+		--verbose -eu then export $(pwd) awk
+&& printf "$@" ${HOME} echo printf &&
+		"$@" "$@" echo -eu cd ${HOME}
+	grep local && cd && done 2>/dev/null test 'quoted text' done grep test /usr/bin
+		local awk ${HOME} --verbose test then echo export /usr/bin "$1"
+		printf --verbose "$1" ${HOME} --verbose 'quoted text'
+	local cd ${HOME} done readonly sed && "$@" then readonly local | then | export
+		/usr/bin ${HOME} x=1 | && awk x=1 done printf echo awk x=1 /usr/bin
+/usr/bin --verbose export then $(pwd) ${HOME} local
+	done 2>/dev/null local /usr/bin "$@" test then cd 'quoted text'
+		done --verbose "$@" ${HOME} $(pwd) 2>/dev/null ${HOME}
+awk && echo cd grep export
+/usr/bin 'quoted text' ${HOME}
+	"$@" printf "$@" export export cd | printf "$@" sed then
+printf 'quoted text' "$1"
+grep /usr/bin "$@" export --verbose /usr/bin
+		-eu then test "$1" printf && && awk $(pwd) printf -eu -eu export ${HOME}
+readonly "$1" --verbose echo cd /usr/bin | ${HOME}
+	x=1 done --verbose x=1 && sed | ${HOME} done "$@" readonly $(pwd) readonly -eu
+		export cd awk 'quoted text' readonly
+then echo test 'quoted text' 2>/dev/null "$1" awk readonly test export printf
+--verbose /usr/bin --verbose /usr/bin 2>/dev/null 2>/dev/null
+		done 2>/dev/null then cd echo ${HOME} sed 'quoted text' local && -eu
+printf export /usr/bin ${HOME} awk "$@" test
+"$1" then -eu -eu readonly && printf "$@" test grep "$@" printf
+		then echo /usr/bin | 'quoted text' | | export ${HOME} | "$@" test
+	'quoted text' cd $(pwd) grep cd | -eu "$1" test then x=1
+		"$@" printf awk -eu readonly 2>/dev/null
+grep printf echo --verbose done echo $(pwd) sed
+	| --verbose awk x=1 export --verbose export echo done export printf
+		"$@" cd grep --verbose ${HOME} printf --verbose "$1" printf
+		sed $(pwd) sed then export 2>/dev/null 'quoted text'
+	then 2>/dev/null "$1" "$1" export --verbose x=1
+	cd awk then readonly sed echo 2>/dev/null grep --verbose
+then cd sed echo -eu then awk --verbose
+	${HOME} then 'quoted text' test
+then 2>/dev/null then sed cd local export awk
+awk && && "$1" "$@" "$1" "$1" printf cd --verbose local $(pwd) | sed awk then
+cd ${HOME} then ${HOME} /usr/bin 2>/dev/null
+		readonly "$1" "$1" awk && cd done cd test 2>/dev/null awk
+		test local grep grep printf
+cd ${HOME} "$1" local done -eu -eu awk done readonly readonly
+	--verbose then /usr/bin 2>/dev/null | 2>/dev/null local done echo --verbose
+	$(pwd) $(pwd) && 2>/dev/null 'quoted text' then done | x=1 echo
+	then 'quoted text' echo
+export readonly "$@" 2>/dev/null ${HOME} &&
+		then grep 'quoted text' /usr/bin printf
+	readonly test echo $(pwd) done $(pwd)
+2>/dev/null local then local
+'quoted text' 2>/dev/null | "$@" --verbose printf test
+	then readonly --verbose echo 2>/dev/null -eu && grep grep export sed
+cd awk 2>/dev/null test 2>/dev/null local then done --verbose export
+	x=1 /usr/bin cd $(pwd) /usr/bin "$@" /usr/bin -eu ${HOME} 'quoted text' grep
+2>/dev/null cd export | sed grep echo --verbose $(pwd) local
+x=1 x=1 test echo /usr/bin readonly /usr/bin local sed 2>/dev/null grep
+--verbose local grep && then local | -eu echo
+		2>/dev/null done | test && ${HOME} 'quoted text' && printf ${HOME}
+	done ${HOME} test -eu -eu test grep local
+"$1" echo awk local awk awk done "$1" "$1" 'quoted text'
+	sed export echo readonly sed /usr/bin printf
+	&& 2>/dev/null --verbose readonly "$1"
+printf awk done 'quoted text' awk cd sed && -eu
+cd printf x=1 x=1 done test | grep local readonly printf --verbose
+x=1 printf sed && export "$@" grep local
+		export 'quoted text' awk
+${HOME} /usr/bin | $(pwd) awk grep echo 2>/dev/null
+		${HOME} && 'quoted text' -eu
+echo -eu readonly readonly 'quoted text' then done
+'quoted text' printf done test cd 2>/dev/null
+		-eu ${HOME} local /usr/bin 2>/dev/null
+test then readonly "$@" awk && awk
+	'quoted text' --verbose /usr/bin -eu local export
+local sed ${HOME} awk "$1" awk && 'quoted text' --verbose "$@" $(pwd) local $(pwd)
+done grep /usr/bin awk
+	local -eu 2>/dev/null export /usr/bin --verbose export "$1" 2>/dev/null
+		$(pwd) local x=1 done /usr/bin && then "$@" -eu 'quoted text'
+	grep $(pwd) done "$@" 'quoted text' done echo --verbose $(pwd) &&
+then sed -eu cd "$1" 'quoted text' ${HOME} --verbose
+		&& x=1 /usr/bin | grep "$1" export grep then ${HOME} awk
+${HOME} printf 2>/dev/null
+export printf -eu local local ${HOME}
+test -eu local echo 'quoted text' $(pwd) /usr/bin
+		then local printf $(pwd) local grep export $(pwd) /usr/bin $(pwd) --verbose
+	echo grep 'quoted text' grep
+		test test --verbose $(pwd) local readonly test && "$1"
+	'quoted text' printf "$@" export printf
+	"$1" then 2>/dev/null 'quoted text' test grep -eu x=1 --verbose
+	2>/dev/null awk export sed $(pwd) 2>/dev/null export
+		&& $(pwd) 2>/dev/null 'quoted text'
+	/usr/bin "$@" $(pwd)
+2>/dev/null x=1 sed && 'quoted text' echo test && && "$1" 2>/dev/null
+		then "$1" test "$@" done test printf awk --verbose
+		${HOME} "$@" readonly test echo 2>/dev/null echo 2>/dev/null then
+		grep /usr/bin /usr/bin cd
+		local 2>/dev/null "$@" test grep echo printf 'quoted text'
+	"$@" readonly /usr/bin $(pwd) && "$1" local export
+		test 2>/dev/null then export "$@" grep echo grep /usr/bin "$@"
+	$(pwd) $(pwd) grep sed awk $(pwd) awk echo -eu echo && -eu then awk
+x=1 sed readonly done readonly && printf x=1 cd sed
+cd "$@" test awk printf readonly
+	awk readonly | 'quoted text'
+		export local --verbose test grep printf 2>/dev/null sed local readonly
+printf 'quoted text' printf $(pwd) test --verbose --verbose &&
+	awk printf echo 2>/dev/null grep
+	printf --verbose -eu && export awk 2>/dev/null printf test then x=1 && local
+done -eu --verbose "$1" echo echo -eu |
+local test awk then /usr/bin x=1 --verbose readonly /usr/bin grep 'quoted text'
+		| 'quoted text' && 2>/dev/null printf $(pwd) export "$1" local --verbose local
+		2>/dev/null x=1 grep local cd 'quoted text' then readonly 'quoted text'
+		export "$@" "$@" local export /usr/bin echo test "$1" $(pwd) -eu readonly
+		done ${HOME} local --verbose sed then ${HOME} export && $(pwd)
+&& grep ${HOME} readonly then
+		"$1" export "$@" ${HOME} -eu $(pwd) /usr/bin && /usr/bin test --verbose |
+		sed then export | --verbose done 'quoted text' | done x=1 then ${HOME}
+		"$1" ${HOME} && ${HOME} readonly /usr/bin 'quoted text' done
+&& awk readonly echo /usr/bin $(pwd) done test "$@" awk
+	done "$1" done done 'quoted text' "$1" local
+sed then "$@" 'quoted text' printf printf --verbose /usr/bin then
+awk grep readonly then /usr/bin 'quoted text' test /usr/bin
+grep cd test echo then
+cd /usr/bin test local --verbose readonly x=1 "$@" x=1 && cd 2>/dev/null done -eu
+		'quoted text' grep done -eu cd export cd sed
+	| printf 'quoted text' printf export -eu ${HOME} 'quoted text'
+	/usr/bin /usr/bin printf 2>/dev/null --verbose
+awk 'quoted text' -eu then ${HOME} printf "$1" --verbose
+| readonly "$@" export grep then export awk
+cd /usr/bin grep && -eu --verbose | local awk 2>/dev/null | done | 'quoted text'
+	awk | test then local test then | local then awk -eu
+&& && grep printf then -eu local echo cd /usr/bin ${HOME}
+$(pwd) echo test echo cd | --verbose done 'quoted text'
+awk --verbose 'quoted text' printf local
+/usr/bin printf done 2>/dev/null 'quoted text' ${HOME} done --verbose | &&
+	'quoted text' sed 'quoted text' | 2>/dev/null ${HOME} sed echo readonly echo
+		test --verbose done cd local
+then x=1 "$@" export done grep --verbose printf printf readonly sed awk -eu /usr/bin
+'quoted text' grep x=1 cd test cd
+	"$1" "$1" test sed "$1" cd x=1 'quoted text' ${HOME}
+-eu grep done "$1" && ${HOME} /usr/bin echo grep done ${HOME}
+		echo printf 2>/dev/null test then done $(pwd) "$1" $(pwd) | && "$1"
+	&& test cd /usr/bin printf
+/usr/bin test export 2>/dev/null ${HOME} --verbose cd cd --verbose awk grep
+	${HOME} /usr/bin 2>/dev/null && 2>/dev/null printf 'quoted text' export "$@"
+	printf /usr/bin echo readonly
+	--verbose export x=1 /usr/bin test grep done /usr/bin export
+	'quoted text' done | | -eu x=1 "$1" 2>/dev/null cd cd test -eu then export 2>/dev/null
+	"$1" grep | printf export x=1 && local done local readonly then x=1 echo /usr/bin
+	'quoted text' 'quoted text' "$1" && grep
+	grep test 'quoted text' awk local -eu | printf 'quoted text' /usr/bin echo
+		$(pwd) test local export --verbose
+	'quoted text' grep --verbose
+	readonly echo export | export 'quoted text'
+	then "$1" --verbose "$@" awk local "$1" readonly "$1"
+cd sed -eu then 2>/dev/null "$1" | local 2>/dev/null "$@" --verbose x=1 && printf
+		--verbose test "$1" local 'quoted text' grep | then 2>/dev/null export "$@"
+		cd local -eu "$@" | readonly awk cd -eu export /usr/bin sed 'quoted text'
+echo 'quoted text' /usr/bin 2>/dev/null
+		done grep done 2>/dev/null 2>/dev/null "$1" printf | awk printf "$1" --verbose
+	awk local then "$1" done echo x=1
+&& sed export ${HOME} test "$1" ${HOME}
+echo "$@" --verbose $(pwd) grep cd export | /usr/bin awk local -eu /usr/bin
+	printf printf "$1" "$1" sed awk test sed 2>/dev/null
+	done --verbose then awk local
+readonly ${HOME} sed ${HOME} | x=1 local --verbose test sed then 2>/dev/null
+		readonly $(pwd) 'quoted text' ${HOME} test readonly
+'quoted text' "$@" 'quoted text' done export test --verbose
+		&& $(pwd) "$1" | then && printf echo
+	grep printf echo -eu ${HOME} test export
+$(pwd) done awk awk grep
+2>/dev/null "$@" printf $(pwd) /usr/bin
+	then "$@" --verbose done
+2>/dev/null -eu awk -eu /usr/bin && x=1 readonly | -eu -eu "$1" ${HOME} awk
+export printf $(pwd) done sed test grep --verbose readonly awk sed echo readonly
+'quoted text' awk local readonly /usr/bin echo
+		-eu 'quoted text' -eu printf -eu export x=1 done grep
+test ${HOME} cd export test readonly local --verbose -eu $(pwd)
+		x=1 cd local grep cd local 'quoted text' printf "$1" cd test echo -eu "$1"
+	/usr/bin then "$1" awk
+	--verbose then && grep && 'quoted text' -eu "$@" "$@" export
+2>/dev/null 'quoted text' local x=1 x=1 "$@" ${HOME} -eu cd grep awk /usr/bin
+	test awk grep grep sed 'quoted text' && awk
+	$(pwd) cd /usr/bin --verbose
+	then 'quoted text' --verbose test local "$1" -eu echo
+	printf -eu "$1" done grep ${HOME} | x=1 "$@" done --verbose
+echo done cd x=1 cd && $(pwd) export x=1 $(pwd) local 'quoted text' cd
+	sed echo && -eu test "$1" test $(pwd) && ${HOME} local x=1
+		"$1" | | ${HOME} printf echo test cd && && $(pwd) sed && $(pwd)
+'quoted text' /usr/bin /usr/bin test then && && && 'quoted text'
+	echo ${HOME} export 2>/dev/null echo test | test $(pwd) x=1 "$1" done ${HOME}
+	test export ${HOME} "$@" printf "$@"
+cd && --verbose /usr/bin test ${HOME} grep && local export /usr/bin grep $(pwd)
+	done $(pwd) "$1" "$1" /usr/bin then
+	&& | sed test printf done grep grep /usr/bin local ${HOME} "$1" readonly
+	readonly sed readonly then ${HOME} --verbose
+		&& awk test /usr/bin sed x=1 readonly grep echo printf cd echo $(pwd) awk
+test && 'quoted text' done then -eu readonly local grep awk
+		local sed x=1 local local sed readonly
+		printf local | grep grep sed /usr/bin -eu $(pwd) readonly "$1" test
+$(pwd) x=1 echo "$@" grep $(pwd) awk 'quoted text'
+cd sed && sed $(pwd) && --verbose
+		'quoted text' grep /usr/bin
+		grep /usr/bin && export local ${HOME} done x=1 awk && | ${HOME} awk awk cd
+	-eu 'quoted text' done echo "$@"
+test awk /usr/bin grep
+		printf /usr/bin 'quoted text' awk printf export
+	--verbose grep done ${HOME} awk && awk export
+--verbose --verbose $(pwd) sed "$1" -eu sed ${HOME} "$1"
+		export /usr/bin -eu awk printf /usr/bin x=1
+	--verbose echo sed x=1 printf
+"$1" then then ${HOME} "$1" | | local readonly 2>/dev/null local
+		printf readonly echo $(pwd)
+export local 2>/dev/null grep ${HOME} x=1 x=1 /usr/bin | &&
+		test "$@" "$1" x=1 "$@" grep awk 'quoted text'
+		grep cd -eu $(pwd) local export ${HOME} printf
+	readonly cd --verbose && $(pwd)
+	--verbose /usr/bin test cd cd printf --verbose export grep sed done /usr/bin
+"$@" test --verbose awk
+"$@" --verbose echo /usr/bin |
+		"$@" cd cd ${HOME} "$1" done sed then
+		$(pwd) local "$@" export "$1"
+--verbose sed sed "$@" -eu $(pwd) 2>/dev/null ${HOME} "$1"
+	printf x=1 done "$1" "$1" echo "$@" ${HOME} "$@" $(pwd) x=1 $(pwd)
+export sed -eu done "$1" done test test 'quoted text' cd sed $(pwd)
+	cd /usr/bin 'quoted text' $(pwd) /usr/bin --verbose export test local
+		readonly echo --verbose then ${HOME} test cd then local && x=1 sed
+${HOME} "$1" cd "$1" readonly local cd readonly grep "$@" /usr/bin
+		| $(pwd) --verbose awk "$@" echo /usr/bin "$@" "$@" done | grep ${HOME} printf
+export test grep --verbose | /usr/bin $(pwd) readonly
+		--verbose echo 2>/dev/null grep x=1 "$@" ${HOME} $(pwd) /usr/bin /usr/bin test
+then x=1 then printf readonly readonly echo sed printf
+${HOME} ${HOME} x=1 export test && && local grep --verbose $(pwd)
+export --verbose && echo 'quoted text'
+sed then grep then &&
+	| "$1" local test readonly $(pwd) local done
+	&& readonly ${HOME} test test export grep sed
+	'quoted text' 'quoted text' echo grep local && cd $(pwd) 2>/dev/null
+	then readonly ${HOME} | grep 2>/dev/null
+$(pwd) readonly sed "$1" echo awk && -eu x=1 test printf
+		'quoted text' printf readonly "$@"
+echo cd grep 'quoted text' | printf /usr/bin x=1 sed ${HOME} 'quoted text'
+		'quoted text' $(pwd) local sed local done sed done
+	printf x=1 $(pwd) -eu echo readonly -eu
+		then readonly /usr/bin export x=1 "$1" then sed 2>/dev/null
+	2>/dev/null local ${HOME} then /usr/bin
+		test 'quoted text' --verbose --verbose /usr/bin x=1
+&& "$1" export grep --verbose
+test test done readonly printf done awk awk 2>/dev/null
+	"$@" | awk | 2>/dev/null done -eu | x=1 cd done export sed cd "$1" grep
+		| ${HOME} ${HOME} sed ${HOME}
+		| printf readonly readonly -eu x=1 2>/dev/null
+done sed awk $(pwd) /usr/bin ${HOME} echo 2>/dev/null ${HOME}
+		awk export && --verbose 2>/dev/null --verbose 2>/dev/null
+	"$@" ${HOME} "$1" echo --verbose /usr/bin awk sed
+		local done grep ${HOME} echo echo test
+		sed x=1 x=1 local readonly local "$@" cd --verbose &&
+		done awk ${HOME} -eu --verbose 'quoted text' sed
+		/usr/bin 2>/dev/null x=1 local ${HOME} --verbose --verbose test "$1"
+	"$@" sed 2>/dev/null then grep test
+		sed readonly then ${HOME} /usr/bin sed /usr/bin x=1
+	"$1" x=1 then awk "$@" awk awk --verbose export awk 2>/dev/null | 'quoted text'
+	echo $(pwd) $(pwd) && --verbose test export awk 'quoted text'
+test ${HOME} && "$@" sed --verbose 2>/dev/null readonly x=1
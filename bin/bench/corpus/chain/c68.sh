@@ -0,0 +1,2001 @@
+		'quoted text' done /usr/bin x=1 -eu printf printf done local local x=1 2>/dev/null
+		| cd awk done --verbose -eu readonly --verbose readonly echo 2>/dev/null
+	| export done readonly 'quoted text' readonly ${HOME} done sed
+		"$@" then awk readonly --verbose printf x=1 /usr/bin "$1" then export "$1"
+		echo done --verbose then sed -eu cd local awk 2>/dev/null -eu | ${HOME} grep echo
+	&& $(pwd) /usr/bin sed local && $(pwd) local 'quoted text' printf | /usr/bin
+done export 2>/dev/null
+readonly grep ${HOME} grep export sed awk -eu export echo echo echo
+then 2>/dev/null -eu export echo x=1 readonly printf test --verbose
+	cd export test $(pwd) --verbose cd ${HOME} readonly echo export "$@" grep
+	&& 2>/dev/null "$1" readonly && done
+		readonly local test /usr/bin $(pwd) --verbose cd ${HOME} x=1
+	--verbose $(pwd) /usr/bin -eu 'quoted text' x=1 ${HOME} export cd
+${HOME} then echo "$@" "$1" "$1" -eu 'quoted text'
+	x=1 export -eu | | $(pwd) echo grep export
+		readonly echo printf $(pwd) echo x=1 x=1 "$1" export readonly sed export done
+	export done local grep done
+		printf "$1" export -eu sed local export ${HOME} && readonly 'quoted text'
+x=1 2>/dev/null export "$@" readonly done -eu sed x=1 ${HOME} readonly test
+/usr/bin ${HOME} ${HOME} /usr/bin done &&
+/usr/bin -eu 'quoted text' "$1" readonly done | $(pwd) -eu ${HOME} echo 2>/dev/null
+printf -eu "$1" --verbose local echo local export --verbose printf /usr/bin x=1
+'quoted text' sed && local done x=1 "$1" grep | printf readonly | then awk local
+"$1" 'quoted text' test -eu cd -eu cd export local readonly test printf ${HOME}
+		done --verbose /usr/bin awk export export --verbose $(pwd) readonly readonly
+	--verbose 'quoted text' test 2>/dev/null "$@" 'quoted text'
+		awk 2>/dev/null export x=1 echo
+'quoted text' test 2>/dev/null local x=1 echo done "$@"
+	done export 'quoted text' /usr/bin 'quoted text'
+		"$1" ${HOME} | export done export
+		then ${HOME} cd $(pwd) echo /usr/bin done "$@" grep $(pwd) && done ${HOME}
+		local export test x=1 echo "$@"
+		sed sed x=1 test echo $(pwd) 2>/dev/null sed && x=1 done test done 2>/dev/null
+	export then 2>/dev/null
+	'quoted text' $(pwd) 'quoted text' printf
+		printf $(pwd) local then $(pwd) printf ${HOME}
+	"$@" /usr/bin test "$1" ${HOME} --verbose $(pwd) sed $(pwd) -eu echo awk
+		readonly ${HOME} 'quoted text' awk &&
+$(pwd) echo | -eu sed 2>/dev/null --verbose test grep readonly 'quoted text'
+		export printf readonly cd then --verbose ${HOME} echo sed "$1" test -eu -eu
+2>/dev/null printf 2>/dev/null
+		&& -eu readonly cd | echo x=1 $(pwd) /usr/bin
+	done done -eu 'quoted text' sed then -eu | echo "$@" cd echo 'quoted text'
+grep $(pwd) printf cd --verbose x=1 export printf then 2>/dev/null | local
+local && sed x=1 printf test sed && test readonly -eu echo ${HOME} /usr/bin
+		${HOME} grep $(pwd) printf
+		export local "$@" grep /usr/bin
+$(pwd) 'quoted text' -eu ${HOME} printf
+		$(pwd) --verbose printf /usr/bin
+		echo printf | then awk sed x=1 "$1" echo export test
+		/usr/bin done $(pwd) x=1 x=1 ${HOME} "$@" --verbose
+	x=1 awk 'quoted text' --verbose $(pwd) readonly 2>/dev/null
+		printf 2>/dev/null && $(pwd) echo
+done x=1 'quoted text' x=1 export awk
+	'quoted text' /usr/bin /usr/bin $(pwd) 2>/dev/null
+${HOME} 'quoted text' readonly --verbose "$1" echo && done printf "$@"
+		grep | readonly grep 2>/dev/null readonly $(pwd) readonly awk x=1 readonly
+	&& ${HOME} /usr/bin /usr/bin /usr/bin
+test $(pwd) 'quoted text'
+		/usr/bin echo 'quoted text' -eu grep -eu local echo "$1" $(pwd) export
+"$1" grep test $(pwd) | /usr/bin export "$1" printf &&
+	${HOME} --verbose grep x=1 | $(pwd) readonly /usr/bin
+		$(pwd) "$@" --verbose local $(pwd) 'quoted text' --verbose /usr/bin export
+echo && 'quoted text' cd $(pwd) grep "$@" test grep local
+		done -eu | $(pwd) local export && 2>/dev/null sed done printf export grep
+'quoted text' export export | "$1" -eu sed
+		"$1" x=1 grep $(pwd) local /usr/bin
+	${HOME} 2>/dev/null -eu | --verbose
+		${HOME} awk ${HOME} 'quoted text' 'quoted text' done /usr/bin ${HOME}
+		x=1 2>/dev/null 2>/dev/null printf awk | && then "$@" /usr/bin sed grep
+awk 'quoted text' then local 'quoted text' echo grep test -eu done --verbose
+		$(pwd) 'quoted text' && x=1 echo printf 2>/dev/null printf export --verbose echo
+	/usr/bin --verbose "$1" x=1 echo sed export readonly
+${HOME} awk 'quoted text' done echo ${HOME}
+x=1 readonly 'quoted text' x=1 export printf | sed "$@"
+	grep -eu then ${HOME} ${HOME} /usr/bin | readonly
+		export 'quoted text' ${HOME} "$@" export sed 'quoted text'
+	done sed 'quoted text' done ${HOME} local --verbose test
+'quoted text' local ${HOME}
+	2>/dev/null x=1 echo -eu echo --verbose printf export -eu local /usr/bin
+/usr/bin x=1 test x=1 test x=1
+	2>/dev/null sed done | readonly
+x=1 echo /usr/bin printf
+grep 'quoted text' && | test 'quoted text' grep cd readonly
+readonly 2>/dev/null 'quoted text'
+		"$1" 2>/dev/null "$1" printf readonly export ${HOME} printf
+		sed readonly "$@" echo local then done | "$1"
+x=1 'quoted text' cd sed export local local /usr/bin
+--verbose awk --verbose 2>/dev/null
+		"$1" --verbose local && readonly --verbose
+printf test echo "$@" --verbose export
+	then "$1" 'quoted text' "$@" awk 'quoted text' awk 2>/dev/null cd test sed &&
+	${HOME} cd grep 2>/dev/null grep readonly
+	--verbose readonly local printf 2>/dev/null
+x=1 printf ${HOME} "$@" --verbose 2>/dev/null 'quoted text'
+	then printf cd grep grep test grep && x=1 printf
+		"$@" && readonly done && $(pwd) readonly
+x=1 awk ${HOME} awk && test awk cd awk --verbose 'quoted text' export awk "$@"
+/usr/bin done 2>/dev/null readonly
+"$@" /usr/bin /usr/bin
+		--verbose 'quoted text' /usr/bin echo sed $(pwd) 'quoted text' | /usr/bin
+	${HOME} sed $(pwd) | /usr/bin test test export test /usr/bin
+"$@" --verbose printf then 'quoted text'
+done grep done "$1" x=1 export && export /usr/bin then sed export local then "$@"
+		$(pwd) ${HOME} /usr/bin
+local $(pwd) 'quoted text' echo --verbose x=1 cd "$1" --verbose 'quoted text'
+		${HOME} export awk x=1 printf
+	$(pwd) then local /usr/bin ${HOME} local 'quoted text' printf 'quoted text' "$1"
+sed done && grep local
+2>/dev/null done echo local test local awk
+export readonly export echo | /usr/bin
+'quoted text' /usr/bin "$@" echo x=1 "$@" "$@" $(pwd) | local readonly --verbose
+test --verbose printf && grep && x=1
+	then cd awk "$1" sed sed local local |
+export test cd local readonly test 'quoted text'
+	2>/dev/null | then x=1 2>/dev/null
+x=1 2>/dev/null ${HOME} sed test awk 'quoted text' ${HOME} printf
+		| test --verbose 2>/dev/null $(pwd) -eu
+	-eu "$@" local | done grep readonly cd done x=1 then ${HOME}
+"$@" awk readonly /usr/bin 'quoted text'
+done grep then /usr/bin sed 'quoted text' x=1 'quoted text' sed test "$1"
+"$1" local | done readonly 2>/dev/null sed "$@" printf x=1 done
+test -eu $(pwd) local "$@" done test $(pwd) test sed done
+		| cd printf /usr/bin awk export local && /usr/bin -eu "$@" 'quoted text'
+	grep test export readonly grep && | sed local 2>/dev/null cd printf readonly
+sed -eu | cd "$1" -eu cd $(pwd) then grep "$1" readonly
+		${HOME} 2>/dev/null --verbose cd --verbose
+	done 'quoted text' /usr/bin 2>/dev/null test "$1" --verbose 2>/dev/null 'quoted text'
+		/usr/bin 'quoted text' --verbose x=1 "$1" echo
+local then printf "$@" then ${HOME} 2>/dev/null done ${HOME}
+'quoted text' then $(pwd) | printf | grep readonly then $(pwd)
+	$(pwd) readonly -eu then
+readonly "$1" /usr/bin sed cd local x=1
+		x=1 export ${HOME} ${HOME}
+	"$1" && "$1" --verbose x=1 awk readonly
+	--verbose ${HOME} $(pwd) x=1 "$@" done ${HOME} x=1 | local export
+	local -eu && "$1" --verbose test -eu /usr/bin
+		| printf 'quoted text' x=1
+	-eu then then 'quoted text' "$1" x=1 local done | /usr/bin | printf
+		"$1" printf --verbose "$1" sed && grep ${HOME} "$1" sed awk awk /usr/bin
+		then "$@" 2>/dev/null awk test && "$@" sed | 'quoted text'
+test "$1" done printf sed readonly
+	readonly test | | export echo done ${HOME} test cd grep then
+	| && $(pwd) echo "$1" /usr/bin
+| "$1" local sed cd cd then sed 2>/dev/null sed
+		test x=1 | then x=1 awk done grep local export export
+		'quoted text' ${HOME} ${HOME} && test readonly test /usr/bin && test echo && awk
+		"$@" echo $(pwd) cd export readonly then local printf "$1" -eu | | printf
+	${HOME} export done test 2>/dev/null /usr/bin
+		local "$@" && 'quoted text' $(pwd) local -eu local 2>/dev/null local "$@"
+		local local test -eu grep && && test "$@" | x=1 | -eu
+"$1" "$1" $(pwd) "$1" echo awk local printf $(pwd) &&
+		readonly echo cd 'quoted text' export x=1 printf grep sed -eu
+	"$@" grep --verbose test "$1" "$1" 2>/dev/null /usr/bin | $(pwd)
+	| "$1" 'quoted text' echo 2>/dev/null echo "$@" grep
+	$(pwd) $(pwd) 'quoted text' | grep readonly export
+		readonly 2>/dev/null local local echo x=1 /usr/bin local export
+done -eu && local test printf --verbose test ${HOME}
+		/usr/bin export $(pwd) 'quoted text' printf ${HOME} printf 'quoted text' export
+cd "$1" $(pwd) ${HOME} x=1 test -eu then $(pwd) test
+	cd "$1" done awk ${HOME} $(pwd) -eu && --verbose
+	&& cd --verbose export then -eu cd
+	--verbose --verbose x=1
+		| -eu sed done x=1 "$@" $(pwd) export ${HOME}
+	-eu done local | "$1" --verbose awk cd $(pwd) cd ${HOME} local 'quoted text'
+printf sed "$@" done 'quoted text' /usr/bin $(pwd)
+		| cd -eu cd -eu local awk readonly $(pwd) --verbose test ${HOME}
+		printf 'quoted text' echo "$@" ${HOME} cd cd grep done | -eu
+then done cd x=1 done "$@" && "$1" sed $(pwd) readonly grep then x=1 "$@" sed
+echo sed | then "$@" ${HOME} test ${HOME} readonly readonly ${HOME}
+	"$1" 'quoted text' "$@" 2>/dev/null
+		awk local | 2>/dev/null "$1" sed /usr/bin export x=1 readonly 'quoted text'
+	readonly -eu | ${HOME} awk 2>/dev/null test grep
+	readonly x=1 echo "$1" test && /usr/bin --verbose | "$@" done
+readonly readonly cd x=1 x=1 export ${HOME} ${HOME} /usr/bin printf
+		grep -eu sed && $(pwd)
+--verbose grep grep $(pwd) cd /usr/bin echo $(pwd)
+		x=1 sed export "$@" $(pwd) sed 2>/dev/null x=1
+		printf export readonly
+		local export 'quoted text' x=1 printf readonly | $(pwd) export
+printf /usr/bin "$1" then local /usr/bin --verbose
+		| ${HOME} test awk done echo echo | -eu done -eu awk /usr/bin grep
+"$1" $(pwd) x=1 $(pwd) 2>/dev/null export
+		| printf /usr/bin cd then then grep then readonly /usr/bin
+local grep awk | echo 'quoted text' && $(pwd) awk sed done /usr/bin test ${HOME}
+		'quoted text' $(pwd) awk /usr/bin export echo && test
+		/usr/bin test --verbose local -eu sed | "$1"
+/usr/bin echo "$@" awk cd --verbose
+| /usr/bin $(pwd) -eu $(pwd) export done awk echo --verbose readonly
+	local ${HOME} export local
+		then export && x=1 --verbose
+&& -eu grep echo test /usr/bin
+		&& done export ${HOME} | "$@" "$1" test then
+x=1 grep ${HOME} 2>/dev/null echo test sed $(pwd) readonly
+	readonly $(pwd) | cd cd --verbose
+		echo --verbose "$@" test echo awk export "$1" 'quoted text' --verbose awk "$@"
+done readonly grep awk $(pwd) | x=1 echo awk done
+	--verbose 'quoted text' x=1 "$@" test awk 'quoted text'
+	--verbose test --verbose done done printf readonly done test 2>/dev/null
+	--verbose echo echo local printf 'quoted text'
+		grep printf ${HOME} 2>/dev/null "$@" grep --verbose
+	2>/dev/null && "$@" export readonly export then x=1
+$(pwd) x=1 local x=1 readonly ${HOME}
+		readonly sed --verbose 2>/dev/null -eu
+	cd && $(pwd) ${HOME} --verbose
+	cd && export awk | done -eu "$1" echo local $(pwd)
+		then /usr/bin --verbose test then --verbose awk
+		&& then echo && -eu grep --verbose $(pwd) then 2>/dev/null ${HOME} /usr/bin
+	export $(pwd) /usr/bin "$@" --verbose local $(pwd) echo done x=1 $(pwd)
+cd readonly $(pwd) local &&
+	local then cd printf readonly done 2>/dev/null
+	/usr/bin "$@" cd local done 2>/dev/null ${HOME}
+&& ${HOME} -eu sed -eu "$1" local
+test cd ${HOME} "$@" cd x=1 --verbose done "$@" "$1"
+		&& awk grep && then "$1" awk
+		readonly "$1" grep test export printf
+	local --verbose | then readonly echo echo sed "$1" then
+	-eu local sed /usr/bin && /usr/bin | awk readonly test sed printf | "$1"
+then -eu readonly && then readonly $(pwd) 2>/dev/null
+	--verbose "$1" $(pwd) echo "$1" echo /usr/bin export && $(pwd) grep | $(pwd) -eu
+	$(pwd) export -eu x=1 export done test done "$@" $(pwd) | awk export 2>/dev/null
+		x=1 printf 2>/dev/null x=1 awk awk export done "$@" 2>/dev/null grep
+	--verbose cd readonly $(pwd)
+		local 'quoted text' x=1 "$1" 'quoted text'
+echo then done echo grep then "$@" sed /usr/bin --verbose && grep sed ${HOME}
+${HOME} 'quoted text' sed $(pwd) | printf printf && x=1
+cd done then test then
+local && -eu "$@" /usr/bin --verbose --verbose grep readonly
+&& printf -eu /usr/bin ${HOME} printf readonly "$1" -eu awk /usr/bin sed grep done
+	awk then then /usr/bin test printf --verbose done 'quoted text'
+	grep x=1 x=1 2>/dev/null printf x=1 && done awk $(pwd)
+		printf test x=1 sed local /usr/bin cd $(pwd) echo 'quoted text'
+&& 2>/dev/null | then /usr/bin x=1 $(pwd) test sed && printf
+--verbose sed readonly "$1" cd printf export
+	local printf readonly /usr/bin 2>/dev/null echo
+	| ${HOME} | /usr/bin readonly /usr/bin awk --verbose $(pwd) test /usr/bin $(pwd)
+	'quoted text' 'quoted text' done --verbose
+"$1" -eu export readonly 'quoted text' && "$@" export done -eu -eu ${HOME} readonly
+	/usr/bin --verbose export cd -eu --verbose --verbose local
+		sed grep && awk 'quoted text'
+	local echo sed -eu 'quoted text' -eu cd $(pwd) echo && x=1 then -eu "$@" local
+	sed cd ${HOME} export grep local cd | grep --verbose
+		--verbose "$@" $(pwd) done 2>/dev/null
+	export 2>/dev/null $(pwd)
+--verbose cd ${HOME} x=1 ${HOME} readonly echo export readonly "$@" cd && 2>/dev/null
+cd x=1 export sed readonly cd -eu export -eu test --verbose 2>/dev/null "$1" local
+	local grep --verbose x=1 awk echo "$@" local --verbose readonly cd $(pwd)
+		/usr/bin awk 2>/dev/null x=1 x=1 sed
+		2>/dev/null echo --verbose local /usr/bin "$@" cd "$1" awk "$1"
+		grep /usr/bin then echo readonly
+	done "$@" --verbose export x=1 /usr/bin | x=1 -eu printf
+		printf "$1" "$@" /usr/bin
+	${HOME} then "$@" local | then sed sed awk grep /usr/bin cd awk echo | "$@"
+"$@" sed $(pwd) then | export printf $(pwd) echo -eu export printf $(pwd)
+		-eu printf "$@" -eu export "$@" --verbose $(pwd) x=1 $(pwd)
+		readonly "$@" && then printf 2>/dev/null | local test test done readonly "$1"
+		local local | export -eu cd
+		&& 2>/dev/null 'quoted text' printf "$@"
+	done $(pwd) -eu sed cd export then | "$@" awk printf "$1" -eu readonly
+	"$1" test local then $(pwd) 2>/dev/null cd ${HOME} cd
+	${HOME} "$1" export export && "$1" echo
+	"$1" awk sed printf "$@" 'quoted text' readonly --verbose awk echo sed
+	cd --verbose test awk -eu "$@" then | export "$1" cd then $(pwd) 2>/dev/null printf
+| | echo sed /usr/bin "$@" 'quoted text' -eu ${HOME} printf export
+		&& 'quoted text' sed | test -eu export
+'quoted text' echo $(pwd) && readonly "$1" --verbose sed sed cd /usr/bin
+	done printf awk "$@" ${HOME} "$@" printf 'quoted text' printf
+		--verbose /usr/bin then $(pwd)
+	"$@" "$@" cd readonly $(pwd) printf "$1" printf test local 2>/dev/null
+		"$@" "$@" cd /usr/bin echo -eu "$@" "$@" "$1" 2>/dev/null echo
+		grep 2>/dev/null echo -eu 'quoted text'
+	$(pwd) --verbose readonly &&
+		echo done "$@" 2>/dev/null "$1" then --verbose test export awk "$1" awk ${HOME}
+	-eu then awk x=1 && cd printf
+		&& done grep export sed printf export ${HOME}
+	sed cd then 2>/dev/null awk x=1 'quoted text' done readonly
+	${HOME} grep echo --verbose awk 2>/dev/null 2>/dev/null
+	"$1" "$1" && sed "$@" ${HOME} 'quoted text' "$1" -eu $(pwd)
+		test local /usr/bin && then
+	"$1" test && 'quoted text' done 'quoted text' grep --verbose $(pwd) then echo
+"$1" | "$1" echo export
+'quoted text' ${HOME} then export x=1
+		--verbose "$1" awk ${HOME} test printf
+	/usr/bin "$1" ${HOME} grep
+echo awk then then "$@" 2>/dev/null grep --verbose $(pwd) sed
+	readonly /usr/bin -eu /usr/bin x=1 && export && local
+		-eu cd ${HOME} && cd "$@" "$1" grep then "$1" ${HOME}
+"$@" 2>/dev/null -eu awk done then && /usr/bin then sed 2>/dev/null --verbose
+	| 'quoted text' "$@" local awk --verbose "$1" export ${HOME} readonly sed
+		test "$1" awk --verbose local 2>/dev/null x=1 "$@" sed ${HOME}
+		&& cd then $(pwd) -eu local echo awk printf /usr/bin
+	/usr/bin local echo --verbose /usr/bin /usr/bin sed /usr/bin printf then sed
+readonly grep echo echo
+		${HOME} sed cd 2>/dev/null cd x=1 local && 'quoted text'
+x=1 readonly $(pwd) local cd printf then --verbose
+&& then test --verbose -eu done local 2>/dev/null
+		sed && ${HOME} x=1 | readonly sed /usr/bin
+sed "$@" | cd ${HOME} done -eu 'quoted text'
+printf x=1 -eu local printf /usr/bin x=1 x=1 --verbose awk ${HOME} 2>/dev/null
+	sed done "$@" readonly 2>/dev/null done /usr/bin sed x=1 $(pwd) -eu test
+grep then 2>/dev/null | | x=1 && grep "$@" && /usr/bin grep "$1" cd
+	&& x=1 then then 'quoted text'
+		$(pwd) echo x=1 && echo --verbose then then test echo
+		/usr/bin "$@" echo 'quoted text' "$1" ${HOME} --verbose $(pwd)
+	local && sed $(pwd) $(pwd) /usr/bin export -eu export test 2>/dev/null
+	local "$1" local printf cd
+	cd cd "$1" local --verbose grep ${HOME}
+done "$@" 2>/dev/null ${HOME} awk readonly 2>/dev/null x=1 /usr/bin
+readonly --verbose done readonly x=1 sed printf --verbose local $(pwd) grep echo
+	x=1 export grep && -eu test then
+	&& echo "$@" ${HOME} cd && -eu then readonly then -eu cd 2>/dev/null
+&& ${HOME} echo -eu x=1 --verbose test 2>/dev/null /usr/bin
+awk | --verbose && -eu printf
+		awk export sed readonly -eu /usr/bin /usr/bin
+	echo sed echo printf echo x=1 -eu ${HOME} -eu
+readonly printf 'quoted text' test grep $(pwd) sed cd "$@" grep
+		local && awk | printf echo x=1 done test ${HOME}
+		"$@" grep "$@" "$1" ${HOME}
+readonly echo "$@" && $(pwd)
+-eu -eu export echo readonly --verbose local x=1 | sed export "$1" test 'quoted text'
+	readonly 'quoted text' ${HOME} "$1" test --verbose done then echo export test
+grep then local grep "$1" "$@" "$@" awk && "$1" 2>/dev/null done $(pwd) -eu "$1"
+	grep && echo /usr/bin 'quoted text' x=1 -eu readonly
+		${HOME} -eu /usr/bin local ${HOME} "$1" export x=1 cd cd echo done "$@" grep
+		grep --verbose export x=1 test | done done x=1 x=1 $(pwd) "$@" 2>/dev/null local
+done printf readonly echo 'quoted text'
+	then $(pwd) /usr/bin awk
+2>/dev/null awk ${HOME} $(pwd) /usr/bin then x=1 echo grep echo grep cd export
+		awk test x=1 /usr/bin
+	cd test echo | ${HOME} 2>/dev/null --verbose
+-eu echo "$1" x=1 done awk /usr/bin x=1 sed readonly -eu "$@" /usr/bin then
+	sed 2>/dev/null /usr/bin x=1 'quoted text' readonly "$@" export
+		2>/dev/null readonly -eu grep then -eu cd cd then done local grep local "$@"
+		--verbose test export $(pwd) "$@" $(pwd) done awk "$@" && readonly done
+	${HOME} && && && grep readonly sed 'quoted text' sed /usr/bin "$1" grep
+"$1" --verbose /usr/bin "$@" cd ${HOME} cd 2>/dev/null then ${HOME}
+		'quoted text' 2>/dev/null $(pwd) /usr/bin echo printf --verbose "$@" test
+$(pwd) sed cd then echo awk printf test export
+cd echo x=1 grep | grep then | readonly 'quoted text'
+		$(pwd) export x=1 export local && 2>/dev/null -eu local sed readonly "$1"
+		cd sed 'quoted text' test $(pwd) awk
+	-eu | && && "$@" $(pwd) && /usr/bin /usr/bin -eu
+	${HOME} printf --verbose then printf -eu local awk -eu && done x=1 --verbose
+		sed ${HOME} -eu export /usr/bin then --verbose then "$@" export done 2>/dev/null
+	-eu echo test awk --verbose test -eu x=1 | "$1" --verbose echo
+&& local readonly then 2>/dev/null grep local 'quoted text' | -eu sed
+		test $(pwd) grep -eu readonly readonly done
+	$(pwd) 'quoted text' && "$1" local -eu /usr/bin awk cd done grep
+readonly 2>/dev/null 2>/dev/null && "$1" | -eu /usr/bin
+	then -eu printf 'quoted text'
+		'quoted text' $(pwd) awk "$1" 'quoted text' printf x=1 awk "$1"
+&& sed "$1" | 2>/dev/null readonly -eu 2>/dev/null
+		x=1 $(pwd) local awk grep -eu then 2>/dev/null
+printf $(pwd) "$1" -eu 'quoted text' local --verbose "$@" done 'quoted text'
+'quoted text' done --verbose printf export $(pwd)
+	x=1 | 2>/dev/null test "$@"
+test | grep readonly 2>/dev/null && | 2>/dev/null cd --verbose then grep printf
+&& $(pwd) awk readonly /usr/bin $(pwd) -eu grep test -eu export
+		local /usr/bin cd export sed done --verbose cd awk readonly export sed local
+	test sed readonly | then -eu | x=1 awk local -eu
+	$(pwd) x=1 "$@" $(pwd) then awk 'quoted text'
+		export export 2>/dev/null then local -eu $(pwd) /usr/bin 2>/dev/null "$@" cd $(pwd)
+| done printf printf awk && && "$1" && x=1 | export grep echo |
+		cd 2>/dev/null x=1 $(pwd) 'quoted text' grep | /usr/bin echo x=1
+		'quoted text' then awk 'quoted text' test 2>/dev/null
+	&& ${HOME} sed | then readonly -eu "$@" sed 2>/dev/null "$@"
+	${HOME} grep echo then local ${HOME} cd echo cd export ${HOME}
+		sed 'quoted text' ${HOME} ${HOME}
+		&& $(pwd) then 2>/dev/null cd $(pwd) --verbose
+	export grep "$1" -eu awk grep /usr/bin
+	x=1 readonly $(pwd) awk --verbose 2>/dev/null cd
+	grep echo test done 2>/dev/null -eu done sed done
+		x=1 "$@" 'quoted text' /usr/bin /usr/bin grep "$@" 'quoted text' test test done
+echo echo ${HOME} grep printf echo printf $(pwd)
+	-eu awk 2>/dev/null then
+x=1 then test then readonly | awk printf printf
+2>/dev/null export done grep local x=1 export cd 2>/dev/null
+echo echo echo sed && test done 'quoted text' printf
+	x=1 echo --verbose "$1" x=1 | ${HOME} awk $(pwd)
+then grep "$1" done /usr/bin export echo sed sed grep done
+		${HOME} local && -eu 'quoted text' done cd --verbose
+	&& 'quoted text' done done done grep then 2>/dev/null x=1 readonly
+echo ${HOME} awk x=1 -eu echo test "$@" readonly echo
+| grep readonly printf awk printf
+		grep -eu ${HOME} printf 2>/dev/null
+$(pwd) "$1" done export done printf readonly $(pwd)
+		'quoted text' cd -eu local echo local --verbose
+		echo then sed x=1 | cd $(pwd) --verbose
+		echo test x=1 x=1 awk "$1"
+$(pwd) ${HOME} ${HOME} -eu 2>/dev/null x=1
+		awk | sed "$@" test "$1" 2>/dev/null && then x=1 -eu $(pwd)
+		${HOME} -eu ${HOME} awk echo grep readonly
+	awk awk | test export readonly export local grep
+		done --verbose sed "$@" 2>/dev/null local x=1 local -eu
+		$(pwd) && && local /usr/bin sed /usr/bin local export -eu awk grep done grep
+		printf "$@" -eu 'quoted text' "$1" then test $(pwd) echo -eu -eu local echo 2>/dev/null
+		then -eu echo /usr/bin && 'quoted text'
+readonly --verbose /usr/bin && /usr/bin "$1"
+		"$@" printf /usr/bin | 'quoted text'
+	awk | then x=1 -eu sed --verbose done then
+		sed local then grep 2>/dev/null awk "$@" ${HOME}
+'quoted text' "$@" | "$1" $(pwd) done --verbose awk && then
+awk ${HOME} echo | && --verbose -eu echo "$1" printf sed
+readonly readonly -eu sed | printf --verbose -eu
+		${HOME} ${HOME} cd then 'quoted text' grep 'quoted text' 'quoted text'
+${HOME} cd $(pwd) readonly ${HOME} sed local 2>/dev/null
+		test ${HOME} sed && x=1 grep /usr/bin "$1" | ${HOME} echo ${HOME}
+	export && cd -eu readonly readonly
+		x=1 done sed x=1 printf "$1" echo cd echo /usr/bin awk 2>/dev/null awk
+		--verbose printf && printf 2>/dev/null awk /usr/bin /usr/bin local 2>/dev/null
+-eu sed "$@" 'quoted text' export printf && then && readonly
+		export x=1 awk -eu export awk "$@" awk
+		"$1" | test -eu 'quoted text' export
+	x=1 readonly 2>/dev/null 'quoted text'
+'quoted text' printf then test cd /usr/bin test
+	&& --verbose | ${HOME} echo cd printf 2>/dev/null then
+-eu x=1 done 2>/dev/null export 2>/dev/null "$@" 'quoted text' "$@"
+-eu 2>/dev/null local grep ${HOME} --verbose
+		&& --verbose "$@" printf 2>/dev/null -eu "$@"
+local | cd 'quoted text' ${HOME} ${HOME}
+		local then echo /usr/bin cd awk "$@" done printf
+export awk "$@" awk $(pwd) "$@" "$@" "$@" export && 2>/dev/null
+		${HOME} awk test | awk 2>/dev/null /usr/bin "$@" "$1" x=1 test
+done printf ${HOME} x=1 --verbose grep printf
+then export grep 2>/dev/null
+	echo ${HOME} "$1" local x=1 /usr/bin test ${HOME}
+	"$@" test export | -eu "$@" awk cd $(pwd) local
+		readonly local cd done export --verbose
+		export readonly export $(pwd) -eu
+		readonly printf $(pwd) echo "$1" readonly grep "$@" /usr/bin
+		done 2>/dev/null $(pwd) done | -eu readonly local printf 2>/dev/null
+then --verbose local x=1 'quoted text' -eu --verbose export
+		readonly -eu export export printf
+--verbose grep readonly ${HOME} /usr/bin awk --verbose x=1 x=1 && awk 'quoted text'
+	cd test --verbose sed -eu "$@" grep 'quoted text'
+echo | "$@" ${HOME} 'quoted text' then $(pwd)
+grep $(pwd) sed 2>/dev/null cd printf echo test printf 'quoted text' echo /usr/bin
+		awk cd $(pwd) x=1 grep readonly export /usr/bin grep then
+	--verbose ${HOME} test "$1" readonly
+	2>/dev/null readonly printf cd done 'quoted text' /usr/bin
+	--verbose done printf grep --verbose 2>/dev/null
+	x=1 "$@" -eu 'quoted text' printf -eu x=1 x=1 echo /usr/bin echo "$@" then ${HOME}
+x=1 $(pwd) | x=1 test 'quoted text' -eu grep --verbose test ${HOME} && &&
+	export ${HOME} "$@" -eu x=1 awk printf --verbose
+		2>/dev/null --verbose ${HOME} printf
+	sed /usr/bin readonly export export then
+then $(pwd) $(pwd) --verbose sed echo | ${HOME}
+		grep printf --verbose "$@" done 2>/dev/null
+		then && x=1 "$@" printf 2>/dev/null then "$1" | then 'quoted text'
+sed cd done --verbose "$@" echo && local $(pwd) then 2>/dev/null -eu export
+		${HOME} x=1 /usr/bin "$1" readonly 2>/dev/null
+		x=1 ${HOME} sed printf /usr/bin /usr/bin then $(pwd) export ${HOME} cd export
+grep $(pwd) -eu local done done ${HOME} | local | test sed ${HOME} $(pwd) cd then
+done awk "$1" "$1" cd readonly awk readonly
+"$@" test 'quoted text' printf export x=1 && then echo then
+awk then 2>/dev/null $(pwd) done $(pwd) test "$1"
+	test test "$@" readonly "$@" done ${HOME}
+/usr/bin test 2>/dev/null sed grep local echo echo readonly 'quoted text'
+		"$@" && | --verbose echo -eu awk export ${HOME} 2>/dev/null
+2>/dev/null 'quoted text'
+		/usr/bin local local x=1 "$1"
+	local "$1" /usr/bin echo test export ${HOME} $(pwd) -eu --verbose
+	printf --verbose /usr/bin | echo then echo "$@" grep export | export
+'quoted text' then 2>/dev/null export awk ${HOME} | --verbose cd
+	sed --verbose echo then sed local
+		/usr/bin | ${HOME} grep sed echo grep sed
+	printf echo x=1 then | done x=1 then "$@" local
+	then then grep cd --verbose $(pwd) grep "$@" $(pwd) --verbose
+		grep printf then "$1" export cd ${HOME} 2>/dev/null local
+	local local && grep "$1" export /usr/bin then echo test echo sed test
+&& -eu "$1" 'quoted text' && export readonly local /usr/bin && | "$@" --verbose
+	| done local /usr/bin test "$1" then readonly $(pwd) cd 2>/dev/null
+	--verbose "$@" $(pwd) sed sed /usr/bin done cd /usr/bin "$@" 'quoted text'
+awk -eu test then 2>/dev/null sed printf x=1
+$(pwd) "$1" "$@" printf
+		readonly printf done -eu readonly export sed | test printf "$@" ${HOME} test
+		echo ${HOME} | test printf "$@" /usr/bin && ${HOME} grep echo sed test "$1" readonly
+		$(pwd) $(pwd) | echo 'quoted text' 'quoted text' "$@"
+	local $(pwd) --verbose --verbose
+test $(pwd) cd | -eu $(pwd) -eu test x=1 done "$@" cd | readonly then cd echo
+		sed then "$1" export ${HOME}
+awk 2>/dev/null 2>/dev/null readonly "$@" /usr/bin
+		local /usr/bin | export readonly 'quoted text'
+"$@" 2>/dev/null grep -eu /usr/bin 2>/dev/null
+	awk grep && ${HOME} --verbose done then
+'quoted text' "$@" ${HOME} --verbose
+		"$1" "$1" 2>/dev/null
+'quoted text' echo grep export "$@" "$@" sed test then then 2>/dev/null
+		local sed test "$@" ${HOME} printf | ${HOME}
+	x=1 printf | readonly sed cd then | "$@" /usr/bin
+		x=1 x=1 grep local awk test 'quoted text' echo 2>/dev/null
+	local && echo | echo "$1" -eu cd
+readonly local echo /usr/bin $(pwd) readonly ${HOME} "$@" "$1" grep
+$(pwd) grep --verbose ${HOME} printf $(pwd) done grep
+done -eu 'quoted text' local
+		--verbose --verbose awk grep sed export | export
+'quoted text' sed local $(pwd) cd local cd
+	grep readonly done /usr/bin grep then
+	cd cd done 'quoted text' "$1" local printf && $(pwd) && x=1 readonly
+then then 'quoted text' | export echo $(pwd) printf /usr/bin "$@"
+local echo --verbose x=1 local readonly 'quoted text' --verbose "$1" done --verbose
+		local test test x=1 awk && 'quoted text' readonly 2>/dev/null
+$(pwd) local "$@" grep -eu done --verbose ${HOME} ${HOME} x=1 readonly
+		"$1" local echo $(pwd) "$@"
+	awk "$1" --verbose local cd then -eu cd printf local awk awk $(pwd) readonly
+then $(pwd) /usr/bin echo export | then echo done readonly export
+	'quoted text' --verbose ${HOME} 2>/dev/null $(pwd) then --verbose
+cd cd "$@" done grep x=1 readonly export
+	$(pwd) "$1" $(pwd) "$@" "$@" grep
+	${HOME} awk readonly ${HOME} x=1 awk 2>/dev/null sed cd x=1 done | 2>/dev/null
+	test readonly grep /usr/bin && printf
+		test sed 2>/dev/null grep cd test
+"$@" printf echo then 'quoted text' printf x=1 2>/dev/null
+	$(pwd) $(pwd) && echo $(pwd) --verbose /usr/bin 2>/dev/null
+	/usr/bin && test "$1" 'quoted text' 2>/dev/null $(pwd) grep readonly then | cd
+local grep done "$1" echo then /usr/bin ${HOME} local cd 2>/dev/null test
+		echo export -eu sed test "$@" echo then awk printf printf 'quoted text'
+		--verbose sed $(pwd) export && x=1 'quoted text' x=1 && grep -eu echo printf
+	/usr/bin test grep "$1" readonly
+echo done printf then -eu grep echo echo -eu cd x=1 ${HOME}
+		awk 'quoted text' sed grep
+		x=1 && --verbose done && cd local --verbose local
+	test readonly local 2>/dev/null sed $(pwd) local "$@" echo "$1" ${HOME}
+	sed done test cd sed /usr/bin local
+sed ${HOME} echo done cd done sed "$1" export awk grep /usr/bin grep
+done sed x=1 echo done grep readonly echo export ${HOME} test done x=1 | x=1 2>/dev/null
+	'quoted text' $(pwd) done
+	-eu --verbose test "$@" printf 'quoted text'
+		"$@" | 'quoted text' -eu cd awk --verbose
+	then done "$1" 2>/dev/null --verbose awk 'quoted text' --verbose &&
+--verbose -eu grep "$@" readonly awk grep local done printf "$@"
+cd x=1 sed x=1 x=1 local
+cd export readonly grep grep grep "$1" test sed
+	"$@" local ${HOME} printf awk 'quoted text' --verbose local test
+		'quoted text' | done echo -eu sed $(pwd) "$@" test -eu readonly --verbose test --verbose
+		readonly awk readonly test | x=1 "$@"
+	'quoted text' local 2>/dev/null -eu ${HOME}
+$(pwd) -eu grep 2>/dev/null | -eu awk $(pwd) sed 2>/dev/null /usr/bin
+	cd test export cd printf -eu /usr/bin then printf
+		2>/dev/null then awk x=1 done "$1" ${HOME} then $(pwd) "$1" export "$@" -eu export
+	$(pwd) done $(pwd) ${HOME}
+printf /usr/bin $(pwd) 'quoted text' local 2>/dev/null 'quoted text' sed
+	| | x=1 && && cd awk 2>/dev/null 2>/dev/null sed done sed then 2>/dev/null
+		cd 'quoted text' && echo /usr/bin 2>/dev/null -eu
+-eu readonly "$@" --verbose local local done echo export test
+		readonly 2>/dev/null echo readonly --verbose "$1" 2>/dev/null sed --verbose cd
+		| ${HOME} ${HOME} "$@" awk awk sed cd x=1 readonly sed awk printf && "$1"
+	/usr/bin sed local grep x=1 x=1 "$@" 2>/dev/null "$@" readonly
+	printf $(pwd) export "$@" $(pwd) x=1 && "$1" awk
+		-eu | 2>/dev/null | printf sed grep x=1 export x=1 readonly readonly
+	-eu 'quoted text' $(pwd) then grep grep readonly x=1 export && grep ${HOME} "$1"
+	test 'quoted text' 'quoted text' sed export printf done 2>/dev/null "$@" test
+	2>/dev/null -eu printf export 2>/dev/null
+x=1 2>/dev/null --verbose sed "$@" 2>/dev/null local $(pwd) 'quoted text'
+"$1" sed | then awk $(pwd) $(pwd)
+	&& ${HOME} readonly readonly -eu test grep $(pwd)
+		cd sed $(pwd) x=1 x=1 2>/dev/null local grep then | x=1 -eu awk readonly
+cd x=1 x=1 | $(pwd) grep cd "$1" cd sed grep && local 2>/dev/null
+printf sed awk echo printf then "$1" sed -eu awk readonly
+	done awk grep x=1 x=1 "$1" --verbose printf export export test --verbose
+		'quoted text' "$@" then sed | $(pwd) "$@" grep done
+'quoted text' -eu "$@" local readonly
+	readonly echo done 'quoted text' test "$@" "$@" 2>/dev/null
+		local ${HOME} printf sed then -eu cd --verbose --verbose &&
+--verbose /usr/bin then /usr/bin done --verbose printf x=1 | echo cd 'quoted text'
+	grep -eu readonly grep sed --verbose echo "$@" | awk
+		"$@" export $(pwd) "$1" && ${HOME} readonly then done
+		-eu done sed $(pwd) -eu 'quoted text'
+/usr/bin $(pwd) local test grep 2>/dev/null -eu echo awk /usr/bin sed export
+	/usr/bin then then sed $(pwd) | -eu local
+		x=1 && "$1" /usr/bin echo "$@" done sed sed "$1" --verbose
+		--verbose && | $(pwd) x=1 /usr/bin /usr/bin
+		"$@" && && awk && "$1" test printf echo echo "$1" 'quoted text' echo test -eu -eu
+sed grep export export "$1" --verbose "$@" "$@" x=1 local ${HOME} "$@"
+	cd 2>/dev/null "$@" then echo local "$1" cd cd done echo test
+local x=1 --verbose x=1 printf
+		${HOME} "$1" | test -eu &&
+done ${HOME} export 2>/dev/null test
+		export ${HOME} && echo
+	grep 'quoted text' printf sed echo 2>/dev/null
+/usr/bin readonly /usr/bin $(pwd)
+	done awk 'quoted text'
+x=1 'quoted text' && readonly export ${HOME} -eu local --verbose cd awk
+		readonly printf "$@" && && x=1 printf "$@" $(pwd) ${HOME} awk $(pwd)
+	"$1" test && grep then local /usr/bin sed x=1 sed
+	${HOME} x=1 done then cd export awk readonly then
+		-eu && "$1" awk x=1 echo -eu x=1 local "$1"
+	local "$1" --verbose printf --verbose "$1" /usr/bin
+	-eu /usr/bin --verbose 2>/dev/null "$@" /usr/bin sed done x=1 sed "$1"
+		2>/dev/null cd export 'quoted text'
+		cd readonly ${HOME} -eu echo
+		'quoted text' printf 'quoted text' test x=1 test 2>/dev/null
+		2>/dev/null 2>/dev/null readonly --verbose
+	'quoted text' printf /usr/bin 2>/dev/null x=1 export $(pwd) awk awk readonly
+done cd 'quoted text' readonly test $(pwd) 2>/dev/null
+		awk cd done printf 2>/dev/null && && readonly test grep local export
+	$(pwd) printf test awk readonly 'quoted text' 2>/dev/null grep local "$1"
+		${HOME} readonly --verbose cd && printf /usr/bin x=1 -eu ${HOME} done readonly
+		${HOME} 2>/dev/null /usr/bin
+done && local readonly 2>/dev/null export
+	printf "$@" 'quoted text' sed grep cd
+--verbose cd printf --verbose $(pwd) export &&
+		cd --verbose && 'quoted text' && 2>/dev/null
+	local then readonly test $(pwd) $(pwd) "$@" | "$1"
+	echo echo export $(pwd)
+test awk cd && 'quoted text' -eu
+$(pwd) echo sed 'quoted text' x=1 test /usr/bin printf local awk
+'quoted text' ${HOME} 'quoted text' local $(pwd) sed
+printf sed /usr/bin x=1 readonly export --verbose
+	'quoted text' --verbose "$1" export grep awk --verbose echo readonly
+	/usr/bin 2>/dev/null "$@" "$@" test | | && local grep local ${HOME}
+	"$1" -eu test test $(pwd) sed local local
+	&& done printf $(pwd) test ${HOME} cd /usr/bin "$@" -eu --verbose
+		test echo readonly 'quoted text' test "$@" export
+	awk awk sed | /usr/bin ${HOME} local --verbose
+	printf 2>/dev/null /usr/bin local "$@" echo --verbose awk "$@" done
+'quoted text' "$1" ${HOME} ${HOME}
+		awk grep cd sed grep "$@" awk readonly grep done -eu echo
+		--verbose grep echo $(pwd) | printf ${HOME} local
+	done export export done done local | test test sed
+		export "$1" x=1 /usr/bin "$1" echo "$@" "$1" awk then awk done readonly readonly
+-eu awk | x=1 local --verbose -eu --verbose then --verbose sed -eu echo 'quoted text'
+		"$@" local x=1 export
+--verbose grep then local /usr/bin grep -eu ${HOME} export done sed done export
+$(pwd) | sed local --verbose 2>/dev/null export
+		test printf ${HOME} echo -eu
+x=1 export readonly local
+		2>/dev/null "$1" test local cd --verbose then $(pwd) -eu readonly cd "$@" "$1"
+	grep grep cd then export
+	x=1 && 2>/dev/null --verbose | -eu then local
+		&& "$1" ${HOME} printf done readonly x=1 readonly done
+	awk done $(pwd) x=1 "$@" 2>/dev/null export
+awk local sed readonly "$1" sed printf awk sed cd readonly $(pwd)
+		done x=1 export echo $(pwd) printf readonly 'quoted text' cd grep
+"$@" then && then $(pwd) printf /usr/bin 2>/dev/null grep local done local
+grep readonly 2>/dev/null awk 2>/dev/null &&
+		awk "$@" then printf cd $(pwd) grep ${HOME} "$1" /usr/bin && test then printf
+		awk awk && "$1" cd done 'quoted text' x=1 local then echo done then export
+	sed /usr/bin done then $(pwd) 'quoted text'
+		"$@" then "$@" awk 'quoted text' /usr/bin x=1 x=1 2>/dev/null
+		/usr/bin test $(pwd) readonly --verbose done then
+		/usr/bin 2>/dev/null /usr/bin awk echo --verbose export readonly awk -eu done
+		readonly /usr/bin x=1 sed printf echo sed done 2>/dev/null readonly done | cd
+sed grep cd awk grep -eu ${HOME} "$@" && done test | /usr/bin 2>/dev/null
+	2>/dev/null local export export local 'quoted text'
+echo printf readonly 2>/dev/null && "$1" echo readonly
+	x=1 -eu sed grep -eu echo local -eu printf grep
+	"$@" x=1 "$1" 'quoted text' $(pwd) "$@" echo
+	| --verbose | "$@" test printf "$1" -eu ${HOME} /usr/bin
+'quoted text' -eu "$1" grep done
+		2>/dev/null done local test ${HOME} echo printf | done echo test sed -eu
+		"$1" "$@" cd | "$@" ${HOME} then grep
+test "$@" test /usr/bin done "$@"
+done -eu sed echo x=1 grep "$@" echo | x=1 /usr/bin "$@" test readonly
+		then && /usr/bin 2>/dev/null
+		x=1 printf echo ${HOME} "$@" echo -eu "$@" && export /usr/bin export then /usr/bin
+	2>/dev/null /usr/bin echo export local ${HOME} grep local
+		"$1" local grep echo "$@" awk cd $(pwd) -eu cd 'quoted text'
+	printf "$@" test export
+then --verbose ${HOME} echo ${HOME} then /usr/bin x=1 "$@"
+	grep ${HOME} 'quoted text' echo
+--verbose local sed $(pwd) local echo x=1 $(pwd) test |
+	awk 2>/dev/null readonly done x=1 "$@" 'quoted text'
+x=1 local 2>/dev/null cd local 'quoted text'
+		cd | awk x=1 x=1 awk --verbose then | grep --verbose $(pwd)
+		local readonly --verbose readonly --verbose x=1
+		${HOME} printf "$1" test ${HOME} 2>/dev/null printf awk x=1 local printf
+		2>/dev/null /usr/bin awk && cd -eu $(pwd) && x=1 cd ${HOME} done
+cd "$@" "$@" ${HOME} done /usr/bin grep done echo x=1
+		echo /usr/bin then readonly echo $(pwd) x=1
+		2>/dev/null done x=1 'quoted text' local --verbose printf && $(pwd)
+	echo --verbose printf echo then --verbose test
+		then | printf $(pwd) test $(pwd) export readonly
+		grep "$1" -eu echo cd 'quoted text'
+	-eu grep cd export sed x=1 export x=1 $(pwd)
+awk && then "$@" -eu 'quoted text' test x=1 ${HOME} awk 'quoted text' -eu
+		echo awk "$@" "$1" /usr/bin "$1" export /usr/bin local
+		| -eu awk awk awk local export && grep export printf && echo /usr/bin
+		${HOME} "$1" local then 'quoted text' cd readonly printf ${HOME} sed | /usr/bin
+${HOME} | cd printf --verbose $(pwd) local | 'quoted text'
+done echo -eu echo then | &&
+export done $(pwd) export x=1
+| $(pwd) ${HOME} sed x=1 grep echo && awk test 'quoted text'
+	${HOME} /usr/bin export test readonly | printf local
+		/usr/bin && readonly export local readonly sed $(pwd) ${HOME} && | && echo
+		printf -eu "$@" sed local | | sed -eu cd grep --verbose printf
+	"$@" grep test "$@" 2>/dev/null
+	--verbose 'quoted text'
+	'quoted text' cd $(pwd) printf
+grep $(pwd) export awk cd sed "$@" local --verbose 2>/dev/null
+sed readonly && done sed x=1 'quoted text' cd 2>/dev/null
+sed $(pwd) grep echo "$@" 2>/dev/null export --verbose
+	'quoted text' readonly --verbose export local -eu local
+		sed awk --verbose echo 2>/dev/null --verbose
+		grep 'quoted text' -eu local && grep x=1 grep /usr/bin ${HOME} local && 2>/dev/null
+	readonly readonly printf cd -eu $(pwd) printf /usr/bin
+	-eu "$1" /usr/bin --verbose -eu local && 'quoted text'
+export export $(pwd) /usr/bin 'quoted text' -eu readonly x=1 readonly "$@" readonly
+		"$@" --verbose local "$@" | cd 2>/dev/null cd export then readonly
+		awk --verbose test 'quoted text'
+x=1 printf sed echo | $(pwd) then 'quoted text'
+		$(pwd) --verbose 'quoted text' readonly
+	2>/dev/null readonly export && sed then test
+	-eu "$@" echo 2>/dev/null /usr/bin -eu && 2>/dev/null
+"$1" test grep $(pwd) "$@" 'quoted text'
+	x=1 && 2>/dev/null readonly readonly sed -eu
+		$(pwd) "$1" ${HOME} ${HOME} then && | printf test export then cd awk local
+	| && cd export --verbose ${HOME} test --verbose "$1" && 'quoted text' x=1
+		printf done $(pwd) sed ${HOME} printf test echo --verbose
+		x=1 $(pwd) --verbose awk cd
+	x=1 "$1" then cd x=1 awk "$1" x=1 sed 2>/dev/null
+		readonly ${HOME} -eu export printf grep $(pwd)
+	-eu 2>/dev/null $(pwd) x=1 && sed 2>/dev/null
+	test ${HOME} 2>/dev/null
+		test 2>/dev/null --verbose cd then x=1 cd $(pwd) sed --verbose done $(pwd) echo
+then echo grep /usr/bin --verbose $(pwd) then
+/usr/bin --verbose | 2>/dev/null echo readonly
+		local export sed 2>/dev/null --verbose cd local printf
+	x=1 $(pwd) 'quoted text'
+		&& $(pwd) printf cd && done ${HOME}
+	done readonly x=1 "$@" x=1 test readonly printf local sed "$@" then $(pwd)
+grep "$1" readonly done export test export 'quoted text' /usr/bin printf done
+'quoted text' test x=1 x=1 echo cd /usr/bin
+		-eu local echo ${HOME} 2>/dev/null done ${HOME} sed done local ${HOME} done test
+		readonly "$@" "$1" printf -eu 2>/dev/null | export /usr/bin then awk $(pwd)
+		$(pwd) local done | $(pwd) | printf 2>/dev/null x=1 done
+		$(pwd) --verbose x=1 then awk test printf export 2>/dev/null && readonly echo
+	$(pwd) export /usr/bin && awk readonly 'quoted text' 2>/dev/null awk test
+	$(pwd) grep cd ${HOME} cd then
+	export "$@" grep sed then printf printf readonly readonly readonly sed
+	echo && | --verbose echo x=1 export done
+	test echo local x=1 test then
+	/usr/bin local --verbose grep test -eu 'quoted text' echo /usr/bin
+then done test export sed ${HOME} local
+${HOME} 2>/dev/null cd printf
+grep "$1" test then 'quoted text' 2>/dev/null
+		-eu export awk | done /usr/bin cd 'quoted text' awk "$1" &&
+	local | --verbose readonly
+	then /usr/bin echo done awk done "$1" export echo printf 2>/dev/null ${HOME}
+		&& readonly echo cd awk readonly printf then 'quoted text' echo
+	local 'quoted text' | /usr/bin 2>/dev/null | readonly
+	-eu cd test 2>/dev/null then
+		printf done "$@" $(pwd) "$1" printf done 2>/dev/null | then --verbose
+done grep 2>/dev/null then readonly readonly test cd cd "$1" export && ${HOME}
+	awk grep 2>/dev/null test local echo awk test /usr/bin 'quoted text' $(pwd) "$@"
+		&& 'quoted text' ${HOME} printf echo -eu done 'quoted text'
+		export grep awk export
+	then local sed then | --verbose | done ${HOME} && /usr/bin --verbose 'quoted text'
+		${HOME} $(pwd) 2>/dev/null --verbose --verbose
+then awk x=1 export readonly printf && done "$1" readonly
+	sed 'quoted text' "$@" x=1 && grep "$1" "$1" cd /usr/bin readonly local cd
+	export echo ${HOME} echo sed -eu -eu "$1" printf awk local -eu x=1
+	/usr/bin x=1 awk --verbose x=1 then | echo test grep /usr/bin
+	${HOME} $(pwd) x=1 --verbose "$@" grep cd grep && printf && 2>/dev/null
+	"$@" awk ${HOME} "$1" && | 2>/dev/null
+		sed && done grep then 'quoted text'
+	'quoted text' then awk local awk readonly test $(pwd) && --verbose "$1" export
+	| "$@" test echo echo x=1 'quoted text' $(pwd) | echo
+	--verbose grep "$1" sed | ${HOME} x=1 grep -eu cd awk x=1
+test test echo -eu && "$@" 2>/dev/null -eu echo printf $(pwd)
+&& ${HOME} --verbose done
+		export sed local /usr/bin export "$1" | cd 'quoted text' -eu "$@" awk $(pwd)
+		$(pwd) echo 'quoted text' "$@" grep | "$@" "$@" && | /usr/bin
+	-eu cd "$1" grep && readonly awk cd readonly | printf sed -eu x=1 echo 'quoted text'
+	"$1" local cd | printf sed -eu awk done "$1"
+	sed | export && printf ${HOME} 'quoted text' $(pwd) echo
+		"$1" awk /usr/bin echo done && echo "$@" done "$@" x=1 "$1" $(pwd)
+echo $(pwd) "$@" /usr/bin printf /usr/bin
+		test $(pwd) 'quoted text'
+	awk test | then local export awk ${HOME} awk printf export ${HOME} local then
+printf sed "$1" /usr/bin /usr/bin done export "$@" ${HOME} echo
+	readonly awk echo && ${HOME} awk /usr/bin x=1 done then $(pwd)
+	$(pwd) local then cd test export awk 'quoted text' "$@" done
+${HOME} export then "$1" export --verbose sed x=1 grep "$@" then && done 'quoted text'
+	2>/dev/null --verbose /usr/bin sed then $(pwd) export
+"$@" x=1 printf /usr/bin "$@"
+	sed 'quoted text' done
+	-eu test "$1" cd cd echo test | done then ${HOME} test /usr/bin grep awk -eu
+		$(pwd) printf $(pwd) -eu awk cd export /usr/bin -eu test grep awk
+		${HOME} 'quoted text' -eu -eu 'quoted text' local /usr/bin 2>/dev/null | 2>/dev/null
+/usr/bin /usr/bin 'quoted text' readonly --verbose
+		/usr/bin printf sed /usr/bin ${HOME} sed cd
+x=1 /usr/bin $(pwd) readonly && $(pwd)
+"$1" grep 'quoted text' "$@" done 'quoted text' done && then "$1" grep grep awk
+	/usr/bin cd export | 2>/dev/null
+	sed ${HOME} 'quoted text' echo ${HOME} local ${HOME} x=1 x=1
+	2>/dev/null 2>/dev/null cd --verbose awk awk export grep
+		then "$@" done 2>/dev/null "$1" echo
+	cd && readonly | export "$@" --verbose cd /usr/bin local --verbose && && sed sed
+	grep 'quoted text' "$1" printf 'quoted text' ${HOME} 'quoted text' 'quoted text'
+		&& echo printf then test ${HOME}
+		"$1" ${HOME} then --verbose test $(pwd)
+		"$1" --verbose $(pwd) local x=1 2>/dev/null
+	test cd --verbose 'quoted text' readonly grep local
+| -eu && $(pwd) ${HOME} --verbose /usr/bin grep 'quoted text'
+	awk then -eu 2>/dev/null ${HOME} awk export local grep "$1" --verbose
+	2>/dev/null | sed | x=1 then $(pwd) awk -eu --verbose
+		--verbose grep ${HOME} export
+		&& printf | ${HOME} then ${HOME} $(pwd) x=1 "$1" sed printf "$@"
+	then --verbose export readonly -eu "$1" printf 'quoted text'
+--verbose 2>/dev/null 2>/dev/null cd -eu cd $(pwd) $(pwd) 2>/dev/null
+	/usr/bin sed 2>/dev/null "$1" grep export local
+grep 2>/dev/null echo cd 2>/dev/null | grep local export -eu local
+		readonly grep cd x=1 awk readonly cd "$@" $(pwd)
+		export done $(pwd) awk cd grep done export ${HOME} readonly echo && /usr/bin
+grep ${HOME} sed --verbose readonly done readonly 2>/dev/null "$@" 2>/dev/null
+export sed --verbose awk && then readonly export test
+	-eu | "$@" -eu ${HOME} /usr/bin grep 'quoted text' awk test
+		2>/dev/null cd grep $(pwd) 2>/dev/null
+	cd /usr/bin printf ${HOME}
+	test printf && readonly | ${HOME} $(pwd)
+		x=1 done awk test then echo printf && grep "$1" sed awk printf "$1" local | grep
+		| grep local --verbose | cd sed cd sed
+		'quoted text' printf -eu awk -eu done then
+		$(pwd) awk $(pwd) -eu --verbose
+	$(pwd) ${HOME} awk awk -eu -eu $(pwd) "$@" local then x=1 "$1" sed
+		grep -eu local readonly 'quoted text' 'quoted text' $(pwd)
+printf --verbose $(pwd) done --verbose /usr/bin 2>/dev/null
+		sed --verbose grep "$@" | $(pwd) x=1 --verbose 2>/dev/null /usr/bin sed x=1
+	sed /usr/bin awk ${HOME} awk
+	cd x=1 | /usr/bin --verbose awk export then ${HOME} export --verbose ${HOME} then
+"$@" && cd then -eu cd local 2>/dev/null readonly
+		echo test /usr/bin sed echo x=1 "$@" awk --verbose
+local --verbose readonly readonly printf -eu
+		sed x=1 ${HOME} awk ${HOME} $(pwd) test $(pwd) "$@" --verbose awk x=1
+		&& $(pwd) $(pwd) test done 2>/dev/null printf grep "$1" echo /usr/bin
+		awk -eu "$@" local | | ${HOME} "$1" 2>/dev/null
+"$@" /usr/bin awk test && readonly
+		2>/dev/null && | 2>/dev/null
+	export | ${HOME} 'quoted text' | awk then -eu grep sed readonly /usr/bin | /usr/bin
+	test $(pwd) echo 2>/dev/null awk "$@" ${HOME}
+	--verbose sed x=1 2>/dev/null echo 'quoted text' local $(pwd) sed local then
+readonly awk grep awk sed local sed --verbose x=1 'quoted text'
+| | sed readonly done test done awk --verbose readonly
+local local local printf readonly ${HOME} --verbose ${HOME} readonly /usr/bin
+grep 'quoted text' 2>/dev/null 'quoted text' echo
+		2>/dev/null /usr/bin echo "$@" && export
+		2>/dev/null readonly -eu /usr/bin -eu echo readonly then done
+		then done 2>/dev/null grep 'quoted text' sed
+	sed readonly | done 'quoted text'
+		$(pwd) export && ${HOME} cd 2>/dev/null -eu /usr/bin 2>/dev/null printf 2>/dev/null
+--verbose "$@" -eu awk cd test printf && 'quoted text'
+	"$@" grep -eu sed readonly grep x=1 export "$1" local
+"$@" local $(pwd) sed 'quoted text' $(pwd) awk export ${HOME} local
+local "$@" -eu cd echo | /usr/bin
+		test x=1 x=1 awk && grep then | awk grep then "$1" cd test echo "$1" ${HOME}
+		then export --verbose /usr/bin
+readonly then export $(pwd) sed
+$(pwd) ${HOME} 2>/dev/null
+| x=1 awk ${HOME} && done ${HOME} ${HOME} /usr/bin grep $(pwd) 2>/dev/null
+--verbose readonly printf export 'quoted text'
+		| local ${HOME} ${HOME} test ${HOME} readonly grep "$1" grep echo
+	2>/dev/null -eu /usr/bin
+		| test 'quoted text' printf readonly
+		test done /usr/bin local "$1" && awk $(pwd)
+		printf | ${HOME} /usr/bin $(pwd) then $(pwd)
+	2>/dev/null ${HOME} readonly ${HOME} printf sed awk 2>/dev/null test && readonly
+		awk --verbose 'quoted text' then 2>/dev/null
+	done "$@" export done cd x=1 grep echo local
+	/usr/bin then "$1" local grep local local x=1 x=1 -eu done export
+	printf /usr/bin | local grep echo -eu cd x=1 grep 'quoted text'
+"$@" cd ${HOME} "$1" ${HOME} ${HOME} then local "$@" then ${HOME} "$1" sed
+		cd sed done local --verbose
+		"$1" ${HOME} awk "$@" echo "$1" "$1" sed printf --verbose /usr/bin
+	then then then export $(pwd) grep test test
+	awk -eu "$1" /usr/bin done $(pwd) /usr/bin test "$1" readonly cd $(pwd)
+	test printf cd --verbose local "$@" 2>/dev/null 2>/dev/null
+		then && --verbose 2>/dev/null
+	${HOME} echo awk sed awk && local
+		awk $(pwd) done $(pwd) test && local "$1" $(pwd)
+&& local -eu /usr/bin 'quoted text'
+		2>/dev/null grep local 2>/dev/null "$1" export done then ${HOME} then
+-eu "$1" x=1 | && test 'quoted text' then x=1 done printf
+	&& then ${HOME} "$1" local --verbose cd
+	--verbose echo "$@" --verbose awk | x=1 printf printf "$@" sed cd export
+	"$@" local "$@" printf -eu $(pwd) sed sed then ${HOME}
+sed --verbose "$@" then ${HOME} cd cd $(pwd) test
+		2>/dev/null done 'quoted text' export then $(pwd)
+	printf && sed cd local cd grep done test $(pwd) printf 2>/dev/null printf 2>/dev/null
+	&& && $(pwd) local export x=1 /usr/bin test -eu 'quoted text' 'quoted text'
+	done grep grep "$1" ${HOME} awk then cd cd local $(pwd) "$@" awk 'quoted text'
+readonly grep then $(pwd) /usr/bin "$@" /usr/bin x=1 printf
+-eu done 2>/dev/null test
+		"$@" "$1" "$@" readonly 2>/dev/null local
+| 'quoted text' sed ${HOME} "$@" -eu printf export printf
+		${HOME} grep /usr/bin "$1" readonly && then grep done
+	export "$@" then x=1 2>/dev/null readonly x=1 echo && --verbose
+		export 'quoted text' done readonly echo test printf awk | printf sed printf printf
+"$1" 2>/dev/null done awk printf $(pwd)
+test local /usr/bin printf grep ${HOME}
+local /usr/bin x=1 "$@"
+		awk "$@" 2>/dev/null 2>/dev/null echo cd test readonly readonly -eu
+	'quoted text' x=1 'quoted text'
+	"$1" "$1" cd 2>/dev/null awk /usr/bin "$1" x=1 then printf --verbose $(pwd)
+	| 'quoted text' cd "$1" | &&
+	'quoted text' -eu && /usr/bin "$1" export 'quoted text' grep
+	printf ${HOME} "$@" 2>/dev/null export 'quoted text'
+	awk printf awk sed sed x=1 echo done $(pwd) sed /usr/bin --verbose sed
+		done echo && 2>/dev/null
+		--verbose cd cd "$@" awk cd 2>/dev/null sed --verbose
+x=1 done "$@" "$1" readonly "$1" | "$1" "$1" test "$1" 2>/dev/null &&
+		--verbose ${HOME} 2>/dev/null --verbose readonly
+		2>/dev/null -eu echo awk export
+"$@" ${HOME} done ${HOME} | printf "$@" "$@" sed $(pwd) sed
+		x=1 /usr/bin awk awk ${HOME} x=1 sed
+	&& $(pwd) done done echo export
+'quoted text' --verbose x=1 -eu
+done awk local sed "$@" local local grep test $(pwd)
+	local "$@" $(pwd) -eu -eu ${HOME} readonly -eu then then 2>/dev/null
+${HOME} "$1" ${HOME} awk 2>/dev/null --verbose x=1
+	2>/dev/null --verbose printf "$@" | test --verbose printf ${HOME} printf
+readonly "$@" sed local "$1" export x=1 grep /usr/bin
+grep "$@" awk 2>/dev/null 2>/dev/null export && x=1 echo awk cd local
+&& done ${HOME} local "$1" 2>/dev/null --verbose cd 2>/dev/null --verbose export
+		local printf --verbose "$@" --verbose cd awk awk /usr/bin export done readonly
+"$@" cd -eu local done /usr/bin ${HOME} test $(pwd)
+		printf printf | ${HOME} grep grep echo "$@" --verbose sed
+	x=1 x=1 /usr/bin /usr/bin echo /usr/bin export 'quoted text' echo cd && &&
+		cd export /usr/bin 2>/dev/null /usr/bin local grep --verbose $(pwd)
+x=1 awk test sed 2>/dev/null sed "$@" readonly /usr/bin | grep $(pwd) echo
+	echo --verbose 2>/dev/null 2>/dev/null
+	'quoted text' --verbose $(pwd) test --verbose
+	test --verbose 2>/dev/null cd
+readonly | printf local -eu 'quoted text' awk awk &&
+cd | x=1 "$@" "$1" cd export done readonly --verbose 'quoted text' readonly
+		"$1" "$1" "$@" test readonly sed | -eu export x=1
+then printf 'quoted text' -eu 2>/dev/null readonly
+local --verbose /usr/bin then test ${HOME} -eu ${HOME}
+	"$1" grep cd "$1" /usr/bin
+		grep --verbose $(pwd) 2>/dev/null cd && --verbose
+		local then export "$1" awk "$1" awk awk export
+		--verbose 'quoted text' 2>/dev/null
+"$1" grep | local awk 2>/dev/null test export /usr/bin
+${HOME} echo "$1" readonly done ${HOME} | readonly local -eu
+		sed test ${HOME} x=1 'quoted text'
+&& done echo 'quoted text' --verbose grep
+grep x=1 ${HOME} /usr/bin "$@" readonly grep && then cd && 'quoted text' |
+grep readonly then "$@" ${HOME} && sed sed echo "$1" readonly
+		${HOME} | test awk "$@" --verbose "$1" cd
+	done && then echo grep echo
+| 'quoted text' sed local | x=1 local test export done
+	cd test echo then "$1" cd readonly done export ${HOME}
+awk --verbose export echo then
+	${HOME} 'quoted text' 2>/dev/null printf
+	'quoted text' $(pwd) x=1 grep then 2>/dev/null then awk |
+awk | "$@" /usr/bin then grep awk
+"$@" --verbose cd then echo 2>/dev/null
+	export sed printf "$1" $(pwd) ${HOME} sed "$1" sed
+	cd then done ${HOME} "$@" done readonly
+		x=1 2>/dev/null "$1" local
+	printf -eu --verbose ${HOME} 2>/dev/null x=1 && grep 'quoted text'
+printf done && $(pwd) --verbose 'quoted text' export echo export -eu sed 'quoted text'
+		/usr/bin 2>/dev/null /usr/bin
+		export test done local local $(pwd) | x=1 2>/dev/null export done
+&& local -eu 'quoted text' -eu
+/usr/bin local printf 2>/dev/null | -eu --verbose "$@" --verbose ${HOME}
+		local 2>/dev/null printf local /usr/bin echo cd
+		cd 2>/dev/null /usr/bin cd --verbose done 'quoted text' test readonly && local
+	test /usr/bin local grep x=1 printf sed $(pwd) x=1 "$@" then ${HOME}
+		&& "$1" | printf | done test sed test done local -eu
+		export done $(pwd) readonly readonly && local
+		--verbose sed awk /usr/bin then 'quoted text'
+		cd export --verbose "$1" local sed readonly
+	| "$@" grep done && done grep
+		echo export | && export sed 'quoted text' ${HOME}
+		local --verbose -eu readonly cd $(pwd) -eu cd export "$1"
+	echo | cd --verbose printf 'quoted text' done
+"$1" readonly cd 'quoted text' "$@" "$1" 2>/dev/null 'quoted text'
+	x=1 --verbose echo --verbose
+echo /usr/bin x=1 cd "$@" -eu 'quoted text'
+		"$1" local 2>/dev/null --verbose local echo export sed then printf 2>/dev/null
+		sed readonly then x=1 test printf x=1 $(pwd) sed cd --verbose sed
+readonly sed export ${HOME} --verbose -eu -eu | readonly
+test -eu grep grep 'quoted text'
+	-eu 'quoted text' test --verbose -eu --verbose --verbose local test
+	printf sed "$@" && echo cd /usr/bin grep sed then local export printf
+	awk "$1" && local test
+	"$1" x=1 done 2>/dev/null && $(pwd) then readonly x=1 test
+	-eu -eu cd 'quoted text' x=1
+	printf cd printf "$@" export cd /usr/bin test then /usr/bin then ${HOME} test awk
+	grep && | "$1" grep | 2>/dev/null /usr/bin 'quoted text'
+| then $(pwd) x=1 2>/dev/null --verbose printf
+	export done /usr/bin local
+		"$@" printf "$@" "$@" export x=1 sed | ${HOME} 'quoted text'
+		| ${HOME} 'quoted text' echo /usr/bin ${HOME}
+	2>/dev/null echo /usr/bin 'quoted text' "$@" -eu --verbose sed "$1" echo export
+		local echo sed 2>/dev/null sed ${HOME} | | "$@" cd echo local awk 'quoted text'
+	then test cd | export done printf x=1 -eu x=1 | 'quoted text' --verbose $(pwd)
+done export grep echo | local done
+printf sed $(pwd) x=1 $(pwd) 2>/dev/null
+cd awk x=1 -eu cd /usr/bin /usr/bin printf
+"$1" ${HOME} cd 2>/dev/null "$1" 'quoted text' /usr/bin test export 2>/dev/null
+		${HOME} 'quoted text' | "$1" then grep -eu grep $(pwd) local sed /usr/bin
+$(pwd) $(pwd) awk local then
+	&& printf printf cd /usr/bin $(pwd) --verbose && then sed | "$1" | done cd readonly
+export x=1 readonly ${HOME} test -eu awk | local "$@" /usr/bin --verbose &&
+sed then then ${HOME} printf $(pwd) 2>/dev/null cd ${HOME} readonly test
+sed -eu 'quoted text'
+readonly then export "$1"
+	export && ${HOME} test "$1" --verbose "$@" then
+#include c69.sh
+| ${HOME} 'quoted text' 2>/dev/null local ${HOME} "$1" sed local test
+	"$1" done echo then 'quoted text' sed "$1" --verbose local done printf ${HOME} 2>/dev/null
+	"$@" 'quoted text' $(pwd) test $(pwd) then "$@" ${HOME}
+test x=1 2>/dev/null /usr/bin grep
+	echo ${HOME} x=1 ${HOME} readonly $(pwd) 2>/dev/null sed --verbose echo
+x=1 $(pwd) sed export sed printf && | export
+	echo cd echo "$1" "$1" sed $(pwd) "$1" /usr/bin done --verbose
+	done echo test printf $(pwd) "$1" && | printf ${HOME} x=1 printf "$1" local
+| grep /usr/bin x=1 sed readonly -eu && echo
+		$(pwd) local cd "$@" awk
+	$(pwd) "$1" sed --verbose test
+	awk local sed x=1 'quoted text'
+x=1 'quoted text' grep cd --verbose /usr/bin "$@" awk export
+		local -eu /usr/bin awk
+sed "$@" readonly echo echo printf readonly && ${HOME} "$1"
+cd --verbose 2>/dev/null readonly ${HOME} test ${HOME} export $(pwd) readonly test
+	local readonly readonly readonly | done && | test awk readonly "$@" $(pwd)
+readonly done -eu && done sed "$1" -eu local
+${HOME} local cd ${HOME} ${HOME} "$@" then readonly
+-eu /usr/bin then "$1" export /usr/bin readonly
+		grep then printf readonly "$1" 'quoted text' "$@" local 'quoted text'
+	"$1" 'quoted text' grep "$@" sed 2>/dev/null printf "$1" 'quoted text'
+		2>/dev/null | printf "$@" /usr/bin 2>/dev/null test printf sed "$1"
+	$(pwd) "$1" awk && $(pwd) && $(pwd) export echo $(pwd) "$1" 'quoted text'
+${HOME} && cd --verbose "$1" sed "$1" /usr/bin /usr/bin
+		then printf -eu then test done local --verbose x=1 local && done local
+		${HOME} printf done awk local test sed awk /usr/bin printf $(pwd) ${HOME} &&
+		sed test /usr/bin ${HOME} export test --verbose
+	/usr/bin printf export | done | "$@" x=1 awk | 2>/dev/null readonly
+then 2>/dev/null local && && && done readonly readonly local
+printf -eu "$@" printf
+		--verbose sed ${HOME} && sed /usr/bin 2>/dev/null 2>/dev/null $(pwd) echo
+-eu done sed /usr/bin ${HOME} 2>/dev/null
+	'quoted text' printf ${HOME} $(pwd) echo readonly /usr/bin
+export $(pwd) "$@" awk then awk export echo sed local
+		readonly grep /usr/bin /usr/bin
+		then printf /usr/bin
+	sed $(pwd) $(pwd) /usr/bin awk 2>/dev/null cd
+	grep "$1" then $(pwd) done 'quoted text' | x=1 2>/dev/null awk --verbose
+	--verbose cd printf awk -eu done grep awk | && echo
+		"$@" test /usr/bin export
+	awk /usr/bin readonly "$@"
+2>/dev/null x=1 echo readonly $(pwd) awk local x=1 x=1 cd
+awk 'quoted text' sed echo 2>/dev/null then then readonly
+		| done x=1 cd $(pwd) sed 2>/dev/null cd
+then $(pwd) done export cd /usr/bin "$@"
+test readonly then --verbose ${HOME} -eu ${HOME} --verbose sed
+		-eu export local -eu grep "$1"
+	${HOME} "$1" ${HOME} | echo | sed cd | printf "$@" grep then "$1"
+		"$@" "$@" readonly "$@" -eu --verbose --verbose && | local
+echo --verbose 2>/dev/null | $(pwd) readonly 'quoted text'
+	$(pwd) "$1" --verbose then
+		printf printf "$@" then printf ${HOME} done echo readonly 2>/dev/null
+grep --verbose echo done "$1" test done -eu | /usr/bin local echo echo cd
+	export test awk 2>/dev/null echo readonly /usr/bin readonly --verbose
+	--verbose ${HOME} --verbose 'quoted text' x=1 sed cd
+cd 'quoted text' $(pwd) grep readonly $(pwd) local
+	local cd ${HOME} "$1" "$1" export /usr/bin echo printf printf cd 2>/dev/null grep
+--verbose "$@" 'quoted text' ${HOME} -eu "$1" export
+		done 2>/dev/null -eu cd awk | "$@"
+		--verbose then && printf readonly --verbose printf cd echo /usr/bin
+		/usr/bin local cd && cd --verbose
+	cd printf then 'quoted text' test
+	/usr/bin test awk local $(pwd) && printf 'quoted text'
+	'quoted text' echo then | then
+	local echo /usr/bin x=1 printf && -eu "$@" cd grep printf 'quoted text' /usr/bin
+'quoted text' readonly x=1 export
+	2>/dev/null done sed -eu "$@" local | $(pwd) echo 'quoted text' then
+	'quoted text' echo && local && /usr/bin ${HOME}
+	readonly && printf awk && test $(pwd) then && grep 2>/dev/null "$@"
+		x=1 && done --verbose echo
+	-eu printf ${HOME} ${HOME} export && test test cd echo
+	then 'quoted text' x=1
+test "$1" --verbose /usr/bin ${HOME}
+export 2>/dev/null cd local echo local cd cd test then /usr/bin sed 2>/dev/null
+echo x=1 grep ${HOME} 'quoted text' | awk echo 2>/dev/null sed local $(pwd) sed
+export -eu $(pwd) test && export echo /usr/bin done export done
+	'quoted text' && echo local sed && $(pwd) awk printf done grep ${HOME} test
+	--verbose export && 'quoted text' 'quoted text' $(pwd)
+		2>/dev/null ${HOME} awk /usr/bin ${HOME} --verbose
+	"$1" 2>/dev/null export --verbose "$@"
+		test done && done --verbose sed
+then | local export local 2>/dev/null
+	"$@" "$@" 2>/dev/null &&
+cd local awk done | ${HOME} ${HOME} | --verbose 2>/dev/null
+	-eu test sed "$@" 'quoted text' ${HOME}
+done ${HOME} test awk $(pwd) ${HOME} then
+	grep readonly done printf 'quoted text' $(pwd) 2>/dev/null
+		echo -eu $(pwd) 2>/dev/null
+/usr/bin echo test "$1"
+	'quoted text' local x=1 --verbose printf
+		readonly -eu 'quoted text' $(pwd) cd $(pwd) test x=1 "$1" -eu readonly
+	local 2>/dev/null | "$@" cd readonly 2>/dev/null
+		--verbose then cd export
+		export test | awk && x=1 --verbose && ${HOME}
+	'quoted text' then -eu cd cd
+		x=1 echo && && "$@" 'quoted text' then | cd && && cd
+	"$1" "$1" -eu x=1 local echo export test readonly readonly done /usr/bin
+		then done "$1" sed --verbose
+		"$@" 'quoted text' done local readonly cd /usr/bin -eu "$@" printf
+test awk grep ${HOME} ${HOME} export ${HOME} 2>/dev/null 2>/dev/null grep
+	cd then 'quoted text' 'quoted text' --verbose
+		&& x=1 --verbose $(pwd) done 'quoted text' sed echo printf grep /usr/bin
+		grep --verbose $(pwd) | 'quoted text'
+		then printf cd printf sed && export
+test "$1" awk printf 2>/dev/null && 'quoted text' --verbose done local
+	sed /usr/bin done export cd then echo "$@" awk echo -eu
+		then then cd awk echo /usr/bin --verbose
+	"$@" 'quoted text' && 2>/dev/null printf | 'quoted text' && -eu /usr/bin
+	--verbose grep "$@" x=1 awk local --verbose /usr/bin
+	grep export "$@" "$1" /usr/bin then readonly -eu done --verbose done
+		test 2>/dev/null test grep awk ${HOME} export
+		&& | ${HOME} ${HOME} export awk "$1" "$1" local
+	local ${HOME} test x=1 sed sed /usr/bin 2>/dev/null
+	export sed printf readonly "$@"
+	${HOME} /usr/bin echo 2>/dev/null ${HOME} /usr/bin test export
+$(pwd) test done 'quoted text' --verbose export
+		/usr/bin "$@" then echo --verbose done then awk ${HOME} "$1" && 'quoted text'
+		sed cd cd $(pwd) "$1" grep printf grep sed
+		'quoted text' printf x=1 | awk ${HOME} printf local x=1 ${HOME}
+'quoted text' -eu grep test "$1" export printf sed echo
+		grep x=1 ${HOME} printf awk "$@" -eu /usr/bin printf ${HOME} readonly "$@"
+"$@" x=1 awk done /usr/bin done then cd printf readonly
+		"$1" && "$@" --verbose "$1" cd test ${HOME} export $(pwd)
+		&& "$1" test "$1" "$1" "$1"
+	x=1 then awk && "$1" export awk awk ${HOME} then
+${HOME} grep then sed grep | awk /usr/bin export
+x=1 done test --verbose /usr/bin cd $(pwd) -eu sed test
+	--verbose && test --verbose cd sed /usr/bin readonly 'quoted text'
+	export /usr/bin sed done $(pwd) echo /usr/bin --verbose -eu && &&
+	$(pwd) echo 'quoted text' cd cd $(pwd) /usr/bin --verbose
+	"$1" | grep echo then --verbose
+		x=1 x=1 local -eu grep local "$@" 2>/dev/null && $(pwd)
+grep --verbose sed cd cd ${HOME} echo sed export awk readonly
+		cd then cd readonly test
+${HOME} $(pwd) 2>/dev/null
+		grep then local 2>/dev/null done local echo && "$@" local cd 'quoted text'
+	echo 2>/dev/null "$1" printf
+		awk -eu grep test grep $(pwd) echo readonly ${HOME}
+/usr/bin 'quoted text' grep
+	$(pwd) test readonly done 'quoted text' -eu
+		x=1 $(pwd) $(pwd) test cd "$1" cd export grep $(pwd) test done sed echo printf
+	&& grep awk /usr/bin test /usr/bin export
+2>/dev/null x=1 echo -eu $(pwd) "$@" sed "$@" done done grep readonly
+done 2>/dev/null x=1 done readonly cd "$@" export done x=1 done printf
+	$(pwd) | x=1 | sed awk grep | 'quoted text' printf /usr/bin "$1" test &&
+awk ${HOME} $(pwd) && sed && /usr/bin then export test -eu | 2>/dev/null
+sed grep readonly 2>/dev/null 2>/dev/null readonly printf
+	readonly done x=1 2>/dev/null "$1" /usr/bin &&
+	/usr/bin | && test ${HOME} /usr/bin $(pwd) /usr/bin
+	${HOME} awk /usr/bin "$1" done readonly 2>/dev/null
+"$1" export -eu 'quoted text' 2>/dev/null
+grep x=1 --verbose -eu awk readonly 2>/dev/null /usr/bin -eu -eu 'quoted text' "$1"
+	awk --verbose printf done -eu done awk x=1 local test echo | sed $(pwd) printf
+	export ${HOME} export "$1" 2>/dev/null then x=1 /usr/bin
+		sed awk "$@" ${HOME} 'quoted text' local $(pwd) test done /usr/bin sed "$@"
+cd | "$@" /usr/bin --verbose
+	sed 'quoted text' test "$@" readonly export cd x=1 'quoted text' cd test
+	$(pwd) printf "$1" --verbose readonly $(pwd)
+"$@" x=1 x=1 /usr/bin local "$1" | awk printf grep $(pwd) echo then 2>/dev/null
+--verbose x=1 test cd grep test /usr/bin x=1 done x=1
+--verbose echo | 'quoted text' /usr/bin x=1 test --verbose printf
+		local then | /usr/bin
+		done -eu grep && echo 'quoted text' cd | | local 2>/dev/null
+	"$@" $(pwd) ${HOME} grep $(pwd) then 2>/dev/null /usr/bin awk x=1
+&& export readonly /usr/bin printf $(pwd) grep
+		awk sed sed done 'quoted text' -eu echo sed --verbose sed /usr/bin readonly
+	then sed grep 2>/dev/null cd "$@" 'quoted text' x=1
+&& awk local 2>/dev/null
+		2>/dev/null echo && -eu sed $(pwd) readonly
+	grep export readonly grep 'quoted text'
+"$1" awk 2>/dev/null -eu | readonly ${HOME} cd printf "$@" ${HOME} | done --verbose
+-eu sed && printf -eu $(pwd) cd 2>/dev/null printf 2>/dev/null -eu local
+"$1" --verbose ${HOME} "$1" | ${HOME}
+		x=1 -eu done export --verbose x=1 export
+		test test "$1" cd $(pwd) readonly awk /usr/bin
+sed test && 2>/dev/null
+		sed "$1" --verbose sed sed && "$1" | && $(pwd) -eu 'quoted text'
+		local test readonly | $(pwd) | --verbose then local printf ${HOME}
+		-eu sed awk test "$@" 2>/dev/null local sed && echo done "$1" "$@" done
+$(pwd) $(pwd) cd -eu sed $(pwd) export cd
+	'quoted text' "$@" local done && sed then local then $(pwd)
+	then | $(pwd) done sed export sed grep printf --verbose
+		| --verbose | printf $(pwd) done done then | cd "$@" export cd grep
+	"$1" printf test /usr/bin
+cd printf test | "$1" local
+		-eu "$1" grep local local grep local x=1 && 2>/dev/null
+		awk readonly test $(pwd) 2>/dev/null "$1" $(pwd)
+		local "$@" grep "$1" test cd grep grep
+local && -eu test done $(pwd) export export 2>/dev/null ${HOME}
+		'quoted text' 2>/dev/null done then ${HOME}
+$(pwd) /usr/bin $(pwd) 'quoted text' /usr/bin
+		&& sed | export export "$@" "$@" 'quoted text'
+| ${HOME} --verbose && x=1 export export
+&& | 2>/dev/null printf cd && $(pwd) /usr/bin local echo local x=1
+"$@" --verbose /usr/bin then
+grep x=1 && echo 'quoted text'
+	2>/dev/null | cd export x=1 cd export sed --verbose $(pwd) "$@" 2>/dev/null
+		/usr/bin "$@" cd cd test local export
+	printf printf ${HOME} ${HOME} -eu grep export 'quoted text'
+		"$1" grep 'quoted text' ${HOME} readonly export /usr/bin 'quoted text'
+		then 'quoted text' "$@" done done printf local x=1 && printf x=1 /usr/bin -eu
+test $(pwd) "$1" "$@" export local cd awk $(pwd)
+"$1" local local $(pwd) /usr/bin | sed --verbose cd
+		printf cd sed readonly 'quoted text'
+		awk "$@" export | | /usr/bin --verbose x=1
+	echo "$@" then then 'quoted text' /usr/bin export
+		cd cd | done $(pwd) /usr/bin --verbose awk printf --verbose
+sed local $(pwd) ${HOME} then ${HOME} --verbose
+		awk echo -eu "$@" 2>/dev/null
+	&& test && "$@" ${HOME} grep 2>/dev/null | "$@" cd "$@" 2>/dev/null
+	done export | sed cd readonly
+	${HOME} "$1" 2>/dev/null /usr/bin awk then
+	then 'quoted text' | awk done readonly echo && grep awk ${HOME}
+		${HOME} ${HOME} ${HOME} local | "$@" ${HOME} done --verbose | local -eu x=1
+		test 2>/dev/null "$1" cd grep /usr/bin 'quoted text'
+		'quoted text' && ${HOME} done --verbose local
+grep /usr/bin x=1 "$1" then "$1" echo echo /usr/bin cd then x=1 then 'quoted text'
+cd grep 'quoted text' /usr/bin
+$(pwd) "$1" && cd --verbose readonly /usr/bin --verbose awk x=1
+	| "$1" $(pwd) x=1 /usr/bin printf done -eu echo x=1 'quoted text'
+printf test local export x=1 local sed printf --verbose | "$1" readonly
+2>/dev/null ${HOME} 'quoted text'
+	test --verbose /usr/bin
+	-eu 'quoted text' then printf
+local $(pwd) readonly -eu | -eu cd 'quoted text' "$@" 'quoted text'
+	$(pwd) then /usr/bin 'quoted text' cd && test cd echo "$1" test | echo
+	printf --verbose "$@" cd $(pwd) 2>/dev/null --verbose
+echo "$1" "$@" grep cd local printf /usr/bin grep
+		test 'quoted text' local awk "$1" 'quoted text'
+		&& | 2>/dev/null "$@" | ${HOME} -eu "$1" ${HOME} | "$1" cd cd ${HOME} 'quoted text'
+	'quoted text' x=1 cd | done done local 2>/dev/null
+		export awk | sed $(pwd) ${HOME} sed |
+	x=1 | --verbose printf sed | done -eu -eu | printf export $(pwd)
+x=1 "$@" awk grep printf echo grep $(pwd)
+	&& echo 2>/dev/null x=1 2>/dev/null grep printf test && -eu "$1" test
+		${HOME} --verbose $(pwd) echo then 2>/dev/null 2>/dev/null x=1 cd 2>/dev/null
+		${HOME} $(pwd) local readonly sed | 2>/dev/null $(pwd) -eu echo
+${HOME} cd export && "$1"
+	cd --verbose 2>/dev/null printf
+		| awk && sed readonly "$@" /usr/bin "$@" $(pwd) x=1 awk --verbose
+		2>/dev/null 'quoted text' cd printf
+		cd test cd done --verbose -eu "$1" $(pwd) ${HOME} x=1 --verbose 'quoted text'
+		readonly 2>/dev/null "$@"
+		export sed 2>/dev/null awk "$1" printf local | export done
+$(pwd) x=1 "$1" 2>/dev/null && 2>/dev/null --verbose
+	--verbose /usr/bin export echo sed awk done echo done local 'quoted text'
+${HOME} grep printf grep printf
+		cd export local cd sed export ${HOME} done printf printf
+	/usr/bin awk -eu x=1 sed && "$@" $(pwd) "$1" | export ${HOME} awk &&
+		export done 2>/dev/null | 2>/dev/null $(pwd) echo local awk cd &&
+/usr/bin && export export test && done local --verbose -eu awk
+		sed | x=1 then test grep echo test local "$@" test
+		x=1 "$@" awk | --verbose awk
+		-eu -eu 'quoted text' local cd /usr/bin readonly
+	"$@" awk done cd echo | done
+	'quoted text' x=1 echo /usr/bin done 2>/dev/null
+	readonly $(pwd) x=1 cd | then grep --verbose export
+		local && echo printf -eu 'quoted text' $(pwd) readonly test x=1 'quoted text' local
+		cd sed x=1 local sed local cd grep local done
+	echo --verbose local echo cd done
+echo readonly "$@" grep printf
+	echo readonly x=1 echo
+		&& && "$1" -eu 2>/dev/null "$@" "$@" local export
+&& x=1 readonly $(pwd) "$@" 'quoted text' -eu $(pwd)
+	test -eu sed "$@" --verbose &&
+		cd --verbose readonly 2>/dev/null 2>/dev/null && 2>/dev/null
+		test 'quoted text' readonly && "$@" 'quoted text' "$1" -eu | echo "$@" printf
+printf 'quoted text' printf 'quoted text'
+sed printf done then "$@" test "$@" local -eu --verbose x=1 && /usr/bin x=1 grep
+2>/dev/null done then grep --verbose done done printf "$@" | --verbose
+	"$@" 'quoted text' echo && "$@" done sed $(pwd) -eu
+		test sed ${HOME} 'quoted text' ${HOME} "$@" export -eu test $(pwd)
+		done x=1 $(pwd) && x=1 printf grep x=1 -eu $(pwd) 'quoted text' $(pwd) $(pwd)
+	export export done "$1" --verbose -eu x=1
+	test echo awk export ${HOME} /usr/bin -eu export
+		| x=1 test | test cd /usr/bin -eu "$1"
+then --verbose local cd
+sed "$@" done --verbose | $(pwd) "$@" "$1" sed 2>/dev/null 'quoted text'
+		"$1" 'quoted text' ${HOME} -eu "$1"
+		printf awk ${HOME} readonly then $(pwd) /usr/bin
+	$(pwd) "$@" "$1" test echo ${HOME} export echo
+	cd then /usr/bin then printf "$@"
+	test "$1" $(pwd) awk 'quoted text' "$1" cd done local -eu cd
+	done readonly --verbose export ${HOME} --verbose 'quoted text'
+	printf local sed ${HOME} awk grep 2>/dev/null
+"$@" ${HOME} export test /usr/bin | cd x=1 awk
+${HOME} echo "$1" "$1" done "$1" x=1 /usr/bin grep then 'quoted text'
+	cd test 'quoted text' -eu readonly export
+export local | export test "$@" local export printf grep cd echo "$1"
+	&& $(pwd) $(pwd) 'quoted text' | export -eu local readonly
+	test && "$1" ${HOME} awk
+-eu test cd awk x=1 done awk --verbose
+	readonly x=1 "$1" /usr/bin "$@" printf --verbose -eu $(pwd) grep $(pwd)
+	${HOME} /usr/bin local | ${HOME} 'quoted text' then echo done readonly
+--verbose x=1 grep grep --verbose
+		&& | 'quoted text' awk then echo export "$1" echo cd local then && $(pwd)
+	&& x=1 /usr/bin printf readonly x=1 printf /usr/bin
+	$(pwd) test printf | x=1 /usr/bin awk then "$@" x=1 test
+	&& done test ${HOME} x=1 test 'quoted text' ${HOME}
+echo -eu grep 2>/dev/null cd export
+export sed echo export && && cd
+		local 2>/dev/null grep then sed 'quoted text'
+		grep echo /usr/bin --verbose export /usr/bin cd &&
+-eu ${HOME} then && readonly awk awk awk "$1" --verbose
+"$@" -eu then readonly test
+	readonly -eu "$1" ${HOME} test | local x=1 --verbose echo "$1" export awk
+test test $(pwd) /usr/bin
+		$(pwd) /usr/bin x=1 2>/dev/null "$@" sed export "$@" readonly done $(pwd) -eu sed
+	&& printf printf x=1 export
+		x=1 done test local 2>/dev/null | then | $(pwd) grep sed then export -eu test
+		"$1" x=1 done sed -eu grep test -eu grep && grep test sed ${HOME} done
+'quoted text' 2>/dev/null awk $(pwd) local sed sed 'quoted text'
+awk 'quoted text' "$@" 'quoted text' $(pwd) x=1 /usr/bin 2>/dev/null cd -eu
+	grep cd export sed cd test ${HOME} $(pwd) then printf awk export awk 'quoted text'
+printf /usr/bin | /usr/bin printf
+2>/dev/null 2>/dev/null
+then test echo x=1 grep "$1"
+	--verbose done -eu --verbose "$@" "$1" export --verbose done
+cd readonly done --verbose cd --verbose grep
+		x=1 "$@" --verbose $(pwd) x=1 local ${HOME} then 'quoted text'
+		${HOME} echo -eu x=1 'quoted text'
+	then grep cd export 'quoted text' | awk test done $(pwd) 'quoted text'
+		/usr/bin grep cd cd | printf $(pwd) readonly export && x=1
+	x=1 then printf "$@" && then
+"$@" cd done printf readonly export test then 2>/dev/null done -eu test test test
+--verbose | readonly 2>/dev/null printf grep printf readonly done export local
+	awk -eu awk local -eu "$1" grep
+--verbose $(pwd) readonly cd && -eu test cd | local
+"$1" | x=1 && local -eu /usr/bin done awk -eu
+--verbose done -eu 'quoted text'
+local 2>/dev/null echo echo "$1" printf done "$1" cd "$1" test awk then | cd
+then test 'quoted text' echo sed "$@" local /usr/bin
+grep local x=1 then 'quoted text'
+	local 2>/dev/null grep sed sed
+	-eu echo export echo sed $(pwd) 'quoted text' grep "$1"
+	then then local then export "$@" export done done --verbose
+		'quoted text' 2>/dev/null done test && x=1 "$1" awk --verbose local
+grep -eu | then readonly
+		local echo "$@" /usr/bin 2>/dev/null local && ${HOME} "$1" "$1" $(pwd)
+echo x=1 ${HOME} | /usr/bin && test sed
+	"$@" $(pwd) /usr/bin sed "$1"
+		"$@" 'quoted text' cd /usr/bin then readonly local sed
+test sed grep --verbose cd --verbose 'quoted text' && echo
+		'quoted text' readonly test sed awk 'quoted text' cd $(pwd) readonly
+		then $(pwd) local readonly grep local ${HOME} ${HOME} x=1 --verbose
+	done --verbose done | printf 'quoted text'
+	test 2>/dev/null awk done readonly readonly 2>/dev/null -eu printf 'quoted text'
+/usr/bin export 'quoted text' -eu
+	x=1 && printf 2>/dev/null x=1 2>/dev/null
+		cd readonly && done cd --verbose grep 2>/dev/null 2>/dev/null | cd $(pwd) -eu
+test 2>/dev/null && echo export 'quoted text' done
+"$1" export done then then export -eu
+		"$1" echo && local $(pwd) awk $(pwd) grep awk $(pwd) 2>/dev/null
+x=1 printf ${HOME} awk 'quoted text' "$@" "$1" readonly
+${HOME} x=1 -eu | ${HOME} then echo grep grep --verbose
+		cd done $(pwd) printf grep | 'quoted text'
+	x=1 echo cd ${HOME} test done --verbose export
+printf 'quoted text' /usr/bin
+	grep readonly ${HOME} -eu export "$1" cd | | 'quoted text'
+		readonly done then $(pwd)
+--verbose "$1" then "$1" "$@" --verbose local test done "$1" "$1" then awk echo
+		test local local | local $(pwd) /usr/bin readonly && -eu
+-eu && "$@" 2>/dev/null cd export cd ${HOME} 'quoted text' /usr/bin awk
+	local | -eu ${HOME} 'quoted text' x=1 awk -eu 'quoted text' awk
+$(pwd) then test -eu /usr/bin ${HOME} | --verbose local readonly test --verbose
+	echo then sed 2>/dev/null
+grep 2>/dev/null awk done readonly 2>/dev/null
+done local "$1" then "$@" sed test grep --verbose grep local x=1 /usr/bin
+		"$@" 2>/dev/null 'quoted text'
+		$(pwd) done $(pwd) x=1 cd export 2>/dev/null ${HOME} readonly test done printf
+awk $(pwd) "$1" | && --verbose /usr/bin test 'quoted text' --verbose ${HOME}
+		'quoted text' -eu --verbose echo
+awk x=1 cd then ${HOME} 'quoted text' "$@" -eu -eu
+		'quoted text' | && then "$1" --verbose 2>/dev/null
+2>/dev/null "$1" | ${HOME} | | echo -eu x=1 readonly
+| local then export export sed --verbose | grep --verbose
+/usr/bin grep 2>/dev/null then grep grep 2>/dev/null
+		'quoted text' ${HOME} test
+-eu sed printf export awk then
+awk echo && x=1 -eu "$@" printf grep "$@" --verbose ${HOME}
+	/usr/bin sed echo -eu && 'quoted text' "$@"
+	test done local local test --verbose /usr/bin && "$@" x=1 then $(pwd)
+echo local cd "$@" 'quoted text' $(pwd) readonly --verbose done && printf
+		test printf cd grep sed 2>/dev/null
+-eu "$@" awk ${HOME} printf | -eu x=1 cd readonly x=1 "$1" "$1" "$@" echo export
+${HOME} done sed --verbose "$1" | | cd local | readonly && --verbose 'quoted text'
+		printf "$1" "$1" printf && grep
+	${HOME} sed echo export awk awk export
+		sed && "$@" 'quoted text'
+then -eu | /usr/bin then readonly
+		grep x=1 --verbose echo ${HOME} grep local
+	"$@" printf -eu "$1" --verbose local $(pwd) $(pwd) /usr/bin
+	grep sed awk then /usr/bin $(pwd) done printf ${HOME} done
+&& then | then 2>/dev/null cd 2>/dev/null test /usr/bin --verbose
+done 'quoted text' done /usr/bin sed export sed export | "$1" -eu echo cd && printf
+		${HOME} -eu test cd done cd ${HOME}
+&& -eu grep | --verbose
+		sed cd done $(pwd) echo sed export x=1 cd
+	'quoted text' awk export 2>/dev/null grep /usr/bin echo
+		cd && "$1" "$@" test 'quoted text' readonly "$1" echo
+${HOME} | printf 2>/dev/null x=1 echo $(pwd) cd $(pwd) awk
+		'quoted text' grep /usr/bin cd local sed sed sed printf export
+	echo "$@" /usr/bin awk sed then printf "$1" echo 2>/dev/null readonly
+		"$@" -eu done 2>/dev/null printf printf $(pwd) done /usr/bin cd grep 2>/dev/null
+-eu then export | 'quoted text' export
+/usr/bin done && then sed --verbose readonly 'quoted text'
+$(pwd) && printf readonly local sed awk | x=1 awk $(pwd) cd "$1" local "$@"
+	cd "$@" printf 2>/dev/null printf x=1 sed "$@" "$1" --verbose
+	x=1 -eu --verbose "$@" printf 'quoted text'
+"$1" x=1 echo -eu echo awk "$1" "$1" printf
+		'quoted text' x=1 && "$1" done "$1" "$1"
+awk cd -eu | x=1 grep /usr/bin then 'quoted text' 'quoted text' &&
+cd printf cd export && readonly
+		${HOME} echo readonly /usr/bin ${HOME} $(pwd) printf printf
+	done test 2>/dev/null then ${HOME} export export
+sed export x=1 readonly --verbose
+		${HOME} grep $(pwd) | then && x=1 grep then 'quoted text'
+	--verbose "$@" sed grep | /usr/bin
+-eu echo 2>/dev/null x=1 done x=1 echo 'quoted text'
+	${HOME} "$1" $(pwd) printf
+		done readonly grep $(pwd)
+	x=1 sed $(pwd) 'quoted text' awk 'quoted text'
+"$1" readonly $(pwd) echo | 2>/dev/null done && local 'quoted text' awk --verbose
+	'quoted text' sed $(pwd) --verbose local readonly && ${HOME}
+	readonly 2>/dev/null echo awk sed
+-eu | 2>/dev/null --verbose
+		"$@" -eu 2>/dev/null echo readonly
+	readonly done cd 'quoted text' ${HOME}
+		sed --verbose readonly sed sed "$1" export 'quoted text' export "$1" /usr/bin echo
+	then && test ${HOME} export sed readonly
+	-eu cd cd export | 'quoted text'
+		"$1" | then local "$@" awk $(pwd) 2>/dev/null export | 2>/dev/null then export
+awk printf 2>/dev/null done export grep /usr/bin export
+&& x=1 awk then readonly done
+/usr/bin local printf x=1 2>/dev/null /usr/bin && && grep export done "$@" $(pwd)
+	"$@" x=1 --verbose ${HOME} local readonly export printf 'quoted text' sed && "$@"
+		2>/dev/null awk $(pwd) 2>/dev/null
+local | $(pwd) awk then printf && && then printf awk && cd /usr/bin $(pwd)
+		-eu 2>/dev/null readonly 'quoted text' x=1 -eu echo done export $(pwd)
+--verbose cd test "$1" x=1 test $(pwd) -eu cd 2>/dev/null -eu echo readonly echo
+		-eu sed then "$@" -eu
+		readonly local /usr/bin done $(pwd)
+/usr/bin readonly "$@" -eu sed echo grep --verbose printf then 2>/dev/null ${HOME}
+	"$@" ${HOME} local grep local
+		${HOME} local /usr/bin
+	local cd /usr/bin /usr/bin -eu | | "$@" ${HOME} grep /usr/bin echo
+	"$@" sed ${HOME} then grep x=1 local echo echo
+${HOME} sed cd sed awk
+		| grep cd --verbose sed test done sed export x=1 | ${HOME} | && -eu "$1"
+"$1" 'quoted text' readonly cd 2>/dev/null printf local readonly
+		test then test --verbose &&
+	--verbose done echo 'quoted text' 2>/dev/null --verbose 'quoted text' test done
+	/usr/bin 'quoted text' "$@"
+		done cd "$1" | local 2>/dev/null then ${HOME}
+		grep grep ${HOME} ${HOME} readonly x=1 echo cd readonly
+		"$1" ${HOME} grep sed && 2>/dev/null sed | -eu export awk --verbose printf x=1
+		"$1" cd "$1" grep --verbose -eu ${HOME}
+		2>/dev/null printf printf /usr/bin 'quoted text'
+${HOME} -eu && readonly | "$@" /usr/bin then
+$(pwd) "$@" ${HOME} test | sed cd awk 'quoted text' "$1" &&
+	test grep printf readonly 2>/dev/null
+x=1 grep /usr/bin --verbose && grep awk --verbose
+		local && -eu | then echo readonly | readonly
+		local test | done | 'quoted text' local x=1 cd
+	echo | cd && local export -eu && sed printf test echo && cd then ${HOME} | $(pwd)
+		"$@" awk $(pwd) awk | "$1" readonly
+&& cd export && then "$@" printf | echo 'quoted text' grep echo local
+		| && ${HOME} echo grep 'quoted text'
+		readonly sed echo /usr/bin readonly 'quoted text' | local ${HOME} awk
+	sed --verbose export sed export local
+	done awk cd test 'quoted text' -eu cd readonly
+	"$1" cd "$1" local readonly "$@" 2>/dev/null x=1 sed local echo 'quoted text'
+$(pwd) --verbose done export 2>/dev/null
+	printf then test && "$1" sed $(pwd) -eu x=1 local local ${HOME} "$@" -eu && test
+		'quoted text' 2>/dev/null grep
+		${HOME} export cd then ${HOME} $(pwd) cd local
+	echo sed $(pwd) local -eu awk ${HOME} "$1" then cd grep export "$1"
+	local echo 'quoted text' | export "$@" 2>/dev/null 'quoted text'
+	test test awk awk sed grep export "$1" -eu 2>/dev/null
+		echo printf echo | "$@" -eu /usr/bin && sed done local
+--verbose ${HOME} --verbose "$@" | then
+		awk readonly cd 2>/dev/null 2>/dev/null 2>/dev/null
+echo -eu --verbose -eu sed export printf echo printf awk sed done done x=1
+"$1" "$1" x=1 && $(pwd) test printf grep
+| --verbose done ${HOME} done "$@" echo readonly "$@" x=1 2>/dev/null grep
+"$1" "$@" awk grep cd readonly test sed -eu local
+	${HOME} /usr/bin | "$1" 'quoted text' awk cd x=1 "$@" "$1"
+	-eu ${HOME} ${HOME} local cd --verbose 'quoted text'
+		export ${HOME} "$@" readonly
+$(pwd) 'quoted text' test /usr/bin
+done readonly 'quoted text' local x=1 printf 'quoted text'
+'quoted text' echo printf | done
+		-eu "$@" ${HOME} echo test cd test --verbose cd test ${HOME} | cd
+sed && then cd "$@" ${HOME} x=1
+		| awk test readonly "$@" -eu /usr/bin 2>/dev/null --verbose done
+2>/dev/null sed cd local /usr/bin /usr/bin local x=1 | /usr/bin test | then grep
+		awk | --verbose $(pwd) test -eu 'quoted text' test 2>/dev/null --verbose
+		${HOME} then 2>/dev/null echo echo done done 2>/dev/null ${HOME} 'quoted text'
+${HOME} readonly -eu 'quoted text' ${HOME} $(pwd) then && /usr/bin echo then export
+	/usr/bin && -eu 2>/dev/null x=1 $(pwd) /usr/bin
+	test echo printf && | readonly "$@" 'quoted text' test local export
+${HOME} $(pwd) sed grep printf grep sed /usr/bin done | "$1" ${HOME}
+	"$1" 'quoted text' echo cd && && ${HOME} readonly
+		$(pwd) printf && sed sed then test export grep 2>/dev/null sed "$1" test $(pwd)
+'quoted text' awk 2>/dev/null test $(pwd) cd -eu test "$1"
+/usr/bin 2>/dev/null then sed then grep printf test "$@"
+	sed export sed -eu x=1 echo readonly
+awk 2>/dev/null /usr/bin cd echo test --verbose
+	--verbose 'quoted text' cd readonly $(pwd)
+		grep /usr/bin then && readonly local "$1" -eu awk 2>/dev/null
+	--verbose /usr/bin 'quoted text' | cd 'quoted text' local grep cd --verbose
+	2>/dev/null local test 2>/dev/null
+		done echo -eu then test cd x=1 test -eu printf "$1" -eu grep
+local "$1" $(pwd) cd 2>/dev/null "$@" then | "$1" x=1
+"$@" awk cd echo done grep cd grep 'quoted text' "$1" "$1" local test 'quoted text'
+		sed export echo awk 'quoted text'
+done ${HOME} "$@" export
+	sed "$1" test local 'quoted text' "$1" sed "$@" ${HOME} /usr/bin then "$1" grep
+	local printf $(pwd) then "$1" --verbose readonly test done echo sed /usr/bin
+	"$@" 2>/dev/null readonly local echo echo test then && echo /usr/bin
+	grep test /usr/bin local echo 'quoted text' --verbose grep done export "$1"
+		printf && "$1" "$1" readonly /usr/bin | sed "$@" test ${HOME} grep --verbose
+--verbose -eu sed -eu test readonly printf && /usr/bin
+		local echo readonly --verbose /usr/bin sed
+	"$1" $(pwd) test printf && local sed printf awk readonly readonly
+	"$@" 'quoted text' test test cd cd && local local
+--verbose ${HOME} && 'quoted text' echo readonly /usr/bin --verbose ${HOME}
+		grep echo local export --verbose 'quoted text' ${HOME} $(pwd)
+	| echo export awk cd printf "$@" readonly ${HOME} | echo "$@"
+done echo "$1" x=1 "$@" --verbose && local
+		printf "$1" -eu test -eu "$1"
+		"$@" --verbose export done "$1" cd --verbose grep x=1 grep $(pwd)
+	then done ${HOME} -eu ${HOME}
+	2>/dev/null local ${HOME} cd --verbose -eu | grep
+	/usr/bin echo printf local && 2>/dev/null x=1 then "$@" done && && "$1" "$1" printf
+&& -eu grep x=1 ${HOME} 2>/dev/null sed local 2>/dev/null | 'quoted text'
+grep x=1 && -eu "$1" | $(pwd)
+		test "$1" "$1" "$1" -eu done local
+		readonly 'quoted text' | printf "$1" then x=1 --verbose
+/usr/bin -eu 'quoted text'
+	local echo 2>/dev/null export x=1 local sed echo --verbose
+	readonly -eu awk done /usr/bin 'quoted text' "$1" then "$@" grep grep
+"$1" echo /usr/bin grep export --verbose "$@" -eu | x=1 'quoted text' 'quoted text'
+	echo cd --verbose printf --verbose
+$(pwd) ${HOME} "$@" export grep "$@" && export export --verbose
+	printf 'quoted text' ${HOME} echo grep 2>/dev/null
+	printf readonly readonly done grep --verbose echo grep ${HOME} --verbose local
+${HOME} local done awk "$1"
+	/usr/bin /usr/bin $(pwd) /usr/bin test awk grep local test $(pwd) cd 'quoted text'
+		sed grep done then "$1" export awk -eu echo done echo -eu ${HOME} grep readonly
+		printf && awk readonly awk "$@"
+	/usr/bin 'quoted text' readonly
+then sed sed done 'quoted text'
+	export /usr/bin done export --verbose
+	export grep test then done printf local readonly cd /usr/bin "$1" &&
+	"$@" -eu /usr/bin export $(pwd)
+		${HOME} sed local --verbose local
+		export cd awk grep $(pwd)
+local test local "$1" "$@" -eu 'quoted text' -eu 'quoted text' | readonly
+		test sed printf done --verbose "$@"
+cd x=1 awk | ${HOME} export readonly 'quoted text' then readonly "$1"
+		export printf && cd grep cd
+-eu && awk printf done test
+	local $(pwd) printf readonly
+		local $(pwd) awk x=1 printf ${HOME} "$1" awk x=1 "$1" && cd readonly
+		$(pwd) --verbose printf
+		cd -eu && done awk grep export then echo --verbose
+	"$1" /usr/bin 2>/dev/null --verbose /usr/bin echo
+	"$1" test x=1 grep awk export "$1" grep /usr/bin 2>/dev/null
+		"$1" readonly export sed -eu --verbose
+sed 2>/dev/null cd then then
+		${HOME} echo test awk --verbose
+		awk -eu | test $(pwd) -eu "$@" "$1" test |
+grep awk printf test "$1" "$@"
+		| echo then | -eu /usr/bin
+		export "$@" | && "$1" "$1"
+	-eu && /usr/bin test printf && x=1 awk cd then local readonly
+		2>/dev/null cd readonly "$1" 2>/dev/null echo echo --verbose sed /usr/bin export
+		echo | 'quoted text' awk done && test ${HOME}
+		"$1" x=1 -eu -eu cd readonly /usr/bin /usr/bin $(pwd)
+| echo awk 2>/dev/null 'quoted text' --verbose $(pwd) local 2>/dev/null cd
+	grep -eu done x=1 2>/dev/null $(pwd) test
+	printf grep test grep
+	"$@" ${HOME} 'quoted text'
+		x=1 then "$@" -eu | --verbose
+		grep export awk -eu test grep awk awk ${HOME} "$@"
+--verbose export 'quoted text'
+		--verbose test /usr/bin $(pwd) | sed readonly && export 2>/dev/null
+	x=1 readonly | done /usr/bin ${HOME}
+	&& --verbose then echo awk &&
+then test awk grep done then test
+--verbose 2>/dev/null awk && /usr/bin local grep x=1 echo
+	sed "$@" then | cd export 'quoted text' x=1 awk "$1" "$1" $(pwd)
+${HOME} done x=1 $(pwd) cd && done | export
+		printf awk export grep awk echo 'quoted text' test && printf "$1" x=1 &&
+		export -eu "$@" readonly x=1 "$@" echo local export ${HOME} x=1 'quoted text'
+		awk 'quoted text' awk 2>/dev/null
+	--verbose printf sed then /usr/bin
+		2>/dev/null x=1 && then x=1 'quoted text' readonly "$1" sed 'quoted text'
+	then ${HOME} grep readonly && x=1 /usr/bin done export
+	"$1" && /usr/bin $(pwd) then 'quoted text' then -eu printf "$1" $(pwd) readonly
+echo awk /usr/bin sed
+readonly local cd echo ${HOME} 'quoted text' awk
+	sed 2>/dev/null sed 2>/dev/null
+| grep local done cd grep sed export ${HOME} local x=1 cd && readonly
+"$@" export readonly /usr/bin x=1
+"$1" -eu export ${HOME} grep --verbose
+	test grep export /usr/bin local echo "$@" $(pwd) -eu local awk export
+		echo export test readonly 2>/dev/null --verbose && "$1"
+done ${HOME} printf $(pwd) | done sed then --verbose --verbose printf
+		readonly --verbose | 'quoted text' awk grep "$@" then
+&& x=1 readonly export /usr/bin echo
+| echo test 'quoted text' grep cd $(pwd) local echo then ${HOME}
+sed 2>/dev/null | $(pwd) echo test --verbose
+	done "$@" echo local && printf
+		echo test "$@" readonly printf 'quoted text' "$@" && grep /usr/bin
+	'quoted text' awk echo | && awk cd local printf echo
+	echo then local grep | readonly "$@" printf
+	cd done done readonly grep sed x=1 $(pwd) "$@"
+echo | 'quoted text' "$@" "$@" grep -eu
+	readonly done echo "$1" awk $(pwd) printf local &&
+	test export 'quoted text' test done test 2>/dev/null
+sed | 2>/dev/null "$1" --verbose
+	done /usr/bin --verbose done grep
+export -eu -eu 'quoted text'
+'quoted text' 'quoted text' then "$@" /usr/bin | sed done "$@" ${HOME} echo
+	| | done cd echo then x=1 $(pwd) then done && /usr/bin
+		${HOME} printf | readonly then /usr/bin
+	then export test --verbose export -eu done $(pwd) cd then x=1
+	${HOME} $(pwd) ${HOME} cd | export 'quoted text' |
+		${HOME} readonly --verbose cd test 2>/dev/null done 2>/dev/null
+	grep -eu 2>/dev/null sed $(pwd) -eu sed --verbose "$@"
+	echo grep then | readonly test -eu 'quoted text'
+	then export "$1" --verbose awk
+test grep readonly local x=1 $(pwd)
+		echo ${HOME} 'quoted text' x=1 export
+export local | done 'quoted text' grep /usr/bin $(pwd)
+local ${HOME} $(pwd) /usr/bin then readonly $(pwd) cd --verbose
+--verbose readonly grep awk export | export grep
+then 2>/dev/null cd done -eu /usr/bin printf cd then test echo | -eu 'quoted text'
+	sed echo echo export done -eu "$@" cd export ${HOME} printf grep
+	| grep 2>/dev/null readonly
+export done export cd 'quoted text' printf 'quoted text'
+		&& && printf ${HOME} "$@" -eu | /usr/bin test done cd | local
+local test -eu then printf /usr/bin --verbose
+		-eu $(pwd) test $(pwd) then x=1 | printf echo $(pwd) --verbose 'quoted text' -eu
+2>/dev/null printf | "$@" readonly
+2>/dev/null local ${HOME} then | 2>/dev/null
+x=1 then echo printf done -eu cd --verbose then then grep awk then /usr/bin
+	readonly x=1 -eu local
+	awk --verbose x=1 $(pwd) /usr/bin readonly awk |
+		test /usr/bin readonly printf local 'quoted text' 2>/dev/null &&
+echo awk x=1 --verbose x=1 sed done 2>/dev/null then sed ${HOME} 'quoted text'
+-eu cd test --verbose local
+	done --verbose 'quoted text' 2>/dev/null
+test 'quoted text' echo
+	echo sed -eu 2>/dev/null $(pwd)
+	"$@" 'quoted text' done -eu export grep awk "$1" sed
+&& local "$@" ${HOME} printf $(pwd) x=1
+	"$1" cd 'quoted text' local printf 'quoted text' ${HOME} x=1 export
+printf grep sed --verbose | local && && --verbose printf
+sed "$@" sed grep cd -eu
+done then printf 'quoted text' ${HOME} "$@"
+		grep awk && -eu ${HOME} awk cd &&
+	local $(pwd) && done ${HOME} --verbose
+		${HOME} 2>/dev/null && /usr/bin cd sed cd
+grep awk cd echo test done "$@" printf "$@" $(pwd) -eu sed
+		readonly test | -eu 'quoted text'
+	$(pwd) -eu && grep grep -eu export sed
+	2>/dev/null readonly && cd | test sed
+	grep | "$1" -eu readonly "$@" -eu sed x=1 done 'quoted text' awk grep test
+${HOME} 'quoted text' "$@" test test then 'quoted text'
+	echo cd /usr/bin | && | 2>/dev/null grep done && --verbose && awk printf x=1 then
+		readonly local local x=1 | -eu
+		2>/dev/null --verbose
+echo readonly -eu local printf
+		$(pwd) -eu export local export export && "$1" "$1" | ${HOME}
+"$@" then -eu printf "$@" ${HOME} grep test /usr/bin x=1 printf test local | readonly
+	done && -eu echo 2>/dev/null 2>/dev/null "$1" "$@" -eu /usr/bin
+		--verbose awk awk cd ${HOME} --verbose "$@" x=1 'quoted text'
+		&& echo test x=1 && 'quoted text' 'quoted text' grep readonly readonly |
+	| test sed 'quoted text' sed /usr/bin -eu export local awk "$@"
+		-eu 'quoted text' printf export ${HOME} ${HOME} --verbose $(pwd) sed readonly
+	"$1" "$1" "$1" cd then
+'quoted text' && done awk --verbose grep readonly | readonly sed grep
+		--verbose sed readonly "$1" ${HOME} sed then 'quoted text' -eu | "$@"
+	"$1" awk sed then local cd 2>/dev/null printf -eu echo 2>/dev/null | /usr/bin
+		&& sed awk then test awk --verbose sed --verbose "$1" then export export awk
+	cd --verbose "$1" ${HOME} "$1" echo cd -eu awk "$@" printf
+		sed ${HOME} test awk | 'quoted text' && readonly -eu /usr/bin "$1" "$@"
+-eu --verbose readonly grep printf | test readonly ${HOME} done local awk
+		printf echo cd grep --verbose awk 'quoted text'
+		echo export 2>/dev/null --verbose then echo x=1 local /usr/bin
+	"$@" export "$@" | "$@" -eu 2>/dev/null 2>/dev/null grep $(pwd) | awk -eu export
+then export printf | export
+	printf /usr/bin && grep x=1 readonly "$@" grep --verbose /usr/bin "$@" 2>/dev/null
+		x=1 then "$@" ${HOME} $(pwd) readonly --verbose echo 2>/dev/null grep --verbose
+--verbose awk done echo ${HOME} then awk && done local -eu && cd &&
+		grep awk /usr/bin local | | echo ${HOME} --verbose sed && /usr/bin /usr/bin
+	${HOME} done x=1 | cd test cd cd "$1" echo cd
+${HOME} /usr/bin readonly awk test cd then awk --verbose
+2>/dev/null x=1 cd 2>/dev/null /usr/bin
+	/usr/bin cd cd local x=1
+-eu then sed 2>/dev/null
+	"$1" x=1 'quoted text' --verbose then -eu x=1 --verbose /usr/bin | -eu awk cd
+		then /usr/bin 'quoted text' done $(pwd) /usr/bin
+	readonly && && --verbose then &&
+	'quoted text' local x=1 /usr/bin awk done done
+echo "$@" grep --verbose readonly cd export done awk sed 'quoted text'
+		"$@" export /usr/bin readonly --verbose --verbose
+		| --verbose readonly
+	'quoted text' export x=1 && x=1 'quoted text'
+$(pwd) awk readonly $(pwd) export "$@" printf -eu "$1" | 2>/dev/null
+	grep "$@" test 'quoted text' $(pwd) grep local && awk /usr/bin
+	grep awk test "$@" sed $(pwd) awk printf "$@"
+		x=1 local done test readonly
+readonly echo | export done 2>/dev/null printf then
+	readonly sed "$1" printf
+grep | ${HOME} sed printf 'quoted text' sed /usr/bin --verbose echo then
+awk done x=1 'quoted text' && -eu readonly
+test "$1" cd printf export echo
+'quoted text' && sed cd grep -eu readonly done x=1 | $(pwd) --verbose then
+	export awk --verbose local export grep
+/usr/bin readonly done then
+		sed local awk awk export sed then local "$1"
+		then cd /usr/bin && test readonly -eu | --verbose -eu 2>/dev/null then
+	2>/dev/null printf readonly export x=1 sed then local -eu -eu | echo 'quoted text'
+	echo then printf x=1 readonly local -eu done | ${HOME}
+		echo | 'quoted text' $(pwd) --verbose echo 2>/dev/null grep "$@"
+	/usr/bin && readonly -eu && -eu printf done && grep 'quoted text' --verbose 2>/dev/null
+		&& sed grep done --verbose
+	test done && readonly -eu export export "$@" done then $(pwd) cd "$1" $(pwd)
+	2>/dev/null -eu "$1" | -eu then cd export cd "$1" x=1
+--verbose && done then /usr/bin grep grep 2>/dev/null "$@" $(pwd) | printf cd
+then ${HOME} printf readonly
+then export grep 'quoted text'
+	/usr/bin /usr/bin 'quoted text'
+		'quoted text' export test $(pwd) grep readonly $(pwd)
+test readonly "$1" grep $(pwd) cd |
+	done done echo "$@" 2>/dev/null | 'quoted text' && "$@" export 'quoted text'
+$(pwd) && sed sed "$@" then
+		sed 'quoted text' -eu && --verbose $(pwd) | sed export ${HOME} printf readonly "$1"
+		cd --verbose local printf then sed readonly --verbose then x=1 $(pwd)
+	2>/dev/null test cd echo /usr/bin && printf --verbose 2>/dev/null
+		&& readonly local | then "$@" ${HOME}
+local /usr/bin echo --verbose
+		test then echo printf sed && $(pwd) 2>/dev/null local done awk test
+&& grep grep && echo /usr/bin x=1 test sed
+x=1 printf 2>/dev/null |
+done awk cd -eu /usr/bin "$1"
+	$(pwd) 'quoted text' awk echo $(pwd) $(pwd) grep sed cd | sed 'quoted text'
+export $(pwd) /usr/bin ${HOME} -eu "$@" export /usr/bin "$@"
+local then printf sed $(pwd) "$1" x=1 --verbose done then 'quoted text'
+sed awk echo then local
+"$@" && grep | 2>/dev/null local -eu | | "$@" ${HOME} --verbose done
+${HOME} --verbose $(pwd) cd local cd printf && readonly /usr/bin --verbose
+$(pwd) local x=1 && local ${HOME} done --verbose
+'quoted text' awk 2>/dev/null export x=1 --verbose
+	export export awk --verbose printf --verbose test -eu 'quoted text' --verbose
+		| x=1 ${HOME} readonly test $(pwd)
+then && done printf cd local done --verbose awk -eu printf $(pwd) /usr/bin $(pwd)
+		${HOME} -eu readonly x=1 readonly then readonly &&
+export -eu "$1" readonly local cd | ${HOME}
+		"$1" x=1 awk x=1 /usr/bin 2>/dev/null readonly
+	printf "$1" done readonly -eu "$1" "$1" awk | sed grep
+		local 2>/dev/null grep ${HOME} export then 'quoted text'
+	"$1" /usr/bin export readonly cd grep readonly x=1 --verbose
+		export printf echo "$1" local
+/usr/bin /usr/bin done local local /usr/bin
+printf && -eu printf printf readonly local echo x=1 sed awk "$1"
+		export then cd x=1 sed 2>/dev/null "$@" done sed && printf done
+grep sed 'quoted text' "$@" cd echo
+		&& readonly export 'quoted text'
+		"$1" grep awk then then 2>/dev/null
+		$(pwd) cd test cd -eu local -eu local 'quoted text' readonly
+awk readonly echo 2>/dev/null grep $(pwd) readonly done
+		x=1 "$1" x=1 "$1" -eu echo readonly awk done
+		&& | printf 'quoted text' echo printf export printf
+	readonly then test echo x=1 printf printf "$@" | local 2>/dev/null
+'quoted text' && grep done export
+--verbose && test sed grep
+	-eu -eu sed grep $(pwd) | awk test /usr/bin -eu "$1" sed $(pwd) local
+		${HOME} sed sed 'quoted text' readonly
+		-eu sed test then 'quoted text'
+"$@" x=1 "$1" --verbose printf /usr/bin && 'quoted text' -eu readonly
+	grep local done x=1 readonly "$1" readonly
+		${HOME} printf echo | x=1 grep echo -eu sed test | done /usr/bin &&
+	&& then sed awk "$1" sed echo && readonly $(pwd) x=1 grep |
+/usr/bin sed "$1" readonly $(pwd) local /usr/bin -eu ${HOME}
+	| printf /usr/bin 2>/dev/null "$@" ${HOME} echo cd
+	awk x=1 local 2>/dev/null sed sed --verbose cd
+	$(pwd) x=1 local | sed done local 2>/dev/null x=1 | 2>/dev/null grep
+		grep ${HOME} test printf 2>/dev/null 'quoted text'
+		${HOME} test export grep $(pwd) echo | echo --verbose "$1" "$@" | | printf /usr/bin
+		-eu 'quoted text' printf /usr/bin
+		${HOME} /usr/bin | grep x=1 local "$@" 2>/dev/null printf && "$@"
+	"$1" "$@" 'quoted text' printf x=1 ${HOME} ${HOME} $(pwd) "$1"
+sed && export $(pwd) cd "$1" --verbose sed x=1 'quoted text' export 'quoted text'
+	${HOME} 2>/dev/null | "$@" 2>/dev/null && && readonly
+awk test | echo export /usr/bin local 2>/dev/null echo done -eu "$1"
+-eu readonly /usr/bin 'quoted text' grep /usr/bin && printf
+	&& grep && grep cd sed /usr/bin
+		&& "$@" "$@" /usr/bin /usr/bin $(pwd) "$1" echo /usr/bin x=1
+	&& 2>/dev/null then /usr/bin sed readonly export printf
+		sed "$1" awk awk cd echo
+	cd && done /usr/bin $(pwd) done && printf -eu awk && cd awk done /usr/bin test
+	${HOME} 'quoted text' grep echo && ${HOME} printf
+		2>/dev/null "$@" | && "$@" "$@" printf --verbose
+	2>/dev/null done "$1" 'quoted text' awk $(pwd) "$@" $(pwd) awk done --verbose ${HOME}
+awk "$1" -eu /usr/bin "$@" echo printf then local awk then |
+	x=1 ${HOME} -eu "$1" x=1 test ${HOME} "$@" "$1" test then 'quoted text'
+| test cd x=1 echo | ${HOME} 'quoted text' local
+2>/dev/null "$1" done export --verbose && 2>/dev/null then | && -eu
+		done && then --verbose cd test local done $(pwd) printf
+	--verbose readonly x=1 sed local 2>/dev/null $(pwd)
+		export sed echo "$1" "$@" "$@" grep --verbose test
+	then && done 2>/dev/null then x=1 sed x=1 printf ${HOME} x=1 local printf
+		'quoted text' then 2>/dev/null ${HOME} local && && "$@" -eu sed test
+		'quoted text' && "$1" x=1 ${HOME} -eu $(pwd) 2>/dev/null
+/usr/bin local "$@" -eu ${HOME} --verbose local ${HOME} 'quoted text' local
+	sed x=1 2>/dev/null cd &&
+${HOME} test --verbose | -eu -eu readonly test local "$@"
+		test printf 'quoted text' echo
+&& /usr/bin cd $(pwd) 'quoted text'
+		"$@" sed $(pwd) test then grep $(pwd) && grep -eu "$@" cd && awk /usr/bin
+	local $(pwd) | "$1" "$1" sed test then x=1 'quoted text' sed "$@" awk echo export
+	| ${HOME} "$1" x=1 readonly then then grep 'quoted text' 'quoted text' test $(pwd)
+| grep --verbose readonly "$1" done "$1" "$1" "$1" printf $(pwd) test
+x=1 "$1" "$1" then done local | printf
+	&& 'quoted text' awk | x=1
+	/usr/bin && | ${HOME} -eu $(pwd) cd test "$@" awk -eu echo -eu | printf
+		done "$1" --verbose -eu awk sed then awk echo -eu && done export 'quoted text'
+printf x=1 x=1 'quoted text' ${HOME} ${HOME}
+		echo "$@" x=1 export local export x=1 printf "$1" done done done &&
+	export readonly done $(pwd) 2>/dev/null ${HOME} local -eu ${HOME} then local sed
+printf $(pwd) done "$1" done | then /usr/bin x=1 awk echo cd export
+		"$@" grep printf sed sed cd -eu $(pwd) local
+		'quoted text' "$1" export ${HOME} printf
+sed $(pwd) printf -eu /usr/bin grep && done sed --verbose
+"$@" printf 'quoted text'
+	x=1 done && && 'quoted text' $(pwd) -eu local 'quoted text'
+		export -eu --verbose cd readonly cd done
+	test export "$1" then done 'quoted text'
+		cd grep ${HOME} | -eu $(pwd) -eu local -eu 2>/dev/null | readonly export export
+	local test -eu --verbose 2>/dev/null x=1 local
+	test printf --verbose done done | "$1" /usr/bin ${HOME} $(pwd) 2>/dev/null
+		readonly grep --verbose grep ${HOME} grep grep done export x=1 local
+	done "$1" cd awk "$@" "$@" ${HOME} $(pwd) printf && awk | ${HOME}
+		export echo cd sed x=1 && export echo x=1 $(pwd)
+		"$1" then --verbose 2>/dev/null | sed readonly | "$@"
+done cd echo local export test $(pwd) sed local /usr/bin --verbose && ${HOME}
+sed --verbose x=1 2>/dev/null --verbose 2>/dev/null "$@" "$@" readonly
+local "$1" cd done --verbose awk 'quoted text' grep
+"$@" -eu ${HOME} sed "$@" 'quoted text'
+		local export "$1" awk cd done echo done printf $(pwd) grep cd test 2>/dev/null
+| ${HOME} $(pwd) ${HOME} grep awk "$1" 'quoted text' "$@" printf echo then sed
+		awk export | then printf printf done ${HOME} x=1 awk
+echo x=1 awk cd test --verbose "$@"
+${HOME} && echo then export /usr/bin local 2>/dev/null sed done
+	done x=1 --verbose echo 'quoted text' done local
+printf 'quoted text' -eu
+		export && echo grep done -eu $(pwd)
+		awk then "$1" | local /usr/bin --verbose awk "$1" 2>/dev/null
+	x=1 grep cd readonly /usr/bin | printf ${HOME} cd cd awk then grep $(pwd)
+&& 2>/dev/null && test
+	$(pwd) awk "$@" awk done ${HOME} readonly export then /usr/bin
+		"$@" "$1" sed then printf awk cd cd && done
+		printf printf "$1" export
+'quoted text' | --verbose $(pwd) "$1" 2>/dev/null
+		sed "$1" readonly x=1 echo
+readonly sed sed $(pwd) printf --verbose echo ${HOME}
+	export local grep "$1" test | 'quoted text'
+	"$@" 'quoted text' test "$1" readonly "$1" sed &&
+/usr/bin local readonly export && | "$1" grep sed sed readonly done local echo
+		2>/dev/null "$@" 'quoted text' "$@" then
+/usr/bin grep awk ${HOME} && --verbose
+		awk echo "$@" /usr/bin "$@" x=1 sed "$@" | printf
+		-eu grep -eu x=1 printf && "$1" 2>/dev/null --verbose --verbose export ${HOME}
+		/usr/bin grep cd x=1 export
+		grep then /usr/bin | 2>/dev/null
+$(pwd) local ${HOME} grep local cd --verbose $(pwd) then test grep awk
+		test /usr/bin printf && x=1 x=1 sed export then -eu
+	$(pwd) then | x=1 grep test "$1" --verbose
+	x=1 test then | /usr/bin "$1" awk local
+	$(pwd) export printf 'quoted text' -eu "$@" then
+		&& "$1" && sed && /usr/bin sed cd local $(pwd) $(pwd) -eu awk grep "$@" /usr/bin
+		test export | "$1" "$@"
+	sed export test done "$1" then readonly
+	readonly "$1" local then local "$1" "$@" grep x=1 grep then grep x=1 $(pwd)
+	$(pwd) 2>/dev/null then local export printf then --verbose "$@"
+2>/dev/null "$@" && test ${HOME} "$1"
+		test awk "$@" awk 'quoted text' "$@"
+done done awk test readonly test grep test
+	'quoted text' -eu && export
+local sed awk $(pwd) awk grep done awk 'quoted text' /usr/bin 2>/dev/null
+		echo && --verbose -eu $(pwd) export /usr/bin --verbose 'quoted text'
+	then "$@" $(pwd) 2>/dev/null awk export ${HOME} "$@" local
+	"$@" x=1 sed x=1 sed ${HOME} sed "$1" awk "$1" then
+		--verbose "$1" -eu sed ${HOME} "$@" echo cd ${HOME} -eu then local
+| "$@" $(pwd) export test /usr/bin x=1 test --verbose printf done echo
+x=1 readonly echo grep awk "$1" cd --verbose grep
+	awk sed sed 'quoted text' x=1 export readonly echo ${HOME} local sed
+	x=1 /usr/bin /usr/bin printf cd
+	cd --verbose -eu readonly readonly printf "$@" test test
+		| export && test sed 'quoted text'
+	awk /usr/bin grep --verbose
+${HOME} grep 2>/dev/null echo ${HOME} echo awk printf "$1" 'quoted text'
+echo done "$@" x=1 x=1 | "$@" 2>/dev/null local | -eu && /usr/bin cd
+	'quoted text' grep echo "$1" --verbose
+		readonly ${HOME} --verbose cd x=1 done test test test "$1" cd -eu
+		printf awk test x=1 local awk x=1 "$@" export
+		echo 2>/dev/null x=1 --verbose cd ${HOME} then cd test
+		done awk cd printf grep | -eu /usr/bin sed echo done printf
+$(pwd) 'quoted text' "$@" then 2>/dev/null
+-eu grep local echo then
+then ${HOME} export -eu | printf awk readonly awk 'quoted text' echo
+	export printf && "$1" local -eu
+		grep then x=1 awk --verbose
+then export "$1" $(pwd) echo 'quoted text' ${HOME} |
+--verbose cd | awk test then
+	&& echo ${HOME} | 2>/dev/null readonly then --verbose ${HOME}
+		echo ${HOME} x=1 /usr/bin /usr/bin
+cd done | test -eu | $(pwd) awk && 'quoted text' -eu -eu sed echo export
+sed ${HOME} sed x=1 cd then
+		--verbose readonly -eu echo export awk
+then printf printf then /usr/bin 2>/dev/null
+	"$1" "$1" grep cd readonly $(pwd) | $(pwd) readonly readonly /usr/bin 2>/dev/null
+	printf | 'quoted text' export "$@" export 'quoted text'
+		"$@" $(pwd) "$1" && cd
+	--verbose export "$1" "$@" sed "$@" /usr/bin "$1" sed
+	printf export grep export
+		--verbose export test | --verbose local && x=1 test done readonly ${HOME} then
+	'quoted text' local done local
+grep x=1 then readonly && $(pwd) ${HOME}
+		| echo x=1 test sed 2>/dev/null done awk echo x=1 local ${HOME} -eu 2>/dev/null
+		sed "$1" grep /usr/bin "$1"
+	"$1" local 2>/dev/null then local -eu done /usr/bin
+	'quoted text' 2>/dev/null ${HOME} --verbose awk done
+	cd cd echo then ${HOME} sed cd 2>/dev/null -eu | | printf "$1"
+x=1 export sed readonly "$@" readonly
+| readonly test --verbose local
+	"$@" "$@" printf export
+	| | readonly "$1" local done test 'quoted text'
+		--verbose grep $(pwd)
+| local grep --verbose
+export 2>/dev/null "$1" export | "$@" echo "$1" | 'quoted text'
+		cd export | awk cd /usr/bin done ${HOME} printf echo "$1" | && done 'quoted text'
+readonly awk | /usr/bin -eu test "$@" ${HOME} $(pwd) x=1 --verbose
+		"$1" 'quoted text' "$1" -eu echo done 'quoted text' | local | | 2>/dev/null
+	sed cd -eu x=1 "$1" "$1" done | awk && $(pwd) "$@" sed test
+		printf test "$@" ${HOME}
+	-eu readonly ${HOME} then export readonly printf | "$@"
+		"$1" printf | ${HOME} x=1 done grep && printf 'quoted text' test awk
+		${HOME} ${HOME} cd awk printf /usr/bin printf "$1" echo
+/usr/bin then $(pwd) "$@"
+/usr/bin --verbose $(pwd) done && -eu x=1 export echo -eu test cd 'quoted text'
+	2>/dev/null then then "$@" sed /usr/bin x=1 cd grep local /usr/bin
+		| sed x=1 printf then -eu echo | printf x=1 && export then printf
+echo 2>/dev/null export printf cd local && grep "$1"
+		--verbose readonly awk ${HOME} ${HOME} --verbose 'quoted text'
+| /usr/bin --verbose ${HOME} "$1" cd test done
+		local "$1" export "$@" local ${HOME} 'quoted text' "$@" ${HOME} local
+	test -eu readonly sed $(pwd) "$@"
+&& printf printf sed "$@" 'quoted text' grep local grep "$@" -eu echo --verbose
+		"$@" export x=1 test grep done test "$@" readonly
+		sed | $(pwd) ${HOME} 2>/dev/null
+sed done --verbose x=1 test | local cd readonly export --verbose 2>/dev/null 2>/dev/null
+		2>/dev/null cd $(pwd) -eu $(pwd) local && 2>/dev/null grep readonly --verbose grep
+then "$1" grep sed local local "$1" -eu done --verbose echo grep
+		then /usr/bin x=1 done "$@" && sed | sed /usr/bin
+	export "$@" ${HOME} done sed "$1"
+export printf --verbose echo cd sed x=1 "$@" --verbose
+		$(pwd) readonly "$@" readonly ${HOME} done ${HOME}
+		echo $(pwd) ${HOME} ${HOME} 2>/dev/null then && 2>/dev/null
+then ${HOME} "$1" "$@" | printf cd test export
+grep export --verbose $(pwd) awk grep then printf "$@" &&
+	then done test -eu && "$@" --verbose sed readonly "$@"
+	"$@" /usr/bin $(pwd) -eu "$@" done "$1" $(pwd) 2>/dev/null test awk "$1" sed
+		${HOME} -eu | cd 'quoted text' then $(pwd)
+	'quoted text' printf grep then export
+"$1" cd -eu done "$@" local --verbose "$1" "$1" export | ${HOME} "$1" awk ${HOME}
+	$(pwd) printf test 'quoted text' -eu then "$1"
+sed "$1" done export grep && readonly test -eu
+"$1" 2>/dev/null $(pwd) --verbose cd echo local echo "$@" /usr/bin
+	then 'quoted text' sed $(pwd)
+	&& local ${HOME} done then x=1 echo
+	done | /usr/bin 2>/dev/null -eu "$@" printf $(pwd) 2>/dev/null
+done sed local done | echo done then
+test cd printf readonly local grep
+		test | sed "$@" done 2>/dev/null && sed then "$@" local | then ${HOME}
+		local sed /usr/bin --verbose | x=1 readonly awk
+"$1" /usr/bin test export
+		x=1 readonly && $(pwd) /usr/bin | ${HOME} test then x=1 --verbose cd | sed
+--verbose --verbose test local "$@" /usr/bin echo "$1" ${HOME} test local
+local /usr/bin echo "$1" cd | | grep $(pwd) test $(pwd) | -eu
+awk grep local echo export cd "$1" "$@" echo $(pwd) "$@" test export /usr/bin
+		&& --verbose "$@" /usr/bin sed readonly then awk cd
+$(pwd) awk cd printf grep "$@" then
+		local sed export printf "$1" "$1" awk "$@" "$1"
@@ -0,0 +1,2001 @@
+	$(pwd) -eu awk /usr/bin ${HOME} && done /usr/bin ${HOME} --verbose x=1
+	sed ${HOME} -eu --verbose /usr/bin
+printf --verbose export
+		done /usr/bin export readonly grep
+then export test -eu echo
+&& && "$1" local printf | sed | done -eu readonly --verbose
+awk --verbose "$1" && --verbose 'quoted text' printf -eu grep "$@" "$1" && grep
+		/usr/bin echo readonly --verbose done echo 'quoted text'
+		'quoted text' && sed echo 2>/dev/null | && readonly 'quoted text'
+	"$@" awk "$@" $(pwd) then x=1 x=1 printf
+printf 'quoted text' $(pwd)
+grep sed /usr/bin test sed
+cd /usr/bin ${HOME} export $(pwd)
+		local -eu export && "$@" readonly test cd && "$@" | export cd -eu
+'quoted text' --verbose /usr/bin | ${HOME}
+	test done "$@" done x=1 then 'quoted text'
+$(pwd) printf readonly local
+export $(pwd) local awk readonly
+sed -eu 'quoted text' sed readonly "$1" grep printf test /usr/bin
+export --verbose /usr/bin
+	export $(pwd) then grep ${HOME} awk echo grep sed
+	--verbose grep grep cd ${HOME}
+	${HOME} then echo done cd grep then
+	then sed grep 2>/dev/null awk readonly test "$@" printf export 2>/dev/null
+then 2>/dev/null 2>/dev/null && test cd && -eu 2>/dev/null
+	x=1 && /usr/bin test --verbose grep x=1 'quoted text'
+	--verbose 2>/dev/null grep export sed --verbose done -eu --verbose
+	cd x=1 /usr/bin then $(pwd)
+2>/dev/null x=1 cd awk then test sed 'quoted text' --verbose
+	2>/dev/null awk export then "$1" | "$1" local ${HOME} | $(pwd) $(pwd)
+		export "$1" readonly 2>/dev/null then && "$@" test
+		grep sed sed echo then echo grep done "$1" local /usr/bin printf && done
+local /usr/bin printf 2>/dev/null x=1 ${HOME} 'quoted text' && -eu
+	/usr/bin | && --verbose /usr/bin x=1 echo 'quoted text' /usr/bin printf export
+	2>/dev/null x=1 test /usr/bin && "$1"
+	'quoted text' then /usr/bin cd ${HOME}
+	readonly then /usr/bin | -eu done && x=1 'quoted text' then local
+	$(pwd) ${HOME} done readonly
+done "$1" x=1 export done local "$@" && 2>/dev/null | cd /usr/bin local
+then -eu 'quoted text' /usr/bin printf "$@" awk 'quoted text' ${HOME} 'quoted text'
+	test readonly sed then x=1 --verbose
+	"$@" $(pwd) awk 'quoted text' "$@"
+		'quoted text' local local sed $(pwd) grep then local then readonly echo sed
+		--verbose echo -eu 'quoted text' cd x=1 && readonly export /usr/bin test awk "$@"
+		"$1" cd "$@" local sed 'quoted text' awk printf
+		x=1 ${HOME} done echo test && printf sed awk "$@" 'quoted text' 'quoted text'
+local grep cd local "$1" local echo ${HOME} --verbose
+-eu "$1" done done readonly grep sed awk 'quoted text'
+	done export grep -eu local readonly "$@" grep --verbose printf export $(pwd)
+done printf sed --verbose printf printf export sed then "$1" /usr/bin &&
+"$1" ${HOME} then printf echo /usr/bin test test -eu
+		then printf cd && "$@"
+printf ${HOME} "$1" --verbose echo "$1" /usr/bin cd
+	export 'quoted text' ${HOME} grep --verbose --verbose then cd printf x=1 awk
+		test 'quoted text' /usr/bin "$1" -eu "$1" done | local 2>/dev/null
+		grep echo printf local "$@" --verbose then
+	${HOME} grep /usr/bin printf readonly cd
+		grep grep /usr/bin test "$1" awk done cd 2>/dev/null
+		done sed 'quoted text' local awk awk -eu printf then cd 2>/dev/null test
+grep done then cd /usr/bin awk local | cd sed sed --verbose $(pwd)
+		then --verbose awk -eu done "$1" /usr/bin --verbose
+$(pwd) test printf then
+	/usr/bin | then echo x=1 /usr/bin export
+	grep then grep cd local test | then grep && awk cd -eu 'quoted text' "$@"
+	--verbose "$1" ${HOME} -eu -eu | && -eu then --verbose
+		| 'quoted text' 2>/dev/null done done cd 'quoted text' echo "$@" 2>/dev/null
+		2>/dev/null 'quoted text' 'quoted text' awk -eu
+		test sed cd grep readonly then | -eu x=1 | "$@" echo awk then x=1 cd
+	2>/dev/null grep 2>/dev/null done ${HOME} done
+2>/dev/null done "$@" $(pwd) awk /usr/bin
+		cd cd --verbose /usr/bin grep printf echo printf
+2>/dev/null ${HOME} done $(pwd) test awk "$@" x=1 "$1" "$@" x=1 $(pwd) -eu export
+printf done --verbose ${HOME} "$@" echo 'quoted text' "$1" && done awk
+	"$1" export local /usr/bin printf "$@" --verbose
+	cd $(pwd) 'quoted text' x=1 -eu grep sed 'quoted text'
+		/usr/bin && | then /usr/bin "$1" $(pwd) local export 'quoted text' done
+printf 2>/dev/null awk local local printf then "$@" | | /usr/bin
+echo grep "$@" /usr/bin --verbose awk then | -eu done 'quoted text' $(pwd) grep
+readonly $(pwd) $(pwd) 2>/dev/null cd $(pwd)
+	-eu | "$@" export done
+	readonly export readonly awk cd printf awk done
+	grep x=1 cd 2>/dev/null echo readonly
+	export "$1" done done ${HOME} then /usr/bin
+	then local test printf && | --verbose --verbose "$1" 'quoted text'
+	'quoted text' x=1 readonly $(pwd) export done done readonly readonly grep
+	grep /usr/bin /usr/bin 2>/dev/null
+	x=1 readonly awk --verbose grep "$1" readonly /usr/bin echo readonly echo
+	"$@" readonly echo 'quoted text'
+cd echo "$1" export awk -eu "$1" && then ${HOME} cd
+| ${HOME} | "$@" x=1 done sed readonly -eu 2>/dev/null printf readonly printf
+	x=1 local awk test x=1 'quoted text' 2>/dev/null readonly then
+	awk grep | --verbose echo --verbose $(pwd)
+done "$1" sed && -eu done 2>/dev/null local && sed cd export
+		local echo 2>/dev/null grep awk $(pwd)
+	printf then x=1 | | printf grep printf "$@" && awk echo --verbose
+grep $(pwd) --verbose export export test ${HOME} done test
+x=1 grep "$1" cd && cd readonly awk -eu cd echo done cd then "$@"
+		test -eu 'quoted text' "$@" echo cd ${HOME} cd /usr/bin /usr/bin
+2>/dev/null | "$1" /usr/bin awk awk 'quoted text' sed export
+		&& sed "$1" grep grep then cd printf
+"$1" | 'quoted text' 'quoted text' --verbose grep | done test $(pwd) export -eu
+--verbose x=1 'quoted text' x=1 | -eu $(pwd) 'quoted text' done local cd test
+| grep --verbose done --verbose local test x=1 "$1" 2>/dev/null
+echo readonly | "$1" && cd test /usr/bin | echo printf
+	done -eu -eu readonly /usr/bin awk local "$@" export "$@" awk ${HOME} test printf
+	readonly && cd awk then 'quoted text' grep | readonly
+test then local cd $(pwd) --verbose export local 2>/dev/null echo "$1"
+		sed grep && awk done /usr/bin test local sed grep cd "$1" ${HOME} readonly -eu
+		then 'quoted text' then echo | awk | /usr/bin awk export
+		x=1 sed test local | "$@" -eu "$@" echo && printf /usr/bin local
+	x=1 ${HOME} readonly x=1 "$@" x=1 x=1 awk local awk 'quoted text' --verbose grep
+cd local readonly ${HOME} ${HOME}
+		local "$1" grep ${HOME} sed "$@" $(pwd) readonly
+test done 'quoted text' local then /usr/bin grep cd "$1" cd ${HOME} done readonly
+export printf | export x=1 x=1 awk
+	readonly echo | $(pwd) done 2>/dev/null
+printf "$@" ${HOME} sed cd local grep readonly
+	printf done readonly cd x=1 done && /usr/bin /usr/bin cd -eu 'quoted text' 'quoted text'
+-eu 2>/dev/null && test 2>/dev/null /usr/bin /usr/bin 'quoted text' 'quoted text'
+test awk 2>/dev/null x=1 --verbose | then export readonly cd sed
+&& grep ${HOME} --verbose printf 2>/dev/null test then done
+		--verbose 2>/dev/null /usr/bin cd
+printf awk && && local 'quoted text' 'quoted text' test 'quoted text'
+		2>/dev/null -eu | sed $(pwd) echo done 2>/dev/null
+test readonly echo sed readonly sed "$1" x=1 'quoted text'
+		grep sed -eu x=1 export
+"$1" export readonly && grep -eu awk readonly -eu /usr/bin "$@" awk $(pwd)
+	local test 'quoted text' -eu test
+		2>/dev/null printf ${HOME} printf -eu echo -eu 2>/dev/null 'quoted text'
+export sed done export sed 2>/dev/null done then
+		then awk && awk ${HOME} /usr/bin awk test
+	local -eu test sed "$1" x=1 --verbose -eu x=1 cd done -eu sed sed --verbose
+		export readonly "$1" /usr/bin $(pwd)
+	cd done test export grep
+	| test "$1" && 2>/dev/null 2>/dev/null --verbose readonly /usr/bin
+export local | "$1" printf export cd -eu awk awk -eu --verbose
+		x=1 printf echo export x=1 2>/dev/null
+&& "$1" -eu cd awk export then "$@" sed echo cd | /usr/bin --verbose done && done
+${HOME} /usr/bin $(pwd) $(pwd) export && sed -eu | x=1 grep /usr/bin
+	"$1" sed then done echo "$1" -eu awk local --verbose
+sed 2>/dev/null grep 2>/dev/null test x=1 --verbose
+"$@" local && "$@" "$@" $(pwd) test x=1 --verbose -eu test test grep
+grep readonly then local done 'quoted text' then x=1 done && 'quoted text'
+		sed grep | /usr/bin 'quoted text' $(pwd) 2>/dev/null $(pwd) sed
+		readonly grep awk then ${HOME} && /usr/bin /usr/bin "$@" test
+		| done $(pwd) 'quoted text' sed --verbose -eu /usr/bin printf awk local echo then
+&& done --verbose test readonly done ${HOME} 2>/dev/null then done
+printf export awk awk readonly "$1"
+	&& "$@" $(pwd) 2>/dev/null
+test "$1" cd 'quoted text' $(pwd) local readonly
+/usr/bin export /usr/bin "$1" && $(pwd) sed -eu -eu x=1
+	"$@" then -eu "$@" local "$@" "$1"
+	--verbose readonly readonly printf | $(pwd) "$1" --verbose
+'quoted text' echo sed local awk 'quoted text' local ${HOME}
+	export grep x=1 echo --verbose
+	test sed x=1 echo "$1" sed ${HOME} local --verbose "$1" then
+--verbose -eu cd 2>/dev/null $(pwd) local readonly --verbose done cd && 2>/dev/null
+'quoted text' test export
+-eu x=1 ${HOME} 'quoted text' done /usr/bin 2>/dev/null done
+	"$@" "$@" --verbose grep | /usr/bin /usr/bin printf readonly echo
+		test "$1" -eu 2>/dev/null
+		grep "$1" done test test then cd "$@" readonly --verbose
+echo done $(pwd) sed sed done local 'quoted text' test echo 'quoted text'
+		export local grep cd awk echo x=1 -eu test done sed cd export
+		-eu && x=1 sed "$1" then sed
+'quoted text' --verbose local ${HOME}
+	export cd sed | export test then export then 'quoted text' /usr/bin awk sed cd
+-eu then "$1" printf -eu then readonly printf
+		x=1 then then x=1 -eu cd | then
+	"$1" local grep test 2>/dev/null "$1" "$1" "$@" cd done readonly awk export
+	readonly "$@" "$1" sed -eu readonly | then then /usr/bin local test "$1" grep
+test then 2>/dev/null done && && ${HOME} "$@" /usr/bin
+sed test then then -eu 2>/dev/null then awk && test done local awk local
+		-eu $(pwd) 2>/dev/null "$@" --verbose && 2>/dev/null
+		awk done export echo cd 'quoted text' export cd sed echo
+test then -eu | echo then $(pwd) grep test 2>/dev/null x=1 local test then -eu
+	export --verbose grep
+test --verbose printf x=1 -eu $(pwd) then && done $(pwd) "$1" ${HOME} readonly
+done echo ${HOME} echo $(pwd) $(pwd) 'quoted text'
+		sed export awk sed awk local readonly -eu 2>/dev/null awk grep echo
+		local local echo x=1 /usr/bin done local readonly
+		echo ${HOME} awk --verbose test printf then readonly && $(pwd)
+"$1" awk 2>/dev/null
+		printf echo readonly export
+echo export /usr/bin sed cd
+	$(pwd) readonly cd ${HOME} grep -eu "$@" ${HOME} readonly --verbose
+	export echo awk local x=1 local printf done export grep export local then |
+	-eu 2>/dev/null done grep 'quoted text' grep $(pwd) "$1" grep readonly cd
+	x=1 readonly | printf "$@" "$@" /usr/bin test
+export done | local 'quoted text'
+		&& "$@" ${HOME} "$1" | /usr/bin "$1" test 2>/dev/null
+	awk && then /usr/bin x=1 "$1" 2>/dev/null /usr/bin
+	"$@" awk -eu 2>/dev/null "$@" printf done x=1 awk awk readonly printf printf
+	readonly ${HOME} 2>/dev/null
+printf export done sed then export printf printf echo echo awk cd export sed
+	| then printf then /usr/bin "$1" grep test cd x=1 grep --verbose
+		cd cd /usr/bin printf -eu test $(pwd) awk export
+	test --verbose cd done printf test $(pwd) 'quoted text'
+		'quoted text' x=1 export -eu --verbose ${HOME} &&
+		| printf | "$@" done --verbose
+awk echo then && grep | done local "$@" ${HOME} echo && sed awk
+readonly --verbose "$@" printf
+${HOME} "$1" local && --verbose done
+	then && awk --verbose then && grep echo echo -eu readonly
+		awk awk local ${HOME} awk 'quoted text' printf test "$@"
+done done awk | echo done test --verbose "$1" printf /usr/bin export cd
+		/usr/bin $(pwd) 'quoted text' sed -eu "$1" $(pwd) export ${HOME}
+	"$@" && --verbose "$@" printf readonly grep
+	2>/dev/null printf local printf ${HOME} "$@" printf then
+		"$1" | done && awk -eu export cd readonly cd ${HOME} then readonly
+cd printf readonly grep sed readonly /usr/bin "$1"
+x=1 --verbose export done x=1 /usr/bin -eu export -eu grep /usr/bin
+	test -eu x=1 cd | -eu | export && $(pwd)
+	local 2>/dev/null test done export local /usr/bin --verbose
+x=1 readonly cd grep -eu && /usr/bin grep /usr/bin
+		export 'quoted text' printf /usr/bin
+echo "$@" cd x=1 awk x=1 $(pwd)
+		printf grep readonly printf -eu cd | cd
+'quoted text' 2>/dev/null test --verbose | awk local test sed readonly
+cd readonly local x=1 printf x=1 /usr/bin test test | local
+done readonly 2>/dev/null | && 'quoted text'
+		readonly $(pwd) && then cd readonly x=1 2>/dev/null
+then "$@" 'quoted text' && /usr/bin printf grep export
+		2>/dev/null | printf printf "$@" --verbose awk "$@" export $(pwd) sed
+awk awk -eu --verbose printf grep readonly
+		cd test "$@" /usr/bin local sed 'quoted text'
+	2>/dev/null test "$@" grep "$1" "$@" cd echo 2>/dev/null
+	2>/dev/null x=1 test --verbose cd printf $(pwd) local
+		x=1 sed grep -eu local x=1 test "$1" awk 'quoted text' ${HOME} 2>/dev/null
+"$@" x=1 x=1 local $(pwd) | local "$1" ${HOME} done echo test -eu "$@" --verbose
+		/usr/bin readonly ${HOME} /usr/bin | -eu && sed readonly local
+	| --verbose awk ${HOME} /usr/bin echo /usr/bin
+	local && local x=1 /usr/bin
+		--verbose "$1" grep awk local --verbose /usr/bin
+		readonly sed awk | ${HOME} readonly sed grep "$@"
+"$1" && awk readonly "$@" then export echo test -eu readonly printf ${HOME}
+test $(pwd) readonly 'quoted text' readonly then grep cd test 2>/dev/null
+	done awk && 2>/dev/null grep
+"$@" "$@" ${HOME} local /usr/bin export local /usr/bin | sed
+	&& 'quoted text' awk echo cd 'quoted text' -eu /usr/bin
+		-eu /usr/bin cd --verbose 2>/dev/null 2>/dev/null grep
+readonly then local x=1 echo -eu 2>/dev/null
+"$@" local cd 'quoted text' /usr/bin cd test "$1"
+	awk $(pwd) -eu local echo test cd cd readonly grep
+'quoted text' x=1 local "$1" awk local sed && sed cd /usr/bin ${HOME} done
+		"$@" "$@" export then x=1 ${HOME} x=1 local readonly x=1 'quoted text' &&
+	$(pwd) local "$@" "$@" cd "$@" --verbose
+export echo sed readonly $(pwd) cd
+| "$1" grep x=1 "$1" -eu awk "$1" ${HOME} then 2>/dev/null /usr/bin
+	local printf && export test awk local --verbose grep done
+	done done export x=1 && cd -eu test 2>/dev/null cd | ${HOME} && echo printf
+	sed 'quoted text' printf readonly 'quoted text' export
+	/usr/bin | grep /usr/bin awk local $(pwd) | export cd
+'quoted text' grep 2>/dev/null grep 2>/dev/null test echo
+		-eu ${HOME} export sed then printf printf 'quoted text' 'quoted text'
+		"$1" printf --verbose 2>/dev/null
+2>/dev/null export x=1 /usr/bin printf
+/usr/bin cd && "$@" $(pwd) export "$1" export 'quoted text'
+'quoted text' awk --verbose "$@" test --verbose then && grep "$@" 2>/dev/null
+test 'quoted text' "$1" local local | cd "$1" && readonly readonly $(pwd)
+'quoted text' "$@" sed 'quoted text' local export done sed ${HOME} /usr/bin
+	"$1" "$1" 2>/dev/null echo then echo && export cd --verbose export
+&& ${HOME} awk test $(pwd)
+		readonly x=1 then "$1" 'quoted text' ${HOME} /usr/bin echo "$@"
+	&& "$@" cd "$1" awk readonly x=1 export then --verbose test awk then
+		sed printf "$@" "$@" done awk
+	local 2>/dev/null && export grep "$@" echo
+&& x=1 x=1 x=1 $(pwd)
+	done $(pwd) awk sed --verbose export 2>/dev/null
+		"$1" $(pwd) test x=1 ${HOME} test -eu test /usr/bin 'quoted text' -eu
+	echo awk echo 'quoted text' cd $(pwd) -eu local "$1" -eu export
+| 'quoted text' -eu awk /usr/bin cd ${HOME} done "$1" local /usr/bin
+	| ${HOME} cd "$@" --verbose /usr/bin "$@" -eu printf 2>/dev/null "$1" 2>/dev/null
+cd && "$@" && x=1 /usr/bin cd x=1 local && x=1 cd awk printf $(pwd) 'quoted text'
+	sed --verbose "$1" cd -eu && | ${HOME}
+		readonly x=1 "$1" 2>/dev/null then 2>/dev/null 'quoted text'
+		x=1 && readonly readonly export "$1" sed
+printf 2>/dev/null x=1 2>/dev/null cd printf
+	"$@" | "$@" --verbose 'quoted text'
+		| 2>/dev/null /usr/bin --verbose --verbose "$@" 2>/dev/null x=1 sed -eu readonly
+		x=1 echo local local export readonly printf /usr/bin export
+export awk local /usr/bin 2>/dev/null test x=1 /usr/bin echo x=1 "$@" /usr/bin
+	2>/dev/null grep && && test local --verbose
+		test local -eu 'quoted text'
+2>/dev/null done 2>/dev/null "$1" printf cd grep ${HOME} 2>/dev/null --verbose
+	awk ${HOME} /usr/bin 'quoted text' export --verbose --verbose
+/usr/bin sed printf grep done done 'quoted text' export echo
+cd -eu readonly sed x=1 "$@" 'quoted text'
+$(pwd) -eu ${HOME} local x=1 sed printf sed readonly --verbose local ${HOME}
+		| then | echo $(pwd) "$@" test ${HOME} printf -eu test /usr/bin
+	| | echo echo | x=1 echo 2>/dev/null test x=1 done printf -eu 2>/dev/null
+	| x=1 local -eu sed test "$1" done local cd done local --verbose printf && &&
+'quoted text' export printf $(pwd) awk | echo 2>/dev/null --verbose
+	&& --verbose cd /usr/bin
+"$@" $(pwd) printf x=1 awk 'quoted text' grep local test sed 2>/dev/null
+--verbose /usr/bin echo awk sed test | | "$@" /usr/bin then
+	then 2>/dev/null awk 2>/dev/null sed
+		--verbose awk readonly test
+	&& ${HOME} local export awk /usr/bin -eu | local 'quoted text' --verbose
+"$@" export && local | printf then done 2>/dev/null readonly cd "$@" readonly
+	'quoted text' readonly sed cd grep x=1 grep --verbose
+| sed test | done test local /usr/bin | ${HOME} test "$1" /usr/bin
+		readonly "$@" ${HOME} "$1" test echo ${HOME} awk && echo
+	awk awk local /usr/bin test 'quoted text' -eu --verbose awk test
+	export /usr/bin ${HOME} /usr/bin
+		2>/dev/null cd -eu /usr/bin
+"$@" | /usr/bin awk | /usr/bin "$@" sed -eu x=1 -eu awk x=1 grep
+local "$1" awk && local 2>/dev/null
+	"$1" awk | sed --verbose "$1" x=1 "$1" cd x=1 --verbose
+printf printf --verbose ${HOME} readonly "$1" awk done
+		"$1" local | cd /usr/bin export 2>/dev/null done local x=1
+readonly /usr/bin local --verbose $(pwd) local 2>/dev/null readonly
+	test printf ${HOME} -eu $(pwd)
+	2>/dev/null awk then awk --verbose export cd | awk then | /usr/bin
+	grep then 'quoted text' done -eu awk "$1"
+sed x=1 then x=1 "$1" sed export 2>/dev/null local 'quoted text' /usr/bin
+"$@" grep then --verbose then grep export cd -eu | | && --verbose then -eu 'quoted text'
+test "$@" $(pwd) -eu grep | -eu 2>/dev/null
+	local readonly cd export
+	test test awk && --verbose "$@" x=1 grep | sed 'quoted text' "$1" test --verbose
+local -eu -eu cd sed -eu "$1" x=1 --verbose x=1 printf sed ${HOME}
+		printf 'quoted text' 2>/dev/null
+readonly --verbose ${HOME} awk /usr/bin
+		/usr/bin && sed | readonly readonly
+	"$1" "$@" printf then "$1" grep ${HOME} then echo $(pwd) ${HOME} export local |
+	echo /usr/bin "$1" awk ${HOME} readonly test grep $(pwd) local done "$1"
+cd readonly "$1" /usr/bin /usr/bin ${HOME} -eu readonly done && -eu ${HOME}
+--verbose x=1 2>/dev/null then && -eu cd grep export local
+	grep 2>/dev/null 'quoted text' && && x=1 done readonly
+		export readonly | 2>/dev/null readonly export echo |
+	then && $(pwd) ${HOME} -eu done | awk grep done -eu
+		echo 2>/dev/null --verbose "$@" sed /usr/bin test cd x=1 x=1 echo && test
+		2>/dev/null export $(pwd) 2>/dev/null echo echo 'quoted text'
+	printf local readonly sed readonly readonly
+cd cd then 'quoted text' sed grep | && printf -eu && 'quoted text' && then /usr/bin
+	$(pwd) x=1 -eu awk cd | cd local 'quoted text' 'quoted text' ${HOME} "$@" printf
+	"$1" ${HOME} 2>/dev/null printf --verbose
+	x=1 echo ${HOME} && --verbose
+		grep then | echo cd export x=1 local printf sed export
+		then "$@" export test "$1" --verbose local 2>/dev/null
+'quoted text' ${HOME} 'quoted text' ${HOME} -eu -eu 'quoted text' local echo export
+		"$1" -eu local $(pwd) cd | ${HOME} export
+	readonly test /usr/bin readonly && test awk test export ${HOME} 2>/dev/null
+printf | --verbose export local echo 2>/dev/null "$1" cd 2>/dev/null 2>/dev/null
+${HOME} echo 2>/dev/null ${HOME} "$@" "$@" --verbose 'quoted text' printf
+		grep printf "$@" ${HOME} done
+local cd "$1" 2>/dev/null
+-eu done "$1" then test
+	| x=1 -eu --verbose grep done
+	"$1" --verbose printf sed readonly 2>/dev/null
+		2>/dev/null --verbose "$1" $(pwd) done /usr/bin printf
+		x=1 then done $(pwd) "$1" && echo grep $(pwd) sed test --verbose
+	then --verbose --verbose 2>/dev/null
+	$(pwd) local 2>/dev/null done --verbose cd "$1" then ${HOME} awk echo sed test
+	$(pwd) readonly | cd 'quoted text' export | /usr/bin -eu x=1 /usr/bin &&
+		printf ${HOME} then 2>/dev/null export -eu 'quoted text' -eu x=1 "$@" awk
+	${HOME} "$1" then grep -eu $(pwd) "$@" echo awk /usr/bin -eu x=1 --verbose "$1"
+--verbose echo && printf
+echo && -eu 'quoted text' 2>/dev/null cd sed x=1
+		$(pwd) x=1 echo ${HOME} then grep local local && awk awk "$@"
+echo ${HOME} | sed grep
+		grep awk x=1 -eu && echo
+printf $(pwd) $(pwd) echo export ${HOME} echo
+		/usr/bin --verbose ${HOME} echo awk local
+		grep grep sed && sed done $(pwd) "$@" $(pwd) "$1" readonly cd $(pwd) test test
+'quoted text' printf done /usr/bin 'quoted text' done -eu
+		readonly then awk && -eu | sed
+"$@" 2>/dev/null printf
+x=1 ${HOME} /usr/bin awk grep | grep "$1" readonly
+	${HOME} | 'quoted text' readonly 'quoted text' done awk then ${HOME} && && awk
+	cd $(pwd) test | 'quoted text' test
+then export "$@" "$1" ${HOME} grep test "$@" -eu | 'quoted text'
+"$@" sed sed then $(pwd) ${HOME} sed export test then export "$1" export readonly
+	export "$@" "$@" then /usr/bin sed "$1" --verbose awk | grep cd readonly x=1
+	cd && 'quoted text' | ${HOME} x=1 --verbose export ${HOME}
+	then 'quoted text' local && cd -eu local then echo /usr/bin
+	printf && $(pwd) grep done cd local ${HOME} awk
+		grep test cd && printf done | then echo $(pwd) printf && cd &&
+		readonly echo 2>/dev/null local $(pwd) grep
+'quoted text' | ${HOME} then "$1" "$@" sed && 2>/dev/null 'quoted text'
+'quoted text' "$@" "$1" then grep done "$@" 'quoted text' ${HOME} echo &&
+		/usr/bin grep cd "$@" awk awk echo test awk --verbose 2>/dev/null
+		local | echo local grep
+	'quoted text' 2>/dev/null x=1 --verbose printf printf "$@" 2>/dev/null local test
+		grep test | 2>/dev/null 2>/dev/null done x=1 sed then --verbose
+	printf ${HOME} 2>/dev/null then readonly | $(pwd) && -eu 'quoted text' --verbose
+	"$@" 2>/dev/null echo done printf "$1" -eu | local sed done echo grep test
+		then /usr/bin then readonly $(pwd) readonly --verbose grep awk
+		&& "$1" test 'quoted text' readonly then done -eu && | -eu grep "$1" done awk
+		local 2>/dev/null printf 2>/dev/null awk local 2>/dev/null x=1 test
+		awk sed 2>/dev/null awk "$1" 2>/dev/null grep ${HOME} "$1" local then cd awk cd
+		test /usr/bin /usr/bin local then sed local "$1" sed sed ${HOME} local &&
+		grep && | "$@" 2>/dev/null x=1 test export grep
+	2>/dev/null local /usr/bin then grep && "$@" export
+	export sed --verbose | test "$@" /usr/bin cd sed printf local awk && ${HOME}
+		| test done local 2>/dev/null --verbose cd grep "$1" grep | awk
+	2>/dev/null printf sed local grep x=1
+		test then --verbose $(pwd) done /usr/bin done export
+readonly printf -eu --verbose done ${HOME} sed local test x=1 $(pwd) --verbose
+	2>/dev/null grep x=1 --verbose done 2>/dev/null
+	-eu echo grep $(pwd) grep
+	"$1" | 2>/dev/null readonly $(pwd) done ${HOME}
+	awk cd -eu $(pwd) --verbose cd | ${HOME} && -eu printf sed printf
+	readonly sed sed then 2>/dev/null $(pwd) --verbose ${HOME} 'quoted text'
+	grep -eu test $(pwd) && test x=1 test sed readonly 'quoted text' "$1" local
+readonly sed cd readonly sed $(pwd) readonly "$1" $(pwd) ${HOME} | "$@"
+		"$1" done sed awk test "$1" /usr/bin $(pwd) test awk
+-eu test /usr/bin -eu export && ${HOME} ${HOME} $(pwd) --verbose x=1 test
+	"$1" awk && done local "$1" echo
+	done x=1 readonly cd && | printf $(pwd) ${HOME} 2>/dev/null sed --verbose printf
+		export echo cd /usr/bin 2>/dev/null -eu cd awk |
+test local local awk -eu sed echo --verbose export
+		then ${HOME} $(pwd) local 2>/dev/null awk /usr/bin 'quoted text'
+		--verbose --verbose $(pwd) cd && --verbose grep grep
+| -eu 2>/dev/null then
+		$(pwd) readonly $(pwd) 'quoted text' grep local &&
+		"$1" readonly -eu printf local local awk export x=1 x=1 cd 2>/dev/null grep awk
+	${HOME} awk printf echo
+		--verbose local echo then "$1" $(pwd) | readonly awk done /usr/bin then
+		-eu x=1 test printf /usr/bin grep
+		sed sed local "$@" x=1 $(pwd) test | readonly ${HOME} ${HOME} awk 'quoted text'
+	${HOME} | sed -eu && "$1" awk test -eu "$1" ${HOME} 'quoted text' printf echo printf
+	'quoted text' x=1 cd export /usr/bin --verbose done echo done && 'quoted text'
+/usr/bin 'quoted text' $(pwd) $(pwd)
+		local --verbose /usr/bin -eu local | printf cd "$1" grep printf then
+awk cd readonly $(pwd) &&
+		&& --verbose /usr/bin 2>/dev/null done |
+		test -eu ${HOME} $(pwd) local && sed sed "$1" then && -eu $(pwd)
+echo ${HOME} "$1" sed $(pwd) --verbose && printf grep "$1" ${HOME} test export
+	| readonly 2>/dev/null printf export | echo ${HOME} && 'quoted text'
+	printf sed awk awk grep printf cd | 'quoted text' "$@" 'quoted text' "$@" -eu 'quoted text'
+		sed "$@" sed -eu export 'quoted text' readonly --verbose awk readonly |
+sed export 'quoted text' grep 'quoted text'
+	cd "$@" then export | export /usr/bin 2>/dev/null 2>/dev/null test sed
+		/usr/bin && local 'quoted text' local echo printf --verbose done --verbose x=1
+		${HOME} x=1 cd 2>/dev/null printf awk grep awk $(pwd)
+		| echo echo done local --verbose printf -eu "$@" ${HOME}
+${HOME} cd printf echo "$@" -eu
+	cd /usr/bin | 'quoted text' x=1 /usr/bin --verbose --verbose
+	printf readonly --verbose && 2>/dev/null && --verbose
+		local ${HOME} -eu readonly ${HOME} grep /usr/bin --verbose
+	${HOME} then 'quoted text' local cd -eu printf 2>/dev/null awk | then && | 'quoted text'
+	printf cd sed awk && -eu then --verbose /usr/bin "$1" printf "$@" -eu readonly
+		awk grep /usr/bin echo cd test "$1"
+		export ${HOME} grep done local cd "$@" awk "$@"
+cd /usr/bin printf 'quoted text' "$@" |
+	-eu 2>/dev/null test cd readonly
+2>/dev/null cd /usr/bin x=1 x=1 | grep $(pwd) printf x=1 /usr/bin
+	local x=1 x=1 done 'quoted text' "$@"
+echo awk printf && ${HOME} "$@" done sed local
+		x=1 cd export $(pwd) /usr/bin && readonly echo then
+"$1" --verbose x=1 test x=1 echo done ${HOME}
+cd ${HOME} echo cd -eu local
+	readonly ${HOME} export 2>/dev/null
+		done cd grep /usr/bin && echo awk
+local test 'quoted text'
+$(pwd) $(pwd) done echo "$1" printf
+	cd ${HOME} test --verbose "$1" | then 2>/dev/null ${HOME} sed 'quoted text'
+		2>/dev/null $(pwd) then awk
+$(pwd) awk sed "$1" test ${HOME} | awk && export "$@" sed echo
+		&& export then --verbose then printf
+	echo "$@" -eu done export echo
+		/usr/bin cd && echo export x=1 then cd 2>/dev/null
+	--verbose awk --verbose 2>/dev/null "$@" $(pwd) | echo | done export test
+test test then then 2>/dev/null local /usr/bin | -eu --verbose
+	awk grep /usr/bin printf done
+		"$@" /usr/bin sed grep $(pwd) 2>/dev/null 'quoted text'
+	${HOME} 2>/dev/null /usr/bin && "$@" test done echo 'quoted text' -eu local local
+		"$@" cd grep readonly ${HOME} --verbose done cd --verbose grep grep -eu
+"$1" 'quoted text' awk test && test printf -eu 2>/dev/null grep $(pwd) awk
+	export --verbose then "$@"
+		$(pwd) then -eu | /usr/bin done printf readonly local readonly readonly
+	grep "$@" x=1 awk && x=1 "$@" export grep | "$1" readonly then 'quoted text'
+	2>/dev/null readonly | then 'quoted text'
+awk $(pwd) 2>/dev/null "$@" 'quoted text'
+"$1" echo export sed cd
+cd echo local cd printf && | local awk then grep "$@" export "$1"
+		$(pwd) 'quoted text' sed sed --verbose cd "$1" --verbose sed grep readonly
+		test x=1 cd cd | local echo 2>/dev/null
+	"$1" grep --verbose readonly test 'quoted text' printf | 'quoted text' local
+	--verbose readonly cd export
+		sed --verbose grep /usr/bin done $(pwd)
+awk printf local | | readonly
+		then 2>/dev/null local $(pwd) sed then
+awk 2>/dev/null "$@" then readonly && && grep
+then done test done cd | --verbose /usr/bin 'quoted text' grep | echo then
+	readonly && readonly sed ${HOME} export local awk
+		$(pwd) local test -eu -eu
+	/usr/bin /usr/bin 2>/dev/null ${HOME} $(pwd) sed
+'quoted text' | readonly grep
+		awk 2>/dev/null | export awk
+	2>/dev/null 2>/dev/null && test
+		printf awk echo /usr/bin grep echo 2>/dev/null then awk readonly
+	"$@" -eu readonly test 2>/dev/null |
+		${HOME} done x=1 2>/dev/null cd awk test ${HOME} 'quoted text'
+	done ${HOME} -eu --verbose 'quoted text' sed done --verbose 2>/dev/null sed
+		| /usr/bin awk done done export 'quoted text'
+awk grep "$1" ${HOME} 'quoted text' "$1" awk "$1" 2>/dev/null -eu readonly done
+	then | test | 'quoted text' 2>/dev/null
+		/usr/bin 'quoted text' test x=1 local "$1" -eu -eu x=1 && then printf then $(pwd)
+		then local cd 2>/dev/null &&
+	/usr/bin "$@" awk $(pwd) readonly
+local "$1" echo readonly then export x=1 echo
+grep awk local done grep x=1 | -eu $(pwd) test export echo readonly ${HOME}
+		| test 2>/dev/null sed cd
+&& "$1" printf awk "$@" done done 2>/dev/null awk readonly 2>/dev/null
+	cd readonly local awk ${HOME} sed x=1 readonly then 2>/dev/null
+	$(pwd) sed 2>/dev/null "$1" --verbose readonly
+-eu 2>/dev/null x=1 | then 'quoted text' then $(pwd) 2>/dev/null local /usr/bin
+	readonly export 2>/dev/null echo cd readonly && ${HOME} x=1
+awk -eu grep "$@" done "$@" done | --verbose && /usr/bin
+	x=1 readonly "$1" echo x=1 echo -eu then
+		sed --verbose awk grep "$@" -eu 2>/dev/null --verbose
+/usr/bin "$@" | x=1 --verbose local "$@" sed printf 'quoted text' -eu 2>/dev/null
+	&& /usr/bin then -eu && "$1" $(pwd) "$@" | grep grep "$@" done "$1" done | ${HOME}
+test "$1" local test export cd sed /usr/bin ${HOME} grep echo | x=1 cd 'quoted text'
+	/usr/bin sed done echo | local then 2>/dev/null ${HOME}
+	cd | ${HOME} echo readonly -eu -eu echo /usr/bin
+		| export grep printf "$1" test export
+		${HOME} export x=1 --verbose sed "$1" done test "$@" /usr/bin /usr/bin
+	x=1 2>/dev/null cd then export
+sed | | -eu && "$1" | "$@" readonly
+		${HOME} awk --verbose echo awk done ${HOME} printf echo local test
+		"$1" cd "$@" -eu local | export sed $(pwd) cd /usr/bin /usr/bin --verbose &&
+		cd | awk 'quoted text' 2>/dev/null
+-eu 2>/dev/null grep "$1" "$1" "$@" "$1" | cd printf awk sed readonly grep
+	"$1" local 'quoted text' 'quoted text' | --verbose "$1"
+"$@" local export local test done sed awk cd /usr/bin done sed --verbose "$@"
+	readonly && test then readonly done && awk grep --verbose echo done
+		sed 'quoted text' awk 2>/dev/null "$1" && readonly test echo $(pwd) local
+	${HOME} echo then x=1 sed grep --verbose
+		cd "$1" printf --verbose cd grep then test && export
+	${HOME} x=1 test 2>/dev/null $(pwd)
+"$@" --verbose "$@" export
+"$1" local export -eu printf
+		'quoted text' "$1" sed cd "$@" readonly
+		&& done $(pwd) 2>/dev/null "$1" && $(pwd)
+printf readonly test done $(pwd) 'quoted text'
+		x=1 grep then /usr/bin cd
+		cd echo printf cd export "$1" test ${HOME} awk done $(pwd) --verbose
+	$(pwd) grep "$1" $(pwd) export | &&
+&& grep echo --verbose sed 'quoted text' && "$@" test local
+		2>/dev/null x=1 grep ${HOME} export done printf export 'quoted text' printf
+test grep grep export 2>/dev/null echo 'quoted text'
+	echo cd && sed /usr/bin then then export then /usr/bin ${HOME}
+		2>/dev/null sed | local export then cd cd grep echo /usr/bin -eu && 2>/dev/null
+printf | 'quoted text' && cd 2>/dev/null printf
+${HOME} done 2>/dev/null then ${HOME} 2>/dev/null 'quoted text' printf
+"$@" 'quoted text' && cd && $(pwd) "$@" readonly cd readonly x=1 done done "$1"
+		done sed test test local local then 'quoted text' readonly printf readonly
+		test --verbose "$1" grep "$1" cd ${HOME} sed readonly done 2>/dev/null "$@" done
+		&& echo -eu "$@" && 2>/dev/null
+&& awk then -eu 'quoted text' done &&
+readonly -eu sed -eu --verbose printf readonly
+		"$@" | ${HOME} local then x=1 awk /usr/bin "$1" 'quoted text'
+		echo awk -eu "$@" then done done | "$1" local
+		then local $(pwd) grep --verbose 'quoted text' ${HOME} printf test awk | echo
+&& test --verbose | test done /usr/bin &&
+&& && x=1 then local --verbose
+cd cd "$@" printf awk local
+export $(pwd) "$@" | grep test test grep 2>/dev/null done /usr/bin ${HOME}
+'quoted text' 2>/dev/null "$@" ${HOME} sed readonly local grep 'quoted text'
+sed sed grep awk $(pwd) done
+	echo export echo then $(pwd) /usr/bin export
+&& && -eu sed awk printf $(pwd) echo "$1" && 'quoted text' grep "$@" -eu export
+-eu then awk ${HOME} readonly export && awk grep
+test cd cd grep "$@" readonly done then awk readonly test ${HOME} x=1
+	grep echo grep test echo && "$1" "$@"
+	&& 'quoted text' 'quoted text'
+	grep "$@" grep echo /usr/bin | x=1 && echo test /usr/bin
+x=1 grep grep | x=1 && "$1" awk /usr/bin echo | 'quoted text' cd export
+/usr/bin printf then export export done 2>/dev/null
+		"$1" && awk x=1 sed 2>/dev/null then
+done ${HOME} printf 2>/dev/null test
+		"$@" then "$1" test export printf 'quoted text' && ${HOME} | local $(pwd)
+printf then "$@" -eu
+		&& sed | ${HOME} awk printf local sed -eu /usr/bin x=1 "$1" -eu echo sed 'quoted text'
+		cd local local $(pwd) export "$1" readonly
+"$1" 'quoted text' done "$@"
+	printf echo "$@" $(pwd) ${HOME} /usr/bin x=1
+cd export printf --verbose ${HOME} sed --verbose printf $(pwd) readonly export printf
+	"$1" "$1" x=1 $(pwd) echo local --verbose test readonly readonly
+"$1" export printf done /usr/bin "$@" sed $(pwd) readonly -eu sed
+export done done 2>/dev/null local sed $(pwd) cd 'quoted text' echo grep "$1" ${HOME}
+	--verbose echo sed -eu /usr/bin awk 2>/dev/null
+		"$@" x=1 "$@" && echo done --verbose awk
+x=1 | -eu ${HOME} cd then && test 2>/dev/null
+-eu local printf /usr/bin export "$1" 'quoted text' grep sed "$@" export
+		local 2>/dev/null readonly export
+	--verbose 2>/dev/null test local $(pwd) done done local
+	${HOME} cd readonly local $(pwd) local | local 'quoted text' 2>/dev/null && "$@"
+		done | "$@" && then then
+		echo --verbose local test ${HOME} $(pwd)
+cd grep $(pwd) then x=1 2>/dev/null 'quoted text' /usr/bin 2>/dev/null done && then
+	/usr/bin /usr/bin done "$1" x=1 "$@" --verbose sed export "$@" ${HOME} echo
+grep "$@" --verbose sed export echo
+	x=1 "$@" "$@" /usr/bin --verbose readonly sed sed
+"$1" printf && 'quoted text' done cd --verbose $(pwd)
+		2>/dev/null test grep echo x=1 readonly -eu grep awk cd export 2>/dev/null test
+2>/dev/null sed sed -eu && cd done local 2>/dev/null
+sed grep readonly then x=1 printf done ${HOME} local readonly
+		&& sed /usr/bin ${HOME} local grep echo /usr/bin
+		"$1" done then printf /usr/bin ${HOME}
+	local x=1 test "$@" ${HOME} $(pwd)
+		$(pwd) "$@" -eu $(pwd) readonly x=1 | /usr/bin
+	cd /usr/bin $(pwd) then 2>/dev/null /usr/bin printf readonly done --verbose -eu
+		-eu -eu -eu --verbose test grep printf test ${HOME} --verbose done
+awk $(pwd) cd 2>/dev/null | printf then export sed local echo
+	"$1" -eu export then 2>/dev/null && local && grep
+echo done && done export
+	local "$@" grep --verbose
+"$@" sed "$1" /usr/bin done
+	done --verbose 2>/dev/null 'quoted text' export --verbose printf 'quoted text'
+		export | readonly printf grep "$1" "$1" 'quoted text' 'quoted text' 2>/dev/null
+--verbose readonly $(pwd)
+'quoted text' local sed grep 'quoted text'
+	printf 2>/dev/null grep echo export "$1" echo x=1 local "$1" 2>/dev/null
+		"$1" x=1 --verbose printf 2>/dev/null test
+		-eu --verbose sed 'quoted text' sed readonly readonly "$1" grep x=1 then
+		"$1" echo local && -eu printf "$1" --verbose awk grep local 2>/dev/null sed -eu
+		echo awk grep -eu echo sed ${HOME} awk test x=1 local then ${HOME}
+		2>/dev/null readonly done --verbose sed cd export x=1 local x=1 awk "$1"
+		cd grep "$@" sed awk echo local awk readonly $(pwd) --verbose echo grep
+	awk awk -eu x=1 2>/dev/null
+	test $(pwd) printf && sed test /usr/bin grep
+	then printf "$1" 'quoted text' /usr/bin --verbose printf
+	awk /usr/bin | awk --verbose ${HOME} test
+/usr/bin grep 'quoted text' "$@" $(pwd) && --verbose
+	sed local "$@" 2>/dev/null cd "$1" printf 'quoted text' --verbose grep
+		-eu ${HOME} done export export test --verbose $(pwd) x=1 /usr/bin "$1" --verbose
+| grep local -eu ${HOME} "$1" 2>/dev/null
+		export "$1" then "$@" && awk $(pwd) /usr/bin export x=1
+	'quoted text' echo ${HOME} "$1" /usr/bin "$1" x=1 -eu export then test x=1
+readonly awk 2>/dev/null
+		${HOME} awk /usr/bin && -eu
+	x=1 $(pwd) then /usr/bin --verbose cd
+	sed /usr/bin "$1" 'quoted text' 'quoted text' /usr/bin /usr/bin
+	"$@" local grep export test 'quoted text'
+		&& cd x=1 -eu test x=1 "$@" ${HOME} x=1 x=1 grep grep printf
+$(pwd) done then test then printf "$@" sed readonly export 2>/dev/null ${HOME}
+	2>/dev/null grep export $(pwd) && "$@" ${HOME} -eu local --verbose done sed --verbose
+&& 'quoted text' cd -eu awk local
+&& "$@" "$1" | -eu then /usr/bin -eu awk local then sed
+		2>/dev/null && awk readonly export 'quoted text' 'quoted text' ${HOME}
+-eu done && export $(pwd) awk | printf "$1" sed ${HOME} grep "$1" $(pwd)
+	then x=1 awk --verbose readonly local /usr/bin "$1" -eu
+	"$1" -eu readonly local $(pwd) ${HOME}
+		2>/dev/null export test && printf printf --verbose then grep echo
+cd "$@" then 2>/dev/null && 2>/dev/null
+grep done grep "$@" $(pwd) export 'quoted text'
+"$@" --verbose test "$@" $(pwd) cd $(pwd) printf | printf x=1 echo grep
+test ${HOME} then "$1" -eu $(pwd) done local --verbose export
+		printf cd --verbose grep /usr/bin
+local export x=1 export $(pwd) ${HOME}
+	then local ${HOME} readonly 2>/dev/null
+test local "$@" | | --verbose
+	'quoted text' export done /usr/bin "$1" sed
+	$(pwd) --verbose sed then /usr/bin "$1" && && done export --verbose 'quoted text'
+"$1" printf $(pwd) done x=1 && sed awk -eu
+	&& test cd --verbose $(pwd) --verbose sed --verbose ${HOME}
+"$1" && && ${HOME} x=1 "$1" local x=1 echo "$1" grep sed && ${HOME}
+		sed -eu sed printf --verbose done local printf done then $(pwd) then /usr/bin
+		echo "$@" local echo then 'quoted text'
+		printf printf x=1 export then readonly $(pwd) --verbose then readonly
+	${HOME} printf readonly export awk x=1 done printf
+	awk 2>/dev/null readonly ${HOME} | grep "$1" 2>/dev/null ${HOME}
+		${HOME} x=1 ${HOME} 'quoted text'
+	grep export /usr/bin "$@" ${HOME} --verbose 'quoted text'
+readonly $(pwd) ${HOME} 2>/dev/null cd test test readonly 'quoted text'
+awk x=1 sed -eu $(pwd) "$@" x=1 ${HOME} echo --verbose $(pwd) --verbose $(pwd)
+grep "$@" grep x=1 "$1" ${HOME} x=1 awk local cd && then awk
+	x=1 printf printf printf done 2>/dev/null /usr/bin printf done cd cd 'quoted text'
+"$@" awk "$1" 2>/dev/null printf cd | readonly then cd then x=1 x=1
+		"$@" local && then printf "$@" | cd export
+	done | "$1" sed | grep readonly readonly | cd $(pwd) /usr/bin cd && echo |
+grep readonly export grep | echo 2>/dev/null readonly
+'quoted text' printf 'quoted text' /usr/bin --verbose printf && -eu test test
+		awk "$@" "$@" sed local 'quoted text' | done "$1" awk -eu && "$1" && "$1"
+	printf readonly "$@" "$1" sed &&
+		x=1 printf then && && local sed done sed printf --verbose $(pwd) "$1" "$@"
+	then | | "$@" x=1 grep cd grep test -eu export local cd $(pwd) test sed && |
+		x=1 --verbose | 'quoted text' printf awk |
+		-eu --verbose /usr/bin export && export sed &&
+	2>/dev/null export test grep ${HOME} 'quoted text' grep x=1
+export $(pwd) --verbose
+		2>/dev/null "$@" awk && | x=1 local readonly then local ${HOME} sed
+	echo && export x=1 echo -eu "$1" grep 'quoted text'
+		-eu then done export /usr/bin awk
+x=1 --verbose $(pwd) "$@" --verbose "$1" local
+		&& | readonly cd export && test readonly
+	2>/dev/null done echo 2>/dev/null 2>/dev/null local sed
+	| local cd awk grep then awk done x=1 echo then then export grep "$@" -eu $(pwd)
+	| done export then x=1 | done sed
+		local echo x=1 2>/dev/null echo ${HOME}
+printf cd echo printf sed export 'quoted text' "$@" | test done
+	"$@" test "$@" ${HOME} local
+--verbose ${HOME} "$@" x=1 /usr/bin printf local cd grep | | echo test
+		&& test done "$@" --verbose grep "$@" export ${HOME} && awk sed readonly
+		then && done /usr/bin -eu local export
+		then "$1" 'quoted text' local readonly then
+readonly /usr/bin cd 'quoted text' local local local grep 2>/dev/null
+		| readonly | export readonly test export export awk readonly
+		$(pwd) grep local local then "$1" sed ${HOME} --verbose
+		'quoted text' done readonly 2>/dev/null then "$@" --verbose
+		x=1 "$@" readonly awk 2>/dev/null "$@" local
+grep cd done | "$1" then --verbose ${HOME} | printf local then echo ${HOME}
+		grep echo "$@" | done && export "$1" 2>/dev/null printf
+		grep "$@" "$@" printf ${HOME} -eu /usr/bin | local 'quoted text' awk
+	/usr/bin readonly cd grep && echo &&
+readonly printf grep x=1 then local printf 'quoted text'
+		--verbose x=1 grep done "$1"
+		sed "$@" 2>/dev/null 2>/dev/null
+		"$@" cd $(pwd) --verbose done 'quoted text'
+		cd "$@" $(pwd) 'quoted text'
+		$(pwd) /usr/bin test readonly test export
+		readonly --verbose grep "$1" local printf awk cd && then
+${HOME} x=1 test export cd sed "$@" $(pwd)
+		"$1" -eu grep | done 'quoted text' cd && grep ${HOME} local grep --verbose && export
+'quoted text' awk 'quoted text' cd x=1
+	${HOME} --verbose ${HOME} x=1
+	printf -eu "$1" grep x=1 | | export done
+		cd | $(pwd) awk "$@" --verbose x=1 -eu
+"$1" printf 'quoted text' --verbose ${HOME}
+	2>/dev/null --verbose
+		done then test then sed printf ${HOME} cd &&
+		-eu grep -eu --verbose then x=1 export done | local | echo 'quoted text'
+${HOME} readonly --verbose cd local ${HOME} "$1" export awk
+test 'quoted text' 2>/dev/null x=1 awk | | 'quoted text' test
+	--verbose "$@" awk sed ${HOME} export x=1 && grep 'quoted text'
+sed | "$@" cd 2>/dev/null ${HOME} /usr/bin echo grep "$1" 'quoted text' $(pwd)
+x=1 2>/dev/null | && x=1 awk awk cd readonly grep --verbose
+export ${HOME} then readonly sed "$@" grep test --verbose then 2>/dev/null
+		then echo grep readonly --verbose grep readonly echo grep -eu
+export cd "$@" "$1" cd export
+		$(pwd) readonly "$1" x=1 readonly echo "$@" done
+	$(pwd) awk $(pwd) $(pwd) readonly --verbose 2>/dev/null
+		${HOME} then printf 2>/dev/null
+$(pwd) awk echo awk "$@" -eu echo ${HOME} ${HOME} done then
+		done -eu grep done then 'quoted text' --verbose
+	"$@" -eu "$1" $(pwd) "$@" then done readonly then local
+		'quoted text' sed && "$@" done
+		"$@" $(pwd) "$@" $(pwd) --verbose cd done /usr/bin
+	done test export awk grep
+	printf local sed | --verbose awk echo
+		x=1 done x=1 2>/dev/null done
+echo | | $(pwd) | "$1" -eu awk ${HOME} done $(pwd) ${HOME} --verbose then x=1
+		-eu awk cd "$@" "$@" "$1" done grep export readonly "$1" awk done
+	-eu 2>/dev/null export sed test readonly test test printf grep echo done -eu printf
+${HOME} /usr/bin ${HOME} $(pwd) | echo test readonly sed ${HOME}
+		'quoted text' echo --verbose "$1" | printf --verbose /usr/bin
+		-eu echo printf | printf
+		x=1 "$1" cd 2>/dev/null done | readonly
+	-eu 2>/dev/null /usr/bin 'quoted text'
+		${HOME} cd "$@" | echo grep && grep echo
+/usr/bin printf sed | 'quoted text' ${HOME}
+	'quoted text' 2>/dev/null export "$@" grep ${HOME} 2>/dev/null 'quoted text'
+		done -eu -eu ${HOME} grep 'quoted text'
+		test printf | export awk test |
+	x=1 $(pwd) | | | cd cd readonly x=1 cd local then /usr/bin awk | test
+	cd local awk | 2>/dev/null
+2>/dev/null test "$@" readonly "$@" x=1 --verbose
+--verbose sed then "$1" test
+printf then | ${HOME} "$1" $(pwd) done
+	2>/dev/null --verbose "$1" export "$1"
+		2>/dev/null cd "$@" readonly "$1" sed | local cd done ${HOME} printf 2>/dev/null
+	$(pwd) done printf | "$@" sed printf done --verbose grep ${HOME} |
+	--verbose /usr/bin echo done test 2>/dev/null
+2>/dev/null grep readonly "$1" --verbose local echo $(pwd)
+	grep $(pwd) -eu "$1" readonly | $(pwd) export "$@" "$1"
+		cd 'quoted text' readonly local 'quoted text'
+		--verbose "$1" test /usr/bin cd /usr/bin /usr/bin
+		$(pwd) done readonly export $(pwd) echo -eu 'quoted text' /usr/bin -eu "$1"
+export "$1" -eu then ${HOME}
+		grep then cd test cd -eu x=1 export sed "$@" 'quoted text' local 'quoted text'
+		awk 2>/dev/null export grep "$@" --verbose grep test -eu sed
+		export && 'quoted text' 2>/dev/null echo -eu "$@" 2>/dev/null
+	cd done /usr/bin "$1"
+	awk ${HOME} sed done -eu awk && x=1 'quoted text' 'quoted text'
+		echo -eu grep done sed "$@" | $(pwd) sed echo x=1 /usr/bin | /usr/bin awk
+	grep ${HOME} local readonly cd "$1" local 2>/dev/null printf 'quoted text'
+-eu local readonly printf cd sed
+	x=1 "$1" readonly sed cd cd cd "$1" then --verbose
+		"$1" --verbose ${HOME} -eu --verbose 'quoted text' echo test local sed printf
+		cd cd export readonly ${HOME} sed && ${HOME} test awk
+"$@" /usr/bin x=1 local 2>/dev/null 2>/dev/null sed -eu
+	test done done then printf x=1 "$@" /usr/bin done "$1" x=1 $(pwd)
+	export $(pwd) 2>/dev/null "$1"
+	printf "$1" cd awk then awk local local --verbose
+	awk "$@" "$@" local --verbose $(pwd) echo test test readonly -eu x=1 -eu
+		'quoted text' printf x=1 awk "$@" ${HOME} $(pwd) local "$1"
+echo 'quoted text' then sed /usr/bin cd sed 2>/dev/null cd 'quoted text' && "$1"
+		"$@" sed 'quoted text' cd 'quoted text' -eu export $(pwd) $(pwd) | sed 'quoted text'
+	then local grep "$1" 2>/dev/null readonly sed readonly -eu readonly readonly x=1
+local /usr/bin cd 2>/dev/null 2>/dev/null
+	awk then printf && cd ${HOME} "$1" --verbose test readonly
+cd sed test printf then then cd then sed done "$1" grep
+		${HOME} grep then && test cd awk readonly ${HOME} $(pwd) sed printf
+	"$@" sed | echo x=1 && 2>/dev/null
+local test done 2>/dev/null printf
+	grep done export 'quoted text'
+		export "$@" grep --verbose /usr/bin ${HOME}
+	"$1" echo then && local printf grep
+		$(pwd) export printf printf awk --verbose $(pwd)
+	cd then && --verbose | local test
+	readonly sed export "$1" "$1" test test
+done $(pwd) printf then 2>/dev/null
+		echo "$@" /usr/bin printf awk sed readonly
+	export 2>/dev/null "$@" then | /usr/bin printf
+		&& printf -eu sed grep export /usr/bin test done
+	done printf "$@" "$@" 2>/dev/null 'quoted text'
+		2>/dev/null local && export awk ${HOME}
+	done "$1" awk export -eu ${HOME} $(pwd)
+awk printf --verbose $(pwd) local -eu 'quoted text' echo -eu sed
+/usr/bin local /usr/bin /usr/bin "$1"
+	cd 'quoted text' ${HOME} --verbose --verbose x=1 test | --verbose
+'quoted text' -eu 2>/dev/null
+	test printf printf sed done $(pwd) grep 'quoted text' sed --verbose cd local export
+		test printf printf |
+	$(pwd) -eu --verbose sed export && export then
+		grep | export -eu export sed $(pwd) "$1" cd ${HOME}
+export && "$@" 'quoted text' 'quoted text' ${HOME} && export readonly
+done readonly done done echo printf printf /usr/bin export --verbose /usr/bin
+	then "$1" --verbose && -eu
+		awk then cd done x=1 && "$1" awk printf then | local 2>/dev/null local export
+	then 'quoted text' --verbose test test $(pwd) cd && readonly
+		&& then $(pwd) 'quoted text' sed awk test "$@" 2>/dev/null export x=1 echo
+		printf "$@" "$@" printf sed sed local x=1 'quoted text'
+	/usr/bin then $(pwd) awk --verbose x=1 awk | -eu local grep && $(pwd) && "$@" sed
+		export ${HOME} 'quoted text' local 'quoted text'
+		${HOME} readonly 'quoted text'
+		$(pwd) "$1" done "$1" --verbose printf 'quoted text' done -eu |
+readonly -eu && "$1" cd awk
+		${HOME} sed | -eu printf ${HOME} awk grep done
+		${HOME} readonly $(pwd)
+2>/dev/null grep test ${HOME} /usr/bin
+awk done done echo grep echo x=1 cd test export "$@" --verbose $(pwd)
+	$(pwd) export sed echo -eu local && awk "$@" then 'quoted text' | --verbose echo
+cd ${HOME} printf cd 'quoted text' then "$1" && ${HOME}
+	--verbose printf test export "$@" -eu echo "$@" export
+	echo export "$@" && local sed "$@" local sed sed cd then "$1" && | 2>/dev/null
+		| echo /usr/bin local | 2>/dev/null grep done then then sed readonly test cd &&
+		printf $(pwd) local --verbose printf
+		"$@" 'quoted text' sed sed $(pwd) printf $(pwd) "$@" |
+		echo $(pwd) "$@" export then /usr/bin x=1 | cd export 'quoted text'
+		2>/dev/null ${HOME} printf
+	| grep 2>/dev/null export grep test /usr/bin echo "$1"
+$(pwd) 2>/dev/null 'quoted text'
+		/usr/bin local test 2>/dev/null "$@"
+	'quoted text' cd printf test
+echo 2>/dev/null sed -eu "$@" "$@" sed done test | echo cd -eu | "$1" /usr/bin
+test -eu x=1 'quoted text' sed | printf test
+		echo && "$@" 'quoted text' $(pwd) 2>/dev/null local grep ${HOME}
+		awk "$1" x=1 export local echo export -eu echo ${HOME} cd "$1" printf -eu sed test
+--verbose x=1 local 2>/dev/null
+	"$@" sed $(pwd) x=1 cd echo "$1" --verbose export
+		printf /usr/bin ${HOME} cd x=1 --verbose "$@" printf
+echo echo cd "$@" && "$1" echo /usr/bin /usr/bin grep $(pwd) cd $(pwd)
+		printf /usr/bin cd --verbose 'quoted text' 2>/dev/null
+$(pwd) && readonly cd
+		x=1 --verbose x=1 ${HOME} ${HOME} x=1 --verbose
+		"$@" export echo "$1" 'quoted text' readonly then -eu export
+		test awk echo done sed local
+		--verbose --verbose test printf && -eu grep done
+grep done --verbose "$1" done "$1" x=1 x=1 ${HOME} echo test
+		awk grep printf --verbose
+	"$@" echo readonly cd $(pwd) readonly
+awk printf printf $(pwd) x=1 then done $(pwd)
+		| && test --verbose 'quoted text' then sed && 'quoted text'
+		'quoted text' -eu done done --verbose "$@" export /usr/bin export done
+	sed ${HOME} $(pwd) test && awk && --verbose 'quoted text' grep test test
+	grep sed x=1 ${HOME} done export /usr/bin -eu --verbose done 2>/dev/null /usr/bin
+		local printf --verbose | then /usr/bin then
+	'quoted text' /usr/bin "$@"
+	${HOME} && && test echo -eu grep printf readonly export
+		2>/dev/null | printf then
+	x=1 sed then readonly --verbose
+	printf echo x=1 grep awk then
+	-eu cd 2>/dev/null ${HOME} sed
+	"$@" sed 2>/dev/null /usr/bin done x=1 'quoted text'
+		printf /usr/bin "$1" sed export "$1" readonly "$@"
+	-eu echo cd 'quoted text' -eu 2>/dev/null awk x=1 | grep "$1" local ${HOME} readonly
+2>/dev/null awk x=1 printf $(pwd)
+grep done printf --verbose then "$1" echo
+	printf awk 'quoted text' then grep /usr/bin -eu | export export echo x=1 x=1
+$(pwd) local "$1" export | done cd -eu cd cd "$@" "$@" awk --verbose cd done
+		/usr/bin printf grep $(pwd) done export "$1" "$1" then
+		export ${HOME} printf | | /usr/bin 2>/dev/null
+	test ${HOME} --verbose /usr/bin 2>/dev/null --verbose -eu
+	grep "$1" 2>/dev/null cd && ${HOME} readonly cd $(pwd) 2>/dev/null
+	"$1" | && $(pwd) printf "$@" echo 'quoted text' grep awk sed readonly then
+	/usr/bin local --verbose grep local "$1" readonly "$1" 'quoted text'
+/usr/bin && grep -eu printf
+		'quoted text' cd $(pwd) /usr/bin 2>/dev/null
+	local /usr/bin "$@" local grep echo ${HOME} test printf | cd grep ${HOME}
+printf 2>/dev/null then printf -eu ${HOME} "$1" "$@" "$@" test
+		| $(pwd) printf | printf -eu /usr/bin
+echo export -eu then sed awk /usr/bin test | export done sed /usr/bin
+	test -eu export export /usr/bin readonly x=1 "$@" --verbose
+		then awk x=1 2>/dev/null awk local
+	cd /usr/bin && 'quoted text'
+	then ${HOME} grep readonly -eu --verbose --verbose grep echo "$@" "$@" $(pwd)
+	export && awk readonly cd
+		&& --verbose awk | 2>/dev/null x=1 | /usr/bin grep $(pwd) "$1" "$@" && then echo
+	$(pwd) then echo awk -eu | sed --verbose printf then -eu grep done sed 'quoted text'
+		2>/dev/null 2>/dev/null echo
+echo printf then echo awk local ${HOME} cd grep awk local -eu "$@" grep echo export
+awk 'quoted text' sed x=1 local local echo /usr/bin
+cd printf ${HOME} printf sed x=1 local 'quoted text'
+		then readonly awk sed grep printf $(pwd)
+	'quoted text' "$@" printf
+		&& 'quoted text' done ${HOME} ${HOME} sed readonly
+		local "$@" sed done x=1 local 'quoted text'
+	&& printf sed 2>/dev/null local | echo ${HOME} echo export "$@" --verbose
+	grep done export then "$1" 2>/dev/null cd printf sed /usr/bin cd 'quoted text' "$1"
+	| --verbose "$@" local 2>/dev/null "$1"
+test sed local test $(pwd) -eu --verbose $(pwd) $(pwd)
+	export then ${HOME} "$1" sed printf test readonly && $(pwd) done
+		-eu grep sed -eu "$1" done readonly && /usr/bin --verbose test -eu done
+		cd /usr/bin then "$1" /usr/bin 'quoted text' $(pwd) "$1" export test sed 2>/dev/null
+printf readonly -eu x=1 && -eu "$1" readonly | echo sed
+	then printf grep $(pwd) test printf then echo $(pwd) awk --verbose
+		${HOME} echo local /usr/bin test | then sed /usr/bin -eu grep | $(pwd) local grep
+&& then awk $(pwd) then
+	echo "$@" cd 2>/dev/null ${HOME} --verbose local "$@" "$@" local -eu
+x=1 'quoted text' local --verbose 2>/dev/null cd readonly awk then
+	test /usr/bin "$@" 2>/dev/null test
+-eu x=1 cd cd x=1 echo
+	2>/dev/null "$1" echo export awk local ${HOME} cd | done test done ${HOME} /usr/bin
+		readonly local done done /usr/bin sed && done readonly cd sed then
+	x=1 grep then x=1 | done -eu
+		/usr/bin printf $(pwd) sed local
+grep "$@" "$@" grep local local local -eu -eu export
+		test && --verbose --verbose "$@" x=1 cd echo cd local "$1" echo ${HOME} $(pwd)
+	local cd "$@" cd printf x=1 awk test then
+		/usr/bin "$1" cd readonly
+		grep /usr/bin ${HOME} ${HOME} local awk printf printf awk done sed
+	"$1" | sed 'quoted text' local local
+'quoted text' awk /usr/bin local printf && 2>/dev/null
+		awk /usr/bin export sed sed --verbose local ${HOME} readonly ${HOME} 'quoted text'
+$(pwd) local 'quoted text'
+		readonly 'quoted text'
+"$1" done 'quoted text' test ${HOME} echo export
+"$1" local -eu then sed /usr/bin cd done ${HOME} sed grep x=1
+	$(pwd) "$@" done awk ${HOME} /usr/bin export printf "$@" export then
+	| 'quoted text' && -eu done --verbose /usr/bin test 'quoted text'
+		awk | test grep x=1 "$@" 'quoted text' grep grep "$1" "$@" done test test
+| /usr/bin $(pwd) grep readonly
+printf cd | test cd local local export ${HOME} export then grep done printf
+	$(pwd) sed 'quoted text' ${HOME}
+readonly cd grep sed 'quoted text' | readonly ${HOME}
+		grep echo echo printf "$@"
+		printf sed echo export
+	then then then 'quoted text' --verbose sed printf
+		printf 2>/dev/null $(pwd) export x=1 "$1" grep "$@"
+	/usr/bin readonly ${HOME}
+	-eu x=1 echo x=1 export "$1" && sed
+	sed local readonly then "$1" | ${HOME} readonly x=1 then local export |
+		"$1" printf awk /usr/bin "$@" | | x=1 echo /usr/bin then echo readonly ${HOME}
+| done && grep then printf echo cd export readonly 'quoted text' then 2>/dev/null
+then 2>/dev/null local "$1" -eu 'quoted text' echo sed | export test
+	"$1" awk 'quoted text' -eu printf
+		$(pwd) -eu export | "$1" 2>/dev/null cd 2>/dev/null
+"$1" done test --verbose | | "$1" && cd
+	&& 2>/dev/null | done "$1"
+-eu 2>/dev/null export /usr/bin /usr/bin --verbose
+	$(pwd) printf $(pwd) cd sed grep | printf local "$@" $(pwd) export echo 'quoted text'
+	test x=1 "$@" local echo | /usr/bin
+${HOME} "$1" done /usr/bin echo "$@" grep readonly && -eu awk awk local
+		grep /usr/bin then readonly local --verbose local
+		$(pwd) "$@" x=1 $(pwd) awk /usr/bin echo | ${HOME}
+'quoted text' readonly cd printf awk local && printf test echo
+		sed awk 2>/dev/null ${HOME}
+		export x=1 /usr/bin /usr/bin printf
+/usr/bin local local /usr/bin 2>/dev/null
+		--verbose echo | -eu 2>/dev/null printf
+	test then 'quoted text' test test awk
+	&& 2>/dev/null local sed
+-eu | awk ${HOME} echo /usr/bin "$@" ${HOME} "$1" --verbose
+| then /usr/bin then export test export
+		readonly 2>/dev/null "$1" x=1 readonly
+	'quoted text' export 'quoted text' cd echo -eu -eu ${HOME} then 2>/dev/null
+		test local && && grep
+	local done then sed sed cd test grep 2>/dev/null && && then sed
+		export echo --verbose -eu cd | 2>/dev/null "$@" readonly
+| echo sed ${HOME} export
+		printf sed -eu grep && export then sed grep sed printf -eu local echo | awk x=1
+		test echo ${HOME} export sed 'quoted text' /usr/bin grep $(pwd)
+export $(pwd) 'quoted text'
+"$1" "$1" --verbose --verbose awk
+		then --verbose --verbose local echo /usr/bin sed cd local /usr/bin "$@" 2>/dev/null
+		'quoted text' test --verbose
+	test awk -eu /usr/bin --verbose
+	awk $(pwd) 2>/dev/null -eu /usr/bin
+		"$1" 2>/dev/null $(pwd) ${HOME} printf -eu sed
+		| "$@" "$1" $(pwd) awk && sed printf echo ${HOME}
+test sed && readonly ${HOME}
+	'quoted text' done "$1" -eu "$1" printf done
+done 'quoted text' 2>/dev/null --verbose local x=1 awk --verbose |
+-eu awk "$1" grep x=1 sed /usr/bin sed
+	local then export "$1" grep 'quoted text'
+#include c70.sh
+awk grep grep $(pwd) x=1 cd x=1 'quoted text' cd "$1" grep &&
+local sed readonly -eu
+awk ${HOME} cd 2>/dev/null grep cd then "$@" local 2>/dev/null done
+		--verbose grep cd test sed local x=1 x=1 "$@" x=1 test
+local 'quoted text' | echo
+	sed echo $(pwd) --verbose cd grep 2>/dev/null &&
+$(pwd) readonly -eu export sed cd /usr/bin cd && 2>/dev/null ${HOME} awk
+		sed 'quoted text' readonly $(pwd)
+	grep $(pwd) sed cd awk && ${HOME}
+$(pwd) test $(pwd) printf | $(pwd) ${HOME}
+		readonly echo ${HOME} export 'quoted text' done && && printf test --verbose
+awk export -eu 'quoted text'
+		-eu readonly ${HOME} /usr/bin local test local sed cd "$1"
+		-eu 'quoted text' awk printf grep 2>/dev/null cd x=1 $(pwd)
+		"$@" export test then export
+		x=1 then grep echo grep $(pwd) "$@" && --verbose
+done $(pwd) awk /usr/bin /usr/bin ${HOME} done -eu done grep local
+		"$@" cd x=1 awk "$@" local 2>/dev/null
+		"$@" grep && then "$@" $(pwd)
+	then printf printf readonly ${HOME}
+echo 'quoted text' "$1" printf echo "$1" grep | "$@" 2>/dev/null
+/usr/bin "$@" "$1" "$@" export
+		local x=1 grep x=1 test x=1 done --verbose then export done $(pwd)
+		awk sed done && "$1" ${HOME} test "$1" grep x=1 printf test "$1" cd grep grep
+		grep readonly grep -eu done local awk export
+echo "$@" && readonly done /usr/bin awk readonly
+| "$@" 2>/dev/null "$@" "$@"
+${HOME} $(pwd) -eu cd local readonly ${HOME}
+		local then then x=1 test then 2>/dev/null sed 'quoted text' grep
+export --verbose done export then $(pwd)
+export $(pwd) readonly readonly ${HOME} sed
+		export x=1 x=1 ${HOME} "$1" 'quoted text'
+cd ${HOME} echo echo echo "$1" $(pwd) cd x=1 && grep
+		then $(pwd) $(pwd) | ${HOME} awk sed x=1 --verbose /usr/bin sed ${HOME} done
+	${HOME} done cd test 2>/dev/null $(pwd)
+"$1" cd test readonly && readonly --verbose local | -eu /usr/bin
+	readonly 2>/dev/null -eu --verbose "$1" grep echo export 'quoted text'
+/usr/bin $(pwd) | then printf && && cd /usr/bin done
+-eu && readonly awk export grep
+then ${HOME} test 'quoted text'
+sed x=1 --verbose then echo | local grep ${HOME} printf "$1" /usr/bin echo
+		'quoted text' printf "$1" test x=1 && then
+	-eu local $(pwd) export 2>/dev/null 'quoted text'
+then then x=1 ${HOME} -eu /usr/bin "$@" --verbose
+		/usr/bin echo 'quoted text' "$@" -eu -eu ${HOME} export 2>/dev/null
+		echo "$@" --verbose --verbose
+	export && awk --verbose 2>/dev/null local && --verbose
+	"$1" /usr/bin test cd -eu ${HOME} readonly x=1 'quoted text' "$@" -eu "$@" done
+&& sed done sed 2>/dev/null $(pwd) "$1" awk
+		echo printf grep then awk export
+	readonly ${HOME} grep "$1" echo
+2>/dev/null /usr/bin && ${HOME}
+readonly local export cd done done done local test awk -eu | "$@" /usr/bin
+		'quoted text' export printf echo
+	done --verbose | $(pwd) awk && grep echo then x=1 echo 2>/dev/null grep /usr/bin
+echo printf 'quoted text' then echo "$@" ${HOME} printf export "$1" --verbose 2>/dev/null
+	"$@" | test readonly export /usr/bin cd readonly x=1 /usr/bin $(pwd) readonly
+		cd test -eu && --verbose printf --verbose test "$@" |
+		--verbose awk printf echo ${HOME} -eu --verbose
+		cd sed -eu 2>/dev/null echo "$1" readonly awk x=1 /usr/bin
+		sed && -eu | -eu /usr/bin
+cd readonly "$@" -eu -eu --verbose awk awk test /usr/bin grep --verbose test cd
+		&& "$1" awk sed cd /usr/bin
+printf export grep grep grep
+	cd test "$@" 2>/dev/null cd ${HOME} -eu --verbose --verbose printf x=1
+		2>/dev/null x=1 | export awk then cd 2>/dev/null
+	--verbose test && "$@" grep x=1 echo 2>/dev/null cd "$1"
+		grep $(pwd) 2>/dev/null
+	grep "$@" test cd awk "$1" 2>/dev/null x=1 --verbose sed 2>/dev/null "$1"
+		${HOME} x=1 awk then x=1 /usr/bin 2>/dev/null printf awk ${HOME}
+sed && 2>/dev/null done --verbose "$@" then echo then && | done
+		'quoted text' ${HOME} $(pwd) "$1" -eu readonly $(pwd) 2>/dev/null
+sed -eu export "$1" -eu "$@" | readonly printf awk sed | sed
+	2>/dev/null local ${HOME} | export ${HOME} sed grep | -eu --verbose
+	&& local ${HOME} ${HOME} echo awk ${HOME} sed test test 2>/dev/null
+test test test echo -eu -eu "$1" 2>/dev/null -eu 'quoted text' echo "$1"
+then --verbose 2>/dev/null
+		"$1" x=1 test local 2>/dev/null
+	| "$1" cd | "$1" then done awk local --verbose
+done local done /usr/bin sed $(pwd) "$1" -eu echo sed awk
+	local then done done | x=1 ${HOME} printf "$@"
+test local awk grep 2>/dev/null $(pwd) /usr/bin -eu cd "$1" cd printf export ${HOME}
+	'quoted text' local local readonly /usr/bin sed readonly local readonly
+export "$1" export -eu printf then done
+x=1 then "$@" echo sed 2>/dev/null sed 2>/dev/null
+	awk then export test 'quoted text'
+		then awk printf $(pwd) 'quoted text' awk x=1
+		sed done ${HOME} /usr/bin export local ${HOME} -eu done
+local ${HOME} 2>/dev/null "$1"
+		test done /usr/bin cd then test --verbose --verbose "$1" ${HOME} -eu
+readonly "$@" $(pwd) then && -eu "$@" ${HOME} sed cd && sed
+export awk test /usr/bin 2>/dev/null test test then "$1" grep export awk grep
+then grep --verbose "$1" 'quoted text' -eu -eu && test
+		grep --verbose then "$@" done readonly ${HOME} 'quoted text' && &&
+| x=1 sed printf 'quoted text' x=1 printf -eu "$@"
+	printf ${HOME} cd grep export | readonly -eu ${HOME} readonly
+echo && "$@" -eu cd local -eu --verbose
+		grep awk awk echo 'quoted text'
+	printf export grep 'quoted text' sed
+&& then echo local "$1" readonly && 'quoted text'
+		"$1" sed sed test "$1" "$@" /usr/bin then | 2>/dev/null test cd readonly
+local then done --verbose readonly --verbose cd | local test
+		| grep done | 'quoted text' echo local export "$@" echo --verbose -eu
+		${HOME} x=1 && --verbose sed
+	grep --verbose --verbose 'quoted text' cd export cd $(pwd) echo ${HOME}
+	local && x=1 awk x=1 $(pwd) printf then readonly done 'quoted text' done -eu &&
+	x=1 test echo then export export $(pwd) awk export 2>/dev/null sed export --verbose
+grep 2>/dev/null ${HOME}
+cd export "$1" test awk local "$@" cd 'quoted text' export
+	&& local cd | echo test awk "$@" && -eu -eu && x=1 export -eu echo
+$(pwd) test awk test sed export -eu awk $(pwd)
+		test sed && done readonly 'quoted text' ${HOME} /usr/bin test local
+	cd 'quoted text' done export --verbose | done
+	"$@" && local echo grep grep "$1"
+	export printf grep "$@" done 2>/dev/null
+$(pwd) -eu sed "$@" "$@" 'quoted text' test
+	$(pwd) --verbose -eu | ${HOME}
+test -eu done x=1 cd export --verbose ${HOME} then -eu
+		printf "$@" test readonly export
+		export test local 2>/dev/null ${HOME} && export done
+done done "$@" cd /usr/bin "$@" grep sed then ${HOME} readonly readonly
+x=1 -eu /usr/bin "$@" echo &&
+		| && $(pwd) sed 2>/dev/null then "$1"
+	done ${HOME} | echo export grep done
+		grep /usr/bin --verbose 'quoted text' | | done x=1 x=1 then
+		grep printf 'quoted text' $(pwd)
+	$(pwd) test awk printf local readonly echo --verbose
+	done "$@" 2>/dev/null test 'quoted text'
+cd readonly 'quoted text' ${HOME} ${HOME}
+-eu done && "$1" 'quoted text' ${HOME} printf
+		done "$@" echo grep --verbose then awk local | sed done /usr/bin /usr/bin readonly
+	echo && 2>/dev/null ${HOME} 2>/dev/null grep 2>/dev/null readonly
+		awk /usr/bin test done --verbose local readonly awk
+		awk "$@" ${HOME} done test && | grep echo readonly local -eu test
+	${HOME} then awk && $(pwd) /usr/bin | && awk | printf echo done grep
+		'quoted text' sed test local --verbose
+| -eu cd cd | "$@" 2>/dev/null && 2>/dev/null local cd readonly
+	/usr/bin -eu --verbose "$1" 2>/dev/null cd ${HOME} sed grep done sed x=1 test export
+done /usr/bin done 2>/dev/null | "$1" local printf then echo readonly
+		done done done local local export grep -eu then "$@" $(pwd) echo -eu grep grep
+		/usr/bin 2>/dev/null awk
+/usr/bin sed 'quoted text' local echo grep readonly
+grep -eu 2>/dev/null awk local
+	local x=1 --verbose | $(pwd)
+	grep sed 2>/dev/null --verbose local -eu "$1" --verbose "$@" x=1
+$(pwd) --verbose "$@" cd readonly done x=1 x=1 --verbose
+"$@" /usr/bin "$@" $(pwd) printf
+then "$1" cd export ${HOME} readonly
+-eu --verbose /usr/bin --verbose $(pwd)
+--verbose x=1 $(pwd) && echo --verbose
+	&& --verbose grep --verbose
+--verbose 2>/dev/null $(pwd) awk awk -eu then test "$@" /usr/bin
+		2>/dev/null 2>/dev/null x=1 done | done 2>/dev/null /usr/bin then done "$1" local
+${HOME} 'quoted text' printf && --verbose
+		${HOME} /usr/bin done --verbose
+	"$1" "$@" /usr/bin $(pwd) /usr/bin "$1" cd printf local
+	x=1 2>/dev/null readonly x=1 grep | readonly "$1" grep export export
+&& /usr/bin 'quoted text' printf echo then readonly cd | grep | then | cd
+echo "$1" printf "$@" readonly "$@"
+	export sed sed test "$1" sed
+		sed grep "$1" local 2>/dev/null
+		printf printf local awk
+then sed readonly $(pwd) -eu then $(pwd) printf | export
+	x=1 "$1" ${HOME} -eu printf
+	/usr/bin "$@" ${HOME} "$1" done -eu export awk x=1 "$1" 2>/dev/null /usr/bin
+	test 2>/dev/null 2>/dev/null 'quoted text' -eu ${HOME} $(pwd)
+then | test echo "$1" "$@" awk printf 2>/dev/null x=1 "$1"
+	printf $(pwd) then -eu test
+		readonly awk "$@" ${HOME} sed "$1" sed /usr/bin "$@"
+	2>/dev/null 'quoted text' && done cd awk "$1" printf x=1 awk export 'quoted text'
+	"$1" --verbose x=1 test /usr/bin -eu /usr/bin $(pwd)
+	"$1" printf awk awk -eu --verbose cd ${HOME} done done
+"$1" local sed x=1 local && -eu && then echo export -eu | | | export awk
+/usr/bin 'quoted text' --verbose export x=1 sed "$1" "$1" /usr/bin
+		grep then sed x=1 x=1
+		export grep grep x=1 -eu done sed local /usr/bin
+$(pwd) 2>/dev/null ${HOME} $(pwd) | | local x=1 export printf sed 'quoted text'
+		"$@" 2>/dev/null export awk && printf -eu ${HOME} && local ${HOME} 'quoted text'
+-eu ${HOME} /usr/bin local cd sed printf
+	| 'quoted text' && --verbose 'quoted text' then awk --verbose readonly test test
+	--verbose "$1" x=1 -eu test awk grep "$1" -eu echo
+	local readonly export | grep | --verbose local
+readonly grep done $(pwd) awk && done grep x=1 -eu /usr/bin echo
+		x=1 printf test 'quoted text' ${HOME} cd export /usr/bin "$@" local
+	"$1" 2>/dev/null x=1 "$1" echo echo sed $(pwd) export then cd then done
+2>/dev/null sed --verbose
+		sed --verbose 2>/dev/null then sed
+		-eu 2>/dev/null grep 'quoted text' done | && done "$@" readonly
+	/usr/bin $(pwd) x=1 --verbose then
+local echo -eu ${HOME} "$1" sed done export -eu && awk printf
+		awk printf $(pwd) printf local then echo ${HOME} echo "$@"
+	x=1 then $(pwd) && test local test grep done "$@" test sed $(pwd) local
+	'quoted text' cd grep printf $(pwd)
+	&& local awk "$1" then echo export printf
+	&& /usr/bin /usr/bin echo ${HOME} && readonly readonly test "$@" grep local --verbose
+		done -eu grep grep | printf
+-eu -eu x=1 && -eu done "$1"
+	cd && 'quoted text' cd /usr/bin x=1 2>/dev/null readonly
+	echo printf sed $(pwd) then export echo
+	"$1" | test grep cd 'quoted text' test -eu 2>/dev/null
+	cd export | -eu -eu x=1 export readonly -eu printf 'quoted text' ${HOME}
+	${HOME} export grep x=1 done /usr/bin
+		done export x=1 -eu --verbose 'quoted text' grep "$1" /usr/bin $(pwd) 'quoted text'
+	${HOME} x=1 $(pwd) cd
+printf | /usr/bin sed && test "$1"
+local 'quoted text' --verbose
+printf cd $(pwd) readonly "$1" x=1 ${HOME} sed printf local sed /usr/bin x=1 --verbose
+/usr/bin -eu /usr/bin -eu done cd
+	local x=1 printf $(pwd) -eu /usr/bin ${HOME} |
+'quoted text' local cd local --verbose | --verbose "$@" x=1 local cd sed
+readonly /usr/bin $(pwd) export ${HOME} awk awk
+	--verbose 2>/dev/null 'quoted text' then readonly "$@" x=1 echo
+		"$@" "$1" $(pwd) ${HOME} 2>/dev/null
+export echo 2>/dev/null 2>/dev/null $(pwd) | readonly done --verbose done
+		sed printf 'quoted text' done "$@"
+	$(pwd) 'quoted text' "$1"
+export awk 'quoted text' test
+	readonly "$@" done /usr/bin 'quoted text' readonly ${HOME}
+		&& 'quoted text' local
+	local echo export "$@" readonly ${HOME} -eu then "$@" readonly $(pwd) | $(pwd)
+	cd readonly then cd --verbose 'quoted text' sed
+| readonly awk then 2>/dev/null
+done export ${HOME} cd && echo readonly
+	$(pwd) /usr/bin -eu --verbose grep --verbose | --verbose printf x=1 readonly
+		local $(pwd) x=1 "$@" "$@" printf
+		-eu --verbose local local | readonly awk cd sed test export && "$@" x=1 awk
+		x=1 cd x=1 done test | sed 'quoted text'
+'quoted text' sed awk ${HOME} $(pwd) test grep then test then | done export x=1
+/usr/bin $(pwd) --verbose ${HOME} 'quoted text'
+	-eu && export local echo test 2>/dev/null "$@" done then
+| x=1 cd then ${HOME} | then grep ${HOME} -eu /usr/bin
+export export export export --verbose test ${HOME} && local local &&
+&& grep export done x=1
+${HOME} 2>/dev/null local then
+grep --verbose -eu /usr/bin x=1 $(pwd) "$1" local ${HOME} -eu
+	${HOME} && 'quoted text' $(pwd) && sed && cd "$1" sed
+/usr/bin printf echo --verbose printf "$@" cd /usr/bin --verbose
+		test printf echo /usr/bin grep echo --verbose 'quoted text'
+	"$1" echo /usr/bin done printf cd $(pwd) awk -eu test
+${HOME} awk -eu grep 'quoted text'
+-eu then -eu $(pwd) | done
+"$1" 2>/dev/null ${HOME}
+		"$@" done -eu 2>/dev/null done test
+		printf local && then && echo readonly "$1" test
+readonly local $(pwd) ${HOME} && printf
+		${HOME} /usr/bin /usr/bin
+export "$@" 'quoted text' ${HOME} local printf test local
+		grep then cd sed ${HOME} && "$@" cd
+		awk --verbose 'quoted text' && /usr/bin /usr/bin | /usr/bin export x=1 test
+	&& ${HOME} local | $(pwd) 2>/dev/null x=1 done -eu printf
+		echo sed grep test done sed $(pwd) -eu -eu local $(pwd) local
+	/usr/bin "$@" -eu sed --verbose readonly awk -eu cd echo export cd && "$1" sed
+	2>/dev/null 'quoted text' local $(pwd) grep local test /usr/bin
+/usr/bin "$@" -eu test
+echo export sed | x=1 printf awk | export echo cd | readonly && /usr/bin
+		&& x=1 echo $(pwd) ${HOME} done grep export cd 2>/dev/null /usr/bin
+x=1 x=1 then sed --verbose test
+	then 2>/dev/null sed test test x=1 -eu readonly --verbose
+-eu "$@" "$1" x=1 --verbose printf "$1"
+	sed "$1" cd echo awk grep then --verbose
+--verbose printf test cd done echo "$@" printf
+--verbose printf --verbose done
+&& 2>/dev/null ${HOME} readonly local
+then "$@" grep cd "$1" $(pwd) $(pwd) local
+cd then x=1 x=1 && | done 'quoted text'
+sed -eu then awk grep 'quoted text' -eu
+printf grep awk export grep printf $(pwd) echo sed 2>/dev/null
+		| /usr/bin then export local | awk -eu export && printf "$1" x=1 cd echo
+		--verbose "$1" done echo && then
+	test awk ${HOME} test
+		then "$1" ${HOME} local awk local done then 2>/dev/null cd 2>/dev/null
+${HOME} then cd grep echo "$@" $(pwd) "$@" readonly
+printf then --verbose x=1 'quoted text'
+	$(pwd) printf export test echo test printf local sed
+	cd /usr/bin 'quoted text'
+	'quoted text' printf then "$1" -eu sed export 2>/dev/null sed --verbose
+test printf grep -eu awk readonly
+${HOME} x=1 && then sed 'quoted text' awk --verbose ${HOME}
+test local "$@" done ${HOME}
+x=1 ${HOME} $(pwd) | then printf done | $(pwd) "$1" local readonly "$1" done test
+| test 2>/dev/null ${HOME} "$@" awk test sed readonly sed x=1 awk --verbose
+--verbose -eu "$@" done "$1" 'quoted text'
+&& test test --verbose
+	$(pwd) done | printf export local 2>/dev/null x=1 cd | cd
+		printf && cd $(pwd) --verbose -eu sed --verbose local
+		done sed 'quoted text' awk printf "$1" $(pwd) "$1" sed
+		"$@" x=1 cd ${HOME} "$1" echo /usr/bin "$1"
+	then -eu readonly 'quoted text' export
+readonly | 2>/dev/null x=1
+	export grep printf --verbose readonly /usr/bin 2>/dev/null printf $(pwd)
+		test && printf -eu -eu grep | --verbose "$1" export
+	&& -eu test awk test ${HOME}
+&& test ${HOME} "$@" sed printf awk -eu then 'quoted text' export sed 'quoted text'
+done /usr/bin export then awk readonly
+sed readonly readonly
+	"$1" then done /usr/bin -eu cd && test 2>/dev/null -eu
+grep done "$1" printf readonly x=1 'quoted text' sed && /usr/bin -eu && local
+		readonly export ${HOME} -eu $(pwd)
+	done | test cd "$@" export "$1"
+echo /usr/bin readonly
+	echo done /usr/bin local readonly 2>/dev/null -eu "$1" | printf
+echo x=1 x=1 export -eu awk local grep sed readonly echo ${HOME}
+		"$@" done readonly 2>/dev/null
+$(pwd) done cd printf awk /usr/bin | awk done echo
+then export sed cd grep --verbose /usr/bin printf x=1 grep x=1 grep test $(pwd)
+	awk $(pwd) "$@" then export done test
+		local test /usr/bin $(pwd) -eu test grep /usr/bin printf
+${HOME} ${HOME} && sed 'quoted text' printf
+	sed cd 'quoted text' printf
+		-eu --verbose printf export test test "$@" cd echo sed x=1
+	readonly grep && printf 2>/dev/null x=1
+		then then cd then 'quoted text'
+		&& | "$@" ${HOME} "$@" ${HOME} then export 'quoted text' /usr/bin
+"$1" --verbose 2>/dev/null echo "$@" $(pwd)
+	done "$1" "$@" -eu grep 'quoted text' $(pwd) cd ${HOME} grep /usr/bin local
+		&& -eu readonly awk echo export printf grep -eu /usr/bin
+${HOME} $(pwd) && x=1 2>/dev/null then
+		| printf echo printf "$1" -eu export cd x=1 x=1 awk | test grep then
+	| --verbose -eu cd printf 'quoted text' readonly "$@" 'quoted text'
+		&& test export $(pwd) "$1"
+		${HOME} grep export printf "$1" && echo printf awk $(pwd) --verbose | awk readonly
+		test $(pwd) sed /usr/bin grep "$1" grep "$@" sed | local 2>/dev/null
+x=1 -eu 2>/dev/null test done awk echo
+	cd | local 'quoted text' awk local export
+		--verbose -eu readonly "$@" then test local &&
+--verbose local -eu readonly sed grep sed readonly
+2>/dev/null ${HOME} --verbose export ${HOME} --verbose --verbose
+cd --verbose -eu sed done && | 2>/dev/null sed cd local "$1" test
+&& cd "$@" 'quoted text' 'quoted text' /usr/bin done done
+	| && then cd cd $(pwd) sed && -eu "$1" cd local sed test ${HOME}
+	-eu --verbose ${HOME} -eu test echo export 2>/dev/null printf cd
+		"$@" | grep printf "$@" awk printf
+		&& 'quoted text' "$@" "$1" | readonly ${HOME} sed
+	export "$1" $(pwd) test x=1 test export | --verbose export
+$(pwd) 2>/dev/null x=1 "$1" "$1" ${HOME} ${HOME}
+	local ${HOME} sed awk then local awk | "$@" /usr/bin awk
+	grep 2>/dev/null -eu grep sed /usr/bin | awk
+	-eu test echo 2>/dev/null $(pwd) printf 2>/dev/null -eu "$1"
+		readonly echo /usr/bin awk grep grep then
+	done printf done x=1 "$1" && done printf local export then then grep ${HOME}
+		then ${HOME} sed "$@" echo cd $(pwd) done grep
+		'quoted text' ${HOME} 'quoted text' readonly done
+-eu -eu test x=1 readonly | /usr/bin sed x=1 'quoted text' readonly
+awk awk 'quoted text' local awk --verbose "$1" /usr/bin
+local $(pwd) x=1 --verbose ${HOME} | awk printf cd
+test readonly --verbose awk then
+--verbose echo sed ${HOME} then then "$@" -eu local awk sed
+		-eu "$@" grep readonly --verbose local && echo awk
+--verbose && "$@" && then ${HOME}
+		'quoted text' readonly /usr/bin 2>/dev/null $(pwd) --verbose local 'quoted text'
+	"$@" $(pwd) sed ${HOME} sed
+		/usr/bin done printf done -eu
+--verbose cd && --verbose /usr/bin --verbose
+&& echo 'quoted text' $(pwd) readonly printf | "$@" cd awk printf "$@" | cd $(pwd)
+		'quoted text' cd done
+		| printf /usr/bin $(pwd) -eu --verbose /usr/bin echo done
+cd test readonly then -eu local $(pwd) local --verbose
+awk x=1 cd local then --verbose | -eu 'quoted text' awk printf --verbose
+		"$1" 'quoted text' cd then cd readonly printf echo echo | &&
+sed | $(pwd) sed done "$1" local echo 'quoted text' cd
+	x=1 $(pwd) /usr/bin local $(pwd) test && $(pwd) x=1 |
+cd 2>/dev/null awk x=1 then && awk "$1"
+	${HOME} local $(pwd) done "$1"
+	readonly test 'quoted text' test done 2>/dev/null
+	/usr/bin /usr/bin cd --verbose
+	grep x=1 echo done echo local 'quoted text' -eu $(pwd)
+		export 2>/dev/null | ${HOME} --verbose | 'quoted text' echo done
+	readonly echo export 'quoted text' grep then -eu local 2>/dev/null export test readonly
+		-eu "$@" "$1" then grep then cd printf
+echo "$@" && 2>/dev/null export
+	then cd -eu 2>/dev/null export
+		awk export 'quoted text' echo echo cd grep cd "$@" grep
+	grep "$1" $(pwd) --verbose ${HOME} readonly | -eu && && ${HOME}
+	2>/dev/null local "$1" echo
+		-eu cd awk awk 'quoted text'
+	cd done 'quoted text' $(pwd) local sed | "$1" && printf test "$1"
+echo local grep -eu readonly
+	${HOME} --verbose $(pwd) cd x=1 --verbose | printf
+	grep ${HOME} x=1 cd x=1 echo --verbose export -eu then
+printf "$@" ${HOME} && 'quoted text' local grep ${HOME} awk then readonly
+cd grep && 'quoted text' done && && "$1" done then echo echo done
+	echo export 2>/dev/null done
+sed then 'quoted text' $(pwd) printf readonly "$@" export "$@" sed cd -eu
+readonly $(pwd) sed echo test awk echo
+done local --verbose readonly /usr/bin |
+	done grep -eu "$@" readonly
+		readonly export export 2>/dev/null then done "$1" printf readonly local sed "$1"
+	-eu then x=1 awk awk done cd printf $(pwd) "$1" test sed "$1" done printf
+cd -eu echo -eu export "$1" | echo export
+	grep --verbose local local sed x=1 grep --verbose ${HOME}
+	test && "$1" echo $(pwd) 'quoted text' ${HOME} x=1 export done sed local
+		| test then cd cd local "$@"
+		local | export "$@" 2>/dev/null awk done && /usr/bin echo
+export "$@" ${HOME} printf /usr/bin done 'quoted text' echo sed grep 'quoted text'
+		then --verbose echo printf "$1" "$@" $(pwd) "$@" done
+	2>/dev/null printf "$@" 'quoted text'
+	export echo | test export cd
+		/usr/bin echo "$@" test "$@" test "$@" grep && x=1 'quoted text' $(pwd) ${HOME}
+$(pwd) test | $(pwd) 2>/dev/null sed local -eu
+	done local 2>/dev/null -eu -eu x=1 done && -eu ${HOME} sed sed --verbose echo
+		'quoted text' "$1" done awk $(pwd) x=1 | echo 'quoted text'
+		/usr/bin then 2>/dev/null printf 'quoted text' 'quoted text' sed echo "$@"
+	done $(pwd) --verbose then printf | ${HOME} local then $(pwd) sed ${HOME} && 'quoted text'
+| then /usr/bin readonly local printf awk 'quoted text'
+	/usr/bin cd cd --verbose awk done export test 2>/dev/null 2>/dev/null
+echo local | ${HOME} done 'quoted text' 2>/dev/null grep readonly
+	&& grep echo printf "$@" 2>/dev/null done done $(pwd) echo "$@" -eu && "$1" &&
+	export done 'quoted text' /usr/bin x=1 done
+		echo /usr/bin --verbose | test /usr/bin sed
+		echo done "$1" "$@" awk export
+		cd && grep echo grep test ${HOME}
+	| grep "$@" local local then echo 'quoted text'
+		/usr/bin -eu -eu 'quoted text'
+grep cd local | export "$@" sed grep local "$1" "$1" test
+	sed x=1 | 'quoted text'
+grep "$1" /usr/bin ${HOME} /usr/bin --verbose /usr/bin | printf "$1" &&
+	done 2>/dev/null echo "$1" then cd
+$(pwd) && grep "$1" && local
+	cd test readonly --verbose 'quoted text' 2>/dev/null grep && echo x=1
+${HOME} export readonly
+printf then $(pwd) test awk echo x=1 -eu readonly "$1" local
+	local grep test readonly grep -eu test echo echo done echo x=1 printf -eu
+		"$@" && ${HOME} $(pwd) test
+grep --verbose cd cd export export then then cd grep test "$@" x=1 awk cd grep
+	then echo /usr/bin readonly readonly /usr/bin "$1" export "$@" done
+"$1" --verbose then $(pwd) awk grep -eu grep --verbose
+	/usr/bin readonly 2>/dev/null awk "$1" $(pwd) done grep echo export
+	readonly local && test /usr/bin awk export awk "$1" "$@"
+"$@" done $(pwd) && "$1" cd readonly awk --verbose done readonly cd
+	test && "$1" done export "$@" then local export echo sed
+x=1 sed done done ${HOME} grep "$@" awk |
+	"$@" test --verbose --verbose readonly
+	echo | $(pwd) done test done
+	'quoted text' grep "$@" /usr/bin printf grep --verbose
+test echo export awk --verbose /usr/bin export $(pwd) && --verbose
+awk && /usr/bin local 'quoted text' done
+		2>/dev/null --verbose done
+	then --verbose export done 2>/dev/null | readonly test --verbose export
+	"$1" | done ${HOME} ${HOME} x=1 echo local ${HOME} 'quoted text' awk
+echo /usr/bin | export sed readonly
+grep --verbose export "$1" grep 2>/dev/null export printf export
+local local readonly $(pwd) | awk printf grep readonly
+	awk sed $(pwd) then "$1" $(pwd) readonly
+		sed then awk "$@" done awk "$@" test cd -eu export
+	$(pwd) printf x=1 local /usr/bin "$@" done ${HOME} $(pwd)
+done done done 2>/dev/null
+"$1" "$1" x=1 --verbose --verbose /usr/bin -eu printf done -eu
+export "$@" -eu | done -eu x=1 printf
+	-eu readonly sed --verbose $(pwd) 2>/dev/null
+		export done -eu /usr/bin then printf x=1 readonly
+		readonly x=1 | cd test 'quoted text' test x=1 sed --verbose | "$1" cd awk
+printf echo sed readonly --verbose readonly export
+		/usr/bin cd 2>/dev/null awk grep readonly ${HOME} echo
+	local && local echo printf ${HOME} "$@" && && readonly
+		done /usr/bin 'quoted text' /usr/bin printf 'quoted text' test "$1"
+		export /usr/bin echo --verbose
+	"$@" ${HOME} echo x=1 test then test
+	--verbose "$@" 2>/dev/null done then printf
+	printf local && done test awk $(pwd)
+then 2>/dev/null x=1 cd awk awk 2>/dev/null --verbose
+	done /usr/bin done && 2>/dev/null /usr/bin "$1" done
+-eu echo export --verbose cd 'quoted text'
+	/usr/bin printf 'quoted text' 2>/dev/null
+		awk test /usr/bin sed sed "$1" awk && -eu $(pwd) | export readonly -eu readonly
+	${HOME} --verbose grep echo then grep && local -eu sed awk | 'quoted text'
+	then cd grep export && sed /usr/bin --verbose x=1 "$1" sed "$1" awk sed
+${HOME} -eu 'quoted text' -eu grep local && cd echo ${HOME} sed export local then
+| done done readonly printf /usr/bin /usr/bin grep $(pwd)
+awk | ${HOME} export cd local awk printf /usr/bin -eu ${HOME} local -eu --verbose
+	&& awk grep ${HOME} grep
+test local $(pwd) /usr/bin printf
+		done "$1" | $(pwd) /usr/bin "$@" readonly local cd sed cd readonly readonly
+		"$@" ${HOME} /usr/bin test 'quoted text' | then awk
+		$(pwd) grep "$1" done grep ${HOME} export
+readonly local then 'quoted text'
+		done --verbose $(pwd) echo cd --verbose
+		awk grep printf && "$1" sed "$1" "$@" then then
+test local printf cd ${HOME} done
+sed then awk echo | ${HOME} | test "$1" then
+readonly local && | awk export printf sed cd sed test readonly "$1"
+		&& /usr/bin | sed then "$@" 'quoted text' x=1 | ${HOME}
+		"$@" /usr/bin printf export
+	&& /usr/bin export printf then test done -eu sed x=1 readonly
+		$(pwd) | 2>/dev/null sed grep 'quoted text' -eu awk --verbose done
+		cd echo --verbose export && done
+		readonly "$1" x=1 /usr/bin sed --verbose sed
+then /usr/bin 'quoted text' done export $(pwd) 'quoted text' done &&
+echo sed --verbose export
+		test done sed sed $(pwd) "$@" && echo awk cd echo echo
+		grep echo test grep sed readonly
+export echo cd "$1" cd printf done printf && readonly x=1 "$1"
+	&& test sed 'quoted text' 2>/dev/null
+	--verbose done readonly --verbose
+		| -eu 2>/dev/null "$@" x=1 --verbose sed | 'quoted text'
+		awk cd done | $(pwd) 'quoted text' test sed sed -eu sed cd local sed 'quoted text'
+"$@" echo sed /usr/bin readonly
+grep done printf -eu $(pwd) x=1
+	| echo export test done $(pwd) export echo export
+awk then echo sed /usr/bin 'quoted text' x=1 grep printf --verbose cd sed test
+printf echo export /usr/bin cd "$1" test done done 'quoted text'
+	| done readonly | x=1 test
+'quoted text' readonly readonly printf "$@" --verbose "$1" "$1" done
+		then 'quoted text' grep echo readonly
+	grep cd && "$1" printf test
+	done readonly then sed
+		cd then test sed 2>/dev/null
+		| then | | then | x=1 readonly sed -eu sed printf "$@" x=1 -eu cd /usr/bin
+		--verbose echo test $(pwd) then export cd awk $(pwd) cd readonly printf
+2>/dev/null local then export "$1" "$1" -eu "$@" export
+	awk $(pwd) echo echo readonly
+		${HOME} local grep cd cd 'quoted text' -eu echo cd export done then local then awk
+-eu grep && printf | && local readonly
+	export /usr/bin && ${HOME} printf echo
+	$(pwd) 'quoted text' "$1"
+		"$@" done x=1 done x=1 grep "$1" test /usr/bin then /usr/bin
+		then done sed x=1 ${HOME} then
+"$1" /usr/bin cd 2>/dev/null local then && then done
+cd sed done | --verbose test
+	-eu "$@" sed local local | "$1" "$1" /usr/bin sed done
+		'quoted text' ${HOME}
+	sed awk | x=1 readonly awk 'quoted text' export local sed x=1 ${HOME} cd
+'quoted text' /usr/bin readonly export readonly
+'quoted text' cd readonly /usr/bin test
+	awk local done local && | 2>/dev/null 2>/dev/null echo && cd x=1 "$1"
+	local then export cd 2>/dev/null
+	$(pwd) then "$1" export --verbose
+$(pwd) printf 2>/dev/null grep sed printf && $(pwd) 'quoted text' ${HOME}
+cd $(pwd) readonly test export
+grep sed test echo local
+	2>/dev/null test /usr/bin
+		| then readonly sed grep ${HOME} "$@" ${HOME} sed printf cd && done cd && sed
+		2>/dev/null echo readonly | x=1 done
+		cd ${HOME} x=1 ${HOME} && printf then 'quoted text' then
+		done local awk test then readonly 'quoted text' then cd then x=1
+cd sed sed /usr/bin done
+		done /usr/bin grep "$1" /usr/bin cd printf printf sed
+done test 'quoted text' $(pwd) test test awk sed
+	printf grep x=1 echo --verbose 'quoted text' export cd -eu "$1"
+		-eu && local local cd "$@" /usr/bin awk printf x=1 $(pwd) 'quoted text'
+	/usr/bin done && sed "$@" export "$@" && sed readonly echo grep -eu printf 'quoted text'
+	${HOME} ${HOME} done 'quoted text'
+	export | --verbose -eu x=1 grep readonly printf sed
+	/usr/bin 2>/dev/null export
+	printf sed && echo awk readonly && grep
+local 'quoted text' cd ${HOME} export 2>/dev/null "$1" x=1
+/usr/bin | --verbose then test 2>/dev/null local /usr/bin
+readonly test "$@" printf x=1 local 2>/dev/null local && --verbose --verbose
+		cd && 2>/dev/null export "$@" then done x=1 $(pwd)
+	"$1" test 2>/dev/null /usr/bin --verbose
+		'quoted text' test -eu export readonly
+	grep echo cd sed test done done ${HOME} readonly cd sed awk readonly
+cd /usr/bin printf 2>/dev/null "$@" --verbose done readonly "$@"
+x=1 sed 'quoted text' $(pwd) test sed
+	&& done export "$1" /usr/bin export --verbose ${HOME} done awk sed
+	printf printf readonly then
+	done awk grep -eu done 'quoted text'
+	| | 2>/dev/null "$@" readonly /usr/bin printf sed then ${HOME} "$1"
+	2>/dev/null awk local ${HOME}
+grep -eu $(pwd) test cd "$@" readonly echo readonly local local $(pwd) && ${HOME}
+		cd sed printf export sed --verbose
+		sed then "$@" ${HOME} "$1" then ${HOME} | $(pwd)
+x=1 | $(pwd) done 'quoted text' x=1 2>/dev/null cd
+	done cd echo export grep -eu --verbose local -eu
+		${HOME} echo /usr/bin grep --verbose cd export "$1" awk then done
+local printf "$@" -eu then grep cd /usr/bin --verbose
+	$(pwd) then cd --verbose done
+local "$@" readonly -eu 2>/dev/null "$@" /usr/bin 'quoted text' done
+		local export echo printf | echo then
+	printf "$@" --verbose printf --verbose 2>/dev/null
+		${HOME} then sed ${HOME} "$1" -eu $(pwd) "$@" echo then export
+		test | cd 'quoted text' 'quoted text'
+'quoted text' "$@" grep sed 'quoted text'
+		test echo "$@" /usr/bin sed ${HOME} $(pwd)
+	test printf | then 2>/dev/null /usr/bin sed echo
+awk cd "$1" "$1" done 'quoted text'
+		cd "$1" awk printf printf grep export grep
+		"$1" test then printf ${HOME}
+printf then test local "$1" cd grep ${HOME} -eu done ${HOME}
+		sed | 2>/dev/null && --verbose test cd then 'quoted text'
+	x=1 ${HOME} 2>/dev/null cd done awk "$@" -eu cd cd done sed test "$1" done 'quoted text'
+awk then --verbose awk ${HOME} readonly /usr/bin 'quoted text' |
+		-eu test 2>/dev/null 'quoted text' grep readonly /usr/bin awk sed test
+		"$@" awk echo --verbose "$1" -eu
+		local cd --verbose then $(pwd) done
+	awk "$1" done cd -eu awk test grep
+$(pwd) "$@" export && -eu test awk
+		done local "$@" && 2>/dev/null 2>/dev/null ${HOME} "$@" echo export local
+		grep local ${HOME} then sed export then 2>/dev/null
+		2>/dev/null | && done 2>/dev/null local --verbose 2>/dev/null ${HOME} test local
+	cd 2>/dev/null printf then | test printf printf 2>/dev/null readonly ${HOME} x=1
+/usr/bin $(pwd) && export "$1" echo grep ${HOME} /usr/bin /usr/bin --verbose -eu
+		cd -eu /usr/bin $(pwd)
+	--verbose sed awk "$@"
+		local readonly sed printf 2>/dev/null test readonly $(pwd)
+		| --verbose -eu export cd
+	/usr/bin 2>/dev/null ${HOME} $(pwd) 2>/dev/null
+		| export printf x=1 && --verbose /usr/bin "$@"
+	x=1 export "$1" sed ${HOME} grep grep &&
+	local then "$1" x=1 echo export $(pwd) 'quoted text' echo x=1 /usr/bin
+"$@" awk x=1 test | done sed then 2>/dev/null 'quoted text'
+	$(pwd) $(pwd) 'quoted text' test
+grep export && local "$@" sed
+2>/dev/null | "$1" grep
+then cd --verbose | $(pwd) sed readonly local $(pwd) $(pwd) readonly
+		test test printf awk test x=1
+"$1" 2>/dev/null 'quoted text' |
+		readonly "$@" grep "$1" sed echo | 'quoted text'
+awk done test x=1 readonly /usr/bin sed done export readonly
+		--verbose --verbose echo cd grep --verbose
+		local && --verbose done --verbose && | local -eu then
+	$(pwd) x=1 echo $(pwd) cd 'quoted text' export 2>/dev/null
+export cd test then --verbose then awk 2>/dev/null /usr/bin /usr/bin
+		then then awk awk "$1" grep
+		2>/dev/null && && 'quoted text' test test readonly 'quoted text'
+		&& 'quoted text' export cd -eu -eu grep test sed echo /usr/bin
+	--verbose sed done 2>/dev/null x=1 | "$@" local -eu --verbose x=1 -eu 2>/dev/null
+	${HOME} export --verbose && done test $(pwd) "$1"
+		then local sed --verbose export cd && --verbose
+		local local "$1" printf /usr/bin "$1" export --verbose done
+		cd ${HOME} test && readonly
+		-eu cd /usr/bin export printf cd && "$1"
+grep awk "$1" printf done x=1
+2>/dev/null 2>/dev/null | cd "$1" printf "$@" /usr/bin -eu "$1"
+		"$1" cd test readonly /usr/bin readonly | 'quoted text' x=1 2>/dev/null
+		echo 'quoted text' printf $(pwd) ${HOME} x=1
+	echo $(pwd) export x=1 "$1" awk 2>/dev/null -eu export
+	"$1" local grep $(pwd) -eu printf then /usr/bin 'quoted text'
+done printf -eu -eu sed then --verbose done "$1" export $(pwd) done then "$@"
+	local "$@" | | 'quoted text' local sed readonly
+		$(pwd) test /usr/bin then x=1 awk local 2>/dev/null readonly echo echo /usr/bin
+	readonly ${HOME} "$1" done /usr/bin local --verbose awk x=1
+	awk cd awk then test ${HOME} "$@" --verbose
+local --verbose printf then 2>/dev/null printf printf readonly x=1 local
+grep grep test 2>/dev/null ${HOME} /usr/bin "$@" echo 2>/dev/null "$@"
+		2>/dev/null -eu ${HOME} "$1" printf x=1 printf printf done
+	grep then printf printf $(pwd) test
+		local --verbose "$@" printf export test done awk awk "$@" printf
+		-eu awk export -eu awk done done -eu "$@" sed export grep awk echo
+	echo local local /usr/bin then sed export local 2>/dev/null local
+	local ${HOME} 'quoted text' "$1" x=1 && sed --verbose
+	grep /usr/bin "$@" "$1" printf test readonly readonly 2>/dev/null 2>/dev/null
+		${HOME} sed printf --verbose -eu
+	&& sed ${HOME} -eu printf -eu local grep
+x=1 ${HOME} 2>/dev/null "$1" $(pwd) then ${HOME} awk export 'quoted text'
+	"$@" sed printf awk "$1" grep export --verbose export ${HOME} readonly
+		&& sed "$@" 'quoted text' x=1
+	awk 2>/dev/null && local done cd test "$1" x=1 awk local local 2>/dev/null 'quoted text'
+	local "$@" $(pwd) readonly -eu export test 2>/dev/null 2>/dev/null awk cd done
+		--verbose ${HOME} printf 2>/dev/null readonly && /usr/bin
+	grep readonly "$1" sed $(pwd) grep "$@" sed x=1 --verbose
+		$(pwd) --verbose local -eu export done 2>/dev/null
+	local local x=1 echo 'quoted text' $(pwd) /usr/bin
+		test $(pwd) printf printf sed
+--verbose done grep readonly readonly x=1
+2>/dev/null echo --verbose | && done grep sed
+	local && grep --verbose test done 2>/dev/null ${HOME} /usr/bin 'quoted text'
+		"$1" sed && 2>/dev/null echo sed local cd
+		--verbose test -eu x=1 cd
+	awk 2>/dev/null then 'quoted text' 'quoted text' x=1 grep |
+test ${HOME} local echo awk 2>/dev/null x=1 "$1" sed ${HOME} 'quoted text'
+/usr/bin awk awk && "$1" export echo cd awk export test |
+		2>/dev/null then readonly printf
+awk test 'quoted text' -eu --verbose "$@" 'quoted text' sed
+-eu readonly 2>/dev/null local then local
+		x=1 awk done "$@" $(pwd) test
+${HOME} test "$1" 2>/dev/null $(pwd) then export --verbose "$1" 'quoted text'
+		done readonly sed 2>/dev/null export printf readonly x=1
+		x=1 echo done test sed printf --verbose && awk grep $(pwd)
+done /usr/bin x=1 ${HOME} printf test
+		export printf then done ${HOME}
+${HOME} export then readonly readonly sed local 2>/dev/null printf
+		printf "$1" echo "$@" echo -eu
+		awk "$@" && done "$@" -eu 2>/dev/null --verbose /usr/bin readonly
+		local readonly /usr/bin echo 'quoted text' /usr/bin | 'quoted text'
+--verbose 2>/dev/null then 2>/dev/null done && then
+	echo 2>/dev/null --verbose ${HOME} awk done then then "$@" cd
+	local --verbose --verbose "$@" done grep ${HOME} printf "$@" ${HOME} ${HOME}
+&& "$1" ${HOME} | readonly
+	sed export 2>/dev/null ${HOME} done /usr/bin 'quoted text'
+	$(pwd) printf /usr/bin "$@" | sed test 'quoted text'
+	local awk 'quoted text' --verbose | export
+	'quoted text' && /usr/bin grep $(pwd) echo grep /usr/bin grep
+		sed | /usr/bin export cd --verbose cd /usr/bin
+	"$@" -eu readonly test $(pwd) 2>/dev/null export test sed | 2>/dev/null awk printf
+/usr/bin then local then test 2>/dev/null ${HOME}
+		"$@" /usr/bin "$1" && ${HOME} --verbose x=1 -eu cd echo x=1 $(pwd) sed 'quoted text'
+		x=1 /usr/bin done "$@" done 'quoted text' /usr/bin echo ${HOME} | cd
+		echo echo readonly ${HOME} $(pwd)
+		"$@" | echo --verbose && then awk /usr/bin printf cd cd "$@" --verbose echo test
+		then test awk local /usr/bin printf && $(pwd)
+	then grep export x=1 local 2>/dev/null -eu
+	--verbose 'quoted text' $(pwd) then x=1 printf "$@" then echo x=1
+		"$1" $(pwd) "$@" $(pwd)
+	-eu $(pwd) "$1" cd -eu done x=1 /usr/bin readonly 2>/dev/null
+	"$@" done --verbose done x=1 $(pwd) printf --verbose 2>/dev/null 2>/dev/null
+	&& | x=1 readonly x=1 --verbose 'quoted text' 2>/dev/null
+	done "$1" /usr/bin then echo 2>/dev/null cd export ${HOME} local | 'quoted text'
+	then --verbose "$1" printf
+	'quoted text' 'quoted text' export
+	export printf /usr/bin echo local
+	sed echo cd test done
+		--verbose echo grep printf local && x=1 export
+	then -eu echo 2>/dev/null
+		sed grep x=1 printf /usr/bin /usr/bin "$1" 'quoted text' test export 2>/dev/null
+local -eu "$@" $(pwd) ${HOME} then "$@" /usr/bin local readonly
+		$(pwd) sed -eu printf awk awk | "$1" 2>/dev/null /usr/bin 'quoted text'
+x=1 local sed | "$@" local /usr/bin 2>/dev/null ${HOME}
+	--verbose 2>/dev/null awk 'quoted text'
+| export && /usr/bin /usr/bin -eu local x=1 "$@" grep -eu
+		echo done export then test awk echo done awk echo grep 'quoted text'
+printf "$1" "$1" --verbose echo local "$@" "$1" "$@" awk ${HOME}
+cd sed $(pwd) ${HOME} x=1 cd then "$1" 'quoted text'
+	'quoted text' $(pwd) done 2>/dev/null 'quoted text' 2>/dev/null 2>/dev/null
+/usr/bin cd readonly --verbose echo cd test x=1 local
+		"$1" ${HOME} -eu export ${HOME} then export
+sed /usr/bin awk | "$1" "$1" 2>/dev/null /usr/bin
+		grep "$1" export --verbose export printf awk ${HOME}
+		grep grep x=1 2>/dev/null export
+	${HOME} printf readonly | export export /usr/bin -eu -eu /usr/bin
+	awk grep export && export local ${HOME}
+		grep ${HOME} export then && cd then ${HOME} -eu test "$@"
+sed -eu x=1 then export sed done readonly /usr/bin test then
+printf awk grep ${HOME} $(pwd) then awk
+		sed /usr/bin ${HOME} echo
+		2>/dev/null /usr/bin echo 'quoted text' cd done readonly awk printf then
+awk cd printf export "$@" then printf && grep printf
+2>/dev/null "$@" -eu printf test --verbose 2>/dev/null echo "$@" export
+		${HOME} grep test test readonly
+cd | done echo test $(pwd) sed "$@"
+		sed test then echo grep cd cd
+$(pwd) export readonly local "$1" -eu awk export readonly "$1" export
+	--verbose -eu printf x=1 'quoted text' export | /usr/bin --verbose local readonly
+		local "$@" local then $(pwd) test
+printf awk sed $(pwd) readonly x=1 sed |
+		test printf cd printf test printf echo 2>/dev/null "$@" cd
+	x=1 --verbose then cd x=1 awk "$@" local &&
+cd printf cd printf 2>/dev/null "$1" -eu readonly readonly then
+		printf export 'quoted text' local then $(pwd) then
+		"$@" x=1 2>/dev/null cd
+	"$1" 2>/dev/null "$@" sed x=1 echo grep
+	then $(pwd) $(pwd) --verbose echo 2>/dev/null ${HOME} readonly
+		printf $(pwd) echo && $(pwd) x=1 2>/dev/null
+$(pwd) | "$1" /usr/bin printf 2>/dev/null --verbose sed test --verbose
+"$1" echo && && && export |
+&& "$@" --verbose $(pwd) "$@" --verbose && 'quoted text' x=1 2>/dev/null
+		echo /usr/bin -eu /usr/bin
+		cd local | 'quoted text' sed --verbose
+	done && 'quoted text' printf && /usr/bin export readonly x=1 echo -eu "$1"
+		-eu "$@" 2>/dev/null readonly /usr/bin -eu -eu "$1" test grep sed awk
+-eu echo printf && test | then
+		printf --verbose awk cd sed
+	x=1 export export /usr/bin && 'quoted text' awk
+		then sed x=1 && then then cd $(pwd)
+	2>/dev/null /usr/bin then test $(pwd) echo && local echo sed
+		-eu echo readonly x=1 printf sed local ${HOME}
+		-eu echo /usr/bin cd printf
+	| $(pwd) 'quoted text'
+done "$1" sed && sed --verbose cd
+	export | done /usr/bin done "$1" 2>/dev/null | local 'quoted text' readonly
+cd /usr/bin /usr/bin export test
+		x=1 /usr/bin 'quoted text' --verbose awk local 'quoted text'
+local export export -eu /usr/bin
+	done /usr/bin done | "$1" readonly
+'quoted text' /usr/bin 2>/dev/null --verbose
+${HOME} /usr/bin readonly ${HOME}
+then test x=1 2>/dev/null readonly then "$1" local grep "$1"
+	done "$1" && then test x=1 2>/dev/null echo done ${HOME} ${HOME} 2>/dev/null
+	export $(pwd) /usr/bin ${HOME} x=1 grep "$1" sed 2>/dev/null $(pwd)
+	$(pwd) --verbose "$@" readonly && local
+&& && ${HOME} | 2>/dev/null export x=1 then -eu && && -eu done test then
+	$(pwd) export --verbose $(pwd) awk grep local grep
+		then 'quoted text' awk 'quoted text'
+	"$1" then && $(pwd) cd "$@" cd -eu local --verbose "$1" 2>/dev/null echo
+		${HOME} done done export sed
+		local -eu "$1" done sed --verbose grep -eu cd printf /usr/bin grep x=1 grep
+		"$@" $(pwd) && readonly done -eu ${HOME}
+		/usr/bin test echo export ${HOME} cd awk readonly echo then
+/usr/bin 2>/dev/null && cd
+		grep --verbose && && x=1 sed
+local sed local /usr/bin
+"$@" 2>/dev/null local 'quoted text' test sed --verbose printf awk local
+&& 2>/dev/null 2>/dev/null 'quoted text' local $(pwd)
+	--verbose /usr/bin printf x=1 test
+	--verbose 'quoted text'
+	cd --verbose /usr/bin 2>/dev/null cd echo readonly "$@"
+awk --verbose echo /usr/bin
+	sed --verbose $(pwd) test && $(pwd) echo
+	x=1 | echo then then $(pwd) -eu cd --verbose && readonly x=1
+	then "$1" cd && -eu awk test --verbose 'quoted text' 2>/dev/null
+readonly $(pwd) printf 'quoted text' awk done then && export echo done
+2>/dev/null readonly echo echo /usr/bin
+		/usr/bin "$1" -eu grep grep export done x=1 grep grep | 'quoted text'
+		cd grep echo "$1" --verbose
+-eu && && export local done
+		grep ${HOME} then x=1 grep test
+		"$1" $(pwd) grep "$@"
+	2>/dev/null ${HOME} "$@" then readonly then export --verbose x=1 -eu x=1 ${HOME}
+	&& test 2>/dev/null readonly 'quoted text' "$1"
+		grep export export /usr/bin x=1 readonly
+| test awk /usr/bin && "$@" then sed /usr/bin
+		--verbose ${HOME} "$@" "$@" echo "$@" ${HOME} "$@" -eu cd 2>/dev/null test
+awk cd ${HOME} cd local $(pwd) test grep echo test | | ${HOME} then then 2>/dev/null
+		x=1 --verbose grep "$@" 2>/dev/null echo
+		/usr/bin /usr/bin 2>/dev/null printf echo /usr/bin -eu awk 2>/dev/null then
+		&& $(pwd) --verbose ${HOME} echo --verbose sed
+		local 'quoted text' x=1 printf "$@" awk test 'quoted text'
+grep /usr/bin export awk sed cd $(pwd) /usr/bin done 'quoted text'
+		"$1" && "$1" /usr/bin printf ${HOME} test
+"$@" then --verbose local $(pwd)
+"$1" sed 'quoted text' echo 2>/dev/null --verbose /usr/bin x=1 echo "$1" x=1
+	grep && done export readonly x=1 export readonly done done test echo
+	local && 2>/dev/null 2>/dev/null x=1 local
+		local | $(pwd) "$1" /usr/bin test awk awk cd readonly
+	"$@" $(pwd) readonly sed then "$1" 2>/dev/null grep
+		export x=1 cd cd x=1 "$1" printf --verbose 2>/dev/null
+	$(pwd) export printf --verbose | awk && && x=1 -eu ${HOME} echo test
+	export --verbose "$1" local
+	"$1" "$1" awk /usr/bin $(pwd) done --verbose -eu local printf
+	/usr/bin x=1 printf "$@" -eu 2>/dev/null
+	$(pwd) --verbose 2>/dev/null local
+-eu "$@" echo && test | test then && x=1 'quoted text'
+	--verbose awk readonly 2>/dev/null ${HOME} grep /usr/bin test -eu done echo -eu
+	$(pwd) test then cd /usr/bin cd x=1 2>/dev/null
+$(pwd) 2>/dev/null "$1" done awk -eu test -eu test
+${HOME} --verbose test 'quoted text' awk "$1" $(pwd) awk x=1 "$@" 2>/dev/null
+		test awk x=1 x=1 --verbose
+	readonly 'quoted text' echo /usr/bin echo awk local
+		2>/dev/null && -eu && 2>/dev/null export 2>/dev/null ${HOME} 2>/dev/null
+	printf "$@" done 2>/dev/null x=1
+	| grep $(pwd) /usr/bin ${HOME}
+		test export /usr/bin grep 'quoted text' 'quoted text' /usr/bin
+	printf "$@" export printf |
+	test x=1 ${HOME} sed 'quoted text' readonly ${HOME} done "$1" "$1" awk then
+awk ${HOME} $(pwd) -eu x=1 | 2>/dev/null echo awk awk ${HOME} awk /usr/bin
+		readonly export sed sed | /usr/bin export $(pwd)
+done $(pwd) "$@" printf grep 2>/dev/null test then awk then local
+		then && 2>/dev/null "$@" "$1"
+awk ${HOME} done readonly done test cd "$1" test 'quoted text'
+local readonly /usr/bin && readonly 'quoted text' -eu awk then test
+	sed done "$@" --verbose ${HOME} /usr/bin /usr/bin $(pwd) "$@" "$@" 'quoted text'
+	--verbose done done 'quoted text' readonly ${HOME} then -eu export
+	-eu awk export test -eu printf x=1 printf x=1 awk grep
+cd then $(pwd) awk cd echo grep /usr/bin && 2>/dev/null sed ${HOME} cd |
+	/usr/bin 2>/dev/null 2>/dev/null --verbose "$@" grep $(pwd) ${HOME} -eu /usr/bin
+		x=1 export "$1" export printf $(pwd) | then awk && local then "$@" then cd 'quoted text'
+		cd awk 'quoted text' cd grep | x=1 grep 'quoted text' test && /usr/bin cd test
+		| then grep | echo readonly printf printf
+	local --verbose && --verbose /usr/bin && sed /usr/bin
+		then export 'quoted text' awk
+		2>/dev/null done printf then export awk | readonly /usr/bin export export
+	| test --verbose | ${HOME} grep echo /usr/bin grep then x=1 | grep
+		${HOME} ${HOME} awk 'quoted text' && cd
+--verbose local 2>/dev/null 'quoted text' printf | ${HOME}
+		test "$@" awk cd then cd readonly --verbose grep $(pwd) /usr/bin "$1" readonly
+'quoted text' awk awk
+	then ${HOME} export then --verbose grep /usr/bin x=1 then grep
+		echo done x=1 printf "$@" -eu test x=1
+	local sed export then export && -eu x=1 | grep $(pwd) /usr/bin
+	'quoted text' test $(pwd) 'quoted text' /usr/bin done | then done /usr/bin test
+${HOME} then $(pwd) -eu -eu "$1" -eu | done
+grep awk echo awk readonly
+sed readonly ${HOME} | printf && readonly grep
+awk echo "$@" --verbose done grep
+	cd "$@" -eu 2>/dev/null
+		grep ${HOME} $(pwd) done $(pwd) export 'quoted text' -eu -eu -eu ${HOME}
+		printf done -eu sed local sed --verbose local export export | && test
+		'quoted text' awk -eu && sed -eu grep &&
+	$(pwd) /usr/bin export printf x=1 /usr/bin
+	cd $(pwd) | readonly /usr/bin export printf
+--verbose echo && test && cd cd
+/usr/bin printf printf
+-eu echo readonly /usr/bin ${HOME} /usr/bin 'quoted text' "$@" x=1 awk
+	export awk sed then echo "$1" $(pwd) export -eu awk grep /usr/bin ${HOME} "$@"
+	--verbose x=1 done printf /usr/bin
+	| test "$@" then "$1"
+	local 'quoted text' | --verbose awk grep -eu
+	local $(pwd) $(pwd) awk "$@" local sed then test 'quoted text' cd grep export
+		-eu ${HOME} grep awk grep local ${HOME} readonly echo x=1 "$@"
+	&& sed cd awk local x=1 cd "$@"
+		&& $(pwd) export grep | -eu echo 2>/dev/null && export grep && printf export export
+then test -eu "$1" printf /usr/bin printf
+	then local /usr/bin ${HOME} -eu readonly --verbose
+-eu $(pwd) 'quoted text' then $(pwd) /usr/bin cd
+		"$1" then $(pwd) -eu grep /usr/bin done sed --verbose 'quoted text'
+		sed readonly -eu "$@" $(pwd) cd x=1 | export
+		x=1 $(pwd) $(pwd) readonly sed x=1 awk "$@" then 2>/dev/null x=1
+	--verbose grep -eu then "$1" 'quoted text' "$@" awk done export grep
+sed cd "$@" -eu "$@" echo
+	$(pwd) echo -eu ${HOME} $(pwd) then grep printf
+readonly -eu -eu 2>/dev/null
+	2>/dev/null cd done "$1" && | readonly /usr/bin awk export sed 'quoted text'
+		-eu "$1" x=1 ${HOME} "$1" grep -eu "$@" grep done x=1 then then $(pwd)
+2>/dev/null -eu done awk
+readonly /usr/bin then -eu 2>/dev/null local /usr/bin
+		done grep test done "$1" local grep | 2>/dev/null | local
+		"$1" printf "$1" -eu 2>/dev/null $(pwd) done test
+then && then 'quoted text' printf ${HOME} done done "$1" && printf awk export
+		"$@" test --verbose 2>/dev/null done sed sed x=1 grep "$@" $(pwd) ${HOME}
+	${HOME} --verbose 'quoted text' | readonly
+		$(pwd) /usr/bin export ${HOME} export x=1
+	local --verbose readonly "$@" done $(pwd) 2>/dev/null --verbose
+x=1 then "$@" && awk cd echo test then cd done done ${HOME} cd done then
+		&& x=1 sed $(pwd) "$1" test
+$(pwd) $(pwd) then printf export
+	printf printf -eu --verbose | $(pwd) "$1" export && printf printf /usr/bin echo
+		export -eu local $(pwd) 2>/dev/null then grep export sed export
+-eu x=1 awk then grep -eu sed | 2>/dev/null -eu sed local -eu printf sed
+		| && echo | awk awk local printf local && awk "$1" "$1" export sed done
+readonly printf export -eu && then x=1 x=1 readonly
+then ${HOME} printf x=1 $(pwd) 2>/dev/null 2>/dev/null "$1" x=1 --verbose echo
+		-eu local test printf
+	&& | test readonly cd echo
+printf local done test "$@" then readonly /usr/bin echo awk ${HOME}
+	x=1 done readonly 2>/dev/null grep done
+	&& /usr/bin $(pwd) | echo echo --verbose sed done 2>/dev/null $(pwd)
+		| "$@" ${HOME} printf printf grep export cd --verbose
+test done $(pwd) export ${HOME} readonly export done
+		x=1 --verbose /usr/bin cd $(pwd) x=1 /usr/bin 2>/dev/null | $(pwd) export "$1" "$1"
+		export test export export then grep 2>/dev/null awk grep then sed 'quoted text'
+	/usr/bin cd printf x=1 sed readonly --verbose 'quoted text'
+local done "$1" awk sed ${HOME} && $(pwd) --verbose export 2>/dev/null
+		printf export -eu x=1 echo sed "$1" awk printf
+readonly 2>/dev/null echo 2>/dev/null readonly
+		sed sed --verbose x=1 printf grep awk --verbose
+	| 2>/dev/null "$1" "$1"
+x=1 'quoted text' printf echo ${HOME}
+		| 'quoted text' && awk && cd "$@" 'quoted text' --verbose readonly export "$1"
+		$(pwd) done echo /usr/bin
+"$@" then -eu grep x=1 $(pwd) ${HOME} readonly local &&
+	printf awk ${HOME} done /usr/bin "$1"
+	readonly cd /usr/bin | "$@"
+grep 'quoted text' /usr/bin "$@" /usr/bin sed
+		&& echo then 'quoted text' | readonly printf readonly
+		--verbose 2>/dev/null --verbose | local done | /usr/bin -eu then
+	export test grep local -eu | readonly 'quoted text'
+| export test export && local then 2>/dev/null then awk sed echo echo
+		| $(pwd) local printf export done /usr/bin "$1" then awk then $(pwd) local
+	printf done sed sed awk /usr/bin
+	/usr/bin printf --verbose 'quoted text'
+	test | | then -eu /usr/bin then then 2>/dev/null sed 2>/dev/null
+		--verbose printf printf $(pwd) cd "$@" readonly 2>/dev/null -eu then 2>/dev/null
+	"$@" 2>/dev/null awk 'quoted text' cd awk
+	"$@" /usr/bin $(pwd) ${HOME} printf 'quoted text'
+	printf --verbose 2>/dev/null
+		| awk /usr/bin done "$@" grep ${HOME} sed test 'quoted text' printf cd "$@"
+	x=1 'quoted text' sed done /usr/bin
+		2>/dev/null ${HOME} ${HOME}
+	-eu local 2>/dev/null awk done
+test cd readonly echo sed
+		done cd "$1" 'quoted text' /usr/bin &&
+	test /usr/bin "$@" --verbose $(pwd) local echo
+	| echo awk ${HOME} ${HOME} && x=1 $(pwd) sed "$1" readonly
+	"$@" grep 2>/dev/null then && readonly
+		"$1" ${HOME} sed | $(pwd) grep export sed /usr/bin
+		local printf | awk ${HOME} "$1" done export awk
+	$(pwd) && cd awk ${HOME} readonly then 2>/dev/null sed export x=1 'quoted text'
+	awk then "$1" 'quoted text' x=1 $(pwd) && grep -eu done cd --verbose
+local awk 'quoted text' printf x=1 'quoted text' x=1 && grep cd test then
+		cd grep local sed ${HOME} local --verbose "$@"
+		&& test --verbose grep x=1 echo
+	-eu 2>/dev/null readonly x=1 2>/dev/null && then ${HOME} sed
+"$@" readonly | echo "$1" echo -eu awk "$@" sed 2>/dev/null printf
+export "$@" x=1 --verbose cd &&
+	-eu x=1 awk /usr/bin sed echo "$@" sed
+| then 'quoted text' 'quoted text' 'quoted text' && "$@"
+		grep x=1 sed test "$@" /usr/bin cd readonly printf readonly
+/usr/bin grep local sed cd "$1" && /usr/bin
+x=1 echo --verbose 'quoted text'
+/usr/bin printf && readonly readonly echo "$@" sed 'quoted text' printf /usr/bin
+	&& --verbose && -eu readonly --verbose /usr/bin && printf local grep done
+	local "$1" x=1 x=1 local /usr/bin 2>/dev/null ${HOME}
+cd /usr/bin -eu cd export -eu then sed 2>/dev/null /usr/bin /usr/bin test
+	then test 2>/dev/null cd -eu cd ${HOME} && cd export "$@" /usr/bin awk
+$(pwd) sed test local --verbose readonly then echo local x=1 awk then export
+cd cd printf $(pwd) awk export -eu local sed done
+then done && 2>/dev/null 'quoted text'
+cd x=1 test done x=1 ${HOME} local echo && cd then sed readonly
+	export 'quoted text' grep test local
+	export test && 2>/dev/null
+		-eu printf -eu local && 2>/dev/null export && echo $(pwd) readonly |
+--verbose x=1 export x=1 echo ${HOME} test "$1" "$@" x=1 'quoted text'
+	local export done done | cd $(pwd) readonly awk awk --verbose
+		export then test -eu local echo --verbose readonly
+	sed local --verbose readonly awk ${HOME} | -eu ${HOME} sed -eu
+	/usr/bin export export -eu x=1 && then /usr/bin
+	--verbose grep "$1" -eu local 2>/dev/null sed
+sed "$1" printf sed && "$1" $(pwd) 'quoted text' && done --verbose && sed
+"$@" /usr/bin awk test export readonly 'quoted text' 'quoted text' /usr/bin
+"$1" "$1" then ${HOME} readonly && 'quoted text'
+		readonly "$1" then test ${HOME} awk "$1" $(pwd)
+local $(pwd) export echo done -eu 'quoted text'
+		done 'quoted text' then test echo "$1"
+/usr/bin readonly x=1 readonly "$1" export ${HOME} test test /usr/bin
+cd sed printf && $(pwd) x=1 export "$1" export -eu && $(pwd) done
+	2>/dev/null --verbose sed done awk done "$@" 2>/dev/null /usr/bin &&
+	then grep /usr/bin x=1 grep done
+done sed cd readonly "$@" done
+	readonly | "$@" --verbose then "$@" | 'quoted text' 'quoted text'
+then export "$@" && readonly | echo 2>/dev/null
+		x=1 done then local export then && cd sed awk $(pwd) -eu
@@ -0,0 +1,2001 @@
+	test then $(pwd) awk readonly -eu local cd "$@" echo echo printf 2>/dev/null
+		awk printf -eu | readonly test sed
+	readonly && local "$@" && awk "$@" awk export done 'quoted text'
+	--verbose 'quoted text' printf done
+		| "$@" echo readonly 'quoted text'
+	cd printf /usr/bin | "$@" x=1 printf --verbose
+		sed && -eu $(pwd) /usr/bin ${HOME}
+"$1" export | "$1" cd 2>/dev/null readonly export sed ${HOME}
+		&& "$@" && --verbose grep echo sed 'quoted text' "$1" -eu "$@"
+		printf /usr/bin && "$1" && /usr/bin
+		readonly echo ${HOME} $(pwd) echo /usr/bin echo test | done awk awk
+	then 2>/dev/null done /usr/bin export 2>/dev/null "$@"
+	| local grep test ${HOME} sed /usr/bin ${HOME} awk cd grep
+	test 2>/dev/null echo done && sed | 'quoted text' $(pwd)
+	cd done test local 'quoted text' local sed awk echo awk sed local printf then
+		"$1" sed x=1 local -eu export sed | ${HOME} $(pwd) /usr/bin
+	sed printf grep echo readonly test -eu 'quoted text' /usr/bin
+		--verbose grep x=1 export then echo /usr/bin /usr/bin then 'quoted text'
+export grep awk awk --verbose "$@" local
+readonly echo "$@" readonly test -eu x=1 /usr/bin | && export ${HOME} local
+	-eu /usr/bin sed echo awk grep sed local "$1" grep grep --verbose -eu 2>/dev/null
+		grep done "$1" 2>/dev/null local
+		&& printf -eu 'quoted text' grep ${HOME} "$1" -eu "$@" echo test
+		awk -eu test 'quoted text' export ${HOME}
+readonly local -eu | export "$1" --verbose done $(pwd) done awk
+	cd echo | export x=1 && printf grep --verbose --verbose grep local cd
+		&& printf -eu local export
+		echo printf /usr/bin done
+	local cd "$@" -eu "$@" ${HOME} then printf 2>/dev/null done done 'quoted text'
+		done 'quoted text' local --verbose then --verbose -eu x=1 | readonly --verbose
+		x=1 ${HOME} 'quoted text' test -eu | x=1 sed readonly
+		test /usr/bin export | $(pwd) "$@"
+"$1" | -eu printf local "$@" $(pwd)
+		-eu 2>/dev/null --verbose export "$@" done awk "$1" ${HOME} 2>/dev/null
+		printf echo && "$1" "$1" printf export 'quoted text'
+		done ${HOME} | "$1" ${HOME} export | --verbose
+		echo local "$@" $(pwd) cd ${HOME} 2>/dev/null
+sed | test export grep printf && grep $(pwd) "$1" 2>/dev/null
+$(pwd) "$@" sed $(pwd) /usr/bin ${HOME} export 'quoted text' -eu && awk x=1
+		'quoted text' $(pwd) then
+'quoted text' && local ${HOME} done -eu
+		export $(pwd) done "$@" $(pwd) ${HOME} --verbose -eu $(pwd) ${HOME}
+		echo awk test "$1" done done -eu done printf test $(pwd) /usr/bin
+	--verbose echo then cd /usr/bin local -eu done printf x=1
+2>/dev/null && /usr/bin -eu -eu grep /usr/bin | test /usr/bin
+	awk -eu $(pwd) | $(pwd) -eu "$1" "$1" local && -eu | $(pwd) |
+echo echo "$1" x=1 grep --verbose &&
+	| $(pwd) awk | printf cd x=1 && sed "$@" grep --verbose then /usr/bin
+	done grep echo 'quoted text' 'quoted text' "$@" /usr/bin
+	local 2>/dev/null $(pwd) cd --verbose "$1" 2>/dev/null export local -eu
+	sed x=1 -eu 2>/dev/null echo --verbose $(pwd) then
+then && test 'quoted text' 2>/dev/null
+'quoted text' export test local readonly && grep local ${HOME} then test /usr/bin
+awk --verbose echo test --verbose "$@" $(pwd) "$@" -eu $(pwd) done test
+"$@" 2>/dev/null && -eu | 2>/dev/null
+/usr/bin sed x=1 ${HOME} 'quoted text' "$1" $(pwd) --verbose
+	-eu "$@" x=1 -eu local "$@" sed 'quoted text' then awk x=1 readonly --verbose
+	then $(pwd) sed 'quoted text'
+sed "$@" "$@" 2>/dev/null test
+		then "$1" local export readonly | -eu then printf /usr/bin test printf test
+		cd sed done "$1" readonly export local -eu
+		/usr/bin x=1 awk test export printf /usr/bin 'quoted text' done export 2>/dev/null
+	grep sed sed -eu ${HOME} awk export sed printf export
+	sed then -eu $(pwd) grep | test grep --verbose echo ${HOME} | 2>/dev/null -eu
+	--verbose | export then "$@"
+awk 'quoted text' grep 2>/dev/null grep
+		&& printf readonly $(pwd) export "$@" "$1" cd then 'quoted text'
+grep -eu sed test "$@" local echo /usr/bin grep echo "$@"
+	${HOME} && ${HOME} sed /usr/bin cd sed local sed sed sed echo -eu
+		"$@" x=1 'quoted text' done
+"$1" printf test done "$@" echo | --verbose echo local printf test
+test readonly ${HOME} cd
+awk -eu 2>/dev/null /usr/bin "$1" "$@" done then cd local
+		"$1" x=1 /usr/bin done grep test awk readonly
+		cd | ${HOME} readonly "$1" then awk grep && "$1" sed $(pwd)
+	grep 2>/dev/null echo done 2>/dev/null printf | sed export "$1" --verbose export
+		printf sed grep local done | export readonly readonly -eu && -eu /usr/bin
+readonly export "$1" && printf ${HOME} ${HOME} "$@" && "$1" printf ${HOME} grep
+		cd && --verbose sed echo | "$@" then export
+local done /usr/bin done x=1 export readonly done awk export "$1" -eu test -eu
+	&& $(pwd) /usr/bin export awk local
+		done sed cd then 2>/dev/null x=1 then printf -eu grep
+	| echo "$@" echo "$@" readonly grep && done export then --verbose readonly |
+	local done x=1 && test -eu 'quoted text' local local $(pwd) "$1" -eu awk test
+		export readonly cd | sed printf
+		--verbose then grep 'quoted text'
+		x=1 readonly 'quoted text' ${HOME} 2>/dev/null readonly echo export echo
+awk then awk grep -eu "$1" /usr/bin awk && | test printf "$1" grep echo
+'quoted text' echo done test 2>/dev/null 'quoted text'
+		"$1" "$1" -eu cd /usr/bin then /usr/bin
+	"$@" 'quoted text' "$1" "$1" $(pwd) && $(pwd) local "$1" test sed then
+cd done --verbose "$@" $(pwd) $(pwd) sed awk 'quoted text' $(pwd) test
+/usr/bin printf ${HOME} -eu | then sed cd echo 'quoted text' ${HOME}
+	export echo ${HOME} grep /usr/bin
+	printf export local x=1 "$@" --verbose --verbose test "$@" grep ${HOME}
+2>/dev/null /usr/bin --verbose 2>/dev/null
+	"$1" "$@" /usr/bin done /usr/bin readonly test grep grep --verbose
+'quoted text' "$@" echo sed sed 'quoted text'
+		/usr/bin echo ${HOME} 'quoted text' x=1 "$@" readonly | $(pwd)
+		then done "$@" $(pwd) echo "$1" export cd cd 'quoted text'
+	readonly cd cd --verbose "$@" ${HOME} echo && -eu | local 'quoted text' then
+-eu then && test printf export test grep 'quoted text' cd
+test awk echo --verbose $(pwd)
+	grep && && 2>/dev/null readonly --verbose
+		"$1" readonly "$1" 2>/dev/null then -eu --verbose echo test grep "$@" sed export
+		export 2>/dev/null grep then then $(pwd) grep
+"$1" then --verbose $(pwd) "$@" awk 'quoted text' -eu /usr/bin
+	sed sed /usr/bin then test test 2>/dev/null /usr/bin grep printf export | $(pwd)
+	$(pwd) cd then && printf /usr/bin sed -eu /usr/bin readonly /usr/bin --verbose
+"$1" echo echo test sed /usr/bin then echo && export cd sed /usr/bin "$1" "$1"
+	x=1 -eu printf | local cd && awk | 2>/dev/null readonly export "$@" local
+	"$1" 'quoted text' ${HOME}
+	'quoted text' | echo printf
+		-eu -eu /usr/bin "$@" then export 2>/dev/null -eu test /usr/bin cd done
+readonly readonly 2>/dev/null awk local awk awk readonly
+	readonly printf -eu x=1 cd grep grep "$1" cd ${HOME}
+		export -eu grep printf awk 'quoted text' echo grep done readonly -eu | x=1 'quoted text'
+		grep readonly "$1" cd awk done
+x=1 local grep done export test
+--verbose echo | echo echo ${HOME} echo && x=1 printf -eu
+		local "$@" grep grep x=1 done done printf && then done
+"$@" then local local test /usr/bin
+"$1" readonly printf done --verbose echo echo | -eu "$@"
+printf sed "$@" "$1" local -eu then ${HOME} 2>/dev/null echo grep readonly
+	--verbose sed test $(pwd) sed awk -eu -eu --verbose "$1" 'quoted text' x=1 x=1 local
+		/usr/bin then -eu 'quoted text' export "$@" sed cd
+		'quoted text' 'quoted text'
+		"$1" "$@" -eu cd awk printf $(pwd) "$@" $(pwd) done "$@" echo --verbose x=1 then
+$(pwd) -eu cd test local 2>/dev/null ${HOME}
+		x=1 ${HOME} ${HOME} printf export echo sed echo
+then test then printf awk -eu 2>/dev/null sed |
+	/usr/bin && "$@" | readonly | done sed "$1" echo local local --verbose
+	| grep "$1" awk 'quoted text' --verbose -eu done
+	printf x=1 2>/dev/null --verbose done test local
+		cd -eu 2>/dev/null "$1"
+	then export then ${HOME} | cd "$1" 'quoted text' done readonly x=1
+		"$1" --verbose readonly 'quoted text' 2>/dev/null test 2>/dev/null 2>/dev/null
+grep grep "$1" --verbose "$@" x=1
+&& -eu export echo -eu 'quoted text' "$@"
+		&& x=1 x=1 $(pwd) 'quoted text' then | echo done
+	/usr/bin readonly printf
+	printf test x=1 'quoted text' -eu | "$1" /usr/bin
+	--verbose ${HOME} then grep done && --verbose --verbose ${HOME} -eu export awk done
+		x=1 then grep readonly echo
+		done awk /usr/bin "$@" test 2>/dev/null readonly
+		| echo "$@" ${HOME} "$@" |
+	done echo then printf ${HOME}
+		$(pwd) cd export "$1" local ${HOME} export "$1" export then grep export
+	${HOME} $(pwd) "$@" 2>/dev/null cd printf export export readonly
+	printf x=1 readonly echo awk $(pwd) 'quoted text' grep -eu 'quoted text' printf
+		awk export x=1 --verbose "$@" sed grep x=1 test sed && echo ${HOME} $(pwd)
+	local grep awk then readonly local sed | "$@" /usr/bin "$1" echo
+x=1 "$1" 'quoted text' awk test sed then printf awk $(pwd) sed --verbose 'quoted text'
+test /usr/bin --verbose 2>/dev/null
+	grep local && readonly --verbose "$@" /usr/bin echo export "$@" cd "$1" --verbose
+'quoted text' 'quoted text' $(pwd)
+	&& $(pwd) x=1 printf export -eu local "$@" $(pwd) echo $(pwd) echo
+	2>/dev/null && cd readonly
+x=1 'quoted text' awk then cd | then | "$@" "$@" $(pwd) then local
+		done -eu done readonly local local
+| -eu | echo then grep local then | export readonly
+	then echo /usr/bin printf 'quoted text' awk 'quoted text'
+	'quoted text' cd then sed /usr/bin /usr/bin $(pwd)
+	then 2>/dev/null "$@" --verbose "$1" done export
+local cd echo && "$1" && ${HOME} "$@" 'quoted text' sed 2>/dev/null
+		&& echo | --verbose -eu done grep && && sed test done
+readonly then "$1" sed && done "$1" awk $(pwd) done $(pwd) then /usr/bin /usr/bin
+"$@" grep awk "$@" 'quoted text' local ${HOME} awk awk local
+done readonly done --verbose
+x=1 export done sed /usr/bin | x=1 | grep sed readonly done
+		-eu awk "$@" local $(pwd) then | cd sed
+		printf x=1 ${HOME} --verbose
+		'quoted text' /usr/bin export | local | grep --verbose "$@" sed 2>/dev/null
+sed echo "$1" 2>/dev/null grep /usr/bin echo x=1 x=1 2>/dev/null "$1" printf
+'quoted text' done 'quoted text' grep &&
+	"$@" done sed && "$@" awk done "$1" grep x=1 "$1" ${HOME} cd "$1" ${HOME}
+		'quoted text' local printf awk cd 2>/dev/null -eu test test cd && x=1
+		2>/dev/null $(pwd) readonly | test 2>/dev/null
+	readonly -eu "$@" 'quoted text'
+		readonly local ${HOME} grep "$1" -eu
+		&& grep && -eu done cd x=1 "$@" printf && test && readonly done && $(pwd)
+	test export --verbose | 'quoted text' && test ${HOME} --verbose test "$@" /usr/bin
+	-eu 'quoted text' /usr/bin && test sed grep x=1
+		"$1" test /usr/bin x=1 | then echo "$@" -eu grep local grep
+	| then local | | /usr/bin export then echo -eu --verbose grep "$1"
+	printf "$1" test export test done export done | awk /usr/bin done $(pwd) |
+grep printf export x=1 $(pwd) | awk cd export ${HOME} awk && readonly
+	echo | awk -eu && | 2>/dev/null done /usr/bin -eu done x=1 awk "$@" local
+	2>/dev/null /usr/bin ${HOME} x=1 awk
+&& 'quoted text' | then cd && x=1
+	then printf readonly awk /usr/bin
+		sed -eu test x=1 sed ${HOME} && --verbose
+sed 2>/dev/null printf /usr/bin echo
+export local --verbose 2>/dev/null done echo echo
+"$1" 'quoted text' --verbose --verbose then 2>/dev/null
+sed 2>/dev/null ${HOME} awk | && -eu then "$@" export ${HOME} then
+		readonly --verbose 2>/dev/null ${HOME} done x=1 -eu test $(pwd)
+		grep "$1" grep export /usr/bin 'quoted text' --verbose done grep
+		then grep "$1" x=1 local 2>/dev/null 'quoted text' test readonly
+readonly 2>/dev/null export x=1 local sed $(pwd)
+"$@" 'quoted text' --verbose printf 'quoted text' grep "$1" local ${HOME} ${HOME}
+'quoted text' printf local /usr/bin cd -eu ${HOME} echo sed 2>/dev/null grep
+		echo $(pwd) x=1 cd test ${HOME} --verbose 2>/dev/null awk ${HOME}
+	"$1" "$1" $(pwd) readonly done && "$@"
+x=1 'quoted text' then done -eu "$@" done -eu ${HOME} /usr/bin cd
+		cd 'quoted text' done $(pwd) grep $(pwd)
+	/usr/bin export $(pwd) && -eu test grep x=1 | 2>/dev/null export "$@" test done
+	x=1 "$@" && sed readonly
+		test ${HOME} grep /usr/bin printf "$@"
+		'quoted text' x=1 'quoted text' ${HOME}
+--verbose local then 2>/dev/null -eu
+	echo /usr/bin export "$1" x=1 cd 'quoted text' sed cd 'quoted text'
+	grep | done /usr/bin 'quoted text' export cd echo $(pwd) then --verbose "$1"
+		/usr/bin && $(pwd) 2>/dev/null sed awk printf printf cd ${HOME} | 'quoted text'
+	--verbose ${HOME} test sed && echo echo readonly
+	sed then export local cd "$@" readonly local
+		| then awk grep sed $(pwd)
+export 2>/dev/null test readonly printf
+cd cd echo sed grep -eu
+	'quoted text' | --verbose $(pwd) printf ${HOME} grep && x=1
+		done sed done test $(pwd) "$@" cd printf
+	-eu $(pwd) done local readonly export done done /usr/bin
+--verbose done printf "$1" 2>/dev/null "$1" printf local $(pwd) cd awk local echo
+then ${HOME} | echo "$@" /usr/bin
+$(pwd) cd --verbose --verbose -eu -eu "$@" grep cd && "$@" export -eu readonly
+echo "$@" "$@" "$@" && export /usr/bin
+printf 2>/dev/null export cd awk | "$@" printf "$1" $(pwd) 2>/dev/null "$1" $(pwd)
+	printf readonly awk local "$@" "$@" -eu printf cd "$1" ${HOME} "$@" | $(pwd)
+		sed export awk "$@" readonly -eu done | && echo cd
+	--verbose local "$@" sed readonly
+		export $(pwd) sed "$@" "$1" readonly grep && cd "$1" "$1"
+		"$@" export --verbose && /usr/bin "$@"
+	grep printf done cd sed then
+		$(pwd) local 'quoted text' readonly done local then
+		$(pwd) && printf x=1 readonly done && "$@" export
+	&& grep 'quoted text' && $(pwd) printf && done done echo sed grep sed
+${HOME} grep /usr/bin awk sed | -eu "$@" ${HOME} "$1" awk export
+grep cd -eu -eu grep export -eu local readonly | "$1" && readonly
+"$1" /usr/bin 2>/dev/null /usr/bin local 'quoted text' && then
+		printf cd "$1" 'quoted text' cd sed test $(pwd) --verbose test
+		&& /usr/bin | export test test $(pwd) x=1 'quoted text' awk grep export | echo export
+printf $(pwd) cd "$1" x=1 $(pwd) sed "$@"
+done printf local x=1 /usr/bin done
+readonly | 2>/dev/null 2>/dev/null grep && local
+		done sed --verbose 2>/dev/null local ${HOME} test
+grep awk export export $(pwd) cd export grep sed "$1"
+		local && export /usr/bin
+	&& then | local export -eu --verbose 'quoted text'
+		awk "$@" then cd readonly export -eu ${HOME}
+sed export | echo $(pwd)
+/usr/bin && echo export local | then x=1 test
+		$(pwd) "$@" "$@" awk /usr/bin printf --verbose 2>/dev/null
+		'quoted text' done printf 2>/dev/null
+	sed ${HOME} 'quoted text' 'quoted text'
+		"$1" readonly readonly test echo
+done echo then | x=1 test local x=1 export 2>/dev/null cd sed then --verbose
+	readonly "$1" 2>/dev/null cd "$@" && ${HOME}
+"$@" 2>/dev/null test done echo awk ${HOME}
+		awk awk $(pwd) sed done readonly local -eu readonly
+		/usr/bin "$1" "$1" then printf 2>/dev/null awk x=1 "$1" printf | $(pwd) awk
+--verbose x=1 "$@" sed && cd "$1" printf
+"$@" grep sed $(pwd) "$@" $(pwd) && ${HOME}
+		2>/dev/null "$@" /usr/bin sed awk /usr/bin "$@" grep export
+	local readonly "$@" readonly test x=1 readonly
+	2>/dev/null test echo sed | --verbose echo x=1 2>/dev/null 'quoted text'
+		-eu ${HOME} export awk 2>/dev/null test /usr/bin
+		2>/dev/null x=1 && grep -eu && "$1"
+		test && awk grep -eu readonly
+	/usr/bin "$1" 'quoted text' export local | --verbose ${HOME} export | local
+sed printf x=1 ${HOME} $(pwd) printf echo 2>/dev/null
+	grep -eu sed grep sed grep -eu local x=1 grep "$@" $(pwd) && echo
+awk "$@" export "$1" && export "$1" export sed | x=1 done grep then printf done
+		$(pwd) 2>/dev/null "$@" grep "$@" 2>/dev/null local sed
+		grep local echo && 'quoted text' local "$1"
+	&& printf local /usr/bin | printf /usr/bin awk grep "$1" readonly /usr/bin
+&& export --verbose readonly sed | grep
+awk echo "$@" | | done -eu done 2>/dev/null printf x=1 sed $(pwd)
+		grep then 2>/dev/null awk $(pwd)
+	"$@" echo export ${HOME} "$@" "$1" local 'quoted text' --verbose $(pwd)
+		done export | printf /usr/bin $(pwd) printf && $(pwd) export
+$(pwd) local grep local grep printf test awk && awk
+		-eu 'quoted text' sed --verbose && 2>/dev/null
+	'quoted text' printf "$1" readonly cd printf $(pwd)
+		test && then cd ${HOME} --verbose
+		awk $(pwd) awk test cd export export then
+		--verbose printf /usr/bin
+		| test export awk ${HOME} local $(pwd) awk readonly sed ${HOME} -eu --verbose
+	cd ${HOME} echo 2>/dev/null export sed
+	"$1" done printf echo --verbose --verbose cd export x=1 sed && readonly
+	sed then "$1" then local cd 'quoted text' awk -eu x=1 | $(pwd)
+	"$@" cd | local $(pwd) ${HOME} grep 'quoted text' readonly
+		&& sed "$1" echo "$1" && --verbose 2>/dev/null
+		grep --verbose "$@" then readonly -eu sed "$1"
+then x=1 "$@" then ${HOME} export x=1 sed sed readonly done then x=1 'quoted text'
+	$(pwd) done -eu local 2>/dev/null "$@" 'quoted text' -eu x=1 "$@"
+	cd export | --verbose 2>/dev/null
+		| test x=1 local readonly $(pwd) sed readonly printf
+"$@" x=1 echo test --verbose
+	awk export /usr/bin --verbose 'quoted text' && echo test sed export
+		printf test "$1" /usr/bin printf cd x=1 local | export test
+	printf then then "$1" printf export -eu
+echo "$@" "$1" test $(pwd) sed 2>/dev/null sed 'quoted text'
+test echo done 'quoted text' grep grep
+	test test then "$@" local sed x=1 test echo cd test test --verbose
+		&& printf local done cd "$1"
+	'quoted text' awk "$1" "$1" grep "$@" "$@" "$1" local "$@" done
+	| $(pwd) "$1" test local cd "$1" sed awk export -eu printf printf
+		/usr/bin grep local -eu then cd echo printf ${HOME} then
+		$(pwd) $(pwd) done test "$@" /usr/bin -eu
+	local then && 'quoted text' then 2>/dev/null readonly
+printf awk -eu cd sed cd local done
+done && printf awk | done --verbose "$@" --verbose | ${HOME}
+	/usr/bin then 2>/dev/null done
+	export 2>/dev/null echo grep echo done | echo 2>/dev/null
+awk export /usr/bin 'quoted text' /usr/bin /usr/bin
+	readonly 'quoted text'
+		awk awk && 2>/dev/null /usr/bin export | 2>/dev/null
+	$(pwd) then 2>/dev/null && -eu echo printf
+/usr/bin -eu printf echo | then echo readonly export
+	2>/dev/null readonly export export "$1" 2>/dev/null x=1 "$@" local
+		$(pwd) ${HOME} "$1" test $(pwd) test test --verbose cd && local
+"$@" /usr/bin printf $(pwd) export grep $(pwd)
+/usr/bin "$@" 'quoted text' /usr/bin --verbose test --verbose
+		printf "$@" "$1" printf x=1 2>/dev/null grep
+	test && x=1 readonly cd "$@" 2>/dev/null 2>/dev/null 2>/dev/null
+	x=1 export "$@" "$@" awk && --verbose /usr/bin
+	then x=1 test readonly awk done --verbose "$@" 2>/dev/null sed 'quoted text'
+		&& export | 'quoted text' readonly test && "$@" && local
+	then ${HOME} grep 'quoted text' printf awk --verbose
+	"$@" ${HOME} x=1 "$@" x=1
+	grep echo then local $(pwd) local done done /usr/bin
+export printf /usr/bin
+--verbose /usr/bin 2>/dev/null
+grep -eu awk sed done grep export ${HOME} printf /usr/bin 2>/dev/null
+${HOME} | ${HOME} readonly /usr/bin /usr/bin x=1 "$@" done export && grep /usr/bin
+		export awk ${HOME} $(pwd) test -eu sed
+		grep test 'quoted text' 'quoted text' 2>/dev/null done "$@" | local
+		${HOME} export sed --verbose ${HOME} | done awk -eu awk export grep
+		export echo 2>/dev/null "$1" /usr/bin
+		"$1" sed /usr/bin printf sed "$1" $(pwd) -eu local local awk awk $(pwd)
+		done -eu $(pwd) 2>/dev/null echo printf readonly && echo local grep
+	grep 'quoted text' $(pwd) 'quoted text'
+sed cd sed then cd "$@" x=1 && --verbose echo grep local -eu
+test grep echo -eu then export printf export "$1" test x=1 ${HOME} "$1" 'quoted text'
+		printf $(pwd) export sed readonly -eu test
+	local && test grep test /usr/bin then "$@" 2>/dev/null echo echo
+		'quoted text' "$1" "$1" --verbose -eu awk -eu ${HOME} awk echo x=1 "$@"
+		sed then grep -eu x=1 --verbose
+	cd echo printf "$1" awk && test test
+export 2>/dev/null readonly 'quoted text'
+		"$1" done --verbose --verbose x=1 sed test && printf sed $(pwd) "$1" grep $(pwd)
+		$(pwd) x=1 cd -eu --verbose cd grep |
+	--verbose $(pwd) | local "$@" awk "$1" cd --verbose
+		cd 'quoted text' echo $(pwd) "$1" then "$@" awk
+	local x=1 done local 'quoted text' awk then && -eu "$@" echo then ${HOME}
+		2>/dev/null ${HOME} && --verbose -eu done 2>/dev/null sed local test test
+${HOME} x=1 && echo "$1" done
+		-eu $(pwd) grep -eu -eu local
+	cd "$@" local local grep x=1 echo cd local
+		--verbose | "$@" local "$@" cd ${HOME} cd "$1" awk "$1" echo ${HOME}
+grep "$@" /usr/bin echo awk -eu
+-eu export export readonly export
+	| /usr/bin grep /usr/bin /usr/bin && "$1" && ${HOME} printf 2>/dev/null awk
+	done export ${HOME} && $(pwd) | echo cd printf echo ${HOME}
+		--verbose then sed x=1 sed echo 2>/dev/null
+	$(pwd) then $(pwd) then test x=1 /usr/bin then
+		readonly readonly ${HOME} $(pwd) printf printf 'quoted text' | x=1 done
+		"$@" /usr/bin /usr/bin cd x=1 test cd 'quoted text' 2>/dev/null
+		cd 'quoted text' && export "$1"
+	cd | test -eu grep test done export --verbose $(pwd) 'quoted text' done
+		--verbose done local /usr/bin
+		cd grep "$1" echo x=1 readonly export export ${HOME}
+		/usr/bin echo sed --verbose test test then cd test
+		echo | | cd && "$1" echo --verbose test test
+	grep sed local then "$@" grep --verbose readonly export then 2>/dev/null 2>/dev/null
+done done export printf
+awk export -eu printf local export ${HOME} -eu grep --verbose awk awk 'quoted text'
+		x=1 ${HOME} readonly sed $(pwd) test then --verbose export ${HOME} "$1"
+export ${HOME} $(pwd) 2>/dev/null printf done "$@" "$1" $(pwd) grep then test sed
+	printf export 'quoted text'
+awk --verbose awk ${HOME} "$1" 'quoted text' sed local
+| done --verbose echo awk "$1" "$1" 2>/dev/null readonly
+readonly grep readonly echo then awk export grep done export awk 2>/dev/null
+		$(pwd) sed echo then 'quoted text' "$@" ${HOME}
+		export echo --verbose 2>/dev/null printf "$1" then test 2>/dev/null
+		test sed printf -eu sed
+	--verbose local -eu done readonly awk test /usr/bin ${HOME} printf cd && x=1 test
+		x=1 /usr/bin /usr/bin 'quoted text' && test readonly sed --verbose
+		$(pwd) "$1" 2>/dev/null awk 2>/dev/null "$1" "$@" 'quoted text'
+	export x=1 'quoted text' grep sed local | local awk --verbose export 'quoted text'
+/usr/bin 'quoted text' "$@" x=1 done done 2>/dev/null cd local | $(pwd) "$1"
+printf local done test /usr/bin readonly x=1 ${HOME} 'quoted text' | readonly done
+cd cd echo readonly | export cd then local "$1"
+/usr/bin local | 'quoted text' "$1" ${HOME} | "$@" then awk
+		echo 'quoted text' readonly done
+		test printf -eu && then cd 2>/dev/null "$@" printf $(pwd) local "$@"
+	${HOME} 2>/dev/null test local $(pwd) $(pwd) awk "$@" local | "$1" readonly
+awk ${HOME} sed cd --verbose grep cd --verbose echo x=1 "$@"
+	-eu cd then test /usr/bin --verbose /usr/bin 2>/dev/null && | awk done cd
+	/usr/bin $(pwd) export && --verbose
+	| && then local cd x=1 readonly export echo then done cd printf --verbose
+		awk ${HOME} echo grep local | | done sed /usr/bin done
+		| then awk echo test 'quoted text' && "$@" "$1" export
+	test echo grep export
+		then ${HOME} echo -eu awk then "$1"
+	--verbose printf 'quoted text'
+grep done 2>/dev/null "$1" --verbose
+done 'quoted text' printf
+		awk grep test 'quoted text' then && "$1"
+sed echo grep "$@" readonly 'quoted text' 'quoted text' 2>/dev/null | then --verbose
+	'quoted text' --verbose && export local then awk
+"$1" --verbose "$1" sed | local then && --verbose cd && $(pwd) "$@"
+"$1" --verbose | -eu $(pwd) grep then export | then done "$1" test
+	sed then awk -eu 'quoted text'
+		done test local "$1" sed done sed 'quoted text' sed then
+$(pwd) "$@" sed grep then 'quoted text' | --verbose /usr/bin $(pwd) 'quoted text'
+	echo 2>/dev/null sed
+&& /usr/bin $(pwd) grep sed test
+readonly grep printf sed && | "$@" /usr/bin
+2>/dev/null done done awk echo 2>/dev/null --verbose done "$@" 2>/dev/null readonly
+		| "$1" "$1" --verbose "$@" done x=1 'quoted text'
+	cd awk printf /usr/bin "$@" -eu local $(pwd) cd 'quoted text' done x=1 cd | awk
+		cd sed && "$1" grep then sed 2>/dev/null export sed --verbose
+		| then ${HOME} && /usr/bin --verbose readonly
+	done "$@" echo x=1 printf done ${HOME} -eu grep $(pwd) | "$1"
+| $(pwd) $(pwd) done ${HOME} local /usr/bin cd | --verbose grep
+cd --verbose /usr/bin sed ${HOME} | sed 2>/dev/null awk export local 2>/dev/null
+	2>/dev/null done done readonly
+&& then test done 'quoted text' "$1" grep export
+		printf cd local --verbose
+	cd x=1 -eu done then /usr/bin grep /usr/bin
+	sed cd $(pwd) export -eu $(pwd) awk readonly -eu readonly test awk &&
+	/usr/bin ${HOME} "$1" $(pwd)
+		echo --verbose export 2>/dev/null echo echo "$1" done awk
+		printf printf awk && then awk "$1" then then && awk x=1 "$@" awk x=1 printf
+	sed $(pwd) | "$@" awk done export && then x=1 echo |
+		"$1" $(pwd) /usr/bin | awk sed export /usr/bin 'quoted text' done
+grep local ${HOME} grep done
+		"$1" awk test x=1 'quoted text' test cd echo printf "$@" "$1"
+	test sed /usr/bin cd sed | export test x=1 /usr/bin awk -eu -eu sed
+	test printf | readonly ${HOME} /usr/bin local
+	sed "$1" -eu local printf ${HOME}
+		awk ${HOME} awk 2>/dev/null done export ${HOME} $(pwd) x=1 local
+		| && awk x=1 sed --verbose then sed $(pwd) x=1
+${HOME} printf cd -eu grep export
+		2>/dev/null && local printf local && $(pwd) $(pwd)
+export readonly test x=1 awk local done local 'quoted text'
+		$(pwd) 'quoted text' readonly awk 2>/dev/null
+	test --verbose cd grep | ${HOME} -eu local "$1" -eu --verbose
+then local export local ${HOME} /usr/bin grep export
+--verbose readonly export awk cd test "$1" local 'quoted text' test awk grep
+	awk 2>/dev/null readonly grep
+	2>/dev/null then $(pwd) | export printf x=1 2>/dev/null 'quoted text'
+		sed -eu test 2>/dev/null 'quoted text' cd local /usr/bin
+		cd export 'quoted text' test
+		printf test then test then awk
+		"$1" 2>/dev/null cd cd --verbose
+${HOME} | then $(pwd) 2>/dev/null test export 'quoted text' sed
+	"$1" readonly local | -eu --verbose && grep 2>/dev/null | $(pwd)
+	readonly done sed | awk $(pwd) export
+		done done && grep grep $(pwd)
+		&& && "$@" export && x=1 readonly && echo awk "$1" 2>/dev/null readonly
+	/usr/bin | "$@" then readonly
+grep -eu ${HOME} | printf | "$@" done ${HOME} readonly printf "$1" awk
+		local awk then export x=1 2>/dev/null awk then readonly sed printf
+local test ${HOME} "$1" $(pwd) $(pwd) sed "$1" echo
+test grep grep readonly "$1" export awk -eu x=1 --verbose x=1 awk
+		grep local export then grep then --verbose && && $(pwd) export
+	--verbose "$@" | awk "$1"
+		grep && test -eu $(pwd) x=1 test x=1 /usr/bin x=1 export -eu ${HOME} x=1 grep
+printf test --verbose printf local readonly
+	printf sed local done then sed 'quoted text' printf echo
+		export /usr/bin export printf -eu sed cd && readonly done sed "$1"
+"$1" 'quoted text' ${HOME} export x=1 | ${HOME} 'quoted text' --verbose done -eu
+	${HOME} 'quoted text' x=1 grep -eu 2>/dev/null 'quoted text' --verbose awk
+	readonly "$1" | 'quoted text' $(pwd) "$@" --verbose --verbose echo
+	sed printf ${HOME} "$1" 'quoted text'
+		'quoted text' readonly sed awk x=1 'quoted text'
+	export $(pwd) ${HOME} sed $(pwd) cd
+		2>/dev/null printf readonly
+	done 'quoted text' done $(pwd)
+-eu test 2>/dev/null grep then 'quoted text' && local sed | $(pwd)
+-eu /usr/bin then then test local echo awk test
+	/usr/bin cd echo "$@" done then export | grep sed echo then "$1" x=1
+	'quoted text' "$1" $(pwd) -eu | done then -eu local $(pwd) export -eu "$@"
+cd done /usr/bin 2>/dev/null $(pwd) --verbose echo x=1 echo && "$@" echo
+2>/dev/null awk printf
+		test x=1 echo cd cd && awk grep x=1 /usr/bin x=1 awk $(pwd) sed done local
+	--verbose grep local ${HOME} test printf ${HOME} /usr/bin then "$1" ${HOME} &&
+		'quoted text' /usr/bin /usr/bin "$1" | 'quoted text' $(pwd) ${HOME} "$1"
+	/usr/bin --verbose x=1
+echo awk local awk $(pwd) printf "$@" "$@" --verbose
+	export printf awk readonly
+--verbose "$1" done /usr/bin then readonly grep grep
+		grep 'quoted text' 'quoted text' readonly
+	"$1" $(pwd) grep printf then "$@" /usr/bin export "$1" local --verbose
+	${HOME} /usr/bin $(pwd) -eu echo local | cd
+test printf 2>/dev/null ${HOME} grep printf 2>/dev/null echo printf && grep local
+	2>/dev/null awk x=1 | local && 2>/dev/null cd readonly
+awk test ${HOME} $(pwd) ${HOME} 'quoted text' cd /usr/bin --verbose
+		/usr/bin local -eu | 'quoted text'
+		&& "$@" sed awk echo 2>/dev/null export -eu 'quoted text' && "$1" test
+	$(pwd) then readonly -eu x=1 "$1" sed /usr/bin
+&& 'quoted text' ${HOME} 'quoted text'
+	2>/dev/null export ${HOME} 2>/dev/null "$1" && x=1 export -eu &&
+	$(pwd) done awk x=1 export then 2>/dev/null
+	/usr/bin sed 'quoted text' "$1" 'quoted text' then
+		then sed awk "$@" export --verbose "$@" awk -eu printf 2>/dev/null /usr/bin sed
+printf test test export
+x=1 local sed then awk | done local /usr/bin && && /usr/bin ${HOME}
+	grep readonly done readonly 'quoted text'
+		done readonly --verbose $(pwd) export | sed "$@" ${HOME} done
+/usr/bin && "$1" readonly /usr/bin grep 2>/dev/null echo test && export
+		$(pwd) grep "$1" export "$@" --verbose awk printf "$1" /usr/bin x=1
+done ${HOME} ${HOME} ${HOME} local
+		"$1" test sed | done ${HOME} awk --verbose
+grep | grep 'quoted text' && printf
+		awk ${HOME} "$@" cd printf
+		"$1" "$@" done awk then "$@" export 2>/dev/null sed && --verbose grep awk done cd
+		'quoted text' test then $(pwd) echo "$1" 2>/dev/null awk done done
+test export "$@" | | echo then readonly
+cd readonly x=1 x=1 test "$@" $(pwd) 2>/dev/null "$@" --verbose && /usr/bin
+-eu "$1" "$1" sed awk then | x=1 2>/dev/null awk
+		&& grep awk sed sed sed grep done sed then 'quoted text' sed "$1"
+	x=1 | awk done --verbose --verbose | --verbose
+	--verbose ${HOME} -eu $(pwd) echo done printf grep x=1 "$1"
+		test "$@" test x=1 $(pwd) x=1 $(pwd) grep printf && awk readonly grep local
+	echo 'quoted text' export 'quoted text' &&
+		"$@" 'quoted text' --verbose awk then export && done readonly
+-eu "$1" readonly /usr/bin
+	local x=1 readonly && --verbose
+		${HOME} awk echo done 'quoted text'
+	$(pwd) local grep ${HOME} echo "$1" cd test awk $(pwd) "$@" local
+-eu && echo --verbose | /usr/bin 2>/dev/null
+"$1" --verbose | --verbose
+		sed "$@" | local "$1" 2>/dev/null "$@" cd "$@" export "$1" ${HOME}
+		local sed $(pwd) /usr/bin then | 'quoted text' x=1 readonly 'quoted text'
+		test | awk 'quoted text' awk awk readonly "$1"
+	&& done awk x=1 --verbose then sed -eu --verbose 'quoted text' x=1
+| awk | --verbose x=1 echo
+then $(pwd) sed then grep /usr/bin printf x=1 2>/dev/null
+	test 'quoted text' "$1" test printf x=1 export
+		echo -eu done awk sed "$@" test
+cd printf readonly "$1" grep grep grep sed then | cd done awk ${HOME}
+export awk $(pwd) echo local done export grep test x=1 readonly test then
+	'quoted text' awk && echo then export
+| echo awk "$1" printf cd
+/usr/bin test -eu readonly /usr/bin cd -eu "$1" sed test -eu grep grep
+	local /usr/bin printf then 2>/dev/null | done 'quoted text'
+| test --verbose then /usr/bin echo grep | --verbose
+		grep grep --verbose printf --verbose cd cd test done ${HOME} --verbose -eu
+		${HOME} echo local | then "$1" $(pwd) echo 'quoted text' x=1 export readonly sed
+		printf cd then done "$@" readonly 2>/dev/null grep readonly echo
+--verbose printf echo export echo local local export export printf $(pwd)
+		--verbose /usr/bin && --verbose "$1" 'quoted text' -eu 'quoted text'
+| test sed ${HOME} x=1 then sed -eu 2>/dev/null "$@" /usr/bin
+	$(pwd) | ${HOME} sed $(pwd) 'quoted text' grep 'quoted text' /usr/bin echo
+${HOME} export x=1 --verbose done test "$1" sed && echo local done "$1" export
+	&& grep echo 'quoted text' local
+	printf && $(pwd) grep
+x=1 echo grep grep export printf grep printf test 'quoted text' "$@"
+	"$@" && sed 'quoted text' $(pwd)
+		"$@" 'quoted text' $(pwd) export export then 2>/dev/null echo
+		$(pwd) $(pwd) x=1 "$1" export /usr/bin awk -eu --verbose --verbose done
+	$(pwd) -eu grep grep grep test grep echo local x=1 | test echo test && --verbose
+${HOME} cd "$@" "$@" && 2>/dev/null then -eu echo $(pwd) done 2>/dev/null
+	sed 'quoted text' --verbose "$@"
+	awk ${HOME} local echo readonly --verbose export
+		/usr/bin --verbose export readonly
+		readonly test printf awk grep sed grep 2>/dev/null readonly | cd then local
+| local ${HOME} | local x=1 && echo test local
+		awk awk "$@" 'quoted text' $(pwd) /usr/bin /usr/bin readonly -eu echo
+awk sed "$1" local ${HOME} readonly 2>/dev/null && export printf cd $(pwd) grep
+${HOME} 2>/dev/null "$@"
+		&& "$1" $(pwd) export awk export sed 'quoted text' printf then echo readonly
+		"$@" local echo awk ${HOME} test 'quoted text' echo
+	"$1" && awk local export && cd sed
+	printf grep cd sed awk sed 'quoted text' 2>/dev/null |
+		-eu 2>/dev/null awk done 2>/dev/null test export | export
+then readonly && ${HOME} "$1"
+sed "$1" -eu printf test $(pwd) done
+echo printf && x=1 | then echo local cd "$1" awk $(pwd) -eu
+	readonly local --verbose 'quoted text'
+x=1 printf x=1 printf done ${HOME} && x=1 $(pwd) awk printf cd | export
+		x=1 export local && && echo test --verbose $(pwd) x=1 printf
+	sed /usr/bin $(pwd) export 'quoted text' 2>/dev/null
+done "$@" export /usr/bin local ${HOME} x=1 export
+	| ${HOME} printf echo awk 2>/dev/null export 2>/dev/null
+2>/dev/null export cd /usr/bin "$1" /usr/bin "$1" export local
+		'quoted text' $(pwd) "$1" cd 2>/dev/null x=1 x=1 awk grep $(pwd) x=1 local
+		2>/dev/null readonly /usr/bin ${HOME} sed --verbose test cd --verbose
+	local sed grep 2>/dev/null
+	local printf sed /usr/bin ${HOME} --verbose
+		sed x=1 then readonly "$1" then
+readonly "$@" then local ${HOME} local local
+	awk echo | done export "$@" $(pwd) awk /usr/bin x=1 ${HOME} 2>/dev/null printf
+	done readonly test /usr/bin grep then /usr/bin
+		&& local x=1 test local then $(pwd) printf /usr/bin
+		echo awk -eu export echo readonly printf done then /usr/bin 'quoted text' readonly
+	&& export sed export $(pwd) local && readonly sed echo --verbose $(pwd) x=1 "$@"
+		printf then awk then x=1 then && x=1 cd "$@" /usr/bin && | $(pwd)
+		'quoted text' echo --verbose --verbose -eu "$@" sed /usr/bin ${HOME} && echo
+		&& cd "$@" && grep test
+	done done | cd readonly -eu awk | "$1" export export local x=1
+readonly 2>/dev/null $(pwd) echo && printf $(pwd)
+		"$1" readonly local "$1" cd grep readonly "$@" "$1" --verbose test
+echo x=1 readonly echo $(pwd) -eu echo ${HOME}
+	x=1 /usr/bin test local "$1" /usr/bin
+	done done then awk echo cd
+--verbose echo awk sed sed && /usr/bin echo grep test $(pwd) x=1 &&
+	sed "$@" x=1 printf sed sed cd readonly local && sed $(pwd) 2>/dev/null /usr/bin
+	${HOME} -eu cd done -eu test | printf
+	cd readonly grep local test | ${HOME} -eu 'quoted text'
+	sed done $(pwd) grep | /usr/bin |
+	x=1 'quoted text' sed ${HOME} printf --verbose $(pwd)
+	grep $(pwd) $(pwd) "$1" cd
+		"$1" then echo 2>/dev/null export
+	| /usr/bin 'quoted text' 2>/dev/null -eu 'quoted text'
+	&& && export done export readonly done done | | done "$@" test grep cd export echo
+x=1 "$1" cd 2>/dev/null 2>/dev/null test export "$@" printf
+2>/dev/null grep awk cd 'quoted text' | /usr/bin cd echo grep 'quoted text'
+	echo echo /usr/bin "$@" export
+	sed readonly awk x=1 --verbose export grep
+sed "$1" --verbose done cd && local test "$@" done
+		grep local 'quoted text'
+	"$1" "$1" --verbose $(pwd) && local && && cd awk /usr/bin awk && x=1
+		2>/dev/null cd --verbose 2>/dev/null done sed cd ${HOME} test && then grep
+then awk 'quoted text' echo 2>/dev/null then readonly -eu "$1" export test /usr/bin
+		"$@" | test grep $(pwd) /usr/bin then
+echo -eu && test /usr/bin
+--verbose test done | $(pwd)
+		sed 'quoted text' 'quoted text' -eu $(pwd) cd grep /usr/bin && test sed | $(pwd)
+	"$1" "$@" $(pwd) x=1 2>/dev/null 'quoted text' done --verbose 2>/dev/null
+		then "$@" readonly "$@" "$1" $(pwd) export done 2>/dev/null local readonly
+	$(pwd) && -eu printf && --verbose printf
+		| then done "$@" /usr/bin done test --verbose &&
+"$@" grep 2>/dev/null export --verbose 'quoted text' -eu x=1
+		"$@" --verbose then 2>/dev/null -eu export
+	&& readonly done $(pwd) -eu export done
+	awk done 'quoted text' cd | readonly
+	local -eu grep 2>/dev/null --verbose /usr/bin ${HOME} "$1" | ${HOME} 'quoted text'
+	&& export test && 2>/dev/null test readonly -eu readonly | $(pwd)
+grep cd $(pwd) $(pwd) "$@" "$@" done
+awk done printf ${HOME} done then test export local
+		test awk 'quoted text' --verbose grep readonly cd | sed echo then ${HOME}
+	cd then /usr/bin "$@" awk | export "$1" then echo "$1" --verbose
+	${HOME} readonly then x=1 test echo awk "$1" | 'quoted text'
+	grep "$@" | | sed | grep && test 'quoted text'
+		awk echo --verbose 2>/dev/null export then "$@" grep test sed --verbose 'quoted text'
+	/usr/bin then ${HOME} 'quoted text' -eu ${HOME} test readonly done | 2>/dev/null
+sed done x=1 awk -eu then echo 'quoted text' awk --verbose
+		--verbose readonly export x=1 --verbose cd "$1"
+	"$1" done x=1 x=1 "$@" then 2>/dev/null readonly echo printf 2>/dev/null
+	awk sed readonly grep grep "$@" -eu grep readonly cd grep && $(pwd) printf sed
+	echo grep grep --verbose && cd done | -eu && -eu /usr/bin grep 2>/dev/null
+		'quoted text' export && grep then -eu | done
+		2>/dev/null test 2>/dev/null /usr/bin then printf ${HOME} readonly done "$1"
+	$(pwd) awk export 2>/dev/null
+		local $(pwd) "$1" 2>/dev/null printf | /usr/bin awk local echo 'quoted text' --verbose
+		&& echo "$1" cd 2>/dev/null 'quoted text' --verbose --verbose "$1" grep cd && awk
+	2>/dev/null grep "$1" "$1"
+	2>/dev/null done local echo --verbose
+sed test "$1" export export x=1 test export readonly export
+	then test ${HOME} export test then | x=1 | printf
+		/usr/bin cd export printf 'quoted text' cd /usr/bin
+		readonly then /usr/bin $(pwd) echo test
+${HOME} then local 2>/dev/null
+		printf /usr/bin then --verbose awk "$@"
+	cd export printf 2>/dev/null 2>/dev/null readonly "$@" "$@" 'quoted text' 2>/dev/null
+	/usr/bin done -eu --verbose 'quoted text' | printf | echo test printf
+	readonly cd ${HOME} local 'quoted text'
+		| /usr/bin -eu echo echo export && "$@" cd "$1" --verbose | grep 2>/dev/null
+	export grep x=1 then export then sed local printf | /usr/bin
+	"$1" local | "$@" $(pwd) $(pwd) cd | cd 2>/dev/null
+| done | test --verbose done $(pwd) cd local $(pwd) "$@" -eu "$1" && /usr/bin
+		x=1 && 2>/dev/null test test export
+--verbose "$1" done && done local grep echo cd grep x=1 awk | grep echo awk
+	&& echo then "$@" local done --verbose && "$1" && test 2>/dev/null --verbose grep
+		--verbose then -eu && $(pwd) cd echo
+$(pwd) readonly --verbose echo echo "$@"
+		then -eu readonly "$@" $(pwd) 'quoted text' export
+		&& && then done grep done
+		| | 2>/dev/null grep export
+		sed && readonly -eu $(pwd) /usr/bin
+	local printf 'quoted text' grep local done test grep "$@" printf "$1"
+	"$@" export echo test && awk printf --verbose $(pwd) local cd -eu | $(pwd) $(pwd)
+	&& printf 2>/dev/null grep ${HOME} grep cd 'quoted text'
+	readonly --verbose printf && awk | ${HOME} "$@" done "$@" cd ${HOME} 'quoted text'
+		export --verbose test echo "$1" 'quoted text'
+sed done export | sed $(pwd) 2>/dev/null export awk --verbose
+then test export sed "$1"
+	then echo ${HOME} sed then grep
+$(pwd) grep "$1" | echo echo $(pwd) awk 'quoted text' -eu $(pwd) printf
+		| printf echo done grep test awk && printf done
+	'quoted text' local readonly --verbose
+test 2>/dev/null "$1" | "$1" && ${HOME} -eu 'quoted text' awk 'quoted text'
+		"$@" cd "$@" sed echo
+		cd | local "$1" x=1 done --verbose cd done /usr/bin readonly grep echo echo
+		awk printf x=1 -eu ${HOME} /usr/bin export x=1 test grep local
+	export local "$@" && 'quoted text' 'quoted text' | 'quoted text' /usr/bin
+	/usr/bin /usr/bin ${HOME} local export -eu && 'quoted text' printf
+		${HOME} sed /usr/bin ${HOME} /usr/bin export --verbose cd 'quoted text'
+x=1 then readonly export $(pwd)
+		readonly then | readonly $(pwd)
+	echo "$1" | "$@" then cd then readonly --verbose --verbose then 2>/dev/null
+| && grep test printf echo | "$1" 'quoted text' 2>/dev/null
+		'quoted text' && && $(pwd) awk 2>/dev/null "$1" awk awk ${HOME}
+		x=1 $(pwd) local echo $(pwd) && readonly
+		"$@" then test | echo cd printf readonly && then x=1 echo readonly sed grep printf
+local 'quoted text' done grep test grep readonly test ${HOME}
+awk grep -eu grep export /usr/bin
+		'quoted text' test "$@" 'quoted text'
+		done | cd readonly x=1 readonly
+	printf echo && readonly ${HOME} ${HOME} x=1 grep
+printf 'quoted text' done
+	then sed $(pwd) "$@" local local
+	| 2>/dev/null /usr/bin grep cd printf awk
+		"$1" 'quoted text' local -eu x=1
+		"$@" local then readonly 2>/dev/null | /usr/bin "$1" && /usr/bin 2>/dev/null
+		printf ${HOME} "$1" $(pwd) then "$@" sed 'quoted text' cd $(pwd) then local test
+done awk awk x=1 -eu 'quoted text' echo /usr/bin test
+	x=1 --verbose cd x=1 2>/dev/null sed done ${HOME} 2>/dev/null
+/usr/bin "$1" && 2>/dev/null
+		"$@" echo "$1" "$1" "$@" $(pwd) ${HOME} /usr/bin ${HOME} sed
+then ${HOME} "$@" done && done
+	/usr/bin export --verbose | x=1 sed printf awk echo local then
+	then $(pwd) export x=1 sed test readonly -eu
+done /usr/bin awk $(pwd) ${HOME} cd readonly
+	-eu readonly printf -eu printf done | "$1" awk
+sed | ${HOME} readonly test 2>/dev/null readonly ${HOME} 2>/dev/null
+	$(pwd) cd "$1" then done | done sed "$@" export test
+&& "$1" 'quoted text' echo done test 'quoted text' export sed echo --verbose readonly
+	readonly "$@" && && /usr/bin "$@" 2>/dev/null x=1 sed 2>/dev/null
+local "$1" $(pwd) cd sed "$1" test 2>/dev/null ${HOME} && done ${HOME} "$1"
+		| then awk awk awk cd 2>/dev/null cd awk --verbose --verbose
+	printf && grep "$@" "$@" local
+printf $(pwd) -eu x=1 --verbose awk ${HOME} -eu | cd readonly "$@" awk
+		export then ${HOME} 2>/dev/null $(pwd) "$@"
+	sed echo $(pwd) 'quoted text' grep
+		| | -eu printf && "$1" export sed --verbose --verbose
+-eu awk 2>/dev/null then 'quoted text' local done local ${HOME}
+		--verbose | test awk x=1 cd $(pwd) | cd && 2>/dev/null
+	echo then readonly && cd awk
+		local 2>/dev/null sed awk echo
+		--verbose /usr/bin done grep x=1 "$@" | awk sed $(pwd) --verbose 'quoted text'
+then done $(pwd) $(pwd) ${HOME} local echo "$1" && cd 'quoted text'
+		printf grep | then cd then && local local export && "$@" /usr/bin export
+readonly printf awk done "$@" /usr/bin ${HOME}
+		$(pwd) awk /usr/bin export printf sed && /usr/bin sed
+		x=1 /usr/bin $(pwd) ${HOME} cd "$1" grep | --verbose export
+	x=1 readonly sed local /usr/bin ${HOME}
+	${HOME} -eu 'quoted text'
+2>/dev/null readonly ${HOME} && --verbose
+		echo --verbose ${HOME} && | ${HOME} echo x=1 $(pwd) sed && $(pwd) done done local
+x=1 readonly --verbose echo | readonly 'quoted text' awk printf "$@" ${HOME}
+		| done $(pwd) 'quoted text' done --verbose "$@" | -eu 2>/dev/null test "$1" local
+readonly 2>/dev/null export readonly
+test grep local test
+		then ${HOME} printf cd export echo 2>/dev/null readonly
+		-eu -eu | && x=1 readonly local ${HOME} x=1 "$@" echo --verbose export
+| sed sed "$1" printf grep $(pwd) 'quoted text'
+	echo 'quoted text' ${HOME} x=1 /usr/bin awk sed cd echo x=1
+		"$@" x=1 "$1" "$@" "$@" then $(pwd) done 'quoted text' printf
+cd 2>/dev/null local $(pwd) 'quoted text'
+	$(pwd) "$1" x=1 | awk "$@" $(pwd) $(pwd)
+		/usr/bin $(pwd) 'quoted text' local "$@" | echo local
+		-eu printf local ${HOME} x=1 -eu echo printf | 'quoted text' done
+		$(pwd) awk done | echo grep printf 2>/dev/null $(pwd) export local
+	&& awk "$@" printf test ${HOME}
+		grep sed awk test ${HOME} 'quoted text'
+	${HOME} && test 'quoted text' && readonly done
+		printf $(pwd) && --verbose 2>/dev/null export done ${HOME} "$1" export
+	done | --verbose sed 'quoted text'
+sed 'quoted text' 'quoted text' then local $(pwd) "$1" grep readonly done
+	'quoted text' then -eu echo then --verbose cd "$@" |
+	--verbose 2>/dev/null cd sed readonly && awk then local 2>/dev/null grep
+'quoted text' export done && export sed readonly | printf x=1 'quoted text'
+	sed ${HOME} $(pwd) && readonly done
+2>/dev/null x=1 -eu $(pwd) awk export readonly /usr/bin readonly
+	cd export 2>/dev/null "$@"
+	test sed sed done echo cd sed
+		"$@" sed done readonly $(pwd) --verbose awk readonly test then ${HOME}
+$(pwd) /usr/bin -eu | test "$1" /usr/bin awk local local "$@" readonly
+&& printf export done "$1" cd /usr/bin readonly 2>/dev/null
+	then 'quoted text' $(pwd) local 'quoted text' 'quoted text'
+		-eu /usr/bin ${HOME} local -eu -eu sed grep printf -eu 2>/dev/null
+2>/dev/null sed /usr/bin "$1" "$@"
+		'quoted text' readonly /usr/bin | then done test awk ${HOME} printf
+readonly then --verbose "$@" printf
+	-eu grep 'quoted text' printf done ${HOME}
+		"$1" readonly "$@" then && $(pwd) local local && awk
+		grep --verbose 'quoted text' 'quoted text' -eu x=1 --verbose
+done "$@" echo x=1 sed test --verbose ${HOME} export local $(pwd) |
+${HOME} sed "$1" | -eu "$1" local "$1" && ${HOME} then sed readonly done readonly
+		local readonly then "$@" export cd echo test
+test && /usr/bin --verbose ${HOME} grep $(pwd)
+		-eu echo 2>/dev/null -eu test -eu ${HOME}
+-eu sed then test 2>/dev/null | readonly done "$@" export $(pwd) export --verbose
+		'quoted text' "$1" /usr/bin | /usr/bin && then sed cd then then printf x=1 echo
+	| x=1 x=1 printf | ${HOME} local sed -eu --verbose "$@" then 'quoted text'
+echo --verbose --verbose export done readonly "$1"
+	| /usr/bin test $(pwd) 'quoted text' ${HOME} /usr/bin local "$@" done
+	cd awk printf echo x=1 $(pwd) grep done
+	cd then "$@" then --verbose cd export
+	awk -eu then 2>/dev/null | awk && 2>/dev/null cd sed "$1" echo "$@" | local
+&& x=1 echo "$1" local awk local
+x=1 printf $(pwd) $(pwd) && local local
+echo && ${HOME} ${HOME} x=1
+	readonly "$@" test printf echo readonly && test printf
+/usr/bin /usr/bin test done cd -eu sed 'quoted text'
+awk export echo && printf "$@" export
+	done $(pwd) awk x=1 ${HOME} ${HOME}
+		/usr/bin ${HOME} test $(pwd) test -eu test -eu && "$@" test
+| then test 2>/dev/null /usr/bin done cd printf export /usr/bin
+		2>/dev/null sed echo readonly x=1 echo local --verbose awk grep test $(pwd)
+"$@" && local -eu -eu awk sed done $(pwd) echo |
+	then echo $(pwd) ${HOME} readonly grep
+		"$@" && -eu && export test readonly then sed grep printf done | | then ${HOME}
+	-eu export done readonly readonly
+	"$1" test done ${HOME} ${HOME}
+	readonly "$@" x=1 /usr/bin
+		grep && export test "$@" x=1 printf --verbose x=1 /usr/bin && test 2>/dev/null
+	grep sed export | awk readonly readonly
+	test grep -eu awk /usr/bin
+		'quoted text' cd awk sed done --verbose export cd done ${HOME}
+	grep $(pwd) echo sed export
+grep sed "$1" cd sed -eu grep x=1 "$@" 2>/dev/null export local 2>/dev/null
+readonly 2>/dev/null then
+		"$1" x=1 test export export ${HOME} awk
+	local cd printf && awk grep && awk "$@" && awk "$@"
+	'quoted text' grep grep 2>/dev/null "$1" "$@" /usr/bin export
+	'quoted text' 'quoted text' -eu then -eu x=1 'quoted text' --verbose $(pwd) sed
+&& done 2>/dev/null /usr/bin ${HOME}
+then 'quoted text' ${HOME} cd sed -eu done
+		sed /usr/bin test cd then --verbose --verbose echo echo cd grep 'quoted text'
+	-eu -eu local test x=1 then readonly readonly
+	-eu "$@" 'quoted text'
+grep x=1 printf && 'quoted text' -eu "$@" grep then
+		sed "$1" readonly done $(pwd) sed local x=1 'quoted text'
+-eu grep ${HOME} then then export "$1" -eu export export | echo
+	/usr/bin then readonly --verbose /usr/bin 'quoted text'
+	printf | /usr/bin sed export local cd "$1"
+export 'quoted text' grep test $(pwd) done awk sed local local echo
+	cd | echo $(pwd) done -eu $(pwd) 'quoted text' -eu -eu local ${HOME} export
+		x=1 /usr/bin "$@" -eu sed then then && --verbose test 'quoted text' readonly
+/usr/bin readonly "$@" && echo "$1"
+		printf && then sed grep "$@" awk grep test -eu 2>/dev/null /usr/bin
+	then awk 2>/dev/null grep && grep
+	-eu /usr/bin echo export grep cd readonly
+		test test 'quoted text' | awk test 2>/dev/null /usr/bin
+	grep ${HOME} x=1 echo then "$@" | ${HOME} sed "$1" printf
+| ${HOME} done 'quoted text'
+	"$1" sed sed && sed echo "$@" printf export
+		${HOME} printf | cd then grep cd "$@" "$@" cd x=1 test | readonly
+	done export readonly ${HOME} local 'quoted text'
+| $(pwd) "$1" 2>/dev/null cd test && readonly
+export done -eu grep grep local "$@" test --verbose echo
+		-eu -eu x=1 readonly 2>/dev/null
+	x=1 sed x=1 2>/dev/null --verbose "$@"
+	grep /usr/bin -eu "$1" sed awk && done sed /usr/bin "$@" local sed && export "$1"
+cd ${HOME} awk cd x=1 ${HOME} && sed $(pwd)
+		--verbose /usr/bin $(pwd)
+		local x=1 x=1 printf --verbose local "$@" "$@" /usr/bin --verbose
+		echo $(pwd) | test /usr/bin cd 2>/dev/null "$@" /usr/bin readonly then ${HOME}
+		--verbose printf && test /usr/bin
+		"$1" /usr/bin "$1" export
+		'quoted text' cd cd awk 2>/dev/null 'quoted text'
+		then ${HOME} export test | ${HOME} "$1" export echo
+	cd 2>/dev/null then printf test "$1" --verbose readonly awk readonly &&
+done -eu printf 2>/dev/null "$@" test ${HOME} sed
+	x=1 grep printf --verbose 'quoted text' ${HOME} test -eu "$@" --verbose 'quoted text'
+'quoted text' | /usr/bin cd test
+		-eu echo awk | test readonly "$@" then /usr/bin
+		'quoted text' "$1" | && && awk | | local "$@" readonly echo readonly |
+export | export then printf 'quoted text' 'quoted text'
+	'quoted text' ${HOME} awk
+		-eu ${HOME} && /usr/bin grep grep 'quoted text' echo && "$@"
+printf 'quoted text' 2>/dev/null x=1 readonly "$@" test
+	$(pwd) local echo test echo
+		&& test then local -eu x=1
+		&& x=1 printf "$1" ${HOME}
+	readonly -eu test "$@" /usr/bin
+		x=1 "$@" $(pwd) awk && local export readonly -eu done --verbose done
+	${HOME} x=1 test "$@" --verbose $(pwd) x=1 | | export --verbose -eu "$@" grep
+		printf local -eu done $(pwd) "$@" printf test
+	grep 2>/dev/null 2>/dev/null /usr/bin "$1" awk "$@" ${HOME}
+	${HOME} test "$@" printf sed then done echo sed -eu $(pwd) sed export test sed
+	'quoted text' printf 2>/dev/null x=1 awk -eu -eu 2>/dev/null
+&& test cd $(pwd) | then && "$1" echo "$1" x=1
+		printf /usr/bin test printf | local "$1" grep cd -eu "$@"
+	sed | grep then test 'quoted text' 'quoted text'
+		-eu x=1 ${HOME} --verbose /usr/bin --verbose --verbose printf
+		/usr/bin | $(pwd) awk x=1 cd "$@" grep -eu --verbose grep echo "$@" grep
+/usr/bin readonly done sed /usr/bin --verbose
+		grep grep $(pwd) --verbose 'quoted text' echo | $(pwd) $(pwd) done
+		| grep 'quoted text' sed
+	readonly /usr/bin && sed 2>/dev/null
+		grep $(pwd) -eu -eu awk "$@" | |
+	then cd awk export test grep x=1 local "$1" grep local x=1 'quoted text'
+done | "$1" sed --verbose then then 2>/dev/null
+&& ${HOME} $(pwd) --verbose test "$@" x=1 awk export
+	awk x=1 awk 'quoted text' awk sed cd "$@" 2>/dev/null readonly done
+| local grep printf export done printf echo 'quoted text' printf 2>/dev/null
+cd ${HOME} export grep cd x=1
+		| printf test printf ${HOME} then x=1 | cd && readonly 2>/dev/null $(pwd) |
+/usr/bin | x=1 | then local 2>/dev/null cd cd -eu x=1 local "$@" && | local --verbose
+		2>/dev/null "$1" 'quoted text' echo then && export grep export done
+		readonly ${HOME} "$@"
+	--verbose "$1" export sed printf x=1 cd x=1 export 'quoted text'
+	| sed sed | done grep | /usr/bin
+readonly sed ${HOME} --verbose -eu $(pwd) cd 2>/dev/null grep | "$1"
+	2>/dev/null awk -eu export printf
+-eu done test grep x=1
+${HOME} then -eu ${HOME} awk export ${HOME}
+		--verbose 2>/dev/null $(pwd) 2>/dev/null ${HOME} sed -eu grep readonly
+	2>/dev/null --verbose then sed
+		cd $(pwd) --verbose | export export "$1" awk export grep echo | $(pwd) sed
+	then && echo --verbose grep printf && sed 'quoted text' export echo export export
+	$(pwd) "$1" 2>/dev/null /usr/bin cd printf local $(pwd) "$@" printf printf
+	printf 'quoted text' x=1 awk
+echo export --verbose --verbose 2>/dev/null | cd cd "$1"
+x=1 $(pwd) | | /usr/bin export printf x=1 --verbose readonly
+-eu /usr/bin export "$@" cd done done then local echo local awk
+	x=1 "$@" 'quoted text' readonly x=1 /usr/bin test done ${HOME}
+	/usr/bin x=1 ${HOME} test -eu "$@" --verbose --verbose awk local
+2>/dev/null grep ${HOME} |
+		test printf x=1 2>/dev/null awk export
+		echo then && $(pwd) awk export printf $(pwd) -eu done 2>/dev/null
+&& grep test /usr/bin --verbose --verbose awk test
+grep -eu export 'quoted text' readonly /usr/bin export --verbose local
+export printf -eu ${HOME} done grep 'quoted text' done
+		x=1 awk grep then echo /usr/bin 2>/dev/null
+		echo x=1 awk test "$1" | printf awk "$1" 2>/dev/null
+		cd "$@" done 'quoted text' done 'quoted text'
+	${HOME} x=1 printf grep readonly "$@" | && 2>/dev/null done 'quoted text'
+		--verbose done done "$@" | grep 'quoted text' && cd
+	cd echo cd cd 2>/dev/null "$@" /usr/bin &&
+	"$@" echo export 2>/dev/null awk && --verbose done awk readonly $(pwd)
+	x=1 then local cd && grep then export local "$@" x=1 x=1
+		"$1" && then | --verbose x=1 $(pwd) x=1 "$1" awk && printf
+x=1 -eu printf export then then cd 'quoted text' readonly export 2>/dev/null
+		"$@" then cd done $(pwd) /usr/bin x=1 'quoted text'
+&& readonly test 2>/dev/null /usr/bin test done x=1
+	echo echo ${HOME} test cd grep /usr/bin sed then "$1" cd done &&
+		echo sed /usr/bin grep
+$(pwd) done export local 'quoted text' local
+	readonly grep /usr/bin && "$1" "$1" ${HOME} cd &&
+	x=1 'quoted text' cd printf export --verbose
+--verbose && local --verbose done ${HOME} grep grep x=1 grep
+		readonly "$1" grep cd done -eu readonly readonly export
+	test ${HOME} sed then | $(pwd) x=1 'quoted text'
+		grep x=1 test | awk then 2>/dev/null cd | export "$@" awk
+		"$@" ${HOME} $(pwd) | -eu local /usr/bin | sed $(pwd) $(pwd) /usr/bin
+2>/dev/null test --verbose 2>/dev/null $(pwd) readonly
+		&& "$1" printf printf local x=1 -eu awk /usr/bin /usr/bin done readonly && test
+done test printf --verbose /usr/bin sed -eu x=1 done && -eu | echo printf
+export 2>/dev/null | /usr/bin awk
+export $(pwd) 2>/dev/null cd export grep sed "$1" echo "$@" awk /usr/bin test done
+sed export && | done cd $(pwd) && "$1" && 'quoted text' awk sed done export
+	'quoted text' sed x=1 printf
+$(pwd) && && 2>/dev/null /usr/bin
+		cd printf local $(pwd) test test local "$@" grep && done /usr/bin "$@"
+		sed && /usr/bin --verbose test 'quoted text' /usr/bin cd awk sed ${HOME} "$1" then
+	test printf test ${HOME} printf local local done readonly readonly then
+	then grep awk done printf
+	'quoted text' /usr/bin ${HOME} readonly
+	2>/dev/null export && sed 2>/dev/null
+		awk done done sed "$1" sed local "$@" echo grep "$1" awk done "$1"
+		readonly export -eu local ${HOME} $(pwd) test
+	awk local -eu sed export export
+"$@" local awk test then |
+		x=1 sed then echo export
+test test | local /usr/bin $(pwd) awk 2>/dev/null --verbose --verbose
+		x=1 && export grep awk -eu "$@"
+		2>/dev/null ${HOME} local
+-eu ${HOME} local 2>/dev/null sed sed 'quoted text' -eu "$@" test awk --verbose
+	readonly awk && sed local local x=1 "$1" 'quoted text'
+2>/dev/null grep grep local "$1"
+		--verbose --verbose cd local cd grep 2>/dev/null -eu ${HOME} cd printf
+echo test awk printf --verbose cd printf 2>/dev/null awk local
+	'quoted text' awk "$@" done local 2>/dev/null then
+		--verbose 2>/dev/null grep grep "$1"
+	'quoted text' printf | -eu 2>/dev/null x=1 grep readonly
+		echo $(pwd) 2>/dev/null awk && grep 'quoted text' | done test -eu
+	| 'quoted text' local test cd /usr/bin
+		awk --verbose sed x=1 --verbose && local /usr/bin 'quoted text'
+	local done && /usr/bin 2>/dev/null readonly done ${HOME} cd --verbose
+	$(pwd) /usr/bin local /usr/bin /usr/bin
+	${HOME} sed printf echo export
+	| 'quoted text' readonly && $(pwd) ${HOME} local done 'quoted text'
+	test local readonly /usr/bin --verbose local 'quoted text'
+	then x=1 && printf /usr/bin x=1 readonly grep --verbose
+test echo test 'quoted text' x=1 awk | awk | local readonly
+&& $(pwd) local printf grep --verbose
+awk 'quoted text' awk echo grep export cd "$@" export
+done echo then "$@" | | --verbose export 2>/dev/null
+		sed x=1 "$1" && -eu done local local awk then "$1" && printf x=1 cd readonly --verbose
+export then then grep 'quoted text' 2>/dev/null
+		/usr/bin awk sed local ${HOME}
+done "$1" echo | done grep /usr/bin grep -eu $(pwd) test export
+#include c8.sh
+		&& done test local local "$1" "$1" 'quoted text' grep "$1"
+--verbose --verbose test local
+	awk --verbose /usr/bin
+		sed --verbose 2>/dev/null readonly
+		-eu export $(pwd) grep test $(pwd) done readonly local ${HOME} /usr/bin
+	/usr/bin awk "$@" readonly awk && grep cd
+		then | 'quoted text' /usr/bin | grep /usr/bin cd | x=1 cd "$@" echo $(pwd)
+2>/dev/null then -eu sed export sed -eu echo
+	${HOME} export $(pwd) 2>/dev/null export printf
+	-eu printf done then x=1 -eu printf --verbose "$@" done grep then test grep echo
+	${HOME} test local cd ${HOME} awk && -eu
+printf printf sed --verbose echo ${HOME} ${HOME} local 2>/dev/null
+		&& ${HOME} "$@" done test 'quoted text'
+	${HOME} awk printf 2>/dev/null
+		"$1" 'quoted text' x=1 then x=1 2>/dev/null
+2>/dev/null | "$@" echo printf grep 2>/dev/null
+	echo "$@" -eu grep printf
+	&& readonly sed grep awk echo "$1" && export cd printf -eu 'quoted text' | printf
+	&& /usr/bin test && echo "$1" done 'quoted text' sed readonly
+		x=1 printf test && 2>/dev/null grep 2>/dev/null
+		grep -eu then cd export awk x=1 export -eu 2>/dev/null
+		${HOME} then | $(pwd) /usr/bin done && -eu export
+2>/dev/null ${HOME} grep
+		${HOME} x=1 echo cd printf 'quoted text' then export sed $(pwd) "$1" test
+		done 2>/dev/null export $(pwd) export x=1 && done export awk
+	-eu printf sed && printf cd x=1 $(pwd)
+-eu 'quoted text' && ${HOME} local export && done echo
+		${HOME} ${HOME} then local $(pwd) done export -eu "$1" done export ${HOME}
+	x=1 ${HOME} readonly 'quoted text' done | 2>/dev/null then 2>/dev/null
+test -eu $(pwd) echo /usr/bin printf printf
+	printf grep export && printf then cd awk && x=1 && "$1"
+		cd awk readonly 'quoted text' export
+grep $(pwd) cd local | printf
+"$@" "$@" | "$@" local awk && 2>/dev/null local "$@" cd readonly
+		&& echo -eu sed done cd sed
+readonly 2>/dev/null printf
+		local sed echo readonly printf "$@" && &&
+	--verbose /usr/bin test grep local $(pwd)
+sed echo x=1 -eu readonly --verbose
+	'quoted text' "$@" && printf $(pwd) echo x=1 | | test $(pwd) /usr/bin
+		/usr/bin then done x=1 2>/dev/null
+		printf done grep x=1 cd "$1" --verbose sed --verbose printf printf cd 'quoted text'
+readonly && "$@" printf readonly
+		${HOME} "$1" | 2>/dev/null
+"$1" --verbose readonly -eu |
+	&& --verbose cd "$1" sed "$1" x=1 x=1 "$1" | readonly sed ${HOME} grep local test
+		awk readonly --verbose export export ${HOME} printf grep 2>/dev/null 'quoted text'
+$(pwd) awk 2>/dev/null $(pwd) "$@" "$1" local 'quoted text'
+	"$@" "$1" readonly cd awk readonly then /usr/bin local /usr/bin export
+		x=1 echo $(pwd) /usr/bin local 'quoted text' grep local
+$(pwd) test 'quoted text' && | grep awk -eu ${HOME} && x=1
+x=1 /usr/bin "$@" 'quoted text' /usr/bin $(pwd) | "$@" 'quoted text' x=1 awk
+		printf 'quoted text' printf /usr/bin readonly
+	echo test /usr/bin 2>/dev/null
+	/usr/bin /usr/bin $(pwd) && test
+	printf -eu "$@" --verbose sed then $(pwd) 2>/dev/null "$@" "$@" ${HOME}
+	${HOME} "$1" export /usr/bin
+		--verbose "$@" && awk readonly sed echo grep printf /usr/bin
+	local ${HOME} sed --verbose export --verbose then sed | readonly done /usr/bin
+"$@" 'quoted text' done | "$@" "$@" x=1 /usr/bin export readonly printf
+done cd local | "$@" ${HOME} export test /usr/bin sed printf
+--verbose "$@" cd grep ${HOME} 'quoted text' x=1 /usr/bin
+		$(pwd) 2>/dev/null "$@" "$@" $(pwd) done done cd $(pwd)
+		readonly $(pwd) cd "$@" readonly grep then printf local --verbose cd
+printf test then 2>/dev/null
+"$@" -eu cd cd $(pwd) export readonly "$1"
+		test $(pwd) | $(pwd) done 'quoted text' awk
+		'quoted text' readonly awk --verbose printf 'quoted text' printf awk grep then
+		local done local -eu
+		'quoted text' $(pwd) cd --verbose -eu export cd export
+--verbose test then $(pwd) sed export
+		readonly local awk cd "$@" 'quoted text' grep 'quoted text'
+x=1 --verbose cd echo 'quoted text' x=1 "$@" sed echo awk "$1" && --verbose
+	sed --verbose echo $(pwd) echo --verbose && 2>/dev/null
+		$(pwd) then 2>/dev/null grep ${HOME} echo export
+--verbose export ${HOME} x=1 then
+	printf $(pwd) "$@" x=1 --verbose awk cd sed /usr/bin export
+	grep printf "$1" 'quoted text' "$1" echo
+local x=1 "$@" 'quoted text'
+	done done -eu readonly cd sed
+		done export ${HOME} test 'quoted text' cd "$@" /usr/bin 2>/dev/null then &&
+		$(pwd) /usr/bin done local && ${HOME} echo sed x=1 cd local cd
+		cd awk then "$1" && x=1 | --verbose
+		test "$1" && --verbose export /usr/bin /usr/bin
+-eu --verbose 2>/dev/null 2>/dev/null
+		local --verbose --verbose --verbose printf | readonly /usr/bin && grep local
+"$1" ${HOME} then awk && x=1 readonly
+		"$@" local done ${HOME} awk "$@" "$@" readonly $(pwd) local x=1 readonly
+		| $(pwd) readonly --verbose local local
+	${HOME} sed export 2>/dev/null
+		echo $(pwd) x=1 echo | /usr/bin "$1" -eu cd cd readonly | | --verbose
+		2>/dev/null sed --verbose ${HOME}
+	local -eu "$1" awk echo then grep done -eu echo test -eu test 'quoted text'
+		2>/dev/null then "$@" && local 2>/dev/null x=1 /usr/bin then sed "$1"
+2>/dev/null "$1" 'quoted text' "$@" local grep printf -eu
+$(pwd) sed sed ${HOME} export
+	readonly awk -eu test local "$1" test x=1 awk 'quoted text' x=1 awk 2>/dev/null
+	done local 2>/dev/null -eu 'quoted text' $(pwd)
+		export grep "$1" x=1 then grep 'quoted text' readonly x=1 /usr/bin then ${HOME}
+		--verbose export 'quoted text' | sed grep local
+		then 'quoted text' "$@" $(pwd) ${HOME} then test
+echo cd 'quoted text' ${HOME} $(pwd) $(pwd) grep grep --verbose local printf echo
+--verbose 'quoted text' "$1" grep 2>/dev/null --verbose printf
+	cd $(pwd) && "$1" echo | sed /usr/bin
+--verbose --verbose cd 'quoted text' echo -eu --verbose x=1 sed
+	readonly | export readonly grep $(pwd)
+	/usr/bin | $(pwd) -eu /usr/bin
+		grep -eu --verbose ${HOME} grep done $(pwd) test echo x=1 --verbose printf x=1
+-eu $(pwd) echo $(pwd)
+2>/dev/null /usr/bin /usr/bin 2>/dev/null test then
+	&& "$1" readonly --verbose done ${HOME} then echo --verbose
+		done /usr/bin readonly echo echo sed 'quoted text'
+	export 2>/dev/null && ${HOME} ${HOME} 'quoted text' grep
+	2>/dev/null printf $(pwd)
+		/usr/bin /usr/bin sed cd sed "$1" grep sed readonly $(pwd) local
+-eu /usr/bin 2>/dev/null 'quoted text'
+	2>/dev/null "$1" 2>/dev/null test grep "$1"
+	awk awk | then $(pwd) "$@" printf echo "$@" done cd test
+	readonly local printf -eu export done --verbose grep cd readonly x=1 cd grep
+x=1 echo 'quoted text' 'quoted text' done && $(pwd) x=1 --verbose test /usr/bin
+	&& local "$1" ${HOME} then grep && /usr/bin
+--verbose sed export sed && 'quoted text' local "$@" ${HOME} export
+		"$1" -eu echo --verbose --verbose
+	export 2>/dev/null export 2>/dev/null cd 'quoted text'
+		/usr/bin printf x=1 export 2>/dev/null $(pwd) readonly then then cd
+		local grep | test local sed local 'quoted text' grep readonly done ${HOME}
+		cd cd x=1 2>/dev/null test --verbose
+		local echo done grep printf test /usr/bin then x=1 'quoted text' test done
+"$@" sed grep ${HOME} printf local
+	${HOME} export awk echo $(pwd) x=1 export sed readonly 'quoted text'
+	--verbose -eu test -eu then then readonly then awk 'quoted text' -eu
+		test x=1 grep $(pwd) test test local grep /usr/bin &&
+	export awk echo ${HOME} && local ${HOME} cd --verbose test sed
+done ${HOME} "$@" awk $(pwd)
+	${HOME} awk done sed done && 2>/dev/null 'quoted text'
+		then && x=1 /usr/bin && export "$1" echo -eu /usr/bin -eu --verbose
+	grep cd sed sed echo export x=1 | echo "$@" echo && ${HOME}
+	"$1" done sed 'quoted text'
+export done /usr/bin --verbose -eu export $(pwd) test 2>/dev/null readonly 2>/dev/null
+		export cd 'quoted text' /usr/bin "$@" echo sed then then && awk test export
+		grep | 'quoted text' printf $(pwd) ${HOME} "$@" ${HOME} then /usr/bin sed then
+		2>/dev/null "$@" -eu printf
+		sed done -eu done $(pwd)
+	readonly grep ${HOME} "$1" 'quoted text' printf readonly awk test --verbose
+		"$1" $(pwd) echo done grep grep awk 2>/dev/null $(pwd)
+		sed sed -eu 2>/dev/null "$1" 'quoted text' | x=1 $(pwd)
+	readonly export cd test | && done -eu "$1" | x=1 done | local
+cd "$@" printf "$@" done "$@" sed echo sed x=1 sed readonly x=1 /usr/bin
+		"$1" 2>/dev/null cd x=1 'quoted text'
+awk --verbose cd awk | awk | /usr/bin export 2>/dev/null export -eu printf "$@"
+	grep "$1" | 'quoted text' "$1" 2>/dev/null test then
+	sed awk /usr/bin echo echo 2>/dev/null
+		sed test local done 'quoted text'
+	-eu && readonly export export --verbose
+2>/dev/null --verbose grep grep local
+		test cd export then $(pwd) done grep --verbose
+	| test /usr/bin cd /usr/bin sed -eu readonly awk 'quoted text'
+"$1" sed sed $(pwd) done
+printf -eu | ${HOME} test echo then 2>/dev/null "$@" -eu x=1 export ${HOME} x=1
+		export done ${HOME} export
+	${HOME} --verbose export printf echo && echo | then
+cd printf | /usr/bin | echo /usr/bin
+done readonly local --verbose printf
+		sed awk awk readonly sed | $(pwd)
+		$(pwd) ${HOME} /usr/bin x=1 echo
+	grep export 2>/dev/null /usr/bin readonly readonly grep test done local "$1"
+then awk -eu --verbose readonly sed | readonly sed "$1" test
+		awk local 'quoted text' printf -eu echo test sed x=1 grep x=1 local then sed
+sed $(pwd) then 'quoted text' && 2>/dev/null
+		sed x=1 local export 'quoted text' /usr/bin --verbose "$@" x=1 && "$1" echo
+	export test local --verbose cd /usr/bin "$@"
+		local ${HOME} awk cd echo grep -eu 'quoted text'
+x=1 ${HOME} grep echo | ${HOME} -eu awk echo ${HOME} "$1" done echo 'quoted text'
+'quoted text' echo then ${HOME} grep echo
+		2>/dev/null /usr/bin printf local --verbose awk /usr/bin awk printf local
+		| && | x=1 printf --verbose then && export --verbose
+	sed awk echo x=1 ${HOME} ${HOME} done
+	'quoted text' | export /usr/bin | | $(pwd) ${HOME} then x=1 2>/dev/null
+	"$1" --verbose x=1 -eu export --verbose x=1 local "$1" "$1" done -eu
+	readonly 2>/dev/null sed --verbose
+| export 2>/dev/null --verbose done local export readonly
+	sed test done && grep echo
+	"$1" done sed readonly grep "$@" local | &&
+grep printf ${HOME} 'quoted text' grep 'quoted text'
+		--verbose /usr/bin | && -eu grep sed sed && then $(pwd) "$@" local --verbose
+${HOME} -eu done --verbose $(pwd) /usr/bin cd local export echo export
+		echo x=1 echo done grep
+printf printf local awk | && then /usr/bin printf printf
+		| 2>/dev/null sed "$1" then
+readonly sed | test /usr/bin
+grep | $(pwd) then grep 2>/dev/null awk local
+		"$@" export -eu awk readonly grep --verbose cd readonly 2>/dev/null
+	-eu export then done /usr/bin 2>/dev/null grep test test test
+	export ${HOME} then printf local
+"$@" then done && then test $(pwd) export grep readonly
+		printf --verbose -eu --verbose
+	grep 'quoted text' cd sed
+	-eu x=1 export sed awk sed /usr/bin then && grep /usr/bin local readonly
+$(pwd) -eu --verbose -eu x=1 printf done x=1 "$@" $(pwd) 'quoted text'
+		sed export ${HOME} local
+		done 'quoted text' grep $(pwd) x=1 awk echo x=1 export local
+test --verbose x=1 -eu "$@" "$@" sed --verbose 2>/dev/null 'quoted text'
+	-eu readonly /usr/bin done /usr/bin done export && printf ${HOME} then "$1"
+	-eu export done sed readonly
+		x=1 awk echo printf "$1" then
+		| sed export "$1" 2>/dev/null -eu -eu | test
+		"$@" x=1 "$1" done "$@" export 'quoted text'
+	export then readonly "$1" echo -eu then "$@" test done done awk then sed
+		local 2>/dev/null "$1" "$1" grep test
+export x=1 test "$@" export ${HOME} "$1" ${HOME} test && "$@" readonly && printf
+		/usr/bin /usr/bin local && echo "$@" -eu done echo 'quoted text' x=1 readonly
+then cd -eu cd | readonly test x=1 | cd printf local 2>/dev/null
+	--verbose grep -eu /usr/bin sed 2>/dev/null printf printf done "$@" 2>/dev/null
+	"$@" test done local "$1" export "$@" "$1" export
+		2>/dev/null "$@" "$1" $(pwd) && echo cd echo readonly x=1 test /usr/bin
+-eu done "$@" export x=1 readonly $(pwd) readonly then $(pwd) then $(pwd) x=1
+	&& --verbose test awk | printf --verbose && printf
+		printf export local cd | done x=1 "$@" "$1" 2>/dev/null cd && awk | awk
+		$(pwd) && && then $(pwd) /usr/bin echo done sed printf $(pwd) "$1"
+	-eu x=1 then | readonly && test test /usr/bin "$1" && --verbose
+		sed -eu 2>/dev/null readonly test 'quoted text' then echo test cd
+/usr/bin local done && printf -eu /usr/bin grep &&
+		--verbose awk -eu /usr/bin "$1" | x=1 local "$1" -eu
+-eu && grep printf printf printf local sed echo "$@" "$1" $(pwd)
+	'quoted text' 2>/dev/null $(pwd)
+	"$@" /usr/bin cd ${HOME} && local printf "$@" local export
+	test -eu "$@" sed $(pwd) done awk "$1" echo && 'quoted text' sed ${HOME}
+	2>/dev/null cd | cd 'quoted text' then printf
+"$1" /usr/bin echo && cd grep $(pwd) export sed && "$@" awk test -eu /usr/bin
+		${HOME} echo echo /usr/bin local then ${HOME} grep local
+		grep awk ${HOME} sed readonly
+done done echo awk done readonly cd awk ${HOME} | done -eu
+	sed printf printf x=1
+then then 2>/dev/null then local local
+	echo test && ${HOME} sed echo && 'quoted text'
+		$(pwd) readonly | echo then test -eu cd done $(pwd) "$@" x=1 grep /usr/bin
+	cd test | 'quoted text' cd
+	then done --verbose $(pwd) $(pwd) /usr/bin printf $(pwd) echo 'quoted text'
+		test then then --verbose printf printf --verbose
+	$(pwd) awk | /usr/bin ${HOME}
+		| then ${HOME} "$@" then printf test "$1" "$1" $(pwd) /usr/bin -eu | test done
+/usr/bin test $(pwd) && "$@" test
+		readonly sed "$1" cd sed then ${HOME} done "$1"
+		"$@" echo "$@" x=1 ${HOME} test | cd grep
+	local $(pwd) cd -eu local 'quoted text' | ${HOME}
+		--verbose "$1" test "$@" "$@" "$1"
+	"$@" echo local printf
+then "$1" awk grep $(pwd) test "$@" "$@"
+		readonly && readonly -eu | readonly && export "$@" -eu
+	| 2>/dev/null then grep "$1" | $(pwd) "$@"
+sed "$1" export done 'quoted text' then then cd
+		readonly awk echo /usr/bin readonly ${HOME} ${HOME}
+		x=1 echo readonly echo x=1 local -eu
+		grep test $(pwd) cd export "$1" --verbose
+	then --verbose "$@" export cd x=1 local then test "$1" echo
+	"$1" "$1" test --verbose | ${HOME} 2>/dev/null readonly awk /usr/bin
+--verbose sed then sed | sed test --verbose
+		awk /usr/bin x=1 ${HOME} grep &&
+		done grep /usr/bin cd x=1 $(pwd) | 'quoted text' readonly && test awk
+/usr/bin awk echo -eu "$1" /usr/bin then
+-eu | 'quoted text' then printf 'quoted text' 'quoted text' x=1 | readonly
+		printf | then cd echo readonly 'quoted text'
+"$1" local readonly /usr/bin printf /usr/bin
+	then "$@" --verbose | $(pwd) then export
+	test && test sed printf | $(pwd) && | "$1" printf 'quoted text'
+		local sed /usr/bin --verbose /usr/bin
+		done $(pwd) then x=1 -eu | -eu 'quoted text'
+		'quoted text' "$@" test cd test done ${HOME} test x=1
+| printf ${HOME} printf printf --verbose echo /usr/bin
+	"$@" --verbose then grep ${HOME} then /usr/bin -eu -eu 'quoted text'
+	${HOME} $(pwd) $(pwd) echo done
+		done 'quoted text' | then
+	cd printf printf && x=1 --verbose && /usr/bin $(pwd) "$@" | ${HOME} readonly
+	&& --verbose -eu --verbose x=1 'quoted text' "$@" /usr/bin
+		${HOME} readonly awk 2>/dev/null "$1" export -eu awk local printf ${HOME}
+| export 2>/dev/null $(pwd) done
+-eu printf 'quoted text' "$@" grep sed awk "$@"
+	-eu $(pwd) 2>/dev/null readonly ${HOME} export && export ${HOME} "$@" test done
+	--verbose awk ${HOME} sed "$@" x=1 && cd
+	$(pwd) --verbose x=1 "$@" 'quoted text' printf
+		--verbose test cd ${HOME} 'quoted text'
+		${HOME} "$@" export $(pwd) $(pwd) "$@" readonly 2>/dev/null "$1" local --verbose
+		'quoted text' done local
+-eu x=1 readonly echo $(pwd) /usr/bin
+test local --verbose && then export
+	'quoted text' done sed --verbose test --verbose readonly echo grep done x=1
+2>/dev/null cd -eu done local 'quoted text' printf | grep echo echo | $(pwd)
+	&& done "$1" --verbose local sed cd
+		export "$@" "$@" ${HOME} | readonly
+/usr/bin test grep 2>/dev/null done x=1 local $(pwd) /usr/bin cd printf $(pwd)
+	"$@" | && grep grep test "$@" | 'quoted text' sed local /usr/bin readonly
+'quoted text' printf "$@" local
+&& "$@" ${HOME} echo 'quoted text' 2>/dev/null ${HOME}
+		&& ${HOME} "$@" sed -eu awk /usr/bin
+		--verbose 2>/dev/null printf done "$@" then grep sed test done
+readonly && test done cd $(pwd) "$@"
+		'quoted text' 'quoted text' "$1" ${HOME} awk done /usr/bin -eu
+echo -eu 2>/dev/null awk /usr/bin ${HOME} "$@" cd test 'quoted text' && test
+		x=1 local test printf -eu done readonly
+		"$1" --verbose done /usr/bin --verbose $(pwd)
+-eu | $(pwd) sed sed echo x=1 "$@" echo readonly
+	/usr/bin /usr/bin "$@" /usr/bin "$@" --verbose
+	readonly "$@" /usr/bin printf
+$(pwd) x=1 'quoted text' && "$@" "$@" awk cd "$1"
+	done ${HOME} -eu then "$@" | "$@" 'quoted text' "$1" echo ${HOME} done
+		$(pwd) && "$@" awk test -eu | test printf x=1 cd then --verbose "$@"
+	"$@" /usr/bin ${HOME} "$1" local -eu --verbose done printf
+local done "$@" test ${HOME} | echo "$@" "$1" --verbose
+		-eu cd ${HOME} echo $(pwd) awk $(pwd) -eu && sed then done "$1" export --verbose
+		test --verbose 2>/dev/null awk echo ${HOME} $(pwd) "$@" local
+x=1 x=1 /usr/bin "$1" --verbose ${HOME}
+		export 2>/dev/null cd then $(pwd) cd export && | then x=1
+	"$1" test printf printf ${HOME} grep /usr/bin 'quoted text' 2>/dev/null
+		sed awk echo grep printf | $(pwd)
+		sed -eu 'quoted text' readonly | grep awk 2>/dev/null | local 2>/dev/null test
+	x=1 $(pwd) sed /usr/bin 'quoted text' --verbose -eu $(pwd) /usr/bin done
+		$(pwd) "$1" /usr/bin x=1 test 2>/dev/null test local
+		'quoted text' test 2>/dev/null export --verbose
+		printf && done | test "$@" ${HOME} local echo 'quoted text'
+"$1" test 'quoted text' awk 2>/dev/null --verbose
+test 2>/dev/null done grep && "$@" 2>/dev/null echo local export sed &&
+'quoted text' 2>/dev/null x=1
+	2>/dev/null done && "$@" 2>/dev/null --verbose x=1 --verbose local
+		done 2>/dev/null -eu $(pwd) sed then
+&& ${HOME} "$1" --verbose cd
+	echo --verbose test done test -eu --verbose /usr/bin 'quoted text'
+	2>/dev/null echo export $(pwd) readonly 'quoted text'
+		&& export --verbose local awk --verbose "$1" export local
+		local echo local cd awk awk local x=1 test -eu && test
+'quoted text' echo sed grep local -eu
+"$1" /usr/bin printf then printf "$1" done /usr/bin sed ${HOME} sed
+	$(pwd) echo x=1 readonly | sed "$@" /usr/bin readonly done
+test ${HOME} test done printf x=1 x=1 local then "$1" "$@" && echo "$@"
+	echo && 'quoted text' echo sed sed then "$1" /usr/bin done $(pwd) x=1 2>/dev/null
+		x=1 x=1 2>/dev/null grep echo done | /usr/bin
+x=1 x=1 | x=1 printf printf 'quoted text' printf then -eu export
+		sed x=1 grep test --verbose x=1 export ${HOME} 2>/dev/null local then "$1"
+	${HOME} | $(pwd) local x=1
+	'quoted text' readonly 2>/dev/null done | x=1 "$@" 'quoted text'
+	2>/dev/null | printf "$@" "$@" -eu x=1 awk x=1 awk "$1" sed 'quoted text'
+awk awk /usr/bin && then printf -eu /usr/bin sed test $(pwd) && "$@" /usr/bin
+	test --verbose $(pwd) /usr/bin
+	$(pwd) then echo awk test then grep --verbose
+readonly $(pwd) 2>/dev/null x=1 ${HOME}
+		${HOME} grep grep echo && readonly "$1"
+-eu ${HOME} -eu && printf awk local
+	/usr/bin 'quoted text' grep test 2>/dev/null "$1" sed sed
+		cd "$1" export "$@" 2>/dev/null done awk "$@" awk done printf "$1"
+		test sed export export local --verbose
+	readonly -eu $(pwd) /usr/bin 2>/dev/null x=1 "$@" grep done export export
+&& --verbose $(pwd) readonly 2>/dev/null done | --verbose
+	$(pwd) local $(pwd) awk awk printf printf "$1" then "$@" printf | awk
+2>/dev/null 'quoted text' echo "$1" done sed $(pwd) ${HOME} printf local done test
+		${HOME} "$1" 'quoted text' /usr/bin ${HOME} 'quoted text' &&
+		test | "$@" $(pwd) echo echo readonly grep -eu then x=1 'quoted text'
+	then echo readonly sed export printf cd done then export echo done x=1 -eu
+/usr/bin sed $(pwd) printf awk sed sed --verbose then
+	echo printf echo --verbose
+		$(pwd) --verbose printf export cd && local x=1 && awk 2>/dev/null
+		&& local local 'quoted text' done ${HOME} grep $(pwd) "$@"
+export awk local 'quoted text' "$1" "$1" "$1" sed printf -eu 'quoted text' export
+		grep awk local export 'quoted text' echo |
+x=1 export "$@" "$1" -eu test export export ${HOME} "$@" echo sed ${HOME} $(pwd)
+	local cd local sed cd $(pwd) && grep 2>/dev/null local grep printf
+	awk export done "$1" $(pwd) awk cd | cd awk printf --verbose printf
+		x=1 "$1" 'quoted text' /usr/bin "$@" awk /usr/bin
+	cd export grep "$1" local awk then done 2>/dev/null awk "$@" $(pwd) then
+		done "$1" $(pwd) --verbose | $(pwd)
+		printf && then cd --verbose export && --verbose
+${HOME} $(pwd) then "$1" local local
+	$(pwd) awk $(pwd) /usr/bin done echo then
+	'quoted text' ${HOME} $(pwd) /usr/bin ${HOME}
+	export sed x=1 sed test && awk done 'quoted text' done $(pwd) readonly /usr/bin
+readonly awk && x=1 -eu
+local sed sed echo /usr/bin local
+readonly x=1 awk printf x=1 sed printf ${HOME} && &&
+readonly grep awk echo sed done then local test
+	cd export echo sed && ${HOME} done
+'quoted text' printf x=1 | x=1
+		'quoted text' export test local ${HOME} --verbose export readonly /usr/bin echo
+	echo test x=1 ${HOME} $(pwd) echo test ${HOME} local done "$@" | x=1 echo x=1 then
+		${HOME} -eu export && cd grep sed $(pwd) sed ${HOME} grep
+		$(pwd) $(pwd) $(pwd) |
+grep test --verbose sed awk then --verbose $(pwd) -eu && cd done grep -eu "$1"
+"$1" ${HOME} echo local test test test | awk printf --verbose done ${HOME} export
+	| "$@" 'quoted text' "$1" $(pwd) 2>/dev/null readonly awk cd
+		sed --verbose -eu 2>/dev/null test readonly
+		local printf -eu export ${HOME} awk | --verbose | "$@" export
+	2>/dev/null test && local then 'quoted text'
+"$1" ${HOME} | done 2>/dev/null grep --verbose echo ${HOME} sed cd readonly /usr/bin
+	sed ${HOME} "$@" | ${HOME} awk local 'quoted text'
+	grep local printf "$1" | $(pwd) grep $(pwd)
+		"$1" "$@" sed 'quoted text'
+	done done grep grep /usr/bin /usr/bin "$1" | $(pwd) done 2>/dev/null
+&& /usr/bin --verbose "$1" -eu "$1" then $(pwd) 'quoted text'
+		$(pwd) "$1" "$1" grep /usr/bin readonly cd $(pwd)
+then echo x=1 x=1 "$@" printf "$1" then --verbose
+"$1" x=1 'quoted text' /usr/bin
+	'quoted text' then sed 2>/dev/null sed printf then
+		cd "$1" x=1 done 'quoted text' readonly "$@" x=1 grep awk /usr/bin
+	export done then readonly then $(pwd) echo echo
+	--verbose ${HOME} grep cd $(pwd) ${HOME} /usr/bin echo grep local awk 'quoted text'
+		--verbose export ${HOME} --verbose --verbose x=1 test readonly
+export 'quoted text' readonly
+'quoted text' echo export awk readonly readonly awk
+	sed local readonly /usr/bin cd | "$@" | done test 2>/dev/null done $(pwd) && echo
+		| then sed /usr/bin "$1" $(pwd) $(pwd) | $(pwd) done sed cd cd && $(pwd)
+${HOME} x=1 test cd 'quoted text' readonly "$@" /usr/bin ${HOME}
+		-eu echo /usr/bin "$1" $(pwd) done $(pwd) x=1 ${HOME}
+		sed /usr/bin 2>/dev/null printf | done 'quoted text' 'quoted text' done -eu 'quoted text'
+		grep --verbose then 'quoted text' printf -eu
+	$(pwd) | readonly cd export "$@"
+		"$@" $(pwd) ${HOME} 'quoted text'
+	grep $(pwd) --verbose 'quoted text' 2>/dev/null printf
+	${HOME} x=1 readonly x=1 x=1 x=1 printf local export echo readonly --verbose
+	${HOME} cd && done $(pwd) sed local sed "$@" then && 2>/dev/null $(pwd) done local
+		${HOME} cd | grep && --verbose 'quoted text' readonly /usr/bin test export grep
+	"$1" export --verbose "$@" readonly local done done "$@" awk x=1 cd | x=1 x=1
+	readonly --verbose local "$@" echo printf -eu
+		x=1 sed printf 2>/dev/null then test "$@" awk "$@" /usr/bin ${HOME}
+	--verbose export "$@" local readonly export 'quoted text' grep
+		cd awk export 'quoted text' /usr/bin
+	${HOME} ${HOME} export printf sed cd && "$@" -eu
+	| awk && && 'quoted text' /usr/bin printf --verbose --verbose /usr/bin
+		local 'quoted text' then echo printf && -eu ${HOME}
+		done --verbose x=1 /usr/bin awk export -eu /usr/bin sed
+"$1" --verbose readonly | $(pwd) 2>/dev/null $(pwd) ${HOME} sed ${HOME}
+'quoted text' readonly test 'quoted text' x=1 x=1 "$@" then
+		-eu /usr/bin printf "$@" -eu awk then sed local
+		2>/dev/null x=1 export -eu echo 2>/dev/null local sed local local local cd --verbose
+"$1" "$@" then && readonly printf test x=1 grep printf /usr/bin local local export
+	${HOME} -eu && x=1 readonly
+sed | readonly -eu "$@" echo 'quoted text' "$1" cd export then ${HOME}
+	printf | | cd 'quoted text'
+		'quoted text' && | cd 2>/dev/null
+	then grep --verbose cd && printf
+"$1" done ${HOME} $(pwd) "$@" 2>/dev/null --verbose test
+	${HOME} readonly | sed 2>/dev/null x=1 test done local
+		"$@" done x=1 cd then printf awk /usr/bin x=1 2>/dev/null grep 2>/dev/null
+		2>/dev/null then then cd done sed | --verbose sed export 'quoted text' cd test
+$(pwd) && readonly printf ${HOME} --verbose && && export
+		-eu done --verbose awk 2>/dev/null printf
+	| printf local printf readonly then
+		--verbose $(pwd) | local export $(pwd)
+		readonly printf awk grep awk $(pwd) && | awk && then export 2>/dev/null
+-eu /usr/bin readonly readonly --verbose
+	awk "$1" ${HOME} readonly 'quoted text'
+2>/dev/null | awk test awk then 'quoted text' $(pwd) done
+	awk local /usr/bin done && -eu --verbose $(pwd) then awk
+		test 'quoted text' test cd $(pwd) done
+cd echo /usr/bin 2>/dev/null test x=1 ${HOME} readonly local $(pwd) grep sed
+done x=1 printf printf cd $(pwd) awk grep sed
+	echo test /usr/bin ${HOME} grep done "$1" printf test cd test
+		grep test test | readonly "$1" local --verbose printf 'quoted text'
+	export grep ${HOME} done "$@" printf cd ${HOME}
+/usr/bin readonly ${HOME} sed export local "$1" && | 2>/dev/null
+	/usr/bin x=1 printf export "$@" export -eu grep sed done "$1" "$@" "$1" awk $(pwd)
+	printf test grep $(pwd) ${HOME} echo local cd export --verbose | echo test
+printf sed -eu ${HOME} then test 'quoted text' $(pwd) awk export
+	test grep 'quoted text' cd "$@" $(pwd) ${HOME} ${HOME} readonly ${HOME} /usr/bin
+--verbose x=1 2>/dev/null
+test done grep 'quoted text'
+awk export "$@" --verbose -eu sed "$@" printf && 2>/dev/null
+		'quoted text' | "$@" sed export | printf x=1 x=1 test 2>/dev/null printf
+-eu 2>/dev/null | -eu grep readonly echo
+	echo -eu ${HOME} --verbose
+		awk -eu --verbose 'quoted text'
+local then readonly grep && local
+	printf "$@" grep test &&
+	sed ${HOME} $(pwd) $(pwd) $(pwd) sed awk done
+"$1" local grep sed $(pwd)
+printf /usr/bin local $(pwd) printf 2>/dev/null 'quoted text' printf
+test sed "$1" sed ${HOME} --verbose done &&
+sed 2>/dev/null export test awk cd echo cd -eu
+		$(pwd) readonly "$@" --verbose /usr/bin ${HOME} readonly "$1"
+grep cd awk grep sed -eu
+&& $(pwd) "$@" x=1 x=1 cd -eu 2>/dev/null --verbose
+		printf done "$1" sed ${HOME} printf grep awk "$@"
+	2>/dev/null ${HOME} $(pwd) /usr/bin export readonly readonly /usr/bin $(pwd)
+	printf awk /usr/bin "$1" ${HOME} -eu 'quoted text'
+	"$1" /usr/bin 'quoted text' echo "$1" then | echo
+	done readonly done local export cd | "$1" test test sed local "$1" printf
+		&& $(pwd) test | local --verbose "$1" then printf /usr/bin
+		&& 'quoted text' echo ${HOME} /usr/bin 'quoted text' 'quoted text'
+cd "$1" ${HOME} | export -eu /usr/bin
+	then test /usr/bin test grep "$@" ${HOME} awk -eu $(pwd) awk printf 2>/dev/null
+		"$1" awk test /usr/bin "$@"
+		"$@" export done awk cd echo 'quoted text' cd | /usr/bin echo grep "$1"
+	2>/dev/null | export local
+		readonly --verbose x=1 $(pwd) ${HOME} printf echo printf
+		readonly printf echo $(pwd) x=1 echo
+		export done /usr/bin echo 'quoted text'
+	&& printf test && then "$@" awk | --verbose cd --verbose
+		'quoted text' 2>/dev/null "$1" ${HOME} printf export sed
+	echo && x=1 'quoted text' printf
+-eu echo "$@" cd cd x=1 export sed ${HOME} -eu local local sed && "$@" readonly
+| x=1 grep done export -eu cd 'quoted text' --verbose | sed sed local |
+	'quoted text' x=1 /usr/bin "$@" --verbose cd sed echo 2>/dev/null
+	grep sed grep export awk 'quoted text' sed awk cd test sed && $(pwd) 'quoted text'
+		cd -eu --verbose test "$1" "$@" done | --verbose /usr/bin
+done /usr/bin -eu -eu awk export printf
+	readonly readonly export printf | test | ${HOME} local /usr/bin export -eu then
+export local /usr/bin printf awk -eu then done printf $(pwd) echo
+		cd export local 'quoted text' 2>/dev/null && awk 2>/dev/null
+test 'quoted text' $(pwd)
+--verbose sed then awk -eu printf then "$@" --verbose export "$@"
+	sed x=1 /usr/bin cd test "$@" local done export 2>/dev/null "$1" $(pwd)
+${HOME} cd /usr/bin echo 2>/dev/null 2>/dev/null export "$@" x=1 'quoted text'
+		'quoted text' local ${HOME} "$@" $(pwd) local echo "$@"
+	${HOME} printf /usr/bin printf "$1"
+	export export | && "$@"
+x=1 then 2>/dev/null "$1" x=1 -eu local && $(pwd) "$@" printf "$1" 'quoted text'
+	cd --verbose awk echo sed then x=1 then
+	/usr/bin test local done $(pwd) "$@" local 2>/dev/null x=1 readonly
+2>/dev/null $(pwd) export readonly
+		&& awk awk done | cd -eu 2>/dev/null 2>/dev/null local -eu $(pwd)
+	/usr/bin done --verbose grep $(pwd) $(pwd) export "$@" $(pwd)
+		--verbose "$@" grep "$@" | readonly 2>/dev/null test "$@" x=1 cd $(pwd)
+sed echo echo && ${HOME} test -eu 2>/dev/null readonly
+sed then && | echo | echo -eu sed | "$1" test test x=1 echo "$@" $(pwd) --verbose
+		test 2>/dev/null 'quoted text' grep |
+	cd /usr/bin done 'quoted text' then sed && then local 'quoted text' local &&
+		cd $(pwd) ${HOME} "$1" | "$@" printf $(pwd) cd -eu "$1" && | "$@" && -eu x=1
+	export $(pwd) | done | then
+	readonly done done $(pwd) grep
+x=1 local "$@" "$@" awk /usr/bin echo $(pwd) $(pwd) awk | then 'quoted text'
+		then cd x=1 | done 'quoted text' 2>/dev/null -eu cd x=1 then &&
+	$(pwd) /usr/bin echo test
+		awk | 2>/dev/null 2>/dev/null ${HOME} -eu cd then awk 'quoted text'
+test cd ${HOME} --verbose && 2>/dev/null
+	&& cd -eu readonly local 2>/dev/null "$@" /usr/bin 'quoted text' ${HOME}
+		then cd grep printf done echo export grep
+2>/dev/null | grep readonly readonly | -eu
+		printf -eu /usr/bin grep local
+	${HOME} then $(pwd) grep --verbose test test readonly x=1
+--verbose ${HOME} "$1" sed echo sed | readonly --verbose --verbose
+		--verbose sed && printf awk --verbose done grep sed echo | sed
+grep 'quoted text' printf done cd -eu grep awk 'quoted text' then awk done |
+		2>/dev/null -eu -eu | x=1 "$1" then cd then /usr/bin x=1 export
+	"$1" cd 'quoted text' x=1 $(pwd) test | "$1" then readonly $(pwd) | 2>/dev/null
+		local cd "$@" awk 'quoted text'
+2>/dev/null x=1 "$1" ${HOME} printf export && && /usr/bin cd "$@"
+		cd then awk 'quoted text' 2>/dev/null "$@" 2>/dev/null
+echo printf /usr/bin export ${HOME} cd /usr/bin /usr/bin x=1 sed
+	2>/dev/null "$@" sed $(pwd) 2>/dev/null "$1" /usr/bin
+	grep ${HOME} x=1 sed "$@" cd -eu 'quoted text' $(pwd)
+local export "$1" echo printf done readonly
+	sed /usr/bin "$@" && done ${HOME} local then cd | cd then -eu local
+'quoted text' test "$1"
+		done -eu local 'quoted text' printf then echo readonly 'quoted text'
+/usr/bin && cd awk 'quoted text' x=1 echo 2>/dev/null done export x=1 "$1" sed
+	done -eu then sed printf -eu awk cd /usr/bin "$@" test export "$1" --verbose
+sed --verbose echo "$@" export "$@" echo sed then && local -eu test ${HOME}
+		'quoted text' | "$@" "$1" done printf 'quoted text' | 'quoted text'
+	"$1" | 2>/dev/null awk done readonly "$@" | cd sed export ${HOME}
+		&& printf awk | "$1" | awk /usr/bin test cd grep done cd /usr/bin "$@" echo
+printf | | --verbose awk readonly readonly
+		done grep 'quoted text' local awk && echo x=1 sed
+		sed readonly local && grep 'quoted text'
+	then done then awk x=1 --verbose then awk --verbose echo readonly then awk then
+	done && sed --verbose 2>/dev/null
+	${HOME} x=1 local done | 2>/dev/null 2>/dev/null |
+		$(pwd) test "$1" grep "$1" "$@" cd && ${HOME} --verbose
+test | 2>/dev/null done --verbose
+grep export 2>/dev/null readonly local 'quoted text' readonly $(pwd) echo grep
+		awk local 'quoted text' readonly printf /usr/bin awk "$1" local --verbose printf
+grep test local readonly --verbose
+	test x=1 export export done $(pwd) echo local then test /usr/bin grep readonly
+export | export ${HOME} --verbose
+	"$@" -eu /usr/bin readonly
+	readonly $(pwd) /usr/bin awk /usr/bin
+awk --verbose -eu | export printf
+| ${HOME} --verbose "$1" x=1 cd "$1" | "$@" then
+		2>/dev/null test && 'quoted text'
+	2>/dev/null ${HOME} awk x=1 "$1" 2>/dev/null
+export -eu grep /usr/bin echo "$1" $(pwd) readonly -eu | readonly grep
+	done done | | $(pwd) 'quoted text' cd $(pwd) $(pwd)
+done -eu --verbose /usr/bin cd readonly
+		printf export x=1 x=1 && grep && 2>/dev/null 'quoted text' x=1
+	'quoted text' x=1 'quoted text' 'quoted text'
+	--verbose | test then ${HOME}
+	/usr/bin --verbose readonly echo readonly 2>/dev/null readonly "$@" then printf
+	cd "$@" sed $(pwd) echo -eu printf "$1" /usr/bin
+	'quoted text' -eu ${HOME} --verbose
+		'quoted text' test then test then
+		&& 2>/dev/null readonly readonly grep local $(pwd) sed sed grep
+	"$1" 2>/dev/null export "$1" printf done printf then ${HOME}
+		| "$@" 'quoted text' | echo "$1"
+		local readonly then export --verbose then
+	| "$1" x=1 export $(pwd) 2>/dev/null test local test grep
+	local 2>/dev/null && x=1
+		grep 'quoted text' ${HOME} 2>/dev/null
+		local cd sed 2>/dev/null
+		local "$1" x=1 sed cd grep then
+	/usr/bin "$@" ${HOME} printf $(pwd) test then awk done awk "$@" 2>/dev/null
+		then local sed "$1" export done $(pwd) echo export local --verbose /usr/bin
+		done local $(pwd) --verbose "$1" "$@" 2>/dev/null export readonly "$@" && "$1"
+--verbose awk "$1" $(pwd)
+	awk /usr/bin "$1" local
+	2>/dev/null --verbose 2>/dev/null then | --verbose
+	done ${HOME} grep cd echo -eu | ${HOME} ${HOME} awk --verbose
+${HOME} && echo echo awk grep x=1 --verbose
+	${HOME} printf local && -eu done | -eu
+sed local readonly local echo readonly
+		awk 'quoted text' cd "$1" && 'quoted text'
+	-eu $(pwd) grep printf |
+done --verbose -eu printf
+	/usr/bin cd then cd -eu test
+	echo x=1 test | test x=1 export
+"$@" cd local done awk $(pwd) readonly readonly 'quoted text'
+	${HOME} 2>/dev/null test readonly test
+	awk 'quoted text' echo cd cd sed readonly $(pwd)
+done test 'quoted text' "$1" then export && && export sed echo test cd readonly
+		/usr/bin && $(pwd) | printf -eu done sed
+$(pwd) test x=1 "$@" 2>/dev/null -eu -eu
+echo cd then export test printf echo printf done printf
+	grep printf "$1" -eu echo -eu test ${HOME} x=1 $(pwd) x=1 then printf then grep
+		2>/dev/null 'quoted text' printf printf --verbose "$@" printf test --verbose
+printf test sed echo ${HOME} test | test ${HOME}
+		cd then ${HOME} printf --verbose "$@" sed x=1
+		/usr/bin $(pwd) "$1" 'quoted text' 2>/dev/null
+$(pwd) $(pwd) && readonly -eu export "$@" 2>/dev/null test | --verbose
+	2>/dev/null /usr/bin done local /usr/bin export done test
+--verbose sed test && "$1"
+		-eu ${HOME} sed awk 'quoted text' printf | grep -eu awk "$@"
+		printf printf sed sed 2>/dev/null && x=1 then then && echo -eu cd --verbose readonly
+	local 'quoted text' x=1 "$@" printf "$@" grep then 2>/dev/null export "$1"
+		sed cd echo printf /usr/bin && sed | cd cd grep readonly --verbose
+test ${HOME} "$@" 2>/dev/null --verbose readonly done $(pwd)
+		cd "$@" && test sed "$1" 'quoted text' 2>/dev/null
+2>/dev/null | export x=1 local
+sed 'quoted text' export /usr/bin x=1 | && echo "$@" cd export echo awk
+		-eu x=1 local && printf x=1 grep cd /usr/bin export
+	"$1" readonly 'quoted text' test "$@" local /usr/bin grep done grep printf
+"$@" awk --verbose "$1" | awk cd cd then
+x=1 $(pwd) "$@" awk ${HOME} -eu ${HOME} /usr/bin
+	${HOME} --verbose echo cd printf
+	'quoted text' test sed local test "$@" $(pwd) test awk sed
+		$(pwd) $(pwd) awk -eu cd --verbose ${HOME} local sed
+printf $(pwd) grep then grep
+echo $(pwd) printf sed grep sed "$1" readonly x=1 grep cd echo export printf
+	done cd cd x=1 $(pwd) "$@" test then 2>/dev/null
+	2>/dev/null 'quoted text' "$@" | /usr/bin
+		readonly echo "$1" readonly
+		echo "$@" cd export test x=1 | 'quoted text' --verbose
+		$(pwd) then test grep /usr/bin done test x=1 sed
+	"$1" "$1" cd /usr/bin | -eu --verbose
+	$(pwd) /usr/bin -eu local --verbose then --verbose /usr/bin "$@" 'quoted text'
+	local done "$@" 2>/dev/null
+x=1 echo sed done grep --verbose awk local
+		export printf then echo && &&
+	then awk test sed export then | | x=1 then awk then 'quoted text' "$1" $(pwd)
+printf sed printf "$@" done && | $(pwd) "$@" sed && awk "$1" printf
+		local awk && ${HOME} x=1 sed
+	test cd -eu echo grep
+	"$@" cd sed export readonly then export $(pwd)
+awk echo readonly x=1 then printf printf ${HOME}
+	| done $(pwd) 2>/dev/null 2>/dev/null ${HOME} cd then $(pwd) readonly cd
+echo sed grep 'quoted text'
+		'quoted text' /usr/bin && 2>/dev/null
+	test local "$@" readonly export | --verbose ${HOME} test $(pwd) ${HOME} |
+then 2>/dev/null export cd cd printf && grep
+	--verbose sed printf && "$1" $(pwd) sed | "$1"
+	sed "$1" && test 'quoted text' | && test sed -eu 'quoted text' test printf
+	sed export test then export printf "$@" printf then readonly
+"$1" ${HOME} readonly ${HOME} | cd --verbose local
+		then -eu /usr/bin awk done | 2>/dev/null --verbose sed ${HOME}
+		sed export readonly printf "$1" | -eu && 2>/dev/null $(pwd)
+		"$@" awk | test -eu export
+		sed printf --verbose && 'quoted text' done
+printf printf sed readonly x=1
+	'quoted text' -eu sed $(pwd) "$@" awk --verbose
+		cd cd readonly && awk 2>/dev/null 'quoted text'
+	${HOME} && "$@" 'quoted text' | cd printf && "$@" | ${HOME}
+local done x=1 -eu x=1 "$@" "$1" /usr/bin awk grep x=1 awk -eu printf
+done | $(pwd) "$@" readonly echo grep grep
+	${HOME} done | -eu $(pwd) grep echo ${HOME} printf "$@" done echo done x=1
+	local awk sed && 'quoted text' "$1" grep && grep -eu 'quoted text'
+		awk x=1 printf ${HOME} $(pwd) then readonly echo export grep echo && $(pwd)
+	-eu readonly $(pwd) | 2>/dev/null "$1" && export && readonly "$1" -eu |
+	-eu done cd /usr/bin grep && -eu printf awk 'quoted text' sed -eu $(pwd)
+cd $(pwd) grep readonly && grep
+		then echo 2>/dev/null readonly
+		/usr/bin readonly export local printf
+export readonly local ${HOME} | readonly $(pwd) x=1 echo done export
+	test awk echo test then "$1"
+		printf /usr/bin local awk ${HOME} "$@"
+printf | 2>/dev/null then
+awk sed cd "$@" 2>/dev/null grep test printf local done
+&& done $(pwd) then -eu x=1 echo | printf test sed test "$1" &&
+	export "$1" $(pwd) && ${HOME} "$1" 'quoted text' &&
+test local ${HOME} printf --verbose done $(pwd) --verbose "$@" done ${HOME} printf
+		test grep sed ${HOME} readonly --verbose
+		sed grep printf ${HOME} --verbose export /usr/bin ${HOME}
+		echo awk echo && export then 'quoted text'
+		cd 'quoted text' done "$1" done && sed
+	awk test export done | then sed 'quoted text' "$1"
+	&& test && printf printf ${HOME}
+		test cd awk export $(pwd) then 2>/dev/null
+		printf local echo 'quoted text' /usr/bin echo export sed --verbose | printf
+	"$@" "$1" readonly 2>/dev/null printf echo ${HOME}
+-eu && "$1" printf grep export 'quoted text'
+	$(pwd) printf echo $(pwd) printf $(pwd) x=1 "$1" test printf then
+then "$@" 2>/dev/null -eu 2>/dev/null done
+		printf then readonly readonly -eu done "$1" readonly ${HOME} -eu
+	x=1 && export echo grep "$1" 'quoted text'
+done /usr/bin then then 'quoted text'
+	readonly echo --verbose ${HOME} --verbose --verbose
+	$(pwd) printf grep cd done "$@" export 2>/dev/null 2>/dev/null then /usr/bin
+		done "$1" "$@" --verbose local then ${HOME} x=1 readonly -eu /usr/bin
+	grep x=1 ${HOME} awk ${HOME} awk sed sed local "$@" && echo echo
+	-eu test local export -eu
+		"$1" $(pwd) "$1" "$1" && sed awk ${HOME}
+	done export "$1" --verbose --verbose /usr/bin then x=1 ${HOME}
+		"$@" 'quoted text' | "$@" done test | grep $(pwd) "$1" | then | "$1"
+	$(pwd) export grep sed test -eu test done --verbose cd
+| /usr/bin ${HOME} -eu cd printf cd --verbose done $(pwd) readonly | "$1"
+echo 2>/dev/null x=1 readonly readonly 2>/dev/null
+--verbose printf echo x=1
+		x=1 export echo /usr/bin "$@" ${HOME} "$@"
+		x=1 -eu grep sed 'quoted text' sed test test /usr/bin /usr/bin
+	local readonly local /usr/bin readonly 2>/dev/null
+test readonly /usr/bin && $(pwd) --verbose local -eu cd 'quoted text'
+	"$1" 2>/dev/null ${HOME} /usr/bin awk --verbose ${HOME} $(pwd) $(pwd)
+	$(pwd) readonly done --verbose x=1 printf $(pwd) && --verbose "$1" then "$1"
+	then --verbose --verbose cd cd /usr/bin && awk 2>/dev/null "$1" -eu "$1" ${HOME}
+	awk awk "$1" sed done grep $(pwd) awk /usr/bin --verbose /usr/bin 'quoted text'
+	sed printf 'quoted text' readonly x=1 ${HOME} export
+		printf "$1" "$1" $(pwd) test 'quoted text' x=1 export cd
+	/usr/bin local export 'quoted text' awk
+	cd echo "$@" test --verbose
+	sed readonly export --verbose then printf grep awk then "$@" "$@"
+	test echo 'quoted text' printf sed -eu
+grep -eu $(pwd) awk 2>/dev/null readonly && ${HOME} && test local then cd printf
+		${HOME} "$@" test && && | done then -eu $(pwd) && &&
+2>/dev/null echo awk sed 'quoted text'
+		-eu echo | /usr/bin $(pwd) | grep
+		grep readonly echo then echo | "$1" $(pwd) echo --verbose $(pwd) cd &&
+"$1" | grep done cd ${HOME} "$@" "$@" grep grep cd 'quoted text' export
+		| $(pwd) printf printf ${HOME} --verbose then local
+		$(pwd) awk x=1 export
+	export export local cd printf && grep test
+		export | $(pwd) awk 'quoted text' grep --verbose export done
+		echo "$1" --verbose grep cd ${HOME} sed "$@" local then | --verbose | 'quoted text'
+	--verbose && sed && test done $(pwd)
+	'quoted text' $(pwd) sed awk awk ${HOME} export
+readonly /usr/bin $(pwd) "$@" -eu echo sed printf
+	cd awk awk | && done awk ${HOME} x=1 awk ${HOME} $(pwd) then /usr/bin
+sed awk --verbose ${HOME} grep local $(pwd) local readonly "$1" 'quoted text'
+&& local "$@" "$@" echo cd local grep test && --verbose echo
+	echo echo printf grep -eu done $(pwd) sed 2>/dev/null local
+		printf readonly echo ${HOME} then test
+local -eu && 'quoted text' ${HOME} echo
+	$(pwd) readonly -eu then "$1" /usr/bin "$@"
+	awk x=1 readonly grep cd && done && export cd 'quoted text' -eu 2>/dev/null
+	| "$@" test -eu test $(pwd) awk --verbose test
+printf /usr/bin 'quoted text' $(pwd) printf awk printf 'quoted text'
+	cd done printf printf awk sed done grep 'quoted text'
+		| --verbose ${HOME} | done | && 2>/dev/null | grep sed --verbose export
+| export 'quoted text' local awk x=1
+		-eu then awk printf then grep /usr/bin
+	export --verbose then printf 'quoted text' "$1" "$@" -eu test done "$@" echo
+readonly readonly grep /usr/bin x=1 --verbose test then /usr/bin "$@" 'quoted text'
+	-eu -eu --verbose "$@" --verbose sed 2>/dev/null &&
+echo awk ${HOME} sed sed export test done
+		done readonly -eu /usr/bin then local -eu /usr/bin export && $(pwd) | --verbose
+		"$@" "$1" $(pwd) 2>/dev/null test "$1" "$@" awk test cd
+		2>/dev/null test "$@" grep printf export export echo 2>/dev/null x=1 printf printf
+done 2>/dev/null readonly "$1" done "$@" "$@"
+		then "$1" "$1" 'quoted text' local
+	readonly | -eu && x=1 $(pwd) cd then then awk
+		'quoted text' 'quoted text' --verbose then printf ${HOME} then "$1"
+| export | export awk test 2>/dev/null
+		done /usr/bin --verbose x=1 $(pwd) 2>/dev/null
+	done /usr/bin $(pwd) "$1" done "$1" local && "$1"
+	/usr/bin grep grep ${HOME} "$@" readonly "$@" done --verbose
+	$(pwd) printf x=1 && done "$1" && test 'quoted text' grep --verbose export
+	grep done local --verbose x=1 cd --verbose echo test | ${HOME} export
+	&& && sed "$1" "$1" 'quoted text' 2>/dev/null x=1 then -eu cd /usr/bin
+	export 'quoted text' echo echo export done /usr/bin cd test
+	test sed ${HOME} && cd echo "$@" local 2>/dev/null
+then export grep /usr/bin $(pwd)
+	awk --verbose x=1 "$1" --verbose
+/usr/bin local "$1" cd -eu $(pwd) "$1" $(pwd)
+		"$@" grep test export 'quoted text' "$@"
+		'quoted text' -eu | && readonly ${HOME} cd && local echo
+	/usr/bin "$1" sed local grep "$@" awk | && cd $(pwd)
+	test /usr/bin | printf done ${HOME} readonly
+x=1 2>/dev/null printf
+	printf /usr/bin $(pwd) done /usr/bin echo $(pwd) done -eu done cd export "$@"
+	-eu 'quoted text' "$@" x=1 && done "$@"
+		sed /usr/bin --verbose
+		grep --verbose 2>/dev/null $(pwd) readonly sed export done
+${HOME} local readonly grep sed $(pwd) test readonly --verbose $(pwd) local printf
+	cd awk sed $(pwd) sed then cd export "$1" ${HOME} export done x=1 grep --verbose
+-eu echo | echo $(pwd) /usr/bin cd done echo
+	readonly --verbose cd | ${HOME} -eu | "$@" test $(pwd) -eu
+	export x=1 done then export test then && 'quoted text' 'quoted text'
+export ${HOME} --verbose
+done | --verbose -eu 2>/dev/null awk cd export
+"$1" printf local ${HOME} awk
+local 'quoted text' cd --verbose ${HOME} | "$@" grep local
+grep 2>/dev/null readonly readonly $(pwd) -eu $(pwd) | ${HOME}
+	"$1" sed && x=1 echo | done
+-eu | /usr/bin local readonly grep then
+	"$@" 'quoted text' export
+		printf sed x=1 && done "$1" grep
+sed sed printf awk export sed grep cd 2>/dev/null | readonly
+	-eu printf 'quoted text' $(pwd) test -eu 'quoted text' echo done
+		"$1" sed export /usr/bin --verbose printf then "$1" readonly /usr/bin
+		then "$@" 'quoted text' test 2>/dev/null -eu export "$@"
+		'quoted text' --verbose -eu x=1 'quoted text' grep export 'quoted text'
+${HOME} --verbose /usr/bin "$1" cd printf 2>/dev/null
+		then ${HOME} sed "$@" && printf export
+	printf | awk local awk done sed done 'quoted text' "$1"
+		done 'quoted text' $(pwd) awk printf "$@" cd ${HOME} then
+export && done ${HOME} sed awk printf 2>/dev/null local grep --verbose
+	"$1" readonly /usr/bin echo 'quoted text'
+	"$@" echo sed && 2>/dev/null
+readonly done "$1" "$1" cd
+		2>/dev/null x=1 readonly test x=1 /usr/bin then && done
+	awk export export "$1" awk | sed export grep
+		${HOME} "$@" test /usr/bin export "$@" | test printf local /usr/bin done export
+local done 'quoted text' x=1 local grep awk test test && export
+	--verbose readonly grep | cd export printf | done cd -eu /usr/bin
+echo printf "$@" ${HOME} $(pwd) /usr/bin readonly 'quoted text' export $(pwd)
+echo 2>/dev/null "$1" x=1 ${HOME} -eu /usr/bin sed ${HOME} printf
+"$@" ${HOME} && /usr/bin "$@" ${HOME} test "$1" x=1 2>/dev/null local
+printf local local printf "$1" local export cd grep awk awk local grep
+	"$@" --verbose readonly x=1 2>/dev/null -eu readonly done | grep test /usr/bin
+	$(pwd) "$@" -eu -eu local export cd ${HOME}
+grep x=1 /usr/bin --verbose grep
+done echo sed test "$1"
+${HOME} $(pwd) local test sed $(pwd) local "$@" --verbose ${HOME} "$@"
+	echo printf "$@" printf x=1 -eu 2>/dev/null echo ${HOME} readonly
+		--verbose 2>/dev/null 2>/dev/null "$@" echo --verbose --verbose
+&& "$@" $(pwd) --verbose done local cd test then cd
+	test -eu 'quoted text' x=1
+	${HOME} local sed echo
+done test grep grep "$1" grep grep test && && && --verbose
+done "$1" echo done /usr/bin | -eu echo 2>/dev/null
+	sed awk | -eu cd then printf $(pwd) x=1 then sed "$@" echo
+		--verbose printf done test --verbose "$1"
+		&& ${HOME} "$@" --verbose export
+	sed --verbose 'quoted text' then printf cd /usr/bin printf export 2>/dev/null
+		${HOME} export readonly
+local --verbose awk $(pwd) readonly then "$@" printf
+		test done 2>/dev/null -eu
+local readonly 2>/dev/null then readonly then
+export readonly export | done done cd
+export --verbose grep cd /usr/bin test sed cd done
+"$1" "$@" readonly sed && 'quoted text' && printf x=1 $(pwd)
+test grep readonly cd ${HOME} && && && $(pwd) $(pwd)
+		/usr/bin -eu awk ${HOME} done
+	sed "$1" echo then --verbose printf /usr/bin export --verbose local echo
+printf test awk done $(pwd) done readonly ${HOME} x=1 2>/dev/null sed --verbose
+	printf && test cd "$1" export "$1" awk 2>/dev/null
+then echo export x=1 done then test x=1 -eu
+		/usr/bin export "$@" x=1 'quoted text' awk export
+printf && printf "$1" then "$1"
+	then test && grep "$1" -eu grep echo printf
+		grep | echo printf echo |
+		${HOME} && --verbose then -eu | "$@"
+	"$@" cd | then /usr/bin | | /usr/bin
+		${HOME} grep grep x=1 "$@" grep awk test "$@" then grep "$@" "$1" test cd echo
+	export done $(pwd) | -eu 'quoted text' && x=1 grep --verbose x=1
+	-eu "$1" "$1" -eu test printf test then $(pwd) echo local test grep cd awk
+		readonly cd printf grep /usr/bin
+		awk 'quoted text' --verbose local
+local 'quoted text' then test awk then /usr/bin && $(pwd)
+		echo export grep "$@" 'quoted text'
+${HOME} test echo 'quoted text'
+echo awk -eu sed 'quoted text'
+		printf grep sed sed x=1 local /usr/bin then && --verbose
+	-eu then --verbose sed | "$@" "$1" --verbose $(pwd) export cd && -eu 'quoted text'
+		then ${HOME} $(pwd) /usr/bin 'quoted text' -eu --verbose
+		test then "$@" echo test then --verbose $(pwd) ${HOME} &&
+		--verbose test export && printf && done local | local done -eu 2>/dev/null "$1"
+		"$1" "$@" local && | awk grep --verbose x=1 $(pwd)
+readonly readonly 'quoted text' --verbose readonly --verbose "$1" readonly
+		/usr/bin "$1" test then -eu | readonly awk cd
+	done ${HOME} awk 2>/dev/null local | done export grep x=1 /usr/bin
+	&& /usr/bin --verbose sed then printf && sed /usr/bin test sed awk done
+	test --verbose test sed --verbose local grep
+	-eu sed /usr/bin ${HOME} grep &&
+	-eu sed local --verbose /usr/bin sed awk | readonly 'quoted text'
+	sed awk sed echo cd readonly export done export /usr/bin
+$(pwd) test grep echo 2>/dev/null 2>/dev/null
+	echo "$1" cd cd test /usr/bin cd -eu echo x=1 | | printf export grep cd && --verbose
+	-eu export echo -eu ${HOME} then 'quoted text'
+	then done echo "$1" -eu echo awk 'quoted text'
+x=1 2>/dev/null cd readonly | grep ${HOME} done grep printf awk done local
+		--verbose printf /usr/bin && ${HOME}
+	echo && awk readonly done readonly readonly -eu cd
+		export -eu echo grep awk ${HOME}
+export awk done grep | 2>/dev/null 2>/dev/null
+2>/dev/null 'quoted text' 2>/dev/null echo 2>/dev/null
+"$1" printf test grep then /usr/bin echo "$1" | cd local printf sed -eu 2>/dev/null
+echo readonly 'quoted text' readonly 'quoted text' "$1" done printf ${HOME}
+	sed x=1 --verbose 'quoted text' done echo grep
+		--verbose printf $(pwd) then sed awk ${HOME} && printf --verbose done awk grep
+	/usr/bin "$@" then && local local --verbose grep sed /usr/bin
+		| ${HOME} done x=1 export /usr/bin done test && test
+		x=1 'quoted text' export "$@" $(pwd)
+local export "$1" -eu "$1" | echo 2>/dev/null
+		"$1" 'quoted text' $(pwd) printf 2>/dev/null export 2>/dev/null
+		"$@" readonly --verbose cd "$@" printf
+		then test 'quoted text' 2>/dev/null
+		2>/dev/null grep ${HOME} --verbose grep
+		'quoted text' then "$1"
+	| 'quoted text' then $(pwd) done then 'quoted text' readonly
+	$(pwd) -eu grep -eu 2>/dev/null "$1" -eu &&
+-eu --verbose -eu /usr/bin then echo /usr/bin grep "$1" printf grep
+-eu $(pwd) then sed sed "$1" echo then readonly then then -eu readonly
+	awk | done grep echo export local 2>/dev/null 'quoted text'
+	2>/dev/null $(pwd) echo awk readonly 'quoted text' /usr/bin local echo 'quoted text'
+/usr/bin awk 'quoted text'
+test | cd echo && /usr/bin -eu && done printf
+grep then done $(pwd) local --verbose $(pwd) 'quoted text' "$1" "$@"
+		awk echo 'quoted text' && local --verbose 'quoted text'
+	x=1 ${HOME} -eu && ${HOME} $(pwd) 2>/dev/null -eu &&
+		done local sed sed local done export
+	${HOME} awk local x=1 -eu grep printf 'quoted text' sed && -eu readonly "$@"
+		done grep grep "$1" ${HOME} export /usr/bin echo
+	readonly 2>/dev/null --verbose
+	done x=1 /usr/bin | && $(pwd) 'quoted text' -eu local "$@" echo /usr/bin
+-eu "$1" x=1 printf sed grep sed then export done
+		${HOME} 'quoted text'
+-eu $(pwd) test cd | then
+	x=1 2>/dev/null | grep ${HOME} -eu x=1
+&& readonly awk local -eu export test export grep sed then echo
+	x=1 $(pwd) 'quoted text' --verbose && && --verbose done
+"$1" "$@" | sed echo readonly grep awk awk local sed && done sed done "$@" --verbose
+		"$1" -eu export "$@" "$@" /usr/bin "$@" awk | test local sed && printf done
+		&& "$1" 2>/dev/null -eu /usr/bin -eu 2>/dev/null
+		${HOME} grep ${HOME} /usr/bin | 'quoted text' $(pwd) "$1"
+done $(pwd) --verbose --verbose readonly
+| printf awk sed grep /usr/bin local "$1" &&
+		-eu export $(pwd) ${HOME} cd then export readonly --verbose 'quoted text'
+	local /usr/bin | done -eu && grep ${HOME} --verbose grep cd local echo export /usr/bin
+	then "$1" | /usr/bin echo test -eu awk ${HOME} | test
+	then 'quoted text' readonly ${HOME} "$1" --verbose "$1" awk grep
+		x=1 local done /usr/bin local test 'quoted text' 'quoted text' grep
+		echo 2>/dev/null "$@" "$@" readonly ${HOME} /usr/bin done test printf /usr/bin
+printf grep $(pwd) /usr/bin "$@" export readonly test then sed cd echo 2>/dev/null
+		$(pwd) readonly local cd $(pwd) export $(pwd) "$@" | | echo
+		then then grep export | 'quoted text' | echo sed x=1 sed readonly ${HOME} /usr/bin
+	done sed /usr/bin awk 'quoted text'
+printf x=1 $(pwd) $(pwd) awk grep -eu done export && "$1" sed printf 2>/dev/null
+		export $(pwd) 'quoted text' done
+| $(pwd) printf 'quoted text' 'quoted text' | echo
+	-eu grep -eu ${HOME} ${HOME} 'quoted text' printf sed echo 'quoted text' 2>/dev/null
+grep /usr/bin "$@" "$1" then
+	'quoted text' 2>/dev/null readonly $(pwd)
+x=1 local 2>/dev/null cd 'quoted text' grep 'quoted text'
+		x=1 ${HOME} then ${HOME} export grep printf && /usr/bin sed -eu --verbose --verbose
+${HOME} --verbose printf ${HOME} then export
+		--verbose done && $(pwd) -eu 2>/dev/null test /usr/bin
+-eu echo | done -eu $(pwd) echo grep readonly printf done
+		"$@" -eu printf printf | && "$@" 'quoted text' $(pwd) awk "$@"
+		"$@" local printf export awk done echo
+		&& /usr/bin "$@" done | 2>/dev/null --verbose "$@" cd echo
+		readonly "$1" done export local then
+		2>/dev/null done readonly "$1" grep 'quoted text'
+	${HOME} printf x=1 "$1" $(pwd) --verbose ${HOME} local cd sed awk awk
+/usr/bin x=1 $(pwd) awk test readonly awk "$1" ${HOME} done
+	/usr/bin $(pwd) | 'quoted text' /usr/bin local cd printf awk
+	test x=1 x=1 "$1" test then done
+		done 2>/dev/null "$1" /usr/bin 2>/dev/null 'quoted text'
+	&& 'quoted text' done --verbose -eu
+${HOME} | ${HOME} test $(pwd) -eu
+/usr/bin "$@" test --verbose
+		${HOME} echo --verbose -eu then cd grep
+	then done --verbose done printf
+	export --verbose export readonly && cd /usr/bin
+	then --verbose "$@" "$1" sed 'quoted text' && awk "$@" /usr/bin cd export
+	done | export local "$@" done local ${HOME} $(pwd) test local awk
+		cd printf 'quoted text' --verbose sed 'quoted text' /usr/bin sed then 'quoted text'
+		local 'quoted text' done x=1 local && ${HOME}
+$(pwd) /usr/bin && printf --verbose ${HOME} -eu | sed /usr/bin
+		then ${HOME} 2>/dev/null printf
+awk grep ${HOME} -eu export sed echo export local awk cd readonly
+		"$1" $(pwd) -eu sed local grep
+		&& 2>/dev/null "$@" --verbose -eu done "$@" echo
+	2>/dev/null printf local cd "$@" /usr/bin ${HOME} echo
+		done export echo 'quoted text' 'quoted text' 2>/dev/null then awk 2>/dev/null
+		-eu readonly grep $(pwd) done -eu awk -eu && "$@" -eu "$@" $(pwd)
+readonly sed 2>/dev/null printf /usr/bin local test grep export $(pwd)
+	2>/dev/null readonly local then
+	done $(pwd) local | 'quoted text' grep readonly readonly readonly local
+		grep sed export cd readonly done local test $(pwd) printf sed -eu then
+		2>/dev/null awk export sed
+		"$1" readonly done printf printf ${HOME}
+	2>/dev/null readonly "$1" awk done awk readonly
+then grep -eu awk local --verbose local "$1" | x=1 export "$@" -eu
+&& local -eu "$1" sed done local awk test readonly "$1" readonly $(pwd)
+printf done ${HOME} test awk /usr/bin printf test export 2>/dev/null
+		/usr/bin --verbose grep ${HOME} export
+echo then -eu then /usr/bin sed /usr/bin sed grep printf readonly
+	-eu local | export "$@" done done && /usr/bin test /usr/bin readonly local cd
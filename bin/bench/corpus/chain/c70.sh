@@ -0,0 +1,2001 @@
+		echo export sed | sed export grep test -eu grep
+grep awk "$@" local x=1 --verbose 2>/dev/null $(pwd) 'quoted text' /usr/bin
+	then awk $(pwd) done /usr/bin
+	"$1" "$@" "$@" grep "$1" done echo sed | awk sed then 'quoted text'
+'quoted text' && cd /usr/bin
+		grep printf cd export cd printf echo
+		test sed && echo && 'quoted text' -eu
+		readonly cd export /usr/bin && /usr/bin
+		awk grep $(pwd) done | readonly local printf grep cd printf "$@"
+		"$1" readonly | readonly ${HOME} 2>/dev/null then 'quoted text' readonly
+&& echo local ${HOME} local then "$@"
+local ${HOME} test && export && $(pwd) $(pwd) 'quoted text'
+sed sed /usr/bin 'quoted text' local | --verbose $(pwd) | $(pwd) "$@" echo
+		grep "$@" grep local "$1" grep grep --verbose grep then cd 2>/dev/null then
+		readonly && 2>/dev/null readonly ${HOME} cd sed echo
+grep sed "$1" done awk test echo $(pwd)
+	"$@" ${HOME} --verbose export grep readonly awk echo -eu local awk readonly
+	x=1 printf --verbose local $(pwd) cd "$1"
+cd then "$@" done && 2>/dev/null $(pwd) /usr/bin cd
+		local $(pwd) 'quoted text' 'quoted text' done printf readonly
+		&& test export cd /usr/bin cd local "$@" &&
+	readonly -eu /usr/bin test ${HOME} cd echo done
+		2>/dev/null --verbose 'quoted text'
+"$1" export | cd cd done grep x=1 done export
+		awk -eu ${HOME} ${HOME} && "$1" "$1" 'quoted text'
+	done 2>/dev/null done sed awk local
+test | test grep echo cd grep "$@" --verbose
+		"$1" readonly 'quoted text' $(pwd) --verbose /usr/bin local
+sed 'quoted text' awk done
+	local && readonly readonly echo 'quoted text' && 'quoted text'
+awk echo local "$@" $(pwd) readonly echo done test sed
+sed sed | -eu | grep printf then 'quoted text' | --verbose
+/usr/bin x=1 "$1" && echo sed printf
+		printf readonly then 'quoted text' done grep cd | local |
+export grep export then -eu "$@" 2>/dev/null awk
+local "$1" "$1" $(pwd) ${HOME} -eu echo
+	local test grep echo echo "$1" --verbose echo $(pwd) export ${HOME}
+	'quoted text' /usr/bin /usr/bin ${HOME} && printf 2>/dev/null
+&& | grep 'quoted text' export printf |
+	readonly x=1 readonly local
+-eu --verbose && x=1 echo
+		x=1 /usr/bin "$@" && 'quoted text' $(pwd) "$@"
+		done "$@" sed printf | export -eu "$@" printf then "$1" echo 'quoted text'
+readonly --verbose test ${HOME} "$@" && awk then awk local "$@"
+"$@" grep --verbose ${HOME} | echo | grep && then local
+&& awk x=1 "$1" 'quoted text' 'quoted text'
+	--verbose /usr/bin ${HOME} cd readonly awk 2>/dev/null "$1" && $(pwd)
+	then cd sed export && | cd printf "$1" $(pwd)
+awk ${HOME} local 'quoted text' cd $(pwd) export && | x=1 awk test && x=1 local
+	printf cd local awk awk done -eu /usr/bin &&
+	/usr/bin then && test -eu $(pwd) awk 'quoted text' sed test readonly 'quoted text'
+	--verbose 2>/dev/null --verbose && -eu local /usr/bin then --verbose
+		printf echo | grep readonly ${HOME} cd export readonly x=1
+		/usr/bin -eu sed echo test
+		grep ${HOME} && -eu --verbose /usr/bin test
+	-eu "$1" "$@" then ${HOME}
+	-eu awk "$@" printf -eu x=1 printf | ${HOME}
+x=1 2>/dev/null 2>/dev/null awk "$@" cd ${HOME} local
+		awk then export export sed ${HOME} 'quoted text' then 'quoted text'
+	x=1 /usr/bin | cd done awk -eu awk
+		&& local "$1" | printf /usr/bin /usr/bin
+x=1 --verbose /usr/bin ${HOME} --verbose echo printf | test then "$@" done
+	local | "$1" && sed printf x=1 && -eu awk 'quoted text' && /usr/bin /usr/bin
+$(pwd) /usr/bin awk printf "$1" awk done
+		test local sed grep | "$1" 2>/dev/null awk 2>/dev/null
+-eu grep export -eu done --verbose $(pwd) 'quoted text'
+grep --verbose "$1" local x=1 "$1" sed | -eu && readonly
+test --verbose grep ${HOME} x=1 cd echo && sed grep
+		printf $(pwd) local $(pwd) then echo printf -eu && echo awk --verbose
+		--verbose grep awk && export test ${HOME} $(pwd) "$@" &&
+sed "$@" grep /usr/bin $(pwd) awk "$1" readonly printf awk && && then x=1 2>/dev/null
+		echo grep test echo 2>/dev/null
+		"$@" -eu awk && "$@" x=1 grep done
+		'quoted text' 'quoted text' "$1" awk done awk
+	--verbose && done readonly then
+	export done | | grep local $(pwd) test printf test export 2>/dev/null
+	done $(pwd) printf "$1" -eu done | "$1" sed local then --verbose
+		"$1" then test -eu then awk awk "$@" export | local test $(pwd)
+		readonly echo ${HOME} readonly
+		-eu 2>/dev/null cd /usr/bin x=1 export "$1" 2>/dev/null &&
+test "$@" /usr/bin $(pwd) --verbose
+		test x=1 local local test --verbose
+	'quoted text' "$1" && ${HOME} done export
+local cd done done --verbose --verbose cd && printf export grep |
+	/usr/bin awk echo echo "$@" printf
+	awk grep printf x=1 then readonly $(pwd)
+"$1" awk cd $(pwd) 'quoted text' 2>/dev/null
+| 2>/dev/null readonly awk && -eu
+/usr/bin -eu /usr/bin "$1" $(pwd) /usr/bin test 2>/dev/null
+	$(pwd) sed ${HOME} readonly /usr/bin
+		echo "$1" x=1 /usr/bin printf -eu x=1 readonly | | | -eu && grep --verbose
+	grep readonly && 'quoted text' $(pwd) ${HOME} --verbose x=1 printf x=1
+		'quoted text' ${HOME}
+	$(pwd) $(pwd) readonly test -eu "$@" cd x=1 x=1 cd -eu awk printf
+local readonly | ${HOME} /usr/bin test
+	${HOME} $(pwd) export export done -eu | 'quoted text' 2>/dev/null
+		&& sed 2>/dev/null 2>/dev/null
+"$@" | ${HOME} 'quoted text' -eu done export test 'quoted text' ${HOME} "$@" "$@"
+	| $(pwd) echo sed "$1" printf ${HOME} 2>/dev/null $(pwd)
+grep ${HOME} awk done | 'quoted text' /usr/bin
+	x=1 local test "$1" 2>/dev/null echo "$@" readonly printf
+"$@" printf cd x=1 | test test /usr/bin echo 2>/dev/null test test
+	'quoted text' "$1" 'quoted text' -eu "$1" -eu echo test then
+x=1 && sed test && -eu readonly ${HOME} export "$1" "$1" done
+		${HOME} awk --verbose -eu
+	"$@" done && printf printf "$1" sed | cd -eu 2>/dev/null "$1" "$1" $(pwd) 'quoted text'
+| | | && x=1 && awk -eu "$1" sed sed /usr/bin "$1" "$@" 'quoted text'
+	sed /usr/bin done /usr/bin 2>/dev/null ${HOME} 'quoted text' -eu
+		$(pwd) $(pwd) "$1" --verbose /usr/bin printf done 2>/dev/null ${HOME}
+	'quoted text' 'quoted text'
+		grep 'quoted text' done 'quoted text'
+	test -eu 2>/dev/null export sed export x=1 local export export local
+printf | local printf /usr/bin
+		export local /usr/bin &&
+		readonly ${HOME} $(pwd) local then "$1" 'quoted text' echo echo 2>/dev/null
+		grep done -eu && local && readonly x=1 grep readonly 2>/dev/null -eu /usr/bin
+--verbose test awk ${HOME} cd ${HOME} -eu "$1" /usr/bin local
+${HOME} $(pwd) 2>/dev/null --verbose export sed cd grep $(pwd) readonly
+	cd sed printf echo && x=1 "$@" grep -eu export
+local test echo ${HOME} && readonly
+export export awk export local export x=1 printf "$@" ${HOME} test
+/usr/bin local local local
+		done x=1 | | readonly | $(pwd)
+done done 2>/dev/null /usr/bin then --verbose -eu done test -eu "$1" "$1" | 'quoted text'
+	then local test | -eu x=1
+		"$1" done ${HOME} x=1 && local grep sed /usr/bin && /usr/bin | "$1" awk
+	awk -eu printf "$@" /usr/bin awk -eu readonly ${HOME} x=1
+	grep test "$1" 2>/dev/null --verbose printf "$1" echo grep -eu grep grep
+	cd printf "$1" awk then done ${HOME} printf printf && /usr/bin echo
+	x=1 awk ${HOME} grep 'quoted text' then test | 2>/dev/null
+"$1" readonly "$@" 2>/dev/null
+printf awk then x=1 "$1" $(pwd) --verbose grep ${HOME}
+		x=1 cd cd sed && awk echo | cd --verbose awk echo "$@" grep printf
+	then done $(pwd) sed &&
+		printf "$@" done local export
+$(pwd) sed 'quoted text' test ${HOME}
+		awk echo -eu | readonly "$1"
+		'quoted text' "$1" printf test /usr/bin | export
+	awk done done readonly ${HOME} awk
+export $(pwd) sed --verbose "$1" $(pwd)
+"$1" "$@" then /usr/bin && "$1" done "$1" $(pwd) sed
+	local readonly sed "$@" --verbose
+"$@" /usr/bin local "$@" "$@" ${HOME} /usr/bin 'quoted text' "$1"
+	awk cd ${HOME} x=1 test echo ${HOME} then awk awk x=1 local
+	sed then 2>/dev/null x=1 local sed ${HOME} -eu && awk sed $(pwd)
+		&& grep cd x=1 then readonly "$1" done -eu -eu
+	'quoted text' done -eu sed ${HOME} awk printf then --verbose /usr/bin -eu
+&& readonly cd local echo grep cd "$1" awk cd echo --verbose printf export
+		"$1" | cd readonly export then 2>/dev/null done -eu grep /usr/bin 'quoted text'
+		x=1 then --verbose "$1" "$1" $(pwd) /usr/bin
+		"$@" ${HOME} -eu "$1" && "$1" echo 'quoted text'
+cd && cd --verbose sed readonly
+2>/dev/null | /usr/bin -eu
+	"$@" export 2>/dev/null x=1 'quoted text' awk 'quoted text'
+then 2>/dev/null cd test
+	printf ${HOME} "$1" grep && "$1" done 'quoted text' ${HOME}
+grep x=1 test 2>/dev/null readonly echo printf "$@" | x=1 cd 2>/dev/null && 'quoted text'
+		cd cd then ${HOME} ${HOME} | printf test local cd printf printf
+| test test | "$@" -eu export | && grep done
+		export awk && 'quoted text' then echo cd --verbose cd
+		2>/dev/null --verbose then awk test printf test
+	test && $(pwd) "$@" "$1" 2>/dev/null sed
+	"$@" grep readonly 2>/dev/null 2>/dev/null | done "$@" grep readonly grep export
+readonly --verbose 2>/dev/null
+		/usr/bin --verbose --verbose -eu awk then printf 2>/dev/null
+| | $(pwd) printf sed 2>/dev/null | $(pwd) echo ${HOME} "$1" cd readonly && ${HOME}
+		then && /usr/bin awk local
+	"$1" cd 'quoted text' cd printf $(pwd) printf
+	echo ${HOME} $(pwd) "$@" awk local
+	${HOME} --verbose sed sed export -eu printf && test "$@" ${HOME}
+		echo "$1" test cd "$@" 'quoted text' x=1 export test --verbose sed x=1
+		then grep local --verbose "$@" readonly
+done done local awk local export -eu readonly && x=1 local ${HOME} "$1" printf
+echo export then /usr/bin export echo 2>/dev/null done readonly
+	done sed done export --verbose | --verbose
+	local $(pwd) grep x=1
+	cd local sed x=1 sed --verbose 'quoted text' 'quoted text' x=1 -eu | echo printf
+		"$@" echo printf done "$1" sed sed echo cd 'quoted text'
+		awk export cd && 'quoted text' 'quoted text' echo
+x=1 -eu test -eu -eu | $(pwd) then done test readonly awk /usr/bin -eu
+	cd test -eu test echo 2>/dev/null
+	awk cd export 2>/dev/null test cd "$@" "$1" readonly
+	awk --verbose "$@" -eu sed x=1 local -eu -eu "$1" awk readonly ${HOME} cd
+	| grep --verbose x=1 then echo 'quoted text' done test /usr/bin test 'quoted text'
+	$(pwd) test -eu 'quoted text' 2>/dev/null echo | "$@" awk | ${HOME}
+	test /usr/bin "$1" then && grep /usr/bin /usr/bin then
+--verbose "$1" ${HOME} awk --verbose local "$1" grep | readonly x=1
+--verbose --verbose echo
+		| x=1 sed x=1 local 'quoted text' x=1 done grep | local export "$1" awk x=1 "$@"
+	grep printf 'quoted text' ${HOME} echo
+		-eu "$@" readonly ${HOME} 'quoted text' done | printf
+		cd --verbose readonly -eu then sed cd export done printf awk ${HOME} done
+	-eu -eu grep then local | grep local export -eu done grep echo
+grep export --verbose && /usr/bin cd sed | --verbose ${HOME} 2>/dev/null $(pwd)
+test 'quoted text' printf export
+		done grep cd readonly awk "$@" | 'quoted text' sed && "$@" printf
+sed test $(pwd) /usr/bin done $(pwd)
+	x=1 $(pwd) test "$1" x=1 local test "$@" local /usr/bin 'quoted text' ${HOME}
+awk 'quoted text' 2>/dev/null "$1" export cd
+x=1 export 'quoted text' "$1" | printf cd "$@" local $(pwd) readonly
+$(pwd) printf --verbose echo echo "$@"
+		/usr/bin readonly done x=1 "$@" ${HOME} done ${HOME} | "$1"
+"$1" "$1" test ${HOME} local $(pwd) sed readonly
+		sed test awk -eu | && 2>/dev/null /usr/bin 'quoted text'
+local sed local -eu then -eu x=1 grep done x=1
+	"$1" | "$@" then | /usr/bin
+		$(pwd) readonly $(pwd) $(pwd) /usr/bin -eu export
+	-eu "$@" export -eu 'quoted text' echo "$@" /usr/bin local
+		${HOME} awk readonly --verbose local x=1 readonly done $(pwd)
+$(pwd) awk "$1" export local $(pwd) 2>/dev/null grep 2>/dev/null
+		${HOME} awk ${HOME} ${HOME} -eu
+	2>/dev/null test awk -eu "$@" export done export cd --verbose
+		grep 2>/dev/null awk export echo
+then --verbose readonly /usr/bin then -eu ${HOME} test &&
+		cd | cd done grep local test -eu --verbose --verbose echo test | ${HOME} local
+	awk 2>/dev/null test awk local echo x=1 grep --verbose | test
+test x=1 ${HOME} /usr/bin sed done "$@" $(pwd) -eu printf | x=1 grep "$1"
+	&& --verbose "$@" && /usr/bin done test /usr/bin "$1"
+"$@" "$@" --verbose 'quoted text' ${HOME} done export -eu then
+		x=1 --verbose x=1 local 'quoted text' then export --verbose
+		echo awk echo x=1 local echo "$@" $(pwd) --verbose
+		printf /usr/bin then grep
+		"$@" done test /usr/bin sed test local
+	done echo awk echo "$1" sed sed 'quoted text'
+	grep 2>/dev/null x=1 "$1" /usr/bin && awk
+		'quoted text' awk x=1 ${HOME} 'quoted text'
+echo --verbose export 2>/dev/null && then "$@" grep ${HOME} "$1" test then
+	cd ${HOME} 'quoted text' 2>/dev/null
+		local "$@" ${HOME} --verbose
+		/usr/bin export cd /usr/bin awk echo && grep test local printf "$@"
+| ${HOME} then ${HOME} printf ${HOME}
+/usr/bin cd grep grep -eu ${HOME} cd
+	| -eu local 2>/dev/null /usr/bin
+	-eu local -eu --verbose --verbose 'quoted text'
+		local ${HOME} && "$1" echo 'quoted text' echo readonly printf -eu done -eu
+		printf echo x=1 --verbose echo
+		then echo done printf echo -eu local done grep printf
+"$@" | printf "$1" grep grep && "$@" local "$1"
+	echo sed readonly echo export && 'quoted text'
+	$(pwd) "$@" /usr/bin grep readonly x=1 readonly
+printf 2>/dev/null | /usr/bin
+		/usr/bin ${HOME} 2>/dev/null x=1 x=1 --verbose --verbose local 'quoted text' --verbose
+		grep "$@" grep readonly --verbose x=1 | then then && cd readonly -eu export awk
+	-eu --verbose then done test
+		&& awk x=1 ${HOME} cd 'quoted text' export cd | /usr/bin
+	&& readonly "$@" && x=1 && -eu sed grep export grep done /usr/bin
+		${HOME} awk local 2>/dev/null x=1 printf test printf
+	-eu 'quoted text' then sed awk "$1" echo local
+	echo x=1 test --verbose && awk --verbose "$1" | export "$1" awk x=1
+export sed x=1 cd printf done test then
+$(pwd) readonly then -eu "$@" "$1" sed "$@" 2>/dev/null $(pwd) awk ${HOME}
+export export ${HOME} done --verbose cd then | 'quoted text'
+export && "$@" printf | x=1 "$1" | x=1 ${HOME} 2>/dev/null 'quoted text' $(pwd)
+		test grep 2>/dev/null done local readonly ${HOME} echo
+		printf grep test 'quoted text'
+sed --verbose grep printf --verbose local cd $(pwd) awk --verbose
+	readonly readonly "$@"
+		then echo && test printf $(pwd) local printf 2>/dev/null 'quoted text'
+		${HOME} -eu 2>/dev/null export printf /usr/bin
+awk | local 'quoted text' cd --verbose "$1" local 2>/dev/null
+		&& "$1" && grep awk | ${HOME} -eu | test ${HOME} /usr/bin
+2>/dev/null export 'quoted text' grep 2>/dev/null
+	echo $(pwd) /usr/bin /usr/bin ${HOME} cd then $(pwd) $(pwd) --verbose
+		echo --verbose "$@" -eu ${HOME} 'quoted text' && $(pwd) /usr/bin
+	then readonly -eu echo sed "$1"
+| awk --verbose local $(pwd)
+	"$@" "$@" sed && --verbose printf grep grep test grep echo awk cd local
+	${HOME} readonly x=1 | readonly 'quoted text' printf $(pwd)
+sed grep x=1 $(pwd) export grep cd test --verbose
+		'quoted text' echo then local local /usr/bin sed printf $(pwd)
+		done /usr/bin test done readonly then awk x=1 | ${HOME} sed local echo
+		test readonly local 2>/dev/null cd printf | sed | "$1" grep --verbose &&
+	then $(pwd) then then "$1"
+		'quoted text' done export 'quoted text' && export done "$@" | /usr/bin
+grep grep then x=1 $(pwd) /usr/bin awk sed --verbose x=1 done | 2>/dev/null
+		x=1 then grep 2>/dev/null "$1" done 2>/dev/null
+		sed grep cd "$@" /usr/bin /usr/bin -eu "$1" "$@" x=1 readonly
+"$1" echo -eu export x=1 | /usr/bin echo 'quoted text'
+test "$1" -eu cd local x=1 && ${HOME}
+sed && --verbose echo && awk export 2>/dev/null /usr/bin
+	test export 'quoted text' export "$@" | test awk ${HOME} x=1 2>/dev/null
+	echo done -eu | ${HOME} done echo 2>/dev/null "$@" readonly
+then | readonly | awk x=1 x=1 "$1" grep export "$@" echo /usr/bin 'quoted text'
+/usr/bin grep 'quoted text' 'quoted text' && 2>/dev/null echo
+	"$@" --verbose then awk | $(pwd) done printf ${HOME} "$1" 2>/dev/null
+then echo x=1 "$1" sed done
+-eu done $(pwd) awk test
+		2>/dev/null cd /usr/bin readonly x=1 ${HOME}
+	grep x=1 awk x=1 "$@" ${HOME} test | 2>/dev/null | then cd 'quoted text'
+		sed export awk then $(pwd) sed ${HOME} cd local echo ${HOME} 2>/dev/null -eu
+	"$@" export awk awk test local ${HOME}
+/usr/bin $(pwd) 2>/dev/null "$1"
+		grep done sed readonly ${HOME} grep cd echo test
+	local -eu echo test "$1" "$@" awk printf done 'quoted text' readonly
+		2>/dev/null -eu export &&
+	done done --verbose 'quoted text' ${HOME} "$1" /usr/bin sed
+		export done test 'quoted text' 2>/dev/null
+		cd grep --verbose x=1 --verbose readonly local | done
+	cd echo x=1 sed test | $(pwd) /usr/bin ${HOME}
+		grep grep /usr/bin echo x=1 $(pwd) $(pwd) export readonly
+		awk --verbose awk && 2>/dev/null awk --verbose then "$1" $(pwd) x=1
+	x=1 /usr/bin local 'quoted text'
+		export test test sed test printf
+		x=1 "$1" ${HOME} awk ${HOME} local $(pwd) -eu /usr/bin printf
+	test echo $(pwd) awk awk readonly then ${HOME} x=1 awk
+done test then ${HOME} && | grep readonly --verbose
+"$1" 2>/dev/null readonly "$@"
+	${HOME} sed 'quoted text' readonly sed cd 'quoted text' cd printf
+${HOME} export printf test
+		| | readonly --verbose echo awk | export
+&& "$@" -eu /usr/bin x=1 "$@" /usr/bin x=1 export 'quoted text'
+local printf export readonly 2>/dev/null
+	-eu local --verbose printf
+		$(pwd) printf cd echo "$@" cd cd
+	"$@" --verbose test cd then grep awk x=1 2>/dev/null readonly --verbose
+		local /usr/bin ${HOME} x=1 'quoted text' 'quoted text'
+echo && export ${HOME} cd "$@" echo --verbose --verbose awk $(pwd) --verbose
+		"$@" -eu ${HOME} export sed "$1" export then echo test --verbose export $(pwd)
+		"$@" x=1 then printf
+	printf done cd "$1" echo sed "$1" $(pwd)
+		then export /usr/bin ${HOME} $(pwd) 2>/dev/null echo grep test test
+	${HOME} echo "$@" --verbose 'quoted text' then 'quoted text' sed readonly sed
+	awk sed echo /usr/bin echo ${HOME} /usr/bin -eu then local "$1"
+		2>/dev/null --verbose export 'quoted text' local 'quoted text' printf
+		2>/dev/null local x=1 test echo ${HOME}
+		2>/dev/null /usr/bin | readonly grep readonly
+		then 2>/dev/null grep x=1 test test /usr/bin && "$1"
+	cd 'quoted text' $(pwd) done 'quoted text' -eu readonly /usr/bin export --verbose
+test then 'quoted text' && x=1 export
+		"$1" awk 2>/dev/null | 2>/dev/null
+done /usr/bin 2>/dev/null sed readonly 'quoted text' export $(pwd) sed readonly
+	2>/dev/null local --verbose x=1 export "$1" local
+export test test cd "$1"
+	sed 2>/dev/null $(pwd) $(pwd) /usr/bin local cd echo done x=1
+	grep && readonly local "$@" done "$1" readonly --verbose
+	"$1" ${HOME} 2>/dev/null then /usr/bin | awk printf --verbose
+		sed ${HOME} $(pwd) printf x=1 readonly local ${HOME}
+		local x=1 grep "$1" /usr/bin x=1 cd readonly "$@" /usr/bin
+	local export grep /usr/bin grep
+2>/dev/null $(pwd) grep grep $(pwd) grep && ${HOME} |
+local -eu echo printf cd "$@" 2>/dev/null echo "$@" "$@" local
+		| -eu | echo cd readonly | cd sed test printf "$1" printf | --verbose 2>/dev/null
+test echo local ${HOME} 2>/dev/null
+'quoted text' "$@" ${HOME} "$1" grep awk
+	'quoted text' ${HOME} awk readonly --verbose
+	2>/dev/null ${HOME} grep -eu 'quoted text' x=1 sed -eu
+	echo && --verbose "$1" export echo -eu echo export local ${HOME} | cd
+"$1" readonly -eu --verbose -eu test
+		-eu then sed printf export then x=1 local "$1"
+-eu -eu -eu && /usr/bin /usr/bin
+		then ${HOME} "$@" --verbose -eu done echo 2>/dev/null "$1" $(pwd) x=1 local export
+	test ${HOME} printf | echo "$@" test "$@" | export --verbose sed grep && -eu -eu
+	test sed "$1" && done "$@" local -eu && ${HOME}
+	echo readonly then $(pwd) --verbose sed
+x=1 readonly x=1 grep /usr/bin export then -eu --verbose $(pwd) test grep 2>/dev/null
+	"$1" cd export x=1 -eu export -eu && echo | ${HOME} sed printf echo test --verbose
+| x=1 grep readonly grep echo --verbose done
+--verbose --verbose done done $(pwd) done awk export echo done then
+	'quoted text' "$1" -eu printf 'quoted text' awk readonly cd export
+		$(pwd) /usr/bin printf 2>/dev/null sed test && grep done export
+		${HOME} readonly echo then test export then readonly -eu test
+		cd test local 'quoted text'
+		done readonly 2>/dev/null 2>/dev/null ${HOME} printf 2>/dev/null | then && "$1"
+		test $(pwd) grep export -eu printf
+test -eu x=1 x=1 printf local sed readonly then cd -eu grep then readonly local
+-eu -eu then local readonly 2>/dev/null
+x=1 ${HOME} --verbose awk grep | grep $(pwd) then
+		export awk 2>/dev/null $(pwd) ${HOME} test
+	&& "$1" -eu export --verbose cd $(pwd) sed ${HOME} 2>/dev/null
+test $(pwd) 2>/dev/null readonly
+	'quoted text' grep export printf readonly echo sed test && test echo grep
+	grep -eu x=1 --verbose
+		sed grep awk -eu /usr/bin
+grep -eu "$@" grep printf echo
+		$(pwd) /usr/bin /usr/bin awk "$1" --verbose
+| -eu | awk grep cd 2>/dev/null awk export
+		readonly ${HOME} --verbose cd sed awk
+	| 'quoted text' && x=1 grep then
+	-eu && ${HOME} sed 'quoted text'
+	x=1 done echo 'quoted text' | -eu
+	awk $(pwd) --verbose x=1 then 'quoted text' echo
+	local "$1" export "$@" cd | readonly echo x=1 readonly -eu "$1" --verbose awk
+	readonly sed then then 'quoted text' local
+		--verbose /usr/bin cd "$1" | 2>/dev/null ${HOME} awk awk 'quoted text'
+	awk export sed printf 2>/dev/null readonly
+		then printf && printf "$@" printf awk "$@" echo && $(pwd) /usr/bin echo awk ${HOME}
+	sed -eu /usr/bin --verbose | grep local
+/usr/bin $(pwd) | "$@" --verbose export
+	--verbose "$@" $(pwd)
+	printf export "$1" "$@" 'quoted text' "$@" then export done --verbose readonly
+	grep sed ${HOME} readonly printf echo "$1" "$@" x=1 echo
+export 'quoted text' "$1"
+/usr/bin echo echo sed awk 'quoted text' "$1" -eu | test -eu test
+		--verbose test cd done 2>/dev/null && cd x=1 test 'quoted text'
+"$@" readonly | then 'quoted text' awk cd sed export
+		/usr/bin local | 2>/dev/null test && printf -eu sed awk | echo printf sed
+		done export "$@" x=1 readonly --verbose sed test cd
+	done then echo awk "$1" 'quoted text'
+	test x=1 --verbose "$1" && awk "$1" && printf | 2>/dev/null
+	cd grep test local then 2>/dev/null -eu then 'quoted text' cd ${HOME} "$1"
+| export | test test local test then 2>/dev/null
+	sed printf test awk x=1 && 2>/dev/null "$1"
+grep echo $(pwd) "$@" x=1 | -eu /usr/bin local sed grep echo local then
+awk then ${HOME} 'quoted text' done | 'quoted text'
+sed grep export ${HOME} done
+-eu then printf 'quoted text' | local | sed echo sed ${HOME} export
+readonly -eu printf --verbose "$@" 2>/dev/null "$@" export ${HOME} --verbose
+	done echo 'quoted text' ${HOME} x=1 test
+	x=1 -eu then awk cd echo sed echo $(pwd) $(pwd) --verbose ${HOME}
+test /usr/bin /usr/bin x=1 && sed
+	local $(pwd) done 2>/dev/null echo 'quoted text' cd cd readonly test local sed
+	$(pwd) ${HOME} ${HOME} x=1 "$1" ${HOME} | |
+	done test | then -eu --verbose cd
+		2>/dev/null | printf local done
+cd printf sed readonly /usr/bin --verbose "$@" 2>/dev/null echo printf
+	2>/dev/null /usr/bin --verbose then "$@" ${HOME} && cd x=1 awk "$@" readonly
+awk "$@" ${HOME} "$@" 'quoted text' ${HOME} && done
+'quoted text' -eu done export printf "$1"
+echo && ${HOME} /usr/bin -eu x=1 && "$@" x=1
+	done && ${HOME} test "$1" printf ${HOME}
+		sed echo 'quoted text' x=1 export ${HOME} -eu echo
+		${HOME} 'quoted text' | then sed echo --verbose readonly grep "$1" /usr/bin
+		awk printf 2>/dev/null 'quoted text' echo printf local test x=1 export
+	awk && export 'quoted text' 'quoted text' x=1 -eu | cd $(pwd)
+--verbose done -eu "$1" "$1" cd done awk
+		then | done "$1" local --verbose readonly grep
+	cd /usr/bin test x=1 local
+readonly export cd "$1" awk echo 'quoted text'
+		/usr/bin grep x=1 printf 'quoted text'
+	readonly cd --verbose "$1" sed 2>/dev/null
+	done sed echo then 'quoted text' /usr/bin then echo grep "$@" local
+		printf "$@" done echo then x=1 readonly x=1 $(pwd)
+	--verbose && 2>/dev/null x=1 printf /usr/bin 2>/dev/null
+local "$1" printf done && 2>/dev/null --verbose /usr/bin /usr/bin
+awk awk $(pwd) ${HOME} grep "$@" test export 2>/dev/null $(pwd) printf
+		grep grep | then "$1" && printf then x=1 test
+| ${HOME} grep cd then echo done && export
+awk ${HOME} local grep && 2>/dev/null grep cd /usr/bin "$@" test grep && printf
+		&& | cd test grep export grep printf printf grep
+		sed /usr/bin -eu "$1" 'quoted text'
+${HOME} export x=1 then x=1 2>/dev/null
+	export && | printf awk awk echo printf /usr/bin grep printf test 'quoted text'
+	'quoted text' echo done | cd "$1" 'quoted text'
+$(pwd) 'quoted text' | 'quoted text' 2>/dev/null local cd "$@" grep && ${HOME}
+	sed local 'quoted text' awk "$1" test 'quoted text' 'quoted text'
+'quoted text' 'quoted text' 2>/dev/null readonly
+'quoted text' sed cd && $(pwd) cd done sed local done 'quoted text'
+	x=1 done awk -eu readonly readonly then "$@" -eu export | done ${HOME} ${HOME}
+test 'quoted text' 'quoted text'
+		then && 2>/dev/null /usr/bin x=1 cd /usr/bin "$@" test readonly | && "$1"
+local x=1 readonly ${HOME} ${HOME} echo printf sed $(pwd) --verbose 2>/dev/null
+		--verbose 'quoted text' cd echo then ${HOME} echo then test 'quoted text'
+	x=1 'quoted text' printf --verbose 'quoted text'
+	printf sed -eu sed local done echo cd && then --verbose
+	$(pwd) --verbose awk test x=1 $(pwd) x=1 -eu && "$@" printf 2>/dev/null
+	awk $(pwd) ${HOME} && echo export | export -eu local printf done awk grep 2>/dev/null
+	${HOME} echo | && local awk 2>/dev/null --verbose --verbose
+echo 'quoted text' sed ${HOME} -eu done x=1 grep /usr/bin readonly test readonly
+	export "$1" -eu "$@" then cd 2>/dev/null cd test grep --verbose then
+		grep printf /usr/bin
+	local -eu x=1 sed "$1" -eu 2>/dev/null local x=1
+		&& $(pwd) test /usr/bin test then printf awk
+		x=1 local $(pwd) 'quoted text' && "$@"
+	&& printf && awk x=1 x=1 "$@" ${HOME} && export grep | /usr/bin
+		readonly awk | 2>/dev/null --verbose 2>/dev/null done echo x=1
+	awk sed awk then cd cd export test readonly x=1 done awk x=1 awk -eu && grep
+printf -eu ${HOME} readonly
+readonly $(pwd) local readonly
+		done awk $(pwd) printf then --verbose cd $(pwd) ${HOME}
+	echo --verbose --verbose "$1" /usr/bin printf cd cd "$1" printf done /usr/bin
+	2>/dev/null "$1" echo awk
+done $(pwd) local $(pwd) && -eu sed
+then echo then && export 2>/dev/null grep $(pwd) printf
+2>/dev/null && sed --verbose -eu ${HOME}
+		awk | export -eu $(pwd) sed /usr/bin sed printf sed --verbose /usr/bin awk ${HOME}
+		sed "$1" "$1" sed /usr/bin ${HOME} printf
+	printf done /usr/bin -eu x=1 cd -eu readonly && 'quoted text'
+echo then | local $(pwd) ${HOME} export
+		--verbose sed | cd --verbose grep | && cd && "$1" grep test --verbose readonly
+		printf local test cd && done echo grep cd "$@" 'quoted text'
+	"$1" sed $(pwd) readonly ${HOME} grep export local echo $(pwd) readonly
+		export | 2>/dev/null ${HOME} $(pwd) "$1"
+	cd printf && test sed export /usr/bin --verbose /usr/bin "$1" 'quoted text'
+test --verbose test ${HOME} cd cd /usr/bin grep | then test
+	--verbose "$@" x=1 local | readonly --verbose && $(pwd) "$@" echo x=1 ${HOME}
+	-eu -eu --verbose awk then test && local export 2>/dev/null
+		&& -eu echo then printf grep
+	test done --verbose local test
+printf awk printf awk 2>/dev/null export "$1"
+grep grep printf $(pwd) local cd x=1 then sed readonly 2>/dev/null
+	-eu $(pwd) cd --verbose
+		done local ${HOME} cd -eu "$@" echo
+		export x=1 | sed echo echo readonly readonly then | cd && ${HOME} 'quoted text'
+done export x=1 | --verbose cd then sed readonly
+		test 'quoted text' 2>/dev/null
+	then cd ${HOME} 'quoted text' printf awk x=1 "$@" readonly
+		test 2>/dev/null test -eu test then sed local then
+		/usr/bin grep x=1 then printf
+	sed sed "$1" ${HOME} grep
+	local then 'quoted text' 'quoted text'
+		grep sed local /usr/bin $(pwd) "$1" test then
+"$@" ${HOME} x=1 | readonly echo "$1" $(pwd) then echo ${HOME} && x=1 awk
+'quoted text' -eu awk export awk sed | export --verbose ${HOME} && cd printf
+cd then "$1" /usr/bin ${HOME} && cd export ${HOME} grep done echo
+sed && export "$1" echo x=1
+		cd export x=1 ${HOME} -eu
+		grep sed x=1 --verbose then -eu "$1" --verbose 'quoted text' printf "$@" 'quoted text'
+test "$1" awk done 2>/dev/null
+		"$1" done /usr/bin echo echo printf "$@" 2>/dev/null | done --verbose
+"$1" sed 2>/dev/null $(pwd)
+		printf 'quoted text' printf 'quoted text' ${HOME} x=1 done "$1"
+	--verbose | then then "$1" export 'quoted text' /usr/bin
+		local ${HOME} echo then cd "$1" grep x=1 sed local cd then 2>/dev/null
+	awk "$@" | "$1" $(pwd) 'quoted text' printf cd
+	/usr/bin ${HOME} --verbose sed sed /usr/bin local printf | cd "$@" echo echo | /usr/bin
+		x=1 export $(pwd) done && then /usr/bin then test
+		/usr/bin grep grep $(pwd) local 2>/dev/null readonly $(pwd) -eu ${HOME}
+	| 'quoted text' done cd && local --verbose | then grep /usr/bin local 2>/dev/null
+echo printf -eu /usr/bin readonly
+	done then export ${HOME} export x=1
+	grep "$@" "$@" | --verbose local printf export x=1 --verbose 'quoted text'
+		printf awk cd cd awk readonly awk | 2>/dev/null "$1" done printf awk
+printf | then x=1 x=1 then 'quoted text'
+"$1" readonly sed | test 'quoted text' test sed "$1" 2>/dev/null /usr/bin
+		$(pwd) | | | grep /usr/bin
+${HOME} $(pwd) sed sed "$1"
+	awk awk x=1 x=1 -eu /usr/bin export grep /usr/bin "$1" 2>/dev/null printf
+	test --verbose $(pwd) 2>/dev/null test 'quoted text' 'quoted text'
+	sed readonly 2>/dev/null cd
+echo "$@" test ${HOME} printf
+then test 2>/dev/null ${HOME} cd x=1 | grep ${HOME} printf && printf local
+$(pwd) grep echo /usr/bin local "$@" then cd awk 'quoted text' --verbose "$1"
+then --verbose 2>/dev/null local awk grep sed
+x=1 sed local x=1 --verbose
+	cd --verbose --verbose local 2>/dev/null awk 2>/dev/null 2>/dev/null
+then && sed 'quoted text' readonly "$@" x=1 x=1 local $(pwd) grep local
+$(pwd) ${HOME} 'quoted text' cd then test awk "$1" printf
+		grep -eu -eu 2>/dev/null && && --verbose done then -eu $(pwd) $(pwd) test
+		"$@" && 2>/dev/null 2>/dev/null --verbose $(pwd)
+	/usr/bin sed /usr/bin "$1" sed awk grep x=1 then readonly /usr/bin x=1 |
+	done cd ${HOME} printf grep "$@" cd /usr/bin
+cd grep local printf /usr/bin "$@" readonly $(pwd) test
+-eu printf grep cd x=1 done "$1" echo -eu
+$(pwd) readonly 2>/dev/null 2>/dev/null grep test awk /usr/bin cd && x=1 readonly
+		/usr/bin x=1 2>/dev/null done -eu | 'quoted text' 2>/dev/null "$@"
+		/usr/bin 'quoted text' then | test test awk "$1" local 2>/dev/null sed
+test 2>/dev/null 'quoted text' $(pwd) $(pwd) "$@"
+		x=1 cd grep --verbose --verbose
+	test && "$1" done readonly export 'quoted text' then | printf ${HOME}
+	--verbose 2>/dev/null grep && --verbose awk 'quoted text'
+2>/dev/null test && 2>/dev/null $(pwd) -eu --verbose "$1"
+&& local x=1 sed echo x=1 grep done 2>/dev/null "$@"
+grep test then x=1 $(pwd) awk grep test -eu local | 'quoted text'
+		printf -eu && readonly /usr/bin --verbose && "$@" printf
+		then | printf -eu printf echo && /usr/bin 2>/dev/null 2>/dev/null done
+| done /usr/bin sed | cd cd "$1" "$1" readonly -eu test -eu
+		2>/dev/null "$1" -eu then 'quoted text'
+	"$1" && $(pwd) test test /usr/bin
+2>/dev/null /usr/bin sed $(pwd) readonly 2>/dev/null /usr/bin done awk x=1
+		sed export x=1 ${HOME} then awk /usr/bin test $(pwd) printf
+	readonly -eu readonly /usr/bin -eu
+		'quoted text' "$1" "$@" ${HOME} /usr/bin test ${HOME} echo x=1
+	echo cd && printf && /usr/bin $(pwd) ${HOME} done "$@" awk grep $(pwd)
+done "$@" echo grep 2>/dev/null sed sed 'quoted text' then sed sed
+		x=1 ${HOME} test then then grep export export
+printf $(pwd) echo x=1 -eu /usr/bin -eu ${HOME} 2>/dev/null done printf
+	&& cd test | && cd test
+	done | --verbose /usr/bin
+	2>/dev/null $(pwd) "$@" && $(pwd) 2>/dev/null
+	$(pwd) awk $(pwd) readonly /usr/bin local
+$(pwd) awk ${HOME} ${HOME} awk /usr/bin printf cd /usr/bin
+	export done test local 2>/dev/null printf sed sed printf "$1" local then cd
+		2>/dev/null /usr/bin ${HOME}
+		awk echo test cd "$1" /usr/bin --verbose ${HOME} cd "$1" readonly x=1 $(pwd) --verbose
+echo grep grep 2>/dev/null then export $(pwd) -eu
+	export 'quoted text' cd local printf export "$1" done grep then export
+	'quoted text' grep local printf
+-eu | printf | 'quoted text' test -eu "$1" "$@" --verbose test
+		/usr/bin test export test echo printf readonly x=1 grep x=1 awk export
+test grep then $(pwd) export cd x=1 local && local && "$@"
+		echo awk awk "$1" x=1 "$@" | && test ${HOME} grep sed local echo /usr/bin /usr/bin
+readonly local "$1" cd $(pwd) awk ${HOME} ${HOME} ${HOME} | cd $(pwd)
+local 'quoted text' ${HOME} -eu --verbose done awk cd ${HOME}
+	--verbose cd 'quoted text' "$@" 'quoted text' 'quoted text' -eu
+test /usr/bin x=1 "$@" then test
+x=1 readonly local /usr/bin echo local echo readonly
+		local done cd test 2>/dev/null then $(pwd)
+local printf printf sed -eu 2>/dev/null /usr/bin export done x=1 --verbose "$@"
+	export 'quoted text' echo | test local
+cd echo "$@" done $(pwd) echo printf
+	local && --verbose --verbose grep -eu local "$@" cd 2>/dev/null
+readonly /usr/bin 'quoted text' x=1 readonly printf
+	sed then $(pwd) $(pwd) awk local done $(pwd) cd --verbose
+'quoted text' /usr/bin --verbose ${HOME}
+"$1" x=1 | test && awk readonly local grep local 2>/dev/null test done $(pwd) "$@"
+cd test 'quoted text' grep && && local
+		"$1" && awk /usr/bin | | readonly && -eu | 2>/dev/null sed -eu
+	done ${HOME} grep && && grep readonly ${HOME}
+"$@" 'quoted text' echo | sed $(pwd) "$1" readonly export
+	${HOME} done "$1" --verbose then 'quoted text' readonly | x=1
+		readonly && printf readonly then 2>/dev/null ${HOME} done -eu 2>/dev/null
+		done | | cd test x=1 /usr/bin echo /usr/bin printf 2>/dev/null printf readonly
+		| 2>/dev/null grep 2>/dev/null sed test
+printf done cd local ${HOME} awk
+		${HOME} awk -eu 'quoted text' test 2>/dev/null
+	&& && echo "$1" -eu done
+		'quoted text' 2>/dev/null x=1 $(pwd) done sed ${HOME} | export | local echo
+		| sed -eu readonly "$1" test /usr/bin local
+2>/dev/null printf $(pwd) 2>/dev/null
+	then --verbose local "$@" readonly
+echo grep -eu $(pwd) echo 'quoted text' done sed -eu cd
+		awk "$@" "$1" local then echo
+export "$@" local echo --verbose
+		then --verbose $(pwd) export $(pwd) readonly
+		--verbose "$1" && sed test then /usr/bin "$@" "$1" cd
+		then local -eu then ${HOME} -eu && "$1" | x=1 done --verbose awk done
+-eu echo -eu $(pwd) done sed
+	$(pwd) local then | export
+cd test awk | test printf 'quoted text' /usr/bin
+printf awk awk --verbose sed sed then echo $(pwd)
+	--verbose 2>/dev/null test | $(pwd) readonly | ${HOME} x=1 sed
+		done 'quoted text' cd
+readonly grep $(pwd) && $(pwd) | 'quoted text'
+	'quoted text' "$@" -eu local done "$@" readonly cd
+--verbose then -eu "$1" readonly "$@" 'quoted text' local /usr/bin
+$(pwd) -eu | | cd 'quoted text' 2>/dev/null "$1" ${HOME} grep printf sed readonly
+		| echo "$1" $(pwd) x=1 "$1" echo "$@" && export then -eu x=1 --verbose -eu grep
+		x=1 /usr/bin "$@" --verbose
+	test "$@" 2>/dev/null done awk 2>/dev/null local sed 2>/dev/null
+	printf test 'quoted text' --verbose
+export ${HOME} | 2>/dev/null "$1" 2>/dev/null
+readonly grep 'quoted text' echo local 'quoted text'
+		then "$@" readonly cd cd awk -eu "$@" | done |
+	2>/dev/null sed && cd grep 2>/dev/null done "$1" then
+	readonly 'quoted text' $(pwd)
+		local ${HOME} "$@" grep printf && grep 2>/dev/null -eu awk awk
+	x=1 /usr/bin 2>/dev/null cd awk cd | | readonly | 'quoted text' readonly $(pwd)
+		done export test 'quoted text' sed -eu cd awk ${HOME} && |
+local --verbose then "$@" x=1 grep readonly done -eu | local readonly 2>/dev/null
+		--verbose --verbose x=1 'quoted text'
+		${HOME} echo | local "$1" grep "$@" "$@" grep /usr/bin
+		"$1" readonly echo "$@" done
+/usr/bin 2>/dev/null done export 2>/dev/null grep awk $(pwd)
+		done -eu x=1 'quoted text' local "$1" then | readonly
+		done x=1 grep export "$@" "$1" test 'quoted text' | done readonly
+readonly "$1" sed grep 'quoted text' export export 2>/dev/null grep "$1"
+"$@" -eu /usr/bin echo grep
+	test 2>/dev/null 'quoted text' --verbose /usr/bin
+		sed cd sed sed "$1" 'quoted text' readonly then sed export grep
+		echo export test sed 2>/dev/null printf x=1
+grep test grep --verbose then $(pwd) test 'quoted text'
+		&& readonly ${HOME} local 2>/dev/null /usr/bin
+	&& grep cd cd | $(pwd) x=1 awk 2>/dev/null sed | "$@" test $(pwd) "$1" x=1 then
+	local cd | echo grep | && "$@" | $(pwd)
+		sed "$1" readonly awk
+		"$1" cd ${HOME} ${HOME} --verbose -eu 2>/dev/null
+		echo done /usr/bin echo test
+	printf readonly "$1" printf "$@"
+echo 'quoted text' && --verbose
+2>/dev/null grep readonly awk "$@" awk grep $(pwd)
+		then test x=1 --verbose local printf && echo
+x=1 then done x=1 then x=1 export && readonly then -eu printf then 'quoted text'
+printf done -eu grep awk then done
+grep "$@" ${HOME} test export sed
+	cd grep x=1 "$@" -eu | export "$@" ${HOME} 2>/dev/null echo export export
+readonly sed -eu ${HOME} echo readonly 'quoted text' readonly x=1
+		then -eu && x=1 then 2>/dev/null ${HOME} x=1 sed --verbose
+	x=1 'quoted text' printf done local sed x=1
+	--verbose /usr/bin test export "$1" readonly 'quoted text' awk x=1
+/usr/bin "$@" awk "$1"
+		done && 2>/dev/null then | readonly $(pwd) cd ${HOME} test | 2>/dev/null
+done 'quoted text' 2>/dev/null readonly export done then printf && echo printf
+echo export -eu grep && test | && x=1 grep
+readonly test sed ${HOME} awk --verbose /usr/bin
+		awk test echo "$1" readonly printf
+$(pwd) readonly /usr/bin /usr/bin
+	grep 2>/dev/null done sed printf "$@" then then cd sed && /usr/bin
+		"$1" 'quoted text' ${HOME} /usr/bin cd
+	readonly /usr/bin /usr/bin 'quoted text' && | export local "$1"
+	"$@" x=1 2>/dev/null $(pwd) local export awk printf cd sed then 2>/dev/null
+${HOME} export 'quoted text' x=1 grep test
+	then readonly && grep grep --verbose && printf 2>/dev/null
+	"$1" then -eu x=1 cd ${HOME} ${HOME}
+	x=1 2>/dev/null 2>/dev/null ${HOME} then
+		"$1" readonly test echo /usr/bin
+		"$1" test $(pwd) -eu sed
+	/usr/bin "$1" "$@" grep "$@" done "$@" echo sed | -eu 2>/dev/null x=1 "$@"
+cd x=1 "$1" | -eu then
+$(pwd) | && done printf test readonly then && "$1" done
+	-eu printf 'quoted text' local && 'quoted text'
+	"$1" echo && -eu grep done 2>/dev/null
+	awk printf awk "$1" -eu
+	x=1 grep echo x=1 "$@" 2>/dev/null | /usr/bin ${HOME} 2>/dev/null
+| sed export sed local printf "$1" 2>/dev/null
+	cd grep $(pwd) printf --verbose -eu && | "$1" $(pwd)
+cd -eu printf "$@" then |
+		-eu grep done 2>/dev/null then cd printf then x=1 "$@" && --verbose x=1 -eu sed
+	"$@" "$@" echo 'quoted text' 'quoted text'
+		then sed cd --verbose export | | $(pwd) awk printf grep 2>/dev/null 'quoted text'
+	then 2>/dev/null cd cd 2>/dev/null
+		done | local then | cd grep | 2>/dev/null "$1" local echo --verbose grep printf
+echo x=1 --verbose then /usr/bin cd /usr/bin ${HOME} $(pwd)
+then ${HOME} awk -eu x=1 printf test done -eu && $(pwd)
+| 2>/dev/null printf ${HOME} 'quoted text'
+		--verbose x=1 ${HOME} x=1 "$1" done then 'quoted text'
+-eu x=1 local x=1 --verbose done test printf --verbose cd
+	"$1" done sed /usr/bin grep 'quoted text' /usr/bin
+readonly "$@" "$@" readonly
+${HOME} awk x=1 "$1" "$@" done cd x=1 awk 2>/dev/null -eu --verbose /usr/bin export
+		&& printf cd echo printf ${HOME} readonly
+echo $(pwd) grep -eu local test /usr/bin local sed awk
+		'quoted text' 2>/dev/null local cd echo $(pwd)
+		&& 'quoted text' done "$@" awk readonly "$@" --verbose cd done
+done local then "$@" sed /usr/bin
+$(pwd) x=1 && 2>/dev/null "$1" echo
+		echo done echo cd --verbose "$1" cd && sed then echo printf
+	test grep -eu ${HOME} cd $(pwd) cd 'quoted text' echo -eu done readonly grep then
+$(pwd) -eu ${HOME} sed local x=1 x=1
+	grep x=1 ${HOME} readonly printf done --verbose $(pwd)
+		test printf /usr/bin printf | | "$@" printf echo printf test $(pwd)
+		"$1" 'quoted text' 'quoted text' | then done 'quoted text'
+		printf cd local $(pwd)
+${HOME} "$1" awk | local
+		${HOME} cd done && sed printf then printf export -eu && ${HOME} /usr/bin
+	done 'quoted text' 2>/dev/null && $(pwd) printf done | -eu
+		$(pwd) sed grep x=1 export -eu export
+	echo grep grep $(pwd) "$1" export "$1" && $(pwd) 2>/dev/null
+		printf test "$@" export x=1 x=1 x=1 done | $(pwd) ${HOME} | $(pwd) "$@" --verbose
+	--verbose 2>/dev/null
+echo awk && ${HOME} && $(pwd) ${HOME} sed awk local
+then awk done readonly done x=1 "$@"
+2>/dev/null test sed ${HOME} local "$@" readonly awk printf echo grep
+	/usr/bin $(pwd) | x=1 grep --verbose
+		awk test sed grep grep --verbose
+	${HOME} --verbose cd 2>/dev/null
+		/usr/bin $(pwd) awk && /usr/bin
+		awk then && ${HOME} done grep --verbose |
+	2>/dev/null done cd readonly awk 2>/dev/null && local
+	then 2>/dev/null then 'quoted text' x=1 && && ${HOME} "$1" ${HOME} &&
+"$@" --verbose && --verbose sed printf x=1 readonly local
+		| echo x=1 export awk $(pwd) $(pwd) cd export local
+		2>/dev/null --verbose "$@" | grep echo then ${HOME}
+cd "$@" | export sed | 2>/dev/null sed then "$@" ${HOME}
+		then export 2>/dev/null ${HOME} local done /usr/bin
+		$(pwd) export --verbose 2>/dev/null
+	printf "$1" printf grep done /usr/bin "$1" echo "$1" 2>/dev/null x=1 grep
+		done /usr/bin /usr/bin printf cd --verbose
+	readonly -eu local -eu ${HOME}
+	${HOME} cd --verbose 'quoted text' cd sed test cd sed done
+cd 'quoted text' local "$@" $(pwd) $(pwd) -eu local ${HOME} sed test
+/usr/bin echo "$1" x=1 "$1" local ${HOME} echo grep done -eu "$@" done
+done -eu then cd "$@" awk grep grep --verbose
+	sed ${HOME} export printf done
+	&& then && && local cd cd | printf /usr/bin --verbose readonly ${HOME} local
+'quoted text' test 'quoted text'
+		x=1 $(pwd) 'quoted text'
+	grep awk awk 'quoted text' 2>/dev/null ${HOME} done then export 2>/dev/null
+	"$1" 2>/dev/null ${HOME}
+	/usr/bin -eu readonly ${HOME} awk --verbose local
+export printf printf | cd
+"$@" "$1" "$@" local 2>/dev/null echo | done sed --verbose test $(pwd) readonly
+	then sed 'quoted text' test x=1 --verbose --verbose
+export printf printf printf done
+	sed grep && readonly --verbose
+echo done grep | "$1" printf done printf "$1" cd export
+/usr/bin "$1" export done local printf awk "$1" "$1"
+	done 2>/dev/null awk /usr/bin grep
+local "$@" -eu 2>/dev/null x=1 x=1 | | x=1 2>/dev/null
+cd ${HOME} test 2>/dev/null x=1 ${HOME} awk /usr/bin ${HOME} | /usr/bin | --verbose
+		2>/dev/null then then test awk | local echo done /usr/bin "$@" "$1" local printf
+		-eu echo "$@" x=1 | sed /usr/bin cd -eu /usr/bin 'quoted text' "$1" cd echo
+local "$@" cd sed 2>/dev/null done grep export local -eu echo export
+readonly export | "$1" && test then /usr/bin "$@" -eu && cd ${HOME} ${HOME}
+awk | grep grep readonly sed -eu export "$@" echo "$1" -eu "$1" cd printf
+export local readonly awk x=1 "$@" | 'quoted text'
+		'quoted text' && grep -eu export x=1 test sed | echo
+--verbose x=1 done x=1 && --verbose 'quoted text' local ${HOME} $(pwd) ${HOME}
+		"$1" echo export awk done | -eu done 2>/dev/null awk 'quoted text'
+	test export test x=1 && export "$1" done echo
+	/usr/bin && test grep --verbose && done --verbose
+"$1" && /usr/bin --verbose readonly done ${HOME} $(pwd)
+	-eu echo done sed "$1" sed
+		awk awk 2>/dev/null sed grep awk sed awk then "$1" -eu
+grep test x=1 "$@" done --verbose "$@" export
+	"$@" local "$@" "$1" test test awk "$@" x=1 | -eu "$@" then "$@"
+x=1 local /usr/bin done readonly printf sed readonly readonly
+		done -eu --verbose export
+	'quoted text' done sed /usr/bin test $(pwd) test printf "$1" export
+&& "$1" $(pwd) | x=1 | --verbose then sed "$@" cd ${HOME} printf "$@" awk
+--verbose awk cd | echo "$1" then "$@"
+		'quoted text' test | -eu echo --verbose echo readonly --verbose then
+	cd awk export printf && readonly test then echo && awk x=1
+done --verbose echo 2>/dev/null then | local done grep && export cd x=1
+"$@" then grep /usr/bin then export
+		-eu 'quoted text' x=1 -eu readonly then "$1"
+	export 2>/dev/null "$1"
+$(pwd) ${HOME} export -eu 'quoted text' | echo
+	awk --verbose | -eu "$@" --verbose awk | "$@" | ${HOME} sed sed echo local
+		grep printf --verbose echo ${HOME} readonly then cd | then export ${HOME} "$1"
+		local "$@" x=1 'quoted text' /usr/bin
+sed done | 'quoted text' /usr/bin readonly done cd | --verbose $(pwd) echo
+		done -eu cd cd --verbose
+2>/dev/null awk | --verbose cd cd export 2>/dev/null --verbose
+readonly then echo /usr/bin grep export printf grep printf readonly
+	echo printf /usr/bin -eu readonly grep -eu grep x=1 readonly |
+	awk /usr/bin cd awk export ${HOME}
+		sed "$1" "$@" ${HOME} cd ${HOME} echo then grep $(pwd) $(pwd) local then --verbose
+test ${HOME} printf readonly done sed
+		2>/dev/null -eu | $(pwd) ${HOME} | awk -eu printf && 'quoted text' sed "$1" export
+	| "$@" -eu /usr/bin 2>/dev/null
+	sed cd ${HOME} 'quoted text' ${HOME} then printf awk /usr/bin 2>/dev/null
+		local --verbose test done /usr/bin ${HOME} echo awk export awk echo -eu
+		${HOME} ${HOME} grep 'quoted text' /usr/bin done then -eu
+		echo local sed "$1" test 2>/dev/null
+	sed then export then
+		&& ${HOME} | | local x=1 && "$@" test
+	x=1 "$1" then $(pwd) "$1" && "$@" $(pwd)
+cd echo export "$1" "$1" printf ${HOME} --verbose | /usr/bin
+printf 'quoted text' ${HOME}
+-eu --verbose -eu readonly && test | test $(pwd) awk | | printf
+		-eu export test -eu $(pwd) 2>/dev/null done --verbose cd "$@" test &&
+		test grep --verbose done awk done 'quoted text'
+	local test $(pwd) x=1 | then --verbose && /usr/bin
+	"$@" cd grep "$1" ${HOME} sed x=1 "$1" && 'quoted text'
+$(pwd) x=1 grep test $(pwd) printf awk | "$@" "$@"
+		test echo readonly sed "$@" | $(pwd) sed x=1 cd --verbose
+	readonly done 2>/dev/null 2>/dev/null
+		&& test echo awk x=1 local echo && local local /usr/bin grep local 2>/dev/null
+	$(pwd) && cd 'quoted text' test readonly awk test x=1 printf | "$1" 2>/dev/null
+	-eu cd export 'quoted text' && sed awk 2>/dev/null echo
+	echo /usr/bin "$@" export awk 2>/dev/null x=1 2>/dev/null
+$(pwd) $(pwd) -eu printf local grep 2>/dev/null test "$1" -eu done local
+	test x=1 test done sed
+	done printf --verbose grep
+	$(pwd) --verbose "$@" "$@" export ${HOME} "$@"
+printf --verbose readonly grep printf done echo --verbose
+		local cd export --verbose /usr/bin
+		export then x=1 && printf echo ${HOME} awk printf
+local cd printf $(pwd) -eu
+	'quoted text' test test printf --verbose x=1 --verbose echo echo sed /usr/bin
+		2>/dev/null awk then && done local x=1 done 'quoted text' --verbose printf
+		&& readonly test awk | $(pwd) cd then then --verbose then cd --verbose
+sed echo printf sed readonly --verbose 2>/dev/null export grep sed $(pwd) "$@" local
+${HOME} export cd echo grep $(pwd) --verbose "$1" done
+	$(pwd) printf "$@" ${HOME} && && done ${HOME} cd export cd readonly
+	${HOME} then && && --verbose "$@" echo
+"$1" --verbose export ${HOME} -eu $(pwd) "$1" | $(pwd) 'quoted text'
+	awk 'quoted text' "$@" "$@" awk grep | printf "$@" test
+cd /usr/bin x=1 cd grep export readonly printf /usr/bin awk ${HOME}
+		/usr/bin --verbose $(pwd) /usr/bin 'quoted text' "$1" ${HOME} grep readonly
+		| 'quoted text' done sed "$@" && --verbose test x=1 | &&
+	&& 2>/dev/null -eu printf cd readonly -eu readonly 2>/dev/null | done
+		$(pwd) cd grep test then "$1" test test x=1 done cd local $(pwd) x=1
+		&& x=1 2>/dev/null "$@" "$1" 'quoted text'
+echo done done cd --verbose "$@" --verbose $(pwd) sed export x=1
+	&& | -eu then "$1" done
+2>/dev/null sed echo ${HOME} &&
+	grep "$1" "$1" /usr/bin
+	export -eu sed cd ${HOME} 2>/dev/null test export ${HOME} "$@" --verbose
+	"$@" export "$@" echo ${HOME} 'quoted text'
+grep /usr/bin readonly --verbose echo echo --verbose
+'quoted text' "$@" readonly | printf
+	test readonly -eu --verbose test "$@"
+2>/dev/null --verbose ${HOME} $(pwd) then ${HOME} /usr/bin 2>/dev/null
+		${HOME} export $(pwd) --verbose $(pwd) "$@" test | awk $(pwd) ${HOME}
+	"$@" test readonly readonly
+		cd sed $(pwd) printf cd "$1" | printf "$1" --verbose ${HOME} | "$1" readonly done
+	echo x=1 cd --verbose
+awk && --verbose cd then cd $(pwd) "$@" --verbose echo grep
+'quoted text' "$1" $(pwd) $(pwd) ${HOME} awk x=1 2>/dev/null
+	$(pwd) cd test "$@" grep sed && && awk
+	x=1 "$@" -eu awk cd then test 'quoted text' test x=1 sed "$1" cd printf
+grep readonly echo --verbose readonly readonly x=1
+done cd cd local "$1" 2>/dev/null "$1" $(pwd) then --verbose
+	'quoted text' "$@" printf sed "$1" echo 'quoted text' local "$@" --verbose
+	done x=1 && grep x=1 /usr/bin then "$1" cd 'quoted text'
+	export awk test grep local local | -eu --verbose readonly sed local
+	test x=1 test --verbose
+		echo 'quoted text' readonly "$1" awk readonly
+	/usr/bin grep readonly sed -eu "$1" readonly awk awk printf
+		--verbose "$1" "$1" export && | 2>/dev/null
+export grep --verbose awk done | ${HOME} && --verbose readonly done
+	done "$1" grep ${HOME} awk --verbose echo
+x=1 /usr/bin "$1" export export 'quoted text' /usr/bin test "$@" sed 'quoted text'
+	--verbose -eu cd -eu 'quoted text' && sed /usr/bin ${HOME} | 2>/dev/null local local
+		cd sed cd export "$1" echo grep 'quoted text' | local test export printf
+		'quoted text' $(pwd) 'quoted text'
+printf readonly echo --verbose then /usr/bin awk
+		printf cd 'quoted text' ${HOME} sed test readonly
+awk echo done && export /usr/bin grep && 'quoted text' "$1"
+		then -eu "$@" --verbose $(pwd) readonly printf
+		local done $(pwd) | && local ${HOME} readonly
+	-eu "$1" -eu ${HOME} then $(pwd) ${HOME} local sed ${HOME} ${HOME}
+	sed "$@" grep grep | then "$1" -eu 'quoted text'
+		/usr/bin done local awk sed /usr/bin grep
+	readonly test grep "$@" x=1 | --verbose then
+readonly -eu && local --verbose -eu sed /usr/bin printf /usr/bin -eu
+	printf readonly --verbose "$1" "$@" local
+		2>/dev/null local x=1 sed done && readonly cd done then --verbose "$@"
+"$@" --verbose echo "$1" readonly readonly ${HOME} "$@" 'quoted text'
+	echo ${HOME} sed && | "$@" x=1 printf readonly done done /usr/bin
+'quoted text' -eu then -eu
+		sed "$@" ${HOME} "$1" -eu done echo then echo test readonly export done
+		printf local $(pwd) /usr/bin test -eu then "$@"
+		$(pwd) 2>/dev/null echo readonly awk
+| -eu | $(pwd) test ${HOME} printf printf done /usr/bin -eu awk
+done ${HOME} export ${HOME} echo &&
+	local readonly local $(pwd) printf 2>/dev/null
+	"$1" --verbose | x=1 && local ${HOME} printf $(pwd)
+		readonly readonly $(pwd) grep echo awk
+"$@" then done /usr/bin /usr/bin "$@" | -eu -eu sed -eu 2>/dev/null local
+'quoted text' cd printf -eu -eu then
+		--verbose "$1" x=1 done && export "$1" "$@" then
+	awk 2>/dev/null export echo ${HOME} --verbose $(pwd) done 2>/dev/null grep
+		awk x=1 "$1" awk ${HOME} grep | 2>/dev/null then grep
+"$@" sed done sed ${HOME} x=1
+	sed 2>/dev/null readonly --verbose export grep
+test awk ${HOME} test /usr/bin --verbose
+		| x=1 awk -eu x=1 $(pwd) x=1 /usr/bin -eu "$@" done -eu export -eu 2>/dev/null
+sed /usr/bin --verbose sed && sed
+		"$@" 'quoted text' --verbose 'quoted text'
+		$(pwd) echo grep && echo then $(pwd) awk then 2>/dev/null "$@" && sed cd &&
+	awk grep --verbose grep --verbose readonly awk |
+done ${HOME} ${HOME} 'quoted text'
+		printf cd then readonly echo awk "$@" && | export 'quoted text' "$1" /usr/bin
+grep "$@" awk grep "$1" printf done done "$@" readonly local "$@"
+awk export 'quoted text' printf
+	then -eu 'quoted text' echo | cd export
+	-eu "$@" cd awk "$1" "$1" 2>/dev/null awk ${HOME}
+-eu then then export cd awk local "$@" test cd x=1 "$@" --verbose readonly
+local $(pwd) local ${HOME} --verbose x=1 "$1" --verbose
+		cd "$@" $(pwd) echo echo | done "$1" test $(pwd) && $(pwd) "$@" export | x=1
+&& --verbose "$1" | cd sed "$1" $(pwd) printf sed ${HOME} --verbose --verbose
+	"$@" printf test test readonly then ${HOME} export export then done ${HOME} echo
+--verbose 'quoted text' grep | then && test export "$1" &&
+awk "$1" sed test "$@"
+		"$@" 'quoted text' done "$@" --verbose "$@" done then | then
+	cd grep x=1 | echo awk -eu awk awk grep "$@" echo sed local
+done | 2>/dev/null |
+		"$1" --verbose | "$1" --verbose "$1" done x=1 $(pwd) grep $(pwd) x=1 grep
+		"$@" echo awk test test then
+	"$@" -eu grep "$@" local grep --verbose "$1" printf cd readonly
+	done awk awk /usr/bin readonly then test printf printf "$@" grep && grep
+	"$1" ${HOME} cd /usr/bin awk $(pwd) | cd
+		x=1 --verbose printf 2>/dev/null export "$1" 2>/dev/null then echo /usr/bin
+	'quoted text' printf /usr/bin cd -eu then x=1 export echo $(pwd) ${HOME}
+		${HOME} --verbose | /usr/bin done /usr/bin then
+cd 2>/dev/null 2>/dev/null printf "$1" && | 2>/dev/null | --verbose awk -eu 'quoted text'
+		local awk sed --verbose /usr/bin sed 'quoted text' grep done awk -eu
+	'quoted text' /usr/bin "$@" export
+	| -eu grep $(pwd) && done
+&& export readonly -eu then -eu && /usr/bin printf sed /usr/bin awk readonly
+grep echo cd x=1 sed echo done test
+	grep local readonly && "$@" test then 2>/dev/null grep /usr/bin done | 2>/dev/null
+--verbose "$1" $(pwd) awk x=1 readonly $(pwd) 2>/dev/null printf printf sed
+test 2>/dev/null echo readonly awk done /usr/bin
+	$(pwd) $(pwd) awk export test cd echo printf
+		&& cd grep cd done grep test sed awk "$1" done local $(pwd) readonly -eu done
+		cd printf echo && "$1" test && export export cd test x=1 && &&
+	2>/dev/null ${HOME} awk ${HOME} local && -eu -eu echo
+readonly then 'quoted text'
+2>/dev/null printf $(pwd) cd 2>/dev/null
+	2>/dev/null -eu $(pwd) printf ${HOME} && cd /usr/bin local awk test printf /usr/bin
+	'quoted text' local x=1 local export
+	${HOME} --verbose printf grep 2>/dev/null x=1 cd /usr/bin | "$@"
+	/usr/bin printf sed printf "$1" --verbose $(pwd) x=1 sed "$@"
+$(pwd) local 'quoted text' grep readonly done "$1"
+x=1 awk printf readonly 2>/dev/null | local --verbose /usr/bin readonly grep export
+	then --verbose "$1" ${HOME} echo
+		-eu sed done /usr/bin local /usr/bin then --verbose
+	done cd "$1" /usr/bin
+${HOME} awk /usr/bin /usr/bin /usr/bin ${HOME} sed "$@" test sed awk x=1
+--verbose $(pwd) then
+--verbose readonly export -eu
+		--verbose /usr/bin -eu readonly printf echo 2>/dev/null export
+		grep 'quoted text' -eu cd readonly done -eu 'quoted text'
+export readonly /usr/bin sed /usr/bin sed
+		--verbose --verbose | $(pwd) 2>/dev/null
+		'quoted text' && "$@" 'quoted text' test -eu done "$@" sed
+	2>/dev/null printf done sed "$1" 'quoted text'
+then 'quoted text' test x=1
+		2>/dev/null sed echo $(pwd) /usr/bin local export $(pwd) export 2>/dev/null
+	-eu grep --verbose cd sed sed then awk cd $(pwd) -eu "$@" echo
+	$(pwd) x=1 done sed $(pwd) --verbose cd && local awk && && grep
+	echo done awk done export "$@" test -eu -eu readonly printf
+| x=1 then 2>/dev/null cd echo && x=1 echo 2>/dev/null readonly sed grep |
+	printf printf -eu echo grep done "$1" echo done done /usr/bin --verbose awk ${HOME}
+--verbose printf echo /usr/bin done readonly grep cd /usr/bin
+	'quoted text' test local "$@" export 'quoted text' | x=1
+		export readonly /usr/bin test 2>/dev/null echo | --verbose
+	export --verbose "$@" "$1" readonly 2>/dev/null local 2>/dev/null && ${HOME}
+	x=1 2>/dev/null x=1 done 'quoted text' -eu sed done sed sed 2>/dev/null
+		/usr/bin done then --verbose readonly sed cd printf ${HOME} awk
+		&& test printf | 2>/dev/null
+grep local | local "$1" export printf local
+	$(pwd) echo then x=1 "$@" && done 'quoted text'
+	printf sed 'quoted text' 2>/dev/null $(pwd) printf $(pwd)
+		grep export readonly readonly -eu ${HOME} -eu
+		printf ${HOME} then then local | then
+	done $(pwd) grep 2>/dev/null awk --verbose readonly /usr/bin
+#include c71.sh
+		export echo /usr/bin echo /usr/bin
+	'quoted text' sed /usr/bin readonly grep then --verbose then 2>/dev/null
+		x=1 test sed /usr/bin test | echo test --verbose local /usr/bin export awk
+	done export grep "$1" local cd
+export -eu printf cd local && export
+		"$1" | ${HOME} x=1 /usr/bin readonly printf /usr/bin "$1"
+		'quoted text' printf awk echo awk
+"$1" 2>/dev/null grep printf export cd printf test grep /usr/bin
+		${HOME} test --verbose
+printf "$@" local 2>/dev/null && export local "$1" printf export printf
+	2>/dev/null cd ${HOME} /usr/bin export printf
+&& cd test "$1" local x=1 test done test 'quoted text' $(pwd) &&
+then 'quoted text' readonly | -eu && export local "$@" ${HOME}
+test "$1" readonly awk --verbose 'quoted text' cd sed 'quoted text'
+	grep then "$@" then --verbose done -eu sed cd printf readonly echo x=1
+		then /usr/bin cd sed --verbose -eu "$@" done "$1" /usr/bin
+		export printf readonly cd cd -eu "$@" cd local export local /usr/bin
+grep then $(pwd) readonly 2>/dev/null
+local --verbose local awk done grep export done sed
+		"$1" echo | | local $(pwd) "$1" 2>/dev/null 2>/dev/null
+		&& --verbose sed echo 2>/dev/null -eu ${HOME} readonly
+	--verbose cd sed awk $(pwd) --verbose
+	"$1" 'quoted text' readonly printf $(pwd) | /usr/bin
+	sed "$1" export -eu ${HOME} 'quoted text' grep then
+grep export --verbose done sed ${HOME} export "$1" && -eu | cd sed
+		cd 2>/dev/null grep "$1" "$1" grep "$@"
+		2>/dev/null ${HOME} x=1 &&
+		cd -eu 'quoted text' && 'quoted text' test "$1" "$1"
+	printf && 2>/dev/null "$@" --verbose
+		| readonly "$1" cd -eu $(pwd) x=1 test 2>/dev/null "$1" -eu then grep
+		"$1" sed $(pwd) local cd x=1 --verbose printf $(pwd) awk /usr/bin
+	readonly grep $(pwd) "$@" awk readonly cd && local printf ${HOME} test
+	"$@" then 'quoted text' export
+	local grep local 'quoted text' x=1
+		&& export echo 2>/dev/null 'quoted text'
+		'quoted text' 'quoted text' 2>/dev/null grep awk sed export ${HOME}
+	-eu "$@" "$1" "$@" x=1 awk cd | export 'quoted text' && x=1 | --verbose export
+"$1" /usr/bin echo test "$@"
+	readonly $(pwd) sed x=1 "$1" "$@" "$1" awk cd export printf then local grep |
+		sed "$@" 'quoted text' && grep
+printf export ${HOME} sed
+2>/dev/null readonly /usr/bin done 2>/dev/null | grep ${HOME}
+		--verbose export test then --verbose | ${HOME} test echo local
+		test sed ${HOME} -eu export "$1"
+	grep readonly done test local | ${HOME} cd printf 2>/dev/null awk echo
+cd | 2>/dev/null echo export x=1 $(pwd) cd | readonly then cd -eu cd echo
+	grep printf local "$1" 'quoted text'
+		then && x=1 ${HOME} && 'quoted text'
+local $(pwd) local -eu awk ${HOME} test
+&& "$@" ${HOME} awk 2>/dev/null then test
+		${HOME} printf export export /usr/bin && readonly
+		"$@" --verbose $(pwd) && 'quoted text'
+${HOME} then /usr/bin cd printf local --verbose 'quoted text' grep x=1 grep 2>/dev/null
+		test x=1 export && && $(pwd) awk $(pwd) sed "$@" readonly printf
+	local | printf cd | sed $(pwd) ${HOME} readonly
+sed printf then local printf export x=1 'quoted text' cd -eu | --verbose
+	then $(pwd) 2>/dev/null "$@" && grep -eu readonly awk echo done /usr/bin --verbose
+		then then export cd | cd printf then "$@" awk x=1 grep x=1 echo x=1 awk
+		/usr/bin -eu 2>/dev/null done cd printf
+then echo 2>/dev/null then $(pwd) sed cd export local && grep test
+		printf -eu "$@" && awk "$@" awk export test --verbose then
+"$@" "$1" then export ${HOME} test ${HOME} cd local sed
+	2>/dev/null printf && cd --verbose "$1" 2>/dev/null ${HOME}
+$(pwd) && printf "$@" sed export grep then export /usr/bin awk export | test
+2>/dev/null /usr/bin local then ${HOME} ${HOME}
+	local test ${HOME} local | x=1 --verbose
+2>/dev/null 'quoted text' && then printf && 2>/dev/null x=1 --verbose ${HOME}
+then echo "$@" done test test
+2>/dev/null test local echo "$1" 'quoted text' cd awk export |
+		done --verbose && $(pwd) 2>/dev/null 2>/dev/null
+| | "$1" | && -eu awk done local $(pwd) &&
+$(pwd) echo --verbose grep
+	--verbose "$@" done | "$@" 'quoted text' sed && sed 2>/dev/null 2>/dev/null
+/usr/bin 2>/dev/null readonly
+		| 'quoted text' sed echo printf
+	-eu then "$@" && awk 'quoted text' ${HOME} ${HOME} | grep
+export "$@" export printf printf x=1 test cd
+		2>/dev/null "$@" && cd local printf && echo readonly x=1 test --verbose $(pwd)
+		--verbose awk "$1" | then test done then sed local $(pwd) test local then "$@"
+		grep test grep grep 'quoted text' --verbose | x=1 | ${HOME} grep then export
+	awk grep "$1" done local echo && done awk && local --verbose
+test $(pwd) sed 2>/dev/null then
+		x=1 grep awk echo local 2>/dev/null
+$(pwd) $(pwd) local /usr/bin -eu 2>/dev/null echo x=1 echo $(pwd) 'quoted text'
+		grep "$@" "$@" test cd | /usr/bin -eu echo "$@" export then 'quoted text' cd
+--verbose awk export x=1 | then cd readonly done printf x=1 local | "$1"
+		echo x=1 | readonly export 2>/dev/null x=1 export ${HOME} done grep sed export
+/usr/bin 'quoted text' /usr/bin
+		awk cd "$1" local "$1" then --verbose x=1 | awk done
+		sed -eu printf --verbose done | done ${HOME} $(pwd) /usr/bin
+"$1" echo --verbose readonly && echo --verbose then printf "$1" --verbose grep
+		${HOME} printf readonly $(pwd) then local done ${HOME}
+	printf cd 'quoted text' printf $(pwd) "$@"
+	local echo | test export x=1
+		/usr/bin ${HOME} $(pwd) "$1"
+	done local sed printf awk "$@" 2>/dev/null
+	test printf readonly | "$1" ${HOME} local test && local && cd ${HOME} /usr/bin
+| x=1 2>/dev/null export echo printf "$@" 'quoted text' | 'quoted text'
+		cd /usr/bin test cd readonly printf | then "$1" --verbose
+		| then $(pwd) readonly $(pwd) done --verbose printf && "$@" "$1" --verbose
+		awk x=1 test then local readonly export awk | local local -eu done --verbose
+${HOME} /usr/bin ${HOME} grep | grep | printf grep echo
+	"$@" cd then | "$1" -eu -eu && "$1" ${HOME} x=1 ${HOME} ${HOME}
+test test awk local $(pwd) done 2>/dev/null echo
+		"$1" export 'quoted text'
+	local test grep 2>/dev/null
+then awk ${HOME} ${HOME} sed -eu "$1" sed
+done "$1" 2>/dev/null sed 'quoted text' export echo echo --verbose test
+	then test /usr/bin export sed
+		export printf grep "$1" export
+"$@" $(pwd) | readonly
+		readonly cd grep cd grep printf readonly test | grep && 2>/dev/null local 2>/dev/null
+"$1" -eu sed then 2>/dev/null -eu readonly "$1" $(pwd) && readonly
+		&& 2>/dev/null | readonly sed x=1 export && awk -eu echo grep
+	| /usr/bin $(pwd) export "$1"
+	grep awk cd "$1" echo awk
+-eu $(pwd) printf 'quoted text' then
+"$1" done | --verbose --verbose 2>/dev/null
+		then "$1" "$1" grep "$@" cd done | /usr/bin
+	'quoted text' x=1 cd cd test export "$@" done
+awk grep --verbose sed done test
+	"$1" -eu grep "$1" x=1 x=1 "$@" test cd printf readonly $(pwd) -eu -eu
+		export done printf --verbose grep export cd $(pwd) /usr/bin test local grep
+		test done sed readonly 'quoted text'
+grep local 'quoted text' ${HOME} 2>/dev/null local echo 'quoted text'
+	| | $(pwd) export grep done sed $(pwd) "$@" 'quoted text'
+		done -eu ${HOME} test export /usr/bin echo ${HOME} && && export cd sed /usr/bin
+echo | --verbose x=1 2>/dev/null readonly 'quoted text' echo
+| x=1 export | 2>/dev/null $(pwd) printf ${HOME} | then then -eu -eu then
+		printf "$@" cd grep "$1" printf | readonly echo /usr/bin local
+	2>/dev/null | -eu -eu ${HOME} -eu | ${HOME} echo
+local "$1" ${HOME} ${HOME} "$@" printf "$1" 2>/dev/null
+	$(pwd) test "$1" echo | -eu x=1
+	-eu "$@" printf --verbose
+sed printf export "$1" "$@" awk /usr/bin "$1" awk
+	"$1" done grep cd "$1" 2>/dev/null "$@" "$1" "$@" readonly test -eu awk &&
+	x=1 | /usr/bin && done sed | done --verbose grep
+	export sed | 2>/dev/null printf
+x=1 cd done printf $(pwd) && echo test grep && then "$@" 2>/dev/null $(pwd) --verbose
+--verbose printf echo done
+		readonly printf local 2>/dev/null awk export
+	| -eu --verbose 'quoted text' $(pwd) x=1 then local --verbose
+	/usr/bin grep $(pwd) local 2>/dev/null done ${HOME} x=1 | then readonly echo awk
+		"$1" 'quoted text' /usr/bin ${HOME}
+"$1" "$1" export done cd "$@" ${HOME} $(pwd) $(pwd)
+		&& test "$@" printf grep test x=1 done sed
+	test "$1" test cd test -eu -eu grep
+	sed printf --verbose x=1 x=1 awk then
+	grep && "$1" x=1 ${HOME} 2>/dev/null
+--verbose echo cd test cd 2>/dev/null 'quoted text' grep
+test then awk awk 'quoted text' ${HOME} 'quoted text' then
+-eu then sed /usr/bin "$@" | && "$@" cd -eu
+		"$1" && cd done | --verbose ${HOME} $(pwd) cd
+test "$1" grep local ${HOME} then $(pwd) 2>/dev/null "$@" 2>/dev/null sed && readonly
+	then --verbose echo grep &&
+		done "$@" echo awk 2>/dev/null export test printf local ${HOME} /usr/bin
+		done then cd cd ${HOME}
+		"$1" readonly test "$1" sed then $(pwd)
+2>/dev/null sed done $(pwd) then ${HOME} 2>/dev/null
+x=1 x=1 && 2>/dev/null then
+	grep 2>/dev/null 2>/dev/null readonly
+	printf local awk test x=1 done echo test printf grep 2>/dev/null local
+	test readonly local "$@" && printf echo echo $(pwd) x=1 export printf grep
+"$@" then "$@" $(pwd) grep --verbose | && ${HOME} cd
+printf -eu -eu 2>/dev/null "$1" cd export local grep
+echo 'quoted text' -eu --verbose test ${HOME} echo done "$1" then
+		| cd printf export sed x=1 -eu done --verbose 2>/dev/null done awk $(pwd) echo printf
+		&& export cd -eu "$@" 'quoted text' x=1 echo 'quoted text'
+		export $(pwd) cd $(pwd) test printf then cd awk x=1
+		$(pwd) 2>/dev/null "$@"
+		'quoted text' readonly printf "$@" cd "$@" 'quoted text' 'quoted text'
+	--verbose x=1 awk /usr/bin printf echo "$@" readonly local --verbose
+	/usr/bin /usr/bin echo done readonly x=1 x=1 then awk --verbose /usr/bin
+		export "$1" then test cd awk printf test cd ${HOME} 'quoted text' | "$1" sed
+	/usr/bin /usr/bin 2>/dev/null sed cd then ${HOME}
+grep -eu printf 'quoted text' printf local awk -eu x=1 x=1 /usr/bin
+	${HOME} local /usr/bin then awk /usr/bin "$@" -eu /usr/bin local
+	export x=1 sed cd echo export --verbose
+${HOME} "$@" $(pwd) $(pwd) done 2>/dev/null /usr/bin
+${HOME} "$@" "$@" local awk then sed awk awk grep && test then
+done "$1" grep 2>/dev/null /usr/bin ${HOME} $(pwd) test x=1 printf
+printf "$1" 'quoted text' sed printf && sed /usr/bin test done printf && | 2>/dev/null
+		grep 'quoted text' grep "$@"
+2>/dev/null test -eu sed
+		grep --verbose 'quoted text' test &&
+	cd local grep 2>/dev/null then | x=1 sed test
+		"$1" export "$1" "$@" | ${HOME} echo "$@" echo 'quoted text' readonly
+		| -eu 'quoted text' grep then --verbose ${HOME} "$@"
+	| ${HOME} --verbose export -eu
+	awk then 'quoted text' -eu | --verbose --verbose
+		2>/dev/null --verbose readonly /usr/bin printf | done $(pwd) then then --verbose
+		grep $(pwd) echo grep -eu 'quoted text' sed "$1" ${HOME} "$1" echo printf test
+| /usr/bin --verbose then local sed export echo && "$1"
+	then $(pwd) done export $(pwd) --verbose /usr/bin cd printf test readonly
+		'quoted text' awk local ${HOME} awk done export
+	grep readonly --verbose -eu readonly test sed -eu readonly 'quoted text'
+test -eu ${HOME} 2>/dev/null grep grep echo --verbose test /usr/bin x=1 cd $(pwd)
+		"$1" "$@" readonly 2>/dev/null export echo "$1" grep echo echo $(pwd)
+	'quoted text' -eu --verbose cd && cd 2>/dev/null | "$1" export done 2>/dev/null
+		readonly readonly cd /usr/bin printf /usr/bin && grep echo
+		sed 'quoted text' local export echo 2>/dev/null
+	'quoted text' sed --verbose -eu local x=1 test "$1" cd echo 'quoted text'
+printf test x=1 --verbose then "$@" echo ${HOME} printf $(pwd) printf "$@" | "$@"
+		done x=1 printf readonly 'quoted text' local ${HOME} export /usr/bin
+done 2>/dev/null echo 2>/dev/null $(pwd) $(pwd)
+	then cd /usr/bin readonly test
+${HOME} sed sed && local awk grep -eu x=1
+2>/dev/null then /usr/bin --verbose readonly cd printf --verbose readonly
+		test printf "$1" grep readonly export printf cd -eu x=1 awk | && sed sed test
+awk done echo 2>/dev/null "$1" /usr/bin export cd -eu ${HOME}
+sed grep --verbose ${HOME} sed /usr/bin x=1 cd cd $(pwd) test
+"$@" $(pwd) grep printf
+		awk sed 2>/dev/null x=1 grep awk $(pwd) 'quoted text'
+local -eu done done 'quoted text'
+		cd readonly "$1" done /usr/bin sed | awk "$1" $(pwd) cd cd test x=1 "$1" grep
+--verbose cd /usr/bin | export ${HOME} x=1 'quoted text' && 2>/dev/null local
+echo grep done awk /usr/bin export 2>/dev/null done printf
+'quoted text' 'quoted text' done "$@" grep local then grep
+		test 'quoted text' && 'quoted text'
+	-eu local cd ${HOME} && export -eu export | --verbose 'quoted text' "$1" -eu
+	grep then export x=1 "$1" 'quoted text'
+		"$1" | readonly x=1 -eu "$1" x=1 --verbose printf 2>/dev/null echo && echo /usr/bin
+		awk readonly "$@" "$@" test "$1" export ${HOME}
+		grep grep local printf | $(pwd) then then | sed printf "$@" grep
+done ${HOME} $(pwd) -eu && then echo echo test export
+2>/dev/null readonly test "$1" done | $(pwd) -eu done /usr/bin
+cd local grep && ${HOME} /usr/bin /usr/bin
+readonly awk 2>/dev/null 'quoted text' ${HOME} then /usr/bin -eu 'quoted text'
+		"$1" 2>/dev/null --verbose ${HOME} ${HOME} readonly 2>/dev/null 'quoted text'
+		then "$1" x=1 "$1" | | --verbose readonly echo cd --verbose
+		then grep export awk "$1" test /usr/bin "$@" sed export "$@" --verbose readonly
+		then ${HOME} awk && "$@" test $(pwd) local sed | /usr/bin
+2>/dev/null "$@" readonly local 2>/dev/null export x=1 printf
+	${HOME} sed 'quoted text' test done $(pwd) $(pwd) export "$@" echo then x=1 readonly
+	local 2>/dev/null done then /usr/bin
+	| echo done | --verbose done 'quoted text'
+		"$1" x=1 readonly x=1 "$@" cd "$1"
+	readonly local "$@" awk echo awk ${HOME} -eu cd x=1 $(pwd)
+	/usr/bin echo then | 2>/dev/null --verbose
+echo test sed --verbose
+echo cd x=1 && x=1 2>/dev/null done test
+	awk awk done cd sed export -eu printf cd then && echo
+"$@" test cd "$1" local cd local
+		&& grep cd && && done | local --verbose 2>/dev/null "$@" -eu ${HOME}
+		done readonly "$@" cd
+	cd -eu export echo echo grep grep
+--verbose grep && grep x=1 && $(pwd) x=1 cd done
+		then -eu "$@" done then test readonly export cd | &&
+		/usr/bin -eu ${HOME} | test 'quoted text' sed -eu export echo printf cd
+		| export ${HOME} cd local
+		awk cd cd /usr/bin export "$1" /usr/bin then /usr/bin
+		/usr/bin awk echo then printf echo &&
+		done done export echo printf grep |
+readonly --verbose sed /usr/bin awk 'quoted text' && done
+		/usr/bin 2>/dev/null local awk done 2>/dev/null --verbose
+		done printf test then /usr/bin local readonly sed x=1 -eu test
+		export then ${HOME} 'quoted text' --verbose 'quoted text' /usr/bin -eu
+	$(pwd) test /usr/bin done --verbose local sed --verbose ${HOME} "$@" then echo
+		-eu && awk "$@" readonly x=1 --verbose echo x=1 local
+done printf then 2>/dev/null test awk local
+export then -eu then test export printf 'quoted text' test
+	cd awk readonly grep printf readonly export readonly local readonly sed | x=1
+		-eu export -eu "$1" readonly -eu sed 2>/dev/null 2>/dev/null then
+cd "$1" "$@" /usr/bin && && $(pwd) readonly
+		${HOME} echo x=1 | && sed --verbose x=1 'quoted text' ${HOME} ${HOME}
+	x=1 cd x=1 2>/dev/null local awk test "$@" "$@" readonly
+echo | $(pwd) sed test "$1" /usr/bin
+		readonly x=1 | done awk
+		/usr/bin -eu test 'quoted text' awk "$1" readonly awk then readonly && 'quoted text'
+	/usr/bin then echo export test then 2>/dev/null
+2>/dev/null "$@" x=1 done x=1 export cd export printf x=1
+	/usr/bin -eu 'quoted text' local awk x=1 awk
+printf local grep $(pwd) 2>/dev/null grep local test "$1" | --verbose "$@" test
+'quoted text' 'quoted text' "$1" 2>/dev/null
+	x=1 /usr/bin readonly awk export --verbose x=1 --verbose readonly
+local 'quoted text' sed
+readonly local local local printf | local sed echo 2>/dev/null
+	then | awk | readonly &&
+local cd readonly local export 'quoted text' x=1 readonly echo cd "$1" awk 'quoted text'
+		| 2>/dev/null && local 'quoted text' readonly grep /usr/bin && then readonly x=1
+-eu 'quoted text' local 2>/dev/null "$@" | && done --verbose
+		done cd "$@" --verbose "$@" grep cd ${HOME} 'quoted text' -eu 2>/dev/null
+		export sed done -eu sed $(pwd) $(pwd) sed 'quoted text' $(pwd) 'quoted text'
+		test readonly -eu grep cd sed local export sed export
+then export readonly echo echo 'quoted text' -eu test export
+then "$1" $(pwd) echo local then x=1 --verbose 'quoted text'
+		export $(pwd) done "$@" "$@" sed ${HOME}
+/usr/bin sed sed local ${HOME} "$@" /usr/bin sed test | | awk 'quoted text'
+		$(pwd) grep 'quoted text' cd echo
+readonly sed awk local test local 'quoted text' $(pwd) "$1" && /usr/bin ${HOME}
+	cd readonly | printf local 2>/dev/null "$@" ${HOME}
+${HOME} local 2>/dev/null printf printf local export ${HOME}
+		then awk echo "$1" echo ${HOME} local sed then && cd local echo
+printf /usr/bin /usr/bin
+	readonly $(pwd) "$1" 2>/dev/null printf && echo
+		test -eu done test test then then && grep -eu -eu
+	readonly grep ${HOME}
+	-eu grep && /usr/bin done /usr/bin -eu 2>/dev/null done -eu
+/usr/bin sed /usr/bin cd "$1" printf printf "$@" awk "$1" $(pwd) done && awk x=1
+readonly && x=1 grep ${HOME} grep --verbose
+		--verbose printf 'quoted text' 'quoted text' grep done "$1" test sed readonly /usr/bin
+	awk $(pwd) --verbose test grep readonly echo
+	--verbose --verbose --verbose cd 'quoted text'
+	&& $(pwd) test then done export 2>/dev/null
+"$1" /usr/bin x=1 grep local $(pwd) local
+		then 'quoted text' done ${HOME} done 2>/dev/null
+		printf readonly then export "$@" sed $(pwd) readonly "$@" "$1" sed x=1
+		done $(pwd) local | /usr/bin then && "$@"
+'quoted text' then readonly
+awk cd /usr/bin && 'quoted text' "$1" /usr/bin
+		--verbose 2>/dev/null echo done printf
+	'quoted text' --verbose grep && $(pwd)
+grep awk 'quoted text' -eu 2>/dev/null echo echo then
+	cd export export test then --verbose && sed 2>/dev/null readonly
+	grep printf then readonly x=1
+		--verbose echo | local
+sed awk $(pwd) readonly "$1" awk $(pwd) echo
+${HOME} 2>/dev/null test awk $(pwd) then x=1 x=1 test echo printf
+	export done x=1 then
+'quoted text' then 'quoted text'
+		2>/dev/null "$1" /usr/bin done -eu 2>/dev/null 'quoted text' /usr/bin x=1 "$@"
+echo grep -eu readonly $(pwd) "$1" test local -eu echo grep 2>/dev/null
+test test local awk 2>/dev/null test $(pwd) awk $(pwd)
+	grep --verbose && $(pwd)
+/usr/bin "$1" sed local local then --verbose && done x=1 echo /usr/bin local
+	local | then 'quoted text' echo "$@" | test x=1 'quoted text'
+	export grep x=1 'quoted text' /usr/bin | echo readonly -eu
+	2>/dev/null 2>/dev/null done 2>/dev/null ${HOME} then $(pwd) "$@" -eu /usr/bin
+2>/dev/null ${HOME} 2>/dev/null local x=1
+readonly | 'quoted text' ${HOME} && printf
+		done done -eu awk cd ${HOME} cd awk 'quoted text' "$@" /usr/bin readonly 'quoted text'
+	done /usr/bin sed local 2>/dev/null grep local readonly -eu x=1 awk x=1 $(pwd)
+$(pwd) grep "$1" 'quoted text' | ${HOME} done local awk x=1 ${HOME} done printf
+		--verbose cd export "$@" echo x=1 grep ${HOME} 'quoted text'
+	printf -eu then readonly test test export grep export test /usr/bin
+2>/dev/null $(pwd) printf --verbose $(pwd) cd sed 2>/dev/null --verbose
+	echo x=1 x=1 local echo sed
+	then -eu then readonly 'quoted text' export x=1 'quoted text' grep
+local sed 2>/dev/null && then 2>/dev/null --verbose sed | sed
+&& readonly done test cd cd | $(pwd) awk sed test done awk readonly /usr/bin grep
+		&& x=1 | -eu $(pwd) printf local ${HOME} printf
+2>/dev/null 2>/dev/null grep export
+"$@" sed --verbose readonly printf "$@" echo awk done printf --verbose | test
+	printf /usr/bin test echo "$1" printf echo awk "$1" ${HOME}
+test readonly then printf -eu cd local local export
+		&& readonly "$1" "$@" sed x=1 export 2>/dev/null
+	cd 'quoted text' sed echo sed awk -eu && $(pwd) test 'quoted text'
+cd done echo | echo local cd readonly && readonly readonly export grep
+	done $(pwd) "$@" "$@" cd test && local $(pwd) "$@" echo
+		echo x=1 | echo printf printf -eu awk then x=1 awk 'quoted text' readonly
+		--verbose cd | 2>/dev/null
+	sed grep | $(pwd) /usr/bin then /usr/bin awk local 'quoted text' --verbose
+	/usr/bin 2>/dev/null 'quoted text' test test $(pwd)
+	$(pwd) grep 2>/dev/null sed then
+test local echo awk 2>/dev/null
+	echo -eu && readonly readonly "$@" echo 2>/dev/null 'quoted text' sed ${HOME}
+	readonly "$@" sed then export --verbose printf grep 'quoted text' awk done
+	done printf 'quoted text' /usr/bin export "$@" "$1" export
+-eu local readonly readonly
+		printf --verbose awk "$1" grep echo done ${HOME} --verbose awk -eu cd
+readonly then then sed x=1 "$1" grep cd x=1 /usr/bin export
+	$(pwd) "$1" 'quoted text' && printf cd local sed --verbose readonly
+&& then awk && "$@" "$1" && 2>/dev/null x=1
+		x=1 local && | test | "$1" /usr/bin
+readonly sed x=1 awk local
+	grep --verbose echo "$1" cd --verbose 2>/dev/null "$1" | && echo 'quoted text'
+	"$@" $(pwd) test ${HOME} --verbose 2>/dev/null done $(pwd) "$@"
+x=1 2>/dev/null echo test then 2>/dev/null "$1" x=1 | done cd /usr/bin
+done printf "$1" grep then readonly
+		export && --verbose 2>/dev/null
+"$1" done "$@" echo /usr/bin
+		grep grep grep "$1" x=1 "$@" sed -eu 'quoted text' "$1" cd
+	sed then then printf | x=1 "$1"
+cd then export cd printf done
+echo awk "$1" ${HOME} && test echo "$1"
+	local sed 'quoted text' 2>/dev/null "$1" then test export
+${HOME} then "$@" --verbose done 'quoted text'
+		$(pwd) | 2>/dev/null then && printf
+	sed --verbose then "$1" | export readonly test cd && && local
+		/usr/bin /usr/bin -eu x=1 -eu -eu test readonly x=1 -eu grep x=1 "$@" 2>/dev/null
+		grep printf && grep x=1
+		echo then local sed $(pwd) export
+"$@" ${HOME} grep then grep
+export | sed printf -eu printf
+		export cd ${HOME} && --verbose x=1 && --verbose printf
+	x=1 /usr/bin sed "$@" | done | "$@" $(pwd) export | then cd grep
+	cd cd -eu echo printf 'quoted text' cd 2>/dev/null x=1 awk
+	'quoted text' local then /usr/bin x=1 export awk then done /usr/bin readonly
+	grep awk local sed && --verbose export x=1 && "$@"
+		&& | export local then "$1"
+x=1 ${HOME} awk grep ${HOME} printf && awk ${HOME} x=1
+		'quoted text' grep done local done readonly then ${HOME}
+	grep grep test then awk grep && -eu 'quoted text' sed echo then
+	${HOME} | echo done "$@" | && $(pwd) 'quoted text'
+		x=1 printf local "$1" readonly test export x=1 "$1" printf then
+echo test echo x=1 readonly done sed 'quoted text' "$1" then x=1 "$1" "$1" sed
+		${HOME} printf local sed grep test test echo /usr/bin
+		done && "$@" /usr/bin "$@" awk -eu $(pwd) then cd sed /usr/bin ${HOME} grep
+&& test -eu "$@" cd && $(pwd) test x=1 export
+		&& "$@" export | then echo cd /usr/bin $(pwd) ${HOME}
+2>/dev/null | 'quoted text' test $(pwd) awk 'quoted text'
+	awk then | $(pwd) x=1 && sed x=1 "$1" readonly ${HOME} readonly
+		echo && export "$@" /usr/bin "$@" $(pwd) test echo
+sed ${HOME} | $(pwd) awk readonly local $(pwd) then export test readonly 'quoted text'
+		printf 'quoted text' echo export grep "$@" sed "$1" -eu export 2>/dev/null
+		-eu local local x=1 printf grep
+	then 2>/dev/null ${HOME} printf && printf && x=1 local local
+done -eu "$1" x=1 echo awk "$1" grep "$1" grep done echo $(pwd)
+		'quoted text' done test done x=1 awk local test test awk
+		$(pwd) /usr/bin $(pwd) | "$1" | -eu grep
+		--verbose "$@" test printf printf "$@"
+		x=1 --verbose 2>/dev/null then echo 2>/dev/null 2>/dev/null
+printf sed export "$1" ${HOME} then printf
+--verbose cd done x=1 then --verbose export local
+		export 'quoted text' then printf "$@" sed /usr/bin done /usr/bin local test
+sed && && export x=1 done sed 'quoted text' "$1" sed $(pwd) cd 'quoted text'
+		local 'quoted text' readonly test 'quoted text' 2>/dev/null
+	grep "$@" grep 'quoted text' "$1" && /usr/bin done -eu awk
+	done printf | "$1" /usr/bin $(pwd)
+x=1 grep export $(pwd) x=1 /usr/bin sed /usr/bin x=1 /usr/bin
+	grep && && $(pwd) && echo --verbose x=1 cd printf $(pwd) local printf sed
+		"$@" printf "$@" awk sed test printf then
+	-eu awk awk /usr/bin readonly --verbose && local | 'quoted text' "$1" grep
+	${HOME} /usr/bin -eu ${HOME} sed cd
+	${HOME} -eu | done local printf readonly /usr/bin readonly local 'quoted text'
+	${HOME} --verbose | | echo sed | export ${HOME} ${HOME} cd 2>/dev/null
+	export --verbose echo cd cd awk echo 'quoted text' | $(pwd) sed 'quoted text' x=1
+	x=1 sed grep ${HOME} then cd cd test
+		echo && echo "$1" then --verbose test printf
+		sed ${HOME} test echo 2>/dev/null
+		/usr/bin ${HOME} /usr/bin export 2>/dev/null printf local then
+		-eu printf readonly /usr/bin x=1 2>/dev/null -eu then --verbose cd export done
+		readonly awk /usr/bin
+&& echo -eu && $(pwd) ${HOME} then done -eu awk ${HOME} done ${HOME} 2>/dev/null
+	grep readonly grep then -eu -eu /usr/bin x=1 | readonly
+	then then | 'quoted text' /usr/bin readonly $(pwd)
+	${HOME} x=1 --verbose then x=1 && "$@" ${HOME}
+$(pwd) $(pwd) -eu done $(pwd) cd "$1"
+--verbose 2>/dev/null -eu "$@" then -eu --verbose export && "$@" awk "$@"
+		/usr/bin echo test --verbose
+	"$1" /usr/bin -eu then && sed | && 2>/dev/null printf --verbose
+readonly 'quoted text' echo ${HOME} grep echo | --verbose local
+	done printf then $(pwd) printf x=1 readonly
+test export printf then | 'quoted text' printf $(pwd) x=1 sed grep "$1" local
+awk && --verbose $(pwd) | "$@"
+'quoted text' /usr/bin grep -eu "$@" sed 2>/dev/null -eu && echo
+		x=1 'quoted text' awk export
+	x=1 echo local && $(pwd) $(pwd) 'quoted text'
+		export /usr/bin && --verbose done "$1" 2>/dev/null ${HOME} "$@" done 'quoted text'
+		done sed done sed "$1" grep awk "$@" test
+		done -eu "$1" done /usr/bin
+		readonly x=1 export 2>/dev/null sed 2>/dev/null
+	/usr/bin "$1" /usr/bin 'quoted text'
+		readonly x=1 readonly sed cd sed "$1" echo
+	echo done "$1" -eu printf $(pwd) export sed echo
+done printf grep "$1" 2>/dev/null 'quoted text' export "$1"
+done then cd then ${HOME}
+		done cd -eu export done | ${HOME} printf test ${HOME} $(pwd) "$@"
+	sed sed cd "$1" 2>/dev/null awk test -eu local /usr/bin grep
+x=1 /usr/bin awk --verbose cd echo --verbose x=1 && test 'quoted text'
+		grep ${HOME} | && grep | $(pwd) done
+-eu echo "$1" 2>/dev/null 'quoted text'
+echo then sed grep awk -eu 'quoted text'
+		&& sed -eu /usr/bin "$@"
+		export | 2>/dev/null --verbose
+local readonly --verbose "$@"
+	cd printf readonly "$1" 2>/dev/null
+		$(pwd) export "$@" export "$1" && 2>/dev/null then cd then local done local local
+"$1" "$@" awk 2>/dev/null /usr/bin
+	cd ${HOME} "$@" sed then x=1 test 'quoted text' readonly /usr/bin cd
+-eu awk 2>/dev/null then done printf 2>/dev/null /usr/bin done
+-eu | $(pwd) "$1" && done sed /usr/bin $(pwd) awk printf 2>/dev/null
+	"$@" && printf sed readonly
+	local && --verbose then then x=1 local 2>/dev/null 2>/dev/null printf $(pwd) then
+		$(pwd) local 2>/dev/null sed
+	-eu 2>/dev/null -eu "$1" test awk --verbose local export /usr/bin ${HOME}
+	local "$1" --verbose --verbose export x=1 export 2>/dev/null
+		-eu "$1" then printf local "$1" ${HOME}
+&& local echo export 'quoted text'
+		awk awk 'quoted text' export 2>/dev/null x=1 $(pwd)
+| "$1" export 2>/dev/null "$@" $(pwd) grep "$@" ${HOME}
+	${HOME} printf export sed "$1" 'quoted text' -eu export grep sed then export
+	/usr/bin x=1 grep grep awk | ${HOME}
+	local awk "$@" --verbose "$1" ${HOME}
+	awk 2>/dev/null local test done local echo sed $(pwd) x=1
+--verbose printf 'quoted text' --verbose sed && local "$@"
+		sed "$@" --verbose awk echo printf cd 'quoted text'
+	2>/dev/null printf readonly && /usr/bin cd printf test done
+"$@" 2>/dev/null export test sed && && done test local readonly awk /usr/bin
+	export 2>/dev/null awk echo -eu sed export local printf cd then sed export
+grep $(pwd) local sed readonly -eu
+		| ${HOME} awk then --verbose
+		| /usr/bin cd $(pwd) done 'quoted text' --verbose done "$1" ${HOME} "$@" readonly
+echo awk 2>/dev/null done -eu then --verbose
+	--verbose cd then --verbose printf
+		readonly printf 'quoted text' x=1 ${HOME}
+	printf $(pwd) cd export | x=1 "$@" | sed test export cd x=1 then awk
+	awk "$1" ${HOME} && --verbose
+	grep x=1 "$1" test "$@" ${HOME} printf export -eu local /usr/bin then echo
+		x=1 then test && /usr/bin export ${HOME} printf ${HOME}
+	cd /usr/bin 2>/dev/null export $(pwd)
+"$@" 2>/dev/null export export
+		echo 'quoted text' "$1" "$@" grep $(pwd) "$1" awk /usr/bin printf test
+		export echo /usr/bin && local grep 'quoted text'
+awk done echo export cd test /usr/bin readonly x=1 "$1" cd && /usr/bin printf -eu
+	readonly cd echo sed echo x=1 | grep cd /usr/bin then done "$1" x=1 test $(pwd)
+local echo && "$1" then then 2>/dev/null -eu
+		$(pwd) sed | echo cd | export readonly done test
+		--verbose "$@" /usr/bin | /usr/bin export 2>/dev/null printf && test done
+| "$1" grep "$@" awk --verbose
+		-eu x=1 export echo 'quoted text' readonly /usr/bin
+local grep awk -eu echo test --verbose echo -eu awk && done cd x=1 test printf
+'quoted text' grep | grep
+		export then then | -eu cd && | cd then sed --verbose sed "$1" echo "$1"
+"$1" /usr/bin -eu cd echo "$@" 2>/dev/null && echo test echo --verbose -eu
+x=1 readonly readonly 'quoted text' 'quoted text' "$1"
+	grep "$1" sed awk then --verbose readonly
+	test x=1 $(pwd) $(pwd) /usr/bin
+${HOME} 'quoted text' -eu export 'quoted text' echo grep
+done echo test cd && local readonly -eu |
+local cd done done x=1 awk printf && printf sed cd ${HOME}
+		sed sed printf --verbose $(pwd)
+'quoted text' 2>/dev/null
+		export local $(pwd) awk grep test readonly /usr/bin
+		"$1" grep printf local ${HOME} "$@"
+then "$1" echo x=1 "$1" ${HOME} sed "$1" 2>/dev/null "$1" "$@" 2>/dev/null
+	printf x=1 x=1 $(pwd) $(pwd) 2>/dev/null "$1" sed sed then export "$@"
+	&& 'quoted text' "$1" test printf local /usr/bin echo echo grep
+	/usr/bin then echo then 2>/dev/null x=1 /usr/bin then
+		2>/dev/null done x=1 awk done x=1 done 'quoted text'
+printf done 2>/dev/null $(pwd) cd readonly x=1 grep
+"$1" awk $(pwd) echo readonly -eu "$1" x=1 cd grep grep /usr/bin readonly
+	readonly local "$@" $(pwd) export printf | grep -eu "$1" echo ${HOME}
+	grep local local grep printf grep
+		cd export cd printf /usr/bin $(pwd)
+$(pwd) && && grep local cd | grep
+		${HOME} $(pwd) ${HOME} && done printf "$@" 'quoted text' test "$1" echo
+then 'quoted text' grep done sed
+		-eu /usr/bin --verbose sed ${HOME} export test echo sed awk printf cd "$1"
+local 'quoted text' ${HOME} | awk | local sed "$1" grep
+	readonly echo $(pwd) test cd done printf printf 'quoted text' | "$1" readonly
+	'quoted text' readonly 'quoted text' awk
+then /usr/bin awk && 2>/dev/null
+	/usr/bin grep cd test local "$1" "$1" test sed | "$1" x=1 cd local
+		then | grep test --verbose cd echo -eu printf
+		'quoted text' done export readonly printf readonly -eu cd
+done x=1 | 'quoted text' grep readonly x=1 'quoted text' sed printf /usr/bin
+		cd $(pwd) /usr/bin /usr/bin awk 2>/dev/null $(pwd) /usr/bin $(pwd) grep
+	awk x=1 x=1 local done export /usr/bin $(pwd) /usr/bin export x=1 echo export
+	printf sed x=1 | "$@" cd local test /usr/bin | "$@" printf sed
+local "$@" -eu done "$1"
+		-eu x=1 local cd awk test x=1 'quoted text'
+	'quoted text' && printf /usr/bin test "$@" awk awk 'quoted text'
+		--verbose $(pwd) x=1 awk --verbose readonly -eu readonly export then sed awk --verbose
+2>/dev/null $(pwd) awk /usr/bin done grep --verbose ${HOME} printf export
+printf awk x=1 grep /usr/bin done -eu
+		-eu $(pwd) 'quoted text' done local 'quoted text'
+test test 2>/dev/null then readonly echo awk /usr/bin 'quoted text' "$1" export
+		awk ${HOME} "$1" grep x=1
+		export ${HOME} grep readonly done cd export x=1 x=1 test sed local "$1"
+		grep grep awk export grep test && | cd grep /usr/bin -eu /usr/bin 'quoted text'
+cd && readonly $(pwd) 'quoted text' test $(pwd) export 'quoted text'
+-eu grep ${HOME} /usr/bin x=1 local $(pwd)
+		-eu awk grep sed 2>/dev/null "$@"
+	export test done sed ${HOME} sed awk echo --verbose local --verbose
+sed local 2>/dev/null echo --verbose && && echo test -eu echo grep
+	grep local awk printf done && 2>/dev/null test then
+sed "$@" done awk && /usr/bin x=1 $(pwd) /usr/bin "$1" | /usr/bin
+		readonly grep local ${HOME} --verbose
+	--verbose 'quoted text' ${HOME} $(pwd) then |
+	then then "$1" cd grep /usr/bin ${HOME} /usr/bin
+		-eu export && awk sed awk
+		"$1" --verbose sed sed export /usr/bin export local x=1 ${HOME} 'quoted text'
+x=1 printf "$@" export ${HOME} "$1" then
+	test export local ${HOME} "$@" 2>/dev/null /usr/bin $(pwd) "$@"
+"$@" grep --verbose 'quoted text' 'quoted text'
+		then echo | -eu -eu ${HOME} cd export -eu /usr/bin
+--verbose then local cd 'quoted text' echo x=1 'quoted text' readonly
+local $(pwd) test echo "$@" test echo cd | cd echo && done echo x=1 export
+		grep --verbose done /usr/bin done awk export 2>/dev/null && $(pwd)
+printf awk grep sed grep sed -eu x=1 sed done $(pwd) awk /usr/bin
+2>/dev/null --verbose awk
+	then x=1 $(pwd) 'quoted text'
+x=1 "$@" --verbose echo -eu local grep --verbose
+readonly $(pwd) 'quoted text' local --verbose ${HOME}
+		2>/dev/null grep sed cd x=1 | ${HOME} done then local --verbose
+		| --verbose x=1 --verbose | test $(pwd) test sed -eu --verbose
+		2>/dev/null echo ${HOME} -eu
+	${HOME} 'quoted text' readonly
+"$@" && grep "$@" grep --verbose sed grep "$@" export export cd ${HOME}
+	/usr/bin cd /usr/bin | local | x=1
+| sed 'quoted text' sed "$1" $(pwd)
+$(pwd) 'quoted text' $(pwd) readonly
+'quoted text' x=1 then x=1 --verbose local $(pwd) x=1 2>/dev/null
+	printf cd 2>/dev/null sed
+	awk | x=1 'quoted text' --verbose export 2>/dev/null
+		${HOME} /usr/bin | x=1 cd test export "$@" printf echo /usr/bin echo export
+2>/dev/null grep awk 'quoted text' 'quoted text' readonly readonly printf x=1 |
+"$1" "$@" local 2>/dev/null
+x=1 grep ${HOME} 2>/dev/null
+	${HOME} --verbose sed then test && $(pwd) ${HOME} done printf /usr/bin "$@" sed
+	${HOME} ${HOME} "$@" sed
+		done x=1 $(pwd) grep awk 2>/dev/null
+		&& sed x=1 --verbose && 2>/dev/null readonly export
+		printf "$@" sed ${HOME} 2>/dev/null
+		done done test echo "$1" | printf -eu "$1" export test done
+	${HOME} cd grep $(pwd) "$@"
+		${HOME} printf --verbose /usr/bin readonly printf
+	2>/dev/null local export cd 'quoted text' 'quoted text'
+'quoted text' $(pwd) test test export readonly printf then grep && && 2>/dev/null
+${HOME} grep ${HOME} readonly x=1
+readonly readonly ${HOME} sed --verbose printf | 'quoted text' printf then
+		readonly 2>/dev/null grep x=1 test then "$@" 2>/dev/null sed export $(pwd)
+/usr/bin local echo | done done -eu x=1
+printf ${HOME} ${HOME} $(pwd)
+$(pwd) "$@" echo cd "$@" /usr/bin x=1 cd x=1 "$@"
+export --verbose | done 2>/dev/null
+		done 2>/dev/null $(pwd) awk sed | printf export grep ${HOME} $(pwd) echo
+		cd echo printf x=1 printf cd "$@" local && export test sed /usr/bin
+		&& ${HOME} readonly x=1 awk "$@" $(pwd) x=1 && cd --verbose $(pwd) awk
+	-eu echo /usr/bin echo done
+		x=1 test -eu echo printf grep sed echo 'quoted text'
+		$(pwd) 2>/dev/null /usr/bin sed export grep cd
+	local "$@" /usr/bin grep sed readonly readonly
+	$(pwd) cd /usr/bin then printf grep cd
+		$(pwd) readonly "$@" test /usr/bin /usr/bin test /usr/bin
+		x=1 test $(pwd) "$1" | -eu grep 'quoted text' /usr/bin
+		done | | sed 'quoted text' printf awk cd
+--verbose local done echo done cd -eu /usr/bin x=1 2>/dev/null cd cd readonly
+	'quoted text' export done awk 'quoted text' echo test ${HOME} | $(pwd) 2>/dev/null
+	$(pwd) 'quoted text' printf | printf cd cd ${HOME}
+	cd done 2>/dev/null sed 'quoted text' readonly echo | ${HOME} -eu awk | &&
+awk && /usr/bin ${HOME} $(pwd) 2>/dev/null awk sed printf && | awk /usr/bin 2>/dev/null
+		${HOME} then export done export readonly x=1 "$1"
+${HOME} readonly local 2>/dev/null cd "$@" cd then local x=1 ${HOME} test && local
+	"$@" x=1 $(pwd) -eu --verbose echo export awk export ${HOME} printf test
+		echo | done sed /usr/bin /usr/bin then ${HOME} printf
+		printf cd grep readonly readonly "$@" then $(pwd) then ${HOME}
+&& 'quoted text' printf $(pwd) sed cd done | x=1 "$1" x=1 readonly sed
+		/usr/bin $(pwd) test test | "$1"
+	done && 2>/dev/null printf && then $(pwd) cd /usr/bin ${HOME} grep readonly
+$(pwd) export cd "$1" && x=1 grep readonly test test done /usr/bin -eu export
+	"$@" /usr/bin -eu 'quoted text' local --verbose -eu 'quoted text'
+grep "$1" --verbose "$@" cd
+	&& 2>/dev/null 2>/dev/null x=1 echo awk
+	echo ${HOME} 2>/dev/null echo
+		2>/dev/null awk grep $(pwd) "$@" $(pwd) $(pwd) echo test readonly 2>/dev/null
+	'quoted text' echo test x=1 readonly
+		done x=1 $(pwd) echo done then /usr/bin "$@" printf
+	| x=1 ${HOME} grep readonly
+awk cd /usr/bin | grep printf then echo x=1 sed x=1 echo 2>/dev/null readonly
+		x=1 export then --verbose test && local ${HOME} "$@" export export done
+		awk -eu then --verbose -eu 'quoted text' "$1"
+		cd "$1" && sed --verbose printf readonly echo local -eu test then
+-eu sed | then grep test x=1 ${HOME} grep then
+	'quoted text' "$1" sed "$@" then x=1 2>/dev/null sed /usr/bin /usr/bin awk awk
+'quoted text' grep export done 2>/dev/null "$1"
+grep --verbose export -eu | -eu test 'quoted text'
+| x=1 then 'quoted text'
+	"$1" $(pwd) sed "$@" --verbose export $(pwd) export /usr/bin
+then $(pwd) x=1 test local $(pwd) | --verbose 'quoted text'
+		grep grep x=1 $(pwd) -eu cd /usr/bin $(pwd) then test 'quoted text'
+	| export "$@" test ${HOME} test --verbose printf test "$@"
+		--verbose export 2>/dev/null "$1" --verbose /usr/bin
+		x=1 "$@" --verbose "$1" printf grep echo export 2>/dev/null -eu
+&& local && done 2>/dev/null x=1 --verbose awk readonly -eu grep --verbose
+		${HOME} echo "$1" 'quoted text' 2>/dev/null awk export -eu $(pwd)
+		printf --verbose $(pwd) && && --verbose
+"$1" echo readonly printf /usr/bin local
+test cd printf grep readonly 2>/dev/null printf export
+		local 'quoted text' readonly --verbose
+		-eu "$1" printf sed 2>/dev/null --verbose done grep printf
+cd awk cd $(pwd) | | $(pwd) echo then --verbose
+	export ${HOME} 'quoted text' grep && echo "$1" --verbose readonly && x=1
+--verbose cd -eu && x=1 /usr/bin
+		readonly $(pwd) 'quoted text' | sed --verbose | "$@" test x=1 sed "$@"
+sed then done && | && ${HOME} awk 2>/dev/null test then local
+'quoted text' done cd ${HOME} done sed && -eu | x=1 'quoted text'
+${HOME} awk then sed grep grep
+grep 'quoted text' -eu | then 2>/dev/null
+awk 2>/dev/null readonly done 2>/dev/null --verbose x=1 sed printf
+		/usr/bin readonly printf readonly printf test x=1 && readonly local done
+	readonly echo echo export export echo local $(pwd) -eu ${HOME} cd ${HOME} | printf
+	&& "$@" grep test "$@" /usr/bin
+	&& cd /usr/bin "$@" /usr/bin ${HOME} | then ${HOME}
+	printf export x=1 x=1 --verbose --verbose --verbose
+		printf local "$1" done | 2>/dev/null
+	grep "$@" "$@" "$1" && && cd cd readonly test awk /usr/bin then then
+	'quoted text' cd x=1 --verbose sed | local x=1 ${HOME} awk
+	2>/dev/null x=1 sed then --verbose "$@" -eu then echo | readonly
+		export 2>/dev/null 2>/dev/null
+awk test export && && then
+$(pwd) -eu local /usr/bin echo sed export $(pwd) then
+${HOME} readonly readonly "$@" export /usr/bin sed printf
+		cd sed && -eu "$@" done ${HOME} readonly
+$(pwd) cd awk 2>/dev/null --verbose awk export x=1 done 2>/dev/null then
+		"$@" --verbose 2>/dev/null sed readonly done && ${HOME} awk then
+		/usr/bin awk local grep --verbose 2>/dev/null awk sed
+		readonly "$@" test sed sed
+	then awk "$1" x=1 then printf cd export export | cd "$@" done echo
+grep $(pwd) 'quoted text' echo local x=1 grep x=1 && export /usr/bin
+awk -eu 2>/dev/null cd "$1" $(pwd) 'quoted text' "$1" $(pwd) $(pwd) |
+/usr/bin done --verbose
+	readonly ${HOME} printf awk echo test done 2>/dev/null 'quoted text'
+	&& readonly $(pwd) | local
+		test cd sed awk 2>/dev/null | && $(pwd) export
+	then cd x=1 grep local then && readonly
+	grep cd "$1" 'quoted text' test cd local -eu /usr/bin readonly 'quoted text'
+	test | -eu "$@" done then export test awk | $(pwd) x=1 done $(pwd) x=1 printf
+echo "$1" readonly $(pwd)
+	cd grep -eu then -eu | | test "$@" local local readonly echo readonly
+cd done local then -eu "$1" cd
+done $(pwd) sed sed /usr/bin --verbose
+then sed readonly test export readonly "$@"
+	${HOME} -eu --verbose sed grep sed 'quoted text' cd
+		2>/dev/null x=1 $(pwd) | x=1 awk /usr/bin local readonly then
+	-eu done | 'quoted text' awk 'quoted text' --verbose then
+		then -eu ${HOME} ${HOME} "$@" 'quoted text'
+		printf /usr/bin grep readonly && && export --verbose $(pwd) ${HOME}
+		"$1" sed cd && --verbose /usr/bin
+&& "$1" | -eu readonly then echo x=1 grep readonly
+		printf test ${HOME} $(pwd) "$@" readonly readonly
+	"$@" 2>/dev/null 2>/dev/null -eu 2>/dev/null echo
+	local $(pwd) | 'quoted text' printf 2>/dev/null printf local echo grep 2>/dev/null
+	export readonly | --verbose ${HOME} local test ${HOME} echo ${HOME} cd 2>/dev/null
+	echo ${HOME} "$@" $(pwd) 2>/dev/null test test
+grep $(pwd) "$@" -eu cd && local
+	&& sed sed $(pwd) "$1" awk "$1" echo awk test | sed grep grep local /usr/bin readonly
+done done echo local awk | "$@" | printf $(pwd) sed then -eu test 2>/dev/null
+$(pwd) echo ${HOME} done -eu export readonly "$1" echo export
+"$1" "$@" 'quoted text' 2>/dev/null awk echo cd export cd && -eu awk
+done local "$@" grep && 'quoted text' grep awk test done 2>/dev/null test $(pwd)
+		local printf "$@" printf 2>/dev/null printf
+echo x=1 test && -eu 2>/dev/null sed
+		"$@" && && --verbose grep done x=1 'quoted text' 'quoted text'
+	awk --verbose --verbose "$@" x=1 grep x=1
+	$(pwd) awk printf | test && grep x=1 readonly "$@" && /usr/bin | then sed export
+${HOME} sed "$1" readonly grep printf
+then echo ${HOME} /usr/bin export -eu test | x=1
+awk --verbose then readonly printf echo printf cd /usr/bin sed -eu
+then awk ${HOME} x=1 then $(pwd) -eu readonly done readonly
+		/usr/bin done awk then --verbose "$@" ${HOME} readonly cd done
+	&& printf readonly grep printf test done export cd local -eu readonly --verbose
+		readonly then readonly --verbose | | -eu local
+		$(pwd) local -eu printf -eu then readonly then printf readonly $(pwd)
+	grep grep $(pwd) printf
+		readonly cd sed /usr/bin
+		--verbose printf 2>/dev/null
+printf && export test readonly --verbose x=1
+local readonly export echo then
+		--verbose -eu export --verbose export | ${HOME} "$@" x=1
+		${HOME} 2>/dev/null 2>/dev/null | local /usr/bin 'quoted text'
+		--verbose printf sed sed $(pwd) grep | 2>/dev/null sed
+sed local /usr/bin test /usr/bin --verbose cd && $(pwd) "$1" 'quoted text'
+awk grep --verbose -eu echo --verbose $(pwd)
+		echo "$@" ${HOME} sed sed readonly awk awk done grep readonly readonly
+printf sed 'quoted text' -eu 'quoted text' grep --verbose
+2>/dev/null test ${HOME} then test printf "$1" grep
+	2>/dev/null echo echo x=1 echo local -eu
+	local done then "$@" then done x=1 /usr/bin cd local ${HOME} export
+	sed $(pwd) grep -eu -eu cd "$@" /usr/bin test export && 2>/dev/null --verbose
+	grep then x=1 && test ${HOME} cd --verbose awk /usr/bin --verbose grep -eu then
+		${HOME} --verbose export
+	export export /usr/bin x=1 --verbose awk export then 2>/dev/null
+	local sed sed echo grep then && --verbose printf --verbose | cd printf
+		sed readonly then --verbose
+	"$@" done -eu local readonly
+		readonly "$1" --verbose && --verbose --verbose /usr/bin grep
+sed "$@" echo "$1" test $(pwd) echo sed --verbose x=1 ${HOME}
+	printf test printf awk | "$@" x=1 2>/dev/null grep "$@" printf "$@" $(pwd)
+	cd "$@" 'quoted text' printf readonly
+		awk "$1" "$1" test "$@" "$@" awk local --verbose
+	$(pwd) grep readonly awk "$@" local
+	'quoted text' $(pwd) -eu "$1" $(pwd) 'quoted text' && -eu grep -eu "$@" "$@"
+		'quoted text' "$1" awk $(pwd) "$@"
+		local local | ${HOME} | && sed export local grep export -eu |
+	2>/dev/null /usr/bin test echo $(pwd) grep "$@"
+		--verbose then grep readonly readonly test 'quoted text' --verbose
+	sed /usr/bin "$@" done | 2>/dev/null awk ${HOME} awk --verbose
+		"$1" cd printf "$@" awk
+		/usr/bin -eu echo cd done ${HOME} && -eu echo then | local
+		cd then sed local "$1" then 2>/dev/null $(pwd) /usr/bin
+		export --verbose ${HOME} 'quoted text'
+	echo test then -eu echo export grep awk /usr/bin awk x=1 | then export --verbose
+		2>/dev/null echo "$1" 'quoted text' readonly echo cd cd x=1 sed && printf then
+		then awk "$1" -eu printf /usr/bin grep then | --verbose cd | readonly
+done /usr/bin x=1 /usr/bin | grep /usr/bin 'quoted text'
+| && echo $(pwd) export awk test
+	echo export awk readonly done | echo "$@" cd cd 2>/dev/null printf grep
+		x=1 awk x=1 "$@" grep local $(pwd) | -eu "$1" $(pwd) readonly 2>/dev/null
+	export | awk readonly ${HOME} $(pwd)
+x=1 && echo x=1 test grep cd cd "$@" ${HOME} 2>/dev/null "$1" awk
+	${HOME} "$1" 'quoted text' 'quoted text' 2>/dev/null
+| sed -eu test "$1" "$1"
+		readonly awk ${HOME} echo && x=1
+		'quoted text' sed && cd sed 'quoted text' 'quoted text'
+printf then -eu "$@" 2>/dev/null | awk x=1 export ${HOME}
+		done | cd printf "$@" local readonly /usr/bin
+${HOME} grep 2>/dev/null export then sed sed /usr/bin ${HOME} export $(pwd)
+	$(pwd) && "$@" then echo grep | ${HOME} $(pwd) then x=1
+	test -eu /usr/bin then export
+	awk $(pwd) cd /usr/bin
+		'quoted text' 2>/dev/null
+printf | export grep 2>/dev/null
+		then $(pwd) /usr/bin 'quoted text' 2>/dev/null ${HOME} | | awk done done cd
+		"$@" export printf cd export then grep export test grep local
+		grep export awk local "$@" cd readonly | grep readonly -eu
+"$1" readonly ${HOME} echo
+x=1 && cd echo local readonly | "$@" --verbose x=1 --verbose
+sed x=1 x=1 $(pwd) local cd --verbose readonly test 2>/dev/null done 'quoted text'
+		local awk readonly cd cd /usr/bin 2>/dev/null x=1 2>/dev/null 2>/dev/null
+then local export test x=1 printf local printf printf ${HOME}
+		${HOME} --verbose echo awk cd "$@" "$@" && grep --verbose 2>/dev/null
+		done export && grep then 'quoted text'
+		${HOME} test awk local "$@" 'quoted text'
+	&& export local ${HOME}
+		$(pwd) "$1" $(pwd) "$@" cd
+awk 'quoted text' ${HOME} x=1 "$1" awk
+		"$1" $(pwd) "$@" ${HOME}
+	--verbose then x=1 done "$@" 'quoted text' printf 'quoted text'
+		--verbose sed && x=1 --verbose grep done ${HOME} | | awk local && test done
+	--verbose --verbose && done echo 'quoted text' x=1 'quoted text'
+		local done awk "$1" 2>/dev/null grep /usr/bin $(pwd) done readonly -eu -eu &&
+	readonly sed | local test x=1 x=1 printf "$1" awk --verbose
+printf grep sed "$1" sed x=1 echo sed $(pwd) export printf "$@" echo grep echo
+readonly readonly printf /usr/bin
+	| 2>/dev/null done grep /usr/bin
+		${HOME} 'quoted text' --verbose done printf ${HOME} export export
+| -eu x=1 /usr/bin echo /usr/bin export /usr/bin x=1
+then && local awk local local "$1" "$@" | x=1 && readonly --verbose echo
+		$(pwd) awk printf local local grep -eu x=1 awk test
+		printf "$1" grep /usr/bin && test
+		2>/dev/null echo test -eu "$@"
+		readonly "$1" local -eu awk awk | grep export sed x=1 local test &&
+		done test export echo export done export cd awk --verbose "$1"
+test 'quoted text' $(pwd) local printf echo
+sed export "$@" "$1" x=1 done cd 'quoted text' sed export local --verbose
+		awk | done sed 2>/dev/null then -eu printf sed then -eu
+readonly -eu cd then test then ${HOME} "$@" done echo cd grep x=1 && ${HOME}
+	&& "$@" $(pwd) done readonly "$1" cd awk local sed printf 'quoted text' readonly
+	| printf readonly readonly
+		echo && "$1" readonly sed awk grep "$@" /usr/bin
+		awk && -eu 2>/dev/null "$1" test --verbose
+		readonly "$1" grep && sed $(pwd) echo done /usr/bin printf
+	then x=1 export 2>/dev/null x=1 "$@" grep ${HOME} -eu | "$@" test
+		${HOME} then awk cd readonly echo printf done echo
+/usr/bin awk 'quoted text' echo | readonly then "$1" export export /usr/bin
+/usr/bin echo ${HOME} local x=1
+	${HOME} test then done ${HOME} echo "$1" sed -eu readonly cd sed then /usr/bin
+		| awk x=1 printf cd done export 2>/dev/null -eu 2>/dev/null
+		&& readonly && echo printf echo $(pwd) done local grep x=1 grep grep
+	$(pwd) local readonly cd 'quoted text' /usr/bin /usr/bin x=1
+awk && awk ${HOME} 2>/dev/null $(pwd) -eu "$@" sed sed "$1" awk export
+	done /usr/bin ${HOME} /usr/bin x=1
+done $(pwd) grep export
+		done "$1" "$1" printf
+'quoted text' export x=1 $(pwd) printf x=1 -eu --verbose
+-eu "$1" local sed 'quoted text' cd /usr/bin export test grep cd printf export
+"$@" sed then x=1 done 2>/dev/null -eu &&
+		export $(pwd) done --verbose ${HOME} done 'quoted text' echo cd | done sed
+	grep $(pwd) readonly && --verbose printf
+	| $(pwd) local --verbose -eu export test | "$1" | export then
+	awk then test "$@" cd readonly test sed then && $(pwd)
+		"$@" readonly 'quoted text' --verbose
+	| printf -eu grep "$@" readonly printf /usr/bin local export
+	cd && awk printf grep "$1" local echo --verbose
+	test awk 'quoted text' 'quoted text' grep x=1 | cd echo $(pwd) /usr/bin
+	printf && local /usr/bin local ${HOME} test awk --verbose cd then
+	sed x=1 "$1" "$1" echo
+	--verbose x=1 test 2>/dev/null /usr/bin | export
+	"$@" printf $(pwd) | /usr/bin done awk 2>/dev/null "$1" $(pwd) --verbose
+printf 'quoted text' grep | done
+awk test done 2>/dev/null then echo sed /usr/bin /usr/bin
+then awk && --verbose && local readonly ${HOME}
+	'quoted text' done echo | sed x=1 x=1 then | awk sed echo printf && 'quoted text'
+		-eu echo "$@" ${HOME} awk grep -eu echo then 2>/dev/null
+done then x=1 "$1" 2>/dev/null test &&
+	local export /usr/bin "$1" 2>/dev/null grep x=1 local printf 2>/dev/null
+"$@" ${HOME} --verbose echo local -eu test /usr/bin
+	x=1 --verbose echo && "$@" --verbose awk $(pwd) grep export
+		/usr/bin -eu grep readonly --verbose | awk 2>/dev/null
+	${HOME} echo -eu sed -eu ${HOME} -eu then 2>/dev/null "$1" grep printf
+	test $(pwd) done x=1 2>/dev/null /usr/bin
+'quoted text' awk test x=1 2>/dev/null sed printf | ${HOME} && ${HOME}
+		readonly echo /usr/bin "$1" /usr/bin
+printf | "$1" /usr/bin /usr/bin then "$1" 2>/dev/null printf -eu then
+		test cd cd awk 'quoted text' && $(pwd)
+"$@" /usr/bin "$1" | printf ${HOME} "$@" sed --verbose
+	grep local readonly readonly x=1 ${HOME} "$1" ${HOME} grep then
+	local /usr/bin ${HOME} grep awk cd export |
+'quoted text' 'quoted text' echo test "$1" local ${HOME} awk
+"$1" x=1 x=1 readonly local -eu -eu "$1" && 2>/dev/null echo "$1"
+		export --verbose awk sed awk sed x=1 --verbose sed -eu awk
+		x=1 test --verbose cd sed export printf && /usr/bin grep -eu "$1"
+	awk export ${HOME} grep then printf local
+awk "$@" export ${HOME} | printf x=1 "$1" 2>/dev/null "$1" "$1"
+--verbose /usr/bin grep cd x=1 2>/dev/null test export export done local
+	'quoted text' done /usr/bin sed --verbose
+		sed | then x=1 | cd cd then grep /usr/bin "$@"
+	| then printf /usr/bin "$1" "$1" then | cd cd --verbose
+	readonly local grep && cd then awk | echo awk test -eu |
+	$(pwd) x=1 ${HOME} "$1" 2>/dev/null x=1 'quoted text'
+	test printf && /usr/bin x=1 $(pwd) --verbose local local cd $(pwd)
+local && cd done sed done --verbose test --verbose "$1" grep
+	test "$@" echo cd local "$@" grep local grep "$1" grep
+	-eu --verbose ${HOME} | export x=1
+		printf cd readonly grep 2>/dev/null
+/usr/bin local 'quoted text'
+	$(pwd) readonly /usr/bin
+"$1" export then -eu "$1" sed test
+	awk done -eu | readonly
+"$@" test awk grep | done "$1" sed export local then
+	2>/dev/null local $(pwd) echo sed "$1" then printf
+	&& "$@" awk && done test --verbose test cd cd
+	/usr/bin test grep printf
+&& x=1 grep -eu test readonly awk
+	"$@" readonly awk readonly test $(pwd) readonly -eu x=1 export x=1
+		export printf --verbose 2>/dev/null
+	$(pwd) cd sed -eu local
+readonly echo $(pwd) 'quoted text'
+	| cd sed 'quoted text' 'quoted text' ${HOME} echo test export | printf "$@" --verbose
+	local grep sed --verbose sed 'quoted text' "$@" --verbose 2>/dev/null awk -eu
+	-eu "$1" | export /usr/bin printf
+$(pwd) && | grep cd --verbose export printf cd | export
+	x=1 test cd echo "$1"
+		echo ${HOME} --verbose printf $(pwd) --verbose && printf 'quoted text'
+		then --verbose "$1" export printf
+	x=1 ${HOME} local local cd 2>/dev/null && ${HOME} "$1" "$@" /usr/bin
+x=1 "$@" then grep readonly export 'quoted text' awk cd 2>/dev/null x=1
+		"$1" awk then -eu && printf x=1 | --verbose --verbose ${HOME} sed
+		2>/dev/null ${HOME} done /usr/bin then | 'quoted text'
+		--verbose then cd /usr/bin | export test awk export 2>/dev/null
+local --verbose -eu grep test --verbose
+	sed --verbose awk && export awk /usr/bin echo "$@" "$@" readonly x=1 cd -eu
+	x=1 2>/dev/null readonly echo readonly done
+	/usr/bin "$1" readonly && ${HOME} test readonly
+	done $(pwd) cd "$@" test "$1" awk | && local "$@" printf then
+	$(pwd) sed | x=1 test x=1 && local
+		-eu x=1 local cd grep 'quoted text' --verbose
+	awk 2>/dev/null /usr/bin readonly --verbose sed /usr/bin printf
+${HOME} printf printf then cd $(pwd) grep then export -eu
+		x=1 x=1 2>/dev/null $(pwd) readonly "$1" test "$1" -eu "$@" "$1" "$@" --verbose
+	awk export "$@" && local export
+	grep x=1 x=1 | local 2>/dev/null "$1" done 'quoted text' awk sed
+printf test local printf 'quoted text' 'quoted text' test printf -eu 'quoted text'
+test $(pwd) /usr/bin -eu awk | sed $(pwd)
+		then $(pwd) echo echo done --verbose export | readonly grep ${HOME}
+		readonly echo "$@" cd 2>/dev/null -eu then awk awk |
+		| test ${HOME} then 'quoted text' grep 2>/dev/null printf grep
+	'quoted text' export local cd local x=1 'quoted text'
+readonly done 'quoted text' 2>/dev/null
+readonly "$1" && /usr/bin done $(pwd) grep
+--verbose | grep done awk ${HOME} && /usr/bin -eu test test export
+echo "$1" cd then export | cd -eu -eu "$1" cd
+		readonly printf cd local | "$1" "$1" "$@" sed done export export
+"$@" printf done cd cd
+		local then sed echo readonly export export then "$@" x=1 export "$@" "$@" "$@"
+$(pwd) local test 2>/dev/null
+		'quoted text' cd grep 2>/dev/null 2>/dev/null -eu -eu
+		/usr/bin grep export 2>/dev/null 'quoted text' -eu -eu test awk "$1" echo awk
+'quoted text' done local "$@" test |
+		${HOME} cd cd /usr/bin test
+awk export "$@" "$1" test done /usr/bin local | "$1" sed ${HOME} local
+cd ${HOME} ${HOME} readonly done export
+		then 2>/dev/null awk --verbose
+		"$1" 2>/dev/null awk -eu done sed 'quoted text' cd $(pwd) 'quoted text'
+	test "$1" printf 2>/dev/null done
+		$(pwd) printf 'quoted text' && --verbose
+	echo --verbose then export
+$(pwd) "$1" 'quoted text' then x=1 done --verbose
+	awk x=1 local "$@" sed sed export awk
+	echo --verbose $(pwd) test done "$1" $(pwd) $(pwd) 'quoted text'
+		done export export $(pwd) | then
+	grep printf 'quoted text' x=1 readonly "$1"
+		awk 'quoted text' sed test && /usr/bin
+		test | done x=1 local test echo local cd then
+x=1 "$1" 2>/dev/null printf cd /usr/bin cd then sed
+echo $(pwd) "$@" sed done echo "$1" --verbose "$1" --verbose 'quoted text'
+	readonly 2>/dev/null "$@" --verbose
+	echo echo awk grep printf "$@"
+	then --verbose then grep sed /usr/bin $(pwd) /usr/bin awk grep export sed then done
+	echo 2>/dev/null x=1 x=1 | 2>/dev/null export "$1" && "$@" then
+2>/dev/null echo ${HOME} $(pwd) $(pwd)
+		'quoted text' echo grep
+		"$1" 'quoted text' "$@" then echo --verbose 2>/dev/null export
+${HOME} done "$1" awk 'quoted text' -eu x=1 x=1 cd
+	echo --verbose sed "$1" grep readonly |
+readonly --verbose x=1 | sed 'quoted text' -eu echo 'quoted text' 'quoted text'
+test && readonly cd $(pwd) $(pwd)
+		grep local 2>/dev/null
+--verbose 'quoted text' ${HOME} readonly
+		'quoted text' "$1" && done sed readonly && local awk
+awk -eu grep "$1" echo then --verbose sed "$1" --verbose printf done
+		readonly x=1 test grep cd cd test done | done done "$1" /usr/bin ${HOME} sed
+		-eu "$@" done /usr/bin $(pwd) $(pwd) ${HOME} --verbose
+	/usr/bin x=1 ${HOME} 2>/dev/null ${HOME} 2>/dev/null && 'quoted text' readonly
+	then --verbose -eu readonly && done $(pwd) 2>/dev/null ${HOME} x=1
+	local cd local && $(pwd) done /usr/bin export --verbose
+		"$1" | readonly readonly ${HOME} -eu export 'quoted text' 'quoted text' echo sed
+	&& test local "$1" readonly awk && && done 'quoted text'
@@ -0,0 +1,2001 @@
+-eu "$1" $(pwd) done ${HOME} printf test "$@" local cd ${HOME} 2>/dev/null
+'quoted text' "$@" sed export local /usr/bin then "$1" 'quoted text' done 'quoted text'
+		'quoted text' --verbose
+	export test -eu done then test printf local test
+	cd local | done printf readonly
+&& 'quoted text' 2>/dev/null $(pwd)
+	/usr/bin -eu test sed | then awk /usr/bin --verbose "$@" test -eu
+	grep local readonly && export cd local
+	$(pwd) done | && printf --verbose awk x=1
+		cd printf then 2>/dev/null export -eu "$1" local export
+		| echo "$@" "$1" 'quoted text' "$1" ${HOME} cd "$1" | /usr/bin readonly
+	local grep export sed sed sed "$@" echo x=1 done local $(pwd)
+awk /usr/bin done test done echo "$1" readonly
+		cd awk export -eu x=1 x=1 x=1 -eu --verbose done "$1" 'quoted text'
+	grep readonly printf "$1" echo ${HOME}
+		awk printf -eu $(pwd) export && then x=1 cd | done export
+$(pwd) then cd local 2>/dev/null echo grep test 2>/dev/null ${HOME} x=1 echo
+		2>/dev/null then && sed && "$1"
+	2>/dev/null sed grep echo && 'quoted text'
+local /usr/bin export "$1" "$1" then 'quoted text' local "$@" echo
+	| awk && 'quoted text' sed x=1 awk test then local printf sed readonly grep test
+test $(pwd) 'quoted text' --verbose cd awk
+	echo $(pwd) "$1" "$1" grep 'quoted text' 2>/dev/null awk cd
+	readonly && -eu "$1" -eu cd /usr/bin
+		sed local /usr/bin -eu then test test export cd echo
+	| 'quoted text' echo export
+		grep cd readonly /usr/bin sed "$1" export grep
+-eu $(pwd) 2>/dev/null 'quoted text' sed | printf
+grep && && then done | 2>/dev/null sed readonly 2>/dev/null
+	done sed 2>/dev/null cd printf -eu "$1" | grep then "$1" x=1 readonly done
+	| 'quoted text' cd sed "$@" ${HOME} export | -eu -eu local
+	$(pwd) && /usr/bin | "$1" test
+		'quoted text' cd readonly x=1 && 'quoted text' "$1"
+done local && then | awk local done sed awk test test test --verbose
+	readonly "$1" 2>/dev/null echo "$1" -eu --verbose ${HOME} -eu $(pwd) /usr/bin
+	export x=1 cd && sed local
+	cd printf awk export --verbose grep -eu then
+		then "$@" then printf test export x=1 'quoted text'
+	"$1" then /usr/bin grep then 2>/dev/null awk sed printf sed 2>/dev/null
+	echo 'quoted text' 2>/dev/null local echo local then cd --verbose
+		echo x=1 echo | x=1 ${HOME} $(pwd) ${HOME} then --verbose x=1 | x=1 "$@"
+/usr/bin sed ${HOME} | 2>/dev/null export -eu | sed | /usr/bin
+		-eu ${HOME} test sed sed $(pwd) "$@" x=1 --verbose
+	2>/dev/null -eu then -eu readonly "$@" cd ${HOME} then ${HOME} $(pwd) --verbose
+	2>/dev/null cd /usr/bin -eu sed awk ${HOME} 'quoted text'
+	awk awk /usr/bin awk "$@" awk readonly -eu /usr/bin
+'quoted text' "$@" export then && test -eu cd then
+	local "$1" $(pwd) ${HOME} "$1" "$1" awk $(pwd) x=1 grep then --verbose sed export
+	2>/dev/null readonly $(pwd) then "$1" -eu "$1" echo done --verbose x=1 "$1" awk
+	echo export "$@" /usr/bin $(pwd)
+		"$1" readonly grep awk x=1 export then grep cd ${HOME} local 'quoted text' 'quoted text'
+		local /usr/bin x=1 printf | printf
+		printf cd cd readonly 2>/dev/null $(pwd) then
+	/usr/bin "$1" test done echo
+grep 2>/dev/null /usr/bin --verbose ${HOME} $(pwd) -eu local
+		grep 'quoted text' -eu -eu -eu ${HOME} $(pwd) | 'quoted text'
+		$(pwd) grep readonly "$@" && "$1" 'quoted text' sed cd done $(pwd) | echo
+	echo awk $(pwd) readonly "$@" cd then /usr/bin test done readonly printf cd
+	awk export 'quoted text' ${HOME} test /usr/bin local "$1" ${HOME}
+		-eu "$1" | test && sed && then sed
+cd 'quoted text' --verbose 'quoted text' echo cd printf echo --verbose readonly
+/usr/bin $(pwd) --verbose printf
+		readonly "$1" then awk cd sed awk local "$@" done cd -eu cd printf then x=1 export
+		readonly echo done cd printf grep x=1
+printf sed sed "$@" ${HOME} cd then done done -eu
+		then "$1" grep && readonly "$1" readonly then grep "$1"
+	export "$1" local done done
+	'quoted text' echo ${HOME}
+	test -eu echo done then /usr/bin
+sed cd export 2>/dev/null export -eu 'quoted text' export local $(pwd) -eu
+awk local $(pwd) done 2>/dev/null cd test $(pwd)
+		'quoted text' printf /usr/bin done 'quoted text'
+	export readonly 2>/dev/null sed sed ${HOME} | cd local 2>/dev/null
+-eu local 2>/dev/null "$1" sed ${HOME} && | readonly 2>/dev/null
+	printf cd "$@" done -eu done echo "$1" done $(pwd) x=1 'quoted text'
+		sed test echo sed done --verbose export /usr/bin ${HOME} "$1" done /usr/bin
+		printf echo echo ${HOME} cd sed export && export grep
+printf ${HOME} $(pwd) cd x=1 "$1" sed readonly cd 'quoted text'
+	"$@" /usr/bin | $(pwd) echo "$@" echo
+local awk "$@" "$1" sed | /usr/bin "$1" awk test printf printf
+	/usr/bin "$1" export printf $(pwd) readonly $(pwd) cd readonly export 'quoted text'
+		"$1" export done 2>/dev/null
+	| cd sed done printf /usr/bin /usr/bin local
+	| readonly --verbose sed sed ${HOME} export 2>/dev/null
+readonly 2>/dev/null echo
+	-eu "$1" | local x=1 && readonly
+		$(pwd) x=1 printf printf
+-eu cd local local grep then "$@" && $(pwd) echo
+	--verbose export /usr/bin local $(pwd) x=1
+"$@" x=1 cd 2>/dev/null cd grep readonly | echo export local
+	"$@" "$@" awk --verbose /usr/bin 'quoted text'
+printf | && grep /usr/bin ${HOME} export test local readonly printf "$@" --verbose
+		x=1 echo printf export && cd readonly 'quoted text' -eu sed --verbose
+	"$1" x=1 -eu then echo test /usr/bin
+${HOME} local ${HOME} echo then -eu done readonly ${HOME} && $(pwd)
+		cd ${HOME} /usr/bin grep -eu cd $(pwd) 'quoted text' x=1
+	awk && local echo x=1 export awk cd local 'quoted text' 'quoted text' x=1 2>/dev/null
+	&& --verbose | echo --verbose local
+		echo | ${HOME} "$@" then 2>/dev/null x=1 && $(pwd)
+	then sed cd local done ${HOME}
+	echo local $(pwd) | cd
+"$1" cd sed printf $(pwd) grep readonly cd /usr/bin /usr/bin
+		"$1" /usr/bin printf -eu "$@" printf awk --verbose ${HOME} /usr/bin
+		${HOME} -eu -eu x=1 echo
+/usr/bin "$@" awk && | done "$@" test local &&
+x=1 $(pwd) done && ${HOME} then printf awk then readonly
+	echo /usr/bin $(pwd) -eu ${HOME} "$1"
+	'quoted text' 'quoted text' awk export --verbose local
+	local then test ${HOME} 'quoted text' $(pwd) printf 'quoted text'
+		sed "$1" cd 'quoted text' test then 2>/dev/null test
+		then awk && done /usr/bin printf 'quoted text'
+	x=1 grep "$@" "$@" ${HOME} done done && /usr/bin
+	'quoted text' grep sed export 2>/dev/null awk test sed | 2>/dev/null test
+	readonly /usr/bin && /usr/bin --verbose ${HOME} 'quoted text'
+		'quoted text' then && /usr/bin test sed x=1 readonly printf local
+	x=1 ${HOME} | cd done && sed readonly echo then &&
+local then -eu 2>/dev/null
+local | 2>/dev/null x=1 "$1"
+		"$1" grep printf --verbose done readonly ${HOME} 'quoted text'
+		x=1 ${HOME} "$1" sed | export "$@" $(pwd) /usr/bin
+	awk sed readonly --verbose ${HOME} test "$1" x=1 /usr/bin local
+		then 'quoted text' && | cd export then awk ${HOME} "$@" ${HOME} -eu
+	then && "$1" "$1" x=1 export export
+		echo ${HOME} --verbose printf local $(pwd)
+grep $(pwd) | echo x=1 /usr/bin test readonly done ${HOME} -eu grep "$@"
+then $(pwd) echo awk echo done 2>/dev/null --verbose echo echo
+		| awk | --verbose readonly done export then sed readonly
+/usr/bin x=1 && awk ${HOME} local 'quoted text' grep local echo echo awk "$1" --verbose
+		printf ${HOME} | readonly printf sed then $(pwd) | && cd -eu readonly
+	--verbose && then | export "$1" 'quoted text' readonly grep "$1" /usr/bin
+	$(pwd) cd then 2>/dev/null then "$@" grep --verbose
+	local $(pwd) readonly && test done grep "$1" test done awk --verbose
+		"$1" printf local sed | x=1 echo
+		grep --verbose | printf && then -eu "$@" "$1" done ${HOME} ${HOME}
+export "$@" sed printf export then grep test local "$1" 'quoted text'
+&& ${HOME} printf -eu /usr/bin
+		grep local | local 2>/dev/null echo grep /usr/bin 2>/dev/null
+		printf local printf ${HOME}
+		2>/dev/null --verbose local && ${HOME} grep export
+	${HOME} awk 2>/dev/null cd && awk test -eu
+	x=1 cd readonly awk ${HOME} local
+		'quoted text' echo "$1" 2>/dev/null
+	/usr/bin x=1 "$@" grep 2>/dev/null
+then local then export done
+		'quoted text' done grep then 2>/dev/null cd
+		awk cd local "$1" export echo ${HOME} done printf then done sed "$@" "$1" -eu
+2>/dev/null local printf grep done 2>/dev/null
+		printf $(pwd) then "$@" $(pwd) /usr/bin
+	$(pwd) x=1 local "$@" done local done test 2>/dev/null
+then 'quoted text' ${HOME} printf | awk ${HOME}
+	"$1" printf 'quoted text' readonly echo export local export /usr/bin "$1" grep
+	awk then done 2>/dev/null 2>/dev/null && cd $(pwd) then | grep awk /usr/bin
+		then -eu -eu ${HOME} cd $(pwd) test sed && 'quoted text' echo readonly && | grep
+		&& "$1" printf echo /usr/bin "$1" test
+	printf echo then export | grep x=1 then | grep sed ${HOME}
+"$@" 2>/dev/null $(pwd) awk cd export x=1 "$1" echo /usr/bin printf
+	test local cd ${HOME} | done ${HOME}
+	test 'quoted text' then echo $(pwd) local "$@" $(pwd) cd "$1" local && ${HOME}
+	printf printf grep local
+	$(pwd) --verbose "$@" ${HOME}
+		${HOME} export && readonly --verbose $(pwd) cd readonly then sed local
+export readonly cd --verbose then "$1" && $(pwd) -eu $(pwd)
+/usr/bin printf -eu test 'quoted text' && "$1" test sed x=1 "$1" awk
+		export done --verbose /usr/bin echo && grep --verbose 'quoted text'
+		printf -eu grep grep "$@"
+		sed export sed 2>/dev/null awk x=1 sed readonly /usr/bin -eu done ${HOME}
+		cd echo awk export test echo 2>/dev/null x=1 done
+	${HOME} 'quoted text' x=1 -eu x=1 x=1
+"$@" readonly -eu "$1" && test then $(pwd) printf
+		'quoted text' "$1" awk printf x=1
+cd readonly echo done
+"$@" 2>/dev/null --verbose test /usr/bin
+	sed test done -eu sed && --verbose
+then awk echo ${HOME} /usr/bin
+		"$@" readonly "$1" echo grep $(pwd) | then ${HOME} printf && done
+		sed awk 'quoted text' echo | printf sed then grep "$@" local 2>/dev/null
+	/usr/bin x=1 echo local -eu | local cd then -eu
+		x=1 echo cd then -eu -eu 2>/dev/null
+		'quoted text' "$@" grep readonly done sed $(pwd) --verbose
+		sed ${HOME} "$1" awk && 2>/dev/null --verbose
+	--verbose export --verbose test "$1" test
+	$(pwd) echo local grep $(pwd) -eu
+		-eu /usr/bin --verbose "$1" "$1" cd local
+	local done readonly "$@" ${HOME} $(pwd) cd
+		readonly grep then cd export 'quoted text' $(pwd) 'quoted text'
+	x=1 cd grep readonly local -eu echo "$1" x=1
+	2>/dev/null cd export ${HOME}
+		'quoted text' test printf test readonly test "$@" test local awk --verbose
+		sed "$@" test /usr/bin 'quoted text' "$1"
+printf printf readonly -eu readonly test | "$1" readonly local x=1 test sed local
+		test "$@" x=1 x=1 2>/dev/null /usr/bin && printf readonly --verbose
+	test sed printf test cd sed export | --verbose -eu "$@"
+		done ${HOME} awk 'quoted text' export echo -eu 2>/dev/null
+printf sed 'quoted text' && --verbose "$@" echo "$@" readonly then --verbose
+	&& cd --verbose local 2>/dev/null
+readonly 2>/dev/null "$1"
+	-eu cd awk sed grep "$@" $(pwd) -eu
+		&& sed test export $(pwd) readonly "$@" export 2>/dev/null then "$1" -eu done
+		"$@" awk export awk x=1 2>/dev/null awk --verbose sed test
+then grep ${HOME} --verbose
+		-eu x=1 local x=1 -eu /usr/bin ${HOME} | awk "$1" x=1 "$@" 'quoted text' "$1"
+	local test awk export "$@"
+2>/dev/null local 'quoted text' && | cd "$1" "$1" export grep
+	/usr/bin 2>/dev/null local ${HOME} /usr/bin x=1 readonly "$@" "$1" $(pwd)
+	--verbose ${HOME} readonly printf "$@" | sed 'quoted text'
+then done $(pwd) 'quoted text'
+	${HOME} then echo -eu "$@" grep done | export readonly 2>/dev/null cd x=1 $(pwd)
+2>/dev/null printf sed -eu 2>/dev/null awk export -eu ${HOME} echo
+"$@" sed echo 2>/dev/null ${HOME} 2>/dev/null
+		--verbose echo x=1 then test export x=1 2>/dev/null $(pwd) "$1" sed grep
+	2>/dev/null "$@" $(pwd) && && done export
+	readonly local ${HOME} "$@" export export local
+	'quoted text' x=1 -eu /usr/bin printf 2>/dev/null then --verbose local sed grep
+		printf export sed echo --verbose grep "$@" test | awk
+		--verbose "$@" x=1 $(pwd) "$@" echo grep done export done awk sed $(pwd)
+sed 2>/dev/null grep | sed grep "$@" "$1" /usr/bin ${HOME}
+	x=1 export x=1 'quoted text' awk sed ${HOME} done cd 2>/dev/null $(pwd)
+		"$@" sed x=1 "$@" ${HOME} readonly export $(pwd)
+readonly grep -eu local grep readonly
+	-eu $(pwd) $(pwd) awk cd awk
+		${HOME} "$@" test --verbose cd test grep grep cd export
+	2>/dev/null sed awk then test $(pwd) 2>/dev/null "$1" local
+	'quoted text' /usr/bin readonly $(pwd) --verbose sed printf
+		&& grep grep "$1" 'quoted text' test 'quoted text'
+		2>/dev/null --verbose -eu local -eu
+${HOME} --verbose export --verbose "$1" echo sed grep test
+--verbose -eu | local --verbose
+grep cd then /usr/bin ${HOME} && sed awk readonly ${HOME} then then && $(pwd)
+	done --verbose "$1" sed x=1 cd --verbose then /usr/bin
+		2>/dev/null local -eu 2>/dev/null -eu test export awk ${HOME} /usr/bin done ${HOME}
+	--verbose $(pwd) 'quoted text' "$1" "$1" cd 2>/dev/null $(pwd) cd
+		-eu test printf awk awk
+awk sed printf sed done test readonly -eu "$@" 'quoted text' cd printf && awk 2>/dev/null
+sed done -eu x=1 x=1 -eu --verbose test grep readonly done
+then grep && "$1" 'quoted text' 2>/dev/null then grep local ${HOME}
+	readonly then /usr/bin 'quoted text' sed done awk export readonly
+${HOME} test awk printf then 'quoted text' -eu export ${HOME}
+test | -eu sed --verbose grep 'quoted text'
+	"$1" test test awk export 'quoted text' "$@"
+	${HOME} $(pwd) awk cd --verbose "$1" x=1 ${HOME} printf x=1
+		sed done -eu /usr/bin done "$1" grep "$1" readonly cd readonly x=1
+--verbose 'quoted text'
+export "$1" cd --verbose
+readonly done /usr/bin printf sed done then readonly awk
+	readonly local sed local 'quoted text'
+	local -eu $(pwd) cd test /usr/bin printf -eu 2>/dev/null "$1" -eu awk "$1" test
+done x=1 2>/dev/null readonly 'quoted text'
+/usr/bin /usr/bin /usr/bin printf done ${HOME} -eu grep "$1" /usr/bin /usr/bin
+grep && sed then sed ${HOME} then printf $(pwd) -eu
+	done grep 'quoted text' local echo -eu | 2>/dev/null 'quoted text'
+	'quoted text' awk x=1 cd "$@"
+	echo sed "$@" 'quoted text' readonly ${HOME} -eu sed
+${HOME} then grep "$1" ${HOME} -eu | readonly done && | then /usr/bin
+$(pwd) 2>/dev/null -eu ${HOME} readonly local
+		grep "$1" /usr/bin --verbose export "$1"
+	test $(pwd) test /usr/bin echo
+	| "$@" "$1" x=1 then $(pwd) &&
+	export x=1 grep export /usr/bin 2>/dev/null
+		test readonly && "$@" test done awk -eu | x=1 ${HOME} test test /usr/bin echo
+echo "$@" cd sed done export awk done test 'quoted text'
+	/usr/bin readonly done awk awk cd local test local local sed export "$@"
+sed x=1 cd "$@" $(pwd) && "$@" printf done
+| | --verbose local "$1" printf awk | done "$@" echo awk test export -eu awk
+	printf --verbose cd x=1 'quoted text' "$1" "$@" local test
+cd && /usr/bin awk awk sed $(pwd)
+		'quoted text' && 'quoted text'
+-eu echo x=1 /usr/bin "$1"
+		awk sed ${HOME} --verbose /usr/bin done done export awk -eu "$1" -eu x=1 "$1" "$1"
+		printf ${HOME} sed sed echo 'quoted text' local cd awk awk printf
+	echo | x=1 ${HOME} printf 2>/dev/null $(pwd) echo done echo $(pwd) | printf
+echo printf test --verbose
+	| 2>/dev/null x=1 done && "$1" sed cd /usr/bin
+| cd /usr/bin 2>/dev/null sed $(pwd) test $(pwd) sed cd /usr/bin export
+		"$@" then ${HOME} done awk
+	-eu --verbose --verbose -eu local
+		echo ${HOME} -eu cd x=1 readonly "$@" awk -eu --verbose
+		readonly local /usr/bin | ${HOME} /usr/bin /usr/bin
+export readonly "$@" && ${HOME} readonly
+	&& -eu echo | 2>/dev/null then readonly
+		--verbose local cd "$1" 'quoted text' | local echo
+	local readonly printf /usr/bin export "$1" printf --verbose
+	/usr/bin $(pwd) export "$@" cd
+		"$@" && | "$@" then grep then echo sed grep &&
+	"$1" export sed then export x=1 && "$@" "$@" grep /usr/bin && awk
+	&& readonly then /usr/bin ${HOME} --verbose
+then sed sed printf 'quoted text' readonly awk
+echo done x=1 grep x=1 2>/dev/null readonly cd grep -eu | printf $(pwd) x=1
+		awk ${HOME} && test export -eu export x=1 'quoted text' local x=1 x=1
+		&& sed awk echo done "$1" done
+then 'quoted text' echo echo ${HOME} /usr/bin "$@" 2>/dev/null $(pwd) then
+		local "$@" x=1 x=1 | "$@"
+2>/dev/null && | 'quoted text' printf export -eu cd export
+		readonly ${HOME} awk && ${HOME} local cd /usr/bin | "$1" export then 2>/dev/null
+	&& "$1" local /usr/bin echo $(pwd) test readonly -eu
+		awk readonly then cd local --verbose "$@" printf local readonly
+	"$@" then "$1" --verbose cd readonly cd /usr/bin
+$(pwd) | -eu echo --verbose -eu 2>/dev/null /usr/bin
+		export printf -eu echo
+		export ${HOME} && "$1" && -eu grep x=1
+cd sed 2>/dev/null --verbose echo 'quoted text'
+		then echo echo && sed cd x=1 local | test printf 2>/dev/null
+	-eu ${HOME} export 2>/dev/null done "$@" "$1" test local && awk "$1" then $(pwd)
+		$(pwd) awk $(pwd) $(pwd) "$1" sed "$@" --verbose readonly
+	${HOME} 2>/dev/null 2>/dev/null
+	--verbose awk x=1 printf
+		2>/dev/null sed done x=1 grep
+		export echo export "$1" printf "$@" sed
+/usr/bin ${HOME} x=1 local
+		'quoted text' && 2>/dev/null --verbose x=1 'quoted text' &&
+		cd echo "$@" done sed 2>/dev/null |
+awk 2>/dev/null | 2>/dev/null 'quoted text' -eu echo
+2>/dev/null local "$@" echo $(pwd) sed "$1" | -eu /usr/bin -eu test
+'quoted text' export && "$@" then export 'quoted text'
+grep done ${HOME} --verbose -eu $(pwd) x=1 x=1 then
+&& x=1 grep sed done printf $(pwd) printf 2>/dev/null 2>/dev/null
+printf /usr/bin printf sed --verbose x=1 $(pwd) sed
+local | printf "$1" local -eu export sed readonly x=1 /usr/bin echo test
+	2>/dev/null echo local $(pwd) -eu $(pwd) 'quoted text'
+done awk grep local -eu 2>/dev/null 2>/dev/null awk sed $(pwd) "$1" | -eu
+		cd ${HOME} sed test |
+test 'quoted text' -eu ${HOME} 2>/dev/null
+		$(pwd) --verbose | echo printf --verbose then "$1" "$1" "$@" -eu
+	done && "$@" export test -eu done "$1" --verbose
+		&& && export local awk && --verbose --verbose done readonly local grep --verbose
+		sed | then -eu 'quoted text' "$@" x=1 'quoted text' printf done export
+	done awk 2>/dev/null done
+	--verbose "$1" 'quoted text' "$1"
+	awk ${HOME} | 2>/dev/null echo && /usr/bin
+		2>/dev/null && -eu "$@" export 'quoted text'
+--verbose $(pwd) ${HOME} sed x=1 2>/dev/null test echo /usr/bin cd cd "$@"
+"$@" ${HOME} done then local $(pwd)
+	readonly done cd readonly export /usr/bin export cd cd x=1 "$1" "$1"
+		${HOME} done "$@" "$1"
+test x=1 readonly && printf awk $(pwd) then
+	test | x=1 --verbose export && 2>/dev/null printf test cd 'quoted text'
+		${HOME} readonly --verbose echo "$1" test "$@" x=1 2>/dev/null
+	$(pwd) x=1 test 2>/dev/null -eu grep ${HOME}
+	| printf && echo done "$1" export readonly
+	"$1" "$@" sed 2>/dev/null printf
+local then $(pwd) test --verbose sed printf then "$1" printf export
+		--verbose 'quoted text' done
+	/usr/bin 'quoted text' sed 2>/dev/null "$1" $(pwd) 'quoted text'
+${HOME} x=1 printf local test export echo 2>/dev/null 2>/dev/null
+	grep "$1" x=1 /usr/bin sed readonly /usr/bin x=1 'quoted text'
+done echo sed x=1 local
+echo --verbose -eu | printf echo 'quoted text'
+		echo grep $(pwd) readonly --verbose readonly
+		cd 'quoted text' test
+export test grep test -eu ${HOME} test awk printf "$1" export
+	'quoted text' local then done printf sed | export done "$@" awk
+		$(pwd) sed cd awk "$1" "$1" | |
+echo export --verbose /usr/bin 'quoted text' && "$1" then done
+local done test printf cd cd local then
+		test && 2>/dev/null && awk -eu
+		/usr/bin -eu test printf export ${HOME} done /usr/bin awk --verbose done
+	&& done local awk awk 2>/dev/null
+awk done grep echo "$@"
+	-eu done --verbose 2>/dev/null --verbose
+2>/dev/null done "$1" -eu readonly
+	cd --verbose -eu "$1" ${HOME} -eu echo $(pwd) | readonly then | --verbose x=1 2>/dev/null
+	export readonly then ${HOME} "$1" -eu sed awk "$@" $(pwd) readonly -eu
+		$(pwd) | echo grep export | -eu awk export local | test | /usr/bin &&
+		| /usr/bin printf grep | then "$@" 2>/dev/null
+test cd readonly -eu "$@" x=1 | grep $(pwd) | printf |
+	--verbose done | grep echo x=1 --verbose sed 'quoted text' done
+	x=1 awk x=1 printf /usr/bin
+	awk echo done "$1" sed sed "$@" /usr/bin export readonly
+	${HOME} $(pwd) test done -eu /usr/bin done export --verbose export "$@" grep awk
+		| export awk ${HOME} 'quoted text' awk sed awk 2>/dev/null echo
+$(pwd) sed done local
+		'quoted text' grep "$@" x=1 "$@" && |
+	${HOME} echo sed awk then -eu 'quoted text' sed export cd ${HOME}
+		grep done 'quoted text' echo x=1 x=1 readonly local $(pwd) test
+test local grep done 'quoted text' done echo
+echo /usr/bin test x=1 -eu -eu 2>/dev/null then | then cd export "$@" grep
+	then sed echo readonly && export readonly then cd | -eu local
+x=1 export $(pwd) "$1" export
+cd test done 'quoted text'
+		| done && /usr/bin done 2>/dev/null 2>/dev/null ${HOME} --verbose "$@" cd
+	done $(pwd) ${HOME} done --verbose sed local
+		$(pwd) local cd local cd test test 'quoted text' readonly sed ${HOME} 2>/dev/null
+		/usr/bin "$1" sed then then --verbose export
+		test ${HOME} 2>/dev/null "$@" grep test
+&& awk then --verbose 'quoted text' 2>/dev/null
+	$(pwd) echo done export grep $(pwd) /usr/bin
+		2>/dev/null awk cd | local done sed && ${HOME}
+	sed $(pwd) -eu grep -eu /usr/bin "$1" | $(pwd)
+	awk awk "$@" done echo test -eu --verbose /usr/bin x=1 grep done sed 'quoted text'
+	done cd echo local && | --verbose $(pwd) "$@" | test then | /usr/bin $(pwd)
+	export local --verbose local awk then done then /usr/bin && x=1 "$1"
+printf /usr/bin | grep --verbose 'quoted text' printf then export
+export 'quoted text' x=1 done awk 'quoted text' -eu $(pwd) --verbose
+		then --verbose local 'quoted text'
+		echo awk test then -eu /usr/bin export "$1" sed | cd local ${HOME} grep 2>/dev/null
+	test 'quoted text' 2>/dev/null
+	${HOME} x=1 printf ${HOME} x=1 x=1 "$1" then done echo grep cd --verbose
+	test ${HOME} cd "$@" "$1" readonly printf "$@"
+export $(pwd) export "$1"
+		x=1 'quoted text' sed then grep export awk -eu
+		sed local $(pwd) sed 2>/dev/null
+"$1" awk "$@" "$@" --verbose x=1 x=1 grep -eu grep
+	printf /usr/bin && export readonly test printf export "$1" | "$@" awk ${HOME}
+readonly "$1" -eu ${HOME} $(pwd) readonly
+		done ${HOME} "$1" 'quoted text' ${HOME} | done x=1
+		2>/dev/null -eu test 'quoted text' -eu then printf -eu sed
+	grep export --verbose "$@" -eu sed export grep $(pwd) && local | export
+then grep --verbose done /usr/bin cd cd awk --verbose ${HOME}
+	awk awk then printf echo 'quoted text' "$@" 2>/dev/null
+	done 'quoted text' then /usr/bin ${HOME} x=1 cd then "$1" | ${HOME} x=1
+x=1 cd echo --verbose local /usr/bin -eu | cd export done $(pwd)
+export done cd | grep echo ${HOME}
+awk "$@" readonly readonly awk "$@" done 2>/dev/null grep 2>/dev/null --verbose
+		sed printf test "$@" -eu 2>/dev/null printf readonly
+grep local /usr/bin && awk done 'quoted text'
+		&& export then "$@" x=1 2>/dev/null readonly
+		done ${HOME} done "$1" awk readonly 2>/dev/null export && then 2>/dev/null test
+	'quoted text' | test "$1" && $(pwd) readonly | grep ${HOME}
+		| printf local echo local "$1" sed local
+		$(pwd) then echo 2>/dev/null
+then grep printf export $(pwd) 'quoted text' grep ${HOME} test $(pwd)
+	echo cd 2>/dev/null ${HOME} done "$@" then test -eu ${HOME} done readonly
+	--verbose done printf
+--verbose grep then | awk readonly cd /usr/bin cd --verbose -eu 'quoted text'
+		&& awk "$@" test | 2>/dev/null
+/usr/bin cd cd done local
+echo ${HOME} echo awk "$@" done then x=1 printf readonly --verbose
+sed /usr/bin && sed awk
+	'quoted text' && awk echo echo readonly
+test test done awk | ${HOME} sed ${HOME}
+	&& local ${HOME} --verbose readonly 2>/dev/null -eu readonly
+	done | "$1" cd done -eu x=1 && "$@" $(pwd) /usr/bin
+	| awk cd then /usr/bin export readonly grep "$@" export $(pwd) export
+	$(pwd) printf --verbose awk awk /usr/bin cd
+	2>/dev/null | --verbose cd 'quoted text' grep x=1 readonly awk | $(pwd)
+	done 2>/dev/null echo echo "$1" then awk x=1 then "$1"
+	--verbose "$1" cd local awk --verbose done x=1
+x=1 echo --verbose $(pwd) /usr/bin then
+	test then awk x=1 done readonly
+sed 2>/dev/null /usr/bin
+		"$1" x=1 readonly readonly readonly $(pwd) awk "$1" grep cd
+	awk cd awk echo export /usr/bin
+/usr/bin readonly $(pwd) ${HOME} $(pwd) printf
+		x=1 | | 'quoted text' "$1" done
+		-eu cd | && cd readonly then ${HOME} then x=1 test "$@" printf --verbose
+	${HOME} sed echo sed $(pwd) "$1" "$@" done | $(pwd) 'quoted text' done $(pwd)
+		$(pwd) awk awk && "$1" x=1 sed
+	sed && && test readonly "$@" "$@" "$@" readonly done
+	"$1" /usr/bin ${HOME} export local
+${HOME} test grep && then "$@" ${HOME} grep echo ${HOME}
+		$(pwd) then /usr/bin /usr/bin then && 2>/dev/null 2>/dev/null echo echo
+	"$1" test test | printf | "$1" readonly --verbose "$@"
+grep sed printf done printf done $(pwd) 2>/dev/null $(pwd) grep /usr/bin
+		export awk test --verbose -eu | ${HOME} --verbose x=1 then
+		cd | test local cd then test $(pwd) | awk "$@" awk | "$@" /usr/bin test "$@" "$@"
+"$@" -eu 'quoted text' $(pwd) sed done then -eu printf 2>/dev/null
+		grep && x=1 --verbose then 2>/dev/null x=1 local -eu 2>/dev/null
+		x=1 | echo printf test export $(pwd) printf ${HOME} cd export $(pwd) sed done
+		&& | x=1 done export done "$1" echo sed | && printf
+local readonly "$@" 2>/dev/null echo sed printf x=1 printf then && &&
+	${HOME} test export -eu local 2>/dev/null awk 'quoted text' 'quoted text' cd
+		"$@" 'quoted text' export test $(pwd) done
+		done local export 'quoted text' ${HOME} cd export ${HOME} test "$1"
+	then 'quoted text' ${HOME} "$@" printf 'quoted text' 'quoted text' readonly
+	grep readonly test cd -eu grep sed 2>/dev/null
+local -eu --verbose cd x=1 echo -eu "$1" $(pwd) local "$@" export test $(pwd)
+		"$1" && "$1" && | $(pwd)
+readonly $(pwd) sed export 2>/dev/null done readonly sed -eu awk 2>/dev/null
+		2>/dev/null 2>/dev/null $(pwd) -eu awk "$1" /usr/bin --verbose
+	&& awk done "$1" cd -eu local done "$1" grep sed grep done $(pwd)
+x=1 then 2>/dev/null sed
+export ${HOME} /usr/bin 'quoted text'
+export local --verbose cd -eu ${HOME} /usr/bin printf printf --verbose
+		then --verbose grep export grep done 2>/dev/null awk grep "$1" local
+/usr/bin ${HOME} then done 2>/dev/null readonly -eu
+		2>/dev/null -eu test done sed sed x=1 echo
+	awk test readonly local /usr/bin cd | "$1" 'quoted text'
+	/usr/bin $(pwd) done
+		cd readonly sed | echo printf $(pwd) -eu echo local "$1" x=1 test
+		printf local sed --verbose grep local cd local 'quoted text' "$1" sed "$1" awk
+	2>/dev/null x=1 local awk done grep --verbose
+awk cd "$1" grep ${HOME} test ${HOME} -eu -eu && x=1 awk -eu "$1" && cd
+	awk 2>/dev/null | printf echo
+	printf 2>/dev/null cd
+done done $(pwd) sed sed 2>/dev/null export test "$@" "$1" && readonly 'quoted text'
+		grep "$@" 'quoted text' grep test --verbose grep echo awk test $(pwd)
+		readonly cd readonly local x=1 -eu
+	x=1 grep then export printf printf awk $(pwd) "$@" x=1
+	'quoted text' done local 'quoted text' printf sed then test
+	x=1 sed cd cd sed cd echo sed && readonly
+	"$1" 2>/dev/null | done local && x=1 sed local
+	awk -eu readonly export cd echo && cd test sed ${HOME}
+		test grep done sed done echo && sed grep cd -eu grep readonly echo test 2>/dev/null
+	readonly awk done grep sed
+done done $(pwd) readonly -eu readonly test "$@" then
+local --verbose test $(pwd) | ${HOME} local export
+	local local "$@" grep $(pwd) awk && awk 2>/dev/null --verbose readonly
+echo sed --verbose 'quoted text'
+		export 'quoted text' test
+${HOME} /usr/bin readonly cd then
+"$@" /usr/bin export "$1" --verbose awk awk x=1
+--verbose -eu echo x=1 ${HOME} -eu -eu 2>/dev/null && awk -eu | --verbose
+	done local $(pwd) -eu && 'quoted text'
+| /usr/bin cd "$@" echo && echo cd grep echo sed x=1 then "$@" /usr/bin echo readonly
+		then && done grep 'quoted text' && sed cd local echo "$@" "$1" export echo test
+"$@" export 'quoted text' sed printf 2>/dev/null
+		printf grep /usr/bin -eu then cd sed grep ${HOME} export /usr/bin
+	local && readonly "$@" "$1" readonly readonly
+then x=1 done then | 2>/dev/null "$1" done /usr/bin $(pwd) "$@" | grep
+		export echo local export 2>/dev/null
+	cd "$1" awk local x=1 printf 'quoted text'
+x=1 echo ${HOME} awk
+'quoted text' printf "$1" "$1" cd --verbose && "$1"
+		export --verbose $(pwd) "$@" "$1" export cd export ${HOME}
+	| "$1" done ${HOME} echo done 2>/dev/null printf | test 'quoted text'
+	echo $(pwd) cd local awk local "$@" && 2>/dev/null
+	test readonly "$@" ${HOME} export "$1" export | | $(pwd) readonly test
+export grep echo --verbose ${HOME} x=1 'quoted text' /usr/bin grep ${HOME} --verbose
+local done printf local grep local /usr/bin cd export test grep printf
+sed --verbose /usr/bin printf local /usr/bin sed /usr/bin && then /usr/bin
+		'quoted text' | | -eu printf cd readonly ${HOME} "$@"
+	"$1" 2>/dev/null readonly test ${HOME} "$1" && sed awk
+grep echo --verbose /usr/bin done test | 2>/dev/null
+		| x=1 echo test $(pwd) "$1" x=1 "$@" -eu printf --verbose
+	test --verbose 'quoted text'
+cd x=1 local "$@" && /usr/bin
+	"$@" local local 2>/dev/null printf --verbose test /usr/bin test export
+		'quoted text' x=1 "$@" | readonly echo echo test local awk printf && cd /usr/bin
+	2>/dev/null 'quoted text' grep grep ${HOME} 'quoted text' 2>/dev/null
+		2>/dev/null awk echo printf
+	cd awk local test --verbose local test /usr/bin ${HOME} /usr/bin done
+local test | /usr/bin readonly | -eu
+	| local -eu done test | "$@" --verbose
+	local local echo -eu && printf printf grep test
+x=1 done local local sed readonly grep | sed &&
+	printf local awk awk done echo printf ${HOME} | grep --verbose export
+		local done && "$@" printf then readonly sed grep --verbose grep
+	x=1 then "$@" "$1" "$@" /usr/bin grep
+printf done then ${HOME} export done "$1" ${HOME} export local cd
+--verbose echo then x=1 cd
+		then local local done test
+		'quoted text' done ${HOME} readonly printf ${HOME}
+	done /usr/bin "$@" test ${HOME}
+--verbose && awk -eu cd | printf 'quoted text' sed "$@" "$@"
+		$(pwd) --verbose 'quoted text' -eu test -eu 'quoted text'
+export sed /usr/bin $(pwd) sed local x=1 echo /usr/bin && "$@" printf
+		/usr/bin awk "$1" readonly then test /usr/bin /usr/bin 'quoted text'
+	cd grep local && --verbose "$1" 2>/dev/null done printf
+	--verbose x=1 2>/dev/null echo 2>/dev/null
+	awk then test echo "$@" ${HOME} -eu
+		cd "$1" cd && export /usr/bin cd -eu "$1" echo --verbose
+| awk x=1 test sed --verbose -eu sed done
+| 2>/dev/null -eu local /usr/bin sed ${HOME} cd | sed then done local
+		-eu export 'quoted text' test /usr/bin cd "$1" sed awk -eu sed then /usr/bin
+		/usr/bin --verbose "$1" -eu --verbose
+then export "$1" ${HOME} export 2>/dev/null then grep
+		sed export ${HOME} awk awk done grep 'quoted text' local export --verbose
+	${HOME} then -eu -eu grep 'quoted text' x=1 awk then | 'quoted text'
+		echo grep awk awk test --verbose ${HOME} awk export export
+--verbose printf done $(pwd) x=1 export
+${HOME} grep echo readonly "$@" test "$1" "$@" sed done && export done
+		"$1" "$@" && "$1" x=1 "$@" sed $(pwd) "$1" | awk readonly awk
+		sed && "$1" done ${HOME} "$@"
+echo local 'quoted text' export /usr/bin 2>/dev/null -eu readonly --verbose cd
+		| test ${HOME} readonly x=1 echo printf && "$1" printf
+local | -eu | --verbose cd grep $(pwd)
+		--verbose $(pwd) /usr/bin $(pwd) readonly ${HOME} local
+| readonly cd done $(pwd) 2>/dev/null "$@" "$1" -eu /usr/bin --verbose
+		-eu 'quoted text' && export ${HOME} | then -eu
+	sed grep $(pwd) printf 'quoted text' local | awk awk 'quoted text'
+	'quoted text' /usr/bin $(pwd) --verbose /usr/bin awk --verbose then local then x=1
+/usr/bin "$@" 2>/dev/null
+		test 2>/dev/null printf test "$@" done -eu awk export 'quoted text' grep
+$(pwd) grep -eu "$1" x=1 | 'quoted text' cd &&
+		then 2>/dev/null done done done grep
+sed test done test echo printf && grep /usr/bin "$1" readonly $(pwd)
+test done "$@" ${HOME} readonly
+		${HOME} test 'quoted text' export test
+printf awk && 2>/dev/null -eu x=1 | sed --verbose echo test sed then
+readonly sed && export test -eu awk sed printf 2>/dev/null
+	'quoted text' printf echo
+		printf export | awk export "$1"
+	cd printf local | x=1 export "$1"
+2>/dev/null echo 2>/dev/null done readonly && local 'quoted text'
+		&& done | local --verbose --verbose
+sed ${HOME} "$1" awk --verbose cd && ${HOME} ${HOME}
+		export cd export sed export --verbose export && sed
+		readonly 2>/dev/null
+		cd "$1" awk then "$1" then --verbose $(pwd) ${HOME}
+readonly cd printf x=1 grep readonly --verbose
+		'quoted text' x=1 awk --verbose local -eu awk | "$1" "$@" | /usr/bin "$1" echo
+	test grep local "$@" "$1"
+	export $(pwd) 2>/dev/null
+	printf x=1 | export then cd /usr/bin "$1" awk "$1" | test x=1 "$1" awk
+		/usr/bin ${HOME} $(pwd) cd | -eu local grep cd 'quoted text'
+	${HOME} -eu echo printf | /usr/bin echo
+		echo $(pwd) "$1" awk 2>/dev/null
+		$(pwd) printf ${HOME} sed grep printf grep grep echo sed cd
+printf 2>/dev/null export then 'quoted text' awk --verbose | | /usr/bin
+		/usr/bin grep cd 2>/dev/null "$@"
+	$(pwd) grep then echo ${HOME} /usr/bin
+	/usr/bin x=1 "$1" 2>/dev/null awk "$@" sed grep "$1" -eu echo test
+		--verbose done then then /usr/bin local printf
+	export then 2>/dev/null echo test -eu 2>/dev/null -eu grep export -eu export
+		local -eu x=1 printf done export done export cd 'quoted text' grep done awk ${HOME}
+		readonly echo export "$@" $(pwd) grep | -eu && $(pwd) echo
+		--verbose awk then ${HOME} cd awk -eu test sed $(pwd) 'quoted text' ${HOME} export
+	export cd done sed && && x=1 printf "$1" awk then --verbose
+	/usr/bin -eu then 2>/dev/null
+		/usr/bin x=1 printf sed printf local "$1" sed echo readonly
+		"$@" --verbose export
+&& && then 2>/dev/null awk sed then
+	"$@" export $(pwd) done --verbose done printf then 'quoted text' 'quoted text'
+	grep export && /usr/bin && 2>/dev/null 2>/dev/null x=1 readonly
+	/usr/bin local awk export done test --verbose
+awk 2>/dev/null && echo
+		x=1 printf local done test cd
+	--verbose x=1 done cd ${HOME} printf grep -eu sed --verbose
+--verbose done then "$1" 'quoted text'
+awk then ${HOME} local 'quoted text' local readonly done export cd "$@" "$1"
+		echo cd echo -eu --verbose
+	awk /usr/bin grep $(pwd) awk printf
+export | 2>/dev/null ${HOME} $(pwd) cd x=1 x=1 test && echo /usr/bin
+		awk export | /usr/bin -eu && "$@" local printf awk x=1 "$1" cd ${HOME} -eu /usr/bin
+	grep 2>/dev/null ${HOME} $(pwd) 'quoted text' local done --verbose 2>/dev/null
+		done then -eu && awk | -eu x=1 then then readonly
+readonly printf export test export 2>/dev/null 2>/dev/null
+		$(pwd) 'quoted text' | 'quoted text' export $(pwd) $(pwd) readonly
+sed 2>/dev/null readonly "$@" /usr/bin "$1" then echo local && && local --verbose
+		/usr/bin | x=1 && test -eu cd
+local && echo test 'quoted text' printf cd "$1" | -eu
+&& $(pwd) then awk grep sed -eu grep echo | printf
+		echo printf then done "$1" printf local echo "$@"
+awk 'quoted text' echo local
+		readonly /usr/bin "$@" local "$@" readonly grep ${HOME} grep sed printf
+	done -eu | 'quoted text' "$1" test $(pwd) then
+	grep local 'quoted text' /usr/bin x=1 awk awk sed "$@" x=1
+	'quoted text' local echo 2>/dev/null -eu export && done
+export | done 'quoted text' |
+	printf test x=1 && readonly 2>/dev/null export | echo && cd done /usr/bin
+"$@" x=1 'quoted text' test awk local 'quoted text' test /usr/bin x=1 "$@"
+	echo x=1 | | export then cd $(pwd) grep | 2>/dev/null
+	/usr/bin cd /usr/bin awk printf $(pwd) 2>/dev/null printf
+	export 2>/dev/null cd --verbose /usr/bin ${HOME} 2>/dev/null 2>/dev/null ${HOME}
+	"$1" local | "$@" /usr/bin
+	${HOME} -eu 2>/dev/null 'quoted text' -eu export cd grep "$1" printf 'quoted text'
+	cd local export echo | local
+	test grep 'quoted text' $(pwd) readonly grep | x=1 /usr/bin
+		local readonly test echo readonly
+		x=1 'quoted text' -eu --verbose
+	done --verbose grep echo 'quoted text'
+	"$@" printf x=1 "$@" 'quoted text' awk -eu awk 'quoted text' 2>/dev/null
+	${HOME} "$@" sed grep sed /usr/bin
+local /usr/bin printf export --verbose
+	awk awk 2>/dev/null echo "$1" "$@" x=1 ${HOME} done --verbose local sed $(pwd)
+	/usr/bin sed done awk
+echo $(pwd) echo local --verbose && -eu then echo && "$@" && grep
+	test sed x=1 $(pwd) readonly
+${HOME} test grep echo
+/usr/bin printf "$@" export --verbose export -eu sed
+-eu 2>/dev/null grep readonly readonly test
+	awk $(pwd) | cd "$@" && x=1 readonly
+test cd $(pwd) "$1" --verbose 'quoted text'
+echo awk export 'quoted text' echo
+/usr/bin -eu then ${HOME} awk 2>/dev/null test sed test cd | --verbose
+awk && cd local 2>/dev/null cd $(pwd) /usr/bin x=1 "$@" cd echo "$1" grep export
+		local then --verbose | && sed
+		"$1" done grep awk /usr/bin readonly awk test cd x=1
+2>/dev/null export readonly 'quoted text'
+		/usr/bin sed grep local "$1" done /usr/bin x=1 echo /usr/bin readonly /usr/bin
+	export "$@" local local x=1 cd awk /usr/bin printf export local | | ${HOME} /usr/bin
+	cd x=1 local | $(pwd) "$1" then readonly /usr/bin awk 2>/dev/null ${HOME} grep readonly
+		"$@" export test grep export /usr/bin
+	"$@" | $(pwd) $(pwd) printf x=1 x=1 --verbose "$1" local
+		/usr/bin && done echo sed awk 'quoted text'
+	grep test --verbose printf
+		x=1 printf done cd $(pwd) -eu --verbose done $(pwd) && sed 2>/dev/null
+&& 'quoted text' export ${HOME} -eu export then 2>/dev/null --verbose "$@"
+test 2>/dev/null --verbose printf awk cd test --verbose awk echo
+		awk export done sed | export | /usr/bin 'quoted text' 'quoted text'
+&& "$@" $(pwd) printf ${HOME} printf 2>/dev/null local --verbose
+		cd && | echo cd grep test cd "$@" printf && readonly x=1 "$1" /usr/bin
+"$1" echo printf --verbose printf grep "$@" test
+		$(pwd) echo test | printf --verbose echo
+awk readonly grep grep $(pwd) test printf echo --verbose test readonly && $(pwd)
+		${HOME} then done readonly && export sed x=1 printf sed ${HOME} "$@" 'quoted text'
+	x=1 2>/dev/null /usr/bin echo awk
+| /usr/bin | $(pwd) "$1" $(pwd) export /usr/bin echo export export
+${HOME} 2>/dev/null echo
+--verbose /usr/bin grep awk "$@" 'quoted text' 2>/dev/null
+		sed then /usr/bin cd readonly cd /usr/bin cd then "$1" /usr/bin local "$1"
+		sed grep | readonly echo /usr/bin "$1" -eu sed 'quoted text' readonly echo
+	"$1" && export 'quoted text'
+		done "$1" 2>/dev/null then printf grep test awk 2>/dev/null --verbose
+		&& --verbose -eu cd cd 'quoted text'
+echo readonly local sed done sed cd /usr/bin sed then --verbose echo "$1" printf
+		awk then x=1 cd && 2>/dev/null "$1" cd sed --verbose ${HOME} /usr/bin sed
+	echo awk 2>/dev/null /usr/bin ${HOME} grep && done 2>/dev/null 2>/dev/null
+then echo then 'quoted text'
+		'quoted text' then $(pwd) /usr/bin
+/usr/bin awk $(pwd) | grep
+	${HOME} cd "$1" awk then readonly test /usr/bin "$@"
+		readonly "$1" --verbose readonly cd /usr/bin
+test export export 'quoted text'
+		export test "$1" 'quoted text' $(pwd) $(pwd) && ${HOME} grep printf
+export awk readonly test
+		| /usr/bin 'quoted text' test local local "$@" echo done done ${HOME} printf
+-eu local --verbose local ${HOME} ${HOME} printf echo
+		cd ${HOME} sed 'quoted text' $(pwd) 2>/dev/null
+export 'quoted text' export cd && then awk -eu $(pwd) awk "$@"
+		printf printf awk 2>/dev/null grep awk
+	done cd "$@" 2>/dev/null 2>/dev/null grep
+awk test echo done /usr/bin "$1" sed awk "$1" | $(pwd) /usr/bin echo "$1"
+"$1" $(pwd) awk --verbose printf awk x=1 export export grep cd
+		done done x=1 awk && "$1" -eu export | done "$1" awk test
+		'quoted text' --verbose grep export x=1 -eu printf
+		printf 'quoted text' local done && awk 'quoted text'
+	grep grep sed sed grep | -eu
+		&& readonly | | $(pwd) /usr/bin 'quoted text'
+awk sed "$@" /usr/bin --verbose done done sed $(pwd) readonly
+		x=1 /usr/bin awk test /usr/bin local 2>/dev/null then
+		2>/dev/null 2>/dev/null echo
+test /usr/bin "$@" done -eu test export | && export then "$1"
+x=1 readonly then cd then
+"$1" && "$@" x=1 done export awk /usr/bin readonly
+	x=1 x=1 "$@" 'quoted text' cd 2>/dev/null cd printf --verbose -eu
+	local $(pwd) "$1" | printf printf 2>/dev/null 'quoted text'
+	&& "$1" --verbose then /usr/bin
+-eu sed test && printf ${HOME} echo $(pwd) ${HOME} -eu --verbose readonly echo printf
+$(pwd) && 2>/dev/null local sed test && readonly "$1" done "$@" export
+"$1" sed "$1" "$@" then awk echo
+cd grep /usr/bin cd "$1" export /usr/bin /usr/bin printf printf --verbose
+"$1" ${HOME} local printf readonly && test
+local readonly grep awk grep $(pwd) ${HOME} "$@" export | --verbose readonly
+	"$1" local echo 'quoted text'
+--verbose local readonly then sed export
+$(pwd) "$1" local /usr/bin
+printf sed -eu done awk -eu $(pwd) grep --verbose /usr/bin
+		grep export x=1 $(pwd) grep "$1" grep cd printf -eu
+/usr/bin ${HOME} echo export ${HOME} "$@" "$1" ${HOME}
+	grep done x=1 echo && then local
+	/usr/bin && local local | awk /usr/bin readonly /usr/bin $(pwd) awk echo grep printf
+	echo sed grep 2>/dev/null readonly then grep 'quoted text'
+	-eu | readonly | | local "$1" ${HOME} /usr/bin done local $(pwd)
+cd x=1 awk /usr/bin --verbose 2>/dev/null
+	cd 'quoted text' readonly | sed cd "$@" echo grep readonly export
+		--verbose export ${HOME} test test 2>/dev/null "$@" test grep sed
+/usr/bin test export 'quoted text'
+		x=1 && done printf local x=1
+printf grep echo 2>/dev/null
+	"$1" local --verbose test cd cd -eu awk then readonly export grep
+	done | test 'quoted text' echo /usr/bin --verbose
+	awk "$@" echo printf readonly && cd then ${HOME} /usr/bin test "$@" x=1
+then x=1 | grep awk done "$1" sed then 2>/dev/null -eu ${HOME} printf "$1" local
+	local x=1 | echo printf done /usr/bin export x=1 grep awk readonly 2>/dev/null
+		/usr/bin 'quoted text' sed
+&& -eu local /usr/bin 2>/dev/null
+	--verbose cd && | $(pwd) printf then
+	then readonly x=1 echo && -eu 'quoted text'
+echo /usr/bin cd --verbose "$@" ${HOME}
+		--verbose awk awk local
+		awk "$@" && | "$1" 2>/dev/null then
+	sed printf | echo x=1 export $(pwd) printf x=1 /usr/bin
+x=1 export done readonly --verbose x=1 "$1" echo printf echo 2>/dev/null
+	"$@" ${HOME} local "$@" then "$1" then
+readonly test "$1" local then then then "$@" cd local then then
+done sed test awk 'quoted text' -eu -eu x=1 /usr/bin x=1 test readonly
+		/usr/bin export readonly echo | "$1" test && echo readonly printf
+		/usr/bin awk "$@" test
+	&& 'quoted text' /usr/bin $(pwd) then /usr/bin /usr/bin
+$(pwd) 2>/dev/null "$1" awk -eu --verbose $(pwd) local echo local export
+--verbose test awk $(pwd) done | 'quoted text'
+"$1" sed && $(pwd) 'quoted text' x=1 echo
+		"$@" "$1" $(pwd) x=1 grep sed | grep ${HOME} --verbose sed
+test readonly printf | x=1 --verbose
+		test test --verbose && "$@" echo cd | "$@" "$1" then "$1" cd local 'quoted text'
+	test local $(pwd) done local 'quoted text' "$@" printf ${HOME} sed done then
+	then 'quoted text' "$@" grep "$@" 'quoted text'
+	test "$@" 2>/dev/null | readonly 'quoted text' readonly
+$(pwd) sed $(pwd) printf
+export sed 'quoted text' /usr/bin local awk &&
+x=1 cd sed then done
+		-eu x=1 | && 'quoted text' printf export sed local echo grep ${HOME} | echo
+	sed done | 'quoted text' awk done "$1"
+"$@" ${HOME} -eu 2>/dev/null "$@" export
+/usr/bin $(pwd) $(pwd) 'quoted text' printf 2>/dev/null "$@" -eu
+		${HOME} 'quoted text' -eu "$@" readonly "$@" 'quoted text' -eu -eu sed export
+	2>/dev/null -eu printf done sed | 2>/dev/null cd then x=1 sed 2>/dev/null
+		--verbose -eu x=1 sed | x=1 printf && grep 2>/dev/null echo 2>/dev/null
+	-eu "$1" "$1" /usr/bin
+		sed | | local --verbose "$1" x=1 grep 2>/dev/null echo --verbose echo | export
+		printf echo cd "$1" export echo then echo export /usr/bin awk "$1" awk sed -eu
+	--verbose sed cd && --verbose sed done && $(pwd) $(pwd) --verbose
+test 2>/dev/null -eu "$@" x=1 then echo | -eu /usr/bin local done "$1" local
+&& /usr/bin /usr/bin cd ${HOME} echo "$@" cd
+	test sed echo sed printf $(pwd) /usr/bin printf
+-eu cd /usr/bin done --verbose awk x=1 sed local
+	readonly ${HOME} --verbose
+grep export 'quoted text' /usr/bin cd 2>/dev/null x=1 -eu export readonly
+readonly --verbose --verbose done --verbose cd
+		export export export |
+/usr/bin 'quoted text' done
+		echo /usr/bin readonly | done x=1 sed 'quoted text' 2>/dev/null 'quoted text'
+	--verbose awk awk export 'quoted text' readonly x=1 $(pwd) export 'quoted text'
+		test awk then readonly "$@" --verbose --verbose "$1" cd 'quoted text'
+	-eu ${HOME} -eu then 'quoted text' done grep printf -eu printf printf grep echo
+		then -eu "$1" 'quoted text' /usr/bin --verbose
+		then /usr/bin /usr/bin readonly sed x=1 test grep --verbose
+readonly /usr/bin $(pwd) export 'quoted text' awk test x=1
+		&& grep && echo echo 'quoted text' ${HOME} "$1" x=1 test
+	test 2>/dev/null grep $(pwd) grep export x=1 'quoted text' &&
+/usr/bin 'quoted text' then "$@"
+--verbose done --verbose printf | x=1 -eu $(pwd) test test "$1" ${HOME}
+		"$1" printf 'quoted text' test echo
+awk local then grep 'quoted text' done awk done 2>/dev/null ${HOME}
+		grep && "$1" test local sed ${HOME} readonly then sed && "$@" "$1" -eu $(pwd)
+2>/dev/null done ${HOME} | x=1 sed printf readonly readonly 2>/dev/null
+awk local x=1 local grep local ${HOME} x=1 then -eu
+		test awk readonly /usr/bin then
+		awk ${HOME} | --verbose readonly sed readonly 2>/dev/null /usr/bin
+		sed /usr/bin then 'quoted text' x=1 | "$@" awk && cd x=1 awk
+sed $(pwd) 'quoted text' /usr/bin
+	--verbose --verbose && test then test grep cd then --verbose sed | then
+	${HOME} /usr/bin printf awk | sed awk 'quoted text' ${HOME} 'quoted text'
+		printf sed test grep awk && | local -eu && done -eu done done local
+--verbose done done --verbose --verbose -eu cd "$@" test test awk
+	test cd printf ${HOME} awk readonly x=1 export x=1 echo
+"$@" then --verbose cd printf echo "$@" awk cd |
+	export -eu --verbose && done done x=1 cd 2>/dev/null
+"$@" x=1 awk --verbose && printf test done export && echo 2>/dev/null grep cd sed
+	grep 'quoted text' && sed $(pwd)
+		2>/dev/null printf /usr/bin grep && --verbose
+	'quoted text' && -eu ${HOME} $(pwd) x=1 grep
+	-eu then echo $(pwd) /usr/bin | then local test /usr/bin export then
+	$(pwd) then -eu "$@" x=1 grep local local done --verbose sed x=1 /usr/bin
+		export done cd | done "$@"
+local export local grep test 'quoted text' /usr/bin 'quoted text'
+		printf x=1 -eu readonly test "$@" test 'quoted text' | /usr/bin
+		awk readonly && 2>/dev/null sed /usr/bin cd awk -eu printf
+		export | grep readonly grep 'quoted text' done local local /usr/bin local /usr/bin
+	local done 2>/dev/null done
+	cd readonly "$1" done --verbose readonly echo echo cd grep echo done -eu
+	awk | readonly 2>/dev/null echo | local "$1" done $(pwd) readonly
+	awk $(pwd) sed /usr/bin cd test test cd 2>/dev/null
+grep sed $(pwd) 'quoted text' awk export -eu | x=1 grep /usr/bin test 'quoted text'
+		"$@" echo then cd then done 2>/dev/null 'quoted text' readonly
+	then x=1 ${HOME} --verbose x=1 ${HOME} then export 2>/dev/null
+done cd done --verbose -eu x=1 /usr/bin test awk
+		"$@" /usr/bin cd --verbose then | printf /usr/bin cd 'quoted text'
+$(pwd) then local then && -eu echo cd 'quoted text' local cd
+export done sed then sed local 2>/dev/null awk echo --verbose
+	x=1 "$1" "$1" then done && then printf /usr/bin | sed awk && $(pwd)
+test "$1" readonly printf local local "$@"
+		printf cd sed sed -eu test done 'quoted text'
+	awk test sed 'quoted text' printf local --verbose
+"$@" cd ${HOME} | export done local printf "$1"
+"$1" x=1 $(pwd) sed then then readonly /usr/bin printf ${HOME} 'quoted text'
+	x=1 done && done 2>/dev/null 2>/dev/null echo ${HOME} grep grep "$1" cd
+		grep "$1" "$@" sed sed && /usr/bin
+'quoted text' $(pwd) readonly awk 'quoted text' cd /usr/bin 2>/dev/null --verbose
+	2>/dev/null grep -eu ${HOME} "$1" then /usr/bin ${HOME}
+	'quoted text' readonly
+		'quoted text' grep readonly cd export local then && sed readonly | export
+		done -eu sed "$@" -eu /usr/bin test -eu --verbose "$1" test | awk
+"$1" local sed 'quoted text' $(pwd)
+"$@" | local done export 2>/dev/null -eu ${HOME}
+	then 'quoted text' --verbose ${HOME} test
+	-eu && $(pwd) grep echo && 2>/dev/null done x=1 test 'quoted text' echo 2>/dev/null
+		done local sed -eu 'quoted text' printf $(pwd) --verbose
+readonly -eu | "$@" "$1" "$@" cd /usr/bin echo "$@" $(pwd) export $(pwd)
+readonly 'quoted text' grep sed awk printf ${HOME} x=1 cd 'quoted text' sed
+	local sed 2>/dev/null grep
+x=1 echo test local -eu local grep -eu -eu $(pwd) done readonly
+		'quoted text' $(pwd) grep cd echo export
+	"$1" 'quoted text' 2>/dev/null
+		then 2>/dev/null $(pwd)
+echo test "$1" x=1 test sed --verbose echo readonly then test /usr/bin
+		readonly $(pwd) && $(pwd) awk grep printf | "$@"
+/usr/bin 'quoted text' then awk echo awk local printf sed "$@" 'quoted text'
+	x=1 export /usr/bin $(pwd)
+--verbose readonly printf /usr/bin echo ${HOME} -eu 2>/dev/null
+	awk awk then "$1" -eu export 2>/dev/null
+	echo echo local cd "$@" sed local "$@" ${HOME} test
+	awk ${HOME} | x=1 $(pwd)
+	2>/dev/null ${HOME} echo "$1" 'quoted text' readonly test | printf echo
+		"$@" 'quoted text' "$1" -eu -eu awk test /usr/bin echo awk x=1
+x=1 "$1" export /usr/bin --verbose && --verbose
+local grep x=1 sed | cd "$1" /usr/bin readonly then -eu local printf -eu |
+done test /usr/bin | -eu cd 2>/dev/null readonly
+	echo awk echo sed -eu test
+		-eu printf "$@" then done
+"$@" readonly ${HOME} done
+	$(pwd) echo "$@" then grep "$1" then export local awk "$@" export "$@"
+	x=1 --verbose test readonly x=1 x=1 echo local sed done 2>/dev/null
+--verbose --verbose sed && readonly test
+	echo cd ${HOME} grep echo cd readonly test /usr/bin
+		x=1 ${HOME} sed x=1 -eu $(pwd) 2>/dev/null --verbose
+	export $(pwd) readonly printf /usr/bin cd then local echo cd
+test export test 2>/dev/null printf 'quoted text'
+	"$@" readonly then --verbose -eu --verbose 2>/dev/null ${HOME} export
+		'quoted text' $(pwd) export sed -eu ${HOME} x=1
+		local ${HOME} cd export 'quoted text' readonly
+		$(pwd) "$@" ${HOME} 'quoted text' awk 'quoted text' -eu ${HOME} "$@" sed
+	x=1 -eu cd test "$@" "$1"
+-eu echo 'quoted text' export done local
+	$(pwd) awk grep readonly $(pwd) cd then /usr/bin
+	test /usr/bin $(pwd) -eu ${HOME} awk -eu readonly -eu printf printf echo
+x=1 export x=1 "$1" "$@"
+	2>/dev/null "$1" readonly done
+&& "$1" done 2>/dev/null sed | cd -eu $(pwd) sed "$@" then 2>/dev/null
+	-eu --verbose grep local x=1 /usr/bin awk
+		test export grep export $(pwd) sed local | grep
+		$(pwd) "$@" --verbose && export 'quoted text'
+"$1" cd && done printf awk --verbose echo cd 'quoted text' $(pwd) export awk
+		then -eu x=1 cd -eu test cd cd then readonly 'quoted text' && "$1" 'quoted text'
+	$(pwd) 'quoted text' /usr/bin
+${HOME} "$1" 'quoted text' "$@" then -eu && "$@" x=1 test x=1
+	grep then grep test done -eu -eu export
+	"$@" cd ${HOME} 'quoted text' printf
+		sed "$@" readonly cd printf test
+	2>/dev/null export cd -eu $(pwd) && 2>/dev/null && sed
+	awk && grep x=1 then export "$1" "$1" local x=1
+		'quoted text' local ${HOME}
+		${HOME} "$1" $(pwd) local
+awk cd local local x=1 local 'quoted text' -eu $(pwd)
+		awk echo readonly 'quoted text' printf export 'quoted text' "$1" awk readonly
+-eu x=1 $(pwd) $(pwd) $(pwd) grep export /usr/bin test x=1 printf "$1" &&
+		echo printf "$1" then --verbose printf ${HOME}
+	awk awk x=1 | 'quoted text' --verbose printf --verbose --verbose --verbose
+x=1 "$1" --verbose -eu -eu done 2>/dev/null "$@" local then
+		'quoted text' sed done && export export
+		'quoted text' export $(pwd) test ${HOME} local export done "$1" grep
+$(pwd) 2>/dev/null grep local
+	'quoted text' export "$@" -eu export 2>/dev/null --verbose
+		--verbose export local | 2>/dev/null grep cd sed | $(pwd) printf --verbose done
+		export export readonly printf local cd then echo test $(pwd) 2>/dev/null
+		--verbose cd 2>/dev/null done --verbose /usr/bin
+		${HOME} export then -eu 'quoted text' ${HOME} /usr/bin &&
+	${HOME} 'quoted text' ${HOME}
+"$@" | "$1" && /usr/bin done 'quoted text' $(pwd) 2>/dev/null export
+cd x=1 "$@" $(pwd) 'quoted text' "$@" export $(pwd) -eu echo printf
+/usr/bin echo 'quoted text' done 2>/dev/null then
+	local && "$1" --verbose cd printf done -eu
+cd ${HOME} x=1 "$1" -eu 'quoted text' sed x=1 "$1" grep
+		$(pwd) sed "$@" "$1" printf
+		awk test done | "$@" test x=1 printf 'quoted text' $(pwd) "$@" --verbose
+"$@" export sed done | && cd $(pwd) grep && "$1" $(pwd) echo
+'quoted text' -eu readonly sed readonly $(pwd) done done cd 'quoted text' 2>/dev/null
+		export --verbose local done sed grep export readonly --verbose
+		| sed done printf "$@" /usr/bin printf
+--verbose && printf local readonly --verbose
+test 2>/dev/null echo then local awk then test 2>/dev/null then "$@"
+	"$1" 'quoted text' printf then
+	grep | --verbose /usr/bin ${HOME} | local "$@" --verbose
+export local test $(pwd) awk 2>/dev/null
+		'quoted text' "$@" awk
+		printf grep 2>/dev/null then &&
+--verbose 'quoted text' then && $(pwd)
+	--verbose then "$@" | sed printf
+	&& x=1 "$@" printf done done 'quoted text' --verbose
+then readonly $(pwd) done export /usr/bin x=1
+$(pwd) 2>/dev/null x=1 x=1 --verbose --verbose
+		done done done echo "$1" export "$@" cd export "$@" echo $(pwd)
+test readonly local local /usr/bin export -eu
+		cd -eu "$@" then printf test ${HOME} cd 'quoted text' | 'quoted text'
+		awk 2>/dev/null cd then echo awk readonly
+		--verbose printf export awk local
+2>/dev/null echo "$@" x=1 && local
+		$(pwd) "$1" --verbose | test --verbose "$@" readonly
+| x=1 grep x=1 ${HOME} 'quoted text' ${HOME} 'quoted text'
+	| x=1 echo printf x=1 && echo | x=1 grep test 'quoted text' $(pwd) | printf
+		printf echo test 2>/dev/null local -eu | /usr/bin
+x=1 test --verbose grep -eu readonly &&
+		cd | done sed sed 2>/dev/null /usr/bin printf "$1" readonly
+		done cd cd ${HOME} "$1"
+	then then | done export printf done 'quoted text'
+2>/dev/null /usr/bin && test grep --verbose
+&& 'quoted text' | sed done done test sed "$@" ${HOME}
+		2>/dev/null export sed readonly x=1 awk
+x=1 sed test echo ${HOME} awk then export ${HOME} cd "$@" echo echo ${HOME}
+	cd export $(pwd) then
+"$1" done $(pwd) printf cd cd "$1" test && done done done export cd
+grep /usr/bin cd then awk | "$1" cd
+	-eu done 'quoted text' ${HOME} then export grep "$@" test
+		"$1" x=1 echo awk awk "$1" then grep | -eu
+	echo "$1" && echo then 2>/dev/null readonly ${HOME}
+	awk awk grep x=1 echo done echo sed /usr/bin /usr/bin | -eu done && "$1" awk x=1
+	readonly done ${HOME} export | readonly cd $(pwd)
+&& echo --verbose echo $(pwd) export
+	| readonly echo $(pwd) cd "$1" readonly x=1 readonly
+		2>/dev/null sed awk local ${HOME} /usr/bin "$1" sed export then ${HOME}
+then awk cd 2>/dev/null sed cd /usr/bin /usr/bin 'quoted text'
+		then "$1" --verbose readonly
+	2>/dev/null && grep && local "$@" ${HOME} echo done then cd 2>/dev/null cd readonly
+done sed 'quoted text' local cd 'quoted text' /usr/bin -eu then cd | grep $(pwd)
+		readonly local && && sed | "$@" -eu && "$@" -eu cd x=1 awk readonly awk
+export /usr/bin 'quoted text'
+	awk ${HOME} ${HOME} local ${HOME} x=1 --verbose
+	grep cd readonly $(pwd) cd then 2>/dev/null 'quoted text' 'quoted text'
+${HOME} printf sed sed printf
+	echo && printf /usr/bin /usr/bin local readonly ${HOME}
+#include c72.sh
+/usr/bin $(pwd) cd done $(pwd) export readonly done test x=1 local awk
+		&& cd done done done cd /usr/bin | printf && $(pwd) printf
+| done cd ${HOME} readonly ${HOME} cd readonly $(pwd)
+	test cd local local test done
+${HOME} printf local "$1" /usr/bin
+		'quoted text' 2>/dev/null then --verbose test cd /usr/bin
+${HOME} 2>/dev/null readonly "$1" grep "$1" then test sed
+		done then x=1 local then
+		cd then "$@" "$1" readonly readonly "$1" /usr/bin --verbose 2>/dev/null
+		$(pwd) grep x=1 'quoted text' && test
+	'quoted text' test "$@" && done --verbose $(pwd) --verbose
+		"$1" -eu && "$1" grep --verbose awk -eu echo printf
+		grep | sed x=1 -eu "$1" --verbose "$1" printf $(pwd) readonly /usr/bin
+--verbose printf local | test
+	'quoted text' cd readonly 2>/dev/null ${HOME} x=1 -eu readonly
+local && cd | test ${HOME} "$@"
+--verbose -eu ${HOME} awk awk "$1" export grep "$1"
+		cd | "$1" sed 'quoted text' "$1" "$@" export x=1 | && /usr/bin 'quoted text'
+	"$1" then printf | $(pwd) readonly /usr/bin -eu 'quoted text' awk ${HOME} $(pwd)
+${HOME} ${HOME} --verbose /usr/bin "$@" echo ${HOME} "$1" ${HOME} | x=1
+		sed "$@" printf 'quoted text'
+		test -eu local 'quoted text'
+	&& echo /usr/bin grep ${HOME} $(pwd) cd printf ${HOME} readonly
+	echo export done --verbose export "$@" done grep then
+awk $(pwd) local ${HOME} then
+	&& grep grep then test printf cd echo
+	"$@" done printf cd awk awk
+		done grep -eu echo printf --verbose
+${HOME} grep --verbose grep export $(pwd) $(pwd) sed --verbose --verbose
+printf $(pwd) readonly --verbose /usr/bin -eu 2>/dev/null grep
+		${HOME} 'quoted text' -eu export echo grep $(pwd)
+		-eu local x=1 echo cd then echo 2>/dev/null done --verbose "$@" -eu $(pwd)
+		/usr/bin sed /usr/bin then printf local local -eu /usr/bin 'quoted text'
+		awk printf --verbose $(pwd) grep grep readonly
+		cd x=1 "$1" printf $(pwd) x=1 -eu ${HOME} --verbose printf awk
+sed echo "$@" | x=1 test cd -eu "$@"
+		--verbose ${HOME} /usr/bin 'quoted text' "$@"
+	--verbose then then "$@" && --verbose export $(pwd) local x=1 x=1 2>/dev/null
+		cd "$1" "$@" done test 2>/dev/null test sed x=1 | then
+	then "$1" export --verbose local export
+	/usr/bin awk --verbose 'quoted text' ${HOME} grep sed echo "$1" then 2>/dev/null
+		$(pwd) cd export sed then && then printf test
+		--verbose /usr/bin grep 'quoted text'
+		${HOME} $(pwd) --verbose export /usr/bin
+local test 'quoted text' "$@" echo awk printf $(pwd)
+	/usr/bin export $(pwd) test -eu test
+		echo ${HOME} test awk sed 2>/dev/null "$1" -eu local readonly
+/usr/bin readonly grep 'quoted text' x=1 "$@" test local local grep -eu
+		sed printf cd export -eu
+grep ${HOME} --verbose ${HOME} awk readonly --verbose test $(pwd) sed
+| && --verbose x=1 awk done local sed /usr/bin | then grep readonly awk 'quoted text'
+		test test 2>/dev/null grep 'quoted text'
+		&& --verbose then then ${HOME} "$@" done --verbose done 'quoted text'
+	then 2>/dev/null test 2>/dev/null
+cd awk $(pwd) | readonly && export printf && echo /usr/bin grep
+-eu echo -eu "$1" 'quoted text' done
+		printf cd readonly sed -eu done readonly 'quoted text'
+	| local test $(pwd) echo | $(pwd) ${HOME} grep test local awk x=1
+| "$@" "$1" | "$1" export then awk x=1 'quoted text' local test grep
+	echo "$1" x=1 --verbose local 'quoted text' ${HOME} --verbose -eu x=1
+	'quoted text' 2>/dev/null $(pwd) awk test | done x=1 export
+	done "$@" cd printf ${HOME} 'quoted text' ${HOME} --verbose local
+	/usr/bin 'quoted text' test && --verbose && sed done export readonly
+		x=1 local readonly awk "$@" | 2>/dev/null 2>/dev/null
+		local "$1" awk /usr/bin "$@" sed -eu $(pwd) printf ${HOME} 2>/dev/null | local
+	grep 2>/dev/null ${HOME} readonly cd x=1 "$1" then --verbose $(pwd) /usr/bin
+done "$1" grep ${HOME} --verbose
+		x=1 $(pwd) $(pwd) | then $(pwd) x=1 then -eu local
+	| cd local && $(pwd) awk | && done 'quoted text' grep sed 'quoted text'
+	2>/dev/null test done 'quoted text' grep && $(pwd) $(pwd) echo
+done then ${HOME} echo 2>/dev/null 2>/dev/null -eu printf readonly
+"$1" "$1" | printf && $(pwd) | local $(pwd) /usr/bin --verbose grep $(pwd)
+	$(pwd) "$1" printf "$@" $(pwd) cd sed 'quoted text' then grep local
+		export test x=1 export readonly sed printf grep awk done then $(pwd)
+		| ${HOME} cd "$1" local
+	awk 2>/dev/null readonly /usr/bin /usr/bin | local 'quoted text'
+	--verbose echo test --verbose | x=1
+-eu x=1 | --verbose grep "$@" done
+x=1 printf | 2>/dev/null -eu cd /usr/bin
+2>/dev/null --verbose then done cd readonly -eu readonly cd
+"$1" then readonly "$1" && $(pwd) -eu "$1" ${HOME} printf echo sed && grep
+	"$@" then --verbose x=1 $(pwd) then export then sed local "$1"
+echo ${HOME} export "$1" "$@" sed 'quoted text'
+	"$@" awk then grep 2>/dev/null "$1" | $(pwd) "$1" --verbose
+then awk done then 2>/dev/null sed "$1" done then readonly -eu local "$1" cd
+	cd /usr/bin test "$1" "$1" cd printf
+awk /usr/bin test "$@" $(pwd) cd sed done | ${HOME} "$1" sed grep -eu
+		export echo && grep sed cd ${HOME} x=1 -eu -eu "$1" $(pwd) printf
+	cd then then /usr/bin readonly readonly -eu readonly printf
+		$(pwd) echo awk /usr/bin echo sed | 2>/dev/null -eu |
+awk export "$@" 'quoted text' cd local then
+		cd 2>/dev/null 2>/dev/null --verbose test export done echo "$1" 2>/dev/null
+-eu then /usr/bin local done
+--verbose /usr/bin /usr/bin readonly
+2>/dev/null "$1" printf x=1 cd
+test $(pwd) "$1" x=1 "$@" $(pwd)
+	"$1" $(pwd) --verbose printf x=1
+'quoted text' -eu then
+/usr/bin sed local 2>/dev/null test /usr/bin 2>/dev/null sed readonly
+		local then done grep
+		--verbose | -eu readonly cd cd echo "$@" local
+then --verbose 'quoted text' --verbose "$@" 'quoted text'
+done then printf echo 2>/dev/null grep x=1 ${HOME} awk
+	${HOME} "$@" "$@" -eu 2>/dev/null then sed done $(pwd) cd then | |
+	&& readonly done ${HOME} grep
+		printf ${HOME} x=1 then cd echo cd echo && -eu
+		done -eu "$1" grep x=1 --verbose
+		&& test -eu | --verbose then 2>/dev/null sed cd -eu local printf cd echo export
+	cd readonly "$@" sed printf test /usr/bin 2>/dev/null --verbose echo
+test readonly test cd -eu
+		printf && cd $(pwd) "$@" /usr/bin cd "$@" --verbose 'quoted text'
+		then /usr/bin 'quoted text' done local /usr/bin
+	printf local -eu test "$1" test export
+	then ${HOME} readonly
+	export | 'quoted text'
+test --verbose --verbose printf
+	echo echo -eu /usr/bin export sed printf local printf
+x=1 -eu done awk /usr/bin x=1 then echo 'quoted text' then
+		| 2>/dev/null sed printf then then printf done echo
+${HOME} printf test $(pwd) awk
+	"$1" sed printf x=1 readonly | 'quoted text' printf "$1" x=1 awk done local ${HOME}
+echo printf /usr/bin readonly --verbose done readonly
+		grep && then && cd $(pwd) ${HOME}
+		sed done printf "$@" 2>/dev/null
+	${HOME} export echo done awk x=1 test awk -eu && cd --verbose
+printf test printf test readonly done
+		'quoted text' --verbose export awk ${HOME} | awk /usr/bin echo "$1" 'quoted text'
+2>/dev/null echo && && ${HOME} local grep grep 'quoted text'
+printf | | sed 2>/dev/null -eu printf 'quoted text' export export
+	export local then printf then printf $(pwd) sed ${HOME} sed 2>/dev/null ${HOME}
+"$1" "$1" | /usr/bin 'quoted text' export "$@" test -eu grep done "$@"
+		readonly $(pwd) done grep /usr/bin sed done
+	cd awk export sed | "$@" grep sed grep grep local
+	printf -eu sed local echo printf x=1 sed then "$1" printf grep
+&& grep "$1" --verbose echo -eu printf 2>/dev/null done --verbose then sed
+		-eu done -eu && /usr/bin x=1 then cd /usr/bin && "$1" $(pwd) done export
+	awk -eu export test sed printf "$1" cd $(pwd) export local
+	/usr/bin && printf /usr/bin test
+	then cd 'quoted text' local export then $(pwd) cd cd -eu awk --verbose readonly
+		x=1 cd "$@" echo printf awk $(pwd) grep awk echo cd ${HOME}
+		grep | 'quoted text' --verbose 'quoted text' then &&
+test ${HOME} 'quoted text' $(pwd) 'quoted text' readonly
+echo && printf echo /usr/bin $(pwd) echo awk local 2>/dev/null "$1"
+sed -eu sed $(pwd) then awk 'quoted text' sed printf -eu x=1 test 'quoted text'
+	"$1" grep "$@" $(pwd) local echo awk test /usr/bin "$@"
+	cd -eu echo test test "$1" "$@" printf sed grep grep ${HOME} 'quoted text' && readonly
+awk ${HOME} sed test && /usr/bin 'quoted text'
+'quoted text' sed "$1" "$@" sed --verbose done readonly
+	"$1" "$1" ${HOME} $(pwd) ${HOME} "$@" echo echo -eu
+	'quoted text' echo echo 'quoted text' x=1 export local "$1" then local | awk
+'quoted text' /usr/bin grep done 'quoted text' done
+then ${HOME} then readonly printf 'quoted text' echo $(pwd) 2>/dev/null printf
+grep export x=1 awk grep sed cd ${HOME} grep -eu | then
+		| --verbose -eu --verbose then $(pwd) sed $(pwd) cd printf 2>/dev/null
+${HOME} ${HOME} then readonly "$@"
+		cd 'quoted text' local sed x=1 x=1 printf echo sed printf done local && $(pwd)
+	sed done && local export "$@" printf x=1 then
+	x=1 awk --verbose 'quoted text' then --verbose
+	echo ${HOME} readonly grep --verbose -eu
+		2>/dev/null --verbose --verbose
+		/usr/bin echo sed echo readonly &&
+		x=1 cd test $(pwd) grep "$@" && sed /usr/bin /usr/bin test printf x=1 "$1" 'quoted text'
+		2>/dev/null readonly 2>/dev/null
+		&& local done readonly -eu ${HOME} echo -eu && done x=1 && readonly sed -eu then
+sed "$@" $(pwd) done /usr/bin 2>/dev/null
+/usr/bin /usr/bin x=1 'quoted text' then /usr/bin
+local export -eu | grep echo readonly x=1 cd sed "$@" cd readonly awk
+sed 2>/dev/null /usr/bin | test
+		local "$1" 2>/dev/null "$1" "$1" "$@" && test /usr/bin 'quoted text'
+		printf $(pwd) ${HOME} sed
+		cd /usr/bin test test grep echo 2>/dev/null "$@" export local
+	printf echo sed export -eu x=1 readonly "$1" export cd && then
+		${HOME} local printf readonly ${HOME} --verbose 'quoted text' ${HOME}
+then awk x=1 printf -eu grep cd $(pwd) then test sed test
+		test printf /usr/bin echo done local
+		echo local grep --verbose sed export x=1 readonly done | | -eu grep then
+test && grep 'quoted text' && "$1" 'quoted text' 2>/dev/null |
+&& then echo done grep && 'quoted text' x=1 ${HOME} test done /usr/bin printf
+	2>/dev/null -eu 2>/dev/null -eu "$@" ${HOME} export /usr/bin
+		2>/dev/null 2>/dev/null /usr/bin echo done sed x=1 && 'quoted text' $(pwd) awk
+${HOME} local 2>/dev/null | echo grep
+	2>/dev/null ${HOME} ${HOME} "$@"
+	--verbose x=1 --verbose | readonly 2>/dev/null x=1 printf && --verbose
+"$@" export -eu | done -eu grep cd awk then $(pwd) -eu
+readonly x=1 echo readonly $(pwd) readonly ${HOME} 2>/dev/null
+		"$1" done printf ${HOME} -eu awk
+		$(pwd) printf -eu | x=1
+/usr/bin local local test $(pwd) printf 'quoted text' local | "$1" "$1"
+	"$1" x=1 cd grep then grep sed --verbose local sed
+local 'quoted text' local readonly then then 'quoted text' done
+		"$@" ${HOME} export echo grep export done test test printf local 'quoted text'
+	--verbose local 'quoted text' then awk export grep export x=1 $(pwd)
+	test && | "$@" sed sed x=1 "$1" awk "$1" 'quoted text' readonly
+	/usr/bin readonly x=1 printf 'quoted text'
+"$1" printf cd printf $(pwd) then 2>/dev/null then export | printf grep
+		export $(pwd) "$@" 2>/dev/null --verbose "$1" $(pwd)
+	export -eu ${HOME} "$1" ${HOME} sed test "$1" ${HOME} $(pwd)
+	| && grep 'quoted text' done x=1 printf && echo "$1" sed "$@" readonly
+	done /usr/bin printf sed echo $(pwd) export export | ${HOME} | | then x=1 echo -eu
+		2>/dev/null printf 'quoted text' | test &&
+	"$1" | x=1 grep "$1" /usr/bin readonly $(pwd) export "$1" "$@" awk then readonly
+	test export "$1" awk echo /usr/bin && 'quoted text' $(pwd) "$1" printf
+"$@" ${HOME} done ${HOME} 'quoted text' done $(pwd)
+		echo test /usr/bin && 2>/dev/null
+		"$@" $(pwd) cd test grep && /usr/bin
+		printf done printf "$@" then 'quoted text'
+echo cd local 'quoted text' awk "$@" --verbose
+-eu cd && /usr/bin 2>/dev/null x=1 export sed x=1 -eu | local -eu
+/usr/bin ${HOME} 2>/dev/null -eu test ${HOME} $(pwd) printf then
+	/usr/bin x=1 "$@" readonly echo sed grep readonly x=1 grep cd -eu
+		awk && x=1 $(pwd) test "$@" ${HOME}
+test sed awk grep ${HOME} export /usr/bin "$@" awk --verbose
+		echo "$1" $(pwd) /usr/bin && local /usr/bin $(pwd)
+		grep "$@" ${HOME} local cd x=1
+		--verbose "$1" export then readonly 2>/dev/null
+		| readonly test $(pwd) $(pwd) x=1 cd awk then ${HOME} ${HOME} --verbose
+	grep && echo && sed $(pwd) export sed 2>/dev/null 2>/dev/null $(pwd) echo $(pwd)
+export "$@" -eu export grep x=1 cd /usr/bin readonly then
+		printf grep printf 2>/dev/null
+	'quoted text' echo -eu sed ${HOME} /usr/bin x=1 && cd "$@" /usr/bin
+		"$1" grep export printf "$@" | printf done readonly awk x=1 cd export local printf
+		/usr/bin done sed test &&
+printf awk local -eu export test export
+-eu echo -eu grep awk "$@" "$1" done printf 2>/dev/null echo cd 2>/dev/null
+"$@" test ${HOME} -eu
+'quoted text' x=1 'quoted text' local grep
+	| "$1" /usr/bin | export /usr/bin printf cd cd "$@" grep
+	2>/dev/null test export local $(pwd) local
+		done && cd export cd grep ${HOME} then ${HOME} then x=1 sed grep x=1 && done
+		export local "$1" 'quoted text' readonly export sed /usr/bin
+	grep test -eu printf | 'quoted text' export local ${HOME} | cd test grep
+readonly cd "$1" printf $(pwd) test 'quoted text' then 2>/dev/null 2>/dev/null
+		$(pwd) local /usr/bin printf 'quoted text' export
+		${HOME} cd local echo cd readonly printf 'quoted text' "$@" test local sed $(pwd)
+		'quoted text' then -eu readonly
+	echo awk done 'quoted text' awk done -eu then ${HOME}
+	--verbose echo ${HOME} local echo && && 2>/dev/null done sed -eu "$@"
+	grep echo "$1" grep local
+x=1 "$1" | 2>/dev/null export
+grep printf x=1 x=1 --verbose x=1 --verbose && "$1" --verbose awk /usr/bin "$1"
+	export --verbose $(pwd) 'quoted text' && "$1" printf "$@" awk "$1" | grep 'quoted text'
+'quoted text' local 'quoted text' then readonly
+"$@" echo grep cd /usr/bin --verbose 'quoted text' then grep -eu
+		--verbose -eu -eu then then readonly
+		awk && sed export then cd 'quoted text' -eu "$1" local ${HOME} 'quoted text' /usr/bin
+		${HOME} "$@" echo x=1 then test local | grep $(pwd) sed ${HOME} test
+		$(pwd) then grep then readonly --verbose
+	'quoted text' | -eu $(pwd) grep awk x=1 "$1" 2>/dev/null sed done |
+	'quoted text' readonly && && awk 2>/dev/null "$@" then 'quoted text'
+sed 'quoted text' done x=1 local awk echo done ${HOME}
+readonly "$1" sed printf sed sed cd then readonly --verbose export
+		printf $(pwd) test "$@" printf --verbose awk 'quoted text' $(pwd)
+readonly -eu 'quoted text' echo ${HOME}
+		/usr/bin printf $(pwd) ${HOME} 2>/dev/null done echo
+$(pwd) grep awk readonly "$1" 'quoted text' "$1" test readonly --verbose awk &&
+		export 'quoted text' x=1 -eu done $(pwd) done test | $(pwd)
+grep then sed && | 'quoted text' x=1 2>/dev/null
+${HOME} test && export then local 'quoted text' x=1 2>/dev/null test
+		--verbose 'quoted text' 'quoted text' | 'quoted text'
+		grep $(pwd) /usr/bin "$1" readonly grep "$@" | grep sed then
+		| "$@" --verbose awk "$@" --verbose |
+--verbose grep && 2>/dev/null
+	"$@" awk "$@" $(pwd) printf printf awk ${HOME} -eu awk echo sed local | | sed
+export -eu echo x=1 $(pwd) && 'quoted text'
+		sed export then /usr/bin "$@" echo sed 'quoted text' && 2>/dev/null
+printf local -eu done local 'quoted text'
+	"$@" export 2>/dev/null && && 'quoted text' "$1" /usr/bin
+-eu cd sed then echo --verbose 'quoted text' $(pwd) $(pwd)
+	x=1 | awk --verbose ${HOME} readonly done done done test grep
+	local export "$1" readonly done
+| sed 2>/dev/null cd "$@"
+$(pwd) sed "$1" --verbose sed done
+		${HOME} --verbose x=1 printf then --verbose export cd "$@" awk echo | "$@" "$@"
+-eu "$@" export export && --verbose
+		then test readonly ${HOME} 'quoted text' /usr/bin /usr/bin printf $(pwd) 2>/dev/null
+grep -eu export done ${HOME} done then
+	local "$1" readonly cd test "$@"
+		"$@" grep "$@" 2>/dev/null $(pwd) export | readonly
+		--verbose x=1 x=1 2>/dev/null sed echo --verbose 2>/dev/null printf grep $(pwd)
+	printf then "$@" "$@" $(pwd) "$1" && test sed &&
+	${HOME} "$1" | "$1" readonly local 2>/dev/null $(pwd) $(pwd)
+grep cd ${HOME} | -eu printf x=1 then | echo
+	grep && echo 'quoted text' done ${HOME} 'quoted text' | -eu done x=1 sed test ${HOME}
+	readonly /usr/bin local /usr/bin /usr/bin printf then
+		test 'quoted text' then done --verbose 'quoted text' done
+printf grep --verbose then x=1 $(pwd) "$@" then
+echo grep then && -eu export grep "$1" cd then 2>/dev/null &&
+	$(pwd) cd -eu printf ${HOME} 2>/dev/null sed "$@"
+		| "$1" sed | 2>/dev/null /usr/bin $(pwd)
+	grep --verbose -eu && | export --verbose
+	"$1" test -eu awk /usr/bin cd printf readonly echo readonly
+awk && 2>/dev/null /usr/bin x=1
+		cd sed $(pwd) sed 'quoted text' done /usr/bin
+		2>/dev/null readonly local grep test export 2>/dev/null
+		/usr/bin -eu "$@" --verbose "$@" /usr/bin "$1" echo --verbose
+		test readonly 2>/dev/null printf |
+		"$1" "$1" cd "$@" 2>/dev/null test
+/usr/bin 'quoted text' export 'quoted text' grep x=1 "$@" awk 2>/dev/null
+	printf printf test local
+/usr/bin | && 2>/dev/null x=1 && sed "$1" grep awk $(pwd)
+$(pwd) test | 'quoted text' ${HOME}
+/usr/bin --verbose test done export x=1 done "$1" "$1" | "$1" sed
+cd readonly 'quoted text' ${HOME} x=1 $(pwd) ${HOME} test then && x=1 && $(pwd)
+x=1 "$1" grep | 'quoted text'
+		test -eu sed cd && 2>/dev/null /usr/bin done readonly $(pwd) printf
+		sed /usr/bin -eu printf -eu --verbose local --verbose sed $(pwd) |
+		readonly readonly "$1" grep printf && readonly
+	/usr/bin sed "$1" --verbose sed grep "$1"
+		$(pwd) echo "$1" sed 2>/dev/null /usr/bin 2>/dev/null $(pwd) sed echo 'quoted text'
+printf done cd then awk readonly 'quoted text'
+	x=1 2>/dev/null printf then | test sed 'quoted text'
+		"$1" | 'quoted text' export --verbose x=1 2>/dev/null 2>/dev/null "$1" awk
+		$(pwd) x=1 sed $(pwd) done
+$(pwd) x=1 | "$1" readonly
+		awk local ${HOME} then
+&& | /usr/bin export readonly then x=1 echo --verbose
+done "$1" $(pwd) grep -eu echo echo -eu
+		| awk --verbose echo done "$1" test "$@" -eu done -eu sed 'quoted text' $(pwd)
+	| "$@" 'quoted text' 2>/dev/null x=1 'quoted text' awk grep ${HOME} -eu
+		local x=1 grep export awk then export "$@" 2>/dev/null
+		&& local 2>/dev/null /usr/bin ${HOME} done export -eu x=1 x=1 x=1 |
+awk 'quoted text' | 'quoted text' -eu readonly "$1" cd done awk
+	cd cd x=1 --verbose "$@" export export printf -eu --verbose /usr/bin x=1 cd 'quoted text'
+	x=1 grep 2>/dev/null "$@" grep export && 2>/dev/null
+2>/dev/null /usr/bin 'quoted text' ${HOME} awk && && 2>/dev/null export
+	awk cd /usr/bin awk -eu && && echo "$@" test $(pwd)
+	/usr/bin | awk | --verbose $(pwd) 2>/dev/null export
+		'quoted text' then done
+		local 2>/dev/null /usr/bin 2>/dev/null "$1" | readonly echo
+-eu test "$@" local echo then grep 2>/dev/null "$1" test "$1" local
+	--verbose --verbose then awk "$1" && echo echo sed -eu ${HOME} ${HOME} awk
+$(pwd) 2>/dev/null && "$1" echo /usr/bin awk --verbose then readonly
+--verbose "$1" 'quoted text' cd -eu done sed 'quoted text' sed then done
+		sed ${HOME} then export "$@" test export
+		awk && $(pwd) /usr/bin --verbose grep echo echo | echo 'quoted text' printf
+	'quoted text' && grep then export "$1" sed then
+		x=1 ${HOME} /usr/bin ${HOME} && --verbose
+printf grep readonly --verbose --verbose awk ${HOME}
+		2>/dev/null && grep then echo "$1" readonly
+-eu sed grep cd "$1" --verbose printf && x=1 $(pwd)
+printf --verbose 2>/dev/null grep
+		export awk awk && test done $(pwd) --verbose then
+	--verbose printf 'quoted text' sed "$@" sed "$@" /usr/bin
+sed && --verbose --verbose
+	grep echo cd then printf ${HOME} -eu 2>/dev/null
+	| echo --verbose && && grep /usr/bin
+	x=1 ${HOME} 'quoted text' export test local "$@" export x=1 awk | | $(pwd)
+		| /usr/bin echo ${HOME} && | test awk /usr/bin x=1 --verbose done
+	/usr/bin $(pwd) x=1 readonly awk /usr/bin sed sed local 'quoted text'
+		echo -eu | echo grep | && test
+		printf cd awk local | -eu x=1 $(pwd) readonly test "$1" && then ${HOME} export --verbose
+		&& export -eu "$1" then done done done
+		| export grep x=1 && | --verbose --verbose --verbose
+	awk local 'quoted text' && printf
+		$(pwd) 'quoted text' --verbose done x=1 --verbose
+	then --verbose test echo test 2>/dev/null 'quoted text' printf
+--verbose 'quoted text' $(pwd) sed awk ${HOME} x=1 echo then 'quoted text'
+	printf echo "$@" then "$1" then 2>/dev/null local -eu "$@" readonly local
+	2>/dev/null /usr/bin --verbose 2>/dev/null /usr/bin awk &&
+	sed test done $(pwd) -eu sed -eu "$1" local -eu
+	grep cd awk done x=1 "$1"
+	cd then cd 2>/dev/null local readonly local grep /usr/bin "$@" awk readonly
+printf then 2>/dev/null printf x=1 test done
+x=1 "$1" local $(pwd) ${HOME} echo readonly "$1" readonly -eu
+		grep "$@" | awk then done local ${HOME} sed | --verbose awk
+		sed export $(pwd) "$@"
+	printf readonly cd then 'quoted text'
+"$@" awk then echo then test export printf awk ${HOME}
+		sed x=1 readonly x=1 readonly | ${HOME} "$1" | local
+		test --verbose -eu awk $(pwd)
+sed 'quoted text' && x=1 then export $(pwd) then printf | --verbose "$1" $(pwd)
+		test && echo | x=1 echo done export "$@" cd | printf done
+	&& && printf "$1" 'quoted text' -eu |
+		${HOME} then printf sed 'quoted text' printf
+		--verbose | awk x=1 echo
+	"$1" echo | $(pwd) && grep x=1 --verbose done /usr/bin echo 2>/dev/null -eu echo
+	test --verbose "$@" grep export 2>/dev/null $(pwd)
+	/usr/bin x=1 local "$1" "$1" ${HOME} awk test ${HOME}
+	/usr/bin done 'quoted text' grep /usr/bin | local $(pwd) then /usr/bin
+	$(pwd) "$1" printf export sed readonly test "$@" sed export
+	cd x=1 | --verbose echo readonly printf -eu echo x=1 2>/dev/null /usr/bin
+		echo | grep sed readonly
+2>/dev/null sed export 2>/dev/null --verbose
+	'quoted text' "$@" /usr/bin "$1"
+	readonly then ${HOME} ${HOME} "$1" cd 'quoted text' x=1 readonly
+		export "$@" | test "$@" "$1" cd ${HOME} cd then printf
+		then readonly test 2>/dev/null
+		"$1" x=1 sed test "$1" | cd printf /usr/bin x=1 grep
+	sed then done printf then "$@"
+	grep printf awk --verbose "$1" cd test
+		cd -eu $(pwd) 'quoted text' echo printf 'quoted text' grep --verbose /usr/bin local
+	"$@" $(pwd) sed export grep export
+	'quoted text' grep $(pwd) local grep done test "$@" done x=1 done test
+	-eu echo echo -eu printf grep | -eu
+	readonly "$1" "$1" x=1 2>/dev/null export printf export
+	"$@" export grep "$@" -eu echo printf /usr/bin
+	done local -eu printf cd $(pwd) echo printf echo cd --verbose && -eu test
+		done awk export ${HOME} local x=1 $(pwd) 2>/dev/null
+		awk local echo sed $(pwd) printf 'quoted text' $(pwd) $(pwd) readonly
+	readonly export "$@" cd --verbose
+sed /usr/bin cd done $(pwd) done 'quoted text' 2>/dev/null awk 2>/dev/null 'quoted text'
+done /usr/bin readonly 2>/dev/null sed 'quoted text'
+--verbose awk awk done printf
+		--verbose ${HOME} ${HOME} 'quoted text'
+		then awk cd -eu ${HOME} local echo then "$@" printf test
+	--verbose awk | cd "$1" done local cd "$@" --verbose awk "$@" awk cd cd --verbose
+		"$@" "$@" "$1" cd then readonly grep local -eu "$1" 2>/dev/null
+	"$@" x=1 awk && -eu /usr/bin done
+	"$@" readonly "$1" x=1 done x=1 sed ${HOME} $(pwd) 'quoted text'
+2>/dev/null printf -eu printf
+sed readonly then 2>/dev/null cd x=1 2>/dev/null done
+	"$@" 2>/dev/null then
+export -eu "$1" "$@" export printf "$1" grep
+		${HOME} | echo awk export "$@" local | test sed $(pwd) readonly
+	x=1 | -eu readonly then "$@"
+		"$@" "$@" "$1" readonly "$@" $(pwd) awk export "$@" "$@" local 'quoted text'
+		/usr/bin local export test awk
+	x=1 && 2>/dev/null awk export sed 2>/dev/null -eu done ${HOME} then printf
+	echo grep test x=1 cd x=1 grep $(pwd) && readonly printf done
+cd sed cd "$@" -eu printf ${HOME} ${HOME} 'quoted text' printf
+		"$@" 2>/dev/null x=1 ${HOME} ${HOME} readonly done readonly -eu --verbose
+		--verbose /usr/bin done -eu sed &&
+		&& "$@" sed "$1" sed cd -eu "$@"
+	'quoted text' printf 2>/dev/null
+	$(pwd) --verbose then 'quoted text' test grep
+		x=1 sed test local 'quoted text'
+'quoted text' x=1 printf -eu x=1 ${HOME} grep awk 2>/dev/null -eu
+$(pwd) printf "$1" 'quoted text'
+	2>/dev/null awk local
+	export 'quoted text' echo cd "$1" 2>/dev/null readonly "$@"
+		sed grep grep echo local cd 'quoted text' ${HOME} -eu | done
+local "$@" /usr/bin export "$@" grep -eu grep &&
+	x=1 sed printf ${HOME} ${HOME} test
+x=1 readonly printf 2>/dev/null /usr/bin echo
+	'quoted text' test printf local
+printf /usr/bin test echo cd export | test test 'quoted text'
+		echo export "$1" /usr/bin
+		"$1" cd grep local printf cd echo done
+${HOME} --verbose awk cd | 'quoted text' --verbose x=1 readonly local done
+		-eu 'quoted text' $(pwd)
+		sed -eu /usr/bin ${HOME} echo then "$@" -eu
+	$(pwd) "$1" export echo --verbose grep x=1 local printf test then awk
+	awk then && x=1 echo printf done echo --verbose grep && /usr/bin "$@"
+printf test ${HOME} test done readonly awk grep /usr/bin
+	"$1" awk -eu done sed --verbose "$1"
+	test grep -eu "$@" readonly cd readonly /usr/bin
+	export && --verbose export sed grep -eu echo readonly && done printf
+		--verbose 'quoted text' local
+/usr/bin awk test ${HOME}
+awk echo "$@" readonly
+	-eu cd /usr/bin | test
+	readonly local export local awk | test echo | export export ${HOME}
+		grep $(pwd) printf test cd test x=1 ${HOME} /usr/bin x=1 && ${HOME} $(pwd) cd
+| | --verbose 'quoted text'
+	${HOME} sed ${HOME} done ${HOME} "$@" local | printf local local "$@" cd 'quoted text'
+	then local | grep cd sed echo "$@" echo local x=1 readonly
+		export $(pwd) readonly done
+		/usr/bin done | ${HOME} export cd 'quoted text'
+		'quoted text' 2>/dev/null then then local local "$1" 'quoted text'
+	export 2>/dev/null done echo printf printf
+		readonly --verbose -eu then "$@" 2>/dev/null x=1 ${HOME} test local test
+cd printf grep cd 2>/dev/null awk --verbose 'quoted text' "$1"
+	then export printf "$1"
+		${HOME} /usr/bin | then then sed
+		done then printf ${HOME}
+| --verbose x=1 then /usr/bin cd -eu local
+		test grep export readonly ${HOME} readonly
+"$@" -eu done -eu printf "$@" && then --verbose 2>/dev/null
+'quoted text' sed cd $(pwd) -eu awk "$@" awk cd cd test echo
+| 2>/dev/null $(pwd) done export then x=1 sed /usr/bin 'quoted text'
+'quoted text' test cd export
+		-eu done awk /usr/bin 2>/dev/null x=1 test cd
+		"$@" awk /usr/bin test && done echo /usr/bin awk x=1 "$@" export /usr/bin
+	echo x=1 then ${HOME} local -eu then "$1" 'quoted text'
+		| test "$@" local printf -eu 2>/dev/null 2>/dev/null test "$@" -eu
+		2>/dev/null awk awk sed | $(pwd) echo ${HOME} grep then export echo "$1"
+${HOME} 'quoted text' sed 2>/dev/null sed x=1 'quoted text' sed
+	--verbose "$1" test 2>/dev/null /usr/bin 'quoted text'
+		'quoted text' "$@" grep cd grep &&
+readonly "$1" ${HOME} readonly
+	2>/dev/null then cd export
+		then awk | awk cd cd readonly sed
+		x=1 --verbose awk "$@" x=1 test "$@" test
+	cd sed /usr/bin "$@" "$1" --verbose local printf local
+"$@" printf | readonly | 'quoted text' /usr/bin | 'quoted text'
+		done echo readonly then x=1 printf $(pwd) export
+		printf printf test "$1" && 2>/dev/null test /usr/bin
+		"$1" 'quoted text' printf --verbose printf then awk printf echo sed export test
+	$(pwd) sed --verbose printf | awk x=1 export $(pwd)
+then /usr/bin 2>/dev/null 'quoted text' |
+		cd && -eu sed -eu done sed grep "$1" $(pwd) "$@" ${HOME} ${HOME} readonly
+		grep "$@" --verbose export
+		--verbose echo --verbose "$1"
+		done "$@" then cd echo printf then "$1"
+$(pwd) readonly -eu done ${HOME}
+		2>/dev/null then local 2>/dev/null grep ${HOME} cd grep echo | $(pwd) /usr/bin
+		export "$@" "$@" awk cd $(pwd) cd printf export 2>/dev/null
+-eu x=1 test cd x=1 sed local && readonly done done 2>/dev/null "$1" 'quoted text'
+cd export sed local 2>/dev/null
+/usr/bin done ${HOME} printf 'quoted text' printf
+		echo $(pwd) done sed echo
+	| -eu ${HOME} "$1" && -eu && $(pwd)
+cd --verbose "$1" "$1" done ${HOME}
+'quoted text' awk | | local local
+		&& 'quoted text' -eu | test -eu then printf export echo
+		readonly --verbose && $(pwd)
+	readonly awk | test --verbose local readonly test printf
+	cd printf done 2>/dev/null 'quoted text' printf local grep readonly awk then done
+	export echo then $(pwd) x=1 cd
+	| cd grep local | readonly && sed awk -eu --verbose done | /usr/bin
+readonly -eu sed "$@" test readonly 'quoted text' x=1 cd 2>/dev/null
+"$@" && cd "$@" "$@" grep x=1 cd readonly
+		'quoted text' test then readonly --verbose sed
+${HOME} local export 'quoted text' done "$1" test 2>/dev/null 'quoted text' sed
+	readonly sed /usr/bin export "$@" then done
+		test $(pwd) "$1" --verbose export
+	readonly export ${HOME} x=1 -eu test cd ${HOME} && awk sed /usr/bin 2>/dev/null
+		"$@" -eu grep grep "$1" grep ${HOME} -eu $(pwd) $(pwd) -eu 2>/dev/null | awk awk
+	$(pwd) 'quoted text' echo sed /usr/bin
+		sed local && "$@" local /usr/bin
+	grep echo --verbose && 2>/dev/null | $(pwd) export readonly
+done local cd printf | done test export test local readonly
+test ${HOME} --verbose && x=1
+		/usr/bin awk local test local "$1" test awk done readonly test
+"$@" 2>/dev/null 2>/dev/null cd done then then
+x=1 'quoted text' --verbose ${HOME} local 'quoted text' readonly cd
+	| && test 2>/dev/null export sed x=1 && /usr/bin cd readonly &&
+"$1" awk && grep sed awk awk $(pwd) 'quoted text' $(pwd) |
+	printf $(pwd) ${HOME} 2>/dev/null ${HOME} /usr/bin grep "$@" /usr/bin export
+		printf 2>/dev/null test then $(pwd) -eu readonly export
+		2>/dev/null test "$1" test && printf 2>/dev/null echo "$1" "$@" test ${HOME}
+		| -eu "$1" export awk export done cd echo && test /usr/bin test done "$1" awk &&
+| "$@" && cd x=1 done readonly /usr/bin /usr/bin "$@" then readonly local x=1
+| cd export 2>/dev/null printf "$1"
+	-eu awk "$@" sed "$@" ${HOME} export sed local then /usr/bin
+	sed 2>/dev/null awk test /usr/bin "$1" then local --verbose 'quoted text'
+	&& readonly ${HOME} /usr/bin done
+grep --verbose --verbose readonly
+--verbose export then readonly
+$(pwd) $(pwd) export grep $(pwd) sed cd x=1 "$@" | readonly 2>/dev/null then /usr/bin
+local export grep --verbose --verbose x=1
+		"$1" cd -eu sed done export /usr/bin 2>/dev/null
+export "$1" $(pwd) cd export $(pwd) sed
+${HOME} test readonly export /usr/bin 'quoted text'
+		export sed ${HOME} $(pwd) --verbose grep then
+	cd -eu awk "$@" printf readonly done 'quoted text' test readonly cd && 'quoted text'
+cd then $(pwd) "$1" x=1 sed
+		done local export sed done done readonly echo cd then printf readonly done
+grep test ${HOME} | | "$@" cd export test
+	'quoted text' echo echo export && /usr/bin readonly -eu done
+		/usr/bin 'quoted text'
+		then printf "$@" printf 2>/dev/null
+	--verbose ${HOME} "$@" awk cd done export export "$1" -eu test grep local
+done test && x=1 test /usr/bin x=1 x=1 /usr/bin
+		--verbose $(pwd) -eu done awk grep 'quoted text'
+		| --verbose export && test grep awk test grep -eu 'quoted text' x=1 -eu sed
+"$@" && export && awk $(pwd) x=1 done
+		grep cd cd -eu 2>/dev/null 2>/dev/null local --verbose
+	awk -eu echo local 2>/dev/null
+		-eu --verbose then "$@" | done | then cd then printf -eu sed
+		then "$@" 'quoted text' ${HOME} ${HOME} 'quoted text'
+		"$@" 'quoted text' cd x=1 x=1 && local
+-eu test 'quoted text' "$1" echo then printf "$@" awk ${HOME} grep
+		readonly 2>/dev/null then sed cd 'quoted text' $(pwd) 'quoted text' "$1" echo
+awk export sed export local export 2>/dev/null awk local -eu
+	--verbose && export local
+		grep sed then printf && ${HOME} then
+		'quoted text' local awk local -eu "$1" 2>/dev/null export
+		printf done ${HOME} "$1" -eu done then sed --verbose export --verbose test
+		-eu 2>/dev/null test awk "$@" cd 2>/dev/null /usr/bin export 'quoted text'
+	| && readonly && && --verbose test then /usr/bin $(pwd) readonly then grep
+	printf local test "$1" echo export readonly export readonly
+		echo /usr/bin sed "$@"
+		echo grep echo 'quoted text' ${HOME} 'quoted text' export -eu done echo -eu ${HOME}
+	-eu export cd awk --verbose done readonly /usr/bin
+		&& | ${HOME} cd test export readonly --verbose echo x=1 readonly printf readonly
+	"$@" && echo "$@" ${HOME} ${HOME} awk x=1 "$@" | local ${HOME}
+	done cd 'quoted text' done "$1" | -eu
+		printf awk done echo "$1" awk $(pwd) local echo 'quoted text' done grep
+then test /usr/bin sed printf --verbose then awk done then local "$1" $(pwd)
+		local -eu sed 2>/dev/null 'quoted text' awk ${HOME} echo export grep awk x=1 then
+	-eu /usr/bin grep -eu 'quoted text' ${HOME} ${HOME} x=1 done 2>/dev/null
+		cd | cd local export x=1 "$1" -eu -eu $(pwd) ${HOME} awk test done -eu /usr/bin
+		-eu $(pwd) ${HOME} grep done
+then done | printf $(pwd)
+	readonly grep printf local | echo test
+	&& x=1 printf grep --verbose local | done
+| 2>/dev/null readonly local /usr/bin done test grep $(pwd) printf /usr/bin
+	test echo then test /usr/bin grep x=1
+		awk 2>/dev/null $(pwd) local grep $(pwd) 2>/dev/null
+		'quoted text' /usr/bin -eu done grep && readonly echo awk awk
+	| printf done x=1 x=1 awk
+-eu $(pwd) -eu printf --verbose
+	| readonly grep awk -eu "$@" "$@" readonly
+	awk ${HOME} printf local readonly -eu
+	&& local done then test "$@" local $(pwd) x=1 export $(pwd) -eu export
+then -eu test x=1 grep --verbose awk echo /usr/bin printf /usr/bin /usr/bin
+	test && --verbose | done then 'quoted text' export && 2>/dev/null && x=1 export
+	test cd --verbose "$1" sed -eu x=1 awk local readonly x=1 done ${HOME} printf
+		sed then 'quoted text' "$1" 'quoted text'
+		"$1" | printf local test -eu echo sed printf "$1" readonly local echo test
+printf awk --verbose --verbose printf sed
+		$(pwd) test "$@" "$@" cd && grep 'quoted text' test readonly 2>/dev/null
+"$@" export done && test printf /usr/bin printf sed && | ${HOME} && "$1"
+		awk && awk --verbose "$1" "$1" 2>/dev/null -eu done $(pwd)
+awk /usr/bin /usr/bin local test then 'quoted text' readonly | export
+	then $(pwd) /usr/bin done --verbose
+/usr/bin test "$1" | 2>/dev/null local "$1" printf then cd ${HOME}
+	printf /usr/bin done /usr/bin local -eu "$@" local "$1"
+	$(pwd) "$1" export 2>/dev/null $(pwd) test "$1" | 'quoted text'
+test --verbose "$@" sed echo
+		done test sed echo test local /usr/bin export
+	echo $(pwd) x=1 readonly "$@"
+	/usr/bin cd --verbose test awk $(pwd) cd -eu awk awk "$@" 'quoted text'
+printf echo printf sed x=1 local cd --verbose sed && | sed
+	awk done x=1 ${HOME} readonly -eu /usr/bin /usr/bin awk done "$1" --verbose x=1
+		&& --verbose -eu 'quoted text' /usr/bin then "$@" test x=1 export export
+readonly sed | cd readonly && "$@" 'quoted text' sed -eu printf | awk
+		&& done | 2>/dev/null local -eu done "$1" ${HOME} cd grep "$@" awk
+grep | then awk | | ${HOME}
+--verbose /usr/bin done 'quoted text'
+		2>/dev/null 'quoted text' | awk $(pwd) /usr/bin | done
+	2>/dev/null | done 'quoted text' ${HOME} /usr/bin $(pwd) $(pwd)
+export | sed cd 'quoted text' local ${HOME} sed cd readonly
+		$(pwd) sed "$1" "$@" "$@" --verbose local && "$1" 'quoted text'
+		-eu /usr/bin awk -eu awk export
+	"$1" x=1 && "$1" sed printf /usr/bin ${HOME} done | done done export /usr/bin -eu
+	awk && cd printf local printf
+		2>/dev/null test printf cd readonly grep 'quoted text'
+	grep test --verbose | -eu readonly | "$@" $(pwd) 2>/dev/null /usr/bin
+		cd sed printf echo "$1" x=1 $(pwd) then -eu echo printf
+	/usr/bin 2>/dev/null | cd "$@" 'quoted text' x=1 awk export
+$(pwd) grep -eu --verbose && test
+	"$1" 'quoted text' then "$1" "$@" "$1" test x=1 echo
+	$(pwd) local test local "$@" 'quoted text'
+		awk cd then "$1" sed | cd cd sed $(pwd) 2>/dev/null /usr/bin
+		&& export readonly test test
+		echo | done grep awk cd -eu -eu
+	"$1" "$1" printf cd readonly printf /usr/bin ${HOME} && | done
+printf x=1 | 2>/dev/null -eu then sed && grep
+'quoted text' "$1" -eu "$@" x=1 ${HOME} && "$@" x=1 local printf
+	2>/dev/null "$1" done "$@" grep /usr/bin
+readonly "$1" then && "$1" --verbose
+cd /usr/bin awk | echo 'quoted text' "$@" | test done $(pwd) x=1
+	then 2>/dev/null cd ${HOME} sed test 'quoted text' "$1" "$@" 'quoted text'
+	-eu x=1 /usr/bin echo &&
+echo export cd cd readonly cd done /usr/bin then printf $(pwd) x=1
+		awk grep export done | "$1" echo
+		2>/dev/null "$@" /usr/bin local x=1
+	2>/dev/null local -eu then printf done "$@" cd "$1"
+	$(pwd) printf local awk readonly $(pwd) awk
+	-eu readonly export sed done printf export x=1
+		grep 2>/dev/null | 'quoted text' --verbose
+		&& 'quoted text' /usr/bin $(pwd) done -eu cd | cd export awk local 'quoted text'
+		2>/dev/null "$1" cd 'quoted text' printf awk
+		awk /usr/bin "$@" echo $(pwd) done $(pwd) ${HOME}
+	x=1 x=1 printf cd awk /usr/bin
+		then done /usr/bin -eu 'quoted text'
+-eu printf $(pwd) "$@" "$1" test export $(pwd) awk then grep grep grep "$@" done
+$(pwd) /usr/bin 'quoted text' export then x=1 echo then -eu local
+| 2>/dev/null /usr/bin sed cd done $(pwd) 'quoted text' 'quoted text'
+$(pwd) local done readonly
+	sed cd | --verbose -eu /usr/bin
+/usr/bin export $(pwd) echo && --verbose then && ${HOME} 'quoted text'
+		--verbose test "$@" export && export ${HOME} ${HOME} export 'quoted text'
+| /usr/bin | grep echo 2>/dev/null $(pwd) printf
+	awk ${HOME} export echo sed && 2>/dev/null x=1 ${HOME} done
+${HOME} "$@" 'quoted text' --verbose echo "$1" --verbose /usr/bin readonly 'quoted text'
+	$(pwd) sed test x=1 cd grep ${HOME} ${HOME} done --verbose grep echo
+	$(pwd) ${HOME} awk test sed export
+		then grep | /usr/bin -eu
+2>/dev/null awk readonly done "$1" --verbose 'quoted text' "$@" printf 'quoted text'
+		2>/dev/null | -eu x=1 --verbose
+		2>/dev/null x=1 && "$@" 2>/dev/null
+grep && printf /usr/bin | grep && readonly "$@" awk export | done
+grep test 2>/dev/null export test && test
+		local 'quoted text' cd awk sed
+	done test "$@" "$1" local -eu "$@" 'quoted text' "$1" $(pwd) $(pwd) 'quoted text'
+printf printf export echo 2>/dev/null sed local then sed cd "$@"
+cd grep "$@" --verbose --verbose test /usr/bin && -eu -eu && readonly 2>/dev/null
+${HOME} 'quoted text' ${HOME} /usr/bin
+	awk | awk sed grep -eu --verbose awk $(pwd) &&
+2>/dev/null export 'quoted text' /usr/bin $(pwd) 2>/dev/null awk &&
+&& "$@" ${HOME} && grep readonly "$@" /usr/bin ${HOME}
+	"$@" then export export 2>/dev/null 'quoted text' echo "$@" test
+	${HOME} done 'quoted text' then ${HOME} done 2>/dev/null
+--verbose "$1" --verbose x=1 then local --verbose
+		| 2>/dev/null printf local
+	$(pwd) cd local 'quoted text' cd local
+awk export "$@" local test then done
+		sed --verbose local "$1" $(pwd) printf -eu awk echo
+/usr/bin printf awk -eu | "$1" && readonly then /usr/bin
+-eu cd cd ${HOME} -eu grep 'quoted text' -eu 'quoted text' $(pwd) cd grep $(pwd)
+	done echo printf done cd cd | cd test 2>/dev/null sed export 'quoted text'
+		x=1 $(pwd) "$1" ${HOME} | && $(pwd) sed done printf /usr/bin ${HOME} 2>/dev/null
+&& && $(pwd) echo | local printf &&
+then | && test "$1" export -eu echo "$@" cd &&
+x=1 x=1 /usr/bin --verbose -eu
+&& local sed sed printf ${HOME} && 2>/dev/null
+		x=1 2>/dev/null cd "$@" grep && sed readonly local "$@" echo
+	"$1" awk export readonly grep 'quoted text' 'quoted text' ${HOME} 2>/dev/null
+		echo done cd $(pwd) local ${HOME} export awk done --verbose
+		2>/dev/null /usr/bin 2>/dev/null
+		${HOME} "$1" done grep sed done && export x=1 readonly grep local
+awk then && test then echo /usr/bin
+"$1" export | 2>/dev/null readonly test echo
+	/usr/bin /usr/bin 'quoted text'
+done "$@" 'quoted text' 'quoted text' done
+then -eu done echo echo | | awk
+	sed --verbose 'quoted text' local readonly
+	export grep export | x=1 export export && /usr/bin $(pwd) -eu done
+echo test 'quoted text' then ${HOME} readonly -eu readonly awk 'quoted text' export
+then | ${HOME} cd then | 'quoted text' test --verbose 'quoted text' cd
+	&& "$@" x=1 test local grep -eu local local
+		"$@" sed awk 2>/dev/null -eu awk sed /usr/bin | awk local test /usr/bin
+		export 'quoted text' test $(pwd) readonly sed printf 'quoted text'
+		$(pwd) && grep ${HOME} ${HOME} $(pwd) local export
+	readonly x=1 $(pwd) grep export
+	readonly done echo cd x=1 printf readonly x=1 sed -eu
+then grep $(pwd) 2>/dev/null done ${HOME}
+/usr/bin $(pwd) then printf then echo
+$(pwd) cd x=1 done done then cd /usr/bin
+	cd | then "$1" -eu readonly "$@" x=1 test sed 2>/dev/null
+done local /usr/bin sed "$@" 2>/dev/null cd -eu && -eu && readonly
+/usr/bin | test x=1 test 2>/dev/null export "$@" export printf 2>/dev/null
+	'quoted text' grep cd local x=1 2>/dev/null
+$(pwd) -eu && awk local readonly | /usr/bin grep
+	test local | /usr/bin --verbose grep
+printf grep local cd x=1 'quoted text' && done local sed x=1 cd --verbose
+	| "$@" && done export ${HOME} 2>/dev/null 'quoted text'
+echo /usr/bin local "$1" 2>/dev/null
+		| then sed done | 'quoted text'
+	--verbose -eu export ${HOME} grep | done echo 'quoted text'
+	grep sed test sed awk done then echo x=1 grep done done /usr/bin sed --verbose
+2>/dev/null printf done sed 2>/dev/null sed readonly
+x=1 echo echo /usr/bin grep local export export printf 2>/dev/null grep export
+then 2>/dev/null ${HOME} "$1" "$1" awk
+&& local -eu -eu 2>/dev/null sed | --verbose test
+		printf echo grep 'quoted text' export cd readonly
+		2>/dev/null --verbose then sed /usr/bin | then && ${HOME} 2>/dev/null
+x=1 sed "$@" -eu /usr/bin /usr/bin --verbose grep echo awk readonly "$@"
+	&& -eu && ${HOME} test echo ${HOME} echo $(pwd) -eu then -eu -eu
+		"$1" done echo /usr/bin $(pwd) export --verbose
+grep grep cd /usr/bin ${HOME} grep local -eu ${HOME}
+		readonly && "$@" printf
+	2>/dev/null && printf "$@" test && local && && x=1 awk 'quoted text'
+		"$@" then then then && "$1"
+${HOME} test /usr/bin | && | "$@" | /usr/bin test | -eu cd cd sed $(pwd)
+echo then && /usr/bin /usr/bin | | && 2>/dev/null "$1" ${HOME} grep ${HOME}
+	'quoted text' --verbose | test export local printf ${HOME} cd 2>/dev/null
+printf readonly -eu 2>/dev/null readonly
+	x=1 readonly x=1 then awk readonly && && test x=1 export done 'quoted text'
+"$@" grep $(pwd) readonly "$1" /usr/bin "$@" "$@" && -eu readonly awk cd
+echo done local "$1" $(pwd) readonly /usr/bin echo
+		/usr/bin x=1 readonly done local "$1" 'quoted text'
+	local readonly -eu ${HOME} && 'quoted text'
+2>/dev/null local x=1 'quoted text'
+local readonly test -eu && local
+	$(pwd) printf readonly "$@"
+		$(pwd) readonly x=1 $(pwd) 2>/dev/null && export echo 2>/dev/null
+		local $(pwd) done export test && $(pwd)
+	$(pwd) grep $(pwd) cd --verbose
+x=1 export then echo 2>/dev/null "$@" cd && 'quoted text' cd
+	"$1" && && --verbose /usr/bin printf 'quoted text'
+test "$@" grep x=1 awk && $(pwd) -eu sed grep done && $(pwd)
+	awk echo 'quoted text' x=1 --verbose echo awk "$@" printf && 2>/dev/null awk /usr/bin
+		local echo 2>/dev/null x=1 cd $(pwd) 'quoted text' "$1" echo
+		${HOME} then readonly "$1" ${HOME} --verbose
+	$(pwd) $(pwd) "$@" cd | $(pwd) "$@" --verbose done printf --verbose
+		cd "$1" -eu --verbose && && awk
+		/usr/bin "$1" | readonly x=1 x=1 printf && done
+		sed cd $(pwd) ${HOME} cd | --verbose /usr/bin
+	echo done /usr/bin readonly
+	echo /usr/bin cd ${HOME} --verbose readonly && -eu sed sed && readonly 2>/dev/null
+--verbose | done echo echo ${HOME}
+	grep awk test /usr/bin "$1" 'quoted text' export | x=1 local done
+		x=1 export x=1 2>/dev/null awk sed echo 'quoted text' $(pwd)
+awk 2>/dev/null test cd export -eu done then /usr/bin
+local ${HOME} export | $(pwd) -eu then then then -eu | 2>/dev/null /usr/bin
+		export done done done readonly ${HOME} "$@" export
+${HOME} done $(pwd) done "$1" echo ${HOME}
+$(pwd) done then /usr/bin printf
+| -eu cd $(pwd) ${HOME} cd | && grep && local sed 2>/dev/null && sed x=1 test /usr/bin
+		| && "$@" -eu && echo grep -eu --verbose export readonly "$@" "$1" readonly
+		| | echo -eu $(pwd) echo $(pwd) then --verbose
+	done export grep x=1 x=1 readonly /usr/bin | --verbose cd x=1 cd export
+		&& sed $(pwd) x=1 "$1" grep $(pwd)
+cd test then printf local
+		awk cd --verbose "$@" readonly grep printf then && --verbose
+		--verbose test -eu "$1" --verbose
+	cd printf done | grep 'quoted text' "$1"
+-eu $(pwd) printf $(pwd) echo test "$1" printf export ${HOME} | "$@" &&
+	readonly -eu $(pwd) echo "$@" $(pwd) echo test test --verbose
+local --verbose -eu sed --verbose cd cd echo cd export /usr/bin
+	awk then cd sed 2>/dev/null $(pwd)
+	printf done test done then echo then awk x=1 awk
+	${HOME} && export && | awk "$1" "$@" 2>/dev/null 'quoted text' &&
+	-eu "$1" "$@" then "$@" sed $(pwd) && && 'quoted text' 'quoted text' "$1"
+	2>/dev/null test sed && export cd then $(pwd) $(pwd) local awk
+"$1" ${HOME} | --verbose sed sed -eu x=1 export
+		-eu 'quoted text' "$1" sed 'quoted text'
+awk then done local done $(pwd) echo done "$@" 'quoted text' 2>/dev/null
+| readonly test 2>/dev/null
+		readonly export ${HOME} export awk export "$@" test 'quoted text'
+		2>/dev/null | $(pwd) && grep x=1 "$1" x=1 --verbose 2>/dev/null then test readonly
+	test test printf export done echo
+	2>/dev/null cd local --verbose
+		test awk cd readonly awk echo awk "$@" test
+	"$1" ${HOME} echo local readonly cd echo --verbose
+	"$@" local | "$@" done
+	&& sed x=1 awk cd printf printf /usr/bin ${HOME}
+	2>/dev/null ${HOME} --verbose "$@" cd 2>/dev/null
+		&& /usr/bin readonly cd done local test | cd ${HOME} grep echo done
+	"$@" && -eu $(pwd) $(pwd) "$@" ${HOME} /usr/bin local /usr/bin
+then then "$1" --verbose
+		${HOME} "$1" "$1" readonly test then
+		&& /usr/bin 'quoted text' sed test 2>/dev/null then grep then
+	then grep && sed local done && readonly awk "$1"
+	printf "$1" export ${HOME} x=1 grep sed done
+		x=1 done readonly | done export -eu test /usr/bin /usr/bin echo
+		readonly ${HOME} "$@" then cd grep /usr/bin readonly test export
+readonly x=1 -eu -eu export "$1" "$@" awk cd then
+test --verbose 2>/dev/null | test export awk /usr/bin && && $(pwd) test echo
+	'quoted text' cd && 2>/dev/null
+-eu && export x=1 then export ${HOME} && export "$1" done x=1 done /usr/bin
+cd readonly /usr/bin $(pwd) ${HOME} cd "$1" printf then "$1" ${HOME} local done
+		sed cd ${HOME} x=1 readonly 2>/dev/null
+		then then x=1 printf test $(pwd) cd local readonly
+awk 2>/dev/null ${HOME} 2>/dev/null test test printf printf done 'quoted text'
+	then printf test "$@" awk ${HOME} done
+"$1" cd test "$@" -eu printf awk $(pwd) local 2>/dev/null 'quoted text' done export
+		then export --verbose /usr/bin && ${HOME} ${HOME} ${HOME} local 'quoted text' cd
+		cd printf --verbose ${HOME} test $(pwd)
+	grep 2>/dev/null && grep x=1 printf printf /usr/bin readonly echo
+export then awk done /usr/bin 'quoted text' | "$1" &&
+'quoted text' sed cd 'quoted text' ${HOME}
+done $(pwd) grep readonly
+sed -eu | local sed x=1 then sed then printf | export done "$1" grep && readonly
+		${HOME} readonly sed local awk test cd printf
+export && readonly "$1" local && "$@" -eu readonly
+awk /usr/bin /usr/bin "$1" x=1
+		"$@" "$1" $(pwd) local $(pwd) test $(pwd) "$1" 'quoted text'
+	$(pwd) grep grep 'quoted text' "$@" readonly
+	&& /usr/bin 2>/dev/null grep "$1"
+		echo 'quoted text' sed -eu | ${HOME} cd local | -eu
+	sed "$1" 2>/dev/null /usr/bin 2>/dev/null
+	--verbose readonly --verbose echo awk export
+cd readonly then "$1" grep readonly "$1" -eu "$@" printf echo x=1
+	cd && test export && --verbose readonly echo local
+awk awk 'quoted text' cd $(pwd) -eu then x=1 sed done --verbose "$1"
+	export 'quoted text' x=1 test
+/usr/bin sed "$1" --verbose
+sed ${HOME} echo "$@" printf
+"$1" readonly --verbose echo 'quoted text'
+		done echo done test printf /usr/bin cd awk $(pwd) export local printf "$1" printf
+${HOME} test sed export export printf "$@" | grep then ${HOME} readonly printf
+	-eu grep local grep 2>/dev/null x=1 --verbose
+x=1 2>/dev/null | x=1 printf --verbose
+	cd readonly "$1" then -eu awk awk "$1"
+"$@" "$@" export $(pwd) --verbose test printf
+	then echo x=1 awk ${HOME} 2>/dev/null $(pwd) 2>/dev/null then --verbose
+		printf test then awk 2>/dev/null export x=1
+		grep echo | readonly printf 'quoted text' "$1" "$@" --verbose
+		${HOME} 'quoted text' awk $(pwd) then
+done 2>/dev/null echo cd test grep export awk
+awk && cd && readonly sed ${HOME} echo done && done test 2>/dev/null
+readonly printf ${HOME}
+echo then then x=1 ${HOME} -eu && /usr/bin
+		2>/dev/null done "$1" $(pwd) sed
+	sed readonly 2>/dev/null echo then sed "$1" readonly --verbose
+then "$@" awk local then
+	grep --verbose -eu x=1 2>/dev/null
+	cd done -eu 2>/dev/null --verbose ${HOME} ${HOME} | | echo /usr/bin
+		/usr/bin | -eu test awk grep
+	x=1 awk "$1" local readonly "$@" 2>/dev/null
+	cd cd awk $(pwd) 2>/dev/null && "$1" then x=1 "$@" test test
+grep readonly export awk /usr/bin cd && then 'quoted text' x=1 $(pwd)
+| 2>/dev/null x=1 echo sed awk printf printf grep then done sed --verbose
+'quoted text' export printf ${HOME} $(pwd) x=1 --verbose
+'quoted text' | "$1" $(pwd) && echo
+		local "$@" local /usr/bin /usr/bin
+	'quoted text' x=1 x=1 local | /usr/bin done export grep $(pwd)
+2>/dev/null then sed printf && then grep -eu printf echo
+	local printf -eu done readonly
+	export -eu readonly | local echo done readonly export export
+done --verbose "$@" $(pwd) printf
+	/usr/bin ${HOME} sed local readonly "$@" "$@" && 'quoted text' "$1" local
+"$@" readonly readonly --verbose $(pwd) x=1 local ${HOME}
+		--verbose readonly -eu sed awk readonly echo && --verbose 2>/dev/null
+$(pwd) grep "$@" 2>/dev/null "$@" /usr/bin && grep ${HOME} cd x=1 then cd then
+		-eu "$@" test awk && echo $(pwd) -eu cd 2>/dev/null "$@" 2>/dev/null "$1"
+done 2>/dev/null --verbose
+		/usr/bin /usr/bin --verbose local test export $(pwd) sed local printf
+x=1 'quoted text' export test
+	done export export local
+export "$@" -eu --verbose then x=1
+/usr/bin -eu 2>/dev/null "$1" ${HOME} $(pwd) "$1" $(pwd)
+		then 'quoted text' export "$@" $(pwd) "$@" sed x=1 export
+		"$1" grep 2>/dev/null cd done grep && cd "$1" $(pwd)
+	"$1" ${HOME} done && $(pwd) then "$1" grep 2>/dev/null
+		test awk "$@" x=1 test grep grep "$1" test $(pwd) then readonly -eu local test
+	grep export && x=1 2>/dev/null grep | done 2>/dev/null echo
+	echo echo ${HOME} | then done -eu test ${HOME} /usr/bin | cd | grep
+		test -eu test 'quoted text' then 'quoted text' --verbose 2>/dev/null
+	/usr/bin echo "$@" /usr/bin
+	grep awk -eu x=1 -eu done local x=1 export
+		grep export && --verbose echo echo readonly | --verbose "$1" printf
+-eu x=1 "$1" $(pwd) -eu sed 'quoted text' ${HOME} --verbose cd then local 'quoted text'
+		&& cd && x=1 sed 2>/dev/null
+-eu $(pwd) --verbose -eu x=1 x=1 "$@" test && "$@" printf 'quoted text'
+		"$1" grep | done -eu awk export printf | then test printf x=1 ${HOME}
+readonly awk printf --verbose readonly cd "$1" done grep && sed grep
+--verbose /usr/bin | 2>/dev/null printf
+done -eu printf 2>/dev/null cd printf
+	"$1" export "$1" $(pwd) readonly echo export then test --verbose
+cd echo "$1" awk ${HOME} then | 2>/dev/null | --verbose printf x=1
+		"$@" ${HOME} then echo x=1 ${HOME}
+		then "$@" then awk /usr/bin awk sed readonly 2>/dev/null echo
+		'quoted text' printf grep 'quoted text' sed grep --verbose -eu printf
+		--verbose $(pwd) done done $(pwd) done -eu cd -eu /usr/bin export
+2>/dev/null --verbose echo $(pwd) echo export cd && -eu grep cd
+export printf test then /usr/bin 2>/dev/null /usr/bin readonly
+		-eu ${HOME} -eu $(pwd) "$@" 2>/dev/null --verbose
+then | test then 'quoted text'
+		2>/dev/null /usr/bin | $(pwd) $(pwd) | |
+		2>/dev/null readonly echo
+	&& | local $(pwd) "$@" test && | $(pwd) cd awk "$1" printf readonly
+		export sed "$@" then 'quoted text' sed ${HOME} -eu 2>/dev/null "$@"
+		"$@" 2>/dev/null | "$1" test && echo --verbose grep
+		sed $(pwd) then x=1 sed -eu 2>/dev/null awk 2>/dev/null
+sed $(pwd) local export /usr/bin done x=1
+readonly grep echo cd test "$@"
+--verbose cd 'quoted text' sed then $(pwd) local x=1 then readonly
+	"$@" test awk sed sed local test 2>/dev/null && export local sed
+	$(pwd) "$1" x=1 done ${HOME} test /usr/bin local readonly sed --verbose
+-eu export export /usr/bin $(pwd) cd readonly local && test -eu
+		awk --verbose 'quoted text'
+printf -eu 'quoted text' grep
+		echo $(pwd) | export awk export readonly /usr/bin 'quoted text' echo done then
+done export test printf ${HOME} x=1 ${HOME} grep --verbose export
+then x=1 done $(pwd) "$@" "$@" awk "$1"
+"$@" $(pwd) echo $(pwd) | "$1" 'quoted text' /usr/bin
+	$(pwd) 2>/dev/null x=1 x=1 readonly sed test grep
+	${HOME} 'quoted text' "$1" then printf | local
+	/usr/bin done | sed /usr/bin export 'quoted text' export $(pwd) local 2>/dev/null
+then 2>/dev/null ${HOME} printf
+test cd test "$1" | echo readonly
+		grep export x=1 export
+cd echo sed x=1 'quoted text' grep readonly $(pwd)
+	done readonly 'quoted text' done local x=1 && $(pwd)
+	'quoted text' $(pwd) "$@" cd && | 2>/dev/null
+| awk $(pwd) "$@" -eu --verbose then done x=1 then cd | /usr/bin
+test done then | -eu -eu export cd awk /usr/bin
+${HOME} sed x=1 -eu "$1"
+	${HOME} "$@" grep export readonly x=1 local -eu $(pwd) /usr/bin printf
+	done -eu local echo x=1 'quoted text'
+	cd && ${HOME} x=1 grep readonly "$1" then
+${HOME} /usr/bin "$1" 'quoted text' 'quoted text' local -eu done done
+	/usr/bin /usr/bin --verbose awk readonly grep "$1"
+		-eu $(pwd) printf printf && && done 2>/dev/null local --verbose test
+| | && test | /usr/bin readonly
+printf x=1 && && then 2>/dev/null sed local sed "$1" export x=1 $(pwd)
+sed 'quoted text' local 2>/dev/null local done $(pwd) then /usr/bin
+	cd -eu then export export cd --verbose 2>/dev/null
+	"$1" echo 2>/dev/null echo | --verbose cd | readonly x=1 && then sed
+	${HOME} && printf awk awk then readonly done 'quoted text' grep
+	done awk 'quoted text' grep $(pwd) local | local 'quoted text' "$@" sed
+$(pwd) 2>/dev/null | awk $(pwd) &&
+		test "$@" "$1" $(pwd) awk
+		/usr/bin $(pwd) "$@" echo $(pwd) echo --verbose 2>/dev/null sed
+	$(pwd) /usr/bin ${HOME} "$@"
+	${HOME} ${HOME} grep "$@" grep 'quoted text' x=1 cd then local
+printf readonly $(pwd) cd printf export $(pwd) /usr/bin test -eu |
+		"$1" sed then done 2>/dev/null $(pwd) --verbose readonly
+	-eu --verbose -eu /usr/bin ${HOME} readonly
+"$1" grep $(pwd) -eu grep cd awk "$1" printf -eu then 'quoted text'
+	${HOME} grep 2>/dev/null
+export "$1" "$1" sed &&
+	printf "$@" awk $(pwd) awk && && grep "$1" 'quoted text'
+		local awk grep sed "$@" printf sed x=1 -eu printf printf grep
+--verbose local 2>/dev/null test 'quoted text'
+awk printf ${HOME} "$@" ${HOME} 'quoted text' && test local && 'quoted text'
+	readonly done echo readonly ${HOME} done 2>/dev/null $(pwd)
+	sed && ${HOME} readonly sed && -eu /usr/bin --verbose
+		x=1 $(pwd) grep && -eu --verbose
+		"$@" 2>/dev/null grep cd test
+printf 2>/dev/null && && awk
+		/usr/bin printf -eu readonly x=1 export test "$1"
+	grep grep x=1 done awk -eu ${HOME} printf cd echo 'quoted text'
+sed cd -eu echo test 'quoted text'
+		&& 'quoted text' "$@" x=1 -eu "$1" -eu
+	local "$1" cd echo "$1" $(pwd) echo -eu /usr/bin done sed /usr/bin local
+		printf readonly && --verbose "$1" && echo grep done sed "$1"
+	done "$@" 'quoted text' $(pwd) printf sed grep "$1" /usr/bin echo sed export
+	printf 'quoted text' cd readonly $(pwd) printf echo sed
+export done ${HOME} local
+&& $(pwd) "$@" -eu ${HOME}
+	$(pwd) "$@" --verbose "$1" awk $(pwd) then local --verbose grep -eu "$@" x=1 local
+cd sed cd -eu x=1 -eu test $(pwd) cd test && cd | 2>/dev/null $(pwd)
+cd "$1" && | grep then $(pwd) readonly
@@ -0,0 +1,2001 @@
+		grep ${HOME} x=1 -eu local export "$1" done readonly
+"$@" echo && grep test awk
+	$(pwd) "$@" then export test local local local "$1" export
+| printf then local grep -eu export 'quoted text' then awk | test
+x=1 'quoted text' export sed readonly 'quoted text' cd "$1" export
+printf echo -eu cd done echo printf $(pwd) $(pwd) "$@" awk && printf
+	echo /usr/bin awk $(pwd) /usr/bin
+		${HOME} $(pwd) ${HOME} local echo
+	cd "$@" ${HOME} echo test -eu cd printf
+	echo x=1 && --verbose printf readonly "$1" && cd x=1 | then
+		export grep grep readonly export done x=1 $(pwd)
+	then $(pwd) cd --verbose -eu export grep sed
+		| printf ${HOME} ${HOME}
+'quoted text' grep readonly local cd --verbose
+		test local 'quoted text' then
+	readonly grep /usr/bin echo /usr/bin readonly | 2>/dev/null | echo
+	/usr/bin --verbose 'quoted text'
+		-eu then /usr/bin $(pwd)
+/usr/bin -eu /usr/bin | sed && echo -eu x=1 'quoted text' sed sed -eu 2>/dev/null
+	then "$@" sed readonly --verbose ${HOME} x=1 | | /usr/bin
+export echo -eu cd printf 'quoted text' local done ${HOME}
+	"$1" --verbose /usr/bin done
+	${HOME} grep cd printf test && 'quoted text'
+'quoted text' sed then -eu done printf export export "$1" 2>/dev/null
+test printf x=1 "$1" "$@" awk -eu
+grep 'quoted text' test awk
+	$(pwd) readonly grep grep export "$@" && --verbose printf "$@" "$1"
+		&& && $(pwd) x=1 'quoted text' grep 'quoted text' sed printf done cd sed -eu
+| && "$1" -eu awk -eu readonly then export echo "$@" && x=1 export "$@"
+		readonly done local -eu sed && grep sed "$1" echo
+2>/dev/null readonly $(pwd) 'quoted text'
+	&& x=1 readonly && local grep export export awk -eu
+test --verbose /usr/bin then ${HOME} echo printf
+printf 2>/dev/null then ${HOME}
+done grep /usr/bin x=1 && 'quoted text'
+	sed awk awk sed $(pwd) && 2>/dev/null cd "$@" $(pwd) x=1 --verbose
+"$@" grep -eu sed && export --verbose --verbose
+	local export && 'quoted text'
+		cd 'quoted text' 'quoted text' cd echo x=1 sed ${HOME} printf printf x=1
+	echo && && printf cd -eu cd && grep awk "$@" sed 2>/dev/null done
+	readonly 2>/dev/null "$1" echo
+"$1" "$@" 2>/dev/null
+		local local sed awk 2>/dev/null then x=1 $(pwd) grep echo /usr/bin /usr/bin grep
+		${HOME} && 2>/dev/null sed 'quoted text'
+x=1 && --verbose /usr/bin "$1" "$@" "$@" "$@"
+readonly grep x=1 "$@" export test ${HOME} 2>/dev/null readonly
+	then $(pwd) --verbose export readonly --verbose then local done ${HOME}
+	readonly awk awk cd awk export "$1" echo 2>/dev/null
+		$(pwd) ${HOME} -eu $(pwd)
+		&& printf 'quoted text' sed then -eu "$1"
+	cd local awk grep x=1 then 'quoted text' done printf | sed 2>/dev/null
+then "$1" test | 'quoted text'
+		test 2>/dev/null 2>/dev/null grep --verbose /usr/bin readonly
+	| echo done awk 2>/dev/null 'quoted text' done
+	printf printf export readonly --verbose
+| local grep awk cd test test 2>/dev/null "$@" $(pwd) $(pwd)
+echo done 2>/dev/null export
+		x=1 -eu | 2>/dev/null echo printf $(pwd) echo --verbose
+		printf 2>/dev/null echo /usr/bin "$@" | -eu
+		echo sed "$1" 'quoted text' grep cd cd echo | --verbose -eu local
+		local printf "$@" done readonly test sed then $(pwd) x=1 test
+cd ${HOME} local local echo $(pwd) "$1" sed test export grep -eu then 'quoted text'
+		-eu 'quoted text' cd -eu | | /usr/bin
+	$(pwd) sed /usr/bin -eu test done local then -eu readonly printf echo
+		grep awk done echo "$1" done x=1 then "$@"
+	&& 'quoted text' --verbose
+		local sed then sed sed sed echo local printf 2>/dev/null
+		printf echo readonly readonly
+		"$@" x=1 done export "$1" readonly
+sed /usr/bin /usr/bin echo "$@"
+		then sed $(pwd) echo $(pwd) readonly | local | ${HOME} readonly
+		done | sed 2>/dev/null /usr/bin export 2>/dev/null
+${HOME} 2>/dev/null 2>/dev/null grep --verbose done grep && ${HOME} ${HOME}
+		-eu printf grep 2>/dev/null test local
+	done echo "$1" 'quoted text' grep
+2>/dev/null 2>/dev/null awk sed | 'quoted text' -eu
+done then readonly grep
+printf then $(pwd) local local then readonly 2>/dev/null $(pwd) /usr/bin
+		done export | then sed && export 2>/dev/null $(pwd) x=1 2>/dev/null | done
+"$1" | | echo -eu then -eu printf grep "$@" "$1" --verbose "$1"
+	-eu -eu printf "$1" $(pwd) grep | sed awk | /usr/bin
+		grep export echo done 2>/dev/null sed local awk $(pwd) printf |
+	| "$1" ${HOME} 'quoted text'
+		cd cd cd awk $(pwd) grep
+	--verbose $(pwd) local readonly sed local && test $(pwd) 'quoted text' --verbose
+	/usr/bin --verbose x=1 $(pwd) "$@" --verbose 2>/dev/null
+readonly "$@" "$@" sed "$@" awk 2>/dev/null && export && "$@" | 'quoted text'
+export --verbose "$1" x=1 awk printf local -eu
+	printf -eu 2>/dev/null $(pwd) "$@" x=1 "$1" readonly
+"$@" export -eu && -eu ${HOME} then "$@" export "$1" then grep "$1" | 'quoted text'
+	local grep && done echo "$1"
+	cd "$@" "$@" 2>/dev/null awk test
+		/usr/bin /usr/bin "$@" cd local export then && echo readonly
+		2>/dev/null "$1" --verbose "$@" done cd then 2>/dev/null grep cd 'quoted text'
+echo "$@" -eu ${HOME} test
+	"$@" "$@" awk export && sed echo printf 2>/dev/null done $(pwd) "$@" $(pwd)
+'quoted text' "$@" $(pwd) 'quoted text'
+	${HOME} --verbose --verbose echo echo readonly x=1 "$1" grep sed
+	printf && /usr/bin /usr/bin ${HOME}
+		&& ${HOME} sed printf cd x=1 "$@" /usr/bin test && && "$@" test
+	x=1 ${HOME} "$@" "$1" readonly test test "$1" grep
+	--verbose cd printf echo test
+	local cd then done echo --verbose readonly "$@" then $(pwd) done printf ${HOME}
+		sed grep && /usr/bin && grep --verbose cd -eu x=1 readonly grep
+grep -eu grep /usr/bin grep grep "$@" then ${HOME} cd 'quoted text'
+		/usr/bin cd | ${HOME} printf test export /usr/bin echo printf
+		/usr/bin --verbose 'quoted text' done export done $(pwd) readonly printf
+local 'quoted text' "$1" --verbose 2>/dev/null grep echo then 'quoted text'
+x=1 done && -eu grep && -eu 'quoted text' printf
+		/usr/bin ${HOME} readonly x=1 "$@" sed test $(pwd) && ${HOME} done
+${HOME} sed && /usr/bin grep --verbose grep echo $(pwd)
+2>/dev/null --verbose --verbose local $(pwd) ${HOME} --verbose
+		readonly cd && | x=1 && --verbose
+	test "$@" done | printf test local done $(pwd) /usr/bin echo sed
+readonly | 2>/dev/null local echo "$@" cd
+grep test done grep test awk sed test 2>/dev/null --verbose readonly grep 'quoted text'
+		grep then export cd && cd done grep x=1 done printf $(pwd)
+--verbose -eu && 'quoted text'
+	&& test $(pwd) | --verbose && sed local export printf local test 2>/dev/null
+export readonly cd 'quoted text' --verbose ${HOME} 'quoted text'
+cd $(pwd) --verbose sed done /usr/bin "$@" 'quoted text'
+		"$1" && 'quoted text' "$@" ${HOME} 2>/dev/null
+	x=1 | x=1 local ${HOME}
+	${HOME} then export | then 'quoted text'
+"$@" 2>/dev/null 'quoted text' sed x=1 --verbose sed printf
+	cd awk "$1" -eu && --verbose
+	"$1" 'quoted text' --verbose sed "$1" awk cd 2>/dev/null 2>/dev/null
+x=1 cd grep done then -eu | -eu x=1 | echo
+	then $(pwd) | -eu "$1" echo cd ${HOME} awk awk | /usr/bin then
+	/usr/bin readonly awk "$@" /usr/bin echo readonly | test "$@" awk echo echo
+		done ${HOME} test cd cd readonly export local readonly "$1" x=1 'quoted text'
+	-eu | "$1" printf then ${HOME} local export && printf
+		awk done sed awk "$1" "$@" ${HOME} local echo awk awk awk grep
+	| sed export then cd readonly printf local readonly 2>/dev/null 'quoted text'
+$(pwd) "$1" sed | /usr/bin
+		grep local /usr/bin 2>/dev/null ${HOME}
+		printf $(pwd) /usr/bin awk && export sed then readonly -eu 'quoted text'
+	echo export | 'quoted text'
+		sed "$1" $(pwd) cd grep test then 2>/dev/null
+		test printf ${HOME} grep "$1" sed "$@"
+	'quoted text' ${HOME} 'quoted text' local /usr/bin done -eu readonly -eu | cd
+		${HOME} --verbose grep
+done done local local -eu -eu -eu done 2>/dev/null done -eu test "$1" local
+sed local "$1" $(pwd) -eu echo |
+2>/dev/null then readonly echo sed grep && cd grep -eu | awk ${HOME}
+		done done x=1 local 'quoted text' grep
+	| export grep echo 2>/dev/null awk 'quoted text' -eu cd -eu 2>/dev/null
+		awk awk cd local "$@" $(pwd) echo echo grep 'quoted text'
+		sed cd echo x=1 grep | then test $(pwd) cd ${HOME} "$@" "$@" done /usr/bin printf
+		cd "$@" readonly grep grep | cd echo grep then -eu ${HOME} $(pwd)
+done grep done "$@" x=1 readonly grep local local
+| | readonly grep x=1 echo "$@" $(pwd) readonly test cd x=1
+--verbose printf -eu echo $(pwd) then export sed cd cd /usr/bin | export export
+	readonly printf | /usr/bin ${HOME} cd export
+'quoted text' "$@" 'quoted text' 2>/dev/null
+sed local sed readonly "$1" export 2>/dev/null "$@" x=1
+		${HOME} then grep "$1" --verbose "$@" readonly
+		"$@" $(pwd) ${HOME} /usr/bin --verbose | then -eu --verbose
+local 2>/dev/null grep awk | grep awk $(pwd) test "$@" |
+	grep /usr/bin test | done --verbose export
+		sed cd 'quoted text' then $(pwd) "$1"
+then export local 2>/dev/null export /usr/bin grep --verbose
+	${HOME} export x=1 "$1" export printf "$@" ${HOME}
+		| 2>/dev/null /usr/bin echo printf test
+		$(pwd) ${HOME} | 2>/dev/null done x=1 local | /usr/bin
+	printf "$1" -eu "$1" cd cd done sed --verbose echo "$1" printf $(pwd) /usr/bin
+	2>/dev/null && sed done 2>/dev/null grep echo $(pwd) x=1 local -eu "$1" local
+readonly test "$@" printf printf sed 2>/dev/null
+	sed | readonly export x=1 2>/dev/null ${HOME} "$1" sed local ${HOME} readonly
+	| cd echo "$@" printf cd | echo /usr/bin then grep printf
+sed && 2>/dev/null "$@" $(pwd) "$1" cd echo awk "$@" $(pwd) && done test
+		printf -eu printf --verbose then --verbose sed export && "$1" export ${HOME} done
+	grep "$@" ${HOME} cd "$@" --verbose "$@" local echo echo
+sed grep sed then 'quoted text' /usr/bin
+-eu "$@" $(pwd) 2>/dev/null
+	2>/dev/null "$1" grep
+		export awk -eu /usr/bin 2>/dev/null grep
+		&& then "$@" grep | awk readonly printf x=1 /usr/bin echo
+		awk then then test ${HOME} test export grep printf cd "$1" readonly
+		cd && --verbose | 'quoted text' echo x=1 'quoted text' cd awk test /usr/bin
+	echo echo "$1" 2>/dev/null -eu && "$1"
+		--verbose sed printf 'quoted text' test | local ${HOME} then
+		printf local | 'quoted text' &&
+	awk test | -eu echo readonly ${HOME}
+local 2>/dev/null "$1" 'quoted text' sed sed done sed then test test --verbose
+		sed test $(pwd) then test "$@" x=1
+		2>/dev/null $(pwd) 2>/dev/null test echo /usr/bin
+		echo "$1" "$@" sed ${HOME} grep --verbose
+		"$1" echo echo grep -eu cd | printf readonly /usr/bin
+		-eu then grep cd "$@"
+grep "$1" 'quoted text' | grep
+		readonly grep readonly test && then then -eu "$1" x=1 "$@" ${HOME} then cd cd
+	--verbose $(pwd) done && echo readonly echo awk --verbose test
+	grep "$@" 2>/dev/null readonly "$1" sed grep -eu readonly test 'quoted text'
+	/usr/bin && -eu -eu awk --verbose echo awk grep echo cd -eu && awk ${HOME} done
+	'quoted text' "$1" ${HOME}
+	/usr/bin awk ${HOME} && --verbose readonly
+local sed awk x=1 /usr/bin grep test export --verbose
+	-eu | | && --verbose -eu 'quoted text' && 2>/dev/null
+	${HOME} | echo grep /usr/bin
+x=1 -eu readonly "$1" readonly /usr/bin
+		/usr/bin $(pwd) -eu test 2>/dev/null test 2>/dev/null
+test x=1 'quoted text' -eu ${HOME} x=1 sed
+cd $(pwd) | done | test -eu cd export
+cd && awk test /usr/bin "$@" local x=1 x=1 --verbose printf echo 'quoted text'
+		-eu "$@" /usr/bin 'quoted text' grep
+		export $(pwd) awk | "$1" x=1 /usr/bin grep 'quoted text' local -eu $(pwd)
+	printf 'quoted text' && --verbose readonly | 'quoted text' /usr/bin
+		&& 2>/dev/null ${HOME} 2>/dev/null 2>/dev/null printf "$1" 'quoted text'
+		readonly local readonly -eu export local printf | test
+x=1 && readonly sed | readonly sed then x=1 | /usr/bin && export awk
+"$@" -eu done && test done "$1"
+		grep test && cd readonly then | /usr/bin done --verbose ${HOME} x=1 grep "$1" /usr/bin
+$(pwd) | 2>/dev/null --verbose "$@" readonly
+	readonly grep $(pwd) test export echo export "$@" && 'quoted text'
+readonly local && --verbose -eu ${HOME} --verbose "$1" x=1 readonly
+	"$@" sed "$1" "$@" awk awk then --verbose
+printf then 2>/dev/null 'quoted text' "$1"
+		done awk -eu sed echo && printf then printf 'quoted text' ${HOME}
+		| readonly printf local /usr/bin
+		readonly test printf "$1" awk export awk export --verbose "$1" /usr/bin
+-eu test then done echo grep "$@" 'quoted text'
+$(pwd) printf readonly 'quoted text' $(pwd) awk local printf && awk then $(pwd)
+awk /usr/bin "$@" --verbose local echo echo sed
+		done x=1 awk /usr/bin x=1 /usr/bin test ${HOME} ${HOME} 'quoted text'
+	awk awk echo && "$@" && local cd echo $(pwd) echo 2>/dev/null
+		${HOME} --verbose readonly ${HOME} sed "$1" then test "$1" ${HOME} --verbose local
+/usr/bin export --verbose printf | awk 'quoted text' "$1" awk awk
+x=1 printf test 2>/dev/null /usr/bin printf && x=1 -eu readonly 2>/dev/null
+2>/dev/null "$@" "$1" x=1 readonly cd "$1" -eu x=1 printf ${HOME}
+sed "$@" --verbose "$1" cd "$1"
+then local readonly x=1 printf /usr/bin /usr/bin then then
+		grep | && "$@" export sed printf 2>/dev/null "$1" x=1 grep --verbose
+	"$1" x=1 && "$@" cd echo
+	cd readonly grep -eu local export -eu
+	"$1" -eu ${HOME} done cd 'quoted text' -eu 2>/dev/null && &&
+	&& | "$@" then awk done sed --verbose -eu export
+	${HOME} "$@" 2>/dev/null && 'quoted text'
+export awk "$@" echo then "$@" then readonly
+local x=1 sed x=1 ${HOME} ${HOME} grep -eu 'quoted text'
+| done then then export printf && ${HOME} | then readonly test
+	"$1" 2>/dev/null cd sed grep then | $(pwd) --verbose export test readonly
+x=1 then done 2>/dev/null
+		/usr/bin 2>/dev/null && "$@" awk 2>/dev/null /usr/bin export readonly cd readonly
+	test -eu -eu sed "$1" test ${HOME} printf
+2>/dev/null x=1 export && export awk grep "$1" /usr/bin 'quoted text' $(pwd) echo
+		${HOME} -eu printf x=1 "$@" then --verbose | | 'quoted text' test && "$1" awk
+done 2>/dev/null ${HOME} then 'quoted text' "$1" "$1" 'quoted text' 'quoted text'
+sed awk ${HOME} /usr/bin ${HOME} grep && | 2>/dev/null x=1
+readonly "$@" cd "$@" sed "$1" test cd -eu $(pwd) ${HOME} "$1" | printf grep
+	readonly | grep awk grep cd local --verbose ${HOME}
+		-eu export grep -eu printf test sed $(pwd) --verbose
+		| awk "$@" && "$1" | readonly &&
+export readonly readonly && | printf x=1 test "$@" awk "$1" 'quoted text' then
+	test -eu sed export 'quoted text' 'quoted text'
+	awk test local 'quoted text'
+cd readonly | test "$@" 2>/dev/null x=1 then sed sed x=1 then
+${HOME} --verbose grep sed
+		then sed && grep local && local --verbose
+&& printf cd 2>/dev/null export "$@" 'quoted text'
+	2>/dev/null "$@" -eu grep readonly "$@" && grep then echo 'quoted text'
+		done ${HOME} -eu 'quoted text' && sed "$1" --verbose done
+		export && awk x=1 | 'quoted text' x=1 export --verbose
+		sed export echo -eu then -eu readonly 'quoted text' 'quoted text'
+	| sed local cd echo $(pwd)
+readonly 'quoted text' test 'quoted text'
+then | ${HOME} && done | cd grep "$1" readonly ${HOME}
+2>/dev/null sed "$@" done "$1" "$@"
+printf "$@" export cd export ${HOME} | awk $(pwd) export then
+	-eu $(pwd) 2>/dev/null ${HOME} "$@" printf printf --verbose then 'quoted text'
+	-eu cd grep done ${HOME} readonly echo readonly --verbose
+		export awk sed 'quoted text' x=1 then grep x=1 test readonly
+	printf test sed "$@" sed awk then $(pwd) cd "$1"
+local "$@" export done /usr/bin ${HOME}
+	$(pwd) ${HOME} readonly readonly -eu awk | grep done 'quoted text'
+		--verbose | 2>/dev/null local
+test local "$1" printf $(pwd) test grep "$1" done
+awk 'quoted text' 2>/dev/null awk 2>/dev/null 2>/dev/null
+--verbose | readonly awk grep grep
+	printf /usr/bin export readonly awk $(pwd) $(pwd)
+	'quoted text' -eu readonly
+cd | && done /usr/bin export local grep "$1" export
+	&& ${HOME} readonly /usr/bin | $(pwd) $(pwd) then --verbose
+		echo then 'quoted text' --verbose -eu /usr/bin --verbose printf
+	cd sed awk | -eu readonly "$1" | cd 2>/dev/null
+	| $(pwd) 2>/dev/null 2>/dev/null --verbose grep echo local $(pwd) cd ${HOME} awk
+		-eu done $(pwd) && /usr/bin
+--verbose sed export | --verbose cd awk awk test readonly readonly
+		--verbose 'quoted text'
+"$@" ${HOME} --verbose done done sed
+local local x=1 /usr/bin local 2>/dev/null 'quoted text'
+		printf readonly done 'quoted text' grep cd
+"$@" ${HOME} ${HOME} done 2>/dev/null echo done
+$(pwd) -eu cd then awk cd "$1" -eu | /usr/bin echo local sed readonly | -eu
+		$(pwd) export echo printf x=1 sed echo "$@" grep
+		grep test echo $(pwd)
+	printf && test ${HOME} then sed done
+		x=1 "$1" grep /usr/bin $(pwd) cd echo echo readonly awk local grep grep
+2>/dev/null printf && cd 2>/dev/null then awk export grep "$@" readonly x=1
+printf readonly $(pwd) grep -eu local grep local echo && test grep /usr/bin
+		test sed grep local --verbose 2>/dev/null
+		local cd printf ${HOME} grep /usr/bin then 'quoted text'
+		'quoted text' | then && -eu awk "$@" 2>/dev/null awk && --verbose done x=1
+		"$@" export export cd 'quoted text' grep cd "$1"
+	'quoted text' ${HOME} "$1" && test echo ${HOME} test awk ${HOME}
+	2>/dev/null test echo ${HOME} | $(pwd) $(pwd) echo local
+	&& "$1" x=1 /usr/bin grep $(pwd) printf /usr/bin --verbose echo | ${HOME}
+	-eu x=1 echo | 'quoted text' done $(pwd)
+readonly $(pwd) sed -eu 2>/dev/null && "$1" cd
+		${HOME} --verbose export &&
+export export export --verbose
+		'quoted text' awk then 'quoted text' --verbose
+		export | echo | grep sed export -eu export 2>/dev/null echo done "$1" 'quoted text'
+		awk "$1" -eu readonly readonly ${HOME} sed | cd cd then "$1"
+	/usr/bin x=1 $(pwd) $(pwd)
+	export 'quoted text' done test local
+		sed cd 2>/dev/null readonly | echo --verbose x=1 cd ${HOME} "$1"
+	sed awk 'quoted text' done $(pwd) -eu readonly x=1 -eu readonly
+awk "$1" --verbose 'quoted text' x=1 2>/dev/null local "$1" export
+	${HOME} 2>/dev/null export | x=1 "$1"
+		/usr/bin test sed 2>/dev/null
+	done export /usr/bin "$1" 'quoted text' ${HOME} && --verbose test done $(pwd)
+		x=1 && ${HOME} echo "$1" "$1" echo sed cd ${HOME} "$1" 2>/dev/null
+		cd 2>/dev/null grep test done cd "$1" echo | --verbose && "$1" test x=1 'quoted text'
+		done sed ${HOME} x=1 | 'quoted text' local ${HOME} /usr/bin $(pwd) done
+local ${HOME} 2>/dev/null -eu /usr/bin "$@" printf test --verbose
+		'quoted text' "$1" "$1" test "$@" local echo echo
+	done 'quoted text' ${HOME} readonly awk ${HOME} local cd | printf x=1
+2>/dev/null 'quoted text' then x=1
+	echo "$1" /usr/bin awk sed printf "$1" then echo done sed
+	cd 'quoted text' "$1" grep local local echo -eu --verbose 2>/dev/null cd test awk
+		-eu 'quoted text' -eu x=1 "$@" 2>/dev/null printf 2>/dev/null
+	--verbose "$@" -eu "$@" -eu sed grep && 'quoted text' test echo
+		sed -eu --verbose done sed sed -eu test printf | ${HOME} 'quoted text' ${HOME}
+		&& sed && awk then cd "$1" /usr/bin
+	then test x=1 && 'quoted text' 'quoted text' awk -eu
+		'quoted text' --verbose then sed 2>/dev/null
+		sed "$@" $(pwd) cd 2>/dev/null
+export | test "$1" printf 'quoted text' test
+		${HOME} sed test | $(pwd) x=1 then "$@" cd readonly printf
+done | cd && -eu awk local echo x=1 /usr/bin --verbose
+	x=1 && readonly printf grep --verbose 'quoted text'
+		$(pwd) --verbose sed echo awk /usr/bin test
+		| awk x=1 export -eu printf done local
+		"$1" | done then printf -eu local "$1" awk local readonly "$@"
+		"$@" x=1 | printf echo readonly "$@" printf "$@" x=1 | readonly test "$@" "$@"
+	then | 'quoted text' export /usr/bin
+echo -eu && done readonly test
+		export grep --verbose $(pwd) $(pwd)
+	-eu -eu then "$@" /usr/bin /usr/bin && echo grep sed | "$1"
+"$1" 'quoted text' readonly | cd --verbose local $(pwd)
+	| printf done export readonly x=1
+awk test 2>/dev/null printf export readonly
+		&& -eu sed && test export 'quoted text'
+		| export test ${HOME} cd export awk done /usr/bin && done ${HOME} readonly cd
+		done "$@" sed printf local done cd -eu --verbose awk -eu export done && awk awk
+		printf readonly sed 2>/dev/null done test x=1 sed printf done --verbose
+	/usr/bin printf $(pwd) 'quoted text' 'quoted text' local x=1 grep &&
+${HOME} x=1 /usr/bin -eu "$@" cd readonly done x=1 --verbose
+		"$1" local 2>/dev/null
+	"$@" 'quoted text' echo $(pwd) awk readonly
+local test $(pwd) --verbose /usr/bin
+--verbose echo 2>/dev/null 'quoted text' "$@"
+${HOME} echo local $(pwd)
+done done -eu grep done done 'quoted text' local "$@" awk 2>/dev/null readonly
+readonly sed grep printf test echo done echo then | x=1 "$@"
+		cd cd ${HOME} | "$1" export export printf grep sed sed ${HOME} test -eu -eu cd then
+	--verbose ${HOME} | done --verbose printf x=1 2>/dev/null then ${HOME} "$@" --verbose
+		2>/dev/null 'quoted text' then readonly x=1 "$1" --verbose
+"$@" sed && "$@" readonly grep local
+	export --verbose | then grep ${HOME} then
+	${HOME} local cd printf then x=1 "$1" local local "$1" export && then cd
+		"$1" ${HOME} then --verbose "$@" export done local "$1"
+		$(pwd) -eu --verbose done then done --verbose
+	-eu --verbose "$1" "$@" done "$1" sed awk sed 'quoted text'
+grep -eu $(pwd) cd $(pwd)
+		readonly "$1" awk -eu | && "$@" sed "$@" sed test echo
+		sed then /usr/bin done | "$@"
+	printf x=1 "$1" awk local done grep export $(pwd)
+		then done $(pwd) 'quoted text' 2>/dev/null then sed $(pwd)
+		grep printf local printf && test 'quoted text'
+		x=1 2>/dev/null then test then grep
+		readonly "$@" ${HOME} export
+2>/dev/null "$@" $(pwd) |
+		--verbose echo /usr/bin export
+		export sed printf 'quoted text'
+'quoted text' printf awk | 2>/dev/null
+		printf grep x=1 | ${HOME} 2>/dev/null x=1 printf echo grep 2>/dev/null
+	printf && | readonly sed local local && | sed then $(pwd) | echo -eu
+		/usr/bin readonly x=1 $(pwd) $(pwd) && $(pwd) local "$1" && sed export && echo
+	$(pwd) 2>/dev/null test sed test --verbose
+	cd local x=1 --verbose test ${HOME} grep $(pwd)
+	echo -eu 'quoted text' grep $(pwd) local echo done 2>/dev/null 'quoted text'
+"$1" readonly --verbose grep | "$1" 'quoted text' | 2>/dev/null local
+export awk echo then && readonly $(pwd) test $(pwd) printf "$@" 'quoted text' test
+	2>/dev/null printf echo "$1" && export grep awk $(pwd) grep
+		echo 'quoted text' sed "$1" --verbose done printf 'quoted text'
+		x=1 /usr/bin $(pwd) awk "$1" awk echo test &&
+		echo 'quoted text' ${HOME} readonly readonly /usr/bin printf
+		grep 2>/dev/null echo test /usr/bin
+test "$@" --verbose local 'quoted text'
+		&& then $(pwd) done echo -eu ${HOME} cd readonly
+		readonly x=1 readonly 'quoted text' test echo done && -eu export ${HOME} ${HOME}
+local echo /usr/bin test awk local
+		| echo readonly --verbose cd -eu "$@" -eu echo awk 2>/dev/null test /usr/bin
+		local && printf then 2>/dev/null /usr/bin -eu done readonly x=1 printf awk "$1"
+		$(pwd) -eu && "$1" ${HOME} $(pwd) sed done /usr/bin
+		/usr/bin echo x=1 readonly "$1" awk && export echo 2>/dev/null
+x=1 -eu grep grep sed 'quoted text' then | && x=1 "$1" done --verbose
+awk "$1" grep && export 'quoted text'
+| test sed $(pwd) done then printf /usr/bin awk
+	readonly "$@" --verbose echo
+	&& sed then -eu | awk printf && grep $(pwd) 'quoted text'
+cd cd 2>/dev/null x=1 export awk -eu cd "$@" --verbose -eu printf | x=1 | x=1
+	'quoted text' printf awk readonly then --verbose readonly local
+		echo -eu ${HOME} 'quoted text' "$@" | grep "$1" 2>/dev/null 2>/dev/null
+$(pwd) ${HOME} test $(pwd) --verbose 2>/dev/null
+		readonly "$1" test --verbose awk ${HOME} printf $(pwd)
+	printf --verbose awk local readonly grep printf grep done printf cd
+	grep ${HOME} local printf test
+		export && && sed local --verbose
+	done 'quoted text' ${HOME} | -eu ${HOME}
+"$1" done readonly test "$1" /usr/bin cd done && && "$1" --verbose export
+		readonly ${HOME} ${HOME} done then | "$@" echo grep
+	awk $(pwd) | /usr/bin "$@" sed export -eu ${HOME}
+		local test export | "$1" awk done local
+	readonly -eu grep sed echo local x=1 /usr/bin echo readonly local
+		--verbose sed then 'quoted text'
+	then --verbose test | /usr/bin grep then
+		${HOME} "$1" --verbose "$@" -eu x=1 /usr/bin "$1" 2>/dev/null
+"$@" --verbose | echo && ${HOME}
+	-eu && export ${HOME} readonly
+x=1 'quoted text' -eu x=1 cd printf awk readonly cd -eu grep printf sed cd
+		then cd | export "$@" 2>/dev/null ${HOME}
+	$(pwd) cd test sed "$1" awk then readonly export export "$@" --verbose --verbose
+		2>/dev/null local grep export test $(pwd) --verbose 2>/dev/null echo
+	| cd readonly export grep export test $(pwd) grep
+	${HOME} $(pwd) -eu x=1 done | "$@" ${HOME} 'quoted text' /usr/bin
+	| x=1 export sed --verbose
+	${HOME} echo awk | test done -eu 2>/dev/null echo readonly grep $(pwd) done
+	'quoted text' export test && && then then "$@" readonly test | echo local
+		local x=1 awk printf grep "$1" local x=1 then awk 'quoted text'
+		x=1 local export test "$1" 2>/dev/null then 2>/dev/null ${HOME} /usr/bin
+	sed local done echo grep ${HOME} | "$1" 2>/dev/null $(pwd) echo
+		&& x=1 "$@" echo "$1" grep 2>/dev/null printf --verbose test -eu test
+test | grep echo test | --verbose cd
+		export local 2>/dev/null ${HOME} test "$@" "$@" | export done
+	sed export x=1 local then done
+		echo awk "$1" "$1" "$@" local awk
+	"$1" test cd grep 'quoted text' readonly readonly
+then export ${HOME} export /usr/bin grep | $(pwd) grep &&
+		2>/dev/null 'quoted text' test readonly
+	"$1" && done "$@" awk 'quoted text' printf --verbose && 2>/dev/null
+		${HOME} done then | done then 2>/dev/null readonly local echo awk
+		--verbose 'quoted text' cd -eu $(pwd) done $(pwd) x=1 local /usr/bin
+	awk -eu | readonly x=1 $(pwd) ${HOME} $(pwd) cd | "$@" export && then
+		sed grep /usr/bin readonly then readonly -eu done ${HOME} then grep
+	${HOME} export then done && /usr/bin "$@" -eu "$@" export ${HOME}
+'quoted text' printf "$1" 2>/dev/null "$@" sed test 'quoted text'
+2>/dev/null awk grep $(pwd) $(pwd) then export awk "$1"
+		done && "$1" local --verbose 'quoted text'
+		cd --verbose awk export test 'quoted text' readonly
+	then done -eu printf grep 2>/dev/null
+		x=1 echo done 2>/dev/null
+sed awk "$@" sed --verbose
+	readonly readonly $(pwd)
+	awk then cd test readonly test --verbose 'quoted text' | -eu | --verbose
+	grep 2>/dev/null echo $(pwd) ${HOME} awk | printf /usr/bin 2>/dev/null --verbose
+	sed -eu then test local "$1" local grep x=1
+x=1 sed sed /usr/bin then readonly grep "$1" echo "$1" readonly
+	-eu 'quoted text' sed "$1" awk awk --verbose --verbose
+${HOME} sed local --verbose
+	export done awk then | grep cd sed cd 'quoted text' | readonly awk
+		"$1" done then echo "$1" "$@" sed readonly -eu "$1" $(pwd)
+	grep done /usr/bin grep done grep export && $(pwd) 'quoted text' done printf
+'quoted text' echo 2>/dev/null "$@" ${HOME}
+done test $(pwd) sed $(pwd) printf test
+then 'quoted text' x=1 echo ${HOME} | $(pwd) cd x=1 --verbose /usr/bin printf
+	| "$1" "$1" echo -eu | awk "$@" printf sed 2>/dev/null x=1 grep
+2>/dev/null "$@" x=1 grep $(pwd) | awk readonly 'quoted text' "$@" x=1
+	echo ${HOME} then grep "$1" 'quoted text' --verbose x=1 ${HOME}
+		-eu "$1" echo "$1" x=1 /usr/bin then --verbose awk
+export $(pwd) sed readonly cd 'quoted text' 'quoted text' "$@" 'quoted text'
+	awk 2>/dev/null && awk x=1 2>/dev/null "$@" local -eu -eu
+done then && -eu ${HOME} "$@" export | 'quoted text'
+| echo then echo echo awk done local "$1" | /usr/bin export 'quoted text'
+		x=1 /usr/bin "$@" -eu "$@" local grep export local then readonly readonly
+awk export sed ${HOME}
+"$1" -eu 2>/dev/null 2>/dev/null grep 2>/dev/null "$@" x=1 2>/dev/null
+'quoted text' sed "$@" -eu | -eu
+		cd -eu /usr/bin -eu sed done && $(pwd)
+	local "$1" cd awk "$1" "$@" "$1" readonly awk "$1" grep $(pwd) "$1"
+	awk --verbose /usr/bin -eu sed 'quoted text' x=1 /usr/bin
+2>/dev/null export | local 'quoted text' "$1" cd /usr/bin /usr/bin local $(pwd)
+		test -eu $(pwd) done then /usr/bin ${HOME} sed printf "$@"
+sed awk echo ${HOME} | -eu -eu export test && done export then
+	--verbose 2>/dev/null then readonly 'quoted text' sed "$@" printf x=1 export
+cd 'quoted text' grep awk x=1 ${HOME} && "$@" then
+		readonly grep readonly readonly grep sed export then then grep printf
+	export printf export printf sed ${HOME} done ${HOME}
+&& echo | test sed export local cd && export -eu readonly readonly
+	x=1 readonly "$1" export ${HOME} 'quoted text'
+	test then "$1" "$1" sed local --verbose
+&& sed --verbose export readonly /usr/bin "$@" printf --verbose local
+local 'quoted text' "$@" x=1 local && && test "$@" "$1" sed -eu
+/usr/bin -eu awk 'quoted text' && echo
+"$1" 'quoted text' /usr/bin local x=1 echo 2>/dev/null | "$@" --verbose
+		'quoted text' /usr/bin then --verbose 'quoted text'
+&& done echo local grep echo x=1 then echo then awk
+	"$@" /usr/bin sed readonly cd done
+		"$@" printf && --verbose then $(pwd) | ${HOME} then /usr/bin 'quoted text' export
+		x=1 x=1 readonly -eu "$@" /usr/bin sed done --verbose grep done
+	"$1" echo echo grep cd $(pwd) 'quoted text' echo
+export | -eu ${HOME} printf && --verbose "$1" 2>/dev/null
+--verbose -eu 'quoted text' 'quoted text' 2>/dev/null cd
+&& cd test && echo done grep ${HOME} export
+		awk then cd echo then echo ${HOME} echo
+		local "$@" "$1" --verbose -eu "$@" $(pwd) awk /usr/bin "$1"
+	--verbose awk printf 2>/dev/null done && 2>/dev/null
+	'quoted text' $(pwd) local export x=1 "$@" /usr/bin grep done export "$@" -eu
+	'quoted text' --verbose 2>/dev/null
+	echo done 'quoted text' sed awk 2>/dev/null test export
+/usr/bin -eu && done printf sed x=1 done readonly test
+"$@" ${HOME} /usr/bin cd /usr/bin
+2>/dev/null sed x=1 'quoted text' x=1 cd done local -eu && echo
+		--verbose --verbose awk export readonly -eu readonly sed awk "$1" export
+		${HOME} test "$@" | sed
+echo then --verbose "$1" "$@" 'quoted text' export then
+sed local test echo 2>/dev/null | $(pwd) test test && test export grep
+		sed awk "$1" cd /usr/bin cd x=1 ${HOME} awk --verbose /usr/bin cd cd awk export
+		done x=1 cd cd -eu cd done /usr/bin local 'quoted text'
+	awk --verbose --verbose 2>/dev/null 'quoted text' /usr/bin awk local -eu
+		sed echo sed && cd echo awk
+		--verbose && readonly local echo 'quoted text'
+done then "$1" x=1 test 'quoted text' /usr/bin | printf printf
+		export -eu x=1 local ${HOME} awk 'quoted text' && --verbose
+		-eu awk export "$@" -eu 2>/dev/null then $(pwd)
+		"$@" local x=1 -eu grep
+		--verbose grep done /usr/bin local readonly local then 2>/dev/null cd 2>/dev/null
+	'quoted text' readonly then then "$@" then cd
+		${HOME} $(pwd) sed 'quoted text'
+	${HOME} /usr/bin grep | test 2>/dev/null "$@" awk test readonly export
+		export printf ${HOME} export readonly /usr/bin $(pwd)
+	"$@" echo | | cd $(pwd) --verbose echo
+	grep test --verbose --verbose echo cd | /usr/bin test local grep awk readonly
+"$1" --verbose "$1" cd sed grep ${HOME} echo x=1 local
+	then 'quoted text' echo grep readonly echo done grep
+		grep sed $(pwd) 2>/dev/null $(pwd) && --verbose ${HOME} printf -eu $(pwd)
+	readonly $(pwd) done sed printf --verbose /usr/bin
+		x=1 awk | export echo | export -eu x=1 done echo 2>/dev/null
+echo 'quoted text' export local echo --verbose
+	&& -eu awk grep "$1" sed $(pwd) cd && &&
+	export ${HOME} awk x=1 printf x=1 2>/dev/null test
+"$1" test sed done local -eu cd local && grep
+	export sed grep printf test export
+then 2>/dev/null 'quoted text' awk sed grep --verbose 'quoted text' readonly
+2>/dev/null local then local sed ${HOME} -eu $(pwd) 'quoted text' ${HOME}
+x=1 sed 'quoted text' then
+		awk sed printf grep test cd $(pwd) 'quoted text' then /usr/bin "$@" -eu && then
+	${HOME} sed && "$1" ${HOME} "$@" awk readonly local done | ${HOME}
+then -eu readonly readonly sed echo local readonly cd then awk /usr/bin /usr/bin
+		sed then test 'quoted text'
+	x=1 | grep x=1 export 'quoted text' -eu /usr/bin readonly cd
+	grep 'quoted text' export --verbose && 'quoted text'
+	printf local 'quoted text' readonly then done readonly
+awk "$1" export /usr/bin printf | local "$@" then local
+done --verbose ${HOME} awk --verbose export --verbose
+done test cd export test | && /usr/bin cd "$1" then export
+	readonly printf done "$@"
+		readonly export && awk /usr/bin --verbose done
+		&& grep $(pwd) --verbose -eu echo "$1" awk
+echo -eu /usr/bin sed export
+	then ${HOME} sed cd /usr/bin awk cd printf awk
+"$1" x=1 awk echo cd "$@" "$1" grep 'quoted text' local grep printf
+		readonly x=1 cd | test -eu -eu printf $(pwd) awk
+/usr/bin -eu done done --verbose 2>/dev/null | then done "$@"
+	readonly grep && export
+test awk export -eu echo && "$1" $(pwd) "$@" 'quoted text' --verbose
+done test cd printf export then x=1 2>/dev/null test
+2>/dev/null printf ${HOME} /usr/bin &&
+	-eu /usr/bin --verbose export export
+		--verbose "$@" then test export /usr/bin ${HOME} export done test grep readonly
+| $(pwd) local | && then x=1
+echo && && --verbose sed "$@" ${HOME} "$1" then echo
+		done x=1 echo export 'quoted text' done $(pwd) printf echo ${HOME}
+	test sed done "$1" &&
+export grep printf $(pwd) test 'quoted text'
+${HOME} && echo then /usr/bin done
+	echo 'quoted text' "$@" /usr/bin grep test "$@" awk | ${HOME} test
+	local awk local && done
+		sed | 2>/dev/null ${HOME} sed done
+$(pwd) done echo x=1 export
+	grep "$1" --verbose 'quoted text' export sed -eu 2>/dev/null x=1 'quoted text'
+	"$1" sed awk done --verbose
+		x=1 2>/dev/null done 2>/dev/null
+		$(pwd) x=1 | && sed grep sed x=1 "$@" $(pwd) export
+	local -eu export awk printf cd | 2>/dev/null export awk printf
+		export echo && awk "$@" x=1 ${HOME}
+		-eu /usr/bin export "$1" printf readonly
+	"$1" local export readonly grep 2>/dev/null readonly | && then && printf 2>/dev/null
+${HOME} x=1 $(pwd) 2>/dev/null /usr/bin grep done | sed readonly echo /usr/bin
+	"$1" /usr/bin grep sed "$@" echo 2>/dev/null && "$1" done | printf 2>/dev/null
+		2>/dev/null printf && ${HOME} "$1" grep awk export cd cd 'quoted text'
+printf cd x=1 $(pwd) | --verbose grep x=1 "$1" /usr/bin local /usr/bin
+'quoted text' | 'quoted text' 2>/dev/null
+	test && sed sed echo | /usr/bin $(pwd) x=1 then printf --verbose
+test "$1" cd readonly test readonly
+	export "$@" | printf printf printf x=1 readonly && && export x=1
+local local -eu 2>/dev/null
+test 'quoted text' 'quoted text' grep --verbose
+		$(pwd) sed ${HOME} sed 'quoted text' ${HOME}
+		| /usr/bin export then cd 'quoted text'
+-eu cd x=1 printf printf "$1" export /usr/bin readonly /usr/bin -eu && 'quoted text'
+	--verbose "$1" echo 'quoted text' test $(pwd) x=1
+		awk 2>/dev/null test awk && grep
+grep "$1" export x=1 --verbose printf ${HOME} /usr/bin sed
+		/usr/bin $(pwd) $(pwd) done echo
+$(pwd) then 2>/dev/null && -eu --verbose --verbose x=1 ${HOME} ${HOME}
+echo cd then test done "$1" "$@" 2>/dev/null 'quoted text' then then "$@" printf
+	--verbose local printf done /usr/bin done sed readonly
+	local "$@" sed echo cd readonly test $(pwd) ${HOME} 'quoted text'
+		cd then awk local /usr/bin "$@" --verbose | --verbose local 'quoted text'
+grep cd grep $(pwd) --verbose x=1 && 2>/dev/null
+export "$@" "$1" local sed echo x=1 grep | cd cd && cd /usr/bin
+"$1" $(pwd) --verbose readonly readonly
+local test | "$@" $(pwd) "$@" local ${HOME} readonly awk && export x=1
+	'quoted text' echo "$@" | 'quoted text' 2>/dev/null
+		then export done | | printf x=1 $(pwd) export echo then
+		&& -eu x=1 2>/dev/null sed echo --verbose x=1 printf then "$@" "$@" "$1"
+	then "$1" echo "$@" then ${HOME} -eu
+		${HOME} | "$1" x=1 then --verbose
+		local && awk done -eu &&
+	then sed echo $(pwd) /usr/bin awk test printf --verbose 2>/dev/null
+"$1" readonly -eu "$@" sed
+		then cd | $(pwd) echo
+printf test done cd -eu then export "$@" | cd && "$@"
+		--verbose export test done grep ${HOME} ${HOME} done readonly
+sed test -eu "$@" 'quoted text' -eu export test test 2>/dev/null
+2>/dev/null then "$@" | 2>/dev/null /usr/bin x=1 cd sed test ${HOME}
+	cd /usr/bin test grep && -eu test 2>/dev/null cd -eu local grep x=1 printf
+		awk readonly 'quoted text'
+awk -eu printf --verbose "$1" -eu readonly cd ${HOME}
+	sed "$@" readonly grep awk done export echo ${HOME} done done 'quoted text'
+		printf export local sed | local printf && local
+done then awk sed readonly | $(pwd) 'quoted text'
+		| readonly done -eu 2>/dev/null
+		--verbose awk ${HOME} x=1 'quoted text' -eu 2>/dev/null grep cd
+		2>/dev/null local readonly readonly then $(pwd) /usr/bin cd echo
+done 2>/dev/null cd | test 'quoted text' "$1" export -eu done printf | echo
+		-eu 'quoted text' awk echo ${HOME} grep
+&& && grep echo export sed $(pwd) /usr/bin /usr/bin 2>/dev/null | echo /usr/bin
+		readonly 2>/dev/null && sed awk export && cd local local -eu printf
+	cd printf 'quoted text' printf | /usr/bin export export 'quoted text' && ${HOME}
+then grep $(pwd) export awk "$@" 2>/dev/null
+	awk ${HOME} readonly "$1" sed ${HOME} "$@" x=1 | printf awk local 2>/dev/null
+		| test done sed -eu done grep x=1 "$@" 2>/dev/null grep
+local $(pwd) local sed printf local
+readonly x=1 | done echo -eu grep --verbose x=1 grep
+		/usr/bin ${HOME} grep 2>/dev/null x=1 export printf printf "$@" export
+grep | done -eu printf --verbose $(pwd) export then "$1" -eu | -eu -eu echo
+local -eu sed awk | then
+x=1 $(pwd) echo done sed && $(pwd)
+	export x=1 2>/dev/null --verbose 2>/dev/null "$1"
+	--verbose local export | "$@" grep ${HOME} local test
+		"$@" "$@" /usr/bin | && local grep && $(pwd)
+		then "$@" echo 2>/dev/null test "$@" | test x=1 awk sed $(pwd) done awk
+		'quoted text' printf -eu readonly "$@" $(pwd) then /usr/bin $(pwd) awk sed sed
+| 'quoted text' "$1" && readonly "$@" "$1" done /usr/bin
+	"$1" x=1 export echo echo echo
+2>/dev/null export "$@" awk $(pwd) cd readonly
+		&& "$1" "$1" awk then
+		sed /usr/bin "$@" local "$@" -eu done
+'quoted text' test grep done sed && export then && local
+x=1 "$1" local then $(pwd) 2>/dev/null export -eu --verbose x=1 | "$@" 'quoted text'
+		&& test "$@" local then awk echo test
+	x=1 -eu "$@" done done 2>/dev/null echo grep printf then "$@" | 2>/dev/null
+	"$1" cd $(pwd) echo printf x=1 echo 'quoted text' cd
+	awk $(pwd) awk ${HOME} echo grep awk readonly printf
+	-eu --verbose ${HOME} grep "$@" cd ${HOME} | local echo
+		-eu grep printf done printf -eu | "$1"
+export --verbose test readonly awk grep sed "$@" cd "$1" test
+'quoted text' 'quoted text' readonly
+export --verbose export readonly && readonly readonly done 'quoted text'
+		"$1" -eu test && readonly export sed
+printf "$1" printf 'quoted text'
+		&& $(pwd) ${HOME} readonly --verbose export --verbose
+		done printf ${HOME} && export -eu | 2>/dev/null --verbose 2>/dev/null && printf
+/usr/bin 'quoted text' cd printf cd sed
+	then 2>/dev/null "$@" "$@" done test -eu awk
+	"$@" -eu done readonly cd export --verbose --verbose
+	readonly test cd then export local readonly
+	echo $(pwd) "$@" $(pwd) grep 'quoted text'
+then sed test /usr/bin -eu cd -eu 'quoted text'
+	then --verbose local ${HOME} readonly | cd -eu local echo
+done then -eu 2>/dev/null done echo --verbose
+"$1" /usr/bin sed 2>/dev/null
+		&& "$@" done local awk test "$1" awk &&
+${HOME} test 2>/dev/null echo cd "$1" local then "$1" sed && readonly
+	&& /usr/bin 2>/dev/null test then
+	done /usr/bin -eu grep && x=1 echo grep $(pwd)
+--verbose grep 2>/dev/null 2>/dev/null 'quoted text' $(pwd) sed && printf cd
+	grep echo awk local grep
+	2>/dev/null && cd "$1" 2>/dev/null echo grep
+		grep grep done then done grep 2>/dev/null 2>/dev/null local test echo /usr/bin
+local --verbose /usr/bin
+	done printf printf && --verbose | $(pwd) | "$1"
+	echo test x=1 test local x=1 export
+readonly | done echo | $(pwd)
+		"$1" local sed cd -eu test echo test /usr/bin local
+"$1" 2>/dev/null printf grep
+		&& && --verbose | then x=1 grep awk
+	then && /usr/bin --verbose done cd export x=1 $(pwd) /usr/bin --verbose
+cd /usr/bin local "$@" ${HOME} 'quoted text' cd -eu | 'quoted text'
+		$(pwd) cd readonly /usr/bin export export && "$1" "$@" && awk
+		--verbose local --verbose grep awk x=1 sed --verbose
+echo $(pwd) x=1 readonly done 'quoted text' 2>/dev/null grep /usr/bin readonly
+'quoted text' echo readonly export local sed printf ${HOME} $(pwd) cd test
+printf $(pwd) done ${HOME} x=1 "$1" readonly export /usr/bin then echo
+	done done $(pwd) && export | "$1" export
+echo "$1" 'quoted text' local awk grep -eu x=1 -eu printf
+	--verbose grep /usr/bin 2>/dev/null $(pwd) local cd ${HOME} echo readonly
+"$1" 'quoted text' "$@" -eu grep 'quoted text' --verbose awk awk -eu 'quoted text'
+		export $(pwd) /usr/bin echo then && --verbose awk test "$1" x=1 x=1 cd cd x=1 -eu
+printf "$@" readonly readonly && && $(pwd) done grep "$1" printf done "$1"
+		&& $(pwd) then --verbose -eu /usr/bin -eu test "$@" then | then "$1"
+		${HOME} && cd readonly 'quoted text' "$@" readonly
+then done ${HOME} printf -eu cd "$@" 'quoted text'
+readonly "$1" && /usr/bin | done "$1" awk printf
+readonly done local $(pwd) sed export /usr/bin | "$1" export echo
+		x=1 --verbose "$1" $(pwd)
+	local sed printf cd 'quoted text' --verbose /usr/bin
+		--verbose -eu --verbose printf ${HOME} sed printf local export echo echo
+&& 'quoted text' printf "$@" cd 2>/dev/null cd 'quoted text'
+cd /usr/bin 2>/dev/null | test done "$@" --verbose "$@" done cd
+sed -eu | -eu && x=1 && readonly -eu printf x=1 'quoted text'
+	--verbose cd x=1 printf "$1" "$@"
+		readonly | sed readonly 'quoted text' $(pwd) | readonly local ${HOME}
+		"$1" 2>/dev/null "$@" x=1 awk "$1" test -eu
+sed done readonly x=1 ${HOME} ${HOME} 2>/dev/null --verbose printf
+	&& cd ${HOME} $(pwd) export grep | cd "$1" then awk
+test ${HOME} "$@" ${HOME} echo sed
+	-eu $(pwd) -eu printf "$1" echo x=1 "$1"
+		then readonly "$1" echo --verbose cd echo "$1" $(pwd)
+export readonly -eu -eu cd /usr/bin 'quoted text' then && then local "$1" "$@"
+		| then cd sed -eu echo | then local /usr/bin
+&& local then /usr/bin printf $(pwd) echo readonly x=1 readonly | test
+		then sed cd --verbose readonly ${HOME} done awk echo done
+	export ${HOME} "$@" awk
+	-eu 2>/dev/null "$1" && cd export "$@" -eu cd "$@" local --verbose then
+	export | awk printf cd cd 'quoted text'
+	-eu done /usr/bin test readonly sed awk done -eu
+	2>/dev/null printf awk -eu echo "$@" then
+then printf "$@" "$@" grep printf | "$@" grep 2>/dev/null grep test 'quoted text'
+		'quoted text' local && && sed local
+sed sed done grep cd printf -eu
+--verbose grep done 2>/dev/null "$@" export x=1
+		cd local ${HOME} 'quoted text' grep
+| cd ${HOME} "$1" printf echo x=1 then
+${HOME} -eu done | done "$@" export awk "$1" export
+x=1 sed printf readonly -eu done | ${HOME} $(pwd)
+	done "$1" local x=1 export /usr/bin
+		readonly && local cd sed grep readonly export local cd ${HOME} /usr/bin
+	"$@" grep awk echo export printf "$1" export 'quoted text' $(pwd)
+	x=1 "$1" printf export done -eu --verbose local awk printf echo x=1 readonly
+		printf then test cd sed $(pwd) "$1" then cd cd printf echo "$@"
+		awk grep --verbose grep grep -eu readonly readonly
+	x=1 --verbose /usr/bin 'quoted text' | done -eu local
+	printf awk done test "$@" printf 2>/dev/null | "$1" echo --verbose test $(pwd)
+	printf grep /usr/bin grep /usr/bin $(pwd)
+		"$@" x=1 done echo $(pwd) test export then
+/usr/bin test 'quoted text' x=1 then x=1 --verbose cd printf readonly echo done
+readonly grep $(pwd) --verbose test "$@" x=1 export sed $(pwd)
+sed echo readonly echo
+awk cd "$@" sed --verbose /usr/bin export
+cd --verbose $(pwd) --verbose
+		"$@" printf -eu && then 2>/dev/null
+&& ${HOME} test 2>/dev/null $(pwd) "$1" $(pwd) /usr/bin export 'quoted text'
+	&& export echo $(pwd) | | done "$1"
+		echo x=1 2>/dev/null then export "$@"
+		x=1 --verbose export done
+"$@" export cd sed | local $(pwd) 2>/dev/null sed "$@" 'quoted text' done
+		sed --verbose done | printf ${HOME}
+		2>/dev/null && $(pwd) test local readonly test export
+	'quoted text' readonly 'quoted text' done x=1
+printf && /usr/bin readonly "$@" grep
+test --verbose then awk $(pwd) "$1" export && printf grep
+	2>/dev/null x=1 done /usr/bin /usr/bin |
+	--verbose "$@" cd done --verbose
+	export --verbose then "$@" echo ${HOME}
+	${HOME} --verbose 2>/dev/null -eu $(pwd) x=1 then /usr/bin echo export
+	"$1" awk printf -eu | grep readonly cd cd sed grep --verbose readonly
+		grep "$1" 2>/dev/null $(pwd) export cd x=1 && test printf 'quoted text'
+		readonly $(pwd) awk echo cd printf | then | sed /usr/bin
+	--verbose -eu readonly done awk cd done done ${HOME} printf 'quoted text' done
+		$(pwd) awk -eu "$@" x=1
+		done --verbose x=1 'quoted text' sed $(pwd) printf ${HOME} 2>/dev/null cd
+		readonly | | test test printf x=1 readonly export sed /usr/bin
+		'quoted text' && | grep sed done && done test local $(pwd) 2>/dev/null
+grep cd /usr/bin -eu
+		${HOME} 'quoted text' /usr/bin printf
+		readonly "$@" readonly sed && /usr/bin 'quoted text' cd ${HOME} grep then x=1
+$(pwd) echo && 2>/dev/null
+"$@" "$@" | printf "$@" cd printf sed | echo then grep echo local /usr/bin $(pwd)
+	"$1" ${HOME} readonly printf printf "$1" test
+	awk echo "$@" ${HOME} ${HOME} then readonly awk && done
+| export /usr/bin "$@" | then 2>/dev/null $(pwd)
+		2>/dev/null local then && then x=1 grep sed cd ${HOME} -eu then &&
+cd /usr/bin 'quoted text' "$@" printf "$@" 'quoted text'
+		then then | --verbose then && grep && $(pwd) ${HOME} echo | -eu grep test echo
+		'quoted text' export then -eu x=1 echo export -eu 2>/dev/null test
+readonly ${HOME} local
+2>/dev/null cd && readonly cd grep readonly
+	done echo test "$@" readonly --verbose
+	--verbose -eu 2>/dev/null done 'quoted text' then awk ${HOME} 'quoted text' "$@"
+		sed "$1" x=1 export sed 2>/dev/null "$1"
+		echo readonly readonly $(pwd) readonly && readonly grep -eu done echo
+	awk test --verbose && 2>/dev/null | cd
+then | readonly sed sed "$1" test 2>/dev/null /usr/bin && x=1
+/usr/bin export awk /usr/bin test && sed $(pwd)
+		'quoted text' "$1" done local "$@" && then
+printf 2>/dev/null printf "$1"
+		/usr/bin awk $(pwd) | -eu | grep cd x=1
+-eu "$@" "$1" -eu local -eu echo printf ${HOME}
+		cd -eu printf --verbose done $(pwd)
+	-eu readonly sed --verbose -eu done | 2>/dev/null $(pwd) sed
+then readonly --verbose "$@" "$@" test readonly "$1" then "$1"
+	"$1" -eu cd done | echo
+		"$1" 2>/dev/null echo local export $(pwd)
+echo /usr/bin "$1" done "$@" -eu 2>/dev/null
+	printf "$1" 2>/dev/null x=1 export awk && readonly echo done grep $(pwd)
+/usr/bin "$1" printf export cd readonly $(pwd) /usr/bin /usr/bin ${HOME}
+	grep 2>/dev/null readonly x=1 printf awk | readonly 'quoted text' sed /usr/bin
+	x=1 done done then x=1 "$1" echo | --verbose
+		local "$1" "$@" sed sed awk sed printf 2>/dev/null sed && | export grep done
+	awk export cd ${HOME} readonly test
+	${HOME} 'quoted text' sed $(pwd) cd done 'quoted text' readonly printf | ${HOME}
+	test -eu test echo test 2>/dev/null printf /usr/bin
+	printf "$@" 2>/dev/null &&
+	then cd readonly --verbose "$1" 'quoted text' test x=1 export cd printf
+x=1 --verbose "$@" && export -eu then
+	${HOME} done done ${HOME} cd 2>/dev/null --verbose
+	"$@" printf done -eu test grep done printf x=1 echo x=1 local
+x=1 2>/dev/null then done cd awk sed --verbose -eu awk
+		export "$@" "$1" awk 'quoted text'
+printf echo 'quoted text' grep cd && && echo
+sed grep 2>/dev/null "$@" -eu "$1" local sed -eu 'quoted text'
+	test sed grep printf then test
+${HOME} sed then x=1 -eu x=1 /usr/bin
+	| 2>/dev/null sed awk "$@" done echo /usr/bin "$1" /usr/bin
+		cd x=1 && then x=1 local ${HOME} $(pwd) done local -eu then export && ${HOME} 2>/dev/null
+-eu && export then && && done readonly
+		local cd export "$@" | test done grep
+		$(pwd) export ${HOME} && readonly /usr/bin "$@" local x=1 readonly
+		grep ${HOME} ${HOME} "$@" ${HOME}
+		grep export echo export printf /usr/bin readonly export cd sed x=1 awk "$@"
+		sed 2>/dev/null "$@" cd test "$1" -eu "$1" export sed done ${HOME} awk
+		printf --verbose export x=1 "$1"
+		printf | && ${HOME} 'quoted text' export
+	local "$1" then 2>/dev/null |
+test x=1 -eu -eu readonly
+	export --verbose done grep sed echo x=1 test "$@"
+		"$1" | cd sed /usr/bin cd "$@" "$1" printf x=1 "$@" cd cd ${HOME} -eu then
+readonly && printf grep readonly
+	"$@" | then test "$1" -eu --verbose 2>/dev/null ${HOME} --verbose
+		"$@" 'quoted text' $(pwd) ${HOME} test readonly
+		export -eu sed echo test test export local $(pwd) test grep && grep local
+&& then "$1" cd x=1 x=1 done /usr/bin then grep
+		grep awk readonly echo 2>/dev/null local --verbose
+sed echo | local x=1 then 2>/dev/null readonly local
+		cd sed ${HOME} "$@" echo && test && 'quoted text' readonly sed 2>/dev/null
+	2>/dev/null printf local "$1"
+then grep grep && --verbose | export 2>/dev/null
+printf echo $(pwd) x=1 then -eu readonly |
+		&& "$@" grep ${HOME} "$@" 2>/dev/null local printf
+	printf ${HOME} 2>/dev/null local awk
+		"$1" sed ${HOME} x=1 test export awk local | "$@"
+		"$1" cd | local /usr/bin "$1" done readonly test awk $(pwd) x=1 | | printf
+	'quoted text' && test -eu test sed grep 2>/dev/null && "$@"
+	${HOME} echo then local local ${HOME} | cd /usr/bin then
+	'quoted text' ${HOME} 2>/dev/null -eu x=1 readonly readonly
+	--verbose local $(pwd) echo "$1"
+		${HOME} x=1 local test grep grep readonly
+export 2>/dev/null readonly ${HOME}
+	echo printf -eu then --verbose | sed x=1 'quoted text' $(pwd) echo export
+x=1 export grep ${HOME} --verbose x=1 --verbose
+		sed awk && /usr/bin export grep sed 'quoted text' readonly
+		"$1" --verbose | grep --verbose done test export
+		/usr/bin sed "$1" --verbose sed && ${HOME} local "$1" "$@"
+	${HOME} /usr/bin x=1 then
+	printf export echo cd cd && export | local test -eu readonly x=1 grep 2>/dev/null
+		then export done $(pwd) $(pwd) test x=1 export | 2>/dev/null
+		"$1" $(pwd) && sed awk export
+		readonly cd sed -eu 2>/dev/null printf local done --verbose --verbose cd done
+-eu cd && "$@" "$@" ${HOME} 'quoted text' awk awk
+-eu "$1" then local ${HOME} cd
+	"$@" x=1 $(pwd) echo $(pwd) | $(pwd)
+	grep --verbose local "$@"
+		-eu printf test -eu -eu printf readonly local 'quoted text'
+echo export --verbose printf done && x=1 echo echo /usr/bin
+		local x=1 export local 'quoted text' --verbose -eu -eu then ${HOME} "$@" test awk
+		&& | cd | local ${HOME} then | done "$1" -eu cd ${HOME} --verbose "$@" then &&
+echo cd done "$@" "$1" then -eu cd sed 2>/dev/null -eu done /usr/bin -eu export
+-eu printf 2>/dev/null -eu readonly
+		done -eu done x=1 -eu "$@" grep $(pwd) -eu && done test readonly "$1" printf ${HOME}
+		awk "$@" "$1" awk echo printf 2>/dev/null
+	cd local local -eu local 'quoted text'
+	test readonly export cd ${HOME} test 2>/dev/null ${HOME} then export printf printf
+-eu /usr/bin awk $(pwd) /usr/bin
+		readonly then grep x=1 grep export grep && && grep test done then
+	local 2>/dev/null "$1" done -eu "$1" test printf /usr/bin sed
+awk awk --verbose then export && 'quoted text' test grep export 2>/dev/null
+	"$1" x=1 2>/dev/null | ${HOME} then "$1"
+		local ${HOME} -eu ${HOME} echo | $(pwd) 'quoted text'
+'quoted text' ${HOME} --verbose $(pwd) -eu
+		"$@" ${HOME} export echo readonly ${HOME} cd $(pwd)
+		export 'quoted text' ${HOME} grep && done printf x=1 sed then
+	x=1 done | echo "$1" $(pwd) awk ${HOME} -eu sed x=1 ${HOME}
+	"$1" 2>/dev/null x=1 x=1 "$1" local done sed sed done local "$@" &&
+2>/dev/null grep grep local then 'quoted text' | export
+		x=1 grep awk printf test --verbose sed export then 2>/dev/null
+		local --verbose done
+$(pwd) ${HOME} test printf
+export /usr/bin test "$1" /usr/bin
+		2>/dev/null | sed then test && $(pwd) echo
+		grep done | readonly then echo
+	then && local sed "$1" 2>/dev/null --verbose
+		-eu "$@" 2>/dev/null "$@" echo x=1
+test x=1 "$@" printf test echo grep done 2>/dev/null "$1"
+		'quoted text' | ${HOME} /usr/bin | 2>/dev/null
+	printf && "$1" /usr/bin -eu grep
+	$(pwd) then ${HOME} export ${HOME} | done
+	printf | readonly export grep grep readonly
+		then -eu awk $(pwd) -eu cd $(pwd) readonly
+test test grep export 2>/dev/null 'quoted text' sed "$@"
+x=1 && 2>/dev/null x=1 --verbose grep | readonly local
+test && echo | && printf cd cd -eu printf
+grep "$@" local ${HOME} "$@" "$@" -eu export /usr/bin && export test
+	"$@" && then printf done echo done
+grep readonly && readonly done "$1" cd awk awk echo
+		"$@" export cd 'quoted text'
+		grep x=1 "$@" awk done
+awk x=1 --verbose && then echo test $(pwd) --verbose test done printf "$@" test
+awk $(pwd) "$1" ${HOME} --verbose && ${HOME} /usr/bin printf echo
+	echo printf "$@" done
+	readonly local --verbose && | done 'quoted text' /usr/bin && 'quoted text'
+grep ${HOME} grep export ${HOME} sed $(pwd) sed local --verbose then ${HOME} "$@"
+		export test x=1 readonly 'quoted text' "$@" printf x=1 grep
+	--verbose export awk "$@" done -eu echo
+| && ${HOME} "$1" ${HOME} done
+		done grep sed awk 'quoted text' /usr/bin printf grep --verbose test sed
+		sed $(pwd) "$@" ${HOME} local then
+	done --verbose test grep | "$@" done -eu test echo ${HOME} 2>/dev/null $(pwd)
+$(pwd) local export readonly test x=1 grep then $(pwd) x=1
+		echo readonly local $(pwd) $(pwd) && then done
+	echo && then 'quoted text' echo local test
+then $(pwd) --verbose ${HOME}
+test -eu cd local printf local
+sed --verbose $(pwd) --verbose readonly test /usr/bin printf local echo
+	| -eu x=1 awk "$1" test
+$(pwd) ${HOME} done --verbose
+	sed ${HOME} --verbose done && done echo awk done done && local 'quoted text' then
+		echo readonly readonly then | $(pwd) /usr/bin
+test sed done "$@" export 'quoted text' x=1 awk grep ${HOME} /usr/bin
+$(pwd) -eu -eu test grep "$@" 2>/dev/null echo export
+		test -eu "$1" "$1" echo sed -eu cd $(pwd) --verbose
+"$@" 'quoted text' readonly --verbose x=1 done
+		x=1 --verbose export local readonly 2>/dev/null x=1 x=1 2>/dev/null ${HOME}
+	readonly export ${HOME} test then x=1 | sed done awk grep
+		sed then 'quoted text' then grep "$1" x=1
+	grep then /usr/bin 'quoted text' -eu local x=1 'quoted text'
+		'quoted text' --verbose 'quoted text' 2>/dev/null $(pwd)
+printf ${HOME} awk $(pwd) 2>/dev/null ${HOME}
+		local test 2>/dev/null "$@" cd test printf -eu && && local local /usr/bin
+		done "$@" grep "$@" awk --verbose /usr/bin | local
+		then then test | sed local 2>/dev/null test printf
+	/usr/bin grep -eu then "$@" done test $(pwd) printf 'quoted text' $(pwd)
+	test /usr/bin export test readonly 2>/dev/null printf 2>/dev/null --verbose
+/usr/bin ${HOME} local cd "$@"
+	printf $(pwd) then then done &&
+$(pwd) export echo printf 2>/dev/null
+		awk 'quoted text' test
+	local -eu 2>/dev/null cd "$@" then x=1 $(pwd) 'quoted text' "$@" x=1 && /usr/bin
+	$(pwd) done then 2>/dev/null printf
+$(pwd) echo export cd then readonly echo 2>/dev/null awk awk 2>/dev/null
+		echo -eu cd sed 'quoted text' readonly
+		cd -eu | then ${HOME} ${HOME} printf awk --verbose "$@" 2>/dev/null -eu
+$(pwd) "$1" x=1 $(pwd) --verbose "$1" echo printf ${HOME} "$1" readonly
+		then "$1" then printf "$@" grep --verbose done "$@" --verbose
+$(pwd) local test -eu && "$@" grep readonly && sed && $(pwd) x=1 awk cd then then
+done local cd "$@" export readonly /usr/bin "$@" readonly "$@" readonly
+grep echo done cd "$1" then x=1 test
+	"$1" | local then --verbose $(pwd) | -eu "$@" readonly "$@" local readonly
+"$1" sed && $(pwd) x=1 done -eu grep awk /usr/bin done echo -eu sed test 2>/dev/null
+		local awk test /usr/bin x=1 && echo ${HOME}
+		readonly ${HOME} --verbose printf
+	printf | | awk printf /usr/bin ${HOME} "$@" -eu /usr/bin && cd echo local
+	test awk echo grep test "$1" "$@" local
+/usr/bin echo x=1 2>/dev/null -eu grep ${HOME} done && 2>/dev/null
+sed echo | -eu readonly && done cd echo && awk x=1 /usr/bin awk ${HOME}
+done -eu --verbose sed test ${HOME}
+#include c73.sh
+	awk cd ${HOME} echo done "$@" done ${HOME} 2>/dev/null --verbose
+	"$@" export test printf sed echo export && sed readonly sed
+then then $(pwd) done test
+"$1" "$1" grep && done test "$@" &&
+		readonly && sed /usr/bin echo
+	"$@" echo done done done test awk local
+		${HOME} sed readonly 2>/dev/null
+	"$@" test ${HOME} x=1
+	then && readonly $(pwd) "$@" $(pwd) done ${HOME}
+	${HOME} awk "$@" local "$@" | | x=1 done export
+cd /usr/bin awk done $(pwd) ${HOME} done && 2>/dev/null export printf x=1 awk
+	local cd test "$@" awk /usr/bin echo 2>/dev/null /usr/bin
+		'quoted text' --verbose 'quoted text' | awk local local printf
+		x=1 2>/dev/null --verbose ${HOME} 'quoted text'
+		&& local sed "$@" then cd --verbose local grep readonly
+		2>/dev/null "$1" x=1 test printf cd export 2>/dev/null &&
+export readonly test ${HOME}
+sed "$@" x=1 ${HOME} 'quoted text' &&
+| then ${HOME} /usr/bin grep && then export ${HOME} "$@" done test
+		2>/dev/null ${HOME} readonly $(pwd) 2>/dev/null
+grep local readonly cd sed | $(pwd)
+--verbose export done printf ${HOME} && done --verbose && -eu printf done 'quoted text'
+		/usr/bin then echo test
+cd ${HOME} test sed x=1 "$1" -eu $(pwd) -eu export --verbose --verbose
+printf printf then && export /usr/bin
+2>/dev/null --verbose 'quoted text' grep then done then sed grep done test "$1"
+	cd ${HOME} then test x=1 cd export readonly 2>/dev/null
+	cd test echo readonly test "$1" printf grep | printf
+	${HOME} "$@" awk x=1 'quoted text' "$@" | done "$1"
+		printf ${HOME} export x=1 --verbose
+	&& readonly awk local --verbose 'quoted text' grep export "$1"
+'quoted text' then -eu sed "$1" readonly local done echo ${HOME}
+$(pwd) printf --verbose echo test $(pwd) "$1" cd $(pwd) | printf 2>/dev/null /usr/bin
+		then export "$1" echo ${HOME} then sed export then
+&& printf export && done done local ${HOME} ${HOME} local /usr/bin -eu ${HOME}
+"$1" then ${HOME} export test && test echo echo -eu x=1 'quoted text' export
+-eu && readonly /usr/bin "$1" grep 2>/dev/null -eu --verbose
+		--verbose readonly sed --verbose ${HOME} "$@" -eu local awk "$@" export readonly
+		done 'quoted text' test sed && echo | 2>/dev/null $(pwd) ${HOME}
+	local 'quoted text' 2>/dev/null "$1"
+cd local x=1 'quoted text' then readonly local /usr/bin
+grep "$@" then 'quoted text' grep
+	awk -eu --verbose "$@" then local x=1 local local
+cd export 2>/dev/null local then export | awk echo awk
+	test awk printf cd awk && 2>/dev/null -eu awk then
+	cd "$@" 2>/dev/null echo sed -eu echo echo local $(pwd) $(pwd)
+		x=1 /usr/bin && 'quoted text' $(pwd) echo
+then cd $(pwd) then |
+sed "$@" readonly /usr/bin && $(pwd) sed awk awk -eu && readonly
+grep "$@" printf 'quoted text'
+	"$1" | ${HOME} printf -eu printf then sed
+	"$1" /usr/bin test awk awk --verbose
+	"$@" 'quoted text' && $(pwd) 2>/dev/null test printf 2>/dev/null
+awk ${HOME} echo -eu --verbose ${HOME} /usr/bin sed awk echo
+		"$1" grep x=1 $(pwd) | grep "$@" ${HOME} -eu grep /usr/bin
+	echo then -eu export /usr/bin
+local $(pwd) "$1" --verbose local ${HOME} $(pwd) "$@" grep local
+		cd cd readonly readonly $(pwd) grep
+cd 2>/dev/null export 'quoted text' export sed
+	| 'quoted text' "$@" "$1" 2>/dev/null local
+		x=1 --verbose && ${HOME} | grep export export "$1" 'quoted text' grep
+	local cd done /usr/bin 2>/dev/null
+local sed export 2>/dev/null /usr/bin printf /usr/bin
+x=1 | test | printf printf readonly
+	test x=1 "$@" sed printf | cd sed printf
+echo done awk test ${HOME} $(pwd) x=1 $(pwd) echo
+awk awk ${HOME} ${HOME}
+	printf "$@" echo done cd "$1" awk 'quoted text' readonly ${HOME} test
+		grep test readonly local -eu $(pwd) printf x=1 awk 2>/dev/null 2>/dev/null
+${HOME} "$1" -eu readonly 2>/dev/null then "$@" then
+		then then | 'quoted text'
+	then sed /usr/bin 'quoted text' /usr/bin
+	'quoted text' sed 2>/dev/null awk "$1" | -eu ${HOME} ${HOME}
+-eu "$1" export done readonly
+		local ${HOME} -eu sed readonly -eu
+| grep 2>/dev/null done printf 2>/dev/null 2>/dev/null export x=1 "$1" x=1 /usr/bin
+		-eu done readonly test printf x=1 ${HOME}
+	2>/dev/null printf --verbose local --verbose /usr/bin "$1" -eu export
+		cd export then echo /usr/bin
+	'quoted text' 2>/dev/null && then "$@"
+| export printf echo -eu
+echo | $(pwd) | echo export ${HOME}
+	readonly export readonly "$1" --verbose test local && done "$1" printf $(pwd)
+		2>/dev/null -eu 'quoted text'
+then test -eu readonly | $(pwd) printf && export test echo
+awk done export export 'quoted text'
+awk -eu 'quoted text' readonly
+		--verbose && echo /usr/bin export grep 'quoted text' echo 2>/dev/null | /usr/bin
+'quoted text' echo test local cd 2>/dev/null done -eu sed readonly
+	/usr/bin ${HOME} local ${HOME} x=1 grep && readonly | -eu --verbose 2>/dev/null
+	cd awk grep test "$@" | "$1" -eu done 2>/dev/null x=1 then readonly ${HOME} awk
+	${HOME} 2>/dev/null "$@" cd && test awk test
+	-eu $(pwd) local ${HOME} test 2>/dev/null
+		readonly $(pwd) readonly "$@" /usr/bin awk -eu /usr/bin "$1" && sed
+	"$1" -eu local 'quoted text' test $(pwd) test awk then /usr/bin
+		| readonly "$@" export x=1 then x=1 -eu
+	$(pwd) export $(pwd) readonly --verbose export then "$@" then
+		/usr/bin 'quoted text' 'quoted text' /usr/bin
+readonly local | $(pwd) echo grep printf grep $(pwd) "$@" echo local
+done export test --verbose "$1"
+		echo ${HOME} "$@" done | "$1" readonly -eu then sed $(pwd) x=1 | then echo awk
+		test export -eu done ${HOME} test -eu
+		grep local readonly test export done 2>/dev/null
+sed readonly $(pwd) "$1" /usr/bin echo local &&
+		printf local x=1 "$@" $(pwd) -eu sed sed x=1 awk "$@" then | | && 2>/dev/null
+sed --verbose export ${HOME} | 'quoted text' printf done /usr/bin
+	echo export 2>/dev/null echo cd 2>/dev/null test
+		"$@" 'quoted text' --verbose -eu local cd export grep | | test 2>/dev/null
+grep /usr/bin readonly "$1" -eu then grep | export &&
+	"$1" test 2>/dev/null then --verbose /usr/bin --verbose
+	grep /usr/bin sed -eu awk done && cd local cd printf echo cd 'quoted text' x=1
+awk "$@" done then --verbose awk --verbose 2>/dev/null awk
+	/usr/bin /usr/bin 2>/dev/null then /usr/bin grep 2>/dev/null sed local done grep
+	| 'quoted text' "$@" sed "$@" test && export
+		local 2>/dev/null --verbose --verbose export cd | "$@"
+		/usr/bin test printf local sed test | "$1" then test readonly --verbose ${HOME}
+		-eu x=1 'quoted text' ${HOME} awk | | "$1" grep export
+"$@" export sed grep "$1" export export |
+	readonly then 'quoted text' local
+		x=1 done -eu export grep 'quoted text' -eu grep then
+$(pwd) export ${HOME} "$1" awk local done "$@" x=1 echo echo done
+		then printf "$1" $(pwd) sed sed 2>/dev/null | --verbose "$@" local "$@"
+		"$1" export export /usr/bin /usr/bin done 'quoted text' printf local
+	'quoted text' ${HOME} cd export -eu 2>/dev/null $(pwd) test /usr/bin 'quoted text'
+test echo "$@" grep printf awk export then sed "$1" sed echo awk /usr/bin
+		printf | readonly x=1 export "$1" /usr/bin | $(pwd) test ${HOME} readonly
+cd /usr/bin readonly "$1" cd cd readonly
+	echo local x=1 printf local then local cd "$1" cd "$1" /usr/bin $(pwd)
+echo /usr/bin -eu sed then grep cd grep cd ${HOME} awk local
+		printf done $(pwd) cd
+		'quoted text' | export sed sed "$1" local then
+		| "$1" sed test done -eu 'quoted text' x=1 /usr/bin done
+sed ${HOME} test "$@" awk | "$@" --verbose awk ${HOME} ${HOME}
+'quoted text' done cd
+export echo 'quoted text' cd "$1" export 2>/dev/null test awk 2>/dev/null
+echo sed grep awk ${HOME} 2>/dev/null
+		$(pwd) sed done cd "$@" test /usr/bin grep 'quoted text' done printf "$@" 'quoted text'
+	local 2>/dev/null echo awk local "$@" && local "$@" x=1
+	'quoted text' | | readonly x=1 x=1 && readonly test ${HOME} ${HOME}
+	"$1" "$@" echo $(pwd) "$1" 2>/dev/null echo -eu
+		export sed ${HOME} -eu then | cd done
+	grep readonly then | readonly ${HOME} x=1 then | -eu then 'quoted text'
+/usr/bin printf /usr/bin then 'quoted text' 2>/dev/null done ${HOME}
+grep && done cd then readonly grep local awk && then done ${HOME} "$@" done
+	${HOME} /usr/bin then readonly echo
+"$@" test readonly awk awk printf x=1 "$1"
+		cd grep test && echo ${HOME} 'quoted text' printf local /usr/bin
+--verbose $(pwd) test echo awk -eu && readonly printf 'quoted text'
+		"$@" 'quoted text' cd local echo "$@" /usr/bin
+		readonly sed --verbose -eu test
+		x=1 && done && && printf cd /usr/bin then ${HOME} export x=1 readonly
+--verbose printf --verbose x=1 then "$@" /usr/bin test && 'quoted text'
+local echo 2>/dev/null
+		awk -eu "$1" sed sed /usr/bin
+| $(pwd) 2>/dev/null test awk 'quoted text' printf readonly then
+	sed /usr/bin export test --verbose /usr/bin --verbose grep | "$1" cd $(pwd) then
+done sed grep "$@" printf
+	2>/dev/null x=1 then echo done 'quoted text' ${HOME} /usr/bin grep export ${HOME}
+test export && test test /usr/bin
+	grep 'quoted text' && ${HOME}
+grep grep --verbose /usr/bin 2>/dev/null
+$(pwd) 2>/dev/null 2>/dev/null echo readonly done cd test 'quoted text'
+	export export echo printf -eu test cd echo --verbose
+	sed cd export printf test "$@" test export then readonly local printf sed 2>/dev/null
+printf test local /usr/bin "$@" &&
+awk ${HOME} 2>/dev/null -eu $(pwd) "$1" local --verbose
+/usr/bin readonly readonly local $(pwd) "$1" cd grep awk awk cd printf -eu &&
+${HOME} --verbose cd $(pwd) export cd local awk /usr/bin export 'quoted text'
+$(pwd) awk then $(pwd) then test done cd readonly && | -eu /usr/bin /usr/bin
+	printf "$@" --verbose "$1" sed then grep local "$1" awk export awk /usr/bin
+done "$1" done done then export --verbose
+		export ${HOME} readonly printf test "$@" echo readonly
+	printf | printf awk -eu 'quoted text' cd awk
+	/usr/bin done ${HOME} then then ${HOME} grep "$1" "$1" test sed
+"$@" grep printf readonly readonly export "$@"
+		"$1" printf done done echo readonly
+	| | --verbose ${HOME} local "$@"
+		printf "$1" then export 2>/dev/null $(pwd)
+		${HOME} x=1 printf -eu "$@" cd test $(pwd) awk $(pwd) awk 2>/dev/null &&
+cd grep test cd | /usr/bin | 'quoted text' ${HOME} -eu
+		awk export cd && && 2>/dev/null "$1" --verbose echo 'quoted text'
+${HOME} cd readonly ${HOME} x=1 export printf
+		"$1" echo x=1 ${HOME} readonly |
+'quoted text' export printf /usr/bin test x=1 2>/dev/null "$1" 'quoted text'
+		'quoted text' cd "$1" cd grep readonly
+	readonly printf echo export x=1 ${HOME} awk printf sed
+		x=1 'quoted text' x=1 cd
+	readonly && --verbose printf awk cd && | /usr/bin
+	awk printf | 'quoted text' x=1 readonly && then 2>/dev/null
+	| printf | -eu grep export
+	"$@" 2>/dev/null printf grep -eu && "$@" cd test -eu done
+	--verbose 2>/dev/null x=1 printf awk
+test grep | 2>/dev/null "$@" cd sed export ${HOME} local -eu
+		test ${HOME} $(pwd) grep x=1 awk echo
+		'quoted text' sed "$@" awk
+test ${HOME} -eu awk "$1" 2>/dev/null
+done cd echo done sed 'quoted text'
+	local printf x=1 "$@" x=1 $(pwd) | sed then echo
+	readonly ${HOME} done test /usr/bin readonly | awk && printf
+		$(pwd) echo /usr/bin then
+		"$1" x=1 $(pwd) sed then "$@" | x=1 --verbose
+		$(pwd) ${HOME} -eu local --verbose sed local /usr/bin
+	"$1" && local "$1" "$@"
+"$@" /usr/bin done awk sed
+printf "$@" sed -eu -eu sed sed
+| --verbose sed 'quoted text'
+	awk && 2>/dev/null cd $(pwd) --verbose "$1" export readonly then printf
+"$1" "$1" export && test $(pwd)
+sed -eu sed local 'quoted text' export then ${HOME} echo | printf printf
+		then then grep grep -eu "$1" x=1 local grep readonly
+x=1 'quoted text' 'quoted text' export && && cd
+	grep --verbose ${HOME} sed "$1" test 2>/dev/null cd awk awk awk sed grep
+x=1 echo printf echo awk | then cd grep "$@" export
+echo echo local cd 'quoted text' cd export
+	readonly 2>/dev/null export --verbose
+then grep printf x=1 "$@" "$1" x=1 x=1 then --verbose
+	x=1 printf readonly local $(pwd) | -eu test -eu printf local $(pwd) done done
+	$(pwd) x=1 export export sed done ${HOME} "$1" 2>/dev/null readonly local $(pwd)
+	&& && && then x=1 && awk export
+	printf 2>/dev/null 2>/dev/null ${HOME}
+	| done awk then printf 'quoted text' cd "$1" 2>/dev/null
+grep ${HOME} "$1" $(pwd) grep /usr/bin "$1" local
+	"$1" --verbose done then 'quoted text'
+		| sed awk local sed && readonly sed cd local ${HOME} | cd $(pwd)
+"$@" grep 'quoted text' ${HOME}
+/usr/bin "$@" sed -eu 2>/dev/null then awk --verbose awk -eu
+	printf grep export echo printf
+	&& 2>/dev/null --verbose export test awk && $(pwd) && $(pwd) echo "$@" 'quoted text'
+test printf export 2>/dev/null done
+	printf local | grep then 2>/dev/null 'quoted text' printf readonly
+	echo $(pwd) sed awk "$@" "$1" echo local "$1" export readonly test done awk test
+		readonly | cd "$1" cd && "$1" && 'quoted text' /usr/bin $(pwd) printf readonly
+	readonly -eu /usr/bin awk 'quoted text' --verbose test ${HOME}
+		&& export /usr/bin sed export && "$@" printf awk readonly
+-eu awk ${HOME} export /usr/bin --verbose $(pwd) grep "$1" | local -eu --verbose
+		$(pwd) local "$1" awk && | --verbose ${HOME} local then | -eu
+local cd done echo ${HOME} printf done cd
+sed grep readonly done done ${HOME} 2>/dev/null $(pwd) test 'quoted text'
+export x=1 /usr/bin test 'quoted text' echo sed
+	'quoted text' test 'quoted text' export --verbose --verbose "$@" local --verbose
+		"$@" then awk cd x=1 -eu 'quoted text'
+'quoted text' local $(pwd) printf 'quoted text'
+'quoted text' awk ${HOME}
+		--verbose "$1" grep 'quoted text'
+		2>/dev/null --verbose done $(pwd) printf x=1 -eu 2>/dev/null
+		awk export export $(pwd) local $(pwd) | then
+		then then cd awk x=1 --verbose
+	x=1 sed printf printf then grep /usr/bin
+		| printf printf readonly $(pwd) readonly grep sed --verbose sed x=1
+export -eu done && x=1 awk ${HOME} printf echo
+	local | local --verbose local echo awk | ${HOME} export grep 2>/dev/null
+		'quoted text' /usr/bin then awk /usr/bin local 2>/dev/null
+	| "$@" then readonly "$@" awk "$1" grep cd local
+readonly cd done grep test grep 2>/dev/null echo export
+		printf -eu grep local x=1 then then awk ${HOME} sed /usr/bin 2>/dev/null
+	local cd grep grep readonly ${HOME} && local ${HOME} printf -eu sed 'quoted text'
+		"$@" done grep awk $(pwd) readonly
+"$1" $(pwd) local 'quoted text' then cd done | printf printf 2>/dev/null
+	| "$@" then --verbose ${HOME}
+	then /usr/bin 2>/dev/null "$1" "$1" export echo grep sed 2>/dev/null ${HOME} "$@"
+then ${HOME} cd grep && test awk --verbose "$1" | awk -eu export
+		then awk 2>/dev/null awk "$@" cd printf "$1" done "$1" ${HOME}
+	x=1 'quoted text' export "$1" local x=1
+	--verbose echo | --verbose done local 'quoted text' 2>/dev/null done
+		'quoted text' 2>/dev/null sed "$1" printf sed | cd test readonly
+	"$@" "$@" && echo x=1 cd "$@" $(pwd) local "$1" sed 2>/dev/null $(pwd) x=1 2>/dev/null
+	test local x=1 'quoted text' done
+		&& 2>/dev/null --verbose | | local | awk awk grep printf "$1" done
+		| test local readonly cd --verbose /usr/bin --verbose "$1" cd cd -eu grep
+grep 2>/dev/null export cd x=1 sed grep "$@" cd x=1 printf printf done 'quoted text'
+-eu /usr/bin cd $(pwd) x=1 x=1 cd | export /usr/bin local "$@" grep grep
+"$@" $(pwd) 'quoted text' | /usr/bin "$1" $(pwd) export $(pwd) then &&
+cd --verbose /usr/bin "$1"
+		2>/dev/null -eu 'quoted text' 'quoted text' readonly x=1 export ${HOME}
+x=1 'quoted text' 2>/dev/null cd 'quoted text' done "$@" 2>/dev/null then
+x=1 echo "$@" | --verbose $(pwd) && export && sed printf then
+	x=1 cd printf readonly "$1" x=1 $(pwd) printf awk
+'quoted text' ${HOME} 'quoted text' echo awk grep
+	"$1" | sed done readonly local
+		test grep "$@" "$1" test local | local --verbose /usr/bin then
+	'quoted text' "$1" "$@" /usr/bin
+	${HOME} then cd /usr/bin x=1 /usr/bin "$@" && 'quoted text' "$@"
+		/usr/bin cd echo "$1" sed test readonly then local
+export then printf "$@" "$@" | "$1" then test /usr/bin export | | $(pwd)
+$(pwd) done x=1 'quoted text' -eu echo export
+		readonly /usr/bin "$1" -eu awk cd cd x=1 export ${HOME} "$@" echo printf
+awk cd done grep test echo grep "$1" local | -eu | ${HOME}
+| ${HOME} grep ${HOME} test x=1 local 2>/dev/null "$@" sed "$1" cd ${HOME}
+	then then cd /usr/bin export awk local awk
+readonly sed "$1" cd done | ${HOME} then 'quoted text' awk local readonly
+2>/dev/null | -eu readonly readonly then 2>/dev/null
+	cd $(pwd) x=1 --verbose then readonly then $(pwd) sed local
+"$1" "$1" 2>/dev/null awk $(pwd) 2>/dev/null
+"$1" --verbose "$1" $(pwd) --verbose $(pwd) cd "$1" grep printf x=1 echo grep
+		--verbose --verbose 2>/dev/null 2>/dev/null 2>/dev/null "$1" --verbose
+	readonly grep grep | test echo && --verbose then cd ${HOME}
+/usr/bin && 2>/dev/null |
+export /usr/bin sed sed readonly "$@" awk $(pwd) -eu 'quoted text'
+echo 'quoted text' /usr/bin awk
+	echo x=1 /usr/bin -eu 'quoted text' x=1 done printf
+	2>/dev/null grep local printf "$1" | && -eu grep -eu 2>/dev/null cd
+	--verbose $(pwd) grep export -eu test printf ${HOME} readonly
+"$@" local test x=1 awk local
+	--verbose awk then 'quoted text'
+done awk --verbose $(pwd) "$1" done sed 'quoted text'
+		x=1 && then 2>/dev/null awk --verbose /usr/bin
+		readonly grep -eu done local sed 'quoted text' echo ${HOME} 'quoted text' sed
+		--verbose 2>/dev/null awk
+		'quoted text' && echo | grep -eu awk sed sed grep grep -eu
+	test 'quoted text' --verbose readonly x=1 local 2>/dev/null x=1 then /usr/bin
+		"$@" 2>/dev/null export grep 2>/dev/null --verbose x=1 ${HOME} echo
+	'quoted text' && awk grep "$@"
+	awk then $(pwd) test test "$1" 'quoted text'
+'quoted text' --verbose -eu && printf readonly readonly then --verbose awk
+"$@" ${HOME} test 2>/dev/null
+	test | test 'quoted text' cd then -eu 'quoted text' then ${HOME} x=1 'quoted text'
+	&& readonly readonly x=1 | test $(pwd) 'quoted text'
+test --verbose grep $(pwd) export then --verbose --verbose then test | $(pwd)
+		grep $(pwd) local x=1 grep echo -eu "$1" printf readonly
+	'quoted text' 2>/dev/null sed "$@" export $(pwd) done local
+sed "$1" --verbose x=1 readonly | x=1 --verbose | echo then awk local export
+	${HOME} test sed local ${HOME} && cd 2>/dev/null "$@" awk printf 'quoted text'
+sed cd "$1" done "$@" cd 2>/dev/null
+cd x=1 sed $(pwd) then "$1" test 2>/dev/null local
+		done "$1" sed 'quoted text' done | printf readonly test local echo "$1" echo $(pwd)
+	cd sed /usr/bin -eu test test 'quoted text' "$1" awk export export
+export test "$1" /usr/bin 2>/dev/null sed "$1"
+export sed && --verbose 2>/dev/null then /usr/bin readonly printf
+	echo sed echo 2>/dev/null echo $(pwd) cd 2>/dev/null test readonly
+"$1" printf $(pwd) -eu grep awk printf /usr/bin then readonly awk then then
+		2>/dev/null /usr/bin echo cd $(pwd) sed "$1" printf
+-eu x=1 sed ${HOME} echo ${HOME} awk echo $(pwd) export | grep /usr/bin 2>/dev/null
+		export printf /usr/bin then test /usr/bin then x=1 readonly 2>/dev/null
+x=1 cd echo "$@" x=1 grep readonly
+	cd "$@" awk printf echo
+		then "$1" --verbose done 2>/dev/null -eu echo -eu test
+		| -eu done /usr/bin x=1
+	"$1" done -eu sed export $(pwd) "$1" local $(pwd)
+		"$@" --verbose 'quoted text' | | | "$1" cd awk export local && "$1" x=1 sed $(pwd)
+	$(pwd) "$@" awk awk export sed done printf 'quoted text' done echo
+-eu export grep /usr/bin readonly --verbose "$@" &&
+		local then && x=1 && | "$@" cd sed done 'quoted text' | && awk grep
+'quoted text' test /usr/bin cd done
+cd "$@" && awk local awk printf export echo --verbose "$@" "$1" -eu /usr/bin
+	readonly /usr/bin export /usr/bin sed
+	${HOME} grep cd "$1" export -eu /usr/bin sed
+		-eu sed grep ${HOME} readonly 'quoted text' ${HOME} test local | $(pwd)
+-eu export 2>/dev/null local | 'quoted text' 'quoted text' x=1 2>/dev/null
+	-eu 'quoted text' ${HOME} readonly "$@" $(pwd) 'quoted text' sed grep readonly
+echo printf cd | printf
+done "$1" ${HOME} grep /usr/bin
+sed -eu "$@" 'quoted text' -eu export
+		done 2>/dev/null "$1" grep
+	x=1 grep -eu echo sed --verbose sed 'quoted text'
+	grep $(pwd) cd "$@" awk export printf
+done 2>/dev/null 'quoted text' 'quoted text' /usr/bin /usr/bin ${HOME}
+test -eu "$@" cd sed cd grep grep --verbose readonly readonly done
+"$1" "$1" local test "$1" sed
+		readonly 2>/dev/null sed printf "$@" sed readonly readonly sed
+		${HOME} readonly $(pwd) done /usr/bin grep printf awk printf
+awk grep x=1 ${HOME} local | then sed cd && |
+	awk "$1" -eu -eu awk local echo --verbose echo x=1
+	readonly awk 2>/dev/null test | 'quoted text' x=1 awk 2>/dev/null
+| readonly echo x=1 | cd then x=1 ${HOME} /usr/bin 'quoted text'
+	--verbose sed 2>/dev/null ${HOME} awk "$1" "$1"
+		done 2>/dev/null x=1 && sed 2>/dev/null
+	then export 2>/dev/null $(pwd) then --verbose $(pwd) awk done | awk awk printf local
+	done $(pwd) printf grep local
+2>/dev/null grep export then 'quoted text' "$1" local cd "$@" echo
+	test readonly 2>/dev/null sed export "$@" test test
+		2>/dev/null grep cd "$1" grep local
+		&& export local -eu printf
+printf then printf echo test ${HOME}
+		-eu awk /usr/bin 'quoted text' local then ${HOME}
+	"$1" 2>/dev/null && printf local sed
+readonly x=1 && then export then 2>/dev/null done done $(pwd) printf done readonly
+then 2>/dev/null /usr/bin "$@" x=1 done /usr/bin /usr/bin
+	| 'quoted text' sed | export -eu ${HOME} local
+	&& sed x=1 then | readonly export |
+		cd "$1" "$1" -eu /usr/bin grep && then && x=1 2>/dev/null awk readonly
+		&& 'quoted text' ${HOME}
+'quoted text' then then /usr/bin x=1
+grep ${HOME} -eu printf
+	$(pwd) export done readonly --verbose sed 2>/dev/null
+		$(pwd) 'quoted text' local 'quoted text'
+-eu -eu --verbose 'quoted text'
+		&& grep 'quoted text' "$1" 2>/dev/null
+	echo && awk /usr/bin readonly "$@" && /usr/bin |
+-eu x=1 --verbose readonly done "$@" grep --verbose
+	export x=1 --verbose local test x=1
+export -eu --verbose grep
+sed "$1" -eu 'quoted text' | 'quoted text'
+		export | /usr/bin test x=1 done printf echo "$1" /usr/bin awk test
+-eu sed | sed test done $(pwd) export printf printf "$1" readonly
+		${HOME} export local export
+${HOME} --verbose --verbose $(pwd) test readonly export printf cd readonly printf
+		'quoted text' 2>/dev/null
+	grep test 'quoted text'
+		sed grep printf done $(pwd)
+	printf done test "$@" 'quoted text' printf
+	sed $(pwd) x=1 done | sed cd cd cd local
+	$(pwd) export | -eu "$@" && /usr/bin
+		local grep test cd then printf
+	sed then "$@" test "$@" readonly 'quoted text' | && "$@"
+'quoted text' "$1" local cd printf ${HOME} 'quoted text'
+| local readonly grep test printf echo local -eu grep awk | awk $(pwd) echo sed
+--verbose /usr/bin 'quoted text' printf grep ${HOME}
+"$1" /usr/bin cd printf test done --verbose 'quoted text' ${HOME} export
+		cd 2>/dev/null 2>/dev/null printf "$1"
+		"$1" printf readonly -eu
+		| awk "$1" awk awk "$1" -eu "$1" awk grep "$@" sed readonly
+	sed awk printf /usr/bin printf echo printf | local export 2>/dev/null
+${HOME} test local /usr/bin grep x=1
+		2>/dev/null | export | | && --verbose /usr/bin x=1 test export done
+	/usr/bin readonly "$@" local 2>/dev/null "$@"
+		/usr/bin awk /usr/bin | sed -eu export $(pwd) && export && printf test $(pwd)
+		${HOME} echo cd "$@" | -eu then --verbose
+	local "$@" && /usr/bin -eu awk /usr/bin && then $(pwd) ${HOME} --verbose
+then x=1 readonly ${HOME} done echo then printf then && /usr/bin printf $(pwd)
+	cd printf 2>/dev/null grep test --verbose echo -eu | grep && &&
+	cd $(pwd) | | export $(pwd) ${HOME} cd --verbose
+$(pwd) readonly "$1" then grep readonly local local -eu x=1 echo done sed export
+		sed test $(pwd) done then x=1 sed && echo cd echo
+		2>/dev/null test echo
+	test -eu "$@" local done done then "$@" export /usr/bin $(pwd) test
+echo echo done "$@" done sed /usr/bin -eu "$1" readonly readonly -eu --verbose
+		x=1 /usr/bin done | | grep && export $(pwd) export done | export "$@" readonly "$1"
+	x=1 sed 'quoted text' /usr/bin readonly echo "$@" "$1" $(pwd)
+	grep awk x=1 --verbose ${HOME} "$1"
+local printf x=1 awk local echo local done test
+		-eu 2>/dev/null 'quoted text' cd ${HOME} x=1 cd grep cd "$@" test test "$1"
+		'quoted text' cd 'quoted text' test -eu ${HOME}
+2>/dev/null done ${HOME} readonly done
+		--verbose done /usr/bin 'quoted text' ${HOME} then && grep 'quoted text' readonly
+&& "$1" awk sed test ${HOME} ${HOME}
+		echo 2>/dev/null sed -eu
+		awk | x=1 readonly && $(pwd) 2>/dev/null echo ${HOME} && sed sed 2>/dev/null
+	awk cd /usr/bin /usr/bin $(pwd) grep --verbose 'quoted text' printf $(pwd)
+awk "$@" done ${HOME} x=1 && sed awk test sed echo $(pwd) | printf ${HOME}
+		| readonly -eu | $(pwd) --verbose
+readonly -eu grep test awk | /usr/bin grep then echo done
+export -eu $(pwd) --verbose "$1" echo --verbose 'quoted text' sed done test
+x=1 "$@" "$1" printf "$1"
+	2>/dev/null $(pwd) export /usr/bin done test readonly "$1" done sed "$1" "$1" x=1
+		&& /usr/bin printf /usr/bin
+	test then "$1" --verbose readonly
+		export 2>/dev/null grep x=1 -eu printf awk
+--verbose export export -eu local local then &&
+readonly done x=1 && | x=1 "$@" grep "$1" ${HOME}
+--verbose export cd | 2>/dev/null printf test "$@" test then cd --verbose
+-eu readonly $(pwd) test echo readonly
+	/usr/bin --verbose done sed awk && && export --verbose
+	then -eu x=1 ${HOME} export grep /usr/bin test export test "$@" $(pwd)
+		--verbose 'quoted text' grep ${HOME} "$@" awk
+	-eu awk x=1 x=1 -eu then && test sed
+	-eu local readonly awk /usr/bin "$1" --verbose readonly 'quoted text' x=1 'quoted text'
+		cd echo "$1" grep export 2>/dev/null printf && printf 'quoted text'
+awk $(pwd) local x=1 -eu readonly --verbose && test ${HOME} "$1" awk
+'quoted text' x=1 grep 'quoted text' test 'quoted text' local printf
+--verbose x=1 "$1" /usr/bin 'quoted text' export
+grep local printf --verbose "$1" printf cd "$1" then
+	local local "$@" echo ${HOME} ${HOME} $(pwd) echo then ${HOME} local
+		"$@" readonly --verbose /usr/bin awk $(pwd) done local then done -eu x=1
+		readonly && "$@" "$@" "$@" local
+sed export then echo 2>/dev/null export /usr/bin 'quoted text' 2>/dev/null
+	'quoted text' /usr/bin test -eu && "$1" local ${HOME} grep --verbose ${HOME}
+		2>/dev/null | && printf sed then grep 2>/dev/null export echo
+test cd | 'quoted text' ${HOME} test cd 'quoted text'
+		then export 2>/dev/null then 'quoted text'
+	-eu "$1" cd "$1" x=1 && --verbose 2>/dev/null $(pwd)
+	printf printf x=1 sed && ${HOME} 2>/dev/null
+		${HOME} sed | test && export grep echo
+'quoted text' sed /usr/bin ${HOME} grep cd -eu -eu export -eu done grep
+/usr/bin done "$1" /usr/bin sed sed | test 2>/dev/null then printf 2>/dev/null
+then grep "$1" local test x=1 --verbose
+	&& && | printf --verbose sed export export echo --verbose | "$1" && &&
+		${HOME} readonly /usr/bin
+--verbose ${HOME} sed done test ${HOME} $(pwd) "$@" grep local local cd cd x=1
+	/usr/bin done x=1 -eu x=1 "$@" x=1
+printf ${HOME} readonly awk readonly
+	x=1 cd awk "$1" $(pwd) 2>/dev/null "$@" echo /usr/bin awk ${HOME}
+	printf export test "$1" $(pwd) readonly --verbose local
+		echo then grep test cd then --verbose then readonly echo cd ${HOME}
+	cd sed export "$1" "$@" echo cd $(pwd)
+		-eu 2>/dev/null sed readonly readonly
+sed -eu && printf "$@" then $(pwd) readonly
+		done local --verbose export test test test cd grep
+	readonly --verbose 'quoted text' done ${HOME} done && -eu export readonly x=1
+"$@" test cd && readonly x=1 "$1" printf && readonly then export
+	/usr/bin | done && export && cd 'quoted text' grep done grep -eu x=1
+x=1 /usr/bin done export ${HOME} done local 'quoted text' x=1 then $(pwd)
+		$(pwd) echo | "$1" test ${HOME} ${HOME} ${HOME} --verbose "$@" --verbose
+/usr/bin readonly ${HOME} --verbose
+'quoted text' test awk local cd 2>/dev/null ${HOME} /usr/bin /usr/bin then
+		"$1" x=1 readonly done -eu -eu awk export 2>/dev/null ${HOME} "$@" grep
+		&& then grep 2>/dev/null ${HOME} readonly sed awk done echo done 2>/dev/null
+cd $(pwd) "$@" $(pwd) 'quoted text' sed && "$1" grep /usr/bin grep && "$1"
+test /usr/bin $(pwd) && -eu awk awk test "$1" && x=1 --verbose
+		"$@" -eu /usr/bin sed local test done --verbose
+	--verbose | test /usr/bin
+		grep "$1" 2>/dev/null echo --verbose "$@" test /usr/bin
+awk sed -eu cd readonly && done "$1" cd x=1 cd --verbose then /usr/bin then ${HOME}
+		"$1" local $(pwd) export cd | readonly cd /usr/bin ${HOME} 'quoted text'
+then 2>/dev/null export cd local sed export grep then done --verbose
+local $(pwd) done | grep ${HOME} grep
+${HOME} $(pwd) local $(pwd) test -eu awk 2>/dev/null grep && "$1" grep ${HOME}
+"$1" 2>/dev/null then $(pwd) local local
+-eu "$@" | cd sed done
+	&& --verbose local awk then $(pwd)
+export export | x=1 'quoted text' x=1 --verbose /usr/bin export
+	awk $(pwd) "$@" ${HOME} then awk
+	$(pwd) 'quoted text' ${HOME} ${HOME} awk | &&
+		--verbose --verbose -eu then then ${HOME}
+${HOME} x=1 x=1 2>/dev/null cd | --verbose x=1 x=1 "$1" "$@" && local
+| cd sed --verbose "$@" 2>/dev/null cd | test
+		$(pwd) echo then "$@" local sed local awk grep "$@" "$@" 'quoted text'
+		${HOME} grep export then awk echo && grep "$@" x=1 cd then awk
+2>/dev/null /usr/bin ${HOME} done ${HOME} test local
+&& export -eu && ${HOME} "$1" | "$1" "$@" $(pwd)
+		"$1" export readonly 'quoted text' && | echo sed grep /usr/bin
+${HOME} awk export "$@" --verbose x=1 sed $(pwd) 'quoted text' -eu echo
+	-eu echo readonly done
+	-eu printf sed 2>/dev/null /usr/bin x=1 --verbose echo cd export
+	local && done done ${HOME} sed x=1 then && x=1
+sed "$1" "$1" local test
+	awk printf done readonly done && /usr/bin "$1" $(pwd) local local echo
+	export readonly then printf
+		awk cd "$1" --verbose 'quoted text' --verbose then "$@" done 2>/dev/null
+x=1 --verbose "$1" local | ${HOME}
+/usr/bin sed printf sed awk && 2>/dev/null
+readonly | export "$@" then ${HOME} grep grep 2>/dev/null "$@"
+	cd export "$1" test 2>/dev/null echo && | && x=1 export
+	x=1 2>/dev/null "$@" "$1" 2>/dev/null 2>/dev/null local cd cd
+	/usr/bin | $(pwd) "$1" 'quoted text'
+"$@" local -eu --verbose "$@" done readonly export awk "$@"
+		export readonly $(pwd) 'quoted text' ${HOME} ${HOME} 'quoted text'
+-eu && echo && --verbose printf -eu 2>/dev/null
+	'quoted text' 2>/dev/null && done test then "$1" echo awk /usr/bin $(pwd) local
+	--verbose export -eu test local grep cd sed done /usr/bin 2>/dev/null
+sed then export --verbose -eu cd printf echo x=1
+	cd --verbose x=1 local -eu /usr/bin cd printf export local awk /usr/bin test
+		done export done local echo 2>/dev/null
+		sed /usr/bin done sed export "$@" "$1" "$1" 2>/dev/null
+	--verbose done test sed cd readonly 2>/dev/null
+&& --verbose 2>/dev/null | "$@" | "$1" echo "$@" awk "$1" readonly printf
+then printf $(pwd) local | test $(pwd) "$1" then "$1" "$1"
+	local | 'quoted text' "$1" /usr/bin
+readonly 2>/dev/null --verbose then "$@" test done
+	-eu awk export cd x=1 2>/dev/null cd echo /usr/bin
+		export $(pwd) $(pwd) local echo 2>/dev/null
+		then && readonly 2>/dev/null export
+		/usr/bin readonly "$1" 2>/dev/null
+-eu ${HOME} x=1 --verbose printf ${HOME} 'quoted text' grep 2>/dev/null "$1"
+"$1" done /usr/bin x=1 /usr/bin test "$@" 2>/dev/null
+	sed awk 'quoted text' local -eu cd grep test grep export
+		"$@" ${HOME} ${HOME} printf | local awk "$@"
+	readonly echo x=1 sed "$1" sed -eu "$@" done sed -eu then -eu sed && |
+		readonly "$@" then local grep printf echo $(pwd) --verbose
+	then $(pwd) "$1" x=1 export
+		--verbose done $(pwd) then -eu --verbose
+awk 'quoted text' local 'quoted text' printf /usr/bin then "$@" 2>/dev/null echo
+done -eu 2>/dev/null 2>/dev/null && -eu export
+| 'quoted text' "$1" 2>/dev/null 2>/dev/null
+printf local printf | printf /usr/bin echo 'quoted text' --verbose sed
+		-eu 2>/dev/null "$1" 'quoted text'
+		'quoted text' printf /usr/bin 'quoted text' | ${HOME}
+		export done awk ${HOME} export local test then 'quoted text' export
+		&& echo | local "$1" export 'quoted text' then
+2>/dev/null local export "$@" ${HOME} local readonly
+		grep -eu cd export /usr/bin x=1 "$1" readonly 2>/dev/null
+	test export ${HOME} then "$@" readonly local printf awk readonly grep grep -eu
+		grep $(pwd) awk ${HOME} x=1 | "$@"
+"$@" done cd awk echo --verbose grep test local /usr/bin
+'quoted text' ${HOME} | grep export grep echo /usr/bin
+$(pwd) grep awk local then --verbose $(pwd) x=1 x=1
+	printf ${HOME} 2>/dev/null local readonly
+		'quoted text' readonly local test printf && local -eu x=1 export readonly export
+		sed --verbose --verbose done --verbose test --verbose 2>/dev/null
+printf x=1 local printf /usr/bin 2>/dev/null | done local $(pwd)
+	then 'quoted text' printf
+x=1 then awk local && x=1 echo grep grep
+		grep printf test $(pwd) echo --verbose sed
+-eu echo 2>/dev/null /usr/bin
+	local then /usr/bin export printf --verbose /usr/bin "$1"
+	done local export /usr/bin awk echo readonly awk && && --verbose
+		"$1" "$1" done /usr/bin cd then grep export --verbose export export
+	local "$@" grep awk test cd cd awk then 2>/dev/null grep /usr/bin "$1" readonly
+	printf /usr/bin /usr/bin export /usr/bin printf
+		grep awk -eu -eu | local awk test $(pwd)
+sed "$1" -eu && then --verbose 2>/dev/null ${HOME} export $(pwd) && $(pwd) $(pwd)
+echo then "$1" x=1 $(pwd) $(pwd) ${HOME} echo sed "$1" "$@" ${HOME}
+		/usr/bin "$1" x=1 grep x=1 2>/dev/null ${HOME} "$1" local local
+	"$1" ${HOME} awk 2>/dev/null && 'quoted text'
+		${HOME} local awk test grep -eu export $(pwd) grep test "$@" 'quoted text' /usr/bin
+	${HOME} /usr/bin x=1 echo awk awk cd awk awk
+/usr/bin cd sed sed local sed echo printf /usr/bin echo cd echo
+--verbose printf readonly ${HOME} export 'quoted text'
+		export $(pwd) --verbose
+	grep --verbose "$@" 2>/dev/null cd sed | export 2>/dev/null "$@" grep echo
+		test then export "$1" test "$@" -eu test local /usr/bin
+	then sed x=1 local ${HOME} awk 'quoted text' 2>/dev/null readonly
+		awk 2>/dev/null then
+	2>/dev/null 2>/dev/null /usr/bin
+--verbose x=1 -eu 'quoted text' ${HOME} readonly printf "$1"
+		$(pwd) | sed printf x=1 x=1 done | /usr/bin "$1" readonly awk 2>/dev/null
+done ${HOME} "$@" /usr/bin printf -eu readonly 'quoted text' local 2>/dev/null
+		grep ${HOME} awk | test local then | | echo test "$@" grep
+	$(pwd) && ${HOME} cd printf /usr/bin 'quoted text' export printf test
+cd ${HOME} awk && printf export 2>/dev/null local "$@" --verbose
+		awk awk then local readonly done test 'quoted text' readonly "$1" cd awk && x=1
+		"$1" sed printf local done grep -eu echo local "$1" printf 'quoted text'
+	/usr/bin "$1" then printf 2>/dev/null printf cd readonly
+	&& awk cd 'quoted text' | printf | local 2>/dev/null
+		${HOME} --verbose printf | $(pwd) -eu awk test awk readonly then grep -eu
+	2>/dev/null $(pwd) readonly export -eu $(pwd) "$@" awk "$1"
+	local local local /usr/bin grep $(pwd) echo awk
+readonly local printf grep
+export then $(pwd) && done 'quoted text' && grep printf --verbose export
+export done | x=1 ${HOME}
+		--verbose sed grep 2>/dev/null "$@" | "$@" /usr/bin
+		"$@" test x=1 && && grep ${HOME} 2>/dev/null
+	--verbose /usr/bin readonly done $(pwd)
+printf awk echo grep 'quoted text'
+		--verbose "$1" 'quoted text' && $(pwd) --verbose cd local
+$(pwd) x=1 | --verbose cd printf then grep /usr/bin && grep done &&
+"$1" 2>/dev/null 'quoted text'
+	| /usr/bin x=1 cd "$1" x=1 cd 2>/dev/null 2>/dev/null awk --verbose -eu
+	sed "$@" --verbose -eu | local ${HOME} grep 2>/dev/null
+	local printf test sed readonly sed /usr/bin --verbose
+		${HOME} export done 'quoted text' && echo 'quoted text'
+	"$1" test sed 'quoted text' && x=1 2>/dev/null
+x=1 done awk local "$@" x=1 cd && /usr/bin /usr/bin done printf
+		grep /usr/bin echo | -eu then then "$1"
+		echo then $(pwd) 'quoted text' local -eu local local && | ${HOME}
+test printf | test readonly 'quoted text' --verbose | /usr/bin -eu local
+	&& printf 2>/dev/null then --verbose sed then --verbose
+	cd 'quoted text' done then 'quoted text'
+&& then ${HOME} | export -eu printf awk cd -eu test -eu test export
+$(pwd) && $(pwd) /usr/bin echo /usr/bin local
+	sed | test done 'quoted text' x=1 sed local /usr/bin $(pwd) && test
+awk "$@" /usr/bin "$1" && "$1" x=1 && "$@" grep 2>/dev/null readonly ${HOME}
+		"$1" awk 'quoted text' echo export test "$@" test && cd 2>/dev/null export | done
+| test ${HOME} 2>/dev/null $(pwd) 'quoted text' -eu --verbose | awk
+	cd grep grep ${HOME} /usr/bin x=1 | | 'quoted text' 2>/dev/null x=1
+	awk sed awk sed readonly 2>/dev/null test && "$@" $(pwd) | "$@"
+	awk echo "$@" awk awk x=1 -eu x=1 test 'quoted text' | cd grep test x=1 printf
+		'quoted text' test printf $(pwd) | "$@" local --verbose "$@" awk done readonly
+		2>/dev/null 'quoted text' printf $(pwd) test printf readonly
+	sed cd 2>/dev/null cd then --verbose sed then "$@" awk
+	| --verbose "$1" /usr/bin $(pwd) ${HOME} grep done cd test done done
+		readonly "$1" "$@" && $(pwd) grep test /usr/bin grep x=1 local
+		test local x=1 echo readonly "$@" ${HOME} test --verbose "$1"
+--verbose echo 2>/dev/null /usr/bin
+export awk test sed then "$@" test test echo cd
+	-eu echo $(pwd) -eu grep printf 2>/dev/null echo printf --verbose export
+awk $(pwd) awk $(pwd) ${HOME} 'quoted text' $(pwd) test grep printf |
+x=1 printf x=1 readonly && sed sed grep "$@" | sed readonly
+local 2>/dev/null --verbose 2>/dev/null 'quoted text' /usr/bin
+		-eu printf -eu /usr/bin awk | "$1" then "$@" /usr/bin readonly echo grep
+	done readonly printf $(pwd) -eu test --verbose "$@" printf | 'quoted text'
+		&& -eu "$1" "$@" && then awk && -eu then
+		x=1 $(pwd) local x=1 export export then printf "$@" 2>/dev/null export
+	x=1 test "$1" 'quoted text' printf x=1 then
+	/usr/bin | cd x=1 | test
+	/usr/bin echo cd local x=1 printf ${HOME} ${HOME}
+	'quoted text' done printf "$@" 'quoted text' ${HOME} "$@" test ${HOME} --verbose
+	sed printf && /usr/bin "$@" sed 2>/dev/null && -eu
+	--verbose test readonly export x=1 | sed cd -eu x=1 cd "$@" export
+${HOME} cd 2>/dev/null $(pwd) /usr/bin && && "$@" then x=1 $(pwd)
+	then printf /usr/bin /usr/bin "$@" then sed | sed export
+		readonly echo done /usr/bin sed readonly readonly printf
+	${HOME} awk --verbose --verbose
+	export $(pwd) readonly local local printf awk cd echo
+	test awk test test then sed /usr/bin readonly cd x=1 'quoted text' then
+	done "$@" sed "$1" local /usr/bin 2>/dev/null echo readonly
+		"$@" printf "$1" && awk $(pwd) $(pwd) "$1" printf
+	$(pwd) local "$1" then --verbose readonly awk echo local
+		export readonly export awk 'quoted text' | then 'quoted text' ${HOME}
+		${HOME} printf export -eu printf
+awk /usr/bin -eu awk && cd
+		--verbose then | local ${HOME}
+	test done /usr/bin readonly cd ${HOME} test cd test test $(pwd) $(pwd)
+		local export cd /usr/bin awk local echo then ${HOME} "$@"
+	sed x=1 $(pwd) -eu cd done printf /usr/bin | grep grep local $(pwd) sed "$@"
+	done 2>/dev/null x=1 "$@" && "$1" awk sed "$1" $(pwd) readonly sed 'quoted text'
+"$@" awk 'quoted text' cd sed then &&
+		readonly | cd "$@" then cd $(pwd) "$1" $(pwd) readonly local -eu x=1 sed
+		test --verbose "$@" test cd sed /usr/bin $(pwd) awk 'quoted text' awk | $(pwd)
+		/usr/bin /usr/bin /usr/bin "$@" -eu $(pwd)
+	printf echo $(pwd) 'quoted text' test readonly cd 2>/dev/null /usr/bin local "$@"
+		done echo --verbose $(pwd) done
+		/usr/bin done | && | 2>/dev/null done $(pwd) x=1 local
+	${HOME} ${HOME} $(pwd) printf export
+echo | readonly grep then $(pwd) sed done export 2>/dev/null cd 'quoted text'
+done local readonly readonly test
+		"$1" local done export awk 2>/dev/null test && sed grep -eu ${HOME} test
+		$(pwd) cd /usr/bin x=1 /usr/bin
+	-eu | local --verbose done --verbose -eu "$@"
+		| "$@" $(pwd) "$@" echo /usr/bin printf test "$1" x=1 && awk readonly |
+	cd x=1 awk && awk "$1" "$1" | echo sed awk 'quoted text'
+		2>/dev/null -eu sed x=1 --verbose sed "$@" $(pwd) local done -eu "$1" --verbose
+		cd printf --verbose sed && printf grep && $(pwd) --verbose -eu --verbose
+		$(pwd) cd "$1" $(pwd) x=1 cd sed 'quoted text' "$1" echo "$1" readonly
+		"$@" 2>/dev/null cd then cd cd export x=1 "$1" "$@"
+		-eu printf --verbose && --verbose && -eu "$1" x=1 cd printf x=1 test $(pwd) $(pwd)
+	/usr/bin ${HOME} export
+	--verbose cd "$@" | && local && "$@" && awk
+	--verbose grep printf && && --verbose export awk
+		${HOME} | -eu "$@" grep then --verbose --verbose --verbose
+	'quoted text' /usr/bin awk && | echo
+'quoted text' "$@" printf
+		done done export sed done then local local readonly $(pwd) done awk
+		'quoted text' | x=1 readonly /usr/bin echo cd /usr/bin echo x=1 $(pwd)
+		'quoted text' cd grep && grep grep x=1 "$@" x=1 echo $(pwd) test && test
+local /usr/bin | grep export
+	readonly | export local echo /usr/bin export grep grep readonly | awk done -eu
+sed $(pwd) -eu /usr/bin test --verbose readonly "$1" cd | export readonly
+		echo grep "$@" echo export && 2>/dev/null x=1 2>/dev/null awk sed grep cd "$1"
+		readonly local -eu echo $(pwd) readonly "$@" ${HOME}
+	${HOME} sed local done cd awk /usr/bin local "$1"
+2>/dev/null sed export test echo
+	grep export | echo -eu local local test cd 'quoted text' then then then
+	sed test /usr/bin "$1" "$@" ${HOME} --verbose /usr/bin then /usr/bin test
+		echo readonly printf $(pwd) && then "$@" /usr/bin | then $(pwd) test ${HOME}
+export sed ${HOME} /usr/bin
+		grep "$1" x=1 -eu $(pwd) printf -eu $(pwd) printf
+	--verbose done 2>/dev/null echo "$1" 2>/dev/null ${HOME} echo && grep "$@"
+| 2>/dev/null local "$@"
+		sed --verbose test cd "$@" x=1 -eu export
+'quoted text' printf done x=1 grep $(pwd) ${HOME} test awk done x=1 --verbose
+		local cd --verbose echo "$@" grep 2>/dev/null
+-eu awk done 'quoted text'
+		awk -eu 'quoted text' test sed sed "$1" && then
+	${HOME} | echo --verbose sed /usr/bin
+$(pwd) x=1 -eu ${HOME} /usr/bin sed $(pwd) printf
+	grep export 2>/dev/null readonly x=1
+		| printf local echo awk $(pwd) echo printf test echo readonly 'quoted text'
+		test x=1 test | "$1" done 'quoted text' ${HOME} local export "$1" /usr/bin
+		$(pwd) test | 'quoted text' ${HOME} printf --verbose
+		2>/dev/null sed ${HOME} test cd ${HOME} local 2>/dev/null 'quoted text'
+	awk done -eu 'quoted text' "$1" 2>/dev/null echo "$@"
+	-eu echo echo 'quoted text' | && "$@"
+		x=1 $(pwd) readonly cd "$@" 2>/dev/null
+&& -eu 2>/dev/null /usr/bin "$@" cd 2>/dev/null
+"$1" readonly echo -eu done export then --verbose test grep | done then 'quoted text'
+	local && cd "$1" "$1" test --verbose ${HOME} "$1" x=1 done awk --verbose
+		| awk "$@" awk awk -eu export then $(pwd)
+printf && test "$1" grep local /usr/bin --verbose
+	cd sed done test echo --verbose printf "$@" 2>/dev/null grep sed
+	"$1" grep -eu then test cd -eu grep /usr/bin sed awk test ${HOME} | | "$1" test
+"$@" 'quoted text' "$@" readonly export cd
+'quoted text' grep sed x=1 readonly --verbose "$@" then --verbose awk -eu
+	| && 'quoted text' awk readonly then grep test awk cd echo
+		/usr/bin "$1" readonly then "$@"
+		readonly awk 'quoted text' local test "$@"
+export cd 2>/dev/null 'quoted text' printf 2>/dev/null --verbose "$1" echo
+	$(pwd) --verbose printf x=1 2>/dev/null test "$@" -eu sed "$@" $(pwd)
+	local sed sed 'quoted text' x=1 sed
+&& echo readonly $(pwd) done
+cd test ${HOME} 2>/dev/null "$1" | test $(pwd)
+"$@" -eu /usr/bin grep $(pwd) grep cd 'quoted text' local export grep
+echo && && && ${HOME} && export grep && --verbose -eu $(pwd) x=1
+export awk -eu sed -eu echo local 2>/dev/null
+	'quoted text' awk 'quoted text' ${HOME} 'quoted text' export | --verbose
+		readonly done readonly "$@" 'quoted text' awk then "$@" 'quoted text'
+	${HOME} echo | readonly -eu
+		printf sed echo echo --verbose x=1 printf $(pwd) printf then grep test
+$(pwd) cd 2>/dev/null done && printf
+	-eu grep --verbose --verbose 2>/dev/null
+echo local readonly -eu /usr/bin "$@" 2>/dev/null ${HOME}
+	"$@" test /usr/bin readonly 'quoted text' done --verbose --verbose
+		2>/dev/null /usr/bin x=1 $(pwd) then -eu readonly
+		printf echo local 2>/dev/null && 2>/dev/null printf 'quoted text'
+	/usr/bin $(pwd) 2>/dev/null cd readonly "$1" "$1" 2>/dev/null x=1 -eu x=1 then
+printf 2>/dev/null ${HOME} done test readonly --verbose printf local
+		test awk ${HOME} cd "$@" echo local "$@" export readonly sed readonly 2>/dev/null
+-eu ${HOME} grep "$1" grep sed 'quoted text' 'quoted text' --verbose grep --verbose
+/usr/bin local awk -eu $(pwd) $(pwd) 'quoted text'
+	local 'quoted text' "$1" test awk ${HOME} "$1" local readonly
+	local --verbose | | printf x=1 local then "$1" "$1"
+	printf -eu --verbose x=1 "$@" 2>/dev/null test echo awk then 2>/dev/null &&
+	local --verbose export readonly /usr/bin
+		&& grep export $(pwd) 'quoted text' ${HOME} $(pwd) | /usr/bin
+	sed && test readonly export test local 'quoted text'
+	${HOME} --verbose x=1 export $(pwd) 2>/dev/null done -eu test awk
+| "$1" x=1 sed echo done /usr/bin /usr/bin --verbose
+local && cd echo echo done 'quoted text' test $(pwd) &&
+		"$1" readonly ${HOME} printf done cd $(pwd) "$@" test echo "$1"
+	echo done done local | --verbose
+	--verbose readonly done printf | echo test -eu x=1 -eu 'quoted text' echo "$@"
+	$(pwd) awk 'quoted text'
+		-eu test "$1" export echo x=1 then "$@" | $(pwd) -eu sed cd --verbose "$1"
+		then $(pwd) "$@" 'quoted text' ${HOME} done local test | export sed
+2>/dev/null then -eu /usr/bin printf grep then sed ${HOME} grep cd -eu printf
+		test done "$@" cd then awk "$@" "$@" awk --verbose readonly done
+	grep --verbose 'quoted text' && awk awk local done readonly && printf readonly
+| readonly ${HOME} export /usr/bin 2>/dev/null
+		test cd then -eu cd 'quoted text' grep sed
+	done && done --verbose x=1
+	&& -eu $(pwd) done /usr/bin test
+		readonly 'quoted text' 2>/dev/null
+		"$1" readonly test 2>/dev/null ${HOME} $(pwd) | "$1" && -eu awk then ${HOME}
+		'quoted text' export 2>/dev/null
+&& echo readonly --verbose sed "$@" printf test
+		local $(pwd) | printf
+readonly "$@" echo "$1"
+		x=1 x=1 'quoted text' grep
+	'quoted text' echo | cd printf
+	local "$@" | grep test printf 2>/dev/null done | awk
+		cd echo grep 2>/dev/null readonly
+"$@" 'quoted text' x=1 done then $(pwd) -eu | grep
+cd --verbose | && /usr/bin | /usr/bin grep readonly then "$@"
+	sed -eu sed test /usr/bin "$@" printf cd && 2>/dev/null ${HOME}
+done "$1" $(pwd) ${HOME} ${HOME} ${HOME} ${HOME} awk x=1 echo grep
+	&& x=1 --verbose export ${HOME} local && done -eu cd $(pwd)
+"$@" test local --verbose printf awk $(pwd) x=1 local echo
+		/usr/bin printf /usr/bin done -eu sed "$@" && export "$1" printf
+${HOME} && echo cd && awk echo sed cd 'quoted text' sed
+export -eu local readonly grep --verbose
+	awk /usr/bin /usr/bin echo then sed cd then awk
+local | awk sed local && $(pwd) 2>/dev/null "$1" then $(pwd) 'quoted text'
+sed echo test done cd export 'quoted text' ${HOME}
+		readonly cd done awk --verbose
+		cd cd grep "$1" done printf "$@" && -eu /usr/bin "$1" x=1 awk test cd ${HOME}
+	"$@" grep ${HOME} readonly awk -eu "$@" "$1" 2>/dev/null
+		"$@" "$@" awk local -eu grep ${HOME}
+"$@" | "$1" /usr/bin /usr/bin "$1"
+	printf test local echo -eu local
+		${HOME} echo cd ${HOME} done /usr/bin cd test "$1" | export x=1 echo 2>/dev/null
+--verbose | --verbose awk done
+	/usr/bin grep x=1 test && --verbose echo && done
+		readonly | local | /usr/bin 2>/dev/null local awk "$1" | $(pwd) "$1" 'quoted text'
+	test $(pwd) $(pwd) -eu 2>/dev/null local | grep
+export sed test test
+		readonly && sed --verbose "$1"
+		| grep /usr/bin x=1 local --verbose done --verbose
+		awk 'quoted text' done "$@" readonly echo printf readonly
+		2>/dev/null printf $(pwd) 'quoted text'
+		printf echo export 'quoted text' | | "$@" cd "$1" &&
+		${HOME} 2>/dev/null /usr/bin --verbose echo echo local 'quoted text'
+	-eu export "$@" awk -eu grep export -eu | $(pwd) "$@"
+		'quoted text' local && | /usr/bin export | "$@" cd readonly
+		&& ${HOME} "$@" && grep | export local 'quoted text' export --verbose test
+	/usr/bin $(pwd) awk x=1 test grep
+	grep 'quoted text' awk cd
+		$(pwd) echo --verbose ${HOME} | | && printf export cd "$1" -eu awk
+		$(pwd) export $(pwd) cd then -eu --verbose
+&& --verbose grep readonly 2>/dev/null cd readonly
+readonly printf then readonly
+grep local x=1 x=1 test 'quoted text'
+then done 'quoted text' test -eu test && | grep ${HOME} readonly | --verbose ${HOME}
+	done then | local local then
+	&& grep readonly "$1" sed x=1
+/usr/bin readonly ${HOME} readonly echo $(pwd) sed x=1 readonly
+		&& cd printf sed then ${HOME} x=1 /usr/bin readonly done | awk grep $(pwd) echo
+	-eu readonly x=1 then awk ${HOME} | awk readonly sed "$1" done -eu
+		export sed done local echo ${HOME} "$@" readonly awk x=1
+		test readonly readonly x=1
+		awk awk export $(pwd) done local then
+"$@" --verbose -eu 2>/dev/null /usr/bin "$@" $(pwd) ${HOME} ${HOME} ${HOME}
+	$(pwd) sed local printf /usr/bin
+		'quoted text' /usr/bin --verbose then ${HOME} --verbose echo test
+		cd then ${HOME} echo readonly then cd
+	then 2>/dev/null readonly local readonly ${HOME} then awk
+		-eu "$1" -eu done $(pwd) echo 'quoted text' $(pwd)
+		printf /usr/bin x=1 2>/dev/null readonly grep awk ${HOME}
+done printf ${HOME} then awk "$1" | export "$@" -eu test "$@" then
+		local ${HOME} && export | ${HOME} $(pwd) printf "$1" | && local
+then export ${HOME} --verbose x=1 cd echo 'quoted text' awk done
+grep then awk awk | local readonly echo
+		| local cd sed && test done export
+&& then 2>/dev/null export -eu readonly done && | local 'quoted text'
+		echo ${HOME} cd test export
+		export printf -eu sed grep grep "$@" cd x=1 | cd local
+done done test $(pwd) local cd |
+	--verbose then $(pwd) /usr/bin echo grep x=1 printf && x=1
+	sed | awk sed 2>/dev/null "$@" 'quoted text' test ${HOME} echo
+readonly $(pwd) x=1 | cd --verbose x=1
+		export | x=1 done -eu printf done done
+		local 2>/dev/null -eu printf | ${HOME} $(pwd) awk printf --verbose
+printf $(pwd) "$@" ${HOME} -eu printf 'quoted text' done
+		test awk x=1 'quoted text' 2>/dev/null $(pwd) done -eu $(pwd)
+		/usr/bin 'quoted text' 2>/dev/null 'quoted text'
+	-eu readonly export echo
+	x=1 && printf -eu readonly && -eu then | && cd 2>/dev/null awk "$1" awk 2>/dev/null
+	${HOME} 2>/dev/null x=1 sed --verbose x=1 printf "$1"
+	| done $(pwd) 'quoted text' "$@" awk readonly 'quoted text' local readonly /usr/bin
+-eu then then --verbose ${HOME} echo
+	awk sed echo -eu sed cd x=1 readonly ${HOME} x=1
+export 2>/dev/null done $(pwd) 2>/dev/null sed local
+	grep "$@" "$1" x=1 then
+	sed cd awk printf /usr/bin /usr/bin x=1 printf $(pwd) grep
+-eu && local "$@" -eu "$@" done
+	printf $(pwd) readonly x=1 sed $(pwd) done && | | "$@" local export 'quoted text'
+		$(pwd) "$1" cd "$@" -eu
+		grep awk && readonly "$@" test "$@" /usr/bin 2>/dev/null -eu sed sed then awk
+grep 'quoted text' /usr/bin --verbose
+--verbose readonly grep grep readonly
+		echo "$1" sed "$1" "$1" awk -eu sed --verbose /usr/bin
+/usr/bin done awk --verbose 2>/dev/null "$1" then | | $(pwd) -eu -eu
+		--verbose test "$@" awk readonly readonly cd "$@"
+	2>/dev/null /usr/bin then && x=1 x=1 export then | readonly | /usr/bin
+		2>/dev/null && | -eu "$@" 2>/dev/null
+	awk printf -eu printf 'quoted text' ${HOME} ${HOME} done 2>/dev/null /usr/bin
+		| --verbose 'quoted text' then "$@"
+		local -eu then $(pwd) awk | echo grep 2>/dev/null "$1" sed local
+		${HOME} 2>/dev/null x=1 sed ${HOME} 'quoted text'
+	${HOME} --verbose grep /usr/bin cd --verbose | test local
+	grep $(pwd) "$@" 2>/dev/null done | done "$1" 'quoted text' | test x=1 done echo
+export awk grep ${HOME}
+${HOME} printf sed done cd test 'quoted text' "$1" x=1 2>/dev/null sed -eu
+	export $(pwd) | awk 'quoted text' && then 2>/dev/null then done awk grep x=1 -eu
+x=1 grep /usr/bin --verbose printf /usr/bin then && && awk &&
+		sed --verbose $(pwd) $(pwd) printf
+	"$@" printf x=1 /usr/bin "$1" --verbose x=1 echo $(pwd)
+then 'quoted text' $(pwd) "$1" "$1" sed 'quoted text'
+test && grep 'quoted text' "$@" "$@"
+	echo then "$1" 'quoted text' cd -eu /usr/bin
+	${HOME} then grep "$@" 2>/dev/null "$@" -eu $(pwd) then done
+	$(pwd) --verbose awk echo 2>/dev/null "$@" 'quoted text' --verbose /usr/bin
+	"$@" -eu x=1 done | --verbose | "$1" test echo echo sed -eu printf
+$(pwd) grep grep ${HOME} readonly "$1" export done
+	awk test -eu readonly x=1 && sed cd x=1 | printf test 2>/dev/null
+		sed readonly readonly ${HOME} 'quoted text' 2>/dev/null 2>/dev/null 2>/dev/null
+	$(pwd) echo -eu local "$1" && awk echo 2>/dev/null && 2>/dev/null
+test printf -eu test grep --verbose -eu printf
+done 'quoted text' && echo test cd --verbose
+	then local x=1 2>/dev/null cd cd /usr/bin cd readonly done cd sed
+	--verbose then && echo && ${HOME} awk
+	printf readonly printf 2>/dev/null "$1" printf 2>/dev/null --verbose cd
+		-eu export 'quoted text'
+		export local $(pwd) then x=1 /usr/bin $(pwd) grep "$@" --verbose
+	--verbose grep --verbose echo awk sed test --verbose "$@" then $(pwd) 'quoted text'
+$(pwd) x=1 echo ${HOME} done /usr/bin local /usr/bin grep
+	cd awk /usr/bin 'quoted text' sed -eu grep
+		grep x=1 ${HOME} grep ${HOME} 'quoted text' -eu -eu
+		awk test -eu grep printf x=1 -eu sed cd "$1" --verbose readonly
+	/usr/bin local test "$@"
+		local printf readonly | -eu done && grep readonly ${HOME} printf "$1"
+	x=1 cd export printf "$1" cd /usr/bin "$@" export awk --verbose
+| "$1" --verbose "$1" x=1 ${HOME} echo readonly ${HOME} ${HOME} --verbose
+echo readonly /usr/bin
+	awk sed printf x=1 $(pwd) "$@" awk -eu test ${HOME}
+	'quoted text' "$@" 2>/dev/null "$@" --verbose then then "$@" grep -eu /usr/bin
+test local x=1 | 2>/dev/null "$@" 2>/dev/null done
+${HOME} echo && sed then 2>/dev/null
+	2>/dev/null cd && $(pwd) cd /usr/bin $(pwd) sed done then cd export
+		-eu && "$@" /usr/bin sed cd -eu sed cd
+	then ${HOME} grep "$1" --verbose done ${HOME} awk local then
+		"$1" x=1 "$@" 'quoted text'
+		| printf | awk test done && readonly grep 2>/dev/null grep then then /usr/bin
+		sed then "$1" then cd local awk then ${HOME} awk x=1 test local
+done grep done grep && 2>/dev/null grep && sed -eu x=1 export 'quoted text' 2>/dev/null
+	$(pwd) $(pwd) then --verbose done sed echo test | -eu && 'quoted text' |
+'quoted text' | 2>/dev/null readonly test
+	test 'quoted text' readonly
+		awk test sed "$@" -eu ${HOME} ${HOME}
+		$(pwd) "$@" cd printf 'quoted text' 2>/dev/null export 2>/dev/null readonly /usr/bin
+sed $(pwd) 2>/dev/null grep | done test printf
+	done done /usr/bin --verbose printf 'quoted text' 'quoted text' &&
+		| "$1" done local local printf sed sed --verbose sed then && awk sed /usr/bin
+	"$@" $(pwd) done 'quoted text' printf -eu 2>/dev/null -eu
+grep printf echo test
+	$(pwd) grep "$@" ${HOME} && && /usr/bin -eu done | printf && local sed echo
+test sed printf | /usr/bin done $(pwd) --verbose
+		local -eu sed test ${HOME} ${HOME} --verbose 'quoted text' ${HOME} -eu
+		awk "$1" test grep --verbose echo done 'quoted text'
+--verbose | done readonly x=1 cd done export
+printf cd "$@" $(pwd) | | | export
+sed awk ${HOME} printf then then awk local $(pwd)
+		cd printf done 2>/dev/null done "$@" -eu ${HOME} test
+readonly 'quoted text'
+		"$1" cd --verbose echo test 2>/dev/null x=1
+		-eu 'quoted text' awk awk readonly --verbose
+		readonly sed 2>/dev/null
+		2>/dev/null /usr/bin readonly cd readonly $(pwd) --verbose cd echo cd sed
+2>/dev/null printf "$@" -eu 2>/dev/null
+		x=1 "$1" /usr/bin test readonly "$1" local done test export -eu awk ${HOME}
+	-eu sed --verbose awk "$@" done then printf readonly 'quoted text'
+	/usr/bin "$1" local local
+	cd && test | $(pwd) $(pwd) "$@" "$@" done && 'quoted text'
+sed then done then readonly x=1 done
+	cd printf cd echo 2>/dev/null readonly
+done sed && test "$1" test ${HOME} printf echo
+echo sed "$@" "$@" echo printf readonly printf grep -eu awk "$1" printf sed done
+$(pwd) sed export done sed -eu done
+		2>/dev/null echo ${HOME} 2>/dev/null 2>/dev/null && 'quoted text' |
+	| -eu then | sed 2>/dev/null /usr/bin export done ${HOME} then | &&
+		$(pwd) | -eu "$1" grep local $(pwd) export 'quoted text' test ${HOME}
+readonly sed test x=1 cd "$@" -eu done 'quoted text' test
+		printf "$1" 'quoted text' sed then local cd | then export test /usr/bin
+then echo readonly -eu sed --verbose readonly 2>/dev/null test
+	/usr/bin ${HOME} then cd awk done grep local | sed readonly $(pwd) $(pwd)
+	$(pwd) -eu printf -eu awk test "$1" readonly
+	'quoted text' echo grep | | | ${HOME} "$1" sed "$1" && $(pwd)
+	'quoted text' | sed local then /usr/bin
+		$(pwd) echo then test /usr/bin | x=1 local --verbose
+		--verbose done done -eu | test && x=1 echo &&
+	local 'quoted text' then readonly -eu printf export export /usr/bin
+	sed 2>/dev/null -eu grep /usr/bin echo test "$@" export
@@ -0,0 +1,2001 @@
+	| cd sed done $(pwd) "$@" && sed readonly awk && grep "$@"
+	export 2>/dev/null grep
+		export "$@" readonly | readonly
+$(pwd) | awk awk local "$@" echo
+	&& done ${HOME} then export --verbose
+cd ${HOME} grep | ${HOME} "$1" "$@" ${HOME} sed readonly awk && --verbose done
+/usr/bin --verbose awk readonly
+| | done test printf "$@" "$1" grep grep ${HOME}
+	--verbose printf grep local readonly echo cd &&
+"$@" -eu --verbose x=1 --verbose then ${HOME} sed test echo 'quoted text'
+	"$@" ${HOME} echo sed --verbose printf && /usr/bin 'quoted text'
+		awk readonly ${HOME} ${HOME} "$@" "$@" -eu done cd
+		readonly test ${HOME} export local test ${HOME} echo -eu /usr/bin
+2>/dev/null echo 'quoted text' done export test
+	${HOME} done sed local "$1" done
+export 'quoted text' cd test && cd x=1 printf printf | export --verbose
+	2>/dev/null $(pwd) x=1 printf 2>/dev/null test 2>/dev/null $(pwd)
+		then --verbose 'quoted text' -eu x=1 x=1
+	'quoted text' && ${HOME} test "$@"
+		-eu "$@" sed 'quoted text' "$@"
+		grep x=1 --verbose local
+	done test sed echo 'quoted text' cd "$1" then --verbose $(pwd)
+		-eu /usr/bin 2>/dev/null --verbose done 2>/dev/null | -eu awk
+		cd $(pwd) echo grep sed
+	2>/dev/null x=1 | printf export $(pwd) ${HOME}
+echo then && grep grep | 'quoted text' x=1 cd x=1 echo x=1 'quoted text'
+		awk export awk local ${HOME} ${HOME} grep 'quoted text' x=1 && -eu printf echo
+		2>/dev/null --verbose printf test
+then grep -eu 'quoted text' -eu x=1 'quoted text' /usr/bin $(pwd)
+	"$@" done then 'quoted text' local
+	readonly 'quoted text' 2>/dev/null x=1
+x=1 grep x=1 "$@" | && | awk /usr/bin echo $(pwd) then 2>/dev/null
+	sed printf --verbose &&
+	local sed grep | grep -eu local
+		'quoted text' printf local "$@" then echo export printf
+	| done grep then awk --verbose
+	/usr/bin 2>/dev/null local printf x=1
+	"$1" local readonly grep local awk awk 2>/dev/null cd export && $(pwd)
+		"$@" x=1 -eu $(pwd) local
+		readonly printf export readonly readonly "$@" then && -eu x=1 2>/dev/null awk awk
+"$1" "$@" && test awk x=1 | echo readonly printf echo "$1" 'quoted text'
+cd --verbose sed export cd ${HOME} awk then echo && && "$1" 2>/dev/null 'quoted text'
+		--verbose done -eu "$@" echo /usr/bin /usr/bin
+	export $(pwd) && cd "$@" cd awk
+		then 2>/dev/null echo x=1 grep sed -eu cd done x=1 readonly 'quoted text'
+printf done "$@" export ${HOME} awk "$@" test done
+	&& echo done done -eu done -eu grep | echo x=1 x=1 export x=1
+		2>/dev/null local "$1" export /usr/bin awk then cd x=1 export echo then
+	then 'quoted text' $(pwd) test readonly
+"$@" readonly 'quoted text' -eu --verbose "$@" test $(pwd)
+	"$@" sed | 2>/dev/null readonly 'quoted text' echo && export $(pwd) sed printf
+then then cd | printf cd 'quoted text'
+	&& && grep --verbose --verbose local /usr/bin echo test
+	echo $(pwd) ${HOME} cd awk x=1 ${HOME} "$1" export readonly printf "$@"
+	&& /usr/bin "$@" 'quoted text'
+&& awk grep x=1 x=1 export --verbose
+		${HOME} "$@" then && awk "$@" "$@" x=1 cd 'quoted text' export "$@" $(pwd)
+	2>/dev/null test cd sed printf sed awk cd --verbose /usr/bin
+export $(pwd) 'quoted text' $(pwd) ${HOME} local echo
+		'quoted text' "$1" echo /usr/bin ${HOME} awk -eu ${HOME} x=1 x=1
+		| 2>/dev/null grep "$1" | sed 2>/dev/null done | 'quoted text'
+	readonly then sed printf -eu cd 2>/dev/null then test 'quoted text'
+		local $(pwd) test && /usr/bin export awk echo then ${HOME}
+done cd test -eu "$@" && echo sed cd | && export cd x=1 printf
+		x=1 -eu awk echo $(pwd) readonly then "$1" ${HOME}
+	--verbose local ${HOME} export export ${HOME}
+	then ${HOME} cd grep --verbose printf sed then && ${HOME} x=1 --verbose
+	--verbose awk test | sed /usr/bin /usr/bin readonly ${HOME}
+		&& sed grep x=1 'quoted text'
+grep --verbose then printf then local sed
+	local | awk 'quoted text' cd local printf "$@" done cd "$1" cd local 'quoted text'
+then test grep "$@" -eu readonly readonly "$1" test then && | test x=1 echo
+	readonly echo printf 2>/dev/null /usr/bin sed 'quoted text' then
+$(pwd) --verbose $(pwd) readonly "$1" printf "$1" --verbose
+	printf export --verbose
+		--verbose -eu printf local /usr/bin -eu /usr/bin | ${HOME}
+2>/dev/null ${HOME} grep sed awk -eu $(pwd)
+	local export done -eu export /usr/bin --verbose
+	&& $(pwd) ${HOME} local local --verbose echo sed awk "$@" cd local "$@"
+		grep --verbose grep && -eu awk | "$1" done then readonly /usr/bin
+	'quoted text' "$@" x=1 echo printf "$1" echo cd printf -eu
+		sed x=1 2>/dev/null export "$1" local 2>/dev/null
+		sed --verbose grep ${HOME} x=1 $(pwd) --verbose --verbose
+sed test --verbose "$1" readonly awk /usr/bin grep grep done local 2>/dev/null local
+	x=1 export ${HOME} 'quoted text' readonly && readonly
+grep && | 'quoted text' x=1
+	test sed | readonly "$1" -eu --verbose local 'quoted text'
+&& then "$1" -eu test
+		cd && export done /usr/bin local sed $(pwd) ${HOME} local
+	sed "$1" then 'quoted text' && echo awk done -eu "$@" echo echo 'quoted text'
+	cd done test printf awk -eu local export x=1 test awk done then echo grep
+export awk --verbose $(pwd) awk x=1
+| cd grep --verbose "$1" && sed
+		2>/dev/null done 'quoted text' "$1" test
+done grep --verbose cd done test 2>/dev/null then echo cd "$@" export ${HOME} test
+		&& echo cd grep echo awk "$1" /usr/bin sed cd cd "$1" printf sed --verbose
+cd | /usr/bin /usr/bin -eu grep 2>/dev/null grep "$@"
+	'quoted text' 2>/dev/null printf /usr/bin ${HOME}
+readonly printf --verbose done 2>/dev/null --verbose /usr/bin $(pwd) x=1 "$1"
+		local /usr/bin 'quoted text'
+		--verbose done sed /usr/bin export local awk export $(pwd) 2>/dev/null
+		--verbose export /usr/bin
+		awk -eu --verbose then test test 2>/dev/null grep "$1" local ${HOME}
+		cd 'quoted text' 'quoted text' printf
+2>/dev/null cd -eu /usr/bin
+	| | --verbose $(pwd) local | /usr/bin cd "$@" -eu 'quoted text'
+printf sed ${HOME} "$1" local test sed cd ${HOME} --verbose printf /usr/bin
+		export -eu | -eu local $(pwd) /usr/bin local -eu sed | awk "$1" "$1"
+&& local x=1 -eu && done | export "$1" echo --verbose ${HOME}
+echo readonly ${HOME} | --verbose
+	| --verbose then "$@" | cd ${HOME} then x=1 | sed done --verbose sed "$@" |
+| grep cd 'quoted text' export
+'quoted text' then "$1" "$@" then readonly sed -eu "$@"
+	2>/dev/null "$1" test "$@" done "$1" export
+cd -eu "$1" export 'quoted text' grep sed grep x=1 done then echo x=1
+done echo ${HOME} "$1" x=1 "$@" $(pwd) cd printf 'quoted text' /usr/bin
+	echo awk && then "$1" --verbose echo test echo ${HOME} 'quoted text'
+"$@" done --verbose awk /usr/bin sed /usr/bin test awk "$@" sed test
+		| --verbose /usr/bin ${HOME} awk
+${HOME} "$@" cd readonly "$@" && sed readonly local "$@" /usr/bin && echo 'quoted text'
+		x=1 "$1" "$@" $(pwd) sed "$1" awk sed ${HOME} ${HOME} --verbose
+"$@" --verbose sed "$1" cd ${HOME} -eu 2>/dev/null && echo 2>/dev/null
+$(pwd) printf cd x=1 done "$@" done local 2>/dev/null &&
+'quoted text' readonly readonly local echo
+-eu -eu then $(pwd) /usr/bin test export local echo && cd | then 'quoted text'
+		local printf && 2>/dev/null local
+		-eu echo echo "$1" --verbose
+	2>/dev/null awk && awk x=1 /usr/bin "$1"
+${HOME} --verbose $(pwd) local awk && x=1 --verbose
+	local export /usr/bin printf test local | awk x=1 /usr/bin 2>/dev/null
+echo "$1" 2>/dev/null cd local && local | echo
+$(pwd) /usr/bin cd test cd awk
+		printf export then grep x=1 "$1"
+	$(pwd) sed echo printf /usr/bin ${HOME} | 2>/dev/null export -eu
+	| ${HOME} -eu test printf test readonly cd readonly --verbose
+		readonly "$@" 2>/dev/null --verbose grep local ${HOME} ${HOME} printf
+"$1" then done -eu printf $(pwd) "$@" export | then echo done "$@" "$1"
+echo /usr/bin done local local sed then grep awk $(pwd) cd --verbose --verbose
+grep 2>/dev/null grep "$1" local --verbose
+$(pwd) readonly 'quoted text' ${HOME} export echo && /usr/bin
+		grep 'quoted text' then cd export export grep printf test then done
+		'quoted text' 'quoted text' local done readonly 2>/dev/null echo export export $(pwd)
+	sed echo echo -eu test 'quoted text' test $(pwd) then awk 2>/dev/null
+sed printf $(pwd) ${HOME}
+&& printf --verbose done local 2>/dev/null --verbose
+		cd local awk readonly ${HOME} $(pwd) ${HOME}
+		grep echo echo ${HOME} printf /usr/bin $(pwd)
+	${HOME} export 'quoted text' sed grep "$@" ${HOME} 'quoted text'
+	-eu grep test then "$@" "$@" /usr/bin local 'quoted text' ${HOME}
+	cd x=1 && awk echo 2>/dev/null -eu awk cd $(pwd)
+"$@" "$@" sed done local done echo --verbose local sed --verbose ${HOME} "$1"
+		export local grep sed local awk 'quoted text' sed then done /usr/bin && export
+		sed test $(pwd) grep local x=1 "$@" then | "$1" x=1 grep /usr/bin awk |
+		${HOME} /usr/bin awk awk && done /usr/bin -eu awk printf /usr/bin grep sed done
+		${HOME} then | x=1 export export ${HOME} /usr/bin "$@" ${HOME} | "$1"
+	--verbose && /usr/bin awk then readonly readonly --verbose cd "$@" ${HOME} cd awk
+		"$1" /usr/bin && cd "$1" x=1 readonly echo $(pwd) test
+then printf cd printf done done cd local -eu ${HOME} printf echo sed --verbose
+		&& --verbose awk $(pwd) /usr/bin ${HOME} awk grep awk grep
+	echo test local done -eu grep test test ${HOME} && "$@" done cd
+	/usr/bin sed 'quoted text' test
+	printf echo /usr/bin done local sed 2>/dev/null sed test | x=1 -eu && done --verbose
+		2>/dev/null then readonly then sed ${HOME} awk /usr/bin cd sed cd
+		local $(pwd) $(pwd) ${HOME}
+-eu readonly cd -eu printf readonly 2>/dev/null printf &&
+	readonly test cd done test ${HOME} test printf
+	&& done printf 'quoted text' echo
+	--verbose --verbose local && done ${HOME} /usr/bin
+	"$@" done cd readonly x=1 'quoted text' 'quoted text'
+	echo "$@" readonly local done test then
+--verbose --verbose printf
+test cd readonly "$1" ${HOME} awk
+	--verbose printf | done echo -eu x=1 ${HOME} x=1 sed $(pwd) sed
+		--verbose printf 'quoted text' --verbose readonly -eu cd x=1 printf cd readonly
+local 'quoted text' awk local then 2>/dev/null
+	export 'quoted text' awk x=1 readonly /usr/bin test
+	| echo then export --verbose grep "$1"
+| -eu --verbose grep done cd --verbose "$@" cd ${HOME}
+	readonly $(pwd) ${HOME} /usr/bin export local x=1 local grep $(pwd) && | ${HOME}
+local sed sed test done 'quoted text' | done export sed | /usr/bin "$@"
+		--verbose export echo x=1 && then sed x=1 done
+		sed "$@" ${HOME} 'quoted text' echo ${HOME}
+		2>/dev/null sed -eu cd ${HOME} "$@" awk then grep
+	done awk && echo test printf cd done then 2>/dev/null "$@" 'quoted text'
+		test | cd 2>/dev/null --verbose done
+export sed $(pwd) awk test done
+	2>/dev/null export 'quoted text'
+	cd cd $(pwd) local done echo --verbose /usr/bin $(pwd) | done -eu done
+		export echo "$@" sed $(pwd) sed
+cd export ${HOME} done grep done "$@" "$@" --verbose && x=1 x=1 test
+		then grep --verbose -eu export printf --verbose
+		/usr/bin "$1" local cd sed $(pwd) x=1 awk done cd --verbose --verbose readonly
+	$(pwd) export printf /usr/bin test awk printf cd cd "$1" grep
+	then "$1" grep printf grep /usr/bin test
+		then $(pwd) $(pwd) done readonly ${HOME} awk --verbose | grep | then "$1"
+${HOME} cd printf awk ${HOME}
+	readonly readonly done "$@" done test awk awk cd printf awk -eu export echo
+		local printf -eu test echo then | ${HOME}
+	then local echo cd done awk test "$@" readonly "$1"
+done -eu awk ${HOME} awk awk awk -eu
+-eu grep $(pwd) x=1 2>/dev/null 'quoted text' test grep
+		"$1" then awk echo echo sed awk awk /usr/bin $(pwd) done && readonly echo printf
+		$(pwd) awk echo $(pwd) x=1 ${HOME} x=1 grep -eu grep 2>/dev/null 2>/dev/null
+-eu /usr/bin "$@" grep 2>/dev/null sed x=1 2>/dev/null 'quoted text'
+test done | test 2>/dev/null "$1" -eu done | 2>/dev/null
+grep test --verbose $(pwd) printf ${HOME} "$1" grep ${HOME} export local sed
+	${HOME} cd grep awk printf 2>/dev/null echo --verbose printf
+		$(pwd) x=1 sed "$@" then done "$@" test
+--verbose && awk $(pwd) sed
+		export x=1 printf | grep /usr/bin
+x=1 echo awk | grep x=1 grep ${HOME} $(pwd) /usr/bin sed 2>/dev/null
+--verbose export x=1 awk export awk /usr/bin && export done -eu -eu export -eu
+	cd --verbose grep awk x=1 x=1 export
+		readonly local export /usr/bin ${HOME} printf x=1 "$@" awk "$@" 2>/dev/null
+'quoted text' cd 2>/dev/null
+	${HOME} cd -eu done export "$1" done
+		-eu | 2>/dev/null printf /usr/bin ${HOME}
+	--verbose | awk ${HOME} grep $(pwd)
+	| ${HOME} | sed grep x=1 printf --verbose local export /usr/bin readonly
+	&& then -eu ${HOME} ${HOME} echo printf then "$@" --verbose export | done && "$1"
+done local test printf sed /usr/bin "$@" test | 'quoted text'
+		| grep $(pwd) --verbose echo --verbose local
+		&& "$@" awk --verbose --verbose sed printf cd test done "$1"
+	printf export printf "$@" 2>/dev/null
+	$(pwd) local x=1 printf $(pwd) grep printf test printf ${HOME} /usr/bin
+local printf done printf then -eu x=1 sed grep grep cd test
+	"$@" --verbose local 'quoted text'
+		then 2>/dev/null /usr/bin
+		x=1 $(pwd) "$@" "$1" export local $(pwd) $(pwd)
+echo echo cd then -eu readonly /usr/bin readonly
+		then done --verbose cd /usr/bin
+	'quoted text' echo /usr/bin awk done readonly sed
+	grep sed --verbose 2>/dev/null grep grep
+2>/dev/null export x=1 ${HOME} local
+	2>/dev/null done echo x=1 done
+		${HOME} grep then echo test $(pwd) local $(pwd)
+-eu x=1 readonly "$@" /usr/bin then export readonly | cd | cd /usr/bin sed
+export 2>/dev/null readonly then
+	x=1 2>/dev/null "$1" "$@" done printf -eu
+done 'quoted text' "$1" cd done sed sed printf cd "$@" echo | -eu cd export
+		sed x=1 | $(pwd) grep "$@" readonly | awk --verbose -eu printf export
+printf /usr/bin --verbose --verbose ${HOME}
+		"$@" sed $(pwd) "$1" local echo
+	| done readonly grep echo x=1 awk then /usr/bin printf "$@" 'quoted text' "$@"
+| "$@" local done $(pwd) && done
+		"$@" grep echo cd grep readonly export | -eu done awk awk -eu 'quoted text' printf
+	&& "$@" then then 2>/dev/null "$@" "$1" printf export $(pwd) readonly
+		-eu done "$1" x=1 /usr/bin printf
+		"$1" done local -eu 2>/dev/null then awk readonly printf /usr/bin cd
+sed $(pwd) then $(pwd) | then "$1" grep
+grep readonly then --verbose readonly -eu
+	--verbose && export $(pwd) --verbose
+2>/dev/null ${HOME} 'quoted text' "$@" --verbose
+	x=1 done then "$@" "$@" sed 2>/dev/null
+		--verbose 'quoted text' ${HOME}
+	then grep export | then echo export done readonly
+printf readonly 'quoted text' then ${HOME} grep printf awk
+2>/dev/null awk 'quoted text' "$@" ${HOME} 'quoted text' export
+		cd --verbose -eu echo 'quoted text'
+	"$@" grep | grep export "$@"
+$(pwd) cd "$@" --verbose | | "$@" done --verbose export printf echo
+'quoted text' /usr/bin && -eu 2>/dev/null 2>/dev/null
+	"$@" sed "$@" export grep echo 'quoted text'
+	-eu $(pwd) printf done then local | --verbose local x=1 readonly readonly
+	'quoted text' && x=1 readonly "$1" && 'quoted text' x=1 2>/dev/null
+then test 2>/dev/null export test | | then | cd grep $(pwd) export echo 2>/dev/null
+		printf grep x=1 'quoted text'
+	readonly ${HOME} export then "$1"
+	then "$@" awk x=1 awk x=1 "$1" printf --verbose
+"$@" awk /usr/bin done done 'quoted text'
+cd printf cd 2>/dev/null
+		awk | x=1 cd awk grep 2>/dev/null --verbose sed grep done /usr/bin 'quoted text'
+	then echo test export sed awk cd 2>/dev/null cd 'quoted text' sed /usr/bin
+	export grep awk awk "$@" x=1 printf
+		readonly sed export x=1
+		awk local | done local done then awk
+	sed -eu export && cd cd 2>/dev/null "$1"
+export export "$@" && sed $(pwd) x=1 'quoted text' sed 2>/dev/null
+		sed x=1 done cd 'quoted text' echo
+		$(pwd) x=1 x=1 $(pwd) --verbose local awk /usr/bin printf 'quoted text' sed done
+	"$@" 'quoted text' x=1 export printf 'quoted text' echo export /usr/bin $(pwd)
+		${HOME} grep "$@" grep echo echo --verbose 'quoted text' then cd 'quoted text'
+echo local grep printf sed 'quoted text'
+		--verbose readonly && && then sed echo "$@" echo && -eu --verbose
+-eu done -eu ${HOME} then test done done && then
+		awk cd 'quoted text' 'quoted text' printf -eu --verbose | --verbose
+test export local "$@" $(pwd) test -eu test export test "$@" cd "$1"
+test echo printf export $(pwd) /usr/bin grep printf export --verbose readonly
+cd 'quoted text' readonly
+/usr/bin | then cd awk "$1" -eu ${HOME} | printf local
+		"$@" sed $(pwd) grep "$1" 'quoted text' x=1
+		"$1" grep ${HOME} done 2>/dev/null export
+	--verbose local $(pwd) sed grep echo
+	'quoted text' && then local 2>/dev/null 'quoted text'
+		x=1 then /usr/bin /usr/bin --verbose test then | sed && x=1 && 2>/dev/null
+2>/dev/null local grep done readonly "$@" ${HOME}
+		'quoted text' awk local && "$@" cd && readonly $(pwd) awk export
+	then /usr/bin then x=1 sed --verbose "$@" test
+		echo 2>/dev/null | 2>/dev/null "$1" awk -eu printf cd /usr/bin
+		readonly printf sed "$1" && --verbose "$1" && done test 2>/dev/null
+/usr/bin awk --verbose 2>/dev/null $(pwd) test "$@" $(pwd) awk test &&
+		"$1" test && ${HOME} done -eu
+		2>/dev/null then export cd 'quoted text'
+		echo grep && && --verbose done cd cd echo awk grep $(pwd) done then
+local grep done printf done done "$@" | 'quoted text'
+		"$@" ${HOME} "$@" done && /usr/bin "$@" sed
+		local export --verbose "$1" ${HOME} --verbose
+		&& done then export -eu test test "$1" then
+		$(pwd) test done && | printf
+	echo done x=1 done printf
+	test $(pwd) --verbose readonly
+		echo cd | awk cd then cd test test awk "$@" sed
+-eu printf | ${HOME} | && done local local readonly grep && && cd "$@" /usr/bin
+	local grep readonly -eu cd grep grep local local && grep
+| awk && 'quoted text' "$@" awk "$1" 2>/dev/null
+		awk test "$1" "$1" /usr/bin export --verbose awk "$1"
+"$1" "$1" -eu --verbose --verbose -eu export
+export "$1" export && 'quoted text'
+/usr/bin echo test grep --verbose sed
+		${HOME} "$1" readonly 2>/dev/null | printf
+		cd "$@" readonly -eu ${HOME} echo /usr/bin /usr/bin /usr/bin ${HOME} awk
+"$1" 'quoted text' grep grep /usr/bin --verbose x=1 ${HOME}
+	export test $(pwd) /usr/bin readonly $(pwd) $(pwd) export
+		grep "$1" test /usr/bin -eu "$@" "$@" printf sed local test awk
+	grep 'quoted text' grep --verbose local awk test --verbose export 2>/dev/null
+		printf x=1 sed awk done
+	test && /usr/bin test done sed cd test x=1 test cd export
+printf printf | ${HOME} local readonly $(pwd) local
+then test sed 'quoted text'
+local local --verbose export
+printf test printf | $(pwd) cd done 2>/dev/null
+	"$@" test awk awk echo sed echo grep x=1 'quoted text' awk -eu then
+	local "$@" grep ${HOME} echo
+		'quoted text' --verbose grep --verbose printf ${HOME} export cd "$1" "$1" /usr/bin
+		x=1 x=1 local echo echo /usr/bin grep readonly export readonly printf |
+sed export /usr/bin &&
+		test "$1" cd --verbose
+	echo | 'quoted text' readonly --verbose 'quoted text' --verbose test
+	awk done cd local test grep local printf -eu done 2>/dev/null $(pwd) grep sed
+		x=1 --verbose 2>/dev/null
+		local ${HOME} | export "$@" awk cd -eu then grep sed ${HOME} &&
+	/usr/bin | export readonly sed
+	-eu printf $(pwd) echo test /usr/bin
+		'quoted text' grep export test done cd
+		${HOME} 'quoted text' $(pwd) ${HOME} readonly
+	"$1" then cd local && -eu ${HOME} | && local echo export done
+	grep --verbose readonly x=1 x=1
+test | x=1 awk export grep grep --verbose sed | then --verbose
+	-eu export /usr/bin /usr/bin echo test then awk
+		echo 2>/dev/null "$@"
+$(pwd) readonly "$@" 'quoted text' done readonly && /usr/bin
+	local /usr/bin ${HOME} "$1" 'quoted text' x=1 local 2>/dev/null then done
+sed --verbose local done awk "$@"
+	cd local sed x=1 2>/dev/null
+		/usr/bin cd $(pwd) ${HOME} readonly 2>/dev/null
+"$1" readonly --verbose $(pwd)
+	${HOME} 2>/dev/null "$@" readonly awk -eu --verbose cd echo "$1" 2>/dev/null
+		'quoted text' sed done local x=1 2>/dev/null cd
+--verbose done local "$@"
+		"$1" grep sed $(pwd) "$@" --verbose export
+	/usr/bin test test grep "$1" then test "$@" -eu awk awk | printf "$1"
+		export x=1 -eu done sed -eu 'quoted text'
+x=1 | export "$@" test "$@" -eu $(pwd) then then cd sed "$1" | 'quoted text'
+		${HOME} grep x=1 --verbose export --verbose done
+${HOME} 'quoted text' printf 2>/dev/null cd
+		2>/dev/null sed -eu export ${HOME} printf test | $(pwd) --verbose awk
+		x=1 | cd "$@" done x=1 echo $(pwd) sed test
+	/usr/bin 2>/dev/null local export
+		echo ${HOME} "$1" $(pwd) cd then
+readonly /usr/bin "$1" export 'quoted text' -eu ${HOME} local test then
+	-eu done export "$1" | readonly | grep cd
+"$1" 2>/dev/null 2>/dev/null /usr/bin
+x=1 cd $(pwd) -eu readonly grep | awk local "$1" $(pwd) /usr/bin 'quoted text'
+"$@" "$1" local /usr/bin
+	export x=1 echo "$@" then 2>/dev/null "$@" cd ${HOME}
+done export --verbose | $(pwd) 'quoted text' $(pwd) -eu
+	x=1 cd -eu readonly $(pwd) sed grep done $(pwd) 2>/dev/null
+		"$1" sed sed export readonly printf
+		--verbose sed sed 2>/dev/null x=1 done printf ${HOME} grep echo
+		awk && /usr/bin done sed export export readonly done -eu test 'quoted text'
+		export "$1" "$@" $(pwd) sed $(pwd) printf readonly cd /usr/bin local ${HOME}
+-eu then sed 2>/dev/null test /usr/bin grep && 'quoted text' --verbose
+printf sed readonly sed --verbose
+2>/dev/null then echo $(pwd) export readonly $(pwd) test && done
+	x=1 | ${HOME} then "$@" ${HOME} -eu awk ${HOME} readonly 2>/dev/null /usr/bin
+		test "$1" -eu ${HOME} $(pwd) && awk "$@"
+	2>/dev/null grep awk export test cd readonly
+	'quoted text' $(pwd) readonly cd test cd x=1 readonly $(pwd) cd printf export
+		x=1 'quoted text' x=1 test sed $(pwd) 'quoted text' cd readonly 2>/dev/null
+		test cd grep local 'quoted text' test grep /usr/bin "$1" awk $(pwd) export
+	--verbose export 'quoted text' then sed awk test echo x=1 export
+2>/dev/null grep x=1 ${HOME} export done local grep && "$1"
+		"$1" sed -eu local then 2>/dev/null
+	/usr/bin ${HOME} then readonly
+	printf done && "$1" /usr/bin 2>/dev/null x=1 --verbose
+"$@" 2>/dev/null readonly && x=1 cd done $(pwd)
+		2>/dev/null readonly --verbose
+	readonly | done then --verbose readonly echo test sed ${HOME} local 2>/dev/null
+local grep x=1 echo | 'quoted text' awk
+		'quoted text' then test 'quoted text'
+	$(pwd) export "$1" export "$@" export grep done done
+	x=1 && readonly | x=1 test done && x=1 local then 'quoted text' &&
+sed sed export done "$@" cd --verbose /usr/bin done printf 'quoted text'
+	grep export $(pwd) cd | cd x=1 local 'quoted text' -eu | readonly then then test
+	test $(pwd) readonly test done 'quoted text' && /usr/bin grep done echo grep
+		'quoted text' awk done export awk awk /usr/bin | "$@" echo
+	readonly then printf awk -eu grep cd cd awk ${HOME} -eu
+	awk sed "$1" && then | $(pwd) then then test 2>/dev/null sed && echo $(pwd) export
+	test cd printf /usr/bin "$@"
+sed test printf done ${HOME} 'quoted text' -eu | -eu
+grep grep "$@" --verbose -eu then export test done grep printf then echo "$@" "$1"
+test /usr/bin && local "$1"
+printf export sed local --verbose sed 'quoted text' readonly | echo echo
+x=1 ${HOME} x=1 sed export 2>/dev/null test
+	grep awk printf test grep $(pwd)
+-eu 2>/dev/null sed done test local "$@" then -eu
+$(pwd) && 'quoted text' $(pwd) $(pwd)
+	then 'quoted text' cd then echo | /usr/bin -eu printf readonly 2>/dev/null
+		&& export then x=1 done then export local -eu done printf "$1"
+		local done export then ${HOME} export echo |
+test then sed then --verbose 2>/dev/null export
+	${HOME} -eu 2>/dev/null /usr/bin
+cd printf "$@" done && test $(pwd) x=1 then local x=1 cd -eu -eu && done 2>/dev/null
+		"$@" "$1" x=1 sed "$1" sed test awk 2>/dev/null
+grep printf printf awk local
+		sed readonly 2>/dev/null export 'quoted text'
+	printf --verbose $(pwd) /usr/bin
+-eu && x=1 grep readonly sed printf x=1 readonly grep --verbose
+		then readonly -eu $(pwd) readonly x=1 done /usr/bin $(pwd) readonly readonly
+-eu && 2>/dev/null printf done | printf /usr/bin "$1"
+test x=1 ${HOME} --verbose then grep sed then export 2>/dev/null then
+done cd echo echo -eu printf
+${HOME} test printf "$@" "$1" 2>/dev/null echo "$@" local
+		/usr/bin printf printf "$@" "$@" 'quoted text'
+	test test 2>/dev/null test 2>/dev/null printf done cd -eu local done ${HOME}
+&& -eu test grep local done test && |
+	awk export "$1" printf $(pwd) 'quoted text' echo x=1 | ${HOME} test 2>/dev/null
+"$1" echo ${HOME} awk echo readonly &&
+		${HOME} "$@" awk sed local local sed then readonly
+	"$1" 'quoted text' "$@" "$@" done awk /usr/bin sed grep local printf
+	sed "$@" then sed readonly x=1 && sed test --verbose printf "$@" "$@" 2>/dev/null
+'quoted text' ${HOME} then 'quoted text' grep then awk test
+sed | awk sed done /usr/bin
+		$(pwd) echo echo then test | | readonly --verbose "$1" echo export 'quoted text'
+	"$1" | export --verbose printf export grep | -eu awk x=1 cd "$@" readonly test
+printf local 'quoted text' echo cd x=1 test $(pwd) "$@" grep 2>/dev/null -eu local
+		sed | $(pwd) then 2>/dev/null x=1 awk "$@" export cd echo "$@" "$@"
+		x=1 cd --verbose "$@" 'quoted text' awk ${HOME} export && | echo
+	echo grep done echo $(pwd)
+-eu 'quoted text' /usr/bin sed awk sed export "$1" local echo
+		-eu local 'quoted text' test
+local cd printf | ${HOME} x=1 then export
+test $(pwd) 2>/dev/null "$1" printf export $(pwd) &&
+	cd 2>/dev/null readonly cd sed --verbose && && ${HOME} local
+	2>/dev/null /usr/bin $(pwd) test ${HOME} --verbose grep readonly
+"$@" | grep test awk local local
+"$@" /usr/bin "$1" echo awk local cd "$1" x=1 then
+	$(pwd) | sed | export awk 'quoted text' -eu awk
+		sed then test local $(pwd) 2>/dev/null 'quoted text' export ${HOME}
+	"$@" grep printf $(pwd) awk
+${HOME} "$1" then $(pwd) echo
+	${HOME} export test $(pwd) export "$1" grep
+grep awk grep then local
+		done printf grep ${HOME} grep "$@" ${HOME}
+		-eu readonly -eu echo echo
+		local grep export readonly ${HOME}
+	local sed printf echo cd x=1 done "$@" $(pwd) printf grep -eu "$@" test
+$(pwd) printf --verbose "$1" done | cd | export then
+awk "$@" local cd sed printf
+| sed echo ${HOME} test 'quoted text' cd /usr/bin
+		/usr/bin x=1 sed | echo printf 'quoted text' sed done /usr/bin 'quoted text'
+		grep ${HOME} export 'quoted text' $(pwd) awk sed 2>/dev/null x=1 sed
+	then grep "$1" then done $(pwd) export readonly x=1
+		'quoted text' x=1 ${HOME} x=1 cd printf test done awk local "$@" "$1" --verbose
+	-eu test -eu "$@" 2>/dev/null
+		cd done then --verbose export then
+cd test 'quoted text' "$@" 'quoted text' echo | "$1" 'quoted text' x=1 grep x=1
+test done cd $(pwd) "$@" export 'quoted text' grep sed
+		"$1" cd x=1 /usr/bin x=1 x=1 'quoted text' $(pwd) "$@" "$1" $(pwd) 2>/dev/null
+$(pwd) && test x=1 echo x=1 awk cd sed &&
+awk test test x=1 -eu export -eu grep /usr/bin test awk
+	'quoted text' sed printf printf --verbose
+	'quoted text' -eu awk x=1 grep echo -eu 2>/dev/null sed echo cd export --verbose
+$(pwd) export --verbose -eu sed done sed sed cd x=1 grep 'quoted text' done
+	'quoted text' test | sed
+	2>/dev/null $(pwd) $(pwd) printf
+-eu "$@" cd printf awk awk && /usr/bin "$@" | x=1 grep done ${HOME}
+	printf --verbose -eu 2>/dev/null /usr/bin cd ${HOME} cd
+	cd ${HOME} x=1 && "$1" /usr/bin printf | readonly local then && sed
+	/usr/bin "$@" x=1 x=1 printf sed ${HOME} export awk && sed x=1 readonly
+		'quoted text' sed --verbose 2>/dev/null ${HOME} /usr/bin --verbose x=1 -eu
+	awk test done readonly ${HOME} 'quoted text' done && echo x=1 export
+		readonly | sed sed export
+	x=1 x=1 local && local local awk && --verbose done /usr/bin
+	export x=1 --verbose local $(pwd) --verbose export 'quoted text' cd "$1"
+		printf && 2>/dev/null ${HOME} grep $(pwd) "$1" | && /usr/bin 'quoted text'
+		-eu /usr/bin done --verbose "$@" readonly --verbose readonly "$@"
+-eu && x=1 then printf
+/usr/bin test ${HOME} 'quoted text' $(pwd) --verbose -eu awk "$1" grep
+$(pwd) -eu && cd 2>/dev/null $(pwd) export --verbose cd sed then test test printf
+		readonly export "$@" echo | echo "$@" $(pwd) sed 'quoted text' | done readonly ${HOME}
+	sed readonly sed -eu && grep local sed
+done grep | $(pwd) then echo readonly
+echo "$1" done awk readonly "$1" export --verbose ${HOME}
+	"$@" sed --verbose --verbose "$@" cd sed sed printf grep
+	${HOME} awk 2>/dev/null 'quoted text' readonly --verbose
+done awk "$@" $(pwd) "$@" 'quoted text' export grep export
+	2>/dev/null export -eu grep ${HOME} sed done cd 2>/dev/null $(pwd) awk echo
+sed done grep "$1" local $(pwd) grep grep
+		test 'quoted text' printf printf then cd | "$@" 2>/dev/null
+		local "$1" sed -eu $(pwd) "$1" awk printf
+	${HOME} "$@" test "$@" /usr/bin
+		test done sed export "$@" "$@" ${HOME}
+		$(pwd) awk /usr/bin "$1" test then grep --verbose -eu readonly
+x=1 done readonly sed
+		&& --verbose /usr/bin done test /usr/bin 'quoted text' local
+		"$@" /usr/bin test | 2>/dev/null grep readonly ${HOME} $(pwd) && --verbose then
+&& done printf 2>/dev/null && echo "$1" /usr/bin
+		'quoted text' "$@" ${HOME} local "$1" $(pwd) $(pwd) x=1 export echo ${HOME} --verbose
+		echo "$@" grep "$@" "$1" && --verbose /usr/bin sed done | grep grep "$1"
+-eu grep test test cd test sed x=1 --verbose test
+		then 2>/dev/null ${HOME} --verbose
+&& test 'quoted text' done "$1" "$1" sed ${HOME} printf then
+	"$@" /usr/bin echo 'quoted text' printf grep x=1 2>/dev/null echo
+grep "$1" export test x=1 cd && x=1 echo && readonly
+export --verbose x=1 | test
+	2>/dev/null cd readonly test "$@" done $(pwd) local test sed export
+	$(pwd) -eu echo done | --verbose
+/usr/bin && grep awk ${HOME} --verbose
+		'quoted text' 'quoted text' awk
+	-eu ${HOME} 2>/dev/null | ${HOME} $(pwd)
+	sed x=1 export | x=1 awk export
+	"$@" $(pwd) readonly && "$@" local export $(pwd) test 'quoted text'
+/usr/bin done cd 2>/dev/null 2>/dev/null done cd
+then -eu sed --verbose x=1 readonly 'quoted text' ${HOME} ${HOME} 'quoted text'
+	&& echo printf -eu local 2>/dev/null grep ${HOME} printf
+$(pwd) export --verbose done -eu grep sed 'quoted text'
+&& 'quoted text' | --verbose
+		test echo then --verbose readonly done
+		readonly && | sed 2>/dev/null /usr/bin "$@" --verbose echo
+sed export x=1 "$@" /usr/bin -eu done sed awk
+test test --verbose export then /usr/bin then $(pwd)
+-eu --verbose done printf ${HOME} ${HOME} && cd sed grep && printf grep
+		&& && x=1 /usr/bin grep "$@" "$1" --verbose grep
+2>/dev/null 2>/dev/null grep grep
+		'quoted text' && local then test export $(pwd) ${HOME} "$1"
+	$(pwd) test $(pwd) -eu "$@" export --verbose echo
+	cd -eu /usr/bin test -eu done "$1" grep printf grep 'quoted text' | awk awk
+	'quoted text' $(pwd) "$1" echo local cd sed | sed test ${HOME} "$@" "$@"
+2>/dev/null ${HOME} | echo awk readonly awk /usr/bin done $(pwd) cd export $(pwd)
+		printf printf grep && echo &&
+echo printf && grep sed then /usr/bin echo done "$1" awk ${HOME}
+	'quoted text' done then done printf --verbose
+${HOME} echo done | then printf
+export && done echo cd | test cd readonly --verbose
+local export cd then cd
+&& "$@" awk -eu && $(pwd) sed 2>/dev/null
+		readonly then readonly export export test "$@" cd test "$@" | ${HOME}
+$(pwd) readonly awk --verbose
+		'quoted text' echo done grep "$1" ${HOME} $(pwd)
+	export "$1" awk x=1 "$1" then export "$1" /usr/bin -eu
+"$@" then ${HOME} done echo && grep 2>/dev/null x=1
+	$(pwd) --verbose grep test grep --verbose
+	awk 'quoted text' cd --verbose && grep test
+&& x=1 -eu readonly echo readonly local awk /usr/bin test done
+		awk test x=1 $(pwd) | done local | 2>/dev/null x=1 --verbose awk $(pwd)
+test "$@" 'quoted text' export echo 'quoted text' readonly readonly
+'quoted text' local readonly
+	cd local x=1 done 2>/dev/null /usr/bin "$@"
+$(pwd) ${HOME} cd then -eu cd grep test cd readonly local cd sed
+local -eu sed local "$1" 2>/dev/null
+	test ${HOME} $(pwd) ${HOME}
+	2>/dev/null /usr/bin --verbose 'quoted text' && && "$@"
+-eu x=1 readonly done printf done awk sed 'quoted text'
+echo ${HOME} printf x=1 local
+		&& echo sed 'quoted text' && done 'quoted text'
+		grep | | test grep | test "$@"
+	x=1 cd export readonly printf 'quoted text' && ${HOME}
+test && awk sed $(pwd) -eu done then 2>/dev/null /usr/bin printf $(pwd) $(pwd)
+/usr/bin 'quoted text'
+awk --verbose readonly ${HOME} && done "$@" export echo
+		then && 'quoted text' echo 'quoted text'
+printf local cd | done echo /usr/bin done "$1" 2>/dev/null $(pwd) | readonly
+$(pwd) --verbose export $(pwd) $(pwd) "$@" done done ${HOME} /usr/bin /usr/bin
+		&& echo grep done local local --verbose /usr/bin sed grep 2>/dev/null $(pwd) cd
+		--verbose /usr/bin $(pwd) done $(pwd) readonly
+	"$@" -eu "$1" then -eu sed readonly
+		| printf $(pwd) cd 2>/dev/null echo "$@" /usr/bin "$@" "$@" 'quoted text'
+	sed echo x=1 "$1" local local x=1 sed export awk &&
+cd && "$@" done echo cd "$@" sed 'quoted text'
+		"$1" awk "$@" ${HOME} /usr/bin $(pwd) $(pwd) done ${HOME} local
+		| 2>/dev/null --verbose grep
+echo cd cd --verbose awk | export --verbose
+		$(pwd) x=1 x=1 /usr/bin done test grep
+sed && $(pwd) done done --verbose echo awk | /usr/bin
+		sed export "$@" local printf --verbose 'quoted text' "$1" readonly && then
+grep 2>/dev/null x=1 sed done test /usr/bin | readonly "$@" grep printf "$@"
+x=1 test --verbose then then grep readonly && then
+		grep ${HOME} $(pwd) readonly $(pwd) echo 2>/dev/null done printf --verbose
+		${HOME} cd ${HOME} && 2>/dev/null awk 'quoted text' export $(pwd) &&
+"$@" sed echo printf
+		"$1" sed export "$1" /usr/bin $(pwd) /usr/bin grep 2>/dev/null
+--verbose "$@" 'quoted text' printf --verbose | grep awk readonly
+sed echo printf done ${HOME}
+	--verbose 'quoted text' then readonly
+		grep ${HOME} grep /usr/bin "$@" --verbose
+	then awk ${HOME} local | 'quoted text'
+		test "$1" $(pwd) readonly $(pwd)
+	"$@" && readonly cd readonly printf local export readonly done 'quoted text'
+		test ${HOME} 2>/dev/null readonly 2>/dev/null grep x=1 | 'quoted text' local
+	cd awk export echo "$1" awk 'quoted text' cd echo grep
+		&& -eu $(pwd) 'quoted text' x=1 then
+sed --verbose "$1" printf --verbose
+/usr/bin --verbose /usr/bin && printf "$@"
+		awk 2>/dev/null x=1 "$1" "$@" cd
+done | -eu grep printf local export cd
+	| /usr/bin local done && ${HOME} local --verbose test awk grep "$@" 2>/dev/null
+		-eu && -eu sed --verbose --verbose local awk && test done done -eu export local
+	&& "$@" x=1 done 2>/dev/null && 2>/dev/null then x=1 sed export x=1 sed | "$@"
+done /usr/bin done cd
+	-eu export "$@" 'quoted text' $(pwd) $(pwd) cd sed /usr/bin
+then $(pwd) test | 'quoted text' printf
+		export echo ${HOME} 2>/dev/null
+2>/dev/null -eu awk grep | printf | --verbose printf
+test 'quoted text' 'quoted text' export /usr/bin done test 'quoted text' done
+		${HOME} grep x=1 ${HOME} 2>/dev/null
+		| echo done export && $(pwd) && | | cd
+	echo $(pwd) x=1 test test then
+--verbose 2>/dev/null && x=1 -eu x=1 export && --verbose test
+		then ${HOME} echo x=1 x=1 $(pwd) $(pwd) printf readonly then local export
+		grep grep test printf -eu echo export printf cd --verbose local echo -eu cd
+x=1 grep && then then readonly ${HOME} "$@" | 'quoted text' ${HOME} export then
+		printf test 'quoted text' --verbose printf export $(pwd) cd echo export
+&& grep cd echo && readonly grep -eu printf test 'quoted text' awk echo 'quoted text'
+| sed readonly | 2>/dev/null
+export export cd export done readonly
+	test done && done then $(pwd) "$1" done cd done "$1" cd done
+		done --verbose echo sed | echo | 2>/dev/null
+		local -eu readonly $(pwd) printf export &&
+		"$1" done then cd -eu "$1" /usr/bin 2>/dev/null
+		cd x=1 printf --verbose
+x=1 echo readonly && /usr/bin awk "$1" --verbose
+		'quoted text' local then export printf readonly cd test
+		"$1" local && then ${HOME} readonly "$@" $(pwd) done done 'quoted text' done cd
+--verbose /usr/bin grep $(pwd) $(pwd) | test $(pwd) local && then
+	/usr/bin 'quoted text' "$@" grep x=1
+	'quoted text' printf -eu 2>/dev/null -eu /usr/bin local
+		sed awk export printf "$1" -eu readonly "$1" printf /usr/bin x=1 ${HOME} 2>/dev/null
+		-eu sed && printf --verbose 2>/dev/null awk --verbose
+		x=1 then 2>/dev/null "$1" echo done $(pwd) x=1 test awk 2>/dev/null
+		awk | then | 2>/dev/null | --verbose export /usr/bin
+		$(pwd) grep then 'quoted text' && "$1" x=1 export
+-eu --verbose then cd grep echo sed --verbose "$1" --verbose
+		grep cd awk -eu done sed local grep export x=1 awk /usr/bin
+	cd grep --verbose && printf export test "$@" test
+		test grep x=1 grep grep echo printf --verbose
+		$(pwd) grep grep grep test
+		--verbose test export -eu --verbose local local 'quoted text'
+		then readonly "$@" echo grep -eu awk export ${HOME} 'quoted text' test x=1
+--verbose echo readonly /usr/bin 2>/dev/null -eu cd echo -eu -eu | x=1
+	"$@" awk && --verbose "$@" then "$@" "$1" x=1 readonly
+	| -eu && | "$1" done awk grep 2>/dev/null /usr/bin x=1 grep test 'quoted text'
+		--verbose grep $(pwd) sed printf "$@" test test 2>/dev/null ${HOME} grep
+		$(pwd) awk /usr/bin /usr/bin -eu readonly printf ${HOME} test --verbose "$@"
+	then -eu 'quoted text' done sed test $(pwd) "$1" export
+		'quoted text' test x=1 && ${HOME}
+--verbose done done x=1 "$1" --verbose 'quoted text' && --verbose --verbose
+		${HOME} awk --verbose "$1" && then sed printf cd cd ${HOME} /usr/bin $(pwd) grep
+done 'quoted text' sed
+	grep && /usr/bin then sed 2>/dev/null
+$(pwd) readonly sed printf grep printf done test | | test readonly 2>/dev/null
+test grep export readonly --verbose 2>/dev/null
+		cd cd grep 'quoted text' x=1 --verbose && then done $(pwd) x=1 | grep x=1
+	| printf cd echo readonly "$@" sed export "$@"
+		-eu local done grep "$1" /usr/bin ${HOME} /usr/bin $(pwd) "$1" x=1 awk 'quoted text'
+	sed echo ${HOME} /usr/bin done printf 'quoted text' then
+		printf -eu grep && "$1" export "$1" readonly test --verbose
+	sed -eu x=1 echo && | && "$1" awk x=1 2>/dev/null -eu
+		${HOME} "$@" then cd then
+	$(pwd) 2>/dev/null cd -eu -eu test "$1" sed then 'quoted text'
+printf 'quoted text' x=1 done echo 2>/dev/null --verbose then
+		done printf sed "$1" sed done -eu done then then
+	readonly test 'quoted text' grep done --verbose
+		local x=1 awk "$1" export x=1 local ${HOME} $(pwd) test
+		-eu $(pwd) x=1 then x=1 "$@" then then export 2>/dev/null $(pwd) --verbose
+	x=1 "$1" "$@" echo cd readonly 'quoted text' awk sed sed awk
+local done grep sed sed --verbose
+&& done echo /usr/bin readonly /usr/bin done local /usr/bin
+test ${HOME} | | --verbose "$1" | echo readonly then done
+		then $(pwd) sed 'quoted text' echo x=1 done grep test ${HOME} /usr/bin
+	echo "$@" then 2>/dev/null
+		sed printf 2>/dev/null cd
+	awk then test $(pwd) 'quoted text' --verbose && $(pwd)
+	test done printf /usr/bin --verbose x=1 export awk sed printf cd then sed
+	local -eu then | cd echo test cd test "$@" ${HOME}
+	-eu readonly test printf "$@" awk awk awk printf
+sed 2>/dev/null -eu | "$1" printf $(pwd) /usr/bin "$1"
+	&& x=1 ${HOME} then "$1" x=1 /usr/bin | | /usr/bin export export 'quoted text'
+export done && /usr/bin local awk test readonly
+		echo 2>/dev/null ${HOME} echo && printf -eu | x=1 then printf sed test
+		export x=1 -eu printf 2>/dev/null x=1 grep awk --verbose cd printf grep local 'quoted text'
+		&& readonly ${HOME} | "$@" "$@" | then then 2>/dev/null 'quoted text'
+test export done 2>/dev/null readonly 'quoted text' $(pwd) test
+readonly 'quoted text' local echo
+		"$@" $(pwd) export ${HOME} $(pwd) "$1" $(pwd) x=1 ${HOME} then echo then awk
+	readonly then && echo printf | "$1" /usr/bin ${HOME} /usr/bin local | /usr/bin
+	-eu /usr/bin export 2>/dev/null /usr/bin
+echo && $(pwd) 'quoted text' echo
+&& echo | --verbose ${HOME} /usr/bin 'quoted text'
+		"$@" ${HOME} readonly -eu printf
+printf "$@" sed $(pwd) && && && $(pwd) then sed "$@"
+export local echo then local cd && awk readonly -eu awk printf
+	'quoted text' "$1" sed cd
+$(pwd) local test "$1" echo cd ${HOME}
+cd then ${HOME} ${HOME} printf
+--verbose "$@" 2>/dev/null && --verbose
+	done /usr/bin && $(pwd) x=1 /usr/bin sed 'quoted text' echo readonly
+		x=1 done then "$1" ${HOME} then -eu 'quoted text' 'quoted text'
+grep && && /usr/bin printf "$@" | --verbose
+	printf | cd "$@" && grep 2>/dev/null
+		$(pwd) /usr/bin ${HOME} "$1" "$@" export local printf done local
+	readonly /usr/bin | then /usr/bin $(pwd) cd cd ${HOME}
+		2>/dev/null sed awk && 'quoted text' 'quoted text' 2>/dev/null awk cd local
+		echo echo && --verbose x=1 'quoted text' "$1" readonly && grep /usr/bin | ${HOME}
+	awk sed | 2>/dev/null $(pwd) local echo then /usr/bin --verbose grep then
+export local 2>/dev/null ${HOME}
+export sed readonly 2>/dev/null --verbose "$1" ${HOME} cd sed "$@" 'quoted text'
+	x=1 'quoted text' --verbose x=1 then -eu test sed then echo export sed
+		echo then export sed ${HOME} awk x=1 echo -eu readonly then x=1 printf | | /usr/bin
+--verbose 'quoted text' then echo --verbose
+		'quoted text' readonly
+/usr/bin echo local $(pwd) echo
+	--verbose printf readonly done
+	"$@" echo ${HOME} $(pwd) && /usr/bin 'quoted text' -eu -eu -eu 'quoted text'
+	echo printf && printf /usr/bin readonly export "$@"
+		'quoted text' printf ${HOME} "$1" | "$@" readonly
+local && && "$@" printf cd --verbose grep && cd --verbose
+		local export | 2>/dev/null done local export
+local "$1" ${HOME} test export readonly then readonly
+		$(pwd) "$@" && then "$1" x=1 local
+	$(pwd) export awk echo 2>/dev/null
+		test --verbose test then export ${HOME} $(pwd) -eu "$1" && sed "$1" ${HOME} 2>/dev/null
+		done export x=1 sed "$@" x=1 ${HOME} test "$@" $(pwd)
+		"$1" "$1" awk 'quoted text' x=1 2>/dev/null --verbose
+&& 'quoted text' $(pwd)
+	| 'quoted text' export /usr/bin --verbose
+	${HOME} x=1 cd --verbose echo printf | local awk cd done
+	grep sed readonly awk && export grep done done 2>/dev/null printf cd --verbose
+export cd 2>/dev/null printf "$1" "$@" awk
+printf | export | "$1" ${HOME} awk echo | /usr/bin test sed export done
+echo awk test cd | cd --verbose ${HOME} --verbose "$@" -eu && "$@" "$@"
+		x=1 then then "$1" done | printf test printf export /usr/bin 'quoted text'
+		cd -eu printf --verbose printf
+	--verbose -eu then grep
+		cd --verbose test echo export 2>/dev/null
+		printf grep /usr/bin sed --verbose /usr/bin "$@" cd then sed 2>/dev/null
+	then /usr/bin cd sed then
+	"$@" sed printf then sed | /usr/bin grep | grep
+		${HOME} local 2>/dev/null readonly readonly echo /usr/bin
+	done $(pwd) "$@" ${HOME} "$1" test
+	test | --verbose test readonly cd "$@" "$1" /usr/bin 'quoted text'
+grep | --verbose then test export
+		echo 'quoted text' 2>/dev/null --verbose /usr/bin 2>/dev/null cd 'quoted text'
+		"$1" ${HOME} export /usr/bin | done cd grep 2>/dev/null local "$1"
+	local then x=1 --verbose ${HOME} | -eu x=1 export export
+	--verbose awk export ${HOME} then && echo
+	readonly 2>/dev/null local
+test grep /usr/bin x=1 'quoted text'
+		2>/dev/null "$@" --verbose -eu 2>/dev/null
+done local then "$@" export --verbose done $(pwd) | then readonly grep export
+	awk readonly -eu && 'quoted text' test $(pwd) printf
+		local printf -eu echo x=1
+x=1 printf readonly printf echo "$@" "$@" local ${HOME} 'quoted text'
+"$1" grep && sed 'quoted text' export readonly 2>/dev/null
+	/usr/bin x=1 cd sed "$@" "$@" "$@" printf echo -eu 'quoted text'
+then grep | -eu /usr/bin done local export | readonly 2>/dev/null "$1"
+		"$@" sed $(pwd) "$1" /usr/bin -eu awk sed cd grep x=1 readonly cd cd "$1" then
+	echo "$@" printf "$1" 2>/dev/null then -eu x=1 then
+	'quoted text' cd grep -eu && done --verbose then local readonly then done |
+"$1" printf --verbose $(pwd) && printf
+	echo 2>/dev/null "$@" done cd export 2>/dev/null local 'quoted text'
+		| awk && x=1 x=1 $(pwd) $(pwd) "$@" && grep export 'quoted text'
+	'quoted text' $(pwd) /usr/bin -eu /usr/bin
+		/usr/bin cd readonly echo awk $(pwd) --verbose local test
+		done x=1 echo "$1" x=1 2>/dev/null cd readonly sed
+	/usr/bin export x=1 readonly x=1
+/usr/bin 2>/dev/null printf "$@" export awk /usr/bin awk sed | 'quoted text'
+		2>/dev/null local awk test | grep 'quoted text' sed test -eu sed 2>/dev/null
+	| 'quoted text' local && readonly done readonly readonly $(pwd)
+$(pwd) -eu done ${HOME} x=1 sed
+		awk | "$1" printf && local | | cd done cd x=1 $(pwd) 2>/dev/null done | readonly
+	"$1" export cd test x=1 done done
+test awk readonly local /usr/bin ${HOME} test awk echo 2>/dev/null 'quoted text'
+	then ${HOME} test then export awk $(pwd) then export 'quoted text'
+"$@" cd test "$@" cd awk -eu | ${HOME} then printf /usr/bin && done && test cd &&
+cd "$1" $(pwd) | awk export
+	${HOME} printf printf test test awk "$1" printf && done
+	2>/dev/null /usr/bin cd export cd $(pwd) printf awk x=1 cd done -eu
+grep then grep test --verbose | test local --verbose echo --verbose
+		/usr/bin done echo echo $(pwd) | 2>/dev/null
+	local $(pwd) --verbose readonly
+		test "$1" printf x=1 readonly 2>/dev/null cd printf x=1 then 2>/dev/null grep
+readonly then 2>/dev/null then sed $(pwd) /usr/bin ${HOME} x=1 'quoted text'
+	| grep readonly echo then cd /usr/bin "$1"
+export -eu /usr/bin awk --verbose
+		$(pwd) --verbose grep export grep sed "$1" then local then 2>/dev/null
+/usr/bin "$@" -eu "$@" cd readonly then then echo test sed 'quoted text' 'quoted text'
+-eu local 'quoted text'
+		awk printf ${HOME} 2>/dev/null awk 2>/dev/null ${HOME} "$@"
+	x=1 echo echo then | | 2>/dev/null x=1 test "$@"
+	echo && awk "$@" 'quoted text' $(pwd) 'quoted text' local
+cd printf grep export test /usr/bin echo
+		| test | ${HOME} x=1
+		printf local awk "$1" --verbose awk --verbose sed readonly && local
+		&& -eu "$@" /usr/bin ${HOME} awk local && "$@" /usr/bin ${HOME} awk
+	local --verbose done cd sed ${HOME} "$@" 'quoted text' -eu done $(pwd)
+export awk 2>/dev/null awk
+${HOME} x=1 'quoted text' cd
+		2>/dev/null local printf awk local -eu &&
+"$1" echo echo $(pwd) && export
+	readonly grep && then
+	echo export "$1" x=1 /usr/bin grep /usr/bin 2>/dev/null | 'quoted text'
+	cd test echo /usr/bin local x=1 done -eu export then readonly "$1" -eu -eu && /usr/bin
+		| -eu export cd sed "$@" --verbose
+	printf && local 'quoted text' ${HOME} --verbose -eu done cd test
+		'quoted text' cd test awk export 'quoted text' local echo --verbose
+x=1 $(pwd) | sed export 2>/dev/null
+echo test grep printf 'quoted text' -eu local 2>/dev/null echo "$@" 'quoted text'
+then echo awk "$@" 2>/dev/null
+		/usr/bin "$1" ${HOME} cd cd
+		'quoted text' done x=1 then && export awk | cd awk sed
+--verbose printf && awk 'quoted text' printf /usr/bin export sed
+2>/dev/null done "$@" awk "$1" grep -eu 'quoted text' --verbose then 2>/dev/null
+then "$1" 2>/dev/null test export --verbose then 2>/dev/null printf
+		'quoted text' "$1" x=1 then export
+export 'quoted text' local done "$1"
+x=1 ${HOME} printf x=1
+		&& -eu ${HOME} -eu echo readonly "$1" local ${HOME} export /usr/bin
+	$(pwd) --verbose && then test awk readonly 2>/dev/null --verbose grep "$1" x=1
+--verbose echo test cd 'quoted text' readonly 'quoted text'
+		x=1 readonly printf --verbose $(pwd) "$@" ${HOME}
+		export awk "$@" /usr/bin /usr/bin printf done local done then -eu
+&& $(pwd) echo /usr/bin local $(pwd) | local then x=1 test echo export grep "$@"
+		printf "$1" readonly cd ${HOME}
+--verbose printf --verbose then
+		cd | -eu x=1 $(pwd) x=1 grep --verbose $(pwd) && $(pwd) | done done
+	awk 'quoted text' awk 2>/dev/null
+cd && grep --verbose "$1" printf "$@" x=1 export $(pwd) awk
+		local echo printf 2>/dev/null echo test cd export
+		/usr/bin "$1" local 2>/dev/null 2>/dev/null x=1 $(pwd) 'quoted text'
+	readonly /usr/bin -eu x=1 test cd /usr/bin -eu $(pwd) -eu --verbose x=1
+	then "$1" echo ${HOME}
+--verbose $(pwd) | && sed ${HOME} $(pwd) awk cd && done
+		"$1" local echo awk ${HOME} ${HOME} echo test &&
+		export "$@" ${HOME} "$@" test then sed | grep | then
+	echo awk 2>/dev/null "$@" echo grep done --verbose
+		--verbose local "$@" local "$1" "$1" awk x=1 echo grep "$@"
+		2>/dev/null 2>/dev/null test then test ${HOME}
+	"$@" awk printf "$1" then printf echo 'quoted text' | printf
+	-eu -eu done export "$@" grep grep && done sed echo | export export sed echo
+		printf x=1 grep x=1 | local && readonly "$1" done
+printf && test test grep export
+	grep then cd "$@" $(pwd) then grep /usr/bin done printf "$@" test test
+	| readonly --verbose 2>/dev/null && then sed sed && sed $(pwd) grep ${HOME}
+		local sed /usr/bin "$@" -eu 'quoted text' readonly echo -eu done && export -eu
+'quoted text' "$1" -eu 'quoted text' grep -eu readonly 'quoted text'
+		${HOME} $(pwd) --verbose
+		grep cd x=1 "$1" --verbose 2>/dev/null
+$(pwd) $(pwd) $(pwd) then
+	${HOME} test ${HOME} | cd $(pwd) "$@" echo 'quoted text'
+	"$@" local ${HOME} cd --verbose 2>/dev/null ${HOME} sed x=1 -eu |
+	sed sed echo "$1" cd printf /usr/bin "$@" printf /usr/bin awk cd awk
+		test 'quoted text' grep local local "$1" ${HOME}
+echo printf --verbose echo --verbose
+	"$1" x=1 cd awk export x=1 "$1" 'quoted text' sed printf
+	printf printf $(pwd) 2>/dev/null x=1 then test
+	'quoted text' 'quoted text'
+		&& && /usr/bin echo readonly sed ${HOME} test 2>/dev/null -eu
+&& local cd echo --verbose
+--verbose then local cd $(pwd) -eu echo echo cd "$@" -eu done 'quoted text'
+		"$1" -eu "$1" 'quoted text' 2>/dev/null done sed ${HOME}
+test -eu done printf x=1 export then /usr/bin
+		/usr/bin && echo printf | | sed | 'quoted text' awk "$@" && sed "$@" test
+	| "$@" --verbose cd grep 2>/dev/null
+	${HOME} grep done sed local test
+/usr/bin && awk export -eu cd sed && printf
+2>/dev/null "$1" printf ${HOME} awk -eu 'quoted text' -eu grep then grep
+sed done -eu 2>/dev/null cd done export | export -eu printf
+		export test x=1 /usr/bin "$@" "$@" export readonly
+	test readonly sed --verbose export --verbose
+	grep readonly readonly echo x=1 | 2>/dev/null sed "$@" | 2>/dev/null --verbose
+	| awk 'quoted text' /usr/bin
+&& 2>/dev/null x=1 sed | /usr/bin $(pwd) -eu && /usr/bin local && x=1 -eu ${HOME}
+export | awk && sed $(pwd) printf printf
+		| $(pwd) sed then local local 'quoted text' && then /usr/bin
+		x=1 $(pwd) ${HOME} test -eu awk readonly echo test /usr/bin && readonly 'quoted text'
+	cd --verbose printf 'quoted text' | /usr/bin then
+/usr/bin awk ${HOME} done test && -eu
+cd grep cd --verbose local
+	local sed readonly export done ${HOME} grep echo local cd awk 2>/dev/null echo
+		$(pwd) then test ${HOME}
+	cd && export --verbose done "$1"
+$(pwd) $(pwd) export && sed "$1" sed
+then | cd cd "$@" ${HOME} grep $(pwd) local readonly x=1 -eu 2>/dev/null $(pwd)
+	--verbose awk local ${HOME} export ${HOME} 2>/dev/null $(pwd)
+		'quoted text' x=1 cd awk grep grep
+		test $(pwd) 'quoted text' ${HOME} done
+		done echo ${HOME} x=1 done
+	done echo /usr/bin done readonly printf 2>/dev/null
+2>/dev/null 2>/dev/null then "$@" cd awk grep then export /usr/bin 'quoted text'
+		test $(pwd) $(pwd) 'quoted text' ${HOME} done 2>/dev/null 2>/dev/null
+		then then x=1 local done 2>/dev/null
+		cd -eu "$@" $(pwd) then | awk | &&
+		test echo -eu 'quoted text' readonly ${HOME}
+		| | sed printf "$1" done 2>/dev/null test export
+2>/dev/null 2>/dev/null && -eu export echo
+then echo export /usr/bin /usr/bin local awk "$1" test 2>/dev/null
+test done cd printf ${HOME} awk x=1 | && then --verbose 'quoted text'
+echo local done /usr/bin printf export $(pwd)
+		local 2>/dev/null export | /usr/bin then then | echo
+"$@" cd ${HOME} ${HOME} --verbose readonly "$@" /usr/bin "$@" $(pwd)
+	$(pwd) ${HOME} printf "$@" --verbose
+		"$@" --verbose local printf export test sed && "$1" readonly
+2>/dev/null 2>/dev/null "$1" test export grep "$1" -eu grep local x=1 then
+	echo printf "$@" readonly awk sed /usr/bin test 'quoted text' 'quoted text'
+	/usr/bin echo && ${HOME} printf echo test echo 2>/dev/null
+	awk -eu awk cd $(pwd) /usr/bin readonly $(pwd) export
+		grep printf cd 2>/dev/null --verbose
+	grep && readonly -eu /usr/bin printf local "$@" &&
+	2>/dev/null 2>/dev/null $(pwd) --verbose
+--verbose $(pwd) cd export sed 'quoted text'
+	sed readonly "$1" awk 2>/dev/null readonly
+		export export awk --verbose
+$(pwd) $(pwd) 'quoted text' && && done 2>/dev/null ${HOME} | done 2>/dev/null
+	${HOME} then grep cd 2>/dev/null
+	-eu /usr/bin "$1" done -eu echo export $(pwd) && printf | done --verbose 'quoted text'
+	&& 2>/dev/null /usr/bin 'quoted text' grep readonly
+	awk awk 2>/dev/null 2>/dev/null
+		local 'quoted text' done export
+/usr/bin --verbose 'quoted text' readonly done then ${HOME}
+	done export "$1" -eu -eu grep export local
+readonly $(pwd) printf
+"$@" export awk grep $(pwd) --verbose --verbose echo grep "$@"
+	x=1 "$1" /usr/bin &&
+	&& $(pwd) --verbose done then x=1 $(pwd) cd /usr/bin -eu printf ${HOME}
+x=1 $(pwd) "$@" $(pwd) $(pwd) "$1" 2>/dev/null
+printf awk readonly printf printf --verbose 'quoted text' ${HOME} "$1" && cd
+		-eu readonly local printf readonly 'quoted text'
+		-eu | && ${HOME} test "$1" awk "$@" && then
+local x=1 $(pwd) readonly -eu sed
+	| echo export 'quoted text' echo printf 2>/dev/null x=1 && "$1" ${HOME}
+x=1 "$@" printf echo "$1" sed --verbose cd |
+		$(pwd) -eu --verbose ${HOME} && | readonly sed 2>/dev/null printf && --verbose
+echo then echo local "$1" 2>/dev/null echo done done then readonly then
+		"$1" "$1" echo cd /usr/bin echo cd export | 'quoted text'
+/usr/bin printf printf echo 2>/dev/null "$1" /usr/bin
+		done "$1" awk -eu printf ${HOME} local done 2>/dev/null $(pwd)
+		--verbose readonly /usr/bin -eu | $(pwd) local --verbose grep printf 'quoted text'
+cd test awk awk cd cd | local done && && awk && printf
+readonly done 2>/dev/null test printf awk 'quoted text' cd $(pwd)
+	2>/dev/null "$@" cd readonly then x=1 awk readonly
+	then | test /usr/bin awk then then x=1 done done ${HOME}
+	test printf /usr/bin | 2>/dev/null
+	sed export echo local ${HOME}
+"$@" x=1 awk printf 'quoted text' printf done 'quoted text' "$@"
+	| readonly export sed export
+		printf grep /usr/bin local | echo printf grep --verbose printf
+		echo /usr/bin echo readonly printf | local -eu awk
+	awk $(pwd) export "$@" cd &&
+	echo 'quoted text' "$@" then
+		"$@" awk --verbose 2>/dev/null grep printf local 'quoted text' echo -eu x=1 x=1
+	test "$1" test cd awk "$@" then export printf
+	/usr/bin then ${HOME} $(pwd)
+	test readonly && then x=1 local printf $(pwd) done then && 'quoted text'
+readonly awk local local
+| then sed ${HOME} readonly local "$@" export ${HOME} 'quoted text'
+	&& done x=1 ${HOME} "$1" export /usr/bin test grep cd
+test && readonly x=1 'quoted text' echo
+	grep then -eu then grep /usr/bin then 2>/dev/null export local
+local then local 'quoted text' ${HOME} done then --verbose echo
+x=1 | awk readonly export awk echo test local then
+$(pwd) sed readonly cd then "$@" x=1 echo readonly
+'quoted text' 2>/dev/null export test 'quoted text'
+		local cd 'quoted text' | readonly 2>/dev/null echo $(pwd) test awk ${HOME}
+	done && $(pwd) /usr/bin 'quoted text' then grep ${HOME} && sed --verbose cd
+	local x=1 sed -eu $(pwd) echo 2>/dev/null cd export /usr/bin sed | ${HOME}
+x=1 echo readonly | done export
+$(pwd) readonly /usr/bin /usr/bin done "$1"
+then && /usr/bin | -eu test ${HOME}
+-eu then x=1 cd | test awk --verbose "$@" local test awk export
+	then 'quoted text' 2>/dev/null && local
+		then "$@" test --verbose readonly -eu readonly "$1" 'quoted text' test done done
+		'quoted text' x=1 && awk 'quoted text' then --verbose 2>/dev/null x=1 grep
+	grep ${HOME} && 2>/dev/null 2>/dev/null done "$1" awk done test
+	awk readonly test awk ${HOME} 'quoted text' printf $(pwd) /usr/bin cd --verbose
+cd 2>/dev/null /usr/bin done export readonly ${HOME} "$@" "$1" local
+sed readonly test grep $(pwd) done awk done done awk
+		"$@" grep awk 2>/dev/null "$@" && /usr/bin "$1" -eu local
+done awk 2>/dev/null && echo readonly 'quoted text'
+		awk 2>/dev/null ${HOME} echo sed readonly awk readonly /usr/bin
+#include c74.sh
+		"$1" readonly ${HOME} ${HOME} 'quoted text' | /usr/bin /usr/bin
+	$(pwd) export --verbose printf
+		export $(pwd) --verbose awk awk local test awk done
+		2>/dev/null grep -eu 2>/dev/null sed "$@" done cd export
+		grep ${HOME} then awk done x=1 -eu done | grep
+		then "$1" sed $(pwd) readonly
+	readonly 2>/dev/null -eu --verbose "$1" /usr/bin test
+2>/dev/null 2>/dev/null local grep "$1" awk | --verbose
+		x=1 awk awk readonly "$@" && readonly --verbose local x=1 -eu local | /usr/bin
+	&& x=1 x=1 done "$@" ${HOME} -eu
+		readonly /usr/bin "$@" done x=1 -eu test awk echo x=1 awk then
+	readonly && test "$@" && sed then "$1" readonly $(pwd) echo 'quoted text'
+sed /usr/bin done x=1 sed done $(pwd)
+	sed grep export 'quoted text' sed grep && echo | "$1"
+		&& awk then echo echo 'quoted text' local then grep export readonly
+	${HOME} /usr/bin x=1 -eu cd && echo ${HOME}
+		${HOME} then readonly "$1"
+		x=1 grep ${HOME} sed | 2>/dev/null /usr/bin
+		'quoted text' then "$1" && printf readonly
+done 2>/dev/null export -eu export "$1" "$@"
+		local 'quoted text' local awk test ${HOME} /usr/bin local cd "$@" 2>/dev/null
+grep then && test --verbose
+readonly | grep /usr/bin done -eu 2>/dev/null && 2>/dev/null
+		| then echo /usr/bin test /usr/bin done 'quoted text' -eu then printf cd /usr/bin
+export | $(pwd) awk sed test test "$1" 2>/dev/null
+${HOME} then "$1" -eu ${HOME} test
+	${HOME} awk printf 'quoted text' -eu then cd x=1 printf /usr/bin
+	"$@" sed | /usr/bin -eu "$@" local local $(pwd)
+then "$1" --verbose test readonly
+	/usr/bin ${HOME} "$@" --verbose 'quoted text' "$@" 2>/dev/null
+	test 'quoted text' $(pwd)
+		awk -eu ${HOME} export
+		grep awk grep "$@" done 2>/dev/null | x=1 | then grep --verbose
+		test sed "$1" "$@" printf
+		'quoted text' --verbose local $(pwd) x=1 echo 2>/dev/null
+	"$@" awk awk then grep "$1" sed $(pwd) "$@" x=1 /usr/bin x=1
+| grep awk x=1 | sed | local test export echo local "$@" 2>/dev/null cd readonly
+	local test 'quoted text' x=1 "$1"
+		&& cd /usr/bin local export readonly /usr/bin 'quoted text'
+'quoted text' $(pwd) -eu cd grep 'quoted text' test grep "$1" test
+		done 2>/dev/null local 2>/dev/null
+test printf $(pwd) grep grep 'quoted text' grep ${HOME}
+		readonly grep test 2>/dev/null x=1 -eu "$1" readonly awk export 2>/dev/null
+	&& cd done x=1 sed printf echo "$1" echo done | then $(pwd) export -eu
+| test --verbose $(pwd) "$1" ${HOME} && local $(pwd) /usr/bin cd printf 2>/dev/null
+		readonly $(pwd) "$@" cd -eu 'quoted text' x=1 test
+done $(pwd) awk /usr/bin grep done --verbose grep export export
+		then /usr/bin then /usr/bin "$1" "$@" "$1" readonly
+		2>/dev/null /usr/bin then /usr/bin "$1" printf
+grep cd then printf printf /usr/bin | x=1 -eu local grep -eu local 'quoted text'
+/usr/bin 'quoted text' /usr/bin readonly $(pwd) printf
+	-eu "$@" "$@" $(pwd) then awk /usr/bin
+	x=1 export && done then --verbose && export "$@" cd readonly -eu && export 'quoted text'
+		sed "$1" then done grep
+		$(pwd) && | test printf
+		done done local printf local sed && grep local readonly cd $(pwd) echo
+		grep -eu $(pwd) sed then | 2>/dev/null
+	2>/dev/null sed done readonly
+	cd sed $(pwd) readonly test "$1" cd | $(pwd) 'quoted text'
+	"$1" then done readonly
+		"$1" done export local printf readonly export -eu awk
+		x=1 readonly /usr/bin printf --verbose printf x=1 echo printf cd |
+	&& awk x=1 $(pwd) ${HOME} echo -eu local done grep --verbose
+done $(pwd) cd "$@" then printf --verbose ${HOME} local &&
+	&& ${HOME} printf cd "$@" cd grep -eu x=1 test awk readonly echo -eu "$@"
+	awk && ${HOME} grep printf "$@" then printf $(pwd) awk awk cd then awk -eu
+	/usr/bin grep $(pwd) "$@" echo then grep grep export echo x=1
+		then test cd printf ${HOME}
+		2>/dev/null /usr/bin -eu sed
+		"$1" ${HOME} readonly local grep 'quoted text'
+		echo x=1 echo awk awk
+	sed -eu ${HOME} "$1" "$1" -eu
+	| grep sed local local cd -eu local --verbose /usr/bin
+readonly -eu awk grep $(pwd) | $(pwd) printf cd
+		x=1 awk | echo ${HOME}
+	-eu && grep "$@" 'quoted text' export done "$@"
+		echo /usr/bin "$@" | ${HOME} then
+x=1 && local | sed "$@" awk
+x=1 sed /usr/bin readonly && 2>/dev/null printf cd cd -eu
+		done sed grep test local then sed echo grep 2>/dev/null
+then | 'quoted text' grep "$@" printf
+		printf "$@" awk then local $(pwd) printf && printf test echo x=1 printf
+	awk /usr/bin test grep grep readonly ${HOME}
+	&& "$@" 'quoted text' ${HOME} -eu export then && then x=1
+	-eu done $(pwd) 2>/dev/null ${HOME} x=1 sed ${HOME} done "$1" $(pwd) then cd
+	test readonly -eu && echo readonly
+		&& && "$@" awk 2>/dev/null |
+		sed awk sed awk printf cd done 2>/dev/null test then cd "$@"
+"$1" x=1 readonly cd x=1 -eu then grep echo ${HOME} ${HOME} done
+	2>/dev/null local cd awk then cd "$@" x=1 readonly -eu readonly test
+	&& ${HOME} --verbose $(pwd) test export echo cd && | then /usr/bin --verbose "$1"
+done local done export "$1" sed --verbose 2>/dev/null then readonly test "$@"
+done readonly 2>/dev/null echo $(pwd) && "$1" 'quoted text' 2>/dev/null
+export test export && | --verbose printf /usr/bin grep readonly 'quoted text'
+		local then printf --verbose awk printf
+'quoted text' && readonly test echo 2>/dev/null echo "$1" export then
+		-eu -eu readonly && readonly "$@" grep 2>/dev/null printf done test
+		sed /usr/bin 2>/dev/null 2>/dev/null x=1 export x=1 cd -eu local
+"$@" /usr/bin | cd 'quoted text' x=1 /usr/bin export 2>/dev/null
+	echo grep | x=1 && test ${HOME} readonly readonly
+		${HOME} "$@" x=1 sed 2>/dev/null local
+	export sed done $(pwd)
+	grep x=1 sed 'quoted text' x=1 /usr/bin
+sed awk 2>/dev/null export /usr/bin echo --verbose sed $(pwd)
+	${HOME} echo readonly "$@" echo cd -eu $(pwd) x=1 2>/dev/null 'quoted text'
+		-eu --verbose 2>/dev/null
+	'quoted text' --verbose then
+&& sed $(pwd) done -eu | /usr/bin grep readonly -eu printf --verbose then
+cd ${HOME} "$@" $(pwd) "$@" test then cd sed "$1" export
+$(pwd) echo awk export $(pwd) then echo "$1" /usr/bin
+	$(pwd) && /usr/bin ${HOME} printf | readonly printf ${HOME}
+		2>/dev/null sed grep $(pwd) -eu sed && grep
+	2>/dev/null echo grep sed x=1 'quoted text'
+		$(pwd) awk local | -eu local
+	test "$@" sed ${HOME} x=1 local && 'quoted text' "$@" "$@" then done
+local printf $(pwd) awk | $(pwd) export readonly
+	| -eu 'quoted text' echo export
+		echo readonly x=1 export awk export /usr/bin "$1"
+readonly cd "$1" 2>/dev/null
+		export sed done done grep
+	--verbose readonly 'quoted text'
+	| export done x=1 $(pwd) "$1"
+		'quoted text' local && echo
+	export test done export ${HOME} printf x=1 export -eu -eu 2>/dev/null x=1 test
+	'quoted text' awk cd readonly echo sed awk cd |
+	sed echo -eu $(pwd) --verbose ${HOME} local ${HOME} $(pwd) printf sed &&
+grep done then /usr/bin sed test awk awk 'quoted text' then done done -eu
+		grep export awk test sed x=1 "$1" echo cd /usr/bin /usr/bin "$1" | readonly then
+		${HOME} then awk "$1" cd 2>/dev/null ${HOME} -eu --verbose
+	test done printf 2>/dev/null grep sed $(pwd) -eu && cd x=1 then -eu
+test --verbose && awk 'quoted text' test export 2>/dev/null
+2>/dev/null -eu local sed readonly sed && readonly -eu "$@" x=1 awk
+		${HOME} export 2>/dev/null export && local ${HOME} then cd | && && 'quoted text'
+echo local ${HOME} cd "$@" | /usr/bin cd then "$@" /usr/bin /usr/bin readonly
+"$@" test done ${HOME} cd $(pwd) /usr/bin | "$1" local
+		local done ${HOME} /usr/bin printf -eu
+		2>/dev/null "$@" sed sed cd test x=1 x=1 /usr/bin awk -eu
+	"$@" ${HOME} done echo x=1 | "$1" test /usr/bin "$1" local && "$@" "$1"
+&& sed readonly -eu --verbose printf readonly
+/usr/bin | "$1" printf export local
+export 2>/dev/null grep grep 'quoted text' awk done
+		then 'quoted text' ${HOME} -eu "$@" done /usr/bin -eu ${HOME} cd $(pwd)
+$(pwd) 2>/dev/null done
+	echo cd done printf 'quoted text' 2>/dev/null awk printf -eu sed export export
+		| | x=1 'quoted text' done
+&& --verbose | "$@" -eu export | awk && echo readonly
+echo "$@" printf 2>/dev/null -eu 'quoted text' 'quoted text' printf x=1 sed
+	grep awk printf grep --verbose readonly readonly /usr/bin && 'quoted text'
+2>/dev/null | && 'quoted text' | /usr/bin /usr/bin "$@" x=1
+	"$1" export /usr/bin 2>/dev/null --verbose /usr/bin /usr/bin
+	'quoted text' "$1" local | echo | --verbose then 'quoted text' then ${HOME}
+		grep ${HOME} ${HOME} "$@" awk echo test sed local test echo echo awk "$@" &&
+	"$1" cd readonly echo awk then awk /usr/bin
+	grep done cd ${HOME} /usr/bin echo --verbose 'quoted text'
+done && ${HOME} cd x=1 "$1" test echo
+| ${HOME} export "$1" export $(pwd) "$1" /usr/bin awk local
+		2>/dev/null awk 'quoted text' "$@" && 2>/dev/null local local local cd sed
+local /usr/bin local 'quoted text'
+		echo readonly echo "$1" printf done printf $(pwd) readonly export
+"$@" x=1 printf printf x=1 awk "$@" printf readonly "$1" 'quoted text' sed 'quoted text'
+	local echo --verbose cd -eu && -eu cd export
+		printf "$@" local done printf local sed done local printf ${HOME} x=1 then
+		2>/dev/null local --verbose "$1" local printf done &&
+		export /usr/bin && "$@" done && printf /usr/bin done printf printf
+	/usr/bin export readonly "$1" -eu echo echo &&
+		2>/dev/null echo awk then -eu && echo 2>/dev/null done 2>/dev/null
+	/usr/bin echo "$1" grep done then 2>/dev/null && test x=1
+		| test x=1 --verbose $(pwd) 2>/dev/null test && "$1"
+	"$1" cd $(pwd) 2>/dev/null done export 'quoted text' ${HOME} readonly sed 2>/dev/null
+		x=1 --verbose | readonly test local then export -eu echo test -eu x=1 "$@" 'quoted text'
+		| "$@" /usr/bin --verbose done /usr/bin done --verbose | "$1" "$1" && awk
+		'quoted text' 2>/dev/null export
+	/usr/bin done /usr/bin grep --verbose readonly --verbose cd printf |
+		echo awk test /usr/bin -eu printf done --verbose then test local printf
+		$(pwd) echo readonly ${HOME} export export then then done
+		/usr/bin $(pwd) /usr/bin awk x=1 test "$1" -eu cd
+		export then printf "$1" test ${HOME}
+	then | "$1" done printf grep --verbose
+	"$@" x=1 | | x=1 test export awk then sed echo test grep test
+2>/dev/null $(pwd) test test sed /usr/bin "$1" x=1 && 'quoted text' -eu
+done 'quoted text' grep | grep
+		readonly "$1" -eu readonly local x=1
+| local echo && test cd
+		sed local readonly awk $(pwd) -eu 'quoted text' ${HOME} -eu grep
+	--verbose sed readonly
+		cd printf -eu done readonly --verbose 'quoted text'
+	"$@" "$1" 'quoted text' 'quoted text' export cd
+echo ${HOME} $(pwd) export | 'quoted text' printf --verbose "$1" grep then echo
+grep -eu test 'quoted text' echo | $(pwd) grep ${HOME} -eu
+		local export x=1 "$@" then grep "$1" then awk grep readonly
+	--verbose grep "$@" readonly x=1 printf /usr/bin "$@" --verbose $(pwd) test
+		$(pwd) then ${HOME} local export cd printf printf $(pwd) readonly
+	grep ${HOME} cd echo export -eu && -eu
+		/usr/bin grep then "$1"
+	&& export local --verbose sed --verbose
+		done | test ${HOME} && export ${HOME} cd then --verbose
+-eu printf echo sed test 'quoted text' sed export export
+	printf then export cd $(pwd) echo | /usr/bin
+	"$@" awk -eu done 2>/dev/null | x=1 "$1" printf
+		"$@" 2>/dev/null 2>/dev/null
+	grep local ${HOME} sed --verbose -eu export local test readonly awk | x=1 "$@"
+	sed $(pwd) | x=1 export test 'quoted text' "$@" 'quoted text'
+		done 2>/dev/null export sed $(pwd)
+		'quoted text' local local sed then awk printf sed then test cd readonly echo 2>/dev/null
+		2>/dev/null readonly printf "$@" ${HOME} done 2>/dev/null
+done $(pwd) echo awk export cd 'quoted text'
+	2>/dev/null sed echo readonly | x=1 then $(pwd) echo "$1"
+${HOME} 'quoted text' | export sed | then x=1 awk local printf
+x=1 readonly "$1" readonly -eu done /usr/bin printf done && grep "$1" awk "$@"
+'quoted text' sed "$1"
+		--verbose grep 2>/dev/null "$@" "$1" /usr/bin | "$1" "$@" cd 'quoted text' x=1
+	awk grep ${HOME} $(pwd) ${HOME} printf
+	/usr/bin printf cd "$1" x=1 grep printf cd 'quoted text' |
+done then printf --verbose cd "$1" cd "$@" test ${HOME} export x=1
+		printf $(pwd) -eu readonly ${HOME} && -eu echo cd "$@" 2>/dev/null cd grep
+"$@" readonly awk grep sed
+	readonly sed --verbose test export export sed readonly
+		--verbose 'quoted text' readonly
+done cd done readonly ${HOME} &&
+		grep x=1 | grep sed printf
+	"$@" cd "$1" grep echo 2>/dev/null
+	$(pwd) "$@" 'quoted text' x=1 'quoted text' /usr/bin --verbose ${HOME}
+		sed "$@" grep then done export cd 2>/dev/null
+grep export readonly ${HOME}
+echo 2>/dev/null local -eu
+	-eu echo "$@" done local --verbose
+	'quoted text' --verbose 2>/dev/null 'quoted text' sed && printf
+	echo local readonly 2>/dev/null
+	test then test && then && echo x=1 printf
+		test export sed && ${HOME} ${HOME} cd printf -eu x=1 done sed $(pwd)
+		-eu then $(pwd) done x=1 printf 'quoted text' then
+--verbose echo grep -eu then 'quoted text' && --verbose
+export 'quoted text' "$1" $(pwd) test ${HOME} cd $(pwd) export
+	/usr/bin $(pwd) awk &&
+		/usr/bin done test printf export /usr/bin then | /usr/bin
+--verbose local export | ${HOME} | readonly local 2>/dev/null then 2>/dev/null
+		${HOME} 'quoted text' readonly ${HOME}
+printf sed ${HOME} awk --verbose grep done "$1" cd x=1 x=1 x=1 test awk --verbose
+		printf sed $(pwd) $(pwd)
+		x=1 then export echo awk x=1 "$1" awk 'quoted text' grep | -eu 'quoted text'
+	| printf grep grep test awk awk | --verbose local 'quoted text' -eu
+export | export $(pwd) 2>/dev/null
+	"$1" -eu done $(pwd) printf awk
+	--verbose | then "$@" "$1" | export $(pwd) done && x=1 'quoted text'
+	readonly echo cd ${HOME} readonly readonly
+		then x=1 2>/dev/null awk
+		local done && -eu 'quoted text' /usr/bin --verbose
+	cd awk sed 'quoted text' grep readonly echo
+		awk $(pwd) then test grep && ${HOME} printf local
+		&& /usr/bin grep --verbose done awk local 2>/dev/null
+sed && "$@" awk $(pwd) grep && grep 2>/dev/null readonly then | 2>/dev/null
+	cd export local $(pwd) 'quoted text'
+		grep x=1 grep export "$@" | | && sed -eu sed $(pwd) --verbose
+		&& echo -eu awk x=1 ${HOME} "$@"
+		"$@" && then | -eu test
+$(pwd) && echo test sed echo cd grep 2>/dev/null x=1 readonly
+	2>/dev/null grep printf /usr/bin awk local awk
+	export | x=1 --verbose x=1 $(pwd) cd --verbose "$1" echo
+/usr/bin | done echo printf readonly
+	--verbose "$@" test export sed test "$1" 'quoted text' then /usr/bin cd sed
+	readonly $(pwd) | local grep awk grep --verbose sed $(pwd) printf "$1" awk
+		readonly 2>/dev/null && test echo "$1" export
+then "$@" test /usr/bin done test 2>/dev/null 2>/dev/null
+local echo printf "$@" sed printf && ${HOME} "$1" && -eu sed -eu sed $(pwd)
+	local --verbose /usr/bin printf local ${HOME}
+	&& test done export --verbose /usr/bin $(pwd) $(pwd) awk $(pwd) 2>/dev/null
+		then x=1 printf local echo then --verbose done 2>/dev/null
+		2>/dev/null "$1" -eu "$1" -eu 2>/dev/null | 'quoted text'
+'quoted text' 'quoted text' "$1" x=1 sed readonly "$1" && 2>/dev/null readonly test
+		local ${HOME} && done awk --verbose printf
+		test ${HOME} | export export printf
+	sed echo grep done && $(pwd) then sed && done done awk 'quoted text'
+		then done then 'quoted text' "$1" | export
+	then -eu ${HOME} x=1 "$@" x=1 local "$@" 'quoted text' "$1" printf export awk
+	export then cd /usr/bin
+		grep printf -eu done test 'quoted text' $(pwd) test export awk |
+/usr/bin 2>/dev/null then grep readonly "$@" --verbose export done readonly
+	local $(pwd) && 2>/dev/null "$1" 'quoted text'
+	grep echo then export grep "$1"
+	readonly "$@" x=1 local readonly printf
+| 'quoted text' ${HOME} awk 2>/dev/null --verbose test "$@" test
+		cd | /usr/bin printf && printf
+	2>/dev/null x=1 $(pwd) echo
+	cd echo readonly grep /usr/bin then local $(pwd) grep grep "$@" sed awk
+	/usr/bin then echo export "$@"
+		| grep done done printf sed grep 'quoted text'
+	sed "$1" test local export --verbose cd grep
+		/usr/bin awk grep local "$1"
+printf $(pwd) done "$1" 2>/dev/null test "$1" printf sed test
+	&& ${HOME} sed echo done done export
+x=1 awk cd then cd test --verbose done x=1 /usr/bin cd export ${HOME}
+test done awk -eu $(pwd) echo "$1" grep 'quoted text' && cd && test 'quoted text'
+		x=1 | "$1" && 'quoted text'
+'quoted text' 'quoted text' local && ${HOME} ${HOME} && -eu export /usr/bin
+		| 2>/dev/null export $(pwd) cd | && "$1"
+	awk 2>/dev/null readonly
+cd --verbose | then "$@" test export sed ${HOME} && && cd $(pwd) -eu
+echo && 2>/dev/null export
+	echo export echo /usr/bin echo 'quoted text' && printf "$@"
+| awk "$1" x=1 test then x=1 export local 2>/dev/null readonly
+		readonly cd 2>/dev/null cd printf awk readonly --verbose awk x=1 awk printf export
+		awk test x=1 printf echo && export "$1" ${HOME} && done
+	&& && then 2>/dev/null && cd
+| | x=1 then echo echo --verbose /usr/bin printf then
+		x=1 -eu x=1 grep ${HOME} 2>/dev/null export x=1 printf
+done done --verbose --verbose
+		awk x=1 local then echo local echo export local grep export "$1" grep cd
+-eu $(pwd) then test export --verbose $(pwd)
+	then | printf test printf
+${HOME} grep sed done done ${HOME} "$1" test 'quoted text'
+&& && --verbose -eu sed
+x=1 export -eu $(pwd) readonly /usr/bin | then 2>/dev/null export cd echo x=1
+	local then printf echo 2>/dev/null "$@"
+-eu echo printf readonly cd cd
+		x=1 "$1" echo 'quoted text' /usr/bin then 'quoted text'
+		test then readonly x=1 readonly done "$@" printf ${HOME}
+	&& /usr/bin 'quoted text' cd && -eu "$1" "$@" | then x=1 "$1" export
+	then sed $(pwd) | local --verbose /usr/bin x=1 local awk ${HOME} 2>/dev/null
+test export 2>/dev/null awk -eu | -eu grep | export echo done
+awk awk 2>/dev/null test test
+		-eu sed then sed --verbose && /usr/bin
+		"$@" ${HOME} local 2>/dev/null echo cd "$1" awk awk ${HOME} done cd printf "$1"
+		"$1" sed "$1" /usr/bin -eu readonly test && export test grep awk
+sed awk done 'quoted text' readonly
+		readonly "$@" echo echo ${HOME} local printf printf done export /usr/bin
+awk export "$@" done "$@" cd $(pwd) printf
+		${HOME} "$@" done -eu /usr/bin local 'quoted text'
+		x=1 awk | readonly done then grep
+test $(pwd) awk | -eu $(pwd) grep grep
+		export test 'quoted text' /usr/bin ${HOME}
+	done | 'quoted text' grep x=1 done
+		-eu done local "$@" $(pwd) done echo then readonly | echo
+		awk test readonly ${HOME} $(pwd) printf -eu
+/usr/bin | x=1 local 'quoted text' "$@" ${HOME}
+		sed awk "$@" && echo 'quoted text' && done -eu $(pwd) $(pwd) echo | -eu
+	test echo 2>/dev/null local | grep "$1" x=1 && --verbose
+	"$@" $(pwd) -eu test "$1" "$1" then -eu local export --verbose
+/usr/bin test 'quoted text' readonly /usr/bin
+		cd x=1 printf | grep readonly
+	"$@" 2>/dev/null awk
+	done test readonly cd awk readonly test "$@" done echo
+		"$1" 'quoted text' readonly test
+	&& ${HOME} local ${HOME} printf x=1 readonly
+	--verbose printf echo export awk "$1"
+		"$1" $(pwd) readonly awk awk
+		sed | then | 'quoted text'
+		"$@" sed echo 'quoted text' local $(pwd) -eu -eu printf $(pwd) /usr/bin
+	"$1" sed cd done 'quoted text' echo --verbose awk grep printf awk readonly 2>/dev/null
+x=1 awk echo test sed printf -eu then "$1" done /usr/bin export 'quoted text'
+	| "$@" then $(pwd) 'quoted text' --verbose "$1" 2>/dev/null
+		"$@" cd /usr/bin 2>/dev/null done /usr/bin done export |
+	2>/dev/null grep -eu local
+		/usr/bin awk $(pwd) printf done 'quoted text' cd export awk && sed "$1"
+	echo test local | done "$@" sed then sed printf -eu x=1 readonly
+		$(pwd) cd local | /usr/bin sed 'quoted text'
+'quoted text' $(pwd) local sed
+-eu local --verbose -eu "$1" cd /usr/bin $(pwd) test -eu echo readonly
+	${HOME} /usr/bin $(pwd) 'quoted text' then
+	${HOME} 'quoted text' export done echo ${HOME} sed
+		| then "$@" && test export done && echo echo 2>/dev/null export
+	x=1 printf local export --verbose
+	printf "$@" && ${HOME} done | --verbose x=1 sed printf
+	sed printf | done "$1" x=1 echo readonly 2>/dev/null
+"$@" echo 2>/dev/null cd then awk --verbose
+	sed ${HOME} grep --verbose then x=1 done cd 2>/dev/null && echo
+echo readonly awk grep ${HOME} ${HOME}
+	--verbose echo "$1" done export
+	'quoted text' export "$1" done "$@" sed export local echo "$@" ${HOME} cd
+cd printf --verbose && echo "$@" sed $(pwd) done ${HOME}
+		awk 'quoted text' /usr/bin | cd $(pwd) /usr/bin echo /usr/bin grep
+	grep --verbose && echo
+	| /usr/bin 2>/dev/null --verbose local
+&& done /usr/bin && x=1 "$@" -eu $(pwd) 'quoted text' /usr/bin
+		cd x=1 done | cd test test then test then ${HOME} done readonly then $(pwd)
+	echo "$1" test && -eu && printf x=1
+done 2>/dev/null "$1" readonly x=1 $(pwd) /usr/bin /usr/bin "$@" &&
+	| grep awk 'quoted text' cd 'quoted text' 'quoted text'
+'quoted text' $(pwd) "$1" x=1 'quoted text' "$@" "$1"
+	printf /usr/bin --verbose ${HOME} done
+		x=1 echo grep -eu $(pwd) done test grep ${HOME} echo readonly sed export
+		$(pwd) | | ${HOME} done cd export grep 'quoted text' grep local
+		printf 'quoted text' printf awk
+	"$@" awk sed export 2>/dev/null
+	then awk $(pwd) readonly then 2>/dev/null printf
+		2>/dev/null ${HOME} awk grep | done
+		$(pwd) "$1" done sed /usr/bin /usr/bin x=1 printf echo
+		sed 'quoted text' echo && sed export /usr/bin $(pwd) | $(pwd)
+		${HOME} ${HOME} 'quoted text' ${HOME} | "$@" grep /usr/bin "$@"
+		printf grep export --verbose -eu printf local /usr/bin printf $(pwd)
+-eu test cd "$@" readonly
+awk then export awk $(pwd)
+	/usr/bin export | then
+done readonly /usr/bin test -eu -eu $(pwd)
+		--verbose -eu -eu && "$@" export
+	'quoted text' grep $(pwd)
+	readonly | export sed awk
+	local -eu awk done awk | printf x=1 readonly
+		sed --verbose awk $(pwd) && "$1" readonly printf readonly 2>/dev/null
+		test sed then -eu test sed then sed x=1 done sed --verbose
+	sed | 'quoted text' && local grep /usr/bin local --verbose local
+		test -eu /usr/bin "$@" -eu export local done
+&& | then "$1" | readonly echo --verbose
+		echo readonly sed done ${HOME} printf then printf $(pwd) | local
+grep /usr/bin sed x=1 readonly "$@" 2>/dev/null 'quoted text' cd -eu 'quoted text'
+		test then export echo awk 'quoted text' /usr/bin
+	"$1" 'quoted text' && printf "$@" grep 'quoted text'
+		readonly done done /usr/bin x=1 sed "$@" cd 'quoted text'
+		x=1 2>/dev/null "$@" echo done grep export then x=1 done $(pwd) "$@" $(pwd) --verbose
+	${HOME} readonly "$1" /usr/bin then
+"$1" export | 2>/dev/null
+	grep 'quoted text' grep | cd awk export && test ${HOME} test
+	done sed -eu /usr/bin ${HOME} grep ${HOME} done test ${HOME} sed cd | | /usr/bin
+	grep grep echo --verbose then printf 2>/dev/null test x=1 local cd | test grep
+	"$1" then then local 'quoted text' $(pwd) -eu then | $(pwd) awk "$1" 2>/dev/null
+		"$@" then ${HOME} done readonly echo cd sed echo ${HOME} printf test /usr/bin x=1
+| ${HOME} && ${HOME} printf
+	then 'quoted text' && x=1 done export printf 'quoted text'
+"$@" printf echo ${HOME}
+		"$1" 2>/dev/null && | 2>/dev/null /usr/bin 'quoted text' local /usr/bin
+cd "$@" printf && local then x=1 /usr/bin
+		/usr/bin $(pwd) $(pwd) | then done
+	-eu /usr/bin cd export 'quoted text' test grep | "$1" printf "$@"
+--verbose sed $(pwd) readonly --verbose ${HOME} grep /usr/bin
+$(pwd) cd ${HOME} cd test && readonly 2>/dev/null cd
+2>/dev/null 'quoted text' local $(pwd) readonly 2>/dev/null --verbose "$1" printf
+cd 'quoted text' sed test && 2>/dev/null ${HOME} 2>/dev/null
+export export done awk
+x=1 /usr/bin x=1 grep readonly ${HOME}
+printf sed export -eu "$1" export done
+		"$1" sed 'quoted text' readonly awk | $(pwd) cd
+	test grep | cd cd | done 2>/dev/null -eu echo
+"$@" | "$@" -eu then "$1" x=1 cd local echo cd export 'quoted text' ${HOME}
+		&& $(pwd) echo /usr/bin "$@" export $(pwd)
+	printf 'quoted text' --verbose done
+		export -eu x=1 echo 2>/dev/null export sed readonly ${HOME}
+	-eu | grep echo /usr/bin --verbose $(pwd) echo -eu && export
+	"$1" awk export grep -eu ${HOME} local "$1" 2>/dev/null ${HOME} 'quoted text'
+	2>/dev/null echo && && cd export echo | && -eu then "$1" cd then
+	| grep local /usr/bin 'quoted text'
+/usr/bin readonly | test readonly "$@" | test sed test && -eu awk then
+	"$1" local $(pwd) 'quoted text' /usr/bin awk sed echo && && "$1" -eu then
+${HOME} 2>/dev/null x=1 export 2>/dev/null printf && test done x=1 then -eu
+		"$@" echo $(pwd) local awk grep sed
+		echo && export awk x=1 2>/dev/null --verbose -eu | | --verbose x=1 test
+${HOME} ${HOME} grep --verbose grep 'quoted text' grep $(pwd) grep | x=1
+then 2>/dev/null printf then -eu 'quoted text' export printf readonly
+	local then x=1 /usr/bin export readonly printf "$1" readonly
+$(pwd) | "$@" ${HOME} "$1" grep /usr/bin echo ${HOME} sed --verbose
+	--verbose x=1 local "$@" done awk --verbose then printf "$@"
+		/usr/bin $(pwd) readonly 2>/dev/null export awk x=1 && export grep
+		local export | awk local export
+	&& | "$1" grep && && x=1
+	done | done 'quoted text' grep echo -eu
+	cd "$1" printf "$1" local readonly ${HOME} test sed x=1
+sed ${HOME} readonly && awk then 2>/dev/null ${HOME} -eu then readonly
+	2>/dev/null sed local readonly
+x=1 cd sed printf done | done printf then echo x=1 then test --verbose
+	then cd $(pwd) echo local && x=1
+	${HOME} then local cd 'quoted text' awk 'quoted text' --verbose -eu local x=1
+grep grep ${HOME} /usr/bin then export test | readonly awk awk printf
+		sed 'quoted text' --verbose /usr/bin sed local echo ${HOME} $(pwd)
+	cd /usr/bin done ${HOME}
+	| && "$@" 'quoted text' 'quoted text' awk | 2>/dev/null ${HOME}
+		done cd printf then x=1 echo 2>/dev/null done grep
+		| cd test x=1 test sed cd | -eu && grep readonly /usr/bin echo
+		"$@" readonly export 'quoted text' | | ${HOME} then --verbose && then
+		printf cd && /usr/bin -eu readonly
+		export test readonly done 'quoted text' export cd /usr/bin -eu 2>/dev/null
+		done && && echo grep 2>/dev/null export $(pwd) "$@" then grep
+	printf --verbose done cd test $(pwd)
+"$1" ${HOME} "$@" "$1" cd /usr/bin
+x=1 cd && -eu /usr/bin "$1" ${HOME}
+cd awk sed done printf 2>/dev/null --verbose
+done 'quoted text' awk x=1 'quoted text'
+printf ${HOME} awk echo
+	export | | --verbose
+	${HOME} "$@" done echo done done 'quoted text' | $(pwd)
+		then local $(pwd) sed echo readonly then | cd ${HOME} --verbose
+	awk echo $(pwd) sed printf echo
+	-eu done | awk awk 2>/dev/null "$1" && 2>/dev/null
+${HOME} sed awk "$@" cd && cd --verbose $(pwd)
+	sed done "$@" awk /usr/bin done $(pwd)
+echo "$@" -eu sed "$1" grep 2>/dev/null 2>/dev/null echo awk | local echo test
+	local echo x=1 2>/dev/null "$1" printf
+	grep $(pwd) && sed && export "$1" readonly 2>/dev/null x=1 export test
+	local local test awk && then
+	readonly export /usr/bin awk 2>/dev/null -eu -eu "$1" /usr/bin -eu $(pwd)
+	${HOME} $(pwd) x=1 ${HOME} cd sed -eu "$1" cd "$@" /usr/bin
+	"$@" "$1" then local /usr/bin "$@"
+		printf -eu $(pwd) then "$1"
+	--verbose 2>/dev/null grep
+grep grep | echo then then &&
+"$@" awk readonly x=1 printf -eu x=1 -eu export then "$@" echo cd $(pwd)
+		done | "$1" x=1 'quoted text' --verbose local
+"$@" -eu 'quoted text' "$1" | echo local echo ${HOME} export
+	"$1" "$1" 'quoted text' grep awk then x=1 done
+${HOME} test grep $(pwd)
+	$(pwd) && | && -eu -eu awk
+		$(pwd) | sed /usr/bin export "$1" /usr/bin /usr/bin readonly local test
+		grep ${HOME} awk grep -eu done $(pwd)
+/usr/bin ${HOME} 2>/dev/null $(pwd) then /usr/bin -eu "$1" x=1 2>/dev/null export
+test && readonly printf export
+		awk | printf test done "$1" test $(pwd) cd awk -eu x=1 local /usr/bin echo x=1
+x=1 && -eu readonly -eu ${HOME} done "$@" echo printf printf
+grep x=1 ${HOME} 'quoted text' /usr/bin $(pwd) "$@" ${HOME} sed /usr/bin done
+-eu x=1 grep awk grep && then local 2>/dev/null
+x=1 --verbose 2>/dev/null test export
+'quoted text' awk test awk export -eu local export export done "$1" readonly
+		${HOME} printf echo $(pwd) -eu grep && grep 'quoted text' printf
+		'quoted text' export local 'quoted text' then awk "$1" $(pwd) test "$@"
+&& --verbose grep -eu sed test printf done 2>/dev/null
+	$(pwd) "$@" local readonly awk
+	'quoted text' printf sed echo $(pwd) echo $(pwd) test test then then
+		printf test local -eu then export test && -eu export -eu readonly /usr/bin
+		local ${HOME} readonly echo 'quoted text'
+	grep awk "$@" $(pwd) 2>/dev/null "$1" then 'quoted text' done
+	$(pwd) test 2>/dev/null "$1"
+		"$@" /usr/bin | x=1 printf 'quoted text' cd sed grep test
+		--verbose "$1" -eu /usr/bin printf && /usr/bin echo $(pwd) printf
+cd && ${HOME} --verbose 2>/dev/null
+awk grep awk done export done export ${HOME} | grep done done printf 'quoted text'
+	-eu 2>/dev/null printf 'quoted text' printf
+"$1" -eu $(pwd) then test /usr/bin cd -eu export export
+/usr/bin printf | sed && --verbose then 'quoted text' done test
+		test x=1 "$@" && "$@" export ${HOME} printf readonly ${HOME}
+		cd $(pwd) --verbose cd
+	${HOME} $(pwd) local x=1 export
+| cd && 'quoted text' cd test done 'quoted text' ${HOME} sed 'quoted text'
+		"$1" readonly 'quoted text' -eu readonly ${HOME}
+| 2>/dev/null readonly && ${HOME}
+	grep echo sed ${HOME} cd grep
+| test awk local done export ${HOME}
+export -eu 'quoted text' done test local
+test echo 'quoted text' sed ${HOME} && $(pwd) printf then readonly
+		x=1 "$1" sed awk ${HOME} sed && sed
+2>/dev/null readonly x=1 local ${HOME}
+	echo $(pwd) cd local test 'quoted text' export awk 'quoted text'
+		sed x=1 2>/dev/null printf $(pwd) 2>/dev/null
+		readonly --verbose grep --verbose local test ${HOME} readonly "$@" 'quoted text'
+	echo readonly 2>/dev/null -eu 2>/dev/null
+		grep test /usr/bin then grep readonly grep readonly
+	"$@" "$@" readonly "$1" -eu echo "$1" awk export test 2>/dev/null
+"$@" cd printf && awk awk then done echo 'quoted text' awk awk
+		/usr/bin sed "$1" && 'quoted text' /usr/bin
+	test x=1 'quoted text' $(pwd) printf
+		awk "$@" sed 2>/dev/null /usr/bin 'quoted text' && test
+	2>/dev/null awk awk test grep cd | x=1 done 'quoted text'
+	grep | local | grep test &&
+	"$1" sed printf "$1" 2>/dev/null --verbose awk | done export
+test then echo | && cd test ${HOME} /usr/bin local awk 'quoted text'
+	/usr/bin --verbose local printf 2>/dev/null | echo --verbose
+	done echo /usr/bin | ${HOME} local local ${HOME}
+--verbose done 'quoted text'
+		/usr/bin grep done echo "$1" readonly test grep "$@" $(pwd) awk awk readonly grep
+		export printf "$@" "$@" /usr/bin sed x=1 ${HOME} "$1"
+		x=1 "$@" local x=1 | readonly && done cd test --verbose
+		printf ${HOME} "$@" && sed 2>/dev/null grep 2>/dev/null test | 'quoted text'
+	printf "$@" 'quoted text' then sed | test --verbose 2>/dev/null awk
+	--verbose $(pwd) local |
+	done printf sed then $(pwd) --verbose "$1" sed local | awk
+-eu && ${HOME} ${HOME} /usr/bin test test --verbose
+"$1" | export local export "$@" then
+done echo && local | x=1 readonly test local local then $(pwd) 2>/dev/null
+		${HOME} sed cd readonly 'quoted text' x=1 done --verbose /usr/bin "$1" printf
+		echo echo --verbose then done ${HOME} /usr/bin test 'quoted text' done
+		&& readonly -eu echo && --verbose "$@" sed $(pwd) test test | then
+	| && local test x=1 test "$@" sed | done
+		cd cd x=1 done && then awk x=1 then && "$1" "$@" export "$@" printf -eu
+		done 2>/dev/null sed awk ${HOME}
+&& test local 2>/dev/null export echo x=1 printf local then awk printf ${HOME} done
+	export test "$1" /usr/bin 'quoted text'
+x=1 then --verbose -eu "$@" grep -eu ${HOME}
+		export "$1" ${HOME} | && x=1 'quoted text'
+$(pwd) /usr/bin -eu awk --verbose echo cd grep export
+		test echo --verbose "$1" /usr/bin x=1 local "$1" x=1 /usr/bin
+	grep && test --verbose printf then -eu 'quoted text' x=1
+	echo grep | then local $(pwd) /usr/bin export $(pwd) --verbose x=1
+sed echo test sed cd /usr/bin ${HOME} | export done "$1" && x=1
+	local "$@" echo ${HOME} 2>/dev/null $(pwd) | -eu sed export 2>/dev/null
+		/usr/bin local x=1 local "$1"
+	"$@" ${HOME} export x=1 x=1 /usr/bin x=1 "$1" --verbose then --verbose
+$(pwd) awk "$@" printf "$@" done 'quoted text' $(pwd) awk
+then /usr/bin ${HOME} "$1" export readonly
+	x=1 x=1 printf awk grep grep test then $(pwd) test readonly sed ${HOME} | awk printf
+		done 'quoted text' local "$@" sed "$@" local done echo printf
+	"$@" ${HOME} done then cd echo then "$@" "$1" grep awk 'quoted text' test "$1"
+		then local "$@" printf echo -eu sed -eu echo -eu /usr/bin "$1" "$@"
+		&& awk ${HOME} x=1 "$@" export grep printf | sed -eu export --verbose grep export
+		| readonly -eu && ${HOME} export x=1 echo echo readonly
+		-eu then printf | | "$1" --verbose echo grep awk | "$1" /usr/bin /usr/bin
+		2>/dev/null export -eu /usr/bin export -eu "$1" readonly
+test export test readonly test 'quoted text' local -eu | printf
+'quoted text' awk done 2>/dev/null 'quoted text'
+		-eu -eu /usr/bin export /usr/bin cd | grep |
+	test cd grep grep readonly then export $(pwd)
+grep 'quoted text' echo && && /usr/bin "$1" 2>/dev/null
+		echo && --verbose then grep printf 2>/dev/null
+${HOME} test done printf 2>/dev/null then --verbose
+		'quoted text' "$@" 'quoted text'
+	/usr/bin grep export --verbose
+		-eu awk cd x=1 --verbose done test /usr/bin cd | 'quoted text'
+		sed cd x=1 | --verbose /usr/bin "$@" $(pwd) | echo
+awk --verbose x=1 2>/dev/null printf sed --verbose --verbose
+-eu $(pwd) done then 2>/dev/null
+		local /usr/bin grep awk test -eu readonly ${HOME} export readonly
+	test sed export | -eu then printf readonly cd
+	--verbose test export local then local awk export then x=1 /usr/bin --verbose
+	$(pwd) printf -eu | export x=1 sed $(pwd) test
+		/usr/bin && "$1" 'quoted text'
+	--verbose echo && -eu grep -eu && "$1" -eu cd echo /usr/bin
+--verbose printf && | --verbose "$@" "$1" test
+		cd cd printf && local then then
+	test echo /usr/bin then ${HOME} ${HOME}
+		-eu -eu awk | export 2>/dev/null
+	echo x=1 ${HOME} done $(pwd) $(pwd) 2>/dev/null readonly readonly
+printf echo test echo export local echo done readonly readonly
+	"$1" && && printf grep test echo export -eu -eu -eu sed
+	awk awk echo $(pwd) "$1" export awk cd x=1 $(pwd) cd
+&& | --verbose && x=1 x=1 readonly done "$1" /usr/bin test --verbose -eu grep x=1
+	test ${HOME} "$@" /usr/bin -eu "$1" /usr/bin --verbose && awk done /usr/bin
+	"$1" readonly grep --verbose local test readonly -eu awk "$@" test sed
+"$1" && then awk then local 'quoted text' local readonly ${HOME}
+		-eu printf local /usr/bin x=1 grep printf --verbose ${HOME} 'quoted text'
+	done | sed printf then && 'quoted text'
+| $(pwd) -eu --verbose "$1" 2>/dev/null "$1" done --verbose test
+"$1" --verbose 2>/dev/null export sed echo /usr/bin
+		awk printf "$@" ${HOME} then sed export
+		then 'quoted text' cd "$@" -eu sed cd then ${HOME} $(pwd) /usr/bin awk "$1" 2>/dev/null
+	"$@" $(pwd) export test | "$1" $(pwd) 2>/dev/null && /usr/bin
+	readonly /usr/bin ${HOME} ${HOME} "$@" sed echo 'quoted text'
+		/usr/bin done grep 2>/dev/null done cd "$1" | ${HOME} echo x=1 /usr/bin
+		done 2>/dev/null grep | printf export
+"$@" printf && readonly awk $(pwd)
+		'quoted text' /usr/bin /usr/bin $(pwd) printf
+cd grep "$1" && ${HOME} local $(pwd) awk readonly readonly
+		x=1 cd sed x=1 awk 2>/dev/null then sed "$1"
+	grep cd test done grep ${HOME} --verbose ${HOME} then awk readonly test x=1 printf
+	export $(pwd) "$@" local x=1 cd 2>/dev/null local && readonly
+		'quoted text' grep test /usr/bin echo "$@" $(pwd) cd 2>/dev/null printf
+	| /usr/bin 'quoted text' x=1 2>/dev/null /usr/bin 'quoted text'
+done ${HOME} 'quoted text' && --verbose 2>/dev/null -eu && -eu ${HOME}
+		/usr/bin "$@" --verbose $(pwd) 'quoted text' "$1"
+		readonly --verbose export -eu test $(pwd)
+		printf cd $(pwd) /usr/bin "$1" printf --verbose --verbose ${HOME} ${HOME} x=1
+		x=1 cd sed x=1 -eu ${HOME} echo echo awk sed 'quoted text'
+sed "$@" local echo readonly export cd readonly ${HOME} test
+local 'quoted text' && 'quoted text' | grep then 'quoted text' && done ${HOME}
+	export local --verbose
+		--verbose readonly --verbose "$1" echo echo
+2>/dev/null cd --verbose "$1" done --verbose done readonly 'quoted text'
+		| | "$1" "$@" then cd x=1 "$@" export /usr/bin $(pwd) test printf export | readonly
+		-eu | grep ${HOME} ${HOME} /usr/bin printf then -eu ${HOME}
+-eu && readonly readonly cd grep sed sed echo
+	${HOME} readonly "$1" readonly readonly readonly cd 2>/dev/null
+	'quoted text' export export "$@" echo awk 'quoted text' "$1" && readonly
+		then echo ${HOME} printf test cd echo done --verbose
+	&& | --verbose 2>/dev/null
+	then export readonly 'quoted text' -eu --verbose /usr/bin x=1 printf printf "$1"
+&& cd grep "$@" cd sed printf 2>/dev/null /usr/bin
+	done "$1" -eu printf ${HOME} -eu readonly /usr/bin done grep | export ${HOME}
+		--verbose cd ${HOME} --verbose
+		local done done local 2>/dev/null
+		| --verbose -eu done printf echo sed "$@" x=1 done "$1"
+sed test 2>/dev/null grep | --verbose x=1 echo local export
+		"$@" && awk awk 'quoted text'
+	${HOME} "$@" printf | 2>/dev/null local ${HOME} echo local -eu local readonly
+x=1 then /usr/bin export printf "$1" && "$@" 'quoted text' echo
+		done x=1 printf export sed local printf -eu
+	| --verbose x=1 awk readonly
+grep --verbose echo sed $(pwd) readonly -eu | export done --verbose
+		test cd grep "$1" local ${HOME}
+	| done | echo grep test test readonly cd | "$@" local 'quoted text' grep
+		printf test export /usr/bin -eu readonly $(pwd) | readonly export "$@" $(pwd) printf
+local 'quoted text' -eu 'quoted text'
+		cd 2>/dev/null export sed x=1 grep -eu -eu test 'quoted text' awk grep awk | grep
+		then && 2>/dev/null readonly grep awk "$@" cd | grep
+		local local && /usr/bin cd done readonly then --verbose
+		then sed grep x=1 $(pwd) done printf --verbose test echo ${HOME} "$1" && -eu
+'quoted text' ${HOME} && then ${HOME} readonly /usr/bin done test local
+test --verbose then sed ${HOME} grep ${HOME} && ${HOME} -eu
+| "$@" x=1 sed then x=1 -eu cd --verbose
+		echo 2>/dev/null printf x=1 2>/dev/null cd printf grep 2>/dev/null x=1
+printf awk "$1" | | "$@" x=1 sed /usr/bin grep export export x=1 $(pwd) then
+	export && sed export grep ${HOME} "$1" readonly
+		-eu x=1 | && printf printf awk readonly local grep printf done cd "$1" done x=1
+		export echo -eu /usr/bin test && test x=1 test 'quoted text'
+	local done 2>/dev/null && 2>/dev/null
+-eu x=1 x=1 -eu then x=1 && -eu "$@" grep --verbose printf 'quoted text' export
+		grep $(pwd) printf "$@" | | done | local ${HOME}
+	cd printf --verbose -eu done $(pwd) ${HOME} readonly awk 'quoted text'
+		done grep -eu test awk sed && test export test /usr/bin "$1" | ${HOME} x=1
+		test export | sed echo && 2>/dev/null /usr/bin 2>/dev/null
+		done sed | 'quoted text'
+	printf "$@" printf local ${HOME} sed $(pwd)
+grep echo printf 'quoted text' test awk test
+	then readonly "$1" local grep done awk export x=1 'quoted text' readonly "$@"
+--verbose done sed echo
+		$(pwd) sed ${HOME} ${HOME} 'quoted text'
+	cd "$@" /usr/bin && cd
+then echo | --verbose export
+		sed --verbose then x=1 --verbose then 'quoted text'
+		-eu cd done /usr/bin printf
+	-eu echo done done 'quoted text'
+	awk grep /usr/bin test 2>/dev/null readonly
+	export 'quoted text' cd | readonly test sed
+	cd /usr/bin sed printf
+	/usr/bin export done test 'quoted text'
+	| cd grep test cd sed ${HOME} x=1 sed readonly
+		local printf local | | $(pwd) /usr/bin "$1" &&
+	printf sed export local ${HOME} export
+		"$@" done awk "$1" --verbose | --verbose $(pwd) 'quoted text'
+		-eu grep sed test awk x=1 2>/dev/null
+"$@" "$@" sed done "$@" test
+'quoted text' echo awk "$1" | awk echo export --verbose cd
+		x=1 sed -eu | $(pwd) then | cd grep $(pwd) awk printf grep then | 2>/dev/null
+"$1" "$1" ${HOME} 'quoted text' sed "$1" --verbose "$@" echo
+done x=1 printf -eu && -eu ${HOME} awk readonly x=1 /usr/bin 2>/dev/null
+echo 'quoted text' && done readonly local readonly
+		test awk then $(pwd) 2>/dev/null awk --verbose echo
+	test 2>/dev/null 'quoted text' "$1"
+	grep echo 2>/dev/null -eu | readonly && then awk ${HOME}
+		"$1" -eu && grep $(pwd) ${HOME} echo "$1" && "$1"
+		"$1" printf sed && local cd x=1 awk test x=1 sed x=1 readonly /usr/bin sed cd
+then awk local grep /usr/bin test x=1 then printf "$@" |
+printf $(pwd) local cd sed -eu
+	2>/dev/null echo --verbose
+	&& printf && test --verbose local
+		test "$1" ${HOME} grep awk echo readonly grep readonly
+$(pwd) grep "$1" awk sed ${HOME} ${HOME} ${HOME} /usr/bin --verbose --verbose
+	$(pwd) ${HOME} done grep x=1 x=1 'quoted text'
+	${HOME} && test local "$1" "$@" x=1
+	done grep | test --verbose
+| printf test local ${HOME} local test cd
+	test awk --verbose 'quoted text' --verbose echo ${HOME} | -eu $(pwd)
+'quoted text' --verbose $(pwd) 2>/dev/null
+'quoted text' then test x=1 awk echo |
+printf grep && "$@" export grep x=1 then grep then printf "$@" $(pwd) echo
+	"$@" ${HOME} test grep done done test | cd awk awk x=1 |
+	--verbose x=1 test echo
+done "$@" sed readonly grep echo export cd cd | cd --verbose | readonly
+local "$@" awk && ${HOME} 2>/dev/null printf local printf
+"$@" "$@" readonly "$@" "$1" "$@" --verbose readonly grep
+		grep -eu printf echo 'quoted text' $(pwd) sed test /usr/bin ${HOME}
+		then 2>/dev/null then &&
+		sed --verbose ${HOME} | grep --verbose echo readonly 'quoted text' export
+	grep grep then -eu x=1 printf
+		printf test -eu ${HOME} echo readonly "$@" printf | awk test cd test | echo
+	export && then x=1 echo export
+		x=1 grep --verbose done
+		test -eu 'quoted text' grep ${HOME} ${HOME} -eu
+		cd then echo 'quoted text' test awk then awk test test
+		local /usr/bin sed $(pwd) printf ${HOME} cd then sed "$1"
+2>/dev/null readonly "$@" local printf local ${HOME} /usr/bin then echo then
+&& test cd | | export /usr/bin
+	x=1 "$@" then readonly "$@" local test printf done export x=1
+	x=1 | done awk printf
+awk $(pwd) | grep | sed | -eu
+		${HOME} export | /usr/bin "$@" done $(pwd) /usr/bin ${HOME}
+	cd -eu echo echo export test sed awk x=1 then
+		readonly cd x=1 sed && done echo then echo | -eu cd done $(pwd) ${HOME}
+		test cd readonly export printf --verbose
+&& x=1 ${HOME} sed done echo 2>/dev/null cd
+		grep test sed done sed ${HOME} -eu "$1" x=1 readonly
+	test test | 2>/dev/null /usr/bin && -eu "$1" $(pwd) $(pwd) export local then
+	grep cd sed done ${HOME} grep $(pwd) readonly echo 2>/dev/null echo
+"$1" 'quoted text' ${HOME} cd cd /usr/bin | export "$1" --verbose printf cd done
+then -eu echo 'quoted text' done
+local 2>/dev/null awk readonly printf readonly done /usr/bin grep "$1" "$1"
+--verbose 2>/dev/null && /usr/bin awk printf echo x=1 echo export
+	&& local 'quoted text' /usr/bin
+export done x=1 'quoted text'
+		| /usr/bin awk sed ${HOME} 'quoted text' readonly $(pwd) readonly
+${HOME} readonly --verbose /usr/bin 2>/dev/null -eu
+		/usr/bin && echo awk 2>/dev/null then grep cd $(pwd) "$1"
+$(pwd) then done readonly | local "$1" local cd $(pwd) "$1" sed echo grep
+	"$@" $(pwd) && then awk --verbose /usr/bin echo x=1 2>/dev/null -eu awk printf
+done -eu awk awk 2>/dev/null readonly $(pwd) done awk
+	export --verbose --verbose test x=1 local
+		sed x=1 done 'quoted text'
+export $(pwd) 2>/dev/null local
+	grep grep | "$1" local /usr/bin
+		${HOME} awk done 2>/dev/null cd test | "$1"
+	&& 2>/dev/null | sed "$@" /usr/bin "$@" -eu export | cd 2>/dev/null awk test
+		then echo then $(pwd) --verbose awk local /usr/bin
+export 'quoted text' x=1 "$@" && "$@" -eu echo export
+		echo test then /usr/bin 2>/dev/null then $(pwd) 2>/dev/null | -eu
+"$@" test "$1" ${HOME} sed export printf test "$1" x=1
+	x=1 then -eu "$@" && --verbose 'quoted text' 'quoted text' /usr/bin
+export x=1 "$1" ${HOME} export printf x=1 ${HOME} ${HOME} x=1 sed readonly
+"$@" export "$@" cd grep | cd
+		then -eu export && test local echo "$@" --verbose | 2>/dev/null cd 'quoted text'
+	grep echo done --verbose && $(pwd) grep echo readonly cd /usr/bin printf
+	cd sed -eu local local x=1 then printf x=1 printf readonly "$1" --verbose
+		sed /usr/bin /usr/bin readonly ${HOME} readonly
+/usr/bin echo export "$@" 2>/dev/null
+	2>/dev/null export test readonly then cd awk readonly "$1"
+		local printf --verbose --verbose grep awk echo printf
+	"$1" -eu "$1" printf /usr/bin local test "$@" grep 2>/dev/null /usr/bin local
+		readonly grep $(pwd) then "$@" --verbose readonly --verbose
+"$1" sed export && local | 2>/dev/null test 2>/dev/null then | --verbose grep &&
+then done 'quoted text' awk ${HOME} readonly "$@" "$@" ${HOME} then cd echo grep
+		printf cd $(pwd) cd && export then awk 'quoted text' done
+		grep --verbose x=1 | cd 'quoted text' $(pwd) 'quoted text' printf
+	x=1 sed | x=1 readonly | test
+	export "$1" "$@" x=1 --verbose x=1
+test echo awk grep grep awk 'quoted text' awk test test && grep sed grep local
+		'quoted text' -eu | local x=1 ${HOME} awk then local grep grep printf "$1" echo
+| sed x=1 -eu 2>/dev/null then
+--verbose && $(pwd) /usr/bin x=1 then export
+	export then sed export --verbose printf 'quoted text' done awk cd grep sed
+/usr/bin cd /usr/bin awk --verbose then local "$@"
+	export x=1 --verbose x=1 sed $(pwd) "$1" --verbose done local
+readonly x=1 -eu x=1 printf 2>/dev/null x=1 sed ${HOME} awk && test -eu sed
+x=1 -eu grep echo done sed "$1" done awk readonly
+"$1" && && | ${HOME} $(pwd) 2>/dev/null readonly
+	grep -eu done | --verbose | echo sed local "$@" "$1" --verbose sed then --verbose
+cd ${HOME} done cd cd printf 'quoted text'
+	local && -eu $(pwd) printf --verbose "$1" grep | export local then "$1"
+		local export 2>/dev/null test printf export done
+		printf local && cd | $(pwd) cd printf export /usr/bin printf
+cd "$1" $(pwd) "$1" export 2>/dev/null "$@" done 2>/dev/null
+		&& sed printf echo x=1 -eu echo "$@" readonly
+		printf "$@" 2>/dev/null "$@" test echo grep --verbose
+	cd grep then grep /usr/bin sed | "$1" cd echo "$@"
+printf x=1 x=1 done x=1 awk --verbose 'quoted text' /usr/bin | -eu local cd "$@"
+	sed done "$1" done -eu 2>/dev/null
+	printf export grep -eu export echo readonly --verbose then 'quoted text' awk grep
+		readonly then sed done 2>/dev/null
+		sed ${HOME} "$@" -eu | cd x=1 'quoted text'
+	readonly awk then echo | test awk local ${HOME} local | ${HOME} export
+		'quoted text' $(pwd) && $(pwd) x=1 cd -eu 'quoted text'
+&& "$@" $(pwd) /usr/bin "$@" ${HOME} && 'quoted text' "$@" --verbose local
+then echo 'quoted text' && export 'quoted text' "$@" "$@" "$1" "$@"
+		/usr/bin echo awk && x=1 2>/dev/null "$1" awk export awk test 2>/dev/null
+	&& | printf | then --verbose "$1" cd
+then && awk local cd grep test
+	readonly grep then x=1 $(pwd) export grep
+	readonly awk $(pwd) x=1 printf awk | done "$1" grep 'quoted text' /usr/bin local
+&& export -eu "$@" /usr/bin
+	readonly cd && "$1" && --verbose
+		'quoted text' 'quoted text'
+		x=1 grep "$1" printf && 2>/dev/null 'quoted text' "$@" printf awk && "$@"
+	&& && local printf echo "$@" echo x=1 sed x=1 sed cd /usr/bin echo awk && x=1
+		"$@" grep ${HOME} $(pwd) awk cd "$1" cd cd
+&& 'quoted text' ${HOME} ${HOME}
+		printf "$@" sed --verbose local 'quoted text'
+"$@" "$1" done -eu 2>/dev/null
+	export readonly "$1" "$@" done 2>/dev/null --verbose cd --verbose 2>/dev/null
+	test sed x=1 echo $(pwd) x=1
+"$@" "$1" sed done printf x=1 2>/dev/null test $(pwd)
+	"$1" awk | && "$1" then echo "$@" && x=1 2>/dev/null readonly awk export
+		printf "$@" /usr/bin test | | sed sed cd awk
+	readonly printf x=1 grep cd -eu readonly cd 'quoted text' local local sed export
+		-eu echo test /usr/bin x=1 cd $(pwd) | /usr/bin ${HOME} 'quoted text' export
+		echo "$1" sed then then printf
+	local $(pwd) "$1" -eu test grep -eu echo cd $(pwd) grep export
+	cd /usr/bin local local "$@" grep cd sed echo "$1" export x=1 readonly
+	test echo local sed | sed | x=1 -eu
+		'quoted text' done cd $(pwd) local && | 'quoted text' -eu |
+		grep /usr/bin awk printf /usr/bin
+		printf | grep -eu /usr/bin awk --verbose
+		export grep -eu test /usr/bin | sed then
+		test grep awk --verbose cd done done cd local x=1 sed then -eu cd --verbose
+		--verbose sed cd --verbose
+	cd | $(pwd) && sed export grep grep readonly x=1 && cd &&
+'quoted text' -eu ${HOME} echo echo cd done $(pwd)
+	export echo 'quoted text' && awk 2>/dev/null done echo 2>/dev/null 2>/dev/null
+		${HOME} $(pwd) awk && --verbose cd x=1 local ${HOME} -eu printf $(pwd) awk
+		grep /usr/bin echo export
+	&& "$1" && readonly then
+		echo $(pwd) x=1 2>/dev/null grep x=1 --verbose
+	awk printf readonly -eu && echo && echo -eu sed -eu 2>/dev/null
+	${HOME} export 'quoted text'
+	cd test ${HOME} echo test -eu then x=1 /usr/bin echo ${HOME} echo export &&
+then test awk "$1" sed
+	/usr/bin && 2>/dev/null |
+	x=1 cd -eu awk grep --verbose sed grep /usr/bin -eu -eu ${HOME}
+-eu -eu awk $(pwd) echo 'quoted text' echo ${HOME} then test ${HOME}
+		$(pwd) done sed /usr/bin readonly export
+	echo awk local -eu &&
+	grep "$1" | --verbose readonly --verbose printf /usr/bin
+	'quoted text' x=1 export test && cd 'quoted text' readonly printf
+	| ${HOME} done && "$1" local test x=1 x=1 -eu local
+	'quoted text' -eu sed local "$@" cd sed printf local 2>/dev/null
+		--verbose "$1" $(pwd) grep readonly "$1" test $(pwd) cd test | printf
+	"$1" $(pwd) cd readonly 2>/dev/null -eu grep echo export
+		done cd -eu 'quoted text' $(pwd) "$@" x=1 x=1 local --verbose 2>/dev/null awk
+	| cd -eu 2>/dev/null then cd "$@" ${HOME} awk $(pwd)
+	-eu then --verbose 'quoted text' ${HOME}
+		awk grep awk --verbose x=1 export -eu $(pwd) readonly local /usr/bin
+'quoted text' | then ${HOME}
+	printf --verbose $(pwd) "$1"
+then readonly "$1" then && readonly
+local | cd export echo "$1" | --verbose "$@" printf grep grep $(pwd)
+	${HOME} local "$@" 'quoted text'
+	done test awk "$1" grep echo readonly -eu "$@" done
+	export "$@" test /usr/bin test && grep x=1 $(pwd) then awk cd "$@" $(pwd) && /usr/bin
+2>/dev/null then && $(pwd) x=1 export grep
+		/usr/bin $(pwd) && cd test local 2>/dev/null grep grep printf echo echo
+/usr/bin | echo test test grep && 'quoted text'
+		'quoted text' readonly -eu
+	&& export export export sed then readonly --verbose -eu "$1" -eu cd 'quoted text'
+		"$@" grep awk --verbose cd "$1" echo cd awk /usr/bin | grep "$1" "$1" $(pwd)
+-eu -eu ${HOME} awk 2>/dev/null grep cd awk test readonly $(pwd) export
+local && readonly 2>/dev/null "$1" grep local readonly sed cd
+	&& awk echo $(pwd) -eu printf ${HOME}
+		export sed && then && && $(pwd) $(pwd) 2>/dev/null | grep && echo export
+2>/dev/null echo $(pwd) sed grep then
+	x=1 x=1 echo 2>/dev/null grep sed grep export grep
+		"$@" -eu 'quoted text' sed cd ${HOME} then ${HOME} x=1 done echo -eu $(pwd) local
+		&& sed && --verbose --verbose
+		sed awk x=1 then $(pwd) -eu 2>/dev/null then echo "$1"
+	then cd --verbose && grep done test
+		'quoted text' x=1 | /usr/bin -eu cd "$1"
+"$1" cd done export x=1 'quoted text'
+		--verbose sed local 2>/dev/null
+| | && /usr/bin printf 2>/dev/null "$1" $(pwd)
+	then grep echo done local
+		-eu printf 'quoted text' "$@" echo
+	-eu ${HOME} 2>/dev/null "$@" $(pwd) "$1" "$@" test grep awk done 'quoted text'
+	--verbose sed export printf printf --verbose | done test | printf x=1 && ${HOME}
+	/usr/bin done local printf export test x=1 && test
+--verbose "$@" | 'quoted text'
+x=1 --verbose && && export 'quoted text' /usr/bin cd test
+awk sed grep /usr/bin
+test | grep awk -eu test "$1" /usr/bin printf
+		echo then | grep "$@" printf test && test "$1" grep sed 2>/dev/null then test
+--verbose local "$@" echo "$1" /usr/bin then grep cd then x=1 /usr/bin 2>/dev/null
+	"$@" then x=1 && ${HOME} readonly ${HOME}
+export ${HOME} then "$1" 2>/dev/null && $(pwd) /usr/bin
+		$(pwd) 'quoted text' 2>/dev/null
+		"$@" printf -eu test export readonly local -eu $(pwd)
+		test then done echo $(pwd)
+	cd awk awk && 2>/dev/null awk done cd |
+		${HOME} printf test printf $(pwd) ${HOME}
+		$(pwd) $(pwd) grep --verbose
+	"$@" /usr/bin --verbose "$1" grep $(pwd) --verbose "$@" test x=1 "$1" grep 2>/dev/null
+		2>/dev/null echo | done sed
+| -eu /usr/bin grep x=1 export grep done local done export $(pwd) export cd then
+	done cd /usr/bin local && local then x=1 readonly "$1" local done then export
+done | --verbose grep awk awk | -eu 'quoted text' | done readonly
+		done done "$1" "$@" cd readonly readonly
+export echo sed done grep sed --verbose "$1" -eu printf export x=1 then
+test "$1" 'quoted text' && x=1 $(pwd) then echo grep /usr/bin 'quoted text' --verbose
+		grep export /usr/bin 'quoted text' readonly done then printf 2>/dev/null
+	awk && 2>/dev/null sed done awk | awk 2>/dev/null
+"$@" test printf printf 2>/dev/null
+/usr/bin export echo export printf printf local 2>/dev/null | 'quoted text'
+x=1 ${HOME} grep 'quoted text' awk readonly
+		echo | done $(pwd) /usr/bin cd echo ${HOME} echo grep echo x=1 sed printf 2>/dev/null
+	done done readonly | readonly 'quoted text' "$1" -eu --verbose /usr/bin --verbose
+	&& 2>/dev/null readonly awk done
+echo then && --verbose local export $(pwd) "$1" export readonly x=1 grep
+done sed grep test -eu && export readonly echo x=1 x=1 ${HOME} ${HOME} 'quoted text'
+done awk export printf
+		/usr/bin local sed then | grep echo done then 'quoted text' echo $(pwd) ${HOME}
+	$(pwd) -eu export /usr/bin export "$1" then --verbose && 'quoted text'
+	sed -eu | /usr/bin "$@" cd
+		sed grep awk echo echo awk then $(pwd) echo | && local
+	test done cd export then 'quoted text' export local awk printf x=1 ${HOME} echo
+		printf grep && --verbose ${HOME}
+		"$@" /usr/bin "$1" 'quoted text' awk printf && "$1" &&
+		$(pwd) printf test "$1" "$1" then echo echo -eu done printf local awk
+		then ${HOME} 'quoted text' sed && printf "$@" echo readonly x=1 echo
+		export /usr/bin 'quoted text' | readonly export echo ${HOME}
+"$1" -eu --verbose "$@" echo && | local ${HOME} test done /usr/bin
+"$@" echo | local grep | awk local "$@" readonly && echo echo printf "$@" local
+export echo grep sed "$@" 'quoted text' export x=1 done
+'quoted text' printf 2>/dev/null
+		echo then export readonly readonly "$1" printf readonly ${HOME} done
+		$(pwd) /usr/bin && ${HOME} done 'quoted text' ${HOME} echo export 'quoted text'
+printf then readonly echo ${HOME} printf -eu grep /usr/bin
+		test --verbose readonly local export -eu
+		cd grep ${HOME} test cd "$@" then printf --verbose $(pwd) awk done
+		| test awk 2>/dev/null "$1" x=1
+	sed awk cd done x=1 $(pwd) x=1 $(pwd) "$1" ${HOME} echo && $(pwd) --verbose
+		done -eu && ${HOME} test sed "$1" 'quoted text'
+		sed readonly local echo $(pwd)
+	"$@" export 2>/dev/null "$1" then ${HOME} 2>/dev/null
+echo --verbose 'quoted text' export echo 2>/dev/null
+	sed cd done export done grep echo
+	'quoted text' test printf 'quoted text' && echo grep export done sed
+grep /usr/bin 'quoted text' grep
+readonly done 2>/dev/null
+		"$@" done grep ${HOME} && /usr/bin sed ${HOME} 2>/dev/null export test /usr/bin
+		| $(pwd) done test 2>/dev/null done sed $(pwd) "$1" done awk echo
+		${HOME} echo 2>/dev/null local sed done grep export cd -eu 'quoted text'
+	| then awk $(pwd) /usr/bin x=1 export then printf -eu
+	&& 'quoted text' grep | && --verbose /usr/bin "$1" $(pwd) awk ${HOME} sed
+	grep && x=1 readonly sed ${HOME} test echo echo done && cd echo | grep
+		"$1" printf /usr/bin 'quoted text' -eu echo test grep awk ${HOME} | export -eu
+		sed test readonly cd $(pwd) && ${HOME} done x=1
+	echo -eu --verbose local 'quoted text' local export
+"$1" "$1" -eu readonly sed echo then $(pwd)
+	"$1" echo sed printf $(pwd)
+awk 2>/dev/null | sed grep test $(pwd) local grep cd cd printf /usr/bin
+		echo -eu -eu | test x=1 local echo "$1" $(pwd) sed
+	| | sed "$1" /usr/bin /usr/bin
+-eu 2>/dev/null ${HOME} 'quoted text' x=1 then
+		then readonly $(pwd) ${HOME} grep
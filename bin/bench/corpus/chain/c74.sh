@@ -0,0 +1,2001 @@
+"$1" echo sed cd then sed 'quoted text'
+		then then then readonly then cd 2>/dev/null
+		"$1" cd --verbose echo then
+		2>/dev/null echo -eu $(pwd) export x=1 | echo | /usr/bin 'quoted text'
+&& x=1 x=1 then printf readonly export && -eu $(pwd) sed sed --verbose "$1" -eu
+		printf $(pwd) /usr/bin export export -eu echo done then 2>/dev/null | test
+	test local $(pwd) readonly $(pwd) -eu readonly printf -eu grep printf
+printf then "$@" readonly "$1" -eu awk echo echo /usr/bin ${HOME}
+	| export "$1" export 'quoted text' 'quoted text'
+	then cd test | --verbose | grep x=1 local ${HOME} printf
+	done x=1 readonly grep test readonly 2>/dev/null then "$@"
+		2>/dev/null ${HOME} $(pwd) done | /usr/bin echo
+		x=1 export "$@" grep /usr/bin /usr/bin 'quoted text' --verbose ${HOME}
+	"$@" local then awk grep "$1"
+"$@" awk sed sed done readonly grep grep local test sed echo then
+	printf -eu ${HOME} "$1" $(pwd) done x=1 test 2>/dev/null
+	test done cd 2>/dev/null echo
+grep sed readonly 'quoted text'
+		--verbose then printf cd
+	printf cd test 2>/dev/null 2>/dev/null ${HOME}
+	'quoted text' sed cd then && echo local cd readonly readonly "$1" cd "$@"
+		test test -eu /usr/bin --verbose
+		--verbose done printf sed cd -eu done readonly
+	$(pwd) local export export
+${HOME} local /usr/bin then $(pwd)
+	test -eu grep ${HOME} test cd then
+	"$@" && cd echo $(pwd) cd printf $(pwd) echo $(pwd) readonly done
+	sed printf local done --verbose export readonly export 2>/dev/null
+	done grep then 'quoted text' 2>/dev/null | echo grep awk | -eu
+sed --verbose test "$1" --verbose
+		2>/dev/null "$@" "$1" x=1 $(pwd) sed ${HOME} printf awk export 'quoted text'
+	'quoted text' readonly grep --verbose awk awk awk awk done echo "$1"
+x=1 then test 2>/dev/null echo 'quoted text' grep done echo /usr/bin
+"$1" local | readonly local ${HOME} sed done $(pwd)
+	$(pwd) | /usr/bin x=1 sed
+	"$@" && done grep sed local cd "$@" done cd echo ${HOME} awk
+| done export echo 'quoted text' cd "$1" x=1 |
+		awk echo "$@" -eu local cd echo 2>/dev/null
+		then then export done done 2>/dev/null x=1
+	${HOME} "$@" ${HOME} && then then x=1 && "$1" readonly
+	local --verbose sed export test "$1" x=1 "$@" printf x=1 export "$1"
+x=1 "$@" 'quoted text' 2>/dev/null sed | grep test echo "$1"
+readonly --verbose && sed test export readonly
+${HOME} "$@" $(pwd) readonly 'quoted text' ${HOME} readonly && export "$1" test
+	cd printf "$1" awk readonly --verbose
+readonly $(pwd) --verbose export /usr/bin local /usr/bin
+	2>/dev/null -eu "$@" && then /usr/bin 2>/dev/null readonly
+	grep awk awk readonly /usr/bin grep export /usr/bin | printf then done cd
+/usr/bin echo cd echo && | $(pwd) echo | && cd --verbose then -eu -eu 2>/dev/null
+	test local ${HOME} awk ${HOME} 2>/dev/null $(pwd)
+		cd then sed ${HOME} then local && -eu
+		--verbose ${HOME} /usr/bin
+		x=1 printf "$@" awk grep export 'quoted text'
+		cd x=1 -eu $(pwd) | && local && export export export
+/usr/bin echo ${HOME} echo awk echo x=1 "$1" | readonly
+		-eu "$1" local grep done echo | "$@" --verbose -eu sed --verbose echo local
+-eu /usr/bin ${HOME} "$@" test 2>/dev/null ${HOME} | /usr/bin
+	local | printf export echo test "$1" ${HOME} printf printf echo echo 'quoted text'
+		$(pwd) | && $(pwd) $(pwd) --verbose --verbose $(pwd) test awk local &&
+		2>/dev/null 'quoted text' ${HOME}
+	--verbose /usr/bin sed x=1 sed printf | test test ${HOME}
+		"$@" /usr/bin grep then test sed $(pwd) --verbose ${HOME} "$1" ${HOME}
+		grep "$1" printf $(pwd) readonly readonly $(pwd) "$1" "$@"
+/usr/bin 2>/dev/null grep
+		x=1 readonly local sed
+		export "$@" -eu && x=1 then readonly then $(pwd) readonly done done readonly x=1
+grep && done | sed then "$1" grep $(pwd) echo test && 'quoted text' done
+	"$1" && cd cd --verbose local
+	| /usr/bin x=1 && cd
+	grep | done local "$1" readonly "$1"
+		export grep --verbose 2>/dev/null cd cd local && 'quoted text' cd done
+	"$@" && grep test 2>/dev/null --verbose readonly echo local then then
+	2>/dev/null 'quoted text'
+awk x=1 awk | export test "$@" export export "$1" "$@" echo
+	then /usr/bin 2>/dev/null readonly test export local local awk x=1
+	$(pwd) cd "$1" readonly $(pwd) local then -eu
+		| export awk echo x=1 2>/dev/null
+	cd sed done | "$1" -eu test then x=1 then | x=1
+		then /usr/bin 'quoted text' echo /usr/bin | x=1 $(pwd) ${HOME} then
+		${HOME} --verbose ${HOME} awk awk done echo readonly
+	$(pwd) -eu local echo /usr/bin cd --verbose
+		local local readonly local /usr/bin $(pwd) 2>/dev/null /usr/bin "$1" x=1 export
+		/usr/bin cd $(pwd) ${HOME} x=1 x=1 | $(pwd)
+		2>/dev/null x=1 x=1 'quoted text' test
+$(pwd) export /usr/bin ${HOME} 'quoted text'
+		| local && local readonly awk
+		"$@" 2>/dev/null "$1" done "$@" sed export 'quoted text' cd "$1"
+| then cd 'quoted text' "$1" done readonly ${HOME} -eu echo
+--verbose "$1" local "$1" local echo 2>/dev/null test
+sed readonly sed printf sed readonly 'quoted text'
+	printf awk x=1 | /usr/bin "$1" cd /usr/bin cd ${HOME}
+test done local readonly sed cd -eu printf then /usr/bin $(pwd)
+	"$1" --verbose local sed awk awk printf $(pwd) -eu readonly /usr/bin
+sed grep --verbose awk printf awk ${HOME} test local test x=1 &&
+| done printf x=1 x=1 printf local && x=1 /usr/bin -eu ${HOME}
+		${HOME} 2>/dev/null && test export
+	"$@" awk | $(pwd) echo done local readonly --verbose
+--verbose --verbose done "$1" /usr/bin /usr/bin
+		readonly ${HOME} awk x=1 readonly test then awk local
+export sed "$@" export awk cd && done --verbose export
+		printf 'quoted text' cd local ${HOME} $(pwd) 'quoted text'
+	x=1 /usr/bin | "$@" -eu done cd grep then done
+		readonly "$@" export test test
+"$1" readonly readonly export $(pwd) grep 'quoted text'
+	/usr/bin "$@" "$1" readonly done 'quoted text' echo
+		then /usr/bin test ${HOME} 'quoted text' -eu then
+		cd -eu --verbose done x=1 grep export echo readonly cd "$1" then
+	/usr/bin | 'quoted text' $(pwd) -eu sed sed printf
+		readonly then $(pwd) local && echo /usr/bin local --verbose 2>/dev/null
+| echo -eu $(pwd) awk export awk test local /usr/bin
+		| | export && sed -eu echo cd test 'quoted text' test echo x=1
+awk done readonly grep readonly -eu local
+		2>/dev/null | local ${HOME} ${HOME} readonly cd local
+	-eu done printf "$@" && /usr/bin echo echo readonly
+		/usr/bin x=1 2>/dev/null "$1" done x=1 test
+	"$@" awk ${HOME} "$@" | cd echo local
+		&& $(pwd) | ${HOME} local | $(pwd)
+2>/dev/null --verbose 2>/dev/null
+		printf grep readonly grep x=1 $(pwd) "$@" $(pwd)
+grep cd $(pwd) test done --verbose x=1 echo test $(pwd) 'quoted text'
+	${HOME} && && 2>/dev/null sed | cd grep && export
+		readonly awk grep 2>/dev/null printf readonly awk awk --verbose "$1"
+	local grep echo done
+	| then --verbose grep 2>/dev/null
+		'quoted text' ${HOME} | then grep done readonly echo && local
+awk done --verbose export done awk
+/usr/bin local test printf ${HOME}
+	done "$@" readonly && 2>/dev/null export grep
+	'quoted text' && && -eu x=1 x=1 "$@" export readonly | $(pwd)
+		awk sed 2>/dev/null "$1" --verbose x=1 test 'quoted text' && $(pwd)
+$(pwd) $(pwd) "$@" /usr/bin -eu | grep /usr/bin
+	export && cd 'quoted text' echo awk printf | && grep ${HOME} grep | test
+$(pwd) done readonly "$1" -eu done local && export 2>/dev/null -eu test readonly
+		"$@" local done grep 2>/dev/null ${HOME}
+	/usr/bin $(pwd) x=1 test /usr/bin $(pwd)
+/usr/bin awk awk /usr/bin done 2>/dev/null "$1" 'quoted text'
+2>/dev/null test printf then "$@" --verbose $(pwd)
+	'quoted text' 'quoted text' x=1 2>/dev/null
+		readonly grep /usr/bin "$1" grep | x=1 -eu $(pwd) x=1 x=1 x=1 readonly "$@" --verbose
+		echo -eu printf printf 'quoted text'
+cd printf ${HOME} printf printf -eu printf sed then export --verbose
+2>/dev/null && local "$@" grep
+2>/dev/null 2>/dev/null printf && cd awk "$1" && 2>/dev/null --verbose
+2>/dev/null done cd export awk export awk done local
+	local done 2>/dev/null echo 2>/dev/null
+		-eu local grep cd readonly
+		/usr/bin "$1" | -eu | printf printf $(pwd) echo
+echo local "$@" awk export printf grep echo awk local
+cd local printf export /usr/bin | --verbose grep test "$@" echo
+		echo done 2>/dev/null
+	local then "$@" printf "$@" grep -eu --verbose
+cd $(pwd) --verbose "$@" test | grep
+--verbose x=1 2>/dev/null cd cd then "$1"
+	done export local | grep x=1
+	2>/dev/null ${HOME} echo /usr/bin -eu done printf 2>/dev/null "$@" done
+	--verbose 2>/dev/null 'quoted text' x=1
+done $(pwd) export export
+		x=1 'quoted text' test done $(pwd) ${HOME} 'quoted text' export &&
+x=1 "$@" --verbose --verbose local ${HOME} grep
+		awk 'quoted text' ${HOME} sed grep 2>/dev/null "$1" ${HOME}
+local 'quoted text' then echo /usr/bin awk -eu cd export x=1 awk "$1" printf
+sed local 2>/dev/null
+		&& local cd $(pwd) ${HOME} ${HOME} -eu -eu printf done test "$@" --verbose
+		x=1 done test ${HOME} readonly 2>/dev/null
+		2>/dev/null && 2>/dev/null readonly | x=1 "$1" 2>/dev/null export
+	"$@" done export local x=1 awk test --verbose echo readonly x=1 "$1"
+then export $(pwd) ${HOME} --verbose | export "$1" awk $(pwd) export
+local echo $(pwd) readonly then done 2>/dev/null
+		'quoted text' 'quoted text' then cd printf printf readonly -eu
+$(pwd) echo | local sed /usr/bin 'quoted text' echo ${HOME} sed printf local
+		grep "$1" local | 'quoted text'
+		cd grep && echo test | /usr/bin echo ${HOME} done echo printf cd
+		"$@" /usr/bin cd ${HOME} then "$@" "$1" cd awk grep grep done
+		cd ${HOME} local awk echo 2>/dev/null local /usr/bin $(pwd)
+echo then done --verbose grep | then grep printf &&
+		2>/dev/null $(pwd) printf
+		awk test echo test sed local grep ${HOME} ${HOME} | --verbose local $(pwd)
+	${HOME} ${HOME} test printf cd then x=1 test $(pwd) --verbose grep &&
+	then echo grep "$@" 2>/dev/null ${HOME} readonly grep sed | x=1 then
+local -eu && | ${HOME} --verbose /usr/bin | -eu
+		grep sed echo cd grep awk $(pwd) grep
+		export /usr/bin grep --verbose echo
+		cd 2>/dev/null local && | "$@" "$1" -eu printf "$@" sed
+export printf then cd done && "$1" cd /usr/bin -eu then "$@"
+echo echo x=1 local export | cd -eu 2>/dev/null ${HOME} $(pwd)
+	$(pwd) 'quoted text' 'quoted text' done 'quoted text' ${HOME} x=1
+	/usr/bin /usr/bin printf cd readonly printf sed
+sed "$@" /usr/bin echo --verbose "$@" -eu
+	--verbose "$1" sed "$1" then export 2>/dev/null
+	readonly awk && grep sed --verbose test readonly /usr/bin
+	readonly sed x=1 -eu cd awk --verbose --verbose
+		done x=1 'quoted text' awk then then readonly /usr/bin
+	then local cd export /usr/bin 'quoted text'
+2>/dev/null test printf done sed test ${HOME} | printf export
+	cd | /usr/bin && echo "$@" echo test --verbose
+	grep cd printf ${HOME} && then then awk printf sed 2>/dev/null awk
+	cd -eu "$1" sed "$@" cd $(pwd) "$1" cd "$@" then export cd export x=1
+grep --verbose /usr/bin cd then ${HOME} echo grep
+		x=1 readonly -eu 'quoted text'
+		grep x=1 ${HOME} ${HOME} grep echo --verbose
+		sed done done cd awk "$@" /usr/bin readonly printf
+		export cd echo x=1 awk --verbose
+		--verbose "$@" -eu --verbose
+	&& 'quoted text' awk x=1 -eu 2>/dev/null
+	readonly ${HOME} awk --verbose test && $(pwd) && then sed cd sed ${HOME}
+		done echo export grep test $(pwd) | 'quoted text' $(pwd)
+	x=1 "$@" then --verbose 2>/dev/null 2>/dev/null
+		export x=1 "$@" echo awk test echo
+| | && test 'quoted text' export export 'quoted text'
+	"$@" "$1" 'quoted text' /usr/bin echo 'quoted text' export test "$@" export 2>/dev/null
+sed echo /usr/bin /usr/bin echo $(pwd) cd 2>/dev/null local sed | && ${HOME} printf
+		x=1 ${HOME} sed --verbose "$@" -eu x=1 cd export awk export "$@"
+	"$1" "$@" then grep cd echo grep export x=1 sed sed done $(pwd)
+done $(pwd) grep test sed -eu then && 'quoted text' 2>/dev/null export "$1"
+	${HOME} "$@" echo "$1" cd done --verbose $(pwd) && export ${HOME}
+	cd then ${HOME} && "$1" x=1 "$1" "$@" echo 2>/dev/null cd "$@" | sed
+	&& then readonly sed grep "$1" | export 'quoted text' then
+then grep sed export awk done printf
+		2>/dev/null grep awk printf grep && ${HOME} grep
+		readonly test printf 2>/dev/null x=1 export then "$1" 'quoted text'
+		cd 2>/dev/null | sed printf $(pwd) $(pwd) then
+		/usr/bin x=1 awk export /usr/bin 2>/dev/null && 'quoted text' then "$@"
+		-eu sed awk then "$1" && printf done local 'quoted text' "$1"
+printf $(pwd) echo local sed readonly cd x=1 echo
+		export done echo done echo cd readonly x=1 && echo
+	local x=1 $(pwd) "$@" awk "$@" cd printf cd 'quoted text' ${HOME} "$1"
+		then echo 2>/dev/null printf readonly then readonly | 2>/dev/null
+	test "$1" -eu "$@" then done --verbose -eu awk &&
+-eu printf readonly export readonly echo 'quoted text' --verbose export 'quoted text'
+		echo sed 'quoted text' awk && "$@" cd $(pwd) x=1 test -eu readonly
+		grep export x=1 cd -eu printf --verbose
+	&& awk x=1 ${HOME} "$@" readonly awk -eu then -eu grep -eu export cd cd "$@"
+awk 2>/dev/null -eu local --verbose ${HOME} "$1"
+	/usr/bin | done | cd done echo && printf ${HOME} $(pwd)
+printf x=1 'quoted text' $(pwd)
+$(pwd) -eu done echo ${HOME} "$@" readonly done
+	printf 'quoted text' | $(pwd) local
+printf sed local x=1 $(pwd) 2>/dev/null local grep | sed echo
+	&& then /usr/bin local cd | "$1" /usr/bin "$1"
+	printf && echo x=1 --verbose cd done cd printf then printf sed done
+echo done -eu readonly done | awk readonly done x=1 then && awk readonly "$@"
+cd ${HOME} cd | "$1" 'quoted text' cd 'quoted text' && awk export x=1 sed &&
+	cd "$1" local -eu /usr/bin printf --verbose export local export x=1 awk --verbose
+		echo local cd printf --verbose export test --verbose "$1"
+	-eu 2>/dev/null && ${HOME} sed export awk done
+	$(pwd) 2>/dev/null 2>/dev/null echo local local
+	cd grep done 2>/dev/null x=1 /usr/bin | ${HOME} "$1" --verbose /usr/bin
+cd echo local sed | export 'quoted text'
+		&& | local then echo then awk awk sed local | "$1" -eu readonly test readonly
+"$@" test printf then done --verbose awk echo done
+${HOME} x=1 then export cd ${HOME} ${HOME}
+		/usr/bin done x=1 x=1
+then | grep --verbose cd "$1" ${HOME} readonly
+printf | grep --verbose x=1 awk $(pwd) --verbose 'quoted text'
+		--verbose x=1 then /usr/bin done 'quoted text' $(pwd)
+		grep then sed awk readonly 2>/dev/null export sed grep &&
+	&& grep -eu /usr/bin sed && grep --verbose $(pwd) awk done readonly --verbose test
+		echo $(pwd) readonly printf export local ${HOME}
+$(pwd) echo $(pwd) printf | x=1 local $(pwd) awk export
+		"$@" x=1 --verbose then 'quoted text' "$@" awk done awk 2>/dev/null grep
+sed local --verbose done printf sed local cd "$@" 'quoted text'
+		/usr/bin x=1 sed $(pwd) grep $(pwd) $(pwd) 2>/dev/null
+		echo | $(pwd) "$1" 'quoted text'
+		"$1" 2>/dev/null cd echo readonly && sed echo test test | $(pwd)
+		printf /usr/bin "$1" readonly echo "$@" cd export && awk awk $(pwd) grep
+		&& echo sed "$1" echo "$1" $(pwd) "$@" 'quoted text' | readonly sed
+	awk $(pwd) && /usr/bin readonly
+test awk "$@" | printf sed export
+	printf printf local awk done awk x=1 sed export printf
+	printf then && -eu printf local export then printf && cd cd cd readonly
+2>/dev/null readonly echo "$1" "$1" cd local test x=1 2>/dev/null
+2>/dev/null 'quoted text' echo done printf &&
+	cd "$@" ${HOME} 2>/dev/null echo sed done printf done "$1" | done $(pwd) export
+	awk sed "$1" ${HOME} "$@" x=1 ${HOME} "$@"
+	x=1 "$@" echo | grep x=1 --verbose "$@" 2>/dev/null ${HOME} x=1 -eu awk --verbose
+		sed printf $(pwd) --verbose --verbose done printf done local $(pwd) --verbose
+		printf awk -eu "$@" && --verbose -eu 2>/dev/null | echo done
+		local "$@" export | local 'quoted text' cd echo "$@" echo cd
+	then readonly done "$@" --verbose
+	then readonly 2>/dev/null "$1" x=1 /usr/bin printf then "$@" awk
+		cd "$@" 2>/dev/null | --verbose $(pwd) $(pwd) then --verbose test
+awk "$@" local then cd "$@" $(pwd) sed ${HOME} | grep
+	sed cd sed --verbose 'quoted text' -eu
+		&& 2>/dev/null /usr/bin grep grep printf grep done | 2>/dev/null done awk -eu
+	local then && then done awk echo
+	x=1 2>/dev/null echo 'quoted text' --verbose | test "$@" test
+	--verbose test "$1" printf "$@" --verbose 'quoted text' --verbose x=1 sed
+	x=1 $(pwd) | export 'quoted text' readonly ${HOME} 'quoted text'
+x=1 then 2>/dev/null printf local then ${HOME}
+	awk export test local $(pwd) then done | "$1" ${HOME} --verbose
+		&& "$@" 'quoted text' sed | readonly /usr/bin -eu then local
+	x=1 cd grep local "$@" "$@" grep done printf grep local 'quoted text' sed local
+	printf sed /usr/bin 'quoted text' -eu local --verbose then readonly
+		export echo 2>/dev/null cd -eu echo local
+		-eu grep "$@" then test | then ${HOME} -eu echo
+		readonly /usr/bin /usr/bin sed printf export readonly printf ${HOME}
+cd | $(pwd) && then "$@" done grep --verbose local echo export
+		$(pwd) x=1 printf then cd echo x=1 test
+		done $(pwd) then sed export awk "$1"
+grep 2>/dev/null 'quoted text' | export export sed done then done $(pwd) echo 2>/dev/null
+	printf local x=1 && /usr/bin -eu | echo printf awk
+awk ${HOME} 'quoted text' grep done x=1 printf
+		/usr/bin local ${HOME} readonly
+-eu then | sed export grep "$1" ${HOME} $(pwd) readonly ${HOME}
+cd 'quoted text' echo /usr/bin test grep
+	&& --verbose echo "$@" -eu 2>/dev/null | $(pwd) --verbose grep ${HOME} awk
+	2>/dev/null export local --verbose /usr/bin cd export $(pwd)
+&& readonly sed then done cd ${HOME} done ${HOME} && awk x=1 |
+&& /usr/bin export 'quoted text' --verbose grep
+"$@" test awk 2>/dev/null 2>/dev/null
+		-eu "$@" awk cd $(pwd) done && readonly then && sed local -eu awk -eu export
+echo --verbose echo awk | && echo x=1 2>/dev/null
+	"$1" $(pwd) readonly sed 2>/dev/null -eu -eu echo x=1 && x=1 awk --verbose ${HOME}
+grep echo x=1 | printf 2>/dev/null done export done --verbose
+		local $(pwd) done 'quoted text' cd readonly 2>/dev/null
+grep 2>/dev/null | $(pwd) 2>/dev/null then ${HOME} 'quoted text'
+readonly && awk done grep ${HOME} | ${HOME} 2>/dev/null sed done x=1 $(pwd)
+	&& readonly "$@" sed &&
+	test done then readonly awk sed /usr/bin && then
+		echo x=1 /usr/bin -eu | echo 'quoted text'
+		$(pwd) --verbose x=1 cd done grep local readonly --verbose export
+cd grep | readonly grep done then awk printf
+2>/dev/null local x=1
+x=1 printf 'quoted text' readonly test 2>/dev/null /usr/bin x=1 awk readonly
+	'quoted text' printf 2>/dev/null && done ${HOME}
+/usr/bin local x=1 ${HOME} "$1" export
+	awk "$@" /usr/bin awk printf | 2>/dev/null 2>/dev/null
+		'quoted text' done done x=1 awk done "$1" && cd && local 2>/dev/null "$1"
+done 'quoted text' -eu x=1
+readonly 2>/dev/null && then
+grep printf readonly cd $(pwd) | /usr/bin test local | "$@"
+		"$@" "$1" local done -eu export "$@" x=1 then
+x=1 -eu local export x=1 "$1" readonly readonly grep && printf
+sed x=1 printf "$@" grep done
+then export test done x=1 --verbose export /usr/bin
+		"$@" && ${HOME} sed 2>/dev/null -eu "$1" echo -eu
+		${HOME} -eu echo x=1 "$@" done "$@" && export then --verbose $(pwd) | 2>/dev/null
+sed "$1" --verbose test local 'quoted text' grep
+test "$1" test "$@" sed --verbose
+	&& test then /usr/bin | printf | export local "$@" echo grep sed /usr/bin
+		grep | local x=1 echo local grep sed | cd && --verbose
+		"$@" export && done test 'quoted text'
+	test printf && echo test export done done local "$@" export 'quoted text'
+	local export | 'quoted text' $(pwd) -eu cd printf export /usr/bin
+| test "$1" sed ${HOME} test then local x=1 then test awk readonly -eu
+	$(pwd) test grep x=1 test $(pwd) printf
+		$(pwd) "$1" "$@" x=1 test && then echo 'quoted text' "$1" local printf && grep
+/usr/bin | x=1 then readonly export echo cd 2>/dev/null x=1 'quoted text' test
+	local then then | && $(pwd) awk | /usr/bin -eu grep awk -eu echo
+	'quoted text' | test ${HOME}
+/usr/bin cd -eu grep export 'quoted text' && x=1 cd x=1 echo done export
+		$(pwd) awk ${HOME} local
+readonly /usr/bin echo cd echo --verbose -eu /usr/bin cd | | readonly
+	grep -eu x=1 printf 'quoted text' test ${HOME} 2>/dev/null
+	--verbose "$@" ${HOME} echo
+"$1" -eu export --verbose test
+awk awk "$1" cd grep echo -eu
+		${HOME} $(pwd) printf
+$(pwd) | sed "$1" awk readonly awk then --verbose sed sed $(pwd) done
+readonly echo 2>/dev/null "$1"
+/usr/bin awk -eu echo sed then
+		sed echo ${HOME} echo grep awk readonly x=1 && && $(pwd) export --verbose
+		done grep "$1" "$1" test printf sed then x=1 /usr/bin
+| done printf readonly x=1 x=1 "$@" local | 2>/dev/null $(pwd) "$1"
+		awk x=1 printf "$@" 2>/dev/null done ${HOME} local
+--verbose --verbose sed grep export | x=1 "$1" /usr/bin
+	${HOME} 'quoted text' &&
+sed $(pwd) "$@" sed grep printf test
+	/usr/bin 'quoted text' then sed 'quoted text' | $(pwd) readonly
+		&& awk then 2>/dev/null /usr/bin 'quoted text' && 2>/dev/null
+--verbose local "$@" "$1" printf --verbose x=1 2>/dev/null
+	2>/dev/null export x=1 | test done /usr/bin readonly done echo
+		test $(pwd) readonly $(pwd) ${HOME} 'quoted text' sed "$@" sed cd awk
+--verbose printf echo 'quoted text' test "$1"
+		&& && export readonly "$1" $(pwd) "$1"
+	-eu awk sed | -eu printf "$1" local awk 'quoted text'
+&& readonly awk then
+		then /usr/bin local 2>/dev/null
+/usr/bin $(pwd) readonly ${HOME} cd ${HOME} $(pwd) ${HOME}
+	"$1" test --verbose local then local
+		$(pwd) && "$@" awk /usr/bin cd sed 2>/dev/null then readonly cd x=1 done export
+		| | | then local /usr/bin
+	--verbose "$1" "$1" "$@" then && "$@" grep grep /usr/bin $(pwd) --verbose awk
+	2>/dev/null readonly /usr/bin
+| done --verbose /usr/bin readonly -eu then | cd x=1 $(pwd) 2>/dev/null
+then awk local | ${HOME} test cd printf local grep printf
+		"$1" printf ${HOME} export ${HOME} printf -eu
+2>/dev/null && local sed echo | awk awk
+"$1" $(pwd) local printf readonly "$1" cd ${HOME} --verbose
+		printf x=1 "$@" echo awk then ${HOME} && cd done -eu
+-eu 'quoted text' cd | done sed && $(pwd)
+	awk $(pwd) cd --verbose x=1 done readonly && 2>/dev/null
+awk | "$1" $(pwd) | 2>/dev/null /usr/bin 'quoted text'
+	"$1" test | x=1 /usr/bin echo 'quoted text'
+		| local && --verbose "$@" test 2>/dev/null
+		&& x=1 -eu done 2>/dev/null -eu | --verbose export | done test
+		awk /usr/bin x=1 ${HOME} readonly awk test ${HOME} |
+cd grep | 2>/dev/null x=1 ${HOME}
+	done sed ${HOME} && 'quoted text' export cd then
+		-eu sed /usr/bin $(pwd) cd test "$@" x=1 awk "$1" /usr/bin export | grep test
+sed printf ${HOME} $(pwd) then cd 'quoted text' x=1 /usr/bin test "$@" "$@" then
+		local --verbose sed done test $(pwd) "$@" readonly "$1" done printf x=1 export
+&& && 'quoted text' -eu --verbose "$@" /usr/bin && ${HOME} cd test then
+grep echo cd $(pwd) readonly "$1" test cd --verbose then echo cd x=1 && export
+	'quoted text' done ${HOME}
+	done x=1 $(pwd) --verbose printf
+&& cd ${HOME} && 2>/dev/null readonly /usr/bin "$1" cd local ${HOME} sed cd
+		export "$@" | awk "$1" /usr/bin echo /usr/bin cd sed "$1"
+/usr/bin sed printf cd | sed 2>/dev/null
+		test export $(pwd) sed $(pwd) "$@" /usr/bin grep cd cd
+	grep local echo 2>/dev/null x=1 local /usr/bin "$@" local
+	cd && grep readonly test sed test x=1 --verbose
+"$@" "$1" "$1" && $(pwd)
+awk readonly -eu 'quoted text' readonly 2>/dev/null readonly
+	cd grep --verbose 2>/dev/null
+	printf --verbose done "$1" 'quoted text'
+	sed && printf cd x=1 awk && done printf done
+		2>/dev/null sed sed readonly done ${HOME}
+	export | local done 2>/dev/null /usr/bin echo export
+		"$1" local done "$1" $(pwd) cd sed "$1" grep 'quoted text' cd echo
+export ${HOME} 2>/dev/null && /usr/bin | done echo awk ${HOME} sed
+	"$1" "$1" ${HOME} ${HOME} local "$@"
+	"$1" ${HOME} test then x=1 && readonly done /usr/bin echo "$@" 'quoted text'
+		&& test x=1 grep && grep echo "$@" grep cd done | echo 2>/dev/null
+		export cd awk --verbose sed cd readonly done -eu export
+"$@" 'quoted text' 2>/dev/null local && 'quoted text' echo
+--verbose awk cd printf grep | printf local then 2>/dev/null
+sed && sed "$@" 2>/dev/null then "$@" "$1" $(pwd)
+sed 2>/dev/null test $(pwd) ${HOME} ${HOME} x=1 | echo grep export && grep
+		x=1 awk echo | 'quoted text' awk && readonly printf
+		awk cd 'quoted text' | | test -eu "$@" 2>/dev/null test 'quoted text'
+		2>/dev/null x=1 then echo x=1 x=1 awk
+		/usr/bin then /usr/bin $(pwd)
+		local ${HOME} 2>/dev/null
+	readonly sed x=1 /usr/bin cd -eu test then /usr/bin 2>/dev/null | sed
+	&& ${HOME} x=1 'quoted text' --verbose grep -eu "$1" ${HOME} printf
+-eu /usr/bin $(pwd) export "$@" -eu ${HOME} ${HOME} export
+		done local done test sed -eu "$@" && 2>/dev/null --verbose
+	printf test sed -eu then
+		local printf x=1 local "$1" local awk echo done --verbose printf "$1"
+	sed cd 'quoted text' x=1 | then cd -eu ${HOME} | "$1" cd echo
+		echo sed awk printf export test export
+"$@" && echo cd ${HOME} test awk cd awk 2>/dev/null echo
+${HOME} echo export grep 'quoted text' ${HOME} local local
+| local echo cd x=1 grep test 2>/dev/null
+"$1" 2>/dev/null cd local awk
+		local local $(pwd) $(pwd) printf -eu x=1 x=1 then 2>/dev/null
+	2>/dev/null 'quoted text' 2>/dev/null
+awk local sed readonly --verbose cd x=1 then "$1"
+	awk cd readonly printf "$@" x=1 "$1" then -eu
+	local x=1 "$@" local "$1" cd export grep readonly &&
+echo export $(pwd) grep grep readonly cd -eu
+		local echo ${HOME} cd export | && echo readonly echo export export printf then
+		done local "$@" "$@" local -eu 2>/dev/null export
+--verbose "$@" 'quoted text' $(pwd) export echo
+		--verbose readonly export
+		/usr/bin --verbose "$@" awk "$@" echo printf "$@" done sed ${HOME}
+/usr/bin /usr/bin -eu "$@" 'quoted text' test then "$1" done
+		then test ${HOME} | /usr/bin done sed 2>/dev/null
+-eu && awk cd "$@" --verbose x=1 && sed
+	echo | sed export export done then sed 'quoted text' printf "$1" ${HOME}
+		local 'quoted text' export awk awk 2>/dev/null 2>/dev/null 2>/dev/null then awk
+	sed awk grep cd -eu done "$1" sed -eu /usr/bin 'quoted text'
+		"$1" x=1 export "$@" --verbose test "$@" 'quoted text' && export sed 'quoted text'
+	sed export local export 'quoted text'
+test | local echo done done 'quoted text' export
+| cd "$1" 'quoted text' cd export
+--verbose then echo x=1 cd done test echo ${HOME} 2>/dev/null export /usr/bin
+readonly | export done /usr/bin x=1 printf sed x=1 echo readonly
+2>/dev/null readonly cd local test then 'quoted text' sed printf export /usr/bin
+		/usr/bin 2>/dev/null 'quoted text'
+		export "$1" done x=1 then done "$1" ${HOME} local &&
+	x=1 "$@" printf 2>/dev/null
+	"$@" ${HOME} then printf sed
+local echo "$@" "$@" grep sed /usr/bin then then echo 'quoted text'
+	done "$@" 'quoted text' x=1 awk awk "$1" /usr/bin awk 2>/dev/null
+	"$1" done x=1 /usr/bin $(pwd) 2>/dev/null
+		grep printf export ${HOME} 2>/dev/null
+		test echo $(pwd) 2>/dev/null "$@" done echo ${HOME} test /usr/bin
+&& echo $(pwd) "$@" echo "$@" ${HOME} awk echo done && x=1 -eu --verbose "$@"
+		export && sed --verbose then 'quoted text' /usr/bin awk --verbose
+/usr/bin cd readonly && 'quoted text' ${HOME} 2>/dev/null export
+	x=1 -eu local cd cd | printf printf -eu -eu "$@" cd $(pwd) test readonly
+readonly export --verbose ${HOME} --verbose 'quoted text'
+	'quoted text' "$1" awk && export /usr/bin done
+done $(pwd) cd 2>/dev/null
+	awk "$@" export 'quoted text' --verbose then cd x=1 $(pwd)
+	--verbose test /usr/bin | test
+		readonly readonly --verbose $(pwd)
+		done done -eu sed done --verbose local sed awk | done awk "$1" echo --verbose
+	grep --verbose local awk -eu ${HOME} ${HOME} cd cd "$@" readonly /usr/bin
+	grep grep awk -eu && x=1 echo /usr/bin
+		"$@" x=1 grep 2>/dev/null x=1 'quoted text' | echo done test "$1"
+echo test $(pwd) cd sed sed local done && sed "$@" /usr/bin ${HOME}
+		readonly export export 2>/dev/null readonly x=1 cd printf readonly
+		echo awk 'quoted text' -eu sed echo cd echo 'quoted text' readonly 2>/dev/null
+		test grep --verbose --verbose ${HOME}
+	readonly "$@" export | cd cd
+		printf then export done readonly awk "$1" cd ${HOME} "$@" grep cd cd 2>/dev/null
+	2>/dev/null "$@" echo test ${HOME} export x=1 done ${HOME} "$@" 'quoted text'
+-eu echo export ${HOME} x=1 grep
+	local readonly cd cd export readonly -eu | test grep $(pwd)
+		local --verbose printf /usr/bin echo printf printf
+		x=1 | ${HOME} --verbose 'quoted text' 2>/dev/null
+		then /usr/bin export local "$1" echo && 'quoted text'
+		--verbose local 'quoted text' |
+cd /usr/bin export echo 2>/dev/null test "$@" $(pwd) cd cd awk
+	-eu /usr/bin cd readonly /usr/bin sed
+	'quoted text' done && ${HOME} grep /usr/bin $(pwd) x=1 ${HOME} -eu then sed -eu
+		printf grep x=1 "$@" readonly awk && printf done
+awk local export "$@" 'quoted text' local && "$@" /usr/bin
+cd awk ${HOME} export done
+	--verbose test -eu 2>/dev/null x=1 awk x=1 -eu test && sed test
+2>/dev/null "$@" cd --verbose && test ${HOME}
+	export sed local grep | done printf readonly then ${HOME} x=1 | awk test ${HOME}
+printf ${HOME} printf 'quoted text' echo
+	cd test "$@" x=1 | sed sed
+	2>/dev/null done test -eu && 'quoted text' local /usr/bin
+		'quoted text' /usr/bin | 2>/dev/null echo | then cd $(pwd)
+	done sed sed printf $(pwd)
+	&& then done 'quoted text' x=1 cd 'quoted text' echo $(pwd) echo && | echo then
+		done cd "$@" sed done -eu x=1 sed ${HOME} sed cd 2>/dev/null
+		$(pwd) then awk /usr/bin printf | cd echo
+	$(pwd) x=1 $(pwd) "$@" "$@" grep awk 'quoted text' && ${HOME} 2>/dev/null
+		| 2>/dev/null export "$1" $(pwd) export x=1 2>/dev/null
+		&& && test --verbose /usr/bin && done ${HOME} sed 2>/dev/null 'quoted text'
+${HOME} awk /usr/bin echo printf printf "$1" test | export | done
+		test sed cd "$1" cd 2>/dev/null
+cd "$1" then | 'quoted text' ${HOME} x=1
+	2>/dev/null ${HOME} echo printf cd local test $(pwd) printf then $(pwd) printf test
+		-eu 'quoted text' x=1 | "$@" | && printf sed /usr/bin
+	x=1 ${HOME} cd 'quoted text' -eu 2>/dev/null then ${HOME} x=1 local && --verbose
+	| 2>/dev/null readonly readonly sed awk /usr/bin --verbose "$1" readonly ${HOME}
+		${HOME} && readonly | $(pwd) done "$1" /usr/bin awk $(pwd) | done "$@" readonly
+done "$@" "$1" ${HOME} sed
+local "$@" | && echo "$1" --verbose printf 2>/dev/null
+	then then export test export grep ${HOME} done grep then echo "$@" readonly x=1
+readonly then printf $(pwd) 2>/dev/null cd export cd x=1 awk "$@" | awk done
+	local awk sed /usr/bin && /usr/bin awk test "$@" /usr/bin awk
+		-eu export "$@" local &&
+		/usr/bin "$@" ${HOME} x=1 then export "$1" 2>/dev/null readonly
+	echo grep "$1" --verbose && ${HOME} grep "$1" 2>/dev/null export "$1"
+	x=1 -eu grep local /usr/bin grep 2>/dev/null x=1 ${HOME} 2>/dev/null
+		sed done test ${HOME} local && printf echo
+echo "$1" grep then local $(pwd) sed && "$@" -eu done sed
+		awk && 'quoted text'
+-eu -eu done 'quoted text' then echo --verbose
+		awk /usr/bin export $(pwd) --verbose ${HOME} -eu cd ${HOME} /usr/bin export
+test cd 'quoted text' printf --verbose local | x=1 x=1 cd x=1 -eu
+echo 2>/dev/null --verbose then 2>/dev/null -eu awk export --verbose --verbose
+local /usr/bin readonly then test echo "$@" sed then -eu printf test
+	sed readonly && --verbose
+'quoted text' 'quoted text' echo
+	x=1 test /usr/bin 'quoted text' /usr/bin 2>/dev/null cd cd | test &&
+	cd && -eu printf $(pwd)
+		"$@" readonly ${HOME} 2>/dev/null
+		readonly grep grep readonly cd echo && echo grep cd
+-eu x=1 -eu "$@" "$@" --verbose 2>/dev/null /usr/bin
+$(pwd) 'quoted text' x=1 echo x=1 export done awk 2>/dev/null
+	sed awk && && echo 2>/dev/null 'quoted text'
+&& readonly ${HOME} done 'quoted text' awk sed
+2>/dev/null ${HOME} done "$@" test cd awk grep sed --verbose && "$@" 2>/dev/null
+		sed sed "$1" "$1" $(pwd) x=1 done sed | grep printf ${HOME}
+cd | "$1" /usr/bin test x=1 "$@" /usr/bin awk --verbose x=1 "$1"
+	sed printf && local printf "$@" "$@" done && sed export "$@" -eu | test --verbose
+		test then "$1" export "$1" | ${HOME} cd printf sed export && 2>/dev/null
+	cd done 2>/dev/null test export done -eu x=1 cd --verbose --verbose
+"$1" ${HOME} awk -eu -eu
+		'quoted text' awk grep cd $(pwd) | "$@" $(pwd) $(pwd) 2>/dev/null ${HOME} "$1"
+	&& cd "$1" awk done readonly
+		done printf grep awk grep then echo test | readonly test "$1" &&
+printf -eu x=1 -eu sed awk local /usr/bin "$@" x=1 done echo "$@" printf
+then ${HOME} | sed sed grep printf cd x=1 $(pwd)
+&& && 2>/dev/null cd -eu export
+		test then printf local $(pwd) then 'quoted text'
+local 2>/dev/null "$1" printf echo
+	x=1 echo export awk "$@" done done awk /usr/bin "$1" test sed
+	export /usr/bin $(pwd) 2>/dev/null /usr/bin 2>/dev/null | "$@" local grep done
+		export local x=1 awk cd test awk -eu "$@" | "$1" && test grep then
+cd 'quoted text' 2>/dev/null 'quoted text' printf && --verbose
+		--verbose test local "$1" then
+		$(pwd) cd awk 2>/dev/null 2>/dev/null
+		awk awk && && x=1 cd -eu | test printf && cd echo "$1" done export
+		local awk done ${HOME} $(pwd) cd ${HOME}
+	local export "$1" done x=1 then --verbose $(pwd) --verbose awk 2>/dev/null
+		$(pwd) grep && --verbose 2>/dev/null x=1 x=1 x=1 ${HOME}
+printf $(pwd) 2>/dev/null "$@"
+		2>/dev/null x=1 x=1 $(pwd) sed "$@" 2>/dev/null
+	$(pwd) "$@" local readonly "$@" awk local
+		cd "$1" /usr/bin x=1 "$@" cd | && ${HOME} && --verbose grep grep readonly sed ${HOME}
+		printf | sed then test echo /usr/bin sed done
+grep local -eu --verbose
+		-eu then done ${HOME} 'quoted text'
+	| 'quoted text' | | awk -eu 2>/dev/null && "$@" awk readonly
+		readonly x=1 | 'quoted text' /usr/bin echo done 'quoted text' printf
+"$@" && && test then local
+export 'quoted text' done
+"$@" readonly $(pwd) -eu
+printf export --verbose && sed | && && -eu sed 2>/dev/null grep sed local echo
+${HOME} cd 2>/dev/null
+export readonly grep "$1" /usr/bin awk /usr/bin cd done "$@" "$@"
+	grep cd "$1" cd awk test test /usr/bin 2>/dev/null
+	&& | /usr/bin && echo 'quoted text' test sed grep sed $(pwd) -eu local 2>/dev/null
+"$@" /usr/bin x=1 | local /usr/bin /usr/bin "$@" && -eu "$1"
+	then test "$@" echo awk --verbose /usr/bin export "$@"
+		${HOME} $(pwd) x=1 then echo test readonly "$1" --verbose grep done "$@"
+	"$@" x=1 ${HOME} done readonly printf
+	x=1 grep "$@" && readonly && readonly "$@"
+/usr/bin cd done readonly /usr/bin "$1"
+export local /usr/bin 2>/dev/null ${HOME} 2>/dev/null
+		echo awk local "$@" grep /usr/bin sed then
+		-eu x=1 "$@" awk cd x=1 "$@"
+		test awk ${HOME} cd export
+${HOME} export x=1 2>/dev/null --verbose then then --verbose
+export -eu export $(pwd) ${HOME} $(pwd) done /usr/bin echo 2>/dev/null
+x=1 awk --verbose --verbose
+export 'quoted text' | done echo then -eu $(pwd) $(pwd)
+		&& ${HOME} && echo test "$@" --verbose readonly then test -eu then
+export sed ${HOME} && local printf --verbose | then /usr/bin x=1
+&& /usr/bin && --verbose grep "$@" done sed
+		local ${HOME} test "$1" | test "$@" && | awk $(pwd) | --verbose --verbose &&
+-eu "$@" export | "$1" /usr/bin
+		"$@" --verbose readonly "$1" local 'quoted text' export awk readonly
+	&& x=1 --verbose | test cd "$1" | cd printf 'quoted text'
+	"$@" sed sed echo sed "$1" 2>/dev/null -eu | readonly "$@" test --verbose
+"$1" --verbose grep printf cd |
+sed && test 'quoted text' sed 2>/dev/null sed "$1" -eu "$1" readonly printf --verbose
+		sed awk sed /usr/bin 'quoted text' awk
+		then /usr/bin --verbose awk echo
+		sed $(pwd) done x=1 then | awk
+		cd test && grep -eu cd 2>/dev/null awk $(pwd) grep x=1 2>/dev/null
+done "$@" ${HOME} ${HOME} echo readonly -eu | sed sed 'quoted text'
+	| echo "$@" cd --verbose
+--verbose x=1 2>/dev/null /usr/bin "$@" test sed echo grep awk ${HOME}
+		/usr/bin 'quoted text' printf "$@"
+		-eu 2>/dev/null && && readonly --verbose && printf
+	done | printf /usr/bin echo sed
+		sed sed done test readonly 'quoted text' /usr/bin sed then readonly
+2>/dev/null -eu $(pwd) && sed awk printf echo done test then
+/usr/bin export /usr/bin -eu -eu test export && sed cd ${HOME} -eu -eu
+	grep export grep printf 2>/dev/null 'quoted text'
+local grep test echo "$1" 2>/dev/null grep
+echo 2>/dev/null /usr/bin local 'quoted text'
+		${HOME} | | --verbose --verbose
+	local && 2>/dev/null 'quoted text' "$@" printf then done
+		/usr/bin then export /usr/bin 'quoted text' echo export
+	readonly /usr/bin cd 'quoted text'
+	readonly 2>/dev/null echo test | grep test && grep /usr/bin
+export && local "$1" grep cd -eu && 'quoted text' x=1
+echo sed then cd && cd awk awk /usr/bin cd cd /usr/bin printf && $(pwd) $(pwd)
+		${HOME} 'quoted text' "$1" 2>/dev/null test -eu echo grep grep
+	test -eu --verbose grep ${HOME} printf ${HOME} 'quoted text'
+		"$@" 'quoted text' export done printf --verbose
+	readonly done $(pwd) 'quoted text' sed sed
+		$(pwd) | printf printf | export "$@" ${HOME} printf | then && --verbose
+&& then readonly 2>/dev/null /usr/bin local x=1 $(pwd) printf
+		grep | readonly echo then done 'quoted text'
+	export 'quoted text' done ${HOME} "$1" grep test $(pwd)
+	2>/dev/null cd ${HOME} test && local /usr/bin
+		2>/dev/null --verbose /usr/bin 2>/dev/null
+'quoted text' echo test && && export 2>/dev/null ${HOME}
+		printf ${HOME} sed "$1"
+| "$@" export awk "$@"
+		&& 'quoted text' /usr/bin --verbose 2>/dev/null awk -eu 2>/dev/null
+	sed 2>/dev/null test /usr/bin
+	"$@" printf then "$1" 2>/dev/null
+	readonly /usr/bin printf --verbose grep
+/usr/bin && 2>/dev/null readonly sed cd x=1 2>/dev/null
+"$1" readonly printf grep awk printf
+	2>/dev/null -eu echo --verbose "$@" awk && cd test 2>/dev/null
+		--verbose /usr/bin then done done
+printf awk $(pwd) awk 'quoted text' printf done grep readonly
+	| echo /usr/bin /usr/bin | printf -eu 'quoted text' done cd 'quoted text' then
+readonly "$@" "$1" echo
+--verbose local cd "$@"
+	printf echo "$@" 2>/dev/null then && done grep
+		'quoted text' awk -eu readonly "$1" grep then test sed printf
+	done sed local --verbose /usr/bin 2>/dev/null sed sed local done awk
+		/usr/bin awk export awk $(pwd) 'quoted text'
+		/usr/bin "$@" readonly done local
+	cd "$@" grep "$1" $(pwd) 'quoted text' 2>/dev/null test "$@" x=1 grep
+		cd 'quoted text' readonly readonly
+		--verbose | x=1 echo "$1" then "$1" local grep grep test 2>/dev/null grep
+/usr/bin 2>/dev/null then done /usr/bin
+		grep 'quoted text' test $(pwd) local local
+		test sed | && 'quoted text' -eu readonly --verbose printf
+	done 2>/dev/null cd --verbose test
+		local | $(pwd) 'quoted text' 'quoted text' local cd awk "$1" export "$@" /usr/bin
+${HOME} ${HOME} | cd 'quoted text'
+	local readonly then local echo cd readonly -eu cd test
+"$@" | --verbose $(pwd) ${HOME} -eu --verbose && && then sed awk
+-eu cd x=1 ${HOME} awk cd grep echo && test -eu -eu grep x=1 echo
+	$(pwd) | then awk /usr/bin then x=1 export -eu -eu ${HOME} -eu /usr/bin x=1 | local
+		/usr/bin readonly ${HOME} /usr/bin 2>/dev/null -eu "$1" ${HOME}
+	echo "$1" /usr/bin x=1 done export export $(pwd) "$1" printf readonly | "$1"
+	$(pwd) ${HOME} && | $(pwd) x=1 test
+	"$1" echo printf done cd "$@" export "$@" 'quoted text'
+	2>/dev/null cd x=1 test then
+	awk done "$1" 2>/dev/null sed "$@" test echo printf 2>/dev/null grep local
+	"$1" "$1" printf -eu echo "$1" cd x=1 && sed done echo 2>/dev/null
+		/usr/bin awk awk done test && | ${HOME} done x=1 ${HOME} sed ${HOME} /usr/bin
+	grep $(pwd) --verbose export /usr/bin && -eu | && && test $(pwd) $(pwd)
+	-eu ${HOME} then "$@" done test x=1 grep /usr/bin echo
+${HOME} && grep grep ${HOME} ${HOME} && grep readonly 2>/dev/null && local
+	done export ${HOME} --verbose
+		--verbose /usr/bin "$1" && x=1 2>/dev/null --verbose done ${HOME}
+	then $(pwd) x=1 'quoted text' done then done sed ${HOME} |
+'quoted text' sed && ${HOME} grep 2>/dev/null
+	done echo echo test | printf ${HOME} sed printf ${HOME}
+		cd && echo local cd done then 'quoted text' local
+	2>/dev/null printf ${HOME} export -eu
+	/usr/bin 2>/dev/null 'quoted text' x=1 "$1"
+x=1 printf test 'quoted text' -eu 'quoted text'
+		--verbose "$1" export printf export echo | printf echo ${HOME} printf
+		awk cd $(pwd) $(pwd) awk test -eu x=1 $(pwd) $(pwd) -eu 'quoted text'
+		2>/dev/null readonly then 2>/dev/null local echo awk /usr/bin
+	"$1" local /usr/bin && grep "$@" readonly local --verbose
+		export && printf --verbose 2>/dev/null && --verbose
+	then x=1 'quoted text' local sed then
+/usr/bin done "$@" 'quoted text' readonly readonly
+		sed test /usr/bin cd ${HOME} "$@" awk --verbose grep
+&& readonly awk done "$1" cd grep cd "$1" x=1 | x=1
+		--verbose cd --verbose x=1 awk local
+test test "$@" test test sed test printf awk 'quoted text' | echo ${HOME} -eu
+	"$@" $(pwd) && done cd "$1" sed grep -eu echo ${HOME}
+awk then -eu $(pwd) $(pwd) "$@" x=1 $(pwd) cd | cd echo 'quoted text' awk
+	x=1 "$@" printf done -eu sed /usr/bin && test ${HOME}
+"$@" awk "$@" done local "$1" test "$@" local local x=1 "$1" "$@"
+	--verbose "$@" ${HOME} then 2>/dev/null
+		echo 2>/dev/null export && grep export
+$(pwd) done export $(pwd) $(pwd) awk "$@" |
+		then "$@" 2>/dev/null x=1 printf local --verbose printf && 2>/dev/null && test
+"$1" local 'quoted text' cd "$1" test "$@" "$@" "$@" done /usr/bin
+--verbose 2>/dev/null printf local sed cd -eu 'quoted text' then
+${HOME} grep $(pwd) grep -eu 'quoted text' /usr/bin readonly
+		--verbose echo local /usr/bin local printf 'quoted text'
+	then cd grep $(pwd) printf then -eu echo --verbose x=1 grep
+then echo test | export readonly x=1 then readonly echo /usr/bin
+/usr/bin grep test --verbose done sed then
+	grep local done && sed export awk /usr/bin
+		| "$@" printf && printf 'quoted text' done
+		-eu /usr/bin /usr/bin done && test x=1 $(pwd) "$@" $(pwd)
+	awk cd printf -eu awk cd done export
+export "$@" 2>/dev/null
+"$@" 2>/dev/null $(pwd)
+	cd | printf printf test /usr/bin sed
+/usr/bin ${HOME} "$1"
+cd sed cd 2>/dev/null grep test
+		awk x=1 awk /usr/bin local done grep --verbose /usr/bin
+		x=1 /usr/bin printf $(pwd) local $(pwd) /usr/bin
+	'quoted text' "$@" ${HOME} /usr/bin && readonly
+sed -eu local && 2>/dev/null local readonly |
+	${HOME} 2>/dev/null sed
+	"$1" | "$1" cd ${HOME} 2>/dev/null 2>/dev/null
+${HOME} cd --verbose echo -eu /usr/bin awk x=1 | awk --verbose printf
+x=1 ${HOME} sed x=1 readonly test
+	echo awk printf done x=1 test test
+	printf $(pwd) local local 'quoted text' 2>/dev/null 2>/dev/null 'quoted text'
+		"$@" then awk $(pwd) local "$1" readonly
+		echo "$1" then local grep "$1" echo 'quoted text'
+| then $(pwd) /usr/bin sed | ${HOME} -eu ${HOME} "$@" then | grep | grep test echo
+		| awk test 'quoted text' export 2>/dev/null $(pwd) x=1 readonly -eu ${HOME} test
+	$(pwd) then test awk 'quoted text' then x=1 "$@" ${HOME} ${HOME}
+	"$@" done 'quoted text' printf printf awk readonly cd "$@"
+	awk && then local test export test
+	export x=1 | --verbose then | -eu | $(pwd)
+then then "$1" export $(pwd)
+export test ${HOME} -eu readonly readonly grep 2>/dev/null --verbose
+		'quoted text' 'quoted text' "$1" test "$@" sed && $(pwd) && done sed
+test /usr/bin ${HOME} then x=1 "$1" && printf | $(pwd)
+"$@" | $(pwd) test "$1" awk "$@"
+	x=1 'quoted text' then | -eu --verbose done test 2>/dev/null local sed
+	--verbose $(pwd) 'quoted text' sed awk && 'quoted text'
+		&& awk $(pwd) readonly ${HOME} printf --verbose cd export -eu test
+test && echo export && then x=1 'quoted text' --verbose grep printf $(pwd)
+--verbose /usr/bin readonly local cd 'quoted text' && done --verbose
+		&& "$@" --verbose 2>/dev/null "$@"
+	grep 2>/dev/null local && done
+		-eu done | local $(pwd) export 'quoted text' | local -eu $(pwd) done test printf
+awk ${HOME} x=1 export sed "$1" "$@" 2>/dev/null
+	sed ${HOME} "$@" done x=1 echo -eu
+${HOME} local awk then
+		echo x=1 "$1" awk echo ${HOME} sed awk "$@" cd then printf
+		2>/dev/null && test "$1" | sed grep
+	printf grep $(pwd) "$1" "$@" printf -eu echo
+	| then ${HOME} readonly "$@" /usr/bin x=1 | 2>/dev/null x=1 awk readonly
+		x=1 $(pwd) $(pwd) 2>/dev/null ${HOME}
+		${HOME} local --verbose && x=1 done && sed done ${HOME} | | then
+export cd done | echo sed sed && export "$1"
+-eu readonly grep local grep x=1 "$1" done ${HOME} 'quoted text' grep /usr/bin
+		${HOME} -eu && 'quoted text' $(pwd) export x=1 readonly
+2>/dev/null && /usr/bin $(pwd) readonly
+		cd echo 2>/dev/null --verbose
+printf printf export printf "$1" /usr/bin 'quoted text'
+	readonly echo printf export "$@" $(pwd) echo /usr/bin ${HOME} 2>/dev/null printf
+		printf done sed /usr/bin done cd $(pwd) sed export 'quoted text' --verbose
+	test printf /usr/bin grep done "$@" 2>/dev/null ${HOME} 'quoted text' export "$@"
+	$(pwd) readonly ${HOME} test readonly --verbose grep "$@" | ${HOME} awk done
+		"$1" printf /usr/bin x=1 sed awk --verbose --verbose
+	echo "$@" | test sed sed printf awk local printf "$@" "$1" "$@" echo x=1 local
+'quoted text' 'quoted text' grep 2>/dev/null
+	readonly readonly readonly | 2>/dev/null export 2>/dev/null cd test
+x=1 done 'quoted text' echo printf 'quoted text' cd echo 'quoted text' export
+	test export 'quoted text' readonly /usr/bin && /usr/bin
+	grep /usr/bin sed awk
+/usr/bin && ${HOME} export --verbose awk 2>/dev/null
+	${HOME} readonly | "$@" --verbose then printf done test
+printf 2>/dev/null -eu cd done --verbose x=1 grep export "$@" readonly
+then x=1 sed && done awk grep
+done echo local done cd readonly test 2>/dev/null awk test "$@" cd printf
+	grep | cd readonly --verbose | x=1 sed $(pwd) | sed printf x=1 "$@" /usr/bin
+'quoted text' then ${HOME} printf sed /usr/bin ${HOME} 'quoted text'
+		printf x=1 ${HOME} /usr/bin readonly | awk then done
+	sed ${HOME} cd | 'quoted text' test cd export $(pwd) then grep "$1" "$@" cd awk
+	/usr/bin then cd --verbose $(pwd) -eu
+awk 2>/dev/null local then awk local sed
+	$(pwd) | echo done cd --verbose sed test readonly
+done readonly readonly ${HOME} "$@" export awk test -eu printf
+	local printf then printf 'quoted text' $(pwd) test readonly printf awk echo
+	&& done echo -eu /usr/bin "$@" local
+	"$@" done then cd grep ${HOME} done "$1"
+	&& cd ${HOME} ${HOME} /usr/bin done /usr/bin local "$@" then local "$@" --verbose
+readonly --verbose readonly
+	echo sed | grep printf done 2>/dev/null $(pwd) readonly readonly $(pwd)
+		'quoted text' 2>/dev/null done export "$1" "$@" awk grep "$1" export $(pwd) awk
+--verbose then readonly echo sed --verbose grep /usr/bin test sed x=1 'quoted text'
+	"$@" local /usr/bin "$@" --verbose
+"$@" export echo export 2>/dev/null
+		then x=1 local grep "$@" awk echo ${HOME} awk sed $(pwd) | --verbose
+"$@" test -eu -eu done cd | 'quoted text' --verbose
+	/usr/bin /usr/bin export done awk 2>/dev/null && sed test 'quoted text' readonly
+		"$@" ${HOME} awk cd 'quoted text' 2>/dev/null 'quoted text' test -eu sed export
+		local printf then 'quoted text' readonly
+		done "$@" | readonly 2>/dev/null x=1 local then awk --verbose 2>/dev/null
+	2>/dev/null 2>/dev/null $(pwd) readonly "$1" $(pwd) echo
+	printf 2>/dev/null grep local 'quoted text'
+		export printf export cd cd printf sed --verbose ${HOME} awk x=1 cd $(pwd)
+readonly grep sed test /usr/bin awk "$1" "$@" echo local | sed $(pwd) then &&
+	-eu $(pwd) x=1 export local then export 'quoted text'
+	"$1" x=1 cd /usr/bin 2>/dev/null readonly && done sed x=1 &&
+	x=1 ${HOME} cd sed then /usr/bin 'quoted text' done "$1" 'quoted text'
+	printf x=1 "$@" then -eu ${HOME}
+echo grep 2>/dev/null 2>/dev/null "$1" then grep printf "$1"
+		done x=1 && x=1 "$1" && "$@" then done export printf then printf "$1" "$@" --verbose
+	readonly /usr/bin -eu x=1 grep
+		2>/dev/null grep local export $(pwd) awk awk ${HOME} export
+x=1 --verbose export export "$1" done sed -eu ${HOME}
+	&& grep 2>/dev/null cd | then local "$@" then -eu export done && test readonly export
+	awk then sed /usr/bin 'quoted text' /usr/bin cd done
+		then ${HOME} export cd done
+		grep export cd 2>/dev/null readonly grep readonly --verbose 'quoted text'
+awk echo export "$@" echo
+${HOME} && printf x=1 export 2>/dev/null 'quoted text' ${HOME} awk export ${HOME}
+		sed awk then sed 2>/dev/null grep grep local /usr/bin
+test test /usr/bin test cd | local 'quoted text' printf
+2>/dev/null "$1" test cd test
+-eu sed -eu && && then && x=1 sed ${HOME} "$@" $(pwd) "$@" "$1" echo grep |
+		"$@" test ${HOME} awk cd readonly $(pwd) readonly x=1 cd $(pwd) printf
+		test printf 2>/dev/null "$1" 'quoted text' then echo grep grep readonly readonly
+'quoted text' 2>/dev/null ${HOME} local cd 'quoted text' "$1" x=1
+	sed awk done | "$1" | sed echo
+"$1" then 2>/dev/null echo "$1" 'quoted text' then
+"$@" cd 'quoted text' cd then x=1 sed -eu 2>/dev/null done sed && --verbose
+		&& done cd -eu test -eu | 2>/dev/null
+	'quoted text' 'quoted text' && sed awk sed grep 'quoted text' awk
+	cd export local | --verbose local | awk 2>/dev/null
+	cd 2>/dev/null $(pwd) then "$1" --verbose test grep $(pwd) printf then "$@"
+		sed test printf echo cd 'quoted text' "$@" echo
+	grep "$@" "$1" cd test "$1" ${HOME} sed export
+		'quoted text' x=1 "$@" local awk readonly
+sed done 2>/dev/null 2>/dev/null
+"$1" test --verbose readonly cd && 2>/dev/null awk cd 2>/dev/null
+then printf then test
+test echo -eu /usr/bin export
+$(pwd) 'quoted text' | --verbose sed
+		"$@" then -eu -eu export cd -eu export && done
+echo --verbose "$1" -eu 2>/dev/null && printf /usr/bin test awk local local local
+${HOME} grep 2>/dev/null -eu "$@" readonly -eu then awk /usr/bin sed
+		local | x=1 "$1" echo && -eu x=1 test test && local readonly "$1" awk grep
+${HOME} && "$@" 2>/dev/null 'quoted text' done sed 'quoted text' printf
+	readonly "$1" x=1 export "$1" /usr/bin cd
+		'quoted text' readonly
+	grep grep awk -eu | printf
+	2>/dev/null sed grep --verbose && 'quoted text' done x=1 echo local "$1"
+cd then x=1 printf -eu test -eu ${HOME} && export
+sed awk 'quoted text' local ${HOME} grep "$1"
+	local 2>/dev/null sed then 'quoted text' export readonly grep ${HOME}
+export /usr/bin cd then then $(pwd) then | ${HOME} x=1 readonly awk grep 2>/dev/null
+	"$@" ${HOME} --verbose export ${HOME} --verbose ${HOME}
+sed readonly $(pwd) -eu | done
+		"$@" -eu readonly cd $(pwd) 2>/dev/null
+	/usr/bin --verbose readonly && done echo local -eu export 'quoted text'
+	-eu && /usr/bin /usr/bin ${HOME} | "$@"
+		printf && then awk then echo --verbose
+	2>/dev/null grep | x=1 "$@"
+		echo ${HOME} x=1 -eu printf grep awk
+		test readonly x=1 | export
+		--verbose x=1 awk awk "$1" "$1" $(pwd) sed /usr/bin
+2>/dev/null grep && sed done && printf "$1" --verbose
+-eu ${HOME} cd awk --verbose awk awk readonly
+		printf && sed local ${HOME} && local awk x=1 "$@" "$@"
+	'quoted text' then awk
+		| -eu export -eu "$@" sed sed then done x=1 | awk cd awk
+		awk "$1" $(pwd) export --verbose then echo sed x=1 "$@" 2>/dev/null readonly local
+local 'quoted text' local $(pwd) /usr/bin grep awk x=1 awk |
+	"$1" local then && /usr/bin export test /usr/bin /usr/bin awk
+		awk local 2>/dev/null && awk 2>/dev/null sed
+	test 'quoted text' echo readonly
+		awk 'quoted text' export 'quoted text' |
+	2>/dev/null local --verbose echo sed | test 'quoted text' | export
+		awk ${HOME} echo x=1 grep
+sed && printf grep 2>/dev/null --verbose -eu "$1"
+		readonly grep --verbose | done
+cd "$1" echo && 2>/dev/null cd test export | then x=1 'quoted text' -eu
+echo echo cd --verbose test ${HOME} x=1 sed && 2>/dev/null
+	$(pwd) then test sed cd
+	-eu echo x=1 local $(pwd) echo test
+		local done awk printf readonly echo ${HOME} awk done ${HOME}
+		-eu echo test echo "$@" cd readonly
+		-eu /usr/bin echo printf test x=1 cd --verbose ${HOME} | ${HOME} export awk
+		then --verbose x=1 x=1 awk | x=1 /usr/bin && awk readonly x=1 $(pwd)
+2>/dev/null grep --verbose
+"$@" 2>/dev/null test "$@" readonly export done export
+	${HOME} "$@" ${HOME} grep printf -eu test readonly cd $(pwd) --verbose sed sed &&
+		then awk | then --verbose awk ${HOME} grep done /usr/bin | grep then
+		2>/dev/null 2>/dev/null && done test $(pwd) test export cd export
+		printf ${HOME} && grep printf && "$1" test --verbose -eu echo then
+	awk && x=1 "$@" printf readonly /usr/bin readonly grep
+	| echo cd && test | | -eu /usr/bin x=1 done 'quoted text'
+	grep $(pwd) | printf
+2>/dev/null cd ${HOME} ${HOME} done ${HOME}
+'quoted text' "$@" --verbose
+/usr/bin grep x=1 export && | 2>/dev/null 2>/dev/null | echo local cd |
+	| "$1" 2>/dev/null then then x=1 sed printf x=1 -eu cd sed then grep /usr/bin
+${HOME} | /usr/bin -eu test printf $(pwd) 2>/dev/null
+	echo "$@" readonly && readonly "$1"
+	-eu local export && ${HOME} --verbose $(pwd)
+--verbose -eu 2>/dev/null then readonly ${HOME} ${HOME} grep test cd
+		local export /usr/bin grep readonly -eu grep
+		done printf grep x=1 test
+/usr/bin then "$@" printf cd export ${HOME} "$@" local local done
+	cd "$@" "$@" done x=1 then then sed export local
+		then awk 'quoted text' 2>/dev/null
+		&& local | /usr/bin cd printf
+export x=1 grep export ${HOME} export $(pwd) awk | 'quoted text' "$@" /usr/bin
+	cd cd readonly 2>/dev/null cd awk test then sed
+	2>/dev/null /usr/bin -eu -eu printf grep -eu test local export done "$1"
+readonly | 2>/dev/null local /usr/bin "$1" && &&
+${HOME} $(pwd) printf sed "$@"
+	export 'quoted text' -eu "$1" /usr/bin "$1"
+		$(pwd) -eu grep $(pwd) printf "$1"
+	echo readonly awk readonly done then | done -eu local $(pwd) cd readonly readonly
+	sed "$@" echo /usr/bin local | echo x=1 then export x=1 "$1" grep then ${HOME}
+	$(pwd) ${HOME} && export $(pwd) 2>/dev/null grep test cd grep x=1 x=1 then
+local export | printf readonly $(pwd) cd done --verbose
+	-eu printf readonly grep --verbose test $(pwd) x=1 "$@" then "$@" then awk then
+		2>/dev/null grep echo
+		readonly 2>/dev/null -eu | -eu sed "$1" ${HOME} echo 2>/dev/null x=1 x=1
+'quoted text' export test sed then echo test echo grep cd 'quoted text'
+	${HOME} export cd -eu sed printf /usr/bin sed
+		done "$1" x=1 --verbose awk
+	"$@" ${HOME} local printf readonly --verbose
+		$(pwd) grep -eu awk echo
+done --verbose "$@" then "$@" "$@" x=1 grep $(pwd) echo cd --verbose
+	--verbose "$1" export --verbose 2>/dev/null sed grep ${HOME}
+test printf done $(pwd) | echo test $(pwd) sed && | echo && then &&
+		grep 2>/dev/null && -eu
+		printf x=1 echo awk test readonly done -eu 'quoted text'
+x=1 "$1" ${HOME} local echo "$1" cd grep printf ${HOME}
+"$@" sed cd readonly 'quoted text' "$1" local
+	test $(pwd) test printf "$@" 'quoted text' "$1" local test ${HOME} then readonly
+		${HOME} local printf readonly then printf 'quoted text' cd echo then "$@" &&
+grep && printf 2>/dev/null export
+		done ${HOME} && export done ${HOME}
+cd export "$1" sed 2>/dev/null x=1 export cd 2>/dev/null 'quoted text'
+		printf ${HOME} ${HOME} 2>/dev/null
+	then -eu test --verbose $(pwd) awk -eu
+		"$1" "$1" echo --verbose 'quoted text' &&
+		-eu --verbose --verbose sed 2>/dev/null
+	2>/dev/null printf readonly
+		x=1 | export x=1 $(pwd) sed echo "$1" echo export --verbose readonly -eu
+&& printf $(pwd) | | x=1
+		then echo "$@" $(pwd) echo ${HOME} "$1" cd "$1" 'quoted text'
+	local --verbose grep then export $(pwd) echo done readonly done echo x=1
+	echo local $(pwd) /usr/bin test 'quoted text' "$1" "$@" done ${HOME}
+'quoted text' printf sed ${HOME} "$@" done export "$1" | "$@"
+	then "$1" cd 'quoted text' "$1" |
+awk awk ${HOME} 'quoted text'
+		"$1" x=1 printf ${HOME} local test export "$1" sed "$1" then
+		awk x=1 done 2>/dev/null grep sed "$1" printf
+		sed -eu echo ${HOME} "$1" printf
+done printf && --verbose sed awk 'quoted text' "$1" 2>/dev/null
+	| test echo --verbose grep printf done sed test
+	grep ${HOME} test | -eu then done -eu --verbose $(pwd) ${HOME} local
+	sed done awk x=1 'quoted text' --verbose
+		echo done 2>/dev/null --verbose then sed $(pwd)
+		$(pwd) sed then grep done printf x=1 2>/dev/null
+&& /usr/bin "$@" $(pwd) ${HOME} printf
+	"$1" test done cd printf | sed 'quoted text'
+&& done 'quoted text' then && 2>/dev/null cd "$1" grep "$1"
+#include c75.sh
+	echo /usr/bin printf 'quoted text' x=1 ${HOME} -eu 2>/dev/null echo grep
+		sed grep printf --verbose test
+cd done 2>/dev/null $(pwd) /usr/bin readonly
+then && readonly | "$@" x=1 cd
+export "$@" then then grep ${HOME} --verbose x=1 grep export export 2>/dev/null
+| && -eu awk --verbose $(pwd) done x=1 done 'quoted text' local
+	| export -eu "$@" && printf echo export -eu echo /usr/bin
+		test done local local ${HOME} $(pwd) /usr/bin done
+	$(pwd) --verbose "$@" awk grep printf -eu cd "$@" local "$1" printf x=1
+		readonly sed export && done awk /usr/bin sed | 'quoted text' then && /usr/bin
+	"$1" export test "$1" done $(pwd) local ${HOME} /usr/bin
+	2>/dev/null done x=1 done awk /usr/bin "$@"
+	readonly "$@" local readonly
+		$(pwd) readonly done /usr/bin $(pwd) local 'quoted text' && | -eu echo
+		echo done 2>/dev/null done printf -eu "$@" sed printf /usr/bin export | --verbose
+		&& "$@" && done | done sed ${HOME} ${HOME} "$@" sed echo
+${HOME} local "$1" $(pwd) "$1" cd "$@" printf export 2>/dev/null
+		test sed echo local | then printf ${HOME} readonly x=1 then --verbose
+readonly sed x=1 -eu sed echo x=1 readonly local printf
+	&& local "$@" grep awk
+		'quoted text' sed local | readonly 2>/dev/null ${HOME} /usr/bin
+sed "$@" export /usr/bin printf printf | -eu grep done printf 'quoted text'
+	x=1 "$@" printf ${HOME}
+		done readonly 'quoted text' 2>/dev/null
+	test done x=1 then 2>/dev/null test 'quoted text' "$@" local grep
+printf ${HOME} "$@" 2>/dev/null | local 2>/dev/null
+| grep test echo local test readonly
+		readonly x=1 awk readonly
+done test echo $(pwd) && -eu $(pwd) --verbose
+2>/dev/null test grep --verbose 2>/dev/null
+		grep cd awk 2>/dev/null test readonly &&
+&& sed test $(pwd) | /usr/bin printf export 'quoted text' readonly 'quoted text'
+		then printf readonly "$@" ${HOME} ${HOME} export
+		2>/dev/null "$1" done awk ${HOME} $(pwd) local /usr/bin local
+&& local sed then export export then grep && "$1"
+	grep | "$1" grep --verbose "$1" then cd test sed ${HOME} readonly
+sed "$@" test printf -eu local $(pwd) | sed grep sed -eu && && test && ${HOME}
+		done --verbose cd readonly $(pwd) awk done
+	test sed printf local | | test x=1 local "$@"
+awk "$@" readonly --verbose
+"$@" sed 'quoted text' -eu $(pwd) test cd $(pwd) -eu sed readonly --verbose
+		test $(pwd) -eu 2>/dev/null /usr/bin x=1 test then test printf test --verbose
+		local test awk 2>/dev/null readonly grep
+"$1" grep --verbose grep then 'quoted text'
+	local readonly echo "$1" --verbose grep sed grep
+		x=1 done test && 2>/dev/null readonly "$@" sed -eu
+awk local printf grep x=1 readonly && readonly
+	2>/dev/null "$1" $(pwd) echo
+		printf | cd $(pwd) && done && local /usr/bin cd 'quoted text'
+		/usr/bin readonly sed cd 2>/dev/null cd awk --verbose
+"$1" export readonly && readonly awk done cd test export export awk /usr/bin sed
+		"$@" cd | sed printf x=1 x=1 readonly
+		$(pwd) | readonly printf export test $(pwd) --verbose awk && $(pwd) done | $(pwd)
+		${HOME} echo then then
+		awk awk --verbose 'quoted text' "$1"
+	test grep "$1" $(pwd) printf echo "$@" /usr/bin --verbose 'quoted text'
+	then ${HOME} && ${HOME}
+	local then | readonly 2>/dev/null test then test
+		cd sed -eu then cd printf 'quoted text' awk "$@" echo done awk done grep printf
+"$1" 2>/dev/null then "$1" && $(pwd) && ${HOME} -eu cd /usr/bin
+-eu echo readonly echo && cd readonly
+&& local 'quoted text' | sed done echo sed local --verbose done "$@" grep
+readonly 'quoted text' grep 'quoted text' awk
+sed local test && echo 2>/dev/null sed && local x=1 readonly
+	local "$1" export "$1" "$@" done --verbose
+	echo sed then -eu then 2>/dev/null 'quoted text' awk /usr/bin sed --verbose $(pwd)
+		"$@" then $(pwd) cd 2>/dev/null "$@" printf
+		done test | readonly 'quoted text'
+	"$1" awk then "$@" $(pwd) ${HOME} "$@" 'quoted text' 'quoted text'
+"$1" done -eu 2>/dev/null x=1 cd -eu $(pwd) 2>/dev/null
+${HOME} then export $(pwd) && grep 2>/dev/null $(pwd) 'quoted text' grep awk
+		echo grep readonly --verbose grep readonly "$@" done grep ${HOME} then cd -eu
+		local x=1 export readonly local
+local | "$@" awk --verbose export sed then --verbose
+		-eu 2>/dev/null awk && && cd cd sed awk then
+		--verbose /usr/bin "$1"
+		then ${HOME} done test 'quoted text'
+	&& awk cd done && x=1 local test printf
+		printf --verbose printf then grep ${HOME} /usr/bin
+		done test local x=1 export ${HOME} awk grep | grep "$1" done
+	printf printf grep /usr/bin grep && local cd test sed
+	${HOME} "$1" x=1 'quoted text' 'quoted text' ${HOME} local
+&& | | $(pwd) && && | && grep /usr/bin 'quoted text' cd $(pwd) ${HOME} | /usr/bin
+	awk then && "$@" 'quoted text' printf
+		readonly sed printf $(pwd) then |
+	echo sed printf done --verbose "$1" -eu printf x=1 done 'quoted text'
+		awk export awk | cd 'quoted text' x=1 'quoted text' export export
+	"$@" done $(pwd) /usr/bin 2>/dev/null "$1" local test readonly
+grep --verbose awk 'quoted text' 2>/dev/null export then
+cd printf grep "$@" --verbose ${HOME} 2>/dev/null test
+		&& echo "$1" done | --verbose then readonly export "$@"
+'quoted text' && && done x=1 readonly "$1" sed
+		"$@" -eu 2>/dev/null x=1 grep done 'quoted text' ${HOME} test 'quoted text'
+		test echo export "$1" "$1" "$1" cd test local "$1" awk && -eu
+	done cd --verbose 'quoted text' printf then "$@" "$@" cd &&
+sed export local x=1 x=1 'quoted text' ${HOME} done sed cd export awk
+	test awk -eu "$1" x=1 then then local --verbose readonly &&
+awk printf local printf "$@" readonly grep awk done &&
+	2>/dev/null -eu 2>/dev/null test done local test -eu done awk
+	then then | export awk $(pwd) x=1 grep test x=1 export cd then echo --verbose
+		/usr/bin awk sed 'quoted text' "$@"
+		'quoted text' done echo local 'quoted text' awk
+awk | sed awk $(pwd) printf "$@" /usr/bin
+		readonly 2>/dev/null 2>/dev/null cd printf
+'quoted text' --verbose readonly then 'quoted text' && 'quoted text'
+		--verbose -eu -eu awk cd "$1" -eu local x=1
+"$1" test echo ${HOME} &&
+	grep && --verbose printf
+	export test && export /usr/bin
+export | 'quoted text' 'quoted text' readonly
+	done x=1 x=1 ${HOME} sed
+"$1" $(pwd) "$1" ${HOME} $(pwd) 'quoted text' $(pwd) grep cd printf "$@" awk then
+| readonly "$1" "$@" $(pwd) done test "$@" export readonly
+		export local | cd awk x=1 -eu $(pwd) "$1"
+		x=1 grep $(pwd) && printf
+"$1" local export cd && test then test -eu sed x=1 done cd sed
+		printf local $(pwd) --verbose 'quoted text' --verbose awk x=1 $(pwd)
+		grep test -eu then --verbose ${HOME} 2>/dev/null "$@"
+	echo "$1" export awk ${HOME} $(pwd) 2>/dev/null
+		-eu -eu grep "$1" test grep -eu done "$1"
+	sed -eu | test done $(pwd) local cd 2>/dev/null local echo
+| done grep awk grep done readonly ${HOME} && "$@" /usr/bin grep "$1"
+		-eu | 'quoted text' 2>/dev/null -eu printf printf test /usr/bin
+	'quoted text' ${HOME} x=1 "$1" done done ${HOME} 'quoted text'
+cd local "$@" $(pwd) $(pwd) awk
+| awk readonly export /usr/bin 2>/dev/null export echo | test "$@"
+-eu readonly local -eu -eu &&
+cd readonly cd x=1 2>/dev/null grep && sed awk 'quoted text' "$@" export done
+test sed ${HOME} | grep -eu /usr/bin /usr/bin $(pwd) then
+--verbose done -eu cd -eu /usr/bin cd && local echo
+	${HOME} test printf test printf ${HOME} x=1 sed echo && 2>/dev/null
+		then 2>/dev/null grep printf "$1" "$1" 2>/dev/null
+		$(pwd) local export "$1" --verbose then && $(pwd)
+		"$1" done x=1 grep "$@" export /usr/bin 2>/dev/null cd | 'quoted text'
+--verbose --verbose awk --verbose
+		| printf --verbose readonly
+	local cd test -eu then test --verbose grep -eu x=1 | echo test -eu
+	"$1" /usr/bin | readonly /usr/bin $(pwd) 'quoted text'
+	"$1" grep "$@" test echo readonly /usr/bin $(pwd)
+| --verbose awk printf
+export && | 'quoted text' printf local
+cd -eu ${HOME} 2>/dev/null && ${HOME} &&
+-eu cd && grep then | && "$@" && --verbose done done test awk awk "$@" then readonly
+	/usr/bin x=1 x=1 "$1" "$@" | sed done local | -eu awk x=1 cd
+		--verbose -eu local 2>/dev/null | "$1" --verbose sed $(pwd) cd printf
+--verbose "$1" grep && then "$1" 'quoted text' && cd echo
+	&& local local x=1 grep
+grep 2>/dev/null echo 'quoted text'
+local local "$1" local
+grep && --verbose 2>/dev/null echo
+		'quoted text' local export printf printf
+"$@" echo | 'quoted text' | 'quoted text' "$1" cd readonly 'quoted text' "$1"
+		'quoted text' export test --verbose
+	/usr/bin echo -eu local 2>/dev/null readonly 'quoted text' ${HOME}
+		printf awk --verbose cd 2>/dev/null "$1" awk -eu
+		/usr/bin ${HOME} "$1" grep /usr/bin
+	sed /usr/bin awk $(pwd) export /usr/bin
+	cd export echo "$1" ${HOME} grep | -eu local grep /usr/bin awk export
+	export done ${HOME} readonly --verbose
+	awk printf 'quoted text' /usr/bin 'quoted text'
+	${HOME} /usr/bin cd "$1" local
+	"$@" cd && printf test echo -eu -eu cd x=1 "$1" sed "$@" -eu
+		cd 'quoted text' x=1 "$@" $(pwd) | sed 2>/dev/null test local cd grep 'quoted text'
+x=1 then done printf export cd $(pwd) cd test "$@" 'quoted text' printf done
+		printf | /usr/bin "$1" done /usr/bin -eu test $(pwd) grep && local
+printf -eu x=1 done "$@" /usr/bin
+		printf && | -eu awk $(pwd) echo
+&& export && --verbose readonly test --verbose export 'quoted text' test /usr/bin
+		grep echo sed --verbose | 'quoted text' sed
+| "$@" 'quoted text' /usr/bin
+| -eu printf sed then --verbose
+		then "$1" export "$1" && local
+		${HOME} 'quoted text' /usr/bin sed $(pwd)
+		-eu 2>/dev/null grep sed local awk cd |
+		${HOME} && echo -eu awk x=1 'quoted text' /usr/bin
+		grep echo | awk && local | ${HOME} printf "$1" printf "$@" grep local | awk
+	2>/dev/null $(pwd) local cd then ${HOME} sed "$1" "$@" then sed -eu echo
+		2>/dev/null 2>/dev/null -eu
+		--verbose echo local $(pwd) 'quoted text' "$@" |
+$(pwd) sed | x=1 -eu echo printf "$1"
+		| x=1 && export -eu export test && awk
+		done && sed -eu cd printf printf awk cd grep
+cd "$@" test -eu | grep readonly 'quoted text'
+		| /usr/bin cd && 2>/dev/null awk "$@" && done 'quoted text' export
+| echo ${HOME} /usr/bin grep cd sed done 'quoted text'
+&& test 2>/dev/null 2>/dev/null 'quoted text' "$1" ${HOME} done | grep export
+		${HOME} "$1" echo "$1" grep then printf local -eu grep
+| /usr/bin then x=1 then && printf 'quoted text'
+| --verbose ${HOME} sed "$@" $(pwd) test -eu readonly
+local "$1" 2>/dev/null export
+		then then && sed then --verbose
+		| sed | readonly x=1 "$@" export "$@" x=1
+		--verbose --verbose 2>/dev/null awk $(pwd)
+		'quoted text' cd "$1" readonly $(pwd) $(pwd)
+		awk | then export /usr/bin "$@" cd "$1" cd
+	printf -eu test --verbose -eu grep x=1 2>/dev/null
+		/usr/bin && 'quoted text' ${HOME} 'quoted text'
+		x=1 x=1 then "$1" --verbose printf $(pwd)
+	-eu 2>/dev/null grep "$1" readonly
+	printf /usr/bin x=1 awk local "$@" then export
+		--verbose 'quoted text' sed /usr/bin $(pwd) echo awk --verbose
+2>/dev/null 'quoted text' "$1" readonly cd test
+	&& export --verbose --verbose local /usr/bin && && printf readonly -eu echo grep
+	"$@" awk printf done ${HOME} grep awk | grep && --verbose "$@" cd -eu test awk
+'quoted text' sed -eu --verbose test
+	$(pwd) x=1 echo grep grep
+	/usr/bin 2>/dev/null readonly cd /usr/bin local 'quoted text'
+| cd grep export export
+	--verbose printf awk awk sed printf
+--verbose then x=1 done echo 'quoted text' then awk local cd echo done sed "$1"
+$(pwd) local local echo $(pwd) && cd "$@" $(pwd) $(pwd) /usr/bin && echo ${HOME}
+		readonly local /usr/bin 'quoted text'
+	readonly ${HOME} "$1" $(pwd) x=1 done ${HOME} export printf && "$@"
+/usr/bin "$@" x=1 export test done printf /usr/bin printf test test
+	/usr/bin done -eu echo awk grep
+${HOME} cd ${HOME} | x=1 2>/dev/null --verbose then
+		-eu readonly | grep sed x=1 sed 'quoted text' printf "$1"
+	done echo /usr/bin $(pwd) /usr/bin echo done readonly printf 2>/dev/null
+-eu awk grep sed $(pwd) test printf | local then echo printf
+awk | printf printf printf cd local $(pwd) "$1" --verbose done test
+	awk -eu awk then grep export then x=1 done "$1" "$1" $(pwd) grep
+x=1 "$@" export 'quoted text' x=1 then
+		echo test cd "$@" 2>/dev/null echo 'quoted text'
+	${HOME} then printf 2>/dev/null
+	grep local echo grep echo sed "$@" done
+	readonly sed done export
+	"$@" 'quoted text' /usr/bin export $(pwd) "$@" "$@" cd cd
+	test 'quoted text' 'quoted text' then printf awk echo --verbose readonly
+		&& test printf /usr/bin /usr/bin printf /usr/bin echo "$@" 'quoted text'
+		&& ${HOME} /usr/bin local 'quoted text' "$1" -eu "$1" 'quoted text'
+	'quoted text' "$1" $(pwd) cd && "$@"
+	test cd | ${HOME} ${HOME} cd test grep export 2>/dev/null cd | /usr/bin
+'quoted text' sed readonly readonly --verbose grep readonly
+		echo local test x=1 "$1" printf
+		export 2>/dev/null $(pwd) "$@" /usr/bin 2>/dev/null ${HOME} printf $(pwd) export
+	-eu | /usr/bin then sed | then echo --verbose && /usr/bin
+	done --verbose "$1" local test
+	cd printf test $(pwd) done "$1" sed
+		printf -eu && | local --verbose done test local 'quoted text'
+2>/dev/null "$@" && test
+		/usr/bin cd readonly | $(pwd)
+	export "$1" local "$1" local x=1 && echo --verbose done /usr/bin echo export
+		--verbose "$1" && "$@" cd grep echo echo sed grep /usr/bin cd
+then | echo local 'quoted text'
+		x=1 -eu ${HOME} && ${HOME} -eu "$@" readonly then --verbose
+	done printf /usr/bin
+	local /usr/bin echo 'quoted text' -eu -eu 2>/dev/null "$@" readonly
+	"$1" 'quoted text' 'quoted text' $(pwd) local /usr/bin 'quoted text' ${HOME}
+		readonly && ${HOME} "$1" x=1 grep local test readonly
+		local echo && x=1 awk 2>/dev/null grep "$1" "$@" local export
+/usr/bin $(pwd) /usr/bin echo | x=1
+		&& then 2>/dev/null then --verbose /usr/bin
+	/usr/bin --verbose done | local $(pwd) ${HOME} export sed --verbose
+		export test echo "$1" /usr/bin 'quoted text' 'quoted text' ${HOME} then sed
+&& 2>/dev/null x=1 'quoted text' awk printf echo | printf /usr/bin
+		${HOME} "$1" export export done
+		done -eu local $(pwd) | 2>/dev/null --verbose 2>/dev/null grep "$1" echo done
+x=1 --verbose ${HOME}
+	echo done "$1" awk grep 2>/dev/null readonly echo local awk local printf
+--verbose 2>/dev/null test echo 2>/dev/null done cd sed
+--verbose test printf sed done awk
+'quoted text' readonly ${HOME} grep sed local "$1" x=1 2>/dev/null
+x=1 echo test 'quoted text'
+	-eu | 2>/dev/null printf sed | /usr/bin -eu 2>/dev/null x=1 then && && readonly
+		x=1 readonly $(pwd) && local grep $(pwd)
+		local printf sed printf "$1" x=1 then then
+		${HOME} && | export echo /usr/bin export test
+2>/dev/null /usr/bin printf
+	sed cd test awk awk $(pwd) test x=1 echo x=1
+	"$1" --verbose echo && && 'quoted text' grep ${HOME} readonly | export cd done
+		export $(pwd) -eu | sed then cd test "$1" x=1 printf
+	grep && ${HOME} && done test ${HOME} /usr/bin local
+| cd awk grep export 'quoted text' test sed "$@" 'quoted text' done sed readonly
+		/usr/bin local cd cd export echo x=1 --verbose local echo -eu /usr/bin
+	export 2>/dev/null echo x=1
+"$1" grep x=1 --verbose done "$1" | test awk sed && -eu
+	cd 'quoted text' -eu printf
+		--verbose awk grep $(pwd) && "$1" sed x=1 -eu printf
+echo awk 'quoted text' cd /usr/bin /usr/bin cd then x=1 $(pwd) x=1 printf local
+		--verbose done && awk done local awk echo "$@" -eu sed readonly "$1"
+"$@" done readonly readonly $(pwd) echo sed test 2>/dev/null
+		echo then test local cd awk "$@" done
+		export x=1 then then x=1 | && 2>/dev/null "$1"
+	then printf export cd done local cd test local
+	echo grep /usr/bin cd echo && echo ${HOME} test then then x=1 printf test
+	| cd test done awk test readonly
+		awk --verbose /usr/bin ${HOME} ${HOME}
+		awk | $(pwd) sed readonly done done x=1
+done done 'quoted text' local 2>/dev/null
+		awk cd awk readonly --verbose local export grep echo then "$@" grep local "$@"
+		done grep export export echo ${HOME} 2>/dev/null
+	&& grep readonly done printf local grep local && "$1" local
+		-eu done export awk | "$1" x=1 'quoted text'
+$(pwd) local printf printf "$@" ${HOME} && local test
+	x=1 "$@" ${HOME} done "$1" export grep test /usr/bin 'quoted text'
+	grep "$1" sed echo | printf export test
+	--verbose awk 'quoted text'
+/usr/bin | local "$@" test awk awk then "$1" 2>/dev/null ${HOME} "$@"
+		readonly local grep done then test x=1 local -eu --verbose awk "$@" ${HOME} awk
+		local test printf x=1 && awk readonly
+	-eu cd cd --verbose -eu cd "$1" local
+-eu cd 'quoted text' done $(pwd) readonly
+	done export "$@" /usr/bin readonly x=1 2>/dev/null
+		| local "$@" local /usr/bin awk then "$1" $(pwd) "$@" 2>/dev/null $(pwd) printf
+/usr/bin done done ${HOME} ${HOME} x=1 -eu && export /usr/bin cd
+	"$1" readonly cd export -eu "$1"
+		$(pwd) 'quoted text' ${HOME} awk local "$1" "$1" "$@" $(pwd) sed readonly echo
+		test && 2>/dev/null export awk -eu grep 2>/dev/null $(pwd) && x=1
+		echo grep 2>/dev/null 2>/dev/null cd echo && x=1 printf /usr/bin
+	done "$@" test cd sed "$1" awk $(pwd)
+echo cd grep cd && done 'quoted text' "$1" then export awk x=1
+x=1 -eu /usr/bin | /usr/bin local 'quoted text' echo sed test --verbose then
+	${HOME} echo /usr/bin sed done grep grep "$1" &&
+		readonly then echo "$@" then export 2>/dev/null printf "$1" 'quoted text'
+--verbose "$@" readonly 'quoted text'
+		cd --verbose "$@" awk /usr/bin
+		grep /usr/bin "$@" "$1" grep sed 'quoted text'
+	export local readonly printf printf cd done $(pwd) -eu done 2>/dev/null
+		${HOME} echo && && 'quoted text'
+sed | "$@" "$@" $(pwd) --verbose 2>/dev/null
+x=1 'quoted text' x=1 cd /usr/bin export grep -eu cd cd -eu cd readonly 2>/dev/null
+${HOME} x=1 awk --verbose export 2>/dev/null readonly 'quoted text'
+		--verbose export awk export readonly test test
+${HOME} ${HOME} local && readonly "$@" done awk 'quoted text'
+	"$1" readonly "$1" awk sed --verbose readonly
+	x=1 sed grep grep 2>/dev/null cd x=1 -eu "$@" readonly
+		readonly /usr/bin local echo then "$1" 'quoted text' 2>/dev/null
+/usr/bin 2>/dev/null echo local sed "$@" | 'quoted text'
+	echo local printf $(pwd) then sed /usr/bin sed $(pwd)
+		x=1 then local 'quoted text' x=1 | 'quoted text' grep "$1" &&
+'quoted text' cd echo ${HOME} test --verbose readonly grep sed "$1" "$1" "$@" local
+	done ${HOME} | "$1" awk grep 2>/dev/null x=1 done done
+	cd done $(pwd) export printf local local | -eu test
+	-eu echo local --verbose --verbose local
+local "$1" printf $(pwd)
+'quoted text' grep 2>/dev/null && test done printf --verbose test then "$@" -eu
+-eu export -eu readonly /usr/bin done readonly export test echo
+		-eu /usr/bin "$@" then && /usr/bin x=1 done awk x=1 &&
+		export test 'quoted text' 2>/dev/null "$1"
+x=1 x=1 echo --verbose ${HOME} printf then sed readonly "$@" --verbose
+test x=1 --verbose "$@" test awk awk test test sed
+		then grep ${HOME} printf --verbose && export $(pwd) 2>/dev/null
+export 'quoted text' | export then awk -eu local /usr/bin export /usr/bin
+cd && x=1 && ${HOME} "$1" /usr/bin printf $(pwd)
+		${HOME} sed | then local echo "$1" then then readonly local readonly done /usr/bin
+		readonly x=1 2>/dev/null done /usr/bin ${HOME} 2>/dev/null export $(pwd)
+${HOME} -eu echo /usr/bin sed --verbose 'quoted text' ${HOME} 'quoted text'
+		"$1" local test -eu readonly 2>/dev/null
+	$(pwd) "$@" $(pwd) done awk $(pwd) echo --verbose | test && && $(pwd)
+		then test ${HOME} then "$@" grep ${HOME} awk "$1" "$1" sed
+		&& then awk "$1" x=1 awk awk export && /usr/bin local
+	'quoted text' --verbose -eu /usr/bin done export
+| $(pwd) -eu local "$1" echo export x=1 printf --verbose
+${HOME} readonly cd $(pwd) export echo readonly local x=1 $(pwd) | local
+readonly --verbose cd readonly done ${HOME} && "$@" -eu $(pwd) "$1" done 'quoted text'
+		echo -eu export export -eu local ${HOME} printf
+--verbose printf printf 'quoted text' done
+test && --verbose ${HOME} export done awk ${HOME} "$@" grep
+		| ${HOME} local "$@" | ${HOME}
+	sed local -eu | --verbose | 'quoted text'
+		sed $(pwd) --verbose test then local done $(pwd) ${HOME}
+		'quoted text' done cd sed "$@" "$@" ${HOME} done x=1 -eu
+		grep readonly then "$@" /usr/bin 'quoted text'
+	grep test test sed export x=1 echo readonly x=1 | export | && $(pwd) test 2>/dev/null
+	local sed x=1 $(pwd) $(pwd) ${HOME} -eu test then -eu then sed
+	-eu test echo cd "$1" -eu ${HOME} grep done awk then 2>/dev/null
+awk x=1 && printf grep then && -eu "$@"
+		echo then "$@" awk cd export "$@" printf -eu awk --verbose
+		--verbose cd test ${HOME} --verbose printf $(pwd)
+awk grep awk echo x=1 ${HOME} printf cd then x=1 test
+	cd local printf x=1 2>/dev/null x=1 &&
+"$@" -eu sed awk && awk echo then echo "$1" awk ${HOME} | printf
+	| readonly --verbose x=1 awk echo readonly sed then x=1 cd | printf sed
+done $(pwd) | -eu x=1 then
+	| then printf done local
+	"$1" 2>/dev/null echo && ${HOME} $(pwd) x=1 'quoted text' |
+	/usr/bin export x=1 cd "$1" sed && readonly awk "$1" |
+		cd /usr/bin && done grep then sed printf then 2>/dev/null "$1"
+		then -eu x=1 export printf "$@" awk export 'quoted text' printf
+		| "$@" awk $(pwd) -eu done printf
+	"$@" ${HOME} test 'quoted text'
+	--verbose ${HOME} x=1 readonly test ${HOME} export
+cd then cd $(pwd) grep 2>/dev/null sed
+cd export grep x=1 grep test awk cd && | $(pwd) then readonly
+	printf /usr/bin local --verbose "$1" test cd | --verbose
+awk ${HOME} -eu readonly x=1 awk done printf cd done "$@" $(pwd) && test sed
+		-eu | ${HOME} -eu "$@" /usr/bin $(pwd)
+	echo ${HOME} 2>/dev/null test
+		/usr/bin $(pwd) readonly done /usr/bin
+		${HOME} 2>/dev/null 'quoted text' -eu test then $(pwd) cd | readonly
+&& $(pwd) echo --verbose
+&& export 'quoted text' x=1 export test local ${HOME}
+	--verbose grep -eu 'quoted text' 'quoted text' 'quoted text'
+| 2>/dev/null "$@" printf test $(pwd)
+	sed $(pwd) local readonly awk sed 'quoted text' 2>/dev/null
+		cd -eu awk printf awk grep
+	done export printf ${HOME} readonly awk && done -eu readonly done readonly -eu
+	readonly | /usr/bin && test $(pwd) readonly $(pwd) cd "$1"
+	then | "$@" printf && readonly awk cd && awk local awk | --verbose && "$1"
+	printf ${HOME} echo printf readonly local -eu x=1 --verbose $(pwd) 2>/dev/null
+		/usr/bin -eu && grep "$@" && then 2>/dev/null && printf local -eu $(pwd) 2>/dev/null
+	&& sed x=1 awk -eu done test 2>/dev/null test
+		cd "$1" awk cd done | -eu then sed 2>/dev/null echo
+		"$@" /usr/bin printf --verbose then ${HOME}
+readonly then 2>/dev/null x=1 printf "$1"
+	"$@" readonly echo 2>/dev/null "$1" -eu $(pwd) export local
+		then -eu grep grep ${HOME} "$1" $(pwd) --verbose /usr/bin 'quoted text' -eu
+	"$@" cd "$1" /usr/bin | 'quoted text'
+		sed | then 'quoted text' cd cd "$1" "$@" cd test && export
+sed local "$@" && done readonly grep
+	done grep | x=1 local done awk "$@" printf
+	$(pwd) readonly sed done cd sed "$1"
+		echo export "$@" test 'quoted text' x=1 'quoted text' $(pwd)
+	"$@" 2>/dev/null cd && sed "$1" "$@" | export --verbose /usr/bin "$1" ${HOME}
+		2>/dev/null local 2>/dev/null /usr/bin test "$1" then $(pwd) "$@" /usr/bin |
+		2>/dev/null cd cd cd echo readonly
+		$(pwd) "$@" 2>/dev/null done
+		$(pwd) test --verbose ${HOME}
+	readonly readonly readonly
+	then sed printf /usr/bin --verbose ${HOME} test -eu && ${HOME} then 2>/dev/null
+		${HOME} | --verbose test echo x=1 sed "$1"
+${HOME} local echo local then done
+	| $(pwd) export && local
+&& 'quoted text' then export echo "$@" then
+	then readonly -eu test cd local --verbose local --verbose && && sed --verbose
+done readonly /usr/bin
+"$@" 2>/dev/null cd ${HOME} -eu then then readonly
+	$(pwd) /usr/bin printf "$1" grep x=1
+		"$1" grep x=1 x=1 then $(pwd) && && sed "$1" readonly 'quoted text'
+		&& readonly cd echo awk "$1" x=1 --verbose then printf "$1" | sed | x=1 local 'quoted text'
+	&& "$@" echo 2>/dev/null
+${HOME} then | ${HOME} done printf /usr/bin sed test cd readonly export then
+		"$1" ${HOME} | local "$@" cd test then /usr/bin --verbose && then $(pwd)
+		sed 'quoted text' | printf grep grep
+readonly /usr/bin awk awk export ${HOME} done
+	/usr/bin sed sed && test
+		export x=1 $(pwd) $(pwd) | -eu | ${HOME} awk && "$@" 2>/dev/null &&
+	/usr/bin printf sed x=1 done | local x=1 /usr/bin 2>/dev/null grep -eu
+	cd echo x=1 local echo cd test then then printf 2>/dev/null x=1 $(pwd)
+| test awk ${HOME} "$@" 2>/dev/null awk --verbose sed printf
+x=1 --verbose --verbose
+"$1" x=1 printf grep $(pwd) "$1" /usr/bin /usr/bin readonly
+		| $(pwd) test /usr/bin 2>/dev/null done then local x=1 sed echo local x=1 $(pwd)
+$(pwd) awk local printf
+	-eu 'quoted text' && --verbose done /usr/bin $(pwd) ${HOME} then cd
+/usr/bin 'quoted text' 'quoted text'
+	test readonly grep readonly $(pwd) readonly printf
+	${HOME} export | printf $(pwd) "$1" 'quoted text'
+		&& /usr/bin --verbose printf
+		$(pwd) cd "$1" ${HOME} printf echo export echo "$@" $(pwd)
+		2>/dev/null "$@" --verbose test "$1" "$@" $(pwd) "$1" then
+	x=1 local x=1 "$@" ${HOME} cd grep export "$@" ${HOME} awk x=1
+		"$1" local then 2>/dev/null
+	sed | $(pwd) -eu printf "$@" sed && x=1 grep echo | local /usr/bin
+	then test readonly | echo local then 2>/dev/null 'quoted text' $(pwd) grep -eu -eu
+	sed echo | sed $(pwd) /usr/bin
+printf echo $(pwd) /usr/bin ${HOME} /usr/bin echo local printf 2>/dev/null
+		export then cd done | sed done test /usr/bin local then then ${HOME} ${HOME}
+		2>/dev/null "$1" | done 'quoted text' "$@"
+		sed --verbose "$1" cd export --verbose cd ${HOME}
+	readonly "$@" /usr/bin grep printf $(pwd) 'quoted text'
+	&& x=1 export "$@" done readonly "$@" | export printf
+		x=1 --verbose export /usr/bin
+readonly "$1" local awk grep x=1 | 'quoted text' echo then | done test "$1"
+		| -eu "$@" ${HOME} "$1" awk readonly then
+		2>/dev/null 2>/dev/null cd done -eu awk ${HOME} awk 'quoted text'
+	2>/dev/null cd && $(pwd) export x=1 then $(pwd)
+		cd then local | && /usr/bin | sed printf 'quoted text'
+&& echo 2>/dev/null "$@" 2>/dev/null
+	cd printf "$1" | readonly -eu done
+		2>/dev/null $(pwd) test then --verbose sed export 'quoted text' sed readonly cd
+	$(pwd) grep grep 2>/dev/null -eu sed readonly --verbose -eu
+		done -eu "$1" readonly /usr/bin /usr/bin test done 2>/dev/null
+		readonly x=1 'quoted text' 'quoted text'
+		"$1" sed x=1 grep readonly "$@" printf sed awk "$@" x=1 test grep
+	cd 'quoted text' grep grep local grep
+	export 2>/dev/null ${HOME} done grep 2>/dev/null
+	2>/dev/null 2>/dev/null echo "$@" awk "$1"
+	awk "$@" x=1 done cd printf readonly && awk | 'quoted text'
+	local x=1 "$1" "$@" ${HOME} readonly
+-eu && local printf x=1 /usr/bin -eu --verbose cd local
+export && 'quoted text' printf sed printf printf test 2>/dev/null then -eu
+	then 'quoted text' sed | sed ${HOME} x=1 'quoted text'
+	export local echo "$1" sed ${HOME} awk done "$@" local local export $(pwd)
+		then -eu $(pwd) test
+	-eu --verbose export readonly
+"$1" | test && ${HOME} "$1" && done local echo | "$@"
+		"$@" sed then "$@" 'quoted text' | grep grep
+$(pwd) x=1 printf readonly echo --verbose awk awk readonly
+${HOME} $(pwd) grep 'quoted text'
+		--verbose readonly | then done then readonly /usr/bin x=1
+local --verbose local --verbose $(pwd) $(pwd) "$1"
+		"$@" $(pwd) 2>/dev/null --verbose echo done /usr/bin
+&& printf /usr/bin sed | 'quoted text' export ${HOME} local "$1" /usr/bin
+	"$1" 2>/dev/null done local readonly
+	x=1 && readonly x=1 -eu --verbose done 'quoted text' test "$@" x=1 "$@" export awk
+		"$@" | "$1" cd done awk /usr/bin $(pwd) echo
+$(pwd) /usr/bin /usr/bin grep 2>/dev/null /usr/bin "$@" local x=1
+	then | then sed --verbose && local printf 'quoted text'
+local $(pwd) printf "$1" local then
+local test --verbose 2>/dev/null
+	--verbose local local && /usr/bin
+		test 2>/dev/null local $(pwd) awk 'quoted text' $(pwd) x=1 awk awk -eu grep
+	"$1" cd done && awk test awk sed
+sed test --verbose --verbose 'quoted text' "$@" 2>/dev/null printf
+		x=1 export awk "$1" test awk sed 2>/dev/null export grep local
+awk && x=1 then -eu -eu awk cd ${HOME} done sed
+sed $(pwd) /usr/bin 'quoted text' | cd local ${HOME} test 2>/dev/null
+	awk awk awk x=1 done "$@" ${HOME} /usr/bin x=1 /usr/bin x=1 done export printf
+		&& && && 'quoted text' awk local
+local /usr/bin "$@" export printf 'quoted text' then ${HOME}
+	awk | ${HOME} $(pwd) ${HOME} && done local | done
+cd | then export export echo "$1" then then $(pwd) readonly sed readonly && awk
+echo && cd grep x=1 echo "$@" && && sed --verbose echo && sed sed test echo 2>/dev/null
+		export && ${HOME} && done cd
+		printf "$1" | --verbose readonly "$1" 'quoted text' --verbose
+printf | local "$@" --verbose sed 'quoted text' local
+		test /usr/bin && "$@" 2>/dev/null "$1" then "$@" $(pwd) printf "$1"
+		| --verbose "$1" ${HOME} -eu awk
+		printf printf | local x=1 'quoted text' ${HOME} sed then ${HOME}
+		sed /usr/bin sed echo awk readonly
+		export "$1" echo export "$1" && "$@"
+	test export -eu echo ${HOME} | cd | x=1 2>/dev/null --verbose "$@" /usr/bin
+	'quoted text' x=1 cd /usr/bin $(pwd) |
+export "$1" done then local -eu && local printf
+-eu export x=1 then echo done -eu then 'quoted text' done sed
+"$1" /usr/bin test export test /usr/bin /usr/bin test
+sed grep local $(pwd) done cd 'quoted text'
+2>/dev/null 'quoted text' done -eu awk | cd done test
+		readonly test -eu $(pwd) --verbose
+	/usr/bin && then test "$@" && done
+	export ${HOME} local echo test echo ${HOME} "$1" -eu &&
+		test && export -eu readonly
+"$@" sed printf export --verbose readonly "$@" $(pwd) done sed
+		--verbose -eu export 2>/dev/null export x=1 ${HOME} /usr/bin
+2>/dev/null cd 'quoted text' export 2>/dev/null -eu ${HOME} local grep local
+		printf printf awk -eu 'quoted text' readonly
+local 2>/dev/null sed && x=1 && ${HOME} test | grep
+		test ${HOME} sed export /usr/bin
+		readonly | "$@" readonly 2>/dev/null 'quoted text' /usr/bin local awk "$@"
+		printf ${HOME} "$@" x=1 local 2>/dev/null --verbose -eu echo
+	x=1 /usr/bin local --verbose 'quoted text' grep && readonly && x=1 test awk sed
+	"$@" 'quoted text' /usr/bin then echo $(pwd) x=1 ${HOME} "$1" x=1 echo --verbose
+		${HOME} echo readonly 2>/dev/null grep printf readonly local $(pwd)
+	-eu "$@" printf --verbose printf | | 'quoted text'
+	"$@" grep readonly $(pwd) -eu | grep
+grep echo && ${HOME} then "$@" --verbose awk test
+/usr/bin ${HOME} --verbose $(pwd) 2>/dev/null
+	grep -eu "$@" "$1" grep grep 'quoted text' local
+	sed 'quoted text' | 2>/dev/null local $(pwd) && local
+test 2>/dev/null -eu grep
+	sed export x=1 printf cd sed 2>/dev/null ${HOME} printf then /usr/bin "$1"
+	/usr/bin printf grep awk local 'quoted text' /usr/bin grep "$@" "$1" echo grep sed
+	readonly "$1" /usr/bin sed /usr/bin then --verbose
+--verbose ${HOME} then
+		local --verbose 2>/dev/null cd ${HOME} printf echo grep awk then test local
+		--verbose 'quoted text' printf printf printf -eu /usr/bin cd awk awk local "$@"
+'quoted text' -eu test x=1
+		echo awk x=1 done done grep ${HOME}
+local sed readonly ${HOME} awk -eu printf $(pwd) sed ${HOME} then ${HOME}
+done "$@" then 'quoted text' /usr/bin sed "$@" 'quoted text'
+done cd export 2>/dev/null printf
+		2>/dev/null $(pwd) 'quoted text' --verbose echo sed 2>/dev/null
+export echo done readonly ${HOME} ${HOME} x=1 grep
+cd --verbose echo "$@" --verbose x=1 export echo $(pwd) test "$@" |
+		'quoted text' done && $(pwd) x=1 done
+		/usr/bin --verbose awk
+$(pwd) "$@" $(pwd) x=1 test readonly echo ${HOME} x=1 readonly
+	"$1" sed && x=1 cd && x=1 local ${HOME} 'quoted text' "$1" 2>/dev/null &&
+	awk --verbose -eu then $(pwd) readonly 'quoted text' && 'quoted text'
+grep && grep 2>/dev/null "$1" $(pwd) /usr/bin
+export then local export export grep ${HOME} printf sed -eu && "$1" sed ${HOME}
+	cd readonly "$1" printf 2>/dev/null
+local | done ${HOME} x=1 && local awk
+		grep x=1 local 2>/dev/null done readonly &&
+		2>/dev/null echo then export "$@" -eu 2>/dev/null /usr/bin /usr/bin
+	done readonly | --verbose 'quoted text'
+	then x=1 sed awk -eu -eu done local grep cd --verbose
+| done 2>/dev/null echo 'quoted text' /usr/bin "$@" 'quoted text' done "$1" /usr/bin
+2>/dev/null cd 2>/dev/null -eu echo cd awk "$@"
+		$(pwd) local --verbose "$@" test echo
+		${HOME} printf test x=1 "$@" $(pwd) done cd echo test export && cd /usr/bin 2>/dev/null
+cd test /usr/bin readonly cd export done printf x=1 && /usr/bin local
+	"$@" "$1" --verbose -eu -eu --verbose printf $(pwd)
+	then x=1 -eu --verbose then 'quoted text'
+	"$@" --verbose export done readonly x=1 sed | printf ${HOME} export
+sed sed printf local 2>/dev/null
+	x=1 echo "$1" "$@" && && readonly
+	$(pwd) -eu printf x=1 "$@" then sed -eu cd printf
+		done x=1 done --verbose /usr/bin 2>/dev/null grep cd echo export /usr/bin grep
+/usr/bin "$1" $(pwd) --verbose echo done
+	-eu && --verbose --verbose sed sed cd ${HOME} test readonly && 'quoted text'
+'quoted text' -eu --verbose -eu sed && done ${HOME} ${HOME} 'quoted text'
+		--verbose "$1" grep ${HOME} /usr/bin
+	sed 2>/dev/null echo /usr/bin then "$1" /usr/bin x=1 sed x=1 awk
+		-eu --verbose done ${HOME}
+${HOME} local then export 2>/dev/null echo 2>/dev/null
+		&& awk --verbose done
+&& /usr/bin printf then /usr/bin readonly 'quoted text' cd
+x=1 local export echo 2>/dev/null done export grep 2>/dev/null
+awk readonly $(pwd) grep cd ${HOME} 'quoted text' 2>/dev/null
+	echo local then x=1 $(pwd) && done --verbose "$1" --verbose sed -eu -eu sed |
+test cd --verbose grep export
+	&& 'quoted text' -eu /usr/bin local sed $(pwd) "$1" | "$1" printf then --verbose
+done sed /usr/bin printf cd --verbose
+		x=1 sed printf 2>/dev/null printf -eu export "$@" "$@" 'quoted text'
+		awk ${HOME} -eu test cd /usr/bin cd grep sed readonly
+x=1 echo local 2>/dev/null $(pwd) 2>/dev/null && 'quoted text' test
+test 2>/dev/null --verbose --verbose
+cd --verbose grep ${HOME} then /usr/bin --verbose awk done
+		local readonly -eu cd | printf && echo cd grep echo local
+		$(pwd) sed test echo /usr/bin printf
+		sed --verbose x=1 done local printf awk -eu --verbose x=1 && then grep ${HOME}
+	'quoted text' grep 'quoted text'
+"$1" 'quoted text' test && printf "$@" /usr/bin
+		grep done | | && export && local grep
+-eu x=1 echo | readonly $(pwd)
+		done done && done && then grep /usr/bin 'quoted text' --verbose
+		awk echo then grep "$1" cd export local echo done
+		-eu then --verbose printf readonly -eu
+	local grep "$@" $(pwd) awk readonly /usr/bin
+	&& 'quoted text' x=1 test "$@" cd && then | "$1" echo
+test | then ${HOME} 'quoted text' grep printf $(pwd) -eu awk export grep
+	sed --verbose echo grep
+	readonly sed 'quoted text' | test x=1 $(pwd) x=1 --verbose echo
+	export $(pwd) awk x=1 readonly && && then echo cd ${HOME} sed -eu "$1" awk echo
+	2>/dev/null | grep && $(pwd) | done "$1" | --verbose grep 'quoted text' readonly
+sed then && awk x=1 export echo ${HOME} $(pwd) echo test readonly "$@"
+2>/dev/null echo printf "$1"
+/usr/bin && export "$@"
+$(pwd) test readonly ${HOME} 'quoted text'
+	export -eu done -eu done test printf
+sed && done awk --verbose /usr/bin local printf local
+$(pwd) $(pwd) test "$@" $(pwd) export -eu x=1 x=1 sed test
+	/usr/bin x=1 local /usr/bin "$@" sed "$@" --verbose grep
+		readonly ${HOME} /usr/bin x=1 export $(pwd) test /usr/bin $(pwd) -eu
+local cd "$1" -eu --verbose sed $(pwd) ${HOME} "$1" 2>/dev/null then --verbose
+x=1 "$@" 'quoted text' x=1 | "$@" export readonly
+	sed && grep cd printf export echo grep echo | 'quoted text' && printf 2>/dev/null
+	2>/dev/null test sed && /usr/bin test $(pwd) 2>/dev/null then sed export ${HOME}
+--verbose cd "$1" export echo
+	/usr/bin export readonly
+	export grep && done && local test --verbose grep
+		x=1 echo cd | printf && |
+	printf && --verbose $(pwd) export done
+grep cd sed $(pwd) | x=1
+local -eu 'quoted text' ${HOME}
+readonly printf then x=1 && "$1"
+printf 'quoted text' --verbose "$@" cd -eu sed local
+done awk 'quoted text' cd grep export awk ${HOME} --verbose
+then export awk done ${HOME} ${HOME} printf
+done ${HOME} test export
+	echo x=1 ${HOME} echo "$1" printf "$1"
+		"$1" ${HOME} grep $(pwd) local |
+	test "$1" cd | awk grep --verbose "$@" local && echo then
+		export echo done /usr/bin -eu sed echo 'quoted text'
+		export printf /usr/bin awk grep export readonly done && --verbose /usr/bin sed
+	done "$1" "$1" && --verbose --verbose export --verbose && | /usr/bin
+-eu /usr/bin local cd && export
+		2>/dev/null ${HOME} sed echo "$@" export "$@" "$@" cd $(pwd) 2>/dev/null $(pwd)
+	$(pwd) x=1 "$@" printf then local awk /usr/bin --verbose --verbose export
+'quoted text' | then | -eu ${HOME} cd --verbose
+	$(pwd) --verbose -eu local export readonly
+awk grep grep export sed && cd export readonly x=1 then cd cd
+		awk test readonly x=1 done /usr/bin local sed echo && printf
+	then --verbose readonly --verbose $(pwd)
+		$(pwd) | cd test $(pwd) /usr/bin ${HOME} printf local | awk "$@" "$@"
+local $(pwd) 2>/dev/null x=1 /usr/bin x=1
+	awk "$1" | -eu test readonly local
+		local printf printf test export echo done echo "$1" cd printf done ${HOME} printf
+export export | test then | && /usr/bin printf --verbose echo awk
+		printf test printf readonly then
+"$1" && readonly awk local -eu "$1" awk $(pwd) printf "$@" sed
+		--verbose "$1" awk export local test
+		echo && cd 2>/dev/null -eu cd | 2>/dev/null done
+readonly export test export printf cd 'quoted text' export sed export cd
+		| readonly echo awk && "$1" readonly cd |
+2>/dev/null echo x=1 printf printf then
+| awk test "$@" && 2>/dev/null
+then then then done printf "$1" -eu ${HOME} | --verbose x=1 awk readonly
+	sed then grep awk local "$1" | grep ${HOME} grep test
+	/usr/bin "$@" done 2>/dev/null ${HOME} "$1" -eu 'quoted text' then 2>/dev/null
+		cd then export then /usr/bin done
+	export export grep --verbose && then /usr/bin cd ${HOME}
+	then cd | echo --verbose awk test test sed /usr/bin
+	grep export x=1 sed test "$1" -eu 2>/dev/null readonly "$@" 'quoted text'
+	'quoted text' | printf /usr/bin "$@"
+	awk cd cd export ${HOME} readonly --verbose then
+	&& 2>/dev/null test sed
+2>/dev/null $(pwd) $(pwd) done cd && local echo "$@" awk local
+	done x=1 "$@" --verbose awk x=1 /usr/bin local x=1 | local cd | &&
+	"$@" "$@" && /usr/bin /usr/bin
+x=1 cd /usr/bin | | export cd 2>/dev/null
+printf $(pwd) $(pwd) then then && /usr/bin
+		$(pwd) 2>/dev/null printf local 'quoted text' grep test then test && done -eu
+	'quoted text' local cd /usr/bin cd ${HOME} 'quoted text' 2>/dev/null
+		'quoted text' --verbose 'quoted text' | && printf
+	echo "$@" 2>/dev/null -eu ${HOME}
+x=1 test export grep --verbose | local readonly -eu test grep
+	grep x=1 readonly echo "$1" "$@" local echo done | readonly 2>/dev/null test
+	x=1 then | x=1 sed ${HOME} $(pwd) --verbose "$1" ${HOME} cd awk grep
+	--verbose 2>/dev/null sed | grep 'quoted text' 'quoted text' "$1" |
+then printf "$@" then then --verbose echo echo /usr/bin
+--verbose done 'quoted text' cd x=1 2>/dev/null grep grep
+		2>/dev/null printf grep grep 2>/dev/null ${HOME} ${HOME} 2>/dev/null printf -eu
+	&& test ${HOME} x=1 done export test && local
+echo done ${HOME} ${HOME} && local readonly readonly
+		printf 2>/dev/null done | "$@" $(pwd) 2>/dev/null
+		done cd && && 2>/dev/null
+echo /usr/bin grep test -eu 2>/dev/null 'quoted text' readonly printf local grep
+		local --verbose 2>/dev/null | awk | then done then x=1 grep export
+/usr/bin 2>/dev/null awk -eu export x=1 test | $(pwd) | --verbose --verbose
+	| /usr/bin x=1 echo /usr/bin cd -eu awk readonly test
+test echo 'quoted text' 2>/dev/null local 'quoted text'
+	-eu test | "$1" $(pwd) awk |
+		cd "$@" sed "$@" x=1 cd 'quoted text' done
+		&& test x=1 readonly --verbose
+	grep export echo $(pwd) "$@" grep local /usr/bin && 'quoted text'
+		sed $(pwd) echo export -eu readonly && export echo sed /usr/bin cd local printf
+	x=1 "$@" -eu printf ${HOME} $(pwd) test export ${HOME} $(pwd) 2>/dev/null
+"$1" --verbose done cd "$1" test && done export
+		-eu then grep done && local
+		readonly then awk test | "$@" local printf awk | -eu 2>/dev/null sed test printf
+		awk grep ${HOME} && then awk then -eu cd done awk grep && local local /usr/bin then
+	printf export | echo cd readonly /usr/bin echo x=1 "$1" echo export
+		2>/dev/null printf --verbose
+	x=1 then printf 2>/dev/null x=1 /usr/bin sed printf 2>/dev/null
+echo x=1 x=1 --verbose then printf /usr/bin local && "$1" readonly
+$(pwd) local then awk "$1" "$@" awk awk then | 2>/dev/null awk grep
+	| grep $(pwd) then $(pwd) 2>/dev/null export "$@" readonly
+		| done cd | grep ${HOME} test
+	printf printf "$1" export sed cd -eu then readonly cd | printf sed
+		/usr/bin --verbose export --verbose "$1" 'quoted text' done sed awk "$@"
+		| export echo $(pwd) | "$1" sed printf "$@" then printf test && --verbose
+done 'quoted text' ${HOME} "$@" printf
+	--verbose ${HOME} -eu readonly test | | export printf
+readonly 2>/dev/null printf -eu && readonly local local /usr/bin sed /usr/bin
+		/usr/bin "$1" --verbose "$1" -eu x=1 awk sed readonly 2>/dev/null
+		${HOME} && echo $(pwd) 2>/dev/null ${HOME} awk
+$(pwd) readonly sed then
+		test awk && $(pwd) cd /usr/bin echo
+-eu awk local awk "$1" then 2>/dev/null
+		'quoted text' export printf printf 2>/dev/null
+		test 'quoted text' printf export sed test cd --verbose
+		grep /usr/bin 'quoted text' export && done 'quoted text'
+		local grep && done echo done sed && $(pwd) && 2>/dev/null done $(pwd)
+		2>/dev/null $(pwd) $(pwd) "$@" sed grep echo
+		/usr/bin then /usr/bin 2>/dev/null readonly cd echo grep
+		--verbose /usr/bin && then
+	&& readonly grep then $(pwd) x=1 | 'quoted text'
+cd sed then --verbose "$@" x=1 --verbose && grep cd local /usr/bin
+		grep readonly test test
+	cd -eu echo x=1 readonly printf 2>/dev/null ${HOME} cd | ${HOME}
+x=1 readonly /usr/bin sed "$@" cd cd /usr/bin ${HOME} && local
+		printf -eu "$@" readonly 'quoted text'
+		2>/dev/null x=1 then export --verbose printf | -eu sed "$@" 2>/dev/null
+	-eu --verbose --verbose x=1 "$1" then 'quoted text' x=1 cd sed then
+	then -eu 2>/dev/null grep "$1" grep --verbose readonly awk | ${HOME} export
+"$1" grep 2>/dev/null test grep | printf
+x=1 local export && && export
+	printf /usr/bin done export grep | cd export x=1 x=1 2>/dev/null
+		grep echo && ${HOME} 'quoted text' echo 2>/dev/null x=1 then x=1 local
+		&& $(pwd) export $(pwd) sed $(pwd) && export ${HOME} && printf
+		${HOME} done sed sed echo --verbose | echo echo readonly
+${HOME} | awk "$@" --verbose
+		then done --verbose 2>/dev/null /usr/bin test then --verbose echo 2>/dev/null
+	done && sed --verbose x=1 x=1 "$@" | awk done cd /usr/bin
+export done local readonly 'quoted text' ${HOME} ${HOME} local
+	"$1" local done export | x=1 sed awk export /usr/bin -eu done local && grep
+then && --verbose 2>/dev/null | done 2>/dev/null test 2>/dev/null x=1 test
+local ${HOME} -eu awk $(pwd) $(pwd) echo
+local grep grep /usr/bin "$1" x=1 ${HOME}
+grep 2>/dev/null x=1 'quoted text' "$@" -eu $(pwd)
+	grep sed test echo 2>/dev/null && 'quoted text' sed ${HOME}
+$(pwd) then awk echo local sed awk $(pwd) printf "$@" printf grep sed --verbose
+	-eu sed readonly test "$@"
+	| "$@" export 'quoted text' 'quoted text' /usr/bin /usr/bin cd 2>/dev/null
+	cd then printf | awk "$@" 2>/dev/null
+export $(pwd) 'quoted text' sed 2>/dev/null
+awk sed | printf local done |
+		echo 'quoted text' -eu ${HOME} x=1 "$1" done 2>/dev/null
+	${HOME} then grep then x=1 && readonly "$1" grep /usr/bin /usr/bin
+--verbose echo x=1 printf test && --verbose "$@" "$@" x=1 "$1" cd | ${HOME} printf
+		'quoted text' done echo export grep then /usr/bin 'quoted text'
+	"$1" test --verbose test ${HOME} x=1 local
+grep printf sed then echo && then echo
+		/usr/bin export 2>/dev/null then sed local ${HOME} ${HOME} 'quoted text' | /usr/bin
+	cd "$@" awk --verbose readonly --verbose grep "$@" -eu x=1 'quoted text'
+		readonly /usr/bin grep $(pwd) awk "$@"
+	2>/dev/null "$@" x=1 awk $(pwd) readonly x=1 "$1" sed
+		readonly done 'quoted text' /usr/bin "$@" local
+awk cd cd 2>/dev/null | then then local "$1"
+	-eu && x=1 then printf $(pwd) echo export 2>/dev/null
+		printf ${HOME} $(pwd) test test $(pwd) awk readonly
+	$(pwd) test -eu test | "$@" readonly export x=1
+readonly readonly readonly "$@" "$@" "$1" -eu --verbose sed cd /usr/bin
+"$@" sed x=1 then | test printf $(pwd)
+		sed sed | -eu cd --verbose
+awk cd --verbose readonly export
+		done | | printf awk local /usr/bin "$1" sed echo
+${HOME} then --verbose ${HOME} grep readonly
+sed "$@" test test awk local sed "$1" $(pwd) x=1 readonly | 2>/dev/null
+		awk done printf echo --verbose awk awk | $(pwd) 'quoted text' && 2>/dev/null
+		cd test grep awk local echo sed && export grep printf sed sed
+readonly test grep export 'quoted text'
+	--verbose x=1 grep local --verbose 'quoted text' then
+		"$@" local cd -eu --verbose "$@" "$1" "$1" && awk --verbose /usr/bin
+		2>/dev/null 2>/dev/null
+awk then $(pwd) then test awk | cd | local grep done export
+		| export awk --verbose && | export $(pwd) test /usr/bin
+		x=1 export "$@" | then
+echo 'quoted text' 'quoted text'
+		readonly printf "$@" ${HOME} x=1 "$1" | awk $(pwd)
+	export 2>/dev/null && $(pwd) 2>/dev/null $(pwd) | sed cd export cd export readonly
+--verbose "$1" x=1 test test ${HOME} then x=1 export $(pwd)
+	sed --verbose done done "$@" "$1" local "$1" sed 2>/dev/null
+printf ${HOME} done 'quoted text' ${HOME} then "$@" | -eu "$@" sed && printf
+		readonly grep /usr/bin ${HOME}
+then "$@" printf readonly then grep echo test "$@" -eu local
+| then /usr/bin grep $(pwd) then x=1 awk -eu ${HOME} awk "$@" "$@" 2>/dev/null
+	awk -eu cd awk sed | --verbose "$@" /usr/bin readonly
+		$(pwd) 2>/dev/null --verbose local readonly grep 2>/dev/null
+2>/dev/null $(pwd) --verbose awk | && ${HOME} export ${HOME}
+	'quoted text' && then --verbose printf test grep $(pwd) sed --verbose
+		cd x=1 done && "$1" local export 'quoted text' export
+	2>/dev/null test 2>/dev/null
+		'quoted text' sed export local 'quoted text' && echo local "$@" --verbose export
+local local cd "$1" awk local test then $(pwd) -eu | local test
+'quoted text' | 'quoted text' awk grep | "$1" local cd readonly
+then ${HOME} 'quoted text' --verbose "$@" done x=1 2>/dev/null export
+	awk ${HOME} sed echo export local done
+echo local test /usr/bin 'quoted text' ${HOME} local sed -eu
+	printf x=1 $(pwd) grep
+		done readonly 2>/dev/null done
+		awk printf 'quoted text'
+	grep /usr/bin cd readonly export /usr/bin x=1 cd --verbose cd test sed
+		local then /usr/bin cd 2>/dev/null awk
+	echo echo export $(pwd) $(pwd)
+	&& | | /usr/bin sed export "$@" local && "$@" --verbose then
+	awk -eu ${HOME} sed sed readonly local $(pwd) /usr/bin then
+readonly sed done test awk "$1" awk test export then printf
+| echo done "$1" sed "$1" export export 2>/dev/null printf
+		/usr/bin awk sed | ${HOME}
+&& awk "$1" && printf echo echo
+-eu grep "$1" "$1" echo "$1" $(pwd) printf printf
+	sed x=1 --verbose sed 'quoted text' -eu sed awk awk sed --verbose
+		export 'quoted text' "$@" export export "$@"
+	grep readonly sed /usr/bin ${HOME}
+then ${HOME} local grep /usr/bin ${HOME}
+		sed then /usr/bin done echo "$@" grep $(pwd) awk --verbose echo 2>/dev/null -eu
+		grep /usr/bin 'quoted text'
+local | printf echo cd "$1" echo printf
+		awk -eu sed cd awk test --verbose
+x=1 $(pwd) readonly echo then /usr/bin awk "$1" /usr/bin readonly export
+readonly printf | "$@" -eu 2>/dev/null readonly export
+	"$@" -eu local printf test printf /usr/bin &&
+-eu echo echo then local echo "$@" test export --verbose
+| --verbose --verbose readonly "$@" --verbose then -eu awk
+	then then echo sed ${HOME} awk done local export /usr/bin export --verbose && printf
+	--verbose then -eu $(pwd)
+		'quoted text' 'quoted text' ${HOME} /usr/bin readonly &&
+		done x=1 x=1 x=1 --verbose | sed export ${HOME} done readonly
+"$1" "$1" local test export
+		&& 'quoted text' export grep
+		'quoted text' x=1 ${HOME} | $(pwd) --verbose sed x=1 test grep
+-eu echo 'quoted text' 'quoted text' echo sed | /usr/bin -eu
+		readonly export cd sed done cd --verbose
+then local local awk -eu "$1" ${HOME} export grep --verbose $(pwd) "$1"
+"$@" 2>/dev/null local cd done
+		$(pwd) readonly local /usr/bin local | printf printf cd printf
+then readonly | readonly ${HOME} "$@"
+	local sed -eu then --verbose sed echo --verbose "$1" 2>/dev/null &&
+		${HOME} export 'quoted text'
+		test "$@" local cd --verbose printf
+-eu 2>/dev/null awk /usr/bin echo $(pwd) awk /usr/bin | x=1 local readonly grep
+	then echo -eu export done -eu readonly -eu done local
+$(pwd) x=1 /usr/bin /usr/bin
+x=1 sed ${HOME} x=1 printf export
+		"$1" awk --verbose export && awk ${HOME} 2>/dev/null $(pwd)
+		$(pwd) sed cd | readonly "$@" echo && && -eu x=1 $(pwd)
+${HOME} ${HOME} ${HOME} x=1 && export &&
+"$@" test --verbose ${HOME} then 2>/dev/null --verbose
+		readonly ${HOME} $(pwd) ${HOME} local --verbose ${HOME} printf "$1"
+local $(pwd) local "$1" "$@" then test done
+--verbose awk | 2>/dev/null "$@" "$1" -eu | "$@" "$@" readonly 2>/dev/null
+	local /usr/bin && -eu && "$1" $(pwd)
+		--verbose echo ${HOME} ${HOME} test export --verbose "$@" then ${HOME} | cd
+	local printf readonly
+		grep $(pwd) echo export -eu
+		$(pwd) ${HOME} --verbose
+	done /usr/bin awk printf done readonly local /usr/bin
+		sed then export then then -eu -eu awk
+"$1" 2>/dev/null | export $(pwd) x=1 --verbose -eu -eu echo -eu /usr/bin
+-eu "$@" printf "$@" /usr/bin awk then /usr/bin test then
+	/usr/bin | awk x=1 && x=1 --verbose test "$1" $(pwd) "$1" awk readonly grep | &&
+	-eu | x=1 "$@" 'quoted text'
+		echo test ${HOME} done && export done echo local
+	2>/dev/null | -eu sed readonly done printf ${HOME} printf 2>/dev/null
+	"$1" x=1 x=1 awk 2>/dev/null "$@" "$@" | --verbose
+		cd | local local $(pwd) then export
+sed 2>/dev/null "$@" sed grep "$1" $(pwd) readonly "$1" "$1" --verbose
+local sed x=1 local "$@" awk $(pwd) ${HOME}
+	'quoted text' test readonly grep "$@" sed test
+&& done awk echo 'quoted text' cd echo
+		2>/dev/null done grep sed printf 'quoted text'
+	readonly readonly done done
+awk readonly && done "$1" "$@" readonly export $(pwd) --verbose
+		$(pwd) export ${HOME} 2>/dev/null sed cd done
+&& export export echo sed --verbose
+		grep 2>/dev/null $(pwd) printf -eu "$1" 2>/dev/null
+	readonly --verbose | grep grep "$@" && ${HOME} ${HOME}
+		| readonly | --verbose "$1" && cd cd ${HOME} --verbose readonly
+then ${HOME} && test test then "$@" export x=1 grep 'quoted text' x=1
+		printf printf 'quoted text'
+	'quoted text' ${HOME} -eu && "$1" printf test readonly local then "$1"
+		sed then && | local cd awk | /usr/bin x=1 2>/dev/null x=1 2>/dev/null &&
+		done 'quoted text' grep sed ${HOME} && "$@" && grep /usr/bin echo "$1" sed
+	'quoted text' /usr/bin sed 'quoted text'
+		awk 'quoted text' then sed then && grep export ${HOME} export awk $(pwd) export
+/usr/bin test readonly then 'quoted text' && $(pwd) -eu && local test | then /usr/bin
+test printf test echo | printf then /usr/bin
+		readonly done sed $(pwd) done x=1 test $(pwd) readonly | |
+	"$1" test /usr/bin then done x=1 then --verbose cd 2>/dev/null
+		printf then $(pwd) readonly 2>/dev/null && cd sed export cd then awk 2>/dev/null
+| $(pwd) "$@" && test $(pwd) "$@" then -eu | sed /usr/bin
+$(pwd) readonly sed --verbose then readonly
+	local "$@" /usr/bin 'quoted text' "$@" export cd /usr/bin /usr/bin
+		echo 2>/dev/null awk x=1 /usr/bin "$@" 'quoted text' ${HOME} x=1 'quoted text'
+	x=1 && 'quoted text' 2>/dev/null local
+done awk $(pwd) then export cd $(pwd) then
+	then awk $(pwd) $(pwd) cd 2>/dev/null printf "$@" "$1" $(pwd) test 2>/dev/null
+		&& awk then grep -eu $(pwd) && 2>/dev/null
+cd grep --verbose 2>/dev/null x=1 printf /usr/bin
+	done && --verbose $(pwd) printf local readonly grep x=1 done test local then done
+grep test readonly printf x=1 ${HOME} sed done local -eu | readonly -eu 2>/dev/null
+		cd 2>/dev/null cd /usr/bin "$1" --verbose then /usr/bin /usr/bin 'quoted text'
+readonly x=1 $(pwd) "$1" echo export cd cd awk "$1" "$1" readonly
+		-eu --verbose readonly sed 'quoted text' local then
+2>/dev/null grep printf && local x=1 $(pwd) x=1 printf 'quoted text'
+		"$1" then test echo "$1" /usr/bin 'quoted text' cd /usr/bin done local
+	test grep grep done export
+	test sed | --verbose done cd ${HOME} /usr/bin printf done -eu &&
+printf -eu grep "$@" printf 'quoted text' $(pwd) done export then
+'quoted text' -eu && echo grep x=1 "$@" "$@" && echo ${HOME} done 2>/dev/null
+	/usr/bin readonly | -eu echo awk && && --verbose sed
+		$(pwd) awk 2>/dev/null "$@" local test "$@" awk --verbose sed test /usr/bin
+		${HOME} readonly $(pwd) grep --verbose sed ${HOME} /usr/bin
+"$1" -eu -eu printf test /usr/bin ${HOME} /usr/bin --verbose readonly
+test "$@" ${HOME} "$1" /usr/bin
+		'quoted text' then && cd export
+		local then test 'quoted text' 2>/dev/null
+awk x=1 export awk | local
+	done done | cd sed readonly test
+	| printf test ${HOME} x=1 cd sed done $(pwd) /usr/bin
+/usr/bin 2>/dev/null readonly
+		-eu local then /usr/bin
+	"$@" --verbose "$1" -eu ${HOME} ${HOME} readonly -eu --verbose x=1
+		cd "$1" sed | "$@" $(pwd)
+sed export 'quoted text' -eu grep "$1" done ${HOME} &&
+${HOME} echo test | 'quoted text' sed sed -eu --verbose done 'quoted text' $(pwd)
+		test printf x=1 x=1 awk | 2>/dev/null 'quoted text'
+printf ${HOME} 2>/dev/null echo printf "$@" /usr/bin -eu echo readonly /usr/bin
+		export sed export /usr/bin test "$@" done 'quoted text'
+	test -eu && done && done /usr/bin grep $(pwd) && "$@" export | readonly 2>/dev/null
+local 2>/dev/null awk | "$1" && readonly x=1 "$1"
+		${HOME} && $(pwd) "$@" 2>/dev/null done "$1"
+		local echo readonly /usr/bin | | sed test printf sed
+2>/dev/null && echo /usr/bin grep
+	awk 'quoted text' awk cd "$1" local 'quoted text' x=1
+		sed 2>/dev/null "$@" echo --verbose "$@" local | printf 'quoted text' local
+echo x=1 /usr/bin grep readonly --verbose grep cd readonly done sed 'quoted text'
+x=1 export awk /usr/bin | ${HOME} ${HOME}
+/usr/bin "$1" readonly && echo sed --verbose && cd awk --verbose
+2>/dev/null sed 'quoted text' $(pwd) "$1" "$@" x=1 | grep local
+then readonly cd cd done 2>/dev/null done x=1 && then cd
+		export grep local 2>/dev/null $(pwd) $(pwd) --verbose "$1" "$1" ${HOME} x=1
+		"$@" echo export $(pwd) 2>/dev/null $(pwd) "$1" then x=1 cd
+	'quoted text' "$1" done sed export "$1" printf | readonly && -eu
+	printf "$@" ${HOME} --verbose
+	grep readonly cd | cd printf echo x=1
+		/usr/bin done sed 'quoted text' echo grep $(pwd)
+		local local then test printf printf --verbose | ${HOME}
+	done "$1" sed ${HOME} --verbose done $(pwd)
+"$1" && $(pwd) sed ${HOME}
+2>/dev/null /usr/bin awk 'quoted text' cd ${HOME} | export awk sed
+	-eu then 'quoted text' done | test then printf
+	-eu 'quoted text' awk "$1"
+		2>/dev/null printf --verbose 'quoted text'
+		"$1" test | test cd readonly
+	$(pwd) 2>/dev/null local $(pwd) sed
+echo local ${HOME} printf awk done --verbose ${HOME} grep /usr/bin "$1"
+${HOME} 'quoted text' /usr/bin x=1 | && test echo && | x=1 grep
+	"$1" then --verbose local printf then printf echo readonly then readonly --verbose
+		x=1 printf test -eu test cd
+"$1" 2>/dev/null then | export
+x=1 export $(pwd) "$1" local sed echo test 2>/dev/null 'quoted text' done
+2>/dev/null 'quoted text' readonly cd cd sed local &&
+		&& ${HOME} ${HOME} test
+$(pwd) printf $(pwd) export cd echo then then x=1 cd cd
+test -eu && "$@" 2>/dev/null "$1" | 'quoted text' readonly
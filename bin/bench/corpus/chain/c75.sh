@@ -0,0 +1,2001 @@
+	printf readonly && cd $(pwd)
+/usr/bin done x=1 done cd
+		-eu "$1" x=1 test "$1" | printf export -eu
+	$(pwd) export grep && readonly /usr/bin 2>/dev/null
+'quoted text' grep /usr/bin 2>/dev/null done
+	readonly awk printf ${HOME} /usr/bin export export "$@" cd | test grep "$1"
+		&& test cd awk -eu local "$1" && x=1 "$1" cd done 'quoted text'
+"$1" -eu x=1 cd /usr/bin && then && 2>/dev/null
+		-eu local test 2>/dev/null && local "$@" | sed 'quoted text' | export export
+sed | done -eu ${HOME}
+	"$1" && x=1 'quoted text' then printf cd
+	-eu 2>/dev/null test "$1" $(pwd) local 'quoted text'
+| "$@" -eu ${HOME} local --verbose && test x=1 "$@" local
+		awk 2>/dev/null -eu test ${HOME} -eu sed
+		done "$@" 2>/dev/null --verbose && test printf "$@" 'quoted text'
+'quoted text' 2>/dev/null grep
+	done cd "$1" "$1" && awk cd
+	test ${HOME} awk 2>/dev/null "$@" ${HOME} cd printf
+		echo awk --verbose 2>/dev/null
+		printf readonly | done grep echo $(pwd) /usr/bin
+	/usr/bin readonly export readonly awk then --verbose
+		"$1" "$1" cd ${HOME} ${HOME} -eu
+		grep && test && sed /usr/bin cd cd "$@" --verbose x=1 && x=1 local
+| 'quoted text' 2>/dev/null --verbose
+	'quoted text' echo && 'quoted text' then $(pwd) grep grep && printf && ${HOME}
+| && 'quoted text' grep then printf grep cd done sed local cd 'quoted text' done
+&& "$1" "$@" 2>/dev/null export printf -eu --verbose
+	printf done awk -eu echo printf then && "$1" test
+done readonly readonly | && test awk && 2>/dev/null ${HOME} --verbose ${HOME}
+	"$1" sed $(pwd) done 'quoted text' echo test sed x=1
+"$1" awk "$1" then && x=1 printf /usr/bin --verbose
+	'quoted text' 'quoted text' cd "$1" grep ${HOME} readonly awk /usr/bin cd echo
+		sed ${HOME} printf ${HOME} awk printf export
+	grep | export x=1 test readonly test printf -eu 'quoted text'
+export ${HOME} ${HOME} $(pwd) && ${HOME} | done 'quoted text'
+local grep $(pwd) then x=1 /usr/bin then $(pwd) /usr/bin 2>/dev/null
+	"$@" local readonly echo local
+readonly "$@" done && export ${HOME} grep 2>/dev/null /usr/bin x=1 cd && 2>/dev/null
+test echo done then 2>/dev/null -eu printf $(pwd)
+		/usr/bin && echo sed awk 'quoted text' 2>/dev/null
+	sed --verbose awk /usr/bin echo 2>/dev/null x=1 export 2>/dev/null echo awk
+awk 2>/dev/null readonly | echo && sed "$1" --verbose x=1 "$1" /usr/bin
+	"$@" cd readonly sed printf printf export then sed done
+"$1" echo echo "$1" -eu grep
+	cd cd export printf | then grep &&
+		${HOME} "$@" x=1 'quoted text' ${HOME} grep -eu /usr/bin awk && "$1" 'quoted text'
+	export then readonly --verbose "$1" sed readonly | /usr/bin | sed sed printf
+	readonly then printf --verbose test "$@"
+	--verbose then 'quoted text' readonly
+		echo echo x=1 $(pwd) test
+--verbose printf awk local grep | ${HOME} /usr/bin 'quoted text'
+		sed -eu awk grep done /usr/bin 2>/dev/null /usr/bin --verbose test export
+done echo $(pwd) readonly
+	${HOME} awk /usr/bin grep echo readonly test cd
+		x=1 then done && sed grep | $(pwd)
+$(pwd) then -eu echo test 'quoted text' $(pwd) "$@" grep x=1 sed
+	awk test "$@" 2>/dev/null then "$@"
+		"$1" printf x=1 test echo -eu then --verbose --verbose "$@"
+		x=1 /usr/bin echo 'quoted text' ${HOME} awk 'quoted text' && && done then grep
+-eu x=1 sed x=1 --verbose ${HOME}
+"$@" done "$1" echo test |
+	| "$1" "$1" local done grep done -eu && cd --verbose "$1" -eu
+then local export awk local printf
+| $(pwd) $(pwd) x=1 echo done --verbose ${HOME}
+awk "$1" awk export "$@" 'quoted text' $(pwd) | "$@" sed "$1" then sed | done
+then test done awk export 2>/dev/null
+awk done --verbose awk 'quoted text' x=1 "$@" done
+export sed local && echo test printf readonly "$1" x=1 2>/dev/null
+	awk "$@" x=1 && /usr/bin
+	echo /usr/bin echo ${HOME} $(pwd) | test cd printf export -eu readonly $(pwd)
+x=1 awk local && | | export sed cd
+	printf $(pwd) 'quoted text'
+$(pwd) printf export cd local $(pwd) 2>/dev/null test && local 'quoted text'
+'quoted text' ${HOME} printf | | then printf readonly --verbose
+"$@" -eu 2>/dev/null test | --verbose
+'quoted text' sed echo done 2>/dev/null --verbose grep cd
+		x=1 x=1 awk local x=1 --verbose
+		'quoted text' 'quoted text' then && -eu "$1" 2>/dev/null readonly ${HOME}
+		"$1" 2>/dev/null grep done $(pwd) ${HOME} /usr/bin
+		awk readonly done 'quoted text' 'quoted text'
+		cd "$@" test cd echo $(pwd) x=1 -eu cd printf
+		sed -eu local done $(pwd) grep
+${HOME} 'quoted text' printf readonly && cd awk
+		readonly | $(pwd) awk printf echo cd echo
+	| export x=1 export /usr/bin test awk readonly
+	cd printf then -eu x=1 $(pwd)
+		done grep then echo ${HOME} test --verbose --verbose sed /usr/bin
+2>/dev/null grep --verbose | grep echo --verbose
+		readonly cd export done --verbose export cd 2>/dev/null ${HOME}
+then done | --verbose && printf $(pwd) ${HOME} x=1 && done export
+		echo awk echo 2>/dev/null awk cd readonly
+		printf echo x=1 printf echo
+	&& test x=1 $(pwd) -eu then grep ${HOME} $(pwd) -eu readonly
+		then readonly done | echo done printf --verbose export | /usr/bin
+		x=1 grep "$1" 'quoted text' "$@" echo
+echo cd /usr/bin --verbose "$1" grep && x=1 | /usr/bin
+"$1" x=1 printf 2>/dev/null | "$@" x=1 "$1" export test "$@" grep -eu test
+		cd awk | printf "$@" -eu awk | readonly ${HOME} export --verbose
+		--verbose sed echo 2>/dev/null then local
+		x=1 /usr/bin && test -eu readonly -eu test test
+	test done sed 'quoted text' export sed
+&& export grep ${HOME} local x=1 local x=1 awk then local then "$@" sed /usr/bin
+"$1" then cd "$@" done printf then grep
+		readonly ${HOME} "$1" -eu awk && export -eu awk
+		&& "$1" 2>/dev/null then echo ${HOME} readonly sed printf then then test
+		2>/dev/null ${HOME} "$@" export export awk 'quoted text'
+	then 2>/dev/null -eu then export
+		test test local done -eu cd test && grep printf "$1" ${HOME}
+		-eu | "$@" 'quoted text' 2>/dev/null test
+		| local grep 'quoted text' readonly printf test done
+	then sed $(pwd) | | x=1 cd 'quoted text' awk /usr/bin ${HOME} export
+		x=1 && then done 'quoted text' x=1 --verbose 'quoted text' | awk
+$(pwd) x=1 echo && readonly
+	export 'quoted text' cd grep && 'quoted text' "$1" printf
+	$(pwd) then 2>/dev/null local $(pwd)
+	echo | grep | 'quoted text' && awk "$@" awk -eu then
+	local "$1" "$@" export /usr/bin 2>/dev/null
+		echo x=1 awk /usr/bin grep echo export 2>/dev/null
+	2>/dev/null "$@" "$@" test awk cd awk 'quoted text' -eu test 2>/dev/null -eu 'quoted text'
+/usr/bin grep test x=1 --verbose "$1"
+		/usr/bin --verbose -eu ${HOME} | awk x=1 test 2>/dev/null done printf local grep
+		awk sed 2>/dev/null $(pwd) $(pwd) /usr/bin echo printf ${HOME} test
+local grep local /usr/bin then
+export $(pwd) printf local && cd $(pwd) "$@" readonly "$@"
+"$@" then readonly --verbose
+	/usr/bin local printf readonly
+2>/dev/null awk | --verbose awk
+grep "$1" export "$1" | && ${HOME} && /usr/bin && grep
+		sed echo then "$1" awk && 'quoted text'
+x=1 echo ${HOME} echo $(pwd) -eu "$1" test
+| test echo -eu local | export grep
+	2>/dev/null then echo awk && grep echo cd test
+	sed awk /usr/bin | | x=1 $(pwd) 2>/dev/null test local
+	sed 'quoted text' sed "$1" export ${HOME} grep --verbose local
+		"$1" test "$@" echo $(pwd) export local printf 2>/dev/null "$1"
+$(pwd) echo awk | awk echo "$1" -eu done 2>/dev/null echo && test cd
+	awk done done awk $(pwd) awk 'quoted text' sed 'quoted text'
+	"$@" printf grep -eu grep "$@" $(pwd) && $(pwd) 2>/dev/null
+"$@" --verbose export --verbose
+		${HOME} ${HOME} 'quoted text'
+	"$@" 'quoted text' $(pwd) echo grep "$@" then done awk export
+		| then | && $(pwd) cd ${HOME} grep sed grep done
+	| -eu echo then 2>/dev/null | $(pwd)
+	x=1 ${HOME} cd x=1 'quoted text' sed "$@" --verbose done printf test "$@" local
+--verbose "$1" cd done | grep x=1 "$@" ${HOME} cd --verbose x=1
+		"$1" -eu printf x=1 readonly test test cd printf done cd | printf local
+${HOME} echo "$@" sed -eu cd cd && echo export
+		x=1 -eu /usr/bin 'quoted text'
+	local then awk sed 2>/dev/null
+	then $(pwd) "$1" --verbose
+		$(pwd) test x=1 --verbose printf | test awk --verbose printf $(pwd)
+'quoted text' ${HOME} grep awk export then done then
+	2>/dev/null local grep
+		x=1 $(pwd) readonly /usr/bin sed cd | && export -eu local 2>/dev/null
+		local then cd --verbose
+	"$@" x=1 | then ${HOME} export $(pwd) 2>/dev/null
+		$(pwd) 2>/dev/null local "$@" --verbose
+test local readonly 'quoted text' awk --verbose ${HOME} cd test
+		x=1 && --verbose 2>/dev/null -eu | 'quoted text' grep then
+	printf then 'quoted text' $(pwd) done done grep
+	"$@" grep test 2>/dev/null test
+	"$1" sed awk 'quoted text' echo $(pwd) test | sed | export
+grep echo local echo readonly echo local export ${HOME} /usr/bin
+	$(pwd) awk then 2>/dev/null done test x=1 grep
+	test cd then "$@" sed printf
+	--verbose x=1 cd readonly awk 2>/dev/null local "$1" ${HOME} x=1 cd printf x=1
+	echo 'quoted text' "$@" $(pwd) -eu local readonly "$1" ${HOME} 'quoted text'
+printf export "$1" "$1"
+	-eu $(pwd) 'quoted text' readonly awk ${HOME}
+/usr/bin local 2>/dev/null 2>/dev/null
+		&& done local -eu cd local -eu readonly printf && | 2>/dev/null "$1"
+2>/dev/null /usr/bin export "$@" 2>/dev/null
+		cd test && && grep test then sed -eu done "$1" && "$@" "$@"
+	${HOME} $(pwd) echo export local 'quoted text' printf grep printf cd export grep
+	| && done ${HOME} local $(pwd) | sed export sed ${HOME} readonly printf /usr/bin
+local | local awk echo -eu $(pwd) done && printf /usr/bin done grep
+	local local echo "$@" | sed readonly done $(pwd) local local printf test
+2>/dev/null "$1" sed --verbose "$1" echo then && readonly sed printf local
+		-eu readonly 'quoted text' cd grep ${HOME} "$1"
+		x=1 echo printf ${HOME} 'quoted text' "$1" echo awk sed readonly x=1 $(pwd) |
+	cd $(pwd) x=1 | x=1 "$@" cd cd
+'quoted text' cd /usr/bin export
+	--verbose $(pwd) then ${HOME} "$@" /usr/bin 2>/dev/null | $(pwd) cd "$1" "$1" test
+$(pwd) --verbose local readonly $(pwd)
+	"$1" --verbose done sed local sed grep export
+		done -eu done | awk ${HOME} done done
+		done "$@" echo then readonly &&
+	'quoted text' "$1" readonly sed cd then readonly -eu cd awk done "$@" awk awk
+	$(pwd) --verbose done test test /usr/bin then 'quoted text' &&
+grep sed local x=1 test | && then export local cd printf && grep /usr/bin
+	echo 'quoted text' readonly x=1 grep
+/usr/bin $(pwd) export
+awk "$1" readonly printf echo
+		'quoted text' awk | "$@" printf $(pwd) 'quoted text'
+	local grep $(pwd) grep "$1" --verbose
+local /usr/bin ${HOME}
+| | /usr/bin 2>/dev/null /usr/bin printf ${HOME} test x=1 export "$@"
+| ${HOME} local sed 'quoted text'
+		echo "$1" grep grep |
+readonly "$1" awk | then
+done && sed test $(pwd) x=1 local export printf printf grep grep
+	$(pwd) then export cd -eu done echo | cd echo
+		done | --verbose "$@" | export 2>/dev/null awk then grep sed
+		test done grep -eu cd | sed -eu /usr/bin && echo "$@" sed cd ${HOME} grep
+		echo printf "$@" 2>/dev/null local cd "$@" sed "$@" awk
+${HOME} echo awk /usr/bin local printf "$1" then --verbose
+		--verbose "$1" local 'quoted text' $(pwd) ${HOME} --verbose $(pwd) sed sed && &&
+&& --verbose "$1" /usr/bin 2>/dev/null | x=1 sed echo
+		${HOME} then printf awk
+		--verbose export printf awk export $(pwd) --verbose
+		printf test && 2>/dev/null
+	$(pwd) then printf cd "$@" echo x=1 x=1 ${HOME}
+		$(pwd) then x=1 readonly "$@" sed 'quoted text'
+		${HOME} "$1" -eu ${HOME} -eu then x=1 then "$1"
+		x=1 local 'quoted text' awk "$@" "$1" sed "$@" x=1 -eu | --verbose
+	/usr/bin ${HOME} /usr/bin
+cd cd ${HOME} test test --verbose $(pwd) -eu
+		$(pwd) done then "$@" | echo sed cd "$1" sed | -eu
+	$(pwd) cd test && -eu echo awk -eu 2>/dev/null ${HOME} sed 'quoted text' 'quoted text'
+${HOME} 2>/dev/null "$@" done -eu grep test 2>/dev/null cd ${HOME}
+awk cd local $(pwd) awk sed "$@" --verbose grep then
+then awk --verbose grep cd printf grep --verbose $(pwd) ${HOME} readonly
+	${HOME} local cd awk awk x=1 ${HOME} printf "$@" 'quoted text' "$@" && done /usr/bin
+	awk $(pwd) test then sed "$1" -eu grep export x=1 done
+$(pwd) --verbose && test export
+awk export --verbose echo x=1 ${HOME} readonly awk then
+readonly "$@" x=1 'quoted text' /usr/bin "$1" -eu done echo "$1" "$1" $(pwd)
+readonly | | sed readonly cd test printf readonly then cd "$1" printf done "$1"
+done "$@" local export $(pwd) 'quoted text' | x=1 export sed test readonly "$1"
+	${HOME} then local export grep awk && "$@" --verbose
+		done x=1 sed /usr/bin | | "$@" test --verbose sed then local echo
+	then | | "$@" 'quoted text' -eu && && 2>/dev/null ${HOME} sed awk 2>/dev/null
+	"$@" then -eu x=1 --verbose sed sed cd --verbose test printf awk local readonly
+		readonly x=1 "$@" | && done then "$1" export done 2>/dev/null "$1"
+	readonly cd 'quoted text' && readonly
+/usr/bin | $(pwd) ${HOME} local -eu
+	2>/dev/null readonly | "$@" && 'quoted text' 2>/dev/null test
+	export --verbose "$1" 2>/dev/null
+	printf /usr/bin | 2>/dev/null | 'quoted text' x=1 $(pwd) local then cd local &&
+	| done local ${HOME} 2>/dev/null grep then grep "$1" | "$@" --verbose $(pwd)
+		&& 'quoted text' then cd 2>/dev/null "$@" | cd export "$@" test printf 2>/dev/null
+		-eu test done awk done /usr/bin -eu 2>/dev/null
+	${HOME} "$1" "$@" local readonly x=1 printf cd "$@" awk local grep cd $(pwd)
+$(pwd) 2>/dev/null $(pwd) export printf | && "$@" grep grep --verbose
+readonly "$@" echo "$1"
+--verbose done awk printf x=1 2>/dev/null
+		test ${HOME} | x=1 cd 'quoted text' local
+-eu | awk "$@" ${HOME} readonly -eu 2>/dev/null | awk sed "$1"
+	"$@" test "$1" x=1 readonly
+	${HOME} --verbose grep && | local done then x=1 then $(pwd) | && export
+	grep | "$1" grep cd sed x=1 test test printf awk awk local
+		awk cd && awk done test --verbose done | awk test done
+"$@" test awk cd test x=1 awk export x=1 sed | grep 'quoted text'
+		local test then | 2>/dev/null export $(pwd) awk export
+export export awk x=1 then readonly
+done && grep local -eu x=1 --verbose "$1" $(pwd)
+echo --verbose --verbose $(pwd) export cd | --verbose
+	--verbose local cd /usr/bin grep "$@" "$1" grep
+	--verbose 'quoted text' local local
+		echo awk && export -eu 2>/dev/null echo && /usr/bin readonly printf grep done
+	x=1 local | cd test ${HOME} readonly printf
+	echo sed /usr/bin local printf x=1 export /usr/bin local sed
+		printf -eu | sed echo done then cd cd done "$1"
+grep test readonly $(pwd) readonly then cd | sed && | sed then
+	-eu 2>/dev/null test 'quoted text' then readonly
+/usr/bin sed cd readonly
+&& && /usr/bin awk --verbose /usr/bin "$@"
+echo 2>/dev/null -eu && 'quoted text' -eu $(pwd) local x=1 then
+	cd | cd | export export 'quoted text' then
+		| "$@" awk printf x=1 $(pwd) 'quoted text' 2>/dev/null
+	test awk grep x=1 printf export -eu then | grep done test ${HOME} $(pwd)
+x=1 "$@" -eu awk "$@" export ${HOME} then "$1" $(pwd) /usr/bin
+		local local readonly --verbose
+	| && --verbose -eu then sed 'quoted text' printf x=1 'quoted text' "$@" | -eu echo
+	'quoted text' | readonly awk 2>/dev/null | $(pwd) readonly test readonly done
+readonly "$@" local "$@" done /usr/bin /usr/bin printf sed then then
+done | 'quoted text' readonly awk
+		then export readonly | -eu && --verbose readonly
+	"$@" ${HOME} ${HOME} cd x=1 -eu done "$@" 'quoted text'
+x=1 export grep printf sed x=1 $(pwd)
+	readonly --verbose test &&
+echo ${HOME} "$1" done $(pwd) &&
+		-eu /usr/bin 'quoted text' awk "$1" local "$1" cd cd done done test 2>/dev/null
+export --verbose test then sed $(pwd) local -eu -eu ${HOME} readonly
+		2>/dev/null "$1" --verbose local readonly
+		| 2>/dev/null printf && test grep ${HOME} printf
+		cd ${HOME} | export | /usr/bin printf awk && && $(pwd) test -eu then
+'quoted text' 2>/dev/null export /usr/bin | && --verbose awk cd test
+2>/dev/null grep --verbose --verbose
+		--verbose x=1 "$@" cd export &&
+&& export "$1" printf readonly --verbose | readonly 'quoted text'
+sed echo ${HOME} ${HOME} /usr/bin --verbose | printf
+	--verbose sed "$1" "$1" local x=1 cd x=1 -eu ${HOME}
+sed /usr/bin 2>/dev/null done awk cd "$@" export /usr/bin
+		x=1 x=1 grep -eu local echo /usr/bin "$@" $(pwd) 2>/dev/null
+done /usr/bin -eu "$1" --verbose done /usr/bin then
+sed x=1 -eu && readonly sed "$1" 2>/dev/null
+	-eu -eu export ${HOME} local readonly $(pwd) cd test export
+	'quoted text' test sed export then local ${HOME} 2>/dev/null
+		printf printf 2>/dev/null grep "$1" | printf x=1 grep export
+		printf sed 'quoted text' ${HOME} cd awk test readonly readonly "$1"
+then 2>/dev/null --verbose $(pwd) sed -eu ${HOME} --verbose local 'quoted text'
+		--verbose --verbose grep local /usr/bin && sed done | echo awk --verbose
+${HOME} awk "$@" "$@" done then cd 'quoted text' sed $(pwd) echo done
+"$1" "$1" awk readonly 2>/dev/null echo done cd "$1" awk | local /usr/bin
+test test /usr/bin then then -eu then echo "$@" done /usr/bin sed "$@"
+'quoted text' printf 'quoted text'
+	'quoted text' 'quoted text' --verbose awk cd /usr/bin x=1 printf ${HOME}
+${HOME} x=1 printf echo "$1" | -eu 'quoted text' echo
+"$@" -eu cd readonly ${HOME} done printf
+test sed /usr/bin printf
+x=1 printf export local /usr/bin readonly ${HOME} echo $(pwd)
+		/usr/bin echo readonly echo local "$@" | then && sed ${HOME}
+	awk "$1" sed printf readonly --verbose
+		echo /usr/bin 2>/dev/null -eu sed x=1 $(pwd) "$1"
+cd grep awk "$1" then printf printf "$@" echo readonly -eu "$@" /usr/bin
+		"$@" | echo readonly sed 2>/dev/null local --verbose
+		-eu ${HOME} x=1 /usr/bin -eu readonly cd export cd "$@" --verbose
+	readonly ${HOME} cd awk 2>/dev/null
+echo done cd --verbose local grep echo cd
+		'quoted text' | $(pwd) echo "$1" /usr/bin export grep grep sed 'quoted text'
+	readonly x=1 sed "$1" --verbose
+done echo awk /usr/bin --verbose readonly "$1" 'quoted text' -eu ${HOME}
+	'quoted text' grep readonly grep && grep readonly awk "$1"
+| sed awk local awk test 2>/dev/null $(pwd) 2>/dev/null cd cd printf
+		cd | x=1 x=1 'quoted text' ${HOME}
+		"$1" done 2>/dev/null awk done awk ${HOME} /usr/bin test
+	then echo sed export echo
+export sed --verbose
+		local | printf 'quoted text' printf $(pwd) "$@"
+"$@" readonly "$1" test && printf
+		sed local printf awk --verbose x=1 printf 2>/dev/null
+	x=1 printf | echo grep sed /usr/bin x=1
+	export done 2>/dev/null && grep $(pwd) grep $(pwd) echo export printf
+	| done export $(pwd) 2>/dev/null "$1" /usr/bin sed grep echo grep
+-eu | readonly 'quoted text' "$1" then awk echo export
+printf $(pwd) "$1" cd "$@" done
+	printf readonly $(pwd) x=1 printf ${HOME} /usr/bin
+done export ${HOME} && export && readonly
+"$@" awk /usr/bin x=1 local
+local -eu $(pwd) echo -eu "$1"
+		test test --verbose local "$1" printf local export 'quoted text'
+local -eu awk 'quoted text' then local test /usr/bin awk awk ${HOME}
+		&& awk 'quoted text' test printf "$1" test 2>/dev/null then /usr/bin
+		"$@" "$@" cd grep awk awk "$@" $(pwd) ${HOME} readonly -eu 2>/dev/null
+echo -eu /usr/bin | done readonly /usr/bin readonly
+		cd "$1" -eu readonly local "$@" $(pwd) x=1 then grep "$1" local cd
+2>/dev/null 'quoted text' awk
+	then sed -eu grep $(pwd) --verbose
+/usr/bin awk 2>/dev/null done echo ${HOME} 'quoted text' local cd export
+		export echo grep -eu awk local printf done "$@" "$1"
+	-eu readonly cd "$1" awk awk
+2>/dev/null sed 'quoted text' sed done "$@" printf ${HOME} sed test "$1" cd 'quoted text'
+		${HOME} done export /usr/bin
+		test "$1" then local export local /usr/bin local export
+sed echo ${HOME} grep ${HOME} x=1 echo | $(pwd) -eu grep
+	echo /usr/bin printf --verbose
+printf x=1 -eu $(pwd) 2>/dev/null /usr/bin
+readonly | done ${HOME} "$@" test /usr/bin -eu grep then /usr/bin grep printf
+'quoted text' done sed 'quoted text' -eu /usr/bin local ${HOME} && "$@" 'quoted text'
+		$(pwd) echo ${HOME} grep 2>/dev/null && sed 'quoted text'
+	/usr/bin x=1 x=1 done test x=1 'quoted text' export --verbose
+	"$@" done test done "$1" /usr/bin sed $(pwd) export done grep awk test ${HOME}
+then | ${HOME} then 'quoted text' printf 2>/dev/null
+		2>/dev/null /usr/bin local test awk printf done 'quoted text' printf
+		--verbose cd x=1 --verbose 2>/dev/null grep printf readonly 'quoted text'
+		$(pwd) ${HOME} readonly
+cd export readonly done awk x=1 "$@" 2>/dev/null sed cd local x=1
+/usr/bin ${HOME} grep printf local | -eu "$@" then grep x=1
+| awk "$1" grep -eu echo export 'quoted text' export --verbose && && grep
+	2>/dev/null test grep "$@"
+awk then 'quoted text' awk test local $(pwd)
+	echo local x=1 "$@" $(pwd) readonly
+echo "$@" done test "$@" -eu local then "$1" 2>/dev/null -eu printf --verbose &&
+--verbose 'quoted text' echo awk awk ${HOME} "$@" local printf "$1" awk ${HOME}
+		then printf "$@" --verbose cd test
+	done then local "$@" -eu test 'quoted text' grep sed -eu "$1" local "$@"
+		-eu ${HOME} | x=1 'quoted text' export "$1"
+	x=1 --verbose $(pwd) | cd "$@" "$@" done test && && "$1" "$@" | x=1 echo /usr/bin
+2>/dev/null 2>/dev/null then grep echo cd sed "$1" then ${HOME} sed && grep echo
+	2>/dev/null -eu readonly then 'quoted text' readonly -eu ${HOME} echo -eu $(pwd)
+		| | done "$@" cd 2>/dev/null
+		"$1" echo grep "$@" awk printf sed /usr/bin /usr/bin $(pwd)
+${HOME} 'quoted text' | local && readonly done done | $(pwd) sed "$1" test 'quoted text'
+		/usr/bin then printf ${HOME} 2>/dev/null
+	readonly ${HOME} /usr/bin printf done sed printf printf test 'quoted text'
+	&& export local "$@" test "$@" -eu export printf
+	'quoted text' awk | /usr/bin
+cd echo test test 2>/dev/null awk done
+'quoted text' /usr/bin then -eu echo printf then cd sed
+	printf ${HOME} /usr/bin --verbose done
+		export $(pwd) $(pwd) local $(pwd) grep /usr/bin | echo ${HOME} sed awk export
+	export ${HOME} 'quoted text' then -eu cd awk "$1"
+	readonly grep test ${HOME} sed
+		then | echo /usr/bin --verbose cd then sed 'quoted text'
+		"$@" --verbose test printf export
+export test echo cd x=1 2>/dev/null test
+		local echo x=1 -eu && "$@" "$@" then "$@" "$1" then
+		grep "$1" grep then done
+		2>/dev/null $(pwd) && -eu | $(pwd) then |
+echo ${HOME} local --verbose --verbose
+&& ${HOME} -eu cd test grep local awk local -eu "$@" ${HOME} echo test -eu
+	"$@" awk ${HOME} awk $(pwd) printf test 2>/dev/null
+grep $(pwd) cd cd | awk -eu
+		"$1" readonly 2>/dev/null
+	/usr/bin $(pwd) /usr/bin ${HOME} local && echo then -eu readonly
+sed echo export readonly --verbose echo printf 'quoted text' $(pwd)
+	awk test --verbose -eu 2>/dev/null
+		-eu export done "$1" x=1 grep local $(pwd) export echo then done -eu test /usr/bin
+		--verbose sed test then echo cd grep --verbose ${HOME} 2>/dev/null
+		-eu done local done readonly
+"$@" done cd "$@" done sed then
+		export --verbose 2>/dev/null grep | 2>/dev/null "$@" 2>/dev/null
+${HOME} export cd awk /usr/bin ${HOME} done /usr/bin
+&& test "$@" | /usr/bin $(pwd) done $(pwd) -eu awk done
+		$(pwd) -eu "$1" local "$1" echo x=1 && x=1 ${HOME} done 'quoted text'
+$(pwd) | readonly 'quoted text' 2>/dev/null $(pwd) && $(pwd)
+2>/dev/null | cd "$@" sed "$@" --verbose | awk grep test "$1" done
+awk $(pwd) test ${HOME} export cd done $(pwd) $(pwd) export then awk sed cd
+		echo --verbose sed && test --verbose grep 2>/dev/null printf -eu grep
+-eu "$1" x=1 && --verbose
+		| awk local -eu 2>/dev/null "$@" 2>/dev/null echo then printf
+	| /usr/bin "$@" cd "$1" 'quoted text' --verbose
+	cd echo | "$@" 'quoted text' export sed done x=1 && "$1" local local
+	cd done test done --verbose 'quoted text' /usr/bin
+	test awk --verbose x=1 printf --verbose && export awk && grep local grep /usr/bin
+awk /usr/bin && local grep printf done /usr/bin $(pwd) awk "$@"
+	readonly then awk $(pwd) && 2>/dev/null grep "$@" printf sed 'quoted text' -eu
+	"$1" test awk readonly test done sed "$@" x=1
+printf 2>/dev/null "$1" -eu then "$@"
+2>/dev/null local $(pwd) --verbose
+| export cd "$1" $(pwd) echo && -eu ${HOME} export
+		grep | && x=1 "$1" -eu readonly
+		done x=1 2>/dev/null test $(pwd) awk test test local then then cd
+		-eu printf printf echo readonly awk then local 2>/dev/null then echo "$1" cd
+then cd && sed && readonly x=1
+		test sed x=1 export 'quoted text' readonly 2>/dev/null 'quoted text'
+	sed sed echo echo test awk grep sed x=1 "$1" cd
+readonly grep 2>/dev/null done printf "$1" test /usr/bin x=1 cd test |
+		"$@" awk test | x=1 "$@" && $(pwd) "$1" done --verbose --verbose &&
+x=1 cd "$1" "$1" readonly
+	--verbose then /usr/bin --verbose
+	echo cd cd grep ${HOME} grep 'quoted text'
+local test /usr/bin --verbose readonly "$1" /usr/bin echo -eu
+done --verbose export && /usr/bin x=1 x=1 /usr/bin grep
+done sed /usr/bin "$@" printf grep export awk grep cd echo
+		readonly done $(pwd) "$1" then grep
+		--verbose --verbose printf | local readonly test 2>/dev/null then
+		${HOME} 'quoted text' done ${HOME} done "$1" $(pwd)
+		awk 2>/dev/null sed /usr/bin
+		local printf done echo --verbose "$@" then
+	done awk 2>/dev/null --verbose readonly
+export "$1" then printf 2>/dev/null echo
+$(pwd) printf local printf awk $(pwd) echo 2>/dev/null && | awk $(pwd) ${HOME}
+	-eu done cd /usr/bin
+		-eu --verbose 'quoted text' printf x=1 echo "$1" test echo ${HOME}
+then export test readonly grep printf then readonly "$@" grep printf test | printf
+"$1" 'quoted text' then local then ${HOME} | | "$1" echo ${HOME}
+		"$@" printf && -eu printf local grep local export export
+	test test sed sed $(pwd)
+	${HOME} --verbose && then "$1" | && x=1 readonly readonly
+		cd readonly export | local ${HOME} export $(pwd) awk --verbose readonly
+awk && 2>/dev/null 2>/dev/null
+	then test -eu -eu echo grep grep && "$1" readonly printf
+		test "$1" local 2>/dev/null ${HOME} --verbose cd then | 'quoted text' readonly
+	'quoted text' "$1" 'quoted text' x=1 grep local grep | x=1 cd 2>/dev/null
+	$(pwd) 2>/dev/null awk --verbose awk
+		x=1 x=1 readonly 'quoted text' test test local 'quoted text' export sed -eu export
+		| echo /usr/bin /usr/bin x=1 printf
+	cd done ${HOME} awk awk readonly $(pwd) $(pwd)
+echo 2>/dev/null | $(pwd) then "$1" printf sed test
+	| 2>/dev/null then |
+		x=1 && then done grep 'quoted text'
+	'quoted text' done cd 2>/dev/null -eu test x=1 $(pwd) /usr/bin x=1 "$@"
+	--verbose sed cd 2>/dev/null 'quoted text' cd x=1 2>/dev/null done readonly
+local | && cd cd test -eu 'quoted text' done sed readonly cd
+		awk local /usr/bin -eu printf --verbose test 'quoted text' && $(pwd) 'quoted text'
+printf grep x=1 readonly export "$1" 'quoted text' 2>/dev/null
+grep done cd && --verbose local then awk readonly readonly
+$(pwd) | awk /usr/bin /usr/bin cd /usr/bin
+	2>/dev/null then cd then 'quoted text' local "$@" local cd cd
+-eu -eu /usr/bin then /usr/bin /usr/bin x=1 x=1 done | ${HOME} grep local
+		--verbose --verbose -eu cd
+		-eu export "$1" 2>/dev/null printf && -eu ${HOME} sed --verbose "$1"
+2>/dev/null "$1" /usr/bin test then test && "$1" echo | test printf "$@"
+	"$1" readonly "$1" readonly | --verbose echo 'quoted text'
+		echo "$@" awk echo echo printf cd 2>/dev/null
+$(pwd) readonly cd 'quoted text' done sed export echo
+done export 2>/dev/null /usr/bin echo done ${HOME}
+--verbose cd export cd done grep readonly echo export "$1" grep ${HOME}
+		| | ${HOME} 2>/dev/null grep then sed /usr/bin x=1 done ${HOME} | 2>/dev/null
+readonly "$@" -eu then local && /usr/bin
+${HOME} "$1" x=1 done | --verbose ${HOME} -eu --verbose 2>/dev/null
+	${HOME} grep 'quoted text'
+		awk "$1" local readonly "$@"
+"$@" x=1 grep "$@" | --verbose
+		&& && 2>/dev/null $(pwd) /usr/bin x=1 then "$@" --verbose ${HOME}
+	${HOME} local printf readonly --verbose readonly export x=1 sed -eu cd
+	done sed local readonly && echo sed cd local && local /usr/bin /usr/bin
+		readonly x=1 "$1" export grep cd /usr/bin
+readonly export test "$1"
+	local echo then /usr/bin test x=1 grep /usr/bin
+		sed 'quoted text' $(pwd)
+| printf done done $(pwd)
+	"$@" ${HOME} readonly
+		'quoted text' export grep && sed
+	done done && ${HOME} 'quoted text'
+		export printf then 2>/dev/null ${HOME} readonly |
+local cd readonly printf && grep
+	then cd test export awk
+"$1" readonly sed cd "$@" /usr/bin ${HOME} sed local then
+		awk grep "$@" echo 'quoted text' cd cd done export
+sed test sed && && "$@" $(pwd) cd 2>/dev/null --verbose
+awk printf sed awk 'quoted text'
+then x=1 $(pwd) ${HOME}
+	&& -eu 2>/dev/null local | done sed sed local readonly done
+export 2>/dev/null -eu awk
+awk -eu 'quoted text' test --verbose sed /usr/bin
+cd then "$@" sed $(pwd)
+		'quoted text' --verbose $(pwd) 2>/dev/null --verbose grep | readonly awk
+--verbose /usr/bin 'quoted text' 2>/dev/null
+$(pwd) "$@" done then && readonly -eu printf export x=1 "$@" "$@" /usr/bin local
+	${HOME} done 'quoted text'
+	awk "$@" ${HOME} x=1 /usr/bin 2>/dev/null
+	then awk $(pwd) ${HOME} grep | cd sed sed export awk "$@" grep
+-eu sed "$1" then -eu --verbose
+		echo 2>/dev/null readonly awk -eu /usr/bin -eu 'quoted text' "$1" 2>/dev/null
+	printf x=1 sed grep "$@" | done $(pwd) export grep 'quoted text'
+awk "$@" && --verbose export grep then
+	&& "$1" ${HOME} test 'quoted text' && readonly done $(pwd)
+readonly --verbose cd 'quoted text' 'quoted text' awk echo
+		'quoted text' local awk 2>/dev/null
+${HOME} x=1 'quoted text'
+	"$1" awk cd then test sed done then test printf -eu readonly
+printf "$1" 2>/dev/null -eu printf export /usr/bin
+	"$@" "$1" readonly x=1 readonly
+| cd then grep "$1" then $(pwd) cd sed ${HOME} readonly
+'quoted text' 'quoted text' then -eu printf && $(pwd) local export x=1
+		/usr/bin | readonly grep awk echo cd awk grep
+	sed | done done awk printf test done local
+		x=1 --verbose $(pwd) --verbose 2>/dev/null done echo then test | done
+		x=1 $(pwd) grep printf x=1 awk printf
+	-eu 2>/dev/null "$1" echo && echo awk ${HOME}
+grep readonly done awk && 'quoted text' "$1" done local local $(pwd)
+"$@" cd readonly echo && "$@" "$@" test sed ${HOME} cd 'quoted text'
+	test awk "$@" awk awk --verbose
+	export && -eu export 2>/dev/null sed done x=1
+readonly awk --verbose export && ${HOME}
+/usr/bin "$1" x=1 awk export
+	/usr/bin local x=1 ${HOME} ${HOME}
+	echo --verbose test -eu sed awk x=1 grep && $(pwd) export printf
+	awk local done "$1" $(pwd) ${HOME} "$@" --verbose
+	${HOME} x=1 && x=1 readonly -eu test done done sed "$1" grep local
+| awk | done /usr/bin --verbose test /usr/bin grep cd "$1" "$@" $(pwd) ${HOME}
+		printf /usr/bin "$@" /usr/bin --verbose
+	"$@" x=1 grep 2>/dev/null echo grep --verbose local done "$@" | test x=1 readonly
+--verbose readonly grep ${HOME} then 'quoted text' echo
+		'quoted text' readonly ${HOME} -eu 'quoted text' readonly x=1 grep readonly
+local cd && test && export then ${HOME} x=1 /usr/bin
+	echo -eu sed && grep printf | "$@" test
+	awk 2>/dev/null done sed -eu $(pwd)
+		awk echo "$1" $(pwd) grep ${HOME} -eu --verbose /usr/bin cd x=1 readonly x=1
+		sed $(pwd) /usr/bin awk export
+	'quoted text' 'quoted text' && done
+	export grep /usr/bin |
+		$(pwd) && -eu "$@" grep "$1"
+		echo -eu grep /usr/bin $(pwd) cd echo printf "$@"
+		| sed readonly --verbose local "$1" cd && done
+		awk | printf ${HOME} sed then x=1 awk --verbose 'quoted text'
+		${HOME} test $(pwd) $(pwd) grep
+printf local printf x=1 ${HOME} "$@" 'quoted text' --verbose
+	done test done $(pwd) && 'quoted text' done
+	sed local 'quoted text' then then sed "$@"
+	'quoted text' --verbose 'quoted text' grep local printf
+		then ${HOME} $(pwd) sed --verbose 'quoted text' /usr/bin awk "$1" 'quoted text'
+	then grep printf "$1" "$@" printf test ${HOME} grep && "$1" sed
+sed -eu /usr/bin readonly test -eu $(pwd) |
+		sed 'quoted text' printf $(pwd) "$1"
+	echo sed /usr/bin 'quoted text' awk
+		echo 'quoted text' local export | then cd --verbose done -eu export export
+grep "$@" /usr/bin printf -eu printf sed 'quoted text'
+	echo test local then then grep --verbose ${HOME} done ${HOME} x=1 export "$@" then
+		echo --verbose $(pwd) local -eu 'quoted text' then -eu 2>/dev/null &&
+"$1" printf 2>/dev/null --verbose grep sed "$@" grep local --verbose done | --verbose
+	"$@" --verbose export printf
+		local 2>/dev/null "$@" x=1
+test cd ${HOME} $(pwd) 2>/dev/null && && /usr/bin
+	sed -eu | && 2>/dev/null readonly
+		done 'quoted text' grep "$1" cd export
+		${HOME} && test cd done test &&
+"$1" -eu sed /usr/bin x=1 "$1" test cd then /usr/bin ${HOME} "$@" $(pwd)
+x=1 | -eu "$@" x=1 -eu echo --verbose | cd local test x=1 then
+		2>/dev/null printf test awk "$@" && | | "$@" awk
+| readonly done then -eu local then grep --verbose --verbose -eu printf
+		${HOME} 2>/dev/null ${HOME} "$1" echo done 'quoted text' local
+	"$@" readonly printf done
+grep test -eu x=1 x=1 test --verbose -eu readonly -eu -eu local /usr/bin
+	export | then done local local 'quoted text'
+		cd awk /usr/bin 2>/dev/null local cd readonly /usr/bin
+	printf readonly ${HOME} awk test test "$@" -eu -eu export export $(pwd)
+'quoted text' local | && printf local export grep
+${HOME} 2>/dev/null export 2>/dev/null x=1 cd && then /usr/bin sed $(pwd) export
+		echo test sed local $(pwd) local
+		--verbose readonly sed printf cd $(pwd) then ${HOME} && /usr/bin cd awk echo done
+${HOME} | done 'quoted text' test grep 'quoted text'
+	sed 'quoted text' ${HOME}
+		${HOME} | | 'quoted text' test 'quoted text' x=1 awk
+	local done cd readonly export /usr/bin ${HOME} cd ${HOME} 'quoted text' "$1"
+	${HOME} "$@" 'quoted text' && export export done && 'quoted text' 2>/dev/null
+		--verbose readonly "$1" readonly readonly | 'quoted text' 2>/dev/null
+done cd /usr/bin cd export sed echo "$@" export "$@" -eu && grep |
+	--verbose sed "$1" readonly done
+$(pwd) ${HOME} $(pwd) $(pwd) printf
+cd then "$@" cd /usr/bin awk sed readonly
+export "$1" readonly local $(pwd) printf
+	"$1" | -eu -eu printf ${HOME} echo awk
+		"$@" 'quoted text' done cd awk
+		grep awk x=1 then 2>/dev/null
+cd 2>/dev/null /usr/bin
+$(pwd) sed "$1" x=1 awk && echo | --verbose "$@" printf
+	"$1" | printf grep done
+		"$@" echo grep printf $(pwd) ${HOME} 'quoted text'
+$(pwd) && then test 2>/dev/null sed test $(pwd) 2>/dev/null /usr/bin grep
+		cd ${HOME} 2>/dev/null readonly export
+x=1 test && 2>/dev/null test readonly printf done then 'quoted text'
+		&& -eu echo done "$1" export 2>/dev/null test sed
+	local sed local 'quoted text' &&
+	awk /usr/bin /usr/bin "$1" x=1 --verbose -eu
+grep test -eu 2>/dev/null
+		$(pwd) "$1" awk local ${HOME} cd printf --verbose echo
+		${HOME} local ${HOME} x=1 x=1 awk export test "$1" grep "$@" grep
+	'quoted text' export awk "$@" readonly then local
+	done readonly grep local "$1" && echo | /usr/bin
+		"$1" echo printf && |
+'quoted text' printf sed && 2>/dev/null then ${HOME}
+		readonly && "$@" done -eu cd export /usr/bin
+		grep 2>/dev/null $(pwd) awk grep test grep | 2>/dev/null --verbose sed
+		-eu 'quoted text' local grep echo x=1 awk | -eu 'quoted text'
+cd awk readonly -eu ${HOME} cd $(pwd) printf /usr/bin grep grep done
+	-eu cd 2>/dev/null --verbose export sed done x=1 done echo 2>/dev/null
+		echo --verbose 'quoted text' "$@" printf && && && && | ${HOME}
+		${HOME} 2>/dev/null "$@" sed
+	-eu 2>/dev/null cd sed -eu /usr/bin awk echo /usr/bin
+		"$1" --verbose && then local done "$@" local --verbose grep done
+	grep x=1 test echo then "$1" | grep | && done /usr/bin sed
+readonly /usr/bin --verbose done echo x=1 test "$@" x=1 sed cd "$1" /usr/bin
+		&& local $(pwd) 2>/dev/null ${HOME} sed
+		$(pwd) cd readonly $(pwd) awk local 2>/dev/null printf grep test -eu then "$1"
+	x=1 "$1" export -eu && echo x=1 then -eu -eu printf
+		$(pwd) 'quoted text' "$@" | x=1 test
+	echo test cd /usr/bin printf sed awk $(pwd) /usr/bin test -eu x=1 cd echo
+		$(pwd) done then "$1" local --verbose sed local "$1" readonly local
+	then local | export 2>/dev/null --verbose
+		'quoted text' x=1 export "$@" cd
+test printf -eu 2>/dev/null 2>/dev/null ${HOME} | 'quoted text' sed
+readonly cd printf echo --verbose export 2>/dev/null test "$1"
+$(pwd) x=1 awk && done readonly sed sed --verbose x=1
+		-eu $(pwd) -eu "$@" echo echo printf x=1 "$1"
+	awk grep 2>/dev/null | test awk test awk test
+		"$@" then /usr/bin done test done
+	readonly sed "$@" "$1" --verbose cd sed export printf 2>/dev/null
+	local export echo 2>/dev/null echo 'quoted text'
+	grep 2>/dev/null readonly 2>/dev/null -eu && $(pwd) && ${HOME}
+printf "$1" && -eu awk echo /usr/bin
+		export && ${HOME} 2>/dev/null printf cd "$1" "$@" 2>/dev/null
+		2>/dev/null export awk $(pwd)
+| test $(pwd) done --verbose
+	awk done x=1 --verbose x=1 x=1 local
+		2>/dev/null sed cd readonly "$@" "$@" --verbose
+2>/dev/null export /usr/bin
+		${HOME} --verbose /usr/bin readonly -eu awk test then awk
+done ${HOME} echo sed then cd export && 'quoted text' -eu /usr/bin /usr/bin printf
+	"$1" 2>/dev/null 2>/dev/null 'quoted text' "$@" | sed
+	then $(pwd) readonly then cd printf | awk 2>/dev/null sed
+	&& cd export "$1" export && done cd awk then 2>/dev/null /usr/bin local sed
+grep sed done x=1 "$1" printf done
+'quoted text' 'quoted text' local sed
+	export done -eu -eu "$@" then && -eu --verbose done awk && test
+	"$1" "$1" test 2>/dev/null 2>/dev/null export done echo
+		"$@" test ${HOME} -eu $(pwd) test
+'quoted text' $(pwd) "$1"
+	/usr/bin && done test printf "$1" /usr/bin export $(pwd) && grep /usr/bin 'quoted text'
+	echo local 'quoted text' && /usr/bin $(pwd) -eu export echo 2>/dev/null
+2>/dev/null /usr/bin test -eu grep /usr/bin $(pwd) test
+		printf "$1" && | "$@" done export "$1" "$1" readonly export readonly && test &&
+	printf echo awk printf sed && awk readonly 'quoted text' "$@"
+	&& cd echo awk -eu ${HOME} --verbose /usr/bin "$1" -eu ${HOME}
+	x=1 $(pwd) then sed | export grep local export --verbose && && | --verbose
+		'quoted text' "$1" 'quoted text' x=1 2>/dev/null sed && awk awk x=1 printf done
+		echo echo test $(pwd) awk readonly sed local awk done awk cd
+awk local export -eu grep
+		done 'quoted text' 2>/dev/null awk awk "$1"
+		"$1" readonly then done test awk
+2>/dev/null "$1" $(pwd) -eu export 2>/dev/null
+&& x=1 'quoted text' 'quoted text' --verbose done grep x=1 $(pwd) echo printf
+		cd | readonly cd x=1 grep test then
+		local "$@" x=1 cd test
+echo test printf && $(pwd) ${HOME} --verbose -eu export
+		x=1 -eu 2>/dev/null 2>/dev/null --verbose local
+then local "$1" ${HOME} --verbose -eu cd done && --verbose 'quoted text'
+	awk echo x=1 awk local
+	-eu echo "$@" local printf sed done echo 'quoted text' x=1 "$1"
+	export $(pwd) done /usr/bin ${HOME} && -eu awk
+'quoted text' grep echo "$1" 'quoted text'
+x=1 "$@" 2>/dev/null awk /usr/bin test ${HOME} | echo -eu && echo x=1 x=1 x=1
+	export $(pwd) export x=1 grep && awk readonly
+2>/dev/null export "$@" | local grep test export printf sed ${HOME} -eu sed
+	"$@" echo grep cd | cd 'quoted text' readonly ${HOME} test grep
+	local -eu awk --verbose x=1 readonly cd --verbose x=1 'quoted text' 2>/dev/null
+	then export printf 2>/dev/null && "$@" | grep /usr/bin done cd export echo "$1"
+	"$1" 2>/dev/null $(pwd) --verbose echo cd $(pwd) && grep awk grep done done cd
+	"$1" then "$1" $(pwd) ${HOME} | then printf "$1" export x=1 then done "$@"
+2>/dev/null export then 'quoted text' sed export then cd "$1" "$1" 'quoted text'
+2>/dev/null echo awk "$1" ${HOME} --verbose echo "$1" printf x=1 sed
+"$1" export grep | grep awk "$1" readonly && "$1" "$@"
+	"$@" --verbose readonly printf ${HOME}
+	2>/dev/null 2>/dev/null done 'quoted text' /usr/bin | sed "$@" grep "$@"
+echo --verbose "$1" 'quoted text' | export test "$@" ${HOME} test
+		"$1" echo $(pwd) "$@" | "$1" x=1 export printf x=1 then
+	export -eu $(pwd) printf 'quoted text' ${HOME} then readonly
+done awk done done echo x=1 sed && grep -eu then then -eu
+	| "$1" --verbose "$1" "$@" "$1" ${HOME} -eu sed | 2>/dev/null done test
+awk then x=1 readonly echo "$@" $(pwd) printf
+	2>/dev/null --verbose done x=1 && "$1" -eu sed /usr/bin
+		export sed done $(pwd) $(pwd) 'quoted text' $(pwd) echo ${HOME} 'quoted text'
+	"$@" sed done export export
+		test "$@" cd readonly readonly | 'quoted text' 2>/dev/null
+/usr/bin $(pwd) 'quoted text' printf echo 2>/dev/null cd sed done cd "$1"
+		echo 2>/dev/null --verbose
+grep -eu done -eu "$1" --verbose
+	2>/dev/null && ${HOME} cd local
+		done readonly | readonly test "$1" --verbose printf
+	/usr/bin 'quoted text' test
+echo sed echo test "$@" -eu
+		| $(pwd) local echo ${HOME}
+	"$1" cd -eu 'quoted text' x=1 --verbose
+| sed echo -eu && "$1" readonly ${HOME} sed test done 2>/dev/null
+| cd done echo sed export then awk local x=1 "$@" | test "$@" grep
+readonly ${HOME} | printf readonly /usr/bin cd echo test 2>/dev/null
+${HOME} -eu 2>/dev/null ${HOME} && x=1 x=1 -eu ${HOME} $(pwd)
+		'quoted text' readonly sed | | test local
+then -eu cd ${HOME} grep -eu test ${HOME} awk $(pwd) export
+	export "$@" "$@" readonly "$@" echo ${HOME} 2>/dev/null printf
+'quoted text' /usr/bin -eu printf 'quoted text' ${HOME}
+	sed printf x=1 done "$@" $(pwd)
+/usr/bin done cd ${HOME} 'quoted text' done ${HOME} sed x=1 $(pwd)
+cd sed sed sed 'quoted text' /usr/bin --verbose then local -eu cd readonly
+	"$1" 2>/dev/null "$@" x=1 done 'quoted text' | 'quoted text' printf echo
+		then && -eu local grep readonly printf cd x=1 printf readonly test echo done
+	'quoted text' x=1 then then grep local ${HOME} 'quoted text'
+		-eu printf x=1 test 2>/dev/null awk "$1" done cd --verbose
+		echo test sed grep grep sed /usr/bin local $(pwd) x=1 grep 2>/dev/null
+		${HOME} test /usr/bin export readonly x=1 done readonly cd | $(pwd) sed
+		export --verbose then --verbose $(pwd) then "$1" ${HOME} test 'quoted text'
+	/usr/bin 'quoted text' readonly printf sed x=1 -eu awk "$1" 'quoted text'
+awk readonly export "$1" | 2>/dev/null
+'quoted text' /usr/bin "$@" && ${HOME}
+		done "$1" && local printf && "$@" && echo test /usr/bin echo --verbose | --verbose
+export 'quoted text' && grep
+	readonly done grep test x=1 --verbose -eu local
+	echo printf 'quoted text' ${HOME} -eu test sed $(pwd) local awk
+readonly sed sed /usr/bin && readonly x=1
+	&& x=1 && && echo 2>/dev/null
+		local readonly then sed "$@"
+	/usr/bin /usr/bin 'quoted text'
+		| --verbose x=1 $(pwd) then export export test grep ${HOME} --verbose
+grep done sed echo echo cd
+	echo $(pwd) $(pwd) sed awk 2>/dev/null "$@" --verbose
+		2>/dev/null x=1 test 'quoted text' export printf test test --verbose
+done grep then x=1 "$1" printf awk done 'quoted text'
+		local ${HOME} sed cd then 'quoted text' --verbose
+	x=1 x=1 $(pwd) grep /usr/bin export done
+	export -eu printf 2>/dev/null export readonly /usr/bin export /usr/bin
+printf && "$1" x=1 export 2>/dev/null $(pwd) "$1" grep printf readonly
+		-eu sed local && readonly
+| test -eu /usr/bin cd 'quoted text' test 'quoted text'
+	readonly printf x=1 local test grep "$@" ${HOME} 'quoted text' test cd grep
+${HOME} $(pwd) ${HOME} 2>/dev/null printf readonly
+--verbose --verbose sed grep "$@" cd /usr/bin && --verbose grep 2>/dev/null /usr/bin
+		echo done export then export "$@" cd cd ${HOME} /usr/bin export printf
+local /usr/bin printf 'quoted text' "$@" 'quoted text' "$1"
+&& printf && $(pwd) /usr/bin sed 'quoted text'
+local then /usr/bin 2>/dev/null
+		local "$@" -eu grep --verbose export awk sed --verbose done 2>/dev/null /usr/bin
+		then ${HOME} grep "$1" 'quoted text'
+"$@" grep cd then /usr/bin 'quoted text' -eu then cd --verbose
+	cd /usr/bin /usr/bin grep 2>/dev/null 2>/dev/null printf done done "$@" readonly
+		"$1" --verbose /usr/bin readonly readonly readonly x=1 && awk --verbose x=1 /usr/bin
+2>/dev/null readonly sed 2>/dev/null
+		"$1" then grep $(pwd) 'quoted text' grep
+2>/dev/null --verbose 2>/dev/null cd --verbose
+	--verbose test x=1 echo ${HOME} 2>/dev/null local
+		cd echo $(pwd) --verbose
+echo ${HOME} cd 'quoted text'
+grep echo x=1 x=1 cd readonly && -eu printf $(pwd) 'quoted text' 2>/dev/null |
+		local /usr/bin --verbose /usr/bin
+		$(pwd) awk test test x=1 local readonly then $(pwd)
+	-eu done | test then 2>/dev/null $(pwd) && /usr/bin
+		test sed awk && "$@" $(pwd) awk printf 'quoted text' readonly
+-eu local -eu | 2>/dev/null echo --verbose $(pwd)
+	-eu echo 'quoted text' grep echo 2>/dev/null export test cd awk cd -eu done
+printf /usr/bin test -eu
+	sed "$@" "$1" cd /usr/bin sed 2>/dev/null cd readonly printf printf
+	then export sed printf grep test printf "$1" && sed 2>/dev/null -eu 'quoted text'
+	/usr/bin "$1" cd 'quoted text' awk && grep $(pwd)
+printf grep && "$1" echo then $(pwd) 2>/dev/null -eu local $(pwd) cd
+	echo sed readonly printf -eu --verbose 2>/dev/null readonly
+		${HOME} echo export 'quoted text' test echo printf then
+		printf && "$@" -eu local test printf
+	&& ${HOME} export grep $(pwd) "$1" grep readonly
+'quoted text' ${HOME} export test awk 2>/dev/null 'quoted text'
+	--verbose local x=1 && grep
+	2>/dev/null "$@" sed 2>/dev/null 2>/dev/null printf awk printf /usr/bin sed /usr/bin
+		test awk readonly | cd 'quoted text' awk 'quoted text' then
+-eu export local 2>/dev/null
+local ${HOME} x=1 printf && && done ${HOME} --verbose
+	readonly cd --verbose --verbose local && $(pwd) then /usr/bin ${HOME}
+		sed sed -eu readonly 2>/dev/null ${HOME} echo readonly "$1" 'quoted text'
+	--verbose grep export done grep ${HOME} -eu echo local
+		"$@" export printf -eu awk readonly | 2>/dev/null
+	$(pwd) ${HOME} --verbose readonly grep ${HOME} test sed && --verbose "$@"
+export printf awk $(pwd)
+		$(pwd) ${HOME} echo grep test "$1" $(pwd) ${HOME} ${HOME} | export
+	&& grep printf /usr/bin local x=1 /usr/bin | 'quoted text'
+		awk test awk ${HOME} local done awk | 'quoted text' echo then 'quoted text'
+		-eu x=1 && "$@" echo ${HOME} awk test 2>/dev/null local
+		/usr/bin test echo x=1 x=1 --verbose
+x=1 cd 2>/dev/null 2>/dev/null local x=1 awk && ${HOME}
+	${HOME} sed awk test "$@" echo -eu 2>/dev/null -eu awk grep sed printf done |
+'quoted text' grep test cd 2>/dev/null 2>/dev/null "$1" 'quoted text' grep --verbose
+echo local readonly echo --verbose done cd
+"$1" sed $(pwd) local readonly "$1" --verbose $(pwd) "$1" --verbose
+		done local readonly grep "$@"
+	echo cd --verbose "$@" test x=1 export "$@" $(pwd) grep
+		/usr/bin sed done 'quoted text'
+-eu printf sed printf $(pwd) done --verbose ${HOME} then 'quoted text'
+		-eu && "$@" $(pwd) ${HOME}
+readonly echo x=1 export echo test $(pwd)
+printf "$@" $(pwd) sed local
+	"$@" x=1 ${HOME} --verbose echo printf | echo sed $(pwd) test
+		$(pwd) readonly grep 'quoted text' --verbose x=1 | export echo sed
+awk 2>/dev/null "$@" local "$1" && 2>/dev/null "$1" echo cd "$1"
+		| cd export test cd && x=1 grep readonly done done echo then local
+		| && awk local && awk 'quoted text' | awk
+		cd then sed test x=1 'quoted text' then cd sed x=1 then
+	readonly x=1 x=1 test grep --verbose
+		done printf printf /usr/bin
+printf /usr/bin echo export
+		"$@" cd ${HOME} 'quoted text' grep
+then x=1 test | done readonly readonly then && "$@" -eu && grep test echo then cd
+echo /usr/bin -eu then ${HOME} test /usr/bin done | printf "$@" /usr/bin
+		"$1" && --verbose then "$@" && cd done --verbose "$1" sed ${HOME} && readonly
+	'quoted text' grep then ${HOME}
+	"$@" | x=1 sed "$1" test awk $(pwd) x=1 x=1 "$1" grep readonly awk "$@"
+		--verbose echo | 'quoted text'
+		awk "$1" 'quoted text' local "$1" printf cd ${HOME} sed 'quoted text'
+		| echo 'quoted text' 'quoted text'
+	export && 2>/dev/null done "$1" then ${HOME} then /usr/bin
+	sed ${HOME} 2>/dev/null cd grep
+	-eu --verbose test grep &&
+		echo then /usr/bin 'quoted text' | 2>/dev/null $(pwd) export cd grep
+"$1" "$1" grep cd x=1 2>/dev/null $(pwd) 2>/dev/null
+$(pwd) cd test then 2>/dev/null test
+| ${HOME} then "$1" "$@" ${HOME} local | then readonly -eu 2>/dev/null
+		&& ${HOME} -eu -eu local 2>/dev/null
+		'quoted text' 2>/dev/null readonly printf cd
+		${HOME} grep test --verbose printf "$@"
+'quoted text' cd printf && export x=1 readonly cd "$@" "$1" /usr/bin
+export "$@" printf ${HOME} ${HOME}
+2>/dev/null "$@" && && 'quoted text'
+		done | 'quoted text' "$@" test $(pwd) test "$1" test ${HOME}
+/usr/bin /usr/bin && local
+	printf x=1 | grep /usr/bin "$1" "$1"
+$(pwd) /usr/bin done local echo 2>/dev/null grep 2>/dev/null
+	sed grep "$1" echo then sed then 2>/dev/null cd $(pwd) grep local --verbose echo
+echo export | then --verbose then --verbose ${HOME}
+then /usr/bin done export | readonly printf export
+'quoted text' "$1" x=1 then done "$1" echo echo test --verbose
+		echo $(pwd) sed then x=1 echo ${HOME} grep && "$@" readonly
+	--verbose --verbose "$@" grep /usr/bin local then echo
+		readonly -eu --verbose ${HOME} "$1" export sed x=1 $(pwd) done grep cd then cd
+		printf echo /usr/bin echo then --verbose --verbose printf then
+&& done export awk 'quoted text'
+/usr/bin done ${HOME} then test --verbose awk sed -eu ${HOME}
+		awk /usr/bin && -eu --verbose 'quoted text' | then
+		grep | awk $(pwd) -eu cd
+	--verbose test test printf -eu grep -eu x=1 'quoted text' /usr/bin sed ${HOME}
+'quoted text' "$@" done x=1 ${HOME} 2>/dev/null
+		printf 2>/dev/null /usr/bin /usr/bin cd "$@" --verbose /usr/bin
+test 2>/dev/null 'quoted text' export
+	x=1 printf then test sed 'quoted text' then echo awk ${HOME} local --verbose
+	'quoted text' | --verbose test then echo -eu ${HOME} test 'quoted text'
+	-eu printf && test grep local then grep x=1 cd
+	$(pwd) export ${HOME} -eu export
+	grep sed -eu done export then 'quoted text' --verbose &&
+		local readonly /usr/bin awk test /usr/bin local
+	"$1" && local test 'quoted text' grep --verbose readonly x=1
+	grep echo | done local /usr/bin awk "$@" sed $(pwd) -eu local
+		local ${HOME} done readonly readonly test --verbose
+	--verbose -eu 'quoted text' "$1" done "$1" sed "$1" readonly
+grep printf 'quoted text' "$@" printf local test local printf && &&
+		cd printf x=1 ${HOME} then local
+	echo export -eu printf readonly x=1 printf --verbose --verbose export echo test
+	local printf readonly grep $(pwd) then "$1"
+		sed local /usr/bin "$1" readonly sed /usr/bin "$1" done sed echo export cd
+	cd | awk sed -eu printf x=1 -eu ${HOME} "$1"
+		"$1" export cd grep 2>/dev/null x=1
+	"$@" -eu /usr/bin $(pwd) local test sed test 'quoted text' awk
+then echo test sed readonly cd && sed test 2>/dev/null x=1 local "$1"
+		readonly readonly cd done awk x=1 sed printf test --verbose
+	local printf "$@" test then
+then test "$1" | --verbose && printf done
+		&& done $(pwd) done awk test | export
+		printf --verbose readonly 'quoted text' ${HOME} /usr/bin $(pwd) awk $(pwd) awk
+		done export | sed "$@" x=1 && "$1" readonly && local ${HOME}
+&& --verbose $(pwd) 2>/dev/null | then
+export readonly | readonly -eu grep "$@"
+		$(pwd) local then ${HOME} done local 'quoted text' "$@"
+	export done && -eu echo printf "$@" sed sed
+		--verbose local cd && then 'quoted text' x=1 && 'quoted text' 'quoted text'
+readonly -eu export printf awk done "$1"
+	--verbose grep "$1" sed done sed x=1 --verbose
+		echo --verbose awk local echo sed $(pwd)
+	awk | ${HOME} then x=1 local $(pwd)
+	${HOME} readonly && local sed x=1 export test --verbose grep
+cd then local ${HOME} ${HOME} "$1" cd && grep 'quoted text'
+	then | local 'quoted text' && $(pwd) && && echo grep echo
+"$@" done done /usr/bin /usr/bin
+sed echo /usr/bin "$1" local cd $(pwd) x=1
+local export echo grep echo awk && awk && $(pwd) --verbose && test 'quoted text'
+		| local 2>/dev/null 'quoted text' --verbose
+'quoted text' -eu "$1" "$1" sed
+		done readonly | grep export "$1" x=1 sed awk --verbose test && "$@" $(pwd)
+	echo && && cd cd printf | sed cd echo done ${HOME} test "$1" 'quoted text'
+	cd x=1 test done echo echo export sed ${HOME} done "$@"
+		"$@" then echo ${HOME} 2>/dev/null
+export grep cd -eu | echo /usr/bin readonly
+		/usr/bin "$@" export && grep grep "$1" printf x=1 "$1" cd local
+&& x=1 ${HOME} /usr/bin 'quoted text'
+		printf && ${HOME} printf "$@" $(pwd) done awk
+		test --verbose done done printf "$1" x=1 done
+test | printf "$1" test awk local
+	x=1 | cd ${HOME} 2>/dev/null
+	awk "$@" ${HOME} then /usr/bin cd "$@" | awk local grep
+'quoted text' "$1" 'quoted text' echo $(pwd) "$@" "$@" -eu -eu "$@" readonly
+	"$1" echo echo grep 'quoted text' then cd cd readonly /usr/bin "$1" "$@"
+	echo /usr/bin grep local grep 'quoted text' /usr/bin readonly
+	echo /usr/bin awk "$@" ${HOME} test done sed test "$@"
+grep ${HOME} grep test | done /usr/bin "$1" echo test sed "$@" x=1 test x=1 $(pwd)
+	readonly then echo "$1" /usr/bin export
+then cd done sed echo local && then printf echo grep x=1 test "$1" --verbose
+done -eu --verbose 2>/dev/null cd
+	export echo export export cd $(pwd)
+	${HOME} "$@" test /usr/bin grep "$1" && 'quoted text' export --verbose
+		"$1" && --verbose ${HOME} | awk 'quoted text' sed
+&& export "$1" ${HOME} cd cd local 2>/dev/null local local
+-eu && cd then awk echo test /usr/bin sed echo sed && 'quoted text' 2>/dev/null
+${HOME} test | /usr/bin x=1 done 2>/dev/null echo echo test | 'quoted text'
+		${HOME} grep done local $(pwd) readonly readonly
+		local grep -eu sed cd export |
+local 2>/dev/null printf export --verbose && --verbose
+	$(pwd) ${HOME} echo sed done 2>/dev/null 'quoted text' sed
+	sed cd sed $(pwd) then echo -eu done
+		printf x=1 --verbose then $(pwd) 2>/dev/null $(pwd) readonly 'quoted text'
+		echo then then test "$1" ${HOME} --verbose echo test -eu "$1" echo
+done | 'quoted text' /usr/bin grep x=1 "$@" $(pwd) test grep -eu
+	then | sed then 2>/dev/null x=1
+$(pwd) readonly -eu awk 'quoted text' x=1
+echo "$@" x=1 echo then done -eu awk && test "$@" ${HOME} /usr/bin echo 2>/dev/null
+	cd done cd -eu --verbose --verbose --verbose done
+| export grep sed 'quoted text'
+	${HOME} awk | grep x=1 'quoted text' test "$@"
+done awk | sed done | printf $(pwd)
+	done 2>/dev/null echo done --verbose grep awk 'quoted text' export
+	cd printf cd /usr/bin sed awk awk
+	/usr/bin echo $(pwd) "$1" ${HOME} sed -eu local
+		-eu local && "$1" "$@"
+		&& done local echo 2>/dev/null
+readonly then 'quoted text' local /usr/bin printf "$1" readonly test echo "$@"
+	x=1 grep cd /usr/bin done |
+		"$@" cd readonly then
+readonly ${HOME} cd && "$@" 'quoted text' ${HOME} --verbose cd awk $(pwd)
+		cd test echo x=1 2>/dev/null "$@" && done grep readonly sed test
+		$(pwd) done $(pwd) -eu "$1" -eu "$@" printf
+		export done | $(pwd) -eu printf then $(pwd) x=1
+${HOME} then printf readonly printf test awk ${HOME}
+	'quoted text' -eu 'quoted text' /usr/bin --verbose ${HOME} sed | | then
+	"$@" | -eu | cd 2>/dev/null && local
+"$1" export 'quoted text' x=1 'quoted text' $(pwd) $(pwd) done && done "$@" export
+	"$1" readonly cd sed --verbose local /usr/bin 'quoted text' printf x=1 then 'quoted text'
+		"$@" then -eu "$1" test /usr/bin -eu grep cd
+		2>/dev/null local local done ${HOME} grep ${HOME} awk awk $(pwd)
+		cd ${HOME} x=1 awk "$1" sed grep done --verbose --verbose
+		x=1 ${HOME} /usr/bin 2>/dev/null /usr/bin then x=1 cd test awk 2>/dev/null done
+		${HOME} readonly export x=1 /usr/bin grep 'quoted text'
+		--verbose && printf | then "$@" then 'quoted text' test test
+	2>/dev/null /usr/bin then local /usr/bin
+	grep "$@" 'quoted text' /usr/bin 'quoted text'
+		sed test /usr/bin && export printf test x=1 readonly
+		export "$1" x=1 then $(pwd) readonly "$@" test awk
+#include c76.sh
+	local printf | "$@" | --verbose ${HOME} --verbose /usr/bin then test test && ${HOME}
+/usr/bin "$1" local export -eu then 'quoted text' 'quoted text' done echo
+grep $(pwd) ${HOME} local x=1 -eu then 'quoted text' -eu "$@"
+	printf x=1 export "$@" --verbose $(pwd) 'quoted text'
+--verbose echo cd $(pwd) done x=1 awk && done -eu ${HOME} sed ${HOME} awk "$@"
+${HOME} local "$@" "$1" $(pwd) "$@" --verbose | readonly ${HOME} grep grep
+awk "$@" export /usr/bin -eu test
+	| sed readonly export done $(pwd)
+		echo local x=1 2>/dev/null
+	x=1 cd -eu x=1 then "$1" readonly
+		export echo readonly sed /usr/bin
+&& 'quoted text' then awk /usr/bin done && x=1 | printf $(pwd)
+cd cd readonly /usr/bin | "$@" echo export export awk
+awk ${HOME} export 'quoted text' echo
+echo export "$1" done | local printf $(pwd) printf && done echo readonly
+grep sed awk cd -eu 'quoted text' cd local test 2>/dev/null
+		&& awk --verbose sed sed readonly 2>/dev/null
+	echo cd grep 'quoted text' done readonly cd
+/usr/bin local 'quoted text' 'quoted text' | "$1" x=1 'quoted text'
+		--verbose then sed cd --verbose /usr/bin -eu test sed export
+	2>/dev/null "$@" | then test ${HOME} /usr/bin "$1" sed x=1 "$@" 'quoted text' awk
+		2>/dev/null then --verbose /usr/bin /usr/bin sed test "$1" -eu 2>/dev/null test
+		2>/dev/null export && && echo printf /usr/bin $(pwd) echo | grep
+	/usr/bin ${HOME} $(pwd) x=1 --verbose awk readonly "$@" cd 2>/dev/null
+		$(pwd) "$1" --verbose &&
+sed done printf echo $(pwd) readonly
+local ${HOME} grep "$1" test "$1" /usr/bin then done cd local done test done awk
+	echo grep test "$@" -eu local awk "$1" readonly -eu done cd then
+		--verbose readonly "$@"
+		x=1 'quoted text' x=1 printf local 'quoted text' --verbose
+	printf export ${HOME} && "$@" 'quoted text' local test x=1
+test export grep export grep | /usr/bin awk "$@"
+	export local x=1 awk $(pwd) sed --verbose
+		--verbose | sed $(pwd) printf echo test readonly
+echo awk "$@" local --verbose awk && $(pwd) export && 2>/dev/null printf |
+		'quoted text' /usr/bin then readonly 2>/dev/null
+readonly --verbose "$1" awk $(pwd) | then local &&
+	export 2>/dev/null "$1" x=1 then x=1 grep local --verbose
+then then cd echo "$1" && local "$1" && sed 2>/dev/null
+		echo "$@" "$1" local done x=1 export test grep && done --verbose
+"$1" cd -eu cd grep /usr/bin grep $(pwd) $(pwd) readonly readonly export
+		/usr/bin /usr/bin 'quoted text'
+x=1 printf export awk readonly "$@" cd /usr/bin
+	&& done done /usr/bin sed ${HOME} x=1 awk | | then -eu local "$@" $(pwd) done -eu
+--verbose test sed "$1" readonly export
+test export sed echo 2>/dev/null readonly readonly x=1 grep
+		/usr/bin test x=1 $(pwd) /usr/bin | /usr/bin "$@" then awk 2>/dev/null "$@" 'quoted text'
+		export "$1" printf "$1" && "$1" local sed test awk printf sed
+	/usr/bin 'quoted text' "$@" $(pwd) readonly cd then "$@" local
+	"$@" test grep readonly 'quoted text'
+		2>/dev/null x=1 export 'quoted text'
+-eu grep $(pwd) $(pwd) | export x=1 "$@" && printf
+then 'quoted text' "$@" $(pwd) printf && | --verbose 2>/dev/null local echo "$@"
+test done grep printf $(pwd) /usr/bin /usr/bin "$1" 'quoted text' echo
+awk export cd printf echo /usr/bin /usr/bin local local 'quoted text' grep x=1
+| grep local && $(pwd)
+		| "$@" "$@" then 2>/dev/null $(pwd) | 'quoted text' x=1 export ${HOME}
+	"$1" awk done echo export 'quoted text' cd printf done echo x=1 'quoted text'
+export "$@" printf "$@" && done 'quoted text'
+	2>/dev/null x=1 done printf export "$1" printf echo sed printf local cd echo
+test test done | sed echo 'quoted text'
+cd then x=1 readonly x=1 test test $(pwd) test "$1"
+		printf grep | export then grep cd
+	then "$@" grep --verbose $(pwd) grep --verbose 2>/dev/null
+${HOME} local 'quoted text' 2>/dev/null
+		&& grep && 2>/dev/null test ${HOME} echo awk awk printf $(pwd)
+	cd cd | done $(pwd) readonly
+	grep cd | export x=1 2>/dev/null printf ${HOME} cd done printf --verbose ${HOME}
+	awk local cd local 2>/dev/null echo --verbose
+| export sed echo --verbose export done "$1" cd sed awk done echo
+export "$1" -eu sed /usr/bin grep x=1 sed -eu readonly --verbose test $(pwd)
+		awk then 'quoted text' 2>/dev/null 'quoted text' export awk $(pwd)
+export export "$@" echo local 2>/dev/null
+"$1" "$1" export readonly
+then sed grep export export $(pwd) "$1" test |
+$(pwd) grep 'quoted text' echo "$1" sed ${HOME} ${HOME} 2>/dev/null
+		"$@" 'quoted text' | "$1" "$1" | | printf done
+	x=1 awk && "$1" then 2>/dev/null readonly | done && echo test local
+	printf then "$@" 'quoted text' | grep then ${HOME} readonly export sed cd echo /usr/bin
+		x=1 2>/dev/null done && x=1 2>/dev/null 2>/dev/null 2>/dev/null 2>/dev/null
+		echo ${HOME} && ${HOME} 2>/dev/null $(pwd) $(pwd) local
+		| && -eu export local "$@" 2>/dev/null ${HOME} "$@" grep x=1
+export grep | /usr/bin test export local "$@" /usr/bin
+done cd | 2>/dev/null $(pwd) ${HOME} sed
+	2>/dev/null echo x=1 "$1" | &&
+		readonly awk 2>/dev/null done readonly echo echo
+	| | | local $(pwd) test then -eu export $(pwd) cd ${HOME} printf export
+		'quoted text' export -eu cd cd ${HOME} x=1 /usr/bin
+$(pwd) then "$1" && ${HOME} grep && 2>/dev/null -eu
+$(pwd) readonly awk printf then ${HOME} then printf
+${HOME} -eu -eu local $(pwd) sed $(pwd) && &&
+"$1" | 2>/dev/null readonly ${HOME}
+		"$@" | --verbose "$1" grep "$@" x=1 test cd 2>/dev/null 'quoted text' --verbose
+$(pwd) local printf echo printf /usr/bin grep
+		$(pwd) cd test 2>/dev/null 2>/dev/null | local /usr/bin ${HOME} ${HOME} readonly
+		then /usr/bin export awk /usr/bin then "$@" awk printf echo $(pwd) --verbose printf
+	readonly 'quoted text' then grep ${HOME}
+${HOME} grep grep grep 'quoted text' grep
+awk test 2>/dev/null test grep test echo local 2>/dev/null
+	sed "$1" echo sed grep && -eu readonly ${HOME} export && test
+	--verbose "$1" --verbose then sed cd ${HOME} x=1
+awk grep cd then ${HOME} then | --verbose && -eu printf 2>/dev/null
+		'quoted text' --verbose echo && 2>/dev/null echo $(pwd) cd echo sed export
+--verbose awk /usr/bin done awk test readonly test done | test $(pwd)
+done local /usr/bin printf then x=1 x=1 export cd /usr/bin grep ${HOME} --verbose
+	test awk | $(pwd) readonly /usr/bin awk printf "$@" "$1" 'quoted text'
+	| awk /usr/bin 'quoted text' readonly $(pwd) export "$1" /usr/bin
+		cd $(pwd) "$1" readonly cd --verbose local ${HOME} "$@" "$1" -eu readonly "$@"
+		/usr/bin | awk ${HOME} readonly export
+	2>/dev/null 2>/dev/null sed export grep
+/usr/bin --verbose ${HOME} done "$1" && done "$1" sed printf then 2>/dev/null
+	"$1" x=1 && done && readonly ${HOME} --verbose
+-eu -eu export "$@" 2>/dev/null 'quoted text'
+--verbose test /usr/bin /usr/bin "$1"
+	$(pwd) ${HOME} ${HOME} "$@" then x=1 "$@"
+	test "$@" echo export cd | "$@" 'quoted text' ${HOME} | test printf
+	then -eu && grep then test echo awk cd printf | $(pwd)
+		/usr/bin /usr/bin then "$@" -eu echo && readonly echo then x=1 cd awk "$@"
+	-eu then echo awk ${HOME} $(pwd) | -eu readonly 'quoted text'
+		local then "$1" echo printf done &&
+	then 2>/dev/null x=1 $(pwd) -eu grep then "$1" | 2>/dev/null
+echo ${HOME} /usr/bin --verbose "$1" 'quoted text' -eu
+test grep test local | && printf
+		-eu 2>/dev/null 2>/dev/null test && "$@" ${HOME} awk grep --verbose -eu 'quoted text'
+	echo test 'quoted text' $(pwd) 2>/dev/null awk cd | "$1" && "$1" 2>/dev/null
+		&& --verbose local && test -eu local | echo local |
+		local -eu x=1 sed test $(pwd) then then
+	${HOME} export "$@" printf sed export $(pwd) | "$1"
+	2>/dev/null sed 'quoted text' cd | readonly echo readonly cd
+	"$@" echo | "$@" printf $(pwd) /usr/bin --verbose
+	test awk -eu printf ${HOME} printf /usr/bin test echo "$1" 'quoted text'
+		$(pwd) export 'quoted text' then cd export sed sed "$@" 'quoted text'
+	"$1" --verbose echo /usr/bin echo
+	test | 2>/dev/null printf cd
+		x=1 local ${HOME} cd 'quoted text'
+	printf readonly echo $(pwd) done
+		sed x=1 then sed printf && "$1" /usr/bin test "$1"
+		local 2>/dev/null | /usr/bin cd && --verbose
+	/usr/bin x=1 | readonly then done cd export
+	readonly $(pwd) /usr/bin cd 2>/dev/null -eu sed --verbose
+		${HOME} 2>/dev/null awk &&
+2>/dev/null && grep ${HOME} done sed export
+sed done test grep 'quoted text' awk printf
+	local echo test export $(pwd) export
+	--verbose test "$1" grep --verbose ${HOME} $(pwd) -eu "$@" cd | echo sed 2>/dev/null
+		test x=1 export && 'quoted text' ${HOME}
+		"$@" printf "$@" | 2>/dev/null sed /usr/bin export ${HOME} awk test
+"$@" --verbose readonly "$1" test export 'quoted text'
+readonly | then | readonly /usr/bin printf local ${HOME} export
+then local | $(pwd) test
+		&& grep /usr/bin "$1" -eu ${HOME} sed &&
+		| echo sed | 'quoted text' &&
+		-eu | "$1" -eu grep 2>/dev/null
+	test && local "$1" 2>/dev/null $(pwd) grep grep ${HOME} $(pwd)
+	readonly 2>/dev/null 2>/dev/null sed then test test printf echo sed local cd
+		2>/dev/null done then /usr/bin grep
+"$@" --verbose /usr/bin grep --verbose 'quoted text' $(pwd) && &&
+then -eu awk "$1" readonly | "$@" x=1
+		echo && grep sed grep -eu "$1" -eu "$1" | then readonly grep echo grep
+	"$@" | echo 2>/dev/null | export $(pwd) local awk /usr/bin ${HOME} echo
+	cd 2>/dev/null readonly "$1" $(pwd) -eu grep readonly /usr/bin
+--verbose local readonly | ${HOME} ${HOME} cd test --verbose |
+		$(pwd) $(pwd) done sed printf "$@" export | export readonly
+| && cd test then local
+		x=1 && "$@" $(pwd) "$1" -eu "$1" export -eu sed /usr/bin
+	"$1" local x=1 readonly 'quoted text' sed echo $(pwd)
+done "$@" export export printf --verbose export test | grep | --verbose
+		then grep awk 'quoted text' done ${HOME} cd 2>/dev/null
+&& readonly && then then
+		"$@" local && cd && grep then --verbose test -eu 'quoted text' | 2>/dev/null
+x=1 awk then 'quoted text' local cd "$@" sed
+	then "$@" x=1 /usr/bin then x=1 -eu && then "$@" grep |
+awk "$1" cd readonly echo -eu then 2>/dev/null sed
+		x=1 -eu cd awk echo 2>/dev/null
+printf && cd printf &&
+		awk cd sed grep cd 2>/dev/null
+		${HOME} test /usr/bin readonly --verbose && cd export test && test test local
+	then readonly local --verbose
+export x=1 "$@" && "$1" echo --verbose -eu x=1 cd x=1 printf export export export
+readonly local /usr/bin export "$1"
+		export /usr/bin x=1 echo /usr/bin "$1" awk
+		-eu sed --verbose local test ${HOME} printf "$1" x=1 sed readonly
+	readonly $(pwd) -eu "$1" cd cd sed "$@"
+"$1" sed -eu readonly "$1" /usr/bin "$@" then grep export done -eu "$1"
+$(pwd) readonly sed $(pwd) printf x=1 | echo | then
+		2>/dev/null test awk -eu echo /usr/bin local 2>/dev/null export echo x=1
+	'quoted text' readonly x=1 "$1" then
+'quoted text' --verbose ${HOME} 'quoted text' "$1" awk export
+grep $(pwd) then x=1 export 'quoted text'
+		2>/dev/null 'quoted text' x=1 "$@" x=1
+	--verbose export "$@" test -eu cd local
+	${HOME} x=1 /usr/bin /usr/bin 2>/dev/null
+	echo /usr/bin readonly 'quoted text' -eu readonly
+'quoted text' ${HOME} | cd done awk $(pwd) x=1 &&
+'quoted text' readonly grep -eu 'quoted text' "$1" echo ${HOME} done
+		readonly sed grep printf test
+		readonly "$1" awk 2>/dev/null echo local
+		| printf cd cd | $(pwd) test 'quoted text'
+		then "$1" local 'quoted text' --verbose
+x=1 export done x=1 test sed export
+	"$1" /usr/bin x=1 test x=1
+	done ${HOME} && cd awk "$1"
+	-eu $(pwd) "$1" "$@" printf && --verbose $(pwd)
+&& readonly 'quoted text' | $(pwd) echo x=1 test cd "$1" grep
+	done local x=1 echo | /usr/bin 'quoted text' "$1"
+	local -eu local grep $(pwd) /usr/bin && /usr/bin local 2>/dev/null ${HOME} -eu
+	"$@" | "$@" -eu | then 'quoted text' echo x=1 grep 2>/dev/null local
+		| -eu export "$@" local /usr/bin then readonly "$1" printf "$@" "$1" ${HOME} "$@"
+	done export ${HOME} done 2>/dev/null
+	export && cd /usr/bin awk awk export $(pwd) --verbose sed
+x=1 done x=1 sed printf $(pwd) echo done 'quoted text' cd && 'quoted text'
+		local | grep --verbose awk | readonly then 2>/dev/null 'quoted text'
+	"$@" printf | -eu awk 2>/dev/null printf export
+	$(pwd) /usr/bin grep sed echo printf export local cd
+readonly then 2>/dev/null readonly "$1" test | && x=1 "$@"
+		/usr/bin then then grep awk "$1" sed local
+sed "$@" 'quoted text' 2>/dev/null echo | 2>/dev/null
+		sed | x=1 printf 'quoted text'
+	printf local readonly readonly x=1 sed export /usr/bin "$1" $(pwd)
+	-eu done grep && 'quoted text' x=1 ${HOME}
+	export $(pwd) local /usr/bin export $(pwd) done ${HOME}
+/usr/bin 2>/dev/null echo --verbose x=1 'quoted text' done -eu | 'quoted text'
+	done 2>/dev/null export "$1" 2>/dev/null
+		| | then export --verbose grep --verbose awk
+		${HOME} readonly 'quoted text' "$@" echo done cd readonly "$1" done awk
+	"$1" && --verbose --verbose && "$@" grep && grep cd test awk readonly
+local local --verbose --verbose
+export --verbose test ${HOME} test grep $(pwd) echo sed "$1" /usr/bin /usr/bin
+x=1 grep /usr/bin ${HOME} "$1" local cd --verbose
+readonly awk cd done export /usr/bin
+		done "$@" $(pwd) awk cd cd 'quoted text'
+readonly /usr/bin readonly done export 2>/dev/null && /usr/bin | grep
+test awk --verbose x=1 sed $(pwd) ${HOME} 'quoted text' test x=1 sed awk local /usr/bin
+		awk x=1 done then printf export
+awk echo && x=1 done | printf "$@" export $(pwd)
+	echo "$1" echo printf /usr/bin /usr/bin
+cd && then export then 'quoted text' cd -eu $(pwd) then 2>/dev/null ${HOME}
+		--verbose "$@" ${HOME} | $(pwd) x=1 grep && --verbose echo 2>/dev/null
+done && "$1" grep done printf test && export echo -eu echo "$@" readonly
+	test readonly 'quoted text' ${HOME} "$@" then "$@" test
+sed then printf | "$@" -eu echo /usr/bin
+sed export ${HOME} | --verbose grep cd
+		awk local sed local 2>/dev/null x=1 $(pwd) && then x=1 2>/dev/null && x=1 | /usr/bin
+readonly $(pwd) "$@" /usr/bin "$1" "$1" sed | 2>/dev/null echo printf awk 'quoted text'
+	-eu "$1" sed test $(pwd) sed awk grep cd export
+	then /usr/bin local readonly && readonly export
+| && then ${HOME} readonly export && local |
+		local ${HOME} readonly awk | echo awk -eu local test "$1" grep && echo echo
+		$(pwd) grep "$1" awk done
+		grep $(pwd) grep readonly && then
+done | "$1" then | export readonly && $(pwd)
+2>/dev/null -eu echo test $(pwd) /usr/bin && | readonly ${HOME} 'quoted text'
+		x=1 then awk 'quoted text' $(pwd)
+		| 2>/dev/null x=1 && | test cd "$1" sed "$1" | 'quoted text' $(pwd)
+	done --verbose test 2>/dev/null sed ${HOME} local && 2>/dev/null printf sed
+	echo local /usr/bin ${HOME} ${HOME} cd
+	$(pwd) export ${HOME} awk test awk /usr/bin
+	readonly && "$1" 2>/dev/null then | x=1 "$1" cd export test sed 2>/dev/null
+"$@" cd "$1" sed 2>/dev/null grep
+	sed && cd "$@" awk $(pwd)
+		&& 'quoted text' grep readonly /usr/bin
+	| echo | then 2>/dev/null local local ${HOME}
+awk "$@" -eu "$1" local printf
+${HOME} /usr/bin 'quoted text' 'quoted text' /usr/bin echo
+	| -eu -eu | then "$@" grep "$1" x=1 $(pwd) "$1" readonly $(pwd)
+		&& | 'quoted text' readonly sed done then 2>/dev/null readonly done echo
+	'quoted text' --verbose ${HOME} readonly --verbose local "$@"
+	&& cd 2>/dev/null -eu $(pwd) test
+		'quoted text' grep x=1 sed test ${HOME} awk $(pwd) -eu | && readonly x=1 then
+${HOME} -eu x=1 printf export
+readonly test sed "$1" -eu export ${HOME} x=1 test "$@" test
+		x=1 sed -eu --verbose grep 2>/dev/null "$1" "$1" $(pwd) 2>/dev/null /usr/bin
+	local -eu -eu /usr/bin "$@" --verbose /usr/bin /usr/bin x=1 test
+	done | echo 2>/dev/null echo cd | "$1" "$1" ${HOME} "$1" then echo
+		test 'quoted text' | "$@" printf readonly echo export
+		grep ${HOME} 'quoted text' "$1" done echo local
+		2>/dev/null awk sed | test --verbose -eu ${HOME} then
+		test /usr/bin local awk 2>/dev/null && then $(pwd) | x=1 export printf && readonly
+	readonly grep local | 'quoted text' export x=1 ${HOME} $(pwd)
+	2>/dev/null then cd done --verbose then awk test
+	&& grep "$@" printf -eu "$1" readonly
+		"$1" ${HOME} | 'quoted text' printf x=1 awk done -eu $(pwd)
+local printf | then then -eu && && grep test
+		${HOME} 'quoted text' then then grep done local export
+'quoted text' $(pwd) --verbose awk "$@" cd done sed ${HOME}
+		${HOME} done test "$@" local /usr/bin | echo printf x=1
+		x=1 2>/dev/null grep cd && "$1" test readonly printf export cd awk --verbose
+		echo | grep "$1" -eu echo awk
+		'quoted text' 'quoted text' then then
+		2>/dev/null x=1 cd --verbose test $(pwd) then export
+		/usr/bin then sed sed readonly done readonly readonly awk ${HOME}
+'quoted text' done &&
+local cd printf -eu cd x=1
+2>/dev/null cd echo $(pwd) 'quoted text' awk echo ${HOME}
+| sed 'quoted text' --verbose awk then grep local ${HOME} $(pwd) -eu export -eu
+x=1 $(pwd) 'quoted text' echo ${HOME} /usr/bin --verbose then $(pwd)
+		cd grep 'quoted text' "$1" sed /usr/bin local /usr/bin $(pwd) cd
+	2>/dev/null done "$@" awk | "$1" then
+	'quoted text' then 2>/dev/null
+cd local readonly "$@" ${HOME} done
+awk -eu ${HOME} done awk "$1"
+	2>/dev/null sed && "$1" "$1" awk local
+		awk printf printf test done 'quoted text'
+"$1" printf 'quoted text' | x=1 ${HOME} cd
+	2>/dev/null x=1 $(pwd) -eu test grep readonly local 'quoted text'
+/usr/bin printf awk printf "$@" sed cd printf x=1 && "$1"
+'quoted text' "$1" | local printf local done readonly grep echo /usr/bin
+		awk cd awk export 2>/dev/null
+		--verbose | local x=1 x=1 --verbose x=1 echo
+	local $(pwd) /usr/bin $(pwd)
+"$1" 'quoted text' --verbose --verbose --verbose
+	export "$@" | | --verbose test printf test ${HOME} "$@" $(pwd) test "$@"
+		"$@" && export local local 2>/dev/null export ${HOME} -eu ${HOME} export
+		--verbose readonly printf export
+		$(pwd) echo ${HOME} 2>/dev/null -eu export export
+then then export cd 'quoted text' grep sed export "$@" sed then
+	x=1 && cd echo "$@" echo local export echo --verbose "$1" 'quoted text' grep awk
+test x=1 done 2>/dev/null printf | grep echo $(pwd)
+/usr/bin 2>/dev/null 'quoted text'
+	--verbose awk readonly $(pwd)
+	sed | 'quoted text' then "$@" /usr/bin
+		sed | $(pwd) printf "$1" -eu export test "$1" -eu | then grep
+	test | test cd "$1" done then $(pwd) "$@" then local $(pwd) 2>/dev/null
+		cd && then $(pwd) cd | /usr/bin && printf "$1" 'quoted text'
+echo cd echo | "$@" echo $(pwd)
+	"$@" && 'quoted text' awk ${HOME}
+		/usr/bin export echo export
+	then $(pwd) "$@" test awk grep test | /usr/bin "$1" | 2>/dev/null grep 'quoted text'
+then | --verbose 'quoted text' test 'quoted text'
+		'quoted text' readonly printf
+export x=1 cd export | ${HOME} then done "$1" grep | export 2>/dev/null done
+	&& test export "$@" printf sed 'quoted text' sed | test test readonly
+	&& ${HOME} -eu ${HOME} $(pwd) $(pwd) done grep local "$@" ${HOME} | grep awk --verbose
+--verbose export test awk
+cd cd done export grep ${HOME} "$@" | && export "$@" --verbose -eu
+	2>/dev/null export cd printf 2>/dev/null
+		readonly --verbose -eu --verbose
+		grep | awk 'quoted text'
+		/usr/bin x=1 2>/dev/null done /usr/bin 2>/dev/null then done awk
+/usr/bin echo | "$1" $(pwd) printf test grep ${HOME}
+2>/dev/null ${HOME} grep ${HOME}
+		readonly $(pwd) ${HOME} "$1" | 2>/dev/null sed ${HOME} ${HOME} readonly
+		${HOME} 2>/dev/null export readonly && test $(pwd)
+	export /usr/bin | | x=1 | sed then "$1" ${HOME} --verbose | ${HOME} awk "$1"
+	printf grep grep $(pwd) ${HOME} x=1 --verbose
+	grep printf export awk 'quoted text' 'quoted text' awk awk "$1" && ${HOME}
+		awk --verbose then then
+	2>/dev/null test "$@" | export
+	cd readonly awk "$@" "$1"
+		readonly echo "$@" "$@" awk export
+		${HOME} done grep cd test 2>/dev/null "$1" $(pwd) 2>/dev/null grep grep "$@" readonly
+	| export && grep then -eu | --verbose 2>/dev/null awk awk "$1" readonly --verbose
+	then done 2>/dev/null printf
+	printf local 'quoted text' "$@" ${HOME} 2>/dev/null -eu export 2>/dev/null
+"$@" grep test 2>/dev/null awk awk /usr/bin
+	x=1 $(pwd) $(pwd) grep then test && | && awk
+done readonly awk done awk ${HOME} --verbose && 'quoted text'
+	${HOME} cd "$1" --verbose -eu /usr/bin awk x=1 /usr/bin then ${HOME} local
+--verbose export local export echo | && cd 2>/dev/null echo $(pwd) local
+		-eu ${HOME} cd && echo x=1 then 2>/dev/null "$@" done done --verbose 2>/dev/null
+/usr/bin && && x=1 -eu && && "$@" 'quoted text' local "$1" echo 2>/dev/null /usr/bin
+	grep ${HOME} awk test ${HOME} sed
+cd "$@" 2>/dev/null then export grep sed
+		"$@" awk cd x=1 done "$1" $(pwd) sed
+	readonly awk test printf export x=1 --verbose "$@" 'quoted text'
+		"$1" awk "$1" grep local --verbose 'quoted text' -eu test printf
+		| $(pwd) test local ${HOME} x=1 export local done 'quoted text' && "$@" $(pwd)
+test readonly x=1 awk local |
+	2>/dev/null --verbose done printf
+	&& awk 'quoted text' && x=1 cd 'quoted text' 2>/dev/null | | "$@" && 2>/dev/null
+	cd $(pwd) && $(pwd) sed && echo local x=1 2>/dev/null "$1"
+| | x=1 "$1" awk -eu test -eu
+	sed "$@" sed "$@" grep x=1 then x=1 | sed export then awk export cd |
+		/usr/bin readonly test | -eu
+	/usr/bin cd awk | ${HOME}
+		test done 2>/dev/null && printf
+		"$1" echo done awk "$1" x=1 'quoted text' --verbose
+	2>/dev/null echo && /usr/bin local done readonly | | test --verbose 'quoted text'
+$(pwd) then awk /usr/bin printf test awk grep
+	--verbose 'quoted text'
+	| -eu "$1" ${HOME} ${HOME} "$1"
+	readonly export awk echo awk 'quoted text'
+2>/dev/null "$@" local echo grep awk -eu /usr/bin printf $(pwd)
+cd x=1 | test x=1 test awk awk "$@"
+		then --verbose --verbose | -eu | grep && x=1 grep export && grep
+		test done printf $(pwd) -eu readonly
+		--verbose then export x=1 && /usr/bin "$1" sed /usr/bin x=1 local awk | local
+export /usr/bin -eu "$@" printf done $(pwd) x=1 printf then ${HOME}
+		--verbose local printf done 'quoted text' $(pwd) | then --verbose
+		&& /usr/bin $(pwd) sed readonly awk && ${HOME} grep
+		printf readonly export | | /usr/bin x=1 sed local then
+		'quoted text' done ${HOME} export -eu "$@" local "$1" export then /usr/bin
+		readonly -eu test then export
+$(pwd) "$1" x=1 grep && then awk x=1 done $(pwd) sed ${HOME} /usr/bin sed "$1"
+		then --verbose $(pwd) awk cd
+--verbose 2>/dev/null "$1" && sed x=1 then 'quoted text' ${HOME} /usr/bin
+		export "$1" 2>/dev/null "$1"
+test local $(pwd) | -eu && "$1" grep 2>/dev/null && local export
+		echo && | cd && then export export | 2>/dev/null cd x=1 && export
+		grep 2>/dev/null local "$@" 'quoted text' then
+	x=1 cd | readonly echo
+echo $(pwd) ${HOME} ${HOME} 2>/dev/null then echo sed && readonly cd
+&& 2>/dev/null /usr/bin
+	then /usr/bin ${HOME} awk /usr/bin grep "$1" echo done
+	done x=1 then /usr/bin done readonly local sed
+"$1" $(pwd) then /usr/bin -eu "$1" && $(pwd) && 2>/dev/null
+		done test sed readonly printf
+	&& echo export echo printf test export ${HOME} "$1" /usr/bin --verbose cd
+	'quoted text' test -eu $(pwd) awk 'quoted text' grep done ${HOME} printf x=1
+		/usr/bin grep test export | 2>/dev/null -eu local done --verbose test printf
+--verbose test printf | printf "$1" grep && printf then export /usr/bin
+	/usr/bin readonly readonly && 2>/dev/null
+	echo then 2>/dev/null
+	2>/dev/null "$1" echo then | readonly
+		/usr/bin 2>/dev/null grep && readonly printf readonly awk
+	test export export && readonly done printf
+	--verbose $(pwd) test --verbose test cd ${HOME} readonly echo sed export /usr/bin
+		'quoted text' "$1" 'quoted text'
+		export printf -eu awk echo "$@" && "$1" cd grep 'quoted text' $(pwd) 'quoted text'
+		$(pwd) sed 2>/dev/null ${HOME}
+		$(pwd) readonly printf local export then
+		&& /usr/bin printf && x=1 ${HOME} $(pwd) test grep
+	export echo grep --verbose --verbose
+		sed 2>/dev/null $(pwd) --verbose readonly
+	awk && /usr/bin 2>/dev/null readonly
+sed test grep "$1" -eu x=1 grep
+	then echo readonly /usr/bin readonly cd
+| done done /usr/bin --verbose cd 2>/dev/null echo -eu /usr/bin awk test
+		cd sed 2>/dev/null 'quoted text' then cd 'quoted text' echo x=1 cd
+printf /usr/bin 2>/dev/null 'quoted text'
+| "$1" $(pwd) 2>/dev/null test 2>/dev/null printf
+	x=1 local ${HOME} --verbose /usr/bin "$1" echo grep --verbose export --verbose
+	grep ${HOME} x=1 && /usr/bin then x=1 "$1" 'quoted text' "$@" then $(pwd) ${HOME}
+		"$1" then && 2>/dev/null local
+export test -eu cd then ${HOME}
+	x=1 awk awk grep 2>/dev/null ${HOME} ${HOME} ${HOME} /usr/bin ${HOME} 'quoted text'
+	'quoted text' done cd 'quoted text' export sed ${HOME} local sed test local
+	"$@" grep | export 2>/dev/null test echo awk then 2>/dev/null "$@" /usr/bin
+sed then 'quoted text' done 2>/dev/null --verbose -eu | ${HOME} -eu -eu echo
+	echo then sed then local 'quoted text' test $(pwd)
+/usr/bin | /usr/bin done echo 'quoted text' sed $(pwd)
+		'quoted text' printf "$@" cd local
+sed done 'quoted text' 'quoted text' 'quoted text' $(pwd) echo ${HOME}
+		awk awk "$1" 2>/dev/null --verbose
+	done x=1 awk | "$@" grep grep /usr/bin export readonly test printf "$@" | --verbose
+		awk ${HOME} cd --verbose readonly && local export 'quoted text' printf
+	--verbose cd 'quoted text' awk cd sed echo export test "$@" then
+x=1 grep readonly sed
+	-eu printf /usr/bin readonly export test cd "$@" export -eu 2>/dev/null
+		readonly "$1" x=1 "$@" -eu awk
+		local grep readonly done
+	"$@" grep | ${HOME} x=1 readonly
+'quoted text' printf 2>/dev/null sed 2>/dev/null x=1 x=1 awk /usr/bin --verbose
+		'quoted text' readonly then export grep export sed 'quoted text'
+'quoted text' $(pwd) /usr/bin
+done printf ${HOME} echo | sed
+| | -eu awk --verbose 'quoted text' printf
+	"$1" "$1" -eu | local echo 'quoted text' /usr/bin readonly printf
+		x=1 local local /usr/bin && export test awk -eu
+	$(pwd) grep $(pwd) "$1" "$@"
+	readonly done sed cd readonly cd && echo
+		local export && awk cd "$@" ${HOME}
+cd done readonly "$1" awk cd $(pwd) -eu echo "$@" grep -eu $(pwd)
+| awk test test sed x=1 grep && /usr/bin |
+$(pwd) 'quoted text' printf sed "$1" export printf test grep awk cd
+	x=1 | "$1" grep sed /usr/bin then $(pwd) 'quoted text' 2>/dev/null
+	--verbose test "$1" awk done --verbose grep /usr/bin test export -eu
+	$(pwd) && "$@" ${HOME} -eu -eu awk $(pwd) then
+		/usr/bin echo "$1" 'quoted text' x=1 x=1 printf 'quoted text'
+		done grep && --verbose "$@"
+		done 'quoted text' printf && done echo --verbose &&
+		echo awk echo /usr/bin test
+	/usr/bin local "$@" 'quoted text'
+--verbose export sed printf "$@" done awk sed x=1 grep -eu --verbose
+		local x=1 x=1 | && done --verbose
+	-eu readonly 2>/dev/null grep sed "$@" done && echo 'quoted text' awk test
+		test -eu x=1 'quoted text' ${HOME} "$@" "$1" "$@"
+		/usr/bin "$@" 'quoted text' 'quoted text' /usr/bin /usr/bin
+		x=1 awk && 'quoted text'
+export echo -eu | readonly -eu | awk cd ${HOME}
+"$@" | 2>/dev/null && test printf 'quoted text' ${HOME} "$1" cd awk x=1 --verbose
+sed printf /usr/bin sed done echo /usr/bin test x=1 $(pwd)
+		awk grep cd sed -eu $(pwd) test 2>/dev/null echo then local then grep 'quoted text'
+		| export local -eu /usr/bin 2>/dev/null cd done then 2>/dev/null
+		/usr/bin "$1" 2>/dev/null "$1" then "$@" $(pwd) x=1 ${HOME} -eu readonly "$1" $(pwd)
+	${HOME} x=1 local readonly printf then export 2>/dev/null echo sed | x=1 && x=1
+		/usr/bin then test ${HOME}
+${HOME} grep awk awk 'quoted text'
+		cd 2>/dev/null 2>/dev/null export 2>/dev/null | cd export "$1" readonly
+	&& awk 'quoted text' grep -eu $(pwd)
+		${HOME} "$@" sed local /usr/bin x=1
+		&& ${HOME} -eu | "$1" local echo -eu
+		sed "$@" local local done 'quoted text'
+		2>/dev/null && ${HOME} sed | cd && x=1
+awk sed "$@" sed awk x=1 local
+		${HOME} export | "$@" && grep readonly then -eu $(pwd)
+		export && 'quoted text' then 'quoted text' -eu
+'quoted text' -eu ${HOME} | /usr/bin echo printf 2>/dev/null
+	'quoted text' readonly then
+		local cd done cd readonly "$1" sed | printf "$@" "$1" then export export "$@"
+	cd /usr/bin $(pwd) 2>/dev/null -eu awk sed && --verbose | "$@" local grep
+'quoted text' then local
+	x=1 "$@" -eu local then
+export readonly test /usr/bin | local 'quoted text'
+| /usr/bin readonly "$@" "$1" -eu awk awk local export
+	echo /usr/bin grep /usr/bin /usr/bin --verbose
+	"$1" printf awk x=1 "$1" done x=1 cd test cd 'quoted text' ${HOME} echo 2>/dev/null
+		--verbose export "$1" readonly /usr/bin /usr/bin ${HOME}
+	grep "$1" then awk sed test local printf --verbose
+	awk 'quoted text' cd readonly && done --verbose
+		cd printf done "$1" then x=1 ${HOME} x=1 local
+		${HOME} cd echo ${HOME} grep done local "$1" cd --verbose
+echo ${HOME} echo printf readonly sed -eu "$1"
+--verbose done $(pwd) local awk | | 2>/dev/null
+	-eu awk "$1" $(pwd) export | echo local sed done
+test | -eu then done 2>/dev/null "$@" ${HOME} awk | grep 2>/dev/null done awk
+	"$@" && ${HOME} x=1 | && cd && export export local local $(pwd) awk ${HOME} -eu
+	"$1" done x=1 | 2>/dev/null
+	${HOME} "$@" x=1 sed --verbose awk awk ${HOME} test $(pwd) -eu local done done
+		grep echo grep ${HOME} x=1 local
+		grep export "$1" --verbose 'quoted text' -eu 2>/dev/null ${HOME} --verbose awk
+	cd sed /usr/bin | x=1 cd grep $(pwd) printf sed awk cd done echo export
+		local sed ${HOME} awk | done test readonly | && grep readonly "$@"
+	"$1" awk local test $(pwd) test test 2>/dev/null
+test && readonly local && --verbose cd ${HOME} awk sed -eu grep grep "$@"
+	2>/dev/null local done "$@" awk "$1" "$@" test grep
+		"$@" "$1" echo && sed local --verbose grep cd grep "$@"
+		2>/dev/null sed $(pwd) cd echo test then local then "$@" 2>/dev/null
+		"$1" && local 2>/dev/null
+	sed then readonly $(pwd) | /usr/bin readonly "$@" "$1"
+		test done awk && "$1" | $(pwd)
+"$@" cd | --verbose | done printf --verbose
+'quoted text' awk ${HOME} && test cd local x=1 | export && 2>/dev/null "$@" "$1"
+		--verbose sed sed x=1 2>/dev/null test export "$1" test /usr/bin
+'quoted text' printf --verbose -eu ${HOME} readonly test 2>/dev/null
+export grep done done grep "$@" done then
+	export done ${HOME} "$1" && grep test 'quoted text' x=1
+		${HOME} test grep local
+	cd then echo then test printf "$@"
+	echo sed | cd printf readonly $(pwd)
+| --verbose export sed -eu sed | --verbose 2>/dev/null
+awk x=1 test ${HOME} printf awk printf
+local sed --verbose cd "$@" --verbose
+		test export 2>/dev/null local then cd | cd readonly
+	&& printf /usr/bin cd printf awk local 'quoted text'
+	printf 'quoted text' ${HOME} | $(pwd) -eu "$1" "$@" test
+'quoted text' echo grep grep $(pwd) 'quoted text' local printf
+$(pwd) $(pwd) | "$@" $(pwd)
+	echo printf cd && $(pwd)
+	test "$1" cd local | $(pwd) 2>/dev/null awk sed -eu done cd printf 2>/dev/null
+		x=1 && 2>/dev/null ${HOME}
+cd "$@" 2>/dev/null /usr/bin local "$1" then "$@" --verbose
+	echo cd ${HOME} awk "$@" done sed export readonly readonly ${HOME} --verbose
+	echo 'quoted text' "$1" export readonly done && then done
+	local /usr/bin "$1" local
+	${HOME} $(pwd) grep 'quoted text' sed
+export done -eu /usr/bin then sed |
+	"$@" "$@" $(pwd) readonly
+	then export awk then cd local
+		cd -eu done awk export && -eu test "$@" echo sed test /usr/bin test && /usr/bin
+	2>/dev/null test --verbose sed -eu --verbose readonly printf grep --verbose
+	'quoted text' -eu done echo | 'quoted text' "$1" printf awk x=1 "$@" ${HOME}
+	"$@" 2>/dev/null readonly x=1 x=1 | cd local awk export cd test 2>/dev/null
+then grep readonly printf then /usr/bin test /usr/bin
+		&& export local 2>/dev/null then export echo x=1 "$1" "$1" done $(pwd)
+	'quoted text' "$1" x=1 x=1
+	'quoted text' echo /usr/bin printf readonly cd | "$@" export export
+		export readonly "$1" echo "$@" then readonly
+-eu cd $(pwd) then readonly readonly
+&& then echo | local then "$@" $(pwd) echo then -eu export "$@"
+then cd 'quoted text' grep ${HOME} grep readonly
+	export awk awk -eu awk -eu cd "$1"
+/usr/bin grep readonly then | -eu && test
+grep --verbose test 2>/dev/null sed --verbose export ${HOME} sed grep awk
+echo "$1" x=1 -eu sed done then
+	&& echo "$@" "$@" ${HOME} then "$1"
+	cd /usr/bin ${HOME} $(pwd) done sed -eu awk test && 'quoted text' sed done then
+	-eu echo | local | grep printf sed cd && then | ${HOME}
+		cd "$@" export sed 2>/dev/null local echo
+	--verbose -eu local export x=1 "$@" "$@" sed done export done echo
+		"$@" "$@" 2>/dev/null export test echo && x=1 2>/dev/null
+sed x=1 grep awk export printf sed export /usr/bin
+		readonly local then ${HOME} "$1"
+		--verbose cd grep grep && export done
+		export printf readonly echo cd printf printf test 2>/dev/null --verbose
+		2>/dev/null echo printf $(pwd) -eu grep ${HOME} -eu
+		${HOME} --verbose ${HOME}
+	-eu | export cd "$@" printf 2>/dev/null readonly grep local
+		printf then 'quoted text' ${HOME} sed | $(pwd) $(pwd)
+test test /usr/bin 2>/dev/null "$1"
+/usr/bin "$1" local 2>/dev/null "$@" cd | readonly x=1 2>/dev/null awk
+&& /usr/bin "$1" "$1" -eu local 'quoted text' && ${HOME} | then test &&
+	sed sed export echo "$@" 2>/dev/null sed cd done test
+${HOME} cd "$@" test "$1" export awk $(pwd)
+	printf "$@" awk printf ${HOME} local export readonly 'quoted text'
+	done test 'quoted text' cd awk 2>/dev/null | 2>/dev/null "$@" && printf
+	awk done printf test -eu test grep export
+		&& x=1 -eu local x=1 printf export
+x=1 sed done -eu printf printf 2>/dev/null && "$@" -eu awk "$1" ${HOME}
+		awk readonly $(pwd) then printf sed export grep "$@" "$1" cd ${HOME}
+/usr/bin 'quoted text' readonly echo printf 2>/dev/null
+		cd sed "$@" export ${HOME} readonly sed ${HOME}
+readonly --verbose sed sed local test printf ${HOME} "$@" export
+	then 2>/dev/null x=1 readonly readonly $(pwd) "$1" readonly && x=1 'quoted text'
+"$@" 'quoted text' /usr/bin /usr/bin "$1" -eu done /usr/bin export 2>/dev/null
+		&& printf -eu test then sed cd printf cd "$1" "$1" ${HOME}
+printf && sed cd /usr/bin local
+	grep -eu grep readonly then sed echo printf local 'quoted text' "$1" 2>/dev/null
+2>/dev/null readonly --verbose "$@" --verbose done
+		x=1 'quoted text' sed | /usr/bin local
+	'quoted text' test awk $(pwd) && export test done $(pwd) grep
+		${HOME} $(pwd) x=1 export echo test
+		then | awk echo printf cd -eu /usr/bin cd local && test local grep sed
+		$(pwd) readonly then test
+	cd -eu --verbose | --verbose -eu "$@" grep echo x=1 ${HOME}
+	| x=1 export done sed echo
+--verbose cd "$1" local 'quoted text' grep
+2>/dev/null x=1 awk --verbose
+		sed sed x=1 /usr/bin local /usr/bin x=1 awk test 2>/dev/null printf "$1"
+	echo test local x=1 x=1 /usr/bin
+local cd done cd export
+	printf 'quoted text' /usr/bin done grep
+		export $(pwd) -eu printf $(pwd) /usr/bin x=1 /usr/bin local export -eu
+done cd then readonly $(pwd) -eu test then
+		&& $(pwd) echo echo 2>/dev/null sed export local 2>/dev/null
+cd then ${HOME} 'quoted text' /usr/bin awk grep x=1 /usr/bin
+		done "$1" "$1" "$1" "$1" --verbose 'quoted text' -eu --verbose test export
+		export ${HOME} --verbose done 2>/dev/null local
+	cd readonly | export x=1 then --verbose grep && && grep echo
+	export -eu $(pwd) echo sed grep /usr/bin --verbose done awk
+	grep then grep done done printf
+grep sed awk then echo export test x=1 cd echo ${HOME} | ${HOME} test
+		2>/dev/null export awk 2>/dev/null $(pwd) printf sed $(pwd)
+export 'quoted text' 'quoted text' | sed && export export export ${HOME} "$1"
+		x=1 sed x=1 $(pwd) then ${HOME} local
+echo /usr/bin readonly
+&& "$@" ${HOME} done test ${HOME} cd awk echo 2>/dev/null /usr/bin "$1" then
+	local /usr/bin /usr/bin done "$@" "$@" readonly cd echo 2>/dev/null
+	--verbose "$@" local echo echo cd 'quoted text' "$1" sed $(pwd)
+printf printf 'quoted text' then echo --verbose local printf
+"$@" 'quoted text' --verbose /usr/bin export export x=1 $(pwd) local
+/usr/bin x=1 $(pwd) "$@" &&
+		2>/dev/null local done sed "$@" ${HOME} "$1" --verbose readonly local
+${HOME} /usr/bin 2>/dev/null local grep $(pwd) --verbose ${HOME}
+		echo ${HOME} && export export local "$1" && then done
+	sed test awk ${HOME} echo /usr/bin | echo "$1" printf
+	$(pwd) "$@" -eu ${HOME} x=1 && readonly
+		-eu cd echo $(pwd) -eu 2>/dev/null done grep x=1
+printf --verbose /usr/bin 'quoted text'
+	"$1" readonly printf echo test 'quoted text'
+awk x=1 "$1" test | local then local
+	readonly "$1" ${HOME} echo grep -eu sed 'quoted text' -eu printf done sed
+	test | && grep -eu "$1" export cd x=1 done done | | | x=1 2>/dev/null $(pwd)
+	${HOME} readonly x=1 "$@" && cd --verbose test $(pwd) awk | 'quoted text'
+readonly readonly awk "$@" sed
+$(pwd) then && test | echo /usr/bin | | done -eu local 'quoted text' cd
+	local local | cd export && -eu then /usr/bin cd
+		'quoted text' test 2>/dev/null --verbose test echo 2>/dev/null sed awk test |
+-eu printf "$@" 'quoted text' sed done $(pwd) grep --verbose && "$@"
+		cd test printf local awk ${HOME} | ${HOME} $(pwd)
+	| readonly awk 'quoted text' test export && x=1 export echo -eu cd ${HOME}
+"$@" test "$@" done 2>/dev/null 2>/dev/null readonly $(pwd) "$1" test
+	2>/dev/null --verbose printf grep echo /usr/bin sed $(pwd) done && x=1 echo
+	export local /usr/bin test
+		--verbose $(pwd) echo export $(pwd) ${HOME} echo /usr/bin
+		awk x=1 /usr/bin done 'quoted text' sed
+done -eu /usr/bin x=1 | ${HOME} done ${HOME} then 2>/dev/null then
+"$@" 'quoted text' done $(pwd) "$@" 2>/dev/null sed --verbose 2>/dev/null
+	$(pwd) sed "$@" then --verbose local -eu ${HOME} $(pwd) | "$@" /usr/bin echo
+printf | export sed --verbose local readonly /usr/bin | awk "$@"
+		grep test x=1 && -eu 'quoted text' done test /usr/bin --verbose
+	| sed local grep sed --verbose echo readonly |
+	printf grep 'quoted text'
+awk echo echo test --verbose /usr/bin /usr/bin
+		x=1 printf && then grep export "$1" | && x=1 && x=1 /usr/bin done -eu x=1
+		grep --verbose sed ${HOME} ${HOME} ${HOME} done /usr/bin
+		"$1" printf then 'quoted text' awk && local echo | awk "$@" -eu /usr/bin done
+		then 2>/dev/null $(pwd) printf then test export
+		"$@" printf readonly then 'quoted text' printf awk ${HOME} -eu | grep readonly
+x=1 "$@" echo echo export 2>/dev/null
+readonly local --verbose grep grep readonly "$1" echo /usr/bin
+awk test export cd sed echo --verbose
+	awk "$@" && "$@" 2>/dev/null
+	then grep 'quoted text' ${HOME}
+		| test test 'quoted text' test local readonly readonly printf echo
+	$(pwd) "$@" ${HOME} "$1" ${HOME} local /usr/bin ${HOME} ${HOME} x=1 "$1"
+		x=1 awk grep --verbose echo export done grep readonly cd ${HOME} sed /usr/bin $(pwd)
+done done /usr/bin cd printf && export grep sed ${HOME}
+printf done awk x=1 export "$1" --verbose
+		&& echo 'quoted text' && -eu awk
+		awk sed sed grep --verbose 'quoted text'
+	&& "$@" 'quoted text' printf |
+	&& 2>/dev/null printf cd local "$1" && -eu
+	export grep /usr/bin && local awk awk | -eu /usr/bin printf readonly local
+${HOME} cd readonly done done -eu done /usr/bin readonly "$1" cd then 2>/dev/null
+		--verbose -eu done x=1 --verbose
+	"$1" "$@" "$@" export echo echo && 2>/dev/null
+	grep printf then "$1" readonly printf
+	x=1 x=1 "$@" "$1" done 'quoted text' then cd done /usr/bin "$@" x=1
+		done x=1 cd local test x=1
+	$(pwd) ${HOME} printf export
+		then grep $(pwd) 'quoted text' readonly
+	cd test cd "$1" -eu 'quoted text' $(pwd) readonly -eu
+done $(pwd) local printf "$1" /usr/bin done then $(pwd) | local cd && local
+	x=1 done --verbose echo "$@" $(pwd) /usr/bin
+grep /usr/bin printf | sed | "$1" grep | sed | ${HOME} &&
+${HOME} cd -eu cd "$@" | ${HOME} done --verbose x=1 -eu readonly "$1" then -eu
+&& x=1 sed export grep sed readonly 'quoted text' ${HOME} ${HOME} --verbose x=1
+grep ${HOME} --verbose sed local x=1 --verbose 'quoted text'
+	2>/dev/null printf sed "$@" done awk then cd ${HOME} local && | export
+		grep export readonly echo ${HOME}
+printf -eu then x=1 ${HOME} 2>/dev/null test printf readonly ${HOME} --verbose
+local 2>/dev/null done test -eu ${HOME} echo then test test done
+		--verbose $(pwd) "$@" then export $(pwd) 'quoted text'
+		"$@" sed printf /usr/bin echo export readonly "$1" "$@" "$@" echo awk
+	printf local echo 'quoted text' ${HOME} x=1 echo
+awk 2>/dev/null ${HOME} then --verbose "$@" readonly --verbose "$1" |
+	printf /usr/bin --verbose x=1 grep 'quoted text' | 'quoted text'
+x=1 --verbose ${HOME} "$@" grep x=1
+	-eu then $(pwd) test ${HOME} echo x=1 'quoted text' awk then local 2>/dev/null awk
+cd "$1" echo "$@" "$@" done grep -eu x=1 echo echo -eu 2>/dev/null
+		done "$@" ${HOME} echo 2>/dev/null local | ${HOME} grep
+		sed "$@" readonly echo "$@" export
+/usr/bin printf awk "$@" $(pwd)
+		done && awk "$1" printf 2>/dev/null --verbose
+	export && /usr/bin 2>/dev/null -eu test -eu /usr/bin printf
+	'quoted text' 'quoted text' export then x=1 done then echo "$@" then local
+	sed export done ${HOME} awk awk /usr/bin 2>/dev/null awk /usr/bin 'quoted text'
+test cd 2>/dev/null "$@" $(pwd) cd "$@" readonly awk
+	done "$1" cd ${HOME} test cd $(pwd) $(pwd) cd
+awk export awk 2>/dev/null | x=1
+2>/dev/null awk sed $(pwd) readonly
+	printf done /usr/bin 2>/dev/null echo local ${HOME}
+	${HOME} sed done sed "$1" && cd 2>/dev/null | readonly && --verbose
+	printf then -eu --verbose export export ${HOME}
+echo cd $(pwd) $(pwd) cd done ${HOME}
+	/usr/bin && sed echo test /usr/bin test -eu then grep
+		'quoted text' 'quoted text' then readonly
+	${HOME} | done "$@" ${HOME} | 'quoted text' && then --verbose printf readonly
+		x=1 echo /usr/bin x=1 'quoted text'
+		'quoted text' | export 'quoted text' ${HOME} /usr/bin
+	printf grep 2>/dev/null $(pwd) "$1" ${HOME} "$@" test grep 2>/dev/null sed 2>/dev/null
+	"$1" local ${HOME} $(pwd) "$1" done -eu cd x=1
+		2>/dev/null awk then
+		export ${HOME} export && echo &&
+	"$1" -eu done /usr/bin then --verbose echo sed grep cd 'quoted text' printf local
+awk ${HOME} 2>/dev/null "$1" 'quoted text'
+"$@" -eu echo echo ${HOME} "$1" echo readonly
+	"$1" local x=1 done $(pwd) printf printf local | 2>/dev/null
+echo $(pwd) echo test -eu local then 'quoted text' done then 2>/dev/null local
+done 'quoted text' && then /usr/bin | "$1" -eu --verbose -eu done --verbose
+	then x=1 awk --verbose readonly awk /usr/bin
+	printf then 'quoted text' /usr/bin readonly
+	printf then test 2>/dev/null done && | readonly
+	sed && awk $(pwd) cd ${HOME} -eu cd | 2>/dev/null
+2>/dev/null printf "$1" grep export ${HOME} echo readonly $(pwd)
+		printf "$1" sed $(pwd) test printf
+		"$1" x=1 "$1" export printf ${HOME} 2>/dev/null
+	"$1" readonly printf test test /usr/bin "$1" 'quoted text' done && x=1 echo
+test "$@" ${HOME} echo printf | --verbose
+		"$1" "$1" cd test awk sed "$@" echo grep done
+		"$1" x=1 test sed test echo
+	export then readonly export
+| readonly done readonly /usr/bin 'quoted text' "$@" &&
+export sed export awk then /usr/bin readonly $(pwd) export
+		$(pwd) cd readonly "$@" "$1" local then | | ${HOME} cd test test grep local
+	$(pwd) echo cd export $(pwd) && awk readonly
+		| readonly awk "$@" awk awk $(pwd) then x=1 test readonly local "$@"
+grep $(pwd) echo test $(pwd) grep sed | echo
+		grep /usr/bin readonly awk "$@" x=1 -eu export readonly then $(pwd)
+	export then then echo && "$@" awk cd export $(pwd) x=1 sed /usr/bin printf ${HOME}
+done cd local test echo test | local test
+	"$@" test /usr/bin && x=1 $(pwd) /usr/bin printf readonly
+	printf "$1" && local then 2>/dev/null local x=1 "$1" printf ${HOME}
+		readonly 2>/dev/null cd echo 'quoted text' done $(pwd) cd test awk done
+		$(pwd) /usr/bin "$1" echo test then local local sed grep local
+	| test "$1" 'quoted text' echo --verbose 'quoted text' awk ${HOME} "$1" printf
+		cd "$@" printf echo readonly grep 2>/dev/null 'quoted text'
+		x=1 export echo x=1 export -eu ${HOME}
+	x=1 test readonly done then | --verbose
+		export "$@" "$1" awk -eu echo local echo && cd /usr/bin -eu readonly 'quoted text'
+	-eu ${HOME} grep test "$@" ${HOME} local
+	done test cd 'quoted text' /usr/bin -eu printf
+		"$@" test 'quoted text' | awk readonly readonly
+-eu readonly "$@" then done cd /usr/bin
+export cd ${HOME} awk readonly ${HOME} x=1 awk echo "$@" local x=1
+	local --verbose export
+		test echo sed /usr/bin echo $(pwd) "$1" x=1 test && sed "$1" 2>/dev/null 'quoted text'
+		$(pwd) 2>/dev/null grep /usr/bin | $(pwd)
+	sed /usr/bin sed readonly | echo 'quoted text' /usr/bin cd done /usr/bin
+		x=1 grep awk sed 2>/dev/null done 2>/dev/null "$1" && export -eu /usr/bin awk
+	$(pwd) local test printf export test
+/usr/bin 'quoted text' 2>/dev/null $(pwd) readonly 2>/dev/null
+		test sed -eu x=1 sed local awk && awk then test local done awk
+x=1 sed readonly --verbose
+	local x=1 | -eu grep done printf
+| then test test awk ${HOME} export 'quoted text' export x=1
+export "$1" "$@" done $(pwd) x=1 2>/dev/null readonly
+	cd cd 2>/dev/null ${HOME} echo local /usr/bin then /usr/bin ${HOME} x=1 export
+printf done x=1 cd && awk 'quoted text'
+	$(pwd) "$@" then readonly readonly awk "$1" then "$@" && 2>/dev/null "$1" sed readonly
+test /usr/bin 'quoted text' sed | test awk x=1 done
+/usr/bin "$1" cd readonly "$1" awk done then 'quoted text' local /usr/bin readonly
+		'quoted text' done test --verbose
+grep "$@" "$@" echo | then /usr/bin "$@" "$@" sed ${HOME} sed sed local echo
+${HOME} x=1 done awk | x=1 local $(pwd)
+	$(pwd) test printf done -eu x=1 sed test | test /usr/bin
+--verbose done cd grep x=1 test 2>/dev/null
+	2>/dev/null sed test then
+/usr/bin | "$1" then test "$@" 'quoted text'
+		"$1" cd "$1" cd ${HOME} echo printf
+	grep x=1 x=1 grep -eu cd export | /usr/bin echo
+	sed | $(pwd) x=1 ${HOME} local -eu -eu
+		x=1 done test awk export awk && sed ${HOME} export "$1" grep echo readonly
+		printf echo awk then ${HOME} cd 2>/dev/null echo readonly local awk local readonly
+		"$1" 2>/dev/null ${HOME}
+		sed x=1 "$@" "$@" "$@" /usr/bin sed /usr/bin awk done test ${HOME} cd awk
+grep readonly export cd local awk then echo 'quoted text' readonly cd sed cd
+	${HOME} export done grep local && awk
+${HOME} /usr/bin ${HOME} -eu 'quoted text' cd -eu printf --verbose
+test sed echo export 'quoted text'
+	"$@" --verbose --verbose 2>/dev/null 2>/dev/null
+	'quoted text' --verbose "$1" ${HOME} printf test test 'quoted text'
+		--verbose "$@" -eu then readonly &&
+		readonly --verbose x=1 x=1 done ${HOME} && $(pwd)
+		printf done readonly x=1 "$1" then "$@" printf 2>/dev/null ${HOME} --verbose then
+		readonly awk then ${HOME} local ${HOME} ${HOME}
+	test /usr/bin $(pwd) export x=1 printf awk printf awk awk cd 2>/dev/null
+		awk grep 2>/dev/null 2>/dev/null
+		"$@" | then ${HOME} | readonly "$1" printf printf done readonly
+x=1 then export local "$1" local cd echo then export printf
+'quoted text' $(pwd) 2>/dev/null
+		printf $(pwd) done awk | then x=1
+		then /usr/bin | export x=1 && done export $(pwd) done -eu 'quoted text'
+		local awk readonly cd echo test /usr/bin "$@" --verbose 'quoted text'
+	echo "$@" grep $(pwd) "$1" awk readonly --verbose
+		x=1 x=1 then test sed ${HOME} /usr/bin /usr/bin
+"$1" test test local && && 2>/dev/null
+"$1" then printf $(pwd) readonly $(pwd) /usr/bin echo
+	&& test "$@" 'quoted text' x=1 /usr/bin then "$@" awk echo
+		${HOME} /usr/bin echo test printf -eu -eu cd 2>/dev/null echo "$@" echo
+&& grep x=1 done done | && grep then readonly
+	&& ${HOME} local sed awk printf
+| "$1" ${HOME} && done
+	${HOME} printf sed ${HOME} echo |
+		printf done then -eu "$@"
+"$@" cd 'quoted text' readonly
+	export | readonly $(pwd) sed $(pwd) done --verbose 'quoted text' x=1
+	export echo then --verbose export done export "$1" printf
+--verbose local | done awk then
+-eu /usr/bin echo grep awk /usr/bin
+	--verbose sed -eu --verbose ${HOME} $(pwd) $(pwd) cd | cd done
+		done && && ${HOME} $(pwd)
+&& --verbose cd | | /usr/bin test | done readonly ${HOME} sed x=1
+		grep sed 2>/dev/null "$@" printf 'quoted text' 'quoted text' -eu awk "$@" x=1
+"$@" "$@" "$@" -eu 2>/dev/null grep local /usr/bin | "$@" export
+		echo then done local awk -eu then readonly export --verbose 'quoted text' $(pwd)
+x=1 grep "$@" --verbose ${HOME} ${HOME} &&
+		export local cd "$1" done export && 'quoted text'
+		printf /usr/bin sed "$1" cd
+	echo cd local grep local grep printf printf done export $(pwd) -eu grep 2>/dev/null
+export /usr/bin | $(pwd) "$1" test local
+x=1 | done /usr/bin 2>/dev/null "$1" 'quoted text' cd export ${HOME} 2>/dev/null
+2>/dev/null /usr/bin $(pwd) done 'quoted text' awk ${HOME}
+		${HOME} test /usr/bin done 'quoted text' sed "$1" 2>/dev/null then
+| 'quoted text' printf
+	then readonly printf /usr/bin awk echo
+	sed printf /usr/bin sed readonly echo 2>/dev/null echo && test "$1" export grep
+&& && echo "$@" grep ${HOME} export echo echo done readonly ${HOME} "$@"
+"$@" done $(pwd) $(pwd) sed /usr/bin awk printf local /usr/bin "$1" x=1
+		&& --verbose echo "$1" cd awk local then 2>/dev/null ${HOME} "$@"
+		grep | ${HOME} "$@" awk && grep "$1" local x=1 grep --verbose done
+	--verbose /usr/bin test cd export export done cd grep printf
+grep local -eu local --verbose grep grep x=1 && export | ${HOME} "$@" then
+		cd --verbose readonly "$@" /usr/bin readonly
+	sed && cd 'quoted text' sed --verbose readonly cd --verbose cd -eu readonly
+/usr/bin readonly export
+${HOME} export grep done 2>/dev/null --verbose
+	echo $(pwd) ${HOME} local done ${HOME} "$@" done 'quoted text'
+		&& --verbose echo cd sed echo local printf cd -eu then
+		awk ${HOME} x=1 test -eu local | --verbose 2>/dev/null 2>/dev/null "$@"
+'quoted text' "$@" "$1" printf done grep "$@" local | printf done echo | 'quoted text'
+		sed "$@" done sed local "$@" awk grep then printf 2>/dev/null then
+| cd | sed 'quoted text' | 'quoted text' && 'quoted text'
+		cd awk awk ${HOME} | /usr/bin test sed
+		export "$1" then $(pwd) then
+		-eu printf local printf done "$@" cd then then "$@" local
+test cd awk then readonly 'quoted text' local "$1" then awk ${HOME} printf printf
+	sed printf ${HOME} $(pwd) local local
+	cd 2>/dev/null x=1 $(pwd) then test echo awk awk test done 2>/dev/null
+/usr/bin then readonly
+		grep /usr/bin readonly --verbose ${HOME} then export readonly $(pwd) 2>/dev/null
+	awk x=1 sed /usr/bin | sed "$@" test sed echo 2>/dev/null "$1"
+		'quoted text' | local local echo cd "$@"
+	test printf grep test && "$1" awk | echo readonly
+	awk cd --verbose /usr/bin done export sed 2>/dev/null echo && grep | then x=1
+		cd $(pwd) grep echo then echo readonly readonly "$1" --verbose 2>/dev/null
+--verbose x=1 cd test 'quoted text' then 2>/dev/null
+		&& 2>/dev/null echo done echo readonly
+		awk done then cd cd echo grep local echo echo "$@" local test /usr/bin
+done x=1 -eu && done && -eu echo 'quoted text'
+	/usr/bin /usr/bin printf 'quoted text' "$1"
+	grep | readonly "$@" then ${HOME} "$@"
+		"$1" then local $(pwd) local -eu 2>/dev/null
+/usr/bin sed 2>/dev/null --verbose printf then x=1 $(pwd) 2>/dev/null done "$1"
+		echo cd echo 'quoted text' test echo awk --verbose $(pwd) && printf
+-eu done done local cd done export
+echo done then $(pwd) --verbose sed
+	| export "$1" "$1" done done 'quoted text' grep 2>/dev/null
+	grep -eu readonly 2>/dev/null readonly /usr/bin done $(pwd) local local echo
+$(pwd) awk echo $(pwd) $(pwd) --verbose cd readonly printf x=1 done "$1" $(pwd)
+done "$@" | && ${HOME} done "$1" sed 'quoted text' done /usr/bin
+	2>/dev/null awk cd "$1" done 2>/dev/null x=1 printf x=1
+x=1 grep local cd -eu x=1 export "$@" && local
+	readonly x=1 readonly then test -eu "$1" sed /usr/bin sed
+"$@" cd test "$@" export 'quoted text' printf $(pwd)
+		"$1" /usr/bin -eu then grep --verbose ${HOME} readonly
+		then grep awk ${HOME} test -eu done sed done 'quoted text'
+2>/dev/null export /usr/bin /usr/bin
+		-eu "$1" sed 2>/dev/null "$1" x=1 test printf cd done && | cd ${HOME} done
+		&& cd echo 'quoted text' && cd export local test
+done 'quoted text' test then 2>/dev/null export 2>/dev/null local
+		test awk $(pwd) | -eu local then ${HOME} test sed echo
+echo readonly -eu export x=1 'quoted text' 2>/dev/null
+	/usr/bin | --verbose "$1" readonly x=1 ${HOME} ${HOME}
+		--verbose /usr/bin x=1 grep ${HOME} readonly readonly x=1
+		$(pwd) export cd "$1" export "$@" echo --verbose then
+		export awk "$1" local /usr/bin
+	/usr/bin done $(pwd) x=1 -eu cd echo $(pwd) x=1 awk
+echo "$1" --verbose ${HOME} printf printf grep test /usr/bin /usr/bin
+	x=1 export | awk printf && && local $(pwd) done "$1"
+	x=1 done then && then -eu --verbose grep 'quoted text'
+x=1 awk awk /usr/bin grep export 'quoted text' 2>/dev/null /usr/bin cd
+	2>/dev/null --verbose local ${HOME} grep local sed
+/usr/bin export x=1 then 2>/dev/null printf -eu /usr/bin
+/usr/bin $(pwd) then grep "$@" | 'quoted text' export
+	export readonly export local grep
+	test readonly 2>/dev/null && echo export --verbose
+	'quoted text' local "$@" x=1 "$@"
+		awk ${HOME} export grep echo ${HOME}
+'quoted text' test printf cd 2>/dev/null printf
+"$1" sed printf | --verbose /usr/bin echo export awk awk awk 2>/dev/null
+"$@" && | | "$@" 2>/dev/null -eu export $(pwd) && "$@" done
+		then 2>/dev/null ${HOME} && | "$1" then sed
+	printf 'quoted text'
+test echo sed readonly /usr/bin
+${HOME} cd --verbose awk "$1" done cd then grep readonly
+		echo x=1 export local /usr/bin local "$@" grep export -eu sed cd "$1" /usr/bin
+sed printf $(pwd) export grep /usr/bin "$1" --verbose ${HOME}
+	cd sed then | $(pwd) $(pwd) 2>/dev/null printf then | export && export
+		-eu 2>/dev/null ${HOME} --verbose cd "$1" x=1 printf
+	done 'quoted text' && then "$1" sed done cd
+		--verbose "$1" /usr/bin cd -eu readonly ${HOME} $(pwd) $(pwd) /usr/bin
+	"$1" $(pwd) -eu grep x=1 ${HOME} && /usr/bin "$@" /usr/bin | sed sed cd ${HOME}
+--verbose grep /usr/bin done x=1 local done awk readonly printf grep "$1" 'quoted text'
+	export readonly local x=1 echo printf cd $(pwd) sed printf
+		"$@" cd | export readonly
+	grep export readonly readonly done
+/usr/bin test then | grep awk then export "$1" 2>/dev/null -eu |
+	x=1 && test printf done -eu done -eu
+		'quoted text' 'quoted text'
+	export echo x=1 | sed && grep "$1" "$1" export 'quoted text' local
+readonly cd "$1" test echo ${HOME} 2>/dev/null
+local local readonly "$@" local
+'quoted text' export export -eu "$1" --verbose /usr/bin | test local | test
+	done test 'quoted text' ${HOME}
+		cd cd -eu 2>/dev/null readonly | readonly sed "$1"
+readonly "$1" sed /usr/bin "$@" x=1 awk echo "$@"
+		then 2>/dev/null grep 2>/dev/null -eu /usr/bin
+		test $(pwd) awk "$@" export export $(pwd)
+		| sed awk "$1" readonly readonly -eu echo $(pwd) 'quoted text' -eu
+		test done echo cd export && readonly $(pwd) done sed
+--verbose cd cd "$@" sed x=1 'quoted text' echo echo export && "$@" cd
+grep done readonly export
+export && cd echo ${HOME} awk local && echo -eu x=1 cd
+	/usr/bin cd export $(pwd) local printf
+"$@" export echo sed $(pwd) 'quoted text' grep "$1" | --verbose
+-eu --verbose && $(pwd) export $(pwd) then printf "$1" sed | x=1 "$1" done echo
+	x=1 test sed --verbose done /usr/bin readonly "$@" test 'quoted text'
+grep done && | 2>/dev/null /usr/bin -eu -eu | printf && x=1
+	| local $(pwd) export ${HOME} 'quoted text' 2>/dev/null |
+'quoted text' cd local printf grep 2>/dev/null cd cd printf
+/usr/bin echo cd "$@" | export /usr/bin x=1 | 2>/dev/null test printf
+'quoted text' sed "$@" sed && "$1"
+done "$@" cd grep readonly 2>/dev/null 2>/dev/null
+		'quoted text' 'quoted text' cd
+grep 'quoted text' readonly "$1" done /usr/bin "$1" cd "$1" local -eu test
+		local --verbose done "$1" then awk awk 2>/dev/null x=1 | done
+local && local cd ${HOME} && then $(pwd)
+		"$1" /usr/bin 2>/dev/null 2>/dev/null /usr/bin done sed
+	${HOME} grep | 2>/dev/null x=1 --verbose cd then local
+${HOME} "$@" test awk
+cd echo $(pwd) ${HOME} $(pwd) --verbose
+&& awk then | then printf readonly "$@" /usr/bin "$1" done
+2>/dev/null export ${HOME} $(pwd)
+	"$1" test "$1" --verbose export done ${HOME} readonly 'quoted text'
+		--verbose ${HOME} test "$1"
+		x=1 cd ${HOME} done awk sed cd readonly | x=1 then done readonly
+	test echo readonly "$1" readonly $(pwd) export x=1 ${HOME} local x=1 readonly grep
+	$(pwd) local awk done && 2>/dev/null
@@ -0,0 +1,2001 @@
+	$(pwd) grep -eu printf awk done done grep cd -eu ${HOME} sed ${HOME} --verbose
+		local /usr/bin --verbose awk 'quoted text'
+	"$@" 2>/dev/null test then x=1 then x=1 2>/dev/null
+		'quoted text' local awk 'quoted text' --verbose 2>/dev/null
+"$1" 2>/dev/null grep test
+	2>/dev/null && echo readonly echo awk cd && test cd then readonly sed -eu echo
+	-eu /usr/bin test echo echo | /usr/bin x=1 "$@" printf /usr/bin && /usr/bin then
+	cd --verbose done /usr/bin $(pwd) 2>/dev/null 2>/dev/null "$@" then
+		${HOME} done then echo cd cd done ${HOME}
+		printf then grep && awk "$@" then x=1 "$1" awk "$1"
+	done ${HOME} done local readonly
+local done 2>/dev/null readonly cd x=1 'quoted text' then awk --verbose grep printf
+printf readonly export --verbose
+&& sed printf echo sed local then echo sed test done -eu
+	awk 'quoted text' then grep done done readonly
+	sed echo sed sed --verbose x=1 2>/dev/null 2>/dev/null && -eu local
+/usr/bin /usr/bin 2>/dev/null 'quoted text'
+	done -eu ${HOME} x=1 'quoted text' "$@"
+		x=1 test local cd cd readonly
+	readonly sed awk "$@" "$@"
+	"$@" local local $(pwd) cd | "$1" test | -eu echo && /usr/bin
+&& "$1" ${HOME} --verbose then ${HOME} done ${HOME} awk -eu printf done sed
+		/usr/bin --verbose export done --verbose
+&& printf test echo /usr/bin then /usr/bin
+| && cd /usr/bin | test then
+	--verbose printf readonly && "$1" | done /usr/bin cd 2>/dev/null
+		/usr/bin | export && --verbose echo ${HOME} test ${HOME} ${HOME} 'quoted text'
+		x=1 cd -eu grep && 'quoted text'
+awk echo readonly cd $(pwd) export echo && sed --verbose
+--verbose test then --verbose printf
+		then x=1 done echo --verbose echo
+&& | x=1 awk done ${HOME}
+2>/dev/null readonly awk awk cd | then $(pwd) "$1" x=1 'quoted text'
+	echo "$1" "$@" awk cd 'quoted text'
+	sed | /usr/bin ${HOME} "$@"
+	-eu awk test test local
+		local && "$1" "$@" | ${HOME} done /usr/bin done readonly
+	x=1 'quoted text' local echo export sed x=1 | sed ${HOME} "$@" then -eu test export
+	$(pwd) echo /usr/bin export
+		readonly x=1 printf printf done x=1
+	/usr/bin then local 2>/dev/null
+	echo x=1 'quoted text' -eu | done /usr/bin $(pwd) grep
+		&& 'quoted text' done $(pwd) "$@" 'quoted text'
+		&& awk /usr/bin readonly
+	/usr/bin grep 2>/dev/null ${HOME} --verbose x=1 'quoted text' && 2>/dev/null
+	"$1" awk -eu export cd --verbose
+"$1" test "$@" /usr/bin 'quoted text' test readonly | test sed grep
+		done /usr/bin /usr/bin awk $(pwd) local 'quoted text' awk test local
+	awk x=1 sed done 'quoted text' "$1" then grep done
+		2>/dev/null echo 'quoted text' 'quoted text'
+--verbose awk -eu && echo echo 2>/dev/null readonly | --verbose then
+		sed printf x=1 2>/dev/null echo --verbose 'quoted text'
+	x=1 | echo cd --verbose awk
+		cd grep /usr/bin -eu awk readonly --verbose sed done "$1" printf -eu awk -eu
+	readonly printf echo cd | -eu test done local 'quoted text'
+		2>/dev/null /usr/bin done sed echo -eu done "$1" test
+		"$@" | then ${HOME} then test awk /usr/bin readonly 2>/dev/null $(pwd) 2>/dev/null
+printf 2>/dev/null local
+		grep echo done && -eu echo ${HOME} cd --verbose
+"$@" export $(pwd) cd done sed readonly x=1 printf
+		'quoted text' local then awk test $(pwd) --verbose export
+--verbose 2>/dev/null echo $(pwd) then x=1 -eu printf cd printf -eu done
+	| "$1" && | "$1" awk /usr/bin done
+		x=1 "$@" local "$@" export | ${HOME}
+		2>/dev/null test | $(pwd) sed -eu --verbose sed export cd readonly
+		awk -eu sed 'quoted text' $(pwd) $(pwd) x=1 "$@"
+	grep | export awk printf /usr/bin awk x=1 && && | -eu done local "$1" x=1
+grep echo done done sed -eu | sed x=1 "$1" ${HOME} ${HOME} "$1" printf printf
+		echo grep 'quoted text' cd
+	local printf printf awk grep then sed --verbose test | && export
+local ${HOME} readonly local /usr/bin x=1 then then 'quoted text'
+test 2>/dev/null readonly done /usr/bin
+local $(pwd) awk grep grep printf "$@" done "$@" awk done then && /usr/bin 2>/dev/null
+done /usr/bin $(pwd) printf cd "$@" x=1 export 'quoted text' done x=1 then "$@"
+		-eu readonly export cd then
+		sed export sed && 2>/dev/null grep
+	&& x=1 $(pwd) test local 'quoted text' x=1 done x=1 sed echo -eu | | "$@" --verbose
+		test test awk 'quoted text' ${HOME} then readonly sed 2>/dev/null
+		awk | then && -eu "$@" 'quoted text' 2>/dev/null
+${HOME} && "$@" x=1 readonly
+	'quoted text' "$1" --verbose 'quoted text' test local
+		"$@" awk $(pwd) "$1" cd -eu "$@" -eu test /usr/bin
+	echo "$1" --verbose "$@" printf echo then sed awk sed readonly
+	printf export $(pwd) done echo $(pwd) sed
+/usr/bin "$1" awk export readonly 2>/dev/null local | "$1" echo sed
+"$@" cd readonly /usr/bin /usr/bin echo printf "$1" "$1" /usr/bin
+$(pwd) echo | grep $(pwd) echo awk /usr/bin x=1 sed
+	x=1 'quoted text' done readonly 2>/dev/null "$1"
+	| /usr/bin awk readonly awk -eu cd awk then sed --verbose
+	grep cd | -eu done grep
+		grep then x=1 x=1 && 2>/dev/null
+/usr/bin /usr/bin && | "$1" export 'quoted text' cd x=1 sed ${HOME}
+${HOME} local printf -eu x=1 then
+x=1 echo awk ${HOME} /usr/bin | --verbose /usr/bin test then then -eu local printf
+| && awk done $(pwd) 'quoted text' "$1" echo awk done
+awk readonly export done
+${HOME} sed readonly 2>/dev/null then awk
+		/usr/bin echo readonly --verbose export -eu echo "$@" 'quoted text'
+		"$@" test local done | then 'quoted text' done $(pwd) "$@" local /usr/bin ${HOME}
+	readonly grep done local | ${HOME} awk grep 'quoted text'
+--verbose local awk grep "$1"
+	$(pwd) local "$@" export export echo ${HOME} local /usr/bin -eu local sed -eu -eu
+		then local grep "$1" ${HOME} cd "$1" /usr/bin 'quoted text' "$@" -eu test echo cd
+		sed test printf /usr/bin readonly echo test cd x=1
+	x=1 test 'quoted text' test awk "$1"
+-eu | 2>/dev/null awk x=1 | 'quoted text' $(pwd) printf ${HOME} export export
+	done done /usr/bin 2>/dev/null then done printf --verbose
+		export grep test sed -eu 'quoted text' -eu grep done cd "$@" | "$1" "$@" | 2>/dev/null
+		local x=1 --verbose 'quoted text' cd printf cd "$1" then
+	grep -eu done "$@" "$1" then $(pwd) grep "$1" /usr/bin
+		done "$1" test local | 'quoted text' 2>/dev/null
+		--verbose test "$1" "$@" "$@" /usr/bin /usr/bin
+		| -eu 2>/dev/null -eu 2>/dev/null /usr/bin export printf printf test done
+"$1" local 'quoted text' local x=1 -eu
+	awk 2>/dev/null --verbose echo "$1" cd echo x=1 x=1 | readonly awk && $(pwd)
+local done export $(pwd) 'quoted text'
+		${HOME} grep x=1 then "$@" 2>/dev/null cd printf "$@" test echo $(pwd) export
+--verbose --verbose grep x=1 ${HOME} x=1 -eu local done echo 2>/dev/null "$1" ${HOME}
+		-eu "$1" x=1 printf echo sed local sed echo local echo then
+'quoted text' local --verbose then "$@" /usr/bin
+	sed --verbose /usr/bin --verbose done /usr/bin grep 'quoted text'
+		--verbose grep $(pwd) && cd && readonly
+		readonly "$@" x=1 && cd 2>/dev/null /usr/bin awk "$@"
+"$1" export sed cd $(pwd) && "$1" readonly done /usr/bin
+local ${HOME} grep local sed $(pwd) test then 'quoted text' /usr/bin -eu readonly
+'quoted text' done export grep && test readonly export --verbose awk 2>/dev/null
+	'quoted text' $(pwd) "$@" | test export | | sed "$1" ${HOME} -eu test "$1" echo
+	"$@" -eu sed export export awk /usr/bin cd $(pwd) 2>/dev/null
+	local done cd cd done ${HOME} --verbose cd
+then --verbose printf grep "$@" export ${HOME}
+		export 'quoted text' then /usr/bin /usr/bin cd export grep $(pwd)
+		done test ${HOME} export export awk then sed 2>/dev/null "$1" export
+cd 'quoted text' echo "$1"
+2>/dev/null test printf export | echo test "$1" awk "$@"
+		test readonly "$@" export "$@" $(pwd) echo | readonly "$1" echo /usr/bin --verbose
+cd -eu && | local 'quoted text' then awk -eu awk sed | "$@" /usr/bin 2>/dev/null
+	x=1 $(pwd) printf cd --verbose
+		$(pwd) 2>/dev/null done -eu x=1 test
+		test test --verbose sed x=1 sed "$@" then test echo
+		local -eu $(pwd) | export
+2>/dev/null sed awk sed
+	--verbose export readonly | cd sed /usr/bin readonly 'quoted text'
+	done sed local x=1 printf
+done echo cd echo then then then local /usr/bin x=1 export then 'quoted text'
+		test /usr/bin 2>/dev/null readonly local -eu "$@"
+		printf readonly ${HOME} 'quoted text'
+	| grep 'quoted text' |
+		"$@" awk readonly awk grep --verbose
+"$1" 2>/dev/null "$@" export done
+		"$1" /usr/bin $(pwd) echo 'quoted text'
+awk sed 2>/dev/null printf
+| readonly 'quoted text' echo -eu local local -eu test 'quoted text'
+	"$@" && | done readonly ${HOME} x=1 'quoted text' printf printf
+done 2>/dev/null awk "$1" -eu /usr/bin awk printf ${HOME} readonly
+	readonly printf sed then test -eu sed
+	done x=1 --verbose then printf --verbose sed "$@" export
+	printf "$1" awk test readonly /usr/bin 2>/dev/null test readonly
+	printf export readonly 'quoted text' 'quoted text' 2>/dev/null
+		$(pwd) test export export then local $(pwd) printf --verbose $(pwd)
+	2>/dev/null then readonly && sed export | echo printf "$1" cd | grep export
+cd && ${HOME} test "$@" -eu then
+		| $(pwd) 'quoted text' --verbose local
+-eu "$1" done printf --verbose then echo /usr/bin && cd | cd awk
+	readonly done 2>/dev/null local
+done test 2>/dev/null export echo readonly local echo && -eu x=1 | export ${HOME}
+	awk done 'quoted text' "$1" cd $(pwd) -eu done "$@" -eu "$@" export grep then
+	'quoted text' --verbose x=1 -eu export printf 'quoted text' 2>/dev/null
+${HOME} /usr/bin /usr/bin grep sed ${HOME}
+	"$@" test readonly export $(pwd) export --verbose test echo --verbose $(pwd)
+		--verbose | sed --verbose $(pwd) -eu printf test
+		local 'quoted text' awk done test export then "$1" printf test 'quoted text'
+		readonly /usr/bin && cd cd && "$@" grep /usr/bin
+grep export sed done $(pwd) | --verbose done awk 'quoted text'
+sed "$1" printf $(pwd) echo x=1 done --verbose -eu 'quoted text'
+		"$@" sed -eu sed sed readonly readonly export cd then
+	"$1" test grep test "$@" && "$@" | echo | "$@"
+		export cd -eu cd "$@" grep --verbose local ${HOME} $(pwd) "$@" done 2>/dev/null
+"$@" "$1" | grep printf /usr/bin export awk
+		2>/dev/null $(pwd) cd --verbose --verbose 2>/dev/null then 2>/dev/null
+		-eu 2>/dev/null /usr/bin
+export 2>/dev/null /usr/bin echo
+&& --verbose "$@" echo --verbose sed printf cd printf
+	printf $(pwd) -eu printf echo
+"$@" cd && local printf echo grep && awk local 2>/dev/null
+done sed echo "$@" /usr/bin
+	export "$@" local readonly done
+	| readonly echo 2>/dev/null test readonly /usr/bin
+		done 'quoted text' /usr/bin 2>/dev/null "$@" cd awk /usr/bin 'quoted text'
+readonly 2>/dev/null | readonly
+		&& cd then "$@" grep $(pwd) 'quoted text' sed 'quoted text' 2>/dev/null
+readonly sed sed "$1" grep
+	${HOME} ${HOME} awk then grep "$1" ${HOME} "$1" sed readonly | $(pwd)
+"$@" "$1" x=1 x=1 printf $(pwd) echo /usr/bin && x=1 2>/dev/null
+	local 2>/dev/null done && sed /usr/bin
+	/usr/bin echo cd 'quoted text' "$1"
+	export /usr/bin echo "$@" $(pwd) echo x=1 done && | 'quoted text'
+awk cd "$@" | echo echo 'quoted text' "$@" "$@" x=1
+		$(pwd) sed -eu /usr/bin 2>/dev/null && grep export 2>/dev/null
+		done printf printf "$@" grep grep $(pwd)
+	$(pwd) "$@" cd sed then
+"$@" export -eu "$@" ${HOME} awk | local printf
+	"$@" | then && $(pwd) echo "$@" "$1" x=1 -eu $(pwd) /usr/bin "$1" ${HOME}
+	cd done $(pwd) readonly $(pwd)
+	cd && "$@" cd done ${HOME} /usr/bin "$@" "$1" grep sed cd echo && cd grep export
+	| sed ${HOME} 'quoted text' /usr/bin && -eu --verbose --verbose "$1"
+readonly local sed cd 2>/dev/null
+	export sed local /usr/bin
+test printf grep | readonly local sed ${HOME} ${HOME}
+	'quoted text' /usr/bin 'quoted text' ${HOME} "$1" | export "$1" cd grep cd
+&& awk then cd $(pwd) printf sed | sed 'quoted text' 2>/dev/null
+test 2>/dev/null local -eu then "$@" --verbose
+	printf "$1" 2>/dev/null $(pwd) awk 2>/dev/null
+		then $(pwd) sed -eu export grep
+		grep | 2>/dev/null printf $(pwd) "$@" grep awk printf
+		/usr/bin cd done readonly cd awk | readonly x=1 --verbose
+	$(pwd) | -eu test readonly -eu then local sed -eu awk grep x=1
+		2>/dev/null cd | "$1" --verbose 'quoted text' readonly
+-eu local | then cd sed then /usr/bin "$@" && --verbose sed
+		grep grep --verbose printf export $(pwd) 'quoted text' export --verbose test
+		awk $(pwd) then grep 'quoted text'
+then "$1" && then "$1" export cd local | grep $(pwd) x=1 echo "$1" cd test
+"$@" $(pwd) sed "$@" x=1 "$@" done test
+		| --verbose local readonly 2>/dev/null
+x=1 local then printf export -eu $(pwd) "$1" cd echo echo 2>/dev/null
+		then "$@" $(pwd) "$@" 'quoted text' && export $(pwd) echo cd 'quoted text' $(pwd)
+	${HOME} echo echo && echo echo printf && ${HOME}
+test printf | ${HOME} --verbose 'quoted text' --verbose local
+	cd --verbose printf echo readonly
+x=1 cd "$@" cd readonly "$@" export done "$1" && awk printf 2>/dev/null done
+		done awk local cd cd | then x=1 done 2>/dev/null done
+	-eu "$@" -eu /usr/bin awk $(pwd)
+		${HOME} export test echo /usr/bin echo echo test printf /usr/bin -eu "$@" sed
+-eu export 2>/dev/null then -eu -eu printf $(pwd) --verbose
+		2>/dev/null 2>/dev/null cd /usr/bin
+		test export export | 'quoted text' done grep cd printf cd readonly "$1"
+--verbose awk ${HOME} export --verbose sed ${HOME} sed cd readonly
+	then "$@" test local --verbose | export grep printf grep awk then export "$1"
+&& && done printf echo done --verbose ${HOME} | ${HOME} && -eu -eu "$1" /usr/bin
+${HOME} /usr/bin 2>/dev/null x=1 readonly done --verbose $(pwd) 2>/dev/null
+	2>/dev/null test awk x=1 --verbose
+		| export awk x=1 $(pwd) | test cd awk && &&
+$(pwd) echo local "$@" sed 'quoted text' grep printf done && readonly cd echo |
+local grep 'quoted text'
+"$1" readonly echo echo cd x=1 "$@" readonly
+	/usr/bin -eu echo echo | 'quoted text' done printf printf $(pwd)
+		awk -eu | printf /usr/bin then then 2>/dev/null
+		| printf done test ${HOME} x=1 $(pwd) cd x=1 cd x=1 test readonly
+		local cd /usr/bin ${HOME} /usr/bin
+cd --verbose readonly x=1 grep && then
+	echo done sed test && then awk sed grep
+2>/dev/null $(pwd) ${HOME} done /usr/bin echo export /usr/bin && |
+	cd 2>/dev/null grep then ${HOME} sed $(pwd) grep 'quoted text'
+	--verbose then awk ${HOME} x=1 readonly
+	&& sed x=1 /usr/bin 'quoted text' | export printf printf "$1" sed sed 'quoted text'
+	then | done echo cd | then then 'quoted text'
+		$(pwd) --verbose x=1 awk -eu "$@" local ${HOME} "$1" x=1 export
+	2>/dev/null ${HOME} local
+		printf readonly cd 2>/dev/null readonly "$1" 'quoted text' ${HOME}
+	then printf && echo grep 2>/dev/null
+	local printf --verbose sed test printf test
+		"$@" "$1" test readonly then done --verbose local 'quoted text'
+	2>/dev/null && done awk
+	| | /usr/bin "$1" -eu test done test printf cd test
+	| 'quoted text' sed $(pwd) && readonly
+	readonly 2>/dev/null ${HOME}
+readonly ${HOME} && "$@" x=1 ${HOME}
+export && cd "$1" "$1" sed --verbose done && /usr/bin --verbose
+		sed 'quoted text' cd "$1" sed awk awk sed | --verbose -eu cd ${HOME}
+export ${HOME} export test then cd x=1 2>/dev/null
+	$(pwd) done done done ${HOME} cd ${HOME} | sed 'quoted text'
+	awk export 2>/dev/null x=1 2>/dev/null
+	-eu x=1 /usr/bin printf && done -eu --verbose 'quoted text'
+	--verbose "$@" ${HOME} local echo grep 'quoted text' x=1 2>/dev/null
+	"$@" echo readonly x=1 test "$1" 'quoted text' 'quoted text'
+		--verbose 2>/dev/null --verbose --verbose
+2>/dev/null /usr/bin "$1" awk readonly $(pwd) $(pwd) && 2>/dev/null
+		echo export grep local ${HOME} 2>/dev/null
+		'quoted text' grep export 2>/dev/null | --verbose readonly done "$1" done sed
+		local && | readonly test "$@" printf cd cd done readonly grep
+		test 2>/dev/null 2>/dev/null | /usr/bin
+	grep ${HOME} done | readonly readonly done awk 2>/dev/null echo x=1 ${HOME} &&
+		${HOME} then awk ${HOME} ${HOME} && $(pwd)
+		grep /usr/bin | | done cd "$@" --verbose echo && sed --verbose --verbose cd export
+	printf echo "$1" export readonly /usr/bin readonly export 2>/dev/null
+sed awk 'quoted text' test 2>/dev/null --verbose grep "$1" printf --verbose
+		&& done printf readonly
+	echo 'quoted text' | 'quoted text' && readonly export sed "$@" -eu "$1" | "$@"
+		$(pwd) && sed cd && awk printf echo then /usr/bin awk "$1"
+awk sed local done x=1 test
+		-eu "$1" -eu export cd readonly printf
+		sed awk test ${HOME} ${HOME} 'quoted text'
+	readonly echo local /usr/bin x=1 ${HOME} 'quoted text' --verbose
+		test "$1" && 'quoted text' cd then export 'quoted text' cd --verbose
+		"$1" x=1 "$1" x=1 --verbose then x=1 sed readonly
+		readonly then "$@" printf done -eu ${HOME} $(pwd) x=1 local
+		/usr/bin "$1" | x=1 echo cd
+		$(pwd) "$@" ${HOME} /usr/bin --verbose printf "$@"
+x=1 "$@" export "$1" echo "$1" awk
+	done 'quoted text' export $(pwd) grep "$@" grep /usr/bin awk -eu echo ${HOME}
+		/usr/bin export x=1 then local "$1" "$1" grep local x=1 x=1 ${HOME} &&
+-eu done printf awk "$@" cd sed echo /usr/bin -eu && echo
+		| done echo grep ${HOME} awk test
+		"$@" awk awk $(pwd) $(pwd) 2>/dev/null --verbose test
+		export printf "$@" --verbose
+&& printf local printf grep ${HOME} | 'quoted text'
+	2>/dev/null x=1 && 2>/dev/null done && printf | /usr/bin then export
+x=1 x=1 | 2>/dev/null local grep 'quoted text' test
+		x=1 readonly test export ${HOME} /usr/bin && awk
+		| x=1 x=1 | && local cd ${HOME} $(pwd) && readonly grep "$1" | 2>/dev/null
+	&& echo && 2>/dev/null 'quoted text' -eu done x=1 x=1 grep cd sed
+		&& echo readonly sed echo printf --verbose awk grep --verbose cd grep sed printf
+		x=1 printf local printf
+		echo grep sed cd awk export 2>/dev/null x=1 $(pwd) cd printf ${HOME}
+	printf done --verbose | 2>/dev/null printf grep then
+	/usr/bin /usr/bin x=1 grep $(pwd)
+		echo -eu test /usr/bin $(pwd) sed
+	$(pwd) export grep 'quoted text' readonly x=1 'quoted text' "$1" grep printf
+2>/dev/null 'quoted text' export && echo "$@" -eu "$@" /usr/bin
+		--verbose test awk readonly
+		"$@" cd /usr/bin -eu export cd test export printf echo export
+2>/dev/null awk x=1 'quoted text' done
+	test echo "$1" then grep export 2>/dev/null readonly ${HOME}
+then awk awk cd readonly cd -eu
+	${HOME} | local local echo printf done /usr/bin local grep local --verbose
+		echo local awk export cd $(pwd)
+-eu /usr/bin --verbose readonly done printf local $(pwd)
+then cd readonly --verbose local
+	--verbose local 'quoted text' cd $(pwd) && export
+-eu && ${HOME} readonly && awk x=1
+/usr/bin && awk local awk $(pwd) 2>/dev/null test export
+&& 'quoted text' awk && then then
+		"$@" then echo grep awk export echo test "$1" export | test | sed | ${HOME}
+	grep && grep echo "$@" echo && /usr/bin readonly 2>/dev/null
+$(pwd) local echo --verbose cd --verbose --verbose 2>/dev/null readonly
+		local grep sed | sed local /usr/bin | printf x=1 "$1" echo then
+	$(pwd) test printf echo x=1 'quoted text'
+done -eu echo test -eu 2>/dev/null export /usr/bin done readonly
+$(pwd) "$@" -eu $(pwd) local readonly
+	| x=1 --verbose done /usr/bin -eu echo then printf
+	'quoted text' "$1" done grep /usr/bin -eu "$1" printf readonly sed /usr/bin done
+"$@" grep /usr/bin --verbose echo && cd 2>/dev/null
+local cd ${HOME} local printf
+x=1 "$@" awk x=1 /usr/bin readonly | x=1 | |
+| "$@" && -eu "$1" test cd then x=1 export
+"$1" /usr/bin ${HOME} /usr/bin -eu local grep 'quoted text'
+sed then 'quoted text' done printf then "$@" /usr/bin --verbose x=1 --verbose
+		done 2>/dev/null grep printf grep /usr/bin && && "$1"
+${HOME} export cd && local cd 'quoted text' && | printf && --verbose "$@"
+	then cd printf readonly test --verbose local $(pwd) --verbose printf
+	echo && cd x=1 "$@" then ${HOME}
+readonly grep awk 'quoted text' echo 2>/dev/null
+	test "$1" $(pwd) cd local "$1" x=1 test printf sed | readonly readonly |
+		-eu $(pwd) done ${HOME} done
+&& "$@" test grep readonly
+	-eu then test local echo ${HOME} then /usr/bin && printf grep "$1" grep local
+		&& grep 'quoted text' done -eu | $(pwd) --verbose done readonly
+$(pwd) 2>/dev/null $(pwd) "$@" --verbose
+$(pwd) "$@" done 2>/dev/null --verbose ${HOME}
+		awk "$@" | x=1 done --verbose -eu sed "$1" then
+echo local awk $(pwd) && "$@" $(pwd) /usr/bin test ${HOME} local grep
+"$@" local awk test done local sed grep test 'quoted text' "$@" local
+		"$@" | awk printf sed $(pwd)
+	export readonly done $(pwd) printf readonly
+&& local ${HOME} "$@" "$1" printf test x=1 echo echo awk
+&& cd export x=1 done export
+	$(pwd) grep readonly printf readonly ${HOME} "$1" $(pwd)
+echo readonly | awk "$@" -eu $(pwd) export $(pwd) test 2>/dev/null test && $(pwd)
+done /usr/bin test readonly -eu sed done printf cd readonly
+	test -eu then local cd ${HOME} then then test
+| awk grep | sed 2>/dev/null | && | | test
+-eu done grep test sed then
+		grep local printf "$@" done local sed --verbose sed | then grep
+	cd x=1 --verbose sed $(pwd) grep then echo printf
+		"$@" grep 'quoted text' readonly then "$@" cd 2>/dev/null 2>/dev/null "$1"
+done readonly cd sed cd | printf awk 2>/dev/null export x=1
+	export ${HOME} ${HOME} then $(pwd) echo printf && 2>/dev/null
+	sed printf "$1" done cd export readonly
+		printf && sed /usr/bin | done --verbose test 'quoted text'
+		printf then --verbose export local /usr/bin -eu
+		awk x=1 | /usr/bin && --verbose readonly --verbose
+		then "$@" 2>/dev/null 2>/dev/null echo
+	| done grep --verbose cd done awk | x=1 grep --verbose
+	"$1" cd /usr/bin sed export test then
+then test export readonly readonly awk
+		echo echo printf done "$@" printf export
+	'quoted text' "$@" test echo then done printf ${HOME} export
+	&& /usr/bin export "$@" /usr/bin x=1 --verbose export then echo readonly
+${HOME} then /usr/bin cd local test awk -eu then readonly 'quoted text'
+	"$1" "$@" local && sed "$@" && /usr/bin $(pwd)
+readonly grep $(pwd) "$@" 'quoted text'
+cd 2>/dev/null ${HOME} /usr/bin 'quoted text' echo
+	"$1" local | /usr/bin |
+echo ${HOME} export local ${HOME} /usr/bin
+"$1" | awk done | done
+/usr/bin readonly awk
+	--verbose x=1 'quoted text' printf done $(pwd) grep "$@" $(pwd) 'quoted text'
+	${HOME} export x=1 done grep --verbose 'quoted text' | echo x=1 printf "$1" &&
+	readonly --verbose local printf
+"$@" grep sed 2>/dev/null then grep /usr/bin grep test | && "$1" --verbose
+	&& awk echo -eu | printf && "$@" export 'quoted text' && --verbose "$1"
+	'quoted text' "$@" | cd local 'quoted text' --verbose 2>/dev/null then $(pwd)
+		/usr/bin 'quoted text' 2>/dev/null
+		grep sed ${HOME} local grep 2>/dev/null --verbose
+	2>/dev/null readonly test cd done done ${HOME} awk echo local echo x=1 ${HOME}
+	then /usr/bin 2>/dev/null printf then
+test "$@" $(pwd) test --verbose
+		local --verbose ${HOME}
+&& awk --verbose sed then | 2>/dev/null
+	readonly -eu grep 2>/dev/null awk readonly
+	${HOME} done ${HOME} echo echo --verbose "$@" "$1" && cd /usr/bin
+		readonly && x=1 --verbose "$1" x=1 sed then -eu sed 'quoted text' -eu local
+--verbose test | | $(pwd) printf "$@" 'quoted text' echo --verbose ${HOME} echo
+export echo export export /usr/bin grep grep grep local cd cd
+	'quoted text' && done /usr/bin export "$1" readonly "$@"
+		${HOME} x=1 echo export done $(pwd) --verbose
+	/usr/bin done sed "$@" grep | ${HOME} printf "$1" /usr/bin --verbose
+		&& export local $(pwd) && then grep local -eu
+	awk x=1 "$1" test cd test x=1 readonly
+		"$@" sed && ${HOME} printf printf done
+	${HOME} x=1 /usr/bin --verbose
+	"$@" readonly ${HOME} | then
+		test x=1 | done x=1 readonly echo local $(pwd) echo sed --verbose local readonly
+		$(pwd) "$1" echo local | cd
+		grep 'quoted text' echo "$@" awk $(pwd)
+sed test && "$1" test $(pwd)
+	export /usr/bin && $(pwd) --verbose test -eu 'quoted text' cd awk
+local grep awk 2>/dev/null x=1 --verbose $(pwd) done then /usr/bin
+		| echo x=1 x=1 /usr/bin $(pwd) test 2>/dev/null
+	"$1" export echo cd 'quoted text' echo 2>/dev/null
+		export -eu /usr/bin test
+	local readonly readonly 'quoted text'
+		'quoted text' echo /usr/bin
+	readonly then $(pwd) $(pwd) awk x=1 local "$1" then local export x=1 "$@"
+		echo 'quoted text' cd $(pwd) ${HOME} echo ${HOME} | cd "$1" sed grep --verbose
+	-eu echo "$1" --verbose then test readonly
+		test $(pwd) x=1 -eu test awk printf then test
+	| ${HOME} ${HOME} /usr/bin "$1" "$1"
+2>/dev/null cd $(pwd) printf "$@" then && sed local printf printf --verbose
+then 2>/dev/null cd printf | done $(pwd) "$1"
+	$(pwd) export cd test "$1" --verbose printf &&
+		'quoted text' echo export -eu cd grep cd done -eu -eu 2>/dev/null
+2>/dev/null ${HOME} "$1" ${HOME} | && $(pwd) echo readonly test && 2>/dev/null
+then awk "$@" export sed done x=1 --verbose "$@" grep grep
+	grep cd x=1 echo 2>/dev/null && $(pwd) grep 'quoted text' done echo
+	--verbose "$1" grep test
+		grep local x=1 | "$@" printf grep done ${HOME} --verbose
+	--verbose readonly readonly test &&
+		grep 'quoted text' | then test grep | grep export
+		readonly export done "$@" printf sed
+| -eu ${HOME} then $(pwd) local "$@" echo
+echo ${HOME} sed 'quoted text'
+	readonly "$@" export test -eu grep printf
+	grep export test $(pwd) sed printf "$@" readonly && 'quoted text' then export
+awk cd $(pwd) local | --verbose echo "$1" $(pwd) echo test --verbose
+		cd $(pwd) echo readonly test --verbose -eu $(pwd)
+	"$@" awk | "$1" awk -eu test "$1" && grep && grep grep
+		--verbose "$1" 2>/dev/null echo --verbose 2>/dev/null test test "$1"
+local readonly readonly 2>/dev/null awk -eu export test
+		readonly test "$1" x=1 | ${HOME} -eu $(pwd) test ${HOME} awk x=1 echo ${HOME} --verbose
+		done echo "$@" $(pwd) cd echo local $(pwd) local export done then echo done
+	--verbose readonly "$1" $(pwd) 2>/dev/null | --verbose
+then readonly -eu --verbose | ${HOME} ${HOME} $(pwd) | "$1" done awk echo
+		'quoted text' "$@" readonly $(pwd)
+"$1" -eu echo printf awk | 2>/dev/null x=1
+&& /usr/bin done ${HOME} "$@" printf "$@" --verbose x=1 printf local
+		awk sed "$1" /usr/bin readonly local then 2>/dev/null sed $(pwd) && ${HOME}
+		${HOME} local grep "$@" 2>/dev/null cd x=1 ${HOME} -eu then
+	grep 2>/dev/null printf --verbose "$1" ${HOME} test grep
+	printf -eu test then 'quoted text' printf done then "$@" --verbose
+	echo local $(pwd) printf then $(pwd) test $(pwd) readonly
+		export export ${HOME} echo
+--verbose awk "$@" printf
+		x=1 local 2>/dev/null x=1 "$@" sed printf --verbose
+		printf && cd done echo "$1" 'quoted text'
+		${HOME} ${HOME} echo test
+	local echo then grep echo readonly readonly
+grep printf readonly done && x=1 local $(pwd) done cd awk
+	x=1 /usr/bin && "$@" 2>/dev/null
+	'quoted text' local echo | --verbose test
+'quoted text' local then
+| | ${HOME} sed x=1 done /usr/bin "$1" export -eu -eu ${HOME}
+		readonly printf export /usr/bin
+	test test $(pwd) --verbose grep
+	awk export sed "$@" 2>/dev/null ${HOME} | sed 2>/dev/null cd /usr/bin
+	${HOME} 2>/dev/null /usr/bin done "$1" /usr/bin then -eu grep ${HOME}
+done sed /usr/bin echo ${HOME}
+$(pwd) | cd --verbose | printf 2>/dev/null test awk grep sed x=1 /usr/bin local
+sed printf $(pwd) "$1" --verbose 'quoted text'
+		$(pwd) -eu readonly grep grep
+		&& printf grep --verbose
+	"$1" 2>/dev/null ${HOME} | $(pwd) -eu | x=1 sed $(pwd) awk
+"$@" echo printf sed $(pwd) /usr/bin printf echo | --verbose
+	"$1" local ${HOME} sed local
+		then export "$@" printf 'quoted text'
+		awk ${HOME} | sed --verbose
+"$1" printf "$@" then 'quoted text'
+"$1" local then readonly awk
+	test readonly /usr/bin "$@" 'quoted text' x=1 -eu ${HOME}
+	| --verbose | $(pwd) grep x=1 2>/dev/null 2>/dev/null
+"$1" ${HOME} cd $(pwd) export x=1 ${HOME}
+		local then sed done --verbose sed --verbose --verbose "$1" cd "$@"
+	export -eu "$@" "$1" export grep | grep 'quoted text' x=1 --verbose ${HOME}
+		printf "$1" printf echo 'quoted text'
+readonly -eu test --verbose done cd test awk echo done sed 'quoted text'
+--verbose 2>/dev/null then grep "$1" test --verbose readonly "$@"
+	grep echo ${HOME} --verbose export "$@" readonly | $(pwd) readonly ${HOME} --verbose
+grep test $(pwd) --verbose test echo
+done export | "$1" $(pwd) printf
+	done local test ${HOME} ${HOME} grep -eu "$1" readonly readonly &&
+		awk x=1 sed local cd cd local awk | /usr/bin then awk ${HOME}
+	/usr/bin 'quoted text' awk echo
+local --verbose done readonly grep x=1 done
+		sed done awk awk grep local "$@" awk export $(pwd) done export $(pwd) 2>/dev/null
+	then x=1 && cd then sed then
+	test ${HOME} --verbose /usr/bin printf readonly
+		export grep | readonly 2>/dev/null /usr/bin | done readonly && &&
+	test ${HOME} local "$1" /usr/bin ${HOME} cd local --verbose 2>/dev/null
+		grep done export && export export cd test local
+		readonly x=1 grep awk 'quoted text' /usr/bin then ${HOME}
+		local ${HOME} done 2>/dev/null
+done test ${HOME} then echo test awk readonly printf ${HOME} "$@" echo then export
+		awk echo -eu test "$1" local 'quoted text'
+	-eu export && grep "$1" 2>/dev/null 2>/dev/null readonly -eu
+${HOME} local -eu 'quoted text' 2>/dev/null local -eu
+		2>/dev/null $(pwd) 'quoted text' "$@" --verbose $(pwd)
+		| ${HOME} "$@" $(pwd) && "$1" /usr/bin export "$@" x=1 $(pwd) 'quoted text' x=1
+		echo 2>/dev/null && printf awk sed sed readonly sed
+		/usr/bin "$@" 2>/dev/null /usr/bin readonly
+		-eu done echo done export printf x=1 $(pwd) test export export
+		echo 'quoted text' 'quoted text' test
+-eu | --verbose sed local --verbose $(pwd) readonly 'quoted text'
+	echo export printf echo "$@" done 2>/dev/null ${HOME} sed -eu -eu "$1" | local /usr/bin
+		done x=1 awk ${HOME} cd readonly $(pwd) grep grep echo ${HOME} -eu awk local local
+| export /usr/bin && sed -eu cd
+	local x=1 $(pwd) sed readonly sed 2>/dev/null local ${HOME} "$@" /usr/bin
+awk $(pwd) local test grep 'quoted text'
+		then echo then grep 'quoted text' && ${HOME} grep
+	/usr/bin readonly done test readonly -eu $(pwd) local then
+then awk sed export grep 2>/dev/null
+	local ${HOME} ${HOME} $(pwd) && awk then --verbose
+sed /usr/bin --verbose "$@" 2>/dev/null test $(pwd)
+		printf grep printf "$@" then local then
+readonly ${HOME} then
+		--verbose && "$1" ${HOME} then done local "$1" ${HOME} "$1" /usr/bin -eu cd &&
+	2>/dev/null test awk test then && cd "$1" x=1 && && ${HOME}
+	&& test && -eu printf "$1" awk then sed sed "$1" test "$1"
+	done $(pwd) grep then --verbose test
+		printf test export x=1 -eu /usr/bin 'quoted text' printf
+		"$@" echo awk ${HOME}
+	"$@" /usr/bin ${HOME} echo $(pwd) readonly echo ${HOME} awk $(pwd) export
+		-eu 'quoted text' export printf grep sed |
+	$(pwd) x=1 --verbose -eu sed readonly
+${HOME} /usr/bin printf
+local && "$1" sed x=1 readonly local $(pwd) echo "$@" "$1" && /usr/bin 'quoted text'
+	$(pwd) && cd done local x=1 local | export
+		| "$1" --verbose printf export then ${HOME} echo local awk
+cd awk -eu ${HOME} printf | | --verbose 2>/dev/null | --verbose export
+awk -eu 'quoted text' $(pwd) printf "$1" awk cd --verbose -eu then done printf
+		export 'quoted text' test "$1" export
+	local cd then 'quoted text'
+grep grep done awk done | 'quoted text' cd
+"$1" readonly && export
+		sed ${HOME} cd "$@" | sed &&
+	cd sed ${HOME} ${HOME} /usr/bin -eu
+local -eu ${HOME} readonly /usr/bin "$@"
+		printf readonly ${HOME} 'quoted text' export readonly export
+/usr/bin | export awk "$@" 2>/dev/null
+then -eu cd test ${HOME} /usr/bin export awk --verbose 2>/dev/null
+		&& x=1 x=1 echo /usr/bin "$@" /usr/bin local then printf $(pwd) && readonly awk
+		printf echo | ${HOME} printf 'quoted text'
+&& readonly export "$1" awk readonly
+		-eu then test awk echo x=1 test | local echo then cd |
+		printf -eu awk /usr/bin |
+	/usr/bin 'quoted text' grep 'quoted text'
+	-eu -eu then test --verbose
+		/usr/bin | 'quoted text'
+		echo export -eu local --verbose /usr/bin &&
+	local grep awk local $(pwd) "$1" done "$@" done $(pwd) grep printf ${HOME}
+	--verbose && x=1 done
+	"$1" printf --verbose test "$1" grep test readonly && 'quoted text' export grep
+		local ${HOME} printf sed /usr/bin
+		'quoted text' then --verbose then /usr/bin printf
+	| cd sed "$1" cd test grep /usr/bin export 2>/dev/null --verbose "$1" ${HOME} awk
+	echo test test echo --verbose 'quoted text' --verbose | export awk local cd
+	&& $(pwd) sed echo grep | cd grep awk x=1 test 'quoted text' test
+		${HOME} grep && /usr/bin awk sed x=1 readonly --verbose export readonly test local
+	${HOME} grep printf $(pwd) /usr/bin x=1 local then echo && export
+		"$@" cd local test printf
+export "$1" ${HOME} --verbose -eu --verbose readonly sed $(pwd)
+		2>/dev/null grep x=1 grep && sed cd -eu then --verbose "$@" -eu awk test &&
+sed cd "$1" test "$1" "$1" cd export $(pwd)
+		$(pwd) sed && "$1" /usr/bin
+		awk x=1 sed echo 'quoted text' 2>/dev/null 2>/dev/null
+	"$1" sed export cd grep echo
+then /usr/bin then printf
+		done -eu 'quoted text' "$@" grep "$@" printf 2>/dev/null awk awk printf
+	$(pwd) 'quoted text' echo 'quoted text'
+		'quoted text' 2>/dev/null cd echo --verbose "$@"
+	printf -eu /usr/bin grep -eu x=1 readonly export grep 2>/dev/null
+		--verbose ${HOME} --verbose "$1" /usr/bin echo 'quoted text'
+	'quoted text' ${HOME} readonly 'quoted text' done echo
+"$1" awk local --verbose --verbose /usr/bin 2>/dev/null ${HOME} echo grep
+export readonly "$@" sed printf --verbose -eu "$1" printf
+"$1" grep | --verbose 2>/dev/null printf --verbose 2>/dev/null
+"$1" done "$1" ${HOME} readonly && 2>/dev/null
+	/usr/bin grep cd /usr/bin sed
+export ${HOME} ${HOME} "$1" /usr/bin
+	grep | awk ${HOME} readonly printf 2>/dev/null 2>/dev/null "$1"
+'quoted text' cd done x=1 local cd export readonly && -eu test | readonly
+echo export then $(pwd) readonly export 2>/dev/null
+	readonly $(pwd) then sed printf readonly local local
+		"$1" readonly echo done awk done readonly 'quoted text'
+'quoted text' done awk done -eu done then done x=1
+export local then --verbose
+		--verbose 2>/dev/null grep $(pwd) 2>/dev/null
+awk && awk test -eu 2>/dev/null ${HOME} cd ${HOME} then "$@" 'quoted text'
+echo local && 2>/dev/null
+printf test cd test printf then sed "$1" then then $(pwd)
+		x=1 done done | readonly done grep "$1" x=1 export | --verbose --verbose done
+${HOME} && -eu -eu readonly --verbose local cd "$@" | sed cd sed readonly "$@"
+echo grep && 'quoted text' printf "$1" readonly --verbose "$1"
+		2>/dev/null x=1 done && $(pwd)
+	printf && 2>/dev/null awk 'quoted text' x=1
+	&& sed x=1 grep 'quoted text' done 2>/dev/null /usr/bin cd grep done local
+cd "$@" export --verbose done printf export local test local --verbose
+readonly sed --verbose printf x=1 readonly export "$1" x=1
+	export /usr/bin | then /usr/bin $(pwd) --verbose
+		test && awk && /usr/bin "$@" -eu readonly test
+		x=1 'quoted text' sed then x=1 local then 2>/dev/null
+	echo awk readonly readonly test ${HOME} then x=1 test x=1 /usr/bin test x=1 awk
+		printf local then grep x=1 -eu cd
+grep /usr/bin then then printf
+		done -eu 'quoted text' -eu 2>/dev/null
+	x=1 sed -eu /usr/bin local then --verbose --verbose
+	2>/dev/null sed && done 2>/dev/null |
+		-eu local then local export export $(pwd) | grep -eu | -eu | cd --verbose
+	readonly cd && && --verbose then awk export local grep echo local && 'quoted text'
+| local /usr/bin done /usr/bin
+local | && $(pwd) readonly awk $(pwd) --verbose "$@"
+		cd test /usr/bin awk 2>/dev/null "$@" -eu then
+| && 'quoted text' export printf sed 2>/dev/null
+	export --verbose export "$@" awk x=1
+		&& test local local --verbose 'quoted text' then sed "$@" $(pwd) test
+		${HOME} /usr/bin echo grep
+		-eu done | export -eu echo ${HOME}
+| local x=1 echo local 2>/dev/null grep echo 2>/dev/null sed sed echo --verbose
+"$1" export $(pwd) /usr/bin "$@" export ${HOME} sed "$1" x=1 grep cd
+		then $(pwd) x=1 'quoted text' | local --verbose -eu
+		awk then sed then sed cd then readonly done export ${HOME}
+	"$1" && -eu export ${HOME}
+		export local "$1" --verbose grep -eu export grep sed -eu | grep done
+	'quoted text' --verbose sed grep
+		${HOME} done | | then
+		"$@" -eu then printf /usr/bin test "$1" x=1 printf local test cd sed test local
+sed grep done cd local grep /usr/bin echo cd x=1 $(pwd) "$@" 2>/dev/null local
+	--verbose sed $(pwd) awk done awk awk --verbose $(pwd)
+	awk -eu export cd sed readonly /usr/bin
+		printf test "$1" awk readonly cd done ${HOME} -eu
+		2>/dev/null echo x=1
+	"$@" local --verbose local 2>/dev/null
+"$@" sed test echo && local && --verbose local && awk 'quoted text'
+	cd "$@" local $(pwd) cd test /usr/bin ${HOME} local 2>/dev/null readonly
+		$(pwd) echo | echo printf
+	echo test echo /usr/bin done x=1 cd sed x=1 then /usr/bin && readonly --verbose
+${HOME} cd ${HOME} "$1" 'quoted text'
+	--verbose then echo ${HOME}
+		grep 2>/dev/null && 'quoted text' 2>/dev/null
+local 'quoted text' printf local 'quoted text'
+		"$1" then | x=1 echo -eu 'quoted text'
+	-eu test done readonly cd /usr/bin local local | test "$1" test
+		&& /usr/bin then echo ${HOME}
+	readonly -eu 2>/dev/null
+x=1 export | | && grep $(pwd) local $(pwd) ${HOME} done
+	&& "$1" $(pwd) sed test 2>/dev/null grep
+		"$@" sed 2>/dev/null test $(pwd) done then /usr/bin | grep "$@" ${HOME} echo
+$(pwd) --verbose 2>/dev/null printf grep "$@" && "$@" $(pwd) 2>/dev/null
+x=1 $(pwd) grep 'quoted text' ${HOME} 'quoted text' "$1" readonly
+		local echo 2>/dev/null -eu
+		-eu $(pwd) "$@" /usr/bin
+&& && local local grep --verbose $(pwd) x=1 && "$1"
+then $(pwd) echo grep -eu awk echo
+done "$@" $(pwd) printf awk -eu -eu local x=1 $(pwd) readonly "$1" 2>/dev/null
+		2>/dev/null 2>/dev/null "$1" /usr/bin readonly x=1 grep && done 2>/dev/null
+		readonly export --verbose done printf "$@" 'quoted text' "$@" --verbose
+2>/dev/null grep "$@" && done 2>/dev/null
+"$1" -eu | --verbose export
+	printf sed done 2>/dev/null $(pwd)
+-eu printf export echo done && 2>/dev/null 'quoted text' "$@"
+		2>/dev/null 'quoted text' 2>/dev/null readonly
+	local export "$1" ${HOME} -eu 2>/dev/null sed grep /usr/bin x=1 local printf
+done | | local done export cd -eu ${HOME} cd grep done && /usr/bin readonly
+&& test printf done done 'quoted text' --verbose $(pwd) ${HOME} "$@"
+	grep grep x=1 cd 2>/dev/null x=1 test sed awk grep local then "$1"
+		sed grep 'quoted text' export
+| /usr/bin --verbose --verbose sed grep /usr/bin printf 2>/dev/null printf
+	x=1 printf -eu ${HOME}
+		"$@" then 'quoted text' readonly 2>/dev/null cd "$@"
+	cd test local then -eu test "$1" 2>/dev/null
+awk x=1 ${HOME} && "$@" printf
+		--verbose -eu done local sed cd /usr/bin
+test cd /usr/bin --verbose then local /usr/bin ${HOME} test echo
+	2>/dev/null done --verbose sed
+/usr/bin readonly awk awk "$1" echo local export
+		/usr/bin && export /usr/bin echo 2>/dev/null
+	then $(pwd) then -eu "$1"
+		| && && cd echo x=1 "$@" /usr/bin
+grep echo sed ${HOME} readonly
+	/usr/bin echo && "$@" "$@" readonly
+		grep awk sed 2>/dev/null export
+		printf done x=1 "$1" test x=1 printf echo readonly local then x=1 --verbose -eu
+	"$1" cd --verbose ${HOME} $(pwd) -eu "$@" ${HOME} readonly 2>/dev/null
+		2>/dev/null x=1 echo ${HOME} echo echo 'quoted text' local printf
+		sed 'quoted text' grep grep local "$@"
+		awk | cd x=1 readonly | local readonly
+	"$1" $(pwd) awk awk && grep --verbose "$@" test local "$@" local sed | readonly
+		$(pwd) local $(pwd) "$@" "$@" ${HOME} printf grep && export then awk
+	x=1 'quoted text' $(pwd) echo sed export "$@"
+"$1" echo test done local printf done printf test export && "$@"
+		&& ${HOME} && $(pwd) | done && ${HOME} && 2>/dev/null done awk "$@"
+cd 2>/dev/null sed /usr/bin export
+		readonly /usr/bin -eu $(pwd) 2>/dev/null awk -eu test
+grep readonly && export | printf then local readonly
+		--verbose test printf ${HOME} x=1 /usr/bin x=1 --verbose "$@" 'quoted text'
+	"$1" test 'quoted text' sed done 'quoted text' -eu test -eu 'quoted text'
+		/usr/bin --verbose then $(pwd)
+	"$@" -eu cd printf sed test done /usr/bin printf export then
+	x=1 $(pwd) -eu "$1" 2>/dev/null awk awk --verbose printf "$1" test -eu
+	grep "$1" "$@" 'quoted text' then --verbose /usr/bin done
+		test | cd export | x=1 'quoted text'
+	--verbose then ${HOME} sed local grep -eu $(pwd) local ${HOME} $(pwd)
+		&& ${HOME} "$1" "$1" -eu && $(pwd) ${HOME} /usr/bin
+	2>/dev/null cd "$@" then local /usr/bin x=1 | 'quoted text'
+-eu printf /usr/bin $(pwd)
+		-eu then printf printf done cd "$1"
+printf cd /usr/bin done echo && && /usr/bin sed awk "$1" echo && echo
+	sed 2>/dev/null /usr/bin echo
+	x=1 -eu grep 'quoted text' && readonly local x=1 readonly done sed --verbose
+		printf sed /usr/bin awk printf ${HOME} grep ${HOME} /usr/bin
+sed 'quoted text' 'quoted text' /usr/bin then -eu
+		'quoted text' 'quoted text' echo /usr/bin x=1 export grep grep
+		"$1" $(pwd) 2>/dev/null test "$@" "$@" test "$@" cd done awk --verbose
+awk "$@" then cd && cd 2>/dev/null printf "$1" cd local 'quoted text' 'quoted text'
+	$(pwd) sed test $(pwd) export printf --verbose readonly
+	printf export && "$1" readonly 2>/dev/null
+		--verbose -eu local | local
+		$(pwd) ${HOME} export && export then
+	--verbose x=1 --verbose 'quoted text'
+		awk sed "$@" 2>/dev/null done -eu | ${HOME} ${HOME} ${HOME}
+	&& export then done $(pwd) $(pwd) local -eu then
+-eu export done && "$@" then | | --verbose --verbose sed -eu
+	x=1 echo x=1 -eu test "$@" readonly cd sed -eu 2>/dev/null -eu local export &&
+	grep ${HOME} readonly 2>/dev/null grep ${HOME} | "$@" export test -eu
+		$(pwd) echo printf x=1 'quoted text' "$1" readonly sed awk local /usr/bin
+	$(pwd) "$@" cd printf readonly "$@" "$1" echo test "$1" grep sed -eu
+	local --verbose 'quoted text' | grep "$1" ${HOME} sed x=1 "$1"
+		2>/dev/null sed --verbose
+	awk 'quoted text' --verbose $(pwd) test awk echo done | && local
+		then /usr/bin x=1 printf readonly "$@" sed
+	awk echo done export "$@" "$1" --verbose 'quoted text'
+	awk 2>/dev/null local -eu readonly done 2>/dev/null -eu echo grep
+/usr/bin --verbose "$@" /usr/bin export
+	"$1" 'quoted text' then awk && cd $(pwd) echo
+	cd $(pwd) done 'quoted text' $(pwd) done local ${HOME}
+then test $(pwd) grep | $(pwd) cd $(pwd) then readonly
+then done sed --verbose ${HOME} readonly
+$(pwd) /usr/bin readonly --verbose x=1
+		"$@" export 2>/dev/null sed "$@" then local && sed printf done | 2>/dev/null
+		"$1" cd done --verbose x=1 local ${HOME} echo -eu cd 2>/dev/null
+	2>/dev/null readonly -eu readonly
+sed then cd printf --verbose done 2>/dev/null x=1 -eu && ${HOME} | "$1" && then
+	done awk done && && 2>/dev/null 'quoted text' readonly test printf && echo -eu
+"$@" done awk printf cd
+&& test then grep export test printf
+'quoted text' ${HOME} "$@" 'quoted text' local | -eu done echo
+grep 'quoted text' $(pwd) "$1" --verbose
+	local -eu cd "$@" --verbose $(pwd) && 'quoted text' &&
+		then --verbose 2>/dev/null test ${HOME} "$@"
+	then "$1" done cd grep /usr/bin test -eu printf /usr/bin
+2>/dev/null | export 2>/dev/null
+	&& readonly /usr/bin done export "$@" done
+	--verbose local done then $(pwd)
+		| cd ${HOME} done | then export --verbose
+		x=1 2>/dev/null 2>/dev/null /usr/bin ${HOME} x=1 "$@" then | awk
+	$(pwd) --verbose export && x=1 export export cd echo done echo
+	done grep | -eu local echo x=1 test x=1 ${HOME}
+	"$@" done echo "$@" 'quoted text' 'quoted text' done done sed "$@"
+		&& $(pwd) /usr/bin readonly export x=1 && ${HOME} local
+local 'quoted text' 'quoted text' $(pwd)
+2>/dev/null | ${HOME} ${HOME}
+		done $(pwd) --verbose readonly "$@" grep local ${HOME} /usr/bin
+		x=1 --verbose then cd grep awk then 'quoted text' -eu "$@"
+x=1 export 'quoted text' local ${HOME}
+	| --verbose awk | "$1" export readonly $(pwd) &&
+		| x=1 done sed --verbose ${HOME} then cd
+		sed "$1" printf "$1" ${HOME} $(pwd)
+printf x=1 awk cd cd awk /usr/bin echo
+		2>/dev/null --verbose then && $(pwd) awk $(pwd) awk grep
+	2>/dev/null -eu local then echo 'quoted text' &&
+		&& readonly test local local 'quoted text' --verbose "$@" -eu
+		/usr/bin local "$@" sed $(pwd) x=1 'quoted text' cd
+local echo && 'quoted text' "$@" cd done --verbose printf x=1
+2>/dev/null readonly cd "$@" export
+		printf printf printf echo "$1" $(pwd) -eu printf 2>/dev/null done grep
+--verbose --verbose /usr/bin done && | export
+sed test && cd /usr/bin ${HOME} --verbose "$1" export ${HOME}
+	awk awk then 'quoted text'
+	&& ${HOME} ${HOME} && --verbose then
+	--verbose $(pwd) | readonly -eu | printf done
+cd awk /usr/bin "$1" --verbose then
+		/usr/bin /usr/bin printf printf x=1 printf
+	done /usr/bin sed grep $(pwd) grep $(pwd)
+		echo local --verbose | awk awk $(pwd) then -eu cd done 2>/dev/null cd grep
+	x=1 | $(pwd) $(pwd) 2>/dev/null $(pwd) test
+"$1" ${HOME} ${HOME} sed /usr/bin awk cd 'quoted text'
+		${HOME} | x=1 2>/dev/null && && --verbose
+	&& sed $(pwd) $(pwd) awk sed 'quoted text' "$1" ${HOME} readonly
+	"$1" done x=1 /usr/bin done -eu $(pwd)
+	| "$@" then /usr/bin echo cd export 'quoted text' && 'quoted text' x=1 x=1 cd
+	test then grep && "$@" echo "$1" $(pwd)
+${HOME} test then awk && readonly local test 2>/dev/null cd | readonly awk echo
+done local --verbose grep readonly
+$(pwd) -eu readonly test | then 2>/dev/null "$@" grep /usr/bin echo export
+	readonly && -eu x=1 sed -eu grep
+cd grep awk done test export && sed $(pwd) /usr/bin awk /usr/bin
+		sed then local "$1" 'quoted text' grep done printf then
+	awk done -eu grep awk "$@" test --verbose x=1 local --verbose done awk
+	cd echo cd echo | export test /usr/bin
+	local grep "$@" echo printf | --verbose
+		test test test grep ${HOME} | $(pwd) cd -eu 'quoted text' done /usr/bin
+	readonly sed grep --verbose done "$1" 2>/dev/null
+sed | | then readonly --verbose $(pwd) echo | | 'quoted text'
+	"$@" done | | "$1" readonly
+"$1" grep 'quoted text' cd "$1" cd local then $(pwd) export
+		/usr/bin /usr/bin 2>/dev/null ${HOME} 'quoted text' export sed echo export
+	-eu grep ${HOME} 'quoted text' $(pwd) then 2>/dev/null printf
+cd x=1 /usr/bin done
+	| 2>/dev/null local then then local ${HOME} printf readonly
+		--verbose grep /usr/bin
+test sed readonly awk
+	"$1" test echo export && cd local /usr/bin sed x=1 "$@" &&
+		$(pwd) done -eu /usr/bin readonly $(pwd)
+cd 'quoted text' | sed sed ${HOME} readonly -eu "$@" done cd -eu ${HOME}
+	x=1 awk 'quoted text' test export 'quoted text'
+then test && test "$1" export sed then "$@" echo readonly then
+	then echo x=1 export export test
+	${HOME} 2>/dev/null /usr/bin done cd export --verbose echo test -eu --verbose
+		| && /usr/bin $(pwd) | x=1 readonly readonly
+	cd cd ${HOME} local awk "$1" awk export done /usr/bin ${HOME} -eu | cd then 2>/dev/null
+test 2>/dev/null && $(pwd) cd --verbose sed export echo 2>/dev/null
+	cd then 'quoted text' sed grep then ${HOME} done --verbose awk echo /usr/bin
+2>/dev/null then readonly local done 2>/dev/null test --verbose
+	2>/dev/null 2>/dev/null ${HOME} && | && 2>/dev/null
+${HOME} x=1 cd export --verbose then printf test
+		then sed -eu 'quoted text' $(pwd)
+	done $(pwd) "$1" local export -eu "$1" 'quoted text'
+	&& then printf export local 'quoted text'
+		export grep done | $(pwd) grep ${HOME} -eu | 'quoted text'
+| printf -eu -eu export
+"$1" grep grep local ${HOME}
+--verbose && test done 2>/dev/null
+	"$@" local readonly sed /usr/bin export grep "$@"
+		${HOME} x=1 /usr/bin "$@" printf cd --verbose export && sed echo readonly
+	test local ${HOME} $(pwd) 2>/dev/null readonly cd awk "$1" sed
+&& /usr/bin x=1 awk | 2>/dev/null "$@" -eu
+readonly done readonly "$1" x=1 -eu then
+test awk printf $(pwd) && "$1" echo echo x=1 grep grep
+printf "$@" cd 'quoted text' 'quoted text' then
+	test && 'quoted text' echo local local echo done done done $(pwd) sed
+	/usr/bin && | sed export readonly test grep sed then done | |
+| 2>/dev/null sed x=1 local
+		cd -eu x=1 awk then 'quoted text' $(pwd) local $(pwd) | test
+	-eu then awk printf then -eu $(pwd) test /usr/bin local --verbose echo /usr/bin
+		&& grep readonly test done -eu grep $(pwd) -eu
+		awk "$1" | | echo 'quoted text' | echo sed /usr/bin
+	${HOME} && echo echo printf 2>/dev/null
+	${HOME} "$1" grep test
+		-eu --verbose 'quoted text' awk then $(pwd) echo sed readonly awk && done
+		then ${HOME} $(pwd) ${HOME} ${HOME} | sed cd /usr/bin x=1 ${HOME} cd --verbose
+echo awk 'quoted text' awk ${HOME} echo
+		test -eu 2>/dev/null readonly
+		"$1" && /usr/bin /usr/bin && test printf | awk "$@"
+		export "$@" grep cd export test x=1 ${HOME}
+sed | -eu "$1" test then test | /usr/bin $(pwd) 2>/dev/null ${HOME} --verbose
+		test --verbose then -eu grep x=1 done done
+		awk readonly 2>/dev/null awk
+export --verbose && -eu -eu echo grep | done then
+printf grep -eu | 2>/dev/null 'quoted text' printf echo
+sed export printf "$1" local 2>/dev/null done && |
+		"$@" then 2>/dev/null sed ${HOME} 'quoted text' local && then --verbose | "$@" 2>/dev/null
+	readonly x=1 "$1" awk /usr/bin awk 'quoted text'
+2>/dev/null done && sed printf cd test
+		awk then done /usr/bin 'quoted text' readonly 'quoted text' cd 'quoted text'
+		&& cd ${HOME} 2>/dev/null
+	test grep awk $(pwd) cd $(pwd) "$@" local /usr/bin sed ${HOME}
+	| "$@" printf | awk test $(pwd)
+readonly printf 2>/dev/null 2>/dev/null export grep | /usr/bin awk printf export
+done /usr/bin --verbose 'quoted text' grep 2>/dev/null echo
+		then grep ${HOME} "$@" x=1 export $(pwd)
+	--verbose echo awk test done export -eu grep -eu &&
+		awk sed "$1" echo "$1" -eu /usr/bin ${HOME}
+	readonly then | cd grep ${HOME}
+	&& 'quoted text' local x=1 $(pwd) awk
+&& ${HOME} --verbose --verbose 'quoted text' --verbose "$1" "$@" cd
+	echo "$@" echo 2>/dev/null /usr/bin
+grep /usr/bin -eu sed /usr/bin readonly grep then sed && /usr/bin x=1 then
+	printf done $(pwd) -eu done "$@" grep grep
+	"$1" -eu /usr/bin --verbose test awk test ${HOME} cd then --verbose --verbose sed
+then echo test sed awk x=1 -eu 2>/dev/null awk x=1 /usr/bin echo x=1 printf
+	local -eu ${HOME} "$@" && printf
+/usr/bin awk --verbose export /usr/bin && echo printf sed --verbose export -eu /usr/bin
+$(pwd) x=1 "$@" cd echo readonly -eu cd test "$1" export done readonly
+		local | 'quoted text' awk cd "$1" cd ${HOME} test
+		${HOME} -eu test | grep 2>/dev/null
+		echo printf then ${HOME}
+		${HOME} cd /usr/bin awk export cd && done
+	done --verbose echo then x=1 grep sed
+		grep $(pwd) 'quoted text' | "$1"
+		cd printf export sed x=1 | | export then /usr/bin $(pwd) done readonly
+		'quoted text' --verbose | 2>/dev/null -eu cd awk
+	echo cd readonly $(pwd) $(pwd)
+echo then -eu printf export cd local export grep $(pwd) test x=1
+then awk $(pwd) 2>/dev/null awk "$@" -eu sed $(pwd) $(pwd) "$1" grep
+grep local local 'quoted text' echo /usr/bin
+local 'quoted text' local grep ${HOME} awk echo local "$1" "$@" /usr/bin
+$(pwd) test -eu 2>/dev/null $(pwd) awk ${HOME}
+	'quoted text' && x=1 --verbose cd echo
+		| | 2>/dev/null --verbose && test echo readonly /usr/bin $(pwd)
+		printf local local export /usr/bin then | -eu -eu "$1" x=1 cd ${HOME} sed cd
+		-eu test then local readonly -eu && awk 2>/dev/null | 2>/dev/null "$@" test
+echo 'quoted text' echo 2>/dev/null
+		done /usr/bin printf echo x=1 'quoted text' --verbose $(pwd) --verbose cd
+	x=1 grep export done cd cd "$1" cd 2>/dev/null test /usr/bin done
+		/usr/bin echo 2>/dev/null readonly grep
+	grep echo then awk readonly ${HOME} /usr/bin
+		&& $(pwd) | "$1" ${HOME} sed export echo && local then --verbose
+		local echo "$@" export "$@" awk | printf done /usr/bin export
+	done "$1" cd -eu && printf sed $(pwd) | printf grep ${HOME}
+		printf local 2>/dev/null readonly echo 'quoted text'
+$(pwd) cd awk --verbose readonly grep export export $(pwd) sed done done 2>/dev/null
+2>/dev/null $(pwd) done | --verbose
+		grep | /usr/bin grep ${HOME} ${HOME} then local grep awk awk 'quoted text'
+--verbose 'quoted text' echo done awk
+		test 2>/dev/null local
+test readonly local then && awk --verbose --verbose readonly /usr/bin && awk
+	printf cd -eu x=1 x=1 awk 'quoted text' readonly "$1" done printf echo
+	x=1 readonly awk local "$@" && -eu export awk printf sed | then /usr/bin 'quoted text'
+	cd awk sed test test printf readonly && printf local grep ${HOME}
+		awk -eu awk ${HOME} $(pwd) x=1 awk -eu -eu | 2>/dev/null
+| 2>/dev/null 'quoted text' grep x=1 local test 2>/dev/null x=1 cd local export
+		done printf local $(pwd) "$1" --verbose export printf grep
+		2>/dev/null test /usr/bin
+	export grep done test 'quoted text' ${HOME}
+export printf grep "$@" $(pwd) awk --verbose && $(pwd)
+export printf x=1 grep echo 'quoted text' ${HOME} then then $(pwd)
+		&& readonly $(pwd) && then ${HOME} echo local awk $(pwd) | test echo "$@" grep
+grep export cd done 2>/dev/null readonly /usr/bin
+-eu ${HOME} 2>/dev/null --verbose cd --verbose --verbose export "$1" done awk |
+		then | $(pwd) grep 'quoted text' ${HOME} $(pwd) 2>/dev/null
+--verbose cd -eu "$@" 2>/dev/null -eu && /usr/bin
+		"$@" printf echo 'quoted text' grep
+export echo grep sed | 2>/dev/null grep export
+		"$1" "$1" 'quoted text' local test grep echo readonly cd printf done
+	printf && local echo echo -eu -eu $(pwd)
+| test "$1" $(pwd) --verbose then -eu | ${HOME} sed printf 'quoted text'
+		$(pwd) "$1" echo && 2>/dev/null printf sed test local "$1" then x=1 grep echo echo
+		| 'quoted text' echo awk local $(pwd)
+	/usr/bin && $(pwd) ${HOME} sed sed grep
+grep && "$@" "$@" printf "$@" readonly then printf sed then
+	&& ${HOME} "$1" printf printf
+	2>/dev/null then x=1 -eu
+		-eu "$1" | x=1 -eu cd |
+done export readonly cd $(pwd) --verbose /usr/bin "$1" "$@"
+		echo awk 2>/dev/null local && 2>/dev/null
+	local | local x=1 readonly grep | 2>/dev/null
+${HOME} readonly printf awk done grep sed sed "$@" && /usr/bin "$1" $(pwd) | /usr/bin
+awk grep then 'quoted text' local cd
+	export printf awk printf "$@" done --verbose
+x=1 done local 2>/dev/null local sed test -eu | readonly ${HOME}
+		x=1 export "$@" awk grep -eu cd grep /usr/bin local $(pwd)
+	printf export test x=1 local printf
+		${HOME} | "$@" test ${HOME} printf printf test && x=1
+sed --verbose "$@" printf cd | -eu export "$1"
+		awk then $(pwd) "$1" readonly $(pwd)
+	local export export local 2>/dev/null /usr/bin
+	local test grep "$@" "$1" 'quoted text' x=1 done 'quoted text'
+	2>/dev/null cd cd export -eu ${HOME} $(pwd) /usr/bin -eu printf -eu ${HOME}
+		cd readonly readonly done "$1" --verbose "$1" --verbose
+cd --verbose 2>/dev/null | "$1" "$1" test "$@"
+/usr/bin grep /usr/bin /usr/bin x=1 -eu "$1" export test -eu /usr/bin
+		printf then grep && sed && 2>/dev/null "$@" done awk x=1 readonly echo printf x=1
+	export $(pwd) --verbose
+	--verbose then local grep export done x=1 printf 'quoted text' /usr/bin
+		"$@" && 'quoted text' "$@" grep
+		then echo 2>/dev/null /usr/bin
+	local 2>/dev/null export then | local 2>/dev/null x=1 then sed awk test
+export echo cd printf x=1 cd export awk "$1" -eu "$@" 'quoted text' then
+	| $(pwd) sed $(pwd) local export
+		x=1 'quoted text' printf | test | "$1" echo x=1 $(pwd) "$@"
+test | test local && echo export 'quoted text' then && readonly grep 2>/dev/null
+test export awk awk "$@" then && "$1" x=1
+#include c77.sh
+	&& $(pwd) printf export test /usr/bin test
+		export done --verbose cd cd --verbose
+'quoted text' ${HOME} local /usr/bin | printf
+		export $(pwd) printf --verbose x=1 --verbose --verbose readonly test
+"$1" /usr/bin --verbose /usr/bin -eu -eu test grep sed grep x=1 grep
+		$(pwd) && cd "$1" export sed echo "$1"
+then $(pwd) "$1" x=1 /usr/bin
+	test done local awk /usr/bin test | "$1" | --verbose x=1 then then 'quoted text'
+	| -eu test | /usr/bin then then printf cd $(pwd) --verbose
+		| cd echo 'quoted text' echo x=1 ${HOME} local | $(pwd) test --verbose x=1
+	cd cd then /usr/bin | export grep local then done -eu
+"$@" test --verbose x=1 $(pwd)
+		--verbose | done | ${HOME} "$1" x=1 echo && sed --verbose test
+		local sed test 2>/dev/null --verbose echo awk 2>/dev/null
+-eu sed "$1" /usr/bin "$1" then printf
+"$1" && done awk ${HOME} 'quoted text' -eu awk 'quoted text'
+| done ${HOME} printf cd awk -eu cd grep done test grep grep -eu ${HOME}
+	"$1" readonly sed "$@" $(pwd) done cd /usr/bin "$1" "$@" done cd grep 2>/dev/null
+export grep printf --verbose $(pwd) printf "$@"
+		"$@" x=1 -eu x=1 x=1 $(pwd) echo done
+		done --verbose /usr/bin local
+		then grep x=1 done 2>/dev/null then then --verbose sed cd readonly x=1 |
+$(pwd) $(pwd) $(pwd) awk grep "$1"
+	done done "$@" --verbose "$1" then -eu | grep "$@" done local --verbose awk --verbose
+		sed printf then export 'quoted text' printf x=1 x=1 | readonly ${HOME} sed
+		'quoted text' export local then 'quoted text'
+2>/dev/null cd && printf "$@" local
+"$1" printf then local "$@" x=1 export | awk test 'quoted text' then
+		then "$@" echo export readonly x=1
+		$(pwd) 'quoted text' then && local cd x=1 $(pwd) && "$1" readonly
+		echo --verbose cd grep
+	test $(pwd) readonly 'quoted text' awk --verbose -eu ${HOME} "$@"
+	test "$@" --verbose done then $(pwd) 2>/dev/null test &&
+echo /usr/bin printf "$1" export printf awk ${HOME} ${HOME} &&
+		readonly printf awk then "$1" awk readonly $(pwd)
+2>/dev/null "$@" 'quoted text' test "$1" $(pwd) 2>/dev/null
+	sed printf test ${HOME} awk x=1 done
+done awk 'quoted text' printf "$@" test /usr/bin readonly done local
+	awk local sed then $(pwd) | ${HOME} 2>/dev/null -eu --verbose --verbose
+		"$@" sed ${HOME} readonly "$@"
+	test test "$1" x=1 --verbose && |
+	/usr/bin x=1 cd "$@" && ${HOME} local &&
+	echo --verbose ${HOME} $(pwd) test readonly 'quoted text'
+sed export $(pwd) --verbose cd x=1 /usr/bin
+		$(pwd) test && printf 'quoted text'
+sed -eu 2>/dev/null | cd local local done
+printf test $(pwd) && printf | printf 'quoted text' printf sed -eu | local &&
+		test cd | && local echo 'quoted text' /usr/bin "$1" "$1" 'quoted text'
+	-eu sed test echo cd printf printf -eu ${HOME}
+x=1 x=1 'quoted text' $(pwd) sed cd /usr/bin
+		awk ${HOME} echo && "$1" sed grep -eu printf 2>/dev/null
+${HOME} local test /usr/bin readonly printf grep $(pwd) ${HOME} ${HOME} then ${HOME}
+x=1 && && local 2>/dev/null ${HOME} test $(pwd) --verbose readonly
+$(pwd) && test test grep ${HOME} && "$1" cd test awk ${HOME} then "$@"
+$(pwd) awk awk "$@" /usr/bin sed "$@" "$@" echo local $(pwd)
+"$@" export 'quoted text' | export local
+	"$@" cd echo test sed --verbose | /usr/bin | printf "$1" export $(pwd) awk
+	then x=1 -eu ${HOME} printf 'quoted text' export sed printf awk
+		-eu 'quoted text' export x=1 "$@" 'quoted text'
+		done && grep done "$@" ${HOME} awk --verbose $(pwd) $(pwd) --verbose "$@" test sed
+x=1 2>/dev/null $(pwd) $(pwd) grep "$1" 2>/dev/null
+	$(pwd) local -eu done readonly "$1" done | local awk local echo done "$@" x=1
+printf awk readonly grep awk awk 2>/dev/null printf export 'quoted text'
+/usr/bin -eu | -eu --verbose grep grep grep
+then 2>/dev/null && test printf export "$@" then | echo
+| /usr/bin 'quoted text' awk -eu "$1" 'quoted text'
+		sed export "$1" 'quoted text'
+/usr/bin $(pwd) export /usr/bin echo 'quoted text' cd
+-eu | cd export test sed readonly readonly test local done awk x=1 | ${HOME}
+		2>/dev/null -eu awk x=1 then ${HOME} grep "$1" local sed 'quoted text' done "$@"
+printf $(pwd) sed && test sed 2>/dev/null /usr/bin | -eu
+'quoted text' cd sed && /usr/bin test grep x=1
+		| | cd | "$1" ${HOME} done cd --verbose
+	${HOME} | awk export test
+	cd x=1 cd "$1" ${HOME} | sed "$@" grep export cd readonly
+	cd /usr/bin ${HOME} "$@" sed sed test 2>/dev/null ${HOME}
+test echo sed $(pwd) -eu ${HOME} readonly /usr/bin
+	done 2>/dev/null $(pwd) cd -eu -eu
+		/usr/bin ${HOME} done &&
+	export 'quoted text' "$1" ${HOME} $(pwd) -eu echo "$1" -eu --verbose | then "$@"
+-eu done test "$1" cd "$1"
+$(pwd) awk 2>/dev/null printf sed awk echo
+	'quoted text' export export
+		done printf test --verbose
+echo -eu | /usr/bin then
+		export "$1" cd grep 'quoted text'
+		&& ${HOME} sed && local readonly
+		then --verbose $(pwd) /usr/bin printf ${HOME} readonly 'quoted text'
+		grep $(pwd) $(pwd) 'quoted text' export sed then ${HOME} readonly
+x=1 2>/dev/null ${HOME} --verbose $(pwd) sed export 2>/dev/null local -eu readonly
+	cd test cd sed echo grep "$@" awk "$@"
+	cd 'quoted text' grep x=1 test $(pwd) readonly awk test 2>/dev/null
+	export "$@" readonly $(pwd) 'quoted text' export
+"$@" 'quoted text' 2>/dev/null -eu printf
+		cd grep cd 'quoted text' printf
+		x=1 2>/dev/null export 'quoted text' | && "$@" echo echo
+	grep printf 'quoted text' | printf cd grep then local grep then printf /usr/bin
+		"$1" cd x=1 /usr/bin readonly test
+-eu x=1 "$1" -eu && | --verbose && x=1 test x=1 $(pwd) export
+		export local readonly ${HOME} cd export
+| "$1" ${HOME} 2>/dev/null
+	"$@" done then grep 'quoted text' | test x=1 grep x=1 done | export
+		grep x=1 printf "$@" sed 'quoted text' "$1" readonly --verbose
+"$1" | $(pwd) then done export sed -eu test echo -eu -eu ${HOME}
+export readonly export &&
+	--verbose "$@" && 2>/dev/null
+		then -eu | export x=1 awk echo sed && awk echo
+	--verbose then ${HOME} done export
+	"$1" -eu awk 2>/dev/null then && awk $(pwd) x=1 echo $(pwd) local
+	local | then | 2>/dev/null
+		"$1" ${HOME} -eu 2>/dev/null 2>/dev/null 'quoted text' printf | done export -eu
+/usr/bin ${HOME} | && sed echo
+		&& export printf 2>/dev/null ${HOME} cd printf sed export readonly $(pwd)
+2>/dev/null done export done done $(pwd) test
+sed awk "$1" 'quoted text' done then cd /usr/bin cd local
+	printf && printf cd /usr/bin 2>/dev/null "$@" 'quoted text'
+	then && | --verbose "$@" test test ${HOME}
+	/usr/bin echo cd echo $(pwd)
+		done && -eu ${HOME} echo grep printf cd awk readonly 'quoted text' test
+		| done local | echo readonly "$@" /usr/bin | ${HOME} test | -eu ${HOME}
+		'quoted text' then x=1 2>/dev/null --verbose ${HOME} export grep
+	${HOME} /usr/bin $(pwd) --verbose export export test done local "$1" sed &&
+then 'quoted text' local done ${HOME} /usr/bin grep "$1" "$1" $(pwd) local cd
+	| && "$1" done then x=1 "$1" cd $(pwd)
+	echo cd awk "$@" printf grep 'quoted text' readonly
+	--verbose printf sed cd --verbose -eu printf sed | sed
+		x=1 ${HOME} export | local grep 2>/dev/null readonly
+'quoted text' sed echo 2>/dev/null done --verbose test x=1 readonly
+	then 2>/dev/null ${HOME} grep "$@" x=1 test cd local x=1 ${HOME} then -eu cd $(pwd)
+		x=1 sed x=1 local readonly 'quoted text' sed /usr/bin
+		local sed test -eu then readonly done echo /usr/bin
+"$@" local cd cd --verbose test --verbose
+	"$1" 'quoted text' echo grep $(pwd)
+	${HOME} readonly "$1" -eu
+done 'quoted text' cd --verbose awk --verbose test -eu cd $(pwd)
+		done --verbose sed awk local --verbose 2>/dev/null 2>/dev/null sed
+	"$@" cd 2>/dev/null grep test ${HOME} test test cd 2>/dev/null | export /usr/bin
+		grep 'quoted text' printf -eu -eu awk echo
+test ${HOME} cd --verbose $(pwd) sed ${HOME}
+		"$@" test test 'quoted text' ${HOME} printf | 2>/dev/null readonly -eu test
+		echo "$@" -eu "$@" then export
+	local x=1 --verbose --verbose printf ${HOME}
+		printf x=1 export export sed --verbose export "$@"
+		readonly 'quoted text' sed -eu $(pwd) -eu "$@" printf
+	export -eu $(pwd) "$1" cd
+local local x=1 printf grep then "$@" $(pwd) export $(pwd) test readonly --verbose
+	printf cd printf "$@" /usr/bin
+	done sed /usr/bin --verbose
+		/usr/bin done then $(pwd) ${HOME} 'quoted text' test then
+	${HOME} ${HOME} awk | awk ${HOME}
+2>/dev/null && "$@" -eu -eu echo then
+readonly 2>/dev/null test -eu /usr/bin
+	test 'quoted text' x=1 | echo /usr/bin
+printf readonly 2>/dev/null 2>/dev/null
+echo -eu local x=1 echo done
+cd cd && cd sed grep 2>/dev/null
+		2>/dev/null local test | awk grep
+	printf test x=1 local cd $(pwd) x=1
+		grep --verbose ${HOME} then ${HOME} readonly -eu "$@" | done awk printf
+test grep x=1 ${HOME} awk grep local sed printf
+		done printf cd sed ${HOME}
+'quoted text' /usr/bin "$1"
+		cd /usr/bin test ${HOME} done "$1" test && echo "$@" "$@" ${HOME}
+-eu "$@" then 2>/dev/null printf cd then | 'quoted text'
+done $(pwd) export "$1" "$@" echo grep ${HOME} readonly
+grep local then cd /usr/bin 2>/dev/null echo ${HOME} test grep && awk
+	readonly printf local 'quoted text'
+		x=1 readonly x=1 "$@" -eu | sed done -eu then 2>/dev/null
+	test sed ${HOME} 'quoted text'
+		$(pwd) --verbose done export
+echo "$@" 'quoted text' cd 'quoted text' "$@" grep
+	--verbose done ${HOME} x=1
+		"$1" test -eu awk then readonly local
+then /usr/bin readonly then $(pwd) /usr/bin -eu $(pwd) && grep awk cd -eu
+	2>/dev/null 2>/dev/null --verbose "$1" printf sed --verbose echo readonly 'quoted text'
+--verbose awk "$1" cd grep -eu test printf
+	"$1" -eu ${HOME} 'quoted text' then readonly echo 2>/dev/null
+		test cd && test "$@" && echo echo -eu printf cd printf readonly
+		"$1" test then $(pwd) "$@" then echo printf
+x=1 -eu | && test 'quoted text' 'quoted text'
+		| x=1 done cd x=1 'quoted text' -eu export "$@"
+		| grep readonly local && awk $(pwd) test test awk echo printf readonly x=1
+	done sed grep export awk test export --verbose
+grep printf export test
+		printf x=1 cd grep export /usr/bin local local | readonly 'quoted text'
+x=1 $(pwd) 2>/dev/null -eu test -eu /usr/bin "$@" /usr/bin ${HOME}
+${HOME} "$1" grep export grep cd grep /usr/bin &&
+awk cd "$1" 2>/dev/null test awk /usr/bin && "$@" 2>/dev/null $(pwd) export grep
+		then | x=1 sed "$1" -eu $(pwd) grep
+/usr/bin $(pwd) printf -eu -eu && 'quoted text' sed export --verbose 'quoted text'
+		x=1 printf | then grep sed then export
+export 2>/dev/null done export "$1" $(pwd) then /usr/bin done awk grep /usr/bin
+		| test "$@" 2>/dev/null 2>/dev/null then "$1" 2>/dev/null
+readonly x=1 sed done local 2>/dev/null
+		cd export done export grep readonly && export cd 'quoted text' 2>/dev/null -eu done
+		--verbose | "$1" test sed echo export "$1"
+		x=1 printf $(pwd) x=1 2>/dev/null grep && | grep test grep then --verbose
+	readonly && cd readonly printf echo readonly grep &&
+	grep 2>/dev/null awk $(pwd) x=1 "$@"
+'quoted text' echo "$1"
+&& then export /usr/bin cd x=1 export 'quoted text' grep
+done 2>/dev/null then awk
+		done 'quoted text' -eu sed export x=1 awk && grep done x=1 | -eu
+	done ${HOME} x=1 "$1" -eu echo 'quoted text'
+local export sed printf $(pwd) done test cd 'quoted text' export "$@"
+	&& echo echo /usr/bin 'quoted text' $(pwd) 'quoted text' /usr/bin 2>/dev/null
+		"$@" $(pwd) then $(pwd) -eu printf sed ${HOME} cd printf local
+'quoted text' done cd local
+		done -eu 'quoted text' awk "$@" 2>/dev/null
+	| then readonly export 2>/dev/null
+	--verbose $(pwd) cd 'quoted text' -eu cd 'quoted text' $(pwd) "$@" export
+test "$@" sed $(pwd) 'quoted text'
+		local 2>/dev/null local /usr/bin readonly
+-eu && --verbose cd 2>/dev/null "$1" awk 'quoted text' && echo readonly --verbose
+		$(pwd) export ${HOME} --verbose
+"$1" test 'quoted text' x=1 then grep | local "$1" -eu &&
+x=1 local ${HOME} x=1 "$@" | ${HOME} x=1 grep /usr/bin --verbose
+$(pwd) ${HOME} | && && --verbose | | sed printf
+	export $(pwd) -eu ${HOME} x=1 test sed printf then
+"$1" done -eu "$1" x=1 local awk /usr/bin
+	cd "$1" && && /usr/bin printf awk local --verbose
+-eu 'quoted text' "$@" test readonly /usr/bin sed cd --verbose
+local export done readonly echo ${HOME} sed readonly
+${HOME} test grep then "$1" sed readonly local
+		readonly "$@" $(pwd) | --verbose
+		| local "$@" | done | sed --verbose
+&& printf readonly $(pwd) | readonly
+	awk echo 'quoted text' -eu | then -eu local ${HOME} then 'quoted text'
+	done --verbose printf export echo then && readonly
+	sed export awk test done /usr/bin test ${HOME} done && && && $(pwd) printf 2>/dev/null
+	local x=1 "$1" | sed /usr/bin /usr/bin 2>/dev/null
+	2>/dev/null grep awk |
+		2>/dev/null 'quoted text'
+	test then -eu sed "$1" "$1" /usr/bin printf echo done echo $(pwd)
+	| 2>/dev/null done 2>/dev/null
+x=1 printf $(pwd) x=1 /usr/bin x=1 ${HOME}
+		printf -eu -eu 'quoted text' ${HOME}
+	export sed "$@" echo awk done | $(pwd)
+	awk /usr/bin export sed | then && grep cd
+	"$@" -eu then ${HOME} done echo awk cd $(pwd)
+	printf 'quoted text' then echo 'quoted text' done readonly
+	x=1 readonly test local grep | 'quoted text'
+	then awk /usr/bin && 'quoted text' $(pwd) 2>/dev/null grep cd -eu ${HOME}
+	printf done done --verbose printf
+	grep -eu export ${HOME} done "$1" 'quoted text' $(pwd) done -eu && grep done test
+	/usr/bin test 'quoted text'
+--verbose /usr/bin | export 2>/dev/null ${HOME} "$1" 'quoted text'
+		awk test readonly /usr/bin "$1" local grep printf
+done done readonly printf | "$@" sed 2>/dev/null
+		-eu --verbose -eu grep cd done "$1" ${HOME} $(pwd) "$@" then "$@" /usr/bin
+	export done then readonly --verbose && grep /usr/bin --verbose
+		${HOME} printf cd grep 2>/dev/null 'quoted text' 'quoted text'
+		--verbose -eu awk readonly | "$1" $(pwd) /usr/bin 2>/dev/null
+	| "$@" export --verbose | ${HOME} then
+	-eu x=1 /usr/bin readonly export x=1 done -eu grep "$@" 2>/dev/null
+		2>/dev/null --verbose /usr/bin done && /usr/bin cd ${HOME} readonly "$1"
+		sed $(pwd) cd test /usr/bin --verbose printf x=1 /usr/bin
+${HOME} then echo | printf test then sed sed
+awk -eu -eu | then 'quoted text'
+	test test 'quoted text' x=1
+	then awk test && $(pwd) 2>/dev/null readonly | test grep local "$@" 'quoted text'
+		| -eu test 2>/dev/null echo grep ${HOME} -eu | 'quoted text' /usr/bin /usr/bin
+	2>/dev/null ${HOME} then
+	awk echo sed | cd awk && local x=1 cd done done x=1 /usr/bin
+	'quoted text' printf 2>/dev/null --verbose cd x=1 echo awk
+	sed cd printf ${HOME} "$@" cd ${HOME} test && export && -eu --verbose
+test --verbose ${HOME} local --verbose echo && grep test $(pwd) | printf
+	${HOME} export readonly test ${HOME} echo grep printf
+		| done 2>/dev/null readonly && && "$@"
+echo 2>/dev/null ${HOME} --verbose --verbose 2>/dev/null
+		readonly sed 2>/dev/null then --verbose
+	2>/dev/null printf awk ${HOME} && sed then
+test /usr/bin --verbose printf done | /usr/bin sed readonly $(pwd) x=1
+readonly awk && | test | echo 2>/dev/null
+		awk echo x=1 done --verbose then test $(pwd) printf grep --verbose $(pwd) |
+	2>/dev/null readonly "$@" -eu 2>/dev/null 'quoted text' local test && /usr/bin
+	&& printf echo 2>/dev/null sed cd -eu
+	-eu then awk echo printf ${HOME} /usr/bin
+| readonly "$@" -eu test 'quoted text' printf cd printf -eu awk
+		"$1" grep "$@" x=1 ${HOME} /usr/bin then then local test "$@" readonly
+		--verbose "$@" $(pwd)
+	'quoted text' --verbose cd | -eu $(pwd) sed export $(pwd) x=1 printf $(pwd)
+	export 'quoted text' -eu awk test ${HOME} --verbose
+	export then export 'quoted text'
+'quoted text' /usr/bin echo then 2>/dev/null ${HOME} printf
+	'quoted text' export 'quoted text' 'quoted text' cd readonly --verbose
+	then sed export 'quoted text' 'quoted text' printf readonly | test
+		grep 'quoted text' readonly test /usr/bin /usr/bin x=1 "$1" ${HOME}
+$(pwd) -eu 2>/dev/null printf -eu awk
+		grep sed ${HOME} ${HOME} grep done local export --verbose
+&& cd printf /usr/bin "$1" awk sed x=1 echo | sed awk /usr/bin "$@"
+		local ${HOME} grep /usr/bin "$@" printf /usr/bin &&
+		export | /usr/bin cd 2>/dev/null $(pwd) --verbose local readonly test 2>/dev/null
+	| x=1 grep --verbose export cd 'quoted text'
+then awk -eu test readonly x=1 then readonly echo awk printf grep then
+	&& echo local | then test | echo printf printf sed local
+	${HOME} grep --verbose /usr/bin
+	done 2>/dev/null ${HOME} 2>/dev/null --verbose $(pwd) echo local
+	-eu echo | | cd cd && then --verbose export | readonly then then local awk readonly
+/usr/bin sed grep "$1" "$@" $(pwd) ${HOME}
+	&& cd ${HOME} -eu grep "$1" |
+	-eu -eu --verbose ${HOME}
+		&& /usr/bin printf sed export export "$1" 'quoted text'
+${HOME} sed 2>/dev/null | awk x=1 2>/dev/null readonly
+		sed | awk test 'quoted text' && printf 'quoted text'
+2>/dev/null test test test awk && -eu 2>/dev/null local --verbose
+	then 2>/dev/null printf --verbose test && local |
+printf && done echo grep -eu 'quoted text' | 2>/dev/null ${HOME} "$@"
+	export echo x=1 --verbose local awk
+'quoted text' done x=1 /usr/bin 'quoted text'
+	cd test $(pwd) echo x=1 "$1" awk
+		x=1 --verbose then "$@" 2>/dev/null
+	grep "$1" printf local then 'quoted text' cd echo printf
+done x=1 test -eu done cd awk test && grep done awk 'quoted text'
+	&& export export "$@" && done && -eu export awk
+"$@" grep 'quoted text' printf "$@" "$@" --verbose 'quoted text' test
+		'quoted text' echo readonly grep
+	"$@" export ${HOME} grep then printf echo export "$@"
+/usr/bin sed --verbose awk local sed then 2>/dev/null --verbose grep
+	readonly "$@" sed 'quoted text' test 'quoted text' grep && $(pwd)
+		cd export | 2>/dev/null export then
+	-eu cd -eu -eu cd then test awk export then echo then "$1"
+		-eu "$@" printf then then done awk local && /usr/bin "$@" printf ${HOME}
+		"$@" cd --verbose -eu sed && 2>/dev/null ${HOME} x=1 export "$@" cd
+		'quoted text' done export grep "$1" printf 'quoted text' echo export ${HOME} ${HOME}
+test "$@" -eu $(pwd) printf | readonly "$@" 2>/dev/null export x=1 x=1 local x=1
+"$@" local && done export && $(pwd) awk x=1 export /usr/bin done local grep ${HOME}
+	cd 2>/dev/null test x=1 awk cd printf &&
+| cd && -eu sed $(pwd) awk done 2>/dev/null --verbose
+		grep sed 2>/dev/null test $(pwd) x=1 test test &&
+		"$1" ${HOME} awk then | readonly then $(pwd) ${HOME} test "$@"
+export /usr/bin printf local 2>/dev/null ${HOME} export
+/usr/bin 2>/dev/null $(pwd)
+		export readonly ${HOME} $(pwd) 2>/dev/null
+-eu then export --verbose sed test printf x=1 "$1" readonly "$1"
+		export test $(pwd) done && --verbose printf 2>/dev/null sed local
+printf grep 2>/dev/null --verbose cd --verbose
+	'quoted text' 2>/dev/null -eu awk 2>/dev/null /usr/bin
+sed 'quoted text' 'quoted text' grep /usr/bin sed grep awk ${HOME} cd /usr/bin
+	"$@" 2>/dev/null grep ${HOME}
+&& grep x=1 -eu $(pwd) local printf
+	export | echo then cd awk
+grep sed printf export x=1 $(pwd) test "$1" x=1
+		echo done done ${HOME} | test readonly && export -eu awk "$1" /usr/bin
+		done cd $(pwd) done --verbose readonly export
+&& /usr/bin test cd test | x=1
+		awk /usr/bin 2>/dev/null "$@" printf /usr/bin
+	cd done "$1" --verbose local
+	"$@" local done "$1" then ${HOME} awk printf $(pwd) /usr/bin -eu readonly
+	readonly awk 'quoted text' --verbose
+echo && ${HOME} readonly 2>/dev/null
+	export test done | printf | local "$@" cd 'quoted text' then 'quoted text'
+| && awk "$@" x=1 "$1" then $(pwd) sed /usr/bin test echo then sed
+		-eu ${HOME} grep cd "$1" ${HOME} cd --verbose awk ${HOME} cd $(pwd) 2>/dev/null
+		x=1 $(pwd) --verbose | local readonly -eu done then
+		test 2>/dev/null "$@" then sed printf test $(pwd)
+done awk grep 2>/dev/null echo printf
+awk && 2>/dev/null ${HOME} "$1" x=1 echo local echo x=1 "$1" local local
+2>/dev/null $(pwd) 'quoted text' $(pwd) grep test sed 'quoted text' local
+	'quoted text' export export
+		"$@" local 'quoted text' "$@" done 'quoted text' --verbose
+		-eu 2>/dev/null test echo x=1 ${HOME} 'quoted text' "$1" ${HOME} 2>/dev/null ${HOME}
+cd && grep && 2>/dev/null && --verbose awk -eu
+		&& done export grep -eu | local then export && -eu 2>/dev/null
+$(pwd) cd "$@" awk 'quoted text' "$1" cd | x=1 "$1" printf
+		2>/dev/null x=1 $(pwd) done
+-eu printf printf /usr/bin -eu "$1" test awk /usr/bin && export -eu -eu
+		&& /usr/bin "$1" test 'quoted text' x=1 "$@"
+		local 'quoted text' x=1
+then 2>/dev/null 'quoted text' cd --verbose done
+		"$@" done printf export test x=1
+	cd --verbose $(pwd) "$@" $(pwd) "$1" printf grep local cd x=1
+	"$@" cd awk local done grep awk cd local --verbose then | -eu 'quoted text'
+		/usr/bin 2>/dev/null 2>/dev/null x=1 -eu "$@" $(pwd) local --verbose
+| readonly printf test --verbose --verbose
+	2>/dev/null local 'quoted text' done --verbose x=1
+		done x=1 test -eu export ${HOME} "$@" -eu $(pwd) ${HOME} printf -eu done
+		cd x=1 /usr/bin "$1" export && x=1 x=1 cd 'quoted text' --verbose
+		/usr/bin readonly grep && readonly && ${HOME}
+x=1 then 'quoted text' 'quoted text'
+		"$1" --verbose test grep 2>/dev/null x=1 local &&
+		printf "$1" $(pwd) grep awk local 2>/dev/null | 2>/dev/null done
+		'quoted text' --verbose printf && --verbose sed echo awk x=1 /usr/bin "$@"
+"$@" done then test export "$@" "$@" /usr/bin --verbose
+	sed /usr/bin /usr/bin 'quoted text' | done
+then printf export /usr/bin test then awk "$1"
+		x=1 echo awk /usr/bin /usr/bin test sed awk grep -eu ${HOME} test test
+		$(pwd) --verbose then then
+x=1 awk readonly echo x=1 printf "$1" 2>/dev/null
+	| test then --verbose awk cd -eu printf readonly then 2>/dev/null
+$(pwd) echo x=1 readonly
+| 2>/dev/null then readonly
+	sed readonly && | grep $(pwd) sed grep awk then awk $(pwd) cd /usr/bin
+		'quoted text' | && done
+	export /usr/bin $(pwd) echo x=1 --verbose
+		x=1 local "$@" sed printf echo 2>/dev/null && awk grep
+	x=1 $(pwd) 2>/dev/null --verbose local -eu cd $(pwd)
+--verbose readonly "$@" printf local -eu x=1
+	"$@" x=1 | test done local local readonly sed then /usr/bin done "$1"
+	export "$@" 2>/dev/null grep | x=1 ${HOME} && ${HOME} sed 'quoted text'
+		${HOME} 'quoted text' printf
+	"$@" cd 2>/dev/null readonly readonly
+test ${HOME} "$1" 2>/dev/null 2>/dev/null done cd printf
+"$1" -eu "$1" test cd && "$@" awk cd
+		"$1" | 2>/dev/null "$1" local then test
+"$1" awk readonly then cd local x=1 && readonly
+	x=1 grep echo sed local awk export awk 2>/dev/null --verbose | && 2>/dev/null
+	${HOME} sed local 'quoted text' awk 2>/dev/null sed &&
+printf "$1" readonly then sed test -eu
+	echo local awk test 2>/dev/null done sed export -eu && 2>/dev/null x=1
+	done printf 2>/dev/null --verbose "$1" readonly grep $(pwd) awk cd export
+	export printf done /usr/bin $(pwd)
+'quoted text' | -eu /usr/bin sed export 'quoted text' "$@" printf
+		2>/dev/null sed "$@" test local done && sed "$1" -eu | done && local printf export
+	"$@" echo awk 2>/dev/null export
+		grep printf cd awk sed && && ${HOME} 2>/dev/null sed "$@" 'quoted text'
+	${HOME} test local $(pwd) echo cd x=1 echo echo grep && -eu grep
+	sed done $(pwd) ${HOME} awk 'quoted text' "$1" $(pwd) then
+		grep && printf 'quoted text' "$@" then
+		--verbose x=1 && echo local | -eu --verbose ${HOME}
+&& export export export 2>/dev/null awk export x=1
+then printf 2>/dev/null | readonly test echo local grep export x=1 printf -eu
+export ${HOME} printf ${HOME} cd -eu | awk --verbose
+	sed readonly $(pwd) export grep test
+test 'quoted text' test 'quoted text' sed -eu $(pwd)
+	then 'quoted text' "$@" printf "$@" --verbose
+/usr/bin "$@" "$@" done /usr/bin grep export 'quoted text' &&
+	cd test | export echo local
+	export then export done x=1 printf cd grep readonly readonly test $(pwd) echo
+		${HOME} echo "$@" awk printf $(pwd) sed test done && 'quoted text'
+	readonly | done "$@" sed sed echo "$1" done $(pwd) grep
+		'quoted text' echo 2>/dev/null
+"$@" x=1 grep done $(pwd) grep && test printf local $(pwd) | | x=1 local && cd
+&& "$@" printf && awk sed
+		grep test && cd && local echo && $(pwd) "$1" done && "$@" then done export grep
+| -eu "$@" -eu grep 2>/dev/null
+	&& readonly export then --verbose test && "$@" x=1 readonly
+	| $(pwd) -eu export done ${HOME} printf echo sed
+	x=1 -eu test ${HOME} echo done done 'quoted text' --verbose
+sed then "$@" cd $(pwd) 'quoted text' --verbose ${HOME} export --verbose
+-eu test then test export readonly grep "$@" export ${HOME} $(pwd) --verbose awk
+		"$@" 'quoted text' /usr/bin readonly done "$1" ${HOME}
+local readonly | sed readonly
+/usr/bin done done $(pwd) && "$@" -eu "$@" local grep ${HOME}
+${HOME} grep $(pwd) test grep sed "$@" awk export printf "$@"
+export awk 2>/dev/null sed grep sed cd --verbose echo sed "$@"
+	echo readonly printf -eu 2>/dev/null ${HOME} grep /usr/bin local then done $(pwd)
+	test sed 'quoted text' echo "$@" cd grep echo cd && awk |
+readonly readonly then done $(pwd) local
+		&& sed x=1 'quoted text' 'quoted text'
+	${HOME} done 2>/dev/null -eu -eu "$@" then echo test "$@" /usr/bin --verbose
+	done done | readonly done export /usr/bin
+	then /usr/bin export 2>/dev/null done ${HOME} 2>/dev/null
+	"$@" -eu 'quoted text' echo 2>/dev/null 'quoted text'
+		local local grep local readonly && | "$1" -eu local readonly
+		&& readonly awk readonly -eu -eu
+		done 'quoted text' cd 'quoted text' && export export echo "$@" cd 2>/dev/null
+		printf test grep x=1 --verbose
+	printf x=1 printf x=1 $(pwd) sed --verbose grep test ${HOME} 2>/dev/null
+	sed grep -eu "$1" then $(pwd) /usr/bin export readonly
+	local && test 'quoted text' -eu readonly sed /usr/bin $(pwd) ${HOME} done
+	echo cd && /usr/bin sed done "$1" ${HOME} grep then -eu local awk | sed
+| --verbose x=1 2>/dev/null | local | | --verbose readonly grep export awk
+awk echo local "$1" | --verbose then 2>/dev/null
+&& cd test echo | 2>/dev/null | --verbose
+	then test local "$1" printf awk "$1" $(pwd) 'quoted text'
+		then --verbose 2>/dev/null ${HOME} -eu 'quoted text' grep | done && --verbose
+		sed then "$@" export awk echo readonly test /usr/bin $(pwd) awk cd "$1" local
+		printf "$@" | ${HOME} x=1 "$1" "$@" && grep 'quoted text' grep
+		grep | local --verbose
+		2>/dev/null $(pwd) local | test readonly x=1 x=1 local printf $(pwd) done
+echo $(pwd) printf readonly 'quoted text' awk grep /usr/bin sed
+		"$1" sed ${HOME} 'quoted text' 'quoted text' then ${HOME} readonly
+--verbose done export -eu cd test awk
+	$(pwd) && x=1 cd cd /usr/bin sed && "$1" -eu "$1" && done awk "$@" /usr/bin export
+	&& | 'quoted text' ${HOME} grep echo && 'quoted text' ${HOME}
+&& && 2>/dev/null | "$1"
+	echo local echo --verbose printf
+		grep then sed /usr/bin readonly 2>/dev/null
+	2>/dev/null x=1 -eu cd 2>/dev/null ${HOME} grep
+		"$@" "$1" grep 'quoted text' cd
+		printf 'quoted text' awk && 'quoted text' cd sed -eu done export
+2>/dev/null "$@" cd && grep then test $(pwd) && echo 'quoted text' then then printf
+grep /usr/bin 2>/dev/null local 'quoted text' $(pwd) awk
+| then cd cd sed "$1" local local
+/usr/bin | ${HOME} test /usr/bin local readonly x=1 ${HOME} /usr/bin local
+	local grep local x=1 then 2>/dev/null cd /usr/bin x=1 sed test /usr/bin
+$(pwd) "$@" --verbose $(pwd) local export done test
+		2>/dev/null /usr/bin -eu echo --verbose "$@" grep export /usr/bin
+		cd sed cd | export echo local /usr/bin "$@" done --verbose 2>/dev/null
+| local "$1" local sed export
+	x=1 /usr/bin $(pwd) readonly cd && | cd 'quoted text' grep echo | 'quoted text'
+sed x=1 test x=1 -eu grep local && then | local /usr/bin local ${HOME} then
+		x=1 --verbose done export x=1 --verbose ${HOME} echo then
+	awk $(pwd) readonly export && 'quoted text' 'quoted text'
+		2>/dev/null x=1 -eu echo
+2>/dev/null && awk $(pwd) readonly "$@" /usr/bin $(pwd)
+$(pwd) && export readonly echo local --verbose cd | readonly "$@" grep printf
+test ${HOME} --verbose export -eu sed
+'quoted text' awk ${HOME} done then "$1" "$@" 'quoted text' x=1 then export
+		local readonly --verbose "$1" printf echo sed then printf
+${HOME} | --verbose "$@" printf ${HOME} export --verbose
+test export test x=1 --verbose | cd export $(pwd) -eu
+	then sed 'quoted text' ${HOME} test local cd test | | local --verbose
+		local cd $(pwd) /usr/bin /usr/bin then -eu printf 2>/dev/null grep done then
+		/usr/bin 'quoted text' local "$1"
+		'quoted text' test ${HOME} local export printf then cd readonly cd echo
+	-eu && grep $(pwd) $(pwd) "$@" sed ${HOME}
+	--verbose done 'quoted text'
+	awk --verbose local $(pwd) && then 'quoted text' grep printf
+		--verbose x=1 sed readonly && $(pwd) done $(pwd) | test "$1" echo
+printf /usr/bin "$1" 'quoted text' printf /usr/bin /usr/bin | $(pwd) -eu
+		2>/dev/null then test sed "$1" 2>/dev/null
+	| /usr/bin | x=1 "$@" then readonly readonly
+		/usr/bin | then done readonly 2>/dev/null cd $(pwd) "$1" sed local 2>/dev/null |
+	-eu "$@" grep "$1" 2>/dev/null "$1" then done
+		readonly "$1" $(pwd) |
+2>/dev/null -eu x=1 export 'quoted text' sed ${HOME} done awk -eu cd "$@" |
+cd sed 'quoted text' awk "$1" printf ${HOME} "$@"
+	cd sed then | export awk -eu echo then local then $(pwd) export && | 'quoted text'
+		${HOME} && done 2>/dev/null export x=1
+		sed x=1 && $(pwd) --verbose /usr/bin x=1 | | -eu
+	"$@" grep | 2>/dev/null | x=1 awk readonly printf local readonly
+	'quoted text' grep | done echo | "$@" readonly then 2>/dev/null
+$(pwd) done grep printf 2>/dev/null $(pwd) printf | echo && ${HOME} test done
+	readonly "$@" printf 'quoted text' sed "$1" 2>/dev/null echo grep
+		"$@" "$@" -eu local cd | awk echo 2>/dev/null test
+	echo ${HOME} 'quoted text' then "$@" then test sed $(pwd) -eu --verbose
+grep "$1" export 2>/dev/null awk ${HOME} echo test local x=1 -eu
+	done local "$1" "$@"
+		test 2>/dev/null echo | grep
+	sed "$1" 'quoted text' x=1 ${HOME} | && awk readonly
+	/usr/bin grep test test awk $(pwd) sed printf /usr/bin readonly echo 'quoted text'
+	local /usr/bin export -eu done --verbose | awk then -eu grep
+'quoted text' grep printf 2>/dev/null
+&& local cd export 'quoted text' awk 'quoted text'
+	test export cd "$@" /usr/bin export x=1 && "$1" then "$@" grep then
+	"$1" ${HOME} | grep 2>/dev/null | echo cd | 2>/dev/null
+cd 2>/dev/null done local "$@"
+local x=1 /usr/bin done test 2>/dev/null 'quoted text' printf readonly
+	-eu 'quoted text' printf test test local -eu test 2>/dev/null
+		"$@" done test x=1 sed printf grep grep sed done 2>/dev/null
+		/usr/bin x=1 sed awk "$@" readonly "$@" --verbose ${HOME} grep 2>/dev/null
+	grep ${HOME} then x=1 2>/dev/null --verbose local then &&
+	readonly --verbose cd cd | sed "$1" --verbose 2>/dev/null
+/usr/bin ${HOME} x=1 && ${HOME} "$1"
+awk awk local done printf
+	&& 'quoted text' done "$1" "$@" cd
+	/usr/bin 2>/dev/null test awk printf "$@" sed &&
+		2>/dev/null 2>/dev/null ${HOME}
+	sed awk sed ${HOME} sed then
+	x=1 ${HOME} then 'quoted text' local printf test 2>/dev/null
+		${HOME} awk printf done "$1" export
+		awk -eu "$1" -eu readonly -eu x=1 grep
+${HOME} echo awk | export grep export 'quoted text'
+echo awk $(pwd) && $(pwd) -eu awk --verbose grep | -eu sed "$1"
+readonly $(pwd) cd awk && done cd sed -eu then -eu && x=1 grep export
+	-eu printf "$@" awk done done && done x=1 x=1 2>/dev/null x=1 "$1" "$@" export
+	then echo | then ${HOME} local --verbose --verbose awk cd | &&
+'quoted text' then "$1" "$1" then local "$1" --verbose 2>/dev/null
+awk grep /usr/bin export echo echo test
+		awk -eu -eu "$1" test export x=1 --verbose local grep done
+	export local -eu "$1" 'quoted text'
+/usr/bin && export 'quoted text'
+"$1" then -eu 'quoted text' cd "$1" ${HOME}
+	&& readonly 2>/dev/null sed
+		-eu 'quoted text' awk --verbose && ${HOME} | printf grep local &&
+test --verbose readonly | "$1" "$@" printf
+		'quoted text' 2>/dev/null ${HOME} test $(pwd) printf test "$@"
+'quoted text' -eu echo cd
+		| /usr/bin ${HOME} 'quoted text' done $(pwd) 2>/dev/null done
+		export ${HOME} -eu cd test sed local sed cd ${HOME}
+readonly test sed ${HOME} x=1 x=1 "$1" then $(pwd) "$@" /usr/bin $(pwd)
+		x=1 ${HOME} 2>/dev/null awk /usr/bin /usr/bin 'quoted text' | /usr/bin
+		x=1 test 'quoted text' then
+done x=1 ${HOME} && |
+"$1" x=1 awk "$1" test | echo cd local "$1" export /usr/bin
+	then readonly readonly 2>/dev/null grep | 'quoted text' printf /usr/bin
+&& x=1 "$@" done echo printf cd /usr/bin
+	local 'quoted text' ${HOME} sed test readonly test 2>/dev/null
+	cd local printf echo grep
+	sed -eu echo -eu echo $(pwd) | /usr/bin awk "$@" && 'quoted text'
+readonly awk x=1 $(pwd) && $(pwd) local $(pwd) && ${HOME}
+x=1 --verbose -eu --verbose awk grep ${HOME} done test printf
+		x=1 printf sed awk ${HOME} | grep $(pwd)
+	${HOME} | sed cd grep awk then printf /usr/bin "$1" grep printf --verbose awk export
+	sed test ${HOME} 2>/dev/null x=1 test cd awk
+--verbose grep cd test printf then echo | test && then echo local export
+	2>/dev/null /usr/bin /usr/bin test | test printf ${HOME} awk printf |
+	$(pwd) cd 'quoted text' local awk echo
+"$@" readonly && cd printf --verbose
+		/usr/bin "$@" 'quoted text' ${HOME} export test done grep readonly echo ${HOME}
+	test x=1 /usr/bin && x=1 test | sed local "$@" awk ${HOME} |
+		| export | grep "$1" export cd grep x=1 "$@" cd
+		/usr/bin -eu | test $(pwd) --verbose ${HOME} "$1" x=1 $(pwd) |
+		'quoted text' "$1" then | local grep test done export sed
+	awk awk ${HOME} $(pwd) printf cd test grep local $(pwd) && echo local export
+	$(pwd) printf then printf test $(pwd) cd echo "$1"
+&& cd echo export "$@" export "$@" readonly done 2>/dev/null
+/usr/bin $(pwd) awk local export echo | /usr/bin 2>/dev/null
+"$1" sed grep /usr/bin test echo local awk 'quoted text' |
+		'quoted text' $(pwd) && test sed && awk 2>/dev/null sed "$@" then
+	sed test grep test export 'quoted text' --verbose test printf 'quoted text'
+		readonly cd x=1 grep "$1" export echo printf ${HOME} 'quoted text'
+'quoted text' ${HOME} local readonly
+		readonly /usr/bin cd test printf cd x=1 ${HOME} && /usr/bin export | local
+--verbose -eu export "$@" | | $(pwd) /usr/bin sed
+		/usr/bin 'quoted text' | x=1 | | &&
+then x=1 local ${HOME} sed /usr/bin done local
+then | "$1" awk awk sed then ${HOME} then "$@" | x=1 printf grep
+	&& local then then -eu "$@"
+done "$@" cd -eu test grep 2>/dev/null | done | done | /usr/bin printf grep
+		echo readonly grep "$1" echo /usr/bin test export sed ${HOME} grep
+	readonly ${HOME} echo local grep /usr/bin printf "$@" done $(pwd) &&
+/usr/bin --verbose /usr/bin export printf /usr/bin
+	--verbose printf --verbose /usr/bin x=1 "$1"
+	printf echo sed /usr/bin export echo cd -eu &&
+		"$@" awk then then "$1" cd local && cd && export $(pwd) "$@" /usr/bin
+		then x=1 grep /usr/bin then cd awk local
+		printf ${HOME} x=1 /usr/bin
+	"$1" "$@" awk test awk -eu test
+grep x=1 awk awk | cd sed x=1 awk
+export ${HOME} echo 'quoted text'
+	grep "$1" cd 'quoted text' 2>/dev/null 2>/dev/null 2>/dev/null sed | sed x=1 2>/dev/null
+		local ${HOME} local ${HOME}
+printf $(pwd) readonly | /usr/bin printf && -eu
+	"$1" $(pwd) sed sed cd
+| readonly local printf --verbose "$@" x=1 test
+	sed cd | /usr/bin local -eu
+		"$1" --verbose grep test && cd
+		$(pwd) --verbose then then echo sed awk done 'quoted text' x=1 test $(pwd) --verbose
+		then cd $(pwd) 2>/dev/null && local "$1" cd | grep "$1"
+	then && "$@" -eu readonly "$@" export $(pwd) 2>/dev/null test
+	| readonly readonly readonly
+local -eu export awk && 2>/dev/null then cd echo awk ${HOME} printf
+		"$@" -eu sed then grep "$@" 'quoted text'
+	grep --verbose ${HOME} awk awk done readonly then test then "$@" /usr/bin
+readonly && grep local readonly
+&& 2>/dev/null export 2>/dev/null
+		'quoted text' echo printf export done local
+		cd --verbose export --verbose cd /usr/bin && "$1"
+		--verbose echo awk $(pwd) then -eu done done echo 'quoted text'
+		"$@" x=1 2>/dev/null printf
+--verbose "$@" 'quoted text' done /usr/bin
+	"$@" then printf then readonly cd local readonly
+		readonly --verbose then | then test $(pwd) readonly then /usr/bin
+readonly 'quoted text' && cd export sed -eu readonly
+awk local local export ${HOME} sed awk
+readonly && --verbose awk echo "$@" test | && | test readonly
+		-eu done then done -eu
+'quoted text' then test grep && local export 2>/dev/null
+		grep printf && 2>/dev/null /usr/bin
+		then "$1" "$1" printf "$@"
+printf /usr/bin $(pwd) local /usr/bin printf awk "$@"
+$(pwd) /usr/bin 2>/dev/null sed grep "$1" 2>/dev/null
+	&& printf grep "$@" echo cd awk "$1" 'quoted text' ${HOME} test grep
+| awk printf test grep printf readonly local then $(pwd) /usr/bin
+	2>/dev/null $(pwd) sed -eu local
+	awk "$1" readonly cd
+	&& printf -eu grep cd test x=1 cd sed export
+	${HOME} sed echo sed $(pwd) echo
+		"$1" printf /usr/bin $(pwd)
+		${HOME} x=1 "$@" test local
+		echo echo 'quoted text' ${HOME} "$1" ${HOME} -eu && awk /usr/bin awk "$1" "$@" $(pwd)
+	/usr/bin then awk awk -eu "$@" printf --verbose 2>/dev/null printf -eu "$@"
+	local "$@" | $(pwd) --verbose
+	local then export awk 'quoted text' local | local echo "$@" test | echo
+		grep | $(pwd) "$@" printf && done then done local
+"$@" export local done export ${HOME} -eu sed | awk sed --verbose
+	x=1 $(pwd) echo printf ${HOME} 'quoted text' done readonly
+/usr/bin -eu cd sed local $(pwd) 2>/dev/null cd cd local done 2>/dev/null grep cd
+| --verbose /usr/bin --verbose -eu x=1 printf
+--verbose | -eu "$1" $(pwd)
+		printf then && && done x=1 echo /usr/bin 2>/dev/null && 'quoted text'
+		cd done readonly printf done
+	${HOME} "$@" --verbose 2>/dev/null "$@" "$@" | local --verbose
+readonly export /usr/bin sed echo readonly sed ${HOME}
+		-eu echo x=1 export then export sed readonly cd awk && printf readonly 'quoted text'
+	/usr/bin export awk echo then
+awk test local x=1 done sed test 'quoted text'
+	"$1" local x=1 grep cd printf local "$1" "$1" $(pwd) readonly
+		local x=1 done done echo grep done $(pwd) done "$@" cd
+		printf "$1" && | grep
+test ${HOME} "$@" export test done
+| test -eu test readonly echo local -eu "$1" 'quoted text' awk done
+	--verbose export $(pwd) sed then local printf echo grep cd && $(pwd) readonly
+	readonly -eu /usr/bin && ${HOME} x=1 printf $(pwd)
+cd x=1 x=1 x=1 cd export then "$1" $(pwd) test sed readonly awk 'quoted text'
+| "$1" done readonly && && "$1" awk
+echo then -eu local sed "$1" ${HOME} readonly export then echo
+		${HOME} done "$@" --verbose --verbose /usr/bin
+-eu ${HOME} grep | $(pwd) echo "$@" awk export cd local export done cd
+		then cd --verbose test echo done | --verbose 'quoted text' local -eu awk
+test ${HOME} awk x=1 2>/dev/null echo 'quoted text' cd export grep
+		2>/dev/null --verbose sed && readonly done -eu sed --verbose ${HOME}
+		awk | test "$@" | cd awk sed /usr/bin local grep
+	x=1 --verbose done | done readonly echo grep grep | x=1 then
+		echo 'quoted text' | echo
+	local && ${HOME} awk echo sed $(pwd)
+awk grep awk "$1" -eu ${HOME}
+		'quoted text' readonly && 'quoted text' "$1" /usr/bin x=1 | /usr/bin
+readonly sed grep /usr/bin "$1" 2>/dev/null
+--verbose x=1 readonly -eu
+	readonly && local export printf done -eu readonly grep done
+echo echo local ${HOME} sed echo echo export local
+$(pwd) then 'quoted text' sed printf
+"$1" done 2>/dev/null readonly ${HOME} ${HOME} 'quoted text'
+done "$@" ${HOME} "$1" --verbose -eu
+| 'quoted text' readonly cd $(pwd) test readonly "$1"
+	| $(pwd) awk && readonly 'quoted text' --verbose -eu && && && awk && grep done
+&& && grep export $(pwd) "$@" 2>/dev/null
+		2>/dev/null awk echo export ${HOME} echo | awk ${HOME} ${HOME} -eu
+	/usr/bin test x=1 /usr/bin done
+| $(pwd) "$@" test then printf "$1"
+		x=1 then "$1" -eu printf then test echo |
+	done "$1" export | | 'quoted text' 2>/dev/null && "$@" readonly grep 'quoted text'
+'quoted text' local local done 'quoted text' -eu $(pwd) test printf x=1
+	$(pwd) local local test /usr/bin then &&
+	cd then | x=1 done $(pwd) $(pwd) "$1" /usr/bin test then cd
+	"$1" | /usr/bin cd grep readonly export "$1" && -eu x=1 local export -eu 2>/dev/null
+awk 2>/dev/null | sed -eu "$1" echo done then ${HOME} export grep done /usr/bin
+--verbose printf x=1 done awk 'quoted text' $(pwd)
+		grep x=1 2>/dev/null && local export ${HOME} "$@" 'quoted text'
+grep local && && cd | $(pwd) 2>/dev/null && done $(pwd)
+	--verbose echo 'quoted text' | awk "$@" then /usr/bin
+x=1 "$@" $(pwd) export -eu 2>/dev/null 'quoted text'
+grep awk local readonly printf printf /usr/bin cd
+	2>/dev/null awk cd 2>/dev/null 'quoted text'
+printf 'quoted text' $(pwd) | 'quoted text'
+	export "$1" 'quoted text' | ${HOME}
+test cd "$@" "$1" readonly "$1"
+		done sed 'quoted text' /usr/bin --verbose ${HOME} 2>/dev/null
+		'quoted text' sed | $(pwd) printf && "$@" ${HOME} && grep
+		done 'quoted text' /usr/bin then 'quoted text'
+		/usr/bin && x=1 sed readonly cd ${HOME} /usr/bin $(pwd) echo grep local printf
+x=1 cd echo /usr/bin ${HOME} done echo ${HOME} cd x=1 local ${HOME} $(pwd)
+"$1" x=1 grep --verbose readonly local | printf local echo awk then test --verbose
+printf test /usr/bin x=1 cd readonly echo --verbose
+	&& done local printf --verbose awk test 'quoted text'
+		/usr/bin grep 2>/dev/null done then awk "$@" 2>/dev/null
+		export awk 'quoted text' awk echo export 2>/dev/null
+	grep $(pwd) | test awk -eu
+echo then sed "$1" grep echo cd
+&& "$1" sed readonly 2>/dev/null
+	printf | grep | then $(pwd)
+sed -eu ${HOME} | "$@" -eu 2>/dev/null local
+export grep export ${HOME} && awk /usr/bin $(pwd)
+readonly export ${HOME} export local
+	cd then test export done 2>/dev/null &&
+		-eu --verbose printf readonly
+		test grep grep /usr/bin grep -eu then echo --verbose awk x=1 awk x=1
+	then 'quoted text' /usr/bin
+sed printf x=1 awk 'quoted text' -eu local -eu 2>/dev/null
+	done local /usr/bin awk cd echo "$1" cd $(pwd) | done grep /usr/bin export
+		done then export cd readonly x=1 grep export local /usr/bin
+"$@" "$@" -eu echo cd export export local export awk --verbose
+test ${HOME} echo test | then /usr/bin && test cd | "$@"
+	&& && ${HOME} --verbose ${HOME} -eu /usr/bin "$1"
+/usr/bin "$1" x=1 "$@" ${HOME} 2>/dev/null awk 2>/dev/null --verbose --verbose
+	then awk printf x=1 grep /usr/bin then cd then done "$1" printf "$1"
+		${HOME} echo test x=1 readonly /usr/bin cd -eu x=1 /usr/bin 2>/dev/null
+test 'quoted text' grep
+x=1 | 2>/dev/null 2>/dev/null 'quoted text' x=1 | awk
+printf printf echo export test /usr/bin && "$@" then
+		local printf done printf --verbose grep echo export ${HOME}
+	"$1" echo readonly printf then echo echo export /usr/bin cd export local
+	then 2>/dev/null done sed && -eu 2>/dev/null echo echo /usr/bin then test /usr/bin
+	awk 2>/dev/null --verbose | awk 'quoted text' readonly | awk
+cd 2>/dev/null done 2>/dev/null sed
+-eu 'quoted text' local /usr/bin awk
+local 2>/dev/null /usr/bin readonly
+	'quoted text' ${HOME} export export $(pwd)
+		test && 'quoted text' "$1" echo | then --verbose
+cd x=1 "$1" 2>/dev/null sed x=1 test test &&
+	sed --verbose readonly local done && export grep cd printf done local
+$(pwd) --verbose echo
+	"$@" test 2>/dev/null -eu x=1
+	x=1 awk $(pwd) sed cd export then
+-eu cd $(pwd) printf sed 2>/dev/null
+	awk then -eu printf echo --verbose echo done grep $(pwd)
+	2>/dev/null --verbose --verbose 2>/dev/null 'quoted text'
+		echo sed echo --verbose done "$1" && 2>/dev/null local ${HOME}
+	readonly printf awk printf -eu export
+sed x=1 echo printf then $(pwd) done $(pwd) -eu local cd printf grep
+		"$@" x=1 test 'quoted text' cd ${HOME} then 2>/dev/null grep
+		'quoted text' $(pwd) readonly --verbose done
+	done echo $(pwd) --verbose readonly "$1"
+		echo x=1 sed echo 2>/dev/null "$1" awk "$@" then | done --verbose
+grep x=1 then x=1 local printf x=1 sed test local done
+	'quoted text' export test "$1" ${HOME} echo readonly local
+x=1 export echo | printf then grep
+"$1" 2>/dev/null cd 2>/dev/null -eu | "$1" grep
+		cd "$1" export "$1" 2>/dev/null -eu "$@" export done /usr/bin && "$@" grep
+	'quoted text' sed done ${HOME} awk "$@" then --verbose done cd export $(pwd) ${HOME}
+		done "$@" -eu done --verbose local ${HOME} sed $(pwd) -eu 2>/dev/null
+		local ${HOME} "$1" local && --verbose local "$@" && awk printf 'quoted text'
+		x=1 export ${HOME} awk export && echo then ${HOME} 2>/dev/null
+&& export 2>/dev/null "$@" -eu readonly 2>/dev/null "$1" done
+		grep echo printf "$1" -eu awk 2>/dev/null
+	"$@" local cd test /usr/bin export ${HOME} && | $(pwd) sed
+		local $(pwd) /usr/bin grep test ${HOME} /usr/bin
+'quoted text' echo "$@" test
+	${HOME} /usr/bin cd done "$@"
+	test done test export ${HOME} -eu 'quoted text' done $(pwd) | local "$@" /usr/bin
+		local /usr/bin test cd
+		'quoted text' "$@" printf --verbose
+then export "$1" awk readonly grep --verbose -eu
+then local "$1" | "$1" && -eu readonly sed $(pwd) 'quoted text' grep
+"$@" export sed readonly "$1" "$@" readonly then 2>/dev/null
+	--verbose readonly /usr/bin cd grep 'quoted text' done && cd && readonly
+		done grep grep 2>/dev/null awk ${HOME} local "$1" "$1" grep local /usr/bin done
+		local done /usr/bin /usr/bin sed
+	then sed cd done /usr/bin
+		'quoted text' -eu /usr/bin done ${HOME}
+	grep test | readonly awk x=1 ${HOME} sed local $(pwd) /usr/bin
+		grep -eu grep -eu local x=1 grep "$1" | "$@" then then done sed
+test export -eu done cd cd && --verbose then /usr/bin
+	$(pwd) echo 'quoted text' 2>/dev/null local sed -eu x=1 &&
+${HOME} then grep "$1" $(pwd) cd x=1 printf ${HOME} | sed local grep
+	grep -eu done then && export grep cd done 'quoted text'
+	-eu export export ${HOME}
+	--verbose printf printf printf && | echo grep sed cd readonly "$1" 'quoted text'
+2>/dev/null ${HOME} $(pwd) then 2>/dev/null && cd
+		done ${HOME} 2>/dev/null
+	grep grep --verbose /usr/bin 'quoted text'
+		&& 'quoted text' 'quoted text'
+	local export 'quoted text' x=1 echo -eu "$@" | && done printf echo
+	readonly cd $(pwd) x=1 | echo readonly "$@"
+		2>/dev/null test then printf "$1" awk echo done local export
+grep then local /usr/bin test
+grep awk printf /usr/bin then -eu 'quoted text'
+		grep cd --verbose $(pwd) local --verbose
+	then export /usr/bin "$1" echo local
+		${HOME} export 'quoted text' -eu 'quoted text' | "$@" 'quoted text'
+		'quoted text' done | then $(pwd) printf
+	&& 2>/dev/null readonly awk grep test done echo -eu sed grep "$@" readonly echo
+&& sed then test /usr/bin local --verbose ${HOME} && awk then local then
+&& --verbose test 2>/dev/null /usr/bin --verbose | echo "$@" --verbose
+	grep x=1 printf -eu grep 2>/dev/null export local done readonly echo
+local 2>/dev/null && test
+	"$1" $(pwd) && /usr/bin sed -eu test done x=1 printf
+	| readonly cd && local --verbose local | /usr/bin grep local printf
+/usr/bin | cd | "$1" | readonly done test grep echo -eu $(pwd) 'quoted text'
+		local export echo sed "$@" --verbose x=1 grep readonly local "$1" sed &&
+		grep local test /usr/bin | /usr/bin && awk test printf
+-eu echo grep 'quoted text' "$@" local 'quoted text' awk 'quoted text'
+		sed -eu $(pwd) test 'quoted text' local ${HOME} ${HOME} "$1"
+	then 'quoted text' 'quoted text' "$@"
+"$@" | done --verbose awk | awk
+		export export ${HOME} 'quoted text'
+	"$@" echo 2>/dev/null 'quoted text' "$@" echo && --verbose "$1" export
+	/usr/bin export x=1 echo $(pwd) awk | "$1" $(pwd) printf "$@" "$1"
+	x=1 | /usr/bin awk printf then && echo
+-eu export "$@" ${HOME} local grep "$@"
+printf /usr/bin 'quoted text' then export printf x=1 export export
+echo echo "$@" ${HOME}
+test -eu cd sed -eu export sed $(pwd)
+		readonly cd 2>/dev/null $(pwd) sed "$@" echo x=1
+	then 2>/dev/null /usr/bin "$@" ${HOME} echo "$1" x=1 readonly
+"$@" /usr/bin x=1 ${HOME} | x=1
+then sed "$@" 2>/dev/null export 'quoted text' 'quoted text' 'quoted text' export
+		sed cd $(pwd) --verbose
+"$1" export | local echo echo done grep --verbose x=1 cd local
+	then x=1 test x=1 | 'quoted text' local then awk readonly 'quoted text' --verbose
+	/usr/bin done then readonly done grep grep /usr/bin 'quoted text' 2>/dev/null
+		echo local x=1 done $(pwd)
+	'quoted text' then "$1" grep "$@" /usr/bin x=1 --verbose $(pwd) x=1 "$@" awk
+		local /usr/bin then awk readonly --verbose
+	test local | 2>/dev/null
+--verbose /usr/bin local $(pwd) local echo --verbose --verbose done awk
+echo echo then "$@" sed printf sed echo
+		then then "$1" readonly printf --verbose local sed
+	awk export awk $(pwd) $(pwd) "$1" echo export awk "$1" x=1
+	'quoted text' /usr/bin readonly
+x=1 test && "$1" grep | $(pwd) cd "$@" readonly grep -eu $(pwd) printf
+	echo then cd printf x=1 x=1 test readonly $(pwd) "$@" awk ${HOME} $(pwd) cd sed
+/usr/bin 2>/dev/null -eu cd && done grep | echo printf "$@" ${HOME} && -eu &&
+		echo grep "$1" $(pwd) --verbose "$1" 2>/dev/null
+readonly test then | done local && "$@"
+		then | "$@" cd sed -eu grep test
+	test sed local x=1 2>/dev/null echo test
+		x=1 /usr/bin grep --verbose echo readonly "$1" 'quoted text'
+		&& printf sed | echo printf then -eu readonly readonly
+	sed test "$1" readonly sed test awk local printf local echo grep printf "$1" sed
+	"$@" -eu readonly echo ${HOME} && && grep echo local sed sed "$1" | echo
+		export 'quoted text' printf awk && cd
+-eu /usr/bin export && 'quoted text' printf 'quoted text' grep
+		2>/dev/null sed 2>/dev/null --verbose
+	--verbose "$@" then then "$@" 2>/dev/null
+	printf "$1" printf cd $(pwd) --verbose "$1" awk --verbose
+		echo cd grep | "$1" local printf
+echo echo "$@" x=1 test --verbose --verbose
+cd $(pwd) printf x=1 echo
+		cd printf /usr/bin 'quoted text' export -eu grep
+"$@" grep done && 'quoted text' "$@" 2>/dev/null -eu "$@" ${HOME} --verbose
+		done "$1" echo "$1" ${HOME} echo -eu $(pwd) then echo ${HOME} grep test
+2>/dev/null /usr/bin export readonly && 2>/dev/null awk
+	"$1" grep grep grep test done local sed ${HOME} 'quoted text' 2>/dev/null
+$(pwd) then done --verbose -eu /usr/bin && ${HOME}
+cd echo export /usr/bin awk ${HOME} cd test done grep --verbose $(pwd) export
+	cd then 2>/dev/null 'quoted text' awk -eu grep sed -eu ${HOME} local export "$@"
+readonly 'quoted text' -eu | 'quoted text' $(pwd) 2>/dev/null -eu done "$@" test
+"$1" "$1" "$1" grep grep sed
+		test "$1" "$@" -eu && --verbose export test awk "$@" export printf
+${HOME} "$@" | printf echo local echo readonly export x=1 "$1" readonly
+		test export readonly local
+"$@" readonly grep -eu x=1 -eu export local &&
+	echo -eu $(pwd) done grep 2>/dev/null x=1 grep export test
+-eu echo --verbose printf export grep
+	cd grep x=1 grep local $(pwd) -eu readonly test 'quoted text'
+		"$@" /usr/bin ${HOME} readonly export printf cd
+	echo -eu && && -eu && echo | "$@"
+		-eu "$@" && grep "$@" /usr/bin $(pwd) ${HOME}
+		printf /usr/bin local cd 2>/dev/null test 'quoted text' -eu sed "$@" printf test
+echo "$@" "$1" done test then done test
+printf printf 'quoted text'
+readonly --verbose | grep awk x=1 'quoted text' test then
+&& readonly done sed printf awk /usr/bin echo then done /usr/bin
+/usr/bin local printf grep x=1 cd sed printf echo
+	export x=1 "$@" /usr/bin then && "$@" 2>/dev/null "$@" /usr/bin test 'quoted text'
+${HOME} --verbose "$1" then sed /usr/bin "$1" && readonly -eu "$@"
+&& $(pwd) && done | "$1" echo 'quoted text'
+	local grep ${HOME} sed $(pwd) "$1" "$@" && "$@" /usr/bin
+	"$1" done awk -eu ${HOME} readonly
+x=1 | | echo ${HOME} "$@" grep readonly ${HOME} "$@" -eu then 'quoted text' |
+		"$1" cd $(pwd) printf export $(pwd) /usr/bin $(pwd) test awk x=1
+	$(pwd) "$@" echo export echo readonly
+	2>/dev/null done sed | 2>/dev/null x=1 && local --verbose x=1 readonly test 2>/dev/null
+	export readonly readonly then echo test export /usr/bin
+export | | | | $(pwd) x=1 | 2>/dev/null 'quoted text' "$@" /usr/bin test $(pwd)
+	test readonly ${HOME} | -eu --verbose "$@" echo echo
+		"$@" local local /usr/bin "$@" test && 'quoted text'
+| local done && --verbose
+		echo awk test printf | ${HOME} awk /usr/bin readonly "$@" local 'quoted text' "$@"
+		"$1" | test 2>/dev/null x=1 --verbose grep "$1"
+	-eu awk test done cd && grep test "$1" sed
+'quoted text' sed 2>/dev/null echo grep test cd
+	cd local x=1 ${HOME} cd 'quoted text' sed done ${HOME} export --verbose ${HOME}
+		${HOME} then -eu ${HOME} x=1 x=1 export --verbose
+${HOME} export ${HOME} cd local readonly --verbose export sed $(pwd) cd cd /usr/bin
+	printf && -eu local then --verbose printf "$1" local "$1" local x=1 sed local $(pwd)
+		export && && done "$1" 2>/dev/null "$@" sed 2>/dev/null
+		local ${HOME} echo | $(pwd) local export echo export awk && && export test
+		local | "$1" readonly sed "$1" "$@"
+"$1" done x=1 --verbose --verbose
+test awk local grep -eu done 2>/dev/null echo --verbose then --verbose
+		'quoted text' then local echo "$1" grep local -eu && "$@" /usr/bin /usr/bin ${HOME}
+		&& awk done ${HOME} cd sed
+	/usr/bin local printf $(pwd) && "$1" | 'quoted text'
+printf && --verbose /usr/bin x=1 awk --verbose readonly "$@" printf -eu test
+	"$1" | test 2>/dev/null
+	printf $(pwd) sed done cd "$@" local test --verbose export local awk readonly
+"$@" test /usr/bin local /usr/bin local --verbose awk grep done done $(pwd)
+	grep $(pwd) --verbose "$1" "$1" local x=1
+		local $(pwd) x=1 ${HOME} -eu -eu export export test then 'quoted text'
+		x=1 awk export awk "$@" $(pwd) awk awk x=1 x=1 'quoted text' "$@" $(pwd) 'quoted text'
+printf grep grep then sed --verbose sed then export
+		readonly "$@" && cd $(pwd) export sed awk | readonly x=1
+"$@" export printf --verbose | local readonly then
+		grep done ${HOME} "$1" export printf $(pwd) readonly
+	| done -eu test ${HOME} done local test
+local printf readonly ${HOME} "$1" --verbose cd 2>/dev/null printf awk readonly
+"$1" cd 'quoted text' "$@" cd x=1 x=1 test 'quoted text'
+		/usr/bin "$1" echo printf && awk readonly 2>/dev/null --verbose printf /usr/bin
+	awk -eu readonly grep cd echo "$@" | /usr/bin x=1 2>/dev/null echo /usr/bin
+		/usr/bin export -eu --verbose "$1" sed test "$1" local
+		then echo && | | echo $(pwd) $(pwd) --verbose --verbose done local "$@" export
+	-eu grep awk local local /usr/bin test "$@" sed /usr/bin then
+		&& grep --verbose --verbose x=1 --verbose
+	$(pwd) /usr/bin test printf grep
+	grep awk ${HOME} "$@" then $(pwd) --verbose grep -eu done readonly
+	2>/dev/null "$1" "$1" printf export | local 2>/dev/null --verbose
+test 'quoted text' -eu then x=1 done "$@" "$@" awk awk local
+	--verbose readonly grep readonly
+		printf export -eu printf "$1" $(pwd) 2>/dev/null export printf /usr/bin
+	${HOME} "$@" ${HOME} echo echo cd x=1 2>/dev/null
+	'quoted text' sed then echo "$@" then test
+		export test export then | | ${HOME} --verbose 2>/dev/null 2>/dev/null echo
+2>/dev/null "$@" $(pwd) | cd
+	printf readonly $(pwd) local sed 'quoted text'
+		${HOME} readonly | grep
+test sed --verbose 2>/dev/null sed then 'quoted text' 2>/dev/null | &&
+		echo && 2>/dev/null cd | local x=1 sed | /usr/bin 2>/dev/null awk "$@"
+	-eu echo ${HOME} test "$1" then
+		"$@" -eu && printf -eu echo
+done local ${HOME} printf $(pwd) $(pwd) local /usr/bin && sed export export 'quoted text'
+	cd $(pwd) cd cd --verbose --verbose 'quoted text' "$1" local
+	&& 2>/dev/null x=1 "$1" $(pwd) grep local awk
+	readonly ${HOME} 2>/dev/null | $(pwd) then printf awk awk test sed | /usr/bin
+awk readonly test x=1 /usr/bin readonly x=1
+		${HOME} --verbose local --verbose 2>/dev/null local 'quoted text'
+	${HOME} ${HOME} printf sed | --verbose
+2>/dev/null ${HOME} 'quoted text'
+		grep | "$1" | && cd x=1 --verbose grep
+cd | | -eu "$@" echo "$1" -eu --verbose cd done "$1" x=1 2>/dev/null && ${HOME}
+	$(pwd) ${HOME} sed test then
+-eu "$@" awk printf sed printf --verbose awk
+	'quoted text' printf test then export && test
+	--verbose /usr/bin readonly x=1 "$@" awk 'quoted text'
+	awk && cd --verbose readonly readonly && && "$@" ${HOME}
@@ -0,0 +1,2001 @@
+		printf awk | ${HOME} readonly $(pwd) $(pwd)
+	sed cd local 2>/dev/null | done x=1 --verbose && ${HOME} cd 'quoted text'
+	2>/dev/null x=1 'quoted text' | then | sed "$@"
+		--verbose --verbose ${HOME} export ${HOME} && export awk $(pwd) 'quoted text'
+		then x=1 -eu echo "$@" --verbose echo cd export && $(pwd) readonly
+	done awk readonly done &&
+	export && sed done cd readonly awk cd
+&& export echo 2>/dev/null
+"$@" 2>/dev/null local && -eu | grep "$1" test
+		/usr/bin local sed then printf printf x=1 -eu readonly done ${HOME} 'quoted text'
+	echo local 'quoted text'
+		2>/dev/null 2>/dev/null && /usr/bin cd printf cd 2>/dev/null test && awk 2>/dev/null
+	-eu -eu /usr/bin test ${HOME} cd 2>/dev/null cd local /usr/bin
+	&& printf "$1" "$1" $(pwd) "$1" --verbose then "$@" export local
+		/usr/bin export --verbose
+-eu x=1 && export test echo echo -eu awk done done sed && export &&
+		--verbose "$1" /usr/bin | done
+readonly ${HOME} cd printf awk export then --verbose 2>/dev/null
+$(pwd) $(pwd) sed ${HOME} test then x=1 printf ${HOME} export then grep export "$1"
+		printf -eu $(pwd) "$1" $(pwd) "$@" $(pwd)
+	x=1 echo 2>/dev/null sed then awk
+	| sed then readonly readonly echo 2>/dev/null 2>/dev/null $(pwd) && --verbose
+"$@" printf readonly -eu x=1 && grep && "$1" 'quoted text' done then "$1"
+	2>/dev/null --verbose $(pwd) then "$1" 2>/dev/null
+export export --verbose ${HOME} --verbose export /usr/bin |
+	then awk --verbose printf "$1" awk && x=1 'quoted text'
+		test printf && 'quoted text'
+x=1 printf "$1" cd grep then local --verbose
+	2>/dev/null export printf /usr/bin
+	-eu sed --verbose /usr/bin $(pwd) then x=1 2>/dev/null --verbose $(pwd) test cd
+cd x=1 echo awk readonly then then echo $(pwd) 2>/dev/null cd local
+test 'quoted text' echo --verbose 'quoted text' export $(pwd) done
+done awk printf "$@" x=1 test then cd export | $(pwd) 'quoted text'
+	cd test && ${HOME} --verbose $(pwd) 'quoted text' ${HOME} local
+	--verbose cd printf test export test "$@" printf $(pwd) grep
+grep 'quoted text' "$@" echo
+		export /usr/bin awk ${HOME}
+	test ${HOME} sed awk echo | awk readonly readonly test done /usr/bin
+	${HOME} ${HOME} $(pwd) awk grep && then then test cd readonly sed echo
+		$(pwd) && /usr/bin local cd ${HOME} | printf export then export
+		$(pwd) 2>/dev/null "$1"
+	cd /usr/bin 'quoted text'
+	2>/dev/null 'quoted text'
+	$(pwd) local then awk --verbose then echo "$1" sed local done
+${HOME} cd sed 2>/dev/null ${HOME}
+cd 'quoted text' 'quoted text' && cd $(pwd) awk test
+"$@" cd then | | $(pwd) export then "$@" then "$@" 2>/dev/null
+		2>/dev/null sed 'quoted text' 'quoted text'
+2>/dev/null readonly cd -eu x=1 -eu | /usr/bin "$@" test /usr/bin readonly
+	x=1 -eu "$1" then local "$1" sed local -eu "$1" /usr/bin ${HOME}
+	test ${HOME} /usr/bin 'quoted text' /usr/bin awk | "$1" test 'quoted text' sed
+		readonly done x=1 readonly grep | done
+	echo $(pwd) 'quoted text' /usr/bin test && done
+--verbose | ${HOME} grep
+grep cd done -eu done export readonly local
+	test x=1 printf cd "$@" cd /usr/bin 2>/dev/null
+		$(pwd) "$@" done $(pwd) ${HOME}
+"$1" local cd ${HOME} 'quoted text' --verbose 2>/dev/null
+	&& x=1 export printf $(pwd) echo
+grep && 'quoted text' printf
+local sed /usr/bin "$1" printf then grep local local done sed --verbose |
+		readonly local && /usr/bin
+done "$1" "$@" ${HOME} /usr/bin echo printf 'quoted text' -eu
+	then ${HOME} sed echo then x=1 | 2>/dev/null done cd x=1 echo --verbose
+		local --verbose done $(pwd) test -eu | printf 2>/dev/null grep cd &&
+		printf x=1 export 'quoted text' cd
+'quoted text' printf "$@" test
+		then done done x=1 /usr/bin export
+-eu 2>/dev/null /usr/bin
+	export echo 'quoted text' 'quoted text' cd /usr/bin done
+		/usr/bin cd --verbose -eu $(pwd) /usr/bin
+"$1" /usr/bin printf "$@" | cd 2>/dev/null
+	grep local local 'quoted text'
+grep export grep /usr/bin | $(pwd) ${HOME}
+| | awk test done test readonly | echo export export /usr/bin
+cd sed /usr/bin "$1" x=1 x=1 "$1" local "$@"
+	/usr/bin export ${HOME} 'quoted text'
+		'quoted text' | sed then "$1" /usr/bin --verbose
+	grep -eu 'quoted text' local ${HOME} test test printf /usr/bin
+test sed --verbose --verbose |
+		-eu ${HOME} -eu readonly printf && --verbose
+	"$1" -eu "$@" | && echo && local test "$1" 'quoted text'
+		-eu 2>/dev/null && test $(pwd) then ${HOME} && test export
+		2>/dev/null printf "$1" --verbose readonly /usr/bin done "$1" echo then done awk
+local | 'quoted text' --verbose
+		--verbose $(pwd) /usr/bin ${HOME} echo x=1 "$1" -eu --verbose &&
+	'quoted text' local readonly | done && readonly awk x=1 "$@" --verbose --verbose
+&& "$1" awk printf echo sed -eu $(pwd) awk 'quoted text'
+"$1" -eu local | ${HOME} 'quoted text' awk local test awk "$1"
+		cd --verbose then test grep printf export then sed 2>/dev/null
+"$1" local --verbose then "$1" done echo 2>/dev/null
+export readonly test | done && done local
+| then sed ${HOME} printf "$1" local export
+-eu --verbose echo grep /usr/bin readonly then ${HOME}
+--verbose 2>/dev/null x=1 echo $(pwd) test
+2>/dev/null "$1" $(pwd) awk sed --verbose --verbose $(pwd) then
+		$(pwd) then done test local
+		awk && awk readonly grep cd
+		| "$1" test awk | awk x=1
+	test && && readonly export awk "$1" --verbose $(pwd) echo grep readonly x=1
+--verbose local --verbose
+	--verbose readonly grep echo readonly "$1" 2>/dev/null echo cd local printf x=1
+		| readonly test then grep --verbose
+	"$1" echo done then ${HOME} readonly && 2>/dev/null
+	export x=1 grep $(pwd) local readonly ${HOME}
+	readonly echo x=1 then printf
+	export 2>/dev/null then x=1 export && /usr/bin ${HOME} done local $(pwd)
+		then 2>/dev/null | local done && export
+		$(pwd) done 'quoted text'
+		2>/dev/null --verbose $(pwd) && | /usr/bin sed grep
+	| export | -eu -eu done awk -eu "$1" grep
+	$(pwd) then then local sed echo grep 2>/dev/null /usr/bin $(pwd)
+	done ${HOME} && local $(pwd)
+		sed /usr/bin | $(pwd) cd export sed export ${HOME} test then test readonly -eu sed
+"$@" test --verbose cd ${HOME} local -eu "$1" | $(pwd)
+		&& && then x=1 2>/dev/null --verbose export x=1 $(pwd) export
+		export export 2>/dev/null 2>/dev/null && sed cd export
+		2>/dev/null grep awk export 2>/dev/null 'quoted text' 2>/dev/null
+		local 2>/dev/null /usr/bin
+	readonly ${HOME} cd 2>/dev/null awk $(pwd) then "$@" ${HOME} "$@"
+		local readonly readonly then 'quoted text' cd echo && 2>/dev/null
+	2>/dev/null $(pwd) 2>/dev/null x=1 cd
+	"$1" --verbose cd done "$1" 2>/dev/null x=1 "$1" 2>/dev/null "$@" ${HOME} x=1
+	${HOME} export awk grep /usr/bin readonly /usr/bin awk ${HOME} | done $(pwd)
+		export && 'quoted text' $(pwd) done $(pwd) cd export /usr/bin
+local "$1" "$@" x=1 -eu -eu ${HOME}
+	| then readonly --verbose grep 2>/dev/null done "$1"
+then then /usr/bin local
+export x=1 echo 'quoted text' | -eu /usr/bin 'quoted text' /usr/bin x=1 -eu
+echo then -eu /usr/bin export
+-eu then --verbose 2>/dev/null then $(pwd) -eu $(pwd)
+	2>/dev/null test test printf -eu
+		--verbose 'quoted text'
+$(pwd) $(pwd) | sed "$1" --verbose awk echo
+	readonly --verbose -eu
+	then "$1" local x=1 /usr/bin $(pwd) grep
+		printf grep /usr/bin sed -eu export ${HOME} test local -eu "$@" local && grep 2>/dev/null
+	2>/dev/null awk --verbose | grep local
+| 2>/dev/null ${HOME} sed $(pwd) readonly 'quoted text' && x=1 -eu -eu sed
+		/usr/bin sed done grep grep "$@" 'quoted text' test $(pwd) then && echo
+	"$@" echo then done printf 'quoted text'
+"$@" done x=1 && sed /usr/bin "$@" -eu
+sed test /usr/bin readonly x=1 $(pwd) $(pwd) -eu 2>/dev/null
+		readonly 'quoted text' grep x=1 --verbose done --verbose 'quoted text'
+		echo "$1" /usr/bin && "$@" test ${HOME} $(pwd) grep cd && sed --verbose --verbose
+	"$1" printf test sed printf awk ${HOME}
+		sed echo cd --verbose -eu x=1 awk "$1" readonly x=1
+local printf cd /usr/bin --verbose 'quoted text' -eu "$@" 'quoted text'
+		/usr/bin && printf && "$1" "$@" readonly
+"$1" sed echo | ${HOME} "$@" printf x=1
+done 2>/dev/null 2>/dev/null local printf && | grep test
+	"$@" && -eu x=1 x=1 'quoted text' local x=1 $(pwd)
+	/usr/bin cd printf printf done ${HOME} "$@" export ${HOME} then /usr/bin "$@"
+sed cd | printf $(pwd) grep local x=1 awk 2>/dev/null awk echo 2>/dev/null local
+	-eu -eu $(pwd) then test ${HOME} test ${HOME} echo /usr/bin | then 'quoted text'
+		| then && && cd "$1" printf awk -eu x=1 cd
+awk printf echo -eu echo 'quoted text' | echo export 2>/dev/null 'quoted text'
+&& test readonly grep grep then printf export
+		awk then readonly awk 'quoted text' ${HOME}
+		done then test test local printf $(pwd) "$1" then 2>/dev/null
+	done done awk sed sed | $(pwd) printf 2>/dev/null | && | grep
+		$(pwd) 2>/dev/null echo ${HOME} awk 'quoted text'
+	${HOME} done "$@" awk --verbose
+	readonly grep sed "$1" --verbose $(pwd)
+	local local then | 2>/dev/null grep readonly grep grep export --verbose awk
+		awk 'quoted text' 'quoted text' ${HOME} readonly --verbose "$1" readonly export
+		export ${HOME} 2>/dev/null test test $(pwd) && "$1" --verbose
+		readonly then readonly then sed awk ${HOME} awk echo --verbose
+	test cd cd then readonly 2>/dev/null awk "$1" printf
+		&& sed ${HOME} -eu /usr/bin echo 'quoted text' done grep -eu echo sed --verbose
+	$(pwd) 'quoted text' printf done -eu $(pwd) readonly $(pwd)
+		x=1 then x=1 | local readonly --verbose
+		--verbose grep printf && test
+		echo then | then 'quoted text' /usr/bin
+sed grep awk printf /usr/bin sed done 'quoted text' local local "$@" done
+| sed cd cd && ${HOME} cd readonly
+done /usr/bin ${HOME} -eu test grep "$@"
+		"$@" sed /usr/bin test 2>/dev/null
+	/usr/bin readonly awk sed && "$1" 'quoted text' grep --verbose export
+	2>/dev/null --verbose export x=1 -eu 'quoted text'
+		readonly ${HOME} "$@" ${HOME} then local /usr/bin test
+'quoted text' "$@" then local -eu printf ${HOME} -eu -eu "$1" cd
+-eu sed "$@" printf "$@" | done -eu $(pwd)
+		'quoted text' printf $(pwd) && printf
+/usr/bin echo printf local 2>/dev/null done 2>/dev/null 2>/dev/null "$1"
+		grep test awk then grep echo | then 'quoted text'
+		/usr/bin done && && 'quoted text' /usr/bin
+	&& -eu x=1 /usr/bin 2>/dev/null "$1" echo done
+--verbose echo | then echo "$@" "$1" 2>/dev/null /usr/bin printf x=1 grep
+		-eu awk awk -eu | 2>/dev/null "$1" then
+	-eu awk x=1 done && cd cd $(pwd) | local grep "$@" sed export x=1
+		sed && grep grep /usr/bin sed ${HOME}
+	2>/dev/null grep sed echo --verbose done "$1" -eu echo readonly awk 'quoted text'
+	&& x=1 printf --verbose then readonly && then
+	/usr/bin test export local done grep "$1" | "$@" &&
+"$@" "$@" done then local done readonly /usr/bin x=1 printf
+	x=1 then grep && "$1" printf | 2>/dev/null then --verbose x=1 | && readonly
+	test test "$1" && 'quoted text' -eu readonly test && ${HOME} "$@"
+	"$1" awk printf awk -eu readonly /usr/bin 2>/dev/null -eu
+| --verbose printf -eu cd ${HOME} "$1" ${HOME} local |
+		sed test 'quoted text' && /usr/bin --verbose
+	done readonly printf local sed /usr/bin 'quoted text'
+	-eu 2>/dev/null x=1 export
+cd then --verbose -eu /usr/bin x=1 "$@" printf export "$1" done 'quoted text'
+	echo 'quoted text' /usr/bin ${HOME} echo sed awk $(pwd) export 'quoted text'
+		$(pwd) cd --verbose -eu "$1" then
+printf --verbose echo --verbose $(pwd) --verbose --verbose printf done echo test
+		$(pwd) 2>/dev/null echo --verbose
+		$(pwd) then x=1 -eu -eu
+	-eu readonly /usr/bin test done -eu --verbose ${HOME} --verbose
+local done | $(pwd) awk grep | cd printf &&
+export cd echo ${HOME} $(pwd) $(pwd) echo "$1" test test readonly x=1 sed
+test cd done "$@" local test --verbose awk --verbose 2>/dev/null done
+		then 2>/dev/null | cd "$@" export printf
+	readonly cd export 'quoted text'
+"$1" $(pwd) ${HOME} 2>/dev/null x=1 grep sed 2>/dev/null $(pwd)
+	/usr/bin $(pwd) | then readonly readonly readonly ${HOME} awk done
+		"$@" x=1 sed 'quoted text' then done
+		/usr/bin --verbose | grep then | grep done printf /usr/bin
+		--verbose "$1" cd ${HOME} readonly
+		'quoted text' "$1" printf readonly "$@"
+		$(pwd) 2>/dev/null local echo test export test
+echo sed $(pwd) x=1 test
+x=1 awk "$1" -eu 2>/dev/null test grep readonly $(pwd) 2>/dev/null
+	'quoted text' then grep readonly test --verbose test "$@" ${HOME} sed printf "$@"
+	"$@" awk printf echo "$@" "$@" done | $(pwd) ${HOME} -eu done
+	done done cd export sed readonly ${HOME} cd done "$@" done && /usr/bin
+		${HOME} 2>/dev/null 'quoted text' --verbose
+$(pwd) awk done | printf "$1" "$@"
+done done ${HOME} 'quoted text' echo x=1
+	/usr/bin grep 2>/dev/null $(pwd) 'quoted text'
+	sed && x=1 then then -eu --verbose sed readonly echo test $(pwd)
+		-eu --verbose export test x=1 export test x=1 export "$1" grep --verbose test
+		&& 2>/dev/null readonly test | sed local grep done --verbose --verbose local
+		then 'quoted text' awk echo awk x=1 -eu then ${HOME} | done "$@"
+	${HOME} x=1 local 'quoted text' readonly ${HOME} && export
+		| && && --verbose export $(pwd) readonly x=1 readonly then
+	/usr/bin /usr/bin export && 2>/dev/null
+	$(pwd) 'quoted text' done awk | 2>/dev/null
+	readonly /usr/bin "$1" 2>/dev/null
+	| /usr/bin "$@" -eu then cd cd x=1 local sed $(pwd) local "$1" readonly export
+	awk 'quoted text' printf echo
+'quoted text' sed local "$@" done grep -eu readonly
+		printf x=1 export -eu 'quoted text' $(pwd) /usr/bin
+		then ${HOME} x=1 /usr/bin export test printf --verbose 2>/dev/null x=1
+export /usr/bin cd "$1" then x=1 2>/dev/null ${HOME} 2>/dev/null | printf
+	done "$@" local x=1 done awk
+"$@" && /usr/bin then cd -eu printf "$1" sed -eu sed export cd "$@"
+		local done test local test test ${HOME} x=1 done 'quoted text' local local
+	&& export awk "$@" awk x=1 "$1" then && echo sed && 'quoted text' echo then
+&& | test && ${HOME} then $(pwd) 2>/dev/null --verbose
+	| export readonly -eu x=1 "$1"
+		--verbose $(pwd) | && $(pwd) export $(pwd) x=1
+x=1 2>/dev/null | awk $(pwd) 2>/dev/null /usr/bin test grep 'quoted text'
+	local local --verbose local | export done local then 'quoted text' grep 2>/dev/null
+	--verbose export "$@" readonly then "$@" | sed "$@" test 2>/dev/null 'quoted text'
+		awk --verbose | "$1" && grep done echo export export
+		then && done sed | then grep
+'quoted text' "$@" -eu -eu && "$@" "$1"
+| printf printf then readonly && grep local local cd grep printf readonly 'quoted text'
+		'quoted text' awk export 2>/dev/null && export export
+echo | 'quoted text' x=1 -eu | sed done echo readonly export ${HOME} awk sed
+	echo test --verbose cd local "$@" echo printf
+	-eu printf grep readonly
+	&& /usr/bin echo printf "$1" "$@" export 2>/dev/null /usr/bin
+'quoted text' echo echo cd $(pwd) cd test done export cd cd
+		readonly 'quoted text' export then
+		'quoted text' | local --verbose readonly echo grep "$@" "$1"
+	done awk then done grep
+	export | printf then /usr/bin test readonly cd
+		"$1" readonly -eu 'quoted text'
+test && local export && --verbose
+sed test --verbose grep then
+	readonly export 2>/dev/null $(pwd) ${HOME} readonly sed && $(pwd)
+		$(pwd) 'quoted text' x=1
+sed sed | grep 2>/dev/null "$@" 'quoted text'
+		echo echo cd 2>/dev/null printf cd test export $(pwd) x=1 $(pwd) x=1
+-eu test then printf ${HOME}
+	grep 'quoted text' grep -eu && test awk x=1
+sed "$1" test --verbose | x=1
+	x=1 cd 2>/dev/null test 2>/dev/null cd
+"$@" awk then x=1 awk 'quoted text' --verbose 'quoted text'
+test sed export grep ${HOME} sed "$@" 'quoted text' echo
+	done awk && then --verbose cd export grep ${HOME}
+		| export printf --verbose printf echo test 2>/dev/null --verbose
+test echo then "$1" printf "$1" printf export sed
+grep ${HOME} --verbose
+		/usr/bin x=1 -eu /usr/bin then done cd $(pwd) --verbose awk
+		'quoted text' export && "$1" $(pwd) grep -eu $(pwd) echo "$@" local x=1
+sed $(pwd) $(pwd) x=1 test echo "$@" "$@" $(pwd) 'quoted text'
+"$1" /usr/bin grep grep then test --verbose 2>/dev/null
+cd grep done 2>/dev/null readonly
+		--verbose echo local "$@" grep --verbose
+		--verbose test export sed readonly awk echo
+		test /usr/bin --verbose ${HOME} test printf echo
+export | done | printf done readonly export local -eu then readonly 2>/dev/null
+"$@" sed /usr/bin 'quoted text' $(pwd) echo "$@" readonly readonly
+	awk local 2>/dev/null cd 2>/dev/null cd test && awk
+	"$@" -eu printf 2>/dev/null 2>/dev/null grep sed $(pwd) readonly local
+echo $(pwd) echo done "$1" ${HOME} sed x=1 x=1 local -eu ${HOME} &&
+cd /usr/bin && cd $(pwd) 2>/dev/null
+		"$@" readonly sed printf "$1"
+	&& echo ${HOME} --verbose
+	readonly done local test awk awk ${HOME} $(pwd)
+		--verbose local export export 2>/dev/null
+	&& sed --verbose -eu $(pwd) ${HOME} grep
+cd -eu then done awk | "$@" --verbose
+		grep | "$1" ${HOME} done --verbose grep done
+	local echo then --verbose readonly
+$(pwd) grep "$@" 2>/dev/null $(pwd) cd | grep $(pwd)
+	2>/dev/null "$@" echo then 'quoted text' awk
+		--verbose "$@" done readonly -eu export /usr/bin
+		-eu cd grep /usr/bin readonly
+--verbose export ${HOME} done awk then sed "$1"
+		'quoted text' "$1" printf $(pwd) grep --verbose ${HOME} local -eu readonly
+printf readonly --verbose $(pwd) ${HOME} x=1 -eu printf
+	$(pwd) -eu done --verbose printf readonly
+x=1 --verbose --verbose "$@" $(pwd) /usr/bin done local
+done 'quoted text' echo export awk test && --verbose
+	export 2>/dev/null test export test done && "$1" 2>/dev/null done "$@"
+printf cd export x=1 $(pwd) test ${HOME}
+done echo | && then readonly "$@"
+		| sed | readonly /usr/bin $(pwd) echo awk --verbose printf 'quoted text' local
+		done 'quoted text' cd export export --verbose
+	"$1" printf grep -eu grep 'quoted text' sed grep echo grep then | | -eu local
+		sed -eu ${HOME} printf |
+"$1" export grep test then ${HOME}
+	-eu readonly 'quoted text' export
+	&& awk awk "$1" test printf grep done
+	&& printf "$1" local test awk 'quoted text'
+then && "$1" ${HOME} ${HOME} -eu "$1" done "$@" "$@" done printf /usr/bin
+		cd awk ${HOME} ${HOME} then x=1 /usr/bin awk
+		echo export export export -eu printf ${HOME} 2>/dev/null && test test readonly
+	"$1" 2>/dev/null grep
+	$(pwd) | && local test then "$@" grep printf echo
+test echo local x=1 sed sed 2>/dev/null grep echo "$@" 2>/dev/null
+test cd echo "$1" done test 'quoted text' /usr/bin
+printf grep ${HOME} readonly done /usr/bin -eu done 2>/dev/null export done export
+	done awk "$@" sed local | grep | "$@" 2>/dev/null ${HOME} test grep &&
+echo /usr/bin | 'quoted text'
+"$@" 2>/dev/null then then "$@" /usr/bin $(pwd) 2>/dev/null echo ${HOME}
+	then /usr/bin ${HOME} then ${HOME}
+	$(pwd) echo 'quoted text' readonly readonly printf then
+test grep printf local $(pwd) && x=1 done x=1 ${HOME} export done
+	export readonly x=1 | -eu awk -eu -eu
+	local -eu $(pwd) sed printf | -eu
+		then echo -eu then /usr/bin readonly "$1" 2>/dev/null sed awk printf printf
+	then "$@" test "$@" ${HOME} echo --verbose printf x=1 grep sed local | /usr/bin
+		'quoted text' -eu done 2>/dev/null
+done ${HOME} test readonly ${HOME}
+		--verbose 2>/dev/null 'quoted text' x=1 "$@" "$1"
+	done cd cd | grep /usr/bin awk export
+		readonly done test awk x=1 'quoted text' done echo --verbose $(pwd) && 'quoted text'
+		x=1 local export --verbose $(pwd) --verbose && cd sed done --verbose &&
+'quoted text' x=1 ${HOME} echo printf done --verbose echo "$1" -eu 2>/dev/null
+		x=1 echo test 'quoted text' grep 'quoted text' readonly
+	done "$@" --verbose grep 2>/dev/null "$@" awk
+${HOME} 2>/dev/null grep readonly "$@" -eu
+		/usr/bin cd "$1" 2>/dev/null cd done /usr/bin
+	'quoted text' $(pwd) "$@" | ${HOME}
+x=1 cd -eu ${HOME} then printf ${HOME} then | -eu --verbose
+		| x=1 test then cd x=1 awk
+	test printf && | "$@" | test
+$(pwd) done readonly echo | 2>/dev/null "$1" ${HOME} "$1" ${HOME}
+2>/dev/null then 2>/dev/null --verbose -eu
+x=1 cd 'quoted text' && export readonly awk then printf local 2>/dev/null
+		/usr/bin 2>/dev/null "$1" cd test "$@"
+--verbose sed cd awk export -eu test | --verbose echo
+		-eu grep --verbose $(pwd) echo grep "$@" readonly "$@" | export test
+	echo 2>/dev/null cd -eu -eu local printf 2>/dev/null
+echo sed | 'quoted text' 'quoted text' -eu grep export "$@"
+	sed awk -eu 'quoted text' && 'quoted text' echo x=1 $(pwd) echo
+'quoted text' done "$@" x=1 export 2>/dev/null cd sed /usr/bin "$@" "$@"
+$(pwd) x=1 | $(pwd) then $(pwd) cd x=1 && 2>/dev/null "$@" "$1"
+		--verbose "$1" cd && --verbose readonly
+		awk x=1 done export then test cd sed awk 2>/dev/null | done echo
+	local | awk --verbose local echo done "$@" ${HOME} 'quoted text' --verbose
+		x=1 printf ${HOME} | printf export --verbose grep awk | ${HOME}
+-eu 'quoted text' grep echo $(pwd) grep ${HOME}
+'quoted text' --verbose sed -eu ${HOME} && cd printf /usr/bin
+		-eu ${HOME} x=1 && x=1 | ${HOME} sed $(pwd) 2>/dev/null -eu /usr/bin
+	export test "$1" cd x=1 then | local x=1 echo x=1 sed
+	cd sed "$1" local printf -eu then printf $(pwd) then /usr/bin -eu $(pwd) $(pwd)
+		${HOME} done --verbose test awk -eu done | readonly x=1 "$@" && ${HOME} $(pwd)
+	printf printf /usr/bin echo sed printf then test 2>/dev/null
+	--verbose "$1" export | local ${HOME} done printf "$1" cd 'quoted text'
+	sed echo printf "$1" echo sed
+	x=1 done local grep export $(pwd) printf --verbose cd ${HOME} export
+		${HOME} awk && ${HOME} "$1" then
+		/usr/bin $(pwd) then && export grep sed grep export $(pwd)
+cd x=1 $(pwd) cd sed awk -eu local $(pwd) 'quoted text' awk
+		"$1" && awk cd done cd ${HOME} done local /usr/bin test --verbose /usr/bin
+		&& grep -eu grep x=1 "$1" "$1" | grep test readonly
+	local sed cd 2>/dev/null readonly then | ${HOME}
+grep ${HOME} x=1 | -eu echo
+	test echo grep "$@" then awk $(pwd) "$@"
+		"$@" /usr/bin readonly awk | |
+	printf "$1" -eu readonly $(pwd) "$@" local
+		x=1 --verbose printf readonly readonly x=1 echo 2>/dev/null
+		echo /usr/bin x=1 2>/dev/null sed -eu done export test
+		test "$1" readonly then
+		local 'quoted text' local printf awk done awk printf
+| local test done test awk $(pwd) export sed echo export --verbose
+	done echo /usr/bin then then $(pwd) ${HOME} 'quoted text' export
+	export echo cd awk local done echo then /usr/bin done $(pwd) readonly
+		then awk "$@" | cd done grep --verbose awk "$1" sed 'quoted text' 2>/dev/null
+	echo sed done export && export
+done "$1" x=1 sed 'quoted text' x=1
+test /usr/bin local --verbose && grep "$@"
+readonly awk then then 2>/dev/null
+printf ${HOME} "$@" $(pwd) "$@" x=1
+	2>/dev/null | printf --verbose awk
+	| echo ${HOME} done 'quoted text' sed awk done | /usr/bin awk readonly 2>/dev/null
+export cd cd awk then echo cd --verbose "$@" test &&
+readonly 2>/dev/null echo cd
+	$(pwd) echo $(pwd) readonly "$1" echo
+		x=1 --verbose -eu local printf then echo /usr/bin sed awk
+		then --verbose --verbose
+	awk grep | 'quoted text' cd --verbose $(pwd) then cd grep local
+echo grep /usr/bin local printf
+		test | done $(pwd) done done test -eu cd -eu ${HOME} local cd
+		then export export $(pwd) && then local
+		test "$1" 2>/dev/null "$1" /usr/bin && cd readonly x=1 -eu
+	&& readonly "$1" | --verbose $(pwd)
+		sed sed /usr/bin done test $(pwd) readonly
+x=1 "$1" "$1" --verbose
+| "$@" ${HOME} then then
+export then /usr/bin export x=1 awk | | $(pwd) cd ${HOME} "$@" $(pwd)
+		done done -eu readonly
+		--verbose local done $(pwd)
+done x=1 echo --verbose "$1" 2>/dev/null 'quoted text' local
+		local -eu sed | $(pwd) awk done printf "$1" &&
+	export grep cd /usr/bin
+		awk test "$1" x=1 echo "$@" then
+	'quoted text' then local
+	/usr/bin 2>/dev/null local
+$(pwd) 2>/dev/null readonly sed --verbose done cd
+2>/dev/null awk -eu ${HOME} awk x=1 grep -eu $(pwd) /usr/bin 'quoted text'
+test local sed && readonly done "$@" readonly readonly grep printf "$1" test
+x=1 $(pwd) local "$1"
+		${HOME} 2>/dev/null | -eu printf $(pwd) x=1 echo x=1 ${HOME} --verbose
+	then ${HOME} test test printf ${HOME} local | |
+	$(pwd) grep sed sed test "$1" readonly -eu echo readonly awk
+		cd then sed x=1 2>/dev/null awk then grep cd "$1"
+		/usr/bin printf printf readonly && /usr/bin
+"$1" "$@" $(pwd) done done
+	echo grep test then then 'quoted text' && grep "$@"
+		printf done sed readonly -eu "$1" $(pwd) sed readonly cd echo export "$@" grep
+		readonly -eu then /usr/bin export "$1" $(pwd) ${HOME} local
+	awk done grep done | ${HOME} grep grep printf
+	cd -eu grep -eu && local grep local
+	2>/dev/null "$1" x=1 2>/dev/null done --verbose
+		readonly "$1" grep 'quoted text' grep $(pwd) 'quoted text'
+	awk done x=1 echo | test sed x=1 printf
+		done ${HOME} sed sed /usr/bin
+-eu 2>/dev/null && echo readonly 2>/dev/null then "$@"
+	echo "$1" readonly grep ${HOME} ${HOME} test readonly $(pwd) awk cd
+| 'quoted text' --verbose sed && "$@" --verbose printf test 2>/dev/null
+awk cd "$1" --verbose --verbose done cd printf 2>/dev/null "$@" test
+test && ${HOME} local 'quoted text' local -eu then 'quoted text'
+	test --verbose readonly echo 2>/dev/null
+done cd echo printf "$1" local --verbose export && "$@" awk
+awk then awk | awk then grep echo --verbose
+		sed printf $(pwd) readonly x=1 readonly echo printf --verbose -eu
+| echo "$@" then awk then then -eu 2>/dev/null cd "$@" local
+		local sed test 2>/dev/null 2>/dev/null --verbose printf 'quoted text'
+	-eu awk $(pwd) test echo /usr/bin export test printf grep awk
+		"$@" x=1 --verbose printf export "$1" $(pwd) && readonly then
+		cd 2>/dev/null echo printf awk "$1" then export awk x=1 readonly
+		grep cd awk -eu 2>/dev/null 2>/dev/null /usr/bin echo printf echo
+awk grep | | awk readonly echo 2>/dev/null 2>/dev/null "$1" "$@" "$1" --verbose
+		&& "$1" "$@" "$@" "$@" 2>/dev/null export $(pwd) echo done then test sed cd --verbose
+-eu "$1" printf && "$@" awk && -eu local export x=1 local sed readonly
+	&& -eu $(pwd) sed | | | && done
+		--verbose $(pwd) test /usr/bin $(pwd)
+		export "$1" cd cd /usr/bin --verbose then --verbose local -eu printf
+"$@" /usr/bin test x=1 then printf
+		then export "$@" echo cd 2>/dev/null &&
+then "$@" sed "$1" "$1" sed readonly readonly $(pwd) printf printf export x=1 echo
+--verbose --verbose cd && x=1 export $(pwd) grep then 'quoted text' done
+		"$@" ${HOME} local export cd | ${HOME} "$@" ${HOME} ${HOME}
+	${HOME} "$@" then && then done /usr/bin 2>/dev/null
+test x=1 /usr/bin 2>/dev/null test "$1" 2>/dev/null "$1" test x=1 -eu done
+-eu ${HOME} -eu | awk $(pwd) | test && awk 'quoted text' -eu | ${HOME} cd
+	then /usr/bin "$1" /usr/bin -eu then --verbose && 2>/dev/null $(pwd)
+		2>/dev/null x=1 && then x=1 'quoted text' /usr/bin -eu awk && readonly
+	sed 2>/dev/null local done test sed export local cd sed x=1 readonly
+x=1 ${HOME} readonly "$1" local && --verbose test
+		cd -eu 2>/dev/null grep readonly
+printf echo readonly "$1" /usr/bin sed readonly grep 'quoted text'
+	echo /usr/bin "$1" "$@" "$1" 'quoted text' then grep export
+sed 2>/dev/null readonly sed && "$1"
+		'quoted text' echo "$@" --verbose sed
+	awk grep -eu local "$@"
+then echo 'quoted text' x=1 done 'quoted text'
+	| 'quoted text' $(pwd) --verbose export | -eu ${HOME} --verbose test
+		--verbose | && local then "$@" test
+| | 'quoted text' grep
+		&& test test local cd --verbose --verbose cd
+	done 2>/dev/null local echo grep grep test && awk printf | readonly
+	&& "$1" test /usr/bin | echo $(pwd) 'quoted text'
+		'quoted text' ${HOME} export | test --verbose x=1 echo "$@" && "$1" "$@"
+		"$@" done --verbose -eu "$@" done --verbose 'quoted text' local ${HOME} | printf
+	done export export readonly export --verbose export
+	'quoted text' done x=1 "$@" "$@" | 2>/dev/null
+		printf awk ${HOME} "$@" local && x=1
+	test grep "$1" 'quoted text' /usr/bin "$1" 2>/dev/null -eu awk "$@" ${HOME}
+	-eu done 'quoted text' export $(pwd)
+		grep x=1 "$1" readonly grep --verbose 'quoted text'
+-eu $(pwd) && export readonly | cd -eu "$@" sed | export x=1 echo
+test then 2>/dev/null /usr/bin | x=1 echo $(pwd) readonly | grep "$1" then
+x=1 ${HOME} cd export sed "$@" $(pwd) awk readonly
+		readonly "$@" test 2>/dev/null sed test done 2>/dev/null | && 2>/dev/null echo
+	test then ${HOME} /usr/bin x=1 local "$1" readonly awk sed printf |
+done --verbose export --verbose 'quoted text' /usr/bin
+		sed $(pwd) "$1" -eu "$1" sed grep then local $(pwd) readonly && && ${HOME} x=1
+'quoted text' 2>/dev/null readonly -eu printf printf cd $(pwd) -eu
+x=1 printf /usr/bin $(pwd) $(pwd) then "$1" done x=1 "$1"
+printf local ${HOME} "$1" ${HOME} 2>/dev/null then sed /usr/bin sed local awk awk
+		export /usr/bin --verbose -eu /usr/bin 2>/dev/null | awk | 2>/dev/null --verbose
+		test "$1" sed printf grep 2>/dev/null
+		-eu cd x=1 -eu /usr/bin test cd echo then done
+		-eu 2>/dev/null -eu && | | cd
+		export sed $(pwd) "$@" /usr/bin then readonly 2>/dev/null grep
+		printf "$1" test ${HOME} grep export test --verbose /usr/bin then sed
+		x=1 sed --verbose then readonly local awk /usr/bin done -eu sed "$@" echo 2>/dev/null
+'quoted text' awk cd done "$1" readonly sed $(pwd) export -eu "$1"
+	test $(pwd) --verbose && $(pwd) export
+	export then "$1" cd x=1 test 2>/dev/null
+	--verbose /usr/bin done cd "$@" | ${HOME} cd 'quoted text' printf ${HOME}
+done local readonly && awk && --verbose awk test
+	${HOME} "$1" printf local local
+	2>/dev/null 'quoted text' x=1 printf
+	echo sed 2>/dev/null test "$1" test grep then done
+		local | then cd "$1" cd && /usr/bin /usr/bin
+		/usr/bin /usr/bin --verbose done "$@" readonly then
+awk 2>/dev/null /usr/bin "$@" printf x=1
+| && readonly && /usr/bin && "$1" export "$1"
+		awk ${HOME} then "$1" x=1 then then echo 2>/dev/null 'quoted text' grep -eu cd
+		| "$1" awk export sed 'quoted text' awk 2>/dev/null
+printf x=1 'quoted text' grep /usr/bin done /usr/bin sed
+-eu --verbose printf local local
+sed cd echo then echo 2>/dev/null readonly
+	"$@" $(pwd) -eu --verbose test sed awk test
+		export then export cd readonly
+${HOME} grep readonly 'quoted text'
+	printf && local && $(pwd) printf done test printf then $(pwd) | --verbose
+		'quoted text' "$1" test 'quoted text' --verbose local readonly 'quoted text'
+done cd echo ${HOME} cd ${HOME} cd grep -eu "$1" | -eu "$1" then export 'quoted text'
+done test export local 2>/dev/null ${HOME}
+export export $(pwd) /usr/bin export | test cd readonly 'quoted text' 'quoted text'
+	grep $(pwd) && local
+grep && cd && sed done echo && then sed 'quoted text' echo awk export --verbose
+cd readonly awk 2>/dev/null readonly export awk "$1" "$1" "$1" cd
+		printf local "$@" readonly done "$1" export export /usr/bin local then
+$(pwd) ${HOME} awk done -eu && 2>/dev/null
+grep printf export && && sed then "$@" cd cd x=1 ${HOME}
+		2>/dev/null 2>/dev/null && 'quoted text' -eu 'quoted text'
+	readonly && x=1 grep -eu "$1" x=1 readonly | cd echo $(pwd) local
+2>/dev/null then readonly cd && | ${HOME} x=1 x=1 && && local
+	test 2>/dev/null && grep
+	awk --verbose awk $(pwd) done | /usr/bin echo sed done /usr/bin cd $(pwd) -eu
+/usr/bin test 2>/dev/null "$@" test local test ${HOME} -eu 2>/dev/null
+/usr/bin test 'quoted text' grep readonly /usr/bin && /usr/bin
+	"$1" /usr/bin ${HOME} grep "$@"
+printf "$@" export ${HOME} | "$@" "$1" test
+		--verbose && echo "$@" local "$@" sed
+| sed --verbose "$1" -eu /usr/bin && export export
+"$@" "$1" done --verbose 2>/dev/null ${HOME} sed ${HOME}
+x=1 $(pwd) && 'quoted text' /usr/bin $(pwd) "$1" printf "$1" ${HOME} /usr/bin
+	local echo done x=1 awk "$1" readonly awk then 2>/dev/null
+		"$1" export cd grep ${HOME} then echo ${HOME} awk test
+2>/dev/null echo x=1 'quoted text'
+		"$1" cd local echo test export x=1 -eu $(pwd) x=1 sed test /usr/bin $(pwd)
+		cd --verbose "$1" printf then done -eu printf test -eu sed 2>/dev/null
+	2>/dev/null readonly ${HOME} local export
+cd 2>/dev/null -eu sed
+	printf export echo /usr/bin test x=1 grep awk cd done
+	"$@" test then echo echo -eu | test done printf cd x=1 'quoted text' awk cd
+local sed sed done x=1 export cd then /usr/bin echo -eu ${HOME}
+done done --verbose echo 'quoted text' "$1" ${HOME} test 'quoted text'
+sed --verbose && "$1" then then test readonly 'quoted text'
+		echo ${HOME} --verbose echo awk /usr/bin --verbose
+	-eu $(pwd) cd grep done | cd x=1 'quoted text' && sed -eu
+export test && "$@" local done x=1 'quoted text' done local /usr/bin sed test
+"$@" grep "$1" ${HOME} test grep ${HOME}
+"$@" awk cd "$@" ${HOME} ${HOME} done --verbose
+	done | -eu 'quoted text' grep
+		export sed --verbose printf echo --verbose printf 2>/dev/null
+cd && echo cd then cd cd -eu ${HOME} cd awk | "$1"
+		cd -eu x=1 grep 'quoted text' -eu "$@" sed sed /usr/bin
+		cd printf export cd --verbose printf then --verbose /usr/bin
+	sed | ${HOME} /usr/bin && |
+	sed export grep readonly /usr/bin
+	printf x=1 "$@" awk cd x=1 cd then readonly
+		$(pwd) cd | && test local echo sed
+"$1" 'quoted text' export local then echo echo /usr/bin cd 'quoted text'
+"$@" local sed then test /usr/bin readonly
+x=1 cd && x=1 2>/dev/null
+	'quoted text' local export $(pwd) done local awk export
+	"$1" echo grep printf echo readonly "$@" "$1"
+test echo "$@" 'quoted text' local then readonly readonly /usr/bin done
+	printf | "$1" $(pwd) --verbose -eu test 2>/dev/null ${HOME} printf
+	x=1 ${HOME} x=1 echo x=1 -eu echo --verbose
+	-eu echo /usr/bin | readonly --verbose readonly
+		echo local /usr/bin export -eu
+	${HOME} then 2>/dev/null then then "$1"
+		2>/dev/null $(pwd) echo --verbose 2>/dev/null echo grep echo
+'quoted text' local done x=1 $(pwd) grep local "$@" export -eu "$@" local -eu
+echo ${HOME} printf "$1" && export ${HOME} /usr/bin -eu readonly --verbose
+	sed -eu x=1 | done "$1" | then local test
+printf printf "$@" | 2>/dev/null
+"$1" ${HOME} grep $(pwd) "$1" export then $(pwd)
+test done --verbose -eu --verbose awk then $(pwd)
+		"$1" readonly awk x=1 $(pwd) done local sed echo echo readonly "$@" printf printf
+/usr/bin readonly x=1 "$@" done ${HOME} $(pwd)
+	"$1" $(pwd) export /usr/bin && awk $(pwd) /usr/bin
+		/usr/bin ${HOME} && done /usr/bin x=1 printf ${HOME} $(pwd) "$1" printf
+	/usr/bin /usr/bin --verbose
+		2>/dev/null test local "$1" export then && --verbose local
+	export readonly ${HOME} done readonly -eu cd | then done && $(pwd) $(pwd)
+	sed export readonly echo | echo $(pwd) --verbose then test readonly sed --verbose
+	awk echo readonly 'quoted text' --verbose
+	--verbose /usr/bin 2>/dev/null export export --verbose
+	export done echo echo local
+	local echo -eu export x=1 | awk --verbose 2>/dev/null
+	--verbose | "$1" x=1 readonly test -eu $(pwd) sed &&
+awk cd 'quoted text' cd | echo printf "$1" then then /usr/bin cd sed echo
+printf "$1" grep x=1 "$1" "$1" echo grep export
+		then awk done | && /usr/bin
+	grep | x=1 sed cd && grep
+then --verbose -eu sed -eu test --verbose | "$@" test
+	sed cd cd "$@" grep sed x=1 /usr/bin grep then 'quoted text' |
+		printf readonly 'quoted text' | readonly then grep printf ${HOME} && $(pwd) 'quoted text'
+		grep -eu done test export sed -eu local test x=1 then sed export 'quoted text'
+	"$@" sed ${HOME} sed then awk export
+"$1" "$1" sed 2>/dev/null readonly "$@" "$1" "$@" readonly
+	'quoted text' "$1" export echo "$1"
+		2>/dev/null -eu "$1" then "$@" sed echo awk && cd local && "$@" export "$1"
+	local export ${HOME} -eu export /usr/bin "$@"
+		grep "$@" -eu done test | x=1 "$@" sed ${HOME}
+	"$1" -eu done export x=1 echo | $(pwd) -eu then printf echo
+		2>/dev/null local sed printf readonly $(pwd)
+		/usr/bin 'quoted text' x=1 printf 'quoted text'
+sed ${HOME} readonly readonly $(pwd) --verbose then
+		&& --verbose grep echo readonly
+	-eu grep readonly ${HOME} local local 'quoted text'
+	cd echo export 'quoted text' sed grep
+		test cd sed $(pwd) --verbose ${HOME} | | 2>/dev/null
+printf sed ${HOME} cd ${HOME} sed export readonly grep cd then "$@" -eu
+then "$@" grep --verbose ${HOME} readonly
+	sed readonly grep local && ${HOME} | 2>/dev/null
+export && $(pwd) /usr/bin printf /usr/bin x=1 local
+-eu test -eu done grep grep then && -eu grep test $(pwd) /usr/bin "$1" readonly
+sed && /usr/bin 2>/dev/null x=1 /usr/bin "$1" $(pwd)
+	readonly "$1" grep 2>/dev/null "$1" echo echo printf x=1 sed --verbose grep ${HOME}
+awk ${HOME} && --verbose awk cd printf printf && export 'quoted text'
+	then ${HOME} test /usr/bin $(pwd) awk printf
+		awk readonly local --verbose readonly
+	done 'quoted text' x=1 printf then ${HOME} cd -eu -eu readonly
+		done grep local "$@" /usr/bin --verbose awk -eu then echo ${HOME}
+		awk export x=1 export 2>/dev/null "$1" done sed test awk done
+grep then then awk 'quoted text' echo local
+	--verbose printf 2>/dev/null | /usr/bin x=1 export local awk echo
+	"$@" ${HOME} export echo 2>/dev/null x=1 awk export --verbose readonly
+	&& printf then --verbose -eu
+	${HOME} ${HOME} /usr/bin
+x=1 cd readonly grep 2>/dev/null then
+	then sed echo sed /usr/bin printf "$1" | 'quoted text' readonly readonly "$@"
+test "$@" cd cd ${HOME} readonly export ${HOME} x=1 done done
+local readonly done x=1 2>/dev/null
+sed local grep 2>/dev/null then "$@" 2>/dev/null -eu test grep awk "$1"
+		${HOME} "$@" "$@" ${HOME} test
+	done test 'quoted text' $(pwd) echo ${HOME} test 2>/dev/null | "$@" awk test
+	'quoted text' echo readonly done && echo && "$@" then $(pwd)
+/usr/bin test then "$@" export 'quoted text' 2>/dev/null grep readonly
+	test cd local "$1" "$1"
+		'quoted text' "$1" && | --verbose -eu --verbose cd 'quoted text' done ${HOME}
+		grep test $(pwd) /usr/bin "$1" printf awk /usr/bin sed sed awk local ${HOME}
+--verbose ${HOME} -eu awk --verbose -eu &&
+readonly /usr/bin $(pwd) readonly printf --verbose readonly ${HOME} --verbose
+	-eu ${HOME} local "$1" --verbose grep $(pwd) | "$@" awk /usr/bin | grep
+	printf echo awk export
+	readonly "$@" awk --verbose "$@" echo sed 'quoted text' && -eu ${HOME} "$1" test
+echo test printf "$@" | local --verbose
+then "$@" readonly local printf /usr/bin export printf export done
+then --verbose x=1 'quoted text' done "$@" sed grep test |
+--verbose /usr/bin 'quoted text'
+grep /usr/bin && | $(pwd)
+	-eu printf 'quoted text' && && echo /usr/bin -eu local awk
+		sed -eu readonly awk cd local readonly --verbose 'quoted text' done
+then "$1" test readonly grep | 'quoted text' done awk grep export test readonly
+&& 'quoted text' 2>/dev/null export
+		local printf 'quoted text'
+	sed --verbose ${HOME}
+	${HOME} $(pwd) done local grep x=1 "$@"
+	cd local 'quoted text' x=1 | | "$1" x=1 printf
+	| -eu grep readonly 'quoted text' "$1" ${HOME} x=1 2>/dev/null --verbose
+$(pwd) && $(pwd) local /usr/bin ${HOME} readonly local "$1" test
+	cd --verbose sed x=1 local | awk $(pwd) && 2>/dev/null
+	'quoted text' -eu "$@" awk
+export | "$@" done -eu
+$(pwd) | /usr/bin /usr/bin export ${HOME} grep ${HOME} "$1" test
+&& local done export then 'quoted text' $(pwd)
+		sed ${HOME} awk && | awk 'quoted text' grep /usr/bin grep awk cd
+	echo 2>/dev/null cd "$@" export
+	'quoted text' -eu grep printf local then --verbose
+	local sed x=1 $(pwd) /usr/bin "$@" awk local /usr/bin 'quoted text'
+	"$@" echo grep | | done export -eu grep -eu grep $(pwd) /usr/bin x=1
+	printf test readonly -eu 'quoted text' -eu x=1 cd echo awk 2>/dev/null readonly
+-eu && export sed readonly readonly local ${HOME}
+'quoted text' cd printf then
+		--verbose grep grep readonly 2>/dev/null export
+		${HOME} test cd 'quoted text' sed
+	local readonly cd | $(pwd) then $(pwd) -eu x=1 /usr/bin sed --verbose 2>/dev/null
+cd printf awk --verbose && then -eu sed ${HOME} x=1
+'quoted text' /usr/bin $(pwd) --verbose echo local awk x=1 'quoted text' 2>/dev/null
+	grep test grep | echo awk --verbose readonly x=1 readonly test
+		"$@" done cd awk cd 2>/dev/null
+echo | echo --verbose | "$@" | "$@" printf printf cd /usr/bin --verbose
+		cd ${HOME} then then ${HOME} $(pwd) 2>/dev/null export then
+		then | done 2>/dev/null awk ${HOME} echo $(pwd) grep readonly -eu &&
+	echo cd readonly printf awk
+-eu done cd echo /usr/bin --verbose "$@" test printf | | done
+	"$@" $(pwd) | sed local printf x=1
+	printf local test awk 2>/dev/null && awk "$1" readonly "$@" done &&
+| grep printf grep && "$@" done "$1"
+x=1 -eu ${HOME} then x=1 ${HOME} /usr/bin done done test
+$(pwd) done ${HOME} cd readonly -eu -eu readonly readonly
+	$(pwd) x=1 x=1 grep then cd readonly
+then grep && ${HOME} echo /usr/bin test $(pwd) "$1" && then then export "$@"
+	"$@" sed -eu | printf then printf test x=1 x=1
+	export && && -eu then x=1 printf printf test x=1 ${HOME} sed /usr/bin | sed
+| grep -eu ${HOME} "$@"
+local /usr/bin printf test
+	'quoted text' export then local x=1 echo sed export
+		${HOME} ${HOME} x=1 readonly cd | "$@" awk readonly grep && $(pwd)
+		-eu /usr/bin ${HOME} grep 'quoted text'
+	'quoted text' grep 2>/dev/null 'quoted text' readonly
+2>/dev/null /usr/bin done test "$@" 'quoted text' printf $(pwd) grep cd then
+	printf x=1 test $(pwd) /usr/bin x=1 awk printf local "$@"
+	echo test "$@" cd sed printf $(pwd)
+	--verbose test echo then printf
+readonly /usr/bin export then "$@" x=1 sed | --verbose
+-eu local $(pwd) /usr/bin && then $(pwd) x=1 awk 2>/dev/null echo 'quoted text'
+printf echo "$1" ${HOME} printf 'quoted text'
+		readonly ${HOME} | 2>/dev/null | --verbose printf
+		then -eu echo x=1 $(pwd)
+	'quoted text' 'quoted text' && then 'quoted text' readonly sed
+		&& then grep sed echo ${HOME} && -eu "$1" ${HOME} 2>/dev/null
+		"$@" done /usr/bin echo then export && 'quoted text' 2>/dev/null $(pwd)
+-eu test printf echo ${HOME} grep cd $(pwd) grep export -eu 'quoted text'
+cd x=1 awk grep ${HOME} "$1" ${HOME} test --verbose
+		then $(pwd) readonly test cd /usr/bin sed local then
+		printf | then ${HOME} test cd "$@"
+	'quoted text' /usr/bin "$@" done 2>/dev/null done | then $(pwd)
+	awk done awk local local local "$1" export printf
+	echo sed readonly export readonly grep export grep cd printf
+echo x=1 readonly printf "$1" ${HOME} 2>/dev/null --verbose
+echo local --verbose test export local awk /usr/bin export ${HOME} "$1" local
+sed echo readonly done sed grep cd /usr/bin
+		/usr/bin "$@" export readonly cd /usr/bin -eu
+		awk 2>/dev/null export --verbose
+		then grep export -eu | ${HOME} x=1
+		echo 'quoted text' x=1 local | readonly $(pwd)
+		printf grep then -eu export test export 'quoted text' echo printf
+		&& sed then done done | done | "$1" test then "$1" | /usr/bin
+done awk -eu local echo test done sed readonly $(pwd) export | | local echo
+	readonly done x=1 sed local
+	awk echo test 'quoted text' $(pwd) sed
+	"$1" --verbose $(pwd) ${HOME} sed 2>/dev/null
+	cd export local cd $(pwd)
+	cd $(pwd) --verbose then -eu readonly && test /usr/bin export sed x=1 /usr/bin
+	readonly | "$1" test $(pwd)
+		grep "$@" "$1" $(pwd) --verbose export grep sed awk
+	then x=1 done && 2>/dev/null local grep done -eu echo export then awk
+	awk printf cd then grep -eu grep cd local 'quoted text' -eu awk /usr/bin
+		--verbose $(pwd) | sed -eu x=1 sed 'quoted text'
+	"$@" | -eu 2>/dev/null -eu 2>/dev/null readonly
+	awk && done export done local ${HOME} "$@" "$@"
+readonly echo sed "$1" local /usr/bin echo --verbose cd | $(pwd) test sed
+		export grep echo sed 'quoted text'
+then -eu /usr/bin -eu "$1" echo cd readonly /usr/bin test readonly | echo && "$1"
+| "$1" local printf -eu printf echo done 'quoted text'
+	| printf local -eu local --verbose
+done && awk --verbose && 'quoted text' 'quoted text'
+	2>/dev/null ${HOME} && -eu cd x=1 x=1 | printf && /usr/bin printf && "$1" printf
+	${HOME} grep readonly echo
+		grep readonly printf 'quoted text' $(pwd) local printf local
+export ${HOME} && $(pwd) sed awk grep --verbose "$1"
+export then grep awk ${HOME} && local cd x=1 grep test grep
+		-eu ${HOME} | 'quoted text' done $(pwd) "$1" $(pwd) ${HOME} -eu 'quoted text'
+		${HOME} cd --verbose && 'quoted text'
+		--verbose 2>/dev/null | test awk /usr/bin -eu cd "$1" echo $(pwd) grep
+test | then /usr/bin echo readonly && -eu | cd local /usr/bin 'quoted text'
+		export echo test awk test
+		test 'quoted text' ${HOME} cd 2>/dev/null 2>/dev/null
+	printf ${HOME} readonly sed 2>/dev/null then echo 2>/dev/null -eu readonly
+		local 2>/dev/null "$1" "$1" ${HOME} export ${HOME} -eu $(pwd) then
+		--verbose && | export ${HOME} readonly local local printf sed printf "$@"
+	$(pwd) x=1 'quoted text' "$@" "$@" && export | $(pwd) | readonly awk | sed "$@"
+	local export cd -eu 'quoted text' test local 2>/dev/null awk printf /usr/bin
+		done grep readonly -eu cd && local test 'quoted text' ${HOME} --verbose sed &&
+	2>/dev/null printf x=1 awk done "$@" 2>/dev/null /usr/bin | then awk
+		then grep 'quoted text' ${HOME} echo && "$@" grep ${HOME}
+export "$1" export done ${HOME}
+	then printf 2>/dev/null grep | test /usr/bin ${HOME}
+		done test "$@" /usr/bin sed awk && $(pwd)
+	2>/dev/null cd && 'quoted text'
+		printf cd awk local local awk grep export | && awk done export export
+		sed sed 'quoted text' x=1 sed 'quoted text' && --verbose
+"$1" readonly done echo /usr/bin cd cd
+		"$1" 2>/dev/null | "$1" $(pwd)
+		echo "$1" x=1 awk -eu grep test export
+grep && awk "$@" "$1" 'quoted text'
+	awk grep "$1" x=1 cd sed
+	--verbose echo export "$@" $(pwd) grep "$@" readonly awk "$1" sed
+		x=1 awk export -eu done 'quoted text' local export "$@" then readonly
+	readonly "$1" /usr/bin /usr/bin
+		local && ${HOME} $(pwd) "$@" done ${HOME}
+	-eu | | local readonly grep grep readonly cd local
+	"$@" then "$@" cd grep test 2>/dev/null
+		sed x=1 export --verbose -eu awk x=1 && test
+	echo then ${HOME} $(pwd) -eu 'quoted text' x=1 echo local 2>/dev/null --verbose
+	/usr/bin 2>/dev/null sed -eu then export export test
+	readonly | $(pwd) 'quoted text' local local $(pwd) grep
+	--verbose "$@" done 'quoted text' test grep x=1 $(pwd) awk "$1" $(pwd)
+export 2>/dev/null $(pwd) 2>/dev/null && && done /usr/bin printf then
+		test && -eu --verbose cd then test $(pwd) /usr/bin then
+		| "$1" grep export echo cd 2>/dev/null --verbose local 2>/dev/null
+echo sed export done awk readonly
+	printf printf test then grep --verbose then cd 2>/dev/null 2>/dev/null printf
+		awk export && awk "$@"
+		&& printf /usr/bin printf done echo echo x=1 local awk $(pwd) $(pwd) printf
+	2>/dev/null then local && --verbose ${HOME} then "$1" $(pwd) grep done
+		"$@" test readonly 2>/dev/null 2>/dev/null cd local
+	"$@" printf && "$1" 2>/dev/null 'quoted text' awk 'quoted text' printf 2>/dev/null
+	cd grep cd | -eu local export grep x=1 local echo sed --verbose && --verbose
+		echo local -eu $(pwd) awk echo
+	$(pwd) done x=1 2>/dev/null cd local done grep /usr/bin "$@" then echo awk 2>/dev/null
+--verbose local /usr/bin done test then ${HOME} -eu readonly ${HOME}
+awk then printf then "$1"
+$(pwd) echo echo export $(pwd)
+		grep $(pwd) done done "$1" then x=1 export | test
+		printf | | done 'quoted text' echo "$@" cd x=1
+export done local done printf
+then "$@" local -eu done echo cd 'quoted text' 2>/dev/null then
+	sed done readonly && x=1 ${HOME} && sed awk "$1" done "$1" 2>/dev/null
+awk echo "$1" --verbose 2>/dev/null printf -eu readonly awk cd /usr/bin printf
+	--verbose 2>/dev/null echo sed printf local /usr/bin readonly readonly
+-eu awk printf $(pwd) export
+export done echo export /usr/bin
+	sed export /usr/bin grep 'quoted text'
+echo x=1 local cd ${HOME} 2>/dev/null
+	sed ${HOME} export | -eu "$@" 2>/dev/null
+	readonly cd local 2>/dev/null
+		"$@" grep export && 2>/dev/null grep printf
+	x=1 -eu cd grep echo sed --verbose export test
+"$@" x=1 awk -eu /usr/bin grep grep 'quoted text' done then ${HOME}
+		-eu --verbose && $(pwd) --verbose /usr/bin 'quoted text' --verbose "$1"
+		awk grep /usr/bin --verbose -eu -eu
+&& /usr/bin && --verbose
+	printf /usr/bin /usr/bin $(pwd) awk "$@" --verbose grep
+readonly local ${HOME} then ${HOME} sed /usr/bin echo echo grep x=1
+		"$@" --verbose 'quoted text'
+readonly --verbose then /usr/bin awk --verbose --verbose ${HOME} -eu
+		readonly "$@" -eu 'quoted text' sed "$@" && cd grep local readonly echo 2>/dev/null
+	local ${HOME} readonly done cd /usr/bin --verbose done "$@"
+cd echo "$1" && export grep "$@" 2>/dev/null awk "$1" grep -eu echo sed grep
+	local | --verbose 2>/dev/null then readonly
+${HOME} x=1 awk test x=1
+done printf test readonly -eu done 'quoted text' test printf "$1" 'quoted text'
+	$(pwd) 2>/dev/null "$1" export grep
+local "$1" /usr/bin cd done local then | done readonly test
+${HOME} 2>/dev/null /usr/bin test awk "$@" local "$1" then x=1 "$1" then $(pwd)
+		sed x=1 ${HOME} && test 2>/dev/null grep grep ${HOME} grep "$@" readonly
+		${HOME} done grep then && "$@" sed /usr/bin
+	'quoted text' /usr/bin printf grep x=1 cd -eu x=1 test export
+	grep echo done -eu -eu export
+--verbose echo done && grep $(pwd)
+		printf /usr/bin done sed /usr/bin && local --verbose
+export $(pwd) printf "$1" --verbose ${HOME} sed done $(pwd)
+		sed readonly sed then --verbose echo /usr/bin cd local then "$1" test -eu
+		x=1 test $(pwd) /usr/bin -eu export ${HOME} printf
+grep "$@" | ${HOME} ${HOME} done 2>/dev/null $(pwd) grep
+	then readonly echo ${HOME} local test 2>/dev/null local "$@" sed sed cd export
+		'quoted text' cd done then then && x=1 cd /usr/bin "$1"
+	awk "$@" echo "$1" sed && grep echo printf "$@" 'quoted text' printf /usr/bin
+		then local "$@" ${HOME} -eu && export then sed test done
+	${HOME} $(pwd) 'quoted text' export | 'quoted text' 2>/dev/null
+&& grep awk /usr/bin && && -eu readonly export
+		"$@" export /usr/bin sed
+		${HOME} -eu readonly | grep x=1 x=1 done /usr/bin readonly ${HOME}
+		x=1 readonly test x=1 cd cd "$1" export "$1" "$@" ${HOME} "$1" awk x=1 --verbose
+sed 'quoted text' grep
+	sed -eu /usr/bin 2>/dev/null 'quoted text'
+$(pwd) | 'quoted text'
+		export && "$1" done "$@"
+printf grep && --verbose $(pwd) ${HOME}
+$(pwd) printf sed echo "$1" export 2>/dev/null awk test grep && done -eu
+		&& 2>/dev/null sed printf && readonly sed then "$@" | $(pwd) | local
+'quoted text' readonly readonly local ${HOME} 2>/dev/null
+done awk awk | grep done -eu
+awk 2>/dev/null done
+	test /usr/bin ${HOME} -eu -eu && $(pwd) printf | ${HOME}
+| && sed sed 2>/dev/null cd && "$@" ${HOME} readonly then
+	done awk done 2>/dev/null | printf --verbose echo "$1" x=1 test 'quoted text'
+		"$1" | then awk export
+$(pwd) export --verbose done test | echo 2>/dev/null
+		export export --verbose 'quoted text' && done x=1 echo export
+--verbose $(pwd) "$1" "$1" | 'quoted text' $(pwd) "$1" | --verbose awk
+	"$@" then export done awk | "$1" export test -eu test x=1 | && &&
+sed "$@" awk export | x=1 local 'quoted text' echo awk
+		-eu then grep export && 'quoted text' "$1" ${HOME} $(pwd) $(pwd) test export
+		/usr/bin readonly -eu then -eu readonly
+	cd echo cd grep 'quoted text' printf awk then sed x=1 &&
+	printf x=1 'quoted text'
+then 'quoted text' readonly --verbose
+	/usr/bin --verbose /usr/bin x=1 $(pwd) grep
+awk readonly -eu 'quoted text' && then "$@" -eu
+		-eu "$1" /usr/bin sed sed test grep readonly export export local
+local /usr/bin "$@" "$@" -eu then x=1 "$1"
+		$(pwd) sed grep && | 'quoted text' $(pwd) grep 2>/dev/null done export done
+-eu printf $(pwd) grep done "$@" local awk
+		$(pwd) x=1 cd awk local 2>/dev/null printf done --verbose
+"$1" x=1 printf readonly echo && | x=1 "$@" cd $(pwd) --verbose $(pwd) local
+		/usr/bin readonly sed grep awk printf
+	grep ${HOME} 2>/dev/null ${HOME} "$1" x=1 "$@" x=1 done done && export done grep
+		then export then x=1 printf $(pwd) ${HOME} 2>/dev/null
+'quoted text' && ${HOME} $(pwd) 'quoted text' x=1 --verbose
+		'quoted text' x=1 grep done
+grep | 2>/dev/null awk $(pwd) 2>/dev/null
+		--verbose printf && x=1
+	$(pwd) --verbose printf printf 2>/dev/null
+	local grep --verbose $(pwd) local $(pwd) x=1 $(pwd)
+x=1 | 2>/dev/null export then $(pwd) echo export printf | done
+readonly "$@" local | readonly grep /usr/bin 2>/dev/null 2>/dev/null test
+		${HOME} echo printf $(pwd) printf echo ${HOME} "$@" "$1" /usr/bin -eu
+| local cd --verbose then "$@" $(pwd) test
+		readonly echo grep --verbose export x=1 && then test && echo
+	echo 2>/dev/null export test echo --verbose && x=1 then sed x=1 test | /usr/bin
+	grep && x=1 "$1" x=1 test readonly 'quoted text' "$@"
+echo 'quoted text' local -eu done
+	${HOME} export && | ${HOME}
+test --verbose "$@" echo
+		'quoted text' grep cd "$1" && 'quoted text'
+		-eu printf /usr/bin 2>/dev/null awk -eu sed
+	| /usr/bin | ${HOME} "$1" printf $(pwd) 'quoted text'
+		"$1" && x=1 awk test $(pwd) sed sed cd "$@" 'quoted text' done echo
+	printf $(pwd) printf && 'quoted text' --verbose readonly 2>/dev/null &&
+		awk printf x=1 -eu then echo done x=1 'quoted text' awk --verbose grep
+awk awk sed sed --verbose printf
+--verbose "$1" x=1 | && "$1" sed cd awk -eu cd echo --verbose local ${HOME}
+	test && printf 'quoted text' "$@" cd 'quoted text' $(pwd)
+	&& ${HOME} grep echo printf ${HOME} echo readonly
+	cd 'quoted text' ${HOME} | --verbose
+		-eu /usr/bin grep x=1 done then 'quoted text' 'quoted text'
+--verbose $(pwd) 2>/dev/null &&
+		$(pwd) local printf x=1 then --verbose "$1" /usr/bin 'quoted text' export
+x=1 local /usr/bin export
+| /usr/bin /usr/bin "$@" readonly /usr/bin
+	echo sed grep awk 'quoted text'
+$(pwd) $(pwd) grep cd x=1
+echo | -eu grep sed 'quoted text' sed $(pwd)
+x=1 printf 2>/dev/null test x=1 local printf x=1 sed readonly 2>/dev/null
+		"$1" local sed export "$1" grep
+	"$1" then -eu done "$@" local && then printf awk local local | x=1 export $(pwd)
+		| sed then ${HOME} test 2>/dev/null $(pwd) "$@" 'quoted text'
+		"$@" ${HOME} sed 'quoted text'
+	/usr/bin readonly awk sed local "$@" echo local "$@"
+		cd -eu --verbose && grep awk export 2>/dev/null $(pwd) then local 'quoted text'
+readonly $(pwd) --verbose then export 'quoted text'
+	"$1" then 'quoted text' 'quoted text' export ${HOME}
+awk then -eu readonly ${HOME} 2>/dev/null "$1" 2>/dev/null
+		&& 2>/dev/null readonly export cd echo 2>/dev/null
+	x=1 then sed -eu $(pwd) --verbose echo sed /usr/bin sed && readonly
+sed printf ${HOME} then "$@" then echo /usr/bin
+		printf export cd $(pwd) 2>/dev/null && ${HOME} then | then local
+	cd x=1 $(pwd) -eu export
+	export --verbose then "$@" ${HOME} $(pwd) done sed /usr/bin
+		/usr/bin 'quoted text' --verbose x=1 then --verbose grep /usr/bin
+		"$@" $(pwd) export grep --verbose ${HOME} then sed "$@"
+	'quoted text' 2>/dev/null local x=1 export 'quoted text' done "$@"
+	2>/dev/null test test awk awk printf | echo printf $(pwd) $(pwd)
+echo x=1 sed readonly x=1 readonly x=1 grep readonly then echo done "$1"
+then printf 'quoted text' "$@" x=1 test x=1 2>/dev/null
+		cd sed test --verbose readonly grep /usr/bin done
+printf 'quoted text' "$1" export grep cd ${HOME}
+	sed | "$@" sed && /usr/bin sed then done
+| printf && printf "$@" --verbose echo 2>/dev/null $(pwd) "$@" echo /usr/bin cd
+	x=1 then $(pwd) -eu echo "$1" echo | 'quoted text' x=1 local awk
+		done awk export "$1" cd grep x=1 then -eu done done /usr/bin
+	${HOME} /usr/bin done --verbose export | $(pwd) $(pwd) ${HOME} then
+	then then done 'quoted text' export echo sed local /usr/bin
+2>/dev/null | | 2>/dev/null readonly | ${HOME} sed awk done && && printf "$@"
+awk test then ${HOME} "$@" "$@" ${HOME} local
+export -eu | printf echo | /usr/bin "$1" awk "$@" x=1 "$1"
+cd 2>/dev/null --verbose | done -eu grep "$1" export cd $(pwd)
+		&& test /usr/bin awk export /usr/bin local && export sed ${HOME}
+		then --verbose /usr/bin "$@"
+#include c78.sh
+	| local grep ${HOME} x=1 done $(pwd) x=1 && /usr/bin
+		| "$1" -eu --verbose
+	"$@" ${HOME} | done test -eu --verbose
+		x=1 awk 'quoted text' local awk 'quoted text' --verbose then $(pwd) "$@" sed
+sed /usr/bin /usr/bin | cd -eu ${HOME} --verbose --verbose printf
+		"$@" grep done then && sed export then readonly
+	sed grep readonly /usr/bin /usr/bin sed $(pwd) --verbose
+		export x=1 echo sed 'quoted text' $(pwd) && $(pwd)
+		sed ${HOME} ${HOME} "$1"
+"$@" --verbose echo export -eu | local /usr/bin printf readonly
+		--verbose done export "$@" test /usr/bin awk
+	printf "$1" 'quoted text' printf "$@" | awk local
+	&& sed 'quoted text' /usr/bin readonly x=1 /usr/bin
+		$(pwd) readonly /usr/bin echo | $(pwd) -eu x=1 ${HOME}
+test sed printf /usr/bin
+	readonly cd awk sed $(pwd) ${HOME} "$1" readonly /usr/bin -eu readonly
+		done readonly ${HOME} then
+	sed "$@" "$1" readonly sed $(pwd) cd awk | --verbose local
+echo && -eu done printf ${HOME} --verbose
+	x=1 test "$1" --verbose "$1" done
+	awk then "$1" x=1 -eu | then local grep ${HOME} "$@" then done ${HOME}
+--verbose awk done 'quoted text' "$@" /usr/bin
+	&& $(pwd) && cd 2>/dev/null "$1" $(pwd) && then test readonly
+	grep x=1 readonly local done && 'quoted text' local sed ${HOME}
+/usr/bin && -eu test 2>/dev/null "$1" "$@" then ${HOME} 'quoted text'
+sed local echo && 2>/dev/null awk
+		cd /usr/bin export local then printf then -eu "$@" printf readonly --verbose
+		/usr/bin "$1" awk readonly echo grep export
+		"$1" export cd then 2>/dev/null 2>/dev/null 'quoted text'
+		awk | echo --verbose 2>/dev/null
+		| 2>/dev/null $(pwd) ${HOME} then awk then 'quoted text' --verbose
+printf /usr/bin -eu local export --verbose awk
+		printf local /usr/bin echo "$1"
+	"$1" echo export "$1" local "$1" echo "$1" 'quoted text' --verbose $(pwd) 2>/dev/null
+2>/dev/null && $(pwd) local "$1" ${HOME} sed
+	done "$@" sed /usr/bin 'quoted text'
+export x=1 readonly $(pwd) export printf test "$@" /usr/bin | grep x=1 sed ${HOME}
+"$@" echo ${HOME} x=1 && grep grep echo "$@" test "$@" local grep cd done "$1"
+		x=1 x=1 && printf x=1 test echo echo
+--verbose x=1 local $(pwd) sed -eu export
+	-eu printf awk cd "$@" sed ${HOME} readonly x=1 --verbose x=1 cd readonly
+	test local echo $(pwd) cd "$1" && /usr/bin
+| grep /usr/bin then 2>/dev/null "$@" ${HOME}
+		x=1 test "$1" -eu then 'quoted text' --verbose cd 'quoted text' /usr/bin
+	grep local then | "$@" export 2>/dev/null export ${HOME} --verbose sed export
+-eu "$1" "$@" local local local "$1" $(pwd)
+-eu readonly awk printf
+		"$1" "$@" export && grep then printf cd test local done sed printf
+		test --verbose 2>/dev/null export $(pwd) sed export "$@" done local 'quoted text'
+	-eu printf cd 'quoted text' local done "$1" $(pwd) --verbose grep x=1 awk
+${HOME} export --verbose "$1" "$1" 'quoted text' local
+local sed | 'quoted text' "$1" export done --verbose
+	readonly export test -eu awk
+		-eu awk -eu done /usr/bin "$1" $(pwd) /usr/bin
+awk cd cd echo $(pwd) | x=1 grep awk readonly x=1 $(pwd) readonly printf -eu
+local "$1" ${HOME} then awk local sed printf | echo "$1" grep
+	cd echo "$@" --verbose
+sed | -eu --verbose /usr/bin awk test awk "$1" awk cd
+$(pwd) awk --verbose 'quoted text'
+'quoted text' $(pwd) export $(pwd)
+| "$1" 'quoted text' export "$1"
+		readonly printf sed test
+		&& "$1" echo /usr/bin local readonly
+x=1 $(pwd) | "$@" export
+	"$1" -eu done "$1" export 'quoted text'
+	export x=1 then local | awk /usr/bin 'quoted text'
+printf printf -eu done cd -eu -eu $(pwd) cd ${HOME} echo printf
+	done --verbose awk awk done test --verbose local then test cd 'quoted text' --verbose
+	awk echo /usr/bin awk test && "$1" 'quoted text' 2>/dev/null "$1" local
+		x=1 grep printf --verbose done
+2>/dev/null "$@" $(pwd) sed "$1"
+"$@" cd done grep 2>/dev/null --verbose local grep
+	echo grep | 'quoted text' --verbose
+		echo ${HOME} done -eu awk then test done ${HOME} --verbose
+awk && then $(pwd) echo echo grep | $(pwd) ${HOME}
+	'quoted text' "$1" --verbose /usr/bin export "$@" local
+		local readonly && $(pwd)
+x=1 ${HOME} /usr/bin readonly
+	${HOME} ${HOME} x=1 /usr/bin sed "$1" readonly ${HOME} $(pwd) "$@" 2>/dev/null
+		"$@" export x=1 local --verbose /usr/bin local
+	-eu /usr/bin echo then "$1" then then ${HOME} | -eu then
+		sed test readonly $(pwd) && printf 2>/dev/null 2>/dev/null export export local
+		"$@" "$1" /usr/bin then | x=1 printf 'quoted text'
+	grep && 'quoted text' 2>/dev/null -eu printf awk x=1 printf export
+		/usr/bin then cd awk awk "$1" echo "$@"
+${HOME} printf done $(pwd) 2>/dev/null export export
+then $(pwd) --verbose 2>/dev/null
+	then test export 2>/dev/null awk local awk grep 2>/dev/null
+	echo export awk grep 2>/dev/null
+	local "$1" readonly sed && then 2>/dev/null sed --verbose | 2>/dev/null
+	done 2>/dev/null printf then $(pwd)
+readonly --verbose export "$1"
+awk then "$@" done done
+		-eu local sed sed "$@" ${HOME} echo awk -eu ${HOME} cd awk x=1 'quoted text'
+readonly test /usr/bin readonly "$1" --verbose 'quoted text' then grep
+	/usr/bin echo /usr/bin "$@" 2>/dev/null 2>/dev/null
+		--verbose readonly "$@" then $(pwd) "$1" then "$@" then
+		echo 2>/dev/null export test
+		/usr/bin grep done done awk /usr/bin 'quoted text'
+	$(pwd) cd readonly done local "$@" readonly
+	-eu export echo printf ${HOME}
+		done awk x=1 export awk
+"$@" && | local cd cd | printf export local export export export printf
+--verbose sed cd && printf --verbose readonly grep
+		readonly then readonly 'quoted text'
+		'quoted text' | grep grep done cd
+	-eu "$1" $(pwd) "$@" 'quoted text' -eu | printf | --verbose done &&
+	echo -eu done $(pwd) x=1 cd ${HOME} readonly cd 'quoted text' -eu cd cd
+		${HOME} -eu /usr/bin export printf /usr/bin "$@" export
+echo x=1 "$@" test x=1 | ${HOME} export readonly
+	done cd printf printf test ${HOME} local test | 'quoted text'
+		local /usr/bin ${HOME} ${HOME} echo local
+	awk export sed | -eu x=1 grep
+	then ${HOME} "$1" echo |
+cd 2>/dev/null | test --verbose then --verbose
+then grep /usr/bin export
+	&& cd awk 'quoted text' printf "$@" 'quoted text' then
+printf x=1 sed export $(pwd)
+	grep --verbose readonly awk $(pwd) grep awk done | /usr/bin grep test cd --verbose
+		done local readonly export export grep x=1 sed | echo
+		echo -eu /usr/bin $(pwd) /usr/bin local sed readonly && awk
+local then 'quoted text' "$1" 2>/dev/null grep
+		then | echo test ${HOME} then readonly && /usr/bin sed export
+	$(pwd) local | grep $(pwd) grep 2>/dev/null $(pwd) then sed cd readonly test
+		sed -eu 2>/dev/null printf export 'quoted text' awk
+		then && "$@" awk --verbose readonly local
+printf ${HOME} sed | export /usr/bin
+	$(pwd) sed local --verbose done $(pwd) export
+		2>/dev/null local ${HOME} export "$1" readonly grep
+		/usr/bin echo ${HOME} "$@" 2>/dev/null /usr/bin
+	readonly local printf -eu /usr/bin echo readonly
+		test awk cd -eu 2>/dev/null --verbose
+	'quoted text' -eu then $(pwd) readonly readonly "$@" 'quoted text' $(pwd)
+		${HOME} "$1" echo test local $(pwd) readonly awk sed awk --verbose /usr/bin
+	then "$@" 'quoted text' $(pwd) --verbose done 2>/dev/null
+	awk test sed ${HOME} | --verbose 'quoted text' export 2>/dev/null "$1"
+		echo && "$@" awk echo $(pwd) export done -eu test
+printf done cd ${HOME} cd 2>/dev/null | local local "$@" then cd 2>/dev/null
+readonly then "$@" done sed "$@" done export
+		&& $(pwd) --verbose test -eu local | ${HOME} -eu then --verbose
+	/usr/bin sed sed -eu ${HOME}
+		grep done 2>/dev/null export cd cd awk done
+		test awk done printf echo
+&& awk "$@" --verbose sed --verbose 'quoted text'
+x=1 local readonly sed -eu cd then --verbose awk readonly --verbose
+	then x=1 -eu then cd readonly --verbose local 'quoted text' grep
+		then cd awk $(pwd) 'quoted text' echo done 'quoted text'
+x=1 cd cd 2>/dev/null x=1 ${HOME} "$@" ${HOME} | && | /usr/bin export
+		cd cd sed x=1 sed && 2>/dev/null test $(pwd)
+		"$1" 'quoted text' "$1" cd local readonly
+	| --verbose $(pwd) $(pwd) 'quoted text' 'quoted text' awk done export cd "$1"
+$(pwd) readonly | grep "$@" then ${HOME} then $(pwd) ${HOME} /usr/bin "$@" awk
+		grep 2>/dev/null $(pwd) 'quoted text' "$1" 'quoted text'
+	sed "$1" -eu then 2>/dev/null
+test awk --verbose x=1 awk test "$1" awk $(pwd)
+"$1" | ${HOME} awk && && "$1" | readonly test export && done x=1 $(pwd)
+export -eu test printf /usr/bin 2>/dev/null done && cd printf
+		echo sed grep test cd --verbose printf done -eu local echo echo echo sed
+local --verbose test awk /usr/bin x=1 done printf x=1 then
+test readonly echo | done local 'quoted text' && printf
+echo ${HOME} $(pwd) then then then /usr/bin awk export grep readonly ${HOME}
+	awk ${HOME} "$1" $(pwd) done local "$1" cd export "$1" $(pwd)
+	readonly done | local && 2>/dev/null 'quoted text'
+	"$@" echo awk --verbose ${HOME} readonly 'quoted text' /usr/bin sed
+	sed export awk grep /usr/bin /usr/bin x=1 then test 2>/dev/null
+	local ${HOME} readonly grep 2>/dev/null ${HOME} sed && grep
+--verbose local $(pwd) cd 2>/dev/null
+	readonly x=1 readonly then grep readonly done printf 2>/dev/null export
+	done echo export "$1" 2>/dev/null done cd $(pwd) 'quoted text' grep x=1 --verbose
+| 'quoted text' test grep local ${HOME} $(pwd)
+	"$@" readonly ${HOME} cd awk "$1" readonly "$@" "$1" "$1" export 2>/dev/null local
+local cd sed | --verbose awk 2>/dev/null 2>/dev/null
+	export "$1" echo sed printf ${HOME} && done --verbose
+	awk --verbose /usr/bin | cd "$@" --verbose printf
+		readonly awk printf $(pwd) $(pwd) 'quoted text' echo done
+	-eu | test echo "$1" --verbose test /usr/bin && local ${HOME} | 2>/dev/null
+then sed 2>/dev/null "$1" 'quoted text'
+done echo -eu readonly "$@" cd grep -eu awk "$1" export 'quoted text'
+		&& "$1" done 2>/dev/null ${HOME} export $(pwd)
+cd 'quoted text' printf sed then --verbose "$@" cd done ${HOME} /usr/bin then
+	${HOME} echo echo "$1" /usr/bin export local x=1
+"$@" awk echo local -eu cd && ${HOME}
+	-eu "$1" local done export cd test printf
+		'quoted text' test -eu x=1 test ${HOME}
+	awk 2>/dev/null x=1 /usr/bin then cd done $(pwd) 'quoted text' /usr/bin
+		readonly x=1 2>/dev/null test ${HOME}
+		&& echo readonly done 'quoted text' 'quoted text' readonly
+export x=1 $(pwd) readonly grep cd echo
+--verbose ${HOME} test local $(pwd) local -eu 2>/dev/null grep
+		cd echo awk ${HOME} then && x=1 /usr/bin echo export $(pwd) test
+		-eu sed --verbose x=1 test local --verbose "$@" /usr/bin grep "$@" -eu then | -eu
+${HOME} ${HOME} local | cd 'quoted text' /usr/bin awk then readonly echo && local
+		local done grep -eu -eu ${HOME}
+		test 'quoted text' 2>/dev/null
+printf --verbose export sed "$1" local
+	printf awk done done /usr/bin | 2>/dev/null readonly /usr/bin /usr/bin
+$(pwd) awk readonly "$@" 'quoted text' 2>/dev/null
+		&& cd ${HOME} --verbose -eu x=1 sed 2>/dev/null ${HOME} "$@" local
+'quoted text' "$1" $(pwd) then /usr/bin echo awk awk $(pwd)
+		awk --verbose && test local sed | test "$1" x=1 2>/dev/null then -eu
+"$1" sed local cd 2>/dev/null $(pwd) -eu then readonly --verbose
+		'quoted text' sed "$1" && readonly ${HOME} cd awk $(pwd)
+	test readonly -eu && grep sed && $(pwd) "$@" 2>/dev/null $(pwd) export local
+		$(pwd) export "$1" sed awk sed done "$@" x=1 -eu | then printf then then 'quoted text'
+echo done done export sed echo cd ${HOME} export sed -eu "$1" echo -eu
+		printf then 2>/dev/null 2>/dev/null cd /usr/bin
+		test && -eu $(pwd) printf awk grep test
+	awk grep readonly cd | grep -eu
+	done -eu "$@" then printf grep $(pwd) cd 'quoted text'
+$(pwd) -eu echo "$@" "$1" ${HOME} "$1" awk | test
+	--verbose grep readonly | /usr/bin
+readonly && cd local export
+		$(pwd) 2>/dev/null 'quoted text' readonly ${HOME} printf "$@" export "$1" printf
+readonly then printf readonly local 2>/dev/null
+"$1" -eu echo echo | grep
+| $(pwd) export cd grep "$@" cd
+	local "$1" awk --verbose -eu done done test $(pwd) "$1" 'quoted text' echo done
+	| grep echo ${HOME} export export awk grep sed --verbose export |
+		2>/dev/null 'quoted text'
+	test --verbose --verbose readonly x=1 ${HOME}
+| --verbose x=1 ${HOME} sed printf local printf "$@" 2>/dev/null readonly echo
+done ${HOME} readonly test ${HOME} x=1 2>/dev/null
+		-eu local echo then echo && $(pwd) 'quoted text' test awk -eu
+-eu "$@" --verbose done --verbose --verbose "$1" test 2>/dev/null done echo
+	done export $(pwd) 2>/dev/null cd $(pwd) cd --verbose x=1 cd && grep
+	/usr/bin -eu test export ${HOME} x=1 test test ${HOME}
+		done awk printf -eu readonly -eu done 'quoted text' sed
+		done sed /usr/bin ${HOME} x=1 /usr/bin /usr/bin done
+		${HOME} awk $(pwd) "$1" grep sed export
+2>/dev/null grep awk | 'quoted text' && 'quoted text'
+		"$1" -eu cd "$1" export --verbose sed
+sed "$@" /usr/bin "$@" 2>/dev/null "$@"
+${HOME} 'quoted text' grep test | && &&
+		${HOME} readonly $(pwd) 2>/dev/null sed
+		echo 'quoted text' x=1 x=1 2>/dev/null echo
+		'quoted text' export local 2>/dev/null
+&& then $(pwd) -eu "$1" test
+	awk readonly $(pwd) done echo awk "$1" --verbose && /usr/bin
+"$@" then | -eu done readonly 2>/dev/null -eu --verbose
+		&& 'quoted text' export && local 2>/dev/null export
+	"$@" readonly 'quoted text' && sed export "$1"
+		readonly sed /usr/bin && "$1" -eu done "$1" export x=1 "$@" export ${HOME} /usr/bin
+cd awk /usr/bin ${HOME} | $(pwd) | cd "$1" cd done readonly 2>/dev/null
+	cd grep grep done printf sed --verbose echo /usr/bin 'quoted text' done x=1 --verbose
+2>/dev/null x=1 test awk $(pwd) -eu local echo "$1" 'quoted text' sed
+-eu done /usr/bin printf
+	--verbose $(pwd) 2>/dev/null "$1" x=1 echo "$1" 'quoted text'
+	/usr/bin x=1 echo -eu export && | export x=1 ${HOME} export
+		done && local test sed test 2>/dev/null
+'quoted text' test sed 'quoted text' --verbose && export printf "$1" /usr/bin
+done /usr/bin test done grep 'quoted text' cd 2>/dev/null
+		2>/dev/null x=1 sed test $(pwd)
+		sed -eu -eu echo && sed then |
+		test echo | 'quoted text' then readonly --verbose local done | && export
+"$1" 'quoted text' test grep readonly ${HOME} x=1 sed sed then
+local test printf readonly $(pwd) test sed test x=1 -eu $(pwd) |
+	"$1" test grep readonly "$1" 'quoted text' printf
+	test test test done grep "$@" && awk -eu test "$@" readonly export ${HOME} export
+		"$1" -eu local ${HOME} then x=1 'quoted text'
+	x=1 export x=1 && readonly test done awk --verbose
+printf --verbose cd cd test $(pwd) && -eu && 2>/dev/null echo done done
+		awk | echo ${HOME} --verbose
+		${HOME} cd "$1" ${HOME} "$@" printf grep done | "$@" -eu "$1"
+	2>/dev/null | printf cd ${HOME} export x=1 test 'quoted text' local
+	then export grep 'quoted text' 'quoted text' && test then
+	awk sed printf grep ${HOME} done --verbose test
+/usr/bin && export done done ${HOME} | printf printf awk 'quoted text'
+	"$1" 2>/dev/null | test then printf $(pwd)
+		export && --verbose export && 2>/dev/null then "$@" 2>/dev/null then
+done test ${HOME} done "$@" export x=1 'quoted text'
+	2>/dev/null --verbose test grep -eu
+		test test 2>/dev/null ${HOME} test local && echo ${HOME}
+	test printf grep x=1 "$1" readonly sed readonly cd ${HOME}
+	'quoted text' "$1" test -eu ${HOME} ${HOME} then
+		sed 2>/dev/null 2>/dev/null $(pwd) --verbose echo $(pwd) 'quoted text' /usr/bin
+		&& /usr/bin cd readonly echo echo -eu
+	readonly ${HOME} local printf 2>/dev/null export /usr/bin 'quoted text'
+	cd x=1 local cd cd 'quoted text' sed printf
+readonly /usr/bin x=1 "$@" /usr/bin -eu printf readonly
+test local printf "$@" grep then done cd awk | 'quoted text' /usr/bin
+	local then readonly --verbose ${HOME} --verbose
+	done "$1" 'quoted text' "$1" readonly
+		printf grep "$1" local echo -eu --verbose "$1"
+awk "$1" | --verbose readonly "$1" echo | $(pwd)
+		"$@" done ${HOME} echo -eu "$1"
+local export ${HOME} done $(pwd) cd done
+		echo awk /usr/bin then local awk -eu awk then x=1
+		$(pwd) sed | 'quoted text' then then
+	x=1 grep grep grep readonly test readonly /usr/bin echo /usr/bin -eu $(pwd)
+	| /usr/bin grep awk /usr/bin "$1"
+	| grep test printf --verbose "$@" cd printf readonly -eu grep then
+	cd 2>/dev/null && 2>/dev/null
+then grep --verbose x=1 "$1" && && ${HOME} grep grep sed local 'quoted text'
+	| then echo -eu echo "$1" /usr/bin
+	${HOME} /usr/bin -eu readonly test 2>/dev/null
+x=1 -eu sed printf 'quoted text' export cd
+	'quoted text' -eu grep 'quoted text' test grep ${HOME} "$1" 'quoted text'
+	echo 'quoted text' 2>/dev/null | && done test echo export sed done cd test
+	echo ${HOME} x=1 2>/dev/null
+done sed --verbose export "$@" awk then export x=1 && sed -eu -eu "$@" &&
+	$(pwd) printf /usr/bin | readonly test | readonly grep
+then -eu awk | cd cd readonly x=1 'quoted text' cd $(pwd) cd export
+		&& "$1" cd ${HOME} awk "$1" "$@" local 'quoted text' 'quoted text'
+	x=1 readonly test readonly 'quoted text' 'quoted text'
+grep echo cd "$1" test
+	/usr/bin | cd cd test done echo test test sed test done grep
+		"$@" x=1 then grep 2>/dev/null sed "$1"
+then readonly "$1" $(pwd) grep $(pwd) --verbose sed sed printf
+grep --verbose printf printf readonly grep done 2>/dev/null $(pwd) printf
+	printf local $(pwd) | printf then local x=1 -eu x=1 done
+	export 'quoted text' cd 2>/dev/null awk 2>/dev/null | "$1" local
+	x=1 /usr/bin awk then awk export test export "$@" sed -eu grep
+		"$@" 'quoted text' sed
+	grep ${HOME} "$1" "$1" -eu 2>/dev/null
+		then readonly export done 'quoted text'
+echo local "$1" "$1" $(pwd) done "$1" "$@"
+	| printf test --verbose done "$1" then
+		2>/dev/null ${HOME} cd then local -eu cd | local --verbose readonly
+sed "$1" x=1 printf ${HOME} && readonly -eu /usr/bin -eu echo x=1 --verbose
+cd $(pwd) done cd echo /usr/bin readonly
+		done echo grep 2>/dev/null 2>/dev/null | "$1" sed ${HOME} "$@" readonly test
+sed && done export 'quoted text' ${HOME} 2>/dev/null export
+		printf "$1" --verbose grep
+		| sed -eu then grep "$@" x=1 2>/dev/null local awk x=1
+export --verbose done -eu 'quoted text'
+readonly 2>/dev/null -eu grep printf test printf --verbose
+$(pwd) | local "$@" echo awk export
+		cd readonly local "$1" "$@" cd "$1" ${HOME} -eu export sed then readonly then
+	&& test 'quoted text' && "$@" cd grep test -eu /usr/bin x=1
+--verbose 'quoted text' cd readonly sed x=1 test x=1 done -eu "$1" "$1"
+done "$1" $(pwd) export
+		then awk cd /usr/bin printf 2>/dev/null ${HOME} "$1" done sed && --verbose readonly
+	$(pwd) --verbose "$1" --verbose "$@"
+	--verbose 'quoted text' readonly grep /usr/bin
+cd $(pwd) ${HOME} awk test -eu local ${HOME} echo test x=1
+done sed /usr/bin done
+${HOME} "$@" echo ${HOME} x=1 /usr/bin ${HOME} echo $(pwd) awk 2>/dev/null
+		cd echo /usr/bin && then test printf
+		readonly then sed cd awk readonly x=1 test "$@" /usr/bin awk 'quoted text'
+	$(pwd) x=1 "$@" done local
+2>/dev/null 'quoted text' /usr/bin grep && local | test
+cd "$@" printf /usr/bin 'quoted text' x=1 x=1
+	x=1 cd awk awk test echo awk printf && printf echo ${HOME} -eu cd | done "$1"
+$(pwd) sed $(pwd) | &&
+echo /usr/bin then 2>/dev/null 2>/dev/null && "$@"
+done "$@" local 2>/dev/null then && && echo export echo done 'quoted text' --verbose
+	"$@" done printf local --verbose sed done grep
+&& --verbose "$@" && | export ${HOME} export
+'quoted text' local | | local x=1 sed | local $(pwd)
+$(pwd) /usr/bin && printf 'quoted text'
+	${HOME} awk $(pwd) ${HOME} "$1" printf x=1 -eu /usr/bin -eu $(pwd)
+sed 'quoted text' then | grep | export local echo ${HOME} then $(pwd) local
+		"$@" | && sed local 2>/dev/null
+		"$1" export --verbose export echo --verbose |
+	local cd then echo /usr/bin
+${HOME} 'quoted text' -eu grep ${HOME} printf
+	cd grep readonly | printf sed done awk x=1 echo && grep then test local | grep
+	export x=1 "$1" --verbose then x=1 printf echo
+		local "$1" echo | "$1" /usr/bin ${HOME}
+		test | -eu /usr/bin test done ${HOME} -eu sed -eu --verbose | awk
+		echo "$1" "$1" $(pwd) -eu --verbose /usr/bin --verbose printf $(pwd) printf
+		then "$1" done printf grep local -eu local && sed
+export readonly --verbose test 2>/dev/null "$@" done
+		x=1 echo $(pwd) export echo printf readonly x=1 echo 2>/dev/null 2>/dev/null /usr/bin
+	| | -eu test "$1" sed | 'quoted text' export 'quoted text'
+| readonly ${HOME} then cd 'quoted text' 'quoted text'
+	test -eu "$1" test sed --verbose then sed | echo local 'quoted text'
+	'quoted text' -eu && grep 2>/dev/null readonly echo
+	cd echo | readonly -eu /usr/bin
+		--verbose test ${HOME} $(pwd)
+	test printf sed x=1 "$@" | "$@"
+		--verbose 2>/dev/null cd grep awk --verbose && $(pwd) "$@" "$@" /usr/bin
+sed grep export test "$1" --verbose then grep
+		sed ${HOME} -eu grep $(pwd) && cd 2>/dev/null
+		grep && 'quoted text' awk echo "$1" readonly
+sed sed x=1 "$1" then $(pwd) done
+	'quoted text' $(pwd) --verbose
+		| && 2>/dev/null "$1" sed 'quoted text' "$@"
+"$1" printf export grep then then readonly -eu "$@" test 2>/dev/null cd 'quoted text'
+		done "$@" readonly grep printf ${HOME} $(pwd) echo echo ${HOME} readonly
+"$@" grep /usr/bin printf x=1 done printf then then
+"$@" cd echo $(pwd) awk | $(pwd) test "$@"
+		x=1 "$1" x=1 awk echo
+	$(pwd) /usr/bin ${HOME} awk export done echo test x=1 2>/dev/null done
+| test printf $(pwd) --verbose then -eu 2>/dev/null awk echo "$@" /usr/bin x=1
+	x=1 | "$@" -eu awk && x=1 cd sed awk printf
+done echo ${HOME} awk done printf
+then "$1" done grep grep x=1 done test echo local sed test then "$1" readonly
+		export grep --verbose "$@" export 2>/dev/null 2>/dev/null -eu -eu sed grep awk
+		export "$@" $(pwd) awk
+	'quoted text' done readonly
+	grep && && x=1 done awk /usr/bin local /usr/bin
+	local then echo $(pwd) cd $(pwd) done x=1 awk grep awk local
+		local --verbose readonly x=1
+'quoted text' --verbose ${HOME} cd | done local 'quoted text' local
+		done "$@" "$1" export --verbose
+	done "$@" awk cd readonly 'quoted text' test
+		readonly cd done 2>/dev/null printf --verbose done "$1" -eu readonly
+	&& local done done x=1 2>/dev/null 2>/dev/null | readonly
+| 2>/dev/null --verbose done awk done export && local then --verbose printf
+2>/dev/null 'quoted text' cd /usr/bin
+		readonly export printf | 2>/dev/null
+		$(pwd) | && "$1" then test sed echo
+readonly x=1 | && awk readonly $(pwd) --verbose
+	echo "$@" readonly test sed && export
+"$@" && --verbose awk -eu done "$@" -eu --verbose x=1 -eu 'quoted text' 2>/dev/null
+2>/dev/null "$1" local printf -eu | 2>/dev/null $(pwd) 'quoted text' -eu export
+	sed ${HOME} && && sed printf | awk -eu done ${HOME} local "$1" -eu
+		--verbose printf then $(pwd) done awk -eu test local 2>/dev/null | ${HOME}
+	readonly "$1" echo test "$1" "$1" export $(pwd) sed
+	x=1 echo echo grep --verbose && /usr/bin
+$(pwd) readonly && x=1
+		"$1" cd printf 2>/dev/null sed printf
+	${HOME} export "$@" --verbose done printf 'quoted text' grep | done
+		test x=1 | && readonly sed | done cd --verbose "$1" ${HOME} "$@" then echo
+	${HOME} test 'quoted text' then --verbose "$@" sed ${HOME} test | x=1 /usr/bin
+		'quoted text' printf /usr/bin then awk local /usr/bin readonly
+test /usr/bin $(pwd) "$1" "$1" export echo readonly export printf $(pwd) test
+		$(pwd) $(pwd) done echo && readonly test export
+		'quoted text' /usr/bin echo $(pwd) x=1 /usr/bin
+		"$@" echo readonly --verbose
+		done "$@" x=1 printf cd ${HOME} x=1 2>/dev/null 2>/dev/null --verbose x=1 $(pwd)
+	local "$@" awk | awk -eu -eu test | &&
+	cd && then && "$1" then | cd 2>/dev/null $(pwd)
+cd awk readonly --verbose "$@" 2>/dev/null "$1" cd sed
+		/usr/bin x=1 echo readonly test
+	2>/dev/null then sed 'quoted text' then 2>/dev/null local "$1" cd
+2>/dev/null printf cd $(pwd) 2>/dev/null --verbose cd 'quoted text' "$1"
+${HOME} echo readonly then 2>/dev/null "$@"
+		"$@" grep /usr/bin /usr/bin 2>/dev/null
+	printf grep awk ${HOME} readonly -eu then "$1" grep printf
+${HOME} && readonly ${HOME} cd readonly --verbose x=1 readonly
+	&& readonly printf local x=1 then 2>/dev/null 'quoted text' readonly
+	then --verbose sed /usr/bin $(pwd)
+$(pwd) --verbose $(pwd) cd -eu sed printf awk readonly --verbose
+"$@" /usr/bin printf awk readonly done awk /usr/bin
+		x=1 export export && awk x=1 then ${HOME} -eu x=1 x=1 ${HOME} --verbose
+printf x=1 'quoted text' x=1 awk -eu cd grep | --verbose -eu
+'quoted text' "$@" cd $(pwd) awk x=1 sed done echo 2>/dev/null local "$1" echo
+	2>/dev/null export local awk x=1 grep printf sed done then 'quoted text'
+x=1 -eu 2>/dev/null awk
+	"$@" && printf x=1 && "$@" test && | /usr/bin x=1 echo echo
+		grep $(pwd) then cd ${HOME} 2>/dev/null
+grep "$1" 'quoted text' cd /usr/bin printf 2>/dev/null
+		${HOME} export /usr/bin awk grep 'quoted text' 'quoted text' local export
+local --verbose && sed local
+		grep then readonly printf echo awk local readonly test -eu "$@" grep
+then printf | awk test
+	x=1 test | local ${HOME} export
+grep done | sed printf export
+	readonly cd done x=1 export sed local echo "$1"
+		export | x=1 readonly | 2>/dev/null
+		/usr/bin /usr/bin awk sed $(pwd) then sed done
+		--verbose test cd local $(pwd) echo printf local readonly
+readonly local awk --verbose
+		"$@" ${HOME} "$1" "$1" --verbose $(pwd) "$1" /usr/bin ${HOME} then
+	then cd && grep && test ${HOME} local && sed grep
+export ${HOME} readonly readonly local --verbose printf done
+	printf && readonly done echo ${HOME} /usr/bin local $(pwd) "$@" grep sed local
+local 2>/dev/null sed 'quoted text' then 'quoted text' /usr/bin sed "$@"
+	done cd x=1 --verbose printf grep sed /usr/bin
+| x=1 local 'quoted text'
+		2>/dev/null ${HOME} done 2>/dev/null
+	export && sed "$@" -eu cd echo &&
+		readonly local "$@" done
+	local ${HOME} -eu awk $(pwd) && 'quoted text'
+	cd export x=1 x=1 --verbose 'quoted text' $(pwd)
+	"$1" "$@" x=1 && export --verbose echo test
+		cd then /usr/bin done x=1 sed then echo 'quoted text' x=1 then
+sed awk test ${HOME} local
+test -eu x=1 sed "$1" | readonly printf echo -eu echo
+"$@" test readonly x=1 | cd /usr/bin && export 2>/dev/null
+	then && printf $(pwd) --verbose 2>/dev/null export
+		grep done then local | "$@" -eu 2>/dev/null ${HOME} $(pwd)
+	echo export 2>/dev/null sed $(pwd) export done echo local $(pwd)
+	/usr/bin 'quoted text' grep "$@" "$@" -eu
+| awk x=1 x=1 done 'quoted text' grep cd ${HOME} readonly --verbose $(pwd)
+	"$1" awk done readonly 2>/dev/null cd then $(pwd)
+readonly printf "$1"
+		then --verbose /usr/bin printf then readonly
+		local local 2>/dev/null && ${HOME} sed $(pwd) --verbose then "$1" awk | "$@"
+		printf done export local 'quoted text' local 2>/dev/null sed readonly
+	&& /usr/bin | grep sed -eu x=1 grep grep
+		cd x=1 awk test && $(pwd) echo export 'quoted text'
+	"$@" 2>/dev/null /usr/bin x=1 $(pwd) grep awk grep --verbose
+		| "$1" 2>/dev/null /usr/bin
+		| 2>/dev/null test done ${HOME}
+		printf "$@" sed grep done && x=1 awk ${HOME} "$1" $(pwd) $(pwd) local export
+	'quoted text' test grep
+	2>/dev/null ${HOME} done -eu grep 2>/dev/null echo -eu done -eu
+test awk awk then ${HOME} 'quoted text' 2>/dev/null /usr/bin -eu done local
+echo 2>/dev/null ${HOME} local 'quoted text'
+readonly then -eu "$1" cd sed x=1 readonly cd
+		$(pwd) readonly 2>/dev/null printf
+	sed --verbose 2>/dev/null "$1"
+echo export printf x=1
+cd printf && | "$@" $(pwd) ${HOME} printf $(pwd) cd printf ${HOME}
+		"$@" readonly then "$1" sed
+readonly --verbose /usr/bin | sed $(pwd) 2>/dev/null
+		test printf test "$@" then printf "$@" $(pwd) -eu "$@" --verbose
+'quoted text' then "$@" cd
+	printf 2>/dev/null printf | "$@" /usr/bin test local then | grep
+	x=1 -eu | test 'quoted text' readonly grep --verbose
+		x=1 echo cd then then | test /usr/bin 'quoted text' echo | then
+	sed sed "$1" -eu sed sed echo | 2>/dev/null then echo cd 'quoted text'
+cd sed --verbose export -eu | sed done x=1 $(pwd) --verbose sed && test sed cd
+	grep cd && x=1 && $(pwd) ${HOME} local local readonly ${HOME} | awk
+	export /usr/bin echo export
+		"$@" 2>/dev/null && 2>/dev/null sed x=1 2>/dev/null grep ${HOME}
+"$1" grep done --verbose grep printf --verbose echo then export printf printf
+	done readonly "$@" sed "$@" sed
+printf $(pwd) grep "$@" test 2>/dev/null "$@" --verbose
+	'quoted text' export ${HOME} "$@"
+readonly sed cd test && && 'quoted text' ${HOME} local
+done --verbose 'quoted text' export | echo | "$@" "$1" then
+		| 'quoted text' sed sed $(pwd) cd /usr/bin "$1" echo awk x=1 $(pwd) "$@"
+		"$@" 2>/dev/null local test $(pwd) done readonly
+		| local --verbose done x=1 export
+--verbose $(pwd) x=1 echo cd
+		readonly ${HOME} readonly ${HOME} | local echo then sed printf cd 2>/dev/null
+	cd echo 2>/dev/null then ${HOME} 'quoted text' "$@"
+		&& echo "$@" 'quoted text'
+		awk && echo local readonly 'quoted text' test 2>/dev/null awk | 'quoted text'
+		/usr/bin -eu "$1" -eu
+		-eu awk grep then "$@" | "$1" 'quoted text' --verbose 'quoted text' $(pwd)
+		readonly sed $(pwd) x=1 test cd | export
+		| $(pwd) "$@" printf $(pwd) cd $(pwd) --verbose "$@" 'quoted text' "$@" ${HOME}
+awk x=1 -eu then $(pwd) printf --verbose export $(pwd) x=1 x=1
+		2>/dev/null export awk | 2>/dev/null
+&& ${HOME} printf "$1" local
+	printf x=1 done printf ${HOME} 2>/dev/null --verbose x=1 local
+	export x=1 printf /usr/bin printf && export readonly | && awk -eu printf
+cd cd awk readonly -eu 2>/dev/null local echo $(pwd) then echo -eu
+		/usr/bin cd then x=1 -eu echo done test -eu && "$@" /usr/bin awk | x=1 "$@" awk
+		sed test ${HOME} readonly export x=1 "$1" ${HOME}
+		| cd "$1" --verbose "$@" awk /usr/bin "$@" | local 2>/dev/null --verbose
+	| --verbose cd readonly cd 2>/dev/null /usr/bin
+	local grep | cd "$@" grep
+		awk cd ${HOME} readonly
+	${HOME} sed x=1 /usr/bin -eu grep | ${HOME} x=1 "$1" 2>/dev/null printf
+		local sed "$@" | 2>/dev/null
+export export "$1" awk printf test done && grep cd x=1 local awk
+cd --verbose echo done readonly test done $(pwd) grep
+-eu sed | readonly $(pwd)
+/usr/bin test | -eu | "$@" $(pwd)
+		/usr/bin awk "$1" test -eu "$@" sed ${HOME} readonly
+	x=1 done | | grep "$@" done
+	/usr/bin printf printf test
+		-eu -eu 'quoted text' readonly sed 'quoted text' sed /usr/bin done "$@"
+		2>/dev/null echo | test done cd $(pwd) then
+		${HOME} sed local sed x=1 sed awk printf ${HOME} grep echo
+	'quoted text' && test /usr/bin x=1 -eu test
+readonly ${HOME} 2>/dev/null awk cd 2>/dev/null
+		"$@" grep "$@" --verbose done sed "$1" done -eu then sed printf | ${HOME}
+then 'quoted text' then grep sed then 2>/dev/null grep
+	echo readonly /usr/bin /usr/bin printf
+	${HOME} done $(pwd) "$@" test echo printf cd /usr/bin
+'quoted text' /usr/bin && "$@" /usr/bin "$@" x=1 export cd --verbose
+-eu "$1" done "$1" ${HOME} printf "$@" echo cd
+	x=1 "$1" 2>/dev/null "$@" $(pwd) done 2>/dev/null "$@"
+		"$1" awk /usr/bin -eu --verbose
+readonly done printf x=1 done -eu printf local then cd --verbose grep && |
+	readonly $(pwd) /usr/bin
+	x=1 grep cd readonly 'quoted text' -eu --verbose echo /usr/bin && 'quoted text'
+local --verbose --verbose printf export
+-eu -eu x=1 ${HOME} /usr/bin test grep readonly done
+		test /usr/bin sed ${HOME} then -eu test 'quoted text' local grep "$1" -eu $(pwd)
+grep | 'quoted text' x=1 echo -eu x=1 | done
+	| sed sed 'quoted text' then $(pwd)
+	readonly 2>/dev/null grep "$1" readonly "$@" x=1
+		local cd grep awk && x=1 export -eu -eu grep 2>/dev/null done --verbose
+		&& /usr/bin local echo --verbose then $(pwd) | x=1 -eu awk cd $(pwd) awk
+&& sed printf | printf 2>/dev/null $(pwd) ${HOME} "$@"
+echo /usr/bin --verbose printf | sed 'quoted text' /usr/bin local
+	done test done cd then 2>/dev/null
+	/usr/bin local awk && /usr/bin
+		awk awk ${HOME} 'quoted text' awk
+sed readonly | ${HOME} --verbose printf --verbose ${HOME} printf
+		echo export --verbose done grep printf 'quoted text' ${HOME}
+printf readonly "$1" -eu awk 'quoted text' local
+	x=1 $(pwd) "$1" grep x=1 --verbose | -eu
+grep $(pwd) then printf --verbose
+	grep echo 'quoted text' echo cd x=1 && "$1"
+x=1 | sed echo | local then echo
+		cd readonly awk export export export sed ${HOME} printf | ${HOME}
+		local done echo local "$@" awk 'quoted text'
+		sed printf 'quoted text' x=1 --verbose then
+		grep -eu $(pwd) local ${HOME}
+		$(pwd) | printf echo ${HOME} awk 2>/dev/null echo echo ${HOME} --verbose
+	sed export --verbose readonly
+-eu -eu export local test
+		--verbose printf awk "$@" readonly $(pwd) export
+		| readonly then 'quoted text' cd
+		then ${HOME} "$1" ${HOME} then 2>/dev/null
+	export cd cd --verbose | then -eu "$1" local
+		awk "$@" cd readonly && "$@" ${HOME} readonly
+		grep readonly | test sed ${HOME} 2>/dev/null
+printf sed "$1" readonly sed export test test export && readonly
+		/usr/bin x=1 export "$@"
+then done then echo sed readonly
+local "$1" export ${HOME} -eu "$1" awk 2>/dev/null "$1" --verbose
+		echo x=1 | test | grep cd then sed 'quoted text'
+cd sed ${HOME} sed test $(pwd) printf
+		"$@" done ${HOME} "$1" x=1 sed sed -eu
+	/usr/bin export --verbose "$1" 'quoted text' then 2>/dev/null
+		${HOME} $(pwd) local $(pwd) awk $(pwd) "$1" ${HOME} "$@" && 'quoted text' export
+		"$1" then 'quoted text' x=1 then 2>/dev/null
+		test "$@" printf done grep export | "$@" local
+"$@" local --verbose awk
+	| && /usr/bin printf export then --verbose printf
+test printf 2>/dev/null export then sed $(pwd) echo -eu sed done 2>/dev/null
+	sed readonly echo ${HOME} test
+-eu "$@" local $(pwd) x=1 then ${HOME} cd local done
+	${HOME} export grep done echo cd 'quoted text'
+		&& readonly awk -eu x=1 printf && x=1 'quoted text'
+x=1 echo grep readonly && | local 2>/dev/null sed ${HOME} echo sed readonly
+	local sed done | awk $(pwd) /usr/bin
+readonly local cd $(pwd) /usr/bin test x=1 export test sed /usr/bin "$1"
+	sed --verbose cd readonly $(pwd) test $(pwd) x=1 cd test export done "$1" |
+readonly grep $(pwd) ${HOME}
+	x=1 sed "$@" printf --verbose -eu ${HOME}
+		awk readonly "$@" x=1 'quoted text' echo ${HOME} export "$1" ${HOME}
+readonly done then --verbose "$1" x=1 printf /usr/bin "$1" echo 2>/dev/null
+	${HOME} readonly && "$1" printf "$1"
+	"$@" -eu && $(pwd) $(pwd) ${HOME} 'quoted text' ${HOME} x=1 /usr/bin
+'quoted text' -eu -eu 2>/dev/null export x=1 sed --verbose
+	-eu sed "$@" && local 2>/dev/null sed "$@" done grep "$@"
+	then awk grep /usr/bin
+	2>/dev/null --verbose -eu "$@" test readonly awk "$1" x=1 echo
+		"$1" x=1 x=1 x=1 grep "$@" "$1" then readonly awk test local "$1" -eu && export
+	--verbose 'quoted text' "$1" awk
+		-eu && $(pwd) sed then printf readonly grep 'quoted text' export
+		printf "$@" ${HOME} "$@" | "$1" 2>/dev/null
+sed -eu echo grep echo grep echo
+	/usr/bin && sed $(pwd) 'quoted text' /usr/bin
+	local "$@" readonly x=1 then sed && awk x=1 readonly -eu "$1" ${HOME} export
+	local 'quoted text' grep $(pwd) --verbose printf
+	export | export done 'quoted text' 'quoted text' cd awk sed cd readonly 2>/dev/null
+"$1" export | 'quoted text' -eu then done then | export echo sed grep
+sed local export awk then "$@" echo | cd done $(pwd) echo test
+local cd then && awk "$@" done "$1" x=1 awk $(pwd)
+local test /usr/bin cd $(pwd) 2>/dev/null ${HOME} 'quoted text'
+| test 2>/dev/null awk then test printf printf readonly "$@" done "$1" echo then
+&& cd cd done -eu && && done
+	grep x=1 local grep --verbose local 'quoted text'
+	${HOME} done x=1 cd ${HOME} grep export && -eu --verbose 2>/dev/null
+'quoted text' $(pwd) "$1" readonly test | "$@" -eu local
+"$1" grep export && /usr/bin readonly cd sed readonly
+		cd awk "$@" echo 2>/dev/null
+	export -eu && readonly && test test test sed "$@" local readonly 'quoted text'
+	${HOME} --verbose then echo test -eu "$1" | local printf "$1" 2>/dev/null
+	&& test readonly $(pwd) grep 2>/dev/null
+		readonly test 'quoted text' test -eu -eu readonly -eu | then x=1 'quoted text'
+cd then --verbose grep local test "$1" grep | cd 'quoted text' ${HOME}
+		${HOME} -eu | readonly "$1" sed | && test 'quoted text' echo
+	export --verbose done "$@" then 2>/dev/null -eu && /usr/bin 'quoted text'
+grep ${HOME} | $(pwd) local
+test -eu done $(pwd) /usr/bin 2>/dev/null --verbose
+		2>/dev/null | -eu 2>/dev/null $(pwd)
+then awk then grep "$1" 2>/dev/null grep cd && | awk "$@" "$1" $(pwd) test
+		echo test then | readonly test ${HOME} --verbose then
+	done ${HOME} done grep ${HOME} done cd 2>/dev/null echo | sed export
+/usr/bin | && $(pwd) then sed | local 'quoted text'
+/usr/bin "$@" export 2>/dev/null
+test --verbose "$1" ${HOME} 2>/dev/null test | grep ${HOME} "$@" x=1 awk 'quoted text'
+	sed awk done done "$@" "$@" printf
+| echo grep $(pwd) -eu export | && echo grep export
+		$(pwd) done awk 'quoted text' done readonly grep test grep
+sed readonly then -eu | x=1 export done grep $(pwd) -eu export
+	/usr/bin /usr/bin $(pwd) done
+		"$@" "$@" awk readonly done grep $(pwd) sed cd readonly
+		"$1" ${HOME} done && x=1 "$@" 'quoted text'
+2>/dev/null local awk local echo ${HOME} x=1 printf grep
+sed x=1 'quoted text' | echo "$@" | ${HOME}
+	awk cd echo test grep -eu printf /usr/bin test
+local cd done "$1" printf sed x=1 then 2>/dev/null
+	/usr/bin awk then | 'quoted text' cd then awk && local local -eu
+		&& readonly x=1 printf export export
+	done sed 2>/dev/null printf sed /usr/bin --verbose sed done "$1" printf
+		echo ${HOME} grep /usr/bin awk "$1" "$@" local readonly done done x=1
+	test 'quoted text' -eu awk ${HOME} grep | sed printf
+	awk 2>/dev/null local test 'quoted text'
+/usr/bin /usr/bin -eu readonly 2>/dev/null 'quoted text'
+readonly $(pwd) | echo then x=1 $(pwd) local then 'quoted text' "$@" -eu readonly
+		$(pwd) test printf && "$1"
+	cd 2>/dev/null grep --verbose done local grep local
+$(pwd) x=1 2>/dev/null && export
+	printf readonly "$@" test printf 'quoted text' cd "$@" ${HOME} "$@" ${HOME}
+		"$@" grep printf local ${HOME} awk awk readonly "$1" -eu
+'quoted text' | readonly echo "$@" then "$1" printf grep --verbose readonly /usr/bin
+		printf x=1 sed "$@" -eu --verbose
+test /usr/bin | printf "$1"
+echo ${HOME} ${HOME} ${HOME} local local | sed ${HOME} "$1" local
+"$1" --verbose x=1 awk cd done printf echo && test "$1" 'quoted text'
+awk echo | cd 2>/dev/null && cd local
+		cd test cd printf ${HOME} | "$@" --verbose 2>/dev/null 'quoted text' awk printf
+then done "$1" "$1" -eu awk test ${HOME}
+-eu x=1 ${HOME} sed | 'quoted text' echo cd ${HOME} "$@"
+	/usr/bin ${HOME} "$@"
+	then $(pwd) grep test /usr/bin grep grep sed awk awk -eu readonly
+'quoted text' export -eu awk readonly | 2>/dev/null
+2>/dev/null export readonly -eu $(pwd) $(pwd)
+		"$@" && sed grep -eu printf "$1" 'quoted text'
+	done done -eu printf "$@" 'quoted text' /usr/bin
+	echo && | echo awk ${HOME} --verbose
+	| | export --verbose ${HOME} printf done sed then x=1 -eu 'quoted text' 'quoted text'
+	awk done $(pwd) "$1" export local export
+	printf sed | grep ${HOME} printf 'quoted text' 2>/dev/null $(pwd) done | export
+&& export 2>/dev/null local echo $(pwd) done grep ${HOME} sed grep x=1
+test ${HOME} /usr/bin
+grep "$1" sed cd done 'quoted text' done /usr/bin sed
+	cd cd sed sed then /usr/bin grep
+	&& then -eu --verbose readonly
+		echo export done && done echo echo && readonly
+	sed /usr/bin --verbose echo $(pwd) then /usr/bin | printf
+	then awk grep $(pwd) done $(pwd)
+echo export "$1" sed /usr/bin $(pwd) --verbose "$1"
+	printf -eu x=1 'quoted text' /usr/bin sed readonly --verbose
+cd local 2>/dev/null 2>/dev/null 'quoted text' grep 2>/dev/null "$1" ${HOME}
+local cd awk | 2>/dev/null awk export local awk
+		awk "$@" printf "$@" awk echo ${HOME}
+local test done /usr/bin test test sed echo sed local x=1 $(pwd) && export echo
+		"$1" && printf grep sed $(pwd) sed x=1 awk /usr/bin /usr/bin printf 'quoted text'
+	/usr/bin 2>/dev/null sed then $(pwd) export -eu
+	--verbose ${HOME} export $(pwd)
+		test -eu printf --verbose --verbose
+printf "$1" sed export test export && "$1" --verbose && "$1" $(pwd) |
+	export -eu awk cd sed awk sed echo
+export grep 'quoted text' export done && test export "$1" /usr/bin |
+	echo /usr/bin printf test
+test cd test ${HOME} cd readonly && printf local --verbose 2>/dev/null
+readonly | --verbose && echo && |
+2>/dev/null 2>/dev/null "$1" $(pwd) --verbose 2>/dev/null export ${HOME}
+	export cd cd 'quoted text' sed --verbose $(pwd) "$@"
+| awk grep "$1" -eu then printf cd "$1" done && local 2>/dev/null
+'quoted text' done x=1 | && readonly echo | awk sed test --verbose grep "$@" "$1"
+	grep grep x=1 2>/dev/null awk printf readonly sed
+$(pwd) "$@" && local cd /usr/bin
+export echo then export "$@"
+	test 2>/dev/null ${HOME} printf | 2>/dev/null && then /usr/bin
+	--verbose awk then x=1 cd "$@" $(pwd) cd readonly local awk cd
+'quoted text' local local echo sed done ${HOME} 'quoted text'
+'quoted text' $(pwd) test echo &&
+'quoted text' done | echo /usr/bin readonly test | x=1 local readonly sed
+	&& && cd && done 2>/dev/null echo export done grep -eu && -eu readonly sed echo
+	--verbose echo 'quoted text'
+		export printf cd "$1" grep $(pwd) readonly
+	done grep cd printf 'quoted text' test "$@" echo echo
+		export export local "$1" $(pwd) | sed "$@" "$1" "$@" /usr/bin $(pwd) 2>/dev/null
+"$1" awk x=1 then 2>/dev/null /usr/bin
+		test local 'quoted text'
+	-eu test test test && readonly x=1 then
+/usr/bin && x=1 local x=1 ${HOME} /usr/bin /usr/bin grep "$@" printf export
+	"$1" local cd | 'quoted text' sed sed && /usr/bin echo "$@"
+		"$1" done --verbose then /usr/bin && then grep grep
+2>/dev/null 'quoted text'
+$(pwd) export "$@" test test printf echo
+		test $(pwd) readonly test test done done "$@" "$1"
+	"$@" done test export x=1 'quoted text' done /usr/bin export --verbose
+	export 'quoted text' |
+'quoted text' grep "$1" "$1" "$@" $(pwd) then echo echo readonly /usr/bin
+	awk x=1 cd sed "$1" export done echo /usr/bin done "$1" echo echo grep awk
+		-eu then cd sed awk --verbose then
+then printf printf 'quoted text' x=1 export grep 2>/dev/null
+| local echo readonly sed x=1 then $(pwd) echo done
+	then awk printf done x=1 "$@" -eu x=1 2>/dev/null done then awk
+		grep printf 2>/dev/null grep --verbose | 'quoted text' sed
+		awk echo grep export grep -eu $(pwd) readonly ${HOME} readonly test | local x=1
+		echo | /usr/bin done --verbose
+done "$1" done local export then
+$(pwd) 'quoted text' grep echo awk grep sed readonly "$@" printf $(pwd)
+"$1" ${HOME} "$@" sed --verbose cd x=1 grep cd grep echo "$1" echo then printf
+	cd --verbose grep export | "$1" && && && --verbose | readonly done local
+	| && --verbose printf grep echo x=1 export -eu
+		--verbose --verbose done test cd readonly /usr/bin && export
+&& ${HOME} test cd "$@" "$@" then "$1" "$1" 'quoted text' cd "$1" 2>/dev/null
+echo -eu grep $(pwd) printf --verbose
+sed sed readonly done "$@" grep | readonly local $(pwd) 2>/dev/null ${HOME}
+'quoted text' "$1" && export 'quoted text' grep -eu /usr/bin "$@" readonly local
+	-eu --verbose grep awk
+		awk then && x=1 'quoted text' echo
+		--verbose local done 'quoted text'
+	-eu -eu echo echo cd cd | "$@" local "$@" ${HOME} /usr/bin
+		echo printf --verbose echo -eu
+		&& /usr/bin printf ${HOME} local local awk 2>/dev/null done && local sed
+	grep "$@" echo test && 'quoted text' done sed $(pwd) "$1" x=1 $(pwd) /usr/bin
+cd echo --verbose 2>/dev/null cd -eu then export sed done
+	cd "$@" cd 'quoted text' -eu /usr/bin done 2>/dev/null
+		| export /usr/bin | local "$@"
+		sed -eu $(pwd) --verbose export
+"$@" && sed grep ${HOME} | $(pwd) | readonly
+	"$@" awk grep x=1 /usr/bin --verbose --verbose done grep
+		grep awk --verbose --verbose sed echo cd cd test /usr/bin && 'quoted text'
+	export test cd x=1 --verbose awk local /usr/bin
+		"$@" echo 'quoted text' printf local -eu /usr/bin echo printf
+	'quoted text' /usr/bin 2>/dev/null echo
+grep "$@" 2>/dev/null 2>/dev/null cd -eu | ${HOME} /usr/bin
+echo /usr/bin -eu $(pwd) awk "$1" $(pwd) sed x=1 $(pwd) x=1 2>/dev/null
+sed && -eu grep then ${HOME} /usr/bin sed | awk 2>/dev/null export &&
+-eu local "$@" printf printf awk 'quoted text' sed readonly awk
+then | sed test awk x=1 2>/dev/null
+$(pwd) "$@" awk /usr/bin --verbose sed ${HOME} "$1" echo test
+	"$1" "$@" awk sed echo x=1 echo ${HOME} export "$@" readonly
+	"$@" awk done "$@" sed printf
+"$@" readonly grep -eu -eu echo local 'quoted text' /usr/bin ${HOME} /usr/bin
+	${HOME} -eu -eu printf echo | 'quoted text'
+echo readonly echo local x=1 | $(pwd) printf | "$@" test
+echo && ${HOME} done && grep
+		local -eu local cd printf ${HOME} printf x=1 cd test readonly &&
+	"$@" export $(pwd) then ${HOME} test | export readonly done
+	'quoted text' then then export done echo --verbose
+grep awk printf test x=1 done done "$@" cd 'quoted text' readonly
+		"$1" -eu ${HOME} $(pwd)
+	printf | printf 2>/dev/null $(pwd) awk then
+	$(pwd) readonly sed then readonly x=1 "$@" -eu 'quoted text'
+&& 2>/dev/null readonly readonly x=1 'quoted text' $(pwd)
+	| echo done grep sed local
+	printf "$1" done 'quoted text' --verbose export
+printf 2>/dev/null --verbose export $(pwd) 2>/dev/null ${HOME}
+		readonly export printf "$1" && $(pwd) 'quoted text' "$@" readonly cd readonly
+&& $(pwd) then done | --verbose then echo done "$1" done grep sed x=1 local
+		/usr/bin done $(pwd) local echo grep sed local ${HOME} echo
+		$(pwd) $(pwd) sed /usr/bin cd readonly && x=1 cd x=1
+		local echo && 'quoted text' done test cd $(pwd) x=1
+		sed && $(pwd) /usr/bin $(pwd)
+		&& 2>/dev/null printf --verbose $(pwd) 2>/dev/null x=1 local
+		/usr/bin "$@" printf test done 2>/dev/null
+		awk --verbose readonly export | local 2>/dev/null --verbose ${HOME}
+	test sed /usr/bin awk $(pwd) local readonly ${HOME} "$1" 2>/dev/null
+		done --verbose sed grep readonly done echo
+		export done 2>/dev/null printf "$@" awk | x=1 printf
+	sed grep 'quoted text' export /usr/bin && echo 'quoted text'
+	"$@" --verbose /usr/bin "$1" test /usr/bin local 'quoted text' readonly --verbose
+-eu test export done x=1 "$@" awk "$1" test readonly awk sed x=1 "$@" /usr/bin
+		'quoted text' printf awk
+	export $(pwd) "$@" $(pwd) | awk ${HOME} "$@" echo export
+		"$@" $(pwd) -eu --verbose "$@" sed --verbose
+		"$@" done x=1 x=1 done done "$1"
+	echo "$1" ${HOME} 2>/dev/null "$1" sed --verbose cd ${HOME}
+echo --verbose 2>/dev/null echo cd -eu export then 2>/dev/null
+awk then export "$@" done "$1" readonly $(pwd) readonly awk grep -eu
+	-eu done sed "$@" ${HOME} 'quoted text'
+	then awk | x=1 x=1 then cd --verbose
+	/usr/bin printf /usr/bin then 2>/dev/null then awk sed echo test --verbose --verbose
+		test awk && readonly cd echo done x=1 grep
+		then awk printf | --verbose local "$@" -eu | &&
+	awk && "$1" | "$@" 2>/dev/null -eu done local --verbose ${HOME} grep export
+		cd 2>/dev/null --verbose 'quoted text' grep export then
+		cd ${HOME} local local && done /usr/bin $(pwd) --verbose -eu "$@" ${HOME} printf
+		readonly then sed grep sed then "$1" readonly
+	local done then 2>/dev/null "$1" test grep && echo
+	local -eu ${HOME} ${HOME} 2>/dev/null
+x=1 readonly ${HOME} export
+cd x=1 grep --verbose x=1 "$1" $(pwd)
+local test export x=1 'quoted text' $(pwd) cd local "$@" local x=1 --verbose
+	readonly grep $(pwd) test done grep 'quoted text' grep printf /usr/bin cd
+	"$@" /usr/bin export "$1" 'quoted text'
+		printf 2>/dev/null local local readonly ${HOME} "$@" test awk then 'quoted text'
+"$1" /usr/bin then 2>/dev/null
+		grep 'quoted text' && && /usr/bin $(pwd) echo --verbose then
+	"$1" then ${HOME} readonly "$1" 2>/dev/null readonly export
+	"$@" then grep -eu x=1 grep test ${HOME} $(pwd) $(pwd)
+printf sed sed ${HOME} echo "$1" awk test local then $(pwd) then
+$(pwd) -eu 2>/dev/null && test && $(pwd) echo x=1 awk sed $(pwd) /usr/bin
+export grep readonly local done done awk $(pwd) | local local 2>/dev/null
+		x=1 $(pwd) local 2>/dev/null done local | x=1 'quoted text'
+awk awk x=1 && "$1" x=1 readonly "$@" local echo
+	sed printf ${HOME} done printf test --verbose done export
+	&& ${HOME} cd "$1" test readonly export
+local -eu done /usr/bin "$@" local /usr/bin -eu readonly test export printf
+		cd | then test ${HOME} cd test then 'quoted text'
+cd local --verbose 2>/dev/null awk awk readonly $(pwd) "$@"
+local 'quoted text' && local "$@" echo
+&& x=1 printf -eu | "$1" awk "$1" done echo "$@" grep local
+		grep cd cd done sed sed
+	-eu echo "$@" printf readonly --verbose
+	x=1 ${HOME} ${HOME} local export echo $(pwd) grep done printf 2>/dev/null local
+	"$1" awk -eu | "$@" 'quoted text' export -eu cd sed then echo --verbose readonly
+	'quoted text' export sed local $(pwd) "$@" export "$@" | readonly cd
+awk cd test "$1" export --verbose export awk x=1 test --verbose
+sed sed $(pwd) echo 2>/dev/null echo 2>/dev/null /usr/bin done
+	&& test | awk done x=1 "$1" grep -eu -eu test ${HOME} grep && printf
+		echo readonly x=1 "$@" cd sed
+	echo ${HOME} echo $(pwd) $(pwd) sed sed && grep /usr/bin printf then "$@"
+		&& echo /usr/bin | /usr/bin
+	local awk 2>/dev/null 'quoted text'
+	--verbose grep 2>/dev/null 2>/dev/null
+2>/dev/null "$@" readonly 2>/dev/null export echo -eu --verbose -eu x=1 "$@"
+		"$1" 'quoted text' sed sed awk printf
+"$@" done echo && && && local then grep $(pwd) && readonly
+	$(pwd) "$@" printf readonly done
+| then export --verbose /usr/bin then "$@" --verbose --verbose
+	"$1" grep grep done --verbose ${HOME} 2>/dev/null
+	&& --verbose x=1 -eu test 'quoted text'
+		export export then --verbose
+export test | $(pwd) done done ${HOME} echo
+		done echo printf | x=1 x=1 done 2>/dev/null
+grep ${HOME} ${HOME} grep /usr/bin ${HOME} awk -eu "$@" local printf
+	$(pwd) | 'quoted text'
+	| 'quoted text' --verbose "$1" cd echo local readonly
+	${HOME} printf -eu | echo | local then awk printf x=1 done
+'quoted text' grep done readonly && test printf && export test 'quoted text'
+		-eu sed awk then "$@" cd export --verbose
+	test "$1" cd local "$@" printf printf readonly test awk done printf --verbose
+then 'quoted text' ${HOME} export ${HOME} ${HOME} -eu echo then test then echo
+test printf | 'quoted text' "$1" "$@" cd | local /usr/bin
+	test local && ${HOME} local sed | printf done 'quoted text'
+	| cd echo 2>/dev/null echo -eu 'quoted text' $(pwd) x=1 && test done /usr/bin
+cd awk "$@" ${HOME} readonly sed export -eu ${HOME} printf export printf --verbose
+		-eu -eu local && sed readonly 2>/dev/null
+"$@" cd | readonly x=1 export /usr/bin done export then grep
+	$(pwd) /usr/bin "$1" -eu done /usr/bin cd $(pwd) sed -eu done export ${HOME}
+		grep awk 'quoted text' cd export sed
+	$(pwd) 2>/dev/null test local &&
+	cd export --verbose "$1" local printf ${HOME} export -eu /usr/bin
+		echo awk | "$1" readonly --verbose
+-eu test cd x=1 -eu sed && -eu awk grep local awk readonly ${HOME}
+	$(pwd) "$1" ${HOME} grep "$1" "$1" echo
+"$1" export && 2>/dev/null readonly 2>/dev/null grep done
+	"$@" /usr/bin export sed && echo 2>/dev/null
+	| test test && export readonly then /usr/bin printf test && echo readonly "$@"
+	x=1 && ${HOME} sed grep x=1 /usr/bin awk $(pwd) printf then echo cd
+	$(pwd) && then printf --verbose sed printf $(pwd) done "$1" sed
+	'quoted text' echo "$1" /usr/bin
+then export readonly awk echo x=1 cd printf grep /usr/bin
+		export done cd grep $(pwd) "$@"
+		2>/dev/null test readonly --verbose 'quoted text' cd --verbose
+	"$1" "$@" 'quoted text'
+	--verbose cd sed "$1" x=1 "$1"
+		test "$1" done test export local then sed -eu x=1 -eu cd readonly grep
+| done ${HOME} x=1 ${HOME} | done awk && /usr/bin local grep echo --verbose
+		--verbose sed grep -eu -eu sed && "$@" "$@" export sed readonly
+	x=1 sed -eu /usr/bin readonly readonly
+local readonly test 'quoted text' cd -eu
+printf 2>/dev/null echo -eu
+echo && 2>/dev/null grep grep done "$@"
+	&& done local echo ${HOME} "$1" /usr/bin cd then sed /usr/bin
+		/usr/bin | test | test export echo cd awk printf
+grep local awk echo done done "$@" sed readonly
+/usr/bin local x=1 local test local -eu readonly grep 2>/dev/null ${HOME} "$@" sed
+		--verbose 2>/dev/null && "$@" 2>/dev/null
+		x=1 readonly -eu echo local ${HOME}
+then x=1 'quoted text' grep printf 'quoted text' export
+${HOME} -eu ${HOME} /usr/bin /usr/bin
+grep && then "$1" cd printf
+		&& "$@" 'quoted text' cd "$@" done "$1" -eu grep
+--verbose "$1" x=1 test echo test 2>/dev/null |
+		readonly then cd done test -eu awk readonly 2>/dev/null /usr/bin 2>/dev/null
+-eu test export echo ${HOME} grep echo $(pwd)
+done | /usr/bin sed && $(pwd) sed "$1" -eu $(pwd) x=1 /usr/bin done local
+	${HOME} "$1" sed printf -eu grep printf grep readonly sed && sed 2>/dev/null
+	"$1" cd printf --verbose "$1" echo echo
+${HOME} grep echo grep /usr/bin x=1 cd x=1 printf then done sed x=1 ${HOME} 'quoted text'
+	&& && && cd "$@" 'quoted text' then && sed awk --verbose readonly -eu test --verbose
+	cd awk sed 2>/dev/null awk 'quoted text' $(pwd) echo $(pwd)
+	"$1" ${HOME} | 'quoted text'
+		2>/dev/null readonly 2>/dev/null cd local "$1" export
+	grep --verbose sed $(pwd) local $(pwd) sed sed -eu sed
+		test /usr/bin ${HOME} grep then printf 2>/dev/null "$@" 'quoted text'
+$(pwd) cd sed test awk && then | readonly "$@"
+x=1 --verbose cd && local local cd | -eu test -eu printf && grep $(pwd)
+	cd sed done local local readonly then
+sed 2>/dev/null --verbose then
+| test ${HOME} grep cd x=1 -eu then export -eu -eu cd readonly cd | --verbose
+		readonly cd && echo readonly "$1" $(pwd) awk 'quoted text' grep --verbose "$1"
+"$@" "$1" 2>/dev/null grep done --verbose 'quoted text' printf --verbose
+	${HOME} sed grep | -eu "$@" $(pwd) $(pwd) --verbose "$1" grep echo export ${HOME}
+		-eu awk readonly "$@" /usr/bin printf $(pwd)
+		"$@" local cd 'quoted text' "$1" printf && local
+		test printf done "$1"
+export && echo "$1" ${HOME} sed 'quoted text' awk --verbose local
+	done local export "$@" /usr/bin
+	readonly readonly "$@" 2>/dev/null sed x=1 ${HOME} --verbose ${HOME}
+		then 'quoted text' local done
+	$(pwd) -eu printf x=1 readonly printf awk echo
+cd sed awk && echo $(pwd) then x=1 ${HOME} -eu echo readonly /usr/bin $(pwd) 'quoted text'
+sed test --verbose grep grep test echo export readonly
+		/usr/bin x=1 done grep sed ${HOME} local local && then export
+-eu done echo "$@" ${HOME}
+'quoted text' sed then "$1" /usr/bin
+	printf x=1 printf done
+		$(pwd) then "$@" | x=1 "$1"
+		sed && | "$1" && x=1 ${HOME} then 'quoted text' --verbose
+&& then export "$@" awk /usr/bin test "$@" $(pwd) "$1" 'quoted text' echo
+sed printf "$1" ${HOME} $(pwd) /usr/bin 2>/dev/null
+	| done echo grep --verbose cd 2>/dev/null export cd cd local printf then cd
+	x=1 /usr/bin 'quoted text' $(pwd) ${HOME} "$@" grep awk 2>/dev/null
+test local ${HOME} done ${HOME} then 'quoted text' done -eu
+		2>/dev/null test readonly -eu 2>/dev/null cd test 2>/dev/null sed readonly sed then
+		"$@" ${HOME} awk "$1" printf ${HOME} 2>/dev/null
+then /usr/bin test "$1" echo test "$@" awk "$@" /usr/bin cd $(pwd)
+		then $(pwd) then /usr/bin readonly sed then 2>/dev/null
+		"$@" | local "$1" done local "$@" -eu grep 'quoted text'
+	export test test done && grep grep done printf test --verbose local ${HOME} 'quoted text'
+	grep x=1 "$@" printf && echo "$1" "$1" --verbose
+	export && awk /usr/bin "$1" $(pwd) 2>/dev/null x=1 x=1 x=1
+	local $(pwd) "$@" | x=1 'quoted text' printf sed "$1" sed export export | sed --verbose
+${HOME} $(pwd) 2>/dev/null --verbose done 2>/dev/null
+		export then then /usr/bin "$1" awk echo grep
+	echo /usr/bin cd && test --verbose done sed /usr/bin echo printf
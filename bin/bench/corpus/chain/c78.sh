@@ -0,0 +1,2001 @@
+		$(pwd) printf 'quoted text' $(pwd) --verbose 'quoted text' test then
+		echo test | "$1" 2>/dev/null printf --verbose local --verbose local grep export
+--verbose --verbose readonly ${HOME} &&
+$(pwd) sed 2>/dev/null cd test /usr/bin
+	grep ${HOME} "$@" /usr/bin done cd
+		grep 'quoted text' awk --verbose --verbose $(pwd) "$@" printf ${HOME} "$1" printf
+2>/dev/null -eu local echo awk && -eu | && readonly
+		$(pwd) --verbose printf
+'quoted text' "$@" "$@" "$1" grep --verbose cd "$1" export && local --verbose
+sed $(pwd) test readonly "$@" done &&
+		'quoted text' ${HOME} 'quoted text' "$1" export x=1 -eu then
+awk 'quoted text' echo printf sed
+		'quoted text' ${HOME} then done -eu export grep printf /usr/bin
+"$@" then x=1 echo export 2>/dev/null export export local
+		"$1" 'quoted text' $(pwd) echo 'quoted text'
+sed then /usr/bin cd grep then cd then readonly test readonly test 'quoted text'
+	'quoted text' then "$@" && $(pwd) ${HOME} then printf local cd grep
+echo "$@" | cd x=1 awk
+	grep printf /usr/bin $(pwd) readonly /usr/bin
+--verbose local printf local
+		local printf cd $(pwd) ${HOME} awk ${HOME} export readonly
+	cd x=1 sed done test "$1" done "$1"
+	'quoted text' echo && export sed "$1" 2>/dev/null --verbose awk -eu test
+		local test $(pwd) done -eu export "$@" x=1 export sed ${HOME} done 2>/dev/null --verbose
+	&& 'quoted text' printf then
+readonly 'quoted text' test "$@" 2>/dev/null printf
+		${HOME} && $(pwd) && --verbose | $(pwd) "$1" --verbose sed x=1
+		awk 'quoted text' export 'quoted text'
+grep sed cd cd readonly "$1" echo | 2>/dev/null
+done | --verbose --verbose test /usr/bin "$1" test local && "$1"
+		x=1 test && export && export awk 'quoted text' test -eu ${HOME} done $(pwd) echo
+	--verbose done awk done /usr/bin awk printf | && x=1 -eu test "$@" ${HOME}
+		local | readonly | x=1 "$@" x=1 "$@" local local
+"$@" readonly echo echo | -eu grep "$@"
+		done --verbose 2>/dev/null local grep x=1 /usr/bin test cd "$@" awk 'quoted text'
+		| "$1" 'quoted text' ${HOME} grep grep --verbose printf
+	--verbose 'quoted text' "$1" awk -eu then $(pwd) /usr/bin then /usr/bin
+		echo "$1" /usr/bin local sed "$1"
+		'quoted text' grep ${HOME} readonly test grep -eu $(pwd) test grep test local printf
+		test "$1" -eu readonly export readonly && sed readonly
+		"$1" $(pwd) awk 'quoted text'
+/usr/bin printf printf export readonly x=1
+2>/dev/null export | export | 'quoted text' local sed then awk "$1" then awk 'quoted text'
+		$(pwd) export 'quoted text' --verbose && 2>/dev/null && test printf
+	${HOME} -eu awk echo cd 2>/dev/null export &&
+local -eu 'quoted text' ${HOME} grep --verbose echo export ${HOME}
+then grep test && printf $(pwd) readonly | 2>/dev/null readonly printf
+	&& -eu cd 'quoted text' test test ${HOME} $(pwd)
+	local | printf | done "$@" grep then cd | export && 'quoted text'
+		$(pwd) then test then then $(pwd) done cd printf && echo then "$1" 2>/dev/null
+"$@" "$1" export export -eu "$@" --verbose --verbose awk $(pwd) && echo
+grep done 2>/dev/null cd export ${HOME} then printf ${HOME} "$1"
+		awk 2>/dev/null local | -eu printf "$@" sed
+		/usr/bin test printf 'quoted text'
+	awk awk /usr/bin cd --verbose $(pwd)
+		readonly 2>/dev/null readonly $(pwd) readonly 2>/dev/null
+		echo readonly 2>/dev/null
+	-eu local | "$1" 'quoted text' | echo 'quoted text'
+	${HOME} -eu "$@" x=1 readonly done grep test
+awk done | 'quoted text' cd grep echo | --verbose -eu "$@" local grep
+'quoted text' | export | 'quoted text'
+	grep export local printf && /usr/bin done
+		--verbose awk "$@" echo cd "$@" "$1" -eu local && export
+	cd export awk $(pwd) "$1" | test "$1"
+printf export readonly export
+test ${HOME} then "$1" export -eu && cd "$@" awk "$@" grep done 'quoted text' "$1"
+'quoted text' && awk export /usr/bin
+		printf echo cd 2>/dev/null "$1" "$@" "$@" awk x=1 then
+	test test export grep sed then
+	/usr/bin grep -eu sed "$@" x=1 test -eu cd -eu done
+		'quoted text' local "$1" echo local
+	readonly | --verbose grep x=1
+		export "$1" sed 'quoted text' cd $(pwd) echo readonly
+	2>/dev/null "$1" /usr/bin grep grep
+		x=1 readonly local printf local sed ${HOME} ${HOME} ${HOME}
+		then "$1" x=1 && --verbose /usr/bin echo local cd sed local "$1" -eu done
+grep | $(pwd) then test --verbose local local done ${HOME} cd --verbose $(pwd)
+		echo && "$1" x=1 local done cd printf && "$1" x=1 ${HOME} ${HOME} export then $(pwd)
+awk /usr/bin && awk ${HOME} done | sed cd
+test export echo done $(pwd) printf 'quoted text' printf ${HOME}
+	"$@" $(pwd) cd x=1 export local export 2>/dev/null cd grep | /usr/bin
+test "$@" sed && ${HOME} echo 'quoted text' ${HOME} awk
+	'quoted text' echo readonly sed x=1 'quoted text' grep "$@" done
+	--verbose 2>/dev/null --verbose
+${HOME} "$1" readonly && ${HOME} cd "$1" 'quoted text'
+	echo echo "$@" "$1" test -eu grep ${HOME} export cd ${HOME} awk export printf
+printf "$1" cd test echo 2>/dev/null
+'quoted text' 2>/dev/null
+then cd /usr/bin $(pwd) cd x=1 sed cd $(pwd) awk 'quoted text' awk /usr/bin
+	-eu "$1" test "$@" grep local cd sed test done done export && $(pwd) -eu $(pwd)
+	then && ${HOME} grep test 'quoted text'
+2>/dev/null && /usr/bin echo export local
+then awk readonly x=1 sed /usr/bin | readonly export cd
+export $(pwd) 2>/dev/null cd "$1"
+		x=1 export && -eu grep then --verbose -eu grep "$@" done done && && 2>/dev/null
+	then 'quoted text' && printf awk test echo "$@" awk readonly echo | ${HOME} test
+local | 2>/dev/null then awk done local
+awk "$@" /usr/bin awk local echo readonly test awk ${HOME} -eu then x=1 done
+2>/dev/null then readonly $(pwd) done 2>/dev/null
+sed --verbose local then ${HOME} awk && printf echo | then -eu sed cd /usr/bin
+	done cd -eu then | -eu "$@" | "$@" && x=1
+export 2>/dev/null done printf
+grep printf && cd echo cd sed ${HOME} -eu
+"$@" done ${HOME} $(pwd) awk
+		"$1" -eu readonly export ${HOME} cd test done echo then
+	cd sed echo sed export &&
+		echo cd $(pwd) done printf "$@" 'quoted text' awk "$1" cd printf readonly
+		local export printf "$@" printf cd sed 2>/dev/null 2>/dev/null local awk
+&& x=1 | then --verbose echo && ${HOME}
+&& done done 2>/dev/null echo local awk | sed done local cd
+		test $(pwd) $(pwd) ${HOME} test export then cd ${HOME} | $(pwd) test
+		/usr/bin cd /usr/bin printf test
+	2>/dev/null echo export --verbose
+"$1" && readonly && x=1 x=1 $(pwd)
+		$(pwd) ${HOME} && --verbose && "$@" printf
+echo | readonly done readonly test readonly done
+"$1" "$@" local then test sed
+--verbose sed printf /usr/bin local test "$1" printf ${HOME}
+x=1 $(pwd) 'quoted text' "$1" "$1" echo
+"$1" readonly export printf ${HOME} echo
+	printf awk printf echo awk then grep sed -eu -eu 2>/dev/null
+done "$@" awk "$@" grep test
+		2>/dev/null export --verbose && export printf
+		2>/dev/null $(pwd) --verbose readonly test printf readonly awk && awk
+	export x=1 local 2>/dev/null cd readonly readonly done awk done
+	sed done "$@" sed done printf local $(pwd) echo readonly
+		export 'quoted text' /usr/bin $(pwd) $(pwd) printf ${HOME} | -eu /usr/bin grep
+		done | cd $(pwd) 'quoted text'
+x=1 x=1 sed "$1" 2>/dev/null
+"$@" local done cd awk /usr/bin
+$(pwd) awk done --verbose
+	"$1" sed ${HOME} awk echo 'quoted text' then "$1" sed then local
+test readonly local export local test x=1 x=1 | -eu done
+test x=1 awk --verbose done readonly
+	"$1" 'quoted text' sed
+printf echo done done /usr/bin -eu done export -eu cd cd
+	${HOME} printf sed echo | cd printf local sed local local printf x=1 'quoted text'
+		sed test --verbose x=1 && -eu cd grep sed echo
+		$(pwd) test local --verbose echo "$@" awk then -eu "$1" &&
+	grep ${HOME} done awk cd --verbose readonly 2>/dev/null "$1" cd x=1 then |
+sed readonly printf ${HOME} done cd then
+		sed -eu local $(pwd) printf cd -eu
+done cd 2>/dev/null ${HOME} then "$1" local /usr/bin grep x=1 export echo
+	cd readonly 'quoted text' 2>/dev/null x=1 awk awk 2>/dev/null
+echo echo printf then /usr/bin printf sed "$1" /usr/bin
+&& | 'quoted text' x=1 then then grep then test
+		| /usr/bin 'quoted text' echo printf cd export readonly test local 2>/dev/null
+		&& readonly printf sed
+then "$1" /usr/bin cd 2>/dev/null
+done test | local echo | $(pwd) local printf readonly --verbose | awk
+	export --verbose -eu local "$1"
+		&& readonly && && local then && &&
+		"$@" | --verbose echo 'quoted text' 'quoted text'
+	x=1 | ${HOME} grep printf -eu awk export done
+	/usr/bin test readonly cd | 2>/dev/null cd export $(pwd) cd test --verbose "$@"
+		"$@" then export grep ${HOME}
+	-eu ${HOME} grep echo export
+		local then local | cd awk readonly 2>/dev/null grep -eu local sed "$@" --verbose
+		printf 'quoted text' echo local echo test local
+$(pwd) $(pwd) cd then test 2>/dev/null
+		done "$@" echo local export printf x=1
+| | done ${HOME} 2>/dev/null 'quoted text' sed && "$@"
+		local local 'quoted text' printf local
+		-eu then 'quoted text' 2>/dev/null grep grep "$1" $(pwd) -eu done --verbose
+	readonly printf "$@" printf $(pwd) cd 2>/dev/null
+readonly "$1" done -eu && cd local ${HOME}
+		-eu export x=1 then "$1"
+		sed ${HOME} echo awk printf x=1 cd local
+	readonly /usr/bin ${HOME} --verbose 2>/dev/null
+	cd "$@" readonly printf printf sed /usr/bin "$1" export echo
+	awk then /usr/bin ${HOME} $(pwd) test grep -eu sed ${HOME} grep then
+	$(pwd) done "$1" grep ${HOME} done grep /usr/bin "$@" |
+		/usr/bin test echo sed grep local done "$1" test 'quoted text' grep
+	grep printf sed /usr/bin echo
+grep 'quoted text' "$1"
+		-eu test echo && export -eu export | export cd then 'quoted text' echo && -eu
+sed done then sed then printf | readonly local x=1 x=1 x=1 echo export grep
+	local readonly done echo 2>/dev/null
+		"$@" | --verbose "$@" $(pwd)
+	'quoted text' sed awk test --verbose cd local
+		-eu echo | sed "$1" | "$1" export 'quoted text' --verbose echo test /usr/bin awk
+		printf done done readonly /usr/bin 'quoted text' local readonly --verbose
+	done 'quoted text' x=1 readonly -eu 2>/dev/null --verbose
+		2>/dev/null && ${HOME} x=1 'quoted text' "$1" echo
+2>/dev/null && /usr/bin then local 'quoted text'
+	cd "$@" cd readonly echo then grep readonly -eu --verbose
+	readonly $(pwd) cd -eu readonly
+		printf export local "$1" grep "$1" -eu readonly grep done then "$1" awk
+		x=1 | "$1" echo sed "$1" local "$1" test ${HOME}
+grep done test "$@" sed
+grep done export local sed then --verbose
+| echo --verbose readonly $(pwd) x=1 grep printf sed export test printf /usr/bin
+	--verbose "$1" awk --verbose done done readonly awk printf
+cd local | -eu test then local echo
+		--verbose --verbose test ${HOME} then /usr/bin /usr/bin local
+	sed x=1 done echo sed cd sed
+		printf x=1 -eu -eu x=1 grep
+echo /usr/bin done 2>/dev/null
+		'quoted text' grep local export
+		awk && export | awk && 2>/dev/null
+	then x=1 2>/dev/null "$@" $(pwd) echo echo cd readonly x=1 local
+	cd local && readonly "$@" then "$1" x=1 printf printf printf then awk --verbose
+		/usr/bin ${HOME} | | then "$@" "$@"
+-eu grep 2>/dev/null local echo ${HOME} local local export echo
+	"$1" "$1" done | cd -eu done $(pwd) 2>/dev/null
+	"$@" local ${HOME} | $(pwd) "$1"
+		--verbose 2>/dev/null awk && "$1" "$1" done
+		"$@" /usr/bin $(pwd) local x=1 'quoted text' export "$@" grep awk "$1" readonly
+${HOME} then then grep -eu cd export "$1" $(pwd) readonly test --verbose
+${HOME} ${HOME} export export awk sed done then "$1" x=1
+awk printf test local printf ${HOME} test
+	export grep && sed done && ${HOME} export && 'quoted text'
+	${HOME} echo 2>/dev/null done test && printf grep awk
+	readonly printf cd local sed ${HOME} printf sed -eu --verbose
+	awk cd ${HOME} $(pwd) printf
+		&& sed grep export grep readonly
+--verbose grep cd cd echo local $(pwd) sed $(pwd) then then local 'quoted text'
+	local test done local $(pwd) 'quoted text' && 2>/dev/null | printf x=1 "$1" "$@"
+	&& 'quoted text' export awk /usr/bin cd awk test then "$1" ${HOME}
+	${HOME} "$1" /usr/bin x=1 cd /usr/bin 2>/dev/null export 2>/dev/null local
+	"$@" && sed "$1" test echo grep
+	&& "$@" then done awk "$1" then
+		echo cd local test sed /usr/bin local --verbose "$1"
+		echo printf grep echo --verbose && export "$1"
+readonly done grep printf "$1" 'quoted text' x=1 -eu --verbose sed | 2>/dev/null
+	2>/dev/null done local cd && sed --verbose
+		sed x=1 2>/dev/null local printf 'quoted text'
+		then && && test ${HOME} echo $(pwd) printf "$@" grep 'quoted text'
+		awk cd readonly echo | $(pwd) grep done local export "$@" 2>/dev/null 'quoted text'
+		then local grep && then "$@" && cd && 'quoted text'
+		sed x=1 $(pwd) readonly readonly grep grep 2>/dev/null
+		$(pwd) -eu cd x=1 | printf test readonly x=1 export
+	x=1 2>/dev/null | cd --verbose then cd then echo
+		${HOME} local grep cd done grep
+		'quoted text' then /usr/bin 2>/dev/null "$@" cd 2>/dev/null | printf &&
+readonly | export test awk test x=1 | awk "$@" done "$1" 2>/dev/null
+	done sed export /usr/bin --verbose grep x=1 cd -eu test --verbose
+awk printf export -eu grep then readonly grep echo done | "$@" "$1" sed
+	done awk $(pwd) grep | done 'quoted text'
+local 'quoted text' awk awk done $(pwd) x=1
+	x=1 awk -eu done then printf "$1" test && then echo sed then awk "$1" "$@"
+		cd cd echo awk x=1 echo local "$@" then grep local /usr/bin
+| 'quoted text' readonly
+		--verbose ${HOME} $(pwd) awk 'quoted text'
+x=1 2>/dev/null printf sed cd | printf readonly ${HOME} |
+then awk echo 'quoted text' --verbose ${HOME}
+		readonly 2>/dev/null readonly -eu then /usr/bin
+	cd sed /usr/bin then --verbose
+		readonly | --verbose /usr/bin cd export $(pwd) sed sed test && then 2>/dev/null
+	2>/dev/null --verbose "$@" 'quoted text' export sed -eu
+		test echo -eu $(pwd) && | -eu test && x=1 local x=1 test /usr/bin local
+		done "$@" && x=1 grep 2>/dev/null
+		grep 'quoted text' sed "$1" && awk then done ${HOME} "$@"
+	printf x=1 sed && awk cd awk local
+		sed 2>/dev/null | done 'quoted text' sed /usr/bin 2>/dev/null done grep export
+		| export done | 'quoted text' export
+${HOME} grep /usr/bin export "$@" $(pwd) sed /usr/bin
+"$1" test 2>/dev/null 'quoted text' $(pwd)
+		then ${HOME} local $(pwd) printf grep awk 2>/dev/null && | --verbose
+		readonly -eu "$@" echo readonly $(pwd)
+		2>/dev/null local grep then &&
+	grep then "$1" -eu | local 2>/dev/null local printf export -eu sed
+	x=1 echo --verbose local grep
+		test $(pwd) local then test done $(pwd)
+x=1 grep sed -eu cd | echo sed x=1 2>/dev/null 'quoted text'
+--verbose echo 'quoted text' | --verbose local ${HOME} sed
+		readonly sed "$@" printf readonly && $(pwd) x=1 grep awk 'quoted text'
+grep sed printf readonly /usr/bin && 2>/dev/null
+		then readonly 'quoted text' | 2>/dev/null 2>/dev/null 'quoted text'
+	echo 'quoted text' readonly | --verbose
+		test "$@" sed sed grep test "$1" && readonly
+readonly ${HOME} ${HOME} readonly done /usr/bin test done
+		cd done cd x=1 --verbose test /usr/bin 2>/dev/null printf 2>/dev/null 2>/dev/null
+done test printf echo | $(pwd) 2>/dev/null printf grep "$@" "$1" done 'quoted text'
+--verbose 'quoted text' 2>/dev/null "$@" echo
+export 2>/dev/null "$1" readonly /usr/bin cd 2>/dev/null 'quoted text' 2>/dev/null
+readonly | cd cd readonly sed echo test done done $(pwd)
+-eu grep cd 2>/dev/null then "$1" --verbose then awk test sed local 'quoted text'
+test "$@" | then printf --verbose printf sed readonly export -eu then /usr/bin
+	$(pwd) done readonly $(pwd)
+	-eu readonly -eu 2>/dev/null awk 'quoted text' local export
+cd 'quoted text' "$@" grep 2>/dev/null "$@" printf
+		2>/dev/null awk 'quoted text' --verbose local && $(pwd) printf local
+	echo "$1" -eu $(pwd) printf /usr/bin
+	&& x=1 readonly local cd ${HOME} --verbose | export cd test local | 'quoted text'
+/usr/bin /usr/bin export local readonly awk echo x=1 export grep && printf
+sed awk && x=1 2>/dev/null && local sed "$@" | awk local &&
+		grep $(pwd) | 2>/dev/null awk done
+		&& printf --verbose | "$@" "$@" /usr/bin
+"$1" 'quoted text' local printf --verbose sed
+&& printf x=1 "$@" | then
+local $(pwd) sed cd echo x=1 ${HOME} "$1"
+cd readonly /usr/bin echo local export "$@" echo "$1" local
+	| && echo "$1" x=1 "$1" sed grep then grep done readonly
+	grep local /usr/bin awk --verbose cd local then -eu /usr/bin grep "$@"
+export local -eu local echo echo -eu printf awk echo sed $(pwd) echo ${HOME}
+		'quoted text' -eu done sed local done cd x=1 test 'quoted text' x=1
+grep 2>/dev/null test -eu export $(pwd) && /usr/bin
+'quoted text' sed echo ${HOME} cd 2>/dev/null $(pwd) grep
+		awk && ${HOME} done printf readonly
+/usr/bin | printf cd echo 2>/dev/null --verbose then then test /usr/bin
+-eu awk printf -eu "$@" done cd $(pwd) local $(pwd) done local then && --verbose
+--verbose 2>/dev/null export echo sed
+--verbose ${HOME} &&
+test then then awk readonly x=1 sed grep done then "$1"
+		echo echo cd 'quoted text' "$1" /usr/bin
+sed /usr/bin done "$@" --verbose
+/usr/bin printf 2>/dev/null 2>/dev/null test "$1" /usr/bin /usr/bin
+		then ${HOME} ${HOME} -eu ${HOME} readonly "$@" printf done "$1" --verbose
+-eu local then --verbose "$1" then $(pwd) | && "$1" awk ${HOME}
+| 'quoted text' done | export then "$@" cd grep sed 'quoted text'
+		readonly export 2>/dev/null test $(pwd) readonly awk "$@" -eu
+printf awk echo done 2>/dev/null && ${HOME}
+		readonly sed | 'quoted text' local awk --verbose 2>/dev/null printf
+	local echo 2>/dev/null export
+"$1" grep $(pwd) printf /usr/bin 2>/dev/null ${HOME}
+		local cd local x=1 local export "$1" -eu cd --verbose echo $(pwd) 2>/dev/null
+	printf /usr/bin cd local "$@" /usr/bin export --verbose
+	"$@" grep awk done "$1" "$1" /usr/bin test sed /usr/bin local export x=1 "$1" $(pwd)
+	/usr/bin local "$@" grep
+		then printf local ${HOME} cd 'quoted text' readonly
+	/usr/bin printf 'quoted text' echo export printf 'quoted text'
+		export "$@" local done echo grep x=1 'quoted text' cd && sed | cd 'quoted text'
+	done done && 2>/dev/null
+		$(pwd) local "$1" sed printf awk | | done | && &&
+$(pwd) --verbose $(pwd) echo -eu sed cd --verbose
+printf "$1" && awk --verbose printf 'quoted text' export echo echo x=1 &&
+	cd /usr/bin 'quoted text' readonly "$1"
+		sed grep /usr/bin export -eu grep ${HOME}
+	cd awk | printf ${HOME} $(pwd) test done && test
+	-eu 'quoted text' 2>/dev/null local
+	test echo $(pwd) cd done | | test cd readonly $(pwd)
+		local then -eu grep test printf -eu test $(pwd) "$1" --verbose --verbose /usr/bin
+	-eu "$@" x=1 2>/dev/null sed readonly readonly echo ${HOME} /usr/bin ${HOME}
+done 2>/dev/null test | $(pwd) grep grep echo grep printf grep "$@" --verbose
+	local -eu "$@" /usr/bin grep | cd grep
+"$@" grep 'quoted text' --verbose sed "$1" printf "$@" cd --verbose sed $(pwd)
+test echo && readonly cd -eu cd ${HOME} grep x=1 done then local
+	then printf export 2>/dev/null printf echo cd x=1
+"$1" x=1 sed sed 'quoted text' && /usr/bin 'quoted text' && ${HOME}
+	printf $(pwd) ${HOME} awk test "$@" 2>/dev/null export
+awk && test "$1" "$@" 'quoted text' then ${HOME} done | | test
+printf then 'quoted text' readonly $(pwd) 'quoted text' awk ${HOME} ${HOME} | /usr/bin
+| 'quoted text' -eu grep 'quoted text' readonly "$@" export "$1" x=1 awk --verbose
+		$(pwd) then "$1" x=1 x=1 readonly then "$1" printf | 2>/dev/null 2>/dev/null
+	&& readonly $(pwd) test echo test 2>/dev/null awk --verbose
+	printf 2>/dev/null 'quoted text' --verbose
+	test readonly "$1" $(pwd) test x=1 /usr/bin
+	printf -eu export --verbose readonly printf
+${HOME} /usr/bin then then "$1"
+	grep | echo "$@" local | -eu then 2>/dev/null
+	printf then $(pwd) export
+x=1 'quoted text' done x=1 grep printf readonly
+	$(pwd) grep awk && cd && awk printf $(pwd) awk done ${HOME} ${HOME}
+		readonly 2>/dev/null | then cd export readonly && x=1 -eu export /usr/bin
+awk grep "$@" export export x=1 ${HOME} $(pwd) 'quoted text' done
+		/usr/bin --verbose 'quoted text' x=1 $(pwd) echo done
+/usr/bin -eu /usr/bin 2>/dev/null echo
+	cd 2>/dev/null --verbose export
+		local local -eu local cd /usr/bin printf /usr/bin ${HOME}
+	export readonly x=1 && printf && x=1 cd ${HOME}
+echo local then 2>/dev/null
+	readonly --verbose readonly && 'quoted text' grep cd then echo $(pwd)
+	'quoted text' 'quoted text'
+		export $(pwd) done test "$@" sed --verbose 2>/dev/null
+		then && awk "$1" $(pwd) ${HOME} cd 2>/dev/null echo -eu 'quoted text'
+		/usr/bin | cd /usr/bin readonly x=1 ${HOME} x=1 printf cd $(pwd) export test readonly
+2>/dev/null cd 2>/dev/null ${HOME}
+		$(pwd) 2>/dev/null grep --verbose "$1" --verbose
+	export printf -eu && 'quoted text' then
+	"$1" done && x=1 -eu echo test export /usr/bin
+	done ${HOME} cd sed --verbose
+		| | readonly -eu x=1 export
+	--verbose readonly sed --verbose
+		then $(pwd) then export done readonly /usr/bin --verbose 'quoted text'
+		"$1" /usr/bin ${HOME} "$@"
+		test then $(pwd) --verbose grep awk ${HOME} readonly awk "$@" 2>/dev/null grep
+${HOME} then printf "$@" x=1 "$@"
+		printf ${HOME} grep "$@" ${HOME} x=1 "$@" /usr/bin ${HOME} 2>/dev/null done test
+		sed /usr/bin test 2>/dev/null local local 'quoted text' $(pwd) -eu awk done "$1"
+local -eu x=1 'quoted text' ${HOME}
+cd export local then awk 2>/dev/null 2>/dev/null printf --verbose "$@" |
+	-eu x=1 test readonly -eu test x=1 awk /usr/bin | awk
+		&& ${HOME} grep export 2>/dev/null $(pwd) "$1" cd test ${HOME} printf
+		--verbose sed /usr/bin $(pwd) -eu && export readonly 2>/dev/null
+		test awk "$1" local sed awk printf then /usr/bin then "$1" test local then "$1"
+echo /usr/bin x=1 echo echo local --verbose
+	2>/dev/null cd awk cd 2>/dev/null sed local echo -eu ${HOME}
+		x=1 local local printf ${HOME} | readonly
+x=1 echo -eu 2>/dev/null then printf test awk
+		2>/dev/null $(pwd) "$1" 2>/dev/null printf | grep 'quoted text' 'quoted text'
+		"$1" grep --verbose && "$1" test "$@" printf sed test --verbose
+	sed readonly local "$@" then done local printf sed /usr/bin "$1" "$@"
+${HOME} cd "$1" ${HOME} grep export
+"$1" grep echo done awk /usr/bin printf then --verbose && local | "$@" -eu "$@"
+	test /usr/bin x=1 --verbose && sed local "$@" cd printf /usr/bin | $(pwd) readonly
+	-eu --verbose grep 2>/dev/null ${HOME} $(pwd)
+	grep export | ${HOME} done --verbose --verbose x=1 local "$1" | "$1" | local
+	'quoted text' printf then readonly
+test cd "$1" cd readonly 2>/dev/null
+grep cd x=1 x=1 done && then && /usr/bin printf awk
+	export test export then echo -eu 2>/dev/null x=1 "$1"
+	echo /usr/bin readonly -eu && printf printf export
+		/usr/bin "$1" local | cd test export --verbose export --verbose | grep
+	x=1 $(pwd) --verbose /usr/bin
+	cd readonly --verbose x=1 /usr/bin echo -eu printf printf /usr/bin
+${HOME} local $(pwd) echo
+	x=1 cd && --verbose "$1" $(pwd) -eu sed local "$1" "$1" "$1" local
+sed grep cd 'quoted text' export && 'quoted text'
+		x=1 printf /usr/bin test done | echo | grep
+		--verbose /usr/bin 'quoted text'
+	done local && /usr/bin && awk 2>/dev/null "$1" $(pwd) /usr/bin cd --verbose
+sed done | export readonly x=1 cd $(pwd) /usr/bin test awk && printf test 'quoted text'
+	| "$1" grep $(pwd) "$1" awk grep echo readonly
+		readonly | grep then local done $(pwd) awk $(pwd) test
+| "$@" readonly 2>/dev/null echo readonly x=1 --verbose
+then | --verbose export ${HOME} readonly 2>/dev/null readonly
+		local echo test 2>/dev/null $(pwd) ${HOME} printf done sed "$@" "$@" export
+		printf cd 'quoted text' &&
+	awk readonly cd then 'quoted text' sed --verbose "$@" echo && sed |
+then test done ${HOME} | && export printf
+		test test local test readonly "$1" --verbose | cd x=1 2>/dev/null /usr/bin test
+then done 'quoted text' -eu printf $(pwd) grep ${HOME} 2>/dev/null
+		$(pwd) readonly sed awk cd local then 2>/dev/null
+$(pwd) && cd local then then ${HOME} 2>/dev/null done $(pwd) $(pwd) awk
+		local done x=1 test -eu then 'quoted text' "$1" --verbose
+		readonly "$@" | $(pwd) ${HOME} | --verbose /usr/bin $(pwd)
+	$(pwd) done ${HOME} echo && "$1" x=1
+		-eu ${HOME} ${HOME} "$@" && --verbose 2>/dev/null 'quoted text' export
+		test "$1" /usr/bin $(pwd) awk | "$@" $(pwd) 'quoted text' done && cd test echo
+x=1 grep "$1" "$@" --verbose x=1 && ${HOME}
+		"$@" /usr/bin grep -eu 'quoted text' then
+	x=1 'quoted text' $(pwd) "$@" readonly
+export 2>/dev/null readonly
+		2>/dev/null ${HOME} local 'quoted text'
+export $(pwd) $(pwd) awk
+		--verbose -eu | then sed cd readonly echo && sed printf $(pwd) ${HOME}
+	awk --verbose sed done "$1" export grep $(pwd) grep export
+'quoted text' | --verbose | export $(pwd) && done awk $(pwd)
+		--verbose $(pwd) cd --verbose "$1" 'quoted text'
+		&& printf x=1 x=1 x=1 /usr/bin done /usr/bin --verbose
+grep local test "$1" x=1 $(pwd)
+		cd cd local readonly && echo --verbose
+		sed readonly cd | cd then $(pwd) test $(pwd) x=1 local 'quoted text'
+	"$@" "$@" then ${HOME} -eu 'quoted text'
+printf printf -eu 'quoted text' done local done
+${HOME} ${HOME} /usr/bin then then readonly "$@" 2>/dev/null sed "$@" test /usr/bin
+		x=1 "$@" test sed test $(pwd) /usr/bin x=1 then 'quoted text' "$1"
+export grep 2>/dev/null test x=1 then && then printf "$@" 'quoted text'
+		awk readonly | | -eu /usr/bin export && awk printf $(pwd)
+grep "$1" sed readonly cd readonly local ${HOME} cd done --verbose
+	-eu export printf 2>/dev/null -eu /usr/bin 'quoted text'
+	grep "$@" export $(pwd) 2>/dev/null
+local done cd /usr/bin $(pwd) 'quoted text' -eu --verbose
+	'quoted text' && 2>/dev/null "$@" ${HOME} "$1" x=1 /usr/bin
+sed 2>/dev/null then --verbose then $(pwd) 'quoted text'
+"$1" ${HOME} "$@" printf 2>/dev/null 'quoted text' "$@" ${HOME}
+&& 2>/dev/null done -eu printf
+		"$@" cd local ${HOME} cd echo done $(pwd) 2>/dev/null /usr/bin then done --verbose
+	'quoted text' then echo && ${HOME} | --verbose
+printf local 'quoted text' 2>/dev/null "$1" then x=1 printf printf echo
+	done && echo $(pwd) sed awk cd
+		then awk sed /usr/bin 'quoted text' done | $(pwd) 2>/dev/null
+		-eu 'quoted text' -eu && $(pwd) echo "$1" printf && /usr/bin done readonly
+		awk cd local export readonly | readonly
+	&& x=1 done | ${HOME} "$@" "$1" | done $(pwd) echo
+	done export | x=1 | "$@"
+	awk 2>/dev/null 2>/dev/null readonly echo 'quoted text'
+		--verbose 'quoted text' sed echo 2>/dev/null printf /usr/bin
+	echo $(pwd) 'quoted text' grep
+		'quoted text' -eu $(pwd)
+		then then ${HOME} ${HOME} -eu
+echo printf 'quoted text' export -eu cd "$@" local --verbose readonly
+test echo "$1" ${HOME} cd -eu && export export /usr/bin readonly /usr/bin | "$@"
+	'quoted text' sed $(pwd) $(pwd) awk readonly echo printf local /usr/bin "$@"
+		x=1 ${HOME} -eu sed "$1" echo 2>/dev/null
+		export then "$1" cd ${HOME} -eu
+x=1 local $(pwd) cd grep "$1" 'quoted text' 'quoted text'
+echo "$@" ${HOME} echo | x=1 sed $(pwd) ${HOME} grep sed
+	readonly && && /usr/bin 'quoted text' -eu export local test cd 'quoted text'
+		local | "$1" then then grep awk ${HOME} --verbose echo test awk sed sed then
+	"$1" echo export local cd --verbose ${HOME} $(pwd)
+		done done sed export printf 'quoted text' | export && sed
+-eu cd awk --verbose 'quoted text'
+		then | && cd echo done awk "$1" 'quoted text' $(pwd) export -eu /usr/bin
+		local x=1 echo awk export cd test printf $(pwd) then ${HOME} echo echo -eu ${HOME}
+	echo echo ${HOME} --verbose then $(pwd) "$@" done 'quoted text'
+awk "$@" echo printf export local -eu | "$@" &&
+	'quoted text' sed then --verbose 'quoted text' && done test local echo /usr/bin
+sed done "$@" -eu "$1" "$1"
+		export && then 'quoted text' export -eu cd && readonly export readonly
+		awk echo cd "$@" sed 2>/dev/null printf done -eu grep --verbose -eu
+		2>/dev/null 'quoted text' sed --verbose printf $(pwd) "$1"
+		cd awk "$1" awk export readonly "$@"
+2>/dev/null awk -eu $(pwd) ${HOME} && 2>/dev/null
+	&& then printf local ${HOME} sed "$@"
+	export /usr/bin cd awk 2>/dev/null then then "$@" x=1 /usr/bin $(pwd) printf
+		2>/dev/null readonly test local grep
+-eu x=1 "$@" "$@" test 2>/dev/null | $(pwd) x=1 'quoted text' echo "$@"
+	test ${HOME} "$1" test test x=1
+readonly printf then && printf
+		done sed x=1 printf done x=1 | | "$1" | "$1" readonly local
+	"$@" printf then test printf x=1 --verbose test export printf $(pwd) grep
+		sed && | sed readonly ${HOME} && grep test /usr/bin cd done ${HOME}
+		readonly "$1" then export grep local
+		local ${HOME} -eu /usr/bin printf && done
+x=1 test --verbose 2>/dev/null
+printf 2>/dev/null "$1" 2>/dev/null cd readonly
+/usr/bin | grep awk x=1 done cd 'quoted text' readonly
+	local local sed grep /usr/bin export grep
+	readonly done then ${HOME} export x=1 "$@" cd done ${HOME}
+	/usr/bin echo done "$1" "$@" done && --verbose | export sed
+done then x=1 cd | 'quoted text'
+2>/dev/null local x=1 'quoted text' | echo readonly --verbose awk
+grep 2>/dev/null 2>/dev/null echo && done
+		readonly && local sed readonly
+awk awk grep echo cd local
+		test "$1" | 2>/dev/null grep
+	readonly -eu test "$@" sed grep done local cd ${HOME}
+done && test test 'quoted text' x=1 echo 'quoted text' done --verbose
+		"$@" test awk test 'quoted text' readonly
+	echo awk grep "$@" -eu local printf
+	${HOME} -eu then then sed then grep printf | grep cd then local grep
+		local awk "$@" test then $(pwd) ${HOME} export export 2>/dev/null readonly
+${HOME} sed x=1 | printf x=1 test 2>/dev/null
+		grep 'quoted text' 2>/dev/null done && $(pwd) grep | awk cd
+		echo "$1" /usr/bin 2>/dev/null 'quoted text' sed "$@" test printf done awk local
+	"$@" grep printf sed done readonly
+		local "$@" 2>/dev/null awk export -eu x=1 $(pwd) test sed printf sed "$1" grep
+"$1" then --verbose -eu -eu && export test $(pwd) 'quoted text' x=1 readonly
+"$1" 'quoted text' cd -eu export --verbose done "$1" -eu then local
+		awk ${HOME} "$1" export "$1" awk
+		${HOME} awk -eu awk ${HOME} 2>/dev/null $(pwd) -eu
+2>/dev/null test x=1 /usr/bin /usr/bin | grep echo 2>/dev/null test cd awk then
+		readonly cd 'quoted text'
+	| /usr/bin then readonly
+		/usr/bin -eu readonly done "$1" printf awk done
+local && -eu done echo /usr/bin && cd /usr/bin then | /usr/bin 2>/dev/null
+		2>/dev/null | echo awk ${HOME} readonly
+		${HOME} 2>/dev/null then && echo done
+/usr/bin export ${HOME} $(pwd) -eu /usr/bin $(pwd)
+	&& readonly "$@" "$@" $(pwd) grep x=1 sed then echo export ${HOME}
+${HOME} | /usr/bin awk 'quoted text'
+		$(pwd) $(pwd) grep done "$1" "$@" export sed
+	local "$@" sed /usr/bin readonly local 'quoted text' test test
+"$@" then then /usr/bin "$1"
+	| "$1" --verbose $(pwd) grep && sed then grep
+	grep -eu export printf export awk done && && local
+	${HOME} && 2>/dev/null local then printf 'quoted text' cd "$1" then
+printf 'quoted text' /usr/bin &&
+readonly then printf -eu cd
+		awk cd /usr/bin ${HOME} done local awk grep 2>/dev/null
+		export --verbose ${HOME} /usr/bin -eu then x=1 x=1 $(pwd)
+export echo "$@" ${HOME} printf --verbose | /usr/bin export "$1"
+	readonly readonly local echo "$1" export && sed --verbose
+		printf "$@" printf | echo && "$@" x=1 "$1" -eu --verbose /usr/bin export "$1"
+		-eu "$1" export "$@" export local 'quoted text' 'quoted text' sed && /usr/bin
+	--verbose "$1" ${HOME} "$@" $(pwd) $(pwd)
+		export export echo 'quoted text' "$1" -eu "$@" done --verbose
+grep "$@" $(pwd) && awk 2>/dev/null
+		'quoted text' readonly -eu sed grep readonly
+	x=1 --verbose 'quoted text' && done local then export grep
+	printf printf $(pwd) ${HOME} export x=1 | --verbose done | -eu awk echo
+echo then ${HOME} sed export done ${HOME} $(pwd) test echo awk sed echo readonly
+		x=1 printf local x=1 &&
+		awk -eu export x=1 /usr/bin 2>/dev/null awk readonly 2>/dev/null sed printf "$@"
+	echo ${HOME} /usr/bin sed cd "$@" /usr/bin echo /usr/bin ${HOME} readonly echo
+readonly local ${HOME} export "$@" "$@" x=1 done then
+	awk awk readonly --verbose done "$@" test export then x=1 export echo
+	--verbose then done -eu "$1" | -eu then done readonly | readonly
+	"$@" export -eu cd /usr/bin readonly test "$1" printf --verbose 2>/dev/null
+		awk cd printf awk grep /usr/bin sed echo | test
+		echo printf 2>/dev/null $(pwd) "$@" printf $(pwd)
+		x=1 test /usr/bin echo export "$@" sed printf
+echo x=1 --verbose done echo then echo x=1 echo then awk
+	grep awk test local cd sed | 2>/dev/null /usr/bin readonly | x=1 |
+--verbose x=1 sed awk 'quoted text' grep done export ${HOME} /usr/bin -eu sed
+	echo grep --verbose echo
+	${HOME} export ${HOME} x=1 readonly printf $(pwd) && local x=1 printf -eu "$1"
+export local "$1" done x=1 cd --verbose
+		2>/dev/null readonly | grep /usr/bin "$@" $(pwd) cd local
+		&& test /usr/bin grep export | ${HOME} x=1 'quoted text' "$1"
+	echo awk && printf -eu && awk "$@" then export export
+		done sed awk readonly /usr/bin done readonly && --verbose
+cd done "$1" && echo | | 2>/dev/null "$1" local local printf
+	| grep "$1" && --verbose test "$@" then export
+grep 2>/dev/null && readonly grep 2>/dev/null local test $(pwd)
+export sed "$@" -eu grep then -eu /usr/bin export cd && printf "$1" echo
+	x=1 grep then "$@" | 2>/dev/null test -eu 2>/dev/null "$1" awk
+		printf /usr/bin x=1 2>/dev/null 'quoted text'
+	then cd readonly 'quoted text' "$@" $(pwd) | ${HOME}
+	$(pwd) && "$@" x=1 cd
+local | test echo && | x=1 "$@"
+	x=1 2>/dev/null 2>/dev/null
+	cd x=1 sed -eu | export cd awk
+	"$@" sed "$@" -eu awk $(pwd) local readonly echo test
+	awk test cd printf 'quoted text' 2>/dev/null local "$1" readonly "$1" readonly
+	grep export "$@" 'quoted text' export x=1
+		then --verbose 'quoted text' cd x=1 $(pwd) test local echo
+		done 2>/dev/null && cd done printf && 2>/dev/null
+		-eu sed sed test done printf 'quoted text' "$@" done readonly $(pwd)
+		sed cd | "$@" ${HOME} grep
+	/usr/bin "$1" 2>/dev/null awk 2>/dev/null awk echo test $(pwd)
+	printf done printf then 'quoted text' test |
+test ${HOME} readonly export grep
+sed ${HOME} x=1 export printf 'quoted text'
+	-eu "$@" 2>/dev/null $(pwd) | grep done export
+		sed printf /usr/bin printf
+then sed done 'quoted text' then done printf then export test "$@" /usr/bin ${HOME}
+		export echo grep awk done printf sed /usr/bin local "$@" --verbose test
+awk awk "$@" local export export
+	printf $(pwd) sed --verbose "$@"
+	then 2>/dev/null ${HOME} awk "$1" export test export cd 'quoted text'
+	2>/dev/null 2>/dev/null $(pwd) export then | cd sed
+'quoted text' && "$@" awk cd && --verbose then local 'quoted text' "$@"
+		test awk /usr/bin 'quoted text'
+		readonly local "$1" && x=1 --verbose done export 'quoted text' 2>/dev/null
+	$(pwd) cd grep export grep "$1" cd "$1" $(pwd)
+		echo 'quoted text' readonly && --verbose
+/usr/bin echo export export
+| 2>/dev/null grep printf grep "$@" --verbose
+	then local then test awk printf $(pwd) echo 2>/dev/null
+	done test ${HOME} done cd ${HOME} $(pwd)
+$(pwd) readonly echo $(pwd) | ${HOME} $(pwd) done x=1 ${HOME}
+		| -eu then sed local | x=1 -eu then "$@" 'quoted text'
+		'quoted text' /usr/bin cd -eu then test | && export test /usr/bin
+		done export grep cd printf -eu sed done $(pwd) echo --verbose
+		${HOME} | $(pwd) x=1 && x=1 x=1 done
+export 2>/dev/null --verbose "$@" x=1 "$1" cd $(pwd) /usr/bin
+		echo sed -eu done "$1" 'quoted text' grep awk
+		local test ${HOME} 2>/dev/null -eu cd 'quoted text'
+		/usr/bin then export -eu /usr/bin echo
+		readonly $(pwd) "$@" ${HOME} export
+	$(pwd) readonly done | then "$1" 2>/dev/null x=1 export grep $(pwd) --verbose
+		grep "$1" readonly --verbose -eu readonly
+		readonly -eu readonly cd sed && -eu -eu $(pwd) cd 'quoted text'
+		"$1" done echo 'quoted text' local /usr/bin then && -eu awk
+/usr/bin done "$@" then 'quoted text'
+		"$@" readonly && readonly --verbose 2>/dev/null cd test printf "$1" 2>/dev/null
+"$@" 2>/dev/null -eu export echo $(pwd)
+	echo --verbose "$1" then -eu test
+test echo sed cd test | printf then 2>/dev/null
+	export local echo export -eu grep x=1 sed sed | x=1 local sed "$@"
+	$(pwd) echo $(pwd) grep local
+	readonly && $(pwd) done --verbose
+$(pwd) --verbose done -eu 'quoted text' -eu readonly -eu ${HOME}
+	grep local sed echo readonly -eu ${HOME} sed -eu | sed ${HOME}
+&& "$1" readonly $(pwd) 2>/dev/null -eu $(pwd) readonly 2>/dev/null
+	| $(pwd) "$@" 2>/dev/null
+		sed cd /usr/bin --verbose "$@" local --verbose sed "$@" "$@" "$1"
+${HOME} sed done echo then readonly done test sed &&
+test ${HOME} 'quoted text' then --verbose 'quoted text'
+	export export done 'quoted text' sed | 2>/dev/null "$1" /usr/bin sed
+	&& then sed /usr/bin -eu /usr/bin echo grep printf
+		-eu awk --verbose && "$1" 2>/dev/null
+	"$1" cd && x=1 && --verbose printf --verbose /usr/bin
+printf export grep grep --verbose
+	export local local "$@" grep cd awk
+local cd export test | && done "$1"
+	'quoted text' export then 'quoted text' -eu ${HOME} | --verbose | sed
+export done 'quoted text' local "$1" "$@" cd x=1 | sed
+	grep /usr/bin done 2>/dev/null
+	| grep awk 'quoted text' test local
+-eu export test /usr/bin done
+	| "$1" sed && $(pwd) grep | echo local export test "$@" ${HOME} 'quoted text'
+	/usr/bin echo done /usr/bin 'quoted text' local x=1
+		'quoted text' local test
+grep "$1" ${HOME} | x=1 "$@" sed "$@"
+	| grep readonly | printf ${HOME} 'quoted text'
+	&& "$@" && /usr/bin export sed export
+	grep cd test export && awk cd cd $(pwd)
+grep /usr/bin printf 2>/dev/null cd "$@" && sed export /usr/bin readonly $(pwd)
+printf 2>/dev/null "$@" && $(pwd)
+	"$@" export grep sed x=1 awk x=1 ${HOME} -eu -eu "$@" | --verbose --verbose
+		/usr/bin test then 'quoted text' 'quoted text' $(pwd)
+		x=1 sed -eu echo "$1" "$@" sed | cd x=1 ${HOME} done -eu
+	test "$@" "$@" 2>/dev/null test && local /usr/bin | cd local
+	"$@" awk --verbose test 2>/dev/null 'quoted text' "$@" awk sed x=1 x=1
+		grep echo -eu local 2>/dev/null sed 2>/dev/null printf grep printf grep
+done test then "$@" $(pwd) $(pwd) grep 2>/dev/null
+		export test awk -eu "$@" 2>/dev/null "$1" x=1 local echo
+then "$1" | "$@" test echo 'quoted text'
+cd cd && 2>/dev/null sed local test x=1 --verbose then 2>/dev/null
+		'quoted text' printf local readonly
+	-eu /usr/bin printf cd echo
+		/usr/bin test readonly test 2>/dev/null
+done grep | && "$1" local export sed 'quoted text'
+x=1 "$1" 2>/dev/null 'quoted text' awk $(pwd) done done -eu | readonly
+sed | && ${HOME} x=1 "$1"
+awk && printf "$1" x=1 -eu grep readonly | cd -eu readonly sed
+local | /usr/bin grep $(pwd)
+	echo | local x=1 /usr/bin export grep readonly
+cd ${HOME} -eu -eu "$1" echo /usr/bin "$@"
+"$@" /usr/bin test cd test
+		readonly ${HOME} "$1" readonly readonly
+		&& x=1 $(pwd) "$@" local export export "$@" local echo "$1" 2>/dev/null
+	x=1 | --verbose grep ${HOME} | 2>/dev/null local grep done
+	cd /usr/bin echo awk --verbose
+		| && x=1 -eu sed x=1 $(pwd) -eu | -eu 2>/dev/null "$1" readonly
+	/usr/bin && "$1" cd then "$@" grep printf
+	--verbose "$@" 'quoted text'
+		${HOME} "$@" then /usr/bin local /usr/bin printf "$@" sed grep
+	$(pwd) $(pwd) ${HOME} "$@" | --verbose $(pwd) | ${HOME} /usr/bin x=1
+"$1" $(pwd) done | && echo /usr/bin cd && done local $(pwd)
+		| 'quoted text' readonly
+		local x=1 'quoted text' printf --verbose
+	export $(pwd) x=1 && echo --verbose /usr/bin x=1 "$@" cd ${HOME} sed "$@" printf
+	sed 2>/dev/null | test sed echo 2>/dev/null --verbose |
+	"$@" printf x=1 ${HOME} | readonly readonly "$@" echo && sed awk 2>/dev/null
+-eu done ${HOME} cd x=1 local "$@" "$@" echo /usr/bin 'quoted text'
+	export /usr/bin && /usr/bin -eu then
+$(pwd) 2>/dev/null ${HOME} readonly grep cd x=1 echo then echo
+		echo test "$@" printf test cd && "$1" x=1 sed && awk readonly
+/usr/bin | "$@" awk 2>/dev/null 'quoted text' cd readonly
+sed /usr/bin grep 'quoted text' 2>/dev/null --verbose --verbose --verbose
+	-eu awk "$@" done test echo x=1
+		-eu ${HOME} echo /usr/bin $(pwd) && sed sed "$@" printf $(pwd)
+		| printf sed x=1 grep printf
+export 'quoted text' --verbose "$1" ${HOME} "$@" -eu ${HOME} local test $(pwd) export
+		done echo | "$1" 2>/dev/null done 'quoted text'
+"$1" cd readonly x=1 ${HOME}
+		echo grep grep 'quoted text' printf 'quoted text'
+		echo done | /usr/bin test printf -eu awk 2>/dev/null "$@" readonly
+test && | test 'quoted text' | "$@" "$1"
+		2>/dev/null ${HOME} printf x=1 x=1 then then /usr/bin x=1 local awk
+		readonly readonly x=1 'quoted text' x=1 export
+		2>/dev/null 2>/dev/null /usr/bin then -eu printf readonly
+	sed $(pwd) $(pwd) local echo -eu -eu done /usr/bin $(pwd) grep | readonly
+		readonly local local "$1" then
+		| sed ${HOME} /usr/bin | && "$1" "$@" done readonly readonly && && x=1
+		${HOME} "$@" grep ${HOME} "$1" "$1"
+then then | printf awk export awk grep then
+${HOME} 'quoted text' local test ${HOME}
+readonly x=1 && $(pwd) -eu "$1" printf
+		/usr/bin test "$@" /usr/bin done --verbose
+		"$1" 2>/dev/null readonly
+	$(pwd) awk awk sed $(pwd) done
+	$(pwd) $(pwd) export test cd "$1" export export /usr/bin
+--verbose $(pwd) x=1 x=1 done "$@" ${HOME} /usr/bin readonly 'quoted text'
+	readonly 'quoted text' grep | grep test grep $(pwd) test cd then test printf
+	awk echo test printf test
+		export local && x=1 printf test $(pwd) ${HOME} /usr/bin
+	sed then sed cd done && /usr/bin awk cd | sed /usr/bin | x=1
+		&& echo sed local cd --verbose
+| --verbose cd ${HOME} done x=1 && "$1" export
+		done awk ${HOME} | $(pwd) 2>/dev/null ${HOME} | $(pwd) grep
+	$(pwd) printf 'quoted text'
+	--verbose | 2>/dev/null echo --verbose awk --verbose "$@" grep && /usr/bin
+	echo -eu then 2>/dev/null printf
+| test /usr/bin then ${HOME} grep then printf done sed echo awk
+export | readonly 'quoted text'
+		awk test $(pwd) cd 'quoted text' | cd echo local done printf
+&& export grep then readonly awk && | export --verbose | "$@"
+		awk | export echo test ${HOME}
+	2>/dev/null cd local then grep /usr/bin 'quoted text' | awk printf |
+$(pwd) -eu 'quoted text' done /usr/bin awk done echo $(pwd) grep local test
+		echo -eu echo cd echo readonly | done /usr/bin awk sed 'quoted text' echo
+	${HOME} && 2>/dev/null -eu test grep test done /usr/bin $(pwd) 2>/dev/null
+grep echo x=1 grep readonly
+	/usr/bin awk printf && sed 2>/dev/null awk -eu grep && cd
+/usr/bin $(pwd) && ${HOME} awk "$@" 2>/dev/null
+		${HOME} sed /usr/bin cd ${HOME} -eu 2>/dev/null
+	/usr/bin cd --verbose 2>/dev/null
+	$(pwd) x=1 local "$@" grep sed cd -eu printf x=1
+		sed $(pwd) | cd 2>/dev/null sed grep echo export && -eu 'quoted text' /usr/bin
+		grep /usr/bin test -eu ${HOME} 'quoted text' --verbose export |
+'quoted text' then "$1" awk echo cd && then "$1" -eu ${HOME} test cd
+readonly test /usr/bin /usr/bin
+	| local 'quoted text' printf --verbose
+awk 'quoted text' /usr/bin --verbose awk x=1 sed
+	x=1 done ${HOME} "$1" 2>/dev/null
+	&& -eu --verbose awk readonly x=1 cd then echo done printf "$1"
+&& x=1 local x=1 /usr/bin ${HOME} cd cd /usr/bin
+then test test x=1 cd then "$@" --verbose echo local readonly
+		"$1" /usr/bin awk then printf test 2>/dev/null ${HOME} 'quoted text'
+		| /usr/bin /usr/bin done ${HOME} x=1 local
+-eu cd awk sed done /usr/bin printf printf sed
+	${HOME} local done readonly 2>/dev/null | /usr/bin printf export "$1" ${HOME}
+		-eu echo echo ${HOME} local -eu /usr/bin -eu
+test /usr/bin grep x=1 readonly $(pwd) sed $(pwd) "$1"
+		--verbose printf 2>/dev/null then $(pwd) --verbose ${HOME} /usr/bin
+sed grep readonly awk test 'quoted text' 2>/dev/null "$@" $(pwd)
+'quoted text' /usr/bin "$@" "$1" then local printf
+	2>/dev/null && done -eu awk test ${HOME} --verbose
+then sed ${HOME} local then
+	sed printf echo ${HOME} test readonly awk ${HOME} --verbose cd test local
+	"$@" 'quoted text' "$1" x=1 printf 2>/dev/null
+	grep local awk grep | awk | then done
+--verbose grep -eu $(pwd) --verbose
+		test cd awk test /usr/bin -eu then test -eu local readonly
+		"$@" ${HOME} x=1 awk grep sed readonly 'quoted text' --verbose $(pwd) "$1" printf
+local export /usr/bin
+${HOME} "$@" && x=1 -eu test
+test 'quoted text' "$1" && echo test $(pwd)
+	printf export awk "$@" printf ${HOME} && && x=1 "$@" 2>/dev/null $(pwd)
+		x=1 cd cd /usr/bin printf sed ${HOME} /usr/bin 2>/dev/null
+		| grep && done 2>/dev/null 'quoted text'
+		export printf -eu && x=1 | x=1
+--verbose x=1 ${HOME} "$@" cd local 2>/dev/null readonly local
+		x=1 awk $(pwd) awk grep /usr/bin grep local local ${HOME} && ${HOME} awk --verbose
+	sed awk 2>/dev/null echo "$@" -eu done -eu && "$1" grep
+	'quoted text' 'quoted text'
+done local test "$1" readonly /usr/bin grep -eu ${HOME}
+		/usr/bin $(pwd) local /usr/bin "$1" -eu export sed /usr/bin 2>/dev/null
+then local awk 'quoted text'
+/usr/bin test 2>/dev/null
+		| local done "$@" x=1 readonly && 'quoted text' /usr/bin
+		local /usr/bin 'quoted text'
+	2>/dev/null export awk 'quoted text'
+		awk cd sed printf echo test 'quoted text' local | "$@" export ${HOME} cd -eu grep
+	local cd done $(pwd) $(pwd) 2>/dev/null sed $(pwd)
+		"$@" grep -eu "$@" --verbose
+		done "$@" "$1" $(pwd) local cd done
+	sed "$1" | cd -eu awk readonly then ${HOME} 'quoted text' ${HOME} 'quoted text'
+-eu && $(pwd) $(pwd) then "$@" export cd export /usr/bin echo ${HOME} 2>/dev/null
+awk readonly printf grep done readonly $(pwd) ${HOME} printf ${HOME} local $(pwd)
+	/usr/bin x=1 && cd ${HOME} sed local echo --verbose done printf
+		2>/dev/null -eu awk 'quoted text' sed awk 'quoted text' $(pwd)
+grep | awk export cd grep
+	"$@" /usr/bin | 2>/dev/null echo done ${HOME} 'quoted text'
+	printf $(pwd) 'quoted text' ${HOME} test $(pwd) done $(pwd) echo
+		then x=1 && 2>/dev/null 'quoted text'
+	/usr/bin $(pwd) 'quoted text' --verbose awk 'quoted text' "$1"
+	awk grep /usr/bin | "$1" awk $(pwd) $(pwd) $(pwd) local
+		test local local && | echo x=1 local ${HOME} /usr/bin
+-eu local | then /usr/bin /usr/bin
+		/usr/bin local && && then awk done $(pwd) printf then
+printf -eu $(pwd) sed
+		echo grep readonly -eu cd echo local ${HOME} --verbose
+	test --verbose sed awk ${HOME} 2>/dev/null test
+		&& cd $(pwd) | | -eu 2>/dev/null then && -eu 2>/dev/null awk 'quoted text'
+readonly local awk export then then x=1 "$@" && ${HOME} /usr/bin
+	sed && then readonly export -eu then export echo
+		/usr/bin local export 'quoted text' sed "$@"
+		$(pwd) readonly 'quoted text' awk ${HOME} && /usr/bin readonly awk
+		-eu 2>/dev/null -eu done ${HOME} /usr/bin echo ${HOME} &&
+		-eu done test then sed grep done
+	local test echo export done cd | done
+	cd "$@" echo readonly export sed readonly
+	'quoted text' "$1" sed 'quoted text'
+	echo ${HOME} then printf $(pwd) awk x=1 echo x=1 done
+		sed x=1 awk $(pwd) awk --verbose then grep awk readonly $(pwd)
+		-eu "$@" then $(pwd) echo 'quoted text' x=1
+/usr/bin cd "$@" awk grep 'quoted text' 'quoted text' grep /usr/bin 2>/dev/null
+		readonly 'quoted text'
+		then -eu awk ${HOME} printf
+		$(pwd) done awk "$@" 'quoted text' test then
+| then test grep printf /usr/bin printf && 2>/dev/null $(pwd) --verbose ${HOME}
+| printf 'quoted text' grep | && sed done /usr/bin
+${HOME} "$1" readonly export local x=1 -eu then test x=1 sed grep "$@"
+		done export sed awk $(pwd) export /usr/bin && --verbose
+		2>/dev/null | ${HOME} then | -eu export echo | then 2>/dev/null
+-eu echo | local sed printf ${HOME}
+	${HOME} "$1" /usr/bin | --verbose printf
+	2>/dev/null awk grep printf sed awk
+	then 2>/dev/null printf
+/usr/bin $(pwd) | x=1 export then 'quoted text'
+	printf /usr/bin sed && readonly done /usr/bin "$@" 'quoted text'
+	sed awk -eu done && export printf | readonly cd echo -eu
+/usr/bin cd x=1 ${HOME} x=1 awk --verbose awk x=1
+	export export | 'quoted text' sed | cd sed "$1" && ${HOME} "$1" ${HOME} ${HOME}
+done x=1 readonly "$1" printf export local
+cd 'quoted text' test awk && cd $(pwd) done echo echo -eu done --verbose readonly
+	${HOME} /usr/bin done export
+	'quoted text' sed -eu "$@"
+	-eu 'quoted text' "$@" && 'quoted text' cd local
+		/usr/bin echo -eu $(pwd) 'quoted text' $(pwd) then sed 'quoted text'
+awk /usr/bin ${HOME} awk ${HOME} ${HOME} readonly
+	sed "$1" echo awk echo sed echo "$1" | then printf readonly --verbose $(pwd)
+		"$@" | cd cd "$1" then "$@" --verbose 2>/dev/null awk local | awk 'quoted text'
+		-eu && ${HOME} awk "$1"
+&& ${HOME} grep readonly local 'quoted text' awk local export ${HOME} printf 2>/dev/null
+sed export awk sed "$@" grep && && | test 'quoted text' && awk cd ${HOME}
+		cd /usr/bin readonly | done --verbose | local "$@" export "$@"
+	cd --verbose echo echo 2>/dev/null && /usr/bin sed "$@" x=1 printf test
+	awk "$1" $(pwd) "$1" 2>/dev/null
+&& done done then export -eu | && test export "$1" x=1 readonly | echo
+export readonly readonly sed x=1 x=1 "$@" printf 2>/dev/null done
+		test --verbose x=1 ${HOME} cd "$@" -eu sed && $(pwd)
+cd && sed /usr/bin done "$1" cd test &&
+		| local local sed echo 2>/dev/null sed --verbose
+		'quoted text' printf 2>/dev/null -eu --verbose
+	| echo ${HOME} -eu 2>/dev/null export sed 2>/dev/null
+		-eu -eu | test echo cd awk printf 'quoted text'
+	then | done sed readonly /usr/bin export 2>/dev/null export echo then echo cd test
+cd done -eu | then | echo export --verbose 2>/dev/null ${HOME} readonly
+&& -eu && 2>/dev/null $(pwd) --verbose grep readonly && sed "$1" x=1 sed done
+	--verbose ${HOME} -eu "$@"
+		"$1" --verbose -eu ${HOME} echo
+-eu printf $(pwd) ${HOME} x=1 'quoted text' awk test /usr/bin ${HOME}
+	readonly printf readonly | 'quoted text'
+	2>/dev/null echo local local
+	--verbose --verbose cd sed /usr/bin --verbose
+	/usr/bin 'quoted text' 'quoted text' ${HOME} echo test
+		printf -eu "$1" --verbose done
+	"$@" -eu x=1 readonly "$1" export
+		2>/dev/null done "$@" cd export
+| x=1 grep test readonly test 2>/dev/null
+grep && test cd readonly
+	"$1" printf cd 2>/dev/null "$@"
+&& export printf "$@" && /usr/bin done local cd echo x=1 sed
+done cd "$1" done readonly
+	then ${HOME} export 'quoted text'
+		--verbose x=1 then grep ${HOME} /usr/bin "$@" $(pwd) done echo then cd 2>/dev/null
+&& awk && done then "$@" --verbose
+	2>/dev/null $(pwd) /usr/bin
+		local export && $(pwd) local -eu then readonly
+	awk done done done done grep awk then export "$@" done cd -eu
+	"$@" grep echo 'quoted text' -eu 2>/dev/null then export printf
+/usr/bin awk | awk "$@" echo test readonly
+	'quoted text' /usr/bin sed "$@" && $(pwd) echo
+then echo -eu ${HOME} --verbose echo | awk "$@" readonly
+	x=1 "$1" test && done -eu ${HOME}
+		x=1 echo x=1 && then && --verbose -eu test && then 2>/dev/null
+	export 2>/dev/null x=1 done echo done printf printf printf local
+		&& grep printf "$@" ${HOME}
+	2>/dev/null export -eu then 2>/dev/null 2>/dev/null printf "$1"
+		"$1" && 2>/dev/null local
+	echo x=1 printf $(pwd) cd export readonly cd local x=1
+awk local && readonly 'quoted text' /usr/bin /usr/bin ${HOME} ${HOME} awk then
+export 'quoted text' /usr/bin test echo done "$@"
+	--verbose "$1" done done
+	printf -eu $(pwd) | | then grep echo then | && then --verbose echo local readonly
+done ${HOME} | --verbose grep
+test echo "$@" test -eu && cd | | /usr/bin ${HOME} echo
+	--verbose awk echo -eu ${HOME} readonly readonly
+	${HOME} -eu "$1" --verbose printf readonly x=1
+	${HOME} x=1 "$1" ${HOME}
+		$(pwd) grep "$1" 2>/dev/null ${HOME}
+| cd ${HOME} 2>/dev/null sed cd "$1"
+		&& readonly --verbose -eu ${HOME} test
+		--verbose 2>/dev/null --verbose 'quoted text'
+	'quoted text' printf 'quoted text' then "$@"
+		grep then done 2>/dev/null sed readonly 'quoted text'
+&& then echo sed grep done echo "$1" printf && local awk
+	--verbose --verbose x=1 "$@"
+	readonly "$1" echo awk then readonly
+		export echo grep cd /usr/bin "$@" awk $(pwd) "$1"
+		sed ${HOME} test then x=1
+	awk 'quoted text' 'quoted text'
+	cd "$1" 'quoted text' awk sed sed echo grep
+local done x=1 "$@" test cd export 'quoted text' export "$@" "$1"
+	awk 2>/dev/null /usr/bin "$@" grep x=1 readonly sed awk x=1 "$@" readonly
+	"$@" done echo test echo echo sed x=1 readonly 2>/dev/null ${HOME} ${HOME}
+		test export readonly && $(pwd) echo "$@" test echo -eu 'quoted text' awk
+	x=1 awk "$@" done readonly local readonly echo local
+		${HOME} echo done 2>/dev/null local readonly
+grep | cd export 2>/dev/null -eu 'quoted text' 2>/dev/null "$1" echo awk awk ${HOME}
+local | && && awk sed then readonly done sed sed "$1" export | then
+"$1" && export printf ${HOME} sed grep "$1"
+		export local grep | local | awk $(pwd)
+		| && export done then grep "$1" "$@" then readonly x=1
+	then cd done cd 'quoted text' --verbose
+		done cd sed awk done "$@" "$@" | sed /usr/bin x=1 sed sed
+		&& && --verbose && test export then awk
+&& | test --verbose 2>/dev/null echo local
+export -eu "$@" local readonly export $(pwd) grep local export awk sed
+		-eu $(pwd) grep -eu ${HOME} test $(pwd) 'quoted text' then /usr/bin -eu
+readonly $(pwd) readonly
+then && sed 'quoted text' echo local $(pwd)
+	printf --verbose | $(pwd) 2>/dev/null x=1
+		$(pwd) grep test awk ${HOME} awk --verbose
+--verbose grep awk | echo 2>/dev/null done test export ${HOME} done /usr/bin
+	readonly readonly test sed local done --verbose sed export 'quoted text' export
+&& 'quoted text' -eu echo grep "$1" grep grep sed --verbose "$1" -eu
+	2>/dev/null "$@" --verbose x=1 then printf echo /usr/bin grep 'quoted text'
+&& local export echo echo 'quoted text'
+		done sed ${HOME} /usr/bin /usr/bin
+		| --verbose -eu awk "$1" grep && cd --verbose export cd then test
+	"$1" printf test grep test x=1 2>/dev/null "$1" awk 'quoted text' --verbose
+		$(pwd) readonly cd printf readonly
+	readonly echo ${HOME} local sed ${HOME} | | "$@" readonly
+	&& "$@" printf 2>/dev/null | 'quoted text'
+sed | then local readonly --verbose sed -eu --verbose awk echo ${HOME}
+		| echo "$@" sed echo /usr/bin 'quoted text' $(pwd) && -eu local export
+		--verbose cd echo --verbose
+	--verbose "$1" x=1 'quoted text' "$1" echo grep | ${HOME} -eu
+"$@" echo "$@" /usr/bin "$@" /usr/bin export done then "$1" -eu
+	-eu x=1 test ${HOME} test "$@" /usr/bin | awk
+		'quoted text' "$1" && && echo
+	"$@" "$1" -eu $(pwd) 'quoted text' --verbose local
+export /usr/bin && /usr/bin then awk x=1 x=1 $(pwd) export "$@" | test "$@"
+		&& x=1 x=1 "$@" --verbose -eu 'quoted text' ${HOME} "$@" printf | grep
+awk printf "$@" -eu "$1" && /usr/bin -eu awk "$1"
+		done cd done -eu 'quoted text' then | cd --verbose
+		export ${HOME} readonly "$1" test "$1" 2>/dev/null /usr/bin
+	cd cd -eu -eu export $(pwd) then x=1 'quoted text' && sed --verbose 'quoted text'
+		'quoted text' ${HOME} grep ${HOME} export ${HOME}
+		'quoted text' test cd x=1 cd "$1" 2>/dev/null |
+export "$1" | readonly 2>/dev/null printf done "$@" "$@" -eu sed echo "$@"
+	| "$@" then sed $(pwd) 'quoted text' 2>/dev/null ${HOME} $(pwd) readonly
+'quoted text' then "$1" test printf
+	"$1" /usr/bin /usr/bin && export $(pwd) -eu 'quoted text' $(pwd)
+$(pwd) x=1 echo | && --verbose awk local
+	--verbose "$1" 2>/dev/null
+		--verbose echo 2>/dev/null | awk test echo export -eu test
+x=1 x=1 awk readonly && "$1" "$@" export "$@" done awk awk && $(pwd) then
+&& --verbose x=1 'quoted text' local "$@" 'quoted text' --verbose x=1
+		test printf echo --verbose sed echo done 'quoted text'
+		'quoted text' awk readonly 2>/dev/null test "$@" done sed
+#include c79.sh
+	| export grep printf local then done sed
+cd ${HOME} && local then 'quoted text' "$1" ${HOME} -eu
+	-eu local then grep "$@" && awk
+		"$@" x=1 then ${HOME} cd test 2>/dev/null printf x=1 awk | "$1"
+		readonly 'quoted text' readonly grep awk local
+&& done printf 2>/dev/null local ${HOME} cd x=1 done
+		local "$1" grep echo 2>/dev/null
+		"$1" readonly $(pwd) export && awk printf grep $(pwd)
+		awk sed | awk | then 'quoted text' echo
+	2>/dev/null x=1 grep cd "$@" echo then 'quoted text' printf
+	x=1 echo && echo awk --verbose echo local test 2>/dev/null && 2>/dev/null then
+readonly grep "$1" ${HOME} done $(pwd)
+	done awk done "$@" ${HOME} 2>/dev/null
+/usr/bin 2>/dev/null x=1 /usr/bin
+2>/dev/null grep | local local grep cd && test printf "$@" cd
+&& sed | ${HOME} "$@" "$@" sed done --verbose export && printf
+printf printf export readonly
+	| 'quoted text' printf awk && export | done ${HOME}
+	awk printf x=1 sed cd printf test | "$1" | "$1" done
+		$(pwd) test local awk
+		sed local awk local grep awk | awk cd | grep cd grep cd sed readonly
+then cd cd "$@" -eu then then 2>/dev/null
+'quoted text' "$@" "$1" -eu "$@" cd awk echo -eu done /usr/bin readonly
+sed -eu "$1" done /usr/bin --verbose /usr/bin export done --verbose $(pwd)
+test && "$@" readonly awk
+		readonly "$@" readonly --verbose -eu printf --verbose echo 'quoted text' /usr/bin
+		--verbose /usr/bin grep 'quoted text' $(pwd) echo
+"$@" 'quoted text' -eu cd 'quoted text'
+	printf cd grep 'quoted text' grep 'quoted text' then then /usr/bin "$1" 'quoted text'
+printf cd export -eu local --verbose
+	2>/dev/null cd sed grep done local 'quoted text' test local readonly awk
+	'quoted text' grep $(pwd) | $(pwd) -eu "$@" printf cd local 'quoted text'
+		cd 'quoted text' 2>/dev/null 'quoted text' "$1"
+done printf "$1" -eu then ${HOME}
+	"$@" -eu test awk then readonly echo
+	| local ${HOME} local printf test 'quoted text' test x=1 test ${HOME} awk --verbose
+		export "$@" test then then && done done test printf $(pwd) readonly
+		&& -eu sed test "$@" -eu "$1" x=1 sed local $(pwd) cd cd --verbose
+test && then printf sed printf
+	-eu ${HOME} sed export done /usr/bin printf
+		"$@" sed printf /usr/bin export && sed /usr/bin --verbose "$@" ${HOME} -eu $(pwd)
+	| ${HOME} && ${HOME} --verbose ${HOME} test 2>/dev/null test sed echo
+	test $(pwd) readonly x=1 echo 'quoted text' local "$@" test 2>/dev/null x=1 $(pwd)
+		--verbose echo test | /usr/bin done 2>/dev/null && /usr/bin
+printf "$@" local echo echo grep printf then readonly echo
+	awk -eu awk "$1" | test printf 'quoted text' grep && "$1"
+		&& && printf echo done | awk | test --verbose ${HOME}
+		local local ${HOME} local printf sed cd echo export printf grep
+	${HOME} /usr/bin ${HOME} awk 2>/dev/null "$@" && /usr/bin sed then
+		grep local | readonly "$@" readonly done -eu echo | done export done --verbose
+	2>/dev/null 2>/dev/null export 2>/dev/null cd ${HOME} done echo ${HOME}
+--verbose readonly 2>/dev/null
+awk local ${HOME} x=1 x=1 --verbose
+		echo export export sed
+	cd done awk local "$@" grep test 'quoted text' && "$@" sed
+done && ${HOME} then --verbose cd cd "$@" 'quoted text'
+		--verbose x=1 export 'quoted text' /usr/bin then x=1 readonly $(pwd)
+	sed echo sed echo 'quoted text' "$1" echo sed
+	"$@" then --verbose --verbose test
+	export /usr/bin --verbose "$1" done
+done $(pwd) --verbose grep grep --verbose awk $(pwd) x=1
+		"$@" sed x=1 awk cd --verbose grep sed x=1
+		printf then readonly local
+		"$1" "$1" printf 2>/dev/null x=1 --verbose awk "$1" then export 'quoted text'
+		2>/dev/null --verbose 2>/dev/null -eu export && sed echo | awk
+	grep --verbose -eu sed | cd $(pwd) done then
+done printf sed local export echo
+	test done 2>/dev/null $(pwd) sed grep $(pwd) done
+		test echo sed "$@" 2>/dev/null "$1" readonly awk 2>/dev/null
+		--verbose awk x=1 x=1 sed 2>/dev/null ${HOME}
+	readonly awk grep 2>/dev/null sed "$@" "$1" then /usr/bin "$@" sed
+		${HOME} ${HOME} "$1" "$1" -eu export "$1" -eu -eu -eu 2>/dev/null "$@"
+	"$@" awk grep done "$1" && "$@" grep 'quoted text' 'quoted text'
+	'quoted text' ${HOME} x=1 awk "$1" "$1" 'quoted text'
+	-eu | grep grep /usr/bin /usr/bin --verbose readonly then
+		/usr/bin then sed printf 2>/dev/null cd -eu --verbose then local --verbose sed
+		x=1 awk test "$@" readonly then "$@" 'quoted text' then && | 'quoted text'
+		2>/dev/null "$1" 2>/dev/null
+sed "$@" ${HOME} local printf
+	"$@" 2>/dev/null -eu ${HOME} | 2>/dev/null local local printf
+	/usr/bin && sed | then test 2>/dev/null local export done x=1 grep $(pwd) test
+	x=1 && sed sed then 2>/dev/null | awk then awk cd
+		2>/dev/null then export echo done --verbose sed then /usr/bin ${HOME}
+readonly /usr/bin grep done then -eu "$1" readonly ${HOME}
+	"$1" x=1 readonly --verbose "$@" ${HOME} sed local sed /usr/bin x=1
+		grep | local "$1" then "$1" printf --verbose "$@" "$1" "$@"
+	'quoted text' && echo -eu -eu $(pwd) local
+	| echo then --verbose awk | "$@" x=1 --verbose then /usr/bin -eu awk cd | cd grep
+	export printf printf $(pwd) && done done -eu 2>/dev/null
+'quoted text' test 2>/dev/null ${HOME}
+done | --verbose awk ${HOME} then test -eu $(pwd) 2>/dev/null
+		'quoted text' 2>/dev/null
+		sed "$@" "$1" local --verbose cd --verbose $(pwd) then test 'quoted text' 'quoted text'
+		local "$@" 'quoted text' x=1 "$@" "$1" "$1" cd
+		$(pwd) x=1 /usr/bin "$@" /usr/bin awk export printf ${HOME} 'quoted text'
+		x=1 cd -eu then readonly done then test && cd test -eu x=1 | 2>/dev/null
+		"$1" x=1 "$1" | ${HOME} printf sed "$@" /usr/bin grep
+2>/dev/null then 'quoted text' sed /usr/bin
+	printf ${HOME} 2>/dev/null grep awk test done test test done
+readonly | grep $(pwd) | "$1" --verbose readonly export grep | "$@" ${HOME}
+	x=1 export $(pwd) -eu | awk local local $(pwd) | readonly 'quoted text' x=1
+		"$1" ${HOME} "$@" --verbose test cd /usr/bin
+		echo local echo grep && export | $(pwd)
+	/usr/bin sed | x=1 "$1" test
+sed then cd x=1 && local | sed "$@" 2>/dev/null 2>/dev/null 2>/dev/null sed readonly
+2>/dev/null "$@" grep done
+| local /usr/bin printf | awk grep
+		cd | $(pwd) /usr/bin -eu test $(pwd) grep printf
+grep awk then test done readonly readonly echo readonly printf awk export local
+readonly printf export cd 2>/dev/null --verbose readonly
+	done test ${HOME} 'quoted text' -eu then done then test "$1" echo cd
+		printf 'quoted text' grep awk | then grep export printf sed local echo sed /usr/bin
+'quoted text' cd && ${HOME} /usr/bin then cd awk export awk
+	'quoted text' ${HOME} done readonly x=1 --verbose | local --verbose
+	then | $(pwd) x=1 "$@" cd done 'quoted text'
+	awk export /usr/bin $(pwd) test test "$1"
+	cd 2>/dev/null local echo cd x=1 'quoted text' export --verbose printf grep
+		printf 2>/dev/null cd cd "$@" "$@"
+'quoted text' -eu 2>/dev/null $(pwd) /usr/bin local printf local
+	local && && 2>/dev/null done && ${HOME} ${HOME} grep
+done done then "$@" -eu 2>/dev/null | 'quoted text'
+	cd export echo echo cd cd --verbose "$1" export | then 2>/dev/null
+test ${HOME} echo test ${HOME} cd grep printf -eu && "$1" awk x=1 grep grep "$@"
+${HOME} readonly "$@" printf "$1"
+	/usr/bin awk test "$@" | local echo 2>/dev/null printf $(pwd) ${HOME} then sed
+sed -eu done 2>/dev/null done 2>/dev/null local readonly
+&& cd sed printf export "$@" then -eu "$@" sed echo | awk grep /usr/bin
+	test echo 'quoted text' then 'quoted text'
+printf export grep 'quoted text' -eu cd sed -eu
+	test printf 'quoted text' 'quoted text' then readonly sed local && "$1" sed
+		$(pwd) echo echo cd x=1 printf printf awk echo awk printf ${HOME} ${HOME} printf
+	grep readonly done && "$@" cd printf local sed sed export readonly then 'quoted text'
+	echo test readonly x=1 $(pwd) x=1 "$1" test printf echo then readonly printf
+local printf | done then done --verbose readonly 'quoted text' "$1"
+		${HOME} awk "$@" export -eu grep ${HOME} test 'quoted text'
+	'quoted text' export export printf
+	-eu -eu test | export /usr/bin grep 'quoted text' ${HOME} grep local grep
+| awk test /usr/bin && "$@" done grep | done test cd sed "$@"
+local ${HOME} && /usr/bin 2>/dev/null
+	$(pwd) echo local 'quoted text' grep echo export && echo 'quoted text'
+	$(pwd) readonly done && cd 2>/dev/null
+then /usr/bin $(pwd) --verbose 'quoted text' && local then && /usr/bin then
+		'quoted text' 'quoted text' printf then sed
+test done sed export 'quoted text' /usr/bin readonly done 'quoted text'
+		2>/dev/null printf && 'quoted text' 2>/dev/null x=1 sed "$@"
+-eu --verbose x=1 $(pwd) | $(pwd) local ${HOME} x=1 "$1" export
+		"$@" readonly 2>/dev/null
+	readonly 2>/dev/null awk ${HOME} "$1" export cd printf "$@" export $(pwd)
+		local echo 2>/dev/null then awk
+	grep x=1 --verbose -eu readonly | cd echo local readonly echo then export "$1"
+		done cd 2>/dev/null cd && $(pwd) grep sed then then | grep /usr/bin
+	"$@" && "$1" && local then readonly printf "$1" "$@" 'quoted text' --verbose
+		$(pwd) then sed local -eu cd
+-eu cd local echo cd 'quoted text' printf grep awk
+		export sed x=1 ${HOME}
+x=1 echo 'quoted text' echo
+	then cd | | | done export | awk export 'quoted text'
+		x=1 -eu 2>/dev/null | 2>/dev/null
+		export $(pwd) "$1" export "$1" $(pwd) local "$1" local echo
+		${HOME} ${HOME} then "$1" export /usr/bin readonly readonly ${HOME}
+		cd && "$@" 'quoted text' then readonly
+		printf x=1 readonly $(pwd) readonly done then local readonly -eu
+	/usr/bin then ${HOME} grep -eu $(pwd) "$@" local export
+		grep -eu "$@" 2>/dev/null x=1 --verbose $(pwd) 'quoted text' local
+		echo 2>/dev/null awk $(pwd) then "$@" export x=1
+		x=1 --verbose printf x=1 then printf cd test ${HOME}
+		grep 2>/dev/null ${HOME} $(pwd) &&
+then 2>/dev/null 2>/dev/null readonly
+		${HOME} $(pwd) printf printf "$@" cd -eu --verbose "$1"
+	sed readonly awk 2>/dev/null then 2>/dev/null test ${HOME} export
+	${HOME} then test $(pwd) "$@"
+		${HOME} | grep -eu "$@" ${HOME}
+	$(pwd) ${HOME} ${HOME} "$@" grep local local test local
+-eu $(pwd) && grep x=1 x=1 ${HOME} cd grep 'quoted text'
+	local && echo "$@" readonly
+	| grep "$1" sed echo && 'quoted text' echo -eu cd local sed x=1 /usr/bin
+&& cd "$@" printf x=1 printf x=1 readonly x=1 2>/dev/null ${HOME}
+$(pwd) then /usr/bin grep
+		test $(pwd) 'quoted text' /usr/bin printf
+	/usr/bin 2>/dev/null x=1 test /usr/bin
+		sed 'quoted text' done test cd ${HOME} then x=1 -eu 'quoted text'
+		"$1" done printf --verbose test "$1"
+/usr/bin awk export 'quoted text' local | 2>/dev/null x=1 2>/dev/null
+		sed then 2>/dev/null ${HOME} grep done cd 2>/dev/null --verbose sed --verbose
+export local --verbose 2>/dev/null --verbose /usr/bin
+	test 2>/dev/null grep printf printf
+		grep export local test | "$@" grep local 'quoted text' export printf
+test $(pwd) awk "$@" 'quoted text'
+		$(pwd) grep "$1" export | 'quoted text'
+	then local then -eu echo echo done -eu --verbose $(pwd)
+	&& 2>/dev/null cd echo x=1 | grep -eu | 2>/dev/null readonly
+printf readonly sed printf then cd test "$1" $(pwd)
+		/usr/bin then && x=1 cd 'quoted text' printf | local 2>/dev/null x=1
+	2>/dev/null printf then "$@" awk grep 2>/dev/null
+		"$1" /usr/bin readonly sed "$1" | | grep export sed
+&& x=1 "$1" cd cd "$@" 'quoted text' /usr/bin local /usr/bin
+		"$1" cd export && export grep awk then /usr/bin $(pwd) $(pwd) 'quoted text' -eu
+	test echo /usr/bin --verbose awk done "$@" export /usr/bin then then x=1
+cd then local | done grep /usr/bin local done test
+	$(pwd) grep local echo "$1" sed --verbose
+	done --verbose | grep ${HOME} readonly echo /usr/bin done awk then
+	-eu && 2>/dev/null ${HOME} | printf
+| printf | -eu 2>/dev/null --verbose
+		"$@" 2>/dev/null && ${HOME} x=1 done awk ${HOME} test
+| x=1 x=1 ${HOME} then -eu | /usr/bin awk /usr/bin 'quoted text'
+	&& ${HOME} | sed grep && echo test awk export 'quoted text'
+	'quoted text' local | cd && --verbose | printf | readonly
+-eu /usr/bin ${HOME} x=1 /usr/bin ${HOME} --verbose grep
+/usr/bin echo | echo readonly then
+		${HOME} x=1 'quoted text' --verbose 'quoted text'
+	sed echo --verbose "$1" sed "$@" x=1 printf
+"$@" $(pwd) /usr/bin | done "$1" ${HOME} "$1" grep $(pwd) /usr/bin
+printf --verbose test --verbose
+		awk | "$@" local sed x=1 2>/dev/null
+		then ${HOME} /usr/bin "$@" export
+printf ${HOME} --verbose "$1" then 'quoted text' 'quoted text' "$@" awk printf
+-eu cd /usr/bin sed ${HOME} grep echo
+		grep awk test /usr/bin awk test echo "$@" test then test then grep printf
+	done readonly export && grep 2>/dev/null
+	done readonly done local $(pwd) cd test 2>/dev/null 2>/dev/null
+	grep && -eu grep echo $(pwd) awk cd "$1" done sed done "$@" 'quoted text'
+-eu 'quoted text' local grep "$1" cd "$1" -eu 2>/dev/null && export
+done sed printf echo | 'quoted text' export ${HOME} test grep grep echo
+readonly done done export && /usr/bin readonly awk local
+		test readonly readonly cd "$@" -eu echo local ${HOME} $(pwd)
+	awk 'quoted text' ${HOME} 'quoted text' grep 'quoted text'
+	$(pwd) && local "$1" 'quoted text' local readonly readonly
+readonly -eu export awk "$1" "$@" local x=1 done 'quoted text'
+		"$1" ${HOME} printf ${HOME} 2>/dev/null cd echo
+	export -eu "$@" printf | cd --verbose ${HOME} printf
+	/usr/bin | && ${HOME} done
+		echo ${HOME} -eu /usr/bin export cd | cd cd && 'quoted text' && done | /usr/bin
+	done sed cd printf 2>/dev/null readonly "$1" /usr/bin
+'quoted text' test test local x=1 --verbose 'quoted text'
+'quoted text' test "$1" /usr/bin
+'quoted text' "$1" then grep
+| x=1 then printf readonly
+grep sed printf cd awk export 2>/dev/null grep x=1 awk test awk
+--verbose $(pwd) echo local
+	readonly "$1" ${HOME} cd done -eu grep 'quoted text'
+test echo printf "$1" echo ${HOME} cd ${HOME} awk x=1 test $(pwd)
+	printf echo export 2>/dev/null ${HOME} 2>/dev/null
+		"$1" then cd "$1" done done ${HOME}
+		then 2>/dev/null readonly | awk printf
+		local local then echo echo echo
+sed awk /usr/bin --verbose sed
+$(pwd) 2>/dev/null | -eu "$1" sed && printf sed readonly
+	${HOME} awk done readonly | then readonly /usr/bin x=1 sed
+	x=1 /usr/bin test export done
+then sed done local readonly ${HOME}
+test --verbose x=1 local ${HOME} 2>/dev/null test "$@"
+	export | export $(pwd) -eu -eu | local readonly
+	sed -eu test | ${HOME} x=1 /usr/bin export then local "$@" && done cd readonly
+		export -eu sed "$1" x=1 then printf local test export echo --verbose
+	local awk ${HOME} /usr/bin /usr/bin export then 2>/dev/null export
+		"$1" | export "$1" && 'quoted text'
+	${HOME} "$1" "$1" test 2>/dev/null local $(pwd) sed "$1" -eu
+sed grep && test readonly readonly readonly
+		export echo readonly $(pwd) done grep then grep /usr/bin readonly
+		local cd local | local printf x=1 ${HOME} cd readonly done --verbose x=1 /usr/bin
+test echo echo test /usr/bin && sed $(pwd) echo "$1" printf && test | grep
+done "$@" echo 'quoted text'
+		sed $(pwd) $(pwd) "$@" "$@"
+readonly && $(pwd) x=1 local sed export "$1" --verbose
+	printf ${HOME} --verbose local
+		x=1 "$1" ${HOME} 2>/dev/null export $(pwd) | test --verbose
+x=1 sed local ${HOME} x=1 | echo awk then done 'quoted text'
+sed local awk done x=1 && $(pwd) -eu local && readonly
+	2>/dev/null -eu 2>/dev/null
+grep --verbose 'quoted text' "$1" sed x=1 --verbose "$1" --verbose
+	local /usr/bin test $(pwd) local printf | x=1 -eu 2>/dev/null sed --verbose
+echo -eu --verbose cd "$@" 'quoted text' && local then /usr/bin $(pwd) cd x=1
+--verbose local sed done export local awk $(pwd) then && 2>/dev/null
+		done /usr/bin cd 'quoted text' && ${HOME} local --verbose grep echo /usr/bin readonly
+	echo 'quoted text' local | -eu ${HOME} "$1" ${HOME} local readonly
+		sed | ${HOME} printf --verbose 'quoted text' && && "$1" export test local --verbose
+		"$1" local sed ${HOME} readonly "$@" "$@" cd 2>/dev/null
+	${HOME} test 'quoted text' done | x=1 /usr/bin x=1 'quoted text'
+| readonly done readonly export
+	grep cd grep printf echo --verbose awk local x=1 export x=1 "$1" done
+$(pwd) printf grep export ${HOME} echo $(pwd) | local printf ${HOME} $(pwd) &&
+		echo && --verbose && test readonly /usr/bin readonly sed 'quoted text' then /usr/bin
+awk then 'quoted text' && echo
+		'quoted text' "$@" -eu $(pwd) "$@" done ${HOME}
+		printf /usr/bin printf ${HOME} local 'quoted text' "$1"
+		echo -eu x=1 sed "$@" then && sed done
+	$(pwd) export then ${HOME} echo printf
+	'quoted text' then local sed ${HOME} readonly
+		grep && readonly printf "$@" $(pwd) export test local done | then
+	-eu && awk printf 2>/dev/null sed local ${HOME} 2>/dev/null
+cd sed 'quoted text' | export done
+	cd test awk export printf
+	"$@" -eu -eu | /usr/bin x=1 -eu "$1" && && | awk echo --verbose
+		"$@" --verbose "$1" then local readonly /usr/bin cd -eu | local done awk -eu
+	'quoted text' readonly
+	printf --verbose test sed | echo ${HOME}
+echo -eu awk $(pwd) done -eu $(pwd) 'quoted text'
+	'quoted text' $(pwd) --verbose cd cd "$1" done done local then export 2>/dev/null
+	"$1" echo 2>/dev/null 'quoted text' export
+test done && echo echo local | && x=1 --verbose
+		sed then 'quoted text' ${HOME} export "$@" grep && local "$@" then 2>/dev/null
+		2>/dev/null export done --verbose export test grep x=1 && --verbose printf
+		--verbose export 'quoted text' ${HOME} /usr/bin sed /usr/bin
+	2>/dev/null 2>/dev/null
+	awk --verbose local "$@"
+	/usr/bin echo x=1 2>/dev/null readonly grep readonly
+"$@" echo printf && printf
+test printf test ${HOME} then
+	| /usr/bin awk cd -eu "$1" $(pwd) test test grep 'quoted text'
+$(pwd) export grep export x=1 grep /usr/bin -eu local 2>/dev/null
+		"$@" /usr/bin local 'quoted text' awk cd /usr/bin ${HOME} "$1"
+then x=1 grep "$1" /usr/bin echo export
+--verbose test grep echo test cd
+	sed grep | echo 'quoted text' readonly cd &&
+	grep | -eu echo grep test x=1 -eu "$1" "$@" export grep 'quoted text' --verbose
+printf | x=1 readonly export
+		/usr/bin grep local awk ${HOME} cd
+	/usr/bin echo 2>/dev/null done --verbose export
+		then local x=1 grep test && 2>/dev/null --verbose "$@" sed
+	cd then && then --verbose sed
+readonly 'quoted text' -eu $(pwd) --verbose echo echo x=1 $(pwd) x=1 echo done
+	--verbose printf sed && --verbose
+cd 2>/dev/null test export then awk awk export
+		"$1" grep printf "$1" "$@" local echo sed "$1"
+$(pwd) ${HOME} echo then 'quoted text' then done then x=1 -eu && local
+		export ${HOME} "$@" readonly --verbose | printf local "$1" printf
+		${HOME} grep "$1" echo local
+		${HOME} local test 2>/dev/null
+cd "$1" $(pwd) test "$@" printf grep --verbose
+	&& -eu export done "$1" "$@"
+		2>/dev/null --verbose test "$1" awk cd export then
+printf then -eu "$1" sed &&
+local export $(pwd) ${HOME} /usr/bin awk /usr/bin
+/usr/bin ${HOME} then 2>/dev/null printf echo /usr/bin export cd
+grep grep | "$@" test -eu echo --verbose awk --verbose
+	readonly export "$1" export $(pwd) --verbose
+		'quoted text' export 'quoted text'
+	test "$@" "$@" x=1 sed 2>/dev/null
+	cd ${HOME} export "$@"
+		done "$@" awk 2>/dev/null 2>/dev/null -eu
+	readonly "$@" ${HOME} && 2>/dev/null
+	grep | then local grep local done /usr/bin sed done awk
+		readonly 2>/dev/null done readonly "$@" sed readonly
+		sed && "$1" "$@" local export
+		echo 2>/dev/null awk "$@" grep then 2>/dev/null $(pwd)
+	grep echo x=1 $(pwd) readonly
+		"$@" /usr/bin && x=1 printf then ${HOME} /usr/bin
+'quoted text' "$1" printf -eu -eu local done | ${HOME} echo
+		/usr/bin printf done test sed readonly then test readonly "$@" | then 2>/dev/null
+	'quoted text' --verbose then
+		/usr/bin "$1" 'quoted text' echo && -eu then
+		readonly sed --verbose "$1" local export
+'quoted text' cd test 'quoted text' --verbose export done export 2>/dev/null
+test then local /usr/bin ${HOME} awk --verbose printf test done echo 'quoted text'
+awk | awk sed test cd /usr/bin cd
+	"$@" x=1 "$1" /usr/bin && echo
+done --verbose /usr/bin $(pwd)
+		cd "$1" 'quoted text' 'quoted text' sed echo 2>/dev/null echo "$@"
+&& && sed readonly 2>/dev/null
+		done $(pwd) | && grep printf grep sed 2>/dev/null printf cd "$@" readonly
+&& /usr/bin readonly && export awk
+		awk echo /usr/bin ${HOME} then printf "$1" 'quoted text'
+export cd -eu awk x=1 x=1 printf test
+		awk $(pwd) echo "$1" printf /usr/bin x=1 && $(pwd)
+		readonly test printf test /usr/bin
+		export 2>/dev/null sed readonly printf printf printf "$@" test /usr/bin
+		cd | done done readonly echo ${HOME}
+	sed ${HOME} 2>/dev/null awk | done then sed grep x=1 | -eu "$1" 'quoted text'
+	--verbose readonly awk -eu readonly
+		-eu grep awk done 'quoted text' --verbose /usr/bin -eu "$1" 2>/dev/null
+awk && | done --verbose echo cd sed printf echo | x=1
+	echo done awk awk cd --verbose |
+	"$@" sed local ${HOME} "$@" x=1 "$1" x=1 sed ${HOME} grep done "$1" awk done &&
+	echo readonly done sed ${HOME} awk ${HOME} /usr/bin
+"$@" | "$1" printf local 2>/dev/null printf local sed x=1 2>/dev/null
+	sed printf readonly --verbose && then
+		x=1 -eu export -eu 'quoted text' local done
+	grep | awk grep cd sed -eu awk &&
+printf local /usr/bin $(pwd) "$@" then --verbose cd test awk echo 2>/dev/null
+grep readonly export sed 2>/dev/null "$1" "$1" then readonly ${HOME} 2>/dev/null
+echo /usr/bin local $(pwd) "$@" -eu cd echo echo local grep && readonly
+"$1" awk printf 2>/dev/null local "$@" 'quoted text'
+		2>/dev/null "$@" 'quoted text' printf -eu "$1" 2>/dev/null echo
+		&& --verbose 2>/dev/null done --verbose /usr/bin local sed
+		then --verbose x=1 'quoted text' readonly --verbose ${HOME} readonly sed $(pwd)
+--verbose test "$1" then 2>/dev/null sed && local ${HOME} then x=1 ${HOME}
+	local cd "$@" /usr/bin test grep printf
+	| printf echo $(pwd) local awk "$@"
+done /usr/bin done awk export grep "$1"
+echo 2>/dev/null "$1" && awk readonly
+${HOME} "$@" printf done --verbose sed cd
+		export --verbose printf done
+		x=1 done awk x=1 "$@" echo printf printf echo
+${HOME} --verbose 2>/dev/null
+awk x=1 printf test awk -eu printf --verbose | --verbose "$1" 2>/dev/null
+"$@" "$@" 'quoted text' local 'quoted text' echo printf echo printf awk /usr/bin
+test x=1 test 2>/dev/null --verbose sed --verbose test
+--verbose x=1 $(pwd) echo && $(pwd) -eu "$1" printf
+	test x=1 done then export sed
+"$1" ${HOME} -eu "$1" 2>/dev/null ${HOME}
+		${HOME} $(pwd) && -eu printf && "$1" readonly "$@" "$1" 'quoted text'
+"$1" ${HOME} export 2>/dev/null | sed /usr/bin ${HOME}
+		"$1" /usr/bin sed printf test /usr/bin
+		printf done ${HOME} --verbose /usr/bin
+	local /usr/bin done printf --verbose readonly /usr/bin -eu /usr/bin export ${HOME}
+	x=1 x=1 local x=1 test grep
+| printf awk 2>/dev/null -eu && export /usr/bin && then test ${HOME}
+"$1" test "$1" -eu cd done /usr/bin /usr/bin test sed 'quoted text' ${HOME} test
+--verbose x=1 readonly then "$@" -eu
+		export cd done done 2>/dev/null --verbose
+	--verbose printf sed local -eu 2>/dev/null export ${HOME} "$1" printf awk awk ${HOME}
+echo 2>/dev/null readonly test $(pwd) | 2>/dev/null
+		readonly "$@" done awk done readonly export test readonly then cd
+		-eu -eu 'quoted text' x=1 export then /usr/bin 2>/dev/null then /usr/bin | && readonly
+&& -eu echo done export cd then /usr/bin done echo
+cd x=1 "$1" /usr/bin $(pwd) ${HOME} printf /usr/bin "$@" ${HOME}
+| --verbose awk then 'quoted text' readonly grep
+--verbose -eu | ${HOME} -eu cd test grep "$1" x=1 echo -eu "$@"
+		"$1" echo export && ${HOME} "$1" $(pwd) printf 'quoted text' readonly
+		"$@" /usr/bin grep 'quoted text' --verbose readonly
+	--verbose readonly sed -eu 2>/dev/null && | printf x=1 | grep done
+		then $(pwd) -eu export "$@" cd test ${HOME} $(pwd) echo printf | --verbose
+	echo done grep 2>/dev/null
+	$(pwd) "$1" /usr/bin | echo 'quoted text'
+		x=1 grep --verbose printf /usr/bin -eu cd $(pwd) 'quoted text'
+		export test then done 'quoted text'
+-eu && test x=1 2>/dev/null grep export sed "$@"
+	test /usr/bin printf echo 2>/dev/null readonly -eu done
+	x=1 | 2>/dev/null 2>/dev/null awk && 'quoted text' $(pwd) --verbose
+		x=1 readonly $(pwd) "$@" awk && readonly printf readonly then -eu $(pwd) 'quoted text'
+		echo echo "$1" cd | $(pwd) "$@" "$1" &&
+	readonly sed grep 2>/dev/null cd x=1 'quoted text'
+-eu x=1 printf 2>/dev/null local done done $(pwd) local test done
+	&& local /usr/bin "$1" sed 2>/dev/null sed printf $(pwd) x=1 local /usr/bin
+		readonly ${HOME} --verbose local grep done then && $(pwd) -eu "$@" then
+		done $(pwd) | /usr/bin 'quoted text'
+		/usr/bin x=1 export /usr/bin local
+		readonly x=1 test 'quoted text' local && local sed
+	echo test local export awk awk 'quoted text' -eu
+		local --verbose $(pwd) x=1 --verbose
+		echo printf 'quoted text' $(pwd) done then | local -eu export
+		cd $(pwd) | readonly readonly | $(pwd) "$@"
+	test --verbose local awk test /usr/bin ${HOME} $(pwd) export grep
+		$(pwd) ${HOME} awk && export x=1 && x=1 export
+	| local local echo 2>/dev/null echo grep -eu echo "$1" cd local && "$@" cd
+	sed -eu | cd ${HOME} --verbose cd -eu ${HOME} --verbose
+	"$@" | local ${HOME} local
+-eu readonly /usr/bin --verbose 2>/dev/null
+		&& --verbose 2>/dev/null --verbose
+test awk | export awk /usr/bin cd && readonly
+		sed done awk printf test | /usr/bin --verbose /usr/bin "$1" -eu then
+&& grep $(pwd) grep sed export
+cd grep x=1 awk ${HOME} grep $(pwd) readonly test x=1 -eu && grep
+${HOME} 2>/dev/null echo readonly x=1 && done then test readonly echo |
+		export -eu && "$@" done awk echo readonly /usr/bin "$1" awk printf
+		done && x=1 sed | | printf /usr/bin && ${HOME} 'quoted text' local
+		$(pwd) /usr/bin 'quoted text' --verbose
+awk && $(pwd) 'quoted text' $(pwd) "$1" "$@"
+		then export awk then readonly
+local then 'quoted text' -eu 2>/dev/null local local --verbose
+sed then then printf -eu readonly awk $(pwd)
+	test && -eu "$1" done ${HOME} sed ${HOME} x=1 $(pwd) "$1" && $(pwd) "$1"
+&& printf cd 2>/dev/null export "$1" printf && "$1"
+		printf local readonly test x=1 local /usr/bin grep
+		then 2>/dev/null x=1 local "$@" 2>/dev/null readonly ${HOME} then test -eu
+		"$1" 'quoted text' awk "$1" | grep --verbose -eu awk sed echo | export --verbose
+'quoted text' local $(pwd) done
+	cd "$1" printf x=1 echo then --verbose readonly sed awk -eu -eu 'quoted text' cd
+		2>/dev/null readonly && && "$@" ${HOME} ${HOME} ${HOME} 2>/dev/null
+"$@" test 'quoted text' readonly $(pwd) /usr/bin local /usr/bin $(pwd)
+	"$@" local echo 2>/dev/null
+"$@" 'quoted text' grep printf "$1" 'quoted text' cd cd echo | then
+	'quoted text' local sed && cd --verbose -eu
+		echo done echo 'quoted text'
+	'quoted text' 'quoted text' && printf grep 'quoted text' done
+2>/dev/null 2>/dev/null then ${HOME} grep local -eu export test export -eu
+	'quoted text' export "$1"
+x=1 printf local $(pwd) done grep --verbose export local "$@"
+	test | done x=1 /usr/bin | 'quoted text'
+grep ${HOME} 2>/dev/null cd x=1 test export sed $(pwd)
+		echo echo export sed x=1 readonly "$1" local
+	2>/dev/null done --verbose printf grep echo test readonly then
+"$1" /usr/bin printf cd && local 'quoted text' printf grep -eu -eu "$1" echo
+2>/dev/null printf printf "$@" sed then && ${HOME} 'quoted text'
+	cd "$1" readonly "$@" then echo "$1" local $(pwd) awk
+--verbose then grep export
+		awk done -eu local | done done /usr/bin /usr/bin local local test
+		x=1 grep -eu export 'quoted text' then -eu ${HOME} printf sed sed
+test ${HOME} "$@" 'quoted text'
+--verbose | grep local local test
+		$(pwd) awk 2>/dev/null printf 2>/dev/null sed then test "$1" cd echo
+then export sed --verbose cd
+	"$@" awk && $(pwd) local cd $(pwd) export readonly done "$1" local x=1
+2>/dev/null then awk && "$1" grep ${HOME} && --verbose | export x=1 "$@" cd
+awk sed test export | /usr/bin /usr/bin awk then 'quoted text'
+echo ${HOME} ${HOME} ${HOME} 'quoted text' 2>/dev/null "$@" then test && export
+cd done --verbose test local | x=1 awk $(pwd) /usr/bin export /usr/bin
+		"$1" readonly x=1 ${HOME} x=1 "$@" 'quoted text' x=1 --verbose
+${HOME} /usr/bin 2>/dev/null | ${HOME}
+	2>/dev/null /usr/bin export "$1" test -eu "$1" 2>/dev/null
+then local test 'quoted text' grep --verbose ${HOME} then then awk
+cd ${HOME} cd --verbose grep printf 'quoted text' then 'quoted text' |
+'quoted text' $(pwd) "$1" test && /usr/bin
+	/usr/bin sed 2>/dev/null $(pwd) --verbose 'quoted text'
+	echo sed "$1" local $(pwd) 2>/dev/null grep "$1" && sed cd cd printf && then
+		$(pwd) "$1" "$1" printf echo "$@" 'quoted text' then && $(pwd) && readonly
+	cd readonly echo "$1" | x=1 grep "$1" ${HOME} "$1" "$1" /usr/bin readonly
+	--verbose --verbose cd
+"$1" 2>/dev/null "$@" && sed cd $(pwd) | $(pwd) local readonly --verbose /usr/bin
+		| test 2>/dev/null cd ${HOME} local export test then cd done "$@" sed --verbose
+	/usr/bin x=1 echo 2>/dev/null 'quoted text' done local local done $(pwd) "$1"
+		"$@" readonly $(pwd) test done -eu $(pwd) grep test "$1" local done readonly
+		then ${HOME} /usr/bin grep readonly test ${HOME} -eu "$1"
+	export x=1 test sed awk done 'quoted text'
+		"$@" 2>/dev/null && printf export sed cd /usr/bin awk awk local --verbose grep echo
+x=1 ${HOME} echo readonly sed /usr/bin
+test awk printf test /usr/bin 2>/dev/null done | -eu | "$@" "$1"
+	'quoted text' x=1 -eu -eu then grep -eu $(pwd) 'quoted text' ${HOME}
+		local local 'quoted text' local "$@"
+	printf && local awk ${HOME} | grep /usr/bin
+	--verbose awk x=1 readonly | export awk
+		"$1" "$@" 2>/dev/null echo awk "$@" printf cd readonly -eu x=1 x=1
+export ${HOME} 2>/dev/null export test done printf $(pwd)
+	local readonly done "$@" 'quoted text' sed /usr/bin echo
+		${HOME} --verbose local "$@" 2>/dev/null echo readonly local local
+		test "$1" 2>/dev/null awk --verbose grep local -eu test awk $(pwd) x=1
+		-eu 2>/dev/null grep then done "$1" && done $(pwd) ${HOME}
+		readonly | $(pwd) /usr/bin grep --verbose test -eu export echo done ${HOME} done
+"$@" 2>/dev/null then printf cd "$@" x=1 /usr/bin "$@" export $(pwd)
+		awk ${HOME} 'quoted text'
+		| test $(pwd) 'quoted text' "$1" readonly export readonly grep | "$1" 2>/dev/null
+then 2>/dev/null x=1 awk --verbose then cd
+		cd "$1" -eu | sed /usr/bin readonly "$1" done && --verbose export
+cd local grep cd grep done cd awk "$1" printf 'quoted text'
+	readonly then "$1" 'quoted text' /usr/bin | | echo export $(pwd)
+	"$1" export 2>/dev/null local && x=1 test sed x=1 'quoted text' cd
+	x=1 readonly --verbose -eu --verbose /usr/bin grep awk 'quoted text'
+		$(pwd) then 2>/dev/null then echo /usr/bin grep &&
+		/usr/bin echo $(pwd) &&
+x=1 | 'quoted text' --verbose | $(pwd) --verbose done readonly local printf
+"$1" local readonly grep readonly
+sed 'quoted text' done grep 'quoted text'
+readonly --verbose local export cd
+		cd x=1 'quoted text' 2>/dev/null /usr/bin /usr/bin | 2>/dev/null grep sed then
+/usr/bin cd local echo $(pwd) 'quoted text' ${HOME} $(pwd)
+'quoted text' 2>/dev/null awk | "$1"
+export then echo then x=1 sed
+		done test printf | | 'quoted text'
+"$1" x=1 && grep /usr/bin && local test --verbose local
+		sed 'quoted text' x=1 --verbose export echo awk sed
+	x=1 readonly done export | done grep cd 2>/dev/null
+	"$@" $(pwd) $(pwd) --verbose awk /usr/bin 2>/dev/null | $(pwd)
+		readonly grep $(pwd) local --verbose sed "$1" $(pwd) && -eu readonly
+	$(pwd) ${HOME} $(pwd) ${HOME} cd ${HOME} 'quoted text' "$1" && x=1 done -eu sed
+		test local sed | | /usr/bin sed printf readonly "$1" export -eu
+'quoted text' then 'quoted text' done export sed 'quoted text' readonly
+	2>/dev/null local then && done
+cd 2>/dev/null x=1 then /usr/bin echo x=1 'quoted text' $(pwd) $(pwd)
+printf 2>/dev/null done export $(pwd) test &&
+	local $(pwd) x=1 2>/dev/null -eu local
+awk ${HOME} then 'quoted text'
+echo 2>/dev/null printf 2>/dev/null
+	test "$1" echo test "$1" 2>/dev/null "$1" "$@" then printf
+| printf done 2>/dev/null printf 2>/dev/null ${HOME} | | x=1 local local
+		then | $(pwd) $(pwd) grep grep printf done "$@" $(pwd) readonly
+		local x=1 ${HOME} echo /usr/bin x=1 then done
+		"$1" "$@" && /usr/bin printf "$@" local echo 'quoted text' grep awk then echo grep
+local local local && echo | grep | | echo && -eu
+		/usr/bin done awk /usr/bin /usr/bin awk then then 2>/dev/null test
+'quoted text' "$1" echo cd 2>/dev/null --verbose done x=1 grep sed --verbose
+	awk export | $(pwd) 2>/dev/null | ${HOME} local /usr/bin "$1" awk x=1
+		-eu test grep sed local echo
+readonly grep 'quoted text' test --verbose readonly | | sed sed
+	"$1" test echo awk export awk /usr/bin "$@" test awk echo
+		$(pwd) cd export readonly awk printf -eu && && 2>/dev/null local local readonly
+	then grep ${HOME} x=1 &&
+grep readonly /usr/bin sed 'quoted text'
+	-eu "$1" readonly | 'quoted text' then awk
+	test test "$1" printf "$1" printf readonly x=1 -eu
+	"$@" x=1 local readonly 'quoted text'
+		cd /usr/bin | local local then cd | local 'quoted text'
+cd ${HOME} sed ${HOME} printf readonly --verbose export -eu local test "$1"
+| sed sed $(pwd) ${HOME} test 2>/dev/null $(pwd) | 2>/dev/null
+$(pwd) "$@" "$1" -eu cd -eu echo sed x=1 $(pwd) sed 2>/dev/null echo --verbose
+then echo | test 'quoted text'
+	2>/dev/null ${HOME} 'quoted text'
+	then && grep 'quoted text' sed grep && --verbose grep -eu "$1" "$@" done
+sed 2>/dev/null -eu cd readonly /usr/bin ${HOME}
+		test --verbose readonly "$1" local awk awk then && echo "$@" "$1" readonly done
+		readonly grep "$1" grep /usr/bin /usr/bin echo "$@" export --verbose
+		--verbose printf echo local awk 'quoted text' --verbose 2>/dev/null echo "$1" readonly
+	echo grep export sed readonly done awk 'quoted text'
+awk cd readonly printf export | echo done --verbose
+		done echo readonly /usr/bin $(pwd) local x=1 -eu done grep x=1 awk "$1" &&
+		$(pwd) readonly "$1" local
+	then 'quoted text' x=1 awk grep sed ${HOME}
+x=1 done awk /usr/bin export sed awk | x=1 'quoted text' then readonly
+grep local | --verbose
+		'quoted text' x=1 "$@" local done -eu echo grep local cd | "$1" /usr/bin --verbose
+	&& grep awk 2>/dev/null done /usr/bin -eu && && awk $(pwd)
+	printf echo echo | printf /usr/bin
+2>/dev/null --verbose test "$@" export awk -eu awk $(pwd) then
+	done 'quoted text' test $(pwd) 'quoted text'
+		x=1 /usr/bin --verbose sed cd "$1" -eu 'quoted text' 2>/dev/null local --verbose
+		cd echo export 2>/dev/null "$1" "$1" local
+	| x=1 $(pwd) then sed cd /usr/bin then && export "$1"
+	grep $(pwd) /usr/bin echo cd 'quoted text'
+	test export echo awk
+	grep test x=1 readonly 2>/dev/null cd | test local export
+	$(pwd) printf echo then cd echo "$1" "$@" $(pwd) printf
+/usr/bin "$@" --verbose printf then --verbose
+		then local cd /usr/bin test /usr/bin printf "$@" echo awk readonly
+	sed $(pwd) --verbose -eu awk --verbose ${HOME} | ${HOME} ${HOME} "$@" /usr/bin
+test done && "$1" 'quoted text' done printf "$1" 'quoted text' 'quoted text' done
+readonly printf $(pwd) readonly /usr/bin cd
+/usr/bin done done done done
+"$@" && local ${HOME} echo x=1 x=1 'quoted text' "$@" -eu && readonly grep $(pwd)
+	2>/dev/null grep | echo "$1" "$@" -eu --verbose 2>/dev/null
+	"$@" test echo 'quoted text'
+		readonly local "$@" x=1 awk local echo sed
+"$1" echo 'quoted text' | $(pwd) x=1 local then $(pwd) ${HOME} done --verbose 2>/dev/null
+		'quoted text' echo -eu echo readonly sed $(pwd) --verbose ${HOME}
+		&& --verbose "$1" readonly readonly 2>/dev/null
+grep local test x=1 cd 2>/dev/null printf "$1" --verbose $(pwd) 2>/dev/null
+awk "$@" $(pwd) export printf test "$@" ${HOME} 2>/dev/null
+grep sed /usr/bin readonly export awk 'quoted text'
+		awk printf awk ${HOME} --verbose "$1" 'quoted text' echo
+	"$@" "$1" x=1 | "$@" "$@" "$1" 'quoted text' ${HOME} "$1" printf
+then "$@" printf --verbose sed "$@" "$1" --verbose
+	local then "$@" grep $(pwd) test
+	grep local $(pwd) done awk export 'quoted text' $(pwd) local readonly "$@" sed
+		${HOME} local readonly && done x=1
+echo printf cd && then readonly printf
+	--verbose ${HOME} then grep 2>/dev/null cd
+x=1 "$@" cd 2>/dev/null awk awk 'quoted text' "$1" && 'quoted text'
+'quoted text' "$1" export
+printf test 2>/dev/null $(pwd) printf export done printf && then
+		"$@" local readonly --verbose
+/usr/bin readonly cd then "$1" sed export cd then
+		test sed local done echo awk "$1"
+export "$1" sed local test
+	$(pwd) then -eu -eu "$1" done
+	test awk && 'quoted text' export | done done export done export /usr/bin
+		--verbose sed done done done grep done x=1 cd 2>/dev/null "$1" --verbose
+	local "$@" 2>/dev/null readonly
+	/usr/bin sed local sed export awk
+		local readonly export --verbose local x=1 "$@" sed printf sed then
+	| "$1" echo export cd 2>/dev/null test $(pwd) ${HOME} local sed readonly $(pwd)
+	then --verbose local $(pwd) x=1 && sed done
+	${HOME} ${HOME} -eu test -eu cd local grep x=1 -eu | -eu done
+	then local $(pwd) echo awk "$1" "$@" $(pwd)
+	$(pwd) then export then sed "$1" --verbose "$@"
+	| "$@" 2>/dev/null -eu 'quoted text'
+		x=1 "$1" export grep grep export sed && local local 2>/dev/null "$@" readonly
+	${HOME} /usr/bin 2>/dev/null && done
+&& ${HOME} --verbose "$1"
+	readonly readonly export --verbose ${HOME} | readonly -eu
+	$(pwd) "$1" "$@" | -eu printf | printf
+		awk test then 2>/dev/null | | x=1 done grep local test local export
+		printf 2>/dev/null grep printf 'quoted text'
+		--verbose then export /usr/bin 2>/dev/null then "$1" test | echo
+		-eu printf --verbose /usr/bin && grep -eu x=1 2>/dev/null 'quoted text'
+x=1 sed x=1 "$@" /usr/bin "$@" 2>/dev/null 'quoted text'
+		echo /usr/bin $(pwd) $(pwd) export echo done ${HOME} awk local
+done grep readonly readonly
+	--verbose cd echo test printf "$@" done -eu local test grep local
+	'quoted text' awk grep grep local /usr/bin awk "$1"
+	--verbose grep cd "$1" printf printf readonly awk cd ${HOME}
+		x=1 export sed sed x=1 echo --verbose 2>/dev/null -eu then x=1 awk && && 2>/dev/null
+then $(pwd) /usr/bin export grep
+	'quoted text' x=1 'quoted text' awk sed
+	printf $(pwd) local | ${HOME} test $(pwd) local
+		printf export sed "$@" test sed "$@" -eu 'quoted text'
+		&& 'quoted text' awk | -eu $(pwd) done 'quoted text'
+readonly sed grep cd ${HOME} && cd printf readonly echo sed
+	"$1" awk 'quoted text' "$@" local awk | 'quoted text' &&
+printf grep printf done
+	$(pwd) 2>/dev/null grep "$1" printf printf printf 'quoted text' awk printf
+| readonly grep 2>/dev/null test grep | 'quoted text' then readonly grep readonly
+		/usr/bin export "$1"
+--verbose -eu cd sed "$@" /usr/bin export sed local then $(pwd) cd then readonly
+2>/dev/null local -eu sed && cd
+"$@" then "$@" sed 'quoted text' 2>/dev/null
+		then local && && ${HOME} "$1" cd awk awk sed --verbose local && echo sed /usr/bin
+	cd ${HOME} /usr/bin /usr/bin
+	x=1 printf sed -eu echo
+printf done test -eu grep --verbose 2>/dev/null ${HOME} 'quoted text'
+$(pwd) test "$@" readonly /usr/bin printf && export sed printf | &&
+	'quoted text' local /usr/bin -eu /usr/bin -eu printf readonly | x=1
+		"$1" | "$@" "$1" "$1" readonly | printf
+--verbose echo | printf test local /usr/bin /usr/bin
+		"$1" -eu /usr/bin --verbose ${HOME} 2>/dev/null $(pwd) /usr/bin /usr/bin
+	"$1" test cd printf -eu done && readonly test
+		| && cd printf x=1 echo x=1 2>/dev/null --verbose
+$(pwd) /usr/bin done echo done 2>/dev/null awk ${HOME}
+	&& /usr/bin --verbose echo $(pwd) cd "$@" ${HOME} done sed /usr/bin
+		export test grep done "$@" done sed printf ${HOME}
+readonly $(pwd) --verbose /usr/bin
+$(pwd) readonly | echo awk 2>/dev/null done "$@" /usr/bin awk sed local
+$(pwd) && then done /usr/bin $(pwd) test $(pwd) sed --verbose
+then 'quoted text' readonly
+$(pwd) local -eu local --verbose printf x=1
+		&& echo | awk test /usr/bin cd "$@" 'quoted text'
+	${HOME} sed printf awk awk cd local sed --verbose done then
+		-eu export local "$1" | 2>/dev/null awk -eu
+/usr/bin local printf echo cd /usr/bin x=1 $(pwd) "$@"
+/usr/bin readonly readonly done
+		2>/dev/null | grep sed /usr/bin 'quoted text'
+		&& | test readonly done --verbose ${HOME} then && test $(pwd)
+	sed 2>/dev/null $(pwd) echo local printf
+${HOME} export 'quoted text' && awk awk cd export done
+--verbose grep readonly --verbose "$1"
+		printf $(pwd) 2>/dev/null done --verbose -eu export | test awk
+	grep done export && export /usr/bin
+	&& --verbose -eu && cd printf
+"$1" "$1" 'quoted text' /usr/bin then 2>/dev/null && ${HOME} /usr/bin $(pwd) export
+	cd test 2>/dev/null /usr/bin grep sed cd 2>/dev/null $(pwd)
+2>/dev/null test cd "$@" test readonly
+awk ${HOME} grep "$@" printf done x=1 2>/dev/null echo --verbose
+		-eu echo | | readonly | echo printf 'quoted text' "$1" -eu test printf | 2>/dev/null
+grep ${HOME} echo /usr/bin printf $(pwd) export $(pwd) /usr/bin
+		'quoted text' test grep
+&& "$@" printf | test then x=1 | | "$@"
+&& --verbose export ${HOME} 'quoted text' grep local "$@"
+		then local readonly local 'quoted text' then awk then
+awk test -eu -eu ${HOME} test "$1" && local test done $(pwd) 2>/dev/null echo
+	x=1 x=1 then grep 'quoted text' && then readonly "$@" "$@" local "$1" sed local
+		export echo ${HOME} /usr/bin
+		done --verbose -eu 'quoted text'
+export && --verbose echo
+x=1 test sed readonly 'quoted text' $(pwd) export "$@" x=1 awk
+		cd 2>/dev/null done /usr/bin done --verbose --verbose sed && test export
+	echo done | x=1 then && "$@" then then readonly --verbose test 'quoted text'
+	$(pwd) x=1 readonly x=1 'quoted text' 2>/dev/null x=1 then -eu
+	${HOME} "$1" sed cd cd x=1 "$@" grep $(pwd) 2>/dev/null
+	"$1" local 'quoted text' x=1
+		${HOME} cd x=1 /usr/bin | "$1" then && "$@" then cd readonly cd readonly grep
+		done x=1 cd 'quoted text' && 2>/dev/null
+	sed echo "$1" sed ${HOME}
+		&& sed && && "$1" "$@" grep local /usr/bin
+'quoted text' && x=1 then
+--verbose /usr/bin && readonly sed then local printf 'quoted text'
+	export cd test grep cd /usr/bin then
+		echo && grep | local sed -eu echo ${HOME} echo 2>/dev/null grep sed $(pwd)
+	echo ${HOME} | | /usr/bin $(pwd) | printf x=1 2>/dev/null local -eu
+awk -eu cd cd 'quoted text' sed awk /usr/bin sed local
+		local local grep --verbose
+	local 2>/dev/null done grep sed $(pwd)
+	cd echo | done -eu /usr/bin -eu ${HOME} cd local $(pwd)
+		"$1" --verbose -eu /usr/bin then && | echo x=1 'quoted text' ${HOME} && --verbose
+		-eu && 2>/dev/null | cd test sed "$@" done cd cd 'quoted text' grep
+		--verbose 'quoted text' printf -eu printf echo && then | test export
+	grep awk cd --verbose echo $(pwd) /usr/bin | ${HOME} export
+	--verbose export "$@" test &&
+grep then echo awk 'quoted text' -eu -eu cd done "$1" "$@"
+	2>/dev/null /usr/bin done awk /usr/bin done
+		x=1 sed local printf
+	"$1" x=1 test --verbose -eu sed printf
+		sed | readonly printf test echo "$@" grep -eu "$1"
+/usr/bin readonly grep test "$@"
+		&& echo local local | && -eu done then local export ${HOME}
+		| && awk cd printf x=1 | readonly sed /usr/bin 'quoted text' x=1 grep --verbose
+then export 2>/dev/null then awk done --verbose printf ${HOME} 'quoted text'
+		2>/dev/null local "$1" printf ${HOME} printf then $(pwd) ${HOME} printf
+		sed awk "$@" readonly echo x=1 'quoted text'
+	test "$1" | then export test $(pwd)
+		printf x=1 cd ${HOME} --verbose cd | grep 2>/dev/null
+'quoted text' 2>/dev/null /usr/bin sed grep awk /usr/bin
+	done ${HOME} cd readonly awk -eu "$1" sed cd
+sed $(pwd) $(pwd) 2>/dev/null cd | then grep --verbose && sed
+	2>/dev/null "$1" x=1 cd && $(pwd) awk printf "$@" sed
+done sed 'quoted text' 'quoted text' -eu "$1" "$@" cd then -eu then 2>/dev/null
+	2>/dev/null echo "$1" export sed test --verbose 'quoted text'
+/usr/bin x=1 grep --verbose test sed echo
+${HOME} && /usr/bin then ${HOME} | && --verbose grep then ${HOME} echo
+	| local awk grep cd sed x=1 $(pwd) grep done test -eu 2>/dev/null
+		printf | 'quoted text' printf export
+	sed awk then ${HOME} /usr/bin cd --verbose ${HOME} echo && then ${HOME}
+echo /usr/bin sed grep "$@" "$@" x=1 printf ${HOME} done | --verbose
+-eu 2>/dev/null awk 2>/dev/null ${HOME} test "$1"
+/usr/bin done printf cd -eu cd local &&
+		export done export awk
+		export awk awk awk -eu x=1 --verbose 2>/dev/null
+grep test cd grep --verbose readonly && | x=1 "$@"
+'quoted text' test --verbose ${HOME} 2>/dev/null && sed
+	| 2>/dev/null "$@" /usr/bin x=1 && then awk &&
+local readonly then 2>/dev/null grep printf echo
+"$1" sed && $(pwd) awk local | sed $(pwd) cd /usr/bin sed 2>/dev/null
+		then then sed 2>/dev/null x=1 test printf
+	2>/dev/null awk "$@" && readonly test local awk
+--verbose x=1 test export awk test --verbose --verbose sed 2>/dev/null
+| && grep echo x=1 x=1 --verbose
+		test printf local cd "$1" "$@" echo awk 'quoted text'
+		"$1" | x=1 && local readonly awk
+export "$1" ${HOME} done then then -eu "$1" | "$@" ${HOME} printf
+		x=1 'quoted text' sed /usr/bin awk then -eu printf
+		"$@" printf then echo done "$1" sed ${HOME} /usr/bin grep && $(pwd) echo echo
+		/usr/bin local awk --verbose
+${HOME} then export && /usr/bin local "$1" && sed local 'quoted text'
+	| sed "$1" export export done done && test cd then
+$(pwd) "$@" grep x=1 awk grep -eu "$1" echo cd cd && awk grep "$1" -eu
+		readonly $(pwd) done printf
+test "$@" 'quoted text' done done "$@" done 2>/dev/null printf "$1" awk 'quoted text'
+"$1" ${HOME} local | ${HOME} test export local $(pwd) | "$@"
+		sed "$@" "$@" && && cd sed --verbose
+		echo $(pwd) done done /usr/bin done
+	/usr/bin $(pwd) cd done x=1 grep done grep 2>/dev/null
+		printf then -eu sed awk x=1 local grep echo
+	export 'quoted text' printf "$@" test export x=1
+grep awk --verbose test | done then sed "$@" printf x=1 ${HOME} | then
+		test awk sed awk readonly
+	-eu ${HOME} then /usr/bin "$1" 'quoted text' 'quoted text'
+	x=1 x=1 awk 2>/dev/null printf && 'quoted text'
+		2>/dev/null printf test "$1" cd test local && $(pwd) $(pwd) export printf 'quoted text'
+		printf done ${HOME} done
+	printf done ${HOME} 2>/dev/null $(pwd) then printf awk
+local | "$@" done awk 'quoted text'
+		local 'quoted text' grep /usr/bin
+		sed sed awk export 'quoted text' 'quoted text'
+	done then "$@" local sed | x=1 --verbose --verbose 2>/dev/null
+		sed $(pwd) awk && | local echo 'quoted text'
+	awk -eu | | && test "$1" "$@" done x=1
+	x=1 cd echo $(pwd) x=1 printf 'quoted text' export echo then "$1" grep local
+"$1" $(pwd) awk echo "$1" "$1" ${HOME} 'quoted text'
+		2>/dev/null ${HOME} x=1 2>/dev/null sed done test
+$(pwd) done "$@" -eu |
+	$(pwd) -eu | echo && test local 2>/dev/null printf 2>/dev/null /usr/bin test
+done export echo cd local
+x=1 echo test "$1" /usr/bin printf sed local ${HOME} --verbose printf
+		'quoted text' 2>/dev/null
+	test "$1" "$1" export printf
+		'quoted text' awk printf "$@" then "$@"
+	readonly cd "$@" readonly awk && /usr/bin
+		readonly "$@" cd awk 'quoted text' /usr/bin readonly then ${HOME} "$@"
+		awk cd --verbose export | ${HOME}
+2>/dev/null sed awk cd ${HOME} printf printf export
+		${HOME} readonly sed export echo cd sed 'quoted text'
+${HOME} then done done export /usr/bin
+'quoted text' awk --verbose
+then sed grep && then
+"$1" --verbose | export awk ${HOME} "$1" local grep grep /usr/bin awk -eu
+		grep cd then && printf grep export done test done test printf 2>/dev/null
+	--verbose printf local 2>/dev/null then awk "$@" ${HOME} ${HOME} ${HOME} && ${HOME}
+	2>/dev/null "$1" awk cd --verbose $(pwd) grep local then echo printf
+		-eu test ${HOME} /usr/bin done --verbose "$@" "$1" readonly awk awk
+	${HOME} cd x=1 --verbose -eu cd local $(pwd) readonly done ${HOME}
+		printf "$@" then /usr/bin | readonly echo "$@" |
+sed && printf local sed
+local $(pwd) 'quoted text' -eu then "$1" x=1 grep
+| --verbose sed ${HOME} "$1"
+then "$1" -eu && done --verbose sed
+		test x=1 then awk $(pwd) "$@" | grep --verbose "$1" then test -eu "$1" sed $(pwd)
+		--verbose test done cd readonly | | /usr/bin then test readonly && | "$1" "$1"
+	printf export sed | echo test
+		$(pwd) echo -eu -eu readonly export
+printf "$@" /usr/bin
+local 2>/dev/null test cd "$1" ${HOME} "$1" $(pwd) grep 2>/dev/null local
+		cd local "$1" ${HOME} printf "$1" awk
+		/usr/bin "$@" && 'quoted text' then /usr/bin test awk 2>/dev/null export then "$@"
+	echo -eu -eu grep -eu "$@" 'quoted text' grep readonly
+&& -eu done $(pwd) done local test then grep $(pwd) -eu && export "$1" sed
+$(pwd) grep --verbose x=1
+	x=1 awk export awk 'quoted text' "$@" ${HOME} sed "$1" cd test awk
+	${HOME} sed sed | echo test then 2>/dev/null | /usr/bin readonly
+printf && test -eu && readonly --verbose $(pwd) --verbose
+printf -eu "$1" done then local cd
+$(pwd) /usr/bin export
+	--verbose x=1 cd then -eu | sed local readonly export grep test echo sed printf
+		/usr/bin 'quoted text' -eu export sed | --verbose local -eu -eu grep echo "$1"
+	&& --verbose 'quoted text' 2>/dev/null 2>/dev/null echo local
+--verbose "$1" readonly grep -eu "$@" test && "$@"
+		test "$@" --verbose done grep test | "$1"
+done 2>/dev/null && | 'quoted text' done export "$@" sed then --verbose
+| /usr/bin 2>/dev/null grep local then readonly && 2>/dev/null then "$1"
+		'quoted text' awk then x=1 export awk
+	"$1" "$1" x=1 done "$@"
+		readonly readonly readonly grep "$@"
+		x=1 awk ${HOME} $(pwd)
+	printf sed sed printf /usr/bin awk cd $(pwd)
+		local awk $(pwd) 2>/dev/null readonly x=1 echo /usr/bin export /usr/bin sed &&
+grep 2>/dev/null test then ${HOME} then ${HOME} "$@" -eu export local
+		echo sed /usr/bin "$1" export 'quoted text' && --verbose ${HOME} readonly /usr/bin
+	cd readonly -eu local then echo done then done cd test readonly
+	done -eu x=1 /usr/bin cd
+done awk echo local then $(pwd) "$@" sed /usr/bin grep
+	sed --verbose --verbose done "$1" 2>/dev/null -eu $(pwd) export printf
+	/usr/bin grep export readonly printf
+		test echo "$1" $(pwd) --verbose export cd then
+		'quoted text' 'quoted text' awk awk cd /usr/bin
+		${HOME} echo "$1" readonly "$@" --verbose
+| -eu cd ${HOME} /usr/bin 2>/dev/null x=1
+		then --verbose readonly sed /usr/bin awk cd sed "$@" then ${HOME}
+	| printf "$1" $(pwd) readonly grep
+		awk ${HOME} $(pwd) ${HOME}
+		$(pwd) && /usr/bin printf export ${HOME} -eu "$@"
+		cd readonly grep $(pwd) 2>/dev/null x=1 grep local done && export echo
+		x=1 grep | 'quoted text' printf ${HOME}
+	printf "$@" x=1 echo /usr/bin 'quoted text' | printf "$1" x=1 && done echo "$1"
+cd x=1 then /usr/bin export -eu local
+local -eu x=1 printf export readonly done
+	readonly 2>/dev/null | done cd ${HOME} $(pwd) x=1 /usr/bin
+		"$1" "$@" "$1" 'quoted text'
+readonly "$1" readonly $(pwd) awk test sed
+	printf 'quoted text' | then done -eu
+	done $(pwd) sed | echo --verbose "$@" ${HOME} 'quoted text' local /usr/bin
+	sed "$1" && test /usr/bin sed then | test
+	/usr/bin /usr/bin readonly "$@" x=1 2>/dev/null printf /usr/bin echo -eu ${HOME}
+		/usr/bin | export echo cd readonly $(pwd)
+		then grep readonly then x=1 cd 'quoted text' local $(pwd)
+grep -eu 'quoted text' readonly 'quoted text' grep printf x=1 ${HOME}
+		export /usr/bin done test 2>/dev/null test
+	test && grep -eu local sed cd 2>/dev/null grep --verbose "$@"
+	awk then /usr/bin | echo 2>/dev/null --verbose && --verbose
+		cd --verbose sed "$1" then "$1"
+	| -eu | && awk && "$1" local cd ${HOME} ${HOME} then then grep
+	/usr/bin 2>/dev/null 2>/dev/null done "$1" --verbose echo sed
+		export test local done grep
+		then printf $(pwd) cd readonly ${HOME} -eu done
+		done 'quoted text' then 'quoted text' then /usr/bin test grep export -eu
+	${HOME} --verbose | printf ${HOME} --verbose
+		2>/dev/null test --verbose awk 2>/dev/null sed -eu sed -eu awk | awk 'quoted text'
+	test export local then ${HOME} awk x=1 then x=1 2>/dev/null x=1
+then awk export "$@" export awk readonly grep 'quoted text' then $(pwd)
+		-eu x=1 'quoted text' grep cd 'quoted text'
+		test x=1 awk --verbose ${HOME} done done "$@" readonly awk cd x=1 done readonly
+	| local -eu done cd export readonly sed && 2>/dev/null awk "$@" grep $(pwd)
+	2>/dev/null printf cd 2>/dev/null --verbose
+		local ${HOME} "$1" $(pwd) /usr/bin --verbose 2>/dev/null sed "$@" local sed test
+		done echo grep $(pwd) "$1" -eu grep then readonly
+	'quoted text' done readonly then done printf sed export "$1" cd test
+	done -eu ${HOME} | x=1 test $(pwd) "$@" /usr/bin then $(pwd)
+/usr/bin 2>/dev/null echo /usr/bin printf then printf grep "$1" | "$@"
+--verbose 2>/dev/null test -eu
+cd /usr/bin echo test 'quoted text' $(pwd) 2>/dev/null
+		local && && -eu test echo 2>/dev/null $(pwd) -eu local ${HOME} x=1 printf
+		&& ${HOME} && x=1 ${HOME} "$1"
+2>/dev/null "$@" | echo
+-eu awk "$1" 2>/dev/null "$@" awk 'quoted text'
+		${HOME} --verbose --verbose 2>/dev/null ${HOME} 2>/dev/null cd local 'quoted text'
+test && grep | x=1 'quoted text' done --verbose ${HOME} awk
+/usr/bin printf done printf && && ${HOME} | 'quoted text' printf sed
+cd done grep -eu /usr/bin printf
+		"$1" cd echo --verbose then
+	done then -eu readonly -eu $(pwd)
+		readonly && 'quoted text' export echo --verbose
+	'quoted text' 'quoted text' test local 'quoted text' "$1"
+		echo "$@" "$@" local | grep local export "$@" echo x=1
+		export sed x=1 2>/dev/null x=1
+	echo 'quoted text' | /usr/bin readonly &&
+		&& cd awk local local export 'quoted text' done
+		x=1 "$@" && readonly 'quoted text' cd then && && done
+done && $(pwd) "$1" printf local sed -eu echo
+$(pwd) /usr/bin done --verbose readonly
+	'quoted text' && cd printf "$1" --verbose
+		printf $(pwd) sed printf export $(pwd)
+$(pwd) echo 2>/dev/null ${HOME}
+	cd export "$1" cd sed echo 'quoted text' -eu $(pwd) 'quoted text'
+	grep | | readonly "$@" "$1" && echo
+		then test | "$@" cd sed x=1 $(pwd) printf | sed --verbose | 2>/dev/null printf
+	"$@" ${HOME} readonly export readonly local printf
+	test | | local local sed sed test "$1" awk ${HOME} awk
+	local done readonly "$1" | done | 2>/dev/null $(pwd)
+	| test awk grep 2>/dev/null 2>/dev/null 2>/dev/null readonly test awk then export
+	sed done x=1 x=1 then awk ${HOME} printf
+echo | test readonly && sed --verbose "$1" 2>/dev/null x=1 cd "$@" |
+	export "$@" printf ${HOME} cd sed awk -eu sed "$@" cd printf readonly awk
+	test sed 'quoted text' --verbose ${HOME} ${HOME} 'quoted text' grep ${HOME} test
+		readonly readonly printf
+/usr/bin cd echo "$1" local echo &&
+awk && test grep && $(pwd) printf ${HOME} echo echo cd "$1"
+		x=1 "$@" readonly sed awk "$1" $(pwd) x=1 printf "$@" /usr/bin sed
+		printf readonly sed 'quoted text' test cd awk echo -eu
+done -eu --verbose done --verbose
+		${HOME} export --verbose -eu 2>/dev/null then
+sed | | local grep && 'quoted text' ${HOME} sed awk cd | x=1 awk $(pwd) printf
+		readonly 2>/dev/null && $(pwd)
+	| -eu printf ${HOME} local awk
+	test grep done then local --verbose test "$@"
+&& test then "$1" && cd 2>/dev/null echo ${HOME} | then printf ${HOME}
+sed local /usr/bin export local /usr/bin
+	awk then test grep test cd 'quoted text'
+		-eu 'quoted text' grep export /usr/bin && $(pwd)
+	done $(pwd) then export then $(pwd) grep done
+/usr/bin echo "$@" -eu --verbose x=1 x=1 && grep awk --verbose
+		awk ${HOME} $(pwd) --verbose "$1" | $(pwd) readonly "$@" cd
+	| cd "$@" ${HOME} /usr/bin export
+/usr/bin 2>/dev/null export awk "$@" awk cd
+x=1 -eu echo test printf readonly "$@" --verbose -eu grep printf | --verbose
+&& then awk sed printf $(pwd) && && "$@" cd done | "$1" "$1" cd
+		test 2>/dev/null local --verbose test --verbose
+sed ${HOME} x=1 echo printf ${HOME} x=1 x=1 -eu 2>/dev/null
+echo "$@" "$@" grep then cd /usr/bin && -eu
+		--verbose -eu test done
+	${HOME} "$1" -eu $(pwd) cd $(pwd) $(pwd)
+		-eu -eu ${HOME} && x=1 done done local readonly 'quoted text'
+		"$1" then awk cd readonly
+	grep $(pwd) "$@" then -eu
+	cd 2>/dev/null readonly
+	2>/dev/null /usr/bin ${HOME} sed done -eu sed --verbose echo export echo
+"$@" echo readonly $(pwd) "$@" 'quoted text' readonly then
@@ -0,0 +1,2001 @@
+	"$1" "$@" sed sed printf "$@" test 'quoted text'
+		echo && 2>/dev/null ${HOME} echo readonly | readonly
+	-eu $(pwd) "$1" 2>/dev/null && $(pwd) -eu "$1" readonly -eu done
+		$(pwd) sed ${HOME} 2>/dev/null export 'quoted text' "$@"
+then export /usr/bin ${HOME} sed done 'quoted text' -eu export
+		sed ${HOME} awk "$@" -eu "$@"
+	done $(pwd) -eu /usr/bin then then cd 2>/dev/null
+	| echo sed local /usr/bin export cd export /usr/bin | readonly | readonly
+	sed export && printf x=1 && | awk sed
+	"$@" -eu sed "$@" && --verbose grep done awk grep
+x=1 "$@" cd "$@" -eu "$@" test readonly -eu /usr/bin export && x=1 | 'quoted text'
+-eu export 'quoted text' printf grep sed readonly printf printf grep
+	&& then && "$@" ${HOME} && 2>/dev/null grep done echo readonly test local |
+done sed local export ${HOME} sed awk test awk /usr/bin echo grep $(pwd) test echo
+"$1" echo -eu cd x=1 $(pwd) "$1" grep 2>/dev/null local done "$@" /usr/bin
+		test 2>/dev/null ${HOME} /usr/bin local export
+export sed printf readonly cd 2>/dev/null &&
+		cd export echo 2>/dev/null awk grep "$1" x=1 echo export
+printf grep local grep grep echo -eu done | x=1 echo grep
+		/usr/bin 'quoted text' sed done
+		grep echo readonly 'quoted text' 2>/dev/null export printf export done
+	$(pwd) sed printf -eu export local /usr/bin | readonly sed $(pwd)
+	/usr/bin readonly --verbose --verbose "$1" test /usr/bin
+		2>/dev/null && "$@" /usr/bin --verbose x=1 readonly printf
+2>/dev/null "$@" readonly --verbose && -eu test test "$1" ${HOME} | awk done
+		'quoted text' then $(pwd) 2>/dev/null --verbose grep
+		then ${HOME} export | | test $(pwd) sed printf
+/usr/bin $(pwd) $(pwd)
+sed /usr/bin done done $(pwd) /usr/bin
+		cd sed 2>/dev/null | |
+		readonly 'quoted text' "$1" readonly readonly | ${HOME} x=1 test local 'quoted text'
+readonly grep sed done cd && grep grep
+	grep export -eu awk | cd "$1" | test sed
+"$1" | then && 2>/dev/null sed "$@"
+	/usr/bin cd && ${HOME} test x=1 sed 2>/dev/null
+	"$1" export -eu printf echo local sed x=1 ${HOME} grep
+		/usr/bin local -eu ${HOME} --verbose done grep test test -eu grep sed -eu
+"$@" 2>/dev/null cd echo "$1" "$1" "$@" local awk $(pwd) "$@" $(pwd) cd
+	export "$@" --verbose export test sed ${HOME} grep 'quoted text' "$@"
+test awk -eu grep -eu readonly
+--verbose -eu $(pwd) "$@" export
+		cd test local then export done then grep local x=1 -eu && | echo echo sed ${HOME}
+local "$@" test "$@" ${HOME} x=1 && /usr/bin | | x=1 | done export 'quoted text'
+		&& ${HOME} "$@" sed -eu $(pwd)
+printf 2>/dev/null 2>/dev/null
+	cd "$1" local export local 2>/dev/null test -eu --verbose
+	readonly /usr/bin sed local $(pwd) printf test --verbose local awk
+	--verbose --verbose then 'quoted text' export
+readonly export test done awk done x=1 'quoted text'
+		done local 2>/dev/null --verbose echo readonly then local 'quoted text'
+	sed "$@" awk then then /usr/bin
+		printf && export /usr/bin
+	cd 'quoted text' echo && ${HOME} && /usr/bin |
+	echo printf x=1 "$1" done sed awk export | |
+	'quoted text' export x=1 awk -eu /usr/bin -eu grep awk grep local
+	--verbose printf then "$@" cd | test
+	/usr/bin -eu | sed -eu echo /usr/bin echo
+	"$@" test awk cd local printf "$1" x=1 readonly readonly
+		grep "$@" --verbose "$1" $(pwd) | done --verbose
+${HOME} then 'quoted text' cd cd awk --verbose && test --verbose /usr/bin
+awk && done then 2>/dev/null echo grep echo awk && -eu grep ${HOME} "$@"
+done "$1" grep && 2>/dev/null && grep | test --verbose then sed 2>/dev/null
+	'quoted text' /usr/bin "$1" local
+/usr/bin readonly done --verbose
+		then x=1 readonly test grep grep printf printf grep /usr/bin
+"$@" echo done echo | $(pwd)
+		echo sed && "$@" --verbose /usr/bin export
+		2>/dev/null x=1 /usr/bin x=1 local test test ${HOME} done $(pwd)
+cd | export 2>/dev/null 'quoted text' done printf "$@" export
+		| then awk printf -eu cd x=1 then readonly printf 2>/dev/null
+		then printf ${HOME} test
+		&& echo sed grep awk sed export x=1
+--verbose ${HOME} | awk readonly awk "$@" ${HOME} readonly | export |
+echo ${HOME} x=1 sed export cd "$@"
+	"$1" | $(pwd) "$1" -eu export ${HOME} --verbose sed && sed -eu cd /usr/bin
+		x=1 /usr/bin /usr/bin -eu | "$1" local | ${HOME} printf readonly grep
+		$(pwd) local -eu test test "$@" && --verbose && then cd done
+	grep cd export ${HOME} printf --verbose echo 2>/dev/null echo 2>/dev/null
+		grep echo --verbose printf &&
+		--verbose x=1 local 2>/dev/null
+		awk done ${HOME} sed sed 'quoted text' then x=1 -eu /usr/bin echo local &&
+	echo "$1" "$@" x=1 grep --verbose
+then ${HOME} /usr/bin && 2>/dev/null 2>/dev/null && 'quoted text' "$@"
+	${HOME} --verbose printf | $(pwd) export "$1" --verbose --verbose
+		test done "$1" | --verbose
+--verbose grep export cd ${HOME} readonly awk local "$@" cd && ${HOME}
+sed | printf export cd awk /usr/bin | x=1 -eu export | grep export $(pwd) "$1"
+done export $(pwd) "$1" local $(pwd) export "$1" cd /usr/bin
+	/usr/bin ${HOME} then sed sed awk test grep sed && test $(pwd)
+	--verbose $(pwd) x=1 'quoted text' awk echo x=1 printf echo
+		test local "$@" --verbose x=1 --verbose | cd export
+		"$1" -eu readonly 2>/dev/null -eu | --verbose --verbose
+	&& local 'quoted text' && | --verbose awk cd cd -eu
+local readonly --verbose export then readonly "$1" /usr/bin readonly
+done /usr/bin grep done x=1 readonly
+		--verbose --verbose --verbose ${HOME}
+then cd readonly done x=1 echo x=1
+		printf awk sed done echo ${HOME} x=1 /usr/bin awk "$1"
+	--verbose 2>/dev/null 2>/dev/null | sed done 2>/dev/null
+		local | done /usr/bin echo ${HOME} echo sed local cd /usr/bin
+x=1 "$1" readonly test | --verbose printf printf && grep test grep
+/usr/bin | grep echo "$1" echo "$@" 2>/dev/null
+		-eu cd "$1" -eu $(pwd) -eu x=1 --verbose local cd cd cd
+awk done $(pwd) x=1 ${HOME} local awk then --verbose 'quoted text'
+${HOME} "$@" sed echo printf /usr/bin | $(pwd) 2>/dev/null then "$1" done
+		local "$@" $(pwd) -eu readonly done cd |
+		| printf "$1" then --verbose && readonly x=1 cd echo -eu export then
+$(pwd) 2>/dev/null sed $(pwd) | grep | /usr/bin "$@" -eu && awk 'quoted text' printf
+	echo sed local printf | ${HOME} | local test readonly 'quoted text'
+| --verbose done --verbose echo "$@" printf $(pwd) | grep
+x=1 done test printf export -eu
+-eu local then -eu readonly export -eu ${HOME} |
+sed -eu --verbose 'quoted text' awk awk awk &&
+		cd $(pwd) cd sed export test done ${HOME} cd ${HOME} x=1 local "$@" x=1 echo
+	test cd /usr/bin printf 'quoted text' grep "$1" /usr/bin local "$1" export
+'quoted text' "$@" grep | "$@" ${HOME} 'quoted text'
+	echo then --verbose --verbose x=1 awk sed --verbose
+	export grep awk cd $(pwd) | awk $(pwd) readonly
+		--verbose sed test printf --verbose grep sed export
+	readonly grep && sed 'quoted text' 2>/dev/null then test "$1"
+	&& --verbose 2>/dev/null "$1" 2>/dev/null
+		export --verbose test done
+		printf x=1 export $(pwd) test
+		&& test cd done readonly export then "$@" cd then x=1 local awk
+	test then --verbose export
+	"$1" -eu export test ${HOME} $(pwd) done 2>/dev/null | "$1" $(pwd)
+	"$@" | && --verbose local cd
+"$@" "$@" --verbose done cd x=1
+		echo then readonly done local | readonly export
+	export $(pwd) x=1 x=1 -eu -eu
+${HOME} then readonly /usr/bin done readonly done
+	"$@" done 'quoted text' "$1" 2>/dev/null | export | "$1" export grep cd
+--verbose awk then local awk cd awk && ${HOME} local test
+		then -eu done --verbose sed 'quoted text' /usr/bin | sed
+		$(pwd) test awk ${HOME} 'quoted text' | done cd test "$1" sed "$1" ${HOME}
+printf -eu awk "$1" /usr/bin local
+		$(pwd) ${HOME} && | grep && grep x=1 --verbose /usr/bin test /usr/bin export x=1
+	"$1" ${HOME} local && /usr/bin then cd ${HOME} 'quoted text'
+	done sed --verbose 'quoted text' ${HOME} awk 2>/dev/null
+		export cd test && 2>/dev/null
+		"$1" test x=1 sed "$1" done export $(pwd) sed export sed done "$1" sed x=1
+	awk readonly cd cd /usr/bin local
+		sed printf x=1 $(pwd) then local 'quoted text'
+${HOME} "$@" sed readonly export && then |
+	| printf cd readonly cd "$1"
+	done "$1" ${HOME} sed 'quoted text'
+export --verbose grep | local --verbose
+x=1 --verbose /usr/bin ${HOME} awk awk cd readonly
+	then "$@" readonly done echo grep readonly | export /usr/bin local | test then
+x=1 --verbose export
+$(pwd) printf readonly echo cd x=1 test "$1" -eu test &&
+cd export cd "$1" export "$1" $(pwd) "$1" export
+	local test export test 'quoted text'
+		test x=1 printf test awk $(pwd) ${HOME} ${HOME}
+		$(pwd) readonly test "$@" "$1" sed | grep ${HOME}
+	readonly $(pwd) export cd sed printf /usr/bin local 'quoted text' export
+		sed "$@" -eu && sed 2>/dev/null
+	"$@" | ${HOME} export --verbose cd -eu then sed done readonly printf
+	"$1" printf -eu then sed --verbose | ${HOME} &&
+	echo "$@" 'quoted text'
+		awk | -eu --verbose $(pwd) "$@" local local done | grep test
+		$(pwd) awk "$1" 'quoted text'
+		"$1" 2>/dev/null local export then sed "$@" 'quoted text' sed "$@"
+		-eu awk $(pwd) -eu then | local $(pwd) 'quoted text'
+	local done $(pwd) printf "$@" /usr/bin | printf
+		-eu sed awk grep $(pwd) ${HOME} && cd cd 2>/dev/null $(pwd)
+	grep 2>/dev/null local 2>/dev/null 2>/dev/null && "$@" done test |
+		'quoted text' done then grep 2>/dev/null test "$@"
+test ${HOME} "$@" "$@"
+	local 'quoted text' grep sed readonly cd cd cd export 2>/dev/null echo "$1"
+	export x=1 test "$1" ${HOME} awk export /usr/bin printf
+		2>/dev/null ${HOME} && | && ${HOME} "$1" "$1" | sed export cd printf --verbose
+echo "$1" 2>/dev/null export readonly /usr/bin
+	${HOME} echo $(pwd) done then "$1" then then && /usr/bin "$@" awk 'quoted text'
+		export x=1 2>/dev/null cd export
+2>/dev/null ${HOME} test export /usr/bin /usr/bin "$@"
+${HOME} readonly cd test | -eu export /usr/bin $(pwd) 'quoted text' 2>/dev/null
+	"$@" printf then test ${HOME} 2>/dev/null awk
+local && test echo printf 'quoted text'
+	readonly done -eu | cd local test then x=1 test cd done "$@" &&
+		| 'quoted text' --verbose 2>/dev/null "$1"
+		export "$1" done done | 'quoted text' test /usr/bin export export -eu
+	x=1 ${HOME} x=1 2>/dev/null
+	done export test echo then echo /usr/bin
+		then readonly $(pwd) export local && done cd done --verbose
+x=1 'quoted text' "$@" x=1 | "$@" && readonly
+done && 2>/dev/null "$1" readonly
+"$@" 'quoted text' printf
+		export grep ${HOME} test | printf "$1"
+		then awk echo "$@" 2>/dev/null --verbose
+done "$@" echo 2>/dev/null readonly test export grep sed sed grep then local
+	2>/dev/null ${HOME} grep ${HOME}
+		$(pwd) readonly "$1" sed printf /usr/bin 'quoted text' /usr/bin then sed "$@"
+${HOME} printf printf -eu printf --verbose
+done x=1 done -eu --verbose ${HOME} printf
+	&& -eu 'quoted text' $(pwd) cd then done
+echo 'quoted text' ${HOME} echo awk echo echo then | --verbose 'quoted text'
+sed ${HOME} sed ${HOME}
+		"$@" --verbose then --verbose x=1 cd echo --verbose
+	$(pwd) done 2>/dev/null 2>/dev/null test readonly sed awk /usr/bin
+		${HOME} ${HOME} | -eu --verbose --verbose
+		| cd $(pwd) printf printf "$1" sed test
+	x=1 test "$1" grep $(pwd) ${HOME} local echo awk cd done | printf
+		&& -eu sed 2>/dev/null then done --verbose --verbose $(pwd) "$1" then
+	'quoted text' && then 'quoted text' 'quoted text' "$1" x=1 x=1
+		'quoted text' -eu 'quoted text' -eu export "$1" local then test "$@"
+		sed export 2>/dev/null --verbose "$1" x=1 done 2>/dev/null --verbose "$1" | "$1"
+	awk export grep "$@" ${HOME} grep test readonly "$@" --verbose printf && 2>/dev/null
+	readonly ${HOME} echo local $(pwd) export echo
+	cd && -eu export 'quoted text' x=1 "$1" awk x=1 --verbose then ${HOME}
+	local grep x=1 printf readonly
+		grep | 2>/dev/null | -eu x=1 readonly $(pwd)
+--verbose readonly export "$1"
+		export $(pwd) ${HOME} -eu test "$1" export done "$@" 2>/dev/null $(pwd)
+	&& -eu cd awk grep awk "$1" $(pwd) | | local
+	$(pwd) 'quoted text' done
+		&& then readonly "$@" grep grep test
+		"$@" 2>/dev/null printf echo 2>/dev/null then $(pwd) test test 2>/dev/null
+		$(pwd) /usr/bin | grep export "$@" /usr/bin test 2>/dev/null
+	cd cd then local ${HOME} then cd export cd
+	x=1 export awk x=1 test $(pwd) local -eu printf echo "$@"
+	&& export && readonly sed export $(pwd) sed --verbose | printf -eu sed
+		$(pwd) | $(pwd) test 2>/dev/null
+-eu echo awk && | readonly cd then awk grep awk then --verbose x=1
+sed cd readonly $(pwd) /usr/bin done
+	--verbose grep && then test done export grep x=1 grep
+$(pwd) 2>/dev/null "$@" test printf | done /usr/bin --verbose
+x=1 -eu export ${HOME} printf -eu done /usr/bin /usr/bin
+printf local && done local 'quoted text' then /usr/bin
+$(pwd) export && sed x=1 awk 2>/dev/null /usr/bin x=1
+		printf -eu -eu x=1 printf ${HOME} printf printf "$@"
+		--verbose grep readonly test printf cd export readonly 'quoted text' 'quoted text'
+	'quoted text' echo export printf printf
+| "$1" $(pwd) 'quoted text' -eu done 2>/dev/null
+	echo 2>/dev/null printf | then /usr/bin
+		export grep test -eu --verbose local grep printf done 'quoted text'
+test 2>/dev/null export export 2>/dev/null "$@" test
+"$@" 2>/dev/null sed 'quoted text' $(pwd) -eu
+		/usr/bin awk 2>/dev/null ${HOME} --verbose done && --verbose sed printf "$@" test
+		cd sed "$@" then 'quoted text' $(pwd)
+		-eu 'quoted text' --verbose grep 2>/dev/null
+"$@" "$@" awk printf 'quoted text' && -eu grep echo awk grep export $(pwd)
+done printf $(pwd) /usr/bin | awk local
+	done then awk local then "$@" "$@" awk 2>/dev/null | then grep --verbose
+		"$1" -eu readonly grep export 2>/dev/null local
+	export && sed /usr/bin then "$@" awk "$1" done $(pwd) echo readonly
+	--verbose "$1" x=1 && -eu local
+"$@" 2>/dev/null $(pwd) x=1 /usr/bin grep echo done "$@" 2>/dev/null
+		/usr/bin && awk grep ${HOME} cd test "$@" readonly -eu | echo cd 2>/dev/null
+grep awk printf printf local
+"$1" | x=1 echo echo local local && x=1 2>/dev/null "$1" local
+		done "$@" 2>/dev/null export readonly sed
+	readonly local grep export cd awk test ${HOME} 'quoted text' $(pwd)
+readonly 'quoted text' awk sed -eu local echo && "$1" grep cd readonly readonly
+then "$@" x=1 cd | done sed | export done $(pwd) test
+${HOME} --verbose "$1" $(pwd) | /usr/bin printf 2>/dev/null
+then 2>/dev/null /usr/bin --verbose -eu
+	2>/dev/null cd sed && printf readonly sed --verbose "$1" --verbose
+	-eu echo readonly grep then local && echo | test then sed --verbose test printf
+		cd | readonly printf 2>/dev/null sed sed
+awk cd cd cd ${HOME} && $(pwd) export cd test 2>/dev/null
+test then | /usr/bin && echo 'quoted text' --verbose
+export echo cd --verbose --verbose -eu --verbose sed
+	x=1 x=1 'quoted text' test ${HOME} -eu local grep $(pwd) echo printf
+&& local "$1" -eu export | x=1 -eu && 'quoted text' done ${HOME} sed
+test grep then --verbose export sed -eu
+${HOME} then cd ${HOME} /usr/bin
+		${HOME} | export 2>/dev/null --verbose
+		done then x=1 | printf echo --verbose 2>/dev/null then -eu "$@" local sed readonly
+	${HOME} 'quoted text' /usr/bin -eu then export "$@" && && | ${HOME}
+	readonly cd test cd $(pwd) printf echo grep "$@" readonly "$1" local export
+		-eu grep then awk export 'quoted text' export 2>/dev/null then readonly
+	sed 2>/dev/null "$@" "$@" test grep sed awk "$1" echo $(pwd) "$1" 'quoted text'
+		'quoted text' ${HOME} local local x=1 x=1 $(pwd) echo "$@"
+	then $(pwd) ${HOME} 2>/dev/null
+	&& sed --verbose grep test ${HOME}
+	sed echo -eu echo grep 'quoted text'
+		2>/dev/null ${HOME} 'quoted text' /usr/bin "$@" local 2>/dev/null -eu 2>/dev/null
+	--verbose readonly export
+		done local -eu echo $(pwd) $(pwd) done "$1"
+		awk cd "$1" printf echo | echo readonly readonly | | test "$@"
+awk 2>/dev/null | 'quoted text'
+		grep x=1 then | ${HOME} --verbose done "$@" x=1 'quoted text' x=1 | | grep export
+	| echo ${HOME} cd 2>/dev/null 2>/dev/null /usr/bin
+	"$@" test /usr/bin "$1" local cd readonly sed
+local done "$1" readonly && -eu awk $(pwd) awk test
+		&& test "$@" local echo local -eu sed && /usr/bin
+		grep | readonly --verbose
+done readonly test --verbose | readonly -eu readonly echo printf
+grep readonly echo cd x=1 export 'quoted text'
+&& done /usr/bin | echo printf echo ${HOME} sed
+		test 2>/dev/null -eu 2>/dev/null readonly x=1 readonly export "$@" &&
+		sed "$1" cd done "$@" export cd x=1 -eu ${HOME} -eu echo
+test $(pwd) readonly x=1 sed printf
+	/usr/bin sed done test grep 2>/dev/null printf done cd echo x=1
+export grep test "$@" done awk done sed grep then local $(pwd) /usr/bin
+		-eu local ${HOME} echo echo awk awk | then local ${HOME} sed "$1" awk echo grep
+'quoted text' then 'quoted text' awk 2>/dev/null printf export $(pwd)
+		export sed | "$1" x=1 printf printf x=1 test
+	export | "$1" local readonly "$@" $(pwd) 'quoted text'
+	grep ${HOME} "$1" x=1 echo sed test 'quoted text' x=1 -eu readonly
+		printf echo && && export -eu
+	test 2>/dev/null -eu --verbose
+"$@" printf test | /usr/bin done /usr/bin --verbose 2>/dev/null --verbose
+readonly done readonly export
+		test test && -eu then export ${HOME} printf && then |
+	-eu awk | 'quoted text' grep x=1 'quoted text'
+	&& done /usr/bin -eu x=1 grep done /usr/bin ${HOME}
+	| readonly | --verbose awk echo 'quoted text' x=1 readonly $(pwd)
+	readonly ${HOME} readonly cd 'quoted text'
+		grep "$1" "$@" then -eu local export echo "$1" 2>/dev/null printf grep 'quoted text'
+	test $(pwd) | /usr/bin test -eu export ${HOME} done
+		| then --verbose cd done sed "$1" done echo sed test export awk /usr/bin
+	export local -eu 'quoted text' local x=1
+then --verbose sed grep export "$1"
+local test $(pwd) $(pwd) then $(pwd) 2>/dev/null
+	readonly done cd 'quoted text' export local sed done
+"$1" local /usr/bin cd ${HOME} /usr/bin "$1" 'quoted text' cd
+		&& --verbose | cd readonly "$@" /usr/bin ${HOME} done cd ${HOME}
+'quoted text' | cd /usr/bin readonly | cd export "$@" "$1" test
+	$(pwd) -eu ${HOME} echo grep && 'quoted text' readonly
+		"$1" ${HOME} ${HOME} && && $(pwd) grep grep x=1 'quoted text'
+		done readonly echo test cd export test "$1" grep echo readonly "$@" echo
+		| grep && x=1 printf $(pwd) 'quoted text' x=1 grep "$@" ${HOME}
+"$1" --verbose sed 2>/dev/null --verbose
+echo echo export sed sed awk export local
+		done 2>/dev/null readonly | sed | ${HOME} grep
+done x=1 awk "$1" x=1 -eu grep "$1" -eu ${HOME} | cd $(pwd)
+		then done -eu done | $(pwd) && --verbose 2>/dev/null
+		'quoted text' awk readonly awk 2>/dev/null | sed "$1" local $(pwd)
+	test awk x=1 echo --verbose printf 'quoted text'
+'quoted text' | x=1 /usr/bin awk /usr/bin "$@"
+		local readonly then --verbose --verbose then && && awk
+		done && $(pwd) sed then -eu local -eu | ${HOME} ${HOME} awk awk export --verbose
+| ${HOME} -eu export echo echo sed | test cd echo --verbose
+	test readonly --verbose echo --verbose -eu readonly done
+		| x=1 'quoted text' printf test | echo && sed cd
+	echo printf x=1 then readonly -eu printf echo export /usr/bin done
+echo echo -eu ${HOME} $(pwd) "$1" awk readonly printf &&
+	awk 'quoted text' export cd -eu readonly | | "$@" done grep awk cd done /usr/bin
+	"$1" 2>/dev/null readonly /usr/bin && /usr/bin
+	-eu echo "$1" /usr/bin x=1 --verbose $(pwd) | sed $(pwd) 'quoted text' --verbose
+		| test ${HOME} echo cd
+echo "$@" | "$@" echo local local
+	'quoted text' done 2>/dev/null 'quoted text'
+		sed ${HOME} done --verbose 2>/dev/null 2>/dev/null -eu cd grep 'quoted text'
+&& 2>/dev/null && | -eu echo x=1 && -eu "$@"
+	&& /usr/bin test printf 2>/dev/null grep 'quoted text' local echo printf
+local /usr/bin local awk sed done
+| grep awk $(pwd) 'quoted text' sed
+		then /usr/bin sed "$1" $(pwd) && awk
+		cd "$@" 2>/dev/null local
+		'quoted text' readonly "$1" $(pwd) cd | "$1" echo sed grep
+	/usr/bin echo sed "$@" "$1" sed local grep /usr/bin ${HOME} ${HOME} x=1 printf
+2>/dev/null local -eu | ${HOME}
+'quoted text' 'quoted text'
+export printf && -eu echo ${HOME} local test printf ${HOME} x=1 export then echo
+then done test $(pwd) cd local then export --verbose grep echo && sed
+	grep -eu cd local ${HOME} grep | 'quoted text'
+&& test /usr/bin ${HOME} ${HOME} $(pwd) done 2>/dev/null
+"$@" 'quoted text' 'quoted text' readonly sed "$1" && done
+--verbose sed x=1 readonly 2>/dev/null "$@"
+		$(pwd) ${HOME} local -eu export --verbose -eu -eu cd
+	x=1 --verbose test sed $(pwd) "$@" "$@" 2>/dev/null then "$1" local
+		${HOME} $(pwd) && readonly sed sed test printf grep /usr/bin ${HOME}
+		sed --verbose done readonly --verbose -eu cd sed "$@"
+		echo x=1 | export /usr/bin --verbose -eu echo
+--verbose echo /usr/bin /usr/bin | then test grep
+		then x=1 test echo printf /usr/bin grep export
+	cd $(pwd) test $(pwd) 2>/dev/null 2>/dev/null ${HOME} done done echo
+/usr/bin printf grep "$@" $(pwd) | "$1" cd
+		${HOME} awk $(pwd) sed done "$1" /usr/bin awk ${HOME}
+		"$@" 2>/dev/null then
+${HOME} ${HOME} printf sed cd grep -eu && export cd readonly --verbose
+		sed -eu ${HOME} --verbose -eu -eu /usr/bin | cd -eu "$1" x=1
+		grep -eu printf "$1" awk local test awk test 2>/dev/null readonly
+		test echo local cd printf x=1 | sed done readonly
+-eu sed readonly test cd export awk 'quoted text' export awk $(pwd) -eu $(pwd)
+		echo "$@" "$@" && echo sed "$@" echo export then && --verbose
+	sed readonly readonly local readonly ${HOME} | -eu printf grep
+		cd -eu | local | sed && export then then sed -eu grep && test
+"$1" done 'quoted text' local && then "$1" /usr/bin $(pwd) x=1 echo /usr/bin
+test -eu ${HOME} export x=1 "$1" sed "$1" sed -eu
+		--verbose 'quoted text' && 2>/dev/null ${HOME} && ${HOME}
+	test x=1 awk readonly readonly test | -eu grep
+"$1" /usr/bin sed test $(pwd) printf | 2>/dev/null
+	$(pwd) echo grep test --verbose export cd done grep
+	then readonly $(pwd) grep readonly
+	--verbose 'quoted text' "$1" grep grep readonly /usr/bin
+	$(pwd) ${HOME} echo --verbose printf echo x=1
+/usr/bin local 'quoted text'
+		| /usr/bin readonly export /usr/bin then /usr/bin
+awk readonly $(pwd) x=1 "$1" ${HOME} local local
+x=1 readonly "$1" --verbose -eu done
+		then sed echo export echo /usr/bin
+	done | $(pwd) printf "$@" x=1 $(pwd)
+'quoted text' export && &&
+x=1 test done x=1 echo -eu awk printf done /usr/bin
+	"$@" --verbose 2>/dev/null export && "$@" "$@" /usr/bin 'quoted text' local test
+	done done sed done sed local -eu readonly | 'quoted text' x=1 "$1" done echo
+		test "$1" x=1 "$1" | sed export --verbose $(pwd) test export
+	test done export && "$1" /usr/bin printf "$1" --verbose sed cd "$@"
+then x=1 --verbose sed --verbose "$@" awk x=1 echo "$1" then readonly
+		readonly export sed "$1" "$@" 'quoted text' "$1" $(pwd) printf /usr/bin x=1 /usr/bin
+		printf readonly done "$1" echo "$@" "$1" sed printf &&
+	echo test awk echo $(pwd) && done x=1 $(pwd) /usr/bin
+		cd local "$1" "$@" "$1" --verbose printf
+echo x=1 readonly readonly 2>/dev/null
+		"$1" export printf done 'quoted text' then cd echo "$1" local
+	-eu "$@" printf --verbose --verbose printf /usr/bin done
+echo echo readonly x=1 --verbose grep test
+| --verbose -eu sed then sed ${HOME} awk "$@" | echo x=1 then
+		grep grep grep readonly /usr/bin test $(pwd)
+'quoted text' x=1 cd "$1" sed sed 'quoted text' readonly test readonly local
+sed 2>/dev/null awk printf then grep x=1 2>/dev/null
+export 2>/dev/null $(pwd) cd /usr/bin readonly
+&& 2>/dev/null local sed
+-eu test -eu test /usr/bin | "$@" $(pwd) awk echo echo x=1
+--verbose test 2>/dev/null -eu grep awk cd "$1"
+		grep "$1" --verbose $(pwd) cd ${HOME} printf
+sed printf export local readonly "$@" local && grep cd test
+awk done test /usr/bin echo readonly awk 'quoted text' sed test
+export && 2>/dev/null test ${HOME}
+		awk readonly ${HOME} printf awk
+awk export readonly echo cd echo echo ${HOME} then -eu | cd | && readonly
+	done ${HOME} && | done "$1" echo echo readonly readonly done "$1" grep &&
+		'quoted text' $(pwd) --verbose awk 2>/dev/null
+		--verbose 'quoted text' export test grep /usr/bin -eu
+	grep grep x=1 -eu echo printf echo 2>/dev/null export awk readonly
+then cd sed && awk awk test cd ${HOME} /usr/bin 2>/dev/null
+		'quoted text' test sed x=1 -eu /usr/bin awk printf then /usr/bin x=1
+-eu test | "$@" sed 2>/dev/null -eu 'quoted text' awk export export export
+x=1 printf echo /usr/bin local 'quoted text' done done "$@"
+		"$1" "$@" cd echo --verbose 'quoted text' -eu local /usr/bin export && $(pwd)
+	2>/dev/null /usr/bin "$@" local ${HOME} /usr/bin
+test printf readonly test awk printf
+cd ${HOME} "$1" local && x=1 sed local awk $(pwd) grep 2>/dev/null
+		awk export -eu then $(pwd) grep local "$@" $(pwd) x=1 printf "$1" --verbose
+sed readonly readonly local x=1 local echo ${HOME} 2>/dev/null
+	done 'quoted text' --verbose "$@" /usr/bin
+		done sed ${HOME} then --verbose /usr/bin 2>/dev/null
+	done "$@" done test test $(pwd) "$1" sed /usr/bin
+	"$1" x=1 && x=1 test printf local --verbose
+	"$@" "$@" -eu $(pwd)
+	grep x=1 printf x=1 echo && sed "$1" $(pwd)
+	--verbose 'quoted text' "$1" 'quoted text'
+		"$@" /usr/bin --verbose grep done ${HOME} done x=1 then "$@"
+	echo ${HOME} awk echo --verbose ${HOME} then test readonly sed test
+/usr/bin -eu 2>/dev/null awk -eu x=1 'quoted text' printf "$@"
+	| cd -eu "$@" echo ${HOME}
+		$(pwd) 2>/dev/null ${HOME} -eu | -eu done $(pwd) /usr/bin ${HOME}
+cd echo 2>/dev/null 'quoted text' | cd local
+		then done ${HOME} $(pwd) grep ${HOME} grep readonly --verbose /usr/bin
+	"$@" export $(pwd) -eu "$@" --verbose -eu local && | && local test 2>/dev/null
+readonly ${HOME} cd ${HOME} done -eu --verbose /usr/bin
+awk cd "$1" done then awk test | done && ${HOME} export
+		'quoted text' then 2>/dev/null $(pwd) local cd $(pwd) -eu printf |
+	export 'quoted text' 2>/dev/null "$1" -eu local done
+awk then $(pwd) cd grep | "$@" -eu "$@" done /usr/bin cd "$@" local cd
+	x=1 "$@" then "$@" 2>/dev/null -eu /usr/bin
+		--verbose cd 'quoted text' sed printf x=1 'quoted text'
+grep -eu -eu "$1" --verbose /usr/bin
+		cd "$@" | test /usr/bin cd x=1 local export "$@" then 2>/dev/null
+	${HOME} done printf ${HOME} printf --verbose -eu | done
+-eu | x=1 awk $(pwd) && 'quoted text'
+		readonly readonly ${HOME} ${HOME} --verbose grep grep
+'quoted text' x=1 awk --verbose 'quoted text' | 2>/dev/null $(pwd) test ${HOME}
+	test readonly | test 'quoted text' awk grep cd --verbose /usr/bin "$1"
+	$(pwd) 'quoted text' done /usr/bin cd echo local
+		| 'quoted text' ${HOME} 2>/dev/null test local "$1" x=1 -eu "$@" test readonly
+	"$@" sed ${HOME} x=1 2>/dev/null then grep --verbose echo
+	cd "$1" && export local | then readonly "$@" export
+		${HOME} "$@" 2>/dev/null export "$@" -eu -eu 'quoted text' cd
+"$@" grep test readonly sed | printf done
+	2>/dev/null $(pwd) readonly export awk printf readonly then grep
+		readonly "$1" awk | 'quoted text' echo awk --verbose
+	then printf echo grep | sed "$1"
+		then awk 2>/dev/null printf test 2>/dev/null echo
+readonly done | | | 2>/dev/null
+sed --verbose readonly
+		export test "$1" readonly 'quoted text'
+	--verbose ${HOME} 2>/dev/null awk 2>/dev/null /usr/bin readonly -eu $(pwd) --verbose
+	echo $(pwd) x=1 sed 2>/dev/null 'quoted text' grep
+	cd cd sed test ${HOME} $(pwd)
+--verbose export /usr/bin && -eu $(pwd)
+		echo -eu -eu done && --verbose test /usr/bin sed $(pwd) echo local local
+		-eu && $(pwd) | "$@" grep sed local
+test --verbose 2>/dev/null local then /usr/bin "$1" && then 'quoted text'
+grep /usr/bin awk then $(pwd) cd && -eu
+awk 'quoted text' 'quoted text' | ${HOME} x=1 cd grep
+echo cd $(pwd) sed done && export test cd x=1 grep echo
+| sed local | printf readonly "$1" && x=1 2>/dev/null --verbose test echo
+	&& done 'quoted text' test grep printf local readonly $(pwd) ${HOME}
+	readonly export then -eu awk local "$1" sed 2>/dev/null echo then awk 'quoted text'
+		"$@" readonly cd readonly done
+--verbose x=1 && then -eu --verbose
+done -eu readonly x=1 done "$1" test grep && local 'quoted text' grep done
+printf "$@" ${HOME} -eu test export --verbose local -eu x=1 export test "$1" -eu
+		echo -eu awk 2>/dev/null 2>/dev/null --verbose export awk
+	--verbose $(pwd) grep && export export readonly test && /usr/bin
+"$@" x=1 done --verbose --verbose printf done
+echo then then sed printf
+	awk && "$@" /usr/bin "$@" --verbose
+	-eu /usr/bin x=1 --verbose "$@" then 'quoted text' "$1" local printf test done
+		${HOME} -eu cd "$1" ${HOME} -eu grep $(pwd) printf -eu printf
+		sed local awk ${HOME} ${HOME}
+echo $(pwd) 'quoted text'
+	done "$@" export "$1" printf done then then readonly awk test ${HOME}
+		"$@" x=1 && | --verbose export --verbose
+		$(pwd) 2>/dev/null sed readonly
+		$(pwd) | printf sed done 2>/dev/null ${HOME}
+	awk export sed readonly /usr/bin
+	sed x=1 done echo sed "$@" export --verbose sed then export cd && "$1" printf
+		awk "$1" sed --verbose 'quoted text' printf
+--verbose "$@" "$1" readonly
+awk sed done 'quoted text' cd echo
+	&& $(pwd) $(pwd) readonly then "$1" echo cd /usr/bin /usr/bin
+	readonly printf test "$1" 'quoted text' sed done
+		x=1 cd --verbose 'quoted text' ${HOME} 'quoted text' export | then -eu
+	| $(pwd) awk local 2>/dev/null ${HOME} "$1" printf cd 'quoted text' grep
+	&& 2>/dev/null /usr/bin printf 2>/dev/null
+"$1" -eu $(pwd) 2>/dev/null 2>/dev/null done /usr/bin
+		'quoted text' 2>/dev/null ${HOME}
+	readonly x=1 sed x=1 "$@"
+	grep then "$1" export awk | readonly | local "$1" --verbose "$@" && "$@" && 'quoted text'
+	| export readonly "$1" sed readonly --verbose "$1" printf x=1 /usr/bin x=1 x=1
+	${HOME} test sed then
+		'quoted text' export --verbose printf grep | ${HOME}
+awk $(pwd) /usr/bin sed /usr/bin sed --verbose | awk echo test ${HOME}
+${HOME} printf cd awk printf $(pwd) readonly "$@" "$1" /usr/bin local ${HOME}
+-eu 'quoted text' done 2>/dev/null && awk awk x=1
+		done done -eu readonly awk -eu local readonly /usr/bin done
+		2>/dev/null echo ${HOME} "$1" | echo -eu 'quoted text' "$@" test x=1 ${HOME}
+		done | then readonly test sed && grep
+	export 'quoted text' | 2>/dev/null --verbose sed echo "$@"
+	readonly "$1" $(pwd) x=1 sed 2>/dev/null 2>/dev/null done sed "$@" grep awk
+	cd printf && "$@" readonly -eu |
+echo /usr/bin test sed printf 'quoted text'
+${HOME} done ${HOME} awk -eu $(pwd) export export grep
+		| && echo echo ${HOME} local local -eu sed x=1 2>/dev/null -eu export x=1
+	"$1" ${HOME} awk ${HOME} sed -eu then echo ${HOME}
+		${HOME} readonly test "$1" 'quoted text'
+		"$@" 2>/dev/null awk echo done && then "$@" "$1" -eu cd awk grep sed readonly &&
+${HOME} /usr/bin ${HOME} test
+		printf "$1" then 2>/dev/null echo local x=1 done
+		2>/dev/null grep local test export grep 2>/dev/null grep export printf grep sed
+		echo awk && grep -eu printf
+		--verbose sed && /usr/bin cd -eu x=1 ${HOME}
+	$(pwd) awk x=1 2>/dev/null --verbose --verbose | ${HOME}
+		readonly | awk printf "$1"
+		readonly cd 2>/dev/null export
+		x=1 echo ${HOME} x=1 2>/dev/null local then ${HOME} $(pwd) sed grep
+echo "$@" ${HOME} --verbose && | --verbose ${HOME}
+	grep done echo 2>/dev/null ${HOME} --verbose -eu &&
+	local export "$1" readonly -eu sed readonly && | 2>/dev/null awk "$@" then printf
+	"$@" echo "$@" awk /usr/bin grep --verbose export then "$1"
+sed && ${HOME} | $(pwd) awk x=1 $(pwd) x=1 sed grep | done export "$@" 2>/dev/null
+	export 'quoted text' export
+export --verbose "$@" grep "$1" done "$@" test readonly
+"$@" grep /usr/bin --verbose && "$@" -eu sed --verbose done ${HOME}
+	then ${HOME} sed $(pwd) | "$@" local
+	export $(pwd) 2>/dev/null cd x=1 local printf cd echo $(pwd)
+/usr/bin readonly --verbose $(pwd) | | grep 'quoted text' 'quoted text' test export
+	readonly awk --verbose test ${HOME} | 2>/dev/null $(pwd) --verbose --verbose
+	$(pwd) readonly then && awk export "$@" "$@" -eu -eu then
+$(pwd) $(pwd) local $(pwd) -eu export -eu
+		| 2>/dev/null "$@" $(pwd) echo ${HOME} then "$@" grep
+		readonly x=1 printf ${HOME} done done -eu
+local printf grep done -eu test sed
+&& x=1 export export printf
+		printf grep 2>/dev/null test grep x=1
+	$(pwd) "$1" $(pwd) 'quoted text' --verbose done
+/usr/bin sed grep /usr/bin --verbose readonly then local --verbose printf
+	&& --verbose grep export /usr/bin -eu 2>/dev/null readonly
+		${HOME} /usr/bin test ${HOME} echo -eu && "$@" ${HOME} 2>/dev/null "$1" then ${HOME}
+echo sed export cd ${HOME}
+	x=1 2>/dev/null x=1 export test grep awk then
+	2>/dev/null --verbose grep --verbose printf "$1" readonly test local 2>/dev/null
+	| 2>/dev/null -eu $(pwd) && awk 2>/dev/null readonly
+	local test test 2>/dev/null awk done echo $(pwd)
+		"$@" "$@" && 2>/dev/null x=1 echo test local
+		"$@" then "$@" | --verbose -eu 'quoted text' ${HOME} x=1 ${HOME} cd "$@" done &&
+	2>/dev/null printf | awk readonly cd sed && 'quoted text' 2>/dev/null
+then 2>/dev/null cd sed local
+		x=1 2>/dev/null 2>/dev/null cd then ${HOME}
+	&& export grep sed sed then printf local done local $(pwd)
+	cd $(pwd) x=1 'quoted text' grep
+/usr/bin export test printf test x=1 'quoted text' local "$1" readonly
+	local -eu $(pwd) | "$1" && && grep "$1" "$1" ${HOME} "$@" sed -eu 'quoted text'
+	--verbose export awk 2>/dev/null grep export --verbose
+'quoted text' test /usr/bin
+-eu local $(pwd) "$@" 'quoted text'
+		--verbose export local printf ${HOME}
+		"$@" awk --verbose 'quoted text' "$1" echo && 'quoted text' printf $(pwd) | ${HOME}
+"$@" done printf ${HOME} printf echo "$@"
+		echo done echo ${HOME}
+"$@" ${HOME} export cd then 2>/dev/null printf export awk "$@" export --verbose
+&& awk --verbose 'quoted text'
+		x=1 'quoted text' cd local --verbose local -eu awk --verbose
+		x=1 "$@" 2>/dev/null export echo
+		$(pwd) /usr/bin $(pwd) x=1 cd ${HOME} "$1" echo --verbose "$1" printf "$1" -eu
+		&& local ${HOME} then /usr/bin /usr/bin -eu x=1 cd echo --verbose awk
+	local /usr/bin done x=1 printf "$@" "$@" local /usr/bin
+	${HOME} "$@" cd export printf
+		| --verbose $(pwd) | ${HOME} printf
+		echo "$@" test then then cd $(pwd) readonly /usr/bin local 2>/dev/null printf
+-eu awk "$@" sed done
+		${HOME} cd x=1 "$@" then local -eu /usr/bin 'quoted text'
+done then x=1 cd then echo local 2>/dev/null
+		test "$@" grep sed ${HOME} /usr/bin "$1" ${HOME} export awk
+	printf && grep ${HOME} --verbose then cd export test /usr/bin
+	done && 2>/dev/null 'quoted text'
+		/usr/bin --verbose && printf printf
+readonly "$1" ${HOME} echo readonly local awk 2>/dev/null /usr/bin $(pwd)
+| x=1 "$1" && export /usr/bin awk export sed -eu x=1 && echo
+	cd 2>/dev/null | done cd export /usr/bin cd 2>/dev/null /usr/bin
+x=1 "$@" export export
+/usr/bin export done cd test "$1" 'quoted text' && /usr/bin $(pwd) --verbose
+"$@" "$1" x=1 | sed sed 'quoted text'
+		sed cd sed 'quoted text' printf "$@"
+sed 'quoted text' test /usr/bin && sed "$1" awk "$@" x=1 && sed done && cd
+readonly /usr/bin sed sed && 'quoted text' --verbose 2>/dev/null
+		x=1 $(pwd) grep printf "$@" grep grep 'quoted text'
+x=1 ${HOME} /usr/bin local then -eu
+		"$1" test echo "$1" awk then "$@" -eu readonly && "$@" $(pwd) 2>/dev/null
+${HOME} export echo printf | printf "$1" sed local | -eu x=1
+		printf awk $(pwd) "$@"
+test readonly 'quoted text' 'quoted text' ${HOME} printf local test awk
+	--verbose cd --verbose -eu | export done
+		test "$1" sed then export
+"$@" "$@" "$@" done grep grep --verbose /usr/bin grep done export echo $(pwd)
+$(pwd) then awk local awk 'quoted text' done -eu then
+-eu cd done cd local && echo export grep "$@" sed cd export cd -eu
+| grep x=1 export -eu sed awk sed cd local done /usr/bin
+	/usr/bin | x=1 then echo "$@" -eu 'quoted text' /usr/bin $(pwd)
+		"$1" readonly "$1" done $(pwd) cd cd 'quoted text' --verbose "$1" awk "$1"
+		'quoted text' x=1 | readonly x=1 local ${HOME} ${HOME} --verbose
+then grep awk "$@" $(pwd) "$1" -eu sed test
+		x=1 -eu cd 'quoted text' test --verbose grep
+	-eu /usr/bin printf "$@" readonly echo local cd && 'quoted text' ${HOME}
+	$(pwd) && --verbose "$1" 2>/dev/null local x=1 export echo x=1 done export cd
+$(pwd) awk $(pwd) export && sed cd awk sed /usr/bin
+	readonly echo awk printf "$1" $(pwd) printf
+${HOME} x=1 -eu 'quoted text' test -eu done && echo awk $(pwd)
+x=1 'quoted text' x=1 echo
+		"$@" $(pwd) sed sed awk readonly sed 'quoted text' cd
+		readonly && | -eu --verbose -eu readonly -eu done readonly "$@" -eu awk
+		"$@" printf | --verbose export readonly $(pwd) awk -eu awk &&
+done readonly printf cd --verbose export 2>/dev/null test --verbose
+	cd cd x=1 test sed echo local export cd then "$1"
+/usr/bin /usr/bin /usr/bin x=1 sed local readonly
+		$(pwd) local then x=1 local cd done readonly then done 'quoted text' awk
+	'quoted text' sed /usr/bin /usr/bin grep
+local "$1" grep test | | x=1 then echo
+then readonly "$1" /usr/bin
+		grep --verbose test --verbose printf sed export grep sed test
+then cd && "$@" "$1" test --verbose export
+		echo "$@" printf done local done 2>/dev/null readonly -eu echo
+		test done "$@" "$@" echo /usr/bin && x=1 test
+	${HOME} x=1 then x=1 && "$@" awk awk echo $(pwd) readonly
+	"$1" done awk 2>/dev/null /usr/bin 'quoted text' cd cd sed cd $(pwd)
+	/usr/bin 2>/dev/null awk ${HOME}
+	| /usr/bin awk "$1" cd grep
+'quoted text' x=1 2>/dev/null
+		local done sed cd export local /usr/bin ${HOME}
+		export test && done 'quoted text'
+	local $(pwd) "$@" readonly && sed local printf echo 'quoted text'
+		local | cd --verbose readonly /usr/bin ${HOME} 2>/dev/null
+		x=1 'quoted text' grep 2>/dev/null done 'quoted text'
+	echo sed | 'quoted text' local /usr/bin grep $(pwd)
+		-eu x=1 x=1 readonly x=1 done export
+then && export --verbose export cd x=1 printf "$@" echo
+"$1" grep grep -eu cd printf 2>/dev/null --verbose "$1" done
+	awk local awk readonly --verbose export | then sed readonly x=1 /usr/bin
+	$(pwd) x=1 | then ${HOME} && done awk readonly "$1" | ${HOME}
+	-eu && then x=1 readonly echo awk readonly
+		test test then cd x=1 ${HOME}
+done && "$@" "$@" | --verbose && $(pwd) cd done export echo --verbose
+test awk -eu ${HOME} then export
+		${HOME} | --verbose x=1 2>/dev/null "$@" awk local
+		&& echo 2>/dev/null $(pwd)
+${HOME} grep sed cd "$@" -eu -eu awk echo | sed "$1" cd cd cd
+awk test "$@" done local sed readonly
+${HOME} cd x=1 "$@" cd && printf "$1"
+| "$1" "$@" x=1 then grep 2>/dev/null "$1"
+"$1" ${HOME} test 'quoted text' $(pwd) test /usr/bin grep ${HOME} printf 'quoted text'
+		awk echo awk grep awk ${HOME}
+		| ${HOME} x=1 readonly | /usr/bin local
+	awk "$@" | | awk $(pwd) /usr/bin awk x=1 --verbose
+		done /usr/bin sed grep awk readonly | "$1" then readonly -eu local && "$@" test
+	grep grep -eu "$1" test $(pwd) && && "$1" echo printf x=1 awk x=1 $(pwd)
+	readonly export cd then local printf then
+		grep /usr/bin grep x=1 readonly
+test awk sed echo local "$1" /usr/bin sed 'quoted text' awk /usr/bin export awk
+		then ${HOME} local echo readonly /usr/bin -eu
+		-eu sed 'quoted text' $(pwd) "$1" -eu test 2>/dev/null
+"$@" | done then && printf export printf local awk
+	printf awk "$1" -eu "$1" readonly grep -eu then
+	readonly "$@" test sed export "$1" ${HOME} readonly printf x=1 ${HOME} "$1" readonly
+	x=1 grep x=1 | cd && grep $(pwd) "$1" "$1" | local x=1 'quoted text' && 'quoted text'
+-eu printf x=1 | echo awk -eu
+&& $(pwd) local sed then then | then
+		then $(pwd) x=1 -eu cd sed /usr/bin export
+	x=1 --verbose export export 2>/dev/null x=1 export
+	readonly $(pwd) && $(pwd) printf
+	export && then sed readonly test printf readonly done --verbose
+grep printf readonly $(pwd) cd awk | echo local "$@" $(pwd) awk | x=1 &&
+		"$1" readonly export | awk "$1" readonly /usr/bin -eu readonly done echo
+echo awk done awk "$1" echo |
+--verbose "$1" echo sed awk /usr/bin awk "$1" sed /usr/bin
+'quoted text' then "$@" sed x=1 printf done awk grep && local /usr/bin done | sed
+	then $(pwd) echo export
+		readonly then 'quoted text'
+		readonly "$@" grep echo -eu grep sed awk 'quoted text'
+		x=1 x=1 | then grep -eu | local printf x=1 test x=1 printf -eu /usr/bin $(pwd) "$@"
+&& && local awk "$@" echo grep
+	export "$@" /usr/bin cd $(pwd) local export export awk /usr/bin -eu printf $(pwd)
+	echo test export then awk /usr/bin cd | readonly printf printf /usr/bin
+	echo then --verbose ${HOME} ${HOME}
+	grep done x=1 2>/dev/null x=1 "$1" 'quoted text' export local -eu then "$@" --verbose
+echo 'quoted text' readonly printf sed x=1 --verbose then --verbose "$@" awk 'quoted text'
+		then && "$1" sed export | sed cd "$1" 'quoted text' "$@" /usr/bin
+	done sed done 'quoted text' | printf --verbose cd grep "$@" x=1 sed "$1" readonly
+	${HOME} echo readonly 2>/dev/null
+${HOME} "$@" readonly echo && && local "$1" 'quoted text' awk && echo echo
+	--verbose | cd $(pwd) x=1 x=1 readonly export "$@" -eu x=1 done
+$(pwd) 2>/dev/null "$@" ${HOME} /usr/bin test
+		--verbose 'quoted text' && x=1 -eu sed 2>/dev/null export
+	/usr/bin test done x=1 grep awk -eu && | echo echo export $(pwd)
+test /usr/bin then /usr/bin x=1 | -eu echo test
+		printf sed cd echo export "$1" then grep echo then done then test 'quoted text'
+then "$@" then grep sed "$@" 'quoted text' && test "$1"
+cd test local export then sed --verbose /usr/bin grep export $(pwd)
+	sed then 'quoted text' printf then awk --verbose 2>/dev/null
+	export then $(pwd) readonly done "$1" sed "$@" /usr/bin 'quoted text'
+done "$1" 2>/dev/null ${HOME} "$@"
+	--verbose "$@" cd --verbose "$@" done awk 'quoted text' sed export
+		$(pwd) test 'quoted text' 'quoted text' -eu export echo && 2>/dev/null "$@" grep
+2>/dev/null | done ${HOME} && --verbose cd then | sed test
+$(pwd) done ${HOME} printf && | cd then echo grep then "$@" then sed "$1" && grep
+${HOME} $(pwd) cd ${HOME} export
+	${HOME} grep readonly done sed $(pwd) cd ${HOME} 2>/dev/null readonly ${HOME}
+-eu "$@" $(pwd) /usr/bin /usr/bin awk | $(pwd)
+		x=1 printf grep $(pwd) "$1" echo ${HOME} |
+done cd 'quoted text' local "$@" sed 'quoted text' local "$@" && $(pwd) cd test
+"$1" readonly awk printf export 2>/dev/null test | export && $(pwd) local printf
+	/usr/bin 2>/dev/null /usr/bin export ${HOME} echo x=1 -eu /usr/bin 2>/dev/null echo
+		grep readonly cd 'quoted text' grep $(pwd) echo echo
+		cd sed "$@" test | ${HOME} awk grep local 2>/dev/null grep "$1" printf 2>/dev/null
+		"$1" -eu ${HOME} test 'quoted text'
+		2>/dev/null "$@" grep test readonly --verbose
+		done /usr/bin && "$1" cd ${HOME} cd "$@" 2>/dev/null 'quoted text' 2>/dev/null &&
+	x=1 && $(pwd) 'quoted text' 'quoted text'
+'quoted text' echo ${HOME} 'quoted text' && --verbose
+		-eu "$1" printf test $(pwd) $(pwd) "$@" && cd export readonly
+		${HOME} test readonly grep "$@" cd
+	cd $(pwd) printf $(pwd) test x=1 readonly local local
+	2>/dev/null export && readonly
+		'quoted text' grep --verbose && 'quoted text' awk printf
+	--verbose test --verbose --verbose
+		grep export "$@" "$@" -eu printf /usr/bin sed local --verbose
+	then done "$1" && awk done awk 2>/dev/null cd $(pwd)
+	sed 'quoted text' -eu awk | cd x=1 x=1 "$1" --verbose | local awk 'quoted text'
+sed | echo sed ${HOME} then /usr/bin done --verbose
+		grep export done export then test local echo cd then echo echo 'quoted text' /usr/bin
+		local printf echo cd x=1 ${HOME} 'quoted text' export "$1" awk
+-eu /usr/bin awk 2>/dev/null readonly
+		cd && | && echo | sed done "$@" readonly done && x=1 -eu printf
+$(pwd) sed 2>/dev/null cd $(pwd) done -eu printf "$1" sed 2>/dev/null cd printf
+--verbose "$@" && grep sed x=1 readonly
+/usr/bin 'quoted text' then then sed x=1 echo
+'quoted text' done /usr/bin readonly | /usr/bin test readonly /usr/bin
+		"$1" then readonly sed cd x=1 sed done
+		"$@" local then 'quoted text' test "$1" echo
+		'quoted text' 2>/dev/null "$@" grep "$@" | -eu "$@"
+&& "$1" then cd x=1 sed readonly "$1" 2>/dev/null
+$(pwd) test sed export ${HOME} "$@" |
+| "$@" echo | awk /usr/bin $(pwd) echo -eu
+awk 'quoted text' -eu &&
+		then export done && 'quoted text'
+	"$1" 'quoted text' printf x=1 printf test local "$@" grep ${HOME}
+	-eu -eu --verbose done x=1 grep 'quoted text'
+	cd cd x=1 ${HOME} --verbose done readonly 2>/dev/null
+		&& 2>/dev/null printf $(pwd) x=1 sed | then "$@" ${HOME} printf
+		'quoted text' $(pwd) local cd
+then "$@" echo ${HOME} readonly sed 2>/dev/null x=1 x=1 2>/dev/null
+x=1 $(pwd) ${HOME} cd then --verbose local -eu readonly 'quoted text'
+x=1 done "$@" /usr/bin "$@"
+	--verbose cd cd -eu cd $(pwd)
+| "$@" "$@" "$@" x=1 ${HOME} readonly
+	test done test "$@" --verbose 2>/dev/null -eu x=1
+	-eu grep grep then awk
+'quoted text' cd --verbose export readonly printf
+	echo $(pwd) then --verbose |
+		-eu "$1" x=1 "$1" awk "$@" test 2>/dev/null $(pwd) &&
+	2>/dev/null done /usr/bin export done 'quoted text' x=1 | 'quoted text' --verbose
+		printf sed | cd cd cd ${HOME} "$@"
+		awk -eu | local cd echo "$1" 2>/dev/null x=1
+		export $(pwd) "$1" x=1 2>/dev/null --verbose awk -eu && export | | "$@" "$@"
+		"$1" grep then local cd awk sed 2>/dev/null sed printf sed test $(pwd)
+		&& && ${HOME} 'quoted text'
+	local readonly echo sed grep grep
+"$@" grep awk 'quoted text'
+		sed ${HOME} 'quoted text' test ${HOME}
+		awk done local echo -eu 'quoted text' done -eu /usr/bin echo -eu done cd printf
+test "$@" ${HOME} "$@" awk $(pwd) awk -eu /usr/bin /usr/bin printf awk echo
+printf grep done local cd test awk readonly sed printf
+		/usr/bin local 2>/dev/null ${HOME} x=1 test grep x=1 $(pwd)
+		'quoted text' cd x=1 local test ${HOME} awk done done awk "$@" local then readonly
+	printf /usr/bin then cd
+	export cd cd echo "$@" done
+	printf "$@" x=1 readonly 2>/dev/null x=1
+'quoted text' && 'quoted text' cd sed echo --verbose printf local x=1 && printf
+		'quoted text' cd test 2>/dev/null readonly && test 'quoted text'
+		| awk sed awk echo done grep cd readonly ${HOME}
+		then 'quoted text' local done test printf && cd export "$1"
+		done ${HOME} local test test ${HOME} ${HOME} local && x=1 $(pwd)
+	"$@" local | then cd ${HOME} readonly then "$1" cd 2>/dev/null | sed
+	&& grep local /usr/bin -eu
+--verbose echo | awk 'quoted text' grep grep printf "$@" cd then readonly
+	${HOME} sed cd 'quoted text' grep x=1 printf /usr/bin readonly x=1 readonly test
+		$(pwd) export "$1" "$1"
+	'quoted text' 2>/dev/null ${HOME} echo export grep ${HOME} $(pwd) 2>/dev/null
+	2>/dev/null done x=1 /usr/bin test "$@" cd 'quoted text'
+	${HOME} test && printf test /usr/bin echo ${HOME} "$1" export
+	&& x=1 $(pwd) test && /usr/bin $(pwd)
+		awk done /usr/bin export then /usr/bin readonly $(pwd) then && local "$@" grep
+		cd 2>/dev/null done sed echo echo "$@" "$1" x=1 2>/dev/null
+		export -eu "$1" -eu export echo printf grep 'quoted text'
+	readonly --verbose printf local
+		2>/dev/null grep $(pwd) readonly x=1 $(pwd) test 2>/dev/null -eu local sed echo
+		readonly test echo "$1" --verbose sed 'quoted text' sed readonly
+sed 2>/dev/null grep readonly
+		test grep awk /usr/bin readonly $(pwd) 'quoted text' awk -eu -eu
+		local test awk local export then $(pwd) 'quoted text' export 2>/dev/null
+		grep echo 2>/dev/null 2>/dev/null 2>/dev/null
+printf x=1 sed 'quoted text' test
+	then 2>/dev/null "$1" $(pwd) done "$1" --verbose /usr/bin
+readonly done $(pwd) readonly 2>/dev/null
+	| export awk && printf sed readonly cd
+		/usr/bin && done -eu /usr/bin grep x=1 $(pwd) cd cd
+test -eu grep printf --verbose
+$(pwd) export 'quoted text' "$@" && awk /usr/bin $(pwd)
+	x=1 printf ${HOME} && echo --verbose done $(pwd) export awk -eu
+	x=1 readonly readonly 'quoted text' "$@" test --verbose
+${HOME} && export 2>/dev/null awk 2>/dev/null --verbose x=1 && -eu
+		echo -eu echo local ${HOME} "$1" local /usr/bin $(pwd) | "$1" then 2>/dev/null
+		2>/dev/null grep done printf sed
+		/usr/bin "$@" -eu -eu printf printf --verbose
+	grep readonly local 'quoted text' local $(pwd)
+	grep done test -eu x=1 printf "$@" printf awk "$@" then local then
+		cd then awk done -eu then
+grep awk export $(pwd) 'quoted text'
+sed /usr/bin then test sed done
+	| then printf $(pwd) done then echo test printf export
+	$(pwd) grep sed ${HOME}
+	${HOME} && x=1 sed $(pwd) then
+${HOME} $(pwd) ${HOME} | readonly sed 2>/dev/null
+	awk 'quoted text' cd sed
+-eu local awk printf test readonly /usr/bin readonly cd echo x=1 | then ${HOME}
+	| $(pwd) printf then local echo x=1 grep cd
+sed -eu test printf echo then sed -eu ${HOME} grep "$1" awk grep
+	/usr/bin | "$1" "$@" done x=1 echo test /usr/bin ${HOME} $(pwd) && ${HOME} sed grep
+		x=1 done | printf | "$@"
+grep readonly test "$@" local test grep local readonly cd 2>/dev/null export
+local $(pwd) test test export sed 2>/dev/null then cd
+&& 2>/dev/null 2>/dev/null -eu grep 2>/dev/null
+	"$@" done --verbose awk echo export done x=1 local --verbose | "$1" -eu --verbose
+--verbose ${HOME} done x=1 /usr/bin --verbose
+	readonly echo 2>/dev/null 2>/dev/null | local
+	test "$@" local /usr/bin ${HOME} local grep "$1" cd printf && readonly then
+| local done "$@" test grep export local | printf x=1 sed /usr/bin -eu $(pwd)
+	"$1" && --verbose x=1 grep
+&& test $(pwd) && "$@" | ${HOME} | x=1 $(pwd) test "$1" "$@"
+printf readonly then "$1" $(pwd) x=1
+2>/dev/null "$1" local /usr/bin
+	awk readonly --verbose "$@" awk 2>/dev/null 2>/dev/null
+		awk "$1" awk local "$@"
+		/usr/bin readonly test sed
+	"$@" /usr/bin echo x=1 export
+	grep 2>/dev/null done && sed cd ${HOME} ${HOME} awk x=1
+"$@" 'quoted text' -eu then done 'quoted text' done 'quoted text' && ${HOME} then
+		"$1" echo && --verbose export ${HOME} awk sed 'quoted text' test cd awk
+2>/dev/null export 'quoted text' awk then readonly grep printf "$1"
+		"$1" local local test -eu grep awk then && printf "$@" 2>/dev/null sed printf
+		grep $(pwd) ${HOME} /usr/bin local && printf readonly sed export
+		test then readonly printf /usr/bin $(pwd) 2>/dev/null
+		&& done -eu done done echo && export local echo ${HOME} "$@" 'quoted text'
+		printf awk ${HOME} "$@" && "$@" ${HOME} x=1 awk "$@" printf
+	then printf "$@" readonly test
+--verbose ${HOME} "$@" then then
+		2>/dev/null sed /usr/bin 2>/dev/null awk local "$@" cd
+	awk test export echo 2>/dev/null /usr/bin 'quoted text'
+then sed 'quoted text' /usr/bin local grep sed "$1"
+&& /usr/bin awk awk -eu ${HOME} test test done local readonly
+		local && | export /usr/bin printf export cd x=1 "$@" $(pwd)
+x=1 2>/dev/null "$@" readonly
+| cd 2>/dev/null export then /usr/bin
+$(pwd) then "$@" ${HOME}
+export printf && then | then awk sed --verbose 'quoted text' 'quoted text'
+-eu echo then local 2>/dev/null
+		grep export export "$@" && && "$1" 2>/dev/null
+	x=1 readonly cd readonly printf readonly | | export local -eu export /usr/bin
+		done 2>/dev/null readonly printf awk local test
+"$1" grep then grep ${HOME} then x=1 'quoted text'
+		x=1 echo && then local export ${HOME} grep "$1" "$@" printf x=1 export
+		awk local -eu /usr/bin 2>/dev/null printf 2>/dev/null cd x=1 && awk printf "$1"
+readonly grep test && test grep | -eu printf
+printf echo "$1" && cd test then "$1" then ${HOME} ${HOME}
+	cd $(pwd) 2>/dev/null 2>/dev/null
+	-eu --verbose done printf "$1" -eu 'quoted text' export && done | x=1
+| then /usr/bin readonly done
+	cd $(pwd) 'quoted text' sed ${HOME} 2>/dev/null 2>/dev/null
+	then $(pwd) -eu "$1" done done export $(pwd) 2>/dev/null
+done printf readonly grep grep /usr/bin grep test 2>/dev/null local printf &&
+	2>/dev/null echo test cd readonly then --verbose
+echo $(pwd) "$@" done awk && "$1" done cd "$@" $(pwd) && done grep --verbose
+test | sed 2>/dev/null cd -eu x=1 "$@" $(pwd) 2>/dev/null
+	grep local "$1" done sed "$1" /usr/bin test export test
+--verbose 'quoted text' | printf ${HOME} "$1" ${HOME} printf
+	'quoted text' local cd test done grep awk 2>/dev/null cd
+then awk x=1 echo test local
+		readonly local done grep echo ${HOME}
+	local awk readonly ${HOME} cd echo export test x=1 | -eu
+-eu awk grep awk then then readonly /usr/bin
+	--verbose /usr/bin "$@" grep --verbose then && then done /usr/bin
+	--verbose printf ${HOME}
+		"$@" readonly done done -eu ${HOME}
+		${HOME} readonly grep --verbose readonly test 'quoted text' printf export x=1
+	local awk --verbose -eu
+	sed 'quoted text' && grep x=1 printf 2>/dev/null && readonly
+	then 2>/dev/null ${HOME} test 'quoted text' | echo cd export
+cd /usr/bin "$1" 2>/dev/null
+	sed sed 'quoted text' export printf
+	test grep readonly "$1" printf
+		--verbose done | test echo grep done -eu -eu done
+		| cd x=1 "$1" | local local awk -eu 'quoted text' 2>/dev/null
+	/usr/bin export $(pwd) printf "$@"
+-eu readonly done ${HOME} ${HOME} "$@" "$1" cd 'quoted text'
+	readonly 'quoted text' test printf --verbose "$@" 2>/dev/null
+	&& 2>/dev/null "$1" awk ${HOME} done echo export local cd printf &&
+	| export cd $(pwd) readonly && done "$1" then 'quoted text' --verbose -eu
+		${HOME} grep x=1 done "$1" printf export printf "$@"
+	grep then awk done readonly grep 2>/dev/null
+	local readonly sed cd --verbose
+sed "$@" test sed ${HOME} grep readonly "$1" $(pwd)
+	export readonly echo $(pwd) x=1 'quoted text' awk readonly echo
+	2>/dev/null readonly cd readonly $(pwd) awk | "$1" | $(pwd)
+2>/dev/null printf ${HOME} ${HOME} | echo ${HOME} 'quoted text'
+		echo -eu "$@" $(pwd) then test 'quoted text' 2>/dev/null x=1 /usr/bin echo
+		cd "$@" printf then cd -eu cd done -eu /usr/bin cd
+"$@" sed echo readonly --verbose sed 'quoted text' echo x=1 x=1 2>/dev/null
+		cd echo --verbose 2>/dev/null export readonly
+		| 2>/dev/null x=1 ${HOME} x=1 echo awk
+	/usr/bin && local export printf done 2>/dev/null
+export "$1" printf test awk grep grep printf && "$1" | "$1" echo "$1" awk -eu
+-eu ${HOME} awk done | local then $(pwd) test local awk then |
+		${HOME} sed /usr/bin x=1 "$1" export x=1 "$1" $(pwd) -eu awk grep
+	/usr/bin export awk "$@" 2>/dev/null
+	2>/dev/null then awk 2>/dev/null cd x=1 grep echo x=1 done
+echo 'quoted text' echo x=1 cd readonly ${HOME} grep
+	$(pwd) ${HOME} -eu /usr/bin $(pwd) readonly done readonly "$1" echo awk
+export --verbose grep grep
+		cd | readonly | test
+		${HOME} done "$1" sed grep local done printf
+		&& local export /usr/bin | test
+	grep then test readonly "$@" 'quoted text' echo cd $(pwd) "$@" grep "$1" then
+readonly done --verbose ${HOME} | 'quoted text' &&
+		$(pwd) ${HOME} readonly done x=1 cd done done local -eu sed | | && cd "$@"
+/usr/bin "$1" ${HOME} grep grep echo 'quoted text'
+-eu | readonly -eu then /usr/bin local ${HOME}
+sed readonly test 'quoted text' "$@" x=1 grep "$1" x=1 ${HOME}
+	test $(pwd) /usr/bin 2>/dev/null readonly echo local export x=1 readonly
+		grep cd awk done local printf export grep
+	'quoted text' 'quoted text' "$1" ${HOME} printf
+		-eu grep "$@" grep 2>/dev/null
+/usr/bin && then x=1 readonly --verbose -eu --verbose
+		'quoted text' done grep -eu export | readonly
+/usr/bin "$@" readonly echo 2>/dev/null "$@" && then awk "$@" ${HOME}
+		readonly cd x=1 grep 'quoted text' then local x=1 awk cd 'quoted text' ${HOME}
+readonly local cd echo test test
+/usr/bin 2>/dev/null $(pwd) 2>/dev/null
+	/usr/bin 2>/dev/null echo && export $(pwd) sed then test -eu 2>/dev/null echo
+	readonly sed then cd printf printf /usr/bin
+		test -eu test "$@" ${HOME} test 'quoted text' /usr/bin x=1 export
+	local local ${HOME} export $(pwd) && -eu --verbose /usr/bin && 'quoted text'
+then -eu $(pwd) test $(pwd) | export sed "$1" "$1" then
+		x=1 export cd "$1" done readonly
+	x=1 x=1 && -eu then x=1
+		then printf | /usr/bin sed cd echo test ${HOME} then 'quoted text'
+-eu 'quoted text' printf "$1" sed then local echo then printf
+	"$1" $(pwd) $(pwd) $(pwd) "$@" ${HOME} -eu test /usr/bin printf done cd then
+		then sed cd readonly test export
+readonly test export sed "$@" awk 2>/dev/null -eu | | echo
+	"$@" grep then grep && awk done then readonly -eu then 2>/dev/null
+	${HOME} /usr/bin | 2>/dev/null echo x=1 -eu echo /usr/bin
+		2>/dev/null awk then 2>/dev/null then $(pwd)
+		cd export local | readonly 2>/dev/null sed x=1
+done export | done --verbose -eu 'quoted text'
+	/usr/bin 'quoted text' x=1 awk 2>/dev/null --verbose 'quoted text' then sed "$1"
+#include c80.sh
+export printf --verbose && -eu ${HOME} 2>/dev/null --verbose printf 2>/dev/null
+		done | "$@" -eu "$1" done echo export then sed readonly && --verbose -eu /usr/bin
+	x=1 "$1" sed sed && 2>/dev/null "$1" 'quoted text' $(pwd) /usr/bin /usr/bin
+		grep --verbose $(pwd) x=1 printf test local /usr/bin
+	printf 2>/dev/null awk ${HOME}
+--verbose "$@" && printf /usr/bin "$1" done
+		awk local done | local test test --verbose && x=1 | ${HOME} grep grep &&
+		readonly "$1" then awk 2>/dev/null export /usr/bin
+		sed && | then "$1" | | "$1" ${HOME} awk sed | /usr/bin
+grep grep && $(pwd) ${HOME} readonly --verbose test echo && && done echo
+		'quoted text' | test test cd readonly
+sed done awk export done ${HOME} sed "$@" 2>/dev/null printf readonly cd
+	then 'quoted text' && ${HOME} done then $(pwd) local
+		cd --verbose done 'quoted text'
+		grep /usr/bin awk | x=1 echo 'quoted text'
+	awk test sed 'quoted text' 2>/dev/null 2>/dev/null --verbose "$1" local
+	"$1" -eu | | x=1 printf -eu sed "$@" 'quoted text' then awk ${HOME}
+export && test --verbose ${HOME}
+		&& | grep grep x=1 -eu test 2>/dev/null test printf 2>/dev/null
+x=1 'quoted text' ${HOME} cd && x=1 test sed
+		grep "$@" sed printf /usr/bin sed | local "$@"
+"$@" && printf sed $(pwd) then
+$(pwd) sed echo done printf
+	"$@" cd done local /usr/bin x=1 2>/dev/null
+		'quoted text' printf "$1" --verbose && echo
+	local export -eu $(pwd) x=1 | && echo grep readonly $(pwd)
+	readonly cd echo | "$1" $(pwd) 'quoted text'
+	x=1 test awk /usr/bin printf /usr/bin -eu
+2>/dev/null grep done readonly
+	cd && ${HOME} readonly local then test ${HOME}
+		/usr/bin $(pwd) local "$1" |
+	-eu x=1 export && -eu 'quoted text' 2>/dev/null
+	&& cd "$@" ${HOME} export ${HOME} ${HOME} /usr/bin test x=1 ${HOME} &&
+/usr/bin done 'quoted text'
+		${HOME} readonly awk awk x=1 local readonly
+		x=1 /usr/bin -eu -eu ${HOME} sed echo -eu export test ${HOME} grep then echo
+		"$1" "$@" | | x=1 echo grep && -eu $(pwd) 'quoted text' test
+	grep "$1" /usr/bin cd /usr/bin readonly
+	"$@" && then /usr/bin export cd sed echo /usr/bin -eu x=1 'quoted text'
+export readonly x=1 then && printf printf echo "$@" echo "$@" |
+		readonly ${HOME} 'quoted text'
+test 'quoted text' 2>/dev/null cd cd x=1 local test && local $(pwd)
+"$1" echo "$1" 'quoted text'
+awk sed readonly printf readonly local grep
+		"$1" $(pwd) echo "$@" | "$@" 2>/dev/null echo -eu done && cd x=1 grep
+	grep then test ${HOME} /usr/bin "$1" --verbose | local --verbose
+		x=1 then && grep readonly 2>/dev/null
+	printf readonly export local -eu awk test "$@" local awk 'quoted text'
+	export local -eu local done && then grep | 2>/dev/null --verbose
+	x=1 /usr/bin --verbose -eu && test | 2>/dev/null grep awk then local
+		done test readonly echo printf $(pwd)
+| local echo 2>/dev/null then ${HOME} ${HOME} echo then grep
+		| export awk 2>/dev/null done
+grep 2>/dev/null test /usr/bin local $(pwd) --verbose
+	export export -eu cd done $(pwd) then ${HOME} sed export printf "$@" "$@"
+		-eu local /usr/bin readonly echo echo && readonly -eu echo printf done export
+	&& local "$@" awk /usr/bin "$@" then grep printf cd awk -eu "$@"
+		local ${HOME} local -eu
+	local --verbose test export /usr/bin x=1 printf export test "$1"
+then sed then echo "$1" echo
+awk printf $(pwd) local ${HOME} "$@" -eu "$1" "$1" -eu "$1" -eu
+	"$@" echo ${HOME} awk
+	grep cd printf ${HOME} 'quoted text' local
+awk awk export /usr/bin && $(pwd) printf cd --verbose
+	done readonly 2>/dev/null export grep x=1 readonly && -eu sed 'quoted text'
+	$(pwd) 'quoted text' awk export echo --verbose export
+		--verbose /usr/bin grep 'quoted text'
+"$1" "$@" done awk grep awk 2>/dev/null awk cd -eu 2>/dev/null
+		then "$1" | /usr/bin "$@" 2>/dev/null --verbose
+	2>/dev/null test "$@" x=1 grep readonly
+		cd readonly $(pwd) 'quoted text' ${HOME} sed 'quoted text'
+		-eu 2>/dev/null && --verbose
+"$1" ${HOME} && ${HOME}
+		printf && "$@" done readonly
+	$(pwd) readonly readonly printf --verbose /usr/bin
+		2>/dev/null local 2>/dev/null sed then
+	'quoted text' grep local "$1" done echo --verbose
+	printf done && ${HOME} 2>/dev/null done && readonly
+"$@" sed printf readonly
+/usr/bin export grep then awk done awk printf && done test && sed | echo
+	--verbose -eu ${HOME} done echo
+		/usr/bin sed "$1" -eu "$1" "$@" $(pwd)
+		${HOME} echo -eu awk -eu local $(pwd) readonly local
+"$@" grep x=1 readonly printf grep local awk -eu | local
+	echo awk && "$@" && 2>/dev/null 2>/dev/null cd grep awk
+done local 'quoted text'
+test awk "$1" local test done
+		printf --verbose done local --verbose x=1 grep echo then echo
+	awk 2>/dev/null --verbose awk grep "$@" cd ${HOME} && x=1 2>/dev/null
+	export 'quoted text' export /usr/bin export
+	then $(pwd) && 'quoted text' $(pwd)
+cd export readonly readonly local 2>/dev/null awk && "$@"
+awk test export x=1 local grep x=1
+	2>/dev/null ${HOME} cd ${HOME} -eu x=1 echo $(pwd)
+printf sed "$@" --verbose export && sed local |
+printf then ${HOME} grep $(pwd) | export cd | &&
+/usr/bin echo 2>/dev/null x=1 && $(pwd) done ${HOME}
+		--verbose cd ${HOME} 2>/dev/null then
+		sed x=1 'quoted text' ${HOME} echo && "$@" done "$@"
+	--verbose grep $(pwd) 2>/dev/null
+'quoted text' x=1 && test export "$1" /usr/bin
+		export readonly sed ${HOME} sed export /usr/bin && awk $(pwd) "$1"
+	"$@" | "$1" cd ${HOME} -eu ${HOME}
+sed 2>/dev/null then test sed awk printf local ${HOME} ${HOME}
+		export x=1 $(pwd) --verbose ${HOME}
+$(pwd) 'quoted text' local
+		awk grep printf cd ${HOME} then then grep grep x=1 2>/dev/null awk awk
+	done ${HOME} echo awk echo export export awk 2>/dev/null printf export && echo
+		${HOME} | then export /usr/bin grep export echo | --verbose
+"$@" then export $(pwd) "$1" "$1" test 'quoted text' done -eu | "$@" --verbose
+printf $(pwd) "$@" done sed ${HOME} | test
+		${HOME} && ${HOME} sed sed local done export sed printf
+	/usr/bin echo 'quoted text' 'quoted text'
+awk export --verbose export 'quoted text' readonly
+echo local $(pwd) 2>/dev/null $(pwd) "$1" printf awk echo -eu "$1" readonly
+x=1 -eu -eu | $(pwd) readonly /usr/bin "$1"
+	export export x=1 grep local cd ${HOME} "$@" | cd -eu awk printf --verbose -eu 'quoted text'
+	| sed 'quoted text' "$1" 2>/dev/null /usr/bin then cd --verbose cd | printf
+	"$1" x=1 printf x=1 --verbose && ${HOME} cd ${HOME} cd 2>/dev/null "$1"
+&& $(pwd) 'quoted text' cd readonly "$1" grep "$@" grep
+awk --verbose 'quoted text' $(pwd) done awk echo 2>/dev/null
+-eu 2>/dev/null && | $(pwd) && /usr/bin "$@" done x=1 printf && export local /usr/bin
+		2>/dev/null | readonly ${HOME} printf ${HOME} 2>/dev/null local 'quoted text'
+sed "$1" "$@" "$1" | readonly
+	readonly test x=1 then "$@" "$@" /usr/bin awk sed printf && /usr/bin
+| /usr/bin printf awk | test sed readonly
+-eu export /usr/bin ${HOME} | grep then "$1"
+	test printf --verbose --verbose --verbose x=1 sed then echo local printf x=1 --verbose
+2>/dev/null "$1" "$1" test sed
+	x=1 x=1 echo readonly "$@" $(pwd) echo 'quoted text' 2>/dev/null
+&& cd 2>/dev/null "$1" local --verbose awk
+		--verbose local test "$@" /usr/bin
+-eu awk grep ${HOME} done export done 'quoted text' echo
+		/usr/bin export printf cd 'quoted text' echo done
+		&& sed cd --verbose awk 'quoted text' sed done local "$1" ${HOME} test
+test awk $(pwd) | sed grep && | "$@" $(pwd)
+		${HOME} done readonly "$@" | ${HOME} test --verbose 2>/dev/null
+		x=1 cd sed && -eu done then
+	readonly "$1" grep export --verbose awk "$@"
+	printf grep then cd /usr/bin
+		then 'quoted text' && grep "$@"
+	printf 2>/dev/null cd 'quoted text' --verbose echo cd grep
+		2>/dev/null 'quoted text' readonly "$@" /usr/bin
+		echo done $(pwd) -eu "$@" done
+test --verbose export "$@" readonly && "$1" test sed $(pwd) local sed x=1
+		then "$@" /usr/bin x=1 test readonly
+then test -eu /usr/bin local printf
+	&& done sed test 'quoted text' "$1" --verbose
+		&& | export x=1 test echo | sed &&
+x=1 test "$@" grep readonly
+		sed "$1" export x=1 "$1" ${HOME} test sed
+		readonly sed readonly ${HOME} awk 2>/dev/null
+grep test grep echo x=1 $(pwd) done then
+		| done test 'quoted text' local && -eu
+		done && 2>/dev/null --verbose 'quoted text' awk echo /usr/bin local ${HOME}
+	"$1" readonly test export x=1 --verbose test -eu
+		export -eu && awk readonly cd export
+| export 'quoted text' printf x=1 done
+		"$1" printf ${HOME} 'quoted text' export 'quoted text' "$1"
+		grep x=1 "$@" cd && readonly ${HOME}
+		$(pwd) ${HOME} $(pwd) readonly grep "$@" sed export | sed done ${HOME} ${HOME}
+-eu local grep && awk ${HOME} 'quoted text' grep | -eu local test
+		export 'quoted text' cd --verbose
+		local awk cd cd /usr/bin 'quoted text' -eu awk | sed awk grep
+	grep --verbose cd awk echo "$@" 'quoted text'
+		&& 2>/dev/null local ${HOME} done then export | 'quoted text' done grep
+	cd $(pwd) awk -eu export test $(pwd) | "$1" "$@" "$1" local | "$@" grep "$@"
+local export sed echo x=1
+export export printf grep
+		"$@" awk 2>/dev/null 'quoted text' --verbose "$1" done printf -eu | $(pwd)
+		local cd | && "$1" awk 'quoted text' "$1" 2>/dev/null "$@" echo x=1 'quoted text'
+printf readonly local done "$1" then local printf cd
+grep printf x=1 x=1 sed ${HOME} $(pwd) then "$1" grep test | /usr/bin
+local local /usr/bin readonly x=1 then -eu test echo test $(pwd)
+--verbose export x=1 && sed $(pwd)
+		local done test printf "$@" 2>/dev/null
+	-eu 'quoted text' echo x=1 && 2>/dev/null 2>/dev/null && local "$1" echo
+-eu | x=1 printf cd $(pwd)
+	$(pwd) test --verbose | x=1 -eu cd ${HOME} test "$1" && export awk grep
+${HOME} sed local test readonly && ${HOME} --verbose grep && --verbose 'quoted text'
+	'quoted text' /usr/bin "$@" export x=1 then then | readonly
+		'quoted text' grep ${HOME} --verbose 2>/dev/null
+	grep cd /usr/bin "$@" test -eu export -eu 2>/dev/null x=1 export local
+		x=1 cd "$1" printf local cd awk printf
+	--verbose | readonly && then cd "$@"
+		sed test x=1 then -eu x=1 echo test --verbose
+export cd | printf test &&
+echo $(pwd) cd export then && test export | cd cd "$@" 2>/dev/null
+		then x=1 grep /usr/bin && awk
+x=1 "$1" grep "$@" grep
+--verbose 'quoted text' 2>/dev/null printf /usr/bin local
+	printf /usr/bin export x=1
+	readonly --verbose grep ${HOME} grep "$@" cd | readonly
+cd awk /usr/bin readonly export /usr/bin test local sed test readonly
+printf sed $(pwd) grep x=1 && done 'quoted text'
+		x=1 printf | grep | /usr/bin
+'quoted text' "$1" local 2>/dev/null x=1 && ${HOME} && $(pwd) 2>/dev/null
+		readonly cd echo 2>/dev/null "$@" && /usr/bin /usr/bin --verbose
+export export ${HOME} local | /usr/bin -eu "$@" done -eu --verbose
+		"$@" --verbose local && 2>/dev/null --verbose
+	&& --verbose | echo "$1" /usr/bin x=1 $(pwd) "$@"
+	sed readonly test then echo x=1 cd
+		done "$@" -eu awk sed done then printf | x=1 x=1
+	$(pwd) export done awk echo echo
+local sed printf printf
+		| --verbose -eu printf printf
+-eu $(pwd) --verbose done export | export "$@"
+	awk grep then x=1 /usr/bin cd 'quoted text'
+		export 'quoted text' grep printf -eu 2>/dev/null cd "$@" --verbose "$1" cd echo
+&& awk $(pwd) echo x=1 'quoted text' ${HOME} | grep then done x=1
+--verbose cd -eu readonly --verbose sed "$1" $(pwd) ${HOME}
+readonly awk sed local sed sed
+	echo echo 2>/dev/null
+	"$1" cd "$1" readonly ${HOME} awk 2>/dev/null
+		'quoted text' local local printf local 2>/dev/null
+/usr/bin --verbose done local /usr/bin grep | grep cd sed --verbose
+		'quoted text' x=1 export -eu $(pwd) 2>/dev/null test
+	2>/dev/null | done echo $(pwd) test awk -eu 2>/dev/null
+		cd ${HOME} printf then x=1 -eu ${HOME} 'quoted text' /usr/bin
+"$1" test done | --verbose 2>/dev/null |
+	then -eu ${HOME} "$1" x=1 then 2>/dev/null then "$@" "$1" "$1" echo awk /usr/bin
+	printf done export $(pwd) local $(pwd) awk cd export sed 2>/dev/null
+		/usr/bin sed /usr/bin export
+	test x=1 awk | 'quoted text' done 'quoted text' -eu cd | grep local && --verbose
+&& /usr/bin awk ${HOME} export local "$1" --verbose
+	readonly printf echo ${HOME} 'quoted text' --verbose printf
+		export export $(pwd) export |
+	awk done $(pwd) | export then export
+		--verbose grep --verbose export x=1 readonly -eu "$@" &&
+${HOME} export 2>/dev/null
+		test --verbose grep readonly $(pwd) -eu
+		sed 2>/dev/null "$1" && test -eu
+		x=1 grep printf -eu "$@" done $(pwd)
+	&& "$1" cd && "$1" --verbose 2>/dev/null
+	&& -eu /usr/bin && ${HOME} 2>/dev/null | ${HOME} then $(pwd) "$@"
+readonly 2>/dev/null cd /usr/bin
+		$(pwd) export "$@" sed && done "$1" readonly &&
+		| --verbose readonly awk |
+	done cd ${HOME} then local && "$@" awk printf printf ${HOME} awk local -eu
+		-eu printf export sed test
+awk /usr/bin -eu awk --verbose --verbose
+		"$@" cd -eu local grep then $(pwd) x=1 echo $(pwd) local $(pwd) cd cd --verbose
+	sed $(pwd) -eu readonly grep "$@" export echo local echo printf grep test
+/usr/bin | | ${HOME} export sed "$1" &&
+	"$1" | then "$1" echo sed then done "$@" echo -eu && x=1 test printf then
+	"$@" | | | 2>/dev/null
+		readonly echo printf && echo done x=1 -eu printf
+		printf done export test 2>/dev/null 'quoted text' local x=1 -eu grep
+"$1" "$1" x=1 -eu /usr/bin test 'quoted text' then 'quoted text'
+	local /usr/bin "$1" echo | -eu sed x=1 2>/dev/null
+	'quoted text' then "$@" "$@" && -eu cd | awk /usr/bin
+	$(pwd) export awk "$1" echo ${HOME} echo echo $(pwd) done && awk
+		2>/dev/null export local 'quoted text' "$1" ${HOME} cd --verbose
+		| awk -eu --verbose local $(pwd) grep printf -eu sed -eu "$1" &&
+		2>/dev/null "$1" awk grep -eu ${HOME}
+-eu done echo x=1 2>/dev/null export sed | readonly "$1" readonly --verbose ${HOME}
+	test awk readonly ${HOME} /usr/bin echo awk | grep "$1" --verbose
+		"$@" done export "$1" "$@" export ${HOME} sed awk "$@" x=1 test
+'quoted text' 'quoted text'
+echo printf /usr/bin 'quoted text' $(pwd) --verbose | $(pwd) | printf grep
+'quoted text' readonly | cd printf ${HOME} "$@" export then "$@" cd
+	${HOME} x=1 echo local done --verbose "$1" grep x=1 'quoted text'
+	echo cd sed /usr/bin done x=1 $(pwd) awk cd awk 'quoted text'
+		"$@" awk grep awk 2>/dev/null 'quoted text'
+	2>/dev/null printf then && -eu ${HOME} test printf
+	done "$1" 'quoted text' /usr/bin ${HOME} $(pwd) -eu --verbose "$1" test
+		&& | /usr/bin echo $(pwd) export readonly test 2>/dev/null ${HOME} then test 2>/dev/null
+		awk echo ${HOME} grep
+	test export && 'quoted text' | "$@" | ${HOME} printf "$1"
+	'quoted text' /usr/bin -eu then sed "$@" then
+	&& awk cd done readonly printf
+$(pwd) printf ${HOME}
+	&& 2>/dev/null && then /usr/bin then 'quoted text'
+		x=1 'quoted text' x=1 --verbose
+| grep done local local "$1"
+echo printf && && "$1" -eu -eu --verbose 2>/dev/null grep export grep
+		grep | printf local test
+		export printf $(pwd) | local
+	grep $(pwd) cd printf readonly "$1" export printf -eu | export --verbose
+		printf x=1 local 'quoted text' /usr/bin awk 'quoted text'
+awk ${HOME} readonly ${HOME} echo then |
+readonly then /usr/bin echo x=1 grep "$1" --verbose test $(pwd)
+	readonly 2>/dev/null printf
+export grep test /usr/bin readonly grep test awk /usr/bin x=1 | test grep /usr/bin
+	done x=1 $(pwd) grep echo
+		| ${HOME} printf "$@" -eu 'quoted text'
+	export readonly export ${HOME}
+		echo awk | test readonly local "$1" awk 2>/dev/null x=1 readonly 'quoted text'
+		x=1 x=1 && $(pwd) test done x=1 "$1" x=1 done x=1 cd | test grep "$@" local "$1"
+2>/dev/null local cd printf
+	"$@" && printf sed $(pwd) -eu grep sed "$@" local test test export "$1"
+/usr/bin 'quoted text' 2>/dev/null | $(pwd) local | /usr/bin
+	awk grep printf export
+	--verbose && export export
+		grep then export 2>/dev/null then
+		test "$1" done "$@" done awk
+	echo printf echo ${HOME} export echo x=1 'quoted text'
+		| $(pwd) x=1 ${HOME} "$@" awk "$1" printf "$1" "$@"
+then done cd echo printf grep
+		sed readonly 'quoted text' test ${HOME} x=1
+		done "$1" printf test then | "$1" sed ${HOME} then sed cd x=1 "$@"
+'quoted text' sed awk "$@" 2>/dev/null
+test 2>/dev/null 2>/dev/null 2>/dev/null export sed awk awk echo
+		"$@" awk $(pwd) -eu "$1" sed awk | sed x=1 cd echo 2>/dev/null ${HOME}
+	printf readonly grep && ${HOME} --verbose && printf then | ${HOME} "$@" /usr/bin
+		x=1 grep -eu readonly --verbose
+test && /usr/bin echo export x=1 export echo awk export | ${HOME} x=1 grep
+		| cd printf | local test $(pwd) then x=1 test printf --verbose export local 2>/dev/null
+		readonly | echo printf echo
+		| readonly ${HOME} cd x=1 then ${HOME} done test grep readonly ${HOME} &&
+		${HOME} --verbose readonly printf
+echo readonly "$1" && echo local ${HOME} /usr/bin
+		echo 2>/dev/null | --verbose --verbose
+		2>/dev/null x=1 /usr/bin -eu printf
+'quoted text' -eu done "$1" 2>/dev/null then sed
+		cd --verbose grep echo sed && done | && then
+	echo && local then 2>/dev/null --verbose && then cd
+	x=1 -eu echo export cd grep cd echo ${HOME} local 'quoted text'
+	x=1 cd then -eu "$@" grep $(pwd) then readonly && readonly 'quoted text'
+awk ${HOME} $(pwd) "$1" | | printf awk && cd && grep readonly
+${HOME} --verbose awk printf then
+	2>/dev/null awk $(pwd) |
+		-eu x=1 2>/dev/null printf 'quoted text'
+printf "$1" /usr/bin /usr/bin cd "$@"
+		2>/dev/null done grep 2>/dev/null x=1 awk printf 2>/dev/null local ${HOME}
+sed grep awk then "$1" x=1 $(pwd) then done x=1 /usr/bin
+test awk local sed sed local && printf $(pwd) echo grep echo grep
+		-eu --verbose sed $(pwd) -eu test && /usr/bin export sed ${HOME}
+	2>/dev/null export awk x=1 readonly "$1" export
+	then ${HOME} done done local
+	export awk sed cd cd x=1 | "$@" printf done
+		${HOME} printf sed "$@" 2>/dev/null 2>/dev/null printf printf 'quoted text'
+	printf 2>/dev/null cd 2>/dev/null && "$1" | done
+		awk done --verbose done grep test readonly grep test -eu export ${HOME} grep
+		-eu awk then "$1" test sed "$1" sed $(pwd) export
+echo cd readonly "$@" awk grep test echo && sed /usr/bin "$1" readonly
+local 'quoted text' test -eu test echo readonly export sed grep
+	${HOME} | ${HOME} readonly awk echo local export echo -eu awk export
+export -eu sed --verbose readonly printf awk | "$1" local ${HOME} 2>/dev/null
+	$(pwd) 2>/dev/null cd awk readonly local 'quoted text' awk $(pwd) readonly readonly
+		printf -eu --verbose 'quoted text' sed sed 'quoted text' printf "$1" ${HOME} done
+local --verbose "$1" "$@" /usr/bin
+		| x=1 --verbose ${HOME} then local --verbose printf
+	printf sed "$1" x=1 --verbose
+	readonly $(pwd) then "$1" sed sed ${HOME} export "$1" 'quoted text'
+export grep then printf x=1 ${HOME} && && ${HOME} 'quoted text' grep x=1 ${HOME}
+	printf && $(pwd) "$@" sed && | ${HOME} -eu "$1" "$1" readonly
+	then awk 'quoted text' printf 2>/dev/null
+		cd $(pwd) export --verbose "$1" 2>/dev/null printf cd -eu |
+		local sed -eu && "$@" echo sed cd -eu export readonly
+test && done printf grep awk test printf test && readonly
+/usr/bin | sed test "$1" $(pwd) printf done sed then
+2>/dev/null | "$@" readonly sed grep "$@" test ${HOME}
+done test test ${HOME} 'quoted text' | sed x=1 'quoted text' $(pwd) $(pwd) $(pwd)
+		readonly done $(pwd) /usr/bin grep --verbose | -eu $(pwd) then sed $(pwd)
+cd x=1 test ${HOME} /usr/bin test then && --verbose local export
+	-eu $(pwd) sed cd local 'quoted text'
+	test && 2>/dev/null sed 'quoted text'
+		'quoted text' --verbose export
+printf -eu printf && done grep echo ${HOME}
+"$1" "$1" $(pwd) sed sed x=1 export local && then then && sed cd $(pwd)
+		| $(pwd) sed printf 'quoted text' export | x=1 sed echo
+x=1 printf test echo 2>/dev/null grep -eu -eu test test ${HOME}
+	test x=1 export | "$@" grep "$@" awk x=1 test echo ${HOME} cd 'quoted text' test
+local --verbose test /usr/bin readonly
+then printf local cd x=1
+"$@" | echo echo sed -eu x=1 printf
+	test awk printf /usr/bin -eu --verbose test /usr/bin
+then test --verbose --verbose | done x=1 awk done export
+		2>/dev/null echo readonly sed readonly sed "$@" "$1"
+2>/dev/null /usr/bin | | grep readonly sed
+--verbose -eu grep 2>/dev/null then local "$@" readonly
+	awk sed 2>/dev/null -eu grep $(pwd) then 'quoted text' /usr/bin 2>/dev/null
+	readonly x=1 awk x=1 'quoted text' 2>/dev/null "$@" cd -eu awk
+	then x=1 readonly $(pwd) cd 2>/dev/null then "$1" grep 2>/dev/null
+		local && | "$@" sed | 2>/dev/null
+		export /usr/bin export /usr/bin
+	echo grep grep /usr/bin /usr/bin ${HOME} && -eu
+	readonly $(pwd) $(pwd) export "$@" --verbose x=1 echo | -eu
+		sed printf export printf grep 'quoted text'
+printf sed echo x=1 echo /usr/bin
+-eu ${HOME} sed x=1 cd 'quoted text' 'quoted text' local local
+echo ${HOME} printf "$@" "$@" 'quoted text' 2>/dev/null
+sed sed readonly test echo 2>/dev/null x=1
+		--verbose && --verbose
+		$(pwd) printf /usr/bin -eu /usr/bin | export then ${HOME} printf x=1
+${HOME} grep grep local readonly
+$(pwd) ${HOME} /usr/bin then test printf x=1 "$1"
+	then 'quoted text' then awk "$@" 2>/dev/null 'quoted text' printf echo echo 2>/dev/null
+	${HOME} --verbose test --verbose ${HOME} echo "$@" test 2>/dev/null printf
+	local then "$1" x=1 grep && -eu readonly 'quoted text' && test awk printf
+		&& x=1 "$1" printf "$1" echo echo -eu done awk "$1" printf printf test cd
+	awk local test printf $(pwd) x=1 --verbose
+printf done readonly "$1" -eu export 'quoted text'
+	${HOME} sed then -eu local "$@" test test grep --verbose ${HOME} grep readonly echo
+| local then awk /usr/bin grep --verbose
+		${HOME} --verbose 'quoted text' | $(pwd) /usr/bin $(pwd) 2>/dev/null done ${HOME}
+	| readonly /usr/bin printf
+	echo "$1" cd sed $(pwd) then readonly local ${HOME}
+readonly x=1 $(pwd) 'quoted text' export printf echo
+		"$1" awk 'quoted text' /usr/bin
+		x=1 "$@" /usr/bin 'quoted text'
+&& 2>/dev/null && 2>/dev/null then cd $(pwd) export 'quoted text' /usr/bin
+| "$1" -eu 2>/dev/null --verbose
+		2>/dev/null $(pwd) | "$@" local printf sed grep then export local printf |
+		x=1 then sed "$@" $(pwd) sed $(pwd) echo then sed ${HOME} local
+	cd x=1 ${HOME} 'quoted text' awk printf
+		export sed local 'quoted text' awk ${HOME} $(pwd)
+	test "$@" 'quoted text' export $(pwd)
+		export awk | && x=1 && 2>/dev/null cd --verbose then
+	sed then then done 2>/dev/null
+	2>/dev/null awk 'quoted text' 'quoted text' done && test
+		"$1" printf | -eu "$@" export test -eu test awk "$@" export ${HOME} echo printf
+		awk printf echo export sed local echo 'quoted text'
+		${HOME} done sed /usr/bin /usr/bin && /usr/bin readonly export /usr/bin
+awk | "$@" export -eu awk /usr/bin local cd test && echo | export -eu printf
+'quoted text' 'quoted text' then x=1 x=1 awk echo x=1 printf grep grep $(pwd)
+	awk $(pwd) --verbose sed
+${HOME} 'quoted text' printf awk
+		"$1" x=1 sed -eu | ${HOME} 'quoted text' $(pwd) test readonly
+		readonly $(pwd) /usr/bin "$1" 'quoted text' "$@" | then
+| grep | local readonly --verbose && then local
+export sed "$@" -eu done $(pwd) /usr/bin "$@" then | sed then
+	local "$1" local done "$@" $(pwd) $(pwd)
+awk "$@" done test echo sed 2>/dev/null "$@" $(pwd)
+	2>/dev/null $(pwd) readonly
+x=1 local | && --verbose test done then done printf | local test 2>/dev/null -eu
+/usr/bin readonly | done $(pwd) ${HOME}
+	readonly local test cd 2>/dev/null
+	$(pwd) done sed "$@" "$1" local "$1" then -eu cd readonly test
+"$@" ${HOME} export echo cd echo 'quoted text' cd sed 'quoted text'
+	cd sed 'quoted text' export awk export
+	test -eu printf awk -eu /usr/bin done $(pwd) --verbose done grep cd && /usr/bin
+/usr/bin -eu /usr/bin grep done printf echo then ${HOME} then
+	printf printf "$1" awk sed "$1" /usr/bin
+		"$1" export test sed "$1" 'quoted text' echo "$1" "$@"
+grep ${HOME} x=1 /usr/bin x=1 ${HOME} && then
+		readonly local readonly "$1" 2>/dev/null && | "$@" export x=1
+"$1" grep echo export /usr/bin awk ${HOME} "$@" "$1" --verbose $(pwd) grep echo
+	"$@" $(pwd) then grep $(pwd)
+		'quoted text' "$@" export then /usr/bin then "$1" echo export | "$1" -eu 2>/dev/null
+	local local grep awk cd printf then 'quoted text' $(pwd) done local $(pwd)
+	'quoted text' cd --verbose readonly --verbose then ${HOME}
+		then then printf --verbose
+		readonly $(pwd) -eu grep "$1" echo && sed
+		cd /usr/bin && grep "$1" grep 2>/dev/null
+		/usr/bin cd grep echo grep echo done /usr/bin "$@" then echo printf local
+		readonly test echo --verbose -eu "$1"
+		local then | && done | grep then readonly
+echo grep /usr/bin $(pwd) readonly cd echo
+		done printf x=1 export "$1" && 2>/dev/null && $(pwd) test
+-eu "$1" test 2>/dev/null then test readonly
+		printf readonly sed printf "$1" --verbose
+then sed --verbose 'quoted text'
+/usr/bin x=1 "$1" x=1 /usr/bin "$1" $(pwd)
+	"$@" test awk then && done "$@" then "$1" readonly "$1" test sed done export
+		--verbose | export grep local
+	${HOME} then ${HOME} ${HOME} /usr/bin printf 'quoted text' | "$@" test echo $(pwd)
+		printf -eu cd readonly grep awk awk cd export
+cd done grep readonly grep 2>/dev/null --verbose | grep | echo
+	2>/dev/null cd test grep sed && awk 'quoted text' 'quoted text' printf -eu 2>/dev/null
+readonly cd | $(pwd) sed test x=1 awk x=1
+	then x=1 printf sed $(pwd) $(pwd) export -eu sed ${HOME} test "$1" grep
+		x=1 export /usr/bin "$@" x=1 x=1 && readonly awk -eu | && readonly
+	sed local -eu && "$@" local printf 2>/dev/null echo grep grep test && "$1"
+then -eu ${HOME} && ${HOME} done readonly test sed export awk awk awk ${HOME}
+		export "$@" $(pwd) cd
+		/usr/bin printf local && --verbose $(pwd) /usr/bin $(pwd) /usr/bin
+		printf "$@" "$@" local echo /usr/bin sed -eu ${HOME}
+		| $(pwd) grep "$1" $(pwd) /usr/bin -eu "$1"
+		readonly && done then grep && then $(pwd) && then x=1 echo printf printf --verbose
+		then awk awk export test x=1 --verbose cd awk test then ${HOME}
+		sed grep local ${HOME} readonly "$1" then -eu sed | | readonly cd done then
+test readonly echo $(pwd) test readonly
+		readonly local "$@" cd
+export ${HOME} --verbose local sed -eu printf
+	'quoted text' test cd test -eu awk "$@" "$@" "$1" awk && ${HOME}
+echo local cd $(pwd) --verbose cd
+/usr/bin 2>/dev/null readonly -eu -eu test readonly 2>/dev/null x=1 test grep printf
+test x=1 test 2>/dev/null "$@" ${HOME}
+		readonly /usr/bin 2>/dev/null &&
+		${HOME} sed cd sed $(pwd) -eu readonly then $(pwd)
+		done grep printf readonly 'quoted text' cd
+	echo done "$1" grep 2>/dev/null | export
+	"$1" echo ${HOME} test then export $(pwd)
+sed export awk $(pwd) &&
+	$(pwd) --verbose grep echo readonly -eu echo echo 'quoted text'
+-eu x=1 "$@" ${HOME} sed -eu "$@" sed then "$@" cd ${HOME} sed awk echo
+	awk test sed 2>/dev/null export x=1 local
+readonly "$1" done cd x=1 sed "$@" grep "$@"
+		--verbose readonly cd sed "$1" local /usr/bin /usr/bin awk cd readonly
+done export local echo awk test
+	test -eu local x=1 awk printf local cd "$@" /usr/bin 'quoted text'
+	local ${HOME} 2>/dev/null --verbose 2>/dev/null cd ${HOME} readonly
+-eu --verbose ${HOME}
+2>/dev/null && "$@" && 'quoted text'
+		/usr/bin local printf sed sed cd x=1 cd then printf /usr/bin sed "$@"
+local 'quoted text' $(pwd) done readonly printf echo
+awk /usr/bin 'quoted text' 'quoted text' grep 2>/dev/null done readonly
+2>/dev/null "$@" then sed | x=1 sed "$@" cd awk
+local test 'quoted text' | ${HOME} "$1" cd awk sed awk printf then echo -eu "$@"
+done $(pwd) readonly $(pwd) test ${HOME}
+		"$@" grep readonly done $(pwd)
+$(pwd) awk /usr/bin awk readonly ${HOME}
+		--verbose -eu readonly $(pwd)
+		${HOME} "$1" --verbose | -eu echo printf -eu 2>/dev/null cd $(pwd) sed grep
+$(pwd) cd | export --verbose 'quoted text' "$1" done local --verbose done readonly
+	/usr/bin readonly local x=1 test export
+	test ${HOME} printf 2>/dev/null
+then readonly done --verbose 'quoted text' --verbose done -eu cd -eu sed &&
+local 'quoted text' export $(pwd) /usr/bin
+	grep $(pwd) sed --verbose /usr/bin 2>/dev/null 2>/dev/null test then "$1" ${HOME}
+		/usr/bin test && done "$1" export -eu cd | local | printf
+echo | sed "$1" && printf --verbose local ${HOME} ${HOME} --verbose awk
+	'quoted text' "$1" ${HOME} local "$@" echo then echo done $(pwd) ${HOME} sed local
+	${HOME} export 2>/dev/null grep 2>/dev/null
+x=1 test && test echo --verbose 'quoted text' --verbose
+		done -eu printf done "$1" && 2>/dev/null -eu printf x=1 readonly
+readonly echo -eu export then sed &&
+	${HOME} local local readonly x=1 $(pwd) $(pwd) ${HOME} test "$@" -eu readonly
+	test sed 'quoted text' -eu then test 2>/dev/null --verbose
+	sed printf awk ${HOME}
+"$1" ${HOME} echo done 'quoted text'
+		&& x=1 echo sed | $(pwd) "$1" done readonly sed "$@" test --verbose -eu /usr/bin
+	--verbose readonly grep echo cd grep sed grep awk done cd 'quoted text' /usr/bin
+export local echo cd "$@" ${HOME} echo done |
+done && printf sed --verbose grep echo
+printf | test | $(pwd) 2>/dev/null --verbose ${HOME} cd
+	test test grep export printf "$@" "$1"
+		grep | $(pwd) echo printf export
+"$1" /usr/bin cd echo test "$1" 2>/dev/null
+		grep | then echo sed &&
+echo grep then test then
+	x=1 && echo sed 2>/dev/null sed then done
+	/usr/bin done -eu test 2>/dev/null --verbose done $(pwd) then printf x=1
+		then sed test grep export test --verbose
+export | 'quoted text' awk ${HOME} echo printf grep readonly then "$1" ${HOME}
+done echo ${HOME} 2>/dev/null test awk
+grep | done grep 'quoted text' -eu ${HOME} awk test "$@" /usr/bin 'quoted text'
+	-eu done printf readonly && $(pwd) "$1" "$@" "$@" done readonly readonly
+		/usr/bin /usr/bin $(pwd) then $(pwd) $(pwd) | 2>/dev/null cd "$@" readonly
+		"$@" export sed export test -eu | awk ${HOME} then 'quoted text' && export
+		readonly ${HOME} 2>/dev/null ${HOME} readonly --verbose printf
+	| then && echo grep ${HOME} export x=1 | -eu --verbose local
+		done then "$@" printf then printf && -eu
+	awk --verbose /usr/bin && x=1 $(pwd)
+		x=1 then -eu 'quoted text' && ${HOME} sed then -eu local done 2>/dev/null
+2>/dev/null /usr/bin -eu local /usr/bin 'quoted text'
+		/usr/bin grep --verbose awk awk "$@" 'quoted text' | 'quoted text'
+	local x=1 then echo 'quoted text' "$1" grep cd | readonly &&
+	$(pwd) printf && "$1" cd then export --verbose
+		test ${HOME} sed awk ${HOME} sed 2>/dev/null then --verbose
+		export then 'quoted text'
+grep && grep | grep sed grep -eu test readonly "$@" 'quoted text'
+	| 2>/dev/null cd "$@" sed x=1 then printf cd local awk readonly readonly
+	-eu done && export grep x=1 "$1" 'quoted text'
+		'quoted text' echo export | "$@"
+		| then echo test 'quoted text'
+	--verbose -eu x=1 test export readonly x=1 grep awk grep
+&& local 2>/dev/null 2>/dev/null then x=1 ${HOME} ${HOME} && -eu $(pwd) 2>/dev/null
+		-eu awk 'quoted text' grep awk done sed /usr/bin readonly test printf local ${HOME}
+printf done 'quoted text' "$@" readonly
+	$(pwd) $(pwd) && 'quoted text' done test -eu
+		&& readonly echo grep | test "$1" sed awk 2>/dev/null
+		local | printf $(pwd) readonly --verbose 'quoted text' printf x=1 cd then "$@"
+--verbose 2>/dev/null x=1
+/usr/bin then export readonly -eu
+	done local done printf
+		--verbose local then -eu
+cd && && --verbose sed 2>/dev/null grep --verbose
+2>/dev/null -eu "$@" ${HOME} then done --verbose
+	test "$@" echo cd test 'quoted text' $(pwd) "$1" local -eu
+x=1 "$1" echo sed --verbose "$1"
+sed printf x=1 && | done
+		2>/dev/null && done "$@"
+	--verbose ${HOME} done x=1 grep test export export
+	awk | $(pwd) printf $(pwd) --verbose -eu test --verbose $(pwd) then local
+	echo awk done local /usr/bin cd echo
+printf 2>/dev/null grep 2>/dev/null then cd test readonly test export
+/usr/bin echo x=1 grep awk
+	$(pwd) /usr/bin && /usr/bin $(pwd) "$1" | /usr/bin awk
+	local then printf /usr/bin awk test x=1 cd x=1
+	| "$@" 2>/dev/null awk done "$1" local
+	export cd "$@" 'quoted text' "$@" readonly sed test readonly printf --verbose
+		--verbose | /usr/bin test --verbose grep local sed done
+		local grep awk | --verbose /usr/bin 2>/dev/null $(pwd) printf
+	"$@" local printf "$1" export "$@" --verbose /usr/bin 'quoted text'
+		$(pwd) local printf cd x=1 then cd --verbose ${HOME} | awk --verbose cd done
+	local x=1 x=1 && awk awk -eu cd grep 2>/dev/null /usr/bin "$@" sed --verbose
+		export /usr/bin $(pwd) then /usr/bin sed x=1
+		export readonly | $(pwd) | "$@" export 'quoted text' grep 2>/dev/null printf
+		readonly echo done test sed && && test "$@" "$@" /usr/bin 2>/dev/null --verbose
+$(pwd) $(pwd) $(pwd) echo "$1" cd export --verbose sed cd local
+		awk && ${HOME} && echo "$1" awk
+	awk test awk "$1" $(pwd) local | cd sed
+	"$1" $(pwd) cd local export --verbose awk
+	$(pwd) 'quoted text' 'quoted text' export --verbose test
+		--verbose $(pwd) /usr/bin --verbose cd then "$1" local then 'quoted text'
+		--verbose then printf $(pwd) echo cd /usr/bin -eu cd echo "$@" test ${HOME}
+		"$@" test readonly readonly | "$1" local done | && export then ${HOME}
+		sed "$1" sed done echo then "$1" "$1" 'quoted text' awk $(pwd)
+local x=1 && printf 'quoted text' $(pwd) readonly
+	readonly --verbose -eu 'quoted text' 2>/dev/null sed && 'quoted text' then
+	then readonly cd cd local awk sed 'quoted text' export
+	export sed awk -eu 2>/dev/null echo "$@" | /usr/bin sed sed "$@" printf grep
+"$1" -eu "$@" 2>/dev/null $(pwd)
+		readonly | done -eu test 'quoted text' export /usr/bin "$@" && | awk grep
+	| "$1" then export then test "$@" $(pwd) local | ${HOME} ${HOME}
+	| test /usr/bin done | "$@"
+	-eu then echo "$1" local then
+$(pwd) x=1 --verbose export grep x=1
+"$@" && -eu ${HOME} sed readonly $(pwd) readonly printf
+		| echo printf 2>/dev/null "$1" cd -eu echo && test $(pwd) cd
+		&& echo --verbose awk /usr/bin | awk printf | export "$1" ${HOME}
+"$1" printf --verbose x=1 echo -eu printf $(pwd) done "$@"
+	grep export done local awk cd --verbose done -eu printf
+local 2>/dev/null awk cd && awk x=1 cd printf ${HOME}
+local export local cd done grep readonly grep ${HOME} done grep x=1 then sed
+"$@" | printf then 2>/dev/null echo echo | printf "$@" &&
+	2>/dev/null readonly readonly export cd
+	cd awk $(pwd) local ${HOME} then readonly $(pwd) readonly $(pwd) cd ${HOME} printf
+		x=1 --verbose 2>/dev/null /usr/bin ${HOME} 2>/dev/null x=1 printf --verbose
+		x=1 | && readonly 'quoted text'
+export grep | "$1" "$@" cd echo -eu export x=1
+		awk -eu "$1" grep cd x=1 done done sed --verbose export
+		"$@" cd grep -eu "$1" local --verbose
+		'quoted text' then $(pwd) awk 'quoted text' 2>/dev/null
+	'quoted text' $(pwd) --verbose -eu test awk readonly grep $(pwd) "$1"
+		grep cd awk grep cd ${HOME} 'quoted text' x=1 test done sed
+$(pwd) x=1 --verbose cd sed ${HOME} then cd done $(pwd)
+awk readonly "$@" ${HOME} echo grep readonly
+${HOME} local | x=1 'quoted text'
+		/usr/bin 'quoted text' | cd
+		--verbose cd x=1 done test "$@" 2>/dev/null
+	local test "$1" readonly done "$@" 'quoted text'
+echo printf -eu readonly export
+		grep 2>/dev/null awk x=1 test grep
+"$@" --verbose "$1" 'quoted text' /usr/bin | "$@"
+		| "$1" local awk export then printf echo done 2>/dev/null
+	-eu && local | /usr/bin readonly test --verbose -eu test grep grep done
+	sed $(pwd) export x=1 "$1" "$@" ${HOME} -eu | grep printf $(pwd) cd 2>/dev/null
+	"$1" ${HOME} done printf done x=1 ${HOME} "$@" -eu "$@" "$@" then then awk awk /usr/bin
+	awk ${HOME} local awk local done grep /usr/bin sed x=1 export ${HOME} done readonly
+	| cd printf --verbose
+-eu --verbose grep 2>/dev/null -eu 2>/dev/null echo
+	sed sed grep ${HOME} --verbose grep 'quoted text' printf 2>/dev/null local
+		cd echo | 2>/dev/null "$@" -eu "$1"
+		readonly --verbose test && echo cd x=1 -eu && readonly /usr/bin | --verbose
+		printf "$@" ${HOME} 'quoted text' done local local | echo --verbose -eu local
+export echo /usr/bin 'quoted text' then export 'quoted text' cd cd "$@"
+	/usr/bin "$1" local $(pwd) "$@" sed awk printf then grep && local test
+		echo 2>/dev/null --verbose x=1 /usr/bin 'quoted text' -eu $(pwd)
+		"$1" "$1" sed export --verbose printf cd export --verbose
+2>/dev/null x=1 echo "$@" 'quoted text' | 2>/dev/null 2>/dev/null export x=1 /usr/bin
+printf && readonly "$1" 'quoted text' && printf
+then ${HOME} then export && x=1 sed then /usr/bin -eu x=1
+readonly /usr/bin readonly | 2>/dev/null sed -eu | --verbose
+"$1" sed | ${HOME} done 'quoted text' 'quoted text'
+${HOME} done awk readonly "$@" "$@" 'quoted text'
+		--verbose readonly 'quoted text' printf && export local "$1" 2>/dev/null
+"$1" awk sed 'quoted text' then local "$1" "$@" | "$1"
+		cd /usr/bin printf /usr/bin | --verbose
+grep export "$@" echo /usr/bin local "$1" 2>/dev/null local
+	"$1" test "$1" --verbose done printf "$@" -eu export export | | "$@" ${HOME} grep
+		done cd echo /usr/bin export echo && awk
+	printf sed cd && ${HOME} local echo export cd /usr/bin
+	done x=1 test done 'quoted text' printf readonly --verbose
+	export done $(pwd) "$@" | $(pwd) 2>/dev/null printf && --verbose | x=1
+		local -eu sed local done sed local
+		awk cd 'quoted text' export x=1 printf 2>/dev/null "$1" | sed /usr/bin /usr/bin
+	${HOME} ${HOME} echo local sed "$@" done -eu
+		| sed printf test && 'quoted text' done $(pwd)
+		/usr/bin "$1" /usr/bin 2>/dev/null 2>/dev/null /usr/bin echo
+cd echo readonly test 2>/dev/null 2>/dev/null "$1" /usr/bin sed export x=1
+		-eu && then cd ${HOME} awk export
+sed readonly sed test /usr/bin --verbose x=1 done printf --verbose then
+	"$@" /usr/bin export 'quoted text' x=1 grep printf test test
+	"$1" "$1" -eu "$@" $(pwd)
+	local && "$1" sed "$@" local sed test 2>/dev/null grep
+	grep export ${HOME} awk "$1"
+--verbose 'quoted text' 2>/dev/null
+		printf 'quoted text' | awk then "$@" && "$1" "$1" test /usr/bin
+		${HOME} && done then local $(pwd)
+		/usr/bin "$1" "$1" -eu readonly 'quoted text'
+	${HOME} sed && | 2>/dev/null test export sed x=1 export --verbose readonly
+	--verbose printf sed /usr/bin test
+	| 'quoted text' sed readonly -eu printf $(pwd) /usr/bin | grep 'quoted text'
+"$1" ${HOME} test echo grep 'quoted text' done | 2>/dev/null "$1" ${HOME} ${HOME}
+		x=1 -eu echo x=1 /usr/bin export test local | echo readonly ${HOME}
+then 2>/dev/null | ${HOME} test ${HOME} then echo done echo
+'quoted text' "$@" /usr/bin 2>/dev/null readonly --verbose sed printf grep local
+$(pwd) printf "$@" test x=1 "$@" "$@" local
+		/usr/bin grep echo then export
+cd | then test done $(pwd) "$@" $(pwd) | local
+then | 'quoted text' 'quoted text' grep awk | /usr/bin
+	echo readonly | -eu x=1 test -eu -eu | 2>/dev/null printf local 2>/dev/null |
+		--verbose x=1 /usr/bin -eu test then ${HOME}
+	"$@" --verbose test $(pwd)
+	readonly local 2>/dev/null grep cd test sed x=1 /usr/bin test test
+/usr/bin sed "$@" x=1 /usr/bin local | 'quoted text' 'quoted text' readonly
+export readonly awk printf 'quoted text' readonly done --verbose
+export ${HOME} grep awk ${HOME} grep && x=1 test export test 'quoted text' readonly
+"$1" sed ${HOME} 'quoted text' then "$1"
+	-eu --verbose 'quoted text' /usr/bin |
+	sed cd cd cd awk cd grep printf export -eu awk 2>/dev/null
+	awk | /usr/bin 'quoted text' readonly 2>/dev/null -eu $(pwd) local 2>/dev/null
+		then $(pwd) printf awk local readonly "$@" x=1 ${HOME} cd done "$@"
+	test "$@" grep done awk "$@" ${HOME}
+export export 2>/dev/null done printf 'quoted text' then && done awk /usr/bin
+$(pwd) && local $(pwd) && printf 2>/dev/null
+	awk grep | sed --verbose test test
+-eu 2>/dev/null ${HOME} echo then grep /usr/bin x=1 $(pwd)
+		${HOME} ${HOME} 2>/dev/null then
+$(pwd) test $(pwd) grep then $(pwd) then 'quoted text' $(pwd) export 2>/dev/null
+"$1" ${HOME} /usr/bin "$1" $(pwd) /usr/bin
+	printf $(pwd) readonly x=1 ${HOME} then done grep ${HOME}
+		2>/dev/null | export 'quoted text' awk awk awk local --verbose "$1"
+		test ${HOME} x=1 'quoted text' 'quoted text'
+	then grep ${HOME} --verbose $(pwd) awk done && "$1" done |
+		${HOME} echo local | readonly test
+		| done "$@" x=1 'quoted text' /usr/bin echo "$1" grep echo done cd
+	printf --verbose | | "$1" --verbose $(pwd) local -eu && "$@" |
+then | sed grep grep cd && then awk done /usr/bin export -eu readonly
+readonly sed then -eu 'quoted text' "$@" grep "$@" ${HOME} readonly
+x=1 x=1 then local "$1" && awk done grep --verbose sed | "$1" -eu x=1 cd then
+		| 2>/dev/null ${HOME} echo echo /usr/bin export
+		done 2>/dev/null $(pwd) ${HOME} done sed done done cd sed
+| readonly $(pwd) "$1" export cd then export echo
+		cd --verbose awk | echo x=1 --verbose test --verbose
+'quoted text' done test cd $(pwd) cd $(pwd) 2>/dev/null
+x=1 then 'quoted text' grep cd printf "$1" --verbose
+"$@" 2>/dev/null echo 'quoted text' test /usr/bin awk $(pwd) test grep | done
+		then /usr/bin awk /usr/bin x=1 done "$@" $(pwd) awk
+	--verbose "$1" 2>/dev/null x=1 export grep x=1 awk test x=1 "$@" "$1" &&
+done readonly --verbose export done --verbose --verbose cd && --verbose sed
+		${HOME} cd test /usr/bin
+		local echo "$@" done /usr/bin then cd awk /usr/bin && local $(pwd)
+	-eu done export readonly cd sed "$1" -eu echo printf echo $(pwd) readonly --verbose
+	echo x=1 ${HOME} grep 'quoted text'
+		sed -eu sed echo local "$@" awk printf grep then then x=1 printf --verbose
+	x=1 /usr/bin 2>/dev/null | local "$1" then cd test grep | awk /usr/bin "$@"
+	"$@" awk x=1 printf printf $(pwd) export cd "$1" grep then "$@" then
+	done test 2>/dev/null awk
+done done 'quoted text' && && && local | ${HOME}
+'quoted text' x=1 printf 'quoted text'
+		local sed readonly then "$1" 'quoted text' $(pwd)
+| local awk "$@" 2>/dev/null x=1 export "$1" /usr/bin
+$(pwd) | /usr/bin x=1 printf $(pwd) grep test && then && export "$@"
+	done grep readonly ${HOME} && echo 2>/dev/null test local 'quoted text' cd
+cd echo printf --verbose export --verbose done $(pwd) cd "$1" 'quoted text' $(pwd)
+/usr/bin sed 2>/dev/null readonly
+	${HOME} grep test /usr/bin --verbose -eu
+		"$@" ${HOME} /usr/bin /usr/bin test 'quoted text' readonly /usr/bin
+	awk -eu echo test echo 2>/dev/null
+&& then --verbose "$@" awk cd printf readonly
+&& awk awk -eu readonly --verbose readonly | local cd awk awk local 'quoted text'
+	"$@" /usr/bin /usr/bin 2>/dev/null x=1 then && && test done /usr/bin --verbose
+	${HOME} -eu awk awk cd ${HOME} x=1 | "$1" export 'quoted text' readonly $(pwd)
+	printf /usr/bin then && -eu done x=1 && 2>/dev/null printf 'quoted text'
+	${HOME} then printf done 'quoted text' "$@" 2>/dev/null x=1
+	test ${HOME} awk -eu test 2>/dev/null x=1 x=1 --verbose cd |
+	${HOME} local export export cd 'quoted text' && ${HOME}
+	then awk -eu readonly echo sed echo cd printf test && cd /usr/bin 'quoted text'
+echo 'quoted text' local grep
+		echo $(pwd) test x=1 /usr/bin
+| cd "$@" done export local sed local
+export then "$1" x=1 then awk test
+	sed ${HOME} $(pwd) test "$@" $(pwd) "$@" test local readonly
+printf local echo grep -eu then "$@" ${HOME} readonly done cd /usr/bin
+		grep then done export 'quoted text' echo
+/usr/bin -eu x=1 readonly done 'quoted text' awk
+printf --verbose | --verbose
+	local printf -eu readonly done sed readonly /usr/bin
+	${HOME} 'quoted text' -eu done x=1 | ${HOME} cd 2>/dev/null then sed awk printf
+		x=1 'quoted text' then x=1 done printf
+	"$@" sed printf awk grep done done echo export awk -eu && sed
+sed readonly /usr/bin "$@" && local echo $(pwd)
+local sed readonly ${HOME} then
+	${HOME} grep "$1" done /usr/bin --verbose echo echo
+	local done ${HOME} export local | then 2>/dev/null | 'quoted text' ${HOME}
+	/usr/bin --verbose awk done | cd --verbose
+	x=1 ${HOME} 2>/dev/null && grep printf awk "$@" --verbose
+	local /usr/bin "$1" $(pwd) local 'quoted text'
+	'quoted text' local 2>/dev/null
+		--verbose test 2>/dev/null 2>/dev/null sed export printf grep printf
+		&& /usr/bin $(pwd) | done then --verbose
+"$1" "$@" then awk local local test grep -eu export
+		export --verbose && echo && printf | cd done export "$1" "$1"
+		done local echo ${HOME} && readonly && /usr/bin export 'quoted text' ${HOME} echo
+	x=1 'quoted text' | grep | x=1
+		&& && then echo echo echo readonly $(pwd) --verbose
+export sed sed && local && printf x=1 && test 2>/dev/null printf
+cd sed echo /usr/bin cd -eu 'quoted text'
+		"$1" printf 2>/dev/null -eu 2>/dev/null then printf
+	then grep sed readonly --verbose done readonly readonly 'quoted text' $(pwd)
+		sed | x=1 --verbose 'quoted text' && --verbose
+grep $(pwd) sed local $(pwd) printf printf cd
+	done ${HOME} export echo readonly x=1 local export "$@"
+	--verbose test printf done /usr/bin
+	"$@" | x=1 grep /usr/bin
+-eu $(pwd) test 2>/dev/null sed && local then $(pwd) cd "$1" "$1" readonly
+		cd done 2>/dev/null test ${HOME} sed | printf export local awk sed /usr/bin
+"$@" test local sed done "$1" /usr/bin "$1" /usr/bin printf 2>/dev/null | printf
+cd 'quoted text' "$1" ${HOME} x=1 --verbose "$1" && cd awk -eu printf done "$1"
+	2>/dev/null $(pwd) readonly
+		'quoted text' --verbose cd readonly sed "$@" -eu printf done
+		readonly x=1 /usr/bin then local
+		--verbose 2>/dev/null x=1 --verbose echo | 2>/dev/null echo | cd x=1 test
+	--verbose cd awk -eu --verbose grep 'quoted text'
+		test local export ${HOME} $(pwd)
+		done -eu local --verbose done "$@" then test x=1 then 2>/dev/null sed
+		"$1" export done --verbose printf "$1" awk then 2>/dev/null
+	then ${HOME} grep then test then x=1 export grep 'quoted text' echo
+		"$1" export printf "$1" "$1" && local -eu test $(pwd) && test && 'quoted text'
+		x=1 readonly echo done readonly then grep
+cd "$1" "$@" 2>/dev/null awk --verbose local && --verbose 2>/dev/null
+x=1 sed --verbose 'quoted text' test then export "$@" readonly
+		&& | "$1" $(pwd) grep done sed
+export 'quoted text' test 'quoted text' ${HOME} 'quoted text'
+	&& sed then ${HOME} |
+		printf readonly sed ${HOME} -eu sed grep
+		&& cd "$@" printf -eu cd ${HOME} | local local readonly "$@" ${HOME} --verbose
+	--verbose done -eu ${HOME} -eu $(pwd) $(pwd) -eu 'quoted text' "$1" /usr/bin
+then 2>/dev/null readonly "$1" echo $(pwd)
+	readonly test 'quoted text' printf $(pwd) --verbose readonly test awk /usr/bin
+		sed test 2>/dev/null
+	awk then "$1" printf awk awk -eu done grep awk /usr/bin grep then done
+readonly readonly x=1 local /usr/bin done
+grep sed then 2>/dev/null export x=1 && 2>/dev/null
+	done -eu grep && readonly 2>/dev/null | 'quoted text'
+		| 2>/dev/null /usr/bin "$@" sed "$1" | "$@" sed test cd cd --verbose export
+		test | /usr/bin local echo then grep test | "$@" echo local
+	-eu grep | 2>/dev/null x=1 grep -eu readonly done 2>/dev/null
+		test 2>/dev/null $(pwd) | echo "$@" | echo 'quoted text' awk export --verbose
+	| -eu local 2>/dev/null
+	grep grep ${HOME} && grep "$1" cd "$@" ${HOME} /usr/bin
+2>/dev/null | ${HOME} -eu && done grep cd echo
+	| readonly echo 'quoted text' then export awk | x=1
+-eu | local then export grep printf "$@" "$@" && && local awk | cd 'quoted text'
+		grep local $(pwd) "$1" printf "$@" readonly | cd -eu echo sed grep echo sed export
+2>/dev/null x=1 'quoted text' && -eu grep | "$1" awk x=1 ${HOME}
+	| $(pwd) echo ${HOME} /usr/bin -eu
+	sed readonly then printf readonly ${HOME} done "$@" ${HOME} printf
+	done readonly readonly $(pwd) echo
+then && | cd /usr/bin x=1 "$1" /usr/bin printf 'quoted text' then
+echo 'quoted text' /usr/bin && awk --verbose echo echo x=1 -eu 'quoted text'
+		local --verbose test readonly /usr/bin done done test echo
+		grep "$1" x=1 sed -eu done printf 'quoted text' sed
+grep && 'quoted text' cd /usr/bin grep ${HOME} ${HOME}
+	done local "$@" | "$1" ${HOME} export x=1 done cd "$1" -eu
+		readonly awk test -eu done awk awk
+	"$@" $(pwd) test x=1 "$@" 2>/dev/null 2>/dev/null 'quoted text'
+	printf awk 2>/dev/null test cd ${HOME} --verbose ${HOME} test --verbose printf
+	"$@" export x=1 grep "$1" ${HOME} 2>/dev/null $(pwd)
+		2>/dev/null | "$1" export 2>/dev/null --verbose
+"$1" export /usr/bin sed "$@" | 2>/dev/null awk x=1 test cd && x=1
+awk printf test test
+'quoted text' x=1 printf then 'quoted text' sed -eu && x=1 cd "$1" -eu --verbose
+$(pwd) local ${HOME} ${HOME} 2>/dev/null ${HOME} awk
+${HOME} $(pwd) cd then local ${HOME} readonly "$1" "$1"
+--verbose 'quoted text' cd && | --verbose $(pwd) then /usr/bin -eu test 'quoted text'
+then export 'quoted text' $(pwd) 'quoted text' printf -eu /usr/bin
+"$@" grep /usr/bin | echo cd awk cd -eu -eu cd sed -eu -eu cd echo
+done sed | cd test --verbose "$1" x=1 done 2>/dev/null cd 'quoted text'
+		| $(pwd) done ${HOME} "$1" |
+local 2>/dev/null echo export printf "$1" readonly sed then 2>/dev/null
+	test -eu 'quoted text' x=1 'quoted text' echo done "$@" readonly
+	local "$1" sed -eu grep -eu "$@" printf --verbose done x=1 cd "$1" |
+		"$1" local 'quoted text'
+		printf test x=1 --verbose ${HOME} /usr/bin
+		-eu echo local local --verbose -eu cd grep readonly 'quoted text'
+&& local awk awk grep
+test done awk /usr/bin export -eu cd test export && then echo
+	grep cd --verbose cd awk ${HOME} test awk sed printf echo export "$@" /usr/bin
+x=1 echo "$1" test then x=1 2>/dev/null --verbose
+'quoted text' && readonly 'quoted text' readonly
+test "$1" sed printf 'quoted text' "$@"
+		local && awk done export /usr/bin
+local test awk test done test grep -eu readonly --verbose export
+	-eu test -eu then echo 2>/dev/null -eu awk readonly then --verbose $(pwd)
+	| /usr/bin export 'quoted text' awk printf grep
+	done local -eu test "$1" readonly
+$(pwd) | readonly export export -eu && export
+	--verbose && /usr/bin cd && printf export --verbose sed local "$@" done | /usr/bin
+		local "$@" ${HOME} && grep test test readonly /usr/bin
+	x=1 export | printf /usr/bin sed --verbose "$1" 2>/dev/null printf readonly
+		&& export export cd $(pwd) awk "$@"
+	done 2>/dev/null "$@" && grep awk printf then grep --verbose grep export
+printf sed awk awk x=1 /usr/bin echo cd x=1 cd && /usr/bin export 'quoted text'
+		awk grep | 'quoted text' then && sed done done
+	"$1" -eu export readonly
+printf -eu then sed ${HOME} then printf
+${HOME} | echo x=1 2>/dev/null "$@" readonly -eu ${HOME} 2>/dev/null "$1"
+x=1 cd awk "$1" --verbose 2>/dev/null echo
+| "$1" "$@" 2>/dev/null --verbose
+	cd readonly x=1 2>/dev/null "$@" echo --verbose awk && -eu
+	local -eu export done
+	cd | readonly cd 2>/dev/null 'quoted text' printf readonly export test sed
+	x=1 local -eu export ${HOME} x=1 "$1"
+grep -eu 2>/dev/null echo export printf --verbose cd $(pwd)
+		| -eu $(pwd) 2>/dev/null printf ${HOME} test && ${HOME} readonly printf
+		--verbose local 2>/dev/null then --verbose done
+	2>/dev/null "$1" echo readonly
+	"$1" "$1" readonly "$1" export echo "$@" "$1" -eu x=1 | export /usr/bin test
+	local /usr/bin export sed grep 'quoted text' 'quoted text' printf echo export
+		done && local 'quoted text' 2>/dev/null
+		test && /usr/bin ${HOME} printf
+'quoted text' done -eu done && sed awk local echo "$1" printf x=1 $(pwd)
+		$(pwd) "$@" echo x=1 "$1" test
+2>/dev/null 'quoted text' echo "$1" then
+		"$@" $(pwd) readonly ${HOME} 'quoted text' x=1 2>/dev/null
+	cd local echo && x=1 -eu
+$(pwd) $(pwd) --verbose
+		cd local grep printf printf && printf readonly && /usr/bin 2>/dev/null done --verbose
+		${HOME} "$1" 2>/dev/null done ${HOME} readonly -eu
+		awk x=1 ${HOME} /usr/bin x=1 awk
+		${HOME} grep x=1 then grep echo export then awk /usr/bin --verbose done "$@"
+"$@" awk $(pwd) test test
+		2>/dev/null grep sed done export grep && done printf "$@"
+"$1" readonly sed /usr/bin -eu && "$1" readonly "$1" -eu export "$@"
+		test 'quoted text' test -eu /usr/bin then && 'quoted text' echo cd echo ${HOME}
+	&& "$1" x=1 test export sed x=1 awk echo
+	sed 'quoted text' --verbose ${HOME} 2>/dev/null $(pwd) /usr/bin
+test echo 'quoted text' -eu echo -eu cd test 2>/dev/null sed
+sed 'quoted text' 'quoted text'
+		"$@" done $(pwd) awk x=1 cd echo --verbose readonly
+		echo readonly /usr/bin /usr/bin "$@" x=1 "$1" awk "$@" echo ${HOME}
+		&& $(pwd) "$@" -eu grep export done
+	&& printf grep local echo 2>/dev/null grep
+${HOME} && export printf 2>/dev/null
+		readonly printf readonly && cd $(pwd) $(pwd)
+--verbose grep ${HOME} then ${HOME} ${HOME} 2>/dev/null cd export | && readonly
+local readonly sed "$@" $(pwd) printf -eu test
+	/usr/bin grep sed grep cd printf "$@" test echo /usr/bin echo cd
+	export "$@" awk -eu awk test sed done && test sed | /usr/bin local --verbose
+awk /usr/bin /usr/bin ${HOME} then local test "$@" echo | done $(pwd) | --verbose
+		-eu 'quoted text' awk
+	'quoted text' && $(pwd) /usr/bin grep x=1 -eu export test x=1 x=1
+	done /usr/bin test cd | printf sed "$1" x=1 awk
+readonly test | echo
+		cd --verbose local export printf
+	"$1" $(pwd) "$1" "$@" /usr/bin awk "$1" --verbose | /usr/bin && 'quoted text'
+		-eu 'quoted text' cd x=1 /usr/bin readonly ${HOME} 2>/dev/null awk
+cd && done cd echo test /usr/bin
+		--verbose -eu sed $(pwd)
+&& then cd x=1 grep echo
+	echo --verbose readonly sed echo "$@" "$1"
+	2>/dev/null then printf && 'quoted text' sed
+		&& export grep sed export
+	test 'quoted text' echo local local done $(pwd)
+-eu ${HOME} $(pwd) /usr/bin "$@" local
+		printf 'quoted text' && done $(pwd) &&
+	export /usr/bin readonly sed cd
+		echo grep | && local test && "$@" awk then
+	${HOME} export test "$1" 'quoted text'
+	done echo "$@" sed x=1 echo readonly done test printf local $(pwd) awk
+	"$@" local 'quoted text' --verbose test | done done
+export ${HOME} 2>/dev/null awk
+sed --verbose grep -eu
+		${HOME} sed sed "$1" | x=1 "$@" "$1" --verbose local echo --verbose ${HOME} x=1
+		/usr/bin /usr/bin printf local x=1 local export
+readonly && grep export export --verbose --verbose readonly cd printf then awk local
+	'quoted text' x=1 "$1" "$1" cd sed &&
+sed "$1" "$@" then -eu "$@" done sed readonly test $(pwd)
+		echo 2>/dev/null x=1 ${HOME} test export x=1 printf awk then readonly
+	done cd "$@" readonly
+		'quoted text' printf then sed awk done ${HOME} 2>/dev/null
+		/usr/bin -eu then echo "$@" cd awk
+		/usr/bin -eu export --verbose local --verbose "$@"
+		2>/dev/null 2>/dev/null $(pwd) 2>/dev/null
+		done ${HOME} "$@" 'quoted text' then test then done echo 2>/dev/null
+	/usr/bin "$1" sed printf 'quoted text' readonly awk -eu --verbose
+awk awk sed local | 'quoted text' |
+	then x=1 done -eu "$@" cd
+		cd then awk $(pwd) done readonly sed && 'quoted text' -eu 'quoted text'
+echo cd ${HOME} test -eu done
+		/usr/bin export ${HOME} cd && cd awk 'quoted text' ${HOME} /usr/bin "$1"
+	/usr/bin x=1 local echo ${HOME}
+cd then x=1 readonly x=1 readonly awk export sed echo sed x=1 done ${HOME}
+		--verbose readonly --verbose $(pwd) awk "$1" 2>/dev/null
+export grep "$@" printf local readonly | ${HOME} grep then /usr/bin
+	test awk echo awk export "$1" &&
+	--verbose readonly cd printf ${HOME} | && grep "$@" "$@"
+printf test -eu printf export 2>/dev/null then -eu x=1 readonly -eu
+	| -eu && grep && $(pwd) local 2>/dev/null cd sed 'quoted text'
+		/usr/bin /usr/bin ${HOME} "$1" |
+	x=1 && sed test echo "$@" x=1 "$@" $(pwd) 'quoted text'
+		--verbose && "$1" then cd | --verbose
+	awk ${HOME} export test $(pwd) && sed done test awk "$1" cd && sed
+	2>/dev/null awk export readonly "$@" /usr/bin test
+		${HOME} awk | then export printf cd x=1 sed test awk "$@" printf done
+	local sed printf export && grep 'quoted text' cd echo
+		grep awk -eu export echo ${HOME} x=1 test awk done printf
+		x=1 "$1" "$1" export then grep echo && --verbose && "$1" && readonly
+	"$1" x=1 $(pwd) 2>/dev/null --verbose
+	test /usr/bin readonly readonly cd 2>/dev/null "$1"
+		printf done $(pwd) local cd 2>/dev/null 2>/dev/null
+-eu /usr/bin grep then test | export echo then printf printf
+cd export cd awk | --verbose
+		readonly $(pwd) "$1" echo 'quoted text'
@@ -0,0 +1,2001 @@
+readonly -eu readonly test printf cd readonly
+		sed && && "$@" then 2>/dev/null grep 2>/dev/null echo then grep 2>/dev/null
+cd $(pwd) export test | 'quoted text' "$@" export ${HOME} then export
+	$(pwd) export local --verbose -eu /usr/bin sed 'quoted text'
+${HOME} x=1 $(pwd) $(pwd) local echo cd "$@" &&
+local /usr/bin test echo x=1 /usr/bin echo /usr/bin
+	x=1 --verbose grep awk | -eu "$@" grep local "$1" awk
+		x=1 grep "$1" printf 'quoted text' then then printf
+2>/dev/null && grep readonly printf x=1 2>/dev/null 2>/dev/null && x=1 cd export
+	then $(pwd) "$@" test local "$@" grep && done | awk grep then
+$(pwd) then x=1 grep x=1 "$1" test printf awk test
+		awk 'quoted text' sed export $(pwd) x=1 grep echo echo && printf
+grep echo done printf sed grep cd 2>/dev/null done | awk
+'quoted text' local | --verbose
+		readonly cd test | printf readonly grep --verbose $(pwd) awk
+done printf $(pwd) 2>/dev/null && $(pwd) $(pwd) $(pwd) sed ${HOME} done readonly
+		local sed "$@" test ${HOME} grep sed ${HOME} $(pwd) sed done cd echo
+--verbose cd grep echo test sed ${HOME} --verbose $(pwd)
+	local done $(pwd) "$@"
+		grep $(pwd) ${HOME} printf x=1 then test ${HOME} readonly
+		done then echo --verbose done sed
+		2>/dev/null /usr/bin -eu $(pwd)
+	grep cd test echo test test cd ${HOME} | 2>/dev/null sed $(pwd)
+test 2>/dev/null export ${HOME} $(pwd) local
+	export test echo printf | "$@" cd ${HOME} $(pwd) awk x=1 local echo
+	sed done -eu cd cd echo /usr/bin &&
+	x=1 "$1" echo 'quoted text' done $(pwd) /usr/bin && | then then grep
+	export 'quoted text' grep sed 'quoted text'
+	&& done ${HOME} sed local 'quoted text'
+	$(pwd) $(pwd) grep grep | awk | readonly --verbose "$1" ${HOME} printf
+		then awk 2>/dev/null "$1" | "$@" 'quoted text' | --verbose "$@" && "$@" sed
+readonly -eu ${HOME} done
+	sed ${HOME} && | grep then printf && 2>/dev/null | test
+		then grep -eu local $(pwd) cd readonly done | cd then $(pwd) grep printf
+	echo | readonly grep echo x=1 cd /usr/bin readonly
+--verbose $(pwd) x=1 /usr/bin grep local printf && test $(pwd) echo ${HOME} then
+${HOME} 2>/dev/null echo -eu then then printf 'quoted text' "$@" grep grep
+-eu then then grep && --verbose echo export $(pwd) then test 2>/dev/null -eu
+	${HOME} 'quoted text' $(pwd) echo sed /usr/bin echo done awk
+$(pwd) grep cd --verbose x=1 then export "$1" | then printf awk "$1"
+2>/dev/null --verbose then -eu -eu test x=1 readonly cd "$@"
+		readonly readonly "$1" | "$1" awk 'quoted text' -eu echo grep
+	done "$1" readonly local test | test -eu done "$@" --verbose test "$@"
+		test export && printf "$@" sed then then | "$@" printf cd "$@" x=1 done 'quoted text'
+awk 'quoted text' $(pwd) 'quoted text' done cd printf echo | grep -eu local
+	${HOME} export $(pwd) -eu grep then
+	${HOME} x=1 'quoted text' 2>/dev/null printf
+	test -eu echo --verbose x=1 'quoted text' --verbose cd $(pwd)
+		--verbose test 'quoted text' $(pwd) -eu then local && 'quoted text' $(pwd) ${HOME}
+	sed $(pwd) export printf | sed --verbose $(pwd)
+	grep && 2>/dev/null printf --verbose readonly sed -eu readonly
+		export 2>/dev/null local && export then export
+		cd 'quoted text' && readonly --verbose echo echo ${HOME} x=1 sed /usr/bin -eu
+		$(pwd) awk /usr/bin echo grep "$1" echo /usr/bin cd /usr/bin ${HOME} $(pwd)
+-eu | 2>/dev/null $(pwd) local test done
+		--verbose test -eu export echo "$@" 'quoted text' then
+	"$@" ${HOME} x=1 x=1 sed done -eu "$1" --verbose "$1" | readonly && echo && export
+-eu cd "$1" awk export printf sed --verbose ${HOME}
+	test done && $(pwd) done && printf "$1" export 'quoted text'
+		| export 'quoted text' /usr/bin
+		awk --verbose printf && export -eu $(pwd)
+	x=1 awk test awk grep grep /usr/bin "$1" ${HOME} "$1" awk readonly printf
+printf echo "$@" "$@" test
+		${HOME} 'quoted text' "$1" ${HOME}
+		cd echo test then readonly readonly | "$@" then cd local --verbose echo &&
+		export local -eu /usr/bin ${HOME} sed | $(pwd) local $(pwd) $(pwd) "$1"
+	| && 'quoted text' echo echo | -eu grep
+		export x=1 cd --verbose 'quoted text'
+	awk local readonly --verbose | "$1" 'quoted text' cd export printf --verbose awk
+		$(pwd) export test test -eu printf done
+		-eu grep grep | x=1 done test test -eu awk && /usr/bin
+	test cd awk $(pwd) grep local -eu grep ${HOME} sed /usr/bin export awk -eu "$1"
+		--verbose -eu && echo ${HOME} | test "$1" && awk
+		--verbose echo "$@" cd "$1" awk test $(pwd) ${HOME} cd
+	printf | readonly done 'quoted text'
+	--verbose /usr/bin -eu sed grep
+cd && grep && "$@" "$@" local then |
+x=1 awk cd $(pwd) ${HOME} 2>/dev/null export test
+	-eu awk /usr/bin /usr/bin
+done echo then x=1 local test && test awk && 'quoted text'
+		cd done -eu grep awk test 2>/dev/null ${HOME}
+"$1" awk $(pwd) "$1" x=1 export "$@" /usr/bin && local $(pwd) awk -eu "$@" /usr/bin
+		/usr/bin sed sed printf done && 'quoted text' local sed
+		grep "$1" 2>/dev/null grep --verbose 'quoted text' && 'quoted text' grep 'quoted text'
+'quoted text' export printf export /usr/bin sed ${HOME} x=1
+	'quoted text' && readonly --verbose done done sed
+		"$1" ${HOME} test cd done -eu -eu test cd awk local
+	done printf local x=1 | export "$1" sed test test sed then -eu local printf
+		2>/dev/null --verbose grep printf 'quoted text' cd local readonly grep 2>/dev/null
+	x=1 then --verbose -eu 2>/dev/null printf cd readonly x=1 --verbose
+	printf awk export export --verbose 'quoted text'
+		readonly local export readonly 2>/dev/null
+	cd done local sed echo printf /usr/bin
+	test sed /usr/bin $(pwd)
+	${HOME} 'quoted text' 'quoted text' export /usr/bin cd test echo 2>/dev/null
+	done then 2>/dev/null $(pwd) sed test "$1" done printf readonly then test printf
+	x=1 ${HOME} printf 'quoted text' "$@" -eu 'quoted text' done
+	export -eu test export $(pwd) readonly
+awk export -eu x=1 printf 2>/dev/null
+printf | readonly | /usr/bin export readonly $(pwd) "$@" then done done
+		/usr/bin cd grep --verbose |
+	'quoted text' readonly x=1 cd echo printf | export
+		${HOME} printf "$@" $(pwd)
+printf "$@" ${HOME} 2>/dev/null printf --verbose $(pwd) /usr/bin && | $(pwd)
+	/usr/bin test sed | x=1 awk cd printf done 'quoted text' | | -eu /usr/bin
+		printf x=1 | | sed ${HOME} test awk $(pwd) 'quoted text'
+	sed $(pwd) 'quoted text' --verbose && "$@"
+&& then | && ${HOME} grep /usr/bin test x=1 echo x=1 readonly 2>/dev/null grep
+cd "$1" done && done "$1" done done /usr/bin | export grep readonly
+${HOME} 'quoted text' printf
+	-eu test echo -eu --verbose ${HOME} 'quoted text' printf test /usr/bin $(pwd)
+awk grep 2>/dev/null sed &&
+	local awk cd cd 'quoted text' cd --verbose
+&& "$1" sed local export test printf && readonly "$@" -eu done
+local local readonly export awk
+		then cd | x=1 "$@" readonly
+readonly readonly export cd local
+awk cd printf export then -eu printf readonly
+	awk local awk "$1" | x=1 then "$1" sed --verbose 2>/dev/null
+		${HOME} test awk readonly "$1" printf 'quoted text'
+	export grep 2>/dev/null grep sed done
+		export cd ${HOME} cd done x=1 export | $(pwd) then ${HOME}
+awk ${HOME} "$1" "$@" "$@" sed export grep awk printf
+	"$@" local echo | printf /usr/bin /usr/bin export
+'quoted text' | "$1" cd 2>/dev/null $(pwd) | $(pwd) sed done echo local | -eu
+	cd local && local ${HOME} grep 2>/dev/null test cd
+awk 'quoted text' && cd x=1 $(pwd) done awk x=1 x=1 | -eu
+		--verbose then | 'quoted text'
+		printf /usr/bin done ${HOME} | readonly && test printf echo "$1"
+export | awk "$1" cd | cd x=1
+		readonly test | grep /usr/bin /usr/bin -eu 2>/dev/null
+"$1" readonly readonly "$@" x=1 local printf cd /usr/bin
+then | grep echo printf test 2>/dev/null echo x=1
+		| test test local 2>/dev/null export --verbose
+awk local --verbose sed 2>/dev/null --verbose
+	$(pwd) x=1 && "$1" readonly done "$@" 'quoted text' printf grep printf 'quoted text'
+awk /usr/bin "$1" 2>/dev/null
+		test && x=1 2>/dev/null && $(pwd) 'quoted text'
+	"$1" "$1" readonly done --verbose echo cd x=1 echo
+		2>/dev/null export local test -eu export local export
+	then sed --verbose export export "$@" printf grep echo
+		2>/dev/null --verbose done awk printf export && export
+	then ${HOME} "$@" test done readonly cd done && "$1" export
+		"$@" done /usr/bin "$1" | export | local x=1 "$@" "$1"
+	done $(pwd) done done then "$@" $(pwd) "$@" readonly "$@" printf $(pwd) ${HOME}
+		| sed 2>/dev/null then
+&& x=1 | 2>/dev/null test printf x=1 done done test "$1" ${HOME}
+	done ${HOME} done done readonly sed "$1" | cd --verbose local
+		readonly echo 'quoted text' sed printf export 'quoted text' | ${HOME}
+		then && "$1" done $(pwd) | export printf ${HOME}
+	local echo ${HOME} ${HOME} "$1" $(pwd) 'quoted text' "$@" "$@" 'quoted text'
+	--verbose cd "$@" test
+		cd done local 'quoted text' echo ${HOME} "$1" export
+'quoted text' "$1" -eu echo test "$1" x=1 x=1 --verbose readonly /usr/bin readonly
+	export readonly | export x=1 2>/dev/null
+cd 2>/dev/null --verbose done x=1 local sed && --verbose 'quoted text' && grep
+	"$@" test then 2>/dev/null grep | done
+	/usr/bin x=1 2>/dev/null x=1 cd awk | 'quoted text' "$@" 2>/dev/null
+	&& && x=1 echo "$1" printf cd && printf printf -eu
+${HOME} ${HOME} export cd x=1 grep 2>/dev/null
+echo awk sed grep then && "$@" export
+	/usr/bin && sed then echo --verbose
+-eu --verbose done ${HOME}
+		cd | "$1" --verbose export "$@" --verbose -eu --verbose sed printf local
+export export printf 2>/dev/null grep |
+		| x=1 x=1 sed sed awk readonly /usr/bin done printf cd x=1
+'quoted text' printf cd readonly printf echo ${HOME} awk done -eu awk
+		done test x=1 then printf
+	test local "$@" /usr/bin
+grep -eu 2>/dev/null cd /usr/bin test "$1" "$@" echo local
+/usr/bin printf --verbose local /usr/bin 2>/dev/null
+		| /usr/bin --verbose export --verbose 'quoted text'
+	-eu "$1" awk sed ${HOME} cd $(pwd) awk test printf local x=1 -eu &&
+"$1" ${HOME} | cd grep x=1 "$@"
+		test then /usr/bin ${HOME} printf sed printf ${HOME}
+		2>/dev/null sed ${HOME} grep | | $(pwd) 'quoted text' then awk then sed printf
+	done 2>/dev/null 'quoted text' then "$@" && $(pwd) readonly $(pwd) grep sed x=1
+		then | then grep "$@" grep echo
+printf --verbose then sed printf && done awk
+		x=1 && done sed ${HOME} "$1" 'quoted text' | echo && "$1"
+	done local ${HOME} awk then $(pwd)
+readonly "$1" test local cd "$1" /usr/bin test awk "$@" cd "$1" done
+	--verbose x=1 ${HOME} x=1 test --verbose --verbose 2>/dev/null then "$1" readonly
+then test awk echo -eu /usr/bin cd x=1 cd && awk grep | sed | /usr/bin
+	x=1 export test ${HOME} ${HOME} --verbose
+		| -eu awk then && echo 'quoted text'
+'quoted text' --verbose sed cd --verbose -eu echo echo cd grep export printf
+grep | sed echo done "$1" -eu $(pwd) $(pwd) then readonly
+		$(pwd) --verbose done 2>/dev/null
+		2>/dev/null "$1" test && 2>/dev/null "$@" grep $(pwd) && $(pwd) 'quoted text'
+		printf ${HOME} printf "$@" sed $(pwd)
+"$1" export cd "$1" cd done readonly x=1 grep && echo /usr/bin readonly 'quoted text'
+		$(pwd) local -eu sed 'quoted text' grep ${HOME} test done done
+		2>/dev/null "$@" $(pwd) /usr/bin then "$@" cd ${HOME} "$1" then sed --verbose
+		echo sed test then printf then "$@" done done sed /usr/bin
+grep awk done cd x=1 then grep
+		${HOME} 2>/dev/null done 2>/dev/null && $(pwd) sed "$@" 2>/dev/null echo
+	export -eu 2>/dev/null 2>/dev/null printf
+	readonly printf done "$1" sed /usr/bin && grep then cd && export test
+export echo && sed export test
+		export sed --verbose "$1" export $(pwd) grep && printf awk --verbose
+echo sed echo 2>/dev/null
+awk 'quoted text' -eu export local sed then printf /usr/bin "$@"
+	readonly done 'quoted text' 'quoted text'
+		sed --verbose done 2>/dev/null /usr/bin 2>/dev/null readonly done 'quoted text'
+	cd local "$@" done done export readonly
+		sed cd printf "$@" | echo export cd --verbose echo awk x=1 'quoted text' printf
+		&& /usr/bin export 2>/dev/null awk sed 2>/dev/null /usr/bin done export
+x=1 test "$1" echo grep
+	"$1" 2>/dev/null --verbose -eu grep && /usr/bin sed $(pwd) 2>/dev/null
+		-eu done printf readonly ${HOME}
+'quoted text' "$@" -eu done echo readonly then
+	$(pwd) sed "$@" cd ${HOME} ${HOME} "$1" local test x=1 export | awk && readonly
+		test x=1 /usr/bin readonly 2>/dev/null
+/usr/bin ${HOME} test -eu 2>/dev/null x=1 awk -eu grep /usr/bin cd
+		"$1" echo echo done ${HOME} /usr/bin 'quoted text' awk then done "$@" grep x=1
+	--verbose local -eu cd printf grep printf sed "$@" -eu -eu ${HOME} test readonly
+		done grep | cd -eu grep then
+		awk && --verbose /usr/bin
+		test awk done 2>/dev/null "$@" readonly local echo --verbose
+		--verbose export local export readonly --verbose done export --verbose
+| x=1 grep echo && | $(pwd) "$@" 'quoted text' 'quoted text'
+	then cd echo && test 2>/dev/null /usr/bin x=1 x=1 ${HOME}
+export 2>/dev/null --verbose -eu 'quoted text' "$1" sed
+$(pwd) cd printf cd then echo x=1 readonly export &&
+"$@" grep -eu printf sed ${HOME} local 'quoted text'
+	-eu readonly 'quoted text' readonly x=1 2>/dev/null
+--verbose | local sed test -eu echo then
+sed cd echo && grep printf echo sed export
+	| x=1 2>/dev/null x=1 'quoted text' grep ${HOME} | 'quoted text' awk 'quoted text'
+	$(pwd) 2>/dev/null sed -eu test cd 2>/dev/null -eu echo | $(pwd) done awk
+"$@" 'quoted text' awk readonly export
+echo done ${HOME} $(pwd) "$@" 'quoted text' | x=1 $(pwd) x=1 sed printf "$1"
+	'quoted text' test --verbose cd /usr/bin
+	/usr/bin local printf export ${HOME} cd readonly test echo
+x=1 grep x=1 then $(pwd) 2>/dev/null
+		x=1 export test grep test
+$(pwd) grep cd ${HOME} ${HOME} echo
+		&& 'quoted text' --verbose 'quoted text' export --verbose done
+| cd --verbose done grep done awk "$1" ${HOME} done x=1 && | echo
+&& echo -eu test "$1" readonly && echo -eu readonly ${HOME} grep ${HOME}
+cd 'quoted text' then 2>/dev/null
+printf "$@" --verbose "$1" echo cd printf cd readonly awk then && cd local
+&& "$@" cd echo grep test 'quoted text' ${HOME}
+		2>/dev/null awk local grep readonly cd /usr/bin
+		-eu cd /usr/bin $(pwd) "$1"
+	readonly sed grep -eu $(pwd) readonly 'quoted text' | done 2>/dev/null ${HOME}
+done cd grep echo export local done echo done --verbose
+echo 2>/dev/null test sed local done export && x=1
+$(pwd) readonly readonly && grep --verbose echo
+sed /usr/bin && done export local $(pwd) grep
+x=1 ${HOME} then /usr/bin sed done x=1 printf -eu | --verbose |
+		-eu then 2>/dev/null local printf readonly -eu -eu grep x=1 ${HOME} test grep
+echo -eu x=1 sed ${HOME} /usr/bin x=1 'quoted text' cd ${HOME} ${HOME} $(pwd)
+	$(pwd) -eu "$@" $(pwd) &&
+printf | done readonly "$@" --verbose sed local 'quoted text' sed -eu
+sed awk readonly local done
+	local -eu cd local && then cd -eu --verbose export local --verbose "$1" 'quoted text'
+then | printf sed printf test ${HOME} printf sed awk --verbose printf --verbose
+		then test done ${HOME} "$@" printf 2>/dev/null then then done "$@" grep
+printf 2>/dev/null local "$@" 2>/dev/null sed 2>/dev/null local grep
+		echo printf 'quoted text' cd export local 2>/dev/null
+	"$@" done sed grep x=1 cd then 2>/dev/null readonly grep sed --verbose 'quoted text'
+${HOME} 'quoted text' export then test grep sed export 'quoted text'
+/usr/bin echo local printf then 'quoted text' awk
+printf 2>/dev/null done "$1" -eu "$1" local sed -eu 2>/dev/null "$@" readonly
+		cd done | && test test test done ${HOME} then then export 'quoted text'
+		'quoted text' "$@" awk then test readonly cd --verbose | done &&
+$(pwd) 2>/dev/null local then awk "$@"
+--verbose cd | "$@" "$@" ${HOME}
+		readonly readonly local then echo x=1 export 2>/dev/null sed /usr/bin
+	'quoted text' && $(pwd) "$1" local then done export
+x=1 | printf 2>/dev/null -eu /usr/bin then local test 2>/dev/null done done sed
+		readonly /usr/bin ${HOME} $(pwd)
+	${HOME} 'quoted text' grep $(pwd)
+printf grep "$@" "$@" local printf done && then sed
+export sed readonly export cd local 'quoted text'
+		readonly done echo "$1" then export ${HOME}
+done x=1 cd local grep && --verbose local
+echo -eu then x=1 | test "$1" readonly /usr/bin grep
+	x=1 echo grep 2>/dev/null x=1 grep /usr/bin
+echo -eu printf cd 'quoted text' "$@" readonly cd readonly sed /usr/bin
+	2>/dev/null | -eu test --verbose x=1 readonly
+/usr/bin test x=1 2>/dev/null cd 2>/dev/null
+	then awk x=1 x=1 done local local local awk readonly echo /usr/bin 'quoted text'
+		export | && "$@" test local echo
+		then 2>/dev/null readonly /usr/bin "$1" export then test echo
+	"$@" ${HOME} awk test test then then 2>/dev/null then "$1" ${HOME}
+		2>/dev/null x=1 done 'quoted text' "$1" -eu "$1" awk
+		test grep /usr/bin readonly -eu "$1" grep awk
+	| 2>/dev/null 2>/dev/null $(pwd) "$1" | sed printf awk x=1 grep export "$@" -eu
+	| /usr/bin "$1" printf --verbose
+test -eu echo awk readonly -eu awk 2>/dev/null
+awk 'quoted text' x=1 "$1" 'quoted text' && awk "$@" "$1" awk local
+		test grep | export /usr/bin test /usr/bin local | "$1"
+		/usr/bin $(pwd) export |
+		awk ${HOME} -eu --verbose local "$1" echo printf x=1 readonly --verbose ${HOME}
+	export local export local ${HOME} x=1 printf $(pwd) readonly
+		-eu && $(pwd) local /usr/bin done | ${HOME} "$1" && ${HOME} $(pwd) -eu
+		awk ${HOME} -eu export -eu && test cd sed export && x=1 $(pwd) x=1
+		| -eu "$@" ${HOME} 'quoted text' | --verbose export 'quoted text'
+	/usr/bin readonly test 'quoted text' readonly -eu 'quoted text'
+		local test -eu -eu | $(pwd)
+printf "$1" readonly 2>/dev/null x=1 export "$1" "$@" ${HOME} 2>/dev/null
+		&& x=1 then test x=1 x=1 test readonly "$1" then then 2>/dev/null
+local done "$@" echo awk cd local --verbose 2>/dev/null $(pwd) export sed 2>/dev/null
+--verbose readonly readonly "$@" grep | 2>/dev/null -eu 2>/dev/null
+	-eu "$@" then $(pwd) grep ${HOME} ${HOME} "$1" |
+&& x=1 grep && && awk then x=1 export cd
+		$(pwd) done /usr/bin ${HOME} /usr/bin export "$@" done readonly
+		export then ${HOME} local
+		cd x=1 cd -eu -eu export echo sed
+		-eu sed cd export && local echo
+	/usr/bin "$@" /usr/bin readonly
+		printf cd --verbose local x=1 2>/dev/null
+	2>/dev/null x=1 --verbose x=1 then 'quoted text'
+	'quoted text' ${HOME} --verbose test "$1" --verbose sed done readonly &&
+		2>/dev/null "$1" 2>/dev/null 'quoted text' printf $(pwd)
+readonly echo then export export export /usr/bin
+		sed test awk x=1 then awk then 'quoted text' export
+	/usr/bin x=1 export local awk /usr/bin
+		readonly grep -eu && 'quoted text' grep $(pwd) cd 2>/dev/null && sed -eu
+	local readonly | printf test
+	2>/dev/null local cd 2>/dev/null -eu sed echo done echo 2>/dev/null
+		sed | -eu $(pwd) "$1" then ${HOME} 'quoted text'
+sed | /usr/bin | && "$1" x=1 "$@" local --verbose sed
+	"$1" then -eu ${HOME} --verbose echo echo
+		x=1 2>/dev/null awk --verbose x=1 -eu ${HOME} ${HOME}
+	export --verbose printf "$@" grep -eu local sed local /usr/bin
+	then 2>/dev/null export /usr/bin
+x=1 local export x=1 test printf echo grep
+		test grep x=1 | echo 'quoted text'
+		test awk "$@" readonly | local | echo -eu "$1" cd x=1 test
+done -eu done 'quoted text'
+test $(pwd) $(pwd) -eu ${HOME} "$@" | $(pwd) x=1
+	x=1 grep --verbose cd done test && ${HOME} export awk 'quoted text' 'quoted text'
+	| then -eu "$1" sed export 'quoted text' printf done 2>/dev/null $(pwd) -eu
+		2>/dev/null then "$@" | local "$@" awk /usr/bin local
+done test local awk && done test $(pwd) 'quoted text'
+		export sed readonly local /usr/bin 2>/dev/null /usr/bin export cd awk awk /usr/bin
+		${HOME} --verbose -eu $(pwd) --verbose awk "$1" test -eu
+then echo export ${HOME} awk cd cd "$@" echo
+		&& then then $(pwd) local
+then printf && echo cd cd "$1" cd done printf local /usr/bin
+	done x=1 | export local | export "$1" x=1 echo 2>/dev/null | "$1" ${HOME}
+	grep export --verbose ${HOME} grep cd -eu done awk 'quoted text'
+	done readonly /usr/bin sed printf x=1 --verbose --verbose
+sed sed x=1 export local
+	${HOME} "$@" $(pwd) | then x=1 local -eu x=1 && local printf readonly
+		local local awk printf local -eu | awk grep 'quoted text' x=1 local awk "$1" awk
+	&& done then ${HOME} $(pwd) --verbose awk ${HOME} sed awk | local
+	test | ${HOME} readonly export && 'quoted text' cd ${HOME} "$@" echo 'quoted text'
+	--verbose cd 2>/dev/null echo done export $(pwd) --verbose
+x=1 --verbose local && local 'quoted text' --verbose && -eu
+	&& 'quoted text' | awk done then done grep cd local /usr/bin &&
+sed ${HOME} && test grep /usr/bin grep cd && ${HOME}
+		2>/dev/null /usr/bin readonly && then cd local /usr/bin echo ${HOME} then
+		$(pwd) x=1 && ${HOME} 2>/dev/null done --verbose ${HOME} sed ${HOME} readonly
+-eu -eu readonly readonly 2>/dev/null
+		done ${HOME} export readonly done 2>/dev/null done $(pwd) then 'quoted text'
+		printf echo && then local
+	export 'quoted text' x=1 'quoted text' grep 'quoted text' 'quoted text'
+test sed | grep export $(pwd) grep done /usr/bin export 'quoted text' done echo
+		printf --verbose grep /usr/bin
+		sed && export "$@" $(pwd) --verbose
+		x=1 2>/dev/null 'quoted text' sed grep echo cd printf /usr/bin export && --verbose
+		cd awk echo export echo "$1" x=1 $(pwd) sed test awk grep
+		then 2>/dev/null test 2>/dev/null 'quoted text' | export && readonly
+		export readonly sed 2>/dev/null ${HOME} sed awk grep
+${HOME} then | then done
+	local && done grep export "$@" cd local "$@" | /usr/bin $(pwd) local awk
+/usr/bin x=1 ${HOME}
+	$(pwd) done test x=1 export grep
+	"$1" x=1 export && && && "$1" x=1 | "$@" readonly readonly ${HOME} cd
+		export 'quoted text' sed cd 'quoted text'
+	cd --verbose "$@" local x=1 then done readonly sed /usr/bin
+	readonly local printf sed then echo 'quoted text' /usr/bin "$1"
+	"$1" readonly readonly x=1 -eu awk
+	"$@" "$@" "$1" x=1 echo && test 'quoted text' local /usr/bin --verbose | echo
+	$(pwd) done sed awk awk sed echo cd echo
+		"$@" $(pwd) cd printf -eu 2>/dev/null sed 'quoted text'
+--verbose | "$@" x=1 $(pwd)
+	/usr/bin echo local test "$@"
+then echo grep awk --verbose export printf x=1 'quoted text' && grep | cd && -eu
+local awk "$@" 'quoted text' printf && grep |
+		${HOME} 'quoted text' cd awk test ${HOME} local
+		${HOME} local local sed grep -eu 'quoted text'
+		2>/dev/null -eu done then
+x=1 printf $(pwd) && "$1" /usr/bin && then test
+/usr/bin /usr/bin -eu readonly $(pwd) then &&
+		awk -eu sed ${HOME} local awk &&
+		"$1" | /usr/bin "$1" local local -eu -eu $(pwd) $(pwd) cd printf
+	awk "$1" && --verbose | ${HOME} readonly && "$@" test grep sed x=1
+	${HOME} 'quoted text' ${HOME} 'quoted text'
+| && local export $(pwd) x=1 /usr/bin local cd sed -eu then export --verbose x=1
+	${HOME} export "$@" -eu readonly export && -eu && -eu
+		'quoted text' x=1 local echo $(pwd) sed ${HOME} awk | 2>/dev/null readonly printf
+/usr/bin "$@" -eu x=1 then cd 'quoted text' --verbose
+	${HOME} sed printf ${HOME} local "$1" test "$@"
+	awk export x=1 echo readonly export
+	local done awk && done printf /usr/bin
+	export sed sed readonly sed export x=1 'quoted text' cd cd echo && local
+		done x=1 && then ${HOME}
+		| x=1 grep export export done sed then
+		done | printf sed "$1" printf ${HOME} && x=1 awk grep $(pwd) --verbose --verbose
+		/usr/bin x=1 echo --verbose
+		export printf readonly "$1"
+	-eu test 'quoted text' export grep grep
+/usr/bin ${HOME} "$@" $(pwd) export
+"$1" grep export -eu local awk awk /usr/bin
+--verbose grep local "$1" 'quoted text' -eu readonly sed grep grep
+		| test export "$1" awk awk x=1 local
+cd $(pwd) && done cd 'quoted text'
+	test then "$1" echo test printf readonly export /usr/bin readonly cd echo
+| ${HOME} awk awk && echo readonly sed export grep 2>/dev/null grep
+	export 'quoted text' 2>/dev/null ${HOME}
+	sed | "$@" /usr/bin echo 'quoted text' local 2>/dev/null | test &&
+		export grep /usr/bin done then -eu grep 'quoted text' "$@" && then
+		&& echo echo sed echo test /usr/bin grep sed "$1"
+	awk -eu | ${HOME} $(pwd) done done /usr/bin
+--verbose "$1" ${HOME} && export ${HOME} grep && done /usr/bin && sed
+		| then test ${HOME} | "$1" export grep awk && ${HOME}
+	/usr/bin then "$@" && grep
+		$(pwd) then then --verbose test 'quoted text' awk local 2>/dev/null export
+		sed 2>/dev/null && | cd --verbose $(pwd) $(pwd) $(pwd) printf grep
+		&& && && done cd echo awk /usr/bin test local test export
+--verbose "$1" cd grep 2>/dev/null sed -eu sed x=1 readonly
+		"$1" test printf export "$@" local /usr/bin -eu && printf /usr/bin "$1" export
+		/usr/bin awk "$@" readonly x=1 test sed cd && grep echo "$1" grep
+2>/dev/null readonly | printf
+		local "$@" test 'quoted text' ${HOME} awk /usr/bin then done
+		--verbose local /usr/bin ${HOME} && export echo ${HOME} readonly
+test "$@" "$1" sed "$@" sed sed readonly grep cd done 'quoted text' &&
+		done $(pwd) /usr/bin && $(pwd) ${HOME} 'quoted text' readonly && then
+	$(pwd) printf | x=1 --verbose
+		2>/dev/null export 'quoted text'
+		2>/dev/null printf /usr/bin sed cd sed local then local printf
+	--verbose export cd readonly
+"$1" 'quoted text' 'quoted text' done -eu done | cd 'quoted text' readonly x=1
+/usr/bin "$1" grep printf export && done local ${HOME} done grep
+	grep 'quoted text' && test awk --verbose test && export
+	2>/dev/null && sed | sed done echo echo done --verbose | "$@" grep
+		printf "$1" local done export sed then $(pwd) readonly ${HOME} "$@"
+cd grep awk test --verbose 2>/dev/null
+'quoted text' "$@" printf test "$@" awk x=1 /usr/bin test ${HOME} -eu printf
+		$(pwd) grep printf $(pwd)
+/usr/bin grep $(pwd)
+		done test 'quoted text' printf awk ${HOME} sed &&
+	$(pwd) local grep -eu grep export
+"$1" /usr/bin test -eu /usr/bin ${HOME} echo "$@" sed then | x=1 | --verbose
+	sed grep -eu -eu | test $(pwd) /usr/bin test ${HOME} x=1 x=1
+	export ${HOME} cd "$1" awk local echo 'quoted text'
+		"$@" local cd x=1 readonly awk "$@" readonly "$1"
+		/usr/bin 'quoted text' then
+	'quoted text' $(pwd) 2>/dev/null 'quoted text' grep ${HOME} "$@"
+/usr/bin x=1 | /usr/bin printf "$@" export --verbose $(pwd) grep /usr/bin
+	/usr/bin x=1 "$1" readonly export x=1 -eu 'quoted text' printf $(pwd) |
+	test "$@" awk export printf readonly then cd export $(pwd)
+		| $(pwd) -eu $(pwd) printf && $(pwd) awk /usr/bin done && $(pwd) && local grep
+	sed 'quoted text' 2>/dev/null 'quoted text' readonly local export
+		grep && echo "$1" $(pwd) test 'quoted text'
+		echo && -eu /usr/bin awk done 'quoted text' readonly -eu $(pwd) export echo $(pwd)
+	export awk then && | $(pwd)
+	2>/dev/null grep then readonly cd | local
+		local 'quoted text' -eu "$1" && "$1" test
+"$@" then echo -eu x=1 done
+	export x=1 printf 'quoted text' $(pwd) echo readonly readonly /usr/bin sed
+		-eu 'quoted text' --verbose x=1 ${HOME} "$@"
+	grep export readonly grep awk | awk /usr/bin sed grep $(pwd)
+	grep grep "$1" done test done && "$@" --verbose export -eu -eu
+		&& 2>/dev/null 'quoted text'
+'quoted text' export local grep x=1 &&
+		'quoted text' "$1" ${HOME} sed export sed ${HOME} -eu done ${HOME} readonly
+		| -eu printf readonly cd printf | 'quoted text' "$@" cd | done 'quoted text'
+		test readonly printf "$@" local $(pwd)
+test 'quoted text' readonly "$1" awk sed awk cd cd sed /usr/bin
+	$(pwd) local ${HOME} && grep | 'quoted text' x=1 -eu export
+		then sed awk cd readonly echo
+then echo export then test
+		"$@" x=1 readonly 2>/dev/null "$1"
+	export | done -eu --verbose && 2>/dev/null 'quoted text' | export 2>/dev/null
+		"$@" awk && done $(pwd) then -eu sed &&
+done $(pwd) done local
+	awk export $(pwd) echo grep cd readonly ${HOME}
+${HOME} export awk | printf x=1 test grep printf
+	cd "$1" cd /usr/bin printf sed 2>/dev/null awk 'quoted text'
+	&& --verbose done $(pwd) 'quoted text' export echo printf
+		readonly printf printf grep -eu cd --verbose &&
+	then cd 2>/dev/null -eu 2>/dev/null export
+printf 'quoted text' awk /usr/bin -eu sed printf local -eu "$@" grep | local done
+		x=1 "$1" export $(pwd) done local readonly test local printf echo x=1 "$1"
+		x=1 "$1" test printf /usr/bin
+-eu done readonly "$@" $(pwd) export test -eu printf && local sed "$1"
+${HOME} grep done sed $(pwd) test "$1" -eu 2>/dev/null cd
+		done printf 'quoted text' 'quoted text' "$1" /usr/bin sed --verbose 2>/dev/null
+"$1" cd | grep then "$1" 'quoted text'
+		| readonly 'quoted text' local printf readonly --verbose
+${HOME} | -eu ${HOME} -eu then echo done export readonly local done
+x=1 then 2>/dev/null x=1 $(pwd) echo "$1" $(pwd)
+		2>/dev/null echo -eu done --verbose "$@" readonly
+		done | "$1" 2>/dev/null 2>/dev/null echo grep awk --verbose | local printf "$1"
+		awk sed && printf then echo x=1 | awk 2>/dev/null --verbose
+	cd awk "$1" "$1" /usr/bin &&
+	| --verbose "$@" /usr/bin readonly export -eu /usr/bin export done cd
+awk then done echo awk export 2>/dev/null local sed
+		printf 'quoted text' sed /usr/bin awk sed sed printf
+	--verbose grep -eu | sed sed $(pwd) echo awk
+/usr/bin echo "$1" 'quoted text' && -eu /usr/bin /usr/bin
+	test | -eu test /usr/bin local export -eu awk awk readonly
+	2>/dev/null | && local 'quoted text'
+local test awk then "$@" printf ${HOME}
+"$@" x=1 'quoted text' && grep export -eu grep 'quoted text'
+		2>/dev/null local | cd done printf awk ${HOME} 2>/dev/null
+		-eu echo sed | /usr/bin
+		--verbose ${HOME} 2>/dev/null done cd awk export awk /usr/bin "$@" --verbose
+		${HOME} echo | && -eu "$@" cd 'quoted text' "$@" --verbose --verbose
+/usr/bin ${HOME} readonly echo export "$@" ${HOME} sed echo grep 'quoted text'
+		x=1 /usr/bin 'quoted text'
+cd local local -eu --verbose $(pwd) grep
+2>/dev/null "$@" ${HOME} sed 'quoted text' cd then ${HOME}
+"$1" export x=1 test -eu local 2>/dev/null awk --verbose local x=1 $(pwd)
+		cd | x=1 done | "$1" -eu 2>/dev/null
+x=1 2>/dev/null grep | ${HOME} -eu 2>/dev/null done
+printf test cd -eu "$@" "$1" awk x=1 /usr/bin x=1 local
+2>/dev/null | local "$1" cd then 2>/dev/null
+		done -eu 'quoted text' /usr/bin awk && x=1 then readonly done x=1 'quoted text'
+		test 2>/dev/null export && /usr/bin 2>/dev/null $(pwd) grep test --verbose
+		2>/dev/null local /usr/bin cd "$@" printf printf
+		printf $(pwd) sed $(pwd) done grep awk 'quoted text' -eu 'quoted text' readonly
+		cd local 'quoted text' sed x=1 "$@" then "$@" grep export "$@"
+/usr/bin "$@" 2>/dev/null "$1" done /usr/bin | export 'quoted text'
+		x=1 cd /usr/bin grep "$@" "$@" grep && |
+	"$1" $(pwd) then done then && $(pwd) sed
+		--verbose sed test /usr/bin "$1" grep
+&& test -eu export sed ${HOME} test 'quoted text' grep
+$(pwd) done printf then 'quoted text'
+echo /usr/bin then cd "$@" readonly echo awk "$@" x=1 test test readonly
+	${HOME} printf --verbose test 2>/dev/null grep printf
+		sed "$@" sed "$1" readonly echo 'quoted text' test done
+		x=1 'quoted text' printf "$@"
+		x=1 printf awk 'quoted text' readonly | export
+		readonly ${HOME} ${HOME} grep local $(pwd) awk | printf --verbose
+	then echo ${HOME} export /usr/bin
+		/usr/bin test $(pwd) local printf readonly printf awk ${HOME} --verbose
+test "$1" echo "$1" -eu local 2>/dev/null
+		test "$@" echo echo 'quoted text' readonly 'quoted text'
+		echo awk "$@" awk -eu cd echo local done done
+		printf /usr/bin /usr/bin 'quoted text' printf
+	"$@" x=1 readonly /usr/bin awk "$1" awk
+${HOME} -eu 'quoted text' $(pwd) done local 2>/dev/null
+		2>/dev/null 2>/dev/null printf export export then
+		x=1 2>/dev/null test readonly -eu then -eu readonly done printf cd export /usr/bin
+		cd && grep | --verbose ${HOME}
+	/usr/bin $(pwd) --verbose grep export -eu && 2>/dev/null grep then $(pwd)
+readonly --verbose cd "$1" printf readonly test cd x=1 done
+	"$1" 2>/dev/null export readonly -eu x=1 readonly sed readonly awk
+	--verbose 2>/dev/null grep | export -eu --verbose local local && readonly
+	'quoted text' export local | ${HOME} then test done test done printf | awk &&
+	echo 2>/dev/null printf awk /usr/bin
+test ${HOME} awk sed cd readonly done local 2>/dev/null
+2>/dev/null 2>/dev/null cd test "$@" local test printf
+		x=1 local "$1" printf 2>/dev/null test echo test --verbose
+readonly "$1" sed 2>/dev/null cd cd then printf local export
+		echo export export local echo 2>/dev/null awk
+	sed ${HOME} /usr/bin cd 2>/dev/null | then done printf 2>/dev/null $(pwd) local
+	/usr/bin awk readonly "$1" readonly ${HOME} local local then x=1 test then
+		/usr/bin x=1 $(pwd) 2>/dev/null -eu test
+| echo && echo "$@" awk -eu echo --verbose --verbose printf -eu sed $(pwd) "$1"
+printf export | x=1 sed echo /usr/bin cd readonly grep readonly grep && && "$1"
+	grep export --verbose 'quoted text' local echo grep 2>/dev/null export done 2>/dev/null
+		grep sed done sed x=1 grep cd then local $(pwd) printf $(pwd)
+	| sed x=1 awk "$@" 'quoted text' cd
+		done /usr/bin | ${HOME} -eu -eu && /usr/bin "$@" test x=1 /usr/bin 2>/dev/null
+'quoted text' then /usr/bin printf
+		readonly local -eu awk 'quoted text' grep "$1" test sed readonly
+echo $(pwd) "$1" x=1 x=1 echo && -eu test
+readonly cd cd /usr/bin grep $(pwd) --verbose cd /usr/bin export export
+	'quoted text' printf printf ${HOME} --verbose export printf "$@" x=1
+		"$1" export cd /usr/bin grep cd then sed echo /usr/bin
+	--verbose cd && then then /usr/bin sed /usr/bin cd local 2>/dev/null
+		&& 2>/dev/null echo | readonly
+	2>/dev/null grep test printf cd "$1" test ${HOME} "$@" done
+		2>/dev/null x=1 test 'quoted text'
+	test grep x=1 printf && -eu then export done -eu cd done | grep echo awk "$1"
+	printf | | then x=1 && --verbose | local $(pwd) test echo /usr/bin
+x=1 printf "$1" -eu grep sed cd | then 2>/dev/null 2>/dev/null echo ${HOME}
+	cd -eu | 2>/dev/null 2>/dev/null sed | && grep cd
+	cd ${HOME} export x=1 --verbose x=1 sed local "$1" grep --verbose
+2>/dev/null x=1 echo /usr/bin test echo test readonly readonly
+		${HOME} printf x=1 'quoted text'
+		&& 'quoted text' done echo "$@"
+		&& test "$@" test done done && grep "$1" cd local
+		'quoted text' then && /usr/bin && && 2>/dev/null
+		printf test --verbose export "$1" sed
+		| "$1" cd done readonly done x=1 $(pwd)
+		&& --verbose export readonly -eu
+		export then $(pwd) | $(pwd) local --verbose "$1" "$@"
+	readonly | $(pwd) awk echo "$@" grep test done
+"$1" 'quoted text' 2>/dev/null --verbose -eu 2>/dev/null | $(pwd)
+	&& -eu done local then x=1 --verbose --verbose "$@" sed readonly sed && 'quoted text'
+	test x=1 $(pwd) test test
+	"$@" local cd test "$@" test test "$1" -eu local then grep 2>/dev/null
+test && done "$1" "$@" "$1" --verbose
+	$(pwd) --verbose cd then ${HOME} 2>/dev/null echo && export $(pwd) | echo
+		then | "$1" "$1" && then
+	cd -eu sed cd 'quoted text' awk
+	'quoted text' 2>/dev/null
+		echo export x=1 grep $(pwd) test grep $(pwd) -eu /usr/bin
+awk 2>/dev/null x=1 done -eu ${HOME} --verbose
+	/usr/bin --verbose done done sed --verbose "$@" done 'quoted text' export
+		${HOME} export cd sed test /usr/bin
+		/usr/bin -eu | $(pwd) local 'quoted text' $(pwd) local && "$@"
+&& grep echo local awk $(pwd) /usr/bin echo done ${HOME} 'quoted text'
+		$(pwd) local "$@" test "$@" 2>/dev/null local grep done grep $(pwd) $(pwd)
+	awk $(pwd) "$1" "$1" x=1 test 'quoted text' local echo "$@" sed && -eu cd
+	cd awk "$@" cd test local "$@" | cd readonly printf "$1" export then done
+printf cd export && ${HOME}
+-eu | then && -eu x=1 "$1" readonly test "$1"
+'quoted text' 2>/dev/null local
+	export x=1 then ${HOME}
+		/usr/bin --verbose 'quoted text' awk "$1" readonly x=1 export local
+	--verbose "$1" printf x=1 2>/dev/null echo && -eu export local then sed
+	&& printf $(pwd) 2>/dev/null && x=1 "$1" awk 2>/dev/null local
+&& && grep && cd x=1 2>/dev/null
+-eu /usr/bin | cd && sed 'quoted text' cd printf sed "$@" "$@" ${HOME}
+		grep then cd 'quoted text' $(pwd) grep /usr/bin printf | then ${HOME} export
+		'quoted text' 2>/dev/null
+local && /usr/bin | grep x=1 x=1 awk --verbose ${HOME} printf "$@"
+echo awk printf export then 'quoted text' grep
+		| /usr/bin "$1" 2>/dev/null echo x=1 export
+	echo cd && 2>/dev/null cd --verbose "$1" test x=1 done grep
+then "$@" /usr/bin grep "$@" test /usr/bin local && test printf
+	'quoted text' printf x=1 done sed x=1 awk printf echo grep cd /usr/bin
+	"$1" "$1" test then -eu export local done | sed done | local local | --verbose
+	grep "$@" x=1 "$1" awk then export awk then then
+		--verbose ${HOME} x=1 x=1
+echo /usr/bin x=1 then readonly readonly x=1 then 'quoted text' 'quoted text'
+		export local sed -eu "$@" 2>/dev/null readonly
+	sed "$1" -eu --verbose done 'quoted text' -eu test
+awk --verbose then test done sed
+	local done sed readonly grep test /usr/bin 'quoted text' --verbose
+echo x=1 grep -eu export
+		-eu test $(pwd) done export sed ${HOME} "$1" && "$1" -eu
+		/usr/bin echo "$@" $(pwd) cd readonly ${HOME}
+		awk test | -eu x=1 local $(pwd) 'quoted text' $(pwd) 2>/dev/null && done
+		x=1 2>/dev/null sed cd /usr/bin "$@" printf local
+		local /usr/bin echo --verbose ${HOME} awk --verbose
+	${HOME} awk --verbose printf ${HOME} printf cd "$@"
+		x=1 2>/dev/null /usr/bin /usr/bin grep then | then grep
+		sed -eu export export "$1" export test ${HOME} /usr/bin
+sed /usr/bin $(pwd) 'quoted text'
+	awk -eu -eu 2>/dev/null readonly done sed && --verbose ${HOME}
+echo done done echo 'quoted text' "$1" x=1 "$1" | cd ${HOME} cd ${HOME} /usr/bin
+		| grep "$1" cd cd printf readonly /usr/bin awk local -eu echo | /usr/bin | export
+	$(pwd) "$1" 'quoted text' -eu x=1 readonly grep 'quoted text' echo -eu grep
+	printf local echo ${HOME} && 'quoted text'
+	'quoted text' printf 2>/dev/null then "$@"
+sed $(pwd) sed "$@" done done done cd && x=1 -eu && | grep | then
+		printf test && "$@" /usr/bin
+		--verbose "$1" "$1" sed cd 'quoted text'
+sed echo | sed sed printf readonly echo --verbose
+	readonly "$1" "$1" awk sed export "$1" $(pwd) awk 'quoted text'
+		"$1" grep x=1 'quoted text' 2>/dev/null printf "$1" 'quoted text' -eu readonly
+'quoted text' done 2>/dev/null "$@" cd awk done | 'quoted text'
+		'quoted text' printf
+		readonly x=1 then local
+		grep cd $(pwd) 2>/dev/null readonly "$1" 'quoted text' | grep echo /usr/bin
+	local $(pwd) echo | $(pwd) local test
+&& echo awk --verbose && then | awk x=1 /usr/bin
+	test grep then | readonly
+test export -eu awk local "$1" test x=1
+"$1" "$1" && && ${HOME} export then cd --verbose awk "$1" local $(pwd)
+		cd export | "$@" cd x=1 then ${HOME} -eu 2>/dev/null /usr/bin
+		"$@" sed then echo echo
+'quoted text' export 'quoted text' "$@" test
+	${HOME} readonly 'quoted text'
+	readonly --verbose sed && x=1 ${HOME} && awk sed awk
+	export ${HOME} --verbose export $(pwd) printf "$1" 'quoted text' then ${HOME} done
+		readonly done | grep export export ${HOME} $(pwd) local -eu
+$(pwd) | /usr/bin "$1" local --verbose
+	sed /usr/bin sed "$@"
+local grep printf -eu then 2>/dev/null "$@" /usr/bin
+		${HOME} sed then done "$@" test x=1 printf echo
+	| printf cd echo then done readonly sed test
+	echo test echo 'quoted text'
+		sed printf | | export | cd cd | cd then
+		"$1" cd cd | $(pwd) printf 2>/dev/null awk | awk cd x=1
+		/usr/bin done "$@" && | && test printf && | printf -eu /usr/bin
+	export 2>/dev/null ${HOME} $(pwd) cd cd 2>/dev/null sed &&
+	done ${HOME} readonly local "$@" export sed 2>/dev/null grep
+		local cd | readonly grep grep && cd test done "$1" grep 'quoted text'
+		&& | "$1" 'quoted text' export x=1 && local 'quoted text'
+		cd printf then done |
+		readonly -eu export local 'quoted text' cd then 2>/dev/null 'quoted text'
+	/usr/bin --verbose done sed --verbose
+		/usr/bin cd sed printf ${HOME} grep ${HOME} then 'quoted text'
+done grep x=1 then /usr/bin "$@" 'quoted text'
+		sed $(pwd) cd awk export --verbose printf export
+	echo /usr/bin --verbose local
+	echo "$1" 'quoted text' sed --verbose then cd cd "$@" echo "$1" 'quoted text'
+	2>/dev/null 2>/dev/null export then 2>/dev/null "$1" /usr/bin | test |
+		$(pwd) -eu 2>/dev/null
+--verbose $(pwd) then export $(pwd) 'quoted text'
+	/usr/bin grep export then "$@" cd x=1 --verbose
+-eu awk export export readonly cd printf 2>/dev/null local ${HOME}
+	/usr/bin && x=1 $(pwd) cd --verbose printf export /usr/bin
+--verbose && printf && sed awk readonly
+	x=1 cd export -eu "$@" /usr/bin readonly -eu /usr/bin
+	--verbose ${HOME} local readonly echo printf done -eu echo
+	x=1 && grep cd x=1 2>/dev/null grep "$@" echo "$1" cd 'quoted text'
+awk ${HOME} grep 2>/dev/null readonly cd readonly --verbose $(pwd) sed readonly
+	echo readonly export -eu grep --verbose
+${HOME} test export 'quoted text' readonly --verbose ${HOME}
+		printf x=1 grep "$1" x=1 export "$1" | sed 'quoted text' "$@" -eu
+export printf grep 2>/dev/null x=1 grep --verbose
+| -eu cd /usr/bin printf then 2>/dev/null && 2>/dev/null 'quoted text'
+echo -eu && ${HOME} cd readonly "$@" grep local |
+$(pwd) "$@" --verbose echo 'quoted text' local printf
+${HOME} grep sed "$1" 2>/dev/null readonly printf
+		| && sed 2>/dev/null && local echo --verbose local "$1"
+		awk | "$@" -eu grep awk local printf sed
+		readonly "$1" "$@" && 'quoted text'
+	"$@" 'quoted text' export
+	2>/dev/null | "$@" export sed "$1" && --verbose --verbose --verbose
+"$@" test cd && export local --verbose --verbose then "$@" | grep |
+	| 'quoted text' -eu done readonly
+local x=1 --verbose awk $(pwd)
+	/usr/bin echo "$1" "$@" test
+printf test | /usr/bin awk then
+done | test grep test /usr/bin $(pwd)
+/usr/bin $(pwd) then then | /usr/bin --verbose printf sed ${HOME} ${HOME}
+| cd 'quoted text' test echo test && "$1" sed then x=1 | export
+		"$1" /usr/bin "$1" 'quoted text' then "$1" | printf test local grep cd -eu $(pwd)
+		export printf then "$1" x=1 then /usr/bin $(pwd) grep
+	/usr/bin -eu "$1" 'quoted text' sed /usr/bin --verbose
+&& --verbose 'quoted text' && test test "$1" 'quoted text'
+		test x=1 'quoted text' ${HOME} "$@" echo /usr/bin
+		x=1 x=1 /usr/bin -eu sed echo 'quoted text'
+	grep echo test "$@" && | $(pwd) |
+	echo done $(pwd) done ${HOME} -eu echo "$@" export then x=1 echo readonly &&
+done -eu "$1" echo then test --verbose $(pwd) "$1" test readonly
+sed -eu $(pwd) | cd awk local test "$1" echo "$@"
+		printf /usr/bin then cd | 2>/dev/null
+		done ${HOME} echo awk && cd
+	then 2>/dev/null done sed 'quoted text' 'quoted text'
+		echo test "$1" readonly 2>/dev/null -eu ${HOME} 2>/dev/null done ${HOME} ${HOME}
+		| awk awk then printf 'quoted text'
+		--verbose cd readonly local echo local "$1" export /usr/bin
+	export x=1 printf cd cd awk ${HOME} printf --verbose --verbose readonly
+"$@" readonly grep local done readonly 2>/dev/null
+	printf && "$@" --verbose --verbose echo /usr/bin readonly grep -eu printf
+$(pwd) /usr/bin x=1 awk | ${HOME} awk &&
+		awk "$1" "$1" && --verbose 2>/dev/null cd && -eu awk cd "$@" --verbose echo awk
+		"$@" 'quoted text' export printf
+awk export test printf /usr/bin ${HOME} 'quoted text' "$@" export
+		-eu printf "$@" echo cd -eu ${HOME} -eu 'quoted text' -eu export echo
+		then x=1 cd awk then && local grep "$1" local x=1 "$1" "$@" test
+	local printf printf "$@"
+| readonly "$1" then printf /usr/bin -eu /usr/bin -eu x=1
+		| cd --verbose test 2>/dev/null readonly then ${HOME} readonly /usr/bin
+	sed sed cd then test then test grep "$1" && "$@"
+'quoted text' readonly /usr/bin --verbose && | export | echo 'quoted text'
+	printf ${HOME} && $(pwd) x=1 then echo "$@" && then /usr/bin
+	2>/dev/null ${HOME} then
+/usr/bin --verbose && /usr/bin awk echo ${HOME} | $(pwd) echo
+		test printf | echo && && done test readonly | $(pwd) --verbose grep
+	echo sed $(pwd) 'quoted text'
+	| x=1 "$1" && echo -eu -eu sed
+	$(pwd) readonly 'quoted text' readonly cd | 2>/dev/null -eu local awk cd sed
+	readonly test awk awk 2>/dev/null
+	grep x=1 awk 2>/dev/null grep && readonly --verbose
+		&& x=1 x=1 ${HOME} echo done && grep done echo ${HOME}
+printf awk cd printf echo export
+"$1" 2>/dev/null /usr/bin cd test
+'quoted text' && && /usr/bin "$@" local then readonly done --verbose
+		$(pwd) "$@" printf local
+		&& export echo /usr/bin /usr/bin
+grep && export then printf
+		awk echo /usr/bin "$@" grep sed echo $(pwd) "$1"
+	sed then | sed x=1 grep ${HOME} done 'quoted text'
+	"$1" && then ${HOME} && -eu /usr/bin | awk --verbose grep
+		${HOME} done awk echo --verbose
+	-eu x=1 then -eu readonly
+export "$@" --verbose printf readonly local -eu export then ${HOME}
+export sed awk export --verbose
+		printf x=1 ${HOME} test "$1" sed x=1 --verbose
+		export awk 'quoted text' grep awk $(pwd) awk "$@" /usr/bin 'quoted text' export
+test local "$@" $(pwd) | export x=1 ${HOME} done 'quoted text'
+		grep then echo printf printf "$1" --verbose 'quoted text'
+	awk echo sed readonly && | "$1" printf
+	"$@" grep sed readonly grep grep done "$1" x=1 /usr/bin $(pwd) /usr/bin test
+"$@" 2>/dev/null readonly echo done $(pwd) &&
+		&& cd $(pwd) awk --verbose
+'quoted text' cd "$1" -eu cd "$1" cd echo 'quoted text' /usr/bin
+		-eu export echo "$1" /usr/bin test export 2>/dev/null /usr/bin |
+readonly && $(pwd) 'quoted text' grep done echo "$1"
+		"$@" sed ${HOME} "$@" export test | sed sed echo cd
+		printf done awk ${HOME} echo -eu 2>/dev/null then cd export
+		done then printf 'quoted text'
+&& && "$@" cd then test grep local && readonly then | printf then x=1
+	grep && $(pwd) test $(pwd) awk sed $(pwd) done "$1"
+local "$@" -eu readonly readonly && "$1" && local awk "$1" test
+		then $(pwd) awk sed -eu && echo
+test -eu awk awk echo && -eu "$1" done /usr/bin
+	test --verbose ${HOME} cd x=1 echo test
+		grep 'quoted text' grep test local ${HOME} local test done 'quoted text'
+	| export $(pwd) readonly --verbose
+		--verbose export $(pwd) ${HOME} then /usr/bin printf $(pwd) 2>/dev/null
+local --verbose test $(pwd) awk printf
+	echo export x=1 "$1" done
+${HOME} awk grep $(pwd) 2>/dev/null
+	| -eu "$1" printf done done local awk cd /usr/bin
+	$(pwd) /usr/bin local test x=1 echo /usr/bin
+		then local grep grep readonly
+		then echo local "$@" /usr/bin export echo sed done 'quoted text'
+	sed $(pwd) grep --verbose 'quoted text' printf
+		-eu local && local -eu sed &&
+sed "$1" -eu | $(pwd) "$1" done
+	then test /usr/bin "$@" grep then readonly sed "$1" ${HOME}
+done "$1" grep 2>/dev/null 'quoted text'
+cd $(pwd) test | grep printf -eu test cd then 'quoted text' ${HOME} x=1
+2>/dev/null then echo /usr/bin $(pwd) local
+		-eu | printf ${HOME}
+		cd -eu echo -eu awk cd x=1 echo awk done /usr/bin
+	'quoted text' "$@" /usr/bin
+		'quoted text' done /usr/bin echo && grep
+		sed --verbose "$1" grep /usr/bin then 'quoted text' --verbose ${HOME} echo && --verbose
+done 2>/dev/null ${HOME} ${HOME} $(pwd) echo done
+		export awk local grep 2>/dev/null | done readonly then ${HOME} then
+		--verbose local awk -eu $(pwd) printf /usr/bin sed -eu test
+		export "$@" -eu done 2>/dev/null
+	--verbose "$1" echo cd local
+	'quoted text' /usr/bin "$1" echo /usr/bin awk done cd export sed
+		echo --verbose done grep 2>/dev/null done echo export grep echo
+	${HOME} local test && "$1" then cd export grep export
+		test "$@" local 'quoted text' /usr/bin $(pwd) x=1 grep done
+awk done --verbose ${HOME} /usr/bin ${HOME} echo
+done /usr/bin grep --verbose x=1 $(pwd) /usr/bin test echo 2>/dev/null "$1"
+grep -eu then ${HOME} --verbose then
+		local test echo local test 2>/dev/null
+		cd /usr/bin "$@" -eu $(pwd) && cd 'quoted text' 'quoted text'
+		printf --verbose then readonly "$@"
+"$@" grep sed then ${HOME}
+$(pwd) cd && $(pwd) 'quoted text' -eu printf ${HOME} awk printf grep x=1 /usr/bin
+$(pwd) readonly grep then printf
+		| ${HOME} /usr/bin /usr/bin "$1"
+readonly "$@" printf test echo "$@" -eu $(pwd) --verbose readonly "$1" -eu awk
+readonly "$@" awk "$1" then "$1" local
+cd x=1 /usr/bin "$@" "$1" && local
+${HOME} | cd x=1 test sed done test then sed printf
+	export x=1 x=1 | done readonly && cd | local ${HOME} | --verbose x=1 'quoted text'
+awk awk /usr/bin export -eu "$1" 'quoted text' "$1" cd export -eu grep 2>/dev/null
+${HOME} -eu $(pwd) export then x=1 then test readonly then
+		done readonly echo grep echo "$1" 2>/dev/null
+		2>/dev/null done --verbose
+		"$1" local then done sed export /usr/bin then readonly test awk "$1"
+	then echo then readonly "$1" local -eu test done -eu 'quoted text'
+"$1" cd printf 'quoted text' echo 2>/dev/null | ${HOME} 2>/dev/null "$@" 2>/dev/null
+		| then | sed printf local x=1 'quoted text' | ${HOME}
+		test printf grep 'quoted text' cd 2>/dev/null then local 2>/dev/null cd sed
+		sed --verbose ${HOME} cd && test sed then /usr/bin /usr/bin
+	x=1 sed | | cd "$@" echo "$@" local
+		'quoted text' x=1 "$1" | && awk then | done export printf awk cd $(pwd)
+		x=1 "$@" --verbose 'quoted text' "$@" awk cd then
+		| "$1" /usr/bin -eu "$@" && printf awk 'quoted text' | x=1 x=1 ${HOME}
+sed x=1 done --verbose -eu ${HOME}
+		readonly && x=1 sed $(pwd) then "$@" 2>/dev/null /usr/bin
+then printf readonly && printf echo "$@" test echo grep then "$1"
+		$(pwd) sed readonly done sed "$1" local done 'quoted text'
+	/usr/bin 2>/dev/null $(pwd) done cd ${HOME} x=1 ${HOME} && --verbose local /usr/bin
+local then 2>/dev/null readonly readonly
+		'quoted text' printf "$@" grep "$@" export
+done sed sed awk done test | sed --verbose local -eu -eu printf awk test
+	"$1" cd $(pwd) then ${HOME} ${HOME} readonly "$@" readonly
+test cd local sed readonly done local awk
+	x=1 -eu "$@" grep echo then && printf
+	-eu grep 'quoted text' grep test test then /usr/bin readonly "$1" echo then
+		-eu && grep --verbose /usr/bin /usr/bin
+--verbose readonly test test 'quoted text' /usr/bin
+		-eu awk sed /usr/bin then ${HOME} readonly test x=1
+"$1" x=1 'quoted text' $(pwd) export
+printf grep printf "$1" grep
+cd --verbose -eu then 'quoted text' export
+	| cd "$@" export printf -eu "$@"
+sed done x=1 ${HOME} 2>/dev/null x=1 2>/dev/null then
+		export readonly done /usr/bin
+	-eu && x=1 grep | sed | grep cd grep 'quoted text' then 'quoted text' | echo
+	readonly cd 2>/dev/null 2>/dev/null $(pwd) export
+-eu | "$1" cd 'quoted text' cd "$1" ${HOME} then export
+echo echo | /usr/bin readonly then export 'quoted text'
+"$@" $(pwd) sed && local readonly &&
+test test "$@" -eu "$@" awk readonly /usr/bin cd echo
+		awk "$@" export done "$@" ${HOME} -eu "$@" readonly 'quoted text'
+		-eu ${HOME} echo test 'quoted text' cd "$@" --verbose test $(pwd)
+		x=1 test 2>/dev/null printf
+${HOME} awk readonly cd readonly
+		| "$@" done test "$@" echo readonly awk "$@" local -eu x=1 2>/dev/null
+		export cd done then "$@" /usr/bin
+	--verbose readonly --verbose readonly awk grep printf ${HOME} $(pwd) grep
+	2>/dev/null "$1" --verbose
+cd sed $(pwd) printf readonly
+		sed echo | -eu 2>/dev/null done
+readonly awk readonly grep ${HOME} $(pwd) "$@" x=1 "$1" test x=1
+	x=1 readonly done -eu echo sed sed
+		done "$1" done done 'quoted text' then --verbose awk echo local test sed x=1
+	done | export 'quoted text' "$1" export | x=1 printf
+"$@" "$1" ${HOME} grep echo then -eu echo 2>/dev/null $(pwd) 'quoted text'
+		grep /usr/bin cd --verbose
+| "$@" test export --verbose ${HOME} 2>/dev/null ${HOME} readonly
+		awk | ${HOME} printf 2>/dev/null
+'quoted text' sed /usr/bin test 'quoted text'
+	readonly export readonly cd ${HOME}
+	awk readonly --verbose export
+		--verbose grep --verbose local export test "$@" printf 2>/dev/null
+	test echo 2>/dev/null then sed $(pwd) then $(pwd) 2>/dev/null
+export x=1 grep grep readonly -eu "$1" echo "$@" export && echo readonly
+	grep 2>/dev/null sed $(pwd) export sed $(pwd) printf export
+		test done sed | export x=1 -eu sed cd 'quoted text' --verbose "$1"
+cd echo ${HOME} x=1 ${HOME} x=1 export /usr/bin 'quoted text' echo echo
+	then sed 'quoted text' cd --verbose --verbose 2>/dev/null
+	printf sed x=1 grep x=1 export local cd echo 2>/dev/null then $(pwd) readonly
+	echo echo printf 2>/dev/null /usr/bin "$1" local "$@" sed
+	| readonly sed | ${HOME} done then 2>/dev/null /usr/bin sed readonly
+		x=1 done then | local sed grep echo | ${HOME} readonly 2>/dev/null | printf
+		--verbose awk printf export
+	| done sed ${HOME} grep printf then $(pwd) 'quoted text' test
+${HOME} done -eu 'quoted text' /usr/bin --verbose ${HOME}
+		${HOME} /usr/bin && done x=1 /usr/bin x=1 export x=1 /usr/bin test
+readonly /usr/bin 'quoted text' done printf -eu |
+		-eu /usr/bin -eu 2>/dev/null 2>/dev/null grep printf export
+--verbose readonly sed test export "$1" local printf printf printf --verbose
+--verbose sed "$@" --verbose --verbose
+	/usr/bin "$1" 'quoted text' | then
+printf awk 2>/dev/null test printf && $(pwd) ${HOME}
+${HOME} ${HOME} | && test 2>/dev/null x=1 then 2>/dev/null
+	sed $(pwd) grep export printf
+	printf grep && x=1 done done echo cd && && | ${HOME} ${HOME} cd "$@" sed --verbose
+	awk sed readonly local sed export
+		/usr/bin | | cd grep $(pwd) echo awk -eu then echo then -eu local "$@" --verbose
+echo awk readonly $(pwd) 2>/dev/null
+		$(pwd) /usr/bin sed test 2>/dev/null
+2>/dev/null awk -eu test echo "$@" awk -eu printf /usr/bin then
+		then cd export && printf
+		2>/dev/null -eu local done sed && /usr/bin
+	printf $(pwd) "$@" 2>/dev/null "$@" --verbose
+		"$@" /usr/bin then 'quoted text' 2>/dev/null awk "$1" x=1 done ${HOME}
+		then -eu "$1" ${HOME} && echo "$@" printf echo local /usr/bin
+		&& 2>/dev/null then grep | test /usr/bin echo
+cd done && local x=1 cd echo awk 2>/dev/null | 'quoted text'
+x=1 done -eu local cd x=1 local --verbose done local test then done 2>/dev/null
+grep 'quoted text' readonly grep | | 2>/dev/null
+echo test echo 2>/dev/null "$@" grep
+		printf sed ${HOME} awk export --verbose $(pwd) "$1"
+		/usr/bin "$1" echo local local done ${HOME} echo export "$@" 2>/dev/null
+		${HOME} done printf sed 'quoted text' done "$1" echo
+then test | 2>/dev/null 2>/dev/null
+	/usr/bin printf | readonly
+	2>/dev/null 2>/dev/null
+export awk readonly -eu | cd --verbose grep grep
+x=1 printf sed 2>/dev/null test test $(pwd)
+done echo "$1" /usr/bin local export printf ${HOME} export
+		| done | echo --verbose -eu "$@"
+&& /usr/bin 2>/dev/null done $(pwd) done cd
+	done && 'quoted text' 'quoted text'
+${HOME} export ${HOME} ${HOME}
+	readonly ${HOME} /usr/bin
+	grep ${HOME} && test cd then
+${HOME} "$1" && "$@" --verbose /usr/bin readonly
+		test sed printf readonly | "$1" "$@" test echo cd 'quoted text' -eu awk export
+local readonly awk /usr/bin then /usr/bin readonly echo ${HOME} echo done done
+		-eu sed 2>/dev/null $(pwd) cd test cd test 2>/dev/null
+"$@" grep && then sed export awk export
+	awk cd local done -eu "$@" awk 'quoted text'
+	&& echo /usr/bin local x=1 2>/dev/null
+		cd echo ${HOME} cd x=1 x=1 'quoted text'
+		local export /usr/bin 2>/dev/null /usr/bin awk export 'quoted text' 'quoted text'
+	cd then "$1" /usr/bin 2>/dev/null test echo printf
+	cd done test x=1 test test echo cd
+		test readonly awk done -eu then awk 'quoted text' --verbose
+	-eu then awk 'quoted text' $(pwd) done grep grep
+		local -eu sed "$1" 2>/dev/null --verbose /usr/bin
+		readonly awk export ${HOME}
+	x=1 done -eu sed | 'quoted text' ${HOME} then -eu awk readonly
+	$(pwd) --verbose printf then then export $(pwd) 2>/dev/null awk
+done local then "$@" grep 2>/dev/null "$1" x=1 test export ${HOME} cd ${HOME}
+--verbose then x=1 sed "$1" | grep readonly ${HOME} "$1" "$@" echo
+x=1 'quoted text' ${HOME} awk 2>/dev/null done sed
+	awk then 'quoted text' printf grep $(pwd) awk
+		&& printf awk ${HOME} grep | 2>/dev/null
+$(pwd) x=1 x=1 printf | /usr/bin 2>/dev/null && && sed
+echo readonly && 'quoted text' test "$1" echo /usr/bin "$@" local
+printf ${HOME} | echo then
+test && sed test readonly grep awk 2>/dev/null sed --verbose printf readonly "$1"
+${HOME} printf readonly sed 2>/dev/null 2>/dev/null
+		${HOME} -eu 'quoted text' test && awk /usr/bin
+	local --verbose printf "$1" 2>/dev/null /usr/bin
+		$(pwd) echo /usr/bin export ${HOME} --verbose
+		then /usr/bin 'quoted text'
+| $(pwd) local export && cd done 'quoted text'
+		-eu x=1 --verbose cd x=1
+#include c9.sh
+	awk --verbose grep -eu x=1 readonly test export $(pwd) export
+	| $(pwd) $(pwd) grep -eu --verbose ${HOME} $(pwd) echo --verbose
+		grep /usr/bin sed ${HOME} 'quoted text' /usr/bin cd test cd ${HOME} --verbose
+	2>/dev/null awk then 'quoted text' test readonly
+		'quoted text' 2>/dev/null | ${HOME} done echo test | readonly x=1 "$1" x=1 2>/dev/null
+		| readonly awk export "$1" --verbose --verbose x=1 x=1 then local grep
+	readonly local echo $(pwd) export then x=1 /usr/bin
+		/usr/bin done readonly "$@" cd local $(pwd) sed
+	done then cd && $(pwd) echo x=1 x=1 then "$1" sed ${HOME} then readonly
+		x=1 grep -eu done done awk --verbose ${HOME} grep test test done grep
+	${HOME} -eu "$@" | then &&
+		done printf 2>/dev/null echo sed && grep "$1" /usr/bin awk test
+then readonly cd done grep cd awk x=1 readonly 'quoted text'
+	local 'quoted text' 2>/dev/null cd export echo
+	cd && awk "$1" $(pwd) x=1 grep 'quoted text' printf
+then cd /usr/bin printf
+--verbose 2>/dev/null cd local cd x=1 --verbose export test export 2>/dev/null
+	2>/dev/null 2>/dev/null grep sed | --verbose awk 'quoted text' x=1
+		cd local sed -eu then && grep /usr/bin | $(pwd) 2>/dev/null
+		grep printf | printf $(pwd) readonly --verbose sed |
+printf local done x=1 /usr/bin ${HOME} printf cd export
+	| cd | | $(pwd) grep echo grep -eu "$1" | $(pwd)
+local cd "$1" | --verbose echo export local
+	--verbose echo 'quoted text' /usr/bin
+then sed /usr/bin sed "$@" 'quoted text'
+	'quoted text' x=1 ${HOME} | done
+	done awk done --verbose $(pwd) awk
+	"$@" done grep 2>/dev/null test done echo done done $(pwd) /usr/bin echo export
+	done readonly 'quoted text'
+--verbose x=1 readonly 2>/dev/null && ${HOME} /usr/bin "$@"
+		-eu "$@" printf readonly
+		then export readonly "$@" x=1 then done | "$1"
+export printf ${HOME} echo ${HOME} 'quoted text' awk grep readonly
+		grep echo local x=1 readonly echo grep grep -eu readonly /usr/bin
+&& awk /usr/bin 2>/dev/null
+"$@" | --verbose sed grep
+		sed awk awk done echo /usr/bin
+"$@" 'quoted text' /usr/bin "$1" awk
+echo $(pwd) 'quoted text' local
+		"$@" awk local done "$1" done && sed x=1 done local export printf
+echo --verbose -eu 2>/dev/null test x=1 echo
+		cd ${HOME} export 'quoted text' local done done sed | printf --verbose && done 2>/dev/null
+export x=1 export 2>/dev/null printf && export 'quoted text' $(pwd)
+	echo /usr/bin -eu awk -eu 'quoted text' 2>/dev/null x=1 x=1 printf
+		local sed sed printf local 2>/dev/null echo export /usr/bin 2>/dev/null |
+	printf cd 2>/dev/null echo sed /usr/bin printf $(pwd) grep 'quoted text'
+$(pwd) "$1" printf awk "$1" "$1" export awk cd "$1" 2>/dev/null $(pwd) "$1" export
+printf $(pwd) awk -eu
+	sed test readonly cd "$1" "$1" $(pwd) printf
+		$(pwd) x=1 --verbose awk cd --verbose "$1" ${HOME} grep printf
+		x=1 export -eu grep x=1 | "$@" cd ${HOME} printf
+	echo x=1 | | /usr/bin /usr/bin grep --verbose
+		--verbose -eu awk export cd ${HOME} awk export
+done awk "$1" && /usr/bin 'quoted text' readonly
+local test echo "$@" sed x=1 grep local && "$@" 2>/dev/null && sed export readonly
+	--verbose /usr/bin printf
+	grep "$@" "$@" 2>/dev/null /usr/bin "$1" local "$@" sed /usr/bin "$1" 2>/dev/null
+	&& printf echo readonly /usr/bin "$@" awk
+&& then "$@" -eu 'quoted text' $(pwd) done -eu 2>/dev/null done ${HOME}
+"$1" $(pwd) awk 'quoted text' done 'quoted text' 'quoted text'
+echo cd 'quoted text' "$1" sed readonly x=1 then
+	printf awk awk echo test $(pwd) local 'quoted text' printf local 2>/dev/null test
+	| awk $(pwd) cd -eu echo done cd $(pwd) "$1" printf test then && ${HOME}
+		/usr/bin echo readonly $(pwd) test
+| 'quoted text' cd done && --verbose then 2>/dev/null | "$@" 'quoted text'
+		sed 'quoted text' awk "$1" -eu 'quoted text' "$@" "$@" 2>/dev/null export
+		--verbose cd test "$1" grep "$1" /usr/bin --verbose $(pwd) -eu
+	sed ${HOME} "$@" done sed "$@" 2>/dev/null --verbose awk local echo /usr/bin
+export -eu ${HOME} /usr/bin && export local grep --verbose
+	export | $(pwd) sed test && readonly --verbose export /usr/bin
+		sed grep "$1" done awk
+	done cd readonly | -eu $(pwd)
+	local grep then done -eu 'quoted text' 'quoted text' "$@" readonly -eu then
+	then | local ${HOME} export --verbose | echo 2>/dev/null &&
+${HOME} 2>/dev/null cd done -eu ${HOME} "$1" "$@"
+done grep -eu $(pwd) /usr/bin
+"$1" --verbose /usr/bin then "$@" -eu then done printf grep cd test 'quoted text'
+		printf cd local readonly "$@" | readonly cd local done
+/usr/bin test --verbose sed | "$1" --verbose echo echo -eu then
+		test awk /usr/bin export --verbose awk "$@" test 2>/dev/null $(pwd)
+		2>/dev/null printf x=1 awk awk grep export /usr/bin && -eu
+	test readonly 2>/dev/null "$1" export test | readonly -eu
+	x=1 done "$1" 'quoted text'
+	then | sed local local grep x=1 "$1" export &&
+printf --verbose cd grep grep ${HOME} then /usr/bin "$1" sed
+&& "$1" grep echo cd --verbose cd 'quoted text' printf x=1
+cd --verbose printf cd test 'quoted text'
+printf $(pwd) 'quoted text' "$@" $(pwd) test readonly -eu
+printf sed local test echo
+		'quoted text' x=1 echo echo printf
+	echo local readonly then 'quoted text' /usr/bin
+	cd grep done --verbose
+/usr/bin -eu /usr/bin x=1 ${HOME} 'quoted text' done printf
+	/usr/bin echo ${HOME} | "$1" /usr/bin
+		$(pwd) ${HOME} 2>/dev/null && $(pwd) -eu awk then 'quoted text' ${HOME}
+		then then ${HOME} | done echo "$1" $(pwd) /usr/bin
+	"$1" "$1" 'quoted text' 2>/dev/null
+		sed x=1 $(pwd) grep sed
+	local 2>/dev/null && readonly
+local "$@" $(pwd) export done
+then cd export && $(pwd) "$1" awk sed cd cd | x=1 local then grep x=1 awk "$1"
+--verbose 'quoted text' | awk "$1" | x=1 printf cd "$1" 'quoted text' local cd
+-eu $(pwd) 'quoted text'
+	export sed export 'quoted text' local test
+		test -eu "$1" echo 'quoted text' "$1" then
+		"$1" awk export cd sed then | 'quoted text'
+grep && export -eu sed
+		--verbose cd | -eu /usr/bin grep awk
+		done export $(pwd) ${HOME} awk $(pwd) readonly cd test ${HOME} awk
+	test -eu export -eu test "$@" test --verbose awk awk then printf grep test
+then cd "$@" then done echo -eu
+	--verbose readonly $(pwd) 2>/dev/null 'quoted text'
+	x=1 "$@" -eu x=1 sed 2>/dev/null 'quoted text' "$@" -eu 'quoted text' /usr/bin
+| /usr/bin ${HOME} sed --verbose printf readonly printf -eu cd local 2>/dev/null
+	"$@" echo sed 2>/dev/null x=1 2>/dev/null local
+| "$@" local "$1" $(pwd)
+		$(pwd) $(pwd) | x=1 echo echo echo
+		&& cd echo -eu -eu then
+		echo 'quoted text' "$@" printf cd then "$1"
+		x=1 $(pwd) "$@" --verbose test $(pwd) $(pwd) printf
+	test printf ${HOME} echo export readonly "$@" $(pwd) then grep "$1" grep
+		${HOME} sed test | echo done printf then sed echo 2>/dev/null export
+'quoted text' "$@" x=1 sed cd "$@" readonly
+export export /usr/bin sed
+	-eu $(pwd) | && local cd cd test printf done done readonly
+	test export "$1" 2>/dev/null && echo x=1 -eu grep export /usr/bin
+		test 'quoted text' $(pwd) echo
+	done printf done && printf | $(pwd) &&
+	-eu "$@" export 2>/dev/null /usr/bin && x=1 x=1 | sed test then
+sed /usr/bin echo export && | /usr/bin readonly --verbose "$@"
+		done export x=1 --verbose | done awk 'quoted text' "$1" awk 'quoted text' -eu
+awk 2>/dev/null 'quoted text' test echo
+'quoted text' readonly -eu "$@" local done "$@" readonly 'quoted text'
+export cd test then readonly
+		printf awk | cd grep /usr/bin then printf
+awk | && sed $(pwd) "$1" export readonly | x=1 then | "$@" 'quoted text'
+	then awk done /usr/bin then && && sed local "$1" ${HOME}
+awk then sed done then ${HOME} "$@" cd sed "$1" sed "$1"
+		| export echo grep cd awk printf ${HOME} "$@" | ${HOME} ${HOME}
+	x=1 "$1" then done | x=1 -eu 'quoted text'
+		2>/dev/null 2>/dev/null awk 2>/dev/null sed echo && /usr/bin test ${HOME} export
+	then done x=1 ${HOME} sed sed readonly 'quoted text' cd local grep readonly
+done $(pwd) echo 2>/dev/null local x=1 export 'quoted text'
+"$1" --verbose cd export /usr/bin
+		readonly test $(pwd) export printf --verbose then
+		&& && /usr/bin "$@" then sed 'quoted text' x=1
+"$1" -eu ${HOME} test 2>/dev/null --verbose ${HOME}
+		readonly /usr/bin && /usr/bin
+		"$@" "$@" $(pwd) export /usr/bin $(pwd) echo 2>/dev/null 'quoted text'
+		/usr/bin sed "$@" && /usr/bin 2>/dev/null echo awk
+"$@" && printf echo x=1 $(pwd) then --verbose local local
+		grep sed printf then export readonly -eu then test /usr/bin
+	cd echo --verbose ${HOME} printf printf
+	awk then echo 'quoted text' --verbose
+sed ${HOME} /usr/bin export x=1 $(pwd) 2>/dev/null awk -eu --verbose
+${HOME} local 2>/dev/null readonly test echo local
+		-eu 'quoted text' "$1" printf "$1" -eu test | local awk test x=1 echo cd | readonly
+--verbose x=1 | then | ${HOME} | done ${HOME} echo /usr/bin then "$@" && sed
+		${HOME} 2>/dev/null -eu printf export ${HOME} "$1" sed | "$@" then test
+		/usr/bin "$1" cd test $(pwd) --verbose test
+		$(pwd) x=1 sed cd local readonly /usr/bin printf local 'quoted text'
+		export export cd sed -eu
+	'quoted text' echo && && "$1" --verbose 2>/dev/null 'quoted text' printf grep
+	--verbose local /usr/bin 2>/dev/null
+done x=1 test 2>/dev/null readonly cd done --verbose cd
+--verbose grep && /usr/bin done
+echo sed export awk export "$@" echo "$@" echo $(pwd) x=1 'quoted text' "$1"
+		awk 'quoted text' | grep | "$1" sed "$@" printf --verbose local readonly
+		-eu readonly "$1" grep sed readonly readonly local "$@" test 2>/dev/null &&
+awk export -eu grep test "$@" --verbose grep done | sed 'quoted text' 2>/dev/null
+	done 2>/dev/null grep then readonly 'quoted text' "$@" 'quoted text' then test
+done printf echo echo echo grep | x=1 local 'quoted text' export then cd 'quoted text'
+		local awk "$1" readonly --verbose "$@" echo /usr/bin sed ${HOME} 'quoted text'
+		${HOME} local readonly /usr/bin 'quoted text' test local
+		--verbose test cd local 2>/dev/null
+		"$@" x=1 --verbose ${HOME} printf $(pwd) grep done readonly $(pwd) printf
+		sed awk printf /usr/bin done printf grep test readonly
+export 'quoted text' cd done sed 'quoted text' && "$1"
+	local /usr/bin echo "$1" local grep | 'quoted text' export export /usr/bin
+	grep "$@" && 2>/dev/null sed && "$1"
+	2>/dev/null ${HOME} $(pwd) grep | grep done && -eu $(pwd) cd x=1 cd 2>/dev/null
+		awk printf sed --verbose cd awk then export
+"$@" test local awk awk cd awk sed test printf then /usr/bin | $(pwd)
+grep "$@" then then local $(pwd) grep test
+		local readonly && local --verbose grep awk $(pwd) cd -eu --verbose /usr/bin done
+readonly grep 2>/dev/null then 'quoted text'
+	test grep | --verbose && 2>/dev/null 2>/dev/null "$1" "$@"
+	local /usr/bin -eu printf | echo done sed "$@"
+'quoted text' test then then grep sed awk /usr/bin x=1 && 2>/dev/null test export
+		grep | "$@" $(pwd) grep local && echo done
+	"$1" readonly 'quoted text' printf ${HOME} then awk 'quoted text'
+	2>/dev/null $(pwd) ${HOME} --verbose echo readonly x=1 'quoted text'
+echo awk done 2>/dev/null cd echo
+	-eu $(pwd) x=1 -eu && sed done --verbose readonly x=1 done "$1"
+		'quoted text' sed && then 'quoted text' /usr/bin -eu local export "$@" cd x=1
+-eu ${HOME} --verbose echo
+		--verbose done 2>/dev/null grep export -eu echo test local --verbose
+		&& echo ${HOME} $(pwd) x=1 sed "$1" x=1 $(pwd) "$1" /usr/bin
+/usr/bin 'quoted text' /usr/bin | cd /usr/bin sed &&
+awk test --verbose done ${HOME} | "$1" ${HOME} export "$1" |
+sed && x=1 awk -eu --verbose
+		/usr/bin awk x=1 $(pwd) sed
+		grep readonly $(pwd) "$@" ${HOME} export
+	awk /usr/bin $(pwd) export awk printf then export
+		echo test awk 'quoted text' 2>/dev/null /usr/bin $(pwd) local export sed
+	test ${HOME} test awk awk 2>/dev/null "$@" sed "$1" 'quoted text'
+| 'quoted text' readonly export 'quoted text' 2>/dev/null grep "$@"
+		grep $(pwd) grep printf echo -eu echo local awk 2>/dev/null awk test local
+printf /usr/bin 'quoted text' awk local sed -eu local ${HOME} ${HOME} then
+	| && awk echo x=1 echo echo | $(pwd) --verbose "$1" "$@"
+	export x=1 test -eu local then
+		/usr/bin "$@" done done local -eu cd "$@"
+		echo --verbose sed readonly && x=1 -eu | printf 'quoted text' echo grep
+	'quoted text' readonly $(pwd) ${HOME} 2>/dev/null sed cd && --verbose 2>/dev/null
+	${HOME} export -eu | readonly
+		&& "$@" cd awk "$1" | 'quoted text' awk "$@" test cd 'quoted text'
+"$@" local local done local $(pwd) export echo echo done grep then
+readonly then 2>/dev/null | local echo --verbose export 2>/dev/null
+awk /usr/bin | cd ${HOME} then then 2>/dev/null "$1" "$@" awk
+	| | done /usr/bin test x=1 awk sed export readonly then && ${HOME}
+		printf "$1" local local grep
+grep && --verbose 'quoted text' done then && "$1" --verbose "$@" --verbose
+	x=1 awk test local echo ${HOME} x=1 x=1 done "$1"
+'quoted text' readonly ${HOME} | --verbose $(pwd) x=1 | | echo grep
+	/usr/bin done $(pwd) awk ${HOME} done done "$1" local awk -eu grep readonly
+		$(pwd) -eu && $(pwd) grep grep done echo $(pwd) x=1 /usr/bin
+| sed then | local x=1 "$1" | | --verbose local 'quoted text'
+	2>/dev/null then done sed export echo ${HOME} cd
+--verbose echo then done x=1 --verbose "$@" -eu /usr/bin $(pwd)
+		x=1 --verbose then local done readonly awk done then echo awk |
+		${HOME} "$1" --verbose ${HOME} x=1 --verbose
+	local echo ${HOME} printf --verbose
+		&& done local ${HOME} $(pwd) "$@" -eu
+	test export grep "$@" test
+		echo done 'quoted text' echo done
+		2>/dev/null ${HOME} done sed $(pwd) $(pwd) done cd
+		test --verbose "$@" echo echo 'quoted text' /usr/bin local echo
+-eu test -eu done -eu sed test /usr/bin cd && x=1 sed awk echo awk printf "$@"
+		/usr/bin && -eu | --verbose && done sed printf
+		echo readonly export --verbose "$@" test
+	echo export awk $(pwd) "$1" /usr/bin test ${HOME} 2>/dev/null
+readonly /usr/bin export /usr/bin
+"$1" -eu local grep -eu then echo /usr/bin 'quoted text'
+	"$1" "$@" readonly && cd sed sed |
+		${HOME} /usr/bin done grep 2>/dev/null
+--verbose echo -eu x=1 sed --verbose
+local /usr/bin ${HOME} grep -eu --verbose then "$@" x=1 test
+	done cd -eu "$@" export -eu $(pwd)
+	${HOME} done --verbose printf then printf export --verbose 2>/dev/null
+-eu 'quoted text' grep 2>/dev/null ${HOME} grep 'quoted text' printf
+	&& sed x=1 cd "$@" "$1" printf export
+echo "$1" test awk awk echo | --verbose 2>/dev/null
+&& 2>/dev/null test printf && ${HOME} grep printf cd printf done && sed
+sed grep cd test $(pwd) -eu 'quoted text' cd "$1"
+		x=1 "$@" printf then readonly ${HOME} --verbose readonly 2>/dev/null done
+	2>/dev/null readonly | | -eu local cd "$@" then readonly local
+test --verbose "$1" -eu grep sed | | /usr/bin echo 2>/dev/null
+		grep -eu echo test then echo --verbose then "$@" --verbose "$@" readonly
+		&& "$@" readonly then test local export awk grep
+	--verbose 'quoted text'
+	-eu test -eu local x=1 echo "$1" done local awk
+&& "$@" export grep 'quoted text' awk "$1" | -eu && ${HOME} then
+	awk done x=1 awk awk 'quoted text' && echo sed cd awk test sed && sed
+done local sed done ${HOME} local "$1"
+printf awk --verbose then "$1" |
+		echo done --verbose echo
+		test 'quoted text' then cd printf --verbose cd -eu
+	cd && test x=1 local ${HOME} 'quoted text' -eu "$@" done 2>/dev/null
+		--verbose && done awk export "$@" 2>/dev/null
+	echo x=1 cd done /usr/bin cd test test "$@" 2>/dev/null
+readonly -eu "$@" done $(pwd)
+		&& --verbose local -eu readonly "$@" 2>/dev/null readonly
+		&& readonly printf sed echo local x=1 grep done && export
+'quoted text' 'quoted text' then echo grep && awk export printf
+		then "$@" grep readonly 'quoted text' ${HOME}
+	sed done 2>/dev/null | local /usr/bin
+		readonly grep awk export x=1 'quoted text' -eu done ${HOME}
+2>/dev/null /usr/bin | x=1 && grep grep sed $(pwd)
+	${HOME} 'quoted text' ${HOME} sed awk cd /usr/bin grep $(pwd)
+$(pwd) test test readonly cd "$@" grep --verbose "$1" "$@" then
+		readonly printf awk "$@" ${HOME} grep
+		awk printf sed done echo done local awk ${HOME}
+		-eu -eu 2>/dev/null $(pwd) cd local done done cd
+		local done 2>/dev/null readonly --verbose
+${HOME} awk local test ${HOME} 2>/dev/null
+	echo "$1" x=1 $(pwd) -eu cd -eu cd done 2>/dev/null grep cd
+		${HOME} -eu ${HOME} sed
+${HOME} cd $(pwd) $(pwd) $(pwd) 2>/dev/null
+		2>/dev/null readonly sed local 'quoted text'
+	done sed then readonly test x=1 readonly test test -eu
+	x=1 awk printf --verbose && --verbose x=1 /usr/bin printf export /usr/bin
+export grep local "$1" grep export sed
+		grep "$@" sed && export &&
+	done | 'quoted text' x=1 then ${HOME} awk /usr/bin --verbose readonly then
+${HOME} ${HOME} 'quoted text' local
+		"$@" --verbose test /usr/bin $(pwd) awk sed | cd | 2>/dev/null
+cd | 2>/dev/null awk $(pwd)
+awk local ${HOME} done grep "$1" "$1" grep grep -eu
+		-eu -eu -eu awk sed done
+&& sed x=1 x=1 sed "$@" test awk local printf local test x=1
+		done "$1" "$@" "$1" readonly export sed
+	"$@" "$@" | cd --verbose 2>/dev/null | export printf done awk -eu echo
+	'quoted text' | "$1" readonly then test printf export readonly
+		printf | /usr/bin test export export printf grep
+awk -eu sed 2>/dev/null ${HOME}
+	sed "$@" ${HOME} --verbose printf "$@" && export printf && -eu -eu /usr/bin
+	'quoted text' echo export then && "$1" /usr/bin 2>/dev/null x=1 | sed
+		${HOME} --verbose test -eu "$1" 2>/dev/null printf test
+		${HOME} then grep 'quoted text' done -eu printf | echo
+${HOME} /usr/bin then grep --verbose readonly cd local local && awk ${HOME}
+/usr/bin "$@" "$@" 2>/dev/null printf x=1 then awk "$1" echo
+		then && --verbose "$1" 'quoted text' ${HOME} --verbose then --verbose done "$@"
+	"$1" -eu "$@" awk --verbose && printf test echo
+"$1" printf 2>/dev/null echo | 2>/dev/null "$@" test 'quoted text'
+		&& /usr/bin --verbose | && 'quoted text' "$1" printf test cd
+		printf readonly awk &&
+		local | | echo readonly awk
+	then then done echo --verbose
+-eu /usr/bin awk && x=1 'quoted text' done export x=1 --verbose
+	printf | x=1 test done --verbose done -eu
+test echo then then readonly echo export test --verbose | &&
+cd done done export echo grep awk echo x=1
+cd awk echo "$@" export then grep -eu
+		/usr/bin sed $(pwd) test then "$@" cd
+	2>/dev/null echo ${HOME} grep then 'quoted text'
+	cd && "$1" 'quoted text' then "$1"
+	readonly then ${HOME} ${HOME}
+	done $(pwd) cd $(pwd) echo sed grep local readonly then -eu 'quoted text' export
+	grep $(pwd) ${HOME} grep test 'quoted text' "$@" grep
+	done | "$@" test 2>/dev/null
+$(pwd) sed 2>/dev/null local ${HOME} "$@" awk x=1 sed grep echo cd echo 2>/dev/null
+	x=1 then test test sed | $(pwd) local $(pwd) done local /usr/bin --verbose "$@"
+		&& then --verbose export /usr/bin
+	x=1 "$@" test x=1 -eu ${HOME} printf ${HOME}
+	grep cd 2>/dev/null x=1 2>/dev/null
+$(pwd) "$1" cd awk readonly | done grep && ${HOME} test export
+	test | --verbose $(pwd) -eu then 2>/dev/null test echo x=1 'quoted text'
+		local cd done awk -eu sed -eu --verbose "$1" --verbose
+cd echo ${HOME} -eu -eu done && /usr/bin 'quoted text' 2>/dev/null $(pwd)
+	${HOME} echo && cd 2>/dev/null "$@" export && local --verbose
+	'quoted text' "$1" 'quoted text' local readonly
+printf local cd --verbose "$1" 2>/dev/null readonly "$@" grep done "$1" --verbose
+sed x=1 export ${HOME} $(pwd) --verbose
+cd x=1 | x=1 /usr/bin -eu
+		grep awk "$@" done then done local 2>/dev/null then && /usr/bin | echo sed
+		sed "$@" test x=1 $(pwd) echo x=1 --verbose
+	x=1 cd echo ${HOME} export | cd printf done
+		x=1 $(pwd) --verbose printf local
+/usr/bin --verbose ${HOME} printf "$1" 'quoted text'
+	readonly then "$1" "$@" "$1" $(pwd) --verbose awk done --verbose
+		done ${HOME} -eu cd ${HOME} 2>/dev/null ${HOME} then /usr/bin && "$@"
+		cd sed 2>/dev/null | $(pwd) ${HOME}
+&& && sed printf test printf --verbose 2>/dev/null 'quoted text'
+		${HOME} x=1 printf 2>/dev/null local export /usr/bin
+		then sed cd cd 2>/dev/null export
+	'quoted text' cd awk test then echo done x=1 "$@" "$1" $(pwd) "$@"
+echo $(pwd) | "$@" printf 2>/dev/null ${HOME} then readonly printf ${HOME}
+	echo -eu echo "$@" /usr/bin "$1" 'quoted text' "$@" && 'quoted text'
+local 'quoted text' 'quoted text'
+		local | test test ${HOME} 2>/dev/null
+local printf done sed
+	export cd --verbose echo done
+	test readonly echo echo "$@" export cd 2>/dev/null awk --verbose
+2>/dev/null && "$1" grep local readonly
+		$(pwd) sed awk printf sed x=1 export -eu readonly && cd "$@"
+		--verbose /usr/bin printf
+		$(pwd) grep local then readonly done
+	'quoted text' echo echo |
+	done ${HOME} $(pwd) /usr/bin /usr/bin test cd $(pwd) -eu x=1 done
+	local 'quoted text' sed && ${HOME} --verbose cd --verbose
+		x=1 "$1" cd 'quoted text' && $(pwd) cd && "$1" cd export export grep done echo
+		test "$1" | readonly local 'quoted text' && "$@" done "$1" readonly "$@"
+	printf cd x=1 --verbose readonly 'quoted text' x=1 | /usr/bin then 2>/dev/null
+		$(pwd) --verbose export local then cd $(pwd) printf done
+		grep sed awk /usr/bin grep local /usr/bin 2>/dev/null
+	&& echo ${HOME} printf grep "$1"
+		-eu cd -eu -eu cd printf printf /usr/bin ${HOME} local x=1 awk ${HOME} cd test
+	x=1 /usr/bin export awk local export -eu export "$1" /usr/bin 'quoted text'
+x=1 grep | export echo 'quoted text'
+export awk --verbose sed readonly
+		${HOME} $(pwd) "$@" 2>/dev/null | -eu /usr/bin export "$@" echo ${HOME}
+readonly 'quoted text' x=1 2>/dev/null | awk readonly
+-eu local grep | export test echo 'quoted text' readonly 'quoted text' --verbose
+		"$1" echo x=1 x=1 x=1 -eu grep
+test 'quoted text' printf grep --verbose -eu grep
+2>/dev/null then grep readonly local
+	awk sed --verbose local cd done printf readonly echo 'quoted text' --verbose
+		local echo "$@" "$1" "$1" sed x=1 'quoted text' done 'quoted text' readonly printf
+		&& done cd --verbose | x=1 ${HOME} done then
+export -eu && "$@" "$1" then x=1 test
+		'quoted text' awk ${HOME} grep --verbose --verbose
+		-eu local "$1" "$1" echo | export "$@" then cd 'quoted text'
+		-eu grep x=1 readonly awk awk --verbose
+		| /usr/bin echo export
+/usr/bin && --verbose 2>/dev/null printf awk 2>/dev/null && x=1 cd x=1 readonly
+	printf ${HOME} grep && test $(pwd) | | printf
+		done export "$1" local readonly 2>/dev/null test sed /usr/bin printf
+sed x=1 done && sed awk $(pwd) ${HOME} readonly ${HOME} grep /usr/bin printf
+local then --verbose local "$@" grep /usr/bin "$@" $(pwd) "$1" grep
+	$(pwd) done grep done then /usr/bin awk then grep /usr/bin local | -eu -eu
+	x=1 cd && test ${HOME} local $(pwd) local
+		2>/dev/null 'quoted text' && done x=1 |
+	awk readonly printf "$@"
+	-eu 2>/dev/null "$@" printf printf
+| sed x=1 readonly && 2>/dev/null echo --verbose $(pwd) | && -eu done ${HOME} cd
+	export /usr/bin 2>/dev/null
+awk echo export awk then readonly -eu done local awk done
+2>/dev/null && "$1" awk x=1 test grep cd --verbose test | 'quoted text' sed $(pwd)
+		local | done "$1" -eu test
+		then awk --verbose "$@" export $(pwd) grep /usr/bin --verbose $(pwd) $(pwd) --verbose
+		awk && x=1 "$1" then 2>/dev/null ${HOME} --verbose "$@" sed then sed readonly
+	&& "$1" x=1 printf "$1" $(pwd)
+readonly grep test grep
+	readonly 2>/dev/null export local awk &&
+		readonly 'quoted text'
+-eu "$@" ${HOME} "$@" 'quoted text' local $(pwd) sed awk local done
+	"$@" $(pwd) done /usr/bin | 'quoted text' "$@"
+	awk -eu done echo $(pwd) then ${HOME} /usr/bin readonly $(pwd)
+	done readonly readonly done readonly $(pwd) printf local
+local sed /usr/bin sed readonly 'quoted text' done ${HOME} grep readonly &&
+		local -eu then then then then x=1 grep echo
+		grep printf grep cd sed --verbose | readonly "$@" done export test x=1 export
+		$(pwd) "$@" local export "$@" grep x=1 x=1 "$1"
+		sed && sed x=1 ${HOME} sed sed -eu then grep /usr/bin
+	"$1" readonly then x=1 test readonly readonly
+	-eu | "$1" readonly export --verbose then
+	"$1" readonly grep export --verbose
+cd /usr/bin 2>/dev/null test $(pwd) | awk /usr/bin && printf grep x=1 'quoted text'
+		"$@" done export /usr/bin local test "$1" $(pwd)
+		local test $(pwd) | export awk local 2>/dev/null export sed
+	then echo readonly && | $(pwd) "$@" export
+	printf awk /usr/bin sed
+	'quoted text' && printf --verbose && readonly printf
+	| x=1 --verbose export awk 'quoted text' local echo -eu
+	done 2>/dev/null done readonly -eu -eu $(pwd) "$1" readonly
+	"$1" export cd export "$@" "$1" x=1 $(pwd) ${HOME}
+test sed awk printf test echo export export | x=1 awk done | && echo cd cd cd "$@"
+--verbose then sed printf printf then test
+printf cd then readonly $(pwd) | done printf
+		awk test 'quoted text' | -eu ${HOME} echo local local 2>/dev/null && readonly
+readonly test cd then grep echo readonly ${HOME} 'quoted text'
+	/usr/bin sed readonly grep --verbose x=1 2>/dev/null
+/usr/bin readonly "$1"
+		/usr/bin grep sed $(pwd) /usr/bin printf "$1" sed |
+		&& done "$1" sed test x=1 sed -eu local /usr/bin then awk x=1 printf ${HOME}
+	done export "$@" local
+	"$1" then readonly /usr/bin 'quoted text' "$1" x=1 done
+		$(pwd) 'quoted text' -eu echo readonly
+		local | export awk /usr/bin --verbose awk echo echo 'quoted text' sed -eu ${HOME}
+export /usr/bin cd "$@" sed -eu
+	export x=1 cd done "$@" done echo | "$@" "$1" && 2>/dev/null
+local echo && x=1 grep export &&
+/usr/bin "$1" export /usr/bin then $(pwd) echo $(pwd) then
+readonly "$@" 2>/dev/null -eu cd export "$1" done done $(pwd) --verbose sed
+		"$1" sed $(pwd) printf grep &&
+export grep done | echo ${HOME} x=1 -eu then -eu ${HOME}
+/usr/bin x=1 /usr/bin x=1 "$1" 'quoted text'
+	readonly "$1" "$1" | 'quoted text'
+${HOME} test readonly 'quoted text' local local done grep "$1" local $(pwd) 'quoted text'
+	export /usr/bin x=1 "$@"
+test printf | readonly awk "$@" "$@" done x=1 &&
+x=1 test local echo -eu readonly then
+	&& awk $(pwd) awk && grep --verbose /usr/bin
+		printf export && then export $(pwd) echo
+done | x=1 done echo && echo done grep export ${HOME} "$1"
+	readonly awk 'quoted text' then export $(pwd) export --verbose
+		/usr/bin --verbose then local 2>/dev/null
+	export grep "$1" awk done cd $(pwd) "$1" awk $(pwd) $(pwd) readonly
+		done printf | grep && -eu local && x=1 done
+2>/dev/null grep export grep readonly
+	test grep echo awk --verbose awk ${HOME} 'quoted text' $(pwd) done | 2>/dev/null
+	--verbose echo -eu "$1" | awk && $(pwd) echo grep ${HOME}
+		local x=1 export export then echo /usr/bin
+		export done $(pwd) printf test | then awk -eu x=1 --verbose local cd 'quoted text'
+--verbose printf awk --verbose export --verbose
+'quoted text' export "$1" "$1"
+		then /usr/bin --verbose done then local
+'quoted text' "$1" 'quoted text' printf
+grep "$@" echo --verbose --verbose 2>/dev/null
+		2>/dev/null "$1" awk cd 'quoted text'
+	export printf echo export 'quoted text' test "$@" ${HOME}
+	awk 'quoted text' 'quoted text' done
+$(pwd) 'quoted text' printf cd 2>/dev/null awk
+		2>/dev/null x=1 'quoted text' local export 2>/dev/null printf printf
+		${HOME} -eu x=1 ${HOME} "$@" local "$@" -eu $(pwd) cd x=1 'quoted text'
+		grep x=1 /usr/bin ${HOME} 2>/dev/null test sed $(pwd) done printf 'quoted text'
+	x=1 'quoted text' printf then grep /usr/bin ${HOME} sed 2>/dev/null
+	x=1 "$1" export && sed readonly "$1" sed 2>/dev/null done "$1" test
+&& $(pwd) export printf ${HOME} test | done 2>/dev/null
+	sed | awk readonly grep 2>/dev/null
+	local "$@" cd readonly
+		--verbose "$1" printf | echo --verbose 2>/dev/null local --verbose
+	readonly && local ${HOME} awk | --verbose
+		'quoted text' sed done grep
+	'quoted text' sed export ${HOME}
+		done x=1 sed test --verbose echo cd readonly && x=1 cd cd then
+then cd sed cd x=1 "$@"
+	'quoted text' | -eu && | ${HOME} export ${HOME} test readonly awk then /usr/bin
+		local "$@" printf then then echo readonly -eu --verbose
+| done ${HOME} then done awk done 'quoted text'
+	awk | --verbose "$@" x=1 'quoted text'
+	awk done sed awk ${HOME} sed /usr/bin then sed sed "$1" export -eu local
+2>/dev/null $(pwd) x=1 readonly 'quoted text' test export done |
+		awk test grep echo ${HOME} "$1" awk /usr/bin
+		"$@" 2>/dev/null then -eu awk cd grep readonly local
+export | readonly done "$@"
+		--verbose cd printf grep
+grep --verbose test $(pwd) echo 2>/dev/null x=1 x=1 awk awk printf
+"$1" then ${HOME} "$@" --verbose awk done -eu printf
+		2>/dev/null x=1 "$@" readonly 'quoted text' x=1 readonly sed "$@" grep grep export
+		grep awk "$@" --verbose cd -eu -eu printf
+cd sed ${HOME} -eu readonly readonly --verbose /usr/bin && --verbose then 2>/dev/null
+		/usr/bin "$@" printf x=1 $(pwd) 'quoted text' then x=1 local export awk
+		local echo "$@" "$1" -eu then && done readonly awk cd done x=1
+&& readonly echo awk printf printf grep echo --verbose
+$(pwd) export sed echo --verbose local done cd grep "$@" |
+done 'quoted text' x=1 'quoted text'
+	printf "$@" "$@" 'quoted text' "$1"
+		"$1" | test x=1 | printf test sed sed echo
+	awk x=1 printf "$@" 'quoted text' $(pwd) -eu echo "$1" | sed then
+	test test readonly x=1
+echo printf printf grep 'quoted text' grep "$1" cd "$@" 2>/dev/null test
+		cd -eu 'quoted text' 'quoted text' 2>/dev/null echo "$@" readonly
+	${HOME} 2>/dev/null "$@" /usr/bin 'quoted text' 2>/dev/null 2>/dev/null
+	--verbose 2>/dev/null -eu cd --verbose | 'quoted text' done $(pwd) echo local
+	${HOME} export "$@" cd cd local ${HOME} /usr/bin | && done 2>/dev/null
+		export readonly test -eu sed sed then -eu
+		done readonly then -eu 'quoted text' done 2>/dev/null && $(pwd)
+$(pwd) test printf export test readonly
+"$1" | readonly cd export readonly export cd $(pwd)
+	export -eu printf "$1" local && then awk then done export
+	grep && grep x=1 x=1 x=1 ${HOME} && printf /usr/bin local awk $(pwd) grep
+	--verbose test local x=1 export local done test awk done && | awk --verbose
+	| -eu $(pwd) done x=1 printf done readonly awk grep 2>/dev/null readonly
+		| /usr/bin x=1 'quoted text'
+2>/dev/null sed "$@" 2>/dev/null done sed | readonly awk printf | --verbose
+| test test grep sed grep ${HOME}
+"$@" 2>/dev/null printf $(pwd) export then test -eu sed
+	then --verbose $(pwd) local then then
+		test awk done /usr/bin 2>/dev/null
+	--verbose && x=1 && "$@" "$@" /usr/bin then local awk cd then cd "$@" test
+	readonly ${HOME} done -eu && 'quoted text'
+		then && $(pwd) echo awk echo test x=1 'quoted text'
+		done ${HOME} 'quoted text' 'quoted text' awk sed 2>/dev/null
+		grep ${HOME} "$1" printf readonly --verbose
+${HOME} local done x=1 cd | then
+	&& "$1" grep x=1 sed | grep grep cd echo awk
+		-eu && awk done readonly 'quoted text'
+		then sed echo x=1 readonly |
+	local 'quoted text' "$@" x=1 "$1" grep --verbose
+		"$1" test 'quoted text' local 'quoted text' "$@" -eu export 2>/dev/null test awk
+'quoted text' awk -eu readonly export -eu ${HOME} /usr/bin
+		&& | echo 2>/dev/null echo then 'quoted text' printf readonly | 'quoted text'
+	printf test done x=1 sed "$@" | /usr/bin local readonly --verbose
+	--verbose -eu ${HOME} --verbose printf printf "$1" awk /usr/bin
+		2>/dev/null local printf echo readonly cd --verbose sed --verbose
+"$@" cd "$@" local --verbose done grep x=1 printf printf "$1" test
+		-eu "$@" "$@" local grep "$1" $(pwd) cd printf
+	local 'quoted text' printf && local sed -eu cd && sed
+		done done sed cd x=1 readonly grep cd /usr/bin local test "$@" then readonly
+		done ${HOME} grep awk --verbose $(pwd) local "$@" && then test done
+awk /usr/bin cd "$1" /usr/bin echo x=1 grep 2>/dev/null "$@" grep awk
+	"$@" readonly $(pwd) printf ${HOME} /usr/bin /usr/bin printf cd /usr/bin
+		$(pwd) export then test 'quoted text' export "$@"
+		/usr/bin grep echo x=1 2>/dev/null "$1"
+local 2>/dev/null local test | | "$@" awk done export | local sed printf
+readonly test ${HOME} sed done printf "$1" cd -eu grep 'quoted text' cd $(pwd) &&
+		'quoted text' printf awk /usr/bin "$@" "$@" ${HOME} $(pwd) echo then then local
+		then echo then && "$1" awk "$1" awk local 2>/dev/null --verbose echo cd | /usr/bin
+	sed printf export awk grep
+	"$@" --verbose | --verbose $(pwd)
+		echo sed 'quoted text' then sed --verbose
+	-eu local echo | done /usr/bin x=1 local --verbose 'quoted text' test
+		"$@" readonly export cd printf
+awk echo --verbose 'quoted text' "$@" $(pwd)
+	x=1 test ${HOME} -eu 2>/dev/null "$1"
+		"$@" printf awk 2>/dev/null "$1"
+	$(pwd) $(pwd) 2>/dev/null
+		readonly done /usr/bin grep then done then ${HOME} done echo
+	| local 'quoted text' awk readonly && x=1 /usr/bin readonly 2>/dev/null sed
+	&& export then sed "$@" readonly printf $(pwd)
+	$(pwd) $(pwd) x=1 readonly "$@" "$@"
+		x=1 test --verbose && && $(pwd) 'quoted text' readonly $(pwd) local
+cd x=1 readonly ${HOME} && 'quoted text' test -eu done ${HOME} export
+	'quoted text' cd grep done echo sed cd --verbose
+		--verbose test "$1" done | && sed cd grep && "$@" then done
+		&& /usr/bin $(pwd) -eu local $(pwd)
+local echo | -eu 'quoted text' test x=1 done -eu
+	${HOME} readonly "$1" $(pwd) awk echo "$@" --verbose x=1 grep 2>/dev/null
+sed 2>/dev/null test local 'quoted text'
+readonly "$@" then | cd echo echo export | then
+		readonly | echo sed test printf 2>/dev/null readonly /usr/bin local -eu -eu
+		'quoted text' test -eu "$1" export && x=1 | export
+awk && $(pwd) --verbose $(pwd) export --verbose /usr/bin && && export
+		printf 2>/dev/null sed $(pwd) "$1" echo -eu export | x=1
+	grep && local && grep $(pwd) 2>/dev/null sed readonly printf then done done
+		sed --verbose export cd printf ${HOME}
+/usr/bin sed printf "$1" "$1" 2>/dev/null "$@"
+	echo then grep "$@" $(pwd)
+grep cd "$1" awk && done awk cd test
+	| | && done sed "$@" --verbose test 2>/dev/null ${HOME}
+then printf --verbose readonly then 2>/dev/null
+		/usr/bin x=1 sed sed cd test 'quoted text'
+printf awk x=1 printf 2>/dev/null x=1 echo sed then x=1 /usr/bin cd
+		--verbose sed cd -eu && x=1 "$1" 2>/dev/null sed ${HOME}
+	${HOME} | then 'quoted text' printf local "$1" awk 2>/dev/null cd "$1" && $(pwd)
+	cd echo awk cd sed "$@" $(pwd) 'quoted text' --verbose awk
+	done awk 2>/dev/null && | awk 'quoted text' then cd 'quoted text'
+| awk 2>/dev/null && export x=1 readonly sed x=1 sed
+	local --verbose $(pwd) /usr/bin --verbose "$@" export
+	x=1 -eu grep cd x=1 --verbose
+	test "$1" | x=1 --verbose awk
+export $(pwd) test then sed | readonly grep x=1 export
+		${HOME} echo 2>/dev/null 'quoted text' -eu printf
+export --verbose local local readonly
+		awk "$1" printf sed 2>/dev/null local ${HOME} && echo 2>/dev/null $(pwd) 2>/dev/null
+	--verbose export ${HOME} "$@" ${HOME} ${HOME} export
+awk grep "$1" --verbose local
+	readonly "$1" --verbose | && printf /usr/bin done
+| done then /usr/bin ${HOME} done && && | test test grep -eu local $(pwd) -eu
+		awk cd export $(pwd) "$1" | /usr/bin 'quoted text'
+		printf ${HOME} 'quoted text'
+	"$@" then test export 2>/dev/null
+		cd ${HOME} 2>/dev/null awk && && then $(pwd) $(pwd)
+		&& export done local cd 'quoted text' awk "$@"
+	"$@" /usr/bin local "$@" echo sed awk printf /usr/bin 'quoted text' ${HOME}
+		-eu /usr/bin grep local awk "$1" "$1" test --verbose 'quoted text' "$1"
+	${HOME} /usr/bin ${HOME} 2>/dev/null /usr/bin grep echo --verbose
+x=1 2>/dev/null printf -eu $(pwd) && echo grep x=1 ${HOME} printf sed
+		'quoted text' readonly
+test echo /usr/bin "$@" printf done sed readonly
+		"$@" printf x=1 awk cd $(pwd) cd "$@" then x=1 then |
+	cd -eu | awk local printf x=1 test &&
+$(pwd) && ${HOME} test done --verbose grep printf "$@" ${HOME} echo 'quoted text'
+${HOME} echo 'quoted text' 'quoted text' && echo local sed local "$1"
+		local awk "$1" sed cd cd $(pwd) -eu 2>/dev/null "$@" grep cd ${HOME} --verbose
+	-eu "$1" then readonly local then x=1 2>/dev/null grep cd --verbose
+	/usr/bin x=1 export done cd -eu ${HOME} -eu && awk echo x=1
+x=1 cd local test -eu "$@" 2>/dev/null printf ${HOME} --verbose "$1" &&
+		${HOME} printf cd grep awk "$1" readonly "$@" awk
+readonly 'quoted text' x=1 awk then --verbose awk $(pwd) done sed echo printf
+		readonly grep ${HOME} readonly x=1 && "$1" 'quoted text' done "$1" local
+	--verbose x=1 done export sed then done
+| awk cd local printf "$@" && --verbose ${HOME} printf echo "$1"
+	then "$1" x=1 sed local "$@" ${HOME} readonly -eu test ${HOME} test
+"$@" -eu awk -eu ${HOME} $(pwd)
+		export "$1" awk sed /usr/bin test /usr/bin --verbose 'quoted text'
+	test printf grep test local --verbose 2>/dev/null
+		| x=1 readonly --verbose readonly test x=1 &&
+	awk --verbose $(pwd) 'quoted text' --verbose grep printf x=1 cd 'quoted text'
+		--verbose export --verbose --verbose test
+	test "$@" export printf test then sed cd "$1" "$1" cd /usr/bin readonly cd local
+	--verbose | ${HOME} &&
+	then "$@" then /usr/bin -eu "$1" test 2>/dev/null ${HOME} echo 2>/dev/null -eu
+	local grep "$@" "$@" "$1" cd readonly "$@" -eu "$1" -eu /usr/bin done
+		$(pwd) echo local "$@" $(pwd) readonly --verbose | then grep 'quoted text'
+awk grep test grep local ${HOME}
+	'quoted text' && cd -eu ${HOME} grep 'quoted text' x=1 echo cd printf echo /usr/bin
+done cd export done grep readonly awk grep cd
+"$1" export "$1" "$@" -eu echo 'quoted text' local echo readonly
+	then grep "$1" $(pwd) test grep
+	x=1 then local | grep awk then x=1
+		&& x=1 --verbose ${HOME} awk then readonly printf $(pwd) -eu ${HOME}
+	printf ${HOME} $(pwd) $(pwd) "$1"
+printf awk then done "$@" grep export
+&& x=1 then sed awk 'quoted text' local && -eu 2>/dev/null
+		&& cd then printf x=1 printf 2>/dev/null && x=1 | readonly then "$1" readonly
+	local 'quoted text' sed | local
+		then && sed "$@" "$@" | 'quoted text' echo echo sed cd done
+done printf echo "$1" printf -eu ${HOME} grep grep local awk $(pwd)
+		2>/dev/null | "$1" sed echo "$1" cd -eu test --verbose x=1 grep --verbose
+		readonly cd then 'quoted text'
+local | export done 2>/dev/null done readonly && | "$@"
+		then | $(pwd) export echo readonly local sed | done 2>/dev/null grep ${HOME}
+	export /usr/bin "$@" --verbose echo x=1 sed readonly
+local | export echo "$1" && "$@" /usr/bin
+	$(pwd) readonly then /usr/bin
+		grep local $(pwd) "$@" x=1 then $(pwd) ${HOME}
+		| x=1 done "$1" | printf ${HOME} "$1" echo export
+	cd ${HOME} printf readonly echo awk local cd "$@" && test export
+		test | && grep "$1" echo -eu awk sed sed local 'quoted text'
+	&& $(pwd) 2>/dev/null /usr/bin test awk && ${HOME} grep printf ${HOME} -eu
+-eu "$@" && readonly 2>/dev/null -eu
+		--verbose x=1 | -eu export grep sed then printf
+		| "$1" ${HOME} 2>/dev/null 'quoted text' 2>/dev/null -eu awk
+test 2>/dev/null | cd export grep readonly awk echo test 2>/dev/null
+		--verbose 'quoted text' --verbose "$@" | ${HOME} "$@" ${HOME} && then $(pwd)
+		"$@" | $(pwd) ${HOME} ${HOME} cd "$@" done echo && echo $(pwd)
+2>/dev/null printf $(pwd) /usr/bin
+		$(pwd) readonly -eu /usr/bin
+		x=1 done && done export readonly readonly awk
+	--verbose ${HOME} echo | local printf local
+	cd ${HOME} then $(pwd) grep sed -eu -eu /usr/bin sed
+done /usr/bin -eu then --verbose x=1 echo done echo
+then readonly | echo export test x=1 echo readonly "$1" "$1" | export cd
+	| awk /usr/bin $(pwd) "$1" export awk x=1 readonly readonly sed
+		done then awk readonly local
+		--verbose echo then -eu
+	&& "$@" 'quoted text' test
+	"$1" /usr/bin then --verbose 2>/dev/null -eu awk local done 'quoted text'
+		echo 2>/dev/null ${HOME} | -eu ${HOME} printf sed local
+		--verbose test export -eu test 2>/dev/null /usr/bin
+		then cd && x=1 then sed export --verbose 2>/dev/null 2>/dev/null
+	'quoted text' printf $(pwd) export then "$1"
+		readonly "$@" x=1 echo done 'quoted text' -eu readonly awk x=1 "$1" $(pwd) 'quoted text'
+	"$@" printf | grep --verbose "$1" then ${HOME} sed echo
+	export "$@" "$@" printf sed grep echo echo "$@" sed -eu local --verbose
+	echo ${HOME} | -eu awk --verbose
+	printf cd x=1 done echo -eu 'quoted text' 2>/dev/null cd && /usr/bin
+	echo done echo $(pwd) echo "$1" echo x=1 sed test | export --verbose
+		cd awk done printf export done test awk test then
+	${HOME} "$1" --verbose grep readonly /usr/bin 2>/dev/null
+		cd ${HOME} --verbose printf /usr/bin | awk then printf echo printf then &&
+		"$1" "$@" | | "$@" cd awk grep && -eu "$1"
+	x=1 readonly then local "$@" | done
+	printf done grep then 2>/dev/null test cd local
+	2>/dev/null --verbose then readonly 'quoted text'
+echo readonly readonly export done --verbose export
+		readonly "$@" echo "$@" --verbose &&
+--verbose "$@" grep | cd
+	-eu printf export "$@" /usr/bin export
+	local && awk /usr/bin 2>/dev/null
+	&& "$1" "$1" x=1 "$1" sed echo test 2>/dev/null "$1" --verbose cd "$@" cd
+	| "$@" "$1" ${HOME} cd done -eu ${HOME} $(pwd) sed ${HOME} test sed
+'quoted text' && grep --verbose
+		"$@" $(pwd) test done echo && export then readonly grep $(pwd) export | awk export
+	sed -eu && "$1" echo --verbose 2>/dev/null x=1 x=1 /usr/bin --verbose
+	local $(pwd) printf ${HOME} cd echo test
+		local -eu x=1 /usr/bin readonly printf cd -eu --verbose /usr/bin --verbose -eu
+awk done -eu echo --verbose
+/usr/bin $(pwd) test readonly "$@" cd /usr/bin export
+	grep | done printf ${HOME} $(pwd) sed --verbose "$1" /usr/bin
+		'quoted text' done x=1 done 'quoted text' test echo --verbose
+		-eu --verbose x=1 grep | "$@" -eu $(pwd)
+--verbose sed local | | test
+echo 'quoted text' readonly | local sed grep 'quoted text' done export && 'quoted text'
+-eu | --verbose /usr/bin x=1 done sed | /usr/bin ${HOME} | then done
+	awk "$1" local sed x=1 'quoted text' 'quoted text'
+&& | -eu test test "$@" readonly echo | then 2>/dev/null
+		x=1 test sed grep --verbose | export 'quoted text'
+awk then done x=1 ${HOME}
+	2>/dev/null then cd then x=1 x=1 | readonly cd cd sed export sed "$1" readonly readonly
+done "$1" sed && cd echo -eu && "$@" --verbose
+	${HOME} printf ${HOME} sed && printf /usr/bin test export readonly
+		$(pwd) grep /usr/bin ${HOME} ${HOME}
+local cd cd | cd x=1 grep 'quoted text' $(pwd) --verbose grep
+$(pwd) sed -eu done --verbose | 2>/dev/null --verbose
+	| "$@" && then /usr/bin
+		local | ${HOME} cd /usr/bin 'quoted text'
+	then cd printf export 2>/dev/null
+	/usr/bin readonly grep
+		export | x=1 ${HOME} | cd done export /usr/bin local printf local "$1"
+	--verbose 2>/dev/null /usr/bin --verbose
+&& 2>/dev/null then --verbose 'quoted text' ${HOME} --verbose
+		done grep "$@" ${HOME} 2>/dev/null awk x=1
+		done test printf cd x=1 /usr/bin awk 'quoted text' -eu echo ${HOME} ${HOME}
+	2>/dev/null cd --verbose readonly $(pwd) printf printf grep && cd ${HOME}
+		"$@" --verbose printf x=1 --verbose grep
+	readonly test "$1" | echo /usr/bin $(pwd) then && then | sed -eu $(pwd)
+		test ${HOME} ${HOME} "$1" /usr/bin /usr/bin "$1" local -eu grep $(pwd)
+		grep sed --verbose 'quoted text' "$@" "$@" "$1"
+2>/dev/null /usr/bin sed x=1 echo 'quoted text' test readonly /usr/bin --verbose
+printf test 2>/dev/null /usr/bin "$@" "$@" /usr/bin test 'quoted text' done cd x=1
+"$@" 2>/dev/null awk 'quoted text'
+		export $(pwd) -eu --verbose /usr/bin
+		then 2>/dev/null $(pwd)
+		${HOME} grep then grep printf
+	cd echo printf | printf printf 'quoted text' /usr/bin
+		${HOME} && readonly readonly then x=1 2>/dev/null grep ${HOME} grep local sed
+awk printf printf "$@" /usr/bin printf
+		printf readonly grep "$@" && && local readonly |
+	2>/dev/null /usr/bin grep 'quoted text' awk ${HOME} export 'quoted text'
+		echo readonly -eu "$@" | && export /usr/bin
+		/usr/bin && readonly done 2>/dev/null
+	export x=1 printf -eu test grep "$1" done ${HOME}
+grep echo cd /usr/bin 2>/dev/null export grep printf awk sed -eu then printf -eu
+	printf test readonly /usr/bin cd then -eu local local -eu /usr/bin export
+		${HOME} cd 'quoted text' /usr/bin done -eu local "$1" /usr/bin --verbose
+	| -eu ${HOME} $(pwd) /usr/bin echo 'quoted text'
+		${HOME} sed export --verbose "$1" readonly
+		2>/dev/null "$@" readonly --verbose "$1" --verbose printf --verbose
+	--verbose ${HOME} --verbose ${HOME}
+		"$1" -eu done ${HOME}
+		export --verbose | --verbose -eu -eu sed printf echo /usr/bin local printf -eu
+	'quoted text' done done "$1" cd
+		echo sed x=1 "$@" | done -eu | local -eu x=1 'quoted text' export export && 'quoted text'
+	grep "$1" sed x=1 | echo grep | export --verbose 'quoted text' | awk
+		test grep $(pwd) ${HOME} printf 2>/dev/null x=1 /usr/bin readonly --verbose sed
+		then awk -eu sed x=1 | done 'quoted text' $(pwd) | awk /usr/bin 2>/dev/null | -eu
+		x=1 "$@" local sed 2>/dev/null
+grep then test printf
+		export ${HOME} done | /usr/bin x=1 -eu export sed /usr/bin "$1" --verbose
+	-eu export echo then then 'quoted text' 2>/dev/null sed "$1" printf awk
+	awk then readonly -eu readonly export test cd printf 'quoted text'
+'quoted text' readonly "$1" export --verbose echo | x=1 echo echo --verbose
+local /usr/bin ${HOME} cd printf test --verbose
+$(pwd) sed && sed readonly | 2>/dev/null
+		export "$1" -eu awk readonly then --verbose grep grep /usr/bin
+readonly readonly export test cd "$1" | x=1 "$@" ${HOME}
+	printf sed awk && --verbose
+	"$@" "$@" "$1" printf echo readonly
+	-eu 'quoted text' "$1"
+		export printf echo 2>/dev/null
+2>/dev/null export "$1" 2>/dev/null x=1 &&
+	test 'quoted text' ${HOME} export /usr/bin sed grep
+		2>/dev/null then printf done local
+		'quoted text' 2>/dev/null sed ${HOME} printf printf
+echo --verbose /usr/bin 2>/dev/null x=1 export "$@"
+		--verbose cd done 'quoted text' printf readonly printf
+	export $(pwd) 2>/dev/null awk "$@" /usr/bin
+		-eu printf cd ${HOME} --verbose grep x=1
+		/usr/bin grep ${HOME} -eu /usr/bin printf x=1 cd
+	$(pwd) x=1 x=1 'quoted text' | -eu x=1 local then printf awk /usr/bin
+	test local awk 'quoted text' local test | test $(pwd) && sed --verbose
+		done awk -eu local 2>/dev/null 2>/dev/null printf sed /usr/bin
+--verbose "$@" done then --verbose export local ${HOME} grep readonly
+	printf "$@" 2>/dev/null
+		printf then && /usr/bin "$1" && then --verbose cd
+test --verbose -eu awk printf cd 2>/dev/null $(pwd) echo
+		/usr/bin cd then then test test "$1" $(pwd) "$@"
+	/usr/bin ${HOME} cd sed awk x=1
+		printf test readonly test cd "$1" then sed /usr/bin sed $(pwd) && /usr/bin
+	"$1" $(pwd) 'quoted text'
+	--verbose /usr/bin echo awk | printf | printf "$1" test --verbose | printf
+		'quoted text' /usr/bin echo awk -eu sed "$1" /usr/bin
+	/usr/bin -eu 'quoted text' cd sed printf "$@" $(pwd) echo 2>/dev/null
+grep readonly printf 'quoted text' local 2>/dev/null --verbose /usr/bin
+/usr/bin test local && awk 'quoted text' -eu 2>/dev/null echo $(pwd) /usr/bin
+		-eu echo then && 2>/dev/null "$@" local -eu then x=1 sed -eu local
+		&& done 'quoted text' grep printf $(pwd) x=1 local --verbose
+x=1 export "$@" && --verbose cd readonly "$1" grep ${HOME} grep done
+		/usr/bin then | && cd "$1" ${HOME} local done echo 'quoted text' echo then "$@"
+		"$@" 2>/dev/null readonly printf then ${HOME} awk export -eu 2>/dev/null
+	done --verbose echo test then local done --verbose
+		-eu sed "$1" x=1 readonly /usr/bin cd
+awk export printf local echo "$@" 2>/dev/null test export
+	echo x=1 echo /usr/bin /usr/bin
+	"$1" /usr/bin x=1 -eu -eu
+'quoted text' sed echo 2>/dev/null "$1" "$@"
+	readonly echo -eu test grep awk -eu done local test | grep readonly
+	test && test done cd /usr/bin
+then && sed --verbose "$1" printf ${HOME}
+		readonly 2>/dev/null && -eu --verbose
+printf $(pwd) ${HOME} 2>/dev/null ${HOME} | local done "$1"
+| /usr/bin && echo test sed 'quoted text'
+		| then --verbose "$1" x=1 awk awk 'quoted text' $(pwd) /usr/bin done sed local
+		readonly grep sed && /usr/bin "$1" /usr/bin && test -eu 2>/dev/null
+		2>/dev/null "$@" export printf
+&& then done --verbose test && readonly x=1 ${HOME}
+	sed $(pwd) $(pwd) x=1 "$@" test
+	echo then "$1" "$1" grep echo "$1" 2>/dev/null done export sed then
+echo $(pwd) 2>/dev/null --verbose | awk echo readonly printf
+-eu --verbose readonly echo sed export x=1 "$@"
+		$(pwd) "$@" "$1" local | cd awk done echo /usr/bin && &&
+		'quoted text' local 2>/dev/null "$@" grep echo grep
+		| test ${HOME} | readonly && 2>/dev/null
+		readonly readonly $(pwd) export &&
+	/usr/bin test sed | --verbose cd "$1" then && $(pwd) awk --verbose
+	$(pwd) | export cd 2>/dev/null
+	--verbose then /usr/bin "$1" && sed --verbose
+		x=1 -eu 2>/dev/null export readonly "$1" -eu then -eu &&
+		| 2>/dev/null local then cd readonly sed grep local && cd -eu readonly
+		-eu echo x=1 test done && && 'quoted text' export
+awk grep done awk "$1" awk export 2>/dev/null grep x=1 ${HOME} 'quoted text'
+		--verbose x=1 then /usr/bin export 'quoted text' sed awk grep then
+"$@" awk 'quoted text' grep readonly
+	printf "$@" | /usr/bin ${HOME} ${HOME} sed then $(pwd)
+	/usr/bin "$1" test readonly grep 'quoted text' export then 'quoted text' grep
+		echo && -eu then ${HOME} local
+		/usr/bin x=1 x=1 then grep
+	--verbose grep local local test --verbose $(pwd) readonly
+test local /usr/bin then 2>/dev/null grep ${HOME} printf --verbose
+	"$1" 2>/dev/null | 2>/dev/null
+local /usr/bin 'quoted text'
+		grep cd echo awk done done echo awk && /usr/bin 'quoted text' echo
+awk $(pwd) grep 'quoted text' | ${HOME} awk grep ${HOME} printf cd
+'quoted text' awk --verbose readonly "$1" $(pwd) test awk cd readonly
+done "$@" sed grep sed "$1"
+		--verbose x=1 export $(pwd) printf echo -eu -eu readonly "$@" && && echo done
+	$(pwd) done $(pwd) "$1"
+		"$@" "$@" then 'quoted text' awk 2>/dev/null /usr/bin sed local then echo
+local 'quoted text' | /usr/bin "$@" readonly 2>/dev/null test 'quoted text' ${HOME}
+		readonly export && -eu 'quoted text' local && test export
+"$@" local --verbose && printf cd
+		readonly $(pwd) --verbose grep local /usr/bin cd x=1 printf sed | -eu readonly
+$(pwd) /usr/bin grep ${HOME} && awk | 'quoted text'
+	grep $(pwd) grep "$1" ${HOME} -eu && sed then $(pwd) "$@" "$1" echo
+		echo "$@" local then 'quoted text'
+	echo echo local echo test export echo
+		test && --verbose $(pwd) $(pwd) then awk /usr/bin done x=1 $(pwd) readonly
+	local test awk $(pwd) echo sed printf export && && |
+		2>/dev/null "$@" /usr/bin | done awk --verbose test -eu printf done
+"$1" local ${HOME} local
+		printf --verbose | echo
+	done export | -eu "$@" awk && awk sed x=1
+	/usr/bin cd /usr/bin "$@" x=1 -eu cd && && then "$1" grep
+		then test test -eu "$@" cd printf then done sed done printf "$@"
+	readonly /usr/bin 'quoted text' then export readonly 'quoted text'
+| export && echo cd $(pwd) local /usr/bin "$1"
+	-eu export ${HOME} grep sed grep test
+	| /usr/bin printf | x=1 /usr/bin /usr/bin then
+	/usr/bin x=1 "$1" local ${HOME} sed printf -eu then readonly cd $(pwd)
+		${HOME} "$@" echo 2>/dev/null done readonly /usr/bin test readonly cd
+	"$1" cd local 2>/dev/null sed done && grep x=1
+	/usr/bin x=1 export then 2>/dev/null --verbose
+cd "$@" printf export sed local x=1 export test "$1" export ${HOME} local echo
+	test cd $(pwd) -eu test readonly done /usr/bin sed "$1" readonly 2>/dev/null
+${HOME} test "$@" done "$@" done ${HOME} then 2>/dev/null awk
+	sed test sed ${HOME} "$1" --verbose cd cd /usr/bin echo
+	then then "$1" echo | local printf export done "$1" sed && $(pwd) printf
+		then 2>/dev/null printf then done /usr/bin $(pwd)
+readonly | test printf -eu "$1"
+		cd export -eu echo test readonly sed 'quoted text' ${HOME} then export
+	done done test 'quoted text' "$@" echo /usr/bin printf export
+		-eu "$1" echo 'quoted text' /usr/bin "$@" export echo | local "$@" --verbose
+readonly cd then awk test awk then grep
+		&& $(pwd) $(pwd) --verbose sed "$1"
+	x=1 export /usr/bin && "$1" export
+	"$@" grep sed $(pwd) "$@" grep 2>/dev/null 'quoted text'
+done grep local then grep x=1 then
+		x=1 /usr/bin local 2>/dev/null -eu export readonly
+		${HOME} echo local "$@" cd && --verbose |
+	printf test test grep grep
+		sed "$@" 2>/dev/null --verbose && done
+		done awk cd "$1" sed sed sed cd -eu done printf sed 2>/dev/null
+	grep -eu | done ${HOME} x=1 export
+$(pwd) sed then x=1 echo -eu | printf printf /usr/bin test echo
+	printf ${HOME} /usr/bin /usr/bin test | sed -eu "$@" 2>/dev/null
+		-eu export $(pwd) printf sed "$1" && test $(pwd)
+		'quoted text' -eu "$1" $(pwd) echo done "$1" 'quoted text' awk 'quoted text'
+		test then awk export then --verbose /usr/bin test 'quoted text'
+		cd /usr/bin ${HOME} "$1" 2>/dev/null
+		awk sed && x=1 awk test 'quoted text' local | && cd | cd echo printf &&
+	readonly $(pwd) cd sed echo /usr/bin x=1 sed
+done "$1" awk grep sed readonly && "$1" /usr/bin
+local test grep awk cd --verbose echo test export 'quoted text' 2>/dev/null "$1"
+	--verbose ${HOME} "$1" awk --verbose -eu $(pwd) ${HOME}
+	readonly grep "$@" "$1" ${HOME}
+	'quoted text' && 'quoted text' 'quoted text' 2>/dev/null "$@" printf
+		'quoted text' then done echo
+	$(pwd) --verbose done then sed grep cd local echo /usr/bin
+cd printf done ${HOME} export 2>/dev/null echo
+--verbose 'quoted text' /usr/bin && "$@" /usr/bin grep -eu /usr/bin ${HOME} cd $(pwd)
+	local sed printf "$@" readonly 'quoted text' then "$1" 2>/dev/null && ${HOME} 'quoted text'
+		| test sed sed | 'quoted text' 'quoted text' printf "$1" -eu && then "$1"
+	$(pwd) 'quoted text' "$@" 'quoted text' && then
+$(pwd) --verbose /usr/bin cd grep x=1
+		$(pwd) done && sed awk |
+		--verbose local readonly "$@" done 'quoted text'
+	--verbose cd readonly local
+	sed then 2>/dev/null echo x=1 grep printf | && /usr/bin done
+		$(pwd) test "$@" 2>/dev/null sed $(pwd) then then $(pwd) local
+awk then 2>/dev/null | echo x=1 "$@" 'quoted text' ${HOME}
+	'quoted text' x=1 | awk grep echo "$1" 'quoted text' awk
+"$@" --verbose "$1" awk && echo done grep 2>/dev/null /usr/bin
+		done x=1 echo "$1" printf echo
+		cd $(pwd) && | awk | local local grep grep grep readonly cd readonly awk -eu
+then export export cd cd /usr/bin
+	x=1 local done && | | /usr/bin ${HOME} "$@"
+	export test && 'quoted text' done done &&
+		readonly sed && test printf
+-eu printf --verbose "$@" grep printf grep export then done --verbose --verbose
+		/usr/bin then /usr/bin "$1" grep awk then cd done echo done
+	&& awk then --verbose
+sed "$1" test /usr/bin
+echo | export done local && "$1" --verbose printf echo /usr/bin
+test /usr/bin x=1 /usr/bin export export
+		then | | && local --verbose "$1" | /usr/bin x=1 --verbose awk then
+	cd --verbose "$1" grep -eu $(pwd) 2>/dev/null
+		cd /usr/bin | readonly --verbose printf
+		local then sed 2>/dev/null then
+	echo $(pwd) $(pwd) printf $(pwd) 2>/dev/null
+	"$1" awk cd x=1 -eu sed readonly then $(pwd) local /usr/bin
+"$@" export $(pwd) printf printf --verbose "$1" test | test /usr/bin 2>/dev/null
+	&& done local export done 'quoted text' "$@"
+| printf echo && then sed then test then local --verbose local
+		/usr/bin export then export grep printf && /usr/bin
+		readonly local readonly "$@" export
+		export && $(pwd) awk 'quoted text'
+local local grep $(pwd) $(pwd) -eu "$1" cd awk readonly
+x=1 -eu cd readonly sed --verbose /usr/bin
+		x=1 echo sed test /usr/bin echo grep --verbose
+	'quoted text' echo sed done "$@" readonly "$1" && /usr/bin
+		$(pwd) echo test $(pwd) $(pwd) | 'quoted text'
+${HOME} "$@" awk grep && then then
+awk && echo then then readonly
+		-eu 2>/dev/null done export cd readonly
+	printf -eu -eu $(pwd) echo -eu 'quoted text' awk /usr/bin export 'quoted text'
+		&& -eu readonly -eu x=1 | "$@" x=1
+		sed 2>/dev/null done local -eu readonly readonly
+	-eu /usr/bin ${HOME} local
+		echo 'quoted text' | cd awk x=1 x=1 readonly
+| /usr/bin grep "$1" grep
+| done /usr/bin echo grep $(pwd) grep -eu grep cd -eu awk then /usr/bin grep echo
+		/usr/bin x=1 "$1" -eu readonly
+awk grep | $(pwd) awk export 2>/dev/null sed |
+test "$1" cd echo 2>/dev/null 2>/dev/null
+"$1" -eu sed printf 2>/dev/null test 'quoted text'
+	readonly -eu cd "$1" "$@" test local
+$(pwd) | 2>/dev/null /usr/bin sed echo echo grep /usr/bin test "$1" "$1" -eu
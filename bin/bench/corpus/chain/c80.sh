@@ -0,0 +1,2001 @@
+	${HOME} test awk echo cd test $(pwd) "$1" export
+		--verbose test ${HOME} sed && printf awk 2>/dev/null
+readonly --verbose done test cd printf x=1 export && grep awk
+		${HOME} readonly cd echo done && --verbose
+		local ${HOME} "$1" awk export x=1 x=1 export printf
+	export "$@" then cd 'quoted text' grep -eu 2>/dev/null grep cd "$@" -eu then | local
+	cd -eu readonly grep printf
+cd export 2>/dev/null printf then awk ${HOME} test echo then $(pwd) local $(pwd)
+	test 2>/dev/null done printf grep 'quoted text' "$@" --verbose
+		local ${HOME} cd "$@" local $(pwd) | local
+		-eu local sed done grep
+		then x=1 | grep readonly test 'quoted text' printf -eu printf
+		"$1" 'quoted text' readonly done local "$@" /usr/bin
+	sed "$@" then | /usr/bin readonly
+		echo then "$1" awk local -eu awk done "$1" | awk awk --verbose | echo printf
+grep awk -eu grep && && test then 2>/dev/null $(pwd) sed export
+x=1 "$@" 2>/dev/null local local echo -eu 'quoted text' export export
+		echo grep export test --verbose 2>/dev/null
+		&& export "$1" grep awk awk /usr/bin done 2>/dev/null
+readonly /usr/bin echo -eu then /usr/bin "$@" | cd local ${HOME} test
+	printf "$@" $(pwd) export echo echo printf "$1" test && echo 2>/dev/null
+--verbose --verbose x=1 awk 2>/dev/null sed $(pwd)
+	echo | local export cd "$1" sed 2>/dev/null && && printf done --verbose
+	cd ${HOME} 2>/dev/null sed printf "$1" 'quoted text'
+		2>/dev/null grep sed sed ${HOME} "$1" $(pwd)
+'quoted text' sed test "$@" x=1 grep sed cd local x=1
+	echo 'quoted text' ${HOME} cd $(pwd) awk sed | $(pwd)
+	-eu 'quoted text' grep readonly "$@" && 'quoted text'
+2>/dev/null readonly awk readonly 'quoted text' export -eu
+	done "$@" --verbose done export cd "$1" readonly --verbose
+-eu "$@" 'quoted text' --verbose ${HOME} 'quoted text'
+	test 2>/dev/null -eu awk --verbose sed "$@" local cd /usr/bin 2>/dev/null test
+		sed test done done echo ${HOME} 2>/dev/null ${HOME} "$@" local grep awk
+	done && "$1" | then sed readonly then 2>/dev/null x=1 done --verbose awk
+		--verbose done | && "$1" export then 2>/dev/null
+		awk printf x=1 cd /usr/bin sed "$@" export
+		2>/dev/null awk "$1" export echo echo &&
+then local x=1 /usr/bin x=1 done -eu then "$@"
+awk sed done local /usr/bin 2>/dev/null
+	sed "$@" 2>/dev/null $(pwd) grep printf -eu "$1" sed 'quoted text' grep sed |
+	$(pwd) sed test 'quoted text' printf
+		grep test then sed local | sed cd test /usr/bin
+$(pwd) x=1 export "$@" 'quoted text' x=1 export sed | export printf
+	echo --verbose x=1 cd grep x=1 | sed "$1" ${HOME} --verbose
+	2>/dev/null $(pwd) 2>/dev/null cd "$1" "$@" -eu grep awk
+	'quoted text' "$@" sed then /usr/bin
+	x=1 then grep grep 2>/dev/null && readonly export
+-eu && local x=1 local && local -eu 'quoted text' x=1 | /usr/bin -eu test
+	-eu ${HOME} printf | "$@" printf && awk echo echo "$1"
+		/usr/bin $(pwd) cd | | /usr/bin
+	done then "$@" ${HOME} "$@" cd cd x=1 $(pwd) 2>/dev/null /usr/bin test printf
+"$1" 'quoted text' grep then echo 'quoted text'
+		${HOME} /usr/bin local ${HOME} x=1 x=1 grep local 2>/dev/null
+	${HOME} && readonly export test
+		/usr/bin /usr/bin printf echo $(pwd) | /usr/bin x=1 "$@" "$@" && x=1 "$1" ${HOME}
+		-eu && printf readonly 'quoted text' 2>/dev/null local "$@" sed 'quoted text'
+	local /usr/bin awk test awk test sed "$1" "$@" printf cd export test 2>/dev/null
+	2>/dev/null local export -eu then x=1 ${HOME} cd 2>/dev/null -eu && x=1 cd grep
+grep && export x=1 /usr/bin && echo readonly awk "$@"
+		echo cd cd echo cd sed awk --verbose awk | awk cd 2>/dev/null $(pwd)
+	done -eu local awk done local 'quoted text' ${HOME} cd && local 'quoted text' 2>/dev/null
+		| /usr/bin /usr/bin printf done 2>/dev/null | then "$@" test | 'quoted text'
+	grep "$1" && echo -eu then echo | printf test 'quoted text'
+	x=1 "$1" "$@" sed printf
+		'quoted text' sed /usr/bin 2>/dev/null
+	test export && printf | echo
+"$1" "$@" cd readonly then $(pwd) grep readonly awk ${HOME} x=1 --verbose
+${HOME} echo $(pwd) --verbose 2>/dev/null ${HOME} sed awk
+		grep echo "$@" "$1" test done 2>/dev/null
+x=1 $(pwd) test export ${HOME}
+		sed 2>/dev/null then 'quoted text' 'quoted text'
+	export export 2>/dev/null ${HOME} --verbose | ${HOME} awk $(pwd)
+		x=1 -eu 2>/dev/null grep export then 2>/dev/null readonly printf then "$1" "$@"
+	x=1 grep grep local grep export local --verbose then done done --verbose
+"$@" readonly cd --verbose readonly
+	cd cd local -eu grep | 'quoted text' readonly
+&& | done x=1 ${HOME} 2>/dev/null "$@" "$@" export
+		"$1" | 2>/dev/null printf /usr/bin printf echo | "$@" printf && test readonly
+cd /usr/bin then "$1" && -eu ${HOME} cd 2>/dev/null cd $(pwd) "$1" -eu
+test echo sed export sed "$@" && 2>/dev/null $(pwd) export printf "$1" readonly
+-eu printf ${HOME} "$@" export --verbose
+	test local | readonly echo && /usr/bin -eu -eu | "$1" /usr/bin export awk --verbose
+$(pwd) 2>/dev/null echo -eu cd then cd -eu
+"$1" "$@" readonly export 'quoted text'
+		| then -eu 2>/dev/null test --verbose --verbose 'quoted text' done grep local
+		&& | 2>/dev/null 2>/dev/null done "$@" $(pwd) sed test --verbose --verbose
+		cd sed test /usr/bin export -eu 2>/dev/null
+	| | printf && && cd --verbose -eu sed |
+	export readonly x=1 cd -eu cd
+		done local && cd /usr/bin local local "$1" "$@" -eu 'quoted text'
+	"$@" x=1 -eu -eu --verbose 'quoted text'
+--verbose done ${HOME}
+	awk /usr/bin "$1" grep | ${HOME} $(pwd) /usr/bin awk local
+	printf "$@" -eu done
+	sed && x=1 "$@" x=1 readonly ${HOME} then cd /usr/bin
+		done -eu then /usr/bin local $(pwd) x=1 then
+		printf then --verbose && local | cd awk echo ${HOME} && -eu x=1
+		/usr/bin export sed done sed /usr/bin export sed test &&
+	export export grep $(pwd) --verbose
+	printf grep test sed export && readonly awk awk x=1 sed 2>/dev/null
+		readonly sed /usr/bin then cd sed export done grep --verbose && export
+	--verbose ${HOME} export readonly && export export local | test 'quoted text'
+	"$1" $(pwd) done sed | readonly cd grep "$1"
+	${HOME} /usr/bin then /usr/bin then ${HOME}
+	awk | "$1" sed awk -eu && "$1" "$@" then echo -eu then cd readonly "$@" local
+		readonly $(pwd) sed /usr/bin /usr/bin cd 'quoted text'
+printf printf x=1 export sed done printf | x=1
+/usr/bin "$1" then echo awk cd "$@" && $(pwd) | -eu | printf 2>/dev/null
+		-eu /usr/bin "$@" sed readonly readonly ${HOME}
+		${HOME} "$@" --verbose | grep "$1" "$@" 'quoted text'
+${HOME} test test && "$@" cd | && awk sed /usr/bin cd /usr/bin -eu x=1 --verbose
+| && local -eu grep x=1 "$@" readonly
+		echo local -eu cd cd ${HOME} -eu && "$1" "$@" --verbose
+		2>/dev/null x=1 'quoted text' then test "$@" "$1" local awk grep
+&& && --verbose $(pwd) local "$1" echo sed then readonly local -eu "$1" /usr/bin
+		"$1" x=1 ${HOME} --verbose "$@" then local cd
+	$(pwd) $(pwd) "$@" && -eu export | ${HOME} $(pwd) $(pwd) 2>/dev/null export
+		&& done ${HOME} 2>/dev/null then done ${HOME}
+grep && 2>/dev/null x=1 /usr/bin 2>/dev/null 2>/dev/null x=1 printf printf ${HOME}
+"$1" echo "$1" && --verbose done grep done ${HOME} then then readonly
+	/usr/bin readonly "$1" x=1 | printf test /usr/bin | "$1" sed &&
+	$(pwd) local 2>/dev/null then local -eu "$1" then
+sed cd local done test --verbose
+		'quoted text' readonly -eu awk grep sed awk sed sed ${HOME} readonly echo echo
+		awk grep done && "$@" cd | /usr/bin local $(pwd) grep
+		echo export local grep cd 'quoted text' "$@" printf "$1" 2>/dev/null
+		$(pwd) x=1 test $(pwd) ${HOME} -eu grep export "$1"
+	&& export x=1 awk | done local | cd --verbose $(pwd) cd $(pwd) 2>/dev/null
+		printf cd grep "$1" grep /usr/bin /usr/bin "$1"
+| "$1" export && x=1 'quoted text' $(pwd) printf readonly
+	x=1 2>/dev/null cd sed | local done cd /usr/bin echo grep &&
+	'quoted text' "$@" $(pwd) printf echo sed readonly "$1" -eu 2>/dev/null
+	x=1 /usr/bin "$@" && echo
+--verbose $(pwd) printf ${HOME}
+	| 2>/dev/null x=1 $(pwd)
+${HOME} echo 'quoted text' test
+then sed grep /usr/bin
+		sed x=1 cd cd -eu done "$1" sed
+		local && -eu "$@" /usr/bin && done awk x=1 ${HOME} --verbose
+| awk x=1 awk done test 2>/dev/null test grep /usr/bin /usr/bin
+	--verbose local readonly cd cd grep
+	local cd 2>/dev/null done ${HOME} done x=1 --verbose
+		| /usr/bin "$1" -eu /usr/bin grep awk export printf | x=1
+		readonly --verbose grep done grep --verbose local
+	2>/dev/null echo test "$@" $(pwd) 'quoted text' $(pwd) 2>/dev/null ${HOME} --verbose
+readonly readonly x=1 "$1"
+		--verbose done "$@" 'quoted text' awk echo local sed sed local awk then local readonly
+	"$1" 'quoted text' printf echo export echo "$@" done echo -eu cd echo x=1 done
+awk "$@" | awk 'quoted text' "$@" --verbose "$1" x=1 ${HOME} echo 'quoted text'
+	printf "$@" | local test printf && then test 'quoted text' echo echo cd
+		'quoted text' 'quoted text' sed && sed echo
+		$(pwd) export export 'quoted text'
+		local echo "$@" | /usr/bin x=1 -eu -eu done
+		then 'quoted text' local echo --verbose printf echo sed --verbose
+printf done 'quoted text' awk done
+	local "$@" printf "$@" echo awk && awk test "$@" local grep done $(pwd)
+2>/dev/null grep echo done &&
+&& x=1 grep /usr/bin then ${HOME} readonly echo test ${HOME}
+grep awk grep done echo 'quoted text'
+	/usr/bin "$@" local awk ${HOME} done && "$@" awk 'quoted text'
+	| x=1 echo --verbose "$1"
+printf export $(pwd) -eu x=1 done then ${HOME}
+awk x=1 'quoted text' then
+/usr/bin && && /usr/bin printf readonly 'quoted text' x=1 local ${HOME}
+readonly sed cd x=1 ${HOME} -eu 2>/dev/null local "$1" cd $(pwd)
+		printf ${HOME} 2>/dev/null
+		$(pwd) -eu | "$@" local | "$@"
+	| && printf "$@" export ${HOME} 'quoted text' grep test export awk
+		export cd 2>/dev/null /usr/bin done readonly --verbose ${HOME}
+	done grep echo ${HOME} local ${HOME}
+local x=1 | awk local && printf export sed --verbose
+		2>/dev/null then "$@" echo awk local && "$1" ${HOME} echo grep test
+	&& echo cd test readonly printf 2>/dev/null -eu
+local grep local | then
+		'quoted text' && cd local readonly --verbose export then --verbose --verbose
+		2>/dev/null /usr/bin 'quoted text'
+		sed /usr/bin "$@" local export x=1 | -eu /usr/bin echo then
+	/usr/bin "$1" cd -eu done
+	done "$1" "$1" export echo cd done /usr/bin -eu printf | 2>/dev/null
+		'quoted text' "$@" $(pwd) $(pwd) && sed printf
+	'quoted text' 'quoted text' awk
+		| sed awk 2>/dev/null echo readonly $(pwd) -eu $(pwd) "$1"
+		test /usr/bin 2>/dev/null test cd 2>/dev/null export printf "$@" readonly cd
+	$(pwd) "$@" "$@" echo then $(pwd)
+	done $(pwd) printf ${HOME}
+'quoted text' test local local ${HOME} "$@" local -eu then local sed
+	-eu "$@" --verbose "$@" "$1" then 2>/dev/null done then /usr/bin sed readonly "$1"
+		'quoted text' | cd && ${HOME} test "$1" done "$1" cd printf awk
+		2>/dev/null 'quoted text' "$1" /usr/bin awk && "$@" done "$@" "$1"
+--verbose export done 'quoted text' --verbose && awk sed local readonly
+	readonly printf $(pwd) echo test ${HOME} x=1 done ${HOME} echo &&
+	&& test export awk "$1" readonly
+/usr/bin ${HOME} printf 'quoted text'
+		-eu then && 'quoted text' sed cd 2>/dev/null
+	test printf ${HOME} done /usr/bin done && -eu sed ${HOME}
+local then readonly -eu ${HOME} readonly $(pwd) 2>/dev/null then
+	sed export && 2>/dev/null done sed
+		/usr/bin then | 2>/dev/null -eu | /usr/bin cd /usr/bin | "$1" awk 2>/dev/null
+--verbose "$1" grep then | sed x=1 readonly
+		2>/dev/null done --verbose grep awk export awk --verbose
+		-eu cd -eu printf "$@" echo &&
+		$(pwd) 'quoted text' grep 2>/dev/null --verbose "$@"
+	local 2>/dev/null /usr/bin && cd export --verbose grep /usr/bin && 'quoted text'
+	awk echo "$1" | -eu /usr/bin
+	"$1" /usr/bin | "$@" readonly
+	printf echo 2>/dev/null $(pwd) printf x=1 /usr/bin ${HOME}
+		awk x=1 /usr/bin export sed "$1" ${HOME} 'quoted text' ${HOME} local
+done local $(pwd) then -eu printf "$@" export test
+	cd $(pwd) local local && echo && test then "$@" 'quoted text'
+	then echo printf ${HOME} "$1" --verbose awk && printf --verbose
+"$1" readonly cd awk 'quoted text' readonly $(pwd) --verbose
+sed then echo 'quoted text' ${HOME}
+		"$1" -eu done then && ${HOME}
+--verbose "$@" /usr/bin -eu printf $(pwd)
+		"$@" && "$@" ${HOME} readonly ${HOME} && /usr/bin | x=1 /usr/bin
+	export printf readonly | then "$1" "$1" then
+cd cd 'quoted text' sed |
+	done ${HOME} local $(pwd) awk $(pwd) grep x=1 && then 2>/dev/null
+"$@" && 2>/dev/null $(pwd) --verbose x=1 && | export | && $(pwd) export
+		/usr/bin then && --verbose "$@" cd 'quoted text' test then "$@"
+	$(pwd) "$1" -eu "$1" &&
+		local test /usr/bin printf x=1 ${HOME} 2>/dev/null sed
+then export | export | x=1 "$1" $(pwd) /usr/bin x=1 'quoted text'
+	&& 2>/dev/null -eu ${HOME} | local sed --verbose
+--verbose 'quoted text' && | 'quoted text' sed grep ${HOME} 'quoted text'
+awk 2>/dev/null --verbose export "$1" echo && "$@" printf
+x=1 'quoted text' done 2>/dev/null cd x=1 "$@"
+'quoted text' export cd grep awk echo test x=1 && then
+	readonly /usr/bin test echo awk 'quoted text'
+	/usr/bin export cd echo printf echo
+echo x=1 | ${HOME} export printf readonly then "$@" cd x=1 -eu grep "$@"
+		awk local grep echo local readonly echo printf test sed then
+grep 2>/dev/null /usr/bin then
+		sed export readonly echo $(pwd) $(pwd) x=1 local x=1 done local /usr/bin 'quoted text'
+	then $(pwd) -eu -eu printf --verbose echo ${HOME} "$1" /usr/bin x=1 printf /usr/bin
+		$(pwd) 'quoted text' export | ${HOME} awk printf cd grep local 2>/dev/null |
+done $(pwd) --verbose readonly && --verbose /usr/bin
+		$(pwd) cd "$1" --verbose export local then grep
+readonly then | "$@" grep sed test -eu 'quoted text' export
+"$1" -eu test echo printf sed --verbose printf --verbose --verbose --verbose
+grep done | $(pwd) $(pwd) echo cd && cd sed /usr/bin --verbose
+/usr/bin echo cd cd grep cd "$1" printf x=1 then --verbose cd then readonly
+		readonly | ${HOME} awk cd ${HOME} sed /usr/bin | 'quoted text' /usr/bin
+	/usr/bin cd 2>/dev/null /usr/bin awk printf test -eu ${HOME} export
+		x=1 cd export /usr/bin done cd done "$@" printf awk "$1" printf && local
+		then /usr/bin /usr/bin "$@" --verbose
+		cd /usr/bin echo grep && | done $(pwd) 2>/dev/null export "$1"
+x=1 /usr/bin grep ${HOME} local $(pwd) sed sed 'quoted text'
+export readonly 'quoted text' /usr/bin /usr/bin test -eu export
+awk | printf | | -eu && "$1" readonly /usr/bin
+--verbose -eu printf test /usr/bin test && $(pwd) grep cd | $(pwd) 'quoted text'
+-eu /usr/bin "$@" cd awk then readonly readonly /usr/bin cd -eu test | && readonly
+"$1" x=1 x=1 echo | echo /usr/bin done && export ${HOME} x=1
+	$(pwd) $(pwd) 'quoted text' "$@" $(pwd) x=1 cd export /usr/bin sed cd echo
+then printf cd "$1" awk printf done -eu then
+	test echo echo test awk printf $(pwd)
+done && then test grep "$1" "$1" /usr/bin
+	done printf local grep 2>/dev/null
+	| export readonly "$1" "$@"
+		cd sed x=1 printf awk then "$@" echo done printf echo grep done printf
+	readonly --verbose "$@" $(pwd) local $(pwd)
+cd $(pwd) grep "$@" $(pwd) awk -eu 2>/dev/null
+		grep ${HOME} ${HOME} sed export sed $(pwd) && grep awk -eu 'quoted text' $(pwd)
+	| && cd echo then done |
+	'quoted text' $(pwd) then /usr/bin
+	&& echo 2>/dev/null 'quoted text' awk --verbose 'quoted text' printf x=1
+		"$@" echo "$1" $(pwd) sed | && 'quoted text' "$1" local ${HOME}
+	| ${HOME} done local sed
+	echo local printf ${HOME} printf $(pwd) export export
+	"$@" grep printf grep echo test test local "$@" cd test
+/usr/bin readonly --verbose ${HOME}
+--verbose awk local 'quoted text'
+local && readonly ${HOME} done then ${HOME} cd local "$@" -eu
+	cd echo ${HOME} $(pwd) grep readonly grep "$@" "$@" done export && cd sed
+	"$1" printf | sed --verbose | ${HOME} local /usr/bin
+--verbose "$@" readonly -eu 2>/dev/null then export printf
+then --verbose cd awk then grep &&
+		then readonly cd /usr/bin awk && ${HOME}
+		${HOME} -eu test && --verbose cd done /usr/bin -eu x=1
+		export sed x=1 test "$@" grep test cd printf
+&& awk 'quoted text' 2>/dev/null x=1
+		&& local /usr/bin sed ${HOME}
+		echo export 'quoted text' --verbose 2>/dev/null grep ${HOME} 2>/dev/null
+	"$@" $(pwd) 2>/dev/null x=1 && 2>/dev/null
+	| test x=1 export 'quoted text' then cd then && -eu 2>/dev/null
+	grep x=1 ${HOME} && export ${HOME} then /usr/bin test /usr/bin "$@" sed
+cd sed $(pwd) "$@" "$@" | echo && echo then ${HOME} local
+'quoted text' ${HOME} "$1" local "$1" "$@" 2>/dev/null echo awk grep cd awk
+		x=1 "$1" -eu "$@" 2>/dev/null printf 'quoted text' | echo readonly
+then $(pwd) "$1" -eu ${HOME}
+		&& then 2>/dev/null grep --verbose sed ${HOME} && done $(pwd)
+cd 2>/dev/null sed "$@" $(pwd) export 2>/dev/null printf
+		$(pwd) 2>/dev/null $(pwd) printf -eu awk done /usr/bin 'quoted text'
+	test test then echo "$@" -eu "$1" "$1" echo local $(pwd) "$@" test
+then 'quoted text' export export "$@" awk
+		&& $(pwd) awk test then /usr/bin
+		x=1 export 'quoted text' echo readonly
+	test local && grep cd awk && -eu && local sed test
+	test /usr/bin "$@" /usr/bin
+	$(pwd) printf "$1" 'quoted text' test "$@" x=1 local
+sed $(pwd) local 2>/dev/null
+test export ${HOME} test
+	local "$@" 2>/dev/null grep 'quoted text'
+		awk x=1 sed ${HOME} local awk printf
+		test readonly done export printf "$@" echo cd "$1" 'quoted text' echo readonly
+sed sed export then export readonly printf x=1 ${HOME} test && echo echo
+	test test 'quoted text' && && test awk && 2>/dev/null echo "$@"
+		2>/dev/null ${HOME} 'quoted text' local echo "$1"
+	${HOME} grep 2>/dev/null "$@" "$1" then echo --verbose $(pwd) "$1" /usr/bin
+		-eu $(pwd) awk readonly awk local | ${HOME} then && sed sed 2>/dev/null
+		printf grep "$@" test export done 2>/dev/null sed printf
+	| echo echo local "$@" then
+	done awk echo done echo && grep && /usr/bin && -eu "$1"
+		&& grep ${HOME} export printf 'quoted text' "$@" grep cd && "$@" && echo
+'quoted text' sed x=1 2>/dev/null "$1" echo test local
+		readonly cd export export "$@"
+		then readonly then "$1" x=1 printf local "$@" done
+	test cd -eu $(pwd) cd local "$@" awk /usr/bin ${HOME}
+		&& "$@" sed then $(pwd) "$1" awk 2>/dev/null
+		export ${HOME} awk readonly local | done $(pwd) 'quoted text' 'quoted text'
+$(pwd) sed test done export 2>/dev/null
+		'quoted text' awk sed
+	&& done sed $(pwd) x=1 | sed "$1" /usr/bin sed sed "$1" done sed
+export readonly "$1" -eu local $(pwd) readonly printf "$1" done "$@" x=1 then
+	/usr/bin export $(pwd) | done awk readonly
+		echo then sed /usr/bin | | && x=1
+	"$1" --verbose sed --verbose local readonly grep export "$1" done
+	local x=1 printf printf cd | then
+	&& grep ${HOME} sed && 'quoted text'
+		grep -eu "$1" awk grep ${HOME} awk test /usr/bin
+		&& awk local done export then done /usr/bin
+	2>/dev/null -eu --verbose 2>/dev/null | local export awk done
+	then x=1 "$1" export cd "$@" --verbose
+		-eu && /usr/bin readonly ${HOME} printf "$@" readonly | cd test
+readonly done --verbose test 'quoted text'
+		awk 'quoted text' printf readonly && printf sed | 2>/dev/null
+echo awk ${HOME} && /usr/bin printf "$@" export "$1" export "$@" | then x=1
+-eu grep done then awk readonly && local
+	cd "$@" grep 'quoted text' printf | readonly readonly
+export grep && awk export export --verbose -eu --verbose "$@" printf
+		2>/dev/null readonly local $(pwd) local
+local readonly && x=1
+		test awk /usr/bin echo $(pwd)
+$(pwd) readonly printf /usr/bin | echo local
+		/usr/bin local export -eu awk then 'quoted text' && sed ${HOME} printf
+		${HOME} /usr/bin test cd printf sed readonly sed readonly printf readonly /usr/bin
+	cd printf echo ${HOME} "$@" "$1" -eu | x=1 grep $(pwd) && readonly
+	"$@" 2>/dev/null /usr/bin readonly done printf
+		cd --verbose local printf && --verbose local sed ${HOME} readonly 'quoted text'
+		| sed 2>/dev/null x=1 /usr/bin $(pwd)
+	export done echo "$1" "$1" then readonly -eu awk
+	printf awk --verbose ${HOME} | awk sed
+| awk 2>/dev/null then
+		| ${HOME} x=1 local x=1 && printf
+	printf "$@" awk test /usr/bin sed export x=1 test "$1" grep then
+cd done 2>/dev/null x=1 export && "$@" --verbose 'quoted text' $(pwd) "$@" test
+	${HOME} readonly then -eu --verbose local export --verbose then
+sed 'quoted text' 'quoted text'
+"$1" sed 'quoted text' $(pwd) $(pwd) "$1" /usr/bin $(pwd)
+printf echo 2>/dev/null $(pwd) awk x=1 grep 2>/dev/null
+	| && -eu printf echo $(pwd) ${HOME}
+		test local && --verbose printf sed x=1
+	"$@" sed $(pwd) local grep /usr/bin export then /usr/bin
+		sed $(pwd) local sed then
+	printf 'quoted text' local "$1" cd test readonly 2>/dev/null && local
+		${HOME} "$@" x=1 x=1 awk awk awk
+		local --verbose sed x=1 x=1 2>/dev/null /usr/bin test done then
+	-eu printf x=1 $(pwd) x=1 awk awk $(pwd) then ${HOME} printf test
+| "$1" printf x=1 printf
+	sed /usr/bin cd local ${HOME} "$1" printf test grep 'quoted text'
+		'quoted text' grep echo sed "$@" grep grep grep done awk $(pwd) awk sed
+	'quoted text' cd | ${HOME} 'quoted text' export
+cd && test -eu "$@" readonly echo
+${HOME} test grep ${HOME} $(pwd) "$1" done local cd /usr/bin then
+--verbose 'quoted text' cd local --verbose echo
+	'quoted text' export 2>/dev/null /usr/bin
+		2>/dev/null "$1" awk "$1" awk grep "$1" echo x=1 ${HOME} | readonly awk done
+	-eu 2>/dev/null --verbose x=1 "$@" sed export printf ${HOME} sed sed echo --verbose
+		-eu then 2>/dev/null $(pwd) sed then awk "$@" $(pwd)
+		--verbose printf && --verbose
+		-eu sed done | -eu $(pwd) then cd local
+	grep then export ${HOME} | readonly awk awk ${HOME} printf
+		"$1" printf && awk "$1" 'quoted text' --verbose
+		${HOME} done /usr/bin 2>/dev/null local 2>/dev/null ${HOME} && awk sed
+		then then echo echo printf test -eu -eu 'quoted text'
+		test readonly --verbose local 'quoted text' $(pwd) --verbose 2>/dev/null
+	/usr/bin grep | export sed cd echo echo 2>/dev/null x=1 test && "$1"
+2>/dev/null then ${HOME}
+		'quoted text' printf 'quoted text' awk test done $(pwd) printf "$1" /usr/bin
+		local --verbose test readonly 'quoted text' export
+		echo x=1 -eu grep x=1 local printf local
+-eu done "$@" && $(pwd) -eu cd
+	echo done done sed $(pwd) export 2>/dev/null test test printf
+-eu "$1" 2>/dev/null test "$1" then | 2>/dev/null then "$@"
+	-eu local printf done ${HOME} printf --verbose
+		2>/dev/null 2>/dev/null "$1" "$1" "$@"
+		-eu grep "$1" then -eu "$@" $(pwd) /usr/bin
+grep sed local /usr/bin /usr/bin && /usr/bin sed done test ${HOME}
+-eu -eu grep local readonly "$@" ${HOME} then ${HOME} echo printf done printf
+	sed "$1" | && && "$@" x=1 | test cd awk "$1" sed
+then ${HOME} $(pwd) && --verbose
+		${HOME} readonly readonly
+	"$1" | | grep "$1" local echo 'quoted text' readonly x=1 local
+readonly && printf -eu --verbose | /usr/bin /usr/bin
+	echo 'quoted text' $(pwd)
+local then cd ${HOME} 'quoted text' local done -eu "$@" echo cd echo done sed printf
+2>/dev/null "$@" "$@" --verbose $(pwd) -eu local sed local awk --verbose
+	done --verbose /usr/bin readonly printf "$1"
+		-eu $(pwd) 'quoted text' 'quoted text'
+		awk local ${HOME} sed printf 'quoted text' | $(pwd) test 2>/dev/null "$@"
+"$1" -eu cd echo printf /usr/bin grep /usr/bin
+	x=1 local -eu 2>/dev/null export
+		export local sed /usr/bin --verbose
+		sed test | test awk --verbose x=1 cd sed done readonly
+		done printf awk then --verbose ${HOME} local
+readonly $(pwd) then -eu printf local then | echo readonly -eu cd 'quoted text'
+$(pwd) sed --verbose --verbose
+"$1" 'quoted text' cd grep awk x=1 && | | printf ${HOME} local /usr/bin
+		readonly done 'quoted text' /usr/bin
+		--verbose "$@" printf 'quoted text' "$1" /usr/bin
+		printf x=1 local "$@" done printf readonly printf export | /usr/bin
+	&& && -eu | -eu test 'quoted text' export $(pwd)
+		'quoted text' readonly ${HOME} cd --verbose echo 'quoted text' 2>/dev/null
+	&& test echo local then done
+		printf | 2>/dev/null | grep local local
+		'quoted text' -eu x=1 /usr/bin ${HOME} then then "$@" | export
+--verbose --verbose test -eu export
+echo "$@" 'quoted text' /usr/bin grep test done | test "$1" readonly awk | echo
+local | x=1 readonly then then 'quoted text' ${HOME} /usr/bin 2>/dev/null awk grep
+	test done && -eu && "$@"
+| | awk 2>/dev/null readonly awk grep
+		'quoted text' sed /usr/bin test echo readonly
+"$@" "$1" printf sed | done echo "$@" grep
+awk $(pwd) awk test printf then sed echo x=1 "$@" then printf && grep done export
+	x=1 local sed done /usr/bin && echo | $(pwd) && export awk -eu /usr/bin |
+		sed test sed local --verbose x=1 then && --verbose export echo
+		printf /usr/bin cd test ${HOME} printf test readonly printf
+		2>/dev/null | /usr/bin /usr/bin
+	grep "$@" -eu 'quoted text'
+	export readonly "$1" && awk -eu --verbose "$@" export "$@" ${HOME} | local 2>/dev/null
+	printf "$@" -eu 'quoted text' readonly
+&& x=1 local readonly sed export cd
+	/usr/bin test echo --verbose 'quoted text' export sed
+echo awk ${HOME} test test awk readonly test
+	export | awk sed echo echo ${HOME}
+local echo 2>/dev/null -eu -eu grep $(pwd) 'quoted text' echo 2>/dev/null
+		echo echo printf && cd echo readonly "$1" --verbose grep $(pwd) --verbose
+		done -eu sed cd ${HOME} 'quoted text'
+"$@" test printf done then | x=1 then test $(pwd)
+then "$@" awk | "$@" done
+/usr/bin ${HOME} $(pwd) echo
+test 'quoted text' printf local | "$1" grep
+echo && awk done test printf /usr/bin grep
+		readonly x=1 echo "$1" cd echo |
+		--verbose $(pwd) then
+		sed cd -eu /usr/bin printf readonly done | done
+"$@" "$1" test "$1" cd x=1
+"$1" /usr/bin 'quoted text' "$1" /usr/bin && ${HOME} test 'quoted text' done awk
+x=1 "$1" awk awk test -eu $(pwd) -eu readonly done ${HOME} && printf
+	test printf grep done $(pwd) export echo 'quoted text'
+		grep 2>/dev/null x=1 cd 2>/dev/null echo | awk
+cd awk then local --verbose 2>/dev/null
+	/usr/bin x=1 'quoted text' sed done printf -eu local then && "$@"
+		| -eu sed local 'quoted text' && export --verbose ${HOME}
+		done ${HOME} test -eu awk export "$@" --verbose local 'quoted text'
+	-eu x=1 2>/dev/null 2>/dev/null
+		-eu then grep $(pwd) ${HOME} done 2>/dev/null -eu ${HOME} readonly "$@" && 2>/dev/null
+	readonly 'quoted text' local
+		readonly 'quoted text' cd done --verbose -eu 2>/dev/null awk test
+awk ${HOME} -eu readonly test ${HOME} && --verbose awk awk x=1 readonly done
+then "$1" awk sed sed -eu && ${HOME} local test "$@" && && -eu readonly $(pwd)
+${HOME} -eu /usr/bin awk done awk x=1
+		grep echo local export grep grep readonly
+	export test ${HOME} /usr/bin echo "$@" test then "$1" done sed
+		awk sed ${HOME} /usr/bin $(pwd) cd local ${HOME} printf
+		local 2>/dev/null "$@" "$1" 2>/dev/null echo
+-eu done $(pwd) && grep cd --verbose sed 'quoted text' local
+'quoted text' readonly local test 'quoted text'
+		"$@" "$1" awk "$1" 'quoted text' x=1 x=1 $(pwd) 'quoted text'
+2>/dev/null echo ${HOME}
+		printf local local done test cd then --verbose test
+		| grep test -eu printf 'quoted text'
+		--verbose awk -eu local readonly grep then && |
+	2>/dev/null readonly && test done -eu awk then awk
+$(pwd) /usr/bin "$1" local readonly cd $(pwd) local 'quoted text' 2>/dev/null
+	done ${HOME} "$1" "$1" $(pwd)
+then export sed export /usr/bin 'quoted text' $(pwd) && 2>/dev/null
+		"$1" echo x=1 test --verbose grep local
+		${HOME} "$@" 'quoted text'
+	grep local local awk then sed /usr/bin awk "$1" echo "$@" test "$@" 'quoted text'
+		done awk export | | test --verbose test
+	&& cd && ${HOME} echo awk awk grep 'quoted text' $(pwd) $(pwd)
+		| -eu export then "$@" export echo --verbose sed x=1 sed --verbose readonly x=1
+x=1 then then export awk "$1" x=1 $(pwd) "$@" ${HOME} echo export local
+		readonly local printf done --verbose $(pwd) test then grep x=1 local
+	| cd sed sed test /usr/bin | readonly ${HOME} printf ${HOME} sed --verbose
+readonly sed done /usr/bin && readonly sed local
+2>/dev/null -eu test then awk ${HOME}
+	test x=1 sed -eu "$@" echo test 2>/dev/null && x=1 "$1" 'quoted text' --verbose
+		export /usr/bin "$@" x=1 2>/dev/null 2>/dev/null
+		| $(pwd) ${HOME} ${HOME} awk $(pwd) x=1 | printf x=1 'quoted text'
+		--verbose ${HOME} 2>/dev/null export
+'quoted text' echo x=1 export ${HOME} test 2>/dev/null then readonly "$1"
+/usr/bin grep x=1 'quoted text'
+	awk readonly sed "$1"
+sed --verbose 'quoted text' test awk echo 2>/dev/null && x=1
+	$(pwd) "$@" -eu 'quoted text' /usr/bin test then "$@" grep echo 'quoted text'
+	grep | cd awk sed -eu 'quoted text'
+$(pwd) 'quoted text' x=1 x=1 | 2>/dev/null cd x=1 -eu $(pwd) --verbose && "$1" test
+-eu --verbose | x=1 grep | | grep | /usr/bin x=1 "$@" grep "$@" | && |
+	export done x=1 awk 2>/dev/null && test | 'quoted text'
+		awk echo grep local then | then readonly $(pwd) awk /usr/bin 'quoted text'
+&& local ${HOME} ${HOME} grep then --verbose | done x=1
+	done printf | | done /usr/bin x=1 /usr/bin local then --verbose export then done
+	/usr/bin printf "$@" printf cd grep 2>/dev/null ${HOME} echo printf --verbose $(pwd)
+then | "$1" readonly --verbose
+x=1 $(pwd) export "$@" -eu x=1 then then 'quoted text' $(pwd) cd export ${HOME}
+		--verbose then echo "$@" &&
+awk cd export ${HOME} 'quoted text' export cd cd then done | | readonly local
+		local /usr/bin "$@" | --verbose 2>/dev/null
+	&& && readonly echo "$@" ${HOME} then export printf | 'quoted text'
+	&& readonly ${HOME} /usr/bin 2>/dev/null local /usr/bin 'quoted text' cd echo
+		echo && local grep readonly /usr/bin sed readonly | test done cd 2>/dev/null
+export grep 2>/dev/null "$1"
+test printf $(pwd) --verbose test done --verbose x=1 local
+		test 'quoted text' /usr/bin ${HOME}
+	2>/dev/null -eu printf
+		"$@" export readonly test then 'quoted text'
+		/usr/bin | 2>/dev/null && echo grep 2>/dev/null test
+		| export && "$1" sed /usr/bin cd 'quoted text'
+		awk ${HOME} /usr/bin sed
+		then test x=1 readonly local 2>/dev/null "$1" echo cd done done -eu grep
+		done | && | x=1 | ${HOME} awk cd cd awk $(pwd) 2>/dev/null echo readonly readonly
+local 'quoted text' then readonly 'quoted text' 'quoted text' cd awk | done &&
+	printf printf test done "$1" export -eu readonly local -eu 2>/dev/null "$@" readonly
+	then x=1 printf printf local
+"$1" x=1 printf "$@" x=1
+local /usr/bin awk /usr/bin echo export /usr/bin cd -eu done --verbose
+	-eu -eu test printf done ${HOME} local then test grep && grep --verbose 'quoted text'
+	-eu readonly test readonly && awk
+-eu "$1" export grep /usr/bin "$1" $(pwd) 2>/dev/null echo x=1 2>/dev/null "$1"
+"$1" local sed 'quoted text' awk test printf $(pwd) 2>/dev/null readonly printf
+	printf 2>/dev/null --verbose local "$1" /usr/bin grep 'quoted text'
+	printf test then grep local echo sed printf then && test awk readonly "$@" 2>/dev/null
+	printf | | --verbose printf echo /usr/bin
+	-eu done sed cd 'quoted text'
+	${HOME} local && "$1" 'quoted text'
+/usr/bin | x=1 grep && --verbose echo /usr/bin
+-eu -eu cd local printf test --verbose
+		then then /usr/bin readonly test --verbose --verbose --verbose | echo x=1 done
+		x=1 then x=1 $(pwd) --verbose sed 2>/dev/null
+	${HOME} cd 'quoted text' | -eu --verbose "$@" "$1"
+		readonly /usr/bin echo sed x=1 -eu printf cd then
+		local ${HOME} -eu done then awk 'quoted text'
+/usr/bin 'quoted text' local export sed test
+local local && && export
+		printf test 2>/dev/null -eu $(pwd) 'quoted text'
+| | "$@" readonly /usr/bin test grep local $(pwd) && then grep
+	x=1 2>/dev/null -eu && 2>/dev/null
+		readonly 2>/dev/null
+sed ${HOME} export "$1" $(pwd) -eu cd -eu -eu | x=1 ${HOME}
+	then --verbose /usr/bin readonly
+		"$@" readonly x=1 /usr/bin readonly export done echo 'quoted text'
+		local | local -eu | echo done
+	cd $(pwd) echo grep -eu local
+$(pwd) 2>/dev/null x=1
+x=1 printf echo test then awk --verbose && /usr/bin printf
+	readonly | --verbose x=1 awk local then
+--verbose /usr/bin 'quoted text'
+	export --verbose "$1" "$1" /usr/bin grep
+"$@" --verbose export printf "$1" local export awk then "$@" awk /usr/bin
+	sed readonly -eu test awk awk x=1 x=1 -eu "$1" "$@" -eu then --verbose grep
+echo test printf x=1 -eu "$1" then then $(pwd) /usr/bin readonly
+	2>/dev/null $(pwd) cd then
+	| local done ${HOME} ${HOME} |
+		"$1" /usr/bin export done 'quoted text'
+	--verbose awk --verbose cd test ${HOME} "$1" ${HOME} | 2>/dev/null test $(pwd) 2>/dev/null
+	printf printf sed then 'quoted text' $(pwd) grep $(pwd) && ${HOME} "$1" echo then
+-eu grep then then grep && | sed grep sed then
+	cd cd test printf printf grep cd local 2>/dev/null "$@" cd --verbose
+		then 'quoted text' ${HOME} ${HOME}
+	printf cd printf /usr/bin "$1" cd cd 2>/dev/null
+	"$@" ${HOME} awk local /usr/bin
+	&& 2>/dev/null grep grep done done done sed done
+		awk export awk printf test then "$1" 2>/dev/null
+		&& -eu "$1" x=1 done awk cd | "$1" local
+2>/dev/null "$@" then sed local x=1 'quoted text' --verbose 2>/dev/null
+	sed -eu echo -eu readonly done $(pwd) "$1" done export --verbose
+	sed sed && | -eu -eu grep && "$1" 2>/dev/null "$@" --verbose
+		local test printf "$1" "$@" ${HOME} sed done sed local && then | cd readonly
+	readonly | 'quoted text' $(pwd) then $(pwd) cd awk --verbose /usr/bin
+	cd local "$@" 'quoted text'
+then "$@" "$@" "$@" awk awk | && local
+		/usr/bin --verbose done /usr/bin 'quoted text' done /usr/bin /usr/bin
+&& 2>/dev/null test ${HOME} awk printf -eu
+		-eu cd x=1 export test "$1" awk x=1 readonly
+	x=1 "$1" export 'quoted text'
+&& grep | test --verbose --verbose x=1 sed /usr/bin x=1 "$1"
+awk then local cd printf sed test then /usr/bin --verbose awk cd grep | /usr/bin
+	cd echo ${HOME} --verbose echo then grep done echo $(pwd) printf test export
+grep readonly --verbose export grep /usr/bin
+		2>/dev/null -eu export cd then 'quoted text' then "$1" local echo ${HOME}
+		--verbose && "$@" | then
+		cd $(pwd) then 'quoted text' cd "$@" done $(pwd) "$1" -eu "$@"
+	local echo readonly -eu x=1 then printf "$@" "$@" local /usr/bin "$@"
+${HOME} done export "$@" awk readonly --verbose done
+		2>/dev/null then "$@" 'quoted text' ${HOME} && 'quoted text' export
+		printf 'quoted text' then done awk /usr/bin cd "$1"
+	x=1 | --verbose "$@" then test then done -eu then awk -eu done
+	grep grep ${HOME} cd grep "$1" --verbose local sed && test readonly awk
+	local echo then x=1 then /usr/bin | then readonly $(pwd)
+| cd --verbose $(pwd) done readonly &&
+printf "$1" done 'quoted text' ${HOME}
+		echo readonly test test 'quoted text'
+--verbose readonly --verbose && 'quoted text' "$1" "$1" done -eu | local done
+		$(pwd) readonly ${HOME} printf $(pwd) --verbose echo grep awk
+echo export --verbose printf 2>/dev/null grep export
+'quoted text' -eu "$@" then ${HOME} local x=1 --verbose --verbose
+	x=1 echo --verbose "$@" cd /usr/bin grep sed
+		"$1" awk $(pwd) /usr/bin grep grep && local printf
+grep x=1 "$@" export -eu 2>/dev/null | then then | /usr/bin "$1"
+	x=1 --verbose done | printf -eu done "$1" export 'quoted text'
+	export cd x=1 cd | then export grep && echo
+		local then cd then echo 'quoted text' "$1"
+		echo 'quoted text' | sed $(pwd) cd awk readonly && "$@" 2>/dev/null
+		$(pwd) -eu && export && 2>/dev/null export sed /usr/bin
+	test done --verbose x=1
+		&& x=1 ${HOME} && --verbose | | | export --verbose done
+-eu --verbose cd x=1 /usr/bin 2>/dev/null awk /usr/bin x=1 'quoted text'
+	${HOME} echo test local test
+	'quoted text' printf "$@" | ${HOME} "$@" readonly
+	2>/dev/null readonly "$1" | --verbose sed sed grep export echo
+	2>/dev/null cd | --verbose printf grep readonly done && "$1" ${HOME} printf
+		export $(pwd) cd awk sed 'quoted text'
+		awk | ${HOME} readonly printf "$@" test x=1 cd cd local local sed
+		&& test cd cd done --verbose 'quoted text' /usr/bin -eu grep
+	${HOME} awk test printf printf 'quoted text' "$1" | "$1"
+		then echo "$@" 'quoted text' x=1 x=1 "$@" $(pwd) grep
+cd && 2>/dev/null printf && sed | export --verbose local /usr/bin readonly local
+	&& "$1" --verbose x=1 grep printf --verbose -eu 2>/dev/null "$1"
+		$(pwd) printf "$@" sed grep "$1" && 2>/dev/null
+	local && awk -eu --verbose local "$@" sed test x=1 done "$@" done && echo
+		test x=1 local --verbose then done
+sed -eu -eu done local $(pwd) test test "$1" 'quoted text'
+		&& -eu ${HOME} grep && sed | $(pwd) --verbose test readonly sed x=1
+		sed -eu -eu export && && sed awk | 'quoted text'
+		&& then then 'quoted text' /usr/bin sed
+	grep /usr/bin x=1 2>/dev/null 'quoted text'
+		export "$@" test 'quoted text'
+export sed 'quoted text'
+	x=1 printf /usr/bin && "$@" readonly --verbose
+	printf 2>/dev/null ${HOME} -eu | export
+then 2>/dev/null $(pwd) printf test | x=1 echo test 2>/dev/null
+	grep | | test readonly && /usr/bin x=1 grep 2>/dev/null
+		'quoted text' $(pwd) ${HOME} local export ${HOME}
+		echo done && awk test "$@" 2>/dev/null --verbose 2>/dev/null
+export echo "$@" export --verbose | | 'quoted text' grep -eu --verbose export
+	${HOME} 'quoted text' echo local readonly
+	-eu "$1" awk 2>/dev/null
+		printf ${HOME} $(pwd) cd cd echo | awk sed test -eu 2>/dev/null printf
+	local test --verbose echo /usr/bin --verbose "$@" local ${HOME}
+		done "$1" local | export awk --verbose
+local && printf --verbose awk 'quoted text' --verbose done /usr/bin
+| export test 2>/dev/null done readonly local --verbose 2>/dev/null x=1 local sed
+cd echo -eu export 'quoted text' -eu done 'quoted text' -eu 'quoted text'
+		done then x=1 && -eu | $(pwd) $(pwd)
+readonly local then local test test done sed sed echo test export sed
+		done awk "$@" awk done grep && 'quoted text'
+awk /usr/bin printf "$@" export ${HOME}
+$(pwd) --verbose 2>/dev/null 2>/dev/null awk -eu printf
+	-eu 'quoted text' "$1" 2>/dev/null "$1" test echo
+	${HOME} && test export x=1 test 'quoted text' readonly --verbose
+		| echo "$1" local $(pwd)
+${HOME} test awk ${HOME} "$@" 'quoted text' sed readonly 'quoted text'
+	readonly then $(pwd) test -eu "$1" then ${HOME} --verbose
+| test awk "$1" && $(pwd) export done /usr/bin echo x=1
+		test -eu && "$1" sed $(pwd) /usr/bin sed echo echo
+awk "$@" -eu printf readonly test awk /usr/bin $(pwd) readonly awk -eu 'quoted text'
+		"$1" x=1 test -eu "$@" 2>/dev/null "$@" $(pwd) echo awk x=1 cd test |
+		"$@" 2>/dev/null test | "$@"
+	printf 'quoted text' "$1" awk ${HOME} sed test test then
+readonly $(pwd) printf "$@" ${HOME} done done done "$1" printf then "$1" grep
+	${HOME} cd test printf -eu "$1" /usr/bin
+-eu -eu test test done x=1 /usr/bin printf export "$@" cd
+		| grep "$@" /usr/bin "$1" test 'quoted text'
+${HOME} 2>/dev/null awk x=1 'quoted text' 'quoted text' readonly awk "$@" test
+		grep done ${HOME} x=1 echo 'quoted text' "$@" 'quoted text' printf done
+	"$1" cd 'quoted text' && --verbose 'quoted text' done then && export cd /usr/bin
+	printf local 2>/dev/null sed x=1 /usr/bin $(pwd) --verbose 'quoted text'
+		grep test test printf --verbose sed -eu local && 'quoted text'
+cd $(pwd) grep readonly | $(pwd) test
+	awk printf "$1" ${HOME} export --verbose awk
+then cd 'quoted text' awk then "$1" -eu echo | grep test x=1 echo grep awk
+		printf export --verbose echo 'quoted text'
+		readonly "$1" printf cd local | cd awk
+local x=1 ${HOME} $(pwd) "$@"
+-eu printf && 'quoted text'
+	"$@" "$@" cd && --verbose -eu grep 'quoted text' ${HOME} echo printf | sed local
+	'quoted text' grep printf local grep "$@" "$1" then ${HOME} $(pwd) &&
+		| "$@" test then local --verbose
+		${HOME} sed --verbose x=1 /usr/bin export
+echo readonly echo && awk echo done "$1" done ${HOME} done
+done "$@" -eu local "$1" "$@" x=1 cd cd local local local grep
+		local readonly "$1" 'quoted text' readonly
+then $(pwd) -eu "$1" readonly x=1 cd export grep grep echo | sed 2>/dev/null
+grep printf 2>/dev/null export
+--verbose "$1" local /usr/bin ${HOME} |
+${HOME} printf "$1" 'quoted text' sed "$@" test 'quoted text'
+		${HOME} then --verbose $(pwd) cd 'quoted text' /usr/bin test --verbose
+${HOME} test /usr/bin
+sed echo cd sed /usr/bin -eu "$1" --verbose cd x=1 2>/dev/null cd then printf
+		x=1 "$1" local $(pwd) grep export -eu awk awk cd local test
+		printf cd cd readonly export --verbose cd local ${HOME} |
+		local then done $(pwd) echo $(pwd) printf then ${HOME} /usr/bin
+		echo grep grep readonly /usr/bin
+	done "$@" export --verbose -eu cd -eu done export $(pwd)
+	x=1 /usr/bin $(pwd) printf x=1 sed cd x=1 -eu test then /usr/bin
+		2>/dev/null -eu ${HOME}
+"$1" done | "$1" local 'quoted text' then awk 2>/dev/null --verbose
+		printf test readonly 'quoted text'
+	awk sed x=1 done | cd
+readonly awk sed 2>/dev/null x=1 awk x=1 export done | cd sed echo x=1 grep
+		"$1" local ${HOME} cd /usr/bin grep export awk
+		sed sed readonly "$1" /usr/bin
+		local /usr/bin | 'quoted text' printf "$1" /usr/bin test ${HOME} 2>/dev/null
+		local "$1" done echo "$1" readonly export --verbose awk echo $(pwd)
+"$1" 'quoted text' readonly cd 'quoted text' test awk "$1" local printf
+echo "$@" done grep awk done "$@" grep | test printf
+cd 2>/dev/null cd readonly cd echo 'quoted text' echo test x=1 $(pwd) 2>/dev/null
+		2>/dev/null printf /usr/bin | echo printf $(pwd) "$1" awk printf
+sed $(pwd) "$@" && grep
+	"$1" done local 2>/dev/null --verbose echo x=1 --verbose awk
+		cd cd $(pwd) 'quoted text' done "$@" export
+"$@" "$@" 2>/dev/null 2>/dev/null "$1" 2>/dev/null done then echo "$1"
+		echo cd 'quoted text' ${HOME} awk local 2>/dev/null x=1
+		awk /usr/bin then 2>/dev/null readonly cd &&
+then ${HOME} readonly printf echo cd
+&& -eu "$@" /usr/bin && && "$1" /usr/bin done
+		"$@" done printf printf awk "$1" sed cd local --verbose /usr/bin
+	export grep cd 'quoted text'
+	printf "$@" printf readonly
+		test -eu $(pwd) "$@" echo && echo
+&& -eu --verbose $(pwd) cd grep x=1 awk printf "$1" && printf done --verbose
+		${HOME} grep --verbose printf
+grep echo 2>/dev/null local 2>/dev/null grep x=1
+		| "$@" local && ${HOME} x=1 sed
+	2>/dev/null && local /usr/bin then done "$1" x=1 then --verbose
+sed local echo then export sed | /usr/bin x=1 printf done
+2>/dev/null x=1 printf
+'quoted text' awk && ${HOME} sed && 2>/dev/null export sed ${HOME}
+$(pwd) done printf local sed 2>/dev/null | export
+		echo 'quoted text' && -eu local /usr/bin x=1 2>/dev/null echo
+		export "$1" 2>/dev/null local export ${HOME} done
+		"$1" --verbose then "$@" --verbose /usr/bin export cd
+		export printf /usr/bin 'quoted text' printf
+		"$1" then $(pwd) /usr/bin printf
+readonly /usr/bin awk grep export done x=1 printf sed printf | x=1 | export ${HOME}
+		&& grep echo test ${HOME} sed
+	awk cd 2>/dev/null && ${HOME}
+2>/dev/null then "$1" readonly /usr/bin $(pwd)
+		-eu grep printf --verbose sed
+		| -eu $(pwd) cd ${HOME} 2>/dev/null
+&& cd readonly cd echo | then readonly done then $(pwd) done x=1 awk 2>/dev/null
+x=1 'quoted text' test test && readonly "$@" --verbose ${HOME} export
+	readonly "$1" test 2>/dev/null 'quoted text' then done "$@" printf
+awk grep then -eu readonly "$@" | /usr/bin
+	grep export done 2>/dev/null $(pwd) grep | sed readonly
+test "$1" awk "$@" awk then 2>/dev/null
+	echo 'quoted text' "$1" awk local
+	sed x=1 grep 'quoted text' sed x=1 readonly && $(pwd) export 'quoted text'
+	| sed 2>/dev/null test | && local ${HOME} 'quoted text'
+${HOME} readonly echo export x=1 x=1 echo | sed ${HOME} && 2>/dev/null
+$(pwd) grep $(pwd) readonly sed then
+		local "$@" -eu /usr/bin -eu | | printf readonly readonly 2>/dev/null
+cd printf 'quoted text' x=1 /usr/bin readonly
+then "$1" readonly 'quoted text' test "$@"
+		readonly echo 'quoted text' export awk awk
+		done export "$@" printf 2>/dev/null export --verbose "$@" |
+		sed then printf x=1 test test then "$@" $(pwd) 'quoted text' /usr/bin -eu readonly
+'quoted text' && && 'quoted text' export /usr/bin
+		'quoted text' ${HOME} echo /usr/bin cd $(pwd) test export readonly -eu
+cd 2>/dev/null test awk local && cd
+$(pwd) export test cd done sed local --verbose sed
+		x=1 "$@" test test -eu then $(pwd) "$@" --verbose "$@" 'quoted text'
+	'quoted text' sed readonly /usr/bin test ${HOME} grep printf --verbose test test
+/usr/bin printf ${HOME} && awk export ${HOME} x=1 && echo
+	-eu 'quoted text' /usr/bin 'quoted text'
+$(pwd) x=1 $(pwd) "$1" done readonly
+	&& done -eu sed cd && x=1 test test test readonly && | local
+		cd | done ${HOME} grep local x=1 x=1 cd readonly
+local then local then local $(pwd) -eu ${HOME} x=1 "$1" test && --verbose printf
+		'quoted text' 'quoted text'
+grep "$@" $(pwd) --verbose readonly test --verbose /usr/bin --verbose
+		then /usr/bin readonly cd printf
+	"$1" "$1" test then && -eu --verbose &&
+"$@" test awk readonly then export grep sed echo awk "$@" "$@" grep printf
+-eu x=1 "$1" $(pwd) ${HOME} "$1" $(pwd) export readonly "$1" done printf done
+		| /usr/bin grep x=1 x=1 ${HOME} |
+test && readonly $(pwd) | 2>/dev/null printf
+test then $(pwd) | 'quoted text' && &&
+		-eu awk --verbose test test x=1 echo
+readonly test && | | ${HOME} grep
+	"$1" test awk /usr/bin echo test $(pwd) printf local $(pwd) readonly
+	| 'quoted text' grep 'quoted text' /usr/bin then local
+'quoted text' $(pwd) awk
+		--verbose test ${HOME} test
+awk printf export $(pwd) awk done export echo 2>/dev/null
+		then $(pwd) local done ${HOME} --verbose ${HOME} | 'quoted text'
+	printf cd done grep -eu 2>/dev/null cd echo | 'quoted text' $(pwd) done then
+printf then | /usr/bin ${HOME} "$1" $(pwd) -eu then "$@" export
+then done export $(pwd) printf --verbose sed export then "$@" then
+		cd -eu done then echo sed export "$1" -eu x=1 && local local test printf && 'quoted text'
+	'quoted text' "$@" $(pwd) then "$1" && awk grep sed ${HOME}
+	readonly done grep awk local "$@" readonly
+	done cd /usr/bin x=1 x=1 $(pwd) "$@" x=1
+	echo "$@" cd 2>/dev/null --verbose x=1 && && | sed $(pwd)
+/usr/bin done test awk x=1 /usr/bin --verbose && /usr/bin
+echo export echo $(pwd) -eu -eu ${HOME} $(pwd) export x=1 grep
+	-eu 'quoted text' then
+	echo x=1 && grep -eu printf 'quoted text' cd export export
+	echo grep test x=1 2>/dev/null test echo
+local 'quoted text' readonly printf export
+--verbose sed awk export 'quoted text'
+		$(pwd) printf export && &&
+		sed /usr/bin && test
+then 'quoted text' | $(pwd) sed | test cd readonly grep | grep
+		/usr/bin echo done then 2>/dev/null export then x=1 $(pwd) 'quoted text' $(pwd)
+		-eu /usr/bin grep 2>/dev/null done x=1 -eu x=1 2>/dev/null --verbose sed && printf
+		local $(pwd) sed $(pwd) ${HOME}
+		"$1" ${HOME} grep printf export "$@" | /usr/bin x=1 $(pwd) | printf $(pwd)
+--verbose 2>/dev/null | sed printf ${HOME} "$@" "$1" /usr/bin local echo
+		'quoted text' && then export sed ${HOME} "$@"
+		readonly $(pwd) "$1" test printf -eu
+	| 2>/dev/null echo /usr/bin --verbose x=1 --verbose &&
+done && 2>/dev/null x=1 && /usr/bin cd grep then then
+	grep sed "$1" local | local sed export 'quoted text' printf sed
+		${HOME} grep "$1" readonly 2>/dev/null $(pwd) ${HOME} awk
+		readonly --verbose test
+2>/dev/null "$1" then readonly test "$@"
+	| echo $(pwd) export awk &&
+		$(pwd) "$1" awk 2>/dev/null
+2>/dev/null sed "$1" $(pwd) grep --verbose -eu 2>/dev/null
+local --verbose 'quoted text' export 2>/dev/null | export
+$(pwd) $(pwd) -eu printf "$@" sed export test
+echo ${HOME} cd | ${HOME} | -eu grep cd sed awk
+test "$1" local grep /usr/bin /usr/bin -eu | "$@"
+	sed /usr/bin -eu sed ${HOME} awk printf -eu
+export awk 2>/dev/null $(pwd) 'quoted text' -eu "$1" x=1 ${HOME}
+	sed 'quoted text' ${HOME} /usr/bin
+		export local readonly test "$@" readonly export /usr/bin $(pwd)
+	| awk --verbose 2>/dev/null --verbose readonly ${HOME} local $(pwd) && sed --verbose
+		echo then 'quoted text' done && echo 'quoted text' grep
+${HOME} "$@" readonly cd grep sed x=1 /usr/bin grep 'quoted text' grep $(pwd) awk
+		export cd local then | printf && sed test | 2>/dev/null export | $(pwd) sed readonly
+	cd awk grep local awk -eu "$@" readonly test && then echo "$1" sed && echo 'quoted text'
+-eu && echo 'quoted text' export "$1" export $(pwd) grep 2>/dev/null "$@"
+printf 'quoted text' test --verbose local ${HOME} | -eu then "$1" local
+sed && grep then readonly readonly x=1 done test printf cd "$1" "$1"
+	readonly x=1 "$@" /usr/bin done "$@" echo local sed readonly cd local "$@" 2>/dev/null
+"$@" $(pwd) $(pwd) readonly /usr/bin
+		2>/dev/null ${HOME} done 'quoted text' --verbose
+echo x=1 "$@" done $(pwd) 'quoted text'
+echo echo && 'quoted text' 2>/dev/null readonly 2>/dev/null test export awk
+-eu then then grep export -eu | printf readonly printf local && echo test
+		echo $(pwd) /usr/bin grep && $(pwd) done
+		&& --verbose "$@" 'quoted text' "$1" printf 2>/dev/null "$1"
+	"$@" grep 2>/dev/null "$1" -eu echo done
+	export "$1" ${HOME} ${HOME} --verbose $(pwd) ${HOME} sed grep test
+$(pwd) | cd test /usr/bin
+		${HOME} then then export local
+	&& "$1" | ${HOME} cd echo printf done /usr/bin | export -eu ${HOME}
+		&& echo echo "$@" test 'quoted text' &&
+		then grep then done then done sed $(pwd) -eu local "$1"
+'quoted text' -eu -eu awk readonly
+"$@" /usr/bin test ${HOME} x=1 --verbose | cd "$1" then
+grep "$1" "$1" 'quoted text' export --verbose readonly -eu "$@" ${HOME} echo
+		${HOME} /usr/bin x=1 grep 'quoted text' -eu grep then
+		export "$1" 'quoted text' /usr/bin "$@" grep echo export | export grep echo
+/usr/bin local -eu x=1 'quoted text' /usr/bin readonly
+	x=1 grep awk export "$1" printf local cd then test -eu done
+		sed done "$1" x=1 2>/dev/null --verbose readonly x=1 sed readonly
+		2>/dev/null /usr/bin "$1"
+		"$1" "$@" grep 'quoted text' ${HOME} local readonly sed
+--verbose readonly && echo test /usr/bin --verbose
+		done $(pwd) $(pwd) grep echo "$1" $(pwd) export
+	"$@" then /usr/bin "$@" then done local -eu ${HOME} done && 2>/dev/null
+	done 2>/dev/null 'quoted text' "$1" test cd cd then 'quoted text'
+	export ${HOME} then echo
+	cd /usr/bin awk export grep local
+	x=1 ${HOME} cd done awk
+		2>/dev/null "$1" awk sed && echo test echo export sed grep 'quoted text'
+	sed ${HOME} "$1" -eu x=1 test /usr/bin grep | then cd awk 'quoted text'
+		test $(pwd) ${HOME} && grep grep
+x=1 x=1 | grep done done && $(pwd) ${HOME}
+${HOME} && ${HOME} echo grep $(pwd) local --verbose "$1" ${HOME}
+	awk readonly cd sed 'quoted text' "$@" --verbose
+-eu 'quoted text' && grep done echo 2>/dev/null && printf
+		| sed $(pwd) | local 2>/dev/null -eu awk printf 'quoted text'
+		then awk x=1 grep ${HOME} "$@" 2>/dev/null && 'quoted text'
+	"$@" 'quoted text' --verbose
+"$1" then export 2>/dev/null "$1" awk export test export
+	"$1" ${HOME} local /usr/bin /usr/bin
+-eu --verbose "$@" sed grep test "$1" ${HOME} done then -eu cd test echo awk
+	printf local "$1" ${HOME} x=1 | done printf grep export printf grep grep export
+		export echo cd awk && 'quoted text' -eu awk --verbose
+"$1" "$1" "$@" done export ${HOME} /usr/bin $(pwd) 'quoted text' local
+	local "$1" $(pwd) readonly
+		-eu echo done local readonly sed
+		${HOME} 2>/dev/null $(pwd) local local 2>/dev/null cd
+	readonly /usr/bin 2>/dev/null readonly printf
+awk sed -eu | echo x=1 | /usr/bin && "$1" && test cd
+-eu echo -eu | 2>/dev/null then echo -eu export /usr/bin cd printf "$1" | 2>/dev/null
+readonly export 2>/dev/null then
+	&& grep 'quoted text' && readonly
+	| ${HOME} cd | local echo grep -eu $(pwd) 2>/dev/null awk
+		grep $(pwd) && printf printf grep
+"$@" --verbose test /usr/bin awk "$1" awk done $(pwd) sed readonly echo x=1 then
+		awk awk $(pwd) /usr/bin && /usr/bin | x=1 'quoted text'
+cd | printf x=1 test then cd cd sed "$1" printf ${HOME} test grep "$1" then
+		grep ${HOME} echo "$1" done printf local
+	"$1" ${HOME} cd awk done cd ${HOME} sed grep cd export $(pwd)
+	'quoted text' $(pwd) $(pwd) && local x=1 ${HOME} "$1" grep
+		echo x=1 x=1 2>/dev/null --verbose -eu x=1 grep done readonly --verbose export "$1"
+"$1" local local 'quoted text' echo printf cd -eu
+${HOME} then sed x=1 ${HOME} done done cd test done ${HOME} awk echo
+	"$1" "$1" export 'quoted text' readonly done --verbose
+	local cd local local "$1" 'quoted text'
+then printf grep 'quoted text'
+| printf x=1 local cd printf -eu
+	local export export --verbose
+	test "$@" export test | ${HOME} done printf $(pwd) $(pwd) awk -eu done
+$(pwd) printf echo "$@" $(pwd) local "$@" ${HOME} export
+sed && printf -eu "$1" readonly 2>/dev/null --verbose --verbose
+		"$1" -eu | x=1 grep test readonly cd ${HOME}
+		${HOME} printf sed ${HOME}
+cd grep --verbose /usr/bin 2>/dev/null printf grep printf test --verbose
+		&& export cd $(pwd) --verbose awk 2>/dev/null "$@" sed done ${HOME} | && echo
+	echo cd && 2>/dev/null done | --verbose
+		"$@" export printf && x=1 export
+	echo && 'quoted text' | 'quoted text' grep | grep
+x=1 'quoted text' readonly test
+	| readonly readonly grep /usr/bin x=1 test "$1" printf
+		echo "$@" $(pwd) 2>/dev/null then "$@" cd local -eu local cd "$1" readonly $(pwd)
+	cd $(pwd) printf 2>/dev/null --verbose /usr/bin | x=1 2>/dev/null
+'quoted text' local local
+		-eu /usr/bin 2>/dev/null done ${HOME}
+		'quoted text' && export /usr/bin /usr/bin |
+	test test | 2>/dev/null $(pwd) grep x=1 && echo then --verbose 2>/dev/null
+		${HOME} $(pwd) local -eu
+x=1 test done export x=1 && printf readonly 'quoted text' echo -eu -eu test | &&
+printf echo /usr/bin $(pwd) 'quoted text'
+	done awk /usr/bin | ${HOME} && sed sed echo
+cd 2>/dev/null ${HOME} --verbose done $(pwd) ${HOME} test
+	&& then awk readonly "$1" printf $(pwd)
+		readonly test && echo local cd export 'quoted text' "$@"
+"$@" x=1 --verbose local --verbose
+done /usr/bin 'quoted text' cd then "$1" done "$@" -eu test x=1 'quoted text'
+		"$1" test x=1 sed local
+		printf x=1 $(pwd) | ${HOME} && x=1 grep -eu sed | echo grep then
+	2>/dev/null export ${HOME} ${HOME} | readonly cd sed export
+		grep then "$@" printf 'quoted text' ${HOME} $(pwd) 'quoted text'
+	$(pwd) echo "$@" sed | export awk then
+		readonly 2>/dev/null && grep x=1 awk then 2>/dev/null /usr/bin | && echo /usr/bin
+printf done awk 'quoted text' sed
+		export 2>/dev/null then printf "$@" export export then ${HOME} ${HOME} $(pwd) /usr/bin
+		&& 2>/dev/null "$1" && grep
+test printf "$@" /usr/bin 'quoted text' 2>/dev/null
+		--verbose awk /usr/bin
+awk /usr/bin $(pwd) "$@" then local /usr/bin printf local --verbose printf
+	readonly awk sed cd "$@" 2>/dev/null x=1 2>/dev/null
+	${HOME} awk then "$@" && && then | --verbose
+cd "$1" ${HOME} test && export readonly sed $(pwd) grep ${HOME} "$@"
+		${HOME} "$@" ${HOME} x=1 export | "$1" printf echo awk "$1" --verbose awk cd
+then local cd && test 2>/dev/null ${HOME} sed then --verbose "$1" cd "$@" export
+		done --verbose x=1 awk then -eu $(pwd)
+		$(pwd) awk cd export printf -eu 2>/dev/null -eu readonly 2>/dev/null echo
+		"$1" "$@" $(pwd) 2>/dev/null
+$(pwd) export | 2>/dev/null
+		"$1" "$@" "$@" --verbose 2>/dev/null test "$@" $(pwd) "$1" 'quoted text'
+&& "$@" -eu ${HOME} 2>/dev/null test ${HOME} x=1 'quoted text'
+	-eu readonly printf grep $(pwd) export 'quoted text'
+	awk && x=1 readonly "$1" echo awk then cd local printf readonly cd
+		awk | done "$1" done "$@" export cd
+| export awk printf sed readonly 'quoted text' --verbose "$1" echo export
+readonly awk export x=1 grep 2>/dev/null printf $(pwd) test export
+awk "$@" export cd 'quoted text' sed echo --verbose --verbose --verbose ${HOME}
+		"$@" --verbose --verbose readonly
+	export awk local 2>/dev/null done "$1" printf local 'quoted text' "$1"
+2>/dev/null cd sed "$1" x=1 awk x=1 $(pwd) x=1
+	$(pwd) 2>/dev/null then --verbose test printf readonly ${HOME} local
+	$(pwd) && then "$@" sed "$@" done awk
+	export done done test /usr/bin x=1 -eu "$@" test $(pwd) awk | test
+		$(pwd) export "$1" --verbose
+'quoted text' done $(pwd) ${HOME} test cd export $(pwd) x=1 'quoted text'
+		&& -eu readonly test x=1 $(pwd)
+		cd ${HOME} local && 2>/dev/null | test test -eu ${HOME} $(pwd) cd && /usr/bin
+export local ${HOME} cd then 'quoted text' 2>/dev/null
+	echo export ${HOME} grep cd echo 2>/dev/null /usr/bin
+test $(pwd) sed grep readonly awk --verbose printf --verbose test
+		${HOME} && x=1 --verbose x=1 "$@" echo then grep ${HOME} x=1 readonly
+#include c81.sh
+		readonly export printf $(pwd) echo --verbose $(pwd) | awk grep 2>/dev/null
+	2>/dev/null "$@" "$@" cd /usr/bin -eu printf done 'quoted text'
+		| ${HOME} export awk test awk && ${HOME} grep then /usr/bin
+	"$@" --verbose done 2>/dev/null
+| | $(pwd) printf $(pwd) cd "$1"
+		/usr/bin "$1" cd cd export grep sed && $(pwd)
+	'quoted text' -eu local ${HOME} awk --verbose -eu printf
+2>/dev/null -eu 2>/dev/null test
+	done -eu 'quoted text' local | && then cd grep awk export export then
+	cd $(pwd) $(pwd) ${HOME}
+then && 'quoted text' $(pwd)
+-eu && "$@" && x=1 awk 'quoted text' 2>/dev/null 'quoted text'
+$(pwd) "$@" 'quoted text' x=1 local sed | grep "$1" echo $(pwd) printf echo
+/usr/bin sed x=1 readonly
+		-eu awk --verbose | done printf grep 2>/dev/null grep printf
+test sed && x=1 grep && echo
+		&& -eu -eu 2>/dev/null then echo
+done sed readonly $(pwd) ${HOME}
+	readonly | done "$1" ${HOME} "$@"
+'quoted text' grep sed local 2>/dev/null printf "$@" grep 'quoted text' "$@"
+'quoted text' readonly "$1" local grep grep sed $(pwd) -eu grep export sed
+"$@" --verbose done printf -eu export grep export
+		local echo x=1 echo awk
+	-eu echo test /usr/bin readonly -eu then && | test then 'quoted text' | ${HOME}
+		awk cd | echo && x=1 "$1" sed x=1 | 2>/dev/null readonly 2>/dev/null echo done
+cd --verbose /usr/bin x=1 local echo x=1 echo --verbose then
+		printf done | /usr/bin -eu /usr/bin readonly cd cd then $(pwd)
+done test /usr/bin cd readonly 2>/dev/null done
+readonly readonly cd test $(pwd) -eu printf 2>/dev/null then
+	export printf 'quoted text'
+	echo readonly "$1" | $(pwd) local --verbose
+		test test local $(pwd)
+	--verbose then && && x=1 done && -eu "$@" sed x=1 ${HOME}
+	$(pwd) local readonly /usr/bin x=1
+	/usr/bin done local "$@" done then -eu 'quoted text'
+	x=1 $(pwd) | "$1" --verbose && cd export export -eu
+	export --verbose export readonly awk | x=1 && -eu "$1" cd x=1 cd ${HOME}
+		$(pwd) /usr/bin | test export "$@" printf done --verbose
+"$1" "$1" x=1 printf printf then export "$1" sed 'quoted text' grep x=1 x=1
+	export readonly local local ${HOME} x=1 printf x=1 'quoted text' echo "$1"
+	test $(pwd) sed grep echo --verbose
+	$(pwd) --verbose ${HOME} /usr/bin 'quoted text' | awk
+${HOME} local grep 2>/dev/null local local && ${HOME} "$1" $(pwd)
+cd then readonly 2>/dev/null sed cd ${HOME} local echo x=1 test -eu "$@"
+$(pwd) -eu echo $(pwd) |
+		$(pwd) awk grep then cd && cd then && awk sed x=1 export 'quoted text'
+$(pwd) printf "$1" readonly "$@"
+		test awk printf sed /usr/bin /usr/bin --verbose /usr/bin "$@" grep echo test
+		'quoted text' local cd printf 2>/dev/null /usr/bin
+	readonly 2>/dev/null awk done "$1" /usr/bin cd "$@" cd "$1" printf "$@" "$@"
+		export echo 2>/dev/null
+--verbose printf $(pwd) echo --verbose 2>/dev/null x=1 then awk 'quoted text'
+"$1" export 'quoted text' echo echo cd
+		export test then readonly export cd
+	grep done | && local $(pwd) done /usr/bin awk readonly awk printf grep
+		'quoted text' cd readonly 2>/dev/null 2>/dev/null awk 'quoted text' "$@" echo done
+		readonly cd "$1" "$@" x=1 "$1" "$@" export printf
+local "$1" sed sed export local "$@" 2>/dev/null 2>/dev/null done --verbose
+| "$1" then export && sed -eu && then /usr/bin
+sed /usr/bin export | "$@" 'quoted text' x=1 readonly | done -eu test
+grep readonly $(pwd) -eu echo printf echo --verbose /usr/bin
+	sed $(pwd) -eu 'quoted text'
+		export cd test -eu echo local grep | test
+--verbose readonly awk echo then x=1 sed
+--verbose "$1" "$@" printf "$1"
+| export "$1" sed then cd cd cd x=1 x=1 x=1
+"$1" x=1 -eu readonly then printf
+		printf && grep done /usr/bin local | "$@" export /usr/bin x=1 awk sed 2>/dev/null
+--verbose done /usr/bin readonly | cd $(pwd) "$@" awk readonly -eu
+		readonly export sed printf && -eu
+	test done 2>/dev/null /usr/bin -eu readonly grep
+then sed ${HOME} "$@" local
+		"$@" $(pwd) test done "$1" | awk x=1 x=1 | done $(pwd)
+		&& printf awk | sed printf
+		readonly && awk done && awk grep "$@" printf local x=1 local
+	test export cd --verbose printf ${HOME} export then "$@" cd
+		awk done export test "$@" "$1" /usr/bin | "$1" 'quoted text' local cd then local
+	readonly done 'quoted text' echo && export "$@" "$@" grep readonly export 'quoted text'
+	readonly /usr/bin cd
+--verbose "$@" printf then ${HOME} export $(pwd) "$1"
+	grep $(pwd) --verbose "$1" printf awk cd "$@" awk local
+grep 'quoted text' then readonly then then
+		grep -eu 'quoted text' readonly && export then sed $(pwd)
+		done ${HOME} awk cd cd "$1" echo local /usr/bin sed grep done /usr/bin
+grep cd 'quoted text' /usr/bin
+&& --verbose -eu done 'quoted text' local printf echo "$@"
+	$(pwd) /usr/bin export readonly | grep ${HOME} ${HOME} && "$@"
+awk | | sed /usr/bin local 2>/dev/null printf
+	grep $(pwd) sed 2>/dev/null -eu local "$@" export /usr/bin
+"$@" && $(pwd) --verbose
+	sed done x=1 awk 'quoted text' ${HOME} x=1 "$@" awk x=1 && cd printf printf
+$(pwd) "$@" echo printf x=1 cd sed 'quoted text' && then |
+	sed local "$@" readonly x=1 cd local printf -eu then
+	awk 2>/dev/null test done export
+	sed cd grep ${HOME} done | then then grep sed | done sed sed
+		&& ${HOME} -eu | x=1 echo "$@" -eu grep "$1" echo x=1 sed test 'quoted text'
+export ${HOME} "$1" -eu x=1 sed printf readonly x=1 $(pwd)
+		"$1" cd export "$1" printf awk awk export then x=1 cd -eu && "$1" 2>/dev/null
+'quoted text' export --verbose
+		sed echo x=1 -eu test awk printf --verbose echo
+		sed grep then | grep 'quoted text' then local
+		sed grep readonly local sed &&
+		export "$1" 'quoted text' | local 2>/dev/null
+readonly then test "$1" grep
+echo /usr/bin local ${HOME} 2>/dev/null printf printf "$1" "$1"
+printf | -eu "$@" done sed grep echo
+		"$@" echo 2>/dev/null -eu $(pwd) done readonly
+	cd --verbose ${HOME} sed -eu 2>/dev/null then ${HOME} readonly
+grep export export local /usr/bin && "$1" 'quoted text'
+	${HOME} export "$1" | $(pwd) ${HOME} then /usr/bin && done /usr/bin
+done cd -eu $(pwd) local "$@" test $(pwd)
+		/usr/bin 'quoted text' sed 'quoted text' /usr/bin --verbose then x=1 export
+	readonly --verbose "$@" sed --verbose
+		printf 'quoted text' 'quoted text' ${HOME} sed "$@"
+	x=1 ${HOME} && "$@" $(pwd) grep awk printf ${HOME} x=1
+	| readonly 2>/dev/null export
+		--verbose "$1" printf sed cd "$@"
+		${HOME} echo x=1 ${HOME} -eu test export
+		sed then local readonly cd sed grep cd -eu awk cd && 2>/dev/null awk
+readonly local cd -eu && && "$1" grep
+		$(pwd) 2>/dev/null test 2>/dev/null $(pwd) done local "$@" done printf
+		'quoted text' $(pwd) ${HOME} export x=1 -eu ${HOME}
+	printf local "$1" then $(pwd) grep 'quoted text'
+		$(pwd) && && $(pwd) then readonly "$@"
+x=1 sed export readonly 2>/dev/null
+	local x=1 ${HOME} cd readonly local -eu awk awk "$1" printf
+	$(pwd) /usr/bin grep sed /usr/bin
+		| ${HOME} grep /usr/bin local 2>/dev/null
+echo && done cd export echo grep | export
+		"$@" /usr/bin done && 2>/dev/null
+2>/dev/null grep $(pwd) ${HOME} readonly sed awk readonly -eu &&
+export grep readonly 'quoted text'
+		local "$@" $(pwd) | export 2>/dev/null ${HOME}
+printf done echo export printf then export then awk test then "$1" 'quoted text'
+		cd ${HOME} grep grep --verbose ${HOME} 'quoted text' printf sed export printf
+	cd "$@" -eu && 2>/dev/null cd export /usr/bin grep test $(pwd) cd | cd ${HOME}
+done done ${HOME} | $(pwd) | "$@" cd --verbose ${HOME} ${HOME} test
+--verbose /usr/bin awk grep -eu grep then -eu cd sed sed printf "$@" local "$1"
+		printf 'quoted text' done 'quoted text' -eu test sed ${HOME} readonly 'quoted text'
+export awk | /usr/bin echo 'quoted text' x=1
+	2>/dev/null /usr/bin /usr/bin
+sed 'quoted text' --verbose then | test echo "$1" $(pwd) done /usr/bin
+done -eu then awk cd x=1 | /usr/bin | | done
+	&& /usr/bin sed --verbose local ${HOME}
+"$1" grep test test export export 2>/dev/null $(pwd) "$@"
+		--verbose "$1" ${HOME} cd x=1 2>/dev/null cd /usr/bin 'quoted text' /usr/bin
+	${HOME} readonly "$@" && test cd
+		"$@" --verbose | 'quoted text'
+		--verbose export then grep readonly printf 'quoted text' then 2>/dev/null
+		local && -eu export | readonly cd cd done done --verbose $(pwd) 2>/dev/null
+${HOME} then then awk ${HOME} then done done 2>/dev/null
+	grep readonly --verbose --verbose /usr/bin x=1 test test x=1 printf /usr/bin
+	then awk cd ${HOME} /usr/bin && local | export then local sed sed | export
+		readonly sed done done local local ${HOME} | 'quoted text'
+	"$@" echo --verbose cd sed then awk 2>/dev/null grep echo
+		"$1" printf local awk awk echo sed sed "$1" local sed "$@"
+	grep --verbose 2>/dev/null 'quoted text' echo
+-eu "$@" echo awk ${HOME} printf
+		$(pwd) x=1 -eu awk printf then /usr/bin
+-eu "$1" && local export awk "$@" -eu awk readonly
+	local sed cd | 2>/dev/null then
+		"$@" done x=1 grep readonly /usr/bin --verbose
+"$1" $(pwd) "$@" 2>/dev/null $(pwd) --verbose sed /usr/bin
+	"$@" 2>/dev/null $(pwd) && ${HOME} grep test grep done
+then x=1 sed local readonly readonly
+awk readonly /usr/bin x=1 'quoted text' ${HOME} | /usr/bin test
+	readonly x=1 sed /usr/bin
+	"$1" "$1" export printf done --verbose && sed done | "$1" 'quoted text' ${HOME}
+	then 'quoted text' done /usr/bin | 'quoted text' sed readonly done
+		"$@" | x=1 -eu grep ${HOME} x=1 --verbose x=1 test export printf export
+	--verbose sed | "$@" sed done 'quoted text'
+	local /usr/bin "$@" --verbose -eu then printf --verbose printf 'quoted text'
+awk sed sed && export /usr/bin "$@" echo sed /usr/bin awk && --verbose
+	x=1 --verbose "$@" printf awk 2>/dev/null cd "$@" /usr/bin | $(pwd)
+		sed done done grep 2>/dev/null /usr/bin "$1"
+		"$1" ${HOME} | readonly
+	test ${HOME} export printf | --verbose test -eu
+		${HOME} -eu printf then test /usr/bin $(pwd) | x=1 done ${HOME}
+	then ${HOME} grep then export export "$@" cd | /usr/bin ${HOME} "$@" --verbose
+	2>/dev/null printf --verbose "$@" | echo test cd printf "$1"
+	"$@" done --verbose export echo local cd "$1" "$1" "$@" --verbose 2>/dev/null
+		done then export sed printf /usr/bin 2>/dev/null echo $(pwd)
+	awk sed awk "$@" ${HOME} | cd 2>/dev/null local x=1 awk ${HOME} 2>/dev/null
+cd sed $(pwd) "$@" readonly printf cd 'quoted text' /usr/bin ${HOME} readonly
+	/usr/bin grep awk -eu echo then &&
+	then export x=1 sed cd "$1" done done
+		"$1" "$1" done local --verbose done sed --verbose printf "$@" printf cd --verbose
+	/usr/bin then && /usr/bin ${HOME} done awk then ${HOME} 2>/dev/null && "$1"
+	${HOME} then echo "$@" | 'quoted text'
+	"$1" done then 2>/dev/null 'quoted text' grep $(pwd) 'quoted text'
+	/usr/bin | 'quoted text' sed done 'quoted text' -eu awk 'quoted text' x=1
+export --verbose sed --verbose 2>/dev/null grep then export | x=1 "$@" | grep
+	'quoted text' sed awk grep "$@" done "$@" "$1" test done /usr/bin $(pwd)
+	&& $(pwd) x=1 test "$1" 2>/dev/null ${HOME} x=1
+	/usr/bin then readonly awk printf "$@" echo x=1 readonly export $(pwd)
+		grep export | sed echo done test awk
+		test $(pwd) x=1 cd test 'quoted text' readonly
+		"$1" local test done sed readonly sed && $(pwd) -eu /usr/bin "$@"
+		echo readonly printf | "$1" echo
+printf printf echo x=1 sed "$@"
+		local /usr/bin echo export "$1" echo done local cd readonly awk readonly test 'quoted text'
+${HOME} ${HOME} 2>/dev/null
+	cd test 2>/dev/null grep awk local | "$1" --verbose then echo "$1" 'quoted text'
+		--verbose grep --verbose "$@" cd done x=1 /usr/bin
+	x=1 "$@" test readonly export 'quoted text' |
+local readonly awk x=1 awk awk grep test 'quoted text'
+done cd "$1" $(pwd) x=1 printf cd "$@"
+		-eu "$1" done "$1" printf
+&& cd | cd 2>/dev/null /usr/bin && && ${HOME} cd local
+	x=1 cd export then | "$@" -eu ${HOME} 2>/dev/null "$@" 'quoted text' --verbose
+		"$1" ${HOME} -eu echo test 'quoted text' grep $(pwd)
+	x=1 local | cd "$@" readonly 'quoted text'
+${HOME} 2>/dev/null "$1" printf then then 2>/dev/null grep sed test
+local 'quoted text' awk sed /usr/bin export awk export | $(pwd) cd x=1 test
+	test x=1 x=1 -eu then grep readonly "$1" 2>/dev/null 'quoted text'
+		done 2>/dev/null grep echo readonly
+-eu done test /usr/bin awk export 2>/dev/null /usr/bin grep -eu "$1"
+		| -eu awk local $(pwd) readonly 'quoted text' cd "$1" 2>/dev/null x=1 local "$@"
+		'quoted text' 2>/dev/null grep 'quoted text' x=1 $(pwd) echo printf test
+-eu done test x=1 -eu echo test
+grep "$@" -eu then --verbose grep "$1" printf
+	then --verbose "$1" --verbose "$1"
+	x=1 test printf printf x=1 done && --verbose && "$1" export printf
+		| awk printf 2>/dev/null cd "$1" grep test done done 2>/dev/null
+	cd test /usr/bin "$@" -eu && grep done export $(pwd) && && ${HOME} 2>/dev/null
+cd 2>/dev/null cd 2>/dev/null export /usr/bin --verbose readonly done awk
+	'quoted text' local then test --verbose echo && "$@"
+		export done "$1" echo readonly --verbose
+		2>/dev/null x=1 /usr/bin 'quoted text'
+	--verbose grep | "$1" 'quoted text' sed -eu ${HOME} 'quoted text' -eu
+	&& done export 2>/dev/null --verbose export "$@" readonly 'quoted text' "$@" readonly
+		export readonly readonly "$@" /usr/bin export --verbose cd export
+/usr/bin ${HOME} ${HOME} | sed $(pwd) $(pwd) $(pwd) x=1 awk --verbose 'quoted text'
+		x=1 printf done export
+		grep done cd cd $(pwd) export
+${HOME} -eu 2>/dev/null export
+	sed ${HOME} /usr/bin -eu sed done --verbose
+		printf awk 'quoted text' --verbose /usr/bin then "$1" then "$@" sed | | local
+cd printf sed done done 2>/dev/null -eu 2>/dev/null
+	--verbose grep export cd && done test "$@" 'quoted text'
+grep awk "$1" && local export echo "$1" "$1"
+"$@" && "$1" x=1 echo --verbose done done x=1 --verbose $(pwd) printf "$@"
+done && awk | --verbose awk -eu --verbose readonly "$@" 2>/dev/null then
+		${HOME} then 'quoted text' | grep /usr/bin "$1" readonly && --verbose "$1" /usr/bin
+&& awk test sed 2>/dev/null
+	then -eu awk sed readonly sed 2>/dev/null readonly
+	echo readonly --verbose local && readonly printf "$@" local && sed local
+${HOME} echo -eu printf
+&& 'quoted text' ${HOME} done | ${HOME} done ${HOME} /usr/bin awk 2>/dev/null
+	"$@" grep "$1" x=1 cd $(pwd) &&
+printf $(pwd) 'quoted text' cd done ${HOME} "$@" "$1" sed ${HOME} ${HOME}
+--verbose done 'quoted text' done then "$1" /usr/bin ${HOME}
+	done | "$@" && awk sed x=1 --verbose test cd 'quoted text' echo sed printf readonly
+'quoted text' 'quoted text' 'quoted text'
+		test && 'quoted text' 2>/dev/null 2>/dev/null -eu echo
+	export grep "$@" done ${HOME} then done grep
+	x=1 then $(pwd) export /usr/bin 2>/dev/null "$1" grep 'quoted text'
+-eu x=1 "$1" /usr/bin grep -eu done | sed /usr/bin $(pwd) 2>/dev/null "$1"
+	grep local -eu | awk
+		sed "$@" "$1" grep echo sed /usr/bin 'quoted text' 'quoted text' "$@" ${HOME}
+	| 'quoted text' "$@" sed done sed x=1 test sed | sed printf | "$@" -eu cd
+	sed echo export -eu awk ${HOME} cd && printf ${HOME} printf ${HOME} grep
+	/usr/bin 'quoted text' 'quoted text'
+	2>/dev/null | 2>/dev/null sed
+	grep test awk "$1" "$1" 2>/dev/null x=1 test printf readonly
+| 'quoted text' --verbose 'quoted text' | done then sed done
+	"$1" && done echo | test "$@" echo $(pwd) printf printf local /usr/bin
+	export 2>/dev/null 2>/dev/null ${HOME} export export
+		$(pwd) export 2>/dev/null && sed /usr/bin $(pwd)
+		-eu "$@" | echo 'quoted text'
+--verbose echo ${HOME} then ${HOME}
+	"$@" | test 2>/dev/null x=1 local awk done "$1" 'quoted text'
+		printf && done local $(pwd) cd cd -eu x=1 "$1" then echo x=1 local local sed grep
+"$@" && printf x=1 printf
+		done /usr/bin /usr/bin grep x=1 |
+	printf awk local cd 2>/dev/null /usr/bin grep /usr/bin local | then
+		grep 2>/dev/null sed --verbose
+		'quoted text' printf echo $(pwd) $(pwd) "$@"
+		awk x=1 && -eu export export then --verbose
+	cd /usr/bin awk cd "$1" export done
+export printf then ${HOME} test | echo $(pwd) local && | printf grep "$@"
+	test 2>/dev/null --verbose /usr/bin
+	-eu -eu ${HOME} printf | grep 'quoted text' "$1" "$@" readonly
+2>/dev/null ${HOME} "$@" ${HOME} printf test /usr/bin "$@"
+2>/dev/null echo echo --verbose
+local echo 'quoted text' /usr/bin --verbose /usr/bin "$@" cd "$@" "$@" awk sed sed
+	| done local echo readonly then export --verbose local readonly cd cd
+		done awk "$@" then $(pwd) sed 2>/dev/null awk "$@" readonly
+		$(pwd) && then -eu grep
+	&& /usr/bin x=1 'quoted text' && "$@" echo
+		readonly grep done /usr/bin "$@" cd sed export x=1 "$1" 'quoted text'
+	export -eu export export "$1" --verbose "$1" echo /usr/bin awk cd printf
+echo grep test && local ${HOME} x=1 /usr/bin printf echo | local
+		/usr/bin --verbose export -eu
+		2>/dev/null sed done local readonly 2>/dev/null test cd done -eu done
+	then test x=1 echo sed printf
+		echo test readonly done sed | sed sed
+x=1 printf "$@" readonly
+	| /usr/bin then --verbose test -eu "$@" /usr/bin -eu --verbose then grep &&
+echo -eu sed printf cd then readonly done -eu cd grep "$1" --verbose
+	"$@" ${HOME} /usr/bin x=1 'quoted text' test
+		x=1 --verbose cd awk printf printf "$@" | done readonly
+	-eu echo readonly done readonly
+		done 'quoted text' 'quoted text' test readonly readonly sed ${HOME} "$1" "$1"
+		grep "$@" sed awk --verbose printf awk test cd test $(pwd) 'quoted text'
+2>/dev/null && done x=1 test grep $(pwd)
+	-eu && "$1" "$@" then "$1" echo cd echo then readonly $(pwd)
+		'quoted text' "$@" && -eu "$@" grep -eu |
+local readonly echo local sed readonly done cd ${HOME} grep 'quoted text'
+		| | $(pwd) && && 2>/dev/null "$@" /usr/bin && printf printf
+printf then "$@" cd --verbose "$1" && then 'quoted text'
+	&& cd $(pwd) readonly readonly --verbose
+sed x=1 grep test -eu printf then 'quoted text' ${HOME} -eu 'quoted text' echo
+then 2>/dev/null test export
+		readonly $(pwd) done ${HOME}
+	'quoted text' sed done awk -eu 'quoted text'
+		then sed readonly 2>/dev/null
+		"$1" x=1 readonly --verbose cd /usr/bin grep 'quoted text'
+		-eu awk cd ${HOME} printf
+		done done grep then 2>/dev/null
+2>/dev/null "$1" "$@" "$@" /usr/bin test "$@" && echo 2>/dev/null
+$(pwd) echo printf done cd ${HOME} cd done "$@" "$1" echo sed
+export awk $(pwd) test grep sed grep export && $(pwd)
+		-eu ${HOME} local $(pwd) export x=1 $(pwd) "$1"
+		printf && --verbose $(pwd) local printf | local done sed "$@"
+$(pwd) printf cd awk --verbose /usr/bin cd && cd -eu export x=1 x=1 test
+		echo then /usr/bin /usr/bin /usr/bin echo cd -eu "$@" printf x=1 && && done
+&& $(pwd) ${HOME} | x=1 x=1 --verbose cd readonly export test /usr/bin echo local
+		awk test "$@" test 2>/dev/null && local "$@" x=1 && ${HOME} 2>/dev/null then then
+		sed export cd then then 'quoted text' 2>/dev/null export readonly test $(pwd)
+	"$1" && 'quoted text' test readonly "$@"
+	$(pwd) readonly then |
+cd $(pwd) /usr/bin $(pwd) $(pwd) done ${HOME} echo
+	cd then done 2>/dev/null grep | /usr/bin
+		"$1" sed | --verbose test local grep 2>/dev/null local grep --verbose printf
+	"$@" then cd echo readonly
+		grep printf --verbose test
+grep then awk sed then
+-eu --verbose -eu printf -eu | local 2>/dev/null
+local -eu 2>/dev/null /usr/bin export --verbose readonly /usr/bin
+2>/dev/null ${HOME} then sed printf "$1" grep "$@" "$1"
+		cd "$@" export done export sed echo done "$1"
+		$(pwd) sed "$1" 'quoted text' --verbose done awk cd -eu readonly
+		done x=1 echo --verbose /usr/bin /usr/bin && 'quoted text' done printf
+		done awk x=1 test "$1" 2>/dev/null printf local && printf
+then then x=1 2>/dev/null echo local "$1" 'quoted text'
+		printf 2>/dev/null sed local echo 2>/dev/null grep grep test 'quoted text' grep
+		printf grep --verbose $(pwd) "$1"
+	local echo printf ${HOME} grep --verbose x=1 then
+		x=1 sed export awk done done sed local && cd /usr/bin awk test --verbose "$@" export
+	cd /usr/bin printf --verbose local -eu && printf
+export test printf 2>/dev/null sed ${HOME} done
+		/usr/bin sed grep done cd grep ${HOME} test awk --verbose export $(pwd) local
+	test export "$@" 'quoted text' then | test
+	done readonly sed sed "$1" ${HOME} "$1" echo && --verbose
+&& ${HOME} cd 'quoted text' echo sed 2>/dev/null export /usr/bin test "$1" local
+readonly "$1" then readonly export | local sed "$@" /usr/bin local
+		$(pwd) "$1" 2>/dev/null cd "$1" readonly $(pwd) grep && ${HOME}
+		cd /usr/bin --verbose &&
+	| | cd ${HOME} export readonly x=1 cd readonly test cd |
+-eu then 2>/dev/null ${HOME} printf then | 2>/dev/null export
+2>/dev/null test "$@" -eu done $(pwd) local
+	done "$@" printf && x=1 test -eu readonly test cd printf test done done ${HOME}
+	-eu "$@" $(pwd) "$1" 'quoted text' | /usr/bin "$1" -eu -eu | grep &&
+	done awk sed "$@" /usr/bin | && $(pwd) done sed 2>/dev/null grep x=1 | readonly
+		"$@" "$1" test sed ${HOME}
+${HOME} then cd "$1" echo printf done test awk test sed awk done cd 2>/dev/null
+sed done ${HOME} 'quoted text' | 'quoted text'
+		readonly export sed "$@"
+	'quoted text' "$1" sed --verbose
+	readonly 'quoted text' "$1" test /usr/bin local --verbose "$1" "$1"
+$(pwd) test printf 2>/dev/null $(pwd) ${HOME} x=1 done awk sed x=1 then
+	export ${HOME} $(pwd) --verbose echo done echo | /usr/bin then | 'quoted text'
+	| "$1" "$@" readonly test cd done grep "$1" "$@" printf && x=1 /usr/bin
+	export -eu | export done 2>/dev/null
+readonly local export local echo
+done 'quoted text' readonly cd test done grep
+/usr/bin local test -eu $(pwd) x=1 local 'quoted text'
+		awk $(pwd) /usr/bin readonly | $(pwd) printf test echo
+		sed 'quoted text' done
+	${HOME} done 2>/dev/null 'quoted text'
+&& -eu printf local "$@" then 'quoted text' grep cd
+/usr/bin "$1" && x=1 2>/dev/null cd ${HOME} sed awk "$1" printf "$@" 2>/dev/null
+	"$1" readonly ${HOME} 'quoted text' $(pwd) 'quoted text' then awk 2>/dev/null
+x=1 "$1" awk "$1" --verbose local --verbose
+	x=1 readonly local $(pwd) local ${HOME}
+		grep awk printf "$1" export readonly
+	local local local awk -eu export -eu sed 'quoted text' 2>/dev/null "$@"
+		"$1" "$@" "$1" readonly -eu grep local cd "$@" grep "$1" then readonly cd -eu
+		test cd printf ${HOME} done then printf echo echo then
+test /usr/bin -eu local "$1"
+		"$@" 'quoted text' --verbose
+		${HOME} cd $(pwd) readonly printf sed -eu -eu then
+		&& test printf cd echo
+		readonly "$@" x=1 echo x=1 ${HOME}
+	sed $(pwd) grep && 2>/dev/null echo --verbose ${HOME} 'quoted text'
+| sed | | && 'quoted text' -eu local $(pwd) printf local --verbose
+		$(pwd) ${HOME} 2>/dev/null printf 'quoted text'
+	/usr/bin 'quoted text' local awk
+done printf ${HOME} | $(pwd) x=1 'quoted text'
+	echo test 'quoted text' test x=1 export test && "$@"
+	--verbose grep local 2>/dev/null "$@" printf
+	${HOME} | x=1 printf echo $(pwd)
+	printf awk $(pwd) printf 'quoted text' ${HOME}
+	local ${HOME} cd -eu echo -eu echo echo
+	| readonly 2>/dev/null |
+		| printf "$1" /usr/bin awk echo "$@" cd awk then x=1 sed --verbose local local grep
+		awk test then grep cd /usr/bin | readonly then | readonly grep done
+	export awk $(pwd) "$@" echo && /usr/bin | local 'quoted text'
+	done export awk ${HOME} && x=1 sed grep printf readonly "$@" printf
+local "$@" sed 'quoted text'
+readonly --verbose "$1" echo done printf test then export echo x=1 && echo
+$(pwd) /usr/bin export done x=1 readonly
+		then printf echo done && printf 'quoted text' $(pwd) $(pwd) 'quoted text'
+		--verbose test x=1 done test
+--verbose "$1" printf readonly cd cd --verbose then
+		x=1 --verbose sed awk local echo "$@" then $(pwd) ${HOME} x=1 && readonly
+&& test readonly export awk -eu x=1 cd
+	$(pwd) && ${HOME} done local $(pwd) --verbose export ${HOME}
+'quoted text' cd | test test echo export
+		| $(pwd) echo -eu cd 2>/dev/null -eu readonly | readonly done
+		cd "$1" export --verbose printf 'quoted text' "$1" awk "$1" echo
+	grep printf /usr/bin printf -eu echo awk
+	cd echo x=1 awk local test x=1 printf grep 2>/dev/null readonly done export
+	done echo echo echo "$@" "$@" local cd awk
+&& 'quoted text' echo done echo export $(pwd) printf
+	grep done $(pwd) -eu -eu readonly "$1" 2>/dev/null export cd -eu readonly
+	awk readonly && "$1" cd export grep awk "$1" 2>/dev/null
+	awk readonly -eu done /usr/bin
+x=1 /usr/bin x=1 export test readonly $(pwd) echo export 2>/dev/null cd
+		echo "$@" | sed done ${HOME} printf echo /usr/bin
+2>/dev/null then grep grep -eu /usr/bin
+		done sed "$@" && readonly export echo 'quoted text' 2>/dev/null export
+echo export printf x=1 "$1" then
+	readonly x=1 -eu echo "$1" awk
+	sed test printf $(pwd) $(pwd) sed grep sed export | "$1" "$1" cd
+		&& 'quoted text' $(pwd) /usr/bin export ${HOME} test done
+		2>/dev/null x=1 "$@" export echo awk "$1" "$1" readonly then
+		then && | "$1" --verbose sed ${HOME} done | export | test readonly "$@"
+		readonly ${HOME} ${HOME} cd then sed local && --verbose --verbose
+		$(pwd) awk grep /usr/bin then test --verbose sed echo awk | 'quoted text'
+		&& awk 2>/dev/null echo printf grep $(pwd) done ${HOME} -eu local local | /usr/bin
+	local $(pwd) $(pwd) test cd -eu ${HOME}
+		printf 'quoted text' echo 2>/dev/null
+		${HOME} grep && cd "$1" printf
+awk echo cd "$@" done test done $(pwd) test ${HOME}
+		export $(pwd) /usr/bin | && sed 'quoted text' local readonly
+		2>/dev/null local cd done
+"$@" printf printf | 2>/dev/null printf 2>/dev/null
+		"$1" -eu && local sed echo |
+	| then sed -eu $(pwd) ${HOME}
+	export | echo /usr/bin $(pwd) awk $(pwd) grep 2>/dev/null
+${HOME} grep test export 2>/dev/null cd local &&
+	-eu | 'quoted text' | readonly
+	done --verbose export grep awk test && local readonly local "$@" x=1
+		2>/dev/null | readonly "$1" cd x=1 sed --verbose
+	-eu && export cd x=1 printf
+	2>/dev/null local export "$@" $(pwd)
+		echo local export /usr/bin then
+		done awk done --verbose /usr/bin export "$@" && then "$@" export awk ${HOME}
+	$(pwd) "$@" 'quoted text' -eu done grep test --verbose local
+	readonly --verbose x=1 then sed grep && done 2>/dev/null
+		awk "$1" local 'quoted text' 2>/dev/null done 2>/dev/null x=1 sed sed ${HOME}
+		2>/dev/null cd 'quoted text' grep then 'quoted text' 'quoted text' grep cd
+	$(pwd) $(pwd) done /usr/bin then "$@" 'quoted text' export local
+test grep done | 'quoted text' echo 2>/dev/null
+	| /usr/bin x=1 --verbose test test
+'quoted text' /usr/bin 'quoted text' cd $(pwd) grep "$1"
+		test printf export export -eu $(pwd) $(pwd) grep $(pwd) x=1 'quoted text'
+	${HOME} "$1" then -eu $(pwd) then 'quoted text' 2>/dev/null export
+	$(pwd) sed x=1 test then
+	echo "$1" $(pwd) x=1 "$1" -eu "$1" -eu readonly awk done awk
+		echo export cd sed /usr/bin $(pwd)
+sed local 2>/dev/null x=1 'quoted text' then
+then && $(pwd) -eu done /usr/bin
+	cd x=1 -eu test grep echo x=1 cd 'quoted text' 2>/dev/null &&
+		then --verbose 2>/dev/null grep done | local x=1 --verbose "$@" --verbose awk /usr/bin
+	x=1 echo awk "$@" then local -eu export /usr/bin
+	then sed "$@" --verbose "$@"
+awk ${HOME} "$1" "$@" $(pwd) && && --verbose
+"$@" ${HOME} export /usr/bin
+	/usr/bin then export export
+	local | readonly $(pwd)
+	/usr/bin then sed $(pwd) -eu
+done 2>/dev/null -eu readonly | "$@" -eu && then "$@" readonly sed && then
+then x=1 -eu local "$@" done done printf 'quoted text'
+	--verbose printf ${HOME} cd && local printf
+		export readonly done $(pwd) test -eu awk test awk test sed
+	'quoted text' 'quoted text' | "$@" export grep 'quoted text'
+	then sed done export printf "$@" | $(pwd) grep echo
+	local then printf -eu awk && echo sed 'quoted text'
+	"$1" printf "$@" echo | | awk | export --verbose x=1 echo sed done
+	export export echo 2>/dev/null then "$@"
+	| && /usr/bin sed test local
+/usr/bin done ${HOME} cd $(pwd) test -eu export then --verbose --verbose
+readonly -eu sed then &&
+grep cd $(pwd) --verbose 2>/dev/null grep "$1" export | sed && then
+		'quoted text' && test local awk
+		then sed done then awk -eu cd
+local ${HOME} sed /usr/bin $(pwd) done sed readonly readonly readonly x=1 "$1"
+then sed 'quoted text' cd 'quoted text'
+		readonly awk cd done awk ${HOME} && --verbose
+export && awk | test export cd printf -eu awk --verbose
+	"$1" $(pwd) test x=1 ${HOME} then && | x=1 echo awk echo awk export test
+	local "$1" x=1 then -eu ${HOME}
+x=1 | | test then export --verbose
+	-eu sed cd "$@" cd $(pwd) echo
+readonly --verbose readonly | then sed /usr/bin cd 'quoted text'
+		local 'quoted text' -eu
+		${HOME} awk "$@" | export
+	cd readonly "$@" 'quoted text' export x=1 done -eu printf && sed ${HOME} cd &&
+		"$1" $(pwd) cd "$@" /usr/bin $(pwd) /usr/bin --verbose local then
+sed printf "$1" test readonly readonly
+	| export test test grep grep local && | export ${HOME} && ${HOME} readonly
+	sed "$@" | --verbose cd "$1" then done "$@"
+	sed 2>/dev/null then "$1" sed cd x=1 x=1 -eu
+		--verbose echo 'quoted text' | /usr/bin
+	&& awk | && printf cd ${HOME} cd 'quoted text' then cd ${HOME}
+	x=1 --verbose | readonly /usr/bin echo export && 'quoted text' printf awk export
+	test readonly $(pwd) cd x=1 echo | 'quoted text'
+	echo cd 2>/dev/null printf /usr/bin
+	${HOME} cd echo then /usr/bin
+'quoted text' ${HOME} -eu
+awk printf x=1 local export sed 2>/dev/null grep
+	'quoted text' -eu "$1" export printf export
+	then -eu -eu export sed 2>/dev/null
+		cd | echo x=1 readonly $(pwd) | 'quoted text' printf
+&& local readonly 'quoted text'
+x=1 && done awk ${HOME} local echo ${HOME} &&
+	printf 'quoted text' cd then "$@" --verbose cd $(pwd) export $(pwd) "$@" "$1" grep
+	x=1 export then then x=1 readonly
+	&& "$@" local ${HOME} x=1 x=1 "$@" then
+		--verbose | -eu ${HOME} printf local 2>/dev/null | test done
+	cd grep 2>/dev/null sed readonly "$1" /usr/bin "$1"
+		-eu done ${HOME} printf cd && 'quoted text'
+	then grep awk done /usr/bin grep x=1 /usr/bin done -eu local export
+		'quoted text' readonly echo 'quoted text' && $(pwd) x=1 awk grep
+readonly printf done readonly --verbose then 2>/dev/null 'quoted text' readonly
+		${HOME} ${HOME} printf grep grep $(pwd) cd sed echo export done then then
+	done cd export echo x=1 x=1 printf grep -eu export /usr/bin
+		'quoted text' $(pwd) && echo -eu local ${HOME} "$1" printf
+	awk local --verbose done x=1 $(pwd) then test 'quoted text' && test "$@" --verbose
+'quoted text' printf && grep -eu "$@" sed sed awk cd export readonly
+		export 2>/dev/null ${HOME} sed awk echo test /usr/bin
+	sed printf then $(pwd) done
+	| -eu "$1" export "$@" "$@" && grep
+readonly $(pwd) printf -eu $(pwd) "$1" && sed
+"$@" 'quoted text' /usr/bin awk "$1"
+	"$@" x=1 printf ${HOME} /usr/bin grep /usr/bin /usr/bin test /usr/bin
+2>/dev/null then readonly 2>/dev/null echo $(pwd) --verbose
+	echo x=1 ${HOME} echo grep "$1" -eu ${HOME} $(pwd)
+done 2>/dev/null | --verbose printf "$@" readonly done 'quoted text' readonly
+	"$1" cd awk && /usr/bin $(pwd)
+"$1" export 2>/dev/null && awk 'quoted text' printf readonly then && then done
+	--verbose ${HOME} cd local && done awk && "$1" sed awk sed $(pwd)
+	"$@" && export done /usr/bin $(pwd) "$@" --verbose
+echo 'quoted text' x=1 && && "$@" 'quoted text' $(pwd) export
+${HOME} | $(pwd) $(pwd) sed grep echo
+		done -eu echo cd export $(pwd)
+		/usr/bin 2>/dev/null then test echo printf awk printf
+	-eu done grep "$@" local printf
+readonly -eu ${HOME} /usr/bin
+		readonly -eu awk "$1" 'quoted text' local
+cd "$1" -eu test awk done | -eu export && "$@" ${HOME} done $(pwd) export export
+echo cd test readonly echo sed 2>/dev/null 'quoted text' &&
+		sed && "$1" cd then $(pwd) test grep
+--verbose sed grep "$1" 2>/dev/null
+	| done 2>/dev/null 'quoted text' awk readonly export
+awk echo grep 2>/dev/null then 2>/dev/null then printf && printf test readonly "$@"
+		export printf "$1" "$1" then $(pwd) $(pwd) /usr/bin -eu 'quoted text' 2>/dev/null
+local "$1" 'quoted text' 'quoted text' "$@" test $(pwd)
+local "$@" readonly awk --verbose
+export && export $(pwd) test grep sed printf | export
+		echo | && -eu && printf test "$1" 2>/dev/null 2>/dev/null
+		2>/dev/null then readonly 'quoted text' awk 2>/dev/null then readonly readonly
+"$1" test /usr/bin local sed local grep
+		/usr/bin export test printf export
+| grep 'quoted text' x=1 local
+	2>/dev/null --verbose x=1 readonly | && "$@"
+-eu grep ${HOME} 2>/dev/null
+	awk "$@" "$@" then cd $(pwd) "$1" then /usr/bin
+	&& "$@" readonly | export && cd
+grep | --verbose 2>/dev/null cd then
+		readonly sed printf && local then | | printf sed "$@"
+printf 'quoted text' test "$@" then printf grep readonly x=1 then echo
+cd export "$1" $(pwd) readonly grep grep local
+		test printf cd | grep 2>/dev/null cd sed grep
+		then grep grep $(pwd) --verbose x=1 test
+		awk printf /usr/bin local printf local done local then
+	readonly then /usr/bin export 'quoted text' x=1 sed /usr/bin
+${HOME} "$@" echo sed printf grep ${HOME} $(pwd) 2>/dev/null x=1
+"$1" sed | sed 2>/dev/null -eu echo "$@" echo ${HOME} ${HOME}
+then sed x=1 "$@" 2>/dev/null "$@" ${HOME} readonly
+	echo | -eu -eu readonly sed
+	| ${HOME} 'quoted text' readonly
+		then | /usr/bin 'quoted text'
+		test local test grep export "$1" ${HOME} "$1" /usr/bin
+		test cd "$@" sed | printf && test "$1" awk -eu $(pwd) ${HOME} 2>/dev/null
+cd && /usr/bin sed readonly
+sed grep /usr/bin echo awk -eu printf 2>/dev/null x=1 done ${HOME} cd
+	readonly grep test ${HOME} readonly
+	2>/dev/null readonly ${HOME} awk /usr/bin echo then grep $(pwd) echo |
+	2>/dev/null test echo export | | readonly cd grep
+| 'quoted text' --verbose /usr/bin "$@" done echo grep echo "$1" grep && 2>/dev/null
+echo echo printf then x=1 | x=1 "$1" $(pwd) echo /usr/bin awk awk 'quoted text'
+		/usr/bin | grep grep cd $(pwd) sed echo "$1" 'quoted text' then | x=1 local
+	${HOME} $(pwd) then | local && 2>/dev/null -eu export "$1" done
+cd local | 'quoted text' grep
+test && 'quoted text' "$1" | $(pwd) "$@" /usr/bin $(pwd) cd printf
+	x=1 export x=1 -eu awk "$@" printf /usr/bin echo done 'quoted text'
+echo cd "$@" cd cd export /usr/bin export local
+		| --verbose echo && --verbose echo echo sed /usr/bin printf
+		'quoted text' done grep
+		local ${HOME} -eu | --verbose local | | $(pwd)
+		echo --verbose cd "$1" sed -eu then export
+"$@" | $(pwd) ${HOME} -eu echo export 2>/dev/null awk && "$1"
+	echo 'quoted text' x=1 && "$@" 2>/dev/null "$1" printf --verbose cd 'quoted text'
+	test local x=1 local | | ${HOME} cd local -eu local cd test | 'quoted text'
+$(pwd) sed 'quoted text' x=1 'quoted text' done $(pwd)
+'quoted text' sed ${HOME} export ${HOME} awk 2>/dev/null sed "$1" local
+&& -eu 'quoted text' /usr/bin "$@" export
+		test echo printf | cd ${HOME} --verbose echo printf awk test --verbose
+printf x=1 'quoted text' echo awk echo ${HOME} grep grep
+awk 'quoted text' 2>/dev/null "$@" ${HOME} test -eu printf then
+awk -eu $(pwd) sed && readonly readonly "$@" | readonly
+		| "$1" local grep echo readonly cd sed awk awk sed test && sed awk done export
+		-eu && 2>/dev/null x=1 awk done test grep local export 'quoted text' 'quoted text'
+"$@" "$1" "$1" test $(pwd) cd && /usr/bin
+	"$@" 2>/dev/null done 'quoted text' cd $(pwd) -eu
+	printf -eu grep export done && echo $(pwd) then echo |
+--verbose then $(pwd) x=1 awk "$1" echo "$1" grep printf -eu 'quoted text'
+		&& --verbose $(pwd) export readonly export 'quoted text'
+		--verbose sed && 'quoted text' -eu "$1" sed export "$@" $(pwd) -eu done "$@"
+	'quoted text' $(pwd) echo
+		--verbose $(pwd) echo ${HOME} 2>/dev/null
+		done grep test readonly cd $(pwd) 2>/dev/null $(pwd) sed sed grep | && x=1 --verbose
+	done 'quoted text' sed ${HOME} 2>/dev/null x=1 echo /usr/bin
+		readonly test "$1" x=1 local --verbose "$1"
+	--verbose then "$@" -eu | cd x=1 | && awk x=1 export done test x=1 test -eu echo
+		then export local printf cd grep "$1" | 2>/dev/null && 2>/dev/null
+${HOME} x=1 grep 'quoted text' local done 2>/dev/null
+	| 2>/dev/null grep | $(pwd)
+		sed test cd echo local
+sed grep test && printf $(pwd) 'quoted text' test test && then "$1" "$@"
+		grep 2>/dev/null done then /usr/bin 2>/dev/null --verbose
+	echo --verbose test -eu ${HOME} /usr/bin "$1" sed | export /usr/bin readonly
+	echo 'quoted text' test cd 'quoted text' export && 'quoted text'
+sed ${HOME} sed local "$@" "$1" $(pwd) 'quoted text'
+		2>/dev/null && awk done 'quoted text' | readonly | awk echo 'quoted text'
+	local test sed -eu printf
+"$@" $(pwd) 'quoted text' --verbose -eu
+	&& ${HOME} readonly printf export x=1 sed "$@" /usr/bin awk readonly
+		"$@" "$1" x=1 --verbose --verbose "$1" --verbose test
+		x=1 | 2>/dev/null sed then "$1" $(pwd) cd
+	"$1" printf "$@" test echo
+	local then echo "$@" cd grep
+		done sed readonly | && -eu 'quoted text' 'quoted text'
+cd readonly then ${HOME}
+	'quoted text' done done done "$@" "$1" export "$@" export
+		awk x=1 done then ${HOME} 'quoted text'
+readonly "$@" -eu export cd test -eu && awk echo echo | test && grep
+	-eu test ${HOME} x=1 ${HOME} done local printf awk done 2>/dev/null
+		x=1 && -eu $(pwd) sed "$@" 2>/dev/null done
+		grep test awk sed echo "$@" sed sed then awk test then printf done test -eu x=1
+		grep grep done grep --verbose -eu
+		awk cd readonly x=1 "$@" x=1 awk
+		test local awk local && "$1" /usr/bin
+done test then cd "$1" echo --verbose local 'quoted text' printf --verbose -eu
+		local export 'quoted text' x=1 | readonly && awk -eu test cd
+		sed | ${HOME} "$@" && cd done export sed test grep
+	2>/dev/null "$1" export "$1" --verbose "$1" 'quoted text' "$@" "$1"
+done local readonly ${HOME} export readonly
+	readonly /usr/bin 'quoted text' ${HOME} printf x=1 done
+	sed cd then $(pwd) echo readonly
+	then printf export printf 2>/dev/null awk && 2>/dev/null x=1 then local
+		"$1" ${HOME} echo readonly 2>/dev/null | sed printf test test $(pwd) 'quoted text'
+cd local export 'quoted text' x=1 2>/dev/null readonly cd $(pwd) then
+--verbose printf then grep && && local test --verbose
+	"$1" printf cd echo local $(pwd)
+		sed printf 2>/dev/null test test -eu echo printf export --verbose | | export
+printf ${HOME} readonly
+-eu sed --verbose "$1" export /usr/bin printf
+	test sed printf "$@" "$1"
+	awk 2>/dev/null cd "$1"
+sed x=1 ${HOME} | "$@" sed export 'quoted text' $(pwd)
+	/usr/bin "$1" /usr/bin readonly then "$1" sed ${HOME} printf local
+		'quoted text' x=1 local grep x=1 sed awk echo | awk cd "$1" local sed
+	done /usr/bin $(pwd) 'quoted text' then
+	&& sed awk ${HOME} --verbose export 2>/dev/null && echo
+x=1 echo grep cd export &&
+		--verbose && export export "$@" | export echo "$@" local readonly
+echo test --verbose | done readonly 2>/dev/null /usr/bin export
+		${HOME} ${HOME} /usr/bin
+-eu -eu test x=1 cd /usr/bin $(pwd) /usr/bin x=1
+		"$1" then printf printf && export done test | cd grep && 2>/dev/null export
+		export then x=1 done awk cd | && && /usr/bin readonly awk $(pwd) x=1 awk 2>/dev/null
+sed printf /usr/bin 'quoted text' done && then done 2>/dev/null
+	readonly -eu readonly | done "$1" 2>/dev/null printf "$1" sed
+done 'quoted text' cd sed done echo "$1"
+		echo 'quoted text' readonly 2>/dev/null 2>/dev/null ${HOME}
+	${HOME} "$1" && cd && then printf grep && readonly
+	sed /usr/bin readonly $(pwd) "$1" 'quoted text' --verbose
+export then export --verbose 2>/dev/null sed $(pwd) export
+cd echo echo "$1" readonly grep --verbose /usr/bin x=1 export
+	readonly echo grep $(pwd) then ${HOME} 2>/dev/null
+	local echo readonly x=1 printf awk echo 2>/dev/null "$@" grep x=1 printf "$@"
+		echo "$1" && test -eu awk ${HOME} | printf readonly "$1" 2>/dev/null
+cd x=1 $(pwd) printf $(pwd) readonly 'quoted text'
+	printf | done cd /usr/bin "$1" /usr/bin
+		readonly cd readonly && printf 2>/dev/null local x=1 "$@" sed x=1 printf ${HOME}
+		printf ${HOME} && | x=1 sed local -eu grep
+	done 2>/dev/null readonly readonly /usr/bin sed ${HOME} cd /usr/bin
+done sed readonly $(pwd) readonly && export test ${HOME}
+		"$@" x=1 export -eu echo echo /usr/bin cd readonly
+	/usr/bin done 2>/dev/null
+		readonly $(pwd) echo | 2>/dev/null local 2>/dev/null readonly cd "$1"
+		'quoted text' $(pwd) -eu 'quoted text' x=1 $(pwd) echo
+		'quoted text' awk --verbose 2>/dev/null "$@" then --verbose printf
+	test then sed ${HOME} "$@"
+'quoted text' ${HOME} readonly
+		readonly test --verbose x=1 printf
+-eu "$1" then awk 2>/dev/null then $(pwd) | cd sed then then
+		x=1 | done echo sed grep $(pwd) sed cd echo printf
+	'quoted text' cd printf x=1 /usr/bin cd local x=1 2>/dev/null && | local 2>/dev/null
+		-eu ${HOME} 2>/dev/null printf && echo "$1" done sed echo 2>/dev/null echo
+		then $(pwd) "$@" "$@" then printf "$@" $(pwd)
+	grep ${HOME} cd echo $(pwd) | then export then x=1
+local grep 'quoted text' "$@" test awk local echo -eu "$1" awk "$@" && local
+	"$1" export --verbose 2>/dev/null then cd awk
+done then /usr/bin export x=1 then && grep awk "$1" cd
+	local $(pwd) | printf x=1
+	grep echo readonly done "$@" 'quoted text'
+	readonly $(pwd) sed | readonly cd done 2>/dev/null
+		awk echo ${HOME} then grep cd && grep
+	'quoted text' sed 'quoted text'
+	grep "$@" ${HOME} 'quoted text' done done local 2>/dev/null | | local 2>/dev/null
+		--verbose readonly /usr/bin done ${HOME} && ${HOME} readonly 2>/dev/null
+		sed grep export && export awk && awk /usr/bin -eu then 'quoted text' --verbose
+	$(pwd) "$@" printf grep echo then | sed awk grep awk printf "$1"
+	test x=1 cd && done test /usr/bin printf
+awk export sed -eu sed sed export -eu grep local ${HOME}
+	-eu readonly done local printf then cd &&
+	echo "$1" cd cd 2>/dev/null $(pwd) --verbose "$@"
+export echo then ${HOME} echo cd awk
+2>/dev/null printf cd | --verbose | grep
+$(pwd) x=1 test "$@" then /usr/bin $(pwd)
+		'quoted text' x=1 then 'quoted text' grep grep cd printf x=1 readonly
+	'quoted text' export grep && echo ${HOME} grep printf then test then grep --verbose
+		$(pwd) grep then awk ${HOME} --verbose && sed local 2>/dev/null local -eu x=1
+2>/dev/null x=1 "$@" done sed cd
+		$(pwd) grep -eu cd 2>/dev/null && -eu readonly
+		readonly awk awk readonly local 2>/dev/null "$@" sed && x=1 -eu
+	"$@" cd export awk "$@" 2>/dev/null then done && echo
+	| export --verbose -eu then test local test cd export awk && | /usr/bin
+		$(pwd) then 2>/dev/null "$1"
+sed --verbose && readonly done /usr/bin
+'quoted text' x=1 x=1 printf readonly x=1 "$@" export x=1 sed readonly
+$(pwd) printf ${HOME} ${HOME} /usr/bin sed readonly 2>/dev/null
+	--verbose && awk ${HOME} then awk sed /usr/bin
+		then $(pwd) done awk awk -eu $(pwd) -eu awk
+'quoted text' cd $(pwd) printf printf echo
+--verbose test ${HOME} x=1 test --verbose test x=1 "$@" --verbose 'quoted text'
+	awk $(pwd) printf && done sed && $(pwd) "$@" printf
+	done sed "$@" readonly test x=1 "$@" printf "$@" sed then | && ${HOME} awk done
+cd 2>/dev/null --verbose then "$@" 2>/dev/null 2>/dev/null sed 'quoted text'
+| test "$@" --verbose readonly
+awk printf -eu test cd | 2>/dev/null then export export 'quoted text'
+test echo "$1" x=1 | echo cd done "$@" cd cd --verbose | grep
+	local && cd export "$1" awk grep -eu $(pwd) "$@" awk local sed --verbose
+&& ${HOME} --verbose done local cd "$1" test
+		&& printf readonly cd 'quoted text' awk printf test 2>/dev/null echo /usr/bin
+$(pwd) cd test cd /usr/bin sed /usr/bin "$1" readonly --verbose
+	readonly awk "$1" "$@" 'quoted text' awk test "$1" then /usr/bin --verbose
+export test then && done then ${HOME} grep readonly x=1 "$@"
+printf && then done "$@" $(pwd) "$@" | local /usr/bin x=1 'quoted text' then
+&& -eu grep sed printf --verbose --verbose "$@" "$1" $(pwd) cd /usr/bin ${HOME}
+	--verbose --verbose sed readonly -eu /usr/bin
+--verbose echo echo then readonly local "$1"
+		done && ${HOME} x=1 /usr/bin export then export grep grep |
+	grep then sed ${HOME} grep export --verbose -eu then then test awk --verbose
+-eu then /usr/bin printf
+$(pwd) then readonly readonly /usr/bin readonly printf -eu then then export
+		'quoted text' readonly "$@" readonly printf -eu -eu awk x=1 done /usr/bin
+		-eu export echo | local readonly -eu x=1 printf $(pwd) grep readonly
+		--verbose awk --verbose
+		cd 2>/dev/null /usr/bin ${HOME} sed -eu
+x=1 --verbose awk export "$@" readonly test local
+	awk $(pwd) --verbose readonly
+	-eu "$@" local | cd echo /usr/bin --verbose ${HOME} awk cd ${HOME} ${HOME} local
+		x=1 local readonly cd sed sed --verbose "$@" | readonly 2>/dev/null
+printf then sed -eu | readonly
+&& readonly echo then test echo -eu sed printf awk x=1 2>/dev/null
+	'quoted text' && local --verbose | printf --verbose
+		${HOME} then x=1 readonly ${HOME} --verbose
+		readonly awk x=1 done -eu awk x=1 && ${HOME}
+	export test export echo readonly "$@" "$@" ${HOME} done ${HOME} /usr/bin local
+	readonly 2>/dev/null test grep readonly x=1 grep "$1" ${HOME} 'quoted text'
+		cd readonly 2>/dev/null
+		test "$1" printf readonly
+-eu | readonly cd -eu 2>/dev/null && "$@" ${HOME} ${HOME} 2>/dev/null
+echo $(pwd) local export export /usr/bin
+	2>/dev/null export cd cd done
+		test --verbose sed awk | $(pwd)
+"$@" ${HOME} $(pwd) "$1" then then
+	echo ${HOME} printf 'quoted text' local done test -eu awk | local "$@" grep
+		readonly | x=1 /usr/bin readonly sed /usr/bin test $(pwd) local /usr/bin x=1 echo
+		local echo export sed cd export
+done "$@" then awk awk --verbose "$1" awk
+x=1 | done /usr/bin --verbose
+	sed echo echo sed test sed sed 2>/dev/null
+		| printf | test export "$1" -eu -eu 'quoted text' $(pwd) "$1" "$1" "$@"
+	-eu sed then awk local cd
+		x=1 done readonly sed export 2>/dev/null x=1 test | sed 2>/dev/null
+	--verbose "$1" export "$@" --verbose readonly ${HOME} grep done
+2>/dev/null 'quoted text' -eu then | cd 'quoted text' "$1"
+	readonly | "$1" readonly local --verbose grep export $(pwd) "$@" 2>/dev/null
+		printf 2>/dev/null $(pwd) 2>/dev/null
+local /usr/bin cd "$@" printf /usr/bin cd | 'quoted text' awk done echo --verbose
+$(pwd) local --verbose cd test
+		done grep ${HOME} /usr/bin cd export awk x=1 | sed $(pwd) awk local x=1
+	test "$1" "$1" sed cd then readonly
+		awk echo "$1" "$1" ${HOME} sed cd grep cd printf "$1" "$1" local readonly
+done 'quoted text' readonly && "$@" && local "$1" "$1" "$@"
+	2>/dev/null printf $(pwd) export echo 2>/dev/null
+"$1" 'quoted text' --verbose --verbose
+| readonly test | export $(pwd)
+| awk then ${HOME} local && --verbose
+	$(pwd) | "$@" "$1" echo $(pwd) -eu grep local /usr/bin "$@" sed
+| --verbose ${HOME} 'quoted text' $(pwd) cd $(pwd) sed cd
+--verbose | done 2>/dev/null printf grep --verbose
+	printf done printf "$1" /usr/bin local ${HOME} /usr/bin export
+-eu export export then awk ${HOME} 2>/dev/null
+	grep export cd 'quoted text'
+	readonly echo cd local then
+done "$@" local grep sed -eu sed cd
+sed "$1" then export --verbose echo then test test sed
+		echo "$@" grep cd test done readonly &&
+	"$@" | test "$@" printf printf /usr/bin $(pwd) grep |
+	readonly ${HOME} test readonly $(pwd)
+	'quoted text' test $(pwd) x=1 x=1 && 'quoted text' --verbose grep
+		-eu local printf local local printf --verbose printf grep cd ${HOME}
+	"$1" "$@" printf ${HOME} 'quoted text' 'quoted text'
+		cd local "$@" && readonly cd readonly cd echo 2>/dev/null export x=1 'quoted text'
+	awk --verbose --verbose
+		printf sed then local local cd readonly then echo
+	$(pwd) ${HOME} local 2>/dev/null local
+	-eu sed 'quoted text' x=1 then local
+		x=1 2>/dev/null sed "$1" 2>/dev/null | export x=1 printf echo
+	| echo done "$@" --verbose "$@" sed 'quoted text' --verbose x=1 local done
+export echo readonly $(pwd) awk && /usr/bin
+		"$@" x=1 cd printf "$@" 'quoted text' awk -eu
+		&& /usr/bin && grep -eu readonly
+	/usr/bin | done 2>/dev/null cd /usr/bin test /usr/bin
+readonly grep printf printf /usr/bin echo
+	"$@" ${HOME} printf test then |
+	x=1 "$1" sed cd printf 'quoted text'
+test "$@" x=1 then readonly
+	done readonly cd 2>/dev/null -eu && |
+	2>/dev/null readonly $(pwd) 2>/dev/null "$@" readonly
+	/usr/bin x=1 2>/dev/null echo $(pwd) ${HOME} x=1 | echo && test
+	${HOME} then cd | 'quoted text' $(pwd)
+	--verbose $(pwd) && $(pwd) --verbose 'quoted text' |
+--verbose local grep then 2>/dev/null
+		&& x=1 awk --verbose 2>/dev/null sed 2>/dev/null
+'quoted text' "$@" grep echo /usr/bin $(pwd) done cd export
+readonly | && /usr/bin x=1
+		test $(pwd) export x=1 && printf then
+	done awk 2>/dev/null "$@" && printf -eu printf readonly export -eu --verbose
+		done $(pwd) "$@" ${HOME}
+		&& x=1 "$@" 2>/dev/null cd && grep then "$@" 'quoted text' then echo cd echo $(pwd)
+	/usr/bin 'quoted text' awk 2>/dev/null
+cd local test "$1" local sed --verbose --verbose "$@"
+	| sed printf ${HOME} sed "$@" readonly local /usr/bin
+-eu /usr/bin done local readonly --verbose -eu done ${HOME} readonly 2>/dev/null
+| export sed "$@" awk x=1 'quoted text'
+	/usr/bin 2>/dev/null test --verbose
+		printf readonly -eu cd
+done then sed awk /usr/bin "$@"
+		grep cd $(pwd) then sed | /usr/bin echo export test $(pwd) "$@" readonly
+	local readonly "$1" | awk -eu then && 2>/dev/null -eu
+awk awk readonly grep readonly export 2>/dev/null readonly printf done --verbose
+"$1" 'quoted text' | "$1" then "$@" awk "$@" x=1 test
+		export export then then printf && | | local readonly
+	test test | done sed ${HOME} "$@" $(pwd) -eu ${HOME} "$@" awk
+	&& printf x=1 local && && cd --verbose $(pwd) local "$@" awk ${HOME} /usr/bin
+	2>/dev/null 2>/dev/null -eu export
+	readonly awk 2>/dev/null export done done | then printf
+		--verbose cd cd --verbose
+		export cd then x=1 -eu export
+		--verbose test 2>/dev/null echo /usr/bin $(pwd) echo 2>/dev/null $(pwd) cd
+	local cd awk readonly "$1" "$1" 'quoted text' test local -eu 2>/dev/null
+| $(pwd) | 2>/dev/null readonly
+	&& x=1 "$1" ${HOME} grep readonly "$1" printf
+| grep sed done 2>/dev/null 2>/dev/null 'quoted text'
+echo done cd "$@" 'quoted text' -eu -eu 'quoted text'
+	--verbose readonly -eu echo -eu done "$1" echo ${HOME} /usr/bin export printf
+done 2>/dev/null echo awk then then 'quoted text'
+	2>/dev/null "$@" --verbose readonly
+		-eu x=1 local grep 'quoted text' done test 'quoted text' test
+		'quoted text' echo local -eu
+	echo x=1 x=1 readonly export && -eu ${HOME} 2>/dev/null && echo readonly
+		$(pwd) | | -eu -eu x=1 grep grep done
+"$1" && sed 2>/dev/null grep /usr/bin ${HOME}
+then printf 'quoted text' "$@" test echo && cd
+-eu awk -eu /usr/bin awk --verbose "$1" && cd | done awk done $(pwd) "$@"
+		x=1 echo test $(pwd) grep $(pwd) then cd then && &&
+		"$@" "$1" | && 2>/dev/null | sed | cd
+		"$1" -eu printf "$1" x=1 'quoted text' "$@" sed readonly 'quoted text'
+"$@" -eu then | grep echo done
+2>/dev/null /usr/bin 'quoted text' echo && cd
+	then printf 'quoted text' 'quoted text'
+	"$@" then printf echo sed | 2>/dev/null && then x=1 test /usr/bin
+export test cd echo printf x=1
+	"$@" done cd -eu 2>/dev/null readonly export
+	export echo echo x=1 "$1" && ${HOME} | --verbose done x=1 && $(pwd) cd printf
+| readonly $(pwd) --verbose
+		-eu "$1" local printf sed "$1" -eu test
+awk "$1" 'quoted text' -eu export printf grep 'quoted text' readonly
+	grep $(pwd) -eu awk grep --verbose done
+		/usr/bin awk /usr/bin then echo | /usr/bin cd ${HOME} /usr/bin
+		| x=1 ${HOME} printf 2>/dev/null grep 'quoted text' grep grep
+"$1" test | 2>/dev/null test echo grep sed "$@" $(pwd)
+	local /usr/bin export $(pwd) /usr/bin -eu readonly cd readonly x=1 -eu
+		${HOME} printf echo local local x=1 readonly printf test
+grep ${HOME} then done readonly && "$1" sed test awk $(pwd)
+	| /usr/bin readonly test done | x=1
+		2>/dev/null --verbose "$1" awk 2>/dev/null --verbose ${HOME} $(pwd)
+readonly | sed | "$1" && then
+	${HOME} && grep "$1" --verbose printf local grep --verbose
+		$(pwd) 'quoted text' --verbose ${HOME} grep readonly -eu test test | export
+printf ${HOME} 'quoted text' test 2>/dev/null ${HOME}
+cd && | test then /usr/bin then cd sed
+		test echo 'quoted text' sed "$1" "$1" "$@" x=1 x=1 done
+local /usr/bin cd ${HOME} /usr/bin readonly
+		/usr/bin && "$1" grep | ${HOME}
+sed local "$@" grep then "$1" $(pwd) then local && local $(pwd) local "$@"
+	done --verbose grep local x=1 awk
+awk done cd /usr/bin grep /usr/bin awk 'quoted text' x=1 x=1 echo
+		| x=1 2>/dev/null local then local readonly "$1" x=1
+		readonly 2>/dev/null done test readonly /usr/bin --verbose grep printf cd done
+		x=1 --verbose x=1 | "$@" printf test cd -eu echo cd | echo awk x=1 $(pwd)
+		'quoted text' then 'quoted text' printf readonly then | /usr/bin && export
+	printf && -eu /usr/bin
+	/usr/bin sed done test awk /usr/bin /usr/bin cd local
+x=1 export -eu sed 'quoted text'
+	x=1 test echo /usr/bin 2>/dev/null "$1" ${HOME} test --verbose
+2>/dev/null then echo echo local $(pwd) 'quoted text' -eu 'quoted text' test
+"$1" 'quoted text' grep grep then awk --verbose done
+readonly --verbose 'quoted text' readonly $(pwd)
+		readonly ${HOME} ${HOME} done 2>/dev/null then
+readonly && awk -eu test readonly
+		printf awk 'quoted text' ${HOME}
+	-eu ${HOME} $(pwd) export export
+${HOME} export sed awk printf local export
+	x=1 "$1" "$1" 2>/dev/null /usr/bin $(pwd) "$@" test then |
+	'quoted text' readonly "$@" ${HOME}
+	${HOME} printf "$@" && readonly "$1" grep | && cd
+"$1" sed 2>/dev/null done --verbose /usr/bin /usr/bin ${HOME} 'quoted text'
+		awk "$@" printf cd local 'quoted text' $(pwd) done
+| local readonly --verbose awk sed --verbose readonly && | && readonly
+local test grep local printf sed 2>/dev/null $(pwd) x=1 grep
+awk readonly | $(pwd) grep x=1 | echo export ${HOME} "$@" 'quoted text'
+'quoted text' echo "$1" printf printf cd |
+		sed cd done 'quoted text' cd --verbose 2>/dev/null local
+&& grep 'quoted text' export x=1 cd done
+		${HOME} echo echo 'quoted text' /usr/bin 'quoted text'
+	x=1 "$@" readonly "$@" &&
+		readonly cd echo "$1" test done 'quoted text' -eu awk cd | | cd 'quoted text'
+then 2>/dev/null "$1" cd export -eu echo x=1 readonly grep
+		2>/dev/null ${HOME} sed
+echo $(pwd) test | done $(pwd) $(pwd)
+		then sed sed -eu local awk ${HOME} sed x=1 --verbose
+printf ${HOME} test test /usr/bin then -eu | then awk grep $(pwd) awk test
+		${HOME} | awk && printf echo | ${HOME} -eu readonly "$1" && -eu
+		then 'quoted text' local 'quoted text' done
+		"$1" cd then | export done | sed 'quoted text' "$@" local "$1" ${HOME}
+		readonly export readonly export --verbose echo then "$1" awk grep test
+	${HOME} test -eu | then readonly local echo readonly export
+	'quoted text' "$@" grep 'quoted text' $(pwd)
+cd && cd ${HOME} | awk test | grep | cd && | "$@" "$@"
+		"$1" $(pwd) | then then 'quoted text' done | printf ${HOME}
+	'quoted text' test && | printf
+		--verbose export 'quoted text' "$@" done local 'quoted text'
+'quoted text' "$@" /usr/bin /usr/bin echo printf 'quoted text'
+		local echo sed && && $(pwd) x=1 printf awk
+	export | -eu "$@" -eu /usr/bin echo local $(pwd) test then printf export sed
+	"$@" awk printf "$1" cd
+		sed grep then test |
+"$@" && awk then then export grep /usr/bin
+/usr/bin export && x=1 ${HOME} 2>/dev/null done
+readonly readonly 'quoted text' readonly awk then /usr/bin done then
+	$(pwd) /usr/bin $(pwd) awk cd
+	local test awk readonly awk
+	-eu sed awk echo test /usr/bin awk printf 'quoted text' $(pwd) --verbose sed
+	'quoted text' $(pwd) -eu sed echo -eu awk export sed | cd && -eu
+	&& test 2>/dev/null ${HOME} "$1" 'quoted text' -eu && "$@" printf
+		sed 2>/dev/null && export awk then test test export 'quoted text' 2>/dev/null
+'quoted text' local awk --verbose ${HOME}
+		export "$@" sed && cd 'quoted text'
+done | 'quoted text' "$@" echo local test ${HOME} echo --verbose
@@ -0,0 +1,2001 @@
+		--verbose cd -eu test grep 2>/dev/null local printf test 2>/dev/null /usr/bin
+cd printf $(pwd) 'quoted text'
+	$(pwd) && 'quoted text' echo "$1" "$1" cd x=1 then export
+		'quoted text' --verbose "$1" "$@" sed ${HOME} && then
+	--verbose -eu ${HOME} --verbose
+		'quoted text' readonly
+		| readonly echo --verbose | x=1 echo
+		sed export /usr/bin printf local grep --verbose 'quoted text' /usr/bin
+grep x=1 "$1" | printf printf "$@" grep "$@" 2>/dev/null | grep export printf
+	sed printf 2>/dev/null test "$1" x=1
+	then $(pwd) then ${HOME} /usr/bin
+		local "$@" awk ${HOME} --verbose && echo --verbose
+		echo cd -eu test readonly 2>/dev/null
+		awk printf cd x=1 cd grep "$1" x=1 echo printf --verbose /usr/bin -eu "$@" --verbose
+cd && test readonly ${HOME} sed 2>/dev/null
+	--verbose -eu local done 2>/dev/null
+"$@" done 'quoted text' export
+	&& $(pwd) --verbose sed awk /usr/bin
+		local done 2>/dev/null --verbose && echo printf
+export /usr/bin x=1 printf sed local -eu export done local -eu
+		then grep | awk test local grep
+	grep echo export "$1" "$1" $(pwd) readonly /usr/bin
+	local readonly "$@" ${HOME} "$@" $(pwd)
+		&& grep x=1 local done "$@" local | awk 2>/dev/null x=1 grep sed cd ${HOME} --verbose
+-eu /usr/bin /usr/bin then &&
+	$(pwd) grep local readonly echo printf "$1"
+		/usr/bin grep x=1 awk readonly x=1 "$1" done then $(pwd) local
+	x=1 grep export /usr/bin test && | readonly then /usr/bin -eu test
+$(pwd) && --verbose x=1 cd -eu && local 2>/dev/null 'quoted text'
+"$1" "$1" then | ${HOME} && awk --verbose "$1" && "$@"
+		2>/dev/null local && && -eu ${HOME} echo 2>/dev/null export
+		cd local $(pwd) && | && ${HOME} local grep "$@" then printf |
+export sed export sed cd sed ${HOME} ${HOME} local -eu
+/usr/bin then local sed printf x=1 local local local grep "$1"
+printf then sed ${HOME} cd local | 2>/dev/null done then cd printf
+	'quoted text' $(pwd) ${HOME}
+"$@" cd 2>/dev/null 2>/dev/null "$@" 'quoted text' ${HOME}
+		then done echo printf done grep done readonly
+	export 'quoted text' -eu awk then local
+	"$1" local done x=1 'quoted text' test --verbose
+	'quoted text' && test cd -eu echo printf then readonly
+| then then && echo then test sed -eu awk /usr/bin cd --verbose
+	'quoted text' | ${HOME} x=1
+		awk test echo printf "$1"
+	then $(pwd) local "$@" then local ${HOME}
+	x=1 "$@" grep grep done x=1 echo
+awk local awk readonly readonly
+x=1 grep awk && sed test 2>/dev/null -eu | "$@" sed
+		test readonly --verbose "$1" -eu awk printf 'quoted text' awk | &&
+	--verbose "$1" && local done 'quoted text' /usr/bin
+	export /usr/bin /usr/bin x=1 --verbose grep done x=1 then /usr/bin echo sed
+	readonly done x=1 local "$1" "$1" ${HOME} test
+		x=1 test done | grep | test export
+		$(pwd) ${HOME} grep -eu 2>/dev/null
+--verbose -eu $(pwd) $(pwd) test $(pwd) 2>/dev/null
+	readonly readonly 2>/dev/null x=1 export /usr/bin sed cd x=1 | -eu
+		readonly echo then -eu 2>/dev/null "$1" &&
+	local | | grep done test done export -eu
+		'quoted text' awk done then done export
+		readonly export readonly
+		echo x=1 echo local $(pwd) printf readonly
+${HOME} then echo sed | "$@" cd cd cd "$@" -eu x=1 done echo cd readonly
+	&& 2>/dev/null readonly readonly local sed grep
+		echo | local echo x=1 | export export readonly && echo 2>/dev/null
+2>/dev/null printf ${HOME} /usr/bin | && then && ${HOME} 'quoted text' done |
+	--verbose sed $(pwd) -eu -eu
+		${HOME} grep 2>/dev/null "$1" printf echo local printf "$@" /usr/bin local then
+		grep test readonly && awk x=1 awk --verbose x=1 readonly x=1
+		sed "$1" printf ${HOME} x=1 test readonly 'quoted text' grep awk 2>/dev/null
+awk test "$1" -eu export $(pwd) sed 2>/dev/null /usr/bin
+	local grep && "$@" "$1" sed
+	done 2>/dev/null "$@" export x=1 2>/dev/null --verbose cd echo -eu
+2>/dev/null --verbose readonly x=1 local readonly -eu test "$@" 'quoted text' --verbose
+		then "$@" readonly 2>/dev/null
+	grep 'quoted text' awk
+	x=1 grep local --verbose "$1" echo cd local && then cd echo then done
+	'quoted text' 'quoted text' 2>/dev/null
+		'quoted text' then ${HOME} test test readonly
+		done "$@" then cd --verbose local awk then | "$1" cd readonly
+		| printf local then x=1 --verbose
+printf echo $(pwd) "$1" export ${HOME} "$@"
+	then local local export --verbose
+awk export "$1" | readonly printf && cd x=1 printf printf ${HOME} "$@"
+-eu ${HOME} ${HOME} /usr/bin -eu awk cd 2>/dev/null
+	/usr/bin echo | --verbose x=1 test /usr/bin ${HOME} -eu ${HOME} printf ${HOME}
+awk x=1 $(pwd) grep --verbose readonly x=1 export x=1 grep
+	echo ${HOME} $(pwd) && "$1" | /usr/bin then done grep cd $(pwd)
+		'quoted text' done "$1" "$1" cd cd cd cd "$@" done
+		printf 2>/dev/null "$1"
+	export --verbose then /usr/bin echo --verbose grep 2>/dev/null
+done /usr/bin test /usr/bin ${HOME} local then
+		"$@" "$1" 'quoted text' && test awk sed $(pwd) then ${HOME}
+$(pwd) cd && cd --verbose -eu cd grep x=1 'quoted text' readonly
+		"$1" echo export then grep "$@" "$1" printf &&
+echo "$1" export sed $(pwd) test export
+		${HOME} echo cd | printf && --verbose
+echo echo echo $(pwd) then "$1" 2>/dev/null printf --verbose sed x=1 sed done
+	cd "$@" --verbose readonly sed --verbose echo --verbose echo 'quoted text'
+2>/dev/null readonly "$@" 2>/dev/null echo local --verbose | 'quoted text'
+sed grep export test "$@" local test awk | x=1 printf echo printf $(pwd)
+	$(pwd) ${HOME} ${HOME}
+		"$1" printf cd cd 'quoted text' then readonly
+	2>/dev/null grep -eu test readonly grep x=1 "$@" awk
+test sed echo "$1" local test x=1 done local -eu
+		echo test ${HOME} then printf done then test && 2>/dev/null
+	'quoted text' cd -eu export done x=1
+--verbose export local 2>/dev/null grep then -eu "$1" local export 'quoted text'
+		| -eu -eu 'quoted text' && ${HOME} local 2>/dev/null
+-eu readonly sed && /usr/bin $(pwd) x=1 echo done awk
+		sed test --verbose local $(pwd) echo 2>/dev/null local test 2>/dev/null
+local then $(pwd) cd ${HOME} | x=1 2>/dev/null $(pwd) ${HOME} awk x=1 test
+	'quoted text' "$1" ${HOME} then /usr/bin 2>/dev/null $(pwd)
+grep 2>/dev/null printf ${HOME} && export awk local test grep local
+		then readonly sed "$@" | $(pwd) grep
+	done awk sed "$1" grep sed "$@" done cd awk | cd 'quoted text' 2>/dev/null
+awk "$1" cd printf echo
+grep --verbose then local cd then grep grep "$1" printf && -eu test 2>/dev/null
+		readonly echo sed ${HOME} ${HOME}
+cd then -eu awk "$1" && grep
+	readonly ${HOME} awk x=1 awk test readonly x=1 x=1
+$(pwd) --verbose "$@" $(pwd) | echo echo readonly --verbose echo && $(pwd)
+		/usr/bin | /usr/bin export | grep sed grep echo cd cd done done /usr/bin 2>/dev/null
+readonly done 'quoted text' echo && done local sed | done
+		'quoted text' sed /usr/bin 'quoted text'
+$(pwd) 2>/dev/null grep x=1 --verbose "$1" done done done 'quoted text' sed | $(pwd)
+readonly awk done | test done
+		'quoted text' /usr/bin "$1" done export
+		test /usr/bin "$@" grep "$1" readonly echo awk && done /usr/bin /usr/bin
+/usr/bin | ${HOME} ${HOME} 2>/dev/null $(pwd) grep | then cd 2>/dev/null
+		local cd test ${HOME} "$@" sed
+	grep readonly | ${HOME} readonly printf readonly $(pwd)
+then readonly awk 2>/dev/null echo awk "$@" x=1 && test $(pwd) export done "$@"
+export grep -eu awk echo awk printf
+	&& /usr/bin 2>/dev/null ${HOME} $(pwd) readonly sed "$1" --verbose
+	grep && -eu && 2>/dev/null x=1 test "$@" "$@" | "$1" printf cd && awk "$@" local
+		grep x=1 "$@" 2>/dev/null
+		2>/dev/null export | test
+$(pwd) echo /usr/bin && x=1 cd && then echo /usr/bin | grep $(pwd) local
+${HOME} | local /usr/bin "$@" readonly awk grep grep
+		--verbose cd | --verbose 'quoted text' cd printf grep local printf local sed -eu
+'quoted text' then | cd awk | test /usr/bin | -eu cd
+'quoted text' -eu done sed readonly grep /usr/bin | x=1 grep
+done 2>/dev/null 'quoted text' readonly 'quoted text' readonly awk echo
+		readonly grep && 2>/dev/null
+		"$1" /usr/bin grep local | grep printf /usr/bin x=1 --verbose echo grep readonly
+		"$1" sed "$1" "$@" -eu -eu echo awk done done grep /usr/bin
+		-eu 'quoted text' --verbose --verbose 'quoted text' done
+	${HOME} /usr/bin x=1 readonly
+		grep then /usr/bin awk cd sed && x=1 local "$@" && "$1" grep
+awk export then && /usr/bin "$1" test /usr/bin x=1
+	"$1" "$@" "$@" local && "$@" sed /usr/bin /usr/bin
+cd -eu grep 'quoted text'
+		x=1 then local readonly ${HOME} awk -eu echo export then sed 2>/dev/null printf
+	'quoted text' sed sed awk | local && --verbose then awk test
+	readonly export && -eu | -eu 2>/dev/null
+	2>/dev/null cd export x=1 "$1" --verbose cd "$@" readonly export "$1"
+echo grep awk -eu grep then done
+	sed && $(pwd) cd "$1" "$@" /usr/bin done /usr/bin
+	local -eu "$1" export /usr/bin $(pwd) ${HOME} && x=1 printf $(pwd) -eu export
+export readonly readonly
+		"$@" test readonly "$@" ${HOME} --verbose
+		/usr/bin grep --verbose done printf grep cd cd cd 2>/dev/null
+	2>/dev/null x=1 /usr/bin "$1" $(pwd) awk done "$@" awk grep -eu | 2>/dev/null
+	&& ${HOME} $(pwd) then 2>/dev/null ${HOME} | echo
+		readonly $(pwd) /usr/bin "$@" ${HOME} test ${HOME} done $(pwd) readonly
+	"$@" readonly "$1" local 2>/dev/null -eu then
+	"$1" grep && /usr/bin "$@" /usr/bin x=1 sed $(pwd) 2>/dev/null awk x=1
+		printf | -eu x=1 readonly sed awk done
+cd /usr/bin printf && readonly then then awk export readonly
+	'quoted text' 2>/dev/null test awk | --verbose test then -eu
+	-eu x=1 "$@" awk x=1 &&
+	local cd -eu awk --verbose
+	${HOME} sed readonly "$@" 2>/dev/null
+	'quoted text' printf && then then sed grep 'quoted text'
+done && 'quoted text' $(pwd) x=1 "$1" awk sed /usr/bin x=1 test awk --verbose
+--verbose ${HOME} printf "$1" x=1 sed sed | done && 'quoted text' cd && sed
+	printf local ${HOME} x=1 && && 'quoted text' cd ${HOME}
+$(pwd) && local --verbose readonly
+		grep cd 'quoted text' cd | "$1" | test "$@" test then 2>/dev/null cd
+		export ${HOME} /usr/bin export
+test then export x=1 test /usr/bin readonly readonly local $(pwd)
+		readonly 2>/dev/null --verbose
+awk "$@" local done done "$1" readonly --verbose -eu --verbose
+done -eu ${HOME} then sed ${HOME} local --verbose 2>/dev/null
+		&& done then done && echo then --verbose echo
+	export grep echo /usr/bin -eu x=1 local
+cd sed printf export done then 2>/dev/null 2>/dev/null "$@" printf
+	sed && x=1 $(pwd) "$@" 2>/dev/null "$@"
+	x=1 --verbose then /usr/bin export && ${HOME}
+	awk x=1 cd | 'quoted text' test ${HOME} then $(pwd) -eu echo
+	cd export $(pwd) /usr/bin
+readonly && x=1 ${HOME} "$1" echo
+		readonly ${HOME} export 'quoted text' 2>/dev/null
+	"$@" done awk $(pwd) test done echo echo 'quoted text' sed x=1 awk test "$1" readonly
+&& -eu done cd "$1" test $(pwd) local local done then local --verbose | -eu
+		sed 'quoted text' && "$1" printf done "$1" 'quoted text' &&
+		then /usr/bin && && 2>/dev/null grep 'quoted text'
+	export export then --verbose done then "$1" readonly
+	/usr/bin ${HOME} ${HOME} awk 2>/dev/null -eu echo ${HOME} grep "$@"
+		${HOME} | /usr/bin local then cd sed $(pwd) awk /usr/bin
+sed -eu sed printf x=1 "$1" echo printf ${HOME} "$@" 'quoted text'
+readonly echo export && export | -eu x=1 $(pwd)
+	grep done && cd "$@" | printf
+	'quoted text' && readonly x=1 --verbose printf 'quoted text' then
+readonly 'quoted text' cd export $(pwd) -eu sed cd | x=1 "$1" then echo sed
+		local then && | 'quoted text' 'quoted text' local -eu "$1" then test test -eu
+		| printf readonly export "$@" export printf 2>/dev/null ${HOME} $(pwd) sed
+		-eu /usr/bin ${HOME} "$1" printf cd -eu /usr/bin local
+	local "$@" x=1 sed 'quoted text' "$@"
+'quoted text' local sed --verbose printf ${HOME} x=1 sed "$1"
+		| readonly awk export 2>/dev/null then done echo test
+	test grep local "$1" grep printf /usr/bin /usr/bin --verbose | 'quoted text'
+	grep 'quoted text' "$@" 'quoted text' export && ${HOME} $(pwd) echo export
+		x=1 printf "$1" "$@" readonly grep readonly test sed 'quoted text' | | 'quoted text'
+	cd | | readonly 'quoted text' && && x=1 local /usr/bin then cd test export echo
+	x=1 cd x=1 printf sed readonly done 2>/dev/null
+		printf grep cd -eu && cd x=1 "$1"
+	awk local awk then printf export printf printf
+		x=1 awk 'quoted text' awk awk ${HOME} cd echo done /usr/bin --verbose
+	cd then ${HOME} $(pwd) -eu -eu /usr/bin
+${HOME} grep done readonly sed /usr/bin
+	$(pwd) | sed ${HOME} --verbose "$1"
+		'quoted text' test | --verbose --verbose then
+		/usr/bin export sed done "$@" sed done 2>/dev/null
+		test then /usr/bin | && -eu awk grep local $(pwd) echo | 'quoted text' local
+	awk $(pwd) -eu sed readonly $(pwd) local ${HOME}
+		done | ${HOME} --verbose local printf ${HOME} awk && "$1" "$@" readonly echo
+	done readonly ${HOME} then echo done
+cd echo 2>/dev/null -eu 'quoted text' readonly
+| local test --verbose /usr/bin | --verbose && "$@" export /usr/bin
+		'quoted text' test && $(pwd) awk && "$@" cd test -eu readonly
+| --verbose 'quoted text' test
+		"$@" /usr/bin grep awk then
+test local cd sed $(pwd) awk ${HOME} "$@" sed export
+	2>/dev/null then /usr/bin | $(pwd) awk
+"$@" && test ${HOME} --verbose
+		printf test ${HOME} 'quoted text'
+local | sed ${HOME} sed export printf cd awk 'quoted text'
+	cd 'quoted text' ${HOME}
+		done done echo export local 'quoted text' -eu
+cd then ${HOME} ${HOME} test 2>/dev/null /usr/bin
+		echo x=1 --verbose /usr/bin --verbose x=1 readonly
+	test export test local readonly printf 2>/dev/null
+		grep readonly && export -eu done | ${HOME} echo cd echo && local
+	readonly then 2>/dev/null && local export "$1" done "$1" --verbose
+	/usr/bin && ${HOME} local --verbose grep "$1"
+"$1" local 2>/dev/null test
+		"$1" 'quoted text' $(pwd) --verbose
+	grep printf "$@" awk
+echo done test sed "$@" done
+"$@" "$1" && awk 2>/dev/null then local | readonly echo x=1
+$(pwd) export readonly 'quoted text' ${HOME} then "$@" x=1 /usr/bin
+	2>/dev/null ${HOME} done $(pwd) then && 2>/dev/null | | echo
+printf awk 2>/dev/null awk 2>/dev/null 2>/dev/null
+		&& $(pwd) readonly cd 2>/dev/null done x=1 "$1" -eu grep -eu grep | readonly
+awk local | x=1 "$@" awk | export grep done sed readonly 'quoted text' 2>/dev/null
+echo awk $(pwd) x=1 grep export $(pwd) $(pwd) then awk done
+readonly export 2>/dev/null && done -eu 'quoted text' | 'quoted text' awk x=1
+	"$@" x=1 x=1 then done /usr/bin x=1 awk 2>/dev/null | -eu
+	${HOME} local local ${HOME} export ${HOME} export done 2>/dev/null
+2>/dev/null readonly awk | --verbose readonly
+	| "$@" 2>/dev/null done readonly | 'quoted text'
+	test ${HOME} $(pwd) "$@" --verbose done export sed export ${HOME}
+		"$@" "$1" -eu $(pwd) --verbose && done awk grep x=1 2>/dev/null "$@" $(pwd) cd
+		printf 'quoted text' |
+		then readonly done 'quoted text' 'quoted text' sed && local then
+--verbose && export awk 2>/dev/null "$@" ${HOME} $(pwd) "$1" | cd
+		/usr/bin local grep $(pwd) /usr/bin 'quoted text' test
+		x=1 grep -eu then $(pwd) 'quoted text' printf | -eu "$@" 2>/dev/null awk
+		'quoted text' | test 2>/dev/null test awk echo --verbose | x=1 "$@" &&
+	--verbose && | sed | -eu --verbose
+	$(pwd) test --verbose export 2>/dev/null
+$(pwd) 'quoted text' 'quoted text' sed x=1 awk && echo local "$@" $(pwd)
+	export echo then awk
+		grep sed ${HOME} awk 2>/dev/null 2>/dev/null sed $(pwd) $(pwd) readonly then
+	"$@" export test $(pwd) $(pwd) /usr/bin "$1" 2>/dev/null 'quoted text' cd $(pwd)
+"$1" echo 2>/dev/null done -eu awk then -eu echo $(pwd) | --verbose
+done sed ${HOME} $(pwd) "$@" sed printf
+		"$1" | local test && "$1"
+		printf test "$1" /usr/bin $(pwd) cd grep grep 2>/dev/null sed
+	$(pwd) ${HOME} readonly "$1" | ${HOME} echo then
+	grep --verbose cd readonly echo then echo echo sed ${HOME} x=1 --verbose
+	printf -eu --verbose awk 2>/dev/null | -eu test "$@" test readonly $(pwd) echo
+	printf then -eu printf && && grep done grep --verbose /usr/bin printf
+	grep grep readonly $(pwd) && local | awk test && /usr/bin
+	grep done $(pwd) then echo sed local test | printf --verbose cd local
+	2>/dev/null "$@" then awk grep "$@" "$1" -eu test printf 'quoted text' grep readonly
+x=1 done printf awk readonly && "$@" && "$@" x=1 cd then grep done && readonly
+		echo $(pwd) done | 'quoted text'
+"$1" && | ${HOME} printf export 2>/dev/null echo echo echo /usr/bin
+printf && x=1 "$1" "$@" --verbose sed | 'quoted text' "$@" "$@" readonly
+printf echo then test cd $(pwd)
+		echo "$@" --verbose then local 'quoted text' ${HOME} /usr/bin ${HOME} -eu -eu
+'quoted text' x=1 grep /usr/bin | then -eu
+awk "$@" test x=1 x=1 echo local grep sed echo then
+export awk 2>/dev/null x=1 --verbose done $(pwd) test | 'quoted text'
+	echo $(pwd) | "$@" export echo
+		readonly sed done then then "$1" cd -eu ${HOME} "$1" grep /usr/bin
+		local && test -eu x=1 'quoted text' /usr/bin x=1 done cd "$1"
+		"$1" test /usr/bin "$1" "$@" && done
+awk grep awk done cd export printf test --verbose 2>/dev/null
+	test echo | echo sed --verbose "$@"
+	export cd printf readonly test cd | echo cd sed | /usr/bin $(pwd) echo
+		$(pwd) local local ${HOME} && 'quoted text' --verbose
+	readonly --verbose && local ${HOME} | /usr/bin ${HOME} | done
+${HOME} grep readonly export local && "$@" ${HOME} -eu --verbose ${HOME}
+test && | sed | "$@" $(pwd) printf cd 2>/dev/null 2>/dev/null
+${HOME} --verbose ${HOME} "$@" echo local export
+	'quoted text' readonly "$@" test cd $(pwd) printf
+-eu cd local 2>/dev/null sed $(pwd) | printf echo "$@"
+	sed sed readonly test | -eu cd awk -eu export | "$1" export
+		"$@" --verbose && -eu ${HOME}
+	local then printf 'quoted text' awk -eu printf "$1" "$1" done ${HOME} $(pwd) local
+test && "$1" test awk "$1" export echo grep
+	export -eu | awk --verbose "$@" sed export -eu echo
+cd sed 2>/dev/null x=1 2>/dev/null
+	"$@" done -eu "$@" test cd | sed readonly then -eu -eu $(pwd)
+2>/dev/null done awk && then
+		printf readonly "$@" && sed readonly sed export 2>/dev/null
+--verbose test $(pwd) printf sed
+done ${HOME} awk local | test $(pwd) 'quoted text' "$1" sed awk
+		then cd sed "$@" -eu /usr/bin ${HOME}
+	"$1" ${HOME} sed /usr/bin echo x=1 awk awk 'quoted text' export /usr/bin
+| test export && echo printf | x=1 done "$@" awk
+	sed awk grep x=1 && -eu -eu local grep done
+then --verbose export then "$@" local local | 'quoted text' --verbose
+&& local test "$@" printf echo test echo
+		--verbose grep "$1" 'quoted text'
+		then $(pwd) ${HOME} ${HOME} "$1" cd ${HOME} 2>/dev/null grep local
+		sed export done "$@" --verbose printf $(pwd) --verbose sed export awk export
+cd 'quoted text' | | "$1" "$@" /usr/bin
+awk cd x=1 && local readonly "$@" test "$@" awk awk &&
+x=1 x=1 echo | cd 2>/dev/null local 'quoted text' done local | | ${HOME}
+--verbose sed grep $(pwd) $(pwd) -eu
+2>/dev/null $(pwd) awk
+		| test export local -eu 'quoted text' x=1
+		"$@" 2>/dev/null -eu x=1 ${HOME} local
+		$(pwd) then test && x=1 | /usr/bin "$1" --verbose 2>/dev/null
+		export grep done printf then awk --verbose && cd
+local awk test $(pwd) 2>/dev/null
+printf "$1" then cd /usr/bin 'quoted text' test "$1" local test "$1"
+		2>/dev/null -eu printf 2>/dev/null cd readonly 2>/dev/null
+awk /usr/bin test --verbose
+2>/dev/null done echo 'quoted text' "$@" ${HOME} --verbose readonly
+	test ${HOME} /usr/bin "$@" 2>/dev/null done x=1 /usr/bin
+	"$1" "$1" $(pwd) test x=1 printf 2>/dev/null ${HOME} local ${HOME}
+		sed $(pwd) export 2>/dev/null x=1 echo
+		--verbose "$@" $(pwd) cd sed
+-eu x=1 -eu /usr/bin && echo echo test grep 2>/dev/null -eu
+&& 2>/dev/null "$1" | echo 2>/dev/null done echo -eu | sed export grep awk
+-eu then --verbose then 'quoted text' export "$@" "$@"
+'quoted text' | $(pwd) 'quoted text' done test echo "$1" awk
+	2>/dev/null $(pwd) $(pwd) /usr/bin export /usr/bin ${HOME}
+	printf grep printf 'quoted text'
+		"$1" "$@" x=1 echo awk sed --verbose grep awk --verbose grep x=1
+	done export /usr/bin 'quoted text' -eu printf readonly awk 'quoted text' echo
+	test cd test local ${HOME}
+		--verbose | ${HOME} ${HOME} done && echo 'quoted text'
+then done then | then -eu awk "$@" /usr/bin cd then "$1" | printf
+		local $(pwd) | readonly sed export x=1 -eu $(pwd) then && local
+echo then cd x=1 "$1" && 'quoted text' grep cd 2>/dev/null
+grep export grep --verbose "$1" cd ${HOME}
+x=1 /usr/bin 'quoted text' test grep --verbose awk -eu $(pwd) sed
+		cd 2>/dev/null /usr/bin 2>/dev/null
+&& x=1 "$@" sed "$1" "$1" &&
+	-eu sed | -eu done local test
+done echo --verbose 2>/dev/null cd -eu
+	/usr/bin x=1 $(pwd) test grep | local echo
+"$1" test cd ${HOME} cd "$1" /usr/bin /usr/bin
+then test | readonly done "$1" printf
+grep readonly -eu 2>/dev/null "$@"
+	-eu test local /usr/bin /usr/bin
+		-eu local /usr/bin "$@" "$@" --verbose
+		${HOME} 2>/dev/null 2>/dev/null 'quoted text' local ${HOME} awk x=1 'quoted text'
+	x=1 "$1" local cd 'quoted text' /usr/bin then
+grep test /usr/bin export readonly 'quoted text' "$@" sed "$@" test
+	"$1" local ${HOME} 2>/dev/null x=1 --verbose $(pwd) readonly then
+	--verbose ${HOME} sed awk
+test 2>/dev/null --verbose /usr/bin local printf test export --verbose printf
+then awk x=1 2>/dev/null | ${HOME} x=1
+	| ${HOME} then -eu $(pwd) cd then /usr/bin then 'quoted text'
+	"$1" echo test /usr/bin export | export 2>/dev/null "$1"
+--verbose awk sed $(pwd) then done
+		"$@" sed sed "$@" 2>/dev/null
+		printf -eu grep readonly ${HOME} $(pwd)
+	"$@" 2>/dev/null && grep cd && "$@" printf
+printf readonly "$1" awk -eu | -eu
+		"$@" grep local 'quoted text' | done cd then awk cd 'quoted text'
+--verbose cd test cd then awk x=1 done grep then | printf
+	test awk printf local done 'quoted text' 'quoted text'
+		printf test cd "$@" readonly printf then 'quoted text' awk readonly x=1 $(pwd)
+/usr/bin then /usr/bin echo awk printf 2>/dev/null echo $(pwd) -eu $(pwd)
+		$(pwd) ${HOME} then test echo 'quoted text' ${HOME} cd "$1"
+	$(pwd) x=1 "$@" printf 2>/dev/null echo done cd grep export
+		-eu $(pwd) sed local cd echo sed printf
+		"$@" export grep then cd && --verbose "$1"
+${HOME} | then awk 2>/dev/null sed printf echo /usr/bin then "$@" readonly
+	local sed awk -eu then ${HOME}
+	printf $(pwd) | 2>/dev/null 'quoted text' x=1 $(pwd) && "$@"
+--verbose grep 2>/dev/null 'quoted text' ${HOME}
+2>/dev/null x=1 grep printf $(pwd) "$@" done awk grep then echo "$1" --verbose
+	local "$1" /usr/bin sed awk then "$1"
+		'quoted text' /usr/bin 'quoted text' /usr/bin
+	"$@" 2>/dev/null x=1 "$@" 'quoted text' test "$@" $(pwd) grep
+readonly local ${HOME} sed readonly then && export
+		'quoted text' | echo grep "$1" | x=1 && local test x=1 -eu
+cd && cd then echo done export echo export local
+		printf | grep done 'quoted text'
+cd cd | export 2>/dev/null ${HOME} then "$@" readonly -eu $(pwd) $(pwd)
+awk awk grep | $(pwd) 'quoted text' grep -eu cd | readonly local $(pwd) then
+		x=1 then | --verbose awk 'quoted text' readonly
+		printf local test echo x=1 local echo "$1" /usr/bin then awk -eu $(pwd) export
+echo local awk export grep printf x=1 local --verbose
+echo -eu awk export awk readonly "$1" | "$@" test 'quoted text' cd echo /usr/bin
+2>/dev/null 'quoted text' done && readonly sed x=1 "$@" then then cd then
+then then done readonly -eu export
+		/usr/bin sed printf local "$1" sed readonly $(pwd) "$@" cd
+"$1" export /usr/bin && "$@" --verbose
+x=1 readonly grep test /usr/bin local grep cd cd 'quoted text'
+	/usr/bin "$1" echo "$1" x=1 /usr/bin x=1 $(pwd)
+		printf awk x=1 'quoted text' 2>/dev/null
+		x=1 echo --verbose grep done cd export done 'quoted text' done ${HOME}
+/usr/bin local 2>/dev/null
+local ${HOME} /usr/bin export x=1 cd sed x=1 $(pwd) cd --verbose -eu | awk -eu
+		then readonly printf export "$1" test sed 2>/dev/null
+--verbose -eu x=1 "$1" echo grep printf printf export $(pwd) 2>/dev/null
+		done export readonly awk done "$1" -eu 2>/dev/null done
+		x=1 2>/dev/null 2>/dev/null readonly /usr/bin local local local $(pwd)
+	/usr/bin "$@" && local cd test $(pwd) then echo $(pwd)
+	awk && "$@" --verbose && cd sed
+	then 'quoted text' sed test echo /usr/bin 'quoted text' x=1 printf $(pwd) awk
+	local printf "$@" awk $(pwd)
+		cd local export /usr/bin
+	test echo -eu export test ${HOME} | export awk $(pwd) local sed -eu then
+test cd local -eu then && sed local 'quoted text'
+		done "$1" readonly /usr/bin readonly x=1 x=1 then -eu
+		"$1" "$1" "$@" "$1" test local readonly export test sed $(pwd) -eu then --verbose
+		cd awk | awk 2>/dev/null | test /usr/bin then awk 2>/dev/null $(pwd)
+		test ${HOME} 2>/dev/null export "$1" export --verbose
+		readonly printf local cd 2>/dev/null |
+grep awk && | 'quoted text' --verbose awk
+		export awk readonly --verbose
+awk "$@" && test --verbose echo export printf x=1
+	&& /usr/bin echo ${HOME} readonly readonly $(pwd) printf ${HOME} x=1 cd
+		"$@" grep $(pwd) && && /usr/bin export ${HOME} local test readonly
+	local x=1 then test grep echo 'quoted text' export 2>/dev/null readonly awk awk
+x=1 --verbose export x=1 ${HOME} && awk grep
+		"$1" -eu "$@" $(pwd) export | 'quoted text' grep "$@" ${HOME} readonly
+	&& "$1" --verbose | "$@" | | | x=1 test cd readonly "$1" then grep cd
+	local 2>/dev/null x=1 test | grep echo export sed done sed cd --verbose && $(pwd)
+		export --verbose awk | echo local readonly "$1" ${HOME}
+		local "$@" && local /usr/bin "$@" printf "$@" readonly readonly readonly
+		export --verbose echo done sed then export x=1 x=1 -eu 2>/dev/null
+		echo readonly printf 'quoted text' local export 2>/dev/null
+	readonly "$1" sed $(pwd) export | && ${HOME}
+"$@" done awk --verbose "$@"
+		/usr/bin x=1 --verbose /usr/bin sed echo &&
+		export grep sed ${HOME} grep awk "$1" ${HOME} awk
+		&& export export done |
+	/usr/bin 'quoted text' then "$@" x=1
+2>/dev/null awk done grep awk "$@" awk "$@" grep done --verbose cd
+	export x=1 test test /usr/bin done echo
+	-eu x=1 -eu local echo printf "$1" $(pwd) && --verbose
+	then cd cd | -eu awk test ${HOME} sed | | readonly $(pwd) /usr/bin cd x=1
+		/usr/bin grep 'quoted text' cd sed sed awk && /usr/bin "$@" sed readonly
+		--verbose local test ${HOME} ${HOME} $(pwd) --verbose grep readonly
+	awk test /usr/bin local "$@" cd $(pwd) -eu awk "$@" --verbose export
+| then printf | "$1" /usr/bin && export local -eu grep
+		-eu 'quoted text' | $(pwd) && test cd ${HOME} "$@"
+		printf sed test awk sed cd echo
+	--verbose | 'quoted text' $(pwd) readonly printf
+		&& --verbose "$1" test then -eu | done "$@" /usr/bin "$1" export
+		"$1" $(pwd) test done "$@" cd test test readonly $(pwd) test ${HOME} test
+		echo then readonly 2>/dev/null readonly ${HOME} ${HOME} export --verbose
+	sed 2>/dev/null then grep cd readonly
+		export && "$1" --verbose
+then export -eu echo $(pwd) ${HOME} && local sed
+	printf $(pwd) sed "$1" 'quoted text'
+echo cd | local then 2>/dev/null $(pwd) cd ${HOME} sed /usr/bin /usr/bin
+export "$@" export 2>/dev/null "$@" cd cd
+local then "$1" local 2>/dev/null "$1" export sed echo
+"$1" echo readonly ${HOME} local done && && cd /usr/bin | --verbose done awk
+&& local /usr/bin | 'quoted text' cd printf 'quoted text' done $(pwd) "$@" awk
+		'quoted text' "$1" printf printf local
+		${HOME} export "$1" export printf export
+		sed $(pwd) readonly ${HOME} 'quoted text' --verbose $(pwd)
+	test --verbose x=1 cd /usr/bin /usr/bin cd --verbose && -eu printf --verbose
+		| | | x=1 then test readonly
+/usr/bin local local printf
+local x=1 /usr/bin 'quoted text'
+		'quoted text' -eu ${HOME} grep
+	test -eu "$@" --verbose $(pwd) echo && done
+		then 'quoted text' done "$@" awk grep /usr/bin x=1 x=1 'quoted text' "$1"
+		/usr/bin --verbose local | "$1" |
+		export | local --verbose cd 'quoted text'
+/usr/bin grep done &&
+		&& readonly && "$1" "$@" "$@" echo --verbose $(pwd) echo
+		printf done x=1 printf cd sed sed | sed printf
+		"$@" && && "$@" cd && 2>/dev/null "$1" -eu readonly echo $(pwd) -eu
+	readonly cd ${HOME} sed printf grep && "$1"
+	grep /usr/bin ${HOME} echo "$@" -eu local cd 2>/dev/null
+		'quoted text' echo x=1
+	$(pwd) awk | test "$1" --verbose cd ${HOME}
+then -eu /usr/bin export printf echo readonly | x=1
+	"$1" done local awk sed 2>/dev/null
+		&& export ${HOME} grep 2>/dev/null && --verbose done 'quoted text'
+"$@" ${HOME} then /usr/bin x=1
+		printf echo grep 2>/dev/null
+		&& ${HOME} x=1 cd export && "$1" echo grep && ${HOME} awk
+"$@" | | echo "$@" cd printf printf ${HOME} "$1" printf local
+	then cd echo cd && sed x=1 test |
+		test readonly test && $(pwd) 'quoted text' local cd cd 'quoted text'
+test readonly readonly local "$1"
+		readonly 'quoted text' x=1 done echo cd export readonly -eu grep /usr/bin "$@"
+	'quoted text' | export awk &&
+	export -eu "$1" printf sed 2>/dev/null
+$(pwd) sed /usr/bin done awk "$@" awk ${HOME}
+done local $(pwd) echo x=1 $(pwd) echo readonly
+		readonly grep -eu done awk then && echo local ${HOME} echo && $(pwd) test sed x=1
+	| $(pwd) x=1 printf -eu 'quoted text' | ${HOME} then cd
+	grep export printf | sed readonly then ${HOME} test 'quoted text' /usr/bin
+echo 'quoted text' then echo cd $(pwd) ${HOME}
+test "$1" awk awk /usr/bin /usr/bin
+	x=1 sed x=1 then local && then 'quoted text'
+	'quoted text' printf local readonly && --verbose grep /usr/bin /usr/bin
+	x=1 then 2>/dev/null 2>/dev/null awk awk $(pwd) x=1 grep
+	x=1 printf ${HOME} test x=1 x=1 /usr/bin
+test readonly 'quoted text' && x=1 "$@" done "$1" done
+		| "$1" sed 'quoted text' export test x=1 2>/dev/null $(pwd)
+/usr/bin | && x=1 ${HOME} -eu -eu export awk -eu then x=1 "$1"
+	$(pwd) export awk export 'quoted text'
+local local 2>/dev/null cd done then then
+| local /usr/bin | ${HOME}
+test $(pwd) 2>/dev/null && -eu sed awk awk done grep 'quoted text'
+	readonly ${HOME} sed cd $(pwd) then
+sed 2>/dev/null x=1 done local "$@" /usr/bin -eu "$@"
+	${HOME} echo --verbose ${HOME} -eu -eu readonly local test local
+		export "$1" ${HOME} then printf test grep awk printf $(pwd) /usr/bin
+	&& local awk --verbose readonly grep export grep 2>/dev/null done 'quoted text'
+		&& && && export -eu "$1" test && ${HOME}
+$(pwd) cd export $(pwd) grep 'quoted text'
+&& done done readonly $(pwd) x=1 && grep local ${HOME} local awk done
+awk test done cd awk && test cd grep x=1 then "$1"
+| /usr/bin echo 'quoted text' sed local "$@" awk awk printf readonly
+		&& cd -eu grep ${HOME} | sed printf x=1 'quoted text' test | export printf
+cd then sed --verbose echo printf $(pwd) && $(pwd) cd -eu awk && 2>/dev/null
+'quoted text' grep /usr/bin "$@" && "$@" x=1 | "$1" done local
+	then local && grep sed grep printf printf export
+&& | done grep echo test && 'quoted text' local then
+		x=1 /usr/bin echo done /usr/bin --verbose -eu x=1 2>/dev/null then then awk
+	cd -eu "$1" 2>/dev/null x=1 --verbose echo export ${HOME} export
+x=1 then awk grep awk "$1" && local cd "$@" && && awk done test awk echo
+		awk /usr/bin readonly 2>/dev/null | readonly cd awk ${HOME} grep test
+then printf "$1" sed grep then readonly x=1 sed cd
+	$(pwd) test x=1 /usr/bin $(pwd) cd readonly sed --verbose sed then 2>/dev/null
+	local | test $(pwd) printf "$@" $(pwd) 'quoted text' 'quoted text'
+awk "$1" done --verbose done | x=1 && $(pwd) ${HOME} --verbose
+2>/dev/null local local "$@" "$1"
+awk grep "$@" x=1 "$1" sed --verbose
+		printf cd done done printf done
+		cd printf done local 'quoted text' "$1" "$1" $(pwd) /usr/bin ${HOME} 'quoted text'
+		'quoted text' 'quoted text' --verbose $(pwd) cd ${HOME} readonly
+	awk echo sed sed --verbose 'quoted text'
+		"$@" --verbose "$@" readonly 2>/dev/null
+		"$@" grep "$1" then x=1 readonly echo ${HOME}
+	"$@" then printf then x=1 ${HOME} echo test /usr/bin then readonly grep "$1" ${HOME}
+"$1" grep "$@" && $(pwd)
+		grep grep local sed "$1" done sed sed | /usr/bin | /usr/bin
+sed readonly 2>/dev/null "$1" awk test "$1" /usr/bin
+	"$@" awk cd readonly x=1 local grep -eu readonly then export grep export
+2>/dev/null | awk sed local printf
+	"$@" 'quoted text' printf local -eu
+	cd "$@" then export readonly -eu export "$@" readonly
+/usr/bin printf "$1" test
+-eu "$@" "$@" $(pwd) grep -eu printf /usr/bin readonly | $(pwd) local
+		sed then sed sed sed cd $(pwd) echo && /usr/bin
+	awk $(pwd) 2>/dev/null echo local local done --verbose echo /usr/bin
+	--verbose grep awk x=1 |
+	done 'quoted text' cd --verbose x=1 echo sed grep
+		sed test done printf x=1 --verbose -eu grep awk x=1
+	done readonly "$@" readonly 2>/dev/null /usr/bin printf done grep 'quoted text'
+	| then sed test "$1" printf "$1" "$@"
+done grep "$@" printf ${HOME} x=1
+	x=1 /usr/bin test then
+	cd 'quoted text' ${HOME} ${HOME} --verbose |
+		echo 2>/dev/null readonly sed -eu local
+		"$@" /usr/bin done cd -eu $(pwd) readonly && done "$@"
+		--verbose readonly --verbose
+		sed test x=1 | x=1 x=1 && done $(pwd) grep 'quoted text'
+		sed --verbose x=1 && export grep x=1 2>/dev/null
+	'quoted text' export readonly
+		then test awk readonly $(pwd)
+	grep -eu 'quoted text'
+		/usr/bin test local x=1 grep 2>/dev/null done
+/usr/bin | x=1 --verbose x=1 /usr/bin export "$@" sed |
+	local done cd then x=1 $(pwd) test done $(pwd) awk
+	x=1 cd export sed "$1"
+${HOME} done sed "$1" "$@" readonly -eu done | $(pwd) sed "$@" /usr/bin "$@"
+	test x=1 'quoted text'
+		done grep "$1" 2>/dev/null x=1 awk then test | 'quoted text' awk && then grep $(pwd)
+	$(pwd) then | done printf test $(pwd) done ${HOME} export ${HOME}
+2>/dev/null echo then
+${HOME} cd sed then $(pwd)
+cd -eu echo /usr/bin $(pwd)
+		printf 2>/dev/null export
+		--verbose then readonly 2>/dev/null done $(pwd) cd /usr/bin awk --verbose
+	cd ${HOME} done test printf $(pwd) $(pwd)
+	"$1" -eu "$@" && 2>/dev/null "$1"
+	'quoted text' awk -eu "$@" "$1" readonly
+	"$1" export printf $(pwd) | --verbose --verbose readonly readonly x=1 /usr/bin
+--verbose ${HOME} 2>/dev/null | awk printf grep ${HOME} $(pwd) x=1 -eu
+		cd grep echo --verbose echo 2>/dev/null 2>/dev/null
+then x=1 test 2>/dev/null then "$1" test "$1" $(pwd) /usr/bin ${HOME} && |
+		x=1 sed test "$1" readonly /usr/bin local
+	-eu readonly 'quoted text' echo -eu test
+x=1 'quoted text' then test ${HOME} cd cd && 'quoted text'
+		test cd ${HOME} /usr/bin done
+		'quoted text' 'quoted text' "$@" cd sed done --verbose done
+"$1" echo /usr/bin x=1 test "$@" done $(pwd)
+	2>/dev/null grep readonly awk echo cd cd grep 'quoted text' /usr/bin
+awk printf "$@" ${HOME} echo done | "$1" "$1" echo
+	x=1 ${HOME} test x=1 test cd then $(pwd) "$@" then "$@" --verbose
+	grep x=1 export awk /usr/bin /usr/bin
+		x=1 --verbose x=1 awk 2>/dev/null --verbose 'quoted text' readonly
+		local awk awk 'quoted text' 'quoted text' && "$@" test "$@" awk "$@" -eu 'quoted text'
+--verbose "$@" && 'quoted text' readonly && cd test
+${HOME} /usr/bin 2>/dev/null x=1 awk grep --verbose
+test local /usr/bin --verbose readonly readonly
+	readonly readonly printf sed sed $(pwd) readonly --verbose
+"$@" "$@" test x=1 --verbose echo
+then -eu export x=1 $(pwd) printf 2>/dev/null | --verbose
+		awk printf && sed printf -eu done local awk --verbose 2>/dev/null
+	x=1 then -eu sed --verbose 'quoted text' /usr/bin ${HOME} 'quoted text'
+printf grep echo done --verbose --verbose $(pwd) then --verbose
+	/usr/bin export export local "$1"
+		"$@" echo done readonly 2>/dev/null
+		export 2>/dev/null "$1" export export printf | $(pwd) x=1 "$@"
+	export export "$@" $(pwd) | ${HOME} --verbose -eu cd echo
+'quoted text' --verbose $(pwd) awk awk ${HOME} 2>/dev/null
+	${HOME} readonly /usr/bin "$@" done sed done printf | --verbose ${HOME} x=1 cd /usr/bin
+		-eu local | then awk awk readonly
+		$(pwd) grep "$1" printf "$1" done --verbose 2>/dev/null 'quoted text'
+$(pwd) grep done readonly local grep local ${HOME}
+readonly then then && 'quoted text' ${HOME}
+		printf -eu $(pwd) --verbose /usr/bin --verbose && "$@" && printf readonly --verbose
+${HOME} awk sed /usr/bin x=1 then printf x=1
+		export -eu done export test test test test
+printf sed "$@" | test test done $(pwd) &&
+		cd sed readonly export | ${HOME} && ${HOME} | grep grep -eu
+-eu "$@" readonly local cd | cd printf echo /usr/bin 2>/dev/null
+		'quoted text' ${HOME} readonly 2>/dev/null | readonly && then &&
+		local "$1" local x=1 cd then $(pwd) cd cd | "$1" done
+	local readonly "$@" sed cd awk 2>/dev/null ${HOME} 2>/dev/null grep echo
+	&& && | 'quoted text' -eu test awk "$@" 2>/dev/null /usr/bin then
+		${HOME} 2>/dev/null readonly 2>/dev/null done done done
+		$(pwd) sed 2>/dev/null then 2>/dev/null sed 'quoted text'
+		cd readonly export ${HOME} awk
+		sed export grep echo export test export
+	&& /usr/bin sed awk ${HOME} "$1" local sed echo local grep printf && -eu
+local ${HOME} echo cd then printf export 'quoted text' readonly
+		"$1" "$@" printf test /usr/bin --verbose echo
+	x=1 | then /usr/bin grep 2>/dev/null cd --verbose "$1" /usr/bin /usr/bin
+awk 2>/dev/null ${HOME} sed sed echo test -eu /usr/bin awk printf ${HOME}
+done grep 2>/dev/null awk echo "$1"
+		$(pwd) export /usr/bin ${HOME} "$1" -eu -eu --verbose --verbose ${HOME}
+'quoted text' 'quoted text' echo --verbose "$@"
+	local 'quoted text' cd cd readonly echo
+	echo echo x=1 --verbose test 2>/dev/null | cd then
+		${HOME} "$1" then local | && && then readonly
+awk $(pwd) then done -eu
+		cd sed 2>/dev/null -eu 2>/dev/null --verbose
+		'quoted text' -eu cd sed -eu readonly then x=1 'quoted text' then
+	local && 2>/dev/null && --verbose 'quoted text'
+printf "$1" -eu echo && "$1" grep -eu printf then | ${HOME} | ${HOME}
+	printf local 2>/dev/null x=1 | /usr/bin export grep grep
+		grep echo 'quoted text' x=1 cd -eu readonly 'quoted text' "$@" "$1" x=1
+	grep 2>/dev/null 2>/dev/null $(pwd) printf | /usr/bin
+		local readonly done "$1" grep readonly 2>/dev/null
+	echo done echo then "$@" test
+	| then done /usr/bin local cd ${HOME} done export echo
+readonly $(pwd) /usr/bin grep
+	"$1" | printf /usr/bin "$1" test echo "$@" export cd readonly export test /usr/bin
+done ${HOME} sed "$@" test
+	export -eu export cd local sed -eu local cd sed awk echo export then "$1" printf
+	printf /usr/bin ${HOME} 2>/dev/null 'quoted text'
+		done ${HOME} && echo local echo | 2>/dev/null 'quoted text'
+		x=1 done && readonly readonly x=1 sed sed && sed ${HOME} x=1 sed grep echo echo
+x=1 --verbose printf readonly
+		readonly --verbose readonly local && cd local done 2>/dev/null
+		'quoted text' export "$@" | 'quoted text' -eu readonly
+| done cd export "$1" -eu export $(pwd)
+	--verbose && printf | then $(pwd) && /usr/bin
+	/usr/bin sed "$@" | local "$1"
+		test grep && $(pwd) x=1 export ${HOME} sed
+		then /usr/bin "$@" $(pwd)
+		'quoted text' sed readonly
+	test --verbose -eu | --verbose done "$1" echo "$@"
+export cd export --verbose cd awk | export then done
+-eu then export -eu --verbose "$1" awk
+	readonly 2>/dev/null -eu grep 'quoted text' |
+export awk awk echo && 'quoted text' grep
+grep ${HOME} sed /usr/bin /usr/bin cd "$@" printf grep awk
+/usr/bin test 'quoted text' 2>/dev/null /usr/bin && -eu && printf
+		test | then -eu then grep then x=1 ${HOME} echo ${HOME} local $(pwd)
+	export printf then --verbose sed local
+		cd ${HOME} done "$@" $(pwd) && -eu "$1" local cd "$1" "$@"
+--verbose cd printf 2>/dev/null
+	&& sed cd /usr/bin "$1" awk local -eu -eu /usr/bin | printf
+	cd done echo $(pwd) sed awk grep local sed test done
+grep echo test echo 2>/dev/null
+| -eu $(pwd) readonly export 'quoted text'
+	x=1 $(pwd) export x=1 /usr/bin sed export then ${HOME}
+export local awk then | x=1 cd "$1" $(pwd) $(pwd)
+		grep sed awk && echo done export
+	printf then "$@" $(pwd) $(pwd) test 'quoted text' grep ${HOME} done x=1 printf
+echo export done readonly done | echo &&
+	awk x=1 grep printf && --verbose readonly printf "$1"
+		'quoted text' "$@" readonly ${HOME} local /usr/bin
+then 2>/dev/null x=1 local 'quoted text'
+-eu ${HOME} grep --verbose $(pwd) | x=1 done 2>/dev/null cd 2>/dev/null
+	${HOME} 2>/dev/null 'quoted text' x=1 export printf sed then
+sed 'quoted text' test -eu cd echo /usr/bin | done grep test local
+	echo && echo done then
+test export 2>/dev/null 2>/dev/null
+sed ${HOME} export echo readonly "$1" sed -eu && sed --verbose echo
+sed "$1" | grep export awk awk grep grep test 2>/dev/null "$1"
+		printf ${HOME} readonly --verbose x=1 2>/dev/null "$@"
+		then | -eu echo readonly /usr/bin 2>/dev/null grep 'quoted text'
+--verbose echo 2>/dev/null -eu &&
+	2>/dev/null awk test done
+		'quoted text' readonly "$@" /usr/bin sed awk
+/usr/bin | local grep 'quoted text' "$1"
+then then /usr/bin "$@" "$1" export done | "$1" test printf export
+"$1" grep 2>/dev/null grep --verbose then local x=1 $(pwd) --verbose
+x=1 "$@" 2>/dev/null local "$@"
+		echo readonly 2>/dev/null $(pwd) | ${HOME} x=1 local sed "$1" "$1" 2>/dev/null
+		test grep awk -eu $(pwd) 'quoted text' export $(pwd) awk grep $(pwd)
+		2>/dev/null awk sed grep echo sed /usr/bin /usr/bin | cd then
+	done x=1 -eu local 'quoted text' $(pwd) $(pwd) echo then 'quoted text'
+/usr/bin 2>/dev/null readonly ${HOME} --verbose done "$@" awk "$1"
+	| echo && echo awk "$1" | --verbose --verbose
+		awk /usr/bin awk --verbose export
+		-eu grep awk ${HOME} done cd -eu printf local cd | echo 2>/dev/null
+x=1 echo && export x=1 "$@" "$1" --verbose && "$1" -eu 'quoted text'
+	$(pwd) "$@" cd 'quoted text' "$@" "$@" /usr/bin readonly
+grep printf readonly local local
+sed && | | then /usr/bin x=1 echo printf /usr/bin printf x=1 then $(pwd) |
+echo "$1" local 'quoted text' local grep local ${HOME} printf --verbose "$1"
+	awk sed export printf -eu
+"$1" 2>/dev/null echo --verbose
+sed sed sed printf done $(pwd) -eu "$1"
+done && awk && x=1 $(pwd) local 2>/dev/null
+		$(pwd) | then /usr/bin --verbose x=1
+		${HOME} /usr/bin -eu test grep ${HOME} awk | 'quoted text' done 2>/dev/null
+	--verbose 'quoted text' awk printf 2>/dev/null 'quoted text'
+	done grep then "$1" grep awk | sed x=1 test | test | echo done export sed "$1"
+	cd readonly 2>/dev/null "$@" | local test local 'quoted text'
+		-eu x=1 "$@" "$@" 'quoted text'
+		awk cd | cd --verbose x=1 --verbose export --verbose
+		&& $(pwd) 2>/dev/null --verbose -eu done done grep
+then done --verbose -eu readonly grep printf "$@" 2>/dev/null -eu awk
+readonly echo test grep 2>/dev/null cd readonly 'quoted text' /usr/bin
+		done done $(pwd) | echo test local awk "$1" &&
+		grep 'quoted text' test readonly | /usr/bin sed 'quoted text' "$@" export
+echo | x=1 2>/dev/null grep local printf -eu "$1" $(pwd) done x=1 test
+cd then -eu 'quoted text'
+		readonly "$1" export then export readonly done cd
+		local sed then export export grep local printf cd --verbose test cd local printf
+done printf /usr/bin | -eu && "$1" cd done 'quoted text' "$1" x=1 awk
+readonly "$@" grep then test
+		-eu then x=1 $(pwd) /usr/bin -eu echo $(pwd) "$@"
+		test test $(pwd) && | then then done && ${HOME} awk sed echo
+		then then 'quoted text' awk printf echo | $(pwd) | export "$1" printf local
+		sed local local 'quoted text' && /usr/bin ${HOME} done awk --verbose $(pwd) | export
+-eu -eu test && export echo grep "$@"
+	/usr/bin readonly readonly /usr/bin
+		echo sed --verbose ${HOME} printf 'quoted text' then
+		echo test awk echo done ${HOME} test -eu then -eu 2>/dev/null
+	sed printf printf 2>/dev/null printf echo --verbose
+"$1" grep printf $(pwd)
+		sed && x=1 export 'quoted text' ${HOME} 'quoted text'
+	${HOME} then ${HOME} 2>/dev/null grep then /usr/bin /usr/bin test readonly &&
+	--verbose awk grep echo
+		sed cd readonly local sed export readonly x=1 x=1 sed export test x=1
+sed /usr/bin test x=1
+	awk /usr/bin 'quoted text' "$@" sed x=1 test local
+then /usr/bin local local sed 'quoted text' "$@" awk done 'quoted text'
+		test "$1" readonly awk
+local ${HOME} && local echo $(pwd) cd cd "$@" ${HOME} "$@" done x=1 test 2>/dev/null
+		x=1 "$1" awk | export --verbose done awk then done readonly
+	sed /usr/bin && --verbose printf | cd 'quoted text' grep export echo -eu printf
+		printf $(pwd) && printf | echo
+	&& && cd grep grep -eu readonly ${HOME}
+--verbose cd readonly echo 2>/dev/null 'quoted text' && 'quoted text' | 2>/dev/null
+	sed | --verbose && readonly grep cd grep
+	x=1 2>/dev/null 2>/dev/null 'quoted text' -eu
+		'quoted text' 2>/dev/null "$1"
+		export grep ${HOME} -eu test -eu export
+	sed echo $(pwd) | then $(pwd) && sed -eu awk printf "$@" done
+-eu test then 'quoted text' test
+2>/dev/null | printf readonly
+		export -eu $(pwd) local grep printf $(pwd) && test 'quoted text'
+	&& --verbose 2>/dev/null printf grep | test local "$1" "$1" printf
+	readonly ${HOME} readonly -eu && 'quoted text' then sed export
+${HOME} local export printf 'quoted text' | grep
+		export x=1 ${HOME} done then /usr/bin $(pwd) 'quoted text'
+		awk -eu 'quoted text' ${HOME} readonly then -eu && $(pwd) grep sed readonly -eu
+		"$@" "$@" "$1" "$1" export $(pwd) cd readonly
+	--verbose sed /usr/bin
+		/usr/bin export ${HOME} local /usr/bin 'quoted text'
+		x=1 local | "$1" --verbose 'quoted text'
+	'quoted text' "$@" readonly awk grep
+		'quoted text' 'quoted text' readonly | ${HOME} cd sed --verbose
+| grep awk awk export local done
+sed printf | local echo readonly "$1" test
+x=1 /usr/bin done -eu --verbose
+"$1" then readonly sed local grep readonly echo "$1" awk
+		"$1" && "$@" 'quoted text' "$1" printf readonly grep then "$@" test then done "$@"
+		done /usr/bin sed --verbose local && --verbose echo sed
+		--verbose 'quoted text'
+		| cd cd test "$1" --verbose
+		cd then export 'quoted text' then x=1
+	grep 'quoted text' test test local "$1" -eu
+		readonly awk then && local sed echo "$@" export ${HOME}
+done readonly awk -eu sed ${HOME} /usr/bin $(pwd) 2>/dev/null cd --verbose grep
+grep local readonly export && grep export awk "$1" | x=1 awk awk echo
+	--verbose done test sed readonly awk | && awk && cd
+	"$@" then done cd printf grep local x=1 "$1"
+	export printf grep awk && x=1 && readonly
+	$(pwd) && local test printf test
+printf | local ${HOME} | printf x=1
+	"$@" x=1 then test grep sed then $(pwd) readonly --verbose test awk
+		"$@" test -eu --verbose readonly 'quoted text' sed | cd /usr/bin echo test
+		export && test "$1" 'quoted text' printf
+	test readonly local done grep cd sed export | | done
+echo then "$1" ${HOME} test done -eu /usr/bin cd ${HOME} grep
+printf 2>/dev/null readonly
+	/usr/bin then readonly "$1" then test
+		done "$@" local readonly | && cd test awk "$@" &&
+	"$@" x=1 awk printf $(pwd) && /usr/bin /usr/bin && /usr/bin
+/usr/bin readonly $(pwd) /usr/bin then "$@" local $(pwd)
+	--verbose test grep ${HOME} export sed export then awk --verbose
+	&& --verbose local ${HOME} x=1 then | 'quoted text'
+	${HOME} --verbose "$1" -eu x=1 echo sed local echo x=1 echo local done then grep
+		/usr/bin "$@" then echo $(pwd) export 2>/dev/null
+-eu local grep echo test export && "$1" /usr/bin $(pwd) | sed
+		2>/dev/null "$@" --verbose readonly /usr/bin --verbose export $(pwd) "$@" readonly
+	sed -eu "$@" local && -eu
+${HOME} local sed echo cd done readonly 'quoted text'
+		sed grep -eu x=1 sed sed /usr/bin "$@" local then local
+		printf test | "$1" awk "$@" echo "$@" "$@" --verbose "$@" export
+x=1 --verbose x=1 /usr/bin echo
+--verbose "$1" "$1" printf && --verbose /usr/bin local
+x=1 cd | ${HOME} ${HOME} then
+		export test "$1" awk printf --verbose && test awk cd ${HOME} /usr/bin readonly
+| && local "$@" $(pwd) 2>/dev/null awk 'quoted text' "$@" cd && sed
+readonly sed ${HOME} sed $(pwd)
+		local local && | cd 'quoted text'
+printf done $(pwd) &&
+${HOME} $(pwd) "$1" echo readonly ${HOME} "$@"
+	local -eu "$@" -eu local echo
+then --verbose sed test export
+		then sed "$@" awk cd $(pwd) x=1 test x=1 --verbose
+		readonly echo "$@" $(pwd) awk --verbose x=1 cd x=1
+printf --verbose --verbose export
+	echo cd ${HOME} sed readonly ${HOME} | && readonly
+	local --verbose export && | then "$@" "$1" sed awk
+	$(pwd) | grep awk ${HOME} 2>/dev/null --verbose export
+| cd 2>/dev/null $(pwd) $(pwd) printf test && test /usr/bin "$1" echo
+test "$@" grep -eu | grep readonly echo cd "$1" $(pwd)
+		2>/dev/null then grep readonly --verbose sed sed grep x=1
+		"$1" /usr/bin done | && 2>/dev/null
+	readonly x=1 readonly 'quoted text' 2>/dev/null 'quoted text' | 2>/dev/null
+		"$1" ${HOME} done && 2>/dev/null --verbose sed "$1" readonly
+cd then readonly 'quoted text'
+		${HOME} echo local awk printf awk
+sed test $(pwd) test local grep awk 2>/dev/null local
+		$(pwd) $(pwd) --verbose $(pwd) x=1 2>/dev/null
+	sed local x=1 cd cd | "$@" "$1" export
+"$1" ${HOME} grep x=1 printf "$1" && "$1" echo | printf then && "$@" 'quoted text'
+	then echo cd | cd /usr/bin 'quoted text'
+		&& | done -eu 2>/dev/null local cd local
+	"$1" done done sed echo "$1" then -eu done --verbose x=1 printf && |
+	"$@" | ${HOME} -eu test cd && | -eu then ${HOME}
+		grep -eu grep /usr/bin -eu test test awk printf sed -eu | x=1 2>/dev/null
+printf 'quoted text' cd export done sed echo && cd x=1
+		"$1" awk test echo done && -eu 2>/dev/null && x=1 cd awk 'quoted text' --verbose
+	printf sed done --verbose done local 2>/dev/null && && export echo local
+	done /usr/bin 'quoted text' --verbose then "$@" "$1"
+		then cd -eu printf x=1 awk "$@" printf "$1" --verbose "$@" x=1 sed --verbose
+	local $(pwd) test ${HOME}
+	grep then sed x=1 sed 2>/dev/null "$1" --verbose /usr/bin grep then
+	readonly "$1" echo local "$1" test local ${HOME} local local
+	/usr/bin | -eu test | then
+test --verbose export --verbose --verbose then test
+		cd test | | then --verbose sed local
+		printf printf -eu then test 'quoted text' printf /usr/bin
+	cd ${HOME} "$1" export 2>/dev/null -eu sed "$@" test export
+${HOME} awk readonly ${HOME} |
+	$(pwd) sed /usr/bin readonly x=1 -eu $(pwd) 'quoted text' printf grep echo
+grep readonly grep then --verbose sed | done x=1 done cd readonly
+sed && -eu --verbose "$@"
+		x=1 'quoted text' ${HOME} awk done done
+	done done then ${HOME} -eu test "$@" 'quoted text' --verbose grep readonly
+	printf ${HOME} done $(pwd)
+		readonly cd | cd sed done printf
+		local then "$1" --verbose cd local
+	printf done test test grep | printf --verbose
+'quoted text' && ${HOME} "$1" ${HOME}
+		export "$@" readonly x=1 | 'quoted text' --verbose /usr/bin
+/usr/bin cd local cd test awk 2>/dev/null
+	/usr/bin test export done
+		&& echo test export --verbose
+		grep test grep awk && readonly && -eu "$@" "$@" "$1" test then export cd
+cd cd local test sed done
+	'quoted text' x=1 /usr/bin
+2>/dev/null $(pwd) done ${HOME} cd
+${HOME} export 'quoted text' test readonly readonly echo sed readonly
+	x=1 done "$1" && test sed test
+	"$1" readonly "$@" then awk grep test x=1 printf
+-eu /usr/bin 'quoted text' printf cd | /usr/bin $(pwd) cd done -eu
+		2>/dev/null printf echo
+		printf grep /usr/bin x=1 printf export "$1" printf done done | local local readonly
+| export -eu printf grep -eu x=1 'quoted text' 2>/dev/null x=1 readonly done
+test test sed done then $(pwd) sed awk grep && /usr/bin /usr/bin
+		x=1 grep -eu --verbose ${HOME} /usr/bin -eu && awk ${HOME} | done cd "$1"
+		export --verbose x=1 readonly echo "$1" echo
+	then echo local cd then cd grep sed 'quoted text' | "$@" printf echo
+"$@" awk 2>/dev/null && 2>/dev/null awk 2>/dev/null
+		| done 2>/dev/null --verbose 'quoted text'
+2>/dev/null cd grep then cd echo --verbose
+		then readonly then export 2>/dev/null /usr/bin -eu awk local ${HOME} x=1 'quoted text'
+	x=1 'quoted text' "$@" done echo echo sed local ${HOME} --verbose
+		cd then -eu 2>/dev/null
+grep readonly then sed | "$@" "$@" x=1 2>/dev/null cd echo done readonly
+	local $(pwd) cd export ${HOME} $(pwd) readonly test then "$@" cd && sed /usr/bin
+2>/dev/null --verbose -eu done export
+printf --verbose echo "$@" then
+	printf | "$1" local x=1
+		${HOME} grep "$@" 2>/dev/null 'quoted text'
+		done ${HOME} printf local test 'quoted text' 'quoted text' export
+		export awk --verbose sed 2>/dev/null grep awk grep "$@" -eu ${HOME} export
+	readonly x=1 $(pwd) printf 'quoted text' readonly
+	"$@" /usr/bin test cd then printf --verbose --verbose done x=1 printf
+"$1" --verbose --verbose && done export grep | printf awk
+	export export test 2>/dev/null
+echo | 'quoted text' ${HOME}
+		"$1" test "$1" --verbose awk test 'quoted text' cd grep
+${HOME} local export "$1" && "$1"
+		done 'quoted text' $(pwd) echo ${HOME} "$1" then local x=1 x=1 "$@" | "$1"
+	| 2>/dev/null --verbose
+		grep echo 2>/dev/null --verbose
+	printf ${HOME} ${HOME} -eu
+x=1 -eu awk "$@" $(pwd) local export readonly | x=1 x=1 x=1 awk sed ${HOME}
+	'quoted text' local ${HOME}
+-eu x=1 readonly x=1 "$1" "$1"
+| echo $(pwd) grep readonly readonly test sed $(pwd) ${HOME} local echo
+	awk --verbose "$@" cd /usr/bin --verbose local $(pwd)
+		then | 2>/dev/null printf -eu export
+		--verbose x=1 cd then /usr/bin
+readonly readonly sed ${HOME} cd
+	/usr/bin test "$1" grep 2>/dev/null cd printf then --verbose ${HOME} readonly
+	awk -eu && -eu && 'quoted text' ${HOME} printf "$1" "$@" $(pwd) x=1 local
+"$@" test "$@" readonly
+--verbose -eu local "$1" 2>/dev/null echo /usr/bin test then --verbose then /usr/bin
+	local 2>/dev/null echo awk printf test && 'quoted text' -eu x=1 --verbose test
+${HOME} "$1" then 2>/dev/null export && echo done && test export
+		printf echo $(pwd) "$1"
+readonly && /usr/bin printf sed && /usr/bin && done export | && sed
+	"$@" local then grep "$1" export export
+		local cd grep /usr/bin test 2>/dev/null awk awk export echo 'quoted text'
+--verbose printf 2>/dev/null $(pwd) cd awk 'quoted text'
+	awk /usr/bin done $(pwd) /usr/bin 'quoted text'
+	then ${HOME} local awk printf cd done x=1 x=1 local
+${HOME} 2>/dev/null cd -eu $(pwd) x=1 done /usr/bin cd printf
+done done cd --verbose 2>/dev/null
+	| grep cd awk export -eu
+	sed printf && cd | && awk "$1" $(pwd) 2>/dev/null -eu |
+		'quoted text' "$1" cd && 2>/dev/null /usr/bin 2>/dev/null done
+		echo 2>/dev/null 2>/dev/null cd | --verbose
+		grep printf $(pwd) --verbose | | done printf 'quoted text'
+-eu --verbose export "$@" printf done test | then && 'quoted text' export
+		"$1" && | x=1 && "$1" $(pwd) $(pwd) awk sed && 2>/dev/null 'quoted text'
+cd awk && /usr/bin | cd test done then && readonly
+then local "$@" /usr/bin x=1 --verbose cd awk 2>/dev/null
+		readonly ${HOME} echo grep /usr/bin /usr/bin export
+	readonly $(pwd) | export done grep then grep "$@" x=1 grep
+	/usr/bin done export then 'quoted text'
+		then export $(pwd) /usr/bin sed $(pwd) $(pwd) --verbose 2>/dev/null 'quoted text'
+		test then test $(pwd) then then awk -eu --verbose
+		&& /usr/bin echo awk printf done ${HOME} grep --verbose test x=1 "$@"
+		local export 'quoted text' sed "$@" x=1 ${HOME} printf
+--verbose "$@" cd | awk local "$1" test printf 'quoted text'
+	done "$@" x=1 cd --verbose done -eu test
+		done cd -eu local "$1" --verbose grep sed done test awk --verbose -eu --verbose
+${HOME} -eu --verbose && -eu test -eu readonly -eu awk export sed cd
+		export /usr/bin 'quoted text' -eu
+	"$@" -eu -eu x=1 sed -eu export local "$@" printf
+		awk awk "$1" --verbose awk
+	sed printf awk 'quoted text' awk $(pwd)
+#include c82.sh
+		/usr/bin cd && done -eu grep && 2>/dev/null
+		${HOME} cd local cd $(pwd) done export /usr/bin --verbose cd "$1" awk "$1" cd
+	local then export "$1" "$@" sed && 'quoted text' --verbose "$@"
+	&& $(pwd) ${HOME} 'quoted text' "$@" printf x=1
+	x=1 -eu then echo cd echo test 'quoted text'
+	2>/dev/null readonly "$@" sed 'quoted text' 2>/dev/null grep export test
+		awk awk then test printf
+		sed awk grep $(pwd) sed x=1 cd --verbose 2>/dev/null printf "$1" 'quoted text'
+	then done test export readonly printf
+		local -eu grep local done $(pwd) awk local cd local cd grep 'quoted text'
+| test grep grep "$1" readonly --verbose && --verbose "$@" "$@" grep echo
+		test $(pwd) --verbose echo
+printf ${HOME} cd 'quoted text' sed done 2>/dev/null
+"$@" ${HOME} export "$@"
+/usr/bin then 'quoted text'
+done readonly --verbose printf local && local /usr/bin
+-eu then "$@" sed -eu test x=1 printf
+${HOME} awk --verbose "$@" export
+		printf -eu && readonly "$1" sed && sed |
+test grep then export x=1 | awk ${HOME}
+${HOME} "$1" --verbose awk "$1" cd
+	'quoted text' cd cd export "$1" 2>/dev/null echo done printf
+		done x=1 && | -eu -eu local -eu done done
+local test && $(pwd) "$1" 'quoted text'
+		local export readonly && | done | "$@" && sed 'quoted text'
+		'quoted text' then -eu echo
+	readonly --verbose --verbose "$1" --verbose | export cd test 2>/dev/null sed grep
+test echo test ${HOME} $(pwd) && 2>/dev/null local && ${HOME} sed then export
+${HOME} "$1" -eu "$1" printf sed | test test
+		done 'quoted text' -eu /usr/bin
+"$1" "$@" /usr/bin "$@" 'quoted text'
+		awk -eu --verbose done $(pwd) ${HOME} --verbose /usr/bin
+		--verbose $(pwd) /usr/bin 'quoted text' cd readonly
+/usr/bin x=1 -eu awk "$1" --verbose then | "$@" export "$1" "$1" done ${HOME} ${HOME}
+	export && && | | cd readonly awk $(pwd) "$1" ${HOME} x=1 local
+"$1" -eu sed /usr/bin "$1" export printf && x=1 x=1 export
+		cd then && ${HOME} awk ${HOME} test printf
+export --verbose sed grep test echo export
+export 2>/dev/null local ${HOME} done 2>/dev/null
+2>/dev/null && awk | export then
+		| local -eu $(pwd) local x=1 /usr/bin 2>/dev/null done echo x=1 then x=1 done /usr/bin
+		--verbose printf readonly "$@" export x=1
+		x=1 "$1" sed printf x=1 "$1" "$1" export | 'quoted text' local
+		grep "$1" "$@" && 'quoted text' /usr/bin
+		$(pwd) cd "$@" done sed "$1" "$@"
+		-eu sed && readonly "$1" "$1" awk 2>/dev/null /usr/bin echo --verbose cd readonly
+done readonly -eu echo ${HOME}
+		then x=1 "$1" $(pwd) $(pwd) local
+'quoted text' export --verbose readonly $(pwd) sed && 'quoted text' ${HOME}
+export 2>/dev/null done then
+		test 2>/dev/null ${HOME} $(pwd) sed awk | --verbose sed readonly
+--verbose ${HOME} awk "$1"
+&& sed then sed ${HOME} 'quoted text' ${HOME} export then sed -eu "$@" then
+	--verbose then 2>/dev/null export printf 'quoted text'
+		--verbose 'quoted text' export done awk then 'quoted text' local printf done
+	export cd x=1 "$1" ${HOME} echo
+| $(pwd) | "$@" grep awk x=1
+'quoted text' then "$@" grep
+readonly /usr/bin export $(pwd)
+		echo sed echo "$1" local --verbose
+| && echo then done && grep "$1" readonly
+${HOME} && "$1" export cd ${HOME} then x=1 --verbose
+	/usr/bin grep done -eu -eu sed 2>/dev/null $(pwd) grep "$1" "$1"
+awk 2>/dev/null ${HOME} "$1" printf
+		--verbose /usr/bin "$1" /usr/bin
+	--verbose -eu cd done | awk test "$@" export
+	&& echo x=1 readonly | -eu readonly 2>/dev/null | ${HOME}
+	export x=1 'quoted text' -eu awk done $(pwd)
+		readonly $(pwd) readonly --verbose awk grep ${HOME} -eu "$@"
+test ${HOME} ${HOME}
+awk $(pwd) "$@" "$1" sed && echo
+awk "$@" 2>/dev/null done x=1 done
+	$(pwd) --verbose grep printf x=1 ${HOME} cd 'quoted text' local
+	"$1" readonly echo awk then sed ${HOME} done 2>/dev/null grep
+	local 'quoted text' ${HOME} cd $(pwd) --verbose awk x=1 done grep
+	echo test printf $(pwd) readonly
+		x=1 2>/dev/null --verbose test readonly
+		--verbose local printf sed export
+		sed export printf --verbose x=1 $(pwd) awk --verbose local
+		${HOME} "$1" sed awk test "$@" $(pwd) echo /usr/bin export x=1
+	'quoted text' awk then sed /usr/bin 2>/dev/null /usr/bin
+	readonly echo | export sed | readonly -eu && grep ${HOME} then grep readonly --verbose
+		$(pwd) "$@" export 'quoted text' grep export 'quoted text'
+	$(pwd) local done done local export ${HOME} cd -eu x=1 'quoted text'
+		${HOME} cd local -eu readonly 2>/dev/null "$@"
+	local echo test echo export local x=1 /usr/bin ${HOME}
+export readonly -eu 'quoted text' --verbose echo
+readonly && /usr/bin awk && $(pwd) $(pwd) | /usr/bin
+		done readonly done /usr/bin then echo cd --verbose cd export
+	sed printf export cd grep local awk "$@" export done local
+	'quoted text' -eu awk local "$1"
+	readonly -eu cd 2>/dev/null 2>/dev/null
+		--verbose && x=1 --verbose ${HOME} -eu done printf 'quoted text'
+		grep readonly | sed $(pwd) "$@" grep -eu then 2>/dev/null && | 'quoted text'
+	sed "$1" "$1" printf sed readonly export
+| 2>/dev/null x=1 cd "$1" -eu "$@" "$1" x=1 /usr/bin test 'quoted text' 'quoted text'
+		printf 2>/dev/null 'quoted text' 2>/dev/null
+	done "$@" "$1" | /usr/bin 'quoted text' done cd "$1" done
+then echo echo ${HOME} $(pwd) | $(pwd) | --verbose export /usr/bin then
+		then | local echo done -eu cd grep -eu local done | "$1" | cd local
+	grep && awk test x=1 cd sed readonly 'quoted text' sed awk && ${HOME} "$@" -eu
+sed | 2>/dev/null x=1 /usr/bin /usr/bin
+then sed awk ${HOME} echo
+cd cd then grep echo "$1" echo
+	| "$1" test cd test "$@" awk grep
+	&& $(pwd) test | --verbose
+	'quoted text' /usr/bin && export export "$1" --verbose
+		cd done "$@" | "$1" --verbose local && readonly awk
+local readonly local printf grep printf /usr/bin echo
+		readonly then then local cd --verbose sed awk $(pwd) cd echo "$1" -eu ${HOME} cd
+	readonly --verbose awk "$@" cd -eu
+	${HOME} export && /usr/bin
+	then then cd | test printf echo export grep readonly test
+	2>/dev/null "$@" && readonly "$@" echo
+		${HOME} "$1" -eu then cd 2>/dev/null
+local && "$@" ${HOME} -eu export test export --verbose sed grep test x=1 /usr/bin
+	/usr/bin done done then 'quoted text'
+awk x=1 done | readonly x=1 | 'quoted text' readonly "$1" then x=1
+sed /usr/bin --verbose test then x=1
+	| 2>/dev/null printf | $(pwd) sed ${HOME} cd /usr/bin $(pwd) "$1" local /usr/bin
+	done ${HOME} local grep x=1 "$1" --verbose sed sed "$@" readonly
+&& "$1" 'quoted text' export sed grep grep
+	--verbose 2>/dev/null -eu export export | 'quoted text' then "$1" x=1 "$1" "$@"
+		/usr/bin export 'quoted text'
+	readonly grep test sed printf awk
+${HOME} "$@" test /usr/bin export
+	then -eu -eu then | ${HOME} "$1" cd x=1 sed ${HOME}
+	cd ${HOME} local printf -eu
+		done "$1" "$@" grep local 2>/dev/null cd test &&
+$(pwd) sed 'quoted text' sed $(pwd) echo --verbose echo cd
+		'quoted text' echo local then printf done --verbose echo "$@" echo x=1 test
+printf 2>/dev/null $(pwd) printf local
+printf awk echo readonly
+		printf sed -eu -eu cd then cd export printf "$@" -eu x=1 awk awk
+export sed 'quoted text' cd && "$1"
+$(pwd) test export $(pwd) printf --verbose ${HOME} ${HOME} export
+		| cd $(pwd) grep 'quoted text'
+x=1 then $(pwd) 'quoted text' done ${HOME}
+	export --verbose 'quoted text' local sed local -eu 'quoted text'
+	printf readonly readonly --verbose
+		grep ${HOME} local awk awk printf --verbose | grep 2>/dev/null | sed then
+'quoted text' $(pwd) $(pwd) grep readonly $(pwd) ${HOME} export test x=1 && --verbose
+	echo /usr/bin cd echo grep -eu 'quoted text'
+	awk local grep x=1 cd test --verbose echo echo x=1
+		$(pwd) -eu awk --verbose && readonly /usr/bin sed /usr/bin printf
+		cd done cd grep $(pwd) x=1 sed --verbose /usr/bin done readonly test cd -eu
+		&& $(pwd) --verbose readonly export echo "$@" "$@" done export /usr/bin
+	readonly readonly /usr/bin $(pwd) cd done x=1 grep 'quoted text'
+readonly sed done sed
+	--verbose -eu local && readonly awk then && | --verbose $(pwd) $(pwd) $(pwd)
+		echo $(pwd) then grep
+	2>/dev/null | done then cd done
+		"$1" readonly then $(pwd) echo local cd cd sed "$@" awk
+		grep "$1" echo && cd | echo echo test
+		local local --verbose 'quoted text'
+		cd printf printf printf grep x=1 awk /usr/bin local grep
+-eu local done test "$@" /usr/bin $(pwd) /usr/bin && --verbose test --verbose awk
+then $(pwd) ${HOME} test printf
+		"$@" && --verbose local printf "$1" readonly test x=1 sed "$1" export
+		echo -eu $(pwd) done $(pwd) ${HOME} awk readonly grep
+readonly && ${HOME} "$1" --verbose -eu awk readonly /usr/bin "$@" echo
+	echo then readonly then then printf "$@" "$1" printf 'quoted text'
+	x=1 then "$1" x=1 x=1 "$1" awk readonly awk test test
+&& x=1 test "$1" readonly printf
+	done then -eu local --verbose cd /usr/bin awk
+	readonly /usr/bin -eu cd "$1"
+		local -eu cd "$1" | x=1 "$@" --verbose "$1" then sed 2>/dev/null 'quoted text'
+	cd | --verbose $(pwd) "$1" 'quoted text'
+	grep awk && echo echo awk echo "$1" export /usr/bin x=1 awk readonly
+		--verbose -eu $(pwd) "$1" --verbose --verbose | "$@"
+/usr/bin test x=1 "$@" echo "$@" then $(pwd)
+	/usr/bin ${HOME} && -eu sed local cd awk "$@" ${HOME} ${HOME} cd grep
+	&& /usr/bin done 2>/dev/null then --verbose x=1 grep then local
+| awk local "$1" sed | local grep x=1 -eu grep
+${HOME} ${HOME} 'quoted text' cd 2>/dev/null then export
+		$(pwd) -eu done awk echo awk cd sed test echo export | 'quoted text'
+readonly --verbose awk "$1"
+		cd ${HOME} local --verbose readonly export echo -eu 'quoted text' "$@"
+	$(pwd) cd /usr/bin -eu "$@" sed test printf 'quoted text'
+	cd x=1 grep grep | | echo &&
+/usr/bin done printf printf test /usr/bin
+	echo && grep done -eu "$1" cd grep "$1" awk done export 2>/dev/null
+grep then grep 2>/dev/null export
+	cd --verbose 'quoted text' export cd "$1" then $(pwd) readonly
+		/usr/bin /usr/bin /usr/bin grep ${HOME} && printf --verbose | export
+	cd 'quoted text' -eu readonly test then echo "$1" $(pwd) /usr/bin "$@"
+		&& "$@" printf /usr/bin /usr/bin
+printf grep "$@" awk done done printf sed sed && cd 'quoted text' cd sed
+		cd readonly echo grep | printf sed echo
+		awk sed sed done /usr/bin export awk then --verbose done
+		export readonly -eu "$@" local then then export $(pwd) then
+'quoted text' echo 'quoted text' echo "$@" then -eu sed 2>/dev/null local cd
+	2>/dev/null echo cd "$@" "$@" done then grep 2>/dev/null "$@" test readonly
+readonly echo | then x=1 && 2>/dev/null
+awk | $(pwd) && && "$1" && then 'quoted text' && readonly export && export
+	done && ${HOME} x=1 2>/dev/null /usr/bin 2>/dev/null
+	"$1" test | "$@" /usr/bin -eu sed -eu export -eu then "$1" 2>/dev/null
+| | && -eu grep export printf "$1" --verbose then 'quoted text'
+		test readonly $(pwd) 2>/dev/null grep readonly local
+	x=1 then --verbose cd --verbose $(pwd) --verbose
+	&& export "$1" readonly "$@" | cd printf && $(pwd) cd $(pwd) ${HOME}
+		&& then x=1 /usr/bin 2>/dev/null 'quoted text' --verbose cd && /usr/bin
+local grep export test then then
+		awk grep grep sed /usr/bin local
+	-eu echo 2>/dev/null printf ${HOME} sed grep && 2>/dev/null awk
+printf readonly && -eu "$@" readonly done grep x=1 | $(pwd) 2>/dev/null
+		/usr/bin ${HOME} --verbose export ${HOME} printf x=1
+	${HOME} "$1" echo 2>/dev/null
+		"$@" cd printf ${HOME} ${HOME} | echo "$@" x=1 test echo grep 2>/dev/null cd
+		"$1" /usr/bin cd /usr/bin grep
+		| readonly | -eu local done sed sed done x=1 && grep --verbose readonly -eu 'quoted text'
+		sed printf readonly readonly grep awk --verbose "$1" grep test -eu $(pwd) ${HOME}
+		$(pwd) grep "$1" $(pwd) "$@" -eu
+	grep readonly && readonly "$@"
+	readonly ${HOME} "$@" sed 2>/dev/null
+	printf printf test readonly
+		$(pwd) x=1 | sed echo sed sed "$@"
+	x=1 awk readonly | "$@" && awk cd 2>/dev/null x=1 && then awk printf
+readonly then -eu 2>/dev/null
+		--verbose ${HOME} grep 2>/dev/null readonly sed 'quoted text'
+		$(pwd) test ${HOME} -eu awk export /usr/bin sed export then 'quoted text'
+	&& x=1 | done "$1" x=1 sed && grep "$1" ${HOME} test grep
+		test --verbose echo "$1" -eu | readonly x=1 x=1 test x=1 cd readonly
+		grep --verbose printf "$1" x=1 | cd -eu -eu x=1 -eu
+	/usr/bin --verbose "$1" export x=1 | then readonly 2>/dev/null local
+	-eu x=1 | test test done awk "$1" $(pwd) && -eu x=1 done
+		grep | --verbose "$1" | test export
+	'quoted text' awk echo local
+	-eu "$@" grep && --verbose -eu export then "$1" -eu grep then /usr/bin
+	${HOME} echo grep $(pwd) ${HOME} test local &&
+	&& awk "$@" "$1" ${HOME} local 2>/dev/null export sed --verbose
+--verbose local $(pwd)
+	done test cd test 'quoted text'
+	x=1 echo test awk sed 2>/dev/null readonly
+${HOME} 2>/dev/null --verbose x=1 done /usr/bin
+grep | --verbose grep readonly --verbose
+	--verbose cd /usr/bin local
+		readonly test -eu /usr/bin test grep local echo sed "$1"
+readonly && readonly test --verbose test && "$1" /usr/bin -eu done $(pwd)
+	readonly -eu "$1" "$1" -eu sed then cd "$@" cd test -eu && awk then x=1 --verbose
+	export | echo grep readonly --verbose ${HOME}
+		/usr/bin | awk --verbose cd -eu 'quoted text' test 'quoted text'
+$(pwd) test awk "$@" cd | x=1 readonly "$@" x=1 ${HOME} echo
+		| readonly test test "$1" 2>/dev/null grep
+		-eu awk ${HOME} --verbose readonly | echo "$@" awk ${HOME} export
+		grep cd printf --verbose && --verbose
+		'quoted text' /usr/bin local
+| cd --verbose readonly sed ${HOME} awk local readonly
+-eu x=1 sed test sed readonly 2>/dev/null 2>/dev/null test echo
+	readonly readonly x=1 done | local "$1" grep
+	&& -eu 'quoted text' echo --verbose test local "$1" x=1 readonly echo export
+		grep then sed cd sed x=1
+		printf echo 'quoted text'
+		printf | test cd printf $(pwd) | 2>/dev/null -eu $(pwd)
+	-eu "$1" readonly cd x=1 2>/dev/null printf local x=1 readonly 'quoted text' |
+"$@" 'quoted text' /usr/bin echo ${HOME} -eu $(pwd) sed then ${HOME}
+grep echo ${HOME} x=1 'quoted text' local printf ${HOME} printf
+	-eu cd local 2>/dev/null
+	-eu $(pwd) $(pwd) ${HOME} --verbose cd ${HOME} export
+/usr/bin echo grep $(pwd)
+	export 2>/dev/null "$@" $(pwd) cd 2>/dev/null
+local export printf awk printf ${HOME}
+	"$1" done && export -eu /usr/bin 'quoted text' "$1" -eu
+awk $(pwd) ${HOME} | readonly test ${HOME} -eu echo sed --verbose
+		'quoted text' export local cd test cd then export
+		$(pwd) done "$@" sed | --verbose "$@" -eu && x=1 awk test test "$@" && 'quoted text'
+		grep "$1" then x=1 "$@" local "$@" /usr/bin export --verbose printf | /usr/bin
+	-eu 2>/dev/null local sed test 2>/dev/null printf echo awk --verbose
+		export printf readonly cd echo readonly
+grep 2>/dev/null export echo "$@" test test sed 'quoted text' "$1" printf
+/usr/bin && ${HOME} echo
+printf /usr/bin local && readonly
+		"$1" x=1 /usr/bin sed
+x=1 "$1" local then "$@" then local 2>/dev/null test readonly readonly
+		| /usr/bin test export --verbose printf grep && &&
+		test 'quoted text' grep
+		export $(pwd) awk then export test sed then -eu grep awk -eu 2>/dev/null cd /usr/bin
+	sed ${HOME} local grep sed awk readonly | "$@" "$1" $(pwd) done "$1" awk export
+sed grep export 'quoted text' then
+--verbose && /usr/bin -eu $(pwd) $(pwd) "$1" 'quoted text'
+		"$@" "$1" -eu readonly "$@" test && test
+		${HOME} --verbose local x=1 -eu readonly -eu local 'quoted text' |
+	local "$@" cd /usr/bin $(pwd) 2>/dev/null awk test readonly -eu x=1 --verbose
+x=1 'quoted text' local done
+/usr/bin "$1" awk 2>/dev/null "$@" x=1 then sed
+		$(pwd) && "$1" ${HOME} grep sed ${HOME} ${HOME} grep grep 'quoted text'
+'quoted text' echo 'quoted text' ${HOME} && /usr/bin $(pwd) grep 2>/dev/null test
+	local sed readonly -eu
+	"$@" x=1 "$1" echo $(pwd) 'quoted text' $(pwd) && "$@"
+	--verbose x=1 | done 'quoted text' $(pwd) /usr/bin | local -eu ${HOME} | -eu
+		echo printf cd | --verbose awk "$@" -eu 'quoted text' "$@"
+		sed awk grep | "$1" grep /usr/bin --verbose 2>/dev/null $(pwd) ${HOME} 2>/dev/null
+	grep done grep /usr/bin x=1 | -eu echo $(pwd) export ${HOME} grep
+	| 2>/dev/null awk && $(pwd) $(pwd) test readonly "$@" 'quoted text' ${HOME} "$@"
+grep done -eu cd 2>/dev/null test "$1" cd x=1 awk echo test | awk
+	| echo test export /usr/bin
+	then cd x=1 "$1" test | "$1"
+	printf "$@" then echo printf
+	cd $(pwd) | "$1" 'quoted text' "$1" x=1 "$1" local x=1 -eu && echo local
+	"$@" printf "$@" x=1 echo readonly --verbose
+then && echo sed && readonly sed local local x=1 awk $(pwd) echo && cd then
+/usr/bin echo readonly grep export x=1 local
+sed x=1 -eu 'quoted text' then
+| "$1" printf $(pwd) --verbose | export 'quoted text'
+		/usr/bin ${HOME} ${HOME} 'quoted text'
+'quoted text' "$@" export ${HOME} $(pwd) && echo export --verbose $(pwd)
+	then && cd /usr/bin sed awk "$1" "$1" --verbose then ${HOME} $(pwd)
+		cd /usr/bin $(pwd) test echo cd sed test ${HOME} && sed "$@" 2>/dev/null cd ${HOME}
+	'quoted text' --verbose awk
+		grep "$1" --verbose --verbose x=1 sed x=1 2>/dev/null 2>/dev/null local |
+printf awk /usr/bin printf x=1 sed printf
+	${HOME} 2>/dev/null grep done printf grep -eu "$@" cd 2>/dev/null && -eu
+test test test x=1 | cd | grep --verbose local echo echo "$@" sed export |
+&& cd cd printf | 2>/dev/null
+echo cd /usr/bin $(pwd) test printf ${HOME} 'quoted text'
+${HOME} x=1 then then -eu 2>/dev/null awk | -eu sed printf
+sed grep | ${HOME} --verbose readonly
+	echo grep echo then "$1" export && "$@" "$1" ${HOME} |
+		test local done ${HOME} $(pwd) printf
+	readonly grep -eu export
+	x=1 printf | printf /usr/bin 2>/dev/null export
+		"$1" --verbose export cd grep awk awk | printf 2>/dev/null
+	then sed done /usr/bin $(pwd)
+export export && ${HOME} && grep $(pwd) | -eu printf
+	&& echo "$@" 2>/dev/null sed awk
+	grep 'quoted text' printf awk export grep export x=1 |
+--verbose echo x=1 "$@" "$1" /usr/bin x=1 cd export
+		test x=1 ${HOME} done then $(pwd) 'quoted text'
+		sed && x=1 --verbose test 'quoted text'
+		| grep cd -eu --verbose "$1" 2>/dev/null "$@" 2>/dev/null
+		cd "$@" echo then sed "$@" awk "$1" test local echo 2>/dev/null
+${HOME} ${HOME} "$@" done $(pwd) echo grep
+		local 'quoted text' echo done "$1" grep awk -eu readonly
+		2>/dev/null 'quoted text' "$1" readonly "$@" "$@" done -eu done -eu
+	cd test "$1" export readonly 'quoted text' export then "$@" cd | local ${HOME}
+		"$@" awk 'quoted text' ${HOME} test
+local $(pwd) "$1" "$@" cd "$1"
+	printf $(pwd) cd readonly x=1 awk grep x=1 --verbose "$@" "$1" awk /usr/bin grep
+		--verbose "$1" $(pwd) local -eu grep
+	echo "$1" echo awk ${HOME} 'quoted text' /usr/bin export 2>/dev/null
+	readonly then $(pwd) $(pwd) readonly printf readonly
+	local then "$@" sed --verbose readonly
+	local done readonly $(pwd) readonly done | | x=1 "$1" cd && -eu ${HOME} 'quoted text'
+	$(pwd) local && "$@" cd export echo done printf
+	-eu -eu printf "$1" | cd done 2>/dev/null
+-eu export --verbose --verbose 'quoted text' "$1"
+	sed cd test 'quoted text' local $(pwd) ${HOME}
+		echo "$@" then 2>/dev/null
+	printf printf && /usr/bin | echo done 2>/dev/null ${HOME} |
+		/usr/bin $(pwd) echo ${HOME} "$@" 2>/dev/null grep cd "$1" echo readonly x=1 local
+		2>/dev/null printf done readonly awk /usr/bin then awk "$@" local
+--verbose echo $(pwd) 'quoted text'
+	awk test then sed "$@" 'quoted text'
+	--verbose echo --verbose
+local then echo 'quoted text' export printf echo done
+export then --verbose /usr/bin export printf test "$@" local
+		echo ${HOME} local $(pwd) grep 'quoted text'
+awk --verbose ${HOME} x=1 "$1" -eu &&
+		$(pwd) x=1 cd sed sed grep sed
+		printf && -eu then ${HOME}
+${HOME} done "$1" "$1" ${HOME} --verbose ${HOME} "$@" readonly
+	| "$@" $(pwd) readonly local export
+	sed echo --verbose local x=1 $(pwd) printf
+	echo printf 'quoted text' grep printf echo 'quoted text'
+		echo cd done "$@" export echo x=1 | -eu export echo test sed 2>/dev/null
+		-eu | 2>/dev/null /usr/bin then "$1"
+		| -eu | $(pwd) ${HOME} sed x=1 "$1" awk then grep --verbose
+	| grep 2>/dev/null then sed -eu done ${HOME} -eu x=1 --verbose /usr/bin
+		$(pwd) 2>/dev/null -eu done 2>/dev/null
+echo awk done "$1" sed then 'quoted text'
+	then 'quoted text' && sed done $(pwd) -eu | 2>/dev/null test "$@" then &&
+		cd ${HOME} -eu sed --verbose x=1 2>/dev/null export 'quoted text' grep "$@"
+| | $(pwd) export "$1" --verbose "$1" done --verbose
+		readonly sed awk grep --verbose /usr/bin x=1 awk grep "$@" grep cd echo | &&
+test --verbose $(pwd) "$1" then done | --verbose
+		&& ${HOME} test cd echo awk test awk 2>/dev/null "$@" | test
+	printf test | /usr/bin "$@" "$@" then sed $(pwd) && -eu "$1" && $(pwd)
+| awk local awk awk 2>/dev/null
+	test 'quoted text' readonly x=1 "$1" --verbose printf ${HOME} done 'quoted text'
+/usr/bin grep export awk /usr/bin
+then test export readonly x=1 'quoted text' sed
+/usr/bin echo then "$1" $(pwd) export
+&& -eu local x=1 test readonly "$@"
+		'quoted text' readonly grep then "$1" done "$@" 2>/dev/null -eu ${HOME} local
+	/usr/bin -eu 2>/dev/null local "$@" echo x=1 -eu sed -eu "$1" then -eu local $(pwd)
+export x=1 $(pwd) "$@" 'quoted text'
+		$(pwd) local grep readonly export then grep done export x=1
+		awk 'quoted text' then sed awk ${HOME} --verbose x=1 x=1 /usr/bin test "$@" $(pwd)
+'quoted text' --verbose grep 'quoted text'
+readonly --verbose 'quoted text'
+		cd sed cd | $(pwd) cd && "$1" awk 'quoted text'
+x=1 printf $(pwd) $(pwd)
+		sed done | echo printf && "$1"
+	then "$1" 'quoted text' -eu
+		done 'quoted text' then
+	awk "$@" cd cd x=1 local
+	sed echo | ${HOME} cd sed local echo 'quoted text' /usr/bin 'quoted text'
+	done 'quoted text' test 'quoted text' test export awk sed export "$1"
+	${HOME} 'quoted text' sed echo && done done "$@" x=1 | done readonly -eu
+	--verbose "$@" "$@" --verbose | printf ${HOME} cd "$1" readonly
+		cd grep done 2>/dev/null grep --verbose sed sed awk x=1 readonly
+		| "$@" done /usr/bin -eu then ${HOME} --verbose echo "$1" test
+		local 2>/dev/null -eu 'quoted text' && -eu done x=1 cd
+	export "$@" awk readonly x=1 readonly grep local
+	grep "$1" | then done done ${HOME} local && x=1 test $(pwd)
+	export readonly /usr/bin 2>/dev/null
+/usr/bin then awk test readonly readonly x=1 done /usr/bin then ${HOME}
+'quoted text' local local done grep
+		printf | /usr/bin "$@" /usr/bin printf grep grep /usr/bin cd readonly 2>/dev/null
+"$1" $(pwd) && echo ${HOME} sed done
+	${HOME} local grep $(pwd)
+	"$1" "$1" 2>/dev/null "$@"
+		-eu sed | /usr/bin sed | sed 2>/dev/null echo readonly grep
+	"$@" ${HOME} ${HOME} printf 'quoted text'
+		'quoted text' printf && /usr/bin done && "$1"
+done "$@" | x=1 2>/dev/null sed && then --verbose printf
+	&& readonly -eu awk readonly cd 'quoted text' local
+then local readonly export grep --verbose
+	-eu done sed grep | then test 2>/dev/null test --verbose local printf 'quoted text'
+x=1 export printf && "$1" sed ${HOME} echo "$@" local then readonly
+	then --verbose sed 'quoted text' printf awk awk awk | 2>/dev/null
+		export grep | "$@" 2>/dev/null test local -eu /usr/bin ${HOME} then then cd
+	'quoted text' /usr/bin $(pwd) echo
+		then sed "$@" x=1 "$@" export echo 2>/dev/null done && -eu "$1" then
+		'quoted text' $(pwd) export --verbose --verbose readonly sed test sed echo
+		sed done 'quoted text' readonly printf | echo 2>/dev/null cd "$@" grep
+		cd x=1 "$@" printf && cd done -eu export awk ${HOME} readonly cd printf
+		grep test cd 'quoted text' x=1 readonly x=1 echo readonly sed
+/usr/bin readonly then ${HOME} | $(pwd) x=1 x=1 ${HOME} then
+--verbose grep printf --verbose --verbose
+	printf export echo done local -eu x=1 | sed awk -eu 2>/dev/null test
+	local export awk test then "$@" grep | export /usr/bin
+		/usr/bin /usr/bin export ${HOME}
+/usr/bin -eu x=1 echo cd
+printf 2>/dev/null cd then then grep | readonly
+$(pwd) export test $(pwd) awk sed test -eu -eu sed export /usr/bin -eu done 2>/dev/null
+		export test readonly "$@" --verbose local "$1" local test printf -eu then sed
+${HOME} done then sed printf 2>/dev/null grep readonly
+		'quoted text' ${HOME} echo x=1
+x=1 $(pwd) -eu printf test local test --verbose
+	export sed echo test "$1" awk awk --verbose local && local "$@" "$1" -eu 'quoted text'
+	sed ${HOME} x=1 "$@" /usr/bin test
+	x=1 && local then echo x=1 "$1" then "$@" "$1" -eu
+	test export done echo printf /usr/bin $(pwd)
+echo echo local ${HOME} $(pwd) sed &&
+	readonly --verbose --verbose --verbose 'quoted text'
+		printf ${HOME} 2>/dev/null "$1" $(pwd) grep --verbose --verbose grep awk
+| /usr/bin --verbose then 2>/dev/null
+grep local echo && sed test cd "$1"
+sed "$@" "$@" done local
+	| export awk -eu then test local awk export "$1" printf done
+echo x=1 then --verbose 'quoted text'
+		grep x=1 x=1 && ${HOME} 2>/dev/null echo test /usr/bin --verbose
+	x=1 $(pwd) echo x=1 -eu test readonly
+		grep cd readonly export echo | test export local done done
+&& local export sed grep done local printf readonly && --verbose
+'quoted text' --verbose awk test x=1 local /usr/bin printf readonly x=1 readonly
+$(pwd) readonly | && then test cd awk /usr/bin printf
+		'quoted text' "$@" export
+		done echo export 2>/dev/null test
+	${HOME} awk -eu export 'quoted text' done 'quoted text' --verbose
+		--verbose && x=1 local x=1 export grep export awk 2>/dev/null "$@" cd test
+		readonly --verbose readonly "$@" "$@" /usr/bin sed 'quoted text' ${HOME} 'quoted text'
+export done readonly "$1" 'quoted text' awk
+x=1 done test sed /usr/bin sed
+		printf -eu awk cd -eu $(pwd)
+/usr/bin && test x=1 |
+	local export cd cd 'quoted text' | 2>/dev/null
+		'quoted text' "$@" | "$1"
+		readonly $(pwd) "$1" done x=1 done 2>/dev/null awk ${HOME}
+	$(pwd) $(pwd) && done -eu done export "$1" "$@" then
+		done local done $(pwd) then cd export done /usr/bin
+x=1 awk grep readonly -eu 'quoted text' --verbose --verbose x=1 cd local
+		| "$@" export $(pwd) grep export --verbose cd -eu cd grep --verbose cd grep
+		'quoted text' 'quoted text' /usr/bin awk cd && 'quoted text'
+export local done 2>/dev/null awk --verbose echo $(pwd) grep ${HOME}
+	&& && $(pwd) ${HOME} export --verbose grep
+		"$@" echo printf "$1" | "$@"
+echo echo cd echo cd $(pwd) cd -eu
+	echo sed local ${HOME} /usr/bin --verbose
+		| then --verbose test done echo test cd done x=1
+done local printf cd done
+		${HOME} then $(pwd) export done --verbose | ${HOME} cd done -eu sed /usr/bin
+		test && echo cd "$1" local cd x=1 cd local
+2>/dev/null /usr/bin awk done
+2>/dev/null local test 'quoted text' "$1" "$@" |
+grep printf /usr/bin awk "$@" export export --verbose -eu /usr/bin --verbose /usr/bin
+		"$1" then cd then ${HOME} "$1" x=1
+	printf | x=1 ${HOME} -eu done grep && $(pwd)
+then 2>/dev/null grep x=1 export 2>/dev/null ${HOME} && &&
+		then "$@" --verbose printf ${HOME}
+readonly $(pwd) printf | echo ${HOME} "$1" test local grep --verbose "$1"
+printf && cd ${HOME} sed local --verbose | sed 'quoted text'
+		/usr/bin test --verbose /usr/bin done awk "$@" then then $(pwd)
+		test printf done printf --verbose sed sed $(pwd) printf 2>/dev/null
+		local readonly printf then | --verbose printf readonly
+	'quoted text' 2>/dev/null awk test local 2>/dev/null /usr/bin then 2>/dev/null
+&& then "$1" readonly | cd test done | x=1 local awk /usr/bin done readonly
+${HOME} $(pwd) cd cd ${HOME}
+-eu 'quoted text' /usr/bin then printf then cd && cd "$1" "$1"
+	then printf /usr/bin done echo --verbose $(pwd) -eu | sed 'quoted text' --verbose
+	&& then 'quoted text'
+	"$@" awk test echo "$1" local local && awk awk --verbose
+		| x=1 awk --verbose readonly export |
+	done "$@" -eu sed && echo done && printf echo /usr/bin grep "$@"
+	printf sed cd sed printf "$1" | /usr/bin --verbose && 2>/dev/null "$1" then
+		x=1 "$1" $(pwd) 'quoted text' test 2>/dev/null printf ${HOME} ${HOME} 2>/dev/null
+done printf printf sed echo done --verbose $(pwd)
+		readonly sed 2>/dev/null x=1 | /usr/bin awk
+"$1" --verbose | cd -eu 2>/dev/null 2>/dev/null echo awk | --verbose
+	'quoted text' awk local test 2>/dev/null cd printf local x=1
+		then x=1 2>/dev/null 2>/dev/null awk 'quoted text' 2>/dev/null /usr/bin
+--verbose export x=1 "$1" 2>/dev/null local "$1" 'quoted text' done
+		cd /usr/bin /usr/bin test cd awk -eu x=1 "$1" grep 2>/dev/null -eu $(pwd)
+"$1" 2>/dev/null local $(pwd)
+		readonly grep | done ${HOME} local printf --verbose awk "$@" "$1" x=1
+	printf | then printf 'quoted text' | -eu awk 2>/dev/null
+	/usr/bin 'quoted text' grep
+"$1" $(pwd) && ${HOME} sed cd -eu export awk cd
+		then "$@" && awk 2>/dev/null sed | 2>/dev/null --verbose cd printf /usr/bin
+then readonly test x=1 printf "$@"
+		then local test export ${HOME} grep cd awk export x=1
+	done awk done -eu awk export | 2>/dev/null ${HOME} then echo 'quoted text' readonly
+	export && done readonly $(pwd) $(pwd) --verbose cd readonly ${HOME} cd 2>/dev/null
+	done then done echo readonly 2>/dev/null "$1" awk
+	-eu "$@" && -eu readonly test
+		| --verbose then printf echo
+	then sed "$1" -eu | awk export then x=1 'quoted text'
+		/usr/bin "$1" --verbose x=1 2>/dev/null
+	readonly sed ${HOME} 2>/dev/null local /usr/bin test
+--verbose -eu 'quoted text' --verbose $(pwd) ${HOME} awk --verbose
+		local --verbose $(pwd) -eu | echo printf && grep local echo sed cd printf echo
+done local x=1 test then
+	done test -eu 'quoted text' readonly
+	done /usr/bin | ${HOME} sed sed export -eu
+grep printf export "$1" then && local 'quoted text'
+	--verbose "$@" 2>/dev/null printf awk "$1"
+	printf "$@" /usr/bin /usr/bin | printf test /usr/bin && -eu
+		/usr/bin awk 2>/dev/null
+readonly --verbose $(pwd)
+readonly && awk --verbose cd
+	x=1 ${HOME} $(pwd) 2>/dev/null sed then && 2>/dev/null
+		sed then --verbose --verbose 2>/dev/null
+	printf readonly awk awk done local 2>/dev/null --verbose x=1 $(pwd)
+	cd echo then sed x=1 --verbose cd
+	export echo -eu test "$1" awk $(pwd)
+/usr/bin /usr/bin -eu printf "$1" 'quoted text' && "$@"
+--verbose ${HOME} grep then test then readonly ${HOME} echo | local export 'quoted text'
+readonly sed awk printf 'quoted text' -eu
+	"$1" local local --verbose --verbose ${HOME}
+		-eu x=1 printf 'quoted text' local "$@" -eu export export
+cd x=1 sed $(pwd) then done ${HOME} $(pwd) 2>/dev/null
+	/usr/bin echo | -eu | done grep ${HOME} "$@" && test
+printf then local 'quoted text' awk 'quoted text' sed grep
+		$(pwd) sed && grep |
+	cd test echo 'quoted text' then 'quoted text' "$1"
+		$(pwd) echo "$@" cd "$@" 'quoted text'
+| readonly awk --verbose | 'quoted text' printf ${HOME} ${HOME} sed cd
+		awk grep "$@" grep then then awk sed done done -eu x=1 echo export "$@"
+		"$1" test -eu then "$1" ${HOME} | "$@" "$@" awk echo ${HOME}
+		export -eu printf | 'quoted text' 2>/dev/null && cd done export "$1" "$@" readonly
+	$(pwd) 2>/dev/null awk $(pwd) | grep ${HOME} | readonly $(pwd) cd "$1"
+grep echo $(pwd) grep /usr/bin readonly test grep
+| 2>/dev/null local then "$@" awk "$1" sed "$@" 2>/dev/null ${HOME} 2>/dev/null
+/usr/bin awk test cd readonly
+	| awk readonly $(pwd) $(pwd) -eu then ${HOME}
+-eu awk echo 2>/dev/null
+		export cd done /usr/bin x=1 echo local 2>/dev/null | local cd cd grep x=1
+"$@" "$@" export sed then sed /usr/bin
+| echo --verbose printf export ${HOME} local export then printf sed
+		export && done && x=1 /usr/bin --verbose -eu ${HOME} grep --verbose --verbose
+	echo then $(pwd) sed cd
+		printf sed local /usr/bin x=1 test x=1 $(pwd) x=1 done --verbose grep grep
+"$1" x=1 grep 'quoted text'
+	printf $(pwd) grep export "$@" --verbose
+local done -eu 'quoted text' printf local /usr/bin local 2>/dev/null
+	"$1" -eu $(pwd) 'quoted text'
+		$(pwd) then done | done printf 2>/dev/null "$1" 2>/dev/null sed
+&& printf x=1 grep awk then 2>/dev/null printf $(pwd) -eu x=1 sed grep x=1 $(pwd)
+	'quoted text' && -eu -eu "$1" --verbose printf local export export 2>/dev/null
+x=1 'quoted text' echo
+		printf -eu readonly --verbose
+	sed ${HOME} $(pwd) then printf export printf ${HOME} -eu 2>/dev/null echo readonly
+	echo local "$1" x=1 cd cd awk local 'quoted text'
+	$(pwd) export --verbose awk /usr/bin "$1" 'quoted text' printf
+${HOME} echo x=1 "$@" grep "$1" ${HOME} "$1" printf readonly
+2>/dev/null $(pwd) then done sed awk echo local readonly grep && /usr/bin sed
+		'quoted text' grep && x=1 x=1 test 'quoted text'
+	'quoted text' readonly echo test ${HOME} sed 'quoted text' local
+awk /usr/bin ${HOME} $(pwd) export awk --verbose $(pwd) done awk --verbose done
+		then | 2>/dev/null "$@" --verbose $(pwd) "$@"
+cd awk then cd /usr/bin "$1"
+test done 'quoted text' printf "$1" export sed then 'quoted text' echo
+/usr/bin "$@" 'quoted text' echo && $(pwd) then $(pwd) x=1 'quoted text'
+		${HOME} 'quoted text' grep done printf printf --verbose -eu test x=1 2>/dev/null
+		echo export done 'quoted text'
+		grep test cd /usr/bin grep awk grep local cd && x=1 ${HOME} 2>/dev/null
+awk "$@" done local x=1 'quoted text' /usr/bin 2>/dev/null
+	local -eu "$@" awk local done --verbose then && cd cd grep --verbose
+printf ${HOME} -eu local printf | grep && 'quoted text'
+-eu readonly "$1" printf export $(pwd) /usr/bin "$@" -eu local cd cd
+	done export printf sed echo 'quoted text' done
+		sed export grep --verbose && readonly readonly | && ${HOME} --verbose --verbose
+done local --verbose -eu 'quoted text' x=1 | export test cd --verbose | readonly
+cd "$1" readonly --verbose && readonly sed --verbose sed local then "$1"
+	'quoted text' -eu awk local
+	'quoted text' export test | x=1 "$1" | && --verbose 'quoted text' awk "$1" test
+		"$@" "$1" -eu | echo x=1 2>/dev/null sed /usr/bin /usr/bin 'quoted text'
+local x=1 cd done 'quoted text' "$@" done -eu readonly
+	"$@" --verbose then done
+		done "$1" printf | then -eu done export /usr/bin
+/usr/bin -eu test $(pwd) --verbose awk
+export "$1" cd /usr/bin && printf -eu x=1 grep test && grep x=1 awk /usr/bin
+grep export cd printf $(pwd) cd
+		sed done printf "$1" && grep test awk --verbose
+		cd local sed sed grep then ${HOME} "$1" readonly readonly --verbose $(pwd)
+	${HOME} export export /usr/bin -eu grep "$1" ${HOME}
+echo grep grep ${HOME} local local x=1 /usr/bin export readonly $(pwd) then
+	| export local | ${HOME} | && local
+		cd grep /usr/bin then cd awk done local "$@" readonly -eu 'quoted text'
+"$1" && "$1" --verbose && readonly 'quoted text' cd awk | printf "$@"
+		${HOME} printf x=1 readonly | --verbose
+$(pwd) test export awk x=1 x=1 readonly --verbose 'quoted text'
+		$(pwd) -eu export ${HOME} sed -eu -eu 'quoted text' echo 'quoted text' sed |
+		| grep done $(pwd) "$1" local echo ${HOME} 2>/dev/null
+		printf printf ${HOME} && printf ${HOME} $(pwd)
+		2>/dev/null $(pwd) --verbose
+		"$1" x=1 'quoted text' grep --verbose ${HOME} "$@"
+		&& -eu cd grep cd -eu x=1 local
+	| 'quoted text' grep /usr/bin $(pwd)
+	done 2>/dev/null printf grep
+		then -eu test done 'quoted text' | --verbose test "$1" "$@"
+	done echo --verbose -eu 2>/dev/null done "$@" then "$1"
+		"$@" && test echo sed /usr/bin awk local $(pwd) /usr/bin && test && $(pwd) then
+"$1" 'quoted text' ${HOME} export "$1" "$1" && sed cd local && sed
+	printf cd echo awk 2>/dev/null local local cd local 'quoted text' /usr/bin --verbose
+"$@" $(pwd) awk echo /usr/bin &&
+echo | "$@" echo && "$1" $(pwd) "$@" done echo awk x=1 /usr/bin grep export echo
+	-eu readonly $(pwd) printf 2>/dev/null --verbose x=1 readonly /usr/bin
+		export -eu local /usr/bin export echo "$1" then test printf 2>/dev/null
+	printf ${HOME} /usr/bin && then x=1 'quoted text' echo
+		local && awk -eu echo local cd
+	"$@" "$@" cd x=1 'quoted text' -eu && local then
+| test "$@" /usr/bin echo done test &&
+		"$@" awk awk awk && "$1" local then readonly && done ${HOME} 2>/dev/null
+2>/dev/null 2>/dev/null printf cd 'quoted text' awk printf
+--verbose "$@" "$1" local printf readonly ${HOME}
+done grep echo | /usr/bin $(pwd) done x=1 "$1"
+		/usr/bin cd readonly --verbose --verbose sed printf
+		'quoted text' "$@" test local
+	cd "$@" /usr/bin printf local cd printf done printf 'quoted text'
+"$1" x=1 echo then awk export 'quoted text' export awk sed --verbose
+		--verbose && $(pwd) 2>/dev/null awk && && then
+		x=1 then "$1" 2>/dev/null export then then readonly && | x=1 "$@" export --verbose
+"$1" grep readonly echo local cd readonly
+$(pwd) 'quoted text' "$@" | printf then
+		export "$1" printf | printf
+/usr/bin readonly 'quoted text' done done
+'quoted text' $(pwd) --verbose done then
+	then ${HOME} printf "$1" done 2>/dev/null local cd
+${HOME} then --verbose export ${HOME} then
+		test grep $(pwd) 'quoted text' export && awk 2>/dev/null
+		"$@" | done sed grep --verbose | then "$@" echo export $(pwd) awk grep export
+	cd printf grep grep then ${HOME} export
+&& cd test 2>/dev/null x=1 $(pwd) "$1" cd local grep export -eu 2>/dev/null
+		&& $(pwd) 2>/dev/null | test test
+	printf local $(pwd) printf "$@" export && grep printf "$@" export /usr/bin
+	/usr/bin cd test | grep 2>/dev/null
+	| "$1" "$1" 2>/dev/null $(pwd) --verbose $(pwd) sed readonly sed 'quoted text'
+done awk "$@" 'quoted text' local grep | awk export ${HOME} printf sed 'quoted text'
+cd 'quoted text' awk export | 'quoted text' cd ${HOME}
+		/usr/bin x=1 -eu && $(pwd) -eu printf awk && /usr/bin x=1 sed && awk ${HOME}
+then cd -eu -eu "$1" echo readonly echo local awk /usr/bin --verbose
+$(pwd) 'quoted text' 2>/dev/null grep | 'quoted text' grep 'quoted text'
+export sed -eu /usr/bin ${HOME}
+		cd done | x=1 then cd done --verbose test local export local &&
+'quoted text' 'quoted text' $(pwd) | test
+		$(pwd) x=1 | | awk printf && cd sed echo 'quoted text' "$@" readonly test
+echo "$@" -eu test awk printf | printf
+	grep readonly $(pwd) awk "$@"
+	awk test $(pwd) $(pwd) sed readonly ${HOME}
+	grep $(pwd) printf printf /usr/bin
+awk then readonly "$@" test readonly then
+printf 'quoted text' --verbose /usr/bin
+		done x=1 $(pwd) printf
+	| printf done --verbose done
+		echo | $(pwd) test cd printf printf $(pwd) "$1" printf --verbose
+		local 2>/dev/null cd done
+2>/dev/null --verbose $(pwd) $(pwd) done sed /usr/bin then
+--verbose cd -eu grep echo "$@" test "$@" awk "$1" "$@" /usr/bin
+	| then echo export cd then -eu 2>/dev/null
+	awk --verbose export "$1" test ${HOME} then
+	"$1" sed "$@" "$1" then ${HOME} -eu 'quoted text' "$1" "$@" 'quoted text'
+		$(pwd) export then export readonly 2>/dev/null then
+		cd 2>/dev/null sed local awk done sed sed "$@" local x=1
+$(pwd) "$1" echo "$1" test --verbose | --verbose 'quoted text' && | ${HOME}
+	2>/dev/null $(pwd) $(pwd) awk done export --verbose "$1" then | -eu export
+export $(pwd) export done done "$1" "$1" grep x=1 "$@" test "$1" "$@"
+		local cd --verbose "$1" $(pwd) local /usr/bin --verbose 2>/dev/null &&
+		test local | | -eu -eu done "$@" | sed "$1" $(pwd) "$@"
+awk cd /usr/bin "$1" "$1" local grep sed then then $(pwd)
+		grep test readonly -eu && 2>/dev/null --verbose cd /usr/bin -eu local printf ${HOME}
+"$1" /usr/bin && sed echo grep | x=1 then "$@" -eu 2>/dev/null x=1 cd "$@" | $(pwd)
+		'quoted text' sed && "$@" "$1" 'quoted text'
+'quoted text' 'quoted text' --verbose local 'quoted text'
+	&& sed $(pwd) grep export "$1" 'quoted text' -eu done grep "$1"
+		-eu /usr/bin grep && awk printf done | x=1 'quoted text' && grep
+		'quoted text' "$1" && && test
+${HOME} sed x=1 awk cd then test 'quoted text' | ${HOME} printf echo done
+"$1" && -eu -eu | -eu export grep ${HOME} | then "$@" 2>/dev/null
+done "$@" grep then | && "$@" export export -eu "$@" local 'quoted text'
+cd local sed done && export 2>/dev/null printf /usr/bin awk printf x=1 export
+	| sed done ${HOME} readonly echo && "$1" 'quoted text'
+	done x=1 grep --verbose grep sed
+	/usr/bin echo awk cd /usr/bin | readonly
+		"$@" ${HOME} | --verbose $(pwd) "$1" "$1" 2>/dev/null
+	'quoted text' "$1" 2>/dev/null done 'quoted text'
+	$(pwd) awk echo then && echo cd then "$@"
+	sed done echo /usr/bin "$1" --verbose
+	"$@" $(pwd) printf echo readonly && echo echo --verbose
+		sed | x=1 -eu $(pwd) local x=1 && | | 2>/dev/null /usr/bin printf readonly
+	&& --verbose grep -eu grep test printf x=1 ${HOME} local | --verbose -eu
+	"$@" -eu "$1" test echo ${HOME} $(pwd) local -eu ${HOME} ${HOME} done grep
+		awk /usr/bin export ${HOME} echo
+		&& sed $(pwd) ${HOME} && sed done then test sed echo -eu "$@"
+/usr/bin echo readonly "$@" "$@" local && && "$1" 'quoted text' "$@" "$1" test
+		awk "$@" x=1 grep test "$1" "$1" /usr/bin
+export awk printf test printf | cd "$1" | -eu /usr/bin /usr/bin 'quoted text'
+	grep ${HOME} x=1 "$1" --verbose
+	done readonly ${HOME} printf $(pwd) awk local done export awk sed
+	local grep cd --verbose 2>/dev/null local test done readonly echo echo 'quoted text'
+		"$1" awk -eu -eu done x=1
+${HOME} $(pwd) echo sed 'quoted text' grep export cd readonly $(pwd) local
+		"$1" /usr/bin cd -eu 'quoted text' /usr/bin 2>/dev/null "$1" 'quoted text' printf
+	"$1" -eu x=1 grep ${HOME} printf $(pwd) export
+	&& done local ${HOME} "$1" test 'quoted text' cd printf "$@" done sed
+	test ${HOME} $(pwd) awk --verbose --verbose
+	echo printf awk then then "$@" x=1 'quoted text'
+	/usr/bin | local -eu done grep local -eu 2>/dev/null
+		readonly ${HOME} /usr/bin 2>/dev/null readonly --verbose test ${HOME} -eu export
+	"$@" 2>/dev/null $(pwd)
+${HOME} done local 2>/dev/null && readonly $(pwd) awk local &&
+	'quoted text' readonly grep local grep cd 'quoted text' x=1 'quoted text' sed
+/usr/bin --verbose -eu && ${HOME} export /usr/bin
+	then echo echo && awk /usr/bin awk | $(pwd)
+printf export cd grep done "$@" export 'quoted text'
+	"$1" $(pwd) | --verbose readonly test
+echo local 'quoted text' export ${HOME} ${HOME} | 2>/dev/null
+"$@" test && readonly cd done grep 2>/dev/null 'quoted text'
+	grep ${HOME} readonly | awk /usr/bin $(pwd) "$1" --verbose x=1 'quoted text'
+cd printf -eu --verbose | 'quoted text'
+'quoted text' local then "$1" test /usr/bin grep local sed | "$@" readonly
+	'quoted text' grep echo local awk local 'quoted text'
+"$@" test done local awk ${HOME} export "$1" awk "$1" $(pwd) local | 2>/dev/null
+'quoted text' echo "$1" grep echo export
+	"$@" ${HOME} && "$@"
+		done && ${HOME} export cd $(pwd)
+	"$@" test | $(pwd) 'quoted text' && && then 'quoted text'
+	echo echo 'quoted text'
+"$@" 2>/dev/null 2>/dev/null test
+	$(pwd) printf sed "$1" printf cd export done $(pwd) 2>/dev/null readonly printf
+&& printf readonly export done printf 'quoted text'
+local /usr/bin "$@" awk -eu test cd
+		"$1" cd $(pwd) cd sed printf grep readonly | --verbose then local
+	"$@" printf printf printf local $(pwd) awk 'quoted text'
+"$1" test then printf export | "$@" printf && cd cd x=1 "$1" 2>/dev/null
+		echo -eu then "$1" x=1 && --verbose
+	grep -eu local $(pwd) 'quoted text' x=1 ${HOME} local cd printf 2>/dev/null
+test "$1" local local then readonly printf 2>/dev/null then
+	"$1" done printf ${HOME} 2>/dev/null 'quoted text' $(pwd) x=1 "$@" ${HOME}
+		local "$@" -eu test test
+		/usr/bin echo 2>/dev/null ${HOME} "$1" then then awk done printf
+	grep grep /usr/bin && cd 'quoted text' then
+test "$1" awk --verbose
+| | $(pwd) $(pwd) -eu && 'quoted text' "$1" export printf
+		printf "$@" "$1" | $(pwd) then readonly ${HOME} echo
+	local echo ${HOME} && 'quoted text' && "$@" awk ${HOME} test export --verbose &&
+then awk then echo readonly test && $(pwd) sed /usr/bin "$@" --verbose
+echo readonly awk 'quoted text' --verbose cd
+2>/dev/null "$1" export cd | printf
+	then -eu $(pwd) test && $(pwd) test
+'quoted text' readonly x=1
+		/usr/bin cd ${HOME} local
+	-eu "$1" echo printf ${HOME} then done
+	"$1" ${HOME} awk export grep readonly
+	-eu "$@" echo echo then
+	echo then sed cd /usr/bin 'quoted text' test --verbose readonly local printf
+cd && awk cd awk | ${HOME} local export x=1 "$@" cd export readonly ${HOME} grep
+	| && readonly --verbose ${HOME} readonly test x=1 --verbose printf $(pwd)
+x=1 ${HOME} printf local awk awk "$1" && sed "$1" --verbose grep x=1 |
+	grep --verbose done ${HOME} -eu
+done sed $(pwd) then x=1 awk $(pwd) 2>/dev/null | printf
+	${HOME} 2>/dev/null | 2>/dev/null
+	--verbose 'quoted text' | cd "$1" -eu "$1" ${HOME} "$@" grep local x=1 --verbose
+	printf "$@" $(pwd) x=1 done printf 2>/dev/null
+	/usr/bin awk $(pwd) then local
+done sed done -eu "$@" echo "$1" grep 2>/dev/null
+	test awk done grep 2>/dev/null $(pwd) --verbose
+	| awk printf 'quoted text' readonly 2>/dev/null 'quoted text' ${HOME} /usr/bin
+done /usr/bin 2>/dev/null done && && awk printf ${HOME}
+		grep x=1 export grep 2>/dev/null ${HOME} 'quoted text' /usr/bin
+	sed then readonly x=1 -eu x=1 grep
+		/usr/bin export export 'quoted text' 'quoted text' sed
+	--verbose 'quoted text' done local
+echo 'quoted text' 2>/dev/null
+	test "$@" done --verbose readonly awk 'quoted text'
+local -eu --verbose sed -eu readonly test --verbose 2>/dev/null export
+then | export && /usr/bin printf sed 'quoted text' sed x=1 echo --verbose "$@"
+	--verbose readonly test test "$1" $(pwd) readonly "$@" cd grep echo cd && printf
+	-eu | export x=1 | ${HOME} 'quoted text' printf awk echo && "$@" readonly printf
+readonly then && awk test cd awk local
+		$(pwd) $(pwd) $(pwd) then then echo /usr/bin --verbose 'quoted text'
+		&& export && export ${HOME} 'quoted text' readonly 2>/dev/null
+		"$@" cd 'quoted text' 2>/dev/null 'quoted text' export
+&& && done echo printf printf -eu $(pwd) -eu local $(pwd)
+	'quoted text' "$1" then -eu
+done echo readonly grep --verbose "$1" readonly done -eu x=1 grep "$@"
+grep | "$1" cd | test test grep ${HOME} | printf x=1 --verbose
+	echo echo "$1" echo cd
+		"$1" then awk $(pwd) export
+		2>/dev/null 2>/dev/null done /usr/bin
+	x=1 && cd then grep "$@" | echo done |
+		test then x=1 awk export printf cd echo 2>/dev/null sed /usr/bin "$1" done
+		printf cd && cd "$@" /usr/bin cd | sed $(pwd) ${HOME} -eu $(pwd)
+	then "$1" done "$@" 2>/dev/null
+	echo test 2>/dev/null done -eu "$@" printf
+export grep && cd x=1 $(pwd)
+		"$1" 2>/dev/null 2>/dev/null "$@" sed /usr/bin readonly
+x=1 local then $(pwd)
+	done done "$@" grep x=1 echo --verbose export
+		grep awk export cd sed then 'quoted text'
+	x=1 sed ${HOME} done 2>/dev/null sed test ${HOME} awk 'quoted text' x=1 test
+		&& x=1 sed --verbose 2>/dev/null | echo readonly x=1 cd "$@" then cd printf
+| grep printf then printf local
+		done grep export then sed "$1"
+	echo /usr/bin cd && export --verbose
+		then test awk -eu echo local ${HOME} readonly $(pwd)
+	| ${HOME} test ${HOME} then printf | echo --verbose /usr/bin "$1"
+		echo done awk then awk 'quoted text' /usr/bin
+		done /usr/bin awk "$1" 2>/dev/null | "$@" "$@" -eu sed local "$@" 'quoted text'
+export grep 2>/dev/null awk 'quoted text' | then 2>/dev/null "$@"
+&& 2>/dev/null 'quoted text' 'quoted text' -eu cd test awk && /usr/bin
+		printf done "$@" awk local
+-eu test "$1" | echo echo
+	test $(pwd) printf 2>/dev/null readonly sed done
+	grep export sed x=1 /usr/bin x=1 $(pwd) done export 'quoted text'
+		local $(pwd) then 2>/dev/null "$@" /usr/bin
+	$(pwd) sed readonly local -eu test grep x=1 echo echo
+awk && then test echo $(pwd) && --verbose ${HOME} 2>/dev/null x=1 && 'quoted text'
+x=1 echo /usr/bin x=1 local ${HOME} --verbose 2>/dev/null -eu readonly
+	| ${HOME} /usr/bin --verbose "$@" export x=1 --verbose grep then x=1 grep ${HOME}
+	done /usr/bin -eu cd "$1" readonly awk export test readonly export
+	/usr/bin local --verbose sed sed 2>/dev/null
+		x=1 "$1" "$1" ${HOME} x=1 ${HOME} | done echo && echo printf
+		&& test awk sed test && sed 'quoted text' done | then $(pwd)
+/usr/bin -eu test test /usr/bin sed
+x=1 $(pwd) awk --verbose --verbose sed then /usr/bin
+		grep done then local echo then && printf
+echo && readonly readonly | $(pwd) awk |
+	readonly cd local "$@" "$@" test ${HOME} then
+		done --verbose "$1" export
+		grep "$@" 2>/dev/null local readonly $(pwd) ${HOME} $(pwd) local 'quoted text'
+		$(pwd) awk local x=1 local && awk /usr/bin "$@" echo "$@"
+	--verbose echo /usr/bin done printf printf | -eu cd --verbose 'quoted text'
+	sed "$1" "$@" 2>/dev/null --verbose sed then -eu done then
+test local && awk -eu local | /usr/bin
+	readonly x=1 x=1 ${HOME} cd ${HOME}
+x=1 printf -eu test ${HOME} test x=1 --verbose | test echo /usr/bin && printf
+	echo readonly "$1" 'quoted text'
+test readonly 2>/dev/null printf x=1
+	x=1 "$1" -eu export -eu "$@" $(pwd) 2>/dev/null awk printf --verbose
+		readonly $(pwd) ${HOME}
+	printf readonly $(pwd) awk local 'quoted text'
+	export && sed --verbose local grep | export --verbose
+done sed --verbose "$@" local "$1" readonly | && local echo &&
+	| 'quoted text' echo readonly echo test awk test $(pwd) ${HOME}
+"$@" echo "$1" 'quoted text'
+${HOME} sed readonly $(pwd) export sed
+		'quoted text' $(pwd) echo done "$@" $(pwd) export export echo local echo
+		"$1" cd readonly sed readonly
+	'quoted text' awk export export x=1 awk echo 2>/dev/null readonly -eu sed -eu
+		x=1 readonly 'quoted text' test 2>/dev/null echo sed
+test export readonly | -eu -eu $(pwd) | --verbose
+		readonly test "$@" then test && "$1" | readonly x=1
+cd x=1 ${HOME} && test test && local export then
+	printf done sed done | ${HOME} test "$1" grep export "$@" cd ${HOME} echo
+	"$@" done | | then local /usr/bin 2>/dev/null
+${HOME} then then -eu && "$@"
+	then -eu echo awk sed ${HOME} 2>/dev/null --verbose $(pwd) test | cd local
+		readonly echo 'quoted text' local local
+$(pwd) && "$1" "$1" printf readonly 'quoted text'
+	echo cd 2>/dev/null "$1" local --verbose --verbose done local then && /usr/bin "$@"
+'quoted text' done then "$@" local ${HOME}
+${HOME} then x=1 export x=1 readonly export ${HOME} "$@" --verbose x=1 /usr/bin
+x=1 ${HOME} done sed echo export grep "$1" sed test awk export --verbose printf
+		awk 'quoted text' "$@" 'quoted text' printf
+		awk --verbose && -eu printf then echo cd /usr/bin
+	local "$1" 'quoted text' cd cd export test export
+		export sed /usr/bin local "$@" x=1 'quoted text' --verbose 'quoted text'
+	x=1 ${HOME} 'quoted text' 2>/dev/null
+local 'quoted text' x=1 -eu echo ${HOME} | export grep | $(pwd) -eu &&
+	&& $(pwd) 'quoted text' -eu local printf local && test ${HOME} readonly then &&
+2>/dev/null -eu x=1 'quoted text' -eu x=1 2>/dev/null sed
+| echo 'quoted text' echo then grep echo x=1
+		grep | awk $(pwd) /usr/bin 2>/dev/null grep printf then ${HOME} local /usr/bin
+	${HOME} -eu then grep "$1" ${HOME} 'quoted text' grep 'quoted text'
+test printf /usr/bin $(pwd) "$@" --verbose printf /usr/bin
+		local test && done done && && readonly | -eu test -eu then
+	test "$1" 'quoted text' /usr/bin
+	$(pwd) 'quoted text' then test then ${HOME} "$1" test x=1 readonly
+		echo --verbose sed /usr/bin export then /usr/bin
+echo 'quoted text' awk && echo
+		then | cd cd ${HOME} $(pwd) local | --verbose $(pwd) readonly done $(pwd)
+	export -eu echo sed --verbose -eu echo cd then $(pwd) | ${HOME}
+	"$@" awk 2>/dev/null && $(pwd) "$1" readonly echo -eu grep && test /usr/bin readonly
+		awk x=1 --verbose 2>/dev/null $(pwd) | /usr/bin ${HOME}
+		cd grep readonly test "$1"
+		then then export "$@" ${HOME}
+	--verbose awk && "$@" awk && --verbose --verbose
+		echo -eu local echo grep test "$1"
+	2>/dev/null $(pwd) && export awk "$1" "$1" 'quoted text'
+readonly export /usr/bin | ${HOME} grep "$@" echo --verbose sed
+	printf grep 2>/dev/null printf "$@" -eu ${HOME} x=1 -eu x=1 readonly
+	test grep sed /usr/bin "$1"
+-eu "$1" cd done ${HOME} --verbose test done grep /usr/bin x=1
+		&& sed test echo export && -eu ${HOME}
+		grep x=1 readonly 'quoted text' echo export --verbose
+	readonly awk -eu 2>/dev/null echo cd "$@" readonly "$@" "$1"
+x=1 -eu then | --verbose && sed then "$@" ${HOME} "$1" sed grep awk grep
+		cd /usr/bin "$1" done --verbose awk awk && | && echo --verbose grep | sed
+"$1" "$@" export echo
+"$@" 2>/dev/null "$@" sed local local && 'quoted text'
+then readonly 2>/dev/null --verbose export $(pwd)
+-eu then readonly | cd cd local --verbose sed
+		export "$1" awk -eu grep test printf awk /usr/bin readonly && $(pwd)
+	&& then test test -eu "$@" echo export cd grep $(pwd) printf
+	done readonly local then
+sed grep sed export "$@" test "$1" -eu --verbose "$@" "$1" --verbose -eu
+		then $(pwd) --verbose printf $(pwd) awk echo | printf cd local
+	readonly readonly $(pwd) echo 'quoted text'
+readonly test --verbose && done "$1" printf then x=1 ${HOME} $(pwd)
+	${HOME} --verbose done done sed
+sed 'quoted text' "$1" export -eu
+&& /usr/bin x=1 | | -eu readonly grep done
+x=1 -eu grep printf printf ${HOME} sed done export /usr/bin sed sed
+	--verbose local printf done | local readonly 'quoted text' test grep "$1"
+	then 2>/dev/null --verbose $(pwd) x=1 --verbose then /usr/bin echo
+		done x=1 printf 'quoted text' | && --verbose
+		sed $(pwd) awk cd then local 'quoted text' done 'quoted text'
+&& $(pwd) -eu grep done local --verbose
+then awk 'quoted text' $(pwd) --verbose
+		cd cd | $(pwd) --verbose test && $(pwd) 2>/dev/null readonly printf sed -eu
+	$(pwd) done -eu "$1" --verbose ${HOME} export export local
+		sed echo local printf --verbose readonly readonly -eu cd --verbose awk readonly
+	--verbose printf $(pwd) export /usr/bin cd echo local && readonly
+	then "$@" grep echo done done then grep printf grep export sed
+		${HOME} readonly /usr/bin "$@" "$1"
+		sed "$@" test | readonly
+export -eu local done then then | "$@" awk 'quoted text' cd sed -eu readonly "$1"
+"$@" done sed ${HOME} --verbose readonly /usr/bin local x=1 x=1 $(pwd)
+local -eu x=1 export | sed sed done readonly -eu printf
+	sed "$@" printf -eu export | x=1
+		${HOME} then x=1 2>/dev/null $(pwd) export awk echo
+	then && 2>/dev/null awk "$1" /usr/bin $(pwd) --verbose $(pwd) && readonly
+		awk grep sed local -eu cd echo x=1 /usr/bin 2>/dev/null /usr/bin printf --verbose
+		grep cd awk 2>/dev/null then --verbose test sed printf cd
+$(pwd) cd awk then grep printf
+"$@" && printf --verbose -eu done export
+		$(pwd) sed --verbose echo
+	awk cd printf -eu local awk
+		'quoted text' printf printf echo local ${HOME} grep
+		"$@" /usr/bin x=1 export local /usr/bin --verbose echo export
+		| $(pwd) 'quoted text' export local awk --verbose
+		done readonly awk && local x=1 --verbose local $(pwd) readonly then then ${HOME}
+2>/dev/null grep echo sed x=1 2>/dev/null ${HOME} && done sed x=1 "$@"
+		-eu done "$@" 2>/dev/null echo $(pwd) export "$1" $(pwd) x=1 && "$@"
+	readonly 'quoted text' local local ${HOME}
+--verbose --verbose grep | 2>/dev/null | --verbose
+	then ${HOME} grep readonly 2>/dev/null
+	"$1" 'quoted text' sed echo printf "$@" 2>/dev/null printf
+	then awk then $(pwd) grep /usr/bin export 'quoted text'
+	| echo /usr/bin -eu sed && && ${HOME} $(pwd) -eu -eu && cd "$1"
+		| printf done 2>/dev/null -eu "$@" done --verbose sed 2>/dev/null | then | "$@"
+		done ${HOME} export then "$1" grep 2>/dev/null done test printf $(pwd) -eu
+	local && 2>/dev/null --verbose echo awk
+	-eu x=1 test "$@" then readonly "$1" /usr/bin x=1 /usr/bin test | x=1 echo --verbose
+	-eu -eu "$@" | cd 'quoted text' && test && test && done awk done
+		$(pwd) -eu 'quoted text' export | export
+${HOME} "$@" | | printf local echo && "$@" 'quoted text' x=1 test
+| sed 'quoted text' printf x=1 export cd export local
+		&& sed --verbose && then done 2>/dev/null cd
+/usr/bin echo --verbose export
+cd test grep readonly grep done 2>/dev/null cd printf 2>/dev/null "$1"
+readonly x=1 done sed readonly x=1 readonly echo
+	printf sed 'quoted text' 'quoted text' 2>/dev/null ${HOME} test "$1"
+/usr/bin | && readonly done /usr/bin "$@" --verbose "$@" sed $(pwd)
+	grep export x=1 then $(pwd) "$@" awk
+then readonly test test readonly cd 2>/dev/null
+		| printf $(pwd) then then 'quoted text' local local test cd test cd local echo
+	--verbose awk --verbose sed cd sed --verbose
@@ -0,0 +1,2001 @@
+	"$@" test printf 'quoted text' local /usr/bin local export
+		grep local "$@" | done printf awk printf 2>/dev/null "$@" 2>/dev/null
+		export x=1 2>/dev/null done | export printf sed "$@" x=1 local cd 2>/dev/null
+		"$@" then then done x=1 then /usr/bin --verbose cd 'quoted text'
+	'quoted text' "$@" "$1" echo && local sed --verbose
+	'quoted text' grep ${HOME} test sed 2>/dev/null echo sed readonly export |
+		${HOME} "$@" | x=1 "$1"
+	-eu "$1" 'quoted text' ${HOME}
+		local "$@" "$@" x=1 done export "$1" cd
+		local sed ${HOME} sed $(pwd) grep 2>/dev/null "$@" | printf
+	sed sed -eu /usr/bin ${HOME} ${HOME}
+	local | 'quoted text' $(pwd) 2>/dev/null | printf local | sed -eu $(pwd)
+	export test "$@" -eu
+		&& grep local test test local "$1" "$@" $(pwd) x=1 grep $(pwd) export local x=1
+	$(pwd) cd "$1" cd ${HOME} sed "$1" echo
+		readonly "$@" "$1" 'quoted text'
+	${HOME} "$@" cd test 'quoted text' "$1" cd --verbose
+'quoted text' then then | 2>/dev/null printf && x=1
+"$@" done "$1" printf | x=1 "$1" 'quoted text' sed "$@" | sed
+	&& ${HOME} $(pwd) cd 2>/dev/null done grep ${HOME} 2>/dev/null
+	"$@" grep export --verbose "$1"
+/usr/bin echo ${HOME} | export | export then echo x=1
+| && echo echo sed -eu echo "$@" 'quoted text'
+	export | test -eu sed --verbose done echo readonly sed then local
+--verbose | 'quoted text' printf sed
+	sed done sed ${HOME} ${HOME} cd -eu echo $(pwd) local echo printf
+	/usr/bin printf grep &&
+		grep echo test ${HOME} 2>/dev/null readonly
+		awk done printf ${HOME} x=1 then "$1" cd --verbose local export cd grep 2>/dev/null
+		done --verbose 2>/dev/null readonly
+	done "$@" ${HOME} cd awk 'quoted text' then
+${HOME} readonly readonly awk local awk awk
+	${HOME} done && "$1" $(pwd) local $(pwd) --verbose
+		'quoted text' /usr/bin | grep done $(pwd) --verbose 'quoted text' readonly
+printf grep /usr/bin then done
+		export echo --verbose "$1" awk "$@" awk "$@" /usr/bin -eu --verbose test --verbose
+"$1" readonly "$1" readonly readonly /usr/bin
+	&& done --verbose -eu echo "$@" "$1" x=1
+"$@" readonly && /usr/bin "$@" $(pwd) 2>/dev/null readonly
+printf done /usr/bin local x=1 "$@" && done readonly "$1" $(pwd) -eu -eu
+	export | 'quoted text' /usr/bin cd grep
+local && export /usr/bin
+	export local 2>/dev/null done | 2>/dev/null 'quoted text' /usr/bin ${HOME}
+		echo -eu $(pwd) sed "$1"
+		sed | echo --verbose echo 'quoted text' 2>/dev/null readonly sed done then local
+| then -eu "$@" awk $(pwd) sed printf /usr/bin grep
+cd -eu -eu then | then echo cd "$1" $(pwd)
+	&& && awk readonly local echo x=1 then
+		&& --verbose 'quoted text' $(pwd) test export echo && "$1" export "$@" 'quoted text'
+		cd 2>/dev/null x=1 export 'quoted text'
+readonly done -eu test awk /usr/bin export printf echo x=1
+2>/dev/null -eu cd awk grep cd readonly echo "$1" grep then grep
+	x=1 cd export /usr/bin grep -eu grep
+&& local echo then grep awk readonly readonly cd --verbose 2>/dev/null grep
+| done | echo && $(pwd) done && | local cd echo --verbose $(pwd) grep
+		/usr/bin --verbose $(pwd) printf
+		cd 'quoted text' -eu grep test -eu && -eu x=1 readonly 'quoted text'
+awk "$@" printf export | export --verbose $(pwd) sed echo grep local done
+	done "$@" && cd | echo x=1
+	'quoted text' && "$@" echo -eu printf echo 'quoted text' done
+		grep sed awk $(pwd) -eu sed ${HOME} done && $(pwd)
+		grep readonly echo local
+	&& then cd | cd readonly readonly ${HOME} && awk readonly
+done test && cd $(pwd) 2>/dev/null grep 'quoted text' awk | "$@" "$1"
+		test cd awk /usr/bin 'quoted text' 'quoted text' /usr/bin /usr/bin
+	readonly awk | --verbose --verbose /usr/bin "$1" 2>/dev/null awk 2>/dev/null grep
+		2>/dev/null cd "$1" ${HOME} 2>/dev/null test echo echo sed && -eu test grep | sed
+then grep echo "$@" test 2>/dev/null && test /usr/bin
+	-eu -eu readonly sed test 'quoted text'
+readonly --verbose awk && | &&
+	then $(pwd) /usr/bin echo sed printf && "$1" printf x=1 local local | then ${HOME}
+	done "$1" export cd grep && readonly awk x=1 export local test
+		readonly --verbose echo /usr/bin
+	'quoted text' "$@" | awk awk export 'quoted text' cd /usr/bin export
+test "$1" awk export local done then echo export ${HOME} | awk
+		test local echo echo local "$1" awk then done printf
+	local cd sed done $(pwd) 'quoted text' 2>/dev/null test
+		test "$@" then local done awk -eu --verbose 2>/dev/null cd printf
+		$(pwd) "$1" awk --verbose -eu ${HOME}
+'quoted text' cd readonly /usr/bin 2>/dev/null 'quoted text' -eu
+test then 'quoted text' echo then then ${HOME} then --verbose
+"$@" awk | | readonly --verbose $(pwd) grep printf 2>/dev/null --verbose done
+	echo --verbose test grep "$1" x=1 printf --verbose
+		echo 2>/dev/null x=1 printf done "$1" readonly test test cd printf x=1 test --verbose
+		'quoted text' awk $(pwd) /usr/bin echo readonly "$1" $(pwd) local sed
+		readonly readonly cd 'quoted text' then grep /usr/bin local
+| test printf printf test "$@" "$@" awk | echo ${HOME} done && sed
+		"$@" | export done grep
+		grep done "$@" $(pwd) --verbose cd 2>/dev/null readonly grep test test
+	printf --verbose -eu export && | --verbose cd "$@"
+		grep readonly test test "$@" && sed "$@" test x=1 done printf grep export then
+	--verbose --verbose ${HOME} x=1 ${HOME} awk $(pwd) | readonly -eu test
+	cd grep x=1 then $(pwd) done
+	/usr/bin grep "$1" 'quoted text' --verbose x=1 && readonly export
+awk local then "$1" test 2>/dev/null $(pwd) test
+| -eu && $(pwd) local done sed "$@" cd export "$@" x=1 export && 2>/dev/null
+"$1" echo x=1 echo -eu 2>/dev/null 2>/dev/null -eu test cd done
+/usr/bin done ${HOME} grep 'quoted text' "$1" 2>/dev/null export local x=1 export
+"$1" /usr/bin "$@" test local
+	-eu sed then readonly grep $(pwd) cd echo && x=1 done ${HOME}
+	'quoted text' -eu export "$1" x=1 then
+"$@" export "$1" sed done ${HOME} export "$@" test awk ${HOME} | --verbose
+'quoted text' local awk awk readonly
+	export then 2>/dev/null -eu "$@" /usr/bin -eu done /usr/bin
+done test "$1" echo | 'quoted text' grep awk awk done sed /usr/bin
+		--verbose "$1" awk readonly test then x=1 --verbose sed 2>/dev/null | done export
+	"$@" -eu local awk grep sed ${HOME} export echo awk local
+export awk 2>/dev/null readonly readonly "$1" | then /usr/bin "$1" test export
+		| export local "$1" test test -eu cd x=1 local then export
+$(pwd) test done sed test "$1" "$1"
+		grep awk $(pwd) readonly then awk readonly awk sed sed export 2>/dev/null sed
+"$@" printf cd grep $(pwd) -eu ${HOME} x=1
+	export --verbose --verbose | export printf awk
+		"$@" printf && /usr/bin ${HOME} /usr/bin -eu done &&
+	sed local echo 'quoted text' sed 'quoted text'
+done readonly ${HOME} local 'quoted text' $(pwd) echo printf sed $(pwd)
+then export then then then awk
+	awk "$@" | -eu sed /usr/bin cd test readonly
+&& test 'quoted text' echo 'quoted text'
+		grep && ${HOME} 'quoted text' local
+	"$1" sed "$1" readonly awk sed done 'quoted text'
+		-eu grep cd --verbose echo
+		x=1 "$@" awk && readonly local 2>/dev/null x=1 "$@" "$1" 2>/dev/null
+awk printf ${HOME} then sed sed && "$1" x=1 "$@" echo awk done
+		'quoted text' --verbose sed readonly export ${HOME} grep | done sed "$@"
+printf then "$1" printf sed done "$1" test x=1
+		export x=1 cd 'quoted text' /usr/bin 2>/dev/null
+	awk then 2>/dev/null test -eu
+		done ${HOME} --verbose
+${HOME} printf 'quoted text' | 'quoted text' cd readonly sed sed local echo
+		sed test test "$1" | echo 2>/dev/null printf ${HOME} readonly
+		awk | grep local then 2>/dev/null "$1" local
+	'quoted text' sed | sed ${HOME} "$@" done /usr/bin 'quoted text'
+		-eu echo awk ${HOME} 2>/dev/null awk
+		grep ${HOME} awk --verbose
+$(pwd) done x=1 'quoted text' $(pwd) 'quoted text'
+	-eu then && ${HOME} x=1 done awk 2>/dev/null sed x=1
+done done ${HOME} --verbose x=1 --verbose sed echo then /usr/bin export
+"$@" --verbose grep echo readonly sed 2>/dev/null | then awk x=1 then printf
+		done test awk local ${HOME} cd printf && -eu /usr/bin test
+done x=1 echo 'quoted text' done
+	'quoted text' /usr/bin && test printf /usr/bin "$1"
+	printf | ${HOME} done $(pwd) grep x=1 export -eu 2>/dev/null readonly
+printf && printf /usr/bin "$@" sed export test
+	done cd test "$1" grep
+--verbose $(pwd) test 2>/dev/null "$@" -eu cd "$@" x=1 done cd /usr/bin export
+		test "$1" test --verbose && /usr/bin -eu printf && /usr/bin readonly
+		printf 'quoted text' then
+	cd local 'quoted text' 'quoted text' && 'quoted text' x=1 grep "$1" test
+	export echo | readonly -eu && awk -eu x=1 test && done 'quoted text'
+/usr/bin /usr/bin awk x=1 /usr/bin
+		export /usr/bin "$1"
+	cd ${HOME} awk /usr/bin cd && cd x=1 echo 2>/dev/null /usr/bin local grep
+	--verbose done readonly && -eu "$1" /usr/bin ${HOME}
+-eu 'quoted text' sed 2>/dev/null test test -eu awk local x=1 "$1" ${HOME}
+local -eu /usr/bin && ${HOME} then done done | 2>/dev/null printf
+&& local | $(pwd) -eu then sed
+		done awk /usr/bin local then test printf 'quoted text' /usr/bin /usr/bin
+	| done 'quoted text' /usr/bin -eu $(pwd) && test done ${HOME}
+test ${HOME} 'quoted text' sed then done readonly awk x=1 'quoted text'
+		${HOME} export test 'quoted text' "$1" ${HOME} 'quoted text' /usr/bin test
+	then | -eu 2>/dev/null "$@" $(pwd) "$1"
+	$(pwd) echo $(pwd) done --verbose "$1" --verbose
+		test $(pwd) then then 2>/dev/null echo readonly "$1" /usr/bin $(pwd) cd cd "$1"
+x=1 export done $(pwd) done 2>/dev/null ${HOME} printf ${HOME} echo | && echo
+	cd | awk cd cd cd x=1 sed cd "$@" 2>/dev/null grep sed then
+		${HOME} ${HOME} test export local | -eu --verbose
+cd printf test 2>/dev/null echo "$1" sed 'quoted text' echo
+	"$1" 2>/dev/null $(pwd) | "$@" then echo echo sed printf "$@"
+printf export --verbose --verbose && sed -eu then ${HOME} cd | "$@" && "$@"
+x=1 /usr/bin $(pwd) then then -eu readonly sed readonly | --verbose
+	done then -eu export $(pwd)
+	export && "$1" 'quoted text' grep 'quoted text'
+		then "$1" && "$1" 2>/dev/null -eu --verbose
+	/usr/bin 'quoted text' 'quoted text'
+		/usr/bin "$@" 'quoted text' 2>/dev/null done "$1" $(pwd)
+		-eu 'quoted text' readonly sed 'quoted text' sed && -eu | local echo
+/usr/bin "$@" printf --verbose local x=1
+cd "$1" "$@" -eu done ${HOME} echo "$@" x=1 grep done --verbose readonly
+${HOME} "$1" $(pwd) export "$1" echo
+	"$1" x=1 sed | 'quoted text'
+awk --verbose then awk test test grep awk
+test grep export sed printf local awk done --verbose
+	-eu | done awk 2>/dev/null awk
+		2>/dev/null /usr/bin awk done 2>/dev/null "$@" then "$1" export ${HOME} local
+		export grep /usr/bin "$1" readonly grep export echo x=1 sed echo echo /usr/bin
+		cd | echo "$1" test $(pwd) $(pwd) x=1 export /usr/bin 'quoted text'
+/usr/bin | ${HOME} 'quoted text'
+	$(pwd) export sed printf awk $(pwd) printf /usr/bin --verbose && readonly
+		${HOME} cd 'quoted text' "$@" 2>/dev/null && echo echo export 2>/dev/null
+'quoted text' readonly grep | grep | && 'quoted text' && local -eu
+		&& $(pwd) | done export export printf
+		'quoted text' local --verbose test 2>/dev/null /usr/bin --verbose ${HOME} export
+		&& echo 2>/dev/null sed export -eu -eu then done 'quoted text'
+		grep | done local local echo --verbose
+		"$@" ${HOME} sed /usr/bin
+"$1" 2>/dev/null local echo "$1" export x=1 ${HOME} done then
+sed done | | ${HOME} "$@" && grep "$1" done
+	printf $(pwd) cd then done done ${HOME}
+	readonly echo test awk ${HOME} ${HOME} cd | export
+		| ${HOME} | "$@" printf local echo readonly printf export ${HOME} done && export
+	&& readonly $(pwd) cd x=1 -eu $(pwd)
+		&& "$@" -eu && done && && /usr/bin ${HOME} done ${HOME} ${HOME}
+	local && 'quoted text' $(pwd)
+		"$@" x=1 local -eu printf -eu
+		readonly -eu --verbose printf echo cd
+	-eu ${HOME} && awk --verbose readonly
+then grep "$1" ${HOME} x=1 2>/dev/null echo export printf grep sed |
+		-eu -eu readonly awk readonly grep sed "$1" "$@"
+	sed done && readonly $(pwd) echo "$@" | 'quoted text' /usr/bin
+		printf grep /usr/bin awk "$@" "$@" $(pwd) done cd
+export -eu x=1 'quoted text' printf 2>/dev/null
+'quoted text' grep | -eu x=1 cd 'quoted text' readonly
+awk "$1" done && x=1 -eu
+	sed test $(pwd) then cd test sed echo done $(pwd) 'quoted text'
+		sed cd 2>/dev/null -eu grep
+		${HOME} test "$@" "$@" | readonly --verbose readonly $(pwd) --verbose
+		${HOME} --verbose readonly echo done && $(pwd)
+	echo ${HOME} --verbose cd then readonly --verbose
+grep printf | then 2>/dev/null
+done readonly ${HOME} sed readonly awk sed |
+		-eu 2>/dev/null awk --verbose export local /usr/bin
+		readonly ${HOME} /usr/bin x=1 grep
+	awk sed --verbose then printf
+	done printf $(pwd) export -eu sed readonly "$1" export local
+		$(pwd) ${HOME} grep "$@" x=1 cd local | && export done echo grep
+x=1 grep readonly local 2>/dev/null
+readonly | 'quoted text' "$1" sed printf awk
+		x=1 awk $(pwd) 'quoted text' ${HOME} "$@" test done
+		printf -eu sed && readonly awk 'quoted text' "$1" sed readonly
+		${HOME} | -eu then $(pwd) 'quoted text' x=1 readonly "$1" readonly
+	then export readonly cd readonly | export ${HOME} $(pwd) sed "$@"
+		$(pwd) printf /usr/bin -eu local | test -eu -eu echo "$1" $(pwd)
+		grep done then grep echo 'quoted text' 'quoted text' /usr/bin
+${HOME} done -eu awk $(pwd) sed 'quoted text' | --verbose $(pwd)
+		/usr/bin | printf export && export | 2>/dev/null cd --verbose sed printf
+| grep $(pwd) "$@" ${HOME} done sed export echo export awk
+		then awk printf done echo -eu &&
+sed awk sed /usr/bin && readonly printf --verbose
+		--verbose done echo --verbose done x=1 && | test readonly 2>/dev/null then
+-eu /usr/bin echo && | local sed 'quoted text' 'quoted text'
+	export printf x=1 awk $(pwd) ${HOME} echo local echo --verbose "$1" done $(pwd)
+	2>/dev/null echo grep $(pwd) local export "$1" echo printf
+cd echo grep "$1" --verbose then export | local -eu "$1" -eu &&
+	'quoted text' grep local "$1"
+2>/dev/null export $(pwd) --verbose -eu cd /usr/bin | | local
+"$1" /usr/bin echo then test | | export /usr/bin 'quoted text' /usr/bin
+		'quoted text' -eu -eu echo /usr/bin
+		export | grep printf cd && sed --verbose && 2>/dev/null printf
+&& awk "$@" x=1 'quoted text' cd && grep | "$1" export 2>/dev/null
+grep test /usr/bin ${HOME} /usr/bin "$@" printf ${HOME}
+x=1 cd local readonly x=1 export "$1" printf
+$(pwd) sed | x=1 --verbose done | done 'quoted text'
+		/usr/bin $(pwd) "$@" && | /usr/bin | "$1" --verbose awk x=1 2>/dev/null
+	awk -eu sed x=1 grep "$@" | ${HOME}
+	/usr/bin cd awk done grep 'quoted text' x=1 readonly local ${HOME}
+		done $(pwd) readonly grep
+		--verbose export grep ${HOME} awk sed grep --verbose sed
+		then | test --verbose "$1" printf 2>/dev/null --verbose
+		x=1 test sed x=1 "$1" ${HOME} local grep ${HOME} printf --verbose
+"$@" done 2>/dev/null /usr/bin $(pwd)
+		&& "$@" export 'quoted text' --verbose done ${HOME} $(pwd) done "$1"
+2>/dev/null "$@" $(pwd) readonly ${HOME} /usr/bin "$1" then sed grep x=1
+	then /usr/bin awk cd
+		local grep done grep x=1 /usr/bin grep --verbose 'quoted text'
+	2>/dev/null done -eu cd cd grep
+"$@" | "$1" 2>/dev/null local "$1" echo
+	"$@" x=1 && export 'quoted text' | echo -eu && echo
+		grep --verbose grep ${HOME} awk ${HOME}
+	| test 'quoted text' | local cd x=1 echo grep && /usr/bin && done grep then
+	echo awk readonly "$1" done test 'quoted text' local grep grep $(pwd) awk
+	done cd then awk echo --verbose
+		--verbose printf 'quoted text'
+		export local ${HOME} && local
+	readonly $(pwd) done $(pwd) $(pwd)
+$(pwd) export awk readonly cd --verbose sed
+-eu $(pwd) "$1" /usr/bin awk && grep done done local ${HOME} 2>/dev/null
+	| | done export "$1" ${HOME}
+	| 'quoted text' awk "$1" then echo --verbose
+| export /usr/bin /usr/bin grep then readonly 2>/dev/null
+"$1" 2>/dev/null /usr/bin
+		then readonly readonly readonly awk "$@" cd --verbose
+		then printf sed --verbose -eu grep "$@" && sed $(pwd) ${HOME} awk | x=1 "$@"
+	printf -eu readonly sed done echo local then test done readonly local | test
+		/usr/bin -eu grep ${HOME} echo x=1 grep then
+	| ${HOME} grep readonly printf 2>/dev/null 'quoted text' 'quoted text'
+		local /usr/bin done "$@" x=1 then 2>/dev/null done cd
+		sed readonly readonly ${HOME} printf done 2>/dev/null then "$@" echo 'quoted text'
+		echo echo $(pwd) test printf echo
+		-eu awk then && 2>/dev/null cd &&
+	x=1 awk $(pwd) 2>/dev/null printf && 2>/dev/null then cd "$@" -eu -eu 2>/dev/null
+		&& then test --verbose
+2>/dev/null "$@" && printf sed test done local 'quoted text' readonly
+		sed grep export export printf ${HOME} readonly
+	/usr/bin cd printf then printf printf --verbose echo test cd done 2>/dev/null
+test done "$@" cd echo awk sed grep "$@"
+2>/dev/null "$@" cd x=1 -eu x=1 ${HOME} -eu printf | 'quoted text'
+-eu --verbose --verbose
+	export printf "$1" local echo 2>/dev/null "$1"
+-eu $(pwd) cd awk done cd --verbose && then ${HOME} "$1" $(pwd) export
+	'quoted text' cd -eu awk x=1 "$@" awk sed readonly then export
+	export x=1 && sed --verbose x=1 "$1" 2>/dev/null /usr/bin
+		echo local $(pwd) cd && -eu readonly cd export 'quoted text' 2>/dev/null
+		cd && sed ${HOME} /usr/bin --verbose
+readonly | x=1 printf "$1" && && x=1 ${HOME} "$@"
+"$@" 'quoted text' readonly | done test -eu 2>/dev/null 'quoted text'
+done -eu awk x=1 x=1 awk /usr/bin
+| export ${HOME} local local "$@" "$@" --verbose cd && export
+cd grep "$@" awk cd 'quoted text' readonly cd test awk done then && 'quoted text'
+${HOME} grep 'quoted text' ${HOME}
+"$@" "$1" test --verbose echo && --verbose | echo printf
+	x=1 sed 2>/dev/null awk --verbose |
+		"$1" awk done test cd cd /usr/bin /usr/bin /usr/bin
+		-eu "$1" 'quoted text' then then x=1 export | awk "$@" sed 'quoted text'
+	--verbose cd -eu /usr/bin local "$1"
+		--verbose && grep --verbose sed
+then readonly done export done local cd $(pwd) 'quoted text' ${HOME} awk echo /usr/bin
+	'quoted text' cd printf sed && --verbose test | &&
+	| export test ${HOME} x=1 -eu echo done "$1" test test
+		cd awk export 'quoted text' grep -eu "$1" echo local sed then then --verbose
+		${HOME} /usr/bin echo printf 'quoted text' grep done sed awk | printf cd |
+printf printf readonly cd "$1" awk
+	sed then --verbose ${HOME} ${HOME} "$@" export
+		x=1 done | test -eu x=1 'quoted text' x=1 --verbose cd sed grep
+	$(pwd) "$@" readonly echo cd printf /usr/bin -eu $(pwd)
+| then x=1 && test x=1 "$1" printf ${HOME} 'quoted text' test x=1 echo export
+	| readonly 'quoted text' readonly $(pwd)
+-eu "$@" cd grep readonly done done cd /usr/bin 'quoted text' |
+local readonly done done then "$1" | then echo "$@" then test "$@"
+	printf sed | readonly export
+		readonly && test then | sed echo grep
+		grep done sed -eu export readonly
+printf -eu ${HOME} readonly
+	local -eu sed x=1 cd readonly cd echo
+	"$1" readonly grep "$@" 'quoted text'
+		-eu -eu && --verbose $(pwd) then $(pwd) && echo
+"$@" sed then readonly "$@" echo grep test grep done --verbose export printf "$1"
+	grep | cd x=1 --verbose "$@" done "$1" /usr/bin done ${HOME} export sed sed /usr/bin
+	"$1" --verbose export done -eu
+	local /usr/bin export -eu $(pwd) | test sed test "$@" then
+/usr/bin x=1 $(pwd) && sed export "$@" printf
+		local -eu then /usr/bin | -eu awk awk && export export printf
+	test grep test echo -eu cd x=1 done /usr/bin "$@" "$1" -eu && sed 'quoted text'
+	awk grep grep "$@" then 'quoted text' 2>/dev/null grep
+grep grep cd $(pwd) $(pwd) 2>/dev/null ${HOME} 'quoted text'
+| awk "$1" printf done done "$@" export then 'quoted text' sed
+	"$@" grep | awk echo /usr/bin
+local local awk grep --verbose local $(pwd) x=1 "$1" done
+		$(pwd) export $(pwd) export done then -eu "$1" 2>/dev/null
+&& echo && -eu cd "$@" awk 2>/dev/null grep printf sed printf cd test
+		grep --verbose --verbose local | ${HOME}
+	x=1 'quoted text' | "$1" then test ${HOME} sed | done printf done -eu -eu
+	cd export done done grep ${HOME} test
+test export echo test "$@" /usr/bin 'quoted text' awk
+	local local readonly then export export awk export test readonly -eu cd && done
+		echo local $(pwd) /usr/bin local x=1 then then awk "$1" && $(pwd)
+	"$@" && cd grep -eu sed ${HOME} | $(pwd) && $(pwd)
+then grep ${HOME} ${HOME} ${HOME}
+		| $(pwd) export readonly 'quoted text' awk done 2>/dev/null && local
+2>/dev/null /usr/bin done && x=1 2>/dev/null test "$@" ${HOME}
+test echo readonly x=1 /usr/bin test 2>/dev/null export echo echo -eu local
+		| readonly 2>/dev/null sed "$1" --verbose
+	then $(pwd) readonly local /usr/bin printf
+	${HOME} /usr/bin /usr/bin then | test echo $(pwd) | local
+		grep "$1" $(pwd) awk $(pwd) "$1" "$1" grep done /usr/bin export
+	/usr/bin 2>/dev/null "$@" readonly export x=1
+	awk readonly --verbose $(pwd) && | $(pwd) grep --verbose printf ${HOME}
+		test ${HOME} printf cd "$1" awk ${HOME}
+x=1 local echo 'quoted text' -eu | | cd 'quoted text' grep
+		cd export && export sed --verbose local test
+| cd | sed /usr/bin done && then grep then $(pwd) sed ${HOME} && printf sed
+	then x=1 echo readonly 'quoted text' 'quoted text' cd grep x=1 -eu 'quoted text'
+	echo x=1 "$1" --verbose x=1 && "$@" --verbose echo "$@" then 2>/dev/null
+	then | echo export -eu export awk | ${HOME} printf
+sed 2>/dev/null 2>/dev/null export awk
+		"$@" sed && done test ${HOME} $(pwd) ${HOME} 'quoted text' | /usr/bin
+	"$@" "$@" | local cd --verbose
+	printf awk $(pwd) export ${HOME} echo then
+	'quoted text' && "$@" readonly export local 'quoted text' then
+	readonly awk local local then $(pwd) $(pwd) "$1" --verbose grep | printf "$@" "$@"
+	done sed export test --verbose 2>/dev/null awk -eu awk 2>/dev/null done "$1" 'quoted text'
+--verbose && awk 2>/dev/null 2>/dev/null | echo 'quoted text'
+"$@" grep && done --verbose
+	| --verbose echo readonly x=1 "$1" /usr/bin
+		export then local sed 'quoted text' then && "$1" ${HOME} $(pwd)
+/usr/bin 2>/dev/null awk x=1
+	&& awk 'quoted text' x=1 -eu then local "$1"
+		printf awk sed "$1" done test local
+awk grep && && $(pwd) export | test local then printf | 2>/dev/null 2>/dev/null
+echo grep local cd -eu echo echo -eu | ${HOME} local printf printf test then
+	echo -eu sed $(pwd) readonly local printf "$1"
+		"$@" /usr/bin /usr/bin 'quoted text' export $(pwd) -eu sed awk "$@" printf
+	printf $(pwd) /usr/bin readonly cd readonly local
+		2>/dev/null "$@" local | readonly -eu echo sed
+'quoted text' done printf local 'quoted text'
+		sed grep x=1 $(pwd) printf then "$@" 'quoted text' "$1"
+done grep readonly awk | && done "$@" && "$1"
+		done "$1" && ${HOME} echo
+		| cd cd | echo 'quoted text' done "$1" x=1 | /usr/bin export
+echo grep done awk x=1 |
+	readonly x=1 printf && awk $(pwd) echo "$@" cd ${HOME} sed printf
+		awk test --verbose done done echo 'quoted text'
+'quoted text' -eu 'quoted text' readonly
+&& cd /usr/bin printf
+"$@" export 'quoted text' "$1" grep then test then && $(pwd) /usr/bin
+	2>/dev/null cd --verbose then echo --verbose awk -eu export export sed "$@"
+		done cd export $(pwd) 2>/dev/null grep then "$1" $(pwd) local /usr/bin ${HOME}
+printf cd awk "$1" && | $(pwd)
+-eu $(pwd) test cd grep "$1" then test
+	-eu done ${HOME} test x=1 awk --verbose -eu printf
+	'quoted text' done printf 'quoted text' readonly echo "$@"
+		printf readonly $(pwd) 'quoted text' local
+&& readonly "$1" ${HOME}
+		| echo 2>/dev/null export "$1" && $(pwd) echo
+		| printf $(pwd) 2>/dev/null then
+	echo awk sed readonly cd printf readonly "$1" /usr/bin && test local printf
+	then printf ${HOME} 2>/dev/null -eu ${HOME} "$@" awk printf x=1 "$1" && ${HOME}
+	local grep "$1" grep cd 2>/dev/null x=1
+	awk ${HOME} "$@" done echo
+	sed | then readonly 'quoted text'
+		"$1" echo --verbose 'quoted text' /usr/bin --verbose -eu && --verbose done test
+done done grep printf grep local "$@"
+		"$@" $(pwd) -eu ${HOME} /usr/bin then "$1" | /usr/bin grep
+	grep /usr/bin cd && awk echo "$1" | awk
+	echo awk echo "$@" echo $(pwd) done echo local done sed ${HOME} echo sed export
+		/usr/bin test printf export then
+then grep sed printf "$1" readonly
+	x=1 grep $(pwd) readonly /usr/bin "$@" echo 'quoted text'
+--verbose readonly x=1 printf test awk 'quoted text' 'quoted text'
+sed cd 2>/dev/null test /usr/bin ${HOME} 'quoted text' 'quoted text' export --verbose
+		export ${HOME} "$1" sed ${HOME} readonly ${HOME} --verbose
+		done grep readonly test export x=1 ${HOME} -eu && 2>/dev/null readonly test test
+$(pwd) grep local $(pwd) $(pwd) "$1" /usr/bin
+x=1 grep x=1 x=1 printf $(pwd) 2>/dev/null cd echo echo | awk then
+		'quoted text' "$@" echo sed local done 2>/dev/null
+		-eu export sed "$1" done sed readonly
+	printf ${HOME} test done && readonly --verbose export
+"$1" ${HOME} printf "$@" echo printf 'quoted text' printf
+		done | "$1" grep test x=1 | then
+		/usr/bin --verbose /usr/bin
+	--verbose export readonly
+2>/dev/null ${HOME} grep ${HOME} readonly
+	export --verbose "$1" 2>/dev/null $(pwd)
+		-eu awk $(pwd) x=1 ${HOME} sed readonly sed done local
+-eu -eu && "$@" | $(pwd) "$1"
+		/usr/bin --verbose ${HOME} sed local done --verbose -eu -eu
+		readonly awk && cd cd printf "$@" ${HOME}
+		x=1 -eu local "$@" $(pwd) then
+		/usr/bin $(pwd) ${HOME} ${HOME} $(pwd) export
+		x=1 && readonly awk $(pwd) cd 'quoted text'
+2>/dev/null export awk $(pwd) 'quoted text' "$1" awk local test ${HOME}
+done 2>/dev/null --verbose then local --verbose then awk "$@"
+	cd readonly ${HOME} grep awk "$@" cd ${HOME} local echo export
+		sed readonly | ${HOME} "$1" test "$1" ${HOME} test ${HOME}
+	--verbose 'quoted text' 'quoted text'
+		grep local done 'quoted text' test --verbose sed 'quoted text' ${HOME}
+then readonly local local
+x=1 'quoted text' awk sed export $(pwd) && && 'quoted text'
+	local --verbose test && "$1" "$@" printf sed | |
+	"$@" && readonly $(pwd) "$1" $(pwd)
+	/usr/bin test printf done ${HOME} x=1 echo cd |
+		sed /usr/bin 2>/dev/null 'quoted text'
+test done 'quoted text' ${HOME} test 'quoted text'
+	'quoted text' ${HOME} printf readonly --verbose printf --verbose
+${HOME} "$1" x=1 local /usr/bin
+then test 'quoted text' grep done -eu x=1 2>/dev/null local -eu readonly
+	readonly sed grep awk readonly cd "$1" grep && 'quoted text'
+	readonly cd done test "$@" 'quoted text' x=1 awk && "$1"
+	$(pwd) /usr/bin done local -eu ${HOME} /usr/bin printf
+	cd echo "$1" | x=1 'quoted text' test "$1" echo export
+		sed x=1 export readonly local -eu --verbose export "$1" ${HOME} cd test "$@" done
+	export "$1" --verbose | 'quoted text' --verbose grep -eu done
+2>/dev/null awk /usr/bin
+then -eu test grep export --verbose readonly 'quoted text' cd local
+		echo "$@" | -eu x=1 2>/dev/null printf
+awk local echo -eu echo export
+	done "$1" sed readonly sed
+"$@" readonly export "$@"
+	2>/dev/null cd /usr/bin test /usr/bin x=1 export
+		echo export $(pwd) export "$1" test -eu then readonly
+	readonly then test cd awk ${HOME} readonly ${HOME}
+		sed "$1" x=1 "$1" "$1" && ${HOME}
+	grep /usr/bin local 2>/dev/null -eu "$1" awk printf && |
+sed -eu $(pwd) sed "$@" /usr/bin test test x=1 done test done --verbose --verbose
+		echo test printf -eu sed 2>/dev/null echo export ${HOME} export
+	$(pwd) cd 2>/dev/null x=1 /usr/bin
+export x=1 "$1" test test sed awk export "$@" --verbose "$1" && sed test
+	grep && x=1 x=1 awk 2>/dev/null printf test readonly echo
+		done done "$1" -eu local then
+		cd "$@" 'quoted text' | 2>/dev/null printf readonly ${HOME}
+	"$1" 2>/dev/null done echo ${HOME} sed echo awk local "$1" $(pwd) done /usr/bin
+		local "$1" readonly test "$@" then then 'quoted text'
+		"$1" readonly "$@" sed readonly
+		--verbose echo grep echo test test echo echo
+	"$1" | then | x=1 'quoted text'
+		x=1 ${HOME} export export && export echo /usr/bin cd cd local && sed awk 2>/dev/null
+	then sed 2>/dev/null 2>/dev/null ${HOME} --verbose local then export echo 2>/dev/null
+		'quoted text' local | local --verbose | 'quoted text'
+cd then grep echo 2>/dev/null
+	local echo && --verbose /usr/bin && readonly
+		readonly awk then /usr/bin printf
+		$(pwd) | 2>/dev/null ${HOME} -eu sed 2>/dev/null local 'quoted text' done
+grep "$1" --verbose 'quoted text' export 2>/dev/null "$1" "$@" sed
+		readonly awk 'quoted text' echo x=1 | local local awk
+$(pwd) readonly $(pwd) --verbose $(pwd) --verbose && sed test $(pwd)
+	"$@" 2>/dev/null x=1 readonly printf
+	| sed sed && "$@" --verbose -eu grep then printf "$1" $(pwd) x=1 ${HOME} readonly
+grep x=1 'quoted text' -eu --verbose test echo "$1" test
+"$1" "$@" echo x=1 "$@" awk cd -eu --verbose sed awk awk
+	x=1 then -eu test 'quoted text' -eu /usr/bin --verbose $(pwd)
+		done local -eu local $(pwd) printf cd "$@" sed ${HOME}
+echo --verbose done test -eu grep 2>/dev/null "$1"
+		awk done echo 2>/dev/null export echo --verbose printf echo $(pwd) printf readonly
+test awk done 'quoted text' then test awk
+	2>/dev/null 'quoted text' | cd readonly "$1" "$1" printf ${HOME} printf
+		sed && echo --verbose --verbose readonly $(pwd) 2>/dev/null local test
+readonly 2>/dev/null then && printf --verbose printf cd 'quoted text'
+		printf --verbose test /usr/bin /usr/bin local
+		sed "$@" cd local 2>/dev/null
+		awk grep ${HOME} done /usr/bin awk test export grep "$1" readonly && "$@"
+	printf 'quoted text' --verbose then
+| test "$1" grep test cd printf awk $(pwd) done $(pwd) done
+		then /usr/bin "$1" 2>/dev/null --verbose
+awk --verbose 2>/dev/null cd printf 'quoted text' "$1" --verbose
+| -eu ${HOME} $(pwd) 2>/dev/null cd echo x=1
+echo echo x=1 awk cd local export
+	'quoted text' local ${HOME}
+sed local -eu readonly /usr/bin sed 'quoted text' $(pwd) | export printf local
+	&& sed test printf $(pwd) -eu done --verbose "$1" awk
+	cd then x=1 --verbose "$1" 'quoted text' x=1 echo && "$@" sed | test 'quoted text'
+		export then 'quoted text' $(pwd) -eu | test "$@" local echo
+		grep printf x=1 ${HOME}
+	test echo 2>/dev/null "$@" awk grep && done x=1 "$1" sed awk "$1"
+	x=1 cd export x=1 printf --verbose echo
+${HOME} /usr/bin 2>/dev/null
+		$(pwd) 'quoted text' 2>/dev/null
+echo && cd /usr/bin --verbose "$@" $(pwd)
+-eu $(pwd) awk && -eu -eu readonly
+		sed echo x=1 sed cd done && grep then $(pwd) x=1 | local grep
+	done grep sed test sed x=1 sed x=1 echo ${HOME} done x=1
+"$@" then /usr/bin 2>/dev/null | cd local
+--verbose ${HOME} sed "$@" x=1 x=1 "$@" echo "$@" x=1 /usr/bin awk local 2>/dev/null
+		cd x=1 && test sed x=1 then ${HOME} readonly 'quoted text'
+		readonly readonly -eu 2>/dev/null x=1 test | $(pwd) /usr/bin
+		${HOME} grep awk /usr/bin ${HOME} --verbose test $(pwd) -eu then x=1 --verbose
+		2>/dev/null readonly then then
+		echo sed grep echo 'quoted text' /usr/bin 'quoted text'
+		2>/dev/null then 'quoted text'
+"$1" echo /usr/bin readonly
+		echo /usr/bin "$@" x=1 local &&
+sed export 2>/dev/null echo "$@" | 2>/dev/null -eu "$@" 2>/dev/null
+	"$1" awk ${HOME} test ${HOME} awk 'quoted text'
+	local "$@" export test 2>/dev/null test awk readonly -eu /usr/bin ${HOME} --verbose
+	${HOME} "$@" 2>/dev/null 'quoted text' --verbose cd 'quoted text'
+sed then grep 'quoted text' test sed x=1 2>/dev/null ${HOME} local
+	done && cd readonly echo ${HOME} done cd printf -eu ${HOME} 2>/dev/null
+		| export local | "$@" "$@" export && && --verbose grep awk local $(pwd) then readonly
+		local x=1 'quoted text' $(pwd) 2>/dev/null $(pwd)
+		&& test ${HOME} cd export local $(pwd)
+export "$1" export $(pwd) sed done then awk export 'quoted text'
+		$(pwd) | done cd $(pwd)
+		export -eu 2>/dev/null cd -eu then
+	-eu 2>/dev/null test
+| "$1" 2>/dev/null export done ${HOME} $(pwd) /usr/bin grep printf test "$@" x=1
+		'quoted text' printf 2>/dev/null ${HOME} && x=1 && "$@" "$1" && done
+	'quoted text' sed $(pwd) awk export | awk test 'quoted text'
+	2>/dev/null awk && | 2>/dev/null
+"$@" | $(pwd) then 2>/dev/null awk then
+then awk x=1 cd /usr/bin "$1" then ${HOME} /usr/bin echo awk "$@" then
+	awk 2>/dev/null /usr/bin printf "$@" cd awk printf sed grep 2>/dev/null 'quoted text'
+-eu local "$1" "$1" test test done grep printf
+	export local "$1" test awk
+cd x=1 x=1 sed then x=1 'quoted text'
+		grep done printf grep readonly $(pwd) | awk | && ${HOME} grep
+export "$1" 2>/dev/null echo readonly "$@" awk "$@" readonly x=1 'quoted text'
+		-eu /usr/bin test $(pwd) | 2>/dev/null grep --verbose sed --verbose
+		'quoted text' test x=1 readonly echo x=1
+	"$@" 'quoted text' ${HOME} 2>/dev/null
+		printf grep cd grep done
+local printf awk test grep awk -eu
+		'quoted text' printf $(pwd) awk ${HOME} ${HOME} 2>/dev/null done done 2>/dev/null
+	| ${HOME} $(pwd) done sed 2>/dev/null ${HOME} test cd x=1
+		${HOME} export 2>/dev/null ${HOME}
+		2>/dev/null readonly x=1 printf --verbose echo
+done -eu awk $(pwd) "$1" 2>/dev/null grep ${HOME} then echo readonly export -eu
+	readonly 'quoted text' readonly echo --verbose printf && "$@"
+/usr/bin -eu | "$1" /usr/bin export cd grep 2>/dev/null
+	cd ${HOME} "$1" ${HOME}
+		$(pwd) ${HOME} /usr/bin --verbose && readonly -eu /usr/bin sed ${HOME} && awk
+	test $(pwd) 'quoted text' local echo ${HOME} readonly && /usr/bin && done
+		-eu local x=1 -eu local "$@" -eu test -eu 'quoted text' 2>/dev/null
+	readonly "$1" 2>/dev/null /usr/bin "$@" grep cd 'quoted text' local
+	"$1" && readonly ${HOME} done readonly /usr/bin done
+"$1" awk x=1 printf "$@" "$@" awk -eu local 'quoted text' | && export
+		grep export printf --verbose --verbose export 'quoted text' local local
+		cd then grep ${HOME} ${HOME}
+	| cd then awk | sed readonly local "$@" | | awk echo "$@" awk 2>/dev/null
+	awk 2>/dev/null printf "$1" /usr/bin cd && && $(pwd) local printf $(pwd) echo then
+done | 'quoted text' printf -eu readonly /usr/bin
+export local local echo then test --verbose readonly -eu /usr/bin /usr/bin
+readonly | | awk $(pwd) $(pwd) "$1" test | printf
+		test ${HOME} sed && local done local test 'quoted text'
+	then /usr/bin echo -eu cd -eu local test --verbose "$1" sed done && -eu
+	export 2>/dev/null grep -eu x=1 local "$1" --verbose ${HOME} "$@" then -eu /usr/bin
+		x=1 | x=1 -eu local cd done && test local test ${HOME} local
+		"$@" $(pwd) ${HOME} $(pwd) && grep
+		&& | awk cd then 'quoted text'
+	'quoted text' done -eu done "$@" local
+		done then && echo --verbose | "$1" then test export test
+	test test local export "$1" | cd 2>/dev/null
+	then awk x=1 done "$@" awk printf 'quoted text'
+		--verbose -eu then then 'quoted text' 'quoted text' -eu export
+2>/dev/null $(pwd) /usr/bin
+		/usr/bin "$1" x=1 readonly grep sed "$1"
+		grep && test x=1 $(pwd) --verbose readonly local -eu cd cd then
+grep "$1" awk 'quoted text' --verbose
+		awk --verbose readonly ${HOME} $(pwd) grep "$1" "$@" sed -eu cd
+		/usr/bin /usr/bin ${HOME} local then local then readonly ${HOME} export $(pwd)
+	grep x=1 "$@" 'quoted text' test && then ${HOME}
+${HOME} done --verbose /usr/bin then echo local grep cd
+		local 2>/dev/null 'quoted text' export awk -eu export 2>/dev/null
+	readonly awk && test 'quoted text' $(pwd) export /usr/bin "$1"
+		&& ${HOME} | 'quoted text'
+		-eu --verbose local --verbose local ${HOME} then done && readonly
+		&& | 2>/dev/null x=1 /usr/bin
+		export x=1 x=1 -eu done /usr/bin test readonly /usr/bin done readonly 'quoted text'
+	export sed 'quoted text' x=1 2>/dev/null "$@" 2>/dev/null $(pwd) x=1 test export
+		&& --verbose x=1 && printf cd "$@" done "$@" export "$@" export awk printf grep
+	awk cd readonly readonly | then ${HOME} readonly awk | export printf && "$1" 2>/dev/null
+	${HOME} export local ${HOME} cd grep grep
+	awk done /usr/bin -eu readonly local printf cd |
+sed 'quoted text' grep 2>/dev/null
+echo local echo then "$1" x=1
+	-eu grep awk /usr/bin /usr/bin sed awk 'quoted text'
+"$1" readonly --verbose awk awk local &&
+export grep grep x=1 && /usr/bin 'quoted text' --verbose awk grep sed
+		then | readonly -eu readonly && -eu | --verbose test "$1" echo export
+"$@" "$@" /usr/bin export
+		--verbose then | sed 2>/dev/null 'quoted text' cd | && 'quoted text'
+export test echo ${HOME} "$1" echo readonly
+$(pwd) --verbose ${HOME} printf test $(pwd) "$1" done done printf done then 'quoted text'
+		--verbose "$1" -eu ${HOME} | $(pwd)
+		&& echo ${HOME} 'quoted text' | local 'quoted text' $(pwd) printf "$1"
+x=1 x=1 2>/dev/null 2>/dev/null x=1 echo test done echo
+		'quoted text' /usr/bin ${HOME} --verbose then awk ${HOME} | $(pwd) grep 'quoted text'
+2>/dev/null $(pwd) cd done then done && "$1" sed 2>/dev/null
+awk grep "$1" awk && export local cd grep "$1" "$@" grep && sed export awk
+${HOME} "$1" 'quoted text' $(pwd) 'quoted text' 'quoted text' "$1"
+	| --verbose "$1" | 'quoted text' printf export ${HOME}
+		/usr/bin grep readonly
+printf grep "$@" "$1" done x=1 readonly
+echo then ${HOME} printf 2>/dev/null
+--verbose && $(pwd) test sed 2>/dev/null done --verbose 'quoted text' printf
+	cd /usr/bin /usr/bin test sed ${HOME} ${HOME}
+	cd echo /usr/bin printf /usr/bin $(pwd) local sed $(pwd) 2>/dev/null printf $(pwd)
+		"$1" "$1" local readonly | readonly $(pwd) awk 'quoted text'
+--verbose sed ${HOME} 'quoted text' readonly done cd -eu 2>/dev/null
+		done grep | local awk /usr/bin 2>/dev/null printf
+		export readonly export local /usr/bin grep --verbose
+		--verbose ${HOME} export test -eu printf sed echo local
+	printf readonly "$1" /usr/bin cd
+test awk 'quoted text' readonly readonly
+	&& 2>/dev/null $(pwd) x=1 local && 'quoted text' echo readonly awk "$1" "$@" --verbose
+		| "$1" ${HOME} -eu --verbose cd | /usr/bin "$1" awk "$1" printf
+| then grep then x=1 $(pwd) 'quoted text' cd -eu awk awk test ${HOME} printf
+-eu | awk echo | --verbose
+sed sed ${HOME} test echo then --verbose 2>/dev/null /usr/bin test && ${HOME} done
+	readonly done cd grep x=1 2>/dev/null grep test sed
+grep && local /usr/bin awk --verbose then printf printf
+		test --verbose "$@" /usr/bin | awk ${HOME} "$@" 'quoted text'
+	--verbose readonly 'quoted text' readonly awk 2>/dev/null echo
+done done | | "$1" grep $(pwd) 2>/dev/null local $(pwd) printf x=1 then awk
+	cd $(pwd) then 2>/dev/null test printf grep 2>/dev/null readonly test -eu
+	'quoted text' local "$@" --verbose $(pwd) &&
+		test then "$@" | 'quoted text' done "$1"
+$(pwd) then printf 'quoted text' /usr/bin local
+x=1 grep readonly 2>/dev/null export done 'quoted text'
+"$1" readonly export "$@"
+	sed ${HOME} $(pwd) --verbose
+		export sed "$@" test 2>/dev/null
+	$(pwd) awk test x=1 "$@" 2>/dev/null awk /usr/bin cd cd x=1 then $(pwd)
+		&& done | "$@" local "$1" | && ${HOME} local grep 2>/dev/null
+local --verbose $(pwd) x=1 "$1" "$@" export readonly ${HOME} printf done sed
+		x=1 'quoted text' done --verbose ${HOME}
+		--verbose 'quoted text' then echo -eu $(pwd) done
+		"$@" ${HOME} 'quoted text' sed ${HOME}
+		grep local $(pwd) readonly sed ${HOME} && /usr/bin -eu "$1" then
+	readonly grep cd printf ${HOME} | /usr/bin sed --verbose grep grep x=1 export
+		done cd local export && $(pwd) | ${HOME} sed "$@" $(pwd) readonly
+		"$1" cd --verbose grep awk /usr/bin cd awk sed grep cd 2>/dev/null done local
+	&& sed 2>/dev/null | | local awk -eu --verbose grep readonly grep
+	echo && "$1" test && "$@" echo "$1" done /usr/bin x=1 /usr/bin echo done /usr/bin
+	'quoted text' x=1 -eu export awk cd cd --verbose
+&& sed -eu /usr/bin ${HOME} $(pwd)
+cd "$@" cd -eu cd echo --verbose 'quoted text' export "$@"
+	'quoted text' ${HOME} x=1 "$1" | export 'quoted text'
+	/usr/bin x=1 --verbose echo "$1" awk done
+done done echo cd x=1
+		awk "$@" 'quoted text' "$1" -eu echo ${HOME}
+printf readonly readonly awk readonly done grep -eu $(pwd) -eu &&
+	test printf test export --verbose --verbose && $(pwd)
+	| awk done echo x=1 sed "$1" "$@" "$1" && x=1 --verbose
+	"$@" | cd 2>/dev/null && export test
+&& /usr/bin --verbose 'quoted text'
+		sed cd printf local sed /usr/bin "$1" then local then awk 'quoted text' cd | "$1"
+"$@" export -eu grep cd sed export
+		local 'quoted text' x=1 && -eu
+		grep cd -eu export echo echo readonly 2>/dev/null echo printf
+		${HOME} export export local test "$1"
+		$(pwd) grep x=1 readonly cd printf test printf $(pwd) "$1" sed grep "$1"
+		/usr/bin echo done -eu --verbose
+printf /usr/bin x=1 ${HOME} sed readonly
+	echo | | echo local x=1 /usr/bin sed export && cd &&
+		&& && sed && cd export -eu "$1" test &&
+then test test x=1 | done test awk ${HOME} -eu sed sed ${HOME}
+		"$1" grep && sed printf $(pwd) printf grep | readonly sed |
+		&& ${HOME} local 2>/dev/null export 2>/dev/null export local done && --verbose
+		grep --verbose local 2>/dev/null
+		"$@" echo -eu "$@" $(pwd)
+	test x=1 ${HOME} done && --verbose |
+		x=1 grep && "$1" awk --verbose "$@" test | --verbose "$1" -eu echo printf $(pwd)
+		printf grep && test | $(pwd) sed cd "$1" sed test
+	test "$1" /usr/bin printf x=1 x=1 readonly "$1"
+'quoted text' local --verbose then 2>/dev/null | 'quoted text' sed
+		echo local readonly | "$1" | &&
+awk cd readonly /usr/bin 2>/dev/null "$1" "$1" --verbose echo
+	awk $(pwd) cd -eu test -eu sed /usr/bin --verbose "$1"
+local "$@" && grep /usr/bin
+		awk grep export /usr/bin | $(pwd)
+	cd x=1 "$1" $(pwd) && cd 2>/dev/null
+	2>/dev/null cd -eu x=1 sed && "$@"
+	x=1 done sed done | x=1 printf
+		done -eu printf grep cd done $(pwd) "$1" -eu --verbose x=1 grep
+		readonly "$1" $(pwd) ${HOME} $(pwd) 2>/dev/null
+		/usr/bin local $(pwd) readonly
+cd printf ${HOME} /usr/bin "$@" grep -eu
+		'quoted text' --verbose
+awk grep x=1 readonly done &&
+		sed then ${HOME} --verbose then "$@" echo local echo sed
+		$(pwd) 'quoted text' "$1" readonly "$@" | x=1 then printf /usr/bin
+	sed 'quoted text' then /usr/bin
+	test grep -eu export x=1 sed $(pwd) sed echo /usr/bin && 2>/dev/null && export
+'quoted text' cd "$1" then test test done --verbose grep then test export "$1"
+		/usr/bin export $(pwd) export echo
+test awk then 'quoted text' | test -eu 2>/dev/null
+	cd "$1" test ${HOME} grep && printf "$1" printf export /usr/bin "$@"
+	"$1" local "$@" then -eu echo "$@" test "$@" test /usr/bin
+		readonly -eu --verbose done done 2>/dev/null ${HOME} done ${HOME} /usr/bin
+	grep /usr/bin --verbose done 'quoted text' cd then "$@" grep echo awk grep
+x=1 'quoted text' then grep grep sed /usr/bin readonly 2>/dev/null | printf $(pwd)
+		printf x=1 'quoted text' 'quoted text' export readonly sed
+		x=1 | /usr/bin --verbose && --verbose && && --verbose --verbose --verbose
+		${HOME} printf ${HOME} cd --verbose export printf
+		done cd echo grep done sed then 'quoted text'
+printf done 'quoted text' printf $(pwd) then echo test --verbose
+	x=1 export ${HOME} "$1"
+awk export 'quoted text'
+then /usr/bin --verbose readonly && done | &&
+x=1 --verbose readonly ${HOME}
+	&& 'quoted text' --verbose "$@" echo --verbose grep "$1"
+test --verbose 2>/dev/null test 2>/dev/null awk printf
+readonly /usr/bin "$1" && awk $(pwd)
+	$(pwd) $(pwd) -eu 'quoted text' --verbose 2>/dev/null test test local echo
+	sed -eu $(pwd) x=1 && done printf awk x=1
+		echo readonly x=1 test test test cd printf ${HOME} echo done 'quoted text'
+	cd test local && --verbose 2>/dev/null export local --verbose | then printf echo
+	--verbose ${HOME} then -eu $(pwd) awk && sed printf
+	cd --verbose grep ${HOME} awk x=1
+	-eu done cd local grep done echo --verbose
+$(pwd) echo readonly test printf readonly /usr/bin done $(pwd) --verbose
+	test test grep x=1 grep
+	cd && done 'quoted text' then readonly | cd "$1" ${HOME} /usr/bin "$@" sed printf
+export -eu "$1" "$@" "$1" 'quoted text' -eu export sed 'quoted text'
+		export printf awk $(pwd)
+		echo awk echo "$1" awk local grep x=1 then
+	x=1 && local readonly | printf export "$1" grep /usr/bin sed then local
+	--verbose printf "$@" ${HOME} cd x=1 /usr/bin -eu then x=1 export | /usr/bin readonly
+		| $(pwd) grep grep x=1 | awk
+		done 'quoted text' then 2>/dev/null
+		${HOME} local test | --verbose 'quoted text' printf test /usr/bin
+	test | x=1 2>/dev/null export 'quoted text'
+		/usr/bin sed export local readonly grep "$@"
+		grep sed done local |
+	awk done ${HOME} x=1 echo grep then "$1" 'quoted text'
+	&& export done echo export grep test echo printf $(pwd) cd
+		$(pwd) $(pwd) local --verbose cd printf readonly 2>/dev/null sed
+then export ${HOME} cd then ${HOME} -eu "$@" export 'quoted text' then done $(pwd)
+		/usr/bin "$1" printf printf
+	'quoted text' awk -eu readonly | echo
+		printf "$@" /usr/bin awk
+		then sed local -eu $(pwd)
+	local readonly && | --verbose grep done test printf
+		test ${HOME} && 2>/dev/null | local "$@" awk
+	echo 2>/dev/null then x=1
+		| -eu -eu then awk | | echo
+	--verbose echo echo x=1 -eu "$1" && sed "$1"
+	-eu -eu --verbose --verbose | "$@" done "$@" test done 2>/dev/null
+		--verbose | | then ${HOME} printf
+		--verbose printf grep ${HOME} readonly
+	done x=1 echo sed test echo cd --verbose awk then local ${HOME} awk 'quoted text'
+		2>/dev/null x=1 awk local && /usr/bin sed printf then $(pwd) test $(pwd)
+	grep /usr/bin -eu ${HOME} test 2>/dev/null
+	| test then x=1 'quoted text' $(pwd)
+export readonly "$@" | | ${HOME} echo then -eu
+		cd test "$1" x=1 'quoted text'
+		local "$@" | echo grep cd printf /usr/bin
+	--verbose 2>/dev/null && readonly --verbose
+		readonly 'quoted text' x=1 export test
+		export ${HOME} local 2>/dev/null printf 2>/dev/null
+		local | echo then local -eu 2>/dev/null
+	export done /usr/bin "$@" sed sed && local printf sed "$@" x=1 awk --verbose printf
+		cd test grep | test "$1" readonly done /usr/bin awk then export /usr/bin
+echo x=1 done test then /usr/bin local printf printf
+	done ${HOME} local -eu test test ${HOME} --verbose export /usr/bin sed x=1
+grep local cd "$@" "$@"
+	export -eu x=1 echo done $(pwd) test printf local printf readonly
+		$(pwd) --verbose 2>/dev/null done 'quoted text' --verbose --verbose cd test
+	| awk ${HOME} --verbose x=1
+	grep /usr/bin readonly test "$1" /usr/bin awk 'quoted text' awk
+		grep done "$1" && "$1" ${HOME} ${HOME}
+		--verbose readonly x=1
+		local $(pwd) test done sed sed cd then "$@"
+	| test && "$@" grep ${HOME} 2>/dev/null $(pwd) awk
+		readonly --verbose printf awk --verbose 'quoted text'
+		x=1 "$@" sed grep 'quoted text'
+x=1 cd cd x=1 done cd $(pwd) printf
+		printf "$@" cd "$1" echo && done local local x=1 readonly
+"$1" test ${HOME} cd printf printf readonly -eu ${HOME} cd x=1
+	| 'quoted text' -eu 'quoted text'
+sed sed /usr/bin then readonly test
+&& ${HOME} $(pwd) 2>/dev/null ${HOME} --verbose
+	grep && cd $(pwd) $(pwd) $(pwd) cd $(pwd) $(pwd) readonly
+	test 'quoted text' $(pwd)
+awk sed | | then then x=1 awk --verbose sed "$@" "$@" test done
+		grep | x=1 cd --verbose x=1 readonly
+test readonly cd grep "$@" sed sed done /usr/bin then ${HOME}
+	${HOME} sed /usr/bin printf "$1"
+	test --verbose awk $(pwd) readonly /usr/bin /usr/bin
+		then cd cd then ${HOME} 2>/dev/null
+		printf done "$@" grep $(pwd) ${HOME} sed test
+		cd sed $(pwd) test /usr/bin awk $(pwd)
+	x=1 'quoted text' --verbose 'quoted text'
+$(pwd) readonly then 'quoted text' --verbose
+		grep local "$1" done readonly test local test && 'quoted text' cd cd -eu
+	--verbose export grep ${HOME} test export -eu 2>/dev/null
+export cd /usr/bin -eu ${HOME} then cd grep 'quoted text' sed | awk
+	&& sed awk /usr/bin 2>/dev/null then printf -eu awk ${HOME} 'quoted text'
+	awk "$@" --verbose export ${HOME} --verbose sed test export sed /usr/bin
+grep sed export 'quoted text' 'quoted text' -eu printf 2>/dev/null
+	cd test "$@" && export $(pwd) awk then readonly
+	awk && echo "$@" grep readonly
+awk echo export "$@" local /usr/bin export
+| done $(pwd) done && local ${HOME} && --verbose x=1 'quoted text' -eu
+printf "$@" "$@" sed 2>/dev/null
+		grep printf sed readonly local awk local -eu readonly "$@" export
+		-eu -eu -eu echo $(pwd) /usr/bin &&
+${HOME} $(pwd) /usr/bin
+done "$1" printf grep x=1 test && cd cd && --verbose
+then grep x=1 sed "$1" $(pwd) 2>/dev/null x=1 $(pwd) | --verbose
+	x=1 echo readonly test $(pwd) "$1" grep 2>/dev/null 'quoted text' --verbose
+awk --verbose 'quoted text' printf
+	--verbose export grep echo test awk ${HOME} x=1 2>/dev/null
+		awk "$@" 2>/dev/null /usr/bin test
+x=1 "$1" $(pwd) $(pwd) 'quoted text'
+	local cd cd /usr/bin then $(pwd) local /usr/bin printf x=1 grep
+	x=1 readonly 'quoted text' then "$1" "$1" then -eu -eu sed | "$@"
+	printf 'quoted text' 'quoted text' sed printf x=1
+		$(pwd) printf test 2>/dev/null && /usr/bin /usr/bin readonly ${HOME} echo test
+	/usr/bin echo sed "$1" done grep $(pwd) ${HOME} local $(pwd) readonly -eu
+		--verbose 2>/dev/null -eu done 2>/dev/null echo
+	readonly then awk $(pwd) ${HOME}
+		2>/dev/null local $(pwd) ${HOME} echo export test
+--verbose sed 'quoted text'
+2>/dev/null "$1" && x=1 awk cd printf
+		"$@" 'quoted text' "$@" sed export "$@" cd 2>/dev/null sed $(pwd) && "$@" cd -eu
+'quoted text' readonly grep x=1 "$@" sed && readonly
+		'quoted text' sed 2>/dev/null x=1 echo x=1 x=1
+	$(pwd) -eu printf done sed x=1 echo cd "$1" echo export readonly
+	local cd sed 'quoted text' --verbose
+	/usr/bin --verbose 2>/dev/null 'quoted text' printf && echo sed "$1"
+	"$@" && done grep cd sed "$@" 2>/dev/null -eu "$1" printf awk -eu --verbose
+	done | then echo readonly test export "$@" x=1 cd
+	${HOME} 'quoted text' "$1"
+	--verbose x=1 local && done 2>/dev/null echo test ${HOME}
+		then test printf x=1 "$@" && "$@" x=1 cd && "$@" sed
+cd grep "$@" grep $(pwd) then x=1 awk "$@" "$1" --verbose then printf
+	--verbose ${HOME} sed | printf -eu 2>/dev/null local printf
+	-eu sed echo && 'quoted text' /usr/bin
+	/usr/bin echo local echo 2>/dev/null ${HOME} | | printf local done
+		echo awk done /usr/bin | | done printf echo $(pwd) "$@" $(pwd)
+	printf 'quoted text' awk
+		"$1" cd ${HOME} ${HOME}
+cd then 2>/dev/null test "$@" echo printf cd export /usr/bin
+		then && readonly | 'quoted text'
+	then -eu sed awk done -eu printf printf | && "$@" export awk "$1" export --verbose
+--verbose test export -eu x=1 --verbose "$@"
+	done local awk ${HOME} export readonly then
+	-eu 'quoted text' printf | then then then -eu
+	'quoted text' printf printf
+	test | x=1 done cd readonly ${HOME} export echo && awk export
+		x=1 && readonly test 'quoted text'
+		awk 2>/dev/null cd 2>/dev/null grep ${HOME} cd -eu printf
+		$(pwd) awk -eu "$1" test 'quoted text' then | done -eu export
+	$(pwd) printf --verbose -eu "$1" then printf ${HOME} printf done
+&& echo echo "$1" "$1" cd local sed -eu /usr/bin
+cd /usr/bin done && $(pwd) ${HOME} -eu grep awk
+	readonly -eu local done x=1 grep "$1" x=1 readonly readonly test printf
+	done "$1" "$1" cd export ${HOME} test | -eu -eu -eu export
+${HOME} echo 'quoted text' 'quoted text'
+	&& 2>/dev/null $(pwd) printf printf --verbose /usr/bin x=1 2>/dev/null echo sed
+"$1" 'quoted text' "$1" --verbose done "$@" -eu test cd ${HOME} cd
+	grep test grep export cd
+	cd local then done 2>/dev/null printf | 2>/dev/null echo && awk /usr/bin readonly
+		2>/dev/null echo "$1" && 'quoted text'
+	-eu awk /usr/bin | | printf sed "$1" export 'quoted text' $(pwd) awk echo
+	export cd printf sed awk awk grep local grep test ${HOME} | && echo x=1 local
+		"$1" "$1" echo x=1 'quoted text' readonly ${HOME}
+	printf awk /usr/bin done $(pwd)
+/usr/bin done && local $(pwd) -eu
+| -eu "$@" "$1" awk local $(pwd)
+	echo cd sed && done test --verbose test /usr/bin done readonly
+		echo sed test $(pwd) readonly --verbose export
+		/usr/bin x=1 x=1 printf "$@" /usr/bin 'quoted text'
+		2>/dev/null cd readonly echo /usr/bin -eu x=1 export
+"$@" grep echo "$1" cd 'quoted text' export sed grep awk
+	then export local export
+x=1 -eu export && $(pwd) sed -eu awk 2>/dev/null awk sed
+export done then && $(pwd) local done x=1 "$@" awk "$1"
+	"$1" 2>/dev/null && 2>/dev/null $(pwd) "$1" export export test x=1 $(pwd)
+		done done echo 'quoted text'
+	local grep --verbose printf awk done local
+	${HOME} cd -eu cd && 2>/dev/null awk echo && grep export echo local
+	-eu 'quoted text' 2>/dev/null --verbose && local $(pwd) awk readonly
+	'quoted text' awk && && x=1 then | printf export awk x=1 test test
+		then --verbose cd done
+sed awk $(pwd) "$1" "$@" $(pwd) && echo done /usr/bin | /usr/bin printf
+		grep "$@" -eu sed 'quoted text' cd readonly awk -eu then grep &&
+test ${HOME} $(pwd) -eu done cd x=1 cd $(pwd) --verbose
+		done 2>/dev/null x=1 --verbose awk | "$1" "$1" x=1 x=1 "$1" | 'quoted text'
+-eu && printf -eu sed && awk $(pwd) readonly
+	export ${HOME} grep grep done
+$(pwd) $(pwd) | && | --verbose x=1 "$1" 2>/dev/null printf "$@" x=1
+	readonly test | --verbose cd --verbose $(pwd) "$@" local
+	printf echo | grep /usr/bin cd printf ${HOME} --verbose done done -eu
+	-eu | test ${HOME} readonly "$1" -eu then done then echo
+	2>/dev/null /usr/bin readonly "$1" awk readonly
+	${HOME} && --verbose awk grep -eu /usr/bin test "$1" $(pwd) && --verbose test &&
+awk 2>/dev/null --verbose $(pwd) awk done
+printf then ${HOME} | &&
+		"$1" 2>/dev/null x=1 | /usr/bin readonly echo
+then echo && | -eu then grep sed readonly
+	cd printf printf cd sed --verbose | 2>/dev/null --verbose
+		done --verbose echo 2>/dev/null sed "$1" "$@" x=1 "$1" done readonly
+printf | --verbose test && readonly x=1 cd 2>/dev/null done
+'quoted text' x=1 && /usr/bin --verbose export && x=1 grep export local readonly
+	--verbose && "$1" done 2>/dev/null
+		'quoted text' local 2>/dev/null ${HOME} readonly -eu --verbose
+	--verbose --verbose sed awk
+	awk readonly printf grep sed local --verbose 'quoted text' printf && 'quoted text'
+-eu then ${HOME} awk grep $(pwd) | | done 'quoted text'
+cd cd x=1 echo local $(pwd) | 2>/dev/null cd "$@" grep
+	&& printf local "$1" awk local | 'quoted text' cd export awk readonly
+--verbose readonly "$1" |
+		sed | sed "$1" /usr/bin 2>/dev/null echo /usr/bin --verbose
+	&& echo printf export && done awk printf 'quoted text' && x=1 then export
+		awk awk "$@" "$@" echo 2>/dev/null awk sed 'quoted text' -eu
+grep && 'quoted text' readonly x=1 && 'quoted text'
+-eu sed 2>/dev/null awk export done test | awk "$1" 2>/dev/null ${HOME}
+	printf "$1" $(pwd) readonly --verbose then printf /usr/bin | test grep
+	done --verbose export
+	--verbose 'quoted text' sed cd "$1" done x=1 "$@" $(pwd) sed
+		--verbose grep sed awk done then sed cd $(pwd) readonly local ${HOME} printf
+	sed echo done ${HOME} export readonly
+&& done && sed printf grep cd readonly
+	-eu sed "$@" /usr/bin then done awk printf local done sed sed $(pwd)
+	-eu readonly "$1" readonly done --verbose printf printf
+	printf $(pwd) -eu readonly && ${HOME} then printf
+cd x=1 'quoted text' export grep printf test sed readonly "$@" grep
+		/usr/bin readonly test then test "$@" export "$@" "$1" printf |
+	test 'quoted text' -eu sed export readonly printf awk -eu "$1"
+		export --verbose awk awk $(pwd) $(pwd) cd /usr/bin
+2>/dev/null done local x=1 "$1" 'quoted text' export export done |
+		| local x=1 "$1" 2>/dev/null ${HOME}
+2>/dev/null readonly --verbose cd x=1 then 'quoted text' $(pwd) | /usr/bin
+		| "$1" | done done /usr/bin
+&& readonly ${HOME} 2>/dev/null echo export && then
+		${HOME} "$1" -eu ${HOME} --verbose --verbose ${HOME} | export awk
+	${HOME} "$1" 'quoted text' -eu && grep
+then printf $(pwd) | | ${HOME}
+	&& /usr/bin "$1" $(pwd) | 'quoted text' --verbose cd cd "$1" 'quoted text' echo
+export printf "$@" sed
+cd echo && --verbose awk | grep "$1" x=1
+	| 2>/dev/null done && test ${HOME} cd --verbose "$@" printf
+sed local then -eu $(pwd)
+	x=1 /usr/bin export | test $(pwd) test grep done ${HOME}
+	export x=1 printf readonly grep "$@" cd --verbose
+${HOME} done readonly "$1" | printf /usr/bin && test "$1" cd --verbose cd
+		2>/dev/null /usr/bin test | && local local
+${HOME} grep x=1 /usr/bin "$1" 'quoted text' /usr/bin echo
+	| 'quoted text' 2>/dev/null
+#include c83.sh
+		grep test grep done | cd /usr/bin cd x=1 -eu --verbose 2>/dev/null
+		awk && --verbose -eu printf then | --verbose "$1" export | 2>/dev/null
+| 2>/dev/null cd awk echo
+	awk test awk x=1 $(pwd) -eu 2>/dev/null
+		echo cd && sed && "$1" -eu ${HOME} --verbose --verbose &&
+'quoted text' local ${HOME} /usr/bin local /usr/bin local && export x=1 done
+		${HOME} --verbose sed export -eu "$@" /usr/bin ${HOME} cd $(pwd) -eu awk
+		| echo export "$@" | cd printf 'quoted text'
+	grep 2>/dev/null 'quoted text' --verbose done 2>/dev/null sed --verbose
+	test readonly | sed 2>/dev/null echo printf && test cd grep readonly
+echo "$1" echo readonly && "$1" x=1
+	--verbose grep export x=1 readonly then printf 2>/dev/null -eu readonly "$1"
+	-eu "$@" "$1" -eu sed $(pwd)
+/usr/bin local | cd printf "$@" 'quoted text'
+		awk cd readonly cd sed -eu sed ${HOME} "$@" done --verbose export
+		echo awk $(pwd) done test | /usr/bin
+"$@" /usr/bin | 2>/dev/null | echo readonly x=1 ${HOME} echo then 'quoted text'
+	grep done x=1 "$1" 2>/dev/null -eu x=1 grep grep local x=1 | awk readonly
+readonly "$@" "$@" grep $(pwd) x=1 -eu --verbose ${HOME} 'quoted text'
+		$(pwd) $(pwd) export readonly done readonly done | grep printf readonly --verbose
+awk echo local /usr/bin
+sed awk 'quoted text' "$1" printf $(pwd) "$1" -eu 2>/dev/null -eu --verbose export
+	-eu readonly cd done -eu "$@" test -eu done readonly
+		sed $(pwd) --verbose /usr/bin $(pwd) $(pwd) printf
+$(pwd) local && x=1 then export
+		sed export --verbose done "$@" awk -eu sed 'quoted text'
+	--verbose -eu && printf ${HOME} --verbose export awk 'quoted text'
+sed cd "$1" sed then printf awk printf ${HOME}
+	echo | test x=1 --verbose 'quoted text' echo $(pwd) done $(pwd) ${HOME} done
+&& && -eu cd | $(pwd) -eu awk echo "$1" then --verbose done done
+done ${HOME} done test sed awk -eu grep
+		then readonly sed /usr/bin echo | printf "$1" readonly
+	test ${HOME} -eu "$1" && | grep then cd x=1 export cd export "$@" then test 2>/dev/null
+	| ${HOME} local cd test
+	cd printf grep 2>/dev/null awk --verbose ${HOME} $(pwd) then "$1"
+	x=1 ${HOME} grep export local "$1" local local test readonly test then awk sed sed
+"$@" /usr/bin && local
+	export readonly -eu "$@"
+grep ${HOME} then grep | cd 2>/dev/null "$@" x=1 echo -eu |
+cd 2>/dev/null | ${HOME} --verbose 'quoted text' ${HOME} export "$1" test
+	x=1 && | export --verbose $(pwd) test test awk --verbose sed
+		readonly 2>/dev/null $(pwd) --verbose readonly /usr/bin
+"$1" printf export && export echo echo then local grep --verbose
+	export $(pwd) "$1" printf sed readonly test 'quoted text' $(pwd) readonly --verbose
+	$(pwd) "$@" done x=1 /usr/bin then
+		--verbose awk printf && "$@" ${HOME} test local cd export
+		echo "$1" echo sed export "$1" $(pwd) then -eu grep ${HOME} readonly
+	$(pwd) 2>/dev/null awk grep -eu local $(pwd) "$@" 'quoted text'
+cd printf "$@" awk && "$@"
+		| | local awk && | 'quoted text' x=1 /usr/bin done "$@" echo done
+	done /usr/bin "$1" readonly && "$1" && test x=1 awk 2>/dev/null
+${HOME} | x=1 --verbose "$@" sed sed
+echo | x=1 export grep cd "$@" grep | x=1 awk cd readonly ${HOME} local 'quoted text'
+	cd then printf then grep $(pwd) ${HOME} "$@" | 2>/dev/null awk
+"$1" then && export "$@" local /usr/bin --verbose
+		/usr/bin awk test sed printf printf ${HOME} "$@" $(pwd) grep awk
+done "$1" "$1" test export readonly
+	${HOME} sed local "$@" 2>/dev/null
+2>/dev/null 2>/dev/null done $(pwd) test awk
+"$1" printf 2>/dev/null -eu | x=1 awk "$1"
+	&& export grep -eu done test
+	test then ${HOME} "$1" echo readonly 'quoted text' -eu cd
+done echo /usr/bin done sed "$@" awk $(pwd)
+sed 'quoted text' done test 2>/dev/null test
+		${HOME} grep ${HOME} x=1 | sed 2>/dev/null then -eu grep done | $(pwd) -eu
+-eu local local "$1" awk && ${HOME} "$1" readonly grep cd grep "$@" 2>/dev/null
+	"$1" test then x=1 export echo echo | readonly sed 2>/dev/null export x=1 "$@" --verbose
+		'quoted text' 'quoted text' export awk echo
+		done "$@" 'quoted text' grep ${HOME} | --verbose | then test -eu
+		test grep $(pwd) 'quoted text' cd "$@" | sed local -eu printf
+	--verbose /usr/bin sed readonly --verbose
+-eu readonly 'quoted text' && grep "$@"
+sed local local | "$@" test echo 'quoted text' -eu "$@" -eu readonly
+"$1" readonly readonly then && "$@" x=1 --verbose awk sed "$1" /usr/bin
+2>/dev/null /usr/bin 'quoted text' "$@" x=1 grep
+		cd ${HOME} done readonly readonly done export ${HOME}
+		local "$1" --verbose cd 'quoted text' test
+		cd | 2>/dev/null x=1 && local readonly printf cd
+	${HOME} test sed -eu awk 2>/dev/null done local echo local test $(pwd) test local
+		sed cd "$1" x=1 && printf test cd /usr/bin readonly /usr/bin
+	echo readonly done done "$1" "$@" 'quoted text' export | ${HOME} done
+echo x=1 grep then 'quoted text'
+		2>/dev/null sed echo && $(pwd) export $(pwd) grep
+	grep "$1" ${HOME} local ${HOME}
+	"$@" sed 'quoted text' export -eu readonly
+	&& then done ${HOME} "$@" x=1 readonly readonly $(pwd) sed "$@" grep grep $(pwd)
+/usr/bin ${HOME} $(pwd) && x=1 ${HOME} -eu $(pwd) --verbose ${HOME} printf
+		then grep "$@" local echo cd readonly done "$1" -eu
+	$(pwd) printf export then --verbose printf --verbose
+x=1 awk "$1" x=1 | local "$@" "$1" 2>/dev/null 2>/dev/null -eu
+done sed done "$@" printf sed | 2>/dev/null test /usr/bin test local test
+sed | 2>/dev/null printf local export grep | --verbose cd local then readonly &&
+'quoted text' then done --verbose grep grep
+	cd awk readonly x=1 'quoted text' /usr/bin export done /usr/bin printf sed -eu sed
+"$1" "$1" x=1 /usr/bin
+		printf awk grep readonly "$@" sed "$@" done local -eu x=1 "$@" done
+		"$@" -eu echo "$1" 'quoted text' | cd x=1 echo cd && echo echo printf readonly
+	x=1 x=1 "$@" -eu "$1" readonly
+	sed "$@" grep $(pwd) printf $(pwd) 'quoted text'
+		sed awk --verbose local sed printf test then --verbose test awk done
+	"$1" export --verbose 2>/dev/null
+		readonly --verbose 2>/dev/null
+export test 2>/dev/null
+	2>/dev/null x=1 "$@" 2>/dev/null test awk x=1 "$1" readonly
+readonly readonly export 2>/dev/null sed echo 'quoted text' done export
+		${HOME} --verbose local 'quoted text' printf 2>/dev/null grep 2>/dev/null
+local done readonly export printf
+test local local "$1" done /usr/bin local then
+	then printf done test printf readonly local "$@" "$@" test /usr/bin 'quoted text'
+		$(pwd) awk "$@" cd sed 2>/dev/null export | export "$1" ${HOME}
+cd "$1" 'quoted text' --verbose "$@" $(pwd) 2>/dev/null awk 2>/dev/null
+	${HOME} echo "$@" grep done | readonly
+	"$1" export $(pwd) awk $(pwd) | local -eu
+		cd ${HOME} "$@" test export
+		/usr/bin --verbose "$@" readonly awk printf export && local
+	then 'quoted text' 'quoted text' readonly 2>/dev/null /usr/bin --verbose
+echo readonly ${HOME} local
+		echo x=1 "$@" 2>/dev/null "$@" ${HOME} sed printf readonly sed -eu "$@" sed
+	then then --verbose 'quoted text' ${HOME} done 'quoted text'
+		echo done && /usr/bin --verbose cd 'quoted text' readonly 'quoted text' $(pwd)
+		--verbose export "$1" x=1 && grep
+		echo --verbose done | then "$1" $(pwd)
+		sed -eu export "$1" done
+	$(pwd) -eu readonly local "$@" cd
+		printf $(pwd) export $(pwd) then && export && 'quoted text' then
+		"$1" grep printf test /usr/bin $(pwd)
+readonly cd --verbose grep local "$@" | x=1 readonly /usr/bin
+awk then | 'quoted text' test && 'quoted text' test sed
+	"$@" readonly $(pwd) ${HOME} $(pwd) export
+readonly 'quoted text' $(pwd) "$1"
+	sed ${HOME} -eu $(pwd) done then test done readonly /usr/bin done done then 'quoted text'
+then && && "$@" done x=1 ${HOME} sed sed && done -eu ${HOME} sed ${HOME} 'quoted text'
+	&& export && ${HOME} local grep --verbose
+$(pwd) readonly readonly 2>/dev/null $(pwd)
+	"$1" test echo readonly ${HOME} printf x=1 done $(pwd) export then "$1"
+local then test -eu "$@" export x=1 && sed "$@"
+	cd --verbose printf --verbose 'quoted text' sed awk 'quoted text' printf "$1"
+'quoted text' printf | 'quoted text' "$@" sed
+	export cd 2>/dev/null ${HOME}
+		done echo grep echo printf test x=1 done
+local done then /usr/bin /usr/bin
+		sed export echo then export $(pwd) /usr/bin $(pwd)
+	/usr/bin | awk /usr/bin local echo 2>/dev/null echo done --verbose echo sed sed
+		done "$1" printf "$@" && /usr/bin cd awk 2>/dev/null "$1" done echo && local --verbose
+		grep local done -eu $(pwd) /usr/bin -eu "$1" "$1" test 'quoted text'
+		readonly done cd readonly then
+readonly printf /usr/bin echo
+		-eu test 2>/dev/null -eu | sed ${HOME} readonly
+	cd grep then cd 2>/dev/null /usr/bin readonly
+		2>/dev/null "$@" 'quoted text' x=1 local export local test && ${HOME} grep -eu
+		test local $(pwd) 2>/dev/null "$@" 2>/dev/null 'quoted text'
+	2>/dev/null x=1 then
+x=1 awk done --verbose done "$@" then | $(pwd) x=1 | sed readonly 'quoted text'
+"$@" echo ${HOME} -eu
+	local printf "$1" cd test "$1" local then sed "$@" && export test -eu
+export | && $(pwd) | --verbose
+"$1" printf | awk awk "$@" done local
+cd ${HOME} /usr/bin readonly $(pwd) then --verbose done
+		-eu "$1" printf -eu readonly | ${HOME} readonly grep
+	'quoted text' -eu awk awk "$1" echo ${HOME}
+2>/dev/null echo printf --verbose ${HOME}
+		'quoted text' 2>/dev/null export
+	"$@" "$@" cd --verbose ${HOME} $(pwd) 2>/dev/null x=1 "$1"
+		readonly test ${HOME} export 2>/dev/null sed && "$1" --verbose awk
+awk sed readonly "$1" ${HOME} done "$@"
+-eu echo printf echo "$@" test
+	grep then local 2>/dev/null
+	test 'quoted text' readonly
+	/usr/bin x=1 test /usr/bin cd --verbose --verbose && sed x=1 grep done echo 'quoted text'
+cd grep echo readonly && 'quoted text' x=1 then 2>/dev/null
+	"$@" 2>/dev/null 'quoted text' grep
+	$(pwd) sed && x=1 x=1 echo sed -eu "$@"
+	cd sed printf "$@" $(pwd) $(pwd) 2>/dev/null /usr/bin readonly
+local x=1 | "$@" cd readonly printf grep
+	x=1 printf $(pwd) grep local then
+	awk --verbose done grep local |
+		readonly readonly readonly --verbose cd printf
+	/usr/bin local -eu echo test "$@" cd grep readonly /usr/bin done printf
+2>/dev/null readonly "$1" cd echo --verbose local sed then echo /usr/bin
+cd readonly "$@" printf done "$1" cd grep echo -eu $(pwd)
+		/usr/bin readonly printf readonly export -eu x=1 $(pwd) sed
+export export x=1 ${HOME} readonly "$@" export grep local readonly | done
+readonly printf && awk grep ${HOME} done x=1
+		grep /usr/bin readonly x=1 test printf "$1" ${HOME} printf then "$@"
+grep /usr/bin cd 'quoted text' | printf echo "$@" "$1" awk local
+test then -eu x=1 readonly done echo grep sed local x=1 2>/dev/null
+-eu echo grep $(pwd) ${HOME} --verbose --verbose x=1 echo "$@" -eu local
+done printf printf "$@" awk --verbose grep && --verbose x=1
+	done printf awk 'quoted text' test -eu ${HOME} /usr/bin done test awk
+		"$@" local 'quoted text' /usr/bin | done x=1 then sed "$@"
+	cd | 'quoted text' $(pwd) readonly printf 2>/dev/null echo awk grep test && awk
+		echo "$@" | ${HOME} | done 'quoted text' $(pwd) then test -eu | --verbose echo
+		local 2>/dev/null printf
+	test 2>/dev/null 2>/dev/null "$@"
+	-eu readonly $(pwd) "$@" 'quoted text'
+	$(pwd) local "$@" /usr/bin grep readonly /usr/bin grep local test 'quoted text'
+cd && ${HOME} sed && export cd "$1" "$@" awk readonly echo | | /usr/bin local
+	awk grep --verbose x=1 "$@" "$1" export done ${HOME}
+	&& | printf echo $(pwd) "$@" awk printf cd then /usr/bin x=1
+	&& test 2>/dev/null grep local printf
+		&& test $(pwd) | x=1 "$1" 'quoted text'
+	awk x=1 ${HOME} sed | test awk
+		sed --verbose printf | x=1 printf -eu
+	cd grep && cd printf 2>/dev/null awk cd echo
+	export && printf x=1 then done printf $(pwd) then test
+		${HOME} 'quoted text' readonly grep | done test
+	/usr/bin grep awk sed printf readonly
+	"$@" readonly test then x=1 awk export
+		${HOME} sed readonly && 'quoted text' "$@" test 2>/dev/null 2>/dev/null
+| "$@" readonly readonly
+		then "$1" done x=1 -eu 'quoted text' grep 'quoted text' ${HOME} "$1" "$@" local
+	done done local sed && /usr/bin test --verbose
+		export x=1 -eu | "$@" 2>/dev/null done
+		$(pwd) --verbose awk echo && $(pwd) ${HOME} x=1 &&
+		"$1" test 2>/dev/null local $(pwd) readonly ${HOME} readonly test /usr/bin "$@"
+	cd "$1" readonly x=1 awk "$@" local "$@" && awk "$1"
+	2>/dev/null && | -eu $(pwd) awk printf $(pwd) &&
+then "$@" grep "$1" readonly ${HOME} -eu printf
+		readonly /usr/bin "$@" && echo x=1 --verbose
+		x=1 sed sed done readonly && cd x=1 local 'quoted text'
+local 2>/dev/null grep "$@" awk "$@"
+--verbose done -eu 2>/dev/null sed 'quoted text' /usr/bin
+"$@" export "$1" local /usr/bin readonly "$1" sed "$1" -eu | done 'quoted text'
+		sed $(pwd) | $(pwd) done awk --verbose --verbose ${HOME} x=1 sed --verbose
+	echo local then ${HOME} readonly ${HOME} /usr/bin /usr/bin then local
+	$(pwd) readonly --verbose -eu | export
+	&& $(pwd) | grep --verbose 2>/dev/null test --verbose ${HOME} printf
+	x=1 export -eu local x=1 /usr/bin grep then then
+	"$@" done cd readonly "$@" && x=1 | "$@" readonly sed x=1 x=1 cd echo /usr/bin
+	echo x=1 | -eu && printf "$@" "$1" local 'quoted text' sed "$1" grep done readonly
+	test $(pwd) grep done printf -eu 2>/dev/null test && $(pwd) -eu "$1"
+'quoted text' awk ${HOME} && -eu test echo $(pwd) /usr/bin echo printf 'quoted text'
+printf then "$1" local test ${HOME} --verbose 2>/dev/null
+	export 'quoted text' cd ${HOME} cd readonly 2>/dev/null
+grep -eu local awk readonly "$@"
+	${HOME} grep "$@" && cd | then --verbose
+	2>/dev/null --verbose export sed | local echo && cd "$1"
+echo readonly 2>/dev/null awk cd readonly
+		test -eu sed "$@" sed && && export sed echo local && | sed x=1 | sed
+		$(pwd) $(pwd) "$1" && local -eu | && -eu ${HOME} 2>/dev/null
+| 2>/dev/null printf grep x=1 "$@" && sed sed awk local /usr/bin test
+		then "$1" && cd printf echo "$@" printf
+		printf --verbose grep then cd export /usr/bin echo then "$@" printf 2>/dev/null
+		-eu 'quoted text' ${HOME} awk && x=1 | export
+		readonly --verbose sed cd test | 'quoted text'
+	/usr/bin grep test | echo
+		"$@" ${HOME} awk 2>/dev/null sed
+		x=1 sed --verbose cd local export ${HOME} &&
+		&& --verbose /usr/bin "$1" sed echo "$@"
+		printf /usr/bin awk 2>/dev/null export
+	export -eu done $(pwd)
+		-eu x=1 "$@" x=1 $(pwd) 'quoted text'
+		cd sed && $(pwd) grep $(pwd) then | "$1"
+	$(pwd) readonly local -eu
+awk readonly && && /usr/bin 2>/dev/null readonly && -eu --verbose
+		"$1" sed "$1" 2>/dev/null awk printf grep export awk $(pwd) grep echo "$@" test
+		--verbose --verbose local -eu x=1 && export
+	2>/dev/null $(pwd) "$1" grep /usr/bin $(pwd)
+		then && done awk x=1 x=1 cd $(pwd) readonly export -eu local 'quoted text'
+readonly 'quoted text' grep | 'quoted text'
+	${HOME} echo -eu ${HOME} local && $(pwd)
+	x=1 x=1 grep 2>/dev/null x=1 printf 'quoted text' 'quoted text' 2>/dev/null
+	-eu echo /usr/bin grep 2>/dev/null x=1 | | test /usr/bin /usr/bin printf
+		'quoted text' | | test 'quoted text'
+"$@" cd test x=1 readonly export x=1 awk "$1" export
+		sed echo "$@" 'quoted text'
+export | printf sed test x=1 'quoted text' done 2>/dev/null awk printf --verbose
+	&& | cd && x=1 cd /usr/bin $(pwd) awk sed
+		2>/dev/null export printf
+		export && printf awk printf | 2>/dev/null awk --verbose
+&& sed "$1" local sed awk grep export $(pwd)
+/usr/bin sed local 2>/dev/null
+		2>/dev/null then ${HOME} cd -eu grep echo x=1 x=1 done /usr/bin ${HOME}
+		echo 'quoted text' /usr/bin awk grep && grep && | | --verbose
+	export | echo "$1" grep &&
+test "$1" 'quoted text' test grep local | echo local "$1" readonly | 'quoted text'
+		"$@" | test x=1 && then x=1 printf export then --verbose echo x=1 "$@"
+		done --verbose 2>/dev/null /usr/bin x=1 grep echo printf x=1 grep "$1" "$@"
+	grep 'quoted text' export readonly
+		| && awk printf local
+	-eu test grep ${HOME} "$1" -eu cd awk
+		"$@" echo export readonly sed /usr/bin grep /usr/bin
+done ${HOME} export $(pwd) local "$1" test then 2>/dev/null
+sed test test echo local "$1" $(pwd) echo awk readonly test
+		export && local then then && -eu
+	echo printf --verbose ${HOME} printf x=1 grep echo "$@" sed then local
+		done then --verbose done -eu echo "$1" 'quoted text' echo
+&& awk && sed "$@" grep awk $(pwd) ${HOME} test cd /usr/bin
+then x=1 sed "$@" ${HOME} "$@" /usr/bin
+		2>/dev/null awk ${HOME} done "$1" "$1" export && && local x=1
+	"$1" -eu -eu sed x=1 export "$1" grep -eu sed then done --verbose grep
+done sed test grep --verbose /usr/bin 2>/dev/null sed x=1
+	x=1 /usr/bin | then cd "$@" ${HOME} sed grep ${HOME} 'quoted text'
+/usr/bin "$@" sed ${HOME} /usr/bin 'quoted text' 2>/dev/null
+		grep readonly awk -eu
+		${HOME} "$@" $(pwd) test awk test awk then done local test sed awk
+		--verbose "$@" 'quoted text' --verbose sed -eu awk done cd | sed test then sed
+export echo readonly /usr/bin readonly done
+		"$@" awk done export export export export | ${HOME} x=1 2>/dev/null
+		grep printf then cd readonly
+/usr/bin x=1 sed readonly | | done sed "$@" awk
+test done ${HOME} sed "$1"
+	-eu $(pwd) then "$1" done printf
+		printf readonly $(pwd) "$1" local "$@" "$1" /usr/bin "$1" /usr/bin
+		echo grep echo grep "$1" sed done
+	"$@" cd | ${HOME} --verbose readonly | export
+		awk --verbose | && echo
+	$(pwd) "$@" "$1" && then then done 2>/dev/null
+&& echo sed | | -eu export "$1" local grep $(pwd) local then sed awk $(pwd)
+		&& then --verbose readonly local test done 'quoted text' x=1 printf test cd
+x=1 ${HOME} grep --verbose x=1 /usr/bin done $(pwd) | grep ${HOME} | grep
+x=1 export /usr/bin --verbose done ${HOME} readonly "$@" done | &&
+		"$1" readonly 'quoted text' && cd
+	2>/dev/null $(pwd) 'quoted text'
+	done "$1" && x=1 then sed
+	--verbose $(pwd) "$1" $(pwd) test awk cd "$1" | | then
+		readonly | ${HOME} local grep 2>/dev/null grep awk sed /usr/bin then
+	$(pwd) 'quoted text' readonly awk export ${HOME} awk done grep --verbose
+		${HOME} local echo readonly test ${HOME} -eu x=1 grep 'quoted text' -eu "$1"
+	sed /usr/bin test /usr/bin local ${HOME} echo 'quoted text' done then echo |
+local /usr/bin /usr/bin sed --verbose 'quoted text' local $(pwd)
+	&& "$1" --verbose awk 2>/dev/null sed done "$1" cd 2>/dev/null
+"$1" readonly && sed printf echo --verbose cd export "$1" | awk x=1 echo
+echo x=1 awk grep -eu grep echo --verbose -eu printf "$@" echo
+		2>/dev/null awk echo $(pwd) cd /usr/bin $(pwd) -eu "$@" printf export
+	'quoted text' -eu cd echo -eu /usr/bin sed awk 'quoted text'
+$(pwd) --verbose "$1"
+		sed && -eu /usr/bin then "$1" readonly
+&& --verbose then printf printf sed "$@" "$1" cd printf export local |
+		printf /usr/bin export
+		/usr/bin 2>/dev/null --verbose x=1 test "$1" local "$1" export export
+	--verbose local cd --verbose 'quoted text' test export test "$@" $(pwd) awk
+local grep "$@" "$@" /usr/bin grep grep printf 'quoted text'
+		sed echo 2>/dev/null test /usr/bin
+	grep ${HOME} printf then awk $(pwd) echo awk printf 2>/dev/null ${HOME}
+| then && echo test 2>/dev/null
+		sed ${HOME} 'quoted text' cd readonly cd
+		${HOME} printf cd sed cd "$1" x=1 echo "$1" x=1 | 2>/dev/null
+		2>/dev/null echo export | | grep export export done x=1 && grep x=1 && 2>/dev/null
+	2>/dev/null $(pwd) "$@" sed "$1" export
+	done 'quoted text' --verbose printf $(pwd) echo --verbose | cd /usr/bin -eu
+		x=1 | awk 'quoted text' $(pwd) then | && 2>/dev/null grep ${HOME} grep echo
+	sed && --verbose grep awk grep test --verbose
+test "$@" "$1" then then sed test -eu readonly
+local export sed grep test "$1" "$@" export
+	cd echo -eu grep -eu then $(pwd)
+		then 2>/dev/null "$@" done cd 'quoted text' --verbose &&
+	then --verbose "$@" | readonly 'quoted text' x=1 printf
+		then done --verbose ${HOME} /usr/bin
+	echo local -eu sed then local 2>/dev/null
+	export sed 2>/dev/null | cd cd awk readonly local
+		local done readonly "$@" | x=1 && done done 2>/dev/null done $(pwd) done
+echo awk printf printf /usr/bin awk local cd | "$@" echo local
+	x=1 | sed 2>/dev/null | sed
+	${HOME} --verbose done -eu x=1 /usr/bin
+"$@" cd --verbose "$1" 'quoted text' 2>/dev/null $(pwd) cd 'quoted text' printf
+	done 2>/dev/null cd test && echo $(pwd)
+		local sed sed -eu x=1 then printf $(pwd) printf
+x=1 $(pwd) then 'quoted text' && x=1 awk grep then --verbose -eu | cd -eu done
+	${HOME} ${HOME} && done $(pwd)
+cd /usr/bin then test cd test awk local cd local local
+	readonly then readonly awk export
+$(pwd) /usr/bin export then readonly awk local readonly awk printf
+echo export done awk ${HOME} 'quoted text' done ${HOME}
+	"$1" "$@" printf sed done test awk cd printf
+	awk $(pwd) | 'quoted text' sed 'quoted text' 'quoted text' cd local &&
+		grep 'quoted text' test ${HOME}
+&& cd local -eu awk "$@" -eu done awk -eu $(pwd) ${HOME} $(pwd)
+	2>/dev/null --verbose -eu "$1"
+awk "$@" 2>/dev/null "$@" sed -eu -eu
+		cd /usr/bin done ${HOME} sed export
+		readonly "$@" 'quoted text' test /usr/bin local done x=1 local then export then
+		| grep --verbose -eu 2>/dev/null "$1" test | cd && | awk test ${HOME}
+		2>/dev/null export $(pwd) && 'quoted text' grep
+	readonly local readonly printf sed done export printf then
+local then done export "$1" $(pwd) cd | cd
+		x=1 local grep "$@" awk "$@" then $(pwd) "$@" grep --verbose && "$@"
+		test x=1 -eu readonly 2>/dev/null 'quoted text'
+printf 2>/dev/null $(pwd) "$@" $(pwd)
+	then --verbose "$1" export
+/usr/bin 'quoted text'
+	echo $(pwd) ${HOME} 2>/dev/null grep && cd 'quoted text' then /usr/bin then -eu
+		-eu 'quoted text' "$@" x=1 2>/dev/null && ${HOME}
+	"$@" then local sed printf | export --verbose cd
+&& | /usr/bin printf "$1" awk "$1" test echo 2>/dev/null test readonly
+	awk export echo "$@" -eu
+		"$1" x=1 awk 'quoted text' readonly grep --verbose
+	export x=1 local --verbose awk done && grep | "$@" grep && $(pwd) "$1" sed grep
+"$1" && cd export cd -eu x=1
+	/usr/bin $(pwd) x=1 && $(pwd) echo $(pwd) "$@" local
+		"$@" ${HOME} then awk x=1
+echo done sed 'quoted text' 'quoted text'
+	done ${HOME} export printf done done done grep test printf -eu printf $(pwd)
+		'quoted text' "$1" 'quoted text' sed /usr/bin x=1 -eu done export | | printf |
+$(pwd) | cd test local then 'quoted text'
+		"$@" "$@" ${HOME} 'quoted text' &&
+	-eu | grep sed grep --verbose printf x=1 echo readonly "$@" done awk export
+	export test x=1 && local x=1 $(pwd) echo | grep | done done
+"$@" "$@" /usr/bin export done
+&& echo 2>/dev/null local
+		--verbose cd "$1" "$1" ${HOME} done --verbose done printf && readonly printf 2>/dev/null
+	--verbose cd 2>/dev/null $(pwd) "$@"
+		echo "$1" ${HOME} ${HOME} | cd printf ${HOME} "$@" "$@" grep
+	-eu local sed | readonly export 'quoted text' sed then readonly "$@" done
+		echo local export grep "$1" /usr/bin done echo && export /usr/bin $(pwd)
+local then export ${HOME} 'quoted text' test cd | cd grep
+	printf --verbose cd local | local -eu test readonly "$1" printf local
+echo awk export --verbose sed --verbose test cd awk | cd 2>/dev/null
+		x=1 done 2>/dev/null readonly cd readonly then --verbose sed awk test /usr/bin
+		test sed readonly printf echo test ${HOME}
+		cd awk readonly awk && local
+		-eu test $(pwd) done export export ${HOME} done then x=1 then "$1" && | ${HOME}
+then -eu 2>/dev/null -eu cd echo --verbose
+	| grep awk export ${HOME} "$1" 2>/dev/null cd echo export printf
+/usr/bin | /usr/bin $(pwd) grep
+	awk 2>/dev/null then awk /usr/bin && "$@" export
+cd -eu sed && x=1 $(pwd) x=1 test done && cd local ${HOME} $(pwd) readonly
+	readonly 2>/dev/null printf -eu test awk ${HOME} test
+	$(pwd) local 2>/dev/null "$1" local $(pwd)
+		'quoted text' local then x=1 --verbose awk cd grep
+printf done -eu -eu sed sed $(pwd) echo printf then
+	'quoted text' 'quoted text' ${HOME}
+	local --verbose test readonly | grep && awk | ${HOME} readonly
+&& && "$1" && printf -eu local $(pwd)
+	${HOME} awk sed grep /usr/bin "$@" echo
+		'quoted text' -eu 'quoted text' then "$@" then awk 2>/dev/null "$1" done sed
+		"$1" printf test printf
+		grep awk $(pwd) done export /usr/bin
+readonly -eu 2>/dev/null echo x=1 /usr/bin sed 2>/dev/null grep printf echo local
+	--verbose sed 2>/dev/null && $(pwd) 'quoted text' 2>/dev/null
+${HOME} "$@" then x=1 grep done 2>/dev/null
+sed --verbose "$1" x=1 export ${HOME} | $(pwd) sed
+		${HOME} ${HOME} -eu 2>/dev/null done "$@"
+cd done sed /usr/bin 'quoted text'
+	$(pwd) | awk -eu --verbose echo grep export ${HOME} -eu
+$(pwd) export | $(pwd) test done then 'quoted text'
+	echo cd local $(pwd) /usr/bin | test then readonly
+		"$@" readonly readonly 2>/dev/null
+echo local "$@" -eu done test ${HOME} 'quoted text' $(pwd)
+	"$1" $(pwd) done --verbose --verbose then 'quoted text' -eu
+2>/dev/null /usr/bin grep && export "$@" cd ${HOME} /usr/bin 2>/dev/null
+	test echo printf test then grep | "$1"
+	cd echo 'quoted text' cd echo sed done | -eu then export x=1 test sed ${HOME}
+		done awk "$1" $(pwd) && /usr/bin "$1" awk done local
+test cd 'quoted text' grep ${HOME} printf x=1
+		"$@" $(pwd) sed awk printf sed 'quoted text'
+grep /usr/bin awk done | "$1" "$1" test export | cd "$1" /usr/bin
+awk | 2>/dev/null "$1" 'quoted text'
+		test then printf 2>/dev/null test "$@" readonly test | then readonly test "$@"
+		sed echo awk local done test
+	&& cd grep "$@" then awk /usr/bin printf grep
+printf cd ${HOME} done
+		export -eu sed "$@" readonly done 2>/dev/null "$@" awk "$@"
+		test "$@" --verbose -eu sed $(pwd) 2>/dev/null cd cd 2>/dev/null
+		'quoted text' && -eu --verbose printf then
+	/usr/bin readonly export ${HOME} x=1 test local 2>/dev/null
+	awk | 2>/dev/null test local 'quoted text'
+test $(pwd) cd grep grep done echo done --verbose cd "$1" | x=1 awk local
+printf "$1" printf grep test grep -eu export local ${HOME} test && ${HOME}
+		export ${HOME} 2>/dev/null export readonly --verbose 'quoted text' /usr/bin
+&& 'quoted text' grep | echo && test 'quoted text'
+x=1 sed x=1 "$@" "$1" awk && "$@" cd | /usr/bin /usr/bin
+	awk done echo 'quoted text' grep --verbose "$1"
+&& sed grep -eu sed test done echo x=1 "$@" "$@" readonly echo ${HOME}
+		| -eu readonly then echo "$@" cd --verbose cd "$@"
+grep "$@" "$@" "$1" echo sed export x=1 awk readonly
+		/usr/bin printf then "$@" 'quoted text' /usr/bin -eu "$1" --verbose
+	test cd /usr/bin 2>/dev/null
+	echo readonly | test /usr/bin sed 'quoted text'
+	--verbose readonly printf | /usr/bin readonly local | cd $(pwd) local
+'quoted text' sed --verbose $(pwd) sed export awk cd then ${HOME} awk 2>/dev/null
+'quoted text' /usr/bin && x=1
+&& 2>/dev/null $(pwd) local test test cd echo | /usr/bin /usr/bin 'quoted text'
+	done 'quoted text' local
+	local printf printf && | 'quoted text'
+cd awk done ${HOME} ${HOME} 2>/dev/null
+	grep test /usr/bin readonly x=1
+		-eu done 'quoted text' "$@" grep | echo grep --verbose sed local
+	printf "$1" then 'quoted text'
+		&& awk "$1" printf -eu | echo "$@" -eu echo 2>/dev/null printf
+	cd test ${HOME} 'quoted text' "$1" echo 2>/dev/null --verbose "$1" test
+		${HOME} $(pwd) 2>/dev/null 2>/dev/null echo then
+sed "$@" "$1" "$@" echo && grep local
+		export ${HOME} cd cd && printf /usr/bin x=1 then done 2>/dev/null
+	&& cd 'quoted text' test "$1" awk readonly
+echo | echo cd grep then && test local "$@" 2>/dev/null
+	&& echo "$@" cd "$@" $(pwd) | 'quoted text' echo done "$@" export -eu 2>/dev/null
+		echo "$1" echo /usr/bin printf && printf /usr/bin $(pwd) 2>/dev/null /usr/bin
+$(pwd) | 2>/dev/null readonly | printf test 'quoted text'
+		2>/dev/null readonly done /usr/bin
+awk $(pwd) done "$1" grep echo
+	sed | ${HOME} /usr/bin echo $(pwd) --verbose $(pwd) 'quoted text'
+-eu printf printf echo local grep /usr/bin done
+		local --verbose echo then readonly ${HOME} -eu ${HOME}
+		cd && done "$@" awk x=1 done 2>/dev/null "$1"
+	then test awk cd -eu 2>/dev/null test echo x=1 ${HOME} --verbose export
+		--verbose readonly then 'quoted text' "$@" local $(pwd) sed $(pwd)
+readonly local readonly -eu /usr/bin then && readonly
+2>/dev/null --verbose then 2>/dev/null
+printf test export $(pwd) test
+sed sed printf export awk echo
+	"$@" x=1 'quoted text' | cd export echo x=1 $(pwd) then readonly
+		${HOME} 'quoted text' cd grep ${HOME}
+		&& printf --verbose x=1 -eu 2>/dev/null echo sed && $(pwd) export | "$1"
+	/usr/bin export --verbose local | cd 2>/dev/null
+		| readonly grep export awk cd
+		--verbose sed "$@" "$@" printf cd 2>/dev/null awk -eu 2>/dev/null
+		x=1 "$@" | cd test done 2>/dev/null awk local 'quoted text' export ${HOME}
+		printf 2>/dev/null &&
+	then && && awk cd /usr/bin
+done /usr/bin test awk x=1 readonly sed /usr/bin cd
+		"$@" | 2>/dev/null then sed && "$1" --verbose
+sed "$@" awk "$1" test awk local && ${HOME} done --verbose grep
+sed x=1 "$1" awk /usr/bin printf && | test /usr/bin $(pwd) export x=1 local -eu
+	$(pwd) export cd readonly local /usr/bin readonly echo /usr/bin cd local
+		&& then $(pwd) echo "$@" ${HOME} done grep /usr/bin --verbose
+	cd /usr/bin ${HOME} -eu "$1" done readonly
+	'quoted text' x=1 sed -eu done ${HOME} awk -eu done sed $(pwd) cd done
+then "$1" x=1 && $(pwd) cd then readonly 2>/dev/null
+	sed echo sed ${HOME} grep --verbose printf local done
+	grep cd awk readonly "$@" test $(pwd)
+	"$1" readonly echo "$@" 2>/dev/null --verbose ${HOME} --verbose readonly "$1" x=1
+"$1" test awk export sed |
+echo -eu 'quoted text' 2>/dev/null
+	2>/dev/null awk 2>/dev/null "$@" export
+		| $(pwd) && "$1" -eu -eu
+		/usr/bin awk | | /usr/bin 'quoted text' 'quoted text'
+	readonly test | export sed 'quoted text'
+		&& 2>/dev/null ${HOME} then "$@" test 2>/dev/null --verbose echo && -eu "$1"
+		-eu "$@" awk awk 2>/dev/null 2>/dev/null cd 2>/dev/null 'quoted text'
+	/usr/bin cd ${HOME} 2>/dev/null /usr/bin
+	test sed --verbose 2>/dev/null sed export && awk awk grep export done -eu "$@"
+		$(pwd) "$1" sed export awk "$@" then export readonly /usr/bin /usr/bin
+done /usr/bin | printf $(pwd) --verbose
+	'quoted text' ${HOME} printf 'quoted text' 'quoted text' "$1" x=1 "$@"
+		local done ${HOME} ${HOME} "$@" echo
+--verbose "$1" printf awk x=1 echo --verbose --verbose
+test done export done 2>/dev/null awk 'quoted text' export $(pwd) $(pwd)
+		printf ${HOME} cd export awk test test done $(pwd) 'quoted text' then -eu
+		readonly && cd -eu "$1"
+		'quoted text' | test export 2>/dev/null "$@" test sed local readonly
+"$@" printf printf x=1 awk cd echo && x=1 'quoted text' cd && $(pwd) "$@"
+	cd printf echo then cd "$1" sed 'quoted text' -eu | local | cd
+	done awk 'quoted text' ${HOME} then test
+		export local sed | echo test --verbose sed awk echo then printf $(pwd)
+		2>/dev/null "$1" readonly 2>/dev/null readonly "$1"
+test local ${HOME} 2>/dev/null x=1 awk printf --verbose readonly echo
+-eu cd -eu 2>/dev/null awk --verbose "$@" 'quoted text'
+	awk 2>/dev/null -eu /usr/bin
+	x=1 awk then ${HOME} grep
+export && printf "$1" ${HOME} sed -eu "$1" done $(pwd) done export local
+-eu awk --verbose $(pwd) done done
+	&& "$@" --verbose then x=1 sed echo --verbose cd /usr/bin
+export local | then ${HOME} | x=1 awk then
+sed -eu /usr/bin sed && --verbose grep awk grep ${HOME} x=1 | && then
+done $(pwd) -eu export 2>/dev/null done
+	2>/dev/null cd readonly
+$(pwd) export | export test then awk done
+	/usr/bin done 'quoted text' echo 2>/dev/null
+	grep awk | x=1 ${HOME} local /usr/bin
+		&& export /usr/bin sed done grep x=1 echo --verbose then &&
+local sed awk printf "$@" 'quoted text' then 'quoted text'
+	then x=1 cd "$@" "$@" grep | then x=1 "$@" "$1" printf /usr/bin echo -eu
+"$@" && | readonly done x=1 cd --verbose
+| sed | 2>/dev/null x=1 "$1" done
+	sed done then readonly -eu test grep && $(pwd)
+${HOME} echo done /usr/bin 2>/dev/null export done printf 'quoted text' readonly
+		${HOME} && echo x=1 sed export 'quoted text' echo readonly 2>/dev/null echo
+	2>/dev/null sed cd sed --verbose 'quoted text' && export done sed local 'quoted text'
+	cd sed grep $(pwd) grep test /usr/bin && "$1" echo | done 2>/dev/null
+		export readonly done test x=1 test "$@" -eu -eu done 'quoted text' $(pwd)
+| $(pwd) 'quoted text'
+	${HOME} awk echo test sed awk "$1" "$1"
+	readonly --verbose grep "$1" echo printf -eu "$1" printf
+"$@" x=1 $(pwd) x=1 x=1 cd local awk awk local done echo readonly -eu
+	"$@" export done echo echo 'quoted text'
+	${HOME} awk 2>/dev/null export /usr/bin ${HOME} /usr/bin --verbose local
+		export ${HOME} export $(pwd)
+/usr/bin ${HOME} ${HOME} printf
+		echo grep && then local -eu --verbose 'quoted text'
+		test -eu echo ${HOME} && "$@" printf export 2>/dev/null 2>/dev/null
+	awk --verbose grep && | readonly grep && test
+printf sed 'quoted text' printf 2>/dev/null test
+		test "$@" test x=1 /usr/bin
+		${HOME} | echo sed $(pwd) awk export x=1 'quoted text' done 2>/dev/null
+'quoted text' echo echo --verbose && 'quoted text'
+export -eu test $(pwd) printf "$1" $(pwd)
+x=1 local printf | test $(pwd) x=1 2>/dev/null -eu cd | local | ${HOME} "$1"
+	$(pwd) export && | awk echo test test sed && test "$1" test -eu
+		awk "$@" test --verbose "$1" ${HOME} $(pwd)
+$(pwd) -eu echo && "$1" cd readonly x=1 test sed export $(pwd)
+		| 2>/dev/null ${HOME} && printf cd | readonly then
+printf awk cd x=1 && awk && cd ${HOME} 'quoted text' "$@"
+export x=1 then "$@" /usr/bin then done
+test export done "$@" $(pwd) readonly ${HOME}
+	echo grep local local export $(pwd) /usr/bin awk cd --verbose done | awk --verbose
+/usr/bin --verbose cd "$@" grep $(pwd)
+	test --verbose readonly 2>/dev/null -eu then then awk /usr/bin x=1 ${HOME}
+	$(pwd) "$@" "$1" printf grep test "$@" echo --verbose x=1 readonly
+	x=1 printf -eu -eu /usr/bin sed cd ${HOME} test 2>/dev/null "$1" /usr/bin 2>/dev/null
+	2>/dev/null printf 2>/dev/null
+then local sed && | && echo export echo awk 2>/dev/null
+	${HOME} $(pwd) grep sed | ${HOME} "$@" $(pwd) 2>/dev/null /usr/bin && then
+| ${HOME} -eu local "$@" printf sed grep /usr/bin -eu
+--verbose test grep done "$1" "$1" 'quoted text'
+echo done 'quoted text' $(pwd) --verbose /usr/bin
+		cd $(pwd) export /usr/bin local cd grep done readonly local printf awk cd 'quoted text'
+	"$1" 2>/dev/null sed ${HOME} local -eu
+/usr/bin grep -eu 2>/dev/null
+-eu x=1 awk sed -eu "$1" readonly test test --verbose
+		--verbose printf /usr/bin then | ${HOME} --verbose sed sed x=1 export
+		cd && cd awk grep 'quoted text'
+	'quoted text' grep readonly | x=1 "$1" x=1 readonly local echo awk 2>/dev/null
+		done "$1" "$@" $(pwd) | x=1 $(pwd) local cd /usr/bin
+	printf ${HOME} sed ${HOME} echo local 'quoted text' 'quoted text' $(pwd)
+		then /usr/bin x=1 printf "$1" awk awk
+	"$@" $(pwd) export sed awk cd x=1 $(pwd) "$@" export local grep /usr/bin "$@"
+	awk /usr/bin /usr/bin "$@" ${HOME} awk 'quoted text' -eu
+		"$1" local printf sed done "$@" done 2>/dev/null sed x=1 sed
+		"$@" && grep then | readonly local
+		2>/dev/null "$1" --verbose -eu awk ${HOME} -eu grep | echo sed grep echo x=1 | grep
+		${HOME} 'quoted text' grep sed sed "$@" ${HOME} cd | 2>/dev/null
+"$@" readonly local sed "$1" | x=1 2>/dev/null
+		echo local readonly 2>/dev/null "$@" 2>/dev/null echo awk $(pwd) local
+		'quoted text' x=1 then --verbose
+	| ${HOME} done export local --verbose printf
+cd export sed ${HOME} awk "$1" done cd export awk /usr/bin echo
+		-eu then readonly local readonly -eu --verbose
+	sed printf readonly 2>/dev/null $(pwd) ${HOME}
+2>/dev/null "$1" done $(pwd)
+	export grep 2>/dev/null "$1" x=1 echo then
+		done test && "$@" test x=1 2>/dev/null export sed
+	printf awk then --verbose
+export readonly printf ${HOME} /usr/bin
+		'quoted text' && | --verbose --verbose readonly awk cd -eu local -eu
+		then readonly --verbose 'quoted text' --verbose sed "$1"
+export /usr/bin cd $(pwd) echo "$1" /usr/bin
+$(pwd) 2>/dev/null "$1" awk grep readonly $(pwd) --verbose 2>/dev/null
+	/usr/bin "$1" "$1" sed local
+	$(pwd) then printf export then cd && grep readonly readonly printf cd test "$@"
+		cd && 'quoted text' x=1 | test "$1" local
+	local /usr/bin /usr/bin && sed sed 2>/dev/null printf printf
+	&& $(pwd) | ${HOME} done 2>/dev/null $(pwd) readonly
+		sed $(pwd) ${HOME} 2>/dev/null /usr/bin cd awk ${HOME} test awk -eu
+	then readonly 'quoted text' local awk --verbose "$1" | export /usr/bin ${HOME}
+		cd "$@" grep then export x=1 -eu /usr/bin awk x=1 $(pwd) local printf sed grep
+		grep test awk grep 'quoted text' && "$@" cd
+	export export x=1 readonly "$1" done readonly
+then | && export done awk 'quoted text' cd ${HOME} printf -eu && "$1" -eu
+		awk then sed && ${HOME} "$@" | done awk "$1" && cd $(pwd)
+'quoted text' --verbose echo x=1 $(pwd) local ${HOME}
+	"$1" done x=1 | $(pwd) printf printf printf "$1" echo /usr/bin
+	'quoted text' --verbose grep echo
+2>/dev/null cd | x=1 grep ${HOME} | -eu printf local printf "$@" done --verbose
+	local 'quoted text' -eu /usr/bin local readonly
+	local 'quoted text' -eu
+	readonly local /usr/bin "$1" /usr/bin
+		cd readonly "$@" grep && test printf readonly cd done $(pwd)
+readonly | $(pwd) | "$@" &&
+$(pwd) x=1 --verbose printf
+		$(pwd) cd ${HOME} sed && test "$1" sed /usr/bin "$@"
+	printf awk -eu local --verbose $(pwd)
+${HOME} echo /usr/bin echo
+	done ${HOME} 'quoted text' done awk && x=1 | ${HOME} awk readonly echo
+	x=1 | "$@" "$1" 'quoted text' done printf awk printf grep ${HOME} cd
+		$(pwd) cd then 'quoted text' --verbose awk && printf
+		$(pwd) x=1 "$1" export done done $(pwd) x=1 'quoted text' ${HOME} "$1"
+then && done /usr/bin test ${HOME} then local x=1 awk test export -eu --verbose
+		--verbose ${HOME} "$@" cd /usr/bin readonly x=1
+		'quoted text' cd then echo then | && 2>/dev/null awk $(pwd) /usr/bin
+		then | $(pwd) 'quoted text' printf "$@" readonly ${HOME}
+	"$1" -eu ${HOME} awk cd printf 'quoted text' && test 2>/dev/null
+$(pwd) ${HOME} grep -eu 2>/dev/null && test echo 'quoted text' "$@" --verbose
+	printf && sed "$@" awk test "$1" /usr/bin | local | printf test local sed "$@"
+then local export $(pwd) local done $(pwd) 2>/dev/null export -eu ${HOME}
+		"$1" local test grep -eu
+cd -eu 'quoted text' sed "$1"
+		2>/dev/null echo grep /usr/bin done
+	sed grep $(pwd) then done sed --verbose -eu printf export
+local 'quoted text' | --verbose /usr/bin export -eu -eu && then $(pwd) ${HOME}
+		&& then awk sed local 2>/dev/null cd ${HOME} grep sed 'quoted text'
+"$1" local cd "$1" -eu test then x=1 done "$@"
+'quoted text' grep ${HOME} printf echo | /usr/bin
+	test local /usr/bin && -eu readonly grep | ${HOME} --verbose $(pwd)
+	sed 2>/dev/null ${HOME} | -eu /usr/bin awk readonly 2>/dev/null
+	2>/dev/null echo cd printf cd && x=1 | -eu &&
+then cd "$@" sed printf 'quoted text' 2>/dev/null 'quoted text'
+export then 2>/dev/null test echo then | done echo grep x=1 export cd "$@" $(pwd)
+--verbose x=1 && readonly x=1 --verbose export /usr/bin
+-eu | 2>/dev/null x=1 test then /usr/bin $(pwd) awk 2>/dev/null awk | printf
+		export /usr/bin $(pwd) ${HOME} local 2>/dev/null
+		cd ${HOME} readonly printf done 2>/dev/null 'quoted text'
+	local && "$1" then ${HOME} readonly local | && --verbose
+| /usr/bin awk "$@" /usr/bin printf -eu && test x=1 local
+		printf readonly sed ${HOME} printf done --verbose sed && grep grep then "$1"
+		test ${HOME} sed --verbose done echo export then awk
+	/usr/bin sed /usr/bin then /usr/bin x=1 printf done --verbose sed --verbose
+		sed $(pwd) sed 2>/dev/null 'quoted text' /usr/bin "$@"
+export ${HOME} test sed && test 'quoted text' sed grep | echo printf echo /usr/bin
+export cd "$@" test grep then 'quoted text' 2>/dev/null readonly local $(pwd)
+		| grep printf then sed 'quoted text' $(pwd) echo $(pwd) awk readonly echo
+		awk done ${HOME} test done -eu && done /usr/bin -eu /usr/bin && local $(pwd)
+		"$@" "$@" 2>/dev/null sed echo $(pwd)
+'quoted text' test 2>/dev/null 'quoted text'
+"$1" "$1" then local awk export 'quoted text' readonly && $(pwd)
+sed 'quoted text' then sed 2>/dev/null $(pwd) x=1 --verbose test printf test cd
+	then test local -eu grep done sed readonly
+		echo local --verbose local $(pwd) ${HOME} ${HOME} local test
+	echo sed then | sed "$@" printf printf
+	grep test sed then ${HOME} -eu readonly
+		readonly sed && $(pwd) "$1" sed && echo readonly
+local x=1 | -eu --verbose && then -eu local done sed grep "$1" echo printf awk
+	/usr/bin 2>/dev/null | test x=1 ${HOME} export "$1" | 'quoted text'
+		echo then && --verbose "$@" ${HOME} then
+	test grep | awk sed x=1 ${HOME}
+readonly --verbose printf printf |
+	export local then cd printf done printf
+	then printf cd "$1" grep "$1" done test
+	local "$@" sed readonly then | test test -eu echo
+	done then | grep -eu export /usr/bin grep
+2>/dev/null /usr/bin --verbose "$@" sed | ${HOME} --verbose sed | sed --verbose
+		${HOME} x=1 then "$@" ${HOME} grep sed awk x=1 "$@" awk "$1" /usr/bin -eu && --verbose
+local grep --verbose && printf -eu
+		$(pwd) grep -eu "$@" -eu cd grep 2>/dev/null
+	done done awk done | cd "$1" sed test printf -eu ${HOME} ${HOME} 2>/dev/null 'quoted text'
+		local $(pwd) x=1 awk --verbose export 2>/dev/null sed -eu
+done | $(pwd) --verbose
+2>/dev/null 'quoted text' "$1"
+		echo done 2>/dev/null
+export sed readonly done test /usr/bin "$@" 2>/dev/null echo done ${HOME}
+		| 'quoted text' awk 2>/dev/null
+	export $(pwd) local cd | $(pwd)
+		--verbose /usr/bin awk awk cd -eu $(pwd) echo done local echo then grep "$1"
+	${HOME} /usr/bin ${HOME} $(pwd) then
+		/usr/bin /usr/bin "$@" ${HOME} done cd sed done "$@" -eu 'quoted text'
+		printf done then echo ${HOME} sed "$@" sed export /usr/bin
+		cd echo echo export test -eu local test sed sed awk then --verbose cd ${HOME}
+	test 2>/dev/null done echo export readonly
+	'quoted text' $(pwd) test grep then | --verbose awk
+	2>/dev/null printf "$@"
+		local done export x=1 sed "$@" $(pwd) test printf grep -eu -eu --verbose
+	grep done done 2>/dev/null test 'quoted text' local
+printf /usr/bin /usr/bin cd ${HOME} cd
+		"$1" grep readonly ${HOME} export | readonly
+"$@" then readonly /usr/bin /usr/bin echo readonly -eu test
+export --verbose printf | readonly local "$1" local
+	x=1 "$1" $(pwd) cd echo done ${HOME}
+		readonly then sed cd 2>/dev/null
+	test done && grep local done ${HOME} /usr/bin sed | echo local then
+	/usr/bin 2>/dev/null $(pwd) printf then x=1 | $(pwd) ${HOME} -eu
+${HOME} local readonly 'quoted text' $(pwd) export --verbose grep | done &&
+grep export readonly ${HOME} x=1 /usr/bin ${HOME} cd readonly
+	x=1 test && export -eu printf
+		/usr/bin grep -eu cd ${HOME}
+		done done $(pwd) grep local | 'quoted text' $(pwd) "$@" $(pwd) --verbose grep
+		test "$1" local cd awk 'quoted text' grep then
+test printf cd export 'quoted text' sed sed x=1 && "$@"
+		readonly -eu /usr/bin
+		2>/dev/null awk printf 2>/dev/null awk /usr/bin printf grep "$1" -eu awk
+	readonly awk --verbose "$1" 2>/dev/null |
+sed "$1" "$@" /usr/bin "$@" x=1 "$@" echo export test $(pwd) $(pwd)
+/usr/bin done $(pwd) x=1 then && /usr/bin x=1 grep
+/usr/bin then 'quoted text' done 'quoted text' echo grep done
+		--verbose | -eu | cd local grep
+		${HOME} 2>/dev/null readonly export
+		'quoted text' echo export /usr/bin "$1" "$1" printf x=1
+"$@" grep ${HOME} x=1 | grep "$@" 'quoted text' done "$@"
+		-eu echo 2>/dev/null export printf 'quoted text' "$1" x=1 grep "$@" /usr/bin
+		readonly 2>/dev/null local | 2>/dev/null sed --verbose ${HOME} -eu &&
+	-eu && done then "$1" readonly
+cd | export "$@" local export cd grep done "$@" awk then grep "$1" ${HOME} export
+test readonly $(pwd) /usr/bin -eu local | $(pwd) echo
+"$1" printf && export cd readonly --verbose "$1"
+		awk export grep --verbose
+	sed awk cd local sed test
+		${HOME} -eu then cd local ${HOME} readonly echo awk readonly -eu echo export
+		| $(pwd) x=1 printf ${HOME} cd cd printf 'quoted text' && && awk
+		sed 'quoted text' printf cd echo
+grep done ${HOME} test "$@" "$@" test | grep /usr/bin awk done 'quoted text'
+	2>/dev/null echo then ${HOME} sed -eu
+		printf --verbose x=1 done export 2>/dev/null
+		${HOME} /usr/bin local --verbose done then
+	| awk cd done awk grep 2>/dev/null "$1" printf export /usr/bin
+	x=1 test && done local --verbose -eu 'quoted text'
+test x=1 grep x=1 /usr/bin | local | "$@" export "$1" grep
+		| && local sed x=1 cd done test sed awk test
+	-eu test x=1 ${HOME} -eu
+	echo "$@" grep $(pwd) printf test export
+readonly readonly awk awk cd then && 'quoted text' && export "$1" "$1" export
+	-eu 'quoted text' 'quoted text'
+x=1 2>/dev/null /usr/bin local done "$1" $(pwd) awk awk "$1" grep && x=1 awk &&
+		${HOME} grep awk $(pwd) printf "$1" readonly "$@" ${HOME} local $(pwd)
+readonly --verbose printf cd "$1" /usr/bin 'quoted text' x=1 --verbose
+x=1 grep done then done "$1" test then 2>/dev/null test "$1" local "$1" && cd |
+then $(pwd) grep && test ${HOME} --verbose awk local | "$1"
+		"$1" "$1" "$1" && && grep $(pwd)
+	"$@" readonly awk 2>/dev/null local sed "$1" then 2>/dev/null
+awk test then test test test sed grep printf
+		${HOME} | local grep x=1 $(pwd) --verbose export ${HOME} $(pwd)
+	x=1 /usr/bin 'quoted text'
+done | && grep echo x=1 local done
+	grep done --verbose /usr/bin
+	echo "$@" then -eu awk cd
+	&& 'quoted text' printf awk test then $(pwd) x=1 && ${HOME} --verbose
+		sed local awk "$1" done 2>/dev/null 2>/dev/null ${HOME}
+	sed then $(pwd) $(pwd) 'quoted text' grep --verbose
+'quoted text' 'quoted text' awk printf && readonly
+		-eu 'quoted text' printf "$@" "$1" "$@" | "$1" ${HOME}
+	cd --verbose | test "$@" awk done && export $(pwd) "$1" echo
+		"$@" --verbose /usr/bin grep $(pwd) test then done
+	local awk awk test ${HOME} x=1 done export awk "$@" --verbose
+	test "$1" --verbose x=1
+		| 'quoted text' printf local done 2>/dev/null done && /usr/bin echo
+'quoted text' x=1 grep readonly x=1 /usr/bin printf |
+		readonly && "$1" then x=1 then readonly "$@" -eu readonly
+then | done ${HOME} done x=1 --verbose cd
+sed awk cd x=1 | "$@" awk done $(pwd) test && 'quoted text' 'quoted text' $(pwd)
+	&& "$@" 'quoted text' then --verbose local grep 2>/dev/null
+	"$@" | done printf export
+	sed grep local done printf
+	readonly printf /usr/bin "$@" awk echo sed ${HOME} grep --verbose x=1 done
+		local /usr/bin done printf printf export sed awk test $(pwd)
+	-eu echo test printf --verbose 2>/dev/null
+	--verbose "$1" ${HOME} && && "$@" 'quoted text' "$@" cd sed ${HOME}
+		then ${HOME} grep "$1" grep
+		--verbose && readonly $(pwd) "$@"
+local cd done /usr/bin cd 'quoted text' "$1" /usr/bin export
+${HOME} 2>/dev/null $(pwd) x=1 | 'quoted text' "$@"
+	| awk 2>/dev/null && export
+printf local done export -eu $(pwd) then /usr/bin
+		printf local /usr/bin grep | grep export
+export x=1 $(pwd) printf "$@" grep "$1" 'quoted text' sed "$1" ${HOME} done
+	"$1" readonly done && test 2>/dev/null echo grep
+	then -eu cd grep readonly /usr/bin done awk --verbose
+		x=1 'quoted text' && printf cd 2>/dev/null
+x=1 test --verbose done sed | done | ${HOME} $(pwd) local && grep cd awk
+		sed /usr/bin $(pwd) $(pwd) cd /usr/bin -eu done awk x=1 printf
+		export 'quoted text' | -eu then $(pwd) awk -eu done echo --verbose grep $(pwd)
+--verbose export x=1 grep /usr/bin sed "$@" x=1 readonly && $(pwd)
+"$1" echo printf grep -eu printf printf
+	/usr/bin | "$@" echo 2>/dev/null test x=1 cd
+	grep x=1 ${HOME} /usr/bin echo -eu cd local ${HOME}
+	cd awk && && "$1" echo awk $(pwd) export && 'quoted text' grep
+	2>/dev/null "$@" cd then -eu -eu -eu readonly $(pwd) x=1 then /usr/bin -eu
+'quoted text' 'quoted text' -eu --verbose readonly cd | cd $(pwd) -eu x=1
+sed 2>/dev/null x=1 sed /usr/bin
+	| /usr/bin export /usr/bin then
+		'quoted text' /usr/bin awk readonly | grep x=1 ${HOME} printf && /usr/bin test
+	-eu then test && 2>/dev/null cd 'quoted text'
+	then ${HOME} "$@" "$1" 'quoted text' cd printf | done | printf &&
+readonly $(pwd) ${HOME} x=1 /usr/bin | printf
+	&& "$@" awk then 'quoted text' then printf "$1" echo then --verbose
+		"$1" printf -eu $(pwd) /usr/bin -eu readonly ${HOME} cd | -eu $(pwd)
+export 2>/dev/null "$@" && then test 2>/dev/null
+"$1" echo && sed readonly awk
+	| -eu sed local sed |
+&& test local /usr/bin x=1 $(pwd) grep grep | test awk
+x=1 x=1 ${HOME} cd 2>/dev/null x=1 readonly -eu $(pwd)
+	2>/dev/null sed awk cd /usr/bin "$1" /usr/bin --verbose grep "$1"
+echo && "$@" export then printf | cd ${HOME}
+	done 2>/dev/null local /usr/bin 2>/dev/null /usr/bin -eu | then grep export
+x=1 sed ${HOME} printf echo
+${HOME} readonly "$@" --verbose | readonly
+		/usr/bin grep --verbose export && x=1 export done local local 2>/dev/null
+		export local done x=1 export | ${HOME} test awk && printf readonly 'quoted text'
+${HOME} /usr/bin echo ${HOME} local $(pwd) --verbose sed 2>/dev/null | | "$1"
+	--verbose printf x=1 "$1" test echo "$1" /usr/bin $(pwd)
+	local echo cd | 'quoted text' export then then x=1 then 'quoted text'
+"$1" "$1" test ${HOME} readonly done 2>/dev/null
+export cd && $(pwd) ${HOME} printf --verbose cd then done ${HOME} export
+local echo echo -eu && awk ${HOME} x=1 cd sed export export "$1" ${HOME}
+	done done cd -eu --verbose 'quoted text'
+	&& test "$@" cd awk 'quoted text' export
+		-eu /usr/bin export printf "$1" export
+	"$1" sed ${HOME} | local $(pwd) $(pwd) --verbose x=1 cd test
+		/usr/bin "$@" --verbose sed ${HOME} "$@"
+	done awk /usr/bin -eu done awk -eu test "$@" printf -eu then 2>/dev/null cd local
+"$1" "$@" x=1 ${HOME} && "$1" && cd done readonly ${HOME} grep
+	grep "$1" "$1" ${HOME} $(pwd)
+	printf ${HOME} $(pwd) 2>/dev/null "$@" cd --verbose sed local printf "$@"
+		local x=1 test echo /usr/bin cd cd && local grep
+		sed export ${HOME} printf -eu test export --verbose
+		'quoted text' "$1" done /usr/bin
+		$(pwd) 2>/dev/null -eu /usr/bin $(pwd) done test awk done
+	${HOME} echo printf printf grep
+"$@" awk grep local --verbose
+	| "$1" $(pwd) awk done /usr/bin
+	${HOME} test | test export sed /usr/bin export --verbose echo test test then
+then 'quoted text' && -eu $(pwd) local | awk 2>/dev/null
+	awk awk 2>/dev/null printf readonly sed grep done
+readonly /usr/bin test ${HOME} 'quoted text' then export && $(pwd) then
+	x=1 | grep 2>/dev/null -eu $(pwd) readonly
+		-eu local echo test --verbose
+local && echo --verbose cd local awk 2>/dev/null
+done sed "$1" printf $(pwd) -eu
+/usr/bin 'quoted text' -eu 'quoted text' && readonly
+test "$@" done export test x=1 export printf | grep
+	printf --verbose "$1" ${HOME}
+		done awk -eu 'quoted text' ${HOME} x=1 grep echo 'quoted text' echo done 2>/dev/null
+	&& --verbose "$1" /usr/bin cd -eu && echo /usr/bin 'quoted text' test
+		sed done cd sed grep ${HOME} $(pwd) export export && test export --verbose $(pwd)
+		--verbose ${HOME} local
+		cd -eu echo | then --verbose /usr/bin then "$@" -eu --verbose grep awk readonly
+		'quoted text' export echo done export printf && 'quoted text' printf -eu echo
+&& then local 'quoted text' cd awk local /usr/bin x=1 cd
+test test sed printf cd local
+sed export --verbose --verbose $(pwd) /usr/bin 2>/dev/null 'quoted text'
+"$1" echo 2>/dev/null sed "$1" 'quoted text'
+		cd local export | && printf | then 2>/dev/null | then
+		printf $(pwd) done readonly echo local && echo
+/usr/bin local cd grep awk done awk
+		${HOME} && test then sed done x=1
+		"$1" test x=1 /usr/bin readonly sed --verbose then -eu
+	echo done x=1 test | then "$@" "$1" 'quoted text' -eu 'quoted text'
+		done echo sed --verbose cd done cd ${HOME} 2>/dev/null ${HOME} $(pwd) /usr/bin
+	test | "$1" then done grep x=1 "$1" echo
+		sed $(pwd) && cd export "$1" && export -eu ${HOME} test
+${HOME} grep done cd ${HOME} /usr/bin "$@" export
+$(pwd) grep "$1" done awk 2>/dev/null
+	| readonly readonly grep then done 2>/dev/null | -eu -eu
+awk $(pwd) "$@" 2>/dev/null printf
+2>/dev/null -eu | readonly | 2>/dev/null "$1" /usr/bin grep
+		printf awk ${HOME} "$@" && x=1 $(pwd) then && -eu /usr/bin readonly |
+		"$@" "$@" && printf /usr/bin echo 'quoted text' ${HOME} printf awk done cd printf
+	then | grep export echo then done grep && local cd /usr/bin "$1"
+		&& echo sed export sed "$@" /usr/bin
+		export cd $(pwd) readonly done --verbose 2>/dev/null 'quoted text'
+	export "$1" cd ${HOME} test awk $(pwd) x=1 /usr/bin
+		"$@" done cd -eu test echo cd export local "$1"
+		awk 2>/dev/null | awk
+	then done cd grep /usr/bin | readonly export then "$1" ${HOME} ${HOME} 2>/dev/null
+	printf | readonly /usr/bin 'quoted text' echo /usr/bin sed
+	grep readonly printf awk
+awk cd echo | readonly printf 'quoted text' grep
+&& "$@" && readonly | echo x=1 export
+		done then done --verbose cd && $(pwd) 'quoted text' cd cd cd readonly 'quoted text'
+	$(pwd) export | 2>/dev/null local test -eu readonly 2>/dev/null
+		cd "$@" cd 'quoted text'
+	awk then echo "$@" "$1" x=1 && printf
+		"$@" then /usr/bin readonly readonly x=1 "$1" local
+		local awk sed cd -eu then awk 2>/dev/null echo cd 'quoted text'
+local printf done local sed printf
+		done && 2>/dev/null "$1" && x=1 cd $(pwd) 2>/dev/null ${HOME} ${HOME} test
+	echo 2>/dev/null /usr/bin "$@" printf -eu then ${HOME} done -eu | sed readonly
+	'quoted text' 2>/dev/null done "$1" test
+	sed sed /usr/bin | sed printf
+awk && /usr/bin awk printf awk cd &&
+local echo awk "$@" test | "$@" local -eu && export 'quoted text' "$1" awk
+		test awk 2>/dev/null grep | x=1 x=1 2>/dev/null
+&& && 'quoted text' 'quoted text' 2>/dev/null local --verbose && "$@" 'quoted text'
+		"$@" export done 2>/dev/null sed printf done | printf cd -eu export && 2>/dev/null
+	x=1 grep grep ${HOME} awk local --verbose
+	&& test /usr/bin /usr/bin local echo sed printf local
+-eu export 'quoted text'
+	readonly grep -eu 'quoted text'
+		printf "$1" $(pwd) readonly "$1" -eu -eu grep 'quoted text' 2>/dev/null
+	echo test then "$@" ${HOME}
+	awk $(pwd) awk -eu /usr/bin ${HOME} sed then --verbose $(pwd) local
+	2>/dev/null "$@" x=1 | "$@" local $(pwd)
+done echo readonly "$@" sed cd awk --verbose then /usr/bin
+$(pwd) 2>/dev/null printf grep sed printf readonly |
+	export echo readonly printf $(pwd) 'quoted text' 2>/dev/null
+		--verbose "$@" then test
+	then done ${HOME} -eu
+-eu "$@" export readonly && "$@" done sed | | /usr/bin export /usr/bin test
+		echo echo echo grep grep cd x=1 readonly x=1 --verbose awk readonly
+/usr/bin && x=1 "$@" x=1
+		"$@" local "$@" x=1 x=1 -eu printf 2>/dev/null | printf "$@" printf awk /usr/bin
+	awk x=1 awk && awk ${HOME} done /usr/bin
+	readonly "$@" done cd export local awk | --verbose
+x=1 test awk x=1 done -eu test echo echo "$@" cd local 'quoted text' cd -eu
+	echo x=1 $(pwd) sed "$1" readonly 'quoted text' 'quoted text' export grep export
+		printf echo 'quoted text' "$@" readonly export 'quoted text' | sed
+	done echo printf 2>/dev/null readonly grep awk ${HOME} awk readonly test /usr/bin
+2>/dev/null local /usr/bin
+	"$1" | 2>/dev/null 'quoted text' ${HOME}
+	cd then export test -eu grep x=1 grep readonly done
+	| sed sed echo && --verbose 2>/dev/null local echo $(pwd)
+	&& sed "$1" 'quoted text' test local printf
+2>/dev/null sed printf printf then then awk sed then "$@" then done
+	echo test --verbose /usr/bin | echo -eu
+		x=1 printf export cd && | --verbose then && echo sed /usr/bin echo
+printf ${HOME} printf grep ${HOME} local /usr/bin
+		&& printf printf 2>/dev/null test /usr/bin --verbose local ${HOME} grep echo echo
+	$(pwd) done cd printf grep ${HOME} 'quoted text' cd readonly
+	x=1 --verbose "$1" local echo
+&& 2>/dev/null then 'quoted text'
+cd x=1 sed x=1 --verbose
+	cd grep cd sed -eu 2>/dev/null ${HOME} -eu local then "$@" readonly
+--verbose awk "$@" sed 2>/dev/null local
+		&& ${HOME} cd awk printf 'quoted text' /usr/bin export local cd $(pwd)
+	x=1 grep --verbose echo 'quoted text' printf 'quoted text'
+/usr/bin printf grep awk awk
+		${HOME} test "$@" then awk
+	2>/dev/null echo $(pwd) test 'quoted text'
+		cd -eu export test | test 2>/dev/null $(pwd) readonly "$@"
+		--verbose 'quoted text' local
+"$@" awk x=1 $(pwd) export
+		cd "$1" then then done 'quoted text' 2>/dev/null then awk -eu echo test
+		sed -eu | x=1 export 'quoted text' && "$@" export
@@ -0,0 +1,2001 @@
+		test grep x=1 -eu "$@" ${HOME} -eu x=1 done test sed then $(pwd) -eu
+		'quoted text' export -eu x=1 grep sed 2>/dev/null readonly
+		local echo x=1 'quoted text'
+then printf cd printf grep printf
+		grep && x=1 then | printf cd /usr/bin "$@"
+awk -eu && --verbose -eu 'quoted text' cd echo awk 'quoted text' -eu export
+${HOME} x=1 ${HOME} awk printf /usr/bin 2>/dev/null local
+		export grep done echo readonly
+	"$@" echo cd $(pwd) cd sed then --verbose sed "$1" "$1" $(pwd) export readonly
+		$(pwd) /usr/bin | readonly 'quoted text'
+	$(pwd) export --verbose test then && export sed test $(pwd) awk sed
+	2>/dev/null "$1" done export test "$1" local grep | grep &&
+export x=1 'quoted text' test done awk $(pwd) export sed "$@" "$1" local sed
+'quoted text' | local -eu /usr/bin --verbose then test local
+	echo echo /usr/bin printf grep local -eu sed sed sed $(pwd) x=1
+${HOME} x=1 'quoted text' ${HOME} local "$@" readonly 'quoted text' 'quoted text'
+	2>/dev/null x=1 -eu --verbose
+	then sed --verbose ${HOME} test awk |
+	readonly 'quoted text' x=1 $(pwd) 'quoted text'
+	| printf sed $(pwd) done --verbose echo echo | 'quoted text'
+	then echo $(pwd) done grep readonly export "$@" local "$1" "$1" test --verbose
+	cd then x=1 export -eu awk 'quoted text'
+	sed "$@" export && grep -eu
+		echo $(pwd) 'quoted text' ${HOME}
+cd -eu grep then x=1 echo then grep local echo cd export local then "$@" then
+		2>/dev/null readonly then printf sed readonly echo $(pwd) sed awk ${HOME} readonly
+	--verbose "$1" "$1" "$1"
+cd && x=1 printf awk --verbose --verbose | local /usr/bin ${HOME}
+sed -eu readonly echo -eu local grep
+	test $(pwd) then $(pwd) export $(pwd) --verbose sed readonly $(pwd)
+		'quoted text' grep | -eu printf $(pwd)
+	test && ${HOME} 2>/dev/null local | --verbose grep
+		2>/dev/null ${HOME} 'quoted text' | export readonly 'quoted text'
+done echo then x=1 $(pwd) && printf local "$@"
+	echo && "$1" 2>/dev/null printf
+	echo sed sed 2>/dev/null grep 'quoted text' x=1 readonly then /usr/bin awk
+		readonly 2>/dev/null | sed
+		awk $(pwd) | readonly readonly echo "$@" /usr/bin
+		grep test echo export | echo awk x=1 && 2>/dev/null test
+	2>/dev/null --verbose -eu
+	readonly local ${HOME} done $(pwd) 2>/dev/null
+--verbose "$1" /usr/bin readonly
+		${HOME} -eu "$@" test readonly printf "$@" grep 2>/dev/null grep 'quoted text'
+	-eu 2>/dev/null sed --verbose then && local
+		awk ${HOME} printf --verbose echo /usr/bin
+	then export awk "$1" -eu | ${HOME} local local ${HOME} export
+&& 'quoted text' -eu "$1" && | sed test ${HOME} printf then sed ${HOME} readonly
+		-eu | 'quoted text' 2>/dev/null
+	/usr/bin readonly printf readonly local x=1
+| && && export awk printf
+	then && "$@" ${HOME} local /usr/bin --verbose -eu printf 2>/dev/null echo
+	export /usr/bin sed sed sed grep readonly "$@" test awk /usr/bin && "$@" grep
+/usr/bin export "$@" && echo awk local sed "$@" readonly /usr/bin && grep
+	"$@" echo "$@" test 'quoted text' awk echo done
+/usr/bin --verbose ${HOME} echo /usr/bin x=1 /usr/bin printf 2>/dev/null
+awk then then grep cd printf "$@" 'quoted text' cd test grep readonly
+		| x=1 export $(pwd) "$1" --verbose -eu x=1 grep export cd
+		printf local export grep printf /usr/bin readonly
+	readonly "$1" readonly && && /usr/bin
+sed x=1 echo $(pwd) local "$1" local test /usr/bin
+		2>/dev/null $(pwd) sed --verbose
+${HOME} echo --verbose export "$1" printf --verbose && ${HOME} && then done
+	readonly export x=1 readonly done --verbose awk
+	then awk "$1" 'quoted text' readonly done sed
+done 2>/dev/null /usr/bin awk done echo 2>/dev/null
+awk export 'quoted text' printf awk 2>/dev/null
+export printf sed | -eu /usr/bin ${HOME} $(pwd) -eu
+$(pwd) x=1 readonly ${HOME} printf
+${HOME} | cd then cd test --verbose printf readonly "$1" printf
+sed && echo "$@" "$@" 'quoted text' local done done done $(pwd) printf
+--verbose -eu sed x=1 export ${HOME} test printf "$1"
+--verbose awk test && "$@" 'quoted text'
+	done && test x=1 awk cd readonly sed x=1
+sed readonly 2>/dev/null ${HOME} "$@" then --verbose cd $(pwd) $(pwd) cd echo
+	cd --verbose awk -eu grep --verbose
+		awk grep done -eu awk 'quoted text'
+local "$1" "$@" 'quoted text' /usr/bin then 2>/dev/null ${HOME} then
+		export /usr/bin "$@" sed grep readonly
+	export /usr/bin 'quoted text' ${HOME} readonly && 'quoted text'
+--verbose cd ${HOME} 2>/dev/null
+	-eu readonly test && -eu echo "$@" x=1 export
+local ${HOME} done echo grep $(pwd) x=1 sed test ${HOME} "$@" test
+		grep echo echo then -eu echo -eu printf done 2>/dev/null
+cd then 2>/dev/null cd | /usr/bin 2>/dev/null /usr/bin x=1
+/usr/bin printf && local x=1 grep "$1" echo readonly
+	'quoted text' -eu x=1 x=1 local sed grep readonly --verbose sed sed "$@" x=1
+	cd 2>/dev/null printf grep readonly /usr/bin local sed "$1" && export
+		echo readonly test printf | done
+		grep 'quoted text' printf readonly $(pwd) --verbose sed readonly
+	${HOME} 'quoted text'
+		then grep printf && "$@" x=1 awk "$1" ${HOME} "$1" then $(pwd)
+		echo test awk ${HOME} /usr/bin then "$@" export && | then x=1 cd readonly
+&& local then test --verbose readonly export local grep | x=1 x=1 readonly
+		/usr/bin printf 'quoted text'
+	'quoted text' "$1" $(pwd) 2>/dev/null 'quoted text' done sed sed /usr/bin
+	--verbose | sed && $(pwd) x=1 cd &&
+		sed /usr/bin 'quoted text' $(pwd) "$1" | "$@" "$@" 2>/dev/null export
+		export ${HOME} "$1" then "$1" export /usr/bin -eu
+printf readonly $(pwd) "$@" "$1"
+	x=1 && sed /usr/bin sed
+/usr/bin /usr/bin test 2>/dev/null grep "$1" grep export 2>/dev/null &&
+$(pwd) | then 2>/dev/null 2>/dev/null test x=1 cd /usr/bin 2>/dev/null
+grep "$@" then export -eu cd local -eu export 'quoted text'
+		2>/dev/null test printf printf
+sed readonly done test grep ${HOME}
+	"$1" then awk then printf awk export --verbose ${HOME} local test "$1" 'quoted text'
+sed printf -eu echo done ${HOME} --verbose readonly | printf
+	then grep --verbose done "$@" readonly --verbose x=1 printf
+		&& sed then --verbose then ${HOME} "$1" done sed cd sed then && export then printf
+$(pwd) && 2>/dev/null cd export --verbose test -eu
+	awk 2>/dev/null test cd 'quoted text'
+	&& ${HOME} "$1" $(pwd) awk -eu export 2>/dev/null x=1 cd
+"$@" 'quoted text' awk $(pwd)
+	local then sed && awk awk readonly readonly
+	echo awk && "$@" export echo && /usr/bin
+local 'quoted text' local |
+	--verbose --verbose 'quoted text'
+		/usr/bin -eu readonly cd 2>/dev/null
+	"$1" 'quoted text' "$@" "$1" 2>/dev/null && $(pwd) test done
+done 2>/dev/null awk 2>/dev/null sed export then test --verbose echo && x=1
+awk -eu --verbose awk readonly -eu local
+	--verbose grep grep $(pwd) $(pwd) grep then local "$@" grep
+		then readonly printf
+	sed awk && done "$@" sed $(pwd)
+		printf && local then $(pwd)
+	'quoted text' sed "$@" && | "$1" ${HOME} "$@" export &&
+| done cd ${HOME} 2>/dev/null
+| test echo $(pwd) echo /usr/bin grep 'quoted text' sed cd | $(pwd)
+echo x=1 echo export 2>/dev/null && test
+		--verbose /usr/bin awk /usr/bin x=1 /usr/bin echo grep printf then $(pwd)
+		done ${HOME} --verbose && grep -eu export readonly
+printf cd printf ${HOME} local /usr/bin $(pwd) then local --verbose
+	readonly grep done "$1" grep export && test cd cd -eu &&
+cd readonly then grep
+-eu readonly awk && cd && | 2>/dev/null grep --verbose /usr/bin sed done
+'quoted text' ${HOME} | echo 'quoted text' ${HOME} /usr/bin export grep awk local
+	readonly && done cd -eu then "$1" 'quoted text' | -eu done local echo then export
+	cd -eu then --verbose 'quoted text' | --verbose "$1" /usr/bin $(pwd)
+	echo sed 2>/dev/null "$@" ${HOME} test local
+	printf x=1 export 2>/dev/null printf
+readonly printf then echo x=1 then readonly grep $(pwd) "$1"
+		awk 2>/dev/null local 'quoted text' readonly
+	&& readonly cd printf x=1 echo x=1 |
+		'quoted text' cd "$@" x=1 local && -eu export "$@" | 'quoted text'
+	grep 'quoted text' -eu grep $(pwd) sed grep
+		printf && printf sed "$1"
+	--verbose awk export "$1" | grep printf 2>/dev/null ${HOME}
+cd echo test done local $(pwd) 'quoted text'
+		"$@" local local awk sed local test then --verbose test /usr/bin 'quoted text'
+&& /usr/bin ${HOME} cd "$@" "$@"
+		"$1" && test && then export printf printf 'quoted text'
+		export readonly grep $(pwd) 'quoted text' ${HOME}
+	sed 'quoted text' $(pwd) "$1" readonly x=1 "$1" x=1 /usr/bin
+2>/dev/null | done readonly
+cd ${HOME} -eu then && export ${HOME} printf $(pwd) && awk
+		sed local ${HOME} "$1" /usr/bin
+	| && --verbose x=1 2>/dev/null $(pwd) 'quoted text'
+		x=1 2>/dev/null grep test then then echo cd export awk
+		readonly sed --verbose x=1 readonly /usr/bin
+		local 2>/dev/null then x=1 --verbose cd sed /usr/bin && "$1" && &&
+		"$@" --verbose x=1 grep /usr/bin grep /usr/bin
+		done --verbose $(pwd) $(pwd) | ${HOME} --verbose -eu cd 2>/dev/null grep
+grep done $(pwd) awk /usr/bin grep done "$1"
+		'quoted text' readonly && export
+	sed 'quoted text' cd awk "$@" 'quoted text'
+	local && 2>/dev/null x=1 'quoted text'
+	grep local then export /usr/bin
+grep echo done local && --verbose export local -eu grep
+		done readonly /usr/bin x=1 grep then export echo readonly --verbose
+export "$1" | printf cd "$1" ${HOME}
+		awk test | cd -eu printf "$@"
+		sed "$@" -eu "$@" printf | cd 2>/dev/null then
+	local then local grep && printf done echo
+	grep | && --verbose test && "$@" 'quoted text' local export grep done
+'quoted text' cd export 'quoted text'
+	${HOME} 2>/dev/null readonly then echo x=1 'quoted text' sed sed done grep
+	grep $(pwd) export && -eu $(pwd) readonly grep
+		--verbose test then done x=1 sed /usr/bin
+	printf readonly test echo printf $(pwd) && && echo ${HOME}
+		test 'quoted text' /usr/bin awk | 2>/dev/null -eu test done && grep local 2>/dev/null
+		&& echo test --verbose grep cd && /usr/bin readonly ${HOME} cd &&
+		"$@" awk "$1" ${HOME} cd sed cd /usr/bin
+	| --verbose readonly awk -eu done /usr/bin cd readonly grep -eu ${HOME}
+		'quoted text' /usr/bin
+		awk | cd grep "$1" "$1" test test sed
+	awk then ${HOME} local export "$@" printf $(pwd)
+		test echo 'quoted text' --verbose "$@"
+local -eu then 2>/dev/null
+		"$1" export readonly then done printf && "$@" | sed awk printf x=1 --verbose echo
+	cd grep grep done awk cd test done /usr/bin
+	"$@" sed readonly local | done test /usr/bin
+	-eu --verbose done test cd printf readonly
+| "$1" local done 2>/dev/null ${HOME} export x=1 local 'quoted text'
+		export 'quoted text' --verbose then grep /usr/bin then awk "$1" then && /usr/bin
+	'quoted text' then local -eu | "$1" export local
+		"$1" cd local readonly /usr/bin 2>/dev/null sed 'quoted text' "$1" ${HOME}
+		cd export cd then printf --verbose 'quoted text' x=1
+	--verbose awk "$1" cd cd $(pwd) export ${HOME} --verbose
+		printf echo /usr/bin $(pwd) sed
+		2>/dev/null sed "$1" 'quoted text' readonly cd /usr/bin
+	then test -eu $(pwd) sed readonly ${HOME}
+cd cd grep printf sed test "$@" 'quoted text' /usr/bin && readonly then test 'quoted text'
+	then export awk "$1" --verbose
+	-eu readonly $(pwd) x=1 export | 2>/dev/null printf "$@" export -eu done then
+		-eu printf --verbose sed -eu | readonly --verbose
+"$1" -eu sed && "$@" ${HOME} | "$1" "$@" done awk "$@" printf then
+		local ${HOME} 2>/dev/null grep cd /usr/bin "$1"
+	echo grep printf $(pwd) local done
+local sed grep echo awk /usr/bin cd --verbose x=1
+	cd done done | 2>/dev/null then "$1" sed -eu echo $(pwd) cd echo test awk
+	local done ${HOME} cd awk ${HOME} awk -eu 2>/dev/null && done "$1" done
+2>/dev/null "$1" /usr/bin test --verbose
+	printf awk test test x=1 awk cd
+--verbose /usr/bin done printf readonly x=1 then local
+	then then awk -eu readonly
+echo "$@" then echo test ${HOME} /usr/bin
+		"$@" "$@" printf cd && | x=1 "$@" done "$1" then printf
+	x=1 done /usr/bin export then local printf $(pwd) done
+	--verbose 2>/dev/null 2>/dev/null
+		-eu printf readonly /usr/bin $(pwd) --verbose -eu
+		"$@" 'quoted text' "$@" | local
+sed export /usr/bin /usr/bin readonly "$@" awk "$@" awk sed && "$@" cd done
+		&& printf ${HOME} "$1" printf "$1" readonly echo cd x=1 local
+	2>/dev/null /usr/bin "$@" then done /usr/bin local && echo grep
+		sed -eu 'quoted text' readonly
+		export ${HOME} -eu printf local done export local
+	--verbose sed done export printf then then sed && | x=1 --verbose
+done local printf ${HOME} ${HOME} ${HOME} awk then cd
+x=1 "$1" | /usr/bin &&
+2>/dev/null then x=1 && x=1 $(pwd) 2>/dev/null --verbose readonly echo test grep
+		readonly awk && -eu echo 2>/dev/null cd awk "$1" --verbose done -eu export && readonly
+done 'quoted text' ${HOME} ${HOME} /usr/bin -eu -eu && readonly 'quoted text'
+readonly echo test -eu --verbose | printf | sed --verbose local
+		'quoted text' 'quoted text' && $(pwd) echo 2>/dev/null 2>/dev/null cd
+&& | && cd "$1" test ${HOME} x=1 $(pwd)
+sed --verbose grep local awk local | sed then grep --verbose | grep
+	&& $(pwd) /usr/bin /usr/bin
+	'quoted text' readonly ${HOME} -eu local sed printf ${HOME} done ${HOME} -eu readonly
+		| awk /usr/bin -eu then -eu echo local
+		${HOME} 2>/dev/null "$1" export "$@"
+	awk local sed test "$@" awk export
+x=1 awk printf done printf "$1" echo $(pwd) echo done 'quoted text'
+done test $(pwd) grep cd $(pwd) done sed 2>/dev/null echo "$1" grep --verbose local
+		'quoted text' 2>/dev/null cd awk 'quoted text'
+	"$1" -eu "$@" 'quoted text' grep
+2>/dev/null then -eu ${HOME}
+	-eu sed grep then /usr/bin cd 2>/dev/null done awk done x=1 2>/dev/null
+		"$@" echo test printf 'quoted text' x=1 ${HOME} | /usr/bin
+		sed readonly test 'quoted text' x=1 | grep readonly 'quoted text'
+${HOME} local export ${HOME} sed x=1 x=1 && readonly ${HOME}
+		| 2>/dev/null $(pwd) echo 2>/dev/null $(pwd) -eu ${HOME} awk done printf 'quoted text'
+	grep readonly awk $(pwd) "$1" awk "$1" awk && done sed readonly --verbose
+awk done | -eu x=1 done test | -eu readonly
+	/usr/bin export awk export x=1 done awk echo -eu export "$1"
+'quoted text' readonly cd /usr/bin printf local grep /usr/bin --verbose
+cd $(pwd) echo then then -eu printf
+		/usr/bin ${HOME} grep done
+	grep | grep test x=1 $(pwd) printf then done
+/usr/bin local x=1 local export local $(pwd) done | awk
+	readonly local export
+echo local --verbose printf export
+		2>/dev/null test 'quoted text' local $(pwd) printf grep readonly
+	&& x=1 export echo export 'quoted text'
+		${HOME} ${HOME} ${HOME} readonly
+	| readonly /usr/bin && test
+	2>/dev/null | readonly | $(pwd) done then 'quoted text' x=1 'quoted text'
+x=1 "$1" printf test -eu awk grep printf "$@" then grep printf
+		/usr/bin x=1 -eu --verbose sed echo | --verbose cd 2>/dev/null local export
+		$(pwd) grep -eu "$@" grep && export readonly ${HOME} sed "$@" ${HOME} |
+"$@" $(pwd) /usr/bin && local cd --verbose 'quoted text' x=1 readonly ${HOME} then
+		then "$1" then readonly cd | 2>/dev/null
+	| | test echo "$@" x=1 grep "$@" 'quoted text'
+2>/dev/null "$1" x=1 local then "$@" && && local && --verbose awk printf then
+local cd cd | | export "$1" "$1" cd ${HOME} $(pwd) 2>/dev/null
+		then test awk | 2>/dev/null | --verbose $(pwd) local
+		"$1" test 2>/dev/null &&
+	| export then -eu /usr/bin $(pwd) then 2>/dev/null 'quoted text'
+test /usr/bin "$@" readonly done --verbose then -eu readonly printf
+		test "$@" readonly | awk $(pwd) printf local 2>/dev/null echo /usr/bin readonly
+	&& --verbose done local done --verbose readonly ${HOME}
+		local /usr/bin && 'quoted text' then
+"$@" readonly 'quoted text'
+	printf 'quoted text' "$1" awk --verbose ${HOME} -eu -eu test test
+	--verbose export | 'quoted text'
+	then x=1 sed x=1 "$1" done then 2>/dev/null
+awk echo done "$1" /usr/bin cd local echo sed -eu readonly 2>/dev/null x=1
+sed grep sed grep printf printf 2>/dev/null local then echo awk grep then
+		test | | export 2>/dev/null grep -eu "$@"
+		2>/dev/null $(pwd) echo && cd readonly -eu && export 2>/dev/null then
+		| 2>/dev/null printf grep
+		then && readonly /usr/bin -eu "$@" then -eu --verbose grep "$1" test done x=1 awk
+${HOME} | $(pwd) sed readonly && test
+local -eu "$@" "$@" $(pwd) printf echo "$1" test printf
+$(pwd) 2>/dev/null /usr/bin x=1 x=1 --verbose
+		export --verbose printf done /usr/bin
+	'quoted text' && | local grep ${HOME} "$1" "$1" ${HOME} local test cd "$@"
+	${HOME} "$1" -eu 'quoted text' ${HOME} --verbose echo
+then awk /usr/bin && then | done x=1 2>/dev/null test sed "$1" sed local
+"$1" 'quoted text' 2>/dev/null 2>/dev/null 2>/dev/null echo 2>/dev/null
+	${HOME} -eu readonly $(pwd) 2>/dev/null --verbose -eu grep echo && local
+	sed export test 'quoted text' $(pwd) readonly
+		'quoted text' ${HOME} && "$@" $(pwd) export ${HOME} awk awk |
+${HOME} grep export test --verbose 2>/dev/null 2>/dev/null grep -eu "$@" | &&
+		"$1" grep /usr/bin $(pwd) cd then | -eu && done 'quoted text' 2>/dev/null echo
+		'quoted text' ${HOME} local export echo "$1" && "$@"
+	"$@" -eu --verbose readonly awk -eu "$1"
+		${HOME} then 2>/dev/null printf export local ${HOME} 2>/dev/null done cd then
+then local awk printf awk cd then x=1 /usr/bin 2>/dev/null done export
+/usr/bin -eu awk test 'quoted text' | local test 2>/dev/null export
+2>/dev/null cd --verbose 'quoted text' "$1" done "$1" awk
+	--verbose echo ${HOME} cd "$1" test /usr/bin 2>/dev/null 'quoted text' "$@"
+done $(pwd) then --verbose export 2>/dev/null -eu local awk
+	export awk test then printf /usr/bin echo "$1" && "$@" /usr/bin
+--verbose export cd -eu test | ${HOME} awk "$@" sed "$1" ${HOME}
+	x=1 "$@" sed then --verbose
+		| local export awk sed /usr/bin "$1" -eu | cd test
+| printf ${HOME} /usr/bin /usr/bin
+export echo local then "$@" && echo | 'quoted text'
+echo 2>/dev/null echo ${HOME} x=1 echo awk --verbose ${HOME} export &&
+	awk grep grep test readonly /usr/bin local 2>/dev/null
+--verbose -eu echo "$@" 'quoted text' "$@" test then | local sed 'quoted text' export
+		2>/dev/null 'quoted text' 'quoted text'
+echo | export readonly 2>/dev/null
+		&& $(pwd) 'quoted text'
+	awk local awk local "$1" cd local readonly /usr/bin
+	printf export && "$@" local awk then && 2>/dev/null "$@" x=1
+		grep readonly grep test test "$1" test grep
+		cd && done 'quoted text' $(pwd) && cd 2>/dev/null sed printf
+test grep --verbose cd awk $(pwd) sed /usr/bin then echo export
+		sed "$@" x=1 then done -eu test "$@" done ${HOME} cd grep "$@" sed awk awk "$@"
+	printf | grep --verbose | readonly 'quoted text' -eu printf sed 2>/dev/null
+		--verbose 2>/dev/null test cd done then
+done awk 'quoted text' readonly sed awk | done test | done done done 2>/dev/null
+echo then "$@" local 'quoted text' ${HOME} cd | cd && x=1 $(pwd)
+${HOME} /usr/bin 2>/dev/null "$@"
+printf then 'quoted text' $(pwd) $(pwd) done cd then export "$@" cd cd printf echo
+		"$1" 2>/dev/null "$1" echo test printf --verbose local
+		grep 'quoted text' printf test cd printf 'quoted text' /usr/bin
+	grep grep /usr/bin cd x=1 printf cd "$@" "$1"
+	test local sed x=1 -eu
+	done && --verbose echo
+	test printf 'quoted text' $(pwd)
+export sed 'quoted text' readonly --verbose $(pwd) then awk sed
+	-eu then $(pwd) 'quoted text' local awk awk test && test sed readonly
+		-eu 2>/dev/null | done cd && test awk
+--verbose -eu x=1 export /usr/bin 2>/dev/null
+--verbose grep --verbose | && awk then echo "$1" "$@"
+	--verbose echo /usr/bin sed local local x=1 echo sed --verbose printf then
+		printf cd -eu -eu && "$@" 'quoted text' "$@" test 'quoted text' grep x=1 "$@" --verbose
+	sed printf --verbose then --verbose x=1 2>/dev/null local awk
+${HOME} sed $(pwd) printf printf && | $(pwd) then
+${HOME} | && printf local local x=1 grep test "$@"
+		export then ${HOME} cd export sed then $(pwd) "$@" $(pwd) readonly ${HOME}
+readonly export cd echo 'quoted text' 'quoted text' grep readonly export awk readonly
+	&& && "$1" sed "$@" x=1 export local
+		awk export 'quoted text'
+$(pwd) then done done -eu test grep export awk local awk "$@" && then
+/usr/bin awk 'quoted text' 'quoted text' "$1" "$@" x=1 --verbose
+		--verbose local /usr/bin "$1" local awk echo awk sed then printf
+	readonly local local sed $(pwd) 'quoted text'
+/usr/bin then -eu readonly x=1 readonly
+'quoted text' cd printf 'quoted text'
+		${HOME} local -eu then 'quoted text' --verbose readonly export 2>/dev/null ${HOME}
+	&& cd "$@" done "$@" cd ${HOME} echo sed "$1" "$@" echo 'quoted text' -eu then test
+		&& 2>/dev/null 2>/dev/null done | awk sed "$@" "$@"
+"$@" local export "$@" 'quoted text' sed grep
+	--verbose -eu awk local $(pwd) awk $(pwd) awk 'quoted text' echo "$1"
+	&& grep -eu --verbose $(pwd) | --verbose
+		| export "$@" local 2>/dev/null local test x=1 ${HOME} readonly
+	/usr/bin | --verbose grep | 'quoted text' printf $(pwd) readonly cd | export
+	local $(pwd) && ${HOME} "$@" ${HOME} "$1"
+| done printf 2>/dev/null
+"$1" echo cd x=1 | /usr/bin "$1"
+"$1" ${HOME} 2>/dev/null
+		--verbose export "$1" $(pwd) 2>/dev/null local | --verbose
+		grep ${HOME} /usr/bin
+test local | | $(pwd) echo
+/usr/bin done test | /usr/bin export
+export $(pwd) local done awk echo export --verbose export | 'quoted text'
+	sed done | | test x=1 printf && 'quoted text' echo export --verbose -eu x=1 |
+--verbose cd test sed done x=1 "$@" then grep
+		${HOME} $(pwd) echo x=1 --verbose echo "$@" && readonly
+		'quoted text' 'quoted text' cd export sed -eu done -eu $(pwd) |
+local | readonly "$1" ${HOME} test ${HOME} x=1 2>/dev/null
+awk echo readonly printf "$@" $(pwd)
+	done ${HOME} echo sed done "$1" 2>/dev/null awk local "$@" --verbose
+	awk export printf local local "$1" grep printf ${HOME} printf "$1" $(pwd)
+local --verbose printf then "$@" cd echo cd "$1" | | /usr/bin sed
+		--verbose readonly x=1 && $(pwd) -eu 'quoted text' | --verbose cd 2>/dev/null
+	x=1 && done echo x=1 done x=1 x=1 sed -eu && sed sed --verbose cd && && readonly
+	echo && export echo --verbose readonly 2>/dev/null
+		printf "$@" /usr/bin test cd test done echo readonly 'quoted text'
+	test export -eu "$@" sed "$1" echo test sed local | sed --verbose
+"$@" "$1" export local 2>/dev/null "$1"
+		local echo printf -eu x=1 $(pwd) 2>/dev/null echo then cd /usr/bin
+		printf --verbose $(pwd) cd local sed test readonly export
+		sed $(pwd) awk awk printf "$1" sed echo x=1 local
+		/usr/bin "$1" "$1" | -eu $(pwd) ${HOME} 'quoted text'
+		'quoted text' test "$1" then --verbose
+		-eu awk | 2>/dev/null then readonly printf "$1"
+		2>/dev/null --verbose 2>/dev/null done | | cd x=1 awk export then
+		awk /usr/bin x=1 'quoted text' cd $(pwd) x=1 readonly
+		grep /usr/bin printf | x=1 2>/dev/null then readonly export $(pwd)
+		/usr/bin 'quoted text' "$1" awk then sed && "$1" cd
+--verbose /usr/bin /usr/bin echo "$1" export --verbose
+2>/dev/null done echo export $(pwd) --verbose then ${HOME}
+-eu "$@" awk awk readonly "$@" awk test local local | --verbose readonly
+local && grep echo local awk readonly sed then && ${HOME} && /usr/bin
+	echo cd test then | cd local "$@" awk export --verbose awk 'quoted text' local
+		$(pwd) then done 2>/dev/null
+	&& readonly printf -eu done local 2>/dev/null
+		--verbose x=1 readonly then
+		2>/dev/null printf 2>/dev/null test 2>/dev/null
+grep --verbose awk printf x=1 && sed --verbose
+	/usr/bin /usr/bin export 'quoted text' grep export /usr/bin done readonly
+	&& printf 2>/dev/null local
+		echo 'quoted text' then local grep
+	echo test then export cd printf 2>/dev/null $(pwd)
+		${HOME} /usr/bin "$@" awk /usr/bin done /usr/bin local
+		echo ${HOME} sed test && done x=1 ${HOME} -eu
+	x=1 cd sed done done x=1 ${HOME} x=1 done grep grep /usr/bin readonly
+		--verbose echo done "$@" sed then
+		cd "$1" printf test printf -eu "$@" readonly printf local cd ${HOME}
+"$@" ${HOME} readonly "$@" | x=1 /usr/bin "$@" -eu
+		x=1 test printf sed echo test --verbose
+		grep 'quoted text' export export readonly -eu done $(pwd)
+	/usr/bin ${HOME} cd grep
+		cd x=1 "$@" /usr/bin && /usr/bin local && x=1 sed -eu readonly awk echo
+		done printf 'quoted text' then sed "$1"
+	'quoted text' "$@" then awk -eu sed /usr/bin grep -eu sed
+		--verbose awk x=1 ${HOME} then local 2>/dev/null 'quoted text' printf then
+${HOME} "$1" --verbose 'quoted text' then echo | | -eu $(pwd)
+		printf echo 'quoted text' test cd test awk --verbose "$1" cd
+		&& ${HOME} x=1 $(pwd) sed done ${HOME} ${HOME} cd grep
+		export --verbose sed test export echo ${HOME} test
+	$(pwd) $(pwd) grep x=1 echo done echo
+		then done sed then readonly && sed echo grep
+test echo x=1 readonly then
+	x=1 'quoted text' 2>/dev/null | ${HOME} "$1"
+		echo grep $(pwd) grep 2>/dev/null then printf local
+	"$@" printf "$@" local grep done x=1
+	| printf 'quoted text' then -eu
+export | /usr/bin echo ${HOME} then grep then sed readonly readonly
+	/usr/bin grep 'quoted text' "$1" -eu /usr/bin && && && readonly --verbose awk
+		-eu export cd | 2>/dev/null readonly printf export /usr/bin grep "$@" grep --verbose
+	| export | $(pwd) done "$1" -eu cd cd && grep x=1 | readonly --verbose done
+		'quoted text' then echo $(pwd) "$1" export
+cd printf ${HOME} | && ${HOME} ${HOME} sed readonly
+test test ${HOME} --verbose ${HOME} x=1 --verbose
+		'quoted text' sed readonly then x=1 printf grep "$@" 2>/dev/null readonly 2>/dev/null
+	| test && export 2>/dev/null printf awk local $(pwd) --verbose ${HOME}
+"$1" cd -eu "$1" readonly sed -eu x=1 'quoted text' $(pwd) awk then then
+	echo awk printf -eu cd cd /usr/bin ${HOME} echo $(pwd) awk grep | /usr/bin
+then test "$1" "$@" export
+local 2>/dev/null -eu /usr/bin then && 'quoted text' "$1"
+cd awk echo 'quoted text' done then local && done -eu then then cd
+	done grep --verbose cd "$1" readonly 2>/dev/null &&
+	readonly local -eu /usr/bin done grep /usr/bin export x=1 export
+		-eu done test test test $(pwd) x=1
+cd echo $(pwd) printf && export | awk sed echo export /usr/bin readonly export
+	readonly ${HOME} sed | cd "$@" cd printf
+		local --verbose echo local printf "$@" "$1" export export awk then cd | | ${HOME}
+$(pwd) printf cd 'quoted text'
+		grep "$@" cd && local test
+	sed ${HOME} echo printf --verbose done
+		sed "$1" cd export echo done done -eu export
+"$1" local -eu -eu | echo 'quoted text' then | -eu 2>/dev/null export
+		&& "$@" done 2>/dev/null local && && | -eu
+readonly then cd --verbose x=1
+awk "$1" $(pwd) printf ${HOME} then && readonly export "$1" | echo awk grep
+	readonly /usr/bin cd 'quoted text' then
+		sed printf printf "$@" 'quoted text' -eu 2>/dev/null
+grep echo -eu awk grep
+-eu x=1 "$@" export |
+	awk 'quoted text' local $(pwd) ${HOME}
+'quoted text' | done x=1 awk export --verbose
+	export && "$@" "$@" sed ${HOME} printf /usr/bin printf
+$(pwd) "$@" readonly done 2>/dev/null
+		--verbose && done x=1 /usr/bin done awk ${HOME}
+	then test done done grep grep ${HOME} | 2>/dev/null readonly sed
+		done | | test local cd && 2>/dev/null
+	grep x=1 echo /usr/bin grep local awk 'quoted text' done -eu export readonly
+"$@" 'quoted text' done awk x=1
+	| $(pwd) test ${HOME} grep printf done then export readonly
+	test x=1 then cd awk | $(pwd)
+	sed test cd ${HOME} x=1 && readonly awk $(pwd) 2>/dev/null --verbose cd
+-eu -eu printf then -eu local | readonly readonly then test sed local | x=1 && then
+	echo printf $(pwd) && grep done x=1 echo /usr/bin ${HOME}
+echo local export test x=1 2>/dev/null --verbose
+	$(pwd) -eu | readonly /usr/bin grep export awk -eu readonly awk --verbose export
+		$(pwd) test | printf echo --verbose x=1 | ${HOME} echo readonly | $(pwd)
+'quoted text' --verbose local | test $(pwd) export
+		printf && awk sed test x=1 --verbose && test x=1 ${HOME}
+done readonly export | done "$@"
+		--verbose $(pwd) sed "$@" /usr/bin printf done "$1" /usr/bin
+		readonly 'quoted text' then sed cd done x=1 'quoted text' ${HOME} echo &&
+${HOME} printf x=1 -eu export done ${HOME} then -eu && &&
+	awk readonly $(pwd) printf /usr/bin test echo "$@" && done readonly
+		'quoted text' cd printf export x=1 'quoted text' && printf 'quoted text'
+	-eu then "$1" awk cd printf "$@" test | ${HOME}
+cd 2>/dev/null /usr/bin done
+then | "$1" "$1" && echo export 'quoted text'
+	cd --verbose /usr/bin 2>/dev/null printf 2>/dev/null echo cd "$@"
+	$(pwd) $(pwd) && printf readonly
+		"$1" x=1 readonly "$1" export 2>/dev/null $(pwd) $(pwd)
+		'quoted text' -eu echo ${HOME} awk awk
+	test then local && 2>/dev/null readonly printf
+$(pwd) done test test
+		&& awk x=1 ${HOME} test "$1" |
+--verbose $(pwd) 2>/dev/null grep "$1"
+		cd --verbose printf echo readonly | then export local test test done
+		readonly export | awk grep x=1 $(pwd) sed "$@" 2>/dev/null
+echo export local && ${HOME} grep "$1" export
+	sed readonly 2>/dev/null 2>/dev/null
+	local 'quoted text' /usr/bin /usr/bin grep
+	grep --verbose awk readonly echo 'quoted text' ${HOME}
+echo "$1" x=1 "$1" /usr/bin $(pwd) printf "$1"
+		grep 'quoted text' x=1 awk | awk
+		cd /usr/bin /usr/bin awk "$@" 2>/dev/null /usr/bin -eu local awk
+/usr/bin 'quoted text' x=1 && "$1" test echo
+| x=1 ${HOME} --verbose $(pwd) $(pwd) && | --verbose
+	&& grep "$@" ${HOME} echo export printf export cd --verbose
+		--verbose done sed 2>/dev/null "$@" then local "$@" done test $(pwd) local
+		cd printf | local test done 'quoted text'
+awk then -eu sed local grep grep cd --verbose
+		local /usr/bin sed awk
+		/usr/bin "$1" -eu printf
+		awk /usr/bin grep cd x=1 cd awk cd $(pwd) echo cd readonly
+	/usr/bin "$1" local -eu "$1" echo local cd /usr/bin
+local sed printf --verbose ${HOME} cd --verbose /usr/bin 'quoted text' --verbose
+		-eu x=1 'quoted text' | "$@" --verbose echo | echo test && printf awk x=1
+sed $(pwd) && "$@" "$1" sed ${HOME}
+		local $(pwd) readonly | cd /usr/bin /usr/bin 2>/dev/null done readonly
+		cd cd sed 2>/dev/null awk
+		| 'quoted text' 2>/dev/null -eu /usr/bin | local grep "$@" grep
+-eu ${HOME} /usr/bin then 'quoted text' printf --verbose --verbose 'quoted text'
+	"$@" local then done cd readonly awk awk echo done 2>/dev/null
+		readonly sed ${HOME} $(pwd) local echo 2>/dev/null --verbose "$@" printf local
+		"$@" ${HOME} export done 2>/dev/null
+		grep readonly then done done then --verbose awk local | grep && --verbose
+	test 2>/dev/null -eu grep $(pwd) "$@" 'quoted text'
+	x=1 readonly "$@" test
+		readonly && | && export "$1" then done then 'quoted text' grep 'quoted text'
+export | grep x=1 x=1 test ${HOME} echo $(pwd) 2>/dev/null export 2>/dev/null --verbose
+"$1" $(pwd) --verbose && test
+		printf x=1 "$@" -eu x=1 local cd x=1 done 2>/dev/null $(pwd) && "$1"
+echo then && sed export then readonly printf 'quoted text'
+	"$@" then | grep grep
+&& | --verbose printf
+	export 2>/dev/null done "$1" cd 'quoted text' grep /usr/bin
+'quoted text' printf -eu && local ${HOME}
+done 'quoted text' ${HOME} -eu /usr/bin then 'quoted text'
+		"$@" printf done cd $(pwd) awk 2>/dev/null $(pwd) grep | export
+		test export test export grep grep local export --verbose
+	readonly /usr/bin ${HOME}
+${HOME} grep readonly 2>/dev/null 2>/dev/null /usr/bin
+		done /usr/bin sed | 2>/dev/null | readonly /usr/bin then cd awk
+	${HOME} 2>/dev/null cd -eu && local
+	echo 2>/dev/null sed export test sed /usr/bin && awk sed | /usr/bin
+		${HOME} cd then 'quoted text' && printf cd test
+		&& cd sed test then readonly && grep readonly test -eu | --verbose
+"$1" export /usr/bin --verbose "$1" | sed then grep test
+	local sed done $(pwd) grep local local grep ${HOME} $(pwd) done ${HOME}
+${HOME} readonly test echo done x=1 printf grep
+	then then readonly done $(pwd) then then
+	x=1 x=1 ${HOME} --verbose export x=1 -eu $(pwd) echo /usr/bin
+"$@" then done /usr/bin export then sed 'quoted text' --verbose
+	readonly printf "$@" cd echo readonly 'quoted text' -eu "$1" cd echo done
+	done local then "$@" local x=1 sed
+		/usr/bin echo printf sed cd test export readonly /usr/bin echo "$@" -eu
+		$(pwd) ${HOME} 2>/dev/null test 'quoted text' readonly
+	echo awk then export echo local --verbose readonly readonly readonly cd sed
+		sed awk echo "$1" /usr/bin "$@"
+$(pwd) done grep x=1 test export 'quoted text' awk x=1 readonly printf
+		-eu --verbose ${HOME} sed ${HOME}
+		grep grep 'quoted text' | ${HOME} awk && cd $(pwd) grep -eu 'quoted text'
+		-eu awk $(pwd) -eu readonly done readonly
+	test then && printf local -eu
+		'quoted text' --verbose | local | --verbose 'quoted text' -eu sed readonly
+		x=1 awk echo printf --verbose cd export 2>/dev/null grep
+		-eu "$1" done "$1" ${HOME} $(pwd) test readonly local "$@"
+sed && done -eu sed && 2>/dev/null ${HOME} then 'quoted text' then |
+		2>/dev/null -eu printf grep --verbose "$@" echo grep awk test "$@" done
+	local then export | echo test
+	&& test "$1" awk && readonly "$@" x=1 x=1 echo $(pwd) "$1" --verbose -eu "$@"
+		local done ${HOME} grep | $(pwd) 'quoted text' 2>/dev/null awk readonly readonly
+		| "$@" sed cd && 'quoted text' /usr/bin | -eu
+		| cd cd --verbose awk cd $(pwd) grep sed export
+	/usr/bin | awk && $(pwd) test /usr/bin
+		grep -eu && echo "$@" sed
+		grep cd printf "$1" "$1" grep $(pwd) | -eu --verbose 'quoted text' sed
+	/usr/bin test "$1" done -eu 'quoted text' 2>/dev/null ${HOME} x=1 /usr/bin
+		/usr/bin readonly export 'quoted text'
+test then echo | export /usr/bin
+awk echo awk printf 2>/dev/null printf ${HOME}
+echo ${HOME} local x=1 && sed then $(pwd) ${HOME} cd echo printf && | 'quoted text'
+	&& done ${HOME} $(pwd) && 'quoted text'
+echo | x=1 | echo test && cd test && readonly cd test ${HOME}
+	-eu local /usr/bin $(pwd) readonly local
+| sed && --verbose --verbose echo sed
+-eu printf -eu cd done sed then "$1" "$@" export awk
+	${HOME} --verbose --verbose "$1"
+	2>/dev/null printf readonly readonly export "$1" --verbose "$1" && && "$1"
+	x=1 export | grep "$1" | grep $(pwd)
+local test done | x=1 grep --verbose
+		grep /usr/bin done "$@" --verbose local | test
+	"$@" /usr/bin grep awk --verbose "$1" cd cd -eu ${HOME}
+		/usr/bin | grep echo |
+echo 2>/dev/null then export /usr/bin 2>/dev/null $(pwd) printf ${HOME}
+		'quoted text' echo && awk sed readonly 2>/dev/null
+local /usr/bin --verbose local echo -eu printf done $(pwd)
+	$(pwd) test printf && -eu cd test | printf | cd $(pwd)
+cd printf -eu | echo printf ${HOME} /usr/bin printf /usr/bin x=1 export
+	echo /usr/bin 'quoted text' 2>/dev/null "$@" done echo local "$1" printf
+"$1" then grep cd --verbose
+		"$1" 2>/dev/null && grep export $(pwd) local readonly -eu && cd | ${HOME}
+		x=1 --verbose sed printf printf -eu /usr/bin | printf
+		sed | $(pwd) then | 2>/dev/null /usr/bin | then "$1" printf
+	-eu cd echo test done then grep grep "$1"
+		| then readonly $(pwd) printf $(pwd)
+	-eu x=1 x=1 cd echo 'quoted text' x=1 --verbose local -eu
+${HOME} 2>/dev/null then then
+${HOME} awk "$1" printf readonly test "$@" cd 'quoted text'
+'quoted text' test cd sed grep
+		grep && sed sed test sed sed -eu x=1 | | test then 'quoted text'
+	then readonly then printf ${HOME} 'quoted text' awk readonly awk $(pwd) printf
+echo 2>/dev/null echo $(pwd) && test | grep echo | | awk local "$@" /usr/bin
+		export /usr/bin cd awk done then x=1 then then $(pwd) $(pwd)
+		printf --verbose x=1 "$1" | | && readonly printf && 2>/dev/null
+2>/dev/null 'quoted text' 'quoted text' "$@"
+	then $(pwd) && | echo ${HOME}
+	'quoted text' --verbose -eu echo echo -eu --verbose then sed ${HOME} printf 2>/dev/null
+readonly x=1 cd echo -eu then x=1 'quoted text' cd 'quoted text' export
+	grep | -eu sed readonly 'quoted text' awk echo "$@"
+		cd local then export printf -eu echo then done "$@" "$1"
+	local x=1 test "$1" done --verbose
+awk /usr/bin done | ${HOME} local grep
+	--verbose printf -eu done grep x=1 --verbose then grep printf local "$@" 2>/dev/null
+	&& /usr/bin readonly x=1 && --verbose && awk cd
+-eu echo done 2>/dev/null readonly
+	| 2>/dev/null local test test 2>/dev/null && awk then && done --verbose
+	cd | awk awk awk 2>/dev/null sed "$@" /usr/bin export | 2>/dev/null grep readonly
+	/usr/bin && echo 2>/dev/null | ${HOME} cd $(pwd) ${HOME} ${HOME} echo
+	done | --verbose sed /usr/bin echo readonly
+"$1" then cd then ${HOME} printf "$@" readonly
+		local sed local awk ${HOME} /usr/bin test local done $(pwd) readonly then ${HOME}
+		sed --verbose then awk "$1" printf then
+	-eu 2>/dev/null --verbose awk "$1" -eu
+		then test done then --verbose local && readonly
+printf ${HOME} $(pwd) then "$@" $(pwd) "$@" 2>/dev/null done "$@" "$1" 'quoted text'
+	echo sed printf x=1 then grep printf 2>/dev/null
+		local done --verbose test done --verbose then
+$(pwd) /usr/bin 2>/dev/null export $(pwd) then
+done "$@" && 2>/dev/null "$1" $(pwd) &&
+sed export test /usr/bin && local readonly readonly "$1" awk && "$1" export
+		$(pwd) export "$1" printf /usr/bin "$1" "$@" awk 'quoted text' grep
+	--verbose done then test echo x=1 echo 'quoted text' done done
+	local export grep /usr/bin
+		&& readonly ${HOME} test awk 2>/dev/null /usr/bin
+		$(pwd) grep sed sed sed x=1 done cd export
+	2>/dev/null sed $(pwd) "$@" test
+		"$1" sed $(pwd) echo | awk then test |
+		&& --verbose readonly "$1" cd --verbose test export ${HOME} test readonly
+	"$@" x=1 $(pwd) readonly printf grep awk cd /usr/bin
+-eu local then readonly then x=1 && local 'quoted text' cd
+"$@" cd && $(pwd) --verbose $(pwd) readonly
+	| printf awk grep "$@" --verbose
+'quoted text' local /usr/bin
+		2>/dev/null awk /usr/bin readonly awk $(pwd) then |
+x=1 echo local export -eu cd
+	--verbose && "$1" 'quoted text'
+-eu "$@" 2>/dev/null sed 2>/dev/null ${HOME}
+	grep 2>/dev/null ${HOME} echo && | local 2>/dev/null
+	'quoted text' "$1" awk --verbose "$1" ${HOME} export export 2>/dev/null
+local echo export "$@" printf "$@" then
+		done 2>/dev/null export test 'quoted text' ${HOME}
+		test | "$1" grep "$1" awk "$@" 'quoted text' awk ${HOME} printf cd test "$1"
+		--verbose local cd local
+		echo --verbose && /usr/bin cd test -eu readonly 2>/dev/null readonly
+		2>/dev/null cd $(pwd) "$@" 2>/dev/null
+cd awk && && cd sed -eu grep printf $(pwd) printf /usr/bin
+	sed readonly | ${HOME} then 'quoted text' 2>/dev/null cd echo
+	"$1" && echo grep echo --verbose awk "$@" test -eu then awk then local
+done 'quoted text' cd "$@" ${HOME} $(pwd) readonly
+		--verbose local 2>/dev/null cd cd "$@" readonly
+	| sed /usr/bin "$@" "$1" cd export sed grep grep --verbose 'quoted text'
+	'quoted text' readonly export
+	'quoted text' | readonly readonly local awk readonly 2>/dev/null
+$(pwd) ${HOME} done echo | "$1" echo then && "$1" readonly --verbose
+2>/dev/null readonly cd | "$1" grep readonly
+	$(pwd) sed local grep grep then x=1 printf 'quoted text' $(pwd) printf "$1" test
+${HOME} done "$1" done 2>/dev/null echo -eu done test $(pwd) cd cd export
+	/usr/bin test "$@" test "$@"
+	awk ${HOME} local 2>/dev/null ${HOME} ${HOME} test test readonly &&
+		| 2>/dev/null then printf printf 'quoted text' cd | 2>/dev/null printf "$1"
+		--verbose echo done "$1" x=1 grep 'quoted text'
+	"$1" "$1" -eu 2>/dev/null local -eu -eu --verbose
+	printf printf "$1" local done
+	then local export then
+		"$@" readonly awk then -eu export 'quoted text' 2>/dev/null awk awk readonly
+	"$1" local -eu grep "$@"
+		"$@" --verbose "$@" then /usr/bin 'quoted text' ${HOME} "$@" export
+	grep && x=1 export -eu echo printf sed
+		echo export "$@" | printf x=1 grep printf x=1 | done | echo ${HOME} grep awk
+	'quoted text' | local ${HOME} cd 2>/dev/null "$@" then then export -eu x=1
+	-eu -eu /usr/bin done 'quoted text' echo /usr/bin 2>/dev/null
+	"$1" done "$@" test --verbose "$1" 2>/dev/null -eu export cd
+	${HOME} export echo -eu export x=1 awk cd echo printf awk cd
+grep export grep -eu 2>/dev/null local export --verbose
+2>/dev/null | $(pwd) ${HOME} readonly sed done | -eu -eu $(pwd) && $(pwd)
+'quoted text' x=1 ${HOME}
+grep /usr/bin -eu then awk /usr/bin 2>/dev/null done readonly
+		2>/dev/null printf /usr/bin 2>/dev/null done printf
+	"$@" cd echo cd local 2>/dev/null printf cd /usr/bin && awk -eu
+	then readonly $(pwd) ${HOME} "$1" "$@" done readonly && $(pwd) -eu grep
+		sed /usr/bin echo export "$1" --verbose 2>/dev/null 2>/dev/null "$1" x=1
+		grep local awk $(pwd) done |
+"$1" export export -eu local 2>/dev/null printf -eu $(pwd) --verbose
+		&& cd "$@" cd cd sed grep awk printf -eu sed grep local "$@" export done 2>/dev/null
+	local export /usr/bin | x=1 printf
+--verbose /usr/bin x=1 && | grep grep printf export /usr/bin $(pwd) 2>/dev/null
+		then readonly 2>/dev/null "$1" done -eu ${HOME} && test export
+	cd echo echo | $(pwd) done -eu export /usr/bin | "$@" cd awk done then
+		${HOME} awk echo cd echo export --verbose && 2>/dev/null
+	test local awk printf /usr/bin 'quoted text' x=1 awk
+	then local test cd --verbose echo done local sed /usr/bin
+		${HOME} test awk echo x=1 /usr/bin cd local 2>/dev/null | && cd
+		'quoted text' -eu cd --verbose then "$@" ${HOME}
+	done 2>/dev/null grep 'quoted text' --verbose
+--verbose x=1 then done 2>/dev/null | &&
+-eu printf -eu sed readonly
+	2>/dev/null awk sed sed awk then 2>/dev/null
+	$(pwd) "$1" grep cd awk | | | cd $(pwd) -eu "$1" done readonly
+	local printf "$1" readonly "$1" printf && | && "$1" done ${HOME} local "$@" "$@"
+	'quoted text' readonly done | $(pwd)
+		2>/dev/null 'quoted text' -eu awk printf $(pwd) -eu done cd $(pwd)
+		"$@" local | -eu -eu && /usr/bin "$@" sed readonly sed export
+	$(pwd) local local readonly awk cd local local "$1" cd printf
+		/usr/bin -eu then --verbose $(pwd)
+	export cd x=1 cd echo cd "$@" 2>/dev/null local && echo done cd readonly
+		--verbose "$1" | 'quoted text' 2>/dev/null | 'quoted text' -eu
+		done readonly then test "$1" readonly $(pwd)
+	cd && "$@" readonly readonly grep
+		printf --verbose | /usr/bin echo awk echo readonly && 2>/dev/null
+		--verbose grep 'quoted text' done echo /usr/bin x=1 --verbose 2>/dev/null --verbose
+		echo ${HOME} | 'quoted text'
+awk local printf test awk && sed "$@" | | local "$1" printf --verbose cd local
+test readonly "$1" test local | "$1" --verbose ${HOME} cd | local done export then
+		export grep "$@" test sed ${HOME} | done "$@" printf $(pwd) "$1" "$@" readonly
+x=1 | --verbose --verbose 2>/dev/null
+	| done /usr/bin then echo local cd /usr/bin /usr/bin readonly 2>/dev/null
+		grep "$1" /usr/bin readonly | && $(pwd)
+echo ${HOME} | echo cd export ${HOME} 'quoted text' then /usr/bin ${HOME}
+x=1 printf done $(pwd) --verbose "$@" cd then 2>/dev/null
+		${HOME} then then "$1"
+		export ${HOME} /usr/bin 'quoted text' export $(pwd) | printf readonly 'quoted text'
+	$(pwd) $(pwd) $(pwd) test | sed awk
+		x=1 export "$@" "$1" sed grep /usr/bin readonly done awk
+		grep test sed 'quoted text' $(pwd) 'quoted text' 2>/dev/null $(pwd)
+	sed then test | printf --verbose
+	--verbose $(pwd) -eu "$@" -eu then local printf test grep readonly
+-eu 'quoted text' -eu readonly local 2>/dev/null local -eu x=1 awk /usr/bin
+grep "$1" printf awk sed done done done export done ${HOME} /usr/bin
+	printf test grep $(pwd) then &&
+		-eu readonly "$1" awk test done printf "$1" --verbose | done
+echo local && x=1 "$1" grep awk printf then awk ${HOME}
+awk | then "$@" echo then done echo printf grep export done
+	"$1" awk local 2>/dev/null -eu ${HOME} awk grep /usr/bin
+done "$@" -eu $(pwd) done 2>/dev/null cd grep done readonly test
+	&& cd 'quoted text' 2>/dev/null -eu awk --verbose --verbose
+		"$@" x=1 echo test printf 2>/dev/null done awk export cd "$@"
+		then export /usr/bin $(pwd) done echo printf awk 'quoted text' $(pwd)
+	awk ${HOME} $(pwd) awk export sed sed | export grep | done "$@" --verbose
+export ${HOME} -eu local | local awk cd "$@" sed
+		$(pwd) | cd echo "$@" then export "$@" local then echo && cd readonly
+	${HOME} local export /usr/bin -eu grep /usr/bin 2>/dev/null "$@"
+		grep grep readonly x=1 ${HOME} x=1 && test /usr/bin readonly
+	-eu && echo awk local export grep 'quoted text' && export
+	export done 'quoted text' | "$1" export "$@" $(pwd) | then
+"$1" ${HOME} 2>/dev/null test sed -eu then printf 2>/dev/null
+	cd $(pwd) test --verbose then then --verbose "$1" ${HOME} 'quoted text'
+		x=1 echo echo 'quoted text' ${HOME} "$@" /usr/bin 2>/dev/null 2>/dev/null
+/usr/bin awk "$@" $(pwd) export echo
+	2>/dev/null echo ${HOME} echo printf 2>/dev/null 'quoted text' readonly --verbose
+		${HOME} "$@" export done then ${HOME}
+		export local done local export done 'quoted text' cd x=1 -eu echo -eu
+	/usr/bin cd ${HOME} local
+readonly 'quoted text' && | cd && -eu then cd --verbose
+${HOME} awk done x=1 "$@" "$@"
+cd awk $(pwd) /usr/bin 2>/dev/null
+		"$1" export | sed grep test
+	local /usr/bin "$@" echo
+	2>/dev/null test | 2>/dev/null readonly | sed "$@" grep echo done test ${HOME} |
+		printf && echo local echo | echo export "$1" local ${HOME} grep grep
+		x=1 2>/dev/null 2>/dev/null $(pwd) 'quoted text' printf |
+		cd x=1 | | grep grep $(pwd) ${HOME} echo printf /usr/bin
+awk test grep sed cd x=1 "$@"
+	done --verbose | awk "$@" cd | cd cd
+	x=1 'quoted text' $(pwd) 2>/dev/null local sed 'quoted text'
+export awk echo x=1 2>/dev/null export x=1 --verbose "$1" "$@" /usr/bin
+		"$@" printf test 2>/dev/null ${HOME} /usr/bin 'quoted text' -eu && printf
+	"$@" $(pwd) ${HOME} echo export sed sed
+${HOME} done sed echo -eu "$1" ${HOME} "$1" 'quoted text' ${HOME} then grep
+| readonly $(pwd) echo cd done awk then ${HOME} | echo cd "$1"
+		export printf test then cd then "$@" local awk "$@" /usr/bin
+	awk x=1 /usr/bin done "$@" echo $(pwd) "$@" grep -eu && "$1"
+2>/dev/null then "$1" test && local -eu "$@" sed x=1 && $(pwd)
+-eu | cd test then cd && readonly local -eu x=1 local then
+test | then "$@" readonly "$@" sed awk
+		'quoted text' 2>/dev/null echo --verbose ${HOME} 2>/dev/null echo local
+	done sed export | 'quoted text' readonly | echo local grep readonly
+/usr/bin "$1" -eu awk done printf sed 2>/dev/null export sed "$@" x=1
+	--verbose -eu printf x=1 sed sed readonly test 'quoted text' /usr/bin
+--verbose done -eu printf --verbose then && ${HOME}
+	printf /usr/bin grep cd cd $(pwd) --verbose /usr/bin readonly
+		-eu --verbose echo sed --verbose
+awk readonly ${HOME} sed && 2>/dev/null 2>/dev/null
+/usr/bin local test awk test done -eu 2>/dev/null 2>/dev/null --verbose cd sed
+		"$1" sed readonly | -eu cd printf x=1 "$@" done readonly test
+	echo x=1 | local test --verbose awk $(pwd) then
+		test -eu echo 2>/dev/null printf x=1 cd local cd
+		export echo && echo $(pwd) "$1" -eu test 'quoted text' export /usr/bin
+		then export 'quoted text' | "$1" test "$1" test export ${HOME}
+		grep $(pwd) awk && -eu cd "$1" 'quoted text'
+sed then printf $(pwd) | /usr/bin done readonly && local cd printf cd $(pwd)
+2>/dev/null x=1 && awk 'quoted text' -eu "$@" 2>/dev/null printf -eu 2>/dev/null
+		$(pwd) ${HOME} export "$1" local printf "$@" | "$1" readonly 2>/dev/null
+'quoted text' export "$@"
+grep cd then "$1" local echo grep $(pwd)
+done done export printf local /usr/bin | test 'quoted text' echo
+printf && awk $(pwd) then cd
+${HOME} && $(pwd) -eu 'quoted text' --verbose x=1 then x=1 'quoted text'
+	export done ${HOME} $(pwd)
+		x=1 | local /usr/bin echo -eu /usr/bin export export && x=1
+		x=1 /usr/bin awk sed test ${HOME} echo cd grep && $(pwd) "$@" "$@"
+done export | test cd test $(pwd) then $(pwd) sed && readonly awk test "$1"
+		x=1 local $(pwd) test grep ${HOME} done sed x=1 $(pwd) grep export
+	export readonly /usr/bin && then sed $(pwd)
+| --verbose 2>/dev/null readonly x=1 echo /usr/bin echo export
+	readonly printf && | "$@" cd 'quoted text' echo printf
+test $(pwd) test $(pwd) readonly 2>/dev/null echo then
+		sed sed 2>/dev/null sed grep 2>/dev/null
+'quoted text' sed local "$1" grep local readonly
+	x=1 | done && printf grep "$1" x=1 export
+2>/dev/null local ${HOME}
+	sed x=1 ${HOME} cd && "$1" done 'quoted text' x=1 "$1" 2>/dev/null "$@" echo ${HOME}
+		cd sed awk export grep done "$1" /usr/bin |
+'quoted text' done done echo ${HOME} readonly export
+		local -eu 2>/dev/null export "$@" $(pwd) local | test "$@" "$1" then test |
+		printf echo export | then "$1" --verbose local test readonly "$@"
+	&& $(pwd) "$@" "$@" local "$@" printf export readonly
+	done test printf grep then ${HOME} local test -eu
+		cd x=1 2>/dev/null /usr/bin ${HOME} --verbose x=1 "$1" -eu && then cd ${HOME}
+--verbose 'quoted text' ${HOME} 'quoted text' "$@" && "$@" done && ${HOME}
+	${HOME} grep awk test "$@" export $(pwd) export done test && cd awk 'quoted text'
+		test done export sed printf -eu cd printf test
+	export grep ${HOME} awk export --verbose echo -eu readonly
+		| done export then && sed echo sed export $(pwd) cd
+2>/dev/null ${HOME} done then
+		printf --verbose local x=1 local grep "$@"
+--verbose --verbose done --verbose "$@"
+		test 'quoted text' && --verbose | local -eu cd echo 2>/dev/null echo ${HOME}
+		$(pwd) echo printf "$1" sed then export local grep && printf --verbose
+	awk && local | 'quoted text' /usr/bin /usr/bin
+		grep | "$@" /usr/bin && readonly
+export && "$@" test $(pwd) | printf | x=1
+	$(pwd) "$1" then "$1" test $(pwd) "$@" -eu 'quoted text' | $(pwd)
+local 2>/dev/null then echo x=1 && $(pwd)
+		"$1" 'quoted text' grep ${HOME} && x=1
+readonly sed export -eu 2>/dev/null awk 2>/dev/null
+		test 2>/dev/null sed printf
+		$(pwd) local done | /usr/bin cd readonly "$1" -eu then echo
+sed done | "$@" then test "$1" x=1 "$1" echo 2>/dev/null
+		cd -eu 2>/dev/null awk $(pwd)
+		grep awk grep && && readonly awk test | | "$@" "$@" /usr/bin --verbose done grep
+		/usr/bin test readonly ${HOME} && done done export
+		test echo done --verbose printf && grep test 'quoted text' "$1" export readonly
+	| 'quoted text' /usr/bin echo x=1 test echo "$@" echo
+	export sed export x=1 awk ${HOME} test readonly "$@" --verbose -eu 2>/dev/null
+cd -eu sed -eu 2>/dev/null export readonly ${HOME}
+sed -eu --verbose ${HOME} then cd ${HOME} readonly readonly
+	export "$@" export "$1" readonly 2>/dev/null
+	--verbose && then cd done test --verbose
+		cd -eu x=1 "$1" 2>/dev/null 2>/dev/null
+		local $(pwd) x=1 grep local awk 'quoted text' $(pwd) readonly $(pwd) echo
+	test grep then 2>/dev/null echo 2>/dev/null -eu local
+	grep then x=1 local -eu --verbose grep awk -eu sed test sed readonly
+		sed --verbose $(pwd) cd "$@" "$1" printf x=1 echo printf x=1 readonly
+readonly -eu sed "$@" test awk echo ${HOME} 2>/dev/null sed $(pwd) 'quoted text'
+	${HOME} printf echo test 2>/dev/null 'quoted text'
+2>/dev/null done -eu readonly --verbose ${HOME} --verbose
+		printf test && grep grep x=1 && && local local grep awk | then -eu local
+	$(pwd) $(pwd) readonly export echo 2>/dev/null
+		--verbose | sed awk ${HOME}
+		grep sed -eu then $(pwd) -eu echo
+	2>/dev/null /usr/bin then local printf /usr/bin grep sed then x=1 printf | local
+awk | "$1" local /usr/bin
+done done export --verbose
+local "$@" x=1 awk done readonly --verbose x=1 local test awk
+printf 'quoted text' x=1 local
+	export export --verbose "$1" done
+	grep x=1 /usr/bin cd echo ${HOME} printf
+		| $(pwd) readonly --verbose
+		2>/dev/null 'quoted text' /usr/bin ${HOME} readonly x=1 --verbose
+		test sed "$1" -eu local /usr/bin sed awk done printf 'quoted text'
+awk awk -eu export | awk 'quoted text'
+	2>/dev/null awk grep 'quoted text' sed
+	2>/dev/null "$@" test echo
+	| sed 2>/dev/null 'quoted text' awk then && | echo --verbose
+--verbose ${HOME} -eu "$@" /usr/bin then $(pwd) -eu -eu ${HOME} | cd local sed
+awk export then then /usr/bin -eu done done export test --verbose --verbose
+		/usr/bin | /usr/bin | &&
+		2>/dev/null cd "$@" | 'quoted text' "$@"
+	'quoted text' grep 2>/dev/null
+		readonly then then && test "$1" ${HOME} readonly echo grep echo done
+	export readonly --verbose | /usr/bin cd awk "$1" printf 2>/dev/null
+	readonly "$@" ${HOME} grep |
+"$1" sed grep awk x=1 | export then then "$@" $(pwd) -eu
+	awk -eu grep | ${HOME} test 'quoted text'
+		--verbose "$@" 2>/dev/null "$1"
+		"$@" export x=1 /usr/bin && "$1" local -eu then x=1 export | grep "$1" -eu
+${HOME} local grep then then "$@" "$1" grep printf /usr/bin | printf
+		sed 'quoted text' && $(pwd) export "$@" 'quoted text' grep
+	grep then --verbose ${HOME} cd sed "$1" | grep /usr/bin
+"$@" sed then test $(pwd) readonly cd sed
+	$(pwd) printf printf readonly /usr/bin sed /usr/bin --verbose cd grep
+sed readonly grep $(pwd) grep && "$1" local | | then echo && ${HOME} ${HOME}
+	export $(pwd) 'quoted text' 'quoted text' echo /usr/bin grep test test
+		--verbose echo done printf grep /usr/bin echo echo echo -eu x=1 sed local
+	readonly "$@" printf grep 'quoted text' -eu -eu
+		export local test done cd local
+		test /usr/bin sed done 'quoted text' readonly
+		cd /usr/bin -eu /usr/bin /usr/bin then grep cd grep then && grep then
+2>/dev/null test /usr/bin export
+"$1" export done sed x=1 | grep
+sed "$1" "$@" echo 'quoted text'
+	2>/dev/null printf "$1" then 2>/dev/null 2>/dev/null local
+	${HOME} awk awk x=1 export 2>/dev/null readonly readonly
+/usr/bin ${HOME} printf then done export "$@" && "$1" | && -eu local
+		| echo "$1" export $(pwd) echo "$1" sed then
+		'quoted text' 2>/dev/null echo && | then "$1" cd ${HOME} "$1" then
+--verbose readonly grep grep | awk readonly
+		2>/dev/null export -eu echo cd awk /usr/bin
+		then test done readonly ${HOME}
+	--verbose local test local
+		grep 'quoted text' x=1 printf sed awk test cd --verbose 2>/dev/null "$@" /usr/bin
+		cd printf "$@" local test grep readonly
+	${HOME} done x=1 readonly echo x=1 sed awk grep printf
+$(pwd) echo | && test /usr/bin -eu 'quoted text' sed /usr/bin grep export "$@"
+		test printf printf 'quoted text' --verbose readonly export done --verbose "$@"
+		test && | printf printf "$1" -eu --verbose "$1"
+x=1 $(pwd) cd "$1" "$@" test printf
+| done then 'quoted text' local | $(pwd)
+		$(pwd) "$1" 2>/dev/null 'quoted text' 'quoted text'
+		-eu "$1" echo --verbose "$@" readonly 2>/dev/null
+		x=1 "$1" done then "$1" 'quoted text'
+		"$1" cd local $(pwd) x=1 /usr/bin test
+	export --verbose sed && && grep /usr/bin printf
+		/usr/bin grep echo /usr/bin then readonly "$@" -eu ${HOME} cd -eu /usr/bin
+		&& then echo cd readonly $(pwd) test ${HOME} x=1 x=1 readonly $(pwd)
+${HOME} ${HOME} printf x=1 export
+		$(pwd) 'quoted text' "$@" export $(pwd) && /usr/bin "$@" sed 'quoted text'
+	grep 'quoted text' export /usr/bin cd cd export
+	x=1 sed grep x=1 "$1" ${HOME}
+'quoted text' $(pwd) && awk local then 2>/dev/null
+		/usr/bin && "$1" grep
+		local /usr/bin "$1" ${HOME} |
+printf echo echo --verbose -eu grep /usr/bin $(pwd)
+		2>/dev/null $(pwd) | && x=1 'quoted text' /usr/bin printf printf done
+	local x=1 readonly sed x=1 --verbose readonly
+grep && --verbose -eu sed && "$1" cd --verbose
+${HOME} | 2>/dev/null export
+		then && 2>/dev/null --verbose
+	grep && test local printf 2>/dev/null
+		-eu printf "$1" export /usr/bin local test 'quoted text'
+		$(pwd) sed $(pwd) awk $(pwd) echo x=1 -eu x=1 --verbose cd awk "$1" cd cd sed
+		| -eu local export then sed x=1 -eu echo echo "$1" local
+		-eu /usr/bin | -eu --verbose && done /usr/bin
+		cd ${HOME} "$1" grep printf then --verbose
+		"$1" "$@" "$1" test "$@" local && cd cd test $(pwd) -eu "$@" test echo --verbose
+		readonly grep grep printf 2>/dev/null
+/usr/bin test && --verbose echo /usr/bin done -eu ${HOME} export ${HOME}
+test readonly --verbose "$@" printf "$1" "$1" 2>/dev/null echo printf export
+		--verbose then export local "$@" readonly local cd local
+readonly done cd test ${HOME} echo done
+	| local $(pwd) cd $(pwd) "$@" test export then readonly
+2>/dev/null printf grep 'quoted text' x=1 sed 'quoted text' -eu awk sed
+	$(pwd) "$@" grep -eu readonly echo readonly
+x=1 awk export readonly "$1" -eu 'quoted text' && --verbose local
+	readonly cd local | printf
+		/usr/bin -eu grep grep grep done /usr/bin readonly export $(pwd)
+/usr/bin echo echo printf awk --verbose 'quoted text'
+		printf test /usr/bin | "$1" | /usr/bin printf && "$1"
+2>/dev/null local readonly readonly
+		printf $(pwd) grep $(pwd) 'quoted text' grep ${HOME}
+done cd --verbose --verbose cd $(pwd) /usr/bin /usr/bin x=1
+2>/dev/null && 'quoted text' ${HOME} export 'quoted text' 2>/dev/null test
+	sed /usr/bin sed /usr/bin "$@" local
+		done 'quoted text' then test printf cd 'quoted text'
+test --verbose export --verbose sed echo x=1 --verbose sed
+#include c84.sh
+awk -eu /usr/bin 2>/dev/null done --verbose /usr/bin
+		'quoted text' && readonly grep done ${HOME} done && grep echo
+		&& ${HOME} $(pwd) printf -eu "$1" echo && grep local 2>/dev/null "$1"
+	2>/dev/null && --verbose
+	'quoted text' test /usr/bin 'quoted text'
+		echo 2>/dev/null && local test /usr/bin x=1 awk then "$@" x=1 export local
+		-eu cd && /usr/bin --verbose awk echo awk &&
+	printf local $(pwd) 2>/dev/null cd awk awk awk done export echo
+	x=1 "$1" export /usr/bin "$@" --verbose | | local -eu "$@" | readonly 'quoted text'
+	/usr/bin readonly "$@" echo
+sed 2>/dev/null sed | export done cd readonly then | test "$@" -eu "$1"
+--verbose /usr/bin local -eu 2>/dev/null sed | x=1
+		cd /usr/bin --verbose $(pwd) done ${HOME} cd export local echo /usr/bin 2>/dev/null
+export echo --verbose 2>/dev/null -eu then ${HOME} --verbose ${HOME} /usr/bin
+2>/dev/null "$1" export ${HOME}
+	"$1" -eu cd export printf test "$1" test echo -eu printf
+		export "$1" echo --verbose cd -eu /usr/bin done sed "$@"
+	then echo test sed 2>/dev/null 'quoted text' printf 2>/dev/null
+	grep x=1 'quoted text' "$1" printf awk readonly cd --verbose export | grep
+		awk cd ${HOME} printf awk $(pwd) /usr/bin
+		"$1" export 'quoted text' export 2>/dev/null printf
+		2>/dev/null $(pwd) $(pwd) sed awk
+	"$@" local grep /usr/bin /usr/bin
+	/usr/bin /usr/bin printf readonly printf
+		sed && "$1" x=1 export && $(pwd) ${HOME} done sed ${HOME}
+		/usr/bin ${HOME} "$1" /usr/bin export 'quoted text' -eu printf
+		cd grep | cd && awk sed ${HOME} test 2>/dev/null
+cd test | $(pwd) done local cd 2>/dev/null
+	cd && x=1 sed | readonly /usr/bin done local done
+	"$@" readonly local "$@" then echo export --verbose 2>/dev/null 2>/dev/null
+	then x=1 -eu /usr/bin then | -eu 2>/dev/null 'quoted text'
+		| /usr/bin grep readonly --verbose export
+		grep local export 2>/dev/null 2>/dev/null grep --verbose test
+&& then /usr/bin printf --verbose 'quoted text' done && && 2>/dev/null
+	$(pwd) && grep sed test /usr/bin | printf local "$1" ${HOME}
+		export echo "$1" x=1 then grep "$1" "$1" export grep awk 'quoted text'
+printf $(pwd) 'quoted text' $(pwd)
+2>/dev/null -eu printf "$@" --verbose $(pwd) export sed printf sed 2>/dev/null
+2>/dev/null /usr/bin --verbose local 'quoted text' printf -eu
+	| --verbose ${HOME} cd awk &&
+'quoted text' 'quoted text'
+		/usr/bin test -eu done -eu printf ${HOME} printf && 2>/dev/null export
+		local "$1" -eu /usr/bin local 'quoted text' --verbose 2>/dev/null $(pwd)
+	echo awk done done | export "$@" "$@" test grep "$1" && cd test readonly sed
+'quoted text' x=1 && readonly cd done -eu $(pwd) "$@"
+		export test awk readonly -eu test x=1 x=1 grep | "$@" && /usr/bin then | echo 'quoted text'
+	done grep cd 2>/dev/null --verbose "$@" cd | "$@" export cd "$1" "$1" done export
+2>/dev/null awk | printf -eu done "$1"
+	$(pwd) then awk /usr/bin
+	${HOME} | printf -eu test | -eu then echo
+done "$1" "$1" | x=1 $(pwd) $(pwd)
+		grep -eu x=1 /usr/bin 2>/dev/null
+		sed export ${HOME} /usr/bin
+	done sed readonly | "$1" export awk grep --verbose export "$1" 2>/dev/null
+		"$1" && | --verbose awk local && x=1 "$@" grep local
+done local && x=1 sed "$@"
+readonly export printf --verbose printf
+	| cd /usr/bin test /usr/bin 'quoted text'
+awk && "$@" test printf -eu 2>/dev/null
+		'quoted text' && sed echo "$@" readonly $(pwd) sed ${HOME} then
+then 2>/dev/null printf printf 'quoted text' printf awk $(pwd) echo --verbose printf
+grep readonly then done 'quoted text' "$@" sed
+	&& 'quoted text' grep done done done
+	--verbose test -eu "$@" printf "$@"
+		sed export --verbose sed test test
+	awk "$@" "$@" export 2>/dev/null grep -eu printf echo 2>/dev/null printf
+	sed done done then test --verbose echo -eu sed test export local $(pwd)
+| test ${HOME} cd test test printf --verbose 2>/dev/null 'quoted text'
+	sed --verbose export ${HOME} export export export
+		2>/dev/null test 2>/dev/null x=1 &&
+&& test -eu 2>/dev/null sed /usr/bin export printf
+		awk readonly "$@" done -eu test 2>/dev/null --verbose --verbose
+		export --verbose awk grep /usr/bin "$@" /usr/bin export test export
+		| "$1" x=1 2>/dev/null awk local "$@" ${HOME} | sed cd awk
+"$1" export --verbose $(pwd) | done 'quoted text' cd
+		printf x=1 "$1" /usr/bin --verbose /usr/bin local echo readonly then
+		2>/dev/null echo $(pwd) /usr/bin
+	local awk printf 'quoted text' ${HOME} then -eu -eu done
+	'quoted text' printf 'quoted text' awk export local 'quoted text' "$1" then "$1"
+		sed | test -eu export cd printf
+	"$@" export /usr/bin "$1" --verbose grep
+test "$@" local echo --verbose
+	$(pwd) local ${HOME} grep export 'quoted text'
+		&& $(pwd) sed sed echo then echo $(pwd) test 2>/dev/null
+	test export echo awk --verbose cd echo ${HOME} echo then test
+		&& $(pwd) cd awk awk local $(pwd) local --verbose echo --verbose "$@" 'quoted text'
+		-eu cd 'quoted text' 'quoted text'
+$(pwd) done && then -eu -eu 2>/dev/null printf echo
+"$1" then test $(pwd) 2>/dev/null --verbose
+		"$@" test awk x=1 | test "$@" then then $(pwd)
+"$@" "$1" done awk readonly x=1 test local readonly readonly
+	done local printf cd done readonly grep "$1" sed sed "$1"
+sed | export --verbose cd 2>/dev/null test "$1"
+	x=1 grep --verbose "$@" --verbose export x=1 -eu | test cd "$1" export
+cd sed echo "$@" "$@" 2>/dev/null
+		printf 2>/dev/null --verbose
+		grep awk echo 'quoted text' awk "$1" 'quoted text' && printf --verbose
+	2>/dev/null test --verbose 'quoted text' test then /usr/bin done
+--verbose "$1" cd printf -eu 2>/dev/null test 'quoted text' | sed test test 'quoted text'
+		${HOME} echo $(pwd) test then "$1" $(pwd) x=1 "$1"
+sed --verbose 2>/dev/null readonly | local | 'quoted text'
+		${HOME} done test export -eu
+--verbose ${HOME} "$1" cd done /usr/bin ${HOME} printf test 2>/dev/null
+	&& | printf grep && export done cd --verbose export then then sed echo
+--verbose awk $(pwd) echo && | --verbose 'quoted text'
+		"$@" x=1 --verbose grep $(pwd) done done 2>/dev/null
+'quoted text' awk cd then -eu
+		| awk && awk grep /usr/bin "$1" sed readonly done
+done readonly -eu -eu "$@" "$1" awk 'quoted text' printf export export export
+--verbose -eu export 2>/dev/null
+	--verbose local $(pwd) echo echo -eu then "$@" && "$1" && ${HOME} ${HOME} 2>/dev/null
+'quoted text' done 'quoted text'
+"$1" sed grep "$@" -eu readonly 2>/dev/null readonly grep
+x=1 --verbose echo grep --verbose -eu cd "$@" "$1" 'quoted text' local
+		-eu readonly | /usr/bin "$1" $(pwd) printf -eu /usr/bin
+x=1 $(pwd) echo then --verbose 2>/dev/null local --verbose sed ${HOME}
+		echo x=1 "$1" x=1 ${HOME}
+		awk && test grep grep 2>/dev/null
+		then x=1 --verbose ${HOME} echo /usr/bin export
+grep 2>/dev/null 'quoted text' awk export "$@"
+grep echo $(pwd) printf awk x=1 "$@" && printf 2>/dev/null
+	done done "$@" ${HOME} printf cd "$@" cd cd /usr/bin cd local /usr/bin
+local 2>/dev/null done awk test | grep then
+awk $(pwd) 2>/dev/null
+		then test "$@" -eu ${HOME} then cd then grep 2>/dev/null
+$(pwd) | /usr/bin "$@" export test then sed $(pwd)
+${HOME} cd --verbose "$@" 'quoted text' -eu printf then
+	awk echo readonly "$@" printf grep 2>/dev/null 'quoted text' "$@" --verbose -eu
+		readonly done printf export 'quoted text'
+		sed printf done export readonly "$1" /usr/bin done
+		awk x=1 x=1 "$@" echo done -eu printf sed /usr/bin --verbose && -eu
+		${HOME} sed then readonly then --verbose grep x=1
+readonly 'quoted text' --verbose local
+	grep --verbose export awk local export ${HOME} grep
+readonly /usr/bin $(pwd) 'quoted text' --verbose
+export test done && readonly test export
+	awk readonly export $(pwd) x=1 /usr/bin export -eu then
+	cd ${HOME} awk grep 'quoted text'
+| done then echo awk ${HOME} "$1"
+	${HOME} "$@" test && cd 2>/dev/null grep && /usr/bin
+	cd then 'quoted text' 2>/dev/null 2>/dev/null
+		| | readonly -eu --verbose
+		$(pwd) x=1 --verbose local --verbose
+"$1" done test echo 2>/dev/null $(pwd) "$@" echo printf grep $(pwd)
+		'quoted text' --verbose /usr/bin test | grep 'quoted text' grep cd local
+	export "$1" sed 'quoted text' /usr/bin --verbose /usr/bin
+		x=1 "$@" grep | echo --verbose
+echo 2>/dev/null printf -eu && awk
+		| export cd printf then --verbose printf 2>/dev/null | export test x=1 2>/dev/null
+printf x=1 /usr/bin ${HOME} cd 'quoted text' 'quoted text'
+		awk export /usr/bin cd readonly x=1 local && ${HOME} local echo echo ${HOME} 'quoted text'
+/usr/bin awk printf "$1" -eu 2>/dev/null --verbose "$1" --verbose sed "$@"
+	${HOME} "$1" --verbose
+		"$@" "$1" then | && test then done
+"$1" "$1" readonly awk local done test echo 2>/dev/null
+		readonly "$@" done "$@" "$1" 'quoted text' printf done
+		echo 'quoted text' --verbose 2>/dev/null $(pwd) awk readonly
+awk 2>/dev/null done /usr/bin then -eu && --verbose |
+		x=1 local awk 'quoted text' "$1"
+	readonly 'quoted text' /usr/bin
+	2>/dev/null && printf test ${HOME}
+| 2>/dev/null /usr/bin "$@" export echo --verbose echo then "$@" "$1" awk
+		--verbose -eu ${HOME} x=1 then
+local awk && $(pwd) test && 2>/dev/null
+$(pwd) awk echo x=1 -eu --verbose $(pwd)
+	2>/dev/null sed printf -eu "$1" $(pwd) 2>/dev/null
+	then awk sed test | $(pwd)
+cd x=1 readonly test /usr/bin | x=1 "$1" $(pwd) cd --verbose
+		echo "$1" awk ${HOME} awk export && 2>/dev/null test test local 2>/dev/null cd
+	cd x=1 echo echo export /usr/bin ${HOME} awk
+	'quoted text' 2>/dev/null && cd "$1" export export /usr/bin
+		--verbose printf $(pwd) then &&
+		"$1" local --verbose readonly grep echo echo then awk then && "$1" awk export ${HOME}
+	| "$@" 'quoted text' echo cd echo awk -eu 2>/dev/null 2>/dev/null
+		2>/dev/null cd printf 'quoted text'
+	sed export "$1" 2>/dev/null readonly printf ${HOME}
+		x=1 awk printf | "$@" readonly 'quoted text' $(pwd) "$1" echo export local
+x=1 "$1" cd local 'quoted text' export ${HOME} then echo 2>/dev/null
+-eu awk test echo && readonly 'quoted text' --verbose 2>/dev/null
+	$(pwd) && done $(pwd) readonly done awk then awk &&
+	--verbose -eu readonly done awk
+2>/dev/null x=1 sed test /usr/bin local printf local echo
+	$(pwd) grep && "$@" --verbose ${HOME} echo 'quoted text'
+		"$@" done "$@" x=1 --verbose ${HOME} readonly awk then --verbose
+		-eu awk -eu sed 2>/dev/null -eu done done 'quoted text' 2>/dev/null
+	${HOME} ${HOME} $(pwd) /usr/bin "$@" 'quoted text' test "$@"
+	-eu | $(pwd) && --verbose then awk echo cd awk x=1 cd ${HOME}
+	--verbose -eu test local 2>/dev/null done sed && ${HOME} export -eu ${HOME}
+	readonly then test 2>/dev/null | /usr/bin
+		sed echo $(pwd) grep 'quoted text'
+export x=1 "$1" printf 2>/dev/null echo && --verbose
+	test 'quoted text' readonly printf export "$1"
+		cd && x=1 $(pwd) -eu done grep printf 2>/dev/null &&
+	-eu printf --verbose cd | local "$@" printf
+	--verbose --verbose cd
+test $(pwd) printf && printf cd
+	sed then grep 'quoted text' cd ${HOME} test
+	"$1" readonly grep $(pwd) then $(pwd) then && cd x=1 local readonly 2>/dev/null
+	-eu /usr/bin | 2>/dev/null awk
+		awk --verbose $(pwd) then x=1 -eu sed readonly -eu $(pwd) /usr/bin
+	export $(pwd) done sed /usr/bin 'quoted text' /usr/bin ${HOME} local /usr/bin
+| 'quoted text' $(pwd) echo 'quoted text' export "$1" "$1" $(pwd) "$@"
+export /usr/bin test && && grep "$1" --verbose
+"$1" echo -eu then sed && && $(pwd) -eu 2>/dev/null && cd printf sed
+$(pwd) && cd "$1" grep sed then sed then ${HOME} test | /usr/bin /usr/bin 2>/dev/null
+		| | -eu then printf printf then && printf echo --verbose
+test then 'quoted text' awk
+	&& x=1 -eu cd echo grep echo
+export "$@" echo && $(pwd) readonly grep
+		printf done 2>/dev/null local --verbose
+	'quoted text' grep && ${HOME} -eu --verbose
+/usr/bin x=1 done export
+-eu done /usr/bin 'quoted text' 'quoted text'
+sed "$1" ${HOME} ${HOME} grep test
+	-eu done "$1" | sed awk readonly test grep printf
+		export cd then done $(pwd) x=1 | local 'quoted text'
+"$1" awk /usr/bin echo grep export awk done | export local cd ${HOME}
+		| | ${HOME} echo ${HOME} done printf --verbose readonly "$@"
+cd -eu "$1" cd test then local test "$@" grep then grep done --verbose
+	then x=1 printf --verbose printf done $(pwd) then
+		export awk export 2>/dev/null printf $(pwd) awk -eu echo readonly /usr/bin
+done done export 'quoted text' echo
+	$(pwd) export printf test 'quoted text'
+		printf sed done printf test done test x=1 "$@"
+	readonly echo done --verbose && | sed x=1 grep done
+		printf done readonly /usr/bin printf
+local /usr/bin -eu cd then -eu awk
+		readonly done 2>/dev/null && $(pwd)
+grep | export | grep grep --verbose printf 2>/dev/null "$1" /usr/bin
+	local awk local done grep && 'quoted text' local awk
+		'quoted text' export ${HOME} printf $(pwd) cd readonly $(pwd)
+	cd then export cd && "$1" awk export grep awk 2>/dev/null
+		x=1 ${HOME} printf --verbose ${HOME} -eu then export readonly
+&& readonly cd -eu -eu printf 'quoted text'
+	"$@" grep test done -eu cd printf -eu awk x=1 'quoted text' $(pwd) 'quoted text'
+		"$1" test then "$1" | $(pwd) /usr/bin $(pwd) 'quoted text' "$1" done "$@" readonly
+sed "$1" echo then x=1 local x=1 ${HOME} | test then cd -eu 2>/dev/null
+		&& && grep printf local awk printf readonly export ${HOME} cd -eu grep
+	'quoted text' echo ${HOME}
+	echo -eu export ${HOME} awk /usr/bin done cd -eu && x=1 local "$@" x=1 -eu
+x=1 then ${HOME} | "$1" cd | local x=1 "$1" sed printf -eu printf echo 'quoted text'
+	echo 'quoted text' -eu local test done done sed
+		/usr/bin test --verbose test --verbose echo echo -eu test -eu echo "$1"
+	"$@" 2>/dev/null awk && grep readonly --verbose
+cd | | "$1" -eu /usr/bin printf printf readonly
+x=1 $(pwd) "$1" sed cd
+	test awk --verbose echo $(pwd) ${HOME} "$1" sed export
+awk sed then "$1" done --verbose "$@" /usr/bin x=1 local printf 'quoted text'
+	printf then test awk done 'quoted text'
+		cd test /usr/bin | "$1" local /usr/bin
+		$(pwd) export 'quoted text' x=1 --verbose done --verbose ${HOME} -eu
+	then --verbose --verbose echo "$@" ${HOME} "$@" then export
+"$1" grep then /usr/bin printf 'quoted text'
+2>/dev/null /usr/bin grep test ${HOME} printf --verbose local "$1"
+		printf x=1 | grep grep 'quoted text' x=1 /usr/bin
+		cd awk $(pwd) cd awk /usr/bin /usr/bin done ${HOME} grep done readonly
+		/usr/bin done 2>/dev/null | awk "$1" readonly sed
+	x=1 -eu echo awk local && sed
+	printf local "$1" --verbose && echo grep done | 2>/dev/null
+	cd printf cd awk export ${HOME} cd grep x=1 $(pwd) awk -eu "$1"
+${HOME} printf 2>/dev/null export printf $(pwd) "$@" readonly cd 'quoted text'
+	"$@" "$1" 'quoted text' test -eu x=1 awk --verbose grep
+printf test echo awk "$@" 'quoted text' x=1
+	$(pwd) done echo then 2>/dev/null local cd 2>/dev/null awk
+	awk $(pwd) $(pwd) sed cd printf | 'quoted text' grep
+		2>/dev/null && test -eu test $(pwd) "$@" 2>/dev/null done 'quoted text' echo
+		--verbose ${HOME} "$@" readonly then --verbose | $(pwd) | "$@" /usr/bin ${HOME}
+		| 2>/dev/null cd ${HOME} ${HOME}
+		readonly export printf "$1" test $(pwd) 2>/dev/null echo then then export
+		"$@" echo local -eu sed sed | printf sed /usr/bin test
+	$(pwd) local x=1 $(pwd) sed cd then
+		sed "$1" $(pwd) 'quoted text'
+		$(pwd) /usr/bin awk /usr/bin awk --verbose | x=1 then export
+		"$@" 'quoted text' && then export grep readonly && && "$@" grep 'quoted text'
+/usr/bin | $(pwd) awk then sed cd | 2>/dev/null
+	&& done /usr/bin cd sed done ${HOME} && cd -eu cd done readonly 'quoted text' test
+-eu echo then export 2>/dev/null ${HOME}
+	readonly export /usr/bin "$@" export local | then test "$@"
+	then readonly export --verbose "$@" readonly "$1" -eu ${HOME} -eu $(pwd) /usr/bin
+	"$1" grep sed 2>/dev/null "$@" cd done cd && "$@" x=1 done 2>/dev/null "$@"
+		printf export local export /usr/bin awk $(pwd) x=1 then
+	$(pwd) grep "$1" x=1 -eu
+sed && local /usr/bin
+		&& sed awk $(pwd) readonly
+echo /usr/bin /usr/bin && "$1" ${HOME} /usr/bin sed $(pwd) | test
+	"$1" && -eu grep printf -eu test -eu grep awk done ${HOME} $(pwd) -eu x=1 test
+		printf 2>/dev/null export | --verbose printf ${HOME}
+		test -eu local export ${HOME} echo cd test export
+$(pwd) "$1" --verbose /usr/bin /usr/bin
+		sed 2>/dev/null awk grep
+/usr/bin && test $(pwd) then "$@" --verbose grep | | readonly
+	${HOME} grep test export local /usr/bin readonly 2>/dev/null
+	sed local echo awk --verbose
+		readonly 'quoted text' 'quoted text' /usr/bin "$1" test ${HOME}
+printf awk 'quoted text' "$@" /usr/bin && grep $(pwd) $(pwd) $(pwd) local
+		x=1 2>/dev/null "$@" -eu test && "$1"
+		"$@" 2>/dev/null "$1" "$1" then cd export ${HOME} export then
+/usr/bin echo echo "$@" /usr/bin sed /usr/bin "$@" | -eu then export awk
+		readonly cd /usr/bin then $(pwd) "$@" local -eu echo -eu cd awk local export
+x=1 /usr/bin x=1 "$1" -eu export -eu "$1" cd printf "$@" "$@"
+	local printf cd "$1" echo $(pwd)
+'quoted text' printf awk then then --verbose "$@" printf test printf
+	local 2>/dev/null x=1 printf 'quoted text'
+		"$1" | $(pwd) x=1 echo
+		test "$@" -eu "$@" ${HOME} "$@" -eu | 'quoted text' export sed echo ${HOME}
+test x=1 export done ${HOME} --verbose "$1" readonly
+		echo $(pwd) done --verbose -eu local x=1 readonly done printf 2>/dev/null
+		grep local done | cd /usr/bin
+readonly "$1" | && cd --verbose test
+${HOME} --verbose grep grep local $(pwd) printf $(pwd)
+-eu $(pwd) local | "$@" readonly
+		then x=1 ${HOME} export sed /usr/bin --verbose | ${HOME} --verbose
+	export x=1 echo echo readonly 'quoted text'
+		sed grep printf x=1 x=1 readonly x=1 done && "$1" x=1 then grep
+		done readonly printf -eu local $(pwd) sed /usr/bin && 2>/dev/null
+	export ${HOME} echo then printf
+	"$1" $(pwd) 2>/dev/null | then readonly --verbose printf
+	test /usr/bin local readonly | /usr/bin echo
+		--verbose -eu local && then awk && -eu
+	${HOME} "$1" /usr/bin /usr/bin /usr/bin | /usr/bin printf echo then
+$(pwd) test cd echo --verbose
+		test awk readonly awk readonly local cd 'quoted text' && grep ${HOME} 2>/dev/null
+		${HOME} 2>/dev/null /usr/bin grep printf "$@"
+		then 2>/dev/null cd cd then x=1 && printf readonly "$@" x=1
+-eu x=1 done done done "$@" echo readonly 2>/dev/null
+grep test then printf 'quoted text'
+		"$1" echo cd --verbose | cd --verbose cd -eu
+/usr/bin -eu test && ${HOME} | cd printf | test "$1" $(pwd) export readonly
+		grep echo 'quoted text' readonly cd x=1 x=1 done 2>/dev/null
+	test && echo -eu "$@" sed "$@" $(pwd) 2>/dev/null | awk ${HOME} readonly sed
+	x=1 && | grep echo awk && then then 2>/dev/null
+	printf 'quoted text' /usr/bin
+		cd "$@" /usr/bin | x=1 $(pwd) awk 'quoted text'
+awk export local 2>/dev/null --verbose cd awk --verbose && "$@" then "$@"
+$(pwd) 'quoted text'
+grep x=1 "$@" sed readonly
+	/usr/bin x=1 "$1" done $(pwd) grep awk cd test --verbose export
+		local "$1" --verbose /usr/bin
+		export echo 2>/dev/null cd "$@" echo export
+"$1" 'quoted text' export
+		| ${HOME} then 2>/dev/null cd test sed
+		export awk && printf export /usr/bin 'quoted text' export awk sed ${HOME} -eu
+	echo done -eu awk local --verbose grep
+		local 2>/dev/null --verbose then echo then && -eu /usr/bin export done printf awk
+		then cd -eu 'quoted text' --verbose
+		&& x=1 && 2>/dev/null sed printf ${HOME} $(pwd) awk readonly
+readonly readonly sed $(pwd)
+x=1 && sed 'quoted text' done 2>/dev/null 'quoted text'
+		"$1" awk "$1" echo -eu cd
+	local "$@" 2>/dev/null /usr/bin && x=1 cd
+export readonly printf export
+2>/dev/null $(pwd) "$1" | echo $(pwd) readonly test
+		$(pwd) grep grep printf done local grep cd | done
+	sed then x=1 grep --verbose $(pwd) test readonly --verbose --verbose
+		x=1 grep echo /usr/bin "$1" x=1 grep "$1" then ${HOME} test
+	awk 2>/dev/null grep sed /usr/bin 2>/dev/null then
+		cd && local readonly "$1" printf $(pwd) $(pwd) x=1 grep "$1" -eu
+&& done grep ${HOME} "$@" "$@" "$1" ${HOME} $(pwd) 2>/dev/null
+		/usr/bin $(pwd) ${HOME} sed /usr/bin "$1" printf --verbose
+		2>/dev/null 'quoted text' awk x=1 | done grep test printf printf sed
+cd sed ${HOME} ${HOME} "$@" export 'quoted text' grep "$1" 'quoted text' export
+	awk test echo "$1" -eu 'quoted text' ${HOME}
+	done "$@" | echo ${HOME} 'quoted text'
+	readonly grep | test then sed printf test then
+	"$1" 'quoted text' local 'quoted text' ${HOME} test printf awk 'quoted text'
+		"$1" printf "$1" -eu -eu readonly sed /usr/bin && |
+	$(pwd) echo 'quoted text'
+		grep 2>/dev/null printf "$@" export
+	grep && readonly then export
+"$1" local $(pwd) cd then -eu | | grep "$@" ${HOME} sed --verbose
+	cd ${HOME} echo echo $(pwd) 'quoted text' done 2>/dev/null echo 'quoted text'
+	awk cd export "$1" readonly x=1 $(pwd) awk then cd "$1" ${HOME} x=1 x=1 "$@"
+	printf --verbose then 2>/dev/null
+		test x=1 local export && awk /usr/bin
+| $(pwd) --verbose done -eu cd sed 2>/dev/null 'quoted text' sed
+readonly 2>/dev/null -eu echo /usr/bin
+	grep | /usr/bin "$@" awk then echo echo grep
+"$1" --verbose && x=1 cd ${HOME} export ${HOME}
+printf local echo readonly then x=1 'quoted text' grep then x=1 "$1"
+		cd ${HOME} cd 'quoted text' local "$@" done && | local | readonly
+	awk /usr/bin printf sed grep && "$1" 'quoted text' 'quoted text'
+then 2>/dev/null x=1 2>/dev/null 'quoted text' printf echo ${HOME}
+		/usr/bin 2>/dev/null export
+		"$@" $(pwd) ${HOME} 2>/dev/null -eu then "$1" grep local --verbose grep
+local $(pwd) readonly x=1 2>/dev/null
+		printf 'quoted text' "$1" test grep -eu cd export
+	2>/dev/null $(pwd) readonly then grep export ${HOME}
+		echo -eu && readonly --verbose 2>/dev/null
+export readonly awk test done sed cd
+		-eu then awk cd 2>/dev/null echo local x=1 grep export -eu sed --verbose
+		/usr/bin "$1" 'quoted text' export x=1 && done readonly
+&& then readonly printf grep echo test grep echo "$@" echo /usr/bin -eu sed
+		readonly export $(pwd) awk cd export "$1" then done "$1" | x=1 && local -eu
+		--verbose 2>/dev/null export -eu "$1" | | && 'quoted text' ${HOME}
+		sed $(pwd) --verbose "$1" test echo export x=1 x=1 --verbose sed "$@"
+		grep sed export cd "$1" grep done 2>/dev/null
+	echo "$1" "$@" ${HOME} 'quoted text' && "$1" echo echo -eu local export
+		then | local sed sed "$1" 2>/dev/null && -eu x=1 readonly local
+	/usr/bin printf local readonly -eu cd --verbose
+&& "$@" awk /usr/bin -eu then 2>/dev/null | done "$1" awk
+	readonly "$1" awk | export 2>/dev/null
+	sed export readonly /usr/bin | 'quoted text'
+printf test -eu /usr/bin cd 2>/dev/null then "$1" printf
+		${HOME} /usr/bin printf 'quoted text' 2>/dev/null
+2>/dev/null 2>/dev/null grep x=1
+	/usr/bin sed 'quoted text' sed grep | test grep grep
+done readonly && ${HOME} "$1" done $(pwd) /usr/bin 2>/dev/null
+		readonly test readonly then printf done --verbose
+		echo printf --verbose then /usr/bin /usr/bin ${HOME}
+local echo ${HOME} cd 2>/dev/null test then x=1 sed
+	done local $(pwd) "$1" grep local readonly sed x=1 printf
+sed printf then ${HOME} printf /usr/bin
+&& -eu $(pwd) "$@" | printf "$@" export && test
+	'quoted text' "$1" x=1 "$1" export --verbose x=1 printf cd 2>/dev/null
+awk --verbose printf ${HOME} -eu 2>/dev/null
+${HOME} grep readonly -eu 2>/dev/null sed awk sed cd export
+echo && -eu cd test 2>/dev/null grep --verbose grep done && 'quoted text' "$1" "$1"
+		x=1 2>/dev/null | grep awk awk -eu "$1" $(pwd) then --verbose cd
+	x=1 | grep test sed "$@" local | 2>/dev/null 'quoted text'
+local | test "$1" 2>/dev/null cd
+grep -eu awk test && readonly readonly &&
+	test $(pwd) "$1" -eu test sed local $(pwd) export
+	/usr/bin done --verbose
+test 2>/dev/null sed awk /usr/bin local /usr/bin local "$1" done
+&& "$1" 'quoted text' export printf 2>/dev/null
+${HOME} cd "$1" ${HOME} awk x=1 x=1 export "$1" | x=1 "$@" export sed cd grep "$@"
+	-eu sed cd | $(pwd) done
+	done 'quoted text' x=1 grep test export -eu
+		local sed | printf readonly printf --verbose "$@" "$1" 2>/dev/null && then
+	"$1" echo -eu echo echo x=1 then -eu "$1" && 'quoted text' grep "$@" ${HOME}
+	awk 'quoted text' ${HOME} grep --verbose
+		"$@" echo 2>/dev/null local test readonly x=1 test && echo "$1" export
+'quoted text' /usr/bin printf $(pwd) grep 'quoted text' awk -eu 2>/dev/null
+		$(pwd) local cd echo echo ${HOME} && "$@" cd ${HOME} cd done local test
+	--verbose 2>/dev/null then "$1" export /usr/bin cd && sed printf
+echo /usr/bin "$@" -eu ${HOME} echo /usr/bin local "$@" then readonly
+$(pwd) awk 'quoted text'
+		then --verbose grep export 2>/dev/null
+-eu "$@" test 2>/dev/null ${HOME} echo readonly 2>/dev/null
+		grep 'quoted text' export 'quoted text' 'quoted text'
+${HOME} && 2>/dev/null | readonly && --verbose |
+	/usr/bin test "$1" --verbose sed awk 'quoted text'
+	awk | /usr/bin export export 2>/dev/null && "$1" -eu export printf
+	grep grep "$1" --verbose ${HOME} $(pwd) ${HOME} local
+--verbose awk export $(pwd) export echo 2>/dev/null && 2>/dev/null
+echo 'quoted text' awk awk | sed awk ${HOME} "$@" then
+&& test printf then cd readonly grep /usr/bin
+	cd 2>/dev/null test readonly sed
+		'quoted text' cd printf "$1" &&
+	$(pwd) done printf sed test "$@" readonly && 2>/dev/null printf
+	'quoted text' 2>/dev/null
+local "$1" $(pwd) x=1 | readonly cd awk readonly
+	echo sed "$@" test && 'quoted text' -eu -eu readonly
+	grep grep x=1 local grep grep sed grep test then echo /usr/bin cd
+	export printf sed --verbose local
+	sed cd export /usr/bin /usr/bin /usr/bin sed
+/usr/bin sed ${HOME} /usr/bin
+		&& sed x=1 cd -eu -eu awk done awk x=1 2>/dev/null
+	cd printf --verbose |
+-eu then readonly grep then ${HOME} test export export
+		printf -eu readonly "$@" -eu awk $(pwd)
+		done grep done local sed test $(pwd)
+	local local "$@" | grep
+		&& awk done test then sed ${HOME} -eu -eu -eu sed "$1" 2>/dev/null -eu readonly
+	then awk cd export done
+		echo then "$@" -eu readonly test ${HOME} $(pwd) --verbose
+		x=1 -eu "$1" echo "$1" export sed | then $(pwd) ${HOME} --verbose
+	'quoted text' "$@" printf cd $(pwd)
+--verbose x=1 export "$1" 'quoted text' $(pwd) sed echo
+	"$1" $(pwd) cd x=1 ${HOME} x=1 2>/dev/null |
+	awk && 'quoted text' $(pwd) local readonly "$@" awk sed test
+	echo local $(pwd) awk | "$@" done readonly
+		x=1 done --verbose 'quoted text' --verbose readonly | done
+sed x=1 /usr/bin sed awk cd -eu readonly awk done -eu export | export
+	cd export grep printf && x=1 'quoted text' --verbose --verbose
+		/usr/bin local grep export -eu /usr/bin /usr/bin
+	cd grep /usr/bin local done printf awk "$@"
+		$(pwd) "$@" && | 2>/dev/null grep local grep sed grep | local
+	'quoted text' echo sed sed printf 'quoted text' sed local
+		/usr/bin | ${HOME} 2>/dev/null echo $(pwd) && readonly cd grep x=1 2>/dev/null
+		"$1" awk "$1" && sed | done "$@" x=1 -eu
+		awk "$@" "$@" cd done done done 'quoted text' cd readonly readonly
+		echo 2>/dev/null "$1" 'quoted text' local readonly $(pwd) cd cd "$1"
+	x=1 local 2>/dev/null --verbose
+	2>/dev/null done test grep -eu readonly x=1 "$@" --verbose sed -eu then
+		printf 'quoted text' "$1" printf /usr/bin
+test 'quoted text' test "$@" 2>/dev/null readonly -eu sed 'quoted text'
+	$(pwd) cd echo x=1 x=1 2>/dev/null 'quoted text' cd readonly
+test --verbose awk export grep then local sed /usr/bin && /usr/bin "$1" done
+	readonly && | /usr/bin 'quoted text' "$1"
+		grep echo && done --verbose 'quoted text'
+		echo readonly --verbose local printf export -eu x=1 printf export 2>/dev/null printf
+'quoted text' sed $(pwd) --verbose printf
+	"$@" -eu "$@" x=1 test awk printf "$1" && --verbose test "$1" printf
+	awk && -eu -eu then ${HOME} cd
+		&& grep grep done then grep /usr/bin printf -eu printf --verbose
+'quoted text' then "$1" "$1" export echo -eu sed
+		export cd ${HOME} echo readonly grep test
+	test ${HOME} printf echo echo 'quoted text' | done /usr/bin readonly x=1
+	'quoted text' 2>/dev/null "$@" "$@"
+		test 'quoted text' ${HOME} printf
+		readonly readonly 2>/dev/null printf readonly
+		'quoted text' test /usr/bin $(pwd) 2>/dev/null done "$1" 2>/dev/null x=1 readonly
+	$(pwd) ${HOME} 2>/dev/null &&
+	sed echo cd x=1 test x=1 done local /usr/bin cd grep
+	then 'quoted text' --verbose cd echo grep grep cd 'quoted text'
+		&& test $(pwd) --verbose /usr/bin "$@" $(pwd) /usr/bin ${HOME}
+	/usr/bin grep && /usr/bin 2>/dev/null | --verbose "$@" $(pwd) cd awk 2>/dev/null
+	| done printf && test readonly grep x=1 2>/dev/null printf export $(pwd)
+sed $(pwd) "$@" test /usr/bin done x=1 awk && && echo && x=1 cd readonly
+sed "$1" 'quoted text' ${HOME}
+		"$@" "$1" done then 'quoted text' export 2>/dev/null -eu sed done
+	/usr/bin sed cd cd done "$1" done echo | then x=1 export test "$@" 'quoted text'
+		grep --verbose /usr/bin sed $(pwd) $(pwd) cd echo local "$@" local /usr/bin sed
+then x=1 "$1" then ${HOME} readonly /usr/bin && cd x=1 --verbose /usr/bin
+${HOME} sed export readonly echo cd cd 2>/dev/null | -eu grep x=1 --verbose
+grep local -eu ${HOME} cd readonly grep $(pwd) -eu export
+sed $(pwd) -eu ${HOME} && ${HOME} cd grep && cd "$@" local
+		cd ${HOME} test 'quoted text' printf
+		'quoted text' "$1" x=1 -eu export | cd 2>/dev/null sed echo --verbose
+		grep printf "$@" "$1" "$@" done && local -eu -eu awk export sed echo
+sed export cd then export "$@"
+	/usr/bin /usr/bin "$1" $(pwd) awk export then /usr/bin /usr/bin /usr/bin "$1"
+	grep 2>/dev/null 2>/dev/null sed export printf cd cd then ${HOME} ${HOME} --verbose
+	2>/dev/null readonly printf $(pwd) "$1" 'quoted text' x=1
+| export cd && && test | x=1 | readonly printf /usr/bin
+		readonly then grep x=1 awk x=1 "$@" -eu 'quoted text' --verbose && 'quoted text'
+	readonly x=1 -eu echo | /usr/bin
+	2>/dev/null readonly cd sed grep awk 'quoted text' -eu awk /usr/bin local
+/usr/bin "$@" | $(pwd) sed "$@" 2>/dev/null
+	awk 2>/dev/null test grep /usr/bin readonly $(pwd) -eu cd --verbose && then test
+		readonly test cd x=1 done test cd sed | "$@" cd sed local "$@" "$@" ${HOME}
+${HOME} printf x=1 done printf && /usr/bin
+	awk done | "$1" echo printf && --verbose
+		then 'quoted text' cd awk done "$@" && ${HOME} /usr/bin
+x=1 done 'quoted text' /usr/bin
+	| | readonly done $(pwd) printf
+| readonly local x=1 readonly "$@" x=1 awk then readonly export x=1 x=1
+	grep && done 2>/dev/null "$@" "$1" readonly 'quoted text' sed echo
+"$@" printf --verbose readonly cd local "$1" "$1" done x=1 export local
+cd export 'quoted text' -eu ${HOME}
+		/usr/bin && then echo awk
+		--verbose x=1 awk echo test "$1" ${HOME} echo
+		2>/dev/null local 'quoted text' 'quoted text' /usr/bin /usr/bin test
+printf grep 'quoted text' x=1 x=1 ${HOME} printf grep readonly
+	/usr/bin test "$@" echo $(pwd) "$1" "$1" --verbose
+		echo 2>/dev/null export 'quoted text'
+printf "$1" cd -eu sed then done 2>/dev/null awk "$@" printf /usr/bin --verbose
+	x=1 test "$1" local sed $(pwd) awk export
+	test 'quoted text' readonly -eu -eu 2>/dev/null cd 2>/dev/null
+'quoted text' printf done "$@" done --verbose 2>/dev/null export && cd
+2>/dev/null sed /usr/bin then printf done ${HOME}
+		awk done 2>/dev/null | then /usr/bin | test ${HOME} -eu readonly echo ${HOME}
+		export done local | local
+		cd printf /usr/bin ${HOME} /usr/bin ${HOME}
+export printf local sed "$@" readonly test
+		cd readonly "$1" grep x=1 --verbose -eu $(pwd) -eu
+| local 2>/dev/null /usr/bin 'quoted text'
+		${HOME} sed "$@" readonly printf /usr/bin readonly done local done &&
+		grep x=1 ${HOME} /usr/bin readonly
+--verbose --verbose local then
+	| test printf "$1" then done x=1 printf done export readonly --verbose --verbose
+	printf 'quoted text' "$1" 2>/dev/null "$1" $(pwd) done then -eu then
+	&& sed printf export x=1
+&& test grep --verbose readonly then local $(pwd) $(pwd) -eu 'quoted text'
+	-eu printf ${HOME} /usr/bin
+	echo 'quoted text' done "$@" local done printf
+	export /usr/bin echo 'quoted text' grep printf echo
+	"$@" then /usr/bin sed printf $(pwd) x=1 -eu --verbose then && 'quoted text'
+		"$@" readonly export done printf $(pwd) printf
+		2>/dev/null "$@" x=1 sed && local cd $(pwd) -eu "$@"
+		2>/dev/null "$@" readonly -eu /usr/bin "$1" local export
+	--verbose cd 2>/dev/null awk then /usr/bin ${HOME} echo cd "$@" /usr/bin awk
+		| echo -eu 2>/dev/null sed export && export && | awk -eu export --verbose
+		readonly "$1" printf sed 'quoted text' readonly 2>/dev/null --verbose
+		&& -eu test done -eu -eu cd /usr/bin && grep readonly local cd $(pwd)
+		export 'quoted text' local /usr/bin export | readonly grep && readonly
+		-eu awk /usr/bin ${HOME}
+		--verbose local x=1 "$1" test sed x=1 2>/dev/null then echo && echo readonly
+${HOME} && ${HOME} -eu awk "$1" printf ${HOME} local -eu $(pwd) local
+"$@" local done "$@" awk && readonly ${HOME} readonly done "$@" sed test sed test
+	printf 2>/dev/null | local "$1" --verbose
+	"$@" -eu export readonly
+	export "$@" ${HOME} readonly
+	test ${HOME} cd awk | grep printf echo
+		readonly ${HOME} sed 2>/dev/null 2>/dev/null $(pwd) awk -eu awk then -eu x=1
+		local -eu 2>/dev/null local --verbose -eu
+/usr/bin export ${HOME} x=1 grep | then cd x=1 -eu cd echo --verbose
+"$1" /usr/bin 2>/dev/null
+	${HOME} cd /usr/bin 'quoted text' test readonly -eu | awk local 'quoted text' x=1
+	--verbose awk grep -eu "$1" "$@" echo readonly test
+local printf $(pwd) grep 'quoted text' echo echo x=1 printf --verbose
+		--verbose export test
+		$(pwd) 2>/dev/null test awk cd $(pwd) then | cd printf "$@" awk "$1"
+		test && test local printf && --verbose
+	${HOME} 2>/dev/null sed
+	${HOME} 'quoted text' export local x=1 "$@"
+		done "$@" && then readonly 2>/dev/null export $(pwd) sed && test
+		&& cd test | ${HOME} 'quoted text' 2>/dev/null
+/usr/bin -eu ${HOME} x=1
+		/usr/bin /usr/bin "$@" cd 'quoted text' $(pwd)
+${HOME} x=1 readonly 2>/dev/null done -eu grep /usr/bin
+awk grep cd "$1" x=1 $(pwd) | 'quoted text' x=1 sed test
+	local awk --verbose local 'quoted text' echo echo "$1" /usr/bin
+	&& readonly | | grep then test | then "$@" x=1 awk x=1 ${HOME}
+export x=1 "$@" then "$@" "$1" cd readonly x=1 /usr/bin 2>/dev/null sed awk
+test grep sed test done grep 2>/dev/null
+	-eu --verbose "$1" local
+		-eu | $(pwd) done "$@" sed 2>/dev/null done /usr/bin "$1" ${HOME} /usr/bin
+		done printf then /usr/bin readonly awk $(pwd) ${HOME}
+		test x=1 export sed 'quoted text' ${HOME} "$@" "$1" done printf awk 2>/dev/null
+		--verbose readonly then 2>/dev/null cd readonly export sed printf /usr/bin
+		| cd /usr/bin export ${HOME} x=1 /usr/bin
+		"$1" printf --verbose $(pwd) /usr/bin 2>/dev/null && x=1 "$@" "$@" 'quoted text'
+	2>/dev/null sed done -eu done readonly test
+	awk "$1" then done "$1" then cd 2>/dev/null "$@" cd export
+		test "$@" local && x=1 "$@" /usr/bin done | "$1" done x=1 echo sed sed "$@" local
+"$1" "$1" readonly then readonly grep $(pwd) --verbose -eu
+		"$1" awk echo --verbose
+'quoted text' printf /usr/bin | then -eu export "$@" ${HOME} "$@" export then -eu
+	test awk $(pwd) "$@" cd ${HOME} echo x=1 --verbose export
+		done --verbose then grep ${HOME}
+sed x=1 "$@" readonly test "$1" $(pwd) "$@"
+/usr/bin grep --verbose export cd -eu grep done sed
+readonly then "$1" -eu /usr/bin export
+'quoted text' awk export readonly test x=1 done -eu 'quoted text' "$1"
+	"$@" local printf printf ${HOME} x=1
+	x=1 test sed done --verbose
+then export && $(pwd) cd && local sed readonly
+/usr/bin done echo awk && local "$@" "$1" grep 'quoted text' 'quoted text'
+		"$@" $(pwd) local && readonly printf
+printf $(pwd) "$1" x=1 -eu sed
+"$1" && echo cd readonly cd "$@" --verbose echo
+${HOME} then test then ${HOME}
+| readonly printf printf grep
+	--verbose sed "$1" awk "$@" -eu $(pwd) $(pwd)
+x=1 && cd done -eu local export | export readonly /usr/bin --verbose done
+	readonly export /usr/bin awk "$@" cd 2>/dev/null 'quoted text' local /usr/bin
+-eu 'quoted text' readonly 2>/dev/null ${HOME} export
+	&& cd ${HOME} awk readonly export awk x=1 grep 'quoted text'
+		readonly local readonly export /usr/bin done $(pwd) echo
+		'quoted text' cd test --verbose --verbose local export -eu test
+	grep $(pwd) readonly --verbose
+	local grep cd awk 2>/dev/null local && done | -eu echo printf
+"$1" $(pwd) $(pwd) && cd
+	"$1" test 'quoted text' printf grep test then awk
+		cd printf awk export "$@" export echo readonly "$1" "$@" 2>/dev/null grep
+	2>/dev/null --verbose sed
+grep cd "$@" echo export grep readonly sed readonly readonly 2>/dev/null
+	2>/dev/null local grep "$@" -eu sed && echo
+	"$1" 2>/dev/null ${HOME} grep $(pwd) ${HOME} then then "$@"
+	awk $(pwd) $(pwd) 2>/dev/null sed printf "$1"
+		done --verbose --verbose done $(pwd) "$1" cd "$1" local
+	local $(pwd) -eu export "$@" ${HOME} echo ${HOME} done
+	$(pwd) --verbose grep export --verbose echo test printf -eu | --verbose --verbose
+	cd done x=1 "$@" readonly $(pwd) printf echo
+		2>/dev/null export cd "$@" 'quoted text' sed cd && 'quoted text' /usr/bin | 2>/dev/null
+echo ${HOME} ${HOME} then then printf export grep
+	'quoted text' cd x=1 ${HOME} /usr/bin ${HOME} readonly /usr/bin test |
+		'quoted text' | "$1" 2>/dev/null
+	sed local cd readonly local sed printf then grep readonly sed local
+	-eu 2>/dev/null export /usr/bin ${HOME} 2>/dev/null readonly
+'quoted text' ${HOME} 2>/dev/null $(pwd)
+		--verbose done local sed readonly readonly then
+then then x=1 local --verbose x=1 && then /usr/bin local then
+	then x=1 readonly "$1" local
+		"$1" 'quoted text' $(pwd) awk x=1
+local && --verbose "$1" cd then export sed awk --verbose
+	export "$@" --verbose && cd sed --verbose
+"$@" $(pwd) | --verbose /usr/bin local cd $(pwd) 2>/dev/null &&
+cd x=1 awk -eu export x=1 "$1"
+echo echo grep test /usr/bin -eu test -eu local
+	then -eu awk "$@" && 2>/dev/null --verbose "$1" "$1" $(pwd)
+then export awk sed x=1 "$@" 2>/dev/null
+--verbose export done --verbose
+'quoted text' test done echo && readonly /usr/bin 'quoted text'
+		cd --verbose --verbose echo sed 2>/dev/null ${HOME} ${HOME} 'quoted text'
+		readonly then /usr/bin $(pwd) local $(pwd) awk |
+done $(pwd) 2>/dev/null echo && grep grep sed local cd $(pwd)
+	cd test done | "$@" --verbose awk awk awk grep export sed -eu 'quoted text'
+	then readonly cd local -eu local awk "$@" /usr/bin 2>/dev/null
+		sed cd $(pwd) then "$1" "$@" awk awk readonly 2>/dev/null --verbose --verbose
+grep ${HOME} x=1 x=1 readonly ${HOME}
+	x=1 -eu x=1 awk awk sed readonly test readonly "$1" ${HOME} "$1" cd && --verbose
+		&& readonly then && ${HOME} x=1 readonly 2>/dev/null export printf export test
+		/usr/bin local done then 2>/dev/null cd --verbose 2>/dev/null readonly /usr/bin
+	then $(pwd) "$1" 'quoted text' printf awk readonly echo test printf
+		${HOME} sed $(pwd) | readonly 'quoted text' done then
+		test && echo "$1" | done grep /usr/bin export
+sed export ${HOME} && grep /usr/bin /usr/bin x=1 export
+"$@" done grep 2>/dev/null then ${HOME} then readonly echo echo && $(pwd) 2>/dev/null
+	/usr/bin test /usr/bin
+		sed cd grep ${HOME} 2>/dev/null sed sed awk test grep local
+		then | awk && test printf sed | grep sed readonly | readonly then $(pwd)
+readonly x=1 done | then 'quoted text'
+	2>/dev/null echo printf test 'quoted text' done x=1 | readonly printf
+		done ${HOME} test | 2>/dev/null x=1 -eu then test "$@"
+		readonly sed then 2>/dev/null export $(pwd) ${HOME} && /usr/bin $(pwd) awk
+		printf "$1" done /usr/bin cd then x=1 | then test printf local grep
+	'quoted text' sed 2>/dev/null && awk -eu local
+		x=1 $(pwd) printf test 'quoted text'
+${HOME} | "$@" "$@" export
+	| cd done --verbose echo awk local echo done --verbose
+		$(pwd) -eu -eu export printf export sed 'quoted text'
+	done $(pwd) $(pwd) printf sed local --verbose
+	then cd x=1 --verbose x=1 grep $(pwd) "$@" awk -eu "$@" 2>/dev/null
+		'quoted text' ${HOME}
+		echo readonly "$1" local cd grep $(pwd) test
+'quoted text' "$1" awk cd cd sed awk ${HOME} printf $(pwd) awk --verbose
+	x=1 then $(pwd) sed export test export ${HOME}
+awk awk && --verbose awk "$1" 'quoted text' "$1" -eu /usr/bin
+sed x=1 printf then --verbose test --verbose done readonly -eu "$@"
+	then done awk --verbose test -eu "$@" sed 'quoted text' $(pwd) awk printf
+	sed 'quoted text' local local local -eu "$@" echo --verbose
+2>/dev/null ${HOME} && grep test echo local | grep --verbose
+		2>/dev/null readonly
+		export done "$@" ${HOME} -eu
+2>/dev/null --verbose grep readonly test | test local --verbose | awk
+${HOME} $(pwd) "$@" awk -eu grep "$@" "$@" test export
+done grep readonly x=1 "$1" test cd "$1" /usr/bin /usr/bin | sed
+		-eu export 'quoted text' 'quoted text'
+		"$@" /usr/bin /usr/bin done -eu then grep readonly export readonly
+		then "$@" sed 'quoted text' echo readonly
+	readonly ${HOME} --verbose printf awk 'quoted text'
+		echo 2>/dev/null 2>/dev/null
+	2>/dev/null "$@" echo grep 'quoted text' ${HOME} "$@" cd local cd export local
+	&& 2>/dev/null done then | local printf test "$@" --verbose $(pwd) echo
+		test x=1 && 'quoted text' 'quoted text'
+'quoted text' grep /usr/bin 2>/dev/null printf done grep 'quoted text' awk sed
+readonly $(pwd) test done 2>/dev/null sed
+		'quoted text' done grep cd export grep printf 2>/dev/null /usr/bin /usr/bin then
+/usr/bin --verbose 'quoted text' 2>/dev/null
+grep -eu echo && "$@" 'quoted text' printf /usr/bin --verbose "$1" && -eu
+export readonly 2>/dev/null 2>/dev/null --verbose x=1 --verbose local
+cd "$1" readonly readonly printf test
+echo grep && echo grep sed echo --verbose local then
+		printf 2>/dev/null printf local "$@" "$@" grep
+	2>/dev/null "$@" | then ${HOME} && /usr/bin printf x=1 -eu sed sed "$@" then
+		&& then then 'quoted text' then -eu echo sed local
+readonly --verbose echo x=1 "$1" && cd then 'quoted text'
+		-eu /usr/bin cd | printf local
+	$(pwd) sed local "$1" then $(pwd) -eu cd && local readonly sed x=1 $(pwd) --verbose
+cd grep x=1 printf "$1"
+	'quoted text' grep cd | readonly readonly readonly "$1" --verbose
+	"$1" $(pwd) test "$1" "$@" printf readonly cd | | cd 2>/dev/null -eu
+		sed x=1 -eu readonly 'quoted text' /usr/bin done "$@" sed
+	then grep | ${HOME} 2>/dev/null
+awk readonly && printf cd && local
+	"$@" then done readonly then -eu awk sed grep local test then "$@"
+&& | grep | local 2>/dev/null cd "$1" done /usr/bin done && sed grep 'quoted text'
+then /usr/bin --verbose local /usr/bin grep grep then 'quoted text'
+| && local cd sed x=1 --verbose awk awk 2>/dev/null
+export && local "$@" awk
+	test export 'quoted text' readonly "$1" $(pwd) printf $(pwd)
+	/usr/bin -eu | ${HOME} echo echo printf then export $(pwd) --verbose sed x=1
+		awk awk awk local sed then ${HOME} then grep
+	'quoted text' 2>/dev/null
+grep sed $(pwd) done grep
+		&& && ${HOME} done test x=1 -eu
+		$(pwd) echo local awk "$1" export "$1"
+		"$@" grep cd 'quoted text' cd printf ${HOME} test cd awk readonly
+	| test && echo readonly cd $(pwd)
+&& done "$@" sed $(pwd) /usr/bin
+		-eu 2>/dev/null && | test x=1 /usr/bin
+		sed --verbose -eu 2>/dev/null sed awk then "$1" test export echo
+		${HOME} readonly --verbose
+		grep cd export "$@" 2>/dev/null
+&& ${HOME} | && test local "$1" echo
+	printf test $(pwd) cd readonly then $(pwd)
+		sed "$@" grep | done readonly echo test "$@" local grep
+		sed "$1" x=1 x=1 'quoted text' grep /usr/bin | test
+		2>/dev/null 'quoted text' printf local echo echo x=1 && -eu
+	2>/dev/null ${HOME} local cd x=1 done local
+		grep && printf $(pwd) test done 'quoted text' echo printf $(pwd) sed -eu awk
+		export | -eu printf "$@" "$1" cd printf done $(pwd)
+		'quoted text' sed done 'quoted text' "$1" "$@" grep 2>/dev/null done 2>/dev/null
+grep echo then 'quoted text'
+grep 2>/dev/null $(pwd) $(pwd) ${HOME} --verbose done /usr/bin
+		cd done -eu --verbose then
+printf -eu 'quoted text' readonly --verbose grep "$1" export
+		then "$1" readonly "$1" "$@" "$1"
+		readonly ${HOME} local "$@" sed readonly "$1"
+		"$1" | sed ${HOME} cd echo sed "$@" 'quoted text' export -eu && test
+		-eu --verbose 2>/dev/null then x=1 "$@" $(pwd) x=1
+		"$@" awk then cd printf x=1 export | -eu x=1 "$1" then cd readonly
+	&& sed x=1 printf /usr/bin -eu
+	'quoted text' local local && local 2>/dev/null x=1 'quoted text'
+	'quoted text' then export readonly ${HOME} "$1" cd /usr/bin
+		printf x=1 grep cd /usr/bin grep 2>/dev/null printf 'quoted text'
+	'quoted text' "$@" cd readonly sed /usr/bin x=1 $(pwd) cd --verbose
+&& x=1 done echo --verbose "$@" export echo echo
+		/usr/bin | -eu done $(pwd) awk && cd printf sed grep && /usr/bin
+	"$@" $(pwd) 2>/dev/null grep "$@" grep
+	--verbose "$1" printf && | awk printf 2>/dev/null "$1" ${HOME} awk /usr/bin sed
+		readonly sed 2>/dev/null local
+		$(pwd) -eu "$@" | cd &&
+		x=1 then then grep test 2>/dev/null "$@"
+	2>/dev/null $(pwd) "$1" "$1" $(pwd) echo | ${HOME} done "$@" | $(pwd) readonly
+	x=1 && -eu printf sed $(pwd) test cd --verbose done
+		"$@" $(pwd) local -eu x=1 x=1 'quoted text' x=1 -eu readonly sed --verbose
+	/usr/bin 'quoted text' 2>/dev/null "$1" "$1" 'quoted text' export
+	"$@" test local 2>/dev/null /usr/bin /usr/bin
+	'quoted text' 2>/dev/null && printf echo then
+$(pwd) x=1 local x=1 ${HOME} cd sed readonly local done
+		2>/dev/null readonly export printf test "$@" export -eu /usr/bin awk then /usr/bin
+export "$1" sed echo 'quoted text' export $(pwd)
+	-eu local echo /usr/bin done --verbose test done sed 'quoted text'
+grep /usr/bin /usr/bin $(pwd) done 2>/dev/null ${HOME} "$@" cd
+	then sed /usr/bin $(pwd) "$1" -eu echo | -eu "$@" 2>/dev/null
+echo | "$@" then grep x=1 readonly awk 'quoted text' export printf
+		"$1" then | sed --verbose readonly test sed readonly
+		"$@" /usr/bin printf "$@" local 2>/dev/null cd -eu 2>/dev/null
+	test 2>/dev/null readonly grep $(pwd) test then awk cd ${HOME} ${HOME} local
+	| echo -eu $(pwd) "$1" local export echo echo echo 2>/dev/null && export
+	then readonly done 'quoted text' 'quoted text'
+	x=1 /usr/bin export -eu ${HOME} export awk printf then --verbose
+then then then ${HOME} --verbose awk local 'quoted text' export "$1" cd $(pwd)
+		grep | cd ${HOME} echo echo 'quoted text'
+	/usr/bin && x=1 grep readonly ${HOME} local x=1 --verbose
+		readonly x=1 test x=1 awk x=1 x=1 export ${HOME} local "$@" ${HOME} export
+	awk -eu -eu && -eu test 2>/dev/null awk "$1"
+		"$1" 2>/dev/null printf x=1 then | -eu --verbose "$1" readonly cd grep then then
+	done done local grep readonly test then 2>/dev/null
+		${HOME} then 'quoted text' grep local then readonly local && -eu
+	readonly /usr/bin && x=1 -eu /usr/bin 2>/dev/null sed export awk
+	2>/dev/null local x=1 | cd
+		cd 2>/dev/null test then -eu "$@" export sed then ${HOME} sed
+done | test ${HOME} && export then && cd --verbose printf awk printf && "$@"
+		test ${HOME} /usr/bin ${HOME} printf && echo
+	x=1 export export x=1 done 'quoted text' 2>/dev/null && printf
+		then --verbose --verbose sed echo echo printf 'quoted text'
+cd sed done "$@" export cd
+/usr/bin local printf done local $(pwd) export | sed x=1 'quoted text'
+then then done cd --verbose --verbose then ${HOME}
+printf | 2>/dev/null /usr/bin -eu test sed --verbose
+		echo echo printf ${HOME} sed grep
+x=1 -eu test printf ${HOME} then -eu 2>/dev/null export export
+		/usr/bin x=1 ${HOME} echo printf x=1 "$@"
+		2>/dev/null printf x=1 cd local grep --verbose $(pwd)
+	readonly /usr/bin && readonly then printf awk 'quoted text' /usr/bin
+	awk /usr/bin local -eu $(pwd) grep then "$1" 'quoted text'
+| done cd local readonly
+		2>/dev/null done done
+/usr/bin export -eu echo then
+${HOME} && cd echo printf test | --verbose
+		printf | 2>/dev/null -eu test then
+	'quoted text' readonly printf
+-eu -eu done "$@" -eu then /usr/bin && then "$@" awk export ${HOME}
+	echo | 'quoted text' test | done "$1" then cd test 2>/dev/null | test printf ${HOME}
+	readonly test 'quoted text' "$@" test sed test --verbose 2>/dev/null
+		sed printf done 2>/dev/null done "$@" -eu -eu && "$@" x=1 echo local export
+then 'quoted text' then "$@" echo echo x=1 grep done ${HOME}
+		sed readonly sed ${HOME} 2>/dev/null export | "$1" -eu readonly && "$1" local
+		cd /usr/bin | $(pwd) sed local | local grep && test echo "$@" $(pwd) local
+${HOME} printf "$@" echo cd done && grep
+then && 'quoted text'
+		| --verbose grep | echo awk -eu printf printf
+	printf echo done export grep -eu awk export "$1" 2>/dev/null -eu -eu /usr/bin
+printf awk x=1 ${HOME} export ${HOME} then test --verbose
+		/usr/bin | "$@" x=1 printf "$@" export echo 2>/dev/null ${HOME} grep echo grep
+'quoted text' test 2>/dev/null --verbose then awk
+	'quoted text' "$@" "$@" /usr/bin $(pwd) awk cd "$@" x=1 "$@" 2>/dev/null "$1"
+		readonly test sed sed "$@" && -eu
+	-eu && --verbose grep echo /usr/bin awk export 'quoted text' cd
+		"$1" 'quoted text' export
+		| $(pwd) -eu then local -eu $(pwd) /usr/bin printf
+		test && -eu "$1" x=1 --verbose then --verbose ${HOME} ${HOME}
+		-eu readonly $(pwd) | 2>/dev/null $(pwd) echo grep echo sed "$@" local echo -eu
+export "$@" | 2>/dev/null
+grep | $(pwd) | echo "$1" echo sed then --verbose "$1" export x=1 echo
+	2>/dev/null sed "$@" readonly local export | echo | 'quoted text' printf done
+		&& cd done 'quoted text' awk -eu export export cd 2>/dev/null
+| x=1 $(pwd) $(pwd) | done local echo --verbose /usr/bin "$@"
+printf && echo "$1" grep "$1" export /usr/bin cd done /usr/bin
+		printf sed grep && 'quoted text' local --verbose && 'quoted text'
+		2>/dev/null local done export awk 2>/dev/null /usr/bin /usr/bin
+	echo sed 'quoted text' readonly "$@" "$@" "$@"
+	then then -eu ${HOME} 'quoted text' readonly
+grep local "$1" sed --verbose "$1" done
+		echo 'quoted text' "$@" x=1 export sed | then echo local "$1" then --verbose ${HOME}
+		2>/dev/null /usr/bin | echo 2>/dev/null
+2>/dev/null "$1" printf test printf test && echo
+'quoted text' cd ${HOME} /usr/bin $(pwd) "$1" $(pwd) "$@" echo awk printf grep
+export && readonly /usr/bin
+	cd && "$@" /usr/bin "$@"
+	--verbose --verbose 'quoted text' printf
+		${HOME} "$@" echo | grep awk awk $(pwd) grep /usr/bin printf /usr/bin
+		readonly && cd "$@" readonly printf
+	awk done grep $(pwd) ${HOME}
+	2>/dev/null ${HOME} "$1" printf
+	echo readonly x=1 local awk 2>/dev/null 'quoted text'
+		| readonly x=1 export sed export 2>/dev/null then "$1" "$@" | grep ${HOME}
+printf ${HOME} done done x=1 && | ${HOME} /usr/bin awk $(pwd) done --verbose readonly
+		then local echo readonly 'quoted text' cd
+		printf grep test readonly
+		"$1" $(pwd) /usr/bin 'quoted text' export -eu grep --verbose
+	&& awk x=1 done then cd awk --verbose 2>/dev/null ${HOME} "$@" x=1
+-eu --verbose "$1" x=1 readonly
+'quoted text' cd printf && local "$1" export 2>/dev/null | awk export ${HOME} then
+	"$@" && $(pwd) "$@" cd "$1" "$1" printf x=1 &&
+		sed --verbose sed export grep awk grep grep grep
+echo awk /usr/bin /usr/bin test done
+	'quoted text' readonly then "$1" printf export 'quoted text' -eu local
+local readonly cd grep sed && readonly && readonly -eu $(pwd)
+x=1 $(pwd) done 2>/dev/null
+local ${HOME} local grep readonly -eu
+| && local 2>/dev/null "$1" cd 'quoted text' --verbose "$@" "$@" done
+	/usr/bin readonly -eu then done | then /usr/bin cd test cd x=1 cd ${HOME} echo local
+	x=1 grep echo export local x=1 echo readonly -eu | sed -eu --verbose -eu --verbose
+		'quoted text' $(pwd) -eu && test then /usr/bin 2>/dev/null 'quoted text'
+	cd echo echo cd x=1 | awk echo "$@" echo /usr/bin export printf
+	'quoted text' && /usr/bin readonly then test -eu | "$1"
+export /usr/bin done done /usr/bin grep done
+then -eu $(pwd) sed test
+	export "$@" test echo grep ${HOME}
+cd 2>/dev/null 'quoted text' readonly /usr/bin "$@" "$@" export /usr/bin
+		printf -eu then 2>/dev/null | test grep grep ${HOME}
+	x=1 'quoted text' /usr/bin grep
+		cd x=1 then "$1" done "$@" --verbose "$@" 2>/dev/null
+	awk echo $(pwd) /usr/bin sed cd $(pwd)
+		done cd cd -eu local 'quoted text' | --verbose
+	2>/dev/null x=1 cd && $(pwd) cd test ${HOME}
+		-eu /usr/bin --verbose printf "$1" /usr/bin
+		${HOME} $(pwd) -eu /usr/bin --verbose "$1" printf "$@" "$1" printf
+		$(pwd) test 'quoted text' cd test readonly local 2>/dev/null test then -eu $(pwd)
+echo x=1 -eu local sed "$1"
+		then cd readonly grep 2>/dev/null 'quoted text' ${HOME} echo $(pwd) /usr/bin
+	-eu awk cd awk test printf x=1 done /usr/bin && ${HOME} 2>/dev/null "$1" grep 2>/dev/null
+	grep export printf test echo
+"$@" awk /usr/bin test
+		'quoted text' export -eu ${HOME} echo "$@" local printf grep x=1
+		"$@" 2>/dev/null /usr/bin 2>/dev/null $(pwd) awk -eu -eu $(pwd) --verbose x=1 printf
+	printf 'quoted text' $(pwd) -eu && local awk
+	"$1" test done readonly
+		grep "$1" printf then cd "$@" export --verbose
+		${HOME} "$1" awk done -eu sed ${HOME} --verbose ${HOME} then
+	sed /usr/bin "$1" "$1" 2>/dev/null $(pwd) test cd
+"$@" export readonly then 'quoted text' grep local grep
+test "$@" export done "$1" export grep x=1 && && cd printf x=1 "$1"
+'quoted text' printf $(pwd) test grep --verbose cd export
+/usr/bin then sed export --verbose 2>/dev/null
+	then 'quoted text' $(pwd) cd then cd ${HOME} test && 'quoted text' then
+printf /usr/bin readonly $(pwd) cd -eu grep test
+	| local "$1" 2>/dev/null sed grep printf readonly local $(pwd) export
+then export local echo awk printf export then -eu 'quoted text' printf /usr/bin
+		sed test 2>/dev/null "$@" local awk | -eu ${HOME} readonly ${HOME} done -eu test
+	done x=1 $(pwd) ${HOME} ${HOME} awk /usr/bin
+		x=1 cd awk ${HOME} then "$@" sed echo
+export local "$1" sed | /usr/bin -eu $(pwd) test printf
+		test cd export cd readonly --verbose 'quoted text' local && ${HOME}
+cd printf cd test x=1 local local | echo test
+		${HOME} $(pwd) 2>/dev/null echo ${HOME} local
+	'quoted text' 2>/dev/null 'quoted text' test "$@" 2>/dev/null
+		-eu $(pwd) 'quoted text' --verbose cd awk 'quoted text' printf cd cd
+		awk export printf -eu readonly then then
+		local /usr/bin grep test | echo --verbose printf
+	local echo | --verbose | -eu
+		local $(pwd) test export /usr/bin x=1 cd
+		&& ${HOME} cd done grep local x=1 $(pwd) | x=1 ${HOME} "$@" $(pwd)
+		"$@" -eu "$1" ${HOME} 2>/dev/null awk sed
+		"$@" printf --verbose export "$@" ${HOME} grep done export
+		-eu | awk --verbose "$@" ${HOME} "$1" /usr/bin "$@" 2>/dev/null
+	"$1" $(pwd) printf 2>/dev/null "$@" && x=1 x=1 echo
+"$@" grep local && 2>/dev/null && 'quoted text'
+	test printf "$@" x=1 echo "$1" /usr/bin | cd --verbose /usr/bin grep --verbose
+		awk && $(pwd) 2>/dev/null
+	&& printf --verbose /usr/bin --verbose sed ${HOME} sed echo 'quoted text'
+&& echo then sed sed $(pwd) local ${HOME}
+	&& "$@" printf awk then /usr/bin cd cd 'quoted text' /usr/bin -eu /usr/bin
+cd "$@" /usr/bin "$@" | x=1 'quoted text'
+done readonly echo grep --verbose
+	grep printf $(pwd) awk | grep export
+sed "$@" -eu sed test x=1 export | -eu
+	--verbose local | "$1" then awk "$1" export export
+	export export cd "$1" "$1" && printf &&
+	"$1" sed awk export done 2>/dev/null then echo $(pwd) awk | "$@" local 'quoted text'
+	echo awk ${HOME} sed export printf then sed /usr/bin ${HOME}
+		cd echo awk then ${HOME}
+		--verbose awk $(pwd) done /usr/bin /usr/bin sed --verbose
+&& /usr/bin test /usr/bin $(pwd) | "$1" awk cd x=1
+		2>/dev/null "$@" awk 'quoted text' then "$@" 2>/dev/null
+	x=1 --verbose local $(pwd) awk --verbose
+test /usr/bin echo $(pwd) sed grep echo
+	-eu "$@" $(pwd) $(pwd)
+		cd cd printf 'quoted text' "$@" | awk sed x=1 echo
+2>/dev/null ${HOME} test then x=1 && "$@" cd test "$1" ${HOME} --verbose
+	'quoted text' export readonly /usr/bin grep
+	done printf cd -eu x=1 /usr/bin && 'quoted text' && --verbose readonly
+	grep export && then grep x=1 cd done printf sed --verbose | test
+	${HOME} done echo sed | "$@"
+sed echo test awk /usr/bin
+	echo local sed sed cd "$@" test
+	-eu --verbose --verbose printf ${HOME} 'quoted text' awk sed 'quoted text'
+	sed --verbose 'quoted text' /usr/bin printf printf echo "$1" -eu
+		cd printf && x=1 test grep cd cd
+	"$@" && export ${HOME} "$1" grep 2>/dev/null "$@" cd export && grep
+		sed then && done then 2>/dev/null | test x=1 test /usr/bin
+		x=1 2>/dev/null export sed --verbose "$1" done echo printf x=1
+	-eu cd grep echo -eu local
+		awk $(pwd) "$1" $(pwd) awk then sed -eu readonly done cd
@@ -0,0 +1,2001 @@
+	"$@" readonly $(pwd) --verbose && test export awk done readonly
+		&& "$1" readonly done awk $(pwd) 'quoted text' awk "$@" "$1" awk grep && "$@" |
+		--verbose -eu echo | grep --verbose $(pwd)
+echo && echo ${HOME} export $(pwd) then -eu readonly
+	2>/dev/null -eu readonly | /usr/bin readonly cd --verbose 2>/dev/null && echo
+| cd "$1" printf 'quoted text' done
+	&& local 2>/dev/null /usr/bin test $(pwd) -eu then done readonly local readonly
+		done --verbose && ${HOME} &&
+	printf sed 'quoted text' local && export --verbose
+		"$@" awk echo | echo readonly "$@" "$1" export sed
+		/usr/bin readonly && 2>/dev/null readonly export && local then
+		then test test /usr/bin echo test $(pwd) | 2>/dev/null local /usr/bin
+		local grep grep "$1" grep grep 'quoted text' 'quoted text'
+'quoted text' cd -eu -eu $(pwd) $(pwd)
+	x=1 local awk -eu awk echo local /usr/bin 2>/dev/null
+echo ${HOME} | && awk | grep done --verbose 'quoted text' then x=1 "$@" -eu
+| local && export sed sed printf ${HOME} | "$@" && sed cd sed 'quoted text'
+	readonly x=1 --verbose cd export
+		-eu awk done ${HOME} done test local "$@" --verbose test | done
+		${HOME} echo local then ${HOME} export && grep ${HOME} && cd 2>/dev/null "$@"
+readonly | -eu local sed ${HOME} | echo local
+x=1 x=1 2>/dev/null -eu ${HOME} x=1 2>/dev/null
+/usr/bin x=1 --verbose "$@"
+--verbose awk /usr/bin sed then -eu /usr/bin sed "$@"
+x=1 sed readonly cd awk | x=1 "$@" printf 'quoted text'
+	awk awk done | /usr/bin /usr/bin 'quoted text' ${HOME} 2>/dev/null 'quoted text'
+${HOME} "$@" readonly readonly
+	2>/dev/null 'quoted text' --verbose -eu "$1" $(pwd) printf
+		awk $(pwd) local grep ${HOME} $(pwd) 'quoted text' sed "$@" local --verbose
+		/usr/bin cd readonly test awk "$1" cd 'quoted text' grep export test cd done test
+	/usr/bin "$@" awk x=1 --verbose
+	test local | sed export $(pwd) -eu 2>/dev/null export "$@" "$1" echo export --verbose
+		&& "$1" grep -eu /usr/bin 2>/dev/null &&
+awk printf test "$1" x=1 /usr/bin export export
+		&& --verbose $(pwd) local "$@" && --verbose
+then readonly export | local
+	test --verbose x=1 /usr/bin awk 'quoted text'
+/usr/bin x=1 sed grep ${HOME} -eu && cd "$1" --verbose done x=1 --verbose printf
+	echo 'quoted text' "$1" done export sed /usr/bin && | x=1 echo "$@" done
+	&& local awk "$1" x=1 test
+readonly 2>/dev/null x=1 x=1 $(pwd)
+$(pwd) done done && cd export grep && awk ${HOME} grep printf grep done echo printf
+		export printf export x=1 done then --verbose --verbose && /usr/bin ${HOME} sed
+grep readonly sed "$1" "$1" 2>/dev/null local local "$@"
+	then cd cd x=1 sed echo 2>/dev/null
+		printf x=1 ${HOME} awk echo cd -eu
+	&& then readonly "$@" test && ${HOME} ${HOME}
+| ${HOME} ${HOME} cd local printf | test ${HOME} $(pwd) grep
+done printf "$1" $(pwd)
+	echo x=1 readonly export
+		then "$1" $(pwd) -eu test 'quoted text' $(pwd) 2>/dev/null
+	-eu awk awk "$@" awk done /usr/bin local 2>/dev/null -eu test then export 2>/dev/null
+"$@" printf awk 'quoted text' 2>/dev/null readonly grep "$1"
+$(pwd) then "$@" then $(pwd) cd 2>/dev/null echo | echo then
+	cd printf && readonly done x=1 grep -eu done --verbose "$@" test readonly
+printf --verbose awk cd "$1" 2>/dev/null awk | printf printf ${HOME} test
+		${HOME} readonly /usr/bin && --verbose sed local done && export
+		x=1 cd ${HOME} && && "$@" x=1 /usr/bin 'quoted text'
+		done /usr/bin then printf printf "$@" "$1" echo local test x=1
+		echo local grep "$@" $(pwd)
+"$1" done --verbose printf grep "$1" grep export /usr/bin readonly then
+&& echo $(pwd) then sed test done sed grep 2>/dev/null echo ${HOME} -eu cd cd
+	"$@" echo cd --verbose -eu "$@" then echo
+	-eu export awk --verbose $(pwd) ${HOME} "$1" readonly
+	"$1" /usr/bin 2>/dev/null sed done
+'quoted text' printf awk -eu
+	sed printf 2>/dev/null readonly -eu
+	&& then export then ${HOME}
+	local x=1 cd "$@" cd "$@" && "$@" "$@" x=1 awk x=1 grep then && cd "$1" x=1
+		echo -eu "$1" | /usr/bin --verbose echo local "$@" then && done
+		&& x=1 "$1" then && awk cd "$@"
+	2>/dev/null export "$1" $(pwd) done &&
+		awk && x=1 "$1" export awk cd $(pwd) local
+sed test awk then "$1" ${HOME} | test | readonly sed printf ${HOME}
+	printf && awk && readonly 2>/dev/null
+		'quoted text' cd test 2>/dev/null
+	export export "$1" printf | 2>/dev/null
+"$1" grep echo $(pwd) done "$@" &&
+		readonly local "$@" then awk test x=1 /usr/bin $(pwd)
+awk && readonly awk echo export /usr/bin awk then && export then | "$@"
+		done $(pwd) then grep export printf -eu $(pwd)
+		&& /usr/bin --verbose grep
+		grep -eu -eu cd export ${HOME} then 'quoted text'
+		sed x=1 cd "$1" test 2>/dev/null
+	export $(pwd) "$1" awk "$@"
+-eu && grep --verbose 'quoted text' done test | "$@" local x=1 $(pwd) done /usr/bin
+	${HOME} cd | "$1" awk "$1"
+	${HOME} 'quoted text' 2>/dev/null
+2>/dev/null sed "$1" $(pwd) /usr/bin --verbose x=1 then
+	cd -eu --verbose --verbose -eu test export sed 2>/dev/null
+	2>/dev/null echo 2>/dev/null -eu "$1" awk printf x=1 && test --verbose
+	sed -eu $(pwd) printf 2>/dev/null export echo -eu local
+		cd x=1 sed local test /usr/bin "$@" 2>/dev/null
+"$1" printf grep x=1 export test awk test export "$@" 2>/dev/null
+	then done 2>/dev/null echo "$@" sed awk
+		"$1" awk -eu x=1 export done 2>/dev/null sed --verbose
+"$1" --verbose readonly -eu | printf test test 'quoted text'
+	then "$@" echo awk && export readonly
+2>/dev/null ${HOME} 2>/dev/null local x=1 -eu readonly echo
+		echo && --verbose && export && 2>/dev/null 'quoted text' done readonly
+	cd test printf "$@" export
+	"$@" sed readonly echo | | cd echo
+	2>/dev/null cd --verbose sed -eu then cd echo -eu grep echo ${HOME} -eu x=1 2>/dev/null
+test 'quoted text' $(pwd)
+&& --verbose then $(pwd) then sed export -eu $(pwd)
+		2>/dev/null done awk $(pwd) export then "$1"
+		x=1 grep done ${HOME} echo export grep sed 2>/dev/null
+	done && | done ${HOME} $(pwd) --verbose
+	"$1" cd sed x=1 -eu done
+export awk "$1" ${HOME} printf 'quoted text' test readonly readonly cd -eu cd
+		"$1" test 2>/dev/null test --verbose -eu 'quoted text' 2>/dev/null
+done x=1 then test test "$1" grep x=1 'quoted text'
+	local local $(pwd) | "$1" then && /usr/bin
+$(pwd) cd "$@" awk then
+		cd local printf test printf awk "$@" -eu 'quoted text'
+		sed x=1 x=1 awk cd $(pwd)
+"$@" 'quoted text' --verbose -eu $(pwd) done | 2>/dev/null
+		-eu echo test -eu "$1" /usr/bin local cd
+	done readonly 'quoted text'
+export 2>/dev/null printf printf ${HOME} && 'quoted text'
+		x=1 --verbose 'quoted text' $(pwd) done "$1" "$@" done test ${HOME}
+		${HOME} readonly | "$1" cd cd -eu sed export | cd awk "$@" cd --verbose
+		2>/dev/null /usr/bin 2>/dev/null
+	grep cd done done --verbose 'quoted text' && x=1 'quoted text'
+		echo cd "$1" done ${HOME} x=1 echo then "$1" "$1" then sed x=1
+		$(pwd) "$@" cd -eu -eu && x=1 awk "$@" "$1" | 'quoted text' printf
+		&& export | test done awk && "$@" cd "$@" --verbose
+		$(pwd) local ${HOME} test /usr/bin sed 2>/dev/null readonly echo
+		echo -eu export -eu awk export
+		sed x=1 && --verbose then x=1 "$@" $(pwd) 2>/dev/null --verbose then sed readonly
+"$1" readonly | $(pwd) done x=1 printf echo echo -eu "$@" done 'quoted text'
+	/usr/bin "$@" /usr/bin export ${HOME} awk -eu | $(pwd) 'quoted text'
+		done --verbose 'quoted text' printf echo export
+	done echo && echo "$@" x=1 | sed then then /usr/bin cd test "$1" "$@" cd
+awk 'quoted text' "$@" sed -eu --verbose -eu local
+		${HOME} "$@" "$1" x=1 'quoted text'
+x=1 grep readonly ${HOME}
+$(pwd) $(pwd) printf --verbose readonly "$@" echo done "$1" | local
+'quoted text' test echo "$1" ${HOME} grep
+	-eu cd "$@" test export ${HOME}
+		/usr/bin && grep --verbose
+		export ${HOME} export "$@" then export test
+local "$@" x=1 $(pwd) ${HOME} readonly grep 'quoted text' "$1" "$1" export
+		$(pwd) echo readonly "$1" sed && printf "$@" readonly
+	printf 'quoted text' echo awk echo &&
+	| awk test cd $(pwd) x=1 | ${HOME} x=1 sed
+		awk sed $(pwd) readonly awk printf sed
+	awk "$@" local x=1 cd 'quoted text' "$1" --verbose export grep "$1" echo echo grep
+	done /usr/bin readonly grep --verbose $(pwd)
+	$(pwd) grep 'quoted text' done echo printf $(pwd) --verbose
+		&& echo done awk awk
+then readonly awk grep sed -eu printf "$1" /usr/bin -eu readonly 'quoted text'
+x=1 -eu ${HOME} awk test | 'quoted text' cd
+	printf done 'quoted text' echo 2>/dev/null cd /usr/bin $(pwd) cd echo
+	| then --verbose -eu 'quoted text' export
+/usr/bin --verbose /usr/bin readonly --verbose cd | $(pwd) done grep echo "$1"
+		2>/dev/null "$1" cd then printf awk export $(pwd) grep 2>/dev/null 2>/dev/null
+		/usr/bin sed ${HOME} grep test cd readonly echo echo x=1
+'quoted text' export | test "$@"
+cd local -eu echo -eu --verbose readonly /usr/bin
+		grep cd 'quoted text' -eu 2>/dev/null x=1 "$@" | "$@" 2>/dev/null then then
+--verbose then local 2>/dev/null awk done 2>/dev/null
+/usr/bin echo | cd && -eu | $(pwd) $(pwd) done --verbose sed then ${HOME} 2>/dev/null
+	$(pwd) echo -eu 'quoted text'
+	'quoted text' $(pwd) ${HOME} --verbose grep readonly readonly export
+		| | sed sed "$@" && export then printf
+		--verbose readonly "$1" "$1" /usr/bin
+	grep && local x=1 x=1 grep $(pwd) 2>/dev/null
+	| done $(pwd) x=1 /usr/bin
+"$@" sed cd printf | "$@" --verbose "$1" "$1"
+grep x=1 && awk sed echo test --verbose
+	echo | awk "$@" && awk -eu printf
+-eu then sed cd test 2>/dev/null $(pwd) grep x=1 ${HOME}
+	| $(pwd) | 2>/dev/null grep echo
+sed grep done "$@" then done done -eu 2>/dev/null x=1 "$1"
+echo && -eu ${HOME} test
+	"$1" x=1 sed $(pwd) done test --verbose sed sed echo $(pwd) echo 'quoted text'
+echo grep cd -eu awk grep done test
+		"$@" --verbose printf 'quoted text' ${HOME}
+test awk local export then then readonly x=1 readonly |
+	then "$1" local test "$1"
+	-eu printf awk "$@" then readonly awk
+echo "$1" printf echo "$@" grep readonly --verbose readonly
+		echo sed 2>/dev/null echo -eu
+		'quoted text' /usr/bin sed cd "$1"
+	printf echo done ${HOME} done /usr/bin --verbose
+"$@" 2>/dev/null "$1" echo /usr/bin export printf 'quoted text' then grep then
+	x=1 $(pwd) readonly 'quoted text'
+sed 'quoted text' awk export local then "$1" echo
+-eu ${HOME} then --verbose "$@" cd test test cd test echo 'quoted text' 2>/dev/null
+done then "$@" $(pwd) sed sed cd "$@" x=1 then "$1" $(pwd)
+		printf x=1 /usr/bin --verbose 'quoted text' 'quoted text'
+		/usr/bin "$1" printf sed echo printf test 2>/dev/null
+		| local then printf && | awk -eu -eu test cd "$@" sed then local export
+		"$@" then $(pwd) cd 2>/dev/null then "$@" --verbose
+		export then readonly test --verbose --verbose 'quoted text' /usr/bin export cd
+	2>/dev/null export export | /usr/bin
+x=1 awk 2>/dev/null local /usr/bin awk 'quoted text' "$1" x=1 then printf
+		x=1 echo printf "$@" export
+		"$@" test echo /usr/bin export | x=1 "$1" --verbose | -eu echo cd 'quoted text'
+	done grep local $(pwd) 'quoted text' echo
+		/usr/bin then 'quoted text' $(pwd) echo test export "$1"
+		readonly sed x=1 ${HOME} /usr/bin 2>/dev/null "$@" done /usr/bin /usr/bin "$1"
+	--verbose ${HOME} printf && test done done /usr/bin cd "$1" done echo sed
+'quoted text' awk --verbose ${HOME} echo readonly "$@" "$1" 'quoted text'
+		$(pwd) "$1" export && readonly sed
+		"$1" test x=1 readonly x=1 local --verbose "$1" cd | local --verbose "$@" local
+		--verbose /usr/bin printf printf
+| readonly && "$@" /usr/bin --verbose readonly cd --verbose
+	cd readonly printf --verbose | then then "$@" echo awk cd 2>/dev/null /usr/bin
+		then $(pwd) 'quoted text' | readonly sed && echo grep then ${HOME}
+		$(pwd) -eu ${HOME} "$1" cd /usr/bin test -eu readonly 'quoted text' $(pwd)
+awk done "$1" "$@" -eu then grep 'quoted text' echo export "$1" printf
+	grep /usr/bin /usr/bin awk "$@" done printf
+		${HOME} --verbose export readonly "$@" /usr/bin -eu --verbose
+	test echo sed printf
+		x=1 printf grep $(pwd) "$1" printf grep "$1"
+	test --verbose && local test export local && printf export -eu then &&
+		"$1" then echo --verbose ${HOME} cd "$@"
+done test readonly export cd grep then --verbose
+	echo echo | x=1 "$1" $(pwd) export export $(pwd) /usr/bin -eu awk 'quoted text'
+	echo local -eu $(pwd) grep && /usr/bin x=1
+/usr/bin | ${HOME} cd | sed test then --verbose
+	${HOME} readonly awk sed 'quoted text' x=1 "$1" $(pwd) 'quoted text'
+	local grep sed ${HOME} export sed grep awk ${HOME} /usr/bin x=1 local
+grep $(pwd) $(pwd) cd sed local "$1" export ${HOME} -eu awk "$@" | readonly cd
+x=1 -eu local test then 2>/dev/null done && "$1" 2>/dev/null
+		then awk "$1" sed "$1" /usr/bin printf printf printf
+		${HOME} echo -eu "$1" done sed "$1" 'quoted text'
+sed printf 'quoted text' grep
+grep test sed done | 2>/dev/null printf test
+	2>/dev/null awk sed echo printf "$1" && --verbose
+	done readonly awk done then done test $(pwd) /usr/bin echo 2>/dev/null 'quoted text'
+		x=1 "$1" x=1 echo -eu printf done /usr/bin x=1 "$1" readonly grep "$1"
+--verbose /usr/bin "$@"
+		local export 'quoted text' sed done
+	$(pwd) | done $(pwd) "$@" "$@" export $(pwd) sed "$1" local
+		2>/dev/null sed sed /usr/bin test "$@" --verbose 2>/dev/null
+	done | printf awk sed 'quoted text' echo
+	printf awk done "$1" | echo awk then 'quoted text'
+		"$1" awk /usr/bin | "$@" /usr/bin
+		cd $(pwd) readonly local "$1" echo ${HOME} test printf cd "$@" && "$1"
+		-eu /usr/bin -eu 2>/dev/null readonly
+x=1 printf x=1 sed 'quoted text' x=1 cd test
+"$1" cd echo awk $(pwd) && x=1 ${HOME} /usr/bin -eu x=1 && sed awk awk
+		"$@" awk awk awk x=1 sed | ${HOME}
+		test grep readonly printf -eu then -eu export done then
+	--verbose then | awk "$1" done ${HOME} -eu "$1" awk 'quoted text' 2>/dev/null
+	export awk "$@" sed awk $(pwd) ${HOME} printf
+--verbose "$1" 2>/dev/null /usr/bin test ${HOME} local sed local printf
+		x=1 echo && 2>/dev/null "$1" /usr/bin then printf
+	echo printf then grep "$@" cd done "$@" 2>/dev/null
+	done 2>/dev/null local && then -eu && then printf
+	local then echo test x=1 printf sed test
+	-eu sed done readonly $(pwd) -eu -eu cd sed awk -eu "$@" /usr/bin done printf
+	printf -eu ${HOME} grep --verbose readonly test /usr/bin
+		test sed echo sed cd awk --verbose ${HOME} awk then 2>/dev/null
+export 2>/dev/null --verbose echo ${HOME} then readonly test x=1 grep
+sed x=1 cd then -eu 2>/dev/null
+		sed ${HOME} export awk "$1" 2>/dev/null --verbose local done "$@" "$1" local "$@"
+	printf && ${HOME} grep 'quoted text'
+	export test printf printf 2>/dev/null | "$@" /usr/bin readonly
+printf awk cd export "$1" && done
+	grep local 2>/dev/null grep 2>/dev/null echo /usr/bin
+-eu sed then x=1 | --verbose "$@"
+2>/dev/null export x=1 'quoted text'
+local ${HOME} readonly "$@" awk awk
+	--verbose printf /usr/bin printf printf test && awk readonly cd
+		$(pwd) sed echo printf "$1" 2>/dev/null sed then 2>/dev/null
+	/usr/bin 2>/dev/null 'quoted text' done grep
+	${HOME} printf 2>/dev/null /usr/bin
+		x=1 sed then --verbose "$1" ${HOME} cd local then grep ${HOME} test
+		--verbose then --verbose awk then awk grep ${HOME} then ${HOME} ${HOME}
+		sed | -eu $(pwd) sed sed awk x=1 ${HOME} readonly echo "$1" 'quoted text'
+2>/dev/null export local 2>/dev/null readonly "$1" && | -eu 'quoted text'
+	grep -eu grep grep /usr/bin done printf grep awk awk then 'quoted text'
+	then x=1 grep && then 2>/dev/null local
+		test -eu && /usr/bin readonly
+		| test 'quoted text' $(pwd) done 'quoted text'
+"$@" 2>/dev/null x=1 then printf --verbose && "$@" export "$@" ${HOME}
+"$1" test 'quoted text' then grep awk cd test
+	2>/dev/null x=1 export /usr/bin export x=1 "$@"
+	-eu "$1" local /usr/bin && export grep echo 2>/dev/null
+&& export | 'quoted text' sed echo | grep $(pwd)
+	${HOME} "$1" local printf echo "$1" echo 2>/dev/null done /usr/bin
+	local cd "$@" awk --verbose "$@" cd $(pwd) awk export
+		$(pwd) printf x=1 then awk grep && local ${HOME} $(pwd) --verbose
+export 'quoted text' sed echo sed
+	-eu 'quoted text' "$@" -eu && "$1" printf readonly
+	test printf cd cd $(pwd)
+printf | grep "$@" 'quoted text'
+	grep 2>/dev/null -eu $(pwd) -eu export | readonly
+awk readonly awk local cd $(pwd) sed cd export -eu ${HOME}
+grep local grep $(pwd) grep then then export sed -eu $(pwd) x=1 sed
+cd local 2>/dev/null x=1 2>/dev/null 2>/dev/null | done x=1 readonly "$1" "$@"
+"$@" done readonly $(pwd) local export
+	x=1 done $(pwd) then -eu sed && $(pwd) local x=1 sed
+$(pwd) awk done 'quoted text' 2>/dev/null "$1" test $(pwd) -eu sed | /usr/bin
+	local ${HOME} done 2>/dev/null
+		/usr/bin 2>/dev/null -eu
+		echo local export /usr/bin -eu test
+	test -eu -eu | -eu && echo awk grep then readonly
+$(pwd) sed test | | cd -eu -eu --verbose sed test then test done "$1" /usr/bin
+		2>/dev/null /usr/bin echo readonly x=1 local /usr/bin &&
+printf $(pwd) /usr/bin
+2>/dev/null done 2>/dev/null cd "$@" ${HOME} test echo x=1 cd readonly
+	cd echo /usr/bin && --verbose | grep 'quoted text' echo test --verbose export
+${HOME} 2>/dev/null done done echo done
+		"$1" printf done local && echo $(pwd) $(pwd)
+	readonly /usr/bin test sed test && ${HOME} $(pwd)
+	readonly done grep 'quoted text' awk "$1" sed printf echo "$1" printf ${HOME} ${HOME}
+'quoted text' "$1" grep x=1 | ${HOME} sed then --verbose
+printf printf awk local printf --verbose -eu export done
+		sed && --verbose $(pwd) "$1" export 'quoted text' export test then | -eu
+		echo local grep x=1 awk ${HOME} --verbose local test
+	local export then grep $(pwd) | $(pwd) grep cd 2>/dev/null printf then local
+		$(pwd) sed echo && done cd ${HOME} export
+$(pwd) ${HOME} -eu $(pwd) --verbose echo --verbose grep --verbose
+	x=1 readonly done test test readonly awk test -eu 2>/dev/null printf $(pwd)
+		-eu 'quoted text' "$1" ${HOME}
+		export grep cd export 2>/dev/null sed $(pwd) -eu "$@" "$@" then printf $(pwd)
+	test 'quoted text' export -eu "$@" x=1 | export then
+	local cd /usr/bin 2>/dev/null echo grep
+		--verbose cd ${HOME} sed
+	sed "$@" export test echo then
+		printf echo awk local -eu $(pwd) /usr/bin readonly echo cd cd cd done test
+$(pwd) "$1" sed readonly test 'quoted text' $(pwd)
+test cd echo test && 2>/dev/null 2>/dev/null awk -eu ${HOME} | test readonly
+	readonly cd 'quoted text' "$1" "$@" && 'quoted text' x=1 "$1" done
+		"$@" printf readonly "$@" awk | "$@" -eu cd grep | $(pwd)
+	-eu echo test cd export "$1" cd sed /usr/bin 2>/dev/null "$1" echo readonly
+		echo /usr/bin awk cd readonly echo "$@" awk "$@" export local
+/usr/bin $(pwd) readonly echo printf |
+	printf x=1 ${HOME} export "$1" awk x=1 "$@" done | ${HOME} -eu "$1"
+	export --verbose /usr/bin sed awk sed done test then /usr/bin 2>/dev/null 'quoted text'
+/usr/bin x=1 export export readonly
+		export echo echo "$@" x=1 awk test "$@" /usr/bin 2>/dev/null 2>/dev/null x=1
+		echo $(pwd) /usr/bin x=1 && printf then
+		cd grep grep /usr/bin &&
+	"$@" x=1 printf "$@" printf readonly local && $(pwd) test x=1 --verbose done /usr/bin
+export cd -eu export "$@" /usr/bin $(pwd)
+	cd grep && done printf x=1 "$1" done && -eu 'quoted text'
+2>/dev/null $(pwd) readonly then awk sed 'quoted text'
+	2>/dev/null "$@" ${HOME} 'quoted text' grep -eu printf -eu done readonly
+export then 2>/dev/null | $(pwd) ${HOME} "$@" -eu /usr/bin
+	awk awk cd readonly $(pwd) ${HOME} 2>/dev/null ${HOME} -eu export 2>/dev/null
+	printf 'quoted text' readonly
+echo then test | /usr/bin | cd /usr/bin grep grep local -eu | -eu ${HOME}
+		done x=1 test --verbose x=1 --verbose
+-eu local awk x=1 echo --verbose "$@" &&
+| $(pwd) "$@" "$@" "$1" ${HOME} export --verbose
+/usr/bin readonly echo readonly "$@"
+	${HOME} export "$@" && --verbose echo --verbose -eu grep /usr/bin sed
+	x=1 "$@" printf readonly awk cd readonly
+		local echo | test "$1" ${HOME} --verbose 'quoted text' export done export
+/usr/bin then "$@" ${HOME} awk cd $(pwd) test
+		sed local export 'quoted text' 'quoted text'
+&& x=1 /usr/bin $(pwd) -eu then x=1 test then export readonly --verbose "$@"
+"$@" sed ${HOME} grep /usr/bin then export -eu -eu printf awk sed "$@" export
+	${HOME} export sed printf "$1" export sed 2>/dev/null ${HOME}
+	$(pwd) readonly grep awk awk
+		echo sed export echo 'quoted text' --verbose printf -eu x=1 sed --verbose
+	awk local /usr/bin x=1 echo /usr/bin "$@"
+	'quoted text' cd -eu then test 'quoted text'
+		grep done 2>/dev/null local awk grep "$1" local cd -eu
+		local done $(pwd) then /usr/bin export export printf test
+		$(pwd) -eu -eu done echo export
+'quoted text' test 'quoted text'
+		printf readonly export 2>/dev/null "$@" printf export done /usr/bin
+readonly && grep /usr/bin awk -eu done test ${HOME} 'quoted text'
+| export echo sed --verbose awk && export | 2>/dev/null $(pwd)
+	grep export cd "$@" ${HOME} && export grep printf readonly local
+	"$@" printf -eu /usr/bin echo && "$1" done grep grep then grep done grep "$1"
+	done readonly /usr/bin --verbose test && then cd | x=1 2>/dev/null -eu test
+		echo test then export test x=1 cd
+	"$1" -eu readonly 2>/dev/null done
+		done readonly local sed
+	--verbose grep && awk sed && awk grep
+		done /usr/bin "$1" 'quoted text' 'quoted text'
+	| /usr/bin local export | 2>/dev/null /usr/bin /usr/bin
+'quoted text' /usr/bin export printf
+"$@" local then cd | sed /usr/bin sed done -eu /usr/bin cd /usr/bin
+	grep test echo --verbose x=1 echo "$1" awk grep
+		readonly then then sed echo /usr/bin readonly | cd x=1
+	${HOME} cd sed echo local && --verbose done test ${HOME} printf -eu -eu readonly
+		${HOME} ${HOME} 2>/dev/null cd 'quoted text' 2>/dev/null
+printf ${HOME} local local
+	"$1" awk 2>/dev/null then readonly printf $(pwd) echo | "$1" | /usr/bin 2>/dev/null
+		/usr/bin /usr/bin -eu awk ${HOME} readonly x=1 x=1 | readonly
+		grep 2>/dev/null grep -eu then echo -eu
+		${HOME} readonly --verbose ${HOME} then test local done cd && "$1" /usr/bin cd
+		cd x=1 /usr/bin "$@" then cd ${HOME}
+		--verbose /usr/bin cd 'quoted text'
+	grep /usr/bin "$@" printf awk && ${HOME} && done printf --verbose awk 2>/dev/null
+${HOME} | done && "$1" x=1 "$1" local | -eu
+	sed grep -eu grep && && cd local test done ${HOME} x=1 done -eu --verbose
+grep grep ${HOME} && echo
+		"$1" cd grep then readonly local $(pwd)
+		awk "$@" sed readonly awk $(pwd) readonly test readonly grep "$1" then "$1"
+		2>/dev/null printf readonly grep --verbose "$@" $(pwd) grep
+		-eu | 2>/dev/null x=1 export grep | --verbose "$1" done 2>/dev/null
+		printf export "$1" "$@" /usr/bin
+sed sed -eu ${HOME} ${HOME} x=1 "$@" ${HOME} export grep $(pwd) echo
+	/usr/bin 'quoted text' printf printf test local /usr/bin readonly ${HOME} test
+sed | local printf "$@" "$1" export /usr/bin cd test
+${HOME} awk test "$@" ${HOME} /usr/bin
+done "$@" 'quoted text' awk grep
+	test /usr/bin -eu "$1" local 'quoted text' cd ${HOME}
+		cd ${HOME} -eu test awk readonly ${HOME} then then echo
+sed 2>/dev/null x=1 sed 2>/dev/null $(pwd) sed -eu $(pwd) done | then
+/usr/bin then echo printf /usr/bin sed $(pwd) x=1 export x=1 grep x=1 local
+		--verbose done local printf awk x=1 then
+		readonly readonly "$@"
+		readonly awk echo && && awk
+	test x=1 local "$@" $(pwd) test ${HOME} cd readonly 'quoted text' readonly "$1"
+	sed readonly x=1 "$@" readonly export "$@" awk 'quoted text' /usr/bin echo
+then test then x=1 echo awk 'quoted text'
+		| test done awk ${HOME} done | /usr/bin "$@" export x=1
+		$(pwd) printf readonly export -eu then then ${HOME}
+		&& /usr/bin x=1 awk test test test 2>/dev/null cd readonly $(pwd) /usr/bin
+		test ${HOME} ${HOME} ${HOME}
+$(pwd) cd local "$@" && export done echo | ${HOME}
+-eu /usr/bin "$1" export printf awk "$@" cd --verbose export done
+	echo && export sed && x=1 ${HOME} "$1" --verbose | 2>/dev/null $(pwd) awk
+	$(pwd) awk 'quoted text' local printf
+		local echo readonly ${HOME} test ${HOME} 'quoted text' then
+${HOME} test ${HOME} awk x=1 done local | --verbose test
+		cd && export -eu grep then export $(pwd)
+	sed $(pwd) --verbose awk -eu "$@" 'quoted text' $(pwd)
+	2>/dev/null then local export && x=1 -eu
+	done -eu ${HOME} done $(pwd) "$1" ${HOME} printf sed grep 2>/dev/null
+| "$1" | local | --verbose $(pwd) done local then
+		grep grep cd done 'quoted text' done --verbose sed "$1"
+		local done grep readonly "$1" "$1" then ${HOME} then
+x=1 | awk 'quoted text' printf ${HOME} -eu
+awk grep awk awk readonly grep local awk
+		export local echo done /usr/bin
+		/usr/bin grep | /usr/bin && export ${HOME} then
+		| export ${HOME} printf 'quoted text' readonly "$@" sed sed ${HOME} ${HOME}
+--verbose export 'quoted text'
+		/usr/bin /usr/bin sed ${HOME}
+	awk export then /usr/bin -eu test "$1" printf export cd test $(pwd) cd local sed
+	-eu $(pwd) then echo -eu
+"$1" 'quoted text' printf then | "$1"
+	'quoted text' sed -eu cd -eu x=1
+2>/dev/null $(pwd) echo | /usr/bin
+	then && local && --verbose done local export /usr/bin cd 'quoted text'
+	"$@" 2>/dev/null /usr/bin /usr/bin sed export && sed local 2>/dev/null awk
+awk sed | grep ${HOME} awk "$@" awk ${HOME}
+2>/dev/null 'quoted text' test | --verbose
+	cd printf grep /usr/bin x=1 ${HOME}
+		"$@" sed export x=1 cd $(pwd) awk local local
+--verbose awk printf local awk 'quoted text'
+		"$@" echo 2>/dev/null sed 2>/dev/null printf local
+local $(pwd) $(pwd) cd test
+| --verbose -eu /usr/bin printf printf local --verbose
+printf /usr/bin awk done readonly
+printf 'quoted text' /usr/bin 'quoted text'
+	'quoted text' x=1 awk
+	&& cd "$1" "$@" printf ${HOME} /usr/bin -eu | x=1 export
+	test ${HOME} 'quoted text' test test printf test echo readonly && --verbose
+		$(pwd) "$@" then then && 2>/dev/null
+'quoted text' --verbose sed "$1" x=1 test local 2>/dev/null && ${HOME}
+export awk local x=1 ${HOME} test | && then cd | "$1" printf 2>/dev/null
+	export --verbose x=1 grep -eu | grep && -eu cd ${HOME}
+printf local echo 2>/dev/null "$@" /usr/bin printf ${HOME} grep
+		$(pwd) ${HOME} readonly awk test
+'quoted text' | --verbose "$1" && "$1" printf then -eu local cd printf printf
+cd done --verbose test export ${HOME} local grep export then
+"$1" -eu done export then 2>/dev/null done
+then 'quoted text' 'quoted text' done ${HOME} | 'quoted text' "$@"
+-eu awk -eu 2>/dev/null local done done "$@" "$1" ${HOME} awk local cd printf
+		done cd printf | ${HOME}
+	grep printf test awk 2>/dev/null then --verbose /usr/bin echo -eu && ${HOME}
+awk 2>/dev/null -eu then test grep 2>/dev/null
+"$1" x=1 done done done $(pwd) sed cd &&
+export echo $(pwd) echo | local sed grep && sed export x=1
+	done cd --verbose $(pwd) /usr/bin --verbose done
+	grep printf 'quoted text' 'quoted text' x=1 printf -eu | test "$1" | readonly
+		export local --verbose test then then "$1" test --verbose 2>/dev/null
+		test sed --verbose then /usr/bin 2>/dev/null
+x=1 awk --verbose "$1" ${HOME} 'quoted text' sed $(pwd) /usr/bin local printf
+	| --verbose grep grep sed ${HOME} sed
+	| test "$@" x=1 $(pwd) then done echo "$1" awk 2>/dev/null "$1" /usr/bin
+${HOME} x=1 $(pwd) local --verbose 2>/dev/null test grep test --verbose echo
+		x=1 local ${HOME} export --verbose | grep awk /usr/bin | --verbose
+	x=1 "$@" $(pwd) 'quoted text' cd awk grep 2>/dev/null readonly
+'quoted text' -eu "$1" "$@" | 2>/dev/null
+	local "$@" local readonly | sed -eu 2>/dev/null cd "$1" local then && sed test
+		grep -eu 'quoted text' --verbose --verbose cd awk $(pwd)
+'quoted text' | export printf
+cd readonly cd | done local awk cd local /usr/bin
+readonly ${HOME} "$1" done grep $(pwd)
+		local sed sed /usr/bin $(pwd) cd 'quoted text' x=1 awk | sed echo 2>/dev/null
+	export ${HOME} cd cd | "$1" printf $(pwd) echo |
+	cd grep && local readonly test 2>/dev/null done
+awk test grep printf printf 2>/dev/null done
+		test then ${HOME} then -eu $(pwd) readonly && &&
+readonly | x=1 $(pwd) export /usr/bin $(pwd)
+	export ${HOME} done -eu
+		echo grep test done $(pwd) awk export $(pwd) sed done "$1" /usr/bin
+${HOME} awk ${HOME} -eu && cd
+readonly done sed awk cd echo ${HOME}
+		/usr/bin cd && 'quoted text' -eu | cd 2>/dev/null
+		echo grep cd "$@" $(pwd) awk printf ${HOME} -eu /usr/bin | cd |
+		readonly local test | echo | -eu /usr/bin grep readonly printf local 'quoted text'
+then cd /usr/bin awk echo export
+		sed 'quoted text' sed $(pwd) --verbose
+	local local 'quoted text'
+	/usr/bin --verbose 'quoted text'
+		&& sed printf "$@" | /usr/bin test grep "$1"
+	cd ${HOME} grep $(pwd) cd test grep grep awk
+		"$@" -eu 2>/dev/null 2>/dev/null echo grep "$1" test "$1" $(pwd) done export
+		sed | printf done 'quoted text' then --verbose
+	readonly && test readonly done then done awk -eu 2>/dev/null
+		&& readonly -eu $(pwd) 'quoted text' && cd then
+cd x=1 /usr/bin $(pwd) test -eu $(pwd) "$1" printf | printf export done
+		"$@" ${HOME} x=1 grep "$@" x=1
+-eu printf awk x=1 ${HOME}
+	local 2>/dev/null "$@" 2>/dev/null awk 'quoted text' 2>/dev/null "$1" export 2>/dev/null
+		/usr/bin local then $(pwd) test echo ${HOME}
+/usr/bin | && then "$@" | local
+--verbose test printf sed --verbose &&
+	'quoted text' done | readonly local
+		done awk 2>/dev/null cd echo
+	export test --verbose then "$1" echo 'quoted text' -eu | /usr/bin --verbose --verbose
+	"$@" /usr/bin export export local readonly &&
+	printf grep "$1" "$@" printf --verbose
+grep local grep /usr/bin export -eu && "$@" test "$1" grep -eu
+		printf then "$1" /usr/bin -eu &&
+awk echo x=1 x=1 test ${HOME} printf x=1 "$@"
+$(pwd) && readonly ${HOME} export test --verbose 2>/dev/null
+		2>/dev/null done ${HOME} awk sed "$1" 2>/dev/null
+		readonly && "$1" "$1" && test $(pwd) echo "$1" "$@" export "$1" printf export
+	"$@" cd printf /usr/bin
+2>/dev/null | 'quoted text' test "$1" test
+| sed 2>/dev/null then done echo grep echo then x=1 sed export readonly
+	"$@" -eu --verbose done && export
+	x=1 readonly readonly sed echo
+	printf test "$1" sed 'quoted text' grep sed $(pwd) grep -eu test printf readonly
+sed 2>/dev/null "$1" ${HOME} "$1" echo awk grep | 2>/dev/null "$@"
+	| x=1 'quoted text' && readonly | done x=1 /usr/bin cd printf && $(pwd) then awk
+-eu ${HOME} echo awk --verbose 2>/dev/null --verbose
+-eu x=1 then echo test | ${HOME}
+sed test 'quoted text' awk --verbose cd 'quoted text'
+	'quoted text' && readonly readonly
+		| | -eu printf then 2>/dev/null
+test local readonly printf $(pwd) x=1 -eu | "$1" -eu echo --verbose awk
+sed cd $(pwd) local ${HOME} sed cd /usr/bin ${HOME} awk test /usr/bin
+		"$@" 'quoted text' "$@" test | x=1 done echo echo local
+		$(pwd) 'quoted text' test | && grep done | done x=1 grep grep then sed
+	local -eu printf $(pwd) 'quoted text' | "$1" test then
+	-eu echo echo test local 'quoted text' "$1" /usr/bin && export 'quoted text'
+	grep ${HOME} $(pwd) 2>/dev/null printf local grep x=1
+"$@" "$1" export /usr/bin readonly $(pwd)
+	awk readonly export export 'quoted text' | then 2>/dev/null done -eu printf $(pwd)
+sed done sed 2>/dev/null ${HOME} /usr/bin sed /usr/bin done local readonly -eu
+		readonly awk 2>/dev/null printf /usr/bin | && 'quoted text' "$1" test 2>/dev/null
+echo "$1" "$@" awk /usr/bin printf
+	awk $(pwd) --verbose sed test | readonly
+		awk x=1 x=1 2>/dev/null then "$@" && x=1
+		| /usr/bin readonly 'quoted text'
+		| -eu export then cd cd sed cd -eu grep test grep ${HOME}
+	&& printf then 'quoted text' then done
+		test done then test /usr/bin ${HOME} "$1" | sed printf
+test | test test grep cd grep ${HOME} | printf cd 2>/dev/null
+	${HOME} awk sed then test cd 2>/dev/null
+		'quoted text' 2>/dev/null $(pwd) | /usr/bin 2>/dev/null
+		cd --verbose "$@" "$1" "$1" local
+		local && 'quoted text' test awk grep 'quoted text' && 'quoted text'
+	grep test "$1" grep ${HOME}
+cd awk done grep cd ${HOME} test awk grep
+grep test 2>/dev/null local && 'quoted text' local "$@" 'quoted text'
+		/usr/bin grep sed awk ${HOME} echo export && ${HOME} ${HOME} test -eu done
+| grep "$@" readonly x=1 readonly
+		done readonly -eu readonly test readonly 2>/dev/null --verbose /usr/bin
+	grep 2>/dev/null grep then && x=1 then
+cd /usr/bin 'quoted text' ${HOME}
+printf | echo grep echo test "$1" 2>/dev/null --verbose then $(pwd)
+'quoted text' x=1 test "$1" x=1 done cd local
+		export 'quoted text' "$@" test then "$1" done cd "$@" "$@"
+$(pwd) done "$1" cd then
+'quoted text' -eu cd && | 2>/dev/null
+		&& grep $(pwd) $(pwd) cd && grep ${HOME} "$1" "$@" --verbose
+		printf x=1 echo "$1" ${HOME} grep cd
+	${HOME} readonly /usr/bin -eu printf 2>/dev/null readonly ${HOME} |
+		${HOME} export printf 'quoted text' done "$1" && -eu
+	then 2>/dev/null then "$1" "$1" grep
+	export done done 'quoted text' x=1 --verbose sed && 2>/dev/null 2>/dev/null test
+&& && | && "$@" && grep
+		2>/dev/null local local --verbose /usr/bin local printf sed --verbose
+		echo ${HOME} readonly 2>/dev/null --verbose grep local
+	${HOME} -eu local "$@"
+test 2>/dev/null "$@" "$@" 2>/dev/null "$@" "$@" sed echo cd
+	2>/dev/null readonly -eu then then 2>/dev/null
+'quoted text' "$@" "$@" readonly
+		cd export sed awk printf readonly export then cd cd
+	--verbose 2>/dev/null ${HOME} -eu $(pwd) done -eu &&
+		| x=1 done "$1" 'quoted text'
+	${HOME} && ${HOME} | x=1 export
+echo 2>/dev/null echo /usr/bin printf
+		'quoted text' "$1" printf 2>/dev/null test
+		$(pwd) && ${HOME} grep then
+		/usr/bin then "$@" "$1" 2>/dev/null grep grep export sed
+	test cd grep $(pwd) "$@" grep cd then grep /usr/bin awk /usr/bin -eu
+export local awk printf -eu "$@" done export "$1" /usr/bin "$1"
+sed "$@" "$1" done "$@" /usr/bin ${HOME} "$1" $(pwd) cd cd -eu local x=1 export
+	export printf test && sed sed then local $(pwd) 2>/dev/null export cd export 2>/dev/null
+		--verbose && cd ${HOME} $(pwd) sed readonly $(pwd) "$1" x=1 "$@" sed
+2>/dev/null 'quoted text' && 'quoted text'
+/usr/bin cd 'quoted text' cd --verbose "$1" | then sed 'quoted text'
+-eu cd && export awk sed
+	awk local "$1" then test /usr/bin then cd 'quoted text' readonly echo
+'quoted text' /usr/bin cd sed -eu then "$@" sed then test 'quoted text' done printf
+	readonly -eu test 'quoted text' "$@"
+		2>/dev/null awk -eu | test
+-eu $(pwd) printf grep printf cd --verbose
+		/usr/bin export cd test
+-eu printf | /usr/bin 'quoted text' --verbose && test
+		${HOME} grep | echo /usr/bin export cd done sed ${HOME} /usr/bin
+		export -eu && /usr/bin x=1 local
+2>/dev/null /usr/bin /usr/bin done echo x=1 /usr/bin
+	$(pwd) test -eu local ${HOME} "$1" done "$1" local | export $(pwd) awk done
+'quoted text' "$@" export 2>/dev/null "$1" -eu /usr/bin local printf
+cd readonly && local awk 2>/dev/null | | x=1 "$@" echo done "$@" grep /usr/bin
+$(pwd) "$1" x=1 then | readonly export -eu printf ${HOME} export local test $(pwd)
+test local done 2>/dev/null "$1" echo printf
+		then /usr/bin printf sed "$1"
+	-eu "$1" 2>/dev/null /usr/bin done
+		awk "$1" echo sed then 'quoted text' && done
+		$(pwd) then -eu /usr/bin
+	'quoted text' awk $(pwd) cd echo "$1" &&
+	export echo "$@" && -eu 'quoted text'
+	"$1" grep "$1" echo 'quoted text' export $(pwd)
+	local $(pwd) x=1 local x=1 x=1 "$@" export test echo x=1 | test printf export
+	export $(pwd) done "$1" printf $(pwd) sed test export
+		"$1" awk --verbose grep && ${HOME} then -eu export test done x=1
+	"$1" local grep --verbose
+		sed cd test awk ${HOME} local 2>/dev/null printf /usr/bin /usr/bin
+grep grep done done sed ${HOME} "$1"
+		"$1" "$@" cd awk sed echo 2>/dev/null && test then local
+	2>/dev/null | x=1 2>/dev/null readonly x=1
+${HOME} echo cd local then
+	$(pwd) export 2>/dev/null export then -eu then && $(pwd) local export grep
+	2>/dev/null | echo sed | then ${HOME} ${HOME} $(pwd) printf
+'quoted text' 'quoted text' awk --verbose local ${HOME} 2>/dev/null -eu
+	--verbose test export $(pwd) export sed "$1" done local
+$(pwd) --verbose | x=1 sed printf local printf export /usr/bin
+	'quoted text' $(pwd) echo | $(pwd) awk 2>/dev/null x=1 printf "$1"
+	${HOME} | local /usr/bin -eu cd echo "$@" readonly cd readonly then
+		sed --verbose awk 'quoted text' awk /usr/bin awk "$1" done "$@" done
+		printf export echo -eu 2>/dev/null grep
+	local test awk -eu "$1"
+		readonly echo test 2>/dev/null /usr/bin "$@" 2>/dev/null
+	"$@" local then awk "$1" | echo then echo done test $(pwd)
+		2>/dev/null cd 'quoted text' printf echo
+	done -eu /usr/bin "$1" && $(pwd) export 'quoted text' grep
+printf echo | x=1 test "$1" "$1" local
+cd printf readonly local 'quoted text'
+	"$1" awk 'quoted text'
+cd ${HOME} readonly --verbose sed 2>/dev/null printf local
+		then local done | test &&
+		sed | $(pwd) 'quoted text' && ${HOME} export test "$1" | test awk
+		sed local cd printf --verbose && printf done test awk "$1" grep
+		done x=1 cd readonly grep ${HOME} awk printf export
+	readonly "$@" readonly | --verbose test | 'quoted text' export export "$1"
+		-eu test readonly local awk 'quoted text' | cd | | export awk ${HOME}
+${HOME} test export -eu export
+	awk printf -eu awk --verbose printf
+	"$@" cd test export done grep awk export awk then export awk grep
+		/usr/bin then echo -eu
+		export && cd printf done --verbose grep /usr/bin --verbose
+	awk echo $(pwd) 2>/dev/null grep local && cd /usr/bin grep then local test
+	--verbose cd ${HOME} cd ${HOME} -eu awk awk 2>/dev/null $(pwd)
+	export printf then then test readonly test
+"$1" export grep ${HOME} awk
+-eu sed "$@" && sed sed printf awk awk readonly
+then then ${HOME} "$1" then readonly "$@"
+| grep 2>/dev/null local awk then echo x=1 && | "$1" echo 2>/dev/null test
+		echo done --verbose 'quoted text' /usr/bin $(pwd) local local -eu "$1" readonly
+	printf --verbose awk 'quoted text' --verbose grep readonly echo grep
+x=1 cd /usr/bin grep then x=1 then then x=1 awk awk
+	test $(pwd) export printf local echo sed && x=1 && then done sed
+		export readonly sed readonly /usr/bin 'quoted text'
+		| cd echo done done grep done local done "$@" |
+	--verbose local && x=1 | echo export | grep done 2>/dev/null
+2>/dev/null /usr/bin printf x=1 awk export echo readonly
+		2>/dev/null 'quoted text' && done local export printf ${HOME} cd "$1" ${HOME} "$1"
+	-eu sed x=1 && local echo printf readonly test grep "$@" cd readonly
+		2>/dev/null sed $(pwd) grep $(pwd)
+$(pwd) "$@" cd ${HOME} export /usr/bin $(pwd)
+awk "$@" awk -eu $(pwd) -eu grep cd ${HOME} done done 'quoted text'
+		| /usr/bin 'quoted text' printf cd grep local && test grep /usr/bin echo done
+then done then $(pwd) "$1" && test done
+		test 2>/dev/null $(pwd)
+	/usr/bin 2>/dev/null $(pwd) "$@" &&
+		awk --verbose ${HOME} sed | grep 'quoted text' "$1" -eu --verbose
+-eu grep | cd -eu | local
+		--verbose 'quoted text' test x=1
+		2>/dev/null | /usr/bin awk
+cd grep | $(pwd) export "$1" cd 2>/dev/null
+		-eu export readonly $(pwd) done "$@" awk sed printf cd -eu then export echo $(pwd)
+	2>/dev/null test readonly ${HOME} then $(pwd) export
+then printf export readonly
+		$(pwd) local done | "$@" awk /usr/bin done grep /usr/bin $(pwd) sed x=1 awk
+		local export -eu test -eu "$@" && 2>/dev/null
+${HOME} cd | test /usr/bin "$@"
+	${HOME} printf local "$@" readonly /usr/bin sed x=1
+		"$1" | /usr/bin -eu grep readonly done export | export 'quoted text'
+		export 'quoted text' $(pwd) grep | /usr/bin
+	export $(pwd) $(pwd) | done awk --verbose then test -eu echo && &&
+test "$@" 'quoted text' printf
+		awk ${HOME} x=1 'quoted text'
+	export readonly /usr/bin grep "$@" readonly readonly sed -eu
+	then x=1 awk /usr/bin "$1" done 'quoted text' test local "$@" x=1 sed "$@" ${HOME}
+local --verbose && printf
+then awk awk sed "$@" ${HOME} $(pwd) x=1 && ${HOME} readonly $(pwd) cd cd && ${HOME}
+		'quoted text' cd 'quoted text' ${HOME} 'quoted text'
+	done sed sed /usr/bin test
+		| then done "$1" sed sed cd awk
+then "$1" sed | cd cd awk && local $(pwd) echo
+		grep /usr/bin printf then $(pwd) ${HOME} -eu done sed "$1" printf "$@" /usr/bin
+test grep awk "$@" && x=1 --verbose 'quoted text' -eu --verbose $(pwd)
+then $(pwd) export echo
+	2>/dev/null grep cd echo cd $(pwd)
+test 'quoted text' | local sed "$1" grep readonly /usr/bin
+	/usr/bin -eu printf 2>/dev/null
+		$(pwd) ${HOME} cd local test echo
+grep 'quoted text' --verbose done awk test "$1" readonly 'quoted text'
+	"$1" && | /usr/bin cd export grep
+	-eu test echo grep printf awk $(pwd) printf readonly x=1 && done /usr/bin /usr/bin
+test 'quoted text' -eu test "$@" -eu 'quoted text' ${HOME} export && -eu 2>/dev/null
+	x=1 "$1" export sed grep "$@" then /usr/bin grep
+/usr/bin cd readonly "$@" ${HOME} test 'quoted text' echo
+		export printf readonly local && $(pwd) done then
+local readonly | readonly cd awk "$@"
+		-eu && $(pwd) /usr/bin "$@" | "$@" -eu
+$(pwd) 'quoted text' grep x=1 done ${HOME} local done "$@" sed | 'quoted text'
+	$(pwd) && cd awk readonly --verbose $(pwd) cd "$1" 2>/dev/null $(pwd) export
+	test 'quoted text' 2>/dev/null export readonly echo
+"$1" printf --verbose 2>/dev/null -eu --verbose then cd done local printf
+--verbose x=1 $(pwd) echo export then -eu sed
+done local export awk done test
+		| local echo | x=1 grep "$1" 2>/dev/null /usr/bin --verbose
+		${HOME} awk | "$@" echo local printf awk printf
+		--verbose | printf --verbose /usr/bin echo export done
+printf && -eu | test awk grep printf 'quoted text'
+		done cd | done x=1 && --verbose
+	"$@" readonly 2>/dev/null | cd ${HOME}
+	--verbose -eu printf $(pwd) ${HOME} local then echo awk $(pwd) "$@" echo ${HOME}
+	awk test $(pwd) 2>/dev/null ${HOME} /usr/bin local echo test
+local 2>/dev/null $(pwd) | --verbose --verbose echo "$@" --verbose export 2>/dev/null
+-eu then 'quoted text' echo 2>/dev/null
+		x=1 grep sed $(pwd) local && sed awk "$1" export $(pwd) | 'quoted text'
+	readonly grep printf export test ${HOME} grep test && x=1 export test
+| test | "$1" /usr/bin
+	readonly x=1 "$@" grep export cd &&
+/usr/bin done then grep echo x=1 x=1
+		awk then printf test ${HOME} printf 'quoted text'
+	grep $(pwd) awk echo $(pwd) test export x=1 x=1 /usr/bin printf awk
+		--verbose --verbose -eu export printf &&
+	-eu test awk local $(pwd)
+		$(pwd) then "$1" 2>/dev/null 'quoted text' && test readonly
+		--verbose 'quoted text' --verbose readonly sed test printf readonly
+	&& --verbose echo done 2>/dev/null
+		echo printf "$@" export grep 'quoted text' "$1" $(pwd) cd "$1" printf -eu ${HOME}
+	2>/dev/null --verbose export export done cd awk --verbose 2>/dev/null export x=1
+printf test $(pwd) x=1 sed 2>/dev/null export test --verbose ${HOME} && --verbose
+	printf local --verbose "$@" then test --verbose $(pwd) readonly test
+		/usr/bin local sed /usr/bin awk
+		| echo sed -eu then -eu sed test 2>/dev/null x=1 | grep printf | echo "$1"
+cd sed printf -eu awk /usr/bin x=1 ${HOME} ${HOME} printf | export
+		--verbose 2>/dev/null x=1 2>/dev/null -eu
+/usr/bin /usr/bin && /usr/bin 'quoted text'
+		awk printf "$@" ${HOME} $(pwd) export
+		"$@" | printf echo readonly "$@" awk -eu awk x=1 x=1 test
+awk printf test --verbose awk sed test && "$1" | then -eu export
+	awk $(pwd) cd local done $(pwd) 'quoted text' echo grep 2>/dev/null
+	${HOME} cd printf $(pwd) "$1" --verbose "$1" then $(pwd) && "$@" done readonly
+		$(pwd) "$@" -eu x=1 && done local -eu ${HOME} grep then "$1" x=1 local x=1
+		sed done 'quoted text' && 2>/dev/null --verbose echo readonly
+	local --verbose ${HOME} printf
+	x=1 test --verbose 2>/dev/null
+		then export && readonly 'quoted text' done cd $(pwd) local echo 2>/dev/null
+	${HOME} x=1 "$1" "$1" echo cd x=1 ${HOME} echo printf local 2>/dev/null
+awk x=1 printf x=1 test /usr/bin 'quoted text' then cd done
+		then echo printf readonly sed echo grep
+export done export printf echo /usr/bin
+/usr/bin test x=1 readonly &&
+		done | echo printf local 2>/dev/null 'quoted text' | done --verbose
+done export then test "$1" "$@" grep -eu export readonly "$1" ${HOME}
+		local printf local x=1 2>/dev/null
+	test 'quoted text' echo grep readonly |
+&& readonly "$1" readonly
+"$@" test grep export x=1 "$@" --verbose printf 2>/dev/null
+	${HOME} --verbose sed ${HOME} readonly
+--verbose -eu readonly
+		sed sed ${HOME} echo sed export /usr/bin cd 'quoted text'
+		export printf echo echo sed readonly echo test cd /usr/bin local "$@" then
+		| "$@" | cd "$1" /usr/bin echo awk -eu $(pwd) && "$1" test "$1" && done sed
+cd ${HOME} && 'quoted text' echo
+$(pwd) done | x=1 awk --verbose -eu "$@"
+		cd && | "$1" ${HOME} printf grep $(pwd) cd local $(pwd)
+		'quoted text' sed echo local readonly grep sed grep
+		export echo local 'quoted text' test "$@" echo cd && | local local
+x=1 echo "$@" local export then export -eu test x=1 awk echo x=1 done awk
+		$(pwd) export | sed -eu export done cd /usr/bin 2>/dev/null local echo
+/usr/bin -eu ${HOME} 'quoted text'
+	x=1 echo -eu 2>/dev/null test x=1
+		"$@" ${HOME} "$@" printf grep $(pwd) "$1" sed awk local -eu ${HOME} cd test
+		test /usr/bin test done readonly "$1" | awk local echo && export --verbose
+		x=1 grep sed test sed echo test $(pwd) ${HOME} x=1 -eu |
+${HOME} local export $(pwd) grep ${HOME}
+		"$@" "$1" cd test cd printf echo cd local $(pwd) $(pwd) && | "$1" local printf "$1"
+		'quoted text' readonly done readonly cd ${HOME} awk awk awk --verbose done
+		local "$1" test then x=1 local "$@" grep 'quoted text' --verbose grep |
+	$(pwd) awk sed then $(pwd)
+${HOME} sed 2>/dev/null --verbose 'quoted text' sed -eu ${HOME} then x=1 echo grep
+'quoted text' readonly ${HOME} 2>/dev/null | --verbose
+		&& cd 'quoted text' test "$@" echo test "$1" export done test
+		"$1" then awk then sed 'quoted text' ${HOME} local
+	grep | x=1 then printf done readonly test -eu /usr/bin
+		awk awk test printf test sed test /usr/bin awk readonly /usr/bin
+echo /usr/bin $(pwd) -eu readonly $(pwd) 'quoted text'
+'quoted text' "$1" $(pwd) -eu sed awk /usr/bin local 2>/dev/null "$@" readonly
+2>/dev/null "$1" awk && then --verbose local sed echo /usr/bin
+		"$@" awk 2>/dev/null printf awk --verbose "$1" awk then x=1 export
+		then ${HOME} | cd local then
+grep x=1 | | ${HOME} && export test $(pwd) printf
+		then cd 2>/dev/null echo
+	readonly | echo sed sed test export && | readonly | done
+		"$1" printf echo export readonly 'quoted text'
+	-eu export done cd x=1 "$@" -eu grep x=1 sed then sed export
+	| ${HOME} sed done echo
+&& export local $(pwd)
+	cd echo && -eu local ${HOME} 2>/dev/null
+$(pwd) then grep && --verbose x=1 then
+		&& --verbose grep test printf sed "$1" -eu then && ${HOME} cd "$1" x=1
+	| printf 2>/dev/null && done then x=1 cd /usr/bin "$@" && x=1 echo
+		export local local /usr/bin x=1 cd export local sed 'quoted text' echo && &&
+done && ${HOME} echo && readonly "$@" cd readonly
+		printf test sed done grep "$@" 2>/dev/null then
+export /usr/bin "$@" x=1 'quoted text' grep local readonly
+printf sed cd then | cd export /usr/bin then && test readonly && done
+		awk printf readonly /usr/bin test done printf 'quoted text'
+		"$@" cd grep export export export 2>/dev/null
+		-eu ${HOME} test "$@" sed 'quoted text' x=1 printf
+	/usr/bin done | x=1 | 'quoted text'
+		local export "$1" 'quoted text' sed x=1 then
+	"$@" && -eu export local then "$1" readonly |
+	"$1" 2>/dev/null | printf --verbose echo done grep sed test cd local
+	export sed local 'quoted text' grep | sed grep &&
+$(pwd) done then awk --verbose -eu test ${HOME} printf test x=1
+--verbose local ${HOME} test x=1 ${HOME} $(pwd) "$1" printf --verbose
+		readonly done $(pwd) awk done --verbose
+		cd then local sed $(pwd) | readonly -eu export /usr/bin 'quoted text'
+		done 2>/dev/null "$@" awk /usr/bin --verbose cd grep "$1" local local 2>/dev/null
+		done $(pwd) && grep export x=1 then -eu then -eu -eu ${HOME} echo cd
+		2>/dev/null && cd grep done x=1 printf local sed
+	export ${HOME} local "$1" test awk export 2>/dev/null
+		sed printf && cd cd export awk | "$1" -eu then 2>/dev/null
+		--verbose grep | 'quoted text' echo ${HOME} ${HOME} &&
+'quoted text' sed local /usr/bin
+		readonly awk printf | awk $(pwd) ${HOME} grep export $(pwd)
+printf $(pwd) && | && export
+	export | 2>/dev/null echo
+		$(pwd) sed --verbose echo printf "$1"
+	--verbose | grep "$@" then x=1 echo $(pwd) done --verbose test grep 'quoted text'
+| 2>/dev/null /usr/bin grep x=1 grep
+cd 'quoted text' "$@" --verbose export echo done "$@"
+	${HOME} cd "$@" && /usr/bin "$@" cd "$@" printf && test then $(pwd)
+	$(pwd) grep test cd /usr/bin /usr/bin ${HOME} $(pwd) printf | then && grep
+	then $(pwd) awk done done
+		--verbose cd printf ${HOME} cd 'quoted text' x=1 && "$1" | x=1 awk grep
+--verbose awk | "$@" --verbose
+	$(pwd) | --verbose /usr/bin sed then 'quoted text' printf
+-eu grep | ${HOME} x=1 /usr/bin ${HOME} 2>/dev/null awk 2>/dev/null readonly
+	local 2>/dev/null x=1 /usr/bin export
+	export --verbose 2>/dev/null -eu 'quoted text' "$1" done cd sed 2>/dev/null
+echo "$1" local local | 'quoted text' && awk done | ${HOME} printf local 'quoted text'
+		local local sed 2>/dev/null | then export export "$1" done ${HOME} sed --verbose
+/usr/bin x=1 printf local done grep /usr/bin x=1 /usr/bin 'quoted text'
+	'quoted text' -eu export | "$@" "$1" cd echo done ${HOME} readonly
+		grep x=1 then sed printf then printf $(pwd) --verbose echo
+-eu /usr/bin test sed | grep | grep readonly --verbose "$1" then grep
+		--verbose | 2>/dev/null "$1" export done awk grep readonly grep x=1 'quoted text'
+then test grep "$@" echo /usr/bin sed | test && /usr/bin local $(pwd) local
+"$1" $(pwd) 'quoted text' awk ${HOME} | then && /usr/bin readonly
+printf grep grep cd export echo test printf 'quoted text' /usr/bin local
+		local --verbose grep /usr/bin export --verbose -eu /usr/bin sed sed printf test
+	'quoted text' /usr/bin 'quoted text' -eu grep grep test local && ${HOME}
+	'quoted text' grep "$1" 2>/dev/null cd -eu $(pwd) -eu && "$@"
+$(pwd) 2>/dev/null /usr/bin | awk && printf
+x=1 -eu test test -eu sed ${HOME} awk x=1 cd then echo "$@" | grep
+"$@" --verbose | $(pwd) sed $(pwd) done grep
+echo local /usr/bin 2>/dev/null 2>/dev/null
+	cd -eu x=1 2>/dev/null "$1" ${HOME}
+		test -eu readonly /usr/bin done cd ${HOME} ${HOME} "$@" --verbose
+	| done "$1" done x=1 /usr/bin done local done | $(pwd) --verbose echo test
+		2>/dev/null local export --verbose "$@"
+cd cd awk echo sed then ${HOME}
+export readonly printf then 'quoted text' grep 2>/dev/null && done export
+	grep x=1 $(pwd) cd --verbose "$1"
+-eu | $(pwd) --verbose 2>/dev/null
+		grep grep "$1" echo then done done "$@" ${HOME} sed 2>/dev/null
+printf -eu sed echo "$1" export 'quoted text' export "$@" awk readonly -eu x=1
+		x=1 -eu 'quoted text'
+	cd --verbose "$@" | export local readonly test test 2>/dev/null cd --verbose
+		$(pwd) | 'quoted text' x=1 /usr/bin "$1"
+export test local ${HOME} awk local "$@" grep 2>/dev/null printf echo 2>/dev/null
+		${HOME} then "$@" "$@" grep 2>/dev/null "$1" ${HOME} ${HOME}
+	${HOME} /usr/bin cd | x=1 local local sed /usr/bin
+/usr/bin $(pwd) sed ${HOME} 'quoted text' grep ${HOME} awk $(pwd) -eu readonly
+		| export echo local cd ${HOME} | awk
+-eu --verbose && sed awk --verbose --verbose
+		"$@" -eu printf then readonly | x=1 x=1 grep $(pwd) && "$@" test
+		"$@" -eu sed "$1" 'quoted text'
+		readonly 'quoted text' echo -eu -eu "$1" grep sed sed "$1" && 2>/dev/null then export
+	${HOME} local awk $(pwd) cd echo export "$@" 2>/dev/null
+	printf -eu grep 2>/dev/null test ${HOME} $(pwd) grep echo ${HOME} cd
+"$@" printf echo | | export echo grep awk local grep -eu then "$1"
+	/usr/bin echo | cd export
+test done done sed && echo "$@" export -eu local cd | | export $(pwd) sed echo
+		| 'quoted text' grep && echo 2>/dev/null $(pwd) local && cd grep
+'quoted text' -eu readonly | done $(pwd) "$@" "$@" export
+	awk /usr/bin awk local sed readonly "$1" printf grep awk export grep $(pwd) local
+		$(pwd) printf && "$1" test readonly local -eu local sed local
+	export ${HOME} echo && "$@" local
+'quoted text' 'quoted text' local 2>/dev/null then
+awk grep echo grep "$1" -eu ${HOME} sed
+	x=1 grep export "$1" $(pwd) --verbose done done
+	&& /usr/bin then -eu 2>/dev/null awk 'quoted text' local done -eu
+	$(pwd) then 2>/dev/null readonly local
+	done local echo x=1 echo sed ${HOME} done "$1" x=1 export
+cd && echo cd local done 'quoted text' /usr/bin sed sed
+/usr/bin --verbose export
+		export && export ${HOME} sed x=1 --verbose
+		2>/dev/null echo echo export
+		export local 'quoted text' 2>/dev/null | x=1 /usr/bin
+		-eu ${HOME} export awk grep ${HOME} test $(pwd) 'quoted text' grep
+	printf sed --verbose sed && sed /usr/bin printf echo --verbose test
+		awk test 'quoted text' grep done done cd "$1"
+		2>/dev/null $(pwd) done grep export $(pwd) ${HOME} then && | "$@"
+	| grep cd ${HOME} readonly export test --verbose ${HOME} /usr/bin
+	2>/dev/null export ${HOME}
+	readonly then cd | | 'quoted text' then printf test -eu echo printf
+		sed test 'quoted text' /usr/bin
+	"$@" echo --verbose awk cd
+	sed awk printf cd test 'quoted text' "$1" && printf
+		x=1 cd local ${HOME} grep readonly echo grep done 2>/dev/null
+	x=1 readonly 'quoted text' printf -eu test x=1 cd "$@" then grep 'quoted text'
+then test "$1" --verbose $(pwd) /usr/bin readonly export local /usr/bin $(pwd)
+printf x=1 'quoted text' "$1" done "$1" $(pwd) cd "$@" sed
+		readonly test "$1" --verbose sed grep
+	${HOME} ${HOME} "$@" && echo local $(pwd) "$1" --verbose 'quoted text'
+		"$@" done sed | "$1" $(pwd)
+	2>/dev/null test -eu | printf 'quoted text' x=1
+x=1 then echo "$1" echo && local $(pwd) 'quoted text' $(pwd) && grep
+		echo grep test --verbose
+sed cd ${HOME} grep -eu 2>/dev/null "$@" --verbose
+	export 'quoted text' echo grep export x=1 2>/dev/null sed
+	test ${HOME} ${HOME} ${HOME} echo cd done $(pwd) $(pwd) x=1
+	${HOME} "$@" cd sed export | "$1" | x=1 && && export readonly
+		grep echo printf echo export done printf -eu local awk && printf
+		echo /usr/bin test printf
+		then -eu --verbose done export --verbose
+--verbose export test sed ${HOME} "$@" -eu 2>/dev/null | &&
+		-eu | done ${HOME} grep -eu
+		awk done "$@" grep echo sed cd then
+	export x=1 printf /usr/bin -eu -eu done /usr/bin
+		readonly -eu && 'quoted text' && /usr/bin cd echo then
+	x=1 export local "$1" then $(pwd) sed ${HOME}
+		echo --verbose done echo --verbose export $(pwd) local "$@" printf /usr/bin $(pwd)
+		export --verbose readonly export
+printf local && $(pwd) -eu awk && $(pwd) "$1" x=1 -eu echo x=1 x=1
+		echo $(pwd) | "$1" --verbose 2>/dev/null cd 'quoted text' x=1 "$@" 'quoted text'
+		printf /usr/bin "$@" export ${HOME} cd -eu ${HOME} "$1" x=1
+		| echo readonly awk local --verbose -eu export awk done 2>/dev/null
+		printf cd $(pwd) cd done echo readonly export 'quoted text' ${HOME} 2>/dev/null
+--verbose awk -eu | "$1" -eu then awk 2>/dev/null printf sed readonly
+	readonly --verbose export local --verbose
+		"$@" then 'quoted text' && grep "$1" cd "$@"
+	export printf local local awk local | awk then cd printf grep
+		/usr/bin /usr/bin grep printf done echo export "$@" done grep echo && export
+echo local && ${HOME} then /usr/bin $(pwd)
+		grep "$@" -eu local -eu "$@" local
+		/usr/bin cd done && && echo "$@" export 'quoted text'
+		export grep --verbose | 'quoted text' -eu echo && x=1 x=1 grep
+${HOME} -eu "$@" awk | then readonly sed then | cd -eu
+	| awk | then echo 2>/dev/null /usr/bin local
+export then $(pwd) export test ${HOME} printf sed 'quoted text' --verbose
+		x=1 && "$1" --verbose sed 'quoted text' "$@" printf export /usr/bin readonly
+	x=1 ${HOME} && 2>/dev/null then && sed "$1" ${HOME} local awk
+	grep echo | grep echo done
+		"$@" test && /usr/bin sed --verbose | -eu --verbose export
+"$1" export 2>/dev/null ${HOME} awk
+		| sed printf | test grep && ${HOME} test echo
+		export readonly local export readonly && then x=1
+	then "$@" printf then done local -eu test test $(pwd) awk "$@" echo 2>/dev/null
+		'quoted text' awk then printf "$@" awk 'quoted text' printf $(pwd) export 2>/dev/null
+#include c85.sh
+		then done cd echo "$1" printf "$1" && cd x=1
+		| | 2>/dev/null "$1" 'quoted text' x=1 done local | | test ${HOME} readonly
+"$1" "$1" cd x=1 sed ${HOME} x=1
+-eu done grep ${HOME} x=1 done $(pwd) cd 2>/dev/null "$@" "$@" printf cd awk
+test test test cd printf /usr/bin grep then "$1"
+		$(pwd) x=1 readonly then ${HOME} done awk readonly | $(pwd) readonly "$1" ${HOME}
+	x=1 2>/dev/null && --verbose --verbose awk echo -eu grep printf
+	readonly /usr/bin -eu "$1" $(pwd) "$@" && cd "$@" cd done echo awk
+	'quoted text' printf cd then && ${HOME} then grep ${HOME}
+test local --verbose "$1" done then "$1" --verbose x=1 awk export
+	awk printf local awk then cd awk awk $(pwd) "$1" ${HOME} "$@"
+	sed ${HOME} echo then "$@" export -eu sed /usr/bin
+		&& "$1" echo export echo -eu /usr/bin -eu ${HOME} grep then /usr/bin "$1"
+then "$@" --verbose grep readonly -eu readonly local 2>/dev/null
+/usr/bin readonly $(pwd) $(pwd) local cd printf local -eu done readonly
+awk local /usr/bin x=1 "$1" echo "$@" readonly grep "$1" && x=1 -eu
+		grep done readonly "$1" 'quoted text' 2>/dev/null && cd | cd x=1 sed |
+	then | readonly export echo export awk -eu grep
+	&& /usr/bin done "$@" && readonly /usr/bin
+		cd echo sed local "$1" echo then local export then /usr/bin
+		then printf sed "$1" then readonly
+$(pwd) readonly -eu sed && test 'quoted text' --verbose grep "$1" ${HOME}
+	grep "$@" 2>/dev/null ${HOME} printf --verbose
+		readonly /usr/bin export printf
+${HOME} done then awk printf printf readonly then && -eu
+	${HOME} test then grep sed 2>/dev/null $(pwd) local sed
+	awk $(pwd) | cd local 2>/dev/null /usr/bin awk then "$@" $(pwd) "$@" sed
+-eu awk sed $(pwd) done
+		'quoted text' cd local && x=1 2>/dev/null test 'quoted text'
+sed test grep "$1" local ${HOME} test local
+		"$@" grep | export printf 'quoted text' 2>/dev/null echo "$@" printf
+	--verbose 'quoted text' awk /usr/bin done "$1" awk x=1
+	cd $(pwd) -eu 'quoted text'
+2>/dev/null 'quoted text' --verbose -eu /usr/bin $(pwd) printf ${HOME} x=1 "$@"
+		local readonly 'quoted text' x=1 2>/dev/null 2>/dev/null done $(pwd) 'quoted text'
+cd | awk test --verbose printf $(pwd) grep | sed grep ${HOME}
+printf | -eu test then cd "$1" --verbose done
+sed "$1" ${HOME} "$1" sed
+| readonly -eu /usr/bin
+		then echo done done awk 2>/dev/null && local test $(pwd)
+		| sed "$@" awk grep -eu x=1 cd && export export printf -eu awk "$1"
+	$(pwd) "$@" local /usr/bin done echo readonly 2>/dev/null ${HOME}
+		x=1 awk | done awk --verbose test "$1" | x=1
+	&& "$@" "$@" && && -eu /usr/bin echo test then grep
+	"$@" export --verbose
+then local 'quoted text' 'quoted text'
+	--verbose $(pwd) awk readonly then then 'quoted text' ${HOME} local
+		--verbose && /usr/bin 2>/dev/null awk | -eu /usr/bin awk then
+	--verbose printf 2>/dev/null "$1" awk cd $(pwd)
+	local x=1 local awk --verbose "$@" readonly && -eu export printf
+--verbose ${HOME} $(pwd) /usr/bin "$1" awk /usr/bin 'quoted text' /usr/bin
+	--verbose /usr/bin x=1 done grep --verbose done readonly
+		grep $(pwd) 2>/dev/null export "$@" x=1 test -eu ${HOME} 'quoted text' sed
+	done x=1 echo test x=1 grep "$@"
+export "$1" printf then "$@" | ${HOME} "$@" printf 2>/dev/null test "$1"
+${HOME} -eu $(pwd) 2>/dev/null
+test export then echo x=1 -eu /usr/bin ${HOME} done
+grep readonly /usr/bin 2>/dev/null printf x=1 export cd awk $(pwd) export
+${HOME} printf x=1 done | $(pwd) export export /usr/bin /usr/bin awk /usr/bin
+/usr/bin --verbose local --verbose cd export
+done x=1 | -eu /usr/bin 2>/dev/null /usr/bin
+	cd done test then local x=1 ${HOME}
+local readonly cd --verbose -eu -eu --verbose $(pwd) grep export
+	awk 'quoted text' 2>/dev/null x=1 printf
+/usr/bin 2>/dev/null --verbose local ${HOME} 2>/dev/null
+	"$@" echo -eu 'quoted text' && x=1 | local &&
+done grep then test $(pwd) sed --verbose -eu ${HOME} readonly printf
+printf 2>/dev/null "$1" 'quoted text' grep
+		'quoted text' test $(pwd) 'quoted text'
+	&& sed -eu echo printf sed grep then awk 2>/dev/null | | $(pwd)
+	${HOME} readonly $(pwd) -eu awk done $(pwd) awk export done "$@" "$@"
+export ${HOME} $(pwd) | | -eu then export 2>/dev/null
+printf x=1 2>/dev/null -eu /usr/bin printf x=1 "$1" test echo x=1 --verbose
+cd "$1" && "$1" /usr/bin printf x=1
+readonly printf printf then then --verbose export export awk 'quoted text' "$@"
+	test readonly --verbose
+cd local grep | grep readonly x=1 test "$@" ${HOME} readonly "$1" --verbose
+		'quoted text' export | | sed cd "$@" | -eu
+${HOME} 'quoted text'
+		readonly sed $(pwd) local export readonly && /usr/bin
+		"$@" local -eu done sed export grep "$1" 'quoted text'
+		&& $(pwd) -eu x=1 cd local | /usr/bin
+		--verbose | 'quoted text' "$1"
+	-eu echo echo 2>/dev/null --verbose --verbose
+		${HOME} grep export $(pwd) -eu
+${HOME} "$1" export readonly test cd test awk
+test printf cd grep 'quoted text'
+local && test grep -eu local x=1 awk then &&
+cd then readonly done 2>/dev/null
+"$@" cd x=1 ${HOME} 2>/dev/null test -eu 2>/dev/null
+readonly $(pwd) awk test done ${HOME} "$1" done sed
+readonly sed done ${HOME} printf $(pwd) cd --verbose
+then printf | sed awk done
+	sed "$@" done awk && "$@" grep grep
+		test "$1" sed then cd readonly export awk
+		2>/dev/null ${HOME} done done local -eu then
+readonly && 'quoted text' "$@" 'quoted text' readonly "$@" readonly
+	2>/dev/null "$1" x=1 grep test done awk 'quoted text'
+		&& && readonly sed | |
+grep /usr/bin | | echo test printf && 'quoted text' awk sed printf
+	2>/dev/null x=1 export -eu echo $(pwd) "$@" x=1
+$(pwd) 'quoted text' grep
+		export done -eu echo /usr/bin
+	export local local sed cd 'quoted text' awk export readonly 2>/dev/null
+	local /usr/bin sed 'quoted text' printf
+		grep --verbose && --verbose 2>/dev/null /usr/bin cd awk 2>/dev/null $(pwd)
+sed then cd readonly readonly awk export x=1 'quoted text'
+		/usr/bin local && done | && printf $(pwd)
+sed | sed then /usr/bin then test | 2>/dev/null then awk then export readonly
+		awk local -eu ${HOME} readonly -eu x=1 awk "$@" sed && "$1" $(pwd) 2>/dev/null
+		&& sed awk cd printf printf readonly | $(pwd) awk then echo --verbose --verbose
+	sed local | && -eu "$1" ${HOME} "$1" "$@" export -eu test sed "$1" /usr/bin x=1
+cd /usr/bin then --verbose "$1" sed local "$1" awk local sed --verbose
+	then export /usr/bin printf -eu -eu echo echo then done ${HOME} 'quoted text' &&
+	&& ${HOME} | 2>/dev/null export 'quoted text' 2>/dev/null x=1 $(pwd) readonly $(pwd)
+		'quoted text' export printf && export
+		x=1 x=1 "$1" 'quoted text' awk "$@" ${HOME}
+	readonly local cd awk grep test /usr/bin
+	"$@" --verbose 2>/dev/null done 2>/dev/null 'quoted text' && local
+		"$@" "$1" | 2>/dev/null done then $(pwd) test "$@" readonly
+${HOME} -eu -eu -eu $(pwd) && 'quoted text'
+		sed echo grep local && --verbose x=1
+x=1 done 2>/dev/null 'quoted text' -eu --verbose echo --verbose
+		sed | printf test test "$@" awk ${HOME} done cd readonly grep
+	"$1" local echo printf 'quoted text' x=1 printf | readonly -eu echo export awk
+	x=1 local && 2>/dev/null done $(pwd) then test
+cd ${HOME} | $(pwd) "$@" 2>/dev/null awk sed "$@" export
+		"$1" done "$1" $(pwd) --verbose /usr/bin ${HOME} test done awk
+	"$1" 2>/dev/null echo 2>/dev/null -eu "$@"
+		'quoted text' && "$@" $(pwd) readonly ${HOME} /usr/bin
+	&& "$1" printf test printf
+then printf done cd printf export
+-eu $(pwd) sed test awk && -eu local -eu /usr/bin then ${HOME} | 'quoted text'
+	readonly /usr/bin local "$@" grep x=1
+		printf 'quoted text' done 'quoted text' && 2>/dev/null awk export
+	printf test awk grep export
+&& readonly "$1" readonly then $(pwd) printf 'quoted text' echo awk
+--verbose export x=1 "$1" grep 'quoted text'
+		cd export ${HOME} 2>/dev/null 2>/dev/null printf sed | printf test /usr/bin
+	grep "$@" x=1 grep cd done ${HOME}
+"$@" ${HOME} "$1" ${HOME} 'quoted text' /usr/bin
+		--verbose | readonly ${HOME} local "$1" printf --verbose x=1
+local awk $(pwd) 'quoted text' local printf x=1
+${HOME} /usr/bin awk grep | echo
+	export "$@" $(pwd) /usr/bin $(pwd) awk
+	${HOME} grep && awk cd -eu awk readonly export then then &&
+		echo cd sed --verbose ${HOME} ${HOME} readonly printf
+'quoted text' grep then 'quoted text'
+	then /usr/bin -eu x=1 --verbose
+	echo | | 'quoted text' &&
+	then | "$1" /usr/bin 'quoted text'
+		"$1" 'quoted text' sed --verbose then $(pwd) printf then "$1" && local test local
+	export /usr/bin sed echo then readonly grep $(pwd)
+	printf $(pwd) local 'quoted text'
+2>/dev/null cd | then local awk export -eu
+	'quoted text' && done | && then x=1 && awk
+	${HOME} x=1 "$@" | ${HOME} --verbose
+		--verbose "$@" && 2>/dev/null awk 'quoted text' $(pwd) printf | && export
+		2>/dev/null grep && then awk 'quoted text'
+	"$@" done $(pwd) --verbose ${HOME} "$1" $(pwd) export ${HOME} cd 2>/dev/null
+	test | | -eu awk local then -eu -eu export -eu export then /usr/bin
+		test ${HOME} test printf
+	cd readonly readonly x=1 "$1" grep && test ${HOME} then /usr/bin readonly
+		/usr/bin done test x=1 'quoted text' ${HOME} grep
+sed cd --verbose 'quoted text' --verbose | cd test
+--verbose /usr/bin | $(pwd) awk -eu grep $(pwd) printf local printf /usr/bin
+$(pwd) echo && sed local done --verbose --verbose sed /usr/bin | cd local local
+		export && 'quoted text' /usr/bin cd export -eu | x=1 --verbose
+	export awk | sed && export /usr/bin then then grep
+	echo readonly /usr/bin test && sed "$@" printf
+		/usr/bin /usr/bin "$1"
+'quoted text' test local done
+printf 'quoted text' awk | then | 'quoted text' -eu 'quoted text'
+		local grep && local then x=1 | ${HOME} "$1"
+printf grep /usr/bin | awk readonly readonly awk export printf done done -eu local
+		${HOME} echo "$1" echo awk echo printf grep x=1 "$1" ${HOME} x=1 && && 2>/dev/null
+${HOME} /usr/bin x=1 "$1" "$1" -eu cd cd cd 'quoted text' sed && /usr/bin
+		done local grep 'quoted text' done "$1" cd
+${HOME} readonly /usr/bin "$1" x=1 "$1" && x=1 local export $(pwd) --verbose
+'quoted text' test ${HOME} awk awk grep cd export ${HOME} | && test cd
+	echo local 'quoted text' -eu done test grep grep
+	"$@" ${HOME} $(pwd) -eu 'quoted text'
+cd && /usr/bin && test ${HOME} readonly
+export awk echo local then awk echo | done | printf /usr/bin --verbose
+		2>/dev/null -eu export &&
+		&& --verbose local ${HOME} sed
+"$1" -eu | x=1 "$@" | cd "$@" sed | done awk && && test x=1 x=1 | printf $(pwd)
+done cd -eu 2>/dev/null awk x=1 2>/dev/null cd cd ${HOME} printf ${HOME}
+printf then "$@" "$@" && "$@" awk
+		-eu cd | awk x=1 done -eu echo | /usr/bin
+	"$@" printf "$@" then export x=1 local $(pwd) 'quoted text'
+	'quoted text' echo ${HOME} x=1 export 2>/dev/null printf --verbose
+local export 2>/dev/null "$@" x=1 readonly ${HOME} -eu printf -eu local readonly
+		--verbose done && | "$@" "$@"
+	echo x=1 export ${HOME} --verbose "$@" awk 'quoted text'
+	/usr/bin readonly 'quoted text'
+		x=1 grep x=1 2>/dev/null test ${HOME} sed export | grep echo grep
+	readonly export local test "$@" "$1"
+		${HOME} --verbose | grep
+/usr/bin && export awk | && readonly -eu echo "$1"
+local x=1 echo test 2>/dev/null printf | -eu test readonly test test
+x=1 readonly grep $(pwd) grep "$1" cd -eu ${HOME}
+	| /usr/bin local export $(pwd) x=1 | --verbose
+	local printf $(pwd) grep sed 'quoted text' done /usr/bin
+		printf && grep && 2>/dev/null printf $(pwd) ${HOME} ${HOME}
+		-eu $(pwd) local 'quoted text'
+	done x=1 && x=1 cd 'quoted text'
+	x=1 awk 'quoted text' "$1" awk 2>/dev/null export export
+	"$@" echo && test grep echo -eu $(pwd) sed 2>/dev/null /usr/bin test
+	grep awk test done 2>/dev/null
+	readonly "$@" | test then $(pwd) 'quoted text'
+		${HOME} 'quoted text' $(pwd) printf readonly "$1" cd
+echo grep printf x=1 -eu ${HOME} cd export $(pwd) 2>/dev/null -eu x=1
+then done 'quoted text' -eu cd && readonly "$1" export local readonly
+x=1 'quoted text' /usr/bin && done -eu export 'quoted text'
+test cd | awk readonly local then /usr/bin | $(pwd) $(pwd) "$1"
+cd ${HOME} --verbose 'quoted text' awk ${HOME} echo then && echo
+	test cd cd local awk ${HOME}
+cd "$1" local x=1 sed 'quoted text' $(pwd)
+		echo test && awk echo | /usr/bin echo "$1" test then && 2>/dev/null test ${HOME}
+	test local "$@" done cd
+| cd $(pwd) --verbose done | done printf | | cd cd echo ${HOME} -eu | && then awk
+	printf readonly && export readonly
+		local && local local && sed $(pwd) test /usr/bin
+	$(pwd) export /usr/bin local 2>/dev/null
+	-eu 'quoted text' && sed echo cd && grep /usr/bin
+cd /usr/bin echo done && -eu ${HOME} local sed 2>/dev/null grep
+	"$1" echo printf "$1"
+		cd && local && then done --verbose then done x=1 -eu done sed export local
+		/usr/bin ${HOME} printf 2>/dev/null then test
+${HOME} && "$@" then awk x=1 printf 2>/dev/null local "$1" -eu sed x=1
+sed done grep then 'quoted text' "$@" 2>/dev/null "$@" 2>/dev/null awk
+		local -eu ${HOME} test "$1" export -eu &&
+echo grep ${HOME} | | -eu 'quoted text' -eu $(pwd) x=1 export printf /usr/bin 2>/dev/null
+"$@" awk printf -eu "$1" --verbose "$1" ${HOME} done /usr/bin -eu
+	done x=1 2>/dev/null 2>/dev/null local readonly 2>/dev/null
+	"$1" test ${HOME} echo && readonly then && done
+		export "$1" awk echo --verbose
+		cd 'quoted text' cd cd
+&& readonly sed then "$@" 2>/dev/null readonly export x=1 awk ${HOME}
+		local && then local 2>/dev/null local 2>/dev/null
+	local sed && 'quoted text' then printf grep ${HOME} export 'quoted text' x=1
+/usr/bin && x=1 ${HOME} | /usr/bin -eu awk /usr/bin "$1" export "$@" done
+| ${HOME} grep done ${HOME} done /usr/bin local grep sed "$1" "$@" test --verbose
+	grep "$@" printf export then grep sed export grep readonly sed
+	export /usr/bin awk --verbose echo ${HOME} sed test x=1 printf --verbose | --verbose
+x=1 "$1" done readonly /usr/bin awk readonly grep 2>/dev/null test grep awk
+x=1 sed x=1 "$1" readonly "$@" done $(pwd) grep export
+		grep export -eu grep x=1 $(pwd) echo test | then -eu awk
+	then printf 2>/dev/null local "$1" then test cd "$1"
+local ${HOME} -eu $(pwd) test printf then -eu
+	sed test "$@" awk then | test /usr/bin -eu cd then
+	-eu | done "$1" "$@" grep && && "$1" 2>/dev/null done $(pwd) $(pwd) /usr/bin
+	readonly readonly /usr/bin
+"$1" "$@" export printf grep -eu "$@" local --verbose
+	'quoted text' test 2>/dev/null "$1" &&
+		2>/dev/null $(pwd) awk --verbose "$1"
+awk x=1 grep then 2>/dev/null 'quoted text' awk
+&& x=1 /usr/bin --verbose --verbose echo -eu /usr/bin
+done readonly -eu then echo /usr/bin printf 2>/dev/null 'quoted text'
+--verbose export "$@" ${HOME} cd readonly export printf then "$@" "$@"
+		readonly | done printf grep 2>/dev/null
+	$(pwd) awk --verbose x=1 && "$@"
+'quoted text' "$@" sed sed 2>/dev/null -eu $(pwd) --verbose
+		then "$1" "$@" local --verbose 2>/dev/null x=1 --verbose echo x=1 local
+		sed then 'quoted text' export x=1 export
+	| export /usr/bin "$1" printf then $(pwd)
+awk -eu export "$@" sed 'quoted text' -eu 2>/dev/null done $(pwd)
+		/usr/bin sed echo printf $(pwd) then cd awk
+		awk --verbose "$@" "$@" readonly ${HOME}
+	local "$@" 'quoted text' --verbose "$1"
+		awk /usr/bin awk "$1" echo cd $(pwd) grep 2>/dev/null printf "$1" awk "$1" local
+-eu cd done 2>/dev/null 'quoted text'
+		"$@" printf printf awk printf awk done $(pwd) | | --verbose
+/usr/bin echo -eu cd --verbose sed done /usr/bin "$@"
+export x=1 done -eu 'quoted text' echo "$@" x=1 --verbose &&
+		local x=1 $(pwd) export done
+		${HOME} --verbose /usr/bin 2>/dev/null done "$1"
+		2>/dev/null -eu 'quoted text' printf readonly sed "$1" cd ${HOME} local
+		sed then readonly readonly 2>/dev/null -eu $(pwd) x=1 --verbose
+	echo local 'quoted text' done echo $(pwd) export && -eu done printf 'quoted text'
+	readonly $(pwd) | grep printf --verbose echo x=1 "$@" && cd awk cd awk
+		"$1" done readonly done "$1" sed /usr/bin
+grep readonly test then 2>/dev/null cd readonly
+test then -eu x=1 $(pwd) 'quoted text' "$@" grep $(pwd) sed done $(pwd)
+		--verbose grep $(pwd) && printf 2>/dev/null
+		sed | done && "$1" then export
+		--verbose && readonly done /usr/bin ${HOME}
+	readonly && -eu done |
+	export sed x=1 "$1" cd x=1 local readonly export --verbose "$1"
+	"$@" $(pwd) sed grep 'quoted text'
+	awk local readonly ${HOME} "$@" "$@" $(pwd) --verbose
+		${HOME} then x=1 && && -eu --verbose 'quoted text'
+	local "$@" x=1 && echo && $(pwd) x=1 export printf cd done
+	grep x=1 --verbose test x=1 $(pwd) local cd 'quoted text' /usr/bin
+	grep then $(pwd) 'quoted text' cd then -eu 2>/dev/null
+'quoted text' sed && then $(pwd) ${HOME} "$1" "$1" && "$@"
+	export ${HOME} ${HOME} "$1"
+awk "$1" $(pwd) && awk local sed --verbose printf "$1" x=1 /usr/bin awk sed $(pwd)
+test cd then "$1" sed then
+&& "$@" -eu -eu export done awk test -eu
+		2>/dev/null readonly
+		| $(pwd) ${HOME} local local then then ${HOME} done sed then ${HOME} -eu printf
+2>/dev/null awk "$@" --verbose 2>/dev/null export /usr/bin grep | printf -eu readonly
+readonly test sed ${HOME} readonly $(pwd) && /usr/bin readonly | 'quoted text'
+		cd sed printf /usr/bin "$@" | -eu then -eu local test cd
+	"$@" sed export 2>/dev/null cd echo local export /usr/bin printf x=1
+cd -eu -eu then -eu "$@" local export then | awk x=1 cd ${HOME} $(pwd) local
+	printf sed "$@" --verbose
+done && $(pwd) printf cd -eu 2>/dev/null $(pwd) $(pwd) readonly grep
+		echo awk printf echo 'quoted text' "$1" | 'quoted text'
+	done local x=1 'quoted text' then test --verbose x=1 "$1"
+	| ${HOME} 'quoted text' export 'quoted text' export x=1
+		export "$1" awk $(pwd)
+		cd ${HOME} "$1" echo sed "$1" readonly -eu test then local grep && echo
+	test done | && done done ${HOME}
+grep -eu done export readonly export sed cd | readonly 'quoted text' -eu 'quoted text'
+		x=1 "$1" && "$1" ${HOME} printf "$@" 2>/dev/null "$1" sed 'quoted text'
+"$@" "$1" awk printf done 2>/dev/null cd $(pwd) printf awk /usr/bin --verbose
+		grep && x=1 && "$@" test "$1" -eu test x=1 readonly then
+		readonly sed readonly /usr/bin
+	echo x=1 -eu x=1 done && -eu ${HOME}
+	"$@" 'quoted text' awk x=1 awk $(pwd) cd awk cd grep local
+--verbose test 2>/dev/null awk sed grep 2>/dev/null -eu -eu then x=1 /usr/bin
+x=1 "$1" local 'quoted text'
+	then | "$1" "$@" 2>/dev/null readonly grep --verbose
+		done 'quoted text' 'quoted text' awk ${HOME} "$1"
+	"$1" cd local x=1 2>/dev/null local 2>/dev/null
+$(pwd) 2>/dev/null done sed | 'quoted text'
+		printf done ${HOME} "$1" done $(pwd)
+	export && grep --verbose -eu --verbose cd ${HOME} "$1" awk echo printf test readonly
+cd && x=1 x=1 printf test local then
+export --verbose x=1 -eu done "$@" test ${HOME} --verbose done cd 'quoted text'
+printf echo $(pwd) -eu cd 'quoted text' 'quoted text' && sed "$1" echo
+	test local export 2>/dev/null
+	/usr/bin "$1" test grep sed x=1 $(pwd) cd -eu /usr/bin echo /usr/bin ${HOME}
+		"$1" test "$1" awk 'quoted text' local
+export test readonly 'quoted text' "$1" --verbose printf
+--verbose local grep export
+		done ${HOME} sed export x=1 done "$1" cd awk sed ${HOME} $(pwd) cd
+		-eu sed test awk grep $(pwd)
+		readonly echo test grep --verbose
+	awk cd | 'quoted text' -eu grep awk
+		awk /usr/bin 2>/dev/null local printf
+	${HOME} /usr/bin 'quoted text' local cd grep readonly local awk
+		printf printf printf --verbose then
+		test local done 2>/dev/null awk export readonly then awk done x=1
+	$(pwd) x=1 done -eu "$1" awk test grep
+x=1 export then done x=1 x=1
+	--verbose cd | "$@" test export | test "$1" sed ${HOME} grep
+printf export echo readonly /usr/bin then test 'quoted text' 'quoted text'
+	awk | 2>/dev/null | printf && then local awk x=1 x=1 --verbose
+$(pwd) done "$@" export echo ${HOME} "$1" | cd export /usr/bin && 'quoted text'
+${HOME} test "$1" echo
+--verbose 2>/dev/null readonly readonly /usr/bin "$@" "$1" -eu x=1 awk 2>/dev/null
+&& sed $(pwd) | $(pwd) echo done x=1 /usr/bin 'quoted text'
+	"$1" test then grep 'quoted text' --verbose "$@"
+		-eu test grep awk "$1" | /usr/bin "$1" -eu ${HOME} --verbose
+		"$@" "$1" ${HOME} echo
+		x=1 ${HOME} -eu cd /usr/bin awk local --verbose sed
+	-eu 2>/dev/null && awk then
+		local then test 'quoted text'
+	echo cd "$1" "$1" local 'quoted text' sed sed "$@" awk test && cd export export
+		done cd awk export done echo local printf x=1 echo $(pwd) /usr/bin cd test
+		&& 2>/dev/null sed "$1" export readonly echo "$@" -eu ${HOME} "$1"
+		${HOME} "$1" 2>/dev/null cd sed 2>/dev/null $(pwd) && cd readonly
+2>/dev/null sed grep then -eu | 'quoted text' | test readonly --verbose
+	2>/dev/null printf x=1 then ${HOME} /usr/bin "$@" local "$@"
+		printf then sed $(pwd) readonly
+export grep $(pwd) done readonly 'quoted text' local "$@" "$1"
+	then ${HOME} grep "$1" awk sed -eu $(pwd) x=1 && done $(pwd)
+grep test "$@" echo awk /usr/bin done printf local "$1" echo 'quoted text'
+		| 2>/dev/null 'quoted text' && export done export x=1 echo "$@" 2>/dev/null done
+	| x=1 awk local 2>/dev/null grep grep readonly 2>/dev/null grep -eu export
+		"$1" cd -eu "$1" done cd 2>/dev/null test grep 'quoted text'
+		printf --verbose && -eu done && echo grep cd echo then && cd -eu
+	| /usr/bin grep -eu $(pwd)
+${HOME} awk export ${HOME} done | sed sed sed sed ${HOME} echo printf
+	&& | printf | ${HOME} && awk
+		then local && cd printf
+		done ${HOME} readonly awk export readonly
+	readonly then "$@" && cd
+done cd local --verbose test local "$1" printf then test local "$@" readonly
+		readonly done -eu done sed printf test "$@" -eu x=1
+local done export | ${HOME} | "$@" "$@" local grep test x=1 "$1" printf
+		printf x=1 'quoted text' echo /usr/bin ${HOME} 'quoted text' "$@"
+readonly printf && readonly "$@" then done "$1" cd readonly $(pwd) x=1 "$1" local
+local $(pwd) awk test readonly
+&& printf ${HOME} readonly then readonly then && --verbose ${HOME} --verbose "$1"
+		then "$1" x=1 $(pwd) 2>/dev/null
+	'quoted text' --verbose done 'quoted text' readonly printf printf "$@" "$1" awk
+	then && echo export done 'quoted text'
+awk echo | printf && cd then cd readonly $(pwd) cd then cd ${HOME}
+echo 'quoted text' test
+		"$1" | printf sed awk echo cd -eu 'quoted text'
+		x=1 --verbose 'quoted text' local -eu
+		2>/dev/null printf --verbose --verbose then cd cd /usr/bin echo readonly done 2>/dev/null
+	/usr/bin awk "$@" export $(pwd) cd test done "$@" readonly grep ${HOME} awk x=1
+		readonly /usr/bin local "$1" 'quoted text' grep export then "$@"
+		x=1 then readonly echo echo printf x=1 && local
+${HOME} readonly 'quoted text' 'quoted text' readonly
+		done echo 'quoted text' readonly printf 2>/dev/null then export grep grep test
+		printf export local &&
+/usr/bin --verbose grep $(pwd)
+${HOME} "$1" && grep cd grep $(pwd)
+		cd cd done readonly && x=1 --verbose "$1" awk then local
+	/usr/bin then local "$1" /usr/bin
+		-eu readonly x=1 'quoted text' printf "$1" test export && readonly
+export -eu 'quoted text' test local then 2>/dev/null
+	&& export test echo $(pwd) -eu then | 'quoted text' | /usr/bin
+		"$1" done 2>/dev/null then cd then
+local awk x=1 --verbose local 'quoted text' -eu x=1
+		/usr/bin "$1" then sed done readonly | grep echo 'quoted text' test /usr/bin readonly
+		$(pwd) $(pwd) export echo echo --verbose ${HOME} test local "$1" test sed local
+	cd /usr/bin ${HOME} "$@" awk "$1" done
+	"$@" -eu sed cd $(pwd) 'quoted text' test x=1 --verbose $(pwd) printf | "$@" sed
+/usr/bin $(pwd) x=1 -eu done cd done then export grep
+		'quoted text' "$1" done done echo printf grep awk x=1 --verbose export && 2>/dev/null
+cd then -eu "$1" --verbose | test sed then echo export
+		readonly "$1" then sed test local "$@" then sed ${HOME}
+&& then -eu "$@" 'quoted text' test test "$@" sed cd cd "$@"
+	awk printf readonly && echo "$@" done then done local "$1" ${HOME}
+-eu && printf 2>/dev/null 2>/dev/null $(pwd)
+	test /usr/bin done 'quoted text'
+printf 'quoted text' test then awk export export "$@" readonly echo
+		-eu readonly test x=1 x=1 local "$1" grep sed
+		awk export /usr/bin -eu printf
+		test echo x=1 "$@" printf cd --verbose ${HOME} | export
+		awk | grep sed grep && awk "$1" x=1 && 2>/dev/null
+		sed 2>/dev/null test sed echo readonly "$1" | export
+		test 2>/dev/null then -eu && --verbose && /usr/bin
+		done sed ${HOME} -eu echo test
+		awk && local && readonly
+awk cd 2>/dev/null | && /usr/bin readonly -eu 2>/dev/null
+		/usr/bin /usr/bin awk --verbose
+		x=1 done done && /usr/bin sed grep grep | awk x=1 sed test
+		printf -eu test cd ${HOME} export && then awk /usr/bin
+		readonly cd printf sed printf awk cd printf awk printf 'quoted text' --verbose
+		then test sed /usr/bin && 2>/dev/null cd $(pwd) 'quoted text' "$@"
+	then && sed 'quoted text' /usr/bin echo && "$@"
+		echo printf "$1" grep echo 2>/dev/null local --verbose
+		/usr/bin /usr/bin then | test -eu $(pwd)
+		"$1" -eu grep "$1" 'quoted text' awk export "$@"
+"$@" export 'quoted text' $(pwd) $(pwd) awk $(pwd) grep then | x=1 |
+		/usr/bin awk echo local
+/usr/bin "$1" --verbose local ${HOME} grep
+	-eu export $(pwd) "$@" local "$1" 2>/dev/null
+		printf test awk cd /usr/bin ${HOME} test "$1" 'quoted text' --verbose
+	export test grep && then local "$@" && | --verbose $(pwd) --verbose printf x=1
+		x=1 local "$1" ${HOME} $(pwd) ${HOME} echo readonly done 'quoted text'
+	-eu printf sed awk done then grep 'quoted text' readonly
+		| $(pwd) export "$@" "$@" 2>/dev/null grep grep local echo readonly local
+		awk /usr/bin "$@" done cd awk export
+		test $(pwd) x=1 echo sed "$1"
+		'quoted text' printf 'quoted text'
+	&& && /usr/bin export $(pwd) sed ${HOME} "$@" awk test local sed 'quoted text'
+	'quoted text' 'quoted text'
+/usr/bin local | | 'quoted text'
+	cd x=1 | then x=1 grep cd -eu awk done | cd
+	local cd 'quoted text'
+cd --verbose -eu grep "$@" export && -eu
+		echo printf | && local $(pwd) export then 2>/dev/null
+	'quoted text' && && then
+	export 'quoted text' 2>/dev/null awk "$@" -eu echo x=1 2>/dev/null
+/usr/bin grep && sed "$1" export -eu done sed $(pwd) $(pwd)
+	--verbose ${HOME} sed "$1" done printf
+	cd echo export 'quoted text' ${HOME} ${HOME} echo local ${HOME} -eu sed grep
+&& sed done readonly ${HOME} 2>/dev/null -eu sed "$1" cd printf
+local 2>/dev/null "$1" export --verbose echo "$@" sed "$@" x=1 && echo awk export
+readonly local local test
+printf $(pwd) grep readonly readonly
+	"$1" --verbose | readonly grep test sed /usr/bin readonly x=1
+		readonly sed echo cd -eu "$@" then $(pwd) | done /usr/bin
+test awk printf cd 2>/dev/null done grep export
+		"$1" | cd grep 2>/dev/null "$@" then then x=1 readonly echo export cd ${HOME} "$@"
+	awk readonly 'quoted text'
+	| then done export done printf awk | x=1 done done printf grep | local
+	2>/dev/null echo export x=1 && grep | x=1 'quoted text' then
+	export /usr/bin grep && grep
+	--verbose "$@" 2>/dev/null done grep done readonly export
+	-eu -eu done --verbose cd awk cd $(pwd) local export /usr/bin $(pwd)
+done 'quoted text' readonly grep $(pwd) sed /usr/bin
+		echo /usr/bin x=1 cd -eu 2>/dev/null echo
+		echo --verbose awk 'quoted text' && done 2>/dev/null then
+	sed $(pwd) export "$1" sed export
+	"$1" grep printf then readonly
+	readonly then 2>/dev/null x=1 -eu $(pwd) "$@" /usr/bin readonly
+	done && export echo /usr/bin -eu local echo 2>/dev/null echo 'quoted text' echo
+--verbose && local awk done echo
+$(pwd) "$@" | cd export awk $(pwd) printf test
+		2>/dev/null x=1 export | echo "$@" | cd 2>/dev/null
+	--verbose 2>/dev/null sed done then
+	-eu printf -eu 2>/dev/null
+done ${HOME} -eu done /usr/bin export then awk && printf
+| ${HOME} awk && sed readonly grep -eu "$@" grep done awk x=1 test
+		"$@" $(pwd) grep then printf export awk 'quoted text'
+		-eu --verbose export grep && /usr/bin
+		x=1 x=1 $(pwd) cd 2>/dev/null export echo | awk echo cd cd $(pwd) done sed done
+"$@" && done ${HOME} done test "$1" /usr/bin /usr/bin 'quoted text'
+done --verbose readonly echo cd grep
+		grep awk x=1 export cd -eu awk
+		'quoted text' $(pwd) ${HOME} && && "$@" done readonly --verbose && "$1" echo readonly
+$(pwd) awk readonly done test grep 'quoted text' awk
+${HOME} echo echo x=1 awk awk sed 'quoted text' local then then
+	"$@" export readonly 2>/dev/null /usr/bin awk "$@" then test 2>/dev/null /usr/bin
+	readonly ${HOME} readonly 'quoted text' grep "$1" | cd
+		printf $(pwd) local awk readonly sed echo local grep | x=1 cd
+	export readonly echo done export cd | /usr/bin cd --verbose done readonly then
+	sed ${HOME} 2>/dev/null done
+	cd then $(pwd) x=1 then awk printf grep "$@" export local | grep cd done
+	&& /usr/bin ${HOME} /usr/bin test export --verbose 2>/dev/null
+		${HOME} 2>/dev/null local
+"$@" --verbose 'quoted text' export sed 2>/dev/null done /usr/bin
+awk "$1" "$@" && /usr/bin awk cd ${HOME} done
+		local "$1" awk test awk local | grep && export && then
+then "$1" done 2>/dev/null 'quoted text' readonly
+x=1 grep readonly awk 'quoted text'
+"$@" readonly readonly | ${HOME} readonly -eu -eu ${HOME} -eu sed grep echo
+| "$@" then then 2>/dev/null $(pwd) && test
+awk --verbose awk 2>/dev/null "$1" ${HOME} cd
+	then grep printf test printf
+	awk done ${HOME} $(pwd) | 2>/dev/null -eu
+		sed grep --verbose | awk $(pwd) 2>/dev/null export
+x=1 awk -eu done | local then
+	-eu then export -eu local /usr/bin "$@" 2>/dev/null awk | --verbose
+		printf | export 'quoted text'
+	/usr/bin 2>/dev/null 2>/dev/null
+grep then printf local local 'quoted text' local echo readonly local
+	export grep $(pwd) --verbose cd /usr/bin "$1" awk echo printf echo echo /usr/bin
+$(pwd) $(pwd) then printf cd then "$@" x=1 readonly echo $(pwd) export then
+then x=1 $(pwd) export --verbose local &&
+	grep cd cd printf export sed printf /usr/bin echo printf grep ${HOME} --verbose
+		$(pwd) --verbose x=1 'quoted text' 'quoted text' then export sed sed
+x=1 grep "$1" -eu /usr/bin $(pwd) sed then && "$1" local test -eu awk --verbose
+		/usr/bin export awk readonly $(pwd) cd 'quoted text' printf $(pwd) x=1 export
+	| | echo grep 'quoted text' done $(pwd) $(pwd) awk printf
+		$(pwd) "$1" done "$1" | "$@" -eu printf
+		'quoted text' sed | ${HOME} sed awk done awk printf x=1 x=1 grep
+	done export echo | printf -eu x=1 awk --verbose
+done echo awk $(pwd) echo
+	grep grep ${HOME} -eu "$@" "$@" && cd 2>/dev/null | local x=1 export
+		test | cd "$@" grep done readonly echo echo echo ${HOME} local cd
+export "$1" printf then "$1" 2>/dev/null sed "$@" x=1 sed
+		sed ${HOME} cd test /usr/bin awk test printf
+	sed done readonly cd export 2>/dev/null
+-eu | "$1" sed readonly -eu && echo test $(pwd) cd && "$1" "$@" readonly
+	sed -eu -eu 2>/dev/null readonly && done done done echo cd "$@"
+	printf echo readonly x=1 ${HOME} --verbose 2>/dev/null 2>/dev/null 'quoted text'
+	test --verbose --verbose
+	export then "$@" readonly then test --verbose cd "$1" echo local "$1"
+		$(pwd) printf printf 'quoted text' --verbose
+	$(pwd) -eu 'quoted text'
+readonly --verbose 2>/dev/null done -eu "$@" sed test | ${HOME}
+	grep grep readonly "$1" cd /usr/bin | "$@" grep && x=1 2>/dev/null
+	printf then awk local x=1 echo
+	x=1 export /usr/bin "$1" --verbose "$@"
+		${HOME} test done printf "$@" && 'quoted text' 'quoted text'
+	then echo echo --verbose sed local readonly awk --verbose $(pwd)
+	$(pwd) readonly cd 'quoted text' echo echo then cd x=1
+/usr/bin grep && readonly $(pwd) 'quoted text'
+	| | 2>/dev/null printf cd 'quoted text' --verbose
+	grep readonly $(pwd) /usr/bin
+cd "$1" export cd ${HOME} 2>/dev/null then grep awk
+	| ${HOME} ${HOME} x=1 && --verbose echo test readonly ${HOME} cd --verbose /usr/bin
+done /usr/bin -eu -eu then /usr/bin sed echo readonly
+		export x=1 2>/dev/null "$1" | done readonly
+		test printf sed readonly $(pwd) cd readonly export
+	x=1 done --verbose -eu 2>/dev/null --verbose sed -eu then
+cd ${HOME} sed x=1 awk --verbose
+| x=1 ${HOME} 'quoted text' grep $(pwd) done
+	printf awk then ${HOME}
+		--verbose printf grep "$@" ${HOME} printf awk export printf
+		local readonly echo ${HOME} cd "$@" awk "$@" local
+then | ${HOME} grep cd cd done
+	export sed printf ${HOME} x=1 -eu done "$@" | local
+	then then x=1 cd test "$@" x=1 2>/dev/null sed && 2>/dev/null $(pwd)
+$(pwd) sed 'quoted text' sed then x=1 x=1 echo -eu local -eu
+printf --verbose grep && test echo then |
+	--verbose readonly && -eu export --verbose "$@" /usr/bin
+then ${HOME} cd cd then done && readonly awk done
+		x=1 sed export sed then
+| printf 'quoted text' echo done | printf | done x=1 --verbose $(pwd)
+	${HOME} x=1 sed && x=1 x=1
+		${HOME} printf printf "$@" awk done 'quoted text' grep "$1" cd export
+test grep grep $(pwd) echo --verbose x=1 printf x=1 "$@" local printf ${HOME}
+		--verbose ${HOME} "$@" then awk awk /usr/bin cd
+		x=1 -eu --verbose | 'quoted text'
+		local cd sed 2>/dev/null "$1" && done "$1" done cd && then readonly export
+done awk --verbose "$@" --verbose
+echo -eu export "$1" 2>/dev/null -eu sed --verbose
+		${HOME} awk echo then sed ${HOME} grep cd awk | test grep
+	"$@" done then test | readonly ${HOME} | echo export | grep cd done "$1"
+		echo printf export cd printf --verbose grep "$1" printf
+		$(pwd) grep "$@" then done
+| x=1 test local x=1 "$@" 2>/dev/null sed 'quoted text' cd 2>/dev/null
+	export test cd then $(pwd)
+	grep && "$1" readonly | cd done then cd && export | && echo local
+	&& && $(pwd) 'quoted text' local
+	x=1 test export grep sed --verbose export ${HOME}
+	"$@" ${HOME} cd done done && --verbose test then ${HOME} ${HOME}
+		"$@" readonly 2>/dev/null sed 'quoted text' -eu && printf printf "$1" /usr/bin readonly
+	x=1 | 2>/dev/null $(pwd) then test test && awk "$@" "$1" /usr/bin done
+		2>/dev/null "$1" "$1" ${HOME} printf export sed grep ${HOME}
+	done $(pwd) && printf 'quoted text' local 2>/dev/null && sed done
+sed ${HOME} x=1 && test /usr/bin echo export printf export "$@" && | done -eu
+		/usr/bin | -eu | 'quoted text' awk "$@" grep echo x=1 readonly
+		sed /usr/bin 2>/dev/null then && $(pwd) "$@"
+--verbose test cd then x=1 && readonly 'quoted text' cd -eu grep ${HOME}
+	| then local cd awk "$1" --verbose $(pwd) done /usr/bin
+	| sed "$@" awk /usr/bin done | $(pwd)
+		"$@" grep ${HOME} --verbose
+--verbose $(pwd) local test && x=1 ${HOME} local "$1"
+		export --verbose $(pwd) 2>/dev/null grep then then local sed -eu sed printf
+	${HOME} grep sed readonly grep printf && done readonly 'quoted text'
+	export && then awk test | "$@" echo x=1 'quoted text' readonly
+local awk printf $(pwd) grep done 2>/dev/null x=1 "$1" printf
+	2>/dev/null -eu test test "$1" then grep echo export /usr/bin sed "$1"
+		export cd grep printf /usr/bin then 2>/dev/null awk 2>/dev/null echo printf && |
+		readonly grep test | test sed 2>/dev/null
+	cd export cd awk "$@" | 'quoted text' then
+		"$1" x=1 cd printf sed 2>/dev/null export | -eu export
+		"$1" /usr/bin $(pwd) test "$1" ${HOME} test grep export echo -eu sed
+	/usr/bin /usr/bin -eu printf --verbose 2>/dev/null
+${HOME} 2>/dev/null $(pwd) local | "$1" then | done test 'quoted text'
+	/usr/bin /usr/bin --verbose test test --verbose --verbose $(pwd)
+	| 'quoted text' done && readonly
+		'quoted text' && x=1 then awk awk printf
+"$@" done -eu done printf echo
+--verbose test echo "$1" -eu 'quoted text' echo && | x=1 done
+	| && "$@" grep readonly sed then printf -eu $(pwd) cd
+		test x=1 "$1" 'quoted text' ${HOME} x=1 'quoted text' then local "$1"
+	then ${HOME} "$@" grep 2>/dev/null done readonly local echo 2>/dev/null
+		awk echo test export $(pwd)
+	then readonly && "$@" grep && -eu 'quoted text' cd "$1" then
+	'quoted text' ${HOME} /usr/bin
+	export $(pwd) then cd awk export -eu local
+		cd "$@" "$@" 2>/dev/null ${HOME} "$1" printf local export
+		echo $(pwd) | test done readonly echo grep echo echo 'quoted text'
+test awk awk local readonly grep sed sed $(pwd)
+test export -eu $(pwd) then cd -eu
+		--verbose sed export "$1" cd grep 2>/dev/null
+		'quoted text' | sed ${HOME} -eu | printf /usr/bin awk --verbose
+	$(pwd) echo -eu -eu $(pwd) test local
+readonly cd sed done grep --verbose grep sed -eu ${HOME}
+		test && cd "$@" cd --verbose sed "$@" --verbose $(pwd) ${HOME} /usr/bin then
+		&& && cd --verbose && $(pwd) ${HOME}
+		cd && sed | ${HOME} "$1" x=1 "$1" | echo awk export
+grep export 'quoted text' /usr/bin readonly && 'quoted text'
+then done printf echo printf grep readonly
+done | done ${HOME} -eu --verbose then printf printf sed grep && then echo
+readonly ${HOME} $(pwd) echo done "$1" echo done
+--verbose done --verbose
+		${HOME} x=1 x=1 2>/dev/null sed /usr/bin echo "$@" /usr/bin "$@" --verbose cd sed
+-eu cd $(pwd) 2>/dev/null "$@" export then $(pwd) /usr/bin local
+${HOME} /usr/bin "$@" 2>/dev/null $(pwd) echo
+		"$1" sed 'quoted text' | "$@" cd /usr/bin printf local 2>/dev/null
+	readonly done && printf then local export
+		sed grep done "$1" export then awk readonly local 2>/dev/null
+"$1" local 'quoted text' x=1 'quoted text'
+	export 'quoted text' then 'quoted text' ${HOME} done
+		| -eu "$@" /usr/bin | sed
+then $(pwd) --verbose cd printf then
+		"$@" then then readonly ${HOME} then
+grep -eu --verbose --verbose readonly --verbose && cd "$1" &&
+	readonly awk /usr/bin awk ${HOME} test 'quoted text' "$1" ${HOME} ${HOME}
+		--verbose | --verbose sed grep /usr/bin
+	x=1 test grep cd ${HOME} test local local && test then $(pwd) local && sed /usr/bin
+	--verbose -eu /usr/bin /usr/bin cd x=1 2>/dev/null
+		--verbose export x=1 && /usr/bin && | 'quoted text'
+	x=1 cd sed $(pwd) grep local export /usr/bin cd
+		done "$1" awk local then "$1" then 'quoted text' awk 2>/dev/null done "$1" printf
+		| local 'quoted text' 2>/dev/null
+awk "$1" 2>/dev/null cd readonly | printf local
+local sed sed -eu done &&
+		sed x=1 2>/dev/null --verbose &&
+	"$@" && /usr/bin then --verbose
+done local ${HOME} grep then ${HOME} awk
+	'quoted text' --verbose
+		&& 2>/dev/null grep awk echo -eu test -eu echo $(pwd) local cd
+readonly grep 'quoted text' $(pwd) "$1" "$1" ${HOME} printf && readonly
+printf 2>/dev/null x=1 /usr/bin $(pwd)
+	test export export $(pwd) printf test 'quoted text' && x=1 done
+	$(pwd) test test test done 'quoted text' "$@" && awk "$@" 'quoted text' awk
+		echo | "$1" /usr/bin "$@" 2>/dev/null cd 'quoted text'
+	done ${HOME} 2>/dev/null cd awk 'quoted text'
+		done /usr/bin printf ${HOME} 'quoted text' "$@" done "$@"
+		-eu --verbose test test then awk test
+	sed echo awk ${HOME} | $(pwd) && x=1
+	/usr/bin | sed readonly x=1 2>/dev/null
+		cd test then && echo "$@" $(pwd) && "$@" ${HOME} local 'quoted text' grep
+	$(pwd) ${HOME} grep ${HOME} | | "$@" 2>/dev/null cd /usr/bin readonly
+/usr/bin test done awk --verbose test
+"$@" awk && /usr/bin ${HOME} printf
+2>/dev/null ${HOME} then grep /usr/bin /usr/bin x=1 x=1 "$1" && && | test grep
+	cd printf echo sed && /usr/bin
+printf && $(pwd) /usr/bin /usr/bin
+${HOME} --verbose done x=1 test local
+		test 'quoted text' readonly grep local echo local cd export -eu | readonly --verbose
+	cd && 2>/dev/null echo export local "$1" | 2>/dev/null
+	| x=1 grep local echo /usr/bin $(pwd) --verbose && -eu
+	$(pwd) && "$1" test then ${HOME} --verbose then && echo $(pwd) grep
+	sed test local test x=1 then "$@" | local && test | &&
+cd cd awk printf cd /usr/bin 2>/dev/null
+		2>/dev/null local | "$@" x=1 then "$1" --verbose
+| test ${HOME} grep && x=1 && then local then cd awk echo
+		${HOME} /usr/bin export && sed printf
+export readonly then export --verbose && then /usr/bin ${HOME} local 2>/dev/null
+	-eu && echo "$@" && --verbose cd awk $(pwd) printf && export "$@" readonly
+	"$1" sed echo -eu 2>/dev/null ${HOME} echo
+		'quoted text' done export
+		'quoted text' -eu -eu local x=1 test && done echo
+	test 'quoted text' x=1 x=1 awk -eu
+	local cd echo 2>/dev/null sed cd $(pwd) local
+'quoted text' done test "$1" | && /usr/bin 'quoted text'
+		done 2>/dev/null "$1" readonly "$@"
+	printf echo echo -eu ${HOME} export readonly && /usr/bin x=1 | cd
+		sed /usr/bin "$@" | x=1 "$1" --verbose | /usr/bin test test 2>/dev/null
+"$1" 2>/dev/null readonly
+	-eu "$1" cd grep ${HOME} sed
+printf cd readonly printf readonly /usr/bin 'quoted text'
+2>/dev/null sed --verbose done -eu ${HOME} test
+		-eu "$@" --verbose local readonly
+x=1 ${HOME} sed /usr/bin 2>/dev/null
+x=1 echo readonly "$@" local x=1 --verbose
+		2>/dev/null done grep grep printf done
+	'quoted text' "$1" --verbose then echo test -eu $(pwd) awk done
+		2>/dev/null $(pwd) && done
+		done x=1 readonly x=1 then
+	echo cd readonly --verbose | $(pwd) 'quoted text'
+'quoted text' readonly printf && cd sed "$@" ${HOME} --verbose
+sed grep export awk /usr/bin done local sed $(pwd) cd test local 'quoted text'
+	/usr/bin export $(pwd) x=1 2>/dev/null -eu readonly -eu export $(pwd) then &&
+		--verbose "$@" /usr/bin x=1
+"$@" local cd | echo sed && echo "$1"
+		'quoted text' 'quoted text' cd | 'quoted text' | printf /usr/bin
+	sed cd done done 'quoted text' 2>/dev/null
+export readonly x=1 cd readonly
+		printf printf readonly ${HOME} sed done then "$@"
+	export done cd test -eu echo grep "$1" ${HOME}
+		| local printf cd | sed done
+		export test ${HOME} --verbose $(pwd) cd ${HOME} local
+		test "$@" -eu test sed echo then awk
+x=1 2>/dev/null --verbose sed "$1" | echo && readonly awk | /usr/bin
+	awk /usr/bin | "$1" done 2>/dev/null printf "$1" done cd cd echo ${HOME}
+	done | "$@" && | test cd cd then ${HOME} "$1"
+		local 2>/dev/null local "$@" echo readonly ${HOME} sed x=1 --verbose
+		${HOME} printf sed 2>/dev/null -eu echo then local
+	readonly test grep | |
+printf cd | 2>/dev/null export test export sed awk printf "$1" readonly
+	sed x=1 -eu $(pwd) x=1 echo "$1" /usr/bin grep readonly grep cd 2>/dev/null
+		&& -eu "$@" printf 'quoted text'
+sed 2>/dev/null x=1 grep test ${HOME} printf then sed awk then readonly | grep ${HOME}
+	&& -eu awk cd local done x=1 --verbose
+		grep "$@" grep test -eu /usr/bin
+	2>/dev/null sed local local
+local "$1" awk test && 2>/dev/null x=1 awk "$1"
+/usr/bin export done grep ${HOME} $(pwd) x=1
+	2>/dev/null /usr/bin 'quoted text'
+--verbose "$1" ${HOME} --verbose
+'quoted text' $(pwd) x=1 cd 'quoted text' | grep | "$@" done $(pwd) echo done
+	done readonly ${HOME} 2>/dev/null
+		&& printf sed echo readonly local --verbose printf 'quoted text'
+		${HOME} x=1 grep "$1" | test 'quoted text'
+$(pwd) echo $(pwd) -eu grep cd echo $(pwd) readonly | 2>/dev/null
+	printf 2>/dev/null "$@" --verbose $(pwd) sed echo test | /usr/bin x=1 grep
+	grep done x=1 2>/dev/null -eu 'quoted text' export cd
+printf 'quoted text' 2>/dev/null
+/usr/bin "$@" "$@" "$1" sed $(pwd)
+cd then x=1 -eu 'quoted text' readonly local test | cd
+		$(pwd) ${HOME} then "$1" "$1" ${HOME} "$@" $(pwd) printf
+/usr/bin awk 2>/dev/null
+	"$@" "$1" "$@" $(pwd) then | done | 'quoted text'
+then && 2>/dev/null cd x=1 printf 2>/dev/null then
+		"$@" echo --verbose printf grep
+		test 2>/dev/null cd awk test "$@"
+	2>/dev/null echo ${HOME} grep -eu /usr/bin readonly local "$1" readonly
+		export /usr/bin "$1" done then
+&& cd 2>/dev/null 'quoted text' echo | done sed
+2>/dev/null -eu done test then ${HOME} x=1 echo "$@" $(pwd) "$1" then echo 2>/dev/null
+	&& ${HOME} printf test --verbose echo | -eu x=1 "$1"
+| test x=1 "$1" readonly echo sed "$@" --verbose
+		cd done printf readonly done 2>/dev/null "$1"
+	x=1 test --verbose "$1" && printf cd awk done printf x=1 "$1" 2>/dev/null readonly
+		/usr/bin x=1 x=1 readonly /usr/bin awk export 'quoted text'
+		export "$@" ${HOME} $(pwd) $(pwd)
+		sed grep sed && echo cd readonly grep -eu | export grep then | && --verbose "$1"
+		/usr/bin "$1" x=1 "$1" test
+		"$@" | local "$@" x=1 export cd readonly local then
+x=1 awk then 'quoted text' /usr/bin -eu
+		--verbose $(pwd) "$1" x=1 x=1 | "$1" then sed 'quoted text'
+	${HOME} /usr/bin awk | then export done test --verbose
+		$(pwd) grep $(pwd) cd test test | | awk export grep
+${HOME} ${HOME} 2>/dev/null test && done grep "$@" export
+	${HOME} readonly ${HOME} $(pwd) export done | "$1" ${HOME} printf "$1" export
+2>/dev/null done ${HOME} grep && 'quoted text' -eu readonly
+	sed readonly x=1 "$@" x=1 test ${HOME} sed cd && 2>/dev/null
+x=1 cd awk && ${HOME} $(pwd) 2>/dev/null sed --verbose printf "$1"
+	-eu readonly x=1 -eu test sed echo $(pwd)
+		/usr/bin cd awk printf test
+		"$1" test grep awk local local | then sed local printf test $(pwd) grep
+&& echo local cd -eu $(pwd) /usr/bin
+| echo awk done cd then $(pwd) ${HOME} $(pwd) readonly "$@" "$@" && cd
+2>/dev/null 'quoted text' -eu $(pwd) then awk "$@" && 'quoted text'
+		--verbose /usr/bin ${HOME} "$1" && sed /usr/bin --verbose | "$1" echo
+		grep 2>/dev/null | printf $(pwd) /usr/bin
+2>/dev/null grep cd | | 'quoted text'
+	${HOME} 2>/dev/null echo local $(pwd) sed /usr/bin export -eu "$@" /usr/bin
+	printf "$1" | sed printf "$1" echo $(pwd) sed printf done
+then grep echo /usr/bin ${HOME} done /usr/bin
+		${HOME} grep "$1" test then awk cd
+	/usr/bin && /usr/bin $(pwd) "$@" grep export 2>/dev/null
+		grep --verbose 'quoted text' then
+local local done $(pwd) $(pwd) cd printf
+	awk $(pwd) && && && "$@" awk
+	done then ${HOME} 'quoted text'
+	done ${HOME} sed && "$1" x=1
+		/usr/bin echo x=1 awk 2>/dev/null
+| $(pwd) local --verbose "$@" sed $(pwd) done -eu cd && export -eu printf ${HOME}
+	x=1 --verbose local local
+		'quoted text' --verbose -eu
+	sed then x=1 /usr/bin echo awk
+		export --verbose then local 2>/dev/null
+printf awk x=1 export local grep sed 'quoted text' 2>/dev/null --verbose readonly
+		$(pwd) $(pwd) cd 2>/dev/null && $(pwd) then readonly x=1
+		echo && 'quoted text' /usr/bin
+then -eu "$1" $(pwd) x=1 | "$1" $(pwd)
+		then echo 2>/dev/null echo "$1" && "$@" grep "$@" x=1 then
+		test && grep sed done sed ${HOME} export --verbose
+		| $(pwd) | "$1" done printf $(pwd) ${HOME} | done /usr/bin -eu 2>/dev/null
+	export awk $(pwd) "$1" "$@" 2>/dev/null test && --verbose &&
+		done done x=1 "$1" x=1 echo /usr/bin "$@" awk -eu -eu $(pwd) echo awk
+		test sed ${HOME} 'quoted text' test ${HOME} echo printf &&
+done -eu grep readonly "$@" awk done sed ${HOME} 'quoted text'
+2>/dev/null 'quoted text'
+		test --verbose "$@" -eu /usr/bin 'quoted text' test
+2>/dev/null $(pwd) done done -eu | | cd export "$@" /usr/bin test ${HOME} local
+	sed awk test test 2>/dev/null done
+	"$@" export echo echo $(pwd) printf ${HOME} "$@" "$1" /usr/bin
+cd 'quoted text' ${HOME} awk -eu /usr/bin test -eu -eu sed cd $(pwd)
+	echo | test $(pwd) readonly $(pwd)
+echo then "$1" done done printf done readonly
+	grep -eu then ${HOME} -eu then sed readonly printf 'quoted text'
+done awk cd x=1 then
+cd -eu --verbose test cd export cd sed echo awk 2>/dev/null
+x=1 2>/dev/null then | export 'quoted text' echo
+	${HOME} ${HOME} readonly test
+	-eu | readonly $(pwd) --verbose "$@"
+		&& "$1" --verbose printf ${HOME} printf then readonly export ${HOME} 2>/dev/null
+	/usr/bin echo --verbose && grep cd ${HOME} && 'quoted text' readonly grep
+		grep 'quoted text' ${HOME} printf cd --verbose
+		awk -eu echo $(pwd) && "$@" 'quoted text' -eu
+	local x=1 grep 'quoted text' echo
+	| local readonly "$@" test grep export
+x=1 && /usr/bin awk ${HOME} awk grep local ${HOME} 2>/dev/null --verbose
+		local echo -eu --verbose && | "$1" "$@" ${HOME} cd | printf $(pwd) done sed sed
+"$1" "$1" x=1 echo awk export readonly
+x=1 echo awk $(pwd) printf --verbose echo /usr/bin /usr/bin
+		"$@" | && 2>/dev/null /usr/bin printf cd
+	awk 2>/dev/null | printf printf x=1 readonly grep printf export sed awk
+grep readonly then /usr/bin --verbose test grep -eu sed 'quoted text'
+--verbose -eu "$@" sed x=1 | 2>/dev/null local then
+		export sed 'quoted text' ${HOME} --verbose
+-eu then | export && done /usr/bin printf done local local
+-eu | export test 'quoted text' echo grep grep test readonly export && "$1"
+"$1" 'quoted text' readonly 'quoted text'
+		done printf readonly sed
+		"$@" export sed readonly cd 'quoted text' && printf x=1 "$1" cd /usr/bin x=1 --verbose
+"$@" readonly awk "$1" /usr/bin -eu cd
+	$(pwd) sed local then awk | | ${HOME} "$1" --verbose cd test
+		test | | "$@" grep "$1" done sed --verbose export done done then --verbose -eu
+		"$1" 2>/dev/null x=1 "$@" echo 'quoted text' printf "$@" test "$@" "$@"
+then /usr/bin | ${HOME} -eu readonly done x=1 awk then 2>/dev/null awk 2>/dev/null
+	$(pwd) x=1 ${HOME} -eu printf grep readonly /usr/bin grep export
+"$@" && echo then 2>/dev/null test "$1" local done --verbose ${HOME}
+	x=1 /usr/bin cd sed echo grep printf done 2>/dev/null sed done 'quoted text'
+	grep printf x=1 "$1" export readonly printf /usr/bin --verbose --verbose
+		awk ${HOME} "$1" grep
+$(pwd) "$@" 2>/dev/null
+| && local then -eu 2>/dev/null
+		printf readonly local grep then 'quoted text' printf readonly ${HOME} cd echo
+	'quoted text' ${HOME} /usr/bin grep then /usr/bin 2>/dev/null "$@" echo -eu readonly
+	awk sed x=1 local 2>/dev/null -eu ${HOME} awk grep done "$@"
+cd $(pwd) printf export "$@"
+	-eu && $(pwd) 'quoted text' 2>/dev/null /usr/bin echo "$@" "$1" sed && /usr/bin
+	--verbose done sed local "$1" export cd grep grep readonly --verbose
+	export && ${HOME} sed | -eu -eu /usr/bin readonly test 2>/dev/null
+done grep ${HOME} 2>/dev/null export
+		test test cd && 'quoted text'
+		2>/dev/null 2>/dev/null export local sed 2>/dev/null then ${HOME} 'quoted text'
+	awk && sed then 2>/dev/null -eu
+local $(pwd) -eu | x=1
+done 'quoted text' 'quoted text' 2>/dev/null -eu
+then then test $(pwd) sed awk ${HOME} then export 'quoted text' $(pwd)
+	&& then then readonly local then | awk -eu $(pwd) -eu | -eu grep sed
+	awk --verbose "$1" $(pwd) export | "$1" export
+	2>/dev/null "$1" | echo cd printf
+	sed "$@" then then "$@" local
+	-eu awk cd 'quoted text' -eu x=1
+$(pwd) export 2>/dev/null --verbose && | 'quoted text' export echo
+echo export $(pwd) --verbose done export export -eu
+| cd $(pwd) 2>/dev/null test /usr/bin
+printf grep "$@" 'quoted text' -eu 'quoted text' | readonly awk local
+test awk echo awk then grep $(pwd) grep
+	"$1" ${HOME} 'quoted text' -eu "$1" x=1 ${HOME}
+	then export readonly cd cd -eu && ${HOME}
+local test | ${HOME} /usr/bin /usr/bin
+'quoted text' local echo echo test done export --verbose 2>/dev/null x=1 --verbose
+	2>/dev/null ${HOME} awk && "$1" 'quoted text' "$@"
+printf | test $(pwd) sed done export
+	x=1 && sed cd 2>/dev/null
+		awk then ${HOME} 2>/dev/null ${HOME} local then | 2>/dev/null sed local
+	local "$1" export readonly
+		--verbose 2>/dev/null echo done && | grep | 2>/dev/null awk "$1" 2>/dev/null
+	${HOME} x=1 awk test x=1 export
+		export export awk /usr/bin echo
+		export then && export $(pwd) && done --verbose ${HOME} 'quoted text'
+grep awk "$@" grep grep cd | x=1 echo -eu grep local local
+		'quoted text' printf echo $(pwd) printf then ${HOME} cd awk && grep
+		local readonly local echo then then "$@" printf then then 'quoted text'
+sed local printf local
+	| printf ${HOME} ${HOME} printf cd && sed 2>/dev/null awk -eu
+		cd ${HOME} 'quoted text' 2>/dev/null | local local
+sed /usr/bin done -eu /usr/bin --verbose
+${HOME} grep local sed --verbose
+"$@" export awk printf readonly x=1 test /usr/bin &&
+		test --verbose done echo sed 'quoted text' readonly test export
+	awk "$@" then then | /usr/bin 'quoted text' 'quoted text' done grep
+local ${HOME} printf then test echo then | echo readonly printf
+		printf cd readonly echo
+	"$@" && "$@" cd done | -eu done then test
+2>/dev/null "$@" && 2>/dev/null && ${HOME} local x=1 done --verbose | | echo
+		2>/dev/null "$@" 'quoted text' local local
+$(pwd) local && sed grep
+		/usr/bin $(pwd) $(pwd) --verbose
+	done 2>/dev/null readonly "$@" 'quoted text' awk
+sed printf /usr/bin "$@" readonly && x=1 grep
+	awk --verbose "$@" $(pwd) done echo /usr/bin
+		--verbose -eu awk 2>/dev/null test grep
+done test x=1 grep export test 'quoted text' awk done
+	grep awk | echo sed $(pwd) awk
+		&& grep readonly done export && readonly awk printf -eu 'quoted text' grep
+test readonly sed sed
+	echo done --verbose export 2>/dev/null 2>/dev/null done echo |
+		local export sed test local echo grep $(pwd) awk $(pwd) local readonly ${HOME}
+	then $(pwd) awk --verbose && awk ${HOME}
+		readonly "$@" awk ${HOME} echo /usr/bin 'quoted text' awk $(pwd) awk cd "$1"
+		| export awk done test "$@" grep | test local | &&
+cd readonly /usr/bin 'quoted text' /usr/bin "$@" done x=1
+${HOME} cd awk $(pwd) "$1" grep x=1 readonly sed readonly 'quoted text' local
+cd "$@" $(pwd) 'quoted text' ${HOME}
+| local export grep echo echo ${HOME} "$1" 2>/dev/null
+		echo local "$1" && export export readonly /usr/bin
+		done $(pwd) 2>/dev/null -eu echo -eu --verbose $(pwd)
+$(pwd) x=1 | sed printf export && /usr/bin cd printf --verbose export test --verbose
+		sed cd test done --verbose
+		echo local echo test grep -eu
+	printf /usr/bin readonly /usr/bin
+	readonly test export awk local
+"$@" sed ${HOME} && "$1"
+		echo 2>/dev/null 'quoted text' 2>/dev/null
+"$@" export -eu done $(pwd) 2>/dev/null | done 2>/dev/null 'quoted text' done
+	${HOME} export readonly awk grep awk "$1" -eu awk awk /usr/bin | grep $(pwd)
+--verbose grep /usr/bin printf readonly then done
+	$(pwd) cd 'quoted text' "$@" done sed "$@" then sed
+	printf then && grep | echo /usr/bin cd sed cd "$@"
+		local | $(pwd) export 'quoted text' test done done --verbose readonly export
+	&& sed test ${HOME} grep --verbose 'quoted text' | local
+	export "$@" "$@" echo | --verbose
+		echo -eu readonly ${HOME} && export grep ${HOME}
+		x=1 $(pwd) sed cd local 2>/dev/null | cd x=1 grep ${HOME} | $(pwd)
+	-eu export cd -eu readonly "$@" done ${HOME} grep grep $(pwd) --verbose
+	"$@" x=1 'quoted text' awk export
+echo then readonly $(pwd) readonly test && 'quoted text' ${HOME} sed ${HOME} $(pwd)
+		${HOME} echo test echo 'quoted text' -eu printf | 'quoted text'
+export printf then cd --verbose
+	local local 2>/dev/null local then
+${HOME} ${HOME} then printf "$1" 'quoted text' $(pwd) printf then /usr/bin
+		readonly grep cd --verbose x=1 -eu cd ${HOME} 2>/dev/null awk /usr/bin -eu ${HOME}
+		local "$1" ${HOME} /usr/bin then then /usr/bin local
+		test | "$1" $(pwd) 2>/dev/null then readonly
+"$1" grep export done 'quoted text' then --verbose printf
+'quoted text' x=1 done cd | done -eu test
+	awk "$@" echo ${HOME} "$1" && -eu awk printf
+		${HOME} "$1" "$1" "$@" ${HOME} readonly "$1" && awk /usr/bin && ${HOME} --verbose
+"$@" -eu "$1" grep readonly && --verbose 'quoted text'
+		printf --verbose /usr/bin x=1 x=1 readonly
+-eu cd done readonly test
+		&& then | $(pwd) -eu -eu sed readonly "$@" grep printf "$1" done echo awk 'quoted text'
+	grep then --verbose $(pwd) export $(pwd) -eu && ${HOME} -eu sed readonly
+x=1 /usr/bin "$1" awk printf local local readonly |
+grep readonly sed then -eu done /usr/bin done "$@" cd | done
+grep cd $(pwd) sed --verbose | local
+		echo x=1 -eu test 'quoted text' $(pwd) printf
+&& 'quoted text' done $(pwd) x=1 && sed "$1" | ${HOME} awk | && 'quoted text' test
+-eu "$1" test grep --verbose --verbose sed echo
+		${HOME} x=1 && | grep local awk then cd printf printf test 2>/dev/null
+readonly 'quoted text' 2>/dev/null local done 'quoted text'
+		readonly | test echo && then printf
+	${HOME} sed echo readonly "$@" && /usr/bin -eu printf 'quoted text' done --verbose
+		$(pwd) cd $(pwd) 2>/dev/null
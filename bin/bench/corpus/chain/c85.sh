@@ -0,0 +1,2001 @@
+		sed echo echo 2>/dev/null 2>/dev/null cd 'quoted text'
+$(pwd) x=1 cd /usr/bin "$1" sed | | printf test test "$1"
+awk local $(pwd) --verbose $(pwd) local grep
+test local readonly --verbose 2>/dev/null "$1" "$1" awk 2>/dev/null x=1
+test /usr/bin cd readonly 'quoted text'
+	printf local 2>/dev/null -eu 2>/dev/null /usr/bin
+	cd x=1 printf done "$@" printf printf && x=1 then "$@" | x=1
+		| grep /usr/bin -eu 2>/dev/null done && local
+echo --verbose echo sed 2>/dev/null done x=1 && --verbose
+		cd export /usr/bin "$@" awk $(pwd) && "$1" 'quoted text'
+		readonly then --verbose | /usr/bin
+	echo test printf && printf grep | "$1" ${HOME} /usr/bin
+	-eu "$@" done /usr/bin printf -eu 'quoted text' -eu $(pwd) printf
+sed cd $(pwd) $(pwd) -eu $(pwd)
+	grep && export "$1" printf awk 2>/dev/null
+	"$1" 'quoted text' "$1" | "$@" --verbose
+		| -eu 2>/dev/null printf $(pwd) $(pwd) | grep -eu grep "$1" 2>/dev/null local
+	printf done test "$1" /usr/bin printf "$1" readonly && --verbose "$@" x=1 then
+	grep 'quoted text' grep test --verbose
+	done printf && ${HOME} ${HOME} grep | "$1" $(pwd)
+echo | "$1" echo && && "$@" /usr/bin x=1 'quoted text' cd 2>/dev/null cd
+awk done done /usr/bin --verbose $(pwd) grep "$@" $(pwd) test export
+--verbose done readonly 'quoted text' $(pwd)
+	echo $(pwd) done 'quoted text' test cd test then test x=1 "$1" echo 2>/dev/null
+x=1 /usr/bin "$1" done
+printf | && "$1" echo "$@" --verbose
+	awk "$1" && -eu sed export then grep "$1" printf "$1" test echo /usr/bin
+		2>/dev/null grep $(pwd) $(pwd) x=1 grep /usr/bin /usr/bin
+		export /usr/bin readonly cd awk
+		then local "$@" 'quoted text' x=1 $(pwd) -eu && x=1 "$1" 'quoted text'
+		cd | readonly x=1 -eu grep
+-eu done sed --verbose /usr/bin -eu local printf && /usr/bin
+	awk export local && 'quoted text' 2>/dev/null $(pwd) 'quoted text'
+	sed $(pwd) then | 'quoted text' /usr/bin /usr/bin test sed ${HOME} local test x=1
+-eu readonly "$@" then local 'quoted text' $(pwd)
+	cd export "$1" export echo
+export readonly grep | awk done then done cd /usr/bin test test "$@" /usr/bin
+		2>/dev/null 'quoted text' /usr/bin done /usr/bin printf done local x=1 echo done
+cd then done echo awk echo && cd sed --verbose | done echo 'quoted text'
+local cd && cd cd awk test ${HOME} -eu
+	x=1 && && | && export done awk then $(pwd) grep
+	then echo cd cd 2>/dev/null
+	-eu ${HOME} 'quoted text' echo cd 'quoted text' /usr/bin 2>/dev/null x=1 "$@" x=1
+		echo grep 2>/dev/null readonly $(pwd) printf test awk "$1" then test 2>/dev/null
+${HOME} $(pwd) sed x=1 ${HOME} -eu grep
+	${HOME} 'quoted text' -eu test
+		${HOME} /usr/bin export | local export ${HOME} then
+awk export ${HOME} awk | done --verbose awk && $(pwd) readonly grep --verbose
+		$(pwd) | 'quoted text' x=1 done 2>/dev/null x=1
+		2>/dev/null local printf sed local && ${HOME} sed /usr/bin
+echo ${HOME} awk readonly /usr/bin echo echo then echo printf done
+		readonly ${HOME} "$1" export 2>/dev/null
+	done grep export test cd readonly "$@" "$1" --verbose grep 2>/dev/null --verbose
+| "$1" printf readonly export x=1 grep then --verbose
+	awk x=1 ${HOME} awk --verbose /usr/bin readonly
+test ${HOME} echo -eu x=1 "$@" awk echo export local awk
+	sed sed /usr/bin echo awk printf cd printf echo ${HOME}
+then -eu 'quoted text' /usr/bin
+		export awk x=1 export test cd export
+x=1 test 2>/dev/null then
+	test $(pwd) grep grep "$@" $(pwd)
+		grep printf sed && /usr/bin sed && readonly test 'quoted text' 'quoted text'
+2>/dev/null done /usr/bin "$@" "$1" done
+x=1 printf then echo --verbose 'quoted text' "$1"
+local 2>/dev/null local && readonly then test $(pwd) | awk readonly then ${HOME}
+		sed && printf export cd x=1 $(pwd) /usr/bin grep then done sed $(pwd) export
+		&& /usr/bin test readonly x=1 printf "$@" grep -eu x=1 test
+		done awk local 'quoted text' printf grep x=1 export 'quoted text'
+then --verbose "$@" then sed readonly readonly --verbose done printf
+	grep readonly readonly /usr/bin sed 'quoted text' "$@" sed then /usr/bin $(pwd)
+		$(pwd) sed --verbose "$@" readonly /usr/bin "$1"
+	"$1" /usr/bin then cd | x=1 x=1 export $(pwd)
+		then readonly then local && cd "$1" export --verbose
+		awk | echo ${HOME} printf "$1" then
+export x=1 sed test && 2>/dev/null cd "$@" readonly 'quoted text'
+		"$@" | export 'quoted text' "$1" x=1 2>/dev/null 2>/dev/null "$1" cd "$@" x=1
+	"$1" then $(pwd) --verbose /usr/bin /usr/bin test awk awk
+		'quoted text' then readonly && readonly done
+readonly done | | grep 2>/dev/null readonly then
+	$(pwd) && done 'quoted text' printf 2>/dev/null 2>/dev/null export echo
+		--verbose 'quoted text' sed printf | /usr/bin readonly sed x=1 x=1 sed then
+		grep awk printf cd -eu -eu ${HOME} /usr/bin
+	2>/dev/null sed echo -eu readonly --verbose /usr/bin done && local "$@" x=1
+-eu echo 2>/dev/null awk echo --verbose "$@" cd x=1 | then done -eu printf readonly
+		printf --verbose local /usr/bin -eu "$1"
+	local | && test "$@" "$@" done echo readonly awk readonly export readonly
+	2>/dev/null && -eu /usr/bin sed "$@" cd sed
+"$@" 'quoted text' grep test sed ${HOME}
+		'quoted text' 2>/dev/null local done done test -eu --verbose awk 'quoted text'
+		echo 2>/dev/null "$1" 2>/dev/null "$@" "$1" grep && --verbose local
+	'quoted text' echo | x=1 printf local readonly done && then
+		local test 2>/dev/null echo x=1 && echo
+/usr/bin 'quoted text' && awk "$1" ${HOME} sed echo cd readonly readonly
+	&& readonly x=1 test sed x=1 export printf then awk | cd
+		test printf "$@" --verbose 2>/dev/null
+		echo readonly -eu /usr/bin -eu x=1 local awk --verbose x=1 test readonly
+		'quoted text' echo && awk && 'quoted text' 2>/dev/null
+		&& 2>/dev/null ${HOME} export /usr/bin local 2>/dev/null ${HOME} ${HOME}
+&& x=1 then sed test cd 'quoted text'
+	awk awk "$1" then --verbose
+		x=1 done /usr/bin export test && /usr/bin test
+	sed "$@" "$@" "$@" x=1 2>/dev/null
+	2>/dev/null x=1 | then readonly test readonly sed 2>/dev/null
+readonly 2>/dev/null && "$@" --verbose done
+		grep export && && -eu then "$@" test "$@" /usr/bin ${HOME} && cd cd x=1 test
+"$1" awk $(pwd) ${HOME} test test "$@"
+		grep readonly /usr/bin sed grep export then done /usr/bin
+/usr/bin "$1" 'quoted text' printf local printf done
+		-eu $(pwd) grep test | | 2>/dev/null local then printf
+	sed sed "$1" $(pwd) local
+sed $(pwd) printf 'quoted text' cd printf | grep -eu
+	printf printf -eu && && then "$@" export export x=1 export $(pwd)
+-eu then 'quoted text' local "$@" && 'quoted text' "$1" then cd "$1" --verbose
+	"$@" cd 'quoted text' awk ${HOME} "$1" x=1 'quoted text'
+	awk 2>/dev/null | "$@" echo
+	readonly printf $(pwd)
+local test /usr/bin done --verbose done echo && done $(pwd) done cd awk | -eu
+${HOME} && printf ${HOME} "$@" echo "$1"
+"$1" awk x=1 --verbose x=1 done then "$1" -eu "$1" awk $(pwd) $(pwd)
+		local readonly cd 2>/dev/null
+		${HOME} && readonly $(pwd)
+sed done -eu "$@" local printf | export "$@" echo printf done
+grep -eu "$@" x=1 export
+		x=1 printf "$1" sed printf awk readonly ${HOME}
+	| | && then sed awk -eu printf local done
+/usr/bin readonly echo 'quoted text' --verbose && 'quoted text' 2>/dev/null x=1
+sed cd && awk done cd 'quoted text' awk "$1" local
+test local done printf awk grep | --verbose
+	printf "$@" export printf /usr/bin x=1 $(pwd) $(pwd)
+	echo -eu done "$@" sed | ${HOME}
+	cd cd --verbose $(pwd) "$@" test printf "$@"
+		--verbose printf --verbose -eu --verbose 2>/dev/null -eu then $(pwd)
+2>/dev/null test cd local "$1" /usr/bin $(pwd) && -eu sed readonly -eu
+		'quoted text' printf x=1
+	cd printf local ${HOME} local test 'quoted text' test 'quoted text'
+		grep readonly done 'quoted text' ${HOME} grep then grep -eu 2>/dev/null "$@"
+export grep && $(pwd) $(pwd) $(pwd) "$@" -eu -eu -eu | && then "$1" awk export
+echo sed "$@" then -eu test $(pwd) /usr/bin ${HOME} then 2>/dev/null
+	awk | awk x=1 "$1" printf grep "$1" "$1" | export $(pwd) export local
+	export /usr/bin | 'quoted text' 'quoted text' -eu then sed local | local
+		printf 'quoted text' awk export sed test "$1" "$@" cd test
+		done -eu export "$1" && $(pwd) | grep -eu 'quoted text' /usr/bin "$@" |
+		printf ${HOME} ${HOME}
+cd export 'quoted text' then grep -eu | done
+| /usr/bin /usr/bin grep test then
+		'quoted text' /usr/bin "$@" sed | "$@" export then x=1 'quoted text'
+	awk "$@" test /usr/bin readonly "$@" awk 'quoted text'
+		-eu --verbose && --verbose sed
+	x=1 --verbose readonly --verbose 2>/dev/null done then readonly
+local sed x=1 "$1" test "$@" x=1 ${HOME} -eu ${HOME} done sed $(pwd)
+	printf && cd done -eu sed export 'quoted text' "$1" -eu -eu test "$1"
+		sed "$1" test done --verbose local printf -eu
+	${HOME} done test "$1" local 'quoted text' /usr/bin
+		| awk "$@" cd then then local awk grep
+		-eu printf "$@" x=1 /usr/bin -eu 2>/dev/null
+		--verbose sed printf grep
+	-eu 2>/dev/null awk x=1 2>/dev/null
+	--verbose printf x=1 -eu
+		/usr/bin "$@" $(pwd) awk then ${HOME} echo local grep then | readonly grep
+awk cd readonly readonly cd grep test -eu then readonly
+		$(pwd) grep test echo done local echo
+		'quoted text' | ${HOME} then then "$@"
+export then grep local 'quoted text' ${HOME} then --verbose ${HOME} grep cd echo
+$(pwd) x=1 "$@" sed /usr/bin
+	then && x=1 export x=1 "$1" 'quoted text' local sed cd 2>/dev/null printf
+		cd x=1 2>/dev/null local done "$@" -eu grep -eu local done
+	awk ${HOME} export ${HOME} $(pwd) -eu | local && "$1" readonly 2>/dev/null
+		&& cd $(pwd) 'quoted text' then /usr/bin
+		-eu grep then --verbose ${HOME} x=1 echo local sed x=1 cd --verbose readonly
+&& -eu | ${HOME} cd echo | local grep readonly "$@" printf
+	done 2>/dev/null readonly echo awk 'quoted text' | grep -eu readonly
+-eu sed echo && cd cd && sed "$@"
+		grep sed readonly local awk "$@" then 'quoted text' /usr/bin
+		readonly 'quoted text' "$1" $(pwd) local export done /usr/bin 2>/dev/null
+local readonly cd 2>/dev/null --verbose $(pwd) | awk
+awk "$1" "$1" $(pwd) cd cd 2>/dev/null --verbose test
+	done 'quoted text' && local ${HOME} $(pwd) sed "$1" cd ${HOME}
+"$1" -eu | done done --verbose /usr/bin export
+test then printf export local then done
+then sed local 'quoted text' 2>/dev/null cd then then export --verbose done test
+"$@" -eu then $(pwd) -eu grep ${HOME} sed -eu printf sed done
+awk export grep local 2>/dev/null
+		local grep x=1 $(pwd) ${HOME}
+		cd test printf test &&
+'quoted text' 2>/dev/null echo awk
+	test test x=1 && cd awk /usr/bin $(pwd) "$1" awk done 2>/dev/null awk /usr/bin
+done test readonly 'quoted text' cd then x=1 /usr/bin echo $(pwd) test export
+local done printf then | &&
+		readonly sed ${HOME} "$1" /usr/bin $(pwd) "$1" done /usr/bin "$1"
+	test test | awk sed $(pwd) | "$1" x=1 |
+	awk /usr/bin then && done awk -eu echo -eu x=1 export -eu /usr/bin awk echo
+then sed ${HOME} done "$1" readonly ${HOME} done test
+	export export awk x=1 /usr/bin cd cd readonly export --verbose && "$@" |
+		"$@" printf && && | "$1" | readonly /usr/bin readonly awk done -eu "$@"
+-eu ${HOME} 'quoted text' then && ${HOME} test
+		grep export ${HOME} 2>/dev/null
+		readonly test 'quoted text' /usr/bin -eu local
+then 2>/dev/null && $(pwd) "$1" then test
+	"$1" 2>/dev/null ${HOME} "$@" awk
+&& "$1" readonly "$1"
+	/usr/bin local done 'quoted text'
+	local && --verbose done grep then ${HOME} "$@" readonly done sed && then
+	then && awk -eu readonly "$@" 2>/dev/null grep
+	2>/dev/null && cd done | $(pwd) awk
+	/usr/bin 'quoted text' sed cd then printf cd | sed cd
+2>/dev/null sed grep local done awk then
+		&& && done --verbose -eu ${HOME}
+		$(pwd) $(pwd) sed readonly --verbose export $(pwd) grep --verbose readonly 2>/dev/null
+2>/dev/null --verbose readonly 'quoted text' readonly
+local | cd 2>/dev/null
+	'quoted text' 'quoted text' awk && then readonly test x=1 'quoted text'
+"$1" 2>/dev/null "$@" ${HOME} printf "$@" -eu sed -eu "$1" local
+	${HOME} x=1 | echo 'quoted text' then grep readonly
+		/usr/bin "$@" 'quoted text' sed && then export /usr/bin
+x=1 then 'quoted text' cd $(pwd) | /usr/bin ${HOME} 'quoted text'
+		/usr/bin export local then $(pwd) --verbose -eu ${HOME}
+"$1" $(pwd) x=1 echo done --verbose cd grep
+	-eu readonly printf done ${HOME} -eu export
+		awk && sed printf 2>/dev/null printf sed export 'quoted text' echo
+		sed test $(pwd) printf cd local grep sed && "$@" echo then printf test 'quoted text'
+'quoted text' then /usr/bin cd --verbose awk 'quoted text' && /usr/bin
+	cd test ${HOME} readonly --verbose 'quoted text'
+	test x=1 --verbose then
+export 2>/dev/null awk cd $(pwd) local ${HOME} awk
+		2>/dev/null then awk done -eu readonly local sed then $(pwd) readonly
+"$1" then -eu --verbose x=1 export export 'quoted text' && "$1" sed
+readonly | cd "$1" awk 'quoted text' local export 'quoted text'
+		${HOME} 2>/dev/null readonly /usr/bin && -eu
+sed -eu then sed then "$@" test /usr/bin test && then
+	"$@" done printf ${HOME} grep grep 2>/dev/null export grep
+		x=1 x=1 x=1 "$1" /usr/bin test && --verbose done awk x=1 export
+		--verbose | ${HOME} 2>/dev/null $(pwd) ${HOME} local "$@"
+		/usr/bin 'quoted text' | local sed readonly "$@" grep
+		printf local printf -eu 2>/dev/null && test 2>/dev/null test
+	echo cd -eu "$1" ${HOME} cd ${HOME} --verbose && 2>/dev/null
+x=1 "$1" echo printf --verbose readonly && grep 2>/dev/null ${HOME} && $(pwd)
+"$1" done sed awk sed test printf awk | /usr/bin "$1" --verbose --verbose
+	-eu /usr/bin 'quoted text' "$1" awk ${HOME} /usr/bin x=1 cd echo awk x=1 "$1"
+	echo sed && ${HOME} /usr/bin
+		local "$@" | 'quoted text'
+	sed /usr/bin --verbose && -eu 'quoted text'
+then -eu grep /usr/bin sed -eu grep
+	done && grep "$1" ${HOME} awk done x=1
+		--verbose && --verbose /usr/bin
+awk x=1 --verbose "$@" x=1 | export readonly readonly && local
+/usr/bin then 2>/dev/null readonly test export $(pwd) && -eu test ${HOME}
+	echo $(pwd) 'quoted text' local
+--verbose x=1 && local "$@" x=1 grep cd -eu "$@" then x=1
+	local $(pwd) "$1" ${HOME} cd readonly echo export echo sed 'quoted text'
+		done local 'quoted text'
+	readonly grep awk x=1 | cd grep ${HOME}
+		2>/dev/null sed /usr/bin
+"$@" test readonly --verbose $(pwd) | readonly export "$1" --verbose
+done then echo cd awk && /usr/bin readonly
+local grep done awk done && readonly 2>/dev/null echo printf
+		'quoted text' | then cd /usr/bin 2>/dev/null grep printf "$1" "$@"
+	cd --verbose "$1" printf 2>/dev/null "$@" $(pwd) export "$1" $(pwd) export
+	/usr/bin "$1" local sed cd done local then export $(pwd) readonly |
+	grep then "$1" printf "$1" readonly ${HOME}
+	local 'quoted text' local /usr/bin printf test printf /usr/bin -eu then echo
+		cd x=1 done sed x=1 x=1 --verbose
+echo test 'quoted text' | grep | local test
+		grep readonly 'quoted text' x=1 export cd ${HOME} $(pwd) cd | printf && x=1
+		| x=1 -eu 2>/dev/null sed && test "$1" readonly test awk grep printf "$@" sed
+	/usr/bin | -eu readonly printf
+	awk cd grep local readonly $(pwd) awk cd /usr/bin sed readonly export /usr/bin
+	/usr/bin readonly --verbose -eu $(pwd) | && test 'quoted text'
+		&& -eu x=1 grep echo $(pwd) $(pwd)
+	2>/dev/null awk sed local then awk done done done local awk cd -eu "$@" $(pwd)
+echo then printf printf cd done printf "$1" 2>/dev/null
+then x=1 x=1 awk grep sed awk echo && printf
+	| local "$1" $(pwd) test $(pwd) grep --verbose --verbose && x=1 'quoted text' 'quoted text'
+		grep -eu "$1" sed "$@" grep /usr/bin 2>/dev/null "$1"
+cd awk awk local local 2>/dev/null ${HOME} 2>/dev/null export printf 'quoted text'
+	| -eu -eu done printf --verbose "$1"
+	sed printf "$1" export
+		&& printf echo $(pwd) local 'quoted text' export 2>/dev/null
+--verbose ${HOME} | "$@"
+--verbose && then 'quoted text' readonly ${HOME} echo awk then && done readonly
+${HOME} 'quoted text' readonly x=1 /usr/bin x=1 local echo cd
+&& --verbose | | cd $(pwd) awk $(pwd) export done
+	echo ${HOME} readonly | printf awk cd
+		cd test test ${HOME} --verbose export done && "$1" printf "$@"
+local $(pwd) && -eu local "$1" --verbose "$1" export echo grep
+	echo grep 'quoted text' then /usr/bin
+cd /usr/bin "$@" x=1 -eu readonly test 'quoted text'
+	awk && "$@" export ${HOME} x=1 done /usr/bin awk sed
+		${HOME} done 'quoted text' /usr/bin x=1 echo echo local
+readonly grep $(pwd) printf awk && grep cd done "$@" cd "$@" ${HOME}
+-eu /usr/bin $(pwd) test grep -eu -eu "$1" cd readonly readonly then
+		export grep && 2>/dev/null printf "$@" "$1" ${HOME}
+awk -eu export "$1" x=1 x=1
+		readonly test --verbose
+printf 'quoted text' /usr/bin export cd echo | then grep awk "$1" then
+	printf "$@" 'quoted text' $(pwd) "$@" /usr/bin "$@" "$1" then grep "$@"
+		${HOME} 2>/dev/null readonly grep | /usr/bin
+	/usr/bin cd ${HOME} cd cd -eu --verbose
+	printf -eu grep | readonly 'quoted text'
+2>/dev/null sed done test --verbose local && printf /usr/bin
+cd export -eu cd test ${HOME} $(pwd) ${HOME} cd done export echo echo
+done then cd then done cd 'quoted text' x=1 --verbose export 'quoted text'
+	awk | test 2>/dev/null 2>/dev/null -eu local && then && grep
+		printf x=1 printf awk x=1 printf ${HOME} 'quoted text'
+grep ${HOME} x=1 export readonly echo
+		/usr/bin "$@" $(pwd) && printf sed
+		test --verbose sed /usr/bin x=1 readonly readonly local
+	${HOME} /usr/bin x=1 printf $(pwd) grep printf
+	cd then $(pwd) awk --verbose | local $(pwd) x=1 "$1" 2>/dev/null cd readonly
+printf --verbose readonly then 2>/dev/null done test "$1" --verbose
+		"$1" readonly done awk x=1 then echo 2>/dev/null cd echo readonly
+		x=1 done 'quoted text' "$@" then cd local test awk
+	grep 'quoted text' readonly 'quoted text'
+printf "$1" printf --verbose "$1" -eu
+| done sed export printf sed cd printf export 'quoted text'
+	local cd /usr/bin && --verbose export
+	| $(pwd) --verbose "$1" $(pwd) $(pwd) echo grep
+'quoted text' sed then awk local local awk | awk test 'quoted text'
+2>/dev/null x=1 then /usr/bin 'quoted text' &&
+		grep export 2>/dev/null printf
+		x=1 printf test ${HOME} x=1
+local x=1 && sed /usr/bin export local ${HOME} then local awk sed done
+grep ${HOME} ${HOME} /usr/bin then -eu then test awk done 'quoted text'
+	2>/dev/null --verbose printf ${HOME} | | then "$@" then "$1"
+		sed "$1" $(pwd) "$@" sed echo 'quoted text' "$@"
+	x=1 --verbose sed echo awk readonly awk
+2>/dev/null 'quoted text' grep
+		"$1" ${HOME} --verbose local local /usr/bin local
+		$(pwd) cd "$1" then 2>/dev/null "$@" export
+	export --verbose && -eu echo echo 'quoted text' echo "$1" sed "$1" "$@"
+printf -eu "$@" sed 2>/dev/null
+	cd echo grep /usr/bin x=1 readonly 2>/dev/null readonly ${HOME} -eu done "$@"
+"$1" -eu | then then | && sed echo "$@" awk "$@" grep echo export printf
+		2>/dev/null grep "$1" "$1"
+	test $(pwd) --verbose "$@" test x=1 cd echo
+&& 2>/dev/null cd cd --verbose cd 'quoted text'
+		"$@" "$@" readonly /usr/bin -eu x=1 /usr/bin $(pwd)
+readonly sed then then -eu x=1 && cd "$1" x=1 'quoted text' export local
+	sed ${HOME} test sed local && echo
+--verbose ${HOME} awk sed
+	grep local readonly printf && readonly 'quoted text' then cd
+		sed $(pwd) echo sed --verbose grep "$1" ${HOME} then | sed printf $(pwd)
+cd test "$1" $(pwd) && 2>/dev/null
+		&& $(pwd) /usr/bin export printf done $(pwd) done /usr/bin readonly
+	x=1 local local printf | -eu grep sed done then grep | && | export grep
+		test readonly -eu grep 2>/dev/null 2>/dev/null | $(pwd) echo printf
+		then 'quoted text' readonly "$@" && $(pwd) "$@" "$1" export "$1" then awk
+		/usr/bin /usr/bin x=1 readonly ${HOME} printf --verbose
+export readonly -eu test
+awk && echo /usr/bin echo done sed && test then ${HOME}
+$(pwd) ${HOME} /usr/bin then 2>/dev/null export awk | local 2>/dev/null
+		${HOME} | export local
+		'quoted text' awk local 2>/dev/null grep 2>/dev/null done x=1 test sed export 'quoted text'
+	${HOME} cd "$@" "$1" x=1 echo
+2>/dev/null local printf test then && then ${HOME} /usr/bin $(pwd)
+x=1 echo "$@" --verbose local readonly 2>/dev/null -eu readonly --verbose
+x=1 x=1 2>/dev/null /usr/bin $(pwd) awk
+	then x=1 grep --verbose && "$1" -eu echo test $(pwd) export
+	"$@" awk && grep done "$1" x=1 'quoted text' printf
+printf /usr/bin echo /usr/bin ${HOME} 'quoted text' -eu then readonly
+"$@" 'quoted text' -eu grep then $(pwd) echo x=1 'quoted text' sed grep
+		x=1 cd export readonly --verbose test "$@" then "$@" cd &&
+		$(pwd) x=1 /usr/bin $(pwd) then && x=1 x=1 cd /usr/bin printf x=1 $(pwd) grep
+	done echo readonly export cd local "$1" printf 'quoted text' --verbose --verbose
+	-eu sed "$1" -eu readonly --verbose cd "$1" /usr/bin
+"$1" awk | printf export 'quoted text'
+2>/dev/null && 2>/dev/null && local /usr/bin
+	&& -eu && | sed export awk -eu export && "$1"
+	| sed cd 'quoted text' x=1 awk awk echo then | | ${HOME}
+2>/dev/null "$1" test 'quoted text' "$1" "$1"
+sed 2>/dev/null "$1" -eu 2>/dev/null test readonly
+grep /usr/bin "$1" | grep echo
+	${HOME} echo | printf export cd then -eu echo then sed done
+	sed 2>/dev/null "$1" grep local awk export ${HOME} -eu /usr/bin | --verbose
+	-eu --verbose 2>/dev/null --verbose 2>/dev/null /usr/bin x=1 | x=1
+		x=1 local grep echo then x=1 "$1" awk && then
+	x=1 then x=1 "$1" /usr/bin /usr/bin
+		readonly && "$@" x=1 test cd && && --verbose --verbose done then
+		echo then && && sed && /usr/bin sed
+		grep echo done done $(pwd) "$1" $(pwd) cd
+	readonly cd --verbose local then
+	2>/dev/null $(pwd) grep && sed sed -eu export -eu echo 2>/dev/null
+local then && /usr/bin test 'quoted text'
+-eu -eu sed --verbose --verbose
+		--verbose grep && done awk "$@" && 2>/dev/null
+-eu | --verbose done export readonly 2>/dev/null awk
+x=1 && -eu ${HOME} $(pwd) grep
+'quoted text' readonly | sed test --verbose ${HOME} "$@" ${HOME} "$@" readonly
+export done ${HOME} local cd $(pwd) "$1" -eu awk
+		&& awk printf "$@" "$1" local 2>/dev/null
+test readonly export printf export "$@" echo | x=1 grep
+		export -eu local x=1 readonly readonly -eu | 2>/dev/null
+		export readonly "$@" printf 2>/dev/null && done export
+"$@" export -eu 'quoted text' grep
+	--verbose /usr/bin --verbose |
+printf sed -eu ${HOME} cd -eu sed cd ${HOME} sed && --verbose | /usr/bin --verbose
+sed echo --verbose "$@"
+		--verbose 2>/dev/null ${HOME} && then test "$1" "$@"
+		printf readonly | then ${HOME} --verbose sed "$@" test readonly "$@" local readonly
+		"$1" sed test && x=1 grep 2>/dev/null -eu local local done "$1" readonly |
+grep printf echo /usr/bin 2>/dev/null -eu awk
+	| 'quoted text' local echo grep x=1 grep printf printf awk --verbose
+then $(pwd) 2>/dev/null test export local export x=1 "$1" export local |
+grep test test $(pwd) /usr/bin grep sed | printf 2>/dev/null local $(pwd) 'quoted text'
+done -eu $(pwd) | /usr/bin /usr/bin
+	"$1" -eu echo export test 'quoted text'
+test "$1" "$1" && -eu done then then 'quoted text' readonly
+		| "$1" then "$@" --verbose /usr/bin --verbose "$@" then
+done local readonly grep 'quoted text' "$1" $(pwd) "$@" && -eu local x=1
+export --verbose && readonly "$1" "$1" printf then test readonly "$@" | awk
+done | --verbose local 'quoted text' test sed ${HOME} grep "$@"
+$(pwd) grep | $(pwd) --verbose grep --verbose
+	x=1 ${HOME} cd 2>/dev/null then test then grep
+	--verbose awk done awk && 'quoted text'
+		"$@" export "$1" sed 'quoted text' then 2>/dev/null ${HOME} sed
+	echo then /usr/bin awk then && -eu awk ${HOME} cd echo 2>/dev/null
+		awk --verbose /usr/bin
+cd $(pwd) cd ${HOME} local cd then ${HOME} sed "$1" awk -eu | 'quoted text'
+/usr/bin test readonly | x=1 readonly
+	sed x=1 sed && export /usr/bin awk && $(pwd) readonly x=1
+		x=1 awk done "$@" && && ${HOME} done local cd then awk x=1 echo
+		&& -eu /usr/bin && && /usr/bin | printf local /usr/bin 'quoted text' -eu test
+${HOME} cd 'quoted text' /usr/bin | ${HOME} done
+	$(pwd) awk readonly && done "$@" -eu test done
+	"$1" awk echo printf echo readonly ${HOME}
+	test && /usr/bin grep done
+readonly --verbose grep ${HOME} test
+		x=1 x=1 -eu -eu then printf && "$1" test && 'quoted text' --verbose
+	'quoted text' done awk grep echo
+cd $(pwd) done && sed /usr/bin
+echo "$1" /usr/bin "$1" sed awk awk awk /usr/bin && --verbose ${HOME}
+	echo sed $(pwd) ${HOME} readonly 2>/dev/null printf --verbose echo ${HOME} readonly
+--verbose grep x=1 --verbose ${HOME} readonly | "$@" grep 'quoted text' readonly
+	x=1 ${HOME} 2>/dev/null | x=1
+${HOME} $(pwd) "$1" then "$1" then $(pwd) test "$@"
+	export /usr/bin /usr/bin | $(pwd) readonly && "$1" echo $(pwd)
+		readonly ${HOME} "$@" "$1" $(pwd) ${HOME} -eu local
+	x=1 echo | 2>/dev/null echo test
+	readonly --verbose cd 2>/dev/null
+		2>/dev/null readonly 'quoted text' /usr/bin | done "$@" -eu sed && && grep test
+$(pwd) export cd then 'quoted text'
+	cd "$@" --verbose "$@" "$@" "$1" && /usr/bin | $(pwd)
+printf readonly then export | sed "$1" 'quoted text' awk local
+$(pwd) x=1 export | /usr/bin "$@" "$1" | -eu "$1" $(pwd) then export then $(pwd)
+	&& /usr/bin echo x=1 awk --verbose
+	-eu export 'quoted text'
+		export "$1" done -eu local readonly done "$@" ${HOME} && 'quoted text' "$@"
+readonly then $(pwd) export 2>/dev/null $(pwd) 'quoted text'
+	--verbose "$@" awk /usr/bin -eu cd export -eu done
+		&& /usr/bin 2>/dev/null test
+sed --verbose then && 2>/dev/null cd awk "$@" | printf --verbose "$1" "$1" done
+	--verbose cd grep awk "$1" test grep ${HOME} echo sed echo && cd "$@" 2>/dev/null
+	sed grep sed test -eu done | --verbose -eu
+${HOME} test | export
+readonly 'quoted text' printf -eu ${HOME} export local cd "$@" "$@"
+	-eu then $(pwd) done x=1 export echo x=1 sed grep sed grep readonly |
+&& test x=1 echo /usr/bin then && --verbose | done ${HOME} 'quoted text' --verbose
+		sed grep echo -eu local printf readonly -eu ${HOME}
+done sed && x=1 | local "$1" "$@" /usr/bin readonly x=1 --verbose ${HOME} echo
+	grep --verbose echo -eu ${HOME} "$@" -eu sed export /usr/bin
+sed done 2>/dev/null then
+		"$@" printf "$@" readonly echo $(pwd) "$@" test export
+		"$1" printf -eu readonly $(pwd) printf -eu printf 'quoted text' /usr/bin
+		&& export --verbose $(pwd) 2>/dev/null cd sed x=1 'quoted text' /usr/bin 'quoted text'
+	| 2>/dev/null export cd local -eu printf && then | readonly -eu done printf
+		/usr/bin $(pwd) /usr/bin echo --verbose "$@" $(pwd) $(pwd)
+'quoted text' 2>/dev/null "$@" grep awk "$1" | sed
+export awk -eu | grep 2>/dev/null local then local echo -eu -eu -eu local 'quoted text'
+awk test x=1 readonly "$1" export --verbose
+		cd done awk cd 'quoted text' printf /usr/bin printf "$1" --verbose then grep
+	"$1" --verbose /usr/bin
+	&& local x=1 && then "$@" readonly then cd -eu "$1" 'quoted text'
+		/usr/bin "$@" ${HOME} "$1" cd $(pwd) 2>/dev/null grep grep | readonly | x=1 | ${HOME}
+	awk | printf 2>/dev/null -eu -eu
+| local grep -eu /usr/bin ${HOME} local done -eu sed
+--verbose ${HOME} /usr/bin awk readonly && cd "$1" "$@" 2>/dev/null
+		/usr/bin done --verbose grep done awk
+	done "$1" -eu && grep done printf | 'quoted text' grep
+echo awk sed "$1" echo $(pwd) awk awk then 'quoted text'
+	"$@" grep awk test test test /usr/bin /usr/bin /usr/bin done /usr/bin
+	local /usr/bin cd done | done -eu --verbose
+		'quoted text' done grep done export && $(pwd) && ${HOME}
+cd 2>/dev/null export "$@" echo local
+done export done | printf awk
+	export grep | export /usr/bin
+		-eu | local readonly local
+	then /usr/bin cd && sed readonly echo $(pwd) x=1 awk ${HOME}
+echo && echo sed then && && | then
+		then --verbose then ${HOME} "$1" readonly test
+"$1" echo /usr/bin "$@" grep | 2>/dev/null sed ${HOME}
+| awk sed test && $(pwd) 'quoted text' ${HOME} 'quoted text' readonly
+		-eu "$@" export sed | local export
+	sed awk awk $(pwd) done -eu "$@" sed ${HOME} done ${HOME} export "$1" done $(pwd)
+done test local 'quoted text' $(pwd) then done local then | printf
+		sed export then --verbose readonly x=1 test --verbose export grep readonly
+	--verbose --verbose $(pwd) | local printf 'quoted text' sed
+sed printf | grep $(pwd) --verbose && awk test ${HOME} cd done
+		| ${HOME} ${HOME} --verbose
+	2>/dev/null test | $(pwd) grep ${HOME} readonly sed -eu 2>/dev/null --verbose
+		${HOME} export | --verbose ${HOME} $(pwd)
+cd $(pwd) 2>/dev/null "$1" export then sed x=1 printf printf
+	done -eu sed /usr/bin | --verbose then echo awk echo local test ${HOME}
+		local done echo x=1 && | ${HOME} export printf -eu
+		2>/dev/null ${HOME} test sed readonly
+	| $(pwd) awk -eu ${HOME} cd ${HOME}
+		local grep cd 'quoted text' 2>/dev/null "$1" then sed && -eu 'quoted text' $(pwd)
+		'quoted text' grep "$@" --verbose printf -eu sed export local echo ${HOME}
+'quoted text' then x=1 then "$@" 2>/dev/null
+		export done grep local
+${HOME} 'quoted text' "$@"
+		"$1" | && export echo test sed -eu "$1" "$1" echo /usr/bin 2>/dev/null done printf
+		local $(pwd) x=1 test done grep test printf "$@"
+sed 2>/dev/null test grep cd done grep export sed done
+$(pwd) awk awk && "$1" then && printf
+&& echo echo ${HOME} local /usr/bin echo awk | -eu && test x=1 x=1 echo local
+	awk readonly echo --verbose then
+"$1" ${HOME} local && done "$@"
+		grep -eu test echo grep printf awk -eu "$@"
+2>/dev/null ${HOME} && "$@" echo awk $(pwd) printf | local --verbose ${HOME}
+		readonly 'quoted text' --verbose | done cd /usr/bin $(pwd) "$@"
+	--verbose "$1" | test --verbose | then $(pwd) awk then "$1" $(pwd) cd
+	2>/dev/null --verbose printf echo printf
+	${HOME} test echo readonly | echo -eu local --verbose export
+awk local grep sed 2>/dev/null export sed test cd awk --verbose $(pwd) $(pwd) readonly
+	printf ${HOME} 'quoted text' cd cd && awk cd && awk then echo ${HOME} then printf
+| readonly export export cd 'quoted text' then readonly export done done
+readonly "$1" export "$@" sed "$1" sed /usr/bin done x=1 sed "$@" cd done
+	export -eu printf done "$@" --verbose printf
+	echo 'quoted text' 'quoted text'
+		awk sed sed awk && echo "$@"
+		test x=1 cd --verbose test echo | readonly grep readonly done
+		grep local ${HOME} grep ${HOME} 2>/dev/null -eu $(pwd)
+-eu sed && /usr/bin "$@" export printf --verbose
+	"$@" 2>/dev/null local done awk echo grep && echo /usr/bin && --verbose
+		2>/dev/null | 2>/dev/null ${HOME} then $(pwd) x=1 export && 2>/dev/null
+		sed then -eu ${HOME} cd awk printf sed x=1 grep 'quoted text'
+	readonly --verbose echo echo ${HOME} $(pwd) "$@" echo local
+		"$@" /usr/bin -eu "$1"
+		$(pwd) -eu $(pwd) export local | printf done "$1" "$@" $(pwd) cd printf
+	cd --verbose readonly | /usr/bin ${HOME} | |
+| local echo --verbose grep 2>/dev/null
+	cd readonly ${HOME} grep test printf && x=1 'quoted text' && readonly
+		x=1 test done x=1 sed $(pwd) $(pwd) | "$@" 2>/dev/null
+	export | echo 'quoted text' "$@" awk 2>/dev/null
+	/usr/bin --verbose test readonly --verbose
+		then cd done export && --verbose "$1" 2>/dev/null
+/usr/bin cd "$1" "$@" export test | | 2>/dev/null 2>/dev/null 2>/dev/null ${HOME}
+grep 'quoted text' -eu 'quoted text' "$1"
+	'quoted text' readonly
+${HOME} done "$@" $(pwd) test &&
+		2>/dev/null printf | cd local
+		/usr/bin | | "$@" sed ${HOME}
+2>/dev/null echo test 2>/dev/null then export test
+sed then ${HOME} test "$@" 'quoted text'
+test $(pwd) ${HOME} /usr/bin ${HOME} test readonly
+	x=1 export printf done export done done
+then $(pwd) cd sed $(pwd) $(pwd) -eu "$1"
+	&& $(pwd) && export && | echo && "$1" awk awk test printf echo /usr/bin
+	local sed "$@" cd $(pwd)
+	&& $(pwd) printf "$1" awk && local ${HOME} cd && 'quoted text'
+"$1" awk sed then readonly $(pwd) printf 'quoted text'
+sed then 'quoted text' local 'quoted text' awk && grep "$@"
+	printf cd x=1 sed -eu test /usr/bin printf $(pwd) cd then /usr/bin grep --verbose
+$(pwd) --verbose x=1 sed awk awk ${HOME} 'quoted text'
+	| grep then "$@" "$1" echo 'quoted text' test printf | | && printf
+		x=1 awk $(pwd) -eu "$@" x=1 && "$1" readonly --verbose then
+printf test test echo then $(pwd) 2>/dev/null
+		2>/dev/null test --verbose awk 'quoted text' --verbose x=1 grep sed $(pwd)
+		readonly then 'quoted text' cd local 'quoted text'
+		echo readonly done x=1 'quoted text'
+export echo local sed 'quoted text' echo
+		echo printf then echo
+	$(pwd) --verbose -eu -eu printf
+		sed && 2>/dev/null && | test
+	awk local cd cd "$@" export cd "$@" x=1 -eu
+export done ${HOME} test done && x=1 $(pwd)
+	grep --verbose 'quoted text' ${HOME}
+	then awk done local --verbose sed --verbose -eu "$1" test x=1 "$1" local
+cd grep ${HOME} | $(pwd) "$@" $(pwd) --verbose then x=1
+	grep "$1" && printf "$1" ${HOME} 2>/dev/null export printf
+test -eu | "$1" then readonly 2>/dev/null echo 2>/dev/null test && done x=1 cd
+export | 2>/dev/null awk awk /usr/bin local sed /usr/bin then echo printf
+grep sed grep then "$1" test 'quoted text'
+printf && test x=1 2>/dev/null export echo then grep /usr/bin -eu
+	printf export grep $(pwd) $(pwd) | sed printf $(pwd) "$@" 2>/dev/null
+x=1 ${HOME} done "$@" then
+grep awk done printf x=1 echo grep printf
+		x=1 printf export ${HOME} 2>/dev/null &&
+		grep grep /usr/bin awk "$@" ${HOME} test 2>/dev/null readonly $(pwd) then &&
+		readonly 'quoted text' readonly "$@" test
+	--verbose ${HOME} cd 'quoted text' then ${HOME}
+		2>/dev/null test 'quoted text' 'quoted text' | local cd readonly then
+		sed --verbose grep 'quoted text' awk | x=1 cd "$1" --verbose x=1
+	local export export /usr/bin 2>/dev/null
+${HOME} -eu echo test "$1" "$@" $(pwd) local awk $(pwd) $(pwd) grep && local
+&& test echo local && --verbose
+x=1 2>/dev/null test cd --verbose sed local --verbose $(pwd)
+/usr/bin ${HOME} "$1" test /usr/bin printf cd "$@"
+	cd cd -eu awk echo echo /usr/bin && x=1 /usr/bin sed
+		readonly readonly "$1" sed readonly export $(pwd) then --verbose done -eu grep
+awk awk awk | $(pwd) awk ${HOME} $(pwd) then
+		local ${HOME} ${HOME} -eu local
+${HOME} export done ${HOME} printf echo local export --verbose
+		sed 2>/dev/null ${HOME} --verbose grep 'quoted text'
+		x=1 "$@" $(pwd) grep /usr/bin grep ${HOME}
+	--verbose 2>/dev/null x=1 2>/dev/null done
+-eu echo -eu echo $(pwd) local /usr/bin && cd && echo x=1 sed 'quoted text'
+cd $(pwd) 'quoted text' "$@" x=1 $(pwd) $(pwd)
+then $(pwd) ${HOME} sed export | test
+	${HOME} readonly export cd $(pwd) "$@" test "$1"
+2>/dev/null x=1 x=1 $(pwd) then sed test
+	"$1" ${HOME} grep sed "$1"
+	local $(pwd) done then "$@" local
+	then then | readonly | sed $(pwd) $(pwd) done "$1" echo
+		echo $(pwd) $(pwd) 'quoted text'
+	&& 2>/dev/null done sed
+| ${HOME} x=1 2>/dev/null $(pwd) /usr/bin printf printf $(pwd) awk
+	echo grep grep export 'quoted text' | echo
+"$1" "$@" | test echo echo sed
+readonly | && echo sed "$@" "$1" grep export
+		sed | test local x=1 -eu "$1" done ${HOME} 2>/dev/null then printf
+		"$@" grep ${HOME} awk x=1
+	then && sed 'quoted text' && sed --verbose echo | echo sed awk 'quoted text'
+		export export && ${HOME} ${HOME} echo export sed && "$@" awk
+$(pwd) x=1 then test cd then printf && | export sed $(pwd) | ${HOME} 'quoted text'
+		${HOME} | export sed awk readonly "$@" /usr/bin
+		done $(pwd) sed export -eu --verbose && -eu sed /usr/bin local -eu && done then
+	local export local export done $(pwd) | --verbose
+		done export cd 'quoted text'
+	&& "$@" ${HOME} /usr/bin ${HOME} cd -eu | done --verbose echo "$1"
+		cd 2>/dev/null && "$@" ${HOME} x=1 cd then echo cd grep echo echo 2>/dev/null
+	$(pwd) "$@" /usr/bin $(pwd) $(pwd) "$1" x=1 --verbose $(pwd)
+		local 2>/dev/null printf local sed 2>/dev/null "$1" export "$@" done
+	printf done x=1 sed readonly 2>/dev/null cd printf done local cd x=1
+	"$1" export $(pwd) export $(pwd) readonly --verbose export printf "$@"
+$(pwd) sed then cd printf -eu --verbose
+	${HOME} 2>/dev/null x=1 /usr/bin printf
+$(pwd) then | grep done -eu printf grep &&
+test export /usr/bin "$@" echo sed
+"$@" then "$@" local $(pwd) | $(pwd) export printf | awk printf --verbose /usr/bin
+"$@" local && awk "$1" "$@" cd grep ${HOME} done echo test grep grep done
+awk ${HOME} -eu /usr/bin sed /usr/bin grep ${HOME}
+2>/dev/null | ${HOME} local sed && --verbose
+	done ${HOME} 2>/dev/null grep export test
+$(pwd) x=1 then && local && grep 2>/dev/null cd test "$1"
+	printf done printf $(pwd) 'quoted text' echo awk -eu
+-eu echo 'quoted text' test "$@" test "$1" sed then --verbose
+		$(pwd) sed && --verbose "$1" && echo | $(pwd) echo echo
+	"$@" --verbose sed readonly $(pwd) -eu
+	export sed | 'quoted text' 'quoted text' test
+	local done cd awk sed done printf "$@" local grep readonly -eu export -eu export
+		done test -eu echo --verbose echo 'quoted text' 2>/dev/null
+	$(pwd) x=1 export test
+		$(pwd) printf test readonly local readonly "$@" export
+	sed local sed x=1 echo test printf x=1 -eu printf 'quoted text' cd done
+		done sed test readonly | export done | ${HOME}
+	"$1" test /usr/bin done export awk ${HOME} "$@"
+	done readonly printf done
+	test cd 'quoted text' $(pwd) $(pwd) -eu && /usr/bin ${HOME} done --verbose echo
+		$(pwd) awk echo grep echo test 'quoted text' then echo then then | local "$1" printf
+		x=1 cd $(pwd) cd test
+then awk then -eu local done ${HOME} local /usr/bin
+		echo -eu 'quoted text' "$@" grep readonly
+	"$1" test "$1" x=1 /usr/bin --verbose local "$1" | | 2>/dev/null "$@" awk
+	-eu done 2>/dev/null | && export local then grep cd && echo local |
+	test export local -eu awk "$1" -eu readonly
+		x=1 "$1" grep printf "$@" echo "$@" "$1" echo "$@" local | x=1 readonly
+awk echo /usr/bin "$@" export x=1 sed echo sed x=1 sed x=1 then $(pwd)
+"$1" | /usr/bin readonly cd export --verbose x=1 $(pwd) printf | --verbose
+/usr/bin cd 'quoted text'
+	| && local printf x=1 readonly cd "$1" grep 'quoted text' x=1
+		done --verbose readonly "$@" test ${HOME}
+		printf grep 2>/dev/null
+	readonly /usr/bin sed done | done "$@"
+		&& echo then && "$1" sed "$1" x=1 -eu done --verbose
+"$@" done local x=1 done
+	printf readonly awk sed export sed test cd printf /usr/bin "$@" test 2>/dev/null
+		"$@" grep "$1" local grep readonly test 'quoted text' /usr/bin printf -eu local
+printf done $(pwd) readonly
+	| | export "$@" 'quoted text' cd $(pwd) printf ${HOME} sed 2>/dev/null
+	$(pwd) then readonly printf awk then "$@" /usr/bin grep /usr/bin
+		sed "$@" readonly x=1 echo /usr/bin | /usr/bin echo ${HOME}
+	'quoted text' grep printf "$1" awk export local
+	&& && --verbose --verbose "$@" grep export done echo export "$1"
+printf ${HOME} | -eu test 'quoted text' | test done x=1 cd
+		done local grep awk then && $(pwd) done $(pwd) awk sed grep -eu -eu --verbose
+		test 2>/dev/null 2>/dev/null echo /usr/bin
+		x=1 /usr/bin | -eu $(pwd) printf local echo -eu export then
+		$(pwd) x=1 x=1 local cd grep export test 'quoted text' cd $(pwd) "$@" "$1"
+		| | printf awk --verbose ${HOME} | $(pwd) "$1" "$1"
+export cd sed | "$1" export | sed "$1" $(pwd)
+	grep then readonly 2>/dev/null echo 'quoted text'
+test test test grep test ${HOME} 'quoted text' | --verbose then "$1" readonly |
+		| grep cd printf test x=1 readonly | "$@" export /usr/bin echo printf ${HOME} awk
+	printf "$1" 'quoted text' awk
+		readonly --verbose x=1 printf && -eu sed 'quoted text'
+		readonly local /usr/bin 'quoted text'
+		| grep --verbose 'quoted text' readonly
+echo printf 2>/dev/null awk then && then done test then | $(pwd) /usr/bin
+		test done sed --verbose | grep 2>/dev/null ${HOME} 'quoted text' $(pwd)
+'quoted text' cd /usr/bin test "$1" x=1 --verbose $(pwd) test export done
+echo done export /usr/bin printf echo | 2>/dev/null "$1" --verbose sed then grep
+		--verbose "$@" echo x=1 2>/dev/null $(pwd) printf ${HOME} export
+		/usr/bin local done awk -eu | test $(pwd) --verbose
+cd /usr/bin $(pwd) cd local && done x=1 cd $(pwd)
+awk /usr/bin done "$1" cd done --verbose cd /usr/bin readonly
+"$1" grep test grep awk --verbose echo done 'quoted text' grep
+	export "$1" readonly --verbose "$1" ${HOME} readonly ${HOME} |
+		| readonly "$1" test "$1" $(pwd) then readonly
+"$1" | cd ${HOME} 2>/dev/null --verbose /usr/bin grep --verbose then export
+then awk /usr/bin local
+		sed "$@" 'quoted text' -eu "$1" "$1"
+		'quoted text' 'quoted text'
+	readonly sed "$@" --verbose
+		awk export "$@" sed printf done ${HOME} "$1" /usr/bin test echo "$1" printf -eu
+&& printf done test -eu test 'quoted text' printf
+		local readonly printf 2>/dev/null 2>/dev/null then awk echo
+2>/dev/null awk grep cd
+		/usr/bin done export grep ${HOME} ${HOME} | then
+		local cd | 'quoted text' && sed cd then grep
+grep then then $(pwd) echo ${HOME} awk "$1" && x=1 2>/dev/null done echo
+		test done grep then 2>/dev/null
+	2>/dev/null 'quoted text' && then
+	export ${HOME} "$1" ${HOME} sed printf export && local $(pwd)
+	cd ${HOME} 'quoted text' "$@"
+	local 'quoted text' printf --verbose 2>/dev/null
+	then | 'quoted text' && "$@"
+		2>/dev/null grep echo | awk --verbose done local cd /usr/bin x=1
+	-eu 2>/dev/null cd -eu /usr/bin --verbose -eu 2>/dev/null /usr/bin
+x=1 grep grep --verbose && | "$@" printf printf | x=1 grep done 2>/dev/null echo
+	"$1" awk then ${HOME} local printf done --verbose
+		cd cd echo done ${HOME} local done
+		${HOME} local sed 'quoted text'
+		&& "$1" /usr/bin x=1 grep 2>/dev/null ${HOME} 'quoted text' readonly
+then printf 2>/dev/null test awk
+-eu readonly $(pwd) test "$@" export export && ${HOME} $(pwd)
+	grep sed /usr/bin | printf "$@" && "$@" "$@" printf 'quoted text' x=1
+| "$@" --verbose "$1"
+	grep readonly "$1" test export printf "$1" then
+done echo | --verbose x=1 ${HOME}
+	$(pwd) "$1" --verbose export awk 'quoted text' test $(pwd) --verbose
+		local /usr/bin /usr/bin test ${HOME} readonly x=1 test grep ${HOME}
+	local "$1" 'quoted text' -eu x=1 2>/dev/null /usr/bin export grep 'quoted text'
+		test readonly && done ${HOME}
+		"$1" | local "$@" then local then export then printf
+-eu 'quoted text' 2>/dev/null 2>/dev/null $(pwd) done "$1"
+		done 'quoted text' | ${HOME} /usr/bin -eu -eu "$1" -eu | sed cd | $(pwd) |
+		2>/dev/null readonly local /usr/bin readonly -eu done "$1" done cd 2>/dev/null test
+'quoted text' grep test --verbose test export printf 2>/dev/null
+echo --verbose cd ${HOME} readonly "$1" test printf
+'quoted text' done --verbose ${HOME} awk then awk done readonly "$1" export cd "$1"
+	$(pwd) echo grep -eu "$@" local cd printf -eu x=1 --verbose
+	"$@" local cd awk printf readonly -eu
+		"$1" 'quoted text' ${HOME} "$@" x=1 -eu sed export /usr/bin echo 2>/dev/null grep
+		"$@" | sed /usr/bin cd echo local echo awk --verbose then -eu done x=1
+test readonly local && readonly printf 'quoted text'
+2>/dev/null test /usr/bin sed test export -eu ${HOME}
+		$(pwd) export test 2>/dev/null
+	then --verbose sed then cd
+		sed x=1 export then done ${HOME} 2>/dev/null --verbose local $(pwd)
+	'quoted text' cd 'quoted text' /usr/bin sed readonly awk $(pwd) cd export export
+${HOME} then cd ${HOME} -eu awk test
+	--verbose 'quoted text' /usr/bin grep grep "$@" local
+	/usr/bin && && -eu -eu && && ${HOME}
+	/usr/bin && awk /usr/bin
+${HOME} $(pwd) done $(pwd) 'quoted text' --verbose readonly |
+/usr/bin ${HOME} && --verbose
+	test ${HOME} 'quoted text' x=1 | cd local $(pwd) then 'quoted text'
+	local readonly 2>/dev/null done cd sed | test 'quoted text' x=1 readonly
+		| readonly readonly -eu -eu done
+&& "$@" 'quoted text' awk -eu
+	readonly grep echo test echo
+	echo sed -eu cd && awk $(pwd) "$1" 'quoted text' printf x=1
+		done done cd printf sed
+--verbose awk 'quoted text' printf local sed -eu echo cd
+		x=1 $(pwd) test 'quoted text'
+		grep awk 2>/dev/null cd then local "$1" echo | && /usr/bin 2>/dev/null
+	2>/dev/null /usr/bin "$@" awk local grep -eu export x=1 test 2>/dev/null
+	cd grep 'quoted text'
+		readonly -eu -eu sed sed local /usr/bin awk cd sed readonly "$1" 2>/dev/null
+echo $(pwd) "$@" test /usr/bin x=1 local "$1" readonly
+grep readonly readonly | x=1 sed -eu "$1" 'quoted text' export sed
+--verbose 2>/dev/null awk echo x=1 done 'quoted text'
+awk 2>/dev/null local then local grep
+	test readonly 'quoted text' -eu
+export then readonly readonly
+		x=1 test grep echo export local "$1"
+		printf ${HOME} | -eu x=1 grep "$@"
+--verbose local x=1 awk export
+cd "$1" --verbose x=1 printf -eu 'quoted text' echo done export /usr/bin echo
+	-eu && /usr/bin --verbose --verbose
+	then sed then test then && cd ${HOME} readonly sed
+		'quoted text' && "$1" grep
+		2>/dev/null x=1 | && done
+	local 2>/dev/null 2>/dev/null printf done local /usr/bin echo --verbose
+	"$1" 'quoted text' ${HOME} "$@" --verbose 2>/dev/null local
+		test local cd 'quoted text'
+| "$1" sed ${HOME} grep test "$1"
+		cd done --verbose x=1 done && grep
+	2>/dev/null "$@" "$1" grep grep x=1 local ${HOME} | --verbose 'quoted text'
+	sed | "$@" grep $(pwd) sed --verbose | --verbose ${HOME}
+		$(pwd) grep grep sed test sed 2>/dev/null
+	-eu printf test sed grep && | -eu echo ${HOME} awk cd echo "$@" sed
+	"$1" "$@" -eu awk --verbose
+${HOME} awk grep printf "$1" ${HOME} --verbose export
+	"$1" grep "$@" echo 2>/dev/null
+		echo /usr/bin && $(pwd)
+	sed "$@" | "$@" printf
+	"$1" echo readonly "$1" done 'quoted text' echo printf 2>/dev/null done grep
+		sed --verbose echo then -eu sed ${HOME} -eu printf --verbose test sed cd export
+	| "$@" "$1" awk printf awk printf $(pwd) local grep "$@" then printf
+local awk cd "$@" "$@" test sed then --verbose && readonly local readonly
+		'quoted text' --verbose x=1 done local 'quoted text'
+		"$1" printf printf local done --verbose $(pwd) export 2>/dev/null
+${HOME} printf echo $(pwd) ${HOME} sed 'quoted text'
+${HOME} awk | grep echo awk $(pwd) export cd grep then echo echo
+	'quoted text' echo $(pwd) echo 'quoted text'
+2>/dev/null cd cd $(pwd)
+cd awk 'quoted text' 'quoted text'
+sed --verbose awk awk sed "$@" sed -eu test grep readonly cd awk then
+		"$@" printf readonly x=1 $(pwd) awk x=1 "$1" -eu done export grep
+	"$@" printf then $(pwd) printf awk && cd | readonly
+		&& -eu | "$@" sed --verbose --verbose sed 2>/dev/null x=1 local --verbose grep local
+		'quoted text' cd --verbose 2>/dev/null -eu echo export awk x=1 ${HOME}
+	-eu then && --verbose "$@" grep echo -eu cd then
+		echo grep printf "$@" readonly
+	2>/dev/null done "$1" x=1 -eu readonly readonly | $(pwd) echo
+		| 'quoted text' "$@" printf echo
+	readonly local $(pwd) cd "$1" grep grep readonly
+cd /usr/bin $(pwd) --verbose then grep && then readonly readonly ${HOME}
+cd x=1 ${HOME} "$1" cd cd
+	grep $(pwd) -eu readonly
+		'quoted text' /usr/bin "$1" test 2>/dev/null
+	/usr/bin /usr/bin printf readonly && /usr/bin test "$1"
+then cd readonly 2>/dev/null then "$@" --verbose "$@"
+		test /usr/bin $(pwd) done awk sed --verbose done "$@" x=1 $(pwd) $(pwd)
+	"$@" sed printf 2>/dev/null sed readonly sed --verbose sed printf
+	"$1" --verbose readonly done export /usr/bin done
+sed $(pwd) && | | | readonly /usr/bin 'quoted text'
+then echo 'quoted text'
+2>/dev/null done /usr/bin grep
+-eu awk export 'quoted text' 'quoted text' /usr/bin echo local
+$(pwd) readonly x=1 2>/dev/null "$@" --verbose /usr/bin export ${HOME} sed x=1
+x=1 export -eu && sed | /usr/bin echo x=1 done && "$1" grep done cd
+	"$1" --verbose test 2>/dev/null -eu $(pwd) printf done export &&
+	awk | grep test ${HOME} --verbose printf $(pwd)
+		x=1 x=1 2>/dev/null $(pwd) done && printf ${HOME} readonly
+	echo cd sed local /usr/bin echo cd | readonly then && 2>/dev/null
+export $(pwd) 'quoted text'
+		export test /usr/bin export
+	"$1" -eu ${HOME} cd local
+printf --verbose x=1 cd --verbose
+		grep local test export && sed | echo sed "$@" awk
+	test done && -eu then "$@" "$1"
+	awk && grep grep grep echo cd readonly ${HOME}
+		/usr/bin ${HOME} && ${HOME} done 'quoted text' then echo cd -eu readonly export
+	| echo cd awk sed grep awk done ${HOME} "$1" ${HOME}
+echo 2>/dev/null x=1 grep printf "$1" "$@" awk x=1 'quoted text' x=1 readonly
+	test sed && | x=1 ${HOME} printf test |
+cd -eu local test $(pwd) then --verbose readonly
+x=1 "$@" 2>/dev/null /usr/bin $(pwd)
+done cd export test done grep readonly
+&& 2>/dev/null $(pwd) awk 2>/dev/null --verbose 2>/dev/null
+	/usr/bin && | && -eu ${HOME} "$1" --verbose awk 'quoted text' "$@" cd x=1 sed --verbose
+	test | test readonly printf && "$1" test && then "$1" then
+grep echo -eu awk local readonly
+		-eu --verbose ${HOME} --verbose
+		then awk ${HOME} done 'quoted text'
+		"$@" 'quoted text' "$@" local
+${HOME} grep test --verbose export readonly -eu echo "$@" local then "$1" /usr/bin
+		grep && then -eu grep sed local
+		readonly x=1 grep local grep sed
+export sed done awk echo x=1
+		echo then printf test $(pwd) printf ${HOME} cd then export
+x=1 sed "$1" printf && echo
+echo sed cd | -eu echo sed readonly x=1 readonly
+	x=1 done 2>/dev/null 2>/dev/null "$1"
+	done "$1" done && done x=1 cd export
+	"$@" readonly -eu export local export echo local test sed --verbose "$@" --verbose
+"$1" sed | echo local local ${HOME} ${HOME} "$@" sed x=1 ${HOME} then
+local grep /usr/bin "$1" $(pwd) /usr/bin /usr/bin readonly printf
+		cd export local awk && then x=1 x=1 ${HOME} grep
+		| test && export 2>/dev/null 2>/dev/null readonly done readonly echo export
+		test /usr/bin "$1" awk then ${HOME} printf
+		export -eu printf && ${HOME} cd grep local
+		${HOME} --verbose readonly $(pwd) --verbose test sed local
+		&& readonly then | 'quoted text' grep x=1 'quoted text'
+	$(pwd) | $(pwd) $(pwd) export 'quoted text' ${HOME} $(pwd)
+		${HOME} echo export "$@" ${HOME} awk test done
+		sed 'quoted text' 'quoted text' && /usr/bin readonly --verbose
+	echo 'quoted text' --verbose $(pwd) x=1 | --verbose test sed awk awk
+	done /usr/bin sed cd 'quoted text' readonly sed ${HOME} printf then
+readonly "$@" --verbose -eu local x=1 -eu --verbose
+	export -eu x=1 "$1" /usr/bin grep 2>/dev/null x=1 ${HOME}
+	${HOME} --verbose -eu then
+readonly -eu echo "$1" && local -eu awk "$1" local && then
+		local echo local export echo --verbose grep export && printf test
+	x=1 printf readonly -eu local export local test cd local /usr/bin
+	grep done then "$1" 'quoted text' then export --verbose
+	awk "$@" | -eu awk 2>/dev/null && cd grep echo then export
+		"$1" grep grep -eu done
+		&& test 'quoted text' -eu x=1 x=1 cd test
+		"$1" test --verbose test readonly && 'quoted text' printf 2>/dev/null
+	sed echo | grep 2>/dev/null $(pwd) export grep -eu "$@" awk "$1" awk awk
+	$(pwd) sed sed readonly
+then && sed && $(pwd) --verbose readonly "$@" export sed /usr/bin sed
+	"$1" done cd 'quoted text' export 'quoted text'
+	echo 'quoted text' /usr/bin awk awk grep
+awk sed --verbose export /usr/bin echo cd
+		then "$@" "$1" export 'quoted text'
+		echo && 2>/dev/null sed "$@" local export done -eu --verbose
+		done -eu 'quoted text' then 2>/dev/null export awk awk
+	then -eu local cd --verbose grep x=1 then cd local then -eu printf
+	$(pwd) grep printf "$@" done
+	awk local x=1 /usr/bin export --verbose $(pwd) | | then ${HOME}
+--verbose export done export echo grep done "$@" $(pwd) | echo printf "$@"
+grep done then sed ${HOME}
+	readonly export "$1" test export /usr/bin 2>/dev/null "$@" x=1
+'quoted text' /usr/bin -eu -eu --verbose --verbose test
+		"$1" then /usr/bin grep cd ${HOME} && && grep
+2>/dev/null 2>/dev/null readonly && x=1 local export
+--verbose printf grep export /usr/bin
+		| x=1 "$@" awk sed 'quoted text' then awk "$@" && /usr/bin && $(pwd)
+"$1" && && grep local local ${HOME} && grep then -eu x=1 /usr/bin cd -eu
+	"$@" cd && cd readonly grep x=1
+&& 'quoted text' readonly then readonly awk 2>/dev/null
+	export ${HOME} local test 2>/dev/null printf 'quoted text'
+&& grep --verbose --verbose grep export readonly
+printf | done printf 2>/dev/null
+		${HOME} x=1 && printf && ${HOME}
+2>/dev/null readonly x=1 cd done | ${HOME} done /usr/bin
+	done 'quoted text' echo $(pwd) 2>/dev/null | | /usr/bin test x=1 --verbose awk
+	--verbose /usr/bin $(pwd)
+		$(pwd) readonly $(pwd) readonly grep ${HOME} test done /usr/bin --verbose
+		${HOME} "$@" /usr/bin grep readonly
+	$(pwd) 'quoted text' readonly 'quoted text' grep
+"$1" test cd "$1" /usr/bin cd "$1" printf
+test "$@" done x=1 printf export x=1 readonly 'quoted text' grep x=1 /usr/bin
+		| done | /usr/bin echo
+		sed readonly cd done then cd "$@" local | "$1"
+		done sed | /usr/bin local test -eu done cd "$@" /usr/bin local 'quoted text'
+	| export ${HOME} done echo $(pwd) export /usr/bin cd test | export ${HOME}
+		&& ${HOME} && $(pwd) 2>/dev/null done x=1 /usr/bin 'quoted text' 'quoted text'
+/usr/bin "$@" done /usr/bin printf $(pwd) --verbose echo 'quoted text' && x=1
+x=1 sed local | ${HOME} && && ${HOME} cd $(pwd) -eu
+	$(pwd) done $(pwd) cd done sed 'quoted text'
+local x=1 x=1 -eu $(pwd) -eu test
+sed awk $(pwd) local grep x=1 test && done sed test local --verbose
+		grep "$1" test "$@" local --verbose echo test printf
+/usr/bin | awk /usr/bin local 'quoted text'
+	cd | -eu | test "$1" | awk $(pwd) "$@" awk $(pwd) grep sed cd && grep
+		sed test --verbose "$1" x=1 printf | test ${HOME} x=1 sed && 2>/dev/null x=1
+readonly x=1 $(pwd) echo awk cd | 2>/dev/null $(pwd)
+		cd sed readonly x=1 local
+export echo local cd readonly
+		2>/dev/null -eu printf
+		done "$@" x=1 awk -eu "$1" && local "$1" echo printf
+&& then echo local test "$1" echo $(pwd) export
+grep && --verbose "$@" "$@" local echo printf awk | x=1
+	2>/dev/null printf $(pwd) grep -eu done && test then cd "$@" echo echo
+		"$1" "$@" awk 2>/dev/null "$1"
+		then $(pwd) "$@" local then "$1" --verbose
+--verbose ${HOME} printf awk 2>/dev/null
+	| && sed sed $(pwd) -eu grep printf then
+grep echo printf && -eu export done /usr/bin
+		"$@" test 2>/dev/null x=1
+done readonly awk "$@"
+		2>/dev/null test "$@" 'quoted text' local test cd then awk ${HOME} x=1 awk
+	export printf --verbose "$1" 'quoted text' /usr/bin
+		2>/dev/null sed grep ${HOME} x=1 grep then local
+2>/dev/null grep && /usr/bin cd grep && | then | "$1" && --verbose
+		echo echo /usr/bin "$1" | echo $(pwd) ${HOME} x=1 --verbose
+		local printf "$@" export "$1" export awk then 'quoted text'
+		| && "$@" $(pwd) readonly 'quoted text' then then 2>/dev/null
+	'quoted text' printf local 'quoted text'
+		/usr/bin then && sed echo cd awk export
+	done | && echo sed then /usr/bin awk
+		test echo echo | awk awk
+	cd awk /usr/bin sed 2>/dev/null "$@" --verbose
+		test test --verbose sed test printf /usr/bin readonly ${HOME} x=1
+		"$@" cd 'quoted text' "$@" | -eu /usr/bin && | then x=1 ${HOME} printf ${HOME}
+		x=1 'quoted text' 'quoted text' readonly 2>/dev/null -eu local --verbose
+	printf x=1 ${HOME} 2>/dev/null then sed ${HOME} 2>/dev/null --verbose echo readonly
+		sed done -eu readonly
+x=1 local test | 2>/dev/null export then x=1 readonly readonly
+	2>/dev/null $(pwd) /usr/bin export --verbose "$1" $(pwd) readonly
+		readonly $(pwd) "$@" "$1" printf awk -eu $(pwd) x=1
+"$1" sed test 'quoted text' cd x=1 awk $(pwd)
+	test grep awk $(pwd) /usr/bin 'quoted text' /usr/bin
+	"$1" printf -eu --verbose "$@" export | 2>/dev/null | x=1 sed done cd readonly
+	${HOME} sed 2>/dev/null echo awk | $(pwd)
+		export | && printf --verbose --verbose grep readonly sed echo
+	x=1 printf "$@" 'quoted text' --verbose awk /usr/bin
+	readonly then 2>/dev/null "$1" x=1 printf
+	printf "$1" readonly done local
+--verbose 2>/dev/null readonly cd grep | awk grep x=1 cd done
+	--verbose cd readonly $(pwd) echo test
+		echo x=1 awk done "$1" x=1 | 2>/dev/null grep then $(pwd) /usr/bin "$1"
+		${HOME} awk x=1 ${HOME} x=1 x=1 --verbose -eu
+		--verbose echo /usr/bin then
+	"$@" --verbose readonly grep sed awk sed --verbose sed
+#include c86.sh
+| export -eu test $(pwd) 'quoted text' printf then -eu | --verbose
+'quoted text' && awk ${HOME} grep /usr/bin
+	grep test then export && grep grep echo awk export /usr/bin 'quoted text'
+		awk && && x=1 2>/dev/null echo x=1 -eu done "$@" "$@"
+		x=1 done 2>/dev/null $(pwd) --verbose readonly /usr/bin ${HOME}
+		then local "$@" grep "$@" --verbose $(pwd)
+awk sed "$@" readonly sed x=1 grep grep test | readonly export "$1" x=1 sed
+"$@" 2>/dev/null /usr/bin | /usr/bin /usr/bin local test grep && done sed awk
+		${HOME} sed cd 2>/dev/null grep ${HOME} /usr/bin ${HOME}
+	x=1 --verbose "$@" 2>/dev/null | |
+	echo readonly export /usr/bin test --verbose -eu -eu x=1 done readonly cd --verbose
+--verbose awk x=1 readonly export cd "$1" --verbose
+	then && -eu export /usr/bin ${HOME} awk awk /usr/bin
+		${HOME} sed --verbose $(pwd) export 2>/dev/null
+	done done readonly awk 'quoted text' 2>/dev/null x=1 printf readonly "$@"
+		2>/dev/null | echo /usr/bin $(pwd) awk x=1 $(pwd) echo
+"$1" x=1 done "$@" -eu "$1" --verbose readonly x=1 test x=1 --verbose export
+		2>/dev/null awk then && "$@" --verbose local test x=1 | cd && test export readonly
+export awk /usr/bin ${HOME} test printf printf local
+	echo 'quoted text' grep test local
+	sed then /usr/bin awk ${HOME} awk then $(pwd)
+		2>/dev/null then /usr/bin x=1 ${HOME} "$1" readonly awk 2>/dev/null
+	${HOME} "$1" done readonly 'quoted text' readonly
+		cd "$1" done export 2>/dev/null grep export
+	'quoted text' && 2>/dev/null
+${HOME} readonly "$@" --verbose "$1" "$@"
+&& test done | -eu cd printf export x=1 export | export sed cd 'quoted text'
+		/usr/bin awk grep --verbose && /usr/bin then
+$(pwd) x=1 awk readonly printf 'quoted text' then --verbose && sed x=1 sed printf
+	echo then ${HOME} grep --verbose sed 2>/dev/null -eu test "$1"
+		/usr/bin export readonly 'quoted text' then $(pwd) cd $(pwd) $(pwd) done grep
+		echo grep test sed x=1 --verbose 2>/dev/null
+sed then "$1" cd "$1" test "$1" sed cd local sed 2>/dev/null then ${HOME} echo |
+	| export ${HOME} printf "$@"
+done 'quoted text' export awk && 'quoted text'
+2>/dev/null "$1" awk "$1" then -eu "$1" | then printf sed then test
+	readonly export "$@" "$@" readonly 2>/dev/null awk
+	/usr/bin ${HOME} local $(pwd) done export "$1" readonly awk 'quoted text' readonly
+"$@" awk sed export $(pwd) --verbose export /usr/bin -eu awk printf sed
+		printf cd echo && /usr/bin awk done printf "$1" -eu awk 'quoted text' "$1"
+		/usr/bin "$1" printf printf $(pwd) ${HOME} && -eu local 2>/dev/null readonly
+	done $(pwd) then local cd -eu done -eu
+-eu done "$@" ${HOME} printf test ${HOME} printf $(pwd) 2>/dev/null $(pwd) ${HOME}
+"$1" readonly sed echo readonly done sed x=1
+	&& sed readonly test readonly "$1" $(pwd) readonly
+		$(pwd) sed awk echo && grep printf 'quoted text' sed grep
+		awk ${HOME} "$@" cd --verbose | cd /usr/bin
+"$1" readonly x=1 echo then ${HOME} local x=1 2>/dev/null local cd echo
+awk x=1 -eu printf export printf cd printf &&
+		sed ${HOME} cd -eu readonly "$1" | export readonly $(pwd) echo "$1" 2>/dev/null
+	$(pwd) echo x=1 | grep grep local done cd printf "$@" /usr/bin
+		grep awk export /usr/bin --verbose
+/usr/bin cd -eu ${HOME} readonly x=1 cd done
+	2>/dev/null "$@" readonly -eu /usr/bin printf | "$1" test local -eu grep printf
+done awk done printf export test
+echo printf $(pwd) awk 'quoted text'
+echo 2>/dev/null x=1 'quoted text' export sed local
+cd "$@" --verbose test cd readonly
+2>/dev/null -eu "$1" local export printf x=1 2>/dev/null "$1" && |
+		local readonly 'quoted text' $(pwd) awk test "$1"
+		$(pwd) && grep $(pwd) then && awk done /usr/bin
+	"$1" x=1 grep echo x=1 | cd "$@" then
+		echo 2>/dev/null && --verbose -eu printf && printf test
+	"$@" printf 2>/dev/null "$1" 'quoted text' ${HOME} 2>/dev/null
+	"$1" /usr/bin "$1" ${HOME} "$@"
+echo sed $(pwd) x=1 printf -eu cd ${HOME} --verbose
+test printf 2>/dev/null awk "$@" printf test x=1 "$@" awk 'quoted text' awk test
+		&& local local ${HOME} printf --verbose x=1 "$1" && printf ${HOME} ${HOME} awk
+2>/dev/null | | readonly 2>/dev/null
+--verbose /usr/bin then cd /usr/bin sed printf cd 2>/dev/null
+/usr/bin export test 2>/dev/null $(pwd) $(pwd) x=1 then echo echo
+		cd done && grep | local test then awk readonly /usr/bin 'quoted text'
+test "$1" local $(pwd) | | printf x=1 test x=1 $(pwd) cd x=1 $(pwd) 2>/dev/null
+grep "$@" /usr/bin -eu /usr/bin 'quoted text' export done $(pwd) export /usr/bin
+cd 'quoted text' printf 2>/dev/null readonly
+	export && test "$@" local $(pwd) grep
+${HOME} echo ${HOME} grep done $(pwd)
+awk | --verbose echo printf done readonly | x=1 printf | $(pwd) /usr/bin
+sed "$@" && test $(pwd) | /usr/bin local
+		"$1" "$@" 2>/dev/null 'quoted text' /usr/bin readonly done
+$(pwd) grep | -eu x=1 done $(pwd) echo export sed x=1
+		echo grep readonly 2>/dev/null 'quoted text' export cd
+	awk done done ${HOME} && ${HOME} local && ${HOME} printf
+		grep "$1" "$@" printf then printf && -eu x=1 && 2>/dev/null /usr/bin
+test | $(pwd) then 'quoted text' then cd readonly "$1" awk echo "$1" sed echo
+	&& then done sed "$@" "$@"
+&& x=1 export grep --verbose cd readonly 'quoted text'
+	x=1 cd test x=1 'quoted text' readonly --verbose && "$@" 'quoted text'
+	&& -eu echo printf cd grep --verbose 2>/dev/null | /usr/bin
+cd --verbose x=1 | grep $(pwd) grep grep sed printf | test echo export x=1
+		cd 2>/dev/null ${HOME}
+	printf cd test readonly
+	'quoted text' --verbose readonly $(pwd) readonly 2>/dev/null | then echo done
+		readonly test 2>/dev/null 'quoted text' echo 2>/dev/null done 'quoted text'
+		'quoted text' test readonly --verbose export x=1 /usr/bin awk done readonly
+cd then then export /usr/bin $(pwd) local readonly |
+--verbose then echo then printf
+	'quoted text' awk 'quoted text' done test && x=1 $(pwd) then
+echo cd 2>/dev/null 'quoted text'
+	export && && x=1 readonly --verbose "$1" printf then | local
+		printf readonly then echo ${HOME} then && awk -eu readonly local
+"$1" grep echo local x=1 2>/dev/null grep test then readonly
+	x=1 echo grep --verbose |
+		'quoted text' 2>/dev/null --verbose
+	awk /usr/bin test grep test awk cd x=1 local --verbose "$@"
+readonly $(pwd) "$1" /usr/bin printf ${HOME} grep /usr/bin then
+	${HOME} && ${HOME} -eu ${HOME} readonly -eu
+		'quoted text' -eu printf sed cd "$1"
+		&& then ${HOME} 'quoted text' cd export echo /usr/bin
+	sed "$1" readonly $(pwd) export echo | ${HOME} 'quoted text' cd
+	awk awk sed | /usr/bin -eu export 2>/dev/null |
+$(pwd) echo 2>/dev/null echo -eu echo "$@" "$1" x=1 2>/dev/null
+test "$1" export | grep readonly then && 2>/dev/null
+	| --verbose sed echo 'quoted text'
+		&& ${HOME} then ${HOME} /usr/bin
+		--verbose 2>/dev/null -eu 'quoted text'
+	sed -eu -eu echo done $(pwd) 2>/dev/null cd "$1" sed
+	cd 'quoted text' done 'quoted text' && then -eu "$1" readonly cd awk then x=1
+	'quoted text' awk "$1" printf done &&
+export then && | 2>/dev/null
+	local test && sed "$@" local
+		--verbose grep "$@" awk | then grep cd && cd sed --verbose
+	-eu printf "$1" export 2>/dev/null x=1 readonly
+	$(pwd) echo awk then echo 2>/dev/null
+		readonly then then "$1" sed x=1 "$@" "$1" test local awk && 2>/dev/null
+${HOME} readonly "$@" done "$1" readonly 'quoted text'
+		${HOME} $(pwd) -eu test local sed cd echo -eu /usr/bin -eu printf | local /usr/bin
+	| local /usr/bin 'quoted text' echo "$@" printf echo x=1 ${HOME} awk echo
+		printf readonly echo ${HOME} cd awk printf export x=1 sed cd x=1 test test
+${HOME} then 'quoted text' readonly done $(pwd) test export local test then awk
+	'quoted text' --verbose grep echo
+	&& printf 2>/dev/null done 2>/dev/null -eu awk done echo
+		/usr/bin 'quoted text' done /usr/bin ${HOME} $(pwd) printf sed x=1 x=1 "$@" -eu
+		sed awk local --verbose awk printf --verbose then grep "$@"
+readonly x=1 printf export local grep 'quoted text'
+${HOME} $(pwd) local 2>/dev/null then -eu sed x=1 grep ${HOME}
+		x=1 cd then --verbose |
+		export test | x=1 "$1" awk cd x=1 x=1 done then
+		${HOME} | $(pwd) x=1 then export
+export grep x=1 $(pwd) cd export --verbose local then $(pwd) | -eu /usr/bin
+	awk --verbose readonly readonly readonly x=1 "$@" export then
+test readonly readonly echo | cd echo printf sed | ${HOME}
+		printf cd grep x=1 "$@" awk sed -eu -eu echo
+	local x=1 x=1 /usr/bin echo
+	--verbose --verbose awk cd 2>/dev/null grep "$1"
+$(pwd) awk local export grep readonly grep grep done
+export x=1 readonly test | $(pwd) 2>/dev/null
+printf printf export 'quoted text'
+	cd | cd "$1" "$@" echo
+	$(pwd) echo readonly cd export 'quoted text' x=1 grep echo && readonly
+local ${HOME} "$@" | echo awk readonly x=1 grep grep cd && test cd done
+"$1" done awk ${HOME} "$@" done awk $(pwd) x=1 2>/dev/null
+echo done && echo local local export sed test
+	--verbose ${HOME} | then /usr/bin $(pwd)
+then -eu echo 'quoted text' $(pwd) then test | "$@" "$1" echo then $(pwd) "$1"
+		then | --verbose grep readonly done $(pwd) "$1" 2>/dev/null export test done --verbose
+--verbose cd readonly local then readonly readonly
+		'quoted text' grep 'quoted text' export awk then cd
+	x=1 cd "$@" cd && echo $(pwd) && /usr/bin echo $(pwd)
+		done /usr/bin awk local sed /usr/bin export $(pwd)
+		test "$@" test done && /usr/bin 'quoted text' "$1" awk "$@" && "$1"
+export 2>/dev/null /usr/bin /usr/bin | export
+x=1 local then readonly export "$1" echo test /usr/bin printf cd export sed
+'quoted text' && echo | readonly ${HOME} done
+		| test /usr/bin 'quoted text' sed x=1 'quoted text' 'quoted text' cd && ${HOME}
+done grep --verbose "$@"
+	"$1" then "$@" local "$1" | cd echo echo
+		then grep --verbose test
+export ${HOME} 2>/dev/null export --verbose
+		"$1" echo sed $(pwd) awk awk readonly x=1 --verbose -eu -eu
+'quoted text' 2>/dev/null "$1" | 'quoted text' && --verbose
+| --verbose -eu ${HOME} 2>/dev/null
+--verbose readonly done printf 2>/dev/null -eu $(pwd) awk x=1 "$@" test done sed
+	/usr/bin 'quoted text' ${HOME} test done && awk x=1 then
+		2>/dev/null ${HOME} "$@" /usr/bin --verbose echo /usr/bin echo echo
+		${HOME} x=1 then then test cd local ${HOME} "$@" test printf readonly "$1" | awk
+		cd "$@" then -eu printf "$@" printf --verbose
+export | sed readonly echo cd printf
+		"$@" 2>/dev/null local 2>/dev/null && && printf
+2>/dev/null ${HOME} done $(pwd) readonly $(pwd) sed printf printf
+		export && && echo x=1 "$@" readonly ${HOME}
+	echo awk cd test cd "$@" readonly 'quoted text' printf "$1" -eu && awk ${HOME}
+--verbose | x=1 sed -eu printf x=1 awk test x=1 -eu export cd ${HOME}
+		local ${HOME} 'quoted text' done sed ${HOME}
+	awk "$1" --verbose "$1" printf sed 2>/dev/null /usr/bin /usr/bin
+	then awk test local then | test /usr/bin done -eu /usr/bin -eu "$1" done export
+| echo $(pwd) | --verbose -eu
+2>/dev/null done x=1 test cd && | "$@" -eu --verbose local test
+	-eu "$@" ${HOME} echo sed then ${HOME} /usr/bin echo x=1 -eu /usr/bin
+	sed "$1" printf grep echo grep "$1" /usr/bin
+		done grep echo | done grep cd 2>/dev/null then x=1 /usr/bin --verbose
+&& grep then "$@" cd echo | "$1" ${HOME} export grep grep grep test /usr/bin
+	local local /usr/bin 'quoted text' grep export --verbose
+	sed printf readonly cd --verbose readonly
+printf "$1" 'quoted text' awk --verbose then local cd readonly
+$(pwd) "$1" && cd then | readonly --verbose "$@" ${HOME}
+		"$@" test "$1" "$1" export grep test |
+		-eu --verbose $(pwd) --verbose
+	${HOME} | "$1" ${HOME} cd local cd && readonly
+	/usr/bin /usr/bin awk cd then /usr/bin cd sed -eu 2>/dev/null
+		2>/dev/null sed printf done "$@"
+	--verbose /usr/bin local test grep
+&& 'quoted text' readonly
+	then awk grep cd done sed awk ${HOME} then sed readonly sed sed x=1
+then x=1 sed echo && test readonly awk cd 'quoted text' 'quoted text' echo
+	echo -eu test $(pwd) --verbose sed then then grep awk && sed "$@" local
+${HOME} grep 'quoted text' | local local export then
+	readonly readonly /usr/bin 2>/dev/null ${HOME} "$1" --verbose 2>/dev/null
+sed printf awk cd /usr/bin 'quoted text' echo "$@" "$1" | $(pwd) then then $(pwd)
+	--verbose | --verbose -eu && $(pwd) --verbose $(pwd)
+| x=1 readonly --verbose x=1
+	-eu 2>/dev/null readonly x=1 "$@" -eu | --verbose
+	2>/dev/null 2>/dev/null x=1
+	/usr/bin 'quoted text' then grep cd /usr/bin -eu test
+		-eu sed awk then --verbose
+| echo grep local x=1 /usr/bin then && grep printf |
+"$1" printf "$1" echo cd $(pwd)
+		printf -eu $(pwd) done /usr/bin sed sed /usr/bin then | test readonly 'quoted text'
+		test export "$1" "$@" printf export 'quoted text' /usr/bin test
+	--verbose sed sed export local
+readonly echo readonly test export | 'quoted text' "$@" && $(pwd) local test
+2>/dev/null export cd done ${HOME} export 2>/dev/null
+		local 'quoted text' done /usr/bin 'quoted text'
+printf sed printf local 'quoted text' "$1" then
+export && done test awk --verbose /usr/bin && 2>/dev/null && /usr/bin
+	x=1 ${HOME} 2>/dev/null
+		$(pwd) x=1 test local
+	"$1" then | x=1 readonly ${HOME}
+		readonly ${HOME} ${HOME} export x=1
+		local done awk $(pwd) awk --verbose test local && "$@" local "$1" readonly
+	readonly "$1" then ${HOME} sed /usr/bin
+	sed x=1 test printf -eu cd ${HOME} "$1" /usr/bin /usr/bin --verbose printf
+${HOME} && $(pwd) 2>/dev/null "$@" "$@" ${HOME}
+2>/dev/null /usr/bin grep $(pwd) grep export sed x=1 2>/dev/null readonly
+	${HOME} --verbose done 'quoted text' -eu
+	done $(pwd) /usr/bin x=1 export local
+	printf grep grep test /usr/bin export -eu readonly x=1 $(pwd)
+	'quoted text' "$1" && -eu /usr/bin x=1 cd then then test /usr/bin | export cd test
+	'quoted text' grep && --verbose readonly
+		export readonly ${HOME} -eu $(pwd) test sed /usr/bin --verbose -eu cd grep -eu &&
+	readonly "$1" ${HOME} echo "$@" "$@" test
+		--verbose "$1" x=1 readonly
+--verbose test sed echo export x=1 $(pwd) --verbose
+	/usr/bin echo && awk readonly
+	${HOME} "$@" sed 2>/dev/null readonly | grep | --verbose readonly
+		awk local then $(pwd) readonly
+	test $(pwd) --verbose done printf grep x=1 awk sed ${HOME}
+	"$@" --verbose x=1 | /usr/bin readonly "$@"
+		'quoted text' local /usr/bin
+readonly test test awk && --verbose sed 'quoted text'
+	"$@" "$@" sed ${HOME} awk ${HOME} | "$@" x=1 "$@" printf -eu -eu grep
+| -eu 2>/dev/null echo test 'quoted text'
+		test test export /usr/bin grep --verbose done awk cd --verbose
+	local readonly done then printf 2>/dev/null
+	| -eu awk "$1" "$@" done grep $(pwd)
+local cd grep awk /usr/bin "$1" 'quoted text' awk test x=1 x=1 awk then "$@"
+	&& done export test ${HOME} "$1" ${HOME} 2>/dev/null then && -eu
+cd | echo | echo then "$@" "$@" | $(pwd) readonly $(pwd) readonly
+		grep ${HOME} --verbose | awk
+	done echo export cd | echo
+	local local readonly "$1" "$1" done "$@" | ${HOME} 'quoted text'
+	test 2>/dev/null | ${HOME} "$@" test echo test
+		$(pwd) cd awk then --verbose export ${HOME}
+	done export local 2>/dev/null
+	awk ${HOME} export cd | cd awk | grep 2>/dev/null
+	| grep $(pwd) local x=1 local
+	test --verbose export "$@" "$@" grep export cd cd 2>/dev/null x=1 ${HOME} then
+--verbose "$@" printf cd x=1 'quoted text' grep grep 'quoted text' --verbose
+		printf 'quoted text' | -eu --verbose "$1"
+	x=1 export export -eu 2>/dev/null readonly sed x=1 printf echo done
+then echo && awk readonly $(pwd) test -eu ${HOME} && "$@"
+&& 'quoted text' local local test $(pwd) then "$1"
+local -eu --verbose sed
+grep && | 'quoted text' -eu && /usr/bin 2>/dev/null
+		local awk cd printf x=1
+		printf | sed --verbose && grep
+	test /usr/bin $(pwd) --verbose --verbose
+2>/dev/null test echo export echo test export
+		"$1" && then readonly /usr/bin
+	cd --verbose readonly "$@" test
+	sed done 'quoted text' 'quoted text'
+		x=1 "$1" -eu cd 2>/dev/null then -eu test sed 'quoted text' then $(pwd) "$@"
+done echo 'quoted text' export sed x=1
+$(pwd) "$@" awk test 2>/dev/null 2>/dev/null
+		'quoted text' -eu -eu grep "$1" 'quoted text' && --verbose
+	awk awk "$@" 2>/dev/null test local grep x=1 test &&
+export -eu export $(pwd) export export "$@" cd echo awk export
+		| local 2>/dev/null 2>/dev/null cd x=1 awk export
+	then 'quoted text' cd
+		awk cd test $(pwd) export printf -eu 2>/dev/null
+		grep x=1 printf test ${HOME} awk done grep export 2>/dev/null
+"$1" | /usr/bin "$1" echo 'quoted text' ${HOME} && then cd cd
+		&& 'quoted text' | cd /usr/bin sed && then test |
+	$(pwd) sed /usr/bin | test export ${HOME} -eu 'quoted text' readonly printf 2>/dev/null
+"$1" readonly grep -eu awk export printf /usr/bin done readonly done
+		echo "$1" "$@" "$@" $(pwd) 'quoted text' 'quoted text' --verbose
+	test | x=1 ${HOME} --verbose
+	awk ${HOME} && ${HOME} test $(pwd) sed x=1 x=1 done x=1 'quoted text' 'quoted text'
+	&& -eu done cd readonly
+	done then x=1 ${HOME} -eu ${HOME} x=1
+local | grep local cd ${HOME} cd "$1" echo $(pwd) 'quoted text'
+	${HOME} -eu 2>/dev/null printf
+	$(pwd) sed done 2>/dev/null ${HOME} export echo ${HOME} echo /usr/bin 2>/dev/null
+-eu sed export | grep 2>/dev/null 2>/dev/null echo test ${HOME}
+	&& "$1" -eu printf | printf "$@" $(pwd) "$1"
+		/usr/bin readonly $(pwd) && x=1 echo sed grep -eu awk grep local 'quoted text'
+		-eu --verbose grep 2>/dev/null
+	test -eu readonly /usr/bin export sed -eu
+'quoted text' echo "$@" x=1 grep then awk ${HOME} readonly done printf "$@"
+		"$@" && /usr/bin sed 'quoted text' 2>/dev/null /usr/bin | --verbose
+$(pwd) --verbose | grep echo done printf sed awk "$@" grep
+		sed local cd local $(pwd) sed "$1" && local
+		printf x=1 done sed "$1" "$1" printf "$@" $(pwd) sed ${HOME} /usr/bin
+	printf cd $(pwd) "$@" cd "$@" /usr/bin -eu sed sed | && echo local 'quoted text'
+	sed cd $(pwd) -eu /usr/bin 'quoted text' x=1
+		done 'quoted text' echo awk 2>/dev/null 'quoted text' ${HOME} 'quoted text'
+'quoted text' printf export /usr/bin
+	&& awk awk awk then export test sed grep
+		then printf then -eu && --verbose
+	--verbose $(pwd) --verbose /usr/bin && $(pwd)
+	awk cd export --verbose export echo "$@" test done /usr/bin cd "$@"
+	printf grep x=1 2>/dev/null -eu --verbose "$@" grep sed printf readonly
+		x=1 && sed 'quoted text' export && printf echo /usr/bin
+		/usr/bin printf done 'quoted text' /usr/bin "$1"
+	readonly -eu x=1 awk x=1 -eu readonly
+then export local awk /usr/bin local cd local 2>/dev/null cd | x=1 'quoted text'
+	grep printf echo export printf awk /usr/bin readonly done done "$@" cd ${HOME}
+	&& "$1" sed export local then cd "$@" 2>/dev/null
+export echo --verbose printf then | readonly
+		$(pwd) sed --verbose 2>/dev/null then done -eu 'quoted text'
+		awk grep readonly ${HOME} then then then && /usr/bin sed "$1" readonly local
+sed /usr/bin 2>/dev/null done |
+	export --verbose awk | "$1" | && x=1 x=1 'quoted text' echo export | cd "$@"
+local sed then -eu | | then printf export
+	'quoted text' -eu then /usr/bin 'quoted text' then local local --verbose printf
+	&& done ${HOME} /usr/bin ${HOME} 2>/dev/null && $(pwd) test
+		--verbose sed && "$@" awk readonly "$1" done readonly -eu grep 'quoted text'
+		readonly /usr/bin export grep && done
+	readonly && && test printf echo then printf readonly /usr/bin cd
+grep x=1 /usr/bin --verbose /usr/bin -eu cd grep
+grep sed x=1 export local -eu --verbose
+		cd export "$@" | $(pwd) grep
+		--verbose -eu ${HOME} awk "$@"
+		&& sed cd then echo done test export echo done 'quoted text'
+	test ${HOME} test ${HOME} test "$1"
+		test readonly -eu "$@" $(pwd) awk
+		echo done local 'quoted text'
+		-eu test ${HOME} | "$@"
+${HOME} /usr/bin grep done test "$1" export printf x=1 "$1"
+2>/dev/null "$@" $(pwd) printf export
+done 2>/dev/null cd cd /usr/bin printf
+test "$@" grep echo -eu grep /usr/bin test 2>/dev/null sed readonly
+	2>/dev/null && && --verbose && 'quoted text' grep && /usr/bin
+	test awk "$1" 2>/dev/null $(pwd) printf export ${HOME} ${HOME} && grep | && /usr/bin
+		2>/dev/null then --verbose "$@" 'quoted text' awk test 'quoted text'
+		sed local $(pwd) && test 'quoted text' --verbose sed then awk grep /usr/bin
+x=1 done $(pwd) && grep "$1" export test 2>/dev/null ${HOME} sed "$@" && "$@"
+		--verbose readonly $(pwd) "$@" echo printf
+cd x=1 2>/dev/null x=1
+	printf then --verbose --verbose grep echo -eu "$@" 2>/dev/null
+x=1 && && && 'quoted text' test /usr/bin && -eu done echo
+		sed --verbose --verbose sed done done x=1 local echo awk -eu "$@"
+printf $(pwd) awk local ${HOME} "$@" $(pwd) cd --verbose cd done
+"$1" --verbose local awk grep x=1 /usr/bin sed -eu export local then -eu
+	'quoted text' $(pwd) printf sed cd $(pwd) awk "$@" export test
+		--verbose export ${HOME} printf -eu then done then /usr/bin --verbose echo test
+		-eu "$1" --verbose awk && x=1 "$1" 2>/dev/null $(pwd)
+printf "$1" grep cd export
+	grep 2>/dev/null test printf x=1 && $(pwd)
+2>/dev/null local echo 'quoted text'
+	awk ${HOME} export --verbose readonly $(pwd)
+| local -eu -eu export cd grep export -eu $(pwd) test
+$(pwd) test sed done echo && && 'quoted text'
+readonly x=1 grep x=1 grep local "$@" export cd "$@" echo -eu /usr/bin local
+	$(pwd) 'quoted text' readonly
+/usr/bin 'quoted text' "$@" echo 2>/dev/null export && | | printf done 2>/dev/null
+	awk /usr/bin 'quoted text' ${HOME} done
+	readonly ${HOME} "$1" local $(pwd) "$@" | 'quoted text' | echo test
+		"$@" sed "$1" /usr/bin export "$@" export
+		test export echo cd $(pwd) | --verbose x=1 && done
+	sed 'quoted text' | $(pwd) -eu readonly printf
+		done ${HOME} export awk -eu echo printf
+	/usr/bin x=1 echo grep then export 'quoted text'
+	grep test awk "$1" readonly export awk "$@" x=1 "$1" /usr/bin
+	export done | x=1 awk readonly grep cd
+--verbose x=1 -eu /usr/bin $(pwd) printf /usr/bin done 2>/dev/null
+/usr/bin sed then readonly sed "$@" 2>/dev/null test done grep "$@"
+	| cd awk done sed awk
+readonly "$@" printf echo echo $(pwd) x=1 echo
+${HOME} then x=1 | cd | "$@" awk
+${HOME} | $(pwd) "$1" "$1" then --verbose awk x=1 cd ${HOME} -eu
+		cd "$@" awk done 2>/dev/null done ${HOME} "$1" export ${HOME} cd
+		| --verbose local echo printf | --verbose then then -eu grep sed x=1 sed export
+	cd grep --verbose x=1 'quoted text'
+	printf local echo done export x=1 echo "$@" x=1 | --verbose then 'quoted text'
+		grep local export "$@" | sed export x=1
+	| test then readonly local grep 'quoted text' sed 'quoted text' echo awk sed
+printf sed echo 2>/dev/null done sed echo done cd --verbose $(pwd)
+	2>/dev/null /usr/bin awk cd 2>/dev/null
+echo sed ${HOME} $(pwd) then 2>/dev/null
+then local local sed grep export sed "$1" /usr/bin test awk -eu ${HOME}
+		"$1" echo ${HOME} "$1" $(pwd) | "$@" ${HOME} local cd 'quoted text'
+		export readonly "$@" /usr/bin cd test readonly "$@"
+		cd readonly 'quoted text'
+	$(pwd) readonly --verbose "$1" "$@" /usr/bin cd local printf
+readonly "$@" test 'quoted text' ${HOME} echo
+	$(pwd) sed -eu 2>/dev/null readonly local -eu 'quoted text' test awk $(pwd) export
+	awk local awk ${HOME} ${HOME} test awk done --verbose echo x=1 cd export $(pwd)
+	--verbose done done readonly -eu -eu readonly then grep && echo | x=1 -eu
+	awk --verbose ${HOME} "$@" "$1" readonly && sed | grep
+readonly export export && export
+	x=1 then export /usr/bin test -eu printf x=1 readonly 'quoted text' echo "$1"
+	${HOME} 'quoted text' readonly "$1" /usr/bin local -eu
+$(pwd) "$1" ${HOME} done echo test 2>/dev/null $(pwd) done
+	"$1" "$1" "$@" "$@" x=1 ${HOME} 'quoted text' /usr/bin
+		then test && /usr/bin test && awk echo export test ${HOME}
+"$1" 'quoted text' test ${HOME} | "$@" export local && local
+	local $(pwd) -eu $(pwd) 2>/dev/null | grep -eu readonly
+		done grep done 'quoted text' "$@" readonly && $(pwd) export grep --verbose
+	${HOME} printf $(pwd) &&
+then "$@" echo printf readonly -eu local $(pwd) | cd then /usr/bin 2>/dev/null
+		printf export x=1 ${HOME} awk ${HOME} cd
+		done $(pwd) "$1" cd $(pwd) &&
+sed "$1" $(pwd) "$@" --verbose
+'quoted text' awk cd printf local "$1" echo 2>/dev/null
+-eu grep cd printf && && /usr/bin "$1" echo | sed 'quoted text'
+'quoted text' -eu awk "$@" 'quoted text' printf echo printf ${HOME} export
+echo then $(pwd) -eu echo -eu 'quoted text' "$1" sed then
+	| $(pwd) then cd /usr/bin "$1"
+	export sed done cd --verbose test "$@" local sed done
+	"$1" grep ${HOME} test ${HOME} echo awk done done test "$@" && | "$@" "$@" x=1 readonly
+"$1" $(pwd) local done $(pwd) x=1 then
+cd grep $(pwd) "$@" awk then echo test cd local x=1 ${HOME}
+	awk 2>/dev/null done 'quoted text' cd x=1 then x=1
+		readonly echo /usr/bin /usr/bin
+		| 'quoted text' then | printf "$1" $(pwd) 'quoted text'
+--verbose ${HOME} then printf -eu $(pwd) export echo --verbose cd grep |
+	printf printf cd readonly x=1 --verbose | 2>/dev/null sed | x=1 "$1" local
+		--verbose then done then cd
+	export --verbose cd /usr/bin x=1 'quoted text' $(pwd)
+${HOME} readonly cd ${HOME} done local && sed
+		'quoted text' ${HOME} /usr/bin then awk printf -eu --verbose ${HOME}
+		x=1 "$1" x=1 echo awk cd
+		/usr/bin export test $(pwd) local --verbose printf
+	echo "$@" 2>/dev/null readonly done export test local cd cd done
+readonly "$@" printf readonly export -eu $(pwd) cd -eu ${HOME}
+	2>/dev/null /usr/bin export test "$1" awk readonly then export
+	-eu local cd 2>/dev/null "$1"
+	| cd 'quoted text' && cd local /usr/bin grep grep
+	"$@" sed done --verbose &&
+		cd $(pwd) readonly 'quoted text' $(pwd) "$1" cd then echo export printf
+		printf awk readonly /usr/bin "$1" echo --verbose
+	done awk cd --verbose done readonly ${HOME} $(pwd)
+		-eu printf "$1" awk /usr/bin echo test grep | then sed
+${HOME} /usr/bin printf export | /usr/bin "$1"
+"$1" printf test readonly cd && local test test /usr/bin done cd /usr/bin
+	$(pwd) ${HOME} test 'quoted text' ${HOME} | $(pwd) awk printf ${HOME} cd
+grep echo test readonly grep printf echo x=1 "$@" export cd then export
+--verbose awk echo sed | /usr/bin local -eu
+-eu local --verbose $(pwd)
+	awk echo readonly $(pwd) grep export then printf
+	grep export $(pwd) export --verbose
+-eu cd /usr/bin export ${HOME} && $(pwd) done | then
+		grep "$1" sed /usr/bin --verbose | | /usr/bin
+		grep grep local "$@" printf grep "$1" cd /usr/bin
+x=1 awk sed printf cd done done readonly /usr/bin readonly "$@" && local done "$1"
+	'quoted text' "$@" "$@" x=1 2>/dev/null local 2>/dev/null cd done echo test test
+	test ${HOME} done -eu local grep readonly "$1" awk --verbose "$@" export
+	local sed /usr/bin readonly && export
+		then grep export 2>/dev/null awk 'quoted text' -eu "$@"
+"$1" cd echo | sed | cd test 'quoted text' then awk grep
+done && export && export 2>/dev/null
+		x=1 test --verbose && -eu awk
+		x=1 grep $(pwd) readonly "$@" sed && done grep local
+x=1 'quoted text' "$1" readonly x=1 sed awk test then cd
+		test 'quoted text' x=1 grep cd printf echo $(pwd)
+/usr/bin done 2>/dev/null 2>/dev/null done ${HOME} /usr/bin local --verbose
+		export done "$@" done "$1" then "$1" awk 2>/dev/null
+	'quoted text' local x=1 $(pwd) 'quoted text' test sed then printf awk
+	"$@" 2>/dev/null cd x=1 --verbose $(pwd) local local /usr/bin ${HOME} --verbose
+	then 'quoted text' readonly ${HOME} /usr/bin
+		awk awk /usr/bin ${HOME} readonly && export done && 2>/dev/null
+	test readonly test grep test awk readonly awk 2>/dev/null x=1 /usr/bin |
+	${HOME} export /usr/bin awk grep | printf /usr/bin
+	"$1" printf 2>/dev/null -eu local && "$1" printf test x=1 2>/dev/null
+		--verbose $(pwd) sed x=1 2>/dev/null --verbose test -eu --verbose readonly
+		| -eu "$1" then 'quoted text' then cd cd
+	2>/dev/null "$1" export done sed export ${HOME} local done "$@" readonly --verbose
+	grep "$@" awk local $(pwd) 'quoted text' grep cd -eu "$@" --verbose
+sed grep export x=1 $(pwd) 'quoted text' "$1" awk "$@" done printf
+| grep readonly echo awk done && $(pwd) "$1" "$1" readonly test
+-eu 2>/dev/null echo --verbose test | ${HOME} --verbose
+		${HOME} "$1" "$@" awk "$1" /usr/bin
+		| x=1 'quoted text' && 2>/dev/null | $(pwd) 2>/dev/null
+2>/dev/null | $(pwd) grep printf "$@" sed local | x=1
+${HOME} | then printf readonly printf
+sed echo 'quoted text'
+| && local done "$1" grep
+	awk then printf test /usr/bin test cd sed $(pwd) && -eu readonly
+export $(pwd) grep echo
+	${HOME} grep readonly done |
+x=1 sed grep /usr/bin done -eu grep "$@" local test printf
+		cd $(pwd) printf "$@" 2>/dev/null
+cd $(pwd) test | cd && printf readonly printf sed sed
+		$(pwd) "$1" ${HOME} -eu printf && 2>/dev/null printf --verbose
+	sed cd ${HOME} 'quoted text' "$@" 'quoted text' $(pwd) awk test
+	done then 2>/dev/null 'quoted text' $(pwd) cd test local
+		grep ${HOME} --verbose --verbose local $(pwd) /usr/bin x=1 /usr/bin
+		"$1" test printf sed $(pwd) -eu $(pwd)
+	cd x=1 | export | test then sed "$@" 2>/dev/null | /usr/bin ${HOME} "$@" 'quoted text'
+		/usr/bin grep test then /usr/bin echo --verbose test "$1" "$@"
+	x=1 echo export export echo export
+		sed then 2>/dev/null awk $(pwd) 2>/dev/null
+	printf sed $(pwd) --verbose --verbose 'quoted text' x=1 'quoted text' readonly
+		--verbose local --verbose | local && "$1" /usr/bin --verbose
+	"$@" then 'quoted text' --verbose "$@" "$@" done grep awk
+		${HOME} printf && && --verbose "$@" "$@"
+	| -eu grep 'quoted text' test grep test readonly -eu cd printf -eu
+cd "$@" "$@" echo readonly local printf --verbose echo
+		'quoted text' && --verbose 'quoted text' "$1" done 'quoted text' done export
+local x=1 awk "$@" export x=1
+	test ${HOME} readonly && then grep done $(pwd)
+/usr/bin "$1" export --verbose ${HOME} readonly cd done export
+		local 2>/dev/null awk 2>/dev/null test "$@" local
+	-eu x=1 ${HOME} "$1" /usr/bin $(pwd) 2>/dev/null
+		local --verbose done echo | local && ${HOME} test | x=1 export test grep "$@"
+	$(pwd) "$@" export $(pwd) | grep -eu
+	local x=1 grep && x=1 test done ${HOME} cd grep --verbose
+		-eu export awk 'quoted text'
+		printf -eu cd echo "$@" /usr/bin 2>/dev/null "$1"
+cd readonly 'quoted text' "$@" sed
+		grep then 2>/dev/null --verbose test "$1" export sed printf ${HOME}
+	sed ${HOME} grep | cd "$1" done cd 2>/dev/null x=1 local "$1"
+		local --verbose test | && $(pwd) $(pwd) "$@" then grep 'quoted text'
+	awk readonly readonly ${HOME} && echo echo 'quoted text' --verbose test 'quoted text'
+		readonly awk then awk then "$1" done 2>/dev/null
+x=1 'quoted text' "$@" -eu export x=1 awk | done test 2>/dev/null
+	-eu --verbose | | | local "$1" grep awk "$@" printf 'quoted text' -eu ${HOME} x=1
+	x=1 | local cd 'quoted text' ${HOME} && 2>/dev/null | echo done
+"$@" "$@" && 'quoted text' cd 2>/dev/null 2>/dev/null $(pwd) local --verbose
+echo "$@" -eu readonly x=1 x=1 x=1 -eu "$@" then local 2>/dev/null
+		export "$@" grep printf echo cd "$@" sed $(pwd) printf && "$@" test /usr/bin 'quoted text'
+	x=1 /usr/bin "$1" export "$1" $(pwd) | x=1 x=1 "$@"
+	"$@" | ${HOME} $(pwd) --verbose
+	then local --verbose echo grep echo export && readonly sed $(pwd)
+grep test "$1" ${HOME} grep local 2>/dev/null done $(pwd)
+	awk && grep "$1" ${HOME} /usr/bin
+	cd x=1 "$1" && local && test 'quoted text' then 'quoted text' | export
+	done printf "$1" then awk grep 'quoted text' "$1"
+${HOME} readonly ${HOME} | done printf && grep --verbose
+export ${HOME} x=1 local $(pwd) echo export test | 'quoted text' |
+	--verbose printf /usr/bin "$@" 'quoted text'
+	x=1 echo grep "$@" "$1" grep done | "$1" 2>/dev/null --verbose
+	test printf sed | | sed done grep done $(pwd) 2>/dev/null test && sed --verbose
+	x=1 printf test && local && readonly x=1 "$1" cd --verbose 2>/dev/null
+	| sed grep sed --verbose $(pwd) echo done sed printf |
+	grep /usr/bin awk grep test grep readonly echo
+	local awk grep grep test test done -eu && local "$1" --verbose && $(pwd) echo
+		${HOME} 'quoted text' 2>/dev/null grep grep
+	grep ${HOME} readonly | cd ${HOME} awk -eu done "$@" then 'quoted text' grep grep
+	-eu | "$@" 2>/dev/null 2>/dev/null export local /usr/bin awk x=1 'quoted text'
+	x=1 x=1 export sed cd | --verbose test "$1" /usr/bin printf awk 2>/dev/null
+	local then -eu export readonly $(pwd)
+	local sed -eu -eu local readonly sed
+grep ${HOME} grep awk echo awk /usr/bin awk 2>/dev/null x=1 then -eu /usr/bin
+	"$@" ${HOME} cd x=1 done
+done grep --verbose then ${HOME} done 2>/dev/null then "$1" grep sed readonly -eu
+	readonly /usr/bin cd -eu --verbose 'quoted text' cd export && readonly local
+2>/dev/null $(pwd) then "$1" echo sed
+2>/dev/null grep sed sed local -eu
+	echo done printf printf "$@" --verbose grep printf
+/usr/bin | export 2>/dev/null sed local x=1 | awk export 2>/dev/null
+		| --verbose $(pwd) cd sed 'quoted text'
+"$@" grep export -eu && local awk export -eu grep cd echo
+	readonly ${HOME} 'quoted text' readonly
+local readonly done x=1 | --verbose
+		awk export export grep export done readonly cd -eu && x=1 sed sed local "$@" -eu
+	done && export readonly /usr/bin grep done --verbose x=1 test test awk ${HOME}
+		awk readonly test "$@" then /usr/bin ${HOME} "$1" export && done sed "$@"
+local local 'quoted text' "$@" --verbose readonly cd 2>/dev/null $(pwd)
+	| sed $(pwd) "$@" test -eu x=1 -eu "$1" && 'quoted text' readonly grep
+	local 'quoted text' grep awk "$@" && grep sed
+${HOME} && awk export readonly local export test then
+		'quoted text' export ${HOME} "$@" 'quoted text'
+		readonly test ${HOME} x=1 -eu "$1" -eu grep "$@"
+	readonly | ${HOME} readonly 2>/dev/null awk done -eu "$1"
+		${HOME} then cd --verbose /usr/bin
+	x=1 'quoted text' grep then "$1"
+		readonly echo done awk sed
+	/usr/bin local done then /usr/bin | printf $(pwd) cd test export
+		awk | $(pwd) local | x=1 | && 'quoted text' test sed test cd &&
+		grep done | && readonly && printf --verbose
+then ${HOME} "$@" awk | cd then | 'quoted text'
+	local "$@" ${HOME} readonly
+	local sed awk 'quoted text' | |
+sed then "$1" "$@" 2>/dev/null | -eu test 'quoted text' local 2>/dev/null printf
+		grep /usr/bin test "$1" done export "$1" && ${HOME} x=1
+cd 2>/dev/null "$@" cd local grep sed ${HOME} --verbose awk grep -eu
+${HOME} test awk $(pwd)
+		grep 'quoted text' --verbose /usr/bin | then cd awk done 2>/dev/null
+	-eu x=1 sed /usr/bin -eu done grep echo "$@" $(pwd)
+		export export "$@" 2>/dev/null grep && sed cd /usr/bin echo 'quoted text'
+/usr/bin | export cd | test --verbose ${HOME} /usr/bin "$1" |
+	printf && awk then "$@" "$1"
+		local 2>/dev/null local && ${HOME} $(pwd) readonly sed x=1 && 2>/dev/null
+		2>/dev/null $(pwd) 2>/dev/null
+		"$1" echo x=1 2>/dev/null -eu --verbose export
+		| then $(pwd) awk "$1" x=1 ${HOME} ${HOME} export test local local
+		cd "$1" sed cd $(pwd) cd ${HOME} done x=1 done 'quoted text' x=1
+local ${HOME} $(pwd) x=1
+$(pwd) /usr/bin local --verbose printf local printf printf $(pwd)
+awk "$1" then x=1 "$1" ${HOME} export /usr/bin done grep sed echo
+		local --verbose done readonly $(pwd) local readonly /usr/bin && printf $(pwd)
+	local x=1 ${HOME} cd /usr/bin
+		done awk "$@" cd x=1 'quoted text' echo $(pwd) -eu 'quoted text'
+		cd readonly echo then x=1 then 2>/dev/null | printf
+	$(pwd) --verbose -eu $(pwd) grep grep 'quoted text'
+		test echo then 'quoted text'
+export "$@" "$1" grep | echo 2>/dev/null | done then /usr/bin
+	export done --verbose --verbose grep local local echo --verbose
+		test grep echo ${HOME} -eu local export $(pwd) awk 'quoted text'
+		local 2>/dev/null /usr/bin echo 'quoted text' then && "$@"
+		cd ${HOME} printf echo ${HOME} | readonly
+"$@" "$1" 'quoted text' --verbose export
+awk export local awk 'quoted text'
+readonly ${HOME} ${HOME} ${HOME} echo x=1 echo printf echo printf -eu
+	local ${HOME} then /usr/bin grep --verbose
+	test cd done then export -eu 'quoted text'
+		cd x=1 "$1" export echo 2>/dev/null -eu test local export sed done $(pwd)
+		done sed 'quoted text' "$1" 'quoted text'
+		awk export echo sed sed ${HOME}
+		x=1 --verbose "$@" /usr/bin
+	local readonly "$1" ${HOME} 2>/dev/null -eu done
+		--verbose ${HOME} local
+${HOME} done export awk then
+	'quoted text' test ${HOME} printf 'quoted text' "$@"
+		printf awk | && x=1 then "$@" sed ${HOME} "$1" grep --verbose grep test
+		$(pwd) 2>/dev/null x=1 $(pwd) awk --verbose awk printf
+		grep printf "$1" -eu cd awk
+2>/dev/null sed 2>/dev/null readonly 'quoted text' export echo printf
+	sed /usr/bin test /usr/bin awk sed | -eu x=1 2>/dev/null
+grep && "$@" x=1 "$1" cd "$1" "$@" 2>/dev/null echo
+		awk readonly done 'quoted text' 2>/dev/null done echo
+		export "$1" echo export && awk ${HOME} --verbose -eu echo
+test "$1" done awk ${HOME} local | echo awk printf then 2>/dev/null | awk -eu
+		${HOME} readonly | ${HOME} then 'quoted text'
+| awk local -eu -eu ${HOME} grep
+'quoted text' then echo ${HOME} --verbose ${HOME}
+		echo "$1" echo ${HOME} /usr/bin ${HOME} "$@" --verbose grep "$@"
+	&& local ${HOME} test export echo awk cd 'quoted text' x=1 "$1" && sed 2>/dev/null
+		grep | local grep | &&
+		2>/dev/null export echo "$@" local
+		cd grep $(pwd) printf x=1
+		2>/dev/null awk | then && done $(pwd) | /usr/bin "$1" test done
+done echo printf grep /usr/bin --verbose
+		printf 2>/dev/null "$@" $(pwd) "$1" x=1 $(pwd) cd then done echo readonly
+		local test -eu test grep "$@" x=1 readonly
+	echo then && 2>/dev/null cd "$@" /usr/bin sed |
+	-eu "$@" grep 2>/dev/null $(pwd) /usr/bin x=1 "$@"
+	2>/dev/null export && "$1" "$@" --verbose $(pwd) ${HOME} done test 'quoted text'
+	| && "$1" -eu | export echo -eu 2>/dev/null sed
+		export export /usr/bin grep $(pwd) grep local
+		--verbose grep cd sed readonly done test test "$@" export -eu cd
+		/usr/bin readonly ${HOME} test && then --verbose --verbose readonly test
+	"$@" "$1" | && printf echo x=1
+'quoted text' awk echo done x=1 cd $(pwd) $(pwd) &&
+then -eu "$1" "$@" local grep $(pwd)
+sed x=1 "$@" | 'quoted text'
+		test grep export cd 2>/dev/null printf 2>/dev/null test "$@"
+	readonly x=1 then export export /usr/bin
+	"$@" $(pwd) sed awk $(pwd) && $(pwd) | --verbose "$@" x=1 "$1" cd --verbose "$@"
+	&& readonly awk 'quoted text' grep then ${HOME} export
+	local ${HOME} sed export $(pwd) | x=1
+local 'quoted text' $(pwd) /usr/bin x=1
+	"$1" test local x=1 done 'quoted text'
+x=1 | $(pwd) 2>/dev/null -eu --verbose
+		"$1" "$@" test then 2>/dev/null x=1 ${HOME}
+awk awk sed x=1 'quoted text' 'quoted text' ${HOME} local 2>/dev/null
+	2>/dev/null grep grep then 2>/dev/null awk "$1" /usr/bin local
+	'quoted text' "$1" -eu 2>/dev/null readonly
+-eu printf -eu "$1" /usr/bin $(pwd) ${HOME} /usr/bin | echo cd grep export cd
+	| export /usr/bin | $(pwd) cd awk x=1 readonly
+		grep 2>/dev/null "$@" export -eu ${HOME} --verbose x=1
+		done grep 'quoted text' then --verbose cd $(pwd)
+		--verbose local sed local cd
+sed done cd -eu -eu "$@" /usr/bin local cd
+test -eu sed 'quoted text' awk grep cd x=1 /usr/bin
+		readonly ${HOME} grep 2>/dev/null printf
+	| ${HOME} x=1 echo $(pwd) "$@"
+		--verbose x=1 "$1" x=1 "$@" "$1"
+	-eu then ${HOME} export grep --verbose
+		"$1" grep /usr/bin then /usr/bin cd $(pwd) --verbose x=1 sed done
+$(pwd) printf local x=1
+		export test local $(pwd) grep $(pwd) 2>/dev/null
+		2>/dev/null cd awk 2>/dev/null $(pwd) $(pwd) x=1 2>/dev/null
+		2>/dev/null ${HOME} echo "$1" sed 'quoted text'
+test /usr/bin echo "$@" -eu awk awk export echo
+2>/dev/null grep sed --verbose $(pwd) && 2>/dev/null "$1" 'quoted text'
+	${HOME} test export export
+		printf 2>/dev/null "$@" printf cd ${HOME} cd $(pwd) -eu /usr/bin
+2>/dev/null "$@" done /usr/bin
+printf /usr/bin printf $(pwd)
+	${HOME} readonly done $(pwd) done 2>/dev/null
+awk "$1" --verbose "$1" test printf local done --verbose export grep done "$1"
+	"$1" sed x=1 sed | -eu cd export "$@" 'quoted text'
+		2>/dev/null printf "$1" local test "$@" awk local x=1 awk sed --verbose
+x=1 && x=1 "$@" readonly -eu ${HOME}
+		"$@" "$@" -eu local $(pwd) test grep | && --verbose ${HOME} $(pwd) x=1 local
+		done readonly --verbose "$@" x=1 test printf printf test then local
+	local -eu export printf 2>/dev/null -eu local | "$1" grep --verbose
+	x=1 local x=1 | readonly then printf 2>/dev/null awk export $(pwd)
+		/usr/bin export ${HOME} local cd --verbose echo $(pwd)
+	then export local printf x=1 ${HOME} | ${HOME} && "$@" test then -eu "$@"
+		cd && then ${HOME} "$1" readonly awk then
+		export cd printf local done
+"$1" | test /usr/bin cd | cd 2>/dev/null awk test export printf readonly
+${HOME} "$@" && "$1" test 'quoted text'
+		cd test && readonly test -eu /usr/bin readonly
+		local echo ${HOME} test readonly --verbose
+	${HOME} && cd test ${HOME} grep sed x=1 /usr/bin test printf printf "$@"
+	grep awk export 2>/dev/null printf --verbose "$1"
+	export x=1 -eu 'quoted text'
+		--verbose printf grep ${HOME} $(pwd) local $(pwd)
+&& && "$@" -eu x=1 grep test awk
+		2>/dev/null done $(pwd) test then $(pwd)
+	&& test export ${HOME} export echo echo echo -eu
+		then printf -eu then export then && | sed local done /usr/bin
+	| sed | sed "$1" 'quoted text' 2>/dev/null $(pwd) awk 2>/dev/null done | done
+		echo sed "$1" /usr/bin -eu | grep /usr/bin local 2>/dev/null
+		${HOME} then awk local then "$@" x=1 awk echo readonly
+printf && awk "$@" sed printf 2>/dev/null done -eu /usr/bin
+		cd cd && echo awk readonly && "$1" readonly 'quoted text' &&
+		'quoted text' "$1" x=1 /usr/bin && awk readonly grep printf -eu then readonly
+	test then grep -eu export -eu then local cd "$@" 2>/dev/null
+		2>/dev/null 2>/dev/null "$@" /usr/bin
+	"$1" $(pwd) x=1 'quoted text' 'quoted text' cd ${HOME} && --verbose
+		test ${HOME} done 'quoted text' done printf cd x=1 "$1" sed |
+	sed grep 2>/dev/null x=1 /usr/bin --verbose /usr/bin then --verbose "$1" "$1" echo
+done test local then done export done echo $(pwd) done --verbose &&
+test echo 'quoted text' "$1" && -eu x=1
+	printf /usr/bin local && /usr/bin /usr/bin ${HOME} local | printf x=1 then export
+	--verbose awk --verbose && && done "$1" cd 2>/dev/null awk awk then 'quoted text'
+	"$@" awk local local echo cd x=1 echo -eu
+	readonly echo local export readonly done "$@" --verbose sed done x=1 awk && "$@"
+${HOME} done test sed done --verbose
+--verbose 'quoted text' 2>/dev/null
+		$(pwd) readonly "$@" test x=1 "$1" printf "$@" -eu
+	local local --verbose 2>/dev/null --verbose 2>/dev/null $(pwd)
+	test grep grep "$@" grep readonly
+-eu && ${HOME} x=1 test local -eu done test 2>/dev/null $(pwd)
+$(pwd) 2>/dev/null readonly 2>/dev/null readonly awk "$@" readonly grep done
+	'quoted text' "$@" && $(pwd) test 'quoted text' ${HOME} awk --verbose --verbose
+	/usr/bin $(pwd) done 2>/dev/null $(pwd) sed "$1" sed
+&& $(pwd) readonly 2>/dev/null
+		2>/dev/null test awk sed /usr/bin local then ${HOME} /usr/bin $(pwd) "$1"
+	&& /usr/bin "$@" cd done awk
+done readonly local x=1 then
+	then then awk export 'quoted text' then sed 'quoted text'
+awk "$@" test readonly readonly x=1 grep awk "$@" ${HOME}
+x=1 export x=1 x=1 | cd test test test && --verbose echo grep export echo
+test printf printf -eu 'quoted text' grep "$@" awk sed
+		/usr/bin $(pwd) | 'quoted text' readonly test ${HOME} "$1" printf
+	-eu -eu 'quoted text' test
+	sed ${HOME} 2>/dev/null -eu | readonly grep echo printf "$@"
+${HOME} then sed -eu echo readonly cd test 'quoted text' test sed
+		then -eu readonly && | printf test grep ${HOME} 2>/dev/null
+		--verbose local /usr/bin
+		echo local local sed --verbose local then cd echo -eu then -eu done
+		then sed | then grep | echo "$@" $(pwd) 'quoted text' -eu export
+		-eu ${HOME} awk -eu 2>/dev/null "$1" && 2>/dev/null |
+		2>/dev/null readonly then x=1 $(pwd) awk then $(pwd) -eu then then 2>/dev/null
+		cd 'quoted text' x=1 && printf x=1 /usr/bin
+local printf test && ${HOME} export --verbose /usr/bin 'quoted text' awk "$1" then
+	"$@" then --verbose echo | $(pwd) ${HOME}
+	sed echo local awk cd --verbose local 2>/dev/null ${HOME} local test awk readonly
+		sed awk awk sed -eu | $(pwd) | export "$@" 2>/dev/null && done readonly -eu
+| grep -eu then local $(pwd) awk $(pwd) export echo x=1 &&
+		x=1 export x=1 "$@" awk printf done then printf $(pwd)
+		-eu 2>/dev/null "$1" local printf
+		&& --verbose awk $(pwd) then | local sed cd local --verbose
+	done echo -eu $(pwd) done test echo awk cd cd export ${HOME} /usr/bin done local
+done done /usr/bin --verbose $(pwd) readonly x=1
+sed printf -eu x=1 done export /usr/bin "$@"
+	| done grep local export sed echo "$@" test $(pwd) readonly then echo
+		-eu $(pwd) "$1" echo cd "$1" test cd x=1
+	'quoted text' /usr/bin x=1 $(pwd) x=1 readonly local -eu grep
+	| && -eu 'quoted text' /usr/bin then readonly x=1 $(pwd) 'quoted text'
+		x=1 local printf "$@" export printf $(pwd) done /usr/bin | --verbose
+		x=1 "$1" $(pwd) then $(pwd) local
+	| then 'quoted text' && done echo then -eu test sed sed cd echo 2>/dev/null
+		/usr/bin && && 2>/dev/null "$@" "$1" x=1 awk then
+x=1 x=1 ${HOME} /usr/bin
+	"$@" export done awk done readonly then readonly then grep
+	grep sed then "$@" "$1" printf done grep then then && grep printf
+		x=1 echo /usr/bin cd 'quoted text'
+	$(pwd) $(pwd) cd local --verbose "$@" echo cd $(pwd) 2>/dev/null
+	test test readonly done | 'quoted text' x=1 ${HOME} then
+		test --verbose | --verbose export x=1 echo 2>/dev/null x=1 local |
+		grep done then && done $(pwd) readonly ${HOME}
+| local -eu x=1 then -eu 2>/dev/null /usr/bin
+	local "$1" cd /usr/bin
+	export --verbose /usr/bin
+		x=1 readonly --verbose 2>/dev/null test $(pwd) 2>/dev/null printf
+readonly readonly grep local
+		readonly echo done -eu x=1 "$@" echo then
+	local $(pwd) 2>/dev/null grep echo $(pwd)
+x=1 readonly cd awk 'quoted text' sed export && -eu ${HOME} --verbose done test
+		"$1" awk local done awk x=1 2>/dev/null
+	grep | /usr/bin | | x=1 sed 2>/dev/null /usr/bin "$1" | export printf
+		readonly $(pwd) 2>/dev/null "$@"
+	-eu local /usr/bin local then 'quoted text'
+		grep "$@" awk ${HOME} done x=1 printf $(pwd)
+	sed 2>/dev/null grep done | 2>/dev/null
+		${HOME} done -eu then
+/usr/bin "$@" x=1 readonly readonly "$1" x=1
+		grep "$1" done readonly readonly printf
+grep "$1" $(pwd) awk done cd sed &&
+export -eu "$1" && export readonly ${HOME} grep
+		grep export then | && done --verbose cd 2>/dev/null
+		cd "$1" sed 'quoted text' printf cd "$1" grep
+	$(pwd) echo printf "$1" test grep export sed "$@"
+		awk then sed local -eu done printf 2>/dev/null test "$@"
+test done | /usr/bin $(pwd) 'quoted text' done "$1"
+grep sed --verbose --verbose
+	/usr/bin "$1" sed 'quoted text' test /usr/bin
+cd printf 'quoted text' printf then
+	echo printf /usr/bin echo export "$@" -eu --verbose
+	awk "$1" && sed export /usr/bin readonly done local done && cd --verbose 'quoted text'
+		done && awk readonly export then test ${HOME} awk --verbose awk $(pwd) sed
+/usr/bin x=1 then && grep 2>/dev/null && -eu 'quoted text' done
+awk test ${HOME} test sed sed done 2>/dev/null && x=1 then && "$1"
+	export 'quoted text' done /usr/bin 'quoted text' done
+		${HOME} /usr/bin local awk 'quoted text' cd $(pwd) --verbose done test sed
+	echo then --verbose test awk cd -eu grep awk awk 'quoted text'
+sed cd done test readonly printf grep | 'quoted text'
+export /usr/bin ${HOME} sed -eu readonly
+-eu echo /usr/bin test cd x=1 "$1" ${HOME} sed "$1" then test
+		"$@" && --verbose local -eu sed
+	| ${HOME} ${HOME} then
+	'quoted text' printf 2>/dev/null readonly && then grep $(pwd) printf -eu readonly
+	'quoted text' && grep 'quoted text' x=1 "$@" test "$@" readonly cd -eu cd
+	"$@" --verbose printf 'quoted text' --verbose printf cd awk printf
+-eu cd sed then "$1" -eu readonly
+		"$@" printf grep $(pwd) export test done export sed printf cd
+	grep $(pwd) 2>/dev/null -eu sed ${HOME} test "$1" grep awk -eu "$@" test
+	local cd ${HOME} local readonly "$1" 2>/dev/null
+		done local sed then sed test ${HOME}
+	sed $(pwd) cd ${HOME} x=1 "$1" x=1 echo echo sed echo sed 'quoted text' --verbose
+		${HOME} echo printf 2>/dev/null local "$@" 'quoted text'
+--verbose export /usr/bin --verbose local export -eu ${HOME} $(pwd) /usr/bin
+	${HOME} --verbose done test readonly && -eu test x=1 $(pwd) grep echo 2>/dev/null
+		'quoted text' -eu local /usr/bin readonly x=1 && -eu
+	test grep /usr/bin test | cd test --verbose x=1 "$1" $(pwd) ${HOME}
+		"$1" export cd test $(pwd)
+		--verbose && --verbose | grep "$@" && local /usr/bin -eu export
+	$(pwd) x=1 done 2>/dev/null printf 2>/dev/null local ${HOME} "$1"
+	'quoted text' -eu ${HOME} sed "$@" local --verbose "$@" $(pwd) ${HOME}
+local awk test awk /usr/bin "$@" ${HOME}
+	| && x=1 | readonly export ${HOME} --verbose export
+printf cd ${HOME} 2>/dev/null printf --verbose ${HOME} grep ${HOME} done 'quoted text'
+echo "$1" ${HOME} local local x=1 printf
+	awk local readonly /usr/bin echo "$1" "$1" local |
+		cd /usr/bin | "$@" grep --verbose && echo x=1 --verbose local 'quoted text'
+	-eu export "$@" --verbose
+$(pwd) x=1 then "$1" -eu echo
+done readonly done printf echo "$1" printf readonly
+	done $(pwd) ${HOME} /usr/bin 2>/dev/null 'quoted text'
+-eu printf readonly 'quoted text' readonly
+		cd done local awk -eu 'quoted text'
+	2>/dev/null test then ${HOME} done sed export printf
+local local grep done sed x=1 readonly 'quoted text' echo -eu grep
+	&& $(pwd) grep done | 2>/dev/null $(pwd) $(pwd) sed cd | -eu $(pwd)
+		sed "$@" then local grep ${HOME} sed --verbose x=1 --verbose
+	/usr/bin x=1 'quoted text' "$1" x=1 -eu 'quoted text' "$@"
+	grep ${HOME} local | echo local 'quoted text'
+then then grep readonly /usr/bin
+$(pwd) | test -eu sed ${HOME} local
+		x=1 printf local /usr/bin && && 2>/dev/null 'quoted text'
+		"$1" cd -eu awk export
+$(pwd) && printf -eu
+	awk local then x=1 'quoted text' readonly
+cd x=1 export test test printf 2>/dev/null
+	cd "$@" x=1 printf grep -eu ${HOME} "$1" | echo "$1" then
+local printf done 2>/dev/null | $(pwd) local 'quoted text' 'quoted text'
+		awk /usr/bin && 'quoted text'
+	${HOME} local then cd sed $(pwd) done
+		local --verbose echo --verbose sed export
+| && 'quoted text' sed -eu -eu export export echo
+	'quoted text' sed export "$@" 'quoted text' readonly echo readonly cd x=1 --verbose
+	2>/dev/null local 'quoted text'
+--verbose -eu --verbose test
+"$@" printf grep ${HOME} local test && grep -eu local 2>/dev/null cd 'quoted text'
+		printf 'quoted text' then ${HOME}
+		echo --verbose sed && 'quoted text' -eu echo $(pwd) local --verbose test 2>/dev/null
+		/usr/bin "$@" export ${HOME} x=1
+	--verbose -eu done 'quoted text' /usr/bin
+grep cd local 'quoted text'
+echo local "$1" done && "$1" then
+	'quoted text' echo | | ${HOME} "$1"
+		local export "$@" /usr/bin awk cd local $(pwd) sed 'quoted text' --verbose
+		2>/dev/null --verbose && $(pwd) --verbose x=1 awk export then then 2>/dev/null
+	sed ${HOME} printf local sed local
+sed 2>/dev/null printf x=1 echo
+'quoted text' x=1 --verbose sed | awk && 2>/dev/null /usr/bin readonly
+		x=1 done "$1" "$1" --verbose
+		&& 'quoted text' "$@" 'quoted text' export -eu sed done x=1 "$1" done local awk
+	printf "$1" x=1 sed 'quoted text'
+| done echo x=1 "$@" cd $(pwd) | then "$@" &&
+then local local then x=1 2>/dev/null
+x=1 local 'quoted text' readonly
+	local awk then "$1" export grep -eu | test
+&& && awk export test export sed done awk
+	| && then -eu x=1 readonly awk then printf test
+	export local -eu /usr/bin test $(pwd) awk | -eu echo "$1" test
+&& readonly printf awk local | ${HOME} 2>/dev/null 2>/dev/null | 2>/dev/null
+	'quoted text' sed /usr/bin awk printf 2>/dev/null printf printf echo done grep --verbose
+	| 2>/dev/null 2>/dev/null $(pwd)
+	"$1" cd test "$1" 'quoted text' test 'quoted text' awk
+		local /usr/bin -eu x=1 2>/dev/null done cd $(pwd) "$1" | x=1 cd readonly | "$@"
+		"$@" test --verbose test test $(pwd) 2>/dev/null echo x=1 export
+	done --verbose 2>/dev/null
+		--verbose /usr/bin 'quoted text' test local test /usr/bin 2>/dev/null printf
+| readonly x=1 cd --verbose grep
+grep printf done $(pwd) "$@" --verbose export /usr/bin sed readonly 2>/dev/null
+		echo x=1 -eu "$@" "$@" && "$@" x=1 readonly $(pwd) /usr/bin readonly
+echo export 2>/dev/null $(pwd) printf done done then awk test sed $(pwd)
+sed echo grep local x=1 test done
+grep local ${HOME} then printf echo done "$@" "$@" $(pwd)
+--verbose "$1" sed ${HOME} "$1" sed -eu
+	--verbose ${HOME} ${HOME} -eu export test printf
+		grep -eu && /usr/bin echo ${HOME} readonly
+	test echo -eu test printf awk -eu "$1" printf
+		$(pwd) x=1 'quoted text' 2>/dev/null x=1
+	| then grep then /usr/bin x=1 test done $(pwd)
+		"$@" grep -eu echo $(pwd) -eu
+	printf awk $(pwd) test printf local then x=1 /usr/bin
+		$(pwd) grep awk export test ${HOME} export readonly
+		/usr/bin done done 2>/dev/null sed /usr/bin done
+awk readonly && sed sed --verbose local test && printf 2>/dev/null x=1 /usr/bin
+	'quoted text' "$@" readonly -eu "$1" $(pwd)
+	echo "$@" awk echo && | 'quoted text'
+done | ${HOME} done sed sed 2>/dev/null && test readonly "$@" export test local
+		awk cd "$1" export --verbose then export "$@" done readonly
+	then 2>/dev/null done test -eu 2>/dev/null echo cd echo &&
+$(pwd) local ${HOME} then --verbose export
+	--verbose grep then printf && awk 'quoted text' done then
+readonly | $(pwd) grep
+	-eu then then cd | ${HOME} /usr/bin export --verbose $(pwd) 'quoted text' sed
+		done printf export printf grep done /usr/bin done local readonly ${HOME}
+		| test -eu cd printf grep | readonly &&
+${HOME} local x=1 sed ${HOME}
+2>/dev/null -eu | local test $(pwd) echo && printf -eu done echo && local
+	-eu readonly grep echo | export local awk then sed cd $(pwd)
+	cd grep | done then echo local 'quoted text'
+		$(pwd) echo 'quoted text' then local printf export then test export local $(pwd)
+grep echo "$@" printf grep test 2>/dev/null "$@" readonly awk
+export local "$1" export local sed then printf then ${HOME} 'quoted text'
+	"$1" test | -eu awk sed then ${HOME} done "$@" echo cd $(pwd) "$@" grep |
+sed ${HOME} done sed cd test then && && local sed then $(pwd) done
+readonly -eu export then -eu --verbose
+-eu readonly awk | then printf printf
+	export echo "$1" /usr/bin
+		"$@" 2>/dev/null awk echo echo 'quoted text' 'quoted text'
+		cd readonly && 2>/dev/null done | x=1 then ${HOME} 'quoted text' echo
+	printf export grep printf awk -eu readonly "$@" cd 'quoted text' "$@" | $(pwd)
+cd -eu | && then test && -eu "$1" /usr/bin "$1" awk sed
+	"$1" && done $(pwd) awk grep /usr/bin "$1" cd 'quoted text'
+		grep echo $(pwd) | then | sed done "$1" printf && /usr/bin
+		cd 2>/dev/null --verbose
+| /usr/bin x=1 echo readonly sed cd
+	x=1 readonly ${HOME} 2>/dev/null "$@" | "$1" awk 2>/dev/null printf readonly cd
+	$(pwd) then 'quoted text' cd export $(pwd) cd printf 'quoted text'
+	$(pwd) local 2>/dev/null then 'quoted text'
+	test grep then sed echo x=1 grep readonly done --verbose x=1 -eu && readonly
+	&& awk --verbose --verbose
+		| done 'quoted text' grep && | "$1" -eu export
+	"$@" "$@" export | | "$@" "$@" sed
+	"$@" /usr/bin echo sed test -eu | $(pwd) /usr/bin -eu awk /usr/bin then /usr/bin
+	local "$1" sed done | printf "$1" printf x=1 echo grep x=1 export 'quoted text'
+grep /usr/bin cd "$1"
+		x=1 "$1" printf echo grep export
+cd export /usr/bin printf | "$@"
+		grep --verbose -eu test test echo export 'quoted text' export | export ${HOME}
+	2>/dev/null test export local awk then
+export 2>/dev/null echo 2>/dev/null
+--verbose grep x=1 "$1" --verbose readonly cd "$1" then export $(pwd) readonly
+test "$@" /usr/bin $(pwd) echo awk export local /usr/bin awk ${HOME} "$1" -eu echo
+	&& awk test --verbose sed cd grep readonly -eu readonly cd 'quoted text' grep "$@"
+awk printf x=1 2>/dev/null local grep printf
+	/usr/bin 2>/dev/null 2>/dev/null x=1 | | export echo 2>/dev/null
+test test "$@" && sed && "$1" --verbose then 2>/dev/null "$@" local export
+done local 2>/dev/null /usr/bin $(pwd) done
+--verbose done local $(pwd) awk
+	grep "$1" done export "$@" printf cd 'quoted text'
+cd "$1" && /usr/bin | "$1" echo | echo export
+echo "$1" export 'quoted text' echo local $(pwd) "$1" | "$1"
+		/usr/bin | /usr/bin | cd awk
+	/usr/bin awk x=1 "$1" test echo grep --verbose then 'quoted text'
+		--verbose echo && then grep && | grep done echo sed then -eu && grep cd && cd readonly
+		| sed done grep sed 2>/dev/null printf test export local | echo "$@"
@@ -0,0 +1,2001 @@
+		| then test printf 'quoted text' then 'quoted text' x=1 echo
+	readonly grep ${HOME}
+		--verbose | grep ${HOME} readonly
+		export --verbose "$1" "$1" readonly sed "$1" -eu awk -eu | then 'quoted text'
+	cd -eu -eu "$@" x=1 --verbose sed -eu export | local cd cd 'quoted text'
+		x=1 ${HOME} cd printf local && awk -eu local readonly test /usr/bin -eu
+		| local test x=1 done | grep sed grep
+	/usr/bin ${HOME} local sed --verbose | awk cd
+	"$1" export test && x=1
+| local -eu ${HOME} 'quoted text' ${HOME}
+		x=1 awk "$@" local awk grep sed /usr/bin 2>/dev/null --verbose
+		/usr/bin export $(pwd) "$1" grep 'quoted text' ${HOME}
+| sed test done 2>/dev/null
+	sed local "$1" $(pwd) readonly sed 2>/dev/null /usr/bin 2>/dev/null then
+		test --verbose x=1 cd -eu $(pwd) export | ${HOME} grep
+	-eu done export printf cd /usr/bin "$1" && --verbose grep ${HOME} done export
+'quoted text' sed $(pwd) cd 'quoted text' /usr/bin /usr/bin
+		done $(pwd) local echo --verbose | && done local -eu $(pwd) done -eu
+		&& $(pwd) /usr/bin sed && ${HOME} $(pwd) readonly test echo export done "$@"
+		'quoted text' echo printf readonly sed export export && then test ${HOME}
+	x=1 export && done ${HOME} then
+	test -eu -eu "$1" --verbose export &&
+	'quoted text' cd && then
+then echo printf awk x=1 "$1" readonly then ${HOME} then
+printf local export --verbose 'quoted text' grep 2>/dev/null sed
+cd done cd export then --verbose 2>/dev/null
+	cd $(pwd) then printf --verbose export echo echo test && /usr/bin "$@"
+/usr/bin done -eu "$1" /usr/bin grep ${HOME} grep sed -eu ${HOME} ${HOME}
+		cd done ${HOME} /usr/bin 'quoted text'
+/usr/bin cd export x=1 "$@" "$1" x=1 && --verbose
+'quoted text' grep --verbose 'quoted text'
+export --verbose --verbose --verbose /usr/bin "$1"
+cd $(pwd) test sed test
+	grep sed "$1" done 2>/dev/null export
+		x=1 awk && then export test "$1"
+	export /usr/bin 'quoted text' "$1" readonly && grep && "$@" readonly
+	printf && 'quoted text' export x=1
+		/usr/bin $(pwd) "$@" cd echo export
+'quoted text' 2>/dev/null cd awk x=1 x=1 readonly | 'quoted text' local
+		sed -eu 2>/dev/null then done test /usr/bin
+	sed sed 'quoted text' 2>/dev/null "$1" | 'quoted text' 'quoted text'
+		cd readonly -eu grep | echo test | sed
+2>/dev/null test readonly awk 'quoted text' cd && | sed sed 'quoted text' /usr/bin
+local --verbose then test --verbose --verbose done
+	--verbose local echo --verbose 2>/dev/null && x=1 local -eu
+	&& /usr/bin -eu --verbose export /usr/bin cd | cd && | echo ${HOME} grep
+"$@" readonly 2>/dev/null then done
+	echo echo 'quoted text' grep export awk $(pwd)
+$(pwd) then test printf done test then sed printf 'quoted text'
+		2>/dev/null grep "$@" --verbose x=1 "$1" "$@" cd 'quoted text'
+		$(pwd) ${HOME} printf -eu "$1" /usr/bin test
+done done printf printf && cd && ${HOME} awk ${HOME} done --verbose grep grep
+awk x=1 'quoted text' grep echo cd ${HOME}
+	done local printf done then awk --verbose grep
+		"$@" printf "$@" local $(pwd) ${HOME}
+	"$1" echo awk --verbose export && ${HOME} echo "$1" "$@" export awk sed
+		local readonly then "$1" "$@"
+printf 'quoted text' | awk x=1 $(pwd) cd 'quoted text' ${HOME} test /usr/bin
+	test | echo printf "$1" sed then grep printf x=1 $(pwd)
+		then test grep export test "$@" awk --verbose printf
+	test sed -eu test export /usr/bin /usr/bin local "$1" printf test grep test $(pwd)
+	then test awk sed printf x=1 local cd echo | sed cd && $(pwd)
+printf 2>/dev/null ${HOME} 'quoted text' echo test export awk readonly
+$(pwd) cd sed "$@" grep printf $(pwd) awk x=1 "$1" done cd echo
+	$(pwd) done cd then -eu test "$1" then test grep &&
+printf | printf export "$1" "$@" readonly 'quoted text' echo sed cd x=1 readonly
+	cd then --verbose cd awk export "$1" printf printf echo test
+	done ${HOME} /usr/bin | "$1" ${HOME} 2>/dev/null
+		2>/dev/null test cd echo "$1"
+$(pwd) && /usr/bin grep
+export done local readonly | $(pwd) local local --verbose awk 2>/dev/null
+		${HOME} test local local -eu "$@" 'quoted text' | echo -eu
+		echo --verbose 'quoted text'
+	'quoted text' local --verbose $(pwd)
+		echo -eu | local 'quoted text' --verbose awk $(pwd) echo /usr/bin
+		then done local | done 2>/dev/null
+	done awk local x=1 'quoted text' readonly $(pwd) "$@" grep 'quoted text'
+$(pwd) -eu -eu export ${HOME}
+		--verbose local && readonly grep --verbose
+	'quoted text' local export grep grep "$1" ${HOME}
+		"$@" sed && $(pwd) && --verbose
+	done "$1" sed "$@" then
+readonly echo awk awk done then && "$@" x=1
+	awk x=1 sed awk printf export $(pwd) $(pwd) -eu "$1"
+export readonly readonly | $(pwd) --verbose "$@" then printf printf awk $(pwd)
+${HOME} /usr/bin x=1 | export grep x=1 "$1" 2>/dev/null -eu | export echo --verbose
+| awk | 2>/dev/null awk done "$1" x=1 sed | echo --verbose
+		sed -eu 'quoted text' printf 2>/dev/null --verbose printf then 2>/dev/null
+	/usr/bin "$1" then /usr/bin awk 2>/dev/null -eu
+		grep --verbose sed && "$@" && --verbose sed printf export echo done
+		sed local test readonly && local
+		export /usr/bin grep 'quoted text' 'quoted text' grep printf
+	&& && test export ${HOME} "$@" done
+export cd && -eu /usr/bin "$@"
+	grep $(pwd) echo cd printf done x=1
+| $(pwd) && readonly "$1" readonly done 'quoted text'
+	sed /usr/bin --verbose readonly cd 2>/dev/null grep && printf echo done
+	local -eu --verbose grep echo readonly -eu --verbose then echo /usr/bin x=1 $(pwd)
+		'quoted text' awk 2>/dev/null /usr/bin 'quoted text'
+		local 2>/dev/null sed sed readonly ${HOME} && 'quoted text' export --verbose
+	export local echo awk "$@" 2>/dev/null cd -eu ${HOME} 2>/dev/null 2>/dev/null
+	--verbose x=1 local 2>/dev/null /usr/bin local $(pwd) --verbose
+		| grep printf 2>/dev/null ${HOME}
+		$(pwd) grep ${HOME} --verbose awk "$1"
+done && cd cd local grep grep 'quoted text'
+| local && --verbose test $(pwd) then cd then echo
+		x=1 awk echo test --verbose cd 2>/dev/null
+'quoted text' export sed --verbose awk awk printf printf echo ${HOME}
+		export /usr/bin then -eu | | awk ${HOME} then ${HOME} -eu x=1 2>/dev/null
+"$@" then sed -eu 2>/dev/null readonly echo | x=1 /usr/bin ${HOME} export
+	sed printf -eu echo local echo --verbose
+--verbose echo ${HOME} local echo echo --verbose echo $(pwd) --verbose echo echo
+	-eu -eu grep x=1 cd grep printf cd cd
+	"$@" local && printf -eu ${HOME} --verbose --verbose done awk
+	done printf local then echo readonly "$@" cd 'quoted text' test
+test test ${HOME} && local ${HOME} 2>/dev/null printf -eu "$@" export
+	&& x=1 echo export grep grep ${HOME} x=1 local --verbose /usr/bin
+		${HOME} then awk $(pwd) printf 2>/dev/null 2>/dev/null
+/usr/bin sed /usr/bin test x=1 then printf
+${HOME} x=1 "$1" 'quoted text' "$1" 'quoted text'
+	cd "$1" 2>/dev/null | test done
+		then && local local | && awk done awk printf "$@" export x=1 cd ${HOME} 2>/dev/null
+x=1 2>/dev/null awk printf
+| | printf "$1" test readonly
+		/usr/bin printf done && readonly done /usr/bin
+/usr/bin $(pwd) test done echo | readonly export | awk 2>/dev/null local
+		x=1 sed sed awk grep then "$1" export
+local then "$@" echo awk /usr/bin 2>/dev/null then
+	done ${HOME} && grep
+echo test awk --verbose ${HOME} $(pwd) && printf echo && $(pwd) sed sed 2>/dev/null
+/usr/bin -eu grep $(pwd) --verbose
+	echo -eu && then then
+	export "$1" awk done /usr/bin test grep /usr/bin --verbose -eu then done && ${HOME}
+		export | "$1" -eu printf ${HOME} sed then "$@" "$@" printf cd "$1" local
+	/usr/bin && /usr/bin "$@" export cd 'quoted text' readonly test done ${HOME}
+	awk local 2>/dev/null export grep "$1"
+		$(pwd) local grep local /usr/bin /usr/bin awk 2>/dev/null 2>/dev/null
+	printf "$@" local --verbose && 2>/dev/null done
+"$1" done ${HOME} test export --verbose printf test "$1" /usr/bin
+$(pwd) awk /usr/bin grep 2>/dev/null --verbose /usr/bin local 'quoted text'
+	"$@" printf then 2>/dev/null "$1" local local --verbose readonly awk
+	echo 'quoted text' done
+	$(pwd) | | /usr/bin printf local ${HOME} done local then export x=1
+	local echo printf local then $(pwd) 'quoted text' test done readonly |
+		"$1" then awk -eu --verbose cd local --verbose ${HOME} && export local
+		grep grep done awk -eu
+		&& sed awk export "$1" test then
+	cd local local printf sed "$@" /usr/bin /usr/bin "$@" && then | && $(pwd) /usr/bin
+/usr/bin | printf 'quoted text' local
+		echo "$@" "$1" done x=1 ${HOME} && done echo | "$@" local 'quoted text' echo ${HOME}
+awk echo "$@" echo awk "$@"
+		'quoted text' sed 'quoted text'
+	local cd $(pwd) "$@" x=1 /usr/bin 'quoted text' $(pwd) export
+x=1 echo -eu cd -eu echo /usr/bin
+	then local x=1 local echo echo && readonly
+		local -eu then export export
+	2>/dev/null then then readonly 2>/dev/null grep echo 2>/dev/null
+--verbose "$1" /usr/bin printf
+"$1" sed "$@" | | $(pwd) "$1" && done "$1" -eu --verbose local grep readonly
+${HOME} --verbose done printf "$1" -eu 2>/dev/null
+	&& 'quoted text' 'quoted text' sed sed 2>/dev/null test cd then grep | $(pwd)
+$(pwd) cd awk cd test
+sed | x=1 | echo readonly printf test
+	-eu test then /usr/bin test sed $(pwd) 'quoted text' x=1 done x=1 x=1 grep /usr/bin
+		then cd /usr/bin -eu $(pwd) && | && test then x=1 test ${HOME} done
+	-eu printf then $(pwd) /usr/bin 2>/dev/null sed "$@" grep /usr/bin 'quoted text'
+	| && test printf $(pwd) grep awk export awk | && sed x=1 && then
+		grep -eu ${HOME} export readonly done "$1"
+	test export ${HOME} ${HOME}
+		--verbose done export | then awk /usr/bin test $(pwd)
+export test ${HOME} awk -eu "$@" printf /usr/bin x=1 2>/dev/null
+	local then printf test
+&& | | echo printf printf awk test $(pwd) awk sed readonly 2>/dev/null
+"$@" readonly --verbose -eu x=1 'quoted text' --verbose | grep -eu "$1" export 2>/dev/null
+		"$@" done local && printf readonly
+	&& printf && "$@" "$1" test local $(pwd) test test | --verbose test $(pwd) readonly
+	sed test | | awk /usr/bin
+readonly 2>/dev/null "$@" cd awk readonly
+		test 2>/dev/null test local $(pwd) -eu 'quoted text' done grep
+| sed export ${HOME} /usr/bin export $(pwd) "$1" sed
+		echo && /usr/bin -eu ${HOME}
+	${HOME} 2>/dev/null export done awk "$1" printf ${HOME} grep awk "$@" readonly $(pwd)
+grep local sed printf grep then && 2>/dev/null test local readonly
+		readonly 2>/dev/null /usr/bin
+		-eu grep cd test /usr/bin && 2>/dev/null | sed test && --verbose sed local
+		--verbose --verbose -eu test $(pwd)
+		-eu cd "$1" local then x=1 ${HOME} readonly
+"$1" sed then "$1" grep
+sed readonly echo done --verbose
+		/usr/bin local printf export | /usr/bin awk export readonly test local
+grep x=1 $(pwd) ${HOME} --verbose
+	grep printf 2>/dev/null local grep --verbose grep && "$@" 2>/dev/null ${HOME}
+-eu printf -eu -eu 'quoted text' x=1 cd readonly --verbose sed
+		${HOME} ${HOME} -eu /usr/bin
+		cd echo export printf
+	x=1 test echo sed /usr/bin local awk echo
+"$@" export grep --verbose ${HOME}
+		&& printf then | then printf
+2>/dev/null cd $(pwd) awk then ${HOME} then && && readonly cd then "$@" then
+test ${HOME} export --verbose "$1" "$@" awk export /usr/bin
+	x=1 printf | printf $(pwd) grep ${HOME} echo done local then cd 2>/dev/null
+	2>/dev/null printf local cd "$1" then echo -eu
+	grep local then && grep 2>/dev/null test | 2>/dev/null && /usr/bin done
+local --verbose test export $(pwd) export cd then then echo echo "$@"
+		awk 2>/dev/null awk local -eu |
+	echo $(pwd) && "$@" awk 2>/dev/null
+		| then echo awk $(pwd) cd -eu awk /usr/bin --verbose --verbose /usr/bin
+	$(pwd) export sed /usr/bin printf done awk then export --verbose
+grep | -eu done 'quoted text' cd then x=1 -eu 'quoted text'
+$(pwd) local | awk ${HOME} cd echo
+		${HOME} "$1" test -eu -eu "$@" | grep sed --verbose |
+		/usr/bin done && "$@" then "$1" done && ${HOME} &&
+		${HOME} && "$@" "$@" printf -eu x=1 $(pwd) | && test test
+	export readonly then test cd grep
+&& && -eu x=1 "$@" printf cd local "$1" x=1 export grep /usr/bin
+		$(pwd) x=1 --verbose 'quoted text'
+		awk export && && readonly /usr/bin done awk local ${HOME}
+	| grep 2>/dev/null "$@" sed -eu export cd ${HOME}
+		readonly cd done export && 2>/dev/null
+	&& awk -eu x=1 && done cd $(pwd) awk sed echo grep cd cd done $(pwd)
+	$(pwd) -eu readonly "$1" readonly export "$@" -eu awk "$@" /usr/bin
+export local echo --verbose printf 2>/dev/null
+		local "$1" -eu echo then --verbose -eu local | $(pwd) sed "$@" local
+$(pwd) 'quoted text' test "$1" /usr/bin
+		${HOME} test /usr/bin test grep sed 2>/dev/null "$@" awk && "$@"
+		| test 'quoted text' awk grep 'quoted text' test done done readonly -eu x=1 ${HOME}
+		awk cd 'quoted text' readonly readonly export 'quoted text' grep -eu grep x=1 'quoted text'
+then export 2>/dev/null
+	export then ${HOME} 2>/dev/null done awk test
+	$(pwd) printf grep export 'quoted text' 2>/dev/null
+		sed export export $(pwd) 2>/dev/null -eu | grep "$1" readonly cd grep
+/usr/bin "$1" /usr/bin x=1 /usr/bin echo 2>/dev/null "$1" "$1" cd && $(pwd)
+${HOME} done test done then
+printf cd export 'quoted text' 'quoted text'
+	&& cd 2>/dev/null cd readonly
+sed then --verbose /usr/bin &&
+cd "$1" 2>/dev/null $(pwd) -eu export then "$1" echo done cd local -eu | 2>/dev/null
+		echo readonly $(pwd) "$1" readonly awk "$@" "$1"
+	local awk && done | "$@" echo /usr/bin 2>/dev/null awk x=1 x=1 printf
+| grep && --verbose sed printf
+		/usr/bin local then 'quoted text' cd -eu ${HOME} readonly sed x=1 printf x=1
+&& grep cd cd awk --verbose then then test cd
+		test local awk | test $(pwd) echo 'quoted text' /usr/bin
+		echo printf done /usr/bin
+		2>/dev/null x=1 awk ${HOME} awk readonly sed 2>/dev/null readonly --verbose ${HOME}
+	grep 'quoted text' echo test
+		2>/dev/null 2>/dev/null export then cd export $(pwd) sed "$@" export
+		cd cd x=1 'quoted text' /usr/bin -eu export then "$@" 'quoted text'
+		| /usr/bin done cd local cd export export
+		"$1" "$1" --verbose /usr/bin echo x=1 sed ${HOME} &&
+	awk echo "$1" 'quoted text' "$1" x=1 "$1" | "$@" sed local 'quoted text' 'quoted text'
+	sed /usr/bin $(pwd) test $(pwd) awk test export | x=1 then echo "$@" echo &&
+	/usr/bin --verbose printf
+${HOME} 'quoted text' 2>/dev/null | 2>/dev/null sed ${HOME} x=1 readonly cd
+	--verbose 2>/dev/null test 'quoted text'
+"$@" 2>/dev/null echo readonly local done then &&
+		then 2>/dev/null $(pwd) "$@" && "$@" -eu grep echo sed
+${HOME} then "$1" --verbose -eu
+	cd 2>/dev/null then $(pwd) --verbose /usr/bin x=1 grep echo "$1"
+	&& echo x=1 readonly -eu done -eu done --verbose readonly
+cd x=1 then then | sed test sed done done test awk 2>/dev/null
+	--verbose --verbose done test awk "$1" 'quoted text'
+printf --verbose sed grep --verbose
+	$(pwd) $(pwd) readonly cd sed -eu -eu 'quoted text'
+		| awk echo cd then "$@"
+	printf 2>/dev/null sed $(pwd) 2>/dev/null -eu readonly cd export ${HOME} test
+	"$@" ${HOME} then sed 'quoted text' /usr/bin
+		echo && awk | | grep | "$@" && -eu then grep x=1 sed printf
+		| ${HOME} readonly grep echo -eu readonly grep then /usr/bin grep "$1" sed echo
+	$(pwd) grep awk echo /usr/bin sed 2>/dev/null $(pwd)
+	$(pwd) ${HOME} 2>/dev/null local "$@" "$@" 2>/dev/null
+	2>/dev/null 'quoted text' awk --verbose printf readonly test export
+		done then ${HOME} cd ${HOME} --verbose
+	"$1" echo echo done echo $(pwd) then 'quoted text'
+		--verbose | cd "$@" 'quoted text'
+"$1" then readonly printf | "$@" /usr/bin test 'quoted text' sed
+		printf 2>/dev/null export "$1" "$@" grep x=1 ${HOME} echo local &&
+	--verbose --verbose then echo "$1" then printf "$1" /usr/bin
+		2>/dev/null "$1" printf test awk -eu printf /usr/bin &&
+cd done export 2>/dev/null $(pwd) -eu readonly
+	grep /usr/bin x=1 -eu test export ${HOME} export sed test &&
+		&& grep "$1" x=1 done ${HOME} "$@" /usr/bin printf printf
+		$(pwd) local echo done export "$1" test 2>/dev/null 2>/dev/null |
+		export /usr/bin x=1 grep local printf $(pwd) 2>/dev/null awk
+| "$1" | --verbose cd test export grep awk
+		${HOME} export 2>/dev/null local --verbose x=1
+		'quoted text' "$1" echo -eu sed "$1" --verbose echo
+	readonly "$1" $(pwd) $(pwd) sed ${HOME} ${HOME} /usr/bin local --verbose
+		/usr/bin cd && ${HOME} readonly /usr/bin 2>/dev/null
+test /usr/bin local 2>/dev/null | 'quoted text' --verbose grep cd "$1"
+echo | awk x=1 sed awk "$@" echo cd "$1" $(pwd) then test 2>/dev/null sed grep
+		done "$@" echo printf grep -eu then echo then && $(pwd) "$1" && echo
+		grep test readonly local sed && export "$1" && echo | then printf awk readonly
+--verbose --verbose ${HOME} ${HOME} readonly --verbose local
+${HOME} "$@" /usr/bin local
+sed && sed 'quoted text' -eu $(pwd) export x=1 sed | cd test cd
+/usr/bin grep done x=1 test test "$1" test 'quoted text'
+readonly cd --verbose test $(pwd) 'quoted text' "$@" x=1 &&
+	&& grep readonly done echo -eu "$1" cd 2>/dev/null 2>/dev/null
+readonly test "$1" | export 'quoted text' ${HOME} "$@"
+	--verbose 2>/dev/null | export $(pwd) readonly /usr/bin cd && readonly ${HOME}
+	cd && then test 2>/dev/null done $(pwd)
+2>/dev/null ${HOME} /usr/bin readonly --verbose 2>/dev/null x=1
+	&& --verbose readonly then ${HOME} | sed local done && grep ${HOME}
+$(pwd) test export awk local
+sed test "$@" 2>/dev/null awk then x=1 --verbose ${HOME} test cd export
+	export | ${HOME} /usr/bin done done done x=1 done && "$1" then | ${HOME}
+		sed "$@" cd local ${HOME}
+${HOME} echo "$@" grep
+		"$1" && && --verbose | ${HOME} --verbose 'quoted text'
+| awk ${HOME} test grep | | then
+	| sed $(pwd) readonly test
+'quoted text' echo --verbose
+&& /usr/bin grep test "$@" echo $(pwd) grep /usr/bin
+		x=1 export | ${HOME} echo grep readonly sed test awk 2>/dev/null -eu then
+	done export "$1" printf && done | -eu test sed "$@" sed | sed test 2>/dev/null
+	/usr/bin | readonly "$1" && "$1" export cd x=1 awk grep local
+		echo 'quoted text' local test | sed --verbose then "$@"
+		cd then 'quoted text' /usr/bin --verbose | export sed x=1 --verbose
+		sed local sed cd $(pwd) /usr/bin "$@" x=1 done export /usr/bin
+cd 'quoted text' "$@" --verbose
+		then grep then printf "$1" "$1" /usr/bin export && "$@" test local grep
+		"$1" 2>/dev/null grep x=1 ${HOME} echo && && export 2>/dev/null
+echo | sed $(pwd) cd export -eu ${HOME} awk "$@" && 'quoted text' then "$@" -eu
+printf echo | x=1 cd done export
+		/usr/bin grep && 2>/dev/null
+awk done $(pwd) -eu echo readonly x=1 echo local readonly
+	2>/dev/null done x=1 awk cd "$1" x=1 | ${HOME} | readonly
+	printf cd 2>/dev/null --verbose && cd -eu then x=1 $(pwd) "$@" test
+	'quoted text' test echo 2>/dev/null
+		cd ${HOME} sed cd local sed sed
+	x=1 2>/dev/null grep done x=1 local 'quoted text'
+	echo readonly printf "$@" local awk readonly "$@" echo -eu awk
+	'quoted text' | /usr/bin ${HOME} | awk "$1" awk 'quoted text'
+	echo awk 'quoted text'
+export | printf awk printf "$@" echo
+		"$1" | done ${HOME} "$1" cd echo -eu && local /usr/bin
+	--verbose test done --verbose test $(pwd)
+		$(pwd) --verbose "$1" 'quoted text' x=1 done printf 'quoted text'
+	"$1" ${HOME} /usr/bin sed export grep $(pwd)
+readonly grep then /usr/bin "$1" /usr/bin 2>/dev/null --verbose readonly test test
+/usr/bin | "$@" done 2>/dev/null awk local 'quoted text' "$1" 'quoted text'
+		x=1 "$@" cd local echo --verbose cd "$1" then cd test 'quoted text'
+		-eu 2>/dev/null readonly local printf x=1 -eu -eu done done /usr/bin
+		awk && --verbose done then then awk $(pwd) --verbose "$1" cd -eu local sed
+		$(pwd) 'quoted text' then ${HOME} x=1 printf
+--verbose && printf test grep && -eu 2>/dev/null $(pwd)
+		'quoted text' "$@" done "$1" --verbose 2>/dev/null $(pwd)
+--verbose ${HOME} && awk /usr/bin echo echo
+	awk && $(pwd) 'quoted text' cd $(pwd) ${HOME} ${HOME} 'quoted text' x=1 "$1" export
+		"$@" "$1" local --verbose ${HOME} ${HOME} grep local --verbose
+	awk grep && echo "$1" "$@" echo ${HOME} export x=1 echo cd -eu echo echo awk
+		awk test cd 'quoted text' awk done local 2>/dev/null test 2>/dev/null
+		${HOME} local --verbose x=1
+		2>/dev/null | && cd | awk cd "$@" "$@" then | -eu grep
+cd test x=1 /usr/bin done && cd awk "$@" && 2>/dev/null printf
+		readonly | awk 'quoted text' $(pwd) $(pwd) echo x=1 | test grep
+	grep "$1" 2>/dev/null grep -eu ${HOME} export
+		readonly 'quoted text' ${HOME} 'quoted text'
+	"$1" && test sed "$1" echo "$@" test --verbose printf export --verbose then
+	awk ${HOME} $(pwd) test
+	'quoted text' x=1 cd "$1" awk echo
+		-eu $(pwd) 2>/dev/null awk awk printf export export test
+	'quoted text' "$@" done /usr/bin printf then
+&& ${HOME} readonly x=1 $(pwd) --verbose
+-eu cd /usr/bin x=1 test awk && "$@" &&
+-eu export x=1 local | && printf "$1"
+done /usr/bin printf --verbose export /usr/bin 2>/dev/null
+&& ${HOME} 'quoted text' 2>/dev/null 2>/dev/null x=1 --verbose
+-eu /usr/bin sed 'quoted text' "$@"
+| done 2>/dev/null x=1 "$1" | |
+		"$@" "$@" x=1 awk done "$1" --verbose grep cd "$@" export
+grep awk echo | && printf echo 2>/dev/null
+		printf test readonly sed
+		test grep readonly 'quoted text'
+	'quoted text' then printf x=1 x=1 readonly printf | awk
+		grep readonly awk cd cd --verbose
+awk echo | local /usr/bin &&
+-eu readonly ${HOME} local sed sed grep ${HOME}
+	cd $(pwd) readonly echo
+	then awk cd 'quoted text' test x=1
+		readonly local done readonly done x=1 export awk -eu -eu | 'quoted text' readonly
+		export done local grep done then done -eu "$1"
+export echo done done test export -eu printf readonly grep
+printf done test cd then
+then echo test then -eu awk --verbose echo done then
+		-eu && x=1 /usr/bin export awk -eu grep grep --verbose export sed /usr/bin
+		printf "$@" test -eu cd ${HOME} --verbose then ${HOME} export done "$@" export
+test echo | test sed done /usr/bin
+	"$@" x=1 then cd /usr/bin echo
+		--verbose 2>/dev/null && "$1" test
+--verbose x=1 2>/dev/null -eu done ${HOME}
+	local 2>/dev/null "$@" done
+	printf -eu done sed 'quoted text' done sed local local $(pwd) "$@"
+$(pwd) 2>/dev/null sed "$@" | && && readonly grep awk && export 2>/dev/null
+		done awk "$@" x=1 awk export test readonly
+printf --verbose echo readonly ${HOME}
+		x=1 echo "$1" test | then && $(pwd) "$@" cd then
+	readonly awk $(pwd) ${HOME} export --verbose ${HOME} cd awk awk local done
+	awk 2>/dev/null x=1 printf cd "$1" export awk test grep x=1 printf done sed
+		done sed 2>/dev/null -eu 2>/dev/null grep 2>/dev/null test x=1 awk done
+	"$1" -eu /usr/bin x=1 echo readonly printf $(pwd) --verbose -eu
+| 'quoted text' 'quoted text' test
+		printf local then local
+-eu -eu "$@" $(pwd) export $(pwd) "$1" awk --verbose
+		-eu readonly sed --verbose test -eu x=1 local /usr/bin -eu cd cd $(pwd)
+		then 'quoted text' x=1 awk /usr/bin grep readonly "$1" printf ${HOME}
+	readonly ${HOME} readonly echo 'quoted text' cd grep awk 'quoted text'
+	'quoted text' 'quoted text' "$@" 'quoted text' test readonly
+	local local awk local "$1" "$1" then grep printf $(pwd) $(pwd)
+		printf | grep 'quoted text' && x=1 "$@" test readonly
+$(pwd) readonly done /usr/bin grep awk cd ${HOME} "$1" cd done echo x=1
+		awk x=1 echo local && "$@" printf export printf && printf x=1 2>/dev/null
+	-eu export "$1" -eu "$@" 2>/dev/null /usr/bin 2>/dev/null
+x=1 | "$1" ${HOME} readonly
+printf then local 2>/dev/null done 2>/dev/null 'quoted text' printf sed
+		| "$1" | cd --verbose cd printf ${HOME} echo
+	--verbose x=1 readonly awk /usr/bin test && && ${HOME} awk then 'quoted text'
+	sed && done /usr/bin | ${HOME}
+	&& awk && done test "$@" local -eu
+	readonly export ${HOME} && /usr/bin then done cd 2>/dev/null && awk x=1
+test sed then awk export -eu test
+local export | cd echo cd then done
+printf done grep "$@" echo && "$1" x=1 done | $(pwd) "$@" ${HOME}
+then cd then | export sed awk done local echo "$1" x=1
+	test done test echo sed
+x=1 done x=1 awk then x=1 $(pwd)
+		export "$1" grep sed sed "$@" sed && /usr/bin grep "$@" printf then ${HOME}
+	test done echo /usr/bin $(pwd) ${HOME} sed ${HOME} test
+		then awk grep "$1" printf $(pwd) grep grep printf cd grep
+		local | /usr/bin && cd cd readonly && sed test then 'quoted text'
+		"$1" | test --verbose export ${HOME} 2>/dev/null cd done |
+	${HOME} local /usr/bin done && local local ${HOME} ${HOME} echo
+		awk printf "$@" | -eu grep test 2>/dev/null && grep export cd
+	-eu 2>/dev/null ${HOME} --verbose grep $(pwd) "$@"
+	$(pwd) sed -eu echo grep echo /usr/bin | ${HOME}
+	local "$@" export | ${HOME} "$1" cd local /usr/bin
+	x=1 sed then grep 'quoted text' ${HOME} ${HOME} sed test 2>/dev/null
+	awk x=1 x=1 --verbose test
+		x=1 cd cd cd sed export
+	| /usr/bin ${HOME} local export test "$1" readonly
+echo $(pwd) 'quoted text' && test printf | echo $(pwd) -eu awk readonly
+		${HOME} && | /usr/bin printf echo export done
+cd | done echo 2>/dev/null echo && cd "$1"
+	readonly sed printf 2>/dev/null
+	grep x=1 /usr/bin grep | --verbose 'quoted text' "$@"
+2>/dev/null test test 2>/dev/null
+'quoted text' --verbose grep
+	readonly then then test then ${HOME} 2>/dev/null
+awk sed && echo test --verbose done readonly echo -eu 'quoted text'
+	done export "$1" printf 'quoted text' "$1" printf printf
+export local local && done local readonly
+	echo grep "$1" -eu export ${HOME} /usr/bin | grep done 'quoted text' 2>/dev/null
+		cd /usr/bin "$1" sed 2>/dev/null && && "$1" readonly 'quoted text' --verbose
+		"$1" printf readonly readonly ${HOME} awk then /usr/bin printf
+cd sed --verbose done && && ${HOME}
+x=1 -eu | printf 2>/dev/null /usr/bin local 2>/dev/null
+		echo cd readonly sed "$1" export
+sed export 'quoted text' 'quoted text' readonly awk $(pwd)
+grep local printf && "$@"
+	"$1" x=1 -eu --verbose
+		"$1" && 'quoted text' then x=1 readonly grep 'quoted text' "$1" $(pwd) cd -eu
+${HOME} sed sed awk 2>/dev/null --verbose cd 2>/dev/null awk done grep | done
+	sed ${HOME} export echo readonly | printf
+		done && sed done awk awk --verbose -eu done then "$@"
+		2>/dev/null done "$@" /usr/bin echo "$1" echo
+	x=1 printf $(pwd) x=1 "$@" printf echo x=1 grep echo | /usr/bin
+		export local && cd export "$@" -eu grep local test $(pwd) done x=1
+2>/dev/null done | sed then cd &&
+		/usr/bin done --verbose done $(pwd) test /usr/bin done "$@" done "$1" && local test
+		${HOME} printf printf grep $(pwd)
+then local --verbose done export awk 'quoted text' cd echo 2>/dev/null awk local
+		${HOME} $(pwd) local "$1" | grep 2>/dev/null readonly local
+		-eu export local "$1" readonly "$1" awk 2>/dev/null
+&& 'quoted text' --verbose echo ${HOME} export --verbose && grep
+	2>/dev/null x=1 cd 2>/dev/null export then 2>/dev/null local then readonly /usr/bin
+		/usr/bin x=1 ${HOME} 'quoted text' printf cd -eu "$1" "$1" 'quoted text'
+	then 2>/dev/null "$1" awk echo /usr/bin --verbose sed done /usr/bin && "$@" readonly
+	-eu -eu "$@" readonly readonly
+	done readonly then $(pwd) local awk done cd "$1" ${HOME}
+	"$1" echo done then echo /usr/bin sed done local
+echo printf /usr/bin x=1 && printf
+	&& grep --verbose test $(pwd) local $(pwd) --verbose printf
+cd /usr/bin --verbose grep "$@" -eu --verbose then 'quoted text'
+	${HOME} ${HOME} test export sed then "$@" echo awk local readonly
+		printf 'quoted text' /usr/bin done
+		cd grep sed awk /usr/bin
+		$(pwd) grep "$@" | x=1 --verbose echo ${HOME} && readonly then ${HOME}
+	'quoted text' awk grep printf
+		| printf --verbose grep -eu echo local $(pwd) "$@" "$@" grep readonly
+		| x=1 "$@" sed /usr/bin && ${HOME} grep export printf /usr/bin printf
+	awk -eu -eu "$@" $(pwd) cd sed readonly
+		-eu 2>/dev/null sed ${HOME} 2>/dev/null 'quoted text'
+	-eu -eu -eu test readonly echo grep 'quoted text' export printf done --verbose
+	readonly --verbose && local
+		2>/dev/null "$@" ${HOME} printf ${HOME} cd sed
+		done 'quoted text' printf "$@" sed then 2>/dev/null
+		test readonly echo awk echo
+grep awk && | "$1" echo grep && readonly readonly
+	2>/dev/null --verbose x=1 x=1 | echo then --verbose
+		done | echo cd && $(pwd) grep --verbose -eu 'quoted text'
+--verbose export local done "$@" export "$@" --verbose
+	done grep local $(pwd) && && export test grep --verbose cd x=1 local "$1"
+		&& readonly "$1" local "$@" awk -eu && sed done
+	--verbose echo -eu "$1" done ${HOME} 2>/dev/null export cd "$1" done sed "$1"
+printf local -eu printf ${HOME} sed x=1 cd ${HOME} export grep test $(pwd)
+		${HOME} /usr/bin echo done | "$1" | then then /usr/bin done awk cd --verbose
+		-eu $(pwd) 'quoted text' cd
+test test "$@" printf | x=1 cd x=1 --verbose then
+		local x=1 readonly grep 'quoted text' -eu && cd "$1" readonly -eu x=1 readonly
+		2>/dev/null ${HOME} -eu
+		$(pwd) --verbose cd x=1 2>/dev/null echo --verbose --verbose
+	printf done test | /usr/bin 2>/dev/null printf done sed /usr/bin done export then
+	cd 2>/dev/null local cd local "$@" local printf && && cd | awk "$1"
+	done sed $(pwd) 'quoted text' then export then ${HOME}
+grep $(pwd) test cd cd && readonly "$1" "$1" awk test sed echo printf printf printf
+	-eu 2>/dev/null cd 2>/dev/null -eu
+		test readonly sed export test test grep "$1" -eu readonly | "$1"
+	-eu && grep grep ${HOME} ${HOME} x=1 readonly echo "$@" 2>/dev/null test $(pwd)
+		sed cd ${HOME} then readonly grep 'quoted text'
+sed && $(pwd) readonly readonly cd /usr/bin
+&& then x=1 ${HOME} ${HOME} ${HOME} awk sed "$1" awk sed then 'quoted text'
+2>/dev/null x=1 /usr/bin printf test ${HOME} echo done grep $(pwd)
+"$1" ${HOME} grep readonly export then --verbose then local /usr/bin "$@" cd | export
+		done sed "$@" sed "$1" done && then export printf --verbose x=1 x=1
+	local -eu readonly 2>/dev/null echo $(pwd) export
+		test ${HOME} && cd ${HOME} test printf cd test $(pwd) printf x=1 ${HOME}
+"$1" grep 2>/dev/null echo awk -eu ${HOME}
+	/usr/bin "$1" sed ${HOME} test /usr/bin "$@"
+		awk awk echo sed sed
+	2>/dev/null 2>/dev/null 'quoted text'
+		2>/dev/null local && test awk --verbose local /usr/bin export
+	x=1 local export "$@" x=1 done "$@" 'quoted text'
+	-eu awk 2>/dev/null 2>/dev/null $(pwd) /usr/bin cd export "$@"
+		x=1 grep && --verbose && 'quoted text' --verbose "$1"
+local -eu printf test x=1 ${HOME} grep cd -eu --verbose x=1 $(pwd)
+"$@" readonly export sed then echo echo cd 2>/dev/null | "$@" 2>/dev/null awk
+	done 2>/dev/null then ${HOME} && done | awk x=1
+		export x=1 "$@" sed 2>/dev/null
+	${HOME} $(pwd) 2>/dev/null echo sed export printf local test local
+x=1 test test && x=1 -eu
+	"$@" /usr/bin sed ${HOME} then
+readonly ${HOME} export done --verbose cd $(pwd) awk | /usr/bin sed done ${HOME}
+		/usr/bin -eu | /usr/bin ${HOME} | then 'quoted text' -eu
+	| cd awk readonly && grep && | x=1 --verbose then && $(pwd) "$1"
+grep 2>/dev/null $(pwd) then grep export
+"$@" /usr/bin sed export export
+		'quoted text' export /usr/bin test local $(pwd)
+	/usr/bin grep done grep 'quoted text' cd /usr/bin -eu ${HOME} $(pwd)
+	x=1 && sed | echo ${HOME} local test $(pwd) printf grep done echo 'quoted text'
+		/usr/bin grep --verbose ${HOME} local 2>/dev/null printf -eu "$1"
+	done "$@" then then "$1" $(pwd) -eu "$@" $(pwd) cd 'quoted text' local
+		test x=1 'quoted text' then "$1" then && ${HOME} "$1" sed --verbose then
+		/usr/bin test /usr/bin grep
+		&& /usr/bin local -eu awk export
+echo awk "$1" done && cd awk done
+export "$@" cd awk 'quoted text' then
+		grep | test export grep
+"$@" local | -eu && && awk
+	-eu | 'quoted text' cd -eu $(pwd) && "$@" --verbose && echo then ${HOME}
+	'quoted text' ${HOME} awk $(pwd) | | awk 'quoted text' --verbose done done
+	'quoted text' local sed readonly sed x=1 x=1 grep | export "$@" sed printf export
+${HOME} then /usr/bin ${HOME}
+| -eu -eu 'quoted text' readonly ${HOME}
+		sed export /usr/bin export -eu | 2>/dev/null
+&& && then local -eu readonly sed then then awk export --verbose
+	echo sed then "$@" x=1 then ${HOME} -eu ${HOME}
+	local x=1 2>/dev/null ${HOME}
+${HOME} x=1 2>/dev/null
+printf x=1 sed grep | 2>/dev/null cd "$@" sed then done local done then |
+then cd local ${HOME} $(pwd) readonly sed --verbose
+	&& done "$@" "$1" export
+x=1 "$@" export --verbose sed local printf printf then
+		awk 'quoted text' && awk && ${HOME} | "$@" awk 'quoted text'
+	"$1" printf echo 'quoted text' ${HOME} 'quoted text' printf
+	then "$1" ${HOME} cd test printf && printf cd grep "$@" "$@" test
+	local "$1" test test readonly then local readonly export
+grep sed "$@" --verbose sed cd 2>/dev/null sed export
+	"$1" export grep $(pwd) 'quoted text' printf -eu grep "$1" /usr/bin "$1" --verbose
+		cd --verbose x=1 done "$@"
+		cd printf grep 'quoted text' printf 2>/dev/null | cd then --verbose awk "$@" local
+--verbose sed $(pwd) 2>/dev/null ${HOME} export done
+	test done done grep done then && --verbose then cd done cd sed cd awk readonly
+	export cd 'quoted text' cd && readonly ${HOME} export
+		printf test done --verbose /usr/bin
+/usr/bin ${HOME} && local /usr/bin --verbose --verbose then
+	/usr/bin /usr/bin sed echo | export --verbose "$1" -eu x=1 readonly
+	${HOME} then | | 'quoted text'
+		local 'quoted text' grep export ${HOME} "$1" x=1 readonly
+"$@" "$@" awk printf -eu test sed "$1" 'quoted text' $(pwd) test
+		| && echo test echo "$1" |
+		test ${HOME} -eu test | export 2>/dev/null done "$@" "$1" grep "$@"
+		grep "$1" local && /usr/bin 2>/dev/null
+		echo local readonly --verbose
+		then test echo 'quoted text' "$@" 2>/dev/null test "$@" -eu | $(pwd)
+		awk then -eu ${HOME} echo local -eu "$1" ${HOME}
+sed | $(pwd) grep && -eu cd echo export
+		readonly export "$@" x=1
+	"$1" awk "$1" awk -eu && "$@" /usr/bin local cd test
+&& -eu -eu 2>/dev/null sed
+	done "$@" x=1 awk | done sed echo done readonly ${HOME}
+"$1" 2>/dev/null awk "$@"
+	&& ${HOME} test ${HOME} awk readonly echo local $(pwd) ${HOME} readonly
+readonly && --verbose sed
+| && sed grep then awk echo x=1 --verbose --verbose /usr/bin x=1 --verbose
+	readonly grep cd /usr/bin
+		/usr/bin cd && export sed &&
+		local test printf readonly $(pwd) 2>/dev/null
+"$@" && x=1 echo -eu grep done done printf grep 'quoted text' "$1"
+printf cd awk 2>/dev/null /usr/bin 2>/dev/null test | grep && cd
+		$(pwd) "$@" sed export -eu "$@" done
+		export grep grep 2>/dev/null | cd ${HOME} 2>/dev/null 2>/dev/null
+$(pwd) echo export cd printf /usr/bin
+	$(pwd) sed grep /usr/bin ${HOME} /usr/bin && cd readonly sed cd $(pwd)
+	printf && sed "$@" "$@" |
+		local "$@" 2>/dev/null /usr/bin
+		grep x=1 then 2>/dev/null
+	printf "$1" && /usr/bin echo cd $(pwd) -eu 'quoted text'
+	| x=1 local -eu 2>/dev/null $(pwd) x=1 cd grep grep
+${HOME} grep readonly
+	local test 'quoted text'
+		echo done -eu cd | -eu done "$@" /usr/bin awk "$@" 'quoted text' test
+		done --verbose -eu readonly done sed local "$@" "$@" "$1" --verbose printf
+	-eu sed then local -eu test
+	sed awk /usr/bin "$@" done test
+	"$@" readonly 2>/dev/null -eu "$@" readonly
+sed then printf "$1" then awk 'quoted text' ${HOME} printf cd
+	/usr/bin echo sed --verbose 'quoted text'
+x=1 test -eu cd -eu done grep
+awk done "$1" cd 'quoted text' /usr/bin
+		&& done x=1 $(pwd) --verbose x=1 grep test
+sed && readonly grep ${HOME} 2>/dev/null then printf ${HOME} test --verbose
+		&& printf $(pwd) then printf ${HOME} then --verbose awk x=1 grep done
+		then test done x=1 -eu local grep awk /usr/bin then
+	readonly x=1 'quoted text' 'quoted text' export
+	export x=1 test $(pwd) echo local $(pwd) -eu
+	x=1 2>/dev/null readonly
+	x=1 sed 'quoted text' --verbose sed local /usr/bin export 2>/dev/null "$1" cd
+		/usr/bin 'quoted text' sed awk echo echo done | x=1 && x=1 ${HOME} x=1 local /usr/bin
+	/usr/bin awk done echo cd awk awk
+		2>/dev/null awk -eu | -eu /usr/bin | test readonly && cd "$@" -eu then
+	then $(pwd) | readonly export test local x=1 -eu $(pwd) ${HOME} "$@" --verbose
+/usr/bin awk grep | ${HOME} test /usr/bin
+test local cd grep 2>/dev/null --verbose
+/usr/bin "$@" cd export local readonly x=1 x=1 --verbose "$1" readonly
+echo | printf x=1 done export test 'quoted text'
+		2>/dev/null "$1" --verbose
+		"$@" /usr/bin /usr/bin --verbose 2>/dev/null --verbose && $(pwd)
+		grep cd then echo awk sed "$1" local 2>/dev/null test
+awk | 2>/dev/null 2>/dev/null -eu done then done x=1 "$@" | && echo "$@" done
+		'quoted text' | cd -eu 2>/dev/null -eu done
+	"$1" grep "$@" then sed --verbose
+$(pwd) readonly x=1 printf /usr/bin
+		| | done readonly 'quoted text' local local x=1
+		x=1 x=1 2>/dev/null printf grep $(pwd) "$@" x=1 sed test -eu x=1 "$@"
+$(pwd) awk x=1 awk then x=1 then "$1" printf
+awk echo echo -eu printf "$1" done 2>/dev/null
+		/usr/bin $(pwd) readonly printf export -eu sed printf && readonly echo done sed
+	grep x=1 $(pwd) "$1" 2>/dev/null
+'quoted text' /usr/bin --verbose $(pwd) $(pwd) "$@" --verbose sed
+	&& echo "$1" && && printf x=1 --verbose && awk awk x=1 sed then
+		x=1 $(pwd) test test "$1" 'quoted text' awk then /usr/bin 'quoted text' x=1 echo
+printf "$@" cd local then "$@" then | sed local "$1" export ${HOME}
+"$1" cd ${HOME} done sed $(pwd) | sed then && x=1 | local cd test ${HOME} export
+$(pwd) 'quoted text' printf
+-eu $(pwd) readonly sed "$@" sed && 2>/dev/null
+		'quoted text' readonly export $(pwd) readonly ${HOME}
+		--verbose "$@" -eu awk -eu | printf --verbose
+		/usr/bin 2>/dev/null cd 2>/dev/null -eu "$1" | awk then && $(pwd) 'quoted text'
+awk $(pwd) x=1 x=1 echo then export "$1" --verbose awk local 2>/dev/null printf
+2>/dev/null 2>/dev/null export
+		"$@" test sed 'quoted text' grep export export
+		--verbose "$@" $(pwd) then && 2>/dev/null
+	local echo "$1" cd then then -eu --verbose $(pwd) "$1" 'quoted text'
+	echo "$@" then "$1" 2>/dev/null | export test 2>/dev/null -eu local readonly
+	"$@" "$1" echo awk echo echo readonly 2>/dev/null /usr/bin "$@" $(pwd) $(pwd)
+	&& x=1 $(pwd) $(pwd) x=1 grep grep 'quoted text' grep -eu then echo
+	cd && printf $(pwd) "$@"
+		-eu ${HOME} | -eu then "$1" --verbose
+&& "$1" --verbose printf x=1 "$@" cd
+		/usr/bin 'quoted text' -eu echo 2>/dev/null --verbose "$@" readonly
+	local | "$@" -eu ${HOME} sed 'quoted text' x=1 echo done x=1 2>/dev/null /usr/bin
+printf x=1 | 2>/dev/null 2>/dev/null readonly x=1
+		grep ${HOME} x=1 awk ${HOME} printf "$@" export test
+		grep /usr/bin $(pwd) -eu then
+	"$@" 'quoted text' local --verbose "$@" grep "$1" && then
+		"$@" "$@" 'quoted text' $(pwd) grep | local 2>/dev/null /usr/bin
+	grep --verbose 'quoted text' x=1 done local | 2>/dev/null "$@"
+		done | 2>/dev/null x=1 readonly printf /usr/bin
+	local cd awk grep x=1 grep 2>/dev/null
+		&& $(pwd) "$@" "$1" && "$@" done $(pwd) export
+	x=1 readonly 'quoted text' echo export
+then awk local 2>/dev/null "$@" "$@" awk then
+		"$1" printf printf x=1 "$1" 2>/dev/null | cd test "$1" test | test
+	echo && printf export -eu local done $(pwd) awk
+2>/dev/null sed test then /usr/bin $(pwd) "$@" printf /usr/bin 'quoted text'
+		printf cd -eu && 2>/dev/null test ${HOME} -eu
+	| -eu export --verbose sed 'quoted text' echo && readonly -eu test ${HOME}
+	/usr/bin then --verbose && then $(pwd) export $(pwd) && /usr/bin
+		2>/dev/null 2>/dev/null local ${HOME} then
+export | | awk echo sed ${HOME} | "$1" export
+	$(pwd) && then cd sed export export grep done | readonly local
+		local local test awk grep local printf | --verbose 'quoted text'
+		readonly --verbose /usr/bin "$@" then test | then ${HOME} ${HOME} printf
+		local grep && export awk local sed && printf grep 2>/dev/null
+	| "$1" && done awk echo ${HOME} | then export local 2>/dev/null local x=1 echo
+readonly | "$1" awk export grep printf cd local x=1 x=1 echo
+	done local /usr/bin local echo local
+2>/dev/null 'quoted text' printf "$@" printf 'quoted text'
+		awk export "$1" awk --verbose
+	awk local $(pwd) "$@" -eu /usr/bin $(pwd)
+'quoted text' $(pwd) printf 2>/dev/null $(pwd) 2>/dev/null
+		'quoted text' 'quoted text' -eu && /usr/bin ${HOME} x=1 --verbose
+| cd awk export echo printf then export && ${HOME} -eu --verbose ${HOME} x=1
+		readonly printf $(pwd) /usr/bin
+grep 2>/dev/null then done
+		"$@" 2>/dev/null "$1" 2>/dev/null "$@" done &&
+	export then 'quoted text' echo done 'quoted text' $(pwd) x=1 /usr/bin
+	/usr/bin && $(pwd) done grep cd printf readonly awk awk awk && 'quoted text'
+test local | | done 2>/dev/null 'quoted text'
+x=1 readonly done sed -eu x=1 done grep "$1" 'quoted text' --verbose
+"$1" awk /usr/bin grep "$@" grep && && -eu local
+	echo --verbose printf echo && test
+		&& $(pwd) 2>/dev/null ${HOME} /usr/bin
+		echo | readonly sed | local
+	--verbose -eu $(pwd) x=1 then
+| local sed then test ${HOME} printf printf test sed printf ${HOME} /usr/bin
+	"$@" && local "$@" export --verbose echo test local 2>/dev/null 2>/dev/null
+test cd x=1 test readonly printf "$1" printf printf
+		--verbose "$1" then /usr/bin cd "$@" &&
+cd 'quoted text' export readonly "$@" cd x=1 2>/dev/null readonly /usr/bin test
+		awk 'quoted text' ${HOME} | export local "$1" "$1" "$@" /usr/bin
+	grep ${HOME} /usr/bin
+then "$@" then echo sed -eu
+	echo ${HOME} -eu | readonly
+		2>/dev/null ${HOME} | sed cd printf && 'quoted text' local ${HOME} ${HOME}
+		| "$@" && grep $(pwd) then && echo export | grep
+	printf --verbose then sed | done $(pwd) && local
+printf local local echo echo readonly
+/usr/bin awk "$1" cd 2>/dev/null && cd && echo sed 2>/dev/null "$@" echo grep
+	| local sed local -eu awk then done echo sed local cd
+'quoted text' grep 2>/dev/null sed grep -eu $(pwd) ${HOME} 'quoted text'
+	local local x=1 printf ${HOME} "$@" && && cd 'quoted text' "$1" cd
+		"$1" export sed then cd printf -eu awk ${HOME} ${HOME}
+		sed | "$@" 'quoted text' | $(pwd) printf
+		${HOME} $(pwd) x=1 printf readonly "$1" sed
+		test readonly done | readonly cd && export readonly
+		| "$1" 2>/dev/null then local then
+2>/dev/null ${HOME} local && printf
+	printf export local --verbose "$@" printf $(pwd) then
+	awk 'quoted text' && awk done readonly readonly && printf sed "$@"
+grep "$@" "$@" export ${HOME} test
+/usr/bin $(pwd) 2>/dev/null export then done | 2>/dev/null "$@" then -eu local
+	"$1" echo local sed &&
+	test awk readonly ${HOME} echo printf
+sed readonly awk -eu grep awk /usr/bin grep echo
+done 'quoted text' "$@"
+| 'quoted text' sed && readonly done x=1 /usr/bin /usr/bin 2>/dev/null
+		x=1 $(pwd) test done && 'quoted text' ${HOME} sed ${HOME}
+-eu "$1" | local printf echo test echo cd
+		test test 'quoted text' grep export 2>/dev/null
+x=1 | $(pwd) printf test
+$(pwd) printf done && "$@"
+		awk | awk done echo "$1" local 'quoted text' 2>/dev/null grep 'quoted text'
+/usr/bin awk readonly printf echo test 2>/dev/null
+printf "$1" 'quoted text' readonly 'quoted text' /usr/bin $(pwd)
+	grep $(pwd) -eu | readonly x=1 --verbose cd && /usr/bin awk -eu cd -eu
+test --verbose sed /usr/bin | done ${HOME} 'quoted text'
+	'quoted text' -eu 'quoted text' 'quoted text' awk $(pwd) --verbose 2>/dev/null
+	test $(pwd) --verbose
+	then sed | 'quoted text' 2>/dev/null
+		sed cd x=1 && then cd then test /usr/bin | export
+done readonly echo readonly --verbose
+cd ${HOME} printf && cd echo -eu test grep local && then grep test /usr/bin
+		readonly 'quoted text' $(pwd) export done then grep $(pwd) local readonly done
+	cd echo /usr/bin 2>/dev/null "$@"
+	sed && $(pwd) | test local printf done readonly readonly
+	/usr/bin echo | test ${HOME} /usr/bin echo
+awk local 2>/dev/null local x=1 printf 'quoted text'
+		"$@" && echo grep $(pwd) readonly echo
+	awk echo grep sed printf ${HOME} && cd readonly echo 'quoted text' ${HOME}
+	x=1 && then local /usr/bin
+readonly "$1" echo && $(pwd) /usr/bin echo done $(pwd) done printf test export ${HOME}
+-eu "$@" ${HOME} sed ${HOME}
+	-eu echo $(pwd) x=1 test readonly printf ${HOME} grep &&
+	done $(pwd) "$@" /usr/bin done echo 2>/dev/null /usr/bin awk cd 'quoted text'
+	readonly cd ${HOME} -eu "$@" "$1" readonly /usr/bin 2>/dev/null -eu
+	local -eu "$@" local export && && /usr/bin ${HOME} awk | /usr/bin
+		cd 2>/dev/null ${HOME} | test echo /usr/bin $(pwd) then "$@"
+	'quoted text' "$@" --verbose readonly "$1" readonly
+printf printf "$@" cd "$@" readonly |
+		echo done readonly $(pwd) then cd awk awk echo "$1" printf
+	test echo ${HOME} /usr/bin -eu |
+&& && awk $(pwd) "$@" "$@" /usr/bin
+		awk grep cd /usr/bin readonly echo && | done awk then
+local then "$1" 2>/dev/null /usr/bin ${HOME}
+--verbose echo test printf
+local then "$1" /usr/bin && sed echo done -eu --verbose grep sed cd done awk "$@"
+		sed 2>/dev/null -eu | then test && sed echo grep /usr/bin x=1 2>/dev/null
+		sed "$@" | export cd /usr/bin awk then printf echo awk
+readonly "$1" --verbose 'quoted text' printf then ${HOME} readonly
+	test 'quoted text' 'quoted text' "$1" grep $(pwd)
+| then && 2>/dev/null printf -eu "$@" x=1 readonly awk
+	grep sed -eu "$1" | /usr/bin 'quoted text' cd "$@" export --verbose sed echo
+		local /usr/bin "$@" && local
+-eu ${HOME} "$@" /usr/bin && -eu -eu readonly done 2>/dev/null /usr/bin
+		awk 'quoted text' -eu export test
+-eu local readonly export --verbose done 'quoted text' test
+2>/dev/null readonly
+| ${HOME} ${HOME} -eu ${HOME} |
+		echo readonly grep -eu x=1 -eu readonly sed test "$@" x=1 $(pwd) "$@"
+	"$1" export awk export printf cd test awk cd -eu export test
+	then 2>/dev/null --verbose grep 2>/dev/null local sed done readonly
+		grep | ${HOME} 2>/dev/null -eu x=1 2>/dev/null echo test then sed
+		$(pwd) export $(pwd) sed cd /usr/bin readonly 2>/dev/null local grep cd readonly
+	export cd x=1 && | | "$@" /usr/bin
+		-eu | "$1" sed $(pwd) grep
+		$(pwd) $(pwd) sed -eu local sed awk && $(pwd)
+/usr/bin 2>/dev/null grep x=1 2>/dev/null sed "$1" && export
+		$(pwd) echo x=1 done /usr/bin export
+${HOME} local x=1 then echo local echo then --verbose --verbose
+/usr/bin echo done done awk test $(pwd) grep -eu then cd then && cd done printf
+cd ${HOME} "$1" ${HOME} "$@" local x=1 then x=1 "$1" cd then ${HOME}
+&& | awk cd test ${HOME} 2>/dev/null && | 'quoted text' grep export export
+2>/dev/null && then --verbose -eu ${HOME} then printf "$1"
+grep "$@" x=1 export $(pwd)
+$(pwd) /usr/bin /usr/bin local && printf local 'quoted text' echo
+		${HOME} ${HOME} "$@" ${HOME} /usr/bin && ${HOME} done x=1 local echo
+	grep test 'quoted text' local && test 2>/dev/null "$@" export readonly then
+	grep $(pwd) cd readonly x=1 done cd awk $(pwd) 'quoted text'
+2>/dev/null --verbose echo done
+	grep sed --verbose export 'quoted text' "$@" sed "$@"
+local x=1 cd readonly sed grep grep readonly
+cd sed done test export sed grep 'quoted text' awk grep "$@"
+		$(pwd) echo /usr/bin --verbose cd "$1" export "$@" x=1 x=1 && --verbose sed x=1
+x=1 echo ${HOME} sed --verbose export
+	awk "$@" 'quoted text' ${HOME} --verbose sed | 'quoted text' cd x=1 sed
+--verbose 2>/dev/null then | x=1 --verbose echo 2>/dev/null awk
+printf 'quoted text' && 'quoted text' awk then readonly "$1" && -eu
+		printf "$1" awk | x=1 local 'quoted text' /usr/bin readonly done
+printf awk /usr/bin sed &&
+	echo $(pwd) "$@" x=1 ${HOME} test 'quoted text' "$1" sed --verbose &&
+	test "$@" "$1" export --verbose awk ${HOME} test export | done awk export
+/usr/bin readonly x=1 && 'quoted text'
+		&& cd done ${HOME} | | test local --verbose readonly
+	then local -eu sed ${HOME} test grep 'quoted text'
+| done 'quoted text' "$1" export export ${HOME} x=1 export sed printf 'quoted text'
+export "$@" ${HOME} /usr/bin 2>/dev/null 2>/dev/null && grep awk "$@"
+		echo then then -eu local readonly $(pwd) echo export x=1
+		printf awk x=1 && -eu "$1" grep ${HOME} "$@" printf ${HOME} | grep "$1" test
+	done test cd local "$@" 'quoted text' ${HOME} readonly then then grep awk
+		export "$1" echo done | $(pwd) | awk /usr/bin
+		-eu readonly -eu /usr/bin x=1 'quoted text' "$@"
+	echo local && "$1" cd then 2>/dev/null /usr/bin export 2>/dev/null sed
+	cd then "$@" "$@" echo ${HOME} 'quoted text'
+		"$@" grep 'quoted text' readonly readonly awk --verbose "$@" /usr/bin
+	x=1 echo "$@" grep test && export grep --verbose
+		grep then | awk /usr/bin $(pwd) 2>/dev/null
+	local "$@" x=1 ${HOME} echo $(pwd)
+grep export awk --verbose | 'quoted text'
+	x=1 -eu awk | grep 'quoted text'
+	x=1 printf "$@" $(pwd) readonly
+done test x=1 x=1 -eu readonly
+	printf printf printf echo "$@" test $(pwd) echo $(pwd) readonly
+		done | test /usr/bin 'quoted text' test "$1" $(pwd) | --verbose "$1"
+x=1 ${HOME} awk ${HOME} awk --verbose local local
+		${HOME} cd awk awk test x=1 'quoted text' awk done -eu
+		export then test echo export test export "$1" cd echo
+$(pwd) local printf printf "$1" grep | 2>/dev/null readonly
+then -eu --verbose cd done cd 'quoted text' "$@"
+	-eu printf $(pwd) printf export 'quoted text'
+grep grep readonly x=1 grep sed test cd echo export then echo 'quoted text' echo
+awk then echo | awk then printf echo export ${HOME} printf
+		echo then readonly $(pwd) "$1" sed sed && cd export printf test echo
+		&& sed 2>/dev/null x=1 2>/dev/null test | export
+	| then awk $(pwd) local -eu export export --verbose
+export readonly done -eu cd --verbose grep x=1 printf
+		-eu | awk 'quoted text' done readonly 2>/dev/null -eu /usr/bin -eu sed readonly
+		"$@" test $(pwd) 'quoted text' "$1" "$1" -eu test 'quoted text' | x=1
+sed printf | then "$@" |
+cd echo ${HOME} grep && 2>/dev/null --verbose /usr/bin -eu export export
+| echo local --verbose test grep | sed $(pwd) /usr/bin 2>/dev/null 'quoted text'
+then echo | ${HOME} then x=1 "$1" "$@" -eu echo -eu done ${HOME}
+		awk && export printf then then
+		local local cd awk /usr/bin 'quoted text'
+		awk | "$1" /usr/bin local 'quoted text' -eu &&
+	/usr/bin --verbose 'quoted text' printf then then sed "$1"
+$(pwd) "$@" -eu grep awk printf echo export
+	cd printf done local "$@" ${HOME} cd ${HOME}
+		--verbose && printf grep $(pwd) /usr/bin --verbose export grep export
+	done local --verbose x=1 cd sed then awk sed -eu $(pwd) 'quoted text'
+	&& /usr/bin && printf grep "$@" echo sed
+"$@" echo $(pwd) then --verbose grep test
+		'quoted text' awk 'quoted text' -eu "$1" 2>/dev/null
+		sed grep x=1 export && done x=1 2>/dev/null awk local
+		sed "$1" grep test "$1" --verbose printf ${HOME}
+	-eu printf 2>/dev/null readonly 'quoted text' sed then local awk sed /usr/bin &&
+	then && local cd export echo | x=1 $(pwd) readonly --verbose
+		"$@" ${HOME} printf printf
+	--verbose x=1 readonly x=1 $(pwd) awk -eu grep sed echo 2>/dev/null
+	x=1 sed export sed grep | cd && export sed echo cd 'quoted text'
+		local "$1" && test then readonly "$@" 'quoted text' awk cd awk echo
+echo cd grep awk readonly 2>/dev/null then local readonly awk ${HOME}
+	cd then echo ${HOME} export 2>/dev/null cd $(pwd)
+		test readonly awk cd | /usr/bin sed sed readonly cd
+	awk 'quoted text' echo $(pwd) grep
+		done sed test 'quoted text' 2>/dev/null "$@" done readonly x=1 cd printf test "$@"
+	sed sed && && --verbose --verbose
+		"$@" x=1 cd awk done printf cd local printf readonly printf -eu --verbose cd
+local 'quoted text' /usr/bin local awk export ${HOME} --verbose && "$@" export
+	/usr/bin "$1" "$1" && x=1 cd "$1" done x=1 2>/dev/null ${HOME} "$1" -eu
+	printf grep echo 2>/dev/null "$1" printf cd grep printf $(pwd)
+cd "$1" "$@" awk && test && -eu "$@" $(pwd) "$1" "$@" grep awk awk then test sed
+	local 'quoted text' cd --verbose && then awk echo then grep local then | 2>/dev/null
+awk export x=1 'quoted text' then export "$@" then printf test then /usr/bin
+	"$1" readonly /usr/bin readonly "$@" test 2>/dev/null "$@" echo sed
+		grep local export "$@" sed export && x=1 done "$1" done
+2>/dev/null x=1 "$1" --verbose 2>/dev/null -eu
+	"$1" then sed 'quoted text' printf ${HOME} readonly then sed 'quoted text'
+		$(pwd) test $(pwd) && --verbose echo | x=1 grep grep echo grep test /usr/bin
+	"$@" grep export 2>/dev/null -eu readonly echo grep
+		-eu 2>/dev/null sed 2>/dev/null
+		readonly 2>/dev/null export "$@" done export local local x=1 readonly $(pwd)
+	awk test $(pwd) ${HOME} test "$@" export
+		printf && sed grep readonly
+		local /usr/bin grep -eu | ${HOME} -eu
+then cd --verbose readonly local done | local
+-eu 2>/dev/null 'quoted text' "$1" export grep readonly printf cd sed
+		done && "$1" printf export awk && "$1" then echo test test 'quoted text'
+		'quoted text' && done | 2>/dev/null --verbose echo done readonly
+		--verbose 'quoted text' test && then $(pwd)
+	readonly "$1" readonly sed local cd cd test 2>/dev/null printf
+local test $(pwd) export 2>/dev/null grep grep local
+export -eu -eu 2>/dev/null ${HOME} --verbose grep then --verbose
+		awk 'quoted text' --verbose awk x=1 --verbose
+-eu --verbose | sed export test readonly 2>/dev/null
+sed x=1 sed 'quoted text' echo export echo test ${HOME} "$1" 'quoted text'
+awk --verbose awk "$1" 'quoted text' x=1 'quoted text' |
+2>/dev/null awk && sed x=1 --verbose test grep done
+		cd grep -eu test | "$1" cd 2>/dev/null printf
+$(pwd) /usr/bin readonly -eu test cd | export
+cd /usr/bin echo local echo cd -eu printf printf
+	cd 'quoted text' grep echo grep test done
+	local export test "$1" && cd grep local grep awk test printf sed readonly
+		'quoted text' --verbose 2>/dev/null && local /usr/bin printf printf
+	test "$1" | 2>/dev/null grep ${HOME} sed local --verbose
+| export test export /usr/bin 'quoted text' export && && cd 'quoted text'
+	echo local 'quoted text'
+$(pwd) local ${HOME} test ${HOME} 2>/dev/null
+"$1" | then | ${HOME} 'quoted text' cd --verbose sed
+		done echo echo printf -eu done 'quoted text' export
+'quoted text' cd $(pwd) "$@" "$@"
+	readonly cd echo x=1 then x=1 cd $(pwd) then /usr/bin 'quoted text' test | done
+		echo echo printf "$@" ${HOME} readonly done readonly done x=1
+--verbose grep $(pwd) 2>/dev/null local echo sed local sed export
+		local ${HOME} awk printf test $(pwd) printf
+		x=1 awk && $(pwd) export local readonly x=1 /usr/bin x=1 'quoted text'
+		"$1" -eu ${HOME} 2>/dev/null
+"$1" cd "$@" test && 'quoted text' printf "$1" test --verbose && --verbose
+${HOME} /usr/bin -eu echo export done done "$1" cd | local export
+	&& local echo then 'quoted text' grep echo --verbose
+	awk local sed sed 'quoted text' /usr/bin --verbose
+		"$@" 'quoted text' printf
+		| 'quoted text' readonly ${HOME} && awk printf
+		"$1" 'quoted text' "$1" test ${HOME} grep 2>/dev/null
+		/usr/bin awk test readonly 2>/dev/null test export -eu $(pwd) --verbose
+printf awk test "$1" | "$@" -eu readonly grep -eu awk done /usr/bin test done
+awk awk | $(pwd) cd 'quoted text'
+/usr/bin -eu local sed 'quoted text' local "$@" then done
+	done "$@" awk local ${HOME} done then
+readonly awk --verbose test done ${HOME} done ${HOME}
+	done | readonly export export "$1" readonly "$@" 'quoted text' done
+	readonly x=1 ${HOME} 'quoted text' echo
+		${HOME} echo cd done $(pwd) printf local
+x=1 readonly grep local cd --verbose
+		then printf sed "$1" "$@" sed done export cd awk export then
+		echo --verbose | ${HOME} 'quoted text' "$1" x=1
+	x=1 "$@" && 2>/dev/null done x=1 "$1" cd x=1 && printf
+	export grep "$1" awk export
+		| ${HOME} local ${HOME} done done | printf 'quoted text'
+		readonly done x=1 done grep $(pwd) then cd -eu | | awk
+	then printf grep /usr/bin
+	&& cd -eu awk printf grep local --verbose
+		awk printf printf test "$1"
+		sed "$@" ${HOME} done x=1 ${HOME} /usr/bin sed /usr/bin
+		test export -eu /usr/bin --verbose cd done
+	/usr/bin grep local awk printf ${HOME} echo ${HOME} local export
+		local echo ${HOME} --verbose && awk $(pwd) /usr/bin grep x=1 x=1 'quoted text'
+	"$1" --verbose test local ${HOME} -eu /usr/bin readonly done
+	then 'quoted text' then export sed test test done
+		readonly -eu 'quoted text' "$@" done cd printf export
+	cd $(pwd) readonly test echo ${HOME} --verbose readonly grep then echo echo
+export printf sed echo local x=1 ${HOME} done "$@"
+cd x=1 printf readonly echo x=1
+		-eu "$1" --verbose 2>/dev/null then
+	&& test "$1" grep "$1" export test cd 2>/dev/null
+	awk grep printf local local grep 2>/dev/null
+echo ${HOME} readonly "$@"
+cd echo readonly x=1 local local && readonly /usr/bin
+		-eu | echo "$@" grep && cd $(pwd) /usr/bin "$@" "$1" sed test grep
+#include c87.sh
+cd sed echo test "$@" -eu "$1" 2>/dev/null | 'quoted text' ${HOME}
+	"$1" 2>/dev/null -eu x=1 2>/dev/null printf | 'quoted text' /usr/bin
+		export readonly awk -eu | sed 2>/dev/null
+readonly --verbose awk done printf 'quoted text' --verbose | ${HOME}
+		/usr/bin grep x=1 test "$@" test
+		2>/dev/null ${HOME} "$1" -eu export 2>/dev/null export grep
+	2>/dev/null 'quoted text' echo printf 2>/dev/null 'quoted text' export awk
+	--verbose --verbose readonly done
+${HOME} --verbose done grep -eu --verbose | done --verbose /usr/bin
+	readonly sed 'quoted text' printf && 'quoted text'
+		"$@" echo 'quoted text' echo awk 2>/dev/null --verbose
+		cd ${HOME} export printf done "$1" /usr/bin grep /usr/bin awk
+local sed x=1 echo "$1" 'quoted text' --verbose
+echo ${HOME} "$1" done done
+"$1" && ${HOME} done cd ${HOME} readonly /usr/bin grep && export test echo
+	export x=1 printf then x=1 "$@" awk ${HOME} done 2>/dev/null test && /usr/bin
+		echo 2>/dev/null 2>/dev/null x=1 --verbose
+	local x=1 'quoted text' "$1" "$1" grep sed then --verbose ${HOME}
+done test printf "$1" ${HOME} grep test done
+grep echo ${HOME} -eu printf local --verbose "$@" local -eu
+$(pwd) $(pwd) && --verbose
+		grep awk "$1" awk then grep -eu "$1" grep
+		/usr/bin done done "$@"
+| --verbose sed done printf --verbose
+	test grep cd grep readonly
+		--verbose sed "$@" 2>/dev/null printf 'quoted text' "$@" 'quoted text'
+	cd then && readonly "$1" $(pwd) /usr/bin readonly echo then echo "$1" readonly
+	done 'quoted text' done x=1 done test ${HOME}
+x=1 then echo ${HOME} local
+	/usr/bin done cd cd x=1 x=1 echo sed awk local && sed awk 2>/dev/null
+--verbose x=1 sed | readonly "$1" cd grep printf
+	printf /usr/bin && ${HOME} then x=1 readonly then "$@" done cd cd sed "$@"
+		sed echo then | awk local test $(pwd) 'quoted text' -eu | done grep
+echo 2>/dev/null 'quoted text' 2>/dev/null
+		2>/dev/null $(pwd) 'quoted text'
+	test then export echo echo local export
+"$@" "$1" "$1" test -eu 'quoted text' --verbose x=1 'quoted text' awk 2>/dev/null
+		${HOME} grep grep $(pwd) export && 'quoted text' then
+x=1 -eu then sed --verbose local 'quoted text'
+	test ${HOME} done local done -eu
+		| | --verbose /usr/bin x=1 export readonly test ${HOME}
+		$(pwd) done && readonly 2>/dev/null
+		awk && | x=1 sed "$1" && 2>/dev/null
+awk "$@" /usr/bin export printf printf && grep | sed sed ${HOME}
+"$@" grep cd -eu "$1" readonly local
+		"$1" "$@" test && sed grep done echo grep local "$1" done local $(pwd)
+		awk done printf cd -eu export grep then "$@" 'quoted text'
+-eu export "$@" ${HOME} "$@" grep printf | "$1" readonly
+export && test | "$@" echo then
+		sed --verbose ${HOME} --verbose x=1 printf
+		grep cd echo readonly --verbose local echo cd readonly --verbose
+awk "$@" printf export | "$@"
+		echo | --verbose grep ${HOME} printf 'quoted text'
+		$(pwd) && -eu "$1" -eu --verbose --verbose && $(pwd) 2>/dev/null cd then printf
+	then 2>/dev/null grep readonly | cd
+		grep then echo test sed
+	${HOME} awk export "$@" awk export
+		-eu local done done x=1 -eu 2>/dev/null
+"$@" echo && then ${HOME} sed then printf awk 'quoted text' awk 'quoted text'
+	awk 'quoted text' && export "$@" --verbose awk "$@" $(pwd) /usr/bin
+echo | sed x=1 cd test 2>/dev/null 2>/dev/null
+	awk cd ${HOME} x=1 x=1 printf /usr/bin x=1 -eu awk awk &&
+	awk awk done readonly grep sed --verbose --verbose | && "$@" 'quoted text'
+	/usr/bin export readonly awk "$@" cd "$@" echo sed "$1" 2>/dev/null
+2>/dev/null && export done
+	awk then && export 2>/dev/null x=1
+grep "$@" $(pwd) grep echo test "$1" readonly
+echo x=1 printf awk 2>/dev/null 2>/dev/null grep printf
+	printf export test /usr/bin printf done done && --verbose
+&& readonly --verbose "$1" "$@" "$@" awk awk /usr/bin export
+		test && $(pwd) local /usr/bin --verbose
+	then export done 2>/dev/null x=1 "$1" -eu
+echo --verbose 2>/dev/null "$@" awk -eu | awk readonly | printf ${HOME}
+	then --verbose 2>/dev/null /usr/bin -eu export test then ${HOME}
+	--verbose done 2>/dev/null && then -eu readonly readonly "$1" ${HOME}
+'quoted text' 'quoted text'
+/usr/bin /usr/bin sed sed "$1" then export 2>/dev/null
+		&& done awk ${HOME} done export x=1 then /usr/bin
+cd then 2>/dev/null 'quoted text' --verbose awk x=1 echo echo
+	&& 'quoted text' test then && "$@"
+		/usr/bin && | 2>/dev/null x=1 "$1" readonly
+	printf test awk 2>/dev/null
+	echo cd test printf /usr/bin -eu && /usr/bin && readonly then
+sed $(pwd) sed x=1 | cd "$1" "$@" export done printf ${HOME} ${HOME} | local
+grep local /usr/bin echo x=1 grep /usr/bin export "$@" export
+	"$@" done 'quoted text' -eu cd 2>/dev/null "$@" | 'quoted text' test
+"$1" grep test -eu x=1 done
+2>/dev/null readonly export sed test ${HOME}
+		${HOME} ${HOME} "$@" local export x=1 grep
+		| 2>/dev/null $(pwd) 2>/dev/null test done "$1" local echo && local ${HOME}
+	readonly echo test x=1 echo ${HOME} ${HOME} printf readonly done local
+		2>/dev/null /usr/bin then export done ${HOME} "$1" | grep readonly
+cd done grep 2>/dev/null 'quoted text' $(pwd) ${HOME} -eu "$1" local --verbose
+cd export cd ${HOME} | /usr/bin 2>/dev/null $(pwd)
+	&& && then awk readonly ${HOME} printf
+		2>/dev/null printf 2>/dev/null
+	| ${HOME} export grep "$1" 'quoted text' export export awk
+	/usr/bin ${HOME} | sed sed "$1" -eu echo -eu cd printf
+	/usr/bin 2>/dev/null printf 'quoted text' export x=1 export cd --verbose
+	${HOME} printf awk ${HOME} echo printf x=1 'quoted text'
+	then export "$@" printf grep | -eu readonly /usr/bin grep
+		--verbose test then 2>/dev/null ${HOME} 'quoted text'
+	grep "$@" done then echo "$@" sed local cd "$1" &&
+		awk -eu echo && --verbose cd then test sed ${HOME} $(pwd) export echo
+--verbose test echo awk echo && -eu done sed "$@" -eu
+	grep /usr/bin && printf done then 'quoted text' "$1" 2>/dev/null
+		export local done grep 'quoted text' $(pwd)
+"$@" readonly 'quoted text' test 2>/dev/null readonly
+		then $(pwd) 2>/dev/null ${HOME} 2>/dev/null
+		export test done readonly local $(pwd) ${HOME} 2>/dev/null x=1
+$(pwd) test then then readonly -eu local export sed /usr/bin "$1" "$1" echo
+	readonly | readonly echo test printf "$@" "$@" "$@" printf then export awk
+	-eu -eu readonly done x=1 awk export ${HOME} echo readonly
+echo "$@" sed echo ${HOME} 'quoted text'
+cd /usr/bin export awk then local --verbose ${HOME}
+x=1 --verbose -eu echo done awk x=1 -eu 2>/dev/null x=1 test cd |
+		local local cd 2>/dev/null
+sed 'quoted text' echo && test local /usr/bin x=1 echo readonly 2>/dev/null
+echo -eu -eu grep 2>/dev/null -eu x=1 /usr/bin
+		test -eu grep 2>/dev/null awk -eu
+--verbose done readonly "$@" x=1 echo 'quoted text' awk -eu -eu --verbose | && then
+		cd | sed cd --verbose local | && x=1 'quoted text' -eu && -eu "$1" "$1" "$1"
+	export test printf printf "$@" cd /usr/bin 'quoted text' done ${HOME}
+		'quoted text' /usr/bin export "$1" $(pwd) local | "$@" 2>/dev/null
+export cd --verbose 'quoted text'
+		cd then /usr/bin test test ${HOME} export
+	/usr/bin done $(pwd) && ${HOME} -eu 'quoted text'
+	echo export "$@" test then local x=1 /usr/bin echo 2>/dev/null --verbose x=1
+		| local | sed 'quoted text' grep ${HOME} done 'quoted text'
+		"$1" "$1" grep local /usr/bin printf x=1 && 2>/dev/null
+	test x=1 ${HOME} done "$1" /usr/bin
+test then done printf awk awk local -eu then
+${HOME} grep then echo && then echo printf readonly ${HOME} -eu $(pwd)
+local awk cd 2>/dev/null
+		readonly 'quoted text'
+'quoted text' 2>/dev/null
+		"$1" ${HOME} && sed done $(pwd) ${HOME} "$@" cd x=1 export echo && cd echo
+	'quoted text' -eu awk --verbose then done x=1 'quoted text'
+printf --verbose export cd test
+	local printf 2>/dev/null
+		x=1 /usr/bin grep $(pwd) then --verbose $(pwd) $(pwd) grep x=1 | $(pwd) && sed
+		grep x=1 cd sed ${HOME} 'quoted text' 2>/dev/null $(pwd) 'quoted text'
+	--verbose | export grep "$@" "$1" | ${HOME} export readonly
+	awk "$1" awk /usr/bin printf printf awk local awk 2>/dev/null
+-eu then printf "$1" then grep
+		${HOME} x=1 local && printf printf
+	export 'quoted text' "$@"
+-eu test 'quoted text' | grep 2>/dev/null cd $(pwd)
+		printf ${HOME} "$1" ${HOME} grep export /usr/bin --verbose sed readonly awk readonly
+		readonly 2>/dev/null /usr/bin x=1 awk --verbose -eu && 2>/dev/null
+		"$@" echo readonly printf 'quoted text' --verbose x=1 readonly "$1"
+	grep && x=1 done readonly
+-eu test -eu printf cd -eu "$@" readonly echo local grep -eu
+	'quoted text' export && -eu 'quoted text'
+	--verbose awk -eu printf 'quoted text'
+	x=1 | && then $(pwd) export "$@" | done cd && sed "$@" then $(pwd)
+echo test 'quoted text' test
+		"$@" -eu local /usr/bin printf done test | /usr/bin awk local
+		| -eu /usr/bin $(pwd) local then ${HOME} 'quoted text'
+		"$@" export local printf $(pwd) done ${HOME} printf grep
+cd done ${HOME} -eu /usr/bin "$@" -eu x=1
+		$(pwd) readonly "$1" cd awk then
+export local printf sed 2>/dev/null local && awk "$1" readonly
+| --verbose ${HOME} readonly x=1 local test grep cd 'quoted text'
+	"$1" export sed && awk 'quoted text' cd && 2>/dev/null --verbose
+		"$1" sed echo -eu -eu 'quoted text' done export awk readonly test "$@"
+'quoted text' echo -eu readonly x=1
+		2>/dev/null && readonly
+		then "$@" "$1" 2>/dev/null
+		grep sed grep then echo echo
+		/usr/bin echo awk local -eu 'quoted text' echo $(pwd) -eu --verbose "$1" 2>/dev/null
+	"$1" "$1" --verbose sed x=1 --verbose | -eu "$@"
+	awk -eu done awk echo --verbose export local | cd test export $(pwd) export
+		--verbose /usr/bin then done --verbose readonly
+	cd readonly sed printf cd x=1 grep "$1" /usr/bin cd 2>/dev/null
+/usr/bin then | && grep /usr/bin local && local -eu awk local "$1"
+	export ${HOME} && --verbose
+	'quoted text' echo cd sed cd readonly readonly
+| then ${HOME} export printf export --verbose sed
+--verbose x=1 /usr/bin "$1" cd awk "$@" awk ${HOME} test export local sed | x=1
+-eu -eu done && --verbose readonly /usr/bin local awk $(pwd) /usr/bin "$@"
+'quoted text' readonly readonly --verbose cd -eu local /usr/bin printf done
+		"$@" && --verbose then sed --verbose printf done sed
+sed 'quoted text' $(pwd) 'quoted text'
+sed /usr/bin && test export ${HOME} then | 2>/dev/null 2>/dev/null readonly
+	echo then $(pwd) local sed done --verbose then printf grep grep
+2>/dev/null --verbose grep x=1 cd awk awk done sed grep ${HOME} done test then
+	| readonly --verbose then --verbose echo $(pwd) --verbose | local done then
+	export x=1 && echo --verbose cd
+${HOME} && cd grep export -eu local export cd 2>/dev/null "$@" grep -eu
+	/usr/bin test x=1 readonly
+		| && $(pwd) -eu printf -eu "$1"
+	/usr/bin echo printf $(pwd) -eu printf "$@" -eu
+		printf awk then | -eu
+export local printf readonly
+--verbose done readonly
+sed echo && 'quoted text' /usr/bin /usr/bin $(pwd) && sed sed awk export sed
+		then $(pwd) export | readonly sed done sed done $(pwd) readonly cd $(pwd) $(pwd)
+printf echo then ${HOME} /usr/bin local "$@" /usr/bin | 'quoted text'
+	${HOME} grep cd awk cd | ${HOME} echo echo 'quoted text'
+		readonly printf "$1" $(pwd) printf
+local /usr/bin && /usr/bin readonly "$1" printf cd 'quoted text'
+test cd /usr/bin | done 2>/dev/null x=1 printf 'quoted text' local && ${HOME}
+	"$1" printf test ${HOME} /usr/bin $(pwd) echo printf printf
+	then && sed 2>/dev/null printf "$1" /usr/bin 'quoted text'
+		${HOME} test 2>/dev/null then --verbose --verbose x=1
+	grep -eu printf then local
+	cd printf ${HOME} --verbose then /usr/bin --verbose
+		test 'quoted text' -eu 'quoted text'
+		grep "$1" --verbose "$1" then printf | x=1 sed && 'quoted text'
+	sed ${HOME} /usr/bin -eu cd $(pwd) &&
+	2>/dev/null cd $(pwd) echo grep grep /usr/bin cd ${HOME} done "$1" export 'quoted text'
+	x=1 grep ${HOME} local -eu 'quoted text' cd "$1"
+		&& readonly test -eu $(pwd) 2>/dev/null $(pwd) 'quoted text' then readonly
+		local -eu && grep -eu grep ${HOME} test $(pwd)
+		-eu test 2>/dev/null grep -eu echo sed | sed 2>/dev/null cd
+	${HOME} printf $(pwd) printf && /usr/bin then readonly cd export test grep && /usr/bin
+printf test readonly echo export && printf then export cd
+cd --verbose $(pwd) sed && --verbose then $(pwd) readonly $(pwd)
+sed sed sed --verbose export
+	2>/dev/null grep "$1" export && -eu $(pwd) printf
+	"$1" ${HOME} | local test x=1 test /usr/bin local
+		awk 'quoted text' 'quoted text' export 'quoted text'
+	done "$1" && printf -eu "$@"
+&& "$1" --verbose sed printf
+		done echo local grep x=1 x=1 'quoted text' then readonly /usr/bin
+		&& 2>/dev/null 'quoted text' $(pwd) sed local 'quoted text' echo
+		export --verbose 2>/dev/null ${HOME} readonly grep test printf cd
+		${HOME} grep export cd readonly "$1" /usr/bin printf sed ${HOME}
+		local done sed echo cd "$@" "$@" ${HOME} sed
+		test 2>/dev/null export done "$@" done -eu sed ${HOME} local "$@"
+		grep ${HOME} 2>/dev/null && "$@" test
+		| test $(pwd) done 'quoted text' grep grep | awk readonly ${HOME} test | && /usr/bin
+	test awk printf 'quoted text' "$@"
+	--verbose awk echo sed sed | sed
+	&& $(pwd) done test echo readonly "$1" test done cd test 'quoted text'
+-eu then x=1 ${HOME} echo $(pwd)
+		2>/dev/null $(pwd) ${HOME} printf
+$(pwd) then -eu $(pwd) grep 2>/dev/null test printf
+| && /usr/bin 2>/dev/null export $(pwd) grep && readonly
+		grep done echo -eu awk x=1 awk echo echo cd cd x=1 && -eu 'quoted text' /usr/bin
+		sed $(pwd) -eu export awk then $(pwd) x=1
+		readonly cd echo awk 2>/dev/null 'quoted text'
+		"$1" done readonly ${HOME}
+	2>/dev/null --verbose export | test 'quoted text' -eu printf 'quoted text'
+		echo then done awk "$@" export test /usr/bin /usr/bin
+	2>/dev/null "$@" && "$1" 2>/dev/null
+	"$1" sed test echo then --verbose export --verbose
+	$(pwd) 2>/dev/null x=1 awk x=1 awk 2>/dev/null printf then
+		test && then $(pwd) 2>/dev/null ${HOME} && "$1" then 'quoted text'
+	"$1" 2>/dev/null cd /usr/bin $(pwd) | cd x=1 done
+		test "$1" 2>/dev/null grep sed echo grep --verbose ${HOME} 'quoted text'
+	--verbose readonly "$1" ${HOME} test
+		grep sed export echo done sed ${HOME} "$1"
+	'quoted text' local 'quoted text' 2>/dev/null readonly "$@" --verbose
+printf awk /usr/bin && done grep $(pwd)
+	cd 2>/dev/null --verbose test && export x=1 test --verbose
+		-eu $(pwd) readonly awk
+readonly && && --verbose printf readonly sed local
+		done readonly "$@" /usr/bin 'quoted text' x=1 'quoted text'
+		done test sed then x=1 printf 2>/dev/null export x=1 echo
+		grep /usr/bin echo $(pwd) /usr/bin x=1 2>/dev/null
+		-eu sed export ${HOME} x=1 'quoted text' test && -eu
+cd done "$@" && 2>/dev/null echo test && x=1
+		local awk x=1 echo done ${HOME} "$1" local test | 2>/dev/null
+	printf x=1 "$@" printf awk then local x=1 test then -eu echo readonly $(pwd)
+	x=1 && local && export x=1 | sed export "$1" 'quoted text'
+	grep 'quoted text' export "$@" x=1 printf done then echo sed
+	grep test done 2>/dev/null --verbose printf 2>/dev/null 'quoted text'
+	printf ${HOME} readonly grep sed -eu cd ${HOME} export cd sed printf
+"$@" test "$@" --verbose -eu "$1" && export | "$@" && grep
+		"$1" then -eu 'quoted text' sed printf sed cd | printf grep
+	&& 'quoted text' awk ${HOME} $(pwd)
+readonly 2>/dev/null export echo done "$1"
+--verbose grep ${HOME} export x=1 test /usr/bin readonly x=1 readonly
+		echo | "$1" /usr/bin export sed export 2>/dev/null sed done local
+		'quoted text' awk echo x=1 readonly readonly
+done && awk "$@" && 'quoted text'
+	readonly 'quoted text' $(pwd) local then | $(pwd) grep "$@" $(pwd) -eu 'quoted text'
+		${HOME} cd readonly -eu -eu "$@" awk ${HOME}
+		${HOME} grep then ${HOME} grep readonly cd then
+readonly export echo cd | "$@" "$@" printf done x=1 2>/dev/null
+		'quoted text' readonly /usr/bin awk done test ${HOME} && done printf echo ${HOME}
+local | printf "$@" -eu $(pwd) echo "$@" done export echo 2>/dev/null done
+	x=1 x=1 --verbose "$@" readonly echo printf awk cd printf x=1 test
+	${HOME} export ${HOME} awk ${HOME} 2>/dev/null
+		$(pwd) test "$@" | export 'quoted text' echo | sed readonly echo readonly
+	${HOME} -eu x=1 cd --verbose && && -eu readonly 'quoted text' test test
+done | 2>/dev/null printf -eu x=1 printf "$1" export
+	echo echo local -eu echo 'quoted text' export "$@" --verbose
+$(pwd) cd done export
+${HOME} 2>/dev/null grep -eu test "$1"
+	done x=1 awk echo grep then | $(pwd) printf --verbose
+| | 'quoted text' $(pwd) cd then done
+		readonly export 'quoted text' echo
+| "$@" | export readonly test cd $(pwd) x=1 "$1" $(pwd) readonly awk 2>/dev/null
+echo && 'quoted text' -eu ${HOME}
+		&& sed export /usr/bin awk grep sed 'quoted text'
+		echo done then /usr/bin printf done local 2>/dev/null --verbose printf printf
+grep && "$@" -eu $(pwd) "$1"
+then -eu cd done awk ${HOME} done then ${HOME} ${HOME} x=1
+		"$1" readonly x=1 -eu
+		--verbose "$1" done "$@" 'quoted text'
+--verbose ${HOME} $(pwd)
+| test $(pwd) awk && cd then done test cd echo x=1 'quoted text'
+| -eu done 'quoted text' then ${HOME} | x=1 x=1 "$1" done
+		--verbose cd "$@" test local 2>/dev/null local printf
+	awk local grep 'quoted text' awk &&
+		'quoted text' $(pwd) && sed printf $(pwd) --verbose local x=1 -eu /usr/bin
+		&& x=1 $(pwd) "$1" 2>/dev/null
+2>/dev/null local test $(pwd)
+grep printf cd ${HOME} readonly /usr/bin | "$1"
+		$(pwd) sed 'quoted text' export -eu grep 'quoted text' "$@" echo done "$1" test
+	"$@" ${HOME} && $(pwd) cd done "$@" | awk
+	2>/dev/null grep then grep
+sed echo export && export cd sed && export ${HOME} $(pwd) printf /usr/bin
+		"$1" 2>/dev/null 2>/dev/null grep x=1 "$@" | test done "$1" ${HOME} 2>/dev/null
+		awk cd awk local printf
+		done | "$@" "$1" "$@" cd then /usr/bin
+	done ${HOME} readonly then 'quoted text' local "$1" awk export export ${HOME}
+		readonly readonly 2>/dev/null local ${HOME} --verbose
+		'quoted text' awk sed x=1
+grep local 'quoted text' 2>/dev/null echo "$1" echo
+readonly readonly grep awk 'quoted text' 2>/dev/null cd printf
+		-eu "$@" test export test 'quoted text'
+printf cd local cd $(pwd) ${HOME} done echo local sed &&
+sed then $(pwd) "$@" ${HOME} then /usr/bin "$@" echo printf grep readonly
+${HOME} grep && ${HOME} /usr/bin export sed readonly $(pwd) awk local
+	"$1" --verbose then export /usr/bin "$@" "$@" "$@" then 'quoted text'
+echo test 2>/dev/null export && $(pwd) local grep echo ${HOME}
+awk x=1 readonly && echo printf
+		sed $(pwd) 'quoted text' readonly 2>/dev/null echo "$1" local ${HOME}
+		| /usr/bin cd printf && echo
+		export x=1 --verbose printf readonly --verbose "$@" printf done --verbose sed
+"$1" /usr/bin sed && -eu printf
+		local 2>/dev/null readonly
+"$1" ${HOME} sed grep 2>/dev/null --verbose
+		-eu printf /usr/bin "$@" $(pwd) printf /usr/bin
+	"$1" export && grep printf printf
+"$1" -eu $(pwd) "$@" x=1 sed /usr/bin export printf local then -eu
+	awk awk ${HOME} done grep
+	'quoted text' 'quoted text' 2>/dev/null $(pwd) cd
+		2>/dev/null "$1" sed test --verbose export done readonly --verbose $(pwd) 2>/dev/null
+	cd cd 'quoted text' done $(pwd) sed done "$1" echo cd export "$@" "$1" printf
+		local | echo readonly 'quoted text' echo readonly --verbose "$@" /usr/bin /usr/bin
+sed ${HOME} 'quoted text' grep x=1 | done awk printf "$@" cd done x=1 test
+	--verbose awk then && export -eu done readonly
+	"$1" /usr/bin export 2>/dev/null
+		test && sed readonly | done --verbose 2>/dev/null local | printf
+		--verbose "$1" test "$@" 'quoted text' done 2>/dev/null export
+	"$1" then export && printf test grep
+		$(pwd) grep "$@" $(pwd) x=1 /usr/bin readonly 2>/dev/null && echo 2>/dev/null
+		$(pwd) ${HOME} | local | cd readonly then --verbose
+	"$@" done local 2>/dev/null 2>/dev/null /usr/bin local | "$1" $(pwd)
+		awk -eu printf grep 2>/dev/null 'quoted text' echo
+	x=1 test cd -eu printf test cd "$@" grep && echo $(pwd) "$1" -eu local awk
+		printf local --verbose ${HOME} test sed awk export $(pwd) &&
+		${HOME} export && sed 2>/dev/null | local ${HOME} /usr/bin
+		test printf local && -eu | --verbose "$1"
+		${HOME} printf printf test awk export
+	x=1 cd | awk done x=1 "$@" && | && cd echo --verbose
+		-eu x=1 test -eu local local readonly ${HOME}
+$(pwd) x=1 readonly -eu awk x=1 awk --verbose "$1" 'quoted text'
+	cd then 'quoted text' "$@" /usr/bin then "$@" then "$1" done sed
+"$@" then printf awk
+		printf export cd $(pwd) readonly 'quoted text' sed export x=1 "$@" | then readonly
+| /usr/bin cd /usr/bin local local
+		then echo "$1" printf 2>/dev/null export "$1" local
+		done 'quoted text' sed grep awk
+'quoted text' && x=1 $(pwd) ${HOME}
+		awk sed | echo printf cd --verbose export awk printf
+		"$@" cd 2>/dev/null awk
+	${HOME} done x=1 sed
+	${HOME} 2>/dev/null done
+"$1" sed /usr/bin -eu "$1" "$1" 2>/dev/null export
+		grep 'quoted text' printf
+	cd cd printf --verbose done sed readonly 2>/dev/null test local then export
+	cd echo "$@" 2>/dev/null cd && $(pwd) 'quoted text' readonly sed x=1
+		local /usr/bin grep cd test /usr/bin readonly /usr/bin printf echo grep | then
+	echo x=1 x=1 "$@" 'quoted text' printf test /usr/bin 'quoted text' echo printf
+		2>/dev/null /usr/bin -eu | -eu $(pwd) | 2>/dev/null grep "$@" 2>/dev/null
+test && then grep readonly then "$1" test "$1" && cd printf
+	readonly x=1 2>/dev/null 'quoted text' readonly local /usr/bin
+	&& grep -eu readonly 2>/dev/null then test -eu
+	| awk echo "$1" readonly done echo 'quoted text'
+	then && echo echo "$1" export test
+		export $(pwd) done | --verbose | export
+	awk cd ${HOME} -eu test
+		awk printf | 2>/dev/null local
+x=1 'quoted text' && "$1"
+		awk "$@" readonly done --verbose export test readonly 'quoted text' sed
+		'quoted text' readonly local test cd
+	local done ${HOME} x=1 --verbose
+"$1" local test "$@" -eu done done test "$1" x=1 test "$1" test awk | readonly
+		x=1 2>/dev/null grep sed x=1 2>/dev/null
+	-eu printf then x=1 | cd cd /usr/bin 2>/dev/null export
+printf "$1" test ${HOME} /usr/bin "$1" cd --verbose readonly readonly
+export $(pwd) /usr/bin | sed local 2>/dev/null "$1" -eu ${HOME}
+	echo then 'quoted text' --verbose "$@" | export sed printf 2>/dev/null printf readonly
+${HOME} local "$1" then then grep echo done local && -eu 2>/dev/null
+		grep printf test 2>/dev/null then
+grep echo && export awk && -eu 'quoted text' -eu sed local
+export done local -eu readonly then "$@" -eu && x=1 /usr/bin cd awk
+| "$1" x=1 printf cd done --verbose local
+		"$1" then then "$@" "$@" | | /usr/bin printf ${HOME} readonly readonly | test
+x=1 local 'quoted text' printf local x=1 grep echo ${HOME} |
+x=1 -eu printf echo | | grep -eu test
+		readonly x=1 2>/dev/null -eu "$1" echo 2>/dev/null -eu "$1" done export sed |
+		-eu ${HOME} --verbose sed awk readonly export "$@" 'quoted text' -eu x=1
+	local echo --verbose then grep x=1 /usr/bin export
+	/usr/bin 2>/dev/null readonly 'quoted text' printf |
+${HOME} export /usr/bin
+	local $(pwd) -eu 'quoted text' "$@" echo cd sed done
+	"$@" sed && test local awk cd readonly 2>/dev/null done | sed
+&& && 'quoted text' 2>/dev/null sed /usr/bin sed local local printf
+"$@" export printf readonly grep "$1" printf "$1" -eu export local $(pwd) readonly
+awk test "$1" | $(pwd) export test 2>/dev/null && echo sed 'quoted text' && then
+		-eu printf then echo -eu then -eu -eu "$@" test sed $(pwd) /usr/bin "$@" then
+&& cd grep 'quoted text' echo | readonly printf x=1 grep cd then
+/usr/bin -eu -eu printf grep sed test --verbose local $(pwd) local then 2>/dev/null
+		&& | awk cd done awk test printf readonly test grep --verbose grep echo ${HOME}
+	${HOME} 2>/dev/null test grep $(pwd) done done /usr/bin
+$(pwd) --verbose $(pwd) readonly && echo /usr/bin
+	"$@" then 2>/dev/null --verbose $(pwd) test grep --verbose
+	cd 'quoted text' cd && echo
+		| $(pwd) test awk && sed 'quoted text' then --verbose
+export /usr/bin export /usr/bin test awk readonly |
+		export test "$1" | 2>/dev/null ${HOME} /usr/bin readonly then
+x=1 $(pwd) readonly --verbose
+	grep -eu readonly && 2>/dev/null export readonly done cd sed ${HOME} awk
+echo then sed 2>/dev/null -eu 2>/dev/null then
+		awk test local "$@" && --verbose then $(pwd) "$1" "$@" readonly "$@" x=1
+		sed "$1" readonly then ${HOME} readonly
+	/usr/bin cd test echo
+		$(pwd) -eu readonly printf | export
+cd ${HOME} then "$@" printf cd ${HOME} --verbose then export $(pwd)
+		2>/dev/null "$1" "$1" -eu sed ${HOME} sed export
+		x=1 readonly -eu cd && awk test
+		sed "$1" grep && done then "$1" grep grep then | awk printf then done | then
+$(pwd) awk | /usr/bin awk local --verbose --verbose printf cd local
+local x=1 awk awk test $(pwd) grep printf $(pwd) readonly
+	local 2>/dev/null x=1 readonly
+done "$@" $(pwd) local export
+		'quoted text' test x=1 --verbose done $(pwd) cd 2>/dev/null "$@" test -eu
+	done done x=1 then | grep --verbose export 2>/dev/null /usr/bin done
+		then printf grep && then test 'quoted text' grep 2>/dev/null grep /usr/bin done
+	grep export grep printf then
+		x=1 'quoted text' -eu awk local grep then 2>/dev/null
+		test "$1" local export ${HOME} test sed echo | /usr/bin 'quoted text' 2>/dev/null
+$(pwd) done "$@" && done local 2>/dev/null echo export awk 'quoted text' done
+"$1" done x=1 "$1" local local test "$1" 2>/dev/null sed done readonly
+done x=1 test awk local ${HOME} /usr/bin then cd "$@" --verbose "$1" awk
+	echo export "$@" local "$1" awk 2>/dev/null
+		grep test local /usr/bin printf
+	cd 'quoted text' sed /usr/bin export x=1
+-eu -eu cd -eu echo echo ${HOME} done /usr/bin
+	export done printf /usr/bin
+done /usr/bin -eu "$@" echo readonly "$@" x=1 'quoted text' awk then sed cd
+awk -eu $(pwd) ${HOME} x=1 sed && awk readonly && sed cd cd readonly echo
+"$1" cd ${HOME} grep 2>/dev/null local grep
+	/usr/bin "$@" then 'quoted text' cd x=1 done "$@" grep && cd "$1"
+	sed cd local test done grep && readonly /usr/bin sed | printf x=1 then | sed $(pwd)
+${HOME} "$1" awk | "$@" 'quoted text' 'quoted text' awk test --verbose /usr/bin
+x=1 ${HOME} | 'quoted text' $(pwd) echo /usr/bin $(pwd) -eu export
+-eu echo done echo sed x=1 'quoted text' done 'quoted text'
+		awk | $(pwd) printf $(pwd) sed cd sed 'quoted text'
+	${HOME} test --verbose export
+done "$@" -eu sed printf $(pwd) && readonly ${HOME} | ${HOME} "$@" echo
+		sed -eu x=1 x=1 cd "$1" | "$1" x=1 readonly local done $(pwd) then
+		--verbose readonly --verbose | local sed |
+$(pwd) $(pwd) test | cd echo printf then x=1 x=1 cd readonly
+		${HOME} /usr/bin | | /usr/bin | cd test echo --verbose
+then /usr/bin | 'quoted text' grep sed awk readonly
+	--verbose local "$1" && printf x=1 grep grep awk "$@"
+		test export then 'quoted text' test "$1" echo x=1 'quoted text'
+"$@" sed grep sed done /usr/bin /usr/bin done export --verbose
+	echo readonly awk /usr/bin | ${HOME} echo
+		awk -eu $(pwd) local $(pwd) echo readonly 'quoted text' --verbose
+	'quoted text' local grep && readonly echo done "$1" | "$1"
+${HOME} /usr/bin 'quoted text' $(pwd) test "$@" echo 2>/dev/null
+printf awk /usr/bin "$1" readonly test 2>/dev/null &&
+	${HOME} x=1 then -eu export && -eu done
+		printf "$1" then printf local "$1" --verbose export x=1 awk grep readonly
+${HOME} test 'quoted text' -eu grep sed "$1" x=1 grep "$@" test then /usr/bin
+then 'quoted text' awk export && 'quoted text' done
+awk echo export 2>/dev/null /usr/bin
+		cd cd "$1" "$1" x=1 /usr/bin readonly --verbose
+		cd && readonly ${HOME}
+	test cd -eu && sed 2>/dev/null export
+local ${HOME} echo local $(pwd) x=1 then test then echo cd local
+done --verbose echo -eu
+		2>/dev/null 2>/dev/null && then 2>/dev/null cd grep test awk x=1 -eu
+printf readonly echo "$@" test "$1"
+	| && $(pwd) $(pwd) "$@" local x=1 export sed awk
+2>/dev/null done --verbose awk printf echo x=1 'quoted text'
+"$1" local ${HOME} awk echo
+		"$@" then "$@" --verbose x=1 test awk $(pwd) then cd awk /usr/bin
+grep cd ${HOME} done done cd export export | done then cd
+		/usr/bin | grep local x=1 printf done grep x=1 x=1 echo echo x=1 2>/dev/null
+| sed ${HOME} ${HOME} awk printf readonly "$@" printf && 2>/dev/null
+		$(pwd) ${HOME} readonly ${HOME} 'quoted text' ${HOME} $(pwd) | echo awk export
+2>/dev/null local echo
+&& then /usr/bin -eu local && test x=1 readonly /usr/bin 2>/dev/null export
+	echo /usr/bin | | readonly "$@" -eu export "$1" ${HOME} --verbose "$1" "$@"
+	awk /usr/bin awk -eu && --verbose readonly cd /usr/bin 'quoted text' ${HOME}
+	| printf --verbose $(pwd) 2>/dev/null readonly local 'quoted text' awk grep
+		"$1" echo 2>/dev/null "$@" done --verbose 'quoted text' cd 2>/dev/null
+/usr/bin sed cd awk local $(pwd) printf 'quoted text' --verbose 2>/dev/null
+		"$1" -eu done ${HOME} local && "$@" awk $(pwd) -eu local done "$@"
+	${HOME} readonly && -eu sed | printf && echo readonly $(pwd)
+sed readonly | awk grep "$@" "$@" -eu awk | --verbose sed /usr/bin
+'quoted text' | sed test ${HOME} local cd && test
+sed -eu then -eu export 2>/dev/null awk local done
+		/usr/bin cd sed local
+		2>/dev/null /usr/bin ${HOME} "$@" -eu && readonly awk
+awk | test /usr/bin export | && ${HOME} printf $(pwd) then x=1 x=1 done "$@"
+readonly done --verbose
+"$@" 2>/dev/null awk && cd export readonly test -eu ${HOME} | 2>/dev/null
+		then then test | test 2>/dev/null x=1 "$@" test cd 'quoted text' && && grep
+/usr/bin --verbose grep
+		"$@" test awk then awk ${HOME} --verbose printf echo
+echo 2>/dev/null ${HOME} cd | "$@" sed printf
+		cd cd grep then readonly sed grep /usr/bin then
+		$(pwd) "$1" --verbose readonly printf then "$1" then 'quoted text'
+		echo echo /usr/bin readonly awk $(pwd) --verbose echo | export 2>/dev/null -eu
+${HOME} x=1 /usr/bin export "$1" export cd -eu test sed
+		cd then then export printf printf
+		$(pwd) test echo "$@" 'quoted text' export grep
+&& /usr/bin $(pwd) 'quoted text' 'quoted text' ${HOME} grep
+'quoted text' ${HOME} $(pwd) grep sed
+	-eu x=1 export "$1" --verbose -eu --verbose 2>/dev/null
+	readonly 2>/dev/null | sed "$@" "$1"
+${HOME} sed 'quoted text' /usr/bin grep
+awk && local -eu awk "$@" |
+		then then local printf done awk 2>/dev/null
+		readonly cd && 'quoted text' grep /usr/bin readonly 2>/dev/null cd local
+	echo x=1 x=1 done $(pwd) cd "$1" 2>/dev/null
+"$1" ${HOME} ${HOME} --verbose "$1"
+&& export then awk ${HOME} "$@" -eu grep "$1" --verbose
+&& local export echo --verbose $(pwd) "$1" "$1" && local x=1
+	then $(pwd) printf then 'quoted text' --verbose test cd --verbose
+done cd 2>/dev/null && awk grep
+		x=1 test -eu grep test awk done printf
+	test -eu /usr/bin 'quoted text'
+		"$1" x=1 then --verbose printf
+	local | then $(pwd) 2>/dev/null
+	&& 'quoted text' | local x=1 cd sed
+		test then -eu test /usr/bin export test "$@"
+local && 2>/dev/null awk | 'quoted text' export
+		test sed export then
+export ${HOME} 'quoted text' | cd "$1" awk cd grep test 'quoted text'
+	sed grep cd | "$@" test cd -eu /usr/bin -eu "$@" ${HOME}
+	echo 2>/dev/null 2>/dev/null -eu done sed /usr/bin grep grep
+		&& 2>/dev/null grep $(pwd) $(pwd) /usr/bin ${HOME} grep export sed
+	awk awk "$@" $(pwd) "$@" readonly ${HOME} local x=1
+	| test ${HOME} local local grep readonly test /usr/bin printf local
+	'quoted text' "$@" cd "$1" "$@" printf x=1 then x=1 2>/dev/null sed $(pwd)
+	'quoted text' && $(pwd) awk | echo && | $(pwd) awk local | ${HOME} 'quoted text'
+	--verbose printf test grep | "$@" cd cd export cd | readonly -eu -eu ${HOME}
+		then && sed export && 2>/dev/null | echo
+	sed --verbose sed x=1 "$@" "$1" done | local x=1 "$1" done | ${HOME}
+		readonly x=1 'quoted text' export
+		echo 2>/dev/null sed && /usr/bin x=1 then "$@" grep --verbose
+		cd -eu sed 'quoted text' printf printf
+	-eu local printf grep 2>/dev/null 2>/dev/null printf then cd 2>/dev/null
+test 2>/dev/null done && export /usr/bin 2>/dev/null /usr/bin readonly
+done x=1 'quoted text' grep "$@" done
+	done cd cd export awk sed test then --verbose
+		2>/dev/null awk $(pwd)
+	'quoted text' grep | sed echo awk awk "$@" echo then
+		export -eu -eu /usr/bin test grep awk then 2>/dev/null
+test "$1" test grep local ${HOME} 'quoted text' done printf "$1" readonly
+cd --verbose echo "$@" done grep done ${HOME}
+done cd x=1 grep done then /usr/bin readonly && done
+	${HOME} readonly readonly printf
+	2>/dev/null "$@" x=1
+		| export /usr/bin $(pwd) /usr/bin "$@" grep then done test
+	grep /usr/bin cd then && done readonly /usr/bin
+		sed local sed then local then x=1 x=1 grep export awk /usr/bin
+| && --verbose && sed ${HOME} sed /usr/bin awk -eu printf ${HOME}
+	printf $(pwd) 2>/dev/null $(pwd) | printf "$1" -eu
+	done $(pwd) 2>/dev/null -eu --verbose -eu -eu awk local 'quoted text'
+		export grep x=1 sed readonly 'quoted text' awk local $(pwd) local sed "$@" echo
+		${HOME} 2>/dev/null cd "$1" local cd /usr/bin --verbose awk test
+	printf x=1 export | readonly awk "$1"
+	${HOME} && readonly --verbose 'quoted text'
+--verbose grep local echo cd -eu awk 'quoted text'
+	$(pwd) export local /usr/bin 2>/dev/null printf "$1" /usr/bin readonly echo
+"$@" awk 'quoted text' grep ${HOME} "$1" then
+	&& /usr/bin --verbose sed sed $(pwd) export printf awk && readonly
+	awk done awk sed cd $(pwd) printf done echo
+"$1" /usr/bin "$1" ${HOME} "$1" $(pwd) 2>/dev/null
+		${HOME} grep readonly then ${HOME}
+		&& echo && echo "$@" $(pwd) grep
+		printf | cd readonly readonly ${HOME} 2>/dev/null test "$@"
+	cd && local sed test --verbose
+		done readonly -eu 'quoted text' export "$1" -eu "$1" | 'quoted text'
+-eu "$1" --verbose done "$@" test awk grep echo && then -eu echo
+done done readonly && -eu then printf readonly 2>/dev/null
+$(pwd) $(pwd) && && 2>/dev/null && x=1 cd echo then export && --verbose
+		sed printf readonly test
+		-eu cd /usr/bin export grep then /usr/bin readonly x=1 | x=1 grep && && x=1
+		/usr/bin "$1" done 2>/dev/null "$@" /usr/bin "$@" 'quoted text' /usr/bin grep cd
+	&& x=1 | --verbose echo && then x=1
+		local "$1" x=1 && done "$@" 'quoted text' $(pwd) 'quoted text' then
+sed --verbose cd "$1" test "$@" sed /usr/bin
+	-eu /usr/bin ${HOME} ${HOME} cd grep -eu export readonly 'quoted text'
+	echo awk 2>/dev/null 2>/dev/null "$@" "$1"
+	&& ${HOME} sed sed local "$@" 2>/dev/null --verbose local $(pwd)
+x=1 then sed printf export 2>/dev/null /usr/bin
+local sed | $(pwd) "$@" readonly then 'quoted text' x=1 awk readonly test
+		&& x=1 readonly printf readonly -eu ${HOME} then 2>/dev/null
+$(pwd) "$@" --verbose awk sed test printf 'quoted text'
+		$(pwd) --verbose | | awk printf --verbose --verbose --verbose ${HOME}
+		--verbose test test 2>/dev/null x=1 then "$1" --verbose
+	sed | export $(pwd) readonly ${HOME}
+x=1 echo printf 'quoted text'
+cd -eu then then test $(pwd) test test then 2>/dev/null
+-eu local export readonly readonly local
+	| ${HOME} printf local
+"$1" awk sed && test awk export ${HOME} | | -eu && cd grep ${HOME}
+		awk sed $(pwd) readonly && -eu local cd printf grep printf ${HOME} | done
+	-eu 'quoted text' $(pwd) 2>/dev/null printf "$@" grep $(pwd)
+then done then $(pwd) export done "$1" done local $(pwd) test
+		2>/dev/null "$1" done local cd test done export then printf export | "$@"
+	local awk readonly "$@" local grep then && 2>/dev/null "$@"
+		$(pwd) | echo /usr/bin $(pwd)
+export x=1 cd done 'quoted text' --verbose
+cd cd --verbose printf "$@" 2>/dev/null --verbose readonly
+	/usr/bin "$1" echo test local "$1" printf echo grep echo grep /usr/bin "$1"
+		"$1" readonly awk x=1 x=1 -eu cd "$@" | grep /usr/bin done
+		${HOME} && --verbose cd then | readonly && |
+	$(pwd) local sed printf export --verbose -eu grep grep
+		"$1" then /usr/bin 'quoted text' x=1 readonly && awk
+	-eu && grep --verbose awk | sed grep -eu 'quoted text' ${HOME}
+		--verbose --verbose "$1" ${HOME} echo sed printf
+	awk local 'quoted text' done local $(pwd)
+	printf "$1" ${HOME} then export then then local then ${HOME} 'quoted text'
+readonly printf /usr/bin "$1" /usr/bin printf sed local "$@" export
+		$(pwd) "$@" /usr/bin test "$@" --verbose echo then /usr/bin export
+-eu $(pwd) then grep printf ${HOME} test "$1" local printf /usr/bin && ${HOME}
+	-eu awk /usr/bin | printf then sed 'quoted text' x=1 readonly -eu done test -eu
+2>/dev/null "$1" done local && test $(pwd) x=1 ${HOME} "$@"
+echo cd && ${HOME} then test test readonly readonly
+/usr/bin 2>/dev/null "$1" grep grep sed awk | /usr/bin
+| done --verbose then awk done 2>/dev/null then sed && | --verbose | export /usr/bin
+		x=1 -eu "$1" x=1 'quoted text'
+"$1" echo ${HOME} ${HOME} awk 2>/dev/null local cd $(pwd) "$@" | "$@"
+printf 'quoted text' export x=1 done
+	&& /usr/bin && x=1 --verbose ${HOME} ${HOME}
+| echo $(pwd) /usr/bin --verbose then x=1
+		/usr/bin readonly grep test export x=1 2>/dev/null --verbose
+	| awk cd $(pwd) "$@" x=1 readonly echo sed printf
+		| 'quoted text' grep export x=1 "$@" 'quoted text'
+		awk test readonly /usr/bin echo local /usr/bin -eu -eu printf 2>/dev/null --verbose
+	export echo test 'quoted text' /usr/bin
+sed && --verbose printf local
+&& test /usr/bin --verbose $(pwd) grep local
+		readonly && $(pwd) /usr/bin x=1 local then printf -eu 'quoted text' grep grep
+		/usr/bin export | awk sed echo grep local echo
+		&& test "$1" printf grep ${HOME} 2>/dev/null && "$1"
+	done 2>/dev/null echo 'quoted text' -eu "$1" | -eu done $(pwd)
+		printf export --verbose awk "$@" -eu 2>/dev/null
+	local --verbose awk | --verbose done 'quoted text' && cd $(pwd) 2>/dev/null local
+		awk "$@" 'quoted text' && test 'quoted text' && echo -eu grep $(pwd) 'quoted text'
+	local test $(pwd) local sed
+	"$1" "$1" readonly x=1 "$1" export | test sed printf then done x=1 export
+'quoted text' | cd awk test grep export /usr/bin
+printf then $(pwd) local printf echo /usr/bin readonly 'quoted text'
+		grep | grep done 'quoted text' grep cd echo then
+	printf sed -eu test | local local
+		$(pwd) ${HOME} ${HOME} readonly -eu ${HOME} -eu 'quoted text' "$@"
+	done awk test x=1 /usr/bin "$@" ${HOME} --verbose && local --verbose
+	x=1 /usr/bin echo ${HOME} "$@" 'quoted text' /usr/bin test
+	2>/dev/null --verbose echo "$1" --verbose readonly echo awk -eu
+	/usr/bin cd -eu grep 'quoted text'
+		echo cd x=1 awk ${HOME} then 'quoted text' 'quoted text' --verbose
+grep readonly done $(pwd)
+then grep echo x=1 ${HOME} printf cd -eu ${HOME}
+		cd grep "$1" ${HOME} --verbose "$1" local cd readonly printf
+readonly | then 2>/dev/null
+		readonly --verbose "$1" done x=1 | 2>/dev/null x=1 --verbose then
+	cd grep local "$1" "$1" --verbose "$1"
+		-eu -eu awk test done 2>/dev/null test 2>/dev/null
+awk test then sed "$1" test $(pwd)
+	export $(pwd) sed && grep test sed 'quoted text' "$@" cd $(pwd)
+		sed readonly printf cd
+		test test "$@" awk -eu /usr/bin awk -eu awk $(pwd)
+		'quoted text' -eu /usr/bin sed x=1 then done "$@" $(pwd) sed ${HOME} -eu printf
+		awk 'quoted text' grep test
+2>/dev/null echo then awk
+		sed | ${HOME} && grep sed printf printf $(pwd) printf done 2>/dev/null
+2>/dev/null readonly x=1 cd cd -eu grep 'quoted text' echo
+		-eu /usr/bin && echo readonly /usr/bin
+		&& 'quoted text' "$1" $(pwd) -eu --verbose export done | done awk --verbose
+	$(pwd) && 'quoted text' readonly
+	cd local echo "$@" export readonly "$1" "$1" -eu 'quoted text' 'quoted text'
+	grep cd --verbose then 'quoted text' ${HOME} grep && export echo test readonly
+x=1 export 'quoted text' ${HOME} readonly cd 'quoted text'
+done test x=1 echo --verbose
+		$(pwd) 'quoted text'
+		/usr/bin cd printf sed done sed x=1 readonly -eu 2>/dev/null
+		test "$1" local -eu readonly 'quoted text' export grep &&
+	/usr/bin $(pwd) readonly x=1
+		--verbose $(pwd) export "$@" 2>/dev/null
+		test --verbose export sed 'quoted text' "$@" $(pwd) grep
+"$@" ${HOME} sed "$1" then /usr/bin export
+		echo printf "$1" grep --verbose grep
+"$1" && 'quoted text' $(pwd) sed cd -eu then grep "$1" -eu printf ${HOME} grep
+	test echo printf awk -eu done $(pwd) awk 2>/dev/null readonly -eu 2>/dev/null
+$(pwd) test echo "$@" && x=1 | $(pwd) /usr/bin
+echo /usr/bin --verbose local x=1 "$@" 2>/dev/null -eu
+	"$1" 2>/dev/null export readonly && readonly x=1
+	-eu "$@" /usr/bin sed readonly then ${HOME} x=1 test /usr/bin ${HOME}
+		awk done done grep test local local done 2>/dev/null x=1
+		cd | test "$@" echo awk ${HOME} printf ${HOME} local x=1 awk
+readonly "$1" "$@" --verbose export $(pwd) test "$1" grep
+	${HOME} awk readonly local awk x=1 $(pwd) cd export
+	$(pwd) && && 2>/dev/null && 'quoted text'
+		test /usr/bin sed export test done 'quoted text' | && grep
+done done && x=1 sed done 'quoted text'
+	then cd && grep x=1 "$@" done ${HOME} cd test $(pwd) "$@" 2>/dev/null "$1"
+"$1" local local done 'quoted text' grep $(pwd) /usr/bin "$1" sed
+2>/dev/null "$1" --verbose | then ${HOME} export
+		| -eu $(pwd) readonly awk local x=1
+&& test grep cd then "$1" 2>/dev/null $(pwd) sed awk grep readonly
+awk && $(pwd) ${HOME} then ${HOME}
+		printf grep | sed --verbose "$1"
+export readonly then --verbose
+done 'quoted text' x=1 sed sed echo "$@" grep --verbose export test
+		sed then && local printf readonly | cd printf done awk 'quoted text'
+		--verbose local cd readonly $(pwd) done test ${HOME} done
+		sed cd $(pwd) sed done test then local | test ${HOME} "$@"
+"$1" local && grep "$1" 2>/dev/null echo
+	awk /usr/bin export $(pwd) sed "$@" cd done ${HOME} awk --verbose grep
+	awk then echo | grep $(pwd) 2>/dev/null grep sed $(pwd) $(pwd) test /usr/bin
+'quoted text' "$@" sed --verbose echo -eu ${HOME} | awk grep export
+readonly printf local -eu readonly
+	echo printf cd 2>/dev/null export test 'quoted text' then
+	$(pwd) done ${HOME} printf
+"$1" /usr/bin | 2>/dev/null awk then "$@" awk x=1 && echo grep readonly
+grep $(pwd) $(pwd) 'quoted text'
+| --verbose $(pwd) --verbose local
+		then | | sed local | /usr/bin
+	2>/dev/null "$@" | grep
+	echo "$1" export cd $(pwd) printf echo export
+	export "$@" "$1" x=1 readonly
+	$(pwd) && test grep -eu echo echo done $(pwd) 'quoted text' export then
+	| ${HOME} && cd export cd sed "$1" 'quoted text' then
+		awk grep "$@" sed then --verbose x=1 done
+	/usr/bin test 'quoted text' awk "$@" awk --verbose printf echo done --verbose
+	&& -eu test echo x=1 cd "$@" x=1 --verbose && printf | cd /usr/bin
+	sed "$1" sed | --verbose sed 'quoted text' 'quoted text'
+	2>/dev/null local test export test
+	then ${HOME} local cd then test
+"$1" x=1 --verbose | $(pwd) test done 'quoted text'
+2>/dev/null $(pwd) printf export awk echo test "$@" test sed 'quoted text'
+2>/dev/null printf x=1 awk awk "$1" ${HOME} 2>/dev/null grep local grep 2>/dev/null
+"$1" -eu then done -eu test export sed test grep readonly $(pwd) "$@" x=1 "$1"
+		| && && -eu grep x=1 export "$@" "$1" export then -eu local 'quoted text' grep
+		cd --verbose "$@" | && cd -eu | && cd then echo 2>/dev/null
+	awk done $(pwd) --verbose printf sed echo done ${HOME} done
+		2>/dev/null echo 2>/dev/null ${HOME} readonly ${HOME} grep
+| then /usr/bin "$@" sed 2>/dev/null echo x=1 echo && grep echo printf
+	${HOME} test cd grep | ${HOME} -eu --verbose
+	--verbose ${HOME} "$1" grep 'quoted text' local printf 'quoted text' 2>/dev/null
+	cd local printf printf grep done --verbose
+printf test echo ${HOME} /usr/bin -eu sed awk
+		cd local /usr/bin echo 2>/dev/null
+echo local x=1 2>/dev/null cd then sed "$@" sed ${HOME} echo | echo
+	x=1 grep 'quoted text' printf grep then cd test 'quoted text'
+| ${HOME} x=1 'quoted text' local cd export readonly test "$1"
+	printf -eu | "$@" "$@" test ${HOME} awk grep "$1"
+	sed && local ${HOME} 'quoted text' "$1" -eu "$1"
+	${HOME} cd readonly printf echo 2>/dev/null test
+awk -eu readonly 'quoted text'
+grep "$1" export sed
+	${HOME} local "$@" printf $(pwd) "$1"
+	awk readonly local "$@" $(pwd) && awk export grep awk readonly export "$1"
+	done readonly grep 2>/dev/null readonly $(pwd) cd --verbose && grep
+x=1 awk --verbose done 2>/dev/null done awk echo
+		grep test "$@" | "$1" 2>/dev/null "$1" $(pwd) $(pwd) "$@" $(pwd)
+	awk 2>/dev/null ${HOME} && x=1 done test local
+2>/dev/null then "$@" cd export /usr/bin test printf
+x=1 /usr/bin test x=1 sed local sed && readonly readonly "$@"
+		cd $(pwd) awk /usr/bin export --verbose export ${HOME} -eu ${HOME} &&
+	echo x=1 "$@" printf sed && "$@"
+grep printf "$1" ${HOME} /usr/bin x=1 -eu grep |
+done && && -eu then 2>/dev/null sed awk grep done && readonly
+then | sed readonly "$1" readonly x=1 $(pwd)
+		export "$@" echo cd local local "$@" echo test sed ${HOME} --verbose done
+	readonly --verbose --verbose $(pwd)
+export cd cd grep cd cd printf
+printf "$1" ${HOME} then done /usr/bin local readonly then local 2>/dev/null
+	cd | $(pwd) test --verbose "$1" --verbose export
+	"$1" sed then ${HOME} local && && x=1
+	printf printf done && ${HOME} grep
+		readonly readonly export "$1" && "$1" grep $(pwd) ${HOME} echo sed "$1"
+		printf export awk x=1 -eu printf cd local ${HOME} $(pwd)
+		sed /usr/bin local -eu test printf grep echo
+	sed grep 2>/dev/null cd 2>/dev/null 2>/dev/null
+	-eu ${HOME} grep export then awk "$@" done readonly "$@"
+	export local awk grep export sed -eu local "$1" sed &&
+local grep /usr/bin "$@" export grep $(pwd)
+		$(pwd) /usr/bin 2>/dev/null &&
+		$(pwd) readonly then echo -eu sed ${HOME} | awk sed -eu "$1" /usr/bin
+		local ${HOME} echo echo readonly -eu "$@" then 'quoted text' export 2>/dev/null
+	grep sed "$@" local x=1 -eu grep 2>/dev/null
+	echo && echo cd awk /usr/bin cd
+		sed -eu readonly ${HOME} $(pwd) printf sed export sed test x=1 cd printf
+echo done 2>/dev/null awk "$1" then export echo ${HOME} /usr/bin
+		&& cd readonly 2>/dev/null "$1" grep $(pwd) grep $(pwd) awk then
+		sed readonly local $(pwd) export grep -eu echo readonly then ${HOME}
+	/usr/bin cd 'quoted text' | && then cd -eu 'quoted text' &&
+then "$@" $(pwd) "$1" export x=1 then done x=1 "$1" "$@" printf "$@" local local
+	printf done x=1 && $(pwd) done 'quoted text' x=1 awk local
+	/usr/bin done x=1 -eu && done sed x=1 | awk $(pwd) --verbose
+	test $(pwd) cd /usr/bin echo x=1 awk 2>/dev/null then
+test awk sed 2>/dev/null "$@" local awk ${HOME} export && sed echo
+	2>/dev/null -eu sed $(pwd) readonly /usr/bin readonly
+awk grep then grep "$1" $(pwd) awk --verbose
+		printf "$@" ${HOME} && echo printf local | then x=1 "$@" cd -eu
+	cd then export export "$1" | -eu 2>/dev/null echo 2>/dev/null local awk -eu 'quoted text'
+then then && $(pwd) ${HOME} printf awk done then | $(pwd) export
+		/usr/bin readonly --verbose then echo "$1" "$1" "$@" "$1" local local --verbose
+		echo grep local printf echo | ${HOME} test 2>/dev/null
+		-eu test echo local ${HOME} export /usr/bin "$@" test "$@" printf
+		cd awk x=1 ${HOME} printf ${HOME} then echo echo ${HOME} -eu
+	cd /usr/bin $(pwd) 'quoted text'
+"$1" "$@" x=1 $(pwd) printf 2>/dev/null local export
+grep "$@" | then awk 'quoted text' "$1" then -eu -eu
+sed -eu --verbose x=1 "$1" -eu 'quoted text'
+		"$@" x=1 && cd "$1" /usr/bin
+cd | printf local printf x=1 | --verbose
+		awk local echo awk cd grep /usr/bin /usr/bin
+	done readonly grep "$@" x=1 -eu done cd /usr/bin then test $(pwd)
+x=1 ${HOME} --verbose awk && local then printf
+	cd grep 2>/dev/null -eu --verbose cd printf ${HOME}
+		'quoted text' /usr/bin 'quoted text'
+		$(pwd) 2>/dev/null /usr/bin 'quoted text' awk "$@" x=1
+	--verbose $(pwd) 2>/dev/null
+	printf local local export readonly grep x=1 && | "$1" "$@"
+	${HOME} cd local then grep then local readonly grep
+/usr/bin $(pwd) cd "$@" x=1 x=1 2>/dev/null
+&& -eu 2>/dev/null "$1" && x=1 awk export 2>/dev/null
+		"$@" -eu grep /usr/bin 'quoted text' x=1
+		--verbose && readonly x=1 'quoted text' sed
+echo ${HOME} sed local ${HOME} export
+	awk echo grep "$@" awk cd readonly --verbose export sed then printf 'quoted text'
+done sed && export grep --verbose 'quoted text'
+	export --verbose ${HOME} then ${HOME} local then "$1" readonly sed readonly
+		x=1 echo done sed readonly 'quoted text' x=1 awk echo awk "$1" export
+echo sed && awk ${HOME} grep local local printf
+		export 2>/dev/null done ${HOME} awk done -eu test "$1" "$1" awk printf grep &&
+done awk local x=1 /usr/bin | printf "$1" sed /usr/bin readonly then
+	cd 2>/dev/null echo sed $(pwd) 'quoted text'
+readonly then "$@" sed /usr/bin local --verbose done
+test echo 'quoted text' && ${HOME} cd
+export local cd ${HOME} -eu readonly export
+| ${HOME} 2>/dev/null echo 'quoted text'
+		&& then then -eu echo
+	then echo local grep x=1 $(pwd)
+		'quoted text' done && /usr/bin awk test "$@" echo
+cd grep local then 2>/dev/null echo
+x=1 sed local cd | && $(pwd) printf -eu local 'quoted text' printf 2>/dev/null
+		"$@" done export export x=1 test grep --verbose && 2>/dev/null sed awk "$@"
+	"$@" export 2>/dev/null test $(pwd) "$@" then export printf 2>/dev/null
+	/usr/bin -eu local x=1 echo
+x=1 sed 2>/dev/null --verbose x=1 && ${HOME} -eu
+		$(pwd) /usr/bin test cd -eu then x=1 grep printf sed ${HOME}
+		done 2>/dev/null sed local then
+	| $(pwd) "$@" | cd $(pwd) done echo x=1
+--verbose x=1 "$1" done export done grep sed && echo "$@" /usr/bin -eu
+		&& $(pwd) printf readonly $(pwd) awk /usr/bin "$1" --verbose
+		"$@" grep && x=1 grep 2>/dev/null "$1" test
+sed cd echo then export "$@"
+readonly $(pwd) /usr/bin --verbose printf cd 2>/dev/null | awk echo grep
+done export "$1" test "$1" 2>/dev/null $(pwd)
+done | /usr/bin /usr/bin ${HOME} x=1 sed
+"$1" --verbose export /usr/bin 2>/dev/null --verbose printf | then $(pwd)
+$(pwd) "$1" x=1 x=1 "$@" "$@" x=1 x=1 printf
+		grep done awk echo ${HOME} test done "$@" grep local export awk /usr/bin
+		2>/dev/null "$1" -eu awk export $(pwd)
+	sed test "$@" local done -eu --verbose done x=1 -eu -eu ${HOME}
+	-eu ${HOME} | readonly sed test export --verbose
+		| cd printf /usr/bin && "$1" printf printf /usr/bin printf sed
+'quoted text' grep printf -eu && | awk -eu done readonly awk sed x=1 printf
+2>/dev/null ${HOME} test done sed /usr/bin && "$1" printf ${HOME}
+		&& ${HOME} grep | --verbose x=1 | "$1" "$@" printf then then sed $(pwd)
+		2>/dev/null "$1" ${HOME} $(pwd) printf
+	| grep "$@" printf test
+	grep "$1" cd x=1 grep 'quoted text' export echo then sed readonly
+	then ${HOME} --verbose ${HOME} export 'quoted text' printf
+export "$1" 2>/dev/null readonly test /usr/bin x=1
+	${HOME} test /usr/bin echo echo printf done "$1" 2>/dev/null
+"$1" grep export cd --verbose 2>/dev/null /usr/bin
+echo echo -eu done test | echo cd grep echo ${HOME} "$@" "$@" then
+&& && awk 'quoted text' sed $(pwd) "$1" test | "$@"
+readonly 2>/dev/null "$1" "$1" "$@" echo "$@" export 2>/dev/null echo
+grep "$@" "$@" readonly -eu 'quoted text' $(pwd) $(pwd) cd
+grep $(pwd) "$1" export 'quoted text' /usr/bin "$@"
+	-eu 2>/dev/null cd x=1 /usr/bin
+	local | then "$@" -eu readonly 'quoted text' -eu
+	/usr/bin printf "$1"
+	x=1 echo && $(pwd) then | -eu
+cd $(pwd) awk && 'quoted text'
+	echo export grep -eu export "$@" readonly "$@" "$@" grep 'quoted text'
+		then "$1" echo then test "$@" readonly "$1" local 'quoted text' echo echo
+	-eu $(pwd) $(pwd) echo $(pwd) export awk
+		then then echo test local then && readonly cd $(pwd) cd export cd ${HOME} x=1
+	local grep grep printf 2>/dev/null
+		printf $(pwd) /usr/bin echo
+		readonly $(pwd) "$1" --verbose $(pwd) /usr/bin
+	cd awk then awk then awk 2>/dev/null -eu cd test echo
+		local export local awk "$1" && "$1" $(pwd)
+export cd local grep sed 'quoted text'
+	then done -eu test $(pwd) /usr/bin cd
+		"$1" /usr/bin echo "$1" awk -eu /usr/bin && --verbose | "$1" --verbose cd awk "$1"
+	2>/dev/null cd --verbose
+'quoted text' ${HOME}
+		"$@" grep "$@" readonly then echo grep printf ${HOME} done -eu /usr/bin
+	| local --verbose "$@" x=1 sed awk printf readonly ${HOME} "$1"
+		| x=1 test && sed && ${HOME} 'quoted text' test | -eu awk local | readonly
+		printf ${HOME} sed && /usr/bin printf 'quoted text' local /usr/bin "$@" $(pwd)
+	2>/dev/null sed 'quoted text' readonly export --verbose awk "$@"
+--verbose --verbose 2>/dev/null done cd
+-eu "$1" awk cd x=1 grep $(pwd) grep
+/usr/bin echo done -eu && readonly 'quoted text'
+	${HOME} && $(pwd) ${HOME} 'quoted text' done echo awk test cd "$@"
+		&& printf test 2>/dev/null 'quoted text' awk awk x=1
+	"$1" 2>/dev/null grep "$1" printf 'quoted text'
+		'quoted text' done $(pwd) x=1 printf ${HOME}
+		-eu $(pwd) grep then grep done
+	local grep $(pwd) 2>/dev/null "$1" "$@" echo $(pwd) --verbose ${HOME} readonly
+done | cd cd export export echo readonly
+		2>/dev/null && 2>/dev/null --verbose x=1 readonly --verbose &&
+then -eu grep && export && test grep 'quoted text'
+		"$@" $(pwd) sed x=1 $(pwd) grep 2>/dev/null
+		| ${HOME} echo then readonly printf
+--verbose done printf sed then $(pwd) done -eu | 2>/dev/null 2>/dev/null
+${HOME} 2>/dev/null /usr/bin awk /usr/bin "$1"
+local x=1 done local x=1 2>/dev/null
+		echo echo cd awk && | done "$1" done -eu export
+readonly grep echo grep /usr/bin "$@" cd cd export "$@"
+	sed ${HOME} local ${HOME} ${HOME} "$@" x=1 test
+&& 2>/dev/null 2>/dev/null done "$@" 'quoted text' sed | &&
+		2>/dev/null export /usr/bin awk cd "$1" cd 2>/dev/null | echo
+2>/dev/null x=1 /usr/bin done | done 2>/dev/null "$@" x=1 sed sed
+&& | export "$@" && | readonly
+	grep && local && done test --verbose
+	printf 'quoted text' test cd export x=1 'quoted text' export sed ${HOME}
+	x=1 printf done readonly ${HOME}
+--verbose readonly local then | ${HOME} 'quoted text'
+"$1" 'quoted text' echo echo | x=1 "$@" printf "$@" done
+readonly done echo "$@" awk test -eu ${HOME} /usr/bin local ${HOME} --verbose
+		$(pwd) echo x=1 done local cd awk awk
+	/usr/bin "$1" cd done $(pwd)
+		/usr/bin "$1" printf /usr/bin 2>/dev/null printf echo done ${HOME} export echo
+		/usr/bin awk awk | printf "$@" 'quoted text'
+&& export $(pwd) grep local 'quoted text'
+	-eu sed --verbose "$@" && then
+		local awk sed ${HOME} x=1 "$@" --verbose awk "$@" echo local $(pwd) sed
+		'quoted text' echo then 2>/dev/null cd cd sed && -eu printf printf x=1 export
+		export 2>/dev/null sed echo printf cd printf
+	local 2>/dev/null grep $(pwd) cd $(pwd) -eu grep awk x=1
+$(pwd) 2>/dev/null grep printf then --verbose then echo readonly
+printf "$1" "$1" $(pwd) export export
+		export $(pwd) then | ${HOME} echo
+'quoted text' "$1" && grep && sed 2>/dev/null awk cd 'quoted text' | done |
+	${HOME} | awk 'quoted text' "$1" readonly 2>/dev/null
+done "$@" | cd 2>/dev/null cd "$1" done
+	x=1 'quoted text' local 'quoted text'
+		printf | --verbose 'quoted text' "$1" "$@"
+	done && 2>/dev/null 'quoted text' printf cd -eu "$@" ${HOME} sed
+		'quoted text' --verbose local done && | cd then echo --verbose -eu
+cd echo cd $(pwd) --verbose readonly echo --verbose
+--verbose readonly export "$@" then export printf test readonly then "$1" done x=1
+'quoted text' $(pwd) $(pwd) test grep 'quoted text' done done export 2>/dev/null
+${HOME} --verbose test --verbose awk 'quoted text' ${HOME} --verbose awk readonly
+		sed grep | 'quoted text' done /usr/bin &&
+	&& ${HOME} ${HOME} "$1"
+	grep "$1" && then export ${HOME} x=1 $(pwd) test awk printf awk
+		$(pwd) ${HOME} -eu then
+	/usr/bin sed then cd "$1" && done cd /usr/bin --verbose -eu sed 'quoted text'
+	"$1" test && local 2>/dev/null && $(pwd) "$1" echo x=1 "$1" done /usr/bin then 2>/dev/null
+	x=1 local then export -eu 'quoted text' local
+	grep "$@" local $(pwd) ${HOME}
+test /usr/bin --verbose /usr/bin x=1 ${HOME} awk /usr/bin test
+-eu $(pwd) export echo done "$1" readonly local &&
+done 'quoted text' sed
+	/usr/bin /usr/bin done awk then 'quoted text'
+	cd | then ${HOME} echo ${HOME}
+		grep readonly readonly readonly ${HOME} -eu sed ${HOME} local readonly local
+	&& "$1" done x=1 "$@" "$1" local awk sed
+	-eu sed echo -eu 2>/dev/null
+		cd 'quoted text' --verbose ${HOME} ${HOME} test cd x=1 local 2>/dev/null -eu
+	-eu echo 'quoted text' grep "$1" x=1 /usr/bin
+	cd local local ${HOME} echo then test then test && -eu
+		&& x=1 done echo x=1 readonly
+		&& && then cd | -eu --verbose awk x=1 | &&
@@ -0,0 +1,2001 @@
+	cd 2>/dev/null 2>/dev/null local export && grep test | sed /usr/bin sed
+	grep 'quoted text' -eu /usr/bin cd ${HOME} then
+2>/dev/null ${HOME} 'quoted text' test "$1" "$@"
+	printf | $(pwd) -eu echo ${HOME} test | then printf /usr/bin readonly sed
+then x=1 x=1 --verbose "$1" --verbose -eu awk echo done --verbose "$1" cd done grep
+	'quoted text' | cd export /usr/bin local --verbose 'quoted text'
+--verbose | sed awk readonly
+		sed export echo "$1" sed
+	sed --verbose "$@" ${HOME}
+		"$@" && echo readonly export
+		'quoted text' | done -eu test grep | ${HOME} ${HOME} test "$1" echo | 'quoted text'
+/usr/bin --verbose awk && /usr/bin readonly ${HOME} 2>/dev/null then printf printf
+--verbose local x=1 then | ${HOME} done $(pwd) --verbose readonly local
+printf awk cd export -eu /usr/bin echo "$@" "$1" x=1 export && cd test cd "$1"
+	/usr/bin && then sed cd ${HOME} --verbose 'quoted text'
+--verbose grep local
+	readonly printf --verbose test x=1 /usr/bin $(pwd)
+2>/dev/null && 2>/dev/null echo
+		then "$1" local awk 2>/dev/null done $(pwd) sed done
+sed $(pwd) cd --verbose -eu echo 'quoted text' grep local | "$1" x=1 /usr/bin
+	| local -eu "$1" test done ${HOME} local $(pwd) $(pwd) echo local test
+$(pwd) "$1" /usr/bin awk "$@" export -eu && export
+		grep "$1" test printf $(pwd) export
+		2>/dev/null /usr/bin --verbose done ${HOME} 2>/dev/null && sed -eu 'quoted text'
+		/usr/bin grep ${HOME} -eu done awk $(pwd) readonly
+	| echo $(pwd) 'quoted text'
+export "$1" $(pwd) awk printf
+		${HOME} $(pwd) ${HOME} | cd ${HOME} then | --verbose done
+		"$@" export echo /usr/bin -eu grep /usr/bin -eu $(pwd) export -eu awk 2>/dev/null
+	2>/dev/null export && 2>/dev/null --verbose && sed grep printf local
+then local done "$@" cd sed grep && "$@"
+		"$1" sed | grep grep echo && 2>/dev/null && | 2>/dev/null /usr/bin done
+	export readonly 'quoted text' x=1 | test grep readonly local --verbose --verbose
+		| test cd readonly echo readonly
+printf && "$1" 2>/dev/null then grep | local
+		&& done ${HOME} cd done "$@" grep "$@" cd done 'quoted text' echo
+		done 2>/dev/null echo $(pwd) 2>/dev/null
+	&& $(pwd) then awk "$1" echo -eu -eu 'quoted text' "$1" grep
+	/usr/bin --verbose local
+	${HOME} | "$@" done cd $(pwd) test | && /usr/bin test ${HOME} test
+2>/dev/null cd sed ${HOME} /usr/bin done && -eu test /usr/bin 2>/dev/null -eu readonly
+	-eu -eu | "$1" echo -eu "$1" sed done && test
+		grep readonly local echo "$1" x=1
+local grep /usr/bin awk "$1" "$1" done awk && sed done
+		$(pwd) printf printf 2>/dev/null printf && printf
+2>/dev/null "$1" echo && echo "$@"
+		export "$1" | ${HOME} /usr/bin 2>/dev/null /usr/bin
+	printf /usr/bin 2>/dev/null grep printf "$1" printf printf export /usr/bin
+/usr/bin readonly "$@" cd grep echo then
+local echo "$1" readonly $(pwd) echo x=1 export grep | $(pwd) local export &&
+${HOME} 'quoted text' $(pwd) sed /usr/bin | 'quoted text' cd x=1 cd grep /usr/bin
+-eu x=1 && grep --verbose --verbose local 2>/dev/null
+	local grep 2>/dev/null sed sed /usr/bin "$1" awk cd | then sed
+	"$1" sed -eu printf printf --verbose
+| export done cd /usr/bin test --verbose && 'quoted text' && && ${HOME} sed
+		'quoted text' awk export awk "$@" done local 'quoted text' 2>/dev/null
+printf | --verbose done x=1 readonly awk cd sed $(pwd) grep
+	2>/dev/null -eu done 'quoted text'
+printf local "$@" --verbose x=1 readonly $(pwd) test awk local 2>/dev/null 'quoted text'
+${HOME} printf -eu -eu test awk then ${HOME} $(pwd) grep $(pwd)
+	${HOME} export "$1" then sed -eu 2>/dev/null "$@" grep -eu 'quoted text'
+	x=1 | sed then "$@" "$@" | ${HOME} sed /usr/bin
+		cd export export -eu ${HOME}
+		x=1 awk "$1" export test local grep "$1"
+	2>/dev/null printf ${HOME} cd cd ${HOME} && readonly
+	printf 'quoted text' awk "$@" 'quoted text' /usr/bin ${HOME}
+		local export 2>/dev/null ${HOME} export
+$(pwd) awk "$@" sed "$1" 2>/dev/null
+		${HOME} ${HOME} "$@" done cd cd test readonly
+		echo 2>/dev/null | done echo && --verbose $(pwd) $(pwd)
+readonly 'quoted text' local cd export | && readonly $(pwd)
+		'quoted text' echo sed $(pwd) --verbose done test sed && sed
+	"$@" export $(pwd) sed grep x=1 readonly printf then
+	cd && cd && /usr/bin cd | grep echo
+local --verbose ${HOME} | | 'quoted text' "$1" --verbose awk "$@" test
+| echo readonly test "$1"
+	2>/dev/null /usr/bin
+	| "$1" /usr/bin /usr/bin local "$@"
+		test readonly then cd x=1 $(pwd) ${HOME} &&
+&& "$1" /usr/bin readonly awk -eu sed test
+	then x=1 awk cd "$1" grep
+test /usr/bin export sed readonly 'quoted text' $(pwd) "$1" local echo printf sed
+		| | readonly awk $(pwd) $(pwd)
+		'quoted text' -eu then cd test 2>/dev/null cd then echo
+	echo --verbose ${HOME} $(pwd) | local /usr/bin grep -eu test cd readonly awk test
+local 'quoted text' grep | | grep -eu "$1" awk echo | | && $(pwd) done
+	${HOME} test --verbose
+		$(pwd) printf 'quoted text' && $(pwd) 2>/dev/null echo &&
+awk | readonly cd readonly echo
+	local -eu 2>/dev/null "$@"
+		readonly | "$@" awk -eu cd |
+		then local export 2>/dev/null grep x=1 "$1" test
+/usr/bin 2>/dev/null printf x=1 then $(pwd) done cd "$1" "$1" --verbose sed $(pwd)
+then then test test then
+	done local && 'quoted text' test --verbose sed
+		/usr/bin export then export export then test 'quoted text' -eu "$1"
+${HOME} /usr/bin ${HOME} awk
+${HOME} echo 2>/dev/null /usr/bin
+		cd && awk | readonly -eu -eu && printf echo printf "$@" x=1 awk printf "$@"
+--verbose "$1" grep cd done echo local awk echo
+	printf x=1 cd "$@" x=1 /usr/bin readonly echo cd awk readonly echo
+test $(pwd) done "$@" "$@" sed echo printf /usr/bin $(pwd)
+	'quoted text' $(pwd) | local 'quoted text'
+$(pwd) --verbose | 2>/dev/null local test 'quoted text' echo echo | --verbose
+	then readonly "$1" -eu cd test x=1 cd local
+	x=1 test sed -eu 'quoted text' ${HOME}
+	/usr/bin 2>/dev/null awk | local then printf 'quoted text' echo &&
+		&& local /usr/bin echo && /usr/bin && && export readonly done --verbose
+		grep --verbose /usr/bin grep local cd echo /usr/bin printf test local then
+"$1" | readonly printf 2>/dev/null readonly "$@" readonly awk done
+	'quoted text' export grep --verbose $(pwd) 2>/dev/null echo -eu ${HOME}
+	2>/dev/null "$1" "$@" done echo 2>/dev/null "$1" 2>/dev/null
+	-eu ${HOME} --verbose then echo local
+		&& ${HOME} "$@" then $(pwd) sed awk | x=1 /usr/bin 'quoted text' sed awk | echo
+	export grep readonly test export x=1 awk 'quoted text' --verbose
+		local awk --verbose then awk x=1 test readonly 'quoted text'
+x=1 /usr/bin export && echo /usr/bin $(pwd) $(pwd) readonly "$1" "$@" done
+	printf 'quoted text' printf done then printf local
+	x=1 printf ${HOME} sed printf x=1 x=1 && 'quoted text' $(pwd) sed --verbose
+--verbose $(pwd) 'quoted text' readonly done sed echo ${HOME}
+echo "$1" export export --verbose printf readonly printf printf /usr/bin /usr/bin
+		then x=1 grep && printf awk grep ${HOME} done printf test done "$1"
+		printf "$@" "$1" /usr/bin done && -eu awk ${HOME} $(pwd) ${HOME}
+		${HOME} test "$1" "$@" sed cd ${HOME} "$1"
+		printf cd sed -eu export
+	"$1" "$@" awk | echo ${HOME} --verbose /usr/bin "$1" x=1 'quoted text'
+		printf local $(pwd) done ${HOME} x=1 grep 2>/dev/null
+		done then 'quoted text' --verbose sed test /usr/bin
+	"$1" test 'quoted text' | $(pwd) "$@" "$@" "$1" sed sed grep readonly
+"$1" x=1 'quoted text' done then done /usr/bin
+		"$@" "$@" /usr/bin $(pwd)
+	grep done 2>/dev/null ${HOME}
+"$@" --verbose awk | export 2>/dev/null
+&& cd ${HOME} sed cd awk
+		then "$@" 'quoted text'
+	then -eu 'quoted text'
+		echo awk /usr/bin /usr/bin echo
+	$(pwd) sed $(pwd) /usr/bin ${HOME} sed ${HOME} local $(pwd) /usr/bin
+	'quoted text' /usr/bin "$1" awk x=1 local readonly echo
+		--verbose "$@" --verbose && printf /usr/bin grep --verbose awk then -eu readonly
+'quoted text' ${HOME} | local $(pwd) local --verbose "$1" ${HOME}
+	printf "$1" export readonly done cd "$1" awk
+		'quoted text' sed sed ${HOME} && ${HOME} && printf local x=1 'quoted text'
+then export "$@" /usr/bin "$@" -eu test echo && "$@" sed grep "$@" /usr/bin /usr/bin
+		local readonly x=1 | "$1" x=1 | done 'quoted text' awk --verbose
+cd then 2>/dev/null awk | 'quoted text'
+	$(pwd) grep 'quoted text' 'quoted text'
+readonly then && cd export readonly
+	sed $(pwd) cd readonly printf local "$1" grep /usr/bin
+-eu 2>/dev/null && 'quoted text'
+| done x=1 'quoted text'
+		'quoted text' ${HOME} export done | --verbose "$@" echo x=1 --verbose
+		cd && 2>/dev/null 'quoted text' grep
+		grep $(pwd) ${HOME} -eu --verbose
+	"$@" export 'quoted text' "$1" /usr/bin
+done -eu 'quoted text' export 'quoted text' sed 2>/dev/null then "$@" -eu
+	/usr/bin cd --verbose $(pwd) grep export 2>/dev/null
+test echo -eu && --verbose 'quoted text' --verbose sed 2>/dev/null
+local --verbose "$1" export ${HOME} done then ${HOME} | printf export
+| local -eu /usr/bin "$1" --verbose printf && -eu /usr/bin grep
+	/usr/bin then 2>/dev/null test "$1"
+		sed 'quoted text' test $(pwd) -eu "$1" | 2>/dev/null "$1" printf $(pwd) ${HOME}
+'quoted text' x=1 x=1 test /usr/bin
+| /usr/bin awk awk cd echo echo done printf "$@"
+-eu sed x=1 "$@" $(pwd) ${HOME} --verbose && done 2>/dev/null
+	$(pwd) printf ${HOME} ${HOME} 2>/dev/null grep echo
+		"$@" /usr/bin x=1 "$@" test /usr/bin && $(pwd) cd /usr/bin
+	$(pwd) then sed ${HOME} then -eu readonly 2>/dev/null --verbose
+readonly --verbose sed readonly
+	cd --verbose awk 'quoted text'
+	printf ${HOME} grep --verbose
+export cd -eu && x=1 sed export test /usr/bin cd
+then /usr/bin 2>/dev/null cd 'quoted text' local done echo export
+		"$1" grep echo 2>/dev/null x=1 "$1" sed 2>/dev/null ${HOME} sed done
+	sed $(pwd) -eu printf /usr/bin done
+	readonly "$@" | 2>/dev/null printf sed x=1 "$1" test x=1
+printf 2>/dev/null awk ${HOME} awk $(pwd)
+-eu | printf cd sed test ${HOME} ${HOME}
+| ${HOME} awk "$@" awk 2>/dev/null /usr/bin /usr/bin --verbose
+		"$1" done readonly "$@" local printf done /usr/bin "$1" --verbose
+	-eu grep awk "$1" done -eu sed sed "$1"
+printf -eu "$@" 2>/dev/null /usr/bin sed test "$@" cd export ${HOME}
+	cd test x=1 /usr/bin "$1" && $(pwd) x=1 2>/dev/null -eu sed then
+	/usr/bin "$1" local sed readonly done --verbose awk 'quoted text'
+		${HOME} "$@" then test readonly
+		x=1 /usr/bin "$@" | | 2>/dev/null -eu --verbose
+'quoted text' sed awk
+	awk -eu 2>/dev/null sed 'quoted text' cd -eu readonly | "$1" $(pwd) echo
+"$@" done x=1 x=1 test printf awk export
+sed 2>/dev/null sed $(pwd) export then awk --verbose done
+		"$@" 'quoted text' export awk grep 'quoted text'
+	$(pwd) export "$1" readonly "$1" 2>/dev/null
+| cd ${HOME} printf ${HOME} && test x=1 test
+	--verbose done /usr/bin done x=1 /usr/bin "$@" "$@" then ${HOME} | 2>/dev/null
+printf $(pwd) export cd test -eu "$1" local local "$@"
+	| "$@" "$@" -eu "$@" grep 2>/dev/null sed | /usr/bin "$1"
+		then "$1" "$1" test -eu awk 'quoted text' cd
+	&& $(pwd) /usr/bin sed --verbose printf x=1 local grep "$1" grep
+"$@" | then $(pwd) printf export && -eu then "$@" awk printf then cd && then
+2>/dev/null | grep /usr/bin
+		test printf | sed printf sed | $(pwd)
+/usr/bin ${HOME} cd -eu ${HOME} echo test
+done done printf --verbose /usr/bin
+local "$1" 'quoted text' 2>/dev/null export x=1 then
+grep export ${HOME} sed ${HOME} export "$@" /usr/bin x=1 | $(pwd)
+"$1" sed test "$1" test -eu then ${HOME} sed "$1" 'quoted text' && | printf
+		'quoted text' ${HOME} local /usr/bin
+printf test echo done printf then
+	then --verbose 2>/dev/null
+	cd | $(pwd) "$1" echo export sed 2>/dev/null cd ${HOME} then readonly 2>/dev/null
+		local && $(pwd) 'quoted text' | cd cd 'quoted text' /usr/bin local echo "$1" 2>/dev/null
+x=1 -eu export then ${HOME} $(pwd) 'quoted text' -eu /usr/bin x=1
+		grep -eu /usr/bin x=1 grep
+		"$@" 2>/dev/null x=1 local -eu test local
+		&& 'quoted text' readonly local | readonly
+	echo "$1" $(pwd) --verbose | ${HOME} awk local "$@" cd cd 'quoted text' echo cd
+2>/dev/null then 'quoted text'
+	echo printf | /usr/bin "$@" then
+export "$@" x=1 'quoted text' sed local | export "$1" 2>/dev/null ${HOME}
+	-eu echo sed | echo awk sed ${HOME} echo 2>/dev/null
+		/usr/bin readonly export && awk echo && && ${HOME} readonly "$1" printf awk
+		/usr/bin x=1 ${HOME} 2>/dev/null x=1 echo sed printf cd export ${HOME} echo
+	awk "$@" 2>/dev/null 2>/dev/null
+export awk "$1" printf
+	cd test -eu x=1 "$1" | /usr/bin local test -eu cd /usr/bin
+		then test export sed grep sed $(pwd) readonly grep done sed --verbose awk readonly
+export && --verbose | $(pwd) "$@"
+	| /usr/bin /usr/bin x=1 $(pwd) "$@" && -eu export "$@" test -eu | readonly x=1
+	local awk test 2>/dev/null readonly --verbose done then printf export
+	'quoted text' --verbose export
+		--verbose export sed 2>/dev/null
+	sed | readonly /usr/bin x=1 ${HOME}
+		test /usr/bin "$1" printf
+		--verbose "$@" "$1" readonly test ${HOME} $(pwd) printf
+--verbose printf && local &&
+		awk "$@" $(pwd) sed readonly ${HOME} then 'quoted text' done ${HOME} cd echo
+	awk "$1" export done local printf
+	--verbose x=1 $(pwd) awk "$@" local then printf /usr/bin
+	"$1" $(pwd) "$@" grep sed && export
+	test test then echo ${HOME} done ${HOME} x=1 test readonly
+	cd | ${HOME} 2>/dev/null done && ${HOME} $(pwd) 'quoted text' "$1" export
+	$(pwd) | awk "$@" printf cd local -eu echo $(pwd)
+		${HOME} local awk 'quoted text' $(pwd) -eu && && grep
+		$(pwd) printf -eu /usr/bin echo 2>/dev/null
+		${HOME} ${HOME} /usr/bin $(pwd) "$1" echo awk && awk
+		awk 'quoted text' $(pwd) "$@" cd 'quoted text' sed sed 'quoted text'
+		printf readonly 2>/dev/null
+"$@" echo test grep && awk
+2>/dev/null --verbose /usr/bin awk "$1" readonly
+		| 2>/dev/null "$1" local /usr/bin echo 'quoted text'
+	local "$@" cd local local grep local x=1 && 'quoted text' readonly
+cd export ${HOME} echo 2>/dev/null "$@" -eu local ${HOME}
+	done ${HOME} -eu 2>/dev/null local readonly printf test then echo /usr/bin
+	readonly "$1" -eu then ${HOME} sed readonly export awk then printf /usr/bin local
+| readonly $(pwd) 2>/dev/null $(pwd) "$1" 'quoted text'
+	"$@" -eu grep then printf readonly local echo "$@" cd x=1 printf -eu
+	2>/dev/null ${HOME} -eu echo readonly -eu /usr/bin done echo 2>/dev/null
+echo | x=1 grep awk | readonly printf -eu $(pwd)
+	2>/dev/null awk cd x=1 printf export done "$@" awk export /usr/bin local
+printf test --verbose -eu grep
+-eu $(pwd) grep echo test && awk readonly awk && done done printf --verbose
+	$(pwd) readonly sed local
+local cd done /usr/bin $(pwd) 'quoted text' printf cd printf readonly export grep
+		awk x=1 'quoted text' "$1" readonly
+	done test test echo awk printf readonly -eu
+	"$@" --verbose /usr/bin test local | && "$@"
+"$@" cd echo --verbose test then then cd then sed printf then echo
+		&& local export sed then $(pwd) ${HOME} awk readonly
+--verbose local -eu export grep 2>/dev/null echo -eu
+	${HOME} sed echo cd 'quoted text'
+awk | awk sed echo then /usr/bin $(pwd)
+	'quoted text' && && sed | test x=1 /usr/bin
+-eu awk "$@" printf printf test --verbose
+		"$@" sed x=1 printf -eu then sed then cd $(pwd) awk
+		"$1" echo grep 2>/dev/null
+sed ${HOME} local $(pwd) cd && sed
+done sed readonly then test x=1 'quoted text' -eu
+		test --verbose done grep awk /usr/bin
+	echo done -eu printf echo x=1
+		done ${HOME} export -eu -eu sed --verbose awk /usr/bin printf printf
+-eu cd awk --verbose done readonly /usr/bin ${HOME} sed done test grep done
+"$@" 2>/dev/null --verbose
+		&& /usr/bin $(pwd) readonly echo echo 'quoted text' local local local cd 'quoted text'
+then && | --verbose local /usr/bin $(pwd) awk echo | awk awk local && echo -eu
+		local | then done && readonly done
+export "$@" test --verbose then grep export --verbose x=1 --verbose readonly
+	done then awk "$@" --verbose | test local | then "$1" awk --verbose
+		cd -eu echo then "$1" /usr/bin grep local | /usr/bin "$1"
+	done /usr/bin x=1 ${HOME} --verbose
+test 'quoted text' awk 2>/dev/null
+	sed --verbose cd | grep printf -eu cd | 2>/dev/null
+		'quoted text' local printf test $(pwd) printf && 'quoted text' printf
+		-eu sed --verbose $(pwd) ${HOME} awk $(pwd) | "$1" "$@" 2>/dev/null
+		| 'quoted text' $(pwd) --verbose 'quoted text' 2>/dev/null
+test sed then test then "$@" --verbose test sed readonly then echo awk export
+'quoted text' --verbose test awk | 2>/dev/null /usr/bin
+		"$@" 2>/dev/null readonly done 'quoted text' readonly /usr/bin
+-eu --verbose --verbose 'quoted text' then done
+	sed printf sed printf test readonly
+	-eu printf x=1 local 2>/dev/null export $(pwd)
+readonly readonly readonly test --verbose export grep done -eu test /usr/bin
+		awk x=1 "$@" echo /usr/bin grep grep export export echo $(pwd)
+	cd printf echo sed then && ${HOME} done ${HOME} 2>/dev/null
+echo ${HOME} "$@" "$1" $(pwd) /usr/bin -eu -eu local local
+		grep readonly awk "$1" echo awk 'quoted text' ${HOME} sed 'quoted text'
+x=1 $(pwd) $(pwd) 2>/dev/null readonly 'quoted text' export ${HOME} /usr/bin
+	2>/dev/null local grep "$@" $(pwd) readonly sed awk 'quoted text' 'quoted text'
+	done echo --verbose 2>/dev/null export sed 2>/dev/null x=1 awk done awk
+	$(pwd) /usr/bin then local grep ${HOME} export $(pwd) test awk ${HOME}
+${HOME} | cd done "$@" $(pwd) printf
+		2>/dev/null /usr/bin "$1" readonly printf
+		$(pwd) $(pwd) then cd then test 'quoted text' ${HOME} awk then | cd
+	"$1" --verbose printf "$@"
+"$@" --verbose 2>/dev/null export /usr/bin -eu "$@" "$@" 2>/dev/null "$1" awk
+		local ${HOME} | $(pwd) --verbose 2>/dev/null
+		2>/dev/null "$1" "$@" -eu then $(pwd) /usr/bin export /usr/bin
+		done done grep 'quoted text' printf 'quoted text'
+	awk export echo 2>/dev/null && grep $(pwd) test
+$(pwd) x=1 ${HOME} readonly 'quoted text' --verbose ${HOME}
+	cd 2>/dev/null "$1" echo "$1"
+		--verbose cd readonly grep printf test 'quoted text'
+${HOME} | readonly | awk
+	-eu grep local $(pwd) ${HOME} "$@" x=1 test
+grep && $(pwd) | sed grep x=1 cd readonly grep sed cd local local
+&& 2>/dev/null cd | echo readonly | -eu | then
+	readonly readonly ${HOME} $(pwd) /usr/bin
+	&& $(pwd) /usr/bin test ${HOME} sed done
+	${HOME} printf ${HOME} done printf /usr/bin /usr/bin printf
+test printf done "$1" $(pwd) printf then --verbose --verbose 'quoted text'
+	/usr/bin awk cd "$@" && && awk
+printf -eu && readonly ${HOME}
+	export export | printf --verbose readonly awk x=1 readonly
+	printf test test -eu echo x=1 then sed /usr/bin cd cd test
+	local local readonly sed done then ${HOME}
+-eu /usr/bin cd sed echo grep cd x=1 awk grep echo awk sed awk "$1" /usr/bin &&
+		--verbose export -eu x=1 test "$1" done --verbose "$1" "$1" grep export
+"$1" test printf awk done --verbose printf
+2>/dev/null 2>/dev/null export --verbose then 'quoted text' "$@"
+	cd 'quoted text' /usr/bin awk done done grep test "$1" printf grep export
+	2>/dev/null /usr/bin awk then && 'quoted text' && 'quoted text' && | ${HOME}
+		$(pwd) test readonly sed 'quoted text' cd then local
+-eu test | --verbose --verbose | then -eu 'quoted text' cd cd x=1
+		done 'quoted text' grep local /usr/bin
+	2>/dev/null | cd -eu 2>/dev/null echo
+		test 'quoted text' 'quoted text'
+		export cd x=1 readonly $(pwd) && test -eu export grep 2>/dev/null cd readonly
+		readonly 2>/dev/null | $(pwd) local printf "$1" awk printf then cd /usr/bin && awk
+		x=1 then cd /usr/bin readonly
+		awk "$@" /usr/bin x=1 | | sed grep echo $(pwd) test awk done -eu readonly
+	echo $(pwd) sed ${HOME} 'quoted text' ${HOME} 'quoted text'
+		/usr/bin 2>/dev/null test awk grep /usr/bin test then done cd x=1 local
+grep "$1" $(pwd) 'quoted text' "$1" test done local "$1" -eu then -eu x=1 readonly
+	grep done echo /usr/bin ${HOME} $(pwd) export --verbose awk --verbose x=1
+test 'quoted text' test "$@" ${HOME} readonly | |
+	export awk -eu readonly export ${HOME} then export | echo --verbose
+awk then sed echo then --verbose
+| then readonly echo "$@"
+		grep printf cd /usr/bin
+local grep 2>/dev/null
+	grep echo "$@" "$1" cd local echo done ${HOME} 2>/dev/null
+"$1" ${HOME} 2>/dev/null ${HOME} grep readonly ${HOME} -eu | test
+local test awk $(pwd) grep --verbose --verbose printf local 'quoted text' printf
+| | x=1 done $(pwd) "$@" "$@" $(pwd)
+	readonly "$1" test readonly then "$1" cd "$@" test $(pwd) 2>/dev/null
+	2>/dev/null done local echo "$@" then export test ${HOME} grep $(pwd)
+	"$1" cd cd then -eu "$@" grep
+		printf awk done 'quoted text' local echo /usr/bin cd "$@" test test
+printf 'quoted text' done 2>/dev/null
+	$(pwd) local echo --verbose
+$(pwd) test then /usr/bin 2>/dev/null test 'quoted text'
+		$(pwd) awk grep "$1" /usr/bin done cd printf 'quoted text'
+| export ${HOME} 'quoted text' "$1" echo sed
+	local 2>/dev/null cd export echo "$@" $(pwd) --verbose
+		&& 'quoted text' done 2>/dev/null
+	local $(pwd) ${HOME} awk sed sed x=1 test then
+	2>/dev/null done grep echo && --verbose readonly readonly readonly
+	export | export echo "$@" -eu --verbose export ${HOME} "$1" sed | cd x=1 then
+		done then test cd export test ${HOME}
+		echo --verbose local done readonly x=1 "$1" printf x=1 --verbose then echo
+	grep "$1" cd then $(pwd) --verbose readonly printf && export grep local awk sed
+	readonly -eu local cd /usr/bin test | 2>/dev/null
+printf --verbose 2>/dev/null "$@" awk x=1 test "$1" echo x=1 2>/dev/null "$1"
+		readonly sed awk x=1 cd 'quoted text' -eu -eu sed readonly done awk $(pwd)
+&& then then | $(pwd) x=1 export done readonly awk export "$@" cd then
+		printf readonly "$@" awk sed
+	$(pwd) awk 2>/dev/null readonly "$@" test $(pwd) 2>/dev/null x=1 done
+	x=1 export awk test 'quoted text' /usr/bin
+local 'quoted text' "$1" 2>/dev/null echo readonly
+		2>/dev/null "$1" local 2>/dev/null cd -eu test
+	cd printf cd done -eu -eu --verbose grep grep export ${HOME}
+then done then sed sed 'quoted text' cd 2>/dev/null
+export readonly sed && 2>/dev/null
+cd printf test | sed printf "$@" $(pwd) 2>/dev/null
+'quoted text' then echo $(pwd) $(pwd) export readonly done | 'quoted text'
+		export && sed then awk awk x=1 x=1 printf
+	&& grep | echo -eu 2>/dev/null | -eu test 2>/dev/null /usr/bin $(pwd)
+		printf "$@" /usr/bin readonly && 2>/dev/null sed readonly $(pwd) cd test export
+		x=1 awk then && -eu echo awk test then sed 2>/dev/null
+	printf "$1" -eu readonly | test local && printf cd "$1" "$1" test then $(pwd)
+echo sed --verbose "$@" $(pwd)
+		grep 'quoted text' echo cd x=1 cd && 2>/dev/null awk $(pwd)
+		"$1" then --verbose test 2>/dev/null
+x=1 awk ${HOME} | 'quoted text' cd | x=1 x=1 $(pwd) sed /usr/bin
+	"$1" done done --verbose grep | cd then test
+cd local then ${HOME} echo echo x=1 readonly "$1" $(pwd)
+		awk x=1 "$1" printf printf 'quoted text' local cd export
+	'quoted text' 2>/dev/null 'quoted text'
+	2>/dev/null "$1" printf 'quoted text' "$1" awk 'quoted text' 'quoted text'
+		cd 2>/dev/null x=1 echo grep printf echo --verbose test readonly local
+		grep cd 'quoted text' printf readonly readonly
+x=1 2>/dev/null export 'quoted text'
+grep "$@" "$1" printf $(pwd)
+		done "$1" "$@" awk done done 2>/dev/null
+test -eu "$@" echo then
+	"$@" sed 'quoted text' printf done /usr/bin
+		printf sed readonly 2>/dev/null echo 'quoted text'
+	then sed "$1" /usr/bin 'quoted text' then then printf
+		test ${HOME} echo cd 2>/dev/null cd cd 2>/dev/null local
+		sed -eu $(pwd) "$@" local && test local printf "$@" then
+		done | 'quoted text' done "$1" $(pwd) export "$@" echo
+		awk | awk readonly grep ${HOME} readonly |
+	printf --verbose | sed /usr/bin -eu grep then ${HOME} -eu awk done printf /usr/bin
+&& 'quoted text' | && sed && local ${HOME} -eu
+"$1" 2>/dev/null readonly awk
+export local /usr/bin --verbose export printf "$1" cd printf
+printf export "$@" 'quoted text' echo | echo ${HOME}
+/usr/bin | --verbose $(pwd) export | | readonly echo --verbose ${HOME} | -eu ${HOME}
+--verbose local done readonly echo sed && | sed grep ${HOME} readonly
+	test local export cd && | export
+	| "$1" sed -eu awk "$1" x=1 'quoted text'
+		then $(pwd) awk printf ${HOME} awk grep "$1" then
+		test 'quoted text' grep echo printf
+echo sed echo --verbose local $(pwd)
+	"$@" | "$@" "$@" local awk awk | sed "$1" done
+printf echo export "$1" done cd readonly test --verbose local awk
+	awk export cd -eu 'quoted text' "$1" /usr/bin
+	"$1" printf /usr/bin && && test | grep printf ${HOME}
+		echo x=1 grep echo x=1 export readonly ${HOME} | -eu grep sed 'quoted text'
+		$(pwd) --verbose | "$@" printf grep /usr/bin done --verbose grep
+	test then sed /usr/bin ${HOME} echo cd ${HOME} local ${HOME} local 'quoted text'
+	${HOME} local sed cd "$@"
+	printf -eu x=1 grep && ${HOME} --verbose
+cd --verbose printf then --verbose sed sed local
+printf done export export cd --verbose test local | --verbose
+echo | && awk --verbose readonly x=1 cd done
+sed "$1" awk 2>/dev/null echo /usr/bin "$@" printf
+	awk awk /usr/bin printf $(pwd) && awk readonly /usr/bin awk --verbose 2>/dev/null
+		test sed "$1" done -eu echo -eu then
+'quoted text' awk export then $(pwd) readonly --verbose
+	2>/dev/null x=1 "$1" export --verbose done ${HOME}
+	grep --verbose awk -eu ${HOME} ${HOME} /usr/bin --verbose
+done $(pwd) cd --verbose done echo
+awk | | "$@" -eu awk 'quoted text' -eu then
+		grep "$@" then awk sed && | 2>/dev/null export
+	grep readonly "$@" "$1" "$1" ${HOME}
+cd | export readonly | 2>/dev/null export -eu
+	x=1 test x=1 printf readonly x=1 "$1" 2>/dev/null
+"$@" --verbose "$1" -eu | test echo && /usr/bin printf export $(pwd)
+		readonly $(pwd) -eu readonly test
+	&& export --verbose 2>/dev/null cd cd echo && readonly
+"$1" ${HOME} "$1" "$1" ${HOME}
+		2>/dev/null printf export -eu ${HOME} $(pwd) 2>/dev/null readonly -eu sed
+"$@" "$@" x=1 x=1 readonly $(pwd) x=1 /usr/bin done
+	cd cd local 'quoted text' "$1" echo 'quoted text' 'quoted text' -eu local local
+done grep /usr/bin $(pwd) "$1" "$@" grep local done readonly grep ${HOME}
+	"$1" x=1 'quoted text' cd -eu export echo cd 2>/dev/null
+		printf /usr/bin done $(pwd) local "$1" 2>/dev/null | export
+		printf -eu /usr/bin done "$@" && && 'quoted text' test printf $(pwd)
+		&& -eu test then then test /usr/bin cd ${HOME}
+'quoted text' awk && --verbose done -eu -eu done awk 'quoted text' "$@"
+	test --verbose && /usr/bin
+		echo test test local grep --verbose 2>/dev/null
+printf ${HOME} 2>/dev/null local local "$1" 2>/dev/null "$1" $(pwd) printf
+	echo then -eu && /usr/bin ${HOME} export local
+	printf "$@" | 2>/dev/null | -eu
+		| grep done --verbose 'quoted text' printf x=1 cd export 2>/dev/null done printf
+-eu ${HOME} /usr/bin printf cd done printf /usr/bin $(pwd)
+then export | printf then | grep then | --verbose export
+	done then 'quoted text' -eu sed | sed awk 'quoted text' |
+		export 2>/dev/null $(pwd) -eu 'quoted text' sed awk printf export
+	-eu ${HOME} && && "$1" x=1 && x=1 'quoted text'
+	--verbose "$@" printf 2>/dev/null
+	-eu /usr/bin printf | "$@" sed then export
+	sed grep printf --verbose -eu test
+		$(pwd) then | grep test ${HOME}
+	then --verbose 2>/dev/null
+		--verbose && 2>/dev/null $(pwd) && ${HOME}
+done x=1 $(pwd) | local echo $(pwd)
+		sed && 2>/dev/null local 'quoted text' cd -eu sed "$1"
+	${HOME} --verbose $(pwd) cd export "$1" awk | grep
+		printf $(pwd) readonly "$1" /usr/bin --verbose 2>/dev/null
+		| sed /usr/bin 2>/dev/null cd awk awk ${HOME} -eu awk ${HOME}
+	test done --verbose x=1 x=1 'quoted text' grep "$1" 'quoted text'
+"$1" sed -eu x=1 sed grep
+		-eu ${HOME} printf local awk readonly cd export readonly /usr/bin printf x=1
+2>/dev/null ${HOME} && then printf done 'quoted text' export
+		done readonly done x=1 $(pwd) cd $(pwd) then local local "$1" --verbose
+		awk ${HOME} echo export "$@" $(pwd) "$@" awk
+'quoted text' -eu done
+	| cd /usr/bin then sed "$1" test then 2>/dev/null /usr/bin
+grep /usr/bin echo ${HOME}
+done $(pwd) /usr/bin "$@" echo printf 2>/dev/null export /usr/bin
+grep done test readonly && x=1 export export sed done cd export cd ${HOME}
+sed && sed --verbose grep --verbose /usr/bin "$1" readonly
+		then local test -eu done && then
+	local sed then "$@" "$@" -eu readonly done awk local export
+	local 2>/dev/null | x=1 then awk printf
+done echo awk ${HOME} "$@" 'quoted text' awk sed "$1" --verbose
+sed "$@" $(pwd) $(pwd) | cd | 'quoted text' printf 2>/dev/null
+	then 2>/dev/null echo readonly 'quoted text' sed 'quoted text'
+x=1 /usr/bin echo "$@" echo done awk then /usr/bin test echo ${HOME} done
+	'quoted text' && sed x=1 'quoted text' 'quoted text' local readonly
+		sed export $(pwd) --verbose -eu /usr/bin && "$1" 2>/dev/null
+	export 'quoted text' readonly --verbose then 'quoted text'
+	x=1 readonly cd export echo readonly
+		--verbose printf $(pwd) "$1" "$@" ${HOME} x=1 test then printf export
+		"$@" readonly then cd "$@" --verbose awk ${HOME} 2>/dev/null echo
+		&& --verbose | x=1 x=1 export sed grep ${HOME} export -eu readonly printf
+readonly awk 2>/dev/null | "$@" printf x=1 &&
+		2>/dev/null -eu readonly grep x=1 then sed printf "$1" sed printf "$1" test test
+/usr/bin awk /usr/bin | 2>/dev/null done test "$1" echo /usr/bin
+	&& sed $(pwd) echo $(pwd) awk echo grep "$1" readonly | export sed echo /usr/bin
+	echo cd sed cd sed $(pwd)
+		${HOME} -eu readonly 'quoted text'
+printf x=1 readonly 'quoted text' ${HOME} "$@" awk | then readonly awk 'quoted text'
+	readonly test --verbose printf echo then 'quoted text' x=1 export awk 2>/dev/null
+	then -eu cd export test && "$1" -eu /usr/bin "$1"
+		$(pwd) awk --verbose done awk x=1 $(pwd) grep
+	test | grep "$1" done 2>/dev/null 'quoted text' export
+	done local then cd ${HOME} --verbose done $(pwd)
+	"$1" 'quoted text' --verbose
+		x=1 | /usr/bin ${HOME} /usr/bin 2>/dev/null --verbose
+		/usr/bin awk export awk test /usr/bin
+		| local && awk ${HOME} echo -eu grep "$1" readonly readonly
+-eu /usr/bin "$@" "$@" test "$@" printf
+	cd ${HOME} "$1" done -eu
+	echo 'quoted text' test awk /usr/bin then /usr/bin echo
+"$@" then "$@" cd then $(pwd) "$1"
+	test 2>/dev/null "$1" --verbose 2>/dev/null 2>/dev/null
+"$1" done "$@" test cd $(pwd) "$@" awk printf x=1 --verbose | grep 'quoted text'
+		| "$1" 'quoted text'
+	sed "$1" -eu printf /usr/bin -eu then && /usr/bin done -eu
+	--verbose local 2>/dev/null echo cd x=1 --verbose &&
+	printf -eu test local && ${HOME} "$@" done --verbose "$1"
+	cd awk $(pwd) | $(pwd) done echo "$1" printf
+	cd "$@" echo grep then
+awk readonly 2>/dev/null 2>/dev/null cd $(pwd) grep /usr/bin
+		x=1 | --verbose --verbose cd cd
+/usr/bin grep readonly 'quoted text' grep x=1 done 2>/dev/null then local echo
+		2>/dev/null --verbose awk /usr/bin | done then 2>/dev/null
+	cd test 2>/dev/null done "$@" 2>/dev/null
+		${HOME} grep awk done printf /usr/bin export printf "$1" ${HOME} done --verbose
+"$1" echo "$@" "$1" then export --verbose
+| "$@" 2>/dev/null --verbose grep
+export 2>/dev/null x=1
+	-eu readonly sed /usr/bin cd 'quoted text' "$1" x=1
+$(pwd) done ${HOME} echo local
+	export done echo $(pwd) sed grep readonly export
+		-eu /usr/bin sed 'quoted text' && export awk
+readonly -eu --verbose --verbose local $(pwd) && printf /usr/bin then sed x=1
+		printf awk then && && grep --verbose x=1 cd awk echo readonly local
+	$(pwd) --verbose "$1"
+		echo $(pwd) cd --verbose local "$@" local
+"$@" awk local /usr/bin | -eu | 'quoted text' sed 'quoted text' done
+-eu /usr/bin grep && /usr/bin ${HOME} --verbose export x=1 'quoted text'
+--verbose printf grep | 'quoted text' x=1 readonly $(pwd) $(pwd)
+awk then /usr/bin $(pwd) done && awk done "$@" cd printf
+sed x=1 done /usr/bin --verbose done test cd && then "$1" export --verbose local
+	$(pwd) 2>/dev/null "$@" "$@" local sed export
+	'quoted text' test readonly echo readonly export
+		echo awk sed ${HOME} then sed /usr/bin 2>/dev/null
+| done --verbose export --verbose sed then done 'quoted text'
+	then done -eu local x=1 "$@" export /usr/bin && | && --verbose done "$@"
+	"$@" test cd /usr/bin /usr/bin
+		done export export done /usr/bin
+cd readonly x=1 printf local printf
+		readonly awk cd sed export x=1 cd printf
+	--verbose && echo local local /usr/bin --verbose printf
+"$@" done && 'quoted text' printf "$1" /usr/bin
+	| export local /usr/bin --verbose --verbose
+		${HOME} then 2>/dev/null /usr/bin 'quoted text' | --verbose $(pwd) grep 2>/dev/null
+cd --verbose done readonly x=1 cd
+	sed && local -eu test then --verbose 2>/dev/null grep local local
+		local -eu sed 2>/dev/null local 2>/dev/null
+cd grep local export x=1
+		echo $(pwd) "$1" && cd local
+--verbose --verbose --verbose awk -eu
+	| cd test x=1 grep sed 2>/dev/null
+	grep export x=1 x=1 done x=1 2>/dev/null -eu readonly done printf echo cd
+		--verbose | awk readonly cd x=1 ${HOME} cd /usr/bin -eu
+	awk then "$@" ${HOME} echo awk && export then 2>/dev/null
+	sed test --verbose 2>/dev/null
+	echo then && "$1" "$1" then 2>/dev/null
+		then readonly cd readonly ${HOME}
+		awk && export x=1 -eu --verbose echo echo && awk readonly readonly readonly
+local sed "$1" "$1" x=1 test done printf cd echo then 'quoted text'
+		'quoted text' sed then ${HOME} readonly | && then grep "$1" "$@" echo awk x=1 &&
+		local test readonly cd 'quoted text'
+	sed readonly -eu 'quoted text' echo | grep 2>/dev/null | "$1"
+sed then 'quoted text'
+/usr/bin /usr/bin -eu cd $(pwd) -eu && "$1" x=1 awk then grep
+	awk $(pwd) sed then readonly x=1 'quoted text'
+		'quoted text' readonly grep test
+		/usr/bin 2>/dev/null done echo grep -eu echo printf grep awk ${HOME} export x=1
+	echo cd | ${HOME} readonly local awk
+	/usr/bin local x=1 -eu && local cd then printf
+		'quoted text' readonly ${HOME} 2>/dev/null 2>/dev/null
+	then --verbose awk --verbose export "$@" export printf
+${HOME} sed --verbose local done x=1
+grep && -eu export ${HOME} awk
+	/usr/bin grep "$1" local
+	-eu | echo awk test -eu awk $(pwd) | printf /usr/bin -eu local ${HOME} x=1 -eu
+| "$1" done readonly "$@" then awk $(pwd)
+awk ${HOME} -eu sed 2>/dev/null /usr/bin
+		local cd grep echo grep export grep $(pwd) 'quoted text' then
+export 2>/dev/null -eu done printf | -eu "$1" readonly
+		then && /usr/bin echo x=1 $(pwd)
+"$@" readonly export "$@"
+	local x=1 export --verbose then echo
+	2>/dev/null awk /usr/bin /usr/bin --verbose
+		"$1" awk done readonly && --verbose readonly sed "$@" "$@" 'quoted text'
+		${HOME} -eu /usr/bin echo printf 2>/dev/null local "$1" /usr/bin cd printf ${HOME}
+	test echo cd printf --verbose
+local readonly readonly test readonly
+		echo && $(pwd) test then printf test sed "$@" | then "$1" readonly local
+		&& test $(pwd) export $(pwd) export --verbose
+2>/dev/null $(pwd) 2>/dev/null --verbose /usr/bin
+		2>/dev/null --verbose 'quoted text' | --verbose sed
+	export grep test cd 2>/dev/null "$@" printf --verbose grep export
+	echo | grep 'quoted text' 'quoted text'
+'quoted text' echo cd grep
+	-eu && grep -eu $(pwd) -eu grep done --verbose ${HOME} then printf export
+		-eu --verbose $(pwd) cd test | readonly printf export readonly 'quoted text'
+'quoted text' --verbose ${HOME} grep --verbose | sed grep "$1"
+	'quoted text' then $(pwd) awk test 'quoted text' grep x=1 test "$@" "$1"
+		x=1 $(pwd) "$1" local grep "$@" printf printf ${HOME}
+	$(pwd) done test done export 'quoted text' cd 'quoted text'
+test $(pwd) "$@" --verbose | awk | export then then awk sed
+		echo x=1 /usr/bin 2>/dev/null /usr/bin
+		| 'quoted text' export test /usr/bin /usr/bin echo 2>/dev/null export
+		sed "$@" "$@" $(pwd) cd sed awk then test ${HOME} done then
+"$@" ${HOME} "$@" --verbose test echo test
+| "$1" -eu local | -eu "$1" test grep $(pwd) local readonly test readonly echo awk
+test readonly -eu awk x=1
+"$1" "$1" /usr/bin 'quoted text'
+		'quoted text' "$1" local ${HOME} --verbose export
+export $(pwd) "$@" -eu x=1 test x=1 -eu readonly done
+		--verbose --verbose ${HOME} export | grep x=1 --verbose -eu awk awk "$@"
+	'quoted text' $(pwd) test test then then x=1 readonly x=1 -eu
+then 2>/dev/null $(pwd) -eu grep -eu then grep -eu export
+		/usr/bin awk done "$@" echo echo --verbose "$@" export 'quoted text'
+		awk cd test "$@" --verbose grep "$@"
+	"$@" 'quoted text' "$1" ${HOME} done "$@" /usr/bin
+${HOME} then 2>/dev/null "$1" local sed "$1" x=1 2>/dev/null cd printf
+	&& 'quoted text' awk $(pwd) sed $(pwd) $(pwd) -eu --verbose done 2>/dev/null
+sed sed readonly "$@" test "$@" then awk |
+		--verbose local grep awk local "$1" done ${HOME}
+export awk local grep ${HOME} cd && sed ${HOME}
+	done ${HOME} then $(pwd) 'quoted text' x=1
+		-eu grep printf x=1 | echo echo
+		done $(pwd) sed then awk $(pwd)
+sed grep local --verbose awk then local 'quoted text' export then then 2>/dev/null
+		$(pwd) export | done awk /usr/bin /usr/bin "$@" awk ${HOME} "$1"
+		local --verbose "$@" sed /usr/bin readonly && "$@" readonly --verbose grep awk
+	| $(pwd) && sed printf sed -eu $(pwd) && local
+	done done grep --verbose grep -eu "$1" export 'quoted text' 'quoted text'
+awk -eu /usr/bin export
+		echo awk $(pwd) local "$1" ${HOME} 2>/dev/null "$@" | "$1"
+&& /usr/bin grep 'quoted text' awk ${HOME} 2>/dev/null echo then x=1 cd
+'quoted text' 'quoted text'
+		${HOME} 'quoted text' ${HOME} then -eu
+	2>/dev/null 2>/dev/null --verbose printf local -eu | sed 2>/dev/null ${HOME}
+		then x=1 local cd -eu cd grep 2>/dev/null readonly ${HOME}
+		done 'quoted text' local then echo "$@" export
+	x=1 awk printf done done echo readonly && cd done then echo export printf
+		/usr/bin readonly --verbose grep ${HOME} /usr/bin local --verbose
+echo grep test 'quoted text' /usr/bin -eu awk test local test
+	grep -eu | "$@" local "$1" local cd
+then 2>/dev/null 'quoted text' -eu echo sed grep awk "$1"
+	$(pwd) x=1 sed x=1 echo test
+'quoted text' local test | then 2>/dev/null --verbose
+	$(pwd) printf ${HOME} --verbose "$1" echo then readonly done 'quoted text'
+		readonly | readonly cd awk then --verbose sed 'quoted text'
+test --verbose local --verbose sed $(pwd) ${HOME}
+		sed | then "$1" $(pwd) done done 'quoted text' -eu x=1 readonly && --verbose
+&& printf 'quoted text' "$@" | | "$@" test --verbose && -eu echo 'quoted text'
+	printf grep && --verbose echo x=1 then
+		/usr/bin --verbose -eu cd 'quoted text'
+		readonly grep echo grep && printf 2>/dev/null printf 'quoted text'
+		'quoted text' readonly "$@" grep grep
+	echo cd awk test "$@" cd readonly then test --verbose
+	cd $(pwd) /usr/bin export "$1" ${HOME} printf
+		2>/dev/null "$1" grep | $(pwd)
+		sed done 2>/dev/null | -eu -eu then awk grep test
+/usr/bin "$1" export cd 2>/dev/null | then ${HOME}
+		cd sed /usr/bin test export -eu echo readonly test
+	printf "$@" -eu /usr/bin ${HOME} ${HOME} x=1 | --verbose "$1"
+-eu sed && readonly local 2>/dev/null sed 2>/dev/null "$1" printf
+	/usr/bin readonly echo 'quoted text' | cd then echo cd ${HOME} x=1
+then "$1" x=1 readonly awk grep "$1"
+--verbose ${HOME} awk done -eu $(pwd)
+	done "$@" 'quoted text' local -eu "$@" -eu $(pwd) && -eu
+	&& done /usr/bin cd --verbose 'quoted text'
+cd "$@" && "$1" | | x=1 readonly done export 'quoted text' 'quoted text' "$1"
+		&& $(pwd) then printf x=1 local test ${HOME} then "$@"
+		${HOME} printf -eu grep ${HOME} readonly echo export done printf
+		awk echo ${HOME} && -eu readonly grep x=1 | sed grep printf echo
+		cd cd ${HOME} printf && "$1" &&
+sed 'quoted text' x=1 local
+		export export "$@" "$@" "$@" awk cd echo local test
+		${HOME} grep && sed 'quoted text' cd cd cd
+"$1" 2>/dev/null | x=1 local 2>/dev/null readonly readonly $(pwd) 'quoted text'
+x=1 printf 2>/dev/null /usr/bin 2>/dev/null
+		awk export done awk ${HOME} 2>/dev/null ${HOME}
+	echo "$1" "$1" then sed ${HOME} test done --verbose readonly export /usr/bin
+	readonly local "$1" 2>/dev/null awk --verbose done sed $(pwd) x=1 test cd echo
+grep /usr/bin 2>/dev/null 2>/dev/null echo printf 'quoted text'
+		$(pwd) grep sed && done printf sed grep "$@" |
+${HOME} | && echo local "$@" echo then "$1" then grep x=1 done x=1 grep echo
+		echo 'quoted text' $(pwd) readonly /usr/bin
+		&& printf echo cd local grep echo done "$1" awk local && echo 2>/dev/null ${HOME}
+	test 'quoted text' "$1" awk 2>/dev/null "$1" readonly test -eu
+		2>/dev/null $(pwd) echo --verbose x=1 echo echo cd then x=1 sed
+	'quoted text' export local done printf awk export -eu 2>/dev/null
+	echo grep test grep $(pwd) export grep local done --verbose "$@" && 2>/dev/null
+	${HOME} /usr/bin cd "$1" $(pwd) 2>/dev/null /usr/bin
+--verbose local done printf done 'quoted text' readonly cd 'quoted text'
+test readonly "$1" /usr/bin grep then
+	test echo "$@" 'quoted text' "$@" grep cd "$@" awk --verbose
+		--verbose cd cd test done cd -eu ${HOME} "$1" -eu $(pwd) then /usr/bin "$@"
+test | && -eu cd sed sed "$@" echo export grep echo
+		| local done export $(pwd) ${HOME} sed local --verbose then echo awk sed
+		test 2>/dev/null && then awk --verbose $(pwd) $(pwd) printf $(pwd) ${HOME}
+		x=1 echo local -eu /usr/bin grep printf done test ${HOME} export 'quoted text'
+	then 2>/dev/null done export done --verbose
+done 2>/dev/null 2>/dev/null echo echo | "$@"
+local $(pwd) awk $(pwd) awk $(pwd) /usr/bin ${HOME} grep ${HOME} /usr/bin -eu -eu
+		printf ${HOME} sed "$@" $(pwd) $(pwd) local printf sed then printf grep cd
+	printf echo echo $(pwd) && grep readonly 2>/dev/null && ${HOME}
+x=1 readonly 'quoted text' done grep --verbose && readonly
+done 'quoted text' local done echo grep done $(pwd) 2>/dev/null then --verbose
+awk x=1 then 'quoted text' local
+	"$@" echo "$1" local && awk echo -eu "$@" local cd 2>/dev/null test -eu "$@" "$1"
+	cd local $(pwd) then | grep $(pwd) ${HOME} readonly sed $(pwd) local
+local done $(pwd) /usr/bin
+	$(pwd) grep then x=1 'quoted text'
+awk | x=1 cd 'quoted text' x=1 printf readonly ${HOME} then $(pwd) printf --verbose
+	readonly 2>/dev/null grep && printf 'quoted text' && export
+	sed --verbose printf done grep echo export then "$@" cd ${HOME}
+		cd | echo local /usr/bin grep grep then test then printf
+		"$1" echo | && echo printf
+		--verbose printf done /usr/bin sed x=1 grep /usr/bin 2>/dev/null printf sed x=1
+printf test cd -eu "$@"
+	/usr/bin then | && | then echo cd 2>/dev/null local
+-eu printf printf echo grep --verbose echo awk local
+		$(pwd) 'quoted text' && done awk "$1" "$@" then export ${HOME}
+	2>/dev/null "$@" then | --verbose test then then done --verbose /usr/bin
+		"$1" --verbose awk readonly test cd sed --verbose sed grep
+		cd "$@" readonly test local awk 'quoted text' --verbose printf ${HOME}
+	grep | test && x=1 printf printf cd grep cd /usr/bin ${HOME} cd echo sed
+sed done done export awk sed sed grep x=1 "$@" readonly
+	cd x=1 /usr/bin -eu 2>/dev/null
+	x=1 awk -eu local -eu | test cd export then export export grep 2>/dev/null local
+	2>/dev/null grep $(pwd) "$@" "$1" export $(pwd) 2>/dev/null
+		local local --verbose && | "$1" local $(pwd) grep export /usr/bin
+		awk -eu then then sed && awk 'quoted text' --verbose done then test 'quoted text'
+		${HOME} grep | | sed done cd echo printf done printf x=1
+	export then awk $(pwd) ${HOME} done test local test test ${HOME} then && /usr/bin
+test export && -eu grep cd sed test 'quoted text' 'quoted text' | grep 'quoted text'
+		/usr/bin "$@" awk 'quoted text' then done && readonly awk -eu "$1" printf
+		&& x=1 local ${HOME} $(pwd) grep cd 2>/dev/null done "$@" -eu ${HOME} grep
+	"$@" 'quoted text' && export printf ${HOME} printf /usr/bin | -eu x=1 cd
+	sed /usr/bin /usr/bin x=1 'quoted text'
+echo sed printf $(pwd) "$@" sed awk /usr/bin
+		${HOME} && readonly 'quoted text' grep awk cd | /usr/bin
+echo cd done "$@" readonly then printf "$@" readonly export
+echo 'quoted text' awk --verbose cd 2>/dev/null | export "$@" cd
+		grep /usr/bin 2>/dev/null 'quoted text' done $(pwd) "$@" done "$@" 'quoted text'
+local printf sed && awk 2>/dev/null "$1" sed &&
+		test export local /usr/bin --verbose then printf --verbose | printf &&
+"$@" echo printf && export
+		local | printf grep then ${HOME} local done && done done local local
+		--verbose echo test sed -eu /usr/bin --verbose
+'quoted text' ${HOME} export -eu printf
+	${HOME} readonly test "$@" awk ${HOME} echo | export "$@" ${HOME} readonly
+		/usr/bin awk x=1 done -eu --verbose done && 2>/dev/null ${HOME} x=1 "$1"
+	-eu printf x=1 /usr/bin echo done printf && echo | export $(pwd) done /usr/bin
+	'quoted text' test test -eu readonly sed -eu sed
+	2>/dev/null then ${HOME} --verbose cd x=1 "$1" cd "$1" 2>/dev/null
+	--verbose | export grep --verbose done /usr/bin test -eu -eu
+	x=1 test test echo readonly $(pwd) -eu echo local ${HOME} --verbose grep
+	then /usr/bin x=1 then cd && then grep 'quoted text' echo grep echo "$@"
+	awk test test "$1" /usr/bin export /usr/bin cd "$1"
+		sed test awk grep ${HOME} $(pwd) readonly x=1 "$1" then -eu 2>/dev/null
+grep sed awk x=1 x=1 local 'quoted text'
+	then readonly sed x=1 echo test awk "$1" -eu printf sed x=1 test $(pwd) 2>/dev/null
+test $(pwd) "$1" $(pwd) -eu 'quoted text'
+	echo --verbose printf echo cd cd done x=1
+echo "$@" 'quoted text' cd grep | grep
+readonly local "$1" cd awk local printf --verbose --verbose && export
+	${HOME} -eu cd ${HOME} 'quoted text' -eu sed -eu readonly --verbose ${HOME} x=1
+echo sed 2>/dev/null sed
+	-eu export --verbose 'quoted text' cd sed --verbose
+		| awk ${HOME} ${HOME} ${HOME} /usr/bin awk | then |
+		then $(pwd) readonly done
+&& printf awk 'quoted text' done "$1" echo "$1" x=1 && -eu | /usr/bin
+	readonly --verbose 'quoted text' local test then
+	x=1 export x=1 done then --verbose -eu export printf "$@" 2>/dev/null done --verbose
+		"$@" export /usr/bin ${HOME} test
+	x=1 x=1 export export sed awk done cd readonly readonly 2>/dev/null
+${HOME} printf export then grep 2>/dev/null
+	| | 2>/dev/null cd x=1 printf printf 2>/dev/null readonly --verbose sed /usr/bin
+		test local sed "$1" && | 'quoted text' echo /usr/bin
+		readonly awk ${HOME} "$@" sed 'quoted text'
+		'quoted text' "$1" local echo grep export --verbose awk then test
+	/usr/bin export --verbose readonly | echo echo --verbose printf && done
+		printf awk /usr/bin readonly printf "$@"
+test "$1" echo $(pwd) "$1" | cd cd ${HOME} ${HOME}
+sed /usr/bin "$1" local then | sed "$1" then export x=1 awk /usr/bin export
+	awk | /usr/bin printf grep readonly
+	&& --verbose 'quoted text' test "$1" && printf x=1 export $(pwd) local
+"$1" /usr/bin -eu test 'quoted text' -eu test printf "$1" -eu
+		--verbose 'quoted text' && done test done | export "$1" "$@" ${HOME} x=1
+sed $(pwd) $(pwd) && awk
+		awk sed "$@" x=1 'quoted text' cd 2>/dev/null
+	cd export -eu 2>/dev/null echo ${HOME}
+"$@" x=1 "$@" awk 2>/dev/null echo
+	$(pwd) $(pwd) -eu export 'quoted text' -eu readonly 2>/dev/null
+		$(pwd) && $(pwd) sed printf --verbose /usr/bin
+		then readonly x=1 2>/dev/null 'quoted text' "$@"
+		2>/dev/null -eu $(pwd) ${HOME} local && | --verbose && -eu cd
+--verbose printf printf $(pwd) readonly 2>/dev/null "$@"
+	sed 'quoted text' echo cd && local echo
+		test "$1" ${HOME} ${HOME} done | 'quoted text' "$@" local local
+	&& | export then cd -eu --verbose
+	-eu 2>/dev/null export export sed -eu --verbose grep local echo local
+	| export echo --verbose readonly
+	${HOME} done sed awk cd ${HOME} 'quoted text' 2>/dev/null ${HOME}
+		| -eu "$@" /usr/bin awk local && ${HOME}
+	x=1 ${HOME} "$1" test --verbose echo ${HOME} 2>/dev/null 2>/dev/null export
+printf --verbose -eu printf
+		"$@" then test sed echo export "$1" readonly "$1" "$1" then cd --verbose ${HOME}
+	printf --verbose && export printf /usr/bin ${HOME}
+then x=1 cd awk then | && $(pwd) export
+		-eu ${HOME} 2>/dev/null -eu 2>/dev/null
+	$(pwd) -eu --verbose -eu x=1 ${HOME} $(pwd) "$1" --verbose test --verbose
+test test /usr/bin echo awk | ${HOME} grep awk "$@"
+| $(pwd) "$@" 'quoted text' sed export 2>/dev/null cd 'quoted text'
+	done export readonly -eu local | "$@" awk | 2>/dev/null
+	${HOME} | ${HOME} local -eu readonly
+| grep 2>/dev/null test ${HOME} "$@" local --verbose
+	echo grep $(pwd) local sed $(pwd) -eu -eu done x=1 --verbose
+		echo export $(pwd) /usr/bin grep sed --verbose
+		-eu grep 'quoted text' readonly then sed -eu && $(pwd) test grep then readonly
+	export echo export echo | cd ${HOME} "$@" test awk done x=1 && /usr/bin printf
+		&& ${HOME} cd awk readonly -eu printf then readonly --verbose
+		echo echo awk 'quoted text' -eu readonly cd done test
+		&& "$1" "$1" && printf -eu -eu "$@" export --verbose printf "$@" "$1" | readonly
+		done /usr/bin 'quoted text' readonly test awk -eu grep | awk done $(pwd)
+		2>/dev/null test "$@" --verbose echo awk /usr/bin
+done done --verbose -eu 2>/dev/null --verbose --verbose export export x=1 grep
+	| awk 'quoted text' && test --verbose sed && ${HOME} && &&
+	cd readonly cd cd "$1" export awk then done
+		/usr/bin 'quoted text' echo awk 'quoted text'
+"$1" done 2>/dev/null && 2>/dev/null awk done test x=1
+	export "$1" cd printf /usr/bin
+		readonly --verbose awk "$@" ${HOME} /usr/bin test /usr/bin
+	x=1 cd cd | ${HOME} sed "$@" /usr/bin --verbose | | && 2>/dev/null awk --verbose
+	cd export echo printf grep
+	echo local done --verbose printf "$@" x=1
+	local && then printf export x=1 export
+		grep | done test grep done sed $(pwd) x=1 export x=1 ${HOME} then cd "$1"
+		echo echo echo done /usr/bin done
+	export x=1 test printf 2>/dev/null && x=1 2>/dev/null $(pwd) /usr/bin
+	&& "$1" 2>/dev/null printf "$@" -eu grep 'quoted text'
+local awk cd cd echo $(pwd) export export
+cd echo x=1 done echo done "$@" /usr/bin -eu $(pwd) --verbose 2>/dev/null printf
+	x=1 cd grep 2>/dev/null ${HOME} "$@"
+	2>/dev/null x=1 "$1" export -eu printf -eu
+		awk 2>/dev/null sed test printf | readonly --verbose export
+	echo && cd -eu --verbose "$@" $(pwd) local
+--verbose test printf | local sed export --verbose -eu x=1 2>/dev/null
+	echo sed local 2>/dev/null sed awk printf echo
+		--verbose test x=1 2>/dev/null $(pwd) printf
+		readonly echo printf | readonly "$1" test test awk -eu "$@" | ${HOME}
+--verbose printf awk "$1"
+&& echo 'quoted text' -eu then then ${HOME} x=1
+		&& "$1" $(pwd) grep printf -eu x=1
+	/usr/bin | test export grep grep
+"$1" then local export && grep readonly "$@" echo readonly printf
+then local readonly && grep $(pwd) $(pwd) echo
+grep "$1" export grep local
+	--verbose readonly done "$@" cd then 'quoted text' | test echo 2>/dev/null
+		/usr/bin 2>/dev/null -eu cd
+	"$1" "$@" test sed awk "$@"
+		"$@" $(pwd) "$1" $(pwd) | && -eu export x=1 printf ${HOME}
+	readonly && readonly | test printf cd
+		grep done 2>/dev/null x=1 grep then $(pwd) -eu &&
+$(pwd) ${HOME} printf grep echo 2>/dev/null then printf then
+sed /usr/bin awk | 'quoted text' cd && then ${HOME} && printf
+		/usr/bin 2>/dev/null grep $(pwd)
+		/usr/bin printf | "$@" --verbose grep local done $(pwd)
+	/usr/bin readonly local /usr/bin local
+	2>/dev/null cd "$1" printf echo awk | then
+then 'quoted text' cd $(pwd) export | grep cd
+	readonly 2>/dev/null "$1" --verbose printf done --verbose "$1" 2>/dev/null $(pwd)
+/usr/bin 'quoted text' -eu cd cd
+		grep export then done ${HOME} export
+	readonly awk done readonly cd "$@" 'quoted text' ${HOME} cd readonly
+x=1 | awk 2>/dev/null awk 2>/dev/null echo sed export
+	awk printf "$@" 'quoted text' test "$@" grep
+${HOME} test then 'quoted text' --verbose
+	${HOME} "$1" ${HOME} echo readonly --verbose done sed -eu "$1"
+	cd 'quoted text' grep "$1" done "$@" then && awk $(pwd) "$@"
+		-eu local x=1 cd x=1 awk 'quoted text' then --verbose
+export "$1" sed | x=1 printf awk export
+	echo /usr/bin local export test
+export "$1" local done done --verbose 2>/dev/null cd -eu x=1 test
+		'quoted text' x=1 x=1 then test "$@" -eu $(pwd) then cd
+		2>/dev/null ${HOME} x=1 local "$1" done
+	then export "$@" ${HOME} test /usr/bin printf && sed "$1" awk --verbose
+	echo --verbose cd cd $(pwd) printf echo awk cd
+	done "$1" readonly 2>/dev/null then
+	echo done $(pwd) then 2>/dev/null 'quoted text'
+		--verbose local x=1 cd sed echo printf
+	grep readonly awk "$1" awk test cd
+"$1" 'quoted text' && $(pwd) x=1 cd awk -eu --verbose export then "$1" test then
+		-eu ${HOME} ${HOME} test -eu local /usr/bin test grep
+	--verbose x=1 awk $(pwd) test sed x=1 done 'quoted text' -eu x=1 --verbose
+readonly $(pwd) $(pwd) echo awk -eu x=1 --verbose awk -eu ${HOME}
+		"$1" sed "$@" done ${HOME} awk $(pwd) &&
+		$(pwd) -eu ${HOME} cd --verbose
+		'quoted text' /usr/bin test local then cd 'quoted text'
+	'quoted text' export cd 'quoted text'
+${HOME} local cd "$@" 'quoted text'
+	export $(pwd) echo ${HOME} "$@" echo "$1" "$@" echo local cd 2>/dev/null
+	| readonly awk | -eu printf cd --verbose export 'quoted text' sed
+		sed readonly 'quoted text' --verbose 2>/dev/null
+	printf --verbose export readonly
+	readonly /usr/bin done printf local echo 2>/dev/null
+		local /usr/bin echo then && local -eu ${HOME} ${HOME}
+		sed ${HOME} $(pwd) export -eu readonly x=1 "$@" ${HOME}
+		awk done printf | grep echo ${HOME} && $(pwd)
+printf --verbose local awk grep echo done 2>/dev/null export grep
+		'quoted text' $(pwd) 2>/dev/null printf && /usr/bin
+	grep && /usr/bin cd /usr/bin local test test grep "$@" 'quoted text'
+		readonly printf readonly && "$1"
+	2>/dev/null grep then sed "$1" done "$1" sed "$@" /usr/bin
+		| export ${HOME} x=1 then printf echo ${HOME} readonly ${HOME} ${HOME}
+	done 2>/dev/null --verbose printf
+		x=1 -eu /usr/bin /usr/bin 'quoted text' cd grep | cd printf "$1" | cd printf 'quoted text'
+${HOME} cd export 2>/dev/null "$1" grep local awk then test
+	x=1 test -eu 2>/dev/null grep sed && sed done ${HOME} "$@" printf ${HOME}
+/usr/bin cd sed ${HOME} /usr/bin echo done | && 'quoted text'
+x=1 /usr/bin done printf x=1 grep && "$@" ${HOME} | ${HOME} "$@"
+	printf --verbose done then "$@" ${HOME} then
+--verbose local readonly readonly readonly then ${HOME} local
+	/usr/bin ${HOME} "$1"
+	done /usr/bin "$1" printf
+${HOME} -eu sed ${HOME} readonly /usr/bin readonly x=1 x=1 echo && -eu && -eu
+		'quoted text' then readonly awk printf | awk echo then then "$1"
+		2>/dev/null then then export
+'quoted text' sed cd ${HOME} && /usr/bin ${HOME} /usr/bin
+	echo then 'quoted text' "$@" cd $(pwd)
+	sed done | $(pwd) done && ${HOME} && $(pwd) sed | test /usr/bin export printf
+| -eu x=1 sed | $(pwd) | -eu grep 2>/dev/null x=1 local sed | && x=1 $(pwd) "$@"
+		"$1" awk echo export x=1
+		&& printf grep awk "$1"
+		echo | $(pwd) grep test cd "$@" then ${HOME} cd then "$1" awk readonly then
+	/usr/bin test printf then -eu | test
+		export /usr/bin ${HOME} done $(pwd) 2>/dev/null 2>/dev/null
+	printf --verbose echo /usr/bin local readonly --verbose local ${HOME} -eu export
+		'quoted text' | sed $(pwd) readonly
+	sed local then local /usr/bin "$1" awk 'quoted text' export
+readonly /usr/bin x=1
+	| grep | readonly && --verbose grep
+		${HOME} sed awk x=1 printf --verbose $(pwd) readonly -eu done echo 2>/dev/null
+		done "$1" local test $(pwd) 'quoted text' readonly
+	'quoted text' local local local --verbose then 'quoted text' "$1"
+	$(pwd) && grep test --verbose grep ${HOME} local readonly
+| 'quoted text' | readonly awk --verbose grep test
+	"$1" /usr/bin grep sed test 'quoted text' export then --verbose x=1 sed ${HOME}
+		2>/dev/null cd ${HOME} -eu --verbose "$1"
+	"$@" -eu awk done | /usr/bin && /usr/bin ${HOME} | done
+		then then readonly cd -eu awk export grep sed echo $(pwd) "$1"
+	"$1" /usr/bin then -eu
+	| "$@" 'quoted text' --verbose && "$@" sed
+export grep local -eu grep done -eu
+"$1" readonly ${HOME} ${HOME} readonly
+	${HOME} --verbose grep readonly local
+		$(pwd) done "$@" grep /usr/bin then sed printf awk test /usr/bin
+	'quoted text' "$@" awk -eu done local ${HOME} then export
+$(pwd) local cd -eu $(pwd) -eu $(pwd) "$1" sed ${HOME} x=1 test local
+sed "$1" /usr/bin x=1 /usr/bin $(pwd) test export local
+		local ${HOME} grep && local test x=1 /usr/bin 2>/dev/null grep readonly
+	printf cd awk sed ${HOME} | awk && readonly sed --verbose -eu echo test $(pwd)
+	readonly 2>/dev/null echo local cd sed local x=1 readonly test "$@" done test &&
+"$@" readonly cd export readonly
+$(pwd) | x=1 ${HOME} ${HOME} -eu local "$1"
+		&& then sed && /usr/bin cd local "$1" x=1 "$1" $(pwd)
+#include c88.sh
+	--verbose | 2>/dev/null ${HOME} sed && echo echo | export "$1"
+&& x=1 && done awk x=1 cd local awk "$@" --verbose grep local awk sed "$1"
+	done export $(pwd) echo /usr/bin x=1 x=1 done 2>/dev/null sed then sed
+	'quoted text' cd readonly local done --verbose
+cd export readonly && -eu "$@" grep echo $(pwd) ${HOME}
+		"$@" "$1" awk local readonly sed sed | readonly echo then sed --verbose
+	done cd done "$@" "$1" x=1 sed --verbose printf $(pwd) "$1" local
+x=1 "$@" test echo sed then awk cd then "$@"
+	| /usr/bin cd | && --verbose | sed x=1 2>/dev/null local
+	x=1 then local 2>/dev/null
+&& -eu printf then 'quoted text' ${HOME} cd readonly -eu
+		"$1" "$@" done export local "$@" /usr/bin sed --verbose
+		| ${HOME} then 'quoted text' then then
+"$@" 'quoted text' readonly
+		local sed "$1" x=1 cd ${HOME} $(pwd) 2>/dev/null "$1"
+		sed export readonly done cd test grep 'quoted text' awk sed
+	${HOME} then "$1" test -eu
+"$@" | local /usr/bin 2>/dev/null
+		x=1 awk ${HOME} 2>/dev/null echo x=1 $(pwd) grep grep $(pwd) export
+		$(pwd) local cd local "$@" /usr/bin export export
+	"$@" done cd export printf 2>/dev/null x=1 grep $(pwd) done sed -eu
+	"$@" sed test ${HOME} printf readonly export done cd x=1 ${HOME} "$1"
+'quoted text' readonly then && echo
+		readonly local cd x=1 then && then --verbose --verbose grep awk echo
+local --verbose $(pwd) 2>/dev/null grep ${HOME}
+		test sed --verbose grep sed -eu test printf then echo export cd 'quoted text'
+	"$1" export export "$1" sed cd printf
+'quoted text' 'quoted text' export cd then grep 'quoted text'
+		/usr/bin echo cd sed echo | done readonly
+	test printf awk cd echo then printf -eu ${HOME} local 'quoted text'
+		grep 'quoted text' 2>/dev/null readonly
+	2>/dev/null cd 'quoted text' test --verbose grep x=1 'quoted text' x=1
+		done sed | ${HOME} "$@"
+		${HOME} done /usr/bin x=1
+--verbose 2>/dev/null test "$1" x=1 $(pwd) echo --verbose | --verbose
+	'quoted text' -eu /usr/bin "$@" x=1 export printf "$1" grep grep /usr/bin echo
+"$1" export done "$@" sed then sed echo x=1 readonly /usr/bin
+	"$1" local sed cd echo "$@"
+		$(pwd) /usr/bin test &&
+		printf export $(pwd) | readonly then readonly done -eu echo --verbose
+2>/dev/null test awk --verbose
+	then "$1" printf test && printf && "$1"
+then test export awk sed grep then "$1" echo
+		echo readonly done then local grep awk "$@" 'quoted text' done "$1" x=1 awk 2>/dev/null
+	--verbose "$1" 2>/dev/null test
+	&& | done 'quoted text' sed -eu
+export done "$1" then
+then awk cd 2>/dev/null | awk x=1 -eu
+	-eu echo then $(pwd) printf
+--verbose $(pwd) awk local x=1 2>/dev/null echo grep readonly -eu
+		$(pwd) done then test | && -eu $(pwd) $(pwd) "$1" readonly grep
+		then readonly done printf printf echo -eu $(pwd) export "$1"
+	'quoted text' "$1" && grep printf test cd done 'quoted text'
+	export x=1 echo && sed printf | export awk | && awk readonly
+		test --verbose -eu x=1 printf | awk done local
+x=1 done 'quoted text' export printf then echo echo 2>/dev/null readonly
+		-eu sed "$1" cd printf printf local
+		'quoted text' && grep 'quoted text' /usr/bin grep local
+		"$1" local sed awk x=1 2>/dev/null
+	cd 'quoted text' test 'quoted text' grep 'quoted text' local ${HOME}
+	readonly -eu /usr/bin export done sed
+export ${HOME} grep awk printf grep cd echo sed | ${HOME}
+--verbose "$@" 'quoted text' && 'quoted text'
+		x=1 local | done awk done grep 'quoted text' grep
+		| $(pwd) 'quoted text' /usr/bin
+2>/dev/null cd "$1" --verbose /usr/bin
+		echo readonly echo x=1 x=1 && 2>/dev/null grep $(pwd) echo printf printf
+	readonly cd export test $(pwd) x=1 | test readonly "$1" /usr/bin export cd
+	x=1 echo ${HOME} echo export | --verbose
+	echo && | printf readonly then printf x=1 --verbose grep x=1 echo
+cd sed x=1 cd /usr/bin | printf
+then local awk export --verbose -eu 'quoted text'
+		export then test readonly -eu | then "$1" then echo "$1" printf printf done
+"$@" grep $(pwd) "$@" |
+		--verbose awk /usr/bin sed $(pwd) /usr/bin
+then --verbose --verbose
+	/usr/bin "$1" done printf 'quoted text' 'quoted text'
+		printf | awk x=1 "$@" sed
+	| "$1" --verbose 'quoted text' awk | cd
+		2>/dev/null echo sed awk
+	2>/dev/null local awk done && awk ${HOME} "$@" local printf
+		echo readonly done awk ${HOME}
+export printf then awk cd awk $(pwd) readonly
+		2>/dev/null done readonly $(pwd) 2>/dev/null
+		test ${HOME} printf 'quoted text' done export sed | then cd printf 2>/dev/null
+grep readonly sed readonly printf ${HOME} /usr/bin "$@" grep &&
+	&& "$1" awk ${HOME} 2>/dev/null "$1" --verbose sed readonly echo -eu ${HOME} cd
+"$@" test printf ${HOME}
+test --verbose "$@" --verbose /usr/bin --verbose
+		done -eu then x=1 grep |
+		--verbose 2>/dev/null test |
+		${HOME} | then local export 2>/dev/null $(pwd) 2>/dev/null
+	&& then /usr/bin -eu echo --verbose test cd "$1"
+		${HOME} local ${HOME} 2>/dev/null x=1
+test sed then x=1 x=1 echo $(pwd) export cd export
+2>/dev/null awk --verbose $(pwd) grep printf 'quoted text' printf 'quoted text'
+x=1 echo | grep ${HOME} "$@" $(pwd) && export export
+		then local --verbose local 'quoted text' 'quoted text' printf
+printf done readonly cd test 2>/dev/null test -eu cd x=1 $(pwd)
+		"$1" export ${HOME} 'quoted text' local readonly ${HOME} && 'quoted text'
+done $(pwd) export cd export test readonly "$1" readonly --verbose local
+x=1 ${HOME} then /usr/bin 'quoted text' then --verbose | 'quoted text'
+		echo readonly -eu -eu $(pwd) awk $(pwd)
+/usr/bin "$1" $(pwd) test
+		readonly "$1" && local /usr/bin x=1
+	&& done sed --verbose && echo printf "$@" sed then /usr/bin $(pwd) export --verbose
+	x=1 echo then --verbose sed sed test "$@" $(pwd) test "$1"
+	grep test awk "$@" awk | "$@" 'quoted text' local "$1" $(pwd) export
+	sed printf /usr/bin --verbose ${HOME} "$@"
+		local sed | echo "$@" -eu | grep -eu 2>/dev/null 2>/dev/null 2>/dev/null |
+"$1" --verbose $(pwd) ${HOME} test
+--verbose grep 'quoted text' then x=1 'quoted text' local x=1
+		/usr/bin cd sed readonly --verbose test printf grep grep then then grep grep
+		${HOME} sed sed --verbose
+| | | export $(pwd) readonly --verbose ${HOME} --verbose x=1 "$1"
+"$1" test awk test x=1 && test | "$1" grep sed export "$@" grep local /usr/bin
+		then "$1" sed "$@" "$@" printf
+		test readonly local done
+		"$1" local awk export echo 2>/dev/null echo -eu "$1"
+	cd 'quoted text' $(pwd) -eu "$1"
+		'quoted text' "$1" /usr/bin x=1 then then printf
+	$(pwd) local cd sed -eu cd /usr/bin | && done awk | done cd /usr/bin && local
+export 'quoted text' grep && 2>/dev/null echo cd sed && $(pwd)
+	$(pwd) readonly ${HOME} "$1" x=1 -eu -eu cd "$1" echo done cd
+x=1 grep awk 'quoted text' test | /usr/bin
+local local x=1 printf /usr/bin sed | grep --verbose export 2>/dev/null -eu
+	done export "$@" 'quoted text' local sed awk cd && sed
+echo "$1" --verbose x=1 2>/dev/null echo && --verbose
+	2>/dev/null $(pwd) grep $(pwd) 2>/dev/null
+		awk awk sed sed sed export grep --verbose
+"$1" -eu local done && 'quoted text' done sed export grep
+		-eu readonly | printf printf cd --verbose
+-eu $(pwd) 'quoted text' /usr/bin x=1 -eu cd echo local local "$1" grep --verbose
+		/usr/bin "$@" cd readonly $(pwd) && && "$1" x=1 echo | ${HOME} awk "$1"
+		export $(pwd) ${HOME} && echo 'quoted text'
+	local 2>/dev/null $(pwd) && test grep grep x=1 then "$@" local test printf readonly
+grep $(pwd) readonly grep export local && x=1 echo "$1" echo -eu done
+| echo then /usr/bin
+cd local done -eu local | x=1 /usr/bin
+	awk echo && ${HOME} local -eu /usr/bin 2>/dev/null
+	done /usr/bin ${HOME} 'quoted text'
+2>/dev/null grep && --verbose --verbose x=1 sed awk readonly local printf &&
+		done "$@" grep then 'quoted text' --verbose /usr/bin x=1 local local --verbose
+x=1 sed "$1" $(pwd) "$@" sed readonly export echo
+		local x=1 local "$1" /usr/bin
+	'quoted text' -eu ${HOME} local grep awk grep
+		--verbose grep /usr/bin /usr/bin -eu "$1" "$1" cd $(pwd) sed 2>/dev/null cd
+then done "$@" sed local grep 'quoted text'
+x=1 export x=1 export cd | awk cd 'quoted text'
+readonly && -eu | "$1" readonly 'quoted text' 'quoted text' echo x=1 printf
+		export "$1" $(pwd) export "$1"
+done 2>/dev/null then sed sed test grep && cd cd --verbose
+		$(pwd) readonly readonly /usr/bin local "$@" sed "$1" then export
+		export cd done "$@" | done | "$@" test grep
+		&& --verbose done && then
+	x=1 local grep cd test /usr/bin x=1 x=1 done $(pwd) grep -eu
+export then "$1" done "$@" echo --verbose 'quoted text' cd | ${HOME}
+$(pwd) readonly 2>/dev/null readonly readonly export awk $(pwd) readonly
+cd --verbose | awk done printf printf
+		awk sed x=1 readonly test echo sed "$@" -eu done printf readonly && $(pwd)
+"$@" grep test ${HOME} grep ${HOME} 'quoted text' grep export local local
+	then local x=1 $(pwd) then awk 2>/dev/null --verbose cd printf "$@" | done
+		&& readonly ${HOME} readonly echo -eu /usr/bin printf &&
+		echo grep $(pwd) /usr/bin sed awk 2>/dev/null done
+		$(pwd) --verbose awk local sed $(pwd) sed
+		"$@" /usr/bin && awk /usr/bin /usr/bin "$@" && done /usr/bin | 2>/dev/null
+	local "$@" then sed test -eu 'quoted text' 'quoted text' 'quoted text' grep
+${HOME} && then awk "$1" sed export
+		awk --verbose $(pwd) && cd printf 'quoted text' 'quoted text'
+	local --verbose "$1" export
+	cd --verbose readonly done local awk "$1" cd grep done 2>/dev/null
+		$(pwd) /usr/bin export test --verbose x=1 -eu 'quoted text'
+echo $(pwd) echo grep awk echo export && printf then 2>/dev/null test "$@" done
+then awk echo test 2>/dev/null && awk 'quoted text' 2>/dev/null x=1 -eu /usr/bin
+		sed && --verbose /usr/bin ${HOME} -eu awk "$@" test
+	-eu done -eu echo awk sed x=1 'quoted text'
+	sed cd test | /usr/bin "$1" "$1" 'quoted text' && "$@" -eu /usr/bin
+		cd awk 2>/dev/null grep cd awk ${HOME}
+awk readonly /usr/bin | "$1" grep -eu -eu test cd "$@" sed awk --verbose "$@"
+	${HOME} export sed ${HOME}
+	"$1" cd export printf readonly echo awk done cd | readonly export $(pwd) test
+	done local x=1 && --verbose cd /usr/bin cd test
+		done grep --verbose -eu local done grep --verbose --verbose
+		readonly test sed printf done "$@" readonly "$@" -eu then 2>/dev/null
+		done $(pwd) then local done awk "$@" $(pwd) local export
+		${HOME} grep local ${HOME} cd 'quoted text' printf readonly /usr/bin echo local
+		awk export done local "$1" x=1 readonly /usr/bin local done ${HOME} readonly
+${HOME} readonly export ${HOME} "$@" && | ${HOME} sed
+	printf "$1" -eu awk local --verbose cd export test ${HOME} local readonly
+		'quoted text' printf export sed 2>/dev/null "$1" printf -eu echo 'quoted text'
+	--verbose $(pwd) grep done --verbose $(pwd)
+then sed test | echo 'quoted text' && x=1 2>/dev/null local echo "$@" 'quoted text'
+		2>/dev/null $(pwd) test "$1" readonly printf printf | export test local
+	x=1 cd then export done printf /usr/bin awk --verbose 2>/dev/null
+	${HOME} export 2>/dev/null local "$@" test local -eu 2>/dev/null
+	sed 'quoted text' echo done "$1" ${HOME} 2>/dev/null
+	printf -eu sed test grep
+		cd grep test | /usr/bin
+done && grep $(pwd) local then x=1 test /usr/bin grep readonly -eu readonly awk
+-eu -eu -eu done echo /usr/bin printf export
+	| export then -eu x=1 "$@" cd /usr/bin
+		&& printf x=1 --verbose awk x=1 ${HOME} ${HOME} awk x=1 'quoted text' 2>/dev/null
+	--verbose 2>/dev/null /usr/bin
+		test awk /usr/bin ${HOME} ${HOME} done readonly then echo echo && done local
+2>/dev/null grep /usr/bin cd x=1 x=1 ${HOME} "$1" sed -eu
+	grep -eu echo -eu then ${HOME} --verbose && 'quoted text' | done "$1"
+cd /usr/bin "$@" --verbose
+		grep | "$1" ${HOME} 'quoted text'
+"$1" sed ${HOME} /usr/bin --verbose grep cd readonly x=1
+&& 2>/dev/null sed "$@" /usr/bin /usr/bin local test readonly
+		"$@" ${HOME} readonly grep export
+/usr/bin /usr/bin then ${HOME} $(pwd) done -eu grep --verbose cd | "$1" echo
+readonly x=1 "$1" sed echo -eu test printf 'quoted text' grep "$@" then
+	then export cd export then cd ${HOME}
+printf awk sed ${HOME} --verbose | test awk && echo grep | $(pwd) then
+	done grep | ${HOME} "$@" 'quoted text' local --verbose sed then --verbose awk
+		2>/dev/null ${HOME} ${HOME} 2>/dev/null echo | /usr/bin cd -eu sed
+echo "$@" | grep then $(pwd) | ${HOME} 'quoted text'
+		done printf x=1 'quoted text' local echo "$@" "$@" local
+then && cd /usr/bin -eu x=1 /usr/bin local done then echo grep
+		&& && readonly ${HOME} then test readonly readonly "$1"
+		local echo x=1 then done --verbose $(pwd) grep
+		"$@" cd done 'quoted text' 'quoted text' && printf ${HOME} sed sed ${HOME} then
+echo test ${HOME} test readonly sed "$@" then -eu echo
+	$(pwd) export 2>/dev/null "$@" ${HOME} -eu 2>/dev/null awk sed
+		"$@" cd "$1" | /usr/bin echo | $(pwd) "$@" --verbose
+$(pwd) | 2>/dev/null && grep then
+	'quoted text' grep && ${HOME} -eu | x=1 /usr/bin
+		done then printf awk "$@" 'quoted text' grep sed ${HOME}
+test "$@" --verbose cd then awk -eu 2>/dev/null readonly test && done /usr/bin
+		echo sed sed /usr/bin echo printf export grep local ${HOME} -eu local x=1 test
+x=1 grep $(pwd) x=1 'quoted text' export echo /usr/bin echo echo 2>/dev/null
+	cd export /usr/bin | then awk readonly test /usr/bin awk then sed grep ${HOME}
+readonly "$@" echo 2>/dev/null awk test test | /usr/bin local "$@" "$@" /usr/bin
+	cd 2>/dev/null done then "$@" done ${HOME} echo
+	then then grep printf export
+grep --verbose sed -eu then --verbose
+awk grep local "$@" awk -eu printf $(pwd) local
+--verbose echo local grep readonly
+sed test printf test printf grep done sed echo |
+		echo "$@" printf sed grep sed then
+	"$1" then x=1 "$1" $(pwd) printf "$1" cd printf sed | readonly local printf
+		"$@" 2>/dev/null $(pwd) export
+		readonly awk && then $(pwd) -eu local 'quoted text'
+	"$@" /usr/bin local echo |
+		printf awk --verbose echo "$1" printf done 'quoted text'
+test export $(pwd) printf /usr/bin | 'quoted text' x=1 local echo 'quoted text'
+	x=1 then then /usr/bin sed export ${HOME}
+2>/dev/null test sed && grep
+	grep ${HOME} export export $(pwd) done x=1 /usr/bin "$1" export grep export
+	local 2>/dev/null 2>/dev/null local x=1 export 'quoted text' done 2>/dev/null
+	-eu export export && "$1" $(pwd) 2>/dev/null export then export 'quoted text'
+	--verbose grep | printf | && "$@" -eu
+	| ${HOME} grep -eu x=1 local echo ${HOME} readonly grep /usr/bin &&
+2>/dev/null "$@" ${HOME} /usr/bin echo "$1" echo awk grep "$@" printf /usr/bin
+| 2>/dev/null /usr/bin readonly readonly local ${HOME}
+		echo awk then awk done echo then
+echo ${HOME} -eu x=1 | --verbose done export /usr/bin x=1 -eu ${HOME} "$@"
+	printf cd $(pwd) ${HOME} $(pwd) sed export
+		&& echo readonly $(pwd) grep
+printf ${HOME} $(pwd) /usr/bin "$@" printf --verbose printf
+| && grep printf $(pwd) then grep &&
+	cd -eu 'quoted text' local $(pwd) && ${HOME} --verbose 'quoted text'
+2>/dev/null && export 'quoted text' -eu --verbose "$1" -eu -eu local
+| local 'quoted text' export | test 2>/dev/null
+x=1 "$@" test readonly x=1 ${HOME} 2>/dev/null
+		cd -eu echo /usr/bin | done sed printf sed test --verbose
+		$(pwd) --verbose readonly | --verbose ${HOME} then grep cd test
+	done x=1 grep | /usr/bin then readonly then
+		$(pwd) echo grep then x=1 grep
+${HOME} grep $(pwd) && local x=1 done grep
+cd then ${HOME} ${HOME} local printf echo
+		done export cd $(pwd) x=1 | local cd --verbose --verbose export ${HOME} echo
+	--verbose /usr/bin -eu test grep
+	/usr/bin test done cd cd "$@" 'quoted text' local done 'quoted text' awk
+2>/dev/null cd --verbose readonly printf printf
+	&& echo x=1 --verbose | "$1" done "$@" test --verbose local grep &&
+		echo 2>/dev/null x=1 /usr/bin 'quoted text'
+export readonly ${HOME} x=1 | readonly printf --verbose done /usr/bin --verbose
+| echo --verbose | local ${HOME} local
+	grep ${HOME} 2>/dev/null local -eu echo done 'quoted text' done 2>/dev/null
+'quoted text' echo cd done 2>/dev/null | printf --verbose ${HOME}
+-eu sed /usr/bin echo then echo printf export
+	test --verbose /usr/bin then | /usr/bin -eu done printf done
+		grep -eu x=1 echo 'quoted text' 2>/dev/null export 2>/dev/null
+		echo --verbose readonly local printf 'quoted text'
+done test /usr/bin local readonly "$1" then
+$(pwd) then cd done readonly /usr/bin | local "$@"
+		${HOME} $(pwd) /usr/bin echo
+awk echo export 'quoted text'
+	export /usr/bin test grep "$@" grep readonly local
+		done 2>/dev/null -eu done -eu
+		$(pwd) "$1" printf cd cd
+	2>/dev/null | sed printf echo grep echo local x=1 'quoted text'
+	-eu x=1 'quoted text' | cd printf -eu -eu echo readonly 2>/dev/null
+readonly ${HOME} local "$@" readonly echo readonly "$1" then sed -eu readonly
+${HOME} sed export then | $(pwd)
+		echo /usr/bin 2>/dev/null 'quoted text' "$@" "$@" test cd ${HOME} 'quoted text'
+	cd test cd /usr/bin 'quoted text' done "$@" awk done readonly /usr/bin ${HOME}
+		done then 2>/dev/null --verbose awk "$1" /usr/bin test local -eu readonly
+		test | 2>/dev/null test printf awk then
+		cd cd "$@" $(pwd) cd echo /usr/bin 'quoted text' test -eu -eu test | test
+		'quoted text' -eu 'quoted text' ${HOME}
+	grep --verbose grep echo -eu 2>/dev/null x=1 2>/dev/null local $(pwd) readonly 'quoted text'
+		${HOME} local ${HOME} readonly done --verbose --verbose
+awk x=1 export 2>/dev/null --verbose
+		local echo then x=1 $(pwd)
+done "$1" "$@" then test |
+		cd ${HOME} -eu && local /usr/bin readonly then /usr/bin |
+	'quoted text' local echo
+	&& echo /usr/bin echo export grep sed
+${HOME} test x=1 'quoted text' 2>/dev/null
+/usr/bin $(pwd) --verbose 2>/dev/null 'quoted text' "$@" done
+echo sed /usr/bin printf printf && readonly export export
+	"$@" cd done local "$@" cd "$1" ${HOME} --verbose
+-eu awk /usr/bin grep x=1 --verbose sed "$@" awk echo "$@" --verbose cd cd export
+	sed && | printf test -eu awk cd -eu && ${HOME} --verbose then printf
+		done /usr/bin ${HOME} printf local grep sed && "$@" "$@" --verbose
+	readonly -eu test "$@" awk 'quoted text' "$@" ${HOME} | $(pwd) 2>/dev/null
+	cd cd awk -eu cd && --verbose --verbose /usr/bin "$@" -eu cd 2>/dev/null
+	readonly -eu x=1 cd echo -eu 2>/dev/null 2>/dev/null
+sed -eu /usr/bin 2>/dev/null awk printf 'quoted text' echo local
+	"$@" && awk | done && x=1 test $(pwd) local
+	grep ${HOME} local grep echo | "$@" grep sed $(pwd) $(pwd) 2>/dev/null
+		readonly awk grep x=1 local
+grep x=1 ${HOME} printf test "$1" grep ${HOME} 'quoted text' awk /usr/bin
+	$(pwd) "$@" printf -eu readonly | printf awk ${HOME} local sed sed test && && --verbose
+		awk awk --verbose /usr/bin 2>/dev/null | then |
+	--verbose "$@" sed | echo && local echo 2>/dev/null echo
+		grep 2>/dev/null cd readonly export awk 2>/dev/null awk "$@" grep local
+echo "$@" 'quoted text' "$1" -eu 2>/dev/null echo echo /usr/bin
+	then echo then printf -eu | -eu test sed "$1" echo
+	test "$@" "$1" echo 'quoted text' $(pwd) then sed local -eu ${HOME}
+test /usr/bin test && grep x=1 ${HOME} sed
+"$@" readonly ${HOME} awk echo "$1" local 'quoted text' sed sed done echo "$@"
+		grep -eu "$1" /usr/bin /usr/bin echo /usr/bin --verbose grep
+cd done cd /usr/bin awk -eu echo x=1 sed done
+then grep echo && /usr/bin --verbose -eu -eu && grep readonly "$@" x=1 x=1 local
+	--verbose printf export "$1" ${HOME} "$@"
+	sed --verbose echo 2>/dev/null then awk cd 'quoted text' $(pwd) -eu ${HOME}
+	x=1 export $(pwd) then 'quoted text' /usr/bin -eu export 2>/dev/null
+	| export $(pwd) --verbose grep echo "$1" ${HOME} ${HOME} done echo
+	/usr/bin /usr/bin 2>/dev/null
+		sed && "$@" readonly /usr/bin test
+		sed | && then readonly export
+	"$@" 2>/dev/null echo then done -eu done "$@"
+		/usr/bin -eu ${HOME} --verbose readonly awk local grep awk
+	test 'quoted text' test "$1"
+		${HOME} 2>/dev/null | && | printf
+		sed local "$@" 'quoted text'
+grep grep ${HOME} awk 2>/dev/null
+	test "$@" 'quoted text' ${HOME} sed test readonly
+		cd printf -eu ${HOME} done export printf
+2>/dev/null printf then echo 2>/dev/null cd local --verbose
+	$(pwd) cd --verbose --verbose
+awk $(pwd) readonly 2>/dev/null ${HOME} $(pwd) 'quoted text' export 2>/dev/null
+readonly $(pwd) cd cd &&
+	export 'quoted text' awk sed --verbose
+--verbose awk "$1" grep awk cd export printf
+	2>/dev/null sed awk /usr/bin x=1 x=1 "$1" 2>/dev/null ${HOME}
+	awk export "$@" && | done then grep
+export sed ${HOME} -eu
+	readonly ${HOME} "$1" -eu printf 'quoted text' printf
+"$@" then -eu printf grep x=1 "$@" x=1 done $(pwd) then /usr/bin -eu then -eu then
+/usr/bin ${HOME} local echo 2>/dev/null x=1 -eu done printf then test 2>/dev/null
+		| grep local -eu $(pwd) ${HOME} "$@" | && printf cd 'quoted text'
+	"$@" local export "$@" grep /usr/bin echo echo --verbose
+${HOME} test test printf echo $(pwd) x=1
+		awk readonly sed sed /usr/bin x=1 'quoted text' test "$@" test awk
+		"$1" | done $(pwd) /usr/bin local local "$@" printf
+		cd -eu echo x=1 "$@" cd x=1 echo export ${HOME} local $(pwd) 'quoted text' "$@"
+		&& $(pwd) -eu export --verbose
+readonly readonly then then printf
+		awk /usr/bin ${HOME} | ${HOME} local cd "$1" grep 2>/dev/null 2>/dev/null
+	done 'quoted text' printf printf
+		printf then ${HOME} 'quoted text'
+	"$1" x=1 echo sed "$1" -eu
+grep -eu then export done --verbose 2>/dev/null
+		x=1 2>/dev/null then x=1 && ${HOME} echo export 'quoted text' export
+then done grep --verbose readonly sed done
+export cd $(pwd) export test test 2>/dev/null ${HOME} && grep $(pwd)
+export echo grep grep sed awk ${HOME}
+		-eu x=1 "$1" export awk export then echo --verbose | readonly | --verbose "$@"
+		"$@" --verbose x=1 x=1 done sed /usr/bin | && $(pwd) $(pwd) test | ${HOME} &&
+		2>/dev/null grep && done echo 'quoted text' --verbose x=1 2>/dev/null echo
+--verbose grep export x=1 | 'quoted text'
+	test $(pwd) awk cd $(pwd) | cd --verbose then sed "$1" ${HOME}
+		local $(pwd) -eu echo cd cd ${HOME} x=1 then
+grep local $(pwd) readonly
+		printf done 2>/dev/null | local then $(pwd) && echo "$1" ${HOME}
+	-eu x=1 | awk awk 'quoted text' echo && grep awk printf awk
+--verbose export readonly done --verbose
+printf "$1" ${HOME} done ${HOME} ${HOME} --verbose printf readonly
+test done printf x=1 /usr/bin printf awk echo | 2>/dev/null && then
+	printf sed | test test cd
+		test /usr/bin grep x=1 --verbose x=1 -eu sed readonly grep readonly $(pwd) readonly
+		grep x=1 ${HOME} test 'quoted text'
+	readonly /usr/bin $(pwd) readonly --verbose -eu --verbose x=1 cd awk --verbose
+		local awk ${HOME} echo -eu readonly -eu test sed echo local 2>/dev/null x=1
+sed readonly awk "$1" test export ${HOME} test then 'quoted text'
+| -eu /usr/bin "$1" "$@" /usr/bin then cd 'quoted text'
+		/usr/bin awk echo 'quoted text' /usr/bin cd
+		grep export 'quoted text' -eu test "$1" cd 2>/dev/null
+	printf 'quoted text' export sed done "$@" grep /usr/bin
+then $(pwd) ${HOME} $(pwd) done ${HOME} $(pwd) 2>/dev/null ${HOME} grep -eu
+	/usr/bin x=1 readonly readonly -eu awk
+test ${HOME} ${HOME} test then
+	&& awk grep x=1 done "$@" sed then && readonly 2>/dev/null
+	$(pwd) && local awk 2>/dev/null printf
+"$@" -eu cd readonly grep grep
+	--verbose grep $(pwd) -eu local grep $(pwd) cd export "$@" /usr/bin
+		local | grep 'quoted text' sed "$@" "$@" /usr/bin
+		2>/dev/null --verbose printf cd ${HOME} --verbose echo x=1 && 'quoted text'
+		sed 'quoted text' /usr/bin -eu ${HOME} then $(pwd)
+	'quoted text' -eu --verbose "$@" local grep awk "$@" awk test 2>/dev/null export
+	-eu "$1" printf readonly --verbose $(pwd) export /usr/bin --verbose printf
+then && echo local -eu then grep echo export
+	"$1" x=1 && && --verbose cd echo | ${HOME} "$1" printf
+	"$@" /usr/bin printf ${HOME} awk test sed readonly $(pwd) test awk then "$1" 'quoted text'
+	cd 'quoted text' | -eu test "$1" sed x=1 done /usr/bin "$@"
+		--verbose export "$1" "$1" printf ${HOME} local x=1 local
+local "$1" && test -eu -eu "$@"
+		${HOME} awk export echo "$1" then $(pwd) grep /usr/bin done $(pwd) "$@"
+		export done echo | awk echo test local -eu 'quoted text' printf printf
+	echo && echo x=1 "$1" cd 2>/dev/null | "$@" cd --verbose
+	readonly then --verbose 2>/dev/null "$1" test echo export && grep | && echo
+	${HOME} export printf 2>/dev/null sed 2>/dev/null grep test -eu | 2>/dev/null
+	local local | test test /usr/bin | /usr/bin echo && test /usr/bin
+	export 2>/dev/null $(pwd) x=1 then | local 2>/dev/null
+	awk grep test sed local x=1 sed sed $(pwd) sed
+	"$1" then cd | export local --verbose
+grep "$1" $(pwd) awk --verbose echo echo local "$1" 'quoted text' $(pwd)
+	2>/dev/null $(pwd) done | 'quoted text' 'quoted text'
+local "$@" && -eu sed -eu local grep
+2>/dev/null /usr/bin done 'quoted text' "$1" echo echo $(pwd) | /usr/bin
+	"$@" local done cd x=1 'quoted text'
+		-eu cd | /usr/bin test
+done | local export "$1"
+		export sed "$@" echo && export && "$@" -eu -eu /usr/bin
+${HOME} cd awk $(pwd) test 2>/dev/null 2>/dev/null echo 'quoted text' -eu
+	printf x=1 | /usr/bin printf sed test cd awk
+		sed cd 'quoted text' then ${HOME} sed
+cd $(pwd) export done "$@" 2>/dev/null sed
+	"$@" x=1 --verbose --verbose test
+	then export 'quoted text' sed awk
+export "$@" echo echo done 'quoted text' export && ${HOME} --verbose
+-eu grep test then then then readonly "$1" awk cd -eu grep
+		local && local && cd x=1 grep 'quoted text' awk sed x=1
+$(pwd) then "$1" && x=1 | --verbose local 'quoted text'
+echo /usr/bin "$@" awk $(pwd) readonly -eu sed ${HOME} sed
+-eu --verbose printf && cd export 2>/dev/null sed $(pwd)
+		done readonly "$@" ${HOME} grep
+${HOME} readonly readonly sed then x=1 "$@" local
+		grep test printf local && 2>/dev/null
+awk cd test sed then printf "$1" ${HOME} done 'quoted text'
+		printf x=1 /usr/bin 'quoted text' x=1 printf
+readonly cd ${HOME} "$@" ${HOME}
+test | done && then awk -eu "$@"
+	grep grep local "$1" cd awk && local then done then
+		$(pwd) export cd sed then 'quoted text' $(pwd) done |
+	export readonly awk $(pwd)
+		"$@" then done readonly -eu 2>/dev/null "$1"
+"$1" "$1" export readonly
+		/usr/bin 'quoted text' sed --verbose done awk 2>/dev/null
+		sed x=1 --verbose 2>/dev/null printf --verbose ${HOME} -eu
+	done done done sed ${HOME} grep
+		done awk | -eu grep 2>/dev/null "$1" local then $(pwd)
+		sed ${HOME} 'quoted text' done
+	cd /usr/bin ${HOME} ${HOME} "$@" local echo "$1" "$1"
+grep 2>/dev/null $(pwd) 2>/dev/null &&
+&& "$@" "$1" --verbose /usr/bin
+-eu /usr/bin echo export export export awk "$1" "$1" cd readonly "$1"
+		"$1" | cd 2>/dev/null export /usr/bin cd local test $(pwd)
+x=1 2>/dev/null --verbose test ${HOME}
+${HOME} done $(pwd) "$@" grep
+"$@" 2>/dev/null printf done /usr/bin x=1 | local
+	| 'quoted text' x=1 then && x=1 $(pwd) printf
+	'quoted text' cd | --verbose echo local
+export x=1 /usr/bin export then done sed && /usr/bin -eu
+&& && done cd | echo test 2>/dev/null
+		"$1" grep awk 'quoted text' "$@" done
+	| && done ${HOME} local local 2>/dev/null && awk &&
+2>/dev/null export -eu 'quoted text' readonly /usr/bin x=1 "$1" "$1" grep local
+	then /usr/bin && -eu ${HOME}
+export local local $(pwd) test
+&& /usr/bin done /usr/bin | && 2>/dev/null /usr/bin "$@"
+		awk ${HOME} sed "$1" printf 'quoted text'
+	"$1" "$1" then $(pwd) done cd export printf export
+test x=1 readonly "$@" "$@" then && printf then grep --verbose
+| ${HOME} ${HOME} printf 2>/dev/null cd 'quoted text' | 'quoted text'
+	$(pwd) "$@" export grep then && "$@" test test export -eu 2>/dev/null
+		${HOME} $(pwd) test grep readonly
+	| && $(pwd) -eu ${HOME}
+	/usr/bin -eu local --verbose 'quoted text' $(pwd) "$@"
+&& local 2>/dev/null | 'quoted text' --verbose x=1 && export
+sed x=1 sed 'quoted text' ${HOME} awk
+"$1" grep grep && readonly
+	x=1 2>/dev/null done && test
+test 'quoted text' "$1" "$@" echo | local echo local | 'quoted text'
+	export x=1 --verbose then 2>/dev/null ${HOME}
+	local --verbose /usr/bin | sed local "$@" --verbose x=1 "$1" 2>/dev/null
+then 'quoted text' "$@" sed printf x=1 | echo test done x=1 local
+	sed then 2>/dev/null test $(pwd)
+echo cd local awk echo | "$@"
+echo printf awk test cd && awk sed test printf && -eu awk /usr/bin && && local
+	"$1" --verbose test x=1 "$1" -eu /usr/bin done test ${HOME} ${HOME}
+	2>/dev/null "$1" done "$@" "$1" awk
+awk ${HOME} --verbose done local echo awk cd "$1" awk | printf
+		-eu test && "$@" $(pwd) then awk 2>/dev/null then echo
+-eu grep sed readonly x=1 echo readonly $(pwd) | "$@" -eu ${HOME} test then
+	"$@" --verbose -eu sed local
+/usr/bin cd then -eu export
+printf local test local "$@" printf x=1 $(pwd) done && $(pwd) readonly
+	${HOME} -eu x=1 then done echo /usr/bin done
+${HOME} 'quoted text' echo local
+	-eu then cd ${HOME} | 'quoted text' /usr/bin &&
+	$(pwd) 'quoted text' "$1" local done x=1 done
+	export 'quoted text' "$1" readonly "$@" echo awk readonly && 'quoted text'
+		/usr/bin then cd printf then | printf "$@" -eu ${HOME} readonly $(pwd) 2>/dev/null
+2>/dev/null ${HOME} echo "$1" "$@" echo 'quoted text'
+	--verbose 2>/dev/null ${HOME}
+printf ${HOME} "$@" then then cd /usr/bin x=1 $(pwd)
+	"$1" /usr/bin cd sed test 'quoted text' grep export "$1" --verbose
+		"$1" export $(pwd) | x=1 --verbose readonly && |
+--verbose x=1 done done sed printf 2>/dev/null 2>/dev/null -eu printf
+'quoted text' sed $(pwd) 'quoted text' cd 2>/dev/null ${HOME}
+${HOME} sed $(pwd) readonly ${HOME} grep test -eu awk
+	| echo sed 'quoted text' cd $(pwd) -eu "$1" "$1" test cd 2>/dev/null ${HOME}
+		$(pwd) ${HOME} ${HOME} readonly
+		2>/dev/null "$@" "$1" then readonly printf export printf local "$1" &&
+--verbose then && done local "$1" -eu echo
+		echo "$1" printf grep grep /usr/bin export then cd
+	/usr/bin test --verbose sed then 2>/dev/null test 2>/dev/null
+echo 2>/dev/null export --verbose export --verbose
+	test awk echo | $(pwd) awk export --verbose done awk | printf printf awk
+| ${HOME} cd done -eu --verbose /usr/bin "$1" export test local
+		'quoted text' local -eu $(pwd) -eu -eu
+	-eu test x=1 readonly test printf x=1 echo -eu ${HOME} && cd local export
+		x=1 "$@" awk $(pwd) cd x=1 test
+		done "$@" "$1" x=1 echo 2>/dev/null 'quoted text' sed export x=1 grep echo grep
+		"$@" ${HOME} "$@" "$1"
+'quoted text' ${HOME} -eu grep echo
+		2>/dev/null local printf done 'quoted text' -eu 'quoted text' readonly
+		/usr/bin -eu readonly 2>/dev/null readonly cd sed done printf done | printf
+	echo done x=1 then $(pwd) $(pwd) grep then x=1 ${HOME} 2>/dev/null
+	grep 'quoted text' ${HOME} local -eu --verbose readonly done export
+local /usr/bin grep --verbose -eu cd "$@" done $(pwd)
+	test /usr/bin printf then | test --verbose && cd local then "$@" done ${HOME}
+	cd local /usr/bin echo x=1 2>/dev/null then readonly local printf "$1" --verbose
+local x=1 cd /usr/bin readonly
+		$(pwd) "$1" export grep /usr/bin | test "$1" test local printf ${HOME} done
+		--verbose export -eu --verbose export "$@" | /usr/bin
+		grep export 'quoted text' test 'quoted text' awk
+		cd echo "$1" export ${HOME} && awk --verbose local done $(pwd) export &&
+x=1 ${HOME} x=1 echo awk $(pwd) | readonly done --verbose "$1"
+	"$1" echo grep local /usr/bin awk x=1 | printf "$1" done
+		x=1 export grep printf /usr/bin
+	test grep "$1" local local export cd printf
+		export export "$@" "$1" "$@" | done printf
+		local 2>/dev/null "$@" awk x=1 --verbose 'quoted text' "$@" $(pwd)
+-eu export then grep /usr/bin
+	--verbose 2>/dev/null export echo -eu
+		--verbose local ${HOME} test printf cd cd echo |
+	grep grep test then readonly -eu "$@" "$@" local then --verbose 2>/dev/null
+readonly printf 'quoted text' x=1 /usr/bin
+	--verbose awk $(pwd) x=1 export && cd export then
+printf test "$1" --verbose cd then 'quoted text'
+		2>/dev/null echo && x=1 -eu sed 2>/dev/null --verbose readonly 2>/dev/null
+	/usr/bin && /usr/bin x=1 printf readonly printf
+		done "$@" export "$1" cd done &&
+	&& cd local | "$1" export printf echo
+		'quoted text' awk ${HOME} $(pwd) "$1" echo /usr/bin cd 2>/dev/null
+export test printf readonly test "$@" test "$@" sed x=1
+	/usr/bin done printf printf export 'quoted text' readonly readonly ${HOME}
+	printf $(pwd) done awk local readonly x=1 awk
+		2>/dev/null --verbose test 2>/dev/null sed awk printf
+	"$@" -eu done | echo "$@" ${HOME} awk grep -eu then "$1" && x=1
+	/usr/bin awk | && 'quoted text'
+| $(pwd) "$1" export export --verbose done -eu $(pwd) done "$@" -eu $(pwd)
+-eu awk /usr/bin && then && "$1"
+"$@" "$@" echo cd test export printf cd -eu test /usr/bin then | grep /usr/bin
+	x=1 'quoted text' --verbose
+		awk cd then "$1" 2>/dev/null test
+	then ${HOME} "$1" cd test test x=1 2>/dev/null readonly cd readonly
+	| then awk -eu awk /usr/bin
+echo then --verbose && ${HOME} sed cd 2>/dev/null test $(pwd)
+		export echo -eu "$@" printf export --verbose x=1 sed readonly echo 2>/dev/null
+	grep ${HOME} --verbose grep "$1" echo cd
+		printf -eu "$@" 'quoted text' 2>/dev/null /usr/bin
+	"$1" 'quoted text' sed | 'quoted text' /usr/bin sed --verbose readonly x=1 x=1
+		&& 2>/dev/null x=1 cd --verbose readonly -eu | 'quoted text' export
+| x=1 awk readonly grep readonly
+then --verbose echo --verbose grep echo local done
+		echo --verbose "$@" printf 'quoted text' "$@" --verbose grep cd "$1" "$@"
+	cd $(pwd) cd awk echo test | && $(pwd) ${HOME}
+2>/dev/null x=1 "$1" test ${HOME} export /usr/bin echo
+	printf ${HOME} --verbose done $(pwd)
+		awk test $(pwd) echo cd awk "$1" x=1 then grep --verbose "$@"
+done awk done && sed 2>/dev/null | /usr/bin test "$1" "$@"
+export sed done 2>/dev/null grep
+"$1" && "$@" then local 'quoted text'
+	sed 2>/dev/null "$1" | -eu && sed
+		cd | "$@" -eu done awk 'quoted text' "$1"
+test /usr/bin then && "$@" printf
+		/usr/bin readonly -eu 2>/dev/null "$1" sed x=1 readonly readonly x=1 echo /usr/bin
+$(pwd) test 2>/dev/null cd "$1" /usr/bin | done test && awk done 'quoted text'
+	readonly export echo | ${HOME} "$@" -eu awk 'quoted text' done
+/usr/bin echo echo then -eu readonly grep test sed && 'quoted text'
+export x=1 /usr/bin && printf cd cd test
+export done local 'quoted text' sed && --verbose && -eu x=1 printf -eu 2>/dev/null
+--verbose $(pwd) readonly -eu done echo test -eu $(pwd)
+${HOME} done x=1 2>/dev/null
+	"$1" echo "$1" readonly 2>/dev/null | ${HOME} | x=1 readonly export
+	-eu 2>/dev/null ${HOME}
+	$(pwd) "$1" sed x=1 export
+		/usr/bin "$@" && --verbose then done printf
+		"$@" echo -eu 'quoted text' export awk echo awk
+x=1 ${HOME} test 2>/dev/null && test test grep $(pwd) echo sed -eu export
+	${HOME} /usr/bin printf | -eu /usr/bin
+		-eu readonly x=1 awk grep cd 'quoted text' --verbose
+$(pwd) --verbose 2>/dev/null test && /usr/bin /usr/bin ${HOME} | sed printf "$1"
+		"$@" local ${HOME} $(pwd) local 2>/dev/null
+done -eu done "$1" | local "$@" export 2>/dev/null | x=1 echo cd -eu
+		&& 2>/dev/null /usr/bin x=1 grep $(pwd) export echo "$@"
+echo sed x=1 local --verbose 2>/dev/null done
+--verbose test 2>/dev/null echo printf
+		/usr/bin grep done then
+		/usr/bin "$@" --verbose $(pwd) test $(pwd) 2>/dev/null
+	/usr/bin echo then 2>/dev/null
+	/usr/bin grep cd then 'quoted text' readonly "$1" done $(pwd) x=1 -eu
+local grep sed cd printf
+		$(pwd) | x=1 readonly --verbose "$@" x=1 grep readonly grep
+		readonly export x=1 -eu done x=1 sed awk done | printf sed then "$@" --verbose
+	${HOME} export /usr/bin echo -eu ${HOME} then
+	echo grep sed readonly "$1" done awk &&
+	$(pwd) && -eu printf --verbose --verbose ${HOME} test echo then && export done
+	$(pwd) $(pwd) awk "$@" export
+"$1" x=1 --verbose x=1 x=1 $(pwd) cd 'quoted text' "$@"
+		test awk done then "$@" done ${HOME} $(pwd) export /usr/bin
+		export printf /usr/bin readonly 2>/dev/null ${HOME}
+	-eu --verbose 2>/dev/null && 'quoted text' done
+		then --verbose ${HOME} "$1" local cd "$1" --verbose
+		'quoted text' -eu test /usr/bin |
+local ${HOME} printf --verbose 'quoted text'
+		${HOME} x=1 "$1" sed | done ${HOME} x=1 /usr/bin local
+| | "$1" awk ${HOME} readonly | awk | $(pwd) grep export cd
+	/usr/bin readonly | $(pwd) x=1 | -eu "$1" && ${HOME}
+$(pwd) | test sed readonly sed sed cd local /usr/bin
+	x=1 then $(pwd) grep done 'quoted text' ${HOME} ${HOME} cd "$1" readonly "$@"
+		echo readonly | cd sed sed | cd x=1 awk /usr/bin 2>/dev/null
+${HOME} test done -eu printf cd grep --verbose local
+sed "$@" x=1 test $(pwd) awk awk test /usr/bin && ${HOME} /usr/bin
+readonly awk cd echo $(pwd) local "$1" awk x=1 local local | "$@" $(pwd) "$1" sed
+		awk export /usr/bin echo --verbose cd /usr/bin 2>/dev/null
+		${HOME} $(pwd) "$@" -eu x=1 export then && $(pwd) printf $(pwd) x=1 local x=1
+	echo 2>/dev/null -eu then
+		readonly then printf "$1" x=1 $(pwd)
+then readonly sed x=1 --verbose --verbose local $(pwd) done grep && then
+		printf 2>/dev/null local --verbose $(pwd) readonly &&
+/usr/bin grep then 'quoted text' awk -eu sed readonly 2>/dev/null
+		cd sed local | echo done "$1" "$1" "$1" "$1" readonly
+	'quoted text' /usr/bin cd awk grep 2>/dev/null "$@" "$1" x=1 --verbose
+	export local done | && readonly ${HOME} sed "$@" printf -eu "$@" $(pwd)
+		readonly "$@" sed local -eu "$@" --verbose export export 'quoted text'
+	echo sed x=1 /usr/bin "$1"
+2>/dev/null | "$1" then done "$@" export "$1" readonly export &&
+awk grep sed x=1 readonly local --verbose then "$@"
+	test && cd grep cd done -eu --verbose 2>/dev/null
+grep echo readonly sed awk
+	cd cd /usr/bin ${HOME} | x=1 | -eu
+		grep export "$@" grep
+		-eu -eu ${HOME} readonly sed 2>/dev/null sed
+		echo $(pwd) $(pwd) x=1 echo printf
+		"$1" done 'quoted text' x=1 sed "$@" export && && | ${HOME} -eu | x=1 /usr/bin
+		export test local 'quoted text'
+$(pwd) then -eu done awk printf awk $(pwd) export printf
+		${HOME} ${HOME} export printf ${HOME} echo done /usr/bin && then $(pwd) awk
+	${HOME} export export /usr/bin
+		cd -eu ${HOME} 2>/dev/null printf
+	readonly readonly | /usr/bin $(pwd) cd cd echo export $(pwd) export
+local echo sed /usr/bin "$@" /usr/bin then echo awk 'quoted text' && grep
+	'quoted text' && "$@" printf sed
+		"$1" local | awk | awk echo local /usr/bin --verbose
+		test "$@" test cd echo done ${HOME}
+test local /usr/bin -eu 2>/dev/null echo echo done
+		/usr/bin $(pwd) | grep awk 2>/dev/null 'quoted text' -eu 'quoted text' then --verbose
+		2>/dev/null | grep printf | local local -eu | x=1 | done
+		$(pwd) sed sed /usr/bin && $(pwd) /usr/bin awk -eu "$@"
+--verbose x=1 local printf x=1 echo /usr/bin printf printf --verbose x=1
+		sed sed | ${HOME} | "$@" "$@" grep $(pwd) "$@" grep
+$(pwd) readonly readonly sed ${HOME}
+export awk "$@" echo ${HOME} /usr/bin 2>/dev/null sed
+		export | --verbose ${HOME} echo printf printf "$@"
+cd 'quoted text' -eu cd -eu
+	grep 2>/dev/null sed printf test -eu "$1"
+	${HOME} -eu echo ${HOME}
+x=1 --verbose ${HOME} "$@" /usr/bin --verbose
+export x=1 then local 2>/dev/null echo sed $(pwd) test x=1 | local
+	"$@" test printf /usr/bin "$1" done -eu export cd ${HOME} export -eu grep
+	2>/dev/null then awk "$1" --verbose readonly
+${HOME} x=1 sed then $(pwd) cd && sed awk "$@" | done printf grep |
+		export sed ${HOME} ${HOME} printf awk | /usr/bin /usr/bin echo
+	'quoted text' x=1 -eu --verbose grep -eu readonly /usr/bin
+	echo $(pwd) "$@" then readonly cd && echo sed 'quoted text'
+&& echo done test export echo | $(pwd) x=1 && | | ${HOME} grep -eu local cd
+	grep "$@" $(pwd) --verbose "$1" export /usr/bin | $(pwd) printf x=1 ${HOME}
+		x=1 2>/dev/null "$@" test x=1 then sed grep grep
+	x=1 "$@" "$@" ${HOME} echo sed && sed echo 'quoted text'
+done /usr/bin awk then 2>/dev/null | "$1" "$@" cd grep "$1" $(pwd) export
+	cd $(pwd) readonly /usr/bin && sed | cd $(pwd)
+-eu then echo ${HOME} echo --verbose
+		sed printf | 2>/dev/null readonly | grep done local echo "$1" 2>/dev/null
+	awk $(pwd) echo ${HOME} -eu then x=1 then awk grep export cd awk grep |
+	awk -eu ${HOME} export local ${HOME} grep export then "$1"
+| x=1 printf 'quoted text' 'quoted text' grep test /usr/bin
+		"$@" readonly test printf "$@" then /usr/bin
+	"$1" --verbose --verbose printf cd /usr/bin -eu sed sed
+		awk && then grep --verbose
+	sed export $(pwd) cd local sed export "$@" printf
+		"$@" "$1" echo ${HOME} awk -eu /usr/bin
+		sed then 'quoted text' 'quoted text' done sed
+		--verbose then awk export done test && "$1" grep | "$1" | 2>/dev/null x=1
+test /usr/bin ${HOME} printf
+grep "$@" cd 'quoted text' echo
+		grep /usr/bin sed local && printf "$1" test done done grep awk then
+	x=1 "$1" "$1" -eu "$@" test -eu grep
+		then sed test local x=1 'quoted text' cd && 'quoted text' readonly ${HOME} /usr/bin
+printf printf && ${HOME} -eu -eu grep grep && printf "$@"
+local done printf local --verbose
+done x=1 'quoted text' done readonly echo ${HOME} printf export sed test then
+		awk echo x=1 "$@" && echo then sed done
+${HOME} done -eu --verbose
+$(pwd) export x=1 awk cd --verbose
+		local echo ${HOME} $(pwd) && done awk then local readonly
+| readonly /usr/bin cd done local then x=1 local | x=1 2>/dev/null
+	2>/dev/null grep 2>/dev/null && -eu && ${HOME} "$@" local awk "$1" ${HOME} local
+		-eu awk /usr/bin | "$1" --verbose /usr/bin test
+		&& cd cd | "$1" then test 'quoted text' && echo then then
+	2>/dev/null readonly awk readonly $(pwd) sed "$1" 2>/dev/null
+	2>/dev/null && awk $(pwd) then "$@"
+		/usr/bin /usr/bin then 2>/dev/null printf /usr/bin local
+2>/dev/null --verbose 2>/dev/null sed done local export then
+		readonly $(pwd) export cd printf 'quoted text'
+		awk test grep "$@" readonly
+		${HOME} "$@" 'quoted text' 2>/dev/null printf local
+		cd grep 2>/dev/null export -eu sed export then cd --verbose 2>/dev/null
+		export && "$1" printf /usr/bin "$1" done grep --verbose
+	test "$@" readonly /usr/bin /usr/bin echo "$@" 'quoted text' 2>/dev/null "$1"
+awk sed test test /usr/bin "$@" awk export sed "$1" sed cd grep
+		awk awk export 'quoted text'
+x=1 $(pwd) export --verbose
+awk $(pwd) echo "$1" then printf 2>/dev/null printf export cd "$1" test
+	readonly test && x=1 'quoted text'
+		test -eu "$1" 2>/dev/null printf && && printf x=1 local then --verbose --verbose
+awk /usr/bin awk then && --verbose 2>/dev/null /usr/bin
+		local 2>/dev/null test --verbose awk 2>/dev/null && $(pwd) local test grep
+		echo awk "$1" && cd readonly $(pwd) done 2>/dev/null grep local "$1" readonly
+		$(pwd) 2>/dev/null --verbose | $(pwd) test echo "$1" -eu
+		/usr/bin 'quoted text' && 2>/dev/null x=1 local local
+sed -eu test readonly $(pwd) then ${HOME}
+	then grep cd --verbose --verbose cd /usr/bin -eu | "$@" "$@" ${HOME} ${HOME}
+cd ${HOME} awk local /usr/bin done sed local
+		grep 2>/dev/null local printf -eu echo export
+x=1 grep 'quoted text' sed test 'quoted text'
+		-eu readonly | grep printf ${HOME} printf --verbose done /usr/bin "$1"
+	| "$@" grep 2>/dev/null /usr/bin
+	'quoted text' "$1" "$@" readonly
+	done cd /usr/bin --verbose then done ${HOME}
+		x=1 readonly $(pwd) export x=1 grep local export then ${HOME} cd "$@"
+/usr/bin | -eu echo test -eu | 2>/dev/null /usr/bin cd cd done
+		sed 'quoted text' x=1 'quoted text' /usr/bin echo echo "$1"
+	-eu printf 'quoted text' "$1" 'quoted text' &&
+test x=1 cd -eu echo export sed sed "$@"
+		then x=1 test | | -eu 2>/dev/null cd 'quoted text'
+local test echo grep ${HOME} then done -eu export "$1" --verbose ${HOME} && export
+		local export cd cd then cd then readonly "$1" -eu x=1
+		"$1" done export done /usr/bin
+	/usr/bin "$@" "$@" && grep readonly
+	export done echo cd awk sed awk "$1" then ${HOME} export readonly $(pwd) readonly
+$(pwd) local awk 2>/dev/null grep 2>/dev/null echo done && done local x=1
+then export test ${HOME} printf 'quoted text' grep ${HOME} 2>/dev/null test
+	then 'quoted text' x=1 test local local
+		readonly cd "$1" x=1 2>/dev/null
+	${HOME} cd /usr/bin 'quoted text' then 'quoted text' printf export x=1
+/usr/bin 2>/dev/null local | test local 'quoted text' echo "$@"
+	grep | -eu $(pwd) | --verbose echo done
+$(pwd) test awk printf
+		sed -eu readonly && awk cd then then
+sed then /usr/bin /usr/bin export grep
+"$@" readonly done export sed readonly
+	done ${HOME} 'quoted text' test
+	$(pwd) ${HOME} echo sed "$1" then
+	2>/dev/null && 'quoted text'
+test local ${HOME} ${HOME} echo "$1" test export /usr/bin sed echo then echo echo
+	-eu readonly | grep 'quoted text' -eu sed /usr/bin printf done local
+export done "$@" 'quoted text' done cd local 2>/dev/null
+	readonly 2>/dev/null local local printf ${HOME} && --verbose "$1" printf export
+--verbose /usr/bin x=1 local ${HOME} readonly
+		| 2>/dev/null echo "$1" then grep 'quoted text' -eu test 2>/dev/null
+	echo sed done $(pwd) 2>/dev/null 2>/dev/null /usr/bin
+		--verbose sed awk x=1 local 'quoted text' 2>/dev/null 'quoted text'
+		sed /usr/bin export then $(pwd) -eu $(pwd) "$1" 2>/dev/null $(pwd) awk printf
+	test $(pwd) 2>/dev/null then printf ${HOME} printf sed "$@" ${HOME} then done
+		export test $(pwd) 2>/dev/null then local "$@" | sed "$1"
+	awk && 2>/dev/null "$@" echo done export -eu printf -eu grep grep printf
+	test "$1" -eu "$1" then | then /usr/bin local
+		printf printf 'quoted text'
+--verbose sed echo grep x=1 | sed -eu sed cd -eu then x=1 'quoted text' /usr/bin
+	| "$1" then ${HOME} x=1 2>/dev/null then $(pwd) done printf done
+x=1 | echo 2>/dev/null done /usr/bin | "$1" awk -eu done
+"$1" local grep "$1" 2>/dev/null awk ${HOME} "$@" ${HOME} ${HOME} grep
+export printf cd printf 'quoted text' test 'quoted text'
+	$(pwd) 'quoted text' $(pwd)
+	readonly awk /usr/bin sed "$@" --verbose 2>/dev/null done done | "$1" && /usr/bin
+	--verbose awk 'quoted text' && export
+${HOME} x=1 | ${HOME} awk local 2>/dev/null echo printf "$@" echo $(pwd)
+	$(pwd) 'quoted text' awk ${HOME} export
+		x=1 "$1" test $(pwd) done readonly
+| awk "$@" done "$1" /usr/bin then --verbose awk | test cd done grep | awk done
+		$(pwd) local printf export printf
+grep sed cd test && $(pwd) cd done cd echo ${HOME} --verbose
+		then grep "$@" grep "$1" then test readonly done cd readonly
+export --verbose --verbose && local
+	printf echo sed grep /usr/bin local -eu cd ${HOME} export
+${HOME} 'quoted text' export cd 2>/dev/null
+'quoted text' readonly echo 'quoted text'
+$(pwd) readonly ${HOME} "$@" "$@" test /usr/bin x=1 awk
+	done done ${HOME} grep | test grep /usr/bin ${HOME} cd x=1 export
+2>/dev/null "$1" echo 'quoted text' "$1"
+local then then echo ${HOME} then sed 2>/dev/null done -eu -eu | $(pwd) x=1 grep
+		-eu $(pwd) --verbose cd "$@" awk $(pwd) local | local
+"$1" grep done --verbose echo | local test 'quoted text' printf x=1
+${HOME} awk 'quoted text'
+		| done printf 2>/dev/null
+	${HOME} 2>/dev/null local | /usr/bin "$@" echo $(pwd) $(pwd) local &&
+		'quoted text' && grep test
+$(pwd) /usr/bin test sed x=1 printf then readonly 'quoted text' x=1 2>/dev/null
+	test && echo echo readonly 'quoted text' $(pwd)
+		local test echo done done -eu ${HOME} local cd echo /usr/bin -eu |
+	"$1" ${HOME} echo $(pwd) grep
+	2>/dev/null test "$@" 2>/dev/null
+	echo grep "$@" | 2>/dev/null readonly
+	then /usr/bin "$@" "$@" -eu /usr/bin
+	2>/dev/null ${HOME} then test --verbose test 'quoted text' sed grep 2>/dev/null
+	| "$@" test 'quoted text' x=1 echo "$1" local sed echo && x=1 test
+	export cd then done 2>/dev/null
+		sed echo "$@" sed then $(pwd) readonly export "$1" cd then grep echo "$@"
+		"$@" awk then "$@" then cd -eu -eu printf
+	| "$@" grep /usr/bin ${HOME} awk /usr/bin $(pwd) echo echo ${HOME} echo
+	2>/dev/null 'quoted text' cd then | echo 'quoted text' then
+grep -eu /usr/bin local done $(pwd) echo | 'quoted text'
+		grep grep x=1 test grep /usr/bin $(pwd) printf --verbose
+cd test printf 'quoted text' awk 2>/dev/null
+		sed then x=1 printf --verbose grep $(pwd) x=1 /usr/bin /usr/bin
+sed 'quoted text' && ${HOME}
+		2>/dev/null sed --verbose sed /usr/bin "$@" -eu -eu ${HOME}
+${HOME} sed cd done then && $(pwd) then sed
+		readonly echo $(pwd) sed /usr/bin ${HOME} 2>/dev/null done x=1 x=1 "$1" x=1 -eu
+	echo echo local ${HOME} && sed done x=1 --verbose $(pwd) /usr/bin cd
+	printf then "$@" test "$1" -eu --verbose done cd
+		2>/dev/null sed 2>/dev/null x=1 test --verbose | $(pwd) && | x=1 ${HOME}
+		/usr/bin grep "$@" awk "$@" ${HOME} ${HOME} 2>/dev/null && export
+readonly cd 'quoted text' $(pwd)
+	/usr/bin then sed grep printf -eu "$1" grep $(pwd) export /usr/bin
+	then cd 2>/dev/null sed 2>/dev/null export "$@" done && 2>/dev/null sed
+	2>/dev/null export export cd --verbose printf
+		2>/dev/null echo local -eu x=1 test && readonly echo echo sed
+	/usr/bin echo --verbose && cd && echo export
+		'quoted text' && 2>/dev/null echo sed "$1" "$@" 'quoted text' sed 2>/dev/null
+done export && test grep $(pwd) echo 2>/dev/null test done -eu 2>/dev/null
+	local then echo "$1" echo -eu readonly done $(pwd) --verbose /usr/bin -eu x=1 "$@"
+	readonly /usr/bin local readonly local x=1
+		grep readonly export ${HOME} sed $(pwd) export test grep $(pwd) done
+	printf export awk sed --verbose
+&& test --verbose grep /usr/bin awk cd cd
+	--verbose readonly $(pwd) printf printf readonly
+		test && done awk "$1" | export done grep echo awk done && local export
+'quoted text' done "$@" x=1 test ${HOME} export grep test "$1" export export
+	--verbose test then export /usr/bin
+	done cd "$1" x=1 done grep 'quoted text' /usr/bin
+	done /usr/bin x=1 'quoted text' -eu 2>/dev/null "$@" /usr/bin | "$@" --verbose
+&& echo cd sed awk awk printf export echo local "$1" &&
+done 'quoted text' --verbose ${HOME} sed 2>/dev/null then $(pwd)
+	2>/dev/null -eu $(pwd) echo export
+then 2>/dev/null export /usr/bin
+	${HOME} awk "$1" ${HOME} /usr/bin readonly echo "$1" ${HOME} 'quoted text' readonly
+then -eu "$1" grep /usr/bin "$1" | echo cd $(pwd) $(pwd) "$@" --verbose
+'quoted text' awk && | sed ${HOME} readonly 2>/dev/null && printf
+		/usr/bin printf $(pwd) | local local printf --verbose
+readonly 'quoted text' "$@" ${HOME} test sed then --verbose then local --verbose
+		--verbose export ${HOME} "$1" "$1" 2>/dev/null export awk -eu
+		2>/dev/null done awk echo -eu
+	${HOME} "$1" done test done x=1 done 'quoted text' 2>/dev/null grep printf "$@"
+	local cd 2>/dev/null printf test readonly sed ${HOME} | then
+		sed x=1 test 'quoted text' awk && sed $(pwd) 2>/dev/null "$1" done
+		-eu /usr/bin | done readonly sed local /usr/bin readonly /usr/bin "$@"
+export cd --verbose awk
+		sed printf "$1" printf cd
+		sed then printf 2>/dev/null -eu && &&
+		| -eu && ${HOME} 2>/dev/null | 'quoted text' done "$@" | export then $(pwd) && echo
+printf readonly 2>/dev/null readonly
+&& sed && 2>/dev/null --verbose awk ${HOME} done local done
+	grep $(pwd) --verbose | export x=1 ${HOME} echo --verbose test
+		"$@" | test printf grep --verbose done
+	cd printf printf "$@" /usr/bin && $(pwd) --verbose export awk --verbose
+x=1 sed test then printf 'quoted text' then grep then printf
+-eu grep printf done export test /usr/bin test /usr/bin sed x=1 cd | then
+		local /usr/bin | test /usr/bin /usr/bin "$1" --verbose cd --verbose printf
+	grep done --verbose echo cd grep /usr/bin "$@" sed cd sed printf "$@" printf
+readonly -eu done "$@" 2>/dev/null --verbose 'quoted text' then grep awk -eu
+		${HOME} x=1 cd x=1 done 'quoted text' sed done
+		--verbose test 'quoted text' $(pwd) -eu 2>/dev/null /usr/bin
+done | local $(pwd) 2>/dev/null "$1" ${HOME} readonly
+		then "$1" --verbose -eu done grep "$@" test export
+		test x=1 $(pwd) export "$@" 'quoted text'
+		grep done 2>/dev/null export then export
+		| awk sed awk "$1" ${HOME} x=1 $(pwd) | test test
+	export local /usr/bin /usr/bin /usr/bin
+printf export awk | cd --verbose "$@" then "$@"
+	awk -eu "$@" test 'quoted text' /usr/bin
+	sed done 'quoted text' x=1 'quoted text'
+echo | local 'quoted text' --verbose $(pwd) -eu done ${HOME} local printf export
+	local awk printf local -eu done export readonly cd "$@"
+grep awk local export sed x=1 test
+--verbose -eu then && awk done readonly
+	done export | export echo sed cd --verbose readonly cd 2>/dev/null | sed --verbose
+	cd | -eu then sed && "$1" "$1" /usr/bin echo echo
+printf $(pwd) local grep echo sed readonly
+	--verbose awk "$@" "$@" && ${HOME} readonly
+	printf done $(pwd) 2>/dev/null | echo export "$1" cd echo | done
+then test | then 'quoted text' then $(pwd) ${HOME} "$@" 'quoted text'
+	"$1" cd "$1" | export grep done "$@" x=1 $(pwd)
+	readonly "$1" && test && && then x=1 "$1" | ${HOME} then readonly "$@" /usr/bin
+awk echo ${HOME} $(pwd) $(pwd) "$1" export
+test local cd | $(pwd) export 2>/dev/null /usr/bin
+awk -eu readonly sed "$1" 'quoted text' echo sed test readonly test && readonly
+	done ${HOME} readonly "$1" cd sed done
+		'quoted text' done test 'quoted text' $(pwd) --verbose echo
+		then | export echo local cd sed test "$@" echo grep readonly
+export -eu /usr/bin "$@" sed /usr/bin /usr/bin
+		x=1 readonly test export grep test
+		&& && local printf --verbose test local --verbose 'quoted text' /usr/bin
+done readonly local done then | local && printf
+		awk export printf 'quoted text' sed printf
+&& 'quoted text' "$@" echo 'quoted text' | sed export
+		--verbose /usr/bin grep ${HOME} -eu grep x=1 -eu grep then -eu
+	/usr/bin /usr/bin 'quoted text' -eu x=1 --verbose then
+	grep x=1 | 'quoted text' ${HOME} echo cd done
+	2>/dev/null ${HOME} export "$@" 'quoted text'
+	test sed 2>/dev/null
+printf readonly done "$1" --verbose ${HOME} then
+x=1 cd sed echo local done "$1" sed done | sed 2>/dev/null /usr/bin
+printf "$1" && awk readonly
+	readonly done grep $(pwd) /usr/bin
+"$@" cd ${HOME} && -eu 2>/dev/null awk | then awk sed cd
+done | ${HOME} echo then grep "$1" awk done | cd ${HOME} 'quoted text'
+		then x=1 2>/dev/null test 2>/dev/null 'quoted text' then "$1" readonly
+local "$1" x=1 -eu | | /usr/bin cd x=1 readonly | printf x=1 export awk export
+	"$1" then x=1 /usr/bin done cd readonly
+		readonly test grep local "$1" printf printf x=1 | /usr/bin grep "$@"
+	readonly then && export test 2>/dev/null awk export
+export "$1" test "$1" "$1" 2>/dev/null then && "$@" && export printf "$@" awk --verbose
+		grep | echo then && /usr/bin /usr/bin
+2>/dev/null echo $(pwd) 2>/dev/null ${HOME} sed done --verbose x=1 "$@" "$1"
+		echo | then local test awk 'quoted text'
+awk done done "$1" 2>/dev/null x=1 export then test
+	echo local "$@" x=1 x=1 then done echo echo cd cd cd 'quoted text' grep
+	sed local awk export /usr/bin -eu 2>/dev/null cd grep export -eu sed local
+	grep printf export -eu printf "$@" done printf -eu local awk "$@" "$@" readonly
+	export echo then "$@" $(pwd) cd cd readonly --verbose local -eu
+2>/dev/null sed awk "$@" 2>/dev/null "$@" grep --verbose sed local
+${HOME} && printf /usr/bin 2>/dev/null | done x=1 ${HOME} readonly export cd |
+test x=1 test local echo -eu test awk 'quoted text' sed readonly /usr/bin grep $(pwd)
+awk echo $(pwd) && done awk 'quoted text' then "$@" grep printf 'quoted text'
+		readonly cd | | test "$1" -eu sed ${HOME} awk -eu "$1" "$1" &&
+	&& done then "$1" "$@" printf local /usr/bin | x=1 grep printf
+		test /usr/bin $(pwd) awk awk ${HOME} grep x=1 readonly ${HOME} sed 2>/dev/null
+		echo "$1" --verbose "$1" echo awk x=1 2>/dev/null sed | 2>/dev/null
+	&& -eu grep 2>/dev/null echo readonly local awk done --verbose
+	sed grep local awk awk awk readonly grep
+		sed readonly test /usr/bin && -eu | then readonly $(pwd) &&
+		$(pwd) $(pwd) then "$1" &&
+		local | test | done -eu -eu export
+local && local awk | then local /usr/bin | local done printf printf | "$@"
+		printf "$@" x=1 $(pwd) local
+x=1 cd $(pwd) -eu "$@" x=1 awk
+	"$1" cd then && | readonly readonly -eu awk | 2>/dev/null readonly grep awk
+		x=1 export then done sed "$@" printf awk local --verbose export "$@" local
+		"$@" 2>/dev/null "$@" test
+		/usr/bin done awk then echo grep | then $(pwd) readonly readonly cd
+	cd -eu export 2>/dev/null sed ${HOME} sed --verbose
+		echo ${HOME} export 2>/dev/null awk echo 'quoted text'
+--verbose test x=1 | readonly $(pwd) /usr/bin done && /usr/bin
+		x=1 x=1 'quoted text' export "$@" && test $(pwd) printf && $(pwd) test
+	x=1 2>/dev/null 'quoted text' /usr/bin export --verbose done
+&& x=1 sed grep then local local test 'quoted text'
+	test test x=1 ${HOME} 'quoted text' readonly printf grep x=1 local &&
+	cd /usr/bin /usr/bin -eu then /usr/bin sed "$@" grep sed "$@" /usr/bin 'quoted text'
+		sed "$@" | ${HOME} && readonly local --verbose
+test 2>/dev/null done
@@ -0,0 +1,2001 @@
+--verbose sed ${HOME} export 2>/dev/null /usr/bin echo
+"$1" cd "$@" /usr/bin
+readonly --verbose && "$@" x=1 echo
+done done printf then "$1" "$1" grep ${HOME} |
+		x=1 x=1 && --verbose --verbose
+		grep done ${HOME} --verbose /usr/bin printf awk printf
+cd grep | --verbose && 2>/dev/null
+		$(pwd) | --verbose done awk ${HOME} 'quoted text' then readonly test "$@" echo
+		local x=1 /usr/bin cd "$1" sed $(pwd) 'quoted text'
+		&& "$1" x=1 2>/dev/null cd export -eu local 2>/dev/null then /usr/bin awk
+	awk x=1 grep echo | "$@" grep then
+		| local printf readonly echo readonly done grep done /usr/bin printf x=1 /usr/bin
+		'quoted text' "$@" && test "$1" export
+	cd | 'quoted text' then && | printf ${HOME} $(pwd)
+		"$@" | | "$1" awk cd grep grep /usr/bin echo 2>/dev/null
+		export sed sed | export x=1 then "$1" /usr/bin ${HOME} && --verbose
+"$1" ${HOME} "$1" awk test "$@" test x=1 'quoted text'
+		${HOME} --verbose awk | test export | --verbose | echo | then -eu readonly printf
+		then --verbose x=1 awk ${HOME} 'quoted text'
+	x=1 local done export | echo --verbose
+export sed grep export 'quoted text'
+done $(pwd) printf export local local echo -eu -eu readonly test
+| $(pwd) ${HOME} then printf && echo awk awk | local then ${HOME} local 2>/dev/null
+	$(pwd) $(pwd) test test && export local x=1 $(pwd) test && echo echo
+--verbose 'quoted text' sed -eu cd printf grep
+		/usr/bin $(pwd) grep | readonly
+awk cd test 'quoted text' cd --verbose local | 'quoted text' |
+	${HOME} 'quoted text' done
+		"$@" printf test | done echo "$1"
+		sed x=1 'quoted text' ${HOME} "$1"
+	printf | echo test -eu grep sed export then cd then test 'quoted text'
+		'quoted text' then | 'quoted text' printf 2>/dev/null then 'quoted text'
+		readonly test "$1" x=1 export grep
+		local grep awk cd export "$1" | 2>/dev/null | 'quoted text'
+	"$@" local printf echo -eu 2>/dev/null
+		x=1 grep 2>/dev/null | "$@" 2>/dev/null
+		printf echo $(pwd) grep sed -eu "$@" "$1" "$@" export 2>/dev/null local --verbose
+sed && readonly sed $(pwd) readonly
+		local "$@" test done /usr/bin $(pwd) "$@" cd done "$1" awk test local -eu x=1
+	"$1" x=1 2>/dev/null && awk 'quoted text'
+	--verbose test grep printf && then readonly awk |
+		readonly /usr/bin -eu grep echo /usr/bin test echo | -eu $(pwd) --verbose
+	test test "$@" x=1 -eu 'quoted text' awk done test && x=1 "$@" ${HOME} done
+-eu x=1 cd export then readonly "$@" x=1 --verbose 'quoted text' $(pwd)
+then grep sed ${HOME} sed sed 2>/dev/null readonly "$1" printf done
+		"$1" /usr/bin local local "$@" 2>/dev/null "$@"
+	then readonly --verbose grep && echo test
+	--verbose "$1" local | 'quoted text' | ${HOME} ${HOME} then 2>/dev/null
+	-eu /usr/bin cd --verbose -eu 'quoted text' grep
+	'quoted text' printf export /usr/bin
+'quoted text' awk test "$1"
+		awk test export echo -eu echo && export --verbose test "$1" readonly then
+		&& echo readonly test | 'quoted text' -eu printf cd printf /usr/bin test "$1" &&
+	/usr/bin printf cd "$1" x=1 export cd export
+&& then test ${HOME} 'quoted text' awk x=1
+sed $(pwd) then 'quoted text' readonly grep "$1"
+		"$1" x=1 done && -eu | done 'quoted text' | cd && printf
+	&& awk "$1" $(pwd) "$1" grep test ${HOME}
+/usr/bin export --verbose 2>/dev/null printf -eu sed --verbose export $(pwd)
+	'quoted text' then "$@" done local
+	"$@" then && -eu readonly printf echo
+x=1 ${HOME} x=1 then then sed | sed ${HOME} then x=1 cd done $(pwd)
+	2>/dev/null done sed echo awk --verbose printf
+x=1 x=1 /usr/bin "$1" cd printf grep --verbose | 'quoted text' "$@" /usr/bin
+	| printf && && x=1 "$1" grep && awk /usr/bin echo test && "$1" done
+	then x=1 'quoted text' sed -eu awk x=1 ${HOME} -eu 'quoted text'
+		"$@" echo $(pwd) --verbose "$@" "$1"
+	"$@" --verbose "$1" echo /usr/bin readonly
+		local ${HOME} "$@" --verbose echo
+		grep "$@" printf "$@" 2>/dev/null export test export grep test test
+		-eu | "$@" awk test printf | 2>/dev/null echo && local test 'quoted text'
+		cd x=1 then cd --verbose echo done $(pwd) "$@" cd 2>/dev/null -eu
+test "$1" cd readonly /usr/bin "$@" local test /usr/bin test $(pwd) 2>/dev/null
+		/usr/bin test /usr/bin 2>/dev/null awk ${HOME} -eu
+		$(pwd) x=1 done sed "$@"
+		grep -eu "$@" ${HOME} --verbose
+	readonly readonly $(pwd) ${HOME} | then cd export "$@" then ${HOME}
+		readonly /usr/bin then then local then test echo
+		&& cd cd "$1" done sed --verbose test grep && readonly
+export x=1 --verbose
+done readonly export && x=1 grep && echo local printf
+	printf -eu 'quoted text' test export --verbose
+cd 2>/dev/null readonly done x=1 sed printf /usr/bin $(pwd) done grep local
+		&& cd grep echo -eu sed readonly awk export $(pwd) done "$1" --verbose
+grep local && 'quoted text'
+		/usr/bin then grep $(pwd) cd /usr/bin "$@"
+	-eu $(pwd) 2>/dev/null ${HOME} --verbose echo 2>/dev/null then
+	echo "$1" grep -eu /usr/bin echo 2>/dev/null 2>/dev/null && | readonly export
+	grep 'quoted text' done awk local awk | awk 'quoted text'
+	${HOME} 'quoted text'
+echo local then && awk /usr/bin sed $(pwd) /usr/bin grep "$1" ${HOME}
+x=1 grep "$1" done --verbose export && x=1 export done then 'quoted text' /usr/bin
+awk test cd -eu x=1 test printf --verbose -eu 2>/dev/null
+		local 'quoted text' cd /usr/bin
+--verbose $(pwd) -eu 2>/dev/null echo awk
+	local local local printf "$@" sed --verbose /usr/bin printf sed echo
+local readonly readonly awk 2>/dev/null
+test printf then export local cd "$@" readonly ${HOME} ${HOME}
+	printf ${HOME} ${HOME} done done 2>/dev/null
+		export done test test -eu "$@"
+	done 2>/dev/null -eu 'quoted text'
+	x=1 sed awk cd local grep --verbose 2>/dev/null ${HOME} /usr/bin x=1 printf
+		local grep | 2>/dev/null /usr/bin test | "$1" export 'quoted text'
+	echo export local $(pwd) sed
+	"$@" "$@" x=1 awk | printf
+		then | sed ${HOME} export local
+		cd 'quoted text' test grep local
+readonly cd export && && readonly -eu
+		echo $(pwd) | cd sed cd && /usr/bin
+		2>/dev/null && cd then ${HOME} printf
+	test x=1 -eu export then echo local
+cd 2>/dev/null "$1" readonly sed /usr/bin grep local $(pwd) /usr/bin done -eu x=1
+	grep awk && "$1" ${HOME} 2>/dev/null export readonly ${HOME} &&
+	test | test readonly ${HOME} sed sed then awk ${HOME} && "$@" && cd local /usr/bin
+	"$1" $(pwd) ${HOME} x=1 then x=1 cd printf 2>/dev/null "$@"
+readonly -eu sed && sed echo export && | x=1 done local | --verbose
+	awk --verbose sed -eu 'quoted text' ${HOME} "$1" cd $(pwd) export 'quoted text'
+	"$1" x=1 'quoted text' && test --verbose x=1
+		"$@" "$1" grep test export 2>/dev/null grep "$1" then awk
+2>/dev/null && echo awk local test grep awk printf --verbose ${HOME} grep
+echo local readonly printf x=1 $(pwd) "$1" && local /usr/bin ${HOME} grep export
+local awk -eu "$1" awk ${HOME} -eu
+local sed "$@" local echo 'quoted text' -eu 'quoted text' | "$@" -eu 'quoted text'
+		printf then local 2>/dev/null cd echo --verbose "$1" test
+	| grep 'quoted text' cd printf test readonly readonly 2>/dev/null printf &&
+export x=1 x=1 done "$1"
+		test done | readonly /usr/bin $(pwd) grep local /usr/bin
+	'quoted text' local 'quoted text' awk && |
+	local --verbose done printf then readonly
+		--verbose 2>/dev/null --verbose echo 2>/dev/null ${HOME} | grep --verbose
+done --verbose export | "$@" && grep then awk && | --verbose
+cd export printf export grep export -eu local "$@" cd && echo --verbose export
+		/usr/bin /usr/bin $(pwd) echo echo $(pwd) -eu printf 2>/dev/null echo --verbose
+		export done x=1 /usr/bin readonly
+cd ${HOME} 2>/dev/null done 2>/dev/null export
+		2>/dev/null awk awk | 2>/dev/null then printf then readonly
+		local sed sed --verbose export sed
+	export /usr/bin --verbose /usr/bin x=1 sed test && 2>/dev/null 2>/dev/null
+test | printf local $(pwd) sed && then $(pwd)
+| grep echo echo 'quoted text' 2>/dev/null --verbose $(pwd) -eu | printf
+echo | --verbose "$@" test
+		done "$1" done echo printf then x=1 'quoted text'
+		then readonly cd $(pwd) sed sed "$@" awk done cd cd readonly readonly
+		awk grep /usr/bin cd /usr/bin --verbose sed x=1 readonly done
+	done ${HOME} echo test 'quoted text' cd x=1 'quoted text'
+cd printf -eu export readonly
+x=1 "$1" local local $(pwd) grep /usr/bin -eu /usr/bin
+readonly $(pwd) printf | $(pwd) 2>/dev/null
+		export readonly printf sed -eu && "$1" | readonly printf awk test ${HOME}
+then local sed readonly --verbose
+	cd then test export export
+export done ${HOME} readonly grep ${HOME} done && "$@" x=1 sed ${HOME} printf
+		echo cd $(pwd) printf readonly
+	then then then 'quoted text' | && sed ${HOME} $(pwd) -eu grep
+	&& test test sed local awk && then local $(pwd) "$@" ${HOME} export readonly
+	"$@" then $(pwd) $(pwd) "$@" printf && echo done export | 2>/dev/null
+		readonly ${HOME} && grep printf done --verbose && x=1 local then
+	sed awk ${HOME} then then ${HOME} /usr/bin 2>/dev/null 'quoted text'
+/usr/bin | awk -eu then "$1" "$1"
+	2>/dev/null export | | ${HOME} grep test --verbose x=1 cd sed | && | export
+	grep $(pwd) 'quoted text' export echo 'quoted text' "$@" && 2>/dev/null $(pwd) done
+	x=1 $(pwd) readonly ${HOME} /usr/bin 2>/dev/null grep readonly grep export
+	grep /usr/bin "$@" grep ${HOME} 'quoted text' /usr/bin
+	printf ${HOME} then -eu grep cd printf local grep
+		echo echo cd "$1" cd | 2>/dev/null $(pwd) printf --verbose "$1" awk "$1" echo
+	done /usr/bin done /usr/bin then echo then sed echo x=1 --verbose
+cd then local grep local --verbose -eu test x=1 test && done done echo sed then
+		$(pwd) export readonly local cd 2>/dev/null
+echo local "$@" local -eu $(pwd) printf
+	| 2>/dev/null then "$@" awk printf $(pwd)
+		done && && printf awk x=1 export
+| echo test echo x=1 test $(pwd) cd 2>/dev/null
+echo readonly test "$1" done awk local /usr/bin echo sed sed "$@" 'quoted text'
+		&& | grep printf 2>/dev/null echo
+		sed test x=1 && done local -eu ${HOME} printf "$1" sed "$1" grep
+	--verbose cd "$1" done
+${HOME} 2>/dev/null grep 'quoted text' echo sed x=1 /usr/bin test 2>/dev/null
+	/usr/bin /usr/bin /usr/bin $(pwd) echo awk | export echo ${HOME} --verbose
+		local | test /usr/bin $(pwd) "$1" awk readonly readonly 2>/dev/null "$1"
+	/usr/bin ${HOME} local
+		2>/dev/null ${HOME} --verbose && "$@" 2>/dev/null
+	'quoted text' printf | printf
+	| x=1 --verbose printf ${HOME} $(pwd) /usr/bin "$1" && readonly
+	-eu $(pwd) test grep grep | cd sed echo | --verbose cd "$1" printf
+	--verbose "$@" cd sed readonly "$1" && printf 2>/dev/null
+	--verbose && then /usr/bin awk cd then local x=1 'quoted text'
+cd then readonly 'quoted text' cd grep
+		-eu done done local $(pwd) -eu && done readonly x=1
+	test 'quoted text' printf cd 'quoted text' done -eu local export
+	2>/dev/null cd && "$1" echo then done grep
+"$1" awk /usr/bin echo -eu sed && test cd echo export sed && -eu
+grep ${HOME} -eu cd "$@" printf "$1" /usr/bin grep cd readonly 'quoted text'
+		local "$@" 2>/dev/null --verbose
+		then readonly | local cd awk echo
+		grep 'quoted text' echo then awk ${HOME} "$@" "$@" ${HOME} $(pwd) readonly
+local 2>/dev/null sed 'quoted text'
+"$1" test awk cd --verbose | -eu export --verbose done export /usr/bin
+		then $(pwd) test done 'quoted text' /usr/bin -eu ${HOME} | && awk
+		echo /usr/bin | -eu test && export test x=1
+	-eu sed awk -eu && then 2>/dev/null test then export local then then
+		test 'quoted text' 'quoted text'
+2>/dev/null ${HOME} /usr/bin "$1" $(pwd) then ${HOME} sed done /usr/bin
+	${HOME} done echo -eu 'quoted text' /usr/bin printf "$@" sed readonly
+2>/dev/null echo ${HOME} echo done echo
+	awk echo readonly cd 'quoted text' 2>/dev/null --verbose x=1 $(pwd)
+	cd 2>/dev/null "$@" readonly ${HOME} then local
+		export export test sed cd echo | 2>/dev/null
+		grep sed done 'quoted text' && echo /usr/bin
+	| readonly && /usr/bin grep /usr/bin export "$@" "$1" done --verbose $(pwd)
+cd -eu then | test x=1 ${HOME}
+	'quoted text' 'quoted text' ${HOME} export ${HOME}
+local readonly awk "$@" 2>/dev/null echo
+	2>/dev/null awk "$@" ${HOME} done export
+	sed done test sed cd grep awk export -eu export
+		2>/dev/null then /usr/bin
+	export "$1" 'quoted text' echo x=1 done awk local --verbose /usr/bin /usr/bin
+		'quoted text' -eu echo readonly -eu $(pwd) test 'quoted text' echo
+		$(pwd) "$1" x=1 test --verbose -eu cd awk "$@" ${HOME} --verbose local
+		grep printf awk echo "$@" --verbose 2>/dev/null
+sed | echo printf test awk then cd readonly ${HOME} cd | awk cd test /usr/bin
+"$@" x=1 awk && then readonly && 2>/dev/null
+	'quoted text' "$1" "$@" echo -eu test readonly /usr/bin sed grep
+		awk --verbose -eu then x=1 awk echo --verbose awk cd --verbose --verbose
+	&& 'quoted text' echo printf echo -eu grep /usr/bin sed echo done local 'quoted text'
+--verbose done grep grep then x=1 $(pwd) done "$@" "$1" local awk local sed then
+	local x=1 echo 2>/dev/null
+awk /usr/bin "$1" export cd grep -eu 2>/dev/null printf cd cd local echo done |
+		test $(pwd) && 'quoted text' 'quoted text' --verbose
+	printf /usr/bin sed done
+		test done "$@" local $(pwd)
+	awk "$1" 2>/dev/null "$@" sed done ${HOME} readonly
+		'quoted text' -eu && then then local
+&& | local | x=1 done readonly export
+		--verbose local awk echo then local local ${HOME}
+	done -eu ${HOME} local echo 'quoted text' then
+x=1 echo "$@" awk awk "$1" | 'quoted text'
+	sed readonly | printf printf --verbose 'quoted text' "$1" cd 'quoted text'
+		local local 2>/dev/null
+		${HOME} readonly cd /usr/bin awk
+		--verbose printf 'quoted text' /usr/bin && -eu $(pwd) | && 'quoted text'
+"$@" ${HOME} 'quoted text' readonly | "$@" -eu sed grep then "$1" awk cd
+	cd local --verbose /usr/bin "$@" done | 2>/dev/null x=1 sed readonly "$@"
+/usr/bin 'quoted text' export --verbose done | cd "$1" printf $(pwd) echo export
+	"$1" export ${HOME} 'quoted text' awk
+		export awk test 'quoted text'
+		$(pwd) local test $(pwd) awk local x=1 grep /usr/bin
+		local sed sed "$@" 'quoted text' "$@" --verbose x=1
+echo test $(pwd) echo /usr/bin local
+	done test x=1 "$1" then local 'quoted text' -eu
+		/usr/bin --verbose readonly | cd
+		"$1" $(pwd) awk "$@" export echo sed 'quoted text' ${HOME} echo --verbose
+	sed sed echo echo sed | done test local
+	sed "$1" | --verbose ${HOME} && then | echo --verbose cd /usr/bin
+cd echo cd | local 2>/dev/null
+	then | -eu printf export grep --verbose && && echo awk test /usr/bin
+test sed cd export --verbose ${HOME} local cd 2>/dev/null then "$@"
+export 2>/dev/null ${HOME} cd /usr/bin export "$@" $(pwd)
+$(pwd) export then printf
+	${HOME} 2>/dev/null grep 'quoted text'
+	test echo && 2>/dev/null grep export && ${HOME} "$@" x=1 /usr/bin
+	echo echo echo echo /usr/bin ${HOME} awk
+	done cd 'quoted text' sed x=1 ${HOME} "$1" printf local "$1" printf local
+grep grep 2>/dev/null then ${HOME} readonly 2>/dev/null export
+printf "$1" then cd 'quoted text'
+		test /usr/bin 2>/dev/null /usr/bin cd awk grep
+&& then | "$1" done sed ${HOME} sed sed ${HOME} local
+		x=1 printf /usr/bin export x=1 2>/dev/null test readonly then /usr/bin
+	'quoted text' ${HOME} "$@" grep printf sed /usr/bin 'quoted text'
+| sed grep printf sed done test
+		echo export | echo readonly
+	readonly 2>/dev/null awk | /usr/bin ${HOME} && $(pwd)
+-eu export --verbose && grep "$@" $(pwd)
+"$1" "$1" 2>/dev/null -eu awk grep
+		printf 'quoted text' echo "$1" $(pwd)
+		awk cd | cd local export printf awk /usr/bin
+then grep ${HOME} test readonly done cd then grep
+$(pwd) then "$1" then done test x=1 --verbose
+	export grep test then -eu readonly readonly
+	cd grep done "$@" local printf 'quoted text' test local awk awk
+	test grep /usr/bin ${HOME} $(pwd)
+		awk export ${HOME} readonly readonly | export --verbose x=1 &&
+awk done ${HOME} x=1 /usr/bin
+	test local "$1" test then done
+	done export readonly sed
+'quoted text' done echo local printf "$@"
+		x=1 done --verbose echo 'quoted text'
+readonly 2>/dev/null awk -eu | && done then --verbose
+&& awk export && then --verbose
+	${HOME} export cd awk readonly echo export $(pwd)
+/usr/bin sed "$@" ${HOME} 2>/dev/null printf cd /usr/bin /usr/bin $(pwd) | sed
+sed ${HOME} -eu sed cd printf grep -eu -eu awk cd /usr/bin /usr/bin $(pwd)
+	--verbose done done printf $(pwd) grep sed
+printf then local then cd
+printf $(pwd) cd && | local 'quoted text'
+	"$@" ${HOME} readonly "$@" ${HOME} --verbose test awk awk
+	--verbose --verbose grep sed test /usr/bin && 2>/dev/null "$1" readonly
+	2>/dev/null "$1" done
+	x=1 cd && -eu $(pwd) "$@" echo grep "$@" ${HOME} test grep
+		'quoted text' x=1 "$1" x=1 then then test
+	2>/dev/null "$@" echo awk -eu 'quoted text' "$1" $(pwd) x=1
+| local printf --verbose /usr/bin local $(pwd) test
+	&& 'quoted text' ${HOME} | "$1" ${HOME} 2>/dev/null awk
+		echo then grep --verbose --verbose grep $(pwd) "$1" printf done printf sed
+		&& -eu x=1 echo $(pwd) readonly $(pwd) $(pwd) 2>/dev/null
+awk x=1 then ${HOME} $(pwd) test "$@" local
+		export printf "$1" 'quoted text' cd ${HOME}
+cd "$1" x=1 export | local export
+	"$@" | then 'quoted text' "$@" "$@" done done | "$1" then
+		cd 2>/dev/null then --verbose && /usr/bin && 2>/dev/null cd test
+	echo | && -eu "$@" printf ${HOME} local done
+		printf grep done "$@" -eu x=1
+&& ${HOME} grep $(pwd) | 2>/dev/null cd done ${HOME} test /usr/bin awk /usr/bin
+then printf 2>/dev/null "$1" -eu && printf x=1 test
+		$(pwd) then grep -eu | awk test
+	grep local | -eu export $(pwd) $(pwd) "$@" awk cd test 2>/dev/null $(pwd) $(pwd)
+		x=1 $(pwd) && 2>/dev/null echo
+		--verbose printf -eu ${HOME}
+	readonly readonly $(pwd) grep /usr/bin "$@" printf "$1"
+test export | printf done && sed test "$1" && --verbose
+	cd printf test done && readonly
+	'quoted text' 2>/dev/null echo awk test then local awk local grep "$@"
+${HOME} && 'quoted text' sed x=1
+		x=1 export | 2>/dev/null cd -eu readonly cd echo 2>/dev/null "$@" test
+| 'quoted text' x=1 /usr/bin 'quoted text' --verbose
+sed echo test 'quoted text'
+		&& | printf | && ${HOME} test | test ${HOME} export | sed 'quoted text'
+	echo readonly readonly
+	export printf printf then x=1 --verbose export "$1" printf
+echo --verbose | -eu -eu "$1" sed "$1" grep local ${HOME} "$@" test done
+		local "$1" echo ${HOME} "$@" "$1" export
+		done 'quoted text' echo test x=1 $(pwd) done 'quoted text'
+		--verbose grep --verbose readonly grep -eu "$1" x=1 local test
+		-eu awk && readonly /usr/bin x=1 "$@" awk x=1 sed awk ${HOME} done local x=1 $(pwd)
+"$@" -eu 'quoted text' printf $(pwd) done
+	2>/dev/null echo "$1" echo then
+	--verbose /usr/bin sed awk sed --verbose cd $(pwd) |
+readonly -eu -eu /usr/bin local ${HOME} $(pwd) --verbose
+done | && test awk test 2>/dev/null cd readonly | && done x=1 cd &&
+		'quoted text' cd export printf && | done && && 2>/dev/null 2>/dev/null
+-eu cd | -eu -eu cd && cd readonly "$@" printf && test "$1" -eu done &&
+	done "$@" | grep | "$1" && ${HOME} grep done readonly
+		"$1" 'quoted text' export -eu awk test echo then awk --verbose
+	done $(pwd) echo export /usr/bin done readonly "$1" 2>/dev/null $(pwd) ${HOME}
+		readonly readonly | /usr/bin done sed done $(pwd)
+	printf readonly --verbose --verbose --verbose printf /usr/bin echo awk
+	awk export printf local
+&& sed "$1" --verbose local
+x=1 /usr/bin && printf echo 'quoted text' echo grep x=1 | readonly
+		test ${HOME} cd sed -eu $(pwd)
+	x=1 local test grep cd grep test done 2>/dev/null sed $(pwd) awk -eu ${HOME} sed
+grep --verbose readonly 2>/dev/null local grep
+		-eu grep sed then sed 2>/dev/null ${HOME} echo
+readonly --verbose then 2>/dev/null
+		local --verbose echo --verbose /usr/bin ${HOME} x=1 "$1" test x=1 |
+/usr/bin $(pwd) test 2>/dev/null 2>/dev/null export $(pwd) "$@" test export
+	2>/dev/null test sed x=1 x=1 grep awk cd printf /usr/bin 2>/dev/null
+	echo && x=1 sed export | readonly test printf
+	$(pwd) 'quoted text' test then local readonly
+		--verbose /usr/bin local then "$@" -eu sed --verbose $(pwd) readonly local --verbose
+	-eu && && ${HOME} --verbose readonly export readonly 2>/dev/null "$@" ${HOME} /usr/bin
+	| --verbose --verbose
+then ${HOME} then then done && x=1 grep /usr/bin
+		2>/dev/null readonly -eu && --verbose export local | -eu --verbose
+	export /usr/bin awk /usr/bin
+| ${HOME} grep then awk $(pwd) local 2>/dev/null test awk | export local
+	readonly printf grep $(pwd) --verbose
+$(pwd) grep "$1" "$@" echo readonly test "$@" 'quoted text'
+$(pwd) export done --verbose then && sed test printf done x=1
+x=1 export grep done sed x=1 ${HOME} done "$1" | grep export
+	| echo grep local sed -eu ${HOME} -eu "$@" local test $(pwd) -eu then x=1
+test grep awk sed 2>/dev/null 'quoted text'
+	2>/dev/null readonly -eu sed then 'quoted text' 'quoted text'
+"$1" $(pwd) done ${HOME} --verbose "$1" "$1" sed local cd echo "$1" test "$1"
+"$1" -eu cd test echo echo local | ${HOME} | done 2>/dev/null
+done cd export 2>/dev/null && cd
+		sed "$1" printf | readonly cd
+	${HOME} 'quoted text' readonly
+	awk "$@" /usr/bin cd then "$@" then "$1" --verbose echo echo
+	-eu --verbose | cd echo x=1 | /usr/bin && grep sed echo done
+2>/dev/null && --verbose export test then local cd 2>/dev/null
+	printf test cd readonly export -eu "$1"
+	cd then test ${HOME} readonly "$@" grep done then ${HOME}
+		awk "$1" 'quoted text' $(pwd) && printf cd /usr/bin export --verbose
+echo then printf test ${HOME} then /usr/bin awk awk awk | echo /usr/bin
+sed /usr/bin test readonly && x=1 && sed 'quoted text' | x=1 printf grep
+	echo sed test cd done -eu /usr/bin x=1 "$@" then x=1 export awk 'quoted text'
+	printf echo readonly test awk done
+		x=1 readonly test | sed cd "$@" grep /usr/bin readonly "$@" "$1"
+		x=1 then then done grep 'quoted text' printf
+		test -eu "$@" readonly sed done printf readonly echo "$@" /usr/bin 'quoted text'
+		'quoted text' 'quoted text' x=1 x=1 done readonly /usr/bin then export
+		readonly grep && echo ${HOME}
+	/usr/bin 2>/dev/null printf done sed echo ${HOME} grep export x=1 local
+awk printf grep readonly readonly $(pwd)
+-eu | done cd | test grep "$@" x=1
+		/usr/bin x=1 2>/dev/null grep /usr/bin 2>/dev/null
+grep && test readonly sed ${HOME} export
+	cd export 2>/dev/null --verbose
+	echo readonly done test then printf echo echo "$1"
+	x=1 2>/dev/null x=1 grep x=1 $(pwd) local 'quoted text'
+		"$@" --verbose && 2>/dev/null
+"$@" cd sed /usr/bin 2>/dev/null --verbose printf test --verbose
+	readonly "$@" sed test 2>/dev/null "$@"
+	cd then 'quoted text' printf test && /usr/bin
+	"$1" cd && echo /usr/bin export echo && --verbose ${HOME} sed
+		"$1" --verbose -eu 2>/dev/null
+		-eu 'quoted text' -eu x=1 --verbose sed echo echo
+		'quoted text' 'quoted text' echo grep cd awk done local ${HOME} export 2>/dev/null
+		test then "$1" /usr/bin sed then awk grep printf done -eu test echo echo awk 'quoted text'
+echo echo grep local 2>/dev/null
+		grep /usr/bin -eu /usr/bin echo local readonly
+	test cd sed echo readonly grep export sed x=1 "$1" printf
+	cd echo echo cd sed "$@" /usr/bin grep printf
+	--verbose 2>/dev/null local /usr/bin export --verbose &&
+		"$1" 2>/dev/null --verbose
+		done "$@" grep 2>/dev/null --verbose export awk awk
+	echo printf && readonly 'quoted text' done
+-eu ${HOME} printf test sed readonly 'quoted text' then -eu $(pwd) echo
+readonly /usr/bin /usr/bin
+		-eu cd grep sed 'quoted text'
+		$(pwd) sed done "$@" | ${HOME}
+&& 2>/dev/null -eu export
+x=1 'quoted text' 'quoted text' export echo && cd /usr/bin printf readonly
+	-eu local done echo "$1" /usr/bin x=1
+	${HOME} echo local 2>/dev/null /usr/bin
+		test printf "$@" local readonly
+		$(pwd) test local 'quoted text' echo cd test "$@" "$@"
+		$(pwd) cd -eu $(pwd) grep && 'quoted text' 'quoted text' x=1 readonly
+	-eu sed grep awk sed printf 2>/dev/null
+	"$@" "$1" && "$1" printf echo readonly export 2>/dev/null
+printf then cd ${HOME} 2>/dev/null --verbose awk cd 'quoted text'
+		cd && -eu --verbose readonly
+test && && printf 'quoted text'
+		awk grep test sed then done 2>/dev/null -eu 2>/dev/null
+	done -eu sed local 'quoted text'
+"$@" readonly printf echo awk $(pwd) test cd && -eu test /usr/bin
+		grep --verbose readonly 2>/dev/null
+		x=1 readonly test echo x=1
+cd grep export 'quoted text'
+x=1 echo printf printf 2>/dev/null
+$(pwd) x=1 readonly 'quoted text' cd --verbose
+sed /usr/bin sed test then printf cd
+		test ${HOME} "$@" echo --verbose export
+| 2>/dev/null done 2>/dev/null 2>/dev/null
+readonly export then ${HOME}
+| | sed done readonly printf export
+	test 'quoted text' ${HOME} echo cd export $(pwd) export cd test printf awk -eu
+	| printf then awk ${HOME} "$@" "$@" done local grep $(pwd)
+	export --verbose "$@"
+		awk /usr/bin $(pwd) local readonly 'quoted text' cd sed x=1 awk --verbose
+done awk /usr/bin awk done $(pwd) readonly printf local -eu "$1" -eu 'quoted text'
+	printf cd "$1" 2>/dev/null sed
+		printf 'quoted text' local sed local 'quoted text'
+		2>/dev/null && test | --verbose
+test echo x=1 'quoted text' ${HOME} -eu 'quoted text' $(pwd) then done
+		local "$@" then 'quoted text' echo echo "$@" done $(pwd) echo then ${HOME}
+	readonly local && | x=1 then grep "$1" export echo x=1 local cd export x=1 &&
+		'quoted text' test grep "$@" "$1" && && ${HOME}
+grep cd echo /usr/bin then
+		local local ${HOME} sed | ${HOME} 'quoted text' 'quoted text' local && echo
+	test awk $(pwd) $(pwd) export -eu && /usr/bin
+&& then test $(pwd) 'quoted text' done
+then done readonly && /usr/bin "$@" local cd
+	echo readonly cd sed --verbose -eu "$1" "$1" "$1" && "$1" --verbose export --verbose
+-eu "$@" 2>/dev/null export local ${HOME} awk cd printf -eu test -eu test
+	done -eu grep /usr/bin sed printf readonly x=1 local done
+		then --verbose | "$1" local sed done echo cd ${HOME} "$1" readonly
+sed "$@" $(pwd) test $(pwd) test sed done
+${HOME} "$@" export -eu --verbose /usr/bin printf
+	"$@" x=1 readonly 2>/dev/null
+then ${HOME} x=1 "$@" --verbose printf sed cd printf echo awk grep
+	readonly echo | local printf printf /usr/bin
+	'quoted text' $(pwd) printf readonly
+	export x=1 done $(pwd) done test 'quoted text' local "$@" test --verbose local
+		"$@" 'quoted text' printf local x=1 sed
+	'quoted text' /usr/bin cd echo awk
+		printf export test then cd
+	--verbose sed cd test then
+		"$@" echo /usr/bin --verbose then 2>/dev/null printf
+echo printf printf 'quoted text'
+	&& awk printf /usr/bin "$1" /usr/bin
+-eu echo local then awk -eu readonly 'quoted text' | "$@" "$@" export
+	grep /usr/bin export done printf export $(pwd) 2>/dev/null ${HOME} printf cd
+	done /usr/bin readonly local done test 2>/dev/null
+		then ${HOME} "$@" | -eu --verbose
+| done x=1 $(pwd) printf done -eu ${HOME} --verbose printf grep && then local
+		/usr/bin 2>/dev/null grep readonly 2>/dev/null 'quoted text' test "$1" done
+	then 'quoted text' sed $(pwd) done x=1 cd
+export $(pwd) echo --verbose test export -eu -eu x=1 --verbose "$1" -eu cd 'quoted text'
+	/usr/bin readonly grep ${HOME} ${HOME} echo
+	${HOME} && ${HOME} then x=1 "$@" $(pwd)
+	2>/dev/null readonly awk awk grep cd
+awk echo local | 'quoted text' &&
+	then readonly -eu x=1 2>/dev/null ${HOME} x=1
+	test "$1" then cd --verbose export awk /usr/bin
+		printf grep "$1" ${HOME} 2>/dev/null
+	"$@" | done test printf | "$@" cd grep 'quoted text'
+	'quoted text' done cd then then test awk -eu test cd |
+&& test test readonly "$@" echo echo ${HOME} "$@" --verbose | test printf awk
+		test -eu ${HOME} $(pwd) readonly done -eu then --verbose
+		sed test x=1 echo | awk && printf cd printf readonly done --verbose
+grep && done $(pwd) x=1 echo
+		cd then cd /usr/bin then echo export x=1
+sed local /usr/bin ${HOME} --verbose | "$@"
+	then sed readonly 2>/dev/null printf $(pwd)
+		grep then local grep grep then export readonly local local local
+	sed echo --verbose --verbose readonly ${HOME} sed export export grep ${HOME}
+		'quoted text' cd /usr/bin x=1 | 'quoted text'
+local export then /usr/bin x=1 cd test $(pwd) "$@" sed ${HOME} local $(pwd) export
+		"$1" printf "$1" -eu "$@" printf /usr/bin export grep test grep test export
+"$1" printf test 2>/dev/null x=1 --verbose 2>/dev/null
+		&& x=1 --verbose ${HOME} grep --verbose printf grep echo cd 2>/dev/null sed
+	&& /usr/bin test 'quoted text' readonly $(pwd) "$@" |
+cd sed echo done 2>/dev/null "$1" "$1" echo && ${HOME} -eu printf done "$@" test
+${HOME} $(pwd) cd export test echo then ${HOME} local && -eu cd export cd "$1"
+		| readonly $(pwd) --verbose /usr/bin ${HOME}
+-eu 'quoted text' local /usr/bin local | && ${HOME}
+		$(pwd) export $(pwd) cd export sed sed "$@" cd --verbose --verbose awk "$@" --verbose
+'quoted text' -eu sed x=1 cd && "$1"
+2>/dev/null | "$1" ${HOME} export $(pwd) done 'quoted text'
+	&& "$@" -eu then readonly readonly done then /usr/bin export
+		readonly test cd export grep awk /usr/bin $(pwd) 'quoted text' $(pwd)
+		done sed cd /usr/bin x=1 "$@" sed grep ${HOME}
+x=1 sed echo cd /usr/bin "$@" 2>/dev/null "$@" then then test local "$@"
+	2>/dev/null awk 2>/dev/null export
+		--verbose sed awk -eu export
+	grep echo /usr/bin ${HOME} /usr/bin x=1 "$@" then | sed 'quoted text' $(pwd)
+x=1 cd cd ${HOME} "$@" ${HOME} $(pwd)
+"$1" 2>/dev/null done "$@" readonly echo sed readonly
+		--verbose done printf awk test | awk then
+-eu local local then done grep "$@" sed readonly readonly echo
+readonly ${HOME} "$@" test awk local $(pwd) test test grep export
+		-eu "$@" test done 'quoted text' cd then -eu readonly && x=1
+sed $(pwd) then $(pwd) printf 2>/dev/null export
+local 2>/dev/null && grep $(pwd) x=1 "$@"
+	&& | $(pwd) ${HOME} test --verbose done grep export
+		2>/dev/null | "$@" echo then echo "$@" && "$@" awk $(pwd)
+	printf readonly ${HOME} 2>/dev/null printf --verbose -eu "$@" echo echo
+$(pwd) local /usr/bin && cd sed export test then
+	local readonly grep 'quoted text' | x=1 test x=1 x=1 readonly
+	${HOME} done sed cd x=1 "$@" local then cd test /usr/bin | grep "$1" printf sed
+		&& ${HOME} | grep echo readonly | echo --verbose | ${HOME} "$@" then
+		-eu $(pwd) done "$@" then
+	awk awk | printf /usr/bin cd awk export echo echo readonly test $(pwd)
+'quoted text' then grep "$1" "$1" readonly 2>/dev/null echo done cd export 2>/dev/null
+		/usr/bin local && printf 'quoted text' && ${HOME} -eu export | x=1 "$@" "$@"
+		readonly && 'quoted text' && $(pwd)
+	/usr/bin 2>/dev/null done printf awk cd /usr/bin export ${HOME} then $(pwd)
+		sed 'quoted text' export done && echo 'quoted text' 'quoted text' test
+	printf "$@" awk "$@" test --verbose
+	$(pwd) "$1" done "$@" /usr/bin && cd --verbose 'quoted text'
+'quoted text' sed readonly
+		$(pwd) echo local local cd 'quoted text' local | local sed cd "$1"
+	grep local printf x=1 printf -eu
+--verbose test export then -eu ${HOME} /usr/bin sed test && then export 2>/dev/null
+	-eu && readonly test grep echo
+	2>/dev/null readonly | printf
+	| 2>/dev/null local && && /usr/bin /usr/bin grep echo ${HOME} 2>/dev/null awk
+	then $(pwd) awk test --verbose echo ${HOME} "$@" grep done 'quoted text' grep
+	readonly "$1" cd /usr/bin /usr/bin grep
+		grep -eu done -eu sed cd | cd /usr/bin local echo grep x=1 $(pwd)
+		awk grep printf printf /usr/bin "$1"
+	x=1 grep x=1 $(pwd) 2>/dev/null
+	test grep cd local sed /usr/bin
+local "$1" /usr/bin 'quoted text' --verbose awk "$@" export
+readonly 2>/dev/null sed x=1 | -eu $(pwd) | 2>/dev/null ${HOME} "$@" 'quoted text'
+	readonly "$1" 2>/dev/null then && "$@" awk --verbose
+	x=1 sed 2>/dev/null readonly cd "$1"
+		cd grep printf /usr/bin /usr/bin "$1" -eu cd && "$@" /usr/bin
+printf test awk then | printf readonly
+&& /usr/bin test | printf && awk |
+		-eu readonly local export ${HOME} && sed done local grep
+	"$1" cd && 'quoted text' ${HOME} printf export -eu
+		sed grep x=1 ${HOME} echo -eu /usr/bin done printf "$1" $(pwd) /usr/bin
+	sed ${HOME} local && "$1" grep done
+		local grep 2>/dev/null "$@" -eu && ${HOME}
+		-eu printf awk grep test echo -eu -eu printf
+	&& then && readonly done "$@" then
+		printf readonly ${HOME} local -eu
+printf grep done export 'quoted text' cd
+readonly readonly awk awk echo --verbose "$@" echo -eu export sed /usr/bin
+| done done readonly -eu grep local
+-eu && --verbose awk ${HOME} printf
+	local readonly export $(pwd) /usr/bin x=1 2>/dev/null
+"$@" printf echo sed x=1 readonly 2>/dev/null && printf &&
+		"$1" "$@" 2>/dev/null $(pwd)
+		"$1" ${HOME} test && export local echo | test 'quoted text' --verbose
+	then echo x=1 export x=1 "$@" ${HOME} 'quoted text' && | 2>/dev/null printf
+	$(pwd) $(pwd) $(pwd) -eu echo
+export sed grep done grep --verbose --verbose x=1 echo readonly x=1 --verbose
+--verbose awk 2>/dev/null "$1" x=1 awk | "$@" printf done cd &&
+awk && export awk then 'quoted text' 'quoted text' test awk -eu
+grep x=1 --verbose cd
+		awk $(pwd) 'quoted text' awk readonly ${HOME} 'quoted text'
+	"$1" done -eu /usr/bin x=1 | $(pwd)
+sed 'quoted text' cd then "$@" readonly awk sed local 'quoted text' test
+2>/dev/null 2>/dev/null sed cd | /usr/bin grep ${HOME} 2>/dev/null
+test grep awk export grep
+		2>/dev/null readonly sed --verbose "$@" then then
+then readonly cd ${HOME} /usr/bin "$@" "$@" test ${HOME} then
+$(pwd) echo done --verbose echo grep
+		-eu awk && grep x=1 then grep
+	awk ${HOME} export cd local done echo then --verbose
+		/usr/bin /usr/bin test | "$1"
+		-eu /usr/bin local cd test 'quoted text'
+	awk printf echo local then then "$@" test && -eu
+readonly grep grep -eu "$@" then test export
+		export "$@" then test -eu readonly 2>/dev/null readonly
+	| then readonly | echo "$1" 'quoted text' "$1"
+	"$@" --verbose "$@" then export
+--verbose then then && readonly /usr/bin export local "$@"
+		test "$1" cd printf "$1" sed -eu grep export local
+	"$1" awk echo && done "$1" readonly awk ${HOME} test test 'quoted text'
+	x=1 'quoted text' printf done grep local "$1" --verbose awk --verbose printf 2>/dev/null
+	then export awk local /usr/bin $(pwd) --verbose
+		${HOME} test awk x=1 echo then $(pwd)
+	done export 2>/dev/null $(pwd)
+		${HOME} | 2>/dev/null /usr/bin echo && && "$1" printf
+		-eu | /usr/bin awk 2>/dev/null "$@" grep then
+		"$@" 2>/dev/null sed && echo
+	test && sed test sed x=1 cd /usr/bin 'quoted text' "$1" -eu | x=1
+$(pwd) then local 2>/dev/null echo awk cd sed $(pwd) done
+	'quoted text' "$@" test | echo cd ${HOME}
+		"$1" x=1 ${HOME} grep 2>/dev/null readonly test readonly
+		export then 2>/dev/null export then grep
+/usr/bin $(pwd) "$@" test --verbose /usr/bin
+	&& "$1" && sed -eu readonly /usr/bin export $(pwd) echo echo
+	"$@" echo cd --verbose done sed | 2>/dev/null x=1 echo -eu printf awk ${HOME}
+		export readonly export test export 2>/dev/null -eu
+	done -eu test then x=1 | && awk
+		awk | && 2>/dev/null && /usr/bin 2>/dev/null
+		${HOME} sed ${HOME} -eu local ${HOME} | | /usr/bin printf awk cd x=1 /usr/bin
+	x=1 --verbose cd printf export 'quoted text' "$1" ${HOME}
+	readonly local --verbose cd --verbose -eu && "$1" "$@" && $(pwd) printf && echo
+test ${HOME} /usr/bin cd "$1" test $(pwd)
+| readonly 'quoted text' $(pwd)
+	printf test awk awk local grep ${HOME} 2>/dev/null ${HOME}
+		grep "$1" -eu test then readonly done test | then sed 'quoted text'
+		-eu awk 'quoted text' cd echo && -eu
+		cd readonly export x=1
+	x=1 'quoted text' 2>/dev/null | /usr/bin awk awk readonly
+export --verbose sed sed $(pwd) 'quoted text' awk awk echo awk 2>/dev/null
+--verbose done done | grep
+		--verbose ${HOME} awk
+		echo printf && -eu local $(pwd) /usr/bin /usr/bin
+2>/dev/null 2>/dev/null sed 'quoted text' $(pwd) "$@" export ${HOME} printf
+		echo sed "$@" local then test echo printf && grep readonly $(pwd) | test export
+	sed cd x=1 'quoted text' | sed -eu ${HOME} 'quoted text'
+	done x=1 printf cd 2>/dev/null x=1 local test sed -eu awk printf local
+&& "$@" done done test export export $(pwd)
+--verbose test && printf 2>/dev/null 'quoted text' && "$1" -eu x=1
+	&& --verbose test /usr/bin
+	--verbose cd awk --verbose
+-eu && test awk "$1" 'quoted text' --verbose
+"$@" printf x=1 done && x=1 local awk echo --verbose $(pwd) 2>/dev/null
+x=1 cd "$1" cd done -eu x=1 "$@" | test then ${HOME} /usr/bin
+		then /usr/bin then "$@" 'quoted text' printf
+		| -eu printf && awk x=1
+		| "$@" test x=1 grep x=1 ${HOME} 'quoted text'
+grep sed cd grep "$@" echo awk /usr/bin grep
+		"$1" cd && cd awk "$1" done export grep "$1" done awk local
+	2>/dev/null && 2>/dev/null
+2>/dev/null readonly local 'quoted text' local export
+x=1 && 'quoted text' "$1" echo $(pwd)
+	"$@" cd -eu printf echo then --verbose
+"$1" export 2>/dev/null cd echo x=1 sed 'quoted text' grep x=1 -eu
+readonly then then "$1" ${HOME} awk done | $(pwd)
+	done -eu -eu | readonly ${HOME} x=1 && "$1" $(pwd) echo then then cd export
+	then sed 'quoted text' cd "$1" 2>/dev/null
+		"$@" sed readonly 2>/dev/null --verbose readonly 'quoted text' awk x=1 then
+	test $(pwd) -eu 2>/dev/null cd --verbose && cd export awk cd grep printf test 'quoted text'
+		local done 'quoted text' test -eu 2>/dev/null awk 'quoted text' $(pwd) test /usr/bin
+	sed sed --verbose then sed cd test cd &&
+		export then readonly export | 2>/dev/null $(pwd)
+		awk 2>/dev/null done /usr/bin grep sed then
+printf ${HOME} grep export $(pwd) 2>/dev/null 2>/dev/null
+	cd 'quoted text' cd printf "$1" export 2>/dev/null done /usr/bin $(pwd) &&
+-eu x=1 $(pwd) "$@" done "$@" $(pwd) | echo readonly ${HOME} 2>/dev/null
+${HOME} export test awk export x=1 awk
+		| cd ${HOME} grep test echo echo --verbose $(pwd) 'quoted text'
+	readonly "$1" readonly 'quoted text'
+	cd "$1" echo then -eu cd ${HOME}
+	then then echo && | echo awk --verbose then 2>/dev/null
+printf sed && done 2>/dev/null 2>/dev/null --verbose awk readonly test 2>/dev/null
+/usr/bin readonly sed test
+	/usr/bin echo readonly -eu sed grep -eu | printf x=1
+local printf $(pwd) cd awk && echo && ${HOME} 2>/dev/null
+&& printf grep awk printf export && ${HOME} --verbose awk test then
+	${HOME} test awk export then printf echo test "$1" && awk
+export && then && x=1 readonly grep $(pwd) $(pwd) 2>/dev/null 2>/dev/null
+--verbose then -eu 'quoted text' && grep $(pwd)
+		grep -eu $(pwd) --verbose echo test | ${HOME} /usr/bin --verbose
+		test $(pwd) then echo x=1 | sed ${HOME} echo $(pwd) 2>/dev/null
+${HOME} x=1 --verbose 2>/dev/null
+	'quoted text' grep --verbose echo done test
+x=1 done export $(pwd) readonly readonly printf done grep 'quoted text'
+echo grep 'quoted text' x=1 readonly 2>/dev/null
+	local 'quoted text' $(pwd) local echo echo "$@" 2>/dev/null
+	&& --verbose echo ${HOME} local then done
+		2>/dev/null ${HOME} sed sed "$@" cd ${HOME} sed ${HOME} x=1 sed grep local
+then echo $(pwd) readonly "$@" "$@"
+	${HOME} --verbose 2>/dev/null | | | -eu 2>/dev/null 2>/dev/null grep
+	-eu grep --verbose -eu
+		--verbose echo readonly readonly "$1" test -eu 'quoted text' ${HOME}
+2>/dev/null sed 2>/dev/null
+	export | 2>/dev/null 2>/dev/null && then "$@" local cd "$@"
+export echo grep --verbose 2>/dev/null readonly
+	sed awk -eu ${HOME} test --verbose
+grep 2>/dev/null readonly | then readonly && printf --verbose
+-eu x=1 2>/dev/null ${HOME} echo then
+-eu then /usr/bin 2>/dev/null done then done "$1" cd done $(pwd) printf
+local readonly "$@" grep awk ${HOME} && /usr/bin "$1" && | $(pwd) sed 'quoted text'
+	"$@" "$@" $(pwd) awk done x=1 && cd /usr/bin && ${HOME} cd cd
+/usr/bin x=1 2>/dev/null readonly awk 'quoted text' ${HOME}
+	"$1" awk /usr/bin /usr/bin cd "$@" $(pwd) test "$1" grep awk
+--verbose done | readonly | readonly "$1"
+printf grep printf "$@" 'quoted text' 'quoted text'
+		-eu /usr/bin local local 'quoted text' readonly done
+done grep grep sed 'quoted text'
+	local then readonly $(pwd) --verbose cd awk sed echo test
+		${HOME} then local 'quoted text' test then awk export "$1"
+	2>/dev/null x=1 then printf $(pwd) echo $(pwd) 2>/dev/null
+	done echo then readonly local "$1" && awk && done "$@" sed x=1
+"$1" cd readonly sed cd && awk ${HOME} --verbose awk then | export awk
+		echo "$@" -eu echo echo x=1 readonly | $(pwd) ${HOME} local 2>/dev/null
+		2>/dev/null $(pwd) "$1" printf printf ${HOME} | awk 'quoted text' ${HOME}
+sed 'quoted text' && $(pwd) sed
+		&& && done 2>/dev/null $(pwd) local
+		-eu readonly grep /usr/bin "$@"
+&& readonly local -eu local ${HOME}
+	test "$@" && && then sed "$1" awk /usr/bin export test
+$(pwd) 'quoted text' done echo printf sed
+$(pwd) x=1 test 2>/dev/null cd -eu ${HOME} test done done awk /usr/bin
+		cd grep 2>/dev/null "$1" cd 'quoted text' awk sed sed echo
+printf && "$@" grep /usr/bin --verbose
+	--verbose --verbose 2>/dev/null -eu readonly export then
+	&& 'quoted text' cd "$1" 2>/dev/null 'quoted text' printf readonly && readonly &&
+then -eu "$1" $(pwd) done awk sed readonly awk export cd echo
+grep --verbose | | readonly echo $(pwd) cd -eu "$1" "$1" ${HOME}
+| "$@" sed "$1" 'quoted text' | "$1" $(pwd) awk awk "$1" printf $(pwd) ${HOME}
+	/usr/bin 2>/dev/null -eu echo 2>/dev/null local then done cd
+		'quoted text' then "$@"
+	| readonly readonly printf done x=1 readonly awk readonly -eu awk 2>/dev/null
+	then cd "$1" grep echo test
+export printf echo "$@" "$@" printf readonly echo sed cd 2>/dev/null
+		2>/dev/null "$@" then grep sed 'quoted text' done local export sed local test x=1
+	${HOME} && "$@" grep test cd | -eu -eu | echo readonly export test 2>/dev/null
+printf awk then /usr/bin --verbose -eu $(pwd) printf echo
+'quoted text' | "$@" printf $(pwd) test -eu sed "$@" local sed export
+	&& x=1 /usr/bin then 2>/dev/null -eu "$1" grep --verbose --verbose
+		then 2>/dev/null 2>/dev/null --verbose --verbose
+		"$@" grep done then x=1 cd /usr/bin x=1 "$@" test x=1 sed --verbose
+echo | export then cd test cd cd ${HOME}
+		echo grep 2>/dev/null "$@" "$@"
+		&& readonly ${HOME} | "$1" export cd done grep test done test x=1 /usr/bin
+${HOME} 2>/dev/null local printf sed cd local
+		"$1" cd "$1" --verbose export x=1 sed cd then $(pwd) --verbose x=1 'quoted text'
+	| done -eu done then "$@" export "$1" "$@" local "$@"
+	$(pwd) "$@" export local
+${HOME} "$1" --verbose cd cd $(pwd) 2>/dev/null
+		done /usr/bin grep done | grep echo $(pwd)
+	${HOME} ${HOME} x=1 sed
+export printf export then done export
+local local then echo --verbose cd test -eu awk ${HOME} then -eu "$@"
+test sed then && $(pwd) local local 'quoted text' cd
+test echo --verbose | readonly ${HOME} test test printf
+local printf 'quoted text' then readonly
+2>/dev/null $(pwd) readonly /usr/bin grep 2>/dev/null "$1" cd /usr/bin
+		printf -eu local local done cd sed
+		${HOME} sed | && awk "$1" | local grep "$@" -eu then cd export local "$@" 'quoted text'
+sed "$@" local "$1" printf x=1 echo
+test local "$1" /usr/bin export --verbose $(pwd) echo 'quoted text' awk $(pwd)
+	--verbose done 2>/dev/null sed 'quoted text' done local "$1" ${HOME} "$@" "$1"
+/usr/bin awk && sed then && export local $(pwd) done | "$@" /usr/bin
+	&& /usr/bin echo x=1 awk awk done
+done | local "$@" cd x=1 grep /usr/bin "$1" 2>/dev/null
+printf 2>/dev/null "$@" "$1" && done
+	sed ${HOME} sed readonly /usr/bin 'quoted text' --verbose x=1 printf test
+	| grep 'quoted text' $(pwd) echo --verbose
+test readonly test ${HOME} -eu sed echo && "$1" awk $(pwd)
+'quoted text' -eu export x=1 'quoted text'
+		/usr/bin export then awk test then echo "$1" -eu awk
+$(pwd) done grep x=1 'quoted text' echo done /usr/bin done
+${HOME} printf ${HOME} $(pwd) --verbose | && printf printf
+		then 'quoted text' sed 'quoted text' "$@" ${HOME} awk -eu $(pwd)
+	&& grep then x=1 $(pwd) x=1
+		grep grep 2>/dev/null 'quoted text' grep readonly
+		'quoted text' 'quoted text' 2>/dev/null -eu awk "$1"
+"$@" -eu 2>/dev/null /usr/bin awk 'quoted text' x=1 local export awk
+	awk then -eu && local x=1
+		export awk grep grep $(pwd) done x=1 "$1" grep printf && 'quoted text' printf then
+	| "$1" sed $(pwd) $(pwd) then --verbose -eu "$1"
+	$(pwd) | "$@" cd printf /usr/bin echo awk /usr/bin -eu $(pwd)
+then then "$1" "$@" local readonly -eu sed 'quoted text'
+cd --verbose $(pwd) local /usr/bin
+/usr/bin sed readonly 2>/dev/null --verbose
+2>/dev/null export echo
+		/usr/bin /usr/bin --verbose
+sed printf readonly local readonly -eu ${HOME} /usr/bin sed cd awk printf && &&
+	2>/dev/null printf readonly --verbose
+export $(pwd) sed /usr/bin -eu sed done 2>/dev/null local $(pwd)
+$(pwd) 'quoted text' $(pwd) -eu
+		sed export readonly cd x=1 2>/dev/null local "$@"
+		$(pwd) "$@" 2>/dev/null then export x=1
+	local cd readonly && ${HOME} sed /usr/bin then $(pwd)
+		done 2>/dev/null /usr/bin | $(pwd) ${HOME} "$1" awk local 'quoted text'
+		"$1" -eu export --verbose | && "$@" 'quoted text' 2>/dev/null
+	${HOME} awk $(pwd) ${HOME} ${HOME}
+	"$@" readonly printf -eu 'quoted text' grep sed readonly
+		test awk --verbose x=1 /usr/bin
+then awk sed echo export "$1" --verbose --verbose
+-eu /usr/bin cd cd export --verbose awk awk
+		"$1" printf then local "$@" printf && awk "$1"
+		cd awk readonly grep -eu /usr/bin --verbose /usr/bin
+	2>/dev/null ${HOME} printf test /usr/bin then ${HOME} "$1" then -eu $(pwd)
+	-eu grep /usr/bin "$@" x=1 $(pwd) sed local grep done sed printf --verbose "$1"
+readonly local -eu x=1 && x=1 $(pwd) echo sed local | ${HOME} echo sed echo 2>/dev/null
+echo awk -eu readonly awk sed /usr/bin export readonly
+-eu echo local -eu readonly awk | /usr/bin local printf sed "$1" x=1
+grep && export "$@" "$1" export readonly grep awk
+	x=1 $(pwd) readonly 'quoted text'
+&& 'quoted text' readonly $(pwd) grep 'quoted text' 2>/dev/null x=1 done "$1"
+--verbose cd 'quoted text' local
+"$1" grep cd --verbose grep "$1" 'quoted text' export
+then test then awk && -eu printf 'quoted text' printf x=1
+cd 2>/dev/null local export then sed cd readonly
+		done 2>/dev/null sed 2>/dev/null "$@" "$@" export
+	export done readonly done grep
+		"$1" --verbose --verbose done done /usr/bin printf --verbose
+		grep 'quoted text' | local 'quoted text' /usr/bin
+		printf local echo && ${HOME} 'quoted text'
+	export "$1" && test x=1
+		then echo 'quoted text' 'quoted text' readonly $(pwd) done
+"$1" sed then grep awk readonly export
+readonly readonly | ${HOME} test local -eu cd test "$@" printf 2>/dev/null export
+2>/dev/null /usr/bin export --verbose
+test sed printf x=1 /usr/bin readonly export x=1 sed |
+&& echo /usr/bin printf
+2>/dev/null echo then | done export awk && "$1" awk $(pwd) && $(pwd) readonly
+	"$@" cd ${HOME} export 2>/dev/null test ${HOME} cd -eu test |
+	'quoted text' sed 'quoted text' readonly && -eu "$@" grep
+test x=1 x=1 $(pwd) x=1 done then --verbose grep --verbose -eu x=1 printf
+echo x=1 awk | ${HOME} && x=1 /usr/bin x=1 "$1" | printf
+		2>/dev/null cd grep | $(pwd) "$1" ${HOME} readonly
+$(pwd) /usr/bin "$1" echo -eu
+	'quoted text' 'quoted text' /usr/bin "$1" "$@"
+&& grep -eu | | export local readonly sed export echo echo x=1 2>/dev/null awk
+		echo 2>/dev/null local printf then | ${HOME}
+test awk readonly 2>/dev/null local local then then 'quoted text' $(pwd)
+'quoted text' export "$1"
+		$(pwd) 2>/dev/null && awk
+x=1 awk /usr/bin printf done x=1 "$1" done sed then 2>/dev/null echo
+	"$1" sed --verbose local echo sed | local 2>/dev/null --verbose /usr/bin x=1
+| | export 'quoted text' test x=1 done
+	local grep cd /usr/bin
+		echo ${HOME} local awk cd $(pwd) $(pwd) awk "$1"
+		printf | 2>/dev/null grep cd
+	| test "$1" test && cd "$1"
+		readonly test printf | 'quoted text' ${HOME}
+	$(pwd) sed awk && $(pwd) 'quoted text' && --verbose | local
+		${HOME} echo then --verbose cd then awk
+		"$@" "$@" 'quoted text'
+"$1" readonly 2>/dev/null 'quoted text'
+		printf echo | cd sed done readonly --verbose done
+${HOME} /usr/bin export ${HOME} sed echo echo grep awk done
+	| -eu $(pwd) done grep --verbose && $(pwd) done echo local local
+		readonly 2>/dev/null cd grep local 'quoted text' local cd ${HOME} sed cd cd |
+awk printf local cd ${HOME}
+$(pwd) "$@" $(pwd) readonly "$@" test "$1" "$@" then then cd | cd echo 2>/dev/null
+	x=1 "$1" | "$@" awk && local test printf --verbose cd
+	--verbose -eu cd awk printf local local printf "$1" done x=1 readonly -eu
+local grep readonly | printf grep test && printf ${HOME} cd
+printf /usr/bin && "$@" local test readonly 2>/dev/null
+export "$1" 2>/dev/null sed
+export grep printf local 'quoted text' ${HOME} then echo /usr/bin
+local sed "$1" | /usr/bin && 2>/dev/null x=1 sed -eu && cd readonly readonly
+	| --verbose "$1" x=1 awk | printf --verbose
+		'quoted text' x=1 | -eu printf test && ${HOME}
+then export sed echo /usr/bin x=1 test -eu sed
+-eu local --verbose export 'quoted text' test &&
+		--verbose 'quoted text' 2>/dev/null done awk $(pwd) readonly done test
+	"$1" x=1 grep -eu test 'quoted text'
+	${HOME} 'quoted text' test awk awk && grep --verbose done --verbose --verbose
+| local /usr/bin cd done
+		readonly cd readonly -eu --verbose -eu ${HOME} echo printf echo $(pwd)
+		&& local readonly awk echo echo 2>/dev/null
+	then grep echo /usr/bin
+export then $(pwd) /usr/bin grep
+		'quoted text' echo export /usr/bin awk grep printf "$1" grep local
+	then /usr/bin "$@" && done local test cd x=1 "$1"
+| x=1 /usr/bin x=1 sed cd done printf
+		then cd awk -eu export -eu then -eu
+	"$1" sed ${HOME} 2>/dev/null
+		echo printf then cd $(pwd) --verbose --verbose then
+		local && local done -eu /usr/bin printf echo printf then
+	cd x=1 'quoted text' | && $(pwd) "$1" grep grep "$@"
+done $(pwd) grep | grep export "$@"
+		sed cd then test readonly grep /usr/bin done -eu -eu 'quoted text' test | then then
+-eu grep printf x=1 done | cd awk echo "$@"
+	--verbose printf -eu "$@" done "$1" export $(pwd) -eu sed -eu readonly 2>/dev/null
+awk "$@" awk -eu readonly "$@" "$1" | export
+		grep 'quoted text' $(pwd) -eu
+	'quoted text' echo x=1 cd | export grep export echo | export done local grep &&
+		'quoted text' then export && export x=1 $(pwd)
+awk 2>/dev/null $(pwd) && 2>/dev/null
+'quoted text' && x=1 "$1" readonly export grep printf done "$@" test then
+	-eu && done ${HOME} grep "$1" done ${HOME} "$1" cd export then
+		test grep sed echo "$1"
+		"$@" readonly local awk readonly && -eu "$1" --verbose
+'quoted text' "$@" awk "$1" then
+		done test $(pwd) cd then "$@" printf -eu grep echo -eu 2>/dev/null
+	"$@" export | local | "$1" /usr/bin awk then printf
+	grep $(pwd) local $(pwd) -eu "$1" && $(pwd) -eu -eu test printf x=1 test
+'quoted text' cd 'quoted text' 'quoted text' -eu
+		cd cd 2>/dev/null test readonly sed sed grep sed echo then -eu
+export 'quoted text' grep --verbose awk | --verbose --verbose cd export x=1
+		local --verbose then 'quoted text' ${HOME} $(pwd)
+		--verbose grep "$@" cd readonly awk "$1" 'quoted text' cd && printf echo 2>/dev/null
+		echo "$@" "$1" 'quoted text' /usr/bin 'quoted text'
+		$(pwd) 'quoted text' x=1 /usr/bin -eu then | $(pwd) printf export awk cd export
+	export cd echo --verbose 2>/dev/null -eu "$1"
+	done ${HOME} printf printf done local "$1"
+		${HOME} echo -eu readonly && $(pwd) cd && --verbose -eu && then -eu 2>/dev/null
+grep && done ${HOME} done done ${HOME} done "$@" done 2>/dev/null x=1
+readonly 'quoted text' /usr/bin awk -eu $(pwd) -eu 'quoted text' 2>/dev/null then
+	-eu printf printf test printf cd "$@"
+grep | -eu printf awk printf local awk 2>/dev/null printf echo
+		'quoted text' cd && echo "$1" "$@" 2>/dev/null -eu echo
+		'quoted text' readonly grep local
+		"$1" "$@" then x=1 $(pwd) /usr/bin && x=1 export
+	printf awk grep "$1" export 'quoted text'
+	readonly printf 'quoted text' "$@" 2>/dev/null cd then awk --verbose then && /usr/bin
+echo readonly /usr/bin 2>/dev/null
+		done cd test 2>/dev/null | cd done local then export --verbose
+		x=1 grep -eu 'quoted text' 2>/dev/null grep -eu sed done $(pwd) readonly | ${HOME}
+	sed x=1 | x=1 $(pwd) /usr/bin printf --verbose printf --verbose cd export
+		/usr/bin local echo echo x=1 grep "$@" 2>/dev/null cd
+'quoted text' --verbose x=1 $(pwd) awk awk ${HOME}
+awk ${HOME} /usr/bin | then
+${HOME} cd export ${HOME} export done "$@" x=1 "$1"
+	"$@" echo sed done export ${HOME} printf then $(pwd) grep printf x=1 test --verbose
+		${HOME} "$@" cd -eu export -eu sed /usr/bin --verbose 2>/dev/null | $(pwd)
+		"$@" grep awk $(pwd) cd "$@" awk export -eu sed "$1" printf "$@" && | readonly
+$(pwd) 'quoted text' export -eu export echo then $(pwd) export
+$(pwd) ${HOME} -eu $(pwd) echo readonly grep --verbose
+		grep /usr/bin local local printf x=1 $(pwd) echo cd x=1 export awk
+then local cd local test grep 'quoted text' test ${HOME} awk readonly
+	sed readonly && "$@" "$1" /usr/bin test printf --verbose --verbose
+		--verbose x=1 "$1" /usr/bin
+	${HOME} /usr/bin /usr/bin -eu -eu readonly 2>/dev/null 'quoted text'
+	| awk echo --verbose readonly readonly readonly
+		--verbose /usr/bin "$1" | sed
+test printf $(pwd) export grep 2>/dev/null 2>/dev/null
+		printf done /usr/bin | export export 'quoted text' grep "$1" --verbose
+	${HOME} $(pwd) test test "$1" "$1" "$@" sed --verbose readonly
+	&& | ${HOME} local sed | grep 'quoted text' | local test x=1 'quoted text' awk
+		awk --verbose --verbose 2>/dev/null -eu /usr/bin "$@" awk 2>/dev/null
+		echo export echo export --verbose
+	2>/dev/null then export test $(pwd) printf ${HOME}
+&& $(pwd) export sed -eu local cd /usr/bin x=1 x=1 then awk done then echo x=1
+	sed awk 'quoted text' printf grep && echo | grep readonly
+		sed 2>/dev/null $(pwd) sed test export $(pwd) local cd $(pwd) ${HOME}
+		cd sed done 'quoted text' x=1 --verbose echo ${HOME} | && printf 'quoted text'
+		${HOME} readonly grep then done 2>/dev/null -eu local echo -eu sed then 'quoted text'
+		then /usr/bin /usr/bin then
+cd export $(pwd) "$1" 'quoted text' cd && grep "$1" 'quoted text' "$1" x=1 test
+		grep echo readonly "$1" echo local printf "$1" then "$@" cd local local -eu sed
+		"$@" && | echo | grep --verbose --verbose 'quoted text' then -eu test -eu ${HOME}
+readonly sed done awk 'quoted text' readonly sed --verbose echo --verbose
+export $(pwd) test export grep
+	--verbose "$1" local sed 'quoted text' /usr/bin
+	'quoted text' "$1" --verbose | echo 'quoted text' $(pwd) cd printf done x=1
+		awk echo cd | "$1" | -eu ${HOME} local --verbose readonly && 'quoted text'
+	${HOME} readonly 'quoted text'
+"$@" "$1" | | "$1" "$1" printf
+	sed x=1 --verbose grep "$@" test echo 2>/dev/null "$@" x=1 grep echo printf
+		test --verbose done then cd echo export ${HOME} 2>/dev/null 'quoted text'
+	export "$@" $(pwd) cd grep 2>/dev/null printf printf cd 'quoted text'
+local export -eu "$1" $(pwd) $(pwd) 2>/dev/null 2>/dev/null cd test 2>/dev/null
+	$(pwd) sed $(pwd) printf x=1 'quoted text' $(pwd)
+		cd echo readonly --verbose ${HOME} x=1 grep test then local -eu export
+	2>/dev/null --verbose cd export then 'quoted text' grep ${HOME} readonly
+	export -eu sed sed x=1 readonly
+	-eu | then | -eu echo &&
+		"$@" readonly 2>/dev/null 2>/dev/null
+	echo readonly sed 'quoted text' /usr/bin grep | && test
+		${HOME} grep then cd printf done /usr/bin "$@" ${HOME} && --verbose
+&& sed test /usr/bin 2>/dev/null printf test local -eu 2>/dev/null 'quoted text'
+		sed printf done | readonly export && printf 2>/dev/null done then | export
+grep readonly then && awk ${HOME} x=1 $(pwd) sed 'quoted text'
+		"$@" test done test "$@" 'quoted text' echo -eu sed done
+	readonly done then test --verbose /usr/bin
+	"$1" "$1" awk x=1 | local cd /usr/bin
+"$@" $(pwd) "$@" cd /usr/bin && printf "$1" --verbose -eu printf 'quoted text'
+		--verbose sed 'quoted text' 'quoted text'
+		test /usr/bin printf sed
+		grep sed test awk echo grep | 'quoted text' test echo 2>/dev/null export sed cd
+grep $(pwd) $(pwd) 'quoted text' then x=1 && echo cd done cd /usr/bin echo --verbose
+readonly $(pwd) done cd test "$1" printf grep export --verbose x=1 $(pwd)
+	awk local "$@" && local local test awk /usr/bin
+#include c89.sh
+	readonly sed cd 2>/dev/null grep /usr/bin 'quoted text' test awk printf -eu
+		awk && -eu | --verbose readonly
+--verbose | -eu done done then
+	-eu --verbose --verbose $(pwd) $(pwd) "$@" cd -eu done export
+		"$1" x=1 export --verbose echo export echo awk sed grep test sed "$@" export
+		awk local sed /usr/bin $(pwd) awk echo
+x=1 --verbose ${HOME} awk -eu ${HOME} grep test test
+/usr/bin done /usr/bin --verbose 'quoted text' test --verbose "$@"
+2>/dev/null ${HOME} printf | grep printf then readonly 'quoted text' --verbose x=1
+		awk test awk x=1 -eu "$@" && done printf 'quoted text'
+"$1" --verbose | -eu grep
+export x=1 sed --verbose sed done local "$@" printf -eu
+	-eu sed cd export -eu done --verbose done then awk readonly
+	| && local | readonly then then && --verbose --verbose 'quoted text' printf
+	${HOME} then ${HOME} ${HOME} && then | awk local export local --verbose
+readonly cd printf done printf awk export && grep $(pwd)
+sed done test awk && test awk |
+		| ${HOME} 2>/dev/null -eu 2>/dev/null then ${HOME} test
+	awk 2>/dev/null | ${HOME} done sed readonly --verbose x=1 /usr/bin cd
+	| then then "$@" echo ${HOME}
+cd export awk | x=1 readonly "$1" x=1
+	readonly cd echo | export sed 'quoted text' $(pwd) readonly
+	readonly test test printf awk sed | grep | done 'quoted text'
+		| "$1" then /usr/bin printf 2>/dev/null "$@" sed
+	test ${HOME} awk export 'quoted text' | 2>/dev/null --verbose "$@" -eu
+cd then 2>/dev/null readonly test x=1 test then /usr/bin grep
+${HOME} && "$1" cd --verbose $(pwd) grep $(pwd) --verbose | then
+	| test echo cd "$1" -eu cd --verbose "$1" --verbose
+cd local "$@" /usr/bin printf test "$@" "$1" awk -eu then awk printf
+		'quoted text' echo | local 'quoted text' 2>/dev/null
+	| -eu --verbose printf -eu x=1 ${HOME} cd done done -eu export $(pwd)
+		grep printf -eu grep "$1" $(pwd) "$1"
+		--verbose local "$1" "$@" --verbose test printf
+		"$1" done export test -eu done export echo "$1" -eu 2>/dev/null -eu cd
+		export x=1 awk --verbose cd ${HOME} then $(pwd) $(pwd)
+		sed && grep x=1 2>/dev/null
+		export cd 'quoted text' 2>/dev/null /usr/bin grep
+	test awk ${HOME} echo local && grep ${HOME} $(pwd) /usr/bin |
+x=1 /usr/bin --verbose export export | export "$1"
+		printf test sed 'quoted text' 2>/dev/null --verbose printf printf
+	| awk printf x=1 --verbose /usr/bin -eu -eu "$@"
+"$1" awk "$@" echo 'quoted text' readonly
+	$(pwd) cd export export "$@" test printf ${HOME} readonly
+	--verbose | x=1 done --verbose export done 2>/dev/null
+	--verbose --verbose 'quoted text' x=1 local printf test 'quoted text'
+		echo 'quoted text' grep echo export grep export local awk local ${HOME} &&
+		x=1 ${HOME} grep test | "$@" 2>/dev/null -eu cd test
+--verbose && ${HOME} /usr/bin ${HOME} && test
+printf export export then
+&& export -eu /usr/bin test 2>/dev/null printf $(pwd)
+		"$@" "$@" -eu /usr/bin local sed echo "$1" echo ${HOME} -eu $(pwd)
+grep "$1" | 2>/dev/null done -eu grep grep -eu 'quoted text' --verbose
+	awk export awk 'quoted text' "$1" "$@" cd done x=1 local 2>/dev/null grep --verbose
+cd awk test local --verbose -eu
+	"$1" done done 2>/dev/null readonly
+		&& $(pwd) grep readonly
+		${HOME} sed $(pwd) export
+done export export then | echo "$1" $(pwd) "$1" $(pwd) 2>/dev/null sed "$1"
+	local local then /usr/bin test echo 'quoted text' export --verbose $(pwd) local
+	2>/dev/null cd local then --verbose awk -eu 'quoted text' --verbose | done
+	/usr/bin export -eu $(pwd) readonly && ${HOME}
+		test sed --verbose x=1 2>/dev/null $(pwd)
+"$1" 'quoted text' x=1 cd --verbose "$1" $(pwd) 'quoted text' readonly
+	--verbose --verbose echo 'quoted text' grep x=1 sed "$@" |
+x=1 cd && 'quoted text' x=1 printf -eu
+		test readonly export "$@"
+"$@" then sed "$@" | printf test --verbose 'quoted text'
+-eu export grep local
+		export printf --verbose printf "$@" ${HOME} $(pwd) echo x=1 printf
+awk done grep $(pwd) test x=1 printf "$1" then
+	readonly local export cd sed echo export test /usr/bin --verbose
+	2>/dev/null && 'quoted text' readonly readonly
+-eu "$1" test "$1" test $(pwd) && then
+"$1" /usr/bin printf grep $(pwd) 'quoted text' && "$1" 'quoted text'
+	then grep 'quoted text' x=1 cd done /usr/bin 2>/dev/null
+echo local export -eu readonly then awk sed "$@" -eu
+	"$1" 'quoted text' test then "$@" echo 'quoted text' export && export | grep done
+local then ${HOME} x=1 cd then readonly local
+		sed 'quoted text' awk --verbose
+$(pwd) then cd /usr/bin test
+	"$@" cd "$@" done "$1" $(pwd) /usr/bin
+2>/dev/null printf done export printf "$@" test awk --verbose && "$@" 'quoted text'
+		$(pwd) grep cd done done -eu | /usr/bin 2>/dev/null export printf
+		x=1 then sed then echo | --verbose test "$1" readonly "$1" local test
+		test cd local printf local test sed | then "$1" awk
+printf printf -eu cd --verbose printf cd sed 2>/dev/null printf "$1" 'quoted text'
+	'quoted text' cd test -eu 2>/dev/null /usr/bin echo
+		x=1 done -eu "$1" then echo readonly local readonly | grep echo x=1 ${HOME} && 2>/dev/null
+/usr/bin grep sed awk awk 'quoted text' --verbose
+	"$@" readonly x=1 awk x=1 x=1 local --verbose 2>/dev/null
+| "$@" 2>/dev/null --verbose x=1 ${HOME} 'quoted text' local
+		/usr/bin /usr/bin local
+	then grep printf --verbose export test /usr/bin
+| /usr/bin awk 'quoted text' awk $(pwd) --verbose cd ${HOME}
+		--verbose printf done 2>/dev/null local done "$1" local | export then done printf
+	sed awk && $(pwd) then x=1 cd "$1"
+		echo grep cd /usr/bin ${HOME} local x=1 "$1" export awk
+grep -eu printf test /usr/bin /usr/bin local
+		printf awk "$1" $(pwd) then | test "$1" local | "$1" /usr/bin x=1 ${HOME} ${HOME}
+2>/dev/null printf cd "$1" test test $(pwd) readonly
+local ${HOME} 2>/dev/null test --verbose $(pwd)
+	grep /usr/bin done sed | test readonly 'quoted text' export
+	| then test done then ${HOME} $(pwd) then
+		"$1" -eu -eu --verbose export awk && $(pwd) x=1 $(pwd) then
+	echo echo | ${HOME} --verbose local local printf awk then && "$1" cd && test sed
+2>/dev/null 'quoted text' 'quoted text' cd "$1" "$1"
+local sed echo awk && readonly cd "$1" sed
+grep x=1 && 2>/dev/null readonly awk
+"$1" export local test ${HOME} | x=1 local done cd $(pwd) then grep
+		awk test printf && then
+	| sed then && cd sed 'quoted text' /usr/bin
+&& 2>/dev/null then /usr/bin 'quoted text' test
+		"$1" x=1 printf 'quoted text'
+grep && --verbose x=1 'quoted text' grep 2>/dev/null printf cd x=1 /usr/bin "$1"
+	cd export "$@" local then "$1" "$@"
+export -eu awk x=1 then printf readonly readonly "$1" 'quoted text'
+	/usr/bin 2>/dev/null $(pwd) $(pwd) test $(pwd) local
+"$@" 'quoted text' then | "$1" readonly printf /usr/bin
+		export ${HOME} readonly grep cd | --verbose | readonly "$@"
+	echo 'quoted text' then readonly 'quoted text'
+	grep done 'quoted text' "$@"
+&& test /usr/bin printf 'quoted text' export readonly
+test x=1 "$1" local test awk grep
+		$(pwd) ${HOME} ${HOME} echo
+echo sed sed then local 2>/dev/null
+		$(pwd) readonly local then grep ${HOME}
+grep ${HOME} | printf awk ${HOME} echo printf printf
+"$1" printf $(pwd) ${HOME} 'quoted text' local "$1" test $(pwd) local 'quoted text'
+cd "$@" "$1" | done sed 2>/dev/null
+	&& echo && echo -eu ${HOME}
+&& $(pwd) && then 'quoted text'
+	/usr/bin local done grep -eu local $(pwd) cd printf 'quoted text' grep 'quoted text'
+	$(pwd) ${HOME} local echo echo 2>/dev/null "$@" sed echo | export
+2>/dev/null 'quoted text' 'quoted text' export
+export awk -eu echo ${HOME} then 2>/dev/null ${HOME} && "$1" awk
+test then cd done --verbose awk local /usr/bin export
+	-eu ${HOME} echo "$@" awk awk "$1" | x=1 'quoted text'
+	'quoted text' grep /usr/bin awk 'quoted text' "$1" -eu 2>/dev/null export 'quoted text'
+		cd x=1 local readonly /usr/bin /usr/bin x=1 local sed test printf --verbose
+	&& ${HOME} grep test /usr/bin "$1" echo export readonly export | test local
+		--verbose 'quoted text' grep grep grep printf | awk readonly printf export
+		${HOME} $(pwd) $(pwd) grep readonly printf
+	grep x=1 --verbose awk
+--verbose $(pwd) /usr/bin awk grep ${HOME} | test | 2>/dev/null
+	echo -eu && x=1 cd ${HOME} grep --verbose sed cd awk
+local -eu | export ${HOME} then "$@" "$1" $(pwd)
+		test export printf --verbose && local
+"$1" test "$@" x=1 then | readonly 'quoted text' local ${HOME} done echo echo
+		"$@" /usr/bin -eu echo grep $(pwd) /usr/bin cd --verbose test cd ${HOME}
+	sed $(pwd) -eu x=1 | && test && readonly -eu cd "$@" readonly
+		readonly "$@" 'quoted text' export awk test $(pwd) "$@" awk "$1" echo -eu
+printf x=1 --verbose $(pwd) sed | grep then export echo ${HOME} 'quoted text'
+	done sed --verbose "$1" then /usr/bin done --verbose -eu test cd "$@" export
+	-eu done "$1" export export cd sed
+| export readonly "$@" sed done done sed local
+| local $(pwd) "$1" -eu test |
+		&& awk $(pwd) printf | /usr/bin "$1" echo | $(pwd) awk -eu "$1"
+2>/dev/null awk | cd printf
+		x=1 then readonly export readonly printf
+	printf done grep sed awk --verbose "$@"
+	x=1 awk sed 'quoted text' $(pwd) $(pwd)
+		| awk then | test x=1 -eu && --verbose --verbose awk echo cd readonly done
+then readonly printf grep echo
+-eu echo test cd awk "$@" done grep | cd
+		awk && cd | $(pwd) export --verbose
+		awk export then export "$1" ${HOME}
+	then local cd $(pwd) x=1 done
+		done "$1" readonly ${HOME} awk && readonly
+		awk awk --verbose "$1" "$1" | && "$@" awk /usr/bin
+	$(pwd) 2>/dev/null ${HOME} printf cd
+	echo --verbose /usr/bin cd /usr/bin local |
+	/usr/bin test "$1" echo --verbose "$1" $(pwd)
+export local cd cd local cd grep printf
+		"$@" local grep $(pwd) --verbose then grep done "$1" &&
+		-eu 2>/dev/null "$@" readonly | export 'quoted text'
+printf export --verbose export awk export
+	$(pwd) && $(pwd) x=1 export done --verbose export $(pwd) $(pwd) printf x=1 x=1
+	2>/dev/null 2>/dev/null export &&
+	cd awk awk "$1" awk awk grep export
+		${HOME} cd 'quoted text' awk -eu awk then echo && x=1 2>/dev/null export
+		printf ${HOME} test done -eu grep "$1"
+	x=1 awk 2>/dev/null "$1" /usr/bin echo printf "$@" done export sed
+		-eu test | done cd 'quoted text' printf grep export printf x=1 --verbose
+	then | test local cd test awk 'quoted text' echo x=1 printf ${HOME}
+	echo $(pwd) then 2>/dev/null export done
+		then /usr/bin then done echo then && test $(pwd) ${HOME} $(pwd)
+		$(pwd) printf local local -eu grep
+then "$@" "$@" x=1 awk -eu sed x=1 'quoted text' export grep
+		"$@" 'quoted text' test printf test ${HOME}
+		${HOME} grep then ${HOME} then readonly then grep
+	readonly "$@" echo && "$@" x=1 --verbose
+	cd /usr/bin cd "$1" export "$1" then echo 2>/dev/null cd /usr/bin echo
+	"$1" "$1" printf x=1 "$1" local then 'quoted text' awk export "$@"
+	| /usr/bin 2>/dev/null $(pwd) ${HOME} cd "$1" 'quoted text'
+		sed --verbose local && 2>/dev/null
+readonly sed && export -eu x=1 $(pwd) "$1" -eu sed test
+		| | export 'quoted text' printf 'quoted text'
+	local -eu $(pwd) x=1 -eu /usr/bin readonly /usr/bin awk printf 'quoted text'
+	readonly "$1" cd readonly local --verbose awk printf grep sed readonly --verbose
+		export local readonly done then export ${HOME} x=1 done --verbose | export local
+		cd "$@" then "$@" test 'quoted text' printf
+	"$1" -eu echo export x=1
+$(pwd) "$@" cd export done "$1" cd awk 'quoted text' | x=1 awk export
+		"$1" $(pwd) -eu cd export then && 'quoted text' printf /usr/bin 2>/dev/null /usr/bin
+cd test "$@" x=1 $(pwd) test -eu printf && export "$1" awk test $(pwd) local -eu
+	printf sed readonly "$@" | "$1" --verbose $(pwd) readonly "$1" done echo sed
+		"$@" -eu test readonly /usr/bin sed | done cd 'quoted text'
+		-eu printf export readonly --verbose -eu $(pwd) "$@" printf printf
+		export cd $(pwd) sed test "$1" test && 'quoted text' 'quoted text'
+		| done grep cd test awk
+-eu -eu "$@" local &&
+	echo && 'quoted text' done readonly sed cd "$1"
+test && sed cd --verbose $(pwd) x=1 cd && | 'quoted text' "$@" && /usr/bin --verbose
+| printf $(pwd) --verbose echo done /usr/bin | grep readonly readonly export
+echo sed awk $(pwd) && -eu 2>/dev/null "$1"
+		&& printf echo local echo "$@" then ${HOME} "$@"
+		2>/dev/null 2>/dev/null local awk test
+	local && export 'quoted text'
+		echo printf local sed "$1" export grep -eu x=1 --verbose local readonly
+	sed printf -eu sed export --verbose echo /usr/bin done $(pwd) "$@" then -eu
+		readonly done export && grep export export | x=1 --verbose 2>/dev/null done &&
+	done 2>/dev/null "$@" echo | then "$1" sed | test awk local ${HOME} 2>/dev/null
+	'quoted text' then "$@" cd done | /usr/bin | 'quoted text' "$@" 'quoted text'
+		'quoted text' grep && echo 2>/dev/null
+		/usr/bin --verbose | readonly readonly $(pwd) test
+	| then readonly --verbose done 2>/dev/null 2>/dev/null 'quoted text'
+test then 'quoted text' $(pwd) test local test done
+		"$1" "$@" x=1 then | 2>/dev/null /usr/bin
+		"$@" 'quoted text' cd --verbose export cd /usr/bin
+	test $(pwd) done --verbose "$1" local $(pwd) local &&
+local 2>/dev/null grep export test ${HOME}
+printf export awk ${HOME} then --verbose 2>/dev/null && done then /usr/bin
+cd "$1" export && done test --verbose | 2>/dev/null
+	| && awk && local local readonly -eu sed sed
+	--verbose local grep "$1"
+		-eu 2>/dev/null local grep x=1 && && cd export "$@" ${HOME} --verbose
+grep /usr/bin 2>/dev/null $(pwd) test "$1" $(pwd) && done ${HOME} done ${HOME}
+	"$1" cd cd local done grep ${HOME} grep | done done cd 2>/dev/null && &&
+	local then export ${HOME} cd awk grep done
+		| cd -eu printf --verbose awk x=1 done ${HOME} 'quoted text' 'quoted text'
+		--verbose "$@" echo printf /usr/bin then done -eu --verbose
+		/usr/bin awk 2>/dev/null 2>/dev/null
+		test | awk $(pwd) 'quoted text'
+	"$@" | cd | test sed "$@" cd ${HOME} awk /usr/bin "$@"
+grep "$@" printf local $(pwd) awk --verbose awk "$1"
+echo grep -eu local export awk sed 2>/dev/null | -eu | grep $(pwd)
+		"$1" && then | --verbose grep "$@"
+'quoted text' readonly grep readonly test then printf test grep
+	sed export test echo x=1 -eu $(pwd)
+${HOME} printf /usr/bin
+	x=1 test /usr/bin x=1 | printf done --verbose | echo echo -eu "$@" printf
+export 'quoted text' /usr/bin | "$@" x=1 cd printf test echo grep "$@"
+${HOME} done test readonly "$@" 'quoted text' cd "$@" --verbose local local grep
+		/usr/bin | /usr/bin local x=1 $(pwd) /usr/bin
+printf printf awk ${HOME}
+cd x=1 printf 'quoted text' /usr/bin
+$(pwd) --verbose sed then awk --verbose 'quoted text'
+${HOME} then then then ${HOME} local $(pwd) 'quoted text' --verbose /usr/bin x=1
+	"$1" awk && && --verbose echo export
+		grep echo $(pwd) printf echo grep grep
+	local && cd sed /usr/bin x=1
+echo 2>/dev/null "$@" ${HOME} printf echo test /usr/bin echo -eu done then
+		export export --verbose && "$@" -eu "$@" && "$@" sed -eu
+	then cd echo "$1" && sed echo --verbose x=1 "$@"
+${HOME} $(pwd) "$@" /usr/bin awk -eu done && test "$1" then
+test awk grep 2>/dev/null cd done test then "$@" "$@" $(pwd) x=1
+		test sed echo echo "$@" grep | 'quoted text'
+test /usr/bin ${HOME} grep /usr/bin done --verbose
+		then grep cd && then
+		echo printf /usr/bin then printf 2>/dev/null /usr/bin ${HOME} readonly readonly
+	test ${HOME} --verbose readonly | readonly test
+	readonly export echo local 'quoted text' "$@" then 'quoted text' "$@" $(pwd)
+cd 2>/dev/null done 'quoted text' test 2>/dev/null --verbose
+	local cd -eu sed --verbose grep ${HOME} $(pwd) | 'quoted text'
+		cd sed $(pwd) 'quoted text'
+		-eu "$1" export $(pwd) test
+"$@" 'quoted text' | sed
+printf | export ${HOME} && then x=1 x=1 | echo && awk
+	'quoted text' echo echo -eu $(pwd) && "$@" | done $(pwd) cd local "$1" $(pwd)
+export export "$1" grep --verbose
+&& awk awk --verbose -eu
+${HOME} sed done cd test /usr/bin -eu -eu
+${HOME} local grep done -eu | 2>/dev/null
+		then then sed echo done sed cd && --verbose
+		echo | ${HOME} local x=1
+	done 'quoted text' printf echo then 'quoted text' export
+	printf x=1 "$@" readonly 'quoted text' cd "$@" -eu grep --verbose 'quoted text'
+export x=1 done then -eu printf "$1" cd readonly grep --verbose
+		-eu cd x=1 ${HOME} printf test --verbose "$@" | && 'quoted text'
+		| grep "$1" export then | "$1" /usr/bin /usr/bin --verbose x=1 ${HOME} local cd
+$(pwd) printf printf && $(pwd) -eu export local grep /usr/bin 'quoted text'
+		x=1 | awk 2>/dev/null readonly then done 2>/dev/null 2>/dev/null
+		printf | echo 2>/dev/null |
+		awk --verbose && test "$@" --verbose readonly 'quoted text' /usr/bin cd $(pwd)
+	2>/dev/null "$1" export sed export sed
+	--verbose 'quoted text' && export -eu local
+		sed && readonly $(pwd)
+	&& export $(pwd) printf --verbose x=1 2>/dev/null
+	--verbose readonly x=1 local ${HOME} "$1" done ${HOME} cd
+		printf export | 'quoted text' -eu && test $(pwd) printf $(pwd) --verbose sed
+	--verbose awk sed ${HOME} 2>/dev/null echo cd "$@" "$@" readonly export export x=1
+	"$1" 2>/dev/null /usr/bin done
+	"$1" grep | ${HOME} && local $(pwd) ${HOME} then && export
+	${HOME} cd test 'quoted text'
+	| 'quoted text' "$1" 'quoted text'
+		export then printf "$1" awk && | done readonly
+readonly $(pwd) "$1" $(pwd) grep echo /usr/bin
+		"$1" /usr/bin && -eu /usr/bin 2>/dev/null
+		echo readonly done done grep
+| "$@" $(pwd) done test --verbose --verbose readonly
+	| "$@" && | "$@" echo done "$@" export /usr/bin
+	readonly local cd grep
+"$@" awk echo readonly then "$1" "$@" done 'quoted text' "$1" local
+		sed then awk cd -eu ${HOME} grep | printf readonly x=1 done export grep
+		x=1 "$@" done "$@" "$1" "$@" sed "$1" "$1" awk done export printf "$@" --verbose
+export | echo export x=1 export
+		readonly awk readonly test /usr/bin --verbose printf
+	cd | && "$1" cd local done readonly
+	local awk printf 'quoted text' readonly done readonly -eu
+	--verbose 'quoted text' x=1 "$1" grep 2>/dev/null cd readonly then
+		--verbose ${HOME} awk export grep $(pwd) --verbose 'quoted text' "$@" ${HOME}
+cd "$@" done | 'quoted text' awk awk 'quoted text' export
+		grep then | -eu "$@" x=1 | $(pwd) ${HOME} awk | done && grep -eu
+done --verbose then 'quoted text' | && x=1 | printf then | cd -eu
+		${HOME} test --verbose export local 2>/dev/null -eu readonly
+		2>/dev/null ${HOME} 2>/dev/null && "$@" cd ${HOME} | printf -eu
+	printf 'quoted text' "$@" | test then sed cd local local x=1 cd "$1" local
+		/usr/bin cd then grep x=1 -eu "$1" --verbose $(pwd) grep && x=1 -eu done echo
+		cd /usr/bin export done -eu "$1" | -eu --verbose -eu x=1 -eu $(pwd) --verbose "$@"
+| done x=1 local -eu
+	'quoted text' ${HOME} --verbose
+	readonly x=1 && cd sed 2>/dev/null | 'quoted text' local $(pwd) --verbose --verbose
+		/usr/bin sed echo "$1" test -eu sed "$1" 'quoted text'
+		export ${HOME} then ${HOME} 'quoted text' -eu x=1 x=1 printf && export export
+local local --verbose 'quoted text'
+	sed x=1 /usr/bin "$@" cd
+echo && test test | -eu sed && printf -eu 'quoted text'
+	awk local --verbose | grep "$@" -eu printf then 'quoted text' awk printf cd --verbose
+printf grep -eu cd -eu --verbose echo
+		echo x=1 sed test readonly | cd grep echo ${HOME} "$@"
+	grep grep done cd awk sed x=1 export --verbose
+		$(pwd) done 'quoted text'
+awk "$1" echo && then 2>/dev/null
+	sed 'quoted text' printf "$1"
+export ${HOME} grep test export awk 2>/dev/null x=1
+| export "$@" 2>/dev/null
+readonly 2>/dev/null $(pwd) -eu 'quoted text' 'quoted text' && && x=1 $(pwd)
+		sed 2>/dev/null $(pwd) printf --verbose ${HOME} then
+		-eu readonly awk ${HOME} --verbose sed done ${HOME}
+	printf readonly "$@"
+local local --verbose done awk cd done 2>/dev/null then x=1 awk
+	export $(pwd) local 'quoted text' && --verbose printf && | cd test readonly
+	"$@" local "$@" printf cd /usr/bin "$@" awk ${HOME} 2>/dev/null local ${HOME} test
+local | readonly test echo test then
+		awk --verbose grep sed printf
+	test sed $(pwd) grep "$@" && --verbose "$1" printf test then
+readonly then --verbose
+		sed cd awk sed echo && "$@"
+		$(pwd) printf awk 'quoted text' $(pwd) echo
+		then echo sed /usr/bin /usr/bin && export done ${HOME}
+		x=1 -eu test "$1" /usr/bin echo "$@" sed readonly
+		local 'quoted text' ${HOME}
+'quoted text' "$1" export x=1 grep --verbose 'quoted text' "$@" /usr/bin
+		-eu x=1 awk x=1 printf x=1 printf grep 'quoted text' grep sed local printf
+		printf test -eu cd printf x=1
+'quoted text' | 'quoted text' done --verbose echo echo --verbose awk "$1" 2>/dev/null
+"$1" readonly /usr/bin export printf awk x=1 local
+	"$@" x=1 "$1" readonly local $(pwd) | |
+		grep 2>/dev/null 'quoted text' -eu cd cd "$@"
+		export done grep "$1" then awk
+	printf x=1 --verbose cd awk && && cd sed local -eu 'quoted text'
+	local x=1 awk awk 2>/dev/null 2>/dev/null test
+	test awk sed done printf 2>/dev/null $(pwd) ${HOME} ${HOME} && grep
+-eu local readonly 2>/dev/null ${HOME} grep -eu sed /usr/bin
+		test --verbose done printf test --verbose /usr/bin done 2>/dev/null x=1 printf
+	$(pwd) grep --verbose test &&
+		awk /usr/bin printf && 'quoted text' ${HOME}
+	x=1 readonly /usr/bin done done | /usr/bin cd 'quoted text'
+		x=1 awk then sed && awk awk | 'quoted text' 'quoted text' readonly
+	2>/dev/null "$@" echo readonly -eu "$@" awk printf && $(pwd) 'quoted text' grep
+		-eu done 'quoted text' 'quoted text'
+		awk readonly then cd --verbose /usr/bin
+		--verbose x=1 cd /usr/bin $(pwd)
+		'quoted text' awk 2>/dev/null printf awk | && "$@" -eu
+	'quoted text' --verbose 2>/dev/null
+"$1" "$@" "$1" done awk
+echo cd grep "$@" readonly -eu printf awk sed printf
+${HOME} --verbose done printf "$@" --verbose | cd 2>/dev/null -eu awk sed sed
+		grep local "$1" local --verbose cd
+	then x=1 done sed ${HOME} $(pwd) 2>/dev/null
+		/usr/bin grep local echo 2>/dev/null
+		cd cd grep then "$@" ${HOME} readonly printf /usr/bin grep
+| ${HOME} awk "$@" awk && export "$@"
+sed "$1" /usr/bin echo done /usr/bin then --verbose local -eu readonly export
+	${HOME} readonly "$1" | readonly
+	echo test readonly cd sed echo
+x=1 then grep readonly export grep sed echo x=1 printf grep done 2>/dev/null
+	2>/dev/null 'quoted text' readonly done grep -eu printf printf -eu
+	'quoted text' --verbose $(pwd) "$@" -eu --verbose test local export
+	&& test | printf | echo printf "$1"
+then 'quoted text' then && test local $(pwd)
+	local --verbose x=1 2>/dev/null test grep --verbose
+		local then /usr/bin grep && local then local "$@" export 'quoted text'
+	local export x=1 "$@" echo x=1
+		| awk then "$1" echo awk && 2>/dev/null --verbose "$@" "$@" sed
+		-eu 2>/dev/null grep && x=1 ${HOME}
+grep x=1 /usr/bin 2>/dev/null sed sed readonly done awk cd cd x=1
+		sed then /usr/bin sed test 'quoted text'
+		'quoted text' /usr/bin export x=1 --verbose ${HOME} local awk then "$@"
+then test sed | "$1" awk test test export "$1" /usr/bin sed done ${HOME} awk export
+export --verbose "$@" printf readonly grep export -eu sed printf echo
+		then /usr/bin | then /usr/bin cd
+	export "$@" 2>/dev/null awk "$@" done "$1"
+		awk sed -eu && cd export x=1 ${HOME}
+	&& x=1 local x=1 2>/dev/null then --verbose grep
+local --verbose export && then local awk then 2>/dev/null "$@" -eu ${HOME}
+		export readonly /usr/bin && sed sed "$@"
+grep ${HOME} $(pwd) echo sed --verbose local ${HOME} /usr/bin 'quoted text'
+		'quoted text' then "$1" "$@" 'quoted text'
+		sed x=1 local "$@" echo done /usr/bin sed printf "$1" $(pwd) sed "$@"
+export grep readonly awk grep done printf | export -eu readonly
+	test then grep awk "$@" /usr/bin
+echo ${HOME} test grep $(pwd) grep x=1 readonly
+		/usr/bin /usr/bin $(pwd)
+2>/dev/null test 2>/dev/null $(pwd) grep 2>/dev/null readonly -eu awk then export
+		$(pwd) echo 2>/dev/null
+	sed export && 'quoted text' /usr/bin && -eu then 'quoted text'
+		readonly /usr/bin then 'quoted text' done 2>/dev/null
+sed export echo "$@" $(pwd) done 2>/dev/null
+	"$@" awk printf $(pwd) readonly
+		awk cd readonly 'quoted text' --verbose grep 2>/dev/null test $(pwd)
+	"$@" && then 'quoted text' cd /usr/bin then awk test test readonly export
+	readonly then grep -eu "$1" done
+	${HOME} && --verbose readonly $(pwd)
+	${HOME} awk $(pwd) && grep sed
+'quoted text' sed $(pwd) cd readonly ${HOME} sed --verbose done grep sed "$1"
+	${HOME} done /usr/bin grep
+		x=1 | --verbose -eu --verbose && x=1 /usr/bin echo | printf sed sed
+		local sed test $(pwd) grep grep local export -eu ${HOME}
+sed "$@" -eu export done awk $(pwd) $(pwd) && "$@" 'quoted text' sed awk 'quoted text'
+x=1 ${HOME} ${HOME} x=1 /usr/bin printf
+	| done then then then && 2>/dev/null
+cd ${HOME} awk 2>/dev/null local sed $(pwd) test &&
+	test awk readonly printf
+| ${HOME} done done sed x=1 awk grep local
+cd export readonly export $(pwd) "$@" export
+		done "$@" awk --verbose
+		sed echo grep "$@" | --verbose --verbose local
+	done $(pwd) -eu -eu export 2>/dev/null
+--verbose "$@" -eu "$1" $(pwd) echo export readonly --verbose 2>/dev/null
+		done && | export grep sed printf grep
+		then echo $(pwd) readonly "$@" -eu /usr/bin then export
+echo x=1 export test | 2>/dev/null "$@" 2>/dev/null /usr/bin "$@" export
+grep && sed "$1" readonly | ${HOME} "$1" readonly x=1 local printf /usr/bin
+		2>/dev/null -eu cd $(pwd)
+	printf && -eu --verbose echo
+		echo then -eu 2>/dev/null awk sed then done $(pwd) test local done echo sed
+	then then then done ${HOME} && grep --verbose /usr/bin cd readonly
+		export echo printf x=1 | grep grep -eu
+	grep sed | && "$@" "$@" --verbose echo "$1" /usr/bin awk awk cd ${HOME} "$@" -eu
+		&& -eu grep "$@" -eu --verbose | cd sed 'quoted text' $(pwd)
+&& done sed "$@" test "$1" /usr/bin awk "$@" done 'quoted text'
+x=1 $(pwd) -eu x=1 readonly "$1" local echo test ${HOME} cd -eu /usr/bin
+then ${HOME} then test sed local printf x=1 -eu
+	"$@" $(pwd) /usr/bin echo
+	-eu echo | 2>/dev/null && 2>/dev/null
+	grep then $(pwd) grep export awk
+		export readonly sed local awk
+	"$1" | --verbose awk /usr/bin echo 'quoted text'
+		echo local printf 2>/dev/null
+		grep done done test echo local | $(pwd) && /usr/bin
+	${HOME} "$1" then "$1" readonly grep "$@" local | readonly
+	"$1" 2>/dev/null -eu 2>/dev/null export awk awk ${HOME} && "$@" awk --verbose
+		echo echo export /usr/bin --verbose awk && --verbose 2>/dev/null
+	readonly 'quoted text' done
+	| printf awk then --verbose readonly --verbose awk
+		sed printf | -eu $(pwd) x=1
+		x=1 echo "$1" --verbose cd test done then | echo local printf echo grep local
+		done 'quoted text' readonly printf cd cd echo "$1"
+| x=1 readonly $(pwd) $(pwd) "$@" "$1" && readonly 2>/dev/null done
+	'quoted text' done done echo sed then test | ${HOME}
+test export x=1 test printf then x=1 printf sed then x=1 export grep test -eu
+	"$1" then then local printf
+--verbose 'quoted text' --verbose test test | export
+	/usr/bin && printf printf done printf done
+	cd local then | | 'quoted text' awk $(pwd) "$1" then 2>/dev/null | && test && local
+	| grep test printf 2>/dev/null done |
+	then "$1" /usr/bin done --verbose sed cd
+/usr/bin local then then /usr/bin "$1"
+	"$@" ${HOME} | echo cd ${HOME} test cd 'quoted text' -eu local done grep /usr/bin
+	readonly export | done echo | --verbose ${HOME} -eu /usr/bin printf "$1" local
+		$(pwd) 2>/dev/null cd --verbose export
+		done -eu cd sed 'quoted text'
+		grep done -eu -eu then --verbose then test --verbose ${HOME}
+echo done test sed && 2>/dev/null "$@" printf done
+export awk done then --verbose
+		then $(pwd) "$1" echo 'quoted text' grep echo test
+"$@" ${HOME} grep cd 'quoted text'
+done then /usr/bin cd "$1" done then echo awk local $(pwd) cd local
+		done grep && "$1" --verbose test -eu /usr/bin readonly readonly
+		-eu readonly "$@" && "$@" sed readonly $(pwd) ${HOME} test export
+	"$@" test readonly x=1
+	then 'quoted text' export /usr/bin $(pwd) then
+local sed 2>/dev/null ${HOME} cd | --verbose "$1"
+		"$1" awk /usr/bin export local /usr/bin printf readonly $(pwd)
+x=1 /usr/bin "$1" -eu awk 'quoted text' readonly
+		&& -eu $(pwd) local local local
+cd readonly done grep /usr/bin --verbose cd local local "$1"
+	awk /usr/bin printf sed sed readonly 'quoted text' "$@"
+readonly done 'quoted text' done local && /usr/bin
+'quoted text' "$@" printf printf && x=1 ${HOME} local
+| local "$@" awk printf printf /usr/bin
+	--verbose 2>/dev/null "$@" "$@" "$1" ${HOME} test
+	2>/dev/null /usr/bin test "$@" && | export
+awk x=1 | echo printf -eu "$1"
+/usr/bin ${HOME} -eu readonly "$@" 2>/dev/null test 'quoted text' ${HOME} local
+2>/dev/null printf "$1" 'quoted text' x=1 2>/dev/null local grep awk done
+--verbose readonly && then local x=1 ${HOME} grep -eu echo echo done
+x=1 /usr/bin printf ${HOME} readonly then echo export done done /usr/bin grep
+		done export done awk export
+		sed ${HOME} local "$1" awk echo cd $(pwd)
+	/usr/bin --verbose x=1 --verbose "$@" --verbose sed
+	awk awk 'quoted text' then && $(pwd) readonly readonly local
+		readonly grep "$1" x=1 test -eu readonly export /usr/bin awk
+	export cd 2>/dev/null export 'quoted text' sed "$@" x=1 | $(pwd) echo grep test
+	"$1" awk done $(pwd) | cd /usr/bin "$@" echo ${HOME}
+	'quoted text' ${HOME} grep | cd x=1 done && -eu
+	grep printf local local | then readonly test export echo done sed
+awk && | then 2>/dev/null ${HOME}
+		export sed awk sed /usr/bin --verbose export
+	x=1 awk /usr/bin "$1" x=1 grep -eu 2>/dev/null printf printf done printf then
+		awk 2>/dev/null 'quoted text' then grep local ${HOME} readonly
+		sed ${HOME} /usr/bin x=1 echo ${HOME} "$1" then $(pwd) awk | 'quoted text'
+$(pwd) export done $(pwd) test "$@" done awk printf readonly grep
+	printf x=1 test && "$1" x=1 |
+		x=1 sed test export 'quoted text' awk --verbose export
+		readonly then echo ${HOME} readonly "$@" test cd "$@" /usr/bin
+		printf "$1" 'quoted text'
+'quoted text' && 2>/dev/null && then printf grep | sed awk grep $(pwd)
+awk ${HOME} echo export 2>/dev/null
+	${HOME} | 'quoted text' readonly done ${HOME} | awk ${HOME} done
+	-eu "$1" | readonly cd cd done 'quoted text' "$@"
+		| ${HOME} $(pwd) awk cd | 2>/dev/null grep "$@" $(pwd) --verbose
+then && 'quoted text' awk 'quoted text' $(pwd) awk awk cd
+export /usr/bin printf 2>/dev/null |
+		"$1" "$1" done ${HOME} ${HOME} local done export
+	"$@" ${HOME} echo then 2>/dev/null export local "$@" test
+awk | local && readonly done printf && | then sed awk --verbose local
+		| | grep test awk echo echo
+	local then sed awk x=1 grep 'quoted text' $(pwd) -eu
+		-eu && 2>/dev/null done
+		| printf echo ${HOME} "$1" -eu | && "$@" sed grep
+"$@" awk | sed && | /usr/bin test done sed "$1"
+$(pwd) export "$@" echo local sed /usr/bin grep x=1 export 'quoted text'
+		"$1" $(pwd) /usr/bin "$1" "$@" 'quoted text' $(pwd) /usr/bin --verbose awk
+echo sed printf readonly
+		then "$1" | sed "$1" then 2>/dev/null 2>/dev/null /usr/bin echo "$@"
+then 'quoted text' && "$@" test cd done /usr/bin echo 2>/dev/null 'quoted text'
+	printf grep local 'quoted text' --verbose
+	grep printf test printf "$@" test "$@" 2>/dev/null
+	echo readonly 2>/dev/null export printf
+grep then && sed then -eu done $(pwd)
+		&& then /usr/bin test --verbose | $(pwd) -eu
+--verbose 'quoted text' "$@" /usr/bin test printf readonly sed
+		cd /usr/bin --verbose test ${HOME} "$1" then test cd 'quoted text'
+		then $(pwd) /usr/bin ${HOME} x=1 'quoted text' 2>/dev/null
+		"$@" 'quoted text' "$1" local --verbose then test
+test 'quoted text' "$@" export readonly
+		| /usr/bin && sed sed "$1" ${HOME} x=1 'quoted text' then local --verbose "$@" 2>/dev/null
+'quoted text' | cd done /usr/bin "$1" $(pwd) $(pwd) awk $(pwd)
+readonly 2>/dev/null "$@" -eu then $(pwd)
+		$(pwd) ${HOME} then x=1 grep "$@" then -eu grep --verbose 'quoted text'
+	| local "$@" -eu local echo ${HOME}
+	$(pwd) | && sed echo done "$@"
+'quoted text' export done /usr/bin export "$1" x=1
+		"$1" x=1 && x=1 cd grep "$1" cd then 2>/dev/null done | --verbose
+export readonly test x=1 -eu /usr/bin cd test readonly ${HOME}
+		&& | export && echo export -eu grep "$1"
+	local "$@" ${HOME} done "$1" done "$1" done | done printf
+&& local awk "$1" cd /usr/bin
+"$1" /usr/bin /usr/bin -eu cd cd $(pwd)
+	printf printf cd /usr/bin "$1" $(pwd) done 'quoted text' 'quoted text'
+echo --verbose ${HOME} "$1" test then x=1 cd cd awk export $(pwd) x=1 grep readonly
+		"$1" && export awk x=1 --verbose 2>/dev/null -eu export x=1 grep
+-eu printf export cd $(pwd)
+| local local /usr/bin 'quoted text' && done export local
+x=1 /usr/bin local | "$@" $(pwd) awk export echo cd | && x=1 grep then ${HOME}
+	grep -eu 2>/dev/null grep done echo x=1 /usr/bin $(pwd) x=1 echo | "$1" ${HOME}
+		"$@" --verbose done local cd sed readonly
+awk -eu x=1 "$@" export grep sed echo && sed awk | readonly local 'quoted text'
+	--verbose cd 2>/dev/null | /usr/bin && local && printf
+		'quoted text' awk 'quoted text'
+	"$1" test -eu local export export echo $(pwd) printf $(pwd)
+"$1" "$@" done echo | --verbose -eu -eu echo --verbose 'quoted text' && printf
+		printf 'quoted text' done && --verbose
+		| cd export test done awk test
+'quoted text' "$1" echo sed cd export test readonly export awk
+		'quoted text' -eu test then
+	2>/dev/null export "$1" | "$1"
+x=1 done "$1" grep /usr/bin x=1 grep readonly
+${HOME} local 2>/dev/null test
+&& && --verbose x=1 /usr/bin echo x=1 "$@" ${HOME}
+		echo readonly done cd "$@" done cd ${HOME} cd export
+	printf printf "$1" && "$@" test readonly readonly
+x=1 echo /usr/bin | && awk test $(pwd) "$1" readonly
+		${HOME} 2>/dev/null printf test /usr/bin export "$@" sed "$1"
+| readonly /usr/bin $(pwd) done "$1" ${HOME} done done echo done ${HOME}
+awk test "$1" x=1 then sed /usr/bin "$@" sed x=1 ${HOME} $(pwd) $(pwd)
+-eu readonly echo grep | readonly export
+		grep echo x=1 "$@" "$1" 2>/dev/null grep
+then /usr/bin awk done test ${HOME} && then "$@"
+		${HOME} 'quoted text' printf then awk | awk
+echo && "$1" "$@" awk "$@" -eu $(pwd) echo printf
+	then test | then readonly export readonly 'quoted text'
+	done done printf /usr/bin
+	--verbose 'quoted text' echo then then echo test printf && $(pwd) awk echo sed
+	printf then "$@" readonly x=1 then --verbose printf ${HOME} && awk local
+	$(pwd) ${HOME} printf grep --verbose /usr/bin
+		grep 'quoted text' | -eu
+	readonly -eu grep -eu echo done printf x=1 'quoted text' grep sed
+		then x=1 --verbose ${HOME} readonly 'quoted text'
+	$(pwd) 2>/dev/null test echo 'quoted text'
+		${HOME} ${HOME} && sed sed sed "$@" &&
+	/usr/bin then local export
+	&& sed $(pwd) printf grep "$1" 2>/dev/null
+		'quoted text' 'quoted text' --verbose -eu | local && export
+	$(pwd) local export | && export 'quoted text' echo
+cd -eu test export then 2>/dev/null echo awk
+cd export sed sed /usr/bin --verbose /usr/bin readonly test --verbose cd local
+local --verbose local cd sed | | --verbose then grep printf "$@" export | ${HOME}
+	&& x=1 'quoted text' readonly echo ${HOME} --verbose
+		cd "$1" 2>/dev/null $(pwd) 'quoted text'
+&& cd then sed 'quoted text'
+${HOME} export "$1" 2>/dev/null
+"$1" printf printf sed $(pwd) local
+	"$1" "$@" 2>/dev/null ${HOME} local local 2>/dev/null 2>/dev/null
+	&& done "$@" 'quoted text' 2>/dev/null
+		sed x=1 echo "$@" 2>/dev/null export awk echo printf && grep
+	grep --verbose 'quoted text' ${HOME} cd then
+--verbose /usr/bin x=1 2>/dev/null export /usr/bin && 2>/dev/null x=1
+		/usr/bin export readonly $(pwd) awk then | sed export "$@" test /usr/bin
+grep export echo --verbose awk -eu | then local 2>/dev/null
+		done then && grep test grep -eu echo ${HOME} -eu awk "$1" export local "$@" readonly
+	done x=1 grep --verbose sed
+local --verbose readonly
+	--verbose local local local awk sed export export /usr/bin printf grep $(pwd)
+		sed | --verbose cd printf printf local --verbose ${HOME} echo 2>/dev/null
+		"$1" test readonly grep && printf "$1" cd -eu
+test grep sed 'quoted text' awk && local
+	sed 2>/dev/null --verbose 2>/dev/null "$@" done 2>/dev/null
+	done echo 'quoted text' echo local
+		-eu ${HOME} test "$1" -eu grep echo echo grep awk
+	${HOME} echo then grep -eu export printf -eu test && then /usr/bin
+	grep "$1" echo export readonly sed ${HOME}
+		done /usr/bin cd $(pwd) sed done cd readonly x=1 printf
+$(pwd) && /usr/bin grep printf done --verbose /usr/bin echo "$1" awk printf
+printf sed | printf x=1 echo
+		export "$@" test 2>/dev/null | /usr/bin /usr/bin 2>/dev/null
+test printf then local export "$1" -eu
+	"$@" echo test "$1" done readonly grep | local echo --verbose /usr/bin
+done echo cd ${HOME} && cd 'quoted text' export
+"$1" echo "$1" then "$1" /usr/bin && 2>/dev/null awk 'quoted text' | &&
+	'quoted text' echo x=1 echo cd test grep test
+		${HOME} local cd done -eu | | readonly echo --verbose printf -eu "$1" cd awk
+		| | ${HOME} | readonly export local
+		then export sed --verbose "$1" printf
+&& x=1 --verbose 2>/dev/null grep x=1 /usr/bin 'quoted text'
+${HOME} then export --verbose "$1" 'quoted text' done
+	| sed echo echo done -eu local $(pwd) readonly "$@" printf
+		"$@" echo -eu cd grep test test local $(pwd) ${HOME} then awk --verbose
+	$(pwd) local awk ${HOME} "$@" printf $(pwd) 'quoted text' | 2>/dev/null |
+'quoted text' | "$@" /usr/bin test then awk local
+		export test ${HOME} local x=1 test printf --verbose awk export
+		x=1 'quoted text' ${HOME} && /usr/bin printf --verbose readonly
+	echo echo awk test "$@" readonly 'quoted text' then 'quoted text' | "$1" && 2>/dev/null
+'quoted text' then export cd
+		then sed awk grep 'quoted text' "$@" then local
+2>/dev/null --verbose | 2>/dev/null "$@" "$1" 'quoted text' --verbose
+then $(pwd) /usr/bin 'quoted text' printf
+	"$1" x=1 2>/dev/null then readonly /usr/bin
+-eu test export sed --verbose export $(pwd) test ${HOME} "$1"
+cd -eu $(pwd) | $(pwd) echo grep then
+		test test printf 2>/dev/null sed awk /usr/bin test --verbose ${HOME}
+	done done ${HOME} sed | awk export cd -eu
+cd awk done x=1 readonly --verbose
+		x=1 && "$1" x=1 && && then ${HOME} grep readonly
+x=1 export /usr/bin && test /usr/bin awk grep awk
+/usr/bin readonly --verbose | test local grep sed done --verbose
+	&& && local x=1 grep test 2>/dev/null then readonly
+	"$@" done export test 'quoted text' test grep test test
+		| && grep x=1 sed "$1" printf && echo 'quoted text' test printf readonly "$1"
+		grep && printf readonly 2>/dev/null cd
+	2>/dev/null then | sed 2>/dev/null
+		sed done | readonly && grep printf local
+&& "$1" 2>/dev/null x=1
+	local 2>/dev/null printf sed readonly 'quoted text' x=1 grep echo | 'quoted text'
+		2>/dev/null "$@" readonly
+then sed $(pwd) test test "$@" local awk -eu ${HOME} x=1 done readonly
+		test awk "$@" test readonly "$1" then export export cd 2>/dev/null awk
+printf echo -eu echo && 2>/dev/null && sed 'quoted text' done 'quoted text'
+		done "$1" "$1" $(pwd) printf export done 'quoted text' && awk then done awk
+printf sed done export -eu
+"$1" | readonly && awk --verbose export
+		"$@" --verbose $(pwd) 'quoted text'
+sed cd sed $(pwd) then awk | /usr/bin 'quoted text'
+x=1 2>/dev/null | export then readonly
+		awk -eu export export then -eu "$@" printf awk -eu x=1 --verbose -eu local
+readonly "$@" 'quoted text'
+awk readonly 'quoted text' "$@" awk awk echo echo 2>/dev/null ${HOME} -eu 2>/dev/null
+	test $(pwd) x=1 /usr/bin sed grep | 'quoted text'
+		echo cd ${HOME} ${HOME} printf sed "$1" --verbose $(pwd) "$@" grep "$1"
+		&& test export && $(pwd) 2>/dev/null
+"$@" ${HOME} --verbose &&
+		--verbose printf 2>/dev/null
+${HOME} test done | -eu cd
+x=1 --verbose ${HOME} $(pwd) readonly && $(pwd)
+		readonly x=1 | cd grep | ${HOME} | local awk ${HOME} && cd
+awk x=1 && readonly "$@" "$1"
+-eu done done cd /usr/bin sed && test "$@" "$@" --verbose
+${HOME} /usr/bin --verbose export
+	export --verbose ${HOME} | 'quoted text' --verbose "$1" then test
+		2>/dev/null readonly cd
+readonly && export ${HOME} awk
+echo sed printf echo then x=1 export | && then /usr/bin && then
+	grep "$@" then | 'quoted text' x=1 "$@" sed | "$1" "$@" readonly test test $(pwd)
+	then x=1 grep $(pwd) awk $(pwd) --verbose
+	| ${HOME} done cd test test echo cd printf sed test "$@" 2>/dev/null
+	${HOME} /usr/bin cd "$@" echo
+		x=1 2>/dev/null done export cd
+"$1" then "$@" "$1" local ${HOME} -eu cd -eu /usr/bin $(pwd) awk
+	done /usr/bin -eu readonly printf grep
+local sed export "$1"
+"$@" test --verbose then "$@" /usr/bin printf grep local "$1" cd ${HOME}
+	/usr/bin local cd sed && x=1
+then done sed /usr/bin local "$@" printf x=1 --verbose printf printf
+	cd -eu "$1" /usr/bin x=1 | awk awk done
+	echo printf echo --verbose printf ${HOME} echo x=1 local readonly test x=1 2>/dev/null
+	x=1 done ${HOME} awk test readonly printf cd done x=1 readonly x=1 /usr/bin cd
+	'quoted text' --verbose 2>/dev/null printf
+${HOME} "$1" $(pwd) x=1 test cd sed | ${HOME} sed && ${HOME}
+	readonly readonly "$1" test 2>/dev/null cd grep readonly "$1" $(pwd)
+		local export "$@" grep
+printf export 2>/dev/null export "$1" -eu && readonly | 2>/dev/null x=1 2>/dev/null
+	$(pwd) | grep grep -eu readonly ${HOME} x=1
+readonly -eu done $(pwd)
+		--verbose x=1 "$1" 2>/dev/null "$@" ${HOME}
+grep -eu readonly "$1" export 2>/dev/null /usr/bin readonly
+cd sed --verbose local ${HOME} $(pwd) echo "$@" $(pwd) $(pwd)
+		then 'quoted text' awk echo && printf readonly sed 'quoted text' local
+--verbose --verbose cd readonly | 2>/dev/null
+| x=1 export local $(pwd) && "$@" then echo export
+		test export awk && awk export echo
+		grep then cd $(pwd) && 'quoted text'
+| done echo 2>/dev/null grep awk local 'quoted text' local printf grep
+	export echo test ${HOME} awk
+		2>/dev/null done ${HOME} printf "$@" echo done export $(pwd) | grep grep
+	"$1" printf x=1 && ${HOME} -eu
+		printf readonly "$1" sed printf
+echo test cd sed export
+sed 2>/dev/null test /usr/bin
+	--verbose 'quoted text' echo grep
+		readonly test "$@" --verbose
+	cd -eu export x=1 -eu then printf then export grep --verbose cd echo /usr/bin
+		local readonly printf local local "$1"
+	cd export printf sed "$@" 'quoted text' local awk 'quoted text' | local awk sed
+done $(pwd) 'quoted text' sed test ${HOME} sed x=1 export "$1" "$@" 'quoted text'
+printf export "$@" test local sed 'quoted text' echo readonly
+		readonly printf x=1 /usr/bin export "$1"
+printf awk local $(pwd) 'quoted text'
+		$(pwd) test cd "$@" sed test local -eu then $(pwd) ${HOME} 2>/dev/null
+	done x=1 x=1 'quoted text' $(pwd) "$1" 2>/dev/null
+	$(pwd) grep ${HOME} /usr/bin awk 2>/dev/null
+awk cd readonly cd then echo "$1" && local "$1" $(pwd) export readonly awk local
+		"$@" export 'quoted text' "$1" local export local echo "$@"
+		&& readonly "$@" grep cd test "$@"
+"$@" "$1" export cd 2>/dev/null local printf "$1" 2>/dev/null readonly &&
+	done then && | printf && $(pwd)
+	${HOME} done 2>/dev/null "$1" done echo /usr/bin "$@" 2>/dev/null
+	local ${HOME} awk "$1" export export test then awk 'quoted text' printf
+printf | then test --verbose x=1 cd export "$@" -eu test readonly
+		export 2>/dev/null echo 2>/dev/null local x=1
+2>/dev/null echo sed "$1" | cd grep awk "$1" readonly | /usr/bin
+grep && 'quoted text' && /usr/bin export sed sed readonly 'quoted text'
+		${HOME} export printf printf && then /usr/bin x=1 -eu echo
+		${HOME} test printf | export /usr/bin $(pwd) local echo ${HOME} sed x=1 grep
+$(pwd) x=1 && test awk then echo then --verbose --verbose && /usr/bin && sed
+	| sed printf local test readonly cd echo && --verbose
+		"$@" cd echo --verbose "$1" 2>/dev/null
+		echo readonly awk done cd printf test "$@" "$1" 2>/dev/null cd | awk sed
+echo x=1 'quoted text' x=1 done && sed "$1" test "$@" test echo done
+"$1" local "$@" --verbose /usr/bin 2>/dev/null &&
+-eu export | --verbose "$1" printf test grep $(pwd) sed awk
+	sed awk local x=1 $(pwd) readonly
+		&& then && export test
+$(pwd) cd "$1" local 'quoted text'
+'quoted text' /usr/bin echo
+	/usr/bin --verbose echo done
+	-eu test 2>/dev/null "$1" done then local sed ${HOME} 2>/dev/null | cd printf ${HOME}
+test ${HOME} "$@" printf export -eu test
+	2>/dev/null awk echo test readonly grep sed x=1 "$@" export x=1 local --verbose
+	echo "$@" x=1 test test 'quoted text' then x=1 test done $(pwd) && then printf
+then local test ${HOME} ${HOME} && local export 2>/dev/null done grep
+		export local 'quoted text' -eu | local sed grep 'quoted text' "$@" readonly
+		$(pwd) $(pwd) 'quoted text' local
+	echo | local /usr/bin x=1 local "$@" test "$@" cd && printf && printf
+		printf then export | readonly
+		"$@" export done test done echo "$1" awk sed /usr/bin "$1" sed
+		"$@" done printf cd done awk "$@" "$@" then local sed then printf $(pwd) grep
+		echo -eu $(pwd) readonly
+		/usr/bin grep | cd "$1" echo test /usr/bin
+	awk && ${HOME} | export local sed cd 'quoted text'
+	2>/dev/null sed | 2>/dev/null
+		${HOME} 'quoted text' "$@" --verbose | "$@" "$@" x=1 /usr/bin done test x=1 sed
+	done 'quoted text' done printf "$1" readonly $(pwd) /usr/bin local
+	done then | | cd $(pwd) x=1 /usr/bin -eu -eu 'quoted text'
+	printf local then export "$@" && && "$@" local local cd && done
+	grep cd local 'quoted text'
+	test printf "$@" awk x=1
+	export cd | export && local
+		echo x=1 grep cd 'quoted text' test ${HOME} --verbose local cd export
+		$(pwd) /usr/bin $(pwd) test -eu printf x=1 test ${HOME} $(pwd) done
+	export local ${HOME} && awk "$1" 'quoted text' grep $(pwd) -eu awk
+sed local /usr/bin && sed local local done $(pwd) done --verbose
+grep $(pwd) x=1 awk --verbose
+		grep grep local then sed /usr/bin sed local readonly
+/usr/bin x=1 | /usr/bin printf /usr/bin -eu ${HOME} ${HOME} --verbose
+done cd -eu /usr/bin --verbose test | sed sed printf
+		/usr/bin grep -eu readonly then | /usr/bin x=1 2>/dev/null 2>/dev/null
+	$(pwd) 'quoted text' -eu echo grep cd 2>/dev/null export x=1 2>/dev/null 2>/dev/null
+		-eu export sed cd grep sed grep 'quoted text'
+		local local test cd echo 'quoted text'
+test x=1 then local $(pwd)
+		cd x=1 grep "$1" "$@"
+&& local grep 'quoted text' test 2>/dev/null sed then
+awk readonly 2>/dev/null cd -eu --verbose export
+		-eu "$1" -eu awk && 'quoted text'
+	done printf "$1" test 'quoted text' 'quoted text'
+export --verbose -eu grep echo awk done export export "$1"
+'quoted text' $(pwd) ${HOME} | -eu "$1" done &&
+	then && $(pwd) "$@" awk 2>/dev/null --verbose
+		x=1 readonly x=1 ${HOME} | test -eu | 2>/dev/null $(pwd) readonly printf
+-eu readonly "$1" ${HOME} then x=1 test export --verbose
+		export --verbose "$1" "$@" ${HOME} local | export 'quoted text' "$1" readonly
+'quoted text' export 'quoted text' echo 2>/dev/null echo --verbose readonly
+	grep awk -eu -eu "$@" 'quoted text' local $(pwd) readonly
+		printf cd cd echo && cd 'quoted text'
+		printf 'quoted text' "$1" ${HOME} -eu $(pwd) then sed
+		test "$1" /usr/bin "$@" echo | ${HOME} printf local | awk 2>/dev/null 'quoted text'
+	/usr/bin readonly ${HOME} sed x=1
+	"$@" cd awk readonly && ${HOME} "$@" cd 'quoted text' echo printf
+readonly echo 'quoted text' $(pwd) done && local &&
+	cd local export export "$@" done 'quoted text' -eu local /usr/bin
+		local sed 2>/dev/null ${HOME} done printf | "$@"
+$(pwd) grep sed grep $(pwd) sed cd --verbose
+		"$1" echo -eu cd grep test 2>/dev/null echo 'quoted text'
+2>/dev/null cd "$1" -eu awk 'quoted text'
+	x=1 then echo echo | then local export readonly sed local "$@"
+	2>/dev/null 2>/dev/null && 2>/dev/null 'quoted text' /usr/bin
+/usr/bin echo | x=1 awk readonly printf && local local -eu test printf
+then export 2>/dev/null ${HOME} /usr/bin
+export printf cd $(pwd) export awk echo awk 2>/dev/null
+	test grep awk --verbose echo printf test 'quoted text' $(pwd)
+		-eu | printf sed export awk sed test 'quoted text' done --verbose
+		printf cd export awk 2>/dev/null readonly x=1 ${HOME} && then printf
+done cd cd echo && ${HOME}
+-eu test export readonly | done 'quoted text' printf cd
+	cd 2>/dev/null --verbose cd readonly -eu
+	sed | export done readonly echo "$1" --verbose export "$1"
+"$1" | local sed && local echo && printf --verbose local /usr/bin
+		${HOME} /usr/bin test 'quoted text' cd sed awk readonly --verbose "$1"
+		-eu && readonly 'quoted text' sed | cd
+		"$1" x=1 test && test | test sed ${HOME} export $(pwd) $(pwd)
+		done $(pwd) then "$@" 'quoted text' cd export cd test printf 'quoted text' local
+		grep then $(pwd) && printf 'quoted text'
+		$(pwd) | then && printf "$@" awk ${HOME} echo printf | ${HOME} 2>/dev/null
+	2>/dev/null local && echo printf --verbose readonly 2>/dev/null "$@"
+	"$1" test --verbose grep
+	printf grep | ${HOME} --verbose 'quoted text'
+printf cd 'quoted text' "$1" awk 2>/dev/null echo done export done $(pwd) 2>/dev/null
+'quoted text' local cd && /usr/bin -eu "$1" /usr/bin && echo
+		"$@" x=1 awk cd /usr/bin "$@" x=1 export sed printf
+		"$@" grep "$1" | done /usr/bin x=1 local sed ${HOME} 2>/dev/null test
+	grep 2>/dev/null $(pwd) --verbose
+echo printf echo | "$@" && local local cd /usr/bin cd sed
+	"$1" echo done then "$1" then
+	then $(pwd) "$@" 'quoted text' && 'quoted text'
+		awk readonly export "$1" 2>/dev/null "$@" awk then x=1
+	test printf export ${HOME}
+		readonly test local local | | "$@" 'quoted text' printf grep printf -eu
+		-eu readonly awk -eu local 'quoted text'
+	grep export /usr/bin export local 2>/dev/null
+	"$@" --verbose && grep done sed && local $(pwd) x=1 /usr/bin
+	$(pwd) /usr/bin | -eu "$@"
+	readonly done then awk --verbose
+		test cd test local then awk printf
+test echo x=1 done printf /usr/bin -eu 2>/dev/null && | "$@" sed --verbose
+		done | local $(pwd) /usr/bin awk grep 2>/dev/null awk local 'quoted text'
+		${HOME} printf test awk then sed -eu then cd sed awk
+readonly then readonly ${HOME} | done then 'quoted text' sed --verbose x=1 readonly
+		grep then then 'quoted text' export export /usr/bin | printf sed 'quoted text'
+	x=1 readonly cd /usr/bin then export "$@" x=1 printf sed --verbose "$1"
+	export --verbose && --verbose cd sed awk "$@" readonly /usr/bin
+'quoted text' 'quoted text' readonly awk 'quoted text'
+	then /usr/bin /usr/bin readonly 2>/dev/null export readonly 'quoted text'
+		export x=1 awk then readonly
+	-eu awk cd readonly "$@" "$@" test $(pwd) && grep echo export /usr/bin
+'quoted text' printf done echo export printf readonly
+	"$1" "$@" echo done x=1 grep awk $(pwd) --verbose
+"$@" && printf -eu "$@" x=1 "$@" echo printf sed
+awk then awk --verbose ${HOME} awk -eu grep 2>/dev/null
+	then printf && sed $(pwd) printf
+		cd cd && ${HOME} ${HOME}
+	done then -eu then test done
+		-eu | && x=1 local done echo /usr/bin $(pwd) | test grep && readonly
+sed --verbose $(pwd) printf /usr/bin /usr/bin echo export ${HOME}
+2>/dev/null awk grep awk x=1 test x=1 | -eu then sed grep
+		cd awk printf readonly | ${HOME} done
+&& ${HOME} /usr/bin done | readonly "$1"
+		export --verbose $(pwd)
+		x=1 echo --verbose awk
+	| --verbose /usr/bin -eu local
+		&& 2>/dev/null -eu "$@" -eu test local then test $(pwd) ${HOME}
+sed /usr/bin "$@" && && 'quoted text' -eu 2>/dev/null
+	x=1 local grep local local "$@" echo cd x=1
+		x=1 "$1" | echo test local
+/usr/bin && $(pwd) "$@" "$1" 'quoted text'
+		cd grep x=1 --verbose ${HOME} "$1" --verbose x=1 awk
+		cd grep awk test local test && --verbose cd && test awk
+	done readonly echo done awk cd x=1 /usr/bin && "$@" local
+local done && "$1" x=1 readonly printf && --verbose
+	$(pwd) cd -eu local && grep -eu grep "$1" x=1 ${HOME} awk awk
+then "$@" sed $(pwd) echo
+	"$1" --verbose 2>/dev/null -eu "$1" "$1" --verbose | "$1" | 'quoted text'
+&& 'quoted text' readonly -eu readonly
+local echo ${HOME} export local "$@" $(pwd) "$@" then
+		-eu cd echo test local cd ${HOME} 'quoted text' then echo cd
+2>/dev/null 'quoted text' awk sed /usr/bin ${HOME} 2>/dev/null
+	-eu -eu /usr/bin cd then --verbose "$1"
+	$(pwd) && readonly | done 'quoted text' grep "$@" && done "$1"
+	cd then && awk "$@" | local && 'quoted text' readonly
+		printf awk test "$@" ${HOME} awk awk "$1" /usr/bin local echo
+		x=1 readonly grep "$1"
+awk --verbose -eu 2>/dev/null grep awk "$@" done -eu local "$@" test --verbose
+	then printf printf --verbose && printf echo /usr/bin 'quoted text' --verbose
+	local "$1" printf cd 'quoted text' local test awk cd "$1" /usr/bin
+	readonly sed /usr/bin cd export sed $(pwd) && grep done "$@"
+		test readonly local "$@" done
+awk grep -eu test -eu x=1 export test awk grep
+		export local "$1" 'quoted text' "$@" test "$@" awk $(pwd) then $(pwd)
+sed -eu "$1" export sed export 'quoted text' sed
+		x=1 --verbose "$@" echo $(pwd) grep /usr/bin
+		| $(pwd) sed ${HOME} done then /usr/bin
+	"$1" cd | $(pwd) readonly printf grep cd && && sed &&
+		then echo "$@" awk 'quoted text' awk && awk 'quoted text' "$@" $(pwd)
+/usr/bin "$1" then then awk cd "$1"
+		export x=1 | grep done cd local ${HOME} && sed awk && | ${HOME} grep
+	export 2>/dev/null 'quoted text' test sed grep
+2>/dev/null cd echo --verbose then | | echo echo | test | x=1
+		done test "$1" printf export | done done awk
+	done grep "$@" 'quoted text' printf echo
+		${HOME} 'quoted text' 'quoted text' x=1 readonly readonly
+/usr/bin | echo export 'quoted text' test
+"$@" sed then --verbose cd printf "$1" readonly echo printf x=1 done ${HOME} sed
+		/usr/bin 2>/dev/null readonly
+then | 'quoted text' echo readonly "$1" printf printf
+"$@" -eu $(pwd) /usr/bin then ${HOME}
+test && ${HOME} $(pwd) then $(pwd)
+	export test --verbose printf printf
+		done sed && x=1 printf 2>/dev/null /usr/bin
+	"$1" | | -eu export x=1 "$@" | "$@" 'quoted text'
+	awk $(pwd) /usr/bin then 'quoted text' ${HOME} | | | $(pwd)
+printf "$@" && sed local grep | awk echo 2>/dev/null readonly
+&& -eu readonly "$@" echo grep ${HOME} grep done
+		export ${HOME} echo "$@" local -eu
+export x=1 2>/dev/null --verbose "$1" sed test x=1 | printf test
+		/usr/bin "$1" sed | -eu done | awk | test grep sed | readonly
+	'quoted text' local x=1 echo awk $(pwd) -eu 2>/dev/null
+local then grep local "$1" x=1 | | grep grep ${HOME}
+	${HOME} done 'quoted text' readonly --verbose "$1" done readonly "$@" awk -eu --verbose
+	test | awk --verbose test "$@"
+printf /usr/bin -eu readonly then ${HOME} /usr/bin then /usr/bin ${HOME}
+	done grep cd 2>/dev/null cd ${HOME} local test echo /usr/bin test
+	$(pwd) x=1 local -eu $(pwd) ${HOME} | done done "$1" done test && local done
+	then 'quoted text' printf 'quoted text' && /usr/bin x=1 awk "$1" x=1 sed echo
+		2>/dev/null awk echo test
+		'quoted text' --verbose 'quoted text' "$1" grep --verbose "$1" "$@"
+2>/dev/null cd --verbose 2>/dev/null printf $(pwd) done
+awk then sed 2>/dev/null "$1"
+		"$1" ${HOME} cd local local |
+		awk test test sed grep x=1 readonly local --verbose
+| echo && && echo ${HOME} ${HOME} cd test then export grep
+sed | readonly then cd | /usr/bin test ${HOME} echo "$1"
+	local export -eu local printf test 2>/dev/null test 'quoted text'
+		awk "$1" -eu cd echo local $(pwd) then awk test -eu then local ${HOME} readonly
+		test cd -eu /usr/bin $(pwd) awk export 'quoted text'
+		"$@" awk readonly 'quoted text'
+	&& && "$@" then then --verbose then sed "$1" x=1 $(pwd) sed local $(pwd) && --verbose
+	readonly echo local $(pwd) sed ${HOME}
+		grep readonly ${HOME} 2>/dev/null then --verbose sed | x=1 $(pwd) -eu | export
+		readonly printf | test test
@@ -0,0 +1,2001 @@
+	done printf test 2>/dev/null 2>/dev/null $(pwd) "$1"
+		x=1 'quoted text' $(pwd) echo awk "$1" /usr/bin local $(pwd) done
+	export test awk | -eu -eu -eu
+		/usr/bin --verbose done test 2>/dev/null ${HOME}
+		--verbose readonly $(pwd) echo test test awk local cd awk awk
+awk done $(pwd) -eu --verbose /usr/bin test ${HOME} grep readonly
+	cd ${HOME} then done then cd ${HOME} 'quoted text' 2>/dev/null done --verbose
+		echo echo && 'quoted text'
+awk then --verbose echo "$@" sed then readonly -eu export 2>/dev/null
+		then | 'quoted text' local -eu test then && cd x=1 2>/dev/null
+		x=1 --verbose "$@" local test export done echo sed
+	${HOME} sed && /usr/bin then awk "$@" -eu 2>/dev/null
+	2>/dev/null export --verbose awk sed
+		x=1 "$1" then 'quoted text'
+	-eu then test "$@" sed -eu && -eu sed sed export /usr/bin 2>/dev/null | grep
+		"$@" "$@" readonly awk done | "$1" test grep then 'quoted text'
+	--verbose 'quoted text'
+cd | grep cd x=1 grep "$@" 'quoted text' "$1" sed cd --verbose done $(pwd)
+echo -eu echo local cd echo x=1 awk test
+		then test "$1" | readonly --verbose
+--verbose readonly grep
+	local test && "$1" readonly 'quoted text' sed awk
+	echo readonly cd sed grep printf x=1 local test
+	| cd -eu done readonly ${HOME} && | readonly readonly -eu cd x=1 echo x=1
+--verbose printf cd grep
+		cd export "$1" cd 2>/dev/null awk echo
+test 2>/dev/null /usr/bin
+		&& "$@" echo && -eu export printf test "$@" -eu grep "$@"
+		| then local export 2>/dev/null printf $(pwd) printf export export && ${HOME}
+${HOME} local local sed awk && sed -eu then readonly awk awk grep grep --verbose
+	x=1 -eu --verbose -eu local 2>/dev/null -eu awk grep awk --verbose
+	grep awk readonly echo cd grep --verbose $(pwd)
+		--verbose done "$@" 'quoted text' $(pwd) /usr/bin echo 'quoted text' awk "$@"
+sed "$1" done 2>/dev/null test done done | then 2>/dev/null then awk &&
+	awk ${HOME} --verbose | readonly local -eu 2>/dev/null x=1 export printf
+awk local "$1" --verbose --verbose awk test 'quoted text' grep awk --verbose
+	&& 2>/dev/null x=1 echo local export 2>/dev/null ${HOME}
+	export cd then readonly echo "$@" /usr/bin | local test
+done 'quoted text' && then -eu "$1" ${HOME} printf local
+	sed x=1 local "$@" --verbose /usr/bin printf --verbose
+		&& cd "$@" -eu sed awk /usr/bin test $(pwd) --verbose
+		'quoted text' echo test export --verbose 'quoted text' local | awk test --verbose
+$(pwd) then grep 'quoted text' cd export ${HOME} $(pwd)
+	| --verbose 2>/dev/null ${HOME} readonly printf $(pwd) export
+	done -eu awk export test sed test
+		done local | $(pwd) ${HOME} test test done grep echo 2>/dev/null readonly &&
+		then cd sed sed ${HOME} "$1" ${HOME} printf
+		awk 'quoted text' "$@" readonly
+/usr/bin then test "$@" then "$@" done sed --verbose sed "$1" 'quoted text'
+		x=1 grep grep x=1 --verbose test "$1" grep readonly
+"$@" --verbose /usr/bin
+grep echo 2>/dev/null "$@" 'quoted text'
+		then printf x=1 cd "$1"
+	${HOME} done grep "$@" --verbose cd
+	awk | ${HOME} then 2>/dev/null /usr/bin &&
+sed sed ${HOME} 'quoted text' ${HOME} --verbose cd "$@" ${HOME}
+		sed test grep local export printf then then
+	grep "$1" printf sed && -eu
+	--verbose "$1" x=1 | sed test
+readonly printf "$@" && /usr/bin grep && grep sed && then sed --verbose 2>/dev/null
+export readonly sed export
+		| local echo done sed ${HOME} readonly then | 'quoted text' printf && then
+	echo ${HOME} then --verbose
+x=1 "$@" ${HOME} $(pwd) then 2>/dev/null 'quoted text' &&
+'quoted text' readonly "$@" readonly then && grep awk 2>/dev/null grep echo /usr/bin
+		sed printf -eu readonly $(pwd) test sed ${HOME} readonly
+| $(pwd) test "$@" | grep --verbose
+"$1" sed echo | && | -eu ${HOME} ${HOME}
+		cd 2>/dev/null export local grep local
+--verbose test 'quoted text' && printf ${HOME} grep "$@" $(pwd) x=1 then $(pwd)
+local x=1 && grep | done && local && "$@" $(pwd) "$@" && "$@"
+	"$@" readonly /usr/bin
+test echo local ${HOME} awk --verbose printf
+export grep x=1 --verbose | x=1 readonly ${HOME} -eu
+	&& 2>/dev/null "$1" | -eu done cd x=1 sed | export /usr/bin
+		/usr/bin x=1 ${HOME} test grep cd done grep ${HOME} -eu /usr/bin echo /usr/bin
+&& /usr/bin $(pwd) ${HOME} sed export sed 'quoted text' readonly --verbose
+	test done --verbose "$@" /usr/bin "$@" 2>/dev/null sed cd 'quoted text'
+	then awk export echo done "$1" echo ${HOME} done
+--verbose "$1" then done "$@" done echo -eu -eu
+echo echo ${HOME} ${HOME} -eu sed then --verbose "$1" 2>/dev/null
+/usr/bin export grep "$@" ${HOME} "$@" --verbose
+		"$@" | "$@" printf -eu
+		cd 'quoted text' -eu && && echo --verbose done --verbose export "$1" "$@"
+done grep export sed cd &&
+local test local 'quoted text' cd export ${HOME} cd /usr/bin grep
+export 2>/dev/null ${HOME} /usr/bin
+/usr/bin export ${HOME} | done test export export readonly then -eu done
+awk local 2>/dev/null readonly printf "$@" export
+		x=1 -eu then awk "$@" grep printf -eu 2>/dev/null "$1" | local local 2>/dev/null
+grep cd -eu "$@" cd -eu --verbose && $(pwd)
+done test readonly x=1 local printf echo then --verbose 2>/dev/null
+	local $(pwd) /usr/bin echo test -eu && $(pwd) "$1" done 'quoted text'
+cd sed local 2>/dev/null test --verbose local grep then
+	2>/dev/null awk export | /usr/bin --verbose && then && export echo test
+	2>/dev/null export -eu | 2>/dev/null | | /usr/bin readonly
+echo grep -eu | | 2>/dev/null done 2>/dev/null $(pwd) /usr/bin local
+	grep readonly /usr/bin cd $(pwd) "$1"
+	done test awk grep test 'quoted text' done ${HOME} -eu export /usr/bin "$@" -eu
+		sed sed 'quoted text' test 2>/dev/null awk sed "$@" | "$@" --verbose echo cd local
+$(pwd) 2>/dev/null export
+		local sed export sed echo 2>/dev/null "$1"
+	cd echo done --verbose x=1
+		echo -eu done test export $(pwd) export echo local /usr/bin |
+readonly /usr/bin cd then done /usr/bin
+	grep cd cd "$@" awk x=1 awk | x=1 sed "$1" /usr/bin && cd --verbose
+		readonly printf -eu export readonly "$@" done $(pwd) && awk
+	grep awk /usr/bin /usr/bin grep test "$@"
+		/usr/bin sed x=1 $(pwd) "$@" | local export done local export 2>/dev/null $(pwd)
+/usr/bin --verbose echo | 'quoted text' -eu && "$@" done | local echo "$@"
+	cd cd x=1 "$1" grep printf sed 'quoted text'
+"$1" then awk local ${HOME}
+		readonly -eu --verbose "$1" test
+cd done readonly done test then sed $(pwd) then cd printf x=1
+-eu done then grep -eu test
+local local 'quoted text' readonly then
+		"$@" && && cd ${HOME} /usr/bin
+	printf | | export /usr/bin --verbose x=1 then awk "$1" echo
+		$(pwd) printf /usr/bin readonly | | sed sed /usr/bin
+		cd grep readonly /usr/bin "$1" awk --verbose
+	echo awk then 'quoted text' "$@" export cd -eu echo $(pwd) /usr/bin grep
+		then /usr/bin x=1 'quoted text' "$@" $(pwd) -eu
+		"$1" x=1 awk printf sed printf export echo x=1 then
+		/usr/bin awk test echo done 'quoted text'
+	echo --verbose 'quoted text' "$1" /usr/bin grep /usr/bin "$@" printf test awk
+test sed awk printf /usr/bin echo grep "$1" $(pwd) test | "$@" echo 2>/dev/null
+		$(pwd) 'quoted text' "$@" 2>/dev/null 2>/dev/null echo
+	cd --verbose readonly
+		| x=1 awk export done ${HOME} grep $(pwd) $(pwd)
+'quoted text' export -eu "$@" 2>/dev/null --verbose
+		then x=1 2>/dev/null echo then 2>/dev/null export --verbose
+	done /usr/bin readonly awk readonly local printf "$@" readonly 'quoted text'
+	export test export awk echo 'quoted text' sed 2>/dev/null
+		| awk readonly ${HOME} grep && local "$@" test done done cd
+	printf then x=1 2>/dev/null
+	2>/dev/null printf cd "$1" then echo 2>/dev/null | cd -eu grep then
+		${HOME} 2>/dev/null test awk $(pwd) test echo
+		'quoted text' export done 'quoted text' export echo
+	readonly cd awk printf done && grep "$1"
+	/usr/bin export sed echo printf printf /usr/bin
+	echo && readonly sed test
+	'quoted text' printf test --verbose printf then $(pwd) then awk
+	test /usr/bin cd && "$@" sed | export $(pwd) | then local
+		/usr/bin --verbose echo sed ${HOME}
+		grep local then "$1" done 2>/dev/null
+	printf "$1" readonly printf --verbose printf 'quoted text' grep grep awk test
+--verbose 2>/dev/null then readonly | export then $(pwd) "$@" then echo $(pwd)
+grep then done x=1 then x=1 printf
+&& grep x=1 awk ${HOME} --verbose -eu ${HOME}
+	grep local readonly printf grep printf x=1 'quoted text' | done cd printf
+	${HOME} done | grep --verbose $(pwd)
+		done done sed readonly then then ${HOME} &&
+	printf cd 'quoted text' | local x=1
+		&& ${HOME} done readonly echo printf test && x=1 grep ${HOME} done
+		awk echo then grep ${HOME} $(pwd) readonly --verbose export 2>/dev/null
+"$1" done -eu && printf echo sed x=1 grep export sed echo 'quoted text'
+	cd --verbose && echo -eu sed done readonly cd local $(pwd) done
+	"$@" 2>/dev/null 'quoted text'
+	&& "$@" 2>/dev/null done export readonly "$@" ${HOME}
+sed $(pwd) cd /usr/bin readonly test
+		&& done then 'quoted text' --verbose export cd export local x=1 "$1" grep
+then echo "$1" 2>/dev/null printf 'quoted text'
+		"$@" readonly test done 'quoted text' /usr/bin echo
+'quoted text' awk | export | --verbose 2>/dev/null done | test test export readonly
+		${HOME} "$@" 'quoted text' local grep x=1 printf $(pwd) /usr/bin sed ${HOME}
+		&& && "$1" cd cd printf done | readonly "$1" && 2>/dev/null then ${HOME} local
+	export awk ${HOME} ${HOME} --verbose && cd 2>/dev/null && --verbose 2>/dev/null
+		x=1 "$1" /usr/bin awk && --verbose export 2>/dev/null /usr/bin local readonly
+	done $(pwd) cd -eu $(pwd)
+	"$@" /usr/bin 'quoted text' /usr/bin echo done
+		"$1" && | $(pwd) cd then awk done /usr/bin x=1
+		"$1" -eu awk 2>/dev/null
+		2>/dev/null && /usr/bin done && export 'quoted text' /usr/bin
+-eu printf cd echo grep "$@" 'quoted text' then then x=1 --verbose
+		x=1 grep && 2>/dev/null grep sed grep readonly | "$1" x=1 'quoted text'
+	then 2>/dev/null --verbose $(pwd) awk awk
+	"$1" echo readonly sed x=1 awk $(pwd) --verbose then done --verbose -eu export
+	"$1" /usr/bin test x=1 /usr/bin 2>/dev/null ${HOME}
+		local x=1 done x=1 readonly --verbose $(pwd)
+	test grep ${HOME} test x=1 echo sed export export && ${HOME} cd echo
+		readonly done test cd printf "$1" && -eu grep "$1" readonly echo then /usr/bin
+	--verbose done export cd "$1"
+		test | then x=1 done x=1 then "$@" export local 'quoted text'
+		grep $(pwd) $(pwd) cd && | export -eu local 2>/dev/null
+		sed cd --verbose sed echo | --verbose local
+/usr/bin ${HOME} "$1" echo x=1 done
+sed export x=1 'quoted text' 2>/dev/null test --verbose 'quoted text' 'quoted text'
+		echo --verbose 2>/dev/null done grep
+		'quoted text' 'quoted text' readonly readonly readonly
+export done --verbose ${HOME} x=1 local "$@" 'quoted text' &&
+		"$@" printf 2>/dev/null $(pwd) --verbose
+2>/dev/null printf printf 2>/dev/null sed echo ${HOME} 'quoted text' "$@" -eu
+	$(pwd) local sed test ${HOME} sed local 2>/dev/null then ${HOME} 'quoted text'
+cd 2>/dev/null grep awk grep -eu readonly
+--verbose x=1 ${HOME} export test done "$@" $(pwd) $(pwd) "$1"
+readonly echo x=1 $(pwd) readonly /usr/bin sed export export -eu && "$@"
+		x=1 then readonly ${HOME} --verbose readonly && echo "$1" 'quoted text'
+| then x=1 | -eu 2>/dev/null local 'quoted text'
+	&& x=1 "$@" $(pwd) -eu
+	${HOME} && /usr/bin done then | sed $(pwd) -eu -eu "$@" then
+		2>/dev/null printf readonly | export done "$@" printf grep export local cd
+"$@" x=1 $(pwd) echo $(pwd) awk --verbose "$@" printf "$1" then | x=1
+	sed test x=1 && done | test printf --verbose
+	| "$@" local $(pwd) awk readonly local $(pwd) "$1" test "$1"
+		2>/dev/null test printf export x=1 export
+		local awk printf --verbose "$@" && grep 'quoted text'
+	"$1" printf && --verbose 'quoted text' export awk "$1"
+	&& export sed local done cd cd done /usr/bin
+	export /usr/bin then -eu done awk done awk -eu sed $(pwd) done test
+		${HOME} printf ${HOME} -eu export $(pwd) -eu cd "$@" "$@" "$@" export "$@"
+	done local done | "$@" "$1" readonly
+		echo ${HOME} awk grep ${HOME} printf "$@" x=1 | sed
+	test sed sed cd done printf awk "$1" readonly
+printf then readonly && export readonly
+done $(pwd) /usr/bin && -eu -eu /usr/bin export "$@" x=1 -eu
+	sed grep readonly sed $(pwd) awk -eu "$1" 'quoted text' awk
+"$@" then x=1 grep && && --verbose awk readonly &&
+		echo && x=1 | export "$1" cd readonly -eu export "$@" x=1 cd sed /usr/bin |
+		x=1 cd 2>/dev/null sed printf 2>/dev/null 'quoted text' "$@" |
+		'quoted text' 2>/dev/null ${HOME} /usr/bin
+cd sed grep done 'quoted text' grep
+	test 2>/dev/null sed awk
+'quoted text' sed | test test $(pwd)
+	then awk export "$@" export ${HOME} /usr/bin awk export ${HOME} printf --verbose
+		x=1 /usr/bin x=1 | then printf printf
+		echo printf printf sed /usr/bin done then
+		grep sed readonly echo then
+	'quoted text' grep done $(pwd) echo "$1" done awk ${HOME} $(pwd)
+		-eu ${HOME} echo x=1 done && && readonly && done
+	sed done | $(pwd) then && printf /usr/bin printf && /usr/bin
+	then test "$@" done 2>/dev/null
+| printf readonly | test
+	$(pwd) readonly --verbose
+		| export x=1 --verbose printf && 'quoted text' echo
+printf x=1 ${HOME} awk sed | 'quoted text' -eu | x=1 printf
+${HOME} /usr/bin ${HOME} | 'quoted text' --verbose
+	$(pwd) | sed export ${HOME}
+		"$1" "$@" && done awk printf test then cd sed
+	local sed printf $(pwd) ${HOME} local x=1 /usr/bin cd 'quoted text' 2>/dev/null
+	echo done done local && | 'quoted text' 'quoted text'
+	sed && "$@" $(pwd) && 2>/dev/null /usr/bin awk readonly
+	$(pwd) local then && 2>/dev/null && && test echo "$1" readonly
+sed x=1 local grep ${HOME} readonly
+awk grep sed 'quoted text' -eu &&
+	&& 'quoted text' awk ${HOME} "$@" ${HOME} readonly "$@"
+		2>/dev/null 'quoted text' && test then && cd printf export 'quoted text'
+		/usr/bin x=1 /usr/bin ${HOME} grep ${HOME}
+		&& x=1 "$@" local sed sed ${HOME} 2>/dev/null then
+		local 2>/dev/null echo readonly then /usr/bin
+		$(pwd) done $(pwd) awk done printf echo 'quoted text'
+		"$@" export "$@" echo 'quoted text' "$1" test sed
+${HOME} /usr/bin 'quoted text' readonly readonly 2>/dev/null $(pwd) $(pwd) &&
+		local echo sed "$1" then test test ${HOME}
+${HOME} printf | -eu awk && printf export 2>/dev/null "$1" | test
+	"$1" | export -eu grep 2>/dev/null
+x=1 readonly printf 2>/dev/null export sed
+		grep awk "$@" readonly test sed awk local $(pwd) echo ${HOME}
+		printf ${HOME} 'quoted text'
+		echo grep 'quoted text' x=1 export
+'quoted text' $(pwd) sed 2>/dev/null printf readonly then awk
+		${HOME} awk printf cd printf echo readonly
+sed printf "$1" test && test readonly /usr/bin
+test sed $(pwd) export |
+		test cd "$1" sed done /usr/bin awk "$1" readonly grep 'quoted text' $(pwd)
+"$@" ${HOME} then && | x=1 x=1 awk && x=1 export printf $(pwd) cd "$@" sed "$1"
+	${HOME} echo test "$@" cd done | echo cd "$@" printf ${HOME}
+readonly then ${HOME} local local | && ${HOME} $(pwd) export sed readonly
+		done echo "$1" awk | | readonly echo then 'quoted text'
+		sed grep 2>/dev/null cd -eu --verbose printf 2>/dev/null export 'quoted text'
+		cd done x=1 --verbose local done "$1" sed export sed local then export
+	export x=1 printf then -eu cd
+		then readonly ${HOME} cd 2>/dev/null x=1 readonly awk && done /usr/bin grep
+	grep printf "$@" awk | done x=1 ${HOME} $(pwd)
+		${HOME} printf | x=1 "$1" 2>/dev/null test
+	sed done then x=1 cd | | && "$1" $(pwd) "$1" export done export awk x=1 printf
+"$@" "$@" export sed "$1" "$1" --verbose cd /usr/bin --verbose awk cd
+then x=1 sed awk "$@" 2>/dev/null | -eu -eu x=1 --verbose echo $(pwd) 2>/dev/null
+echo local export 2>/dev/null sed && 2>/dev/null /usr/bin -eu test -eu echo
+"$@" x=1 "$1" "$1" local export &&
+2>/dev/null cd | $(pwd) local
+then --verbose --verbose /usr/bin
+	then 'quoted text' x=1 then "$@" ${HOME}
+		done x=1 awk readonly ${HOME} local
+	printf sed ${HOME} then sed
+		grep printf local then -eu ${HOME} test | echo $(pwd) grep /usr/bin 2>/dev/null
+	grep 'quoted text' grep
+		x=1 -eu 2>/dev/null awk /usr/bin ${HOME} export
+| && export local awk grep | -eu local then
+		export sed /usr/bin 2>/dev/null readonly
+2>/dev/null --verbose ${HOME}
+		cd echo --verbose --verbose x=1
+--verbose cd x=1 && done "$1" | echo | local test grep test local
+grep "$1" readonly awk printf x=1 local awk
+		/usr/bin 2>/dev/null then --verbose -eu awk "$@" && done && --verbose readonly
+"$@" --verbose export cd | "$1" 'quoted text'
+		done 2>/dev/null "$1" cd awk sed $(pwd) 'quoted text' 'quoted text'
+2>/dev/null awk /usr/bin local --verbose x=1 test
+	done | awk awk $(pwd) local printf grep done cd --verbose && "$1" | $(pwd)
+		awk test sed grep $(pwd) "$1" 2>/dev/null echo then export test &&
+done echo x=1 test /usr/bin awk --verbose cd done 'quoted text'
+		$(pwd) export && ${HOME} readonly "$1" then
+		"$1" --verbose $(pwd) cd cd test sed
+then sed ${HOME} 'quoted text' && then 2>/dev/null x=1 sed done /usr/bin
+		grep -eu 'quoted text' --verbose
+		awk x=1 awk awk export readonly
+done sed /usr/bin 2>/dev/null && $(pwd) cd then /usr/bin
+2>/dev/null | "$@" 'quoted text' sed echo --verbose 'quoted text' $(pwd) test
+		/usr/bin ${HOME} awk 2>/dev/null sed cd $(pwd) && export
+/usr/bin 2>/dev/null 'quoted text'
+		done export awk local sed readonly "$@" --verbose ${HOME}
+		cd $(pwd) 'quoted text' 'quoted text' "$@"
+readonly "$@" x=1 export 2>/dev/null cd test "$1" x=1
+-eu x=1 grep export ${HOME} local readonly x=1 'quoted text' 'quoted text'
+awk --verbose cd 2>/dev/null then grep
+	export printf done done test cd /usr/bin x=1 done "$1" ${HOME} printf test test
+		$(pwd) --verbose echo sed done --verbose
+${HOME} | | done 'quoted text' /usr/bin grep $(pwd) /usr/bin then |
+${HOME} echo export | ${HOME} "$@" | x=1 then 'quoted text' "$@" $(pwd)
+	-eu /usr/bin 'quoted text' then done
+done "$1" readonly awk export x=1 "$1" sed echo 'quoted text'
+/usr/bin readonly readonly 2>/dev/null
+	readonly printf export 'quoted text'
+	printf awk ${HOME} 'quoted text' awk 'quoted text' 'quoted text' "$@"
+"$1" && ${HOME} awk --verbose sed $(pwd) ${HOME} echo $(pwd) sed test 'quoted text'
+	export 2>/dev/null "$@" grep grep readonly
+		2>/dev/null grep 'quoted text' readonly "$1" cd | 'quoted text' -eu then "$@"
+cd local sed echo readonly /usr/bin | 2>/dev/null ${HOME}
+		echo echo sed printf test
+	printf local --verbose --verbose awk && grep done $(pwd) cd echo done test cd 2>/dev/null
+	awk printf export readonly awk ${HOME} readonly /usr/bin
+		export "$1" 'quoted text' cd readonly
+	${HOME} export $(pwd) 2>/dev/null then
+		test | done ${HOME} --verbose "$@" $(pwd) /usr/bin
+		export sed /usr/bin "$1" test then done test ${HOME} -eu grep --verbose
+	--verbose 'quoted text' x=1 test then done --verbose $(pwd) x=1
+x=1 then 2>/dev/null done
+		&& awk /usr/bin x=1 "$@" test cd &&
+		&& 2>/dev/null && cd ${HOME} awk local
+		awk 'quoted text' /usr/bin "$@" "$1"
+	done x=1 cd $(pwd) echo -eu printf then "$@" export echo grep
+	awk test && local 'quoted text' echo x=1 printf
+		2>/dev/null $(pwd) 'quoted text'
+	local readonly --verbose /usr/bin grep ${HOME} | x=1
+then readonly done awk local | ${HOME} --verbose
+	x=1 "$@" x=1 -eu cd "$@" ${HOME}
+/usr/bin x=1 awk done x=1 'quoted text' sed
+	-eu printf awk && cd then cd x=1 --verbose -eu "$1" sed cd 'quoted text' awk
+	${HOME} test printf "$1" | "$1" x=1 ${HOME} export test --verbose x=1
+sed $(pwd) x=1 /usr/bin awk -eu 2>/dev/null done --verbose
+	"$@" --verbose then awk echo printf
+	/usr/bin --verbose /usr/bin -eu "$1" grep 2>/dev/null -eu done grep
+		&& printf "$@" | /usr/bin
+	2>/dev/null --verbose grep "$@" $(pwd) cd && test printf test
+		&& sed x=1 export test x=1 test "$1" "$1" $(pwd)
+${HOME} awk x=1 cd echo
+	awk export then echo 'quoted text'
+-eu printf test cd /usr/bin ${HOME} done && ${HOME} sed readonly
+		x=1 'quoted text' sed readonly $(pwd) sed grep echo grep echo
+	--verbose 'quoted text' local done --verbose echo
+"$1" $(pwd) ${HOME} 'quoted text' --verbose
+	echo /usr/bin "$@" $(pwd) readonly readonly
+/usr/bin -eu cd x=1 2>/dev/null ${HOME} done 2>/dev/null
+	"$@" cd && done readonly && printf "$1" ${HOME} $(pwd) x=1 |
+	grep readonly ${HOME} x=1 --verbose
+awk ${HOME} cd done awk export awk cd echo 2>/dev/null "$1" $(pwd) grep
+export grep sed 2>/dev/null "$@" ${HOME}
+	--verbose 'quoted text' --verbose /usr/bin
+then ${HOME} echo grep $(pwd) local -eu printf grep
+	$(pwd) /usr/bin test 2>/dev/null -eu test "$@" grep
+	x=1 | done | echo sed awk 2>/dev/null awk then /usr/bin
+		cd --verbose cd awk grep done cd --verbose
+	export printf printf local "$@" echo printf
+	--verbose then -eu done readonly -eu $(pwd) cd grep | done |
+	readonly sed ${HOME} --verbose readonly "$@" awk 2>/dev/null printf
+2>/dev/null -eu -eu test export
+		awk printf export 2>/dev/null && local awk && "$1" 2>/dev/null
+		readonly done --verbose -eu && "$@" x=1 grep echo "$@" grep x=1
+	'quoted text' /usr/bin -eu 'quoted text' local sed
+2>/dev/null sed /usr/bin
+		done "$1" x=1 --verbose local
+printf export 'quoted text' --verbose cd
+		| then --verbose | "$@" done echo
+awk echo awk then -eu --verbose
+	| local done 2>/dev/null && -eu /usr/bin
+	sed && 2>/dev/null "$@" cd test local sed cd test local then "$@" ${HOME}
+	/usr/bin | local test then 2>/dev/null readonly "$@" export then readonly
+	test | awk -eu "$1" 2>/dev/null "$@" && awk
+	$(pwd) sed awk done test local test $(pwd) grep local $(pwd) awk printf awk
+	export local ${HOME} 'quoted text' then done 2>/dev/null ${HOME} ${HOME}
+		export /usr/bin 2>/dev/null | local $(pwd)
+	then grep | sed x=1 export x=1 "$1" -eu cd && awk sed --verbose grep grep &&
+		test export && grep test 2>/dev/null readonly readonly
+	then then "$@" echo 'quoted text' $(pwd)
+		"$1" "$@" 2>/dev/null | "$@" awk export then test awk printf x=1
+&& 'quoted text' 2>/dev/null
+	done printf $(pwd) | $(pwd) -eu ${HOME} "$@" 2>/dev/null
+${HOME} cd local sed echo x=1
+		grep done x=1 && export local readonly printf readonly 'quoted text'
+'quoted text' -eu "$@" sed awk export sed 'quoted text'
+awk echo awk -eu export cd readonly /usr/bin test ${HOME} readonly
+	sed sed --verbose && export
+		printf "$@" /usr/bin 2>/dev/null &&
+done grep x=1 /usr/bin --verbose
+"$1" done readonly local echo grep ${HOME} cd | then && ${HOME} |
+	'quoted text' $(pwd) then
+--verbose "$1" cd "$1" "$1" 2>/dev/null
+		awk "$1" 'quoted text' "$@" awk ${HOME} echo --verbose 'quoted text'
+local sed x=1 then ${HOME} /usr/bin $(pwd) ${HOME} awk | 2>/dev/null x=1 sed x=1
+		/usr/bin "$@" -eu --verbose ${HOME} 2>/dev/null /usr/bin 'quoted text'
+	${HOME} grep grep /usr/bin x=1 x=1 | then 'quoted text' sed
+		'quoted text' --verbose export ${HOME} && | awk echo then printf
+	cd export | awk | 'quoted text' export cd done then then printf readonly done
+	cd then echo awk export "$@" "$@" 2>/dev/null printf 'quoted text'
+		"$1" ${HOME} && export "$1" echo
+		echo awk --verbose done /usr/bin export $(pwd)
+sed readonly export cd export readonly awk /usr/bin
+sed "$1" readonly echo | 2>/dev/null local then
+		"$@" printf printf printf awk
+grep ${HOME} readonly x=1 printf "$1" $(pwd) 'quoted text' && export
+export awk printf /usr/bin test test | awk && sed
+	"$1" then sed 2>/dev/null test
+-eu sed ${HOME} -eu $(pwd) echo local $(pwd) --verbose then /usr/bin
+	'quoted text' done "$1" -eu echo export printf readonly x=1 2>/dev/null printf
+echo "$1" cd sed then export "$1" && export /usr/bin && then grep export readonly
+	done | test "$1" echo cd awk
+	'quoted text' ${HOME} /usr/bin "$1"
+'quoted text' then readonly "$@" readonly
+x=1 test then 2>/dev/null sed | "$@" export 2>/dev/null /usr/bin /usr/bin
+	&& -eu ${HOME} 2>/dev/null --verbose /usr/bin cd -eu
+then test awk "$@" test export cd echo ${HOME}
+x=1 test | echo -eu --verbose awk printf done
+		x=1 $(pwd) -eu "$@" awk
+	echo grep test export grep sed cd 2>/dev/null
+export echo | export cd 'quoted text' printf done awk then readonly ${HOME}
+	export test --verbose readonly readonly cd echo echo grep 2>/dev/null then 2>/dev/null
+	2>/dev/null done x=1 && echo local local readonly test
+${HOME} 'quoted text' && 2>/dev/null
+		| sed | echo -eu test x=1 /usr/bin
+	cd "$@" export cd ${HOME} && echo test then "$@" ${HOME}
+		cd $(pwd) | done $(pwd) "$1" printf grep then test --verbose
+		2>/dev/null local 2>/dev/null | $(pwd) $(pwd) grep done --verbose
+		test -eu cd 2>/dev/null $(pwd) x=1 ${HOME} $(pwd) export export
+awk awk -eu 2>/dev/null printf $(pwd) cd $(pwd) export then then echo cd cd /usr/bin
+	$(pwd) grep sed sed /usr/bin then $(pwd)
+		awk cd printf printf echo echo export awk export "$@" awk
+	$(pwd) 'quoted text' "$1" sed readonly grep grep grep readonly awk
+		/usr/bin local then && test x=1 && readonly echo local --verbose
+		readonly local && done x=1
+	readonly done done local
+x=1 x=1 --verbose | x=1 local
+	&& 'quoted text' grep "$@" awk ${HOME} export -eu
+	local && x=1 grep ${HOME} local 2>/dev/null
+/usr/bin -eu then then 'quoted text' | printf
+		readonly awk done printf then $(pwd) | echo printf 2>/dev/null
+grep /usr/bin test $(pwd)
+		cd echo done cd 'quoted text' x=1 | $(pwd)
+	--verbose local cd 'quoted text' && sed | && then ${HOME} readonly done sed "$@"
+		"$1" | then $(pwd) cd readonly grep
+		printf then --verbose 'quoted text' $(pwd) awk done sed printf
+2>/dev/null $(pwd) $(pwd) -eu "$@" cd readonly ${HOME}
+grep awk -eu | && cd awk 2>/dev/null x=1 sed --verbose echo "$@"
+	local grep done readonly -eu x=1 local done "$1" && "$1" "$1" /usr/bin
+	/usr/bin then awk "$1" "$1" done awk printf $(pwd) | readonly printf done x=1
+awk | /usr/bin local local 'quoted text' export
+	awk sed 'quoted text' printf
+2>/dev/null $(pwd) 'quoted text'
+&& ${HOME} printf "$1" done $(pwd) --verbose awk "$1" | 'quoted text' test export
+	$(pwd) && && ${HOME} -eu | cd echo | awk done --verbose sed -eu 2>/dev/null ${HOME}
+		echo printf local && then echo grep --verbose
+	grep echo echo local grep | printf export | "$@" 2>/dev/null
+	printf && readonly readonly 'quoted text'
+	grep test grep -eu 'quoted text'
+	awk 2>/dev/null "$@" 2>/dev/null done -eu sed export 2>/dev/null local -eu
+		printf /usr/bin readonly grep -eu ${HOME}
+		--verbose "$@" ${HOME} grep $(pwd) export
+		grep | then --verbose sed 'quoted text' done ${HOME}
+	awk --verbose x=1 grep test | ${HOME} export readonly
+	echo "$@" && x=1 --verbose
+"$@" grep $(pwd) x=1 'quoted text'
+		'quoted text' then grep "$@" "$@" "$@" -eu | then
+		awk then "$@" /usr/bin export | -eu sed | ${HOME} 2>/dev/null echo test readonly
+	| | printf --verbose sed printf
+awk -eu && "$@" $(pwd) "$@" "$@" "$1" sed local export
+		then 'quoted text' "$@" x=1 | | cd $(pwd) then
+	printf x=1 done 'quoted text' printf sed done local awk local --verbose
+done 'quoted text' /usr/bin local readonly grep test x=1
+	done awk | printf "$1" grep --verbose grep
+	${HOME} sed awk -eu 2>/dev/null 'quoted text'
+--verbose x=1 2>/dev/null grep 2>/dev/null x=1 grep x=1 -eu local x=1 -eu
+	done sed | "$1" ${HOME} && "$@" cd 2>/dev/null
+echo --verbose | readonly -eu
+		readonly "$1" local 'quoted text' echo then
+	printf test x=1 awk --verbose 'quoted text' sed then printf local -eu echo | | 'quoted text'
+	grep printf x=1 --verbose echo /usr/bin sed local x=1
+	awk -eu --verbose "$1" test export -eu sed 'quoted text' |
+$(pwd) then -eu local | echo && /usr/bin $(pwd)
+		export 'quoted text' echo
+		&& echo 2>/dev/null done done "$1" && /usr/bin && &&
+local cd 2>/dev/null readonly --verbose 'quoted text'
+		&& echo 'quoted text' && done "$1" echo awk
+		cd "$@" readonly /usr/bin then && ${HOME} export export
+sed done export echo -eu /usr/bin local /usr/bin awk awk grep
+"$1" 2>/dev/null awk --verbose done printf | readonly sed then
+sed ${HOME} /usr/bin local local cd && done printf
+	sed $(pwd) -eu printf 2>/dev/null done ${HOME} done && "$1" && 'quoted text'
+${HOME} printf sed local /usr/bin 2>/dev/null done --verbose echo printf
+		"$@" x=1 local --verbose
+2>/dev/null $(pwd) cd "$@" done export "$1" "$@" "$1" grep 2>/dev/null
+		readonly test done /usr/bin local
+	/usr/bin test "$1" readonly
+	test && awk "$@" printf "$@" --verbose | ${HOME} | test $(pwd) && awk /usr/bin sed
+		export export test 'quoted text' | "$1"
+	echo sed readonly test 2>/dev/null 2>/dev/null export
+	-eu /usr/bin export ${HOME}
+	x=1 done awk printf x=1 ${HOME} | && x=1 && grep -eu
+		cd then cd sed readonly
+		printf export x=1 awk --verbose x=1 sed cd | ${HOME}
+		awk printf ${HOME} sed
+${HOME} local --verbose echo "$1" local
+	done then done export export 'quoted text' then printf
+/usr/bin grep done readonly echo 'quoted text' ${HOME} -eu "$@"
+		grep printf | readonly x=1 | awk && 2>/dev/null
+		cd export cd local awk export readonly done printf test && test
+	'quoted text' sed local readonly $(pwd) $(pwd) echo | awk echo
+		&& --verbose $(pwd) -eu echo | | readonly
+		'quoted text' test grep echo grep then /usr/bin "$@" echo export echo
+	"$@" export $(pwd) 'quoted text' -eu then echo
+	sed then sed done done --verbose local printf | readonly done cd done
+		x=1 grep "$1" /usr/bin | $(pwd) awk readonly /usr/bin
+	-eu readonly -eu x=1 done local then awk cd
+	awk test --verbose then
+	grep export done printf test $(pwd) /usr/bin
+		export "$1" grep printf $(pwd) grep "$1" "$@" sed test awk ${HOME} -eu "$@"
+		sed sed cd $(pwd) 2>/dev/null
+		printf "$1" sed cd then -eu $(pwd)
+	export 'quoted text' grep --verbose | x=1 'quoted text'
+		"$1" printf | echo | /usr/bin 'quoted text'
+		--verbose test grep | 'quoted text' export
+readonly then echo grep $(pwd) readonly readonly grep printf sed awk 2>/dev/null
+x=1 readonly && "$@" export cd echo ${HOME} | 'quoted text'
+	&& test && local /usr/bin test x=1 "$@" "$1" awk "$@" -eu export
+	awk && cd x=1 /usr/bin then "$1" | then printf | then
+		awk && awk /usr/bin ${HOME} /usr/bin
+cd | then -eu x=1 | echo local &&
+		-eu && local echo sed "$@" cd "$@" export done cd printf awk local
+	then echo grep && 'quoted text' grep | | printf
+	--verbose "$1" --verbose ${HOME} local echo --verbose 2>/dev/null
+		"$@" --verbose && sed awk | grep readonly local cd
+		| --verbose ${HOME} "$1" x=1 test "$1" 'quoted text'
+	test grep local ${HOME}
+	cd cd sed printf -eu local done local --verbose
+	--verbose local "$@" printf ${HOME} /usr/bin printf
+		sed -eu && && sed readonly local awk
+		export $(pwd) export printf
+2>/dev/null readonly | awk "$1" "$1" 2>/dev/null
+readonly echo test echo then &&
+	done ${HOME} sed test -eu sed "$@" "$@" ${HOME}
+"$1" x=1 export --verbose
+&& grep cd -eu sed then export done readonly $(pwd) && then "$1" $(pwd) test
+2>/dev/null $(pwd) "$1" "$@" ${HOME} sed
+		--verbose --verbose --verbose then 2>/dev/null --verbose grep printf "$1"
+	done export local | -eu && local 2>/dev/null readonly test test "$1"
+	test && "$@" local ${HOME} export -eu local local printf
+	| --verbose printf 'quoted text' grep
+		'quoted text' "$@" && sed | /usr/bin local && 2>/dev/null local "$@"
+sed --verbose -eu 2>/dev/null done awk awk && grep printf "$@" awk
+	awk -eu && && -eu awk test local $(pwd) cd readonly /usr/bin
+"$1" /usr/bin 'quoted text' awk done $(pwd) x=1 "$1" "$@" cd
+		export export cd sed ${HOME} 2>/dev/null
+		readonly "$@" local && x=1 then "$@" grep && export "$1" local test readonly
+${HOME} printf x=1 2>/dev/null $(pwd) cd readonly "$@" local test then echo $(pwd)
+		then 2>/dev/null ${HOME} 'quoted text' cd x=1 readonly 2>/dev/null
+		grep -eu echo echo -eu "$@" 'quoted text' grep readonly sed
+		"$1" "$@" printf local /usr/bin 2>/dev/null
+cd echo cd done export sed readonly printf /usr/bin echo printf ${HOME}
+	echo "$1" $(pwd) /usr/bin done awk local "$1" sed
+echo "$1" sed --verbose cd sed
+	printf --verbose sed done -eu awk local grep 'quoted text' then printf "$1" | awk
+done $(pwd) awk 2>/dev/null | $(pwd) sed "$1" &&
+	echo export && local grep awk
+-eu "$@" -eu ${HOME} -eu export grep /usr/bin 'quoted text' export
+/usr/bin cd done $(pwd) x=1 grep printf -eu test -eu awk local
+&& grep grep --verbose "$1" printf readonly && "$1" sed then
+	x=1 sed then ${HOME} readonly sed -eu $(pwd) awk sed | | echo
+		cd && "$1" --verbose --verbose "$1" 2>/dev/null | then printf
+		--verbose grep --verbose
+printf awk ${HOME} "$1" echo then 2>/dev/null /usr/bin 'quoted text' readonly
+awk then && x=1 cd "$1" printf readonly local printf | printf | --verbose
+	done then test done done -eu
+	${HOME} "$@" x=1 done --verbose local | then ${HOME}
+2>/dev/null $(pwd) export $(pwd) local awk && then 'quoted text'
+	then && grep x=1 /usr/bin cd printf ${HOME} "$1" /usr/bin
+	"$1" ${HOME} && grep --verbose
+sed readonly 2>/dev/null "$@" export readonly
+	then local $(pwd) && /usr/bin "$@" "$@" test cd $(pwd)
+readonly printf local printf
+awk printf readonly && done "$@" test 'quoted text' "$@" --verbose
+		${HOME} awk sed "$1" printf cd /usr/bin "$@"
+grep done printf local cd printf 'quoted text' printf 2>/dev/null
+test readonly local export test --verbose x=1 2>/dev/null /usr/bin
+	"$1" /usr/bin test readonly readonly export 2>/dev/null readonly /usr/bin export
+		readonly 2>/dev/null "$@" test x=1 | 'quoted text' -eu done export
+echo $(pwd) /usr/bin grep -eu $(pwd) $(pwd) sed cd "$@" done -eu ${HOME} readonly
+awk echo --verbose export | printf $(pwd) ${HOME} then test --verbose cd
+	$(pwd) $(pwd) --verbose export
+	sed /usr/bin cd readonly readonly grep
+		echo $(pwd) echo x=1 then then 'quoted text' printf grep && done ${HOME}
+		awk && && --verbose 'quoted text'
+		-eu /usr/bin | 2>/dev/null
+printf grep x=1 sed printf
+		&& grep done "$@" -eu /usr/bin
+		awk && "$@" awk printf /usr/bin
+	${HOME} sed -eu /usr/bin local -eu -eu -eu done | 'quoted text' "$@"
+sed then printf local "$1" ${HOME} grep cd export
+sed $(pwd) --verbose && x=1 sed
+		"$1" 2>/dev/null cd sed readonly test 2>/dev/null
+		readonly x=1 | printf /usr/bin awk printf echo
+${HOME} local --verbose --verbose done "$1" "$@" --verbose
+	&& 'quoted text' export &&
+		"$@" awk "$1" -eu ${HOME} cd 2>/dev/null
+	printf && grep echo | grep done local printf && /usr/bin awk -eu
+	awk $(pwd) /usr/bin 'quoted text'
+test local | then echo echo && -eu done readonly
+export ${HOME} printf -eu test printf
+	2>/dev/null $(pwd) local grep echo sed awk awk
+local "$1" export "$1" && printf readonly grep export ${HOME} --verbose
+		-eu ${HOME} ${HOME} "$@"
+		then "$1" awk awk cd --verbose "$1" echo
+		echo ${HOME} /usr/bin -eu awk readonly readonly 2>/dev/null "$@" 'quoted text'
+	| export echo && 2>/dev/null /usr/bin
+cd 2>/dev/null 2>/dev/null -eu && -eu | -eu export done "$1" readonly
+"$@" "$@" sed cd then /usr/bin 'quoted text' && then local export local local
+| ${HOME} export printf 2>/dev/null
+		"$1" local echo test ${HOME} echo local --verbose
+	export && "$1" "$1" printf local cd
+sed $(pwd) /usr/bin "$@" export $(pwd) done x=1 2>/dev/null "$@" readonly -eu test
+| | x=1 printf grep export echo && printf | $(pwd)
+		| export export | $(pwd) x=1 cd x=1 readonly /usr/bin 'quoted text'
+grep printf export echo awk
+cd echo echo x=1 -eu then $(pwd) ${HOME}
+		done | "$@" printf -eu /usr/bin "$1" export "$1" test done
+		--verbose test -eu cd 'quoted text' sed "$1" $(pwd) export done "$1" grep 2>/dev/null
+$(pwd) --verbose && && ${HOME} 'quoted text'
+		'quoted text' | readonly export "$@" then ${HOME} echo ${HOME}
+		$(pwd) "$@" -eu x=1 | /usr/bin
+	/usr/bin ${HOME} grep | local $(pwd) 'quoted text' | x=1 ${HOME} 'quoted text'
+	"$@" echo "$1" awk echo "$1" -eu 'quoted text'
+	"$1" printf ${HOME} sed --verbose printf readonly
+		echo export readonly sed readonly | local /usr/bin sed "$1" echo
+	x=1 | 'quoted text' sed export && x=1 cd readonly
+-eu done test "$1" export echo | printf && export cd then
+		$(pwd) awk echo 'quoted text'
+	local x=1 awk /usr/bin test then cd sed --verbose "$@" $(pwd)
+		| x=1 grep done done awk /usr/bin "$1" 2>/dev/null sed --verbose echo
+		'quoted text' awk test 2>/dev/null && grep then $(pwd) echo && &&
+&& -eu done export ${HOME} -eu /usr/bin 2>/dev/null grep
+	cd grep test "$1" done /usr/bin sed readonly test "$@" done --verbose
+		done "$@" readonly printf local sed then x=1 export awk cd && 'quoted text'
+		echo 2>/dev/null | 2>/dev/null "$1" sed done x=1 sed
+	$(pwd) --verbose printf export done echo cd
+	"$1" && grep local /usr/bin
+&& awk grep x=1 readonly then 'quoted text' done then then awk "$@" ${HOME}
+grep echo $(pwd) 2>/dev/null then cd awk
+then local sed "$1" 'quoted text' 2>/dev/null
+$(pwd) | echo x=1 awk 'quoted text' readonly --verbose | 2>/dev/null
+done local then cd 2>/dev/null local "$@" grep grep
+		'quoted text' awk grep $(pwd) awk "$1" cd 'quoted text' done export
+cd echo awk grep readonly
+		awk local 'quoted text' ${HOME} sed "$1" $(pwd)
+"$1" export x=1 "$1" | awk ${HOME} awk sed /usr/bin --verbose export echo
+done $(pwd) $(pwd) echo printf --verbose sed awk 2>/dev/null /usr/bin x=1 x=1
+		'quoted text' 'quoted text' cd sed then -eu echo 2>/dev/null grep
+	"$1" | ${HOME} | awk 2>/dev/null
+	2>/dev/null done cd /usr/bin x=1 $(pwd) $(pwd) export 2>/dev/null "$1"
+/usr/bin test local --verbose
+${HOME} --verbose 'quoted text'
+		sed 'quoted text' local -eu && 'quoted text' done
+		readonly ${HOME} export local
+		x=1 /usr/bin cd ${HOME} 2>/dev/null readonly -eu -eu
+	/usr/bin --verbose local 2>/dev/null ${HOME} -eu cd then $(pwd) printf
+	${HOME} done export x=1 /usr/bin cd $(pwd) /usr/bin echo 'quoted text'
+then then --verbose x=1 done local sed done test awk "$1"
+	| printf 'quoted text' -eu | ${HOME}
+	awk -eu -eu printf /usr/bin "$1" readonly then done
+		awk local "$@" test --verbose $(pwd) readonly ${HOME} cd $(pwd) --verbose
+	grep export test 'quoted text' local
+--verbose readonly then cd readonly "$1"
+	printf "$1" grep done | cd export "$@" sed export printf sed 2>/dev/null
+	"$1" | cd sed then readonly local -eu && test 2>/dev/null
+		printf $(pwd) test "$1" 'quoted text' | "$@" "$@" "$1"
+		grep readonly export | awk then grep 2>/dev/null ${HOME} done | 'quoted text' |
+		&& && --verbose "$@" ${HOME} then "$1" "$1" awk ${HOME} cd 'quoted text'
+cd 'quoted text' x=1 $(pwd) /usr/bin echo readonly
+	"$1" x=1 "$@" x=1 $(pwd) echo echo readonly awk readonly "$1"
+	then export | awk then then done
+	cd $(pwd) "$1" test echo | --verbose awk "$@"
+	readonly ${HOME} done | export ${HOME}
+		$(pwd) --verbose /usr/bin --verbose x=1 /usr/bin x=1 &&
+		"$1" printf | 2>/dev/null echo done printf
+		2>/dev/null then $(pwd) $(pwd) --verbose "$1" 2>/dev/null 2>/dev/null
+printf then "$1" 'quoted text' --verbose
+'quoted text' 2>/dev/null local x=1 ${HOME} readonly
+${HOME} 'quoted text'
+	${HOME} && "$@" grep grep done
+	"$1" test cd | then test 'quoted text' /usr/bin
+		cd 'quoted text' echo -eu then
+		local cd echo --verbose test /usr/bin "$1" "$1" sed grep done printf "$@" readonly
+then grep then awk readonly awk export sed "$@" --verbose "$1" -eu test export
+export --verbose done local && "$@" readonly
+		cd printf grep export | "$1" export export export cd |
+/usr/bin "$1" | "$1" 2>/dev/null
+	/usr/bin 'quoted text' then printf
+		cd x=1 "$@" ${HOME} awk printf ${HOME} test awk readonly
+	printf then ${HOME} test "$1" --verbose 2>/dev/null "$@"
+	test 'quoted text' then ${HOME} cd && test $(pwd) echo
+	-eu /usr/bin x=1 echo readonly $(pwd) sed 2>/dev/null awk
+sed $(pwd) readonly local $(pwd) sed --verbose
+	x=1 sed then -eu ${HOME} $(pwd) local -eu &&
+	test /usr/bin | sed "$1" && export export done x=1 2>/dev/null done
+		x=1 $(pwd) 2>/dev/null echo
+		x=1 export printf -eu
+		done done echo "$1" ${HOME} export then readonly awk grep printf ${HOME} then x=1
+		'quoted text' grep x=1 cd local then export "$1" "$1" readonly
+	--verbose "$@" local "$@" sed local --verbose export | "$@" $(pwd)
+		done export export 2>/dev/null
+	done 2>/dev/null $(pwd) |
+| && --verbose cd x=1 | --verbose awk readonly --verbose "$@" ${HOME}
+2>/dev/null then -eu -eu echo test --verbose | 2>/dev/null x=1
+printf $(pwd) -eu --verbose | then $(pwd) done then awk export -eu |
+/usr/bin ${HOME} 'quoted text'
+		then local test export grep 'quoted text' done /usr/bin "$@" cd sed
+&& $(pwd) cd done readonly sed cd sed test
+"$1" grep && readonly /usr/bin awk printf local readonly ${HOME}
+	local grep 'quoted text' awk
+	awk /usr/bin --verbose -eu grep sed sed x=1 local
+	/usr/bin ${HOME} local done | sed
+		"$@" grep "$1" echo "$@" grep printf
+x=1 | x=1 echo /usr/bin
+	grep then 2>/dev/null test /usr/bin "$@" && $(pwd) test | -eu /usr/bin
+		--verbose cd awk export -eu "$@" --verbose awk grep 'quoted text' done |
+	--verbose printf -eu test ${HOME} 'quoted text' printf cd -eu test ${HOME} "$1"
+awk cd export && sed --verbose
+"$@" -eu export x=1 grep $(pwd)
+		awk readonly readonly /usr/bin x=1 grep 2>/dev/null --verbose && | done
+export 'quoted text' sed "$1" "$@" 'quoted text' cd ${HOME} -eu x=1 sed test
+	$(pwd) local then 2>/dev/null done export "$@" 'quoted text'
+		--verbose "$1" -eu 'quoted text'
+	&& ${HOME} --verbose "$@" "$@" 2>/dev/null readonly ${HOME} local done cd
+${HOME} | export | done 'quoted text'
+		$(pwd) readonly -eu awk local then local readonly "$1" export echo grep done
+		"$1" done export | 'quoted text' "$@"
+cd test "$@" 'quoted text' /usr/bin
+		&& echo readonly export then awk --verbose grep ${HOME}
+	local | x=1 /usr/bin && export 'quoted text' ${HOME} && grep readonly done &&
+		| cd /usr/bin local done test 2>/dev/null 2>/dev/null then then &&
+x=1 printf "$1" x=1 ${HOME}
+x=1 2>/dev/null awk readonly done ${HOME} 2>/dev/null
+printf local 2>/dev/null -eu export
+/usr/bin $(pwd) cd grep cd ${HOME} 'quoted text'
+		readonly && sed ${HOME} ${HOME} readonly local && /usr/bin done
+test done then awk && "$@" then sed done then 'quoted text'
+	--verbose 'quoted text' awk ${HOME} export then grep x=1 done
+		echo /usr/bin 'quoted text' readonly export awk test "$1" 'quoted text'
+export test "$@" printf sed export $(pwd) /usr/bin "$@" $(pwd) sed done
+/usr/bin x=1 grep awk /usr/bin echo cd --verbose local then
+-eu x=1 done local sed done "$@" echo "$1" readonly
+	done cd readonly sed --verbose
+	&& --verbose | /usr/bin printf -eu x=1 x=1 --verbose
+/usr/bin test --verbose export
+	echo export sed export | test $(pwd) printf -eu
+		${HOME} awk awk done $(pwd) sed awk /usr/bin --verbose awk readonly
+export 2>/dev/null "$1" local 2>/dev/null 'quoted text' /usr/bin done
+		&& sed local "$@" export 2>/dev/null
+--verbose test /usr/bin test sed 2>/dev/null
+sed awk "$1" export 'quoted text' 'quoted text' echo awk | export --verbose
+		printf printf 'quoted text'
+		2>/dev/null cd cd && test "$1" awk "$@" local cd "$@" printf 'quoted text'
+${HOME} export "$@" cd 2>/dev/null
+awk --verbose -eu ${HOME} done sed ${HOME} grep local
+2>/dev/null sed $(pwd) $(pwd) awk "$1" && -eu 'quoted text' test $(pwd)
+		"$@" readonly && | readonly -eu $(pwd) $(pwd) 2>/dev/null
+then echo echo then /usr/bin sed "$1" printf export 2>/dev/null -eu export
+&& local x=1 x=1 sed sed /usr/bin
+	"$@" local "$@" ${HOME} local
+	cd grep awk ${HOME} 2>/dev/null
+	'quoted text' 2>/dev/null 2>/dev/null then ${HOME} cd cd 2>/dev/null local readonly
+	local 2>/dev/null x=1 | then readonly "$1" ${HOME} echo export --verbose
+	test && awk ${HOME} "$@" done awk readonly -eu cd 'quoted text' echo ${HOME}
+	done x=1 local printf sed cd printf "$@" echo export readonly x=1 x=1 "$@" echo
+	local grep "$@" -eu && 'quoted text' -eu awk readonly
+	readonly --verbose | "$@" "$1" --verbose done cd readonly | -eu awk &&
+		${HOME} cd 2>/dev/null sed cd x=1 test local
+$(pwd) sed 2>/dev/null printf
+done test "$@" awk "$@" ${HOME} ${HOME} -eu /usr/bin
+&& 2>/dev/null $(pwd) test /usr/bin /usr/bin $(pwd) 2>/dev/null cd then readonly
+"$@" grep "$@" "$@" $(pwd) --verbose &&
+'quoted text' export 2>/dev/null /usr/bin export --verbose echo
+		awk cd "$1" && sed readonly
+		/usr/bin $(pwd) grep printf 'quoted text' "$1" 2>/dev/null
+	cd then 2>/dev/null then x=1 export
+	grep ${HOME} export then readonly sed readonly
+	'quoted text' local awk /usr/bin cd done printf | -eu
+	/usr/bin ${HOME} | echo done | /usr/bin then /usr/bin
+		x=1 sed cd awk 2>/dev/null | cd 'quoted text'
+-eu && ${HOME} ${HOME}
+	x=1 --verbose "$1" x=1 'quoted text' printf then 2>/dev/null && -eu
+		local --verbose "$@" --verbose
+	"$1" "$1" then local ${HOME} "$@" echo 2>/dev/null sed grep
+then "$1" | | export echo && local then grep ${HOME} 'quoted text' "$1" printf
+		readonly --verbose local then cd printf | done then grep
+	export export /usr/bin readonly
+sed $(pwd) && readonly
+		grep /usr/bin ${HOME} -eu test
+grep "$1" && printf 2>/dev/null ${HOME} "$@" sed test "$@" --verbose
+	'quoted text' echo ${HOME} | $(pwd) ${HOME} 'quoted text' awk x=1
+	grep grep $(pwd) -eu "$1" then
+	sed && cd "$1" export | 2>/dev/null awk "$@" x=1 "$@" readonly 'quoted text'
+	local export export test grep x=1 printf then local
+--verbose && awk ${HOME} x=1 readonly then awk
+		done cd 2>/dev/null 2>/dev/null awk --verbose --verbose
+		$(pwd) $(pwd) x=1 sed ${HOME} ${HOME} --verbose
+		/usr/bin /usr/bin local cd sed "$1" test
+	local -eu /usr/bin 2>/dev/null export | echo test awk $(pwd) sed local 2>/dev/null
+${HOME} 'quoted text' "$@" "$1" | /usr/bin
+	cd done | test && --verbose done && /usr/bin done grep done 'quoted text' -eu
+		echo -eu ${HOME} then export readonly grep x=1 local test local local x=1
+printf 2>/dev/null ${HOME}
+		done ${HOME} -eu awk local 'quoted text'
+then 'quoted text' test grep --verbose -eu export test local readonly
+		sed awk 2>/dev/null ${HOME} "$1" awk
+	-eu x=1 grep test grep -eu grep "$1" then echo
+		x=1 cd --verbose $(pwd) printf echo
+		-eu export grep ${HOME} awk "$1" then cd /usr/bin test awk
+	echo 'quoted text' ${HOME} sed readonly
+	/usr/bin "$@" 'quoted text' export $(pwd) ${HOME} printf
+	--verbose -eu 'quoted text' 2>/dev/null awk
+	echo "$1" /usr/bin echo "$@" cd 'quoted text' x=1 /usr/bin then
+'quoted text' export --verbose local 2>/dev/null
+		"$@" awk then local $(pwd) grep && sed cd $(pwd) export /usr/bin echo local --verbose
+then local /usr/bin printf 'quoted text'
+		test grep -eu 'quoted text'
+	&& echo $(pwd) done then | $(pwd) sed && cd 2>/dev/null echo "$@"
+	$(pwd) -eu test "$@" readonly sed awk cd local -eu 'quoted text'
+	printf x=1 && && done awk | awk grep readonly done printf && | x=1 test done awk
+done | /usr/bin printf export 2>/dev/null
+	&& | grep sed printf -eu printf then
+'quoted text' -eu local awk &&
+	$(pwd) ${HOME} local 2>/dev/null grep done
+	"$@" | $(pwd) sed /usr/bin $(pwd)
+2>/dev/null x=1 grep /usr/bin done done
+done export "$@" then | "$@" export
+test printf test grep
+printf | | cd $(pwd) local done grep grep test 2>/dev/null
+	"$@" /usr/bin done export "$@" | --verbose -eu --verbose
+	then readonly x=1 sed "$@" "$1" 2>/dev/null ${HOME} cd x=1
+test 'quoted text' ${HOME} x=1 -eu --verbose
+		| /usr/bin test /usr/bin local echo --verbose cd grep done export
+		| readonly $(pwd) awk x=1 2>/dev/null ${HOME} "$@" readonly
+&& done test --verbose test -eu 2>/dev/null
+x=1 "$@" && $(pwd) then | 2>/dev/null "$@" "$@" $(pwd) local
+	readonly done x=1 && awk readonly --verbose x=1 awk
+grep local readonly -eu printf ${HOME} /usr/bin --verbose --verbose
+		"$@" cd ${HOME} --verbose && awk | readonly grep "$@" x=1 "$1" sed local readonly
+		local --verbose grep printf /usr/bin "$@" test 'quoted text' echo then then
+		--verbose --verbose ${HOME} x=1 --verbose
+		&& then -eu && && then then $(pwd) 2>/dev/null test printf 2>/dev/null
+	$(pwd) | echo "$@" test && export then sed awk /usr/bin cd awk grep
+		awk grep echo x=1 done "$@" --verbose export
+test cd -eu && --verbose
+	awk 'quoted text' ${HOME} grep | sed sed then
+--verbose ${HOME} local /usr/bin $(pwd)
+		| 2>/dev/null done x=1 local | /usr/bin 2>/dev/null echo done $(pwd) cd x=1 export
+echo 'quoted text' | cd ${HOME}
+		'quoted text' done "$@" $(pwd) /usr/bin /usr/bin then
+echo grep cd "$1" local | ${HOME} export 'quoted text' test &&
+	echo done printf echo -eu 2>/dev/null /usr/bin /usr/bin
+		printf x=1 x=1 "$1" cd 2>/dev/null
+	echo $(pwd) printf printf "$1" --verbose
+		sed $(pwd) | printf --verbose "$1" "$@" /usr/bin
+sed readonly /usr/bin test /usr/bin "$1" done "$@" 'quoted text' 'quoted text'
+"$@" ${HOME} echo sed sed cd done done x=1
+test x=1 then echo test printf sed grep "$@"
+x=1 'quoted text' -eu "$1" | "$@" | sed sed printf echo
+test readonly sed sed && then | local cd local cd test $(pwd) -eu then 'quoted text'
+	x=1 /usr/bin -eu -eu sed awk ${HOME} cd cd awk echo "$1" sed readonly printf
+awk then | /usr/bin | --verbose printf -eu "$@" ${HOME} x=1 2>/dev/null -eu
+echo "$@" test 2>/dev/null "$1" printf /usr/bin grep 2>/dev/null
+-eu readonly cd test | grep sed --verbose --verbose
+	local sed grep x=1 readonly local printf readonly --verbose | | "$@" -eu
+	"$@" then -eu -eu --verbose
+		then ${HOME} printf awk 'quoted text'
+$(pwd) test readonly 2>/dev/null x=1 export export $(pwd) cd "$1"
+/usr/bin x=1 -eu 2>/dev/null
+x=1 export ${HOME} 2>/dev/null local
+	"$1" then && 'quoted text' local
+	printf 2>/dev/null -eu | readonly && -eu
+then done 2>/dev/null /usr/bin /usr/bin readonly
+		local then && sed /usr/bin printf grep
+grep && cd local grep 'quoted text'
+	cd 2>/dev/null cd done sed cd --verbose then
+		&& done readonly "$@" done "$1" 'quoted text'
+		&& 'quoted text' printf test printf x=1 readonly | local grep /usr/bin
+	awk readonly export local test 'quoted text' done local
+test grep /usr/bin export awk -eu --verbose --verbose local | local readonly
+	'quoted text' 2>/dev/null | | "$@"
+local echo grep awk done grep "$@" x=1 | readonly && done sed awk --verbose
+		local grep test grep $(pwd) local local /usr/bin
+	"$1" done -eu printf sed done cd x=1 export --verbose $(pwd) test
+--verbose awk sed echo local printf
+done 2>/dev/null /usr/bin "$@" test awk "$@" ${HOME} -eu -eu $(pwd)
+sed /usr/bin "$@" then local then ${HOME} "$@" --verbose
+		| $(pwd) awk echo "$1" test -eu test then ${HOME} "$1" grep
+	--verbose readonly && ${HOME} | done test 2>/dev/null
+	2>/dev/null then $(pwd)
+done $(pwd) echo cd local /usr/bin readonly 2>/dev/null readonly then then
+	/usr/bin cd "$@" 'quoted text' then
+'quoted text' export x=1 readonly
+'quoted text' readonly printf awk local readonly 'quoted text' export printf
+	local printf | done ${HOME} awk cd 2>/dev/null done then && "$1" then -eu done
+	done sed ${HOME} 'quoted text' test echo --verbose -eu export
+		'quoted text' "$1" cd -eu awk then cd | awk -eu x=1
+	then "$@" ${HOME} && readonly export
+then "$@" "$1" local printf x=1 awk $(pwd) awk --verbose -eu
+	export 'quoted text' /usr/bin local "$@" --verbose
+	/usr/bin done grep echo 'quoted text' cd | export "$@" grep export grep sed
+		"$1" then -eu readonly && printf | then | readonly "$1" grep
+		| sed 2>/dev/null export export | /usr/bin /usr/bin "$@" /usr/bin
+		then readonly local |
+		-eu then printf awk local awk 2>/dev/null --verbose
+		'quoted text' -eu 2>/dev/null /usr/bin local echo awk "$@" ${HOME} /usr/bin
+export "$1" 'quoted text'
+'quoted text' test "$1" done test test readonly local export
+	awk | local sed readonly x=1 $(pwd) "$1" ${HOME} sed local x=1 /usr/bin sed
+	x=1 local then sed $(pwd) /usr/bin ${HOME} export
+		test readonly grep -eu | "$1" local /usr/bin 'quoted text' sed ${HOME} cd -eu $(pwd)
+	x=1 "$@" "$@" done && -eu /usr/bin cd
+	sed cd ${HOME} | test done
+	2>/dev/null local grep | sed export
+	done then local cd /usr/bin $(pwd) printf grep cd
+	printf && && awk "$@" && cd $(pwd) local | /usr/bin done -eu echo x=1
+	$(pwd) -eu cd sed local /usr/bin "$@" done
+	done test --verbose grep sed $(pwd) x=1 "$@" && then
+	printf 'quoted text' done ${HOME} -eu sed done grep printf
+/usr/bin local "$1" "$@" readonly
+	printf awk grep done done "$@" -eu
+		--verbose local --verbose readonly sed local awk done -eu export $(pwd)
+grep awk -eu readonly export cd local then export done echo -eu
+		test echo test grep $(pwd) cd $(pwd)
+${HOME} grep x=1 -eu -eu
+		sed 'quoted text' $(pwd) | --verbose -eu then printf 'quoted text'
+	| "$@" 'quoted text' && "$1" $(pwd) local test test /usr/bin | echo /usr/bin
+export 'quoted text' grep
+| --verbose | -eu /usr/bin $(pwd) done x=1 printf && "$@" printf awk
+	local "$1" sed cd x=1 -eu && --verbose local cd "$1" awk
+/usr/bin echo x=1 x=1 echo "$@" 'quoted text' sed -eu local --verbose ${HOME}
+	sed printf sed grep "$@" echo grep "$@" test /usr/bin
+		"$1" $(pwd) awk "$1" /usr/bin
+| printf -eu test /usr/bin
+	'quoted text' export awk "$1" "$1" then
+	$(pwd) -eu -eu $(pwd) "$1" -eu $(pwd) /usr/bin cd test /usr/bin done
+	$(pwd) 2>/dev/null done 'quoted text' grep sed
+-eu export | export printf &&
+'quoted text' then cd readonly then done readonly awk /usr/bin $(pwd) echo grep
+		| 'quoted text' sed --verbose cd | printf $(pwd) | done grep
+		echo then $(pwd) sed --verbose x=1
+'quoted text' export cd readonly grep readonly readonly --verbose
+		/usr/bin printf /usr/bin awk done && cd 'quoted text'
+		"$@" cd local echo && done "$@" sed /usr/bin ${HOME} "$1"
+		grep -eu && 'quoted text' grep cd then echo done local done && 2>/dev/null 'quoted text'
+	cd | 2>/dev/null cd x=1 -eu grep cd 'quoted text'
+		sed "$@" grep export done
+		"$@" cd grep then -eu test done 'quoted text' $(pwd) awk cd readonly --verbose
+	${HOME} awk "$1" 'quoted text'
+awk readonly x=1 $(pwd) local export "$@" -eu cd && ${HOME}
+		sed x=1 awk /usr/bin $(pwd) | local grep grep && then
+	&& "$@" /usr/bin sed -eu | local
+		grep | /usr/bin local done local x=1 then
+	${HOME} "$@" "$@" printf "$1" $(pwd) x=1 x=1 then
+export export 2>/dev/null /usr/bin 'quoted text' then 'quoted text'
+		/usr/bin -eu cd grep printf
+	$(pwd) $(pwd) x=1 "$@" -eu echo export
+		&& sed x=1 export "$1" 'quoted text' cd local export "$1" -eu readonly
+	-eu && printf 'quoted text' ${HOME} | --verbose
+		/usr/bin ${HOME} "$@" printf $(pwd) "$1" x=1 | --verbose && x=1 then
+		done && --verbose export
+2>/dev/null -eu done echo ${HOME} "$1" ${HOME} "$1" cd ${HOME} sed
+		'quoted text' readonly then 2>/dev/null x=1 printf |
+		grep $(pwd) "$1" cd -eu 2>/dev/null test printf export -eu | "$1" cd local
+	done done printf test local x=1 /usr/bin cd test printf
+export local test grep "$@" 2>/dev/null cd 'quoted text'
+${HOME} done test cd $(pwd) 2>/dev/null readonly 'quoted text' -eu
+| "$@" $(pwd) done sed | $(pwd) x=1 ${HOME} 2>/dev/null then ${HOME} cd
+		grep $(pwd) grep cd sed /usr/bin test "$@" ${HOME} awk export
+		test 2>/dev/null echo "$1" && test 2>/dev/null /usr/bin 'quoted text'
+		| x=1 2>/dev/null test grep &&
+	local test 2>/dev/null
+	export /usr/bin -eu test cd "$@" readonly export && $(pwd)
+cd x=1 printf cd /usr/bin --verbose
+readonly test printf then grep export /usr/bin then "$@" done x=1 && 'quoted text'
+		awk --verbose 2>/dev/null 2>/dev/null "$@" readonly 'quoted text' awk &&
+#include c90.sh
+		"$@" sed awk /usr/bin ${HOME} echo "$@" awk
+		export echo -eu --verbose 'quoted text' $(pwd) 'quoted text'
+	echo local -eu done "$1" printf $(pwd) $(pwd)
+	export readonly 'quoted text' grep /usr/bin local echo ${HOME} cd
+"$@" x=1 2>/dev/null printf echo echo readonly "$@" awk $(pwd) grep &&
+then local && "$1" "$@" "$1" test "$@" grep && $(pwd) x=1
+		test echo 'quoted text' printf done ${HOME} && x=1 "$1" /usr/bin sed printf
+$(pwd) export readonly "$@" "$@" then awk && grep awk local x=1 /usr/bin
+		--verbose sed "$@" /usr/bin
+		"$1" readonly readonly x=1 2>/dev/null
+test awk printf sed &&
+		| awk /usr/bin --verbose readonly
+		$(pwd) && awk 2>/dev/null cd readonly "$1" printf echo printf && local export "$1"
+	--verbose 2>/dev/null 2>/dev/null cd "$1" readonly | $(pwd) cd done done echo test
+		| ${HOME} --verbose --verbose readonly awk | "$1" "$1" printf
+grep && export --verbose grep | cd export cd printf readonly
+		test --verbose local 2>/dev/null
+		x=1 ${HOME} 2>/dev/null cd printf /usr/bin then printf ${HOME}
+		export "$1" cd && export awk awk --verbose readonly "$@" && test
+	local 'quoted text' local export echo
+${HOME} cd 2>/dev/null && then
+/usr/bin done test cd echo done "$1" --verbose | sed grep 2>/dev/null 2>/dev/null
+	'quoted text' -eu && ${HOME} ${HOME}
+	local readonly cd export local --verbose "$@" 2>/dev/null /usr/bin --verbose
+test && cd awk | x=1 /usr/bin
+	export 'quoted text' cd cd x=1 && "$1"
+-eu ${HOME} awk -eu "$@" |
+$(pwd) then printf test && sed
+		readonly 'quoted text' | printf ${HOME} cd
+		"$@" "$1" cd echo x=1 'quoted text' echo printf
+		/usr/bin --verbose | cd test then 'quoted text'
+done sed /usr/bin /usr/bin then 2>/dev/null echo x=1 $(pwd) done "$@"
+local local printf readonly 2>/dev/null && "$1" --verbose
+		2>/dev/null $(pwd) 'quoted text' printf "$1" ${HOME} && readonly printf $(pwd)
+		echo -eu ${HOME} then --verbose 2>/dev/null && "$1" x=1 done -eu && --verbose
+		x=1 ${HOME} grep sed local x=1 ${HOME} printf ${HOME}
+cd $(pwd) sed test awk done local 2>/dev/null
+grep then done 'quoted text' /usr/bin $(pwd) /usr/bin
+echo done 'quoted text' export test sed
+echo echo echo --verbose
+	${HOME} grep 2>/dev/null done cd readonly printf
+	done printf -eu done local -eu 'quoted text'
+sed --verbose $(pwd) "$1" && printf --verbose ${HOME}
+		/usr/bin echo echo test | x=1 -eu ${HOME} -eu /usr/bin grep && sed readonly local
+		test done "$@" local local 'quoted text' test && awk readonly local x=1 2>/dev/null
+cd done "$@" echo echo
+'quoted text' --verbose printf && done export grep 2>/dev/null then
+"$1" ${HOME} local awk && 'quoted text' -eu awk "$@" cd | -eu x=1
+		"$@" -eu /usr/bin --verbose test "$@" "$@"
+	export -eu | /usr/bin test sed awk ${HOME} readonly
+		/usr/bin | cd ${HOME}
+	--verbose $(pwd) "$@" /usr/bin && done sed && printf local export ${HOME} readonly
+echo local test done sed echo -eu readonly
+		/usr/bin -eu $(pwd) local $(pwd) local echo
+--verbose 'quoted text' x=1 export "$1" echo "$@" export $(pwd) then export
+	then ${HOME} test test echo sed | $(pwd) export printf awk export 2>/dev/null
+/usr/bin ${HOME} then 2>/dev/null | && done done x=1
+		export 2>/dev/null sed grep $(pwd) export awk 2>/dev/null printf export
+"$1" sed /usr/bin printf $(pwd) done local
+		printf --verbose $(pwd) local
+		--verbose 'quoted text' grep "$1" 'quoted text'
+"$@" then export /usr/bin "$@" x=1 --verbose x=1 export ${HOME} 2>/dev/null
+--verbose awk | 'quoted text' --verbose sed readonly sed local $(pwd) cd ${HOME}
+test 2>/dev/null readonly 'quoted text'
+'quoted text' x=1 sed sed x=1 printf /usr/bin
+		local 2>/dev/null echo 'quoted text' --verbose export readonly
+		then local $(pwd) sed --verbose
+		echo echo export --verbose local export
+/usr/bin done test echo x=1 'quoted text' -eu
+	-eu ${HOME} local x=1 cd readonly cd && "$@" ${HOME} 'quoted text'
+then done --verbose /usr/bin grep
+readonly awk done "$@" /usr/bin
+	$(pwd) 2>/dev/null 'quoted text' test "$1" sed cd $(pwd) then local
+	$(pwd) $(pwd) x=1 test
+awk | cd && | then echo -eu done && readonly awk 'quoted text'
+		--verbose /usr/bin export && /usr/bin 'quoted text' done export grep
+done && export /usr/bin printf 2>/dev/null test then x=1
+		"$@" 2>/dev/null /usr/bin printf 'quoted text' export export cd $(pwd)
+2>/dev/null $(pwd) /usr/bin printf done --verbose
+		'quoted text' $(pwd) "$@" cd local grep && | cd then -eu $(pwd) && /usr/bin
+		local --verbose x=1 grep -eu | -eu sed /usr/bin 'quoted text' done | printf
+		${HOME} awk sed local printf $(pwd) 'quoted text'
+	x=1 && test test x=1 done done export
+	2>/dev/null | 'quoted text' local echo printf grep x=1 export echo cd ${HOME}
+		readonly 2>/dev/null x=1 2>/dev/null awk && && ${HOME} x=1
+		local x=1 test x=1 $(pwd) x=1
+		${HOME} "$1" local printf readonly "$@" local $(pwd) | sed sed sed export
+		printf test echo ${HOME} --verbose
+		/usr/bin --verbose --verbose done test -eu
+&& ${HOME} $(pwd) local done ${HOME}
+		--verbose then printf /usr/bin then readonly --verbose -eu sed 2>/dev/null
+x=1 done local 'quoted text' $(pwd) -eu awk awk ${HOME} then $(pwd) cd
+grep readonly && -eu 'quoted text'
+"$1" /usr/bin x=1 /usr/bin /usr/bin
+	--verbose 'quoted text' sed 'quoted text' readonly
+		awk $(pwd) ${HOME} x=1 test x=1 | test sed "$1" && export
+		test && export done cd "$1"
+"$1" | /usr/bin sed x=1 2>/dev/null local -eu /usr/bin --verbose $(pwd)
+		--verbose "$1" /usr/bin /usr/bin
+	&& readonly "$1" printf awk printf | test sed "$1" cd export $(pwd)
+grep then 'quoted text' /usr/bin then sed done test export readonly x=1
+2>/dev/null grep done printf /usr/bin 'quoted text'
+then | printf then grep x=1 x=1 grep x=1 printf $(pwd) "$1" local
+		grep then then "$@" $(pwd) cd --verbose $(pwd) done printf ${HOME} -eu
+		/usr/bin | -eu then x=1 printf $(pwd) /usr/bin 2>/dev/null export x=1 && sed
+		$(pwd) -eu readonly readonly -eu export "$1" | "$@" export done readonly 'quoted text'
+		| echo echo "$@" test test
+	'quoted text' awk sed done /usr/bin
+&& sed echo -eu -eu done
+'quoted text' "$1" awk --verbose test -eu echo then $(pwd)
+	x=1 --verbose grep 'quoted text' export sed done ${HOME} readonly "$@"
+		awk x=1 test readonly echo 'quoted text' 'quoted text' awk "$@"
+		${HOME} | echo ${HOME} local && "$1" readonly | local 2>/dev/null
+		/usr/bin printf "$@" test test cd test ${HOME} /usr/bin then readonly echo "$@"
+		| local ${HOME} grep awk && 2>/dev/null x=1 echo sed printf && 2>/dev/null
+sed | | "$1" "$1" 'quoted text'
+	2>/dev/null test x=1
+		"$1" /usr/bin awk "$@" $(pwd) -eu grep -eu printf &&
+	test && then awk printf cd awk printf /usr/bin done grep local grep
+		done echo 2>/dev/null then ${HOME} 2>/dev/null $(pwd) test export cd 2>/dev/null
+--verbose grep test grep echo export
+		'quoted text' -eu 'quoted text' ${HOME} grep
+		/usr/bin test export test ${HOME} -eu local --verbose && 'quoted text' && -eu -eu
+		done $(pwd) then test --verbose awk | done $(pwd) "$@" && local
+-eu ${HOME} && $(pwd) export
+sed && awk awk printf cd then /usr/bin cd test /usr/bin export test --verbose
+	export /usr/bin -eu awk
+		--verbose 2>/dev/null cd printf x=1 done
+	echo x=1 "$1" 'quoted text' echo "$@" grep
+		"$@" local ${HOME} export sed 2>/dev/null local ${HOME} ${HOME} ${HOME}
+	$(pwd) 2>/dev/null export done export
+		export | 'quoted text' "$@" sed grep readonly cd 'quoted text'
+	test done ${HOME} then echo then sed
+		test 2>/dev/null -eu sed awk readonly /usr/bin then sed cd ${HOME} x=1 cd
+"$@" x=1 /usr/bin cd grep "$1" "$@" done
+	$(pwd) test local /usr/bin -eu
+	sed local printf "$@" local cd "$@" 2>/dev/null -eu export
+/usr/bin awk --verbose x=1
+	${HOME} export printf sed --verbose $(pwd) grep -eu
+2>/dev/null | cd $(pwd)
+&& -eu echo 2>/dev/null $(pwd)
+		sed | then ${HOME} awk "$@" x=1 "$@" --verbose done printf local done x=1 then grep
+		| cd then grep export sed "$1" "$@" awk export "$@" 2>/dev/null
+	x=1 'quoted text' && done done echo
+		$(pwd) grep x=1 cd awk ${HOME} x=1 $(pwd) test printf echo --verbose && test "$@"
+	"$1" test 2>/dev/null sed
+		${HOME} done cd ${HOME} $(pwd)
+	local export readonly done awk awk printf -eu printf cd -eu
+		x=1 "$@" done -eu x=1 'quoted text'
+		/usr/bin local grep -eu 2>/dev/null grep cd local /usr/bin
+${HOME} echo && then grep cd test $(pwd) ${HOME} /usr/bin
+	then cd 2>/dev/null "$@" done --verbose
+	2>/dev/null && --verbose cd then && test /usr/bin "$@" cd -eu --verbose
+		$(pwd) && grep local done --verbose echo printf $(pwd) readonly
+test readonly readonly "$@"
+printf --verbose grep awk local printf readonly
+		echo 'quoted text' | --verbose | local
+export --verbose readonly && then export x=1 echo
+		export --verbose awk 'quoted text' test "$1" 2>/dev/null
+export 'quoted text' "$1" --verbose | && 'quoted text'
+"$@" awk ${HOME} | done /usr/bin awk export test ${HOME}
+"$@" sed /usr/bin && grep
+printf done echo printf sed local awk export sed echo --verbose --verbose then
+	export /usr/bin "$1" test
+/usr/bin sed --verbose cd /usr/bin x=1 2>/dev/null /usr/bin | grep
+export local "$@" then "$1" ${HOME} awk then -eu test | test 'quoted text'
+"$1" $(pwd) | 2>/dev/null && && "$@" readonly
+	"$1" then --verbose "$1"
+'quoted text' && ${HOME} local $(pwd) "$@" x=1 readonly test /usr/bin --verbose
+	-eu echo | readonly ${HOME} done
+	/usr/bin readonly | printf local printf printf grep 2>/dev/null
+		x=1 sed 2>/dev/null then export
+done readonly readonly /usr/bin
+&& 2>/dev/null x=1 --verbose local && --verbose local | readonly "$1" test
+	sed ${HOME} local done sed /usr/bin /usr/bin
+		cd ${HOME} echo /usr/bin /usr/bin
+"$@" then "$1" | 2>/dev/null echo done 'quoted text' $(pwd) | "$1" 2>/dev/null
+export awk 2>/dev/null export -eu "$1" export "$@"
+--verbose then grep --verbose
+	local $(pwd) 2>/dev/null done 2>/dev/null export --verbose cd grep
+'quoted text' 2>/dev/null export
+	| local $(pwd) grep test --verbose
+	done echo cd /usr/bin readonly done "$1" cd --verbose --verbose
+'quoted text' grep local grep readonly readonly "$@"
+	-eu sed awk echo /usr/bin readonly printf
+	"$1" then ${HOME} -eu done | readonly
+		readonly && "$1" 2>/dev/null readonly && | | cd
+cd then 2>/dev/null test -eu grep then local sed -eu
+	then "$1" "$@" awk awk sed --verbose "$@" echo sed
+		readonly ${HOME} x=1 | readonly export echo echo -eu export /usr/bin --verbose grep
+sed test printf x=1 echo readonly
+		awk | $(pwd) "$1" "$@" sed 2>/dev/null "$@" awk 2>/dev/null &&
+	local "$@" "$@" x=1 2>/dev/null grep "$@" printf cd
+	export x=1 | -eu sed printf then local
+	/usr/bin x=1 "$@" local printf readonly x=1 done "$1"
+2>/dev/null test sed awk
+		-eu /usr/bin /usr/bin && 'quoted text' export readonly x=1 $(pwd) -eu
+	readonly readonly && --verbose sed "$1" sed done $(pwd) echo done "$@" local
+printf --verbose then then
+		awk | local then $(pwd) && local readonly readonly | ${HOME}
+		&& grep grep "$1" then test |
+		readonly 'quoted text' readonly then printf --verbose echo
+printf -eu "$1" local 'quoted text' x=1 readonly -eu readonly "$@" done /usr/bin
+	local -eu --verbose readonly awk printf echo 'quoted text' test
+--verbose sed -eu awk
+		printf then "$1" ${HOME} 'quoted text' grep grep /usr/bin /usr/bin printf test awk
+	| echo | printf echo | && echo awk
+	"$1" grep | local -eu 2>/dev/null 2>/dev/null awk $(pwd) $(pwd) "$1" $(pwd)
+readonly | -eu && cd x=1 --verbose | | -eu &&
+export "$@" "$1" printf /usr/bin sed grep 'quoted text'
+		$(pwd) awk done $(pwd) echo cd && $(pwd)
+	-eu ${HOME} echo /usr/bin
+	${HOME} -eu $(pwd) $(pwd)
+	&& "$1" cd x=1 | | x=1 x=1 test 2>/dev/null 'quoted text' awk local grep
+		grep "$@" "$@" ${HOME} -eu 'quoted text' local
+	2>/dev/null echo then then printf grep sed test cd | done sed local && 'quoted text'
+sed awk ${HOME} "$1" export export | x=1 2>/dev/null
+		done printf local sed done sed sed /usr/bin 2>/dev/null
+		echo test "$@" 2>/dev/null | printf test grep "$@" grep test test cd
+		cd $(pwd) | test "$@" "$@" local awk "$1" then awk 'quoted text' printf
+		${HOME} $(pwd) && done -eu | 'quoted text'
+test "$@" | sed ${HOME} ${HOME} printf then ${HOME} done printf 'quoted text'
+	| && export -eu then --verbose readonly sed x=1
+		/usr/bin -eu ${HOME} cd printf test
+		-eu printf $(pwd) then 'quoted text'
+echo export export readonly
+		"$1" cd cd "$1" test ${HOME} local awk && awk done
+test 'quoted text' cd sed test printf 2>/dev/null "$@" | awk awk -eu done awk 'quoted text'
+x=1 "$@" grep "$@" x=1
+		"$@" "$1" readonly cd "$1" x=1 "$1" "$1" local awk printf
+grep cd test done local "$@" readonly grep 2>/dev/null echo
+	printf echo x=1 -eu printf done ${HOME} && --verbose echo echo x=1
+"$@" "$@" grep awk 2>/dev/null grep 'quoted text'
+		printf 2>/dev/null | export export | then cd then printf
+&& export done local grep x=1 "$1" test readonly
+		/usr/bin done 2>/dev/null export grep export grep
+		export grep && /usr/bin echo done done awk echo then readonly "$@" grep printf $(pwd)
+	'quoted text' cd "$@" /usr/bin && sed
+${HOME} -eu 'quoted text' sed --verbose then | --verbose echo "$@" sed
+	grep $(pwd) test test
+		grep && ${HOME} $(pwd) "$@" /usr/bin local test
+| 'quoted text' grep | -eu -eu | x=1 "$1" grep done -eu export
+	printf | && awk then done cd $(pwd) echo readonly test
+		cd printf test export x=1 echo done
+/usr/bin "$@" done local
+		'quoted text' | readonly 'quoted text' printf "$1" printf "$@" echo local 'quoted text'
+	$(pwd) awk --verbose awk "$1" /usr/bin | awk /usr/bin && "$@" readonly
+$(pwd) "$1" local x=1
+	sed --verbose export "$1" /usr/bin ${HOME}
+		/usr/bin export "$1" && $(pwd) --verbose 2>/dev/null "$@" cd && /usr/bin
+	$(pwd) 2>/dev/null cd 'quoted text'
+	then ${HOME} local printf 2>/dev/null -eu echo done &&
+	test local ${HOME} export && &&
+		done echo --verbose --verbose x=1 awk "$1" "$1" local $(pwd) test /usr/bin
+$(pwd) 2>/dev/null readonly &&
+	local 2>/dev/null $(pwd) "$1" local 'quoted text' echo cd 'quoted text' /usr/bin
+x=1 'quoted text' readonly && awk
+	2>/dev/null x=1 echo $(pwd) done |
+| --verbose local echo ${HOME} echo sed printf sed
+-eu awk && "$1" export awk cd 2>/dev/null export --verbose then 'quoted text'
+2>/dev/null | test && 2>/dev/null 'quoted text' test echo export "$@" grep done
+local grep $(pwd) sed -eu $(pwd) sed $(pwd) "$1" "$1" x=1 grep local
+	export "$1" 2>/dev/null x=1 printf readonly 2>/dev/null "$@"
+then test "$@" --verbose done test "$@" "$@" && ${HOME} export
+cd then readonly 'quoted text' $(pwd)
+	awk done sed $(pwd) "$@" "$1" --verbose cd then "$@" "$@" awk "$1" cd printf
+test cd -eu | --verbose ${HOME} ${HOME} sed 'quoted text'
+	&& "$1" /usr/bin 'quoted text' grep cd awk --verbose echo sed
+	'quoted text' "$1" done printf cd | grep export awk
+	"$1" --verbose sed local 2>/dev/null cd echo test local ${HOME}
+		'quoted text' printf awk sed 'quoted text'
+		'quoted text' then "$1" $(pwd) grep
+	-eu ${HOME} /usr/bin awk | readonly cd -eu /usr/bin
+then /usr/bin /usr/bin export echo then test x=1 export cd
+'quoted text' "$1" local
+		'quoted text' "$@" grep -eu cd "$@" awk ${HOME}
+		| /usr/bin test "$1" "$@" readonly 'quoted text' local
+	x=1 x=1 "$@" local "$@" --verbose export -eu "$1" x=1 printf
+		echo then printf | echo export
+	echo --verbose 'quoted text' ${HOME} --verbose
+/usr/bin "$1" -eu done "$@" grep echo export x=1 readonly 'quoted text'
+		readonly readonly test "$@" $(pwd) done
+	done grep cd /usr/bin 2>/dev/null
+"$1" | /usr/bin && 2>/dev/null 'quoted text'
+local printf grep export done x=1 then export then 2>/dev/null --verbose
+	-eu echo echo /usr/bin 'quoted text'
+		sed 'quoted text' | grep
+	2>/dev/null && echo 2>/dev/null
+sed done readonly 'quoted text' local grep
+test local sed "$@" test readonly local awk "$@" test sed echo
+	export 'quoted text' printf sed --verbose
+	$(pwd) printf x=1 cd $(pwd) awk done echo printf
+	${HOME} | export test test --verbose --verbose
+"$1" | 'quoted text' sed "$@" grep export readonly printf awk
+		awk /usr/bin 2>/dev/null grep && echo test awk
+printf -eu awk x=1 local local readonly && | then
+	-eu sed x=1 --verbose
+	sed cd grep && done x=1 --verbose x=1 x=1 done 'quoted text' "$1"
+	"$@" test awk "$@" then echo printf --verbose --verbose --verbose --verbose -eu
+		awk awk | export sed export test ${HOME} done "$@" awk done test cd
+	${HOME} readonly 'quoted text' then sed local -eu ${HOME} && echo echo | 'quoted text'
+"$@" local && 2>/dev/null local $(pwd) 'quoted text' awk "$1"
+		&& then printf done cd "$1" 2>/dev/null
+		"$@" && -eu $(pwd) local "$1" /usr/bin test --verbose --verbose
+	"$1" cd then x=1 $(pwd) --verbose export "$1" then 2>/dev/null && printf /usr/bin
+	cd && | echo cd echo test done local printf grep --verbose
+test $(pwd) --verbose then "$@" -eu grep x=1 /usr/bin printf -eu 'quoted text'
+	printf cd then $(pwd)
+printf readonly x=1 printf local 2>/dev/null local 'quoted text'
+	--verbose --verbose grep local ${HOME}
+	echo && -eu grep && && local printf 'quoted text' 'quoted text' local sed awk
+	"$@" "$@" && awk -eu $(pwd)
+	export 'quoted text' | -eu $(pwd)
+echo 2>/dev/null local "$@" && echo printf /usr/bin then done
+	sed test x=1 then cd x=1 done test echo "$@" && x=1 cd $(pwd) local "$@"
+&& echo $(pwd) grep readonly ${HOME} && printf -eu && done --verbose sed printf
+	/usr/bin -eu cd | /usr/bin cd test
+	then 2>/dev/null "$@" grep then ${HOME} then
+	${HOME} /usr/bin readonly grep awk $(pwd) && local cd -eu 2>/dev/null
+		$(pwd) printf readonly 2>/dev/null $(pwd) echo sed
+		$(pwd) x=1 /usr/bin ${HOME} export --verbose --verbose $(pwd) sed "$1" "$@"
+	&& cd --verbose done x=1 local echo done awk printf
+		then awk printf "$1" -eu | sed printf $(pwd) cd $(pwd) echo grep
+	test -eu 2>/dev/null printf echo done
+	cd done then test /usr/bin
+2>/dev/null /usr/bin 2>/dev/null
+awk $(pwd) "$1" done x=1 | awk sed && $(pwd) "$@" -eu awk ${HOME}
+		2>/dev/null sed x=1 "$@" | awk -eu
+printf "$1" readonly echo local
+sed grep awk then --verbose /usr/bin cd grep printf local
+	/usr/bin | done local 'quoted text' echo /usr/bin && 2>/dev/null && then
+		--verbose echo --verbose ${HOME} "$@" ${HOME} local x=1 "$1" --verbose
+		| --verbose sed ${HOME} | readonly -eu done then
+		echo then "$1" && export export echo "$@" /usr/bin $(pwd) then $(pwd) then 'quoted text'
+		awk readonly export printf x=1 "$1" x=1 cd local
+		x=1 then test test echo then sed done cd sed ${HOME}
+printf $(pwd) readonly then printf awk grep "$@"
+		test --verbose 2>/dev/null readonly "$1" "$1"
+	/usr/bin --verbose 'quoted text' | x=1 $(pwd) "$1" ${HOME} grep 2>/dev/null
+		| --verbose then awk cd 'quoted text' echo --verbose printf sed printf --verbose
+-eu test /usr/bin test sed test "$1" cd done
+local printf test --verbose "$1" sed && 'quoted text' cd sed
+		"$1" "$@" done sed "$@" cd ${HOME} test awk "$1" x=1 /usr/bin x=1
+		&& ${HOME} sed printf && cd "$1" "$1"
+'quoted text' export echo "$@" cd test "$1" readonly echo test /usr/bin $(pwd)
+	&& ${HOME} printf && done ${HOME} test
+	| "$@" /usr/bin cd $(pwd) grep --verbose printf -eu awk -eu 2>/dev/null
+		done --verbose then local "$1" | local
+		&& "$@" export "$1" | export cd && test local 'quoted text'
+		grep | "$1" grep export --verbose echo && test cd test done sed ${HOME} -eu
+		${HOME} done $(pwd) | awk test echo then ${HOME} export ${HOME} ${HOME}
+		awk done 2>/dev/null $(pwd) 2>/dev/null x=1 -eu --verbose | -eu awk
+	x=1 "$1" -eu then ${HOME} ${HOME} | $(pwd) printf
+		-eu then readonly /usr/bin local sed then 'quoted text' then cd grep
+		/usr/bin --verbose printf sed printf local
+	-eu 'quoted text' readonly grep $(pwd) local then | cd printf
+2>/dev/null -eu /usr/bin then test local && printf local
+		echo /usr/bin cd export local ${HOME} $(pwd) 'quoted text' local printf
+	printf export "$1" --verbose --verbose
+		awk test then /usr/bin --verbose 'quoted text' printf grep
+then /usr/bin --verbose then local local
+	'quoted text' test sed 'quoted text' awk export export
+done sed grep then local --verbose "$1" echo "$1" export ${HOME} x=1 cd 'quoted text'
+		$(pwd) sed echo -eu x=1 --verbose "$@" grep awk then
+	sed export 'quoted text' printf
+sed "$@" /usr/bin && x=1 export /usr/bin 2>/dev/null 2>/dev/null
+		done export readonly x=1 grep echo test "$1"
+		sed echo "$1" readonly && -eu --verbose | export
+		-eu grep echo /usr/bin "$1" "$1" 'quoted text' && /usr/bin $(pwd) -eu readonly
+then export grep export then cd "$@"
+	echo printf "$1" then &&
+sed | /usr/bin -eu "$1"
+	local printf -eu then sed "$1" ${HOME} x=1 printf ${HOME} echo echo
+	readonly && --verbose sed ${HOME} x=1
+		2>/dev/null 'quoted text' awk echo local cd 'quoted text'
+	export echo 2>/dev/null printf 'quoted text' ${HOME}
+readonly x=1 $(pwd) /usr/bin export 2>/dev/null echo grep echo awk
+		-eu echo then -eu && then sed
+	| export $(pwd) && x=1 -eu
+| "$1" -eu 'quoted text' "$1" readonly
+		| "$1" grep && "$@" awk -eu
+		--verbose 2>/dev/null grep echo done --verbose printf test echo $(pwd) printf
+awk 2>/dev/null sed /usr/bin x=1 x=1 2>/dev/null
+		"$1" awk then /usr/bin
+done sed /usr/bin -eu export && "$@" -eu 'quoted text' readonly awk ${HOME} --verbose
+	local 'quoted text' | && x=1 grep export "$1" /usr/bin "$1" 'quoted text' 'quoted text'
+		export && /usr/bin x=1 then -eu export x=1 test "$1"
+		/usr/bin done awk $(pwd) "$1" printf awk readonly
+	&& local 'quoted text' 2>/dev/null
+		"$@" $(pwd) done awk 2>/dev/null printf test then "$@" | --verbose
+	done 2>/dev/null $(pwd) cd 'quoted text' then done printf awk && export grep 'quoted text'
+	grep x=1 x=1 readonly readonly -eu /usr/bin
+		2>/dev/null "$1" x=1 printf then && /usr/bin
+		readonly cd x=1 echo ${HOME} x=1 export
+		echo done cd done 'quoted text' then 'quoted text' test "$@" export
+	done sed && echo readonly "$@" $(pwd) 'quoted text' done && awk -eu
+	echo "$1" export cd ${HOME} cd 'quoted text'
+	grep export export echo printf
+	--verbose then readonly ${HOME} local local
+		echo "$1" $(pwd) sed grep cd "$@" printf
+2>/dev/null sed "$1" "$1" -eu readonly | grep local local export printf
+	-eu cd "$1" 2>/dev/null done local -eu --verbose grep printf "$@" -eu awk grep
+		"$1" && test x=1 then printf -eu echo done && 'quoted text'
+		-eu grep "$@" /usr/bin -eu && awk /usr/bin
+		then printf cd printf printf then && grep cd grep /usr/bin then -eu && echo 'quoted text'
+		awk "$1" -eu x=1 then 2>/dev/null
+printf "$1" then "$@" "$@" | /usr/bin "$@" "$@" export "$1"
+	export && | /usr/bin "$@" 'quoted text' echo "$@" 2>/dev/null | export
+	local test -eu printf -eu 'quoted text' awk export cd
+	cd awk grep awk "$1" 2>/dev/null readonly readonly $(pwd) readonly readonly
+	${HOME} printf sed export --verbose
+sed grep export x=1 /usr/bin test echo "$@" awk /usr/bin done local local local
+cd readonly done readonly
+		sed 'quoted text' then /usr/bin | then
+echo grep local sed awk | "$@" -eu test export cd then ${HOME}
+'quoted text' -eu -eu awk
+		then -eu && | grep done done /usr/bin 'quoted text' $(pwd) cd 2>/dev/null test
+		grep | then ${HOME} "$1" "$@" printf | test --verbose grep echo -eu grep --verbose
+	&& | -eu done && done | local | printf
+	'quoted text' && -eu "$@" ${HOME} 2>/dev/null
+		| ${HOME} printf sed --verbose ${HOME} x=1 test "$1" | /usr/bin ${HOME} -eu 'quoted text'
+	'quoted text' local | sed then
+	awk --verbose -eu sed
+$(pwd) 2>/dev/null export /usr/bin cd awk
+	&& readonly local then 2>/dev/null $(pwd) readonly done readonly "$@" done
+done 'quoted text' cd printf 2>/dev/null /usr/bin
+printf ${HOME} export test export
+	2>/dev/null test export && sed --verbose sed local test
+		| x=1 /usr/bin export echo echo awk | /usr/bin cd
+awk $(pwd) then printf awk awk grep | -eu 2>/dev/null -eu 2>/dev/null /usr/bin
+		"$@" 'quoted text' grep && echo
+		| test grep $(pwd) cd x=1 cd "$1" && test echo then 'quoted text' test grep
+export export sed grep -eu
+		readonly | echo readonly -eu --verbose
+"$@" --verbose --verbose done --verbose done grep done --verbose "$@" awk
+	$(pwd) 2>/dev/null 'quoted text' printf -eu /usr/bin readonly
+	local --verbose echo x=1 done | awk readonly | "$@" done local printf x=1 then
+		"$@" -eu | && export ${HOME} /usr/bin local ${HOME}
+		awk test cd test printf /usr/bin /usr/bin then
+grep $(pwd) && $(pwd) -eu
+	local "$1" printf && && local -eu echo $(pwd) export
+printf /usr/bin local echo
+/usr/bin | printf export -eu echo cd export sed | x=1 readonly readonly
+		"$1" $(pwd) printf --verbose --verbose test then
+	cd readonly printf readonly 2>/dev/null grep local x=1 export
+	export awk -eu test -eu "$@" $(pwd) echo then awk
+cd 2>/dev/null then $(pwd) readonly
+		done "$1" | export awk test "$1" test echo then $(pwd) --verbose $(pwd) | 2>/dev/null
+		awk ${HOME} sed "$@" "$1" "$@" done test --verbose echo printf
+		x=1 grep printf 2>/dev/null | grep awk "$1"
+"$1" readonly && done "$@" grep $(pwd) awk sed export cd 2>/dev/null grep ${HOME}
+		'quoted text' ${HOME} | x=1 | 'quoted text' local printf "$1" 'quoted text'
+		echo export x=1 export "$1" done
+2>/dev/null local && cd sed
+	${HOME} cd done sed "$1" | sed x=1 --verbose
+		--verbose export grep x=1 -eu && test
+	/usr/bin | cd printf sed cd
+		${HOME} --verbose test cd done |
+echo ${HOME} test readonly cd
+		done readonly -eu grep test x=1 then echo echo cd grep --verbose "$@" sed
+		"$@" /usr/bin local export grep
+	-eu "$1" sed awk export "$@" ${HOME} -eu 'quoted text'
+	${HOME} "$@" x=1 done | export done sed grep awk --verbose test 2>/dev/null /usr/bin
+sed cd x=1 -eu export printf
+		"$@" $(pwd) ${HOME} printf grep awk export /usr/bin cd grep echo cd then
+	grep "$@" export printf | --verbose export readonly x=1 echo grep then
+	cd test 'quoted text' test readonly ${HOME} "$1" done "$@" grep
+		2>/dev/null 2>/dev/null readonly local local printf awk cd sed x=1 /usr/bin
+		2>/dev/null cd 'quoted text' 'quoted text' test awk "$1"
+"$1" test test | sed --verbose readonly
+		--verbose printf grep "$@" $(pwd)
+	test | "$1" awk 'quoted text'
+2>/dev/null /usr/bin grep "$1" ${HOME} --verbose grep sed sed sed
+$(pwd) done --verbose 2>/dev/null x=1 ${HOME} x=1 "$@" grep export awk "$1" readonly
+		export printf -eu cd |
+	sed awk printf --verbose printf "$1" export -eu readonly sed
+		$(pwd) /usr/bin --verbose
+export export "$1" 2>/dev/null readonly echo cd sed x=1 --verbose
+	echo x=1 "$@" printf grep printf awk
+		'quoted text' awk printf && printf && $(pwd) done export done ${HOME}
+	test | awk /usr/bin 2>/dev/null echo x=1 test x=1 readonly
+"$1" $(pwd) "$1" grep 2>/dev/null
+$(pwd) 2>/dev/null /usr/bin ${HOME} ${HOME} awk "$@"
+echo echo "$@" ${HOME} -eu /usr/bin
+	"$@" && $(pwd) test grep test awk local awk awk 'quoted text' test printf /usr/bin
+local echo then then 'quoted text' awk
+then done cd export export grep ${HOME}
+done awk grep done test
+local 'quoted text' sed | /usr/bin then test 'quoted text' cd done grep awk &&
+	sed --verbose done ${HOME} "$1" -eu awk
+		-eu sed && "$@" export "$1" export
+		awk 2>/dev/null "$@" && test 2>/dev/null cd test grep sed done
+$(pwd) -eu ${HOME} echo cd awk local "$@" ${HOME}
+		export printf cd 2>/dev/null echo ${HOME} "$@" local 2>/dev/null
+'quoted text' done "$1" local 2>/dev/null
+echo readonly -eu cd printf test
+		awk local -eu echo awk sed test sed "$1" /usr/bin 2>/dev/null local "$1" echo
+&& && export x=1 "$@"
+	/usr/bin echo -eu done 2>/dev/null sed "$1" sed && done /usr/bin local
+		| awk readonly | --verbose ${HOME}
+	then local 2>/dev/null /usr/bin export "$1" local "$1"
+done printf printf echo cd
+		grep test echo printf $(pwd) -eu awk "$@" readonly 'quoted text'
+export 'quoted text' cd printf | export done then $(pwd) |
+		export test ${HOME} 'quoted text' x=1 && $(pwd) ${HOME}
+	-eu export --verbose 2>/dev/null
+	echo x=1 /usr/bin cd -eu
+		-eu done printf "$@" 'quoted text' -eu
+	$(pwd) 2>/dev/null ${HOME} x=1 awk $(pwd) 'quoted text' grep export readonly
+${HOME} 'quoted text' -eu "$1" sed test export
+	/usr/bin /usr/bin readonly && echo -eu then
+| printf --verbose readonly cd --verbose
+x=1 cd 'quoted text' export
+awk local $(pwd) awk printf $(pwd) readonly
+		local export 2>/dev/null "$1" sed done "$@" $(pwd) printf test -eu "$@"
+		readonly awk cd x=1 "$@"
+$(pwd) sed | -eu 'quoted text' -eu -eu then --verbose "$@" "$1" test sed
+	${HOME} -eu x=1 $(pwd)
+	test "$@" 2>/dev/null "$1" /usr/bin readonly 2>/dev/null local -eu x=1 test
+		sed --verbose export -eu -eu grep grep test 2>/dev/null done
+		2>/dev/null awk echo && "$@" readonly local 2>/dev/null local sed x=1
+		test echo | 'quoted text' -eu sed readonly x=1 -eu 2>/dev/null
+		done local 'quoted text' cd readonly echo then 'quoted text' x=1 ${HOME}
+		--verbose local /usr/bin x=1
+		cd x=1 grep "$@" then readonly echo
+cd $(pwd) && echo x=1 2>/dev/null then local echo 'quoted text'
+	sed then local 'quoted text' echo then 2>/dev/null readonly "$@" sed export
+done sed ${HOME} --verbose
+		&& done then 2>/dev/null
+"$1" /usr/bin export --verbose 'quoted text' ${HOME}
+then readonly cd echo echo $(pwd) sed
+'quoted text' awk echo 2>/dev/null "$@"
+		local local --verbose grep && test done -eu ${HOME} grep ${HOME} test readonly
+local printf test 2>/dev/null then --verbose sed awk grep done 'quoted text'
+		/usr/bin test echo "$1" cd | cd --verbose | awk | "$@"
+		"$1" readonly done readonly export /usr/bin ${HOME}
+	'quoted text' 2>/dev/null $(pwd) awk then printf echo export done --verbose cd
+	--verbose "$1" $(pwd) awk && /usr/bin local printf
+		echo x=1 cd ${HOME} export "$1" 'quoted text' --verbose
+		sed export local local test ${HOME}
+		local -eu ${HOME} done test -eu then 2>/dev/null sed "$1"
+sed x=1 ${HOME} /usr/bin readonly printf /usr/bin
+&& readonly grep local cd awk done 2>/dev/null done
+$(pwd) 2>/dev/null sed grep -eu $(pwd)
+export 'quoted text' done --verbose
+	printf echo readonly readonly "$@" export -eu
+	"$@" -eu $(pwd) readonly
+	--verbose -eu && && && "$1" readonly
+'quoted text' done test sed 'quoted text' -eu ${HOME} echo ${HOME} then
+		cd && test "$1" $(pwd) | readonly printf "$@" x=1 $(pwd) done
+	'quoted text' test && 2>/dev/null && printf -eu echo grep
+export done then readonly then export | readonly
+		grep test 'quoted text' "$1"
+		echo echo ${HOME} -eu done | test test test export /usr/bin
+local printf test printf cd awk test 'quoted text'
+"$1" 2>/dev/null "$@"
+	"$1" awk --verbose && cd awk done ${HOME}
+"$1" sed test echo x=1
+	sed -eu readonly cd done "$@" export done
+	sed ${HOME} x=1 "$@" $(pwd) export x=1 && 2>/dev/null
+	done done "$@" done x=1 then test 2>/dev/null sed
+	x=1 cd $(pwd) --verbose -eu 2>/dev/null
+		awk 'quoted text' -eu ${HOME} export /usr/bin
+	export /usr/bin | local printf 'quoted text'
+then | && 2>/dev/null
+then local local cd 'quoted text'
+printf awk export --verbose cd ${HOME}
+done "$@" $(pwd) 'quoted text' test test --verbose
+"$1" $(pwd) x=1 $(pwd) readonly local "$@" cd $(pwd) readonly echo
+	--verbose && export then --verbose && readonly /usr/bin
+--verbose && -eu export /usr/bin && | && x=1 ${HOME} $(pwd) local awk 'quoted text'
+printf && && | --verbose then export grep sed "$@" local /usr/bin
+		$(pwd) grep readonly | /usr/bin | 'quoted text' $(pwd)
+	x=1 && 'quoted text' grep ${HOME} $(pwd) sed
+/usr/bin local then -eu sed && | && ${HOME} $(pwd)
+	-eu awk 2>/dev/null printf readonly sed export echo printf && /usr/bin cd ${HOME}
+	'quoted text' export echo -eu echo | test "$@" "$@" ${HOME} cd test
+	"$1" /usr/bin ${HOME} test 'quoted text' 'quoted text' && printf ${HOME}
+		$(pwd) --verbose cd cd printf 'quoted text' printf cd | cd
+		2>/dev/null printf && test && grep
+		test printf x=1 && local x=1
+	test | | test | ${HOME} && then |
+		x=1 local "$@" 2>/dev/null
+		2>/dev/null sed x=1 echo -eu grep sed echo x=1 awk readonly
+		x=1 "$@" ${HOME} done "$1" 2>/dev/null grep -eu export echo then | echo printf
+	cd 2>/dev/null --verbose | /usr/bin -eu local printf then "$1" readonly
+"$1" echo local test 2>/dev/null x=1 then -eu export
+		&& cd x=1 --verbose "$1" x=1 cd ${HOME} awk test "$@" ${HOME}
+	printf "$1" awk printf cd readonly
+		$(pwd) $(pwd) then done 2>/dev/null
+		${HOME} --verbose then awk cd cd echo readonly "$@" local /usr/bin then
+		export readonly ${HOME} sed cd export | test
+		-eu | x=1 done && "$1" && "$@" $(pwd) "$@" awk cd test local
+2>/dev/null awk && then "$@" done grep 'quoted text'
+		--verbose 'quoted text' "$1" | grep 2>/dev/null $(pwd) -eu done
+	test ${HOME} done printf 2>/dev/null export 2>/dev/null /usr/bin
+| --verbose && x=1 /usr/bin 'quoted text' test -eu grep test && && printf
+		test | done printf export 'quoted text'
+export --verbose test echo
+		/usr/bin local && "$1" --verbose 2>/dev/null grep x=1 'quoted text' /usr/bin
+		$(pwd) 2>/dev/null local cd echo --verbose --verbose
+		| local 'quoted text' --verbose export "$1" 'quoted text'
+		readonly done "$1" -eu && cd grep sed | x=1 echo 2>/dev/null ${HOME}
+"$1" local printf printf --verbose 'quoted text'
+	awk "$1" -eu "$1" && grep then /usr/bin ${HOME} sed grep "$@" awk readonly
+		&& readonly export /usr/bin --verbose x=1 awk cd /usr/bin -eu export
+readonly ${HOME} "$1" x=1 grep grep "$@" 2>/dev/null test done --verbose 2>/dev/null
+	'quoted text' "$1" export | "$1" -eu "$1" cd printf cd /usr/bin "$1"
+		echo awk awk --verbose 'quoted text' cd ${HOME}
+&& grep then done echo /usr/bin cd readonly local "$1"
+	grep x=1 /usr/bin --verbose sed x=1 export x=1 then -eu x=1 x=1 && test
+	export sed test awk sed
+grep done "$1" done | printf then $(pwd)
+$(pwd) && "$@" -eu printf | export && && local |
+		"$@" then done $(pwd) test $(pwd) done -eu grep
+		2>/dev/null export sed cd 2>/dev/null /usr/bin test grep export readonly
+		${HOME} awk $(pwd) -eu printf
+	2>/dev/null /usr/bin && 2>/dev/null echo sed echo x=1 2>/dev/null
+	&& $(pwd) && && && export x=1 cd done done x=1 echo readonly | && "$@"
+local then awk readonly grep 'quoted text' sed "$1" test
+		-eu --verbose --verbose 2>/dev/null echo echo echo test echo | -eu
+	cd awk export sed sed | sed then export ${HOME} printf | "$1" awk test 'quoted text'
+	awk x=1 x=1 local "$1" 'quoted text' x=1 test grep grep grep "$@"
+		export 2>/dev/null | awk printf printf -eu 2>/dev/null
+	grep x=1 && ${HOME} sed "$1" && awk 2>/dev/null "$@" readonly "$1"
+then then export "$@" 2>/dev/null sed test
+2>/dev/null 2>/dev/null && echo
+awk 'quoted text' && --verbose "$1" export sed
+&& cd x=1 readonly done cd printf awk awk 'quoted text' | -eu ${HOME} "$@" printf
+		export ${HOME} "$1" readonly
+	echo cd "$@" /usr/bin --verbose awk awk local $(pwd) echo
+"$1" export printf | 2>/dev/null 2>/dev/null -eu then
+		"$@" done --verbose local && cd done $(pwd) -eu -eu readonly $(pwd) sed "$1"
+		-eu 2>/dev/null awk 'quoted text' readonly && "$@" $(pwd)
+	cd ${HOME} local grep grep
+	done 2>/dev/null test cd sed grep done "$@" "$@" 2>/dev/null cd
+x=1 test done echo readonly "$1" ${HOME} export
+	$(pwd) | test awk -eu export ${HOME} export echo
+		test && then --verbose 2>/dev/null 2>/dev/null
+		&& grep -eu local then $(pwd) export sed test && awk test then "$@"
+	echo ${HOME} "$1" sed $(pwd) --verbose
+		"$@" sed $(pwd) 2>/dev/null 'quoted text' grep ${HOME} cd 'quoted text'
+	export x=1 --verbose && 'quoted text'
+grep echo "$1" "$@" && test echo local test sed done test grep
+		$(pwd) printf readonly echo -eu awk
+		| /usr/bin echo then test awk "$1" grep done | 'quoted text'
+		$(pwd) local x=1 awk && -eu echo done cd 2>/dev/null cd && -eu grep x=1
+'quoted text' done ${HOME} sed 'quoted text' awk printf "$1" test 2>/dev/null
+	cd readonly awk export cd
+	'quoted text' x=1 awk grep readonly "$1"
+| x=1 readonly x=1 grep test test 2>/dev/null echo 2>/dev/null
+/usr/bin sed "$@" ${HOME}
+	&& && readonly done "$@" $(pwd) echo "$1" then cd 'quoted text' local && "$1" /usr/bin
+	x=1 readonly 'quoted text' export export grep $(pwd) 'quoted text' "$1"
+		sed awk echo grep --verbose awk x=1 -eu "$1" then 'quoted text' 2>/dev/null ${HOME}
+		awk grep awk local echo | | then 'quoted text'
+"$@" --verbose sed local export done cd 2>/dev/null
+		sed then "$1" export x=1 --verbose cd | "$@" then /usr/bin ${HOME} export 'quoted text'
+then 'quoted text' printf 2>/dev/null printf grep then sed
+		&& export && grep printf -eu done echo test "$@" test grep $(pwd) printf export
+	--verbose cd ${HOME} grep /usr/bin
+	"$@" "$1" then echo ${HOME} readonly sed echo local awk
+		x=1 x=1 test done $(pwd) $(pwd) printf printf ${HOME}
+	$(pwd) "$1" readonly
+2>/dev/null "$1" awk echo local x=1 $(pwd) 2>/dev/null 2>/dev/null ${HOME} "$@"
+		&& -eu cd printf -eu echo ${HOME} test echo --verbose 2>/dev/null
+	$(pwd) test "$@" "$1" printf grep /usr/bin
+	printf then /usr/bin sed 2>/dev/null export -eu --verbose "$@" test grep x=1 ${HOME}
+	/usr/bin "$@" grep --verbose
+		/usr/bin done echo $(pwd) test awk export
+	x=1 then "$@" 'quoted text' "$@" /usr/bin
+		sed test $(pwd) && grep grep "$1"
+awk done "$@" "$1" | awk local then grep cd cd export test ${HOME}
+x=1 sed && printf local x=1 test export sed
+		-eu -eu echo "$1" x=1
+		test x=1 && ${HOME} $(pwd) test grep cd | --verbose test --verbose "$1"
+	'quoted text' -eu ${HOME} --verbose
+	x=1 printf then local | /usr/bin x=1 readonly
+	| "$1" $(pwd) sed export 'quoted text'
+then && local | 'quoted text' done printf "$1" x=1 cd echo /usr/bin && -eu then
+		cd done "$1" "$1" test ${HOME}
+printf cd sed local 2>/dev/null
+echo $(pwd) printf awk "$@" echo "$1" "$1" sed --verbose local
+	'quoted text' | test ${HOME} --verbose | awk -eu && --verbose readonly test printf
+		grep then -eu local then export test awk printf
+	printf /usr/bin 2>/dev/null -eu "$@" --verbose
+--verbose echo cd 'quoted text'
+export export test test $(pwd) printf 'quoted text' 'quoted text' $(pwd) /usr/bin
+	/usr/bin local x=1 local && cd
+	then awk --verbose ${HOME} then | grep export readonly
+awk $(pwd) 'quoted text' cd --verbose awk --verbose
+"$@" sed done echo ${HOME} sed cd 'quoted text'
+echo "$@" --verbose x=1 -eu
+		readonly then 'quoted text'
+export cd 2>/dev/null export -eu /usr/bin
+	then readonly echo then export test test "$@" -eu --verbose
+&& export /usr/bin | export
+	sed grep 'quoted text' done local | sed ${HOME} $(pwd) "$1"
+		done $(pwd) -eu echo readonly sed "$@" readonly grep /usr/bin
+	test && /usr/bin grep $(pwd) ${HOME}
+&& | 2>/dev/null awk done x=1 "$@" -eu -eu "$1" export
+grep readonly && 2>/dev/null "$1" test
+	sed readonly done --verbose $(pwd)
+x=1 local then grep "$1" /usr/bin
+		&& x=1 | echo test $(pwd) ${HOME}
+		sed "$1" $(pwd) export x=1 ${HOME} && readonly readonly && test then "$1"
+		test ${HOME} echo sed /usr/bin test printf
+done grep done 'quoted text' awk | 2>/dev/null
+		--verbose test 2>/dev/null x=1 | "$1" printf --verbose awk awk test x=1 "$1"
+	grep x=1 done done "$@"
+--verbose done && sed x=1 then && 2>/dev/null cd x=1 done then && then
+		$(pwd) cd | "$@" /usr/bin echo /usr/bin
+export local done && done then awk "$1" cd readonly x=1 && && local
+2>/dev/null "$1" grep /usr/bin ${HOME} done 2>/dev/null "$@" ${HOME}
+	2>/dev/null --verbose sed printf --verbose printf /usr/bin
+		done export -eu 2>/dev/null --verbose
+printf 'quoted text' echo "$1" "$@" sed ${HOME}
+	"$@" && export x=1 echo then && --verbose ${HOME} readonly && -eu --verbose
+test 2>/dev/null 2>/dev/null
+	'quoted text' --verbose test then test $(pwd) local "$@" echo x=1 test "$@" $(pwd)
+		&& "$1" echo && test 2>/dev/null printf "$1" awk &&
+		cd 'quoted text' export
+cd ${HOME} test -eu $(pwd) ${HOME} /usr/bin /usr/bin | grep && /usr/bin $(pwd) "$1"
+		then cd cd "$@" awk && 2>/dev/null /usr/bin | then --verbose
+	$(pwd) ${HOME} sed echo awk test -eu sed export
+	grep x=1 local | grep 2>/dev/null export "$1" cd -eu x=1 "$@" $(pwd)
+2>/dev/null sed sed awk /usr/bin && echo /usr/bin --verbose
+		readonly /usr/bin && | sed grep awk echo
+| /usr/bin --verbose $(pwd) "$@" done sed done x=1 cd done 2>/dev/null
+		cd --verbose echo grep $(pwd)
+		-eu && then export "$@" cd $(pwd) x=1 then
+	grep 2>/dev/null cd grep sed test test echo -eu export then awk "$@" local cd done
+	sed /usr/bin test "$1" "$1" x=1 /usr/bin $(pwd) awk sed
+	-eu printf /usr/bin "$1" printf test test --verbose && printf -eu grep -eu echo
+	/usr/bin 2>/dev/null 'quoted text'
+readonly grep done x=1 awk x=1 'quoted text' sed
+		cd export -eu sed test awk -eu echo awk $(pwd) 'quoted text' /usr/bin
+cd sed local 'quoted text' "$@" echo && "$1" grep test
+$(pwd) then done $(pwd) 2>/dev/null 2>/dev/null printf
+		cd sed "$1" echo then x=1 x=1 then done
+cd ${HOME} | readonly test sed | /usr/bin "$1" awk cd ${HOME}
+	-eu 2>/dev/null readonly /usr/bin
+		readonly export -eu /usr/bin
+export printf -eu x=1 grep && local printf "$1" $(pwd) --verbose cd $(pwd)
+		'quoted text' $(pwd) "$1" test "$1" "$@" readonly
+		| readonly echo ${HOME} test $(pwd) then && 2>/dev/null 2>/dev/null
+cd readonly done awk awk echo
+'quoted text' /usr/bin awk local
+		printf readonly /usr/bin sed test ${HOME} cd "$1" -eu ${HOME} && local echo
+	"$@" sed 2>/dev/null readonly "$@" --verbose 'quoted text'
+printf -eu then && 'quoted text' | awk test --verbose echo
+export "$1" local | /usr/bin 2>/dev/null sed 2>/dev/null $(pwd) echo -eu
+	"$@" sed test then readonly /usr/bin cd -eu grep "$1" 2>/dev/null
+		'quoted text' awk export
+	"$@" ${HOME} awk "$@" printf echo -eu sed $(pwd) 'quoted text'
+x=1 readonly grep then grep awk printf && readonly -eu -eu then "$1" | local then
+		"$@" sed $(pwd) awk -eu | then --verbose "$1" sed
+	then awk 2>/dev/null && && printf cd x=1 export readonly
+	2>/dev/null then test $(pwd) test 2>/dev/null done cd ${HOME} 'quoted text'
+	"$@" done $(pwd) | 'quoted text' then
+		grep 'quoted text' | export awk
+	${HOME} -eu && /usr/bin awk cd awk done ${HOME}
+echo export echo 'quoted text' --verbose printf --verbose sed && --verbose
+	printf local then grep sed "$@" test printf $(pwd) ${HOME} $(pwd) then
+		$(pwd) 'quoted text'
+		-eu readonly done sed test cd export ${HOME}
+grep x=1 /usr/bin awk --verbose --verbose
+	done done --verbose && 2>/dev/null done echo
+${HOME} /usr/bin $(pwd) export
+		${HOME} -eu x=1 cd echo | sed && /usr/bin
+		x=1 then cd grep test cd
+	test grep export readonly
+	x=1 local --verbose "$1" export $(pwd) "$@" "$@" printf
+grep grep /usr/bin 2>/dev/null -eu
+	2>/dev/null 2>/dev/null ${HOME} echo --verbose
+		"$1" && sed local "$1" -eu -eu --verbose "$1" export 2>/dev/null
+sed export 'quoted text' awk printf -eu local echo grep
+readonly ${HOME} ${HOME} sed echo $(pwd) then test /usr/bin
+	sed 2>/dev/null echo then x=1 'quoted text' -eu then -eu 'quoted text' x=1
+		&& && awk 'quoted text' --verbose done | "$@" cd test
+		| $(pwd) echo local x=1 $(pwd) && cd x=1 | $(pwd) then && test && readonly
+	done grep cd "$1" readonly
+x=1 then sed ${HOME} grep -eu printf then
+		then sed grep then ${HOME} then ${HOME} --verbose sed x=1 grep printf --verbose
+export $(pwd) sed then echo $(pwd)
+"$1" printf /usr/bin && 2>/dev/null then grep done readonly
+		| 'quoted text' --verbose echo done /usr/bin -eu test readonly
+| "$@" 'quoted text' | $(pwd) x=1 export done && done
+		grep then 'quoted text' cd done export --verbose
+		local printf test ${HOME} x=1 done 2>/dev/null awk done cd --verbose "$@" grep
+"$1" echo export -eu && export /usr/bin | && export x=1 | sed /usr/bin
+	$(pwd) --verbose printf cd -eu 2>/dev/null printf echo
+		test 2>/dev/null done then cd && then echo /usr/bin $(pwd) --verbose
+	awk 'quoted text' export 2>/dev/null -eu test /usr/bin then then cd readonly
+	then export then export awk ${HOME}
+	cd && awk ${HOME} local --verbose && && echo "$1" export readonly
+		"$1" ${HOME} test awk && printf local 'quoted text' echo x=1
+	done /usr/bin 'quoted text'
+test -eu cd awk ${HOME} readonly done test 'quoted text' grep awk "$1" $(pwd)
+		export test sed sed x=1 test "$1" $(pwd) x=1 then /usr/bin /usr/bin test "$1"
+	&& export cd sed printf awk grep test readonly "$@"
+	&& echo readonly ${HOME} then x=1 $(pwd) -eu local 2>/dev/null
+		&& 2>/dev/null echo ${HOME} echo && && /usr/bin $(pwd) printf
+	/usr/bin 2>/dev/null 'quoted text' ${HOME} then echo
+printf | local export $(pwd) "$@" cd -eu sed printf && local && test
+	'quoted text' && ${HOME} readonly export
+-eu "$@" ${HOME} test then x=1 sed x=1 2>/dev/null ${HOME} x=1 /usr/bin
+/usr/bin ${HOME} $(pwd) 2>/dev/null export cd 2>/dev/null export readonly readonly
+	printf then -eu printf "$1" export "$@" -eu awk "$@" |
+		done 'quoted text' printf /usr/bin test ${HOME} sed
+	export cd then 2>/dev/null then sed printf "$@" echo
+sed export 'quoted text' printf
+grep | $(pwd) local 2>/dev/null && 'quoted text'
+-eu x=1 --verbose 'quoted text' done /usr/bin awk readonly
+	done 2>/dev/null awk printf | "$@" readonly echo awk --verbose test then --verbose
+		&& cd grep $(pwd) awk readonly "$1"
+	2>/dev/null grep grep && -eu local --verbose "$@" | $(pwd) local cd readonly
+		${HOME} test 2>/dev/null && "$@" && then printf "$1" 2>/dev/null
+	readonly ${HOME} $(pwd) export
+		${HOME} done done export awk then
+export x=1 printf --verbose cd 'quoted text' --verbose cd 'quoted text' cd
+	x=1 readonly /usr/bin test "$1" echo grep done 'quoted text' ${HOME}
+		done $(pwd) | ${HOME} 2>/dev/null 'quoted text' then /usr/bin 'quoted text'
+| /usr/bin test grep --verbose
+local $(pwd) awk readonly awk && echo printf then echo printf 'quoted text'
+		2>/dev/null awk | test 2>/dev/null "$1" -eu
+	export 2>/dev/null export test local 'quoted text' cd ${HOME}
+done sed /usr/bin echo "$1" cd then awk grep "$1" x=1
+		sed $(pwd) echo /usr/bin && echo
+| && then then done then echo echo --verbose
+"$1" 2>/dev/null done readonly x=1
+	| | $(pwd) echo 'quoted text' grep
+		echo ${HOME} 2>/dev/null done --verbose test /usr/bin done awk local test 'quoted text'
+		done test done cd "$1" awk ${HOME} export $(pwd) done cd /usr/bin awk
+		printf ${HOME} test cd ${HOME} done then local cd echo test "$1" "$1" cd then
+		2>/dev/null then test done export
+	export readonly 2>/dev/null /usr/bin printf && "$1" --verbose 'quoted text'
+cd test grep grep && && -eu $(pwd) test
+		done done grep "$@" /usr/bin readonly x=1
+		-eu local /usr/bin ${HOME}
+	then -eu | cd test then echo
+awk readonly --verbose awk export -eu grep -eu "$1" 'quoted text' cd
+		local grep then cd readonly "$@" | grep done sed
+2>/dev/null -eu 2>/dev/null "$@" $(pwd) --verbose /usr/bin
+--verbose "$1" && /usr/bin 'quoted text'
+	done 'quoted text' export local | cd | export then ${HOME}
+	awk then awk "$@" export -eu test export && x=1 cd 'quoted text'
+	| 2>/dev/null 'quoted text' "$1" test then 2>/dev/null
+	printf printf -eu 'quoted text' ${HOME}
+${HOME} && echo "$@" 'quoted text' -eu "$@" "$@" awk awk
+$(pwd) 'quoted text' 'quoted text' local && then -eu $(pwd) && | echo printf
+		awk sed sed test done $(pwd) done export 2>/dev/null |
+		--verbose export grep awk awk
+	export cd done "$@" then "$@" cd cd done done
+sed test printf 'quoted text' echo readonly test printf
+	/usr/bin grep | test echo echo grep -eu readonly local
+echo -eu readonly sed | --verbose
+	| ${HOME} ${HOME} x=1 cd && --verbose echo local | then ${HOME}
+	"$@" test && /usr/bin 2>/dev/null | readonly done done -eu export
+then 2>/dev/null sed done readonly
+	&& grep && ${HOME} then awk cd 2>/dev/null x=1
+"$1" local echo ${HOME}
+	readonly echo "$@" then 2>/dev/null cd cd x=1 grep grep 2>/dev/null | sed && $(pwd)
+echo "$@" done ${HOME} then 'quoted text' local grep /usr/bin
+	/usr/bin -eu | test sed cd 'quoted text'
+		test 2>/dev/null echo awk && sed $(pwd) echo -eu local ${HOME} awk
+2>/dev/null then && sed && grep test
+${HOME} awk 'quoted text' readonly
+	then sed echo ${HOME} then ${HOME} printf readonly readonly /usr/bin
+x=1 "$@" sed "$1" awk 'quoted text' grep printf export sed | "$1" && test
+echo "$@" cd sed export done --verbose
+	| /usr/bin && cd 2>/dev/null export ${HOME} sed | -eu echo ${HOME} --verbose done
+		/usr/bin -eu ${HOME} printf done sed test cd cd local 'quoted text'
+		| --verbose awk && local
+awk echo echo 2>/dev/null local awk --verbose test 'quoted text' printf
+cd -eu 2>/dev/null cd 2>/dev/null
+echo printf && grep cd -eu "$1" readonly printf
+grep "$@" printf local readonly local --verbose
+/usr/bin printf local && 2>/dev/null export sed
+	then ${HOME} 'quoted text' echo -eu -eu 'quoted text' sed "$1"
+		grep --verbose "$1" cd $(pwd) sed 'quoted text' test grep $(pwd)
+	done "$@" 2>/dev/null -eu 2>/dev/null
+		grep 2>/dev/null x=1 echo -eu ${HOME} printf cd x=1 'quoted text' 2>/dev/null
+		printf echo x=1 test | 2>/dev/null done awk awk "$@"
+/usr/bin export --verbose
+	echo cd --verbose /usr/bin awk
+2>/dev/null local "$1" 2>/dev/null test printf /usr/bin printf awk |
+readonly "$1" echo "$@" done $(pwd) --verbose x=1 cd 2>/dev/null
+x=1 sed $(pwd) "$@" | 'quoted text'
+$(pwd) readonly --verbose then grep grep --verbose cd "$1" export
+x=1 readonly $(pwd) ${HOME} awk cd export "$1"
+then sed readonly ${HOME} ${HOME} sed test cd --verbose
+		test grep echo sed 2>/dev/null grep sed ${HOME} -eu && grep
+local && "$1" done /usr/bin "$@" | export -eu cd && then echo printf printf export
+		local | grep readonly 'quoted text'
+test ${HOME} local "$1" printf -eu "$1" --verbose 'quoted text'
+		awk 2>/dev/null sed -eu -eu --verbose "$@" sed 2>/dev/null
+		${HOME} export export ${HOME} printf awk done
+		cd 'quoted text' ${HOME} readonly local test --verbose /usr/bin
+sed /usr/bin printf 2>/dev/null -eu /usr/bin | readonly readonly
+	"$@" ${HOME} cd 'quoted text' | readonly
+		&& x=1 test echo readonly readonly 'quoted text' grep sed
+	-eu "$@" local -eu done ${HOME} echo x=1 export && printf local
+	readonly then awk echo x=1 "$@" printf printf 2>/dev/null $(pwd) /usr/bin
+x=1 | grep sed 'quoted text' printf
+'quoted text' | 'quoted text' readonly then test printf echo local cd ${HOME}
+	"$1" export /usr/bin $(pwd) echo |
+	/usr/bin grep | --verbose "$1" readonly --verbose
+		printf echo test awk /usr/bin --verbose
+	export /usr/bin 2>/dev/null ${HOME} grep x=1 then test echo x=1 grep local
+readonly test printf printf awk -eu local
+2>/dev/null test export echo 2>/dev/null done awk echo done echo done "$1"
+		sed awk ${HOME} done echo 'quoted text' /usr/bin
+	"$@" done $(pwd) awk "$@" test --verbose x=1 then cd
+sed grep sed 'quoted text' "$1" cd 'quoted text' then sed x=1 printf 2>/dev/null
+		/usr/bin test grep cd /usr/bin echo export readonly "$1" then sed
+printf $(pwd) $(pwd) $(pwd) done 2>/dev/null grep export awk printf
+export $(pwd) x=1 grep x=1 local $(pwd) | done printf export /usr/bin --verbose
+"$@" printf 2>/dev/null /usr/bin && local | x=1 -eu
+x=1 local | then x=1 test
+2>/dev/null export -eu /usr/bin x=1 sed grep 2>/dev/null
+		"$@" /usr/bin ${HOME}
+		test "$@" done cd awk -eu sed -eu printf ${HOME} "$1"
+		-eu test 'quoted text' done $(pwd) && ${HOME} 2>/dev/null
+&& 'quoted text' /usr/bin "$1" printf x=1 then then
+		readonly grep 2>/dev/null "$1" /usr/bin
+		x=1 'quoted text' awk test local sed done "$1" 2>/dev/null
+grep awk && && awk /usr/bin /usr/bin "$@" /usr/bin
+printf readonly export && printf echo "$1" | sed grep test -eu 'quoted text'
+		test /usr/bin && 'quoted text' local x=1 --verbose ${HOME}
+		done ${HOME} then done then awk
+echo /usr/bin | printf grep && test
+	$(pwd) done 'quoted text' local $(pwd) 'quoted text'
+		export done awk && printf $(pwd) ${HOME}
+	$(pwd) test ${HOME} echo test echo echo test test 2>/dev/null --verbose $(pwd)
+	done $(pwd) "$@" awk 2>/dev/null
+	2>/dev/null "$@" local local printf && $(pwd) done && done --verbose
+	local ${HOME} test 'quoted text'
+$(pwd) cd "$@" | then printf test | grep done printf && sed done /usr/bin $(pwd)
+		"$1" printf then x=1 /usr/bin done ${HOME} "$1" then test awk
+		export ${HOME} awk local $(pwd) then /usr/bin
+		/usr/bin local done awk grep readonly test
+"$1" ${HOME} 'quoted text' awk ${HOME} $(pwd) $(pwd)
+sed --verbose export /usr/bin ${HOME} local
+grep -eu -eu awk local local --verbose | 'quoted text' ${HOME} export sed
+then local | /usr/bin && grep test
+	done sed export done readonly then &&
+		2>/dev/null printf 2>/dev/null printf "$@" --verbose | local local
+-eu done cd printf local local cd "$1" awk "$1" /usr/bin printf test
+sed /usr/bin printf 2>/dev/null local 'quoted text'
+		2>/dev/null --verbose x=1 --verbose awk "$@" "$1" cd $(pwd) "$@"
+		local x=1 printf test $(pwd)
+sed --verbose done --verbose | ${HOME}
+		${HOME} test readonly printf
+		| export echo export export "$1" cd 'quoted text'
+readonly --verbose | export test "$1" then "$1" awk awk export sed /usr/bin
+		${HOME} test $(pwd) ${HOME} $(pwd) $(pwd) export --verbose sed $(pwd)
+		'quoted text' grep x=1 readonly awk sed cd done |
+	awk 2>/dev/null readonly then
+		export ${HOME} local 'quoted text' awk ${HOME} x=1 grep
+	--verbose $(pwd) printf printf readonly sed ${HOME} "$@" x=1
+	done /usr/bin --verbose echo export x=1 2>/dev/null local printf x=1 test
+	cd $(pwd) awk /usr/bin local done 2>/dev/null printf $(pwd) printf awk then
+	"$1" -eu sed 2>/dev/null echo && "$1" export --verbose
+		done readonly sed --verbose then
+	done echo -eu | cd printf $(pwd) && /usr/bin
+		sed 'quoted text' x=1 grep 'quoted text'
+	grep x=1 "$@" then && export grep ${HOME} 'quoted text' "$1" sed done
+		/usr/bin 'quoted text' test grep export -eu /usr/bin
+test awk ${HOME} printf cd export grep sed
+	--verbose 2>/dev/null sed $(pwd) awk done ${HOME}
+		local 2>/dev/null --verbose x=1
+		then 2>/dev/null done then
+		printf then 'quoted text' echo then printf test awk
+&& done 'quoted text' local && then x=1 printf "$1" ${HOME} "$1" then
+$(pwd) -eu x=1 then "$@" echo ${HOME} awk local sed $(pwd) /usr/bin awk
+		test $(pwd) awk /usr/bin x=1 then echo ${HOME} ${HOME} "$@"
+done then 'quoted text' grep local $(pwd) x=1 then -eu echo $(pwd)
+		local -eu test then $(pwd) | done
+"$1" --verbose 'quoted text' readonly readonly cd export export
+		"$@" cd --verbose /usr/bin $(pwd) | "$1" done "$@" awk printf printf readonly
+		$(pwd) printf grep "$1" awk then sed && x=1 'quoted text'
+	grep cd "$@" done test sed then x=1 /usr/bin
+awk test printf 2>/dev/null -eu readonly x=1 sed readonly
+then sed $(pwd) "$@" awk | "$@" "$@" --verbose "$@" | 'quoted text' | grep
+	&& ${HOME} export && "$@" sed echo x=1 -eu test x=1 readonly echo ${HOME}
+	2>/dev/null -eu 2>/dev/null local test
+	grep readonly done awk printf $(pwd) echo then ${HOME} readonly | done
+	| local grep then && 'quoted text' grep 'quoted text'
+	grep done "$1" then test readonly x=1
+cd local test sed grep -eu sed x=1 echo
+		"$@" done export $(pwd) "$1" | local then sed /usr/bin
+		local ${HOME} local test printf test sed ${HOME} $(pwd) "$@" done export -eu
+	export printf readonly $(pwd) test test readonly sed readonly 2>/dev/null
+readonly export -eu 2>/dev/null -eu grep | test
+	readonly 2>/dev/null sed "$@" then
+	"$1" /usr/bin /usr/bin cd readonly 2>/dev/null /usr/bin 2>/dev/null "$1" sed
+	| done readonly --verbose printf echo readonly "$1" 2>/dev/null
+		cd sed test | $(pwd) printf
+	awk cd export -eu ${HOME} -eu sed --verbose
@@ -0,0 +1,2001 @@
+		x=1 x=1 local /usr/bin $(pwd) /usr/bin
+"$@" | /usr/bin cd local sed local x=1 && -eu printf then $(pwd)
+	x=1 local export | readonly then local --verbose 'quoted text' awk
+x=1 --verbose | 2>/dev/null | cd 'quoted text' "$@" then $(pwd)
+		2>/dev/null /usr/bin echo 'quoted text' grep "$1" | -eu export
+echo && "$1" then "$@" cd sed && /usr/bin local
+		done $(pwd) --verbose x=1 local "$1" awk && grep x=1 printf awk test 'quoted text'
+		"$@" 'quoted text' sed &&
+awk then /usr/bin local grep
+	echo test printf $(pwd) awk ${HOME} echo cd "$1" sed "$@" | &&
+printf ${HOME} sed export awk export -eu done "$@" export 'quoted text'
+local --verbose grep ${HOME} /usr/bin test local 2>/dev/null cd | then /usr/bin
+readonly test 2>/dev/null printf "$@"
+		"$1" awk test export -eu export --verbose test 2>/dev/null awk
+	2>/dev/null echo done --verbose 2>/dev/null "$1" done done "$1"
+"$1" $(pwd) 2>/dev/null $(pwd) --verbose echo cd readonly local "$@" "$@"
+	sed && 'quoted text' --verbose $(pwd)
+	done x=1 --verbose cd echo -eu then cd test done then echo printf
+	${HOME} printf && 'quoted text' &&
+	awk --verbose then done | 'quoted text'
+$(pwd) sed | $(pwd) test x=1 'quoted text' "$1"
+-eu readonly "$@" x=1 test /usr/bin 2>/dev/null sed --verbose -eu
+		export ${HOME} local cd echo printf
+	sed /usr/bin readonly test
+$(pwd) ${HOME} --verbose $(pwd) | --verbose printf
+${HOME} && /usr/bin -eu && cd -eu echo test "$1" x=1 export $(pwd) --verbose
+"$1" readonly local && "$1" test | test /usr/bin done cd 2>/dev/null
+	sed grep ${HOME} --verbose 2>/dev/null x=1
+	readonly 'quoted text' printf && --verbose /usr/bin awk --verbose
+	&& ${HOME} test grep 'quoted text' export 2>/dev/null
+		grep awk | | $(pwd) done | export $(pwd) readonly then -eu sed "$@" && ${HOME}
+		| grep | sed export grep -eu
+	grep "$1" /usr/bin echo export printf 2>/dev/null test 'quoted text'
+	/usr/bin 2>/dev/null sed printf test 'quoted text'
+	$(pwd) then done | printf done && -eu x=1 then --verbose
+'quoted text' /usr/bin readonly echo /usr/bin x=1
+		/usr/bin grep export done && "$1" printf && $(pwd) -eu "$@" then $(pwd)
+		| awk local echo ${HOME} grep cd 'quoted text'
+		local readonly then export sed sed grep export x=1 local "$@" ${HOME} 'quoted text'
+	grep local x=1 x=1 local /usr/bin
+then echo test 'quoted text'
+		${HOME} -eu sed local "$1" ${HOME} awk test $(pwd) "$1" sed readonly -eu x=1 x=1
+		echo printf grep done cd --verbose --verbose "$@" --verbose readonly local
+	sed printf && /usr/bin $(pwd) "$1" 2>/dev/null | --verbose
+	-eu "$@" /usr/bin "$@" cd readonly "$1" $(pwd) -eu $(pwd) awk
+awk | --verbose $(pwd) 2>/dev/null
+	"$@" readonly | readonly && && printf
+	echo printf x=1 grep x=1 && && --verbose local && sed export then cd 'quoted text'
+		${HOME} 2>/dev/null cd export then then test | export readonly
+	'quoted text' export /usr/bin
+	-eu && test /usr/bin local then "$1" grep $(pwd)
+	--verbose local -eu cd /usr/bin done sed --verbose 2>/dev/null "$@"
+		then echo 2>/dev/null x=1 grep
+	cd /usr/bin cd x=1 'quoted text' ${HOME} x=1 --verbose
+		sed export "$1" grep 2>/dev/null
+		local local 'quoted text' 'quoted text' --verbose echo echo 'quoted text'
+		x=1 2>/dev/null "$@" x=1 cd echo sed $(pwd)
+	done awk test cd awk cd then "$@" done /usr/bin | "$@"
+	echo /usr/bin printf ${HOME} | $(pwd)
+	-eu awk "$@" --verbose $(pwd) done printf
+		done printf grep $(pwd) cd "$1" then readonly export export x=1 --verbose
+readonly grep x=1 -eu /usr/bin
+"$1" cd $(pwd) /usr/bin printf -eu --verbose /usr/bin
+		cd then 2>/dev/null cd | $(pwd) done readonly
+		local x=1 && --verbose x=1 /usr/bin sed && /usr/bin x=1 test "$@" printf local
+${HOME} /usr/bin sed -eu readonly && "$1" local 2>/dev/null "$1" readonly --verbose
+		local grep cd "$@" test "$1"
+		cd "$1" "$@" $(pwd) "$@" "$1" done printf && -eu $(pwd) test "$@" local 2>/dev/null
+	export 'quoted text' 'quoted text' | 'quoted text' &&
+		"$@" readonly --verbose "$@" export done -eu grep sed 'quoted text'
+2>/dev/null | ${HOME} -eu grep "$@" test cd awk cd /usr/bin done echo | && x=1
+readonly sed $(pwd) done | "$@" echo cd 2>/dev/null
+	'quoted text' cd 'quoted text'
+		awk && --verbose "$1" echo awk x=1 /usr/bin && printf then $(pwd) | export
+		/usr/bin export cd "$@" /usr/bin cd -eu 'quoted text' --verbose
+local done cd cd echo export export printf readonly
+		awk /usr/bin test 'quoted text'
+	--verbose --verbose | --verbose && sed printf cd && printf $(pwd) local
+	awk --verbose export -eu test "$@" -eu "$@" echo $(pwd) awk readonly grep
+		echo test export then "$@" sed -eu sed local grep "$1"
+		test printf readonly grep export readonly sed then -eu grep /usr/bin
+	readonly | test && $(pwd)
+	&& 'quoted text' /usr/bin test
+		2>/dev/null test | /usr/bin $(pwd)
+		/usr/bin x=1 awk "$@" -eu --verbose
+		/usr/bin -eu grep printf "$1" 2>/dev/null awk "$1"
+echo grep && cd test readonly awk awk
+	cd x=1 && $(pwd) x=1 ${HOME} 2>/dev/null test local 2>/dev/null --verbose 'quoted text'
+	local | 'quoted text' printf --verbose | echo --verbose 2>/dev/null 2>/dev/null
+		sed | sed --verbose awk
+	"$1" --verbose 'quoted text' | --verbose
+&& $(pwd) && echo cd | readonly 'quoted text'
+	done local grep --verbose ${HOME} then -eu cd echo $(pwd) 2>/dev/null echo x=1
+		${HOME} local done /usr/bin 2>/dev/null x=1 2>/dev/null
+	'quoted text' export done "$@" | 'quoted text' grep $(pwd) grep
+	done --verbose done x=1 "$@" && -eu | echo awk && awk ${HOME}
+		-eu --verbose test 'quoted text'
+export echo test 2>/dev/null then "$@" $(pwd) echo x=1
+	"$@" | ${HOME} test ${HOME} "$1" local | x=1 $(pwd)
+export x=1 "$1" && cd | done then test echo printf local && x=1 /usr/bin -eu export
+		awk awk | && printf -eu && 'quoted text' done local -eu | 'quoted text'
+$(pwd) "$1" echo -eu done --verbose done grep then done -eu grep
+cd test export | --verbose awk cd /usr/bin
+		--verbose x=1 export "$1" grep export 'quoted text' echo
+	-eu --verbose x=1 echo && && then ${HOME} | ${HOME} test "$1" "$@"
+echo /usr/bin export cd readonly -eu
+done printf cd "$1" && readonly "$1" sed readonly
+	-eu && 2>/dev/null export && x=1 done ${HOME} printf readonly | awk
+	local $(pwd) test 2>/dev/null 'quoted text'
+		${HOME} /usr/bin echo local local "$1" $(pwd) cd -eu -eu cd 2>/dev/null cd
+	readonly cd /usr/bin "$@" ${HOME}
+		then printf && done ${HOME} -eu /usr/bin grep local ${HOME} /usr/bin sed && "$1"
+	| "$1" -eu && | export then /usr/bin
+	2>/dev/null echo test --verbose then sed awk
+		&& "$@" && x=1 printf ${HOME} export grep done grep && printf
+/usr/bin readonly $(pwd) && ${HOME} /usr/bin 2>/dev/null
+		done -eu test printf "$1" readonly done test /usr/bin -eu sed --verbose
+	printf -eu "$@" sed ${HOME} local "$1" && 'quoted text' local
+		readonly ${HOME} awk -eu test then x=1 --verbose ${HOME} | /usr/bin
+		'quoted text' echo done awk local done sed local "$@"
+printf sed printf $(pwd) 2>/dev/null local export /usr/bin 2>/dev/null
+| printf --verbose && readonly "$@" $(pwd) --verbose awk then
+awk /usr/bin cd printf 'quoted text' readonly done /usr/bin local 2>/dev/null "$1"
+${HOME} -eu --verbose && 2>/dev/null
+"$@" $(pwd) then ${HOME} then cd $(pwd)
+	&& -eu readonly "$1" local x=1 test x=1 ${HOME} 2>/dev/null ${HOME} 2>/dev/null
+local echo done "$@" done
+'quoted text' local grep $(pwd) printf
+	printf grep -eu $(pwd) 'quoted text' 2>/dev/null "$@" 2>/dev/null
+2>/dev/null -eu "$@" readonly then sed &&
+	x=1 "$1" awk then awk done awk 'quoted text' -eu "$@" /usr/bin
+	"$@" --verbose then --verbose then printf local done cd printf x=1 2>/dev/null
+	grep "$@" awk "$1" -eu x=1 $(pwd) done test echo export readonly awk "$1" $(pwd)
+		grep cd export test grep $(pwd) 2>/dev/null sed grep local
+		readonly 2>/dev/null --verbose grep echo local export grep local local
+	--verbose export --verbose local -eu 'quoted text' 'quoted text'
+	sed awk readonly sed done export --verbose
+	| --verbose then done /usr/bin
+	$(pwd) && done --verbose grep local "$1" 'quoted text'
+		export grep $(pwd) ${HOME}
+		export then "$1" grep -eu
+printf then x=1 'quoted text' 'quoted text' && | awk sed -eu
+	&& /usr/bin test sed echo "$@"
+test "$@" done awk cd printf $(pwd)
+		"$1" --verbose test 2>/dev/null awk export "$@" then
+	x=1 $(pwd) grep 2>/dev/null local
+	"$@" local export --verbose then grep export
+		${HOME} && --verbose 2>/dev/null awk test "$@"
+		/usr/bin local $(pwd) --verbose "$@" $(pwd) $(pwd) export 2>/dev/null /usr/bin
+	readonly /usr/bin $(pwd) "$1"
+		export -eu /usr/bin readonly readonly
+		-eu cd ${HOME} "$@" awk test
+	sed "$1" /usr/bin echo printf
+		$(pwd) | echo readonly grep 'quoted text' grep export 'quoted text'
+	sed grep printf $(pwd) ${HOME} 2>/dev/null
+	local && "$1" readonly done ${HOME} test --verbose cd done | "$@" done export
+		sed local grep 'quoted text' printf && 'quoted text' printf test ${HOME}
+		x=1 local --verbose test $(pwd) readonly /usr/bin test echo sed 'quoted text'
+	"$1" local local --verbose
+		sed ${HOME} grep /usr/bin done
+	echo && $(pwd) echo /usr/bin readonly done awk grep readonly -eu
+		/usr/bin export $(pwd) /usr/bin awk $(pwd) "$@" "$@" export export awk 'quoted text'
+grep 'quoted text' local
+then ${HOME} local --verbose
+	local /usr/bin done $(pwd)
+	then "$@" $(pwd) awk cd x=1 ${HOME} "$@"
+		export $(pwd) x=1 && --verbose 'quoted text' then "$1" done cd &&
+	"$1" done --verbose printf done --verbose $(pwd) 2>/dev/null local && &&
+	local awk --verbose export 'quoted text' | /usr/bin
+	"$@" "$1" "$1" grep /usr/bin --verbose cd --verbose x=1 /usr/bin x=1
+		test test 'quoted text' x=1 awk ${HOME} echo readonly
+"$@" "$1" "$@" cd --verbose | x=1 export
+		--verbose --verbose ${HOME} $(pwd) export test export "$1"
+$(pwd) | sed sed ${HOME} && --verbose done ${HOME}
+/usr/bin $(pwd) /usr/bin
+printf cd done echo ${HOME} x=1 'quoted text' sed 2>/dev/null
+	sed echo --verbose --verbose then | cd /usr/bin x=1 then
+awk --verbose echo | "$@" -eu "$@" then 2>/dev/null
+		readonly grep readonly
+		awk x=1 printf ${HOME} --verbose ${HOME} echo ${HOME} 'quoted text' grep
+		cd awk x=1 sed 'quoted text' awk done
+awk printf export cd then
+		x=1 "$1" 2>/dev/null local echo
+		/usr/bin test awk --verbose then x=1 readonly test 2>/dev/null
+	cd readonly cd sed sed -eu && printf
+	awk -eu awk x=1 then echo local "$1" $(pwd) | -eu
+	export | $(pwd) then "$@" local local local 2>/dev/null |
+	&& -eu local /usr/bin echo printf && cd 'quoted text'
+		readonly -eu && ${HOME} ${HOME}
+		"$1" -eu "$@" test -eu && 'quoted text'
+	--verbose x=1 $(pwd) grep sed sed
+	grep done -eu export sed "$1" "$1"
+		local ${HOME} -eu | /usr/bin echo && grep -eu grep -eu "$1" /usr/bin | readonly
+echo readonly readonly x=1 --verbose x=1 grep export 'quoted text' then |
+	awk 2>/dev/null export grep
+	--verbose done grep && /usr/bin
+	then then local done grep /usr/bin
+	"$@" /usr/bin -eu then "$1" "$1" $(pwd) "$@" then -eu "$@" grep
+		/usr/bin 'quoted text' --verbose 'quoted text'
+		${HOME} "$1" --verbose cd x=1 ${HOME} | then -eu readonly sed export export
+		done /usr/bin ${HOME} "$@" --verbose
+	"$@" ${HOME} readonly printf 'quoted text'
+		${HOME} test 'quoted text' local printf cd -eu "$1" readonly "$1" cd
+readonly sed sed /usr/bin sed test
+$(pwd) | sed test cd "$@" 2>/dev/null
+echo printf "$1" sed x=1 && export $(pwd) sed echo $(pwd) local
+&& printf echo "$1" done --verbose echo grep "$@" test /usr/bin $(pwd) sed
+		local /usr/bin 'quoted text' x=1
+$(pwd) "$1" && cd grep /usr/bin "$@"
+	echo export ${HOME} -eu test x=1
+&& grep export sed 'quoted text' --verbose -eu 2>/dev/null /usr/bin
+	-eu --verbose "$1" --verbose x=1 'quoted text'
+		local /usr/bin | && printf ${HOME} done export /usr/bin cd $(pwd) cd test readonly
+$(pwd) cd -eu grep x=1 "$1"
+		done -eu sed 2>/dev/null --verbose 2>/dev/null
+	${HOME} $(pwd) grep then echo export -eu
+"$@" local done echo /usr/bin test readonly
+done then export then
+		test 2>/dev/null awk -eu then --verbose
+		/usr/bin ${HOME} -eu export --verbose test readonly then local x=1 2>/dev/null
+	awk | "$@" local sed x=1 -eu && local "$@"
+	readonly printf sed sed sed done local done
+		| -eu x=1 && /usr/bin local 2>/dev/null "$@" export done $(pwd) test printf
+		grep printf awk then local sed test test grep test readonly
+		grep echo cd printf export cd sed | /usr/bin "$@" cd readonly 2>/dev/null
+printf echo ${HOME} grep printf export $(pwd)
+-eu ${HOME} readonly readonly 'quoted text' readonly printf cd awk readonly &&
+	local readonly "$@" cd && "$@" printf then "$@"
+/usr/bin ${HOME} grep sed ${HOME} 2>/dev/null local
+		done awk 'quoted text' 2>/dev/null cd $(pwd) && 'quoted text' printf
+	test /usr/bin "$@" --verbose echo
+'quoted text' sed test ${HOME} && test local $(pwd) printf
+	sed -eu grep && export sed export x=1 x=1 -eu /usr/bin 2>/dev/null grep |
+	${HOME} && "$@" printf awk "$1" $(pwd) awk 2>/dev/null echo ${HOME}
+		then awk local export /usr/bin 'quoted text' /usr/bin test && grep
+local /usr/bin x=1 2>/dev/null printf sed --verbose
+		grep echo && && --verbose
+	-eu test "$1" cd --verbose echo done
+	$(pwd) printf done done echo | 'quoted text'
+	| -eu "$1" -eu grep test local printf ${HOME} awk 'quoted text'
+		printf grep /usr/bin "$@" "$1" export sed test export x=1
+		$(pwd) done export x=1 awk x=1 readonly ${HOME} 2>/dev/null cd && $(pwd) --verbose
+-eu then cd ${HOME} 'quoted text' then grep printf 'quoted text'
+--verbose /usr/bin | sed --verbose /usr/bin sed "$1" cd && /usr/bin | awk
+	cd then export echo ${HOME} cd /usr/bin cd x=1 && -eu done then
+	'quoted text' $(pwd) x=1 printf
+printf "$@" done printf done ${HOME}
+		done && "$1" /usr/bin sed && then ${HOME}
+readonly /usr/bin local x=1 then $(pwd) done | echo done "$@" "$1" ${HOME}
+		readonly 2>/dev/null && 2>/dev/null test x=1 --verbose then -eu && "$1"
+	done awk export local printf sed echo | readonly readonly
+echo printf local done "$1" -eu 'quoted text' --verbose then
+	echo done cd --verbose "$1" readonly "$1" awk ${HOME} grep
+		$(pwd) then export sed local /usr/bin -eu 2>/dev/null
+readonly grep export then | "$@" "$@" export
+		grep sed test "$@" --verbose
+	test x=1 grep "$@" awk done -eu export && $(pwd) done ${HOME} local $(pwd) sed
+	then 2>/dev/null 'quoted text'
+	| 2>/dev/null local sed test 'quoted text' 2>/dev/null
+		"$@" $(pwd) 2>/dev/null echo local 'quoted text' sed $(pwd) 2>/dev/null grep
+		2>/dev/null grep test 'quoted text' printf -eu 2>/dev/null local "$@"
+then $(pwd) done "$1" -eu grep printf done echo local export --verbose
+		&& cd test && | --verbose ${HOME} printf sed "$@" test grep /usr/bin test grep
+awk $(pwd) awk 'quoted text' sed "$1" grep -eu
+		${HOME} "$1" readonly readonly sed x=1
+	awk readonly test | --verbose ${HOME} -eu x=1 ${HOME} echo
+	printf then | grep echo /usr/bin "$@" --verbose grep | export
+		echo done test 'quoted text' | | --verbose -eu then
+		2>/dev/null test local -eu sed && readonly "$@" awk "$1" "$1" printf "$@"
+printf awk x=1 /usr/bin test ${HOME} local printf sed ${HOME}
+printf 'quoted text' | ${HOME} "$@" $(pwd) local
+		$(pwd) grep awk ${HOME} $(pwd) x=1 sed sed readonly sed
+	printf grep readonly then local awk "$1" ${HOME} "$@"
+		awk export sed export /usr/bin awk awk
+	2>/dev/null x=1 done then readonly test awk ${HOME}
+	awk then /usr/bin test readonly grep $(pwd) "$1" --verbose then 2>/dev/null export
+| cd export | grep -eu 'quoted text' grep
+		grep ${HOME} echo local awk echo /usr/bin export
+	done local && 'quoted text' -eu then -eu | test 'quoted text'
+		2>/dev/null done sed grep | export "$1"
+	awk | 2>/dev/null $(pwd) done 'quoted text' "$@" 'quoted text'
+/usr/bin | 'quoted text' then -eu awk
+	grep "$@" "$@" "$1" && --verbose
+readonly then export cd sed 2>/dev/null local sed sed
+echo 2>/dev/null 'quoted text'
+		2>/dev/null -eu /usr/bin x=1 2>/dev/null
+then done sed "$@" --verbose sed --verbose printf /usr/bin
+	local --verbose "$@" 2>/dev/null 'quoted text'
+	2>/dev/null readonly then $(pwd) cd -eu
+		printf cd -eu echo done $(pwd) | export
+	x=1 cd awk "$1" x=1 x=1 readonly awk 2>/dev/null x=1 --verbose | /usr/bin echo
+x=1 awk awk ${HOME} test echo
+		test --verbose echo sed | $(pwd) --verbose
+	done ${HOME} grep | ${HOME} /usr/bin done
+	then "$@" | readonly readonly done export test | sed "$1" --verbose
+test && local $(pwd) printf grep export "$@" awk done cd --verbose --verbose awk
+/usr/bin /usr/bin local 2>/dev/null sed --verbose 'quoted text'
+		awk 2>/dev/null readonly readonly
+	"$@" x=1 2>/dev/null ${HOME} --verbose && /usr/bin "$1" done "$1" "$@"
+	"$@" | sed cd "$1" /usr/bin ${HOME} cd
+		grep | && 'quoted text'
+		"$@" 2>/dev/null then test $(pwd) --verbose 2>/dev/null -eu
+		/usr/bin 'quoted text' "$@" $(pwd) 2>/dev/null "$1" -eu 2>/dev/null printf 2>/dev/null
+	sed ${HOME} then then --verbose
+	then /usr/bin && x=1 readonly --verbose awk | grep "$1" echo x=1 | "$1" local
+		2>/dev/null --verbose awk
+	| 'quoted text' "$@" $(pwd) then test
+		echo --verbose grep echo /usr/bin
+	"$@" readonly --verbose x=1 sed "$@" && "$1" $(pwd) "$@"
+	'quoted text' printf | -eu export $(pwd) test --verbose grep "$@"
+cd && done "$1" sed export readonly "$@" -eu
+	/usr/bin awk x=1 export
+	$(pwd) /usr/bin sed --verbose x=1 readonly done export $(pwd) --verbose
+	then -eu then x=1 | printf /usr/bin echo 'quoted text' cd echo "$@" echo
+		$(pwd) test export /usr/bin done cd readonly --verbose
+x=1 echo done printf awk
+"$1" ${HOME} done echo ${HOME} "$1"
+	--verbose cd readonly 2>/dev/null
+| 2>/dev/null "$@" printf export grep -eu done awk local
+| 2>/dev/null | awk ${HOME} && --verbose awk readonly "$1" ${HOME} &&
+	readonly awk cd grep "$1" | local
+--verbose then 'quoted text' printf local && ${HOME} 'quoted text' ${HOME}
+	$(pwd) readonly /usr/bin && test then
+awk printf readonly done $(pwd) -eu ${HOME} done sed
+		| -eu sed printf && $(pwd) 'quoted text' cd --verbose |
+		/usr/bin $(pwd) local --verbose 2>/dev/null readonly
+	-eu awk awk local done test test "$@" readonly
+		then "$1" "$@" then export -eu local readonly
+		local test grep "$1" ${HOME} && echo --verbose
+cd test && readonly ${HOME} 2>/dev/null printf printf
+	x=1 awk readonly awk --verbose awk grep 'quoted text'
+		readonly -eu done x=1 printf /usr/bin 2>/dev/null
+-eu then -eu | sed $(pwd) readonly
+		&& && echo sed --verbose awk done done done export
+		-eu --verbose ${HOME} printf grep export
+		| local sed 'quoted text' then grep /usr/bin grep echo "$1" "$@" $(pwd)
+	/usr/bin /usr/bin | x=1 "$@" /usr/bin done -eu | | local && sed "$1" grep echo
+"$@" echo export ${HOME} sed 'quoted text' $(pwd) test "$@" x=1
+| sed "$@" 'quoted text' x=1 ${HOME} x=1 "$@" $(pwd) --verbose
+		done && local awk awk "$@" local -eu | 'quoted text' --verbose sed awk
+"$@" export local echo --verbose readonly readonly
+	x=1 "$1" ${HOME} cd printf
+cd ${HOME} printf readonly x=1 cd $(pwd) -eu 'quoted text' 2>/dev/null
+		test grep 'quoted text' printf then x=1 export cd $(pwd) grep ${HOME}
+	cd "$1" done cd export -eu done export x=1 sed
+done test printf ${HOME} readonly
+/usr/bin 'quoted text' then "$1" -eu $(pwd) export done 2>/dev/null
+		"$1" | $(pwd) then --verbose export readonly $(pwd) ${HOME} --verbose
+	echo --verbose echo -eu then "$@" readonly readonly awk
+"$1" then && --verbose && $(pwd) "$1" "$1" test awk
+		| grep export awk 2>/dev/null && && test
+	export printf done then ${HOME}
+export grep --verbose | printf then "$1" readonly
+		test printf -eu && | | then ${HOME}
+cd readonly cd printf cd x=1 sed 2>/dev/null "$1" "$@" local --verbose sed local
+	cd cd sed sed printf "$1" -eu $(pwd) export cd && cd ${HOME} sed x=1
+	done "$1" local test 2>/dev/null
+local then cd "$1" grep awk x=1 'quoted text' 2>/dev/null $(pwd) printf && 'quoted text'
+		printf && then local local -eu -eu
+-eu sed echo "$1" export echo ${HOME} "$@"
+echo then done "$@" 2>/dev/null
+&& "$1" ${HOME} local readonly -eu sed $(pwd) --verbose 2>/dev/null && /usr/bin
+	"$@" test then --verbose
+		awk --verbose ${HOME} -eu /usr/bin "$@" "$@" test grep then cd awk
+		-eu export then cd x=1 printf && /usr/bin 2>/dev/null grep grep --verbose
+echo x=1 "$@" grep awk x=1 awk awk $(pwd) sed ${HOME} x=1 ${HOME}
+		done "$1" $(pwd) /usr/bin $(pwd)
+	local x=1 $(pwd) /usr/bin
+		"$1" export ${HOME} "$1" x=1 echo
+		${HOME} ${HOME} "$@" sed ${HOME} && done test /usr/bin awk /usr/bin export
+	export ${HOME} grep /usr/bin then "$1" ${HOME} $(pwd) test 'quoted text' local
+		done done cd export -eu 'quoted text' && printf readonly -eu awk readonly
+"$1" 'quoted text' cd awk "$1" then /usr/bin awk local | && printf
+printf export done --verbose local &&
+		cd grep export ${HOME} grep local test export readonly
+		"$@" /usr/bin $(pwd) /usr/bin local | export $(pwd) && awk --verbose
+	readonly 'quoted text' ${HOME} echo then "$1" local
+-eu cd 'quoted text' "$@" /usr/bin
+2>/dev/null 'quoted text' local && 2>/dev/null $(pwd) ${HOME}
+sed "$@" readonly printf readonly export echo 2>/dev/null "$1" "$@" /usr/bin
+		sed "$1" readonly -eu readonly x=1 export awk then -eu --verbose /usr/bin "$1"
+		&& done "$1" export export local
+	test echo 'quoted text' 'quoted text' readonly "$1" "$1" /usr/bin readonly
+'quoted text' 'quoted text' | done ${HOME} export &&
+		"$1" export awk readonly sed printf $(pwd) x=1 && --verbose awk x=1 $(pwd) printf
+"$1" -eu test awk cd &&
+"$1" $(pwd) 'quoted text' grep -eu readonly -eu
+$(pwd) "$1" then --verbose
+	2>/dev/null x=1 "$@" ${HOME} "$@" --verbose
+	export test printf then | --verbose cd done
+echo done 'quoted text'
+		2>/dev/null then export export awk export
+		awk x=1 local echo then printf test awk x=1
+	-eu sed done then sed "$1" echo
+		'quoted text' awk sed cd x=1 printf 'quoted text' readonly export
+-eu 2>/dev/null cd export "$@" --verbose && x=1 x=1 grep && then x=1 ${HOME} then
+	'quoted text' -eu "$1" | cd x=1 test cd $(pwd)
+		${HOME} awk /usr/bin printf awk printf done test | "$1"
+	local then "$@" x=1 awk
+		echo awk grep | cd /usr/bin
+	test test cd echo "$1" ${HOME} test echo echo
+	$(pwd) sed $(pwd) then x=1 "$1" 2>/dev/null x=1 ${HOME} grep
+		done "$@" 'quoted text' -eu local && echo cd --verbose then echo
+export | -eu $(pwd) 'quoted text' local
+	local done test "$1" x=1 sed ${HOME} local
+		done --verbose $(pwd) awk done "$1" 2>/dev/null | | echo readonly &&
+		-eu | $(pwd) -eu $(pwd) sed printf --verbose --verbose local awk test printf
+--verbose "$1" x=1 -eu cd grep -eu && && x=1 readonly /usr/bin
+--verbose local 2>/dev/null --verbose
+		grep && 2>/dev/null awk export done echo cd /usr/bin export echo done
+"$@" done printf grep readonly
+	awk export ${HOME} --verbose ${HOME} 'quoted text' local
+	awk "$1" local test "$1" "$@" /usr/bin --verbose "$1" --verbose cd -eu
+printf done x=1 grep
+		x=1 echo 2>/dev/null && local printf
+grep sed sed test /usr/bin "$1" /usr/bin cd "$1" /usr/bin | x=1
+	"$@" 'quoted text' "$1" sed && | -eu readonly
+		printf printf test readonly sed -eu "$@" 2>/dev/null cd x=1 $(pwd) --verbose |
+	"$1" && printf awk ${HOME} $(pwd) -eu $(pwd) echo export printf 2>/dev/null
+	| awk --verbose && 'quoted text' | -eu echo -eu done 2>/dev/null &&
+2>/dev/null local "$@" --verbose cd ${HOME} readonly 2>/dev/null
+	x=1 grep /usr/bin 'quoted text'
+	/usr/bin grep test "$1"
+	--verbose test grep x=1 x=1 then $(pwd) 'quoted text' "$1" 2>/dev/null
+	x=1 | awk "$1" "$1" $(pwd)
+	'quoted text' /usr/bin export ${HOME} x=1 echo | |
+		test test x=1 $(pwd) $(pwd) --verbose grep 2>/dev/null
+sed then && "$1" sed grep printf sed grep local -eu
+awk ${HOME} readonly echo sed sed ${HOME} && "$@" "$1" --verbose readonly
+		/usr/bin grep --verbose grep then && | 2>/dev/null 'quoted text' && 2>/dev/null
+| 2>/dev/null printf then then local "$1" x=1
+test 2>/dev/null test cd test $(pwd) && 'quoted text' sed --verbose
+&& echo && && x=1 awk --verbose awk readonly
+		then then sed 2>/dev/null
+export | done 'quoted text' export /usr/bin "$1"
+		-eu && grep awk export
+cd sed cd && | readonly export awk then 2>/dev/null printf local printf
+	&& 2>/dev/null x=1 echo done export awk /usr/bin cd test test /usr/bin /usr/bin
+		2>/dev/null grep | "$1" local readonly cd 'quoted text' sed done x=1 then export
+&& 2>/dev/null test awk done
+		"$1" "$1" sed | printf printf awk echo ${HOME} local | local printf
+	sed $(pwd) printf 2>/dev/null export grep $(pwd) 'quoted text' | &&
+	echo $(pwd) local test && /usr/bin ${HOME}
+	echo done local done && then && $(pwd) grep done "$@" sed grep ${HOME}
+	then ${HOME} done && "$@" test sed
+then readonly then grep readonly readonly grep done /usr/bin $(pwd)
+x=1 /usr/bin readonly cd awk 2>/dev/null /usr/bin $(pwd)
+	test | local readonly echo "$1" export grep then cd ${HOME} grep && 2>/dev/null
+--verbose 'quoted text' cd 'quoted text'
+		sed printf echo local x=1 grep
+		2>/dev/null 'quoted text' /usr/bin 'quoted text' grep
+		awk sed 'quoted text' test 2>/dev/null
+$(pwd) "$1" printf cd 2>/dev/null $(pwd) x=1 -eu printf 'quoted text' /usr/bin
+		test grep "$1" printf sed readonly "$@" x=1 export 'quoted text'
+	2>/dev/null 'quoted text' "$@" /usr/bin local --verbose
+	printf 'quoted text' 'quoted text' ${HOME} grep "$1" ${HOME} grep x=1
+/usr/bin $(pwd) awk printf -eu grep echo $(pwd) && | local readonly x=1 printf
+x=1 printf /usr/bin done export -eu grep "$1" grep echo ${HOME} 'quoted text'
+		done -eu echo cd $(pwd) sed grep done cd x=1 'quoted text' local
+sed "$1" readonly sed export -eu /usr/bin echo -eu grep then
+-eu 'quoted text' "$@" -eu "$@" -eu x=1 cd cd readonly --verbose "$@" x=1 export
+export grep | cd | x=1
+done /usr/bin $(pwd) && $(pwd) local x=1 /usr/bin awk ${HOME} awk export 2>/dev/null
+&& local ${HOME} x=1 local /usr/bin printf $(pwd) grep $(pwd) && readonly
+		$(pwd) export local "$@" grep grep echo ${HOME} |
+		| readonly awk x=1 | ${HOME} printf && | then /usr/bin test --verbose then echo
+	$(pwd) done test echo grep && "$1" local x=1 -eu
+		--verbose "$1" done sed cd
+		then $(pwd) /usr/bin "$1" $(pwd) $(pwd)
+	| | local cd grep | awk -eu export printf -eu -eu /usr/bin grep --verbose --verbose
+${HOME} 'quoted text' 2>/dev/null
+		"$@" test 2>/dev/null 'quoted text' ${HOME} then "$@" /usr/bin grep 'quoted text'
+	2>/dev/null /usr/bin sed -eu done "$1"
+done --verbose --verbose 'quoted text' local ${HOME}
+		test local cd readonly -eu printf cd cd
+		sed done 'quoted text'
+echo done | sed printf $(pwd) && --verbose awk 2>/dev/null
+sed readonly printf local "$@"
+done && 'quoted text' export
+	"$1" | awk then $(pwd) local cd "$@" ${HOME} awk /usr/bin --verbose
+awk "$@" then && "$@" 'quoted text' "$@" 'quoted text'
+printf grep x=1 printf done grep sed cd --verbose -eu $(pwd) local cd x=1 /usr/bin
+	$(pwd) readonly "$@" done x=1 "$@" printf "$1"
+	"$@" cd | export echo readonly echo ${HOME} 2>/dev/null "$@" printf printf "$1"
+		grep export local readonly "$@" 'quoted text' --verbose -eu
+	/usr/bin x=1 && then $(pwd) /usr/bin local
+echo /usr/bin $(pwd) awk local printf $(pwd) test then 2>/dev/null 2>/dev/null
+		${HOME} awk sed readonly awk -eu -eu "$1" -eu sed x=1 /usr/bin
+done test sed x=1 cd "$1" /usr/bin 'quoted text' then
+		--verbose readonly cd grep "$@" awk export /usr/bin $(pwd) "$@" then
+'quoted text' && cd && done then
+		cd --verbose 'quoted text' readonly ${HOME} then
+	test export awk $(pwd) "$1" | && local printf
+	printf "$1" "$@" $(pwd) printf "$@" "$@" export done test --verbose
+	"$1" sed done 2>/dev/null
+		-eu -eu x=1 grep export ${HOME} 'quoted text' "$@" readonly 2>/dev/null
+		${HOME} test test && ${HOME} local -eu
+		--verbose "$@" 'quoted text' printf done 'quoted text' local
+	readonly 'quoted text' ${HOME} done $(pwd) then | && /usr/bin
+awk "$1" readonly awk done echo echo 'quoted text' done 'quoted text'
+"$@" test sed echo ${HOME} awk done 2>/dev/null && done
+		2>/dev/null /usr/bin test test printf local printf ${HOME} | grep cd && done
+		x=1 x=1 readonly sed
+| && "$@" sed --verbose && awk $(pwd) "$@" $(pwd) | x=1 /usr/bin
+'quoted text' 'quoted text' done cd 'quoted text' printf grep 'quoted text'
+		echo -eu /usr/bin local "$1" |
+	awk x=1 --verbose done export sed && "$1" --verbose && $(pwd)
+then echo && x=1 readonly "$1" grep cd 'quoted text' --verbose printf
+		"$1" test test --verbose awk readonly export /usr/bin
+	awk awk ${HOME} export
+/usr/bin printf echo awk export local /usr/bin local test "$1"
+		&& readonly ${HOME} -eu "$1"
+		x=1 | done --verbose -eu 2>/dev/null sed | ${HOME} $(pwd) $(pwd) $(pwd)
+x=1 export /usr/bin local export cd /usr/bin
+	awk grep 'quoted text' test then -eu x=1 readonly export cd local local sed
+"$1" echo x=1 then echo x=1 'quoted text'
+		then && test 'quoted text' readonly awk export && sed x=1 /usr/bin printf
+sed printf | -eu /usr/bin echo 'quoted text' cd 'quoted text' printf
+	sed $(pwd) x=1 && | readonly sed local 2>/dev/null printf
+	test | grep local ${HOME} done local grep && "$1" cd && x=1 x=1 -eu --verbose
+"$1" "$1" export awk cd $(pwd) grep grep ${HOME} sed
+grep | grep -eu cd readonly --verbose && 2>/dev/null $(pwd) printf
+	export local ${HOME} 'quoted text' "$@" "$1" test awk && done local /usr/bin
+	done printf --verbose awk echo
+	test test x=1 "$@" --verbose 'quoted text' sed awk export | awk x=1 readonly done
+		$(pwd) 'quoted text' readonly 2>/dev/null done -eu cd "$1" --verbose /usr/bin cd
+'quoted text' 'quoted text'
+local done awk $(pwd) /usr/bin awk local awk /usr/bin --verbose $(pwd) "$1" x=1
+	test | "$@" local local $(pwd) && cd done test
+printf -eu cd 2>/dev/null x=1 2>/dev/null test awk 'quoted text' && then printf
+	export && && local cd | sed export done $(pwd)
+	done export /usr/bin x=1 local done echo grep sed export then printf
+	sed 2>/dev/null echo export export ${HOME} -eu 'quoted text'
+		export printf readonly export printf 'quoted text' -eu
+then /usr/bin ${HOME} "$1" --verbose
+	done local done echo readonly 'quoted text' "$1" test "$@"
+done ${HOME} then ${HOME} x=1
+	readonly -eu $(pwd) echo ${HOME} printf
+	readonly sed test printf grep awk export echo export
+		"$@" && ${HOME} --verbose echo grep sed 'quoted text' 'quoted text' && $(pwd)
+--verbose -eu test "$@" ${HOME} awk export
+cd "$1" ${HOME} && 2>/dev/null "$@" local "$1" --verbose then
+	/usr/bin done x=1 ${HOME}
+		"$@" export grep && local "$1" sed --verbose echo 'quoted text' -eu | local 'quoted text'
+readonly 'quoted text' sed sed
+echo local 2>/dev/null x=1 readonly -eu done x=1
+echo 'quoted text' "$1" 2>/dev/null
+	awk -eu "$@" export printf 2>/dev/null && "$1" printf
+"$@" test --verbose "$@"
+		${HOME} local then | local /usr/bin local --verbose
+--verbose 2>/dev/null 2>/dev/null
+	/usr/bin x=1 echo && "$1" x=1 $(pwd) $(pwd) local $(pwd) cd x=1 -eu grep awk
+		'quoted text' printf -eu 'quoted text' -eu ${HOME}
+echo test cd then sed -eu local /usr/bin awk | $(pwd) cd printf test local local
+		readonly --verbose echo
+		-eu && cd printf printf $(pwd) readonly ${HOME} readonly grep done ${HOME}
+cd awk | "$@" sed | --verbose /usr/bin -eu test export
+		${HOME} && readonly -eu 2>/dev/null local test export x=1 2>/dev/null /usr/bin
+	readonly printf ${HOME} local /usr/bin -eu
+	readonly readonly local export
+test export 'quoted text' grep cd export done local
+		&& $(pwd) /usr/bin export done cd test --verbose
+	"$1" 2>/dev/null cd echo local
+	echo grep $(pwd) -eu ${HOME} done --verbose 'quoted text'
+		"$@" then "$@" --verbose done test printf
+2>/dev/null then echo printf
+x=1 'quoted text' echo -eu test test test
+		| awk printf awk -eu /usr/bin && grep then x=1 export "$@" --verbose /usr/bin
+done 2>/dev/null "$1" cd | cd readonly sed "$@" 2>/dev/null | ${HOME} | export
+		done 'quoted text' | printf x=1 "$1" && cd "$1" cd ${HOME} readonly
+		-eu done $(pwd) done "$@" local /usr/bin "$1" printf awk cd grep awk readonly local
+"$@" --verbose local /usr/bin local 2>/dev/null awk -eu x=1 --verbose test
+test done 'quoted text' readonly test export sed export
+		x=1 echo cd | --verbose cd -eu printf local sed grep then "$1" x=1
+		export ${HOME} readonly readonly sed test awk /usr/bin done echo printf
+	'quoted text' local grep
+		$(pwd) export local printf
+	grep 2>/dev/null local
+		local 2>/dev/null | grep "$1" test "$@" 'quoted text'
+export then -eu echo $(pwd) awk done &&
+		local $(pwd) x=1 "$1" sed sed $(pwd) /usr/bin x=1 $(pwd) test
+	export | x=1 done -eu grep /usr/bin cd
+awk 'quoted text' -eu then sed test
+/usr/bin --verbose "$1" done "$@" /usr/bin 'quoted text' local "$@" done
+		echo --verbose echo | test cd 2>/dev/null echo readonly "$1" export readonly
+		-eu readonly cd --verbose 'quoted text'
+	test sed x=1 x=1 test printf sed test awk then echo && "$@" /usr/bin local
+test 2>/dev/null sed -eu
+2>/dev/null && then awk -eu
+		&& awk local "$1" sed readonly then readonly awk echo 'quoted text' done
+	'quoted text' ${HOME} readonly export -eu -eu
+		x=1 test -eu --verbose printf 2>/dev/null cd readonly grep x=1
+		readonly "$1" export then x=1 && ${HOME} 'quoted text' 2>/dev/null
+		sed ${HOME} local --verbose
+	/usr/bin then $(pwd) readonly printf
+		awk printf echo 'quoted text' 'quoted text' sed local then done done ${HOME} cd
+		sed "$1" --verbose awk --verbose | /usr/bin
+		readonly "$@" readonly x=1 "$1" ${HOME} awk 'quoted text'
+${HOME} test grep x=1 then cd echo 2>/dev/null then done readonly
+	printf 2>/dev/null readonly done cd $(pwd) --verbose
+	local x=1 local ${HOME} readonly --verbose
+		x=1 awk ${HOME} 'quoted text' cd echo | "$@" ${HOME} cd | test
+		local readonly cd grep /usr/bin 2>/dev/null
+		$(pwd) grep && x=1 cd --verbose && readonly local cd printf done
+	/usr/bin 'quoted text' then test then
+	done /usr/bin echo --verbose readonly
+	x=1 && test /usr/bin ${HOME} "$@" then export -eu
+	grep cd test "$1" 2>/dev/null echo then /usr/bin /usr/bin "$1" --verbose test
+		awk grep echo printf "$@" | cd ${HOME} printf awk
+	export $(pwd) test readonly grep test readonly test sed $(pwd)
+	local readonly ${HOME} grep /usr/bin -eu test x=1
+	$(pwd) cd echo ${HOME} 'quoted text' /usr/bin 'quoted text' echo awk "$@"
+	-eu | ${HOME} /usr/bin readonly awk awk && && 'quoted text' "$1" "$@"
+		${HOME} cd cd local ${HOME} ${HOME} export --verbose
+$(pwd) export $(pwd) sed test "$1" test done
+test | awk export /usr/bin | test cd | /usr/bin grep $(pwd) | local
+-eu x=1 x=1 sed readonly "$@" export && --verbose 2>/dev/null local local
+-eu export "$1" printf
+-eu --verbose && "$1" 'quoted text' 2>/dev/null export cd --verbose readonly local
+		'quoted text' -eu local /usr/bin 2>/dev/null ${HOME} printf
+	echo | cd readonly printf
+sed "$1" x=1 $(pwd) --verbose
+		cd local 'quoted text' -eu $(pwd) && echo --verbose done ${HOME} test
+done export export --verbose cd cd test x=1 then "$@" grep 'quoted text' export
+	local && test test printf "$@" /usr/bin printf "$@" "$1" && x=1 ${HOME} test echo
+	--verbose $(pwd) readonly cd test -eu grep 'quoted text'
+echo local ${HOME} && &&
+-eu "$1" "$@" readonly x=1 done "$@"
+local && $(pwd) then -eu test /usr/bin /usr/bin | /usr/bin "$@"
+x=1 && cd test test $(pwd) grep grep local "$1" /usr/bin
+echo 'quoted text' | ${HOME} sed 'quoted text' x=1 readonly --verbose
+		export /usr/bin "$1" test export awk 2>/dev/null
+then then x=1 cd ${HOME} x=1 "$1"
+awk $(pwd) x=1 "$1" echo export local
+	export awk echo | -eu 'quoted text' $(pwd) printf ${HOME} cd local --verbose
+		"$@" -eu echo test "$@" "$@" local &&
+local grep 2>/dev/null grep
+	&& ${HOME} printf cd x=1 local then
+	x=1 x=1 echo "$1" awk "$@" --verbose then export echo x=1 /usr/bin
+then done --verbose readonly done readonly echo x=1 test
+echo "$@" x=1 /usr/bin local readonly awk local && sed
+	&& sed 'quoted text' x=1 awk then printf awk done echo then
+&& grep then -eu local readonly 'quoted text' /usr/bin | echo export then "$@"
+		${HOME} awk "$@" /usr/bin export sed
+		"$@" test awk $(pwd) --verbose
+		grep cd --verbose local readonly done
+		grep "$@" x=1 sed export done
+done sed "$@" "$1" "$1" && printf local &&
+	2>/dev/null local /usr/bin done "$1" /usr/bin then
+	"$1" printf sed printf local awk --verbose export $(pwd)
+		"$1" export $(pwd) readonly awk --verbose && --verbose -eu cd cd
+cd cd -eu cd && grep echo "$1" done export then grep
+	done 2>/dev/null 2>/dev/null x=1 /usr/bin local $(pwd) grep grep
+		local "$@" && echo printf cd /usr/bin echo local | 'quoted text'
+done 'quoted text' "$@" $(pwd) "$1" then awk $(pwd) done
+	| awk grep echo | then printf /usr/bin "$@" 'quoted text' --verbose ${HOME}
+		| | echo sed 2>/dev/null grep
+	readonly ${HOME} grep export "$1" "$@" echo "$@" readonly ${HOME} grep
+export && && --verbose then then printf test then test | x=1 sed "$1" done
+		x=1 x=1 grep done /usr/bin && ${HOME} test sed awk && -eu "$@" grep
+x=1 ${HOME} 2>/dev/null test echo -eu "$@" cd /usr/bin done
+		2>/dev/null "$1" then done -eu "$1" "$@" --verbose
+		test awk "$@" 'quoted text' local 'quoted text' "$@" export awk --verbose echo
+then 'quoted text' /usr/bin && ${HOME} cd test &&
+--verbose then 2>/dev/null $(pwd) sed sed awk test cd 'quoted text'
+	awk local printf ${HOME} 'quoted text' x=1 readonly "$1" x=1 x=1 export grep
+		x=1 export awk cd awk $(pwd) | sed local
+		printf echo export | readonly "$@" test echo ${HOME}
+		sed export 2>/dev/null sed sed
+	test "$@" done echo /usr/bin then awk /usr/bin
+	${HOME} /usr/bin printf 'quoted text'
+	/usr/bin /usr/bin && "$@" grep export
+done ${HOME} ${HOME} local x=1 2>/dev/null done ${HOME} $(pwd)
+		"$@" export 'quoted text' grep "$1" 'quoted text'
+sed local --verbose printf awk sed grep printf
+		export -eu /usr/bin done echo cd "$@" 2>/dev/null 'quoted text' | then $(pwd)
+		-eu grep awk export ${HOME} -eu sed | --verbose echo
+	grep 2>/dev/null export test && sed printf then export "$@"
+export --verbose -eu local $(pwd) export -eu "$@" awk --verbose printf x=1
+sed then test ${HOME} ${HOME} -eu 'quoted text' /usr/bin cd /usr/bin x=1
+printf --verbose 2>/dev/null echo "$@" then grep test ${HOME} 'quoted text'
+		| "$@" 'quoted text' test ${HOME} x=1 cd /usr/bin
+		"$1" ${HOME} --verbose sed "$@" | awk cd readonly
+awk done 'quoted text' x=1 echo x=1 -eu /usr/bin readonly
+		local 'quoted text' test
+	$(pwd) export --verbose 'quoted text' test done export -eu "$@"
+		&& export grep "$@" test test local readonly ${HOME} export sed $(pwd)
+	"$@" --verbose ${HOME} 2>/dev/null 2>/dev/null --verbose readonly grep 'quoted text'
+	awk /usr/bin done /usr/bin /usr/bin
+| awk 'quoted text' test printf
+		"$1" printf printf /usr/bin 2>/dev/null test 'quoted text' | "$1" "$1" "$1" local
+	awk $(pwd) echo ${HOME} awk local --verbose
+-eu | $(pwd) ${HOME} -eu export -eu && "$1" awk grep echo -eu test printf
+done 'quoted text' "$1" "$1" 2>/dev/null /usr/bin 'quoted text'
+done echo grep grep then -eu readonly
+	/usr/bin readonly /usr/bin 2>/dev/null
+		echo test 'quoted text' done |
+	/usr/bin x=1 $(pwd) local 2>/dev/null $(pwd)
+	cd $(pwd) x=1 then readonly -eu && export export local
+		"$@" --verbose --verbose && readonly $(pwd) -eu
+	printf sed cd --verbose && then export local "$1" printf /usr/bin
+$(pwd) local then 2>/dev/null
+2>/dev/null sed awk awk sed x=1 /usr/bin && awk 'quoted text'
+	-eu && x=1 echo -eu $(pwd) "$@" grep x=1 "$@"
+		/usr/bin $(pwd) local 2>/dev/null && $(pwd) /usr/bin
+		'quoted text' 2>/dev/null && --verbose
+	-eu "$1" ${HOME} local cd x=1 /usr/bin export /usr/bin awk "$@" --verbose
+	echo sed readonly 2>/dev/null
+done "$@" awk && awk $(pwd) printf -eu 'quoted text' "$@" grep
+	'quoted text' echo echo awk echo done awk "$@" test -eu --verbose
+	echo echo export then $(pwd) readonly then && cd sed cd
+	cd /usr/bin export done $(pwd) then $(pwd) x=1 'quoted text'
+		echo done awk export done awk sed then ${HOME} /usr/bin awk 2>/dev/null
+		then | "$1" | local -eu sed ${HOME}
+		sed awk "$@" echo --verbose
+	"$@" local then awk local && printf done done done /usr/bin sed test
+		echo --verbose | echo $(pwd) grep test /usr/bin awk "$@" local --verbose 'quoted text'
+		x=1 "$1" "$1" printf /usr/bin echo test 2>/dev/null 'quoted text'
+		then 2>/dev/null && test echo local |
+done "$@" 2>/dev/null done test
+		printf cd printf && $(pwd)
+test x=1 "$1" $(pwd) ${HOME} printf 2>/dev/null echo "$@"
+		echo && readonly then printf done
+		"$1" local grep ${HOME} cd echo
+		readonly printf "$1" export awk then local -eu echo | /usr/bin local test
+		"$1" --verbose printf cd && /usr/bin export
+-eu && | awk local export cd then -eu "$@" /usr/bin $(pwd) &&
+		grep $(pwd) ${HOME} sed readonly then cd 2>/dev/null /usr/bin
+	grep local sed export printf "$1" local sed local echo
+/usr/bin test readonly /usr/bin $(pwd) readonly "$1" then x=1 sed test
+local echo done && x=1 | echo then cd -eu sed printf awk awk awk 'quoted text'
+	/usr/bin test -eu 'quoted text' sed export cd awk "$1" | "$1" --verbose
+	x=1 done done ${HOME} | "$1" echo printf echo ${HOME} "$@" readonly
+		| | awk then 'quoted text'
+		'quoted text' echo | "$@" 'quoted text'
+-eu test done sed then -eu --verbose
+		$(pwd) "$1" && export readonly "$@" &&
+	done /usr/bin ${HOME} "$1" 'quoted text'
+	&& done /usr/bin local sed then
+"$@" test cd --verbose | -eu test
+test $(pwd) -eu cd | local 2>/dev/null $(pwd) local
+		printf printf done local $(pwd)
+		$(pwd) export readonly --verbose printf | -eu export grep sed "$1"
+	-eu -eu test cd printf local | 2>/dev/null then sed
+	done printf "$1" cd local && --verbose awk sed ${HOME} readonly
+	-eu test && done test grep echo then ${HOME} "$@"
+	echo test -eu printf && x=1 sed grep done sed --verbose cd --verbose 'quoted text'
+		export cd then done 'quoted text'
+then | sed --verbose done x=1 --verbose /usr/bin 'quoted text' then
+	awk "$@" ${HOME} "$@" | readonly --verbose 2>/dev/null 'quoted text'
+		sed ${HOME} readonly local $(pwd) grep /usr/bin --verbose done && then -eu grep
+	sed done local x=1 x=1 local then ${HOME}
+	cd 'quoted text' echo /usr/bin test awk && --verbose cd ${HOME} -eu | --verbose
+'quoted text' --verbose cd 2>/dev/null printf then x=1 "$@" "$1" -eu -eu
+	test printf --verbose x=1
+/usr/bin test ${HOME} "$1" && awk -eu then printf | && awk
+	-eu && cd export && 2>/dev/null then cd 2>/dev/null printf echo
+then "$@" /usr/bin local echo "$1" && local 2>/dev/null local --verbose export
+'quoted text' x=1 then then export local
+		/usr/bin test printf then sed cd grep -eu $(pwd) ${HOME} cd local grep -eu export
+/usr/bin awk awk then done grep done local "$@" done
+		printf ${HOME} then "$@" "$1" $(pwd) readonly "$@" readonly x=1 2>/dev/null
+cd "$@" echo awk $(pwd) 'quoted text' grep /usr/bin export test cd readonly
+done echo sed "$1" printf sed /usr/bin
+/usr/bin x=1 then printf grep then then 2>/dev/null
+	$(pwd) awk ${HOME} --verbose
+		sed $(pwd) local && grep test test echo sed sed readonly --verbose
+		done printf x=1 echo local $(pwd) done -eu
+	then test --verbose --verbose "$1" then "$@" && 'quoted text'
+		'quoted text' x=1 ${HOME} ${HOME} grep cd /usr/bin /usr/bin test sed
+echo /usr/bin 'quoted text' ${HOME}
+		printf "$@" echo test 'quoted text' --verbose ${HOME} 2>/dev/null grep
+		2>/dev/null readonly sed "$@" cd -eu done local local awk /usr/bin
+		"$@" "$1" printf --verbose
+	&& "$1" /usr/bin && x=1 printf readonly done x=1 test $(pwd)
+	${HOME} sed printf test 'quoted text'
+	'quoted text' sed then cd cd x=1
+&& x=1 then test local grep grep && awk printf printf "$@" "$1" sed test
+		cd "$1" cd "$@" local export --verbose 2>/dev/null $(pwd) "$@" then
+		grep "$1" done printf cd echo printf "$@" readonly then -eu sed "$@" && cd
+	cd ${HOME} readonly readonly echo ${HOME} /usr/bin readonly sed
+export /usr/bin printf echo
+		echo export --verbose x=1 -eu $(pwd)
+2>/dev/null awk $(pwd) /usr/bin 'quoted text' printf sed echo
+		/usr/bin /usr/bin 2>/dev/null printf 2>/dev/null then && &&
+	2>/dev/null export sed /usr/bin $(pwd) cd "$1" local &&
+		&& test $(pwd) grep 'quoted text' export --verbose "$1" | 2>/dev/null
+		grep | && grep test sed $(pwd) && printf /usr/bin 2>/dev/null
+	${HOME} --verbose $(pwd)
+		x=1 x=1 && && -eu | ${HOME}
+	sed -eu 2>/dev/null test grep "$1" cd ${HOME} sed
+| && | && --verbose grep 2>/dev/null
+		"$@" export 2>/dev/null "$@" echo echo echo $(pwd)
+sed "$1" done local && local "$@" && --verbose awk /usr/bin test | sed --verbose
+		'quoted text' done export export x=1 readonly 2>/dev/null && /usr/bin 'quoted text'
+		"$@" "$1" test awk /usr/bin
+		grep --verbose "$1" awk | sed
+		printf ${HOME} /usr/bin awk x=1 "$@"
+-eu export | x=1 'quoted text'
+grep && export printf 2>/dev/null | awk then x=1 'quoted text' local local printf
+	"$@" sed printf readonly test && local
+grep --verbose && x=1 echo sed --verbose done 'quoted text'
+		local local grep $(pwd) echo printf ${HOME} 'quoted text'
+		sed $(pwd) $(pwd) awk cd /usr/bin --verbose then | sed
+		"$@" -eu -eu readonly -eu $(pwd)
+	x=1 cd --verbose 'quoted text'
+"$@" printf "$1" awk export -eu printf && awk --verbose
+local x=1 echo | readonly | grep done then "$1"
+done "$@" x=1 then grep $(pwd) 'quoted text' -eu ${HOME} x=1
+--verbose local grep /usr/bin 2>/dev/null $(pwd) x=1 --verbose --verbose
+echo 2>/dev/null $(pwd) readonly "$1" --verbose
+local ${HOME} echo "$1" awk /usr/bin export sed cd /usr/bin printf
+		printf x=1 $(pwd) x=1 cd && echo then awk export awk -eu --verbose printf |
+| "$1" ${HOME} awk | --verbose local
+--verbose | x=1 readonly x=1 | sed "$1" x=1 then
+		x=1 cd /usr/bin grep sed 2>/dev/null export
+	sed --verbose test grep readonly 2>/dev/null 2>/dev/null
+		echo awk printf readonly /usr/bin sed ${HOME}
+	${HOME} export export "$1" printf "$1" -eu 2>/dev/null readonly test local
+	done "$@" "$@" ${HOME} && --verbose sed 2>/dev/null
+		'quoted text' 2>/dev/null /usr/bin
+echo cd && /usr/bin "$1" test "$1" && awk "$1"
+printf 2>/dev/null awk -eu -eu readonly grep "$1" readonly
+		readonly local local ${HOME} sed $(pwd) awk awk local grep grep
+/usr/bin printf /usr/bin "$@" test cd --verbose -eu | then -eu export awk && x=1
+		test 'quoted text' $(pwd) test printf && local x=1 $(pwd) "$@" |
+		awk /usr/bin && 2>/dev/null printf then grep awk grep local done
+	done printf /usr/bin $(pwd) x=1 then $(pwd) export /usr/bin
+awk --verbose echo grep export -eu grep $(pwd)
+	x=1 ${HOME} /usr/bin --verbose sed /usr/bin
+"$@" sed --verbose test
+		done export awk sed then then sed
+/usr/bin awk "$@" "$1" 2>/dev/null x=1 cd sed &&
+		local --verbose echo printf "$@" awk 'quoted text'
+		"$@" printf echo -eu export
+		export awk ${HOME} sed awk test sed 'quoted text' /usr/bin "$1"
+		$(pwd) x=1 | echo "$@" x=1 then
+		awk /usr/bin local printf local 'quoted text' local
+	${HOME} awk --verbose grep && echo /usr/bin cd
+	&& x=1 | local 'quoted text' /usr/bin
+		-eu awk "$1" && && 2>/dev/null $(pwd)
+		done $(pwd) -eu sed 'quoted text'
+		done then sed && -eu done x=1 local printf --verbose "$1" --verbose
+		sed export then echo "$1" --verbose /usr/bin $(pwd) printf
+		local --verbose && local cd then "$1" 'quoted text' | echo echo --verbose ${HOME}
+		/usr/bin 2>/dev/null -eu grep awk test test printf "$@" -eu
+"$1" test ${HOME} done | awk 'quoted text' -eu cd cd
+		"$@" --verbose local cd grep printf echo local printf | /usr/bin /usr/bin sed
+	| awk local "$1" 'quoted text' local export
+awk | sed sed "$@" && export sed "$1"
+then then then | grep export -eu done 2>/dev/null 2>/dev/null
+		"$@" cd cd sed done then "$@" sed printf 2>/dev/null
+	${HOME} printf cd x=1 | && readonly echo "$@" then "$@" awk awk
+	-eu | grep cd && 2>/dev/null 2>/dev/null && ${HOME} sed "$@" printf
+		"$@" $(pwd) 'quoted text' done
+	$(pwd) -eu "$1" /usr/bin $(pwd)
+	export grep cd echo awk printf
+		local export | --verbose "$1" echo "$1" /usr/bin ${HOME} local local 2>/dev/null
+		'quoted text' "$@" cd -eu && 'quoted text'
+done grep ${HOME} readonly readonly --verbose --verbose
+		/usr/bin printf $(pwd) test done printf awk local --verbose
+${HOME} grep -eu printf then | /usr/bin awk sed test "$@" sed readonly
+2>/dev/null "$1" ${HOME} ${HOME}
+		grep readonly "$1" then
+awk printf && test $(pwd) grep
+	"$@" readonly done grep then "$1" export --verbose
+		printf 'quoted text' sed awk local --verbose "$1"
+test 'quoted text' export | "$@" | ${HOME} x=1 grep
+	local && x=1 --verbose --verbose
+	local $(pwd) readonly -eu awk "$1" | then readonly printf echo
+/usr/bin | 'quoted text' $(pwd)
+| echo $(pwd) $(pwd) --verbose | local "$@" local done
+	readonly grep echo $(pwd)
+	grep --verbose readonly x=1
+		grep test "$@" "$1" 'quoted text' printf --verbose "$@" 'quoted text'
+	grep grep printf --verbose --verbose 'quoted text' then && && && printf
+	"$@" | "$1" "$1" then "$1" -eu 'quoted text' grep
+readonly cd $(pwd) printf --verbose && /usr/bin && then grep
+		grep local "$@" x=1 'quoted text' --verbose ${HOME} readonly then done
+		$(pwd) readonly echo readonly 'quoted text' $(pwd) | -eu
+	export cd ${HOME} awk local ${HOME} then 'quoted text'
+		${HOME} test 'quoted text' --verbose printf -eu done cd echo "$1" printf
+	&& test echo echo then $(pwd) echo /usr/bin
+	| && done awk grep printf sed export $(pwd) "$@" awk
+	done echo /usr/bin /usr/bin ${HOME} printf echo ${HOME}
+local $(pwd) test "$@" -eu export grep test 2>/dev/null ${HOME}
+		| test "$1" sed ${HOME} grep 'quoted text' test $(pwd) readonly | 2>/dev/null
+	"$@" -eu x=1 /usr/bin "$@" ${HOME} export | awk grep $(pwd) 2>/dev/null
+		done sed && local readonly cd $(pwd) echo "$1" x=1 -eu printf
+		"$1" $(pwd) echo $(pwd) echo 'quoted text'
+		--verbose printf | local
+		$(pwd) x=1 test | && then awk /usr/bin export
+| ${HOME} awk readonly export export -eu 2>/dev/null ${HOME} --verbose
+		grep "$@" 'quoted text' --verbose then echo local "$@" test
+-eu done local printf $(pwd) printf x=1 export x=1 x=1 export
+	"$@" readonly 2>/dev/null
+	readonly awk local export ${HOME}
+		$(pwd) local test test test sed $(pwd)
+	readonly cd export printf "$1" local && readonly | "$@" printf
+	'quoted text' "$1" cd test 'quoted text' "$@" printf
+		/usr/bin -eu test export readonly x=1 then done $(pwd) x=1 $(pwd) test x=1 done
+		$(pwd) $(pwd) "$@" x=1 awk local echo x=1 --verbose local sed done grep -eu done
+test local 2>/dev/null test sed export -eu
+		awk grep cd 'quoted text' $(pwd) --verbose "$1" && ${HOME} --verbose
+	&& readonly echo $(pwd) "$1" readonly grep echo $(pwd) printf then $(pwd) then
+	'quoted text' cd | echo && "$1" then
+	local -eu printf "$@" export then echo printf
+x=1 done cd && local && awk local readonly $(pwd) awk
+	awk cd readonly then 2>/dev/null --verbose --verbose
+test local /usr/bin $(pwd) local 2>/dev/null /usr/bin x=1 2>/dev/null echo
+		awk x=1 "$@" 'quoted text' $(pwd) sed "$@" --verbose 2>/dev/null
+$(pwd) /usr/bin "$1" x=1 then ${HOME} echo $(pwd) readonly
+		x=1 --verbose grep cd | 2>/dev/null echo "$1" 2>/dev/null
+		| -eu 'quoted text' "$@" ${HOME}
+		'quoted text' awk export x=1 sed readonly done /usr/bin test
+"$1" | printf "$1" test ${HOME} 2>/dev/null ${HOME} echo test 2>/dev/null
+	local printf && $(pwd) -eu done 2>/dev/null printf
+		--verbose "$1" | sed | local 2>/dev/null then -eu sed | readonly $(pwd) test
+cd 2>/dev/null export cd x=1 ${HOME}
+	echo && | x=1 done 2>/dev/null then cd x=1 'quoted text' $(pwd) printf
+		| $(pwd) ${HOME} "$1" && readonly
+		--verbose awk echo sed test "$1" x=1
+${HOME} printf "$@" ${HOME} printf && -eu x=1 $(pwd) sed awk then local $(pwd)
+"$@" /usr/bin /usr/bin readonly printf x=1
+"$@" 2>/dev/null local sed 2>/dev/null sed && | x=1 done --verbose
+2>/dev/null x=1 sed cd readonly | cd printf 'quoted text' local
+echo $(pwd) 2>/dev/null local grep 'quoted text' cd ${HOME} x=1 grep
+		x=1 "$1" test "$1" 'quoted text' x=1 export test /usr/bin x=1 -eu readonly
+${HOME} && echo cd awk "$1" export "$1" | -eu printf done echo x=1
+x=1 grep local export "$1" awk echo sed grep
+	-eu echo export ${HOME} 'quoted text'
+		'quoted text' readonly 2>/dev/null --verbose done printf
+local ${HOME} -eu awk sed grep --verbose
+		done "$@" && sed "$@" sed x=1 "$1" printf "$@" --verbose export | sed local
+	x=1 then | "$@" done echo printf
+"$@" 2>/dev/null && grep
+		$(pwd) awk /usr/bin $(pwd) done 'quoted text'
+	printf readonly $(pwd) echo | readonly export done
+${HOME} printf x=1 | 2>/dev/null echo 'quoted text'
+2>/dev/null sed done test awk done "$@" "$1" echo | grep -eu 2>/dev/null
+	&& /usr/bin -eu x=1 "$@" "$1" sed printf awk awk awk printf export
+		| 'quoted text' ${HOME} /usr/bin -eu cd ${HOME} echo awk 2>/dev/null
+		export grep "$1" cd && &&
+-eu then 2>/dev/null 2>/dev/null /usr/bin readonly x=1
+	readonly -eu then cd awk sed $(pwd) "$@" then 2>/dev/null
+		x=1 "$@" /usr/bin done 'quoted text' ${HOME} printf printf
+sed 'quoted text' && printf ${HOME} x=1 cd ${HOME} ${HOME} readonly readonly printf
+x=1 grep /usr/bin $(pwd) -eu test grep --verbose then then 'quoted text'
+2>/dev/null --verbose "$1" export export "$1" local 'quoted text' done test
+	"$1" export /usr/bin "$1" /usr/bin
+echo ${HOME} cd sed 2>/dev/null -eu -eu then awk cd
+		'quoted text' sed $(pwd) && cd ${HOME} awk /usr/bin sed && | test awk
+		/usr/bin export echo cd awk echo ${HOME} grep $(pwd)
+		echo ${HOME} cd --verbose --verbose
+		echo "$@" echo --verbose "$@" readonly readonly x=1
+echo | "$1" --verbose && /usr/bin echo
+| x=1 then local | "$@" sed echo printf ${HOME} /usr/bin && sed echo 'quoted text'
+"$@" /usr/bin && awk awk /usr/bin "$1" readonly then sed export printf grep
+echo /usr/bin printf export then "$1"
+cd cd && sed $(pwd) awk ${HOME} printf "$1" printf
+	test test $(pwd) printf readonly sed "$1" local
+	awk grep --verbose | $(pwd) "$@" then 2>/dev/null then
+	awk echo test 'quoted text' 2>/dev/null -eu x=1 grep local --verbose | test
+readonly test "$1" ${HOME} echo local done printf then 'quoted text'
+		echo -eu test x=1 printf local -eu &&
+	2>/dev/null --verbose done x=1 export
+&& && sed /usr/bin echo local grep
+| $(pwd) 2>/dev/null && --verbose
+	'quoted text' --verbose x=1 local then x=1 test test
+x=1 "$1" ${HOME} x=1 printf x=1 "$1"
+2>/dev/null $(pwd) && echo | sed ${HOME}
+&& "$@" echo done "$1" test 'quoted text' done printf 'quoted text'
+		2>/dev/null ${HOME} sed -eu grep 'quoted text' ${HOME}
+cd test readonly /usr/bin export grep printf sed "$1" --verbose x=1 sed --verbose
+	echo ${HOME} cd "$@" /usr/bin cd echo
+	local grep $(pwd) cd | && 'quoted text' x=1 -eu
+$(pwd) "$1" then test readonly awk
+		/usr/bin test x=1 --verbose 2>/dev/null awk -eu 2>/dev/null ${HOME} then --verbose
+done echo test 'quoted text' x=1 --verbose | local --verbose --verbose /usr/bin
+	"$1" sed cd "$@" awk awk test "$@" done
+	"$1" "$@" /usr/bin x=1 awk &&
+		x=1 readonly "$@" "$1" 2>/dev/null
+		2>/dev/null -eu "$@" 2>/dev/null test cd 'quoted text' 2>/dev/null x=1 'quoted text'
+		${HOME} then "$1" -eu
+		readonly echo 'quoted text' then x=1 x=1 2>/dev/null "$1" done test local
+printf grep --verbose cd
+done done echo readonly /usr/bin "$1" /usr/bin 'quoted text'
+	echo x=1 ${HOME} 2>/dev/null ${HOME} /usr/bin | --verbose "$1" test
+grep then && | && "$1" local export readonly local
+	readonly 'quoted text' test x=1
+	cd printf "$@" && export local printf
+		-eu test echo /usr/bin -eu test sed local cd 'quoted text'
+		readonly "$@" cd printf local | done awk &&
+	"$@" local && then --verbose awk
+awk ${HOME} grep 'quoted text'
+		${HOME} awk local export ${HOME} readonly cd sed 2>/dev/null
+	test export 2>/dev/null | printf readonly | x=1 -eu 'quoted text' 2>/dev/null
+		| ${HOME} export | ${HOME}
+then /usr/bin export echo
+		-eu test cd test local /usr/bin sed "$@" ${HOME} printf /usr/bin awk "$@"
+#include c10.sh
+		| sed done cd && test echo export /usr/bin -eu awk && then -eu 'quoted text'
+-eu cd test -eu $(pwd) printf 2>/dev/null grep ${HOME} printf grep /usr/bin
+	"$1" sed cd local export readonly && cd -eu 'quoted text' "$@"
+	${HOME} printf grep /usr/bin then --verbose cd echo
+	echo $(pwd) | 2>/dev/null
+		$(pwd) readonly "$@" "$@"
+		cd export grep x=1 /usr/bin 2>/dev/null printf
+		then $(pwd) then 2>/dev/null
+		grep grep ${HOME} sed local 2>/dev/null --verbose awk sed
+	| "$@" echo local done -eu then 2>/dev/null
+		done readonly echo "$@" "$@" && | 'quoted text'
+		readonly 'quoted text'
+${HOME} $(pwd) x=1 sed -eu
+		readonly x=1 'quoted text'
+	grep then local "$1"
+	export --verbose awk x=1 sed test awk | done x=1
+--verbose 2>/dev/null -eu local export awk -eu cd test
+		printf done ${HOME} $(pwd) echo cd printf --verbose
+		readonly cd | test 'quoted text' printf
+		echo sed sed export done /usr/bin -eu sed
+	grep 'quoted text' && 2>/dev/null -eu sed sed "$1" x=1
+readonly && -eu | export awk test /usr/bin | export
+2>/dev/null 2>/dev/null local && 'quoted text' readonly /usr/bin
+	--verbose /usr/bin test /usr/bin x=1 awk test test "$@" "$1" && echo local export
+	${HOME} sed export /usr/bin "$@" -eu export done then ${HOME} | test test
+		sed /usr/bin -eu x=1 echo && printf awk -eu
+		local grep "$@" -eu local | done 2>/dev/null
+"$1" -eu --verbose test then
+		$(pwd) /usr/bin printf test x=1 $(pwd) 2>/dev/null printf cd awk "$1" $(pwd) cd
+		done local test cd awk -eu local /usr/bin x=1 sed cd -eu test then "$@" x=1 'quoted text'
+		echo awk 2>/dev/null ${HOME} -eu
+		cd then | echo 2>/dev/null | done | /usr/bin done "$1" $(pwd) "$@" then grep
+	cd ${HOME} /usr/bin sed cd done |
+		"$1" then printf readonly then export then local && done sed then ${HOME}
+		x=1 | 2>/dev/null sed ${HOME} && grep
+-eu local -eu readonly awk grep
+&& "$@" local 'quoted text' |
+printf ${HOME} test $(pwd) export echo printf
+test then readonly grep cd cd grep done sed "$1" echo "$@" echo 2>/dev/null
+	printf done "$@" --verbose "$@" awk sed sed local grep done &&
+/usr/bin export printf ${HOME} local done &&
+		$(pwd) | readonly cd --verbose readonly sed $(pwd) -eu ${HOME}
+	grep x=1 /usr/bin done then -eu sed 'quoted text' then printf
+		awk -eu -eu /usr/bin ${HOME} sed ${HOME} x=1 test && test /usr/bin
+local awk 2>/dev/null echo -eu $(pwd) printf 'quoted text' /usr/bin echo "$@"
+	then | $(pwd) --verbose 2>/dev/null
+		/usr/bin 2>/dev/null $(pwd) -eu -eu then -eu | sed cd ${HOME} then ${HOME}
+	awk done cd "$1" ${HOME}
+x=1 cd 2>/dev/null --verbose && grep export echo x=1 done x=1 'quoted text'
+		test --verbose ${HOME} ${HOME} grep ${HOME} 2>/dev/null
+	-eu done 'quoted text' readonly done local echo awk test 'quoted text'
+	export cd | grep test cd 2>/dev/null readonly 'quoted text'
+		&& "$@" 2>/dev/null then sed | 'quoted text' cd local /usr/bin echo
+$(pwd) then grep test then cd printf -eu sed /usr/bin
+		"$@" cd "$@" | 'quoted text' 2>/dev/null ${HOME} $(pwd)
+	--verbose "$@" test --verbose
+--verbose $(pwd) then x=1 -eu export cd sed then ${HOME} /usr/bin
+echo x=1 $(pwd) "$1" printf -eu | "$@" ${HOME} | printf awk done 'quoted text'
+	"$@" -eu local --verbose
+sed echo 'quoted text' echo
+	local local && /usr/bin readonly printf 2>/dev/null
+		x=1 awk readonly echo /usr/bin
+		test sed readonly local readonly readonly "$@" --verbose printf
+grep local export /usr/bin
+test sed "$@" ${HOME} echo done local readonly echo ${HOME} awk 2>/dev/null
+		${HOME} --verbose then "$1" readonly $(pwd) --verbose
+	then && x=1 done then local then grep | "$1" local -eu $(pwd) -eu cd $(pwd) x=1
+		then && 2>/dev/null x=1 test x=1 $(pwd) local cd sed cd done /usr/bin test
+		cd cd export echo "$@" printf done -eu | readonly
+/usr/bin ${HOME} -eu grep printf x=1 $(pwd) printf "$1" echo x=1 readonly "$@"
+	echo $(pwd) ${HOME} /usr/bin local cd && local ${HOME} then awk then
+local --verbose local done cd | printf export done x=1 cd && $(pwd) then x=1 'quoted text'
+x=1 sed $(pwd) -eu test then echo done done x=1 export x=1 --verbose grep
+	$(pwd) test && local 2>/dev/null export | done "$@" "$1" -eu export | test
+${HOME} --verbose $(pwd) printf awk printf done export grep done export
+	${HOME} 'quoted text' done /usr/bin export | && done
+		echo "$1" echo test /usr/bin 'quoted text' "$@" x=1 local ${HOME}
+	local awk readonly export
+	${HOME} 2>/dev/null 2>/dev/null printf echo | /usr/bin echo --verbose
+		"$@" --verbose "$@" local export grep awk done export cd then | grep
+	${HOME} --verbose awk then grep -eu 'quoted text' done
+		cd x=1 readonly ${HOME} test 'quoted text' printf
+	sed grep --verbose 2>/dev/null
+then then /usr/bin local readonly echo | cd /usr/bin test -eu 2>/dev/null
+local then | ${HOME} 'quoted text' /usr/bin
+	readonly && 'quoted text' export x=1 "$@" 'quoted text' "$1" echo
+		done export x=1 x=1 -eu ${HOME} 'quoted text'
+test --verbose local --verbose ${HOME} 2>/dev/null
+	then "$@" printf export x=1 local done | local grep export 'quoted text'
+	"$@" echo 'quoted text' sed export | 2>/dev/null $(pwd) --verbose
+		&& $(pwd) && && && "$@" awk then
+		export echo printf awk echo readonly
+		| 2>/dev/null done done "$1" | grep cd --verbose
+	-eu 'quoted text' grep readonly awk /usr/bin
+	local then sed then printf 'quoted text'
+$(pwd) grep awk cd | 'quoted text' awk $(pwd)
+		${HOME} then /usr/bin echo | --verbose test sed then "$@"
+2>/dev/null /usr/bin x=1 | -eu "$1" 2>/dev/null -eu "$1" --verbose && "$1"
+$(pwd) done then x=1 && --verbose readonly
+"$@" | local -eu 2>/dev/null "$1" test
+x=1 "$1" readonly echo
+		export grep $(pwd) local -eu "$1" cd 'quoted text' readonly
+	2>/dev/null "$1" ${HOME} 2>/dev/null
+awk done /usr/bin $(pwd) ${HOME} ${HOME} | awk | grep ${HOME} "$1" grep
+	x=1 -eu 'quoted text' --verbose cd readonly -eu readonly
+${HOME} readonly "$@" -eu cd x=1 grep export test cd
+	local 2>/dev/null 'quoted text' 2>/dev/null
+		echo awk local $(pwd) /usr/bin | done export
+		$(pwd) export "$1" then x=1 printf -eu done
+	awk && test test echo /usr/bin | ${HOME} done | && awk x=1 "$@"
+	printf cd --verbose awk && cd printf echo readonly "$@"
+	local /usr/bin "$@" | ${HOME} 2>/dev/null /usr/bin -eu echo printf
+x=1 readonly sed $(pwd) readonly "$1"
+		2>/dev/null local "$1" 2>/dev/null $(pwd) printf
+	x=1 local awk export echo "$1" echo echo echo | echo export 'quoted text'
+	&& x=1 | x=1 | | export $(pwd) && "$1"
+		grep -eu && readonly 'quoted text'
+	&& then export 2>/dev/null done $(pwd)
+| grep then printf $(pwd) sed 'quoted text' cd 2>/dev/null | done && --verbose
+grep $(pwd) -eu ${HOME} && awk
+	test done grep local | x=1 $(pwd) 'quoted text' readonly test sed x=1 sed test
+awk readonly printf done cd done done cd test --verbose
+	--verbose ${HOME} $(pwd) "$1"
+$(pwd) export ${HOME} $(pwd) test readonly
+"$@" grep "$@" cd then
+done --verbose ${HOME} echo --verbose readonly export grep -eu
+		'quoted text' awk printf sed grep | test awk --verbose x=1 export test cd cd then
+awk grep 'quoted text' /usr/bin then x=1 printf grep grep "$@"
+		-eu -eu "$1" | /usr/bin then && awk sed echo --verbose test sed printf
+		&& cd 'quoted text' printf && | test printf echo
+echo "$1" x=1 awk $(pwd) "$@" done cd echo "$@" test -eu -eu -eu 2>/dev/null awk
+cd cd -eu test printf -eu sed /usr/bin
+		$(pwd) "$1" 'quoted text' test 2>/dev/null
+2>/dev/null x=1 done awk /usr/bin "$@" ${HOME} readonly test 'quoted text'
+awk test awk cd awk echo export /usr/bin $(pwd) /usr/bin readonly done x=1
+'quoted text' test awk sed cd cd --verbose
+		local grep sed then /usr/bin && sed cd /usr/bin
+		echo cd done readonly "$1" cd local -eu $(pwd) | 2>/dev/null
+$(pwd) grep x=1 test 2>/dev/null
+		awk x=1 && grep /usr/bin -eu x=1 test
+	export ${HOME} --verbose grep done --verbose test "$1" x=1
+		2>/dev/null $(pwd) -eu --verbose
+		'quoted text' printf 2>/dev/null local printf --verbose
+		grep then x=1 x=1 $(pwd) && x=1 $(pwd) test done -eu -eu grep && printf | x=1
+"$1" && echo readonly awk -eu
+		-eu "$1" printf readonly sed x=1
+${HOME} test $(pwd) ${HOME} && ${HOME} awk awk "$@"
+printf then test echo readonly -eu
+	${HOME} --verbose && local -eu | && && x=1 cd --verbose
+	export && printf local
+		'quoted text' printf sed then "$1" "$@"
+		x=1 'quoted text' sed export done test sed grep && -eu test sed printf
+$(pwd) "$1" done x=1 "$1" -eu awk | ${HOME} /usr/bin printf --verbose ${HOME}
+		&& readonly awk && grep grep "$1" x=1 && done sed && echo /usr/bin done
+	printf 'quoted text'
+		x=1 && export ${HOME} echo
+		"$@" --verbose && x=1 grep readonly done $(pwd) 2>/dev/null awk export
+		--verbose test cd x=1 export awk grep
+cd && export awk readonly
+		2>/dev/null printf && echo && export ${HOME} 'quoted text'
+	/usr/bin then sed grep 'quoted text' ${HOME} test grep
+x=1 echo ${HOME} done "$@" done 2>/dev/null echo --verbose then "$1"
+export cd "$1" printf -eu sed awk echo ${HOME}
+printf echo test x=1 test echo then sed cd done test grep cd "$@" grep x=1 then
+		sed "$1" "$1" | $(pwd) "$@" /usr/bin | readonly /usr/bin done ${HOME} 2>/dev/null
+	'quoted text' "$@" /usr/bin
+		-eu printf test sed done awk test ${HOME} 'quoted text'
+		echo sed then sed ${HOME}
+	| $(pwd) done 2>/dev/null
+test "$1" local 2>/dev/null test done test done sed 2>/dev/null --verbose echo
+	x=1 /usr/bin "$1" grep local | "$@" echo $(pwd)
+	cd x=1 $(pwd) awk | readonly x=1 x=1 printf "$@" printf sed --verbose echo /usr/bin
+&& readonly && grep readonly then export && && | 'quoted text' awk echo
+"$1" /usr/bin | $(pwd) printf | grep |
+	awk export && grep 'quoted text' /usr/bin ${HOME} done local -eu local
+	echo echo cd $(pwd) cd done grep local echo && awk ${HOME} export
+	${HOME} then $(pwd) 'quoted text'
+	then test 2>/dev/null done --verbose
+"$1" then -eu --verbose ${HOME} x=1 printf
+	${HOME} ${HOME} sed cd $(pwd) awk grep "$@" sed
+	| | && done /usr/bin then ${HOME} awk then --verbose sed grep -eu readonly
+		x=1 done && sed local "$1" echo awk "$1" "$@" /usr/bin printf
+sed && cd printf --verbose x=1 done ${HOME} "$@" ${HOME} | "$@" printf
+test sed && "$@" ${HOME} ${HOME} /usr/bin "$@"
+| done awk then test grep -eu sed export $(pwd) local ${HOME} grep
+	$(pwd) local echo printf cd then && --verbose
+		"$1" printf cd $(pwd) 'quoted text' awk
+	grep --verbose 2>/dev/null 'quoted text' awk test 2>/dev/null /usr/bin $(pwd) ${HOME}
+	$(pwd) test 2>/dev/null
+	export test done "$@" &&
+		grep "$@" -eu 'quoted text'
+export test grep grep echo test $(pwd) x=1 then local -eu /usr/bin local
+| cd awk /usr/bin readonly then awk 2>/dev/null local readonly sed && cd cd
+then readonly done 2>/dev/null
+/usr/bin --verbose sed echo
+	"$@" echo && --verbose cd local $(pwd) "$1" --verbose grep cd
+	${HOME} && then export awk readonly /usr/bin grep test $(pwd) awk $(pwd) printf
+cd readonly test "$@" --verbose
+done then cd printf test then "$1" "$1" --verbose
+		sed "$@" 'quoted text' printf grep cd "$@" done test local /usr/bin echo /usr/bin
+	| 'quoted text' then /usr/bin 2>/dev/null $(pwd) echo 'quoted text'
+		/usr/bin "$@" readonly awk local
+		"$@" "$1" local then cd printf 2>/dev/null done test | /usr/bin
+	printf "$@" done /usr/bin sed "$1" then --verbose 2>/dev/null export
+		readonly 2>/dev/null sed done awk test test -eu
+		local ${HOME} x=1 readonly 2>/dev/null awk test cd $(pwd) test --verbose then
+		readonly 'quoted text' 'quoted text' then && awk cd grep
+	"$1" $(pwd) 'quoted text' 2>/dev/null echo test sed /usr/bin sed 'quoted text'
+		awk "$@" printf /usr/bin ${HOME}
+		grep && sed sed done then "$1" then && $(pwd)
+done then readonly readonly
+cd echo printf "$@" && "$1" x=1 --verbose
+		grep done /usr/bin then --verbose /usr/bin
+local 2>/dev/null grep 'quoted text' local printf local cd printf then
+awk ${HOME} | local "$1" printf /usr/bin 2>/dev/null
+		readonly /usr/bin 'quoted text' sed done sed local
+	--verbose --verbose export test done
+		readonly echo printf 2>/dev/null
+		$(pwd) echo echo $(pwd) sed && /usr/bin
+		cd printf --verbose -eu
+	test --verbose done --verbose
+		awk x=1 printf readonly cd ${HOME} printf printf "$1" -eu
+	2>/dev/null echo /usr/bin /usr/bin echo "$@" ${HOME} awk
+		--verbose /usr/bin $(pwd) x=1 echo | grep test 2>/dev/null
+	grep ${HOME} 2>/dev/null local "$@"
+test "$1" "$@" && 2>/dev/null -eu cd local ${HOME} local then
+	export local cd test "$@" "$@" readonly
+--verbose then printf x=1 export "$1" /usr/bin $(pwd) then
+		/usr/bin awk && "$@" readonly
+awk | echo cd sed echo x=1 cd | then cd /usr/bin then /usr/bin 2>/dev/null done
+	export then grep -eu readonly cd export 'quoted text' awk then grep 'quoted text'
+		"$1" echo "$@" cd readonly && --verbose printf
+		done -eu readonly 2>/dev/null
+	--verbose ${HOME} readonly test | x=1 "$@" printf ${HOME} && && cd --verbose
+		then && | | awk grep
+		awk 2>/dev/null /usr/bin done -eu -eu done
+		awk && readonly done ${HOME} $(pwd) printf cd --verbose
+		/usr/bin 2>/dev/null local test cd | done readonly "$1" ${HOME} --verbose $(pwd)
+	awk $(pwd) /usr/bin ${HOME} /usr/bin cd x=1 $(pwd)
+&& | sed -eu /usr/bin then x=1 then done
+x=1 echo "$1" ${HOME} sed ${HOME} printf /usr/bin done ${HOME}
+	printf -eu /usr/bin echo export ${HOME} x=1 ${HOME}
+	echo sed /usr/bin /usr/bin
+readonly -eu 'quoted text' -eu --verbose
+-eu | $(pwd) printf export
+	export 'quoted text' --verbose cd "$@" "$@" awk "$@" cd 'quoted text' done
+${HOME} readonly -eu local done 2>/dev/null
+	awk export readonly | "$@" readonly /usr/bin
+	then -eu local -eu x=1 -eu echo echo
+		printf 2>/dev/null ${HOME} awk done "$1" export readonly export awk
+		cd --verbose x=1 printf | $(pwd) 'quoted text' local /usr/bin
+		awk awk && cd ${HOME} "$1" -eu test test awk awk local sed grep echo -eu
+		"$@" /usr/bin grep grep export local test --verbose grep done test 'quoted text'
+	test /usr/bin local 'quoted text' sed
+'quoted text' | readonly grep
+x=1 test test 'quoted text' readonly echo && 2>/dev/null -eu cd export /usr/bin
+		done done then x=1 local done sed && "$@" test
+		done printf "$1" test x=1 sed export /usr/bin
+	printf export readonly echo x=1 readonly | 2>/dev/null $(pwd)
+		then /usr/bin --verbose --verbose --verbose
+test test readonly "$@" "$@" local then "$@"
+	test readonly cd x=1 "$@" then --verbose 2>/dev/null
+		awk sed -eu -eu then grep | awk cd then done "$1"
+	sed awk ${HOME} /usr/bin
+		"$@" cd readonly "$@" echo &&
+		then cd | export 'quoted text' sed then "$1"
+	then ${HOME} && readonly 'quoted text' 'quoted text'
+		| $(pwd) $(pwd) then 2>/dev/null readonly then sed readonly --verbose
+	export "$@" 'quoted text' sed sed local
+&& "$@" test $(pwd) grep x=1 then echo 2>/dev/null local then printf --verbose echo
+	${HOME} grep then printf export export local
+x=1 then && test export "$@" 2>/dev/null printf local
+grep test printf done "$@" /usr/bin "$@" --verbose printf
+	${HOME} test grep -eu cd && $(pwd) done test -eu grep /usr/bin $(pwd) awk grep printf
+		export grep "$@" 'quoted text' grep then
+		export && then "$1" | 2>/dev/null
+"$@" local x=1 $(pwd) sed ${HOME} && | grep done /usr/bin 2>/dev/null -eu
+	cd ${HOME} /usr/bin $(pwd) test local && /usr/bin printf
+	-eu 2>/dev/null cd then &&
+	test printf printf ${HOME} $(pwd) x=1 printf export --verbose grep
+		sed local "$@" | echo then /usr/bin
+		test | 'quoted text' $(pwd) $(pwd) readonly ${HOME} sed | $(pwd)
+	echo | | cd echo ${HOME} cd awk awk 2>/dev/null export
+		grep export test /usr/bin export echo "$1" test | 2>/dev/null
+sed cd sed cd echo echo then sed export $(pwd) cd readonly
+	| x=1 awk then | export x=1
+then sed /usr/bin grep then
+	"$@" -eu --verbose $(pwd) ${HOME} /usr/bin grep local
+	| && /usr/bin "$1" awk sed grep --verbose && /usr/bin awk grep ${HOME} printf
+	$(pwd) --verbose awk readonly | "$@" && "$1" echo
+		cd echo -eu -eu sed 2>/dev/null "$@" local cd -eu local
+	printf 'quoted text' test "$@"
+	-eu printf 'quoted text' then
+		&& x=1 cd export --verbose sed | cd 2>/dev/null "$@" echo readonly
+	'quoted text' awk done "$1" sed grep
+$(pwd) 2>/dev/null echo printf readonly && $(pwd) && readonly done
+	2>/dev/null "$1" sed then readonly
+	export 2>/dev/null --verbose x=1
+cd local then sed sed grep -eu sed 'quoted text'
+		printf printf ${HOME} && sed awk x=1 then --verbose $(pwd) sed /usr/bin test
+	printf then cd | local /usr/bin
+	"$@" $(pwd) printf awk /usr/bin echo && printf printf -eu printf awk readonly
+	--verbose /usr/bin local
+	printf | echo readonly && --verbose printf awk 'quoted text' && "$1"
+		awk 'quoted text' readonly
+done 'quoted text' done $(pwd) awk && echo -eu
+		echo cd sed readonly && echo && local
+	x=1 printf "$1" local then printf
+2>/dev/null export sed "$@" sed 2>/dev/null |
+		sed sed 2>/dev/null cd local cd cd $(pwd) "$1" local "$@" awk done
+	--verbose && $(pwd) printf && grep --verbose "$1" then "$1" "$@" 'quoted text'
+${HOME} sed cd ${HOME} -eu printf /usr/bin local cd /usr/bin
+		then && $(pwd) grep && ${HOME} grep test --verbose readonly then
+		cd local && then echo export
+awk 'quoted text' "$1" &&
+grep ${HOME} printf "$1" -eu local printf test grep 'quoted text' readonly
+		awk | "$1" awk "$1" "$1" 'quoted text' export export --verbose -eu ${HOME}
+readonly printf echo printf export $(pwd) ${HOME}
+		done printf awk awk then -eu sed awk x=1 /usr/bin cd export
+${HOME} readonly grep --verbose done 2>/dev/null done x=1
+		local readonly 'quoted text' x=1 -eu test readonly
+		-eu && sed ${HOME} local 2>/dev/null -eu -eu grep | 'quoted text'
+		-eu local echo 2>/dev/null
+--verbose done ${HOME} && -eu
+-eu --verbose readonly "$1" cd then "$@" $(pwd) | cd cd cd grep
+	'quoted text' done sed 'quoted text' done 'quoted text'
+	"$1" | x=1 'quoted text' 'quoted text'
+sed "$@" echo --verbose x=1 then sed export ${HOME} grep local $(pwd) -eu then -eu
+		-eu sed export "$@" "$@" export --verbose test cd local --verbose
+	$(pwd) --verbose --verbose | then "$@" 2>/dev/null
+		local test cd test x=1
+'quoted text' local -eu "$@" x=1 "$1" "$@" -eu local /usr/bin
+--verbose 2>/dev/null printf $(pwd) "$@" awk 2>/dev/null test "$1" awk readonly
+	printf "$@" grep | && sed readonly
+local test $(pwd) --verbose x=1 cd printf
+	done grep -eu ${HOME} then ${HOME}
+"$1" "$@" readonly test ${HOME} /usr/bin 2>/dev/null && cd cd && echo x=1
+	--verbose --verbose ${HOME} -eu -eu sed | "$1" "$@" $(pwd) local done
+	$(pwd) && 2>/dev/null awk export $(pwd) ${HOME} sed
+| ${HOME} | "$1" sed echo --verbose $(pwd) echo && $(pwd)
+	test "$1" grep 2>/dev/null && && sed echo awk printf /usr/bin
+		sed local test && test then 2>/dev/null
+		--verbose 2>/dev/null done echo /usr/bin && /usr/bin readonly /usr/bin
+"$1" --verbose cd readonly
+x=1 test echo 2>/dev/null "$@" ${HOME} local "$1" --verbose printf ${HOME} done
+		"$@" ${HOME} ${HOME} ${HOME}
+&& 2>/dev/null awk printf 2>/dev/null test && 2>/dev/null
+2>/dev/null test done --verbose
+	local test $(pwd) && "$1" --verbose readonly grep done
+		x=1 $(pwd) awk 2>/dev/null echo then local
+	export | export 'quoted text' printf echo -eu -eu grep sed
+readonly printf -eu then readonly printf local | local export
+'quoted text' "$1" awk sed ${HOME}
+	"$1" echo --verbose /usr/bin
+/usr/bin | x=1 --verbose readonly "$@" -eu
+		echo --verbose | ${HOME} awk $(pwd) && "$1" then
+		x=1 $(pwd) && done --verbose --verbose done awk | printf
+		"$1" echo grep then --verbose
+	| 2>/dev/null printf 'quoted text' sed
+		readonly awk local cd printf printf echo 2>/dev/null readonly sed x=1 echo 'quoted text'
+&& $(pwd) grep 'quoted text' echo readonly
+local export readonly export && "$1"
+2>/dev/null then && 2>/dev/null printf --verbose
+	"$@" ${HOME} "$@" "$@"
+	readonly /usr/bin awk cd | printf
+$(pwd) grep then $(pwd) test
+		--verbose x=1 'quoted text' done "$1" && "$1" export "$@"
+/usr/bin echo readonly export 2>/dev/null test readonly
+"$@" awk ${HOME} sed done cd grep export x=1 "$1" ${HOME} awk readonly ${HOME}
+${HOME} readonly echo grep
+done x=1 | ${HOME} /usr/bin 2>/dev/null local "$@" grep
+	readonly awk $(pwd) local $(pwd) ${HOME} && echo 'quoted text' local
+	| 'quoted text' sed -eu $(pwd) done grep then test --verbose 2>/dev/null done then
+	--verbose done echo 2>/dev/null local "$1" "$1" $(pwd)
+$(pwd) /usr/bin export
+	export $(pwd) export printf && "$@" "$1" export
+		| -eu test 2>/dev/null 'quoted text' printf test
+		| test sed $(pwd) done x=1 printf x=1 "$@" x=1 awk export x=1 grep echo
+$(pwd) | awk echo grep printf printf $(pwd) grep 'quoted text' "$1"
+	test -eu readonly 2>/dev/null printf grep
+	x=1 'quoted text' 'quoted text' awk cd export
+		| "$1" echo 'quoted text'
+	test test printf $(pwd) --verbose
+printf 'quoted text' -eu && 2>/dev/null awk local "$@" -eu sed then grep test
+cd -eu then | ${HOME} 2>/dev/null echo 'quoted text'
+then echo ${HOME} -eu /usr/bin
+		printf ${HOME} awk then local test printf 'quoted text'
+		x=1 /usr/bin grep readonly 2>/dev/null && local
+		sed then local done "$1" "$@" 'quoted text'
+readonly ${HOME} done x=1 sed --verbose export /usr/bin cd $(pwd) then grep --verbose
+		"$1" 'quoted text' then echo && ${HOME} x=1 && printf | local x=1 2>/dev/null
+export | test 2>/dev/null awk
+	awk then grep -eu awk ${HOME} && echo $(pwd) readonly -eu done "$1"
+		/usr/bin test "$1" awk | readonly
+		--verbose "$@" /usr/bin local echo awk export
+	/usr/bin printf test awk --verbose grep done
+	-eu printf test readonly test /usr/bin "$@" echo
+	then | ${HOME} "$@" /usr/bin
+local 2>/dev/null 'quoted text'
+		printf printf | printf ${HOME} echo grep
+readonly printf cd -eu
+	then -eu cd printf ${HOME} export ${HOME} cd 'quoted text'
+	x=1 local export /usr/bin echo | sed printf
+		readonly x=1 2>/dev/null --verbose then cd grep cd
+		test 2>/dev/null export x=1 export echo done
+	"$1" export readonly export 2>/dev/null
+		&& grep printf x=1 /usr/bin "$@" export printf readonly /usr/bin
+-eu local readonly | export -eu readonly grep $(pwd) awk
+	"$1" readonly export $(pwd) export grep
+		| 'quoted text' 2>/dev/null grep /usr/bin export printf
+/usr/bin sed sed test $(pwd) cd --verbose printf sed $(pwd) x=1 | grep | cd
+		| /usr/bin "$1" grep cd ${HOME} x=1 grep /usr/bin
+		"$@" $(pwd) 'quoted text' | awk && ${HOME} done local && grep awk sed readonly
+printf grep readonly local x=1 --verbose local
+local /usr/bin readonly test && ${HOME} ${HOME}
+--verbose export ${HOME} done ${HOME} export $(pwd)
+test echo then printf awk && sed export --verbose sed "$1" echo "$@"
+	awk then "$@" export readonly
+	x=1 printf 2>/dev/null -eu test printf printf
+/usr/bin --verbose awk "$1" echo local sed "$@" test export echo
+	"$@" && 'quoted text' test
+	local sed "$@" done --verbose --verbose export cd /usr/bin ${HOME}
+		printf /usr/bin "$1" printf cd "$1" readonly grep awk |
+sed /usr/bin export 2>/dev/null --verbose "$1" readonly
+	| "$1" echo export then --verbose
+		${HOME} x=1 $(pwd) grep 'quoted text'
+		/usr/bin 'quoted text' /usr/bin grep sed awk awk 'quoted text'
+	'quoted text' local ${HOME} export | echo "$1" test | grep echo sed readonly
+&& awk echo /usr/bin grep local
+		| readonly /usr/bin done then x=1 ${HOME} export
+		test cd done then sed $(pwd) local export ${HOME}
+	&& sed echo /usr/bin grep sed grep done awk local test printf awk echo x=1
+sed export sed $(pwd) x=1 export readonly
+	sed "$@" x=1 'quoted text' | "$1" done x=1 'quoted text'
+		then sed "$@" grep $(pwd) printf done echo then echo printf $(pwd)
+		/usr/bin $(pwd) $(pwd) done echo 2>/dev/null then -eu x=1 sed printf cd 'quoted text'
+		then ${HOME} then -eu readonly
+		readonly then cd /usr/bin
+echo done readonly | $(pwd) x=1 local "$1" sed done
+"$@" local test /usr/bin ${HOME} export readonly local test && sed 'quoted text'
+readonly sed 'quoted text' /usr/bin grep "$1" "$1" $(pwd) ${HOME} cd export
+then awk readonly --verbose "$1" export /usr/bin then $(pwd)
+readonly sed cd 2>/dev/null $(pwd)
+		export then /usr/bin awk printf
+done 'quoted text' export /usr/bin
+		echo awk awk echo sed -eu cd x=1 export grep ${HOME} cd --verbose done --verbose
+	sed test echo done readonly /usr/bin done echo done "$1" $(pwd)
+		${HOME} cd grep test echo then
+		grep "$1" 'quoted text' $(pwd) sed readonly cd | /usr/bin printf
+	then ${HOME} 'quoted text' 2>/dev/null local grep
+done awk 2>/dev/null -eu readonly printf grep cd cd "$1" x=1 ${HOME} x=1 grep echo
+		export "$@" | ${HOME} && test done
+	test done local done "$1" then
+awk 'quoted text' echo 2>/dev/null readonly export "$@" local test "$@"
+	/usr/bin then 2>/dev/null /usr/bin --verbose x=1 'quoted text' $(pwd) echo
+--verbose $(pwd) -eu printf readonly grep done --verbose awk local
+	sed export && x=1 export then | echo $(pwd) sed "$@" "$1" export printf
+	cd $(pwd) && cd then /usr/bin
+	local done "$@" cd | 'quoted text' /usr/bin
+test $(pwd) grep --verbose -eu -eu export "$1" && sed printf echo then readonly
+echo -eu && readonly x=1 | x=1 -eu ${HOME} done -eu | x=1 && x=1
+	| readonly && /usr/bin "$1" "$@" echo 'quoted text' local 'quoted text'
+x=1 printf export | local readonly awk
+		readonly sed -eu sed printf $(pwd) grep grep "$1" -eu -eu awk -eu --verbose |
+	/usr/bin "$1" $(pwd) test
+local done /usr/bin local
+	x=1 readonly ${HOME} done /usr/bin test 'quoted text'
+		then | | | readonly x=1 "$1" --verbose echo sed x=1 then
+	export $(pwd) "$1" cd "$@" awk sed x=1 -eu 2>/dev/null &&
+done /usr/bin local 2>/dev/null 2>/dev/null grep export
+	done -eu ${HOME} --verbose -eu /usr/bin ${HOME}
+		| echo cd readonly awk /usr/bin x=1 'quoted text' readonly
+'quoted text' && 'quoted text' then grep test readonly x=1 |
+/usr/bin && 'quoted text' then awk --verbose readonly -eu done
+		| then "$1" "$1" awk readonly "$@" 'quoted text'
+		&& -eu sed "$@" | awk -eu /usr/bin local awk
+		| | 'quoted text' x=1 && | awk $(pwd)
+sed $(pwd) "$1" ${HOME} awk then printf ${HOME} /usr/bin $(pwd) then
+		--verbose -eu | $(pwd) ${HOME} printf grep /usr/bin -eu done cd
+"$@" export echo "$1" $(pwd)
+		$(pwd) && --verbose 2>/dev/null then test echo awk grep echo awk && grep
+	$(pwd) $(pwd) | x=1 awk | /usr/bin cd 'quoted text'
+	x=1 sed --verbose x=1 echo done echo test "$@" then "$1" "$1"
+awk "$@" /usr/bin /usr/bin -eu /usr/bin
+		--verbose local readonly $(pwd) export && "$1" -eu cd
+then "$@" --verbose awk
+	local -eu 2>/dev/null 2>/dev/null --verbose "$1" | echo 2>/dev/null
+	'quoted text' $(pwd) 'quoted text' x=1 x=1 echo -eu local | then
+	${HOME} -eu && cd grep /usr/bin $(pwd) 'quoted text'
+		local awk x=1 'quoted text' && sed "$1" && echo | "$1" /usr/bin awk ${HOME}
+	"$@" grep | cd echo echo test ${HOME}
+		| && awk echo 2>/dev/null cd sed
+		printf local sed 2>/dev/null awk printf && $(pwd) echo 'quoted text'
+--verbose test "$@" $(pwd) then cd test && awk cd 2>/dev/null
+	sed && --verbose "$1" "$@" -eu readonly "$1" -eu
+		| cd /usr/bin sed | then sed "$@" grep test awk | 'quoted text' 'quoted text'
+local cd | ${HOME} "$1" local "$1" cd && /usr/bin awk 'quoted text' "$@"
+awk $(pwd) echo test --verbose $(pwd) cd done && local then cd printf && "$@"
+		grep local ${HOME} then $(pwd)
+	'quoted text' echo then export --verbose grep 2>/dev/null
+grep "$@" local local export done --verbose awk ${HOME} echo /usr/bin
+		printf "$1" "$1" awk x=1 test echo local readonly sed echo echo printf export
+awk && test ${HOME} |
+		readonly "$@" cd /usr/bin then printf && 'quoted text' awk sed
+	"$1" sed | "$1" export test "$@"
+		grep export echo sed printf "$1"
+2>/dev/null $(pwd) cd --verbose export done /usr/bin "$@" readonly
+	&& cd test readonly sed readonly then echo echo echo then sed grep
+	printf printf done awk export 2>/dev/null readonly --verbose "$1" awk local 2>/dev/null
+	printf 'quoted text' && x=1 /usr/bin "$@" sed export | "$1" done
+done readonly cd && "$1" printf done export ${HOME} $(pwd)
+	sed done --verbose && export /usr/bin
+		grep 'quoted text' readonly export --verbose "$@" | done 2>/dev/null 2>/dev/null
+grep $(pwd) ${HOME} cd
+/usr/bin export $(pwd) sed awk awk -eu export awk "$1" ${HOME}
+&& test | /usr/bin -eu && sed echo --verbose -eu printf echo readonly
+	$(pwd) awk 2>/dev/null grep
+		${HOME} -eu "$@" export then x=1 "$1" $(pwd)
+	local then 2>/dev/null /usr/bin /usr/bin
+		cd "$1" 'quoted text' x=1
+	-eu local -eu -eu "$1" printf
+-eu 2>/dev/null then grep grep | echo && export 2>/dev/null echo local 2>/dev/null
+"$1" --verbose 'quoted text' readonly awk readonly sed | then readonly -eu done
+	&& | awk 'quoted text' cd echo done
+	$(pwd) --verbose done 'quoted text' --verbose &&
+echo export awk 'quoted text' 2>/dev/null -eu cd "$@" readonly grep readonly
+		cd x=1 "$@" test printf export test | done done ${HOME} grep
+	$(pwd) 'quoted text' then /usr/bin | x=1 &&
+"$1" $(pwd) grep awk done export -eu | printf x=1 echo "$@"
+	awk local && local --verbose
+done cd test | && 'quoted text' "$@" $(pwd) $(pwd) "$1" /usr/bin cd | "$@"
+	echo && 2>/dev/null 'quoted text' readonly sed "$1" readonly test awk "$@"
+		sed && $(pwd) $(pwd) && "$1" "$@" done awk export printf 2>/dev/null &&
+	grep readonly export -eu /usr/bin /usr/bin
+printf 2>/dev/null grep cd test -eu echo test grep awk grep | x=1 'quoted text'
+	--verbose sed test echo then -eu | printf 'quoted text'
+		done | ${HOME} done $(pwd) --verbose
+	"$1" x=1 $(pwd) export -eu export -eu local -eu /usr/bin 2>/dev/null sed 'quoted text'
+"$@" printf echo grep export done sed 2>/dev/null 'quoted text' export 2>/dev/null
+	"$@" && && done -eu $(pwd) export "$1" sed test --verbose | ${HOME} then ${HOME}
+	"$@" x=1 test awk local
+		x=1 | && 2>/dev/null awk then | -eu
+	then printf ${HOME} then && && sed done "$@" 2>/dev/null
+		&& echo --verbose then ${HOME} done -eu printf sed 'quoted text'
+		printf sed echo ${HOME} readonly
+${HOME} /usr/bin sed test --verbose
+		test 'quoted text' then
+	then -eu | cd "$@" /usr/bin && "$@" -eu readonly
+		export readonly && -eu /usr/bin done then sed then echo readonly done
+		export sed && -eu echo "$1" cd done done
+	"$1" -eu 'quoted text' export 'quoted text' echo -eu --verbose
+done "$@" | 'quoted text' grep | readonly && printf
+		'quoted text' local sed ${HOME} test $(pwd)
+readonly printf && $(pwd) | ${HOME} grep readonly ${HOME}
+-eu local | 2>/dev/null /usr/bin readonly ${HOME} printf
+sed $(pwd) then done
+grep "$@" echo $(pwd)
+${HOME} x=1 readonly "$1" /usr/bin done printf echo
+	export printf sed printf | $(pwd) 2>/dev/null printf | --verbose | 'quoted text'
+	done readonly printf | printf printf |
+		${HOME} export | "$1" done x=1 done sed --verbose "$@" x=1 echo then export awk
+		done done 2>/dev/null x=1 /usr/bin printf
+	-eu sed -eu sed printf export then echo 'quoted text' test "$1" local grep 'quoted text'
+	readonly -eu test 'quoted text' $(pwd) x=1 'quoted text'
+cd "$1" readonly readonly readonly awk 2>/dev/null
+		grep $(pwd) done 2>/dev/null test cd awk export --verbose -eu "$@" awk "$@"
+	&& echo sed /usr/bin ${HOME} echo readonly
+		done awk ${HOME} printf x=1 $(pwd)
+		2>/dev/null -eu printf 2>/dev/null x=1 export x=1 readonly $(pwd)
+	"$1" && x=1 /usr/bin readonly sed grep 2>/dev/null
+		"$@" --verbose /usr/bin 'quoted text' readonly "$1" sed ${HOME} "$1" printf
+	grep test -eu export grep cd "$@" /usr/bin
+		--verbose ${HOME} done "$1" sed test /usr/bin &&
+&& /usr/bin | cd $(pwd) done then $(pwd) $(pwd)
+cd && cd local export printf && then export
+--verbose $(pwd) grep 'quoted text' local $(pwd) readonly
+readonly ${HOME} done awk awk $(pwd)
+'quoted text' grep ${HOME} awk then
+		then awk done grep ${HOME} done cd | printf done $(pwd)
+	done then export && x=1 local awk test grep awk cd grep awk then | then sed
+	grep 'quoted text' 'quoted text' test
+	'quoted text' --verbose x=1 --verbose sed 2>/dev/null 2>/dev/null
+done readonly $(pwd) "$@" local awk printf /usr/bin test /usr/bin
+done grep /usr/bin 2>/dev/null && then test echo /usr/bin test
+	readonly echo && local done "$1" printf
+"$1" local export | ${HOME} --verbose
+grep printf grep local ${HOME} "$1" ${HOME} -eu
+	/usr/bin then done sed local 'quoted text' awk done ${HOME} -eu
+		test ${HOME} -eu echo /usr/bin | test local --verbose sed then
+	$(pwd) "$1" test ${HOME} cd --verbose cd && printf -eu done readonly | local
+		/usr/bin -eu --verbose | awk
+&& readonly "$@" grep cd 2>/dev/null
+		${HOME} 'quoted text' printf "$@" printf -eu
+"$@" "$@" x=1 "$@" printf 'quoted text' export 2>/dev/null
+		&& | sed grep done $(pwd) export grep --verbose then
+		then 2>/dev/null && printf "$1" "$1" printf |
+	grep -eu && readonly test grep "$@" awk grep then -eu sed
+	then --verbose test echo local export
+	cd 2>/dev/null --verbose | ${HOME} export 'quoted text'
+		-eu -eu -eu then x=1 done then --verbose test printf
+| local "$@" then | -eu /usr/bin echo "$1" echo printf sed export $(pwd)
+done cd 2>/dev/null 'quoted text'
+grep local readonly printf "$1" x=1 --verbose then 'quoted text' $(pwd) "$@"
+	$(pwd) printf cd cd x=1 | awk /usr/bin export 'quoted text' x=1
+test export export && && printf --verbose readonly test
+	-eu ${HOME} echo done 2>/dev/null 'quoted text' "$@" 'quoted text'
+'quoted text' local awk echo export export awk -eu test readonly "$@"
+		/usr/bin ${HOME} export
+$(pwd) then grep sed readonly /usr/bin 2>/dev/null
+		-eu 'quoted text' done grep grep echo ${HOME} x=1
+		-eu | "$@" export local && cd && && $(pwd) | 'quoted text' | done test --verbose
+		test test export -eu export printf echo cd ${HOME}
+	sed printf local cd readonly test readonly echo echo done
+x=1 printf printf && grep readonly export 'quoted text' "$@" ${HOME} | $(pwd)
+	| --verbose echo "$@" test ${HOME} "$1" then /usr/bin printf awk $(pwd)
+		--verbose /usr/bin "$@" --verbose awk -eu -eu
+	local done --verbose echo then 'quoted text' done cd export /usr/bin
+	2>/dev/null local "$@" | export "$1" done -eu "$1" awk
+		x=1 test awk export /usr/bin
+		"$1" grep ${HOME} sed readonly test "$1" grep --verbose --verbose --verbose
+	&& printf sed && readonly export "$@" ${HOME}
+		test "$@" echo readonly --verbose sed 2>/dev/null /usr/bin printf | awk
+| printf test "$@" then && cd "$@" /usr/bin | awk done export
+x=1 then 2>/dev/null "$@" "$@" echo done --verbose grep /usr/bin grep
+		awk 'quoted text' $(pwd) $(pwd) echo
+		$(pwd) $(pwd) "$@" then grep done ${HOME} local
+"$@" echo x=1 ${HOME} done then printf -eu $(pwd) export awk | 2>/dev/null grep
+	grep --verbose 'quoted text' x=1 | ${HOME} "$@" "$1" && printf
+"$@" then "$1" "$1" test x=1 grep | sed cd -eu grep sed local printf 2>/dev/null
+| echo $(pwd) && echo $(pwd) sed grep | x=1 "$1" sed done && ${HOME} export
+	/usr/bin "$1" 2>/dev/null --verbose local "$1"
+	cd /usr/bin $(pwd) && done 2>/dev/null | printf echo 'quoted text' done local
+		2>/dev/null 'quoted text' local | echo readonly readonly echo "$@" -eu &&
+	echo done /usr/bin $(pwd) 'quoted text' export "$@" --verbose
+	-eu local /usr/bin grep awk grep 'quoted text'
+| export echo 2>/dev/null done -eu awk &&
+/usr/bin 'quoted text' test 2>/dev/null --verbose | "$@" sed 2>/dev/null
+	sed sed $(pwd) readonly readonly awk
+x=1 $(pwd) awk cd grep awk echo
+		"$1" local /usr/bin | test "$@" "$@" printf cd grep
+	"$1" export 'quoted text' readonly x=1 export
+	${HOME} echo "$1" export
+	done --verbose grep test /usr/bin cd export echo test
+x=1 grep 'quoted text' --verbose awk test 2>/dev/null "$@" /usr/bin
+		local 2>/dev/null $(pwd) "$1" grep awk && | -eu readonly echo -eu --verbose
+done test /usr/bin sed --verbose readonly export printf
+	then echo --verbose awk | -eu test x=1 readonly
+		"$@" test sed "$1" "$1" readonly test printf ${HOME} printf
+x=1 then -eu --verbose cd | then printf /usr/bin | grep ${HOME}
+	test "$1" export echo | --verbose $(pwd) "$1" local $(pwd)
+		'quoted text' 'quoted text' printf echo readonly x=1 "$@" x=1 | grep "$1"
+	/usr/bin readonly done &&
+$(pwd) awk readonly 'quoted text' 2>/dev/null
+	then /usr/bin ${HOME} ${HOME} $(pwd) grep then
+	cd cd done 2>/dev/null
+		awk "$@" cd local $(pwd) then local
+done /usr/bin grep "$1" printf grep sed cd awk
+awk sed | "$@" -eu printf
+x=1 'quoted text' x=1 "$@" echo awk done echo --verbose
+--verbose "$@" cd echo then ${HOME} test
+	| test "$@" printf 'quoted text' awk then then export $(pwd) "$1"
+	| && "$1" echo echo test | "$1" | && | x=1 awk cd printf grep -eu && sed
+		echo readonly "$1" printf done printf -eu then /usr/bin then
+	local export done 'quoted text' sed $(pwd) printf
+		printf local "$@" done && done printf export
+	&& 2>/dev/null "$1" awk printf test ${HOME} ${HOME} export cd "$@" test
+grep $(pwd) export ${HOME}
+awk 'quoted text' awk then /usr/bin -eu local
+	done /usr/bin $(pwd) --verbose ${HOME} then 'quoted text' printf
+	printf -eu 2>/dev/null x=1 grep /usr/bin readonly --verbose && then
+		'quoted text' done --verbose 2>/dev/null ${HOME} $(pwd) --verbose 2>/dev/null sed
+	-eu && && export -eu "$1" x=1 sed printf readonly ${HOME} 2>/dev/null grep readonly
+readonly $(pwd) 'quoted text' printf done --verbose --verbose /usr/bin &&
+		sed grep 2>/dev/null /usr/bin echo | test --verbose
+	then test 2>/dev/null test /usr/bin "$1"
+	--verbose | echo $(pwd) readonly cd x=1 $(pwd) export $(pwd) /usr/bin
+	cd 2>/dev/null 2>/dev/null 2>/dev/null && /usr/bin
+		"$1" echo x=1 printf export grep && /usr/bin /usr/bin readonly
+	x=1 && grep ${HOME} $(pwd) 'quoted text' test
+		| then ${HOME} -eu sed $(pwd) $(pwd) $(pwd) 2>/dev/null
+		cd "$@" x=1 --verbose && | readonly --verbose "$1" --verbose /usr/bin ${HOME}
+		| --verbose && $(pwd) cd && ${HOME} 2>/dev/null test -eu local &&
+then test done export local $(pwd) 'quoted text'
+		sed local printf done readonly printf
+	&& echo done x=1 | grep /usr/bin
+		--verbose local /usr/bin readonly x=1 x=1 local test then ${HOME} x=1
+	echo cd -eu /usr/bin local grep export
+		${HOME} 2>/dev/null readonly done -eu /usr/bin | export
+echo sed echo cd -eu $(pwd) awk local awk awk echo
+	"$1" | "$@" "$1" 2>/dev/null awk
+		printf done ${HOME} cd | $(pwd) printf printf
+	then /usr/bin 2>/dev/null cd
+echo -eu awk then 'quoted text'
+		/usr/bin done test -eu done
+	--verbose sed -eu ${HOME} readonly sed
+export "$1" grep done then printf local local
+	| cd "$@" 'quoted text' /usr/bin --verbose | 2>/dev/null done 2>/dev/null ${HOME}
+	done echo printf test "$1" grep printf then sed local
+	$(pwd) export echo local --verbose x=1 grep /usr/bin
+		/usr/bin /usr/bin readonly | x=1 | cd | 2>/dev/null
+		echo $(pwd) -eu grep "$1" 'quoted text'
+then 2>/dev/null "$@" 'quoted text' -eu echo test
+sed 'quoted text' printf "$1" -eu cd -eu export "$@" sed printf
+		"$@" $(pwd) sed 'quoted text' done "$@" /usr/bin sed test
+	"$@" grep x=1 then test ${HOME} echo echo x=1 then "$@" ${HOME} ${HOME} --verbose
+x=1 local sed local printf 2>/dev/null x=1 test | local ${HOME} done $(pwd)
+'quoted text' ${HOME} done then grep ${HOME}
+		then 'quoted text' cd local printf awk test -eu && export --verbose
+	"$@" awk awk export cd printf "$@" x=1 then 2>/dev/null
+echo 'quoted text' -eu done -eu "$1" test $(pwd)
+grep awk 'quoted text' | readonly 'quoted text' local export printf grep
+	$(pwd) readonly --verbose echo export readonly printf local done
+	${HOME} /usr/bin "$1" x=1 test -eu done 2>/dev/null echo | done "$@" grep
+	/usr/bin && awk 2>/dev/null | grep
+		${HOME} ${HOME} done /usr/bin local echo awk "$1"
+2>/dev/null "$1" readonly export grep export cd printf /usr/bin
+| readonly && $(pwd) x=1 $(pwd) --verbose export cd echo
+		--verbose local x=1 && then 2>/dev/null x=1 -eu
+"$@" export && /usr/bin printf test export readonly && echo
+		"$1" readonly test awk awk
+	/usr/bin /usr/bin local /usr/bin 2>/dev/null /usr/bin x=1 --verbose && printf
+		then "$@" export echo export awk 2>/dev/null readonly
+	export && 2>/dev/null --verbose
+		done printf ${HOME} --verbose
+	| 'quoted text' x=1 cd /usr/bin echo --verbose /usr/bin
+		cd "$@" printf cd echo 2>/dev/null ${HOME} sed --verbose 2>/dev/null
+| test printf $(pwd) test | --verbose && /usr/bin ${HOME}
+	grep 2>/dev/null printf printf sed && test 2>/dev/null printf
+	then then printf grep $(pwd) readonly awk export && sed
+	grep cd export "$1" printf | then printf export export | 'quoted text' && "$@" "$1"
+readonly -eu cd "$@" sed 2>/dev/null "$1" /usr/bin export "$1" grep
+	/usr/bin then local 2>/dev/null echo ${HOME} printf
+		$(pwd) local sed export awk 'quoted text' local local grep
+	export "$@" export x=1 "$@" "$@" 'quoted text' local "$@" printf cd readonly
+		grep "$@" /usr/bin sed cd grep echo done
+		echo then test ${HOME} echo /usr/bin $(pwd) $(pwd) echo "$1" grep
+done then --verbose ${HOME} $(pwd)
+		echo x=1 $(pwd) done readonly test echo 2>/dev/null export then awk test 2>/dev/null
+echo --verbose /usr/bin test test ${HOME} readonly "$@" "$@" export
+	awk /usr/bin awk done printf cd $(pwd) "$1"
+		&& $(pwd) 'quoted text' x=1 test readonly
+	x=1 grep $(pwd) awk && ${HOME} "$@" awk /usr/bin readonly | /usr/bin
+| local $(pwd) 'quoted text' --verbose sed | grep printf | grep -eu /usr/bin awk
+		'quoted text' export test
+done -eu test readonly echo cd readonly then --verbose
+	"$1" export cd grep echo --verbose export grep --verbose
+export 2>/dev/null echo readonly --verbose x=1
+		echo | | -eu test printf
+printf done -eu awk cd 'quoted text'
+		--verbose && export --verbose sed readonly $(pwd) done sed 'quoted text' export
+		grep 'quoted text' x=1 && ${HOME} x=1 --verbose cd && /usr/bin
+awk then -eu $(pwd) /usr/bin "$@" done "$1" x=1 --verbose "$1" 2>/dev/null
+readonly test readonly 2>/dev/null
+		printf sed ${HOME} echo local "$1" --verbose
+	cd --verbose $(pwd) printf sed local
+		| "$1" echo $(pwd) local 2>/dev/null printf 2>/dev/null then readonly
+2>/dev/null | then "$1"
+| "$@" "$@" | /usr/bin export x=1 printf readonly grep awk | /usr/bin local -eu
+		export readonly cd readonly test -eu /usr/bin
+	readonly -eu readonly $(pwd) "$@" x=1 --verbose echo 2>/dev/null /usr/bin printf
+		-eu grep then awk cd "$@" readonly
+echo grep 2>/dev/null $(pwd)
+-eu printf 2>/dev/null cd
+		x=1 -eu ${HOME} "$1" ${HOME} -eu "$1" 'quoted text' then test echo "$@"
+	cd printf readonly --verbose local "$1" "$1" 2>/dev/null readonly
+		'quoted text' 2>/dev/null then | readonly test /usr/bin
+${HOME} 'quoted text' -eu readonly local -eu
+${HOME} then done cd 'quoted text'
+		grep local echo local then echo echo awk --verbose
+	'quoted text' sed then awk printf -eu
+| 'quoted text' then printf echo
+		echo | x=1 --verbose then "$@"
+	printf -eu sed $(pwd) done -eu cd 2>/dev/null "$@"
+		grep --verbose | | done 'quoted text' done 2>/dev/null /usr/bin then grep grep
+	-eu 'quoted text' x=1 -eu ${HOME}
+		done -eu -eu | $(pwd) x=1 done /usr/bin echo --verbose -eu "$@"
+-eu x=1 && test "$@" done cd
+		&& then readonly && -eu 2>/dev/null cd | -eu "$@" -eu printf ${HOME}
+		echo -eu -eu test --verbose x=1 $(pwd) local /usr/bin
+	grep test "$1" test printf readonly awk readonly "$@"
+		export /usr/bin awk && printf && cd --verbose && readonly | "$1" done "$1"
+		then readonly done "$1" -eu test 'quoted text' awk local export && sed && $(pwd)
+--verbose grep grep grep done awk --verbose 2>/dev/null test
+		'quoted text' && && local /usr/bin 2>/dev/null 2>/dev/null | done cd sed
+	readonly ${HOME} then export 2>/dev/null then 2>/dev/null "$@"
+	awk then grep readonly awk readonly export sed readonly --verbose
+--verbose export test done sed x=1 test export x=1 /usr/bin echo done $(pwd)
+	export sed export 2>/dev/null -eu test 'quoted text' test test cd && && test
+		local then /usr/bin --verbose | "$@" then -eu
+		sed x=1 /usr/bin then -eu 2>/dev/null 2>/dev/null export echo "$@" 2>/dev/null --verbose
+		then grep --verbose echo && readonly /usr/bin readonly sed export export -eu
+	cd done test export 2>/dev/null then then && ${HOME} --verbose export
+		export test | ${HOME} 2>/dev/null local test grep grep
+then 2>/dev/null /usr/bin awk echo | test $(pwd)
+	printf $(pwd) ${HOME} "$@" "$1" /usr/bin ${HOME} awk 2>/dev/null --verbose
+done export sed x=1 --verbose done "$1" grep | readonly |
+	$(pwd) echo local --verbose then sed --verbose x=1 && awk /usr/bin
+		'quoted text' export printf
+export cd /usr/bin 'quoted text' printf
+done local test 'quoted text' && 2>/dev/null then "$@" "$@"
+		${HOME} "$1" "$@" test 2>/dev/null
+-eu echo /usr/bin grep test test /usr/bin /usr/bin sed
+		grep | readonly /usr/bin done x=1 printf cd awk $(pwd) done
+2>/dev/null cd done ${HOME} sed 2>/dev/null
+		then sed grep "$@" then awk cd grep readonly && done done grep $(pwd)
+	echo cd | export cd readonly
+	| 2>/dev/null --verbose grep ${HOME}
+		test cd printf "$@" local /usr/bin --verbose 2>/dev/null ${HOME}
+	echo "$@" local done then echo 'quoted text' printf awk
+	x=1 readonly printf done 2>/dev/null ${HOME}
+	sed done local done --verbose test 'quoted text' | 2>/dev/null --verbose then
+"$@" done 2>/dev/null "$@" then -eu ${HOME}
+	"$@" printf ${HOME} x=1 echo grep /usr/bin |
+'quoted text' x=1 then test test | x=1 ${HOME}
+	done grep local export done then | "$@" |
+/usr/bin 'quoted text' -eu 2>/dev/null sed "$@" sed awk /usr/bin done 'quoted text'
+"$1" export test printf $(pwd) done
+	$(pwd) then "$1" printf /usr/bin 2>/dev/null then
+| x=1 x=1 local x=1 printf | test ${HOME} echo "$1" /usr/bin 2>/dev/null /usr/bin
+		'quoted text' echo /usr/bin
+"$@" $(pwd) && "$@" echo && printf "$1" readonly printf
+echo readonly echo --verbose "$@" then then
+2>/dev/null ${HOME} local x=1 "$1" "$@" printf echo 'quoted text'
+| --verbose 2>/dev/null /usr/bin
+		"$@" echo export --verbose sed | x=1 local
+awk "$@" ${HOME} "$1" -eu awk printf "$1" 2>/dev/null readonly
+echo 'quoted text' | 'quoted text' ${HOME} | 2>/dev/null
+| cd readonly /usr/bin 2>/dev/null x=1 x=1 export cd local
+		grep then -eu cd /usr/bin printf $(pwd) && "$1" $(pwd)
+		"$1" x=1 readonly cd &&
+		local 'quoted text' -eu export --verbose echo export $(pwd) awk
+	x=1 "$@" readonly /usr/bin printf test 'quoted text' | then -eu
+sed | 2>/dev/null 2>/dev/null echo 2>/dev/null ${HOME} -eu done
+readonly "$@" --verbose
+		x=1 | "$1" echo done -eu $(pwd) ${HOME} x=1 test echo echo && test | cd cd cd $(pwd)
+	'quoted text' --verbose awk "$1"
+	sed readonly ${HOME} export 2>/dev/null
+		$(pwd) test readonly "$1" export && done done test | cd awk -eu echo
+		--verbose && grep x=1 /usr/bin echo ${HOME} --verbose export then
+echo done echo --verbose cd --verbose --verbose "$1" sed
+	x=1 echo /usr/bin printf export -eu awk test --verbose cd | "$@" --verbose
+	x=1 "$1" /usr/bin $(pwd)
+		/usr/bin --verbose printf 'quoted text' sed cd
+	--verbose 'quoted text' awk awk
+	&& /usr/bin done --verbose "$@"
+	$(pwd) x=1 ${HOME} grep ${HOME} | x=1 $(pwd) export
+	done 'quoted text' ${HOME}
+		| then readonly awk cd cd && /usr/bin test $(pwd) x=1 awk
+	sed export then export then then 2>/dev/null done -eu
+	${HOME} export $(pwd) cd x=1
+		$(pwd) | && -eu | printf -eu 'quoted text' export --verbose 'quoted text'
+	'quoted text' 2>/dev/null /usr/bin then test
+$(pwd) && test --verbose "$@" "$@" export
+		test | printf grep grep echo sed awk -eu /usr/bin x=1 ${HOME} --verbose
+2>/dev/null | ${HOME} test done --verbose "$@" grep grep
+	--verbose "$@" then echo grep 2>/dev/null
+		grep cd 'quoted text' cd local
+		'quoted text' grep export
+awk | 'quoted text' printf then 'quoted text' && readonly echo export -eu 'quoted text'
+${HOME} && x=1 sed --verbose --verbose
+		printf 'quoted text' $(pwd) readonly "$@" --verbose -eu "$@" export -eu awk
+/usr/bin $(pwd) 'quoted text' &&
+	echo cd "$@" test 'quoted text' "$1" cd $(pwd) readonly test && then
+${HOME} -eu grep grep -eu export 2>/dev/null 'quoted text'
+cd export 'quoted text' printf "$@" echo "$@" /usr/bin | 'quoted text'
+		readonly | test | export echo local --verbose -eu test x=1 echo $(pwd) -eu
+		awk | echo "$@" echo "$1" local 'quoted text' ${HOME} x=1 awk /usr/bin ${HOME}
+		echo echo "$1" awk printf && | $(pwd) grep echo
+		sed export then /usr/bin export done && /usr/bin -eu sed | x=1 export awk -eu
+	--verbose 2>/dev/null echo | export readonly
+	"$1" "$@" $(pwd) "$1" echo x=1 && 'quoted text' 'quoted text'
+export 2>/dev/null readonly done x=1 /usr/bin printf --verbose
+		-eu test local ${HOME} grep x=1 grep /usr/bin sed printf -eu ${HOME}
+		test 'quoted text' readonly ${HOME} cd local
+		awk 2>/dev/null cd "$1" test
+		echo $(pwd) 2>/dev/null cd grep then && sed && 'quoted text' done local
+		cd 2>/dev/null cd printf echo export 'quoted text' done cd then cd local &&
+		/usr/bin ${HOME} readonly readonly -eu /usr/bin
+	grep x=1 2>/dev/null test export -eu "$@" && test printf 'quoted text'
+		printf export done 'quoted text' printf 2>/dev/null cd "$@"
+local cd printf $(pwd) echo && --verbose 'quoted text'
+done ${HOME} then then local $(pwd) 2>/dev/null "$@" local -eu
+	printf "$1" | printf && | local then ${HOME} cd awk
+awk grep export ${HOME} export done "$@" x=1 x=1 'quoted text'
+		/usr/bin 'quoted text' test 'quoted text' /usr/bin sed grep printf test
+	grep then echo readonly then $(pwd)
+		&& "$1" awk && echo cd -eu --verbose /usr/bin && awk grep awk
+		test local 2>/dev/null 2>/dev/null -eu x=1 grep
+	cd "$1" 'quoted text' -eu local --verbose
+then $(pwd) cd $(pwd) | test done /usr/bin local "$@" ${HOME}
+		'quoted text' ${HOME} printf grep "$1" test "$1"
+$(pwd) 2>/dev/null readonly test x=1
+		&& local 'quoted text' $(pwd) "$1" &&
+		export 2>/dev/null ${HOME} "$1"
+echo printf --verbose -eu -eu | echo "$@"
+		2>/dev/null | "$1" /usr/bin cd readonly done | awk
+		x=1 2>/dev/null $(pwd) awk 'quoted text' printf 2>/dev/null 2>/dev/null x=1
+	cd "$@" test grep | 'quoted text' export
+	${HOME} -eu cd then done local 2>/dev/null /usr/bin readonly ${HOME}
+		x=1 'quoted text' && export cd "$@" grep && --verbose 2>/dev/null test --verbose
+		$(pwd) awk -eu readonly "$1" test grep
+	done then printf readonly test ${HOME} 'quoted text'
+/usr/bin export 'quoted text' 2>/dev/null
+		&& sed grep awk test $(pwd) ${HOME} "$1" -eu x=1 /usr/bin done
+	| 2>/dev/null "$@" then
+		echo 'quoted text' "$1" awk done export ${HOME} done x=1 'quoted text' "$1" x=1
+	$(pwd) ${HOME} done ${HOME} "$1" done sed echo sed sed /usr/bin test
+readonly awk 'quoted text' grep | "$@" echo grep
+$(pwd) done test echo -eu
+$(pwd) grep cd --verbose then 2>/dev/null
+cd then "$@" readonly 'quoted text' 'quoted text' /usr/bin printf export
+	local test then grep ${HOME} | grep
+2>/dev/null readonly readonly grep local 2>/dev/null local "$@" ${HOME} echo printf
+	2>/dev/null 2>/dev/null "$@" cd export x=1 then ${HOME} echo then 2>/dev/null
+	$(pwd) printf x=1 ${HOME} then "$@" "$1" $(pwd) -eu ${HOME} grep done grep
+		2>/dev/null 2>/dev/null x=1 local | --verbose local x=1 &&
+awk "$@" done echo && then printf export cd then
+	sed 2>/dev/null printf 2>/dev/null /usr/bin $(pwd) export
+grep then done export "$1" /usr/bin echo ${HOME} then cd | awk export
+	printf local sed "$@" 'quoted text' cd | 2>/dev/null $(pwd) printf --verbose
+		local $(pwd) test "$@" printf printf $(pwd) then local sed
+		readonly ${HOME} test x=1 x=1 local cd local
+		${HOME} "$1" --verbose 'quoted text' test && cd x=1 local 'quoted text'
+test -eu echo $(pwd) "$1" local 2>/dev/null test -eu then | done --verbose local
+		-eu 'quoted text' done | 'quoted text' readonly printf ${HOME} local
+		readonly then done grep then cd ${HOME} local awk -eu then "$@" awk test printf
+	printf sed export readonly awk echo awk awk $(pwd)
+	'quoted text' $(pwd) grep test local printf $(pwd) grep
+grep "$1" "$@" grep cd sed ${HOME} sed 'quoted text'
+| 'quoted text' $(pwd) --verbose done 2>/dev/null export
+	--verbose | readonly 2>/dev/null /usr/bin echo "$1" "$@" test ${HOME} sed --verbose
+"$@" ${HOME} | x=1 awk -eu printf test echo && ${HOME}
+		awk $(pwd) && grep && "$1" -eu "$1" --verbose then sed test awk && cd | --verbose
+		awk x=1 then awk -eu 'quoted text' then sed && cd $(pwd)
+readonly then awk "$1" echo then sed 2>/dev/null "$@" echo
+	&& grep done local "$1" test ${HOME} readonly "$1" readonly 'quoted text'
+${HOME} && | x=1 2>/dev/null "$1" echo /usr/bin /usr/bin
+sed awk "$@" 'quoted text' printf /usr/bin /usr/bin -eu --verbose $(pwd)
+printf printf -eu x=1 ${HOME}
+		| printf grep test grep local | x=1 printf --verbose 2>/dev/null -eu sed sed
+sed --verbose && test grep $(pwd) echo export grep &&
+printf x=1 x=1 readonly -eu -eu ${HOME} then export sed "$@" echo | x=1 test
+| x=1 awk export done --verbose /usr/bin $(pwd) printf printf | then "$1"
+		/usr/bin then echo test
+readonly $(pwd) local export grep grep
+	| awk readonly cd -eu done && && grep test echo awk echo readonly local ${HOME}
+cd "$@" test ${HOME} ${HOME} done "$@" done $(pwd) local echo
+-eu awk 2>/dev/null done sed cd
+	"$1" grep readonly printf "$1" && local sed
+	x=1 --verbose sed 2>/dev/null "$1" export then grep then 'quoted text' 'quoted text'
+		x=1 printf readonly "$@" && x=1 2>/dev/null awk sed
+	--verbose --verbose sed /usr/bin local
+		'quoted text' readonly done | local grep 2>/dev/null printf
+	test then --verbose then "$1" export "$@" echo cd && echo -eu export -eu
+	then then test x=1 'quoted text' 2>/dev/null
+		x=1 ${HOME} echo ${HOME}
+	-eu /usr/bin local echo awk /usr/bin export 2>/dev/null awk grep
+	then echo "$@" 'quoted text'
+"$@" readonly readonly && awk
+	| cd ${HOME} --verbose $(pwd) awk sed done 'quoted text'
+		then done x=1 then ${HOME} readonly "$1" /usr/bin
+		'quoted text' export printf
+"$@" awk test ${HOME} local && sed awk then /usr/bin 'quoted text' $(pwd) -eu
+	readonly export test /usr/bin $(pwd) "$1" echo local ${HOME} $(pwd) x=1
+		cd grep -eu test readonly
+	done $(pwd) sed sed echo x=1 export ${HOME} done
+	test 2>/dev/null | readonly --verbose
+--verbose "$1" sed ${HOME} ${HOME} | then | -eu cd 'quoted text'
+test --verbose cd export echo 'quoted text' | export grep done | awk then
+$(pwd) 'quoted text' grep
+		readonly sed -eu done export
+		${HOME} "$1" readonly x=1 | test x=1 2>/dev/null
+"$1" local "$@" awk test "$@" grep sed awk --verbose
+		echo -eu local export $(pwd)
+	"$@" $(pwd) ${HOME} then done printf local -eu sed --verbose printf && "$1"
+	cd cd 2>/dev/null then done ${HOME} 'quoted text' --verbose
+		readonly export | echo test -eu 2>/dev/null "$@" sed then test echo export
+	${HOME} export ${HOME} test $(pwd) x=1 printf x=1 --verbose 'quoted text'
+	then $(pwd) then "$1" awk test "$@" -eu then echo test test 'quoted text'
+		2>/dev/null printf "$@" test echo
+done then 'quoted text' printf "$@" printf grep test local $(pwd)
+/usr/bin -eu awk -eu && test test "$1" | "$1" readonly echo local | --verbose
+then then 2>/dev/null echo export 2>/dev/null grep test --verbose then readonly
+2>/dev/null $(pwd) awk 2>/dev/null ${HOME} test sed test 'quoted text' "$@" $(pwd)
+x=1 $(pwd) 'quoted text' $(pwd) && grep test -eu 'quoted text' /usr/bin awk
+		local ${HOME} | local | 2>/dev/null sed -eu $(pwd) "$@" "$1" export $(pwd)
+		2>/dev/null test 'quoted text' readonly printf -eu echo printf | cd readonly $(pwd)
+echo "$1" done --verbose /usr/bin "$1" sed
+		$(pwd) awk cd | echo grep && $(pwd) local local /usr/bin
+		--verbose echo export -eu echo 2>/dev/null && --verbose done readonly 'quoted text'
+"$@" "$1" export | && --verbose done $(pwd) printf then | export
+		"$@" 2>/dev/null export done readonly
+		x=1 ${HOME} local --verbose echo printf grep
+	echo x=1 --verbose | then /usr/bin grep | export $(pwd) --verbose
+-eu printf 2>/dev/null /usr/bin
+		'quoted text' "$1" done /usr/bin --verbose readonly /usr/bin
+		then -eu done | $(pwd) readonly | cd cd -eu awk cd readonly
+		${HOME} "$1" 'quoted text' then sed awk then x=1 readonly cd readonly test printf
+test -eu echo ${HOME} "$@" $(pwd) && $(pwd) cd 2>/dev/null -eu test local
+	local cd readonly ${HOME} ${HOME} /usr/bin "$@" printf then awk printf printf
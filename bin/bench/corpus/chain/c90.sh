@@ -0,0 +1,2001 @@
+	$(pwd) awk test "$@" test
+"$@" echo && --verbose "$1" sed
+	"$1" then echo echo printf
+	/usr/bin $(pwd) ${HOME} printf
+		done -eu then then test cd printf readonly done awk
+	&& 'quoted text' grep local x=1 grep local done export grep 2>/dev/null ${HOME}
+export x=1 && -eu sed then | --verbose readonly ${HOME}
+	readonly local awk done "$1" $(pwd) printf test readonly local grep /usr/bin
+		sed cd | printf -eu export test readonly && 2>/dev/null -eu --verbose
+sed 2>/dev/null x=1 /usr/bin --verbose | ${HOME}
+		"$@" "$@" then | 'quoted text' export export $(pwd) ${HOME} awk cd then
+	local then grep readonly -eu | x=1 then awk $(pwd) export
+cd echo done export awk grep done cd 2>/dev/null
+	--verbose sed export local local x=1 x=1 awk echo awk ${HOME} awk
+	then test awk echo "$1"
+	/usr/bin sed local cd /usr/bin ${HOME} test done && && | cd $(pwd) then cd "$@"
+	cd local readonly "$1" "$@" | test echo
+--verbose readonly export 2>/dev/null $(pwd) 2>/dev/null
+test export grep | grep | sed && done -eu --verbose | sed cd export
+		/usr/bin 2>/dev/null $(pwd) | ${HOME} done then x=1 printf
+cd /usr/bin echo cd awk
+	local -eu | then "$@"
+${HOME} readonly --verbose awk | local "$@" then "$1" readonly 'quoted text'
+		${HOME} readonly x=1 'quoted text' ${HOME} $(pwd) local then
+		grep echo local /usr/bin "$@" 2>/dev/null printf local export &&
+	-eu /usr/bin test sed /usr/bin ${HOME} test local awk test export
+		| echo x=1 "$@" test awk 2>/dev/null grep local echo awk local 2>/dev/null
+x=1 "$1" readonly sed done sed x=1 /usr/bin | "$@" $(pwd) ${HOME} readonly
+	&& $(pwd) 2>/dev/null cd export local "$@" x=1 'quoted text'
+		echo export "$1" --verbose
+		cd --verbose local -eu 2>/dev/null --verbose
+		done x=1 -eu -eu 'quoted text' --verbose ${HOME} test test && | ${HOME} test
+&& local sed printf sed
+	${HOME} --verbose "$@" x=1 export 2>/dev/null
+"$1" local "$@" export /usr/bin printf
+sed 'quoted text' cd done printf && x=1 echo && then done
+then grep printf -eu && $(pwd) test /usr/bin test grep export printf
+/usr/bin x=1 printf "$@" done "$1" cd -eu && grep -eu done cd 2>/dev/null && done
+export awk export --verbose printf && 'quoted text' -eu "$@" &&
+cd "$@" "$1" ${HOME} local 2>/dev/null export "$@" test grep "$@" test --verbose
+'quoted text' -eu echo then "$1" done
+done cd done grep $(pwd) export /usr/bin export cd
+		local | printf export local "$1" done
+	then awk $(pwd) test && | /usr/bin $(pwd) then
+test -eu | readonly readonly export x=1 "$1" 'quoted text' ${HOME}
+readonly x=1 cd local readonly
+		$(pwd) | then | then "$1" 2>/dev/null test /usr/bin local 2>/dev/null
+		awk 2>/dev/null grep -eu | cd && ${HOME} sed export echo
+		"$1" cd -eu echo x=1 grep printf echo 2>/dev/null
+${HOME} /usr/bin local -eu done local export "$1" 'quoted text'
+	-eu readonly $(pwd) local local -eu then
+		printf 2>/dev/null 2>/dev/null done && 2>/dev/null
+| "$1" /usr/bin /usr/bin -eu "$1" 'quoted text' 'quoted text' x=1
+	printf x=1 "$1" cd 2>/dev/null local ${HOME} local printf printf
+echo $(pwd) | "$1" local -eu readonly
+/usr/bin 'quoted text' "$@" sed && "$@" readonly then readonly
+		$(pwd) awk sed -eu "$1" ${HOME} && "$@" then test readonly grep "$@" printf
+	"$1" "$1" ${HOME} sed sed "$@" sed sed "$1" sed local readonly readonly
+		| --verbose ${HOME} grep ${HOME} x=1 && echo cd
+"$@" readonly readonly /usr/bin x=1 -eu done /usr/bin
+awk "$1" printf /usr/bin sed 2>/dev/null printf 2>/dev/null
+	then test printf 'quoted text' | "$@" printf 2>/dev/null && local printf
+| | then test "$@" grep sed --verbose then -eu
+then done then done readonly ${HOME} ${HOME} local
+done done awk awk echo "$@" echo cd export echo
+--verbose readonly $(pwd) "$@" --verbose
+	grep | | cd "$1" && | $(pwd) echo --verbose export cd /usr/bin done printf
+	2>/dev/null -eu $(pwd) /usr/bin ${HOME} x=1 "$@" grep "$@" 'quoted text'
+		--verbose readonly grep $(pwd) "$@" 'quoted text'
+readonly /usr/bin readonly readonly sed "$@" sed then 2>/dev/null local sed x=1
+	export && -eu ${HOME} && "$1" awk && 2>/dev/null
+		-eu "$1" ${HOME} 'quoted text'
+	/usr/bin cd readonly done local /usr/bin --verbose "$1" cd cd 'quoted text'
+	sed test 2>/dev/null /usr/bin grep local "$1" ${HOME} 2>/dev/null local 2>/dev/null
+${HOME} test && grep grep /usr/bin 2>/dev/null ${HOME} $(pwd) printf export
+	awk x=1 ${HOME} --verbose readonly printf "$1" 2>/dev/null ${HOME}
+		then /usr/bin && readonly sed
+		echo readonly printf printf test $(pwd) -eu
+-eu -eu awk | awk export export $(pwd) ${HOME} test "$1" then awk | then readonly
+		grep echo "$@" done "$1" 'quoted text' --verbose
+	export sed readonly --verbose /usr/bin
+		printf "$1" local cd $(pwd) 2>/dev/null ${HOME} export readonly awk
+		"$1" local && --verbose local local && export 'quoted text' test 'quoted text'
+		"$1" then sed | | then /usr/bin sed 'quoted text' && 2>/dev/null
+		local "$1" "$@" "$1" sed "$1" | done "$@" done "$1" local test | grep /usr/bin
+	-eu awk "$1" ${HOME} readonly | "$1" "$1" done 2>/dev/null printf
+		&& && /usr/bin printf export done sed echo
+		grep "$@" echo sed "$@" --verbose
+	'quoted text' x=1 "$1" grep --verbose 2>/dev/null | local sed done test "$@" readonly
+		local echo export "$1" grep
+		${HOME} test cd cd && echo
+-eu -eu sed cd x=1 sed local readonly $(pwd) export test export
+done then "$1" $(pwd) -eu done | echo echo 2>/dev/null ${HOME} "$1" awk
+	readonly "$@" printf "$1" | readonly export /usr/bin readonly --verbose "$@"
+awk cd ${HOME} local $(pwd) --verbose -eu "$1" "$1" | awk /usr/bin $(pwd)
+grep then --verbose ${HOME} grep test 2>/dev/null
+		"$1" local --verbose 2>/dev/null
+	${HOME} readonly printf --verbose -eu 'quoted text' done
+		$(pwd) printf /usr/bin echo sed ${HOME} sed then done
+	grep -eu then /usr/bin $(pwd) 'quoted text' -eu grep test $(pwd) printf test 2>/dev/null
+awk 2>/dev/null "$1" grep cd
+	"$@" -eu then test readonly then sed && ${HOME}
+		/usr/bin awk test done local | echo then "$1" grep "$@" printf local
+	/usr/bin grep printf && awk echo --verbose printf sed
+	awk printf 2>/dev/null echo local printf
+		-eu $(pwd) "$@" -eu $(pwd) && then /usr/bin echo
+		| grep then then 2>/dev/null cd awk
+"$1" awk test && done -eu --verbose export awk test $(pwd) "$@" /usr/bin
+	| ${HOME} test echo /usr/bin x=1 "$1" ${HOME} $(pwd) && 2>/dev/null done
+awk local grep ${HOME} then -eu
+		test && printf readonly | export
+$(pwd) awk "$1" x=1 --verbose grep
+-eu -eu done grep echo "$@" grep then /usr/bin /usr/bin done
+		done readonly 'quoted text' grep --verbose echo 2>/dev/null x=1 'quoted text'
+	done awk --verbose --verbose $(pwd) "$@" "$@"
+	grep readonly export | 'quoted text' 'quoted text' "$1" x=1 export readonly
+"$1" "$1" 2>/dev/null /usr/bin 'quoted text' 2>/dev/null cd test
+		${HOME} echo "$1" "$1" "$1" 2>/dev/null --verbose sed
+		2>/dev/null 'quoted text' "$@" then ${HOME} && && readonly grep
+		cd $(pwd) sed test cd local printf export -eu | awk
+$(pwd) ${HOME} sed 'quoted text' grep "$@" $(pwd) test
+export -eu -eu 2>/dev/null "$1" 2>/dev/null cd awk | local
+local then readonly /usr/bin sed sed $(pwd) 'quoted text'
+-eu ${HOME} then cd /usr/bin 'quoted text' readonly && printf echo "$@" done then
+		/usr/bin grep echo echo --verbose /usr/bin local
+		awk awk echo 'quoted text' 'quoted text'
+'quoted text' local grep ${HOME} $(pwd)
+cd local "$1" "$@" export local x=1 /usr/bin $(pwd) awk printf 2>/dev/null then
+	cd awk local test 2>/dev/null grep 2>/dev/null -eu test
+test then cd printf test local export readonly --verbose test
+		"$1" printf "$1" 2>/dev/null
+		cd "$@" readonly sed sed $(pwd)
+/usr/bin /usr/bin 2>/dev/null
+		/usr/bin then done readonly readonly
+$(pwd) --verbose echo grep 'quoted text' "$1" /usr/bin /usr/bin
+		done printf "$@" "$1"
+		cd grep printf && x=1 printf --verbose
+	--verbose readonly /usr/bin awk | "$@"
+grep test export local "$1" awk then x=1 echo
+	/usr/bin 'quoted text' readonly 2>/dev/null echo /usr/bin && --verbose
+2>/dev/null awk 2>/dev/null 'quoted text'
+export -eu ${HOME} local
+		readonly echo --verbose
+		-eu x=1 2>/dev/null -eu
+	export 2>/dev/null x=1 then "$@" $(pwd) local ${HOME}
+readonly x=1 readonly "$@" export
+		local echo then ${HOME} sed x=1 | x=1 && printf
+		readonly "$1" then $(pwd) sed test echo ${HOME} /usr/bin printf sed awk
+	"$@" -eu /usr/bin | done awk done export 'quoted text'
+		printf ${HOME} then x=1 echo x=1 --verbose
+		/usr/bin --verbose --verbose readonly --verbose cd readonly | done cd
+readonly | awk local "$@" export --verbose cd -eu 2>/dev/null echo --verbose
+echo local ${HOME} -eu /usr/bin done | done test "$1" grep test cd export
+--verbose "$1" test 'quoted text'
+	cd cd && export --verbose -eu | echo "$@" -eu test | --verbose
+	then $(pwd) 'quoted text' printf ${HOME} sed
+printf local /usr/bin --verbose x=1 export
+	cd /usr/bin | done local done sed sed 2>/dev/null grep done x=1 cd awk
+		export done && then --verbose 2>/dev/null -eu ${HOME}
+x=1 "$1" --verbose export readonly /usr/bin cd sed ${HOME} -eu "$1" printf
+/usr/bin awk export "$@" "$1" /usr/bin 'quoted text'
+		export x=1 "$1" -eu test "$@" export local /usr/bin /usr/bin "$@" export
+done done echo then sed "$@" echo --verbose test local readonly x=1
+		&& 'quoted text' test -eu cd --verbose | "$@" 2>/dev/null x=1
+	readonly | 2>/dev/null $(pwd) cd then --verbose -eu cd local $(pwd) /usr/bin
+"$1" test /usr/bin "$@" | local awk "$1" | sed printf export sed x=1
+	| sed "$1" test 2>/dev/null
+done && -eu -eu --verbose printf readonly then 'quoted text'
+	&& then awk local printf grep echo done local test export
+cd test && then export ${HOME} --verbose
+grep "$1" sed | $(pwd) x=1 local x=1 local export sed
+echo echo echo awk printf local /usr/bin printf && "$@" printf
+	grep grep export printf echo ${HOME}
+		-eu 'quoted text' 2>/dev/null
+		'quoted text' | readonly --verbose sed --verbose
+		export 2>/dev/null cd sed local "$@" readonly readonly echo ${HOME} readonly
+	done printf export && "$1" /usr/bin
+'quoted text' printf "$1" | readonly sed x=1 --verbose -eu "$1"
+		printf then x=1 "$1" 2>/dev/null
+test ${HOME} | --verbose 'quoted text' $(pwd) readonly export
+/usr/bin echo sed done local "$@"
+	${HOME} grep printf 'quoted text' sed sed -eu cd x=1 sed /usr/bin
+		${HOME} then done done "$1" local printf
+/usr/bin awk test echo grep printf readonly
+	then "$@" export cd --verbose 'quoted text' then readonly test
+	"$@" $(pwd) done grep printf
+		'quoted text' export printf x=1
+	cd | printf ${HOME} then
+awk printf | x=1 "$1" export sed
+		done "$1" local test -eu local --verbose cd ${HOME} printf "$@" "$1" echo then
+	-eu "$@" /usr/bin 'quoted text'
+printf grep awk local done sed readonly | "$@" local |
+grep ${HOME} then sed then grep awk sed "$@" ${HOME} cd 'quoted text' &&
+		2>/dev/null echo /usr/bin test
+	x=1 --verbose export ${HOME} export test | export
+	| x=1 export test readonly /usr/bin
+export /usr/bin ${HOME} sed export | local done cd local
+		x=1 ${HOME} readonly then
+	sed done readonly cd 'quoted text'
+	/usr/bin /usr/bin then x=1 --verbose 2>/dev/null && then awk printf cd local
+'quoted text' && "$@" "$1" $(pwd) grep done then readonly
+		done ${HOME} local then "$@" /usr/bin 2>/dev/null x=1 ${HOME} cd awk sed x=1
+	done $(pwd) sed cd printf test sed x=1 2>/dev/null awk -eu 'quoted text'
+2>/dev/null /usr/bin cd ${HOME} -eu readonly | --verbose -eu --verbose
+	done test test done "$1" -eu && cd && readonly ${HOME}
+echo --verbose "$1" 2>/dev/null
+2>/dev/null "$1" ${HOME} /usr/bin 'quoted text' "$@" test readonly
+	then then then awk ${HOME} then
+	export awk && readonly then 2>/dev/null sed test $(pwd) test
+	printf /usr/bin then export ${HOME}
+		done | export 2>/dev/null cd then -eu "$@" --verbose "$@" -eu then
+	2>/dev/null readonly /usr/bin
+	--verbose 2>/dev/null sed
+2>/dev/null done --verbose test | awk $(pwd) grep $(pwd) readonly
+	then cd sed | done --verbose local test echo 2>/dev/null echo awk "$1" "$1"
+x=1 sed $(pwd) printf /usr/bin export test "$1" readonly "$1" printf
+--verbose -eu cd $(pwd) then /usr/bin ${HOME} $(pwd) && done then cd "$@"
+-eu readonly echo 2>/dev/null 2>/dev/null
+	test awk local then readonly
+		${HOME} sed && "$1" grep | ${HOME}
+		local done -eu then "$1" test export
+	$(pwd) test export -eu -eu
+$(pwd) --verbose $(pwd) cd | && 2>/dev/null export echo
+	x=1 /usr/bin done | 'quoted text' test sed local && local readonly
+export done && ${HOME} then /usr/bin
+		readonly x=1 -eu 2>/dev/null x=1 local local && awk echo echo
+	-eu export -eu "$1" "$@" sed done $(pwd) -eu && $(pwd) 'quoted text'
+local done 2>/dev/null
+	x=1 ${HOME} "$1" && echo local done export awk "$1" | /usr/bin export
+	awk cd readonly 2>/dev/null test "$@" "$@" export -eu "$1"
+	done x=1 $(pwd) export local echo --verbose echo done
+	${HOME} done cd --verbose done sed cd x=1 then $(pwd) done
+"$1" x=1 test export export
+		$(pwd) -eu "$@" 'quoted text'
+		sed grep done x=1 --verbose "$1" done then "$@" cd sed echo ${HOME} then
+	done done done -eu ${HOME} grep test then && test && | 'quoted text'
+printf ${HOME} awk x=1 cd awk awk then --verbose then awk readonly --verbose
+		x=1 awk cd 'quoted text' "$1"
+		echo ${HOME} 'quoted text' x=1 'quoted text'
+		/usr/bin ${HOME} --verbose 2>/dev/null "$@"
+		${HOME} --verbose cd cd grep 2>/dev/null echo
+	x=1 echo readonly -eu grep "$@" local 2>/dev/null export
+		sed done sed --verbose awk 2>/dev/null export /usr/bin | ${HOME} readonly export
+		test x=1 'quoted text' test
+	/usr/bin && grep "$@" cd x=1 "$@" readonly awk 2>/dev/null test
+x=1 2>/dev/null ${HOME} printf ${HOME} done awk export then
+		cd readonly $(pwd) cd cd local x=1 'quoted text'
+local --verbose /usr/bin done "$1" "$1" done "$@" /usr/bin export 2>/dev/null
+		then done done "$@" grep -eu x=1 | | cd readonly export test && grep
+	&& x=1 "$@" sed cd /usr/bin then ${HOME} echo readonly
+--verbose && readonly printf 2>/dev/null $(pwd)
+done "$@" -eu $(pwd) 'quoted text' $(pwd)
+test "$@" sed "$1" -eu readonly x=1 -eu test 'quoted text' | then grep
+		--verbose export "$@" cd $(pwd) cd "$@" test 2>/dev/null
+	--verbose sed -eu --verbose test cd "$@" | export
+	grep printf "$@" readonly readonly
+"$1" then 'quoted text' test 'quoted text'
+		sed echo && $(pwd) then grep x=1 printf "$1" -eu 2>/dev/null
+	$(pwd) 2>/dev/null ${HOME} echo cd --verbose
+		"$1" done | grep && cd ${HOME} --verbose local $(pwd) export "$@"
+		"$@" export 'quoted text' export
+		2>/dev/null awk -eu 2>/dev/null "$@" awk echo printf "$@" /usr/bin export 'quoted text'
+		printf --verbose printf sed
+grep x=1 awk 2>/dev/null echo sed printf done local export
+	| awk echo "$@" -eu "$1"
+	awk printf $(pwd) $(pwd) test /usr/bin 'quoted text' "$1" done
+| local cd 2>/dev/null grep
+		done $(pwd) --verbose test
+	'quoted text' ${HOME} "$1" x=1 | local then
+		test printf awk echo awk
+sed cd cd cd then readonly test then export /usr/bin "$1" done
+echo | "$@" 'quoted text' | 2>/dev/null $(pwd) "$1" "$@" then readonly
+-eu --verbose --verbose
+then --verbose readonly grep /usr/bin --verbose ${HOME} ${HOME} done
+	--verbose printf 'quoted text'
+grep local cd then "$1" && grep | export
+		2>/dev/null x=1 /usr/bin
+	--verbose -eu sed echo done 2>/dev/null
+export cd sed readonly awk then cd grep cd ${HOME}
+		&& $(pwd) local cd -eu
+		| awk awk -eu readonly $(pwd) sed ${HOME} then | && cd readonly done done readonly
+x=1 2>/dev/null 'quoted text' echo local --verbose test grep export
+	printf /usr/bin grep local -eu awk readonly sed 'quoted text'
+		&& test 2>/dev/null "$@" sed 'quoted text' done done "$@" 2>/dev/null
+	${HOME} | ${HOME} 'quoted text'
+	x=1 "$1" local sed cd test awk "$1" ${HOME} sed -eu 'quoted text'
+$(pwd) --verbose /usr/bin printf | $(pwd) awk then test local
+"$@" "$@" readonly 2>/dev/null awk cd $(pwd) printf awk
+		readonly "$@" export grep cd test export && awk test --verbose sed
+	sed done --verbose grep ${HOME} /usr/bin
+		"$@" cd 2>/dev/null -eu sed "$1" readonly echo ${HOME} grep sed then 'quoted text'
+		x=1 -eu $(pwd) grep -eu grep printf ${HOME} && local &&
+		cd local echo && ${HOME} "$1" $(pwd) -eu
+/usr/bin readonly 'quoted text' x=1 grep && sed 2>/dev/null then && &&
+	sed -eu cd 2>/dev/null ${HOME} done grep 2>/dev/null --verbose 'quoted text'
+/usr/bin awk x=1 "$@" x=1 local && export done 'quoted text' 2>/dev/null
+printf export sed -eu ${HOME} printf then
+cd readonly --verbose && test then ${HOME} && | sed /usr/bin "$1"
+		$(pwd) echo ${HOME} printf | --verbose | 'quoted text' cd echo
+		then && && grep $(pwd) | 'quoted text' cd ${HOME} then printf
+	echo x=1 export && -eu printf printf
+	'quoted text' then export | printf export awk then
+		--verbose test | -eu x=1 test
+		/usr/bin local 'quoted text' awk cd
+then echo x=1 "$1" then awk --verbose -eu $(pwd)
+"$1" then "$@" printf echo echo "$1" awk then | --verbose export $(pwd)
+--verbose echo echo echo export | local | x=1 local "$1" -eu
+		${HOME} && x=1 grep echo 'quoted text' --verbose 'quoted text'
+		| then "$@" /usr/bin awk done
+done "$1" $(pwd) "$@" && local "$1" done echo $(pwd) grep readonly
+	cd 2>/dev/null "$1" done grep local $(pwd) /usr/bin
+		/usr/bin | readonly printf printf
+		$(pwd) --verbose "$1" "$1" "$1" x=1 | readonly sed -eu
+	x=1 /usr/bin $(pwd) printf ${HOME} cd grep "$1" export cd done then
+'quoted text' /usr/bin cd x=1
+grep echo x=1 --verbose cd x=1 sed sed cd cd local /usr/bin -eu printf x=1
+done done echo -eu done then --verbose && -eu echo
+		readonly && | cd printf
+	--verbose cd $(pwd) echo awk "$@" | && && ${HOME}
+		printf 2>/dev/null | local $(pwd)
+		awk ${HOME} $(pwd) "$1" && "$1" --verbose $(pwd) export done 'quoted text'
+		echo cd $(pwd) 2>/dev/null -eu done $(pwd) done "$1" "$1" x=1
+		-eu | test "$1" "$@" ${HOME} | 2>/dev/null local |
+	"$1" -eu ${HOME} readonly awk cd | ${HOME} echo cd then
+		&& | readonly /usr/bin /usr/bin ${HOME} --verbose ${HOME}
+"$@" "$@" printf export | -eu /usr/bin 2>/dev/null sed ${HOME} "$@" local printf
+export done grep awk test
+	readonly "$1" cd then
+$(pwd) --verbose grep ${HOME} -eu awk grep export "$@" 'quoted text'
+	x=1 grep echo local --verbose grep printf "$1" done
+grep && ${HOME} printf | "$1"
+	cd x=1 export grep 'quoted text'
+	"$@" "$@" awk printf grep
+	x=1 echo awk readonly local ${HOME} local ${HOME} 2>/dev/null -eu sed printf local
+		/usr/bin done 2>/dev/null -eu cd x=1 sed
+		${HOME} echo $(pwd) | 2>/dev/null local awk x=1 | export | done | 'quoted text'
+		cd /usr/bin /usr/bin ${HOME} $(pwd)
+		readonly then "$1" | "$@" printf x=1 /usr/bin
+test ${HOME} then cd printf --verbose then printf local | printf
+		done x=1 $(pwd) "$1" grep $(pwd) "$@" ${HOME} export -eu then
+then grep -eu awk test && test test awk sed sed awk /usr/bin
+	-eu "$1" readonly "$@" then
+&& "$@" sed local grep export
+		"$1" printf "$@" sed | grep --verbose printf
+	readonly export awk local printf
+		2>/dev/null /usr/bin grep echo printf local awk done then 'quoted text'
+then 'quoted text' awk awk | && awk cd /usr/bin
+readonly echo ${HOME} local echo readonly
+		awk /usr/bin 2>/dev/null test && /usr/bin ${HOME}
+		printf 'quoted text' -eu sed printf test /usr/bin test && /usr/bin
+/usr/bin ${HOME} ${HOME} export test awk
+	then grep "$@" done printf printf ${HOME} ${HOME} done && "$1"
+echo ${HOME} && $(pwd) ${HOME} --verbose "$1" && done "$@"
+	cd | printf done /usr/bin echo export
+	readonly test grep "$@" test $(pwd)
+		/usr/bin "$1" echo cd echo sed
+	--verbose then | "$1" local "$@" echo ${HOME} x=1 test then cd /usr/bin
+"$@" readonly "$@" ${HOME} -eu && /usr/bin "$@"
+export "$@" awk | --verbose | ${HOME} | sed done grep readonly -eu
+awk echo done && "$@" 2>/dev/null | 2>/dev/null
+"$1" readonly local printf echo /usr/bin printf readonly printf /usr/bin
+		cd --verbose done x=1 x=1 then
+		x=1 x=1 cd && grep 'quoted text' ${HOME} done x=1 x=1 "$@" done -eu --verbose
+x=1 'quoted text' then 'quoted text' printf --verbose done export
+		| /usr/bin "$@" then test
+	readonly && -eu readonly test
+	grep | echo export grep && grep 2>/dev/null | -eu /usr/bin
+		echo $(pwd) x=1 'quoted text' 2>/dev/null test
+	done export --verbose | --verbose done ${HOME} && -eu
+	${HOME} "$@" 2>/dev/null && ${HOME} test local readonly
+	/usr/bin x=1 then 2>/dev/null 'quoted text'
+		&& readonly && | "$@" x=1 done then readonly readonly "$1" export sed local readonly
+readonly -eu readonly sed 'quoted text' 2>/dev/null
+	sed readonly cd echo local $(pwd) grep cd grep echo x=1 grep sed | "$1"
+		awk && printf $(pwd) ${HOME} export 'quoted text' done $(pwd) "$@"
+	grep echo local --verbose /usr/bin 'quoted text' cd "$@" awk export
+then 2>/dev/null | -eu printf cd "$1" printf export readonly local readonly awk
+	awk awk --verbose | grep && ${HOME} | x=1 x=1 'quoted text' readonly
+echo test 2>/dev/null && "$@" then
+		"$@" test printf readonly echo | export cd 2>/dev/null then
+	readonly readonly 'quoted text' done export 2>/dev/null local --verbose
+		then readonly | "$1" 2>/dev/null
+		then "$@" then echo ${HOME} cd printf done readonly --verbose
+		awk --verbose readonly sed awk 2>/dev/null --verbose /usr/bin |
+"$@" test then $(pwd) "$@" -eu grep awk 2>/dev/null
+		then then --verbose local | echo x=1 "$@" done x=1 2>/dev/null
+	"$1" "$1" sed ${HOME} cd --verbose $(pwd) 'quoted text'
+sed --verbose "$@" sed grep $(pwd) test x=1 echo -eu grep export sed $(pwd)
+	${HOME} "$@" ${HOME} "$@" 'quoted text' cd cd -eu export then test local
+sed export local grep 'quoted text' x=1 done /usr/bin "$1" /usr/bin
+		test echo readonly "$1" echo grep echo sed local test test "$@"
+	"$1" readonly --verbose awk -eu ${HOME} "$@" done printf
+x=1 grep --verbose --verbose
+	"$1" cd /usr/bin cd readonly /usr/bin ${HOME} --verbose -eu
+done cd awk 'quoted text' && printf "$@" sed cd ${HOME} export
+	sed && $(pwd) sed test awk export cd ${HOME} /usr/bin /usr/bin done
+x=1 readonly 2>/dev/null export "$@" 'quoted text' 2>/dev/null $(pwd)
+		cd sed 'quoted text' export $(pwd) then
+	awk "$@" /usr/bin sed "$@" sed export echo | awk "$@" && local "$1" | && printf
+	/usr/bin printf echo "$@" grep ${HOME} --verbose
+	echo x=1 /usr/bin --verbose 2>/dev/null "$@" /usr/bin
+		grep -eu export 2>/dev/null /usr/bin local
+		'quoted text' "$1" $(pwd) echo printf done grep local
+| "$1" cd echo 2>/dev/null echo done printf readonly "$1" -eu then "$@" readonly
+		&& sed --verbose test grep 2>/dev/null ${HOME} 2>/dev/null
+${HOME} /usr/bin "$@" export done readonly 'quoted text'
+		"$1" $(pwd) $(pwd) readonly local "$1" test cd |
+	export grep --verbose sed x=1 cd echo ${HOME} readonly | 2>/dev/null printf
+	printf done -eu 2>/dev/null
+	| --verbose $(pwd) && cd echo export &&
+	export then 2>/dev/null readonly awk printf $(pwd) export --verbose
+awk awk ${HOME} then then printf && awk x=1 test echo
+		2>/dev/null -eu "$@" local readonly
+--verbose done 'quoted text' then done "$@" echo
+local local local -eu "$@" --verbose done local sed 'quoted text'
+		x=1 'quoted text' && | local awk $(pwd)
+		-eu $(pwd) printf sed 2>/dev/null x=1 echo cd x=1 'quoted text' &&
+--verbose local grep sed test cd --verbose
+		"$1" 'quoted text' local "$@" /usr/bin "$1"
+	sed cd "$@" awk local 2>/dev/null sed local test | export
+	export && export "$1" then local local 2>/dev/null 'quoted text'
+$(pwd) export -eu $(pwd) 'quoted text' printf $(pwd)
+		"$1" x=1 'quoted text' printf
+${HOME} ${HOME} cd /usr/bin done
+local printf $(pwd) | grep "$@" export && sed && done export "$1"
+		cd cd cd grep sed && export readonly ${HOME}
+		'quoted text' sed awk export cd "$1" $(pwd) /usr/bin test local "$@" ${HOME}
+"$1" $(pwd) then local grep printf echo --verbose readonly
+		awk sed echo ${HOME} printf sed
+	done | done 'quoted text' done 'quoted text' "$1" printf
+	| 'quoted text' grep done -eu /usr/bin && test -eu export -eu sed
+		"$@" "$1" -eu test grep readonly "$@" /usr/bin export
+		grep | awk local done 2>/dev/null "$1" $(pwd)
+	cd "$1" -eu awk done then -eu export
+	&& readonly echo echo | $(pwd)
+	&& 'quoted text' grep 'quoted text'
+	awk then $(pwd) && awk $(pwd) sed ${HOME}
+	test then | done | "$@" then "$@" then printf then --verbose
+		readonly x=1 awk "$1" $(pwd) "$@" done printf $(pwd) done grep && done
+	readonly "$1" 2>/dev/null | then export $(pwd) 'quoted text' ${HOME}
+		printf "$1" 2>/dev/null
+"$1" 2>/dev/null "$@" cd ${HOME} x=1 local ${HOME} done cd local | test "$@"
+echo 'quoted text' | -eu --verbose
+2>/dev/null done awk x=1 $(pwd) "$1" ${HOME}
+		${HOME} cd --verbose -eu 'quoted text'
+	${HOME} x=1 "$1" 'quoted text' $(pwd) local ${HOME}
+		"$1" then --verbose sed x=1 ${HOME} 'quoted text'
+		test x=1 /usr/bin | "$@" done test export then 'quoted text' 2>/dev/null
+done -eu 'quoted text' $(pwd) grep 'quoted text' --verbose -eu then export "$1"
+	done x=1 readonly cd ${HOME} printf echo printf done "$1"
+export awk /usr/bin test "$1" x=1 --verbose --verbose
+grep && | && /usr/bin local "$1" "$@" printf "$@"
+		--verbose local 2>/dev/null cd printf export echo "$@" echo sed
+	printf && local | && /usr/bin grep "$@" sed grep | echo -eu export ${HOME}
+test $(pwd) awk $(pwd) awk test $(pwd)
+printf $(pwd) /usr/bin export printf | awk
+	readonly grep export x=1 "$1"
+	x=1 $(pwd) "$@" && "$1" $(pwd) local local
+awk $(pwd) 2>/dev/null local 2>/dev/null
+-eu grep sed /usr/bin && "$1" echo then export
+		$(pwd) export ${HOME} -eu 2>/dev/null
+	printf grep export 'quoted text' x=1
+		done --verbose $(pwd) /usr/bin echo cd local "$@" then $(pwd) awk test
+	then test readonly $(pwd) "$1" sed
+		done | local 'quoted text' local done && printf
+		--verbose readonly --verbose 'quoted text' test echo /usr/bin
+	${HOME} printf test printf done /usr/bin x=1 grep done echo export --verbose test
+		grep export 2>/dev/null 2>/dev/null echo awk awk -eu then 2>/dev/null 'quoted text'
+		/usr/bin cd echo --verbose cd test
+awk then awk then | test $(pwd) $(pwd) grep
+	${HOME} sed "$1" printf ${HOME} echo 2>/dev/null local 2>/dev/null 'quoted text'
+'quoted text' "$1" "$@" printf local
+		"$@" /usr/bin local sed local
+	--verbose echo grep --verbose /usr/bin grep ${HOME}
+		test readonly 2>/dev/null cd /usr/bin echo $(pwd) then
+	readonly printf sed done -eu -eu cd readonly "$1" then "$1" /usr/bin
+		${HOME} | 'quoted text' "$1" cd 'quoted text'
+		readonly test -eu printf
+'quoted text' -eu sed then $(pwd) awk /usr/bin
+		echo | /usr/bin "$@" then
+	/usr/bin 2>/dev/null echo && test && "$@" $(pwd) sed echo ${HOME} /usr/bin
+printf awk awk ${HOME} printf cd | done printf
+		grep export --verbose cd export readonly test -eu grep
+		printf "$@" 'quoted text' printf grep 'quoted text'
+	cd ${HOME} "$1" grep cd "$1" echo sed echo 2>/dev/null /usr/bin done $(pwd) grep
+		-eu "$1" printf /usr/bin /usr/bin && && "$1" awk /usr/bin awk done
+		x=1 /usr/bin sed cd cd "$1" "$@" readonly
+	echo "$1" && "$1" awk -eu readonly readonly &&
+	awk $(pwd) local readonly --verbose readonly readonly ${HOME} -eu
+test | "$1" awk sed sed test awk local done readonly 2>/dev/null "$1" |
+'quoted text' then readonly 'quoted text' echo export test && "$1" readonly
+	done 2>/dev/null 'quoted text'
+	/usr/bin ${HOME} done awk cd printf && && --verbose awk printf 2>/dev/null sed
+	--verbose cd "$@" --verbose --verbose "$@" ${HOME} x=1 ${HOME} echo then
+		sed "$1" sed /usr/bin | cd echo sed x=1 local local readonly /usr/bin ${HOME}
+		--verbose 2>/dev/null 'quoted text' && cd then $(pwd) /usr/bin -eu && echo export
+--verbose printf printf --verbose sed readonly ${HOME} cd /usr/bin
+"$1" test x=1 grep printf ${HOME} && printf export | grep
+		grep $(pwd) test "$@" awk echo printf local ${HOME} echo awk sed echo
+	${HOME} then 'quoted text' export /usr/bin
+	--verbose | && && 'quoted text' $(pwd)
+		printf --verbose done printf
+		'quoted text' cd then grep cd -eu 'quoted text' "$@"
+		${HOME} --verbose "$1" "$@" /usr/bin x=1 2>/dev/null | grep grep sed export
+${HOME} grep && $(pwd) then then --verbose
+		| then "$1" 'quoted text' $(pwd) -eu ${HOME} echo cd
+		then printf -eu echo "$1" | x=1 /usr/bin "$@" -eu grep local sed sed $(pwd) then
+	2>/dev/null echo -eu export printf echo x=1 ${HOME} 2>/dev/null "$@" x=1 | x=1
+		"$1" grep 'quoted text' local "$1" && then | 'quoted text' then readonly
+	--verbose awk local test --verbose cd echo | local readonly /usr/bin grep x=1
+		grep "$1" $(pwd) grep printf $(pwd) && grep 2>/dev/null export 'quoted text'
+2>/dev/null 'quoted text' ${HOME} && then $(pwd) then done echo
+test 2>/dev/null awk && | $(pwd) local x=1
+&& 'quoted text' awk x=1 "$1"
+		$(pwd) test x=1 awk -eu grep grep -eu test "$@" --verbose
+	"$1" /usr/bin /usr/bin $(pwd)
+	'quoted text' test "$@" 2>/dev/null
+		"$1" readonly 'quoted text'
+	awk x=1 grep local readonly readonly ${HOME}
+export cd $(pwd) --verbose 2>/dev/null -eu then && done export grep
+done --verbose "$@" awk x=1 cd export export grep --verbose /usr/bin "$@"
+		cd export "$1" awk | -eu printf 2>/dev/null done test 'quoted text'
+	local | /usr/bin cd x=1 'quoted text'
+	x=1 readonly 2>/dev/null local &&
+	"$@" $(pwd) echo ${HOME} readonly -eu && /usr/bin -eu -eu
+/usr/bin 'quoted text' 2>/dev/null awk awk done
+		--verbose readonly 2>/dev/null
+--verbose grep cd echo local cd $(pwd)
+2>/dev/null sed x=1 printf 2>/dev/null "$1" grep
+	'quoted text' 'quoted text' cd $(pwd) "$@" cd x=1 echo ${HOME}
+		then awk test export && 2>/dev/null "$@" cd local --verbose
+	cd && $(pwd) awk cd test "$@" grep cd 'quoted text' done echo "$1"
+test | export 2>/dev/null cd --verbose sed then printf ${HOME} 2>/dev/null "$1"
+		export export readonly 'quoted text'
+		| test 'quoted text' test readonly $(pwd) /usr/bin && test then 'quoted text'
+--verbose ${HOME} | /usr/bin | ${HOME} --verbose
+		export $(pwd) cd test 'quoted text' done /usr/bin printf
+	echo then | sed sed grep export -eu awk awk | readonly ${HOME} local
+	${HOME} then /usr/bin test sed then readonly "$@" awk 'quoted text' readonly
+echo export "$@" "$@" export x=1 test /usr/bin 2>/dev/null echo echo "$@"
+		&& $(pwd) --verbose | && 2>/dev/null /usr/bin && local
+${HOME} && /usr/bin 'quoted text' done --verbose printf && 'quoted text'
+		local "$@" sed 'quoted text' cd cd awk
+/usr/bin export local sed done
+grep x=1 | then done cd --verbose awk printf awk echo "$@" $(pwd)
+	"$1" cd 'quoted text' test local echo local readonly
+printf done awk cd /usr/bin export sed printf -eu cd x=1 x=1 'quoted text'
+		$(pwd) done grep readonly grep export then 2>/dev/null test -eu x=1 -eu
+x=1 ${HOME} "$1" cd "$@" cd
+printf /usr/bin $(pwd) cd "$@" sed $(pwd) /usr/bin export
+	/usr/bin | | 'quoted text' readonly --verbose
+	"$@" local then export 'quoted text' then done then done
+"$@" cd done done done ${HOME} x=1 cd
+		| echo 2>/dev/null test 2>/dev/null 'quoted text' /usr/bin $(pwd) $(pwd) | test
+	x=1 "$@" 'quoted text' ${HOME} sed printf awk
+	"$@" test grep 'quoted text' $(pwd) awk export --verbose sed --verbose
+	"$@" x=1 done $(pwd) then grep sed "$@" | sed x=1
+done x=1 $(pwd) test done && local local
+test 2>/dev/null awk test ${HOME} test x=1
+${HOME} test "$1" "$1" "$@" then 2>/dev/null
+	--verbose sed "$@" grep $(pwd) echo sed
+		/usr/bin echo awk then ${HOME} 2>/dev/null readonly export
+		local readonly x=1 then readonly awk 2>/dev/null printf $(pwd)
+/usr/bin /usr/bin | "$1" 2>/dev/null printf
+'quoted text' | "$@" then $(pwd) ${HOME} cd readonly
+	cd | -eu test ${HOME} 'quoted text' -eu sed test done 'quoted text'
+		&& then | then echo | export sed awk x=1 && local export -eu echo "$1"
+		--verbose "$1" printf then ${HOME} test export
+		--verbose "$1" done x=1 awk | /usr/bin
+echo 'quoted text' "$@" cd /usr/bin "$@"
+| awk sed awk awk then /usr/bin "$1" -eu awk $(pwd)
+	&& export ${HOME} test sed test x=1 local cd echo readonly grep grep sed awk
+		x=1 test test "$1" $(pwd)
+	${HOME} ${HOME} 'quoted text' 'quoted text' done done echo
+		echo 2>/dev/null local sed /usr/bin "$1" -eu 'quoted text'
+"$1" awk done "$1" --verbose printf readonly
+	-eu printf awk --verbose grep printf
+	${HOME} 'quoted text' | sed $(pwd) "$@" ${HOME} /usr/bin cd
+&& sed 'quoted text' && sed -eu echo export
+awk x=1 local readonly local "$1"
+grep $(pwd) grep ${HOME} sed export "$1" ${HOME} done grep
+2>/dev/null /usr/bin grep cd 'quoted text'
+	printf $(pwd) "$@" $(pwd) 'quoted text' $(pwd) awk echo readonly
+		--verbose printf x=1 then echo readonly /usr/bin echo /usr/bin -eu grep
+	"$1" then $(pwd) echo $(pwd) 2>/dev/null 'quoted text' 2>/dev/null
+	local | "$@" "$1" then x=1 2>/dev/null local echo export
+	grep printf export done done sed test grep export
+	sed export readonly grep "$1" test
+	echo --verbose done cd | test echo && done x=1 grep echo local
+	done then --verbose "$1" -eu
+		$(pwd) done awk export cd awk local echo then --verbose x=1 -eu --verbose
+		-eu readonly "$1" --verbose
+		cd cd then $(pwd) cd test sed awk --verbose -eu ${HOME} test
+	"$@" then cd && 2>/dev/null
+printf -eu export grep | ${HOME} printf 'quoted text'
+	${HOME} | readonly awk echo sed
+	-eu ${HOME} -eu cd --verbose
+	then readonly sed /usr/bin x=1 --verbose
+		echo sed 'quoted text' ${HOME} ${HOME} printf then cd grep x=1 /usr/bin printf
+local --verbose 'quoted text' | && x=1
+	export $(pwd) local awk "$@" && then x=1 echo "$@" cd 2>/dev/null
+	cd "$@" test test x=1 "$1" -eu && "$1" then done | "$1"
+	&& export done sed -eu test "$1" && "$1" "$1" awk && export
+/usr/bin sed awk /usr/bin local export
+	readonly sed && readonly
+	| && && grep grep x=1 then $(pwd) ${HOME} -eu awk $(pwd) export
+sed cd awk ${HOME} --verbose test
+	readonly x=1 "$@" "$@" $(pwd)
+		export cd -eu sed awk cd ${HOME} --verbose
+		readonly test readonly test --verbose awk done done test done then "$@" --verbose
+		'quoted text' test && $(pwd) grep readonly
+	${HOME} /usr/bin && test grep 'quoted text'
+local --verbose "$@" "$@" cd "$1" -eu export test "$1" printf echo
+&& 2>/dev/null ${HOME} 2>/dev/null echo "$1" && sed | grep readonly ${HOME}
+"$@" sed sed --verbose 2>/dev/null readonly "$@" test --verbose
+		then && -eu $(pwd) 'quoted text' | cd -eu awk
+/usr/bin test "$1" "$@" 'quoted text' --verbose test done
+		local export /usr/bin
+	x=1 grep local "$@" -eu test printf grep sed "$1" -eu ${HOME} "$@" cd export 2>/dev/null
+		--verbose /usr/bin "$@" /usr/bin 'quoted text'
+		$(pwd) grep done && sed then x=1 export
+	export /usr/bin then awk printf $(pwd) && awk grep local $(pwd)
+$(pwd) $(pwd) "$@" -eu done /usr/bin "$1" && && 2>/dev/null "$1" printf
+	done sed 2>/dev/null export -eu -eu "$@" -eu x=1 2>/dev/null grep
+	grep sed awk 'quoted text' --verbose export x=1 echo ${HOME}
+		| then test then 2>/dev/null cd readonly
+	$(pwd) test "$@" ${HOME} 2>/dev/null readonly
+	"$@" ${HOME} echo "$@" x=1 $(pwd) printf done printf readonly grep && "$1"
+		--verbose 2>/dev/null "$@" then | grep test 2>/dev/null readonly "$@" -eu "$1"
+${HOME} --verbose printf && --verbose -eu export
+	"$@" -eu 2>/dev/null /usr/bin local 2>/dev/null
+	-eu $(pwd) --verbose export grep "$1" grep export
+${HOME} grep cd sed | "$1" -eu ${HOME}
+	x=1 test grep "$1" && "$@" -eu
+	--verbose ${HOME} "$1" $(pwd) test 'quoted text' test export test --verbose
+	echo 2>/dev/null | "$1" grep
+--verbose ${HOME} 'quoted text' grep cd $(pwd) 'quoted text' /usr/bin
+		| x=1 x=1 export readonly "$1" test -eu awk test ${HOME} sed then done
+	x=1 then 2>/dev/null local awk | $(pwd) 2>/dev/null then echo /usr/bin
+		printf | | 2>/dev/null "$@"
+	${HOME} echo printf x=1 "$@" done "$@" then
+	&& ${HOME} "$@" grep readonly local
+	-eu printf printf cd done grep cd "$@" "$@" ${HOME}
+	/usr/bin awk sed readonly then awk local "$@"
+		then printf printf --verbose done
+	&& sed echo awk "$1" /usr/bin export /usr/bin 'quoted text' | -eu 2>/dev/null
+		local 'quoted text' sed --verbose
+	export then | awk && $(pwd) export
+	test "$@" echo grep /usr/bin then && cd && done readonly done $(pwd) test
+	$(pwd) -eu then --verbose sed grep ${HOME} x=1 done export
+		export && "$1" local export echo
+		$(pwd) readonly $(pwd) sed $(pwd) && /usr/bin readonly -eu sed
+	$(pwd) ${HOME} $(pwd) | | | printf ${HOME} 2>/dev/null printf
+	| awk && cd sed | x=1 /usr/bin sed "$1" grep
+	&& printf printf readonly x=1 awk awk 2>/dev/null
+2>/dev/null awk done x=1 printf grep "$@" done "$1" done "$@"
+echo 'quoted text' readonly "$@" export sed done "$@" grep -eu
+		/usr/bin "$@" export ${HOME} printf "$1" readonly export
+	-eu -eu && --verbose sed | $(pwd) "$1" "$1" 'quoted text'
+	/usr/bin -eu "$1" $(pwd) readonly -eu awk | test /usr/bin cd printf
+grep "$1" local 2>/dev/null done -eu ${HOME} grep 'quoted text' echo
+		sed x=1 x=1 cd /usr/bin local then 2>/dev/null test --verbose
+		grep ${HOME} readonly 2>/dev/null
+		grep "$1" --verbose readonly "$1" export && grep
+| sed --verbose | then then "$1" --verbose readonly test then grep && 'quoted text'
+$(pwd) local "$@" test --verbose done --verbose
+test 'quoted text' --verbose grep
+--verbose /usr/bin done
+--verbose | x=1 x=1 then /usr/bin printf awk local done
+	2>/dev/null && local grep test echo x=1 sed
+then sed x=1 /usr/bin 2>/dev/null done "$1" sed "$1" ${HOME}
+	echo "$@" ${HOME} x=1 then x=1 "$1" $(pwd)
+&& $(pwd) ${HOME} sed x=1
+| --verbose /usr/bin echo printf $(pwd)
+		| printf && ${HOME} | 2>/dev/null local grep then 'quoted text'
+	done 2>/dev/null export readonly "$1" x=1 test cd /usr/bin echo | done test
+		"$@" $(pwd) local awk readonly /usr/bin done sed awk done
+	2>/dev/null test && $(pwd) && grep readonly x=1 "$1" $(pwd) cd &&
+	$(pwd) done test then
+	"$@" "$@" printf printf cd 2>/dev/null ${HOME} "$1"
+	x=1 echo ${HOME} grep local
+sed | then done done then local /usr/bin echo printf x=1 'quoted text' "$@"
+		then sed ${HOME} test done --verbose sed | --verbose
+local printf local test printf "$@"
+	echo 'quoted text' grep x=1 awk cd 2>/dev/null | awk | "$1" -eu
+grep awk --verbose && ${HOME} printf x=1 /usr/bin grep
+		printf $(pwd) x=1 awk 2>/dev/null 2>/dev/null
+echo then -eu awk echo --verbose
+		$(pwd) 2>/dev/null done x=1 $(pwd) grep sed export
+		-eu -eu local && 'quoted text' echo "$@" "$1" 'quoted text' "$@"
+	sed grep grep test export done 2>/dev/null 2>/dev/null -eu grep test x=1 local local
+echo done ${HOME} export then sed then 'quoted text' test
+local 'quoted text' 'quoted text'
+		"$1" then readonly -eu test grep grep /usr/bin -eu
+		"$1" awk --verbose | x=1 2>/dev/null
+		2>/dev/null -eu "$@" ${HOME} local grep
+	grep ${HOME} grep printf cd then readonly
+cd local then "$@" x=1 test /usr/bin | 2>/dev/null readonly -eu |
+		${HOME} local echo "$@" && "$1" then readonly echo cd | done test
+then && readonly /usr/bin
+| $(pwd) | 2>/dev/null && readonly "$1" 'quoted text'
+		| echo export local x=1 readonly
+	then cd 2>/dev/null awk "$@" done
+	$(pwd) export "$@" | test /usr/bin "$@" ${HOME} test grep
+--verbose | awk && "$@" local | echo local grep grep grep x=1 $(pwd) x=1
+$(pwd) then | local printf "$1" then
+		done x=1 sed cd /usr/bin | 'quoted text' sed "$1" && local -eu "$1"
+	/usr/bin printf echo awk sed readonly export done
+		${HOME} printf | "$@" 2>/dev/null sed "$@" grep done "$1" cd export grep
+	cd local local -eu local awk readonly awk
+		printf 'quoted text' done 2>/dev/null /usr/bin | ${HOME} "$1" printf
+	&& $(pwd) ${HOME} | 2>/dev/null export /usr/bin readonly test echo
+	export "$@" 'quoted text' $(pwd) readonly awk 'quoted text' ${HOME}
+	2>/dev/null grep then $(pwd) x=1 "$1" 2>/dev/null
+	"$1" readonly sed grep
+		then local && 2>/dev/null "$@" local "$@" sed && then "$1" done readonly
+export 'quoted text' printf echo $(pwd) 2>/dev/null -eu sed grep printf cd
+	"$@" && -eu test /usr/bin awk printf readonly then readonly readonly x=1 readonly
+		$(pwd) && -eu | sed -eu printf then awk 2>/dev/null x=1 then x=1 export
+cd $(pwd) x=1 'quoted text'
+	--verbose then then ${HOME} ${HOME} 'quoted text' cd sed echo && awk 'quoted text'
+		printf --verbose 2>/dev/null grep /usr/bin local | /usr/bin sed |
+		-eu local grep readonly | cd awk readonly 2>/dev/null
+	printf && test then export done printf 2>/dev/null cd && then --verbose
+		awk | 'quoted text' awk grep grep done test "$@" $(pwd) awk done ${HOME} 'quoted text'
+	grep /usr/bin local /usr/bin then then | "$@" grep /usr/bin awk /usr/bin
+		/usr/bin 'quoted text' && echo
+		sed 2>/dev/null ${HOME} echo /usr/bin readonly "$@" && cd
+x=1 $(pwd) "$1" -eu echo
+		"$@" /usr/bin cd /usr/bin --verbose "$@" done /usr/bin cd printf grep
+	sed cd 2>/dev/null done done ${HOME} --verbose
+		2>/dev/null then echo "$1" --verbose cd printf grep local -eu readonly readonly
+local sed -eu 2>/dev/null done readonly then then done awk
+	printf test && printf -eu
+	then local --verbose /usr/bin "$1" /usr/bin $(pwd) | 2>/dev/null readonly && |
+	export $(pwd) $(pwd) "$1"
+		${HOME} done x=1 "$1" && sed awk test && "$@" "$1"
+${HOME} done x=1 test grep grep | done export "$@" grep "$1" local /usr/bin readonly
+grep readonly 'quoted text'
+		2>/dev/null then && cd then grep && echo "$1" && 2>/dev/null
+	export awk echo test readonly export readonly && printf echo --verbose
+	"$@" test && done export && && export
+		then test test done $(pwd) x=1 ${HOME}
+		grep export -eu $(pwd) echo 2>/dev/null
+	x=1 /usr/bin -eu /usr/bin done ${HOME}
+		test -eu "$1" "$@" local then
+readonly cd local grep echo cd awk echo local | grep readonly
+		sed --verbose awk | grep cd sed && cd done cd
+		then "$@" done test 2>/dev/null
+$(pwd) | 'quoted text' grep 'quoted text' "$@" awk /usr/bin
+sed printf | readonly grep cd -eu then done test then then test test export
+		| 'quoted text' awk 'quoted text'
+		export test 'quoted text' | echo /usr/bin ${HOME}
+		x=1 echo done readonly | echo
+	2>/dev/null echo test readonly
+		echo export && ${HOME} cd -eu echo x=1 readonly 'quoted text'
+&& awk then $(pwd) && 2>/dev/null
+	--verbose local cd x=1 readonly grep
+$(pwd) | && local "$1" done test export --verbose x=1 test awk local export
+	printf sed $(pwd) echo x=1 done cd --verbose cd ${HOME} --verbose
+		${HOME} "$@" "$@" "$1"
+		x=1 --verbose then sed 'quoted text' && |
+	cd echo printf echo cd "$1" export printf && -eu cd awk grep local test "$@" awk
+	${HOME} "$1" 'quoted text' -eu 2>/dev/null 'quoted text' awk 'quoted text'
+readonly /usr/bin "$1"
+export then -eu 'quoted text' export ${HOME} then ${HOME} /usr/bin ${HOME}
+	'quoted text' then printf echo then then done awk && done readonly
+local awk ${HOME} 2>/dev/null
+	x=1 cd echo | $(pwd) done readonly grep readonly
+	"$1" sed test /usr/bin grep local -eu
+echo 2>/dev/null "$@" grep readonly && awk x=1 "$1" --verbose
+	then $(pwd) sed $(pwd) echo $(pwd) readonly "$1" then x=1 test /usr/bin readonly
+cd -eu && echo "$1" export grep "$@" sed echo cd done then | |
+then 'quoted text' sed
+		local cd $(pwd) 'quoted text' | 2>/dev/null
+then ${HOME} export awk ${HOME} -eu -eu export && done $(pwd)
+	2>/dev/null && awk /usr/bin printf
+cd 2>/dev/null -eu && readonly --verbose test done -eu | && printf
+sed done sed 'quoted text' "$@" done 'quoted text' /usr/bin /usr/bin "$@" /usr/bin
+&& then grep "$1" | -eu ${HOME} awk x=1 $(pwd) sed sed && echo | "$1" done
+"$1" && export readonly awk readonly
+--verbose local 'quoted text' done printf local then done |
+	x=1 readonly 2>/dev/null --verbose
+$(pwd) x=1 'quoted text' x=1 printf
+		&& then test | "$@" sed "$1"
+		--verbose 'quoted text' echo -eu 2>/dev/null
+	x=1 awk --verbose test local done x=1 awk 2>/dev/null ${HOME} && 'quoted text'
+		printf /usr/bin cd local "$1" grep "$1" export
+	--verbose 'quoted text' 2>/dev/null /usr/bin
+readonly done then done x=1 x=1 sed test /usr/bin echo local "$1" --verbose
+		${HOME} printf 'quoted text' ${HOME} local 'quoted text' printf
+done --verbose cd "$@" 2>/dev/null test sed /usr/bin
+	done awk $(pwd) x=1 local 'quoted text' 2>/dev/null
+	"$1" cd readonly x=1 readonly
+		local printf cd "$@" 2>/dev/null
+		cd 'quoted text' x=1 x=1 /usr/bin cd test grep
+"$1" -eu awk cd sed cd test /usr/bin cd grep local "$@" x=1 2>/dev/null ${HOME}
+'quoted text' printf awk printf printf && echo export $(pwd) echo "$1" "$@"
+		echo "$1" grep export done printf sed && echo cd sed sed export 'quoted text'
+		/usr/bin grep --verbose grep 'quoted text' 'quoted text' -eu 2>/dev/null
+	x=1 sed export | -eu grep export ${HOME} 2>/dev/null | awk printf x=1
+echo cd cd /usr/bin awk done export
+awk && echo local 2>/dev/null
+	sed ${HOME} ${HOME} cd | ${HOME} readonly sed "$1"
+"$@" "$@" grep awk "$@" 'quoted text' then local && | ${HOME} -eu
+	then grep -eu readonly cd readonly --verbose
+	readonly "$@" awk 'quoted text' && /usr/bin "$1" -eu test done /usr/bin
+		'quoted text' grep export
+		2>/dev/null && /usr/bin export
+		--verbose "$1" 'quoted text' | x=1 local grep sed -eu "$@" /usr/bin
+&& 'quoted text' export &&
+		done "$1" ${HOME} | echo printf --verbose
+&& local "$1" sed done ${HOME} "$@" | "$1" readonly 2>/dev/null ${HOME} sed
+		--verbose "$1" readonly -eu
+"$1" /usr/bin ${HOME} grep grep readonly then readonly export printf
+awk $(pwd) 'quoted text' --verbose && test local done 'quoted text'
+2>/dev/null 2>/dev/null /usr/bin
+${HOME} && local "$@"
+		test sed cd --verbose cd
+	echo "$@" --verbose printf "$1" -eu grep | then | $(pwd)
+${HOME} 2>/dev/null "$@" local sed grep readonly done printf 'quoted text'
+	--verbose cd 2>/dev/null test readonly --verbose
+		cd 2>/dev/null /usr/bin printf readonly --verbose
+&& awk awk /usr/bin test cd then 2>/dev/null sed awk 2>/dev/null then && test
+	readonly 'quoted text' test $(pwd) $(pwd) ${HOME} $(pwd) | "$@"
+done && && "$1" -eu then
+		-eu done echo -eu 'quoted text' "$@" 'quoted text'
+sed sed -eu -eu /usr/bin
+	x=1 "$1" local echo local done grep "$1" sed 'quoted text'
+echo 'quoted text' "$1" 2>/dev/null --verbose readonly sed echo export
+		echo 'quoted text' export test echo ${HOME} sed $(pwd)
+		export cd && 'quoted text'
+		grep readonly && 'quoted text' $(pwd) test /usr/bin readonly
+	${HOME} sed then | readonly export | "$@" -eu && $(pwd) $(pwd) $(pwd)
+		2>/dev/null -eu "$@" -eu test 'quoted text' local sed
+		then --verbose /usr/bin /usr/bin "$1" cd echo awk printf x=1
+	${HOME} grep x=1 'quoted text' "$1" echo --verbose --verbose 'quoted text' | done
+awk $(pwd) export && x=1 awk awk local sed -eu
+/usr/bin awk grep cd then "$@" && --verbose 2>/dev/null
+sed && readonly printf local echo -eu grep "$@" local "$1" 2>/dev/null
+		${HOME} export /usr/bin --verbose
+	&& -eu done "$1" $(pwd) | "$@" test 'quoted text' local -eu
+awk ${HOME} printf && 2>/dev/null
+	echo | done grep awk sed ${HOME} local | "$1" --verbose cd echo
+| 2>/dev/null 'quoted text' 'quoted text' awk 'quoted text'
+		echo local ${HOME} 2>/dev/null echo grep cd done test "$@" then cd cd $(pwd) 'quoted text'
+		x=1 && done ${HOME} 2>/dev/null | awk x=1 awk -eu
+		done 2>/dev/null ${HOME}
+$(pwd) --verbose printf awk $(pwd) export -eu
+	| export grep awk 2>/dev/null --verbose | -eu grep 2>/dev/null done local
+	grep "$@" | grep echo awk local local grep "$@" sed x=1 ${HOME} done && awk --verbose
+		printf awk echo "$@" "$@" test && readonly 'quoted text'
+	done && /usr/bin -eu && |
+		&& local 'quoted text' awk | 2>/dev/null cd x=1 readonly
+test -eu then local done --verbose echo grep awk "$1" grep sed /usr/bin
+		2>/dev/null && x=1 echo export readonly | x=1 local printf printf then
+export x=1 -eu "$1" && readonly readonly
+		printf then local grep
+	/usr/bin $(pwd) readonly
+	--verbose done cd 'quoted text' && -eu printf then test 2>/dev/null
+		awk --verbose done sed export && printf
+	2>/dev/null readonly 2>/dev/null
+		"$1" "$@" ${HOME} "$1" export && test 'quoted text' cd ${HOME}
+	--verbose --verbose echo
+		test 2>/dev/null -eu grep done && readonly 2>/dev/null grep ${HOME} done done
+	printf cd 2>/dev/null awk test done 2>/dev/null grep $(pwd)
+	&& "$@" -eu done ${HOME} local x=1 local readonly 'quoted text' readonly grep
+$(pwd) "$@" export $(pwd)
+x=1 && -eu && grep x=1 2>/dev/null printf x=1 | &&
+	2>/dev/null done local "$@" test done test grep 2>/dev/null sed
+	$(pwd) -eu /usr/bin | ${HOME} 'quoted text' ${HOME} -eu -eu -eu
+"$@" --verbose printf awk sed cd x=1 -eu 'quoted text'
+	| grep ${HOME} awk grep printf
+	${HOME} 2>/dev/null local done "$@" then | "$1"
+	"$@" readonly grep local -eu echo cd "$@" -eu x=1 x=1 x=1 sed | $(pwd)
+	test readonly readonly local echo local echo 'quoted text' --verbose readonly
+		| | readonly local grep cd --verbose readonly cd printf sed /usr/bin
+		&& export /usr/bin "$1" 'quoted text'
+&& local grep $(pwd) "$@" x=1 test && x=1 export "$@"
+		"$@" 'quoted text' readonly done done printf && ${HOME} "$@" sed "$@" --verbose
+		x=1 test done 2>/dev/null grep done awk test printf /usr/bin grep done then -eu
+		echo cd -eu readonly | 2>/dev/null sed done test 'quoted text' --verbose
+	export && x=1 sed 'quoted text' 2>/dev/null x=1 --verbose 2>/dev/null printf
+sed $(pwd) cd sed readonly grep local -eu awk sed
+		printf export echo --verbose test | && && &&
+	test 'quoted text' export grep "$1" --verbose sed readonly
+	export 'quoted text' -eu -eu "$@" export "$1" readonly x=1 && x=1 echo $(pwd) export
+"$1" awk printf /usr/bin | awk -eu readonly
+		printf test then export /usr/bin 'quoted text' && $(pwd) | cd
+	test printf then 'quoted text' $(pwd) printf
+'quoted text' echo then printf local
+echo x=1 2>/dev/null readonly
+	export printf && x=1 "$@" printf x=1 | | export
+		&& x=1 "$@" echo done awk "$1" echo export test echo echo export
+	| 'quoted text' $(pwd) done | export && ${HOME} awk then echo echo | awk
+${HOME} /usr/bin x=1 --verbose readonly then && cd x=1 && test then test
+		2>/dev/null /usr/bin ${HOME} ${HOME}
+		2>/dev/null 2>/dev/null /usr/bin "$1" ${HOME} sed "$@" test export "$@"
+-eu "$1" | sed | $(pwd) export test 2>/dev/null "$1" "$@" $(pwd) "$@" --verbose
+	2>/dev/null "$@" && local | -eu done 2>/dev/null | "$@" /usr/bin
+		--verbose | $(pwd) | test /usr/bin
+echo 'quoted text' grep && /usr/bin | local | x=1 $(pwd) test test awk cd -eu "$@"
+		| then awk awk --verbose
+	'quoted text' cd done "$1" printf echo "$@"
+		done 2>/dev/null /usr/bin awk echo "$1" 2>/dev/null
+		awk && $(pwd) /usr/bin cd --verbose
+		then awk && awk export grep test 2>/dev/null && "$@" $(pwd) printf $(pwd)
+"$1" /usr/bin ${HOME} export 'quoted text' $(pwd) | $(pwd) "$1" ${HOME} $(pwd)
+	done ${HOME} x=1 local cd /usr/bin x=1 sed && then x=1 done local
+		| grep | awk ${HOME} readonly
+		local && readonly grep printf
+		test sed x=1 | export grep local $(pwd) local "$1" -eu test done then -eu
+		'quoted text' cd grep x=1 local export -eu grep -eu /usr/bin
+		x=1 $(pwd) readonly /usr/bin && cd sed test "$1" echo then test
+	awk $(pwd) ${HOME} 2>/dev/null -eu && "$1"
+	grep readonly awk export
+then && "$1" $(pwd) test
+		grep "$@" printf done done
+	printf readonly grep x=1 2>/dev/null ${HOME} echo 'quoted text'
+readonly --verbose test --verbose readonly
+		"$1" then readonly | sed ${HOME} ${HOME} "$1" echo /usr/bin cd grep sed "$@"
+		2>/dev/null && && x=1 |
+done cd test cd then printf export
+		--verbose printf "$@" cd grep && done then /usr/bin 'quoted text'
+	--verbose 2>/dev/null /usr/bin $(pwd) readonly x=1
+		awk awk local 2>/dev/null --verbose readonly
+${HOME} | 'quoted text' grep awk | test echo grep
+	readonly --verbose 2>/dev/null printf --verbose --verbose
+"$@" $(pwd) done --verbose export | && cd
+		printf 'quoted text' done echo done "$@" awk 'quoted text' export done "$@" test
+'quoted text' sed "$@" done test cd printf sed test
+	/usr/bin x=1 --verbose -eu $(pwd) | test | x=1
+		readonly awk ${HOME} local awk
+	sed "$@" local printf sed echo ${HOME} 'quoted text' --verbose test grep /usr/bin
+		echo printf -eu then ${HOME} test "$@" then local grep --verbose echo --verbose
+	${HOME} "$@" x=1 sed sed "$1" printf $(pwd) echo /usr/bin
+x=1 /usr/bin printf awk sed cd |
+	"$1" sed cd readonly 2>/dev/null
+test readonly 2>/dev/null &&
+	then && -eu awk /usr/bin done export "$1" --verbose grep --verbose
+	x=1 readonly test | | ${HOME}
+		test /usr/bin -eu export --verbose sed cd echo 'quoted text' local -eu
+'quoted text' local --verbose 'quoted text' /usr/bin then sed
+		done 'quoted text' x=1 "$1" ${HOME} awk
+then 2>/dev/null "$1" "$@" x=1 /usr/bin $(pwd) cd && printf export export
+		$(pwd) printf awk echo 'quoted text' test done
+		printf "$@" 'quoted text' test && printf
+	2>/dev/null x=1 --verbose echo -eu export $(pwd) x=1
+		echo export 2>/dev/null --verbose echo local export readonly
+	awk $(pwd) && then "$1"
+sed export test echo x=1 readonly && --verbose && awk 'quoted text'
+	/usr/bin export | "$1" test then printf | 2>/dev/null echo "$1" printf
+	&& grep -eu | | | export
+		sed printf 'quoted text' readonly echo
+		/usr/bin --verbose awk -eu 2>/dev/null $(pwd) --verbose
+	$(pwd) readonly "$@" export readonly awk export $(pwd) ${HOME}
+	grep --verbose sed /usr/bin ${HOME} awk
+		'quoted text' cd then sed local done 2>/dev/null ${HOME} $(pwd)
+		done /usr/bin | awk cd x=1 ${HOME} $(pwd) "$@" -eu done printf | 2>/dev/null
+		/usr/bin | printf cd test | 'quoted text' sed test "$@" grep "$1" cd grep
+		sed "$@" x=1 2>/dev/null grep export && done | done export 2>/dev/null /usr/bin
+		printf local ${HOME} cd grep /usr/bin
+'quoted text' $(pwd) cd 2>/dev/null -eu 2>/dev/null /usr/bin 2>/dev/null -eu
+		export /usr/bin -eu | then printf x=1 ${HOME} /usr/bin grep readonly x=1 /usr/bin
+	sed local 2>/dev/null --verbose test grep 'quoted text'
+		printf "$1" "$@" readonly done sed
+	cd "$@" 2>/dev/null local $(pwd) 2>/dev/null "$1" grep printf
+		done $(pwd) awk echo "$1" 2>/dev/null ${HOME} grep ${HOME}
+	$(pwd) awk test cd --verbose
+		${HOME} "$@" cd | printf && then readonly
+		export ${HOME} /usr/bin "$1" done readonly
+cd 'quoted text' 'quoted text'
+${HOME} "$1" done sed x=1 | done && $(pwd) --verbose echo $(pwd)
+		"$1" ${HOME} 'quoted text' cd sed done readonly ${HOME} | /usr/bin cd test local
+	readonly local echo /usr/bin --verbose
+	/usr/bin "$1" echo 'quoted text' "$@"
+		awk 2>/dev/null --verbose -eu readonly cd cd "$@" export 'quoted text' --verbose
+	echo "$@" x=1 test export ${HOME} -eu 2>/dev/null
+		cd sed 2>/dev/null then "$@" && done | ${HOME} awk grep export --verbose cd &&
+		export then export && "$1" "$1" test then printf echo 'quoted text' --verbose &&
+		${HOME} awk printf done awk then $(pwd)
+		x=1 $(pwd) -eu ${HOME} $(pwd) -eu awk
+	/usr/bin $(pwd) test grep "$@" awk done done /usr/bin /usr/bin then /usr/bin
+	then done readonly "$1" grep | ${HOME} &&
+'quoted text' && export grep
+$(pwd) then && $(pwd) | "$1"
+	x=1 x=1 done -eu | --verbose 'quoted text' readonly /usr/bin
+	"$1" grep /usr/bin ${HOME} 'quoted text'
+	$(pwd) test cd then export && printf test sed grep | cd "$1" 2>/dev/null
+		test test done done then test readonly then sed
+		done grep done grep sed sed readonly local then
+	readonly cd && 'quoted text'
+cd --verbose awk && --verbose test
+		x=1 printf done done | awk $(pwd)
+	--verbose then ${HOME} echo "$1" | test x=1 readonly "$@"
+		-eu 2>/dev/null cd 'quoted text' grep sed export cd readonly cd export
+"$@" printf x=1 local echo awk -eu local test
+	/usr/bin then export x=1 echo $(pwd) x=1
+	x=1 "$@" then then awk && done then
+	grep printf printf done then -eu && test 2>/dev/null then "$@" done
+#include c91.sh
+		/usr/bin --verbose | test local 2>/dev/null && x=1 printf --verbose
+echo "$1" printf x=1 --verbose cd x=1 "$1" x=1 --verbose
+		x=1 -eu sed ${HOME} cd $(pwd)
+/usr/bin ${HOME} export --verbose --verbose done
+	then 2>/dev/null && done
+	then awk --verbose then 'quoted text' awk | --verbose
+		"$1" 2>/dev/null /usr/bin 'quoted text' sed 2>/dev/null -eu test
+		| $(pwd) "$1" echo sed /usr/bin ${HOME} done grep "$1" echo then /usr/bin
+	cd && export grep /usr/bin ${HOME} sed echo
+		test echo printf cd $(pwd) -eu local printf x=1 sed readonly echo 'quoted text'
+	--verbose local /usr/bin awk /usr/bin cd
+2>/dev/null printf local printf awk export then awk -eu
+sed /usr/bin readonly echo
+	awk | 'quoted text' echo 'quoted text' done then readonly
+		/usr/bin awk grep ${HOME} 2>/dev/null local
+awk "$@" sed echo done ${HOME} -eu test
+	"$@" done test readonly done | cd | sed "$1"
+readonly then done done --verbose
+		readonly 2>/dev/null 'quoted text' --verbose && printf test cd -eu
+	/usr/bin -eu x=1 ${HOME} printf | -eu ${HOME} 2>/dev/null /usr/bin /usr/bin
+		"$@" echo export --verbose | then readonly printf
+then export ${HOME} grep $(pwd) awk $(pwd)
+printf 2>/dev/null then then 'quoted text' grep --verbose
+	${HOME} /usr/bin --verbose -eu sed awk $(pwd) 2>/dev/null then ${HOME} sed $(pwd)
+	"$1" 'quoted text' test x=1 "$@" && awk grep
+	-eu | 'quoted text' echo
+	done printf echo && test -eu local sed "$1" sed test cd echo
+		awk then echo printf cd readonly grep --verbose cd readonly ${HOME}
+${HOME} sed x=1 export x=1
+		then -eu test local printf "$@" echo export
+"$@" readonly 2>/dev/null --verbose
+printf grep grep | readonly test readonly && cd local | ${HOME} $(pwd) then
+	-eu done printf ${HOME} 'quoted text' awk --verbose "$@" printf x=1 printf
+	&& ${HOME} 2>/dev/null && then export
+		done | $(pwd) $(pwd) sed x=1 printf
+	done $(pwd) grep "$@" 2>/dev/null "$1" echo test --verbose
+sed cd "$1" export printf printf x=1
+	local readonly printf -eu export awk 2>/dev/null awk test done readonly
+'quoted text' then cd local printf $(pwd) sed echo then "$1" done 2>/dev/null
+	${HOME} readonly printf | sed | echo && printf export
+	$(pwd) awk readonly done $(pwd) then $(pwd) x=1 "$1" export 2>/dev/null
+echo readonly then "$@" local /usr/bin sed --verbose
+		readonly echo && sed export ${HOME} ${HOME} x=1 echo then -eu export
+	-eu readonly test --verbose then /usr/bin --verbose
+sed | x=1 done awk $(pwd) "$@" done ${HOME} x=1 cd ${HOME} sed "$@" "$@" echo cd
+	export then awk 2>/dev/null local /usr/bin echo cd cd -eu done
+${HOME} done x=1 $(pwd) test done
+	x=1 -eu x=1 sed cd export "$1" "$1" "$1" -eu readonly local then --verbose --verbose
+		awk -eu 'quoted text' echo && --verbose sed | ${HOME} export
+${HOME} printf cd then done readonly done sed "$1" "$@"
+		/usr/bin sed | "$@" awk "$@" -eu grep
+		export | --verbose /usr/bin cd grep && sed
+	/usr/bin 2>/dev/null local "$@" --verbose sed printf
+		test test -eu -eu printf x=1 cd test cd echo then sed sed 'quoted text'
+		then | local local then
+		export | -eu cd -eu local then
+cd readonly ${HOME} export done cd export
+	sed export 2>/dev/null $(pwd) "$1" then /usr/bin local /usr/bin grep then sed &&
+x=1 then "$1" "$@" test then grep "$@" printf export ${HOME} 'quoted text'
+		echo "$@" cd "$1" local x=1 echo 'quoted text' "$1" ${HOME} "$1" local
+		readonly ${HOME} test x=1 local grep ${HOME} local "$1" test
+		${HOME} done 'quoted text'
+local export "$@" echo
+	-eu awk $(pwd) ${HOME} export printf echo readonly x=1 echo cd sed -eu "$1" -eu
+	${HOME} done --verbose awk 2>/dev/null 2>/dev/null cd printf ${HOME}
+	| then sed test done export done grep sed ${HOME} "$@" then -eu
+		cd sed -eu printf local
+		readonly x=1 awk 2>/dev/null /usr/bin /usr/bin test
+		x=1 $(pwd) grep echo done sed 'quoted text' "$1" readonly echo 'quoted text' 'quoted text'
+		local sed awk /usr/bin cd printf test 'quoted text'
+		"$@" "$@" && local -eu && cd grep /usr/bin --verbose
+	echo && readonly x=1 "$@" "$1" cd /usr/bin
+export /usr/bin sed printf ${HOME} x=1 cd cd done
+	echo test printf local printf 'quoted text'
+		awk sed /usr/bin | -eu awk 'quoted text' export ${HOME} x=1 2>/dev/null
+	${HOME} echo "$1" test grep "$1" echo $(pwd) | sed done "$1" printf
+	cd 2>/dev/null "$@" x=1 x=1 'quoted text' && local
+local --verbose then echo -eu printf echo ${HOME}
+"$@" printf 'quoted text' done "$1" "$1" | then readonly "$1" |
+$(pwd) then 'quoted text' $(pwd) /usr/bin -eu grep ${HOME} | "$1" then readonly
+"$@" echo ${HOME} done awk local x=1 readonly | "$1" printf
+/usr/bin readonly cd /usr/bin test cd echo echo
+		then && printf x=1 then 'quoted text' 'quoted text'
+	awk --verbose cd test /usr/bin &&
+	/usr/bin ${HOME} cd done | grep 2>/dev/null
+sed --verbose awk echo --verbose /usr/bin awk x=1 then &&
+		echo "$@" sed grep ${HOME} -eu x=1 cd cd export
+test x=1 test 2>/dev/null sed echo then done awk cd
+x=1 'quoted text' grep $(pwd) 2>/dev/null printf ${HOME} printf -eu done
+	&& sed awk printf /usr/bin | printf /usr/bin printf cd sed --verbose &&
+--verbose ${HOME} awk done then
+	"$@" ${HOME} x=1 /usr/bin cd $(pwd) readonly --verbose 'quoted text' "$@" export
+	export test test readonly echo
+done | ${HOME} awk ${HOME} -eu then echo x=1 $(pwd) awk readonly /usr/bin test
+2>/dev/null echo && 'quoted text' local local && $(pwd) sed cd x=1 2>/dev/null readonly
+		readonly done "$@" local
+		$(pwd) | sed && | cd ${HOME} "$@" cd ${HOME} local 'quoted text' "$1"
+		${HOME} sed "$@" test 'quoted text' awk ${HOME} /usr/bin "$@" grep x=1
+		$(pwd) printf awk awk 2>/dev/null awk "$@" ${HOME} export -eu --verbose --verbose
+sed printf test printf printf test x=1 awk "$1" x=1
+then local 2>/dev/null printf test 2>/dev/null grep
+export "$1" readonly && then done && && printf grep ${HOME}
+		x=1 $(pwd) $(pwd) --verbose &&
+	local "$1" echo test readonly | ${HOME} ${HOME}
+	&& printf test then cd x=1
+x=1 printf export "$@" test export cd export grep printf
+		printf done --verbose grep 2>/dev/null cd $(pwd) test done local -eu
+	${HOME} /usr/bin then export && readonly readonly cd readonly
+		cd $(pwd) $(pwd) -eu awk /usr/bin echo
+	| test sed awk $(pwd) | 2>/dev/null grep local done awk --verbose done
+	$(pwd) -eu 2>/dev/null sed readonly export echo --verbose awk
+		'quoted text' local 'quoted text' echo then | grep /usr/bin
+	$(pwd) $(pwd) then && "$1" "$1" "$@" grep test -eu test echo
+	cd --verbose && done | test cd | x=1 && 2>/dev/null done printf x=1 awk awk
+| cd done -eu 2>/dev/null && then | printf ${HOME} | $(pwd) sed "$1" test 2>/dev/null
+		"$@" test echo ${HOME} printf | $(pwd) grep local
+	/usr/bin 2>/dev/null $(pwd) export then && 2>/dev/null x=1 "$@" -eu -eu
+	$(pwd) && grep -eu export grep
+	"$@" "$1" && printf | grep
+		-eu 'quoted text' ${HOME} /usr/bin grep 2>/dev/null ${HOME}
+sed local x=1 then | printf && echo x=1 ${HOME} local echo printf readonly export
+x=1 "$@" test grep && done printf && cd test /usr/bin /usr/bin --verbose
+		cd /usr/bin test readonly 'quoted text' "$1" 2>/dev/null
+		cd cd x=1 echo /usr/bin /usr/bin | local then grep local grep cd
+		grep export && "$@" && export --verbose sed -eu "$1" 'quoted text' "$@" -eu
+	'quoted text' x=1 $(pwd) ${HOME} echo echo && printf printf
+		grep then | 'quoted text' sed "$1" awk -eu | echo
+-eu done && done ${HOME} | readonly "$1" -eu | -eu 'quoted text' "$@" sed grep
+		${HOME} $(pwd) ${HOME} --verbose then cd /usr/bin
+&& ${HOME} && printf 'quoted text' readonly $(pwd) "$1" x=1 && readonly
+'quoted text' readonly "$@" readonly test /usr/bin done sed echo cd awk awk cd export
+"$1" && sed sed x=1 x=1 grep /usr/bin -eu then
+awk ${HOME} $(pwd) local ${HOME} sed awk 'quoted text' "$1" cd ${HOME}
+export -eu -eu -eu 'quoted text' x=1 then echo && then | echo sed $(pwd) test then
+--verbose $(pwd) --verbose test -eu awk ${HOME}
+cd printf awk export /usr/bin && echo sed 'quoted text'
+		/usr/bin x=1 x=1 done echo 'quoted text' ${HOME} && test
+	awk 2>/dev/null local | "$@" printf local then /usr/bin
+		done | 'quoted text' /usr/bin awk export x=1 $(pwd) /usr/bin
+	readonly export test echo ${HOME} sed 2>/dev/null export
+grep -eu test $(pwd) test local test local
+	done test | awk x=1 cd grep
+		awk ${HOME} $(pwd) printf done "$1" awk awk && awk awk --verbose
+		$(pwd) done 2>/dev/null readonly x=1
+		"$@" ${HOME} grep cd ${HOME}
+	-eu grep -eu test && --verbose test x=1 cd printf /usr/bin && "$@" then
+		&& echo cd sed printf printf && awk test --verbose "$1" "$1" --verbose grep
+	printf export done "$1" -eu
+		$(pwd) readonly "$1" done grep done "$@" /usr/bin
+grep local 'quoted text' 2>/dev/null /usr/bin --verbose awk x=1 "$@" sed --verbose
+		| "$@" "$@" grep 2>/dev/null
+grep x=1 test grep awk readonly 2>/dev/null local "$1" done test sed done sed /usr/bin
+	2>/dev/null test readonly export
+		then local "$@" test cd test cd x=1 local printf sed export printf readonly "$@"
+	| done 'quoted text' $(pwd) --verbose
+		$(pwd) "$1" && 'quoted text' --verbose "$1" awk export | echo && ${HOME}
+	--verbose printf cd export then
+		printf grep echo --verbose done done
+		"$@" -eu /usr/bin export printf printf "$1" 'quoted text' x=1
+		awk ${HOME} echo echo -eu export then
+		done $(pwd) && /usr/bin && && local
+		$(pwd) 2>/dev/null export --verbose
+		$(pwd) ${HOME} 'quoted text' readonly | "$@" ${HOME}
+	echo 'quoted text' ${HOME} 'quoted text'
+	done --verbose $(pwd) x=1 --verbose local readonly | x=1
+export ${HOME} printf "$1"
+		cd /usr/bin && done done grep readonly done test
+	readonly $(pwd) local test ${HOME} -eu sed done then "$@" -eu -eu "$1"
+		--verbose export awk ${HOME}
+	${HOME} -eu local readonly "$@"
+	--verbose done awk sed
+${HOME} sed awk ${HOME} sed sed test
+-eu ${HOME} then cd echo then printf /usr/bin sed then then grep echo then
+local x=1 grep && cd "$1" export test $(pwd) local grep x=1
+	grep --verbose awk then grep 'quoted text'
+	readonly /usr/bin 'quoted text' test
+		then 2>/dev/null ${HOME} done 'quoted text' $(pwd) x=1 echo local 2>/dev/null
+	test cd -eu readonly /usr/bin "$1" export export grep -eu $(pwd)
+		local -eu sed sed grep export sed readonly x=1 then local -eu "$@"
+/usr/bin echo grep cd | x=1 sed sed x=1 echo 2>/dev/null 2>/dev/null
+		&& "$@" /usr/bin cd $(pwd) echo -eu local printf
+	sed test "$@" 2>/dev/null grep readonly readonly done cd "$1" done
+	"$1" 'quoted text' ${HOME}
+	done readonly 'quoted text'
+		--verbose | $(pwd) 'quoted text' ${HOME} && test test
+--verbose ${HOME} echo echo export | x=1
+local && "$@" readonly local | /usr/bin done
+grep awk --verbose -eu awk && "$@" awk
+		export $(pwd) | grep /usr/bin sed
+		'quoted text' 'quoted text' done readonly "$@" awk then printf grep
+	grep "$@" awk /usr/bin && 2>/dev/null then ${HOME} sed sed /usr/bin then
+"$@" x=1 | local "$@" x=1
+export then echo ${HOME} -eu && x=1 x=1 printf
+	local "$@" /usr/bin sed grep -eu /usr/bin export
+	-eu awk /usr/bin done echo
+		readonly export grep done $(pwd)
+	local /usr/bin 2>/dev/null printf printf
+'quoted text' test 2>/dev/null /usr/bin x=1 2>/dev/null --verbose && test x=1
+	done 2>/dev/null /usr/bin readonly 2>/dev/null echo cd echo
+2>/dev/null cd | readonly printf | cd
+		grep "$1" local done "$@" --verbose
+	export then export --verbose
+		sed echo $(pwd) -eu --verbose
+		2>/dev/null awk 'quoted text'
+		-eu ${HOME} && x=1 test && local /usr/bin export $(pwd) 'quoted text' local
+sed awk 2>/dev/null "$@" /usr/bin
+done 'quoted text' grep done && readonly
+	done then then x=1 printf "$@" readonly printf echo
+	'quoted text' ${HOME} grep test 'quoted text' cd x=1 then 2>/dev/null
+		/usr/bin --verbose /usr/bin ${HOME} sed sed done
+		sed then done grep done printf
+		echo "$@" readonly readonly x=1 grep then local
+test echo export done local -eu "$@" test $(pwd)
+		&& done then $(pwd) test "$@" sed "$@" readonly && 2>/dev/null
+sed 2>/dev/null $(pwd) && $(pwd) then 'quoted text' grep
+	/usr/bin -eu ${HOME} x=1 done 'quoted text' export awk grep echo /usr/bin
+		x=1 readonly export -eu -eu -eu --verbose sed printf | "$@" local export
+		-eu | then local --verbose printf ${HOME} local then done
+'quoted text' | -eu $(pwd) ${HOME}
+		${HOME} export --verbose ${HOME} ${HOME} export readonly | export echo
+	grep 2>/dev/null test local export && local done awk
+	"$1" /usr/bin local local printf && "$1" sed export 'quoted text'
+		| awk "$1" x=1 echo | export x=1
+		-eu && x=1 cd test cd -eu
+		printf "$@" "$@" -eu "$1" ${HOME} done -eu /usr/bin -eu sed
+"$@" echo /usr/bin ${HOME} -eu sed ${HOME} --verbose
+printf "$@" x=1 readonly printf readonly | && -eu "$@" cd ${HOME} "$@" test | ${HOME}
+	2>/dev/null "$@" cd echo test x=1 | 2>/dev/null
+		'quoted text' "$1" sed
+	"$1" x=1 readonly test ${HOME} cd
+		awk sed sed ${HOME} --verbose sed --verbose done local x=1 "$1" 2>/dev/null &&
+/usr/bin cd export readonly printf echo
+		-eu awk | "$@" export 'quoted text' ${HOME} readonly x=1 then
+"$@" test "$@" | "$1" then --verbose test -eu local grep
+		x=1 echo | 2>/dev/null /usr/bin ${HOME} 'quoted text' /usr/bin x=1
+	"$1" ${HOME} | --verbose && "$1" done then awk
+done local awk test "$1" | readonly echo readonly grep
+	local printf then sed --verbose awk | echo
+		x=1 -eu awk export -eu
+| done echo 'quoted text' printf 'quoted text'
+	then sed "$@" /usr/bin awk cd sed
+	"$1" then ${HOME} then ${HOME} ${HOME} test export --verbose
+		-eu cd readonly awk ${HOME} done export /usr/bin
+done --verbose -eu echo test "$@" && 'quoted text' done sed
+&& then grep readonly done --verbose
+-eu grep test x=1 export 2>/dev/null
+awk awk sed --verbose && readonly "$@" "$1" "$@" cd printf "$1" then "$1" $(pwd)
+		grep "$1" cd grep grep test grep x=1 done printf | $(pwd) | | 2>/dev/null
+		-eu "$1" echo done "$1" $(pwd) $(pwd) then --verbose printf -eu --verbose --verbose
+		export test -eu cd $(pwd) ${HOME}
+		&& awk sed grep awk awk -eu "$1"
+	-eu /usr/bin done sed local done printf
+--verbose "$1" "$1" x=1 --verbose test grep echo
+		"$@" cd 2>/dev/null test local x=1 "$1" local awk x=1
+	&& -eu && --verbose readonly sed echo -eu local awk local /usr/bin -eu
+2>/dev/null 2>/dev/null echo awk
+		/usr/bin "$1" local x=1 ${HOME} "$@" -eu grep printf sed 'quoted text'
+		"$@" -eu x=1 'quoted text'
+	sed printf sed awk local ${HOME} then cd done printf $(pwd) -eu | test
+		-eu grep export echo test 'quoted text'
+		sed export "$1" grep $(pwd) /usr/bin | readonly
+sed echo /usr/bin test x=1 grep local then
+"$1" echo local "$@" -eu "$@" then then
+-eu | ${HOME} ${HOME} test printf echo /usr/bin test 'quoted text' ${HOME}
+	'quoted text' && --verbose cd printf 'quoted text' 2>/dev/null printf printf &&
+		-eu cd local && $(pwd) | /usr/bin
+		&& --verbose && grep export cd printf && readonly
+"$1" 2>/dev/null export | "$@" 2>/dev/null
+		grep done | grep local local awk grep
+	-eu "$1" $(pwd) | local 'quoted text' grep grep awk readonly "$@"
+		--verbose "$@" printf test $(pwd)
+	2>/dev/null test -eu && export -eu 'quoted text' ${HOME}
+		--verbose "$1" done sed
+echo -eu $(pwd) | then /usr/bin local | "$1"
+echo | | 2>/dev/null -eu printf cd "$@" cd $(pwd) $(pwd)
+		sed 2>/dev/null grep test sed printf
+awk grep sed cd printf ${HOME} 2>/dev/null
+		'quoted text' sed grep test cd "$@"
+	"$1" && -eu "$1" done ${HOME}
+local --verbose /usr/bin | local -eu test test export /usr/bin --verbose echo
+then "$@" $(pwd) /usr/bin sed /usr/bin cd echo
+	grep 2>/dev/null readonly 2>/dev/null
+cd then "$@" done local "$@" local "$1" -eu "$1"
+export /usr/bin sed done readonly
+		local sed test 2>/dev/null /usr/bin printf done sed x=1 "$1" export
+"$1" local readonly then grep "$@" -eu 'quoted text' echo cd x=1
+		local printf echo awk --verbose done x=1 then echo sed --verbose
+	sed 'quoted text' --verbose --verbose -eu 'quoted text'
+	x=1 | echo "$@" awk 2>/dev/null export awk awk 'quoted text'
+		/usr/bin test sed readonly $(pwd)
+local local && x=1 export sed x=1 --verbose |
+	"$@" local then echo | grep && "$1" /usr/bin done 2>/dev/null echo $(pwd)
+done && ${HOME} "$@" local printf 'quoted text' done "$1" grep /usr/bin 2>/dev/null
+readonly && /usr/bin 2>/dev/null "$@" cd && test /usr/bin done then -eu
+		done export 2>/dev/null sed sed awk
+	${HOME} done ${HOME} 2>/dev/null --verbose
+x=1 2>/dev/null "$@" ${HOME} x=1 'quoted text' cd /usr/bin grep
+grep 2>/dev/null then export 2>/dev/null
+		readonly echo 2>/dev/null x=1 printf
+		"$@" test 2>/dev/null sed printf 2>/dev/null
+	cd $(pwd) printf x=1 grep awk cd /usr/bin ${HOME} printf 'quoted text' -eu
+local sed /usr/bin 2>/dev/null "$@" export test $(pwd) printf -eu x=1 echo &&
+		x=1 $(pwd) "$@" sed 'quoted text' cd 'quoted text'
+	&& -eu --verbose test then 2>/dev/null "$1" done /usr/bin local -eu
+		local "$@" | local local
+		done grep $(pwd) done then | awk 2>/dev/null
+		| cd "$@" grep /usr/bin readonly -eu export /usr/bin printf local
+	printf cd awk 'quoted text' -eu x=1 grep
+		test && && test /usr/bin && && --verbose export local
+		x=1 x=1 "$1" 'quoted text' ${HOME} readonly x=1 readonly done done "$@" 'quoted text'
+x=1 export $(pwd) "$@" awk
+	then $(pwd) 2>/dev/null $(pwd) awk readonly printf 2>/dev/null local "$@"
+		--verbose x=1 x=1 x=1 "$1" cd "$@"
+echo --verbose /usr/bin echo cd echo printf x=1 test test /usr/bin
+-eu -eu x=1 awk awk awk done local | ${HOME}
+		awk ${HOME} --verbose
+cd "$@" sed "$@" sed awk echo 'quoted text' x=1 sed --verbose
+test then "$1" cd /usr/bin export
+'quoted text' 2>/dev/null then echo && 'quoted text' test x=1 -eu sed export 2>/dev/null
+local local export 'quoted text' printf cd "$1" sed
+&& "$1" readonly awk done done -eu local test sed --verbose
+printf printf x=1 /usr/bin x=1 done echo test test then | ${HOME}
+	2>/dev/null printf export ${HOME} /usr/bin
+then awk local cd "$@" export grep | then
+		sed /usr/bin 2>/dev/null "$@" | && x=1 cd -eu export "$@"
+grep done 'quoted text' ${HOME} echo done x=1 $(pwd)
+| then readonly ${HOME} "$1" "$1" awk --verbose -eu 'quoted text'
+&& local export done sed awk $(pwd) "$1" grep -eu "$@" "$1" "$1" done local
+		echo readonly grep export cd readonly
+	&& readonly done -eu -eu $(pwd) && "$@"
+	/usr/bin | "$@" | 2>/dev/null awk ${HOME} awk "$@" grep &&
+	'quoted text' readonly then readonly printf then
+-eu done sed x=1 test printf local "$1" awk
+x=1 'quoted text' -eu sed local $(pwd) grep "$1" then done test
+		"$1" "$@" readonly "$@" then grep cd local test ${HOME}
+2>/dev/null export test | "$1" ${HOME} local ${HOME}
+		/usr/bin local "$@" | printf then x=1 ${HOME} done | grep 2>/dev/null
+	then --verbose ${HOME} 'quoted text' export
+	--verbose cd 'quoted text' grep awk ${HOME} echo 'quoted text'
+$(pwd) ${HOME} printf local printf x=1 'quoted text' echo "$@" "$@" "$@" local
+cd "$1" /usr/bin grep cd $(pwd)
+		readonly x=1 awk awk local awk test awk then done "$@" $(pwd)
+		/usr/bin "$@" 2>/dev/null | ${HOME} sed awk sed --verbose
+		| awk local $(pwd) 'quoted text' printf done test sed local
+		sed sed readonly "$@" printf x=1 -eu
+	done awk cd | sed && "$1" /usr/bin
+readonly /usr/bin "$@" awk printf $(pwd)
+printf && "$@" x=1 -eu cd && ${HOME} -eu ${HOME} readonly --verbose export
+	test export $(pwd) echo then test printf "$1" printf test then awk /usr/bin echo
+		readonly "$@" done | 2>/dev/null printf cd readonly
+/usr/bin | local readonly sed cd grep "$@" | 2>/dev/null export cd "$1"
+		x=1 --verbose readonly -eu "$@" local "$1" then "$@" readonly local
+	'quoted text' $(pwd) done
+-eu then done x=1 sed echo 'quoted text'
+	--verbose then cd "$1"
+		"$@" readonly "$1" export echo test "$@" export
+export then --verbose ${HOME}
+		readonly awk echo 2>/dev/null "$1" x=1 -eu $(pwd) 'quoted text' printf
+2>/dev/null | --verbose printf --verbose sed cd /usr/bin printf grep readonly ${HOME}
+	&& cd sed "$@" local cd &&
+export 'quoted text' sed "$1" 'quoted text' 'quoted text' 2>/dev/null ${HOME}
+		--verbose "$@" printf printf
+		awk sed ${HOME} export ${HOME} "$1"
+	"$1" ${HOME} grep 'quoted text'
+${HOME} readonly done cd export $(pwd)
+	'quoted text' | then 'quoted text' export export then 'quoted text' echo "$1"
+		$(pwd) done "$1" grep done ${HOME} grep "$1"
+${HOME} ${HOME} local grep then awk export then export --verbose
+		readonly printf awk readonly grep readonly ${HOME} --verbose
+-eu then test | sed 'quoted text' export "$1"
+	then -eu cd && local ${HOME} 'quoted text' test
+	grep export export echo printf sed --verbose | && "$1" 'quoted text' test /usr/bin
+$(pwd) $(pwd) export | echo cd printf grep 'quoted text' cd /usr/bin grep "$1"
+printf -eu x=1 echo cd sed grep test done grep && printf export -eu
+		| && local /usr/bin test printf
+local $(pwd) $(pwd) ${HOME} ${HOME} 2>/dev/null
+		-eu then grep local "$1"
+		export test && 'quoted text' cd test ${HOME} grep "$@"
+	cd 'quoted text' 'quoted text' 2>/dev/null --verbose
+		awk 'quoted text' 'quoted text' && /usr/bin then cd x=1 | x=1 export grep
+"$1" "$1" awk local export grep "$1" | /usr/bin 2>/dev/null
+grep $(pwd) $(pwd) | ${HOME}
+	printf "$1" grep then "$@" | grep && &&
+cd $(pwd) test cd && sed
+'quoted text' "$@" x=1 sed export done local
+printf --verbose && printf | local sed grep "$1" readonly sed readonly "$@" "$1"
+	-eu && && awk awk readonly && ${HOME} "$1" awk "$@" "$@"
+		export --verbose printf 2>/dev/null printf export
+		awk then echo x=1 && 'quoted text' grep /usr/bin
+	printf ${HOME} x=1 -eu grep then grep "$@" printf test done ${HOME} /usr/bin
+'quoted text' test ${HOME} sed /usr/bin grep --verbose
+		${HOME} awk "$1" sed | && 2>/dev/null local done "$1" cd
+		&& echo export then grep "$1"
+cd ${HOME} then then 'quoted text' export
+		/usr/bin test --verbose readonly $(pwd) export x=1 sed
+		$(pwd) && then printf printf
+	| sed local /usr/bin test /usr/bin sed && echo cd test then local awk /usr/bin
+	x=1 2>/dev/null export --verbose
+		"$@" -eu && --verbose -eu echo local awk
+		$(pwd) grep | "$@" "$1" && x=1 $(pwd)
+		| $(pwd) readonly -eu printf export | readonly --verbose
+test printf grep test ${HOME} $(pwd) /usr/bin --verbose /usr/bin
+		&& /usr/bin "$1" | -eu "$@" echo -eu done then readonly
+		done awk 'quoted text' -eu printf test 'quoted text' sed
+		local -eu cd grep x=1 cd awk 'quoted text'
+	done awk local && && "$@"
+2>/dev/null --verbose printf cd x=1 cd readonly local
+	| grep done printf ${HOME} echo -eu then local
+$(pwd) ${HOME} -eu && -eu | grep readonly 2>/dev/null
+	grep printf --verbose --verbose grep && awk x=1
+		cd "$1" echo "$1" printf 'quoted text' readonly printf
+"$@" "$@" done ${HOME} sed printf
+		export && echo 'quoted text' readonly $(pwd) 2>/dev/null
+'quoted text' export ${HOME} -eu echo -eu sed printf sed -eu x=1 then "$@" local
+readonly readonly 2>/dev/null
+export awk -eu x=1 -eu test --verbose done /usr/bin
+		-eu cd echo echo export local -eu /usr/bin
+awk echo readonly -eu /usr/bin readonly 2>/dev/null
+	/usr/bin 2>/dev/null grep "$1" test cd x=1 -eu 'quoted text' local && "$@" readonly
+	local x=1 'quoted text' 'quoted text' echo readonly /usr/bin
+awk ${HOME} export export -eu cd export readonly $(pwd)
+		awk cd | done "$@" "$@"
+		2>/dev/null echo printf grep $(pwd) "$1"
+		-eu -eu 'quoted text' --verbose test /usr/bin
+	-eu awk sed test 2>/dev/null -eu cd "$@" x=1
+		cd then then $(pwd) x=1 printf "$@" grep echo "$1" -eu awk echo ${HOME} awk 'quoted text'
+		export done && printf then
+	sed "$1" test awk /usr/bin readonly
+'quoted text' awk /usr/bin readonly && 2>/dev/null
+	grep x=1 && "$@" grep grep
+		'quoted text' printf grep awk test grep printf echo "$@" cd readonly sed --verbose
+	echo export 'quoted text' export done awk
+test | | --verbose printf echo -eu 'quoted text'
+"$@" then export "$1" --verbose
+	grep --verbose 2>/dev/null
+	-eu 'quoted text' printf
+	/usr/bin ${HOME} "$1" "$@" sed printf
+	/usr/bin "$1" awk -eu --verbose "$1" -eu echo echo | printf -eu local /usr/bin
+	${HOME} ${HOME} grep "$1" x=1 | /usr/bin -eu readonly 'quoted text' /usr/bin
+	sed /usr/bin x=1 echo x=1 echo x=1 export x=1 x=1 done echo /usr/bin
+		$(pwd) cd local x=1 "$@" | done x=1 'quoted text' done && && cd 2>/dev/null
+		$(pwd) awk --verbose x=1 local sed export
+echo test grep -eu 'quoted text' -eu "$1"
+	${HOME} 'quoted text' sed echo local readonly echo printf "$@"
+		2>/dev/null 'quoted text' cd "$1" local then local -eu 2>/dev/null awk
+	sed | 'quoted text' 'quoted text' cd awk 'quoted text'
+	export export $(pwd) 2>/dev/null printf
+		"$@" "$1" "$@" ${HOME} 'quoted text'
+		test echo echo 2>/dev/null
+	| local printf export done 2>/dev/null printf
+		readonly grep local x=1 printf && local done local
+	/usr/bin export sed cd -eu cd x=1 readonly readonly export done cd ${HOME} ${HOME}
+		cd -eu awk 'quoted text' | readonly done x=1 done
+export | readonly cd cd && readonly awk export export export grep then $(pwd) printf
+/usr/bin export "$1" local -eu local awk && test awk x=1 /usr/bin
+		local local printf echo local awk grep
+then cd then readonly | -eu awk && export 2>/dev/null readonly
+		readonly cd test then && "$1" ${HOME} readonly --verbose "$1" "$@" grep /usr/bin
+	done && local readonly export x=1
+		&& done cd && grep readonly "$@" | test 'quoted text' export printf ${HOME}
+grep && then cd test x=1 ${HOME} cd "$@" then ${HOME} local |
+x=1 "$1" 'quoted text' test --verbose "$@" | echo awk $(pwd)
+		x=1 done echo "$1" readonly
+		--verbose printf then grep | "$1" readonly && awk echo
+	${HOME} x=1 readonly && echo cd x=1 export cd then | "$@" export local 'quoted text'
+printf grep done grep "$1" "$1" 2>/dev/null && | then awk then grep &&
+	2>/dev/null printf 2>/dev/null printf && local /usr/bin
+local export then $(pwd) | x=1 done sed
+	export grep "$1" echo test readonly then $(pwd) done
+--verbose /usr/bin grep ${HOME} 2>/dev/null "$@" x=1 x=1 done
+	"$1" -eu "$1" | export test export $(pwd) ${HOME} test printf
+	cd /usr/bin x=1 then local sed ${HOME} && test
+readonly export awk "$1" grep export
+then grep 2>/dev/null x=1 test grep
+	grep awk ${HOME} cd 'quoted text' grep done awk x=1 echo x=1 -eu && 2>/dev/null
+	-eu export done -eu then
+	awk cd $(pwd) test x=1 test export $(pwd) $(pwd) && x=1 "$1" sed | grep grep test
+	test --verbose grep awk cd printf
+	echo | --verbose printf export
+		--verbose readonly cd grep local && export
+"$@" 2>/dev/null /usr/bin then printf x=1 ${HOME} export "$@"
+		awk "$1" printf && grep $(pwd) | printf
+cd readonly -eu "$@" "$1" 2>/dev/null "$@"
+		readonly | printf echo printf grep test echo test
+| awk readonly grep "$@" done |
+	"$1" ${HOME} --verbose readonly printf done --verbose
+$(pwd) grep sed 'quoted text' done && readonly -eu
+	--verbose then --verbose then export done readonly test then
+printf "$1" x=1 && | $(pwd) then grep
+		cd ${HOME} test done $(pwd) export "$1"
+		awk readonly && "$@" printf 'quoted text' && printf
+export export ${HOME} export /usr/bin echo
+local | && done done --verbose local then | echo test test
+--verbose readonly then $(pwd) | -eu printf | local cd done readonly cd -eu test
+	export x=1 awk --verbose -eu -eu /usr/bin 'quoted text' && local
+${HOME} "$1" -eu 'quoted text' 'quoted text' awk readonly local test grep
+readonly local export cd --verbose sed --verbose -eu "$@" test "$1" -eu x=1
+	printf && cd grep test printf test done
+	2>/dev/null awk echo ${HOME} ${HOME}
+		--verbose "$1" awk --verbose | grep local then "$@" cd |
+		grep done /usr/bin | echo printf local 'quoted text' then export
+		test && echo "$@" "$1" done
+	${HOME} printf "$1" "$1" --verbose
+	local export | 'quoted text' printf test /usr/bin
+	-eu done awk grep grep -eu "$@" then 2>/dev/null
+printf awk /usr/bin local cd local "$1"
+	awk test --verbose 'quoted text' "$@" awk && awk "$1" "$@" sed done readonly
+		| cd $(pwd) printf ${HOME} --verbose
+		"$@" readonly "$1" "$1" && x=1 export 2>/dev/null done ${HOME}
+"$1" awk | "$1" --verbose awk printf $(pwd) awk export
+	printf 'quoted text' export
+echo | local x=1 --verbose readonly echo x=1 ${HOME} "$1" /usr/bin export readonly
+		grep 'quoted text' -eu grep printf
+		cd "$1" cd awk --verbose && "$@" --verbose sed readonly
+	grep x=1 then then readonly 'quoted text' 'quoted text' printf
+		| awk 'quoted text' readonly grep cd ${HOME} ${HOME}
+export 'quoted text' sed awk -eu -eu /usr/bin local
+/usr/bin awk --verbose 'quoted text'
+		local | printf ${HOME} awk test local awk local | --verbose ${HOME} "$1"
+	local echo readonly --verbose sed
+		"$1" sed -eu 'quoted text' -eu done awk grep export "$@" /usr/bin
+		x=1 grep | | echo awk "$1" ${HOME} readonly sed local
+	$(pwd) 2>/dev/null awk && cd 2>/dev/null
+done test sed x=1 /usr/bin "$1" ${HOME} local "$1" ${HOME} -eu export 2>/dev/null
+test grep local | $(pwd) $(pwd) grep cd cd done test then export grep $(pwd) cd
+		export cd local done grep grep echo grep
+	printf -eu 'quoted text' ${HOME} then awk cd --verbose grep 2>/dev/null then
+		sed local grep | test --verbose awk --verbose "$1" "$@" -eu done printf
+		sed | readonly done awk sed && export
+	"$@" ${HOME} readonly readonly /usr/bin /usr/bin cd 2>/dev/null
+readonly echo | $(pwd) x=1 /usr/bin
+	"$1" printf printf export && cd printf
+done ${HOME} printf echo awk 2>/dev/null "$1" then 2>/dev/null 'quoted text'
+	"$1" test 2>/dev/null | then --verbose 'quoted text' sed --verbose
+	--verbose sed x=1 awk ${HOME} local cd 2>/dev/null ${HOME} ${HOME}
+"$1" printf grep "$1" --verbose test -eu export "$1" "$1" local test done 2>/dev/null
+		export cd export readonly /usr/bin done 'quoted text' /usr/bin ${HOME} x=1 awk
+		export then 2>/dev/null
+		echo echo --verbose | 'quoted text' done
+local "$1" | awk cd && export
+then cd echo $(pwd) $(pwd) grep
+		| "$1" echo && done export /usr/bin -eu 'quoted text' ${HOME} 'quoted text' 2>/dev/null
+	| export printf x=1 "$@" --verbose export
+-eu done "$@" 2>/dev/null ${HOME} 2>/dev/null x=1 $(pwd) cd ${HOME} "$@"
+sed sed readonly ${HOME} grep test done "$1"
+		sed | | sed grep x=1 done printf && /usr/bin
+awk --verbose grep echo -eu then grep "$@" 'quoted text'
+		"$1" ${HOME} then x=1 /usr/bin 2>/dev/null
+	echo 2>/dev/null local echo | | test then -eu echo 2>/dev/null
+	x=1 readonly | export printf 2>/dev/null
+		$(pwd) grep && ${HOME} | ${HOME} cd awk "$1" awk "$@" 2>/dev/null
+		&& /usr/bin ${HOME} export echo
+	"$@" && && grep sed done done ${HOME} "$1" /usr/bin
+		done x=1 cd x=1 2>/dev/null x=1 sed then sed ${HOME} && test -eu --verbose test
+| export test printf "$@" grep | readonly
+	-eu sed --verbose cd done test printf --verbose 2>/dev/null grep awk printf
+		&& grep 'quoted text'
+		2>/dev/null printf then grep "$1" $(pwd) --verbose
+	/usr/bin local $(pwd) | readonly printf
+	/usr/bin --verbose -eu | local cd sed printf cd grep 'quoted text'
+		/usr/bin grep 'quoted text' | done printf &&
+echo echo -eu "$1" "$1" -eu -eu export
+		echo echo $(pwd) && "$@" | "$1" -eu &&
+		cd printf | local "$1" readonly then
+	| | grep export done "$@" ${HOME} grep "$@"
+	export done done 2>/dev/null local test x=1 readonly ${HOME} cd sed && $(pwd) "$1"
+x=1 printf sed "$@" then test printf && grep "$1" $(pwd) "$@" export
+		grep "$1" 2>/dev/null awk /usr/bin x=1 echo echo | sed then ${HOME}
+		"$@" "$1" test done sed awk
+	/usr/bin cd cd cd | 'quoted text'
+	${HOME} echo done -eu export export cd
+		cd /usr/bin echo done && echo && 'quoted text' ${HOME}
+		readonly cd echo 'quoted text' | export | test awk -eu export
+		${HOME} /usr/bin readonly 'quoted text' ${HOME} readonly readonly grep
+export $(pwd) --verbose done -eu
+	echo && -eu "$@" test --verbose && | local --verbose 2>/dev/null $(pwd) | local
+		then test --verbose -eu "$@" ${HOME} -eu -eu /usr/bin
+		export && then printf 'quoted text' 2>/dev/null done done
+$(pwd) $(pwd) -eu "$1"
+-eu ${HOME} done "$1" readonly
+done "$1" test grep --verbose then "$1" then
+x=1 done | "$@" 'quoted text'
+		echo local $(pwd) ${HOME}
+	echo $(pwd) test sed "$@" && x=1 "$1" && ${HOME} readonly export
+echo grep cd 2>/dev/null then "$1" x=1 ${HOME} cd echo printf 'quoted text'
+		local then awk | then --verbose 2>/dev/null -eu --verbose printf ${HOME}
+	echo local ${HOME} done -eu x=1 2>/dev/null printf 2>/dev/null done
+	done -eu echo && "$1" cd local ${HOME}
+		printf "$@" then /usr/bin local ${HOME} then local local -eu readonly
+	-eu 'quoted text' ${HOME} then readonly
+2>/dev/null "$@" | echo export cd readonly 2>/dev/null grep
+	local --verbose && "$1" printf "$1" 'quoted text'
+	test grep export cd 2>/dev/null
+		/usr/bin local --verbose export
+printf printf echo grep -eu 2>/dev/null
+$(pwd) 'quoted text' readonly x=1
+		awk "$1" && export /usr/bin printf then && --verbose test sed
+		then readonly -eu 'quoted text'
+		/usr/bin | test "$1" "$@" | --verbose -eu test ${HOME} --verbose "$1" cd
+		sed --verbose | test /usr/bin done export
+${HOME} --verbose "$1" test 'quoted text'
+		/usr/bin "$1" then test x=1 awk 'quoted text' && sed $(pwd) /usr/bin readonly printf
+		2>/dev/null echo && | grep x=1 local done then /usr/bin readonly
+	&& printf -eu local done x=1 $(pwd) printf export
+	&& cd printf --verbose "$@" | sed "$1" grep -eu export then 'quoted text'
+	&& local 2>/dev/null && readonly grep | 'quoted text' "$1" 2>/dev/null /usr/bin
+echo /usr/bin 'quoted text' "$@"
+		test && export ${HOME} x=1 "$1" $(pwd) /usr/bin
+		done cd done grep awk x=1 test
+	"$1" $(pwd) 'quoted text' local grep test 'quoted text' -eu
+		test grep /usr/bin 2>/dev/null echo export export && && 2>/dev/null
+	readonly 'quoted text' done
+		x=1 grep $(pwd) | printf "$1" export printf -eu then
+		${HOME} "$1" 2>/dev/null --verbose then 2>/dev/null local --verbose readonly --verbose
+	printf $(pwd) /usr/bin local sed awk echo grep
+		'quoted text' awk $(pwd)
+${HOME} echo cd grep 'quoted text'
+/usr/bin --verbose sed
+	readonly cd "$@" local readonly then x=1 awk 'quoted text'
+	2>/dev/null --verbose /usr/bin
+		echo export echo grep grep local -eu --verbose local ${HOME} "$@" |
+		x=1 /usr/bin && awk $(pwd) printf -eu /usr/bin
+"$@" local export then "$1" readonly
+$(pwd) $(pwd) printf $(pwd) 'quoted text' done 2>/dev/null
+		cd local cd "$1" "$1"
+		cd cd 'quoted text' 2>/dev/null "$@" sed done 'quoted text' "$@"
+export awk readonly $(pwd) -eu 2>/dev/null test echo cd --verbose
+		--verbose export then cd -eu "$@" printf printf x=1 cd && awk 2>/dev/null &&
+		then | test 2>/dev/null "$1" 'quoted text' x=1 sed readonly grep
+awk $(pwd) | sed cd x=1 local "$1" 'quoted text'
+	grep printf $(pwd) -eu 2>/dev/null local done 2>/dev/null awk grep test
+	&& printf /usr/bin | awk ${HOME} ${HOME} done
+		x=1 "$@" /usr/bin 'quoted text' ${HOME} export
+		/usr/bin "$@" printf && sed
+/usr/bin x=1 "$1" then readonly
+test test sed "$@" && awk grep readonly cd done && -eu local done then /usr/bin
+echo | awk /usr/bin export awk then &&
+		export | "$1" ${HOME} -eu awk --verbose readonly
+		cd local awk x=1 test grep "$1" printf echo done local /usr/bin test printf
+		test printf then "$1" then
+export echo x=1 cd /usr/bin "$@" x=1 test && x=1 -eu
+printf 'quoted text' then | printf export
+		${HOME} local /usr/bin ${HOME} "$@" grep test done "$1" export | 'quoted text' 2>/dev/null
+		&& test $(pwd) "$@" sed done ${HOME} local x=1 printf
+		| | printf && 2>/dev/null
+		/usr/bin readonly -eu x=1
+	export sed export "$@" sed /usr/bin readonly
+	-eu export then grep --verbose readonly cd
+		&& ${HOME} x=1 grep awk 'quoted text'
+		2>/dev/null 2>/dev/null echo awk $(pwd) "$1" cd --verbose export
+		&& "$1" "$@" then sed x=1 local | awk grep export
+x=1 done 'quoted text' export printf test x=1 printf
+		printf then | $(pwd) "$1" done export sed readonly --verbose local --verbose
+		"$@" grep --verbose "$1" | grep 'quoted text'
+	test && grep $(pwd) cd 'quoted text' x=1 'quoted text' readonly printf $(pwd) $(pwd)
+| $(pwd) test grep echo 'quoted text' printf
+sed 2>/dev/null sed $(pwd) && | local test "$@"
+local then cd x=1 $(pwd) --verbose printf --verbose ${HOME} 2>/dev/null
+		--verbose "$@" x=1 2>/dev/null 2>/dev/null -eu x=1 awk $(pwd) "$@" done
+		"$1" readonly cd local "$@" printf |
+		test -eu "$@" x=1 --verbose | local readonly
+&& 'quoted text' echo /usr/bin sed
+	grep test "$1" awk /usr/bin
+echo "$1" test cd --verbose printf ${HOME} then | /usr/bin
+then sed printf local -eu cd done grep 2>/dev/null -eu grep local
+	sed sed $(pwd) ${HOME} readonly printf /usr/bin x=1 test grep
+--verbose 2>/dev/null ${HOME} $(pwd) && 'quoted text' readonly "$1" echo 'quoted text'
+		-eu x=1 'quoted text' -eu sed
+	then printf x=1 ${HOME} /usr/bin
+&& | -eu "$1" export ${HOME}
+	&& -eu | local 2>/dev/null ${HOME}
+"$1" ${HOME} sed "$1" readonly --verbose test "$@" 'quoted text' && $(pwd) grep
+echo echo awk export "$1" -eu "$1" sed --verbose done awk local
+	2>/dev/null done readonly -eu ${HOME}
+	"$1" echo "$1" $(pwd) x=1
+/usr/bin | ${HOME} $(pwd) then 'quoted text' --verbose export
+&& 'quoted text' ${HOME} grep export printf then "$1" -eu echo "$1"
+	awk readonly test --verbose done grep printf x=1 && done "$@" "$1" cd /usr/bin
+	echo export -eu 'quoted text' --verbose 2>/dev/null 'quoted text'
+'quoted text' "$@" /usr/bin sed grep local
+		-eu x=1 'quoted text' x=1 "$1" -eu 'quoted text'
+		echo grep echo grep --verbose printf $(pwd) /usr/bin --verbose x=1 --verbose
+sed 2>/dev/null readonly --verbose ${HOME}
+		sed ${HOME} $(pwd) then local "$@" awk
+	-eu then "$1" $(pwd) && printf grep | test -eu cd readonly
+"$1" local local printf cd local done readonly sed -eu "$@" 2>/dev/null
+&& | $(pwd) 'quoted text' done
+		| 2>/dev/null ${HOME} /usr/bin
+		test local /usr/bin echo then /usr/bin
+local $(pwd) --verbose "$1" "$@"
+$(pwd) test x=1 && $(pwd) test awk readonly x=1
+		2>/dev/null then awk readonly cd done "$@" export printf && test
+	/usr/bin cd "$@" 'quoted text'
+${HOME} readonly /usr/bin "$1" x=1 grep awk "$@" x=1 readonly
+	-eu -eu /usr/bin awk /usr/bin printf x=1 done
+	${HOME} readonly export printf done | ${HOME} -eu grep -eu echo
+sed export echo grep cd sed test 2>/dev/null | printf echo grep --verbose
+		then -eu readonly && ${HOME} printf sed "$@" && x=1
+--verbose awk done /usr/bin $(pwd) -eu "$@" printf done cd then
+		then "$1" test then awk then then "$@" -eu
+	'quoted text' awk printf grep $(pwd) grep echo
+		done local sed then x=1 readonly grep readonly
+		cd sed cd test sed test readonly
+		"$1" ${HOME} -eu local grep
+local && $(pwd) done readonly echo printf
+	| 'quoted text' && $(pwd) local done then sed grep cd test export
+		cd ${HOME} sed awk ${HOME}
+test x=1 grep && --verbose test "$@"
+		awk ${HOME} local /usr/bin printf printf --verbose 'quoted text'
+		2>/dev/null printf local printf "$@" ${HOME} 'quoted text'
+local 2>/dev/null $(pwd)
+	echo ${HOME} cd x=1 && export 2>/dev/null readonly
+		'quoted text' ${HOME} local local done cd readonly "$@" -eu awk export
+sed $(pwd) "$1" "$1" "$@" x=1 then ${HOME} test printf $(pwd) /usr/bin
+export && $(pwd) printf "$1" $(pwd) test "$@" done
+	'quoted text' grep awk cd
+done -eu | ${HOME} "$@" "$@" x=1 --verbose grep printf
+test --verbose 2>/dev/null
+grep 2>/dev/null && export grep x=1 "$1" export test sed test then then export
+		"$@" local printf $(pwd) done 'quoted text' printf
+	2>/dev/null printf cd cd x=1 readonly
+		test awk /usr/bin export -eu sed export "$1" -eu awk
+	echo "$@" 'quoted text' then "$1"
+	local /usr/bin readonly
+	test readonly grep -eu grep export $(pwd) export awk grep
+	--verbose --verbose x=1
+		-eu test 'quoted text' echo 'quoted text'
+"$@" "$1" 'quoted text' x=1 --verbose --verbose echo
+		$(pwd) printf done 'quoted text'
+x=1 printf "$1" ${HOME} done 2>/dev/null test --verbose readonly
+	cd test $(pwd) awk export export $(pwd) grep
+	--verbose | && x=1 | test --verbose printf -eu cd sed
+		${HOME} test local x=1 ${HOME} readonly readonly test echo printf export readonly
+	printf local readonly -eu awk 'quoted text' export done && awk x=1 ${HOME}
+		then echo -eu /usr/bin -eu ${HOME} "$1"
+		awk sed 2>/dev/null "$@" local ${HOME}
+		sed then then done then then "$1" 2>/dev/null
+	2>/dev/null && /usr/bin "$1" sed
+		"$@" ${HOME} 2>/dev/null "$@" --verbose 'quoted text' --verbose test readonly
+		| echo done -eu cd then 2>/dev/null then "$1" awk &&
+	&& awk $(pwd) readonly 2>/dev/null $(pwd) 2>/dev/null "$1" -eu readonly then
+	| awk readonly 2>/dev/null x=1 && 2>/dev/null
+		-eu 2>/dev/null test ${HOME} printf
+	&& "$1" done | cd sed echo test grep cd "$@" cd then $(pwd)
+	--verbose 2>/dev/null "$1"
+		sed && sed sed awk cd sed -eu "$1" sed -eu "$1" sed
+		export sed "$@" /usr/bin x=1 readonly "$1" $(pwd) ${HOME} /usr/bin ${HOME}
+		readonly grep export 2>/dev/null test "$@" $(pwd)
+		test local -eu x=1 done /usr/bin sed | | 'quoted text' done test grep
+grep local x=1 done printf 'quoted text'
+	$(pwd) echo grep export
+	cd test readonly printf export 'quoted text' done -eu 'quoted text'
+		$(pwd) export done grep && grep /usr/bin awk /usr/bin "$1" printf echo sed
+	/usr/bin echo then x=1 awk done awk export test done /usr/bin test printf
+test echo cd grep 'quoted text' | local
+then && sed printf "$1" ${HOME} /usr/bin done | local done test test
+	then done --verbose sed grep
+	-eu x=1 'quoted text' done local
+		echo printf 'quoted text'
+	"$@" grep "$1" cd printf printf echo "$1" $(pwd) ${HOME} | "$1" |
+		echo export grep 2>/dev/null local grep cd sed test
+	grep done 2>/dev/null cd cd --verbose printf
+grep $(pwd) 2>/dev/null grep echo $(pwd) -eu local
+	2>/dev/null $(pwd) "$1" 'quoted text'
+echo --verbose "$@" done
+	local x=1 done test 'quoted text' echo echo 'quoted text' cd export "$1" grep
+	2>/dev/null sed --verbose -eu "$@" "$@" | 2>/dev/null 'quoted text' sed "$@"
+	${HOME} x=1 done grep && printf
+printf readonly "$@" local grep grep printf 2>/dev/null
+		${HOME} local | 'quoted text'
+		export cd awk then && 'quoted text' sed 'quoted text' awk $(pwd) 'quoted text'
+"$@" ${HOME} && readonly x=1 ${HOME} local grep cd
+		local -eu awk -eu 2>/dev/null echo
+		| "$@" sed then echo $(pwd) -eu --verbose "$1" -eu then "$1" &&
+2>/dev/null grep "$1" | /usr/bin x=1 done
+/usr/bin readonly done /usr/bin then ${HOME}
+export 2>/dev/null x=1 | local export 'quoted text' sed 2>/dev/null
+x=1 | awk export | -eu -eu && awk -eu readonly "$@" -eu
+		'quoted text' $(pwd) | done --verbose x=1 then local ${HOME}
+		-eu grep | | test test done grep printf x=1 $(pwd)
+	/usr/bin local awk "$1" done | "$@" local --verbose /usr/bin 2>/dev/null
+sed 'quoted text' done echo done ${HOME}
+		export 'quoted text' test then | awk grep "$@" && cd
+x=1 cd ${HOME} export done x=1 x=1 done then done local echo 'quoted text' "$1"
+x=1 local awk $(pwd) "$@"
+		sed 'quoted text' done x=1 | readonly echo local readonly "$1"
+then awk x=1 'quoted text' 2>/dev/null /usr/bin
+printf done -eu awk grep --verbose printf then 2>/dev/null 2>/dev/null done
+		2>/dev/null ${HOME} -eu test
+		/usr/bin $(pwd) x=1 readonly sed 'quoted text' local $(pwd) grep
+	grep cd 2>/dev/null /usr/bin test "$@" 2>/dev/null 2>/dev/null -eu | && 2>/dev/null
+	x=1 cd echo awk | && sed echo -eu local x=1 test cd -eu sed /usr/bin
+	-eu export "$@" test x=1 "$1" | /usr/bin "$1" 'quoted text'
+		&& /usr/bin printf cd done test ${HOME} && "$1" x=1 echo --verbose
+	$(pwd) -eu "$@" echo printf echo 2>/dev/null cd "$@"
+	cd ${HOME} $(pwd) export && -eu
+		cd 2>/dev/null x=1 --verbose cd export done -eu "$@"
+	-eu /usr/bin -eu local /usr/bin /usr/bin awk /usr/bin
+test done readonly done "$@" && awk -eu awk 'quoted text' readonly
+		then local printf printf readonly --verbose 2>/dev/null -eu
+		"$@" -eu -eu ${HOME} -eu grep 2>/dev/null sed ${HOME} 2>/dev/null local
+		export grep $(pwd) | grep /usr/bin 2>/dev/null awk /usr/bin "$1" -eu "$@"
+		&& $(pwd) done $(pwd) readonly done sed local test echo grep sed /usr/bin
+		echo readonly local x=1 echo | readonly 'quoted text' printf
+"$1" /usr/bin readonly echo awk "$@" test
+		x=1 && done local then awk awk "$@" && /usr/bin grep cd x=1 done -eu grep
+printf | | then done awk done --verbose cd "$1" | awk 'quoted text' | test test
+		&& done done printf then $(pwd) && ${HOME} /usr/bin echo
+	cd echo /usr/bin local -eu | sed then
+2>/dev/null "$1" ${HOME} export
+		readonly | "$@" --verbose
+		awk printf awk && done --verbose then | $(pwd) cd grep local
+	readonly "$1" x=1 local local test "$1" --verbose /usr/bin "$@" "$1" awk then
+	then 'quoted text' "$1" x=1 readonly &&
+	| -eu $(pwd) 'quoted text' /usr/bin sed then export -eu | --verbose
+2>/dev/null 'quoted text' ${HOME}
+	printf test 'quoted text' printf --verbose printf 'quoted text' ${HOME} then
+		2>/dev/null test "$1" 'quoted text' 'quoted text' /usr/bin ${HOME}
+		&& grep readonly /usr/bin ${HOME} echo "$1" && test test $(pwd) ${HOME} &&
+		${HOME} $(pwd) $(pwd) awk readonly awk "$1" -eu x=1 awk grep printf
+	/usr/bin sed export ${HOME}
+${HOME} then done && $(pwd) && $(pwd) readonly 'quoted text'
+	awk && grep local sed x=1 "$@"
+		awk --verbose && test "$@" --verbose grep
+		done export "$@" printf export then | 'quoted text' --verbose export
+		$(pwd) ${HOME} | local local ${HOME} /usr/bin | --verbose echo -eu grep then
+sed cd printf export --verbose $(pwd) 2>/dev/null && export "$1"
+		sed echo -eu sed $(pwd) test -eu sed then
+${HOME} $(pwd) printf export
+--verbose $(pwd) cd 'quoted text'
+	&& readonly local "$@" printf x=1 sed "$1" test $(pwd)
+echo 2>/dev/null echo export "$@" export printf "$1" awk "$@" cd test | export
+local "$1" test cd --verbose printf "$@" echo 'quoted text' "$@" grep ${HOME} printf
+export | "$@" ${HOME} && ${HOME} "$1" &&
+	cd $(pwd) x=1 echo local done -eu 2>/dev/null
+	test export 2>/dev/null /usr/bin /usr/bin cd test cd echo "$1" local
+printf && cd 'quoted text' done $(pwd) sed
+	2>/dev/null export test "$1"
+	then local printf echo local 2>/dev/null printf 2>/dev/null cd done readonly
+test test printf ${HOME} done
+		"$1" 2>/dev/null && 'quoted text'
+		then export then grep export 2>/dev/null echo 2>/dev/null cd --verbose
+	grep cd local export readonly echo readonly
+test "$1" grep && printf then &&
+		&& | 2>/dev/null | ${HOME} /usr/bin x=1 cd test /usr/bin
+		${HOME} echo 'quoted text' $(pwd) export
+		echo export sed /usr/bin -eu
+sed | local echo -eu 2>/dev/null readonly grep x=1 printf
+test | 2>/dev/null grep /usr/bin ${HOME} sed
+	--verbose $(pwd) cd awk local "$1" -eu grep -eu $(pwd) test -eu
+		local "$1" | done local grep $(pwd) $(pwd) sed awk && "$1" "$1"
+		printf "$1" x=1 awk local then ${HOME} grep
+		readonly -eu test done test 2>/dev/null
+	x=1 awk /usr/bin done
+	&& test then sed --verbose
+	-eu then sed grep echo done
+"$1" echo 2>/dev/null local -eu
+echo -eu awk --verbose readonly --verbose
+		$(pwd) && printf awk export x=1 sed "$@" 'quoted text'
+	local done sed 'quoted text' "$1" export done
+| grep printf grep local echo x=1 cd export readonly echo 2>/dev/null
+	sed && /usr/bin && | echo awk
+printf && cd readonly $(pwd) test && -eu awk "$@" $(pwd) grep readonly
+		local ${HOME} "$1" "$@" printf awk 2>/dev/null x=1 | cd -eu "$1" x=1 local
+awk /usr/bin && local grep 2>/dev/null --verbose 'quoted text'
+		sed --verbose /usr/bin sed 2>/dev/null 'quoted text' 'quoted text'
+		--verbose "$@" readonly --verbose "$1" awk readonly cd test awk
+	then grep grep $(pwd) ${HOME} test "$1" readonly "$@"
+		grep "$@" | local && $(pwd) 2>/dev/null
+readonly 'quoted text' && "$1" cd sed
+	readonly "$@" $(pwd) 2>/dev/null export
+		echo then 2>/dev/null local echo test printf
+		export && done $(pwd) grep
+		sed sed --verbose echo /usr/bin x=1
+sed grep echo cd $(pwd) && | --verbose
+	printf echo echo x=1 $(pwd) grep --verbose 'quoted text'
+		x=1 "$1" -eu --verbose 'quoted text'
+		readonly export done "$@" awk printf /usr/bin echo grep | sed 'quoted text' test
+	"$1" 'quoted text' test printf && grep grep ${HOME} cd /usr/bin echo
+echo readonly | awk awk awk test printf 2>/dev/null && done
+	/usr/bin | "$@" -eu cd 'quoted text'
+	/usr/bin -eu && grep | "$1" "$@" 'quoted text' done readonly
+		then && --verbose "$1" x=1 "$1" 'quoted text' echo printf
+	echo local /usr/bin x=1 printf 2>/dev/null "$@" x=1 ${HOME} -eu grep echo 2>/dev/null
+	2>/dev/null /usr/bin ${HOME} "$@" test done
+echo /usr/bin "$@" 'quoted text'
+	x=1 && ${HOME} -eu awk
+		sed /usr/bin test && "$@" x=1 grep then
+done -eu --verbose test | export $(pwd) "$@" "$1" x=1 'quoted text' local 2>/dev/null
+x=1 && echo grep x=1 | cd echo --verbose
+x=1 readonly | x=1 export
+2>/dev/null sed -eu printf cd then -eu printf
+	readonly /usr/bin -eu 2>/dev/null "$1" x=1 then x=1 -eu | 'quoted text' ${HOME}
+		local 2>/dev/null x=1 /usr/bin 2>/dev/null
+	local "$1" sed "$1" export
+-eu readonly "$@" $(pwd) printf -eu && --verbose 'quoted text'
+		"$1" /usr/bin done grep | --verbose x=1 'quoted text' test grep readonly
+x=1 grep cd "$@" 'quoted text' ${HOME} cd
+		done awk --verbose done && printf echo "$@" cd ${HOME} echo
+	echo x=1 test then 2>/dev/null 'quoted text'
+		grep printf readonly done "$@" -eu "$1" ${HOME} echo "$@" "$1" then sed && awk
+	| 2>/dev/null 2>/dev/null
+sed cd x=1 then cd grep test -eu cd | cd ${HOME} echo test
+		awk grep ${HOME} local -eu 'quoted text' test -eu "$1" x=1 sed local
+	then "$@" done local export "$@" sed test
+		test "$@" ${HOME} then "$@" $(pwd)
+	test cd | sed local x=1 sed x=1 echo echo awk sed x=1 --verbose --verbose
+		--verbose sed /usr/bin ${HOME} sed "$1" local then echo printf
+	echo "$1" ${HOME} --verbose readonly test
+	sed readonly awk sed sed | x=1
+then "$1" then local then $(pwd)
+	x=1 grep --verbose test && "$@"
+then ${HOME} done ${HOME} cd && /usr/bin echo
+		done cd -eu "$1" | sed -eu -eu export | --verbose readonly cd
+	grep /usr/bin ${HOME} local | "$@" grep 2>/dev/null then then "$1"
+		grep export done "$@" | x=1 && | sed | 'quoted text' x=1 echo 2>/dev/null 2>/dev/null
+awk /usr/bin "$@" ${HOME} local local then local | && x=1 sed printf local
+2>/dev/null -eu && done local 2>/dev/null awk grep /usr/bin
+	local grep then 'quoted text' grep /usr/bin printf "$@"
+	readonly then 2>/dev/null x=1 sed | readonly echo grep "$1" readonly
+	done readonly 'quoted text' readonly printf && ${HOME} "$@" ${HOME} done ${HOME}
+cd local printf readonly echo -eu
+| "$1" --verbose readonly -eu $(pwd) test $(pwd) local x=1 "$1" cd -eu
+		grep x=1 grep x=1 test && sed x=1 done $(pwd) local --verbose grep x=1 awk
+cd echo --verbose 2>/dev/null printf $(pwd) grep "$@" x=1 done /usr/bin
+awk /usr/bin done sed | x=1 ${HOME} 2>/dev/null | export
+echo x=1 awk echo --verbose awk grep readonly local 'quoted text' grep echo 2>/dev/null
+'quoted text' "$1" -eu export cd printf 'quoted text'
+x=1 | /usr/bin echo | "$@" awk export cd readonly 'quoted text' 2>/dev/null "$1"
+		echo readonly sed ${HOME} sed test export
+		-eu printf | ${HOME} grep ${HOME} echo ${HOME} "$1" x=1 | --verbose export
+		readonly done grep x=1 echo -eu -eu cd && sed sed
+		x=1 | then 2>/dev/null sed local --verbose "$1" local "$@" x=1 "$1"
+export echo && 'quoted text' $(pwd) awk ${HOME}
+awk | ${HOME} 'quoted text' echo 2>/dev/null
+		&& -eu readonly grep && "$1" x=1 local readonly 2>/dev/null -eu echo /usr/bin
+cd x=1 done 2>/dev/null 'quoted text' done export readonly done awk echo done sed
+	--verbose awk --verbose awk --verbose $(pwd) --verbose local $(pwd)
+printf --verbose export 'quoted text'
+2>/dev/null done readonly done sed | "$@" -eu
+	then 2>/dev/null -eu 2>/dev/null local local echo printf "$1"
+	local "$1" sed grep -eu --verbose sed 'quoted text' --verbose sed
+		"$1" && "$@" "$1" && done "$@" x=1 --verbose cd $(pwd)
+		/usr/bin 'quoted text' | printf -eu "$1" &&
+sed export cd --verbose
+		test --verbose awk 2>/dev/null
+	echo --verbose | -eu cd 2>/dev/null grep 2>/dev/null
+		| $(pwd) printf printf done 'quoted text' local readonly -eu printf
+	$(pwd) test && ${HOME} readonly awk done awk test cd sed cd test x=1 /usr/bin
+		local cd x=1 'quoted text' then x=1 x=1 printf -eu cd grep x=1 2>/dev/null
+${HOME} then test local then "$1" "$@" echo x=1 x=1 printf awk readonly
+	test done x=1 && && sed --verbose
+	"$@" then --verbose x=1 -eu ${HOME}
+	/usr/bin -eu x=1 local --verbose | /usr/bin
+		x=1 "$1" ${HOME} /usr/bin printf --verbose export sed export
+	/usr/bin -eu test printf
+		done echo "$1" printf /usr/bin --verbose
+printf readonly --verbose done echo | 2>/dev/null 2>/dev/null ${HOME}
+		cd "$@" printf "$@" test /usr/bin readonly printf
+		awk export awk sed printf sed done x=1 echo -eu cd printf readonly
+		${HOME} local --verbose $(pwd) then -eu /usr/bin "$@"
+then x=1 ${HOME} sed export readonly grep export
+		"$1" $(pwd) then x=1 "$@" then "$1" awk "$1"
+local grep x=1 grep x=1 -eu x=1 'quoted text' then -eu
+sed -eu 'quoted text' test 2>/dev/null done cd | echo | -eu grep 2>/dev/null
+'quoted text' grep printf cd echo x=1 printf export then --verbose x=1 'quoted text'
+	"$@" 2>/dev/null "$@" "$1" /usr/bin x=1 readonly echo printf /usr/bin /usr/bin
+awk awk "$1" awk awk done
+		x=1 test done grep "$1" -eu "$@" ${HOME} /usr/bin sed && test sed -eu
+'quoted text' cd printf ${HOME} readonly x=1 ${HOME} grep
+test echo cd echo echo x=1 awk test && cd -eu 'quoted text'
+		test export 'quoted text' grep echo echo export && "$@" $(pwd) "$1" readonly awk
+		/usr/bin echo $(pwd) /usr/bin 2>/dev/null cd printf 'quoted text' -eu "$1" /usr/bin
+		$(pwd) readonly ${HOME} done && awk "$1" test done sed grep
+		printf -eu then grep "$1" x=1 | echo echo ${HOME} 2>/dev/null
+		printf ${HOME} then printf 'quoted text' local /usr/bin
+grep done "$1" done cd then readonly grep && | done ${HOME}
+&& | && printf export -eu --verbose readonly x=1 --verbose
+'quoted text' awk 'quoted text'
+	/usr/bin /usr/bin test printf echo x=1 /usr/bin
+	sed 'quoted text' 'quoted text' then "$@"
+cd cd cd echo "$@" ${HOME} awk /usr/bin ${HOME}
+		${HOME} export local | 2>/dev/null 'quoted text' grep printf readonly
+${HOME} echo && done local
+		-eu done awk "$1" grep 2>/dev/null done readonly done
+		export cd awk | 'quoted text' test && local then ${HOME} "$1" test then printf
+		printf readonly awk test sed /usr/bin readonly 2>/dev/null then | 2>/dev/null
+awk --verbose test local "$1" x=1 export then readonly $(pwd) x=1 | -eu /usr/bin
+| 'quoted text' export sed 2>/dev/null then readonly export
+export --verbose -eu 2>/dev/null "$@" test readonly cd -eu -eu
+	done "$1" grep then | sed 2>/dev/null
+		test -eu sed printf readonly && ${HOME}
+printf done "$1" readonly /usr/bin test grep
+grep --verbose export cd 2>/dev/null -eu "$@" x=1 "$1"
+	local && "$@" then local | printf ${HOME} sed
+"$@" grep echo test 2>/dev/null grep test 2>/dev/null echo -eu x=1
+"$@" echo "$@" 2>/dev/null
+"$1" 'quoted text' local
+done readonly "$1" then printf
+sed grep sed | grep /usr/bin /usr/bin "$@" readonly
@@ -0,0 +1,2001 @@
+2>/dev/null x=1 -eu ${HOME} done --verbose && local done 2>/dev/null then cd
+printf $(pwd) && cd awk /usr/bin echo | "$1" -eu 2>/dev/null
+		grep $(pwd) grep local export "$1" sed 2>/dev/null x=1 x=1 printf grep -eu
+	done ${HOME} -eu local local
+	local readonly "$1" 2>/dev/null /usr/bin "$@" local --verbose local readonly
+&& local echo ${HOME} echo then
+then cd $(pwd) x=1 done --verbose then then "$1" sed "$@" x=1 sed
+		local /usr/bin -eu ${HOME} export printf
+	$(pwd) --verbose 'quoted text'
+then test 'quoted text' "$@" cd && awk ${HOME} grep x=1 ${HOME} ${HOME} test test
+awk "$@" $(pwd) /usr/bin done
+	readonly "$1" awk printf 'quoted text' 2>/dev/null then && "$@" -eu sed |
+		then ${HOME} then awk
+		cd sed && x=1 done done
+	/usr/bin -eu export "$@" printf readonly x=1 awk 2>/dev/null cd "$1" printf
+local readonly --verbose "$@" "$@" sed then echo
+test && done "$@" grep
+test then then 2>/dev/null sed export --verbose done echo printf
+	local 'quoted text' local 'quoted text' && $(pwd) export
+export sed ${HOME} -eu
+grep 2>/dev/null && echo
+		test export sed -eu then cd readonly "$@" -eu -eu local "$@" local "$@"
+	test --verbose grep awk ${HOME} cd sed $(pwd) && local grep grep
+	done sed printf awk 'quoted text' echo echo grep
+	local export printf 2>/dev/null /usr/bin test "$1" -eu echo grep | test readonly
+grep 2>/dev/null "$1" x=1 sed "$@" $(pwd) readonly
+${HOME} x=1 -eu --verbose cd local "$1" -eu -eu "$@"
+		| awk | "$@" && then $(pwd) x=1 grep grep echo
+	then grep -eu 2>/dev/null test awk done /usr/bin grep ${HOME} --verbose
+		readonly local local local echo echo local /usr/bin "$@" x=1
+local sed grep then then /usr/bin
+grep cd "$1" readonly ${HOME} printf $(pwd) export $(pwd) | sed cd then | "$1" 'quoted text'
+		2>/dev/null | local | "$@" then -eu export /usr/bin ${HOME}
+		echo readonly printf /usr/bin 2>/dev/null && "$@" ${HOME} x=1 ${HOME}
+		test $(pwd) printf 2>/dev/null --verbose test 'quoted text' 'quoted text' sed readonly
+		"$1" test ${HOME} grep --verbose && done grep
+export cd | -eu "$1" test local "$1" $(pwd) x=1 2>/dev/null && /usr/bin echo
+export $(pwd) then -eu sed readonly done x=1 test sed export echo
+		echo ${HOME} --verbose
+	local /usr/bin 2>/dev/null export echo &&
+	2>/dev/null -eu export -eu ${HOME} cd export cd
+	cd ${HOME} "$@" then 2>/dev/null cd --verbose readonly ${HOME} awk grep ${HOME}
+		$(pwd) sed && then -eu "$1" readonly test local grep local grep
+		grep local 2>/dev/null then local
+2>/dev/null | && x=1 /usr/bin
+		'quoted text' 2>/dev/null && ${HOME} x=1 "$@"
+| $(pwd) 'quoted text' test 'quoted text' echo
+		/usr/bin $(pwd) local test -eu test test
+		awk "$1" then x=1 echo --verbose cd | && | 2>/dev/null x=1 /usr/bin -eu
+	2>/dev/null --verbose $(pwd) readonly -eu awk sed "$@" ${HOME} awk
+'quoted text' $(pwd) echo ${HOME} x=1 | cd
+		| $(pwd) cd $(pwd) readonly && done sed 2>/dev/null "$@" "$@" printf
+"$@" | /usr/bin ${HOME} grep readonly
+		"$1" ${HOME} cd sed "$1" | grep | 'quoted text'
+		&& /usr/bin "$1" -eu test then cd && ${HOME} local then printf
+		| ${HOME} $(pwd) readonly printf /usr/bin sed $(pwd) readonly sed echo awk
+	$(pwd) grep /usr/bin local then export sed grep awk ${HOME} awk sed echo
+done "$@" 'quoted text' sed local
+		x=1 echo /usr/bin --verbose local x=1 sed | sed test grep cd test
+	export test done $(pwd) x=1 awk export
+		test | --verbose cd echo 'quoted text' "$@" && /usr/bin export x=1 /usr/bin
+"$1" | /usr/bin local sed -eu echo local /usr/bin | "$1" 2>/dev/null echo echo readonly
+-eu 2>/dev/null ${HOME} printf $(pwd) x=1 local test export --verbose echo done
+	--verbose 'quoted text' $(pwd) 'quoted text' 2>/dev/null
+$(pwd) --verbose sed test /usr/bin 'quoted text' && /usr/bin 2>/dev/null
+	/usr/bin test --verbose printf local -eu
+grep /usr/bin /usr/bin x=1
+		grep 'quoted text' /usr/bin ${HOME} sed
+		awk ${HOME} $(pwd) sed -eu
+		${HOME} awk echo && done "$@" grep x=1 test local -eu done
+		export printf echo grep echo grep -eu "$@" export
+		grep local grep && local echo printf printf "$@" readonly readonly
+x=1 cd cd x=1 awk && ${HOME}
+'quoted text' local ${HOME} sed x=1 then x=1 printf 2>/dev/null x=1 export cd
+		/usr/bin 'quoted text' x=1 done --verbose --verbose export test
+"$@" then | 2>/dev/null echo sed readonly cd && -eu
+		readonly sed "$@" export x=1 test
+	--verbose "$1" readonly test cd -eu done && 'quoted text'
+		'quoted text' echo done printf 2>/dev/null readonly
+	test then 'quoted text' export | readonly grep ${HOME} cd "$@" $(pwd) ${HOME}
+readonly local $(pwd) sed done
+		sed && "$1" x=1 then x=1 echo -eu
+"$@" cd readonly 2>/dev/null -eu | then ${HOME} then --verbose /usr/bin
+	&& 'quoted text' x=1 printf 2>/dev/null
+		test grep --verbose awk | cd export 2>/dev/null readonly $(pwd) /usr/bin local
+"$1" | export 2>/dev/null ${HOME} done sed /usr/bin export $(pwd)
+	done "$1" cd readonly local test -eu $(pwd) "$@" | printf
+		export local ${HOME} 'quoted text' awk ${HOME}
+	x=1 cd x=1 export ${HOME} -eu --verbose "$@" cd "$1" readonly x=1 /usr/bin
+		then cd cd grep -eu ${HOME}
+		$(pwd) x=1 2>/dev/null echo 'quoted text'
+		2>/dev/null export 2>/dev/null echo /usr/bin cd printf grep export test then
+	awk done test /usr/bin 2>/dev/null ${HOME} 'quoted text' readonly
+	| cd ${HOME} | grep x=1 printf
+		--verbose then 2>/dev/null --verbose then awk awk test awk then readonly --verbose
+	then ${HOME} then sed awk | -eu awk export test then grep readonly
+echo 2>/dev/null readonly ${HOME} awk cd awk
+	then awk export cd test 2>/dev/null local awk
+	done | local sed awk readonly 'quoted text' --verbose test awk cd --verbose
+"$1" 2>/dev/null ${HOME} x=1 2>/dev/null
+		export ${HOME} 'quoted text'
+		readonly grep -eu echo awk | sed awk $(pwd) -eu && --verbose
+		sed | 'quoted text' export "$@" $(pwd) local
+		x=1 readonly /usr/bin 2>/dev/null
+-eu export $(pwd) "$@" printf cd 2>/dev/null ${HOME} "$1" test done
+local $(pwd) local then grep
+local $(pwd) done ${HOME} then ${HOME}
+awk "$@" sed 'quoted text' done x=1 done printf --verbose test
+/usr/bin cd | ${HOME} readonly x=1
+		x=1 "$@" local $(pwd) $(pwd)
+		2>/dev/null readonly $(pwd) $(pwd) "$1" grep | cd grep local then /usr/bin ${HOME}
+local local test $(pwd) --verbose "$@" echo readonly sed export
+	readonly 'quoted text' export /usr/bin export cd /usr/bin 2>/dev/null
+		printf $(pwd) x=1 export local cd /usr/bin echo then $(pwd)
+local "$@" export -eu 2>/dev/null /usr/bin "$@" cd "$@" 2>/dev/null sed 'quoted text'
+printf sed -eu /usr/bin | local /usr/bin done "$@"
+		"$1" then export | "$1" sed 'quoted text' sed "$@" | echo "$1" sed echo 'quoted text'
+| -eu sed export --verbose | echo "$@" $(pwd) export
+	--verbose 'quoted text'
+	2>/dev/null local readonly printf -eu printf $(pwd)
+'quoted text' "$1" "$@" sed then cd echo sed | then
+		$(pwd) local printf --verbose "$1" export 'quoted text'
+		local readonly "$@" "$1" then /usr/bin
+	readonly ${HOME} /usr/bin -eu 2>/dev/null sed cd cd local 'quoted text'
+${HOME} /usr/bin readonly | sed ${HOME}
+		'quoted text' test local $(pwd) "$@" 'quoted text' export $(pwd) -eu x=1
+-eu grep 2>/dev/null sed awk sed x=1 ${HOME} grep export export sed -eu &&
+		"$1" && done && awk 'quoted text' cd && 2>/dev/null
+x=1 cd | ${HOME} --verbose
+		then /usr/bin sed && export "$1" then "$@" local done test /usr/bin
+--verbose 2>/dev/null test printf && then sed "$1" readonly
+sed x=1 cd && "$@" "$@" export awk sed /usr/bin then awk $(pwd) done cd test echo
+	/usr/bin ${HOME} && test readonly cd test test echo x=1 "$1" $(pwd) readonly "$1"
+	x=1 done x=1 x=1 ${HOME} | export printf awk sed
+local | $(pwd) readonly -eu /usr/bin "$@" cd done then "$@" "$@" | x=1 x=1 local
+		x=1 | "$@" "$@" awk -eu "$1" | grep then printf test && local
+		done 2>/dev/null readonly -eu export sed local "$@" test "$@"
+then readonly 2>/dev/null sed printf done export "$1" then
+printf test "$@" --verbose x=1 then x=1 'quoted text' |
+done | awk test -eu test then 2>/dev/null
+"$1" x=1 sed $(pwd) test
+	done -eu printf then then grep $(pwd) "$1" && cd export
+	grep grep && cd printf export test sed "$1" /usr/bin
+	echo grep readonly 2>/dev/null awk && test awk 2>/dev/null
+		grep grep test | --verbose "$@" 2>/dev/null && 'quoted text'
+'quoted text' && x=1 then
+	"$1" printf test -eu /usr/bin -eu --verbose $(pwd) grep readonly
+	export "$1" --verbose echo then cd local awk test export x=1 "$@" "$1"
+	-eu "$@" $(pwd) "$@" x=1 x=1 export export 2>/dev/null /usr/bin
+	"$@" grep --verbose | /usr/bin $(pwd)
+		test sed -eu test sed ${HOME} echo "$@" -eu $(pwd) 'quoted text' awk export
+	"$1" awk ${HOME} /usr/bin sed && export -eu -eu
+	-eu "$1" sed 'quoted text' | --verbose 'quoted text'
+&& then 2>/dev/null && then local "$1" x=1 printf ${HOME} grep | "$1" -eu
+done $(pwd) && printf cd && && sed
+		2>/dev/null sed awk /usr/bin ${HOME} /usr/bin $(pwd) printf
+	sed ${HOME} /usr/bin printf export -eu
+	awk /usr/bin awk /usr/bin
+		readonly printf 'quoted text' && export x=1 export readonly "$@" 2>/dev/null
+	'quoted text' /usr/bin test cd "$1" cd ${HOME}
+	-eu export sed "$1" "$@" $(pwd) "$@" -eu /usr/bin
+		export done then local local $(pwd) 'quoted text'
+	grep awk printf awk grep ${HOME} echo local -eu ${HOME}
+"$1" --verbose | done 2>/dev/null printf
+	"$1" test readonly | x=1 "$@" readonly x=1 cd then then echo local "$@"
+	&& echo readonly $(pwd) echo "$@" printf printf readonly test printf -eu
+	-eu x=1 x=1 "$@" echo -eu
+$(pwd) awk "$@" test $(pwd) $(pwd) readonly -eu awk "$1" -eu echo echo
+/usr/bin "$@" awk 2>/dev/null | ${HOME}
+		"$@" done $(pwd) x=1 done cd done cd then 'quoted text'
+sed export | x=1 $(pwd) -eu printf $(pwd) test export /usr/bin 'quoted text' "$1"
+	printf $(pwd) test -eu "$@" echo "$1" 2>/dev/null sed printf awk
+	awk "$1" then --verbose grep 'quoted text' 2>/dev/null ${HOME} "$@" awk
+		--verbose -eu local x=1 done export && export | then $(pwd) then 'quoted text'
+readonly 2>/dev/null done sed export x=1 x=1 awk echo echo then
+	printf 2>/dev/null export
+done printf --verbose
+	grep -eu $(pwd) then printf test x=1 grep done
+		test grep -eu "$1" readonly $(pwd) grep test
+local readonly -eu $(pwd) 'quoted text' && printf then awk "$1" 2>/dev/null
+		"$1" /usr/bin sed "$1" printf readonly | cd printf
+readonly local sed /usr/bin && 2>/dev/null
+	cd export "$@" sed done | local ${HOME} --verbose
+local cd $(pwd) sed ${HOME} x=1 /usr/bin /usr/bin cd local 'quoted text' cd
+		2>/dev/null 'quoted text' && grep export awk 2>/dev/null ${HOME} then && x=1
+		printf | then ${HOME} --verbose 'quoted text' readonly ${HOME} "$1" test
+done test readonly grep export 2>/dev/null printf $(pwd) export
+$(pwd) -eu | --verbose
+	-eu done grep --verbose ${HOME} && "$@" sed readonly
+${HOME} local grep /usr/bin export "$1" --verbose
+	&& 2>/dev/null "$@" export done sed cd $(pwd) --verbose
+2>/dev/null 2>/dev/null 2>/dev/null readonly /usr/bin "$@" then "$1" "$1" |
+		local && "$1" 2>/dev/null grep
+	local $(pwd) | readonly done
+		&& grep x=1 | "$1" && export 'quoted text'
+	2>/dev/null printf 2>/dev/null done sed readonly
+	${HOME} grep test "$1" export x=1 -eu
+		"$@" printf /usr/bin awk -eu readonly printf
+		export printf ${HOME} && ${HOME}
+awk x=1 sed then "$1" 2>/dev/null x=1 /usr/bin /usr/bin echo
+&& 2>/dev/null done ${HOME}
+--verbose done echo "$@" 2>/dev/null x=1 --verbose grep $(pwd) readonly
+	readonly 2>/dev/null cd $(pwd) --verbose test cd "$@" cd printf /usr/bin
+	"$@" sed /usr/bin local ${HOME}
+		"$1" sed done local x=1 | awk -eu x=1 printf local
+		readonly readonly ${HOME}
+		echo then export ${HOME} 2>/dev/null
+	test local done x=1 --verbose x=1 --verbose
+	readonly 'quoted text' sed export local ${HOME} &&
+	"$@" && printf awk /usr/bin | echo ${HOME} then
+		test "$1" 'quoted text' grep /usr/bin /usr/bin -eu sed printf --verbose
+	printf test 2>/dev/null 'quoted text' done local echo awk sed "$@" 2>/dev/null
+		done | then grep "$1" ${HOME} sed 'quoted text' $(pwd) printf done
+		${HOME} -eu ${HOME} done sed local ${HOME} printf printf
+	x=1 /usr/bin grep local | 2>/dev/null "$@" | export
+	awk -eu then printf echo /usr/bin local then "$1" export awk -eu
+		then printf test 'quoted text'
+"$1" -eu $(pwd) then "$1" cd 2>/dev/null
+	awk --verbose echo ${HOME} 'quoted text' grep
+		/usr/bin 'quoted text'
+		"$1" | export printf 'quoted text'
+	2>/dev/null x=1 test local "$1" 'quoted text'
+		awk grep /usr/bin | sed x=1 export readonly
+/usr/bin --verbose x=1 2>/dev/null ${HOME} && readonly /usr/bin $(pwd)
+grep x=1 | done awk sed export | 'quoted text' /usr/bin
+		grep then printf "$1" awk grep sed && --verbose | done export
+cd --verbose done 'quoted text'
+		${HOME} 2>/dev/null $(pwd) && test "$1" 'quoted text'
+		sed ${HOME} echo awk sed --verbose done export
+	| awk done readonly cd echo done test export $(pwd)
+		readonly done readonly then done echo "$@" &&
+	local --verbose --verbose 2>/dev/null awk
+cd | --verbose then x=1 cd
+	&& -eu printf grep test "$@" ${HOME} && | &&
+		cd -eu 2>/dev/null ${HOME} | readonly
+	/usr/bin test done "$1" $(pwd) --verbose 'quoted text' local done 2>/dev/null
+printf -eu "$@" sed -eu test awk test $(pwd) printf
+		cd awk --verbose | $(pwd) $(pwd) awk readonly
+awk x=1 echo "$1" /usr/bin grep
+then | printf then cd "$@" test /usr/bin cd awk awk ${HOME} done printf
+		awk "$1" cd 'quoted text' && "$1"
+		$(pwd) 'quoted text' test
+	&& then 2>/dev/null cd 'quoted text' local && | "$1"
+		/usr/bin "$@" --verbose test 'quoted text' ${HOME} local | export cd ${HOME}
+/usr/bin /usr/bin sed
+	awk printf then 'quoted text' 2>/dev/null sed printf /usr/bin readonly grep local
+then ${HOME} test awk echo ${HOME}
+	/usr/bin 2>/dev/null 'quoted text' export grep test $(pwd) "$@" export ${HOME}
+	$(pwd) ${HOME} grep cd &&
+	${HOME} --verbose then --verbose awk cd ${HOME} "$@" "$1" $(pwd) local readonly
+		grep /usr/bin "$@" "$@" printf
+"$1" --verbose printf --verbose echo readonly local && cd
+	readonly -eu 'quoted text'
+export "$@" printf export readonly sed test && then "$1" 2>/dev/null 2>/dev/null
+'quoted text' awk 2>/dev/null $(pwd) export cd --verbose $(pwd) -eu ${HOME}
+	readonly | local export ${HOME} sed 'quoted text'
+		"$1" done awk 2>/dev/null sed local done x=1 done ${HOME} --verbose 2>/dev/null
+done -eu export echo then test && $(pwd) x=1 && printf && done test awk "$@" readonly
+		2>/dev/null 'quoted text'
+	x=1 echo sed grep $(pwd) $(pwd) "$1" awk $(pwd) echo "$1" printf | 2>/dev/null
+		${HOME} done --verbose then && $(pwd) -eu "$1"
+		| echo export && --verbose echo readonly
+	'quoted text' /usr/bin
+		/usr/bin test "$1" --verbose echo done readonly local | 2>/dev/null
+	/usr/bin awk cd cd --verbose awk sed && printf sed printf local echo 2>/dev/null
+then "$1" $(pwd) export then done
+x=1 local echo --verbose $(pwd) 2>/dev/null
+"$1" readonly awk | | grep awk local
+	-eu readonly ${HOME} echo /usr/bin done done --verbose grep done then $(pwd)
+then x=1 then echo export |
+		cd 'quoted text' x=1 "$@" ${HOME} "$1" test x=1 $(pwd) /usr/bin readonly export
+printf grep done "$1" ${HOME} && 'quoted text' && | "$@" && grep
+-eu -eu export echo sed "$1" x=1 awk then ${HOME} 'quoted text' "$1" && -eu
+2>/dev/null | done then "$1" x=1 echo cd test | "$1"
+	awk local --verbose done | cd "$1" -eu x=1 done done -eu test awk x=1 readonly export
+	echo 'quoted text' 2>/dev/null x=1 printf
+"$@" /usr/bin "$@" 2>/dev/null test awk "$1" export local -eu | sed sed | -eu ${HOME}
+then x=1 local sed cd -eu "$1" --verbose cd readonly
+		then -eu -eu done grep done x=1 local 'quoted text' ${HOME} -eu
+	cd then printf echo --verbose "$@" test -eu ${HOME} then "$1" test echo
+	"$1" -eu done ${HOME} awk cd && sed $(pwd) $(pwd) local echo
+awk export "$@" printf readonly done && 'quoted text' 2>/dev/null
+then /usr/bin then /usr/bin
+readonly then "$@" then awk printf cd sed -eu "$@" done echo cd test ${HOME} done
+	x=1 x=1 /usr/bin grep sed 2>/dev/null "$@" -eu 2>/dev/null && 'quoted text'
+		| 'quoted text' --verbose done printf printf
+echo local "$@" local test test readonly
+	'quoted text' "$@" export test readonly
+	then && test x=1 -eu "$1" "$1" export 2>/dev/null echo test
+		$(pwd) export cd grep 'quoted text' sed then | done awk 'quoted text'
+		then "$@" printf 'quoted text'
+"$1" "$@" 'quoted text' then awk then -eu && test
+done readonly printf local
+	"$@" test echo "$@" 2>/dev/null then 2>/dev/null readonly "$1"
+		echo echo "$@" 'quoted text' | local "$1" /usr/bin
+	readonly then "$@" echo $(pwd) done then 2>/dev/null && awk ${HOME} echo
+export local echo -eu awk 'quoted text' grep --verbose
+		&& && "$1" x=1 cd then 'quoted text' echo "$@" --verbose
+&& export 2>/dev/null echo local "$@" grep $(pwd)
+		test then readonly "$1" 'quoted text' grep | cd ${HOME} echo "$@" 'quoted text'
+	printf --verbose "$1" /usr/bin awk x=1 local x=1 -eu readonly grep
+	--verbose sed "$@" ${HOME} $(pwd) -eu 2>/dev/null awk grep
+		export | --verbose --verbose sed printf
+echo echo -eu | readonly "$@" sed /usr/bin ${HOME} grep readonly
+		$(pwd) test | sed grep "$@" local
+		--verbose -eu 2>/dev/null then ${HOME} then | awk grep "$1" export
+	'quoted text' cd $(pwd) x=1 -eu --verbose done
+		grep --verbose printf local local done && test -eu $(pwd) /usr/bin export
+echo | awk ${HOME} grep then 'quoted text'
+	local cd printf 'quoted text' 'quoted text' awk ${HOME}
+"$1" --verbose $(pwd) readonly cd printf grep export cd then /usr/bin ${HOME} test
+	2>/dev/null grep awk $(pwd) | grep 2>/dev/null
+	2>/dev/null | 2>/dev/null awk ${HOME}
+	"$1" grep local /usr/bin awk awk then
+	awk export awk 2>/dev/null | -eu printf --verbose awk local 2>/dev/null "$1"
+	echo -eu x=1 grep $(pwd) done 2>/dev/null awk
+	export local readonly then /usr/bin "$1" echo test awk grep
+	--verbose readonly && awk x=1 done local ${HOME} done
+	-eu readonly done then then readonly && export && && local cd sed --verbose
+		local readonly sed "$@" cd ${HOME} 'quoted text' --verbose export sed
+	"$1" ${HOME} $(pwd) "$@"
+		2>/dev/null -eu done && then
+		done then x=1 2>/dev/null local then
+		cd export readonly && ${HOME} 'quoted text'
+		--verbose cd | ${HOME} $(pwd) grep | "$@"
+		echo --verbose local x=1 done -eu -eu 2>/dev/null test
+export x=1 | "$@" -eu "$@" then sed sed ${HOME} cd 'quoted text' --verbose 'quoted text'
+	| sed --verbose "$1" && printf test && test awk printf ${HOME} done printf
+		-eu echo ${HOME} grep readonly
+		-eu cd then /usr/bin -eu "$1" echo
+		export && ${HOME} x=1 printf "$1" ${HOME} test cd x=1
+	export ${HOME} local cd printf $(pwd) /usr/bin --verbose /usr/bin $(pwd) readonly
+${HOME} $(pwd) printf --verbose test echo -eu x=1 done grep
+	echo "$1" printf then /usr/bin ${HOME} awk 2>/dev/null /usr/bin sed
+	test awk | /usr/bin echo export grep --verbose cd echo "$1" grep readonly 2>/dev/null
+		grep | echo readonly ${HOME} local | x=1 "$1"
+		test --verbose awk sed grep | $(pwd) then | 'quoted text' | done -eu | && awk awk
+printf local -eu "$1" export awk
+		echo | | 2>/dev/null && && local export --verbose
+		/usr/bin -eu "$@" "$1" cd --verbose readonly printf done readonly
+	-eu readonly && -eu 2>/dev/null
+		/usr/bin -eu /usr/bin ${HOME} | $(pwd) then
+| grep cd | -eu x=1 sed grep export | cd done ${HOME}
+		done 2>/dev/null local ${HOME}
+	$(pwd) sed "$@" --verbose --verbose /usr/bin $(pwd) awk $(pwd) awk printf
+export -eu && && -eu 2>/dev/null printf
+		readonly && ${HOME} /usr/bin x=1 printf x=1 2>/dev/null
+export awk -eu sed then
+done then export "$@" "$@" awk "$@"
+test done x=1 cd && 2>/dev/null ${HOME} awk --verbose
+	cd sed 2>/dev/null printf readonly --verbose printf printf
+	then readonly "$@" done x=1 | then sed $(pwd) cd
+	/usr/bin ${HOME} ${HOME} --verbose awk grep "$@" | -eu
+	/usr/bin cd grep local echo test awk "$@" | x=1
+		x=1 awk "$@" && $(pwd) --verbose "$1" && test printf $(pwd) awk then
+2>/dev/null $(pwd) local sed ${HOME} printf && grep $(pwd) cd grep
+| echo 2>/dev/null then && cd ${HOME} && ${HOME} printf sed done $(pwd) sed
+2>/dev/null 2>/dev/null && test "$1" 2>/dev/null
+		printf ${HOME} test printf x=1 --verbose --verbose done done local $(pwd)
+		local awk 'quoted text' $(pwd) then "$1" 'quoted text' /usr/bin
+	/usr/bin echo x=1 ${HOME} $(pwd) test $(pwd) local local 'quoted text' "$@" awk
+		printf --verbose sed && -eu "$1" 'quoted text' $(pwd) cd export -eu local
+		grep local x=1 sed | "$1" sed sed export 2>/dev/null /usr/bin
+'quoted text' --verbose done grep $(pwd) -eu sed
+		local export ${HOME} && done ${HOME} sed readonly
+x=1 'quoted text' cd x=1 2>/dev/null ${HOME}
+		grep ${HOME} sed 2>/dev/null test | "$1" ${HOME} local
+	${HOME} 'quoted text' "$1" printf grep printf "$@" 'quoted text' local
+--verbose test "$@" 'quoted text' "$1" done
+	done ${HOME} then local ${HOME} grep grep readonly | 'quoted text'
+	local -eu /usr/bin awk -eu | local | | grep printf x=1 --verbose "$@" local "$@"
+		&& "$1" --verbose | && cd $(pwd) grep cd local -eu 'quoted text'
+${HOME} cd ${HOME} printf -eu sed 'quoted text'
+	&& done done "$1" 2>/dev/null export
+grep local "$1" readonly 'quoted text' sed "$@" && sed cd export then
+	2>/dev/null | echo $(pwd) done awk $(pwd) readonly readonly | local /usr/bin awk
+	/usr/bin export cd --verbose ${HOME} local
+		${HOME} x=1 grep | && test
+/usr/bin ${HOME} "$1" awk | cd cd --verbose
+		local ${HOME} && sed 2>/dev/null echo $(pwd) | "$1" awk "$1" awk done export
+		export cd done $(pwd) $(pwd) printf 'quoted text' 'quoted text' "$@" && grep
+		2>/dev/null && printf "$1"
+	$(pwd) grep local /usr/bin echo readonly test done
+| 2>/dev/null "$1" done /usr/bin echo test x=1
+		grep "$1" x=1 'quoted text' printf 'quoted text'
+		"$1" local export done ${HOME} then ${HOME} | grep export |
+	$(pwd) && | /usr/bin "$1" export ${HOME} 2>/dev/null "$1"
+		readonly readonly sed printf local 'quoted text' then grep /usr/bin
+/usr/bin printf 'quoted text' ${HOME} --verbose then
+printf done sed cd | x=1 awk done
+echo --verbose sed readonly
+		"$@" 2>/dev/null "$1" echo then
+		${HOME} export | printf
+	"$@" | sed sed ${HOME} ${HOME} ${HOME} readonly | 2>/dev/null
+		echo export done /usr/bin "$1" && ${HOME} printf echo --verbose
+&& export readonly --verbose grep echo "$@" done | echo
+		--verbose then done then ${HOME} /usr/bin
+		local 2>/dev/null /usr/bin done $(pwd) sed
+	${HOME} "$1" cd 2>/dev/null && 'quoted text' 'quoted text'
+		x=1 printf && -eu && $(pwd) x=1 echo awk then /usr/bin --verbose
+sed && 2>/dev/null -eu "$@" sed x=1 | x=1 --verbose local 'quoted text'
+${HOME} "$1" then awk && | sed then | --verbose && ${HOME} ${HOME} --verbose
+	"$1" readonly /usr/bin export ${HOME} --verbose --verbose | readonly
+		"$@" 'quoted text' x=1 "$@" /usr/bin x=1 done 2>/dev/null readonly awk local
+		-eu $(pwd) echo readonly $(pwd) | printf
+	test x=1 export cd export cd "$@" "$1"
+	printf printf --verbose && | test printf
+		awk ${HOME} readonly printf x=1
+	test awk --verbose cd test printf 2>/dev/null done --verbose test cd | awk
+		cd echo --verbose x=1 | | printf "$@" cd then | -eu export test 2>/dev/null
+	then done | -eu sed "$1" awk
+		x=1 readonly export && | cd done && -eu readonly 'quoted text'
+		2>/dev/null 'quoted text' awk $(pwd) 'quoted text' done ${HOME} "$1"
+		x=1 2>/dev/null done -eu "$1" then cd awk echo ${HOME}
+		| "$1" | done x=1 2>/dev/null "$@"
+		local sed -eu awk && 2>/dev/null | "$1" grep done readonly then ${HOME} printf
+cd test "$1" cd cd readonly &&
+		2>/dev/null x=1 x=1 awk 2>/dev/null readonly then 'quoted text' /usr/bin x=1 cd
+		test $(pwd) readonly done -eu $(pwd) ${HOME} done 2>/dev/null
+sed 2>/dev/null done /usr/bin && "$@" cd "$@" /usr/bin --verbose
+		then awk "$@" | ${HOME} | then ${HOME} then cd -eu
+"$1" sed printf sed grep grep
+		echo x=1 $(pwd) | echo echo then cd readonly grep x=1 -eu $(pwd) ${HOME}
+		local cd -eu sed | sed 2>/dev/null 2>/dev/null
+		test -eu sed echo done | "$1" && awk test done "$1" | ${HOME}
+	echo && --verbose --verbose local test $(pwd) awk && "$1" export $(pwd) $(pwd)
+'quoted text' cd 'quoted text' "$1" test x=1 x=1 "$@" cd 'quoted text' cd sed test
+"$@" cd done cd grep $(pwd)
+		awk local x=1 printf export "$1" export done
+export sed grep "$@" test grep 'quoted text' printf cd --verbose
+	2>/dev/null echo export test $(pwd) "$1" | cd done readonly
+		2>/dev/null done ${HOME} local test readonly
+		'quoted text' then readonly && test
+		'quoted text' && 'quoted text' /usr/bin cd then -eu 2>/dev/null x=1 | x=1 done
+	$(pwd) /usr/bin 2>/dev/null
+		awk "$1" then 2>/dev/null readonly && --verbose grep && $(pwd) readonly "$@"
+	&& | grep cd /usr/bin done done -eu export 2>/dev/null ${HOME} cd "$@" cd "$1"
+	${HOME} x=1 x=1 cd x=1 ${HOME} local then grep
+readonly $(pwd) local --verbose | | done readonly && 2>/dev/null && test grep
+	--verbose awk --verbose 2>/dev/null sed && --verbose
+		cd echo printf && sed done /usr/bin awk -eu
+$(pwd) then "$1" ${HOME} 2>/dev/null
+	cd echo test -eu test 2>/dev/null test 'quoted text' | ${HOME} 'quoted text'
+	echo test $(pwd) sed awk x=1 test echo done
+2>/dev/null x=1 printf done $(pwd)
+		x=1 readonly | ${HOME} x=1 --verbose done
+		'quoted text' $(pwd) --verbose 'quoted text' test test 2>/dev/null readonly
+		done export "$1" -eu cd 2>/dev/null grep done
+grep "$1" | $(pwd) cd echo done awk x=1 --verbose 'quoted text'
+		x=1 | printf export awk local cd x=1 "$@"
+	local awk grep | && 2>/dev/null
+	local test then export $(pwd) readonly
+	local --verbose readonly ${HOME} 'quoted text' ${HOME} export
+	-eu && /usr/bin "$1" && x=1 export x=1
+	local export readonly ${HOME} echo ${HOME} -eu cd -eu printf grep cd test
+--verbose "$1" 'quoted text' $(pwd)
+		export sed $(pwd) "$@" cd
+		| "$1" "$1" "$1" awk grep echo grep
+		/usr/bin export grep printf x=1 awk
+		test | ${HOME} done awk "$@" printf | "$@" test /usr/bin $(pwd)
+	cd cd echo grep && then -eu local
+	/usr/bin -eu local 2>/dev/null "$@" test grep | printf && --verbose
+--verbose export grep "$@" then --verbose
+cd "$1" awk grep | ${HOME} /usr/bin test
+printf && export "$1" printf
+		"$@" cd export export 2>/dev/null readonly sed $(pwd) $(pwd) cd cd "$@" --verbose
+		export echo /usr/bin "$1" test | && /usr/bin test 'quoted text'
+	--verbose test && "$1" ${HOME} && --verbose
+echo cd /usr/bin test done "$1" x=1 export && 'quoted text'
+local done "$@" -eu done /usr/bin then x=1 echo $(pwd)
+		cd ${HOME} "$@" local grep
+	| export test --verbose local awk readonly /usr/bin
+| -eu sed ${HOME} local done | x=1 "$1"
+	grep then readonly 2>/dev/null grep 'quoted text' grep awk
+		${HOME} 'quoted text' test done test && then cd export sed --verbose
+		export x=1 --verbose grep
+		then x=1 local --verbose sed 2>/dev/null local test readonly /usr/bin grep
+		grep echo then $(pwd)
+then /usr/bin echo echo cd then then "$1" printf ${HOME} $(pwd) ${HOME}
+| local | grep sed --verbose local && | && 'quoted text' grep awk "$1"
+then --verbose "$@" test sed /usr/bin cd "$@" -eu export
+		--verbose $(pwd) 2>/dev/null test --verbose done --verbose
+then grep then then "$1" 'quoted text' $(pwd) | echo
+		printf 2>/dev/null "$1" local local
+		test readonly 'quoted text' 'quoted text'
+printf x=1 local readonly readonly "$1" 'quoted text' "$1" x=1 /usr/bin
+${HOME} cd done local cd "$1" | ${HOME} /usr/bin printf --verbose cd "$@" $(pwd)
+		&& test grep sed sed awk
+--verbose $(pwd) export done "$1" printf sed 2>/dev/null x=1 'quoted text' printf
+	| then -eu "$1" && /usr/bin ${HOME} cd readonly 'quoted text'
+	test test sed -eu grep grep -eu echo | printf "$@" awk $(pwd) x=1 cd awk
+"$@" && done then --verbose 2>/dev/null x=1
+	-eu --verbose ${HOME} echo ${HOME} grep export then then | $(pwd)
+	&& -eu /usr/bin sed --verbose local "$@" cd -eu | ${HOME}
+	| awk echo local echo local echo "$@" --verbose 2>/dev/null
+then readonly sed ${HOME} 'quoted text' --verbose printf && done
+awk cd done export awk test then --verbose done echo
+		export then test 'quoted text' done "$@" 'quoted text' --verbose
+		"$1" "$1" done test && export readonly x=1 "$@" grep "$@" 2>/dev/null
+awk $(pwd) $(pwd) && /usr/bin test grep -eu sed 'quoted text'
+		"$1" ${HOME} echo $(pwd) then awk "$1" ${HOME} done sed printf cd cd
+/usr/bin ${HOME} then &&
+	$(pwd) /usr/bin done then "$@" sed -eu done 'quoted text'
+/usr/bin awk local grep ${HOME} awk $(pwd) && 2>/dev/null
+	| readonly local readonly done export grep /usr/bin
+		sed local ${HOME} && && cd awk test && x=1 export ${HOME} && x=1 export && done
+	$(pwd) "$1" -eu | x=1 echo awk echo test "$@" 2>/dev/null "$@"
+cd "$1" echo "$1" grep local then
+		'quoted text' then test awk -eu then test --verbose "$1" ${HOME}
+then -eu test then cd && echo sed "$1" readonly sed | sed -eu /usr/bin -eu 2>/dev/null
+	'quoted text' cd sed grep test "$@" then sed printf
+	$(pwd) 2>/dev/null $(pwd) awk
+		cd awk test export "$1" /usr/bin ${HOME} | test
+2>/dev/null && | ${HOME} export export -eu echo 'quoted text'
+		then x=1 && test ${HOME} printf echo /usr/bin -eu /usr/bin test $(pwd) 'quoted text'
+2>/dev/null /usr/bin awk cd | -eu 2>/dev/null test then x=1 then sed /usr/bin
+&& $(pwd) printf sed local
+		readonly "$@" x=1 echo cd local readonly awk | && done
+	"$1" $(pwd) awk ${HOME} done printf echo && cd sed "$1" cd readonly
+	sed grep printf export 2>/dev/null
+/usr/bin cd ${HOME} then && 'quoted text'
+$(pwd) 2>/dev/null then /usr/bin cd awk -eu test echo x=1 local export
+"$@" --verbose readonly local 2>/dev/null readonly $(pwd)
+awk 2>/dev/null export "$@" "$1" cd done x=1 awk $(pwd) then echo -eu
+done 2>/dev/null done ${HOME} printf local ${HOME} 2>/dev/null /usr/bin "$1"
+| $(pwd) readonly done | /usr/bin -eu 'quoted text' sed x=1 awk cd local
+	${HOME} done x=1 sed cd --verbose -eu && && "$@" 2>/dev/null export
+	then $(pwd) sed export "$@" test test ${HOME} ${HOME} 2>/dev/null 2>/dev/null
+&& local done done then
+done --verbose done readonly "$@" --verbose "$1" readonly "$@" echo
+	"$1" $(pwd) grep then then printf echo ${HOME} /usr/bin
+		-eu export test local awk test "$1" sed /usr/bin
+	test -eu sed "$1" /usr/bin printf sed "$1"
+| local cd export x=1 "$1" then "$1" cd test done -eu done export ${HOME} printf
+	&& "$1" "$1" printf local sed /usr/bin readonly printf "$@" cd
+echo && cd && x=1 $(pwd) test /usr/bin awk printf -eu printf
+	--verbose --verbose awk grep sed /usr/bin grep 'quoted text' sed && "$1" local
+		echo "$1" | done sed then "$@" grep -eu 'quoted text' cd grep done local
+${HOME} test printf $(pwd)
+done echo x=1 "$1" then sed -eu echo | x=1 printf x=1 'quoted text'
+local readonly local -eu echo "$1" readonly sed readonly $(pwd) cd sed
+	awk grep sed --verbose readonly printf test $(pwd)
+		cd -eu 'quoted text' && "$1" cd grep --verbose
+		"$1" -eu 2>/dev/null readonly 2>/dev/null
+	awk then && "$@" "$1" $(pwd) export /usr/bin sed && --verbose 2>/dev/null
+awk test done cd local 'quoted text'
+"$1" awk sed sed $(pwd) --verbose
+	test 2>/dev/null done -eu "$@" && $(pwd) $(pwd) test
+	$(pwd) then 2>/dev/null test
+'quoted text' "$1" $(pwd) cd "$1" export cd
+awk then done -eu "$1" export x=1 $(pwd) readonly -eu local $(pwd) 'quoted text'
+	--verbose "$1" local x=1 $(pwd) -eu cd --verbose 'quoted text' /usr/bin --verbose
+"$@" done done --verbose "$1" --verbose
+2>/dev/null | sed && printf export -eu -eu local
+test -eu ${HOME} "$@" local then /usr/bin 2>/dev/null
+		2>/dev/null 2>/dev/null readonly "$1" test "$1" then done then $(pwd) "$@" 2>/dev/null
+		printf /usr/bin sed ${HOME}
+/usr/bin -eu cd cd "$@" | export 2>/dev/null
+		cd $(pwd) then echo "$1" && | /usr/bin -eu "$@" ${HOME} test $(pwd) $(pwd) test
+	x=1 'quoted text' && --verbose then test then && sed | $(pwd) --verbose
+--verbose echo /usr/bin /usr/bin grep /usr/bin cd
+&& && 'quoted text' export done printf "$1" awk then grep local export
+	/usr/bin cd readonly -eu -eu local x=1 then "$1" x=1 cd done cd cd
+	grep && ${HOME} readonly 2>/dev/null "$@" grep test cd "$@" printf
+		--verbose /usr/bin echo done "$@" printf then --verbose cd 2>/dev/null /usr/bin
+		readonly local echo 'quoted text' printf -eu then echo --verbose
+cd $(pwd) awk | sed "$1" /usr/bin export --verbose --verbose
+	"$@" "$@" export grep then 'quoted text' grep sed | export then printf 2>/dev/null
+	grep awk | -eu sed sed sed done then "$1" x=1 && awk ${HOME} printf /usr/bin echo
+	local export local awk && sed readonly --verbose awk -eu readonly
+grep x=1 export ${HOME} &&
+	local /usr/bin "$1" readonly
+2>/dev/null "$@" $(pwd) && local | then awk
+	"$1" test done /usr/bin printf 2>/dev/null
+cd ${HOME} -eu sed done |
+		| grep test echo && "$@" sed printf ${HOME} sed local
+	cd $(pwd) "$@" "$@" echo done readonly
+	| "$1" ${HOME} local echo &&
+		/usr/bin local 2>/dev/null printf "$1" "$@" awk x=1 export 2>/dev/null
+--verbose done printf echo --verbose echo /usr/bin 2>/dev/null awk echo
+	printf | export printf x=1 export "$1" cd
+awk grep test 'quoted text' then -eu printf 2>/dev/null
+		-eu /usr/bin cd "$@" ${HOME}
+	then -eu cd 2>/dev/null grep $(pwd)
+-eu cd && -eu | "$@" echo -eu local 2>/dev/null
+	"$1" export && cd && "$1" then "$@" 'quoted text' echo printf
+		| ${HOME} --verbose sed done "$1" --verbose test cd local 2>/dev/null
+local | cd done --verbose 'quoted text' printf printf $(pwd) /usr/bin --verbose
+	local 2>/dev/null /usr/bin | "$@" 2>/dev/null | printf
+	sed --verbose /usr/bin export printf echo
+		&& then grep ${HOME} done local x=1 --verbose grep "$@" | then done
+export -eu cd grep x=1 $(pwd) $(pwd) printf awk
+		local ${HOME} readonly then /usr/bin ${HOME} /usr/bin 'quoted text'
+	cd 2>/dev/null 'quoted text' 2>/dev/null local
+		"$@" then echo printf readonly local
+		$(pwd) /usr/bin export --verbose 2>/dev/null
+		$(pwd) x=1 done -eu /usr/bin readonly | /usr/bin readonly x=1 cd readonly readonly
+grep x=1 done 'quoted text' "$1" local printf -eu && export
+sed x=1 sed $(pwd) "$@" && readonly --verbose 2>/dev/null readonly
+	"$@" $(pwd) test "$@" awk export local | "$1" /usr/bin
+		readonly -eu && export done "$1" $(pwd) grep ${HOME} grep && grep
+		${HOME} done x=1 "$@" && printf 'quoted text' &&
+-eu cd sed | then printf 'quoted text'
+--verbose echo test 'quoted text' then
+		2>/dev/null awk "$1" "$1" readonly
+		awk x=1 grep -eu 2>/dev/null --verbose
+printf $(pwd) x=1 --verbose "$1" "$1" $(pwd) local awk sed done
+| --verbose export readonly "$@" grep printf --verbose --verbose /usr/bin | then
+		readonly cd && cd 'quoted text' test /usr/bin local export cd export test
+	x=1 test awk -eu $(pwd) test grep $(pwd) then readonly x=1 | export
+	echo echo -eu /usr/bin printf
+	readonly cd 'quoted text' "$1" done /usr/bin | echo /usr/bin printf $(pwd)
+	grep test printf printf /usr/bin readonly "$@" sed ${HOME} grep cd
+		grep echo $(pwd) ${HOME} x=1 $(pwd) | done x=1 && grep ${HOME}
+-eu | | readonly | readonly grep readonly
+		"$@" readonly && printf local ${HOME} x=1 ${HOME} --verbose cd sed && local -eu
+echo && local 2>/dev/null cd "$@" ${HOME} 2>/dev/null
+	${HOME} x=1 test done export ${HOME} local --verbose grep
+		--verbose -eu local cd --verbose && 2>/dev/null $(pwd) done then test /usr/bin
+printf printf "$1" | then && -eu x=1
+		awk -eu readonly done grep
+	$(pwd) --verbose done -eu export | ${HOME} cd --verbose printf cd --verbose
+	${HOME} "$1" 'quoted text' 2>/dev/null sed -eu | done export
+${HOME} && test -eu /usr/bin echo | test 2>/dev/null
+/usr/bin -eu 'quoted text' local
+	awk readonly sed "$1"
+		--verbose grep x=1 /usr/bin
+		sed $(pwd) --verbose && done | test export sed "$@" awk && test done | "$1"
+'quoted text' "$@" test "$1" -eu echo /usr/bin && /usr/bin --verbose
+	done sed 2>/dev/null "$1" cd x=1 sed && /usr/bin test then
+		'quoted text' -eu "$1" local awk cd done test
+		$(pwd) cd export 'quoted text' "$@" 'quoted text' done readonly sed done
+		--verbose | done printf cd then && ${HOME} export /usr/bin /usr/bin ${HOME}
+"$1" "$1" -eu grep echo test && ${HOME} then sed
+export readonly export /usr/bin 'quoted text'
+cd done | echo $(pwd) $(pwd) test x=1
+local then $(pwd) sed | "$@" "$@" printf
+	cd echo "$1" ${HOME} "$@" done "$@" export test local $(pwd) ${HOME} --verbose
+		sed done "$@" x=1 cd grep -eu ${HOME} "$1" then printf done export x=1 'quoted text'
+		"$@" 'quoted text' "$1" sed $(pwd) --verbose local $(pwd) $(pwd) then
+	cd $(pwd) done -eu && awk | -eu test local 'quoted text' cd export export
+	--verbose printf test | sed echo printf export
+	$(pwd) grep awk then /usr/bin echo
+		sed export x=1 2>/dev/null "$@" done $(pwd)
+"$1" cd $(pwd) -eu printf awk test 2>/dev/null test cd cd x=1 awk --verbose cd $(pwd)
+	sed ${HOME} x=1 -eu then printf 'quoted text' --verbose printf
+	awk local cd awk "$1" | "$1" && --verbose ${HOME} then readonly echo awk done
+awk 'quoted text' printf echo echo -eu local -eu grep grep done
+		printf local export ${HOME} cd sed grep printf echo 'quoted text'
+'quoted text' "$@" -eu /usr/bin local export && "$@" awk test
+'quoted text' "$@" -eu local "$@"
+grep | done cd cd grep awk "$@" /usr/bin
+	sed $(pwd) echo grep grep $(pwd) printf grep -eu -eu echo /usr/bin /usr/bin
+		-eu sed then test test echo grep printf done readonly then | $(pwd) export
+		&& --verbose | -eu --verbose ${HOME} "$@"
+	-eu --verbose printf
+	--verbose | awk /usr/bin export && test readonly printf 'quoted text'
+	export grep readonly "$1" ${HOME} ${HOME} 2>/dev/null
+		"$@" then $(pwd) "$@" local ${HOME} grep "$1" 2>/dev/null "$@" local |
+	/usr/bin then && /usr/bin
+readonly --verbose cd
+	readonly local grep "$@" then local printf
+	&& x=1 sed printf test echo echo "$1" x=1 "$1" grep
+${HOME} echo | export local 'quoted text' --verbose
+		x=1 readonly test && x=1 --verbose
+		local readonly sed printf readonly
+		sed printf 'quoted text' 2>/dev/null
+awk 'quoted text' done $(pwd) then && ${HOME} awk cd export grep printf
+test -eu echo ${HOME} export -eu /usr/bin "$@" 2>/dev/null
+	sed 'quoted text' /usr/bin export | /usr/bin grep 'quoted text'
+		| --verbose done test "$1" grep local awk x=1 cd done printf echo test
+	$(pwd) -eu x=1 done 'quoted text' $(pwd) /usr/bin $(pwd) done -eu cd awk $(pwd)
+"$1" local grep printf x=1 --verbose then printf x=1 cd local local then
+		$(pwd) awk echo | done /usr/bin x=1 "$@" export "$1" 'quoted text'
+		awk 2>/dev/null 2>/dev/null echo "$1"
+		-eu echo then x=1 printf 'quoted text'
+		local printf awk --verbose echo done 'quoted text' echo /usr/bin --verbose
+		echo "$1" echo sed test 2>/dev/null $(pwd) printf $(pwd) "$@" ${HOME} awk done
+export printf "$@" export readonly --verbose /usr/bin x=1 x=1
+echo x=1 "$1" test done readonly awk
+'quoted text' /usr/bin readonly readonly readonly
+		local local ${HOME} "$@" echo readonly
+		$(pwd) 2>/dev/null sed ${HOME} cd "$1" done done local "$@" ${HOME}
+	sed 'quoted text' "$@" "$1" 2>/dev/null 2>/dev/null echo --verbose
+		readonly "$1" -eu /usr/bin ${HOME} -eu done echo
+		done x=1 awk "$1" && done
+		"$@" export done && x=1 "$@" echo $(pwd) /usr/bin 'quoted text'
+readonly test -eu then /usr/bin echo && local /usr/bin x=1 --verbose done
+		local grep test "$@" && grep cd --verbose
+sed test 'quoted text' printf done 2>/dev/null --verbose
+	grep ${HOME} sed --verbose 2>/dev/null
+local "$@" readonly && readonly x=1 x=1 ${HOME} then 2>/dev/null
+"$1" && && 2>/dev/null export | echo local "$1"
+	/usr/bin done /usr/bin 2>/dev/null | $(pwd) cd 2>/dev/null
+	${HOME} --verbose export
+	'quoted text' --verbose x=1 then --verbose
+	then then 'quoted text' cd /usr/bin grep -eu export test
+2>/dev/null -eu -eu then /usr/bin "$@" /usr/bin | local x=1 sed echo awk
+	readonly x=1 -eu awk && "$@" ${HOME} grep 2>/dev/null x=1 "$@"
+		printf done test /usr/bin
+	local sed $(pwd) grep 'quoted text' printf test
+	"$@" grep x=1 awk x=1 done ${HOME}
+	cd awk echo printf | awk x=1 sed "$1"
+	| local | 'quoted text' -eu
+		"$@" | 'quoted text' local
+		$(pwd) echo x=1 2>/dev/null grep
+"$1" readonly then 'quoted text' "$@" --verbose ${HOME} |
+	2>/dev/null 'quoted text'
+"$1" echo cd done then -eu export
+		"$@" export "$1" awk x=1 export
+	--verbose "$@" cd then 2>/dev/null grep awk 2>/dev/null grep --verbose
+		test ${HOME} /usr/bin 2>/dev/null | ${HOME}
+		"$@" ${HOME} grep --verbose "$@" cd |
+		export x=1 | test done cd export /usr/bin
+readonly echo export x=1 then then
+		${HOME} /usr/bin "$1" sed sed then export test sed x=1 then -eu "$1" local printf
+		$(pwd) && "$1" -eu 'quoted text' test
+| x=1 x=1 readonly echo then sed | "$@" grep grep printf
+		grep "$1" $(pwd) ${HOME}
+		grep then done sed grep
+	readonly "$1" cd sed --verbose --verbose
+cd readonly readonly "$@" then printf then printf | ${HOME} cd echo
+'quoted text' sed && then "$1" 'quoted text'
+readonly grep sed | readonly local cd "$@" && then test
+cd then grep /usr/bin awk | -eu cd grep cd ${HOME} echo printf
+grep echo && --verbose "$1" /usr/bin
+		'quoted text' export /usr/bin then
+	cd 2>/dev/null && local -eu then --verbose && && ${HOME} ${HOME} done /usr/bin
+		echo export then $(pwd) 2>/dev/null readonly
+	${HOME} $(pwd) -eu then --verbose
+		echo cd then cd --verbose echo $(pwd)
+		done /usr/bin done -eu then local && cd export then
+test 'quoted text' --verbose 2>/dev/null 2>/dev/null then test && readonly
+readonly done grep sed awk /usr/bin export $(pwd) |
+"$1" 2>/dev/null then then test x=1 --verbose && "$1" test
+		"$@" x=1 x=1 cd /usr/bin "$1" grep cd test x=1 "$1" -eu sed x=1
+		x=1 -eu "$@" 'quoted text' echo 'quoted text' x=1
+&& 'quoted text' $(pwd) printf 2>/dev/null -eu | "$1" done ${HOME} echo
+grep --verbose grep done /usr/bin done then $(pwd) local
+"$@" local grep cd 'quoted text'
+	&& ${HOME} grep done readonly | done cd && /usr/bin
+then 2>/dev/null grep /usr/bin
+	'quoted text' grep sed && 'quoted text' x=1 awk $(pwd) && echo export
+	sed | sed cd $(pwd) echo 2>/dev/null
+local -eu $(pwd) ${HOME} sed test "$1" && local
+printf local && "$1" local readonly echo
+		${HOME} echo /usr/bin test ${HOME} sed x=1 --verbose local
+	'quoted text' "$@" -eu test readonly $(pwd)
+"$1" awk then "$@" local then printf cd --verbose export --verbose
+		x=1 then x=1 printf then 'quoted text' test 'quoted text' test grep test
+	awk -eu /usr/bin export --verbose test export ${HOME} | cd x=1
+test echo "$@" /usr/bin
+		done | ${HOME} sed printf readonly done cd then
+		then ${HOME} then x=1 awk -eu 'quoted text' -eu then printf sed export
+$(pwd) -eu then cd $(pwd)
+		&& x=1 2>/dev/null echo printf x=1 export 'quoted text' | echo "$1" "$@" --verbose
+	$(pwd) export 2>/dev/null "$@" export
+2>/dev/null echo -eu local "$1" "$1" then sed export printf
+-eu echo then "$@" export "$1" ${HOME} cd test | $(pwd)
+	"$@" -eu 2>/dev/null echo ${HOME} readonly
+		x=1 cd done 2>/dev/null x=1 "$@"
+	"$@" cd grep ${HOME} ${HOME}
+	readonly "$@" readonly done && export test grep
+	then /usr/bin x=1 'quoted text' "$1" printf awk sed | /usr/bin local
+		x=1 x=1 /usr/bin $(pwd) "$1" &&
+		'quoted text' -eu 2>/dev/null --verbose
+"$@" sed printf grep done then /usr/bin $(pwd) cd "$1" test -eu
+cd then echo /usr/bin 2>/dev/null 'quoted text' "$@" "$1" x=1 "$1" "$@"
+$(pwd) --verbose $(pwd)
+awk ${HOME} sed | 'quoted text' "$@" then echo | cd --verbose
+	--verbose ${HOME} echo $(pwd) sed
+sed echo done -eu "$@" "$1" | 'quoted text'
+		readonly test | -eu && | "$1" done
+| test awk /usr/bin $(pwd) cd --verbose
+		'quoted text' -eu && $(pwd)
+sed echo printf /usr/bin 'quoted text' done readonly 'quoted text'
+--verbose ${HOME} --verbose 2>/dev/null | "$@" sed printf test ${HOME} /usr/bin
+export cd echo echo "$1" done
+$(pwd) 2>/dev/null --verbose echo ${HOME} then export x=1 | export test "$1" export
+	grep export | then | -eu 2>/dev/null -eu 'quoted text'
+	2>/dev/null x=1 && "$@" -eu
+test 2>/dev/null --verbose /usr/bin x=1 readonly
+		x=1 2>/dev/null awk "$1" /usr/bin test | /usr/bin readonly
+printf "$@" ${HOME} cd test "$@" echo ${HOME} x=1 sed echo grep 'quoted text'
+	x=1 'quoted text' 2>/dev/null then local awk --verbose sed "$@" printf
+"$@" 2>/dev/null "$@" sed echo "$1" export 2>/dev/null $(pwd) test echo
+		"$1" 'quoted text' 2>/dev/null $(pwd)
+&& -eu done "$@" --verbose
+	awk 2>/dev/null printf 'quoted text' /usr/bin
+	grep local export x=1
+	test "$1" echo awk echo /usr/bin 2>/dev/null && -eu --verbose test --verbose
+	cd grep --verbose && export 2>/dev/null printf
+echo sed -eu ${HOME} echo printf 2>/dev/null 'quoted text'
+&& -eu ${HOME} 2>/dev/null /usr/bin /usr/bin printf cd ${HOME} done "$@" 2>/dev/null
+		${HOME} cd done -eu | test x=1 x=1 readonly readonly cd local
+	echo $(pwd) printf | test -eu printf readonly $(pwd) --verbose
+	sed printf printf -eu local --verbose test "$1" awk local && "$@" local
+local /usr/bin ${HOME} export echo cd 2>/dev/null
+		2>/dev/null readonly "$@" "$@" -eu 2>/dev/null
+test | "$@" cd done awk printf "$@" "$1" 2>/dev/null "$1" /usr/bin -eu 'quoted text'
+	'quoted text' then -eu
+	awk sed | printf local export -eu cd test echo
+then test "$@" export $(pwd) x=1 awk readonly && -eu local "$@" x=1 awk echo
+	local -eu local /usr/bin $(pwd) sed x=1 2>/dev/null
+		awk printf then && $(pwd) x=1 readonly done 2>/dev/null ${HOME}
+		export cd && 2>/dev/null cd | --verbose 2>/dev/null cd
+--verbose 'quoted text' grep ${HOME}
+		x=1 --verbose "$1" grep printf x=1 && 'quoted text' && 2>/dev/null
+	${HOME} ${HOME} then cd &&
+${HOME} then /usr/bin $(pwd) | | echo ${HOME} ${HOME}
+"$@" ${HOME} local $(pwd) grep awk echo
+"$1" cd then 'quoted text' 2>/dev/null $(pwd)
+	test cd grep then grep done sed ${HOME} /usr/bin test "$1" 'quoted text'
+	test ${HOME} printf --verbose sed 'quoted text'
+		| local echo 2>/dev/null
+	/usr/bin $(pwd) cd | grep then $(pwd)
+local "$1" 2>/dev/null export export
+		echo local done --verbose local $(pwd) "$@" "$@" export && then "$1"
+		cd "$1" cd readonly local test x=1 'quoted text' "$@" --verbose
+		-eu /usr/bin 'quoted text' grep
+		2>/dev/null ${HOME} ${HOME} echo
+	x=1 then 'quoted text' grep 'quoted text' printf && $(pwd) ${HOME} 'quoted text'
+		"$1" grep done test | local export then 2>/dev/null local 2>/dev/null
+	'quoted text' readonly then ${HOME} $(pwd) 2>/dev/null cd grep
+printf | then printf && $(pwd) export ${HOME}
+$(pwd) 'quoted text' done && "$@" ${HOME} --verbose && && awk printf export
+		printf $(pwd) -eu awk --verbose $(pwd)
+		&& x=1 2>/dev/null | "$1" printf /usr/bin export printf $(pwd) sed printf grep
+	--verbose local export 'quoted text' printf $(pwd) then sed cd ${HOME} then cd
+		"$@" sed sed 2>/dev/null then local local |
+		$(pwd) export test printf | awk && | printf sed "$1" local && echo | -eu
+		"$1" 'quoted text' && done x=1 sed
+	echo then cd export printf ${HOME} 2>/dev/null $(pwd) 2>/dev/null /usr/bin
+		cd --verbose 'quoted text' -eu &&
+	&& grep | grep --verbose then test local done --verbose "$@"
+		$(pwd) printf readonly then 2>/dev/null ${HOME} "$1" export
+&& local grep | then printf $(pwd) "$1" -eu cd && printf
+		cd printf ${HOME} printf 'quoted text' sed readonly && "$@" "$1" -eu && 'quoted text'
+		echo 'quoted text' then -eu --verbose echo cd | &&
+| test grep 'quoted text' && done readonly echo "$1" echo printf
+		then done local "$1" local grep $(pwd) -eu ${HOME} local done
+	export echo readonly then /usr/bin 2>/dev/null then export local 'quoted text'
+		export x=1 test x=1 local grep done local grep readonly echo local
+		export /usr/bin grep "$@" grep ${HOME} "$1" done -eu cd
+	awk grep "$1" && ${HOME} /usr/bin --verbose $(pwd) sed --verbose
+'quoted text' x=1 then
+	| done grep export "$@" then printf sed
+	"$1" "$@" --verbose | 2>/dev/null then x=1 readonly /usr/bin
+	2>/dev/null then -eu --verbose --verbose 2>/dev/null
+		$(pwd) x=1 echo | 2>/dev/null | then /usr/bin sed test export /usr/bin "$@"
+	test | && --verbose && cd x=1 x=1 readonly sed | 'quoted text' done grep 2>/dev/null
+local readonly grep && readonly awk "$1" -eu ${HOME} echo | then done "$1" printf
+		"$@" 'quoted text' then | ${HOME} readonly && echo then
+	'quoted text' readonly readonly echo "$1" | local test local ${HOME}
+	awk 2>/dev/null 2>/dev/null grep 'quoted text' "$@" x=1 $(pwd)
+	x=1 'quoted text' printf printf sed grep $(pwd) -eu cd $(pwd) printf --verbose
+		-eu /usr/bin grep 2>/dev/null /usr/bin readonly
+		echo export && x=1 local
+		grep && /usr/bin ${HOME} -eu test ${HOME} done test then local then $(pwd)
+	done echo export grep readonly
+awk local grep $(pwd) && "$1" $(pwd) | 2>/dev/null export /usr/bin then export
+	printf then cd grep sed
+printf | cd then export sed "$@" "$1" "$1" done sed 2>/dev/null cd readonly
+$(pwd) sed && local then printf 2>/dev/null echo awk readonly done
+		--verbose echo /usr/bin 'quoted text' --verbose sed /usr/bin then "$@" then done
+then /usr/bin --verbose 'quoted text'
+		test awk echo printf --verbose cd export echo $(pwd) readonly
+		local printf $(pwd) cd readonly cd
+	'quoted text' "$@" $(pwd) printf "$1" printf export
+	awk test readonly printf $(pwd)
+		printf "$@" done 'quoted text'
+	"$1" printf echo awk $(pwd)
+		$(pwd) then /usr/bin "$@" "$1" | awk
+printf echo then sed -eu done echo
+sed --verbose awk grep export local cd "$@" 2>/dev/null echo sed
+${HOME} export "$@" 'quoted text' grep && | ${HOME} done local printf
+2>/dev/null 'quoted text' echo ${HOME} 'quoted text'
+	&& "$@" "$1" cd | --verbose /usr/bin sed grep $(pwd) 2>/dev/null
+sed --verbose /usr/bin done && awk
+export 'quoted text' "$@" printf 'quoted text' test && $(pwd) "$@" "$1" printf local
+		test --verbose $(pwd) printf then
+	$(pwd) "$@" "$@" 'quoted text' /usr/bin done then local 'quoted text' then local
+cd "$@" 'quoted text' /usr/bin && x=1 "$1" echo local then ${HOME} awk ${HOME}
+--verbose readonly -eu test sed 2>/dev/null 2>/dev/null awk
+"$1" local export 'quoted text' $(pwd)
+export | ${HOME} ${HOME} -eu --verbose
+	x=1 "$1" --verbose readonly "$@" "$@" 2>/dev/null x=1 done readonly x=1 "$1" x=1
+	awk local x=1 awk awk 'quoted text' cd --verbose printf
+		export awk "$@" then done 2>/dev/null && "$1" done export
+	cd /usr/bin -eu $(pwd) x=1 then ${HOME}
+	&& 2>/dev/null awk -eu ${HOME} /usr/bin local -eu cd then export && cd
+	then 2>/dev/null /usr/bin echo 'quoted text' grep
+		done && --verbose grep |
+"$1" echo sed 2>/dev/null 2>/dev/null
+test ${HOME} grep printf "$@" "$1" ${HOME} readonly
+export && 'quoted text' 2>/dev/null grep x=1 2>/dev/null 'quoted text'
+	'quoted text' readonly grep | --verbose readonly then "$1"
+		x=1 local local readonly /usr/bin && 2>/dev/null x=1 --verbose "$1" cd printf
+	$(pwd) echo awk printf x=1 cd grep "$1" then sed -eu -eu && then
+	grep echo done 2>/dev/null done export /usr/bin then && printf 2>/dev/null
+		${HOME} export sed sed /usr/bin --verbose export grep ${HOME} ${HOME}
+		&& awk -eu "$@" sed readonly cd 2>/dev/null local 'quoted text'
+	printf local readonly -eu readonly 2>/dev/null --verbose
+	2>/dev/null 'quoted text' cd ${HOME} done then ${HOME}
+		done | cd "$1" | grep ${HOME} echo 'quoted text'
+	'quoted text' local cd then $(pwd) awk printf
+	'quoted text' 2>/dev/null 'quoted text' readonly then grep sed $(pwd)
+'quoted text' "$1" grep 'quoted text'
+printf readonly "$1" && 2>/dev/null cd "$@" "$1" 2>/dev/null
+		sed /usr/bin && then printf echo
+		printf awk test echo done 2>/dev/null test
+| echo then grep test readonly awk 2>/dev/null grep
+	sed "$1" printf ${HOME} local readonly local export "$@" done
+		grep printf local -eu 2>/dev/null echo printf export awk test $(pwd)
+		x=1 then "$1" 'quoted text' sed sed 'quoted text' ${HOME} $(pwd)
+sed sed grep x=1 "$@" grep
+	cd echo 2>/dev/null readonly "$@" export awk done
+		&& x=1 x=1 export test cd x=1 ${HOME} awk printf local cd "$1" 2>/dev/null
+then grep /usr/bin "$1" test && test 2>/dev/null grep test awk /usr/bin --verbose
+	grep -eu --verbose cd grep 'quoted text' cd 2>/dev/null printf readonly
+		cd ${HOME} export sed done awk x=1 echo 2>/dev/null local
+		local cd /usr/bin "$@" ${HOME} readonly -eu local "$@"
+	grep readonly -eu printf &&
+	then done test $(pwd) echo --verbose export ${HOME}
+		--verbose 2>/dev/null && awk 'quoted text' && done grep && then readonly
+export | grep done x=1 printf
+		x=1 printf $(pwd) sed sed export && awk --verbose sed grep
+		2>/dev/null 2>/dev/null -eu printf x=1 sed ${HOME} grep
+		&& done -eu sed done ${HOME} | grep test | x=1 local done local
+		'quoted text' readonly test "$@"
+		"$@" sed -eu local --verbose ${HOME} test 2>/dev/null
+x=1 "$1" 2>/dev/null -eu done readonly test /usr/bin
+awk 'quoted text' ${HOME} x=1 && --verbose then /usr/bin
+readonly grep ${HOME} test cd done readonly
+	x=1 ${HOME} done cd readonly
+		grep --verbose done cd cd readonly -eu sed -eu /usr/bin export echo "$@"
+sed printf "$1" | printf && printf | --verbose readonly x=1 x=1 $(pwd) -eu readonly
+	$(pwd) ${HOME} then 'quoted text' sed | $(pwd) cd $(pwd)
+		grep printf local $(pwd) local "$1" done grep printf x=1 "$1" then
+	cd grep | "$@" then /usr/bin done awk
+		"$1" test $(pwd) $(pwd) echo 2>/dev/null "$1" readonly && sed |
+/usr/bin /usr/bin grep | then then
+	grep sed "$@" echo && test
+		x=1 test sed --verbose cd then ${HOME} local sed
+		${HOME} /usr/bin echo export export test -eu &&
+		${HOME} | then "$1" awk $(pwd) --verbose && then export done test
+		--verbose --verbose "$@" readonly 'quoted text' local x=1 $(pwd)
+	| awk then awk "$1" local test readonly awk &&
+	x=1 x=1 /usr/bin printf ${HOME} cd readonly grep grep "$1" printf
+		${HOME} -eu export && ${HOME} export grep /usr/bin awk /usr/bin
+		grep printf ${HOME} "$1" --verbose
+		grep printf test grep "$1" grep
+$(pwd) /usr/bin 2>/dev/null echo /usr/bin printf sed then local done printf x=1
+| && 2>/dev/null 2>/dev/null "$@" grep --verbose readonly local sed ${HOME}
+	echo export done --verbose sed $(pwd) printf
+		grep 'quoted text' x=1 "$1" --verbose
+sed then local x=1 --verbose readonly "$@" x=1
+readonly local cd sed /usr/bin then /usr/bin
+x=1 "$@" export then "$@" "$1" /usr/bin cd 'quoted text'
+		local 'quoted text' test /usr/bin x=1 | 2>/dev/null cd /usr/bin done "$1" awk
+sed --verbose 'quoted text' cd 2>/dev/null done 'quoted text'
+		"$@" 2>/dev/null echo cd 'quoted text' /usr/bin export sed x=1
+		| "$@" done "$1" cd echo echo 'quoted text' x=1 readonly
+		done readonly grep ${HOME} ${HOME} x=1 grep 2>/dev/null
+echo ${HOME} 'quoted text' then 'quoted text' echo export
+		--verbose done printf grep | cd "$@"
+	sed cd printf test | "$1" awk "$1" done "$@" awk readonly ${HOME} "$1"
+readonly --verbose | awk awk "$1" grep x=1
+printf then printf grep | -eu readonly sed 'quoted text'
+		| printf cd x=1 "$1" /usr/bin | && then 2>/dev/null
+		test printf --verbose grep printf done
+	-eu then test local then /usr/bin grep && printf "$1" export
+		grep && | readonly "$@" cd --verbose sed done export && 2>/dev/null
+awk && | x=1 cd $(pwd) && local sed ${HOME} x=1 "$1" awk export
+		2>/dev/null test local echo $(pwd) test
+		-eu 2>/dev/null "$@" grep then "$@" "$1" && readonly sed grep 2>/dev/null
+		awk then "$@" $(pwd) "$1" local && 2>/dev/null -eu awk $(pwd) then
+	"$1" done test export 'quoted text' "$1" awk grep 2>/dev/null awk
+		done then $(pwd) x=1 'quoted text' | | cd awk export
+		${HOME} cd "$@" -eu awk awk 2>/dev/null 2>/dev/null -eu echo then then test x=1
+	done printf done 2>/dev/null sed readonly | $(pwd) | awk test readonly x=1
+local grep then cd cd readonly 2>/dev/null /usr/bin
+local grep then printf --verbose "$1" readonly
+		awk "$1" grep done then printf readonly /usr/bin test /usr/bin
+		'quoted text' local $(pwd)
+		&& | export then printf local
+--verbose 2>/dev/null local
+test printf $(pwd) sed ${HOME} sed -eu ${HOME} 'quoted text' ${HOME} local 'quoted text'
+awk && export done /usr/bin test 2>/dev/null | -eu ${HOME} readonly
+		printf 2>/dev/null 2>/dev/null 2>/dev/null echo
+		/usr/bin /usr/bin printf done x=1
+	done $(pwd) local | sed readonly local 2>/dev/null sed printf
+		-eu /usr/bin cd sed cd ${HOME} "$@" /usr/bin awk local 'quoted text' test
+		2>/dev/null | awk x=1 | 'quoted text' printf done printf
+		readonly sed /usr/bin 2>/dev/null local && ${HOME} "$1" && x=1 local then
+		done printf then -eu test | /usr/bin sed export x=1 sed
+		grep "$1" test readonly $(pwd) /usr/bin
+		sed echo readonly cd cd && export "$@" ${HOME} &&
+sed /usr/bin "$1" grep x=1
+export sed $(pwd) sed local "$@" readonly "$1" echo then
+#include c92.sh
+	| cd "$1" sed done $(pwd) sed done -eu 2>/dev/null "$@" local
+		2>/dev/null local then readonly && done readonly 2>/dev/null sed 2>/dev/null
+		printf --verbose $(pwd) -eu echo test done grep --verbose grep -eu -eu test printf
+	2>/dev/null | "$@" && done done grep export printf local 'quoted text'
+"$1" 'quoted text' --verbose
+	cd $(pwd) $(pwd) then cd $(pwd) ${HOME} ${HOME} grep echo "$@" cd echo cd
+x=1 $(pwd) grep && /usr/bin |
+		done done done /usr/bin $(pwd) readonly
+		$(pwd) local && 2>/dev/null cd
+		then && test && "$@" 'quoted text' sed "$@" x=1 | "$1" awk | 'quoted text'
+${HOME} -eu "$@" -eu "$1" /usr/bin x=1 'quoted text'
+${HOME} sed sed 'quoted text' -eu "$@" readonly && printf
+		printf then "$@" sed awk test /usr/bin printf
+	echo "$@" cd $(pwd) then -eu $(pwd) printf grep -eu then /usr/bin grep
+	readonly export local sed --verbose test
+&& export x=1 | | awk awk grep $(pwd) && readonly then done /usr/bin test readonly
+	'quoted text' "$1" echo x=1 grep then ${HOME} done /usr/bin done
+done grep | --verbose 2>/dev/null -eu /usr/bin
+		grep done "$@" local cd | 'quoted text' "$1" -eu ${HOME} ${HOME} 'quoted text'
+		2>/dev/null ${HOME} | then sed then local awk && -eu test
+		cd test cd readonly local then "$1" "$@" sed export awk && test readonly $(pwd)
+	-eu 2>/dev/null --verbose echo awk 2>/dev/null /usr/bin
+		'quoted text' -eu "$@" export
+	"$@" grep local "$1" "$@" | test &&
+	x=1 grep /usr/bin $(pwd) | --verbose cd cd 'quoted text' --verbose
+	test printf echo echo && echo sed
+		'quoted text' readonly ${HOME} echo && "$@" | echo "$1" grep local "$1" | "$@"
+		grep local printf echo -eu sed echo && cd | | done local
+		-eu cd awk readonly 2>/dev/null --verbose printf then echo 2>/dev/null
+	test && sed x=1 sed local && then --verbose export readonly
+		-eu && -eu cd -eu "$1" test /usr/bin | 'quoted text' x=1
+${HOME} grep /usr/bin "$1"
+	&& "$@" sed "$@" done cd
+		$(pwd) --verbose "$1"
+	&& readonly local local -eu done ${HOME} /usr/bin /usr/bin /usr/bin /usr/bin
+		${HOME} done x=1 readonly
+	echo $(pwd) 'quoted text' 2>/dev/null "$1" ${HOME} --verbose
+		--verbose local -eu --verbose
+	awk then --verbose cd grep
+test 'quoted text' then export then sed readonly test echo
+	printf x=1 -eu export && echo echo cd grep --verbose then awk then && sed ${HOME}
+readonly echo grep local /usr/bin sed "$1" local && then awk 'quoted text'
+		printf test ${HOME} ${HOME} export grep done then echo x=1 | test 2>/dev/null
+	x=1 awk echo --verbose ${HOME} ${HOME} local
+		cd awk 2>/dev/null "$@" then printf 2>/dev/null |
+		--verbose then grep sed /usr/bin $(pwd) awk sed sed 'quoted text'
+	then && cd /usr/bin export 'quoted text' done "$@" cd $(pwd) -eu
+		then ${HOME} 'quoted text' /usr/bin -eu $(pwd)
+		--verbose && x=1 ${HOME} printf | "$1" 'quoted text' done 2>/dev/null
+--verbose 2>/dev/null printf ${HOME} 2>/dev/null | 'quoted text' echo grep echo
+		/usr/bin ${HOME} local readonly && 2>/dev/null
+	$(pwd) "$1" then cd then 'quoted text' x=1 grep done -eu echo printf --verbose
+		sed awk sed grep "$1" done --verbose
+/usr/bin grep done /usr/bin "$@" grep "$1" 2>/dev/null
+	/usr/bin --verbose && sed
+		done done sed 'quoted text' /usr/bin test ${HOME}
+	2>/dev/null ${HOME} test sed awk cd "$1" --verbose "$1" readonly
+	done done export 2>/dev/null then -eu then x=1 /usr/bin
+		$(pwd) grep sed 2>/dev/null --verbose /usr/bin readonly --verbose /usr/bin export
+then readonly awk $(pwd) export test
+readonly 2>/dev/null sed cd --verbose -eu
+		&& $(pwd) /usr/bin $(pwd) export
+		'quoted text' --verbose then
+		x=1 "$@" -eu test sed printf test grep && 'quoted text'
+readonly local then then &&
+-eu awk done echo $(pwd) --verbose grep $(pwd) 'quoted text' 'quoted text'
+	-eu echo then --verbose readonly export x=1 then --verbose readonly /usr/bin
+	'quoted text' awk x=1 done 'quoted text' 2>/dev/null "$@" &&
+done sed x=1 export $(pwd) readonly echo
+		awk | ${HOME} readonly test "$1" | done
+export /usr/bin -eu then 2>/dev/null && test
+	then 2>/dev/null "$@" | x=1 local sed printf 'quoted text'
+test && sed --verbose "$@" | "$@" awk test local
+	cd local done "$@" cd export "$1" "$@" $(pwd) |
+/usr/bin $(pwd) grep sed 'quoted text' sed 2>/dev/null awk "$1" printf
+	-eu /usr/bin sed printf "$@" /usr/bin test local echo done 2>/dev/null awk cd
+-eu /usr/bin printf cd --verbose 2>/dev/null
+		2>/dev/null done awk ${HOME} sed | "$1" done && grep | x=1 awk | | 'quoted text'
+		| | 2>/dev/null "$@" "$@" ${HOME} readonly
+x=1 awk done test --verbose done ${HOME} "$1" $(pwd) sed
+		local export cd 2>/dev/null awk
+		sed readonly printf --verbose awk
+		printf /usr/bin | "$@" export grep "$@" "$1" readonly export
+test grep && && "$1" "$1" then --verbose "$@" export && cd
+	"$@" awk sed x=1 local printf
+	echo printf /usr/bin && "$1" test 2>/dev/null | /usr/bin
+		done readonly "$1" echo -eu export && awk x=1 2>/dev/null printf | local
+		$(pwd) test readonly then $(pwd) --verbose /usr/bin echo echo
+		awk grep --verbose export x=1 -eu -eu sed echo |
+		'quoted text' && "$@" --verbose "$1" printf awk grep 2>/dev/null
+		--verbose readonly grep
+	$(pwd) export grep -eu readonly 2>/dev/null
+--verbose "$@" readonly | cd readonly ${HOME} &&
+x=1 && | cd done grep sed then sed done --verbose export then "$1" sed cd sed
+/usr/bin awk 'quoted text' "$@" | grep grep x=1 cd
+export | readonly then readonly --verbose 2>/dev/null
+awk $(pwd) -eu /usr/bin
+		$(pwd) ${HOME} export grep x=1
+		then ${HOME} 'quoted text'
+x=1 2>/dev/null /usr/bin 2>/dev/null export | /usr/bin -eu test 2>/dev/null
+x=1 readonly grep && awk ${HOME} x=1 export | awk -eu ${HOME} awk export
+	echo x=1 test sed "$1" echo readonly done
+	printf 2>/dev/null local printf then x=1 export then 2>/dev/null ${HOME}
+done done 'quoted text' export -eu -eu test
+		x=1 ${HOME} test | export export test sed ${HOME}
+then 'quoted text' printf grep && | cd "$1" --verbose
+	"$@" awk 2>/dev/null 'quoted text' local --verbose grep then x=1 awk
+		&& cd cd then $(pwd) $(pwd) 2>/dev/null cd "$1" | -eu -eu readonly
+	then readonly ${HOME} test local export
+--verbose done | test "$1" then -eu
+/usr/bin | ${HOME} export cd 'quoted text' test done "$@" echo
+	'quoted text' echo &&
+grep sed then --verbose x=1 export "$@" export
+readonly "$@" export local | local 2>/dev/null printf
+	'quoted text' 2>/dev/null local readonly then $(pwd) test
+		&& then | && grep sed ${HOME} "$@" ${HOME}
+local readonly --verbose awk local && readonly test then sed && 'quoted text'
+'quoted text' "$1" done then $(pwd) --verbose 2>/dev/null
+test && sed /usr/bin /usr/bin &&
+	--verbose printf x=1 test "$1" awk $(pwd) readonly
+sed "$@" test printf readonly test echo 'quoted text' ${HOME} local readonly |
+		sed --verbose done export awk echo $(pwd)
+		done ${HOME} -eu "$1" 'quoted text' printf
+	export readonly x=1 /usr/bin 'quoted text' readonly && export local
+	awk local grep --verbose readonly export then x=1
+		"$1" | -eu -eu /usr/bin ${HOME}
+		grep export -eu /usr/bin export readonly
+	x=1 sed test export export sed grep
+	$(pwd) done cd --verbose sed && awk test $(pwd) echo
+		grep then --verbose 'quoted text'
+-eu "$@" | done 2>/dev/null 'quoted text'
+		2>/dev/null printf x=1 "$1" local export local
+	then $(pwd) export then export -eu printf export cd then ${HOME} 'quoted text'
+	'quoted text' && export grep |
+		awk 2>/dev/null readonly ${HOME}
+"$1" awk printf 'quoted text' /usr/bin
+		/usr/bin ${HOME} /usr/bin test readonly awk 2>/dev/null readonly test -eu cd
+		&& -eu cd then echo 'quoted text'
+	"$@" "$@" "$@" | && awk -eu $(pwd) 2>/dev/null -eu -eu ${HOME} printf x=1 readonly
+	/usr/bin | --verbose &&
+local 'quoted text' x=1 && "$1" readonly then 'quoted text'
+printf awk 'quoted text' /usr/bin test grep echo test 'quoted text' test
+		done grep --verbose local readonly
+	${HOME} ${HOME} awk done
+echo local -eu x=1 'quoted text' "$1" $(pwd) test
+2>/dev/null | 2>/dev/null sed local --verbose
+2>/dev/null -eu 2>/dev/null 2>/dev/null grep 2>/dev/null $(pwd) readonly
+	/usr/bin x=1 ${HOME} $(pwd) then
+		grep ${HOME} /usr/bin 2>/dev/null && readonly "$1" then done --verbose
+		readonly sed printf 'quoted text' export --verbose
+-eu "$1" echo test echo "$@" && && ${HOME} ${HOME}
+		-eu test "$@" export --verbose --verbose
+'quoted text' then "$@" "$1" done ${HOME} ${HOME} test export
+	test test "$@" ${HOME} done grep export
+		&& done /usr/bin test x=1 "$@" local ${HOME}
+	echo printf ${HOME} $(pwd) printf 'quoted text' 'quoted text' export |
+"$@" "$@" then 2>/dev/null $(pwd) $(pwd) cd ${HOME} echo sed
+"$1" ${HOME} test local readonly | then $(pwd) awk then cd then | test
+		readonly "$@" $(pwd)
+	awk then | x=1 echo x=1 then cd printf readonly "$@"
+done /usr/bin local grep then -eu 2>/dev/null ${HOME} ${HOME}
+done cd local grep awk then $(pwd) readonly -eu x=1 cd echo "$@" -eu
+		x=1 export /usr/bin && $(pwd)
+	| "$1" "$@" export grep -eu echo && grep printf echo local
+	x=1 && "$@" "$1" awk awk | readonly "$@" /usr/bin done $(pwd) "$@"
+	"$@" grep --verbose ${HOME}
+	readonly then test test | grep test && "$1" --verbose awk | && then
+	"$@" then ${HOME} grep test "$@" && done ${HOME} --verbose 'quoted text' ${HOME}
+		test printf -eu export cd -eu done | done 'quoted text'
+		--verbose $(pwd) local then -eu sed --verbose local "$@" x=1 | $(pwd)
+"$@" export local $(pwd) | --verbose local "$@"
+	"$1" test local | --verbose "$1" grep echo readonly
+		'quoted text' | "$1" 2>/dev/null local "$@" done local export then
+		grep -eu "$@" test echo
+then 'quoted text' cd x=1 grep /usr/bin
+		| && | /usr/bin grep --verbose echo x=1 done | x=1 awk local test printf
+export cd -eu "$@" sed "$@" local sed -eu printf $(pwd) "$@" x=1
+	awk local 'quoted text' echo --verbose echo "$@" awk ${HOME}
+	awk 'quoted text' --verbose then "$1" /usr/bin "$@" /usr/bin printf
+	'quoted text' local readonly cd $(pwd) sed
+	/usr/bin export awk local awk cd
+grep echo printf sed -eu && x=1
+	cd local grep then "$@" 2>/dev/null readonly /usr/bin
+	x=1 grep 2>/dev/null local $(pwd) printf | sed && grep "$@" 2>/dev/null
+	test test ${HOME} x=1 "$1" done
+		sed export done /usr/bin "$@" done | 'quoted text'
+| grep export --verbose sed awk cd then 'quoted text' ${HOME}
+		export done --verbose
+		cd | x=1 printf && awk "$@" && -eu | --verbose
+		&& printf -eu printf done
+		2>/dev/null awk "$1" /usr/bin
+	sed --verbose awk echo | export awk --verbose "$@" $(pwd) echo grep && -eu readonly
+	| | $(pwd) | test local "$@" x=1 grep
+	readonly then | && test x=1 /usr/bin && 'quoted text' awk "$1" awk
+	cd cd && $(pwd) 2>/dev/null x=1 /usr/bin
+	cd local "$@" grep && local ${HOME} ${HOME} sed readonly cd
+	| then --verbose done
+		echo x=1 awk readonly local then test ${HOME}
+export --verbose "$@" "$1" grep
+awk 'quoted text' "$1" -eu --verbose done $(pwd) awk -eu awk /usr/bin local
+		2>/dev/null printf 'quoted text'
+	printf "$1" readonly "$1" -eu cd local
+	local done 'quoted text' local 'quoted text' echo
+grep sed echo ${HOME} /usr/bin "$1" 'quoted text' cd printf echo readonly
+		printf printf ${HOME}
+	-eu local /usr/bin /usr/bin x=1 echo "$@" export $(pwd) printf x=1
+	${HOME} ${HOME} printf ${HOME}
+		&& grep sed awk 2>/dev/null "$1" ${HOME} $(pwd) export printf ${HOME} ${HOME} -eu
+readonly awk done && 2>/dev/null $(pwd) local --verbose
+sed grep cd then $(pwd) awk then $(pwd) 'quoted text' printf grep
+		--verbose done "$@" $(pwd) && sed readonly
+then done $(pwd) $(pwd) 'quoted text' /usr/bin export --verbose echo test
+	"$@" | $(pwd) --verbose "$1"
+	echo printf $(pwd) x=1 printf ${HOME} /usr/bin /usr/bin
+awk local then x=1 -eu awk
+cd local readonly 'quoted text' then -eu local | echo x=1 export done
+| then /usr/bin printf ${HOME} echo
+	then printf x=1 -eu "$@" $(pwd) sed
+	export then grep local then export
+	"$1" ${HOME} awk $(pwd) --verbose test
+	echo 2>/dev/null ${HOME}
+		${HOME} export printf export x=1 x=1 x=1 x=1 ${HOME} "$1" --verbose
+x=1 done cd --verbose 2>/dev/null
+	&& $(pwd) done export $(pwd) readonly "$@" "$@"
+		x=1 cd --verbose "$@" | sed -eu echo ${HOME}
+	test sed printf /usr/bin grep local 'quoted text' test x=1
+		test ${HOME} 2>/dev/null ${HOME} 'quoted text' ${HOME} /usr/bin done
+	--verbose grep then | && x=1 cd readonly
+	local && sed "$@" awk 2>/dev/null then then echo $(pwd)
+printf done && --verbose done && -eu awk awk readonly && sed then $(pwd) readonly
+	/usr/bin "$1" 2>/dev/null sed then && 'quoted text' export | | echo
+	-eu sed test $(pwd) /usr/bin echo grep cd --verbose --verbose awk readonly
+/usr/bin sed -eu "$1" printf
+		$(pwd) done test cd /usr/bin cd test export "$@" 'quoted text' "$@"
+/usr/bin grep grep "$1"
+		"$1" local ${HOME} export cd x=1 awk readonly
+"$1" cd 2>/dev/null echo | "$1" && "$@" ${HOME} 2>/dev/null local export
+x=1 awk test awk -eu export test "$1" cd grep
+2>/dev/null -eu test 'quoted text' sed test "$1" $(pwd) 'quoted text' export
+	x=1 printf 2>/dev/null | -eu local | awk export local echo readonly readonly then
+/usr/bin echo local -eu 'quoted text'
+	--verbose x=1 awk 2>/dev/null echo ${HOME} cd echo local "$@" 'quoted text'
+		sed awk printf "$@" x=1 sed
+"$1" && echo ${HOME} echo ${HOME} 2>/dev/null
+"$1" then | 2>/dev/null done local $(pwd)
+x=1 readonly "$1" test 2>/dev/null local /usr/bin && --verbose &&
+	2>/dev/null "$@" echo "$@" -eu "$@" && 'quoted text' printf export && 2>/dev/null
+		sed "$@" printf echo "$@" readonly sed --verbose
+	local && echo export cd test
+grep cd then 'quoted text' -eu test "$@" cd grep grep
+	local printf /usr/bin "$@" | local export echo then "$1" --verbose /usr/bin
+	done printf export --verbose --verbose 2>/dev/null "$@" && echo echo printf cd
+	local cd "$@" && printf
+		'quoted text' printf -eu local awk | printf echo
+		--verbose | /usr/bin ${HOME} -eu
+		test 'quoted text' "$1" export
+		grep | $(pwd) 'quoted text' done | x=1 --verbose
+/usr/bin local "$@" export readonly
+		sed then printf && done done echo test -eu test | sed && readonly
+-eu readonly done 'quoted text' $(pwd) "$1" 'quoted text' /usr/bin /usr/bin
+		&& readonly 2>/dev/null 'quoted text' readonly done test sed cd cd readonly
+	| done test printf x=1 then 'quoted text' sed awk
+		&& 2>/dev/null grep /usr/bin /usr/bin && | --verbose awk grep x=1 | ${HOME}
+done ${HOME} printf then printf $(pwd) then && sed test printf 2>/dev/null
+	test 'quoted text' local grep then -eu $(pwd) grep test 2>/dev/null
+	"$@" local printf 'quoted text'
+	-eu readonly && test && local sed echo grep "$1" && x=1 test --verbose
+	${HOME} ${HOME} readonly
+local | local echo done sed && then readonly 2>/dev/null |
+		local cd echo printf 'quoted text'
+		$(pwd) grep awk then printf cd 2>/dev/null sed $(pwd)
+		$(pwd) --verbose "$@" x=1 readonly x=1 grep awk -eu -eu
+| && --verbose "$@" readonly printf
+		| export sed awk echo printf -eu $(pwd) done cd echo 'quoted text'
+		sed | readonly "$1" local printf
+	printf export ${HOME} "$1" --verbose x=1 'quoted text' cd echo readonly
+	printf && -eu /usr/bin ${HOME} 2>/dev/null ${HOME} test 2>/dev/null
+		cd test done -eu echo 'quoted text'
+/usr/bin done "$@" sed 2>/dev/null ${HOME} cd "$@" printf
+readonly local $(pwd) | ${HOME} then printf /usr/bin export
+printf grep "$1" -eu echo cd x=1 test "$1" --verbose 2>/dev/null test "$1"
+done && && cd echo /usr/bin ${HOME}
+"$@" printf x=1 done sed --verbose 2>/dev/null
+done readonly test ${HOME} readonly x=1 -eu 2>/dev/null
+"$1" /usr/bin 2>/dev/null "$@" then $(pwd) cd /usr/bin $(pwd) cd --verbose grep
+	2>/dev/null then sed then printf then --verbose grep | cd "$@" x=1 'quoted text'
+	2>/dev/null done cd x=1 echo grep -eu /usr/bin x=1 "$@" echo
+	${HOME} grep /usr/bin --verbose 'quoted text' -eu sed |
+${HOME} -eu done readonly echo x=1 then sed readonly | && x=1
+	sed ${HOME} 2>/dev/null echo -eu 2>/dev/null 'quoted text' && local
+		sed --verbose --verbose done $(pwd) $(pwd) local
+printf 2>/dev/null sed "$@" $(pwd) --verbose readonly sed "$@" cd grep printf
+x=1 --verbose --verbose printf $(pwd) awk readonly $(pwd)
+		2>/dev/null local | 2>/dev/null ${HOME} then
+	/usr/bin then && test awk grep export echo x=1 "$@" /usr/bin
+then 2>/dev/null ${HOME} printf x=1 "$1" x=1 local cd 'quoted text' 'quoted text'
+done local awk local export cd --verbose && done test
+		then printf /usr/bin $(pwd)
+	export -eu ${HOME} printf export /usr/bin "$@" echo then
+	sed "$1" "$@" "$1" test x=1 export
+	&& echo test printf sed x=1
+		awk 'quoted text' 2>/dev/null readonly -eu x=1 test printf test
+export && ${HOME} echo && test awk 2>/dev/null sed
+	"$1" then 'quoted text' 'quoted text'
+&& --verbose done local /usr/bin x=1 2>/dev/null ${HOME} $(pwd) x=1 ${HOME} awk
+/usr/bin -eu cd 2>/dev/null
+	grep readonly 2>/dev/null done
+		x=1 2>/dev/null -eu readonly "$1" && | echo --verbose x=1 $(pwd) --verbose
+grep -eu "$1" printf && "$1" grep $(pwd)
+cd export then --verbose sed x=1 /usr/bin
+	"$@" cd | --verbose | echo | test
+| --verbose && done $(pwd) $(pwd) "$1"
+		$(pwd) local "$1" cd 'quoted text' cd --verbose done "$1" ${HOME}
+		--verbose ${HOME} then export done x=1 then readonly
+	echo x=1 printf awk 'quoted text' ${HOME}
+	echo 'quoted text' 2>/dev/null
+export "$1" test --verbose $(pwd) 'quoted text' ${HOME} awk /usr/bin
+		test "$@" local local $(pwd) awk then &&
+cd x=1 'quoted text' &&
+	"$1" then 'quoted text' 'quoted text' 'quoted text' 2>/dev/null x=1 x=1 awk x=1
+	export local then x=1 printf sed then cd local | "$@" 2>/dev/null printf
+grep --verbose --verbose 2>/dev/null awk --verbose
+	'quoted text' "$1" readonly
+	echo -eu done "$1" awk test $(pwd) then cd && x=1 printf "$1" --verbose
+$(pwd) "$@" | sed | $(pwd) cd readonly "$@" "$@" 2>/dev/null
+	awk test sed sed -eu --verbose
+2>/dev/null /usr/bin /usr/bin done --verbose "$1"
+	done cd local then /usr/bin awk awk echo -eu printf "$@" "$1"
+printf readonly export "$@" "$@" echo sed "$1" | /usr/bin /usr/bin
+grep ${HOME} done grep 'quoted text' "$@" x=1 awk $(pwd)
+grep 'quoted text' printf readonly printf -eu /usr/bin grep ${HOME} && /usr/bin
+${HOME} export echo --verbose && then echo readonly -eu
+		readonly 2>/dev/null sed awk then | "$@" ${HOME} then grep
+	export printf readonly $(pwd) $(pwd) 'quoted text' export export
+"$@" x=1 sed 2>/dev/null && "$@" readonly then 2>/dev/null "$1" --verbose
+		${HOME} 2>/dev/null done x=1 test printf sed "$@" done done | awk -eu test x=1
+	| printf 2>/dev/null ${HOME} grep done x=1 'quoted text'
+local readonly x=1 ${HOME} -eu -eu
+	${HOME} "$@" grep done ${HOME} grep ${HOME} readonly
+| | test printf && local echo "$@" echo cd
+&& $(pwd) readonly local | && ${HOME} 2>/dev/null readonly "$1"
+	2>/dev/null done echo "$1" export printf local then local awk
+		grep echo $(pwd) then readonly then ${HOME} 2>/dev/null export
+		| grep ${HOME} ${HOME} sed 2>/dev/null ${HOME} cd test cd x=1 printf ${HOME}
+		readonly "$@" "$1" then readonly x=1 test
+'quoted text' -eu --verbose /usr/bin 2>/dev/null 'quoted text' done $(pwd)
+		'quoted text' cd && x=1 --verbose done ${HOME} readonly
+sed cd done done cd 'quoted text'
+		| "$1" echo "$@" export export local | 2>/dev/null x=1 sed 2>/dev/null sed
+		-eu 'quoted text' echo ${HOME} echo ${HOME} 2>/dev/null printf
+-eu awk 2>/dev/null && $(pwd) export
+		echo done | 2>/dev/null printf test
+-eu ${HOME} && then | awk sed grep test --verbose
+${HOME} sed awk test cd then
+/usr/bin "$1" $(pwd) -eu x=1
+cd $(pwd) cd | 'quoted text' then local $(pwd) "$1"
+	| 2>/dev/null --verbose awk
+		${HOME} --verbose sed then 'quoted text' local echo export
+	$(pwd) export grep echo done 'quoted text'
+		x=1 ${HOME} 2>/dev/null echo -eu grep
+then -eu readonly readonly export 'quoted text' readonly done awk "$@" "$@"
+		"$@" | printf "$1" "$@" $(pwd) x=1 then then "$1" echo --verbose "$@" $(pwd)
+		cd export then then "$@" "$@" readonly "$@"
+"$@" cd test /usr/bin readonly 2>/dev/null
+	grep 2>/dev/null awk readonly
+		| export local "$@" cd readonly /usr/bin cd x=1 ${HOME} "$1" | local x=1 test
+	printf --verbose printf -eu
+	echo /usr/bin sed local x=1 echo local
+	&& echo && --verbose 2>/dev/null local echo local echo sed
+		local done ${HOME} readonly 2>/dev/null
+		local -eu printf then export echo export then readonly then "$@" $(pwd) ${HOME}
+		awk grep x=1 test printf | then export printf export echo sed local
+| 'quoted text' sed && $(pwd) $(pwd) x=1 -eu done "$@"
+x=1 grep cd done $(pwd) x=1 --verbose cd -eu printf | cd then "$1" awk /usr/bin
+		$(pwd) done printf x=1 | x=1 $(pwd) /usr/bin --verbose ${HOME} $(pwd) done
+	export 2>/dev/null readonly "$@" sed awk ${HOME}
+		&& local 2>/dev/null local local local local done readonly done 2>/dev/null
+awk ${HOME} x=1 grep 2>/dev/null
+| printf | local local done
+"$1" cd cd ${HOME} -eu -eu cd local ${HOME} sed "$1" "$1" && /usr/bin
+	cd cd awk sed sed grep "$1" echo readonly test test "$1" && printf
+	export /usr/bin 2>/dev/null 'quoted text' /usr/bin grep x=1 2>/dev/null
+		cd "$1" done --verbose /usr/bin done grep awk awk readonly
+	'quoted text' sed x=1 $(pwd) echo export 'quoted text' echo
+printf && x=1 local -eu test
+		local "$@" /usr/bin 'quoted text' --verbose && $(pwd)
+		'quoted text' $(pwd) 2>/dev/null
+readonly 'quoted text' awk | "$@" done -eu $(pwd) done export --verbose
+	local printf grep local local | "$1" echo -eu | ${HOME}
+		local test "$1" then awk
+	readonly export "$@" grep awk "$@" | readonly cd x=1 export "$@" readonly
+	then export "$@" $(pwd) grep then 'quoted text'
+	$(pwd) echo done done 'quoted text' sed && awk -eu | cd /usr/bin 2>/dev/null awk
+echo 'quoted text' printf local 'quoted text'
+	"$1" cd ${HOME} 'quoted text' $(pwd) | readonly 'quoted text' -eu "$@"
+	2>/dev/null done | grep cd export readonly printf test -eu /usr/bin
+	then $(pwd) cd sed "$@" done local x=1 export grep -eu
+	test then "$@" done ${HOME} ${HOME} then cd "$1" ${HOME}
+	&& "$@" test /usr/bin done done | /usr/bin | $(pwd) "$1" ${HOME} --verbose
+| grep grep done export
+	"$1" x=1 printf $(pwd) then /usr/bin "$1" local then grep | -eu cd --verbose
+		readonly then test --verbose --verbose
+	echo then "$@" then local sed ${HOME} local readonly
+printf echo test then then then ${HOME} && readonly
+printf local "$1" -eu local sed cd local --verbose -eu grep
+		${HOME} -eu 'quoted text' printf printf && sed 2>/dev/null export 'quoted text'
+awk | echo local local grep 'quoted text'
+		readonly test x=1 export printf "$@" x=1 "$1" "$1" $(pwd) awk x=1 sed test
+		cd cd readonly /usr/bin $(pwd) done ${HOME} cd awk cd &&
+	then $(pwd) /usr/bin 2>/dev/null $(pwd) export ${HOME} "$1" && && 2>/dev/null
+		-eu sed cd 'quoted text' --verbose printf "$1" export awk done
+export /usr/bin 'quoted text' done
+		readonly done readonly && ${HOME} x=1 && local done done done grep echo
+/usr/bin echo $(pwd) grep done "$1" test grep cd && done $(pwd)
+| echo 'quoted text' --verbose printf local readonly readonly sed $(pwd)
+		test | 'quoted text' sed /usr/bin -eu awk
+	sed then then echo --verbose printf awk
+		&& sed && /usr/bin export cd "$1"
+		x=1 then 'quoted text' then
+		local "$@" && 'quoted text' done export grep | --verbose
+		then "$@" 'quoted text' printf then | then $(pwd)
+"$1" x=1 cd /usr/bin local export cd grep 2>/dev/null && readonly && sed
+	done x=1 "$1" then test export x=1 | x=1 /usr/bin -eu readonly test grep $(pwd)
+		/usr/bin readonly sed export cd cd ${HOME} && | local then | $(pwd) --verbose |
+	$(pwd) grep x=1 /usr/bin export ${HOME} awk | && "$1" then local /usr/bin 'quoted text'
+	cd readonly ${HOME} echo local ${HOME} 2>/dev/null "$1" "$1" ${HOME}
+		awk "$@" sed test "$@"
+	printf readonly | 2>/dev/null | test sed echo done then
+then ${HOME} x=1 && && awk "$1" readonly x=1 | x=1 /usr/bin $(pwd)
+	export local then x=1 $(pwd) -eu done --verbose
+	local -eu ${HOME} x=1 | --verbose $(pwd) then awk
+		--verbose printf && ${HOME}
+	/usr/bin | && | | 2>/dev/null /usr/bin
+test then test && | /usr/bin
+x=1 readonly local export test 'quoted text' --verbose sed /usr/bin
+		"$@" readonly cd readonly "$@" -eu -eu
+	x=1 x=1 $(pwd) | readonly 'quoted text'
+		test $(pwd) "$1" test echo sed export export local cd export 2>/dev/null --verbose
+	"$1" local grep /usr/bin && readonly then then printf
+	done x=1 readonly ${HOME} test local
+--verbose $(pwd) /usr/bin
+${HOME} readonly local "$@" awk local --verbose test 2>/dev/null "$@"
+		readonly local sed local /usr/bin
+	export x=1 $(pwd) 2>/dev/null done --verbose grep | x=1 local 2>/dev/null test
+		done /usr/bin x=1 local local
+		then echo grep cd local |
+		| readonly sed done echo 'quoted text'
+		x=1 local grep /usr/bin grep -eu test
+| sed export export test
+2>/dev/null x=1 sed cd "$@" test --verbose export printf sed test
+	"$@" --verbose echo -eu sed $(pwd) /usr/bin ${HOME} then grep 2>/dev/null | then
+		2>/dev/null /usr/bin export && local then readonly $(pwd)
+		cd && echo echo echo 'quoted text' ${HOME} echo test --verbose awk 'quoted text'
+		export sed --verbose export "$1" "$1" 2>/dev/null -eu done --verbose awk $(pwd)
+	"$@" sed local local && export cd
+| x=1 then /usr/bin printf
+		echo then ${HOME} /usr/bin export "$1" then ${HOME} then echo
+	export 2>/dev/null awk 2>/dev/null
+$(pwd) "$1" x=1 local test $(pwd) 2>/dev/null "$1" readonly
+printf cd awk test ${HOME} echo then sed printf "$@" echo | sed printf
+	sed "$1" 2>/dev/null local readonly printf test "$@" 'quoted text'
+test test 'quoted text' $(pwd) echo | readonly 'quoted text' /usr/bin
+"$@" | 2>/dev/null /usr/bin | $(pwd) export printf
+--verbose test export
+		cd export -eu then 'quoted text' 2>/dev/null cd
+	echo awk ${HOME} "$1" export echo 'quoted text'
+"$1" && printf export | | then
+		-eu "$1" | x=1 x=1 sed $(pwd) readonly export
+		&& cd awk export done --verbose
+${HOME} awk echo && x=1 | /usr/bin echo echo then grep then &&
+		echo | echo | readonly | export "$1" "$1" "$1"
+		x=1 local printf $(pwd) ${HOME} 'quoted text' | export printf
+$(pwd) "$1" --verbose 2>/dev/null awk && 'quoted text'
+	cd /usr/bin echo $(pwd) echo done --verbose 2>/dev/null awk
+	-eu sed $(pwd) cd then export sed x=1 | 2>/dev/null 2>/dev/null
+-eu ${HOME} printf test ${HOME} grep echo printf awk x=1 $(pwd)
+		readonly "$1" 'quoted text' printf 'quoted text' local local "$@"
+	'quoted text' echo awk -eu /usr/bin "$@"
+		local grep $(pwd) x=1 2>/dev/null 2>/dev/null
+		2>/dev/null sed readonly "$1" $(pwd) then | local ${HOME} then sed awk readonly
+		test /usr/bin ${HOME} printf 'quoted text'
+then cd $(pwd) cd readonly awk ${HOME} awk
+	${HOME} && echo done "$1" export --verbose
+		awk ${HOME} done test -eu x=1 readonly ${HOME} echo awk "$@" grep readonly
+	$(pwd) test --verbose --verbose done export "$@" "$1"
+		-eu sed && --verbose cd "$1" sed -eu $(pwd) 2>/dev/null ${HOME} "$@" /usr/bin
+		local "$1" test x=1 ${HOME} done
+	cd -eu $(pwd) "$1" readonly 2>/dev/null echo
+	then "$@" awk -eu grep then printf "$1" 2>/dev/null then x=1 readonly
+	readonly sed cd local awk sed readonly sed
+		"$1" awk && printf local printf done && then 2>/dev/null $(pwd)
+	local cd "$@" | "$@" readonly $(pwd) readonly | printf --verbose "$@" $(pwd)
+	readonly cd then ${HOME} -eu awk then -eu /usr/bin $(pwd)
+		export test $(pwd) 'quoted text' "$1" echo ${HOME} export test -eu
+		printf ${HOME} export test cd 'quoted text' test test $(pwd) --verbose
+	"$@" awk 2>/dev/null then -eu ${HOME} "$@" awk "$1"
+		done ${HOME} "$@" grep echo ${HOME} then grep awk sed "$@" && printf done
+-eu readonly cd export readonly cd awk
+then local x=1 cd export $(pwd) 2>/dev/null "$1" then
+grep echo sed readonly x=1 sed export 2>/dev/null -eu
+sed then awk readonly then ${HOME} 2>/dev/null export readonly cd 'quoted text'
+		"$1" awk cd -eu && && | x=1 cd awk echo "$@" 'quoted text' done x=1 'quoted text'
+	| | awk --verbose export done
+	grep "$@" --verbose -eu grep 2>/dev/null done printf printf
+awk -eu /usr/bin --verbose echo local ${HOME}
+		test | done -eu 2>/dev/null done
+done "$@" /usr/bin /usr/bin "$1" ${HOME}
+done $(pwd) printf 'quoted text' then -eu x=1
+	printf readonly export local -eu then done done test
+		test $(pwd) "$@" test then cd printf done export readonly export
+	x=1 -eu grep && sed 2>/dev/null
+	-eu --verbose test echo "$@" then 2>/dev/null readonly
+	/usr/bin "$@" ${HOME} /usr/bin "$1" done then sed /usr/bin
+test /usr/bin 2>/dev/null --verbose "$1" then x=1 export
+done x=1 done export $(pwd) 2>/dev/null -eu done echo test
+		export echo sed local -eu | "$1" | 2>/dev/null 2>/dev/null
+		/usr/bin sed "$@" export sed export -eu 'quoted text' -eu | grep "$@" ${HOME}
+	done grep --verbose && $(pwd) "$1" /usr/bin cd test ${HOME} awk x=1 readonly
+		/usr/bin --verbose local ${HOME} | readonly && && 'quoted text' echo
+	-eu export grep x=1 2>/dev/null
+		'quoted text' x=1 $(pwd) /usr/bin --verbose test $(pwd) -eu --verbose
+$(pwd) local "$1" sed awk sed export | local export grep | echo
+		x=1 $(pwd) then ${HOME} "$@" sed "$@" -eu 'quoted text' awk -eu -eu
+	x=1 test && "$1" /usr/bin printf 'quoted text'
+	2>/dev/null /usr/bin -eu readonly
+		readonly test --verbose 2>/dev/null done
+		export /usr/bin $(pwd) grep "$1" echo local grep
+	/usr/bin ${HOME} printf test "$1" && "$1" | x=1 echo "$1" --verbose
+		"$@" /usr/bin readonly echo "$@" awk -eu grep test | printf
+		sed export $(pwd) echo "$1" readonly $(pwd) then -eu done /usr/bin
+		${HOME} sed local 'quoted text' 'quoted text'
+		cd "$@" printf awk done done cd test test grep | --verbose
+		$(pwd) readonly /usr/bin x=1
+export -eu then 'quoted text' "$1" --verbose awk
+	test $(pwd) ${HOME} 'quoted text' readonly awk | | && "$@" sed "$@"
+	x=1 | test sed $(pwd) done /usr/bin test export
+	sed test "$1" done echo -eu echo x=1 "$@" 'quoted text' awk "$@" export
+export x=1 | && $(pwd) sed
+2>/dev/null && readonly done
+		"$@" "$@" echo | && printf ${HOME} "$@" /usr/bin /usr/bin |
+		--verbose local sed echo cd /usr/bin
+		printf | printf echo awk && export then readonly 2>/dev/null echo test ${HOME}
+	"$1" then test grep echo cd awk awk x=1 "$@" x=1 2>/dev/null
+		'quoted text' && test then "$1" 2>/dev/null
+		/usr/bin ${HOME} -eu "$1" test export 'quoted text' awk
+&& done 'quoted text' readonly -eu export local /usr/bin 'quoted text' sed cd
+-eu test export x=1 export awk $(pwd) cd "$1" done echo sed
+		local | "$1" sed local then -eu echo
+		cd && export 2>/dev/null --verbose cd 2>/dev/null
+		readonly 2>/dev/null local && 'quoted text' echo && "$@" "$@"
+"$1" 'quoted text' echo
+		test --verbose 2>/dev/null echo cd --verbose
+	export "$1" echo then | 'quoted text' echo "$1" "$@" x=1 awk "$1" local
+		$(pwd) -eu export grep
+"$@" /usr/bin cd 'quoted text' local | /usr/bin
+		cd "$@" $(pwd) --verbose sed test grep "$@" x=1
+	awk 'quoted text' "$@" sed | "$@" grep
+| 2>/dev/null -eu 2>/dev/null "$1" 'quoted text' then done
+	cd 'quoted text' awk x=1
+	then grep "$1" sed && | readonly printf cd --verbose | echo &&
+	awk sed then echo --verbose then test awk grep "$@" "$@" "$@" printf
+		export awk "$1" readonly cd "$@" 2>/dev/null
+	"$@" x=1 done printf cd /usr/bin "$1" grep $(pwd) /usr/bin
+test echo $(pwd) 2>/dev/null grep ${HOME} echo local done | awk "$1" -eu
+grep | grep readonly 2>/dev/null && /usr/bin && 'quoted text' cd export
+'quoted text' done echo x=1 then | done --verbose $(pwd) export grep
+x=1 cd cd --verbose export 'quoted text' 2>/dev/null 2>/dev/null readonly
+then && --verbose echo done test
+		then /usr/bin && printf then local "$@" cd printf local cd 2>/dev/null | done
+	2>/dev/null done done done done /usr/bin
+		printf then sed local --verbose export | /usr/bin awk
+		&& x=1 sed sed sed /usr/bin printf
+"$@" printf x=1 && -eu --verbose --verbose test /usr/bin && 2>/dev/null test --verbose
+		&& then printf test done | printf --verbose
+		export readonly --verbose
+local 'quoted text' ${HOME}
+readonly ${HOME} readonly test printf
+	${HOME} readonly awk readonly readonly && --verbose -eu "$@" sed test printf readonly
+		--verbose cd -eu $(pwd) ${HOME} awk export sed 'quoted text' 'quoted text' done
+	-eu awk local test x=1 'quoted text'
+		| 'quoted text' grep awk printf echo | "$1" export $(pwd) export $(pwd) sed "$@"
+		printf "$@" ${HOME} export ${HOME} local echo local grep 'quoted text' &&
+		awk readonly x=1 | test
+"$@" -eu grep --verbose done sed 'quoted text' printf x=1
+	awk awk printf 2>/dev/null export ${HOME} local test "$1" printf $(pwd)
+echo awk 2>/dev/null printf awk then readonly 'quoted text' ${HOME} awk
+		readonly sed "$1" 'quoted text' cd | then
+	readonly then x=1 cd test 2>/dev/null --verbose printf 2>/dev/null --verbose local
+		sed cd ${HOME} export x=1 x=1 then "$1" -eu
+readonly x=1 done awk x=1 cd echo
+		'quoted text' test ${HOME} -eu ${HOME} && awk done printf
+		'quoted text' ${HOME} -eu | cd done awk local /usr/bin "$@" "$@" then export |
+		awk "$@" printf echo 'quoted text'
+		grep /usr/bin "$@" grep
+	awk done "$@" grep local cd then $(pwd) printf "$@" then then grep "$1" grep
+	sed x=1 test then ${HOME} "$1" cd --verbose -eu -eu cd "$1" local cd
+	local then ${HOME} echo /usr/bin printf /usr/bin | local grep done export
+	${HOME} -eu local awk awk 2>/dev/null x=1
+		-eu readonly && printf local "$1" done local
+	&& "$1" -eu x=1 2>/dev/null | printf | --verbose
+printf sed cd test printf sed
+cd --verbose | local -eu done local echo cd sed && $(pwd)
+&& "$1" /usr/bin local -eu awk $(pwd) echo 2>/dev/null export "$1" local echo cd
+		$(pwd) && && then readonly
+sed $(pwd) sed -eu 2>/dev/null -eu printf 2>/dev/null export
+	printf $(pwd) then cd done "$1" && test && printf $(pwd) | test grep | ${HOME}
+printf x=1 echo 'quoted text' local then grep export
+"$@" 2>/dev/null && cd /usr/bin export grep 2>/dev/null | then
+		| echo local $(pwd) readonly done export
+--verbose "$@" grep echo "$@" export grep export
+-eu ${HOME} test --verbose 2>/dev/null | awk
+		&& cd --verbose ${HOME} local 2>/dev/null
+2>/dev/null cd | grep export printf ${HOME} x=1
+		| 2>/dev/null sed | local /usr/bin grep ${HOME}
+echo sed ${HOME} && then /usr/bin "$1" x=1 echo x=1 printf "$@" test --verbose
+	x=1 then --verbose local ${HOME} 'quoted text' $(pwd) x=1 then $(pwd) cd
+	export "$@" cd | ${HOME} x=1 /usr/bin readonly grep
+		sed grep 2>/dev/null --verbose && -eu local
+		| then -eu $(pwd) $(pwd) readonly --verbose sed echo sed done cd
+'quoted text' -eu "$@"
+	then awk sed ${HOME} 'quoted text' && local grep 2>/dev/null -eu ${HOME}
+"$1" export readonly grep -eu test test
+	-eu 'quoted text' awk -eu /usr/bin ${HOME}
+| "$1" local 2>/dev/null
+	readonly 2>/dev/null --verbose ${HOME}
+&& done test -eu then "$1" $(pwd) --verbose awk "$@"
+		"$@" done readonly then 'quoted text'
+x=1 "$1" x=1 -eu "$@" /usr/bin x=1 ${HOME} $(pwd) cd | echo x=1 ${HOME}
+test awk ${HOME} $(pwd) grep export test --verbose echo
+		export then sed grep "$@" $(pwd) printf grep ${HOME} | --verbose grep test &&
+/usr/bin 2>/dev/null test --verbose -eu --verbose echo sed
+local then sed then grep && 2>/dev/null "$1" | "$1" sed export readonly
+export ${HOME} ${HOME} ${HOME} sed grep "$1" awk grep cd done
+	| x=1 x=1 'quoted text' | grep && --verbose test then $(pwd)
+		echo | 2>/dev/null && "$@" sed 'quoted text'
+	| --verbose then --verbose local local done ${HOME} ${HOME} export
+grep "$@" awk test cd sed ${HOME} 2>/dev/null local echo ${HOME} $(pwd) grep "$1"
+		echo "$1" x=1 2>/dev/null done grep grep cd $(pwd) then $(pwd) sed --verbose
+test | | readonly cd grep done 2>/dev/null cd test && "$@"
+		awk test export readonly grep /usr/bin x=1 /usr/bin test readonly readonly readonly
+		test then export grep 2>/dev/null
+		$(pwd) && cd x=1 ${HOME} /usr/bin printf
+		awk readonly x=1 "$@" export cd "$1" 2>/dev/null
+printf $(pwd) $(pwd) grep x=1
+		"$1" --verbose readonly done printf awk printf -eu 'quoted text' export 2>/dev/null
+${HOME} --verbose /usr/bin 'quoted text' sed grep test "$@"
+awk cd grep 'quoted text' awk ${HOME} readonly test x=1 -eu | awk && $(pwd)
+		"$1" $(pwd) -eu /usr/bin
+		done ${HOME} $(pwd) local
+		$(pwd) --verbose cd "$1"
+| "$1" grep "$@" done 'quoted text' done --verbose done readonly x=1 'quoted text'
+'quoted text' sed readonly -eu
+		"$1" sed test cd x=1
+cd local then printf awk ${HOME}
+		readonly cd cd awk printf
+		--verbose done | then test | sed echo done done
+x=1 "$1" grep done && readonly
+		x=1 test local done readonly 'quoted text' local printf "$1" 'quoted text'
+--verbose "$@" export --verbose grep
+		$(pwd) -eu | "$@" awk sed "$@" export export
+	$(pwd) local $(pwd) done
+	awk awk && 'quoted text' x=1 readonly /usr/bin
+		grep export readonly 2>/dev/null $(pwd) echo printf x=1
+"$1" test --verbose grep grep && echo local then done "$@"
+	done -eu -eu -eu done
+	--verbose then export 2>/dev/null ${HOME} awk /usr/bin $(pwd) grep test
+x=1 export "$1" awk sed then printf printf printf
+&& 'quoted text' export $(pwd) "$@" "$1" -eu readonly readonly
+then "$@" then printf "$1" x=1 then
+	2>/dev/null 'quoted text'
+		grep awk "$1" x=1 export 2>/dev/null $(pwd)
+		x=1 | 'quoted text' grep printf
+printf "$1" 2>/dev/null cd | test then 'quoted text'
+--verbose "$@" --verbose -eu local done awk "$@" "$1" $(pwd) |
+awk grep echo "$1" | /usr/bin ${HOME} done
+grep && export | -eu -eu && -eu 'quoted text' grep test test sed echo
+	readonly done /usr/bin awk && done then
+		--verbose -eu | echo $(pwd) | && "$@" ${HOME} then echo "$@" && && $(pwd)
+| export x=1 awk awk export x=1 awk then && "$@"
+export 2>/dev/null cd awk echo echo /usr/bin x=1
+		export test -eu local x=1 "$@" local export
+		export /usr/bin "$@" "$1" -eu printf awk ${HOME}
+	x=1 local local | grep "$1" sed "$@" "$1" $(pwd) grep
+sed $(pwd) awk awk test && sed echo done -eu
+	$(pwd) done ${HOME} | "$1" "$@" --verbose sed echo -eu "$1" cd
+	x=1 'quoted text' done grep done local "$1" "$1" 2>/dev/null
+local && export done readonly printf then
+	&& test $(pwd) awk 'quoted text' 'quoted text' echo -eu
+	sed export "$@" then done done ${HOME} awk &&
+		readonly printf test printf local
+		| sed 'quoted text' done 'quoted text' test --verbose sed local
+--verbose awk && x=1 ${HOME} x=1 "$@" readonly "$@" "$1" cd readonly grep | printf
+--verbose $(pwd) "$@" ${HOME} test $(pwd) 'quoted text' local --verbose "$1"
+		x=1 sed $(pwd) local /usr/bin 2>/dev/null awk --verbose grep then echo /usr/bin
+		-eu sed 'quoted text' export export printf 'quoted text' "$@" -eu printf cd
+export done done --verbose test | && 2>/dev/null "$@" -eu local
+		--verbose awk "$1" readonly local cd then then "$1" $(pwd) readonly
+		cd cd 'quoted text' echo awk cd printf then --verbose
+		test "$@" "$@" printf export readonly test grep then |
+	2>/dev/null "$1" test test /usr/bin "$1" 2>/dev/null
+-eu "$@" test echo done local
+echo sed ${HOME} sed --verbose --verbose -eu "$@" local export
+		/usr/bin test local cd printf -eu printf -eu && test
+	cd x=1 readonly -eu --verbose /usr/bin echo -eu $(pwd)
+		&& x=1 then /usr/bin sed done local "$1" sed readonly
+	done /usr/bin "$@" "$1" awk test -eu
+	export --verbose grep readonly
+sed | printf -eu "$1" echo 2>/dev/null then test "$@" then grep
+printf printf test export 2>/dev/null then "$1" grep
+| cd test grep x=1 "$@" "$1" export
+		export cd ${HOME} --verbose ${HOME} /usr/bin 2>/dev/null
+cd printf local $(pwd) export
+	awk done --verbose x=1 ${HOME} awk ${HOME}
+	cd readonly 2>/dev/null readonly -eu sed ${HOME} --verbose export /usr/bin
+grep then then 'quoted text' 2>/dev/null cd echo "$1" cd x=1 2>/dev/null
+	| | sed | printf grep test $(pwd) then $(pwd) $(pwd)
+	export export sed then "$@" sed test export /usr/bin printf then done 2>/dev/null
+		--verbose --verbose then done 'quoted text' printf $(pwd) sed export
+2>/dev/null && test echo -eu
+	"$1" echo && -eu sed --verbose $(pwd) $(pwd) 2>/dev/null
+		| $(pwd) | grep && readonly && 2>/dev/null printf sed cd then sed "$@" then
+"$@" test grep ${HOME} | | local 'quoted text' awk export $(pwd) 'quoted text'
+	--verbose 'quoted text' done
+	2>/dev/null "$@" ${HOME} 'quoted text' awk printf -eu
+		sed "$1" $(pwd) | "$1" export /usr/bin
+	sed --verbose "$@" sed echo done sed $(pwd) done readonly local ${HOME}
+		"$@" local && test $(pwd) && "$@" awk x=1 'quoted text' export
+sed done test grep awk awk test
+		grep /usr/bin awk "$@"
+echo then test printf --verbose /usr/bin | test export awk "$1" awk
+		'quoted text' readonly then test
+		&& ${HOME} /usr/bin "$@" ${HOME} done grep x=1 "$1" local "$@" echo echo 'quoted text'
+-eu 2>/dev/null 'quoted text' x=1 "$1" readonly export
+printf "$1" -eu sed "$1" 'quoted text' grep test -eu | awk -eu $(pwd)
+readonly echo test && local grep --verbose printf 2>/dev/null then "$1" 2>/dev/null
+-eu $(pwd) && --verbose awk --verbose --verbose
+	export --verbose grep cd then ${HOME}
+		-eu "$@" awk local awk test echo 2>/dev/null
+	awk printf grep local | then
+		-eu $(pwd) 2>/dev/null sed local done "$1" echo 2>/dev/null
+		sed ${HOME} sed x=1 "$@" && test "$1" sed grep local awk 'quoted text' --verbose
+readonly cd sed echo grep "$1" $(pwd) export "$1" && sed cd "$@" readonly
+		| then /usr/bin readonly /usr/bin -eu export test readonly /usr/bin
+grep echo "$1" readonly ${HOME}
+test grep && --verbose "$1" then /usr/bin
+		x=1 test printf | grep x=1 --verbose --verbose "$1" /usr/bin 2>/dev/null
+		done cd /usr/bin test echo x=1 ${HOME} 2>/dev/null grep sed grep ${HOME}
+		then && export 'quoted text' 'quoted text' grep test export
+cd && test grep test -eu export /usr/bin printf readonly --verbose
+		awk "$@" test ${HOME} readonly
+"$1" | /usr/bin --verbose sed 'quoted text' sed "$@"
+'quoted text' printf then 'quoted text' done -eu
+		export 2>/dev/null "$@" readonly
+done sed awk "$1" 'quoted text' -eu x=1 readonly done 2>/dev/null done
+	${HOME} 'quoted text' 'quoted text' export ${HOME} &&
+	echo 'quoted text' grep export cd export local && && x=1 readonly done echo
+sed | 'quoted text' awk 2>/dev/null --verbose readonly export --verbose
+		--verbose test "$@" local 'quoted text' | echo then $(pwd)
+		$(pwd) printf "$@" export "$1" 2>/dev/null echo local awk "$1" done &&
+		export local $(pwd) --verbose export -eu "$1" test 2>/dev/null | printf && readonly
+		sed ${HOME} "$@" cd | ${HOME} done printf printf ${HOME} sed ${HOME}
+		awk readonly $(pwd) 'quoted text' /usr/bin $(pwd) | local /usr/bin
+grep 2>/dev/null 'quoted text' 'quoted text' done cd sed
+		done sed readonly done printf -eu "$@" /usr/bin
+		2>/dev/null export "$1" ${HOME} then /usr/bin sed test
+printf test done echo /usr/bin grep sed 2>/dev/null grep
+| sed x=1 "$@" cd -eu readonly local
+	${HOME} "$@" $(pwd) cd x=1 export then /usr/bin | sed printf echo && 'quoted text'
+		export 'quoted text' cd | "$1" x=1 /usr/bin readonly awk
+cd /usr/bin ${HOME} local done grep 'quoted text'
+then --verbose local /usr/bin /usr/bin test 2>/dev/null x=1
+		--verbose /usr/bin readonly printf && ${HOME}
+| printf echo 'quoted text' /usr/bin 'quoted text' 2>/dev/null --verbose
+		sed test "$1" && awk 'quoted text'
+printf sed local then 2>/dev/null
+"$1" x=1 grep grep 'quoted text' --verbose test readonly export 'quoted text'
+		echo "$1" readonly 2>/dev/null ${HOME} -eu | then
+		x=1 printf test && --verbose printf printf
+local "$@" local echo done local printf
+		local "$1" 'quoted text' ${HOME} -eu -eu grep local "$1" && "$@" $(pwd)
+echo grep export cd readonly -eu "$1" $(pwd) done
+		readonly x=1 --verbose export test echo x=1 test grep test
+	then cd readonly done | awk -eu "$@" done test
+printf local echo done echo export grep "$1" && $(pwd) done
+		grep then x=1 readonly then cd then
+	grep readonly | -eu ${HOME} $(pwd) 2>/dev/null && then local grep local
+	'quoted text' done && printf test sed local -eu "$@"
+		readonly echo readonly local awk local readonly ${HOME} && readonly
+"$@" --verbose && $(pwd) ${HOME} local
+	"$@" ${HOME} ${HOME} "$1" "$1" export export | 2>/dev/null 2>/dev/null
+		&& then 2>/dev/null | "$1"
+2>/dev/null awk readonly
+	&& x=1 sed "$@" then x=1 readonly cd /usr/bin
+		"$@" --verbose export grep sed export export grep printf readonly done
+awk test x=1 -eu ${HOME} "$1" done grep -eu echo readonly local
+		"$1" --verbose && export
+	2>/dev/null | awk readonly $(pwd) --verbose
+	x=1 awk 'quoted text' 'quoted text' -eu
+"$@" 2>/dev/null 'quoted text' -eu 'quoted text' && "$@" --verbose readonly
+		/usr/bin | done test 'quoted text' readonly readonly -eu && then printf
+		export sed 2>/dev/null then 'quoted text' 'quoted text' cd
+	x=1 x=1 --verbose /usr/bin printf
+		readonly cd $(pwd) x=1 "$@" export
+		-eu && 'quoted text' ${HOME} 'quoted text'
+readonly then 'quoted text' done /usr/bin
+	"$@" x=1 awk cd local /usr/bin | cd awk "$@" done awk ${HOME}
+	$(pwd) "$@" echo -eu done "$1" | --verbose ${HOME} export x=1 -eu done export
+${HOME} ${HOME} "$@" "$1" cd x=1 export printf cd awk local then
+		&& ${HOME} 2>/dev/null
+"$1" then x=1 ${HOME} 'quoted text'
+		export $(pwd) sed printf $(pwd) local sed $(pwd) "$@"
+	export grep local $(pwd) && awk 'quoted text' "$@" "$1" && sed
+awk && 2>/dev/null "$1" test && export && "$@" /usr/bin --verbose
+		export | 2>/dev/null done readonly ${HOME} "$@" && local awk
+		local printf | awk "$@" /usr/bin local echo $(pwd) then grep | && | 2>/dev/null
+		printf done then 'quoted text' && | then
+${HOME} 'quoted text' local 2>/dev/null "$@" "$@" test cd done | 'quoted text'
+		export readonly /usr/bin --verbose
+	/usr/bin --verbose awk | export 'quoted text' done
+/usr/bin | readonly local
+	"$@" printf $(pwd) local -eu
+	sed ${HOME} /usr/bin 2>/dev/null printf export -eu
+	done readonly 'quoted text' 'quoted text'
+		then done 2>/dev/null --verbose --verbose
+		-eu sed x=1 --verbose -eu then sed printf $(pwd) echo awk done cd && test 'quoted text'
+	x=1 awk export $(pwd) awk $(pwd) --verbose export
+	test done then 'quoted text' | "$@" x=1 awk test /usr/bin
+sed /usr/bin 'quoted text'
+cd "$@" $(pwd) -eu --verbose -eu -eu readonly 'quoted text' | | done then
+	| sed then done grep x=1 x=1
+"$@" "$@" x=1 export cd export local $(pwd)
+		/usr/bin local ${HOME}
+done /usr/bin awk 'quoted text' 2>/dev/null
+grep ${HOME} "$@" "$1" ${HOME} done grep grep | printf /usr/bin then /usr/bin
+test echo sed echo -eu /usr/bin sed "$@"
+	echo x=1 --verbose export --verbose local readonly
+	-eu then --verbose awk "$1" --verbose x=1 done local
+cd export 'quoted text' echo printf "$1" x=1 --verbose
+		$(pwd) | echo local awk export awk
+${HOME} test "$1" 2>/dev/null awk -eu $(pwd) readonly ${HOME}
+sed --verbose | local $(pwd)
+echo cd grep x=1 | awk cd done export "$@" awk test sed "$@" awk && local
+		$(pwd) -eu done "$@" x=1 awk 2>/dev/null echo local cd test | x=1
+		--verbose ${HOME} x=1 ${HOME}
+grep awk "$1" /usr/bin --verbose echo local "$@" printf | test grep ${HOME} then
+printf echo local grep awk /usr/bin printf echo printf $(pwd)
+	2>/dev/null x=1 $(pwd)
+sed x=1 2>/dev/null printf grep && local "$1" awk ${HOME} -eu 2>/dev/null readonly
+'quoted text' 2>/dev/null "$1" done then $(pwd) $(pwd) "$1" grep then sed
+	then -eu sed x=1 -eu done echo && cd ${HOME}
+grep --verbose echo awk export 'quoted text' ${HOME}
+| sed $(pwd) 'quoted text' $(pwd) sed x=1 cd "$1" local
+	&& ${HOME} && done ${HOME} local awk
+x=1 echo awk local "$1" -eu sed | | cd 2>/dev/null
+done echo then | "$@" /usr/bin readonly done awk awk sed && sed --verbose
+"$@" grep --verbose | $(pwd) test then --verbose export
+	| done done cd export cd awk export
+	export export then 2>/dev/null | then && then readonly awk /usr/bin export
+		cd test cd grep then x=1 "$@" sed awk | -eu 'quoted text' 'quoted text'
+"$1" local echo cd readonly local
+printf -eu sed $(pwd) x=1 | done --verbose x=1 printf echo
+	awk echo -eu grep grep export grep export printf "$1" /usr/bin sed x=1
+		/usr/bin then -eu | --verbose x=1 cd export echo /usr/bin
+export ${HOME} "$@" cd x=1
+test ${HOME} 'quoted text' printf
+		printf local --verbose awk awk readonly
+		export cd export $(pwd) --verbose /usr/bin | /usr/bin grep cd &&
+		cd "$@" local && echo readonly done
+local grep printf readonly test
+	--verbose "$@" local awk -eu
+/usr/bin done done 2>/dev/null sed
+"$1" | printf "$1" readonly printf /usr/bin /usr/bin "$@"
+	-eu awk ${HOME} && --verbose "$@" $(pwd) | 2>/dev/null 'quoted text'
+	cd /usr/bin $(pwd) --verbose /usr/bin "$1" sed cd then readonly local &&
+		awk test "$@" printf then "$@" test 'quoted text' |
+		x=1 'quoted text' printf echo | test
+test done local done "$1" readonly "$@" $(pwd) done export $(pwd)
+	then cd cd printf ${HOME} $(pwd) ${HOME}
+--verbose /usr/bin "$1" local /usr/bin /usr/bin export ${HOME} x=1 "$1" printf awk
+"$1" grep grep awk "$1" readonly printf "$1" done
+		echo echo local "$@" /usr/bin 'quoted text' 'quoted text' 'quoted text'
+		"$1" -eu "$1" awk "$@"
+	"$1" ${HOME} cd $(pwd) awk "$1" echo "$1" grep -eu done printf grep awk test
+"$@" -eu ${HOME} echo readonly cd --verbose
+	$(pwd) | readonly grep /usr/bin then cd done
+	grep 'quoted text' grep -eu --verbose then cd readonly awk x=1
+	export done /usr/bin "$1" && && /usr/bin --verbose local done test 'quoted text'
+sed ${HOME} /usr/bin ${HOME}
+	awk x=1 done local awk ${HOME} && "$1" cd echo $(pwd)
+		"$@" x=1 $(pwd) grep sed export
+'quoted text' printf ${HOME} test | $(pwd)
+		awk cd 'quoted text' echo export "$1" local done awk "$1" &&
+test grep printf awk printf test
+	export test /usr/bin "$@" | sed /usr/bin
+		${HOME} grep "$1" local done cd 'quoted text' x=1 "$@" "$@" local /usr/bin awk &&
+		awk printf sed export && 'quoted text' grep done
+	${HOME} -eu awk 2>/dev/null export test test
+'quoted text' local ${HOME} awk cd $(pwd) printf | export "$@" 2>/dev/null
+	&& && "$@" && grep grep cd then test --verbose
+local test | readonly readonly ${HOME} readonly awk grep
+	'quoted text' --verbose "$1" local
+echo && --verbose -eu "$1" printf echo "$@" x=1 then
+		echo "$1" && printf grep cd $(pwd) printf readonly "$@" readonly grep x=1 && -eu
+	cd ${HOME} "$1" test export done sed x=1
+		then cd x=1 --verbose "$@" grep cd local --verbose test /usr/bin
+		done echo && awk export && awk then --verbose 2>/dev/null
+	${HOME} printf awk printf export
+	'quoted text' awk test grep
+2>/dev/null 'quoted text' $(pwd)
+local | readonly /usr/bin 'quoted text' ${HOME}
+	'quoted text' sed sed x=1 echo test
+done "$@" x=1 readonly then
+	$(pwd) sed "$@" test local --verbose 'quoted text'
+"$@" sed 2>/dev/null x=1 --verbose ${HOME} cd && --verbose local -eu "$@" test
+	grep grep | printf then
+		"$1" local awk grep sed ${HOME} 'quoted text'
+		/usr/bin done 'quoted text' /usr/bin "$1" --verbose test | cd
+done "$1" "$1" "$1" --verbose /usr/bin printf /usr/bin x=1 $(pwd)
+		--verbose | echo export && "$@" "$1"
+--verbose done | awk 'quoted text' printf test 2>/dev/null done grep | "$@"
+		then ${HOME} /usr/bin && "$1" "$@" awk 2>/dev/null sed test $(pwd) test cd --verbose
+	"$1" grep "$@" "$1" then export local ${HOME} then
+		x=1 && printf "$@" export | local test x=1 x=1 "$@" sed -eu "$1" readonly sed
+/usr/bin printf grep export then test then export test | readonly
+'quoted text' sed ${HOME} && | grep echo test test $(pwd) --verbose test
+local ${HOME} grep && $(pwd) sed grep
+	${HOME} && awk test grep printf local | then grep
+	2>/dev/null cd awk ${HOME}
+sed echo --verbose 'quoted text'
+grep 2>/dev/null -eu grep "$1"
+	/usr/bin /usr/bin then --verbose $(pwd) test
+		cd "$@" -eu then "$@" sed 2>/dev/null /usr/bin
+	2>/dev/null $(pwd) echo "$@" -eu sed
+	/usr/bin sed test echo x=1
+		local printf -eu -eu | x=1 done && ${HOME} ${HOME} && awk
+		awk | | --verbose ${HOME} x=1 && -eu export export
+	sed && done 'quoted text' readonly export
+		printf 2>/dev/null local echo ${HOME} printf x=1 then -eu grep -eu test "$@"
+		sed then local then awk x=1 'quoted text'
+		local "$@" grep "$@" sed printf
+	cd /usr/bin done "$1" echo readonly | readonly
+	local $(pwd) local "$1" local && done done
+export ${HOME} --verbose /usr/bin export
+	sed --verbose grep readonly 'quoted text' printf $(pwd) x=1 done sed 2>/dev/null
+-eu --verbose $(pwd) | readonly local local grep x=1 /usr/bin --verbose
+		local "$1" x=1 | readonly printf "$1"
+	&& /usr/bin "$1" ${HOME}
+"$1" 'quoted text' 'quoted text' printf && printf "$1" export /usr/bin
+		${HOME} export test sed x=1 /usr/bin && grep
+		--verbose ${HOME} printf printf readonly | "$@" 2>/dev/null local /usr/bin 2>/dev/null
+		printf printf printf printf
+readonly 2>/dev/null | 2>/dev/null test 2>/dev/null -eu 'quoted text' export 'quoted text'
+	2>/dev/null then test
+	x=1 --verbose "$@" $(pwd) grep awk sed local 2>/dev/null | cd local printf
+	"$@" then ${HOME} /usr/bin
+done printf cd "$@" echo sed 2>/dev/null
+		grep | readonly /usr/bin "$1" "$@" "$1" "$@" $(pwd) test sed
+	"$@" grep $(pwd) | "$1" export printf grep grep && $(pwd) grep export cd | done
+		awk local readonly sed done grep readonly "$1" "$1" export ${HOME} then
+	-eu sed -eu --verbose readonly
+/usr/bin then && printf readonly test | printf awk printf readonly "$@" && echo
+		readonly x=1 && test done export 2>/dev/null $(pwd) printf --verbose
+	printf && test 2>/dev/null test grep /usr/bin "$1"
+	printf "$1" "$@" 'quoted text' --verbose "$1" $(pwd) x=1 sed
+$(pwd) awk -eu 'quoted text' echo then export /usr/bin
+		grep grep | grep | ${HOME} cd readonly
+		x=1 "$@" $(pwd) $(pwd) cd cd -eu -eu 'quoted text' 'quoted text'
+		cd sed "$@" 2>/dev/null
+	"$@" grep $(pwd) awk awk 2>/dev/null | 2>/dev/null readonly
+		then readonly ${HOME} ${HOME} done $(pwd)
+export --verbose sed --verbose "$@" awk cd /usr/bin done 'quoted text'
+local echo test && && && cd ${HOME} echo
+	/usr/bin export readonly $(pwd) && --verbose grep -eu /usr/bin | "$@"
+		-eu && "$@" sed ${HOME} "$1" echo 'quoted text'
+		"$@" test readonly --verbose sed printf | 2>/dev/null readonly local
+	echo && printf /usr/bin -eu test readonly sed 2>/dev/null
+	${HOME} test 'quoted text' -eu ${HOME} 2>/dev/null ${HOME} -eu then export
+	local -eu local grep /usr/bin | cd "$1" sed "$1" "$1" 'quoted text'
+then --verbose -eu 'quoted text' cd --verbose cd grep awk export awk readonly
+		printf test x=1 awk ${HOME} grep /usr/bin export /usr/bin done grep
+	test sed test local --verbose sed grep done 2>/dev/null 'quoted text' readonly
+${HOME} ${HOME} test local "$@" printf readonly --verbose
+2>/dev/null readonly ${HOME} export grep export readonly then
+echo 'quoted text' --verbose then cd && $(pwd) echo | $(pwd) /usr/bin "$@"
+cd $(pwd) grep -eu "$1" "$1" | sed | then "$@" printf done -eu ${HOME}
+awk readonly grep then && 2>/dev/null then done | test
+	&& /usr/bin 'quoted text' -eu echo ${HOME} printf sed /usr/bin sed | grep
+		-eu local echo printf | $(pwd) export test
+awk then | done done 2>/dev/null && 2>/dev/null cd | -eu printf -eu | ${HOME}
+then then "$1" -eu --verbose
+	| -eu 2>/dev/null cd "$1" test sed sed done
+		printf awk 'quoted text' local printf
+/usr/bin "$@" cd ${HOME} "$@" grep && awk done 'quoted text' cd x=1
+		"$1" cd ${HOME} grep
+| $(pwd) grep then grep sed
+printf readonly grep done awk readonly cd sed
+	"$@" 'quoted text' grep echo
+	x=1 echo cd cd export awk "$1"
+	'quoted text' grep local --verbose "$@" -eu then /usr/bin
+		awk done "$1" | awk "$@" x=1 printf cd -eu readonly
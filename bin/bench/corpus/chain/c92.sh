@@ -0,0 +1,2001 @@
+	done export && export "$1" /usr/bin && sed "$1" 'quoted text' --verbose
+	grep test $(pwd) readonly local
+	grep 'quoted text' echo x=1 sed --verbose echo 2>/dev/null
+		${HOME} && cd sed 'quoted text' -eu
+	grep readonly -eu sed --verbose
+2>/dev/null printf grep then "$1" export readonly then x=1 local
+readonly printf echo ${HOME} ${HOME} -eu -eu printf ${HOME} /usr/bin local
+	test export test cd x=1 -eu grep 2>/dev/null --verbose readonly cd && printf
+	export test ${HOME} "$@" x=1 awk test readonly --verbose test ${HOME} cd local
+		--verbose grep "$1" | grep test echo awk /usr/bin readonly readonly /usr/bin test
+		-eu then $(pwd) echo export "$1" grep local printf done $(pwd)
+local then && && ${HOME} grep | "$1" x=1 local "$1" && grep grep export
+	export | done sed export awk sed cd /usr/bin "$@" export 'quoted text'
+		export local ${HOME} readonly awk | --verbose
+	-eu echo then /usr/bin ${HOME} x=1 awk
+	awk x=1 printf | | "$1" echo "$@" ${HOME} -eu ${HOME}
+"$1" ${HOME} then sed | ${HOME}
+	readonly cd printf 'quoted text' readonly echo "$@"
+"$@" test grep grep "$1" "$1" 2>/dev/null then "$@" "$1" -eu local
+		"$@" printf grep echo x=1 sed "$1" then test 2>/dev/null
+		| export done done x=1 test
+	${HOME} && -eu && /usr/bin export --verbose then cd ${HOME} awk local "$@"
+		x=1 -eu grep test local x=1 2>/dev/null export ${HOME}
+--verbose local local then local cd
+		-eu test x=1 'quoted text' "$@" export grep | && $(pwd) readonly 'quoted text'
+export 2>/dev/null test
+"$1" 2>/dev/null "$@" | local |
+		then $(pwd) $(pwd) test
+/usr/bin export awk grep grep readonly readonly x=1 then readonly && done
+done sed then 2>/dev/null -eu "$1" test "$@" /usr/bin $(pwd) readonly
+		$(pwd) printf local sed --verbose | 'quoted text' sed "$@" "$1" done printf
+'quoted text' && x=1 $(pwd)
+	then then $(pwd) cd sed local
+test local echo /usr/bin
+		export x=1 test printf "$1" export "$1" "$1" grep local ${HOME} grep "$@" /usr/bin
+	local -eu "$1" && | export && ${HOME} "$1" done
+readonly $(pwd) --verbose printf then cd -eu | then /usr/bin echo cd $(pwd) then
+	'quoted text' ${HOME} readonly sed 'quoted text' then 2>/dev/null
+		'quoted text' x=1 printf /usr/bin sed sed ${HOME} cd local sed ${HOME} x=1 ${HOME}
+		x=1 /usr/bin local | test --verbose test "$@"
+	printf printf /usr/bin awk -eu | awk --verbose x=1 grep readonly 2>/dev/null
+		-eu local awk 2>/dev/null cd && | test --verbose x=1 grep then export then
+	sed /usr/bin | x=1 sed 2>/dev/null /usr/bin printf --verbose awk
+	"$1" awk cd 'quoted text' local 2>/dev/null x=1 --verbose 'quoted text' export
+	/usr/bin export printf echo cd readonly local "$1" cd x=1 2>/dev/null test
+x=1 -eu "$@" grep /usr/bin
+		then "$1" local && x=1 sed awk 2>/dev/null --verbose
+		-eu 2>/dev/null -eu then $(pwd)
+		"$1" "$@" export done readonly grep $(pwd) "$1"
+	2>/dev/null ${HOME} cd printf cd /usr/bin $(pwd) "$1" grep
+	$(pwd) done printf ${HOME} 'quoted text' export -eu /usr/bin
+echo ${HOME} done then printf done x=1
+	printf grep printf done | --verbose then echo && cd "$@"
+then export done 2>/dev/null sed 2>/dev/null 2>/dev/null
+		local "$1" awk grep --verbose $(pwd) done | && -eu
+		'quoted text' export "$@" test grep "$@"
+		printf /usr/bin --verbose grep readonly x=1 'quoted text'
+	printf x=1 local printf test sed cd | "$1" && "$@" echo printf
+		x=1 done "$@" /usr/bin && $(pwd) readonly test sed
+	local "$1" --verbose x=1 --verbose --verbose && echo cd done then ${HOME}
+		"$@" grep sed printf "$@" "$1" --verbose "$1"
+	done export $(pwd) && 'quoted text'
+		awk && printf --verbose /usr/bin ${HOME} echo &&
+		cd readonly 2>/dev/null grep export ${HOME} local then && echo awk grep x=1 ${HOME}
+		/usr/bin done "$@" "$1" test $(pwd) "$@" test --verbose
+	sed && ${HOME} /usr/bin --verbose --verbose /usr/bin $(pwd) x=1
+cd local echo export printf
+test test awk sed grep x=1 "$1" export "$1" local done readonly 2>/dev/null
+export x=1 x=1 test "$1" -eu export
+${HOME} $(pwd) ${HOME} printf done 'quoted text' done echo grep && "$1"
+		-eu local /usr/bin && awk "$@" && done /usr/bin cd 'quoted text'
+		"$1" readonly cd && local readonly "$@"
+cd grep -eu awk $(pwd) ${HOME} x=1 awk 2>/dev/null echo --verbose
+	done done --verbose export sed
+cd done x=1 $(pwd) sed
+awk && && "$@" echo x=1 echo printf 2>/dev/null 2>/dev/null
+	printf echo printf printf test awk "$@" "$@" "$@" | ${HOME} x=1 export
+	done 2>/dev/null $(pwd) test readonly ${HOME} && x=1 "$@" $(pwd) cd $(pwd)
+	x=1 | cd "$1" -eu 2>/dev/null 'quoted text'
+	cd grep | cd --verbose cd x=1 -eu 2>/dev/null readonly "$1" readonly sed
+		--verbose cd 2>/dev/null cd export
+	echo printf done "$1" && printf --verbose
+	"$@" grep /usr/bin x=1 then -eu "$1" --verbose echo sed
+-eu "$@" then sed 'quoted text' local $(pwd) printf
+		cd grep --verbose done "$@" cd 2>/dev/null x=1
+	test | "$@" printf --verbose "$1" x=1 x=1 grep readonly | /usr/bin /usr/bin
+		&& && cd awk then && test cd x=1 "$1" test x=1 --verbose $(pwd)
+sed "$@" test 'quoted text' echo grep | export done ${HOME} --verbose
+	awk printf sed /usr/bin awk
+		"$@" 2>/dev/null && readonly echo printf printf x=1 | export cd 2>/dev/null test
+$(pwd) "$1" done "$1" "$1" && "$@" && "$1"
+x=1 ${HOME} echo && "$1"
+readonly 'quoted text' local
+		sed -eu local && grep test export sed -eu | $(pwd) 2>/dev/null
+grep done --verbose x=1 --verbose readonly
+	--verbose sed --verbose readonly local --verbose test
+		"$@" test cd cd awk done -eu readonly --verbose echo cd
+sed test "$@" --verbose done printf then grep && ${HOME} sed
+		sed && sed local done -eu "$@" echo local sed $(pwd) "$1"
+	/usr/bin $(pwd) $(pwd)
+done x=1 readonly then
+		then 2>/dev/null test readonly echo && echo awk x=1 echo sed echo sed test
+sed 'quoted text' 2>/dev/null
+		readonly "$@" ${HOME} 2>/dev/null /usr/bin printf then 2>/dev/null
+		--verbose grep -eu && cd 2>/dev/null --verbose awk sed $(pwd) echo
+	-eu --verbose then readonly
+	${HOME} echo 'quoted text' $(pwd) local x=1 x=1
+	echo 'quoted text' printf ${HOME} x=1
+	readonly sed && --verbose
+$(pwd) cd sed --verbose grep -eu test && export x=1 export 2>/dev/null "$@"
+		printf 2>/dev/null test local export done export sed && sed -eu 'quoted text'
+$(pwd) --verbose 2>/dev/null grep local -eu /usr/bin sed 'quoted text'
+	"$1" "$1" printf awk "$1" printf done | -eu -eu done -eu echo test 'quoted text'
+x=1 && x=1 && printf $(pwd) then readonly "$@" readonly export grep printf
+		local --verbose ${HOME} cd "$@" test -eu x=1
+printf readonly | local ${HOME} then |
+export 2>/dev/null echo awk echo "$1" echo -eu | ${HOME} && sed readonly
+awk /usr/bin awk echo /usr/bin --verbose cd
+	--verbose 'quoted text' "$1" local sed local 2>/dev/null
+"$@" awk ${HOME} awk ${HOME} "$@" "$@" 'quoted text' ${HOME}
+	local | x=1 local local echo sed |
+x=1 "$@" done ${HOME} then
+${HOME} grep "$@" 2>/dev/null 'quoted text' x=1 awk x=1 $(pwd) ${HOME}
+		&& awk /usr/bin done awk echo then echo readonly | test done readonly cd
+	"$@" 'quoted text' then ${HOME} /usr/bin
+	--verbose echo | test && $(pwd) /usr/bin "$1" /usr/bin test "$1" done grep
+	${HOME} grep grep awk | "$@" "$@" 2>/dev/null
+	&& readonly /usr/bin 'quoted text' cd ${HOME} sed
+local "$1" local cd printf
+		2>/dev/null ${HOME} test 'quoted text' 'quoted text'
+		$(pwd) -eu | /usr/bin
+echo cd --verbose export then "$1" export test test "$@"
+&& export local /usr/bin grep export test "$1"
+awk 2>/dev/null then test 2>/dev/null
+${HOME} grep local $(pwd) sed | echo readonly $(pwd) ${HOME} readonly
+		sed sed test printf test
+	echo readonly then --verbose 'quoted text' | --verbose "$1" test
+		echo readonly local test "$@" then
+	then echo -eu -eu --verbose sed "$@" 'quoted text'
+local "$@" readonly readonly ${HOME} grep ${HOME} "$1" readonly grep local cd
+		2>/dev/null --verbose local test
+	then | "$@" /usr/bin awk echo -eu local
+	${HOME} readonly grep sed export echo done then done sed -eu x=1
+		$(pwd) then /usr/bin awk then grep awk ${HOME}
+	done awk awk readonly x=1 && "$@" "$@"
+		&& then done ${HOME} x=1 "$1" sed
+	test x=1 ${HOME} printf awk local "$1" -eu test then awk sed
+		printf readonly && "$@" readonly local
+		export awk grep echo sed readonly $(pwd) $(pwd) grep grep echo
+$(pwd) x=1 then readonly
+	grep grep grep then "$1" readonly x=1 2>/dev/null done "$1" printf readonly
+| then "$@" && "$@" awk
+-eu printf | | 2>/dev/null "$1" local export
+		grep done 'quoted text' cd awk printf "$@" awk "$1" sed --verbose sed x=1 'quoted text'
+	-eu local grep "$1" local readonly sed export test readonly x=1 readonly cd
+		$(pwd) -eu --verbose 2>/dev/null | done local grep 2>/dev/null "$1" test &&
+	printf done export "$@" --verbose then --verbose printf
+export -eu "$1" sed "$1"
+		export | /usr/bin local cd awk test sed readonly 2>/dev/null export | test sed
+	"$@" export 'quoted text' done | echo && grep x=1 -eu $(pwd) --verbose
+	/usr/bin | readonly 'quoted text' x=1 cd echo x=1 | test export test
+then then | "$1" && x=1 "$1" sed echo $(pwd) grep
+| done $(pwd) done $(pwd)
+		${HOME} sed cd && printf printf -eu sed /usr/bin done
+	| export ${HOME} --verbose ${HOME} awk awk sed sed && cd x=1 "$1" | done done "$1"
+	"$1" ${HOME} /usr/bin /usr/bin readonly done && "$1" $(pwd)
+		/usr/bin --verbose test done grep then
+echo done && | cd -eu && -eu 2>/dev/null readonly && $(pwd) && $(pwd) then
+-eu test readonly $(pwd) test -eu local -eu
+		printf x=1 cd printf --verbose 'quoted text' done $(pwd) awk awk 'quoted text'
+&& "$1" | ${HOME} x=1 test "$1" printf /usr/bin 'quoted text'
+		x=1 done export export done sed
+		then local "$1" 2>/dev/null 'quoted text'
+	cd ${HOME} test grep |
+		cd echo x=1 cd "$@" cd 'quoted text' awk grep x=1 | export printf test export
+	export sed grep $(pwd) awk 2>/dev/null x=1 echo | 2>/dev/null done
+/usr/bin $(pwd) 2>/dev/null test /usr/bin -eu ${HOME} sed local "$@" | done
+"$1" 2>/dev/null /usr/bin
+	&& printf sed local cd grep x=1
+	printf /usr/bin readonly
+'quoted text' grep "$@" "$@" export 'quoted text'
+2>/dev/null then readonly cd cd test local /usr/bin printf | local
+		done cd printf --verbose cd && && | | "$@" done readonly
+${HOME} test $(pwd) $(pwd) done export "$@" echo
+		done export --verbose $(pwd)
+		${HOME} then test "$1" test
+		$(pwd) local grep local $(pwd) test $(pwd) sed && then then --verbose export grep
+	$(pwd) | 2>/dev/null "$@" 2>/dev/null -eu -eu then export test readonly
+		readonly --verbose ${HOME} $(pwd)
+		--verbose printf sed /usr/bin then then cd "$1"
+		/usr/bin done echo done && export x=1 -eu $(pwd)
+		awk grep $(pwd) readonly export cd
+		cd then --verbose /usr/bin
+		grep x=1 --verbose -eu echo "$@" --verbose local /usr/bin done -eu x=1
+	| echo /usr/bin echo done "$1" ${HOME} readonly done echo ${HOME} printf "$1"
+		| printf sed ${HOME} readonly
+	"$@" ${HOME} 'quoted text' 'quoted text' then cd 2>/dev/null
+test 2>/dev/null 2>/dev/null test sed
+		echo ${HOME} --verbose 'quoted text' printf export | 'quoted text' 2>/dev/null
+		grep "$@" echo done sed ${HOME} then readonly test --verbose grep export "$@"
+	done ${HOME} echo readonly cd --verbose echo local
+done readonly printf grep "$1" echo then x=1 ${HOME} ${HOME} readonly "$1" awk
+		sed awk ${HOME} local test local readonly done
+done 'quoted text' local test x=1
+test --verbose cd then /usr/bin
+	"$@" printf readonly
+	done printf then "$@" sed /usr/bin "$1" export x=1
+	"$1" then echo export local local awk readonly readonly done | sed x=1 $(pwd)
+$(pwd) cd "$@" grep readonly 'quoted text'
+local $(pwd) --verbose cd -eu test && printf -eu && | 2>/dev/null
+export echo 2>/dev/null $(pwd) echo --verbose -eu done awk cd echo
+		test awk 'quoted text' local 2>/dev/null 2>/dev/null /usr/bin x=1 sed then
+		| done done $(pwd) $(pwd) echo ${HOME} ${HOME} awk done && awk awk "$@"
+2>/dev/null test --verbose && awk test /usr/bin /usr/bin 2>/dev/null
+printf -eu 'quoted text' local export --verbose && echo local cd
+&& && readonly /usr/bin /usr/bin /usr/bin export | /usr/bin && 'quoted text' "$1"
+${HOME} sed /usr/bin "$1" readonly "$1"
+		local && export && test "$1" x=1 x=1 echo
+		done cd printf /usr/bin awk $(pwd) readonly done /usr/bin readonly done "$1"
+	printf $(pwd) && "$@" local cd awk printf "$@" | ${HOME} --verbose 2>/dev/null
+		| cd echo awk "$1" done --verbose --verbose test
+x=1 2>/dev/null local printf 2>/dev/null 'quoted text'
+	echo "$1" && "$@" readonly done | printf
+		readonly then done then local -eu local -eu
+| readonly && export $(pwd)
+	${HOME} export 2>/dev/null grep
+done echo -eu awk local readonly ${HOME} readonly grep $(pwd) ${HOME}
+		&& readonly "$1" printf done x=1 then --verbose
+	/usr/bin $(pwd) printf
+		$(pwd) awk x=1 && $(pwd) $(pwd) 'quoted text' cd 2>/dev/null
+		-eu export readonly x=1 "$@"
+	"$1" 2>/dev/null --verbose "$1" grep cd echo grep done readonly then "$@"
+| --verbose "$1" printf -eu "$@" echo "$@"
+	$(pwd) test /usr/bin grep 2>/dev/null /usr/bin /usr/bin test -eu
+	then sed "$1" echo | "$@" readonly local readonly echo
+		-eu done local | 'quoted text'
+	printf local readonly export then /usr/bin sed "$1" cd /usr/bin
+		'quoted text' awk "$1" ${HOME} test then
+export awk 2>/dev/null -eu "$@" x=1 export /usr/bin readonly "$1" 'quoted text'
+		/usr/bin printf sed readonly
+		test local "$1" "$1" "$1" cd ${HOME}
+	--verbose cd /usr/bin export test grep $(pwd) | awk $(pwd) readonly export 'quoted text'
+	awk readonly done echo printf 2>/dev/null && ${HOME} sed grep | cd
+'quoted text' 2>/dev/null "$@" readonly awk x=1 then awk
+		| sed export readonly readonly -eu x=1 --verbose
+cd then 'quoted text' 'quoted text' done | | done
+local ${HOME} x=1 'quoted text' done -eu done "$1" done
+		cd $(pwd) test done "$@" test
+	printf printf echo echo && ${HOME} grep done
+	cd --verbose cd local "$1"
+	| /usr/bin local done then x=1 && ${HOME} printf awk "$1" "$@"
+	local export 2>/dev/null --verbose grep --verbose --verbose
+test sed cd x=1 ${HOME} $(pwd) awk awk then awk sed echo $(pwd) $(pwd)
+${HOME} sed | cd readonly -eu && "$1" test
+'quoted text' ${HOME}
+		local awk x=1 && sed x=1 then ${HOME} x=1 "$@" && test then
+		export 'quoted text' ${HOME} x=1 'quoted text' then "$1" printf
+&& | 2>/dev/null sed | "$@" printf 2>/dev/null x=1 && local
+| "$@" done sed then awk awk "$@" export
+"$1" then cd echo -eu | /usr/bin local -eu x=1 export export cd && awk
+printf $(pwd) ${HOME} 'quoted text' echo echo
+		"$@" ${HOME} echo test ${HOME} echo "$1" readonly --verbose
+$(pwd) ${HOME} local export 2>/dev/null cd x=1 $(pwd) ${HOME} awk echo
+${HOME} 'quoted text' ${HOME} ${HOME} then
+	x=1 $(pwd) done 'quoted text'
+		awk then done -eu cd --verbose $(pwd) readonly /usr/bin
+	echo $(pwd) --verbose 2>/dev/null cd && local awk x=1 local test 'quoted text'
+$(pwd) printf "$1" &&
+cd awk printf cd printf 2>/dev/null awk cd ${HOME} $(pwd) x=1 printf
+grep --verbose 2>/dev/null x=1 "$1" done
+		cd then then -eu readonly 'quoted text' | grep ${HOME}
+		cd && "$@" -eu $(pwd) 'quoted text' printf
+		'quoted text' export cd | awk | grep ${HOME} done 2>/dev/null
+&& 'quoted text' $(pwd)
+--verbose | readonly "$1" $(pwd) "$1" cd && sed x=1 grep x=1 cd $(pwd)
+	2>/dev/null --verbose ${HOME} cd $(pwd) local /usr/bin local export "$1" then
+done printf cd $(pwd) echo "$1" local
+		&& "$1" grep echo readonly --verbose /usr/bin then export
+		grep "$@" && echo "$1" "$1" echo ${HOME} awk
+		'quoted text' done /usr/bin sed sed "$1" echo && $(pwd) -eu $(pwd)
+	x=1 sed --verbose awk
+		'quoted text' x=1 | export cd -eu echo | --verbose
+	cd --verbose | cd "$@" x=1 then x=1 | $(pwd) done awk grep export
+	awk --verbose then --verbose printf $(pwd) | done /usr/bin
+	'quoted text' readonly sed local printf 'quoted text' && 2>/dev/null
+		test ${HOME} readonly then sed $(pwd)
+'quoted text' 2>/dev/null --verbose awk cd echo $(pwd)
+-eu test local sed sed $(pwd) sed test readonly echo && ${HOME} /usr/bin --verbose
+	sed 'quoted text' "$@"
+"$@" local $(pwd) $(pwd) -eu test
+		export 'quoted text' cd
+	printf readonly "$@" -eu then | | ${HOME} done --verbose --verbose
+export then -eu grep /usr/bin sed export printf
+		awk "$1" local --verbose sed x=1 export "$1" sed sed $(pwd)
+"$@" cd local local readonly --verbose && awk -eu export printf
+&& -eu x=1 && done ${HOME} printf local sed
+		--verbose 2>/dev/null 2>/dev/null
+	x=1 done && --verbose "$@" cd $(pwd) grep echo export echo 'quoted text'
+		printf echo /usr/bin -eu echo && echo x=1 printf
+		cd "$@" && $(pwd) grep done --verbose sed 2>/dev/null sed
+-eu && | $(pwd) -eu && /usr/bin done
+		grep export "$@" $(pwd) printf sed | readonly --verbose grep export
+	then readonly -eu readonly
+	'quoted text' export "$@" done -eu done done ${HOME}
+		local /usr/bin cd && test awk printf sed --verbose local awk
+awk | sed local done done 2>/dev/null
+sed ${HOME} 2>/dev/null /usr/bin grep local test -eu
+		awk grep 2>/dev/null -eu --verbose echo printf
+| --verbose x=1 $(pwd) test ${HOME} --verbose -eu cd grep $(pwd) -eu readonly echo
+readonly -eu && cd x=1 2>/dev/null
+local cd awk test then ${HOME} then "$@"
+		echo readonly && "$1" readonly -eu grep
+		printf x=1 readonly x=1
+		"$1" local done x=1 -eu ${HOME} "$@" && x=1 "$@" --verbose --verbose
+		&& then x=1 | printf /usr/bin then $(pwd) -eu /usr/bin awk then echo readonly awk
+	/usr/bin 2>/dev/null printf
+	export cd | printf cd "$@" sed sed 'quoted text' awk awk awk readonly
+		"$@" cd readonly 'quoted text'
+	${HOME} done && sed $(pwd) 2>/dev/null --verbose x=1
+	awk | ${HOME} /usr/bin export
+	"$1" /usr/bin | local 2>/dev/null x=1 echo local "$1" echo test
+		export echo x=1 test "$@"
+		sed && grep ${HOME} && 'quoted text'
+&& "$1" local "$@" "$@" $(pwd) printf
+		cd x=1 && done then then | --verbose
+readonly && $(pwd) export test readonly printf ${HOME} "$@" && 'quoted text'
+	readonly /usr/bin readonly done printf readonly sed "$@" $(pwd) sed printf
+	'quoted text' grep sed "$@" awk grep
+	test test then done readonly done sed test done
+		printf x=1 grep "$@" printf "$@" "$1" | cd -eu $(pwd) | printf
+echo "$@" then awk /usr/bin sed sed done && ${HOME} done
+		test "$@" -eu $(pwd) awk test /usr/bin grep "$1" x=1 "$@" echo /usr/bin then
+	done /usr/bin echo "$@"
+	sed 'quoted text' echo /usr/bin
+		printf --verbose sed -eu /usr/bin done 2>/dev/null -eu && sed awk "$@" "$@" ${HOME}
+		&& 'quoted text' -eu /usr/bin cd export sed export
+		| -eu | printf | 'quoted text'
+"$@" export echo /usr/bin "$@" sed ${HOME} test /usr/bin
+	'quoted text' "$@" awk 'quoted text' 'quoted text' /usr/bin readonly grep
+		| export test export -eu /usr/bin --verbose
+| x=1 -eu grep "$@" -eu test grep && ${HOME}
+	cd then echo x=1 then grep x=1 awk | echo
+		cd /usr/bin readonly readonly
+		/usr/bin | --verbose "$@" echo readonly "$1" grep export && export done
+/usr/bin echo $(pwd) --verbose
+		done export && $(pwd) export x=1 | "$@" | 'quoted text' /usr/bin
+		sed readonly "$@" local /usr/bin cd then
+		&& sed --verbose 'quoted text' awk local ${HOME} --verbose awk ${HOME} local
+x=1 test 'quoted text' "$1"
+sed && ${HOME} then "$1" -eu then readonly then "$1" cd "$@" sed
+		grep test export local "$@" &&
+		echo awk local then cd | local -eu
+		then $(pwd) grep 'quoted text' echo done ${HOME} local /usr/bin -eu awk x=1
+	-eu "$1" /usr/bin cd grep readonly
+	| /usr/bin 2>/dev/null x=1 --verbose printf 2>/dev/null
+| export export cd sed grep x=1 2>/dev/null printf readonly awk /usr/bin
+	--verbose x=1 grep test ${HOME} /usr/bin 'quoted text'
+	$(pwd) local cd grep export echo /usr/bin echo ${HOME} readonly
+		| ${HOME} awk && done "$1" sed
+	2>/dev/null printf x=1 /usr/bin readonly -eu x=1 -eu
+		/usr/bin awk grep && awk
+-eu local 'quoted text' printf | done "$1"
+		readonly | awk x=1 readonly $(pwd) cd "$@" --verbose
+	printf -eu sed -eu export test printf cd "$@" ${HOME} echo 'quoted text'
+awk printf done done ${HOME} then /usr/bin done sed test
+		"$@" x=1 && local /usr/bin -eu local -eu x=1 done -eu then
+	awk --verbose x=1 'quoted text'
+$(pwd) done /usr/bin local -eu "$1" /usr/bin
+		"$1" grep "$1" export test grep cd "$@" --verbose
+test && local done ${HOME} grep done 'quoted text'
+		grep "$@" echo && 2>/dev/null readonly done
+		"$1" printf sed export | 'quoted text'
+		export ${HOME} /usr/bin && cd echo then done cd sed x=1 'quoted text'
+$(pwd) test 2>/dev/null --verbose test && grep export && | awk sed "$1" /usr/bin
+cd 'quoted text' "$@" ${HOME} && echo && ${HOME} echo 'quoted text'
+		awk $(pwd) x=1 cd then export $(pwd) done
+printf test done "$@" /usr/bin x=1 sed 'quoted text' $(pwd) done test
+readonly echo "$@" awk awk printf "$@" "$@" awk readonly then
+	then /usr/bin done then done done
+test export x=1 readonly then
+		${HOME} ${HOME} export | "$@" printf ${HOME} -eu | ${HOME} "$@" awk x=1
+'quoted text' x=1 echo ${HOME} --verbose
+${HOME} --verbose | /usr/bin awk
+echo "$@" grep done $(pwd) sed | /usr/bin
+export ${HOME} then /usr/bin sed "$@" -eu 2>/dev/null
+		then -eu done $(pwd) printf printf | local echo -eu /usr/bin awk local cd export
+	awk echo test echo ${HOME}
+		"$@" done x=1 $(pwd) awk sed x=1 | local 'quoted text' echo export && 'quoted text'
+		echo $(pwd) | "$@" 'quoted text'
+readonly printf $(pwd) $(pwd) readonly
+	"$@" echo cd x=1 sed cd --verbose ${HOME}
+"$@" --verbose ${HOME} --verbose
+--verbose export printf sed sed x=1 2>/dev/null
+local export $(pwd) $(pwd) 2>/dev/null
+		/usr/bin then grep done awk then
+		--verbose /usr/bin $(pwd) echo | "$1"
+		x=1 awk grep echo x=1 then sed then
+		done -eu echo "$@" printf
+	${HOME} then "$@" awk awk grep then | /usr/bin readonly 'quoted text'
+	echo | -eu test cd cd | printf $(pwd) awk
+		&& done test test && 'quoted text' /usr/bin test awk ${HOME}
+	then -eu grep readonly && -eu printf awk local
+		"$1" done ${HOME} | x=1
+		then -eu -eu 2>/dev/null sed /usr/bin 'quoted text' $(pwd) --verbose
+		printf sed && | | printf local && --verbose
+"$1" "$1" cd ${HOME} awk
+	export && printf /usr/bin sed readonly --verbose ${HOME} printf x=1 x=1 cd "$@"
+	"$1" cd sed | then then x=1 local export sed test then grep && "$@" grep --verbose
+		cd -eu then cd readonly then cd "$1" 2>/dev/null
+		done grep export readonly /usr/bin
+sed then /usr/bin 2>/dev/null | then local readonly
+	awk then printf && local sed awk "$@" "$1" "$@" sed $(pwd)
+printf 2>/dev/null export ${HOME} &&
+		$(pwd) && "$1" done $(pwd) "$@" /usr/bin ${HOME}
+local 'quoted text' echo readonly && sed
+--verbose test $(pwd) test then 2>/dev/null
+grep test x=1 export x=1 done done export 'quoted text'
+		x=1 'quoted text' -eu && | && local
+	export 2>/dev/null x=1 grep 2>/dev/null
+$(pwd) sed -eu grep readonly 2>/dev/null -eu x=1 sed && then
+		x=1 2>/dev/null | 2>/dev/null "$1" ${HOME} echo printf test
+"$@" cd 'quoted text' printf awk local
+	"$@" export 2>/dev/null export --verbose x=1
+--verbose | 2>/dev/null printf cd echo ${HOME} 'quoted text' 'quoted text'
+		grep printf /usr/bin 2>/dev/null local 'quoted text' && then
+	cd x=1 | --verbose "$1" grep done
+	printf cd /usr/bin printf
+		x=1 -eu export 'quoted text' echo grep /usr/bin done
+local 2>/dev/null -eu grep test ${HOME} local "$@" /usr/bin /usr/bin && done
+		"$@" | test -eu 'quoted text' 'quoted text' sed printf echo --verbose
+	printf "$1" local $(pwd) sed 'quoted text' readonly |
+	awk --verbose /usr/bin 2>/dev/null
+		--verbose | -eu "$@" test | ${HOME} "$1" "$1" -eu
+	/usr/bin test x=1 then test sed && | awk then export cd ${HOME} grep
+		$(pwd) "$@" -eu --verbose --verbose ${HOME} then "$@" && test | 2>/dev/null
+	--verbose awk -eu grep x=1 'quoted text' "$@" done "$1" && ${HOME}
+		-eu readonly && ${HOME} cd export local awk then
+-eu printf x=1 local | "$@" done printf test sed readonly readonly printf
+	$(pwd) test printf ${HOME}
+| test local sed ${HOME}
+x=1 x=1 test cd 'quoted text' then $(pwd) x=1 printf local /usr/bin
+		local local 2>/dev/null $(pwd) x=1 'quoted text'
+		grep sed sed ${HOME} && x=1 /usr/bin test &&
+readonly "$@" 2>/dev/null sed 'quoted text' local "$@" export -eu
+	$(pwd) done done test --verbose
+2>/dev/null then printf grep
+	sed done -eu $(pwd) "$@" sed 'quoted text' /usr/bin cd x=1 | cd "$1" echo
+		export -eu then printf | x=1 && && ${HOME} --verbose
+	awk ${HOME} echo /usr/bin "$1" sed local -eu x=1 "$1" "$@" && export "$1"
+	$(pwd) grep /usr/bin grep x=1 then x=1 'quoted text'
+	grep /usr/bin cd /usr/bin sed 2>/dev/null grep export | && readonly printf
+&& "$@" then test -eu echo 'quoted text'
+&& grep printf readonly grep && 2>/dev/null "$@" readonly -eu
+		sed cd "$1" x=1 echo grep "$1" echo 2>/dev/null 'quoted text'
+2>/dev/null awk export ${HOME} -eu ${HOME} /usr/bin readonly
+		cd x=1 --verbose then --verbose echo /usr/bin "$@" ${HOME} /usr/bin ${HOME}
+	x=1 export && ${HOME} 'quoted text'
+	readonly && x=1 2>/dev/null
+	printf /usr/bin ${HOME} grep -eu readonly export "$@" export export /usr/bin
+then 2>/dev/null cd then ${HOME} sed $(pwd) "$@" && echo
+	grep --verbose -eu readonly x=1 $(pwd) printf
+readonly sed export 'quoted text' done cd /usr/bin then local
+2>/dev/null x=1 cd "$@" && export done 'quoted text' test 'quoted text'
+	/usr/bin cd cd 'quoted text' export "$@" -eu then done readonly printf
+		${HOME} then export sed grep awk $(pwd)
+		2>/dev/null /usr/bin cd local | "$1" then printf -eu | ${HOME} "$@"
+--verbose $(pwd) local test grep /usr/bin "$1" sed grep x=1 "$1" sed local sed
+		/usr/bin local export grep $(pwd) 'quoted text'
+local "$1" && printf grep "$@" x=1 then 'quoted text' awk
+		--verbose local "$1" readonly "$@" /usr/bin x=1 2>/dev/null
+	export printf | "$@" readonly $(pwd) x=1 | echo grep echo done printf
+grep readonly /usr/bin 'quoted text' ${HOME} then readonly
+	then export /usr/bin echo cd sed done export -eu && then | sed
+	test export "$1" sed done x=1 "$@" sed export /usr/bin -eu
+		cd local echo && grep
+	$(pwd) cd 'quoted text' done awk readonly export printf
+		&& echo $(pwd) cd x=1 | readonly
+x=1 x=1 /usr/bin printf --verbose cd 2>/dev/null | printf readonly
+/usr/bin "$@" "$@" then local
+$(pwd) --verbose --verbose printf done 'quoted text'
+		readonly sed cd ${HOME} -eu --verbose printf done
+		-eu && | $(pwd) local "$@"
+export "$@" 2>/dev/null /usr/bin --verbose | "$1" /usr/bin
+&& grep && local -eu /usr/bin grep export export 2>/dev/null -eu readonly "$@"
+		printf -eu printf done | readonly echo "$1" echo $(pwd) "$@" 'quoted text'
+	export grep "$@" --verbose
+	| then | ${HOME} | printf
+-eu local export x=1 grep export --verbose
+printf echo $(pwd) 2>/dev/null readonly $(pwd)
+export awk /usr/bin && test && cd x=1 -eu 'quoted text'
+		then ${HOME} x=1 readonly local --verbose ${HOME} printf && | 'quoted text'
+		x=1 && /usr/bin awk && test local x=1 -eu && sed && sed done awk
+		-eu $(pwd) ${HOME} "$1" "$1" && 2>/dev/null cd "$@" -eu /usr/bin
+		&& --verbose -eu export local sed export
+x=1 awk ${HOME} printf grep | x=1 echo readonly ${HOME} echo $(pwd) cd $(pwd) -eu
+readonly 2>/dev/null then
+		readonly awk "$@" local /usr/bin "$1" "$1" /usr/bin /usr/bin
+		done 2>/dev/null then grep awk test && ${HOME} "$@" then test awk &&
+	test -eu $(pwd) ${HOME} grep --verbose -eu awk readonly
+"$1" 'quoted text' $(pwd)
+	/usr/bin printf readonly $(pwd) 2>/dev/null
+		&& $(pwd) ${HOME} "$1" | echo readonly $(pwd)
+		x=1 x=1 test readonly "$1" ${HOME} cd -eu "$@" --verbose sed
+&& ${HOME} awk awk cd --verbose
+--verbose /usr/bin awk export ${HOME} cd cd cd grep /usr/bin x=1
+		$(pwd) readonly $(pwd) test local 2>/dev/null
+${HOME} "$@" grep && x=1 x=1 && echo "$@" "$@" "$@" then then cd grep
+	${HOME} "$@" -eu $(pwd) && export | "$1" done x=1 readonly x=1
+grep grep done "$1" grep cd "$1" cd /usr/bin ${HOME} x=1
+	cd && cd ${HOME} cd done then
+		"$@" "$@" printf "$@" | "$1" -eu printf
+| awk printf 2>/dev/null x=1
+"$1" && ${HOME} 'quoted text'
+readonly echo 2>/dev/null local "$1"
+awk ${HOME} echo ${HOME} export sed export /usr/bin -eu 2>/dev/null
+		/usr/bin --verbose export 'quoted text' sed awk done done echo then echo
+		cd export done then && /usr/bin grep echo export awk local "$@" $(pwd)
+2>/dev/null readonly cd 'quoted text' readonly "$@" | 2>/dev/null
+		done ${HOME} sed done 'quoted text' 2>/dev/null | 2>/dev/null awk | | echo
+"$@" awk 'quoted text' 2>/dev/null grep "$1"
+		/usr/bin /usr/bin local 'quoted text' "$@" x=1 printf sed "$1" "$@"
+grep "$@" "$1" test awk --verbose 'quoted text'
+		grep x=1 --verbose export done --verbose ${HOME} /usr/bin && |
+	echo && local awk -eu sed then --verbose local | done $(pwd) echo 'quoted text'
+readonly "$1" printf grep done | export && echo local -eu
+		"$@" echo printf export printf -eu sed local
+printf $(pwd) | sed "$@" readonly /usr/bin --verbose /usr/bin "$1"
+printf cd 2>/dev/null echo echo then ${HOME} grep test
+		then export 'quoted text' "$@" export 2>/dev/null
+awk 'quoted text' ${HOME} | -eu grep local
+		${HOME} awk sed local /usr/bin "$1" grep
+		cd echo "$@" cd awk --verbose | "$@" echo 2>/dev/null cd $(pwd)
+test x=1 --verbose | done x=1 test $(pwd) -eu
+echo sed && cd then done 2>/dev/null done && $(pwd) echo
+	echo | cd test 'quoted text' 2>/dev/null
+$(pwd) && local "$1" grep test export -eu
+		local local $(pwd) 2>/dev/null /usr/bin cd "$1" $(pwd) | 2>/dev/null local /usr/bin
+x=1 sed "$@" 'quoted text' | 'quoted text' 2>/dev/null --verbose
+		&& /usr/bin "$1" done awk awk 'quoted text' then awk sed -eu
+	x=1 x=1 grep | cd export export -eu then
+-eu $(pwd) --verbose echo local grep "$1" echo "$@" local
+	done /usr/bin -eu export $(pwd) /usr/bin x=1
+x=1 sed done test ${HOME} | cd grep echo printf test ${HOME} $(pwd)
+test "$1" echo "$1" test echo echo echo ${HOME} "$1"
+	&& export export done -eu -eu grep then /usr/bin then "$@" grep
+		"$1" 2>/dev/null x=1 "$1" $(pwd) "$1" 'quoted text' -eu awk --verbose && --verbose
+"$@" "$@" $(pwd) -eu | /usr/bin 'quoted text' test | /usr/bin
+	$(pwd) x=1 2>/dev/null awk sed readonly
+		/usr/bin local test | local printf
+sed 'quoted text' then "$1" test echo grep 'quoted text' "$@" "$1" --verbose done
+/usr/bin 'quoted text' grep 2>/dev/null
+	readonly ${HOME} 'quoted text' readonly && awk export
+		2>/dev/null /usr/bin sed "$1" done then x=1 -eu then $(pwd) ${HOME} export --verbose
+	done && cd x=1 'quoted text'
+export then cd 2>/dev/null local 2>/dev/null 2>/dev/null /usr/bin export
+	echo 'quoted text' then test local
+		cd test /usr/bin awk | local awk grep
+	local echo export echo sed
+		sed readonly ${HOME} -eu cd export sed test |
+		printf 2>/dev/null -eu "$@"
+test && "$1" --verbose | 2>/dev/null 2>/dev/null
+	&& "$1" printf then cd awk | export awk done test awk && test
+-eu "$@" $(pwd) printf test echo export $(pwd) printf then
+	awk printf --verbose 2>/dev/null cd -eu -eu &&
+	| grep x=1 printf echo echo awk
+		test printf /usr/bin local export
+		'quoted text' "$@" -eu readonly
+| local printf x=1 printf readonly "$1" 'quoted text' grep sed echo readonly
+		export "$1" /usr/bin "$1" 2>/dev/null cd readonly | then then x=1 export
+-eu readonly -eu grep export -eu test test grep "$@" 2>/dev/null
+test printf && sed | sed local sed grep printf cd | 'quoted text' awk 'quoted text'
+		cd /usr/bin "$@" && --verbose local
+'quoted text' awk "$1" "$@" "$1"
+done $(pwd) done | /usr/bin echo printf then then |
+	sed "$1" | 2>/dev/null echo
+		test local /usr/bin printf local cd awk cd sed x=1 && readonly | -eu printf
+	echo then | ${HOME} x=1 $(pwd) done export
+	done 'quoted text' done echo then ${HOME}
+	grep --verbose | local export 2>/dev/null printf then then
+"$1" echo | "$1" sed done
+	awk --verbose readonly "$1"
+		$(pwd) /usr/bin local done cd ${HOME} export
+'quoted text' && && done /usr/bin then then cd printf
+	cd /usr/bin --verbose "$1" ${HOME} echo sed /usr/bin "$@" test $(pwd) test
+		cd printf -eu -eu "$@" cd then "$1" printf test $(pwd) x=1 test cd done
+export && done -eu printf x=1
+		"$@" "$@" $(pwd) | 2>/dev/null printf -eu
+	grep readonly /usr/bin $(pwd) done awk export 'quoted text' local -eu test
+${HOME} echo cd test local -eu
+		printf then export "$@" "$1"
+		local awk test echo export -eu
+		readonly done "$1" sed done echo awk
+	cd -eu "$1" x=1 "$1" 'quoted text' printf then -eu local test "$1"
+		"$1" "$1" 2>/dev/null && then sed
+	"$@" --verbose x=1 --verbose then x=1 cd x=1 /usr/bin export
+		readonly then --verbose x=1 2>/dev/null -eu grep "$@" then
+	test x=1 /usr/bin readonly 'quoted text'
+x=1 done | && | --verbose 'quoted text' awk grep
+	'quoted text' local local /usr/bin "$1" grep printf printf $(pwd) $(pwd)
+done "$1" export local --verbose readonly ${HOME} echo | local
+	awk -eu printf sed -eu sed export
+	x=1 cd export test x=1 && /usr/bin -eu echo local awk && echo echo -eu -eu sed
+&& printf "$1" cd echo --verbose
+"$1" 'quoted text' $(pwd) then "$1" echo
+		&& --verbose sed --verbose done 2>/dev/null grep x=1
+		cd ${HOME} cd /usr/bin cd 'quoted text' && printf -eu readonly
+	x=1 -eu then echo x=1 2>/dev/null ${HOME} printf sed test "$@"
+		done ${HOME} "$1" 2>/dev/null ${HOME} --verbose /usr/bin
+cd x=1 ${HOME} "$1" sed export -eu /usr/bin cd then readonly
+	"$@" "$1" "$1" done $(pwd) 2>/dev/null
+	-eu echo | cd && 2>/dev/null export 'quoted text' printf
+	"$1" /usr/bin echo echo awk
+printf x=1 ${HOME} x=1 cd "$1" /usr/bin sed | echo
+then /usr/bin grep cd grep grep x=1
+	local "$1" 'quoted text'
+		export 'quoted text' grep printf
+	local 2>/dev/null | && -eu 2>/dev/null done /usr/bin cd | sed done cd 'quoted text'
+then done export $(pwd) done echo sed then test -eu --verbose | -eu grep && "$@"
+		cd && | --verbose then 'quoted text' grep ${HOME} then x=1 $(pwd)
+		$(pwd) "$1" done | "$1"
+$(pwd) grep --verbose --verbose sed $(pwd)
+then grep printf printf /usr/bin && local done
+"$1" $(pwd) "$@" && then "$@" done $(pwd) echo
+	export done --verbose 2>/dev/null
+	"$@" done ${HOME} done
+	grep x=1 /usr/bin echo "$1" "$1"
+${HOME} sed 2>/dev/null | awk "$1" sed /usr/bin
+		printf printf sed readonly | export then
+"$@" 'quoted text' awk done sed $(pwd) $(pwd) x=1 awk "$@" test ${HOME}
+&& -eu then x=1 cd -eu "$1" awk done /usr/bin && then grep awk
+	"$1" local cd readonly | -eu test printf printf
+	| $(pwd) done 2>/dev/null 2>/dev/null 2>/dev/null
+		| 2>/dev/null ${HOME} sed -eu readonly export $(pwd) cd 'quoted text'
+	${HOME} --verbose printf --verbose
+		"$@" && x=1 printf ${HOME} local x=1 echo echo done ${HOME} sed test &&
+	sed "$1" | echo --verbose --verbose printf done ${HOME} "$@" x=1 | export
+	grep /usr/bin "$1" | -eu && export awk test sed export done sed readonly | 'quoted text'
+$(pwd) sed awk "$1" local export export 'quoted text' 'quoted text' readonly "$1"
+		"$@" | export 'quoted text'
+		readonly ${HOME} -eu -eu "$@" ${HOME} 'quoted text' -eu ${HOME} /usr/bin
+	"$1" x=1 cd printf 'quoted text' readonly
+"$@" 'quoted text' test
+		"$@" $(pwd) $(pwd) cd local printf -eu 2>/dev/null done test 'quoted text' "$1"
+	local | export --verbose && x=1 then then --verbose local
+echo echo awk | --verbose "$1" | 2>/dev/null grep sed "$1"
+		printf && test "$@" /usr/bin done grep sed x=1 && && export test sed
+		${HOME} --verbose /usr/bin x=1 printf export | 2>/dev/null ${HOME} local export
+x=1 -eu test | 'quoted text' sed cd readonly --verbose 'quoted text' printf
+	"$1" && echo done grep test grep "$@" 'quoted text' /usr/bin then echo
+	2>/dev/null readonly "$1" printf 'quoted text' echo export -eu sed echo $(pwd)
+	awk && ${HOME} 2>/dev/null cd x=1 grep grep readonly local
+		local cd 2>/dev/null /usr/bin export
+	done -eu local 2>/dev/null then
+--verbose && --verbose && && awk awk awk sed cd printf printf -eu | grep x=1 test
+	"$1" readonly "$@" then echo /usr/bin
+printf x=1 echo test "$1" x=1 cd "$1" sed -eu "$@" printf test readonly sed export
+${HOME} sed x=1 $(pwd) sed $(pwd) 2>/dev/null grep printf local
+		$(pwd) done 'quoted text' && local
+"$1" sed export export done readonly x=1 readonly
+export "$1" "$@" awk printf test awk $(pwd) echo sed --verbose -eu x=1 "$@"
+		/usr/bin /usr/bin --verbose done grep | && awk "$@" awk then then "$1"
+| awk "$@" | readonly
+	--verbose && 2>/dev/null "$1" $(pwd) /usr/bin /usr/bin "$1" echo | "$1" 'quoted text'
+2>/dev/null | then /usr/bin grep test echo export sed test x=1 'quoted text'
+/usr/bin -eu sed then cd readonly "$1" cd local printf awk awk /usr/bin
+		--verbose echo test "$1" done -eu done x=1 'quoted text' x=1 done
+	-eu awk x=1 'quoted text' && test && awk cd
+local /usr/bin export $(pwd) readonly 2>/dev/null printf x=1 "$1" printf
+	$(pwd) export 'quoted text' local 'quoted text' --verbose awk printf
+${HOME} export --verbose export grep grep export -eu readonly && 'quoted text'
+	local "$@" && -eu readonly done 2>/dev/null
+${HOME} "$1" | export grep done echo 'quoted text'
+sed done then then | x=1 $(pwd) grep then -eu --verbose --verbose
+-eu echo && -eu 'quoted text' --verbose done grep "$1" && "$@"
+		awk export "$@" grep --verbose readonly 'quoted text' 'quoted text'
+then echo printf x=1 then | grep readonly cd -eu
+	done "$@" awk then sed "$@" "$1" -eu echo "$1" 2>/dev/null --verbose | then &&
+local printf then printf then export /usr/bin ${HOME} "$1" test done printf
+		done ${HOME} -eu /usr/bin done local
+		readonly $(pwd) 'quoted text'
+	| "$@" x=1 2>/dev/null echo
+	${HOME} echo 'quoted text' ${HOME} echo test export 'quoted text'
+		x=1 --verbose awk 2>/dev/null 2>/dev/null cd --verbose --verbose 'quoted text'
+		${HOME} x=1 local "$1" grep then | echo local then /usr/bin ${HOME} 2>/dev/null
+	"$1" $(pwd) printf cd echo /usr/bin ${HOME} -eu local awk /usr/bin sed awk
+'quoted text' 2>/dev/null awk x=1 --verbose "$@" done readonly --verbose
+export --verbose grep $(pwd) cd $(pwd)
+		export /usr/bin local -eu cd "$@" x=1 printf
+x=1 done grep cd local --verbose
+		/usr/bin export grep 'quoted text' then 2>/dev/null
+	/usr/bin | | x=1 --verbose $(pwd) grep $(pwd) cd done local awk sed 'quoted text'
+	'quoted text' sed 'quoted text' then local && then &&
+		"$@" /usr/bin then printf local awk local && local local then
+	--verbose local printf ${HOME} test --verbose "$@" ${HOME} grep "$@" readonly export
+"$@" awk awk "$1" ${HOME} awk /usr/bin /usr/bin x=1 /usr/bin cd
+	awk export printf cd ${HOME} ${HOME} "$1" readonly local $(pwd) "$@" grep
+		| -eu export awk /usr/bin --verbose x=1 $(pwd) grep
+		'quoted text' x=1 sed x=1 ${HOME} cd "$@" $(pwd) 2>/dev/null export
+		/usr/bin /usr/bin export /usr/bin export
+"$@" export grep -eu then x=1 awk "$1" /usr/bin grep x=1 sed x=1 printf
+	$(pwd) | | "$@" x=1 readonly && cd $(pwd) && --verbose echo test then grep 'quoted text'
+	$(pwd) -eu sed ${HOME} grep --verbose then then printf "$1" "$1"
+x=1 printf 'quoted text'
+		test echo sed -eu /usr/bin awk | ${HOME}
+printf grep export done export
+"$@" done sed echo "$@" | local
+	grep sed sed echo ${HOME} local
+printf readonly "$1" sed cd --verbose | $(pwd) awk done
+| "$1" awk sed local
+	readonly && ${HOME} done grep
+	local && && "$1" echo printf &&
+${HOME} cd readonly ${HOME}
+		"$@" printf local ${HOME} ${HOME} printf ${HOME} x=1 then | "$@"
+"$@" | "$1" -eu grep $(pwd)
+		export "$1" export grep done printf "$1" 'quoted text' x=1 -eu --verbose
+		/usr/bin && $(pwd) then && export
+	local | readonly done x=1 "$1" -eu awk
+sed 'quoted text' echo "$@" $(pwd) grep local echo x=1 /usr/bin test && done
+	then ${HOME} && then export then && export -eu
+		--verbose -eu 2>/dev/null /usr/bin readonly
+${HOME} export cd test /usr/bin --verbose
+		'quoted text' awk printf ${HOME} 2>/dev/null x=1 2>/dev/null
+	&& awk export /usr/bin
+		sed echo export "$1" readonly "$@" then --verbose 2>/dev/null --verbose
+	then awk echo then x=1 |
+${HOME} | cd x=1 | readonly readonly 2>/dev/null printf --verbose
+		echo 2>/dev/null local x=1 'quoted text' grep "$@" sed ${HOME} 'quoted text'
+		test readonly x=1 ${HOME} echo export ${HOME} "$@" sed ${HOME}
+		2>/dev/null $(pwd) 2>/dev/null readonly sed 2>/dev/null | then
+		"$@" export && $(pwd) | then ${HOME} ${HOME} 2>/dev/null test "$1" "$1" && sed
+		${HOME} -eu --verbose sed readonly echo done awk "$@" awk -eu -eu local
+		done sed "$@" x=1 then "$1" && grep /usr/bin --verbose local sed local
+	2>/dev/null export "$@" printf ${HOME} then $(pwd)
+		cd x=1 sed "$@" then readonly x=1 x=1 "$1" &&
+	sed /usr/bin test "$@" --verbose grep | /usr/bin "$1" awk grep | grep test done
+| readonly $(pwd) test
+-eu local grep local | ${HOME} x=1 export
+export -eu readonly $(pwd)
+awk cd --verbose --verbose export
+	-eu 'quoted text' echo
+	${HOME} done --verbose /usr/bin local
+printf "$@" /usr/bin awk grep
+	printf "$1" /usr/bin grep cd local echo -eu 2>/dev/null && awk sed -eu ${HOME}
+		--verbose test -eu sed echo printf 'quoted text'
+"$1" | --verbose awk $(pwd) ${HOME} local x=1 'quoted text'
+test /usr/bin -eu then && ${HOME} printf
+		"$@" then echo | 'quoted text' ${HOME} x=1 | grep sed printf
+	printf | "$1" | grep export sed echo readonly then && echo
+'quoted text' done "$1"
+	export | echo sed --verbose cd "$@" 2>/dev/null
+cd then "$1" done $(pwd) sed -eu printf
+		awk printf then && awk 'quoted text' x=1
+	x=1 && --verbose ${HOME} /usr/bin then -eu
+		test "$1" awk /usr/bin -eu awk awk -eu && then test 'quoted text' echo
+awk then done done ${HOME} awk 'quoted text' printf local $(pwd)
+	2>/dev/null && -eu local && test 'quoted text' /usr/bin sed sed printf
+sed x=1 done printf cd | test
+--verbose test --verbose local grep echo printf $(pwd) awk
+		x=1 test "$@" --verbose x=1 $(pwd) export | | echo cd |
+sed awk printf test awk test x=1
+		printf 'quoted text' cd | /usr/bin -eu /usr/bin x=1 2>/dev/null 'quoted text'
+	--verbose echo sed && grep export ${HOME} printf /usr/bin
+x=1 export sed export printf
+/usr/bin export then && "$@" cd | --verbose export && "$1"
+"$1" x=1 echo $(pwd) 'quoted text' && echo /usr/bin
+		x=1 "$1" | cd grep -eu done
+	sed cd awk 'quoted text' -eu then $(pwd) readonly --verbose
+readonly done | --verbose test test export $(pwd) ${HOME} ${HOME} test
+		"$@" grep && local $(pwd) "$@" local done local awk awk grep test /usr/bin printf
+	then sed awk readonly local test awk cd 2>/dev/null then export "$1"
+2>/dev/null done 'quoted text' printf 'quoted text'
+then | x=1 awk cd then done
+		export done 'quoted text' x=1 'quoted text' && "$@" cd /usr/bin
+	readonly -eu done test local readonly
+then sed export grep then done
+	x=1 awk 2>/dev/null && -eu grep "$1" echo "$1" export
+awk grep "$@" cd test x=1 test
+	grep && cd echo printf -eu local && "$@" test cd
+$(pwd) then grep 'quoted text' ${HOME}
+"$1" /usr/bin readonly readonly "$1" 2>/dev/null && ${HOME}
+		${HOME} readonly local
+	grep && x=1 awk done -eu $(pwd) grep sed sed 'quoted text' ${HOME} local awk -eu
+/usr/bin -eu --verbose echo awk
+"$1" done "$@" then cd test | readonly --verbose
+	printf -eu ${HOME} $(pwd) /usr/bin | "$@" x=1
+	${HOME} | --verbose then then then && "$1" ${HOME} awk echo done
+		'quoted text' 2>/dev/null export
+		printf 2>/dev/null /usr/bin echo sed printf -eu "$@" ${HOME} --verbose
+	grep 'quoted text' export printf "$@" test printf "$1" then cd readonly
+		printf printf cd ${HOME} "$1" echo ${HOME} awk export done
+		printf "$1" done --verbose ${HOME} 2>/dev/null "$@" "$1" 2>/dev/null
+	test sed done x=1 cd then then | | 2>/dev/null -eu test done && | ${HOME}
+	then x=1 printf /usr/bin | local -eu --verbose local readonly $(pwd)
+	done 2>/dev/null test | sed -eu | && && done $(pwd) ${HOME} cd x=1 awk $(pwd)
+	-eu awk local then echo grep | --verbose printf done then -eu --verbose cd then
+	-eu ${HOME} test test then cd then $(pwd) readonly then $(pwd) /usr/bin
+cd echo /usr/bin export ${HOME} $(pwd) 'quoted text'
+	&& && done && local readonly $(pwd)
+-eu $(pwd) 2>/dev/null 'quoted text'
+		grep "$@" cd && local echo echo 'quoted text'
+	readonly | ${HOME} test 2>/dev/null sed sed awk printf echo export && x=1 ${HOME}
+	done grep /usr/bin /usr/bin local
+done local --verbose sed export ${HOME} cd echo then 2>/dev/null sed
+		| local 2>/dev/null | test $(pwd) sed
+		export /usr/bin $(pwd) awk /usr/bin local export "$@" $(pwd) echo test done "$1"
+		awk then readonly | sed awk test done cd test --verbose local local
+		--verbose --verbose test awk && ${HOME} test "$@" printf ${HOME} echo "$1" sed
+	sed sed -eu printf && 2>/dev/null
+	readonly && 'quoted text' readonly | $(pwd) echo local
+	/usr/bin "$1" done then printf then
+		| local echo 2>/dev/null then cd done --verbose local
+	echo grep 'quoted text' && 2>/dev/null 2>/dev/null
+		| printf 'quoted text' -eu awk 'quoted text' $(pwd) grep test
+		test echo readonly then --verbose then readonly ${HOME}
+echo echo /usr/bin awk awk then --verbose test readonly 'quoted text'
+cd export test test --verbose sed grep sed x=1 "$1" -eu && readonly sed
+2>/dev/null grep "$1" 'quoted text' | -eu x=1 "$1" x=1 done
+	2>/dev/null 2>/dev/null | echo 'quoted text' | echo x=1 ${HOME} x=1 printf test
+		printf sed "$@" done awk
+	echo sed then grep "$@" echo -eu done 2>/dev/null cd /usr/bin
+		$(pwd) --verbose sed printf grep cd then grep x=1 export
+-eu "$1" x=1 sed 2>/dev/null readonly printf grep ${HOME} 'quoted text'
+	$(pwd) grep --verbose "$@" export
+	done ${HOME} 'quoted text' $(pwd) grep && x=1 | readonly $(pwd)
+		&& export local 2>/dev/null $(pwd) awk -eu | printf sed then cd
+		/usr/bin 2>/dev/null && -eu x=1 awk echo $(pwd) readonly
+	export then "$@" 'quoted text' 'quoted text' --verbose readonly
+"$@" 'quoted text' then $(pwd) 2>/dev/null
+	then sed cd cd export then | readonly ${HOME} | --verbose
+$(pwd) "$1" test x=1 awk done ${HOME} --verbose
+		${HOME} "$@" done printf --verbose 2>/dev/null
+		done x=1 | x=1 local grep sed x=1 test cd readonly test 2>/dev/null ${HOME}
+		local ${HOME} 2>/dev/null test
+x=1 "$1" test 'quoted text' $(pwd) done readonly x=1 --verbose sed then awk
+	2>/dev/null sed "$1" printf export export then /usr/bin --verbose "$1" sed test
+		2>/dev/null | | printf 'quoted text' sed awk --verbose x=1
+		$(pwd) && | "$1" test 'quoted text' "$1" --verbose
+	'quoted text' | cd cd grep awk 'quoted text' then printf awk | --verbose
+	"$1" "$@" | x=1 done /usr/bin | -eu | then local
+	--verbose grep sed 'quoted text' "$@" sed
+	local grep && "$@" sed -eu test --verbose grep $(pwd) test
+		test x=1 "$1" 'quoted text' $(pwd) 2>/dev/null
+	export grep -eu && x=1 x=1
+		'quoted text' --verbose awk printf
+		/usr/bin echo -eu sed sed x=1 test $(pwd) -eu local | 'quoted text'
+		$(pwd) "$1" echo "$1" "$@" test ${HOME} ${HOME} echo 'quoted text' cd -eu grep
+done cd "$1" --verbose
+&& x=1 2>/dev/null --verbose --verbose then 'quoted text' grep
+		-eu readonly echo -eu cd grep && readonly awk && "$1"
+then done then ${HOME} readonly done awk then
+	"$1" 2>/dev/null 'quoted text' $(pwd) --verbose cd
+then sed | echo awk export cd cd export /usr/bin done awk "$@" /usr/bin
+	local done -eu awk echo sed local &&
+export grep 'quoted text' local readonly 2>/dev/null "$1" 'quoted text'
+	then ${HOME} cd 2>/dev/null 'quoted text'
+export test test $(pwd) 'quoted text' $(pwd) | "$1" 2>/dev/null 'quoted text'
+--verbose cd done -eu ${HOME} --verbose
+		local 'quoted text' grep ${HOME} sed 'quoted text'
+then test echo /usr/bin --verbose awk x=1
+		--verbose 'quoted text' | | x=1 $(pwd) sed awk x=1 "$1" "$1" 2>/dev/null $(pwd)
+		then test done x=1 "$1" awk sed awk echo
+	"$1" "$1" local echo x=1
+		"$1" readonly $(pwd) export printf 'quoted text'
+sed then | | done grep echo "$1" && awk /usr/bin test "$1" x=1
+		x=1 "$@" 2>/dev/null "$@" |
+	export awk printf export /usr/bin awk "$@" 'quoted text'
+		readonly && $(pwd) echo done sed awk test 'quoted text'
+&& ${HOME} && readonly sed grep grep
+		done readonly 2>/dev/null /usr/bin --verbose && done && local /usr/bin then --verbose
+	/usr/bin test export | $(pwd) then done sed export 'quoted text' ${HOME}
+/usr/bin "$1" "$@" local sed /usr/bin sed local && cd ${HOME}
+		"$@" grep && printf --verbose cd | 'quoted text' done printf export export
+	"$@" && readonly sed echo cd export done awk /usr/bin readonly "$@" "$@"
+readonly -eu test "$1" x=1 done x=1 test "$1" 'quoted text' ${HOME}
+	done 2>/dev/null "$1" local then "$1" /usr/bin then local -eu
+		echo $(pwd) x=1 done $(pwd) | "$1" $(pwd)
+		"$1" /usr/bin test && --verbose echo 'quoted text' done && echo
+	export grep cd | echo grep 'quoted text' then local local
+		| echo x=1 x=1 2>/dev/null -eu sed "$1" "$1" echo echo -eu cd $(pwd)
+		${HOME} -eu "$1" local -eu local --verbose local
+	"$@" printf then test grep $(pwd) "$@" cd -eu 2>/dev/null 'quoted text' 'quoted text'
+		then 'quoted text' "$1" x=1 'quoted text' local -eu ${HOME} echo "$1"
+	cd --verbose "$1" "$1"
+		/usr/bin grep 'quoted text' | 'quoted text' x=1 test awk
+/usr/bin awk --verbose sed test | printf echo ${HOME} &&
+"$@" | export then done grep ${HOME} cd 'quoted text'
+	local "$@" cd awk awk 'quoted text'
+		--verbose --verbose 'quoted text'
+		${HOME} && "$@" test "$@" /usr/bin --verbose local awk "$1" | -eu -eu sed
+	$(pwd) echo awk readonly done 2>/dev/null --verbose
+	"$1" then --verbose echo printf sed sed echo export echo 2>/dev/null
+		x=1 awk "$@" $(pwd) test
+${HOME} export 'quoted text' x=1 sed "$1" x=1 $(pwd) local 'quoted text' | -eu
+printf done cd test test sed "$1" echo $(pwd) test "$1" export grep then local
+		'quoted text' done "$1" cd then 'quoted text' local
+	then printf test echo sed /usr/bin cd test grep
+$(pwd) done "$1" then ${HOME}
+	cd ${HOME} then readonly grep done 2>/dev/null
+'quoted text' --verbose x=1 printf x=1 test test 'quoted text' x=1 sed awk
+-eu -eu --verbose done | cd ${HOME}
+		2>/dev/null -eu readonly /usr/bin "$1" 2>/dev/null "$1" "$@" cd sed
+	grep awk | 'quoted text' 'quoted text' cd readonly readonly then grep export
+	export "$@" echo "$@" x=1 && local cd 2>/dev/null 'quoted text' $(pwd)
+	${HOME} 2>/dev/null readonly
+		local 'quoted text' readonly ${HOME} --verbose echo awk -eu
+	cd x=1 sed done --verbose
+	--verbose echo && echo 2>/dev/null echo printf | "$@" awk local sed
+	grep x=1 --verbose echo sed && "$1" "$@" "$1"
+"$1" awk test then cd | sed
+then && echo -eu | /usr/bin
+		sed 'quoted text' then
+	--verbose sed "$1" echo
+	/usr/bin 'quoted text' test
+export printf export "$@" 'quoted text'
+${HOME} | grep ${HOME} grep "$@" ${HOME}
+	"$1" $(pwd) readonly ${HOME} echo --verbose && | test -eu | $(pwd) cd
+	export | x=1 readonly done "$@" $(pwd)
+/usr/bin x=1 then | awk local x=1 done "$@" -eu && "$1" "$@" echo
+export /usr/bin echo grep local /usr/bin /usr/bin /usr/bin --verbose
+	printf then printf done printf awk --verbose readonly x=1 /usr/bin
+		cd && && then printf test readonly grep local
+	-eu echo "$1" /usr/bin $(pwd)
+		-eu "$1" awk readonly printf && echo done
+		cd "$@" "$@" then -eu test done
+	${HOME} x=1 export local 'quoted text' test | printf /usr/bin "$@"
+	export 2>/dev/null $(pwd) done x=1 awk "$1" $(pwd) x=1
+		$(pwd) && /usr/bin awk $(pwd) export echo
+	grep sed echo printf then "$1" printf -eu x=1 test /usr/bin
+	2>/dev/null "$1" grep export readonly "$@" awk && grep then
+	export grep 2>/dev/null "$@" 'quoted text' sed test
+$(pwd) && export local readonly test readonly x=1 /usr/bin -eu ${HOME}
+	sed test $(pwd) readonly test "$1" -eu sed cd done done 2>/dev/null echo /usr/bin
+		2>/dev/null --verbose readonly grep 'quoted text' -eu $(pwd)
+		local 2>/dev/null x=1 $(pwd) && 2>/dev/null printf
+		awk sed printf 2>/dev/null then /usr/bin awk local readonly
+		then readonly echo cd /usr/bin x=1 x=1 "$@" cd --verbose
+-eu export "$@" printf echo | -eu printf done
+		export awk awk | readonly | "$@" test 'quoted text' awk awk $(pwd)
+x=1 sed /usr/bin ${HOME} && done awk test cd -eu then 'quoted text'
+		"$1" | $(pwd) readonly test 2>/dev/null local "$@" done x=1 --verbose --verbose
+		/usr/bin then grep && printf done
+/usr/bin sed local cd x=1 done
+	printf && test x=1 printf cd then "$1"
+		sed export -eu && $(pwd) /usr/bin awk printf
+		&& grep sed local sed then | && grep grep 'quoted text' 'quoted text' echo
+		--verbose ${HOME} awk cd && grep
+		cd --verbose /usr/bin cd "$@" $(pwd) then "$1" done sed 'quoted text' 2>/dev/null
+	awk local 'quoted text' ${HOME}
+		printf echo 2>/dev/null 2>/dev/null
+	&& -eu printf grep $(pwd) 2>/dev/null grep 'quoted text'
+test sed 'quoted text' && local done | sed -eu readonly awk --verbose
+grep grep "$1" "$1" test awk echo
+	test export | then export printf --verbose cd | local --verbose
+	${HOME} $(pwd) echo grep printf && grep readonly
+	export awk --verbose x=1 && 'quoted text' && | /usr/bin readonly echo
+/usr/bin ${HOME} then && 'quoted text' export done
+	sed -eu /usr/bin then /usr/bin printf $(pwd) $(pwd) echo |
+	2>/dev/null ${HOME} local export grep x=1 'quoted text' awk 'quoted text' $(pwd)
+${HOME} grep "$@" x=1 sed local "$1" sed done
+		printf /usr/bin -eu "$@" echo readonly -eu local --verbose -eu done
+	2>/dev/null local $(pwd) test cd local
+		"$1" -eu /usr/bin && | grep 'quoted text'
+readonly ${HOME} then
+| done --verbose -eu echo
+		2>/dev/null 'quoted text' awk | -eu cd --verbose --verbose --verbose 'quoted text'
+		sed test x=1 $(pwd) then && printf grep "$1" -eu test 'quoted text'
+/usr/bin readonly then 'quoted text' ${HOME} ${HOME} "$1"
+		x=1 then $(pwd) ${HOME} readonly
+	&& readonly local "$@" | awk ${HOME} then test export sed --verbose -eu
+	readonly export -eu /usr/bin export export -eu then /usr/bin sed sed ${HOME}
+export -eu x=1 local $(pwd) 2>/dev/null -eu export
+		done test done export 2>/dev/null x=1 done | test 2>/dev/null test $(pwd)
+x=1 --verbose grep done && "$1" $(pwd) $(pwd)
+echo && 2>/dev/null 2>/dev/null local "$1"
+		then | x=1 sed awk sed x=1 awk && readonly
+		'quoted text' "$@" then "$@" export | | then | cd $(pwd)
+test && && done awk sed ${HOME}
+	readonly ${HOME} readonly readonly
+awk echo /usr/bin local 'quoted text' printf cd $(pwd) 2>/dev/null
+		local grep --verbose 'quoted text' -eu ${HOME} readonly /usr/bin
+readonly test printf ${HOME}
+		echo 'quoted text' "$@" echo --verbose 'quoted text' 'quoted text' &&
+x=1 sed -eu cd cd && readonly
+	echo printf done readonly && --verbose readonly --verbose cd x=1 cd
+	"$1" cd /usr/bin "$@" test cd cd
+x=1 cd readonly 'quoted text' local test --verbose "$@" |
+	grep 'quoted text' x=1 cd /usr/bin
+	printf ${HOME} -eu $(pwd) test local sed grep "$1" awk
+echo 2>/dev/null -eu awk -eu then done grep 'quoted text' awk
+	"$1" 2>/dev/null 'quoted text' done echo --verbose
+	awk --verbose export done -eu
+| $(pwd) --verbose then 'quoted text' local local echo export &&
+	$(pwd) --verbose x=1 'quoted text' awk sed "$@"
+		done local | awk local readonly 'quoted text' ${HOME} | local readonly
+	then echo 'quoted text' readonly test /usr/bin echo -eu 'quoted text' /usr/bin
+'quoted text' 'quoted text' printf grep printf export $(pwd)
+	cd $(pwd) readonly ${HOME} /usr/bin echo done /usr/bin x=1 grep done echo
+export -eu awk 2>/dev/null 2>/dev/null "$@" && grep -eu then
+	awk export printf export test echo awk then x=1 | 2>/dev/null $(pwd)
+2>/dev/null then readonly | && printf 2>/dev/null -eu awk sed /usr/bin
+#include c93.sh
+		"$1" ${HOME} | done local 'quoted text'
+	local "$1" "$1" cd export | echo | then
+		echo | awk ${HOME} "$@" local "$1" --verbose 'quoted text' ${HOME} readonly
+		local then "$@" local test && | then printf "$@" 'quoted text'
+test 2>/dev/null && export printf ${HOME} echo cd
+-eu x=1 2>/dev/null $(pwd) ${HOME} "$@" && 'quoted text'
+		x=1 done local 2>/dev/null awk readonly awk $(pwd) cd cd "$@" x=1 "$1"
+x=1 2>/dev/null export sed cd grep test "$1" cd readonly
+	"$@" 2>/dev/null sed ${HOME} "$@" ${HOME} --verbose 2>/dev/null | readonly "$@"
+		'quoted text' x=1 "$@" x=1 echo printf x=1 ${HOME} /usr/bin
+		'quoted text' "$@" sed grep printf "$1"
+		cd $(pwd) test /usr/bin | sed readonly 'quoted text' x=1 export awk
+		echo --verbose 'quoted text' then && cd --verbose export then grep
+"$1" && --verbose x=1 export echo
+x=1 /usr/bin test "$@" cd | "$@" && sed grep | "$@" 2>/dev/null
+		echo then ${HOME} && readonly "$1" | 'quoted text'
+	awk local cd -eu --verbose 'quoted text' echo grep -eu
+	awk 'quoted text' -eu $(pwd) "$@" && "$1" && grep --verbose sed local
+echo printf x=1 sed cd --verbose
+	'quoted text' 2>/dev/null readonly | export sed echo readonly
+sed 2>/dev/null $(pwd) -eu
+sed --verbose 'quoted text' local
+local printf readonly local --verbose then then awk awk printf --verbose grep
+		"$1" | ${HOME} ${HOME} test
+	x=1 'quoted text' then $(pwd) x=1 | /usr/bin
+	readonly /usr/bin "$1" local
+		-eu awk printf -eu echo x=1 sed readonly 2>/dev/null "$@" x=1 printf awk
+	then $(pwd) then awk awk && printf && -eu readonly x=1 /usr/bin awk && test "$@"
+		$(pwd) awk sed sed --verbose "$@"
+/usr/bin done $(pwd) $(pwd) /usr/bin --verbose grep export
+	grep | awk export /usr/bin sed --verbose ${HOME} local "$@" ${HOME}
+		done ${HOME} | | sed cd echo --verbose local readonly local --verbose local sed
+	$(pwd) -eu sed /usr/bin grep done done grep "$1"
+$(pwd) readonly "$@" $(pwd) "$@"
+	printf --verbose 'quoted text'
+		"$1" x=1 "$@" echo 2>/dev/null --verbose --verbose x=1 echo ${HOME} awk test
+		-eu | 2>/dev/null cd test -eu then $(pwd) grep | sed
+	readonly ${HOME} echo export test 2>/dev/null then
+	cd | ${HOME} sed 2>/dev/null $(pwd)
+		then sed cd local printf && x=1 2>/dev/null export --verbose
+echo grep && ${HOME} then export then
+		grep export /usr/bin | --verbose printf done
+		readonly "$@" printf then | 2>/dev/null test export "$@" x=1 local done printf
+${HOME} /usr/bin printf x=1 awk export $(pwd) echo "$1" local done
+		'quoted text' $(pwd) done test x=1 readonly 'quoted text' x=1 sed done x=1 done
+		printf 2>/dev/null echo export --verbose
+	cd echo then x=1 /usr/bin export ${HOME}
+	grep awk readonly /usr/bin --verbose
+	${HOME} 2>/dev/null grep --verbose 2>/dev/null local
+-eu "$@" ${HOME} x=1 grep && cd | --verbose $(pwd) --verbose cd readonly
+		export "$@" ${HOME} done echo grep cd cd && --verbose grep $(pwd) ${HOME} "$1"
+| sed $(pwd) ${HOME} 2>/dev/null "$1" $(pwd) $(pwd)
+	$(pwd) "$1" -eu then 2>/dev/null
+	awk "$1" sed readonly echo awk --verbose export cd awk sed /usr/bin
+	then echo sed cd done "$@" sed /usr/bin | cd done
+	/usr/bin test printf local --verbose ${HOME}
+		'quoted text' x=1 && $(pwd) sed readonly
+	--verbose "$1" done test -eu printf ${HOME} local done ${HOME} readonly
+local done "$1" 'quoted text' | 'quoted text'
+	printf readonly $(pwd) echo grep
+&& $(pwd) && cd /usr/bin echo sed "$@" ${HOME} export
+		then ${HOME} local then /usr/bin cd | export
+	sed && awk "$1" export | done
+	x=1 export sed awk ${HOME} test 2>/dev/null && /usr/bin awk 'quoted text' "$1"
+	cd grep /usr/bin 'quoted text' "$1" cd local local sed /usr/bin
+then readonly && "$@" done && 2>/dev/null --verbose && 2>/dev/null &&
+		-eu $(pwd) "$1" ${HOME} export /usr/bin /usr/bin
+&& echo --verbose 'quoted text' 2>/dev/null "$@" /usr/bin $(pwd) /usr/bin printf
+$(pwd) sed grep | test -eu printf ${HOME} 2>/dev/null "$@" readonly
+	readonly sed awk echo
+	"$1" "$@" test x=1 local
+		"$@" printf test then export "$@" $(pwd) "$@" ${HOME}
+		&& "$@" 2>/dev/null --verbose done
+	export 'quoted text' local --verbose awk
+	readonly && export test printf && done -eu | /usr/bin echo
+	readonly && 'quoted text'
+	printf /usr/bin 2>/dev/null sed local test "$1" printf
+	$(pwd) echo && export readonly /usr/bin 'quoted text' export test 'quoted text'
+	local sed readonly "$@" local
+&& x=1 && | x=1 cd then done cd "$@" | echo
+	x=1 cd "$1" x=1 'quoted text' export --verbose printf --verbose
+		printf readonly sed then test ${HOME} && 2>/dev/null sed done local
+	export export local awk sed 'quoted text'
+	| cd readonly -eu --verbose "$@" ${HOME}
+printf --verbose 'quoted text' export x=1 $(pwd) $(pwd) x=1 "$1" | &&
+		${HOME} done cd done --verbose 'quoted text'
+	x=1 | && ${HOME} "$@" echo && "$@" awk printf ${HOME} printf
+		/usr/bin sed grep cd "$1" echo | test local
+		x=1 test echo 'quoted text' && --verbose
+done --verbose echo $(pwd) 'quoted text' grep cd 'quoted text'
+	cd printf $(pwd) /usr/bin -eu | "$1" printf
+	done grep | local sed 2>/dev/null readonly
+	awk export "$@" -eu done cd done 2>/dev/null echo done awk 'quoted text' "$1" grep
+		"$1" 'quoted text' done | cd "$@" sed --verbose grep 'quoted text' readonly
+	then ${HOME} && readonly sed readonly -eu "$1" grep cd ${HOME}
+		export done echo "$@" "$@" 2>/dev/null printf then -eu test done --verbose
+"$@" | && export | /usr/bin
+		"$@" 2>/dev/null export test x=1 export local
+	/usr/bin "$@" 2>/dev/null && readonly
+	local x=1 "$@" x=1 ${HOME} sed then $(pwd) $(pwd) "$@" printf -eu readonly
+readonly /usr/bin -eu done sed
+		&& done grep "$@" export printf 'quoted text'
+		"$@" /usr/bin cd cd grep "$@" --verbose &&
+		sed test -eu -eu printf 'quoted text' --verbose echo printf readonly
+	export local then printf readonly $(pwd)
+	awk local 2>/dev/null "$1" x=1 test sed --verbose
+	printf --verbose && then "$@" $(pwd) cd sed then printf && echo readonly 2>/dev/null
+	${HOME} 2>/dev/null --verbose
+sed "$1" --verbose $(pwd) "$1" | echo sed test local export /usr/bin
+		echo cd 'quoted text' echo cd && 'quoted text'
+	awk sed --verbose echo
+		readonly then "$1" 2>/dev/null export printf export /usr/bin /usr/bin
+		test /usr/bin 'quoted text' "$1" awk
+		-eu -eu grep x=1 | ${HOME} --verbose
+	"$1" export export readonly local export readonly
+	$(pwd) --verbose ${HOME} then grep local printf grep "$@"
+	'quoted text' 'quoted text' awk -eu sed && -eu | "$@" echo awk done
+		echo /usr/bin ${HOME} local
+		&& cd "$@" sed && -eu 2>/dev/null
+	printf test 2>/dev/null $(pwd) -eu -eu --verbose sed local "$@" test $(pwd) cd
+	grep 2>/dev/null "$@" 'quoted text' then grep
+| sed "$1" readonly && ${HOME} x=1 --verbose printf 2>/dev/null 2>/dev/null sed
+		$(pwd) /usr/bin sed $(pwd)
+		-eu echo && done /usr/bin /usr/bin 2>/dev/null
+then 'quoted text' export
+	test /usr/bin readonly -eu -eu then 'quoted text' 2>/dev/null
+export cd awk awk "$1" sed local | grep /usr/bin
+	local | -eu echo cd | sed | 'quoted text' done then
+		"$1" x=1 $(pwd) x=1 local | awk "$1" local "$@" then export
+"$1" 2>/dev/null "$1" grep then sed x=1 2>/dev/null 'quoted text' done
+	&& && cd export echo /usr/bin && /usr/bin done awk "$@" | readonly awk printf
+sed /usr/bin readonly --verbose printf test readonly 'quoted text'
+local readonly done | 'quoted text'
+	-eu local awk | 'quoted text' $(pwd) "$@" "$@"
+	"$@" local && then sed grep sed $(pwd)
+	awk then cd test then ${HOME} echo /usr/bin
+$(pwd) x=1 test "$1" /usr/bin
+readonly local 'quoted text' sed "$1" 2>/dev/null done /usr/bin
+local local -eu ${HOME} then "$@" --verbose | echo then --verbose 'quoted text'
+	| local echo awk export test &&
+	awk 'quoted text' --verbose local "$1" cd 2>/dev/null readonly "$@" 2>/dev/null
+	'quoted text' /usr/bin ${HOME} "$@" echo && /usr/bin
+	printf export /usr/bin cd sed sed grep test test 'quoted text' readonly
+		| done x=1 local grep cd test export done cd cd 2>/dev/null /usr/bin
+$(pwd) "$@" | --verbose test ${HOME} printf $(pwd) | --verbose
+	x=1 x=1 cd && ${HOME} awk export export grep 2>/dev/null
+	-eu -eu then | cd $(pwd) then x=1 --verbose local echo export test done awk
+	cd -eu then readonly sed
+		${HOME} | test $(pwd) awk grep awk sed echo then cd "$1" "$1"
+	test echo --verbose local && export
+grep -eu awk readonly sed cd local cd /usr/bin x=1
+/usr/bin then sed then printf "$1" export --verbose 2>/dev/null --verbose
+		readonly test | /usr/bin test 'quoted text' -eu -eu
+		sed cd grep done echo then
+		awk printf -eu -eu sed "$1" /usr/bin sed "$@" 2>/dev/null -eu awk test
+&& done done "$1" echo readonly /usr/bin grep 2>/dev/null
+		$(pwd) sed /usr/bin sed readonly done "$1" $(pwd) /usr/bin "$@" x=1 2>/dev/null
+test 2>/dev/null $(pwd) && awk echo awk --verbose then
+$(pwd) -eu done "$@" "$1"
+	then echo printf "$1" test | then x=1 "$@" 'quoted text'
+	printf ${HOME} done grep | done "$1" /usr/bin awk x=1 export --verbose echo 2>/dev/null
+		awk "$@" 'quoted text' -eu readonly && readonly printf echo then
+--verbose sed $(pwd) export -eu awk --verbose
+	'quoted text' cd ${HOME}
+"$1" sed -eu grep awk printf test x=1 test
+cd && -eu && sed | test -eu done 'quoted text' done readonly "$@" "$@" x=1 grep
+| --verbose local --verbose
+	echo cd then cd /usr/bin --verbose readonly
+&& /usr/bin cd grep $(pwd) 2>/dev/null
+-eu "$@" /usr/bin 'quoted text' 2>/dev/null test readonly local cd
+x=1 grep $(pwd) && x=1 2>/dev/null
+test "$@" readonly x=1
+		x=1 --verbose done sed /usr/bin cd then readonly
+	cd readonly local cd export readonly
+		readonly echo $(pwd) && export
+-eu /usr/bin && --verbose /usr/bin "$1" 2>/dev/null grep -eu local
+	grep 'quoted text' && $(pwd) -eu sed readonly "$1"
+	x=1 ${HOME} done x=1 x=1 $(pwd) test | readonly --verbose done test /usr/bin
+		--verbose then readonly then export sed sed -eu awk done -eu
+	/usr/bin cd awk && "$@" local readonly
+	readonly $(pwd) then /usr/bin test readonly printf test
+	done local --verbose 2>/dev/null
+x=1 awk /usr/bin | | test --verbose && --verbose done
+done then cd && local "$@" /usr/bin "$1" "$1" done echo test grep printf
+	test -eu done 'quoted text' readonly
+	export 'quoted text' done done grep 'quoted text' $(pwd) | ${HOME}
+	/usr/bin done $(pwd) "$@" ${HOME}
+"$@" 2>/dev/null readonly
+		"$1" echo test readonly readonly done -eu "$@" cd export grep ${HOME}
+		local | 'quoted text' grep cd echo /usr/bin readonly echo cd && readonly
+| echo sed -eu -eu sed readonly sed grep then cd && && -eu local $(pwd)
+-eu done | grep ${HOME}
+	--verbose awk x=1 2>/dev/null
+/usr/bin test 2>/dev/null 2>/dev/null "$@" $(pwd) "$@" awk test readonly
+${HOME} export $(pwd) printf local then printf
+$(pwd) "$@" awk then x=1 -eu readonly local
+		done "$1" $(pwd) printf "$@" -eu local test awk /usr/bin 'quoted text'
+		'quoted text' export echo
+		-eu awk awk | grep && echo grep ${HOME} printf
+	2>/dev/null "$1" local "$@" -eu cd sed $(pwd) test export local | local test
+cd 2>/dev/null --verbose 2>/dev/null test
+		"$@" /usr/bin $(pwd) && -eu then --verbose grep "$1" echo awk --verbose | local
+2>/dev/null then done then 2>/dev/null --verbose /usr/bin /usr/bin -eu
+"$@" ${HOME} sed | local grep test "$1"
+		local cd printf local local export echo | && readonly printf 'quoted text'
+	"$@" printf test sed printf 2>/dev/null -eu
+	-eu 2>/dev/null $(pwd) 'quoted text' readonly then /usr/bin done /usr/bin
+	done 2>/dev/null sed -eu --verbose cd export then echo cd "$@" grep
+	--verbose "$@" local && | awk | done cd awk /usr/bin "$@" ${HOME} readonly
+	&& && then test --verbose "$@" "$1" then
+		| 'quoted text' | && /usr/bin awk local printf "$@" local echo /usr/bin grep
+		export awk 2>/dev/null | done local 2>/dev/null echo --verbose 'quoted text'
+| --verbose x=1 /usr/bin done x=1 printf readonly local export "$1" 'quoted text'
+cd printf 2>/dev/null 2>/dev/null 'quoted text'
+		${HOME} awk | -eu readonly sed test "$@" $(pwd) --verbose
+&& /usr/bin done | && --verbose done 'quoted text' --verbose test "$@" readonly
+		grep | | cd sed test readonly test
+		export readonly "$1" $(pwd)
+&& sed sed then -eu export -eu && test grep export test && --verbose sed export
+	sed then readonly readonly | grep 'quoted text'
+grep awk awk | local "$1" x=1 local "$@" done
+	cd | export x=1 local done sed "$@" "$1" $(pwd) echo $(pwd) printf --verbose -eu
+		awk /usr/bin x=1 x=1 printf done local then awk
+		awk echo then --verbose
+readonly && printf then awk -eu --verbose echo
+	then readonly export export -eu cd echo printf awk
+		test echo readonly -eu --verbose /usr/bin | 'quoted text' && done "$1" awk x=1
+		"$@" ${HOME} local printf then "$1"
+	--verbose ${HOME} test ${HOME} x=1
+$(pwd) export sed && test grep sed 2>/dev/null
+	export /usr/bin then /usr/bin | -eu grep test x=1 | -eu then cd ${HOME} 'quoted text'
+echo /usr/bin awk export local printf --verbose
+		2>/dev/null test export /usr/bin done
+	"$@" $(pwd) $(pwd) sed export && --verbose x=1 sed export sed 2>/dev/null
+		grep ${HOME} --verbose grep test | /usr/bin echo done export
+	"$1" export -eu 2>/dev/null grep $(pwd) | $(pwd) sed readonly
+&& /usr/bin && --verbose "$@" then "$@" | then readonly | && -eu local
+cd "$@" 2>/dev/null printf local export 'quoted text' $(pwd)
+| readonly cd grep && awk then x=1 done "$@" /usr/bin ${HOME} done x=1 sed $(pwd)
+	&& export readonly x=1 grep "$1" -eu && awk awk | done printf readonly
+		cd $(pwd) then then echo grep grep test then grep local done x=1 export
+local 'quoted text' 2>/dev/null "$@" "$@" export ${HOME}
+	test 'quoted text' "$@" cd readonly -eu test
+		"$1" x=1 local echo -eu /usr/bin 2>/dev/null local && then cd
+		--verbose cd ${HOME} ${HOME}
+	--verbose /usr/bin sed ${HOME} ${HOME} | --verbose test $(pwd) x=1 sed 'quoted text'
+		"$@" -eu export x=1 then sed export $(pwd) grep "$@" 2>/dev/null | then
+done cd then x=1 awk test readonly local | then -eu grep | export
+		-eu ${HOME} | ${HOME} /usr/bin /usr/bin /usr/bin
+		readonly grep /usr/bin awk printf export
+	'quoted text' echo --verbose ${HOME}
+"$@" /usr/bin grep then ${HOME} "$@" 'quoted text' cd --verbose "$@" export
+		cd ${HOME} cd test grep done "$@" test awk readonly
+cd "$1" sed 2>/dev/null ${HOME} done 2>/dev/null
+	${HOME} "$1" awk | /usr/bin export sed done grep "$1" | then -eu
+		/usr/bin export export then x=1 awk --verbose awk && "$@" ${HOME}
+		"$1" awk && --verbose 'quoted text' | cd test export done done "$1" ${HOME}
+	| && $(pwd) /usr/bin done local x=1 /usr/bin -eu echo then
+	readonly 'quoted text'
+		| grep && then -eu ${HOME} 'quoted text' sed
+		"$@" test "$@" --verbose "$@" readonly
+	cd readonly export && done readonly readonly $(pwd) echo
+		${HOME} grep "$1" grep printf done cd sed ${HOME}
+	cd test 'quoted text' export | grep && readonly done "$1" then
+		readonly ${HOME} && && ${HOME} x=1 then "$@" &&
+		| readonly readonly local export "$1" local echo sed && grep then echo
+	export 2>/dev/null printf printf $(pwd) cd done "$@" --verbose "$1"
+		cd x=1 done "$1" awk $(pwd) "$1" 2>/dev/null 2>/dev/null test && --verbose
+readonly printf -eu 'quoted text' --verbose
+	x=1 /usr/bin "$1" awk "$@"
+	export 'quoted text' echo 'quoted text' echo
+		&& export | sed printf --verbose printf ${HOME} grep | x=1 'quoted text'
+		test 2>/dev/null $(pwd) sed then $(pwd) readonly export
+/usr/bin printf | 'quoted text' cd ${HOME} echo sed /usr/bin 2>/dev/null
+		$(pwd) 'quoted text' local
+		2>/dev/null /usr/bin sed then && grep then echo --verbose
+	test cd test | export && done 2>/dev/null grep
+	x=1 grep 2>/dev/null "$1" "$@" "$1"
+-eu test "$1" done "$1" local echo export
+		local | awk $(pwd) /usr/bin /usr/bin /usr/bin echo test $(pwd)
+then readonly && done cd then
+"$1" awk 2>/dev/null sed local 'quoted text'
+		"$@" 'quoted text' then ${HOME}
+		echo -eu 2>/dev/null 2>/dev/null
+		&& local "$@" readonly local local
+		test readonly | cd export -eu local 2>/dev/null $(pwd) $(pwd) sed
+		"$@" "$1" ${HOME} /usr/bin
+done done /usr/bin $(pwd)
+	test readonly grep && "$@" done "$@" | readonly "$@" test export
+export cd 'quoted text' sed then -eu grep cd 2>/dev/null
+		x=1 'quoted text' 2>/dev/null echo -eu sed then -eu grep echo awk then
+	&& -eu sed --verbose done local then test printf "$@" local | 'quoted text' "$1"
+grep 'quoted text' local $(pwd)
+		-eu echo sed "$1" local test test
+local awk 2>/dev/null -eu "$@" grep done --verbose /usr/bin
+		then cd /usr/bin 2>/dev/null
+	cd cd export done cd cd test ${HOME} x=1 $(pwd)
+	2>/dev/null "$1" ${HOME} --verbose -eu printf local readonly ${HOME} "$@" | export
+	${HOME} awk --verbose /usr/bin
+	| --verbose printf --verbose awk && -eu $(pwd) -eu then x=1 "$@" awk "$@"
+		| $(pwd) | sed readonly test then x=1 echo && sed $(pwd)
+	sed && x=1 "$@" then | -eu | --verbose $(pwd)
+	"$@" cd grep test test 2>/dev/null
+		x=1 test "$1" readonly then 'quoted text' "$1" done -eu done $(pwd)
+		-eu /usr/bin x=1 sed x=1 --verbose printf awk | -eu printf
+		sed awk /usr/bin done "$@" /usr/bin local /usr/bin export grep $(pwd)
+	"$1" --verbose "$1" x=1 x=1 echo printf --verbose 2>/dev/null ${HOME} readonly
+		&& -eu $(pwd) --verbose | export grep && ${HOME} printf
+		| awk cd x=1 && x=1 $(pwd) "$@" /usr/bin --verbose /usr/bin printf -eu | x=1
+test --verbose /usr/bin grep sed then 2>/dev/null
+export sed awk grep readonly local then
+		${HOME} 2>/dev/null "$@"
+		&& "$1" echo 2>/dev/null awk "$@" -eu -eu $(pwd)
+-eu /usr/bin awk echo "$1"
+		$(pwd) export printf test ${HOME} -eu ${HOME} "$@" readonly -eu printf 2>/dev/null
+test 2>/dev/null done echo cd test echo | --verbose
+	2>/dev/null && printf "$@" echo --verbose $(pwd) "$1" sed
+done then local && x=1 "$1" | $(pwd) -eu && printf sed && /usr/bin grep awk -eu
+export awk cd --verbose test local awk 'quoted text'
+		| 2>/dev/null | --verbose done "$@" &&
+		then 2>/dev/null -eu -eu && && $(pwd) && readonly awk
+	/usr/bin done -eu echo readonly sed export -eu test ${HOME} "$1" cd echo 2>/dev/null
+	cd cd $(pwd) $(pwd) "$1"
+	x=1 && ${HOME} "$1" -eu grep done sed -eu test | 'quoted text' && export
+local "$1" grep readonly 'quoted text' x=1 && x=1 -eu done grep
+		2>/dev/null 'quoted text' test -eu ${HOME}
+		sed printf | then then ${HOME}
+	x=1 test 2>/dev/null --verbose printf 'quoted text'
+	awk "$1" awk | cd -eu readonly done && readonly $(pwd)
+	| "$1" "$@" readonly test
+	-eu ${HOME} ${HOME} sed readonly readonly --verbose
+		printf && test readonly done
+	--verbose $(pwd) grep test done awk "$1" --verbose grep readonly test | sed
+	2>/dev/null --verbose "$1" 'quoted text' cd "$@" sed readonly
+		awk "$1" $(pwd) 2>/dev/null /usr/bin
+sed -eu cd local export
+		test --verbose x=1 "$@" "$@" cd
+	$(pwd) 2>/dev/null "$@" 2>/dev/null readonly then ${HOME} "$1" /usr/bin /usr/bin
+	export local --verbose echo grep done "$@" 2>/dev/null grep then 'quoted text'
+	test grep x=1 sed echo test -eu grep
+		export grep printf -eu "$@" awk 'quoted text'
+		-eu awk grep readonly "$1" printf ${HOME} $(pwd) | cd
+	&& grep test readonly echo echo printf then
+		sed sed done ${HOME} -eu test -eu cd then 2>/dev/null test sed export $(pwd) 'quoted text'
+	| && x=1 awk | readonly test /usr/bin sed --verbose --verbose cd "$1" 'quoted text'
+&& sed echo readonly readonly 2>/dev/null &&
+		&& local awk cd -eu x=1 | grep readonly sed x=1 $(pwd)
+	readonly sed awk readonly cd "$1" local then done export echo echo ${HOME}
+		done local --verbose 2>/dev/null cd then export test printf --verbose
+	$(pwd) $(pwd) "$1" sed 'quoted text' -eu export 'quoted text' --verbose /usr/bin
+'quoted text' -eu awk --verbose readonly done test 'quoted text'
+"$1" then echo then x=1
+	export printf ${HOME} -eu && 2>/dev/null grep local /usr/bin readonly sed
+$(pwd) x=1 | sed $(pwd) && done x=1 sed test 'quoted text' local export -eu then
+done readonly 2>/dev/null 2>/dev/null local --verbose -eu done echo
+		&& test && export -eu sed
+	$(pwd) 2>/dev/null -eu grep --verbose done printf printf && 'quoted text' readonly
+	sed $(pwd) 2>/dev/null x=1 grep 2>/dev/null awk
+&& echo ${HOME} -eu "$1" $(pwd) | --verbose ${HOME} grep then --verbose export
+	'quoted text' local cd readonly "$1" "$@" export x=1 "$@"
+		grep awk done x=1 ${HOME} /usr/bin grep local
+		grep /usr/bin -eu -eu x=1 test
+	sed awk -eu 2>/dev/null local --verbose readonly
+		| grep ${HOME} then done 'quoted text' sed
+	${HOME} /usr/bin $(pwd) echo sed
+	done export 'quoted text' "$@" sed 'quoted text'
+	${HOME} export local test 'quoted text'
+"$@" "$@" "$1" "$1" | "$@" echo done ${HOME}
+		then 2>/dev/null local echo then --verbose echo $(pwd) | /usr/bin
+	| 'quoted text' -eu sed "$1"
+--verbose x=1 export -eu -eu local && sed printf x=1 -eu
+grep awk | $(pwd) done 'quoted text' sed done local "$1" "$1" -eu
+done 'quoted text' "$1" /usr/bin then | $(pwd) --verbose
+'quoted text' test done then grep /usr/bin | -eu cd $(pwd)
+		--verbose cd $(pwd) awk sed /usr/bin awk
+sed readonly readonly echo awk sed $(pwd) "$1" "$@" -eu done x=1 awk
+		-eu sed sed ${HOME} printf printf --verbose --verbose && readonly printf -eu
+done | awk grep "$@" grep "$@" cd ${HOME} local ${HOME}
+		-eu ${HOME} then cd export readonly ${HOME} done ${HOME} | grep awk test && 'quoted text'
+awk test x=1 --verbose test done && && 2>/dev/null
+		readonly grep sed $(pwd) awk | grep printf sed --verbose readonly grep done
+--verbose local readonly x=1 2>/dev/null 2>/dev/null
+local echo && sed ${HOME} -eu export 2>/dev/null export
+done 2>/dev/null readonly $(pwd) awk done export && "$1" readonly 'quoted text'
+${HOME} --verbose $(pwd) sed $(pwd) export then export
+export 'quoted text' && && 2>/dev/null then -eu $(pwd) done 2>/dev/null
+	&& "$1" x=1 | "$1" done -eu done /usr/bin grep ${HOME} echo echo export x=1 /usr/bin
+	x=1 done 2>/dev/null "$1" awk && sed
+		done "$1" done /usr/bin "$1" -eu "$1" cd test
+		--verbose "$@" | 'quoted text' echo
+		$(pwd) && --verbose "$@" | export | awk ${HOME} then && $(pwd)
+	/usr/bin printf local "$@" local "$1" grep 2>/dev/null
+	&& then /usr/bin "$1"
+		x=1 "$@" 'quoted text' --verbose ${HOME}
+	awk 2>/dev/null x=1 x=1 "$@" cd done --verbose sed
+	/usr/bin cd x=1 --verbose "$1" done printf ${HOME}
+		${HOME} local readonly "$@" done sed $(pwd) --verbose $(pwd) 2>/dev/null
+	/usr/bin local sed echo echo "$1" $(pwd)
+"$1" local 'quoted text' "$1" | x=1 && | ${HOME}
+local readonly $(pwd) cd $(pwd) grep echo -eu then
+-eu echo test $(pwd) | 'quoted text' $(pwd) x=1 export cd -eu
+printf awk "$@" awk cd grep --verbose ${HOME} test
+		done then && && $(pwd) /usr/bin "$1" ${HOME} "$1"
+		"$@" | /usr/bin "$1" awk 2>/dev/null cd "$1" printf 'quoted text' &&
+		local $(pwd) ${HOME} x=1 x=1 cd test | "$1" cd $(pwd) sed
+2>/dev/null && -eu 'quoted text' | ${HOME} "$1" test sed ${HOME} local
+		2>/dev/null cd export
+	| printf local awk then then "$@" --verbose echo --verbose printf cd ${HOME}
+	"$1" 2>/dev/null 'quoted text' sed ${HOME} printf export sed echo
+		/usr/bin 'quoted text' export --verbose cd 2>/dev/null
+'quoted text' grep printf test local grep 'quoted text' ${HOME}
+	readonly readonly "$@" ${HOME} x=1 test -eu -eu sed then --verbose done x=1 --verbose
+	grep test then readonly "$1" awk
+/usr/bin | local sed awk done && done | && then grep x=1 ${HOME} --verbose --verbose
+"$@" cd -eu "$@" -eu ${HOME} x=1 awk cd && "$@"
+	2>/dev/null echo then test grep -eu "$@" "$@" "$@" ${HOME}
+	readonly /usr/bin /usr/bin --verbose readonly
+		&& 'quoted text' "$1" sed ${HOME} readonly then export | && ${HOME}
+	"$1" cd export cd grep cd test | | done x=1 | | /usr/bin $(pwd) then
+grep grep awk grep done x=1 x=1 ${HOME} $(pwd) && local
+	echo export test && test 2>/dev/null
+local awk x=1 done readonly && --verbose test done then 2>/dev/null --verbose
+		echo /usr/bin awk echo $(pwd)
+	2>/dev/null local 'quoted text' x=1 readonly x=1 cd 'quoted text' printf "$@" export
+2>/dev/null x=1 "$@" --verbose x=1 "$@" --verbose export done awk $(pwd) ${HOME}
+	| -eu "$1" echo done 'quoted text'
+done | export then echo awk export sed
+	&& $(pwd) "$1" "$@" readonly export readonly $(pwd)
+--verbose /usr/bin "$1" --verbose export local /usr/bin "$@" cd /usr/bin
+	export "$@" "$@" 'quoted text' cd "$1"
+$(pwd) test "$@" /usr/bin
+	then then printf $(pwd) ${HOME}
+| --verbose test done sed done 'quoted text' echo echo sed
+		grep sed awk --verbose done $(pwd) "$@"
+	-eu echo 2>/dev/null "$@" printf 2>/dev/null
+$(pwd) then grep x=1 export export grep x=1 test 'quoted text'
+--verbose x=1 "$1" x=1 | 2>/dev/null 'quoted text' $(pwd) local --verbose $(pwd)
+		echo 'quoted text' cd then /usr/bin
+grep x=1 2>/dev/null sed x=1 &&
+		${HOME} printf ${HOME}
+		test 'quoted text' done test echo /usr/bin
+	test /usr/bin /usr/bin sed local 'quoted text'
+		test "$1" local cd sed awk done grep 2>/dev/null
+		echo readonly 'quoted text' printf awk then local printf
+	readonly --verbose $(pwd) local "$1" | --verbose "$1" grep
+		| /usr/bin --verbose done then x=1 cd /usr/bin x=1 ${HOME} done
+grep echo "$@" local $(pwd) "$@" echo x=1 export
+		export | --verbose x=1 "$@"
+		&& local then x=1 printf /usr/bin then
+		&& x=1 sed -eu x=1 $(pwd)
+	test grep echo then x=1 cd then export "$1" "$@" --verbose
+echo export ${HOME} then sed cd
+	readonly cd readonly --verbose awk export local cd
+echo | export echo cd test ${HOME} export then /usr/bin "$1" ${HOME} /usr/bin
+--verbose 2>/dev/null x=1 $(pwd) /usr/bin
+readonly local export grep x=1 cd ${HOME} grep
+	printf "$1" /usr/bin done "$@" export awk && ${HOME}
+&& export echo 2>/dev/null cd done readonly sed /usr/bin "$@" export printf 'quoted text'
+| then local x=1 printf awk done grep
+--verbose $(pwd) readonly "$1"
+	test /usr/bin "$@" ${HOME}
+		'quoted text' 2>/dev/null awk --verbose
+	'quoted text' --verbose $(pwd) | export "$1" --verbose ${HOME} x=1 cd
+		| sed /usr/bin grep /usr/bin readonly done test 'quoted text' test
+${HOME} --verbose awk awk -eu 2>/dev/null
+		local local $(pwd) $(pwd) export
+		'quoted text' "$1" export --verbose local | printf test $(pwd) awk | | "$@" 2>/dev/null
+	local printf ${HOME} done grep test && 'quoted text'
+	$(pwd) awk readonly local /usr/bin cd grep $(pwd)
+		"$1" sed --verbose printf awk | then printf echo cd
+x=1 --verbose echo then --verbose 2>/dev/null
+		export "$@" ${HOME} /usr/bin printf printf grep cd "$1" readonly
+	"$1" sed ${HOME} $(pwd)
+sed export sed sed 2>/dev/null "$1" --verbose 2>/dev/null -eu x=1
+then x=1 'quoted text' sed done grep cd sed grep export "$1" sed /usr/bin
+/usr/bin awk $(pwd) "$@" "$1" grep | then grep printf "$1" 2>/dev/null
+		test printf grep export grep test "$@" "$1" ${HOME} x=1 test x=1 2>/dev/null
+	awk "$1" $(pwd) printf 2>/dev/null -eu export
+		sed grep awk printf grep readonly --verbose 'quoted text' &&
+	&& 2>/dev/null printf 'quoted text' then x=1
+done -eu --verbose 2>/dev/null awk 'quoted text'
+	| $(pwd) done /usr/bin 2>/dev/null awk cd export local $(pwd)
+	test export local 2>/dev/null
+	x=1 printf 'quoted text' awk grep grep ${HOME} printf sed
+'quoted text' ${HOME} then readonly test "$@" /usr/bin ${HOME}
+		'quoted text' 2>/dev/null echo --verbose grep /usr/bin ${HOME} ${HOME} && then
+		export local -eu local $(pwd) test local 'quoted text' readonly readonly
+"$@" 2>/dev/null -eu | | ${HOME} done local local local printf sed 2>/dev/null
+	'quoted text' sed x=1 -eu sed && local
+		done 'quoted text' sed local x=1 cd grep x=1
+"$@" --verbose local 2>/dev/null /usr/bin then grep grep done then grep x=1 cd
+	"$1" sed awk done ${HOME} 'quoted text' /usr/bin 2>/dev/null readonly
+awk 2>/dev/null | 2>/dev/null export x=1 ${HOME} &&
+/usr/bin done x=1 then local grep grep grep readonly done /usr/bin --verbose
+		x=1 local "$1" grep |
+'quoted text' /usr/bin && printf 2>/dev/null test
+		printf /usr/bin | grep done done ${HOME} test
+'quoted text' --verbose 'quoted text' && echo ${HOME} test awk done 2>/dev/null
+test -eu grep ${HOME} echo
+	-eu sed "$@" "$@" "$@" awk printf --verbose
+	cd 2>/dev/null sed done | --verbose printf done test done echo export export 2>/dev/null
+	"$1" printf x=1 test grep then && x=1 "$@" export readonly
+		done ${HOME} local $(pwd)
+echo && grep local grep done readonly test 2>/dev/null echo
+	${HOME} --verbose --verbose | -eu
+		done sed "$1" "$@" | then sed $(pwd) 'quoted text' cd $(pwd)
+sed awk done local grep x=1 "$1" --verbose "$1" export --verbose --verbose
+	cd echo done "$1" 2>/dev/null export grep $(pwd) /usr/bin awk 2>/dev/null $(pwd)
+		sed export cd cd sed | export --verbose awk printf readonly then --verbose
+'quoted text' 2>/dev/null
+"$1" ${HOME} ${HOME} x=1
+readonly 'quoted text' printf 'quoted text' then -eu
+		--verbose -eu /usr/bin /usr/bin test export sed test sed x=1
+	awk "$@" then 'quoted text' 2>/dev/null echo --verbose test readonly | echo ${HOME}
+	local x=1 -eu grep sed | readonly ${HOME} --verbose && printf echo "$1"
+&& readonly "$@" $(pwd) $(pwd)
+		then local readonly "$@" test | ${HOME} done -eu echo awk printf
+	-eu x=1 && grep && echo "$1" echo
+		--verbose 2>/dev/null awk ${HOME} export echo
+		--verbose cd "$1" printf cd $(pwd) "$1" /usr/bin x=1 -eu "$1" && -eu && &&
+	local $(pwd) export && "$@" then "$@" 2>/dev/null
+	"$@" export 2>/dev/null -eu local "$1" printf ${HOME}
+	2>/dev/null cd cd "$1" local export export "$1" --verbose x=1 --verbose
+		${HOME} 2>/dev/null grep printf "$1" x=1 sed x=1 sed -eu
+	then export cd readonly readonly "$@" grep local cd cd echo cd 2>/dev/null sed /usr/bin
+--verbose "$@" x=1 done && ${HOME} local readonly ${HOME} test -eu 'quoted text'
+"$@" "$1" 'quoted text' then | -eu cd readonly | -eu
+		test | x=1 /usr/bin then && local grep export sed printf
+cd 'quoted text' then
+	x=1 -eu awk local $(pwd)
+		/usr/bin sed | export /usr/bin cd 'quoted text' grep $(pwd)
+	$(pwd) awk $(pwd) ${HOME}
+		test local awk "$@" export && 2>/dev/null
+	'quoted text' local && 'quoted text' 'quoted text' echo
+		"$1" ${HOME} then && 2>/dev/null then sed grep "$@" done && test
+		-eu --verbose then --verbose -eu local cd readonly echo grep echo
+	local cd grep /usr/bin "$1" export sed echo
+cd printf grep --verbose done "$@" 2>/dev/null --verbose -eu
+	$(pwd) local echo test printf
+grep readonly --verbose readonly "$@" cd | /usr/bin
+		$(pwd) grep /usr/bin -eu "$@" printf
+		2>/dev/null 2>/dev/null then | 2>/dev/null 'quoted text' -eu 2>/dev/null
+	'quoted text' then --verbose local echo printf cd readonly done $(pwd)
+		&& sed local readonly --verbose --verbose
+sed grep readonly test test
+		cd local printf "$1" then | "$@" done 'quoted text'
+| local $(pwd) done 'quoted text' "$1" /usr/bin
+then -eu 2>/dev/null local /usr/bin x=1 ${HOME} "$@" ${HOME} echo 2>/dev/null
+	grep echo $(pwd) export --verbose $(pwd) $(pwd) 2>/dev/null awk then &&
+		done local echo -eu local 'quoted text' $(pwd) echo then grep 'quoted text'
+		cd 'quoted text' readonly sed $(pwd) 'quoted text'
+		then echo echo test printf --verbose awk printf | export awk grep
+	export 2>/dev/null grep ${HOME} test "$1"
+printf readonly 2>/dev/null then export | printf "$@"
+printf "$1" "$1" printf grep
+| | $(pwd) done -eu "$@" | --verbose /usr/bin
+&& echo 'quoted text'
+	grep local $(pwd) readonly
+${HOME} echo local sed -eu cd "$@"
+2>/dev/null "$@" test && x=1
+		'quoted text' export printf
+test local done && x=1
+		"$@" $(pwd) 'quoted text'
+		'quoted text' --verbose then /usr/bin -eu local export | test
+cd test test sed cd ${HOME} $(pwd) done x=1 "$@" /usr/bin
+		readonly awk -eu x=1 "$@" | /usr/bin "$1" readonly readonly x=1 cd sed "$1"
+then export readonly printf then /usr/bin grep cd && -eu x=1 && echo "$@"
+x=1 sed grep export 'quoted text' done test "$1" | "$@" && 2>/dev/null
+	&& cd echo export awk x=1 printf 2>/dev/null echo 'quoted text' test
+	local 'quoted text' cd 'quoted text' 'quoted text' &&
+test --verbose $(pwd) 2>/dev/null done grep sed 'quoted text' "$@"
+	grep echo -eu $(pwd) | readonly
+test done export awk grep awk local ${HOME} --verbose export /usr/bin | "$1" ${HOME}
+		printf --verbose done readonly $(pwd) 2>/dev/null -eu ${HOME} cd
+		/usr/bin "$@" then test sed cd 2>/dev/null $(pwd) 'quoted text' local cd sed /usr/bin
+export 'quoted text' awk printf "$@" echo local test
+		echo /usr/bin done $(pwd) ${HOME}
+		$(pwd) "$@" --verbose cd -eu export && | awk "$@" x=1 "$1" 'quoted text'
+		printf 2>/dev/null printf && "$@" "$@" readonly
+2>/dev/null readonly export grep awk then ${HOME} echo -eu done then
+	test cd x=1 /usr/bin grep then grep -eu echo
+	printf | ${HOME} 2>/dev/null --verbose "$@" ${HOME} awk x=1 "$@" cd && "$1" awk
+		printf && ${HOME} -eu x=1 ${HOME} 'quoted text' ${HOME} "$@" echo | 'quoted text'
+&& printf 'quoted text' -eu echo
+		local echo echo printf readonly -eu readonly --verbose
+		${HOME} sed 2>/dev/null "$@"
+		--verbose test export export | printf local cd && cd sed x=1 /usr/bin
+echo test cd cd grep cd 'quoted text' $(pwd)
+/usr/bin | readonly sed "$@" $(pwd) readonly | printf && 'quoted text' export
+	x=1 /usr/bin ${HOME} test && done
+	| 'quoted text' echo 2>/dev/null $(pwd) $(pwd) $(pwd) $(pwd) sed 2>/dev/null
+	grep "$@" awk 'quoted text' export x=1 'quoted text'
+		x=1 2>/dev/null readonly test
+/usr/bin | --verbose test readonly x=1 readonly printf echo 2>/dev/null
+	2>/dev/null x=1 && grep $(pwd) -eu printf awk test /usr/bin
+export awk -eu x=1 | grep awk awk
+echo test cd --verbose && x=1 x=1 test printf grep
+export then test | ${HOME} -eu "$1" --verbose ${HOME}
+		then sed && x=1 "$@" ${HOME} | export test export sed "$1"
+	$(pwd) 'quoted text' cd sed && test then /usr/bin
+--verbose test 'quoted text' test
+	&& test readonly /usr/bin /usr/bin /usr/bin then echo grep done cd
+"$1" export && cd /usr/bin done grep cd done "$1" 'quoted text' test --verbose
+		--verbose /usr/bin 2>/dev/null local grep test printf "$1" /usr/bin
+sed grep ${HOME} "$@" --verbose sed done readonly 'quoted text'
+		$(pwd) grep && /usr/bin 'quoted text' sed echo "$@" cd done
+		"$1" "$1" echo then then echo awk
+		"$@" grep done echo export
+	&& ${HOME} local printf
+/usr/bin | readonly --verbose 'quoted text' then local
+local "$@" "$1" grep test
+		readonly 2>/dev/null readonly ${HOME} awk "$@" /usr/bin awk $(pwd)
+-eu $(pwd) sed printf then --verbose "$1" readonly && then
+	${HOME} $(pwd) $(pwd) sed "$1" export ${HOME}
+	x=1 $(pwd) readonly $(pwd) sed test sed ${HOME} local && export
+	grep | 'quoted text' printf readonly && then -eu local sed
+	then $(pwd) /usr/bin "$@" &&
+		sed grep && export cd then "$@" x=1 x=1 && echo
+	-eu && awk | readonly grep readonly /usr/bin | cd | grep readonly "$@"
+		readonly echo "$@" readonly grep export
+	&& echo then sed "$@" printf ${HOME} done export awk grep
+		$(pwd) then local 'quoted text' then /usr/bin 'quoted text'
+${HOME} grep $(pwd) && $(pwd)
+		then export 2>/dev/null --verbose x=1 awk export export
+| cd then /usr/bin cd local
+done --verbose grep export then local "$@" -eu echo readonly then
+awk $(pwd) /usr/bin && --verbose ${HOME} ${HOME} "$1"
+		x=1 readonly awk grep -eu ${HOME} -eu readonly awk 2>/dev/null x=1 $(pwd) $(pwd)
+	$(pwd) "$@" /usr/bin "$@" then grep grep 2>/dev/null grep 'quoted text'
+	2>/dev/null echo $(pwd)
+awk 2>/dev/null cd printf printf echo --verbose "$@"
+	grep x=1 export "$@" export test awk cd 'quoted text'
+done 2>/dev/null -eu local then cd &&
+		echo | cd --verbose echo "$1" local local local "$@" done ${HOME}
+	then echo test test local 'quoted text'
+	then printf cd "$1" 'quoted text' && readonly test
+		/usr/bin -eu export 2>/dev/null "$1" -eu awk awk readonly ${HOME}
+&& /usr/bin printf x=1 "$1" readonly "$@"
+-eu local awk local grep && 'quoted text' test 2>/dev/null && cd
+${HOME} && then export then 2>/dev/null
+	2>/dev/null done -eu awk 2>/dev/null grep printf --verbose
+test sed sed ${HOME} x=1 sed echo 2>/dev/null | awk x=1 export cd sed x=1
+		test | echo /usr/bin ${HOME}
+		grep 2>/dev/null /usr/bin export then && cd done x=1 $(pwd) test ${HOME}
+readonly test "$@" --verbose awk /usr/bin sed printf printf
+		awk export cd sed awk test $(pwd) "$@"
+	awk echo then then /usr/bin 2>/dev/null $(pwd) printf
+	-eu --verbose 'quoted text' ${HOME} readonly
+		done local 2>/dev/null grep && && 'quoted text'
+	${HOME} printf done local /usr/bin grep then awk x=1 2>/dev/null
+		grep then done export "$@" 2>/dev/null readonly 'quoted text' test sed -eu
+		sed then export "$@" printf /usr/bin local 'quoted text'
+		printf printf echo 'quoted text' awk $(pwd) -eu readonly 'quoted text'
+"$1" 'quoted text' printf 2>/dev/null
+	2>/dev/null done grep awk x=1 test then cd
+		-eu "$@" awk local ${HOME} --verbose && awk local
+-eu 'quoted text' cd x=1 ${HOME} then readonly x=1 --verbose readonly grep printf
+		local printf awk readonly
+		echo 'quoted text' readonly
+| --verbose 2>/dev/null "$1" test
+		echo -eu sed -eu "$@" test
+	"$@" 2>/dev/null local echo "$1" readonly x=1 --verbose -eu -eu sed awk sed export
+$(pwd) $(pwd) "$1" 2>/dev/null printf then
+&& test 'quoted text' echo "$@" x=1 "$@" --verbose x=1 && 2>/dev/null
+-eu | export echo then printf
+	export awk x=1 grep 2>/dev/null $(pwd)
+		awk $(pwd) 2>/dev/null then readonly
+		x=1 cd test $(pwd) "$1" "$1" ${HOME}
+		cd $(pwd) "$1" readonly readonly printf "$@" "$@" cd -eu printf "$1" ${HOME}
+	printf | done "$@" 'quoted text' x=1 export cd grep test "$1" test "$1" 2>/dev/null
+		&& local 2>/dev/null -eu "$1" /usr/bin done done sed /usr/bin
+	cd --verbose grep && ${HOME} cd /usr/bin printf 2>/dev/null
+| readonly then grep 2>/dev/null
+	grep /usr/bin local then ${HOME}
+	x=1 'quoted text' awk awk /usr/bin cd cd /usr/bin done
+	awk export printf 2>/dev/null
+	cd awk && readonly test 2>/dev/null then done grep readonly /usr/bin
+		&& 'quoted text' export 2>/dev/null
+echo local awk x=1 | ${HOME}
+		printf done --verbose ${HOME} printf cd "$1" cd x=1 awk && "$@" echo export
+${HOME} grep && readonly then cd "$@"
+	&& awk -eu 2>/dev/null 'quoted text' test readonly then ${HOME} done
+		| 2>/dev/null -eu then --verbose awk
+		2>/dev/null /usr/bin awk sed 2>/dev/null printf sed 'quoted text' grep "$@"
+grep test printf awk awk local then "$@" 'quoted text'
+x=1 | local 'quoted text' cd echo x=1 | local
+		export /usr/bin local $(pwd) echo && then cd
+done awk /usr/bin export 'quoted text' echo local
+echo 'quoted text' done $(pwd) -eu then "$1" echo "$@" $(pwd) --verbose then
+test --verbose ${HOME} test cd echo /usr/bin local export awk
+		$(pwd) x=1 ${HOME} $(pwd) ${HOME} ${HOME} $(pwd) echo grep readonly echo
+2>/dev/null ${HOME} 2>/dev/null | echo awk /usr/bin printf sed "$1" then awk test
+awk ${HOME} export printf readonly readonly test sed ${HOME} | x=1
+	cd local awk printf export echo 2>/dev/null "$1" "$@" grep --verbose
+	echo printf x=1 && 2>/dev/null done "$1" local
+--verbose $(pwd) x=1 && 2>/dev/null 2>/dev/null test then test 'quoted text'
+		--verbose then then local && 2>/dev/null grep done test /usr/bin
+	readonly then "$@" done then awk echo echo -eu "$@" $(pwd) done
+	2>/dev/null printf grep
+"$@" local readonly awk "$@"
+2>/dev/null awk readonly 2>/dev/null | printf "$@"
+		'quoted text' $(pwd) && export $(pwd) /usr/bin readonly $(pwd) export cd ${HOME}
+	--verbose readonly export done local
+		x=1 test awk echo awk local | echo cd
+	"$@" done | "$@" local awk | -eu
+	x=1 sed test "$1" x=1 echo -eu awk then readonly export "$@" grep -eu done
+	test "$@" "$1" awk done sed test | "$1" 'quoted text'
+		&& export 2>/dev/null sed sed | printf
+	'quoted text' awk && --verbose ${HOME} readonly "$1"
+	printf then then -eu printf then
+	"$@" then cd cd ${HOME} echo echo done ${HOME}
+		awk --verbose readonly then local x=1 --verbose $(pwd) /usr/bin
+/usr/bin 'quoted text' x=1 $(pwd) readonly && awk grep test readonly "$1"
+sed 2>/dev/null 'quoted text' then 2>/dev/null $(pwd) export
+	| test then export sed sed ${HOME}
+	$(pwd) awk && -eu cd printf ${HOME} sed x=1 | export $(pwd)
+	then awk -eu test grep 2>/dev/null awk -eu echo
+	then 2>/dev/null export
+--verbose 2>/dev/null done --verbose cd sed
+		${HOME} sed local "$@" local test printf echo test 2>/dev/null
+	$(pwd) | readonly ${HOME} | "$@" /usr/bin && x=1 2>/dev/null
+		2>/dev/null $(pwd) 2>/dev/null sed then then test
+	/usr/bin awk local 'quoted text' readonly
+	&& /usr/bin test $(pwd) readonly "$@" export && readonly | ${HOME} 'quoted text'
+	"$@" echo cd --verbose /usr/bin echo cd cd $(pwd) && $(pwd) "$@" 2>/dev/null
+		-eu x=1 sed test local -eu "$@" x=1
+	awk grep local local -eu echo then cd local
+		local /usr/bin done done printf readonly $(pwd) then awk echo ${HOME} readonly
+cd 'quoted text' --verbose grep
+		"$1" grep "$@" sed then then done "$@" 2>/dev/null 'quoted text' "$@" test awk
+		-eu test local "$@" local readonly test 'quoted text'
+sed printf printf "$1" grep $(pwd) 'quoted text' done --verbose
+	$(pwd) sed && 'quoted text' | printf
+		echo /usr/bin --verbose | "$1" then grep 2>/dev/null x=1 | -eu local
+	sed "$@" 2>/dev/null grep sed local 'quoted text'
+${HOME} ${HOME} readonly test 'quoted text' "$1" | sed "$1" 2>/dev/null echo
+'quoted text' -eu --verbose printf local -eu echo 'quoted text'
+		$(pwd) grep test awk grep cd && "$@" /usr/bin && --verbose grep readonly
+	cd -eu test cd $(pwd) /usr/bin test cd local --verbose local ${HOME} grep then
+x=1 printf printf export cd 2>/dev/null local grep export then readonly
+done sed x=1 2>/dev/null | x=1 local
+		--verbose cd -eu awk /usr/bin --verbose
+printf "$@" then $(pwd) grep &&
+	grep | cd "$@" awk echo done && then test -eu
+		| cd then ${HOME} grep && readonly readonly
+| "$@" "$@" --verbose 2>/dev/null |
+		"$1" 2>/dev/null -eu ${HOME} "$@" echo grep $(pwd) echo
+		test echo cd "$1" done x=1 && test printf $(pwd)
+		'quoted text' --verbose /usr/bin then "$1" awk then
+$(pwd) ${HOME} printf | 2>/dev/null
+printf 2>/dev/null printf
+	echo export local 2>/dev/null readonly printf then printf "$1" cd done && test
+		$(pwd) && printf then 'quoted text' 'quoted text' "$1"
+${HOME} ${HOME} export "$1" |
+		local echo grep $(pwd) 2>/dev/null --verbose cd done
+	--verbose -eu "$@" local done test
+		readonly -eu 2>/dev/null printf echo 'quoted text' readonly && export
+	x=1 local then ${HOME} echo printf
+		&& cd "$1" && test "$@" awk readonly 'quoted text' /usr/bin awk
+2>/dev/null readonly done --verbose
+echo readonly && awk 2>/dev/null
+x=1 2>/dev/null "$@" readonly then
+${HOME} /usr/bin /usr/bin /usr/bin
+		printf local echo awk printf awk cd grep echo printf | | cd /usr/bin
+x=1 | && sed then done export "$1" 2>/dev/null echo
+printf --verbose 2>/dev/null sed sed awk export awk |
+then readonly "$1" "$@" local local awk --verbose
+	test printf grep test ${HOME}
+	--verbose ${HOME} x=1 then sed cd /usr/bin sed 2>/dev/null ${HOME} && | echo
+-eu "$1" cd /usr/bin grep $(pwd) cd "$@" $(pwd) | echo test ${HOME} awk
+| awk -eu 'quoted text' awk $(pwd)
+	echo cd /usr/bin export then $(pwd) --verbose sed local export -eu | 'quoted text'
+		'quoted text' then test /usr/bin grep -eu --verbose sed grep --verbose
+echo printf x=1 2>/dev/null ${HOME} && | 2>/dev/null echo echo export
+	then local done "$@" --verbose awk && then "$@" sed awk export | printf
+		'quoted text' grep test 'quoted text' --verbose done awk
+"$1" x=1 2>/dev/null
+		sed "$@" "$1" export ${HOME}
+		awk "$@" export printf /usr/bin && echo ${HOME} then $(pwd) /usr/bin readonly
+awk -eu /usr/bin x=1 awk 2>/dev/null /usr/bin local /usr/bin x=1
+	grep /usr/bin echo echo sed printf awk 'quoted text' | then | printf "$1"
+	printf x=1 /usr/bin | echo /usr/bin --verbose 'quoted text'
+	&& 'quoted text' printf /usr/bin
+cd export sed "$@" sed x=1 cd "$1" ${HOME}
+	done printf "$@" $(pwd) echo local /usr/bin echo /usr/bin
+-eu local cd test ${HOME} then "$@" | echo grep $(pwd) sed &&
+'quoted text' awk 2>/dev/null echo 'quoted text' --verbose echo printf -eu cd
+	-eu --verbose $(pwd) done -eu export x=1 "$@" cd x=1 'quoted text' "$@"
+$(pwd) done cd done echo ${HOME} readonly "$@" local done 2>/dev/null
+		printf "$1" && awk then ${HOME} $(pwd) -eu "$1"
+2>/dev/null sed 2>/dev/null
+	"$1" done "$1" x=1 local done
+	/usr/bin cd done done cd sed awk $(pwd) cd ${HOME} cd --verbose
+		"$1" "$@" ${HOME} x=1 x=1
+${HOME} "$@" | -eu sed "$1" /usr/bin 2>/dev/null /usr/bin
+		2>/dev/null printf ${HOME} cd x=1 'quoted text' "$@" awk $(pwd) && -eu
+local /usr/bin echo local 'quoted text' cd -eu "$1"
+	echo sed -eu echo --verbose | cd 2>/dev/null printf export sed | --verbose
+	grep grep grep --verbose
+		grep "$1" readonly test export
+	export -eu printf 2>/dev/null test local awk --verbose awk export $(pwd) 'quoted text'
+	${HOME} then 'quoted text' export cd then /usr/bin ${HOME}
+		cd echo | /usr/bin then
+done x=1 local --verbose echo "$1" awk
+		$(pwd) --verbose printf
+		readonly export echo --verbose x=1 -eu
+	/usr/bin then done ${HOME} $(pwd) "$@" then /usr/bin
+		&& /usr/bin "$1" "$1" | "$1" && echo ${HOME} /usr/bin "$1" printf export cd
+		printf --verbose 'quoted text' test printf echo && printf then 2>/dev/null printf
+	test /usr/bin test local local
+grep -eu grep -eu "$@" "$1" readonly && cd $(pwd) echo
+$(pwd) -eu readonly 'quoted text' echo | printf
+readonly done local ${HOME}
+	export awk sed "$1" export && "$1" /usr/bin awk -eu 2>/dev/null
+		| --verbose printf test /usr/bin
+		-eu local ${HOME} | 'quoted text' export test awk -eu --verbose && local 2>/dev/null
+		$(pwd) sed cd /usr/bin -eu cd "$1" --verbose readonly
+	awk x=1 -eu -eu x=1 | /usr/bin -eu "$@" local done
+then readonly printf --verbose /usr/bin
+$(pwd) --verbose local ${HOME}
+	-eu done -eu $(pwd) && echo readonly $(pwd) sed 2>/dev/null echo /usr/bin sed done
+		| test printf grep export cd x=1 echo
+		-eu awk --verbose ${HOME} export sed export
+		'quoted text' readonly readonly -eu
+/usr/bin sed grep x=1 test awk grep
+		"$1" test $(pwd) "$1" "$@" "$1" printf
+	awk "$1" ${HOME} | then done test then
+		echo export then grep export | cd awk grep export
+		test 'quoted text' 'quoted text' $(pwd) sed 2>/dev/null
+then $(pwd) awk 'quoted text' -eu --verbose && $(pwd) test 'quoted text' $(pwd)
+		"$1" $(pwd) x=1 && cd
+	$(pwd) grep /usr/bin ${HOME} readonly
+		sed cd x=1 cd $(pwd) local 'quoted text' sed readonly printf $(pwd) 2>/dev/null
+	x=1 done test --verbose grep echo "$1" local sed awk export
+		x=1 echo ${HOME} "$@" done grep cd /usr/bin /usr/bin readonly 2>/dev/null
+cd x=1 | "$@" x=1 grep printf
+&& test sed test awk && cd | cd cd "$@" done 'quoted text' awk
+2>/dev/null | grep -eu ${HOME} 'quoted text' $(pwd) 2>/dev/null awk -eu echo
+	cd ${HOME} test test $(pwd) readonly
+		| printf 2>/dev/null local test && 'quoted text' ${HOME} then local "$1" 'quoted text'
+awk x=1 ${HOME} --verbose grep printf done 'quoted text' $(pwd)
+	$(pwd) test | test $(pwd) 2>/dev/null | "$@" ${HOME}
+		-eu "$1" 2>/dev/null done
+		echo $(pwd) --verbose -eu echo awk ${HOME}
+printf then 'quoted text' test && "$@"
+&& 2>/dev/null --verbose local grep cd done cd &&
+cd ${HOME} 'quoted text' echo echo && && ${HOME} done awk awk "$@" "$@" cd -eu
+		| sed ${HOME} ${HOME} test awk done ${HOME} $(pwd) readonly "$1" --verbose grep
+		readonly sed | printf done | done ${HOME}
+	test sed | cd --verbose && --verbose grep done readonly --verbose
+$(pwd) 'quoted text' readonly -eu && x=1 then grep
+		export x=1 readonly grep "$@" local
+then readonly 2>/dev/null local readonly
+	grep local /usr/bin /usr/bin -eu --verbose then cd then export 'quoted text'
+		test -eu export 2>/dev/null
+	test --verbose "$@" grep "$1" done awk readonly 2>/dev/null cd
+	$(pwd) awk ${HOME} | readonly export 2>/dev/null grep "$@" done /usr/bin x=1 then
+echo done local cd sed --verbose sed readonly && cd "$1" --verbose "$@" --verbose
+	awk local "$@" cd grep "$@" sed
+		--verbose --verbose --verbose ${HOME} export 2>/dev/null readonly | then &&
+		then -eu /usr/bin grep $(pwd) -eu sed grep done done export $(pwd) echo
+		-eu 'quoted text' sed awk "$1" done && 'quoted text' grep export awk x=1 printf
+2>/dev/null test 'quoted text' then readonly printf |
+	test && readonly awk && 'quoted text' readonly
+		$(pwd) "$@" | && done test
+$(pwd) 'quoted text' export
+		export cd cd ${HOME} local test 2>/dev/null
+then && awk test local done local readonly "$@" ${HOME} x=1 sed
+	'quoted text' printf export $(pwd) grep "$1" $(pwd) printf local local cd /usr/bin
+		readonly ${HOME} printf sed x=1
+		cd --verbose 2>/dev/null done grep && ${HOME} cd sed local | local
+sed readonly -eu cd x=1 cd ${HOME} "$1" -eu grep echo ${HOME} printf done readonly
+	2>/dev/null && --verbose && awk grep 'quoted text' "$1"
+	local /usr/bin local cd 'quoted text' "$1" /usr/bin awk 'quoted text' 2>/dev/null
+		x=1 printf && x=1 ${HOME}
+	&& && $(pwd) echo readonly -eu $(pwd) | test grep && && 'quoted text'
+		"$1" readonly 2>/dev/null | 'quoted text' && then 'quoted text'
+	awk 2>/dev/null echo | test echo x=1 cd grep readonly sed 'quoted text'
+		"$1" grep done 2>/dev/null && cd
+x=1 local 2>/dev/null ${HOME} && then readonly $(pwd) -eu "$1" printf -eu
+	--verbose readonly $(pwd) 2>/dev/null x=1 "$@" awk export grep export -eu
+	printf --verbose test sed ${HOME} export ${HOME}
+	x=1 grep local && cd awk
+		export echo cd ${HOME} --verbose
+local && readonly "$1" printf
+	done awk $(pwd) printf echo awk
+	local 'quoted text' 'quoted text'
+	sed "$@" printf 2>/dev/null && readonly
+grep export x=1 $(pwd) -eu then | 2>/dev/null local
+-eu export $(pwd) printf cd printf awk cd "$@" x=1 readonly && $(pwd) x=1
+${HOME} "$1" 2>/dev/null test export done ${HOME} "$1" echo |
+	test then printf 'quoted text' export && -eu echo ${HOME} grep
+"$@" grep test --verbose --verbose printf --verbose
+printf 2>/dev/null printf grep then echo readonly
+awk done local | then then 'quoted text'
+		| done x=1 $(pwd) /usr/bin printf
+grep ${HOME} export 'quoted text' grep "$@" test "$1" 2>/dev/null local awk grep
+	awk $(pwd) /usr/bin cd grep /usr/bin
+	2>/dev/null | sed | 'quoted text' "$@" 'quoted text' cd local cd local
+$(pwd) $(pwd) then echo 'quoted text' export
+		test 2>/dev/null x=1 then test ${HOME} cd local
+		awk readonly printf | && --verbose 'quoted text' echo 2>/dev/null local --verbose
+		-eu 2>/dev/null sed "$1" 2>/dev/null "$@" done x=1 echo
+		--verbose 2>/dev/null sed x=1 test ${HOME} cd printf printf $(pwd) then --verbose
+echo export $(pwd) --verbose cd $(pwd) 2>/dev/null test sed readonly $(pwd) --verbose
+		export x=1 'quoted text' "$@" then done ${HOME} sed
+${HOME} sed awk echo done cd
+		printf readonly ${HOME} 2>/dev/null --verbose $(pwd) cd 'quoted text' "$@" x=1
+	2>/dev/null x=1 /usr/bin | 'quoted text' then ${HOME} 'quoted text'
+	export echo then ${HOME} 2>/dev/null sed /usr/bin
+		local local /usr/bin awk
+		cd "$@" cd echo local x=1 2>/dev/null 'quoted text'
+		readonly echo then readonly
+		$(pwd) export local cd | sed then printf 'quoted text' awk && 'quoted text'
+		"$1" "$@" awk /usr/bin 'quoted text' $(pwd) done then 2>/dev/null
+	readonly ${HOME} cd readonly
+echo grep "$1" && grep sed printf $(pwd)
+		grep | | /usr/bin "$1" ${HOME} awk readonly local /usr/bin "$@"
+		"$1" test test --verbose echo
+	done x=1 cd local --verbose cd 2>/dev/null && 'quoted text' local 2>/dev/null
+		2>/dev/null "$@" local -eu awk "$@" cd 'quoted text' $(pwd) cd 'quoted text' $(pwd)
+	printf | sed then "$1" grep export $(pwd) readonly cd 2>/dev/null export
+then 'quoted text' /usr/bin $(pwd) "$1" ${HOME}
+echo && local grep cd awk done -eu sed 'quoted text'
+		-eu -eu -eu --verbose /usr/bin /usr/bin
+		cd 'quoted text' then /usr/bin && /usr/bin ${HOME} "$@" "$@"
+		2>/dev/null && $(pwd) && | 2>/dev/null
+		"$1" /usr/bin "$@" "$@" $(pwd) /usr/bin
+	/usr/bin 2>/dev/null ${HOME} readonly
+	${HOME} | "$1" sed 'quoted text' done printf "$@"
+	done cd cd 'quoted text' grep readonly "$@"
+echo grep "$1" grep "$1" --verbose 'quoted text' echo
+"$@" ${HOME} done grep 'quoted text' "$@"
+grep $(pwd) x=1 | 'quoted text' -eu readonly awk awk 2>/dev/null
+	"$1" cd $(pwd) $(pwd) ${HOME} awk done "$1" /usr/bin 2>/dev/null
+	sed readonly sed 2>/dev/null ${HOME} && sed local local printf
+		/usr/bin test local local && -eu test | printf
+		readonly then export
+		x=1 echo then -eu 2>/dev/null
+	printf /usr/bin readonly --verbose awk
+2>/dev/null awk done printf && then -eu
+		| echo 2>/dev/null grep local "$1" $(pwd) cd grep ${HOME} -eu "$1" then x=1 export
+		| cd grep 2>/dev/null test test done $(pwd) awk awk printf 'quoted text'
+	then done then then "$@" | "$@"
+		then awk export --verbose
+		cd export "$1" test export /usr/bin "$1" sed 2>/dev/null grep
+		"$1" | /usr/bin test
+/usr/bin /usr/bin $(pwd) cd "$@" cd 'quoted text' sed export $(pwd) $(pwd)
+		&& grep | then done ${HOME} then "$1"
+	echo 2>/dev/null /usr/bin 'quoted text'
+	&& sed done sed 'quoted text' ${HOME}
+| done awk local ${HOME} grep readonly local export
+		2>/dev/null /usr/bin "$@" ${HOME} printf && $(pwd) "$1" cd x=1 grep
+awk then test ${HOME} export local --verbose cd cd grep printf $(pwd) "$@"
+		| 'quoted text' /usr/bin awk && cd sed 2>/dev/null cd then then echo test
+-eu awk printf $(pwd) printf -eu 2>/dev/null local awk
+		awk /usr/bin printf printf readonly --verbose 'quoted text' "$1" /usr/bin export
+local && 'quoted text' test done --verbose echo
+		cd printf "$@" $(pwd) then printf then "$1" sed "$1" | export awk --verbose
+		export test --verbose done /usr/bin awk
+		echo printf local && /usr/bin then 2>/dev/null
+grep local echo awk local sed readonly cd grep readonly
+/usr/bin --verbose $(pwd) ${HOME} cd 2>/dev/null
+done test "$1" --verbose done && --verbose
+	test x=1 "$1" cd $(pwd) readonly
+| cd --verbose awk "$1" x=1 awk done local --verbose "$1" local
+readonly grep && then readonly
+	test printf sed "$1" ${HOME} local -eu export -eu printf "$1" --verbose ${HOME}
+"$@" x=1 $(pwd) $(pwd) && --verbose x=1 printf done export -eu ${HOME}
+		readonly /usr/bin -eu --verbose grep
+local 2>/dev/null /usr/bin x=1 cd --verbose echo $(pwd) awk /usr/bin --verbose
+awk "$1" echo readonly $(pwd) && && grep --verbose "$1" $(pwd)
+		sed --verbose -eu printf 'quoted text' "$@" "$@" 'quoted text' "$@"
+-eu then && awk cd 2>/dev/null readonly printf awk sed
+	| awk then then cd then "$@"
+		grep then then --verbose 'quoted text' local local 2>/dev/null echo ${HOME}
+-eu echo ${HOME} readonly && export readonly done
+		export "$@" x=1 "$@" -eu sed grep then | readonly | sed ${HOME} test /usr/bin
+--verbose sed local && sed then -eu
+printf grep test 'quoted text' 2>/dev/null && /usr/bin
+	awk test $(pwd) printf "$1" awk test echo sed export printf "$@" 'quoted text'
+sed test "$1" 'quoted text'
+		-eu $(pwd) printf grep grep printf x=1 printf done ${HOME} "$1"
+	awk 2>/dev/null then awk local x=1 readonly
+		/usr/bin ${HOME} "$1" then
+'quoted text' 2>/dev/null grep 2>/dev/null
+2>/dev/null sed "$1" | --verbose local x=1 x=1
+		local awk $(pwd) "$1" /usr/bin test --verbose sed grep
+		&& sed readonly "$1" ${HOME}
+		"$@" ${HOME} done --verbose x=1 awk "$@" done test printf 2>/dev/null x=1 "$1"
+| grep grep grep done ${HOME}
+then printf sed x=1 test export x=1 local "$1" && test | cd readonly
+	2>/dev/null 2>/dev/null && ${HOME}
+2>/dev/null cd x=1 cd awk printf 2>/dev/null
+		2>/dev/null then /usr/bin echo grep echo done cd then test
+	--verbose -eu export | | done grep sed cd --verbose echo
+then ${HOME} -eu export $(pwd) printf printf "$@" then -eu printf "$@" && "$1"
+&& $(pwd) 'quoted text' /usr/bin sed echo printf export ${HOME}
+		"$@" cd sed done grep grep awk readonly x=1
+printf 'quoted text' echo "$1" awk
@@ -0,0 +1,2001 @@
+		local printf printf $(pwd) awk readonly | $(pwd) 2>/dev/null test readonly
+	/usr/bin 'quoted text' export "$1" awk printf && "$@" -eu local
+	${HOME} --verbose "$1" printf "$1" x=1 test ${HOME}
+		cd local | then $(pwd) /usr/bin --verbose readonly ${HOME} sed grep 2>/dev/null
+	"$@" 'quoted text' && "$1" "$1" 2>/dev/null "$@"
+	local -eu x=1 'quoted text'
+		local --verbose export readonly export
+		2>/dev/null "$1" cd sed "$@" 'quoted text'
+	'quoted text' "$@" cd sed
+		| test | local ${HOME} echo awk sed ${HOME} "$@" 2>/dev/null
+	grep $(pwd) sed printf grep "$@" -eu local && export echo echo
+	&& printf && ${HOME} grep test
+	/usr/bin cd 'quoted text' | | echo readonly $(pwd) sed sed export ${HOME}
+	then 'quoted text' 'quoted text'
+echo --verbose --verbose done --verbose 'quoted text'
+-eu local done local -eu --verbose export cd test
+		readonly ${HOME} printf | done sed "$@" then x=1 echo
+printf $(pwd) export 2>/dev/null
+-eu -eu ${HOME} -eu echo then readonly /usr/bin then -eu && done then then sed
+		$(pwd) | -eu x=1 then x=1 test $(pwd) test local echo
+		sed | "$@" test 'quoted text' echo done export export $(pwd) echo x=1 "$@" 2>/dev/null
+		"$1" echo | export 'quoted text' readonly cd
+		--verbose done test local grep readonly grep cd $(pwd)
+		"$@" | /usr/bin 'quoted text'
+		"$@" $(pwd) 'quoted text' echo $(pwd)
+"$1" then local then sed ${HOME} export --verbose done
+/usr/bin "$@" && export x=1 local export readonly
+${HOME} "$1" 'quoted text' done ${HOME}
+		sed -eu "$@" local done cd then -eu grep local echo grep echo
+		printf cd cd /usr/bin && 2>/dev/null 'quoted text'
+then then local grep 2>/dev/null "$@" 2>/dev/null
+x=1 then awk "$1" done /usr/bin done export
+		&& local /usr/bin printf x=1 readonly awk $(pwd)
+	'quoted text' export | cd
+done awk local export /usr/bin echo
+grep grep printf test && "$1" export readonly 2>/dev/null
+		"$1" then "$@" 'quoted text' && awk --verbose
+	-eu -eu 2>/dev/null ${HOME} x=1 && /usr/bin then "$1" cd export grep
+	x=1 $(pwd) export /usr/bin | cd 'quoted text'
+export "$1" printf "$@" x=1 awk readonly printf
+		-eu sed readonly && done "$1" x=1 local ${HOME} /usr/bin
+	echo printf "$@" grep export sed 'quoted text' 'quoted text'
+--verbose sed echo done --verbose | x=1 "$1"
+sed "$1" awk test printf sed done then
+		cd echo "$1" test -eu -eu sed printf test
+	/usr/bin | done 2>/dev/null
+		x=1 | "$1" readonly then awk
+		done echo sed awk then "$@"
+-eu test "$@" grep /usr/bin "$1" 2>/dev/null 2>/dev/null then x=1
+	sed "$1" 2>/dev/null done 2>/dev/null grep --verbose sed -eu
+/usr/bin then sed done | 'quoted text' grep /usr/bin -eu awk
+		local export -eu then then printf -eu 2>/dev/null export echo echo $(pwd)
+		"$@" grep "$@" "$@" ${HOME} done ${HOME} grep then readonly
+		readonly cd x=1 "$@" x=1 printf
+	'quoted text' then "$1" $(pwd) export 'quoted text' cd ${HOME} grep
+${HOME} 'quoted text' done 'quoted text'
+-eu /usr/bin export x=1
+readonly test test --verbose readonly --verbose
+	cd then /usr/bin test && && cd && awk "$@"
+		export --verbose "$1" test done test
+		awk sed --verbose awk 2>/dev/null $(pwd) $(pwd) then cd &&
+		x=1 sed local readonly printf 'quoted text' test local
+x=1 $(pwd) sed echo done sed -eu then echo
+		sed x=1 x=1 && export x=1 cd x=1 "$@" 'quoted text' x=1 && then 'quoted text'
+		$(pwd) "$@" --verbose 'quoted text' 'quoted text' done "$1"
+	awk /usr/bin readonly printf ${HOME} 'quoted text' readonly 2>/dev/null ${HOME}
+		sed 2>/dev/null awk printf "$@" 2>/dev/null local ${HOME} grep -eu |
+		--verbose /usr/bin sed 'quoted text' ${HOME} x=1 ${HOME} 2>/dev/null grep && 2>/dev/null
+	-eu "$1" local done && printf x=1 x=1 | ${HOME}
+readonly && "$@" ${HOME} --verbose readonly
+	readonly /usr/bin | readonly | cd ${HOME} x=1 -eu ${HOME} then "$1" printf awk
+	"$1" printf cd done x=1 readonly cd test grep
+		grep /usr/bin cd test cd done
+		printf 2>/dev/null awk readonly echo /usr/bin "$@" awk export cd ${HOME}
+'quoted text' -eu cd readonly done -eu ${HOME} 'quoted text' done && /usr/bin
+grep sed ${HOME} "$@" 'quoted text'
+| x=1 sed test test ${HOME} /usr/bin awk --verbose
+		/usr/bin 2>/dev/null 'quoted text'
+		$(pwd) | 2>/dev/null /usr/bin "$1" then $(pwd) awk --verbose
+	${HOME} "$@" && --verbose readonly
+	then echo 'quoted text' ${HOME} echo awk ${HOME} sed
+2>/dev/null && readonly
+		printf ${HOME} ${HOME} 'quoted text'
+"$1" | "$@" local -eu ${HOME} readonly && x=1 cd /usr/bin
+	x=1 done /usr/bin | 2>/dev/null done done sed done
+		$(pwd) /usr/bin "$1" --verbose grep | readonly readonly echo awk
+$(pwd) --verbose x=1 $(pwd)
+then "$@" printf -eu export | && sed cd 2>/dev/null
+		| -eu then export 2>/dev/null ${HOME} printf local local -eu 2>/dev/null
+/usr/bin echo -eu -eu ${HOME} cd test readonly && readonly "$@" cd && 2>/dev/null
+x=1 readonly test export 2>/dev/null readonly "$@" printf $(pwd)
+/usr/bin /usr/bin readonly echo
+awk grep 'quoted text' echo awk 2>/dev/null awk test -eu export
+		"$1" local grep grep readonly awk export printf sed && done 'quoted text'
+		/usr/bin "$1" /usr/bin grep printf then
+--verbose ${HOME} printf $(pwd) 2>/dev/null
+		-eu grep /usr/bin ${HOME} x=1
+x=1 echo 'quoted text'
+		| -eu | "$1" | --verbose ${HOME} readonly
+"$@" "$@" /usr/bin export then then
+	done then "$@" $(pwd) -eu test readonly readonly && "$1" awk printf
+	sed /usr/bin grep "$1" $(pwd) test /usr/bin readonly ${HOME}
+	done --verbose grep awk test /usr/bin "$@" -eu
+	2>/dev/null 2>/dev/null test $(pwd) "$@" test readonly 2>/dev/null
+$(pwd) 'quoted text' test done printf && export done
+	echo echo test 'quoted text' readonly
+"$1" x=1 echo "$1" "$1" 'quoted text'
+	| readonly -eu test export --verbose done done done sed "$1" done
+'quoted text' "$@" readonly "$@" 'quoted text'
+	"$@" 2>/dev/null done then
+cd | sed --verbose then export grep test then local test sed test x=1 /usr/bin
+	export done x=1 sed $(pwd) echo sed printf awk | awk test x=1 /usr/bin
+	awk readonly test then "$1" export
+awk readonly awk "$@" | local | ${HOME} --verbose local "$1"
+		${HOME} echo -eu grep $(pwd) 2>/dev/null export grep then printf /usr/bin $(pwd)
+		-eu | test readonly | /usr/bin /usr/bin
+	2>/dev/null printf readonly done echo
+		sed readonly && "$1" then
+	cd --verbose --verbose /usr/bin --verbose
+		sed done awk readonly "$1" cd |
+	--verbose echo | -eu ${HOME} sed "$1" readonly ${HOME}
+		test printf --verbose && 2>/dev/null x=1 awk cd export
+	'quoted text' export printf $(pwd)
+		/usr/bin local "$@" printf
+sed /usr/bin "$@" then test cd local awk ${HOME} "$@" "$1" --verbose
+then "$@" "$@" $(pwd) x=1 -eu $(pwd) awk /usr/bin readonly awk readonly x=1
+	"$@" export test /usr/bin then "$@" printf export grep then | && -eu | ${HOME}
+		${HOME} readonly ${HOME} 'quoted text' "$@" readonly done readonly
+		-eu "$@" ${HOME} 2>/dev/null
+	--verbose 2>/dev/null -eu --verbose && && /usr/bin local $(pwd) export
+		echo $(pwd) sed "$@" -eu | done 2>/dev/null "$@" 'quoted text'
+grep printf awk echo x=1 ${HOME} test echo | cd sed export ${HOME}
+2>/dev/null "$1" -eu test export $(pwd) test "$@" readonly
+	"$1" done awk $(pwd) then "$@" test done "$@" x=1 grep readonly
+		/usr/bin ${HOME} then test test done grep cd local ${HOME} $(pwd) printf 'quoted text'
+	local sed "$1" awk cd done 2>/dev/null sed cd export 2>/dev/null
+	2>/dev/null -eu -eu ${HOME} --verbose -eu local cd 'quoted text' x=1 && test &&
+	"$@" "$1" "$@" readonly --verbose export readonly -eu export
+awk $(pwd) "$@" 2>/dev/null 2>/dev/null 'quoted text'
+		--verbose echo /usr/bin
+	local then && printf cd 'quoted text' readonly
+	printf printf awk awk ${HOME} awk printf -eu && "$1" ${HOME} ${HOME} "$@"
+		readonly "$1" "$@" --verbose ${HOME} printf && && done echo local done
+test export readonly echo -eu -eu then printf
+/usr/bin 2>/dev/null ${HOME} grep echo | grep
+test ${HOME} done sed local readonly done -eu && "$1" ${HOME} 2>/dev/null grep
+x=1 export done grep cd -eu local 'quoted text'
+${HOME} "$@" echo "$1" 'quoted text' done done -eu
+echo echo --verbose export local printf
+cd awk "$1" awk "$@" echo /usr/bin then done
+"$1" awk /usr/bin test export $(pwd)
+printf ${HOME} -eu /usr/bin sed --verbose
+		${HOME} awk 2>/dev/null
+printf && 'quoted text' awk cd 'quoted text' readonly awk && --verbose
+local ${HOME} then test sed then $(pwd)
+&& printf export -eu test --verbose "$1" $(pwd) x=1 2>/dev/null test cd /usr/bin
+		local done printf printf 'quoted text' x=1 --verbose done ${HOME} 2>/dev/null
+"$@" x=1 && cd readonly sed then grep local test "$1" --verbose
+--verbose "$@" | "$@"
+		--verbose echo printf test
+		printf x=1 sed "$1" echo test /usr/bin --verbose 2>/dev/null -eu then
+		2>/dev/null && then echo readonly /usr/bin ${HOME} --verbose $(pwd) "$@"
+	'quoted text' | done printf -eu
+	readonly --verbose --verbose ${HOME} printf 2>/dev/null grep export
+	x=1 sed done x=1 test test | ${HOME} sed
+	/usr/bin --verbose then "$@"
+		export grep | printf --verbose
+	then "$@" done /usr/bin 'quoted text'
+-eu awk 'quoted text'
+	sed -eu | export readonly && 'quoted text' cd ${HOME} --verbose
+	readonly ${HOME} cd readonly x=1 readonly then -eu local
+		x=1 echo sed ${HOME} export -eu export -eu 'quoted text' cd done /usr/bin
+"$1" sed 2>/dev/null cd "$@" $(pwd)
+awk then 2>/dev/null 'quoted text' "$@" --verbose 'quoted text' sed $(pwd) local
+"$@" /usr/bin export local sed sed && x=1 ${HOME} && export /usr/bin
+local --verbose done echo echo
+	x=1 x=1 /usr/bin ${HOME} 2>/dev/null sed /usr/bin x=1 test local ${HOME}
+	$(pwd) /usr/bin && && readonly sed
+printf $(pwd) 'quoted text'
+		printf then then readonly echo $(pwd) then && export
+$(pwd) export done sed x=1 | grep grep x=1 && "$1" "$1" printf "$@"
+		$(pwd) local && grep --verbose grep ${HOME}
+		2>/dev/null | ${HOME} grep grep
+		export $(pwd) grep export done
+		test /usr/bin -eu sed 'quoted text' cd cd then local test --verbose awk $(pwd)
+printf test | --verbose grep $(pwd) local $(pwd) cd test
+	cd local x=1 echo --verbose done --verbose
+	x=1 awk test 2>/dev/null /usr/bin sed ${HOME} 2>/dev/null awk 2>/dev/null done -eu
+		x=1 'quoted text' ${HOME} -eu awk /usr/bin printf done export
+		awk then readonly 2>/dev/null 2>/dev/null $(pwd) grep local 2>/dev/null
+x=1 /usr/bin readonly echo export
+	${HOME} $(pwd) then x=1 cd readonly
+		$(pwd) readonly awk 2>/dev/null "$@" x=1 | 2>/dev/null done
+	sed done x=1 /usr/bin "$@" then cd ${HOME} grep readonly test awk local 'quoted text'
+	2>/dev/null 'quoted text' --verbose | test printf local ${HOME}
+done echo local grep "$@" "$1" | x=1 awk test | local "$@" readonly
+&& 'quoted text' then readonly
+	-eu --verbose then --verbose &&
+	"$1" cd done export echo 'quoted text' cd "$@" export then 2>/dev/null --verbose
+		"$@" 2>/dev/null done |
+		"$@" echo /usr/bin 2>/dev/null | grep test ${HOME}
+		sed 'quoted text' -eu "$@" 2>/dev/null then "$@" --verbose
+		cd test test done 2>/dev/null export then
+	done --verbose then printf sed | done ${HOME} 'quoted text'
+	grep done "$1" ${HOME} printf $(pwd) "$@" grep $(pwd) ${HOME} awk -eu awk "$@" echo
+		-eu --verbose cd done /usr/bin readonly | && export ${HOME} test
+		then 'quoted text' | awk | -eu cd ${HOME} 2>/dev/null
+		&& test cd | "$@" sed local 2>/dev/null -eu then local echo
+$(pwd) x=1 'quoted text' | grep then 'quoted text'
+'quoted text' "$1" $(pwd) echo awk | readonly test readonly
+	"$@" printf x=1 "$1" 2>/dev/null 'quoted text' ${HOME} done /usr/bin
+'quoted text' cd readonly "$@" /usr/bin
+local export 'quoted text' echo $(pwd)
+test /usr/bin then then "$@" --verbose 'quoted text' "$1"
+		-eu 'quoted text' awk 'quoted text'
+'quoted text' --verbose
+	grep --verbose done $(pwd) done "$@" done
+local grep cd echo done ${HOME} printf done done
+	"$@" sed "$1" 'quoted text' -eu awk printf && -eu echo printf
+		--verbose 'quoted text' $(pwd) --verbose ${HOME}
+		printf local printf export
+/usr/bin sed x=1 then awk --verbose then echo x=1 $(pwd) awk
+	"$@" --verbose --verbose x=1 printf
+--verbose awk grep 2>/dev/null --verbose
+	cd --verbose awk 'quoted text' --verbose -eu
+&& "$@" -eu test "$1" then x=1 sed | test grep "$@" echo --verbose
+		2>/dev/null --verbose awk "$@"
+		printf export cd export sed then x=1 | ${HOME}
+echo test then && $(pwd) done local 'quoted text' cd printf ${HOME} "$@" 2>/dev/null
+--verbose grep cd done awk export | && /usr/bin awk 'quoted text' 2>/dev/null
+"$1" ${HOME} --verbose grep && && then ${HOME} | -eu "$1" done ${HOME} done
+		cd /usr/bin test -eu | --verbose echo printf local "$@"
+	${HOME} | --verbose local awk awk grep ${HOME} x=1 export grep 2>/dev/null
+		| done ${HOME} awk ${HOME}
+| printf export readonly -eu && printf --verbose cd 'quoted text' ${HOME} /usr/bin
+	"$@" then "$1" then cd --verbose x=1 readonly
+		--verbose "$1" ${HOME} /usr/bin 'quoted text' | /usr/bin "$@" &&
+done sed readonly awk ${HOME} done /usr/bin
+'quoted text' "$@" grep export 2>/dev/null then grep 2>/dev/null
+"$@" x=1 /usr/bin 'quoted text' ${HOME} "$1" | echo test then awk cd "$1" |
+	2>/dev/null 'quoted text' echo --verbose $(pwd) sed local
+	done /usr/bin ${HOME} cd
+echo | x=1 export -eu x=1 printf echo ${HOME}
+		-eu export | local printf export readonly done then "$1" x=1 2>/dev/null
+		cd 2>/dev/null readonly /usr/bin
+&& /usr/bin printf echo local && ${HOME} readonly done |
+		test && local "$@" local readonly ${HOME} ${HOME} -eu sed sed
+		2>/dev/null x=1 /usr/bin && cd ${HOME} readonly done -eu | $(pwd) ${HOME} -eu
+		/usr/bin grep ${HOME} printf readonly local --verbose test && $(pwd) awk
+		/usr/bin sed && -eu readonly x=1 printf cd "$@" done
+done test echo test done
+export -eu -eu done --verbose
+export 2>/dev/null -eu local
+'quoted text' test grep cd then 2>/dev/null "$1" --verbose "$1" done
+		awk && printf awk awk
+	-eu | cd done then ${HOME} grep ${HOME}
+&& $(pwd) | readonly readonly --verbose -eu -eu echo echo /usr/bin
+		&& cd cd /usr/bin "$1" | echo ${HOME}
+		test readonly printf | x=1 "$1"
+		then grep $(pwd) | sed && | /usr/bin ${HOME} | x=1 "$1" export
+		"$@" then $(pwd) sed
+awk then test x=1 cd echo grep printf 2>/dev/null echo 2>/dev/null
+test | ${HOME} x=1 | --verbose
+&& test --verbose then -eu "$@" 2>/dev/null ${HOME} cd x=1
+"$@" then "$@" sed echo readonly grep cd ${HOME} echo echo "$1" x=1
+/usr/bin sed test ${HOME} export
+		export "$1" grep "$1" local grep --verbose x=1 2>/dev/null
+	then "$@" | then printf
+		echo local then && && "$@" echo 2>/dev/null --verbose printf awk
+		${HOME} echo test export
+then awk cd "$@" local "$1" /usr/bin awk
+--verbose readonly /usr/bin cd "$1" cd readonly "$@" cd
+		"$1" cd test --verbose sed /usr/bin x=1 && export 2>/dev/null then then grep
+echo then grep && $(pwd) "$1" x=1 printf | 'quoted text'
+		x=1 export cd 'quoted text' ${HOME} sed echo
+		done "$1" printf 2>/dev/null 2>/dev/null done awk test test cd x=1 echo --verbose
+local grep local x=1 awk "$1" ${HOME} 'quoted text' 2>/dev/null
+		| export echo $(pwd)
+	/usr/bin ${HOME} "$1" done | then x=1 sed printf local local readonly
+	${HOME} cd test | readonly
+	awk printf 2>/dev/null local grep x=1 then 2>/dev/null readonly
+	&& | && x=1 $(pwd) 'quoted text'
+		-eu test export printf | --verbose
+		"$@" export cd --verbose awk $(pwd) && echo ${HOME} done export local readonly |
+		local 2>/dev/null $(pwd) ${HOME}
+	2>/dev/null /usr/bin export "$1" -eu 2>/dev/null && then | $(pwd) 2>/dev/null
+	--verbose test "$1" sed x=1 printf "$@" x=1 -eu sed ${HOME} export
+done readonly test -eu
+	test "$1" test "$@" awk sed 'quoted text' export awk 'quoted text'
+"$@" grep ${HOME} -eu test grep 'quoted text' | sed
+readonly | then echo "$@" readonly test
+		--verbose sed $(pwd) x=1
+--verbose test cd x=1 then | readonly printf echo grep x=1 test
+-eu export $(pwd) ${HOME} -eu /usr/bin cd x=1
+done cd && sed "$1" && awk printf "$1" &&
+then /usr/bin grep test && done export 'quoted text' && "$@"
+then test ${HOME} && && done -eu /usr/bin
+		| grep -eu -eu 2>/dev/null --verbose |
+		&& printf export --verbose 2>/dev/null
+	readonly "$1" "$@" grep "$@" export
+		export grep readonly done done local echo --verbose --verbose ${HOME}
+	/usr/bin cd echo -eu && x=1 --verbose --verbose done readonly cd test sed test
+		-eu $(pwd) then --verbose local --verbose $(pwd) 'quoted text' export
+2>/dev/null /usr/bin x=1 x=1 cd $(pwd) export $(pwd)
+	"$1" local ${HOME} grep then --verbose && done -eu -eu 'quoted text' -eu --verbose
+		"$1" -eu && /usr/bin && printf && export | "$@" &&
+		2>/dev/null -eu | 'quoted text'
+2>/dev/null export ${HOME} "$@" grep local awk ${HOME} local
+test done "$1" 2>/dev/null "$1"
+	readonly printf --verbose echo
+x=1 sed ${HOME} readonly grep && done export
+local echo ${HOME} "$@" $(pwd) "$@" | $(pwd) test "$@" 2>/dev/null
+then /usr/bin --verbose then ${HOME} | export /usr/bin -eu -eu then printf
+	done "$1" ${HOME} cd local
+	&& $(pwd) "$1" ${HOME} ${HOME} /usr/bin "$@" test /usr/bin /usr/bin ${HOME} x=1
+		sed cd $(pwd) x=1 sed $(pwd) ${HOME} cd && test done echo 'quoted text' $(pwd)
+		done x=1 /usr/bin "$1" "$1" export local
+	"$1" sed x=1 awk local sed
+/usr/bin && sed "$@" then grep "$@" $(pwd) && done $(pwd) ${HOME} | && then
+	--verbose $(pwd) sed --verbose 'quoted text'
+		sed /usr/bin done cd 2>/dev/null | cd /usr/bin
+grep then then test awk "$@" export cd "$@" --verbose
+	printf test "$1" then test printf -eu test cd "$1" 'quoted text' echo
+		done $(pwd) 'quoted text' --verbose grep awk grep "$1" /usr/bin cd
+		${HOME} "$@" -eu 2>/dev/null -eu -eu echo test then "$1"
+x=1 grep /usr/bin && "$@" export cd printf grep test
+cd local printf cd ${HOME} /usr/bin test 2>/dev/null cd test 2>/dev/null
+awk local cd -eu | --verbose local /usr/bin "$@" printf --verbose $(pwd)
+-eu && /usr/bin && --verbose "$1" sed | --verbose x=1 local && && awk
+		readonly -eu cd done "$@"
+		"$@" echo grep "$@" local
+		--verbose $(pwd) --verbose "$1" local done done printf then && 'quoted text'
+readonly "$1" done echo /usr/bin --verbose -eu local 'quoted text'
+sed "$1" grep local echo awk printf grep --verbose "$@" printf 'quoted text'
+		done done export 'quoted text' printf printf
+'quoted text' test sed "$@" cd $(pwd) && readonly
+		test --verbose 2>/dev/null
+		"$@" | awk --verbose local sed echo
+	$(pwd) /usr/bin sed 2>/dev/null $(pwd) /usr/bin 'quoted text' awk echo export
+	local printf cd --verbose printf then readonly $(pwd) grep /usr/bin readonly echo
+done then | --verbose /usr/bin export 2>/dev/null awk awk grep readonly 'quoted text'
+		local -eu 2>/dev/null awk readonly then printf sed $(pwd) 'quoted text' && "$1"
+	"$1" ${HOME} && | $(pwd) sed
+		x=1 export grep cd readonly
+	local -eu && cd export grep "$1"
+	| cd test /usr/bin -eu local -eu
+2>/dev/null local /usr/bin sed readonly export -eu done --verbose
+		done "$1" --verbose cd "$@" && 2>/dev/null /usr/bin "$1" --verbose
+	2>/dev/null && done x=1 | sed $(pwd) $(pwd) readonly local readonly
+		test 'quoted text' $(pwd) |
+readonly local -eu readonly 2>/dev/null "$1" export x=1 $(pwd) -eu "$@" ${HOME}
+	awk --verbose "$1" readonly cd /usr/bin
+	2>/dev/null done sed && "$@" then test echo then "$@" ${HOME} --verbose
+		sed readonly $(pwd) printf
+	&& test /usr/bin x=1 ${HOME} "$1" "$@" echo
+cd $(pwd) then --verbose readonly cd /usr/bin /usr/bin grep export
+	2>/dev/null printf cd cd printf "$@" 2>/dev/null
+		done 'quoted text' echo | -eu local awk awk sed | grep printf | x=1 echo
+		awk local -eu /usr/bin echo awk cd
+		test test grep $(pwd) echo grep x=1 $(pwd) printf 'quoted text'
+		awk grep 'quoted text' "$@" --verbose -eu 'quoted text' echo
+&& | | --verbose 2>/dev/null done "$1" sed &&
+		"$@" sed echo local then ${HOME} /usr/bin export export -eu cd "$1"
+		grep then grep readonly -eu done /usr/bin test --verbose awk -eu --verbose
+$(pwd) local cd done x=1 2>/dev/null readonly readonly grep
+		x=1 2>/dev/null x=1 $(pwd) "$1" 2>/dev/null "$1" cd && 2>/dev/null
+		printf 'quoted text' local sed /usr/bin "$1" $(pwd) --verbose 'quoted text'
+		echo then export printf 'quoted text' --verbose done readonly /usr/bin
+2>/dev/null echo /usr/bin test ${HOME}
+	| "$@" "$@" grep echo then && readonly grep 2>/dev/null
+		$(pwd) export test cd cd done 'quoted text' /usr/bin
+/usr/bin --verbose done grep readonly 2>/dev/null
+printf "$1" 2>/dev/null cd test && export | test x=1 'quoted text'
+	test then awk -eu then test -eu -eu
+test readonly done ${HOME} echo x=1 local echo /usr/bin /usr/bin "$@" grep 2>/dev/null
+	sed 2>/dev/null x=1 -eu local $(pwd) local grep awk
+then /usr/bin cd export done
+2>/dev/null sed "$1" done | grep "$1" /usr/bin $(pwd) | cd &&
+		test /usr/bin 2>/dev/null readonly then "$@" 'quoted text'
+	printf && -eu 'quoted text' 2>/dev/null "$@" /usr/bin "$1" | cd /usr/bin
+	'quoted text' | test 2>/dev/null &&
+2>/dev/null echo cd then sed grep printf -eu $(pwd) sed printf test
+	local done awk awk local sed &&
+	2>/dev/null printf -eu awk awk
+		x=1 then 'quoted text' then $(pwd) $(pwd) printf local local --verbose /usr/bin
+		-eu $(pwd) x=1 readonly 'quoted text'
+	printf awk --verbose then echo echo "$1" --verbose --verbose echo | x=1
+	printf "$1" done 'quoted text' done local
+		$(pwd) export 2>/dev/null 2>/dev/null
+	"$@" && done awk 'quoted text' local done 2>/dev/null
+		grep "$@" echo awk | echo cd awk "$@" 'quoted text' 2>/dev/null readonly
+	$(pwd) printf readonly printf done sed ${HOME} readonly ${HOME} /usr/bin
+printf /usr/bin 2>/dev/null "$1" ${HOME} -eu local "$@" --verbose "$@"
+awk ${HOME} then echo --verbose export --verbose sed "$@" -eu 'quoted text'
+	cd sed readonly sed then then
+	$(pwd) done "$1" ${HOME} /usr/bin grep x=1 "$@" 'quoted text'
+| -eu local 2>/dev/null sed $(pwd)
+	local --verbose -eu printf readonly | echo $(pwd) "$@" export grep test "$1" ${HOME}
+		printf 'quoted text' done
+--verbose test | printf then awk done
+		then sed printf then x=1 | | &&
+	echo $(pwd) -eu x=1 echo ${HOME} "$1" "$1" | "$@" export done
+done then local then 'quoted text'
+$(pwd) 2>/dev/null readonly
+local 'quoted text' "$1" ${HOME} 'quoted text'
+${HOME} then printf --verbose && local then x=1 /usr/bin
+		awk | ${HOME} && export echo x=1
+		2>/dev/null done done echo readonly x=1 export cd
+		export ${HOME} grep && test cd $(pwd) ${HOME}
+		test export x=1 | "$1" test export local -eu /usr/bin
+		&& 'quoted text' awk echo local
+		/usr/bin 'quoted text' "$@" then && 'quoted text' $(pwd) printf
+sed "$1" --verbose export then done awk ${HOME} export 2>/dev/null then x=1 'quoted text'
+		then 'quoted text' | /usr/bin
+	"$@" awk then /usr/bin readonly $(pwd) printf /usr/bin test &&
+		| readonly ${HOME} | "$@" awk readonly -eu ${HOME} export test --verbose
+local awk -eu -eu then readonly ${HOME} awk export
+		export printf | "$@" x=1
+		&& $(pwd) $(pwd) "$@" 2>/dev/null -eu grep $(pwd)
+	test --verbose done "$@" cd --verbose sed cd 2>/dev/null
+		"$1" x=1 ${HOME} | &&
+	printf x=1 | test echo test
+		-eu local test 2>/dev/null --verbose test "$1" -eu done -eu local
+		-eu export $(pwd) 2>/dev/null readonly printf readonly "$1" then
+$(pwd) printf cd test 2>/dev/null "$@"
+		$(pwd) $(pwd) grep awk export printf 'quoted text'
+		cd sed 'quoted text' test then echo "$@" awk export
+	| echo test test sed 'quoted text' 'quoted text'
+export ${HOME} 'quoted text' -eu --verbose done echo 'quoted text'
+	done awk done printf --verbose sed
+-eu awk printf grep awk printf local "$1" awk printf echo local awk --verbose
+2>/dev/null then --verbose printf $(pwd) test cd && test echo cd | /usr/bin
+	done local x=1 | test done x=1 'quoted text'
+	"$@" cd then test && sed x=1 printf 'quoted text'
+done sed grep readonly -eu $(pwd) readonly printf
+grep grep printf then echo "$1" awk x=1 readonly "$1" local export --verbose
+		"$@" 'quoted text' sed ${HOME} echo grep -eu "$1" ${HOME}
+		-eu ${HOME} x=1 -eu then done export "$@" && done grep
+${HOME} grep "$@" then printf local --verbose done
+	&& ${HOME} cd readonly local $(pwd) printf printf --verbose then done awk
+"$1" -eu sed && 2>/dev/null done cd printf awk readonly echo && | sed echo then
+		then cd local local /usr/bin then | $(pwd)
+export --verbose then sed grep done test echo
+		cd ${HOME} ${HOME} ${HOME} export
+| "$1" /usr/bin cd printf test $(pwd) && /usr/bin
+	test readonly $(pwd) test /usr/bin printf 2>/dev/null
+		local sed done && echo awk -eu "$1" echo local done done cd "$@" cd 'quoted text'
+	sed "$@" export ${HOME} /usr/bin grep && grep /usr/bin
+&& 'quoted text' $(pwd) --verbose
+	"$@" -eu /usr/bin 'quoted text'
+grep cd grep -eu $(pwd)
+		x=1 local local awk ${HOME} -eu sed ${HOME} test "$1" | cd done then awk
+		2>/dev/null /usr/bin echo $(pwd) awk 'quoted text' $(pwd) &&
+		grep echo && echo grep awk x=1 --verbose cd grep awk x=1 ${HOME} $(pwd)
+	printf -eu awk cd 2>/dev/null
+	sed export --verbose -eu
+'quoted text' grep awk echo "$@" awk echo "$1"
+	&& $(pwd) cd done test export echo test /usr/bin
+		local $(pwd) $(pwd) -eu then $(pwd) test --verbose local echo
+		echo then | cd test export echo echo $(pwd) 'quoted text' readonly ${HOME}
+	/usr/bin then "$1" "$@" then "$1" awk printf ${HOME} export -eu cd -eu && awk
+x=1 echo done readonly 'quoted text' && --verbose x=1 then done $(pwd)
+	"$@" x=1 x=1 x=1 export done ${HOME} 2>/dev/null
+	| | printf && readonly cd cd $(pwd) export sed echo test 'quoted text' printf
+		export && x=1 --verbose ${HOME} awk -eu $(pwd) x=1 awk x=1 cd
+		awk -eu done grep sed $(pwd) /usr/bin then done awk $(pwd) cd export
+		export printf local | /usr/bin done $(pwd) "$@" sed printf $(pwd) awk --verbose
+${HOME} "$1" then readonly then cd export local
+export echo x=1 x=1 export test --verbose test done readonly | grep "$1" test 'quoted text'
+		'quoted text' cd --verbose
+	| x=1 sed grep test then export "$1" 2>/dev/null awk x=1 echo
+	/usr/bin readonly x=1 "$1" then echo grep && 'quoted text'
+	/usr/bin "$1" ${HOME} /usr/bin then export local $(pwd) /usr/bin printf
+	2>/dev/null done 2>/dev/null cd grep && "$@" export "$@" x=1
+		"$1" done grep ${HOME} done /usr/bin 'quoted text'
+		cd sed $(pwd) /usr/bin --verbose done 2>/dev/null
+	printf printf x=1 readonly "$1" then && awk ${HOME} -eu && echo
+/usr/bin cd --verbose readonly /usr/bin local 2>/dev/null sed
+	"$1" done local x=1 echo | done export local export "$1" /usr/bin
+echo /usr/bin echo echo done
+| grep printf readonly /usr/bin then "$@" export $(pwd) --verbose "$@" "$@" sed
+	2>/dev/null | awk -eu ${HOME} test sed "$1" test done
+$(pwd) "$1" readonly && | -eu -eu $(pwd) -eu local |
+		done sed ${HOME} export readonly "$@" ${HOME} ${HOME} --verbose x=1
+2>/dev/null test cd && grep done ${HOME} test 2>/dev/null printf
+	/usr/bin export printf readonly /usr/bin awk && sed printf && x=1 awk printf
+		"$1" cd sed test export test | cd "$@" cd sed sed
+'quoted text' echo done test ${HOME} cd $(pwd) -eu sed "$@" done awk "$@"
+		-eu -eu 2>/dev/null grep then "$@" -eu then sed "$1" test test && /usr/bin ${HOME}
+2>/dev/null /usr/bin sed -eu && "$1" -eu echo 2>/dev/null "$@" sed echo readonly
+		| 'quoted text' grep x=1 && 2>/dev/null test awk "$@" test
+	'quoted text' cd ${HOME} local
+	"$@" "$1" 'quoted text' --verbose
+	echo --verbose /usr/bin
+	echo then done "$1" && printf sed 2>/dev/null
+	-eu x=1 readonly x=1 then export sed && | local local "$@" awk
+	printf awk local then echo test $(pwd) x=1 x=1 test $(pwd) done
+		x=1 'quoted text' then printf && ${HOME} ${HOME} done grep done printf test
+-eu ${HOME} export | "$1" $(pwd) sed readonly
+		then --verbose export sed printf awk grep
+	x=1 && then && test "$@" /usr/bin
+	x=1 readonly test grep /usr/bin
+then awk x=1 done -eu
+awk then ${HOME} then then sed done grep 'quoted text' cd echo then awk done
+		local "$@" echo done | test local /usr/bin && export 2>/dev/null
+	export | export --verbose readonly --verbose && 2>/dev/null
+		"$1" ${HOME} echo grep 2>/dev/null echo 'quoted text' /usr/bin
+	echo && local x=1 && $(pwd) -eu -eu echo
+"$1" /usr/bin && awk local 2>/dev/null
+	printf export echo --verbose export --verbose
+/usr/bin "$@" grep export ${HOME} | x=1 /usr/bin
+done "$1" sed "$@" printf local readonly readonly $(pwd) | done -eu sed | -eu --verbose
+	readonly cd done sed "$1" | x=1 x=1 $(pwd) test test
+	sed 'quoted text' /usr/bin done "$1" printf
+	"$1" printf 'quoted text' awk 2>/dev/null local export x=1
+	done awk sed grep echo $(pwd)
+	--verbose ${HOME} test grep | /usr/bin test | "$1" local | readonly
+		-eu $(pwd) --verbose 'quoted text' "$1" ${HOME} -eu "$1" test done "$@" echo
+		awk sed 'quoted text' | ${HOME} cd -eu grep test $(pwd)
+		done sed 'quoted text' then grep printf
+	--verbose echo ${HOME}
+		readonly test echo sed /usr/bin test "$@" test printf 'quoted text' "$@"
+"$@" x=1 test export && -eu &&
+	grep 2>/dev/null awk local done | $(pwd) echo test x=1 done ${HOME} echo grep
+	test 2>/dev/null -eu cd
+		"$@" /usr/bin printf --verbose "$@" grep 'quoted text' cd test local | 2>/dev/null
+		'quoted text' awk grep sed "$@" echo local export local
+		${HOME} then sed grep then $(pwd) export
+grep cd /usr/bin test then && export sed test --verbose done test
+	'quoted text' 2>/dev/null /usr/bin grep | local
+test "$@" awk export 2>/dev/null
+		--verbose "$@" done /usr/bin 'quoted text' local test --verbose
+"$@" /usr/bin x=1 grep --verbose ${HOME} sed && then
+/usr/bin then | grep test $(pwd) && | 2>/dev/null
+grep done printf -eu --verbose readonly x=1 | ${HOME} x=1 -eu "$@" test printf
+| 'quoted text' /usr/bin 'quoted text'
+	export printf printf export | --verbose readonly test --verbose grep | grep
+	$(pwd) echo $(pwd) 2>/dev/null
+	-eu x=1 | then test export echo awk export
+		sed 2>/dev/null done then test awk && done export readonly done 2>/dev/null
+	${HOME} -eu | then test export then then ${HOME} local grep awk
+		| && local && printf awk cd then export | test $(pwd) printf ${HOME} awk grep
+export printf done echo $(pwd)
+		echo x=1 "$1" printf
+${HOME} printf grep 'quoted text' export "$@" test test sed done sed
+		export --verbose then
+	$(pwd) -eu readonly --verbose $(pwd)
+		export readonly && $(pwd) cd x=1 local test awk | grep /usr/bin
+	-eu done -eu export printf echo && test
+		export | 'quoted text' awk
+	sed test awk $(pwd) then && awk 'quoted text' /usr/bin
+	| 'quoted text' x=1 echo printf 2>/dev/null
+grep /usr/bin --verbose /usr/bin 'quoted text' export 'quoted text' "$1"
+	${HOME} export --verbose "$@" 2>/dev/null
+	done readonly | /usr/bin ${HOME} cd "$@" cd --verbose -eu
+	grep "$1" readonly | echo && ${HOME} echo awk && --verbose --verbose done
+printf -eu awk /usr/bin printf
+| ${HOME} awk awk /usr/bin test done
+		/usr/bin && printf printf $(pwd) awk
+x=1 awk cd readonly ${HOME} export then /usr/bin && echo local
+		x=1 x=1 done x=1 sed "$1" -eu /usr/bin awk 'quoted text' $(pwd) x=1
+		-eu "$@" 2>/dev/null $(pwd) ${HOME} "$1" /usr/bin /usr/bin
+	'quoted text' readonly
+	"$@" 'quoted text' echo
+then ${HOME} awk awk -eu /usr/bin export | "$@" done ${HOME} grep $(pwd)
+		-eu x=1 printf test done printf echo readonly echo sed | sed "$@" 2>/dev/null awk
+${HOME} --verbose /usr/bin $(pwd) sed test 'quoted text' "$1" then test
+$(pwd) 2>/dev/null 2>/dev/null export echo done local
+		printf grep | done -eu echo
+		awk export /usr/bin local then 2>/dev/null then test test
+		awk ${HOME} ${HOME} x=1 echo sed
+	/usr/bin && readonly 'quoted text' awk 'quoted text' "$1" readonly -eu cd 'quoted text'
+	$(pwd) readonly 'quoted text' awk done
+		x=1 local | -eu cd then local x=1 "$@" awk --verbose x=1 readonly
+	echo local then /usr/bin | -eu export 'quoted text' | grep
+		$(pwd) export printf 2>/dev/null
+		x=1 readonly ${HOME} -eu $(pwd) -eu -eu x=1 done x=1 sed grep local && 2>/dev/null
+'quoted text' x=1 | local cd -eu 2>/dev/null
+cd "$1" done /usr/bin cd grep grep then readonly export done sed sed && sed
+		readonly done sed export | echo /usr/bin "$@"
+		/usr/bin | awk ${HOME} sed ${HOME} 'quoted text'
+	"$@" done 2>/dev/null ${HOME}
+	-eu test done $(pwd) 2>/dev/null ${HOME}
+	-eu cd export --verbose /usr/bin local grep "$1" grep /usr/bin
+	sed grep local --verbose export sed test && && sed cd
+	-eu awk ${HOME} echo sed export
+		x=1 grep export "$@" 'quoted text'
+	sed done readonly --verbose echo local local cd /usr/bin $(pwd)
+	| 'quoted text' local /usr/bin
+		"$@" -eu export printf /usr/bin $(pwd) export grep "$@" export | done
+	-eu export sed done --verbose then awk -eu ${HOME} cd cd printf then 'quoted text'
+		x=1 && --verbose local | | ${HOME} | ${HOME} | ${HOME}
+"$@" printf 'quoted text' "$1" -eu grep
+		2>/dev/null 'quoted text'
+		${HOME} awk x=1 "$@" ${HOME} "$1" --verbose $(pwd) ${HOME} -eu sed
+	sed local done && test && -eu | then export ${HOME} -eu 2>/dev/null "$@" readonly
+		sed awk local /usr/bin
+	$(pwd) test local "$1" printf "$1" 'quoted text'
+	awk 'quoted text' echo readonly then sed && /usr/bin export
+	-eu awk cd $(pwd) 'quoted text' x=1 x=1 /usr/bin sed local --verbose ${HOME}
+		x=1 done "$@" export ${HOME} --verbose
+	printf then export --verbose
+	grep readonly --verbose printf cd x=1 cd && "$1" x=1 test readonly
+/usr/bin sed cd | /usr/bin -eu readonly
+"$@" export test export local | $(pwd) sed x=1 sed sed awk done local
+	"$@" cd printf 'quoted text' local --verbose
+"$1" echo x=1 && sed readonly
+	printf "$@" $(pwd) sed "$1" local sed
+		then cd grep printf readonly cd "$1" grep x=1 --verbose $(pwd) "$@" x=1 -eu
+		'quoted text' "$1" /usr/bin "$1" && --verbose "$@" 'quoted text'
+		${HOME} cd then grep --verbose readonly 'quoted text' 2>/dev/null readonly /usr/bin
+		--verbose echo "$1" && -eu then echo $(pwd)
+sed 2>/dev/null "$1" local printf 2>/dev/null && export
+	$(pwd) readonly "$1" printf "$1" export ${HOME} awk ${HOME} then | printf printf
+		/usr/bin /usr/bin done && ${HOME} 2>/dev/null then 2>/dev/null x=1 $(pwd)
+		$(pwd) -eu x=1 cd "$1" then --verbose then done local ${HOME} export
+$(pwd) then readonly 2>/dev/null printf $(pwd)
+	${HOME} 2>/dev/null local && readonly && x=1 export test 2>/dev/null
+	${HOME} -eu then && local /usr/bin echo sed printf then local done
+		cd 'quoted text' export /usr/bin done $(pwd) -eu done awk "$@" ${HOME} then "$1"
+local test cd $(pwd) 'quoted text' /usr/bin 2>/dev/null local cd "$1" then
+local 2>/dev/null "$1" awk | readonly test printf "$@" ${HOME} printf
+		then local cd local x=1 local --verbose cd readonly ${HOME} $(pwd)
+	awk sed "$@" local export done echo 'quoted text' x=1 "$@" cd /usr/bin export
+	2>/dev/null "$@" "$@" 'quoted text' x=1 echo ${HOME} "$@"
+	echo awk $(pwd) && "$@" /usr/bin readonly test $(pwd) $(pwd) sed && --verbose grep
+		x=1 $(pwd) cd 'quoted text' /usr/bin test sed readonly awk x=1
+	export /usr/bin ${HOME}
+		then awk grep "$1" "$1" $(pwd) local test ${HOME}
+		x=1 $(pwd) awk awk $(pwd) then cd done | ${HOME} 'quoted text'
+	"$1" "$1" "$1" "$1" $(pwd) -eu && then "$1" 'quoted text'
+echo $(pwd) grep local done test 2>/dev/null
+	echo local $(pwd) grep && -eu echo
+| local | && local && "$1" "$@" then && && | 2>/dev/null
+		$(pwd) sed sed x=1 | done ${HOME} x=1 test -eu then "$1" export
+	export grep ${HOME} then --verbose "$1" export
+	echo -eu 'quoted text' ${HOME} ${HOME} printf sed
+	then sed echo ${HOME} readonly export -eu 'quoted text'
+x=1 /usr/bin && ${HOME} --verbose /usr/bin "$1" local $(pwd) &&
+-eu /usr/bin "$1" grep local ${HOME} awk x=1
+		sed echo ${HOME} | sed done printf test 2>/dev/null grep
+		-eu 'quoted text' 2>/dev/null printf --verbose then sed printf
+		export awk readonly local "$@" done ${HOME} local grep &&
+	grep | awk "$1" && readonly
+echo --verbose export ${HOME} 'quoted text'
+		sed /usr/bin -eu 2>/dev/null awk
+	x=1 printf --verbose grep "$@"
+	echo "$@" local sed | sed /usr/bin cd "$@"
+	sed | 'quoted text' 2>/dev/null cd readonly
+--verbose cd test cd then readonly export printf --verbose
+		awk 2>/dev/null readonly "$1" readonly cd grep /usr/bin export
+	readonly | then echo |
+"$@" /usr/bin -eu && "$@" cd 'quoted text' grep done /usr/bin
+		"$@" "$@" x=1 "$@" printf "$@" x=1 'quoted text' /usr/bin test ${HOME}
+-eu echo | test cd then ${HOME} cd then 2>/dev/null ${HOME}
+--verbose --verbose -eu export cd --verbose "$@"
+	test export "$1" --verbose 2>/dev/null export $(pwd) /usr/bin readonly
+	export export echo grep 'quoted text' test local
+	readonly local && | sed test grep x=1 done 2>/dev/null
+	then cd echo grep test --verbose
+		local "$1" readonly done
+2>/dev/null x=1 $(pwd) echo readonly 2>/dev/null done then done sed sed 'quoted text'
+	printf test --verbose 'quoted text' cd --verbose readonly x=1 readonly "$1" grep
+		2>/dev/null --verbose
+		2>/dev/null printf test then $(pwd) export
+	printf awk echo && awk grep | /usr/bin done readonly
+export echo "$1" grep printf /usr/bin "$@" | sed ${HOME} test awk /usr/bin "$@"
+		awk "$1" 'quoted text'
+	test 2>/dev/null -eu readonly then done echo then
+	'quoted text' /usr/bin test awk
+		test /usr/bin $(pwd) local printf | --verbose -eu --verbose "$@" && "$@" "$@"
+grep -eu --verbose then
+		"$@" /usr/bin x=1 | done readonly done "$1" | x=1 ${HOME}
+	"$1" && awk | readonly done readonly "$1" then
+	local sed cd 'quoted text' sed | "$@" awk "$1" local ${HOME} | awk then echo
+	printf ${HOME} cd then && readonly awk 'quoted text'
+	${HOME} awk echo cd done done /usr/bin printf 2>/dev/null && then export
+		| test --verbose ${HOME} /usr/bin export
+then -eu echo cd cd 2>/dev/null
+		--verbose local test echo -eu 'quoted text'
+	x=1 then x=1 "$1" test readonly | | x=1 then echo test done --verbose
+test grep done "$@" export | | -eu grep export x=1 "$1" | 'quoted text'
+		test grep then -eu sed awk then test -eu readonly x=1 --verbose sed x=1 "$1"
+	echo --verbose $(pwd) | export grep readonly local
+	$(pwd) printf local 'quoted text' "$1" test
+		test /usr/bin "$1" done -eu /usr/bin then echo && 'quoted text' done
+		local local && --verbose readonly echo --verbose x=1 && /usr/bin
+		| /usr/bin "$1" "$@" && printf 'quoted text' then /usr/bin
+	echo test sed echo --verbose cd local "$@" then | | "$1" && readonly
+		export "$@" readonly test
+	printf test cd $(pwd) sed | && && grep done export
+/usr/bin --verbose 2>/dev/null
+	grep | printf test 'quoted text'
+	awk x=1 grep readonly 'quoted text' test "$1" echo echo done echo ${HOME} /usr/bin
+test x=1 printf $(pwd) sed /usr/bin "$1"
+done /usr/bin ${HOME} export echo 'quoted text' "$1" grep sed
+	then echo "$@" printf local then /usr/bin sed test export done x=1 local grep
+	cd then --verbose | local -eu test
+		| -eu done 2>/dev/null && sed grep "$1"
+	awk && 'quoted text' test sed x=1 && cd $(pwd) test printf readonly | ${HOME} echo
+&& && test | sed --verbose "$1" local then -eu grep awk awk local sed
+		printf done awk --verbose then x=1 x=1 /usr/bin ${HOME} "$1" awk then then
+	/usr/bin awk "$@" echo | 2>/dev/null /usr/bin "$1" sed "$1"
+		&& | readonly ${HOME} "$1" cd && sed x=1 cd
+		done sed | 'quoted text' test "$1" cd 2>/dev/null
+awk --verbose ${HOME} done --verbose "$1" awk readonly test awk -eu
+		test 2>/dev/null done -eu "$1" cd export export -eu -eu -eu "$1" && "$@" done
+		test /usr/bin $(pwd) readonly echo x=1 ${HOME} then | grep cd
+		"$@" echo done readonly /usr/bin
+export echo grep echo echo then readonly
+	sed cd $(pwd) "$@" local readonly echo grep readonly
+		| done ${HOME} $(pwd) ${HOME}
+	"$1" ${HOME} echo 2>/dev/null x=1 ${HOME}
+&& ${HOME} --verbose cd grep echo
+awk printf echo && sed ${HOME} sed "$@" "$1" awk "$1" ${HOME}
+		grep sed grep ${HOME} readonly | /usr/bin export test readonly
+readonly | $(pwd) 'quoted text' then
+export "$1" 'quoted text' printf grep
+'quoted text' $(pwd) readonly
+		export x=1 grep cd cd grep then "$@" "$1" readonly
+	--verbose ${HOME} cd /usr/bin x=1 then && readonly -eu
+then grep | ${HOME} sed | readonly cd
+	grep cd "$@" -eu 2>/dev/null | 'quoted text' local | test | printf
+&& awk x=1 && test "$1"
+local 2>/dev/null done cd -eu 'quoted text' --verbose &&
+		$(pwd) --verbose "$1" 'quoted text' 2>/dev/null
+	export && "$@" $(pwd) -eu export /usr/bin -eu printf /usr/bin readonly
+${HOME} awk && | && done "$@" -eu "$1" 'quoted text' | export grep $(pwd)
+	--verbose /usr/bin awk --verbose -eu done
+		2>/dev/null done /usr/bin grep $(pwd) 2>/dev/null sed ${HOME} -eu
+"$@" "$@" then awk && local printf ${HOME} /usr/bin --verbose "$@" readonly grep
+grep | x=1 'quoted text' cd ${HOME} $(pwd) sed
+| awk "$@" local 'quoted text'
+	sed printf grep 'quoted text' cd grep echo $(pwd)
+	&& -eu "$@" && --verbose && done
+	&& $(pwd) done | $(pwd) awk
+	${HOME} test test 2>/dev/null ${HOME} "$1" test echo local -eu 2>/dev/null
+		2>/dev/null cd && readonly printf ${HOME}
+| printf cd local echo ${HOME} grep &&
+		&& awk "$@" ${HOME} readonly
+		then echo /usr/bin local done $(pwd) grep --verbose 2>/dev/null
+	printf sed local readonly | awk | 2>/dev/null && | cd then cd done cd x=1 done
+	local && /usr/bin -eu cd
+		--verbose "$@" printf test x=1 && then --verbose export && export
+		"$1" -eu sed -eu --verbose done --verbose printf test --verbose
+	"$1" awk 2>/dev/null "$1" then 2>/dev/null
+	--verbose export then awk printf sed awk 'quoted text' local
+done cd --verbose 2>/dev/null "$@" test then -eu && cd ${HOME}
+${HOME} done /usr/bin then /usr/bin readonly "$1" -eu cd
+/usr/bin $(pwd) 2>/dev/null done printf printf && grep
+		local printf readonly sed local ${HOME} grep sed -eu awk
+"$@" 'quoted text' then "$@" "$@"
+local "$@" ${HOME} done /usr/bin cd x=1 "$1"
+		${HOME} 'quoted text' readonly test ${HOME} $(pwd)
+x=1 -eu 'quoted text' /usr/bin sed test echo /usr/bin /usr/bin
+sed then "$@" sed ${HOME} x=1 done
+		local x=1 echo --verbose "$@" then cd done "$@" cd then "$@" echo
+	done readonly awk "$1" then printf export sed grep
+	then done /usr/bin | /usr/bin grep && | awk
+		test 'quoted text' | 'quoted text' x=1 echo sed x=1 $(pwd) cd
+	"$@" export sed readonly then "$1"
+'quoted text' cd then -eu 2>/dev/null
+		readonly | then 2>/dev/null "$@" "$1" export
+		"$1" --verbose export 'quoted text' export x=1 then
+		readonly ${HOME} 2>/dev/null --verbose awk "$@" printf &&
+		${HOME} test sed /usr/bin x=1
+	-eu done echo echo awk x=1
+		${HOME} sed -eu x=1 awk test then export
+		&& ${HOME} --verbose echo
+	export echo awk printf done test /usr/bin test
+	export /usr/bin $(pwd) ${HOME} then 'quoted text' grep ${HOME} --verbose
+cd && 2>/dev/null test -eu x=1 /usr/bin 2>/dev/null 'quoted text' done
+		--verbose 'quoted text' grep grep then printf $(pwd) | readonly
+-eu printf sed readonly
+		'quoted text' export cd | 'quoted text' awk
+		-eu "$@" $(pwd) done readonly
+		&& ${HOME} /usr/bin test export printf awk sed 'quoted text' awk printf -eu
+"$@" ${HOME} echo readonly $(pwd) x=1 sed awk 2>/dev/null awk --verbose
+		${HOME} local then 'quoted text' done -eu $(pwd) echo awk | 2>/dev/null
+${HOME} then ${HOME} x=1 /usr/bin --verbose export
+/usr/bin sed /usr/bin 'quoted text' && 2>/dev/null echo then sed 'quoted text'
+	sed 'quoted text' -eu --verbose sed -eu then "$@" test "$@" readonly $(pwd)
+		done "$@" ${HOME} then "$1" && /usr/bin 2>/dev/null echo printf ${HOME}
+	grep --verbose | readonly -eu | readonly sed sed
+then 2>/dev/null readonly --verbose 'quoted text' ${HOME} "$@" $(pwd) local
+		test -eu local "$1" -eu test -eu grep cd done x=1 --verbose /usr/bin -eu 2>/dev/null
+	--verbose test 2>/dev/null then | local grep sed /usr/bin
+		x=1 then sed "$1" printf ${HOME}
+		test --verbose cd local 'quoted text' cd export then cd /usr/bin export 'quoted text'
+		cd ${HOME} local --verbose cd test -eu echo grep sed 'quoted text' test --verbose
+		"$1" && | x=1 cd readonly && 2>/dev/null
+| -eu local sed export test sed grep --verbose sed 'quoted text' 2>/dev/null
+	export grep ${HOME} -eu 2>/dev/null cd 2>/dev/null export
+	"$@" 'quoted text' sed export && cd readonly --verbose local 2>/dev/null
+grep export local test awk
+		sed local && -eu && | ${HOME} $(pwd) && awk export -eu
+${HOME} then echo export cd local | x=1 export
+	local -eu x=1 $(pwd) "$1" sed readonly cd readonly -eu 2>/dev/null printf
+		cd local readonly readonly
+2>/dev/null --verbose export "$@" export
+	/usr/bin export grep then
+	cd -eu readonly $(pwd) then 2>/dev/null 'quoted text'
+		awk then 2>/dev/null 2>/dev/null "$1" export $(pwd) ${HOME} --verbose 2>/dev/null
+$(pwd) /usr/bin && "$1" 2>/dev/null
+awk --verbose local grep "$@" "$1" then ${HOME}
+	--verbose 2>/dev/null
+		| then echo export -eu /usr/bin sed grep "$@" readonly echo then export "$@" awk
+	echo --verbose sed export
+		&& export echo echo "$1" awk 'quoted text' cd grep 'quoted text' sed
+	2>/dev/null | x=1 -eu cd "$@" /usr/bin --verbose
+	'quoted text' test echo cd readonly test sed readonly export
+cd awk test 2>/dev/null --verbose done | done --verbose ${HOME} "$1"
+done ${HOME} 2>/dev/null "$1" &&
+		"$@" "$@" $(pwd) readonly "$@" | awk "$@" readonly export readonly
+		then echo | 'quoted text' local printf awk readonly "$@"
+sed printf 'quoted text' | $(pwd)
+		-eu printf -eu /usr/bin printf "$1" --verbose -eu --verbose
+		sed /usr/bin /usr/bin readonly local -eu cd awk grep | export --verbose export
+"$1" then sed && echo test echo done ${HOME}
+	local then sed grep ${HOME} export -eu then && 2>/dev/null && && sed ${HOME}
+grep then sed 'quoted text' 'quoted text' readonly done -eu
+2>/dev/null then export sed grep grep sed grep 'quoted text'
+--verbose test $(pwd) cd cd "$1" printf 'quoted text' echo $(pwd) awk echo
+		&& test test printf --verbose awk done "$1" $(pwd) printf echo x=1
+		then echo "$@" | 'quoted text' test $(pwd) /usr/bin $(pwd)
+		/usr/bin echo $(pwd) printf
+x=1 then ${HOME} cd readonly local done echo readonly then grep -eu "$@" printf
+'quoted text' "$1" "$@" export "$1" -eu grep && grep
+grep "$@" export local --verbose then test printf
+		| ${HOME} echo --verbose cd --verbose readonly "$1" export echo
+awk --verbose -eu done then ${HOME} | local export --verbose
+		$(pwd) $(pwd) export ${HOME} readonly | --verbose
+		/usr/bin | sed awk done | cd
+export sed test /usr/bin &&
+-eu 'quoted text' export grep -eu && export
+&& ${HOME} awk local test && && sed local -eu /usr/bin
+/usr/bin grep test "$@" test
+	local printf test "$1" then sed
+awk cd 2>/dev/null awk local export
+	$(pwd) readonly echo ${HOME} ${HOME} /usr/bin done | --verbose && | | $(pwd)
+	&& sed export echo grep local test 'quoted text' export test cd /usr/bin 'quoted text'
+cd 2>/dev/null "$@" awk "$1"
+x=1 --verbose -eu -eu printf then
+	2>/dev/null x=1 $(pwd)
+	/usr/bin done 2>/dev/null test cd
+sed -eu | echo done --verbose /usr/bin x=1 test
+		-eu "$1" "$@" -eu && then && 'quoted text' 'quoted text' --verbose
+	awk | ${HOME} 'quoted text' ${HOME} done
+	${HOME} "$@" 2>/dev/null --verbose $(pwd) test x=1 echo && grep local sed --verbose
+'quoted text' | echo awk echo readonly grep awk
+export --verbose 'quoted text'
+	grep awk ${HOME} echo sed echo --verbose
+| echo then export 2>/dev/null test
+$(pwd) local $(pwd) x=1 export && sed echo 'quoted text' $(pwd) x=1 $(pwd)
+		readonly grep grep grep 2>/dev/null $(pwd) done cd cd --verbose | && --verbose
+	"$1" test export grep /usr/bin export ${HOME} 2>/dev/null $(pwd) | $(pwd)
+'quoted text' done $(pwd) /usr/bin test
+	done local echo done 'quoted text' echo then /usr/bin grep export
+--verbose -eu -eu local x=1 readonly
+	cd export export grep cd 'quoted text' x=1 2>/dev/null
+	done echo | sed -eu x=1 test
+	x=1 echo /usr/bin $(pwd) local done test readonly test sed "$@" $(pwd)
+/usr/bin awk -eu --verbose "$@"
+	test awk export export awk done test printf echo awk sed printf
+-eu | -eu readonly 2>/dev/null "$@"
+		test --verbose && printf "$@" then grep $(pwd)
+local grep ${HOME} "$@" readonly | --verbose -eu --verbose
+		cd "$@" "$@" 'quoted text' /usr/bin 'quoted text' 2>/dev/null readonly awk
+	"$1" ${HOME} export echo && | $(pwd)
+'quoted text' "$1" x=1 local 'quoted text'
+x=1 $(pwd) 2>/dev/null --verbose test
+cd sed x=1 then "$1" grep "$1" cd
+done echo "$@" done test 2>/dev/null && export readonly grep echo
+	| cd && | /usr/bin --verbose local cd
+local 2>/dev/null grep /usr/bin awk --verbose 2>/dev/null sed ${HOME} then 'quoted text'
+		${HOME} && cd /usr/bin 'quoted text' echo done local "$1" --verbose then -eu
+test 2>/dev/null cd cd ${HOME} grep 2>/dev/null sed awk $(pwd) printf printf
+-eu local /usr/bin echo
+done --verbose | export x=1 cd readonly "$1" test -eu --verbose cd
+2>/dev/null done awk awk grep test readonly export cd $(pwd) "$1" export ${HOME}
+awk echo $(pwd) --verbose
+		/usr/bin "$@" /usr/bin test "$@" 2>/dev/null
+awk export $(pwd) test awk done done printf ${HOME} /usr/bin
+printf ${HOME} grep && "$@" local test 2>/dev/null printf then /usr/bin $(pwd)
+		"$@" x=1 && readonly ${HOME}
+	${HOME} --verbose readonly 'quoted text'
+x=1 printf "$@" 'quoted text'
+readonly printf 2>/dev/null
+		then export /usr/bin grep local
+		2>/dev/null 'quoted text' "$@" echo awk awk $(pwd) -eu && -eu sed ${HOME}
+		/usr/bin awk done test printf 2>/dev/null x=1 --verbose
+2>/dev/null ${HOME} x=1 $(pwd) -eu export
+"$@" local "$@" 'quoted text' x=1 done --verbose then then | "$1" "$1" then sed
+		"$@" && echo /usr/bin /usr/bin $(pwd) &&
+		echo 2>/dev/null printf printf grep /usr/bin
+readonly readonly local test ${HOME} printf && readonly done
+		$(pwd) x=1 'quoted text' && awk | "$@" grep 'quoted text' 'quoted text' -eu "$1"
+	cd awk 2>/dev/null printf $(pwd) | local awk | grep
+		awk cd "$1" /usr/bin 2>/dev/null --verbose /usr/bin
+		'quoted text' awk then then x=1 then then sed local && /usr/bin
+echo printf sed /usr/bin x=1 "$1" awk
+		/usr/bin readonly sed done 'quoted text' sed 2>/dev/null sed ${HOME} local && export
+		local sed -eu printf "$1" sed then sed 'quoted text' then && -eu x=1 grep
+grep echo then $(pwd) 2>/dev/null | x=1 --verbose --verbose printf
+-eu "$1" ${HOME} 'quoted text' printf readonly x=1 && echo readonly local awk sed
+	/usr/bin 'quoted text' awk /usr/bin grep cd 'quoted text' x=1 grep $(pwd)
+		awk | 'quoted text' x=1 echo awk -eu export grep "$1"
+	awk 'quoted text' awk x=1
+'quoted text' local -eu awk --verbose done echo -eu awk done
+		/usr/bin 'quoted text' cd 2>/dev/null | 2>/dev/null
+	"$@" /usr/bin --verbose x=1 cd test 'quoted text' readonly x=1 'quoted text'
+$(pwd) test readonly cd && --verbose $(pwd)
+&& local echo --verbose | 'quoted text' 'quoted text' --verbose --verbose
+then test x=1 awk 'quoted text'
+"$@" 'quoted text' local x=1 local echo cd awk ${HOME} local export
+		| "$1" 2>/dev/null done test cd x=1
+-eu local --verbose -eu $(pwd) $(pwd) done grep test then
+		readonly echo cd && "$1" --verbose sed --verbose cd | --verbose cd --verbose ${HOME}
+		${HOME} "$1" x=1 ${HOME} readonly test --verbose
+	then | grep readonly "$@" done echo grep "$@" then printf
+		done && "$1" "$1" done $(pwd) done
+export "$1" cd test x=1 test $(pwd) | awk grep then 'quoted text'
+| $(pwd) test "$@" cd printf --verbose test
+		awk /usr/bin readonly sed echo $(pwd) --verbose
+	"$1" printf -eu -eu test awk 2>/dev/null
+grep awk "$@" sed grep done
+test then 2>/dev/null grep then ${HOME} done && echo echo ${HOME} "$1"
+	&& sed awk --verbose echo x=1 x=1 export ${HOME} done /usr/bin
+2>/dev/null readonly printf $(pwd) -eu 2>/dev/null printf sed echo
+grep grep grep 'quoted text' --verbose x=1 readonly test awk
+sed ${HOME} echo done awk
+	awk local echo | local done "$@" printf --verbose echo sed printf
+		/usr/bin export export echo done grep "$@" -eu echo echo
+'quoted text' --verbose -eu "$@" "$@" | local grep awk
+echo test local "$@" -eu readonly
+	'quoted text' printf /usr/bin
+		x=1 "$1" $(pwd) "$1" /usr/bin && printf && ${HOME} awk
+		then test cd | awk | done echo cd --verbose done --verbose
+	--verbose local 'quoted text' | awk done ${HOME}
+test $(pwd) x=1 x=1 printf
+/usr/bin "$@" "$1" grep cd export && && 2>/dev/null
+		"$1" 'quoted text' | ${HOME} $(pwd) x=1 cd "$@" printf printf
+x=1 printf readonly "$1" echo --verbose echo done --verbose
+		${HOME} && /usr/bin -eu 2>/dev/null
+	cd /usr/bin 2>/dev/null readonly sed "$1" $(pwd) awk then
+		-eu printf then awk "$@" grep && ${HOME} "$1" ${HOME}
+		export readonly printf printf $(pwd) local then
+then readonly cd $(pwd) grep done test grep printf awk awk 2>/dev/null
+	local grep "$1" 'quoted text' sed grep 'quoted text'
+cd | echo done export export && --verbose
+	$(pwd) --verbose awk ${HOME} -eu
+		$(pwd) export 'quoted text' test && -eu
+"$1" -eu local --verbose awk grep --verbose readonly /usr/bin cd
+"$1" --verbose "$1" && done 2>/dev/null test --verbose
+&& echo "$1" then $(pwd) test && x=1 then awk
+	printf then printf done 2>/dev/null sed echo "$@"
+	export awk echo "$1" printf done "$1" x=1 cd echo grep 2>/dev/null
+	cd 'quoted text' grep cd done && readonly "$1" x=1 && echo
+	2>/dev/null echo /usr/bin awk awk
+printf -eu /usr/bin x=1 /usr/bin local printf awk test && 'quoted text' ${HOME}
+		x=1 grep 2>/dev/null "$1" ${HOME}
+	--verbose then done echo sed --verbose cd x=1 done "$@" -eu readonly awk grep
+	'quoted text' x=1 "$1" grep echo ${HOME} "$@" ${HOME} sed echo
+	printf --verbose --verbose printf export then && $(pwd) && printf
+		"$@" then awk done done
+		&& && done sed ${HOME} printf printf done awk then
+	'quoted text' printf ${HOME} export echo echo then "$@" done
+		| "$1" ${HOME} /usr/bin
+	&& "$1" | grep grep echo printf && test --verbose x=1 printf export
+	x=1 x=1 cd x=1 local x=1 ${HOME} cd "$1" | 'quoted text'
+		sed done --verbose /usr/bin local echo grep printf export readonly sed grep
+&& awk -eu | done 2>/dev/null 2>/dev/null grep awk done && $(pwd)
+--verbose done --verbose echo export -eu 2>/dev/null sed
+	'quoted text' 'quoted text' sed 'quoted text' grep echo test done --verbose
+	'quoted text' echo ${HOME} x=1 ${HOME} local
+local cd done /usr/bin /usr/bin --verbose && then 'quoted text' 2>/dev/null "$1"
+	sed printf local -eu ${HOME} 2>/dev/null local $(pwd) ${HOME} awk && sed
+	"$1" test readonly --verbose cd local -eu 2>/dev/null done "$@" then local
+		${HOME} done "$1" export readonly then echo test x=1 ${HOME} sed --verbose
+	awk /usr/bin 2>/dev/null cd grep 'quoted text'
+	readonly 2>/dev/null "$@" "$@" readonly --verbose x=1 test sed done awk
+		${HOME} x=1 | "$1" 2>/dev/null awk -eu 'quoted text' x=1
+		--verbose sed done grep echo grep grep "$@" readonly $(pwd) done ${HOME}
+		| awk grep test done $(pwd) export
+		awk 2>/dev/null | echo ${HOME}
+	then awk awk readonly readonly | then "$@" | sed /usr/bin echo
+awk printf /usr/bin ${HOME}
+| -eu then cd readonly
+		/usr/bin | 2>/dev/null 'quoted text'
+	2>/dev/null export done x=1 readonly "$@" /usr/bin awk -eu
+	"$1" x=1 && 'quoted text' 2>/dev/null /usr/bin sed test
+	"$1" "$1" ${HOME} export grep --verbose
+	then echo readonly | grep -eu --verbose readonly test awk readonly cd
+	cd "$@" printf sed /usr/bin x=1
+echo ${HOME} "$1" sed /usr/bin 'quoted text'
+		'quoted text' 'quoted text' ${HOME} --verbose
+printf 2>/dev/null printf | export grep -eu "$1" ${HOME} done 'quoted text'
+echo 'quoted text' test
+grep --verbose && $(pwd) --verbose "$1" local
+		'quoted text' local --verbose &&
+#include c94.sh
+	test | sed cd | cd done --verbose awk x=1 done readonly done
+	readonly awk test "$@" 'quoted text' export local printf "$1" cd x=1
+	| x=1 awk ${HOME} $(pwd) done
+readonly ${HOME} export 'quoted text' awk x=1 $(pwd) printf -eu
+	2>/dev/null awk readonly | $(pwd) 'quoted text' readonly
+&& then sed /usr/bin grep "$@" done --verbose | local $(pwd)
+	"$1" --verbose cd $(pwd) | awk
+'quoted text' export then 'quoted text'
+printf x=1 cd "$@" ${HOME} $(pwd) && local echo local ${HOME}
+	2>/dev/null 'quoted text' 'quoted text' "$1" | "$1" ${HOME} cd --verbose /usr/bin
+printf ${HOME} x=1 ${HOME} awk readonly /usr/bin
+	printf | /usr/bin echo then && test sed x=1
+		local x=1 done ${HOME} then $(pwd)
+then grep $(pwd) readonly $(pwd) | printf "$@" "$@" echo "$1" echo -eu
+		$(pwd) readonly "$@" printf $(pwd)
+	export 'quoted text' readonly echo "$@" $(pwd) sed test done export local $(pwd)
+	--verbose $(pwd) "$@" --verbose | printf sed
+	done $(pwd) && awk "$@" awk
+	2>/dev/null printf cd 'quoted text'
+	| export && -eu "$1" | x=1 2>/dev/null
+cd export done echo "$@"
+		--verbose sed /usr/bin done | local readonly "$1"
+"$@" sed && local | -eu 2>/dev/null | x=1 && awk x=1 export test cd 2>/dev/null
+		cd $(pwd) then 'quoted text'
+x=1 x=1 test grep /usr/bin cd echo
+		sed printf done grep sed readonly cd 'quoted text'
+	readonly awk --verbose && -eu export
+		cd test then echo readonly x=1 then cd x=1 "$1" printf grep cd cd sed
+	export printf /usr/bin echo 'quoted text' cd cd && local
+	-eu "$1" && | 2>/dev/null readonly
+done test $(pwd) local echo cd ${HOME} cd 2>/dev/null /usr/bin
+	&& test grep && 'quoted text' /usr/bin awk readonly 'quoted text' awk
+	x=1 | && done printf 2>/dev/null
+grep 'quoted text' then then sed "$@" export $(pwd)
+		"$@" ${HOME} readonly readonly "$@"
+	"$@" "$1" local then grep sed local local
+		$(pwd) && cd ${HOME} -eu /usr/bin ${HOME} sed echo ${HOME}
+	$(pwd) echo $(pwd) -eu && cd "$@" x=1 readonly cd grep echo echo cd grep
+		local 2>/dev/null /usr/bin
+	sed | | sed sed export && && ${HOME}
+printf && "$@" readonly /usr/bin grep printf 'quoted text' awk awk test done &&
+| | printf ${HOME} -eu printf done | sed ${HOME} && "$@" grep "$@"
+	"$@" 'quoted text' "$1" readonly echo
+| 2>/dev/null ${HOME} $(pwd)
+	--verbose x=1 printf --verbose echo
+sed -eu sed export export test /usr/bin grep x=1 "$1" -eu "$@" /usr/bin
+printf "$@" done x=1 awk
+awk | $(pwd) "$@" "$1" export "$1" -eu 2>/dev/null | $(pwd) cd "$@"
+	/usr/bin grep echo "$1" grep sed readonly printf "$1"
+		printf export done | | ${HOME} x=1 'quoted text' awk 2>/dev/null printf "$1" awk
+	${HOME} done echo printf x=1
+		then $(pwd) readonly awk --verbose | then $(pwd) grep "$@"
+	$(pwd) then cd grep then "$@" cd cd "$1" | readonly /usr/bin awk done "$@"
+		${HOME} $(pwd) done export local /usr/bin readonly "$@" 2>/dev/null
+	-eu sed /usr/bin echo "$@"
+awk readonly | export export
+printf $(pwd) test test grep local --verbose local
+	"$1" $(pwd) echo -eu | 2>/dev/null
+cd done ${HOME} sed 'quoted text' x=1 "$@" "$@" --verbose
+	"$@" ${HOME} --verbose 'quoted text' --verbose
+&& grep echo awk "$1" then | ${HOME} 'quoted text' test printf $(pwd) x=1
+		readonly | done done export
+	echo 2>/dev/null -eu readonly 2>/dev/null
+		readonly $(pwd) "$@" 2>/dev/null $(pwd) 2>/dev/null
+| grep --verbose readonly done "$1" "$@" then 2>/dev/null /usr/bin then -eu
+	grep ${HOME} done --verbose readonly printf && export awk "$@" test "$1" printf
+grep done awk test echo "$1" /usr/bin done local local export local
+		done grep printf cd then grep echo 2>/dev/null /usr/bin
+		cd --verbose then -eu 'quoted text' && readonly ${HOME}
+| 2>/dev/null | 'quoted text'
+	"$1" echo | 'quoted text'
+export | sed grep echo readonly
+done "$@" x=1 test echo local --verbose | --verbose | sed | && then -eu | |
+	printf local printf $(pwd)
+'quoted text' ${HOME} 'quoted text' 'quoted text' && 2>/dev/null && test readonly
+		x=1 --verbose "$@" -eu --verbose -eu
+		"$@" $(pwd) echo cd echo done then $(pwd) | "$@" export --verbose
+--verbose then printf 2>/dev/null grep --verbose
+	/usr/bin "$@" local then 2>/dev/null grep local -eu | "$@"
+	sed done -eu export then then 'quoted text' sed "$@" printf --verbose "$1"
+&& "$1" export test cd "$1" $(pwd) printf then printf | --verbose
+	done "$1" readonly test grep 2>/dev/null $(pwd)
+		"$@" printf cd printf -eu awk "$@"
+test then 2>/dev/null local &&
+-eu done echo 'quoted text'
+readonly /usr/bin -eu "$1" sed sed grep 2>/dev/null local then local sed
+awk then x=1 /usr/bin -eu $(pwd) awk $(pwd) x=1 test $(pwd) test
+| export "$@" then readonly $(pwd)
+		then printf sed -eu /usr/bin awk grep $(pwd) test sed && /usr/bin
+		then sed 'quoted text' -eu --verbose
+	test -eu awk 2>/dev/null x=1 awk test ${HOME}
+&& echo test echo awk echo readonly export echo local awk
+cd done local && echo $(pwd) grep $(pwd)
+		cd -eu "$1" 'quoted text'
+	${HOME} printf echo grep printf local export -eu echo 2>/dev/null
+printf sed x=1 awk x=1 test test grep x=1 export
+"$@" echo echo && | grep cd done --verbose ${HOME} /usr/bin readonly
+		local --verbose $(pwd) grep then
+	echo readonly && awk printf sed echo export test then readonly 2>/dev/null
+		/usr/bin local export cd test "$1"
+		readonly local readonly x=1 sed 2>/dev/null readonly &&
+done $(pwd) | done done 'quoted text' cd x=1
+	${HOME} --verbose then echo 'quoted text'
+	readonly test grep readonly -eu awk printf sed /usr/bin done local 'quoted text'
+		${HOME} x=1 sed cd awk done sed | printf readonly x=1 -eu grep /usr/bin
+		then echo -eu 'quoted text' echo "$@" done test -eu sed 2>/dev/null
+		local && printf 2>/dev/null sed /usr/bin /usr/bin $(pwd) local
+		echo done /usr/bin 2>/dev/null
+'quoted text' $(pwd) echo "$@" then done sed done sed
+	done local printf awk --verbose cd test awk -eu --verbose x=1 'quoted text'
+	printf readonly 2>/dev/null local export 'quoted text' x=1 printf
+	sed | local | 'quoted text' sed /usr/bin /usr/bin "$@" $(pwd) x=1 then
+&& echo readonly echo local 'quoted text' grep
+	"$1" --verbose local 2>/dev/null
+	-eu && --verbose 2>/dev/null $(pwd) then grep readonly
+		'quoted text' | "$@" -eu
+		"$1" sed /usr/bin && sed test
+	$(pwd) sed grep cd ${HOME} "$@" -eu "$1" -eu | readonly test test --verbose
+	printf ${HOME} test cd $(pwd) $(pwd) --verbose "$1" "$@" test x=1
+		/usr/bin /usr/bin local sed 2>/dev/null done
+	2>/dev/null echo "$@" && 2>/dev/null x=1 "$@" readonly && then
+		test local readonly $(pwd) test sed "$1" "$1" x=1
+		${HOME} && echo x=1 ${HOME} cd then
+sed 'quoted text' cd 'quoted text' printf && grep
+-eu /usr/bin /usr/bin "$1" 'quoted text' "$@"
+grep printf export -eu 2>/dev/null 'quoted text'
+	then grep ${HOME} local echo -eu local 'quoted text'
+	local local echo test -eu echo $(pwd) echo local -eu sed /usr/bin
+		--verbose grep done then
+2>/dev/null 2>/dev/null && readonly then --verbose "$1" 'quoted text'
+		then -eu test 2>/dev/null -eu 2>/dev/null printf then "$1" && 'quoted text'
+	/usr/bin 2>/dev/null "$1"
+		test cd | test "$@" "$1"
+		sed | ${HOME} cd readonly $(pwd) local
+		$(pwd) 2>/dev/null then cd -eu 'quoted text' "$1" readonly --verbose cd export
+	echo /usr/bin "$1" 2>/dev/null awk
+	echo local echo 'quoted text' printf /usr/bin x=1 $(pwd) --verbose then
+		&& 'quoted text' ${HOME} | echo ${HOME} printf
+		$(pwd) 2>/dev/null | && done echo | $(pwd) printf "$@" sed sed ${HOME} local
+	"$@" printf echo sed then cd test cd printf
+/usr/bin "$@" x=1 awk test &&
+		sed -eu --verbose "$1" $(pwd) "$1" awk && awk | "$1" && echo 'quoted text'
+| "$1" && ${HOME} sed x=1 ${HOME} echo then --verbose ${HOME} awk
+test grep sed && awk printf grep test readonly
+	$(pwd) local then "$1" && grep "$@" cd "$1" 2>/dev/null
+cd 'quoted text' /usr/bin grep 'quoted text' printf sed cd 'quoted text'
+echo done 'quoted text' "$@" | readonly local test && then $(pwd)
+		'quoted text' readonly "$@" --verbose awk -eu --verbose 2>/dev/null -eu
+		export /usr/bin awk -eu
+	awk echo 'quoted text' printf export test echo grep
+local /usr/bin 2>/dev/null "$@" "$1" awk 'quoted text' readonly
+		--verbose $(pwd) && -eu awk printf
+		${HOME} ${HOME} sed 'quoted text' grep readonly x=1 grep /usr/bin --verbose
+	--verbose test echo "$1" cd $(pwd) readonly
+		done /usr/bin /usr/bin 2>/dev/null
+	echo test sed local ${HOME} | cd | 'quoted text' --verbose printf test
+	&& "$1" | then x=1 --verbose sed echo ${HOME} -eu test "$1" then printf
+		"$@" -eu -eu cd --verbose done sed cd "$1" grep done done 'quoted text' "$@" local
+| awk readonly done awk local then && --verbose
+&& && 'quoted text' x=1 export local test && -eu readonly &&
+echo && $(pwd) then grep x=1 'quoted text' "$1" "$1"
+	test && grep grep ${HOME} | x=1 -eu "$1" -eu then test 'quoted text' x=1 then cd
+	2>/dev/null 2>/dev/null "$@" "$@"
+		sed grep awk -eu test
+		cd -eu /usr/bin readonly /usr/bin
+&& local --verbose x=1 ${HOME} | -eu grep sed | ${HOME}
+	x=1 sed then "$1" local sed --verbose test /usr/bin
+	${HOME} done 'quoted text' "$@"
+done --verbose test $(pwd) "$@" "$@" "$1" sed printf --verbose && ${HOME}
+	x=1 2>/dev/null && | then
+&& local awk grep done cd -eu && $(pwd)
+		local /usr/bin test test $(pwd) /usr/bin awk
+	readonly sed "$@" readonly done $(pwd) | $(pwd) "$@"
+'quoted text' printf x=1 && export cd then sed "$1" sed echo sed
+then | grep grep echo printf sed "$@" then cd printf ${HOME}
+	done cd x=1 printf && | x=1 && && $(pwd) 2>/dev/null local -eu 'quoted text'
+		${HOME} sed 'quoted text'
+		then | && /usr/bin test $(pwd) --verbose
+readonly 2>/dev/null sed sed awk "$@" then done "$1" 'quoted text'
+x=1 ${HOME} /usr/bin x=1 export printf test | ${HOME} grep awk |
+		-eu grep awk grep -eu x=1 test
+	"$1" then /usr/bin awk awk x=1
+		done | --verbose 2>/dev/null | $(pwd) grep
+'quoted text' grep readonly && && echo x=1 -eu grep readonly -eu -eu sed
+	sed sed echo local | "$@" "$1" --verbose test /usr/bin printf
+	--verbose | -eu printf "$@" 2>/dev/null
+	'quoted text' done local x=1 "$1" --verbose 2>/dev/null x=1 local echo then cd --verbose
+	/usr/bin readonly "$1" test ${HOME} grep done done -eu then &&
+"$@" local then readonly 'quoted text' "$1" ${HOME} then ${HOME} echo then
+	2>/dev/null grep x=1 echo grep -eu readonly sed readonly 'quoted text' -eu then
+local ${HOME} "$@" x=1 && ${HOME} grep 2>/dev/null "$@"
+2>/dev/null grep local --verbose | | awk
+	readonly /usr/bin "$@" sed printf test sed --verbose echo cd then "$@" sed
+test export x=1 /usr/bin -eu /usr/bin awk awk sed export
+		| grep printf --verbose x=1 ${HOME}
+	'quoted text' /usr/bin ${HOME} export awk "$1" grep then 2>/dev/null
+	"$1" echo -eu x=1 x=1 echo local cd printf x=1 grep && local x=1 echo
+sed $(pwd) -eu awk "$1" "$@" ${HOME} test
+${HOME} && readonly test printf --verbose cd
+	cd local --verbose /usr/bin printf export grep printf x=1
+	sed cd 'quoted text' test printf test then "$1" | local "$1" done
+	-eu 'quoted text' done
+grep readonly readonly "$@" sed grep $(pwd)
+	"$@" | local local grep cd local --verbose
+x=1 x=1 cd x=1 "$1" --verbose test local
+export ${HOME} && done ${HOME} grep -eu test local --verbose awk test "$1" /usr/bin
+	test | "$@" "$1" echo awk readonly local x=1 "$1" /usr/bin 'quoted text'
+		sed "$1" grep export done --verbose 'quoted text' /usr/bin test
+${HOME} x=1 --verbose "$@" --verbose
+	readonly "$@" "$1" x=1 "$@" && export ${HOME} sed 2>/dev/null done
+		printf echo -eu done export &&
+	"$1" x=1 done cd printf local --verbose readonly grep printf --verbose grep x=1
+		test /usr/bin then -eu /usr/bin 'quoted text' printf printf then 'quoted text'
+printf done $(pwd) cd awk && ${HOME} then -eu cd "$1" echo
+/usr/bin local done -eu test awk ${HOME}
+		-eu /usr/bin then done $(pwd) x=1 "$1" --verbose -eu awk test
+readonly "$@" $(pwd) "$@" $(pwd) -eu cd | grep ${HOME} echo
+		-eu export readonly --verbose "$@" echo -eu "$1" done
+		"$1" -eu | 2>/dev/null grep "$@" x=1 | --verbose 2>/dev/null ${HOME}
+	"$1" printf printf cd 'quoted text'
+$(pwd) test | x=1 $(pwd) sed awk local readonly && --verbose awk printf 2>/dev/null
+test test grep then grep "$@" local "$@" awk $(pwd) 2>/dev/null $(pwd)
+	grep echo $(pwd) test cd echo 'quoted text' "$1" export
+	"$1" 'quoted text' export | awk
+		"$1" | -eu done cd then sed sed grep
+	export printf printf grep printf "$@" | ${HOME} export
+		| 2>/dev/null sed sed grep test -eu done
+	'quoted text' ${HOME} 'quoted text' x=1 'quoted text' /usr/bin grep /usr/bin
+printf local --verbose awk -eu echo echo
+	"$@" 2>/dev/null "$@" /usr/bin readonly 'quoted text' test
+	${HOME} -eu ${HOME} local test --verbose "$1" | "$1" 2>/dev/null echo grep
+	readonly cd "$1" ${HOME} --verbose then awk "$@" grep readonly
+2>/dev/null $(pwd) test local export done /usr/bin printf local test
+		${HOME} x=1 "$@" -eu $(pwd) "$1" local cd test x=1 x=1 "$@" | x=1 then done then
+	test "$1" then -eu local grep cd sed
+	"$@" "$@" 2>/dev/null local "$1" local local printf cd "$@" test --verbose echo
+	/usr/bin && readonly | awk sed cd ${HOME} "$1" -eu
+		cd local readonly ${HOME} test "$1" && grep ${HOME}
+printf then $(pwd) x=1 2>/dev/null awk /usr/bin then awk
+	echo 'quoted text' "$1" "$1" 2>/dev/null sed grep ${HOME} done sed done grep
+	&& local cd then awk 2>/dev/null
+sed | sed "$@" x=1 awk grep
+cd ${HOME} /usr/bin grep grep
+	$(pwd) export cd readonly --verbose grep --verbose "$1" /usr/bin --verbose
+awk "$1" local printf --verbose x=1 printf cd 'quoted text' done
+	local cd awk sed $(pwd)
+sed "$@" x=1 x=1 test /usr/bin done readonly
+-eu x=1 'quoted text' grep x=1 && then $(pwd) readonly |
+	x=1 cd sed printf "$@" sed 'quoted text' | 2>/dev/null echo --verbose then x=1
+		${HOME} readonly test echo test readonly local
+	done then test cd -eu 2>/dev/null done grep cd "$1" 2>/dev/null -eu sed test echo
+grep then local sed ${HOME} "$@" -eu test 'quoted text'
+	2>/dev/null export printf /usr/bin grep
+"$1" grep "$@" export awk "$@" "$1"
+	cd "$@" -eu ${HOME} && --verbose | awk $(pwd) then
+		"$@" ${HOME} 'quoted text'
+'quoted text' /usr/bin sed 'quoted text' $(pwd) ${HOME} 2>/dev/null
+		export && /usr/bin --verbose x=1 ${HOME} x=1 awk test done done
+		awk 'quoted text' printf cd then -eu done x=1 "$1" test $(pwd) ${HOME} cd sed "$@"
+		${HOME} cd awk test printf readonly "$1" echo x=1 | "$@"
+		test readonly "$@" 2>/dev/null x=1 export $(pwd) sed cd --verbose -eu
+		"$1" export $(pwd) 2>/dev/null export
+		echo readonly local then x=1 "$1" echo
+grep printf awk readonly test $(pwd) done 2>/dev/null then
+	$(pwd) then x=1 x=1 -eu && local
+	&& -eu printf /usr/bin "$1" $(pwd) printf
+done then export test /usr/bin sed export awk $(pwd) done echo 2>/dev/null ${HOME}
+		| echo local --verbose export "$@" grep
+		sed && "$@" -eu ${HOME} "$@" awk printf
+	-eu echo then x=1 /usr/bin -eu readonly printf
+x=1 readonly export 2>/dev/null "$@" local $(pwd) "$@" x=1 done | /usr/bin
+"$@" 'quoted text' "$1" cd echo export export
+${HOME} done printf | test | then "$1" cd readonly done export "$1" printf test
+		"$@" sed x=1 cd --verbose readonly 2>/dev/null $(pwd) local "$@" echo
+	| -eu "$@" "$@" "$1" local | readonly sed echo awk cd -eu | local
+	$(pwd) "$@" && readonly ${HOME} echo export | awk sed /usr/bin done cd
+-eu sed | awk test "$1" | grep printf "$@" x=1 --verbose grep then
+		-eu "$1" | x=1 then printf test
+		--verbose 'quoted text' printf
+	${HOME} "$1" done --verbose "$@" x=1 /usr/bin 'quoted text' | 2>/dev/null then
+/usr/bin && 2>/dev/null readonly -eu echo | cd "$@" then cd
+sed readonly cd 'quoted text' readonly local echo 'quoted text' then sed
+	done then -eu awk then $(pwd) cd awk ${HOME} | --verbose then /usr/bin test readonly
+	done awk -eu then local sed sed printf export "$@" sed
+		&& readonly && -eu then cd cd /usr/bin 2>/dev/null
+	readonly cd 2>/dev/null "$@" | "$@" 2>/dev/null cd sed readonly
+		local /usr/bin cd $(pwd) readonly export && |
+sed -eu "$1" --verbose x=1
+		| then test "$1" "$1" /usr/bin awk x=1 grep printf 'quoted text'
+then awk cd -eu /usr/bin echo printf
+readonly then ${HOME} then $(pwd) echo readonly cd local printf 'quoted text'
+		cd x=1 local export -eu /usr/bin ${HOME} cd x=1 awk -eu test ${HOME}
+| x=1 2>/dev/null x=1 x=1 x=1 ${HOME}
+	$(pwd) --verbose grep
+awk | $(pwd) x=1 export readonly awk cd then export && | sed
+		export "$@" /usr/bin then sed export
+	$(pwd) done -eu /usr/bin local then -eu | local printf x=1 done /usr/bin
+	sed && export sed 'quoted text' | sed -eu echo sed -eu "$@" 'quoted text' 2>/dev/null
+echo readonly $(pwd) 'quoted text'
+	${HOME} -eu echo export 2>/dev/null && x=1 then
+		"$1" done --verbose $(pwd)
+/usr/bin /usr/bin 2>/dev/null
+	readonly grep done export done local echo local printf grep &&
+then printf sed && $(pwd) x=1 "$@" echo test readonly readonly awk x=1
+$(pwd) then readonly test printf /usr/bin "$1" 'quoted text' printf then x=1 then
+	-eu readonly "$1" 2>/dev/null done
+		2>/dev/null "$1" --verbose 'quoted text' x=1 "$@" /usr/bin printf ${HOME}
+-eu sed test 2>/dev/null $(pwd)
+	"$1" readonly && 'quoted text'
+	sed readonly 2>/dev/null && awk grep -eu local --verbose grep
+		awk | test echo awk ${HOME} /usr/bin done --verbose ${HOME} local
+"$1" awk --verbose && | ${HOME} export /usr/bin grep
+test | test done x=1 x=1 "$@" 2>/dev/null "$1" $(pwd) | --verbose x=1
+		-eu local echo done | cd test && local && 'quoted text'
+	'quoted text' then readonly
+| readonly && /usr/bin cd | export cd printf echo readonly
+echo "$1" /usr/bin x=1 ${HOME} x=1 && export --verbose done
+		readonly then grep --verbose -eu test 2>/dev/null
+		grep "$1" ${HOME} && awk
+		/usr/bin then sed export export -eu -eu done export local -eu 2>/dev/null "$@" 2>/dev/null
+-eu sed then readonly && ${HOME} export | test cd "$@" sed done -eu
+${HOME} sed -eu 'quoted text' | | awk --verbose
+	echo readonly && then
+sed "$1" printf echo sed "$@" 2>/dev/null test sed ${HOME} -eu x=1 -eu ${HOME}
+	grep --verbose test x=1 echo && | local sed "$1" ${HOME} test grep "$@" cd export
+		test sed | x=1 grep "$1" grep test echo
+then /usr/bin $(pwd) --verbose local "$@" printf "$1" awk local
+		2>/dev/null "$1" | cd grep x=1 then then echo 2>/dev/null
+then export awk "$1" echo ${HOME} done local /usr/bin x=1 local printf export cd
+'quoted text' 'quoted text' grep then
+	'quoted text' readonly awk sed --verbose echo
+	| printf /usr/bin "$1" "$1" "$1" && 2>/dev/null 2>/dev/null --verbose
+	done ${HOME} /usr/bin --verbose "$@" && "$@" 'quoted text' /usr/bin grep
+	grep awk grep "$@" awk 2>/dev/null /usr/bin cd "$@" test
+sed ${HOME} sed grep "$1" awk && --verbose readonly /usr/bin
+export "$1" local awk "$@" sed -eu ${HOME} test && grep local "$1" && 2>/dev/null
+-eu test | 'quoted text' --verbose grep cd cd local && "$@" done
+	export test 'quoted text' 'quoted text' $(pwd) --verbose /usr/bin
+${HOME} && 2>/dev/null readonly local ${HOME}
+"$1" "$1" awk printf done /usr/bin
+		2>/dev/null grep x=1 'quoted text' done
+		readonly 'quoted text' 'quoted text' then
+"$@" echo test test grep -eu 'quoted text' -eu
+grep /usr/bin | readonly -eu "$@" -eu --verbose grep "$@"
+2>/dev/null 'quoted text' cd $(pwd) local "$@"
+	"$@" readonly done awk done sed "$@" readonly "$@" then "$@" | -eu done
+	$(pwd) grep echo && --verbose grep local x=1 readonly printf "$@" printf
+${HOME} done awk /usr/bin export
+	x=1 readonly "$1" $(pwd) done awk grep ${HOME} grep &&
+	echo awk ${HOME} $(pwd) readonly "$@" echo sed local -eu test
+	$(pwd) $(pwd) printf --verbose awk x=1 ${HOME} awk ${HOME}
+		printf cd local "$@" x=1
+	grep 2>/dev/null "$@" /usr/bin done $(pwd) 2>/dev/null export then ${HOME}
+		--verbose grep awk /usr/bin then readonly && 'quoted text' test ${HOME} readonly
+		export 'quoted text' then sed readonly
+x=1 done done "$@" then ${HOME} then done "$1" grep readonly
+		echo printf $(pwd) $(pwd) local done sed 2>/dev/null 2>/dev/null grep
+	"$1" export test "$@" 2>/dev/null -eu then /usr/bin
+		"$@" ${HOME} x=1 then x=1
+		x=1 test && export x=1
+	local "$@" printf ${HOME} ${HOME} done --verbose cd --verbose
+		"$@" -eu done 'quoted text' readonly test "$1" sed && grep && | grep local ${HOME}
+	x=1 test 'quoted text'
+		awk test local /usr/bin -eu done --verbose -eu sed -eu 'quoted text' -eu grep
+		then && sed | then "$@"
+	then /usr/bin 'quoted text' "$1" --verbose
+		x=1 cd export && --verbose /usr/bin sed -eu local
+--verbose "$1" $(pwd) ${HOME} "$1" ${HOME} awk -eu && "$@" && local -eu
+&& 2>/dev/null && printf &&
+	$(pwd) readonly ${HOME} sed
+	"$@" grep sed done ${HOME} x=1 printf
+"$1" printf local --verbose && printf export $(pwd) x=1 'quoted text'
+		test sed test export done cd "$1" grep
+	grep test /usr/bin local
+	awk "$1" /usr/bin test $(pwd) grep -eu 2>/dev/null echo
+"$1" $(pwd) 'quoted text' readonly then -eu awk && -eu
+		export local awk "$1" x=1 /usr/bin then local 2>/dev/null
+		cd then "$1" && done x=1 2>/dev/null
+		local done ${HOME} echo done test "$1" ${HOME} "$@" 2>/dev/null
+then 'quoted text' /usr/bin awk then then $(pwd) 2>/dev/null awk local --verbose
+	local printf grep 'quoted text' echo
+		awk grep "$@" | awk grep awk x=1 "$1" cd "$1" $(pwd)
+	-eu sed grep 'quoted text' x=1
+		-eu -eu cd 'quoted text' local cd export done cd test
+	&& | && cd x=1 test "$@" "$1" 'quoted text' --verbose echo
+x=1 awk | | ${HOME} /usr/bin "$1" grep -eu /usr/bin
+	printf readonly test test "$@" "$1" readonly 'quoted text' printf sed cd |
+$(pwd) --verbose printf "$@" "$1" 2>/dev/null "$@" export done
+	--verbose x=1 grep cd echo printf cd cd /usr/bin
+		test 'quoted text' awk --verbose -eu
+test 2>/dev/null "$@" /usr/bin && done local
+"$1" cd "$1" -eu then /usr/bin
+		${HOME} sed ${HOME} cd printf
+	x=1 $(pwd) then x=1 'quoted text'
+	-eu export "$1" test "$1" readonly sed then --verbose -eu ${HOME}
+	test echo awk local 'quoted text' printf |
+	${HOME} && $(pwd) $(pwd) "$@" readonly
+		local x=1 'quoted text' 'quoted text' x=1
+		sed -eu /usr/bin sed test "$@" echo done "$1" "$@" -eu printf
+test local grep then printf sed readonly "$1" test "$1"
+	local ${HOME} done | | 'quoted text' grep /usr/bin | grep "$@"
+		awk cd x=1 grep done cd sed then awk 'quoted text' awk /usr/bin /usr/bin | --verbose
+test readonly "$@" 2>/dev/null grep
+2>/dev/null cd && cd /usr/bin
+&& /usr/bin 'quoted text' export $(pwd)
+printf ${HOME} 'quoted text' 2>/dev/null done then -eu grep "$@" 'quoted text'
+export 2>/dev/null test readonly /usr/bin 'quoted text'
+		echo then printf export "$@" 2>/dev/null sed echo readonly printf && test
+	2>/dev/null local readonly && awk readonly then -eu test export then test
+	test echo "$@" x=1 $(pwd) cd local $(pwd)
+echo test | done x=1 test /usr/bin sed "$1" --verbose sed
+		"$1" -eu readonly done cd readonly printf done readonly
+done /usr/bin done $(pwd) 'quoted text' then readonly grep echo export
+	'quoted text' $(pwd) | 2>/dev/null ${HOME} echo
+		local local grep | /usr/bin sed "$1" x=1 test printf x=1 'quoted text'
+	grep 'quoted text' local then "$1"
+		"$@" echo awk local printf "$1" --verbose
+awk --verbose 2>/dev/null sed readonly local printf
+	"$@" && sed then sed x=1 then
+	awk /usr/bin export "$1" --verbose x=1 test --verbose awk cd cd readonly
+x=1 awk awk awk awk "$1" -eu
+		--verbose 2>/dev/null done printf && "$1"
+	2>/dev/null printf && | 'quoted text' $(pwd) "$1" /usr/bin printf
+	${HOME} -eu readonly awk readonly sed echo 2>/dev/null "$1"
+	echo local -eu && $(pwd) done then /usr/bin $(pwd) readonly "$@" grep test
+--verbose "$@" printf grep printf cd $(pwd)
+	"$1" "$@" done awk sed awk printf --verbose "$1" echo local echo
+export /usr/bin cd cd ${HOME} && 'quoted text'
+		&& export echo 2>/dev/null
+sed $(pwd) readonly | echo printf
+| 2>/dev/null grep printf local sed | "$@" cd
+		test x=1 "$@" /usr/bin grep awk
+		'quoted text' done done 'quoted text' echo | | "$1" 'quoted text'
+	printf $(pwd) export /usr/bin --verbose
+	$(pwd) local -eu 2>/dev/null then
+	&& 'quoted text' --verbose echo | --verbose grep
+		cd 2>/dev/null && grep
+		--verbose 'quoted text' test cd /usr/bin
+readonly export && local done -eu printf done
+grep "$@" export -eu 2>/dev/null
+	--verbose "$@" sed "$1" then | | ${HOME}
+	echo && awk -eu printf "$1" $(pwd) 'quoted text' sed cd /usr/bin /usr/bin
+done export "$1" && ${HOME} | readonly && --verbose x=1 echo "$1" printf
+readonly "$1" sed && /usr/bin && 'quoted text' cd export then echo
+--verbose x=1 /usr/bin
+		echo "$1" | ${HOME} $(pwd) readonly echo ${HOME} "$@"
+grep test 'quoted text' --verbose
+	"$1" | x=1 /usr/bin readonly readonly
+"$1" /usr/bin "$@" then readonly export -eu then /usr/bin
+	readonly --verbose && printf
+		awk && $(pwd) printf export export grep && x=1 $(pwd) test echo
+'quoted text' awk test readonly test
+	$(pwd) --verbose local 2>/dev/null then "$1" export cd 2>/dev/null
+	&& "$@" awk grep cd --verbose -eu x=1 grep grep then "$@" x=1
+	--verbose echo test done 'quoted text' awk
+		readonly -eu test --verbose 'quoted text' $(pwd) "$@" awk
+/usr/bin sed && test awk
+		${HOME} readonly cd grep ${HOME}
+awk export readonly test
+	${HOME} echo echo x=1 grep
+echo printf then printf --verbose
+/usr/bin "$@" 2>/dev/null export "$1"
+	$(pwd) | --verbose ${HOME} test ${HOME} readonly printf echo
+		x=1 sed --verbose echo x=1 awk "$@" "$@"
+--verbose x=1 x=1 | cd done --verbose
+	/usr/bin 2>/dev/null echo export cd 2>/dev/null readonly "$1"
+		sed --verbose -eu test then 'quoted text' cd local && then $(pwd) "$1"
+	--verbose && awk -eu /usr/bin done 2>/dev/null
+readonly && x=1 test
+${HOME} -eu done 2>/dev/null | ${HOME} awk printf grep $(pwd)
+echo test --verbose /usr/bin done cd --verbose
+2>/dev/null "$@" "$1" x=1 printf then x=1 cd readonly printf "$@" export sed
+	done done | -eu awk ${HOME} $(pwd) 2>/dev/null $(pwd) /usr/bin $(pwd)
+		--verbose sed local | 'quoted text' local done "$@" printf
+printf sed export "$@" readonly
+	| && x=1 /usr/bin test echo echo &&
+echo test 2>/dev/null grep ${HOME} --verbose -eu && export &&
+2>/dev/null ${HOME} $(pwd)
+	local cd awk "$@" done
+		-eu then awk sed done && "$@" echo cd -eu
+		-eu then x=1 ${HOME} test && then printf --verbose
+	"$1" sed export test export && printf echo |
+		${HOME} export export export
+-eu /usr/bin local local readonly grep
+cd echo test printf ${HOME} && $(pwd) local grep --verbose "$@"
+	-eu grep 2>/dev/null | printf then grep awk
+		&& export -eu then --verbose grep "$1" --verbose 'quoted text' "$@" printf $(pwd)
+	"$1" sed sed 'quoted text' 2>/dev/null --verbose awk 2>/dev/null "$1"
+test 2>/dev/null 2>/dev/null $(pwd)
+	2>/dev/null grep printf echo x=1 cd && cd
+	local && 'quoted text' export --verbose
+		/usr/bin $(pwd) "$@" /usr/bin printf test $(pwd) local done cd done
+	then export test -eu | export then echo grep -eu awk 2>/dev/null 'quoted text' |
+x=1 && export grep local x=1 2>/dev/null printf then
+	local "$1" 2>/dev/null test sed local printf "$@" printf --verbose --verbose
+		--verbose printf "$@" printf
+| awk echo test local echo | -eu done x=1 'quoted text' then grep "$1" export
+		cd 2>/dev/null --verbose done /usr/bin then 'quoted text' 2>/dev/null
+	'quoted text' | "$1" /usr/bin cd $(pwd) then cd $(pwd) $(pwd) ${HOME}
+readonly then && local echo test grep "$1"
+grep "$@" printf 2>/dev/null $(pwd) "$1" && --verbose "$@" echo
+		${HOME} "$1" "$@" export /usr/bin 2>/dev/null ${HOME}
+grep 2>/dev/null "$@" then then --verbose /usr/bin && grep
+		| 2>/dev/null "$1" readonly "$@" echo --verbose readonly "$1" /usr/bin
+		export 2>/dev/null 'quoted text' local
+	done test cd "$@" && printf cd ${HOME} $(pwd)
+		echo "$@" ${HOME} done 'quoted text' export
+"$@" done grep $(pwd) ${HOME} cd $(pwd)
+		"$1" printf "$@" --verbose
+'quoted text' /usr/bin /usr/bin
+then printf echo "$@" grep 'quoted text' sed "$@"
+test "$1" then && -eu cd -eu x=1 cd export x=1 done echo awk 2>/dev/null
+		"$1" 2>/dev/null x=1 readonly
+then test test -eu && grep
+		awk "$@" -eu 2>/dev/null 2>/dev/null
+	"$1" sed printf cd grep --verbose readonly --verbose
+test x=1 local test --verbose -eu test sed echo sed readonly
+	done cd local $(pwd) && -eu sed $(pwd) then export -eu x=1 echo 'quoted text'
+	printf ${HOME} x=1 x=1 -eu test
+	x=1 /usr/bin | done 2>/dev/null sed 'quoted text' 2>/dev/null
+local cd export "$1" test readonly readonly
+	awk done local 'quoted text' then ${HOME} "$@" -eu
+		echo printf local /usr/bin 'quoted text' x=1 export
+x=1 export grep $(pwd) sed test grep export
+		export echo "$@" 2>/dev/null
+	grep /usr/bin && 'quoted text' --verbose
+local 'quoted text' 'quoted text' $(pwd) grep
+		'quoted text' | /usr/bin printf | local "$@" -eu 2>/dev/null local $(pwd)
+		$(pwd) grep 2>/dev/null sed local --verbose --verbose
+		--verbose 'quoted text' sed ${HOME} "$@" echo local && 2>/dev/null ${HOME}
+local then "$1" then export
+	printf /usr/bin && readonly 'quoted text'
+		$(pwd) --verbose $(pwd) "$@" 2>/dev/null "$@" $(pwd) --verbose /usr/bin $(pwd)
+		awk awk grep | x=1 awk --verbose done done done then --verbose sed readonly
+		awk --verbose echo --verbose then
+		2>/dev/null cd done 2>/dev/null
+		echo export 'quoted text' --verbose done printf 2>/dev/null -eu awk readonly
+		| --verbose && 'quoted text'
+&& --verbose awk grep grep done "$1" sed printf
+		sed then then grep 'quoted text' cd $(pwd) grep
+		sed "$1" done "$1" | --verbose export && ${HOME} local grep 2>/dev/null
+		'quoted text' cd export sed "$@" test done local awk
+	test sed awk -eu "$@" --verbose
+		readonly cd export 2>/dev/null local readonly local "$@"
+	"$1" "$@" then /usr/bin cd && echo x=1 test grep -eu sed local
+	2>/dev/null grep -eu grep
+x=1 x=1 local printf then grep readonly awk 2>/dev/null awk
+		cd awk "$@" ${HOME} | done done 2>/dev/null ${HOME} ${HOME} && 'quoted text'
+grep ${HOME} test && "$1" echo -eu grep $(pwd) grep grep done $(pwd) -eu
+printf test then printf && sed awk done "$@" "$@" echo "$1" done printf test "$@"
+		echo sed -eu echo ${HOME} local
+		&& sed 2>/dev/null ${HOME} ${HOME}
+	/usr/bin $(pwd) cd then 2>/dev/null
+	--verbose test && sed x=1 printf && sed test awk printf grep 2>/dev/null
+export echo /usr/bin done | echo |
+		awk then $(pwd) | | $(pwd) test printf grep --verbose ${HOME}
+		then done export then local | echo grep --verbose
+"$@" "$@" test sed x=1 && export "$1"
+		-eu ${HOME} 'quoted text' 2>/dev/null "$@" 2>/dev/null "$@" export
+	test $(pwd) local $(pwd) 2>/dev/null done
+x=1 ${HOME} then x=1 | cd $(pwd) echo 2>/dev/null ${HOME} "$@" $(pwd)
+$(pwd) && awk -eu local local --verbose done ${HOME} then $(pwd)
+		| 'quoted text' 'quoted text' | "$1" 'quoted text'
+		x=1 2>/dev/null /usr/bin echo echo
+		then --verbose readonly done x=1 readonly test /usr/bin cd --verbose
+cd then cd then x=1 cd "$1" && "$1" /usr/bin test ${HOME} sed export
+	sed readonly echo test $(pwd) readonly printf ${HOME} echo awk
+		grep --verbose awk --verbose local then grep
+	&& /usr/bin then /usr/bin 'quoted text' | --verbose
+		cd local /usr/bin -eu then done 2>/dev/null 2>/dev/null export -eu "$1"
+		readonly $(pwd) 'quoted text' ${HOME} "$1" test cd then ${HOME} awk
+then x=1 test 'quoted text' then readonly done 2>/dev/null cd sed ${HOME} echo
+grep $(pwd) /usr/bin done cd -eu ${HOME}
+export "$@" 'quoted text' awk x=1 awk /usr/bin -eu && |
+/usr/bin done local --verbose grep cd 2>/dev/null --verbose
+	| 'quoted text' 2>/dev/null /usr/bin
+	x=1 then grep "$@" /usr/bin cd && -eu -eu test /usr/bin
+-eu cd sed && test ${HOME} sed | |
+local ${HOME} | echo --verbose then "$@" "$1" done cd /usr/bin
+"$@" x=1 "$1" then 'quoted text' -eu $(pwd) test --verbose | done "$@" grep
+cd done ${HOME} cd && grep
+		x=1 /usr/bin cd printf local then sed 2>/dev/null
+		--verbose --verbose then
+	--verbose sed then && -eu /usr/bin awk grep -eu ${HOME} && ${HOME} then
+		-eu 'quoted text' readonly local export readonly local /usr/bin 'quoted text'
+		test printf grep cd then test $(pwd) test 'quoted text'
+	"$1" -eu echo local export export local
+	--verbose then "$@" 2>/dev/null grep && echo
+2>/dev/null "$1" then $(pwd) "$1" | -eu -eu 2>/dev/null | | /usr/bin && done
+	"$@" 2>/dev/null then -eu
+		awk && sed echo readonly local then awk
+	printf grep "$@" x=1 ${HOME} && then 'quoted text' ${HOME} local printf
+		printf x=1 test $(pwd) local /usr/bin && grep cd
+$(pwd) readonly && ${HOME} grep grep done printf then export
+--verbose x=1 sed x=1 "$@" "$@" "$@" "$@" x=1 export test then | sed awk x=1
+local "$1" cd local ${HOME} sed
+	awk x=1 --verbose /usr/bin echo x=1 x=1 "$@" printf | echo export cd local
+	"$1" export && x=1 awk /usr/bin
+${HOME} "$1" 'quoted text' printf readonly && x=1 export
+sed && awk test ${HOME} done then
+	then /usr/bin 2>/dev/null "$@" export test --verbose && readonly 'quoted text'
+	x=1 "$1" --verbose ${HOME} sed /usr/bin readonly echo sed test done && then sed
+		readonly printf $(pwd) local readonly
+	echo test x=1 x=1 local x=1
+	done -eu --verbose | done
+		test 2>/dev/null "$1" x=1 --verbose --verbose
+	cd "$1" -eu test x=1 && 2>/dev/null done 2>/dev/null printf /usr/bin "$@"
+		echo -eu $(pwd) "$1" awk local
+${HOME} -eu readonly grep grep then readonly 2>/dev/null cd x=1 /usr/bin
+	done done cd | 'quoted text'
+	2>/dev/null 2>/dev/null cd test awk awk 'quoted text' then |
+	"$@" readonly -eu local awk then readonly grep awk then echo sed echo done
+--verbose 2>/dev/null 2>/dev/null --verbose /usr/bin readonly $(pwd)
+		x=1 -eu readonly readonly $(pwd) -eu "$@" --verbose /usr/bin awk test
+		${HOME} then "$@" -eu ${HOME} grep | -eu awk grep "$@" 2>/dev/null export printf
+	&& export awk 2>/dev/null 2>/dev/null --verbose
+	printf awk "$@" readonly $(pwd) 2>/dev/null
+	2>/dev/null ${HOME} grep "$@"
+		--verbose $(pwd) printf
+		-eu readonly readonly "$1" | && ${HOME} | printf /usr/bin printf done && test
+		local grep $(pwd) "$1" |
+	local 'quoted text' | --verbose readonly done echo local
+		| echo "$@" awk x=1 | --verbose test awk sed && local local
+	awk export | local && then $(pwd) cd
+	awk /usr/bin cd 'quoted text'
+printf awk ${HOME} "$1" && | "$1" $(pwd) printf x=1
+	grep /usr/bin export awk printf --verbose printf awk
+	local ${HOME} local x=1
+		x=1 test ${HOME} printf -eu printf "$@" /usr/bin 2>/dev/null
+		2>/dev/null printf 'quoted text'
+printf awk done | -eu 'quoted text' printf printf done "$@" 2>/dev/null /usr/bin
+		$(pwd) grep readonly done echo
+		/usr/bin 2>/dev/null && grep | "$@"
+export export $(pwd) -eu export
+		done 'quoted text' 2>/dev/null cd sed
+	echo | grep ${HOME} readonly ${HOME} "$@" x=1
+		--verbose echo 2>/dev/null
+	&& sed -eu 2>/dev/null done -eu grep && $(pwd) readonly local done cd readonly
+		| && --verbose readonly --verbose | export 2>/dev/null 2>/dev/null -eu
+-eu "$@" local 2>/dev/null --verbose "$1" 2>/dev/null
+	then /usr/bin readonly export 'quoted text' awk ${HOME}
+		${HOME} 2>/dev/null 2>/dev/null export sed grep "$@" local
+	--verbose -eu 'quoted text' export 2>/dev/null export
+	then x=1 sed $(pwd) grep && 2>/dev/null
+		grep export test 2>/dev/null done printf 2>/dev/null -eu
+	| awk cd -eu && ${HOME} test "$@" grep
+/usr/bin sed ${HOME} test done local done /usr/bin --verbose echo
+		-eu sed 'quoted text' test -eu && local x=1
+/usr/bin local x=1 /usr/bin printf export cd | cd done $(pwd)
+		&& local echo done cd sed -eu
+		/usr/bin cd local "$@" printf /usr/bin --verbose done local 2>/dev/null
+printf awk | test 2>/dev/null local grep | $(pwd) "$@" -eu 2>/dev/null
+		"$1" x=1 awk 2>/dev/null test then --verbose sed test echo awk $(pwd) sed 2>/dev/null
+		cd --verbose printf x=1 test awk 2>/dev/null "$@" echo "$@"
+export grep 2>/dev/null x=1 export printf sed
+	"$@" echo -eu awk sed export | local local
+	-eu printf "$1" local readonly "$1" /usr/bin done
+2>/dev/null export echo awk --verbose | done $(pwd) local -eu local 2>/dev/null
+grep x=1 printf | printf -eu sed -eu sed test ${HOME} test readonly export
+	grep awk export --verbose local awk | grep awk printf /usr/bin && $(pwd) readonly
+	test $(pwd) printf ${HOME} local printf x=1 grep "$@" && 2>/dev/null
+		--verbose sed "$1" done x=1 --verbose | 2>/dev/null
+sed then --verbose 2>/dev/null done "$1" echo done test sed x=1 grep printf
+done test echo done ${HOME} then 'quoted text' done local x=1 export
+--verbose cd grep && cd /usr/bin grep ${HOME} 2>/dev/null --verbose ${HOME}
+printf x=1 $(pwd) 'quoted text' 'quoted text' done
+		readonly printf x=1 /usr/bin "$1" && | then grep test --verbose
+	x=1 'quoted text' export -eu sed then $(pwd) cd "$1" "$1" grep test 'quoted text'
+		done 'quoted text' "$1" local local
+	echo x=1 local cd "$1" sed | $(pwd)
+--verbose local --verbose awk export x=1 sed --verbose local && then 'quoted text'
+		${HOME} "$1" grep $(pwd) && --verbose test $(pwd) then printf $(pwd) local
+'quoted text' ${HOME} 2>/dev/null
+		/usr/bin 2>/dev/null export ${HOME} && then "$@" 'quoted text' | --verbose ${HOME}
+		then ${HOME} grep --verbose printf
+		grep readonly x=1 -eu
+	$(pwd) then "$1" sed cd x=1
+	cd 2>/dev/null x=1 test -eu readonly 'quoted text' then -eu then --verbose
+done then "$@" printf printf
+done test sed cd x=1 | echo | awk sed grep $(pwd) readonly
+		/usr/bin sed x=1 --verbose --verbose
+x=1 local test $(pwd) && | --verbose test
+| then /usr/bin 2>/dev/null -eu readonly
+		then /usr/bin 'quoted text' /usr/bin /usr/bin x=1 -eu test cd && "$1" 'quoted text'
+'quoted text' | "$@" test | echo $(pwd)
+readonly "$1" printf then ${HOME} | echo "$@"
+		"$1" ${HOME} grep printf 2>/dev/null && then then done 2>/dev/null done x=1
+	cd 2>/dev/null 2>/dev/null local | then -eu "$1" done cd 2>/dev/null grep $(pwd)
+	$(pwd) "$@" -eu then then export readonly "$1" /usr/bin echo x=1 2>/dev/null
+export $(pwd) local $(pwd) then
+	test local -eu awk local "$@" grep awk
+		-eu local -eu export "$1" --verbose then readonly
+		then /usr/bin 'quoted text' 2>/dev/null echo then then grep | x=1 $(pwd) export
+&& done 2>/dev/null "$@" && "$1" | echo /usr/bin --verbose $(pwd)
+		x=1 -eu grep 2>/dev/null grep sed
+		x=1 grep "$@" readonly test -eu awk -eu "$@" local -eu --verbose ${HOME} &&
+	export "$1" --verbose readonly x=1 --verbose "$1" /usr/bin
+	2>/dev/null readonly readonly ${HOME}
+	2>/dev/null local | grep awk awk /usr/bin 2>/dev/null | local then && grep
+printf readonly /usr/bin x=1 cd && 'quoted text'
+		'quoted text' sed ${HOME} grep --verbose $(pwd) test test done
+	awk echo | /usr/bin echo x=1 readonly
+		'quoted text' printf 2>/dev/null grep
+	readonly echo --verbose readonly 'quoted text'
+x=1 test then readonly -eu export
+done | "$@" -eu grep awk
+	$(pwd) "$1" $(pwd) readonly $(pwd) x=1 echo echo sed grep
+		export && ${HOME} then "$@" ${HOME}
+		-eu sed export local printf --verbose then cd | done echo sed $(pwd)
+		done --verbose printf /usr/bin "$1" --verbose
+	$(pwd) echo local | cd readonly x=1 2>/dev/null sed "$@" "$@" "$1" "$1"
+		"$@" /usr/bin "$@" grep test readonly
+		"$1" export done "$1" sed
+		readonly printf 2>/dev/null 'quoted text' grep test
+		"$1" "$1" test echo && grep printf
+	--verbose "$@" 2>/dev/null
+	done done 2>/dev/null cd ${HOME}
+/usr/bin cd export export readonly --verbose ${HOME} "$@"
+	-eu "$@" 2>/dev/null sed && awk
+"$1" local && /usr/bin "$1"
+	grep $(pwd) grep export 2>/dev/null sed $(pwd) -eu echo awk && "$@" && then
+sed -eu then --verbose /usr/bin done
+| -eu /usr/bin export -eu ${HOME}
+cd grep then awk echo |
+		test cd | -eu --verbose $(pwd) x=1 "$@" ${HOME} awk awk ${HOME}
+		| done printf -eu -eu local readonly local sed | x=1
+	test printf export --verbose cd cd "$1" 'quoted text' ${HOME} grep |
+local x=1 done echo local 'quoted text' export --verbose --verbose then local done
+		2>/dev/null test then
+awk sed && /usr/bin -eu grep "$@" 'quoted text' done done &&
+&& $(pwd) | export local 'quoted text' cd ${HOME} readonly
+		| "$1" grep | "$@" sed grep then printf /usr/bin printf
+	local ${HOME} sed ${HOME}
+'quoted text' "$@" x=1 test sed grep $(pwd) 2>/dev/null
+	&& echo then ${HOME} awk grep grep printf printf grep --verbose
+		export "$@" ${HOME} cd then $(pwd) readonly awk
+	done printf local 'quoted text' x=1 2>/dev/null readonly then "$1"
+local done test test "$1" /usr/bin
+	x=1 --verbose export done 'quoted text' printf echo printf $(pwd) cd -eu local $(pwd)
+	export done test echo readonly local readonly "$@" $(pwd) "$1" test export
+	$(pwd) "$1" --verbose
+		readonly readonly 'quoted text' --verbose && readonly awk
+		local readonly echo export 2>/dev/null x=1 export test $(pwd)
+test sed test /usr/bin 'quoted text' awk test export export "$1" x=1 export
+		--verbose 2>/dev/null test export $(pwd) --verbose
+	--verbose x=1 | test then "$@" printf sed $(pwd) test ${HOME} export grep
+x=1 | echo "$1" readonly export && done awk /usr/bin grep
+	x=1 grep -eu awk cd awk 2>/dev/null awk | && 2>/dev/null grep
+	local export readonly then ${HOME} printf $(pwd) readonly
+		then -eu local | && 'quoted text' test 'quoted text' cd echo then local grep
+"$1" x=1 export then --verbose x=1 -eu then export
+		readonly printf then -eu "$1" 2>/dev/null 2>/dev/null "$@" then then /usr/bin
+		--verbose readonly cd cd $(pwd) grep && printf ${HOME} sed cd sed "$@"
+"$@" readonly x=1 sed readonly
+'quoted text' 'quoted text' "$@" /usr/bin export $(pwd) | echo
+printf "$@" test awk /usr/bin --verbose $(pwd) done
+		awk then $(pwd) echo printf --verbose /usr/bin local done then --verbose
+--verbose test "$1" test $(pwd) echo local awk test readonly
+2>/dev/null 'quoted text' "$@" sed test awk awk --verbose sed -eu --verbose
+		${HOME} /usr/bin echo readonly grep readonly /usr/bin ${HOME}
+then echo && "$@" "$@" "$@" grep done --verbose sed
+'quoted text' | /usr/bin "$1" test | export && grep then
+	done readonly 2>/dev/null local --verbose
+	${HOME} 2>/dev/null export test | then
+		cd --verbose x=1 printf
+	printf -eu export --verbose printf grep export local export --verbose export
+		test 2>/dev/null | /usr/bin
+		&& printf | 'quoted text' --verbose local echo 'quoted text'
+	printf test 'quoted text' done echo 2>/dev/null then echo readonly cd sed test
+	$(pwd) && /usr/bin done then test 'quoted text'
+	printf test /usr/bin --verbose --verbose then --verbose x=1 "$@" done
+	"$1" awk | export grep awk test grep /usr/bin done
+		sed readonly ${HOME} "$@" cd /usr/bin
+		&& --verbose export awk cd then cd 2>/dev/null
+	echo "$1" -eu 'quoted text' echo $(pwd) /usr/bin 2>/dev/null --verbose &&
+		local echo "$@" x=1 --verbose | grep readonly printf
+	sed --verbose sed 'quoted text' "$@" $(pwd) -eu | then
+"$1" --verbose printf export 'quoted text' test grep then --verbose
+then -eu sed "$1" | printf -eu readonly
+	echo then 2>/dev/null 2>/dev/null 'quoted text' local "$1" awk
+	'quoted text' $(pwd) | "$@" /usr/bin -eu
+		--verbose test readonly $(pwd) echo awk 'quoted text'
+&& printf done 2>/dev/null /usr/bin test readonly | $(pwd)
+	$(pwd) 2>/dev/null 'quoted text' echo $(pwd) | test awk 'quoted text' x=1
+	then 2>/dev/null test | done cd sed --verbose 'quoted text'
+	done grep echo done --verbose test printf readonly --verbose $(pwd) export
+		echo && $(pwd) local grep printf
+	readonly then && x=1 grep sed 2>/dev/null export echo -eu 'quoted text' "$@"
+	-eu $(pwd) readonly printf | printf done 2>/dev/null
+		echo printf printf "$1"
+sed local 'quoted text' then export local -eu 'quoted text'
+		readonly test test x=1 -eu 'quoted text' local readonly sed
+/usr/bin sed $(pwd) local readonly grep test "$1" && "$1" "$1" x=1 done /usr/bin
+$(pwd) 'quoted text' cd && -eu export | sed
+--verbose done --verbose sed && /usr/bin test "$1" |
+		&& 2>/dev/null --verbose | $(pwd) 'quoted text' "$1" local
+		x=1 then "$@" 2>/dev/null awk
+$(pwd) /usr/bin 2>/dev/null printf
+	/usr/bin done && && "$@" --verbose printf "$@" x=1 -eu
+	readonly $(pwd) printf ${HOME} $(pwd) cd grep printf "$@" grep ${HOME} readonly
+		"$@" then --verbose -eu readonly | ${HOME} /usr/bin
+		test /usr/bin grep export x=1 --verbose
+		'quoted text' printf awk echo 'quoted text' 'quoted text' && cd && test $(pwd) then
+| ${HOME} awk "$@" --verbose "$1" && awk "$@" | readonly export then then $(pwd)
+then then test cd done $(pwd) printf
+	local done grep printf
+	x=1 local -eu 2>/dev/null /usr/bin done done /usr/bin ${HOME} test /usr/bin
+	local printf export | | local
+		readonly test && "$@" $(pwd) && grep x=1 printf | "$1" then && echo
+"$1" | awk test cd awk sed then && 2>/dev/null cd 2>/dev/null printf
+	/usr/bin printf export "$@" export --verbose | done done | $(pwd)
+	test grep cd awk awk && 2>/dev/null echo then echo readonly test
+		printf local export grep ${HOME} then x=1 2>/dev/null "$1" ${HOME} export sed 2>/dev/null
+		printf && && "$@" | /usr/bin then test | awk "$@"
+		${HOME} echo local test sed $(pwd)
+done then done export -eu export && then local -eu
+	echo test cd | x=1 'quoted text' $(pwd) ${HOME} awk "$1" /usr/bin && 2>/dev/null
+	readonly /usr/bin "$1"
+		local $(pwd) export grep cd --verbose printf
+export /usr/bin /usr/bin 2>/dev/null
+	sed --verbose /usr/bin && export echo 2>/dev/null --verbose local --verbose
+$(pwd) echo export $(pwd) awk -eu /usr/bin --verbose
+x=1 awk /usr/bin local 2>/dev/null readonly then
+sed && then awk "$@" "$1" local
+		'quoted text' 2>/dev/null local && cd "$1" /usr/bin /usr/bin "$@" printf
+		${HOME} cd 'quoted text' && grep local readonly ${HOME} sed echo sed
+		2>/dev/null then echo x=1 then awk cd "$1" $(pwd) x=1 "$@" test
+cd cd /usr/bin awk $(pwd) /usr/bin
+		${HOME} cd awk echo grep export
+-eu cd x=1 export grep ${HOME} --verbose -eu grep -eu done
+		grep done local | 2>/dev/null
+--verbose readonly sed "$@"
+		--verbose printf sed | export echo && "$@"
+	--verbose awk -eu done echo ${HOME} "$@" 'quoted text'
+	--verbose printf export local echo then
+"$@" sed ${HOME} then 'quoted text' ${HOME} && done sed 'quoted text'
+		-eu test export x=1 done cd local --verbose ${HOME} x=1 "$1" sed cd test
+		/usr/bin grep then x=1 "$1" ${HOME} --verbose "$@" 2>/dev/null /usr/bin
+--verbose cd export x=1 local x=1 awk --verbose --verbose -eu 2>/dev/null
+-eu x=1 && "$1" 2>/dev/null "$@" /usr/bin grep $(pwd)
+	"$@" 'quoted text' ${HOME} local x=1 cd awk printf echo ${HOME} awk 2>/dev/null
+	done printf done echo then --verbose
+test then /usr/bin then export grep test && | && awk
+		readonly -eu export $(pwd) && done x=1 awk printf then "$1" | then
+	"$@" printf 2>/dev/null
+done 2>/dev/null export sed -eu done ${HOME} "$1" done && -eu done
+local done awk x=1 local -eu "$@" ${HOME} | test
+	readonly ${HOME} local done "$1" | echo 'quoted text' local --verbose printf
+	${HOME} readonly awk --verbose /usr/bin
+		sed /usr/bin done grep test "$@" sed "$@" awk | "$1" grep
+printf | "$@" "$@" --verbose grep cd printf test
+		x=1 "$@" local 'quoted text'
+	2>/dev/null then cd export --verbose $(pwd)
+	readonly /usr/bin then "$@" printf echo /usr/bin test readonly local --verbose /usr/bin
+		--verbose ${HOME} printf --verbose then "$1" $(pwd) echo /usr/bin
+		awk 'quoted text' test test done then done awk local
+	awk "$1" $(pwd) $(pwd) export local "$@"
+		$(pwd) -eu awk printf local readonly grep cd -eu grep local then
+	awk x=1 awk --verbose 2>/dev/null
+	| x=1 cd readonly "$1" 'quoted text'
+"$1" done x=1 awk readonly grep export x=1 local "$1" awk
+	$(pwd) local ${HOME} then sed sed local
+"$1" local && -eu 'quoted text' 'quoted text' | 2>/dev/null | awk awk awk cd grep
+echo x=1 cd x=1 "$1" awk "$1" cd echo export $(pwd) test -eu | | readonly local
+	export 2>/dev/null x=1 | 2>/dev/null --verbose printf 2>/dev/null
+readonly 'quoted text' 2>/dev/null then 2>/dev/null
+cd cd --verbose && --verbose export && --verbose readonly then local awk
+'quoted text' local readonly export /usr/bin then done printf
+2>/dev/null done x=1 readonly && echo readonly
+	echo && -eu 2>/dev/null
+	'quoted text' export readonly "$@" --verbose awk cd --verbose
+		/usr/bin readonly $(pwd) export $(pwd) | sed ${HOME} -eu | test then && awk /usr/bin
+		echo sed x=1 ${HOME} && $(pwd) test x=1 printf readonly && grep grep local export
+readonly grep x=1 && 'quoted text' sed /usr/bin && test | printf echo ${HOME}
+		| --verbose then && then
+		| x=1 | --verbose "$1"
+'quoted text' readonly then grep
+"$@" && --verbose awk sed sed sed ${HOME}
+grep $(pwd) cd sed 'quoted text' /usr/bin echo && && echo awk cd ${HOME}
+sed sed test "$1" done &&
+	2>/dev/null 'quoted text' then sed cd -eu ${HOME}
+then && && readonly && done awk grep sed echo $(pwd) --verbose
+| $(pwd) cd 'quoted text' && 'quoted text' -eu $(pwd) export awk --verbose
+		2>/dev/null readonly printf 2>/dev/null $(pwd)
+done readonly -eu echo | --verbose sed then then printf && 'quoted text'
+		export x=1 && test awk && -eu cd
+readonly -eu -eu done cd printf echo test "$@" --verbose 'quoted text' 'quoted text'
+grep export printf export done | "$1" "$@" echo
+test local then /usr/bin test /usr/bin 'quoted text' then ${HOME} x=1 'quoted text'
+	sed $(pwd) echo test | sed | | sed $(pwd) printf grep test
+&& export export awk awk
+	&& "$@" | /usr/bin then sed echo && --verbose export -eu $(pwd) "$@" | --verbose
+		'quoted text' "$@" "$1" --verbose "$@" readonly --verbose cd printf test
+		echo export /usr/bin export $(pwd)
+		&& readonly grep $(pwd) readonly
+then done "$@" -eu readonly then echo | readonly local readonly test &&
+/usr/bin echo cd --verbose grep $(pwd) then sed sed $(pwd) --verbose "$1"
+	/usr/bin --verbose local local readonly test grep
+&& -eu 2>/dev/null sed then printf test echo /usr/bin then 'quoted text'
+done "$@" readonly "$@" 'quoted text' test "$@" local && --verbose
+		printf /usr/bin 2>/dev/null readonly x=1 x=1 test && |
+local cd ${HOME} sed --verbose -eu grep
+	--verbose -eu local ${HOME} -eu $(pwd) then printf awk 2>/dev/null
+	"$@" echo sed 'quoted text' && 2>/dev/null readonly echo 'quoted text' "$1"
+--verbose sed local $(pwd) echo local "$1" echo ${HOME}
+export sed | local cd | --verbose test cd "$@" echo 2>/dev/null
+		${HOME} grep x=1 then awk test /usr/bin /usr/bin x=1
+	-eu 'quoted text' grep "$1" 2>/dev/null --verbose "$1"
+		${HOME} ${HOME} local --verbose
+		'quoted text' $(pwd) x=1 'quoted text' printf -eu "$1" then -eu
+	sed "$@" 'quoted text' && | printf echo
+		sed /usr/bin echo /usr/bin readonly x=1 "$@"
+printf grep ${HOME} cd ${HOME} --verbose $(pwd) "$1" readonly ${HOME}
+		2>/dev/null local sed | "$1" /usr/bin printf -eu test
+	&& export 2>/dev/null -eu -eu && cd && --verbose
+	cd printf printf local
+--verbose 'quoted text' printf
+&& /usr/bin $(pwd) awk $(pwd) -eu /usr/bin && 'quoted text' | "$1" readonly 2>/dev/null
+	-eu readonly --verbose grep /usr/bin | then x=1 sed awk then grep
+		echo test ${HOME} /usr/bin
+$(pwd) | 2>/dev/null 'quoted text' local /usr/bin sed grep awk -eu "$@" $(pwd)
+"$@" -eu | --verbose -eu then && readonly cd /usr/bin readonly local
+	sed ${HOME} "$1" echo sed "$@" "$1" echo -eu test "$1" ${HOME} | "$1" local
+--verbose 'quoted text' cd test "$1" echo --verbose
+		&& test "$1" "$@" local
+	readonly sed printf test "$1" -eu "$1" grep 'quoted text' -eu | $(pwd) $(pwd)
+printf && --verbose done grep
+		$(pwd) export export $(pwd) 2>/dev/null "$@" x=1 $(pwd) "$1" cd local
+x=1 && | "$@" $(pwd) x=1 export test grep "$1" test $(pwd) test grep sed done
+	"$@" x=1 printf | export then then "$1" printf && grep "$1" sed -eu -eu sed
+	${HOME} 2>/dev/null awk ${HOME}
+		--verbose local --verbose x=1
+	awk echo awk ${HOME} 'quoted text' export 'quoted text' "$@" x=1 && "$@" awk
+	-eu -eu awk -eu 'quoted text' local
+$(pwd) ${HOME} --verbose 2>/dev/null
+		'quoted text' then x=1 --verbose | /usr/bin done test awk
+cd && | local "$1" done awk export grep printf $(pwd) test
+cd ${HOME} printf 'quoted text' readonly 2>/dev/null | done --verbose "$1"
+	grep && && awk echo local readonly ${HOME} ${HOME} "$1" --verbose
+export | $(pwd) local "$@" echo
+	readonly echo test "$@" readonly
+x=1 -eu -eu ${HOME} sed | $(pwd) "$1" && readonly -eu 'quoted text'
+		export export 2>/dev/null && readonly x=1 local "$@" local
+grep "$1" ${HOME} test test /usr/bin local echo done
+export $(pwd) x=1 cd test cd cd -eu ${HOME} -eu /usr/bin "$1"
+		$(pwd) x=1 done /usr/bin echo 2>/dev/null $(pwd) printf then awk grep export
+		test ${HOME} grep grep -eu readonly printf done echo
+readonly | awk /usr/bin $(pwd) 2>/dev/null
+		readonly $(pwd) echo readonly readonly "$@" ${HOME} readonly && --verbose
+		local $(pwd) | --verbose 'quoted text' printf done
+		2>/dev/null | readonly /usr/bin done x=1 then sed --verbose | 2>/dev/null
+cd 'quoted text' 'quoted text' printf awk test 2>/dev/null
+	done | --verbose 'quoted text' "$@" echo cd cd $(pwd) test printf grep done
+/usr/bin 'quoted text' "$@" readonly then echo --verbose done | test
+| echo local && 2>/dev/null cd grep --verbose
+		--verbose "$@" $(pwd) ${HOME} printf -eu x=1 echo -eu 'quoted text' | --verbose
+		sed 2>/dev/null test sed 2>/dev/null && test $(pwd) sed && cd cd export && local
+/usr/bin && export /usr/bin ${HOME} sed sed cd
+	--verbose then printf sed "$1" 2>/dev/null "$1" -eu "$1" 2>/dev/null
+2>/dev/null -eu printf test --verbose printf cd /usr/bin cd sed x=1 test awk &&
+		2>/dev/null local cd echo awk "$@" -eu export
+		/usr/bin printf ${HOME}
+/usr/bin export "$1" awk cd --verbose | echo "$1"
+		done grep /usr/bin ${HOME} --verbose
+	"$@" awk "$1" grep "$@" 2>/dev/null done done grep cd "$1" ${HOME} printf readonly
+		-eu $(pwd) 2>/dev/null -eu && "$1"
+		printf readonly test export ${HOME} | "$1" sed sed "$@" | done awk grep
+		"$1" cd done -eu $(pwd) | awk grep x=1 /usr/bin export
+	local grep export | $(pwd) 'quoted text' cd 2>/dev/null --verbose
+awk printf | && 2>/dev/null -eu /usr/bin /usr/bin export echo
+		printf local "$@" 2>/dev/null --verbose local cd export &&
+| $(pwd) readonly 2>/dev/null echo export "$1" "$@" && cd |
+	sed done 'quoted text' echo --verbose $(pwd) cd | "$1" printf x=1 /usr/bin
+		"$1" cd && then 2>/dev/null "$1" cd $(pwd) x=1 readonly 'quoted text'
+	echo grep grep && $(pwd) /usr/bin done && ${HOME} cd -eu done $(pwd) export
+		test sed && 'quoted text' then
+sed export awk "$@" 2>/dev/null printf
+		export "$1" done readonly then ${HOME} /usr/bin
+	x=1 printf cd sed /usr/bin | --verbose 'quoted text' export ${HOME} &&
+	&& done printf /usr/bin $(pwd) then printf |
+	echo readonly x=1 -eu "$@" && "$@" 2>/dev/null -eu
+	--verbose grep local -eu | --verbose "$1" export then sed echo 2>/dev/null
+	$(pwd) awk printf $(pwd) cd done cd printf
+		'quoted text' "$1" test echo test 2>/dev/null 2>/dev/null sed then cd test
+		--verbose | test awk test test cd sed
+		printf 'quoted text' $(pwd) -eu $(pwd) x=1 readonly printf
+		${HOME} awk done x=1 grep sed "$1" $(pwd) /usr/bin then test awk $(pwd)
+	local 2>/dev/null 'quoted text' "$@" awk done cd 'quoted text' grep sed export
+		$(pwd) then sed done awk
+echo -eu $(pwd) grep echo export | "$1" then then sed /usr/bin
+		test readonly "$1" "$@" --verbose
+		grep /usr/bin test --verbose "$1" /usr/bin test x=1 printf sed "$1"
+${HOME} grep readonly -eu -eu awk
+		awk /usr/bin 2>/dev/null 2>/dev/null -eu export test $(pwd) export sed
+		grep $(pwd) 'quoted text' -eu -eu done 2>/dev/null
+	${HOME} $(pwd) grep "$@"
+	local x=1 2>/dev/null
+echo "$1" awk --verbose printf 2>/dev/null
+"$@" 'quoted text' ${HOME} then "$1" then done x=1 x=1 then echo grep
+printf x=1 ${HOME} ${HOME} test sed x=1 grep awk --verbose cd
@@ -0,0 +1,2001 @@
+		sed --verbose | sed grep x=1 then "$@" grep ${HOME} -eu "$@"
+		/usr/bin done "$1" export
+	awk && then awk done 2>/dev/null done
+done local /usr/bin local export
+local echo 2>/dev/null /usr/bin ${HOME} sed
+		echo /usr/bin "$@" -eu
+echo 'quoted text' $(pwd) --verbose /usr/bin
+	x=1 --verbose "$@" $(pwd) readonly
+		x=1 x=1 "$1" "$1" readonly
+		/usr/bin export printf sed | readonly
+		-eu | test test "$1" ${HOME} awk
+	echo && && readonly then 'quoted text' readonly local ${HOME} readonly
+		--verbose "$1" && --verbose --verbose printf echo x=1 | local | -eu local
+	printf 2>/dev/null done done --verbose echo -eu readonly export -eu awk sed
+	printf "$1" "$@" done x=1 readonly
+	awk test 2>/dev/null test sed "$@"
+"$1" /usr/bin then readonly 2>/dev/null
+		awk awk cd --verbose echo ${HOME} then local 'quoted text'
+	local 'quoted text' printf 2>/dev/null && | 2>/dev/null readonly -eu echo
+		${HOME} "$1" grep awk echo "$@" "$1" /usr/bin
+		cd local awk done 'quoted text'
+		--verbose grep 'quoted text' grep "$@" x=1 sed $(pwd) local
+		printf local echo printf
+		readonly -eu export /usr/bin export done "$1"
+	'quoted text' readonly x=1 --verbose /usr/bin readonly
+		done x=1 --verbose ${HOME} "$1" local then $(pwd) ${HOME}
+/usr/bin done "$@" printf && printf /usr/bin awk local | x=1 cd --verbose
+		grep 'quoted text' then && readonly && /usr/bin 2>/dev/null
+		awk "$@" && && local x=1 test grep echo cd cd echo local 2>/dev/null
+		cd export then /usr/bin "$1" 2>/dev/null done "$1" test then local /usr/bin then
+		/usr/bin ${HOME} 'quoted text'
+${HOME} $(pwd) done grep -eu printf
+then local export test
+"$@" --verbose sed readonly printf $(pwd) grep "$@"
+grep /usr/bin "$@" readonly then -eu cd -eu 2>/dev/null
+		"$1" | && /usr/bin test 'quoted text'
+		${HOME} cd --verbose done readonly
+		then test ${HOME} test grep awk /usr/bin cd ${HOME} sed
+/usr/bin then awk export 'quoted text' export
+2>/dev/null export test export test x=1 && 2>/dev/null
+		test x=1 -eu 'quoted text'
+readonly | /usr/bin -eu --verbose test | $(pwd)
+	--verbose -eu grep awk grep readonly $(pwd) export && test && export sed
+	"$@" "$@" --verbose test "$@" $(pwd) $(pwd) x=1 echo -eu sed 'quoted text'
+| done export | done export /usr/bin | export | then "$1" done
+		readonly cd cd $(pwd) --verbose
+	awk x=1 && "$1" test --verbose ${HOME}
+		${HOME} test printf sed $(pwd) "$1" test ${HOME} "$@" readonly
+		x=1 cd export awk --verbose x=1 --verbose x=1 /usr/bin -eu
+printf grep printf done "$@" ${HOME} | export ${HOME}
+	&& grep && $(pwd) done && 2>/dev/null local echo then echo
+		export | local x=1 sed awk x=1 done $(pwd) export sed "$1" cd "$@"
+		'quoted text' local grep printf -eu test then /usr/bin 'quoted text'
+		--verbose x=1 awk done && printf awk && test echo test
+		| /usr/bin awk export test readonly x=1 awk test 'quoted text'
+	export cd echo | ${HOME} | echo ${HOME} echo 'quoted text' $(pwd) export
+		grep -eu "$@" cd cd | then
+		x=1 ${HOME} printf export $(pwd) "$1" echo readonly | awk readonly
+| ${HOME} 'quoted text'
+		then done export test printf cd | 'quoted text'
+		awk sed "$1" done "$1" x=1 awk export sed /usr/bin readonly /usr/bin "$@"
+		$(pwd) cd local -eu ${HOME} test export && | awk 2>/dev/null
+	--verbose ${HOME} x=1 then readonly
+	test awk $(pwd) && ${HOME} readonly test test local cd "$1" -eu readonly sed printf
+	&& ${HOME} grep "$1" awk export -eu /usr/bin cd echo
+&& $(pwd) local local 'quoted text' x=1 export local /usr/bin
+		grep readonly test then | then sed sed then sed printf && done done
+		readonly x=1 test then $(pwd) awk done
+| ${HOME} ${HOME} | echo && printf awk awk 'quoted text' 'quoted text'
+	"$@" test awk "$1" && "$@" "$@" then grep cd 'quoted text'
+grep 2>/dev/null && -eu export --verbose --verbose
+awk cd --verbose then --verbose 'quoted text'
+	test echo sed sed awk then cd /usr/bin sed x=1 ${HOME}
+"$1" 2>/dev/null "$@" -eu "$1"
+		${HOME} "$1" export "$1" echo
+		${HOME} export "$@" "$@" $(pwd)
+grep echo done done ${HOME}
+		| cd "$1" sed /usr/bin 2>/dev/null /usr/bin grep local x=1 grep --verbose
+	| export awk awk /usr/bin && then test 'quoted text' /usr/bin
+		2>/dev/null echo "$@" then test x=1 /usr/bin done readonly echo
+		readonly "$@" local ${HOME} local grep
+	printf export readonly $(pwd) 'quoted text'
+	cd -eu && export echo -eu --verbose
+	grep "$@" awk x=1 local /usr/bin $(pwd) readonly "$1" grep 'quoted text' ${HOME}
+		'quoted text' sed x=1 local
+		"$@" local sed --verbose ${HOME} x=1
+		sed then $(pwd) ${HOME} | export test ${HOME} grep /usr/bin /usr/bin export test
+	local test readonly -eu grep
+	-eu readonly $(pwd) $(pwd) printf "$@" export "$@" | -eu readonly "$@" && "$1"
+		then "$@" grep test $(pwd) x=1 ${HOME}
+export $(pwd) --verbose "$1" test &&
+	$(pwd) -eu 'quoted text' --verbose
+		"$@" ${HOME} x=1 2>/dev/null | export --verbose -eu "$1" done export awk
+		| export echo grep export export export ${HOME} then 'quoted text'
+		then printf printf $(pwd) export && "$@" cd
+	sed then --verbose cd --verbose cd local echo ${HOME} printf local
+${HOME} done --verbose $(pwd) 2>/dev/null 2>/dev/null
+$(pwd) grep echo grep cd done "$@" test cd 2>/dev/null
+	test local awk done awk ${HOME} && export | &&
+local 'quoted text' cd local /usr/bin $(pwd) 2>/dev/null
+		grep export echo "$@" | 2>/dev/null
+	"$1" local awk done "$1" cd x=1 "$@" awk ${HOME} 'quoted text' printf
+	2>/dev/null sed 2>/dev/null readonly awk --verbose awk
+	-eu -eu -eu awk sed -eu && --verbose local cd 'quoted text' grep done "$1" done
+	grep local /usr/bin test ${HOME} echo | "$1" awk && export "$@" "$1" && test |
+		local $(pwd) awk grep /usr/bin /usr/bin then ${HOME} --verbose x=1
+	local echo awk /usr/bin done /usr/bin ${HOME}
+	printf cd awk done export echo sed cd
+${HOME} grep /usr/bin cd test grep cd grep $(pwd) ${HOME} readonly
+sed grep -eu awk -eu test x=1 $(pwd) done awk $(pwd) -eu test
+		test -eu "$1" printf 2>/dev/null grep sed export export "$@" sed "$@"
+		-eu cd test "$@" awk echo $(pwd) "$@" cd cd "$@"
+	then cd | $(pwd) echo echo 'quoted text' x=1 printf
+		test --verbose | readonly printf -eu x=1 awk cd
+	&& sed grep && -eu grep awk done ${HOME}
+readonly ${HOME} awk 'quoted text' cd test done printf printf
+		local local readonly $(pwd) grep grep cd x=1 | local echo $(pwd) local
+	awk ${HOME} sed 2>/dev/null sed
+	awk -eu 'quoted text' 'quoted text' --verbose ${HOME} echo cd && grep
+-eu local done "$@" printf then echo
+test /usr/bin awk "$1" 2>/dev/null grep local
+	/usr/bin x=1 && --verbose local x=1 test cd
+printf printf printf export local 'quoted text' export $(pwd)
+		then echo | | printf "$@" readonly 'quoted text'
+2>/dev/null "$@" grep readonly
+/usr/bin echo -eu | then then | awk printf
+	/usr/bin grep /usr/bin ${HOME} readonly &&
+grep --verbose 2>/dev/null then grep printf
+		grep then "$@" --verbose done
+	grep ${HOME} cd | 2>/dev/null
+	local awk $(pwd) -eu echo export awk x=1 'quoted text' ${HOME} --verbose ${HOME}
+	-eu --verbose printf --verbose && cd export then then echo done "$1"
+	echo 2>/dev/null && grep | test -eu "$@" export awk export 'quoted text'
+		local local cd && 2>/dev/null done awk
+	x=1 | readonly test then 'quoted text' export cd printf then | readonly
+	${HOME} && "$@" sed awk then cd test 'quoted text'
+printf "$@" cd cd cd $(pwd) $(pwd) grep
+		&& $(pwd) && grep export | x=1
+	"$@" x=1 'quoted text' 'quoted text' --verbose readonly /usr/bin
+${HOME} test sed -eu "$1" /usr/bin 'quoted text' &&
+done -eu "$1" x=1 echo echo awk 2>/dev/null -eu ${HOME} x=1 'quoted text' && sed
+	test then local then awk 2>/dev/null
+	then "$1" --verbose --verbose sed readonly | printf "$@" readonly printf
+sed readonly | "$@" done /usr/bin printf awk /usr/bin readonly -eu local echo
+	export "$1" printf then sed test $(pwd) then 2>/dev/null
+	/usr/bin 2>/dev/null $(pwd) sed "$1" echo done -eu printf /usr/bin
+		'quoted text' awk x=1 && 'quoted text' /usr/bin 2>/dev/null
+readonly x=1 -eu cd local export && "$1" printf awk
+	printf 'quoted text' awk grep "$1" sed printf
+	2>/dev/null then --verbose cd printf ${HOME} printf then then | $(pwd)
+	${HOME} ${HOME} && printf echo then echo export x=1 /usr/bin then printf 'quoted text'
+${HOME} "$1" grep awk ${HOME} then --verbose "$1" local echo
+		| echo done export && echo
+		"$1" && 'quoted text' grep test awk test readonly echo sed awk $(pwd) export
+--verbose export 'quoted text' /usr/bin
+sed "$@" test x=1 grep awk echo x=1 printf readonly /usr/bin
+"$@" --verbose printf --verbose cd ${HOME} &&
+		&& echo "$1" && then awk -eu done export "$@" x=1 /usr/bin cd test /usr/bin
+	sed $(pwd) test readonly | "$@" "$@" x=1 $(pwd)
+		awk x=1 export 2>/dev/null then test test "$@" /usr/bin "$@" && test
+then test | then ${HOME} /usr/bin cd readonly cd
+		| sed ${HOME} cd ${HOME} 'quoted text' 'quoted text' 2>/dev/null --verbose
+	x=1 2>/dev/null readonly export && 'quoted text' local
+	local "$1" 2>/dev/null test test ${HOME}
+then printf local awk /usr/bin printf sed local "$1" export $(pwd)
+${HOME} echo printf sed --verbose && export awk printf printf local $(pwd)
+printf grep 'quoted text' x=1 local ${HOME} 2>/dev/null
+	echo 'quoted text' printf grep then 2>/dev/null local 'quoted text'
+	cd readonly x=1 --verbose x=1 done then test local echo
+readonly 2>/dev/null echo test && readonly grep -eu
+		sed test local readonly "$1"
+test echo && done readonly 'quoted text'
+	export "$@" -eu test sed local --verbose ${HOME} export local && done 'quoted text'
+	${HOME} printf x=1 'quoted text' /usr/bin readonly test "$@" ${HOME} "$@" $(pwd)
+		${HOME} readonly echo grep ${HOME} "$1" 'quoted text' cd && --verbose
+		2>/dev/null test local done $(pwd) 'quoted text' x=1 readonly then ${HOME}
+	/usr/bin local then sed grep echo
+then "$1" /usr/bin sed readonly && &&
+sed cd awk -eu readonly export ${HOME} "$1" "$1" $(pwd) 2>/dev/null
+--verbose cd $(pwd) ${HOME} --verbose
+		cd 2>/dev/null -eu grep sed cd grep then "$1"
+		grep awk awk "$1" readonly test local x=1 test sed
+	"$1" sed test --verbose && "$1" ${HOME} readonly local $(pwd) && "$1"
+		--verbose 2>/dev/null test --verbose export /usr/bin 'quoted text' x=1 readonly
+	${HOME} awk | local x=1
+$(pwd) 2>/dev/null --verbose 'quoted text' local | ${HOME} awk echo &&
+		grep --verbose grep -eu export sed export -eu ${HOME}
+test | readonly sed | echo x=1
+	local readonly $(pwd) -eu ${HOME} $(pwd)
+		/usr/bin sed sed test readonly local then 2>/dev/null x=1 readonly
+	"$@" export | "$@" grep printf $(pwd) test readonly
+then readonly -eu $(pwd) 'quoted text' | test $(pwd) done
+	local ${HOME} x=1 awk grep ${HOME}
+	2>/dev/null readonly echo readonly readonly test | echo /usr/bin
+	/usr/bin | readonly "$@" test cd done 'quoted text' grep -eu printf
+	cd $(pwd) local | | awk && | "$1" cd awk test && cd
+	readonly ${HOME} x=1 2>/dev/null echo awk -eu "$@" printf -eu grep export
+	awk done sed "$1" "$1" printf
+		grep cd -eu readonly local | then ${HOME} ${HOME} test done | sed -eu
+	cd cd 2>/dev/null --verbose | then awk 'quoted text'
+		"$@" sed test grep 2>/dev/null 2>/dev/null
+echo echo --verbose awk $(pwd) "$1" echo "$@" local
+	-eu /usr/bin "$1" export cd --verbose
+	'quoted text' grep readonly "$@" sed then 'quoted text'
+		printf done export grep "$1" export readonly local 'quoted text' local -eu printf
+	"$@" ${HOME} then awk sed done -eu then cd ${HOME} sed "$1" ${HOME}
+		/usr/bin 2>/dev/null 2>/dev/null x=1 /usr/bin export
+	export 2>/dev/null done /usr/bin export --verbose cd readonly printf 'quoted text'
+	printf && local echo
+	export awk | echo printf "$@" |
+	test "$1" x=1 /usr/bin "$1" -eu readonly
+${HOME} readonly /usr/bin local grep -eu grep --verbose readonly test awk readonly
+2>/dev/null "$1" $(pwd) && 2>/dev/null sed ${HOME}
+readonly 'quoted text' | -eu "$@" export
+	'quoted text' | awk -eu 2>/dev/null 2>/dev/null
+		--verbose printf export
+	done grep --verbose x=1 test then | echo
+		local export echo awk readonly grep done 2>/dev/null export done grep local
+		grep export awk "$1" readonly --verbose x=1 'quoted text'
+		export grep -eu local
+	test && "$1" grep -eu printf && readonly cd "$@"
+local cd cd cd "$@" ${HOME} &&
+	/usr/bin readonly test /usr/bin local "$1" export printf "$1" x=1 /usr/bin
+	| done sed --verbose | x=1 "$1" test /usr/bin $(pwd) /usr/bin /usr/bin
+		done && awk && echo | test "$@" cd printf "$@" printf test x=1 sed
+		"$@" export cd export x=1 grep ${HOME} sed grep 'quoted text'
+	--verbose "$@" echo | sed
+		"$1" | printf echo --verbose
+		| done -eu "$@" awk export test | --verbose grep printf ${HOME}
+	grep echo && x=1 ${HOME} -eu && export local
+	x=1 then cd then local done x=1 ${HOME} 2>/dev/null then
+		"$1" --verbose 'quoted text' test /usr/bin --verbose echo
+		$(pwd) test "$1" local
+		awk 'quoted text' x=1 | awk local test
+printf echo grep | grep 'quoted text' x=1 "$@" 2>/dev/null
+		export /usr/bin export done &&
+	grep ${HOME} grep 'quoted text' "$1" x=1 "$@" readonly
+'quoted text' awk "$@" --verbose echo | ${HOME} cd printf
+-eu export then --verbose /usr/bin then local printf | /usr/bin readonly
+		/usr/bin sed printf ${HOME} ${HOME}
+		done export x=1 readonly 'quoted text' $(pwd)
+	| && -eu $(pwd) echo "$1" x=1 printf then --verbose && 'quoted text' done && readonly
+done awk 2>/dev/null 'quoted text'
+"$@" /usr/bin readonly ${HOME} "$1" test then x=1 test | then
+		${HOME} "$1" 'quoted text' then "$1" awk then echo ${HOME} x=1
+		awk export test test then echo readonly && ${HOME} 2>/dev/null
+		echo --verbose test | ${HOME} 'quoted text'
+--verbose 2>/dev/null awk readonly
+	$(pwd) 2>/dev/null then local 'quoted text'
+	cd done readonly readonly x=1
+	test "$@" export cd printf -eu awk readonly readonly grep
+		/usr/bin | && sed "$1" x=1 ${HOME} ${HOME}
+		-eu printf $(pwd) && x=1 /usr/bin test local | echo done
+		sed 'quoted text' "$1" grep echo printf ${HOME} 2>/dev/null ${HOME} awk
+	test then local /usr/bin -eu -eu | | "$@" 2>/dev/null readonly cd readonly
+	echo printf grep x=1 awk ${HOME} --verbose /usr/bin 'quoted text'
+| readonly readonly local "$@" readonly -eu "$1" printf echo then export
+		grep sed export cd ${HOME} x=1 echo
+		cd echo done done sed echo local echo local export $(pwd) --verbose
+	test 'quoted text' --verbose 'quoted text'
+$(pwd) --verbose -eu export echo "$@" && cd echo -eu echo export grep 'quoted text'
+		2>/dev/null "$1" 'quoted text' /usr/bin local && | readonly
+${HOME} sed && sed ${HOME} | -eu x=1
+awk x=1 local /usr/bin grep ${HOME} then "$@" echo x=1 --verbose --verbose
+	-eu "$@" local "$1" local && |
+		export local 'quoted text' test awk /usr/bin
+	done then readonly "$@" done --verbose $(pwd) 'quoted text' x=1
+		export --verbose --verbose sed ${HOME}
+'quoted text' cd readonly "$1" cd -eu -eu -eu "$1" cd $(pwd) --verbose then
+		export cd awk ${HOME} sed echo done 2>/dev/null 'quoted text' export --verbose
+	2>/dev/null test $(pwd) 2>/dev/null readonly then test cd "$1" awk
+	readonly $(pwd) done readonly && local
+		sed local "$@" x=1 sed test /usr/bin grep $(pwd)
+		echo local /usr/bin export
+	test echo | echo 'quoted text' -eu printf export /usr/bin
+	echo "$@" echo local sed
+	--verbose 'quoted text'
+	&& $(pwd) && printf test $(pwd) 'quoted text' 2>/dev/null grep cd $(pwd)
+		'quoted text' cd -eu local x=1 /usr/bin test ${HOME} cd |
+awk && && then ${HOME} local
+		sed test /usr/bin sed --verbose
+		&& sed "$@" test 2>/dev/null -eu | echo $(pwd) -eu
+sed $(pwd) | local --verbose export "$@" awk then printf "$@" sed
+${HOME} local "$@" grep $(pwd) echo printf
+		&& $(pwd) ${HOME} done && export "$1" -eu ${HOME} ${HOME}
+		'quoted text' "$@" test --verbose
+test /usr/bin readonly &&
+		cd && && && echo | printf sed test 'quoted text' 2>/dev/null
+"$@" cd "$@" local test export | awk printf | awk "$1" x=1 test --verbose /usr/bin
+	--verbose done && 2>/dev/null awk echo && "$@" then
+&& then test 'quoted text' done cd local test done --verbose | --verbose
+	"$1" -eu sed then x=1 "$1" "$@" 'quoted text' done sed && && grep
+		/usr/bin export "$1" -eu echo "$1"
+		local done ${HOME} echo
+		test -eu x=1 then $(pwd) then readonly $(pwd)
+printf readonly "$@" test $(pwd)
+$(pwd) test grep 'quoted text' readonly |
+then sed | export x=1 then then sed /usr/bin printf "$1" cd done cd
+cd grep ${HOME} --verbose "$1" readonly cd
+"$@" $(pwd) ${HOME} grep ${HOME} 'quoted text' sed
+		local echo "$@" echo awk readonly cd then export $(pwd) test
+		-eu cd "$@" "$@" "$@" --verbose && "$1" "$@" local export
+		| --verbose cd then then | cd | done x=1 grep -eu export then --verbose x=1
+done "$1" printf awk 2>/dev/null cd "$1"
+cd --verbose 'quoted text' | printf readonly test &&
+		&& -eu --verbose sed --verbose | grep --verbose | | export export "$1" "$1" echo
+	then -eu awk export grep
+	/usr/bin grep echo x=1 |
+| --verbose -eu test then then 2>/dev/null then
+	$(pwd) then ${HOME} x=1 local | -eu cd -eu grep --verbose "$@" awk echo echo sed
+		'quoted text' "$@" ${HOME} then then echo
+printf x=1 2>/dev/null echo | "$@" grep local ${HOME} printf export
+		local readonly sed ${HOME} x=1 "$1" sed && sed readonly local done 'quoted text'
+	cd -eu "$@" then 'quoted text' awk | awk test
+	-eu "$@" /usr/bin test
+		&& "$@" test then /usr/bin export
+done 'quoted text' awk | /usr/bin
+done done "$@" /usr/bin test $(pwd) local then "$@" /usr/bin then
+		2>/dev/null "$1" sed echo grep
+	x=1 printf "$1" local awk 'quoted text' | --verbose cd ${HOME}
+-eu x=1 sed awk test printf "$@"
+	2>/dev/null x=1 2>/dev/null grep printf
+x=1 2>/dev/null readonly local test echo 2>/dev/null export ${HOME} --verbose
+printf 2>/dev/null 2>/dev/null $(pwd) x=1 grep $(pwd)
+		grep 'quoted text' /usr/bin "$@" readonly printf 'quoted text'
+		| local cd "$1" done then
+export sed && $(pwd) | | $(pwd) done awk
+	--verbose /usr/bin grep done echo
+		$(pwd) ${HOME} -eu grep
+readonly done export local readonly cd test ${HOME} awk 2>/dev/null
+readonly "$@" cd $(pwd)
+readonly "$1" local readonly | --verbose
+	then then export printf
+--verbose awk 2>/dev/null "$1" local &&
+	test /usr/bin 'quoted text' export
+	printf done sed -eu export "$@" test test
+"$@" x=1 "$@" sed x=1 echo && && && && test "$@" $(pwd)
+	$(pwd) printf 'quoted text' --verbose | --verbose
+		--verbose "$1" grep 'quoted text' -eu export test 2>/dev/null
+	"$@" -eu 2>/dev/null readonly cd && "$@" grep sed done $(pwd) "$@"
+		${HOME} export 'quoted text' $(pwd) echo ${HOME}
+done done done echo sed printf readonly awk $(pwd) local
+done readonly then sed "$@" readonly printf then
+	local awk grep | /usr/bin && local grep $(pwd) 2>/dev/null "$@"
+		export grep "$1" done ${HOME} x=1 2>/dev/null export printf
+	echo done 'quoted text' echo then | $(pwd)
+		printf --verbose cd && cd awk readonly ${HOME} grep | sed then
+done x=1 && x=1 'quoted text' --verbose x=1 /usr/bin echo awk then
+	test local echo "$@" | $(pwd) echo | local sed cd | done 'quoted text'
+readonly readonly local
+&& local local done "$@" /usr/bin grep 'quoted text' sed "$1" test
+	then "$1" 2>/dev/null |
+		'quoted text' ${HOME} test && awk local test 'quoted text' 'quoted text' readonly
+	cd $(pwd) && x=1 echo x=1 test
+		-eu awk "$@" then then $(pwd) $(pwd) ${HOME} /usr/bin awk
+done 2>/dev/null 'quoted text'
+/usr/bin export printf | x=1 grep && 'quoted text' grep "$1" |
+	--verbose local && then awk "$1" $(pwd) done awk then | then
+	/usr/bin "$1" ${HOME} printf -eu && x=1 && 'quoted text' ${HOME} then && 2>/dev/null
+echo local 2>/dev/null 'quoted text' "$@" awk export x=1
+	| 2>/dev/null 2>/dev/null
+	awk "$1" --verbose | x=1 "$1"
+'quoted text' $(pwd) readonly /usr/bin done x=1 | --verbose
+		test "$@" x=1 test /usr/bin sed local then done 2>/dev/null && $(pwd) readonly
+	"$1" /usr/bin 'quoted text' "$1" && --verbose printf
+		| && "$@" && grep then sed printf
+"$1" && test export "$1" "$1" sed grep then echo "$1"
+		done 'quoted text' x=1 | --verbose | awk
+then 'quoted text' 'quoted text' grep -eu echo grep
+		-eu printf grep test 'quoted text' done -eu 'quoted text' then
+&& /usr/bin then /usr/bin done -eu | export readonly done
+local local && then x=1 && && awk 'quoted text' sed x=1 "$1" && cd "$1" done sed
+		&& $(pwd) -eu /usr/bin /usr/bin --verbose "$@" x=1 --verbose
+x=1 -eu "$1" done "$1" /usr/bin $(pwd) done -eu sed ${HOME} | test then
+		sed 'quoted text' 'quoted text' test --verbose
+		awk printf echo then && grep -eu readonly
+	/usr/bin then awk readonly /usr/bin | $(pwd) printf 2>/dev/null
+sed 'quoted text' done "$@" grep
+export | awk done && then grep grep 2>/dev/null "$@" then
+grep printf x=1 $(pwd) echo "$@" done local sed test then readonly done
+		2>/dev/null done /usr/bin test grep grep /usr/bin --verbose readonly cd x=1
+	-eu "$@" 2>/dev/null x=1 2>/dev/null
+echo "$1" | printf && $(pwd) "$@" readonly
+sed local local x=1 then 2>/dev/null "$1"
+$(pwd) 'quoted text' $(pwd) echo 2>/dev/null local 'quoted text' awk sed printf
+		readonly x=1 $(pwd) "$@" "$1" local && export echo awk grep ${HOME} x=1
+		/usr/bin 2>/dev/null 'quoted text' 2>/dev/null 'quoted text'
+		$(pwd) echo echo test "$1" "$1" $(pwd) sed local --verbose awk 'quoted text'
+	then awk printf sed local 'quoted text' cd
+	| x=1 ${HOME} grep printf -eu && --verbose 2>/dev/null 2>/dev/null cd echo
+/usr/bin --verbose "$@" 2>/dev/null cd awk then echo ${HOME} 'quoted text'
+		local then "$@" 'quoted text' awk /usr/bin
+		then cd && awk x=1 export then cd | /usr/bin echo cd
+	/usr/bin cd sed "$1" local sed --verbose ${HOME} done echo readonly
+done /usr/bin local $(pwd) sed export
+"$1" ${HOME} 2>/dev/null x=1 sed local
+export test 2>/dev/null /usr/bin printf
+grep then grep then 2>/dev/null $(pwd) --verbose "$@"
+local grep local && 'quoted text' $(pwd) readonly "$@"
+	-eu --verbose awk 2>/dev/null grep done x=1 /usr/bin export ${HOME} && then "$@"
+	&& cd local "$@" 2>/dev/null readonly --verbose
+		awk $(pwd) 'quoted text' "$1" sed sed 2>/dev/null --verbose local then && done
+		${HOME} $(pwd) "$1" done
+	test --verbose cd "$1" /usr/bin $(pwd) grep cd && grep && local export
+cd /usr/bin 'quoted text' printf --verbose
+export cd --verbose awk readonly $(pwd) cd "$@" ${HOME} sed
+		--verbose "$1" readonly "$@" test $(pwd) $(pwd) echo $(pwd) grep "$@"
+	cd export echo $(pwd) --verbose
+	grep echo echo done x=1 $(pwd)
+		| x=1 ${HOME} cd local awk grep -eu
+		readonly | printf done "$@" -eu && sed done ${HOME} then test
+		&& -eu 'quoted text' ${HOME} 2>/dev/null then done && $(pwd) --verbose
+"$1" test grep $(pwd)
+x=1 then --verbose printf readonly /usr/bin x=1 readonly cd "$1" local "$1" 'quoted text'
+		$(pwd) x=1 awk "$@" && export && ${HOME} --verbose local ${HOME}
+	$(pwd) echo | awk 2>/dev/null export x=1 cd printf awk readonly done local sed
+${HOME} readonly "$1" awk printf && export printf
+--verbose && $(pwd) sed 2>/dev/null
+	2>/dev/null then echo x=1 done /usr/bin echo awk x=1 export
+test --verbose 'quoted text' | done export | export sed /usr/bin done
+then ${HOME} awk && $(pwd) export --verbose -eu 2>/dev/null /usr/bin
+	readonly /usr/bin printf printf sed awk test then readonly awk "$1"
+		local -eu cd awk readonly awk 2>/dev/null grep && ${HOME}
+test x=1 cd "$@" awk done ${HOME} grep
+${HOME} export done test grep
+"$1" 2>/dev/null 'quoted text' $(pwd) "$1"
+	done && ${HOME} /usr/bin grep /usr/bin then
+--verbose --verbose "$1" $(pwd) && $(pwd) sed ${HOME} then
+		local x=1 "$@" 2>/dev/null -eu cd /usr/bin $(pwd) /usr/bin
+		x=1 echo "$@" x=1 x=1 --verbose test sed then
+		x=1 "$@" x=1 awk && /usr/bin awk /usr/bin sed
+	cd cd 'quoted text' 2>/dev/null done /usr/bin $(pwd) --verbose
+	local /usr/bin && --verbose echo local /usr/bin
+		'quoted text' && $(pwd) -eu grep && done
+grep printf x=1 "$1" 'quoted text' then | && export -eu awk grep --verbose
+readonly --verbose readonly "$1" then 2>/dev/null
+	"$1" local cd local -eu cd export printf 'quoted text'
+x=1 printf "$1" sed cd export done
+	test cd | --verbose /usr/bin export test ${HOME}
+	export && export 2>/dev/null
+		readonly x=1 then && then then awk then | --verbose 2>/dev/null
+		printf ${HOME} x=1 x=1 readonly cd | "$@" ${HOME} grep awk "$@"
+		test sed awk readonly 2>/dev/null x=1 cd then printf
+	test test 2>/dev/null $(pwd) | readonly printf $(pwd) && grep 2>/dev/null ${HOME}
+'quoted text' x=1 grep
+| 'quoted text' --verbose
+echo printf test 2>/dev/null printf sed readonly /usr/bin
+	--verbose echo awk /usr/bin printf x=1 awk ${HOME}
+		2>/dev/null export local sed 'quoted text' then test /usr/bin
+	readonly 2>/dev/null export /usr/bin 2>/dev/null
+	then cd export export grep cd then -eu grep grep
+	${HOME} ${HOME} awk /usr/bin local "$@" then export && 'quoted text' then
+	/usr/bin --verbose export readonly then
+		2>/dev/null printf "$@" 'quoted text' done local
+	local "$@" grep /usr/bin 2>/dev/null && --verbose 2>/dev/null
+readonly --verbose | then local local done then $(pwd) -eu export | x=1 awk test
+then cd x=1 readonly 'quoted text'
+		&& grep ${HOME} x=1 done echo | $(pwd)
+	test readonly echo x=1 test ${HOME} printf x=1 test 'quoted text' readonly
+2>/dev/null "$@" ${HOME} --verbose awk echo export
+	export "$1" awk ${HOME} | | 'quoted text'
+"$@" 2>/dev/null $(pwd) "$1" x=1 $(pwd) test "$@" sed 2>/dev/null
+		$(pwd) echo done export "$@" "$1" /usr/bin 2>/dev/null && test "$@" /usr/bin
+readonly $(pwd) x=1 /usr/bin -eu printf echo $(pwd)
+awk test local printf readonly grep cd
+	then "$@" export 'quoted text'
+	'quoted text' cd -eu export local export
+	"$@" echo test /usr/bin && && done /usr/bin done echo | --verbose "$1" printf
+		/usr/bin echo && echo 'quoted text'
+	$(pwd) cd "$@" readonly echo $(pwd) local
+	&& test echo done "$1" grep readonly sed $(pwd) export readonly
+done x=1 "$@" && 2>/dev/null grep ${HOME}
+grep export ${HOME} "$@" sed $(pwd) printf then printf
+		2>/dev/null grep local
+'quoted text' cd 'quoted text' readonly test 2>/dev/null then /usr/bin
+	export ${HOME} done 'quoted text' "$@" 'quoted text'
+cd | $(pwd) cd --verbose local local "$1" grep | local $(pwd) sed 'quoted text'
+		printf sed $(pwd) | 2>/dev/null
+		cd export "$1" export test grep
+		&& echo "$@" echo x=1 'quoted text' export /usr/bin 2>/dev/null local
+		sed grep x=1 cd then 2>/dev/null
+		sed cd "$1" local done ${HOME}
+done done 2>/dev/null $(pwd) -eu 'quoted text'
+		grep test sed x=1 test grep test
+'quoted text' cd done sed test readonly
+	"$@" printf local printf awk export
+	| awk export 2>/dev/null echo grep grep then sed readonly test ${HOME} "$@" /usr/bin
+local | export 2>/dev/null cd
+	'quoted text' $(pwd) done
+then 'quoted text' ${HOME} /usr/bin | grep readonly local grep "$1" done 2>/dev/null
+	/usr/bin x=1 && "$@" done "$@" readonly -eu "$@" cd | sed 'quoted text' 2>/dev/null
+		printf test done then test local sed readonly awk 'quoted text' "$1" --verbose
+		sed /usr/bin grep then $(pwd)
+echo printf printf then local -eu "$@" "$@" x=1 then
+	echo grep | test && awk --verbose echo | "$1" && --verbose --verbose
+		"$@" then "$@" sed grep 'quoted text'
+	export test "$1" sed awk | | local | then 'quoted text' cd then then 2>/dev/null
+'quoted text' done x=1 export then export x=1 done --verbose readonly local
+done 2>/dev/null test cd awk ${HOME} 2>/dev/null | echo then readonly
+	local then awk grep echo local "$@"
+		${HOME} && echo "$1" | | "$1" "$@" 2>/dev/null awk | 2>/dev/null "$@" /usr/bin
+	sed /usr/bin | sed export | 'quoted text'
+test | ${HOME} local done 2>/dev/null 2>/dev/null
+readonly test "$@" printf
+		sed ${HOME} done local grep 'quoted text' then | 'quoted text' "$1"
+		--verbose -eu "$@" ${HOME} awk ${HOME} -eu done -eu export --verbose
+		readonly test 'quoted text' printf ${HOME} x=1 grep && 2>/dev/null
+	test ${HOME} -eu printf 2>/dev/null
+local printf /usr/bin 2>/dev/null test
+	${HOME} --verbose awk "$1" then sed x=1 echo | ${HOME}
+then awk && local sed 2>/dev/null
+local 2>/dev/null printf $(pwd) | awk local
+		${HOME} | "$1" then --verbose $(pwd) readonly 2>/dev/null
+		2>/dev/null readonly 'quoted text' ${HOME} test done export ${HOME} printf
+		done done local "$@" grep /usr/bin export 'quoted text'
+	"$@" readonly "$@" /usr/bin
+echo awk done test cd $(pwd) 2>/dev/null cd x=1 /usr/bin "$1" $(pwd) test
+		--verbose | x=1 done "$1" export x=1 && sed && export | test
+		2>/dev/null "$1" 2>/dev/null done awk awk
+	readonly awk x=1 'quoted text'
+| done awk grep 'quoted text' printf local $(pwd) readonly
+&& awk "$@" "$1" | test
+	2>/dev/null -eu 2>/dev/null sed "$@" printf && x=1 done awk printf
+		printf grep x=1 then --verbose --verbose
+	"$@" cd awk "$@" readonly readonly -eu | export grep then "$@" && | 'quoted text'
+		"$1" done then 'quoted text'
+	done cd 'quoted text' "$1" | cd "$1" sed sed /usr/bin
+	readonly done -eu grep "$@" --verbose awk "$@" "$@" printf ${HOME} sed 'quoted text'
+		export echo echo | echo 'quoted text'
+		readonly /usr/bin printf | grep "$@" export 'quoted text' printf cd
+"$@" -eu then done /usr/bin 2>/dev/null grep test
+		--verbose && ${HOME} ${HOME} awk
+		'quoted text' echo printf cd printf 'quoted text' local --verbose $(pwd)
+		"$1" test "$1" x=1 x=1 ${HOME} /usr/bin x=1 sed then test grep && echo
+cd echo export printf ${HOME} "$@" x=1 $(pwd) sed
+"$1" printf && awk ${HOME} "$@" then
+		2>/dev/null /usr/bin then ${HOME} readonly sed ${HOME} | --verbose
+x=1 then ${HOME} x=1 2>/dev/null cd
+	grep local | done ${HOME} done grep test local ${HOME} done 2>/dev/null grep
+	grep "$1" 2>/dev/null 2>/dev/null sed ${HOME} echo readonly
+test 2>/dev/null echo "$1" x=1 x=1 $(pwd) done grep
+		export readonly sed echo awk -eu "$@" ${HOME} 'quoted text' -eu "$@" 2>/dev/null
+		echo sed x=1 "$1" readonly 2>/dev/null sed awk ${HOME}
+2>/dev/null printf local local sed && cd echo && cd readonly
+grep printf echo x=1 export echo then done awk && ${HOME} "$@"
+		grep then 2>/dev/null grep "$@" -eu
+		then cd | export ${HOME} $(pwd) /usr/bin 2>/dev/null
+	grep sed ${HOME} test $(pwd) printf awk
+		-eu $(pwd) && printf sed 2>/dev/null test export /usr/bin
+2>/dev/null echo readonly "$@" echo test then x=1 $(pwd) local /usr/bin
+	then -eu /usr/bin $(pwd) cd 2>/dev/null
+readonly sed /usr/bin export x=1 cd then --verbose grep readonly x=1 2>/dev/null
+local "$@" readonly echo cd /usr/bin ${HOME} /usr/bin echo | sed | printf -eu echo
+test x=1 "$@" $(pwd) --verbose && export "$@" && "$@" sed then
+		&& "$@" test -eu then grep ${HOME} awk local
+	2>/dev/null local sed "$1" | test local ${HOME} export /usr/bin "$@" test --verbose
+--verbose x=1 done | ${HOME} ${HOME} "$1" cd awk -eu -eu grep
+"$1" 'quoted text' printf readonly cd | printf
+		export x=1 --verbose "$1" "$1" cd ${HOME} --verbose cd then 'quoted text'
+	/usr/bin echo awk echo export $(pwd) echo awk cd ${HOME}
+	done then echo echo cd sed readonly awk export "$@" readonly
+		"$1" echo 'quoted text' && test sed "$@"
+	printf 2>/dev/null /usr/bin cd 2>/dev/null
+-eu -eu $(pwd) $(pwd) then done
+		done printf cd -eu then && /usr/bin printf done printf
+		cd $(pwd) grep then 'quoted text' done
+		/usr/bin x=1 /usr/bin sed sed ${HOME} printf 2>/dev/null then 2>/dev/null
+$(pwd) done --verbose readonly cd ${HOME} done 2>/dev/null "$1"
+	printf 'quoted text' 2>/dev/null
+	local local done 'quoted text'
+	2>/dev/null "$@" --verbose awk printf --verbose grep printf ${HOME}
+		2>/dev/null awk echo grep 2>/dev/null printf awk ${HOME}
+		$(pwd) x=1 && && "$@" && test $(pwd)
+	local done && $(pwd) "$@" readonly x=1 done printf echo sed | $(pwd) done export
+	"$1" cd $(pwd) grep 2>/dev/null local "$1" --verbose | x=1 grep /usr/bin
+done x=1 2>/dev/null "$@" "$@" export x=1 'quoted text'
+grep sed 'quoted text' 2>/dev/null /usr/bin 'quoted text' ${HOME} /usr/bin sed
+grep ${HOME} then printf ${HOME} export 2>/dev/null 2>/dev/null
+		-eu $(pwd) cd echo /usr/bin cd "$@" "$@" cd
+"$@" printf printf | grep &&
+	cd /usr/bin && $(pwd) done echo local done
+--verbose 'quoted text' "$1" grep export echo 2>/dev/null
+		test -eu "$@" -eu printf 2>/dev/null
+	cd echo 2>/dev/null | readonly
+	&& then "$1" local readonly
+		2>/dev/null cd readonly -eu /usr/bin cd readonly --verbose && export x=1 readonly
+		--verbose "$@" sed cd then /usr/bin printf local
+		sed printf local 2>/dev/null -eu 2>/dev/null readonly 'quoted text' "$1"
+	local local local grep $(pwd) "$@" echo 2>/dev/null done readonly
+${HOME} /usr/bin && echo printf export
+test grep readonly awk awk 'quoted text' "$@" grep grep && 2>/dev/null grep
+echo --verbose $(pwd) printf "$@" cd export local readonly 'quoted text' grep
+	-eu export sed done ${HOME}
+2>/dev/null grep awk "$1" done readonly local readonly
+		$(pwd) /usr/bin 'quoted text'
+		done 2>/dev/null then "$@" local $(pwd) 2>/dev/null printf $(pwd) test
+done /usr/bin "$1" ${HOME} then
+grep 2>/dev/null && 'quoted text' awk x=1 sed grep done cd --verbose then
+	printf grep 2>/dev/null local echo readonly "$1"
+then "$1" ${HOME} done 'quoted text'
+${HOME} | /usr/bin x=1 'quoted text' grep --verbose awk then ${HOME}
+	'quoted text' then -eu 'quoted text'
+x=1 readonly awk done done "$@" | echo
+		&& test ${HOME} x=1 local /usr/bin sed -eu | printf done 'quoted text' readonly
+cd -eu -eu sed 2>/dev/null
+		${HOME} grep echo test /usr/bin /usr/bin
+		then test grep /usr/bin "$1" export
+		awk x=1 "$@" --verbose -eu "$1" cd | awk x=1 $(pwd) 2>/dev/null
+&& "$@" readonly 2>/dev/null /usr/bin --verbose printf
+	2>/dev/null sed $(pwd) echo /usr/bin x=1 "$1"
+		| grep printf --verbose test "$@" done awk /usr/bin echo echo 'quoted text' --verbose
+	"$1" 'quoted text' $(pwd) $(pwd) readonly -eu test cd "$@" $(pwd) $(pwd)
+		--verbose local sed --verbose sed $(pwd) local
+		then $(pwd) /usr/bin 2>/dev/null echo local -eu 2>/dev/null x=1 grep /usr/bin
+		'quoted text' sed ${HOME} "$1" echo
+		$(pwd) printf -eu && $(pwd) printf "$@" /usr/bin 2>/dev/null local
+	printf then export $(pwd) cd awk
+		printf /usr/bin cd && "$@" test echo
+		x=1 printf "$1" grep ${HOME} awk ${HOME} cd ${HOME} awk ${HOME} local export
+/usr/bin 'quoted text' then
+local local "$1" 2>/dev/null && && /usr/bin 'quoted text' done --verbose
+	x=1 "$1" awk cd "$1" export readonly export -eu awk sed done x=1 'quoted text'
+| /usr/bin "$1" cd 2>/dev/null grep echo /usr/bin
+grep /usr/bin | x=1 "$@" 'quoted text' 2>/dev/null | awk ${HOME}
+		2>/dev/null "$@" done /usr/bin sed
+	&& | echo cd 'quoted text' "$@"
+	/usr/bin | ${HOME} echo
+	awk /usr/bin 'quoted text'
+x=1 readonly done printf local then 2>/dev/null /usr/bin
+--verbose done /usr/bin local sed cd test | "$@" printf x=1 ${HOME} --verbose
+	awk ${HOME} grep awk --verbose | x=1 awk | /usr/bin grep
+	'quoted text' awk x=1 /usr/bin --verbose awk awk readonly
+$(pwd) /usr/bin /usr/bin | && x=1 --verbose ${HOME}
+	| 'quoted text' sed "$@" test export cd then /usr/bin $(pwd) cd echo /usr/bin
+		--verbose grep cd printf grep /usr/bin && x=1 -eu 'quoted text'
+then 2>/dev/null $(pwd) local | 'quoted text' && ${HOME}
+	--verbose ${HOME} printf
+		test grep && /usr/bin done sed ${HOME} test ${HOME} /usr/bin 2>/dev/null
+		readonly done awk --verbose
+		printf test export $(pwd) -eu sed $(pwd) && &&
+/usr/bin | "$@" test x=1 ${HOME} done "$1" then && x=1 echo grep echo
+	test "$1" | 2>/dev/null echo readonly
+cd echo local readonly | then test
+		done /usr/bin $(pwd) 2>/dev/null test "$@"
+	x=1 "$1" /usr/bin -eu /usr/bin echo 2>/dev/null readonly "$1" awk export local
+echo /usr/bin | cd /usr/bin readonly
+		sed local x=1 grep | | awk awk done --verbose local /usr/bin
+		${HOME} x=1 "$1" printf "$1" sed export sed --verbose | x=1 readonly
+export export 2>/dev/null /usr/bin "$@" echo x=1 done grep x=1
+export cd then 'quoted text' $(pwd) echo /usr/bin -eu x=1 done
+		local ${HOME} ${HOME} 'quoted text' | printf readonly then
+	readonly /usr/bin --verbose --verbose /usr/bin $(pwd) x=1 $(pwd) done
+		'quoted text' $(pwd) export export
+then "$@" 2>/dev/null && readonly done $(pwd) "$1" && 2>/dev/null done then
+	${HOME} readonly $(pwd) local export
+cd $(pwd) local done "$1" "$@" readonly readonly
+	sed "$1" ${HOME} -eu awk
+printf readonly /usr/bin echo | 'quoted text' && $(pwd) 'quoted text'
+		readonly | /usr/bin grep echo "$1" 2>/dev/null /usr/bin awk
+		&& sed cd 'quoted text' export export readonly ${HOME}
+	--verbose then sed "$1" 2>/dev/null 'quoted text' && -eu echo /usr/bin x=1
+		-eu readonly 'quoted text' && printf && awk | printf echo --verbose done 'quoted text'
+/usr/bin done awk x=1 --verbose export -eu && 'quoted text' "$1" 2>/dev/null
+	&& local grep 2>/dev/null && cd "$1" readonly
+	test readonly -eu sed "$@" 2>/dev/null local
+		"$1" readonly printf -eu done sed local
+		${HOME} echo sed && 2>/dev/null cd | grep | --verbose
+		then -eu readonly local test export cd x=1 x=1 x=1 /usr/bin
+	grep done 'quoted text'
+/usr/bin local cd local ${HOME} cd -eu --verbose printf /usr/bin "$@" grep done
+printf test grep sed local "$@" x=1 cd awk "$@" && --verbose
+	x=1 $(pwd) local done export $(pwd) sed 2>/dev/null awk
+$(pwd) ${HOME} test "$1" readonly ${HOME} test && echo
+$(pwd) then local "$@" cd -eu "$1" x=1
+		echo test $(pwd) | grep cd export sed awk printf -eu -eu ${HOME} x=1 /usr/bin
+"$1" "$@" 'quoted text'
+	export 2>/dev/null | | ${HOME} export | done cd /usr/bin
+echo then test printf ${HOME} awk | cd | awk test readonly
+		'quoted text' $(pwd) sed awk 'quoted text' "$1" cd
+		then test sed ${HOME} --verbose
+| --verbose "$1" 2>/dev/null awk echo $(pwd) | ${HOME} sed printf
+	/usr/bin test local test --verbose
+	export sed cd | "$1" && sed done
+| export ${HOME} printf 'quoted text' test x=1 2>/dev/null export sed then
+done awk printf export x=1 'quoted text' -eu echo grep $(pwd)
+	sed test readonly printf --verbose echo --verbose x=1 $(pwd) cd done "$@" --verbose
+	then local ${HOME} sed /usr/bin printf local $(pwd) export 2>/dev/null cd export
+		grep then --verbose ${HOME} 'quoted text'
+2>/dev/null sed ${HOME} "$@"
+		grep --verbose -eu sed /usr/bin -eu 2>/dev/null --verbose readonly then export
+	local sed "$1" 2>/dev/null 'quoted text'
+		"$1" cd test --verbose test printf ${HOME} ${HOME} test 2>/dev/null
+		readonly -eu 'quoted text' local "$1" grep 2>/dev/null -eu ${HOME}
+printf 2>/dev/null 2>/dev/null
+		--verbose local x=1 printf awk export | --verbose sed --verbose
+grep && -eu test sed export
+	'quoted text' "$@" "$@" awk $(pwd)
+		done done $(pwd) local printf -eu readonly
+x=1 /usr/bin "$1" done cd 'quoted text' local /usr/bin /usr/bin grep
+test ${HOME} --verbose local x=1 test 2>/dev/null
+		readonly done | test 2>/dev/null awk done cd local
+	&& echo then && ${HOME} readonly done
+cd echo ${HOME} | "$@"
+		x=1 export awk --verbose
+	"$@" echo printf x=1 -eu ${HOME} "$1" "$@" $(pwd)
+		readonly local cd -eu /usr/bin ${HOME} --verbose local printf export printf
+	export echo $(pwd) cd grep /usr/bin
+${HOME} --verbose --verbose "$1" sed ${HOME} grep export printf done echo
+cd local $(pwd) printf test cd 2>/dev/null then && && $(pwd)
+"$@" done then local /usr/bin ${HOME} 2>/dev/null export --verbose test echo
+${HOME} 2>/dev/null /usr/bin 'quoted text'
+		/usr/bin "$@" x=1 test test then local &&
+	local --verbose ${HOME} sed printf x=1 $(pwd) grep
+awk -eu && echo "$1" -eu "$@" test && sed sed
+	'quoted text' --verbose cd 2>/dev/null x=1 /usr/bin printf sed 2>/dev/null export
+/usr/bin 2>/dev/null | -eu cd cd echo --verbose cd then x=1 |
+	grep "$1" | $(pwd) ${HOME}
+		$(pwd) grep 2>/dev/null | echo /usr/bin sed -eu printf
+cd awk local "$1" --verbose test ${HOME} readonly && -eu "$1" printf
+		-eu cd done then 2>/dev/null -eu cd export test "$1" awk sed && cd
+x=1 echo echo $(pwd) then --verbose printf /usr/bin /usr/bin
+printf x=1 cd then ${HOME} grep --verbose printf && done 'quoted text' /usr/bin
+'quoted text' "$1" readonly awk done x=1 then x=1
+		readonly /usr/bin && --verbose --verbose -eu
+	then local && grep "$@" && 2>/dev/null --verbose x=1 --verbose
+	/usr/bin x=1 export | sed then --verbose cd | grep then local then 2>/dev/null
+		${HOME} done "$1" | ${HOME} /usr/bin then
+		/usr/bin then x=1 test x=1 sed x=1 ${HOME} local printf
+		test 2>/dev/null then x=1
+		awk local printf "$@" "$1" export printf /usr/bin readonly awk 2>/dev/null
+	/usr/bin echo echo "$@" 'quoted text' 'quoted text' -eu printf "$1" "$1" 2>/dev/null
+	"$1" awk done 2>/dev/null readonly
+&& "$1" --verbose /usr/bin ${HOME} printf printf && "$@"
+local 2>/dev/null "$1" readonly
+${HOME} readonly $(pwd) echo test grep | done 'quoted text' printf --verbose
+		| readonly $(pwd) 'quoted text' && | && /usr/bin
+&& printf $(pwd) --verbose --verbose | sed $(pwd)
+		awk 'quoted text' "$@" && test test test $(pwd) local && local x=1 grep done test
+	'quoted text' then "$@" "$1" done
+printf x=1 echo $(pwd) | && ${HOME} local export local $(pwd)
+	grep && test | /usr/bin
+local local 'quoted text' | 2>/dev/null
+	export awk 'quoted text' --verbose echo -eu done printf test 2>/dev/null done
+$(pwd) export /usr/bin /usr/bin test local "$1" && grep "$@"
+		awk "$1" -eu --verbose "$@" -eu --verbose 2>/dev/null
+		test printf $(pwd) echo test /usr/bin 2>/dev/null test test
+--verbose "$@" printf x=1 && then sed awk ${HOME} 'quoted text'
+then "$1" test | echo $(pwd)
+/usr/bin readonly test awk sed | export printf grep "$1" x=1 cd | -eu cd
+"$@" && $(pwd) 2>/dev/null ${HOME} | --verbose sed sed echo local | x=1 $(pwd)
+		2>/dev/null --verbose -eu 2>/dev/null $(pwd) "$1" cd echo done && grep 'quoted text'
+| /usr/bin /usr/bin "$@"
+&& | | ${HOME} readonly readonly test $(pwd) export echo export ${HOME} --verbose
+	-eu local 2>/dev/null --verbose cd -eu /usr/bin readonly 2>/dev/null
+		&& /usr/bin echo test echo awk "$@" awk x=1 | $(pwd) 'quoted text'
+	"$1" done && printf cd awk export -eu 'quoted text'
+		'quoted text' done --verbose echo &&
+/usr/bin && | cd 2>/dev/null
+		--verbose -eu x=1 x=1 "$@" cd then /usr/bin
+&& local $(pwd) "$1" /usr/bin 'quoted text' "$@"
+	'quoted text' -eu awk printf --verbose readonly readonly grep sed grep echo
+		${HOME} /usr/bin && /usr/bin "$@" $(pwd) 'quoted text' cd local --verbose
+		2>/dev/null $(pwd) /usr/bin readonly /usr/bin grep /usr/bin ${HOME} && sed
+		"$1" printf 'quoted text' grep readonly readonly $(pwd) done
+then ${HOME} printf test echo "$1" done $(pwd) 'quoted text'
+	&& -eu 2>/dev/null 2>/dev/null ${HOME} $(pwd) "$@" then
+		readonly export x=1 grep local grep done x=1 cd test test grep readonly /usr/bin
+	x=1 && echo export done
+	x=1 --verbose ${HOME} printf cd grep echo printf
+	--verbose $(pwd) sed /usr/bin test --verbose --verbose printf -eu
+		2>/dev/null x=1 'quoted text'
+2>/dev/null x=1 | && echo sed test "$1" done grep local awk
+	&& readonly test | "$@" /usr/bin readonly x=1 "$1" ${HOME} printf 'quoted text'
+		done readonly "$@" 2>/dev/null
+x=1 2>/dev/null x=1 local done $(pwd) test | "$1" cd grep && "$1" --verbose
+		$(pwd) -eu "$1" grep "$@" grep done | echo -eu echo && "$@" --verbose ${HOME}
+	'quoted text' 2>/dev/null done then && grep sed readonly "$1" grep done sed
+	local then awk export 'quoted text' readonly && "$1" done
+$(pwd) local ${HOME} awk "$1" $(pwd) 'quoted text'
+	--verbose export ${HOME} |
+export then grep grep then
+		$(pwd) test local echo echo $(pwd) && 'quoted text' "$@"
+	-eu echo --verbose /usr/bin
+echo && local 2>/dev/null ${HOME} -eu
+| 'quoted text' grep grep
+	--verbose awk test /usr/bin "$@" printf --verbose 'quoted text' "$1" "$@" && 2>/dev/null
+		cd -eu then | "$1" x=1 x=1 | test "$1"
+		$(pwd) then readonly 'quoted text' local awk -eu printf ${HOME} /usr/bin x=1 2>/dev/null
+cd -eu done ${HOME} -eu echo "$@" test --verbose
+"$1" 'quoted text' && export cd
+		2>/dev/null /usr/bin echo cd sed export
+readonly 2>/dev/null export awk $(pwd) then $(pwd)
+		&& x=1 -eu awk grep "$1"
+$(pwd) ${HOME} cd x=1 cd 2>/dev/null 2>/dev/null
+	echo echo ${HOME} readonly x=1 then | ${HOME}
+		&& export x=1 "$1" 'quoted text' ${HOME} | /usr/bin
+	2>/dev/null $(pwd) 'quoted text' done awk "$@" && readonly -eu readonly awk
+		done cd readonly x=1 cd | ${HOME} && then
+		| $(pwd) then cd test ${HOME}
+	${HOME} local --verbose
+cd /usr/bin export echo -eu awk --verbose awk
+		$(pwd) $(pwd) | readonly
+	&& sed 2>/dev/null -eu 'quoted text' ${HOME} test 'quoted text' local
+		readonly "$@" awk readonly "$@" export done && echo printf /usr/bin
+	test echo --verbose grep readonly "$@" | && export | "$1"
+--verbose $(pwd) cd "$1" /usr/bin test $(pwd) local 2>/dev/null
+		printf printf printf /usr/bin
+		/usr/bin 2>/dev/null $(pwd) export export
+	echo "$1" /usr/bin done && 'quoted text' | -eu -eu
+done $(pwd) ${HOME} sed 2>/dev/null then
+	&& | 2>/dev/null "$@" printf export && then echo 'quoted text'
+	local -eu awk 2>/dev/null ${HOME} cd && --verbose
+x=1 local readonly ${HOME} then /usr/bin x=1 sed "$1" x=1 /usr/bin grep readonly
+		done local cd x=1 "$1" awk --verbose
+done -eu x=1 2>/dev/null awk readonly printf readonly done
+		/usr/bin local sed sed test "$1" cd 2>/dev/null
+		grep echo then local && echo sed
+	&& /usr/bin --verbose export 2>/dev/null cd cd $(pwd) local
+readonly && done awk /usr/bin printf $(pwd)
+	export printf readonly x=1 printf
+		then test awk sed grep readonly /usr/bin "$@" 2>/dev/null
+		2>/dev/null sed test printf
+	$(pwd) /usr/bin cd -eu 2>/dev/null echo /usr/bin ${HOME} x=1 then
+		test | /usr/bin $(pwd)
+grep x=1 'quoted text' ${HOME}
+	cd | cd -eu done readonly
+grep "$1" "$1" $(pwd) awk printf --verbose
+		printf then then then --verbose x=1 then $(pwd) cd printf
+		${HOME} local local readonly then --verbose
+readonly 2>/dev/null local /usr/bin local -eu && -eu && "$@" echo /usr/bin printf
+		--verbose sed /usr/bin "$@" --verbose
+	--verbose 2>/dev/null done export 'quoted text' then local local then 'quoted text'
+		x=1 echo then 'quoted text' readonly && && 'quoted text' then readonly "$1"
+		&& then "$@" echo | then echo sed ${HOME} awk "$@" -eu local
+	export export /usr/bin echo done then /usr/bin readonly
+-eu "$@" export readonly done then test ${HOME} | test local local "$@" "$@"
+	&& awk echo sed awk -eu local 'quoted text' export echo
+grep grep test "$1" done readonly then printf grep done
+	x=1 done export test printf readonly x=1 printf "$@" && "$@" 'quoted text'
+		"$1" sed 'quoted text' export sed then ${HOME} then local
+"$@" then sed 2>/dev/null grep --verbose
+	-eu /usr/bin done export readonly
+readonly 2>/dev/null export awk cd test $(pwd)
+		awk printf printf --verbose test echo export cd && && readonly
+		--verbose ${HOME} | ${HOME} --verbose export x=1 local
+	"$1" -eu --verbose --verbose --verbose readonly then echo "$@"
+done readonly sed "$1" -eu x=1 'quoted text'
+		x=1 export sed 'quoted text' "$@" --verbose && then | -eu "$@" sed 2>/dev/null
+		'quoted text' printf sed cd --verbose
+&& -eu then | ${HOME} | echo test sed done
+		2>/dev/null -eu printf | done 'quoted text'
+	readonly awk echo readonly then -eu local grep x=1 test /usr/bin
+	grep 'quoted text' x=1 && 'quoted text'
+		| 2>/dev/null 2>/dev/null then 2>/dev/null local test "$1" ${HOME} $(pwd)
+x=1 readonly ${HOME} awk then 2>/dev/null test x=1 grep
+2>/dev/null | cd x=1 -eu "$1" printf cd 2>/dev/null x=1
+export "$1" | --verbose echo grep grep test readonly local
+	grep "$@" /usr/bin | && export "$@"
+'quoted text' done export
+		awk /usr/bin printf done echo cd local printf -eu "$1"
+		cd echo 'quoted text' printf printf /usr/bin export then "$@"
+2>/dev/null 2>/dev/null echo --verbose 'quoted text' printf x=1 sed then "$@"
+/usr/bin x=1 test -eu
+		then ${HOME} --verbose cd printf -eu
+		'quoted text' sed --verbose $(pwd)
+/usr/bin /usr/bin /usr/bin "$@" awk printf &&
+	readonly readonly /usr/bin printf $(pwd) readonly done 'quoted text' && "$@" readonly
+| 'quoted text' export
+		sed && echo 2>/dev/null grep 2>/dev/null then readonly
+		'quoted text' ${HOME} -eu "$1" grep done
+	'quoted text' export x=1 "$@" x=1
+		--verbose test done /usr/bin then echo readonly awk --verbose
+		sed | test awk cd 'quoted text' ${HOME}
+		/usr/bin test echo 'quoted text' awk |
+grep "$@" "$1" readonly -eu && export local echo "$@" "$@" "$@" then /usr/bin awk
+-eu local cd && grep local
+${HOME} sed | $(pwd) | grep echo
+	--verbose && readonly "$1" -eu awk
+"$1" | /usr/bin cd grep ${HOME} sed 'quoted text' readonly
+printf readonly test ${HOME} printf then done -eu awk /usr/bin printf
+-eu | local awk 'quoted text'
+echo /usr/bin | | echo -eu $(pwd) /usr/bin | test readonly echo
+sed sed $(pwd) ${HOME} done x=1 | $(pwd) local cd printf done
+		| sed awk -eu grep 2>/dev/null local printf readonly -eu export printf
+	local test | 'quoted text' done printf test
+	&& x=1 | test then echo "$1" then export --verbose 'quoted text' && 'quoted text'
+		"$@" grep $(pwd) ${HOME} cd --verbose local
+/usr/bin 'quoted text' local "$@" "$1" | -eu echo -eu
+sed "$@" $(pwd) && -eu "$@" /usr/bin echo grep grep "$1"
+"$@" $(pwd) sed ${HOME} ${HOME} cd 'quoted text'
+	-eu "$@" 2>/dev/null -eu 2>/dev/null 'quoted text'
+		printf && -eu 'quoted text' ${HOME} x=1 /usr/bin x=1 export
+&& 2>/dev/null 'quoted text' /usr/bin done
+/usr/bin grep -eu cd local /usr/bin local grep sed x=1 $(pwd) x=1
+/usr/bin ${HOME} sed "$@"
+	sed echo "$1" cd 2>/dev/null printf ${HOME} echo |
+	x=1 "$@" "$@" && 2>/dev/null $(pwd)
+	awk echo $(pwd) 'quoted text'
+	printf && readonly echo done grep test readonly "$1" /usr/bin
+	awk awk --verbose 2>/dev/null test ${HOME}
+		--verbose "$1" echo grep "$1" 2>/dev/null 2>/dev/null
+		${HOME} ${HOME} x=1 awk echo
+sed x=1 | --verbose awk &&
+	2>/dev/null $(pwd) 'quoted text' && && x=1 printf
+		| -eu "$@" "$@" | test --verbose sed sed ${HOME} then | local done "$@" "$1"
+	"$1" done readonly printf 2>/dev/null "$1"
+	/usr/bin | --verbose printf "$@"
+2>/dev/null | $(pwd) echo x=1 "$1" /usr/bin sed /usr/bin $(pwd)
+	readonly echo echo 'quoted text' "$@" $(pwd) | readonly awk
+		cd && cd 2>/dev/null |
+	readonly $(pwd) ${HOME} echo x=1 then && then printf /usr/bin done
+cd cd sed local awk ${HOME} readonly
+		${HOME} local cd -eu sed export test done && -eu readonly then "$@" printf
+	| /usr/bin $(pwd) /usr/bin echo printf /usr/bin --verbose
+		/usr/bin export done sed export local grep echo cd
+		'quoted text' 'quoted text' export && 'quoted text'
+	2>/dev/null export | | done ${HOME} cd "$@" x=1
+	"$@" export echo printf /usr/bin grep
+export printf awk && x=1 ${HOME} test $(pwd) readonly test | "$1" -eu echo $(pwd)
+		done x=1 done $(pwd) "$@" ${HOME}
+		done readonly grep 2>/dev/null
+		readonly printf readonly 'quoted text' | done x=1 export ${HOME}
+		awk --verbose "$1" done "$1" $(pwd) echo $(pwd) 'quoted text' readonly "$1"
+		/usr/bin 2>/dev/null ${HOME} x=1
+		cd ${HOME} $(pwd) then export printf ${HOME} && -eu awk sed export
+		x=1 done then export | "$@" test grep -eu -eu x=1 awk 2>/dev/null
+	| done export sed | printf --verbose 'quoted text' $(pwd) export local
+		local --verbose readonly "$1" | x=1 x=1 awk test grep
+	"$@" x=1 then /usr/bin
+	'quoted text' done ${HOME} echo
+		awk x=1 && test printf 'quoted text' x=1 "$@" 2>/dev/null
+		awk -eu $(pwd) "$@" ${HOME}
+	echo awk export -eu test local local cd --verbose test -eu
+	"$1" cd grep sed sed --verbose grep readonly done export --verbose
+	| x=1 local export "$1" "$1" readonly echo
+	/usr/bin test | "$1" local --verbose cd grep && | printf local "$1" 2>/dev/null
+sed echo grep && test ${HOME}
+	"$1" cd done sed /usr/bin export printf cd x=1 "$1" "$1" export "$@"
+test -eu then echo test
+--verbose /usr/bin --verbose x=1
+2>/dev/null readonly local && cd 2>/dev/null
+		test test $(pwd) echo export echo readonly 'quoted text'
+$(pwd) awk echo 'quoted text' printf | cd readonly grep local
+		then printf cd x=1 | export
+		printf && done awk "$@" awk cd cd echo
+x=1 grep | 2>/dev/null ${HOME} done then printf "$@" ${HOME} "$@" printf readonly
+2>/dev/null "$@" test grep --verbose then printf
+sed then sed local ${HOME} awk
+/usr/bin "$1" -eu --verbose && x=1 | 'quoted text' export grep awk /usr/bin awk
+		cd echo 'quoted text'
+done export local test printf "$1" /usr/bin 'quoted text'
+'quoted text' 2>/dev/null -eu grep
+x=1 awk $(pwd) printf 'quoted text' sed /usr/bin
+local --verbose -eu test "$@" x=1 echo cd grep cd done -eu
+	${HOME} -eu echo local echo echo local sed "$1" ${HOME} awk -eu 2>/dev/null
+	'quoted text' readonly -eu "$@" echo awk printf x=1 "$@" printf
+		readonly printf /usr/bin --verbose 2>/dev/null x=1 /usr/bin
+--verbose "$1" test then printf x=1 then export "$1" printf $(pwd)
+	awk -eu 2>/dev/null /usr/bin ${HOME} ${HOME} /usr/bin local export /usr/bin --verbose
+/usr/bin then 'quoted text'
+		grep x=1 test 'quoted text' done --verbose "$@" done test ${HOME} sed then
+sed export cd /usr/bin /usr/bin readonly "$@" $(pwd) "$1"
+	then 'quoted text' x=1 local /usr/bin grep sed
+		grep --verbose then $(pwd) ${HOME} "$@" sed x=1 ${HOME}
+$(pwd) then echo -eu /usr/bin test sed
+"$1" -eu local "$@" --verbose "$@"
+grep 2>/dev/null --verbose local test | "$@" /usr/bin 2>/dev/null x=1 "$@" 'quoted text'
+	/usr/bin done local /usr/bin printf "$1" cd echo local 2>/dev/null
+	readonly $(pwd) sed local
+		printf done then then test | then grep done then ${HOME}
+$(pwd) | $(pwd) "$1" x=1 x=1 readonly | --verbose readonly $(pwd)
+	--verbose awk readonly ${HOME} printf
+${HOME} echo awk x=1 cd export cd --verbose awk 2>/dev/null
+test 'quoted text' && | x=1 x=1 echo
+		'quoted text' && cd then && -eu printf test 'quoted text' /usr/bin readonly ${HOME}
+'quoted text' ${HOME} --verbose
+		done "$@" "$1" local echo readonly
+	then /usr/bin grep export | $(pwd) grep
+		/usr/bin "$@" x=1 printf echo sed local --verbose done
+	-eu x=1 readonly done sed export awk test echo 'quoted text' test 'quoted text'
+	test test "$1" "$@" $(pwd) awk echo "$1" printf | test awk "$1" 2>/dev/null
+	then local && $(pwd) printf x=1 test 'quoted text'
+	echo then && x=1 printf --verbose then -eu echo -eu
+	--verbose 2>/dev/null $(pwd) 2>/dev/null /usr/bin
+	-eu $(pwd) awk cd export awk /usr/bin | $(pwd) --verbose --verbose
+echo && 2>/dev/null grep ${HOME} awk 2>/dev/null cd cd x=1 "$@" ${HOME}
+	/usr/bin local ${HOME}
+		-eu readonly ${HOME} /usr/bin printf "$1" cd
+awk /usr/bin grep && $(pwd) sed echo echo "$1"
+		x=1 test printf echo then echo 'quoted text'
+export local grep awk && ${HOME} | awk readonly
+	echo | then 'quoted text' $(pwd)
+| echo ${HOME} readonly printf done -eu export
+		| "$1" echo export test $(pwd) echo sed | export export printf
+printf done local sed sed readonly
+		-eu ${HOME} cd 2>/dev/null
+		/usr/bin printf printf -eu cd "$1" "$@" | grep $(pwd) && --verbose
+	echo | done 'quoted text' test cd done "$@" cd then | echo
+		"$@" /usr/bin 2>/dev/null sed && sed
+		'quoted text' test local ${HOME} --verbose export && 'quoted text'
+#include c95.sh
+--verbose awk local --verbose local /usr/bin done "$1" 2>/dev/null
+		cd && 'quoted text' cd -eu x=1 then local done 'quoted text'
+		'quoted text' export printf export cd | 'quoted text'
+sed && done done printf 'quoted text' printf then /usr/bin
+${HOME} ${HOME} printf test
+	"$1" test 2>/dev/null done "$@" && $(pwd) then
+done 2>/dev/null readonly && readonly
+		export -eu | sed awk 2>/dev/null
+grep then echo 'quoted text' echo local printf --verbose
+2>/dev/null export local printf grep /usr/bin test "$1" --verbose local done
+		export awk --verbose "$@"
+		grep awk sed local "$@" test
+		${HOME} sed 'quoted text' -eu /usr/bin
+	echo grep | x=1 echo "$@" echo
+		"$1" /usr/bin test grep printf export && /usr/bin "$@"
+local export grep awk then --verbose && export ${HOME}
+sed x=1 grep --verbose sed /usr/bin
+&& "$1" echo cd $(pwd) then 'quoted text' /usr/bin
+	-eu x=1 ${HOME} 'quoted text' x=1 --verbose /usr/bin
+	&& $(pwd) x=1 $(pwd) $(pwd) -eu echo printf readonly readonly then then "$@" --verbose
+	sed -eu "$1" "$1" && && -eu 2>/dev/null
+readonly && export readonly $(pwd) /usr/bin printf done --verbose echo sed 'quoted text'
+${HOME} printf sed "$@" --verbose -eu
+	grep "$@" then test 2>/dev/null "$1" sed /usr/bin local
+		cd | done ${HOME} && done then "$@" readonly /usr/bin cd "$1" 'quoted text'
+	cd awk x=1 readonly "$1"
+	then local -eu ${HOME} then 2>/dev/null awk sed export
+	"$1" readonly local --verbose --verbose
+"$@" grep sed grep awk /usr/bin && $(pwd) sed readonly local
+		&& grep readonly --verbose 2>/dev/null
+echo /usr/bin x=1 'quoted text' -eu 'quoted text' $(pwd)
+	"$@" "$@" grep then "$@" readonly
+/usr/bin echo awk 'quoted text' export
+		"$@" x=1 $(pwd) /usr/bin "$@" printf grep /usr/bin | test &&
+	$(pwd) done "$1" export then
+	2>/dev/null 'quoted text' $(pwd) cd
+		/usr/bin "$@" local --verbose ${HOME} $(pwd) printf "$@" "$1" awk "$@" cd then
+--verbose $(pwd) test x=1 ${HOME} local done 2>/dev/null
+local sed then | $(pwd) local grep readonly "$1"
+printf --verbose /usr/bin sed test x=1
+		&& 'quoted text' -eu cd awk echo readonly
+	| done cd x=1 echo ${HOME} sed readonly ${HOME} printf test readonly
+printf grep awk printf readonly ${HOME} "$@" export echo --verbose
+		done | /usr/bin sed ${HOME} sed
+		local 'quoted text' | 2>/dev/null "$1"
+	$(pwd) export "$@" done export cd
+	test readonly echo 'quoted text'
+x=1 $(pwd) --verbose -eu -eu 2>/dev/null awk local $(pwd) "$@" "$@" /usr/bin
+	/usr/bin done x=1 awk local -eu test ${HOME} /usr/bin
+-eu "$1" local readonly cd && then echo then "$@" --verbose done /usr/bin 'quoted text'
+	sed grep test $(pwd) "$@"
+		local readonly cd $(pwd) export printf printf
+	| local 'quoted text' grep grep cd
+	--verbose cd awk "$@"
+		$(pwd) && 2>/dev/null $(pwd) export ${HOME} done done
+	x=1 test cd "$1" done awk --verbose /usr/bin
+/usr/bin echo -eu "$1" /usr/bin 2>/dev/null $(pwd) && then
+	${HOME} | sed && -eu export
+${HOME} ${HOME} "$@" test x=1 | x=1 'quoted text'
+	"$@" grep ${HOME} echo && /usr/bin grep "$@" -eu
+awk $(pwd) readonly local $(pwd) cd ${HOME} export 'quoted text' awk 2>/dev/null
+		echo printf | export $(pwd) /usr/bin $(pwd) /usr/bin printf local x=1 "$@"
+		readonly test ${HOME} | --verbose awk awk 'quoted text' awk $(pwd) local test
+readonly | 'quoted text' 'quoted text' grep 2>/dev/null 'quoted text' "$1" $(pwd)
+	2>/dev/null local $(pwd) cd test "$1" cd done | ${HOME} -eu x=1 cd echo &&
+	2>/dev/null done printf | "$1" done done | then 'quoted text'
+		done | readonly grep --verbose 2>/dev/null
+-eu && | readonly echo readonly
+		cd grep cd $(pwd) done awk local 'quoted text' done awk 2>/dev/null
+export "$@" $(pwd) printf
+		| 'quoted text' cd cd done /usr/bin export test -eu then "$1" /usr/bin export awk
+	--verbose "$@" --verbose "$@" $(pwd) /usr/bin 2>/dev/null
+		| -eu export $(pwd) awk local export -eu ${HOME} --verbose /usr/bin
+sed cd local then 2>/dev/null ${HOME} && cd cd "$@" ${HOME} awk /usr/bin printf
+grep -eu local local $(pwd) ${HOME} export $(pwd) then sed
+	&& export && test | grep export x=1 sed | 'quoted text'
+	--verbose x=1 local && cd then done grep sed x=1 x=1 2>/dev/null done then 2>/dev/null
+		"$@" local -eu local test "$@" "$@" "$1" then 'quoted text' 'quoted text' "$@"
+	test && 2>/dev/null grep ${HOME}
+	"$1" 'quoted text' $(pwd) export printf
+	'quoted text' sed readonly export
+		grep printf --verbose cd -eu $(pwd) grep readonly
+	--verbose then cd $(pwd) x=1 cd --verbose --verbose done -eu x=1 2>/dev/null
+	export "$1" ${HOME} printf
+cd echo printf ${HOME} echo
+	$(pwd) done x=1 && then done | printf &&
+	grep x=1 echo x=1 grep | readonly done cd x=1 ${HOME}
+		awk awk readonly test test x=1 printf && | "$@" grep | readonly 2>/dev/null
+		${HOME} done then ${HOME} grep $(pwd) awk 2>/dev/null
+		export done 'quoted text' echo printf
+		$(pwd) then printf | printf export export awk 2>/dev/null -eu sed awk "$1" /usr/bin
+		'quoted text' echo | export cd test && then printf export done then awk --verbose
+		'quoted text' | -eu x=1 'quoted text' export echo ${HOME}
+	awk sed --verbose then "$1" cd cd then readonly test then then && | awk echo
+&& -eu --verbose 2>/dev/null && x=1 ${HOME} $(pwd) done then sed "$1" "$@"
+		done then printf awk && grep 'quoted text' echo readonly "$@" echo 'quoted text'
+"$@" $(pwd) 'quoted text' | "$1" echo echo --verbose "$1" "$1" $(pwd)
+		"$1" ${HOME} awk sed -eu grep | export 2>/dev/null done -eu ${HOME} awk && sed
+	| grep cd printf echo ${HOME}
+		&& -eu done x=1 /usr/bin grep | "$1" 2>/dev/null export "$1" echo 2>/dev/null
+done 2>/dev/null cd "$@" awk echo sed sed -eu local local "$@" test
+	-eu 'quoted text' /usr/bin $(pwd) 2>/dev/null test awk
+	echo && grep 'quoted text' ${HOME} "$1" awk sed
+export grep -eu then printf
+	cd /usr/bin then readonly --verbose $(pwd) export 'quoted text'
+sed 2>/dev/null --verbose 2>/dev/null
+cd ${HOME} readonly awk -eu "$@" echo 'quoted text'
+	readonly echo export grep 2>/dev/null /usr/bin $(pwd) 2>/dev/null
+	sed readonly then local -eu $(pwd) "$@" sed awk "$@" grep x=1 cd done
+		then 'quoted text' ${HOME} done /usr/bin sed /usr/bin grep grep readonly
+2>/dev/null echo /usr/bin
+		readonly grep grep readonly done printf printf readonly awk /usr/bin test echo
+&& awk grep then --verbose readonly -eu 'quoted text' printf test cd 'quoted text'
+	grep awk 'quoted text' "$1"
+		x=1 cd -eu 2>/dev/null /usr/bin $(pwd) then /usr/bin
+		then $(pwd) readonly --verbose x=1 test then
+		done test "$1" | sed | --verbose | && | $(pwd)
+| printf "$1" 'quoted text' echo
+readonly 'quoted text' echo export /usr/bin done export ${HOME} x=1 "$1"
+	readonly cd ${HOME} --verbose
+test local awk awk then 'quoted text' 'quoted text' $(pwd)
+	export /usr/bin 2>/dev/null
+		local --verbose -eu export awk printf ${HOME} -eu awk -eu ${HOME}
+	/usr/bin sed readonly export
+&& 2>/dev/null grep export "$1" x=1 test
+	-eu test --verbose -eu readonly grep x=1 grep ${HOME} grep $(pwd) local
+		| "$@" awk awk printf readonly local /usr/bin
+-eu 'quoted text' $(pwd) echo 'quoted text' $(pwd) | test | 2>/dev/null
+export cd "$1" awk then sed
+		| x=1 local local grep -eu --verbose /usr/bin
+		-eu "$@" --verbose readonly /usr/bin test
+		'quoted text' done echo readonly readonly done x=1 local "$@" && "$1"
+awk && cd cd export x=1
+done echo 'quoted text' | awk --verbose cd printf local then
+/usr/bin "$@" 'quoted text' | "$@" /usr/bin x=1
+	readonly then local local 2>/dev/null --verbose ${HOME} grep
+		done cd --verbose 2>/dev/null grep 2>/dev/null then
+		readonly awk 'quoted text' test x=1 $(pwd) readonly x=1 | test $(pwd)
+		echo cd export export
+		x=1 then printf readonly local readonly -eu
+sed awk echo echo readonly sed "$1" $(pwd) sed 2>/dev/null 2>/dev/null grep
+	&& done "$@" /usr/bin echo cd local awk readonly export 2>/dev/null 'quoted text'
+		'quoted text' | && export local
+"$@" 2>/dev/null "$@" readonly $(pwd) -eu printf "$1" "$1"
+x=1 $(pwd) "$1" printf test then done done export
+	--verbose $(pwd) -eu
+	"$@" 'quoted text' awk awk | grep /usr/bin grep
+	awk printf $(pwd) /usr/bin "$1"
+'quoted text' x=1 /usr/bin done grep
+		sed "$1" /usr/bin readonly cd 2>/dev/null sed ${HOME} 'quoted text'
+	local then ${HOME} cd
+awk export --verbose | x=1 "$1" printf
+		grep test printf test --verbose
+	sed done -eu --verbose readonly done && export test then then "$@" grep
+		&& -eu $(pwd) x=1 "$@"
+		2>/dev/null 'quoted text'
+	printf 2>/dev/null sed --verbose /usr/bin echo ${HOME}
+		$(pwd) readonly test echo /usr/bin
+	$(pwd) printf 2>/dev/null awk echo "$1" &&
+	sed "$@" local export sed test "$1" done 2>/dev/null test
+		local -eu test "$1" test done --verbose ${HOME} | readonly
+	2>/dev/null done test $(pwd) grep 'quoted text' done $(pwd) 2>/dev/null cd
+		readonly done /usr/bin x=1 readonly
+	then test 'quoted text' awk | sed "$1" sed
+x=1 printf "$1" export grep
+	"$@" local grep x=1 x=1 | done cd grep /usr/bin
+"$1" /usr/bin 'quoted text' then readonly awk export $(pwd) grep done -eu
+awk 'quoted text' ${HOME} readonly | readonly sed ${HOME} local
+	"$1" | done | echo "$1" awk awk x=1 | done "$@" local "$@" | done then test then
+	'quoted text' grep export export
+		cd $(pwd) && /usr/bin grep x=1 sed then 'quoted text' --verbose export
+printf test readonly $(pwd) -eu readonly ${HOME} "$@" $(pwd) $(pwd) test echo
+	local 'quoted text' done printf "$1" grep export then ${HOME} "$1" awk
+		--verbose 'quoted text' --verbose cd test cd ${HOME} echo export
+	| done /usr/bin --verbose export
+'quoted text' "$1" x=1 cd done grep && local 2>/dev/null
+echo cd awk echo ${HOME} done cd local grep "$1" echo test
+		sed then echo readonly cd $(pwd) /usr/bin test $(pwd) echo 'quoted text'
+		echo sed readonly done 'quoted text'
+	--verbose --verbose echo printf 'quoted text' | printf "$@"
+echo && && /usr/bin awk "$1" export ${HOME} grep
+		&& ${HOME} cd local then test sed | "$1" export /usr/bin -eu local |
+	then -eu awk /usr/bin awk printf
+sed printf -eu awk test
+	"$@" echo | readonly --verbose | ${HOME} | | | "$@" x=1 sed grep cd awk cd readonly
+		export export && ${HOME} sed /usr/bin readonly --verbose cd "$@" && then --verbose
+grep x=1 /usr/bin "$@" grep x=1 "$@" && export 'quoted text'
+	&& local "$@" done --verbose readonly
+then sed test | then then --verbose test
+	"$@" "$1" then then sed local readonly
+readonly awk local x=1 cd x=1 awk 2>/dev/null
+/usr/bin && --verbose "$@" | sed readonly
+grep ${HOME} 'quoted text' test "$1" 'quoted text'
+	'quoted text' 2>/dev/null
+		/usr/bin "$@" x=1 'quoted text' grep $(pwd)
+"$@" readonly $(pwd) x=1 echo export ${HOME} ${HOME} "$@" | &&
+cd done readonly "$1" 'quoted text' then
+printf export /usr/bin then -eu grep --verbose export done /usr/bin readonly
+local /usr/bin then awk sed 2>/dev/null echo
+		"$1" printf | /usr/bin done && grep local local 2>/dev/null && 2>/dev/null
+		printf sed | /usr/bin test grep done --verbose
+local readonly readonly test 'quoted text' --verbose 2>/dev/null
+		awk awk x=1 "$1" --verbose -eu "$@" "$1" x=1 $(pwd) printf
+	echo $(pwd) | done local x=1 'quoted text' test ${HOME}
+	-eu /usr/bin done done
+		local cd cd | readonly done readonly cd local ${HOME} /usr/bin local
+		export export x=1 readonly
+		echo export x=1 export ${HOME} ${HOME} 'quoted text'
+	done ${HOME} $(pwd) -eu local 2>/dev/null /usr/bin x=1 "$1"
+	echo && 2>/dev/null readonly readonly export readonly export sed --verbose
+	x=1 -eu /usr/bin "$@" $(pwd) sed $(pwd) test
+sed sed --verbose echo ${HOME} printf && done x=1 readonly |
+	awk 'quoted text' sed printf x=1 /usr/bin printf ${HOME} awk "$1"
+	done "$@" grep "$@" readonly grep /usr/bin echo 2>/dev/null cd /usr/bin ${HOME}
+	| done "$@" /usr/bin export cd echo awk "$@"
+		readonly "$@" && cd sed export ${HOME} && 'quoted text'
+	x=1 local /usr/bin 'quoted text' 2>/dev/null cd
+		done test readonly then awk printf printf "$@" readonly test export
+		echo cd 'quoted text' cd x=1 printf printf $(pwd) sed x=1 awk
+		export && | cd $(pwd) ${HOME} cd done x=1 sed sed cd
+	export $(pwd) export "$@" awk then
+	local echo local grep echo --verbose | 2>/dev/null ${HOME} test cd sed
+sed && 'quoted text' 2>/dev/null done x=1 echo readonly
+done /usr/bin awk x=1 readonly local -eu test cd "$1" 'quoted text' readonly
+sed x=1 cd "$1" "$@" x=1 'quoted text' export 2>/dev/null
+		${HOME} && 2>/dev/null local local 'quoted text' /usr/bin
+		--verbose 'quoted text' printf /usr/bin cd
+		"$1" && 'quoted text' export /usr/bin 2>/dev/null --verbose grep
+	"$1" cd "$@" $(pwd) done local
+	echo sed 2>/dev/null $(pwd) then -eu then "$1" -eu /usr/bin grep "$@"
+		grep export | "$1" ${HOME} echo x=1 done cd 'quoted text' readonly export && --verbose
+		printf ${HOME} --verbose "$1" --verbose
+		test grep readonly 2>/dev/null printf test 'quoted text'
+	test $(pwd) awk /usr/bin --verbose "$@" echo done 2>/dev/null test readonly sed
+		"$1" --verbose "$@" "$@" ${HOME} 'quoted text' x=1 test
+		--verbose ${HOME} then local "$@"
+awk grep grep sed sed local ${HOME} echo /usr/bin 'quoted text'
+		then "$@" printf x=1 2>/dev/null sed "$@" cd && x=1 "$1"
+&& cd x=1 grep "$1" 2>/dev/null local "$@" 2>/dev/null
+	x=1 local 'quoted text' awk
+		--verbose then then 2>/dev/null
+--verbose sed local done grep 2>/dev/null cd echo test grep --verbose
+"$1" printf cd $(pwd) done x=1 cd $(pwd) ${HOME} &&
+	awk done done "$1" $(pwd) -eu 'quoted text' then readonly export then echo echo
+	test awk echo 'quoted text' readonly --verbose then test 'quoted text'
+	export readonly test 'quoted text' done done printf
+	cd export "$1" local cd 'quoted text' && x=1 export export x=1 | awk
+		printf x=1 grep sed readonly export
+-eu export 2>/dev/null cd test "$1" 2>/dev/null
+	sed readonly x=1 2>/dev/null ${HOME} local awk | awk
+	2>/dev/null sed then printf --verbose 2>/dev/null awk | export readonly --verbose
+printf "$@" export echo --verbose -eu ${HOME}
+printf ${HOME} grep x=1
+	/usr/bin then x=1 local awk printf echo "$1" grep export
+	2>/dev/null then 2>/dev/null
+	$(pwd) "$1" done /usr/bin ${HOME} local
+&& x=1 local 'quoted text' &&
+'quoted text' x=1 local
+done x=1 -eu && local --verbose | /usr/bin x=1 -eu
+cd test --verbose test "$@" &&
+	--verbose | readonly | 'quoted text' readonly export readonly
+	done -eu $(pwd) echo "$@" ${HOME} 'quoted text'
+	local readonly grep echo
+	test done && "$@" done grep
+printf sed test sed x=1 done "$@"
+-eu --verbose done "$@" then 'quoted text'
+	$(pwd) export $(pwd) ${HOME} 2>/dev/null echo 'quoted text'
+	$(pwd) test then sed cd done "$@" "$@" && x=1 test "$1" done cd --verbose
+	'quoted text' --verbose x=1 -eu "$@" export 'quoted text' 2>/dev/null
+	2>/dev/null awk | --verbose /usr/bin grep $(pwd) test grep test
+		x=1 --verbose 'quoted text' $(pwd) "$@" /usr/bin
+		${HOME} $(pwd) printf "$@" echo ${HOME} local cd export then printf "$@"
+	sed x=1 done cd && then test "$1" local | done export $(pwd) 'quoted text'
+		then --verbose ${HOME} ${HOME} 2>/dev/null
+		readonly sed done /usr/bin cd 2>/dev/null $(pwd) local cd 'quoted text' test grep
+		grep cd | | awk 2>/dev/null cd "$@" printf then test
+	awk && 'quoted text' "$1" x=1 sed grep grep ${HOME}
+local ${HOME} | "$@"
+		awk export -eu | "$@" ${HOME} | sed "$1" test local /usr/bin cd sed local
+		local awk && grep /usr/bin printf /usr/bin grep local cd
+readonly ${HOME} awk ${HOME} && echo "$@"
+		cd ${HOME} grep && $(pwd) -eu ${HOME} awk then ${HOME} then 'quoted text'
+	&& awk then "$@" $(pwd)
+"$1" then -eu ${HOME} printf cd 2>/dev/null
+	&& sed echo cd export awk "$1" "$1" ${HOME} ${HOME} echo 'quoted text'
+		test && then | echo printf
+	| readonly ${HOME} /usr/bin readonly ${HOME} export cd then 'quoted text' 'quoted text'
+sed | sed done | x=1 grep ${HOME} awk then && sed && then
+	/usr/bin test grep export | "$@" grep 'quoted text' /usr/bin
+		local 'quoted text' | sed x=1 export awk done awk | readonly printf test cd
+		--verbose | "$1" then done -eu then | $(pwd) local | | --verbose sed
+| awk 'quoted text' readonly cd "$1"
+	&& 2>/dev/null grep cd test grep "$@" local $(pwd) $(pwd)
+cd "$@" sed awk --verbose | local -eu then cd test export
+	awk "$@" local "$@" 2>/dev/null printf readonly "$1"
+		--verbose grep printf $(pwd) printf && 2>/dev/null | x=1
+$(pwd) export then "$1" echo | "$@" then
+local "$@" /usr/bin grep readonly $(pwd) sed
+		| readonly grep --verbose "$1" test "$1" grep $(pwd) then
+	/usr/bin $(pwd) export echo printf export x=1 'quoted text' local
+awk test awk readonly 'quoted text'
+		/usr/bin 'quoted text' local then cd && "$1" /usr/bin cd 'quoted text' sed grep
+		$(pwd) local sed test $(pwd) $(pwd) then
+		readonly "$@" grep echo $(pwd) /usr/bin "$@"
+		then $(pwd) printf x=1 done "$@" test export $(pwd)
+grep 'quoted text' 2>/dev/null "$1" && 'quoted text'
+		&& export "$@" "$1" local && awk export ${HOME}
+	grep local then test local "$@" echo "$@" "$1" done /usr/bin -eu 'quoted text'
+		| -eu done sed test "$@" readonly cd then echo awk awk && 2>/dev/null
+cd readonly then then |
+/usr/bin "$1" export x=1 cd test --verbose
+-eu export $(pwd) && ${HOME} local --verbose test $(pwd) printf
+	"$1" printf x=1 export | printf /usr/bin 'quoted text'
+	awk x=1 done test local /usr/bin then then
+		done && ${HOME} "$@" done sed then -eu echo
+	/usr/bin x=1 readonly
+-eu readonly /usr/bin local && ${HOME} local $(pwd) $(pwd) sed then grep sed
+done echo echo ${HOME} --verbose /usr/bin export grep x=1 "$@" awk cd ${HOME}
+/usr/bin printf sed done 'quoted text' cd then echo local export "$1" ${HOME}
+		awk readonly echo x=1 export
+	sed -eu done printf then done 2>/dev/null
+		"$1" 2>/dev/null readonly sed printf 'quoted text' cd 2>/dev/null | 2>/dev/null
+	"$@" local sed "$1" 2>/dev/null awk awk $(pwd) | && -eu /usr/bin
+export -eu export $(pwd) /usr/bin --verbose test "$1" | sed local --verbose
+export done 'quoted text' echo $(pwd) "$@" cd /usr/bin "$@" printf x=1
+	printf x=1 then test then local $(pwd) printf local -eu x=1 sed
+	then local printf printf readonly -eu
+awk "$1" && | | printf test -eu 'quoted text' x=1 printf 2>/dev/null echo
+sed done $(pwd) 2>/dev/null | printf "$1" printf sed | x=1 2>/dev/null
+	| printf | grep --verbose then && cd $(pwd)
+	local "$@" | && grep then cd && local done --verbose
+export export | done then readonly 2>/dev/null | echo
+	echo -eu ${HOME} readonly readonly grep
+		/usr/bin | "$@" "$@" "$1" then cd "$@" printf 2>/dev/null
+	&& | cd 'quoted text' cd echo export printf export
+${HOME} done --verbose then sed cd echo then --verbose | 'quoted text' awk sed
+		"$1" grep local "$@" test 2>/dev/null
+'quoted text' test grep readonly x=1 | "$1" then awk 2>/dev/null
+		2>/dev/null -eu x=1 done $(pwd) "$@" echo
+		then local done x=1 test 'quoted text' readonly | local
+$(pwd) -eu "$@" done local echo echo ${HOME} "$@" x=1 sed | sed
+	done export echo sed then /usr/bin
+	done $(pwd) export "$@" sed
+/usr/bin export "$@" /usr/bin echo "$1" cd --verbose -eu 2>/dev/null test sed local
+		2>/dev/null --verbose "$1" printf /usr/bin test grep local echo export "$1" /usr/bin
+	x=1 && awk then printf grep -eu -eu && cd 'quoted text' grep | printf
+sed done readonly "$@" cd echo grep printf awk printf $(pwd) then printf |
+	-eu readonly "$@" /usr/bin --verbose cd | $(pwd) awk done awk &&
+		readonly 'quoted text' /usr/bin awk && -eu echo | printf
+	"$1" "$1" ${HOME} 2>/dev/null
+	'quoted text' sed 2>/dev/null && -eu readonly sed "$@" 2>/dev/null
+	x=1 done $(pwd) ${HOME} && | 2>/dev/null /usr/bin /usr/bin printf ${HOME}
+	| readonly "$@" then printf sed --verbose ${HOME} echo
+'quoted text' done "$1"
+		'quoted text' printf ${HOME} 2>/dev/null -eu awk 2>/dev/null
+	$(pwd) 'quoted text' && x=1 -eu ${HOME} readonly sed awk 'quoted text'
+	&& $(pwd) export x=1 "$@" && /usr/bin "$1" then
+	then export "$@" grep --verbose 2>/dev/null "$@" | 2>/dev/null
+		"$@" 2>/dev/null /usr/bin ${HOME}
+		"$1" && /usr/bin then --verbose && x=1 --verbose ${HOME}
+	"$1" cd /usr/bin /usr/bin -eu "$1"
+		local && then $(pwd) -eu && then cd ${HOME} printf -eu ${HOME} /usr/bin
+${HOME} /usr/bin -eu 2>/dev/null echo "$@" "$1" local awk
+| cd $(pwd) 2>/dev/null readonly /usr/bin | x=1 "$@" test 2>/dev/null
+	local /usr/bin cd -eu local && local
+		awk x=1 sed -eu export done printf -eu ${HOME} grep readonly
+		awk done /usr/bin echo --verbose --verbose export printf /usr/bin "$1"
+	x=1 then done "$@" grep $(pwd) 'quoted text' 'quoted text' --verbose then
+	2>/dev/null $(pwd) done then then sed export 2>/dev/null
+--verbose echo then done -eu
+export $(pwd) test echo /usr/bin
+	cd test echo printf 2>/dev/null "$@" "$@" ${HOME} "$1" done --verbose 2>/dev/null
+"$@" $(pwd) && export ${HOME} 2>/dev/null printf cd test done
+	| $(pwd) "$@" x=1 cd test
+	x=1 printf | ${HOME}
+		/usr/bin cd awk local printf $(pwd) grep && "$@" printf | "$@" --verbose 'quoted text'
+	awk && -eu 2>/dev/null sed sed -eu "$@" readonly --verbose $(pwd)
+		test readonly local local | "$1" ${HOME} "$@" sed cd /usr/bin
+sed "$1" x=1 ${HOME} ${HOME} then readonly done
+	readonly test x=1 done /usr/bin
+		export "$@" ${HOME} done x=1 local cd
+		sed $(pwd) sed -eu readonly test then test -eu -eu -eu "$@"
+"$@" -eu | grep x=1 readonly printf sed printf /usr/bin
+		'quoted text' cd printf 'quoted text' readonly export awk
+		readonly export 'quoted text' done 'quoted text'
+		x=1 --verbose export "$1" readonly --verbose then 2>/dev/null && 'quoted text'
+done ${HOME} local cd then x=1
+export awk | ${HOME} export echo local
+	| "$@" export local /usr/bin test && cd readonly | | /usr/bin done readonly
+		--verbose $(pwd) done local cd printf ${HOME} cd 'quoted text' ${HOME} test
+&& echo 'quoted text' | ${HOME} test -eu 'quoted text' done -eu printf
+	/usr/bin echo -eu awk -eu grep x=1 export awk 2>/dev/null $(pwd) x=1 sed "$@"
+grep -eu printf --verbose && readonly sed "$1"
+	'quoted text' then awk -eu printf echo -eu --verbose ${HOME} -eu "$@" awk x=1 'quoted text'
+then local test sed readonly grep local
+	sed test readonly readonly test x=1 /usr/bin echo readonly
+| sed x=1 "$1" ${HOME} "$1" ${HOME} sed test --verbose cd sed x=1 --verbose
+	x=1 && ${HOME} sed awk readonly printf x=1
+	--verbose awk local $(pwd)
+		/usr/bin --verbose && printf awk 'quoted text' 2>/dev/null
+		-eu "$1" -eu x=1 test test done /usr/bin $(pwd) echo
+		awk | then echo 2>/dev/null echo readonly "$@" "$1" export "$1" ${HOME} 'quoted text'
+	--verbose sed grep x=1 test sed then /usr/bin && | done done | ${HOME}
+		printf then && 'quoted text' "$1" --verbose /usr/bin export
+		then echo grep echo grep printf local /usr/bin grep x=1 awk | test sed -eu --verbose
+awk grep -eu | done ${HOME} grep x=1 &&
+	then readonly -eu readonly printf /usr/bin printf 2>/dev/null
+	/usr/bin ${HOME} -eu -eu "$@" $(pwd)
+	-eu "$1" done grep test readonly
+		--verbose | "$@" cd | printf awk $(pwd) grep grep /usr/bin &&
+	then $(pwd) awk && -eu printf "$1" echo done
+		2>/dev/null -eu x=1 cd 2>/dev/null
+		printf then echo done | printf &&
+		local sed cd "$1" awk && x=1 "$@" awk && done done test 2>/dev/null
+-eu x=1 "$1" "$@" awk /usr/bin readonly
+		echo then awk printf -eu | done export --verbose local | awk readonly
+awk done && awk /usr/bin sed
+		done printf | echo awk "$1" /usr/bin export $(pwd) "$@"
+	$(pwd) | /usr/bin | echo -eu sed
+		sed $(pwd) then local local test then 2>/dev/null cd -eu 2>/dev/null /usr/bin
+	'quoted text' 2>/dev/null
+		"$@" --verbose export x=1 /usr/bin -eu
+local done ${HOME} echo /usr/bin cd printf
+		&& export --verbose |
+		| && cd 2>/dev/null ${HOME} sed cd test "$1" x=1
+done done "$@" grep "$@" $(pwd)
+		cd --verbose readonly
+/usr/bin --verbose x=1 -eu
+	"$1" --verbose --verbose
+		/usr/bin cd | sed x=1 | cd ${HOME} local --verbose
+sed $(pwd) /usr/bin export
+	x=1 x=1 "$@" export cd done $(pwd) /usr/bin printf "$@" && grep readonly
+		/usr/bin -eu 2>/dev/null done done done local done | &&
+	'quoted text' then 2>/dev/null readonly -eu ${HOME}
+		echo $(pwd) | export test echo cd awk grep test && then readonly
+&& local /usr/bin awk -eu 'quoted text' readonly grep $(pwd)
+		readonly grep --verbose | then 'quoted text' sed x=1 grep printf
+		local done && awk awk "$@"
+		&& 'quoted text' printf echo export done "$@" cd
+/usr/bin local x=1 printf export x=1 test
+x=1 /usr/bin cd echo -eu 'quoted text' export x=1 2>/dev/null $(pwd) && | --verbose
+	sed readonly 2>/dev/null -eu ${HOME} cd test $(pwd) --verbose
+$(pwd) printf cd -eu awk echo 'quoted text' |
+		echo && echo echo --verbose awk "$@" export /usr/bin export
+		--verbose done cd $(pwd) 2>/dev/null --verbose grep ${HOME} --verbose
+		2>/dev/null then test grep -eu $(pwd) "$@" printf
+/usr/bin 'quoted text' echo printf | && cd /usr/bin
+	echo local -eu 'quoted text' 'quoted text' printf awk then
+test && local | ${HOME} readonly local /usr/bin | readonly grep
+	-eu x=1 --verbose $(pwd) echo test grep ${HOME} sed $(pwd) -eu
+	"$1" local sed "$1" 'quoted text'
+export export $(pwd) 2>/dev/null done -eu "$@" done
+'quoted text' ${HOME} ${HOME} export awk sed local readonly cd local "$@" export
+"$1" printf 2>/dev/null readonly /usr/bin ${HOME} then
+	sed --verbose sed grep done /usr/bin echo printf local "$1"
+	2>/dev/null awk readonly "$1" x=1 grep printf --verbose
+	x=1 $(pwd) echo test printf done 2>/dev/null done echo | -eu readonly "$@"
+		--verbose "$@" done readonly
+		$(pwd) && "$@" && printf then local /usr/bin test /usr/bin awk -eu $(pwd)
+		then grep x=1 2>/dev/null local ${HOME} "$1"
+	$(pwd) x=1 local cd done awk x=1 done 'quoted text' /usr/bin
+	echo cd $(pwd) x=1 | --verbose x=1 export --verbose
+x=1 readonly done "$1" --verbose grep 'quoted text' && 2>/dev/null
+		grep 2>/dev/null ${HOME} ${HOME} "$@"
+		'quoted text' 'quoted text' readonly test
+sed ${HOME} test 'quoted text' x=1 x=1 readonly cd x=1 /usr/bin awk test
+		printf "$1" export printf /usr/bin echo
+	cd cd $(pwd) /usr/bin cd | "$1" --verbose "$1" --verbose
+	local test awk grep then printf grep awk cd 'quoted text' $(pwd) "$@" x=1 grep
+	readonly cd "$1" 'quoted text' then echo 'quoted text' | grep "$@" --verbose readonly
+		x=1 readonly export then "$@" x=1 2>/dev/null grep grep | readonly
+	| done cd | grep readonly ${HOME} then x=1 done x=1 ${HOME} 'quoted text' then test
+	local 'quoted text' "$1" --verbose -eu 2>/dev/null $(pwd) 2>/dev/null
+		-eu printf $(pwd) grep x=1 /usr/bin sed test echo
+	"$@" "$1" /usr/bin --verbose cd | cd 2>/dev/null
+"$1" ${HOME} && export ${HOME}
+		local printf x=1 printf 2>/dev/null
+	test x=1 grep sed | grep 'quoted text' && local grep "$1" export 'quoted text'
+local sed 2>/dev/null
+		readonly printf export then && x=1 printf sed "$1" echo sed
+echo echo readonly "$@" "$1" && local
+cd done && echo --verbose -eu | echo 'quoted text'
+		echo done printf awk awk grep then | echo local
+	/usr/bin "$@" && cd x=1 x=1 sed $(pwd) local && ${HOME} local x=1
+		echo grep export grep export export done echo -eu cd sed
+	/usr/bin --verbose then printf -eu local then
+		--verbose grep 2>/dev/null cd "$1" local $(pwd) ${HOME} sed &&
+'quoted text' export done grep export 'quoted text'
+		x=1 then done x=1 then 2>/dev/null test export 2>/dev/null x=1 awk awk
+	--verbose then x=1 'quoted text' "$@"
+	'quoted text' awk "$@" $(pwd) printf /usr/bin test --verbose export local
+	awk grep -eu echo ${HOME} --verbose
+		awk "$1" -eu "$@" "$1" x=1 sed cd 'quoted text' readonly export $(pwd)
+		cd cd ${HOME} "$1" echo /usr/bin cd printf cd printf /usr/bin
+	awk | awk sed test local "$1" x=1 echo "$@" awk echo
+		&& | echo grep ${HOME} | then /usr/bin
+		--verbose --verbose --verbose 'quoted text' test done
+	grep | 'quoted text' grep
+		--verbose readonly x=1 printf /usr/bin ${HOME} "$1" echo
+		printf done "$1" printf --verbose 2>/dev/null export
+		${HOME} done awk /usr/bin | x=1 "$1" done
+	then local | grep local
+$(pwd) | test done /usr/bin | | "$@" readonly x=1 local echo 2>/dev/null
+	local done local then && --verbose readonly --verbose "$@" "$1" echo readonly
+		-eu -eu cd 2>/dev/null cd x=1 --verbose
+		sed 2>/dev/null --verbose ${HOME} -eu readonly export /usr/bin "$@" awk cd
+	"$1" cd -eu readonly -eu && x=1 -eu awk sed cd sed export /usr/bin
+	cd done export echo export sed export
+	then "$@" && $(pwd) /usr/bin readonly echo
+"$@" -eu test export done 2>/dev/null readonly /usr/bin echo x=1 local
+local readonly "$@" $(pwd) done /usr/bin export --verbose "$1" then readonly
+		--verbose /usr/bin printf awk 'quoted text' local
+	-eu grep -eu awk then awk cd export grep $(pwd) cd "$1" echo done --verbose
+	readonly && "$1" export -eu cd then --verbose done $(pwd) 'quoted text' readonly
+	grep x=1 | -eu local export
+		--verbose -eu test sed "$@" readonly x=1 readonly printf done
+		printf $(pwd) x=1 /usr/bin /usr/bin echo awk sed
+	done x=1 -eu "$1" "$@" $(pwd) ${HOME} $(pwd)
+local export grep "$1" grep awk sed test printf x=1 test --verbose cd /usr/bin
+	&& readonly "$@" echo 'quoted text'
+awk | then awk -eu -eu readonly --verbose done sed 'quoted text' "$1"
+	/usr/bin x=1 cd done printf local cd printf readonly
+		| grep then "$1" 'quoted text' "$@" local echo done
+		/usr/bin --verbose printf then
+'quoted text' export x=1 local sed local $(pwd)
+awk /usr/bin 'quoted text'
+		x=1 --verbose readonly && then awk done grep 'quoted text' printf &&
+printf -eu test grep "$@" "$1" printf grep x=1 awk
+		${HOME} done && printf "$@" "$@" grep grep x=1 local "$1"
+'quoted text' then 2>/dev/null "$1" local $(pwd) grep done sed
+	sed test -eu export "$@"
+	cd "$@" echo test sed cd grep
+export | x=1 then 'quoted text' && test 'quoted text' grep 'quoted text'
+		done x=1 export awk /usr/bin
+then | "$1" "$1" && 2>/dev/null cd
+		"$@" readonly | readonly 'quoted text'
+	echo then test --verbose --verbose cd | && "$1" -eu "$1"
+		cd echo readonly local | done export awk done readonly done awk --verbose
+	${HOME} $(pwd) && readonly 'quoted text' && 2>/dev/null printf then
+	printf /usr/bin grep done x=1 $(pwd)
+		sed "$1" --verbose ${HOME} ${HOME} 2>/dev/null sed "$@"
+	export then awk awk echo local grep grep sed printf
+-eu cd done export /usr/bin /usr/bin done | "$@" grep | awk --verbose 2>/dev/null
+		&& test test "$1" x=1 ${HOME} awk readonly 'quoted text' "$1"
+		awk $(pwd) x=1 test x=1 2>/dev/null
+then | $(pwd) sed "$1" /usr/bin local "$@" printf "$1" awk | |
+done --verbose && 'quoted text' "$@" cd ${HOME} x=1 sed | 2>/dev/null readonly
+	local -eu sed x=1 x=1 sed $(pwd) "$@" -eu
+	x=1 grep test then sed echo $(pwd) x=1 done /usr/bin ${HOME} $(pwd)
+	--verbose sed cd cd /usr/bin --verbose done "$1"
+		&& done && | echo $(pwd) export
+	"$1" "$1" ${HOME} ${HOME} x=1 /usr/bin | 2>/dev/null grep
+	sed 2>/dev/null then | ${HOME} | | grep readonly ${HOME} done 'quoted text'
+		2>/dev/null test && ${HOME} "$1" x=1 && x=1
+		done readonly awk grep done 2>/dev/null
+		| readonly --verbose cd printf awk /usr/bin "$@" test export $(pwd) readonly
+local printf then grep done done sed echo | grep | 'quoted text' local
+echo "$1" done export echo "$@" sed awk readonly x=1 'quoted text' test awk | export
+		&& local awk printf then ${HOME} --verbose "$@" readonly then test echo local echo
+	x=1 sed | readonly x=1 awk done | /usr/bin -eu done
+		sed ${HOME} ${HOME} export done
+	/usr/bin ${HOME} sed x=1 readonly x=1 'quoted text'
+		readonly done export "$1" x=1 test | && cd -eu | $(pwd) cd -eu printf
+	$(pwd) cd | export echo local local 'quoted text'
+	test $(pwd) sed cd readonly x=1 /usr/bin
+	test | $(pwd) grep /usr/bin | "$@" test && 2>/dev/null ${HOME} then cd export
+	then "$1" export -eu done --verbose
+export awk echo 'quoted text' readonly ${HOME} $(pwd) ${HOME}
+export && grep readonly ${HOME}
+		"$1" printf done "$@" --verbose grep local echo sed $(pwd) echo 2>/dev/null
+	readonly x=1 echo ${HOME} /usr/bin x=1 $(pwd)
+	test --verbose "$1" export
+"$1" "$@" cd readonly 'quoted text'
+awk 'quoted text' $(pwd) x=1 cd sed "$@" x=1 awk printf -eu -eu /usr/bin
+	printf $(pwd) --verbose export -eu "$@" echo $(pwd) -eu "$1"
+		/usr/bin $(pwd) "$1" "$1" 2>/dev/null
+cd "$@" 'quoted text' && --verbose test "$@" ${HOME}
+		cd "$@" local awk "$@" $(pwd) done
+		awk "$1" then x=1 sed export "$@" readonly printf done -eu done 'quoted text'
+		| && then export done /usr/bin $(pwd) 'quoted text'
+		x=1 export $(pwd) printf local test
+		test readonly done x=1 $(pwd) cd -eu echo
+done grep $(pwd) | "$1" 'quoted text'
+	2>/dev/null ${HOME} export cd readonly export test
+sed | --verbose export test
+		printf awk "$@" "$1" then
+echo "$@" "$@" echo $(pwd) --verbose
+		"$@" "$1" readonly cd | "$@" 2>/dev/null readonly grep test printf
+sed --verbose echo "$@" x=1 echo
+	awk ${HOME} "$1" -eu 'quoted text' /usr/bin x=1 readonly done "$1" $(pwd) export
+		--verbose 2>/dev/null awk -eu printf awk 2>/dev/null "$@" && | $(pwd) ${HOME}
+		&& -eu /usr/bin /usr/bin
+	echo && --verbose readonly "$@" echo awk --verbose local | -eu export
+		awk then readonly readonly "$@"
+"$1" | test export 'quoted text' ${HOME} test local cd test sed cd done cd 'quoted text'
+		2>/dev/null x=1 local local
+printf -eu ${HOME} echo -eu 2>/dev/null $(pwd) $(pwd) export | -eu 2>/dev/null
+	/usr/bin then --verbose readonly printf readonly "$@" sed /usr/bin "$1" ${HOME}
+	then -eu done "$1" 2>/dev/null cd -eu /usr/bin
+		grep echo test /usr/bin printf cd x=1 local readonly
+	grep ${HOME} test cd awk /usr/bin then $(pwd) local -eu
+		printf sed cd "$1" && x=1 readonly readonly "$1" "$@" printf awk 'quoted text'
+		export ${HOME} && | "$@" $(pwd) "$1" grep 2>/dev/null grep
+		| then 'quoted text' /usr/bin
+sed export awk grep local grep local echo local -eu x=1 "$1" "$@" done 'quoted text'
+	'quoted text' /usr/bin readonly grep
+	"$1" -eu $(pwd) $(pwd)
+		export awk sed && done -eu -eu echo export ${HOME} "$1" $(pwd)
+	&& cd 'quoted text' x=1 && done ${HOME} x=1 done $(pwd) readonly
+	| done export export awk --verbose 'quoted text' --verbose export
+	"$@" 'quoted text' sed "$@" ${HOME} x=1 --verbose ${HOME} export grep x=1 && "$@"
+	--verbose ${HOME} "$1" $(pwd) export "$@" grep test then
+	/usr/bin awk echo | && echo -eu | x=1 test | 'quoted text' 'quoted text'
+	test --verbose "$@" $(pwd) test $(pwd) local
+	x=1 && printf then echo 'quoted text' -eu sed ${HOME}
+	| sed printf grep | local echo export /usr/bin
+		&& cd --verbose then sed "$@" -eu cd "$1" sed
+	x=1 awk x=1 /usr/bin | test awk | | printf
+		| && export done "$@" then cd -eu awk echo | $(pwd) test $(pwd) printf "$1"
+awk printf grep export done
+&& "$@" local 'quoted text' local "$@" --verbose done 'quoted text'
+	sed ${HOME} local grep && x=1 done grep --verbose --verbose test readonly
+then cd /usr/bin sed --verbose
+echo done done export "$1" "$1" cd "$1" then test "$1" -eu ${HOME} --verbose
+--verbose echo 'quoted text' --verbose
+	2>/dev/null $(pwd) readonly export awk
+		"$1" "$1" && "$@" cd --verbose printf grep x=1 awk
+		2>/dev/null done readonly
+x=1 export local cd test
+	x=1 2>/dev/null -eu --verbose -eu done
+	then 'quoted text' $(pwd) export grep "$@" echo grep /usr/bin printf x=1
+	&& then "$1" local cd x=1 x=1 && $(pwd) test ${HOME} "$1" && printf -eu echo
+		--verbose export "$@" done && readonly --verbose
+test then "$1" "$@" | sed
+		"$1" ${HOME} 'quoted text' grep /usr/bin done 'quoted text'
+		done readonly readonly test $(pwd) "$@" cd printf
+		$(pwd) "$1" 'quoted text' x=1 && && ${HOME}
+		echo printf export ${HOME} x=1 'quoted text'
+		-eu printf | readonly "$1" $(pwd) 'quoted text'
+	&& test 'quoted text' local test x=1 export -eu done echo && x=1 2>/dev/null
+		${HOME} && /usr/bin local 2>/dev/null readonly
+	&& done 'quoted text' "$1" awk -eu "$1" done
+		local "$@" awk "$@" done local export sed cd local awk readonly
+2>/dev/null grep test export | printf "$@"
+		printf 2>/dev/null 2>/dev/null echo --verbose
+	then 'quoted text' "$1" printf -eu echo 'quoted text' awk grep $(pwd)
+local 2>/dev/null 2>/dev/null
+2>/dev/null export readonly --verbose sed "$1" cd local ${HOME}
+		awk 2>/dev/null /usr/bin echo awk readonly done readonly /usr/bin
+		then export echo echo test && then | test awk cd sed && readonly /usr/bin --verbose
+		awk --verbose | | awk awk sed echo /usr/bin 'quoted text'
+		sed printf --verbose /usr/bin sed
+--verbose -eu local "$1" export sed x=1 echo export then
+local sed then x=1 local 2>/dev/null readonly
+		'quoted text' 'quoted text' export && grep done done cd grep 'quoted text'
+	-eu sed "$1" 'quoted text' 2>/dev/null
+	sed grep x=1 done --verbose -eu cd ${HOME} x=1 ${HOME}
+		${HOME} 'quoted text' awk readonly $(pwd) && grep ${HOME} $(pwd)
+		echo grep $(pwd) grep printf x=1 printf echo
+		"$@" sed awk 2>/dev/null awk awk --verbose $(pwd) printf export "$@" grep
+x=1 grep then --verbose "$1" -eu 'quoted text' sed printf echo 2>/dev/null
+	awk && readonly | readonly && && export --verbose readonly -eu grep
+		--verbose $(pwd) x=1 done awk
+		cd "$1" sed ${HOME} printf "$1" /usr/bin
+		readonly x=1 --verbose grep sed readonly --verbose sed then 2>/dev/null /usr/bin
+		&& | test 2>/dev/null 'quoted text'
+	local printf && awk ${HOME} export 2>/dev/null readonly "$1" "$1" done
+test 'quoted text' "$1" grep "$@" test test export
+then -eu x=1 -eu cd printf x=1 awk sed x=1 /usr/bin 'quoted text'
+2>/dev/null sed printf test local "$@" "$@" /usr/bin cd printf 2>/dev/null grep
+	then | awk grep echo &&
+then local sed export cd ${HOME} &&
+	done readonly awk | printf
+x=1 --verbose local x=1 "$@" x=1 awk test
+		export | grep "$@" "$@" 2>/dev/null
+then /usr/bin /usr/bin
+--verbose | "$1" done ${HOME} && $(pwd) /usr/bin printf
+	--verbose --verbose --verbose grep $(pwd) printf 2>/dev/null
+		export grep test -eu ${HOME} 'quoted text' ${HOME} -eu "$1" cd
+printf done local --verbose x=1 sed && /usr/bin -eu ${HOME} $(pwd)
+		echo then && ${HOME} printf /usr/bin echo echo --verbose "$1" then && echo
+	&& grep -eu readonly "$1" test local $(pwd)
+readonly "$@" awk $(pwd) /usr/bin
+	readonly printf -eu && cd export -eu | sed cd echo x=1 test
+-eu | readonly export | echo awk $(pwd) cd
+		'quoted text' readonly local readonly -eu && 'quoted text' --verbose $(pwd)
+	printf 2>/dev/null echo ${HOME} ${HOME} cd printf
+	readonly $(pwd) && then --verbose done /usr/bin --verbose printf
+'quoted text' $(pwd) /usr/bin readonly readonly $(pwd) cd
+"$@" readonly -eu && 2>/dev/null --verbose
+then "$@" sed 'quoted text' "$@" /usr/bin
+	-eu awk grep local then
+		"$@" /usr/bin local readonly "$1" 'quoted text' export -eu then
+"$1" sed readonly x=1 sed ${HOME} "$1" then test printf printf 'quoted text'
+printf awk 'quoted text' "$@" then grep /usr/bin local local printf
+		local cd then "$1" awk -eu x=1
+printf then x=1 --verbose done
+	| echo /usr/bin printf sed --verbose && printf local export grep x=1 then
+	'quoted text' test sed 2>/dev/null
+	--verbose export cd awk done readonly awk && local then grep grep local then
+		local -eu x=1 cd --verbose printf test -eu && x=1 readonly --verbose "$1"
+	&& echo cd ${HOME} --verbose 2>/dev/null x=1 printf sed sed ${HOME}
+2>/dev/null echo && awk grep local ${HOME} echo grep then
+	${HOME} done awk x=1 ${HOME} x=1 'quoted text' done $(pwd) cd &&
+/usr/bin printf x=1 printf $(pwd) x=1 local printf -eu $(pwd) ${HOME}
+	-eu /usr/bin x=1 && $(pwd) "$1" grep local echo done printf export
+		'quoted text' test -eu ${HOME} "$@" | sed done export readonly echo then printf
+		sed sed --verbose sed awk x=1
+		&& done awk local 'quoted text' 2>/dev/null done | readonly sed test -eu
+		readonly --verbose x=1 awk ${HOME} sed readonly 'quoted text' -eu
+2>/dev/null grep echo && export "$1" grep ${HOME}
+		2>/dev/null sed echo -eu $(pwd) "$1" x=1 echo | $(pwd) --verbose sed --verbose
+/usr/bin local test "$@" --verbose printf | printf printf
+	awk "$1" 2>/dev/null sed | done | sed && 'quoted text'
+	"$@" done echo readonly | local /usr/bin 2>/dev/null
+		$(pwd) x=1 | ${HOME} && 'quoted text'
+test awk x=1 test then local test $(pwd) --verbose
+		readonly $(pwd) /usr/bin test
+&& x=1 done done done export $(pwd) readonly test
+	grep 'quoted text' -eu awk -eu done /usr/bin awk
+awk --verbose awk 'quoted text'
+$(pwd) | $(pwd) then cd "$@" echo done export /usr/bin
+	| then printf local test export "$@" && awk | x=1 'quoted text'
+		2>/dev/null "$1" then 'quoted text' && awk $(pwd) local awk done
+	${HOME} x=1 readonly test --verbose
+		"$1" grep printf $(pwd) export done --verbose cd | printf local "$1" echo export
+'quoted text' done done local
+		done local "$1" && echo then $(pwd) echo "$@" local
+grep --verbose printf awk --verbose 'quoted text' 2>/dev/null ${HOME} | /usr/bin
+		2>/dev/null then && done /usr/bin awk cd && | $(pwd) done ${HOME} "$1"
+	--verbose echo /usr/bin test "$1" --verbose done local $(pwd) printf 2>/dev/null
+		"$@" --verbose readonly then then 'quoted text' cd "$1"
+"$@" printf && --verbose printf cd -eu 2>/dev/null
+	'quoted text' --verbose && local && echo echo readonly readonly /usr/bin && --verbose
+		cd --verbose export | printf cd 'quoted text' | echo
+'quoted text' then 2>/dev/null awk --verbose then $(pwd) grep test x=1 "$1" done
+	cd test --verbose grep /usr/bin echo x=1 local -eu readonly "$@" readonly awk sed
+&& done cd readonly awk test "$@" | --verbose printf
+echo && && awk --verbose export | 'quoted text' local done
+test x=1 awk awk $(pwd) && then ${HOME} printf grep "$1" export
+		readonly printf -eu ${HOME} | --verbose "$@" echo printf done
+local echo "$@" && && | readonly cd sed sed local ${HOME}
+	export $(pwd) test $(pwd) "$1" then | printf
+		--verbose -eu awk then && /usr/bin 'quoted text' sed awk
+		${HOME} then cd ${HOME} | then printf awk /usr/bin 2>/dev/null
+		export -eu done sed |
+	local test readonly local
+	grep then 2>/dev/null ${HOME} --verbose /usr/bin
+	-eu x=1 echo $(pwd) done -eu sed
+	| && ${HOME} test then /usr/bin
+	cd x=1 awk test && readonly done "$1"
+		export && "$1" | export cd grep "$1" echo | sed local 'quoted text'
+	"$1" && | cd cd echo grep "$1" cd 'quoted text'
+grep grep /usr/bin awk 2>/dev/null
+	-eu awk then && --verbose export "$@" printf
+	2>/dev/null awk test "$@" && readonly $(pwd) cd --verbose grep | sed test done
+/usr/bin cd --verbose readonly test ${HOME} ${HOME} export export |
+awk -eu export local | done cd echo printf local "$1" /usr/bin cd $(pwd) export
+echo test "$@" "$@" && 2>/dev/null cd grep
+		export export cd 2>/dev/null x=1
+		echo test /usr/bin readonly | "$1" x=1 sed
+2>/dev/null --verbose /usr/bin -eu /usr/bin
+'quoted text' echo then sed readonly
+		local readonly echo x=1 --verbose done done readonly
+	'quoted text' && export sed ${HOME} done sed cd readonly printf export
+"$@" 2>/dev/null /usr/bin -eu done local 2>/dev/null "$1" local && "$@" 'quoted text'
+printf printf cd export $(pwd) export export && && then
+	local sed /usr/bin 2>/dev/null cd
+	then grep awk ${HOME} then --verbose /usr/bin $(pwd) echo export "$@" local
+test sed "$@" --verbose "$1"
+		/usr/bin test x=1 export -eu sed echo awk
+		sed "$@" x=1 cd then && | -eu
+printf 'quoted text' x=1 -eu $(pwd) test $(pwd) readonly "$@" echo
+local 2>/dev/null | $(pwd) local "$1" 2>/dev/null $(pwd) | -eu export
+	x=1 'quoted text' /usr/bin $(pwd) then $(pwd) test $(pwd) ${HOME}
+		"$@" --verbose /usr/bin grep "$1" "$@" cd readonly done sed readonly readonly
+	&& $(pwd) test awk "$@" "$1" export test 2>/dev/null
+		readonly -eu "$@" 2>/dev/null $(pwd) --verbose test -eu export -eu cd
+		--verbose local readonly | sed printf x=1 then | /usr/bin
+echo cd | echo 2>/dev/null grep grep readonly printf cd /usr/bin
+| | echo "$1" "$1" | done /usr/bin "$@" done "$@"
+	2>/dev/null "$@" export -eu echo
+		&& x=1 "$1" local "$1" 2>/dev/null
+		--verbose sed && sed readonly
+sed 'quoted text' grep "$@" && then "$1" 'quoted text' test sed
+then -eu 'quoted text' awk awk | local local |
+	sed test sed "$@" "$@" 'quoted text' "$@" -eu local then cd
+cd ${HOME} cd echo sed readonly && $(pwd) /usr/bin /usr/bin
+	| readonly cd export export test printf printf | echo ${HOME}
+	"$@" sed echo $(pwd) -eu echo
+$(pwd) 'quoted text' then cd "$1" $(pwd) $(pwd)
+&& sed && ${HOME} 2>/dev/null 'quoted text' 2>/dev/null grep done
+'quoted text' $(pwd) readonly
+	then grep then $(pwd) cd readonly /usr/bin /usr/bin grep export "$@"
+printf && test echo "$1" grep "$@" then local then "$1"
+		echo $(pwd) cd test awk 'quoted text' export $(pwd) --verbose "$@" $(pwd)
+	test printf x=1 && awk -eu && $(pwd) echo echo done &&
+		"$@" /usr/bin -eu grep readonly -eu -eu --verbose test | then local echo
+		"$1" | grep readonly --verbose test "$@" awk then
+	then printf 'quoted text' local
+$(pwd) readonly "$@" x=1 grep "$@" done local local done export |
+		/usr/bin printf export done local /usr/bin --verbose
+${HOME} done x=1 local
+		| 'quoted text' -eu x=1 then awk "$@" "$1" "$@"
+awk | printf echo cd readonly printf grep "$@" export /usr/bin /usr/bin
+		'quoted text' ${HOME} readonly && /usr/bin done -eu printf x=1
+		cd sed $(pwd) test grep
+		awk x=1 echo --verbose x=1 export test echo 2>/dev/null
+cd | readonly x=1 | 'quoted text' grep /usr/bin "$@" test test | --verbose
+"$1" printf "$@" sed x=1 'quoted text' sed "$@" | sed cd $(pwd) grep cd echo -eu
+	"$1" 'quoted text' $(pwd) readonly
+2>/dev/null ${HOME} export ${HOME} printf
+done grep local readonly "$@" "$@" local grep && local $(pwd) | ${HOME} x=1 "$@"
+-eu done x=1 $(pwd) x=1 | cd --verbose
+	test -eu then sed printf --verbose grep awk cd 'quoted text'
+	${HOME} then | then export 'quoted text' sed | done printf --verbose
+		local then | /usr/bin x=1 | export ${HOME} sed readonly echo --verbose
+	echo ${HOME} 'quoted text' ${HOME} && 2>/dev/null "$1" cd
+		sed "$1" readonly test && --verbose cd ${HOME} 'quoted text' then
+	-eu $(pwd) | | awk | then readonly -eu test 'quoted text' awk echo echo
+		2>/dev/null awk awk printf readonly
+		grep echo test done readonly export printf
+	test ${HOME} test test ${HOME} $(pwd) ${HOME} readonly grep then test
+	&& local | local -eu $(pwd)
+export sed /usr/bin && x=1 "$@" local grep "$@" local awk echo /usr/bin sed cd
+	x=1 grep grep ${HOME} ${HOME} $(pwd) $(pwd) 2>/dev/null $(pwd)
+"$1" cd then then x=1 2>/dev/null "$@" "$1"
+	-eu ${HOME} /usr/bin awk "$1" --verbose 2>/dev/null readonly then "$1"
+	cd --verbose "$1" $(pwd) export then && awk ${HOME} --verbose 'quoted text'
+"$1" done printf && printf then --verbose
+		${HOME} export 'quoted text' grep ${HOME} awk printf
+	test "$1" "$@" sed -eu /usr/bin cd sed ${HOME} && ${HOME} cd 2>/dev/null readonly
+readonly readonly readonly --verbose "$@" /usr/bin | "$@" sed -eu 'quoted text'
+&& ${HOME} readonly 'quoted text' ${HOME}
+		readonly sed 2>/dev/null readonly | printf 'quoted text' "$1" readonly local
+	/usr/bin then echo "$1" test grep | --verbose $(pwd) sed readonly grep | $(pwd)
+	'quoted text' && $(pwd) cd | export /usr/bin ${HOME}
+		| export $(pwd) /usr/bin --verbose test done then "$1"
+| 'quoted text' 2>/dev/null 2>/dev/null
+		readonly && --verbose /usr/bin awk cd
+grep "$@" printf done 'quoted text' --verbose done ${HOME} "$@"
+	export export echo "$1" test $(pwd) test "$@" --verbose
+		"$1" "$1" grep done x=1 "$1" --verbose ${HOME}
+$(pwd) 2>/dev/null export cd | $(pwd) ${HOME} readonly 'quoted text'
+		readonly local ${HOME} 'quoted text' 2>/dev/null grep /usr/bin
+&& ${HOME} --verbose x=1 "$1" 'quoted text'
+		&& "$@" grep printf 'quoted text' awk readonly sed --verbose
+printf grep grep | | &&
+| export -eu local "$1"
+	cd sed --verbose x=1 | printf cd awk && x=1 $(pwd) -eu
+	export 'quoted text' cd done echo grep "$1"
+	printf done sed printf local test 'quoted text' local test /usr/bin
+		awk && printf cd local 2>/dev/null echo 2>/dev/null | local sed
+	2>/dev/null /usr/bin cd local export /usr/bin test 'quoted text'
+local echo cd /usr/bin && grep
+	$(pwd) ${HOME} -eu x=1 'quoted text' 2>/dev/null grep
+		| printf done ${HOME} readonly sed ${HOME} x=1 | echo
+		export then done ${HOME} echo /usr/bin && readonly ${HOME} grep ${HOME}
+echo 'quoted text' | local | /usr/bin
+	sed "$@" sed x=1 then cd 2>/dev/null sed /usr/bin awk sed
+echo readonly cd ${HOME}
+		echo printf grep 2>/dev/null
+		cd grep printf export ${HOME} x=1 cd readonly grep done test readonly grep --verbose
+	-eu $(pwd) "$@" printf cd test local
+	awk x=1 2>/dev/null $(pwd) 2>/dev/null printf sed readonly x=1 awk
+		x=1 local "$@" 'quoted text' test sed test local
+	test | --verbose /usr/bin 2>/dev/null local ${HOME} readonly --verbose
+	-eu 2>/dev/null /usr/bin then "$1" "$@" "$1" grep export awk 'quoted text'
+test cd 2>/dev/null awk x=1 "$@" printf "$@" && echo /usr/bin && 2>/dev/null echo
+		awk grep 'quoted text' 2>/dev/null local x=1 export
+	readonly x=1 test 2>/dev/null "$1" awk
+$(pwd) local sed ${HOME} $(pwd) && $(pwd) x=1 sed 2>/dev/null
+	export "$1" echo /usr/bin
+-eu "$@" sed x=1 'quoted text' "$1" then echo /usr/bin -eu "$@" printf
+		/usr/bin readonly $(pwd) cd $(pwd) awk && --verbose sed
+| test awk && echo ${HOME} 'quoted text'
+	readonly local ${HOME} awk grep sed
+	$(pwd) sed 2>/dev/null done ${HOME} test grep x=1 --verbose
+		${HOME} && export done grep ${HOME}
+	| sed 2>/dev/null awk --verbose test echo $(pwd) 'quoted text'
+	/usr/bin printf echo cd awk test readonly /usr/bin grep | cd --verbose
+	awk -eu 'quoted text' 'quoted text' -eu readonly printf
+	/usr/bin --verbose then test 2>/dev/null echo | sed export
+2>/dev/null /usr/bin
+"$1" 'quoted text' | sed ${HOME} grep test local cd readonly then then x=1 2>/dev/null
+	grep grep export | export test awk && --verbose test "$@" then "$1" printf awk
+	/usr/bin export readonly cd && 'quoted text' local "$1" --verbose
+		done 'quoted text' 'quoted text' then test "$@" export | | awk -eu
+		export export readonly ${HOME} 'quoted text' export export readonly awk
+&& local && x=1 "$1" $(pwd) sed export 2>/dev/null
+		cd "$@" 'quoted text' 2>/dev/null
+		&& "$1" cd test -eu done ${HOME} ${HOME} 2>/dev/null
+		cd awk 2>/dev/null cd sed
+		grep grep "$1" && done grep | -eu export done x=1 -eu /usr/bin &&
+/usr/bin readonly 2>/dev/null
+local | printf printf /usr/bin export export
+		2>/dev/null then "$@" cd -eu 2>/dev/null sed "$1"
+		&& 'quoted text' /usr/bin awk awk cd done 2>/dev/null 'quoted text' 'quoted text'
+local --verbose ${HOME} local sed test
+	grep 2>/dev/null readonly && x=1
+| grep awk --verbose sed test
+		2>/dev/null ${HOME} done grep $(pwd) 2>/dev/null
+	x=1 "$1" | sed sed "$1" -eu "$1"
+/usr/bin /usr/bin --verbose done
+		"$@" /usr/bin x=1 /usr/bin test test "$@"
+	printf 'quoted text' grep "$1" 'quoted text' --verbose /usr/bin $(pwd)
+	test "$1" printf 2>/dev/null done echo local "$@" "$@" $(pwd) 2>/dev/null
+		${HOME} done readonly 2>/dev/null
+		done x=1 2>/dev/null sed --verbose "$1" $(pwd) done "$1" "$@" echo $(pwd)
+"$@" x=1 export -eu then ${HOME} && /usr/bin test awk && export 'quoted text' --verbose
+2>/dev/null local x=1 then export
+		x=1 cd sed echo 'quoted text' 'quoted text' local
+| grep | awk /usr/bin test 2>/dev/null awk $(pwd) printf 2>/dev/null test done
+"$@" $(pwd) readonly && "$1" sed then | $(pwd) test export "$1" then
+export -eu export then readonly 'quoted text' && readonly x=1 readonly ${HOME}
+	-eu ${HOME} ${HOME} awk && --verbose /usr/bin
+	--verbose 'quoted text' done --verbose test
+-eu done | awk $(pwd) --verbose 2>/dev/null printf cd local sed 'quoted text'
+export local awk "$1" echo 'quoted text' grep grep /usr/bin
+		-eu ${HOME} && export awk "$@" ${HOME} "$1" ${HOME}
+	then $(pwd) --verbose --verbose echo awk && cd then
+x=1 'quoted text' then grep cd
+		&& test printf 2>/dev/null then printf | readonly printf /usr/bin
+| local readonly local local echo $(pwd) -eu awk --verbose
+	$(pwd) $(pwd) grep | readonly test test done
+$(pwd) printf "$1" --verbose && test -eu done cd
+		awk local -eu done 2>/dev/null
+		export readonly --verbose 'quoted text'
+	"$@" $(pwd) readonly awk /usr/bin && export $(pwd) "$1" x=1 --verbose done
+		awk | --verbose "$@" x=1 test "$1" local "$@" grep && echo "$@" -eu local
+		2>/dev/null local grep test --verbose readonly
+		x=1 test cd printf "$@" --verbose done cd echo then && sed --verbose
+done readonly readonly 2>/dev/null 2>/dev/null "$1" done printf
+x=1 grep awk done /usr/bin 2>/dev/null | $(pwd) echo done | done && sed && "$1"
+	"$1" x=1 test 2>/dev/null grep x=1 && grep done awk ${HOME}
+then && $(pwd) ${HOME} ${HOME} local export
+	/usr/bin x=1 --verbose --verbose 'quoted text' /usr/bin
+	readonly awk $(pwd) sed && x=1 readonly /usr/bin -eu export ${HOME} ${HOME}
+	${HOME} --verbose cd --verbose done && test echo 2>/dev/null
+		echo echo --verbose -eu
+sed --verbose local 2>/dev/null $(pwd) sed export done test
+	test cd ${HOME} -eu x=1 export printf grep 'quoted text'
+printf $(pwd) awk "$@" /usr/bin awk then -eu sed echo --verbose "$@" /usr/bin
+		local local -eu --verbose "$@" echo echo awk sed 'quoted text'
+sed local done -eu local local /usr/bin printf ${HOME} echo awk 2>/dev/null &&
+		'quoted text' cd readonly then
+	awk "$@" 2>/dev/null && | test | awk
+		awk done sed ${HOME} && ${HOME}
+	2>/dev/null --verbose export 'quoted text' /usr/bin && done $(pwd)
+--verbose /usr/bin done "$1" then 2>/dev/null grep "$@"
+2>/dev/null "$@" "$@" local then cd
+'quoted text' x=1 export export ${HOME} sed -eu readonly printf
+printf 2>/dev/null "$@" 'quoted text' --verbose test
+test readonly 'quoted text' awk 2>/dev/null
+	then | "$@" then sed test then
+		$(pwd) local x=1 cd --verbose --verbose -eu readonly then 2>/dev/null
+	/usr/bin 2>/dev/null
+	test sed 2>/dev/null 2>/dev/null readonly --verbose && done
+done -eu awk 2>/dev/null export echo
+&& grep /usr/bin sed "$1" /usr/bin done echo "$1" export then
+		"$1" "$1" x=1 && done ${HOME} echo $(pwd) x=1 grep
+grep test awk echo then | && $(pwd) "$1" echo printf test "$@" -eu &&
+		--verbose ${HOME} -eu awk local -eu /usr/bin "$1" -eu 2>/dev/null
+	/usr/bin "$1" x=1 sed "$@" 'quoted text' |
+		'quoted text' grep /usr/bin printf sed done
+		echo "$1" export | then x=1 ${HOME} -eu && export local awk readonly then
+x=1 sed sed test --verbose
+		'quoted text' echo ${HOME} /usr/bin 'quoted text'
+		awk echo readonly ${HOME}
+&& --verbose awk /usr/bin sed printf "$@" done ${HOME} "$@"
+		x=1 'quoted text' cd /usr/bin test $(pwd) -eu readonly "$1" /usr/bin |
+"$1" awk sed done echo echo "$1" then | 'quoted text' ${HOME}
+x=1 && x=1 --verbose 2>/dev/null 'quoted text' $(pwd)
+		${HOME} && --verbose grep "$@" cd "$@" sed -eu then -eu local 'quoted text'
+printf --verbose echo --verbose cd /usr/bin ${HOME} readonly
+	awk | && echo "$@" export export --verbose local $(pwd) then cd done
+x=1 && /usr/bin -eu --verbose --verbose then awk printf --verbose
+x=1 readonly local ${HOME} echo ${HOME} && "$@" awk
+	grep awk --verbose $(pwd) --verbose sed ${HOME} | 'quoted text' && "$1"
+		"$@" export 'quoted text' 2>/dev/null sed "$@" local
+test echo grep sed /usr/bin | 2>/dev/null "$@" -eu --verbose
+	cd test && done 2>/dev/null printf /usr/bin cd
+	'quoted text' | sed done export ${HOME} | $(pwd) /usr/bin
+		then done export done | then done --verbose | printf then cd
+	sed grep grep printf x=1
+cd "$1" then ${HOME} 'quoted text' | readonly printf sed ${HOME} local echo
+		"$@" 2>/dev/null | printf 2>/dev/null then 2>/dev/null && 2>/dev/null
+	echo export done grep ${HOME} "$1" ${HOME} | readonly echo local
+		2>/dev/null grep "$1" | export echo
+	cd && cd | readonly /usr/bin --verbose /usr/bin local
+x=1 /usr/bin printf "$@" awk && && sed
+"$@" readonly 'quoted text' "$1"
+	test "$1" done 'quoted text'
+	sed echo cd /usr/bin 2>/dev/null cd export "$@" done grep ${HOME} "$@" 'quoted text'
+	readonly 'quoted text' local test readonly x=1 -eu -eu
+		"$@" 2>/dev/null --verbose -eu --verbose --verbose
+-eu grep export /usr/bin 'quoted text'
+-eu local 2>/dev/null $(pwd) done cd
+	grep done then && "$1"
+		2>/dev/null echo cd then --verbose /usr/bin $(pwd) /usr/bin 2>/dev/null
@@ -0,0 +1,2001 @@
+--verbose grep local /usr/bin then --verbose echo sed sed local
+local | then | "$1" printf readonly done && test
+test $(pwd) test cd "$@" $(pwd) x=1 x=1 awk then
+		${HOME} -eu cd export x=1 local printf export /usr/bin ${HOME}
+		/usr/bin "$1" then local then readonly cd awk "$@" grep cd ${HOME} readonly
+		${HOME} cd && && "$1" --verbose -eu awk | cd | test export echo printf awk |
+	cd ${HOME} 'quoted text' --verbose awk $(pwd)
+	/usr/bin grep -eu printf $(pwd) local x=1 "$1" then
+x=1 ${HOME} done && "$@"
+		&& | 2>/dev/null "$1" cd cd 'quoted text' "$1" readonly
+| ${HOME} readonly echo
+		done done x=1 --verbose then cd done $(pwd) $(pwd) test
+local export --verbose echo --verbose --verbose awk awk awk echo test
+	done export /usr/bin printf
+	2>/dev/null 'quoted text'
+"$1" -eu 'quoted text' | readonly test awk 2>/dev/null
+'quoted text' sed -eu grep --verbose local /usr/bin
+	/usr/bin local grep /usr/bin test "$1" cd | test
+printf $(pwd) $(pwd) then local sed done sed
+	| "$1" test /usr/bin "$@" grep "$@" x=1 /usr/bin sed awk test printf export
+	"$@" ${HOME} readonly /usr/bin export local sed echo sed "$@"
+awk | "$@" echo "$1" awk "$1" test 'quoted text' sed
+readonly printf /usr/bin
+		-eu cd -eu "$1" x=1 grep local
+	"$@" then sed done && local
+		echo 'quoted text' then 2>/dev/null --verbose -eu --verbose
+sed 'quoted text' "$@" 2>/dev/null 'quoted text' sed local export sed
+	x=1 -eu cd /usr/bin then $(pwd) export $(pwd)
+echo --verbose printf x=1 cd local
+		x=1 then --verbose then | readonly 2>/dev/null echo
+echo grep readonly readonly
+done && export "$1" 'quoted text' | test && ${HOME} 'quoted text' x=1 cd printf
+	sed 'quoted text' printf
+/usr/bin x=1 done "$1" export done
+		done | done "$@" --verbose "$@" 'quoted text' | 'quoted text'
+		test then export echo && "$1" ${HOME} 'quoted text' ${HOME} test $(pwd)
+	--verbose 2>/dev/null local ${HOME} grep $(pwd) readonly
+		"$1" cd cd ${HOME} "$@" | "$@" --verbose x=1 echo grep grep "$@" then
+2>/dev/null "$@" local 2>/dev/null grep readonly 2>/dev/null
+		"$@" awk printf local /usr/bin sed echo grep
+		done x=1 2>/dev/null echo readonly /usr/bin -eu 'quoted text'
+printf x=1 echo printf -eu | cd
+2>/dev/null echo 'quoted text' 2>/dev/null --verbose sed $(pwd) && awk then
+		awk local awk && 2>/dev/null 'quoted text' $(pwd) -eu readonly
+	/usr/bin 'quoted text' x=1 done readonly 2>/dev/null
+	'quoted text' then printf
+	-eu local grep local echo /usr/bin 'quoted text' test x=1 awk x=1
+"$1" "$@" test && local done --verbose export "$@" -eu 'quoted text' ${HOME}
+		2>/dev/null 2>/dev/null awk /usr/bin
+	grep awk awk "$@" printf && ${HOME} && 2>/dev/null "$@" awk --verbose local
+| export && then done grep ${HOME} && echo echo grep | $(pwd) 2>/dev/null "$@"
+		local then | sed | local awk cd --verbose done
+		printf "$1" done | 2>/dev/null awk printf awk
+| "$@" | $(pwd) test
+		-eu ${HOME} export awk done echo
+		${HOME} ${HOME} printf grep 'quoted text' export &&
+	x=1 cd 2>/dev/null | x=1 x=1 cd "$1" cd
+echo then -eu --verbose grep awk
+	readonly $(pwd) x=1 | $(pwd) 'quoted text' test done $(pwd)
+		local 'quoted text' readonly local && $(pwd) "$1" /usr/bin awk 'quoted text' 2>/dev/null
+	'quoted text' then done &&
+	then --verbose export "$@" --verbose grep test echo
+| ${HOME} "$1" "$1" -eu 2>/dev/null local ${HOME} /usr/bin echo --verbose
+	'quoted text' sed echo "$@" | ${HOME} sed x=1
+		done printf "$@" "$@" echo
+done grep ${HOME} done --verbose cd 2>/dev/null sed cd
+		awk export awk local test then -eu "$@" test "$1" awk grep echo done export
+		--verbose grep x=1 awk ${HOME}
+--verbose "$1" x=1 readonly echo x=1 x=1 readonly export /usr/bin cd then "$1"
+test done "$1" "$1" --verbose $(pwd) "$1"
+	grep cd export $(pwd) printf /usr/bin
+		printf x=1 ${HOME} awk local printf && "$1" export printf printf sed readonly
+	echo printf echo awk 'quoted text' | ${HOME} then ${HOME} echo
+	printf echo | done test awk sed -eu
+		done echo "$@" cd /usr/bin && test then "$@" "$1" done "$@" echo then ${HOME}
+	readonly export -eu readonly x=1 "$@"
+&& | --verbose /usr/bin ${HOME} "$1"
+	grep && echo printf $(pwd)
+	'quoted text' | /usr/bin $(pwd) export echo sed cd -eu printf
+then | export | sed awk echo | 'quoted text' --verbose awk cd /usr/bin
+	local "$1" 'quoted text' --verbose
+		grep /usr/bin export grep --verbose --verbose --verbose && local x=1
+	${HOME} 'quoted text' --verbose x=1 echo | $(pwd) readonly
+		'quoted text' printf | then then &&
+		--verbose done export 'quoted text' sed && -eu sed
+		sed grep $(pwd) awk -eu "$1" "$1" grep $(pwd) -eu 2>/dev/null 'quoted text'
+	export export "$1" x=1 cd awk test awk "$@" export sed grep --verbose ${HOME} export
+		grep 2>/dev/null && test && sed cd awk x=1 done done "$@" ${HOME} $(pwd)
+'quoted text' local local
+	| 2>/dev/null export "$1" printf 'quoted text' sed then printf
+	${HOME} printf ${HOME} 'quoted text' | "$1" ${HOME} "$@" cd
+	then 2>/dev/null readonly x=1 awk printf grep -eu local --verbose export echo
+		grep 'quoted text' -eu
+		readonly 2>/dev/null awk | awk grep
+	--verbose echo | 'quoted text' then export --verbose then test sed "$@"
+$(pwd) awk ${HOME} -eu cd printf
+then local "$@" local grep echo done cd echo 2>/dev/null
+		--verbose grep 2>/dev/null -eu then grep export 'quoted text' /usr/bin "$1"
+echo $(pwd) 2>/dev/null /usr/bin printf export then local x=1 done -eu then local
+	then 2>/dev/null x=1 && "$@" | 2>/dev/null && test cd awk x=1 'quoted text'
+	local -eu cd 'quoted text'
+	${HOME} echo --verbose done
+		export awk --verbose --verbose /usr/bin 2>/dev/null --verbose
+$(pwd) printf 2>/dev/null "$@" then -eu export ${HOME} --verbose
+awk 'quoted text' awk export 'quoted text'
+		cd grep echo awk $(pwd) --verbose /usr/bin | then ${HOME} echo /usr/bin
+		-eu export -eu export sed "$@" local ${HOME} "$@"
+	x=1 done ${HOME} $(pwd) 2>/dev/null awk echo x=1 && readonly
+	sed readonly /usr/bin grep 'quoted text' 'quoted text'
+		echo -eu -eu readonly readonly 2>/dev/null
+		'quoted text' awk 2>/dev/null
+/usr/bin 'quoted text' "$1" cd sed "$1" | export | ${HOME}
+done "$1" 'quoted text' --verbose awk local test 'quoted text' local
+	| ${HOME} "$1" $(pwd)
+sed readonly -eu readonly -eu test then 'quoted text' --verbose
+		&& grep 'quoted text' && done sed
+	x=1 echo x=1 /usr/bin
+		${HOME} 'quoted text' ${HOME} && $(pwd) x=1 awk awk -eu echo export test
+printf awk -eu --verbose x=1 /usr/bin cd | "$@" --verbose
+grep $(pwd) /usr/bin grep $(pwd) ${HOME} test grep
+'quoted text' && | printf x=1 'quoted text' sed | | then sed done ${HOME}
+	"$@" 2>/dev/null ${HOME}
+"$1" "$@" grep local
+		echo printf then 2>/dev/null --verbose readonly
+	echo awk then done grep "$@"
+echo --verbose /usr/bin sed 'quoted text' cd
+--verbose /usr/bin awk /usr/bin && && echo grep 2>/dev/null export /usr/bin
+	--verbose x=1 2>/dev/null 2>/dev/null
+		sed --verbose $(pwd) --verbose $(pwd) export /usr/bin then
+"$@" 2>/dev/null test export printf
+		2>/dev/null && awk ${HOME} readonly done echo then -eu "$@"
+	2>/dev/null /usr/bin then sed readonly export --verbose
+	grep sed --verbose -eu /usr/bin "$@" | echo
+	-eu awk /usr/bin awk awk 2>/dev/null --verbose /usr/bin x=1
+'quoted text' printf -eu done then cd local sed
+"$1" test awk 'quoted text' done | 'quoted text'
+	| && grep local echo export -eu /usr/bin "$@" echo
+	${HOME} export grep ${HOME}
+	2>/dev/null $(pwd) | done done echo $(pwd)
+		-eu 2>/dev/null $(pwd)
+readonly then done local awk
+| && then $(pwd) "$1" export 'quoted text' test readonly 2>/dev/null done
+		${HOME} -eu x=1 "$1" && --verbose $(pwd) cd readonly awk
+	printf echo "$1" echo -eu local local $(pwd) export
+		--verbose test echo ${HOME} /usr/bin /usr/bin
+printf $(pwd) 2>/dev/null
+	"$1" then cd then | cd done grep --verbose sed --verbose
+	sed "$1" export && "$1" test readonly cd --verbose printf x=1
+	cd "$@" local echo /usr/bin export sed echo | awk readonly grep
+		"$1" | readonly 2>/dev/null $(pwd) cd && && /usr/bin 'quoted text'
+$(pwd) readonly cd grep ${HOME} "$@" --verbose printf x=1 ${HOME}
+		awk awk printf export "$1" 2>/dev/null
+| grep && local "$@" -eu test --verbose sed done grep $(pwd)
+	grep export && echo /usr/bin
+| printf then done cd ${HOME} ${HOME}
+readonly grep --verbose grep $(pwd) --verbose echo export printf local export printf
+		"$1" printf "$@" $(pwd) test /usr/bin then -eu /usr/bin
+		printf -eu $(pwd) $(pwd) cd $(pwd) echo sed
+readonly ${HOME} "$@" cd echo -eu "$@"
+sed printf 2>/dev/null readonly echo /usr/bin done 'quoted text'
+		printf printf x=1 cd test export test cd then 2>/dev/null
+&& cd | -eu --verbose awk ${HOME} grep | 'quoted text' export
+sed readonly grep cd /usr/bin "$1" cd "$@" 2>/dev/null echo /usr/bin
+| -eu sed export --verbose readonly /usr/bin
+		test "$1" x=1 done ${HOME} awk awk "$@" | printf --verbose && 2>/dev/null
+done /usr/bin "$@" && "$1" 'quoted text'
+	awk -eu -eu sed | cd done x=1 echo cd then 'quoted text' x=1
+| | /usr/bin sed echo 2>/dev/null done x=1 | echo awk --verbose
+export grep printf echo local
+2>/dev/null 2>/dev/null | cd done local awk | cd 'quoted text' awk export
+echo readonly 2>/dev/null && /usr/bin | done && echo && then "$@" grep |
+	printf 2>/dev/null -eu grep sed awk grep "$1"
+		readonly printf | awk export
+		readonly x=1 grep x=1 "$1" readonly | "$@" 2>/dev/null 2>/dev/null
+		x=1 "$1" && "$1" --verbose printf cd readonly
+${HOME} sed export -eu readonly x=1 -eu then grep
+		x=1 2>/dev/null /usr/bin | test echo
+export printf "$1" cd export grep cd "$1" 'quoted text'
+	awk $(pwd) printf $(pwd) /usr/bin
+		--verbose /usr/bin printf x=1 | readonly done grep "$@" -eu grep
+done $(pwd) export local x=1 done --verbose
+local 'quoted text' readonly
+		cd awk ${HOME} /usr/bin ${HOME} done --verbose "$@" awk "$1"
+	-eu "$1" 'quoted text' x=1 test "$@" "$1" sed -eu /usr/bin
+export | 2>/dev/null local "$@" local ${HOME} 'quoted text' echo export local
+	--verbose then $(pwd) -eu ${HOME} -eu -eu echo x=1 local
+awk test ${HOME} echo echo 2>/dev/null x=1 --verbose -eu test
+echo 2>/dev/null echo "$1" x=1 echo -eu local "$1" | printf && "$@"
+then "$@" grep && grep 2>/dev/null
+	awk then "$1" done ${HOME}
+${HOME} x=1 'quoted text' printf done echo test printf && "$1" x=1 export
+		readonly then test printf /usr/bin
+local x=1 then "$1" export then -eu then /usr/bin readonly local sed --verbose
+		| done awk "$1" "$1" printf "$1" &&
+&& awk "$1" grep --verbose x=1 local awk 'quoted text' printf
+		awk $(pwd) --verbose "$1" readonly | "$1" /usr/bin sed ${HOME}
+	done export | && done sed done export $(pwd) "$@" 'quoted text'
+-eu 'quoted text' /usr/bin /usr/bin ${HOME} "$1" test cd "$1" printf
+	$(pwd) | export echo cd awk "$@" --verbose printf
+	sed awk x=1 cd 2>/dev/null readonly printf | sed /usr/bin x=1 | printf 'quoted text'
+		x=1 "$@" local done --verbose readonly ${HOME}
+"$@" local cd done "$@" echo | --verbose
+$(pwd) /usr/bin export ${HOME} 2>/dev/null
+	--verbose -eu done --verbose awk $(pwd) $(pwd)
+"$1" --verbose x=1 then | "$1" 'quoted text'
+	2>/dev/null echo 'quoted text'
+	"$@" --verbose grep -eu -eu "$1" | done grep grep &&
+		&& --verbose printf awk
+"$@" ${HOME} done --verbose "$1" local x=1 local $(pwd) 2>/dev/null
+--verbose printf /usr/bin "$1" export $(pwd) /usr/bin awk grep cd --verbose
+	cd sed local export grep echo $(pwd) $(pwd) printf $(pwd) ${HOME} $(pwd)
+local 'quoted text' printf | --verbose && then /usr/bin export x=1 test | &&
+${HOME} | x=1 grep test /usr/bin | grep
+sed printf 2>/dev/null done sed ${HOME}
+		| done grep export /usr/bin export echo local /usr/bin awk echo
+		echo done awk export x=1 then echo -eu $(pwd) | echo echo ${HOME} sed &&
+	| test printf "$@" 'quoted text' then
+&& sed export -eu | grep "$@" awk printf grep
+done -eu x=1 readonly printf test | &&
+		/usr/bin export awk test --verbose ${HOME}
+printf && sed "$1" -eu "$@" test "$1" echo test
+	/usr/bin 'quoted text' -eu /usr/bin
+	done sed local readonly test sed -eu then then 2>/dev/null grep then
+'quoted text' sed printf local echo awk local
+		then | 2>/dev/null x=1 done ${HOME} export
+--verbose x=1 /usr/bin 2>/dev/null awk awk then $(pwd)
+		--verbose grep && --verbose
+	$(pwd) && test "$1" then grep done readonly
+		cd printf x=1 local done local
+| "$1" grep 'quoted text' done
+	x=1 awk --verbose -eu "$1" | done "$1" local x=1 | --verbose | "$1" awk -eu
+	'quoted text' awk /usr/bin "$@" "$1" sed "$@" 2>/dev/null
+	"$@" "$@" | ${HOME} ${HOME} $(pwd) cd ${HOME} grep grep "$1"
+	readonly -eu grep export && cd && test sed | /usr/bin | 2>/dev/null $(pwd)
+	&& awk then done awk test -eu ${HOME} echo && sed sed
+		&& test $(pwd) /usr/bin readonly then /usr/bin --verbose x=1 then readonly
+		"$@" printf then then echo echo local && awk --verbose
+	"$@" test local 2>/dev/null
+| ${HOME} readonly 'quoted text' x=1 ${HOME} cd | test echo ${HOME} sed test
+	| export grep | then export sed local grep
+echo | cd grep | cd readonly --verbose sed done "$1" export ${HOME}
+	--verbose x=1 sed $(pwd) cd | "$@" echo 2>/dev/null awk
+	-eu awk "$1" 'quoted text' grep awk -eu test
+	cd echo 'quoted text' "$@" grep --verbose ${HOME} readonly then --verbose echo /usr/bin
+	readonly 2>/dev/null sed $(pwd) $(pwd) grep $(pwd) local "$@" && "$1" done
+awk awk export --verbose --verbose "$1" 2>/dev/null sed readonly ${HOME}
+"$@" awk | $(pwd) | awk |
+cd grep ${HOME} test ${HOME} | test printf x=1 &&
+	export $(pwd) awk "$1" 'quoted text'
+echo awk sed --verbose -eu export local done test "$@" readonly --verbose
+	echo export --verbose echo -eu then grep export && test -eu $(pwd)
+		echo local test 'quoted text' test 2>/dev/null awk $(pwd) 2>/dev/null "$@" sed
+		grep 2>/dev/null "$@" local test then printf cd sed printf $(pwd)
+	x=1 done then | sed grep done /usr/bin test $(pwd)
+	"$1" && echo local cd "$@" $(pwd)
+		sed ${HOME} awk grep done sed ${HOME} printf --verbose -eu
+readonly 'quoted text' | -eu $(pwd)
+readonly $(pwd) /usr/bin readonly done -eu /usr/bin 'quoted text'
+${HOME} 'quoted text' cd sed "$@" ${HOME} && sed 2>/dev/null sed export done
+	'quoted text' grep sed
+	local then then local
+local local echo export "$@"
+	local test ${HOME} awk 2>/dev/null
+		'quoted text' /usr/bin -eu export test "$@" --verbose -eu x=1 sed
+done x=1 cd readonly then 'quoted text' printf then then $(pwd)
+$(pwd) ${HOME} "$1" "$@" 2>/dev/null test x=1 2>/dev/null
+	x=1 cd /usr/bin export test 2>/dev/null | export
+'quoted text' echo then && x=1 /usr/bin
+local awk -eu done | | then grep cd --verbose printf /usr/bin "$1"
+	"$@" sed ${HOME} -eu test done printf export grep | "$1"
+		awk 'quoted text' done local -eu x=1 printf
+	-eu -eu echo echo sed local export cd | 'quoted text' cd readonly "$@" -eu "$@"
+		printf --verbose ${HOME} |
+awk $(pwd) sed -eu 2>/dev/null 2>/dev/null readonly echo 2>/dev/null echo printf
+local echo ${HOME} test readonly sed /usr/bin ${HOME} echo
+	cd | $(pwd) --verbose done "$1" local cd $(pwd) "$1"
+2>/dev/null awk done then
+awk "$1" export 'quoted text' --verbose
+		2>/dev/null x=1 "$1" $(pwd) "$@" "$@" cd cd /usr/bin
+	sed $(pwd) --verbose 'quoted text' --verbose
+		"$@" awk test --verbose 'quoted text' | && export
+printf x=1 cd export local x=1
+	grep printf $(pwd) printf "$1" printf printf && /usr/bin grep | printf
+	"$@" test echo x=1 /usr/bin x=1 "$1" | --verbose echo echo
+	&& printf x=1 export /usr/bin done 2>/dev/null then --verbose
+		readonly printf ${HOME} /usr/bin x=1 done cd awk && cd cd local
+	x=1 export 'quoted text' cd "$@"
+	x=1 test readonly test echo "$1" awk 2>/dev/null done | done printf grep printf
+then sed --verbose 2>/dev/null --verbose 2>/dev/null
+readonly "$1" done awk grep test "$@" --verbose local awk
+		'quoted text' | done sed test && /usr/bin -eu | test awk "$1" awk sed then cd readonly
+		&& sed --verbose readonly 'quoted text'
+		$(pwd) x=1 readonly --verbose x=1 echo
+	test printf export export --verbose local x=1 x=1 /usr/bin test cd cd
+${HOME} cd --verbose awk "$1" printf $(pwd) awk /usr/bin
+-eu local cd --verbose cd x=1 awk 2>/dev/null readonly $(pwd) 2>/dev/null
+/usr/bin x=1 echo "$1"
+	grep "$@" awk | --verbose $(pwd) echo /usr/bin | grep
+		'quoted text' 2>/dev/null
+		then echo && $(pwd) awk 2>/dev/null --verbose 2>/dev/null
+	local printf 2>/dev/null "$@" 2>/dev/null ${HOME}
+	test x=1 'quoted text' "$@" x=1 then
+	grep local readonly awk ${HOME} then 'quoted text' printf done echo sed 2>/dev/null
+	-eu local 2>/dev/null done local 'quoted text' local printf /usr/bin 'quoted text'
+	cd export cd --verbose readonly printf export $(pwd) && then
+cd readonly 'quoted text' grep done test then export ${HOME} ${HOME} /usr/bin
+		"$1" x=1 && grep $(pwd) 'quoted text' -eu grep --verbose $(pwd) printf
+		printf "$@" done ${HOME} 'quoted text' x=1 2>/dev/null
+$(pwd) x=1 && done cd "$1" then printf && 2>/dev/null "$@" readonly
+	local local 'quoted text' 2>/dev/null && export
+local "$@" awk && done awk /usr/bin
+		/usr/bin 2>/dev/null printf sed echo echo then printf sed x=1 local
+		echo --verbose then | | | then export local "$@"
+$(pwd) x=1 test cd local -eu
+		${HOME} cd grep ${HOME} echo grep &&
+		awk x=1 -eu "$1" local -eu
+	/usr/bin export echo export
+		export 'quoted text' && then "$@" test local printf readonly 'quoted text'
+	-eu then && done printf printf readonly
+$(pwd) --verbose x=1 test && 2>/dev/null | && /usr/bin awk
+export --verbose echo sed sed "$@" export 'quoted text'
+x=1 test printf 2>/dev/null x=1 ${HOME} readonly echo $(pwd) | cd awk
+		export 2>/dev/null "$1" awk then
+printf grep awk echo 'quoted text' x=1 'quoted text' test
+local local echo /usr/bin 'quoted text'
+		"$1" then then done "$@" -eu then
+cd 'quoted text' done -eu awk readonly "$1" readonly -eu "$@" -eu grep awk
+/usr/bin "$1" ${HOME} x=1 "$@" --verbose $(pwd) -eu export
+		| $(pwd) --verbose cd $(pwd) "$@" -eu "$1" sed && export
+		printf local then done printf readonly | grep grep awk grep grep ${HOME}
+	${HOME} --verbose 2>/dev/null "$1"
+&& then sed printf readonly local 2>/dev/null
+		--verbose "$@" /usr/bin
+	test ${HOME} grep $(pwd) printf /usr/bin sed --verbose readonly
+		test /usr/bin $(pwd) export test x=1 then sed x=1 "$1" x=1 ${HOME} readonly 'quoted text'
+/usr/bin --verbose test grep awk echo x=1 "$@" --verbose && /usr/bin "$@" export
+	echo | test "$@" --verbose test test grep && /usr/bin -eu -eu
+	x=1 echo $(pwd) then sed grep -eu readonly printf 'quoted text'
+		"$1" /usr/bin test echo 'quoted text' ${HOME} --verbose
+	"$@" /usr/bin "$@" --verbose $(pwd) grep |
+then local done sed /usr/bin
+-eu /usr/bin ${HOME} sed printf x=1 test readonly | then "$1" -eu printf ${HOME}
+		readonly done --verbose export $(pwd) x=1 'quoted text'
+	local -eu printf test "$1" "$1" local $(pwd) "$@" awk x=1 "$1" "$@" x=1 x=1
+		printf readonly readonly
+		echo local sed $(pwd) printf export 2>/dev/null printf awk awk x=1 -eu
+		then | readonly local readonly then $(pwd)
+		sed "$@" 2>/dev/null ${HOME} echo export awk echo cd done cd awk
+/usr/bin awk done grep echo test awk sed
+		awk printf 2>/dev/null -eu --verbose
+"$@" sed cd grep export -eu --verbose sed then done done
+sed 'quoted text' --verbose cd awk printf | $(pwd) | echo test cd test echo
+		then "$@" "$1" awk sed | $(pwd) ${HOME} --verbose done export
+		'quoted text' /usr/bin done && | "$1" 'quoted text'
+	test "$@" awk --verbose | awk $(pwd)
+	done printf readonly printf local
+	2>/dev/null export printf done "$1" test -eu
+--verbose /usr/bin then --verbose 2>/dev/null "$1" "$@" &&
+-eu local export sed then | test | 2>/dev/null sed ${HOME}
+	"$@" printf $(pwd) readonly export 2>/dev/null readonly "$1" "$@"
+		grep ${HOME} cd -eu -eu done | -eu
+	"$@" local printf echo export printf $(pwd) "$@" readonly 2>/dev/null
+		/usr/bin --verbose export local
+		done awk local export | --verbose awk "$1" done cd export awk x=1 readonly && -eu
+		test /usr/bin done cd && test
+	done printf cd ${HOME} then
+		"$1" printf readonly 2>/dev/null
+		'quoted text' ${HOME} test 2>/dev/null "$1" 'quoted text' echo echo then
+	| "$1" grep test "$@" local export echo
+done x=1 printf readonly sed test -eu sed
+		--verbose done -eu ${HOME} | echo --verbose -eu
+		-eu grep echo 2>/dev/null $(pwd) $(pwd)
+| export ${HOME} $(pwd)
+	sed done export sed "$@" && 'quoted text'
+	"$1" readonly 'quoted text' 'quoted text' 'quoted text' x=1
+	readonly readonly x=1 done
+		| local sed /usr/bin "$@" && | --verbose ${HOME} 'quoted text'
+	--verbose printf && --verbose cd local | then test sed awk echo
+"$1" ${HOME} x=1 && ${HOME} test local sed $(pwd) "$@" --verbose
+	2>/dev/null printf $(pwd) printf && awk
+		awk "$@" -eu "$1" then grep "$1" $(pwd)
+		grep /usr/bin echo export local done then printf x=1 ${HOME} readonly
+	$(pwd) 'quoted text' grep $(pwd)
+| then echo test x=1 "$@" readonly | --verbose
+	export export 2>/dev/null 'quoted text' "$1" -eu local then local awk
+	"$1" echo echo -eu local then $(pwd) ${HOME} echo
+test $(pwd) local printf sed awk x=1 "$1" --verbose $(pwd)
+		then local awk "$1" && "$1" $(pwd) /usr/bin
+		echo echo $(pwd) 2>/dev/null 'quoted text' "$@"
+		printf printf "$1" awk --verbose
+${HOME} printf done /usr/bin awk --verbose
+readonly $(pwd) export done test test "$1" export | export
+		sed ${HOME} && && /usr/bin readonly "$1" cd printf then test 2>/dev/null
+$(pwd) sed "$@" awk done /usr/bin
+${HOME} printf x=1 export cd done done
+	local printf /usr/bin 2>/dev/null --verbose --verbose
+		"$1" 2>/dev/null readonly
+then sed grep then export
+		done printf 2>/dev/null test --verbose awk test -eu
+		local test /usr/bin echo grep test awk printf $(pwd) then $(pwd) sed ${HOME}
+		"$@" && export $(pwd)
+readonly done "$@" | awk printf | echo awk x=1 readonly echo
+		2>/dev/null printf cd 'quoted text'
+	printf 2>/dev/null && awk cd printf -eu "$1" grep | done && "$@"
+		2>/dev/null 'quoted text' 2>/dev/null
+&& -eu $(pwd) /usr/bin x=1 done /usr/bin && printf 2>/dev/null 2>/dev/null
+		2>/dev/null echo cd local "$@"
+--verbose readonly awk /usr/bin readonly
+	sed sed grep cd then ${HOME} awk export
+export $(pwd) | export export 'quoted text' 2>/dev/null | then grep ${HOME} $(pwd)
+	then then ${HOME} "$1" --verbose 2>/dev/null printf ${HOME}
+		"$1" then test readonly awk done printf $(pwd) grep 2>/dev/null cd
+	| $(pwd) local 2>/dev/null --verbose grep "$@" echo grep --verbose
+		$(pwd) test && && "$1" "$1"
+		readonly sed sed 'quoted text' test x=1
+		export cd "$1" -eu $(pwd) sed awk /usr/bin printf
+		export done local printf done done then readonly
+	test "$@" export export "$1" 'quoted text'
+	x=1 ${HOME} /usr/bin ${HOME} && && cd 2>/dev/null "$1" $(pwd) awk
+	awk then awk grep readonly done then "$1" readonly /usr/bin
+awk $(pwd) "$@" ${HOME} "$1" 2>/dev/null
+--verbose local echo done export "$1" -eu -eu --verbose done
+grep awk 2>/dev/null x=1
+	sed readonly 'quoted text'
+		--verbose 'quoted text' then done readonly grep grep sed 2>/dev/null "$@" x=1
+'quoted text' cd test test local test then 2>/dev/null 2>/dev/null
+	printf readonly $(pwd) ${HOME}
+&& test 'quoted text' sed test "$1" grep test awk sed echo x=1 grep cd then --verbose
+		${HOME} "$1" export test done readonly test test && && local export | 2>/dev/null
+| 2>/dev/null grep export "$1" "$1"
+	then printf cd ${HOME} echo cd x=1 "$@" "$1" --verbose
+awk | "$1" /usr/bin readonly
+sed x=1 x=1 awk 'quoted text' printf printf "$1" done 'quoted text' && cd local
+		then export 'quoted text' x=1 $(pwd) "$1" 2>/dev/null /usr/bin
+		--verbose && done $(pwd)
+| grep 2>/dev/null --verbose
+		2>/dev/null cd sed cd echo -eu "$@" | 'quoted text' "$@"
+		done 'quoted text' ${HOME} "$@" x=1 --verbose "$1"
+${HOME} local "$@" ${HOME}
+		printf -eu readonly ${HOME}
+echo /usr/bin 2>/dev/null "$1" grep $(pwd) ${HOME} cd ${HOME} $(pwd)
+	awk "$@" test cd -eu sed /usr/bin
+	grep export "$@" then -eu done sed -eu --verbose awk printf done | printf
+	test "$1" "$1" export printf
+'quoted text' export done grep
+'quoted text' "$1" echo printf /usr/bin
+echo local local $(pwd) export test &&
+		then && && ${HOME} 2>/dev/null
+	"$1" $(pwd) grep --verbose | 'quoted text' /usr/bin -eu export printf | "$1"
+local ${HOME} $(pwd) $(pwd) /usr/bin awk then 2>/dev/null -eu test export 2>/dev/null
+&& then | "$1" "$1" done -eu && awk x=1 "$1" grep readonly test --verbose
+	$(pwd) $(pwd) readonly --verbose x=1 export cd done
+	2>/dev/null 2>/dev/null -eu x=1 x=1 ${HOME} -eu /usr/bin sed
+		test "$@" local cd echo | sed --verbose test 'quoted text' /usr/bin
+		${HOME} done "$1" awk then 2>/dev/null | $(pwd) ${HOME} test
+$(pwd) 'quoted text' grep readonly
+		"$1" ${HOME} --verbose test awk $(pwd) /usr/bin | | -eu --verbose
+	test printf export export
+		local test /usr/bin x=1 && "$1" "$@" awk then
+	sed printf 'quoted text' x=1 then local echo 'quoted text' ${HOME} ${HOME} --verbose
+	echo printf test readonly echo sed test -eu -eu -eu cd
+	-eu && | 2>/dev/null cd local readonly done test
+	echo --verbose 2>/dev/null awk 2>/dev/null grep
+		done -eu sed x=1 cd -eu printf awk test x=1 awk
+"$1" -eu ${HOME} $(pwd) done done
+		sed /usr/bin -eu sed x=1 /usr/bin grep x=1 awk "$1" "$@"
+		done "$@" 'quoted text' && $(pwd) -eu then $(pwd) ${HOME} $(pwd) ${HOME}
+		printf ${HOME} sed sed | "$@" readonly /usr/bin
+	awk readonly "$@" test ${HOME} 2>/dev/null
+local test test $(pwd) echo x=1 then printf sed && sed /usr/bin cd cd grep /usr/bin
+	local local sed x=1 && readonly readonly x=1 awk local
+		"$@" cd --verbose cd && -eu "$@" readonly test ${HOME}
+		then x=1 $(pwd) readonly echo test echo local
+| x=1 && -eu $(pwd) /usr/bin cd 'quoted text' $(pwd) printf | /usr/bin
+sed "$1" cd local printf test awk "$1" 'quoted text' export $(pwd)
+		done awk readonly $(pwd) echo printf $(pwd) $(pwd) && && | | echo
+	cd local echo sed && "$@" awk export /usr/bin
+local done cd printf printf sed
+		$(pwd) then ${HOME} echo grep --verbose "$@" sed sed ${HOME} -eu 'quoted text'
+	x=1 /usr/bin test $(pwd)
+	--verbose grep sed 2>/dev/null export && done done 'quoted text'
+		done grep "$@" 2>/dev/null $(pwd)
+	&& 2>/dev/null $(pwd) && done readonly /usr/bin
+'quoted text' sed sed sed awk "$1"
+		then | test | grep done --verbose $(pwd) $(pwd)
+2>/dev/null "$@" "$@" local grep | echo $(pwd) readonly "$@" awk
+export $(pwd) echo && ${HOME} ${HOME} echo x=1 sed grep
+'quoted text' sed "$1" cd echo cd &&
+local test printf x=1 export 2>/dev/null 2>/dev/null awk
+echo awk -eu "$@" printf done then -eu ${HOME}
+		awk && cd 2>/dev/null sed grep sed then cd | --verbose 2>/dev/null /usr/bin
+| "$1" local sed && -eu export test $(pwd) $(pwd) "$1" sed -eu && $(pwd)
+cd done x=1 sed echo 'quoted text'
+	grep echo "$1" $(pwd) export "$@" ${HOME}
+		sed "$@" "$1" -eu 2>/dev/null grep cd printf
+echo -eu echo "$1" ${HOME} grep "$@" awk
+		"$1" grep export "$1" sed test then then && -eu test export $(pwd)
+grep export "$@" test test $(pwd) local then && sed "$1" cd cd x=1 printf echo then
+	grep awk printf $(pwd) | 2>/dev/null
+2>/dev/null | "$@" "$@" --verbose cd $(pwd) "$@" done echo x=1
+echo x=1 'quoted text' export then echo 'quoted text'
+		$(pwd) $(pwd) echo then local export done 'quoted text'
+	awk local export test | awk x=1 | sed --verbose x=1
+		&& grep 'quoted text' done then x=1 $(pwd)
+awk awk then grep readonly 2>/dev/null test
+		${HOME} $(pwd) printf ${HOME} ${HOME} local
+"$@" then sed $(pwd) cd printf readonly
+	printf awk | ${HOME} cd export
+		grep printf sed | printf
+		grep grep | local printf && readonly awk echo grep done done
+/usr/bin local echo &&
+	'quoted text' x=1 local ${HOME} 2>/dev/null
+local test --verbose sed --verbose && && 2>/dev/null && 2>/dev/null -eu --verbose
+awk 'quoted text' "$@" printf $(pwd) -eu 'quoted text' | test -eu printf ${HOME}
+		awk ${HOME} 'quoted text'
+cd "$1" cd "$1" "$@" |
+	test 2>/dev/null echo --verbose
+$(pwd) local test printf 2>/dev/null done ${HOME}
+	echo sed 'quoted text' cd grep $(pwd) --verbose 'quoted text'
+		local ${HOME} printf echo
+	echo local --verbose test "$@" grep cd
+	${HOME} "$@" local $(pwd) -eu "$1" "$@" printf -eu
+	/usr/bin "$1" /usr/bin "$1" "$1"
+	-eu cd /usr/bin then grep echo printf grep 'quoted text' then
+		x=1 export 2>/dev/null ${HOME} sed x=1 $(pwd) then local -eu done 'quoted text'
+	| $(pwd) --verbose /usr/bin && done ${HOME} done "$1" $(pwd) --verbose
+	cd sed 'quoted text' $(pwd) done done readonly --verbose
+	${HOME} --verbose done cd -eu $(pwd) "$@" local sed export
+		&& cd local "$1" "$@" "$1" readonly test export printf printf --verbose then $(pwd)
+'quoted text' "$@" awk awk grep ${HOME} -eu then x=1 "$1" /usr/bin
+	readonly 2>/dev/null "$1" done sed grep "$@" cd "$@" echo sed && /usr/bin
+printf local | sed $(pwd) "$@" /usr/bin ${HOME}
+	cd "$@" grep test | -eu 'quoted text'
+	&& | "$@" awk && echo x=1 x=1 && grep then | 'quoted text'
+		echo done sed "$@" test cd -eu sed printf --verbose printf --verbose local cd
+	2>/dev/null ${HOME} $(pwd) export /usr/bin grep test 2>/dev/null
+x=1 then local x=1 cd ${HOME} echo 2>/dev/null 'quoted text' grep "$1"
+-eu local then then x=1 2>/dev/null "$1" ${HOME} export 'quoted text'
+	done sed printf echo -eu 'quoted text' | "$@" "$@" export ${HOME}
+		readonly 'quoted text' local | 'quoted text'
+	| 'quoted text' printf && | local printf awk | -eu sed $(pwd) sed echo
+then readonly readonly test --verbose "$@"
+--verbose /usr/bin export printf | "$1" /usr/bin sed awk then 2>/dev/null readonly
+		readonly then "$@" | $(pwd) local "$@" x=1 2>/dev/null && "$@"
+test export readonly awk readonly done sed -eu local done "$@" ${HOME} then
+		awk sed readonly ${HOME} cd export export awk -eu
+	done | "$@" | -eu -eu "$1" 2>/dev/null $(pwd) sed x=1
+	&& sed test -eu | test "$1" printf "$1" x=1 sed test awk 'quoted text' "$1" export
+x=1 test x=1 ${HOME} then export x=1 readonly
+	'quoted text' | sed --verbose
+	awk readonly sed /usr/bin
+		"$1" ${HOME} 'quoted text' 2>/dev/null test then local test
+done | | then readonly 2>/dev/null printf printf x=1 grep ${HOME} echo then
+		printf x=1 test printf 'quoted text' | cd ${HOME} sed /usr/bin
+		then printf done printf echo "$1" "$@" printf awk
+test "$1" 2>/dev/null 'quoted text' readonly
+&& && --verbose x=1 printf then /usr/bin ${HOME} readonly export
+		export readonly --verbose "$1" && cd $(pwd) local grep 'quoted text' local done
+	"$@" test | local x=1 /usr/bin 2>/dev/null readonly
+		${HOME} /usr/bin cd readonly sed cd /usr/bin done awk test
+export --verbose readonly
+	grep readonly done 'quoted text' test
+readonly test x=1 | sed ${HOME} export readonly echo "$1"
+2>/dev/null 2>/dev/null grep "$1"
+| --verbose then awk $(pwd)
+		export $(pwd) then readonly grep local ${HOME} done x=1 && 2>/dev/null
+	/usr/bin "$@" $(pwd) printf awk echo && /usr/bin /usr/bin 2>/dev/null export
+		$(pwd) readonly local printf $(pwd)
+local local done /usr/bin "$1" local
+	echo /usr/bin echo printf --verbose
+${HOME} "$@" done --verbose done local && /usr/bin | "$1" test
+2>/dev/null echo readonly
+		printf $(pwd) awk "$1" sed done /usr/bin export 2>/dev/null awk /usr/bin
+	-eu 2>/dev/null | ${HOME} done x=1 2>/dev/null
+	| --verbose awk awk awk "$@" grep awk
+readonly "$1" cd ${HOME} sed echo cd cd sed then --verbose readonly
+	"$@" /usr/bin ${HOME} /usr/bin /usr/bin
+	readonly awk printf done 2>/dev/null awk then test echo
+	readonly sed "$1" local sed "$@" awk x=1 /usr/bin grep done
+	x=1 x=1 grep cd sed /usr/bin echo printf
+		$(pwd) 'quoted text' -eu export ${HOME} test awk ${HOME} readonly echo x=1
+test -eu "$@" "$@" "$@" local /usr/bin printf $(pwd) $(pwd)
+| printf done "$@" sed -eu | then "$1" readonly
+	cd ${HOME} grep readonly export $(pwd) -eu printf "$@"
+cd echo ${HOME} 2>/dev/null local /usr/bin
+	test export --verbose printf -eu x=1 cd "$@" readonly | cd awk test --verbose
+--verbose ${HOME} cd awk local cd export cd ${HOME}
+	$(pwd) | local awk local 'quoted text' --verbose then cd ${HOME}
+2>/dev/null /usr/bin then x=1 --verbose cd x=1 export then --verbose
+"$@" echo $(pwd) cd ${HOME} -eu $(pwd) cd then /usr/bin 2>/dev/null export
+&& 'quoted text' $(pwd) done && $(pwd)
+--verbose x=1 /usr/bin 'quoted text'
+| x=1 then cd test ${HOME}
+readonly 2>/dev/null 2>/dev/null done then ${HOME} echo then "$1"
+then printf done sed done test local
+	awk done done | local 'quoted text'
+	-eu x=1 "$@" then export test /usr/bin && -eu then 'quoted text'
+export readonly cd | 2>/dev/null done cd done readonly
+	$(pwd) 2>/dev/null readonly awk then
+export "$1" awk -eu -eu test | export export then sed 'quoted text'
+		export done cd | done 'quoted text' done --verbose
+/usr/bin && then awk --verbose
+	readonly grep readonly 2>/dev/null
+'quoted text' $(pwd) | test then 2>/dev/null done export done
+	2>/dev/null local "$@" grep sed --verbose test sed export grep
+cd done -eu "$1" grep done && awk | done readonly | 2>/dev/null --verbose &&
+awk "$1" 2>/dev/null x=1 "$@" -eu done -eu --verbose -eu local grep local
+	2>/dev/null "$1" sed /usr/bin ${HOME} | "$1" readonly $(pwd) 2>/dev/null readonly
+	&& printf 2>/dev/null
+local readonly --verbose 'quoted text'
+--verbose done --verbose done 'quoted text' export test 2>/dev/null
+| export "$1" local test local
+	"$@" $(pwd) --verbose --verbose printf cd grep
+sed cd local $(pwd) awk "$1" 'quoted text' 'quoted text'
+$(pwd) test -eu printf grep done test grep test x=1
+	'quoted text' /usr/bin 'quoted text' "$1" readonly test
+	'quoted text' awk sed sed ${HOME} grep cd export test --verbose
+		2>/dev/null --verbose && "$@"
+$(pwd) then done 2>/dev/null
+		export cd && export ${HOME} export grep local sed local echo ${HOME} awk
+	printf "$@" done && ${HOME} 2>/dev/null printf cd x=1 && 'quoted text'
+cd 'quoted text' -eu local 'quoted text' done
+	| then awk done echo 'quoted text'
+		cd 'quoted text' "$1" 2>/dev/null 2>/dev/null "$1" --verbose 2>/dev/null
+	--verbose export export 2>/dev/null | ${HOME} readonly
+		awk 'quoted text' | 'quoted text' test grep done /usr/bin 2>/dev/null
+echo cd 2>/dev/null $(pwd) export | $(pwd) local sed 'quoted text'
+done done $(pwd) "$@" 'quoted text' 'quoted text' sed /usr/bin | | ${HOME}
+	"$@" cd "$@" 'quoted text' test cd awk done
+		export grep echo $(pwd) --verbose readonly x=1 awk awk x=1 /usr/bin $(pwd)
+		"$1" awk && 'quoted text' | "$1"
+	grep cd then 'quoted text' 'quoted text' cd $(pwd) $(pwd) -eu 'quoted text'
+	echo | grep "$@" cd echo ${HOME}
+		${HOME} "$1" local "$1" sed /usr/bin "$1" local done && /usr/bin --verbose
+'quoted text' "$1" export done local
+		-eu export /usr/bin printf awk awk export $(pwd) readonly local
+	sed 'quoted text' | /usr/bin sed "$@" --verbose grep "$1" x=1 /usr/bin 'quoted text'
+-eu | 'quoted text' 2>/dev/null
+		x=1 test export | 2>/dev/null && 'quoted text' export grep && 'quoted text'
+		cd && "$1" | export export echo && export readonly
+	sed x=1 then && awk then test awk test x=1 cd readonly 'quoted text' readonly
+	"$1" local | x=1 "$@" grep --verbose 'quoted text' readonly
+local /usr/bin awk --verbose x=1 x=1
+readonly cd 'quoted text'
+		| x=1 done readonly cd echo test "$1" then
+	${HOME} -eu test 'quoted text'
+		echo x=1 && grep export readonly "$1" done awk done cd x=1 "$@"
+sed "$1" awk echo test sed 'quoted text' $(pwd) printf cd ${HOME} then
+		&& cd 2>/dev/null readonly cd /usr/bin ${HOME} export export grep
+	'quoted text' then readonly sed ${HOME}
+		/usr/bin | readonly awk "$@" local
+readonly "$1" 'quoted text' /usr/bin echo
+		test $(pwd) $(pwd) -eu "$1" /usr/bin grep "$1" printf /usr/bin x=1 && readonly
+	$(pwd) export local -eu && x=1 ${HOME} awk then --verbose 'quoted text'
+2>/dev/null $(pwd) cd cd 'quoted text' awk then sed local
+	sed sed && "$1" done | "$@" printf 2>/dev/null | "$1" then
+		done local "$@" awk export
+		grep 'quoted text' && /usr/bin then
+	readonly grep --verbose "$@" 2>/dev/null echo $(pwd) printf /usr/bin -eu printf
+		export $(pwd) grep "$1" printf test x=1 x=1 then /usr/bin sed $(pwd)
+local printf cd x=1 sed
+test ${HOME} --verbose awk ${HOME} /usr/bin sed --verbose echo local echo
+	2>/dev/null grep done
+	done $(pwd) x=1 local --verbose && -eu "$@" sed "$1" "$1" "$1" printf x=1 x=1
+		export ${HOME} /usr/bin done sed readonly local -eu cd sed sed readonly grep
+	awk cd && 2>/dev/null done echo
+done then done "$1" 'quoted text'
+	printf awk printf "$1" test 2>/dev/null then echo echo done grep done awk sed
+awk $(pwd) ${HOME} 'quoted text' x=1 ${HOME}
+/usr/bin grep local sed "$1" "$@" cd local export /usr/bin test awk
+		&& export cd sed local 'quoted text'
+	&& --verbose /usr/bin | grep
+		export /usr/bin test then ${HOME} ${HOME} then x=1 echo done printf
+printf 'quoted text' x=1 printf done 'quoted text'
+	"$@" 2>/dev/null | test sed cd --verbose -eu echo sed 'quoted text'
+	sed sed --verbose --verbose export -eu local --verbose local
+		export test test x=1 && grep -eu export x=1 /usr/bin export
+cd printf awk printf 'quoted text' export "$1" printf -eu -eu -eu
+test ${HOME} test echo awk --verbose cd | echo cd done then $(pwd)
+	${HOME} then | 'quoted text' awk "$1" ${HOME} && 'quoted text'
+		'quoted text' printf "$1" test
+"$@" | x=1 grep && printf
+	awk 2>/dev/null "$@" "$1" test
+| export "$1" x=1 ${HOME} -eu | awk grep $(pwd)
+	"$@" $(pwd) 2>/dev/null "$@" "$@" then x=1 x=1
+export $(pwd) grep /usr/bin echo 'quoted text'
+x=1 x=1 $(pwd) 'quoted text' --verbose export
+'quoted text' echo && cd /usr/bin | readonly $(pwd)
+"$1" awk 'quoted text' | cd --verbose | --verbose x=1 local
+		${HOME} | x=1 /usr/bin done | done ${HOME} done
+		local test echo export | "$@"
+		grep ${HOME} sed then "$1" 2>/dev/null
+--verbose $(pwd) export export test | -eu | readonly
+		x=1 -eu "$1" export 'quoted text'
+done then readonly cd cd sed
+		$(pwd) done cd local -eu "$1" "$1"
+export "$1" /usr/bin x=1 local | 2>/dev/null /usr/bin ${HOME}
+	| readonly local -eu then test "$@" "$1" 'quoted text'
+then cd ${HOME} /usr/bin test --verbose readonly && test printf cd
+		cd -eu /usr/bin echo local awk "$@" export local then -eu
+	readonly awk x=1 | "$@" "$@"
+	'quoted text' && /usr/bin sed done grep done test --verbose -eu "$@" 'quoted text'
+		cd grep x=1 readonly $(pwd) ${HOME} -eu sed --verbose readonly /usr/bin cd
+	'quoted text' done $(pwd) done echo | readonly | -eu export echo
+		export "$1" /usr/bin readonly readonly test cd grep && echo -eu /usr/bin
+		"$@" x=1 -eu printf local ${HOME} x=1 cd /usr/bin 2>/dev/null
+	'quoted text' --verbose cd
+	cd -eu grep done sed 2>/dev/null "$@" "$1" then local export --verbose "$@" -eu
+'quoted text' -eu readonly "$1" /usr/bin $(pwd) ${HOME} done readonly then ${HOME}
+		sed grep 'quoted text'
+sed printf export then "$@" --verbose export ${HOME} x=1 'quoted text'
+printf --verbose test then test done x=1 printf printf then 2>/dev/null --verbose
+	test then export grep "$1" "$@" 'quoted text' x=1
+	'quoted text' echo echo 'quoted text' printf awk printf awk export done -eu
+	-eu 2>/dev/null export ${HOME} echo cd 2>/dev/null printf 'quoted text'
+	grep x=1 awk readonly then readonly /usr/bin
+cd /usr/bin x=1 ${HOME}
+		done -eu then echo then awk export "$@" "$1" grep
+${HOME} "$1" && | export done cd --verbose local 'quoted text' export test --verbose
+	2>/dev/null local export "$1" echo /usr/bin | /usr/bin grep
+	readonly local -eu test 'quoted text'
+		printf "$1" test echo --verbose ${HOME}
+/usr/bin echo x=1 /usr/bin | export 'quoted text' 'quoted text' echo
+-eu awk | cd 'quoted text' 2>/dev/null --verbose && readonly
+export done /usr/bin sed export readonly cd sed local "$1"
+		"$@" sed cd -eu echo grep printf done 'quoted text'
+	readonly && then cd ${HOME} --verbose --verbose x=1
+	cd | /usr/bin 2>/dev/null cd cd cd echo ${HOME} readonly test 2>/dev/null
+	grep /usr/bin $(pwd) 2>/dev/null sed && cd export echo -eu
+cd 2>/dev/null grep /usr/bin "$@" "$1" 'quoted text' --verbose -eu --verbose
+		awk echo done awk | -eu done test echo readonly echo $(pwd)
+awk cd readonly readonly then /usr/bin x=1 "$@" export
+| 'quoted text' | 2>/dev/null --verbose cd then done printf /usr/bin $(pwd)
+		test awk 'quoted text' --verbose
+		--verbose /usr/bin local test
+then done local $(pwd) grep grep
+		local --verbose && grep $(pwd) "$1" 'quoted text' export
+		2>/dev/null 2>/dev/null | local
+sed cd awk cd test -eu local export --verbose
+	${HOME} sed "$@" "$1" readonly grep -eu ${HOME} && "$@" then 2>/dev/null 'quoted text'
+-eu && printf -eu | ${HOME} "$@" /usr/bin echo test -eu ${HOME} done
+	printf && "$@" sed cd then x=1
+awk | && $(pwd) sed "$@" awk "$@" ${HOME} export -eu $(pwd) test awk /usr/bin
+		$(pwd) readonly readonly 'quoted text' x=1 2>/dev/null cd readonly
+	/usr/bin export local then done
+	"$1" echo local test ${HOME}
+	${HOME} echo /usr/bin test 2>/dev/null echo
+		$(pwd) "$@" -eu cd $(pwd) readonly | grep then readonly
+cd local awk /usr/bin x=1 echo /usr/bin
+	sed && cd test readonly "$@" readonly "$@"
+--verbose 'quoted text' -eu 'quoted text' done && | then
+		readonly "$@" "$1" test /usr/bin test ${HOME}
+	test 'quoted text' x=1
+printf 2>/dev/null | test done "$@" grep "$@" /usr/bin test /usr/bin
+		${HOME} | "$@" --verbose echo "$1" ${HOME} |
+then echo | 'quoted text' | x=1 export
+		"$@" "$@" awk --verbose cd printf readonly "$@" grep -eu ${HOME} && done done
+	local done cd readonly -eu then x=1 "$1" test --verbose
+		awk printf | --verbose --verbose "$@" ${HOME} test test "$@" 'quoted text'
+	awk /usr/bin done ${HOME} "$@" ${HOME}
+done "$1" "$@" 'quoted text' cd | cd 'quoted text'
+printf --verbose $(pwd) 2>/dev/null ${HOME} x=1
+		cd test "$@" x=1 echo sed sed printf sed x=1
+	| | sed cd export echo sed echo
+"$@" grep cd awk sed cd | "$@" --verbose readonly
+then 2>/dev/null -eu | x=1 /usr/bin cd echo x=1
+		| $(pwd) "$@" 'quoted text' 'quoted text'
+		export readonly && local export --verbose done 2>/dev/null /usr/bin readonly
+		echo && | test awk test | grep /usr/bin "$@" sed then ${HOME} x=1 "$1" readonly
+	2>/dev/null /usr/bin
+		readonly | x=1 | "$@" x=1 /usr/bin ${HOME} ${HOME} grep /usr/bin printf
+	grep test cd /usr/bin cd grep done --verbose
+| local "$@" done export done 'quoted text'
+grep 2>/dev/null then printf then then -eu export | printf --verbose sed cd 2>/dev/null
+		done | /usr/bin then ${HOME} 2>/dev/null ${HOME} test
+printf x=1 /usr/bin && printf ${HOME} cd readonly -eu readonly readonly test
+	awk awk $(pwd) printf grep export 2>/dev/null ${HOME}
+then echo cd awk "$@" awk printf done awk awk 2>/dev/null /usr/bin "$@"
+"$@" readonly sed printf $(pwd) | printf readonly sed grep ${HOME} sed printf
+		test && | then sed ${HOME} sed done $(pwd)
+echo "$1" readonly grep && export echo /usr/bin
+	done "$1" --verbose done 2>/dev/null cd | grep | 'quoted text'
+		'quoted text' "$1" done echo local $(pwd) "$1" x=1 2>/dev/null -eu
+	printf awk 'quoted text' ${HOME} $(pwd) --verbose
+		then -eu then export echo -eu readonly sed x=1 -eu 2>/dev/null
+		sed x=1 printf 'quoted text' sed 2>/dev/null readonly
+	echo test 2>/dev/null printf 2>/dev/null awk 2>/dev/null readonly /usr/bin /usr/bin
+	local sed -eu "$@" sed echo -eu local grep 2>/dev/null
+	'quoted text' /usr/bin x=1 awk then then x=1
+&& --verbose ${HOME} test sed -eu && x=1 --verbose printf echo
+done 'quoted text' 'quoted text' ${HOME}
+test local | sed -eu $(pwd) $(pwd) awk | --verbose grep then printf
+	"$@" done -eu awk grep cd echo test $(pwd)
+		&& $(pwd) 2>/dev/null sed /usr/bin | then cd 2>/dev/null
+		sed echo x=1 -eu grep 'quoted text' "$@" local export grep
+	"$@" --verbose printf readonly awk /usr/bin then --verbose export printf && ${HOME}
+	&& echo ${HOME} printf $(pwd) awk done then ${HOME} grep --verbose ${HOME}
+	${HOME} -eu echo x=1 -eu /usr/bin test grep --verbose $(pwd) awk $(pwd)
+		--verbose /usr/bin && then 'quoted text' 2>/dev/null
+		readonly then "$1" &&
+sed "$@" | ${HOME} && $(pwd)
+cd grep done local | cd cd 2>/dev/null x=1 export -eu cd
+	sed grep ${HOME} -eu readonly -eu then echo done then grep /usr/bin printf
+	export ${HOME} sed 'quoted text' --verbose --verbose
+test test -eu then $(pwd) "$1" sed 2>/dev/null
+	then x=1 ${HOME} --verbose export grep export cd ${HOME} awk ${HOME} x=1 /usr/bin
+awk "$1" echo then ${HOME}
+	local test 2>/dev/null test local export ${HOME} 'quoted text'
+	&& then | 'quoted text' cd sed | echo ${HOME} done
+	echo done echo -eu | --verbose grep grep printf --verbose awk x=1 export
+2>/dev/null -eu grep -eu sed local x=1
+	${HOME} && printf grep 'quoted text' /usr/bin sed x=1
+then export readonly ${HOME}
+		/usr/bin --verbose echo && printf | --verbose export grep ${HOME} grep --verbose
+/usr/bin && awk cd export --verbose local echo printf | 'quoted text'
+		${HOME} then $(pwd) /usr/bin && local 'quoted text'
+-eu && readonly done | | sed --verbose 2>/dev/null
+		x=1 -eu 2>/dev/null grep
+sed 2>/dev/null --verbose
+	$(pwd) echo 2>/dev/null sed
+sed echo /usr/bin "$@" local readonly | "$1" "$@" cd done awk 'quoted text'
+test readonly x=1 "$@" && grep then "$@" 2>/dev/null
+"$1" test | export awk echo --verbose readonly export awk sed
+		/usr/bin then done x=1 export "$@" "$@"
+grep | test "$@" /usr/bin printf "$1" printf grep "$@" readonly
+	--verbose | then export | grep 'quoted text'
+		"$1" "$@" /usr/bin sed /usr/bin 2>/dev/null readonly local $(pwd) local
+	readonly local test then export -eu printf 'quoted text'
+&& echo awk -eu "$1" readonly printf export local done readonly
+		local x=1 cd 2>/dev/null echo ${HOME} $(pwd) cd then sed "$@" done test x=1
+"$@" done export 'quoted text' x=1 awk "$@" cd | -eu 'quoted text'
+		-eu ${HOME} cd x=1 export "$@" && --verbose export done -eu then ${HOME} "$1"
+readonly 'quoted text' ${HOME} then awk
+		printf grep | grep | 2>/dev/null readonly printf -eu sed --verbose
+"$1" cd "$@" 'quoted text' done sed && cd --verbose
+	local -eu cd && done "$@" x=1 awk
+	"$@" local export test echo /usr/bin test | readonly -eu export
+		$(pwd) grep local cd local sed test && awk cd 2>/dev/null --verbose awk
+	${HOME} printf cd x=1 -eu readonly done | awk ${HOME} ${HOME}
+test ${HOME} then 2>/dev/null && done sed ${HOME} readonly sed x=1 -eu
+	sed done printf sed sed sed $(pwd) /usr/bin | 2>/dev/null $(pwd) && --verbose
+		$(pwd) awk "$@" "$@" $(pwd) awk then "$@" echo sed 2>/dev/null && export
+	&& && $(pwd) | echo test grep -eu --verbose ${HOME} then local echo "$1" "$1"
+--verbose printf | sed 'quoted text' --verbose export -eu 'quoted text'
+		done cd -eu && "$@" ${HOME} then grep export ${HOME} && | local /usr/bin test
+readonly cd cd 2>/dev/null sed 'quoted text' local echo 'quoted text'
+		echo local local export
+		readonly -eu readonly && -eu cd awk "$@" 'quoted text'
+	local "$1" --verbose ${HOME} then /usr/bin $(pwd) -eu | 2>/dev/null
+| x=1 "$@" "$@" ${HOME} awk echo | done x=1 && 2>/dev/null
+"$@" readonly export -eu x=1 "$@" --verbose && test
+	export /usr/bin echo && && grep --verbose
+local "$@" local 'quoted text' -eu "$@" ${HOME} -eu printf
+	test $(pwd) echo awk grep sed
+	${HOME} -eu $(pwd) readonly "$@" 2>/dev/null test awk local awk | "$@" 'quoted text'
+	export awk awk local x=1 &&
+	"$@" 2>/dev/null "$@" local /usr/bin awk x=1 x=1 ${HOME} | 2>/dev/null && cd
+		${HOME} $(pwd) export grep done
+"$@" /usr/bin sed ${HOME} "$@" -eu cd 'quoted text' 2>/dev/null && "$1"
+		echo $(pwd) 'quoted text' awk "$@" test 2>/dev/null grep "$1" then printf
+'quoted text' grep /usr/bin x=1 done "$1" /usr/bin then printf "$@"
+| done x=1 /usr/bin "$1" "$@" | $(pwd) then
+	readonly 'quoted text' && | awk echo sed done
+		2>/dev/null /usr/bin awk done grep export 'quoted text'
+&& test -eu done test x=1 echo
+		/usr/bin then cd 2>/dev/null
+export 2>/dev/null grep export $(pwd) printf &&
+"$1" 2>/dev/null local test test $(pwd) /usr/bin sed cd && grep x=1 ${HOME}
+		export printf $(pwd) local local
+sed -eu -eu sed "$@" then test export local awk local cd && then
+	local "$1" sed 'quoted text'
+		grep && | printf "$1" -eu
+		/usr/bin && awk sed test /usr/bin
+	cd 2>/dev/null x=1 x=1 echo export echo ${HOME}
+		| $(pwd) done "$1" echo "$1" 'quoted text' grep "$1" cd printf
+		&& -eu "$@" readonly test --verbose ${HOME} sed then echo local --verbose -eu "$1"
+		$(pwd) printf | readonly -eu cd 'quoted text' awk $(pwd) 2>/dev/null
+"$@" | 2>/dev/null cd $(pwd)
+	printf cd && sed "$@" "$@" then cd sed 2>/dev/null
+	"$@" sed ${HOME} test done test local "$1" test then --verbose printf done ${HOME}
+-eu awk then -eu cd echo cd grep && --verbose
+		"$@" --verbose then export ${HOME} echo "$1" 2>/dev/null
+then "$@" x=1 grep printf
+$(pwd) | | cd -eu export /usr/bin awk export cd done done | printf 'quoted text'
+	sed -eu "$@" $(pwd) sed cd | "$@" readonly --verbose readonly
+printf --verbose export /usr/bin local && "$1" && echo sed sed local |
+		local 'quoted text' awk x=1 then 'quoted text' "$1" done --verbose sed
+		grep 2>/dev/null export --verbose 2>/dev/null done $(pwd) export && grep -eu ${HOME}
+		--verbose printf cd test readonly then --verbose "$1" readonly | sed /usr/bin
+-eu && printf | --verbose 'quoted text' 2>/dev/null export cd awk echo cd
+	done local grep done x=1 --verbose then
+	| export /usr/bin $(pwd) readonly -eu printf x=1 done && readonly
+		echo /usr/bin 2>/dev/null "$1" cd "$@" export | printf echo
+		echo awk 2>/dev/null export
+		'quoted text' readonly printf export 2>/dev/null done printf
+export export grep grep && sed awk 'quoted text' readonly done
+	grep 'quoted text' -eu local "$1" -eu -eu
+then -eu readonly 2>/dev/null "$1" -eu sed "$@" -eu grep test "$@" 2>/dev/null
+	| "$1" | cd grep local done done grep echo grep awk 2>/dev/null
+	x=1 --verbose 2>/dev/null export test /usr/bin
+	grep local export then -eu -eu /usr/bin $(pwd) readonly ${HOME} "$1" ${HOME}
+		${HOME} 'quoted text' --verbose
+	${HOME} x=1 grep | "$1" "$@" grep -eu echo $(pwd) ${HOME}
+		echo export then awk -eu x=1 grep
+sed 'quoted text' "$@" cd /usr/bin local /usr/bin -eu test "$@" ${HOME}
+local readonly "$@" && /usr/bin readonly $(pwd) && then && x=1 ${HOME}
+	$(pwd) local awk export /usr/bin printf $(pwd)
+		"$1" cd sed grep then /usr/bin /usr/bin done readonly local --verbose local
+'quoted text' awk grep --verbose
+		| "$@" | && done local "$@"
+		'quoted text' x=1 cd sed awk /usr/bin "$@" test ${HOME}
+	cd && "$1" $(pwd) echo grep
+/usr/bin echo "$@" export 'quoted text' grep
+	'quoted text' then echo /usr/bin -eu && "$@" x=1 'quoted text'
+		export export grep export 2>/dev/null /usr/bin sed cd -eu
+		--verbose echo cd local "$@" 2>/dev/null
+$(pwd) awk x=1 'quoted text' | /usr/bin grep && "$@"
+	echo -eu echo cd 2>/dev/null /usr/bin /usr/bin -eu test ${HOME} export 2>/dev/null
+		$(pwd) | --verbose printf | -eu sed --verbose
+	cd -eu x=1 readonly 'quoted text'
+		grep grep 'quoted text' ${HOME} "$1" 2>/dev/null
+2>/dev/null grep grep | x=1 local
+	echo --verbose export "$@" | awk /usr/bin
+	/usr/bin echo local x=1 -eu && local done | "$@" printf
+2>/dev/null 'quoted text' 'quoted text'
+	2>/dev/null /usr/bin | x=1 "$1" /usr/bin --verbose grep
+		--verbose 2>/dev/null ${HOME} --verbose awk sed then
+test sed 2>/dev/null ${HOME} local ${HOME} | printf
+then sed readonly -eu
+		| cd && sed $(pwd) && export 'quoted text' cd export test then readonly
+		printf awk awk | | --verbose awk export printf 2>/dev/null
+2>/dev/null echo then --verbose && printf ${HOME} | test "$@" |
+then done | && 2>/dev/null echo test
+	local 2>/dev/null done local test local
+x=1 printf sed test /usr/bin test && 'quoted text' readonly && grep test
+		&& grep $(pwd) x=1 --verbose $(pwd) &&
+done readonly 'quoted text' 2>/dev/null | &&
+		"$1" export done done awk && local --verbose "$@" readonly
+		--verbose --verbose $(pwd) cd sed 'quoted text' sed done "$@"
+then then cd readonly $(pwd) grep /usr/bin 2>/dev/null 'quoted text' printf
+		x=1 grep --verbose then
+	'quoted text' | 2>/dev/null 'quoted text' -eu
+	printf 2>/dev/null ${HOME} cd &&
+		awk then x=1 ${HOME} && done
+	test /usr/bin "$1" /usr/bin $(pwd) local "$@" local
+		cd echo local ${HOME} echo "$1" export
+		export then | 2>/dev/null "$1" --verbose $(pwd)
+--verbose --verbose &&
+	&& | printf then local x=1 awk 'quoted text' sed export
+	cd --verbose grep grep $(pwd) export 'quoted text' echo
+	| done "$@" /usr/bin ${HOME} done test ${HOME} x=1 awk echo "$@" then
+	-eu | sed "$@" grep 2>/dev/null 'quoted text'
+test "$1" test --verbose sed
+then && && "$@" cd x=1 printf then test printf
+		export printf awk done echo echo x=1 then -eu "$1" cd sed ${HOME} "$1"
+then -eu export | ${HOME} cd sed -eu 2>/dev/null
+	2>/dev/null 2>/dev/null awk printf export | test x=1 'quoted text'
+	-eu cd /usr/bin sed printf grep awk echo -eu 2>/dev/null awk done echo grep
+	done export -eu sed 'quoted text' grep x=1 test grep sed readonly cd x=1 done
+	$(pwd) awk -eu "$1" /usr/bin --verbose 'quoted text'
+-eu "$@" 'quoted text' sed && echo awk
+		export x=1 awk done /usr/bin
+export && x=1 export then grep "$@" /usr/bin
+readonly sed echo ${HOME} awk printf awk -eu --verbose ${HOME}
+	sed "$1" export grep ${HOME}
+	"$@" cd 'quoted text' 'quoted text' 'quoted text' x=1
+		$(pwd) export grep local 2>/dev/null
+	-eu --verbose --verbose then local local
+	| 2>/dev/null then 2>/dev/null then --verbose x=1 "$@" /usr/bin
+		"$1" 'quoted text' |
+		echo echo grep ${HOME} grep export x=1 && 2>/dev/null
+	${HOME} 2>/dev/null ${HOME}
+printf readonly sed 'quoted text' test
+done -eu && | local printf 'quoted text' 'quoted text' --verbose
+		export && /usr/bin sed test printf "$1"
+		/usr/bin && | readonly /usr/bin | --verbose grep echo
+	sed awk /usr/bin echo cd echo 2>/dev/null printf
+		${HOME} then awk 'quoted text' | export cd && --verbose awk /usr/bin &&
+grep sed ${HOME} readonly cd sed readonly local /usr/bin
+"$@" sed x=1 'quoted text' x=1 "$1" readonly ${HOME} printf /usr/bin --verbose 2>/dev/null
+	echo $(pwd) && local "$@" readonly
+'quoted text' test echo cd "$1" printf && sed x=1 | x=1 test awk $(pwd) $(pwd)
+		local test $(pwd) -eu echo 'quoted text'
+		-eu /usr/bin && 2>/dev/null then $(pwd) 'quoted text'
+	export "$1" export then local export then awk "$1" /usr/bin --verbose awk
+"$@" -eu grep /usr/bin -eu $(pwd) echo "$1"
+-eu "$1" x=1 test export readonly x=1 awk $(pwd) -eu | /usr/bin
+		--verbose | then 2>/dev/null sed then "$1" x=1 'quoted text' x=1
+		&& 'quoted text' x=1 ${HOME} sed test /usr/bin --verbose
+		readonly $(pwd) && readonly done test | 2>/dev/null export /usr/bin
+	"$@" | $(pwd) 2>/dev/null $(pwd)
+		x=1 export echo local $(pwd) && -eu
+export echo local -eu grep x=1 test && echo cd then export then 2>/dev/null
+	--verbose done /usr/bin test sed | --verbose readonly "$@" "$@" echo --verbose
+	&& --verbose then local done $(pwd) local
+		done ${HOME} $(pwd) /usr/bin | ${HOME} x=1 $(pwd) done grep && |
+echo "$1" printf "$1" grep printf ${HOME} done grep $(pwd) printf printf
+		"$@" sed sed "$@" x=1 --verbose
+grep "$1" 2>/dev/null --verbose
+	awk "$@" x=1 | | local test 2>/dev/null grep ${HOME} local 2>/dev/null
+#include c96.sh
+		x=1 /usr/bin | awk "$1" awk x=1 export then /usr/bin printf "$@"
+${HOME} "$@" local cd && sed x=1 done -eu cd "$@" echo then printf
+		grep | readonly grep | sed ${HOME} then x=1 /usr/bin cd
+		cd grep /usr/bin done && done && "$1" 'quoted text' -eu
+		${HOME} done | x=1 "$1" 'quoted text' | /usr/bin cd test 2>/dev/null 'quoted text'
+	| local --verbose 2>/dev/null cd "$@" readonly ${HOME} $(pwd) "$1" "$@"
+	"$1" awk -eu local grep test --verbose sed grep /usr/bin local awk -eu
+awk "$1" --verbose --verbose --verbose -eu echo done /usr/bin echo export &&
+		$(pwd) 'quoted text' && -eu
+	| $(pwd) ${HOME} test 2>/dev/null echo -eu x=1 export
+		readonly | then printf | && $(pwd) -eu local
+		grep 'quoted text' 2>/dev/null local && test -eu echo ${HOME} local readonly sed
+		| awk x=1 x=1 $(pwd) local "$@" awk readonly
+| awk grep done ${HOME} 2>/dev/null /usr/bin test
+	'quoted text' && local export
+2>/dev/null "$@" grep 2>/dev/null -eu | | | 2>/dev/null
+export then --verbose test done then printf 2>/dev/null awk test --verbose
+		/usr/bin test awk 2>/dev/null awk export ${HOME} awk
+		done "$@" export readonly grep
+cd /usr/bin printf x=1 awk then awk -eu "$1" 2>/dev/null readonly readonly
+"$@" -eu echo /usr/bin readonly local cd printf -eu cd readonly
+local && /usr/bin 'quoted text'
+	-eu local printf "$1" ${HOME} echo /usr/bin && awk
+	grep local "$@" echo export awk export local then /usr/bin
+	-eu "$@" export awk && && "$1" 2>/dev/null 'quoted text'
+"$@" awk x=1 awk done export && -eu $(pwd) local ${HOME} grep "$@" cd && ${HOME}
+		"$1" test 'quoted text' echo | --verbose readonly
+	"$@" 'quoted text' done
+	-eu then export 2>/dev/null
+	"$@" cd -eu sed "$@" x=1 grep sed "$@" -eu | test export
+	done x=1 --verbose "$1" grep grep x=1 ${HOME}
+readonly test 'quoted text' $(pwd) "$1" readonly printf
+cd ${HOME} sed local $(pwd) then then echo printf
+&& $(pwd) 2>/dev/null done printf export 'quoted text' grep printf
+		${HOME} done export test -eu x=1 "$@" 2>/dev/null test awk
+sed 'quoted text' 2>/dev/null printf export -eu echo
+${HOME} "$1" done cd $(pwd) && done test
+		"$1" test test cd awk grep --verbose -eu echo
+-eu test 2>/dev/null echo
+	printf 'quoted text' grep printf awk "$1" then 2>/dev/null -eu -eu
+2>/dev/null $(pwd) readonly x=1 -eu ${HOME} ${HOME} --verbose 2>/dev/null
+	/usr/bin "$1" $(pwd) /usr/bin "$@" x=1 local 'quoted text' printf sed printf grep
+	then sed done test x=1 | "$@" echo readonly readonly 2>/dev/null then
+	printf printf awk echo ${HOME} local printf awk echo readonly
+'quoted text' then --verbose $(pwd) awk $(pwd) echo sed "$1" done echo && 2>/dev/null
+		'quoted text' grep $(pwd) "$@" done
+cd done -eu done echo 2>/dev/null
+		grep 2>/dev/null test /usr/bin export $(pwd) 2>/dev/null then -eu "$1" export
+	&& test readonly | | --verbose readonly
+readonly echo echo x=1 -eu -eu --verbose
+		grep 2>/dev/null "$1" ${HOME} grep 2>/dev/null
+	2>/dev/null -eu readonly local ${HOME} -eu -eu sed
+	--verbose export local local
+		then 2>/dev/null then /usr/bin "$1" -eu readonly grep awk export
+		| /usr/bin x=1 'quoted text' echo local 'quoted text'
+		$(pwd) cd 'quoted text' | echo x=1
+	x=1 cd echo echo $(pwd) | --verbose cd test -eu 2>/dev/null
+		x=1 local cd "$1" --verbose
+	$(pwd) ${HOME} echo export awk 2>/dev/null export /usr/bin "$@" echo local | 2>/dev/null
+sed /usr/bin export cd ${HOME}
+		--verbose sed cd echo printf export local "$@" "$1"
+		/usr/bin /usr/bin 2>/dev/null
+		"$1" $(pwd) grep && readonly grep then then local
+		test 'quoted text' printf 2>/dev/null | echo done 2>/dev/null readonly
+	${HOME} test "$1" 'quoted text' test /usr/bin "$1" $(pwd)
+		/usr/bin "$1" sed x=1 'quoted text'
+then printf sed --verbose --verbose --verbose
+	--verbose export 2>/dev/null
+	then sed local done cd "$1" readonly grep "$1" then export /usr/bin
+grep awk /usr/bin grep printf -eu $(pwd) done cd x=1
+	awk 'quoted text' "$1" awk readonly 'quoted text' test printf
+local then && 'quoted text' /usr/bin x=1
+	$(pwd) done | then printf | local test "$1" cd | export test 'quoted text' | 'quoted text'
+		'quoted text' readonly sed x=1 | export $(pwd) -eu x=1
+	$(pwd) readonly cd -eu "$@" echo
+		"$1" && cd printf readonly x=1 2>/dev/null x=1 -eu -eu echo $(pwd) readonly $(pwd)
+		then echo | grep grep /usr/bin | grep awk x=1
+		| done -eu export done export "$1" sed grep
+	grep "$@" -eu | readonly then readonly 'quoted text' /usr/bin then done
+		"$1" grep awk "$1" cd test readonly "$@" 'quoted text' local
+		$(pwd) then && test /usr/bin "$1" then --verbose
+awk done echo 2>/dev/null
+		export && local awk printf test echo "$@" local
+readonly | && -eu | echo grep | "$1" 2>/dev/null
+${HOME} 'quoted text' $(pwd) test printf -eu "$1" readonly
+		export 'quoted text' awk | x=1 "$@" sed test awk ${HOME} export ${HOME} --verbose
+test --verbose "$1" | x=1 echo | export local
+sed then "$1" readonly
+		'quoted text' then sed sed done local export "$1" && &&
+	done grep /usr/bin then 2>/dev/null | ${HOME} awk sed echo "$1" awk "$@" ${HOME}
+		done -eu then printf done "$@" local then echo -eu && echo
+grep test cd awk | 'quoted text' 2>/dev/null done local --verbose done
+		$(pwd) cd grep test ${HOME} printf /usr/bin then grep local test /usr/bin "$1"
+readonly printf printf cd export 2>/dev/null
+	echo sed export then 2>/dev/null
+&& /usr/bin printf 2>/dev/null
+	then $(pwd) awk sed grep cd test sed x=1
+		| local ${HOME} --verbose test /usr/bin local sed readonly
+		--verbose grep x=1 x=1 printf then -eu /usr/bin 'quoted text' -eu cd echo grep
+--verbose 2>/dev/null "$@" echo cd then ${HOME} x=1 test grep cd "$@" ${HOME} 'quoted text'
+cd echo printf && /usr/bin readonly
+&& done && /usr/bin printf
+test done echo test -eu && 2>/dev/null
+		/usr/bin printf awk export "$1" cd printf done grep | cd local && --verbose
+	2>/dev/null printf x=1 x=1
+		then sed local 'quoted text' local local "$1" done /usr/bin ${HOME}
+		grep && --verbose 'quoted text'
+sed echo $(pwd) "$1" awk &&
+		export && && cd printf test done && "$@" echo done | | $(pwd) /usr/bin
+	export echo readonly grep /usr/bin $(pwd) cd
+cd 'quoted text' --verbose
+		echo "$@" local awk | then
+	test /usr/bin | grep done && printf readonly then "$1" readonly | "$1"
+	cd 'quoted text' | readonly x=1 awk echo 2>/dev/null then echo
+&& printf | test printf -eu && ${HOME} sed && "$1" "$1" && cd readonly
+	printf readonly test 'quoted text' && --verbose
+	"$@" sed && sed grep 2>/dev/null readonly done && printf "$@" ${HOME}
+		&& 2>/dev/null local grep echo local local /usr/bin
+		cd test ${HOME} && "$1" "$1" readonly sed export ${HOME} test local "$@" awk
+		export $(pwd) ${HOME} then ${HOME} test 2>/dev/null
+2>/dev/null 'quoted text' test | grep printf done local
+	-eu -eu 'quoted text' 'quoted text' export then done | -eu
+		sed readonly done "$@" readonly 'quoted text'
+	2>/dev/null /usr/bin ${HOME} 2>/dev/null | sed printf $(pwd) x=1 -eu "$@" readonly
+"$@" done export --verbose /usr/bin
+	&& "$@" grep "$@" "$1" cd export && cd
+	then ${HOME} cd "$1" printf local
+| then readonly cd sed 2>/dev/null && x=1
+/usr/bin "$1" 'quoted text' grep echo "$1" --verbose sed 2>/dev/null awk
+local --verbose x=1 local | then local /usr/bin then | "$1"
+x=1 grep grep grep awk x=1 grep
+${HOME} grep && readonly printf --verbose done grep && 2>/dev/null
+sed printf printf | -eu export printf ${HOME} -eu
+	--verbose grep x=1 | done $(pwd)
+done cd 'quoted text' 2>/dev/null grep x=1 test awk ${HOME} echo
+	then --verbose | printf sed "$1" 2>/dev/null local -eu then grep --verbose export
+	export x=1 -eu grep "$@" then "$1" done
+		echo /usr/bin awk local grep 'quoted text' test cd /usr/bin
+local done $(pwd) "$1" -eu then readonly done readonly
+	printf -eu && printf $(pwd) -eu grep grep 'quoted text'
+	$(pwd) test then x=1 cd ${HOME} "$1" cd "$@" $(pwd) printf printf
+"$1" echo echo awk awk ${HOME} | grep sed --verbose
+		local | && local echo | printf local "$@" readonly
+		test echo x=1 /usr/bin cd $(pwd) -eu readonly readonly readonly --verbose
+		${HOME} "$@" echo && --verbose test x=1 grep local printf $(pwd) /usr/bin
+readonly grep ${HOME} 2>/dev/null local done
+		sed 2>/dev/null 'quoted text' cd ${HOME}
+		local cd then local readonly echo done then $(pwd) 'quoted text'
+	"$1" $(pwd) test -eu then echo x=1 readonly cd test 2>/dev/null /usr/bin
+	--verbose echo -eu x=1 then awk && x=1 -eu then test awk /usr/bin
+	grep test 'quoted text'
+grep then "$1" sed -eu -eu $(pwd) grep cd sed -eu sed grep sed
+	local -eu awk cd "$1" done export /usr/bin test echo grep grep 2>/dev/null
+	'quoted text' | awk "$@"
+		cd --verbose grep export --verbose done /usr/bin 2>/dev/null grep
+	awk "$1" "$@" | export sed
+--verbose echo done | then 'quoted text' awk readonly $(pwd)
+-eu echo x=1 | ${HOME} -eu 2>/dev/null /usr/bin ${HOME} 2>/dev/null echo |
+"$1" readonly export done 2>/dev/null
+		local sed cd done 'quoted text' $(pwd) "$@" local 2>/dev/null -eu
+	$(pwd) done $(pwd) | export x=1 grep printf && awk ${HOME} readonly 2>/dev/null
+| cd then grep awk grep echo 'quoted text' then |
+	/usr/bin grep /usr/bin | x=1
+		"$1" awk $(pwd) 'quoted text' --verbose
+	echo $(pwd) done printf "$@" ${HOME} awk -eu local x=1 done local
+		cd printf sed cd local cd printf 2>/dev/null readonly -eu
+	${HOME} -eu "$@" test export sed 'quoted text' -eu cd printf | sed
+		test then then | local
+	echo | 'quoted text' export -eu ${HOME}
+	echo /usr/bin then "$@" echo
+	"$@" -eu | readonly && ${HOME} then ${HOME} && $(pwd)
+		/usr/bin export echo ${HOME} && "$1" readonly local readonly local
+"$@" export 2>/dev/null $(pwd)
+'quoted text' -eu $(pwd) test -eu /usr/bin grep
+x=1 readonly x=1 readonly --verbose /usr/bin /usr/bin
+	export $(pwd) then export 2>/dev/null
+	${HOME} x=1 grep local awk ${HOME} /usr/bin | grep "$@"
+readonly local readonly printf echo "$1" ${HOME} "$1" && echo readonly
+	grep test then awk -eu then echo $(pwd) 2>/dev/null ${HOME} x=1
+		&& local grep printf && then | readonly cd export test export cd
+"$@" x=1 $(pwd) $(pwd) echo 2>/dev/null then --verbose awk export && $(pwd)
+"$1" readonly echo printf echo local
+printf done "$@" x=1 x=1 $(pwd)
+&& ${HOME} cd done awk && grep test awk -eu "$@"
+	x=1 done /usr/bin sed cd grep x=1 echo && ${HOME} /usr/bin "$@" echo
+		awk 'quoted text' --verbose echo grep 2>/dev/null /usr/bin cd 2>/dev/null x=1 awk
+grep -eu 2>/dev/null && 2>/dev/null ${HOME} cd -eu then local grep printf x=1 |
+	test sed readonly readonly $(pwd) $(pwd) done | awk awk sed /usr/bin x=1 cd
+export 'quoted text' x=1 then awk /usr/bin then awk grep
+	export printf echo done | /usr/bin sed "$1" | printf export 'quoted text'
+		| | && /usr/bin -eu local --verbose
+	then echo then readonly -eu local "$1" --verbose readonly &&
+	cd awk grep printf grep grep
+		"$@" x=1 && "$1" done local done x=1 then sed test printf
+sed readonly done --verbose done cd echo | /usr/bin x=1 2>/dev/null
+	"$1" cd | "$1" cd x=1 --verbose
+		export ${HOME} grep ${HOME} local "$@" $(pwd) awk sed cd "$1" "$@" done 2>/dev/null
+		readonly cd sed then printf export && --verbose echo grep cd && sed
+	--verbose --verbose local echo grep x=1 --verbose printf local
+		grep 2>/dev/null printf x=1 printf ${HOME} $(pwd)
+		echo "$1" ${HOME} x=1 local
+	done "$@" grep test x=1 cd 'quoted text' echo done "$@" $(pwd) test local
+"$@" export $(pwd) export awk "$@" x=1 grep /usr/bin x=1 echo && done -eu
+	then 2>/dev/null grep "$1" && x=1 grep
+export ${HOME} "$1" sed /usr/bin "$@" printf /usr/bin --verbose readonly
+	| local /usr/bin x=1 2>/dev/null ${HOME} export /usr/bin local 'quoted text'
+	sed grep done ${HOME} x=1 && -eu sed
+/usr/bin export sed 2>/dev/null
+/usr/bin cd x=1 readonly
+	readonly x=1 -eu sed test done local ${HOME} x=1
+printf cd -eu awk printf $(pwd) x=1 local /usr/bin readonly 'quoted text'
+grep && x=1 awk grep --verbose -eu grep printf
+	'quoted text' $(pwd) sed sed x=1 test "$@" printf $(pwd)
+/usr/bin test | printf x=1
+&& local awk grep "$1" x=1 done "$@" $(pwd) cd -eu 'quoted text'
+	2>/dev/null cd then local printf $(pwd) 'quoted text' "$1" done "$1"
+	then | cd ${HOME} 'quoted text' ${HOME} -eu then done echo grep
+	/usr/bin -eu x=1 printf grep export
+"$@" | awk then local && --verbose -eu
+export cd --verbose "$1" "$1" --verbose && $(pwd) grep export ${HOME} 'quoted text'
+printf $(pwd) $(pwd) local cd sed "$1" ${HOME}
+$(pwd) then echo | | x=1 -eu 'quoted text' && x=1
+	"$1" awk grep /usr/bin printf grep done /usr/bin /usr/bin -eu 2>/dev/null -eu test
+	grep readonly /usr/bin echo printf --verbose x=1 "$1" 2>/dev/null test "$1"
+	$(pwd) /usr/bin local ${HOME} | sed
+		${HOME} readonly $(pwd) x=1 "$@"
+test printf /usr/bin awk /usr/bin test
+&& ${HOME} grep readonly printf done "$1" ${HOME} sed "$1" 2>/dev/null
+		echo --verbose "$@" -eu test -eu cd $(pwd) readonly /usr/bin echo echo awk --verbose
+grep -eu /usr/bin done test 'quoted text' awk /usr/bin && then export
+$(pwd) awk sed -eu test 'quoted text' done export readonly printf
+	export awk $(pwd) -eu local
+	$(pwd) -eu export done printf cd local /usr/bin awk | --verbose
+/usr/bin $(pwd) grep echo && ${HOME} ${HOME}
+--verbose done then done --verbose
+export 2>/dev/null /usr/bin
+| test local && $(pwd) && done awk test x=1
+	| | x=1 export awk cd /usr/bin readonly $(pwd) /usr/bin
+		'quoted text' local --verbose x=1 test && awk "$@" grep "$1" echo 2>/dev/null
+"$@" 'quoted text' echo readonly
+		${HOME} | | awk then "$@" 'quoted text' echo ${HOME} grep ${HOME}
+	/usr/bin export /usr/bin x=1 test printf --verbose
+		2>/dev/null printf | sed 'quoted text' grep 'quoted text' printf
+	readonly --verbose -eu $(pwd) awk /usr/bin test printf
+	&& done -eu printf $(pwd) -eu ${HOME} 'quoted text'
+echo "$1" local 2>/dev/null "$@" cd --verbose -eu cd grep /usr/bin sed
+	sed grep grep 'quoted text' printf awk
+	printf "$1" then printf echo x=1 'quoted text' cd sed "$@" echo
+		export | 'quoted text' 2>/dev/null -eu printf done 'quoted text' sed printf
+		then -eu --verbose readonly x=1 | | "$@" grep "$1" 2>/dev/null test $(pwd)
+		"$@" --verbose readonly grep 2>/dev/null cd cd sed 'quoted text' done readonly
+test "$@" | test sed -eu 'quoted text' echo 'quoted text' | sed $(pwd)
+printf "$1" && && --verbose cd "$@" cd export
+"$1" $(pwd) local | printf -eu cd grep ${HOME} /usr/bin local readonly 'quoted text'
+	--verbose cd --verbose export done test grep "$1" done local grep
+	&& -eu -eu -eu --verbose "$1" grep x=1 local
+		| $(pwd) ${HOME} awk test "$@"
+| printf 2>/dev/null --verbose ${HOME} awk -eu awk 2>/dev/null --verbose then
+x=1 echo | export -eu echo /usr/bin && | printf
+		| ${HOME} "$@" sed x=1 | "$1" $(pwd) readonly grep readonly
+printf test done | done --verbose $(pwd) | /usr/bin $(pwd) cd local "$@"
+x=1 echo 'quoted text' readonly "$@" readonly
+	readonly /usr/bin sed | ${HOME} ${HOME}
+	done grep -eu done test sed 2>/dev/null
+		--verbose export then sed ${HOME} then done --verbose awk "$1" x=1 2>/dev/null
+	cd sed "$@" -eu --verbose "$@" then
+test /usr/bin ${HOME} /usr/bin readonly x=1 "$@" echo cd | -eu readonly
+	/usr/bin cd "$1" && awk test readonly 'quoted text' | 'quoted text'
+	cd export printf test 2>/dev/null
+--verbose grep $(pwd) --verbose
+local awk --verbose then local local export local "$@" x=1
+	echo cd 2>/dev/null cd echo readonly then -eu cd $(pwd) && cd local x=1
+		test $(pwd) && --verbose | $(pwd) readonly local then
+test printf ${HOME} done x=1 awk sed sed -eu |
+"$@" 'quoted text' done
+		&& 2>/dev/null printf "$@" && cd printf
+"$1" ${HOME} "$1" 2>/dev/null
+		done readonly done export "$@" "$1"
+test export echo local awk readonly export
+		"$1" printf export test --verbose sed $(pwd) 2>/dev/null $(pwd) cd x=1 echo export
+	${HOME} "$1" | 2>/dev/null grep /usr/bin
+		&& cd then test sed 2>/dev/null | export then ${HOME}
+	done sed ${HOME} "$1" export
+	grep "$1" printf test "$@" -eu x=1 --verbose
+		local --verbose readonly $(pwd) then
+	grep echo awk /usr/bin --verbose export ${HOME} echo
+	&& "$@" then | awk printf awk && "$1" 2>/dev/null
+	awk echo sed cd x=1 sed grep cd -eu awk readonly sed "$@" "$1" ${HOME} --verbose
+&& "$1" test "$1" cd --verbose x=1 /usr/bin printf ${HOME}
+	&& awk ${HOME} x=1 echo && 'quoted text' awk "$@" grep echo 'quoted text'
+	echo --verbose "$@" 2>/dev/null test "$@" printf && then "$1"
+		done 'quoted text' --verbose $(pwd) | /usr/bin ${HOME} readonly "$@" "$@"
+readonly 'quoted text' | ${HOME} ${HOME}
+printf echo ${HOME} export echo done | $(pwd) then local local
+-eu "$@" sed "$1" done /usr/bin readonly "$@" export readonly
+/usr/bin awk grep local "$1" /usr/bin ${HOME}
+awk then --verbose "$@" sed awk -eu export
+	--verbose grep awk printf readonly x=1 echo -eu $(pwd) grep sed
+"$1" $(pwd) 'quoted text'
+cd $(pwd) echo "$1" -eu then printf --verbose
+cd -eu $(pwd) | then cd echo && local readonly 2>/dev/null
+awk done export -eu cd --verbose | printf /usr/bin
+cd --verbose ${HOME} -eu cd
+-eu local printf done $(pwd) awk /usr/bin then
+		cd $(pwd) awk ${HOME} export test echo |
+		x=1 $(pwd) cd local 2>/dev/null printf
+		"$1" ${HOME} readonly ${HOME} /usr/bin cd $(pwd) "$@" --verbose
+	'quoted text' "$1" local /usr/bin readonly
+printf grep cd ${HOME} printf cd grep cd ${HOME} /usr/bin -eu cd done then /usr/bin
+		/usr/bin local | printf printf sed awk local test local "$1" | local test
+	awk readonly local awk done ${HOME} "$1" grep test cd done
+${HOME} readonly "$1" ${HOME} ${HOME} | "$1" printf "$1" then $(pwd)
+	readonly -eu then done -eu | 2>/dev/null readonly awk
+'quoted text' "$@" echo 'quoted text'
+	"$1" /usr/bin $(pwd) export | export grep awk x=1 ${HOME} sed
+	"$1" 'quoted text' $(pwd) 2>/dev/null -eu --verbose
+	test sed cd && -eu awk sed then cd $(pwd) | awk
+		"$1" "$@" test ${HOME} sed grep "$1" export grep 'quoted text'
+cd cd ${HOME} readonly readonly grep | test done | -eu "$1" /usr/bin export
+grep sed && ${HOME} x=1 x=1 sed then x=1 test 2>/dev/null then test x=1 'quoted text'
+		local echo && cd sed /usr/bin printf $(pwd) | then grep -eu readonly
+2>/dev/null cd then x=1 test export
+		grep -eu "$1" ${HOME} 'quoted text'
+		| done printf "$1" then | echo && awk awk cd printf echo
+	readonly x=1 cd export /usr/bin "$1" /usr/bin cd sed awk
+x=1 grep then ${HOME} "$1" readonly export --verbose
+cd readonly local -eu "$@" "$@" ${HOME} grep export /usr/bin && readonly awk export
+done readonly sed x=1 "$1"
+	--verbose 2>/dev/null -eu $(pwd) readonly grep ${HOME} --verbose cd
+		x=1 printf 2>/dev/null /usr/bin 'quoted text' -eu awk "$@" x=1 -eu grep "$1"
+		| sed x=1 cd local -eu readonly
+readonly /usr/bin cd
+test $(pwd) grep cd 2>/dev/null ${HOME}
+	printf && local x=1 awk "$@" printf then 'quoted text' local local
+		echo local && /usr/bin x=1
+	export "$@" test local then | ${HOME} ${HOME} done then
+	x=1 "$1" echo "$@" x=1 awk local printf --verbose
+		-eu local awk x=1 x=1 awk $(pwd) "$@" then awk 2>/dev/null
+"$@" done cd then "$1" 2>/dev/null -eu local grep
+	| | then echo --verbose test ${HOME} $(pwd)
+		awk x=1 | --verbose --verbose x=1 done --verbose x=1 echo export awk
+	/usr/bin done "$1" awk -eu local export ${HOME} --verbose x=1 $(pwd)
+'quoted text' --verbose test then test export cd sed test local x=1 "$@"
+		$(pwd) /usr/bin $(pwd) echo test readonly "$@" | "$@" $(pwd) grep test
+	"$1" | x=1 done | printf echo then --verbose printf local
+readonly "$@" grep awk then export
+		readonly 2>/dev/null test test "$1" local awk ${HOME} x=1
+	done -eu local 2>/dev/null && test
+		/usr/bin cd then sed awk done local | "$1" echo then cd readonly 2>/dev/null
+	awk "$1" /usr/bin echo printf export readonly
+		printf 2>/dev/null cd ${HOME} | export printf x=1 && echo /usr/bin
+		printf cd "$1" cd --verbose /usr/bin "$1" printf sed
+		2>/dev/null "$1" 'quoted text' 'quoted text'
+export /usr/bin ${HOME} cd local $(pwd)
+		'quoted text' --verbose awk /usr/bin --verbose export awk x=1 'quoted text'
+		| x=1 /usr/bin sed printf 2>/dev/null x=1 readonly local
+	export then grep echo &&
+	"$1" 'quoted text' -eu cd && local $(pwd) grep 'quoted text'
+	export done -eu test export && grep 'quoted text' test "$@"
+	test -eu 'quoted text'
+| ${HOME} -eu /usr/bin export export /usr/bin
+awk readonly printf grep sed local sed -eu echo printf $(pwd) grep
+		cd 'quoted text' awk "$1" echo echo 2>/dev/null export awk ${HOME} "$@" 'quoted text'
+echo 'quoted text' && cd "$@" --verbose -eu "$@" "$1" readonly ${HOME} x=1
+		local --verbose grep 2>/dev/null export 2>/dev/null "$@" && printf
+	sed sed "$1" x=1 printf printf export
+	| then && echo sed 2>/dev/null then sed 'quoted text' 'quoted text'
+		awk -eu --verbose -eu ${HOME} 2>/dev/null x=1 /usr/bin -eu export "$@" awk
+	readonly | local | sed --verbose local 'quoted text' /usr/bin sed sed
+		export export export grep test && then x=1 export then "$1"
+		awk sed /usr/bin 'quoted text' echo $(pwd) sed then
+readonly echo 2>/dev/null local x=1 test then
+	${HOME} sed printf --verbose done then "$@" 2>/dev/null
+	-eu sed printf "$1" 'quoted text' test 2>/dev/null
+	cd grep x=1 "$1" -eu grep readonly x=1 $(pwd) "$@" local awk "$@"
+local "$1" echo $(pwd)
+	x=1 printf awk done test sed -eu 'quoted text'
+		'quoted text' then then test then /usr/bin -eu "$1"
+		${HOME} printf readonly 2>/dev/null
+	cd readonly test cd /usr/bin done export sed local readonly -eu
+		x=1 sed echo && 'quoted text' readonly
+"$@" && "$@" sed printf | | "$@" /usr/bin --verbose printf sed --verbose "$1"
+		readonly /usr/bin 2>/dev/null grep 2>/dev/null ${HOME} echo
+	${HOME} grep --verbose
+	export "$1" local export cd -eu echo echo
+local export export readonly sed 'quoted text' awk local cd sed echo export
+	test 'quoted text' x=1 --verbose cd printf export | "$1" grep 2>/dev/null "$@" readonly
+		export cd && | 2>/dev/null then export local 'quoted text'
+done sed && "$@" export printf 'quoted text' grep 2>/dev/null ${HOME} test $(pwd)
+printf -eu | readonly --verbose export
+		&& printf printf -eu "$@" awk ${HOME} local printf x=1 && $(pwd) done &&
+	sed echo | $(pwd) export cd printf readonly
+		| test awk "$1" echo "$@" && cd local /usr/bin awk readonly done $(pwd) sed local
+		--verbose sed && readonly export done && --verbose cd export
+	done sed && "$@" then awk $(pwd) grep && test then
+-eu 'quoted text' awk echo ${HOME} "$@" test test --verbose && x=1 cd awk
+		| 2>/dev/null echo x=1
+"$@" x=1 "$@" test 'quoted text' export && | grep readonly done readonly printf
+	export "$@" awk local export printf && export awk ${HOME}
+	grep "$1" "$1" 2>/dev/null 2>/dev/null cd local export
+		awk test 2>/dev/null --verbose sed --verbose
+	$(pwd) local test --verbose "$@" local grep local -eu local done awk
+	local test x=1 printf then x=1 grep
+	done | ${HOME} "$1" 2>/dev/null cd x=1 echo /usr/bin awk done sed ${HOME}
+grep test --verbose -eu grep -eu done /usr/bin 2>/dev/null echo
+		${HOME} awk "$1" cd $(pwd) local ${HOME} $(pwd) /usr/bin |
+		local echo 'quoted text' 2>/dev/null
+	"$1" && -eu $(pwd) x=1 x=1 grep cd local local && sed done echo grep cd cd sed
+then printf grep && test awk test printf sed then
+	local grep ${HOME} ${HOME}
+	readonly then 2>/dev/null readonly --verbose
+		"$1" $(pwd) /usr/bin then export local readonly ${HOME}
+	readonly readonly /usr/bin local sed printf local export && $(pwd) 2>/dev/null
+/usr/bin test printf "$1" -eu "$1" printf test then export ${HOME}
+"$1" awk done 2>/dev/null ${HOME} awk done local done "$1" test
+		printf 'quoted text' "$1" printf
+		grep 2>/dev/null sed grep local 2>/dev/null
+printf ${HOME} /usr/bin readonly --verbose readonly
+		export printf cd $(pwd) && | "$@" --verbose
+local export ${HOME} grep && awk -eu x=1 awk 2>/dev/null "$1" cd && printf 'quoted text'
+		| -eu cd cd x=1 $(pwd) | readonly
+-eu -eu --verbose grep && --verbose cd -eu && grep ${HOME} done done test then
+local printf | awk test | awk
+		export cd "$@" ${HOME} /usr/bin cd "$@" local -eu export readonly
+awk sed grep cd cd local && awk /usr/bin /usr/bin cd grep test /usr/bin
+	cd echo grep export test -eu "$@" readonly /usr/bin awk sed echo 2>/dev/null test
+done -eu "$1" cd cd sed export ${HOME} grep readonly
+	local readonly export test printf echo "$1" printf echo awk
+readonly $(pwd) && sed readonly awk ${HOME} printf printf cd 2>/dev/null
+done && local "$1" readonly /usr/bin $(pwd)
+	local x=1 ${HOME} grep
+	done printf grep echo echo && awk local 2>/dev/null local echo x=1 then -eu
+		&& grep then cd test --verbose /usr/bin
+"$@" $(pwd) local /usr/bin $(pwd) local && export
+--verbose done 'quoted text' ${HOME} readonly test
+2>/dev/null "$@" echo cd grep grep && "$@" "$1" x=1
+	grep $(pwd) /usr/bin ${HOME} grep readonly /usr/bin local local
+	sed "$1" grep local then grep
+$(pwd) 'quoted text' sed
+printf 2>/dev/null readonly -eu cd "$1" $(pwd) grep grep -eu x=1
+'quoted text' readonly
+		--verbose --verbose grep --verbose | "$@" cd export | --verbose
+	local local export 'quoted text' printf readonly export -eu local
+		then 'quoted text' readonly echo test --verbose done && then x=1 | && "$@" ${HOME}
+	"$1" 2>/dev/null readonly 2>/dev/null $(pwd) then && then -eu /usr/bin x=1 -eu
+		| sed $(pwd) awk readonly export export && local && /usr/bin done grep printf sed
+		| awk echo 2>/dev/null readonly sed awk 'quoted text'
+x=1 | && then | -eu x=1 readonly sed grep -eu "$1" x=1 then /usr/bin
+-eu printf 2>/dev/null | then | $(pwd) -eu echo --verbose done --verbose echo
+		echo sed "$@" && then ${HOME} "$1"
+		${HOME} cd && /usr/bin test 2>/dev/null
+awk ${HOME} sed $(pwd) && sed test sed done sed readonly
+		x=1 "$1" | /usr/bin --verbose printf export ${HOME} readonly readonly cd
+test --verbose echo done grep /usr/bin export ${HOME} grep awk
+export cd echo awk awk awk readonly
+	done test $(pwd) /usr/bin "$1" then "$1" done awk 2>/dev/null printf
+	-eu 2>/dev/null readonly /usr/bin test x=1 'quoted text' local test printf
+	$(pwd) done && done test ${HOME} ${HOME} "$1" echo then 'quoted text'
+echo echo && done --verbose awk echo $(pwd) /usr/bin 'quoted text'
+	then "$1" awk -eu local readonly x=1 && awk $(pwd) $(pwd) && then
+	'quoted text' --verbose done 'quoted text'
+x=1 "$@" then --verbose
+		echo "$1" export | /usr/bin test test
+	awk sed 2>/dev/null --verbose export -eu echo
+		printf done 2>/dev/null printf $(pwd) readonly
+		x=1 echo --verbose && -eu sed then test /usr/bin
+then printf echo local local then /usr/bin
+done sed grep readonly
+	${HOME} --verbose cd &&
+2>/dev/null awk | readonly grep
+	sed sed --verbose grep /usr/bin "$@" "$@" test x=1 sed sed && cd x=1 /usr/bin
+$(pwd) x=1 readonly && then echo 'quoted text' readonly | | done --verbose ${HOME}
+		"$1" echo && cd done $(pwd) x=1 | 'quoted text' --verbose $(pwd)
+		-eu "$1" && /usr/bin
+cd -eu export --verbose | "$1" done export ${HOME} printf "$@" 2>/dev/null
+		${HOME} local ${HOME} echo done "$1" --verbose
+	local $(pwd) x=1 "$1" then "$@" x=1 grep cd readonly sed readonly
+		export && --verbose "$1" printf 'quoted text'
+	'quoted text' ${HOME} | echo cd && 'quoted text' /usr/bin "$@"
+printf x=1 test echo then | 2>/dev/null "$@"
+awk $(pwd) done echo echo grep && 2>/dev/null test cd
+		sed "$@" -eu sed | test test readonly done readonly grep printf 2>/dev/null
+		cd --verbose export x=1 test --verbose "$1"
+done --verbose printf 'quoted text' "$@" "$1" grep && printf -eu grep
+	-eu 'quoted text' -eu | printf then x=1 cd /usr/bin /usr/bin
+	printf then cd "$1" printf ${HOME} grep local cd cd grep --verbose -eu --verbose
+		done | done | done then && done then echo && readonly
+	-eu --verbose ${HOME} 2>/dev/null -eu
+	readonly then -eu | done | readonly local -eu cd /usr/bin
+/usr/bin ${HOME} readonly "$@" export
+/usr/bin done "$1" 2>/dev/null
+		sed | 'quoted text' printf awk 2>/dev/null --verbose sed | awk echo done
+--verbose grep | awk done "$@" -eu echo awk export export grep done then cd
+awk --verbose x=1 x=1 2>/dev/null echo
+		done "$1" x=1 grep "$@" readonly $(pwd) -eu done readonly readonly
+	x=1 && readonly 2>/dev/null && readonly /usr/bin test cd local grep
+		-eu $(pwd) ${HOME} awk sed export
+	echo done && x=1 | test $(pwd) cd then --verbose /usr/bin
+	echo sed done 'quoted text' readonly readonly echo echo readonly
+"$1" readonly local x=1 awk grep sed "$1" ${HOME} $(pwd)
+	| printf echo --verbose export ${HOME} printf -eu
+	"$1" 'quoted text' $(pwd) printf ${HOME} 2>/dev/null 2>/dev/null "$@" --verbose
+/usr/bin cd then grep then "$@" readonly -eu
+cd done 2>/dev/null awk 'quoted text' ${HOME} -eu readonly cd echo "$1" grep
+cd cd $(pwd) local /usr/bin export $(pwd)
+	&& printf then x=1 cd --verbose
+&& 2>/dev/null cd $(pwd) test && "$@" "$@" printf && | test
+	${HOME} echo test -eu printf echo
+		readonly | grep 'quoted text' awk sed
+'quoted text' export export x=1 echo --verbose 2>/dev/null
+"$@" /usr/bin export local $(pwd) cd
+	&& "$1" $(pwd) "$1" ${HOME} 'quoted text' $(pwd) sed grep /usr/bin | 'quoted text'
+	done done sed cd | "$1" printf export "$1" && done
+	"$@" "$@" -eu awk ${HOME} /usr/bin printf
+'quoted text' "$1" echo printf /usr/bin then $(pwd) readonly --verbose
+		-eu 2>/dev/null "$1" "$@" 2>/dev/null done "$@" test
+	cd /usr/bin "$@" x=1 done -eu cd awk "$1" /usr/bin ${HOME} 'quoted text'
+readonly 'quoted text' --verbose then echo
+		"$1" done local readonly printf "$@" --verbose ${HOME} printf -eu cd | local cd
+		$(pwd) test done && sed | awk local
+	/usr/bin local ${HOME} | 'quoted text' 2>/dev/null readonly 2>/dev/null grep
+		-eu && && sed done export x=1 | readonly /usr/bin | -eu done
+		sed 'quoted text' /usr/bin readonly sed echo -eu -eu /usr/bin
+x=1 awk sed /usr/bin --verbose 2>/dev/null sed x=1 'quoted text'
+	cd local $(pwd) 2>/dev/null "$1"
+	test 'quoted text' $(pwd) "$1" sed printf done local readonly done
+printf && sed $(pwd) printf "$1" grep -eu awk export grep
+		done local then /usr/bin ${HOME} cd 2>/dev/null export echo 'quoted text'
+		-eu -eu "$1" /usr/bin grep grep readonly
+		"$@" x=1 --verbose | --verbose then "$@" $(pwd) -eu | export
+/usr/bin export /usr/bin done | --verbose "$@" printf --verbose
+		awk x=1 2>/dev/null "$1" echo "$@" "$@" 2>/dev/null 'quoted text'
+		"$@" 'quoted text' echo sed
+	x=1 test ${HOME} echo 2>/dev/null -eu echo 'quoted text' export test awk local
+	x=1 export then "$1" 'quoted text' export local sed done /usr/bin awk awk
+then /usr/bin "$1" readonly test sed | | test /usr/bin && then && 'quoted text'
+-eu ${HOME} export /usr/bin
+		grep x=1 then done 'quoted text' printf done "$1" printf
+		/usr/bin echo x=1 then -eu "$@" echo local "$1" -eu awk
+readonly "$1" | then x=1 --verbose "$1"
+		grep local export "$1" test printf
+	printf grep cd -eu ${HOME} -eu ${HOME} "$@" sed $(pwd)
+	export echo done /usr/bin export 2>/dev/null "$1"
+	then local /usr/bin --verbose &&
+		/usr/bin awk x=1 echo readonly cd export done "$1" local --verbose sed echo 'quoted text'
+		&& cd $(pwd) sed -eu grep cd
+	printf then awk 2>/dev/null grep --verbose "$@" readonly
+"$1" 'quoted text' done 'quoted text' | --verbose $(pwd)
+-eu done readonly "$1" echo
+		| export echo export 'quoted text' && echo
+	awk -eu then printf echo --verbose | awk | "$1" -eu readonly 'quoted text'
+		-eu 'quoted text' printf echo awk printf /usr/bin 'quoted text' then printf printf
+cd x=1 /usr/bin "$1" -eu readonly $(pwd) sed readonly 'quoted text' | local grep
+"$1" test cd then && && test test cd test cd local local local --verbose test
+	2>/dev/null cd cd cd ${HOME} --verbose printf sed printf $(pwd) echo -eu grep
+x=1 "$1" echo --verbose grep ${HOME} echo 'quoted text'
+${HOME} test 'quoted text' grep 'quoted text' export cd export
+	"$1" --verbose x=1 && -eu
+x=1 "$@" echo -eu sed /usr/bin
+		"$1" ${HOME} then "$@" 2>/dev/null awk 2>/dev/null grep "$@" export $(pwd) readonly
+--verbose "$@" sed -eu local
+		grep /usr/bin /usr/bin $(pwd) 'quoted text'
+		${HOME} done done echo printf local $(pwd) readonly
+test 'quoted text' readonly sed readonly -eu awk printf 'quoted text' -eu readonly
+		printf then export && && then ${HOME} ${HOME} local
+cd done printf cd /usr/bin --verbose local "$1" local
+$(pwd) "$1" "$1" local 'quoted text' export export 'quoted text'
+		&& 2>/dev/null printf ${HOME} cd -eu sed awk grep local 2>/dev/null
+	cd 2>/dev/null --verbose
+	-eu cd ${HOME} readonly done ${HOME} $(pwd)
+	"$1" grep echo /usr/bin && awk test
+test /usr/bin grep export 2>/dev/null
+		cd done "$@" done readonly "$@" "$1"
+awk cd | awk readonly sed awk -eu local | --verbose done printf 'quoted text'
+		export readonly "$@" awk 'quoted text' echo x=1
+	2>/dev/null /usr/bin 2>/dev/null awk then test -eu printf && export
+		cd && -eu "$1" | sed grep x=1 "$@" export /usr/bin ${HOME} export
+	&& 2>/dev/null x=1 local 2>/dev/null | local "$1"
+	"$1" -eu x=1 | | test awk x=1 2>/dev/null
+cd 2>/dev/null export ${HOME} grep | 'quoted text' /usr/bin "$@" ${HOME}
+/usr/bin 2>/dev/null $(pwd) -eu "$1" "$@"
+then then --verbose awk "$1" 'quoted text' /usr/bin $(pwd) --verbose 2>/dev/null
+	readonly /usr/bin -eu then
+	${HOME} grep export grep readonly local export local local done sed $(pwd) done
+	-eu "$@" done "$1" grep
+		x=1 grep readonly "$1" sed echo
+done && then 2>/dev/null ${HOME} cd -eu readonly &&
+		local readonly readonly 2>/dev/null && readonly 'quoted text' printf
+| 2>/dev/null $(pwd) ${HOME} && x=1 export
+	'quoted text' echo 2>/dev/null
+local grep 'quoted text' ${HOME} export
+	$(pwd) | && then test local
+	test 'quoted text' x=1 'quoted text'
+--verbose -eu grep printf cd $(pwd) awk 'quoted text' grep
+	grep "$1" -eu $(pwd) --verbose /usr/bin cd x=1 test test readonly readonly
+		readonly done readonly ${HOME} -eu
+	then test grep export "$@" 2>/dev/null cd readonly
+		sed 2>/dev/null printf readonly -eu /usr/bin
+	test "$1" done printf "$@" "$1" --verbose --verbose sed grep
+		readonly cd printf export grep $(pwd) echo $(pwd) -eu 'quoted text' echo -eu /usr/bin
+		$(pwd) done cd awk 'quoted text' | sed 'quoted text' /usr/bin grep cd ${HOME}
+	--verbose ${HOME} export | /usr/bin
+		&& then sed readonly | 'quoted text' -eu /usr/bin /usr/bin
+	awk local /usr/bin cd done
+echo readonly local "$1" $(pwd) x=1 echo export
+$(pwd) "$@" "$1" ${HOME} 2>/dev/null
+	echo --verbose done $(pwd) echo --verbose test --verbose
+		${HOME} export ${HOME} "$1" ${HOME} ${HOME}
+"$1" | 2>/dev/null readonly 'quoted text' local readonly readonly then then -eu
+| --verbose done $(pwd) sed sed done echo printf --verbose then sed x=1 done awk
+		&& x=1 --verbose printf local --verbose 2>/dev/null && awk -eu
+	/usr/bin /usr/bin && readonly
+	local ${HOME} -eu local echo 'quoted text'
+		awk readonly "$@" --verbose
+		--verbose "$@" then "$@" test 2>/dev/null done ${HOME} grep
+	'quoted text' ${HOME} readonly /usr/bin 2>/dev/null $(pwd) $(pwd) test 2>/dev/null
+		"$@" then 'quoted text'
+		export 2>/dev/null readonly test echo sed ${HOME} awk then
+| --verbose x=1 sed "$@" 2>/dev/null
+	awk "$1" done test "$1" done $(pwd) export printf echo
+	'quoted text' /usr/bin 2>/dev/null x=1 "$1" done "$@" | --verbose sed
+		--verbose printf "$@" -eu awk -eu --verbose ${HOME} echo
+	--verbose test 2>/dev/null cd then --verbose grep readonly
+		local done | local 2>/dev/null done 'quoted text' test 2>/dev/null echo echo 'quoted text'
+		printf then $(pwd) readonly "$@" grep
+grep cd echo x=1 echo --verbose cd | | printf "$@" local test export
+/usr/bin 'quoted text'
+		$(pwd) local grep local cd grep readonly export "$@" | readonly 'quoted text'
+	-eu --verbose cd done 2>/dev/null test done 2>/dev/null local && done "$@"
+	--verbose export done ${HOME} test 2>/dev/null x=1
+		${HOME} export x=1 "$1" sed x=1 /usr/bin printf
+		grep cd | 'quoted text' && awk awk awk --verbose
+	echo ${HOME} cd echo 2>/dev/null readonly
+	| /usr/bin x=1 grep echo "$@" "$1" then && export test | | awk 'quoted text'
+		$(pwd) "$@" x=1 readonly "$1" sed then sed && awk sed
+x=1 readonly | && echo /usr/bin --verbose ${HOME} -eu "$1"
+		x=1 readonly readonly done -eu
+	done --verbose x=1 2>/dev/null /usr/bin ${HOME} awk ${HOME}
+		2>/dev/null printf --verbose /usr/bin 'quoted text'
+		local x=1 grep | /usr/bin
+awk --verbose x=1 $(pwd)
+	grep --verbose then x=1 /usr/bin && awk cd
+	2>/dev/null then --verbose && readonly | sed | $(pwd) local "$1" && --verbose
+2>/dev/null x=1 local 'quoted text'
+		${HOME} grep -eu "$@" -eu echo awk 2>/dev/null | ${HOME}
+| grep x=1 awk cd cd test then /usr/bin awk readonly printf
+	x=1 test local then local --verbose awk export x=1 | $(pwd) sed local 'quoted text'
+	done sed grep done echo
+		| then "$@" done test --verbose local test 'quoted text'
+	readonly then echo done 'quoted text' -eu then | |
+	awk awk "$1" then echo awk "$@" test sed
+		awk -eu grep printf printf ${HOME} cd "$1" local x=1 done done readonly
+	sed local cd export $(pwd) ${HOME} 'quoted text' /usr/bin
+		printf 'quoted text' grep /usr/bin &&
+echo awk grep "$1" then -eu --verbose -eu then cd && export
+		/usr/bin test -eu ${HOME} -eu && test
+		done grep && --verbose $(pwd) test readonly $(pwd) | local --verbose
+awk "$@" echo && ${HOME} awk done
+		"$1" awk 'quoted text' ${HOME} sed cd | ${HOME} && 2>/dev/null
+		--verbose x=1 "$1" printf "$@" /usr/bin then | ${HOME} readonly cd /usr/bin x=1
+		echo echo -eu awk done then "$1" | $(pwd) 2>/dev/null --verbose ${HOME}
+--verbose $(pwd) 'quoted text'
+	sed test readonly awk awk | 2>/dev/null "$1"
+	"$1" echo export | test -eu local
+	done local then | $(pwd) cd |
+done awk local export $(pwd)
+"$1" x=1 --verbose echo 2>/dev/null awk $(pwd) local --verbose
+	x=1 --verbose ${HOME} | cd $(pwd) test && "$@" grep
+2>/dev/null $(pwd) && done awk ${HOME}
+	local -eu test test 'quoted text' readonly && /usr/bin printf "$@" | awk "$@"
+		/usr/bin $(pwd) printf local 2>/dev/null test echo grep grep 2>/dev/null
+		"$1" then readonly grep done
+		x=1 done export awk 'quoted text' --verbose x=1 then
+	printf | sed cd printf
+cd echo ${HOME} done 'quoted text'
+		grep --verbose readonly readonly readonly export echo sed then x=1 |
+	2>/dev/null "$1" x=1
+cd "$@" 'quoted text' echo test
+	-eu printf test printf -eu done | export
+2>/dev/null sed $(pwd) $(pwd) then /usr/bin local export readonly $(pwd) "$1" cd
+	echo /usr/bin --verbose "$@"
+2>/dev/null local local
+done grep -eu $(pwd) && "$1" echo -eu -eu --verbose test --verbose $(pwd) | then
+test $(pwd) x=1 -eu ${HOME} ${HOME} cd local 2>/dev/null
+		awk && export ${HOME} x=1 cd 2>/dev/null cd $(pwd) 'quoted text'
+		2>/dev/null "$@" echo 'quoted text' awk x=1
+--verbose awk | && $(pwd) then | x=1 "$@"
+	sed $(pwd) cd "$@" test local "$1" 2>/dev/null echo ${HOME}
+		printf cd -eu test "$1"
+		cd ${HOME} "$1" $(pwd) echo ${HOME} /usr/bin test echo awk
+	export readonly x=1 -eu awk export echo done /usr/bin
+		done done 2>/dev/null 'quoted text' then 'quoted text' awk cd echo --verbose
+	2>/dev/null sed then /usr/bin printf export echo 'quoted text' sed local local
+		cd ${HOME} sed 'quoted text' export 'quoted text' "$1" done test
+	local then 'quoted text' done echo local printf
+		$(pwd) done grep x=1 local readonly x=1 then
+		/usr/bin /usr/bin readonly
+&& "$1" done && sed -eu
+		x=1 2>/dev/null sed echo echo then && "$1"
+	-eu 2>/dev/null done sed grep test x=1 x=1 'quoted text' x=1 && 'quoted text'
+		"$1" 'quoted text' "$@" -eu test x=1 x=1 printf done echo -eu && -eu -eu printf
+		then --verbose --verbose /usr/bin done readonly grep done $(pwd) && $(pwd)
+	readonly grep readonly --verbose 'quoted text' echo | "$@" readonly grep
+&& /usr/bin readonly printf echo
+x=1 then $(pwd) 'quoted text' $(pwd) then | test
+		x=1 -eu x=1 cd export --verbose 'quoted text' local "$@" &&
+test | grep -eu "$@" echo $(pwd) | export
+		"$1" x=1 'quoted text' "$1" && | readonly cd readonly |
+		2>/dev/null test $(pwd) "$1" test ${HOME}
+	grep grep printf | awk cd && x=1 echo && 2>/dev/null grep sed readonly
+${HOME} local printf test ${HOME} export then 2>/dev/null
+	readonly 'quoted text' local
+		x=1 -eu grep echo awk 2>/dev/null
+export "$1" "$1" awk cd "$@" local | "$@" done grep ${HOME}
+	readonly "$1" 2>/dev/null local "$1" 'quoted text' "$1" /usr/bin
+	printf -eu local /usr/bin && /usr/bin grep test $(pwd) | 2>/dev/null
+		'quoted text' | ${HOME} --verbose readonly then --verbose $(pwd) sed test
+	printf grep 2>/dev/null | sed printf "$1" grep -eu | x=1 test
+grep echo ${HOME} cd 2>/dev/null -eu --verbose then && x=1 printf readonly test
+	echo export readonly /usr/bin then x=1 ${HOME} x=1 export
+test $(pwd) then grep --verbose $(pwd) done ${HOME} /usr/bin
+	--verbose cd readonly ${HOME} --verbose
+echo echo printf && $(pwd) "$1" cd done cd 2>/dev/null export export -eu done
+	-eu 2>/dev/null $(pwd) cd
+	${HOME} "$@" -eu awk $(pwd) 2>/dev/null --verbose test done
+	| printf --verbose -eu && readonly -eu "$1" "$1" 2>/dev/null sed test awk test
+local x=1 x=1 sed local readonly | $(pwd) local --verbose $(pwd) x=1 "$1"
+echo readonly && done x=1 test cd && 'quoted text'
+		${HOME} echo test "$1" printf ${HOME}
+		--verbose then -eu then $(pwd) grep readonly 'quoted text'
+| echo && --verbose done sed grep --verbose echo cd && | x=1 'quoted text' printf
+		then 'quoted text' && local |
+		"$1" local -eu "$1" sed /usr/bin
+	-eu "$@" 2>/dev/null /usr/bin
+grep local grep --verbose ${HOME} local echo "$@" then
+	then echo awk ${HOME} test sed
+		--verbose done echo 'quoted text' printf grep sed then --verbose
+${HOME} "$@" awk readonly then "$1" done then $(pwd) 'quoted text' --verbose done
+	done readonly export test $(pwd) grep grep done echo then then
+	| cd --verbose done "$@" cd $(pwd) ${HOME} -eu 'quoted text' --verbose
+	echo printf -eu && $(pwd) x=1 --verbose 'quoted text' local printf local
+		${HOME} "$1" | ${HOME} 2>/dev/null
+cd then --verbose local "$@" ${HOME} then grep then --verbose
+	${HOME} && test test /usr/bin then ${HOME} grep sed
+x=1 /usr/bin 'quoted text' $(pwd) 'quoted text' && sed
+	${HOME} sed x=1 then "$@"
+	'quoted text' --verbose | printf echo -eu done $(pwd) x=1 cd ${HOME}
+	then grep printf ${HOME}
+	sed grep -eu $(pwd) cd export ${HOME} && --verbose done x=1 readonly
+	$(pwd) export "$1" 2>/dev/null grep "$1" done printf
+-eu export ${HOME} "$@"
+	readonly --verbose awk printf /usr/bin
+printf && done /usr/bin && done $(pwd) awk 2>/dev/null -eu grep then "$@"
+	-eu -eu "$@" x=1 printf printf echo $(pwd) &&
+grep awk test --verbose sed -eu echo 2>/dev/null sed | x=1
+		export grep local then export awk grep cd "$@" cd awk 'quoted text' done then
+		x=1 export x=1 2>/dev/null grep 'quoted text' readonly readonly
+		cd /usr/bin local echo "$1" -eu 'quoted text' && export 2>/dev/null
+		awk then 2>/dev/null local --verbose sed "$@" "$@" grep
+$(pwd) local && grep -eu
+	x=1 -eu x=1 awk then echo ${HOME} ${HOME} then
+${HOME} sed $(pwd) x=1 printf $(pwd) $(pwd) readonly grep test /usr/bin
+"$1" printf 'quoted text' grep $(pwd) echo
+-eu x=1 --verbose echo
+awk cd 2>/dev/null printf x=1 awk "$@" ${HOME} cd "$1" | ${HOME} export
+	&& local then test $(pwd) --verbose
+/usr/bin -eu printf 2>/dev/null test test x=1 ${HOME} awk awk -eu awk /usr/bin
+		echo && printf readonly sed sed printf /usr/bin "$@" ${HOME}
+grep echo && test grep awk awk grep "$1"
+		--verbose done $(pwd) cd sed ${HOME} | local readonly
+grep test /usr/bin "$1" "$1" echo grep local grep "$@" grep grep $(pwd) x=1
+		2>/dev/null 'quoted text' -eu && done --verbose 2>/dev/null -eu -eu "$1"
+	'quoted text' test local sed sed | /usr/bin
+	sed "$@" echo then grep printf $(pwd) echo grep &&
+awk --verbose -eu $(pwd)
+printf "$@" -eu | echo readonly
+		printf && /usr/bin "$@" echo /usr/bin "$@" then "$1" --verbose echo printf "$@"
+		export readonly local echo
+	local then echo ${HOME} readonly ${HOME}
+done /usr/bin $(pwd) echo 'quoted text' then -eu grep
+	done /usr/bin printf printf done x=1 then readonly ${HOME} export |
+done | && awk test "$@" --verbose x=1 local | done echo 'quoted text' cd x=1
+		--verbose 'quoted text' done
+&& -eu awk /usr/bin then
+readonly 'quoted text' printf ${HOME}
+printf export 'quoted text' sed then echo cd "$1" then ${HOME} -eu printf ${HOME}
+		test "$@" then echo test /usr/bin
+	export ${HOME} printf sed ${HOME} sed "$1" | sed sed ${HOME}
+&& done -eu 2>/dev/null
+	x=1 --verbose export x=1 export done readonly
+export $(pwd) done x=1 export cd readonly 'quoted text' cd grep echo
+	done readonly 2>/dev/null echo sed "$1" "$1" cd printf sed test ${HOME}
+$(pwd) awk "$@" x=1 cd 'quoted text' "$@"
+		-eu printf /usr/bin readonly && done 'quoted text'
+	-eu "$1" sed ${HOME} && ${HOME}
+		then --verbose | x=1 --verbose $(pwd)
+	printf printf then | x=1 'quoted text' readonly /usr/bin export done x=1 sed
+-eu "$@" grep readonly ${HOME}
+	cd -eu test readonly "$@" 2>/dev/null
+		x=1 $(pwd) grep ${HOME} 'quoted text' test -eu printf done sed export
+		/usr/bin 'quoted text' readonly | x=1 done then readonly
+	then echo export "$@" "$@" && local $(pwd) sed local 2>/dev/null && "$1" --verbose
+		--verbose $(pwd) awk grep grep
+	--verbose test local sed | -eu export
+	--verbose readonly "$1"
+	/usr/bin -eu && export readonly echo readonly
+	--verbose 2>/dev/null 'quoted text'
+		${HOME} grep done cd $(pwd) "$@" /usr/bin sed --verbose x=1 local "$@"
+	cd && sed then $(pwd) | ${HOME} echo cd | readonly -eu export readonly $(pwd)
+--verbose done $(pwd) printf
+	$(pwd) awk x=1 sed | test && "$@" ${HOME} -eu && cd | $(pwd) then
+		x=1 export awk -eu printf test then local
+		echo cd grep | done | "$@" grep cd "$@" local
+		done x=1 -eu cd export then $(pwd) awk echo grep
+export -eu printf -eu test done $(pwd) | then --verbose echo
+	-eu && /usr/bin then --verbose --verbose 2>/dev/null test "$@" sed awk |
+--verbose ${HOME} then "$@" readonly | x=1 && "$1" grep echo test 'quoted text'
+	| "$@" /usr/bin awk /usr/bin readonly x=1 local export
+		${HOME} | x=1 echo -eu cd && x=1 --verbose
+		-eu grep "$1" local awk x=1 grep
+	grep -eu echo ${HOME} readonly awk sed --verbose
+'quoted text' sed then export
+	echo && local then export -eu 2>/dev/null $(pwd) export
+| "$1" cd -eu awk printf local then
+	export awk 2>/dev/null
+/usr/bin then -eu cd test local cd x=1 test /usr/bin -eu grep "$@" 'quoted text'
+	--verbose 2>/dev/null echo readonly cd
+	test | done | ${HOME} then printf readonly | echo ${HOME} 'quoted text'
+cd grep /usr/bin grep done "$1" then "$@"
+x=1 /usr/bin && --verbose
+	echo sed then test local "$@" x=1 | "$@" x=1 "$1" test && ${HOME} then /usr/bin
+		sed ${HOME} -eu "$@" 2>/dev/null 'quoted text' $(pwd) done echo "$1"
+	--verbose sed --verbose ${HOME} $(pwd) sed /usr/bin then && then cd
+	--verbose export $(pwd) --verbose $(pwd) 2>/dev/null x=1 -eu done -eu awk
+"$1" done local | test cd printf $(pwd) then 2>/dev/null echo
+		cd x=1 | printf 2>/dev/null test sed
+'quoted text' -eu | local x=1 export echo
+/usr/bin $(pwd) grep done -eu x=1 "$@" -eu readonly
+	printf readonly --verbose ${HOME} awk ${HOME} 2>/dev/null
+	echo "$1" awk then export grep grep awk x=1
+	$(pwd) awk | done --verbose 'quoted text' test | $(pwd) -eu grep | 2>/dev/null
+		local | awk done readonly cd -eu sed /usr/bin printf x=1 -eu export /usr/bin | 2>/dev/null
+cd $(pwd) printf done -eu
+sed /usr/bin done --verbose printf local then ${HOME} /usr/bin test "$1" /usr/bin
+-eu done 'quoted text' local 2>/dev/null
+	/usr/bin test && cd awk printf grep 2>/dev/null 2>/dev/null grep "$@" /usr/bin |
+		2>/dev/null | ${HOME} x=1 echo export /usr/bin printf -eu
+${HOME} printf ${HOME} cd local awk grep
+"$@" x=1 ${HOME} cd /usr/bin -eu then x=1 'quoted text'
+		export export done grep echo readonly
+done cd sed then 'quoted text' done then echo --verbose
+--verbose /usr/bin readonly
+'quoted text' && "$1" --verbose grep 2>/dev/null
+done test 2>/dev/null done | sed export ${HOME} && cd "$@"
+	local sed ${HOME} --verbose done done 2>/dev/null x=1 x=1 -eu | sed /usr/bin
+		&& grep awk grep "$@"
+		/usr/bin grep cd ${HOME} then ${HOME} --verbose echo
+		$(pwd) | done "$1" "$1" "$@" "$@"
+	&& 2>/dev/null x=1 cd /usr/bin
+"$1" && -eu && awk printf 'quoted text' -eu echo done | "$1" | grep $(pwd) awk
+export readonly grep --verbose awk export export /usr/bin
+	done export --verbose printf echo cd then local x=1 $(pwd) /usr/bin ${HOME} --verbose
+cd --verbose test x=1 test sed done | x=1 ${HOME}
+sed cd x=1 | local sed -eu "$1" done 2>/dev/null then then export local readonly
+export grep "$1" printf then readonly export $(pwd) 2>/dev/null --verbose
+		${HOME} export /usr/bin local | echo -eu $(pwd) grep printf sed printf
+		&& -eu --verbose x=1 echo 'quoted text'
+then "$@" sed | export test "$@" awk ${HOME}
+		-eu | printf sed ${HOME} awk sed 'quoted text' done
+readonly "$1" $(pwd) echo awk grep awk
+	&& then 2>/dev/null -eu readonly $(pwd) grep 'quoted text'
+grep -eu readonly local $(pwd)
+		echo done cd x=1 2>/dev/null printf -eu
+	cd /usr/bin test && local 2>/dev/null sed echo /usr/bin
+	/usr/bin 'quoted text' cd 2>/dev/null sed ${HOME} grep && done done /usr/bin --verbose
+	"$@" cd awk readonly awk export readonly test grep then /usr/bin /usr/bin
+	echo grep /usr/bin export printf export $(pwd) | echo awk cd && "$1" "$@"
+		/usr/bin sed | x=1 "$1" readonly sed done
+/usr/bin sed 'quoted text' grep | readonly "$@" $(pwd) then awk
+&& -eu "$1" $(pwd) printf done then export $(pwd) cd awk x=1
+2>/dev/null --verbose "$1" grep "$1" local done
+	${HOME} echo && awk export "$1" | x=1 then x=1 then /usr/bin
+		grep echo grep ${HOME} --verbose ${HOME} test sed test $(pwd)
+sed "$1" printf --verbose
+		cd export --verbose readonly -eu 'quoted text' x=1 printf -eu awk "$@" && /usr/bin
+then sed then export local cd /usr/bin cd grep sed
+	done echo grep readonly "$@" readonly printf printf then /usr/bin grep awk
+	echo "$1" $(pwd) cd $(pwd) "$@" grep done ${HOME}
+--verbose sed "$@" x=1 x=1 "$@" cd local
+local ${HOME} then cd "$1" |
+done -eu awk $(pwd) 'quoted text'
+test "$1" -eu "$@" $(pwd) awk -eu
+		x=1 printf "$1" sed cd then /usr/bin 'quoted text'
+export "$@" x=1 cd && x=1 x=1 "$1" "$@"
+	cd cd x=1 cd x=1 sed readonly x=1 cd "$1" | && cd echo /usr/bin
+		"$@" | && 'quoted text' 2>/dev/null /usr/bin && done 'quoted text'
+		readonly --verbose awk local export /usr/bin sed cd 'quoted text'
+readonly 'quoted text' | --verbose x=1 'quoted text' -eu ${HOME} then
+--verbose "$1" awk echo
+$(pwd) done | 'quoted text' printf test "$1"
+2>/dev/null done | "$@" printf awk awk $(pwd) "$@" echo
+	export -eu readonly x=1 readonly done test ${HOME} local --verbose /usr/bin
+	sed /usr/bin awk /usr/bin printf sed && $(pwd) ${HOME}
+	local | test printf ${HOME} then readonly local /usr/bin grep cd && local --verbose
+	test $(pwd) x=1 2>/dev/null -eu done 'quoted text'
+/usr/bin "$@" /usr/bin $(pwd) test && 2>/dev/null
+	test $(pwd) sed readonly
+	${HOME} export --verbose | grep awk | sed awk then export $(pwd) then ${HOME} then
+		x=1 readonly ${HOME} local $(pwd) -eu awk
+cd | export export cd export 'quoted text' echo echo -eu ${HOME}
+		-eu awk x=1 readonly -eu done x=1
+	sed echo --verbose 2>/dev/null local
+	grep -eu -eu "$1" awk "$1" | | printf $(pwd)
+	${HOME} x=1 readonly then
+		2>/dev/null ${HOME} /usr/bin export
+/usr/bin grep && | cd "$@" $(pwd) && grep
+		echo readonly "$1" "$@" export ${HOME} "$@" sed 2>/dev/null grep && "$@"
+	--verbose | 2>/dev/null -eu readonly
+		sed 'quoted text' | readonly local
+		then | cd echo "$@" then --verbose -eu test readonly done -eu then awk 'quoted text'
+		awk export sed 2>/dev/null "$@" --verbose | then
+sed ${HOME} cd cd /usr/bin
+$(pwd) 2>/dev/null --verbose
+	grep export --verbose ${HOME}
+	2>/dev/null ${HOME} | sed then /usr/bin then printf export | 'quoted text' ${HOME}
+&& export ${HOME} cd x=1 'quoted text'
+	-eu export "$@" | local 2>/dev/null sed
+2>/dev/null grep "$1" then local then printf ${HOME} ${HOME} "$1" "$1" cd --verbose
+'quoted text' readonly test $(pwd) sed "$1" export printf && then --verbose
+	/usr/bin readonly 2>/dev/null 2>/dev/null
+awk | readonly cd test cd /usr/bin ${HOME} readonly printf
+		x=1 ${HOME} 'quoted text' sed /usr/bin ${HOME} /usr/bin test echo "$@" cd export
+-eu grep "$@" then "$@" awk echo "$1" grep x=1
+&& test grep printf local sed x=1 test echo --verbose
+$(pwd) $(pwd) echo "$1" awk && x=1 $(pwd) x=1 -eu local ${HOME}
+	'quoted text' cd "$@" test "$@" 2>/dev/null
+'quoted text' grep awk x=1 grep done
+		| echo --verbose $(pwd) test then
+	printf "$1" /usr/bin "$1" readonly -eu export echo local $(pwd) -eu 2>/dev/null
+	x=1 2>/dev/null echo readonly -eu $(pwd)
+$(pwd) "$1" then 'quoted text' readonly
+		echo 'quoted text' readonly export x=1 && $(pwd) then cd --verbose $(pwd)
+done grep sed test $(pwd)
+printf readonly grep then done 'quoted text'
+echo -eu ${HOME} $(pwd) 'quoted text' -eu -eu
+		done | x=1 readonly 'quoted text' && -eu export && | /usr/bin && 'quoted text'
+		-eu cd /usr/bin then && echo x=1 then done
+	x=1 --verbose export -eu awk "$@"
+&& export 'quoted text' cd /usr/bin /usr/bin test done -eu export
+		2>/dev/null local --verbose /usr/bin ${HOME} grep 2>/dev/null
+-eu echo local awk $(pwd) test $(pwd) awk printf && --verbose printf "$1" 'quoted text'
+sed readonly then readonly
+	-eu test ${HOME} grep done | x=1 2>/dev/null 2>/dev/null
+	&& test sed sed awk -eu x=1 echo echo
+	echo --verbose readonly 'quoted text'
+readonly /usr/bin $(pwd) ${HOME} 'quoted text' readonly readonly export
+	grep $(pwd) 2>/dev/null | local -eu echo -eu 2>/dev/null "$1" export done
+	readonly cd 2>/dev/null test x=1 'quoted text' && echo 'quoted text' --verbose
+	printf $(pwd) | grep /usr/bin $(pwd) "$@" then "$@" 'quoted text' then &&
+sed test printf $(pwd) ${HOME}
+sed $(pwd) readonly echo 'quoted text' echo
+	cd export awk grep ${HOME} printf readonly x=1
+		done | then -eu awk sed "$@" readonly cd awk /usr/bin readonly ${HOME} x=1
+	done && -eu "$@" "$@" cd "$1" | cd done readonly echo ${HOME} x=1 echo export "$1"
+		awk readonly "$@" printf /usr/bin echo x=1 $(pwd) echo
+		then "$@" test readonly | echo 2>/dev/null readonly && "$1" then "$1" | grep
+		"$@" && then "$1" "$@" /usr/bin echo && export 2>/dev/null printf | echo
+	echo export -eu sed test readonly 2>/dev/null 'quoted text' export
+	test test export 2>/dev/null
+awk done "$1" local test cd sed && /usr/bin
+		x=1 ${HOME} done -eu readonly -eu local | $(pwd) --verbose /usr/bin
+	--verbose done then 2>/dev/null 'quoted text'
+readonly "$@" --verbose grep --verbose -eu printf | --verbose
+		2>/dev/null --verbose "$1" echo printf
+-eu then $(pwd) cd "$1" | cd awk sed "$1" -eu -eu /usr/bin && && sed &&
+-eu 2>/dev/null && $(pwd) | awk
+	then then $(pwd) echo done "$@" done readonly
+		cd printf export export "$@" 2>/dev/null
+	"$1" && printf printf then x=1 --verbose
+		cd grep done readonly ${HOME} echo export cd /usr/bin
+echo test then | local grep readonly $(pwd)
+done -eu && && "$1" sed readonly
+	awk "$@" /usr/bin -eu awk $(pwd) $(pwd) ${HOME} -eu done echo && 2>/dev/null 2>/dev/null
+		test /usr/bin then readonly sed readonly "$@" -eu --verbose
+	/usr/bin printf test readonly then sed 'quoted text' cd printf
+		'quoted text' 2>/dev/null cd sed
+		&& cd && printf && | | test && done /usr/bin
+	"$1" 'quoted text' | && test awk sed
+grep $(pwd) "$@" sed && "$1" "$@"
+		'quoted text' readonly x=1 | readonly grep 2>/dev/null "$@" "$@" printf
+"$@" sed 2>/dev/null then awk -eu /usr/bin --verbose then "$1"
+	'quoted text' "$@" test 2>/dev/null
+		--verbose x=1 done x=1 sed
+		readonly then local | /usr/bin
+		sed test -eu then printf then -eu "$@" export ${HOME} | echo
+	sed awk echo local printf
+		&& -eu export | cd | "$1" 2>/dev/null done
+	${HOME} 'quoted text' done
+		&& /usr/bin test ${HOME} "$@" && export
+		| readonly test export 2>/dev/null &&
@@ -0,0 +1,2001 @@
+	echo "$1" 2>/dev/null awk /usr/bin
+-eu x=1 export /usr/bin "$@" 'quoted text' ${HOME} && echo -eu && then &&
+		done /usr/bin | echo echo readonly export sed sed
+		/usr/bin "$@" ${HOME} export
+		--verbose printf printf sed "$@" local x=1 grep done --verbose
+		local ${HOME} export awk sed readonly sed cd sed local --verbose
+| echo ${HOME} x=1 2>/dev/null
+x=1 awk -eu && -eu "$@" -eu sed && awk /usr/bin --verbose "$1"
+	--verbose cd x=1 readonly $(pwd) grep
+		printf export awk echo export done readonly export sed "$@" x=1 printf local then
+	x=1 "$1" x=1 echo "$@" 'quoted text' test echo "$@" 'quoted text'
+cd 'quoted text' then local
+		done ${HOME} readonly local export 2>/dev/null && --verbose then
+local test 'quoted text' /usr/bin $(pwd) /usr/bin "$@" x=1
+	local "$1" grep awk x=1 'quoted text'
+'quoted text' test then | $(pwd) grep --verbose
+	local $(pwd) 2>/dev/null cd 2>/dev/null --verbose 2>/dev/null awk readonly
+cd sed --verbose /usr/bin --verbose x=1 x=1 $(pwd)
+	${HOME} --verbose 2>/dev/null grep awk then "$1" 2>/dev/null
+		local printf awk printf export ${HOME} $(pwd)
+		2>/dev/null done /usr/bin printf ${HOME}
+		2>/dev/null $(pwd) export
+${HOME} cd readonly ${HOME} && cd awk test 'quoted text' "$1" -eu | "$@" && 2>/dev/null
+	| 2>/dev/null --verbose echo printf "$1" 2>/dev/null then sed readonly /usr/bin
+awk test --verbose "$1" | test 2>/dev/null 'quoted text'
+		'quoted text' ${HOME} $(pwd) -eu echo local grep 'quoted text' done echo
+readonly printf readonly 'quoted text' 'quoted text'
+		x=1 echo printf awk /usr/bin x=1 test && awk 'quoted text'
+		'quoted text' --verbose
+		then x=1 cd x=1 export
+done done sed x=1 awk done "$@" $(pwd) | cd export "$1" /usr/bin
+	readonly export done local printf x=1 grep x=1 readonly /usr/bin
+-eu echo x=1 /usr/bin readonly local
+		echo test ${HOME} echo --verbose "$1" local
+		"$1" grep local then readonly then done ${HOME} "$@" /usr/bin 2>/dev/null
+		sed 'quoted text' 'quoted text' sed test -eu ${HOME} $(pwd) cd done
+	local "$@" done export done awk
+--verbose 2>/dev/null | echo "$1" readonly echo -eu 'quoted text' 2>/dev/null
+	| $(pwd) cd --verbose /usr/bin local x=1
+	awk /usr/bin local awk --verbose printf
+		then ${HOME} awk test echo grep sed readonly "$@" readonly
+x=1 $(pwd) && x=1 ${HOME} cd "$@" cd /usr/bin
+	awk --verbose ${HOME} -eu
+	| grep test $(pwd) "$@" readonly -eu readonly test "$@" echo "$@"
+		$(pwd) "$1" grep && awk x=1 "$@" sed
+x=1 "$1" grep 'quoted text' export && echo -eu 'quoted text' &&
+		x=1 x=1 local --verbose done echo /usr/bin 2>/dev/null cd /usr/bin
+	echo sed sed --verbose -eu x=1 /usr/bin --verbose --verbose grep --verbose
+		"$@" sed -eu grep export 2>/dev/null -eu 2>/dev/null "$@" ${HOME} -eu
+then 'quoted text' x=1 /usr/bin printf
+2>/dev/null && then | -eu --verbose --verbose && && echo printf readonly
+	$(pwd) && done local --verbose
+	| sed test done done 'quoted text' echo readonly
+	&& /usr/bin "$1" then readonly -eu "$@"
+		cd echo 2>/dev/null -eu then && readonly
+	then $(pwd) 'quoted text' $(pwd) printf
+		&& -eu sed awk grep readonly sed "$1"
+	"$@" local test readonly then sed /usr/bin 2>/dev/null "$@" local
+		awk done export export sed ${HOME} sed "$1"
+		then local readonly -eu then --verbose
+	"$@" cd local printf && 'quoted text'
+2>/dev/null printf x=1 then
+	2>/dev/null | --verbose grep then grep
+		x=1 printf grep && then readonly
+	grep cd /usr/bin readonly awk ${HOME} x=1 grep "$@" cd done ${HOME}
+		$(pwd) export awk sed grep x=1 cd awk printf echo test "$1"
+&& "$@" $(pwd) -eu $(pwd) 'quoted text' sed | 2>/dev/null "$@"
+&& done x=1 /usr/bin | test $(pwd)
+readonly done "$@" then test readonly 2>/dev/null | sed readonly x=1 ${HOME}
+sed printf ${HOME} 'quoted text' done 'quoted text'
+	"$@" then cd printf /usr/bin "$@" "$@" readonly $(pwd) test
+&& --verbose "$@" printf export
+	awk ${HOME} export local grep awk readonly -eu "$@" test x=1 awk -eu done 'quoted text'
+grep && "$1" ${HOME} --verbose 'quoted text' cd local /usr/bin
+x=1 -eu $(pwd) printf printf $(pwd) awk done sed -eu 'quoted text' && then
+		${HOME} 2>/dev/null export export readonly ${HOME}
+local && /usr/bin "$1" then local --verbose printf /usr/bin "$@" --verbose 'quoted text'
+	-eu cd -eu echo printf readonly echo readonly
+		export 'quoted text' readonly done local x=1
+		readonly "$@" then test
+		readonly export echo | local "$@" $(pwd) | echo printf export awk |
+	echo echo cd ${HOME} "$@" "$@" "$1" "$1" sed x=1 cd 2>/dev/null x=1
+2>/dev/null awk "$1" x=1 ${HOME} --verbose | export printf local | done printf
+	grep && 'quoted text' "$1" | ${HOME} -eu cd "$@" --verbose |
+done | echo ${HOME} /usr/bin local 2>/dev/null
+printf done "$@" sed test --verbose
+grep awk sed ${HOME} ${HOME} 2>/dev/null ${HOME} | test test awk grep then
+		'quoted text' done then $(pwd) && local test && ${HOME} local "$1" cd 2>/dev/null
+	export printf $(pwd) "$@" -eu 'quoted text' | done grep printf /usr/bin
+		done then test export 2>/dev/null echo printf awk test echo --verbose
+$(pwd) "$@" 'quoted text' done test x=1 echo 2>/dev/null -eu awk cd 'quoted text'
+&& 2>/dev/null cd -eu "$1" test -eu awk /usr/bin --verbose
+"$@" awk awk echo x=1 --verbose --verbose
+		then test ${HOME} -eu test local 'quoted text' readonly
+		x=1 export "$@" 'quoted text' 'quoted text' awk then grep
+	x=1 local export done printf $(pwd) -eu then
+export test --verbose /usr/bin
+		then "$@" -eu 'quoted text' readonly
+		-eu 2>/dev/null echo --verbose echo x=1 test "$@" "$1" then local
+		| | | -eu sed $(pwd) readonly grep awk readonly awk
+	$(pwd) test echo x=1 2>/dev/null -eu local echo local export sed 2>/dev/null readonly
+	${HOME} then readonly local grep printf | "$@" "$1" "$@" grep /usr/bin
+	"$@" test grep test && "$@" "$@" "$1" awk x=1 | /usr/bin test | awk
+--verbose /usr/bin done /usr/bin
+${HOME} -eu then echo $(pwd) && --verbose local -eu | awk --verbose echo
+	local "$1" printf readonly 'quoted text' then 'quoted text' export cd /usr/bin
+	/usr/bin readonly local readonly printf
+	&& readonly 'quoted text' $(pwd) && awk test ${HOME} | ${HOME}
+done test awk "$@" printf grep readonly && | awk 'quoted text' 'quoted text'
+"$1" awk --verbose grep grep 'quoted text'
+		sed sed "$1" done 'quoted text' $(pwd) printf ${HOME} ${HOME} 2>/dev/null
+sed x=1 test cd "$1" 2>/dev/null /usr/bin grep -eu readonly export cd
+	printf && sed printf 2>/dev/null cd sed readonly | cd local printf "$1" "$1"
+		-eu 'quoted text' echo test then local local 2>/dev/null
+	local "$@" x=1 grep cd | test export x=1
+export | "$@" readonly sed $(pwd) local | -eu -eu local done cd && test "$@" done
+	-eu | $(pwd) 'quoted text' local awk --verbose grep 2>/dev/null sed sed
+		sed readonly local --verbose && export
+done printf grep awk && sed readonly
+		--verbose then readonly export
+		local /usr/bin 'quoted text' $(pwd) echo sed local
+sed readonly done printf awk 'quoted text' then
+awk --verbose "$1" ${HOME} -eu readonly "$1" export local $(pwd) then
+$(pwd) "$1" "$1" 'quoted text' test grep && "$@" | awk
+awk 'quoted text' test grep | done cd
+	grep $(pwd) readonly export then $(pwd) then test echo cd local | sed && x=1
+		$(pwd) cd then /usr/bin && done "$1" | -eu grep 2>/dev/null "$1"
+	--verbose /usr/bin && echo export
+&& /usr/bin awk local "$@" /usr/bin then && -eu echo --verbose
+	local /usr/bin && | "$@" "$@" $(pwd) then local $(pwd)
+	&& echo x=1 "$@" grep test -eu 2>/dev/null
+-eu local sed then && 2>/dev/null printf -eu test x=1 grep
+		-eu 2>/dev/null && cd -eu
+	"$@" grep --verbose $(pwd) cd then local
+	'quoted text' && && ${HOME} "$1"
+	'quoted text' awk done export export x=1 done "$1"
+	grep grep done --verbose then readonly printf
+	x=1 then printf -eu readonly awk ${HOME}
+		${HOME} x=1 grep echo 2>/dev/null then $(pwd) grep sed
+	-eu readonly grep local awk then ${HOME} awk $(pwd) --verbose
+		local export $(pwd) ${HOME} sed local test
+		done $(pwd) | "$1" "$1" echo --verbose
+	-eu grep readonly ${HOME} echo -eu -eu export cd "$@" 'quoted text' grep --verbose
+	local --verbose cd test -eu
+		done export --verbose readonly $(pwd) readonly grep 'quoted text'
+"$1" 'quoted text' cd test 2>/dev/null sed x=1 readonly
+"$@" /usr/bin 2>/dev/null then "$1" grep
+	$(pwd) | echo $(pwd) ${HOME} echo 2>/dev/null
+		done cd export -eu /usr/bin && x=1 2>/dev/null grep sed $(pwd) | cd "$1"
+/usr/bin | $(pwd) grep
+'quoted text' test --verbose --verbose
+--verbose export x=1 grep sed grep 2>/dev/null $(pwd) then 2>/dev/null
+readonly /usr/bin $(pwd) then printf && printf --verbose test "$1"
+		--verbose ${HOME} 2>/dev/null x=1 test | then test cd readonly done done local
+	printf echo done printf awk ${HOME} && -eu ${HOME} "$1"
+echo | "$1" | x=1 ${HOME} cd cd x=1 readonly test $(pwd) ${HOME} sed echo
+	&& 2>/dev/null printf /usr/bin done $(pwd)
+printf cd cd test "$@" "$1" echo sed awk echo printf local awk --verbose 2>/dev/null
+export x=1 grep "$1" "$1" done done then grep sed done awk &&
+		test test ${HOME} local -eu --verbose
+		awk sed awk grep x=1 then local printf done 'quoted text' test -eu grep
+	/usr/bin -eu sed export 'quoted text' echo echo readonly readonly
+		$(pwd) test echo --verbose x=1 "$@" printf then export
+	readonly "$@" 'quoted text'
+	"$@" awk /usr/bin -eu awk grep ${HOME} x=1 grep cd grep
+		sed -eu grep cd && $(pwd) cd local printf
+		$(pwd) --verbose echo "$@" readonly cd done export -eu sed echo "$1"
+"$1" "$1" && awk grep /usr/bin readonly 2>/dev/null printf /usr/bin echo echo
+		$(pwd) done ${HOME} printf
+export x=1 export "$@" local "$@" ${HOME} sed
+		export "$@" "$1" "$@" && local printf 'quoted text'
+		export | && | test local ${HOME} test readonly printf --verbose done echo export
+	then test -eu | 'quoted text'
+	$(pwd) "$@" ${HOME} export x=1 test then ${HOME} readonly
+		--verbose "$@" done /usr/bin awk $(pwd) x=1 readonly
+		export $(pwd) -eu grep readonly
+		| printf cd grep && x=1 done && test && /usr/bin done "$1" readonly
+then printf export 'quoted text' readonly $(pwd) "$1" 'quoted text'
+	printf /usr/bin -eu && x=1 awk local test "$@" 2>/dev/null --verbose
+grep then echo 2>/dev/null 'quoted text' readonly cd awk awk && ${HOME} then
+$(pwd) -eu export test awk "$1" sed "$1" echo /usr/bin test
+sed x=1 -eu ${HOME} && echo 2>/dev/null "$1"
+	echo export echo done $(pwd) readonly then "$1" export /usr/bin
+	test test sed 2>/dev/null /usr/bin --verbose ${HOME} test "$@" cd --verbose
+		/usr/bin test 'quoted text'
+		printf local ${HOME} 'quoted text' "$1" 2>/dev/null x=1 export
+		cd done | "$1" && awk $(pwd) grep 2>/dev/null
+printf readonly export export readonly && "$@" && /usr/bin
+x=1 -eu test | printf echo readonly 2>/dev/null test grep local
+local "$1" | then "$@" 2>/dev/null done /usr/bin
+&& cd "$1" grep sed sed x=1 grep 'quoted text'
+test sed local | ${HOME} "$1"
+| "$1" "$@" awk grep printf local /usr/bin
+${HOME} /usr/bin done 'quoted text' cd
+		&& 2>/dev/null then sed -eu done awk export awk test awk
+	2>/dev/null local && sed --verbose --verbose 2>/dev/null && local
+		/usr/bin sed /usr/bin echo cd grep /usr/bin
+	'quoted text' grep "$@" grep ${HOME} -eu "$1" --verbose local
+	cd cd grep 'quoted text'
+	x=1 grep then ${HOME} awk --verbose export test local cd 2>/dev/null
+printf done -eu echo readonly printf then x=1 |
+	awk /usr/bin | test test echo echo 2>/dev/null
+		--verbose awk printf 2>/dev/null x=1 test && x=1 /usr/bin 2>/dev/null
+		${HOME} --verbose readonly export $(pwd) done test --verbose && -eu local $(pwd)
+	&& then awk then x=1 export "$@" "$1" | printf ${HOME} awk printf "$@" --verbose
+	sed sed 'quoted text' then done awk done test ${HOME} && echo local "$@" |
+"$@" done "$@" export --verbose ${HOME} awk echo |
+-eu | echo readonly ${HOME} export sed ${HOME} "$@"
+	"$1" done sed $(pwd) cd
+$(pwd) "$1" awk && local | echo x=1 local -eu test
+$(pwd) ${HOME} grep grep done 'quoted text' echo "$@" | "$1" && grep grep 2>/dev/null
+--verbose printf "$@" then export "$@" grep "$1" grep echo | echo done local
+awk | printf awk "$1" -eu ${HOME} /usr/bin $(pwd) local grep local then
+		readonly done x=1 awk readonly $(pwd) && "$1" 'quoted text'
+local export | "$1" x=1 echo ${HOME} /usr/bin --verbose $(pwd)
+		"$1" -eu 2>/dev/null $(pwd) echo $(pwd) grep test "$@" done
+		-eu done cd --verbose "$1" ${HOME}
+-eu awk | "$@" "$1" readonly
+	--verbose printf readonly test cd sed -eu test awk ${HOME} --verbose -eu
+		export 2>/dev/null "$1" done 2>/dev/null done 'quoted text' ${HOME}
+		export --verbose cd grep grep "$@" "$@" cd done cd -eu local ${HOME} sed ${HOME}
+	local cd then awk && awk 'quoted text'
+	echo -eu sed --verbose ${HOME} local export
+readonly sed then readonly awk echo /usr/bin x=1
+	readonly x=1 readonly grep echo "$@" then
+$(pwd) cd then -eu 2>/dev/null /usr/bin 2>/dev/null
+		/usr/bin "$1" test echo printf ${HOME} /usr/bin 'quoted text' 2>/dev/null
+		--verbose printf grep readonly cd cd $(pwd)
+		$(pwd) --verbose awk x=1 --verbose "$@" "$1" --verbose
+		${HOME} export --verbose test then "$@" export export -eu
+echo --verbose "$@" export x=1 -eu test cd --verbose
+		| export sed echo printf cd done echo -eu readonly | then
+		x=1 export "$1" local then x=1 printf awk grep | ${HOME} $(pwd) $(pwd) readonly
+	'quoted text' sed "$1" $(pwd) 2>/dev/null
+| then -eu test sed -eu
+	done grep printf "$@" /usr/bin $(pwd) awk --verbose
+		sed ${HOME} | then /usr/bin 2>/dev/null
+		$(pwd) awk local done cd --verbose cd "$1"
+	$(pwd) grep export && "$1" done
+		sed sed awk echo 'quoted text' test 'quoted text'
+		readonly sed cd cd "$1" grep 2>/dev/null awk echo | | /usr/bin readonly 2>/dev/null
+	readonly grep awk /usr/bin x=1 sed && cd echo --verbose | cd -eu
+		2>/dev/null x=1 echo readonly grep | && --verbose $(pwd) && local
+"$1" -eu then local /usr/bin
+	awk | /usr/bin readonly /usr/bin 'quoted text' && ${HOME} local && "$@" $(pwd)
+		export done awk --verbose x=1 && ${HOME} cd grep awk
+	done export $(pwd) export /usr/bin $(pwd) awk readonly
+${HOME} grep echo -eu $(pwd) sed sed readonly printf $(pwd) 2>/dev/null
+	export test ${HOME} then test test
+cd "$1" | $(pwd) --verbose ${HOME} ${HOME} /usr/bin | done -eu
+	-eu awk cd /usr/bin "$@" $(pwd) && grep printf /usr/bin echo then
+2>/dev/null "$1" ${HOME} | 2>/dev/null 2>/dev/null -eu local
+	&& readonly grep test printf && echo local local
+	"$1" cd && printf | readonly -eu echo local $(pwd)
+done then grep --verbose | $(pwd) ${HOME} test "$1"
+		${HOME} $(pwd) done test sed "$@" "$1" -eu && && "$1" --verbose
+printf -eu then local ${HOME} "$1" "$@" echo cd --verbose awk --verbose
+		test done test awk printf sed grep && x=1 test then --verbose sed
+	sed "$@" then 2>/dev/null done "$@"
+done grep export --verbose export local 'quoted text' readonly cd
+	x=1 then ${HOME} "$1" echo readonly
+	x=1 echo $(pwd) awk local 2>/dev/null "$@" && done 2>/dev/null --verbose
+	${HOME} | cd cd 2>/dev/null test 'quoted text' sed readonly export
+		x=1 then x=1 "$1" 'quoted text' 'quoted text'
+	$(pwd) $(pwd) $(pwd) /usr/bin /usr/bin "$1" 2>/dev/null printf
+	&& /usr/bin done done x=1 echo grep $(pwd)
+		--verbose then echo readonly done --verbose
+local done 2>/dev/null $(pwd) $(pwd) echo readonly /usr/bin grep
+readonly sed 'quoted text' $(pwd)
+grep readonly export export export | readonly readonly printf
+		x=1 x=1 --verbose grep && $(pwd) test test echo ${HOME} -eu local
+	cd "$1" ${HOME} awk local | /usr/bin "$1" x=1
+	/usr/bin "$@" x=1 then 'quoted text' awk "$@"
+/usr/bin x=1 then "$1"
+	x=1 "$1" | 2>/dev/null &&
+		x=1 ${HOME} cd then sed 2>/dev/null cd -eu
+		"$@" done && awk then done awk --verbose "$@"
+printf then printf cd $(pwd)
+	'quoted text' cd | /usr/bin --verbose grep done
+	${HOME} && export then ${HOME} printf test x=1 printf && sed export x=1 &&
+	2>/dev/null sed export 2>/dev/null sed
+2>/dev/null -eu $(pwd) cd 'quoted text' --verbose "$@" done 'quoted text'
+'quoted text' | "$@" done x=1
+	"$@" test printf 'quoted text' "$1" local done cd
+cd echo grep && "$1" cd
+	"$1" export "$1" --verbose 2>/dev/null cd $(pwd) test 'quoted text' 'quoted text'
+local echo local then x=1 echo awk sed grep x=1
+	"$1" 'quoted text' grep awk printf x=1 local cd /usr/bin local x=1
+		printf local -eu grep cd x=1 | $(pwd) /usr/bin
+	grep ${HOME} --verbose $(pwd) then printf sed readonly | "$@" -eu x=1 --verbose
+		grep printf echo test /usr/bin printf readonly -eu
+test done -eu --verbose done 2>/dev/null
+	&& awk readonly done done local echo readonly
+	--verbose awk readonly export 2>/dev/null /usr/bin
+	-eu awk awk test 'quoted text' awk x=1 | /usr/bin echo /usr/bin test 'quoted text'
+		${HOME} /usr/bin export grep -eu 'quoted text'
+	grep $(pwd) cd 2>/dev/null grep | export $(pwd) then
+		then --verbose && readonly export 'quoted text'
+	cd cd ${HOME} readonly grep export sed cd grep then readonly cd |
+	then printf "$1" echo echo
+--verbose /usr/bin local 'quoted text' --verbose
+	2>/dev/null $(pwd) sed
+	'quoted text' cd "$@" -eu x=1 $(pwd) then local sed test && cd && "$@"
+grep | $(pwd) && --verbose cd then awk cd /usr/bin
+-eu sed cd -eu 2>/dev/null /usr/bin x=1 echo awk ${HOME} echo
+	awk then | /usr/bin --verbose
+		"$1" 'quoted text' && --verbose test "$1" export |
+test printf 2>/dev/null echo awk awk "$@" "$@" done -eu | printf readonly /usr/bin
+		/usr/bin 2>/dev/null printf
+	'quoted text' readonly export ${HOME} $(pwd) 'quoted text'
+		-eu awk then echo --verbose cd
+"$1" 2>/dev/null -eu /usr/bin done printf local readonly local awk
+		readonly 2>/dev/null --verbose $(pwd) cd $(pwd) /usr/bin | done && "$1"
+	"$@" export 'quoted text' -eu --verbose awk printf readonly test grep
+	grep awk echo /usr/bin -eu readonly sed /usr/bin ${HOME}
+		x=1 readonly export done | 'quoted text' ${HOME} 'quoted text' printf
+	readonly awk echo $(pwd) grep
+	| ${HOME} test cd test cd printf cd ${HOME} test 'quoted text'
+	--verbose then export && x=1 /usr/bin ${HOME} && /usr/bin && /usr/bin 'quoted text'
+	"$@" done --verbose x=1 printf $(pwd) /usr/bin awk export local awk x=1
+		"$1" 2>/dev/null echo "$@" /usr/bin
+cd && readonly sed readonly
+	--verbose --verbose export test echo $(pwd) | ${HOME} test grep printf --verbose
+	export local $(pwd) "$1" --verbose printf 'quoted text' $(pwd) awk $(pwd) | $(pwd)
+		x=1 ${HOME} awk --verbose readonly 'quoted text'
+x=1 printf printf awk test sed 2>/dev/null
+sed "$@" && -eu awk echo done grep readonly && x=1 sed && then echo
+-eu then x=1 $(pwd) done echo export grep readonly echo then sed echo && cd done
+readonly "$@" 2>/dev/null
+	grep readonly --verbose --verbose ${HOME} done
+	test "$@" "$1" then | sed export && ${HOME} cd -eu "$1" done "$1" "$@" cd printf
+	--verbose 'quoted text' 2>/dev/null test 2>/dev/null
+local --verbose done grep then grep && echo | ${HOME}
+	/usr/bin ${HOME} --verbose "$@"
+		'quoted text' readonly --verbose $(pwd) grep cd awk
+		| --verbose test test 'quoted text' x=1
+	--verbose $(pwd) "$@" | echo /usr/bin "$@" awk readonly readonly
+	done readonly then "$1" -eu readonly cd then echo 2>/dev/null "$@" printf
+		$(pwd) -eu sed sed &&
+readonly "$1" "$1" printf "$@" /usr/bin --verbose
+/usr/bin readonly "$1" && local sed sed readonly 'quoted text'
+	grep $(pwd) grep && "$1" /usr/bin cd cd test printf 2>/dev/null readonly
+2>/dev/null echo /usr/bin test && "$1" awk cd /usr/bin printf $(pwd)
+	readonly --verbose /usr/bin | | test | then sed ${HOME} then
+	grep ${HOME} x=1 awk sed done $(pwd) 'quoted text' /usr/bin
+	/usr/bin cd cd $(pwd) "$@" -eu readonly
+| readonly $(pwd) grep sed local $(pwd) export ${HOME} && ${HOME}
+	printf /usr/bin done 2>/dev/null | $(pwd) /usr/bin test /usr/bin grep
+		echo sed local ${HOME} echo -eu | sed /usr/bin -eu done $(pwd)
+2>/dev/null test 2>/dev/null 2>/dev/null
+2>/dev/null done done "$@" --verbose awk 'quoted text'
+		export cd ${HOME} export | && /usr/bin x=1
+sed cd | | /usr/bin "$@" export "$@" 2>/dev/null sed $(pwd) then awk "$@" |
+'quoted text' local local /usr/bin | then && echo local
+readonly "$@" local 2>/dev/null
+&& done | cd cd $(pwd) readonly
+		-eu /usr/bin export echo then && $(pwd) then "$1" printf --verbose readonly
+"$@" readonly 2>/dev/null then x=1
+done x=1 sed cd export printf | -eu x=1 &&
+	/usr/bin then echo printf awk 'quoted text' printf echo --verbose /usr/bin
+		awk ${HOME} /usr/bin | echo --verbose awk
+	&& cd --verbose && awk cd | /usr/bin "$@" then 'quoted text' 2>/dev/null printf
+		${HOME} $(pwd) -eu --verbose echo 'quoted text' test
+		sed 2>/dev/null printf "$1" ${HOME} printf && cd awk echo grep x=1
+		echo local -eu grep local test -eu 'quoted text' ${HOME} printf --verbose
+		local "$@" sed 2>/dev/null
+		-eu $(pwd) test $(pwd) ${HOME} test ${HOME} cd | && cd 2>/dev/null --verbose awk
+test grep cd grep -eu export readonly
+		/usr/bin printf done awk "$@"
+local local x=1 2>/dev/null readonly
+	printf && /usr/bin done $(pwd) export then $(pwd) | $(pwd) test sed
+		${HOME} export "$@" grep ${HOME} && ${HOME}
+		"$1" grep /usr/bin --verbose "$@" test /usr/bin export ${HOME} then ${HOME}
+	local cd $(pwd) --verbose x=1 /usr/bin readonly export | readonly 2>/dev/null
+		x=1 "$@" --verbose /usr/bin then --verbose /usr/bin /usr/bin readonly 'quoted text'
+		then x=1 'quoted text' "$1" ${HOME}
+--verbose done then -eu awk
+	export /usr/bin done $(pwd) done echo | --verbose -eu
+-eu export cd "$@" "$@" "$@" sed | test export $(pwd) printf ${HOME}
+		-eu 2>/dev/null -eu --verbose | then grep awk
+/usr/bin "$@" local ${HOME} readonly echo readonly 2>/dev/null
+	&& | printf -eu -eu awk printf $(pwd)
+	test --verbose ${HOME} "$@"
+		$(pwd) "$1" ${HOME} test /usr/bin echo
+		then then -eu local echo
+	/usr/bin cd awk local 2>/dev/null
+	| 'quoted text' done --verbose readonly printf 2>/dev/null cd cd
+"$1" test test export
+	cd "$@" 2>/dev/null sed cd 2>/dev/null 'quoted text' local cd -eu 'quoted text'
+		"$1" export /usr/bin readonly grep
+2>/dev/null $(pwd) -eu
+		'quoted text' export readonly done
+	export awk export --verbose && /usr/bin grep /usr/bin $(pwd) done
+cd ${HOME} local /usr/bin --verbose x=1 /usr/bin --verbose grep
+		awk 'quoted text' x=1 local local done printf readonly x=1 readonly
+		awk awk /usr/bin awk test echo "$@" x=1 'quoted text' test "$@" x=1
+		cd echo then done | "$@"
+		printf then sed ${HOME} 'quoted text' cd -eu &&
+x=1 /usr/bin echo then done 2>/dev/null 'quoted text' | "$1" awk /usr/bin then local
+		"$1" printf then echo
+	sed local 2>/dev/null test cd export grep /usr/bin "$1" ${HOME} cd test then | -eu
+	${HOME} done printf local local then readonly 2>/dev/null
+	done printf awk 2>/dev/null "$1" -eu grep $(pwd)
+		${HOME} 'quoted text' local x=1 printf then --verbose
+		/usr/bin done 'quoted text' echo
+	2>/dev/null "$@" done /usr/bin sed /usr/bin awk local 2>/dev/null echo
+		-eu sed && -eu awk grep --verbose echo printf cd export then x=1
+	$(pwd) awk grep export printf ${HOME}
+		'quoted text' local grep local "$1" 2>/dev/null awk $(pwd) awk done printf
+		| cd grep then ${HOME} --verbose grep 'quoted text'
+cd --verbose sed -eu grep printf && "$1" --verbose x=1 local
+		test "$@" echo cd "$@" then x=1 readonly -eu --verbose grep x=1 && sed local
+		then test printf local test 2>/dev/null $(pwd) ${HOME} awk ${HOME}
+printf local sed done 'quoted text'
+		then "$@" cd $(pwd) sed grep | --verbose test ${HOME}
+	sed $(pwd) sed x=1 ${HOME} "$@" done then ${HOME} readonly printf $(pwd) awk
+	readonly -eu 2>/dev/null $(pwd) --verbose "$1" -eu --verbose export -eu x=1
+	| --verbose sed -eu echo awk
+		echo cd local "$1" -eu echo printf export awk |
+--verbose grep -eu 'quoted text' -eu 'quoted text'
+test $(pwd) awk done 2>/dev/null x=1 'quoted text'
+	'quoted text' --verbose grep sed 2>/dev/null
+		"$@" "$1" /usr/bin 2>/dev/null readonly cd 'quoted text'
+		2>/dev/null $(pwd) echo echo
+	export | export "$1" | awk $(pwd)
+grep then done /usr/bin done /usr/bin 2>/dev/null 2>/dev/null
+	| grep && && 2>/dev/null sed $(pwd)
+		export test --verbose 2>/dev/null test readonly
+		&& awk echo 2>/dev/null "$@" /usr/bin
+	"$@" then 2>/dev/null 'quoted text'
+/usr/bin 'quoted text' /usr/bin x=1 'quoted text' then awk done x=1 $(pwd) -eu
+		readonly ${HOME} cd $(pwd) echo local echo
+	done readonly -eu $(pwd) /usr/bin printf $(pwd) printf ${HOME} grep --verbose
+--verbose grep export sed cd /usr/bin -eu local test 2>/dev/null
+		awk ${HOME} readonly | x=1 && local "$@" grep /usr/bin
+		"$@" 'quoted text' ${HOME} test 2>/dev/null export done awk && sed $(pwd)
+	printf cd /usr/bin --verbose x=1 /usr/bin "$1" 2>/dev/null awk printf
+awk "$1" printf done echo && x=1 done -eu "$1" local --verbose
+	grep 2>/dev/null 2>/dev/null /usr/bin then sed 2>/dev/null awk
+		local readonly ${HOME} grep /usr/bin |
+	&& 'quoted text' ${HOME} test export
+	| done $(pwd) printf grep 'quoted text' "$@" test done $(pwd) awk test
+x=1 2>/dev/null $(pwd) --verbose -eu test && -eu x=1
+		awk 'quoted text' done /usr/bin cd x=1 cd -eu --verbose ${HOME} readonly
+	-eu then /usr/bin awk 2>/dev/null --verbose
+readonly printf 2>/dev/null cd "$@" 'quoted text' /usr/bin
+		local printf /usr/bin cd
+	&& test --verbose 2>/dev/null awk done "$@" export $(pwd) sed 2>/dev/null
+| export -eu -eu | 2>/dev/null x=1 x=1 x=1 /usr/bin done export
+		readonly /usr/bin local readonly printf
+		x=1 test $(pwd) sed done awk awk ${HOME} $(pwd) test echo
+export echo awk $(pwd) x=1
+	&& 2>/dev/null cd "$1" x=1 export local cd && $(pwd) $(pwd)
+	printf awk echo ${HOME} done cd readonly then && cd grep echo grep
+x=1 && grep local grep then
+	local test then /usr/bin /usr/bin
+grep local | grep echo done
+	/usr/bin -eu cd echo local readonly 2>/dev/null 2>/dev/null
+	grep && /usr/bin --verbose test readonly echo --verbose && $(pwd)
+	--verbose ${HOME} $(pwd) "$1" export 'quoted text'
+	grep local --verbose x=1
+		&& printf x=1 local test "$@" then | "$1" x=1 done 'quoted text'
+		done sed x=1 2>/dev/null local
+$(pwd) grep awk 2>/dev/null done && x=1 'quoted text' && local "$1" 2>/dev/null
+	2>/dev/null grep -eu
+echo export cd awk cd echo "$1" -eu local /usr/bin
+sed $(pwd) && done printf x=1 done "$1" -eu local $(pwd)
+printf | 'quoted text' x=1 'quoted text' echo printf ${HOME} grep
+		then echo local done "$@" then -eu cd
+	"$1" sed 2>/dev/null then test grep ${HOME} local printf test export test
+| printf | local "$@" printf
+	'quoted text' ${HOME} ${HOME} /usr/bin cd cd ${HOME} ${HOME} /usr/bin -eu then
+		grep | export echo printf grep test echo && /usr/bin done done test
+		echo echo | then echo -eu -eu
+test printf -eu "$1" readonly ${HOME} awk $(pwd)
+--verbose 'quoted text' sed local sed grep "$1" cd 'quoted text' cd
+		sed sed sed sed echo sed cd --verbose ${HOME} 'quoted text' local
+		/usr/bin test 'quoted text'
+-eu --verbose ${HOME} readonly
+	${HOME} export export export $(pwd) ${HOME} done 'quoted text' && printf "$@"
+export x=1 export readonly sed $(pwd) test awk done cd grep export $(pwd) "$1"
+		sed && printf test cd $(pwd) x=1 export cd | "$1"
+${HOME} ${HOME} then ${HOME} 2>/dev/null
+	awk readonly "$1" 2>/dev/null
+		$(pwd) awk ${HOME} ${HOME} sed awk && printf cd 2>/dev/null /usr/bin test | |
+		"$1" "$1" export | /usr/bin printf | awk printf ${HOME} && x=1 awk /usr/bin
+	awk x=1 | sed done ${HOME} grep 'quoted text' -eu cd "$1"
+"$1" test printf sed awk $(pwd) echo then "$@" cd sed | echo && x=1 echo sed "$@"
+	done export | 'quoted text' && local awk -eu local -eu awk 'quoted text'
+		grep 'quoted text' cd x=1 x=1 then export sed sed printf sed | grep
+done 'quoted text' "$@" export export local grep readonly
+| 'quoted text' /usr/bin then && then --verbose $(pwd)
+${HOME} "$@" then local done "$1" "$@" test /usr/bin
+	-eu sed sed ${HOME} ${HOME} grep | | "$@" awk 2>/dev/null | ${HOME} awk printf
+		then "$1" -eu $(pwd) printf echo /usr/bin -eu then
+		sed --verbose x=1 | done $(pwd) -eu local test readonly "$@" sed $(pwd) 'quoted text'
+		sed sed grep awk grep
+	grep 'quoted text' printf local "$1" 'quoted text' done && --verbose export
+		local printf local -eu ${HOME} grep && x=1 cd grep local grep then && 'quoted text'
+		'quoted text' -eu export echo && | /usr/bin
+2>/dev/null 'quoted text' 2>/dev/null sed x=1
+	echo /usr/bin && && test --verbose awk then -eu -eu "$@"
+		test local awk && --verbose test readonly 'quoted text' -eu | ${HOME} awk $(pwd)
+		export local then -eu awk "$1" export echo -eu
+		sed | "$@" /usr/bin awk "$@" 2>/dev/null -eu 2>/dev/null 2>/dev/null cd cd awk
+		then $(pwd) test local --verbose | readonly --verbose 'quoted text'
+	/usr/bin grep local printf /usr/bin 'quoted text' $(pwd)
+	-eu "$@" "$@" cd && done local "$@" 2>/dev/null --verbose
+	sed && -eu -eu grep $(pwd) /usr/bin x=1 then -eu && 2>/dev/null
+cd export test echo $(pwd) | export --verbose
+	local x=1 cd done test done && /usr/bin "$@" $(pwd) "$1" ${HOME} 2>/dev/null
+/usr/bin local /usr/bin echo --verbose
+		test -eu /usr/bin ${HOME} readonly awk x=1 sed cd awk export readonly
+		then then echo "$1" test "$1" && --verbose readonly
+	done $(pwd) -eu local ${HOME} -eu /usr/bin &&
+-eu readonly done printf
+export "$1" && printf grep -eu
+/usr/bin cd x=1 && sed export local
+done | -eu /usr/bin -eu /usr/bin 'quoted text' x=1
+	then "$@" sed done local local done echo test |
+	then readonly --verbose x=1 local test sed -eu /usr/bin
+	sed local test && echo /usr/bin "$@"
+	$(pwd) "$1" echo | grep /usr/bin local echo local echo "$1"
+	then ${HOME} $(pwd) grep export cd -eu --verbose export 'quoted text'
+		test test grep ${HOME} done x=1 cd 'quoted text'
+local export local cd | "$1"
+	echo printf readonly ${HOME}
+	readonly then done printf 'quoted text' local done && x=1 sed echo
+		&& awk echo 2>/dev/null then cd sed
+	grep -eu then awk $(pwd) 'quoted text' -eu cd ${HOME}
+${HOME} printf echo echo 2>/dev/null awk /usr/bin sed
+	grep sed -eu /usr/bin -eu "$1" $(pwd) && done
+		printf ${HOME} printf && done done readonly grep 'quoted text' export sed test
+		printf $(pwd) "$@" | grep && 2>/dev/null && test local $(pwd)
+	"$1" && cd awk -eu /usr/bin
+local grep x=1 ${HOME} -eu "$@" sed done "$1" grep $(pwd) awk printf done export
+		printf sed readonly "$1" grep done
+	cd test | echo cd ${HOME} "$1" awk export echo done printf then
+		printf -eu /usr/bin export test printf printf $(pwd)
+		readonly done && grep test x=1 readonly -eu
+echo /usr/bin done ${HOME} ${HOME} cd test readonly
+		sed 2>/dev/null awk /usr/bin test -eu printf --verbose --verbose -eu && done /usr/bin
+	done awk && /usr/bin 'quoted text'
+		-eu readonly awk | ${HOME} 2>/dev/null printf export export local awk awk readonly
+local grep done --verbose readonly export -eu
+	"$@" "$1" printf printf | awk sed readonly readonly 'quoted text'
+	local "$@" done && 2>/dev/null readonly export
+	done | | | 'quoted text' $(pwd) cd export
+export printf local readonly x=1 printf grep | printf | $(pwd) printf "$1" $(pwd)
+		--verbose --verbose x=1 ${HOME}
+local 2>/dev/null printf |
+		export sed 'quoted text' sed then 'quoted text' cd sed "$@"
+	printf sed $(pwd) x=1 | $(pwd) x=1 readonly export done | readonly cd printf 2>/dev/null
+$(pwd) sed readonly "$1" readonly && echo | then export $(pwd) | export cd printf
+	"$@" ${HOME} printf sed grep grep local echo test -eu && 2>/dev/null
+printf -eu ${HOME} ${HOME} export /usr/bin "$1" export
+	cd | done done 'quoted text' printf $(pwd)
+	--verbose --verbose cd local local export test echo | $(pwd)
+		done x=1 done x=1 $(pwd) --verbose done then
+	done printf awk printf then sed &&
+done ${HOME} readonly --verbose done cd -eu export export sed done | echo x=1
+| echo export x=1 --verbose
+		x=1 export test /usr/bin 'quoted text' "$@" |
+readonly cd $(pwd) /usr/bin x=1 'quoted text' printf echo x=1 cd 2>/dev/null
+	2>/dev/null | local local export 'quoted text'
+-eu printf && readonly export grep readonly /usr/bin
+	"$1" printf -eu | 2>/dev/null done test "$@" cd x=1 then 2>/dev/null echo sed
+cd echo "$@" ${HOME} --verbose x=1 local 'quoted text' 2>/dev/null ${HOME} local
+	'quoted text' local done cd ${HOME} -eu echo awk echo
+		&& $(pwd) printf cd readonly --verbose
+	2>/dev/null printf --verbose x=1 grep printf | 'quoted text'
+		test export ${HOME} x=1 --verbose awk local 2>/dev/null cd cd --verbose "$1"
+	${HOME} awk printf && $(pwd)
+	/usr/bin /usr/bin then grep export
+	echo | sed | local echo then printf ${HOME} x=1 -eu -eu echo
+"$@" 2>/dev/null test grep then awk 2>/dev/null echo ${HOME} ${HOME}
+		local "$@" "$1" $(pwd) -eu --verbose -eu -eu test "$@" local
+		x=1 "$1" | $(pwd) x=1 done ${HOME} then x=1 /usr/bin done printf
+${HOME} sed printf /usr/bin 2>/dev/null
+	${HOME} export echo "$@" echo readonly sed "$@" done export
+awk test sed $(pwd) | sed "$@" grep awk 'quoted text'
+-eu export ${HOME} cd cd 'quoted text' echo then
+		printf sed "$@" done local | x=1 test | x=1
+		--verbose "$1" test awk | | sed /usr/bin | export
+	echo test export printf x=1 $(pwd)
+		local sed "$@" done cd "$@" grep --verbose awk
+local ${HOME} test printf | printf
+		cd "$@" "$1" 2>/dev/null --verbose cd --verbose export grep -eu /usr/bin /usr/bin
+	cd printf $(pwd) readonly
+		'quoted text' then -eu $(pwd) /usr/bin && -eu x=1 local
+"$@" test cd export test 2>/dev/null --verbose
+export ${HOME} 2>/dev/null sed && readonly cd local
+		sed /usr/bin $(pwd) $(pwd) ${HOME} cd --verbose
+awk 'quoted text' test /usr/bin readonly grep $(pwd) cd
+	'quoted text' grep echo "$1" -eu x=1 -eu printf awk export grep
+	/usr/bin | "$@" && awk
+	$(pwd) /usr/bin $(pwd) "$1" "$1" test
+		done done readonly $(pwd) printf grep awk ${HOME} echo 2>/dev/null
+/usr/bin echo printf grep
+	${HOME} test --verbose
+		readonly echo -eu && grep 2>/dev/null ${HOME}
+x=1 sed then | "$1" done sed 'quoted text'
+	2>/dev/null printf then x=1 sed
+		test readonly 'quoted text'
+		| echo echo cd readonly | "$@" "$1" ${HOME} local && 'quoted text'
+printf ${HOME} "$@" && 2>/dev/null export
+	then sed printf "$@" 2>/dev/null
+	printf x=1 && --verbose export "$@" ${HOME} ${HOME}
+-eu $(pwd) then | ${HOME} printf printf printf
+	"$@" 'quoted text' printf
+	'quoted text' 2>/dev/null 'quoted text'
+	"$@" done awk -eu $(pwd) 'quoted text' sed
+		2>/dev/null export "$@" 2>/dev/null cd
+		readonly --verbose 'quoted text' | readonly --verbose test cd grep --verbose 2>/dev/null
+	$(pwd) 2>/dev/null $(pwd) done done readonly ${HOME} "$@" 2>/dev/null
+echo local awk awk x=1 done cd grep $(pwd) then "$1" readonly grep export
+	x=1 awk local readonly export "$@"
+then local awk --verbose $(pwd) x=1 awk 2>/dev/null cd then "$@"
+"$@" "$@" local sed local done --verbose --verbose ${HOME} awk awk cd awk
+export "$1" export 'quoted text' readonly ${HOME} 'quoted text'
+	${HOME} cd awk readonly && sed "$1" cd printf x=1 awk done grep local
+	then done ${HOME} local
+echo cd local cd printf x=1
+	-eu 'quoted text' --verbose | -eu
+export printf echo "$@" export cd export x=1 | x=1 'quoted text'
+"$1" ${HOME} "$1" /usr/bin cd test echo
+	${HOME} "$@" readonly ${HOME} awk x=1 /usr/bin 'quoted text'
+		&& readonly grep "$1" 2>/dev/null local sed "$1" /usr/bin 'quoted text' echo
+		printf readonly 'quoted text' "$@" | 'quoted text' 2>/dev/null ${HOME}
+		readonly sed printf sed grep x=1 $(pwd) -eu readonly
+		sed readonly /usr/bin cd ${HOME} 2>/dev/null echo 'quoted text' sed ${HOME} 'quoted text'
+-eu printf 2>/dev/null local "$1" -eu "$1" 2>/dev/null ${HOME}
+	sed done readonly done x=1 x=1 "$@" --verbose cd
+local then awk && 2>/dev/null | "$@" && $(pwd)
+"$@" | $(pwd) x=1 export
+$(pwd) sed readonly done grep echo ${HOME} awk /usr/bin
+	${HOME} cd then printf "$@" && export
+	echo | $(pwd) $(pwd) export
+		&& "$1" local sed /usr/bin echo
+		-eu test x=1 local 'quoted text' "$1" readonly grep test -eu export -eu
+		/usr/bin | local done done $(pwd) /usr/bin "$@" cd $(pwd) && printf
+	| done sed sed local cd x=1 local x=1 awk
+"$@" -eu local --verbose echo export
+		"$@" -eu awk "$1" -eu awk cd 2>/dev/null --verbose
+	--verbose -eu -eu grep 'quoted text' cd sed sed
+		cd then echo awk "$@" x=1 'quoted text' export sed -eu export grep 'quoted text'
+	-eu "$@" test /usr/bin printf
+	printf 2>/dev/null echo sed awk readonly --verbose local | export readonly
+echo x=1 /usr/bin done 2>/dev/null /usr/bin grep then grep export
+		${HOME} "$@" --verbose 'quoted text' then "$1" grep
+	${HOME} ${HOME} 2>/dev/null -eu 'quoted text' "$1" local sed -eu /usr/bin x=1
+		${HOME} cd "$@" readonly readonly awk printf awk -eu | printf | "$@"
+readonly printf $(pwd) "$@" sed
+		echo export done cd --verbose 2>/dev/null --verbose echo awk grep --verbose 'quoted text'
+	"$1" export x=1 then awk /usr/bin /usr/bin /usr/bin test echo "$1" printf
+		"$@" ${HOME} "$@" /usr/bin 2>/dev/null -eu done "$@" sed then
+sed export sed --verbose | grep printf
+		readonly then echo /usr/bin $(pwd) cd echo -eu sed printf --verbose
+| 2>/dev/null $(pwd) 'quoted text'
+		&& -eu grep cd readonly -eu sed ${HOME} readonly printf /usr/bin local "$@"
+	test "$@" sed readonly
+&& "$@" sed --verbose "$@"
+export grep "$1" 2>/dev/null test printf "$@" x=1 done ${HOME} grep test ${HOME}
+test $(pwd) /usr/bin | test -eu | readonly ${HOME} awk 2>/dev/null 2>/dev/null done
+	x=1 export then test "$1" awk then /usr/bin "$@" --verbose then awk test
+	| test printf /usr/bin awk "$1" "$1" local 2>/dev/null readonly --verbose
+	${HOME} "$@" /usr/bin local echo sed
+local && $(pwd) 'quoted text' echo ${HOME} $(pwd)
+local local grep -eu done echo sed $(pwd) readonly "$1" grep 'quoted text'
+	local sed && "$1" -eu test x=1
+export done --verbose echo
+	local $(pwd) awk cd echo echo grep test 2>/dev/null
+		${HOME} "$@" local printf ${HOME} export export | readonly | --verbose "$1"
+/usr/bin export cd sed --verbose --verbose local echo test cd then printf
+		"$1" awk | ${HOME} done && $(pwd) export done --verbose 'quoted text'
+		awk x=1 $(pwd) export printf awk test -eu printf printf $(pwd) "$1" ${HOME}
+		"$@" && "$@" ${HOME} ${HOME} $(pwd) -eu test
+		"$@" cd x=1 'quoted text' $(pwd)
+		$(pwd) readonly "$1" awk "$@" printf export grep ${HOME}
+local $(pwd) cd /usr/bin echo
+		printf awk | x=1 export && local && local grep "$@" | local export $(pwd)
+	sed awk awk grep readonly -eu awk done cd 'quoted text' -eu
+		readonly then then && && awk --verbose echo "$1" ${HOME} ${HOME} && readonly grep
+x=1 test && grep then readonly echo echo 'quoted text'
+	awk ${HOME} done then local $(pwd)
+	2>/dev/null cd 2>/dev/null --verbose awk -eu test "$1" x=1 grep
+	"$1" x=1 $(pwd) readonly && /usr/bin | ${HOME} cd
+		-eu test test "$@" 'quoted text' /usr/bin export test $(pwd) x=1
+		done readonly done export then
+		sed local cd "$@" printf sed
+test /usr/bin awk then /usr/bin
+export 2>/dev/null local 'quoted text'
+--verbose sed -eu grep printf x=1 printf sed --verbose
+		export x=1 printf 'quoted text' test sed sed | $(pwd) /usr/bin
+"$1" cd echo -eu "$1" "$@" && export
+		${HOME} done x=1 cd -eu --verbose "$@" && cd 2>/dev/null
+	local 'quoted text' awk printf $(pwd) readonly
+	echo --verbose sed printf
+		export /usr/bin grep export local readonly
+		${HOME} done && 'quoted text' "$@" "$1"
+	$(pwd) test && echo $(pwd) 'quoted text'
+		--verbose && && ${HOME} awk 'quoted text' $(pwd) done echo -eu echo
+		x=1 test $(pwd) readonly ${HOME} 'quoted text'
+		"$1" --verbose awk echo awk 2>/dev/null test grep -eu printf "$1" ${HOME}
+		test local grep -eu awk grep "$@" local $(pwd) test
+		&& done done && awk ${HOME} "$1" sed
+	then export echo -eu readonly
+"$1" --verbose local | test grep local sed awk echo readonly awk 'quoted text' local
+| awk $(pwd) sed x=1 done
+		cd $(pwd) 'quoted text' local grep 2>/dev/null x=1
+cd cd --verbose && 'quoted text'
+	"$@" 2>/dev/null done local /usr/bin 2>/dev/null
+		readonly "$@" awk cd x=1 -eu && awk then x=1 readonly local ${HOME}
+		done x=1 done 'quoted text' ${HOME} awk /usr/bin then then local /usr/bin
+test --verbose 2>/dev/null | | test test x=1 export "$@"
+x=1 echo test /usr/bin done test printf echo -eu awk then $(pwd) -eu echo
+	test awk && /usr/bin export test | && cd 'quoted text'
+	local -eu "$@" x=1 printf
+		$(pwd) 'quoted text' readonly /usr/bin
+		'quoted text' "$@" 'quoted text'
+x=1 echo printf printf done grep $(pwd) -eu cd cd -eu printf export && x=1 awk
+x=1 cd sed | then 'quoted text' --verbose && local awk test -eu
+--verbose echo 2>/dev/null | x=1 readonly 2>/dev/null done readonly
+	printf sed | printf $(pwd) && test /usr/bin ${HOME}
+		done printf sed export done -eu cd awk -eu /usr/bin "$@" test
+	grep "$@" /usr/bin "$1" "$1" ${HOME} ${HOME} "$@"
+echo 2>/dev/null cd sed then x=1 echo grep -eu 'quoted text' "$@" ${HOME} --verbose
+&& /usr/bin /usr/bin 2>/dev/null
+	$(pwd) awk export printf sed $(pwd)
+	then local | | local && &&
+"$1" x=1 x=1 awk 'quoted text' awk
+"$1" 2>/dev/null ${HOME} echo export readonly | done --verbose
+		"$@" $(pwd) 2>/dev/null awk echo x=1
+"$1" $(pwd) | $(pwd) /usr/bin x=1 'quoted text' -eu test 2>/dev/null
+	printf -eu test sed x=1 cd 2>/dev/null -eu | echo "$1" ${HOME}
+	echo readonly 'quoted text' | $(pwd) | local ${HOME} echo | x=1 readonly
+	then "$@" awk then 2>/dev/null $(pwd) done x=1 "$@"
+	printf 'quoted text' cd local /usr/bin /usr/bin /usr/bin cd readonly
+	then printf | "$@" echo echo "$@"
+/usr/bin awk export --verbose
+	test --verbose export local test
+		"$@" grep -eu test printf "$1" printf --verbose
+&& cd printf "$@" | awk && /usr/bin
+/usr/bin done --verbose /usr/bin echo -eu readonly awk
+		$(pwd) awk /usr/bin cd test awk readonly
+	"$@" 2>/dev/null /usr/bin echo export awk 2>/dev/null
+	awk echo grep x=1 --verbose readonly $(pwd)
+		--verbose /usr/bin $(pwd) done "$1" sed $(pwd)
+$(pwd) then && then "$@" echo
+		awk echo cd awk 'quoted text' then readonly
+	$(pwd) ${HOME} && "$@" 2>/dev/null "$@" local 'quoted text'
+local printf test $(pwd) --verbose
+		--verbose 2>/dev/null 'quoted text' | $(pwd) 2>/dev/null
+		grep && cd export grep 'quoted text' 2>/dev/null local 'quoted text'
+		export 2>/dev/null $(pwd)
+		| test x=1 'quoted text' grep "$1" -eu echo sed printf --verbose 2>/dev/null 2>/dev/null
+	'quoted text' echo awk export $(pwd) $(pwd)
+		local sed /usr/bin x=1 $(pwd) 2>/dev/null grep
+"$@" grep 'quoted text' /usr/bin sed test x=1 'quoted text' x=1 readonly readonly
+	export readonly 2>/dev/null awk -eu --verbose $(pwd)
+		--verbose -eu "$1" | "$1" test export $(pwd)
+		2>/dev/null && echo "$1" done local
+-eu echo --verbose "$1" done done --verbose local
+	2>/dev/null grep && cd grep
+"$@" done then | && x=1 readonly 'quoted text' x=1 sed
+	export export --verbose then
+${HOME} $(pwd) 2>/dev/null
+	${HOME} x=1 -eu sed -eu ${HOME}
+	/usr/bin $(pwd) echo x=1 2>/dev/null --verbose
+$(pwd) then readonly echo 2>/dev/null awk readonly awk export readonly
+		'quoted text' $(pwd) test
+readonly 2>/dev/null cd --verbose cd $(pwd) 2>/dev/null
+		echo export | echo && readonly done cd cd "$@" "$@" cd "$@" ${HOME} export
+		cd 2>/dev/null "$@" done awk -eu x=1 $(pwd) export cd sed grep
+	printf --verbose echo 2>/dev/null -eu | --verbose ${HOME}
+local | ${HOME} printf grep --verbose test 2>/dev/null done
+awk test 2>/dev/null
+	x=1 echo cd grep $(pwd) echo printf "$1"
+$(pwd) grep local --verbose grep x=1
+		| grep done "$@" -eu local
+		${HOME} local printf sed 'quoted text' | printf grep awk printf
+		awk then | export --verbose "$@" x=1 "$@" export $(pwd) then echo |
+	grep "$1" echo 'quoted text' --verbose
+		/usr/bin test sed 'quoted text' "$@"
+	printf sed /usr/bin && printf then sed then awk x=1 'quoted text' 2>/dev/null
+${HOME} done x=1 awk --verbose | then
+${HOME} -eu cd && test -eu echo
+		echo --verbose local ${HOME} echo
+/usr/bin export awk ${HOME} 'quoted text' grep sed 2>/dev/null "$1" export
+grep x=1 ${HOME} | local && -eu
+		$(pwd) ${HOME} cd then echo then 2>/dev/null | cd then /usr/bin 2>/dev/null
+then x=1 done | 2>/dev/null $(pwd)
+	'quoted text' | 'quoted text' awk | | local $(pwd) 'quoted text'
+		$(pwd) x=1 sed "$@" awk ${HOME} done sed export ${HOME} echo --verbose -eu cd
+	readonly /usr/bin "$@" echo then done -eu test ${HOME} && cd cd local sed
+		&& && 2>/dev/null then export && readonly 'quoted text'
+/usr/bin 'quoted text' && echo readonly cd ${HOME}
+		x=1 echo grep echo grep grep readonly
+	$(pwd) x=1 'quoted text' && /usr/bin export awk done --verbose | export ${HOME}
+		cd "$1" -eu cd done sed grep awk ${HOME} done /usr/bin 'quoted text'
+awk export $(pwd) x=1 readonly sed -eu local echo
+	'quoted text' "$1" printf readonly readonly sed cd 2>/dev/null local awk && |
+2>/dev/null export "$1" export sed local
+	2>/dev/null test export && printf && local test cd "$@" echo awk
+		grep echo x=1 export export ${HOME} 2>/dev/null
+		--verbose $(pwd) /usr/bin printf printf then then printf
+	sed grep test sed "$@" then 2>/dev/null echo cd test
+cd test awk cd printf && sed 'quoted text' test
+local "$1" /usr/bin export done
+		--verbose export "$1" ${HOME} $(pwd) /usr/bin printf
+		--verbose readonly "$@"
+echo ${HOME} && test $(pwd)
+	x=1 echo && readonly echo printf && printf export --verbose $(pwd)
+	"$@" grep -eu done ${HOME} printf
+		-eu awk 2>/dev/null && awk x=1 test then
+	-eu echo cd sed echo --verbose -eu 'quoted text' sed then readonly
+	--verbose | /usr/bin done test -eu cd /usr/bin then echo "$1" readonly grep 'quoted text'
+echo local export then sed --verbose grep x=1 then "$@"
+		sed --verbose | $(pwd) && echo ${HOME}
+	awk export local $(pwd) readonly export 2>/dev/null sed
+"$1" awk local x=1 /usr/bin local x=1 ${HOME} grep
+	awk | ${HOME} grep awk readonly --verbose done "$1" && 2>/dev/null
+sed ${HOME} -eu then --verbose | 2>/dev/null x=1 grep echo $(pwd)
+		"$@" ${HOME} awk "$1" x=1 sed -eu ${HOME} 'quoted text' sed x=1 /usr/bin 2>/dev/null
+	2>/dev/null x=1 --verbose awk "$1" awk awk readonly export echo awk test x=1
+grep readonly cd readonly echo test $(pwd)
+cd "$1" /usr/bin cd $(pwd) x=1 cd | --verbose $(pwd) done x=1 $(pwd) "$1" $(pwd)
+--verbose done printf cd && "$1" "$@" printf 'quoted text' ${HOME} echo
+	readonly printf local /usr/bin "$@" /usr/bin -eu --verbose sed test "$@"
+		-eu awk grep 2>/dev/null printf 2>/dev/null
+		-eu ${HOME} "$@" "$1" "$@" x=1 then 2>/dev/null local 2>/dev/null test
+		done grep grep export awk readonly | printf
+echo /usr/bin done local grep sed -eu awk awk "$1" local -eu ${HOME} then --verbose
+${HOME} then --verbose awk /usr/bin ${HOME} 'quoted text' done 'quoted text'
+'quoted text' done done "$@" | readonly export 'quoted text' ${HOME} ${HOME}
+done ${HOME} test echo sed "$1" awk && && sed then
+		export awk 2>/dev/null 2>/dev/null local done
+	grep cd /usr/bin export /usr/bin sed ${HOME} x=1 awk then ${HOME}
+"$1" done 2>/dev/null -eu
+		-eu "$@" readonly "$@" $(pwd) && awk 2>/dev/null && | awk local
+$(pwd) grep | | test 'quoted text' "$@" echo test then then readonly
+done 2>/dev/null then /usr/bin -eu
+		sed test then && -eu then cd awk awk x=1 readonly printf 'quoted text'
+2>/dev/null -eu --verbose /usr/bin readonly
+	local test ${HOME} local then grep sed 2>/dev/null -eu grep x=1 awk then
+		export test --verbose /usr/bin grep readonly ${HOME} grep /usr/bin
+		| /usr/bin test grep ${HOME} x=1 /usr/bin x=1 'quoted text' x=1
+	local x=1 printf "$@" cd --verbose --verbose ${HOME}
+	/usr/bin readonly awk export && "$@" /usr/bin printf
+	test sed && /usr/bin "$@" readonly then echo cd
+grep -eu --verbose | printf test "$1" test $(pwd) then
+		x=1 awk | then cd local printf x=1 export ${HOME} export x=1
+'quoted text' then 'quoted text'
+		echo /usr/bin x=1 2>/dev/null
+-eu $(pwd) | x=1 $(pwd) test | -eu "$@" done x=1 done then readonly "$1"
+local && grep 'quoted text' 2>/dev/null then | echo && echo x=1 -eu "$1" $(pwd)
+readonly -eu sed local test "$1" "$1" cd local -eu printf
+	sed && test -eu printf -eu "$@" $(pwd) cd done readonly 2>/dev/null cd 2>/dev/null
+	--verbose echo export --verbose awk grep awk echo printf x=1 /usr/bin
+		--verbose readonly "$1" then then ${HOME} $(pwd) printf 2>/dev/null
+	echo && /usr/bin local printf readonly | then then awk
+		sed then 'quoted text' -eu done "$@" && test local x=1 && done readonly
+	-eu && && then 2>/dev/null test sed 'quoted text' sed cd 2>/dev/null "$@" then
+		"$1" $(pwd) --verbose 2>/dev/null readonly "$1" && "$@" /usr/bin
+printf "$@" /usr/bin cd test "$1" test test then
+	done awk test 'quoted text' -eu "$1" done local sed awk
+		| | 'quoted text' 2>/dev/null 2>/dev/null local --verbose then cd
+	-eu | x=1 printf grep grep
+"$1" --verbose test 2>/dev/null sed sed
+${HOME} $(pwd) echo awk then 2>/dev/null --verbose &&
+		echo $(pwd) $(pwd) "$@" awk then test awk export echo grep
+"$1" done | awk done cd -eu | readonly
+	-eu /usr/bin x=1 cd export 'quoted text' sed
+	-eu "$@" "$1" printf cd then
+	$(pwd) export | sed test && |
+	awk then sed && ${HOME} 2>/dev/null awk -eu then
+readonly $(pwd) | sed cd "$1" cd cd sed "$@" sed
+done "$1" readonly -eu /usr/bin local printf --verbose test export
+	test awk "$1" done cd then printf sed grep ${HOME} | grep "$1" local cd printf
+		local /usr/bin ${HOME} 2>/dev/null test ${HOME} then
+	cd ${HOME} ${HOME} 2>/dev/null && cd ${HOME} 'quoted text'
+	2>/dev/null "$1" | | printf done local
+	awk export --verbose echo -eu x=1 grep "$1" then $(pwd) then done |
+"$1" sed readonly local "$@" x=1 done then
+	-eu grep && awk --verbose export done then 2>/dev/null sed sed echo awk | cd &&
+export sed | "$1" | && | grep export local $(pwd) test && -eu 'quoted text'
+		--verbose && echo /usr/bin && x=1 | 'quoted text' sed "$1" x=1 echo -eu cd done
+		&& && export 'quoted text' printf ${HOME}
+x=1 "$@" "$@" x=1 then "$@" then 'quoted text' x=1 2>/dev/null awk local done
+		test cd && cd then done x=1 sed $(pwd) echo export
+	-eu cd then x=1 then export done "$1" -eu 'quoted text' export export "$1"
+then /usr/bin ${HOME} local export test
+--verbose -eu 2>/dev/null ${HOME} $(pwd) grep
+		x=1 sed | -eu printf -eu -eu
+		echo | "$1" -eu cd grep readonly
+	| done test readonly /usr/bin echo | --verbose
+		readonly && echo | "$1" | readonly "$@" /usr/bin sed test grep readonly 'quoted text'
+		2>/dev/null printf printf sed && export && then local readonly awk local
+		'quoted text' echo && -eu sed awk local $(pwd)
+grep local grep 'quoted text' 2>/dev/null cd printf "$@" local then "$@" 'quoted text'
+&& echo readonly readonly echo sed test awk
+	${HOME} sed cd "$1" | local /usr/bin sed x=1 awk sed echo x=1
+/usr/bin awk -eu sed 'quoted text' 2>/dev/null
+echo /usr/bin done | 2>/dev/null awk local 'quoted text' 2>/dev/null
+		test cd export -eu ${HOME} "$@" | && readonly 2>/dev/null
+		/usr/bin cd | && x=1 test "$@" readonly export local "$@" $(pwd)
+		done /usr/bin readonly then "$@" done -eu grep /usr/bin
+		awk export awk --verbose export /usr/bin printf grep ${HOME} test export
+done printf grep then -eu "$1" echo
+/usr/bin sed -eu grep grep printf test x=1
+$(pwd) 2>/dev/null && "$@" awk local
+	x=1 grep -eu local done 'quoted text' && "$1" cd $(pwd) echo /usr/bin $(pwd)
+	"$@" /usr/bin 'quoted text' local
+		awk $(pwd) awk $(pwd) echo printf done 2>/dev/null
+		local 2>/dev/null 2>/dev/null "$@" ${HOME} "$@" $(pwd)
+	awk 'quoted text' 2>/dev/null then x=1 $(pwd)
+readonly /usr/bin readonly
+		| then local 'quoted text' echo readonly 'quoted text'
+readonly sed "$1" | --verbose test done
+		--verbose | done done local | "$1"
+	done | printf grep echo awk done ${HOME} 2>/dev/null
+	test grep && --verbose "$@" printf local local grep awk "$@" printf
+	readonly local printf grep local $(pwd) --verbose echo awk echo
+printf awk "$@" sed grep echo | sed ${HOME} local -eu && 'quoted text'
+	"$1" && ${HOME} -eu local -eu | awk
+cd ${HOME} awk then test "$1" local local done "$@" export 2>/dev/null export ${HOME}
+		"$@" done test export "$1" test $(pwd) local cd echo
+		export $(pwd) echo 2>/dev/null
+local ${HOME} 'quoted text' sed then readonly | echo "$1"
+		printf x=1 echo readonly "$1" sed "$1" "$1" "$1" &&
+		done then | "$1" readonly sed readonly "$1" export "$@" done -eu
+--verbose /usr/bin sed /usr/bin --verbose grep x=1 --verbose
+"$1" --verbose | -eu "$@" sed 2>/dev/null ${HOME} readonly awk "$@" grep sed awk
+--verbose echo ${HOME} $(pwd) | 'quoted text'
+	local 'quoted text' readonly sed "$@"
+		/usr/bin "$@" readonly | local -eu export test "$@" ${HOME} awk test readonly
+		$(pwd) /usr/bin echo export done cd export "$1" export export | then -eu printf
+		${HOME} 2>/dev/null 'quoted text' 2>/dev/null && 2>/dev/null echo &&
+cd "$1" cd sed awk cd sed grep sed x=1 x=1
+		echo x=1 test grep printf /usr/bin "$1" && printf awk then
+		"$@" x=1 local readonly export
+then local grep sed sed "$@" readonly
+printf sed test echo readonly awk export | readonly printf
+		awk then local 'quoted text' -eu export && 'quoted text' --verbose sed /usr/bin
+	readonly local "$@" done ${HOME} -eu sed ${HOME} $(pwd)
+printf "$1" 'quoted text' readonly $(pwd) done readonly "$@" && done | readonly
+	$(pwd) 'quoted text' export /usr/bin export
+	export printf printf readonly x=1 'quoted text' $(pwd) && "$1" x=1
+	'quoted text' grep | && printf
+echo awk then && ${HOME}
+cd | && ${HOME} printf export export done $(pwd) 'quoted text'
+2>/dev/null "$1" -eu sed 2>/dev/null test awk test sed sed cd | /usr/bin
+		export x=1 export 2>/dev/null printf readonly
+		printf sed 2>/dev/null done local test --verbose
+		$(pwd) ${HOME} /usr/bin printf 2>/dev/null printf grep --verbose $(pwd) | readonly
+	export export $(pwd) x=1 'quoted text' -eu /usr/bin 2>/dev/null export
+		$(pwd) --verbose cd awk -eu printf -eu && 2>/dev/null test x=1 && -eu
+test awk test local grep x=1 local $(pwd)
+		2>/dev/null 2>/dev/null grep ${HOME} "$@" -eu export export
+	${HOME} echo done x=1 awk test local 2>/dev/null
+		| test -eu test && 2>/dev/null ${HOME} |
+		then grep -eu grep /usr/bin then 'quoted text' then cd -eu readonly
+	printf $(pwd) awk printf /usr/bin export 2>/dev/null && ${HOME}
+	then export grep -eu echo ${HOME} $(pwd) local then sed 'quoted text'
+		"$1" | $(pwd) local export $(pwd) ${HOME}
+		then export | then grep --verbose test
+	$(pwd) then done /usr/bin && printf $(pwd) then
+		"$@" -eu local && echo grep
+	sed && 'quoted text' ${HOME} done test /usr/bin 2>/dev/null && echo then 'quoted text'
+	grep x=1 ${HOME} | -eu test echo echo "$1"
+	-eu "$@" awk ${HOME} export sed then
+	export 2>/dev/null grep cd --verbose cd "$@" && $(pwd)
+local 'quoted text' awk "$@" cd sed
+'quoted text' 2>/dev/null awk "$1" -eu sed local --verbose test |
+| readonly export export printf --verbose
+	sed | --verbose awk awk done export cd grep "$1" grep
+		printf grep export cd printf --verbose x=1 ${HOME} test done --verbose
+		done "$1" then 'quoted text' ${HOME} sed /usr/bin done echo export 'quoted text'
+	awk 'quoted text' test "$@" echo awk cd echo awk --verbose
+'quoted text' then echo sed 2>/dev/null printf
+	cd /usr/bin sed --verbose done $(pwd)
+	echo export $(pwd) -eu "$@" cd | 2>/dev/null $(pwd)
+		"$@" "$1" "$1" | then -eu cd printf
+		2>/dev/null "$1" x=1 echo $(pwd) echo "$1" --verbose
+test 'quoted text' -eu printf cd --verbose --verbose echo
+		/usr/bin grep && readonly -eu "$@" echo --verbose
+	| printf test /usr/bin test printf ${HOME} then | then test
+readonly 2>/dev/null -eu /usr/bin && then sed
+		${HOME} 'quoted text' grep "$@" --verbose | "$@" then -eu cd $(pwd) export printf
+	readonly sed --verbose "$@"
+		awk printf && grep export cd readonly /usr/bin
+export printf then awk readonly export done /usr/bin printf
+sed --verbose $(pwd) printf test readonly 'quoted text'
+		printf then local awk done grep && then export -eu && local
+		x=1 2>/dev/null -eu awk done 2>/dev/null -eu readonly --verbose && -eu
+		echo 2>/dev/null x=1 $(pwd) ${HOME} done -eu then
+/usr/bin x=1 local printf
+		sed $(pwd) x=1 x=1 local
+	/usr/bin local $(pwd) $(pwd) x=1 printf -eu then awk "$@" ${HOME} test "$1"
+'quoted text' 2>/dev/null printf x=1 printf 'quoted text' grep $(pwd) printf readonly
+#include c97.sh
+	done && then sed printf sed /usr/bin --verbose
+	--verbose echo x=1 $(pwd) "$1" && 'quoted text' then printf /usr/bin
+		readonly awk -eu && printf printf
+		-eu ${HOME} export "$1" 2>/dev/null -eu done /usr/bin x=1 local sed -eu 2>/dev/null
+x=1 echo test "$@" "$1" 2>/dev/null then ${HOME}
+		| printf $(pwd) /usr/bin 'quoted text' sed --verbose echo done
+		2>/dev/null | awk x=1 sed
+"$@" then local 2>/dev/null local sed /usr/bin "$@"
+		done test echo x=1 "$@" echo --verbose /usr/bin printf
+2>/dev/null 2>/dev/null | "$1"
+	printf awk -eu local local test | echo test export printf
+grep && /usr/bin printf export
+awk "$1" readonly grep
+	done "$@" readonly "$@" grep 2>/dev/null readonly $(pwd) ${HOME} awk
+	sed readonly -eu printf local grep echo
+	| local | readonly $(pwd) then then --verbose "$1"
+	| awk test 2>/dev/null awk printf grep -eu
+		-eu | /usr/bin --verbose "$1" | grep /usr/bin then done grep /usr/bin echo export
+then -eu x=1 local done grep export cd -eu then &&
+	grep cd cd done /usr/bin readonly
+$(pwd) printf local /usr/bin --verbose export
+		printf test sed $(pwd) ${HOME} && "$@" then --verbose
+cd cd /usr/bin "$1" 'quoted text'
+then x=1 export awk printf
+	then export /usr/bin -eu --verbose && -eu local -eu printf $(pwd)
+done grep "$1" echo sed && --verbose $(pwd) echo "$@" ${HOME} awk ${HOME}
+		export test export awk sed --verbose
+		--verbose cd cd local awk --verbose x=1 'quoted text' /usr/bin "$@"
+	export 'quoted text' "$@" readonly /usr/bin 2>/dev/null sed
+	$(pwd) --verbose printf readonly grep 2>/dev/null export awk $(pwd)
+	| && sed 2>/dev/null readonly done cd $(pwd) 2>/dev/null
+		grep $(pwd) printf readonly "$@" -eu --verbose "$@"
+		'quoted text' /usr/bin test readonly readonly | then -eu
+		&& readonly readonly && $(pwd) "$@" then then
+export cd printf readonly then
+		awk ${HOME} test echo cd echo then echo export "$@" grep then cd local
+echo awk done x=1 && test export printf "$@" export "$1" local sed local
+export "$@" cd 2>/dev/null && sed local then local -eu 'quoted text'
+'quoted text' printf 2>/dev/null done 2>/dev/null awk
+		'quoted text' done grep local then
+		&& then awk grep /usr/bin ${HOME} ${HOME}
+	'quoted text' "$1" --verbose $(pwd) -eu test readonly 'quoted text' $(pwd)
+	-eu echo ${HOME} cd x=1 /usr/bin | awk test
+echo 'quoted text' test
+		-eu readonly local | | readonly then
+		cd x=1 then && 2>/dev/null "$@" local -eu then readonly 'quoted text' "$1"
+-eu printf grep local 'quoted text' awk "$@"
+		grep done ${HOME} x=1 --verbose
+		local then cd $(pwd) --verbose 2>/dev/null grep readonly awk "$@" 'quoted text'
+test printf x=1 export -eu
+	${HOME} awk awk --verbose x=1 sed x=1 readonly done
+		'quoted text' test 'quoted text' echo "$@" then "$1" --verbose ${HOME}
+		&& test ${HOME} sed grep local sed "$1" local /usr/bin && | && &&
+		then printf cd export then
+awk local "$1" x=1 "$@" grep test done --verbose ${HOME} echo then cd cd
+&& echo cd x=1 | local /usr/bin grep --verbose then
+	echo --verbose x=1 /usr/bin printf -eu awk ${HOME} x=1 ${HOME} export
+		test ${HOME} "$1" "$@" /usr/bin | && test ${HOME} "$1" test x=1 "$@"
+	2>/dev/null "$1" local x=1 'quoted text' -eu awk awk local
+		--verbose readonly -eu /usr/bin echo echo cd
+then local export awk x=1 --verbose && printf done
+	&& grep sed 2>/dev/null local | && 'quoted text' | x=1 cd
+	&& local readonly --verbose cd --verbose
+	| "$1" sed local "$@" $(pwd) x=1 local x=1 x=1 printf
+		done 2>/dev/null readonly "$@" x=1 then
+echo && test printf then local done -eu printf readonly "$1"
+$(pwd) --verbose test ${HOME} | x=1 then x=1 then readonly printf 'quoted text'
+	export && then echo ${HOME} then export
+then awk echo sed "$1" x=1 x=1 then
+		"$1" echo local | && $(pwd) grep echo echo "$@" 'quoted text' "$1" /usr/bin
+	echo x=1 printf printf readonly
+		local 'quoted text' test x=1 "$1" ${HOME} awk "$1" then
+		2>/dev/null export "$@" --verbose
+	export sed cd && local local 2>/dev/null grep $(pwd) 2>/dev/null ${HOME} -eu
+-eu -eu x=1 && && printf grep
+	export ${HOME} local printf then export "$@" ${HOME}
+	readonly awk done done 'quoted text' && 'quoted text' sed test
+		/usr/bin -eu echo awk printf local then ${HOME} "$@" "$1"
+then "$@" "$1" $(pwd) cd cd export -eu && --verbose --verbose
+	2>/dev/null sed ${HOME} sed test export then sed "$@" grep cd --verbose export
+done 2>/dev/null | -eu 2>/dev/null ${HOME} 2>/dev/null
+		$(pwd) printf test test sed readonly
+		&& --verbose ${HOME} --verbose "$@" | "$1" readonly readonly
+2>/dev/null 2>/dev/null 'quoted text' "$@" cd cd $(pwd) | local local 2>/dev/null
+		grep ${HOME} test sed sed 'quoted text'
+		then "$@" echo -eu printf readonly awk test --verbose "$1" "$1"
+		printf "$1" export cd awk x=1 && | x=1 $(pwd)
+		$(pwd) grep printf readonly test sed "$1" echo "$1" awk
+		sed --verbose | echo 'quoted text' /usr/bin done export then done cd then export
+cd | 2>/dev/null cd $(pwd) test -eu | local
+cd -eu /usr/bin awk ${HOME} grep -eu "$1" printf export then $(pwd) test 'quoted text'
+done grep | | done grep && 'quoted text' "$@" sed then awk | 'quoted text'
+grep awk "$@" /usr/bin test && && |
+echo echo cd /usr/bin /usr/bin
+	${HOME} echo ${HOME} then | --verbose
+/usr/bin -eu echo local -eu awk "$@" /usr/bin
+"$1" ${HOME} | echo "$1" awk test sed
+		cd echo 'quoted text'
+		&& readonly x=1 2>/dev/null 'quoted text' 'quoted text'
+		"$1" echo 2>/dev/null awk
+	"$1" grep cd -eu readonly --verbose export echo done test
+${HOME} readonly echo $(pwd) "$1" test
+test export "$@" --verbose 'quoted text'
+		--verbose ${HOME} $(pwd) test sed x=1 --verbose export
+		cd test printf awk cd awk --verbose
+		local export "$@" printf -eu local /usr/bin 'quoted text' 'quoted text'
+		cd --verbose -eu | -eu "$1" ${HOME} echo "$1" 'quoted text' && printf
+readonly --verbose awk readonly sed readonly | /usr/bin x=1 export |
+		local then awk echo --verbose cd 'quoted text' export &&
+	"$1" done x=1 "$@" readonly
+	&& awk /usr/bin awk readonly -eu "$@" printf "$@"
+	"$@" 2>/dev/null | then then echo -eu export
+	printf x=1 x=1 2>/dev/null | cd printf then -eu export 'quoted text'
+	printf awk "$@" ${HOME} grep grep && --verbose 'quoted text' x=1 "$@" cd
+&& -eu local $(pwd) local grep test x=1
+printf done grep readonly ${HOME} -eu "$@" then cd grep --verbose done 'quoted text'
+2>/dev/null then test export --verbose x=1 ${HOME} | local test test
+		"$@" sed -eu $(pwd) export
+	| then --verbose && awk x=1 2>/dev/null --verbose then printf 2>/dev/null grep
+2>/dev/null local && done cd readonly /usr/bin
+	done awk grep | ${HOME} /usr/bin
+	--verbose x=1 local x=1 "$@"
+		${HOME} 2>/dev/null test -eu | "$@" "$@" "$1" x=1 $(pwd) awk x=1 grep
+&& && 'quoted text' 2>/dev/null export
+	then x=1 "$1" x=1 && | "$@" -eu $(pwd) readonly cd $(pwd) -eu awk printf
+	2>/dev/null echo "$1" printf readonly x=1 -eu --verbose
+	'quoted text' /usr/bin
+	--verbose "$1" readonly $(pwd)
+	done sed ${HOME} export
+	"$@" then awk 2>/dev/null
+		--verbose ${HOME} echo 2>/dev/null done export readonly --verbose "$@"
+then -eu test sed export
+local readonly then $(pwd) local $(pwd) local $(pwd) /usr/bin
+		readonly 2>/dev/null $(pwd) then local | awk && readonly echo /usr/bin awk local
+		${HOME} 'quoted text' x=1 cd
+		| | 'quoted text' x=1 readonly
+	cd readonly local $(pwd) local local local grep ${HOME} printf $(pwd)
+		sed ${HOME} awk 2>/dev/null awk && --verbose awk readonly echo then
+	then && | awk cd local -eu awk /usr/bin
+grep local 'quoted text' -eu grep ${HOME} x=1 | export export
+		x=1 test printf $(pwd) --verbose -eu | $(pwd)
+	printf done local echo "$@" test "$@" sed awk "$1" x=1 2>/dev/null local $(pwd)
+$(pwd) $(pwd) local 2>/dev/null grep $(pwd) grep --verbose
+readonly readonly grep export awk ${HOME} grep --verbose "$@" grep && then x=1
+	--verbose /usr/bin printf "$@" awk sed && awk local &&
+	export $(pwd) local --verbose printf "$@" 'quoted text' cd
+awk && readonly --verbose
+x=1 test done 'quoted text' "$@" 'quoted text' "$@"
+	'quoted text' --verbose readonly grep
+		sed "$1" then 'quoted text' export x=1 readonly
+	/usr/bin done done && echo awk ${HOME} && cd && --verbose
+		/usr/bin done local then x=1 then --verbose cd
+		awk "$1" x=1 test 'quoted text' then $(pwd) done
+sed -eu 'quoted text' echo awk readonly
+	echo x=1 --verbose --verbose done done -eu sed readonly --verbose export
+${HOME} "$1" awk --verbose && done --verbose printf awk $(pwd) | "$@" echo
+	2>/dev/null /usr/bin | "$@" printf echo "$1" echo sed x=1 "$1" cd awk cd export
+awk cd printf local grep && export 'quoted text'
+'quoted text' readonly grep && 2>/dev/null "$1"
+&& 2>/dev/null -eu sed done readonly ${HOME}
+		local "$@" -eu --verbose "$1" 2>/dev/null
+	test cd echo 'quoted text' && readonly "$1" test /usr/bin 'quoted text'
+"$@" | cd done export cd then "$1" 'quoted text' printf x=1
+	${HOME} local /usr/bin then cd /usr/bin --verbose x=1 /usr/bin -eu | 'quoted text'
+	'quoted text' readonly grep done sed x=1 -eu ${HOME}
+	&& --verbose echo 2>/dev/null "$@" x=1 awk
+	then then && grep local --verbose awk then --verbose $(pwd) awk echo cd x=1
+	$(pwd) export x=1 awk printf "$1" 'quoted text'
+done test grep echo | printf x=1 2>/dev/null
+echo 2>/dev/null echo test -eu
+		cd "$1" && $(pwd) x=1 awk -eu $(pwd) printf printf | cd "$1" -eu local
+$(pwd) sed test && local "$1" --verbose
+	'quoted text' sed | sed -eu $(pwd) 'quoted text' 'quoted text'
+		2>/dev/null | $(pwd) readonly export x=1 test printf /usr/bin &&
+	-eu $(pwd) grep --verbose $(pwd) grep 'quoted text' 'quoted text'
+		/usr/bin 'quoted text' sed grep "$@" ${HOME} $(pwd) /usr/bin sed
+		&& test test sed 'quoted text' grep "$@" grep | printf then sed -eu test
+		then cd --verbose grep export grep readonly $(pwd) 2>/dev/null "$@"
+		cd -eu 2>/dev/null $(pwd)
+&& export readonly echo | &&
+		/usr/bin done --verbose 'quoted text' readonly cd test
+&& sed cd 'quoted text'
+cd test /usr/bin awk readonly "$1" $(pwd) printf test -eu |
+&& then /usr/bin --verbose test "$1" 2>/dev/null test ${HOME} echo grep
+		2>/dev/null export /usr/bin "$@" cd done --verbose test "$@"
+		sed -eu echo grep -eu "$1"
+		$(pwd) && done "$1" echo grep test readonly
+	awk -eu export then 'quoted text' grep /usr/bin done echo "$@" test
+		test $(pwd) local done done
+	echo done printf -eu /usr/bin -eu x=1
+	x=1 done "$@" cd local cd test ${HOME} then
+	${HOME} then awk ${HOME} "$1" printf local echo echo
+echo then "$1" -eu ${HOME}
+${HOME} && readonly $(pwd)
+	cd then readonly x=1 $(pwd) readonly ${HOME} $(pwd) --verbose cd
+	x=1 | ${HOME} printf cd /usr/bin
+test /usr/bin | ${HOME} test echo /usr/bin 'quoted text' | cd "$@" $(pwd)
+	${HOME} "$1" -eu | export "$@" "$@"
+	cd $(pwd) done 2>/dev/null export --verbose
+		"$1" -eu /usr/bin 2>/dev/null
+		--verbose readonly ${HOME} cd readonly done $(pwd) export 'quoted text'
+"$@" ${HOME} grep test sed awk
+		$(pwd) -eu ${HOME} $(pwd) x=1 | &&
+	sed printf $(pwd) | "$@" x=1 awk x=1 ${HOME} awk x=1 ${HOME}
+	cd $(pwd) 2>/dev/null $(pwd) test echo awk echo -eu echo
+	grep "$@" && sed -eu $(pwd) 2>/dev/null echo done && 'quoted text'
+--verbose awk 'quoted text' && grep grep awk awk
+export done local echo then readonly then /usr/bin -eu 2>/dev/null $(pwd)
+	sed $(pwd) local -eu awk local
+	test local grep local | printf then cd echo | printf
+		awk /usr/bin && 2>/dev/null ${HOME} --verbose | echo local
+	"$@" 'quoted text' done then cd --verbose sed $(pwd) printf test then
+		local then 2>/dev/null && awk done
+		done x=1 2>/dev/null --verbose sed -eu -eu 2>/dev/null
+local "$@" | grep ${HOME}
+		-eu done | readonly ${HOME} sed printf "$1" -eu $(pwd) 2>/dev/null x=1 -eu
+	printf test test "$@" then /usr/bin 'quoted text'
+	--verbose ${HOME} test grep |
+done --verbose export --verbose then 2>/dev/null && awk readonly
+		awk "$@" readonly && $(pwd) 2>/dev/null
+--verbose sed printf readonly
+		then readonly export awk grep "$@" done --verbose then
+	&& done printf test cd 2>/dev/null /usr/bin -eu --verbose
+awk 'quoted text' -eu export -eu done local "$1"
+		printf $(pwd) x=1 "$@" "$1" echo && -eu
+cd grep readonly export x=1 2>/dev/null awk done
+sed awk done "$1" /usr/bin 2>/dev/null "$@" --verbose
+		'quoted text' sed local printf
+		x=1 $(pwd) && cd 'quoted text'
+		&& "$@" --verbose | && /usr/bin grep 2>/dev/null cd 'quoted text'
+-eu x=1 $(pwd) 'quoted text' cd /usr/bin
+	export sed 'quoted text' 'quoted text' -eu grep echo x=1
+	x=1 test then local "$@"
+	then grep 2>/dev/null cd grep readonly awk sed test ${HOME} 2>/dev/null
+x=1 'quoted text' $(pwd) echo 'quoted text' ${HOME} printf
+		export done x=1 export "$1" awk -eu then awk -eu 2>/dev/null
+export /usr/bin echo export export x=1 test
+		readonly "$1" $(pwd) | "$1" -eu --verbose "$@" printf
+		2>/dev/null 2>/dev/null test export
+sed /usr/bin "$@" ${HOME}
+		| echo printf 2>/dev/null x=1 test
+	"$1" export --verbose awk
+	done local --verbose -eu grep awk export |
+${HOME} "$@" awk "$@" x=1 then echo && sed awk "$1" ${HOME} "$@" done then
+		local awk echo then -eu "$@" ${HOME} 2>/dev/null
+		-eu then x=1 done ${HOME} | $(pwd) echo && /usr/bin ${HOME} /usr/bin
+grep export 2>/dev/null awk grep && done "$1" "$@" 'quoted text' 'quoted text'
+sed $(pwd) printf "$@" sed then done then local test && then x=1 --verbose
+		--verbose x=1 $(pwd) awk ${HOME} && printf grep sed done test
+cd | 'quoted text' x=1 x=1 grep echo test x=1 "$1" 2>/dev/null /usr/bin "$1"
+	awk awk /usr/bin /usr/bin sed echo $(pwd) then -eu | sed printf echo
+cd sed export done cd cd test "$@" readonly local grep | /usr/bin echo |
+"$@" awk --verbose local "$1"
+	2>/dev/null sed done cd -eu local ${HOME} -eu x=1 "$1" done 2>/dev/null $(pwd)
+	echo done grep | ${HOME} && && local ${HOME} x=1 x=1 printf 'quoted text'
+awk done then | /usr/bin then sed 'quoted text' 'quoted text' cd
+	echo /usr/bin 2>/dev/null $(pwd) echo awk echo cd && sed then | grep "$1"
+		export && x=1 printf local -eu test --verbose $(pwd) cd done
+		2>/dev/null "$1" printf
+	then "$@" -eu x=1 2>/dev/null $(pwd) 2>/dev/null /usr/bin
+	local /usr/bin 'quoted text'
+$(pwd) export export cd --verbose done x=1 cd echo echo readonly echo && $(pwd)
+x=1 "$1" | --verbose done -eu sed "$@" x=1 x=1 sed grep done
+		"$1" /usr/bin export /usr/bin &&
+		-eu test "$@" echo test "$1" -eu echo local printf
+readonly echo grep echo $(pwd) grep
+readonly -eu done "$1" "$@" sed done -eu 'quoted text' $(pwd)
+		"$@" x=1 "$@" awk 'quoted text'
+printf awk awk printf echo x=1 awk ${HOME} $(pwd) export -eu /usr/bin /usr/bin
+| then test grep awk 'quoted text' /usr/bin "$@"
+		sed sed test awk grep then ${HOME} --verbose && echo $(pwd) "$1"
+		/usr/bin && /usr/bin && -eu
+	export grep awk --verbose printf
+cd cd local awk 2>/dev/null done ${HOME} echo --verbose
+		awk then cd done 'quoted text' readonly
+	"$1" $(pwd) grep "$@" readonly "$@" test readonly | "$1"
+		sed 2>/dev/null grep /usr/bin "$1" 2>/dev/null awk export
+	2>/dev/null "$@" && --verbose ${HOME} grep done done printf
+| printf --verbose "$1" --verbose
+awk done local export 2>/dev/null local
+	cd x=1 $(pwd) ${HOME} "$@"
+		"$@" echo local grep test cd export export readonly
+sed grep echo local "$@" $(pwd)
+	x=1 --verbose awk x=1 echo cd awk awk $(pwd) | --verbose |
+$(pwd) 'quoted text' $(pwd) echo 'quoted text' "$@" export
+		&& test done $(pwd) "$@" 2>/dev/null x=1 test local -eu &&
+		'quoted text' export | awk 'quoted text' "$1"
+sed /usr/bin readonly | done 'quoted text' x=1 $(pwd)
+	"$1" test sed 2>/dev/null grep then echo then ${HOME} --verbose
+		&& && -eu grep 'quoted text' echo export | --verbose
+	&& && done | export test x=1 -eu done -eu $(pwd)
+'quoted text' done readonly 2>/dev/null
+	done readonly --verbose
+		readonly | $(pwd) done ${HOME} echo awk 2>/dev/null echo export test
+local done test && x=1 awk
+		echo $(pwd) $(pwd) echo cd printf -eu 2>/dev/null "$@" -eu
+test x=1 awk -eu echo cd then -eu local $(pwd) $(pwd) 'quoted text'
+	local test && -eu x=1 local 2>/dev/null local then x=1 printf
+	-eu "$1" -eu cd printf cd x=1 then sed && printf && then sed then then
+local sed x=1 2>/dev/null 2>/dev/null echo 'quoted text'
+		x=1 done echo printf | 'quoted text' then awk --verbose export $(pwd)
+		--verbose echo export awk
+		/usr/bin /usr/bin "$@" && export local test x=1 readonly && ${HOME} export $(pwd)
+		echo local cd cd | x=1 sed ${HOME} printf done
+"$@" readonly cd $(pwd) local echo -eu 'quoted text' printf && 2>/dev/null | grep
+	cd 'quoted text' --verbose sed x=1 test awk | x=1 printf grep | 2>/dev/null
+		sed $(pwd) && | $(pwd) echo then awk grep awk test --verbose | && x=1 &&
+x=1 "$@" 'quoted text' && && readonly
+	then $(pwd) grep 2>/dev/null "$@" ${HOME} -eu
+printf /usr/bin "$@" echo echo -eu $(pwd)
+		export x=1 grep sed export echo cd 'quoted text' $(pwd) && cd
+	awk cd "$1" && && $(pwd) readonly test /usr/bin "$@"
+'quoted text' /usr/bin ${HOME} ${HOME} && then cd local 'quoted text' done
+		"$@" sed export then export export "$@" grep 2>/dev/null
+test $(pwd) /usr/bin --verbose awk test 'quoted text'
+${HOME} && done sed 'quoted text' then grep
+	/usr/bin local /usr/bin local
+		x=1 export 'quoted text' echo --verbose
+	&& awk done && sed 'quoted text' $(pwd) sed x=1
+-eu grep awk readonly | done cd 'quoted text' | echo /usr/bin $(pwd) x=1
+	awk local -eu readonly 2>/dev/null ${HOME}
+	$(pwd) --verbose grep 2>/dev/null && "$@" 2>/dev/null
+	export | 2>/dev/null -eu cd -eu echo export grep then export 'quoted text' "$@"
+cd awk printf -eu && ${HOME} "$@" && $(pwd) cd -eu printf sed local /usr/bin cd
+2>/dev/null then grep /usr/bin -eu && cd sed awk
+then 2>/dev/null local done test && "$@" grep
+local 'quoted text' sed
+	'quoted text' sed echo cd export
+	| awk grep -eu printf local done printf readonly readonly cd printf grep
+		echo 2>/dev/null $(pwd) 'quoted text' cd $(pwd) cd x=1 ${HOME} sed
+x=1 awk -eu 'quoted text' 2>/dev/null $(pwd) awk $(pwd) local -eu "$@"
+	-eu readonly then readonly
+		export "$@" printf sed sed cd awk $(pwd) cd /usr/bin
+	"$@" ${HOME} "$1" 'quoted text' && "$@" done readonly $(pwd) "$1" "$1" -eu local
+		cd /usr/bin export local test done test sed export local then export grep printf
+	-eu cd export grep test && readonly
+printf && then awk cd local | echo done ${HOME}
+		2>/dev/null printf -eu done done done 'quoted text' ${HOME} "$@"
+		then -eu awk sed --verbose 'quoted text' local local && ${HOME}
+x=1 grep 2>/dev/null && && "$@" "$1" x=1 awk 2>/dev/null
+		$(pwd) cd | /usr/bin local local export grep then local
+sed ${HOME} "$1" test
+		done "$1" readonly | then echo /usr/bin ${HOME} local |
+	"$1" "$1" "$1" printf -eu --verbose
+	${HOME} "$@" test readonly readonly $(pwd)
+	grep "$@" sed --verbose printf cd test 'quoted text' x=1 2>/dev/null grep
+		'quoted text' "$@" && printf grep grep ${HOME}
+	"$1" printf export -eu
+		local then 2>/dev/null 'quoted text' sed
+		--verbose local | readonly x=1 x=1 readonly then
+		printf | readonly --verbose 'quoted text'
+	'quoted text' "$@" && && --verbose readonly sed then readonly
+		export | && | then ${HOME} local test test then 2>/dev/null | "$1"
+sed printf printf test sed "$1" 'quoted text'
+local && "$1" sed done export ${HOME} done
+		| local 2>/dev/null local echo $(pwd) then sed grep
+		--verbose awk cd readonly sed then $(pwd) echo printf
+x=1 2>/dev/null /usr/bin then $(pwd) grep --verbose
+	sed && sed | -eu sed then echo 2>/dev/null echo x=1 -eu
+done --verbose x=1 export echo 2>/dev/null /usr/bin 2>/dev/null x=1
+		${HOME} export done | --verbose "$1"
+	done sed test 'quoted text' echo /usr/bin readonly x=1 "$1" x=1 -eu readonly test
+	sed done export readonly sed 'quoted text'
+	cd /usr/bin 2>/dev/null
+| x=1 ${HOME} grep export echo x=1 2>/dev/null
+	x=1 done readonly "$1" $(pwd) "$1" $(pwd) --verbose ${HOME} && printf x=1 -eu
+awk export x=1 printf readonly export sed sed "$@" /usr/bin test printf readonly
+done echo -eu sed test printf -eu local
+		echo /usr/bin grep x=1 $(pwd) "$1" export awk echo readonly
+		2>/dev/null then printf export 'quoted text'
+${HOME} sed $(pwd) cd /usr/bin grep cd 2>/dev/null then --verbose export
+	then /usr/bin "$@" | --verbose "$@"
+	sed $(pwd) printf 'quoted text' -eu "$1" test then test cd
+		/usr/bin printf echo 2>/dev/null done
+	&& cd /usr/bin /usr/bin done cd
+	--verbose done printf export export && 2>/dev/null grep -eu sed &&
+		x=1 'quoted text' 'quoted text' -eu export echo then ${HOME} local "$@"
+	/usr/bin local "$1" && && /usr/bin
+		&& readonly then local $(pwd)
+	grep grep then "$@" awk && 2>/dev/null "$@" "$1"
+	awk ${HOME} "$1" /usr/bin 2>/dev/null
+	printf local awk && awk 'quoted text' local local echo /usr/bin "$1"
+"$@" x=1 sed readonly grep x=1
+test local "$1" ${HOME} ${HOME} ${HOME} printf export local printf sed | ${HOME}
+'quoted text' grep $(pwd) "$1" awk printf
+sed sed test grep awk local test $(pwd) "$1" local "$1" grep done $(pwd) readonly
+	| ${HOME} sed -eu echo awk awk cd 'quoted text'
+		printf && 'quoted text' $(pwd) ${HOME} 2>/dev/null test awk export test printf
+		grep grep done -eu ${HOME} $(pwd) local echo then awk x=1 test echo
+printf grep grep test x=1
+	/usr/bin --verbose x=1 $(pwd) | then local
+		printf local printf 'quoted text'
+local grep done export --verbose "$1"
+	&& && echo 'quoted text' echo
+export 2>/dev/null x=1 /usr/bin readonly sed "$@"
+sed && grep export "$@" && $(pwd) "$1" local
+	export --verbose x=1 readonly "$1" ${HOME}
+${HOME} readonly "$1" echo 'quoted text' && echo grep
+	&& test cd && ${HOME} done ${HOME} printf /usr/bin 'quoted text'
+&& x=1 --verbose echo --verbose &&
+		-eu echo 'quoted text' export local "$@" -eu
+		/usr/bin readonly done "$1" -eu grep grep -eu 2>/dev/null
+	grep /usr/bin local cd x=1 cd 'quoted text' export
+	printf printf awk awk x=1 done "$1" cd --verbose
+	$(pwd) && 'quoted text' $(pwd) "$1" readonly
+	export grep ${HOME} local then done sed 2>/dev/null readonly ${HOME} local
+	test then -eu 2>/dev/null then /usr/bin | | 2>/dev/null grep && printf
+readonly cd cd printf 'quoted text' 'quoted text'
+		$(pwd) --verbose test then echo awk
+	echo sed grep -eu 2>/dev/null readonly printf --verbose x=1
+		| readonly -eu grep $(pwd) ${HOME} --verbose printf done test 'quoted text'
+		2>/dev/null then printf export local done echo sed
+test --verbose 'quoted text' test then -eu "$@" test readonly | echo
+"$@" awk readonly done readonly "$1" grep
+		readonly $(pwd) && 2>/dev/null && 'quoted text'
+	"$@" /usr/bin then 'quoted text'
+	${HOME} $(pwd) -eu x=1 test done then
+	awk awk 'quoted text' -eu grep sed printf /usr/bin awk 2>/dev/null
+		${HOME} readonly "$1" awk -eu export then
+	done test export $(pwd) printf $(pwd) cd -eu "$@" printf
+/usr/bin cd && cd cd /usr/bin
+		cd local x=1 cd printf 2>/dev/null $(pwd) readonly "$1" export then awk
+		then printf done printf local /usr/bin $(pwd) "$@" | printf export
+		readonly | echo local sed grep grep local "$1" export sed echo
+	sed echo then local "$@" awk sed x=1
+then readonly local -eu grep export 2>/dev/null "$1" cd x=1 cd $(pwd)
+	&& printf 2>/dev/null 'quoted text' grep readonly printf
+awk 'quoted text' 2>/dev/null 'quoted text' 'quoted text' 2>/dev/null
+	-eu grep && 'quoted text' "$1" 2>/dev/null
+test "$@" && "$@" 2>/dev/null && "$1" echo --verbose
+"$@" awk sed "$1" local /usr/bin echo --verbose "$1" printf sed cd --verbose
+		${HOME} local cd cd sed
+	${HOME} "$1" cd test then "$1" awk $(pwd) test /usr/bin then 'quoted text'
+	sed && x=1 "$@" 2>/dev/null awk done done ${HOME} $(pwd) echo
+		then then sed export 'quoted text' printf export |
+	local test test echo --verbose
+	then printf cd "$@" grep 2>/dev/null /usr/bin
+		echo ${HOME} done "$@" 2>/dev/null export -eu export
+	readonly --verbose test echo
+		sed done sed then export --verbose "$1" printf readonly && sed -eu echo | -eu
+		then grep local "$1" printf sed local 2>/dev/null echo printf export test
+readonly test awk ${HOME} done ${HOME} | done -eu then x=1 grep
+	&& cd printf $(pwd) 2>/dev/null then echo /usr/bin
+| printf x=1 local | 2>/dev/null grep readonly echo x=1 "$1" 2>/dev/null then /usr/bin
+"$1" printf readonly test local local -eu cd | && ${HOME} "$@" export test then
+		"$1" done && ${HOME} ${HOME} test cd ${HOME}
+	'quoted text' | then 2>/dev/null /usr/bin | -eu then
+		/usr/bin x=1 local readonly then printf echo
+		/usr/bin awk "$1" | local "$@" && grep then "$@" | export test cd printf grep
+	$(pwd) && local done test
+	2>/dev/null && ${HOME} readonly "$1" --verbose /usr/bin grep echo ${HOME}
+$(pwd) ${HOME} | $(pwd) 2>/dev/null echo "$@" printf
+${HOME} sed --verbose "$@" --verbose && ${HOME} "$@" | -eu printf /usr/bin
+	local then readonly -eu readonly sed 'quoted text' export "$1"
+	-eu cd sed echo /usr/bin $(pwd) test sed --verbose -eu
+	echo --verbose export
+		test "$@" --verbose then grep test done export test grep readonly
+echo "$1" cd local readonly /usr/bin export cd echo x=1 echo
+printf "$1" | done --verbose && 'quoted text' grep /usr/bin local then
+		sed -eu -eu test awk printf done --verbose awk | -eu
+"$@" | | 2>/dev/null then 'quoted text' awk --verbose sed x=1 ${HOME}
+		readonly | "$@" done && grep
+	local && test 2>/dev/null cd export
+	done grep 'quoted text' readonly readonly echo
+		test -eu "$1" readonly local
+	grep 'quoted text' cd export ${HOME} x=1 grep sed printf printf readonly
+	-eu ${HOME} -eu | readonly 2>/dev/null
+	export printf local "$1" ${HOME} export --verbose
+		then ${HOME} $(pwd) printf then cd -eu done /usr/bin
+grep 'quoted text' ${HOME} printf local "$1" printf | &&
+${HOME} then export cd $(pwd) | then ${HOME} then ${HOME} sed awk /usr/bin
+	-eu -eu test "$@" /usr/bin
+		| test && awk test x=1 | /usr/bin 2>/dev/null x=1 echo
+	/usr/bin echo "$@" echo done && ${HOME} sed export
+		cd | --verbose "$1" test 'quoted text' /usr/bin
+printf local "$@" 2>/dev/null
+x=1 "$@" "$1" readonly local readonly 2>/dev/null "$@" /usr/bin then ${HOME}
+	${HOME} "$@" awk cd "$@" export local local --verbose $(pwd)
+		/usr/bin "$1" sed readonly test ${HOME} | echo readonly cd ${HOME}
+cd test printf local readonly grep x=1 x=1 sed 'quoted text'
+		sed x=1 grep "$@" awk echo $(pwd)
+	"$@" awk echo printf awk done | readonly done readonly | sed sed | | test local
+		--verbose "$1" "$1" sed test
+export echo done then sed then && "$@" local then x=1 | awk
+sed "$1" grep ${HOME} printf x=1 2>/dev/null cd
+		&& echo readonly -eu echo test grep readonly
+		then "$1" $(pwd) test grep | /usr/bin echo local --verbose
+		| sed "$@" grep then done printf sed
+		/usr/bin $(pwd) awk && cd awk echo && awk cd $(pwd) ${HOME} test local
+export | | --verbose awk 2>/dev/null
+readonly && --verbose awk x=1 readonly sed --verbose export done &&
+x=1 export 2>/dev/null
+		| /usr/bin x=1 printf grep &&
+		grep grep "$1" export readonly && 2>/dev/null
+		/usr/bin printf $(pwd) | then then printf export /usr/bin awk && awk cd "$1"
+		awk sed sed local done
+		x=1 x=1 x=1 awk cd printf
+		grep -eu sed grep then ${HOME} x=1 awk | cd $(pwd) grep local
+export test local readonly ${HOME} && test
+	${HOME} readonly then -eu | "$1" --verbose
+	done --verbose readonly "$1" grep $(pwd)
+done $(pwd) awk test then local -eu 2>/dev/null
+		done local cd grep printf ${HOME} cd -eu cd $(pwd) grep "$@" 2>/dev/null
+	x=1 done echo done done printf then --verbose grep /usr/bin
+		done awk export sed | ${HOME} "$@" 'quoted text' sed readonly
+		"$@" x=1 /usr/bin then --verbose awk
+	-eu /usr/bin echo grep printf
+		&& awk 2>/dev/null local test -eu
+	2>/dev/null /usr/bin readonly x=1 printf then export
+--verbose "$1" "$@" "$@" "$1" readonly readonly -eu cd grep
+	sed cd done local 'quoted text' /usr/bin 2>/dev/null --verbose
+		| 'quoted text' printf local
+		sed $(pwd) export "$@" "$1" "$1" $(pwd) local then
+local export done sed readonly "$@" then cd sed
+		x=1 --verbose test echo 2>/dev/null -eu "$@"
+	readonly echo readonly echo export
+cd export "$1" echo x=1 echo -eu grep done
+readonly | --verbose 'quoted text' local
+		${HOME} printf 'quoted text'
+		${HOME} cd cd "$@" /usr/bin "$1" printf echo then --verbose | -eu "$1"
+		/usr/bin local then "$1" awk export readonly test test "$@" -eu && /usr/bin
+-eu 'quoted text' printf test "$@" --verbose
+		readonly echo then sed x=1 grep awk 'quoted text' 2>/dev/null
+		-eu then | export /usr/bin local local cd -eu 'quoted text' 2>/dev/null /usr/bin
+test /usr/bin printf "$1" -eu "$@" grep x=1 printf
+		printf grep printf $(pwd) grep
+	&& $(pwd) ${HOME} /usr/bin printf printf /usr/bin && --verbose
+	test ${HOME} export local then ${HOME}
+		'quoted text' echo ${HOME} "$@" /usr/bin then $(pwd) awk grep && local export
+	| cd --verbose | cd echo ${HOME} $(pwd) echo printf printf test readonly
+	"$@" export && done echo /usr/bin 'quoted text' /usr/bin echo readonly
+	'quoted text' awk 2>/dev/null --verbose
+echo grep $(pwd) && -eu && -eu test cd |
+	done -eu readonly sed | ${HOME} test then ${HOME} "$@" /usr/bin "$@" awk
+		&& grep sed $(pwd) && /usr/bin "$@" done
+	| 'quoted text' | readonly
+		done export x=1 sed awk $(pwd) /usr/bin then local local cd export
+${HOME} 2>/dev/null sed printf
+${HOME} readonly printf then --verbose 2>/dev/null
+sed | "$1" export then printf && && 2>/dev/null echo then
+$(pwd) done grep 2>/dev/null test
+		sed | "$1" | 2>/dev/null readonly
+$(pwd) readonly && ${HOME} done
+&& 'quoted text' readonly
+/usr/bin ${HOME} test cd test --verbose
+printf /usr/bin printf grep local "$1" | x=1
+		local awk | local 2>/dev/null awk
+	--verbose test -eu 2>/dev/null "$1" ${HOME} then test cd
+awk --verbose -eu echo && grep cd readonly /usr/bin sed then cd "$@" | sed | --verbose
+	echo export awk local echo -eu "$1"
+	$(pwd) then printf 2>/dev/null 2>/dev/null awk --verbose -eu --verbose ${HOME}
+	'quoted text' | done cd ${HOME} ${HOME} readonly "$1" export echo && done | awk
+--verbose cd done "$@" done ${HOME} sed 'quoted text'
+sed sed $(pwd) done cd 'quoted text' local grep
+		cd awk sed "$1" && && sed 'quoted text' then $(pwd) ${HOME} grep
+		grep && local then sed "$@" local cd local /usr/bin 'quoted text'
+| done local ${HOME} printf "$@" done "$@" "$@" /usr/bin cd 'quoted text' then sed
+		--verbose sed local x=1 2>/dev/null grep cd local
+		printf /usr/bin -eu local cd awk
+	"$1" then $(pwd) grep -eu && then readonly test echo cd "$@" /usr/bin ${HOME}
+		$(pwd) "$@" "$1" "$1" | && "$1"
+done ${HOME} x=1 ${HOME} x=1 | printf then "$@" && grep readonly | cd echo -eu
+	"$@" awk test --verbose grep echo /usr/bin
+"$1" readonly awk awk printf /usr/bin "$1" test echo
+'quoted text' readonly "$@" "$@" "$1" test "$1" test test echo
+	$(pwd) echo sed 2>/dev/null then then
+	-eu sed -eu --verbose -eu 'quoted text'
+	export ${HOME} /usr/bin "$1" export $(pwd) | export -eu x=1 2>/dev/null $(pwd) 2>/dev/null
+		| done done local test 2>/dev/null
+		local "$@" printf $(pwd) export cd 'quoted text' export /usr/bin sed
+	"$1" export local then printf "$@"
+${HOME} cd x=1 -eu test ${HOME} 2>/dev/null ${HOME} 'quoted text' "$@" &&
+		awk x=1 'quoted text' export
+		awk export "$@" printf test cd "$@" test readonly
+	${HOME} ${HOME} export --verbose 'quoted text' printf local --verbose -eu
+	--verbose readonly grep sed export
+	local ${HOME} $(pwd) grep export "$@" echo printf grep
+local 2>/dev/null | x=1
+		done test test cd && awk /usr/bin | -eu grep grep | 2>/dev/null | ${HOME} export
+x=1 cd 2>/dev/null --verbose printf grep ${HOME} 'quoted text'
+		-eu grep done export /usr/bin $(pwd) test ${HOME} sed sed "$@" test awk "$1"
+	cd readonly ${HOME} 2>/dev/null echo $(pwd) -eu printf awk then $(pwd) local export
+		awk done export && ${HOME} --verbose export $(pwd) --verbose sed awk test x=1
+x=1 /usr/bin cd | cd $(pwd)
+	readonly export local test /usr/bin
+grep export && test "$1" ${HOME} 'quoted text'
+		x=1 -eu "$@" x=1 "$1" 2>/dev/null $(pwd)
+	grep 2>/dev/null test awk
+/usr/bin && ${HOME} ${HOME} grep test $(pwd) test /usr/bin
+		"$@" echo printf sed cd ${HOME}
+		--verbose -eu $(pwd) 2>/dev/null
+		${HOME} x=1 sed echo readonly
+	export 'quoted text' grep awk printf --verbose
+"$1" ${HOME} -eu then awk ${HOME} printf "$@" && | "$@" sed 'quoted text' &&
+		${HOME} grep $(pwd) readonly echo cd
+sed done echo done then printf test then cd /usr/bin readonly done
+done then echo awk export sed done 'quoted text'
+then sed cd done /usr/bin | "$1"
+		test | --verbose "$@" x=1 printf -eu echo test -eu then x=1 'quoted text'
+		&& then then cd && 'quoted text' | grep
+		"$@" local --verbose | local "$@" ${HOME} | "$@"
+	'quoted text' /usr/bin | then ${HOME} then test -eu | grep readonly --verbose
+	| cd | export local grep cd awk -eu x=1 echo
+	local 'quoted text' "$@" 2>/dev/null done echo cd local echo local --verbose
+		&& echo test done cd x=1 export --verbose --verbose /usr/bin test ${HOME}
+then echo | 2>/dev/null done grep export 'quoted text'
+readonly $(pwd) "$@" printf $(pwd) "$1"
+	x=1 /usr/bin test ${HOME} /usr/bin export /usr/bin done "$@" --verbose
+	done && echo done cd "$1" echo x=1 'quoted text' | cd -eu ${HOME}
+	-eu then echo sed export 'quoted text' echo
+	x=1 echo x=1 export "$@" ${HOME} --verbose
+		local then readonly then printf cd 'quoted text' test
+		x=1 grep then grep 'quoted text' /usr/bin printf cd && ${HOME} x=1 --verbose
+	readonly sed x=1 x=1 cd ${HOME}
+	test --verbose readonly 'quoted text' grep x=1
+grep readonly | test --verbose -eu local done test
+	then readonly 'quoted text' echo local --verbose -eu "$1" printf ${HOME}
+	&& readonly -eu /usr/bin sed echo grep "$1"
+	export -eu "$1" echo awk
+awk && "$1" export --verbose
+	-eu -eu cd export printf echo test local $(pwd) sed 2>/dev/null x=1
+then echo local /usr/bin readonly $(pwd) "$@" printf ${HOME} export awk 2>/dev/null
+	/usr/bin sed "$@" 2>/dev/null done then sed awk local
+		${HOME} then echo echo echo readonly awk printf local printf done -eu /usr/bin
+		grep -eu ${HOME} local
+	export export local "$1"
+--verbose sed readonly readonly
+		sed echo ${HOME} x=1 then -eu ${HOME} echo "$@" export -eu "$1" test
+'quoted text' /usr/bin "$@" local printf
+	${HOME} /usr/bin readonly x=1 printf grep printf && sed ${HOME} local
+		then test 2>/dev/null ${HOME} -eu awk
+		sed printf 2>/dev/null grep -eu $(pwd) printf x=1 then x=1 "$@"
+test --verbose --verbose | $(pwd) printf 2>/dev/null
+	cd | "$@" then -eu export 'quoted text' local
+	export cd $(pwd) then sed
+2>/dev/null 'quoted text' $(pwd) --verbose cd echo awk done printf -eu && x=1
+		2>/dev/null $(pwd) 'quoted text' grep && | ${HOME} $(pwd) 'quoted text'
+'quoted text' /usr/bin | grep 2>/dev/null awk grep 2>/dev/null export x=1
+	"$@" -eu echo && ${HOME} 'quoted text' printf && sed done
+export "$1" "$@" awk export export done cd export "$1" then
+"$@" $(pwd) echo then done "$1" echo "$1" printf
+"$1" x=1 | cd export /usr/bin | -eu
+	&& test "$@" $(pwd) local -eu grep x=1 awk echo echo echo grep && $(pwd) local
+	grep | -eu printf && sed then /usr/bin test then
+'quoted text' echo local done awk then x=1 'quoted text' cd grep
+		-eu "$@" cd export /usr/bin
+	done awk cd readonly export "$@" 'quoted text' ${HOME} | x=1 $(pwd)
+	$(pwd) && --verbose &&
+		export $(pwd) "$1" done "$1" $(pwd) grep "$@" test $(pwd) "$1" $(pwd) $(pwd) $(pwd)
+	x=1 -eu 2>/dev/null echo cd ${HOME} "$@" then cd readonly export --verbose export
+	-eu export readonly awk printf grep echo /usr/bin export local x=1 2>/dev/null
+		grep then --verbose x=1 printf grep
+cd printf 2>/dev/null 2>/dev/null ${HOME}
+| --verbose echo cd "$1" && $(pwd) printf readonly export "$@" "$@" echo
+/usr/bin cd ${HOME} 2>/dev/null -eu printf x=1 --verbose cd "$1"
+then sed 'quoted text' | export --verbose
+		test sed 'quoted text' test -eu export grep printf readonly
+readonly printf /usr/bin
+		--verbose grep then readonly "$@" readonly
+	2>/dev/null done sed 'quoted text' | echo echo export "$1" test local
+		| done test local && x=1 x=1 "$1" local cd "$@"
+	export local test ${HOME}
+then grep sed done $(pwd) --verbose readonly
+		| cd then $(pwd) "$@" 'quoted text'
+	sed --verbose local done done export 'quoted text'
+		export sed awk sed echo cd readonly ${HOME} ${HOME} done printf
+cd local -eu "$@" $(pwd) then 2>/dev/null $(pwd) -eu grep -eu "$1" test grep 'quoted text'
+	2>/dev/null ${HOME} --verbose printf done
+	local printf | 'quoted text' readonly
+		"$@" /usr/bin "$1" -eu --verbose
+	awk readonly "$1" /usr/bin then 'quoted text' "$@" grep && ${HOME} test
+		$(pwd) printf cd /usr/bin
+'quoted text' sed && -eu awk "$1" awk local
+		local -eu --verbose -eu $(pwd) ${HOME} local "$1"
+		local printf sed local "$@" export echo printf sed grep
+	echo awk ${HOME} 'quoted text' /usr/bin "$@" then readonly x=1 echo done then
+		awk printf awk && grep | --verbose $(pwd) export x=1 test awk local
+		"$1" awk test 2>/dev/null
+then cd 2>/dev/null "$1" echo x=1
+		-eu done /usr/bin grep local 'quoted text'
+	echo /usr/bin 2>/dev/null ${HOME} readonly "$1" readonly echo && $(pwd)
+cd "$@" then $(pwd) sed /usr/bin
+	done readonly /usr/bin done printf -eu -eu cd awk 'quoted text' then echo
+	cd local -eu ${HOME} $(pwd) "$@" printf cd readonly then awk "$1" grep --verbose
+grep grep | 2>/dev/null done cd sed 2>/dev/null "$@"
+		-eu 'quoted text' ${HOME} && x=1 local cd echo $(pwd)
+	x=1 export 2>/dev/null echo 'quoted text' grep cd readonly
+		"$@" local sed awk printf test grep
+export then printf then local /usr/bin
+then export grep awk cd $(pwd) && && cd test
+	'quoted text' "$1" | done sed local "$1" readonly | "$1" -eu 'quoted text'
+readonly $(pwd) then && "$@" 'quoted text' cd 'quoted text' x=1 ${HOME} export
+	test grep readonly x=1 -eu
+		"$@" | ${HOME} done readonly 'quoted text'
+${HOME} echo echo export /usr/bin ${HOME} readonly x=1 2>/dev/null cd
+	&& readonly 'quoted text' export readonly export then
+		cd sed "$@" then x=1 printf ${HOME} echo cd test then --verbose "$@"
+	sed done "$@" "$1" sed --verbose x=1 "$1"
+$(pwd) && $(pwd) 2>/dev/null ${HOME} "$1" grep printf /usr/bin ${HOME} /usr/bin
+	"$@" ${HOME} 2>/dev/null x=1 sed local echo readonly echo
+	readonly local awk export x=1 'quoted text' && test
+$(pwd) 2>/dev/null export --verbose then
+	printf x=1 'quoted text' --verbose local done && cd $(pwd) $(pwd) --verbose
+	| done printf 2>/dev/null done /usr/bin awk grep "$1"
+		${HOME} done export /usr/bin 2>/dev/null
+	test 'quoted text' echo test grep
+	2>/dev/null "$1" x=1 done readonly
+-eu "$1" "$@" 2>/dev/null test readonly | -eu "$1" cd awk
+		${HOME} cd $(pwd) then done && then then && x=1 readonly grep
+	grep $(pwd) test -eu local grep "$@" grep readonly then sed "$1"
+		"$@" export | --verbose
+export && local test readonly local && "$@"
+	&& then 'quoted text' "$@" echo --verbose "$1" test "$1" done readonly
+		"$1" readonly test --verbose
+	echo --verbose && && && cd -eu awk /usr/bin
+		readonly local then cd /usr/bin && --verbose then 'quoted text'
+		-eu readonly -eu cd awk awk export x=1 printf "$@" --verbose
+		x=1 /usr/bin export /usr/bin --verbose then x=1 readonly local sed ${HOME}
+grep 'quoted text' awk 'quoted text' done
+local | sed --verbose "$@" x=1 'quoted text'
+$(pwd) -eu x=1 ${HOME} awk
+	${HOME} printf cd /usr/bin done "$1" |
+		export export 2>/dev/null /usr/bin | then awk "$@" local printf $(pwd)
+cd printf readonly local && "$@" sed ${HOME} local done local /usr/bin
+cd "$1" /usr/bin grep export $(pwd) 'quoted text' -eu sed
+/usr/bin readonly --verbose done readonly awk -eu /usr/bin sed printf /usr/bin
+	then -eu ${HOME} test 'quoted text' 2>/dev/null grep "$@" echo "$@" echo test
+done echo echo "$1" cd && x=1 && then
+	readonly ${HOME} then x=1 echo 'quoted text'
+		| "$1" "$1" export -eu $(pwd) echo awk export readonly
+	grep export readonly export sed sed awk readonly
+		&& grep /usr/bin 'quoted text' grep
+local echo "$1" "$1"
+		cd cd awk then awk "$@" "$1" grep
+echo done readonly x=1 echo readonly 'quoted text' $(pwd) local 2>/dev/null
+		local readonly ${HOME} awk cd awk awk | "$1" readonly
+	$(pwd) && awk x=1 $(pwd) awk "$1" "$1" ${HOME} local readonly local
+	&& "$1" "$1" --verbose then --verbose -eu awk -eu grep grep $(pwd)
+	awk "$@" -eu grep cd grep cd $(pwd) readonly local test done
+	/usr/bin awk /usr/bin "$1" grep && $(pwd) 'quoted text'
+		x=1 test sed cd sed test -eu ${HOME} x=1 "$1" test cd $(pwd) local readonly
+${HOME} -eu /usr/bin local -eu printf
+	cd sed cd sed -eu cd "$1" cd 2>/dev/null readonly grep then
+	done test "$1" test grep ${HOME}
+		$(pwd) local done sed 'quoted text'
+		awk grep $(pwd) $(pwd) 2>/dev/null test cd --verbose export x=1 -eu
+		2>/dev/null grep x=1 then "$@" --verbose readonly then --verbose readonly
+	readonly $(pwd) awk | --verbose && sed export
+printf echo "$@" | export
+	"$@" /usr/bin export && export cd "$1"
+		$(pwd) grep grep echo "$@" && $(pwd) grep
+	grep done grep export $(pwd) /usr/bin
+"$@" readonly printf --verbose awk --verbose x=1 local $(pwd)
+&& ${HOME} 'quoted text' cd awk
+	awk cd "$@" --verbose ${HOME} 'quoted text' then awk test then awk cd awk awk test
+	export -eu local printf printf readonly x=1 export -eu echo "$@"
+		test "$@" local -eu printf "$1" /usr/bin --verbose 2>/dev/null
+	&& local x=1 "$@" && $(pwd) 2>/dev/null --verbose "$@" then sed grep
+		'quoted text' "$@" /usr/bin 'quoted text' done 'quoted text' &&
+		--verbose 'quoted text' "$1" awk echo export printf done then
+printf grep done cd echo x=1
+	grep | -eu done 2>/dev/null 2>/dev/null cd "$@" printf export 2>/dev/null -eu
+		"$1" export awk cd test --verbose && printf 'quoted text' awk ${HOME}
+		then "$@" "$@" awk test done 'quoted text'
+-eu --verbose --verbose test && "$@" awk
+		cd local grep printf && printf then awk then export then 'quoted text'
+	"$@" x=1 2>/dev/null -eu local ${HOME} "$1" && done "$@" echo awk
+--verbose $(pwd) x=1 'quoted text' --verbose | sed echo test done /usr/bin $(pwd)
+		readonly 2>/dev/null /usr/bin /usr/bin
+		local ${HOME} && done -eu --verbose ${HOME} grep printf cd |
+		sed sed test $(pwd) done done x=1
+/usr/bin -eu /usr/bin x=1 then echo x=1 printf
+"$1" "$1" "$1" 2>/dev/null ${HOME} printf | 'quoted text'
+		-eu 'quoted text' "$@" then "$1" awk "$1" ${HOME} "$1" 2>/dev/null
+| cd printf local /usr/bin
+	2>/dev/null echo done
+done "$1" awk $(pwd) --verbose 'quoted text' x=1 local readonly 2>/dev/null
+		&& "$@" then awk $(pwd) grep "$@" ${HOME} sed "$1" grep --verbose done x=1 then
+	"$@" ${HOME} cd cd readonly x=1 grep cd test awk export
+"$@" sed awk ${HOME} printf "$1" grep "$1" sed /usr/bin "$1"
+		test then --verbose export sed
+	echo "$@" awk sed echo
+readonly readonly test 'quoted text' awk
+		echo && 2>/dev/null readonly printf && 2>/dev/null -eu readonly grep "$1" readonly
+	export readonly | "$@" sed readonly
+'quoted text' then readonly echo
+		--verbose | then "$1" 'quoted text'
+sed && readonly sed 'quoted text'
+	${HOME} && && printf 2>/dev/null ${HOME}
+awk export printf | 'quoted text' export sed
+local -eu 'quoted text' $(pwd) grep export test printf done ${HOME}
+	cd "$@" then 2>/dev/null ${HOME}
+		"$@" local 2>/dev/null
+		readonly local test test && sed grep | -eu readonly awk
+	local --verbose "$@" && "$@" readonly sed | 'quoted text' awk "$1" test ${HOME}
+| cd then then then $(pwd)
+$(pwd) cd export echo readonly /usr/bin awk printf local && /usr/bin sed
+		echo printf ${HOME} cd local 2>/dev/null -eu
+test export "$@" test readonly readonly /usr/bin export test
+$(pwd) ${HOME} -eu sed sed echo ${HOME} export /usr/bin export --verbose
+		${HOME} sed printf "$1" --verbose local --verbose grep -eu echo -eu ${HOME}
+| && "$@" cd awk then local
+		| | x=1 readonly test | /usr/bin done local x=1 "$1" readonly 'quoted text'
+		readonly done x=1 grep
+	then "$@" -eu --verbose done x=1 cd
+	readonly x=1 /usr/bin -eu --verbose grep echo echo awk test -eu ${HOME} -eu /usr/bin
+&& x=1 $(pwd) awk "$1" --verbose sed
+		-eu local $(pwd) grep printf
+	&& awk $(pwd) grep sed x=1 grep "$1" $(pwd)
+	local | | "$@" /usr/bin local
+	done "$@" echo export export "$@" 'quoted text'
+		--verbose export test -eu /usr/bin $(pwd) then sed 2>/dev/null &&
+	cd awk grep -eu printf then test /usr/bin export | echo grep --verbose
+	done "$1" awk -eu cd cd 2>/dev/null $(pwd)
+		printf done cd x=1 &&
+		$(pwd) 'quoted text' printf
+		echo "$@" readonly -eu sed cd && x=1 ${HOME} readonly $(pwd) ${HOME} x=1
+	then 'quoted text' printf printf
+	'quoted text' "$@" 'quoted text' --verbose | printf
+		echo "$@" $(pwd) done | printf ${HOME} then
+	x=1 local awk "$@" --verbose $(pwd) grep ${HOME} sed sed 2>/dev/null then --verbose
+		local export $(pwd) test then ${HOME} done "$1" x=1 $(pwd)
+grep done grep printf --verbose ${HOME} echo
+		printf export then sed && grep "$1" then
+readonly 'quoted text' $(pwd)
+then ${HOME} 'quoted text' && && cd "$@" | ${HOME}
+	grep printf 2>/dev/null awk export 'quoted text' readonly
+	--verbose --verbose | ${HOME} && grep "$1" echo --verbose
+"$@" cd --verbose test | awk $(pwd) printf done --verbose grep /usr/bin
+		cd readonly | x=1 then
+local sed awk awk grep local | "$1" && "$@" --verbose
+		${HOME} "$1" echo printf printf grep /usr/bin ${HOME} | "$@" test printf grep
+		"$1" local done "$@" local printf awk && local grep --verbose
+export done x=1 done 'quoted text'
+	'quoted text' 2>/dev/null export $(pwd) readonly x=1 readonly -eu printf && | echo
+"$@" 'quoted text' echo export --verbose done echo "$@" /usr/bin
+&& done done done local then && done "$1" -eu /usr/bin 2>/dev/null cd local echo
+		&& -eu /usr/bin local local readonly
+2>/dev/null cd sed -eu ${HOME}
+		local && | ${HOME} 2>/dev/null -eu grep && done $(pwd) "$1" $(pwd) x=1
+		grep /usr/bin printf -eu printf --verbose done then then "$@" cd "$1" ${HOME} done
+		sed $(pwd) cd -eu 'quoted text' printf
+		-eu grep --verbose readonly local grep --verbose awk local sed
+	grep x=1 grep local && && export -eu local
+	"$@" -eu done test sed x=1 readonly -eu grep grep readonly /usr/bin done
+		export /usr/bin sed echo && grep 2>/dev/null x=1 | echo then
+"$1" awk test | echo x=1 grep --verbose then ${HOME} &&
+		printf test $(pwd) readonly | awk grep "$1" 2>/dev/null
+		export printf ${HOME} awk echo /usr/bin
+local echo echo then printf "$@" printf ${HOME} x=1 done x=1
+		--verbose export done 2>/dev/null test 2>/dev/null
+		readonly -eu grep && 'quoted text' -eu then /usr/bin grep export
+	grep "$@" local | then "$1" local "$1" then
+then local -eu "$1" local ${HOME} $(pwd)
+	--verbose ${HOME} sed "$1" echo "$@" sed done readonly
+	local $(pwd) cd -eu echo
+	export sed printf cd test x=1 /usr/bin 2>/dev/null | awk readonly
+		--verbose cd done readonly done awk && $(pwd) 2>/dev/null done printf &&
+	"$@" | && done done "$@" /usr/bin
+		export echo local 2>/dev/null test "$@" awk /usr/bin
+/usr/bin 'quoted text' /usr/bin
+		| grep awk then ${HOME} -eu && grep echo test readonly 2>/dev/null
+awk cd export x=1 $(pwd) local test
+	${HOME} $(pwd) done "$@" awk export then local 2>/dev/null --verbose $(pwd) awk
+	"$1" grep | && "$@" /usr/bin | done awk | then
+	-eu grep && "$@" done cd x=1 "$1" awk local
+	'quoted text' cd "$1"
+		awk echo --verbose done readonly ${HOME} awk local grep echo $(pwd)
+	--verbose cd local 2>/dev/null 'quoted text'
+	/usr/bin 2>/dev/null local then grep cd test echo then export
+-eu x=1 | --verbose awk printf
+		${HOME} test "$1" awk local && echo
+		export echo 2>/dev/null sed ${HOME} then awk
+	2>/dev/null "$1" 'quoted text'
+	done cd --verbose cd export grep grep && /usr/bin test awk
+test | test 2>/dev/null $(pwd) /usr/bin awk readonly sed "$1" then local $(pwd)
+		"$@" | sed sed sed printf export printf $(pwd) --verbose local
+cd printf x=1 cd test | x=1 readonly sed echo 2>/dev/null test awk 'quoted text'
+		$(pwd) awk --verbose --verbose test
+	readonly | ${HOME} -eu sed --verbose $(pwd) 2>/dev/null $(pwd)
+		$(pwd) readonly cd done
+		local sed sed awk readonly printf readonly
+| "$1" test --verbose export
+		&& "$1" && sed x=1 $(pwd)
+	cd printf grep awk awk readonly x=1 printf
+		local "$@" printf echo
+cd local printf echo export
+	'quoted text' /usr/bin readonly cd &&
+	grep cd && $(pwd) printf && | export grep 2>/dev/null 'quoted text'
+	then -eu readonly x=1 printf local 'quoted text'
+		echo 'quoted text' readonly done "$1" $(pwd) local $(pwd) -eu && 'quoted text'
+export export cd 2>/dev/null
+| awk done echo awk -eu $(pwd) test
+		| --verbose test && x=1 $(pwd) then $(pwd) done local $(pwd) -eu x=1 awk done
+then test "$@" x=1 then grep readonly $(pwd)
+		-eu && cd printf awk sed test sed awk
+		x=1 'quoted text' done test printf cd awk local echo done
+	x=1 /usr/bin -eu echo
+x=1 /usr/bin printf /usr/bin export test x=1
+	&& --verbose ${HOME} readonly /usr/bin cd local 2>/dev/null
+		"$1" --verbose ${HOME} 2>/dev/null grep /usr/bin echo
+		grep "$1" | "$1" printf "$1" sed readonly test --verbose
+	${HOME} grep then awk $(pwd) readonly 2>/dev/null done readonly local && x=1 2>/dev/null
+		local $(pwd) $(pwd) done && echo x=1 export
+	grep && echo local export
+		/usr/bin test sed -eu 2>/dev/null
+then done --verbose /usr/bin "$@"
+	/usr/bin --verbose grep cd then
+	${HOME} "$@" "$1" export $(pwd) | /usr/bin | -eu test /usr/bin grep "$1" grep
+'quoted text' /usr/bin echo |
+	&& /usr/bin test ${HOME} && then $(pwd)
+	&& "$1" "$@" 'quoted text' ${HOME}
+	sed then x=1 -eu test awk done 'quoted text'
+		--verbose && test x=1 grep local
+		test printf echo --verbose
+		done "$@" ${HOME} "$1" x=1 readonly awk awk x=1 | printf
+		then /usr/bin local $(pwd) echo echo readonly test 2>/dev/null awk 'quoted text'
+		export ${HOME} && "$1" done | --verbose -eu "$@" && 2>/dev/null
+	2>/dev/null $(pwd) -eu readonly "$1" x=1
+	awk echo awk echo cd echo -eu awk 'quoted text' printf
+	'quoted text' export readonly /usr/bin 2>/dev/null awk 'quoted text'
+local "$1" done --verbose "$@"
+echo $(pwd) printf printf | "$1" then /usr/bin
+		done --verbose echo grep local ${HOME} 2>/dev/null done x=1 'quoted text' ${HOME}
+		echo readonly -eu $(pwd) "$@" echo -eu x=1 2>/dev/null "$@"
+	"$1" ${HOME} awk 2>/dev/null done sed | --verbose
+awk "$1" && test 'quoted text' -eu readonly
+	&& -eu printf "$@" printf done
+	"$@" export "$@" "$@" cd -eu x=1 export 'quoted text'
+		-eu grep done printf && echo "$@" export
+		printf done printf sed && x=1 printf
+		x=1 awk $(pwd) cd | 'quoted text' test | --verbose -eu cd grep
+	cd export printf grep "$1"
+'quoted text' printf awk echo "$1" $(pwd) grep local
+		sed sed x=1 printf grep 2>/dev/null ${HOME} echo done
+		x=1 2>/dev/null grep awk awk grep
+--verbose cd x=1 done cd "$1"
+		export x=1 "$@" done 'quoted text' cd echo done cd
+	test echo grep -eu --verbose /usr/bin
+	readonly export readonly then sed then echo grep /usr/bin readonly x=1 /usr/bin
+sed /usr/bin printf awk $(pwd) cd -eu cd printf test then
+	export grep 2>/dev/null local ${HOME} then ${HOME}
+"$@" --verbose export sed /usr/bin echo ${HOME}
+	local local | -eu "$1" | $(pwd) | echo "$1" | x=1 local 2>/dev/null
+2>/dev/null export grep cd /usr/bin && test readonly $(pwd) test
+		&& local then then && -eu awk && -eu $(pwd) cd /usr/bin export then && "$@"
+test "$@" --verbose 'quoted text' export ${HOME}
+		local done test --verbose readonly
+		-eu cd local readonly test
+readonly local done | printf /usr/bin done $(pwd) cd export
+		export 2>/dev/null $(pwd) export "$@" printf
+	&& awk grep echo 'quoted text' | readonly echo
+		readonly ${HOME} --verbose ${HOME} --verbose
+		&& "$1" x=1 export 2>/dev/null readonly "$1"
+printf && --verbose 'quoted text' | && printf x=1 local $(pwd) test cd
+		"$1" test then printf sed /usr/bin 'quoted text'
+		test "$@" 2>/dev/null | sed then --verbose /usr/bin 2>/dev/null --verbose ${HOME}
+	export awk grep echo $(pwd) cd cd awk ${HOME} -eu "$1"
+	local readonly $(pwd) printf
+	x=1 && "$1" local x=1 awk "$@" 2>/dev/null /usr/bin
+		--verbose then sed cd x=1 printf done
+local readonly --verbose grep x=1 --verbose grep ${HOME} 'quoted text'
+${HOME} && readonly 2>/dev/null
+		then cd && $(pwd) 2>/dev/null "$1" sed /usr/bin -eu echo echo sed local test
+		printf ${HOME} ${HOME} then cd 2>/dev/null
+	printf ${HOME} "$1" && local printf test ${HOME} awk export readonly
+		/usr/bin sed echo && "$@" test -eu awk done "$1" "$1" echo | printf
+		local done | export "$1" export then | printf
+| && "$@" -eu --verbose then cd export then ${HOME} readonly
+2>/dev/null awk "$1" printf done /usr/bin awk 2>/dev/null awk cd && | && readonly
+	2>/dev/null printf grep cd grep awk done ${HOME} 2>/dev/null
+done 'quoted text' sed local local &&
+$(pwd) done 'quoted text' grep cd
+	| 2>/dev/null /usr/bin then sed "$@" | "$1" | 'quoted text' printf
+		echo then --verbose sed export sed
+		"$@" 'quoted text' -eu echo && ${HOME} | local ${HOME} 'quoted text'
+		sed x=1 && printf /usr/bin /usr/bin printf done
+	"$1" then 'quoted text' -eu | echo "$@" echo
+	$(pwd) readonly /usr/bin "$@" grep printf "$1"
+	${HOME} done && 2>/dev/null test then /usr/bin --verbose local
+		-eu sed readonly cd x=1 $(pwd)
+		&& sed "$1" && readonly test readonly cd
+		/usr/bin --verbose then x=1 "$@" test local --verbose ${HOME}
+		readonly "$@" $(pwd) echo cd local --verbose grep printf test /usr/bin then
+export awk "$@" export cd
+		/usr/bin echo printf "$1" cd |
+		"$1" | echo cd grep "$1" cd export
+2>/dev/null printf awk export | readonly
+| 2>/dev/null done grep then readonly cd grep test ${HOME} && 2>/dev/null printf
+		'quoted text' && "$@" -eu sed sed
+'quoted text' --verbose ${HOME} sed grep --verbose sed $(pwd) 'quoted text'
+		&& echo awk readonly sed /usr/bin printf "$1" x=1 && "$1" && echo then
+		/usr/bin cd /usr/bin then ${HOME} 'quoted text' --verbose 2>/dev/null x=1 --verbose
+	export then | "$@" | $(pwd) ${HOME} echo --verbose then x=1 export local 'quoted text'
+readonly -eu export cd grep "$@" done cd cd --verbose readonly
+"$@" "$@" "$@" 2>/dev/null echo 'quoted text' readonly
+test $(pwd) | ${HOME} && "$1" test /usr/bin done "$@" /usr/bin /usr/bin -eu readonly
+		$(pwd) printf x=1 $(pwd) echo cd "$@" 2>/dev/null test grep
+--verbose ${HOME} awk /usr/bin x=1 awk ${HOME} x=1
+		test 'quoted text' "$@" echo /usr/bin echo export | grep readonly printf echo /usr/bin
@@ -0,0 +1,2001 @@
+		${HOME} then 'quoted text'
+printf --verbose "$1" $(pwd) then awk sed export
+	/usr/bin readonly | awk then cd test 2>/dev/null
+	--verbose -eu done 2>/dev/null -eu ${HOME} grep --verbose $(pwd)
+awk --verbose test $(pwd) && $(pwd) $(pwd) awk test && readonly
+| --verbose --verbose | "$@" readonly 'quoted text'
+$(pwd) 2>/dev/null test export done echo readonly grep --verbose &&
+		| test then "$1" export "$@" 2>/dev/null sed sed x=1 awk echo $(pwd) sed "$@"
+	test ${HOME} /usr/bin test awk echo then
+readonly 2>/dev/null grep grep /usr/bin x=1 "$1" export then "$@" awk
+		cd "$1" export -eu local
+	cd echo test printf echo cd ${HOME} readonly test readonly grep local echo
+	&& ${HOME} done done | -eu "$1" readonly "$@" awk "$1" ${HOME}
+x=1 /usr/bin sed local test cd x=1 /usr/bin readonly printf
+export done 'quoted text' cd then awk | ${HOME} printf
+		then /usr/bin local grep "$1"
+		local x=1 done grep -eu "$1"
+		readonly 'quoted text' local cd 2>/dev/null ${HOME} $(pwd) /usr/bin
+grep test | 'quoted text' awk ${HOME}
+	readonly /usr/bin 2>/dev/null --verbose x=1 local then $(pwd) "$1" sed
+		2>/dev/null local then printf x=1
+--verbose ${HOME} && then done
+printf --verbose export echo ${HOME} readonly 2>/dev/null -eu
+		"$@" && 2>/dev/null export cd "$1" ${HOME} -eu local $(pwd)
+		awk then test export "$1" x=1 ${HOME} awk printf
+	$(pwd) test "$1" 2>/dev/null readonly done && readonly --verbose $(pwd) -eu
+		printf --verbose 2>/dev/null
+	"$1" sed "$@" && 'quoted text' export cd sed sed && export awk 'quoted text'
+awk ${HOME} awk 2>/dev/null "$@" /usr/bin
+test 'quoted text' test
+| && ${HOME} done "$@" done &&
+	--verbose readonly && then sed $(pwd) awk test "$1" cd x=1 printf
+		&& test sed readonly then "$@"
+		readonly && -eu /usr/bin --verbose
+		/usr/bin -eu cd ${HOME}
+'quoted text' then printf local ${HOME} readonly then ${HOME} done | /usr/bin
+		/usr/bin "$1" "$1" export sed grep grep sed awk printf sed "$1" then
+		grep /usr/bin $(pwd) /usr/bin then --verbose x=1 readonly export
+sed done local sed 'quoted text' then 'quoted text' export 'quoted text'
+	2>/dev/null | ${HOME} printf $(pwd) sed cd local
+	${HOME} then && -eu test export x=1 printf printf
+	${HOME} export --verbose -eu ${HOME}
+		echo then -eu local "$1" 2>/dev/null then $(pwd) "$1"
+		done --verbose ${HOME} test | then grep "$@" cd 'quoted text' cd && done
+	local x=1 "$@" ${HOME} cd 2>/dev/null readonly --verbose 'quoted text' done
+		"$1" awk grep done "$1" -eu echo printf
+	export -eu grep "$1" $(pwd) readonly /usr/bin test ${HOME} |
+$(pwd) 2>/dev/null done "$@" -eu "$1" cd cd |
+	x=1 x=1 then readonly then done --verbose readonly
+grep cd export | export ${HOME} -eu && -eu readonly awk echo | awk export --verbose
+		${HOME} printf test done done sed 'quoted text' /usr/bin /usr/bin
+		-eu /usr/bin local readonly && echo export done readonly printf 2>/dev/null
+export ${HOME} grep && /usr/bin "$1" x=1 $(pwd) export
+grep "$1" && x=1 /usr/bin --verbose ${HOME} 'quoted text' x=1
+	-eu /usr/bin && 'quoted text' && echo readonly ${HOME} local echo --verbose
+		&& sed --verbose printf export test && then | echo
+		${HOME} 'quoted text' ${HOME} | then readonly
+	test && cd sed then $(pwd)
+		-eu && $(pwd) done cd then
+		2>/dev/null then 'quoted text' done sed done cd && && ${HOME} then "$@"
+| sed local --verbose
+	test test local $(pwd) awk 2>/dev/null 2>/dev/null
+	"$1" cd /usr/bin sed $(pwd) 2>/dev/null
+	"$@" | cd ${HOME} $(pwd) done local echo readonly
+local $(pwd) echo --verbose export grep
+		cd grep then $(pwd) done readonly -eu done then -eu
+2>/dev/null /usr/bin local | readonly --verbose /usr/bin readonly
+	sed ${HOME} --verbose then /usr/bin 2>/dev/null
+		then x=1 awk 'quoted text'
+test 'quoted text' "$1" | awk
+		| /usr/bin ${HOME} readonly cd x=1 $(pwd) readonly awk export local
+	| | awk printf 2>/dev/null -eu sed
+readonly export sed 'quoted text' grep && 'quoted text'
+	then printf /usr/bin "$1" local | "$1"
+	done grep --verbose local then /usr/bin --verbose "$@" $(pwd)
+sed done test 2>/dev/null test test cd -eu && 'quoted text'
+	grep printf ${HOME} -eu $(pwd) $(pwd) --verbose "$@" ${HOME} --verbose --verbose
+readonly cd cd export export echo x=1 cd then "$1" awk "$1" ${HOME} readonly --verbose
+		$(pwd) --verbose | |
+awk 2>/dev/null export export --verbose "$1" 2>/dev/null 'quoted text' done done
+	/usr/bin --verbose ${HOME} awk && 2>/dev/null $(pwd) 2>/dev/null local
+		then then "$1" && sed /usr/bin && ${HOME} "$1" -eu test -eu --verbose 2>/dev/null
+	"$1" "$1" done printf ${HOME} export printf awk $(pwd) echo && 'quoted text'
+2>/dev/null sed sed readonly /usr/bin readonly
+	test done "$1" ${HOME} local ${HOME} $(pwd) test export | x=1 awk
+readonly 2>/dev/null sed test printf "$1" export done && local local
+	${HOME} "$@" 'quoted text' done "$@" --verbose "$@" /usr/bin then grep
+		-eu && 'quoted text' "$1" then | --verbose
+		done cd echo printf 2>/dev/null sed sed test test
+	"$@" export && local export echo export ${HOME}
+'quoted text' done x=1 -eu ${HOME} grep 2>/dev/null |
+		cd "$1" | ${HOME} sed done 2>/dev/null | "$@" -eu "$1"
+local local printf $(pwd) export
+		--verbose ${HOME} echo test "$@" && then -eu cd | grep
+		$(pwd) 2>/dev/null awk export
+		x=1 ${HOME} grep --verbose test echo awk printf sed done |
+	printf | /usr/bin done /usr/bin -eu 'quoted text'
+echo "$1" sed printf | ${HOME} x=1 done 'quoted text' --verbose done x=1 test
+	2>/dev/null printf --verbose grep "$@" readonly --verbose done done
+		-eu && -eu test sed then x=1 export echo then sed 2>/dev/null grep
+"$1" cd awk done $(pwd) | export $(pwd) ${HOME} && | cd "$@" --verbose
+	sed sed 'quoted text' echo printf readonly cd done x=1 | printf
+x=1 printf export -eu ${HOME}
+'quoted text' sed grep /usr/bin export echo
+"$@" printf test && "$1" 'quoted text' sed -eu 'quoted text'
+	test -eu grep grep awk printf done readonly x=1 | "$1"
+	"$@" 'quoted text' then 'quoted text' && -eu sed printf test $(pwd) 'quoted text'
+		'quoted text' $(pwd) && "$1" 2>/dev/null $(pwd) cd local
+		"$1" printf x=1 "$1" readonly then test sed -eu 'quoted text' && ${HOME} export
+	printf x=1 ${HOME} then done sed test then
+		export 2>/dev/null test 'quoted text'
+done ${HOME} done -eu x=1 'quoted text' export
+--verbose echo x=1 done sed x=1 "$1" 'quoted text'
+x=1 ${HOME} readonly && -eu local
+--verbose 2>/dev/null $(pwd)
+		grep "$@" ${HOME} --verbose
+		--verbose then readonly grep
+2>/dev/null cd readonly
+		printf 'quoted text' "$1" x=1 done grep $(pwd) local sed --verbose 2>/dev/null
+export echo "$1" ${HOME}
+	export done done printf /usr/bin echo | sed "$1"
+		x=1 test test 2>/dev/null -eu ${HOME} x=1 --verbose x=1 x=1 test done done -eu
+echo echo then local "$1" awk --verbose ${HOME} "$1"
+"$1" cd x=1 ${HOME} readonly echo x=1 $(pwd) $(pwd) export x=1
+		export awk export | then $(pwd) printf --verbose x=1 sed local "$1" "$@" sed
+		x=1 then "$1" "$@" $(pwd) grep done test grep "$@" x=1
+x=1 "$@" $(pwd) export 2>/dev/null
+		-eu test && readonly "$@" --verbose then
+'quoted text' sed "$1" done printf cd sed && "$1" local
+		awk grep done export export "$1" x=1 --verbose --verbose
+	done "$1" local test --verbose
+		done 'quoted text' x=1 /usr/bin "$@" "$1" && | then cd --verbose
+		'quoted text' "$@" export && | "$@" done /usr/bin 2>/dev/null test "$1"
+		printf $(pwd) readonly "$@"
+printf -eu export grep cd
+'quoted text' cd echo "$1" x=1 $(pwd)
+	sed ${HOME} export 'quoted text' x=1 awk then test sed sed then | readonly $(pwd)
+		test -eu echo done /usr/bin
+	&& "$1" cd echo local 'quoted text' 2>/dev/null ${HOME} export export then &&
+		local /usr/bin readonly && echo | then --verbose ${HOME} ${HOME} 2>/dev/null
+	export test sed test $(pwd) echo export
+	cd awk | --verbose && readonly "$@" "$1" /usr/bin "$1"
+	$(pwd) --verbose readonly /usr/bin grep sed -eu echo /usr/bin --verbose
+x=1 done readonly "$1" --verbose 2>/dev/null
+echo cd && done /usr/bin $(pwd) | "$@" -eu
+export "$1" cd done echo -eu then grep && ${HOME} | 'quoted text'
+grep export export 'quoted text' awk printf local 'quoted text' && done
+	"$1" && $(pwd) echo sed cd -eu && x=1 then 2>/dev/null test
+		--verbose local x=1 grep export local echo printf /usr/bin
+done printf "$@" | /usr/bin x=1 $(pwd) | "$1" echo local grep "$@" test
+		grep local local "$@" grep test printf -eu done grep test
+then export readonly cd x=1 $(pwd) local printf sed -eu test
+	echo ${HOME} "$1" x=1 x=1 local $(pwd) done export awk ${HOME} cd "$@" grep &&
+'quoted text' echo x=1 then | "$1" test
+	${HOME} 2>/dev/null x=1 $(pwd) && cd export /usr/bin grep "$1" "$@"
+	done 2>/dev/null -eu "$1" $(pwd) /usr/bin "$@" readonly
+	&& --verbose grep x=1 readonly 2>/dev/null export local printf
+		"$@" echo grep test done awk
+		2>/dev/null --verbose --verbose sed then awk local test export 2>/dev/null
+		'quoted text' cd grep $(pwd) echo readonly awk | echo 'quoted text'
+done grep test ${HOME} -eu readonly sed | sed -eu x=1 awk readonly
+		"$@" "$@" | printf readonly export --verbose
+export echo grep printf 'quoted text' /usr/bin done -eu "$1" 'quoted text'
+$(pwd) && ${HOME} --verbose sed && local readonly test
+x=1 2>/dev/null && "$1" 2>/dev/null $(pwd) echo -eu sed awk "$1" readonly
+	--verbose cd cd done readonly local
+readonly "$@" then export ${HOME} local /usr/bin
+	then --verbose sed "$1"
+	then local grep "$1" 2>/dev/null
+readonly 'quoted text' grep then readonly echo $(pwd)
+grep then x=1 echo readonly |
+		| export && ${HOME} done "$1" -eu /usr/bin sed readonly 2>/dev/null /usr/bin cd
+	sed && export --verbose
+	${HOME} x=1 | /usr/bin test --verbose test
+	${HOME} && && --verbose && echo export "$@" then 2>/dev/null /usr/bin grep
+$(pwd) done | test && then ${HOME} sed /usr/bin --verbose | local export
+		"$@" sed cd $(pwd) echo /usr/bin -eu
+		2>/dev/null awk cd printf 'quoted text'
+		x=1 -eu -eu done test cd local readonly
+'quoted text' sed $(pwd) then x=1 && printf --verbose ${HOME} 2>/dev/null "$@"
+		-eu printf | 'quoted text' cd && local ${HOME} local local export $(pwd)
+	"$1" ${HOME} "$@" local cd x=1 done
+done -eu 2>/dev/null awk --verbose | local
+local export ${HOME} grep
+'quoted text' $(pwd) test awk local awk
+"$1" sed export printf && test local readonly readonly local 'quoted text'
+"$1" done cd 'quoted text' x=1 "$@" echo /usr/bin | "$1" printf "$@" grep
+awk 2>/dev/null 'quoted text' then then readonly x=1 cd awk 'quoted text'
+	${HOME} 'quoted text' awk sed "$@" printf cd $(pwd) -eu
+test echo --verbose echo echo readonly /usr/bin /usr/bin "$@" sed "$@" awk /usr/bin
+test grep /usr/bin cd -eu done "$1" 2>/dev/null then done cd
+readonly awk "$1" test
+	grep /usr/bin sed /usr/bin ${HOME} && sed
+		-eu && sed then grep $(pwd) "$1"
+	${HOME} ${HOME} sed "$1"
+"$@" cd "$@" $(pwd) -eu cd 'quoted text' then x=1 | /usr/bin
+${HOME} awk test done local 2>/dev/null done echo $(pwd) then 2>/dev/null
+$(pwd) "$@" | then ${HOME}
+	x=1 done test sed $(pwd) local test local "$1"
+	$(pwd) -eu printf printf grep | local then /usr/bin done "$1" done
+		${HOME} sed $(pwd) then -eu printf awk ${HOME} x=1 readonly -eu readonly -eu
+		awk && -eu && && grep -eu "$@" local "$@" 'quoted text' 'quoted text'
+--verbose echo local /usr/bin awk /usr/bin then then "$@" $(pwd)
+	awk export /usr/bin readonly
+		/usr/bin $(pwd) x=1 grep export export 2>/dev/null awk cd grep $(pwd) 2>/dev/null
+	--verbose x=1 awk | 2>/dev/null cd -eu x=1 "$@" $(pwd) printf
+		"$1" cd printf export "$1" --verbose x=1 done local awk --verbose
+	2>/dev/null echo readonly readonly --verbose done && local then
+		export ${HOME} && /usr/bin printf echo
+	local "$@" test then grep -eu awk readonly readonly
+then | local then export printf | 2>/dev/null
+	"$1" sed local readonly "$@" $(pwd) 'quoted text'
+		sed echo cd cd | cd readonly then then && grep awk --verbose /usr/bin $(pwd)
+		done | ${HOME} -eu x=1 | echo
+		-eu echo 'quoted text' "$1" done
+		'quoted text' "$@" 'quoted text' $(pwd) export
+	local cd -eu && done then "$@" echo export done echo --verbose sed "$1" x=1 grep
+	x=1 echo grep awk test -eu sed sed ${HOME} grep readonly 2>/dev/null
+		echo 2>/dev/null ${HOME} $(pwd) done "$@" echo | ${HOME} printf x=1 printf
+		local cd echo 2>/dev/null export 2>/dev/null
+	cd ${HOME} -eu done grep 'quoted text'
+		"$@" test 'quoted text' /usr/bin test /usr/bin $(pwd) "$1" readonly
+	'quoted text' readonly then -eu printf printf "$@" awk && && $(pwd)
+2>/dev/null ${HOME} && "$1" grep export -eu | test export x=1 | /usr/bin -eu
+		test "$1" "$1" -eu printf sed -eu printf cd printf /usr/bin
+	${HOME} -eu cd 'quoted text' local export done export
+	export cd "$@" /usr/bin cd export | done test
+/usr/bin -eu 2>/dev/null local x=1 printf && "$@" /usr/bin then -eu printf
+then --verbose awk ${HOME} -eu ${HOME}
+		done awk cd | awk then grep /usr/bin awk readonly then done x=1 cd done x=1
+local ${HOME} | done awk echo -eu cd $(pwd) && 2>/dev/null printf 2>/dev/null
+	-eu readonly done printf grep "$@" local local "$1" sed 2>/dev/null
+	/usr/bin | printf "$1"
+local -eu 'quoted text' grep $(pwd) ${HOME} -eu export printf then
+--verbose local done --verbose test then
+		/usr/bin export /usr/bin ${HOME} 'quoted text' done /usr/bin x=1 printf
+	cd sed $(pwd) sed export done awk
+"$1" "$1" test sed readonly grep echo export printf "$1"
+	cd local echo x=1 sed -eu /usr/bin echo
+	sed cd $(pwd) --verbose cd && cd printf "$@" then "$1" -eu ${HOME}
+"$@" then --verbose export 'quoted text' "$1" /usr/bin
+| export -eu then && awk readonly readonly printf grep export export
+		-eu && grep sed export cd --verbose awk cd
+		"$1" then "$1" 2>/dev/null echo test awk cd sed /usr/bin readonly sed
+		2>/dev/null "$@" | && then
+		${HOME} | x=1 /usr/bin "$@" readonly cd done --verbose echo cd grep 2>/dev/null
+		done printf sed $(pwd) done echo "$@" awk
+	printf $(pwd) readonly printf -eu "$1" echo sed "$@"
+		x=1 export cd "$1" export x=1 then printf echo /usr/bin export x=1 awk && readonly
+		local awk grep sed 2>/dev/null
+export -eu "$1" test | x=1 --verbose $(pwd) $(pwd) && local sed then done awk
+--verbose x=1 echo sed && /usr/bin 'quoted text' test "$@"
+	&& then test x=1 export 'quoted text' | "$1" x=1 then ${HOME} "$1" && &&
+	x=1 done "$@" then readonly sed /usr/bin $(pwd) && ${HOME} ${HOME} test test
+	2>/dev/null export $(pwd) 2>/dev/null cd 2>/dev/null x=1 "$1" done --verbose
+	cd $(pwd) sed 2>/dev/null sed && x=1 "$@"
+printf 2>/dev/null $(pwd) ${HOME} 2>/dev/null $(pwd) "$@" test readonly
+		test ${HOME} && then | $(pwd) export done test --verbose printf
+	readonly awk sed done sed
+grep echo readonly then cd awk && /usr/bin printf local cd -eu echo
+awk done readonly && | 'quoted text' ${HOME} done "$1" echo echo
+	2>/dev/null done local "$@"
+test printf "$1" "$@" --verbose then export printf then x=1 sed --verbose
+/usr/bin readonly x=1 "$1" test
+		"$@" export echo "$1" $(pwd) ${HOME} "$@" grep -eu
+	grep then grep && 2>/dev/null
+		readonly export | local -eu readonly then
+cd done | then awk sed test
+	awk test echo ${HOME} x=1 'quoted text'
+-eu printf grep 2>/dev/null "$1" sed | then ${HOME} | x=1 "$1" 2>/dev/null
+	"$1" then "$1" && cd | readonly sed && awk then grep
+		then awk "$@" cd test x=1 printf 2>/dev/null readonly test export awk x=1
+		'quoted text' x=1 done && 2>/dev/null --verbose awk done
+	sed x=1 $(pwd) | 2>/dev/null
+		2>/dev/null printf /usr/bin $(pwd) local --verbose
+		printf then local | --verbose export && $(pwd) 'quoted text'
+		"$1" readonly echo printf 2>/dev/null echo x=1 "$1" 2>/dev/null --verbose
+export "$1" "$@" ${HOME} $(pwd) --verbose 'quoted text' local echo 'quoted text'
+	grep $(pwd) | echo export then cd then --verbose grep -eu echo -eu && -eu then
+	2>/dev/null sed x=1 readonly done export awk
+	echo "$@" && 2>/dev/null test local
+	"$1" printf grep ${HOME} then -eu && echo then test
+		then readonly /usr/bin cd done $(pwd) awk | x=1
+	printf && test echo echo export printf
+		x=1 local | x=1 "$@" /usr/bin 2>/dev/null sed readonly grep sed export local test
+		2>/dev/null ${HOME} readonly
+		export --verbose cd awk
+"$1" awk --verbose readonly --verbose x=1 local -eu
+'quoted text' then "$1" -eu local $(pwd) "$1" grep 2>/dev/null | awk grep cd
+		test "$@" printf printf x=1 "$1" awk $(pwd)
+		2>/dev/null | printf export x=1 /usr/bin local | && then "$1" awk readonly
+then 2>/dev/null export then /usr/bin local test test printf $(pwd) "$@" 2>/dev/null
+local 2>/dev/null --verbose x=1 'quoted text' grep --verbose $(pwd)
+		| test echo done test sed "$1" cd cd readonly "$1" local "$@" awk readonly
+		awk local /usr/bin sed awk && printf sed done local cd printf grep export
+readonly readonly sed
+export printf awk && cd "$1" && /usr/bin export | $(pwd)
+		export cd done ${HOME} | export test sed "$@" /usr/bin done
+	| export -eu 'quoted text' && then echo x=1 -eu /usr/bin && --verbose local
+-eu local --verbose export "$1" ${HOME} test /usr/bin
+		echo /usr/bin x=1 'quoted text'
+	${HOME} ${HOME} local "$@" $(pwd)
+	x=1 ${HOME} printf /usr/bin
+		echo test "$@" -eu | --verbose done printf
+	awk echo $(pwd) local printf echo && x=1 cd awk -eu -eu grep printf
+--verbose echo sed sed test
+		grep $(pwd) sed 2>/dev/null echo && | ${HOME} awk readonly && readonly
+	then sed awk "$1" "$1" $(pwd) sed 2>/dev/null 'quoted text' --verbose --verbose
+	done readonly | grep "$1" test /usr/bin -eu echo test
+"$@" 'quoted text' && "$@" done -eu x=1 local /usr/bin done
+	'quoted text' 2>/dev/null $(pwd) sed readonly 'quoted text' test printf
+	2>/dev/null local local grep && 2>/dev/null done export cd --verbose cd
+local cd local then sed --verbose 2>/dev/null cd "$@" test printf sed ${HOME}
+&& x=1 "$@" | /usr/bin
+grep "$@" export test "$@"
+		test readonly readonly "$1" echo "$@" sed
+readonly 2>/dev/null done then "$1" done ${HOME} grep sed x=1
+		done export x=1 'quoted text' awk then /usr/bin
+		readonly then x=1 printf sed ${HOME} x=1 done test ${HOME} sed awk 'quoted text'
+&& | done export -eu printf ${HOME} cd local --verbose
+	grep export $(pwd) 'quoted text' --verbose /usr/bin ${HOME}
+test readonly | grep readonly then local -eu
+	grep -eu local 2>/dev/null then $(pwd) printf 'quoted text' then awk --verbose
+printf /usr/bin 'quoted text'
+	-eu | 2>/dev/null && -eu
+sed done awk readonly export echo | -eu x=1 then | "$@" 2>/dev/null
+printf sed readonly --verbose "$@" 'quoted text' readonly "$@" /usr/bin local
+	test grep | cd awk "$1" readonly 'quoted text' $(pwd) printf
+		$(pwd) awk $(pwd) then && "$@" "$@"
+&& local cd sed then export "$@" readonly readonly
+done sed 2>/dev/null /usr/bin local echo readonly local export 2>/dev/null ${HOME}
+test ${HOME} -eu done --verbose 2>/dev/null /usr/bin -eu
+	/usr/bin ${HOME} "$1" /usr/bin awk awk printf printf --verbose
+	--verbose readonly done cd readonly export local sed printf
+		${HOME} "$@" -eu then "$1" test 2>/dev/null
+printf test ${HOME} awk then grep "$@" done
+		readonly grep -eu echo readonly
+		$(pwd) 'quoted text' ${HOME} x=1 local
+	$(pwd) $(pwd) done x=1 printf --verbose
+		x=1 && sed ${HOME} test export grep local test /usr/bin awk
+		local printf 2>/dev/null -eu cd sed 'quoted text' | | printf
+		sed grep local -eu printf echo | && | x=1 sed x=1 printf "$1" awk
+	| echo x=1 x=1 | 'quoted text'
+		grep readonly then x=1
+echo export && sed x=1 x=1 sed done -eu awk && test $(pwd) test 2>/dev/null
+		test sed --verbose done local done /usr/bin -eu done
+		export test "$1" sed cd 2>/dev/null cd x=1 cd local /usr/bin cd sed | done
+		"$1" echo cd echo awk grep -eu 'quoted text' /usr/bin
+	| 'quoted text' sed test 2>/dev/null --verbose local $(pwd) --verbose readonly
+		awk "$1" printf local cd
+	export "$@" sed done 'quoted text' "$@" then $(pwd) && echo x=1 cd cd --verbose
+		"$1" -eu sed $(pwd) $(pwd) readonly && done && "$1" "$1" x=1 test
+"$@" 'quoted text' "$1" readonly "$1" grep local export
+		export -eu && $(pwd) awk readonly export test
+		-eu "$1" 2>/dev/null printf "$1" local sed ${HOME} local test
+	readonly x=1 test | local then export local "$@" export "$@" then "$@" /usr/bin
+	awk export grep done local /usr/bin
+		export $(pwd) sed export local then --verbose awk && awk
+		local --verbose "$@"
+&& --verbose test --verbose local $(pwd) && x=1 local -eu readonly "$1"
+	sed $(pwd) ${HOME} $(pwd) sed printf 'quoted text' test grep
+	--verbose 'quoted text' done sed sed "$@" x=1
+	export local awk sed sed printf 'quoted text' readonly --verbose
+		readonly "$1" sed then /usr/bin && local --verbose then -eu
+	--verbose "$1" sed done sed sed ${HOME} &&
+	done test /usr/bin "$1" 'quoted text' x=1 && awk --verbose
+		/usr/bin "$1" readonly printf --verbose ${HOME} -eu 'quoted text' "$@" &&
+		-eu sed --verbose && export cd x=1 "$@" $(pwd) x=1 sed then "$1" 2>/dev/null
+printf "$@" export then export readonly cd done /usr/bin 2>/dev/null
+readonly 'quoted text' echo readonly done 'quoted text'
+&& 'quoted text' local then local x=1 export
+grep echo --verbose x=1
+		"$@" local "$1" echo && echo export 'quoted text'
+	sed awk then "$1" cd "$1"
+		readonly echo sed local awk echo sed "$1" x=1
+cd cd sed readonly $(pwd) awk local /usr/bin
+| echo /usr/bin local then --verbose -eu "$@" grep cd done 'quoted text'
+cd ${HOME} "$1" --verbose
+	| cd cd | then $(pwd) echo 2>/dev/null test test x=1 then local export
+		--verbose awk 2>/dev/null awk done echo local 2>/dev/null grep sed readonly
+	"$@" then cd printf $(pwd) done /usr/bin "$1" -eu 2>/dev/null -eu /usr/bin done
+| export sed export export done done test local --verbose
+	"$@" grep test 2>/dev/null export done local
+		'quoted text' printf 2>/dev/null export "$@" then done cd && export
+then sed -eu awk export && readonly test /usr/bin grep /usr/bin
+		test "$@" local export cd cd "$@" && awk && && export
+-eu then export 2>/dev/null awk test echo readonly local sed grep local
+	x=1 2>/dev/null printf "$1" $(pwd) -eu echo cd ${HOME} 'quoted text'
+export readonly -eu local /usr/bin && x=1 printf printf "$@"
+	echo then "$@" 2>/dev/null sed grep -eu
+test 'quoted text' printf
+		grep test /usr/bin cd grep cd /usr/bin
+		${HOME} cd grep | 'quoted text' $(pwd) readonly done readonly printf
+		echo -eu echo $(pwd) && test test
+	| ${HOME} /usr/bin /usr/bin then
+readonly test test /usr/bin && printf && grep "$1"
+grep && ${HOME} "$1" /usr/bin -eu
+	--verbose readonly test -eu sed -eu -eu echo
+export ${HOME} | ${HOME} ${HOME} printf 'quoted text' local | test readonly
+		test /usr/bin then readonly sed local ${HOME}
+	--verbose cd sed cd -eu printf cd ${HOME} cd ${HOME} |
+	-eu ${HOME} "$1" awk local "$@"
+		| --verbose export test | grep x=1 2>/dev/null done && | --verbose
+		readonly && printf 2>/dev/null x=1 echo done readonly then $(pwd) /usr/bin
+-eu done $(pwd) export $(pwd) test x=1 "$@" readonly grep --verbose
+		$(pwd) /usr/bin | --verbose -eu
+'quoted text' printf test $(pwd) readonly printf export test done
+"$1" echo cd readonly awk "$@" $(pwd) echo done printf awk | then echo
+x=1 2>/dev/null sed "$1" awk "$@" cd awk && echo export local -eu "$1"
+		'quoted text' done readonly "$@" x=1 then
+	echo then sed | cd test ${HOME} $(pwd) | "$1" ${HOME} $(pwd) -eu $(pwd)
+"$1" done -eu local local done
+	sed x=1 2>/dev/null export sed export
+$(pwd) "$@" 'quoted text' x=1 $(pwd) 2>/dev/null 2>/dev/null
+readonly "$1" cd | printf x=1 ${HOME} printf
+	x=1 -eu ${HOME} "$1" "$1" local "$1" export
+	2>/dev/null local x=1 local then export x=1 echo "$1" grep $(pwd) $(pwd)
+awk "$@" /usr/bin --verbose --verbose
+readonly x=1 2>/dev/null "$1" $(pwd) readonly --verbose --verbose $(pwd) 2>/dev/null
+		x=1 -eu "$@" ${HOME} $(pwd) local
+	grep "$@" ${HOME} echo $(pwd) sed grep cd echo export
+	cd /usr/bin && grep /usr/bin
+| --verbose 'quoted text' grep -eu 'quoted text'
+	${HOME} done awk readonly grep | local | -eu awk -eu
+	/usr/bin echo awk "$1" grep --verbose "$1" sed -eu /usr/bin echo
+	"$@" local --verbose echo x=1 | && | /usr/bin export "$1" "$@" | export done
+	"$@" test done done test test x=1 sed grep "$@" 'quoted text'
+		test 2>/dev/null "$@"
+		'quoted text' printf /usr/bin $(pwd) "$@"
+	${HOME} "$1" test sed x=1 awk echo readonly
+		done then grep export done
+	x=1 -eu -eu -eu readonly --verbose local 'quoted text' awk | | awk x=1 readonly
+grep export && export readonly && ${HOME} /usr/bin 'quoted text' done 'quoted text'
+-eu --verbose 2>/dev/null echo 2>/dev/null sed readonly echo $(pwd) ${HOME}
+	"$@" && local local "$1" readonly ${HOME} cd test 2>/dev/null
+/usr/bin export -eu done grep $(pwd)
+		/usr/bin -eu grep "$@" "$@" x=1
+	then local readonly printf $(pwd) awk test
+"$@" x=1 grep 2>/dev/null x=1 export
+	local done | readonly grep "$1" sed "$1"
+	awk sed done then cd readonly printf printf readonly sed grep sed
+		cd $(pwd) x=1 "$1" ${HOME} 'quoted text' printf 2>/dev/null && sed && then "$@"
+	--verbose cd done grep
+	&& readonly awk x=1 --verbose local then -eu grep "$1" | | $(pwd) --verbose
+--verbose && && $(pwd) -eu "$@" done ${HOME} test grep then printf &&
+	readonly echo local echo done && --verbose 'quoted text'
+		done then then /usr/bin local 'quoted text' x=1
+	export ${HOME} /usr/bin then then echo test echo "$@"
+		--verbose 'quoted text' /usr/bin awk awk "$1" "$@" --verbose cd grep
+printf ${HOME} echo local cd cd /usr/bin 2>/dev/null
+"$@" done -eu then && --verbose sed x=1
+"$@" grep cd $(pwd) readonly awk then -eu $(pwd) grep ${HOME}
+	then readonly 2>/dev/null printf ${HOME} "$@"
+		--verbose "$1" cd echo printf done then export done -eu readonly local grep
+		local && "$1" grep readonly readonly printf then
+	printf test grep ${HOME}
+test 2>/dev/null done ${HOME} && 2>/dev/null --verbose $(pwd)
+-eu grep awk /usr/bin grep $(pwd) done 'quoted text' "$@" cd 'quoted text' 'quoted text'
+		cd "$@" ${HOME} awk then printf 2>/dev/null
+	awk echo awk printf --verbose | test -eu && echo && "$@" && | sed local
+sed then echo $(pwd) test test
+x=1 /usr/bin echo echo export "$1" awk echo --verbose /usr/bin
+	--verbose echo printf local
+	done $(pwd) then grep local
+awk "$1" -eu done -eu local test /usr/bin "$1"
+		'quoted text' then && sed sed --verbose local | test -eu "$1" readonly
+	sed awk 2>/dev/null /usr/bin
+		test awk awk readonly 2>/dev/null --verbose "$1" test done
+printf 'quoted text' | awk readonly && sed | ${HOME} --verbose
+		$(pwd) sed local /usr/bin -eu printf then grep --verbose
+export awk --verbose 2>/dev/null
+test x=1 -eu x=1 "$@" echo "$@"
+then -eu awk local readonly | echo printf echo cd /usr/bin
+"$@" cd && export "$@" /usr/bin awk echo then
+grep cd test readonly "$1" && "$1" readonly awk sed
+	-eu /usr/bin local then
+	-eu && "$1" printf readonly && grep -eu grep readonly sed
+	awk awk readonly done /usr/bin x=1 sed then $(pwd) "$1" sed /usr/bin
+	test x=1 x=1 /usr/bin test 2>/dev/null
+		-eu "$1" /usr/bin echo cd --verbose "$1" test awk done export
+	awk awk -eu then sed
+		echo local printf grep -eu echo $(pwd) x=1 export x=1 echo
+	| x=1 -eu export /usr/bin then echo sed | local --verbose
+		test && $(pwd) sed ${HOME} echo ${HOME} && 2>/dev/null
+done "$1" "$@" sed awk $(pwd) ${HOME} done
+	2>/dev/null /usr/bin grep && sed export test 'quoted text' readonly /usr/bin
+	x=1 ${HOME} done 2>/dev/null ${HOME} "$@" ${HOME}
+readonly /usr/bin | test 'quoted text'
+		then done then --verbose && echo x=1 $(pwd) ${HOME} cd | /usr/bin "$1"
+		-eu -eu ${HOME} awk && awk 'quoted text' export
+done 'quoted text' readonly awk grep --verbose
+	test awk awk export ${HOME} test printf export
+		local "$@" 'quoted text' $(pwd) ${HOME}
+	2>/dev/null sed && && --verbose echo echo done cd $(pwd)
+		done cd 'quoted text' $(pwd) done 2>/dev/null
+sed "$1" awk -eu then "$1" --verbose $(pwd) echo x=1 /usr/bin sed
+cd echo 2>/dev/null -eu 'quoted text' then grep sed
+		"$1" ${HOME} --verbose cd | printf export 'quoted text'
+printf export && sed 2>/dev/null awk | sed -eu export x=1
+test 'quoted text' 'quoted text' test --verbose
+${HOME} -eu $(pwd) && | 'quoted text' readonly
+		then | done -eu 'quoted text' echo /usr/bin ${HOME} | echo then done echo 2>/dev/null
+	echo 'quoted text' test export grep sed test readonly local "$1"
+export | -eu grep awk awk $(pwd)
+		&& 'quoted text' local /usr/bin test "$@" printf ${HOME}
+		/usr/bin cd echo local ${HOME} && test ${HOME} done /usr/bin cd 2>/dev/null
+	sed "$1" 'quoted text' cd readonly -eu | && "$1" local x=1 $(pwd) ${HOME}
+		echo sed x=1 awk x=1 export echo printf -eu cd
+	/usr/bin export ${HOME} readonly | "$1"
+	2>/dev/null printf x=1 /usr/bin --verbose "$1" --verbose -eu grep
+then --verbose | local readonly x=1 sed /usr/bin echo -eu /usr/bin
+export x=1 --verbose && --verbose $(pwd) $(pwd) done test --verbose
+		$(pwd) grep ${HOME} "$@" then 2>/dev/null test export awk grep awk ${HOME}
+"$@" then then && ${HOME} local
+	sed sed -eu "$1" grep export 'quoted text'
+	sed test export test grep 2>/dev/null --verbose echo | --verbose "$1" sed
+	local readonly ${HOME} 'quoted text' readonly "$1" -eu 2>/dev/null
+	echo readonly echo printf /usr/bin awk grep done
+done awk "$1" sed | test test printf x=1 test && export | --verbose
+		cd "$1" test 'quoted text' awk --verbose ${HOME} --verbose local ${HOME} | 'quoted text'
+		readonly $(pwd) then then $(pwd) 'quoted text'
+		local export -eu local "$@" test ${HOME} then | --verbose --verbose
+printf | echo "$1" awk awk readonly "$@" local | --verbose
+-eu test /usr/bin /usr/bin 'quoted text'
+		${HOME} "$1" printf "$1" | -eu
+awk 2>/dev/null ${HOME}
+		cd sed | sed && && --verbose cd
+'quoted text' && -eu "$1" | export --verbose cd
+| grep export awk printf && then /usr/bin grep awk sed ${HOME} | cd -eu cd "$@"
+&& ${HOME} "$1" then && test done echo x=1
+		"$@" echo --verbose test "$@" /usr/bin -eu
+	/usr/bin x=1 local test local
+	echo /usr/bin readonly export 'quoted text' |
+-eu export local x=1 printf then "$1" test --verbose test export printf
+| export echo test 'quoted text' printf $(pwd) printf grep 2>/dev/null
+		done readonly 'quoted text' "$@" && awk test "$1" printf
+		done 'quoted text' ${HOME} then "$@" ${HOME}
+		2>/dev/null -eu echo | "$1" | "$@" "$@"
+	"$@" x=1 'quoted text'
+		grep local /usr/bin test "$@"
+	x=1 cd 'quoted text' sed 2>/dev/null
+--verbose $(pwd) -eu -eu ${HOME} done ${HOME} 'quoted text'
+	$(pwd) "$@" printf awk ${HOME} sed "$@" local awk $(pwd) echo
+	--verbose && local sed "$1" -eu awk printf "$1"
+		"$1" sed "$1" && then ${HOME} sed --verbose printf $(pwd) ${HOME}
+		cd cd done printf test "$1" /usr/bin
+		$(pwd) 2>/dev/null then /usr/bin awk x=1 $(pwd) awk done
+	awk ${HOME} x=1 "$1" 'quoted text'
+x=1 x=1 ${HOME} "$1" done 2>/dev/null done $(pwd) then 'quoted text'
+	test 2>/dev/null grep readonly ${HOME} done
+		sed "$1" --verbose -eu done 'quoted text' 'quoted text' 2>/dev/null 2>/dev/null
+printf --verbose | --verbose --verbose | | cd cd
+		readonly /usr/bin && | ${HOME} grep "$@" "$1" echo
+		printf 2>/dev/null 2>/dev/null echo test $(pwd) x=1
+test 2>/dev/null -eu cd readonly then export ${HOME} then
+		/usr/bin -eu sed printf
+		awk | 2>/dev/null 'quoted text' "$1" --verbose echo test grep --verbose then ${HOME}
+then done 'quoted text' sed export
+local awk sed done echo 'quoted text' done
+		2>/dev/null export 'quoted text' test --verbose /usr/bin | /usr/bin | 'quoted text'
+x=1 2>/dev/null "$1" awk ${HOME} 'quoted text' awk ${HOME}
+grep export awk x=1 /usr/bin local grep 2>/dev/null $(pwd) $(pwd) test done
+"$@" awk cd then then test grep
+&& export then export --verbose -eu
+		local -eu 2>/dev/null x=1 | && 'quoted text'
+		$(pwd) --verbose /usr/bin export cd then $(pwd) echo ${HOME} "$@" 'quoted text'
+		x=1 printf cd && ${HOME} sed | && printf
+	sed readonly /usr/bin printf test | local 2>/dev/null local ${HOME}
+		--verbose grep /usr/bin --verbose cd -eu grep
+		readonly | done ${HOME} && readonly 'quoted text' printf printf ${HOME} awk -eu
+export grep readonly printf -eu test cd test sed echo echo
+		printf 'quoted text' awk cd $(pwd) cd cd grep then | --verbose
+-eu cd 'quoted text' $(pwd) echo readonly sed | ${HOME}
+done export 'quoted text' grep export grep ${HOME} ${HOME} export && ${HOME}
+readonly 2>/dev/null local
+	test "$@" sed 'quoted text' $(pwd) echo | cd && test ${HOME}
+		2>/dev/null done x=1 readonly ${HOME} then && -eu local done echo &&
+cd ${HOME} --verbose 2>/dev/null export ${HOME} 'quoted text' then local 2>/dev/null
+	cd awk 'quoted text' export done "$@"
+	export readonly readonly done printf
+"$@" sed sed export x=1 -eu done readonly
+2>/dev/null $(pwd) --verbose local
+		2>/dev/null test test awk printf /usr/bin $(pwd) grep grep export then &&
+	printf test printf grep "$1" awk printf awk
+		--verbose x=1 local printf done awk "$1" awk awk
+then readonly $(pwd) grep
+	cd "$@" "$@" export 2>/dev/null && sed /usr/bin printf
+	local echo 2>/dev/null "$@" readonly grep cd
+grep printf ${HOME} done $(pwd) 2>/dev/null printf done test export /usr/bin local
+		2>/dev/null ${HOME} readonly printf
+		'quoted text' "$1" awk
+		"$@" -eu test ${HOME} x=1 then | -eu local "$1" awk
+		export readonly export export "$@" 2>/dev/null "$1" test readonly
+		${HOME} $(pwd) ${HOME} export | | local $(pwd) readonly 2>/dev/null -eu
+		${HOME} then 2>/dev/null cd
+"$1" readonly test $(pwd) x=1 --verbose "$1" && done then
+		&& -eu 'quoted text' /usr/bin sed --verbose
+		'quoted text' echo test echo && echo export && 2>/dev/null --verbose
+		done 'quoted text' x=1 grep cd test | grep /usr/bin sed
+-eu x=1 done /usr/bin && readonly cd ${HOME} "$1" sed --verbose
+2>/dev/null awk -eu export printf --verbose then && done then cd printf
+| && grep test local --verbose readonly
+then printf /usr/bin -eu printf && -eu
+$(pwd) local readonly sed 2>/dev/null
+	| done sed printf awk -eu &&
+		"$@" "$1" echo export awk then echo then --verbose grep
+		'quoted text' done test x=1 -eu sed 2>/dev/null readonly
+echo echo echo "$1" $(pwd) --verbose /usr/bin local
+	$(pwd) "$1" ${HOME} test && local "$1" then then cd "$@" echo readonly
+	echo grep "$@" readonly && | printf cd grep
+sed local "$@" | test
+&& test $(pwd) grep readonly "$1" export
+	export local x=1 cd readonly export
+		'quoted text' export sed && printf --verbose
+export grep $(pwd) $(pwd)
+		awk printf 2>/dev/null test --verbose
+		sed export -eu "$@" --verbose 'quoted text' done local --verbose 2>/dev/null
+	$(pwd) done export echo awk -eu readonly && grep echo
+		x=1 echo export | 2>/dev/null awk /usr/bin && ${HOME} -eu cd 2>/dev/null
+		export test --verbose grep local then awk
+	$(pwd) awk x=1 "$@" local | /usr/bin done "$@" sed | local "$1"
+	--verbose awk $(pwd) printf cd export $(pwd) $(pwd) printf --verbose
+sed cd --verbose export awk grep test 'quoted text' $(pwd) grep
+	"$1" --verbose awk grep test "$@" && "$1" cd 2>/dev/null && local
+	then test echo test printf && sed local "$1" local 'quoted text' printf
+		done readonly sed local grep /usr/bin "$1" test
+--verbose | grep && local "$@" /usr/bin done 2>/dev/null
+readonly awk export test -eu cd sed -eu ${HOME}
+	echo done readonly done
+grep grep 'quoted text' cd local sed done grep sed 'quoted text' 2>/dev/null
+	/usr/bin awk | echo | | awk -eu export
+2>/dev/null cd test grep
+	local 'quoted text' x=1 then cd echo 2>/dev/null 'quoted text' sed
+	echo | export && done "$@"
+	awk "$@" then "$@" 'quoted text' grep -eu -eu echo -eu
+		readonly && sed $(pwd) "$1" && | printf export 'quoted text' $(pwd) "$1"
+	sed grep printf test $(pwd) test --verbose grep local awk then
+cd 'quoted text' then 'quoted text' test cd export printf printf
+		grep 'quoted text' -eu "$1" /usr/bin "$1" sed 'quoted text' /usr/bin $(pwd)
+$(pwd) "$@" --verbose export x=1 --verbose then grep ${HOME} awk printf
+		"$@" echo /usr/bin done --verbose /usr/bin -eu 'quoted text' test
+		echo local test local
+		readonly grep 2>/dev/null grep readonly then 2>/dev/null "$@" cd x=1 ${HOME}
+'quoted text' test sed awk
+&& readonly && echo sed --verbose awk
+	echo then ${HOME} && ${HOME} readonly local "$1" printf
+	test cd sed sed | sed $(pwd) 2>/dev/null sed
+		/usr/bin && sed 'quoted text' "$1" | local
+		export ${HOME} export | -eu local
+done -eu readonly awk test x=1
+-eu x=1 -eu /usr/bin | grep |
+${HOME} local echo printf
+"$1" ${HOME} | done 'quoted text' grep test
+&& printf --verbose echo /usr/bin grep then --verbose
+		x=1 ${HOME} readonly sed "$@" grep then "$@" cd grep && ${HOME}
+	test export readonly $(pwd) done && 2>/dev/null "$1" "$1" awk $(pwd) done
+cd x=1 sed "$1" awk "$1" cd /usr/bin cd x=1 cd printf $(pwd) echo ${HOME}
+		x=1 echo "$@" echo grep test x=1 /usr/bin echo echo then "$@" grep "$@" 'quoted text'
+	2>/dev/null $(pwd) x=1 --verbose test done -eu /usr/bin
+	"$@" -eu export echo | sed sed --verbose
+		grep echo echo sed local
+export cd x=1 printf /usr/bin printf | local 2>/dev/null
+	"$@" cd sed printf test "$@" grep done readonly
+	-eu cd "$@" "$@" && "$@" export printf test /usr/bin 'quoted text'
+	x=1 x=1 /usr/bin then && readonly x=1 cd "$1" $(pwd) cd
+	done 'quoted text' /usr/bin /usr/bin sed 'quoted text' | x=1 sed then -eu awk test
+	"$1" then local /usr/bin "$@" 'quoted text' grep -eu "$@" 2>/dev/null
+done $(pwd) export "$@" cd done export "$1" ${HOME}
+		$(pwd) printf cd local x=1
+		export x=1 "$@" awk 'quoted text' done readonly ${HOME}
+		export local /usr/bin printf -eu -eu 'quoted text' $(pwd)
+	then | 2>/dev/null 2>/dev/null 'quoted text' x=1
+		export printf then "$@" 2>/dev/null test readonly && 2>/dev/null test 'quoted text'
+		| awk | export x=1 grep "$1" /usr/bin done $(pwd) echo "$1" sed
+	| x=1 --verbose -eu sed | && ${HOME} test
+$(pwd) "$@" 'quoted text'
+printf cd local "$1" awk 'quoted text'
+		grep --verbose /usr/bin -eu && grep export local printf 'quoted text' $(pwd)
+		"$@" sed sed /usr/bin done x=1 --verbose
+done sed x=1 sed 'quoted text' grep test then
+	$(pwd) cd -eu | local "$1" done then 2>/dev/null cd
+		2>/dev/null && 'quoted text' "$1" sed x=1 local 'quoted text'
+	${HOME} --verbose 2>/dev/null x=1 | --verbose /usr/bin then cd ${HOME}
+done echo | then cd then export test x=1 then -eu readonly
+		"$1" ${HOME} /usr/bin ${HOME} grep awk "$@" echo done
+/usr/bin && readonly -eu 'quoted text' test local readonly then
+sed printf 'quoted text' | local test 2>/dev/null 'quoted text' then
+${HOME} ${HOME} then local 'quoted text' "$@"
+		&& && echo && test echo local done
+		x=1 x=1 export awk $(pwd) sed readonly
+echo x=1 readonly printf
+		local 2>/dev/null /usr/bin done 2>/dev/null
+		sed 2>/dev/null 2>/dev/null grep /usr/bin -eu local --verbose local
+		-eu | local "$@" 2>/dev/null
+		sed grep export echo x=1 && printf readonly
+		/usr/bin /usr/bin local export
+		grep grep "$1" ${HOME} awk ${HOME} "$1" 'quoted text' "$1" 'quoted text'
+	test then $(pwd) /usr/bin awk && && echo --verbose
+	"$1" "$@" -eu $(pwd) && 'quoted text' "$1"
+echo x=1 then $(pwd) grep "$1"
+	--verbose export echo awk done echo "$1"
+	grep then echo printf && $(pwd) -eu export local readonly $(pwd) then local grep
+cd "$@" | awk $(pwd) 'quoted text' printf "$@" test x=1 --verbose
+		| test 2>/dev/null --verbose grep grep echo sed --verbose
+"$@" cd 'quoted text' sed ${HOME} readonly cd /usr/bin
+sed "$@" ${HOME} --verbose 2>/dev/null
+		x=1 --verbose export $(pwd) awk sed done readonly ${HOME} printf /usr/bin
+		sed --verbose printf printf && grep cd printf awk sed | $(pwd) /usr/bin
+	--verbose grep awk ${HOME} export --verbose --verbose /usr/bin $(pwd)
+sed then && --verbose awk echo test 'quoted text'
+	done local && "$1" done echo sed sed then readonly
+$(pwd) ${HOME} 2>/dev/null readonly "$@" echo "$@" "$@" ${HOME} ${HOME}
+2>/dev/null echo echo echo printf ${HOME} done
+		done ${HOME} $(pwd) "$@" "$@" cd awk --verbose then then && export
+export "$1" --verbose | readonly && test
+'quoted text' export "$@" cd /usr/bin then "$1" local then "$@"
+	| grep "$1" printf grep local test sed 2>/dev/null awk 2>/dev/null
+		x=1 grep "$@" && local then --verbose x=1 $(pwd) ${HOME} printf "$@" then 'quoted text'
+export done sed ${HOME} | local readonly readonly readonly printf
+	then | $(pwd) "$1" test local printf export 'quoted text' ${HOME}
+--verbose "$1" x=1 local "$1" /usr/bin "$@" echo 'quoted text' done ${HOME}
+grep printf then grep 'quoted text' sed && | "$1" /usr/bin printf export
+		-eu | local --verbose x=1 awk "$@"
+	&& "$1" export test -eu 'quoted text'
+awk ${HOME} local 'quoted text'
+2>/dev/null /usr/bin export test export
+		local echo readonly "$@" test test test echo local
+	/usr/bin grep "$@" grep 2>/dev/null | x=1 "$1" sed | then ${HOME}
+		test 'quoted text' /usr/bin
+local ${HOME} -eu echo cd 'quoted text' sed test export
+		sed printf 2>/dev/null grep x=1 && awk then | grep 2>/dev/null cd ${HOME} test export
+		readonly cd /usr/bin readonly
+--verbose done && $(pwd) done -eu ${HOME} grep "$@"
+	done "$1" "$1" awk --verbose 2>/dev/null
+| echo | grep echo export x=1 x=1 | "$1" x=1 2>/dev/null
+	awk && echo awk cd printf
+then 'quoted text' grep x=1 && sed "$@" cd -eu ${HOME} then -eu 'quoted text'
+"$1" | 'quoted text'
+	readonly export && readonly 'quoted text'
+cd /usr/bin grep /usr/bin "$1" --verbose printf ${HOME} echo then printf -eu
+printf echo export "$1" -eu readonly done | test --verbose
+	--verbose 2>/dev/null $(pwd) "$1" "$1" then && readonly /usr/bin
+	'quoted text' done printf "$@"
+"$@" readonly "$1" cd export printf 2>/dev/null then && local | printf /usr/bin
+		/usr/bin "$@" export 'quoted text' "$1" printf
+		| && /usr/bin | local 'quoted text' done readonly sed -eu local local test readonly
+| $(pwd) grep && readonly 'quoted text'
+	| --verbose local cd awk ${HOME} then ${HOME} grep x=1 $(pwd) then
+		done x=1 | export export printf printf && echo "$@" 2>/dev/null -eu
+		${HOME} $(pwd) 'quoted text' 2>/dev/null ${HOME}
+sed grep printf grep "$@"
+		&& 'quoted text' && && sed printf
+	then /usr/bin -eu | | | local | "$1" awk "$@"
+/usr/bin readonly test ${HOME}
+		&& 2>/dev/null done test printf 'quoted text' done 2>/dev/null 'quoted text'
+awk "$1" $(pwd) | printf then printf --verbose test
+printf test echo test "$@" readonly cd -eu --verbose 2>/dev/null
+		x=1 local "$1" /usr/bin -eu
+		sed 'quoted text' then $(pwd) done test readonly 'quoted text' sed | "$1"
+	readonly echo test -eu && cd ${HOME} done printf 2>/dev/null test | $(pwd)
+readonly /usr/bin /usr/bin "$@" awk echo cd -eu 'quoted text' echo
+		export test -eu 'quoted text' printf then --verbose -eu | done export grep cd
+&& then export && readonly then cd "$@"
+	/usr/bin local sed grep
+x=1 ${HOME} local readonly test "$@" ${HOME} awk --verbose
+	x=1 -eu echo local grep $(pwd) 2>/dev/null
+		x=1 printf readonly cd sed "$1" export local export readonly
+		| $(pwd) /usr/bin 'quoted text' cd
+done $(pwd) grep "$1" printf echo cd echo then $(pwd)
+		/usr/bin 'quoted text' grep test -eu test && /usr/bin $(pwd) readonly
+	-eu 2>/dev/null ${HOME} 'quoted text' printf --verbose then /usr/bin
+		${HOME} then "$@" export local 'quoted text' awk | $(pwd) test sed "$1" "$1" export
+		awk -eu $(pwd) readonly ${HOME} "$1" awk /usr/bin export sed | done local readonly
+"$@" export awk sed cd $(pwd) awk 2>/dev/null
+-eu done readonly $(pwd) -eu printf printf -eu
+		"$@" /usr/bin ${HOME} --verbose 2>/dev/null
+	x=1 then /usr/bin "$1" --verbose $(pwd) awk readonly
+	| | && x=1 printf local x=1 cd done printf | then "$1" $(pwd) grep "$1" grep "$@"
+cd && test ${HOME} 'quoted text' test echo
+	grep awk "$1" test readonly -eu cd sed done /usr/bin /usr/bin ${HOME} 'quoted text'
+sed echo test x=1 printf | ${HOME} /usr/bin "$1" cd grep awk grep
+$(pwd) /usr/bin 2>/dev/null | "$@" ${HOME} --verbose $(pwd)
+$(pwd) test test then test x=1 x=1 local "$@" test | awk printf
+		cd awk ${HOME} local "$@" local printf sed && $(pwd) x=1 && | 'quoted text'
+${HOME} grep -eu readonly printf grep -eu local readonly /usr/bin
+		"$@" echo 'quoted text'
+		cd cd "$@" --verbose "$1" "$1" then local 'quoted text' done
+	| "$1" x=1 "$1" grep --verbose | "$@" local -eu done cd "$@"
+		2>/dev/null local awk && grep x=1 | ${HOME}
+	then sed "$1" x=1 awk done local | readonly
+		"$@" sed printf printf "$@" printf 2>/dev/null "$1" 'quoted text' ${HOME}
+	${HOME} ${HOME} grep readonly 'quoted text' --verbose "$@" then readonly "$@"
+	$(pwd) 'quoted text' cd /usr/bin awk "$1" -eu done x=1 x=1 x=1 local 'quoted text'
+sed /usr/bin "$@" test "$1" test -eu $(pwd) 'quoted text' 'quoted text'
+	2>/dev/null grep grep local 2>/dev/null then && ${HOME} local local
+		readonly --verbose x=1 "$1"
+	${HOME} x=1 export | sed 'quoted text' local test -eu x=1 2>/dev/null
+export printf readonly local 'quoted text' 'quoted text'
+	local then 'quoted text' "$1" && /usr/bin -eu -eu
+		--verbose ${HOME} printf && | then echo
+-eu readonly cd x=1 "$@" grep --verbose
+	grep ${HOME} x=1 "$@" grep echo export readonly test
+| done -eu $(pwd) then echo /usr/bin -eu ${HOME} local export echo /usr/bin
+2>/dev/null ${HOME} local 'quoted text' --verbose --verbose
+	awk awk printf ${HOME} x=1 sed ${HOME}
+		| "$1" /usr/bin $(pwd) local x=1 'quoted text'
+	export "$@" 2>/dev/null && then ${HOME}
+echo sed $(pwd) awk printf x=1 printf | sed sed then cd printf
+		export | then x=1 --verbose 2>/dev/null &&
+awk local done /usr/bin printf grep readonly
+echo readonly awk /usr/bin
+x=1 -eu 'quoted text' "$@" 2>/dev/null cd done readonly cd echo ${HOME}
+readonly sed 'quoted text' ${HOME} done local --verbose sed
+done local -eu "$@" "$1" cd /usr/bin test cd /usr/bin 2>/dev/null /usr/bin
+	"$1" grep then grep "$@" awk cd echo done then readonly grep
+local "$1" ${HOME} test local ${HOME} echo grep grep echo done awk sed local printf
+	x=1 $(pwd) done local x=1 done then x=1 awk export "$1" 2>/dev/null
+x=1 -eu done "$1" local /usr/bin -eu && && x=1 "$@" grep x=1 $(pwd) sed printf
+	awk test /usr/bin export grep | cd cd ${HOME} /usr/bin cd export "$@" /usr/bin
+	done -eu --verbose /usr/bin export --verbose /usr/bin -eu | && local
+		sed test --verbose test grep x=1 /usr/bin
+	test 'quoted text' ${HOME}
+echo done "$@" "$@" | echo && -eu export sed | echo done $(pwd)
+		"$@" sed local $(pwd) export awk 2>/dev/null grep awk
+		"$1" && 'quoted text' /usr/bin x=1 then /usr/bin
+	2>/dev/null /usr/bin | readonly --verbose
+	"$1" 2>/dev/null readonly -eu awk grep && export grep x=1 cd done then grep ${HOME}
+done 2>/dev/null && grep 2>/dev/null ${HOME} cd export | 'quoted text' cd
+		"$1" --verbose | $(pwd) printf
+		grep awk cd 'quoted text' -eu && | awk ${HOME}
+	2>/dev/null echo --verbose -eu cd sed then
+cd /usr/bin 2>/dev/null "$1" $(pwd) sed cd
+		test && x=1 ${HOME} awk ${HOME}
+test --verbose grep awk cd "$@" done echo echo done --verbose
+		&& grep local | /usr/bin -eu -eu sed 2>/dev/null cd x=1 test readonly grep -eu
+		'quoted text' -eu 'quoted text' x=1 echo grep
+	--verbose && printf readonly local export export awk readonly $(pwd) 'quoted text'
+	--verbose awk -eu printf then --verbose ${HOME}
+		"$1" "$@" "$@" cd grep done awk | export cd echo ${HOME} x=1
+		-eu printf /usr/bin test printf printf awk done -eu printf
+	"$1" cd printf --verbose -eu printf 'quoted text' readonly
+		sed test test printf "$1" sed --verbose
+		then readonly sed && -eu then
+	test readonly echo --verbose
+		"$1" | printf grep awk /usr/bin awk test 'quoted text' grep readonly && "$@"
+		readonly /usr/bin "$1" grep --verbose -eu readonly
+sed done /usr/bin local echo | | then cd "$1" $(pwd) $(pwd)
+	2>/dev/null "$@" ${HOME} -eu $(pwd) "$@" /usr/bin /usr/bin "$1"
+		printf done readonly export then 'quoted text' ${HOME} "$@"
+done 2>/dev/null readonly test echo done x=1 local --verbose awk echo
+	"$@" "$1" ${HOME} readonly grep readonly ${HOME} | export $(pwd)
+		sed "$1" --verbose sed grep local awk -eu "$@" 'quoted text' "$1" test
+	cd echo export 2>/dev/null
+	${HOME} 2>/dev/null | 'quoted text' echo | ${HOME}
+	"$@" export 2>/dev/null printf grep "$1" | $(pwd)
+local "$1" sed grep readonly printf local echo "$1" awk "$1" export 2>/dev/null
+		"$@" local then "$@" --verbose --verbose grep test "$@" 'quoted text' "$@"
+	-eu ${HOME} done "$@" 'quoted text'
+	test 'quoted text' sed $(pwd)
+	"$@" awk test x=1 sed $(pwd) --verbose "$1" readonly | echo ${HOME}
+	&& test -eu --verbose sed export 'quoted text'
+		echo echo done ${HOME} 2>/dev/null awk -eu ${HOME} awk | -eu && &&
+local "$1" cd readonly test cd ${HOME}
+	"$@" sed /usr/bin echo 'quoted text' then --verbose local then readonly
+	echo cd then "$1" 'quoted text' grep 2>/dev/null test
+		'quoted text' readonly && echo sed && local -eu printf export --verbose
+		cd echo x=1 export local 2>/dev/null
+		${HOME} then | $(pwd) printf printf 'quoted text' ${HOME}
+2>/dev/null && "$1" | grep ${HOME} $(pwd)
+		local sed "$@" echo readonly && awk | test readonly $(pwd) awk --verbose
+done then && test cd "$1" echo
+"$@" printf awk $(pwd) -eu done -eu $(pwd) echo printf
+		"$@" grep readonly cd grep local 'quoted text' 2>/dev/null -eu grep local local
+$(pwd) "$1" --verbose done done then 2>/dev/null && "$@" sed 'quoted text'
+		"$@" local grep ${HOME} 2>/dev/null x=1 readonly --verbose --verbose
+-eu printf | printf "$@" printf cd awk grep printf grep "$1" test export --verbose
+"$@" | -eu -eu then awk "$@" sed | ${HOME} sed "$@" $(pwd) -eu printf "$1"
+		export --verbose test readonly export readonly "$@"
+		--verbose -eu && /usr/bin ${HOME}
+"$@" readonly && test cd /usr/bin local awk $(pwd) cd readonly
+		--verbose then | printf "$1" | then then sed printf /usr/bin "$@" $(pwd)
+then cd done 2>/dev/null /usr/bin && $(pwd) | test "$@" 'quoted text' ${HOME} cd
+		| "$1" ${HOME} $(pwd) grep /usr/bin
+	cd "$1" "$1" grep awk local
+		| grep "$1" | --verbose export x=1 printf echo 2>/dev/null
+	2>/dev/null printf "$1" awk grep -eu sed "$@" readonly x=1 x=1 cd export
+		then echo ${HOME} -eu 'quoted text' done
+	&& printf cd sed printf $(pwd) "$@" echo $(pwd) export && --verbose 2>/dev/null
+		x=1 echo $(pwd) cd x=1 "$1" sed awk ${HOME} printf readonly "$@" then
+&& ${HOME} 'quoted text' grep "$1" && "$@" ${HOME} ${HOME} echo then ${HOME} &&
+	readonly done $(pwd) ${HOME} test readonly
+	$(pwd) then x=1 then printf done cd "$1" sed 2>/dev/null done 'quoted text' &&
+	awk -eu 2>/dev/null -eu ${HOME}
+	$(pwd) then 'quoted text' 2>/dev/null
+		x=1 printf | "$1" test 2>/dev/null cd --verbose ${HOME} --verbose $(pwd) /usr/bin
+		&& done echo export then readonly sed /usr/bin test ${HOME} 2>/dev/null
+		-eu /usr/bin | echo -eu $(pwd) test --verbose local done export
+2>/dev/null awk export done done 'quoted text' | echo
+-eu 'quoted text' -eu /usr/bin sed local
+		--verbose "$1" "$1" done cd awk echo $(pwd) | /usr/bin ${HOME}
+		2>/dev/null then local export
+	test local printf 2>/dev/null /usr/bin
+${HOME} | printf cd "$@" x=1 printf 'quoted text' | /usr/bin echo /usr/bin
+	local && echo done sed awk
+readonly then /usr/bin $(pwd) export 2>/dev/null &&
+		echo 2>/dev/null then sed done awk printf 2>/dev/null echo printf
+	cd grep $(pwd) 'quoted text' 'quoted text' echo $(pwd) printf local export
+$(pwd) 'quoted text' export "$@" test sed
+sed 'quoted text' awk done /usr/bin test
+sed local 'quoted text' cd export printf x=1 --verbose test $(pwd) export echo
+		cd 'quoted text' 2>/dev/null ${HOME} echo -eu test
+		$(pwd) && sed /usr/bin cd then printf local $(pwd) sed "$@" ${HOME}
+		--verbose readonly printf x=1 /usr/bin 'quoted text' readonly
+--verbose awk | then /usr/bin 2>/dev/null -eu export && /usr/bin
+	"$1" "$1" 2>/dev/null ${HOME} local
+		test 2>/dev/null -eu $(pwd) readonly /usr/bin sed
+	/usr/bin local sed sed readonly echo test $(pwd) ${HOME} --verbose /usr/bin
+		&& grep test | grep -eu local /usr/bin "$1" x=1
+	| readonly readonly "$1" "$@" --verbose echo "$@" && test $(pwd)
+		grep grep "$@" x=1 | sed
+		"$1" local printf then $(pwd) printf && sed "$1" awk && awk /usr/bin
+local -eu done && test then done then export cd then && "$@" grep &&
+echo $(pwd) sed ${HOME} awk $(pwd) 'quoted text' awk "$@"
+	awk done local done "$@" sed && awk /usr/bin grep readonly /usr/bin 2>/dev/null
+	| -eu local x=1 "$1" test then grep printf /usr/bin cd -eu ${HOME} --verbose
+	"$@" test "$1" x=1 $(pwd) echo cd 'quoted text' awk local 2>/dev/null
+		export 'quoted text' echo "$1" printf | 2>/dev/null $(pwd) readonly
+'quoted text' then && sed 'quoted text' 'quoted text' 2>/dev/null && | 'quoted text'
+		echo && echo && /usr/bin local /usr/bin
+	grep 2>/dev/null $(pwd) 'quoted text' readonly grep grep local then local printf
+	sed /usr/bin 2>/dev/null then x=1 && grep ${HOME}
+		then -eu "$1" && "$@" && cd
+	then then test | 2>/dev/null awk
+	'quoted text' cd 'quoted text' cd
+		local local local done /usr/bin local x=1 sed readonly 'quoted text'
+	'quoted text' "$1" sed $(pwd) --verbose | echo test export
+then readonly cd /usr/bin "$@" 2>/dev/null done &&
+	readonly then 'quoted text' /usr/bin $(pwd) sed && printf
+	grep printf | "$@" | 2>/dev/null printf readonly done "$1" readonly
+--verbose then x=1 --verbose
+		local --verbose && done $(pwd) x=1 && $(pwd) readonly cd /usr/bin 2>/dev/null
+	"$1" readonly test printf $(pwd) ${HOME} echo readonly "$@" 'quoted text'
+printf /usr/bin printf | grep "$1" cd -eu local local printf ${HOME}
+	x=1 sed sed /usr/bin awk $(pwd) ${HOME} done $(pwd) echo awk && printf "$1"
+		local --verbose x=1 "$@"
+printf printf /usr/bin | | 'quoted text' --verbose 'quoted text' echo
+printf sed ${HOME} "$@" 2>/dev/null 2>/dev/null 2>/dev/null
+		/usr/bin && cd /usr/bin 2>/dev/null then 2>/dev/null
+		printf echo export awk test sed $(pwd) then 2>/dev/null ${HOME}
+		"$1" 2>/dev/null grep --verbose sed sed --verbose awk readonly
+		'quoted text' 'quoted text' && export local 'quoted text' grep sed local "$@" /usr/bin
+local 'quoted text' test -eu "$1" | cd echo echo --verbose $(pwd) cd
+	"$@" grep 'quoted text' awk | "$@" x=1 "$@" grep readonly
+	awk export test && --verbose
+--verbose echo | test cd local
+readonly "$@" -eu echo "$1" "$@" ${HOME}
+echo && && export done done printf
+		then x=1 sed /usr/bin export sed readonly "$@"
+	-eu /usr/bin sed sed export --verbose sed
+		"$1" $(pwd) grep grep grep grep
+export && echo 2>/dev/null cd "$1"
+		$(pwd) "$@" "$1" 2>/dev/null
+sed x=1 /usr/bin "$1" x=1 done
+	done test awk --verbose then -eu "$1" | done
+$(pwd) done done printf
+		&& then && ${HOME} "$@" x=1 "$@" sed test export
+		echo $(pwd) --verbose /usr/bin ${HOME} then 2>/dev/null
+		sed local && sed awk sed cd test
+grep done && ${HOME} ${HOME} "$@" awk /usr/bin
+		2>/dev/null awk echo | printf readonly
+export export readonly 2>/dev/null then cd -eu test "$@" | local -eu | cd ${HOME}
+		local then $(pwd) awk sed then 'quoted text' awk ${HOME} grep
+		cd done grep -eu then | "$@" then -eu $(pwd) printf printf --verbose
+		readonly grep /usr/bin 2>/dev/null grep "$1" "$@" --verbose
+		$(pwd) export then awk printf cd 2>/dev/null
+	x=1 grep $(pwd) --verbose readonly done sed
+	cd done "$@" | --verbose 2>/dev/null
+	/usr/bin ${HOME} cd readonly export then then local ${HOME} ${HOME}
+		/usr/bin "$@" /usr/bin 2>/dev/null
+${HOME} done "$@" then awk -eu grep
+	${HOME} -eu then x=1 2>/dev/null $(pwd)
+		2>/dev/null ${HOME} then test 'quoted text' readonly export local
+${HOME} cd $(pwd) local | done | sed grep then echo
+grep cd && | echo then --verbose /usr/bin grep 'quoted text' 'quoted text'
+	2>/dev/null "$@" export
+		"$1" 'quoted text' local local $(pwd) 'quoted text'
+2>/dev/null | -eu sed
+		printf ${HOME} readonly 2>/dev/null export
+	| x=1 "$@" done && sed --verbose "$1" 'quoted text' "$@" done echo --verbose --verbose
+		grep 'quoted text' cd echo export
+	printf awk "$1" sed local "$1" -eu cd export /usr/bin local
+		/usr/bin sed x=1 export 'quoted text' test -eu x=1 export | &&
+	printf export then sed then | sed local test $(pwd) sed && export local
+		cd grep ${HOME} | /usr/bin test
+		sed --verbose 'quoted text' -eu && done sed echo $(pwd)
+		$(pwd) && export && printf echo cd "$@" 2>/dev/null
+echo 'quoted text' | test "$@" /usr/bin x=1 cd
+--verbose printf x=1 awk 'quoted text' local
+	printf local -eu $(pwd) echo grep /usr/bin | 2>/dev/null local
+	grep -eu x=1 cd awk grep awk -eu "$1" readonly echo ${HOME} "$1" done "$1"
+#include c98.sh
+		test done && $(pwd) -eu awk $(pwd) test echo sed x=1 &&
+	"$@" --verbose sed sed awk local "$1" && export
+then x=1 awk cd sed 2>/dev/null
+		-eu -eu sed $(pwd) -eu $(pwd) -eu ${HOME}
+| awk --verbose ${HOME} grep echo test then --verbose test
+		grep x=1 ${HOME} 2>/dev/null --verbose "$1" echo grep export
+	awk "$@" grep 2>/dev/null
+		grep 2>/dev/null then -eu ${HOME} readonly && cd printf
+&& | -eu ${HOME} local echo 'quoted text' 2>/dev/null
+		export "$@" test echo sed
+grep ${HOME} local grep awk 2>/dev/null -eu done sed
+		-eu done | grep /usr/bin export export echo --verbose readonly
+		readonly readonly readonly then awk && local grep $(pwd)
+	test then then cd grep done -eu -eu local x=1 && done "$1" export
+"$@" awk "$@" done grep 'quoted text'
+		'quoted text' awk --verbose -eu grep ${HOME} grep printf printf local export
+export 'quoted text' 2>/dev/null 'quoted text' $(pwd) "$@" "$@" && | 2>/dev/null
+		"$@" echo -eu cd sed x=1 --verbose done then "$1"
+	printf $(pwd) /usr/bin then local printf local
+printf cd grep "$1" x=1 && sed ${HOME}
+| x=1 echo echo x=1 then then
+		done "$1" done | test "$@" sed cd done echo echo
+	local grep x=1 ${HOME} then awk
+x=1 2>/dev/null | readonly "$@" done export
+		readonly grep | grep --verbose 'quoted text'
+		cd /usr/bin grep | grep 'quoted text' local && grep cd awk "$@"
+		readonly test "$1" | cd --verbose $(pwd) 'quoted text' cd 'quoted text'
+&& awk echo "$1" && then --verbose
+echo printf awk ${HOME} -eu export local -eu $(pwd) test printf ${HOME}
+		done export printf then test "$@"
+"$@" done "$1" 2>/dev/null -eu | ${HOME} local 'quoted text' local /usr/bin
+		awk test grep sed grep local export 'quoted text'
+	/usr/bin "$@" /usr/bin ${HOME}
+		then sed awk awk test | test "$@" grep "$1" cd 2>/dev/null "$@"
+	$(pwd) test grep --verbose then x=1 readonly x=1 ${HOME} awk "$@" "$@" sed done
+	awk sed local then grep awk -eu "$1" done
+awk | ${HOME} --verbose grep
+		2>/dev/null | 2>/dev/null done x=1 -eu cd ${HOME} test grep
+		${HOME} sed cd export 2>/dev/null
+	awk done /usr/bin "$@" readonly export x=1 then readonly test 2>/dev/null done test
+		printf $(pwd) /usr/bin printf "$@" --verbose printf && | sed -eu awk --verbose
+	x=1 /usr/bin --verbose "$1" local then printf 'quoted text'
+		'quoted text' $(pwd) -eu export && ${HOME} x=1 cd grep
+		/usr/bin readonly export echo grep
+		printf then cd --verbose then readonly --verbose && x=1 awk
+	'quoted text' 2>/dev/null done --verbose cd sed sed "$@" && printf
+		2>/dev/null echo then export 2>/dev/null test readonly test cd && $(pwd) test
+		awk x=1 "$@" awk done -eu
+/usr/bin 'quoted text' cd 'quoted text' then -eu "$1" $(pwd) 2>/dev/null ${HOME}
+test $(pwd) awk 'quoted text' local -eu $(pwd) -eu /usr/bin
+		"$@" awk grep echo "$@" ${HOME} printf "$@" && ${HOME} --verbose -eu sed export
+		&& --verbose 'quoted text' sed then test "$1" |
+	awk local && /usr/bin | done
+		test 'quoted text' cd cd | --verbose export 'quoted text' 'quoted text'
+	--verbose then echo sed echo && test -eu
+done "$@" test grep done grep awk sed sed grep sed
+		| local && --verbose printf printf "$@" && sed
+	| then --verbose grep readonly /usr/bin
+		readonly && 'quoted text' done 'quoted text'
+		"$1" -eu local /usr/bin export
+		${HOME} then echo /usr/bin export readonly $(pwd) then "$1" test
+grep $(pwd) local printf grep grep printf /usr/bin done | x=1 'quoted text'
+local --verbose grep 2>/dev/null then "$1" awk cd
+		grep "$@" ${HOME} printf done
+		| readonly readonly printf -eu awk export 2>/dev/null cd test | test export export
+	export "$1" 'quoted text' --verbose then "$@" 2>/dev/null grep
+		--verbose --verbose sed echo
+		&& /usr/bin test && done 2>/dev/null
+		export sed "$@" /usr/bin 'quoted text'
+local awk grep local /usr/bin
+${HOME} readonly /usr/bin $(pwd)
+x=1 test 2>/dev/null -eu done 'quoted text' readonly
+		'quoted text' then | "$1" /usr/bin x=1 $(pwd) sed awk sed test printf "$1"
+cd | 2>/dev/null local && test $(pwd) $(pwd) awk then echo
+export awk "$@" | done grep "$1" then "$@" 'quoted text' readonly
+&& awk awk echo ${HOME} test /usr/bin "$@" then done 'quoted text' /usr/bin
+	local x=1 $(pwd) "$1" printf
+${HOME} $(pwd) 'quoted text' echo && "$@" 2>/dev/null x=1 done printf
+	sed sed export cd "$@" "$1" --verbose
+		cd $(pwd) grep cd 2>/dev/null local awk
+&& local test 'quoted text' grep sed export "$1" echo local export ${HOME}
+	export 2>/dev/null --verbose local then x=1 --verbose && && --verbose "$1"
+	&& ${HOME} 2>/dev/null local readonly cd x=1 printf done awk && ${HOME}
+	&& "$1" $(pwd) done done x=1 x=1 "$@" awk
+	local cd $(pwd) cd 2>/dev/null sed export readonly awk readonly
+	awk /usr/bin --verbose awk readonly cd --verbose | done echo sed
+	test 2>/dev/null && readonly readonly "$1" --verbose done $(pwd)
+-eu -eu cd sed /usr/bin && printf
+&& --verbose && cd test echo ${HOME}
+		"$1" cd "$@" "$1" readonly then awk | cd cd sed readonly cd local /usr/bin
+	"$1" echo echo cd echo local 2>/dev/null
+	export sed "$@" x=1 | /usr/bin 'quoted text' grep sed -eu ${HOME}
+	"$1" readonly done echo readonly x=1 2>/dev/null "$@" ${HOME} grep printf
+		&& done "$@" awk $(pwd) -eu test sed 2>/dev/null awk && /usr/bin
+		'quoted text' awk -eu awk done
+printf export echo | $(pwd)
+	| /usr/bin cd local /usr/bin awk test 'quoted text' done
+	done grep echo "$1" printf | 'quoted text' done
+		cd local -eu --verbose printf
+	cd /usr/bin then | -eu
+		&& /usr/bin 'quoted text' $(pwd) done "$@" "$1" awk
+	grep readonly readonly done x=1 2>/dev/null local
+sed $(pwd) 'quoted text' grep $(pwd) done readonly "$@" readonly readonly
+		export | 'quoted text' "$@" ${HOME} printf --verbose cd export export
+'quoted text' x=1 && cd
+		2>/dev/null local export test --verbose test export export export
+done sed ${HOME} local /usr/bin --verbose | ${HOME} 2>/dev/null export
+${HOME} test grep printf 'quoted text'
+	local done sed "$1" x=1 cd -eu 'quoted text' "$@" 2>/dev/null
+--verbose echo echo /usr/bin then grep | export
+	-eu local echo cd ${HOME}
+&& x=1 "$1" "$1" "$@" && export
+	then readonly "$@" /usr/bin export -eu cd
+sed done "$1" --verbose 'quoted text'
+cd 2>/dev/null done local 2>/dev/null local local "$1" then local
+		-eu readonly local && echo export cd ${HOME} grep
+	2>/dev/null "$1" --verbose 'quoted text' awk grep echo local --verbose grep export
+awk "$@" done awk sed grep cd x=1 grep 'quoted text'
+	-eu then x=1 /usr/bin printf echo /usr/bin x=1 $(pwd) done awk && done
+	cd 2>/dev/null done --verbose
+		| readonly done ${HOME} | "$@" then cd
+2>/dev/null sed | printf "$1" $(pwd)
+	-eu printf test grep $(pwd) test 'quoted text' sed printf ${HOME}
+		--verbose /usr/bin awk test && awk local 'quoted text' cd test local 2>/dev/null
+		'quoted text' test grep test printf /usr/bin
+	$(pwd) done then | x=1 x=1 readonly -eu
+		'quoted text' local printf test export grep 'quoted text'
+	| 'quoted text' cd | done sed "$@" "$@" export readonly
+x=1 2>/dev/null cd /usr/bin grep --verbose grep && grep $(pwd) sed | "$@" --verbose
+	x=1 "$@" export printf grep printf readonly echo 'quoted text' export
+		local local --verbose export 2>/dev/null |
+then "$@" x=1 /usr/bin && ${HOME} 'quoted text' local grep local
+		test printf --verbose ${HOME} && "$@" -eu && 2>/dev/null | --verbose then local
+	sed 2>/dev/null /usr/bin x=1 -eu grep "$1" -eu printf sed export export sed awk
+	2>/dev/null printf 'quoted text' $(pwd) 2>/dev/null -eu ${HOME} printf readonly
+	test 'quoted text' 2>/dev/null cd
+printf echo --verbose local -eu --verbose | 2>/dev/null cd $(pwd) echo awk
+done sed --verbose -eu echo $(pwd) export
+	&& echo echo -eu /usr/bin awk "$@" test test echo
+		'quoted text' sed --verbose
+cd 2>/dev/null /usr/bin cd "$1" 2>/dev/null
+		echo 2>/dev/null echo local $(pwd) echo sed local --verbose | export -eu $(pwd)
+	"$1" && awk echo export printf && "$1" && 'quoted text' export readonly 'quoted text'
+	'quoted text' 2>/dev/null --verbose
+/usr/bin | sed --verbose then /usr/bin x=1 printf export x=1 readonly
+&& ${HOME} $(pwd) sed 'quoted text' then 2>/dev/null "$1"
+		x=1 --verbose local | ${HOME} printf printf "$@" echo x=1 export sed cd "$1"
+	${HOME} x=1 test export export grep | grep -eu readonly then
+"$1" sed local | && 'quoted text' ${HOME} $(pwd) 'quoted text' done && x=1
+		then $(pwd) cd sed done test
+x=1 2>/dev/null "$@" cd sed | && x=1 | 2>/dev/null ${HOME} grep test | readonly
+	x=1 then cd --verbose done done done /usr/bin test --verbose x=1 printf
+	export grep ${HOME} test "$1" local /usr/bin local 'quoted text'
+		| cd --verbose 'quoted text' local awk then awk test then ${HOME} awk --verbose
+		done 'quoted text' then 2>/dev/null readonly "$1" --verbose
+"$@" printf 2>/dev/null /usr/bin "$@" 2>/dev/null
+		test sed printf "$@" ${HOME} ${HOME} -eu
+sed export x=1 export
+		echo export x=1 awk 2>/dev/null
+	x=1 2>/dev/null local --verbose done local &&
+		cd -eu printf export $(pwd) 2>/dev/null printf printf sed "$1" test sed
+		sed x=1 -eu 'quoted text' readonly 2>/dev/null then awk -eu awk --verbose sed
+		test --verbose local printf local $(pwd) /usr/bin echo 2>/dev/null
+	${HOME} --verbose --verbose readonly then -eu export
+	then ${HOME} local && echo readonly "$1" awk &&
+	awk "$@" --verbose -eu local "$@" sed --verbose
+		export grep export cd | then readonly 'quoted text' printf
+export 2>/dev/null local /usr/bin awk done sed ${HOME} 2>/dev/null /usr/bin /usr/bin
+&& echo cd | export 'quoted text'
+	then readonly -eu 2>/dev/null sed awk
+		$(pwd) x=1 echo --verbose -eu local $(pwd) then done grep --verbose /usr/bin
+		cd "$@" printf --verbose "$1" then printf -eu test sed then
+export | /usr/bin -eu
+	"$@" then --verbose && ${HOME} cd $(pwd) then
+	then grep 2>/dev/null "$@" sed "$1" /usr/bin
+	--verbose | 'quoted text'
+echo printf printf --verbose
+		local 2>/dev/null printf done awk export "$@" 'quoted text'
+		"$@" "$1" export local | echo -eu grep printf
+	&& printf cd /usr/bin cd printf printf cd $(pwd)
+		/usr/bin readonly -eu --verbose printf $(pwd) export 'quoted text'
+readonly x=1 sed -eu test -eu
+		2>/dev/null test $(pwd) cd awk awk export | ${HOME} echo
+		-eu done -eu "$@" printf | readonly local "$@" ${HOME}
+"$1" "$@" "$1" 2>/dev/null local readonly $(pwd)
+		awk readonly "$@" 2>/dev/null readonly then /usr/bin echo export awk echo /usr/bin
+	printf test grep --verbose 2>/dev/null
+$(pwd) "$@" $(pwd) grep x=1 ${HOME} "$@" 2>/dev/null -eu export done
+--verbose $(pwd) grep cd done export x=1 2>/dev/null 2>/dev/null "$1"
+		'quoted text' test $(pwd) ${HOME}
+		2>/dev/null printf 2>/dev/null sed
+	local export echo sed 2>/dev/null
+	local /usr/bin printf && | test "$@" done && sed readonly "$@" printf 2>/dev/null
+	echo && printf printf --verbose echo 2>/dev/null /usr/bin awk echo printf
+-eu awk ${HOME} x=1 echo 'quoted text' && test readonly "$1" /usr/bin done 2>/dev/null
+-eu x=1 /usr/bin ${HOME} ${HOME} "$@" $(pwd) then grep printf "$1"
+		"$@" done export done export x=1 && --verbose readonly $(pwd) sed test | -eu
+"$@" echo && ${HOME} export "$@" grep printf "$1" awk | readonly printf test grep
+		echo "$@" cd $(pwd) x=1 ${HOME} test /usr/bin
+		sed 'quoted text' --verbose awk export printf test
+		| 'quoted text' test ${HOME} $(pwd) grep cd ${HOME} done grep
+		x=1 done printf --verbose awk done local
+	${HOME} then 2>/dev/null && sed awk /usr/bin grep awk readonly
+	echo 2>/dev/null readonly && $(pwd) $(pwd) 'quoted text' cd "$@" ${HOME} done
+		"$@" $(pwd) $(pwd) readonly export $(pwd) readonly "$@" ${HOME}
+	'quoted text' sed test cd cd "$1" sed grep echo ${HOME} test 'quoted text' ${HOME}
+		"$@" "$@" cd "$1" export "$@" sed printf readonly /usr/bin
+		"$1" 'quoted text' | grep export x=1 --verbose
+	&& $(pwd) readonly "$1" 2>/dev/null -eu export -eu
+		test ${HOME} then | sed "$@" "$@" done && $(pwd) export echo | printf "$1"
+	cd local 'quoted text' 2>/dev/null x=1 local /usr/bin test
+		printf readonly export "$@" $(pwd) $(pwd) done readonly done printf
+	-eu 2>/dev/null -eu done "$1" sed "$@" "$@" "$@" sed 'quoted text' | --verbose
+/usr/bin done local export sed /usr/bin printf | awk "$1" grep done
+	$(pwd) grep --verbose ${HOME} printf echo local grep "$1" echo cd done |
+test | then "$@" $(pwd) printf
+	local -eu $(pwd) test export "$@" sed echo awk test "$1" "$1" local x=1 "$@" -eu
+2>/dev/null awk 'quoted text' awk ${HOME} | readonly x=1 'quoted text'
+		${HOME} export test 'quoted text'
+	done 'quoted text' "$@" readonly then then $(pwd) 2>/dev/null
+local done ${HOME} awk x=1 readonly
+then -eu test 2>/dev/null grep /usr/bin readonly --verbose | grep x=1
+done readonly "$@" "$@" "$1" grep "$1" -eu && grep grep printf ${HOME} -eu
+		cd sed ${HOME} | test $(pwd) done
+"$@" cd test done test done done awk export && "$@" 2>/dev/null
+		--verbose "$@" 2>/dev/null sed cd | done 'quoted text' --verbose
+"$@" x=1 awk readonly echo export /usr/bin "$@" "$@" printf --verbose
+grep readonly grep --verbose ${HOME} local "$@" echo local awk && --verbose
+then test 'quoted text' "$1" readonly 2>/dev/null
+		$(pwd) x=1 ${HOME} printf --verbose /usr/bin $(pwd) awk "$1"
+		readonly export /usr/bin done "$@" /usr/bin "$@"
+	-eu readonly echo sed awk -eu /usr/bin export test 'quoted text'
+'quoted text' grep sed printf 'quoted text' done readonly
+	awk then export sed printf --verbose
+	/usr/bin x=1 && /usr/bin --verbose
+	printf && && test --verbose grep cd $(pwd) x=1 then "$@" --verbose "$1"
+export && "$1" then "$@" "$@" then -eu local $(pwd) local -eu 'quoted text'
+		awk "$@" "$1" 'quoted text'
+	'quoted text' 'quoted text' cd -eu x=1 printf --verbose | ${HOME} /usr/bin
+--verbose done x=1 test readonly ${HOME}
+		awk && grep export /usr/bin readonly grep $(pwd)
+'quoted text' done echo && local
+"$@" -eu | sed echo awk "$@" ${HOME} sed "$@" $(pwd) --verbose export echo
+		-eu /usr/bin | -eu 'quoted text' "$1" ${HOME} grep readonly
+x=1 && 'quoted text' && sed grep echo awk
+x=1 'quoted text' readonly x=1 "$@" | | --verbose sed printf then | then test
+		export sed -eu done -eu && 2>/dev/null test --verbose echo sed test grep 2>/dev/null
+	| && | done readonly "$@" x=1 $(pwd) test printf printf ${HOME} printf test |
+		export 'quoted text' 'quoted text' readonly -eu readonly "$@"
+		local 2>/dev/null test x=1 test /usr/bin &&
+	${HOME} ${HOME} x=1 2>/dev/null "$1" readonly -eu | local sed -eu cd ${HOME}
+	grep 2>/dev/null 'quoted text' echo 2>/dev/null
+		sed ${HOME} export --verbose
+	/usr/bin test sed | "$1" /usr/bin
+	'quoted text' printf readonly 'quoted text' then /usr/bin
+	'quoted text' 'quoted text' sed readonly cd
+		--verbose done 2>/dev/null $(pwd) && 2>/dev/null awk done done 2>/dev/null awk
+| echo /usr/bin --verbose 2>/dev/null sed sed 'quoted text' printf /usr/bin
+		done cd ${HOME} | | && 'quoted text' ${HOME} 'quoted text' ${HOME} awk awk cd
+	&& "$@" 2>/dev/null test --verbose grep 'quoted text'
+	sed --verbose "$@" "$@" $(pwd) 2>/dev/null
+		"$@" && --verbose /usr/bin printf 'quoted text' "$@"
+	&& ${HOME} -eu -eu printf
+x=1 awk ${HOME} -eu "$@" echo
+		"$@" export --verbose printf
+cd awk | "$1" x=1 "$1" then | local test export "$@" test 'quoted text' grep /usr/bin
+grep echo sed export cd readonly
+	'quoted text' 'quoted text' /usr/bin
+		sed 'quoted text' "$1" then && 'quoted text' ${HOME} "$@" /usr/bin | 'quoted text'
+"$1" 2>/dev/null ${HOME} cd 2>/dev/null
+	cd grep /usr/bin echo local export "$1" ${HOME} then 'quoted text'
+		'quoted text' --verbose $(pwd) grep --verbose local ${HOME} printf export &&
+		grep readonly cd /usr/bin && x=1 "$1" awk printf export "$@"
+	echo test 'quoted text' $(pwd) echo cd grep --verbose echo then cd readonly
+$(pwd) $(pwd) readonly test cd 2>/dev/null -eu printf x=1 printf
+	"$@" grep "$1" "$@" /usr/bin then echo local test 2>/dev/null
+	-eu export echo && | grep 2>/dev/null then $(pwd) | awk test sed
+	x=1 done "$@" $(pwd) export --verbose "$1" then "$1" readonly ${HOME} ${HOME}
+		"$@" local readonly /usr/bin "$1" sed test $(pwd) "$1" x=1 ${HOME} local "$1"
+		sed cd -eu grep grep ${HOME} readonly done --verbose readonly test && "$@"
+cd | awk 'quoted text' --verbose local local x=1
+		/usr/bin "$1" $(pwd) && readonly done cd
+| 2>/dev/null "$@" ${HOME}
+	awk echo awk printf done /usr/bin /usr/bin | "$@" 'quoted text'
+		printf "$@" && $(pwd) "$1" && export -eu awk "$1" echo then export echo
+cd x=1 "$@" $(pwd) printf /usr/bin -eu cd grep
+	test then 'quoted text' test -eu local test $(pwd) printf export local "$@"
+echo cd "$1" grep sed --verbose x=1 "$@" "$1" then test
+'quoted text' 2>/dev/null /usr/bin $(pwd) printf
+	test cd cd test done sed grep "$@" printf done echo $(pwd) "$1"
+readonly export local "$1" -eu ${HOME} cd printf readonly printf "$1" readonly
+	awk | local export then ${HOME} then "$1" --verbose
+		$(pwd) test then $(pwd) | done "$1" test then readonly
+		--verbose --verbose /usr/bin sed "$@" export done ${HOME} ${HOME} "$1" printf grep
+	2>/dev/null "$1" local -eu export sed 'quoted text'
+	| 2>/dev/null -eu x=1 printf awk printf export "$@" cd readonly then | done
+cd export 2>/dev/null readonly "$1" sed grep done local
+		cd local test ${HOME} | ${HOME} grep readonly echo grep "$@" ${HOME} grep
+-eu local cd && test "$@" echo test cd grep printf readonly ${HOME} printf
+		-eu cd x=1 'quoted text' sed $(pwd)
+	--verbose echo local sed
+		sed printf $(pwd) echo ${HOME} "$1" test --verbose
+	local ${HOME} $(pwd) 'quoted text' sed |
+${HOME} readonly local --verbose "$@" --verbose
+		test cd 2>/dev/null "$@" then &&
+		done test "$1" 'quoted text' x=1 echo sed ${HOME} "$1" && --verbose -eu 2>/dev/null
+	printf -eu sed readonly x=1 "$@" test cd
+"$@" cd readonly local printf then export grep /usr/bin
+awk ${HOME} ${HOME} "$@" "$@" | ${HOME} "$1" /usr/bin "$@" --verbose "$1" x=1
+	"$@" awk local awk echo printf echo 2>/dev/null --verbose
+then $(pwd) sed /usr/bin && local --verbose $(pwd) --verbose
+	local grep "$@" --verbose grep awk --verbose /usr/bin
+		x=1 "$1" sed export 'quoted text' cd test export local grep
+	done done local export | | x=1 /usr/bin x=1 --verbose
+		/usr/bin printf done local sed --verbose $(pwd) -eu /usr/bin /usr/bin /usr/bin
+echo 2>/dev/null grep grep -eu local sed -eu ${HOME}
+sed local 2>/dev/null --verbose --verbose /usr/bin sed test echo test -eu
+		&& --verbose cd awk -eu printf --verbose x=1 awk sed | 'quoted text'
+--verbose awk done grep --verbose then | -eu test cd readonly cd readonly
+awk "$1" /usr/bin done then |
+	cd --verbose 'quoted text' $(pwd) -eu done sed readonly
+"$1" export echo echo echo 2>/dev/null then --verbose readonly
+	printf "$1" readonly export then 2>/dev/null
+	-eu "$1" sed | /usr/bin readonly awk cd
+		"$@" test 'quoted text' ${HOME} 2>/dev/null | cd grep grep done "$@"
+echo local sed done local --verbose readonly printf test /usr/bin local readonly
+$(pwd) /usr/bin cd 'quoted text' export
+	-eu done -eu ${HOME} /usr/bin cd x=1
+	"$1" ${HOME} echo x=1 /usr/bin echo "$@" done local ${HOME} 'quoted text' export
+$(pwd) && /usr/bin then x=1 ${HOME} printf awk /usr/bin && printf | -eu "$@" 'quoted text'
+"$1" --verbose readonly readonly grep grep 2>/dev/null
+--verbose --verbose | x=1 local cd ${HOME} export --verbose awk && "$1" /usr/bin
+	echo done local -eu --verbose --verbose
+		test && test "$1" echo local 'quoted text'
+	export echo local | echo && "$@" sed done /usr/bin export --verbose $(pwd) cd printf
+		| "$@" --verbose /usr/bin ${HOME}
+		${HOME} readonly 'quoted text' 2>/dev/null
+readonly "$1" 2>/dev/null /usr/bin export test
+	${HOME} echo done local printf printf
+${HOME} | awk printf x=1 "$@" 'quoted text' done
+	'quoted text' ${HOME} echo done $(pwd)
+	"$1" sed printf local local grep local awk 2>/dev/null test grep
+-eu sed 'quoted text' sed test readonly -eu 2>/dev/null then sed printf readonly
+		echo export ${HOME} readonly
+	sed /usr/bin --verbose ${HOME} "$1" $(pwd) readonly && | awk 2>/dev/null "$@" echo
+	$(pwd) -eu sed awk printf then test done printf | 'quoted text'
+printf x=1 sed x=1 /usr/bin grep 'quoted text' export "$1" echo
+	printf --verbose export
+	cd awk printf grep export $(pwd) --verbose readonly export
+		x=1 'quoted text' 'quoted text' "$@" printf readonly "$@" awk
+		then $(pwd) test sed 'quoted text'
+	x=1 grep -eu sed 2>/dev/null echo sed
+	-eu cd printf /usr/bin local $(pwd) | printf cd $(pwd) sed test && test 2>/dev/null
+	2>/dev/null test "$1" "$1" test "$1" sed cd readonly
+		"$@" "$@" readonly --verbose -eu awk 2>/dev/null grep
+	"$@" "$@" awk --verbose awk 2>/dev/null cd $(pwd) "$@" local awk awk
+		'quoted text' /usr/bin ${HOME}
+		$(pwd) && | --verbose "$1"
+		x=1 then sed "$@" readonly ${HOME}
+export test 2>/dev/null && $(pwd) test ${HOME}
+readonly grep local -eu 'quoted text' readonly "$1" $(pwd)
+		test | test sed $(pwd) "$1" local && 2>/dev/null export sed readonly
+		grep echo --verbose local 'quoted text' /usr/bin "$1"
+echo x=1 cd ${HOME} 'quoted text' test "$1" export
+	-eu done 'quoted text' "$@" --verbose
+	then awk sed readonly 2>/dev/null $(pwd) awk --verbose grep 2>/dev/null local
+	2>/dev/null 'quoted text'
+	cd 2>/dev/null && 'quoted text' ${HOME}
+done /usr/bin printf -eu | 2>/dev/null echo awk printf awk "$1"
+echo ${HOME} "$@" $(pwd) done --verbose
+		"$1" cd /usr/bin 2>/dev/null readonly test "$@" readonly
+cd x=1 readonly then "$1" ${HOME} awk test --verbose
+	grep grep --verbose then printf ${HOME}
+echo "$@" $(pwd) ${HOME} -eu cd "$@" /usr/bin cd --verbose /usr/bin echo
+	printf --verbose 2>/dev/null 2>/dev/null /usr/bin
+export awk 2>/dev/null --verbose
+/usr/bin 'quoted text' $(pwd) -eu readonly
+'quoted text' grep -eu sed x=1
+		test grep ${HOME} export echo readonly printf sed 'quoted text' 'quoted text'
+"$1" 'quoted text' --verbose --verbose x=1 echo export printf echo
+sed cd sed 2>/dev/null readonly /usr/bin cd $(pwd)
+then | 2>/dev/null cd local x=1 && "$@" readonly local --verbose
+	grep awk "$1" 2>/dev/null 'quoted text' 'quoted text' local sed awk grep awk
+then 'quoted text' test x=1 then "$@" sed 'quoted text'
+	printf 2>/dev/null printf readonly awk $(pwd) "$@"
+		export sed done sed ${HOME} then grep printf readonly --verbose
+	sed 2>/dev/null x=1 $(pwd) grep && printf | awk then 'quoted text'
+		echo awk sed 'quoted text' --verbose printf 'quoted text' test -eu export cd test
+	x=1 printf cd cd grep $(pwd) "$@" local -eu --verbose test
+	test awk printf $(pwd) 'quoted text' 'quoted text'
+sed done /usr/bin done export --verbose "$@" && awk | "$1" $(pwd) echo done -eu
+/usr/bin x=1 local -eu printf
+| --verbose test echo
+	--verbose sed $(pwd) readonly x=1 sed -eu sed cd
+sed "$@" printf --verbose 2>/dev/null
+sed | sed done 'quoted text'
+		printf -eu /usr/bin test --verbose -eu cd && sed 'quoted text' awk /usr/bin test
+	2>/dev/null awk --verbose
+	test echo printf grep "$1" 2>/dev/null readonly test --verbose
+		sed && /usr/bin test "$1" && ${HOME} grep x=1
+${HOME} -eu awk "$@" x=1 done then
+		echo done local 2>/dev/null printf readonly "$@" echo /usr/bin 2>/dev/null 'quoted text'
+		| done done 2>/dev/null local --verbose "$@" readonly --verbose local |
+local awk cd $(pwd) readonly echo /usr/bin
+		readonly done "$1" printf /usr/bin test 2>/dev/null "$@" test then then "$@"
+export printf local "$1" "$1" "$@" 2>/dev/null readonly export sed /usr/bin
+'quoted text' sed 'quoted text' $(pwd) done sed
+/usr/bin export 2>/dev/null 2>/dev/null echo grep grep echo
+'quoted text' echo test test "$@" awk &&
+done export "$1" 'quoted text' 2>/dev/null x=1 && 'quoted text'
+	--verbose $(pwd) cd awk printf ${HOME}
+'quoted text' x=1 then ${HOME}
+readonly x=1 && then 2>/dev/null $(pwd) local
+done awk "$@" $(pwd) --verbose test readonly
+| awk --verbose printf --verbose 2>/dev/null "$@" local export then
+	${HOME} | --verbose 2>/dev/null "$@" /usr/bin
+test --verbose cd grep done $(pwd)
+		"$1" test sed 2>/dev/null
+		readonly cd /usr/bin grep grep test "$@" cd printf
+x=1 && "$1" grep ${HOME} test && echo x=1 $(pwd) then done
+		readonly sed && done grep test /usr/bin
+		&& cd export ${HOME} test then echo "$@" 2>/dev/null $(pwd) awk readonly "$1"
+		x=1 then awk x=1 x=1 local "$@" --verbose echo readonly
+	/usr/bin ${HOME} grep | printf grep $(pwd) readonly
+"$@" export cd -eu awk
+		grep then then "$1" printf grep x=1 export awk /usr/bin 'quoted text' then
+	grep 2>/dev/null printf echo 2>/dev/null "$@" ${HOME} -eu "$1" grep
+		x=1 | "$@" test "$@" echo echo 2>/dev/null x=1 echo then then printf $(pwd) /usr/bin
+	test "$1" done "$@" ${HOME} readonly readonly ${HOME} echo local
+		--verbose 2>/dev/null
+		-eu "$1" readonly "$1" grep 2>/dev/null grep ${HOME} test printf -eu && 2>/dev/null
+grep $(pwd) --verbose
+		$(pwd) export | awk && "$@" "$1"
+	"$@" awk cd sed "$1" /usr/bin && printf export "$1" 'quoted text' "$@"
+	'quoted text' | printf 'quoted text' grep sed grep x=1 "$1" --verbose readonly
+		local local x=1 'quoted text' awk && x=1 awk 2>/dev/null then grep -eu ${HOME}
+		done --verbose "$1" "$1" cd 'quoted text'
+	-eu | "$@" local && | && printf $(pwd) 'quoted text'
+echo readonly done /usr/bin "$1" 'quoted text'
+	"$1" cd export then ${HOME} 2>/dev/null sed readonly /usr/bin
+	| $(pwd) 2>/dev/null grep printf && ${HOME} done && 2>/dev/null
+then sed sed local ${HOME} x=1 sed -eu readonly then export awk then readonly
+export echo $(pwd) then done test readonly printf
+	local test readonly test | ${HOME} echo
+		printf sed printf grep printf 2>/dev/null done sed readonly local "$1"
+	-eu ${HOME} export sed cd done 2>/dev/null local
+		local && && | "$@" export sed then 2>/dev/null -eu -eu cd grep
+		$(pwd) grep done $(pwd) -eu --verbose "$1" awk "$1" test test "$1" done
+	cd then sed | 2>/dev/null 'quoted text'
+x=1 echo x=1 test awk local export $(pwd) $(pwd) 'quoted text'
+	export cd readonly $(pwd) && grep /usr/bin then ${HOME} --verbose "$1" &&
+	grep printf $(pwd) ${HOME} "$1" cd "$@" ${HOME} readonly -eu awk grep
+		--verbose /usr/bin then done printf grep && awk | ${HOME} sed
+sed 2>/dev/null done test --verbose $(pwd)
+	grep 2>/dev/null x=1 && grep done local export --verbose readonly
+		/usr/bin export 'quoted text' printf local --verbose awk
+awk printf "$@" local cd printf awk test test export
+		&& "$1" grep grep then
+		echo then /usr/bin "$@" --verbose --verbose test test cd echo && grep
+	done /usr/bin 'quoted text'
+x=1 x=1 awk --verbose ${HOME} "$1" x=1 printf export $(pwd)
+	"$@" grep sed --verbose && grep
+'quoted text' ${HOME} export x=1
+		${HOME} printf "$@" printf 'quoted text' 'quoted text'
+		cd 2>/dev/null /usr/bin test awk
+grep grep /usr/bin | then "$1" echo "$@" then printf grep "$@" --verbose
+		--verbose grep awk 2>/dev/null
+		test $(pwd) readonly --verbose grep then 'quoted text'
+	printf local /usr/bin awk /usr/bin grep ${HOME}
+	-eu local printf printf
+		export echo x=1 && awk $(pwd) x=1 $(pwd)
+/usr/bin "$1" export -eu $(pwd) $(pwd) printf cd && sed
+"$1" x=1 x=1 'quoted text' readonly | test printf 'quoted text'
+		printf "$1" "$@" grep && | test echo cd grep $(pwd) /usr/bin
+		&& && | done $(pwd) "$1" "$1" local x=1 cd x=1 x=1 awk | cd 'quoted text'
+export -eu | awk printf $(pwd) $(pwd) /usr/bin awk && -eu sed ${HOME} done
+then local 'quoted text' grep
+	/usr/bin sed readonly export local --verbose x=1
+/usr/bin --verbose | awk /usr/bin
+$(pwd) grep sed test $(pwd) grep 'quoted text'
+| test 2>/dev/null export test grep readonly then awk sed ${HOME} done test echo
+| "$1" sed 2>/dev/null 2>/dev/null
+	sed done echo 2>/dev/null $(pwd) --verbose local echo 2>/dev/null
+	done $(pwd) cd sed && x=1 done cd printf
+	done 'quoted text' test /usr/bin test
+	'quoted text' then readonly then 'quoted text' x=1 printf echo
+	'quoted text' export sed -eu "$@" then 'quoted text' cd grep ${HOME} | sed --verbose
+then 'quoted text' local echo echo ${HOME} printf
+	"$@" readonly readonly
+	cd "$@" then test && printf | sed "$1" done ${HOME}
+		sed local $(pwd) "$@" readonly readonly awk awk grep $(pwd) $(pwd)
+| printf grep export export awk 'quoted text' "$1" "$1"
+		sed readonly ${HOME} then | | echo -eu readonly test
+		done --verbose cd /usr/bin done done ${HOME} 'quoted text'
+		awk test 2>/dev/null awk $(pwd)
+then done test cd ${HOME} $(pwd) && test export sed -eu grep ${HOME}
+--verbose $(pwd) "$@" done "$@" awk --verbose export
+		test $(pwd) awk printf grep && local && "$@" awk
+		cd printf printf && export cd ${HOME} cd done 2>/dev/null
+		&& -eu --verbose && -eu local -eu 2>/dev/null
+	export ${HOME} x=1 awk awk echo local --verbose cd local done
+done x=1 printf 2>/dev/null grep awk then "$1" export | echo "$@" readonly
+	sed | cd | -eu && awk echo | 'quoted text'
+'quoted text' && grep 'quoted text'
+	x=1 done $(pwd) then x=1 ${HOME} x=1 "$1" grep && cd
+	sed $(pwd) ${HOME} "$@" && export sed $(pwd)
+	x=1 readonly then test printf local printf $(pwd)
+'quoted text' readonly local echo sed printf
+		2>/dev/null x=1 cd sed && $(pwd) printf "$@" cd "$1" local echo ${HOME} ${HOME}
+'quoted text' | ${HOME} ${HOME}
+	then sed local ${HOME} awk awk /usr/bin -eu
+'quoted text' readonly "$@" --verbose && local readonly sed $(pwd)
+	/usr/bin readonly | export 'quoted text'
+grep 'quoted text' sed grep local echo local export x=1 &&
+	'quoted text' 'quoted text'
+		then $(pwd) && cd test "$1" cd local local
+	x=1 then x=1 then readonly "$1" /usr/bin grep echo "$1" echo x=1 cd grep
+	-eu cd | -eu done && -eu
+then && sed grep readonly local done 'quoted text'
+	x=1 then "$1" 2>/dev/null /usr/bin && | --verbose ${HOME} 2>/dev/null
+		export ${HOME} -eu test | grep cd grep --verbose "$@" -eu x=1 local x=1 --verbose
+	test grep /usr/bin done | then x=1 readonly x=1 'quoted text' 'quoted text'
+		"$@" local export awk printf test printf sed sed
+awk -eu grep $(pwd) 'quoted text' sed $(pwd)
+	2>/dev/null 2>/dev/null export --verbose printf
+		/usr/bin awk "$1" --verbose ${HOME} ${HOME} "$1" $(pwd) done 2>/dev/null
+	/usr/bin "$1" && local 2>/dev/null x=1 printf
+		readonly "$1" sed | 2>/dev/null export
+	local export local ${HOME} "$@" 'quoted text' -eu 'quoted text'
+	2>/dev/null -eu cd -eu awk printf awk && readonly test
+	${HOME} grep --verbose 2>/dev/null
+x=1 ${HOME} awk && ${HOME} done x=1 local local "$1"
+cd then printf 'quoted text' printf grep readonly sed sed done export "$1" 2>/dev/null
+	test | $(pwd) x=1 printf readonly grep "$@" && echo && test
+		'quoted text' awk awk && printf && then 2>/dev/null -eu sed 'quoted text'
+		"$@" ${HOME} -eu $(pwd) then -eu
+	"$@" readonly then $(pwd) x=1
+2>/dev/null then readonly "$1" local --verbose sed && export 'quoted text'
+	"$1" /usr/bin -eu -eu "$1"
+		export awk export --verbose local
+local -eu done done then --verbose 'quoted text' /usr/bin awk | ${HOME}
+		then cd | grep readonly x=1 test grep grep readonly sed then && echo
+		/usr/bin /usr/bin && "$@" sed $(pwd) printf
+	"$@" ${HOME} && /usr/bin "$@" test done 2>/dev/null printf 2>/dev/null x=1 'quoted text'
+printf grep "$@" export cd cd sed test readonly printf
+		x=1 x=1 grep "$1" 'quoted text' grep
+	/usr/bin readonly 'quoted text' echo grep cd "$1"
+		2>/dev/null "$1" "$@" 'quoted text' ${HOME} grep export 'quoted text'
+2>/dev/null --verbose x=1 local echo cd cd awk
+&& printf awk test x=1 ${HOME} 2>/dev/null
+	cd readonly ${HOME} grep sed && $(pwd) export --verbose
+	"$@" cd /usr/bin then printf readonly /usr/bin 2>/dev/null
+		done test then echo 2>/dev/null export sed then 'quoted text'
+cd then readonly 'quoted text' --verbose && sed awk echo printf cd | /usr/bin
+	echo grep done then grep readonly $(pwd) && x=1 'quoted text' printf | "$@"
+	export test sed then grep
+-eu cd | 2>/dev/null ${HOME} local local x=1 --verbose
+$(pwd) done --verbose export printf "$@" cd 2>/dev/null printf awk
+		"$@" -eu awk grep /usr/bin awk local echo done local grep && "$@" 'quoted text'
+		/usr/bin test /usr/bin echo sed -eu && echo cd test $(pwd) --verbose ${HOME} export
+	2>/dev/null "$@" $(pwd) export echo --verbose awk then grep done
+	2>/dev/null $(pwd) printf
+		$(pwd) ${HOME} --verbose then echo "$1" then "$@" grep sed sed
+		$(pwd) -eu export export then readonly printf awk printf x=1 grep x=1
+		$(pwd) echo /usr/bin export echo 'quoted text' $(pwd) local sed /usr/bin
+		then done -eu 2>/dev/null export export ${HOME} -eu x=1 readonly
+${HOME} --verbose local "$@" 'quoted text' done awk $(pwd) --verbose test /usr/bin
+${HOME} cd | 'quoted text' printf && then test
+grep "$1" export ${HOME} $(pwd) --verbose | then -eu "$1" $(pwd) "$1"
+		x=1 export then 2>/dev/null grep
+echo echo done $(pwd) x=1 then ${HOME}
+		then ${HOME} $(pwd) then -eu local 'quoted text'
+		readonly "$1" $(pwd) awk
+	x=1 export printf export && 2>/dev/null echo
+printf x=1 printf awk grep 'quoted text'
+echo test readonly then 2>/dev/null ${HOME} awk then
+	'quoted text' export "$@" --verbose cd local
+		local printf readonly sed "$@" sed grep ${HOME} test readonly 'quoted text'
+--verbose --verbose $(pwd) && 2>/dev/null printf -eu awk grep 'quoted text'
+		export --verbose local then 2>/dev/null ${HOME}
+	--verbose "$1" -eu cd $(pwd) --verbose cd -eu "$1" cd
+		readonly echo | readonly cd /usr/bin x=1 ${HOME} done
+grep "$@" /usr/bin 'quoted text'
+	export readonly --verbose test
+		'quoted text' export done ${HOME} ${HOME} grep $(pwd) readonly
+		done | cd grep 2>/dev/null /usr/bin
+		export 'quoted text' done grep x=1 /usr/bin cd $(pwd) $(pwd) cd
+sed x=1 x=1 readonly | && done "$1" done | printf done grep echo x=1 2>/dev/null
+	printf sed printf x=1 awk /usr/bin "$@" sed "$@" "$1" printf test grep awk &&
+printf export && grep | readonly echo then then x=1 --verbose
+echo && local echo "$@" grep grep test 'quoted text' 'quoted text' sed /usr/bin
+cd done "$1" | "$@" test | readonly grep "$1" 2>/dev/null
+	2>/dev/null then export
+	x=1 /usr/bin then -eu "$@" local grep awk 'quoted text'
+	x=1 x=1 --verbose | x=1 done readonly export
+	--verbose $(pwd) grep done
+	&& test readonly export sed
+"$1" sed local readonly then echo 'quoted text' x=1 then done
+	awk sed then export && done "$@" echo ${HOME} sed
+	cd done done printf 'quoted text' echo sed test x=1 2>/dev/null done
+		done readonly then | sed /usr/bin grep -eu ${HOME} printf
+		&& 2>/dev/null test awk sed echo local test ${HOME} 'quoted text' printf
+		x=1 test local x=1 --verbose
+test --verbose awk -eu readonly "$1"
+'quoted text' x=1 readonly grep
+		"$1" && -eu && -eu test /usr/bin then /usr/bin printf "$1"
+		"$1" --verbose done | "$1" -eu grep grep "$@" -eu
+test echo readonly grep x=1 export then "$1" test
+	'quoted text' then export
+	--verbose readonly printf
+	"$1" /usr/bin | done "$1" echo test
+&& --verbose "$@" ${HOME} "$1" done cd x=1 done cd --verbose
+	&& done sed awk then done -eu --verbose --verbose ${HOME} /usr/bin $(pwd) ${HOME}
+		local test test printf echo test -eu done "$@" done 'quoted text' ${HOME}
+	export -eu test export echo then echo /usr/bin done local | readonly
+	echo x=1 export x=1 ${HOME} cd test | echo "$1" readonly
+awk --verbose export echo "$@" 'quoted text' ${HOME} 2>/dev/null
+		test "$@" "$@" cd cd export echo --verbose grep awk | sed
+&& x=1 local printf --verbose --verbose printf local
+	"$1" 'quoted text' 2>/dev/null cd --verbose echo cd printf -eu /usr/bin echo
+		&& $(pwd) --verbose --verbose "$1" --verbose
+	cd "$@" 2>/dev/null $(pwd) && 'quoted text' $(pwd)
+/usr/bin && readonly cd $(pwd) x=1 /usr/bin /usr/bin 2>/dev/null -eu && export
+	-eu readonly done -eu ${HOME} "$1" local /usr/bin awk sed printf
+	printf 'quoted text' echo cd awk 'quoted text' x=1 "$1" done cd echo $(pwd)
+	awk ${HOME} test 'quoted text' then x=1 then --verbose printf
+	'quoted text' local printf cd --verbose
+-eu -eu -eu "$@" --verbose 'quoted text' ${HOME} then
+		export 2>/dev/null ${HOME} -eu then 'quoted text' export done x=1
+	done sed cd 'quoted text'
+	cd sed 2>/dev/null grep && --verbose 'quoted text' awk printf
+	export export test "$@" x=1 awk done readonly $(pwd) | sed grep 2>/dev/null
+		2>/dev/null $(pwd) $(pwd) $(pwd) "$@" 2>/dev/null
+	cd | "$1" sed 2>/dev/null printf echo sed cd printf x=1 -eu --verbose
+		export && then test ${HOME} cd x=1 "$1" "$@" then echo -eu test
+		echo echo readonly grep sed ${HOME}
+		/usr/bin "$@" "$@" "$@" --verbose
+awk "$1" cd grep cd x=1 cd test "$1" x=1
+		x=1 local 2>/dev/null cd "$1" /usr/bin | --verbose cd --verbose local x=1
+	&& export export echo awk ${HOME}
+grep /usr/bin printf cd && | printf
+		readonly local done "$1" done 'quoted text'
+		-eu local readonly done sed printf
+		${HOME} done x=1 done 'quoted text' | local 2>/dev/null
+		echo 'quoted text' readonly readonly ${HOME} printf "$@" $(pwd) 2>/dev/null
+	| | done awk 'quoted text' $(pwd)
+grep readonly done sed /usr/bin /usr/bin
+-eu /usr/bin awk done $(pwd) echo then $(pwd) "$1" sed
+| x=1 'quoted text' grep -eu grep printf
+$(pwd) done printf "$@" ${HOME}
+		readonly export 'quoted text'
+sed done export echo /usr/bin ${HOME} 2>/dev/null
+	grep 2>/dev/null echo "$@" $(pwd) export ${HOME} echo | 2>/dev/null
+	-eu echo done grep readonly --verbose cd -eu /usr/bin then sed grep 'quoted text'
+x=1 done 2>/dev/null printf local test x=1 done
+cd export grep x=1 -eu
+	x=1 --verbose done readonly "$@" "$1" printf grep done --verbose "$1" && done
+		grep done -eu && test printf cd awk done grep && "$@" 'quoted text' readonly /usr/bin
+		printf $(pwd) test test --verbose ${HOME} awk
+		printf | $(pwd) then awk done | awk
+grep && 2>/dev/null awk 2>/dev/null --verbose "$@" | |
+awk $(pwd) done x=1 export
+	local cd done 'quoted text' readonly
+	local local | 'quoted text' awk && readonly "$1" && test $(pwd) x=1
+		&& echo awk export printf --verbose
+	"$1" && awk $(pwd) | -eu | --verbose readonly /usr/bin done "$@" done
+	| "$1" | cd | /usr/bin test 2>/dev/null $(pwd) --verbose readonly
+	local ${HOME} cd readonly "$1" 'quoted text' && sed sed $(pwd) cd 'quoted text'
+	&& 'quoted text' readonly && -eu 'quoted text' $(pwd) echo export ${HOME}
+		printf readonly readonly
+		"$@" --verbose --verbose awk readonly export && then readonly x=1 test $(pwd)
+		cd "$@" x=1 /usr/bin --verbose grep grep $(pwd)
+	local done $(pwd) readonly "$@" local | sed done then x=1 export
+		/usr/bin x=1 test sed "$1" export && "$@" 2>/dev/null awk local
+readonly && x=1 && x=1 echo x=1
+grep -eu --verbose "$1" --verbose
+	awk then grep /usr/bin x=1 2>/dev/null ${HOME} "$@" /usr/bin then echo --verbose
+local -eu echo | --verbose "$@" | 2>/dev/null "$@" export cd 'quoted text'
+		readonly ${HOME} && export grep 'quoted text' -eu echo $(pwd) "$1" x=1 test
+	printf export 2>/dev/null export
+		&& | && printf 2>/dev/null grep printf export
+		test 2>/dev/null export then
+	echo sed 'quoted text' | 2>/dev/null echo | 2>/dev/null 'quoted text' 2>/dev/null
+	--verbose done local /usr/bin local "$@" echo then test local x=1 sed cd
+	cd -eu 2>/dev/null awk 2>/dev/null
+	echo $(pwd) | printf x=1 export | export --verbose /usr/bin
+local local awk ${HOME} "$1" | "$1" | awk echo "$1" awk grep printf /usr/bin
+sed "$1" | echo "$1" cd test ${HOME}
+		done -eu $(pwd) /usr/bin awk 'quoted text' export
+test cd ${HOME} --verbose cd --verbose
+	test echo ${HOME} "$@" test local echo test cd "$@" -eu && then sed
+		echo ${HOME} readonly local
+	$(pwd) then local echo cd test readonly test 'quoted text'
+		local "$1" 'quoted text' $(pwd) sed --verbose
+	then done --verbose | awk done -eu "$@" x=1 /usr/bin done
+		| local awk sed local echo
+	test local readonly 'quoted text' -eu echo grep test --verbose printf export
+	"$@" -eu echo "$@" readonly awk 'quoted text' 'quoted text'
+		printf --verbose local cd grep /usr/bin 2>/dev/null $(pwd) then done export
+$(pwd) grep | --verbose
+'quoted text' grep done awk readonly readonly 'quoted text' -eu -eu --verbose
+	-eu x=1 -eu "$1" export ${HOME} sed "$@" echo grep "$1" awk done |
+		'quoted text' -eu 2>/dev/null | "$@" $(pwd)
+	"$@" && "$1" cd echo -eu readonly
+	readonly "$1" readonly /usr/bin "$@" /usr/bin
+		grep test ${HOME} grep ${HOME} | x=1
+	&& $(pwd) 2>/dev/null echo ${HOME} local "$1" && cd readonly awk && printf echo
+		| "$@" readonly cd test done local echo then grep local &&
+	awk done ${HOME} 2>/dev/null ${HOME} |
+	| x=1 "$1" readonly "$@" 2>/dev/null echo 'quoted text'
+	-eu grep 2>/dev/null 2>/dev/null -eu "$@" cd
+local sed $(pwd) -eu echo && then "$1" "$1" 2>/dev/null
+	cd done cd cd cd -eu --verbose --verbose ${HOME}
+export "$1" && --verbose sed awk "$@" x=1 awk grep done
+	-eu awk cd test test export $(pwd)
+		then -eu /usr/bin printf ${HOME} /usr/bin
+	| local && test printf then local done x=1 grep 'quoted text'
+	-eu -eu 2>/dev/null 'quoted text' "$@" grep
+	awk ${HOME} $(pwd) 'quoted text' "$@"
+2>/dev/null 'quoted text' local 'quoted text' local local ${HOME} local
+		/usr/bin -eu ${HOME}
+awk local sed && done | grep then -eu awk export then done
+	awk done readonly "$1" readonly grep awk ${HOME} "$@" awk ${HOME} /usr/bin --verbose
+grep export test echo sed echo 'quoted text'
+		cd done "$@" grep done 2>/dev/null "$@" x=1 2>/dev/null then grep awk
+	readonly | sed local ${HOME} "$@" && | printf /usr/bin
+"$@" then /usr/bin "$1" x=1 export printf
+	"$1" done echo 2>/dev/null
+x=1 $(pwd) cd export awk
+	&& 2>/dev/null printf cd ${HOME} && "$1" $(pwd) test
+'quoted text' "$1" x=1 "$1" "$@" grep readonly
+	x=1 "$@" sed done "$1" cd echo && done
+		test && local cd done /usr/bin $(pwd) readonly printf 'quoted text' local then
+	grep cd cd 'quoted text'
+cd then ${HOME} x=1 grep
+/usr/bin export ${HOME} | awk then readonly "$@" export printf
+'quoted text' sed x=1 awk $(pwd) done | /usr/bin then 2>/dev/null
+awk 'quoted text' -eu cd x=1 grep x=1 | readonly awk /usr/bin
+	readonly sed /usr/bin done --verbose grep awk | done sed
+	readonly -eu done then export && | x=1 grep /usr/bin x=1 2>/dev/null /usr/bin x=1
+--verbose then --verbose cd local sed 'quoted text' export -eu -eu awk "$@"
+grep done ${HOME} awk readonly readonly then test printf
+/usr/bin ${HOME} done 'quoted text' then local then | 2>/dev/null 2>/dev/null
+		$(pwd) readonly then "$@" 2>/dev/null test done
+${HOME} $(pwd) /usr/bin done ${HOME} done --verbose
+		-eu then sed | $(pwd) test x=1 export echo x=1 cd readonly local
+	grep echo 2>/dev/null && then | printf
+		'quoted text' -eu sed 'quoted text' | echo "$1" --verbose -eu 'quoted text'
+"$@" export printf export
+		&& done --verbose echo $(pwd) awk awk "$1" cd grep --verbose then test
+	grep -eu "$1" export awk | done -eu $(pwd)
+2>/dev/null done "$@" "$@" && "$1" readonly
+		grep | "$1" grep local
+		'quoted text' export local
+	$(pwd) sed export | && --verbose "$1" sed grep cd 'quoted text' 2>/dev/null
+--verbose echo awk "$1" | printf test
+		test sed grep readonly then sed 'quoted text' test printf sed ${HOME} export
+		/usr/bin echo ${HOME} -eu 'quoted text' grep test 2>/dev/null /usr/bin
+		printf then sed && | awk $(pwd) 'quoted text'
+	-eu /usr/bin x=1 'quoted text' --verbose
+		awk -eu -eu echo x=1 printf local
+cd done --verbose export cd sed
+	"$1" /usr/bin then printf then | 2>/dev/null x=1
+"$@" 'quoted text' readonly /usr/bin ${HOME} grep
+	grep cd local cd sed 2>/dev/null cd done done
+		&& awk local "$1" readonly local export echo then readonly
+		printf then cd cd grep x=1 awk cd grep && /usr/bin awk 2>/dev/null
+	done x=1 && readonly printf ${HOME}
+		cd 'quoted text' sed local
+		sed sed $(pwd) echo "$@" x=1 'quoted text' "$@" ${HOME}
+	$(pwd) awk 2>/dev/null | test echo && 'quoted text' grep grep && then
+-eu export sed $(pwd) && readonly |
+	"$@" done -eu awk /usr/bin | grep local && local ${HOME} local --verbose
+readonly readonly /usr/bin local awk "$1" -eu sed readonly
+"$1" done done printf sed 2>/dev/null --verbose local
+	"$1" cd --verbose export test "$@" grep x=1 &&
+	readonly echo /usr/bin && awk grep then --verbose echo x=1
+		"$@" "$1" "$1" sed x=1 --verbose x=1 $(pwd) echo "$1" sed done -eu done
+--verbose 2>/dev/null $(pwd) echo then echo x=1
+		cd awk && ${HOME} test test && --verbose 2>/dev/null grep printf
+awk readonly 2>/dev/null x=1 awk x=1 cd 'quoted text' done awk awk $(pwd)
+echo sed echo "$@" | local 2>/dev/null x=1 export
+		export 2>/dev/null x=1 awk /usr/bin
+2>/dev/null | ${HOME} --verbose sed grep then local /usr/bin 2>/dev/null "$1"
+		/usr/bin "$@" | 2>/dev/null /usr/bin test -eu test sed x=1 | local
+"$@" export cd | --verbose
+	then local && then local 'quoted text' grep --verbose && 2>/dev/null
+		test echo awk ${HOME} /usr/bin "$@" ${HOME} done | grep | $(pwd)
+	awk local $(pwd) -eu 2>/dev/null then export "$@" ${HOME} && then "$@"
+--verbose then local 2>/dev/null 'quoted text' echo awk
+| export 'quoted text' /usr/bin
+--verbose x=1 "$1" | export sed x=1 sed "$@"
+	"$1" sed /usr/bin x=1 -eu 2>/dev/null
+echo ${HOME} ${HOME} | "$1" awk then -eu done "$1"
+	${HOME} readonly "$@" export $(pwd) ${HOME}
+	| x=1 --verbose 'quoted text' 'quoted text' grep
+	/usr/bin printf | -eu readonly then
+&& 'quoted text' /usr/bin 2>/dev/null done done awk
+--verbose | readonly grep test echo cd
+		${HOME} -eu "$@" readonly -eu awk "$@" export 2>/dev/null x=1 local ${HOME}
+		x=1 2>/dev/null -eu -eu ${HOME} -eu && local 'quoted text' 'quoted text'
+| x=1 test "$1" x=1 'quoted text' --verbose printf
+	2>/dev/null echo readonly done ${HOME} sed "$@" then readonly 'quoted text'
+		echo "$1" printf --verbose -eu printf grep x=1
+		awk export 'quoted text' export x=1 ${HOME} readonly
+	then /usr/bin done local
+	$(pwd) echo export awk && | readonly $(pwd)
+grep readonly test local -eu sed 'quoted text' sed /usr/bin x=1 then
+echo done "$@" --verbose done
+	awk "$@" "$@" | echo test --verbose done done cd
+echo 2>/dev/null awk grep
+'quoted text' printf ${HOME} printf |
+	&& -eu ${HOME} -eu test printf test
+grep done cd 2>/dev/null test echo x=1 done 2>/dev/null cd then
+'quoted text' local export && then awk /usr/bin 2>/dev/null sed
+	&& done 2>/dev/null -eu echo 2>/dev/null export | "$1" printf cd /usr/bin
+	test 2>/dev/null --verbose local && -eu grep local cd grep --verbose done
+awk $(pwd) sed awk "$1" done x=1 $(pwd) done &&
+		grep echo done export awk readonly -eu
+		awk printf --verbose readonly sed 'quoted text' $(pwd) --verbose
+	2>/dev/null "$@" printf | cd readonly
+		awk -eu cd done ${HOME} readonly local done 2>/dev/null
+	"$1" cd readonly 2>/dev/null cd printf
+	$(pwd) | local | echo "$@" printf ${HOME}
+		"$@" -eu done export printf awk done then sed --verbose
+		local --verbose test then 'quoted text' test export 'quoted text'
+	awk export then -eu printf local 'quoted text'
+"$1" readonly printf sed done ${HOME} done
+"$@" cd --verbose && printf local sed readonly -eu $(pwd) "$1" export
+	/usr/bin ${HOME} "$1" /usr/bin
+	$(pwd) done 2>/dev/null export
+		echo printf 'quoted text' cd
+	/usr/bin | 2>/dev/null printf $(pwd) 'quoted text' x=1 -eu cd then echo echo
+		awk && "$1" readonly x=1 ${HOME} then echo sed done awk /usr/bin &&
+printf printf then grep local | && 'quoted text' printf /usr/bin
+		&& awk 2>/dev/null | 'quoted text' "$1" test
+done then | && x=1 echo 'quoted text' sed printf 2>/dev/null
+| $(pwd) done "$@" readonly "$@" "$@" "$@" export done readonly local
+	local awk test grep done --verbose sed x=1 local grep && 'quoted text' --verbose
+-eu /usr/bin $(pwd) echo --verbose readonly --verbose grep "$1" cd export
+-eu sed awk 'quoted text' grep "$@" cd --verbose 2>/dev/null 2>/dev/null
+	--verbose 'quoted text' x=1 -eu $(pwd) 'quoted text' 2>/dev/null 2>/dev/null
+	sed printf cd 2>/dev/null 2>/dev/null local
+		done grep -eu sed printf $(pwd) x=1 export --verbose -eu | cd
+	${HOME} --verbose echo $(pwd) printf echo grep && sed sed 'quoted text'
+		'quoted text' then "$1" test && printf
+		"$@" 2>/dev/null done echo $(pwd)
+		test local cd then readonly done "$@"
+	done --verbose done awk -eu local && done
+	then export "$@" | /usr/bin "$1" sed && -eu -eu "$@" "$1" grep
+		/usr/bin $(pwd) export $(pwd) local sed 2>/dev/null $(pwd) | --verbose
+	local readonly grep -eu done readonly export export ${HOME} "$1" then
+readonly readonly cd 2>/dev/null ${HOME} | --verbose export test -eu $(pwd)
+$(pwd) echo printf done local cd test "$1" printf $(pwd) printf "$@" sed cd
+	${HOME} sed done readonly --verbose
+'quoted text' test | cd "$@" export then then sed "$1"
+awk cd then printf printf local | export
+	then export export grep $(pwd) /usr/bin grep readonly ${HOME} cd --verbose x=1 then
+echo done sed done awk ${HOME} ${HOME} $(pwd) awk printf cd done
+	sed "$1" awk 'quoted text' grep export printf awk local cd done --verbose
+		&& x=1 echo ${HOME} done "$1" awk export $(pwd) export
+		export $(pwd) readonly awk 'quoted text' 'quoted text' then -eu -eu sed
+	test export "$1" x=1 'quoted text' grep
+		x=1 "$1" printf local cd export 'quoted text' && cd sed printf awk /usr/bin echo
+/usr/bin x=1 2>/dev/null /usr/bin | $(pwd) cd cd 'quoted text' echo
+${HOME} "$@" done 2>/dev/null | /usr/bin && awk "$1" x=1 --verbose cd readonly -eu
+		sed ${HOME} 'quoted text' "$@" 'quoted text' echo done local x=1 printf
+x=1 "$@" test test --verbose local local | local awk echo sed "$@" local -eu
+cd "$@" local sed awk echo readonly
+		${HOME} readonly cd readonly 'quoted text' |
+		test echo grep --verbose $(pwd)
+	echo readonly --verbose export local then readonly "$1"
+		done done 'quoted text' 'quoted text' 2>/dev/null "$1" "$1" | /usr/bin --verbose
+		${HOME} cd --verbose -eu readonly readonly test
+${HOME} $(pwd) "$1" "$@"
+	printf done cd /usr/bin readonly $(pwd) awk awk
+		readonly --verbose local "$@" echo $(pwd) 2>/dev/null sed
+"$1" readonly then cd cd ${HOME} 2>/dev/null
+		-eu test x=1 -eu sed 2>/dev/null "$@" echo | | printf
+	printf printf "$@" && export then then --verbose
+	echo $(pwd) 'quoted text' && && local "$1" awk --verbose readonly
+		--verbose then sed local /usr/bin sed local cd -eu $(pwd) "$1" printf test
+done --verbose printf 2>/dev/null "$@" export 2>/dev/null 2>/dev/null $(pwd)
+		x=1 'quoted text' test done then /usr/bin echo local awk
+'quoted text' | -eu awk && readonly echo x=1 printf printf
+	/usr/bin test cd 'quoted text' export 'quoted text'
+		echo then local printf done "$1" awk 2>/dev/null x=1 "$1" echo x=1 then 2>/dev/null
+'quoted text' "$@" /usr/bin echo export -eu
+	| done "$1" x=1 /usr/bin 'quoted text' echo "$@" test && then
+	'quoted text' test grep && ${HOME} echo readonly
+		-eu -eu awk sed grep printf --verbose grep "$1" sed test export -eu
+		-eu cd done sed ${HOME} x=1 -eu
+		| awk --verbose grep "$@" awk printf --verbose grep export -eu $(pwd) -eu
+		2>/dev/null 2>/dev/null local readonly export grep test
+"$@" x=1 $(pwd) awk --verbose done echo 'quoted text' test cd echo
+	export "$@" done grep --verbose printf /usr/bin ${HOME} then cd 2>/dev/null
+	--verbose ${HOME} 2>/dev/null ${HOME} printf grep grep printf done
+	sed /usr/bin sed 2>/dev/null local /usr/bin | echo sed --verbose -eu export
+		readonly $(pwd) --verbose cd | ${HOME} | --verbose
+		x=1 | printf "$@" local local && 2>/dev/null cd /usr/bin "$@" -eu awk -eu
+&& local done printf cd "$1" awk 2>/dev/null echo
+	| test export /usr/bin --verbose 'quoted text' done echo | readonly done |
+	"$1" local readonly grep export export
+	"$@" then /usr/bin local echo local && | "$@" --verbose grep -eu "$@"
+"$@" x=1 --verbose "$@" echo readonly | x=1 cd /usr/bin awk sed ${HOME} 2>/dev/null
+		test "$1" readonly sed echo then test awk 2>/dev/null then $(pwd) done printf
+		--verbose sed && printf echo
+		cd export x=1 ${HOME}
+	--verbose 'quoted text' /usr/bin export 'quoted text' test test
+		$(pwd) 2>/dev/null ${HOME} ${HOME} 'quoted text' $(pwd) then test ${HOME}
+	grep --verbose readonly awk sed echo awk export grep 'quoted text'
+	'quoted text' readonly && | && export echo readonly test echo
+	'quoted text' $(pwd) $(pwd) awk 2>/dev/null
+printf test sed "$@" echo | $(pwd) readonly x=1 export export 'quoted text'
+	$(pwd) x=1 $(pwd) grep ${HOME} /usr/bin echo ${HOME} test grep --verbose export
+	'quoted text' && x=1 export x=1 && 'quoted text' "$1"
+		test && then local done readonly
+2>/dev/null "$@" grep "$1" "$1" -eu test "$1" printf 2>/dev/null
+		$(pwd) local /usr/bin awk grep local test ${HOME} then /usr/bin done done
+'quoted text' then readonly | && --verbose sed
+readonly test done test
+		grep /usr/bin $(pwd) x=1 grep then local | echo echo -eu --verbose cd sed
+-eu ${HOME} --verbose && x=1 "$@" 'quoted text' && 2>/dev/null
+	/usr/bin awk readonly /usr/bin echo && readonly $(pwd) && then awk
+x=1 sed ${HOME} /usr/bin --verbose printf export $(pwd) "$@" /usr/bin -eu "$1"
+	then local && ${HOME} /usr/bin then $(pwd) awk /usr/bin
+x=1 'quoted text' local /usr/bin x=1 awk readonly ${HOME} done sed done
+	export 'quoted text' -eu sed 'quoted text'
+		sed test --verbose 'quoted text' export readonly export $(pwd) -eu done
+'quoted text' ${HOME} | | test 2>/dev/null &&
+		test && then cd printf echo echo echo cd "$@" x=1 "$1" readonly
+	sed --verbose 2>/dev/null && awk
+		then /usr/bin "$@" test && sed test done local awk
+&& done 'quoted text' readonly then ${HOME} export /usr/bin
+		$(pwd) 2>/dev/null readonly | printf grep "$1" readonly cd
+	cd 2>/dev/null 'quoted text' local
+		x=1 awk x=1 then then x=1 /usr/bin awk x=1 then test done grep
+	--verbose | printf | 2>/dev/null
+	export sed sed then x=1 --verbose local "$@" x=1 printf
+grep "$@" awk x=1 /usr/bin -eu x=1 echo local "$1" 2>/dev/null
+x=1 done 2>/dev/null "$1" test local export $(pwd) done awk cd "$1"
+$(pwd) sed ${HOME} "$1" printf awk "$@" -eu awk readonly
+		"$@" awk -eu export done echo export awk --verbose /usr/bin x=1
+		"$1" "$@" ${HOME} cd --verbose /usr/bin $(pwd) -eu done --verbose
+	"$@" awk ${HOME} 2>/dev/null ${HOME} "$@" test then
+		${HOME} grep readonly -eu echo local echo ${HOME} printf sed | $(pwd) "$1"
+	readonly ${HOME} export awk done 'quoted text' x=1 cd -eu "$@"
+	x=1 2>/dev/null 2>/dev/null ${HOME} 'quoted text' 2>/dev/null
+		echo echo grep -eu --verbose then
+x=1 && 2>/dev/null && local export awk cd $(pwd)
+	--verbose printf x=1 &&
+| $(pwd) 'quoted text' local sed
+	/usr/bin $(pwd) /usr/bin cd grep readonly echo sed grep
+	${HOME} printf x=1 "$1" export
+	then cd test then grep test test readonly cd then test --verbose done export --verbose
+	/usr/bin | -eu done "$@" cd test ${HOME} $(pwd)
+x=1 /usr/bin grep | sed printf sed readonly cd then test local local
+		${HOME} /usr/bin ${HOME}
+		sed export 'quoted text' local echo 'quoted text'
+	local readonly echo local cd "$1" && test
+		awk "$@" "$1" readonly "$1" printf local /usr/bin grep --verbose &&
+		grep readonly done -eu sed export /usr/bin "$1" awk echo grep
+echo | $(pwd) | x=1 local "$1" -eu done ${HOME} awk awk sed --verbose
+		2>/dev/null 2>/dev/null readonly
+		grep cd --verbose cd done cd awk /usr/bin sed 2>/dev/null
+		then /usr/bin 'quoted text' ${HOME}
+	'quoted text' ${HOME}
+export && printf printf 2>/dev/null x=1 | ${HOME} then test sed "$@" readonly
+		readonly export test done --verbose cd then printf
+		then --verbose export $(pwd) sed -eu
+		test x=1 /usr/bin --verbose
+		2>/dev/null sed --verbose 2>/dev/null then sed "$@" done 'quoted text'
+test printf sed $(pwd) grep local /usr/bin test printf --verbose
+local 'quoted text' /usr/bin -eu --verbose $(pwd) $(pwd) grep
+	done | "$1" $(pwd) /usr/bin
+-eu 2>/dev/null 2>/dev/null "$@" "$1" | printf
+		$(pwd) && grep --verbose -eu 2>/dev/null | test echo printf echo /usr/bin
+--verbose echo grep cd 2>/dev/null
+	| "$1" | awk | sed local then $(pwd) "$1" &&
+	x=1 cd "$@" local 'quoted text' awk "$@" /usr/bin
+	${HOME} readonly --verbose awk 2>/dev/null
+export cd ${HOME} --verbose
+		then then $(pwd) readonly "$@" readonly
+/usr/bin echo export -eu grep "$1" --verbose "$@" && cd x=1 printf sed cd --verbose
+	then --verbose && "$@" done ${HOME} && x=1
+		'quoted text' printf test test /usr/bin
+	$(pwd) | printf | "$@" readonly
+	readonly "$@" echo $(pwd) export ${HOME}
+	"$1" echo export && echo 'quoted text' x=1 ${HOME} local 2>/dev/null
+		awk | 2>/dev/null printf done sed 2>/dev/null
+x=1 readonly printf then 2>/dev/null "$@" cd 'quoted text'
+	-eu "$@" echo ${HOME} | cd then
+"$@" done cd -eu sed test 2>/dev/null --verbose x=1
+		grep ${HOME} then readonly
+		grep grep ${HOME} readonly cd "$1" && "$@" ${HOME} printf done
+		"$@" cd then --verbose ${HOME} then export sed sed | "$@" -eu done 2>/dev/null
+	then export sed test 2>/dev/null && sed 'quoted text' awk
+echo local test export sed | printf x=1 echo && awk -eu &&
+/usr/bin readonly x=1 2>/dev/null /usr/bin "$1"
+	x=1 cd --verbose test x=1 | x=1 echo cd /usr/bin
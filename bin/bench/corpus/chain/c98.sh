@@ -0,0 +1,2001 @@
+	test export local then 2>/dev/null x=1 2>/dev/null /usr/bin export && sed 'quoted text'
+"$1" "$1" --verbose awk then grep $(pwd) awk ${HOME}
+printf -eu test done /usr/bin grep
+awk ${HOME} 'quoted text' /usr/bin local | export 2>/dev/null && "$1" "$@"
+		export sed && done | $(pwd) awk test "$1" $(pwd) cd export
+	export export 'quoted text' sed local test sed
+	/usr/bin readonly $(pwd) -eu /usr/bin
+		x=1 | done ${HOME} --verbose
+echo ${HOME} then 2>/dev/null
+	'quoted text' x=1 local done /usr/bin sed echo local
+	$(pwd) echo grep && local readonly
+	readonly printf --verbose echo grep awk echo test local sed grep
+	&& 2>/dev/null export | 2>/dev/null done "$1"
+	printf 'quoted text' done export x=1 cd x=1
+	awk grep ${HOME} && | sed done export export awk grep then grep $(pwd) readonly
+cd ${HOME} then then local cd 'quoted text' done done cd export then local sed
+		2>/dev/null -eu test && $(pwd) test
+	export readonly export x=1 grep cd && done $(pwd) echo local --verbose
+${HOME} local awk readonly test cd local
+$(pwd) 'quoted text' awk cd printf echo
+--verbose "$1" -eu x=1
+		"$@" grep "$@" --verbose local /usr/bin then awk cd local then 'quoted text'
+then test readonly x=1 "$1" done --verbose 2>/dev/null grep "$1" awk
+		test 2>/dev/null done sed readonly local && then /usr/bin x=1 ${HOME} sed awk |
+-eu $(pwd) --verbose then "$1" sed x=1 export 'quoted text'
+		grep 'quoted text' echo $(pwd) export $(pwd)
+	cd awk grep sed "$@" local
+| local done | /usr/bin "$@"
+		local sed grep grep done then
+&& awk && echo | "$@" "$@" local
+	test grep 2>/dev/null local "$1"
+awk readonly printf cd echo "$1" then "$@" then $(pwd) | then export
+	$(pwd) | 'quoted text'
+local -eu "$@" 'quoted text' done awk && cd -eu --verbose cd "$1" 'quoted text'
+		x=1 2>/dev/null x=1 "$1"
+echo ${HOME} awk sed echo readonly local then local cd --verbose export 'quoted text'
+		awk x=1 2>/dev/null --verbose | 2>/dev/null echo "$1" export $(pwd) grep then
+		grep test printf --verbose -eu readonly | "$1" 2>/dev/null
+"$1" grep sed done awk export local -eu echo "$1" test printf
+	printf x=1 done printf "$1" ${HOME} x=1 2>/dev/null grep readonly then
+sed "$1" local x=1 && 2>/dev/null /usr/bin -eu sed
+export test x=1 cd 'quoted text'
+echo sed grep $(pwd) $(pwd) grep then test cd cd echo ${HOME} grep 2>/dev/null
+		awk 'quoted text' printf "$1" && grep
+	echo cd --verbose local sed export ${HOME} --verbose
+&& 'quoted text' awk -eu 2>/dev/null $(pwd)
+"$@" "$1" done "$@" printf readonly "$1" readonly
+		then | test then -eu "$@" --verbose local echo then sed 'quoted text'
+	test readonly ${HOME} export
+		grep "$1" 2>/dev/null 2>/dev/null && local $(pwd) | sed
+		-eu test 2>/dev/null sed x=1 export ${HOME} 2>/dev/null
+done awk then echo && ${HOME}
+	| export grep --verbose x=1 $(pwd) echo x=1 cd export
+		"$1" && "$@" 'quoted text' 'quoted text' readonly export -eu /usr/bin x=1 && printf
+		${HOME} "$1" && "$@" "$@" x=1 then 'quoted text'
+		readonly | -eu test $(pwd) cd sed --verbose --verbose $(pwd)
+		'quoted text' readonly $(pwd) "$1" local sed
+		export sed --verbose grep "$1" export 'quoted text' sed done local 2>/dev/null
+	readonly | | printf readonly /usr/bin cd test --verbose
+$(pwd) readonly printf 'quoted text' local cd "$@" 'quoted text' 'quoted text'
+		echo grep local echo then $(pwd) local echo && -eu
+		echo 2>/dev/null sed local cd "$@" grep x=1 cd "$1" "$@" | grep echo then --verbose
+	echo readonly then /usr/bin then -eu && 2>/dev/null awk "$1" then
+	awk test local readonly 'quoted text'
+		"$1" | sed "$1" | x=1 then 2>/dev/null && awk && done done --verbose echo
+	echo $(pwd) $(pwd) 'quoted text' sed "$@" "$@" local
+		echo "$@" printf cd sed cd "$@" "$@" ${HOME} echo 'quoted text' x=1 local
+		--verbose $(pwd) done $(pwd) export local done -eu test local "$@" $(pwd) --verbose
+	/usr/bin cd readonly local ${HOME} cd
+		"$1" readonly --verbose 'quoted text' echo readonly "$@" printf $(pwd) readonly
+	"$1" "$@" export "$@" 2>/dev/null | && cd /usr/bin local grep
+		test awk echo cd -eu | printf $(pwd) awk sed x=1 done awk 2>/dev/null | | done
+cd local 'quoted text' && grep
+	test "$@" --verbose 'quoted text' echo
+	| 'quoted text' 'quoted text' 'quoted text' cd sed export readonly
+printf echo grep "$@" /usr/bin 'quoted text'
+	export /usr/bin readonly test sed ${HOME} grep test "$@" readonly
+	"$1" 'quoted text' ${HOME}
+		done echo done "$@" ${HOME} grep
+	echo done test x=1 printf test echo 2>/dev/null export |
+	x=1 awk then | done "$@" export export && -eu
+${HOME} | -eu echo ${HOME} done echo ${HOME}
+	"$@" grep test readonly "$@" test readonly "$@"
+	2>/dev/null export test sed /usr/bin --verbose sed then cd ${HOME} local
+		sed && 'quoted text' printf grep cd 2>/dev/null
+printf echo $(pwd) 'quoted text'
+	'quoted text' ${HOME} "$1" ${HOME} readonly readonly
+		| 2>/dev/null 2>/dev/null $(pwd) export then done 'quoted text'
+sed done /usr/bin $(pwd) echo readonly cd 'quoted text' /usr/bin
+	grep awk "$1" "$@" test /usr/bin --verbose
+		export then && test export "$1" test echo 2>/dev/null /usr/bin local local
+		x=1 cd x=1 && export printf cd done readonly
+		x=1 readonly 2>/dev/null grep
+/usr/bin "$1" /usr/bin then printf local
+| ${HOME} -eu then printf ${HOME} test 2>/dev/null test
+		| cd readonly done "$@" x=1 done test printf local "$@" 2>/dev/null x=1 --verbose
+	grep readonly cd local 2>/dev/null && readonly "$1" -eu | done 'quoted text'
+printf done -eu done test --verbose awk then &&
+	x=1 "$@" -eu $(pwd) local "$1" /usr/bin grep && "$1"
+| echo --verbose x=1 -eu readonly
+		local "$@" "$@" "$@" cd echo
+'quoted text' echo ${HOME} local 2>/dev/null
+		"$1" x=1 x=1 "$1" echo --verbose sed | awk test 'quoted text' "$1" x=1 echo
+-eu "$1" local x=1 grep sed test readonly awk 2>/dev/null
+test -eu then done 2>/dev/null 2>/dev/null 'quoted text' "$1" ${HOME}
+	export /usr/bin && then
+		x=1 local x=1 -eu --verbose export awk x=1 readonly local
+/usr/bin test grep test sed sed 2>/dev/null
+"$@" 2>/dev/null awk -eu printf
+cd $(pwd) echo local test done sed /usr/bin $(pwd)
+| | test done readonly readonly x=1 printf 'quoted text'
+		grep echo sed done sed ${HOME}
+		readonly test export /usr/bin sed sed ${HOME}
+	x=1 | export "$@" x=1 x=1 $(pwd) /usr/bin /usr/bin --verbose readonly "$1" export
+	"$1" readonly done 2>/dev/null "$1" printf readonly
+		"$1" awk "$@" test test 'quoted text' printf cd readonly printf
+		printf 2>/dev/null awk cd echo then done "$1" -eu
+&& test grep local cd "$1" export echo "$@" echo ${HOME} 2>/dev/null
+		local 'quoted text' "$@" test
+	"$@" ${HOME} && local "$@" done ${HOME} /usr/bin local export
+	done "$1" grep printf --verbose cd readonly test "$1"
+	&& x=1 export then /usr/bin
+	$(pwd) ${HOME} echo 2>/dev/null
+&& sed cd cd $(pwd) --verbose grep local
+| echo --verbose awk
+		${HOME} cd printf grep local
+cd x=1 grep x=1 readonly cd "$1" && readonly readonly
+	sed ${HOME} /usr/bin x=1
+"$1" export $(pwd) awk "$@" readonly printf grep
+"$1" "$@" done readonly readonly echo /usr/bin export ${HOME} "$@"
+		printf cd && done "$1" echo
+		x=1 export readonly local test echo $(pwd) readonly
+		done && 'quoted text' local 'quoted text'
+		/usr/bin then && then x=1 | printf && "$1" 2>/dev/null done "$1" cd
+		cd awk | "$1" echo $(pwd) test sed test 2>/dev/null echo echo awk local test
+"$@" /usr/bin sed test grep
+		-eu export | echo /usr/bin x=1 ${HOME} "$@" 2>/dev/null grep sed then "$1" done
+		local $(pwd) awk cd then test grep 'quoted text'
+	awk done 'quoted text' local -eu awk readonly printf && --verbose
+		echo grep ${HOME} 'quoted text' "$@" export
+		grep -eu ${HOME} readonly /usr/bin local grep
+	awk | readonly x=1 grep && then -eu && /usr/bin 2>/dev/null awk | grep && /usr/bin
+		sed 2>/dev/null /usr/bin $(pwd) printf
+	awk 'quoted text' test /usr/bin /usr/bin done
+		sed sed $(pwd) 2>/dev/null "$1" echo /usr/bin 'quoted text' 2>/dev/null -eu 2>/dev/null
+then awk awk ${HOME} 2>/dev/null ${HOME}
+awk local echo 2>/dev/null -eu readonly
+	export printf -eu /usr/bin -eu export then sed grep 2>/dev/null
+printf "$@" && /usr/bin --verbose sed "$1" readonly
+		'quoted text' "$@" echo 'quoted text' awk then readonly /usr/bin
+	cd "$1" ${HOME} 'quoted text' echo ${HOME}
+		cd then test 'quoted text' grep x=1 done /usr/bin printf --verbose -eu
+		${HOME} "$1" awk done done echo export grep echo 2>/dev/null sed 2>/dev/null
+		$(pwd) echo awk 2>/dev/null local -eu grep "$@" done $(pwd) echo
+		then x=1 ${HOME} 2>/dev/null | "$@" $(pwd) then printf grep "$@" $(pwd) "$@" readonly
+test -eu 'quoted text' && local
+2>/dev/null 'quoted text' done --verbose && && local --verbose
+sed awk export "$1" awk && cd x=1 && cd export ${HOME} awk ${HOME} sed local "$@"
+		printf 'quoted text' "$1" && awk $(pwd) cd cd "$1"
+		| readonly echo test echo done then local cd /usr/bin echo /usr/bin x=1 done
+		awk -eu then x=1 ${HOME} then x=1 readonly ${HOME}
+		test $(pwd) 2>/dev/null grep $(pwd) 'quoted text' echo 'quoted text' cd |
+		$(pwd) --verbose done test printf test && done ${HOME}
+		"$@" $(pwd) cd 'quoted text' 2>/dev/null printf printf printf
+	grep --verbose /usr/bin x=1 then /usr/bin awk awk local "$1" --verbose done
+| cd 'quoted text' /usr/bin
+		readonly test export 'quoted text' export awk x=1 local "$1"
+readonly done /usr/bin --verbose
+		-eu grep local 2>/dev/null
+local 2>/dev/null -eu "$1" then x=1 -eu "$@" printf
+	readonly -eu local readonly 2>/dev/null
+"$1" readonly /usr/bin ${HOME} export x=1 done 'quoted text'
+		sed printf echo && | "$@" -eu --verbose done
+&& export cd test grep ${HOME} grep | -eu $(pwd) /usr/bin "$1" readonly
+2>/dev/null "$1" export --verbose x=1 printf -eu
+done x=1 echo echo --verbose "$@" printf awk "$1" then x=1
+		${HOME} readonly awk --verbose local cd && 2>/dev/null printf x=1 --verbose sed
+		x=1 "$1" done x=1 sed grep readonly ${HOME} ${HOME} -eu /usr/bin "$@" sed
+	then ${HOME} printf | cd "$@" test 'quoted text'
+local then grep then then done test test grep printf sed 'quoted text'
+| echo echo printf "$1" sed $(pwd) readonly printf 2>/dev/null grep --verbose
+export export cd $(pwd) local export done printf readonly
+	local cd local "$@" cd local 2>/dev/null done &&
+/usr/bin "$1" test sed test printf then export "$1" readonly "$@"
+--verbose sed 'quoted text' -eu done /usr/bin
+	echo done x=1 /usr/bin cd then "$1" ${HOME}
+$(pwd) --verbose sed done -eu then "$1" -eu local ${HOME}
+		| awk then local x=1 done done printf
+&& -eu $(pwd) | printf && -eu --verbose readonly local done x=1
+sed done local 'quoted text' readonly cd 'quoted text' --verbose -eu local
+		grep awk echo readonly cd then sed readonly export grep awk 2>/dev/null
+grep --verbose echo x=1 local /usr/bin
+		sed 2>/dev/null && /usr/bin 'quoted text'
+		--verbose x=1 'quoted text' awk "$@" /usr/bin ${HOME} "$@" 2>/dev/null
+		readonly readonly readonly 2>/dev/null awk -eu ${HOME} -eu | "$@" grep
+		sed printf 'quoted text' 2>/dev/null --verbose test test
+	readonly export 2>/dev/null echo
+printf ${HOME} && done "$1" -eu "$1" echo sed cd
+		&& grep local --verbose "$1" -eu 2>/dev/null | "$@"
+| sed test printf "$@" sed readonly /usr/bin 'quoted text' "$@" awk printf
+printf echo | | printf "$1"
+		&& awk echo sed sed /usr/bin x=1 x=1 x=1 2>/dev/null printf "$@" grep done /usr/bin
+		readonly awk x=1 "$@"
+	printf then | export 'quoted text' printf "$1" && then && $(pwd)
+	-eu "$1" done 2>/dev/null echo printf sed done readonly
+	sed export -eu --verbose -eu /usr/bin echo && /usr/bin done ${HOME} test sed
+	then echo printf readonly "$1" awk "$@" 'quoted text'
+	/usr/bin readonly awk /usr/bin export sed $(pwd) cd echo local sed export echo
+		cd ${HOME} "$1" ${HOME}
+sed ${HOME} ${HOME} local then | 2>/dev/null
+then readonly local 'quoted text' 2>/dev/null
+		${HOME} x=1 grep && 'quoted text'
+		x=1 export /usr/bin echo -eu then grep local test sed 2>/dev/null "$1" "$1" "$@"
+echo "$@" awk awk awk sed "$1" 'quoted text'
+	export then cd x=1 -eu x=1 grep 'quoted text' done grep && local
+printf grep | export "$@" | test readonly "$@" /usr/bin echo export
+	"$1" /usr/bin /usr/bin grep
+	"$1" 2>/dev/null $(pwd) "$1"
+"$1" | then -eu --verbose
+		x=1 awk sed sed test ${HOME} --verbose 2>/dev/null
+		echo readonly "$@" 2>/dev/null ${HOME} $(pwd)
+		"$@" $(pwd) done "$@" /usr/bin then done ${HOME} "$1" 2>/dev/null grep cd && cd
+local done printf readonly printf cd test then cd && sed "$@"
+then -eu local readonly
+-eu local echo && then local echo "$1" && 'quoted text'
+		export && "$@" | grep --verbose export sed sed ${HOME} ${HOME}
+		"$@" export | sed then | $(pwd)
+&& cd sed cd echo test "$1" local "$1" $(pwd)
+&& grep $(pwd) | | cd x=1
+		2>/dev/null cd && cd x=1 $(pwd) $(pwd) "$1" echo grep
+		"$@" x=1 ${HOME} echo export
+done --verbose 'quoted text'
+	awk awk "$@" sed export then && && readonly "$@" echo 'quoted text' /usr/bin
+printf echo x=1 2>/dev/null /usr/bin readonly /usr/bin
+"$@" then local $(pwd) local $(pwd)
+		sed export 'quoted text' "$@" printf then 'quoted text'
+	-eu sed && "$1" then local "$@" -eu grep
+2>/dev/null awk grep awk readonly grep
+	echo -eu 'quoted text' sed | echo --verbose grep --verbose
+done local "$@" cd echo grep --verbose x=1 readonly /usr/bin echo export
+	done sed test "$1" then done 2>/dev/null echo awk echo && ${HOME} export
+		echo | 2>/dev/null test export -eu
+'quoted text' readonly 2>/dev/null test test
+		2>/dev/null -eu 'quoted text' "$@" then awk echo local echo $(pwd)
+		'quoted text' && "$@" && printf sed $(pwd) printf cd
+		"$1" $(pwd) ${HOME} && /usr/bin then "$1"
+		readonly 2>/dev/null export grep
+		test 'quoted text' "$@" grep
+		readonly && grep -eu 2>/dev/null then cd local "$@" test -eu
+		sed test "$1" x=1 | echo cd $(pwd) echo awk 'quoted text' 'quoted text'
+		"$1" awk 'quoted text' $(pwd) then && -eu done
+		${HOME} $(pwd) | echo awk export grep local awk
+export && sed "$@" echo | awk readonly --verbose then sed /usr/bin ${HOME}
+x=1 2>/dev/null local
+		--verbose /usr/bin "$@" && ${HOME} echo echo
+'quoted text' echo grep && readonly 2>/dev/null echo "$@" grep test cd &&
+	$(pwd) echo "$1" local "$1" sed
+		test /usr/bin "$@" local done
+	then && export done ${HOME} awk readonly && local "$1" echo grep
+&& local cd local /usr/bin cd $(pwd) then
+&& then sed test ${HOME} 2>/dev/null -eu echo then 2>/dev/null local readonly
+x=1 export ${HOME} 2>/dev/null test
+	/usr/bin printf "$@" printf awk /usr/bin test export awk 'quoted text' printf
+| && $(pwd) && 'quoted text' cd cd --verbose "$@" export $(pwd)
+		--verbose readonly cd "$@" /usr/bin awk then readonly 'quoted text' $(pwd)
+	test 2>/dev/null export
+	"$@" "$@" sed $(pwd) test x=1 local && test -eu test /usr/bin printf
+${HOME} readonly then 2>/dev/null printf printf "$@" sed -eu done "$@"
+	$(pwd) readonly then test && /usr/bin /usr/bin | then awk export
+		$(pwd) test sed "$@" awk 'quoted text' "$1" | test sed export printf export
+then ${HOME} $(pwd) "$1" ${HOME} readonly $(pwd) /usr/bin 'quoted text' 'quoted text'
+local "$@" 2>/dev/null printf $(pwd) $(pwd) sed ${HOME} awk ${HOME} 'quoted text'
+		x=1 awk $(pwd) test echo cd --verbose ${HOME} && "$@" && grep readonly
+${HOME} awk | sed export -eu
+		${HOME} readonly local done 2>/dev/null
+${HOME} readonly 2>/dev/null x=1 sed printf --verbose grep "$1"
+		export cd "$@" | --verbose -eu && "$1" /usr/bin x=1 | 'quoted text'
+--verbose readonly readonly echo -eu ${HOME} 2>/dev/null ${HOME}
+	x=1 /usr/bin export test printf -eu done sed && done ${HOME}
+		$(pwd) cd sed "$1" sed 'quoted text' printf 2>/dev/null 2>/dev/null
+	local 2>/dev/null sed /usr/bin test "$@" awk export
+sed printf $(pwd) ${HOME} printf
+		2>/dev/null cd 'quoted text' /usr/bin test awk /usr/bin "$1" ${HOME} readonly
+		echo -eu echo | echo printf && awk awk echo ${HOME}
+	"$1" | then 2>/dev/null done x=1 readonly $(pwd) grep --verbose
+printf then grep "$@" readonly ${HOME} && cd cd readonly
+	-eu 2>/dev/null printf ${HOME}
+/usr/bin export "$@"
+	sed /usr/bin readonly ${HOME} grep $(pwd) 2>/dev/null
+then 2>/dev/null cd "$@" grep 'quoted text' && export cd $(pwd) then done ${HOME}
+		test export ${HOME} awk /usr/bin awk
+awk "$@" then printf awk test $(pwd)
+sed 'quoted text' then cd | local $(pwd) 'quoted text' "$@" local local --verbose
+	local echo printf grep --verbose sed 2>/dev/null
+	export -eu ${HOME} ${HOME} echo done
+printf cd 'quoted text' $(pwd) printf ${HOME} -eu ${HOME} awk awk readonly
+		${HOME} local -eu done cd local cd readonly done 'quoted text'
+"$@" "$1" 2>/dev/null export awk grep "$1"
+	${HOME} awk cd export $(pwd) then
+	export /usr/bin | local
+	2>/dev/null | $(pwd) -eu x=1 && export -eu done
+	/usr/bin cd /usr/bin cd local "$@" test x=1
+	echo local test --verbose
+export sed printf 2>/dev/null echo 2>/dev/null
+"$1" awk x=1 ${HOME} x=1 ${HOME} printf --verbose -eu "$@" 'quoted text' test
+	then "$1" "$@" test x=1 && echo
+		done sed $(pwd) "$1" ${HOME} | test
+done local local then cd && | readonly "$@" 'quoted text' &&
+	x=1 ${HOME} test --verbose -eu cd --verbose x=1 2>/dev/null test
+${HOME} && ${HOME} readonly cd && readonly test
+	test sed printf ${HOME} export local --verbose echo 'quoted text'
+x=1 readonly done readonly export "$@"
+		cd sed --verbose done grep x=1 sed grep export && done | /usr/bin -eu && --verbose
+/usr/bin x=1 readonly awk grep /usr/bin -eu -eu cd export 'quoted text'
+sed awk sed then -eu grep test && "$1" $(pwd) printf sed
+	"$1" 2>/dev/null then local
+	/usr/bin local ${HOME} && done readonly --verbose export $(pwd) sed -eu done
+| | ${HOME} "$@" grep --verbose awk x=1 && export && done test --verbose
+	-eu | then "$@" --verbose ${HOME}
+		printf --verbose 2>/dev/null awk awk readonly "$1" sed
+	&& "$@" cd "$@" test x=1 x=1 grep cd awk cd && "$@" x=1 done /usr/bin printf done
+		echo done readonly printf | -eu "$@"
+	local printf then test "$@" -eu
+		/usr/bin done "$1" export test | "$1" local "$@" test "$@"
+		2>/dev/null grep -eu 'quoted text' && then "$@" done grep | | echo
+		$(pwd) $(pwd) x=1 "$1" printf ${HOME} test --verbose sed | readonly
+awk sed then | $(pwd) 2>/dev/null "$@" local | cd /usr/bin
+&& local /usr/bin printf echo grep "$@" cd | -eu -eu /usr/bin --verbose readonly
+done export grep && 'quoted text' cd /usr/bin test awk
+		echo awk --verbose test
+	cd local readonly x=1 export cd then export export
+	2>/dev/null -eu then test --verbose sed $(pwd)
+"$@" 'quoted text' | done --verbose
+"$1" ${HOME} /usr/bin
+export export cd 'quoted text' "$1" /usr/bin cd awk |
+		&& 2>/dev/null -eu done awk export echo "$@" x=1 echo 2>/dev/null
+		'quoted text' && local $(pwd) awk test
+	then echo cd then "$1" awk sed -eu then /usr/bin
+	grep /usr/bin 'quoted text' -eu sed 'quoted text' 'quoted text'
+local | 'quoted text' test printf --verbose
+		&& "$@" done done $(pwd) x=1 --verbose export
+	$(pwd) then export printf echo local awk sed grep && && x=1 test done x=1 "$1"
+sed done "$1" "$1" x=1 "$1"
+		export export then done && sed then sed awk printf --verbose
+done /usr/bin "$@" awk 2>/dev/null then cd
+x=1 sed awk awk ${HOME} 'quoted text' 'quoted text'
+	-eu "$@" --verbose $(pwd) 'quoted text' printf grep
+	x=1 test "$1" done export
+grep ${HOME} grep readonly sed x=1 -eu export
+	then 2>/dev/null "$1" ${HOME} x=1 readonly 2>/dev/null
+	printf then x=1 x=1 echo sed x=1 then $(pwd)
+	done | done -eu grep | $(pwd) ${HOME} 2>/dev/null export
+		readonly "$@" awk done readonly local | ${HOME} export cd
+		x=1 cd done $(pwd) done sed grep then done
+		local | readonly --verbose printf sed
+&& && export "$@" ${HOME}
+	${HOME} local "$1" && awk cd /usr/bin readonly export printf $(pwd) cd
+		readonly readonly sed /usr/bin x=1 grep ${HOME} --verbose done readonly
+cd 2>/dev/null $(pwd) local done "$1"
+		&& readonly awk | 'quoted text' echo
+		export $(pwd) grep awk /usr/bin
+		'quoted text' && /usr/bin 'quoted text' echo
+$(pwd) 2>/dev/null then $(pwd)
+		x=1 done 'quoted text' awk export echo grep
+	test local cd "$1" then export $(pwd)
+		export "$@" then $(pwd) "$1"
+	${HOME} test sed x=1 echo -eu -eu sed 2>/dev/null
+		"$1" then $(pwd) 2>/dev/null echo readonly "$@" ${HOME} done echo readonly
+	| local --verbose then export | grep done x=1
+done | export readonly export 2>/dev/null
+test cd awk printf "$@" grep sed sed $(pwd) printf readonly awk x=1 test
+	awk test 'quoted text' cd sed cd x=1 export && then /usr/bin |
+export sed $(pwd) -eu | test cd ${HOME} readonly
+	local printf printf x=1 /usr/bin printf echo
+	--verbose export grep && sed then && readonly "$@" /usr/bin |
+		awk && then cd x=1 -eu --verbose && $(pwd) export ${HOME} "$1" then $(pwd)
+&& $(pwd) done x=1 awk && | "$@" /usr/bin
+grep -eu grep "$1" cd grep echo then | local
+	export $(pwd) "$1" cd then 'quoted text'
+	export local --verbose ${HOME} "$@" 'quoted text' readonly cd -eu echo
+		&& 'quoted text' -eu 2>/dev/null local export --verbose
+	${HOME} -eu x=1 then /usr/bin then
+		done 'quoted text' | awk awk x=1 2>/dev/null awk x=1 readonly test printf printf
+sed x=1 export /usr/bin x=1 export test "$1"
+-eu grep sed awk "$1"
+		| awk && printf export readonly readonly
+&& "$@" && printf | echo ${HOME} awk cd readonly
+	${HOME} echo /usr/bin
+		local sed 'quoted text' then && "$@" x=1 done
+	export x=1 "$@" /usr/bin
+$(pwd) 'quoted text' x=1 /usr/bin printf awk export echo "$@"
+2>/dev/null local awk printf ${HOME} grep cd printf /usr/bin "$1" --verbose
+	-eu $(pwd) "$@" sed | test then sed
+		-eu printf -eu done test cd local "$@" "$@" sed | test done && test
+--verbose 2>/dev/null -eu /usr/bin then grep x=1 -eu ${HOME}
+		'quoted text' x=1 x=1 "$@" && -eu && echo cd | awk "$@"
+	then grep sed --verbose sed sed 'quoted text' done /usr/bin test cd "$@" /usr/bin
+	x=1 2>/dev/null cd echo 2>/dev/null
+awk grep x=1 local "$1" "$1" 2>/dev/null export printf cd grep test $(pwd)
+	"$@" cd readonly -eu awk $(pwd)
+echo 'quoted text' local export x=1 export then | "$@" local test 2>/dev/null
+x=1 'quoted text' | $(pwd) x=1 sed
+/usr/bin readonly $(pwd) | done $(pwd) cd grep
+		grep | grep echo sed /usr/bin /usr/bin "$@" $(pwd) /usr/bin grep
+		readonly "$@" "$1" --verbose ${HOME} && ${HOME} "$@" 2>/dev/null local printf
+	then "$@" test $(pwd) | -eu | then cd $(pwd) printf $(pwd) local --verbose
+	done $(pwd) x=1 "$1" grep local cd && readonly x=1 export
+printf && export 2>/dev/null done 2>/dev/null
+	readonly ${HOME} | then x=1 export "$@" ${HOME} echo cd grep
+	--verbose grep $(pwd) -eu echo /usr/bin
+	"$@" export echo local
+	printf ${HOME} | cd sed
+sed echo done printf echo 'quoted text' -eu ${HOME}
+local awk 2>/dev/null echo done 'quoted text' test |
+	"$@" 'quoted text' test ${HOME} echo 2>/dev/null --verbose local grep then
+	readonly ${HOME} test
+		&& "$1" "$@" $(pwd) awk cd | 2>/dev/null
+	--verbose 2>/dev/null | echo
+	echo && test done x=1 awk echo test x=1 export --verbose
+		then sed awk 2>/dev/null cd ${HOME} cd printf readonly /usr/bin test
+	"$1" test export test /usr/bin -eu awk
+	local && awk "$1" export x=1 -eu $(pwd) echo echo sed && cd export /usr/bin
+		x=1 x=1 awk ${HOME} -eu
+2>/dev/null 2>/dev/null then test
+then sed x=1 -eu "$1" readonly
+		grep sed export awk | | -eu | /usr/bin "$1" test 2>/dev/null
+	"$1" test cd export 2>/dev/null awk grep "$@"
+		2>/dev/null then && test && x=1 "$@" test ${HOME} "$1" awk done done | 'quoted text'
+		grep "$@" done sed x=1 awk | export awk "$@"
+		"$1" $(pwd) printf local && test printf
+	"$@" $(pwd) sed export ${HOME}
+local "$1" test | echo ${HOME} export 'quoted text' test done awk export
+	echo x=1 export ${HOME} awk x=1 $(pwd) && sed done ${HOME} | | "$1" | readonly
+		echo sed --verbose $(pwd) "$@" export
+"$@" printf 2>/dev/null /usr/bin export 2>/dev/null test x=1 printf sed /usr/bin
+		--verbose readonly --verbose printf "$@" test x=1 'quoted text' cd "$1" awk
+	cd -eu echo /usr/bin done -eu && /usr/bin $(pwd)
+		'quoted text' --verbose $(pwd)
+		/usr/bin -eu 2>/dev/null cd grep readonly
+		'quoted text' -eu printf echo done local -eu -eu 'quoted text'
+export /usr/bin ${HOME}
+grep --verbose local sed | "$@" 2>/dev/null local $(pwd) done 2>/dev/null 'quoted text'
+		grep sed then test 'quoted text' awk "$1" | "$@" grep --verbose x=1 grep "$1"
+	2>/dev/null test && local ${HOME} then ${HOME} printf x=1 $(pwd) -eu cd 'quoted text'
+export echo readonly /usr/bin
+		local done awk "$@" grep grep ${HOME} local --verbose grep
+	&& grep /usr/bin -eu awk cd $(pwd) 'quoted text' test 'quoted text'
+done x=1 local "$@" cd readonly | echo "$1"
+"$1" export | sed then "$@" local x=1
+awk | 'quoted text' cd 2>/dev/null
+		grep printf done 2>/dev/null -eu cd $(pwd) && readonly | 2>/dev/null
+		awk --verbose /usr/bin sed --verbose
+${HOME} then grep export && | --verbose sed
+2>/dev/null && /usr/bin then --verbose
+${HOME} /usr/bin test awk echo --verbose $(pwd) | test $(pwd) && x=1 x=1 x=1 'quoted text'
+	local -eu "$@" test x=1 "$1" "$@" local "$1"
+		2>/dev/null echo 2>/dev/null $(pwd) sed 2>/dev/null
+printf readonly cd 'quoted text' | "$1"
+	$(pwd) done readonly local sed local grep
+echo test then local done 2>/dev/null | export
+		grep --verbose 'quoted text' 'quoted text' | printf echo
+	-eu /usr/bin 'quoted text' then export "$1" 'quoted text'
+echo -eu "$@" "$@" local local --verbose echo --verbose test cd
+then 2>/dev/null /usr/bin cd "$@" /usr/bin local
+2>/dev/null sed local $(pwd) | ${HOME} -eu grep "$1" cd "$1" local -eu 2>/dev/null
+	x=1 then grep export && "$@" 'quoted text' "$1" sed | $(pwd) /usr/bin
+		export cd ${HOME} "$1" done ${HOME} test "$@" sed grep export local cd "$1"
+$(pwd) x=1 sed 'quoted text' readonly --verbose export sed "$1" printf export
+	$(pwd) printf "$@" export --verbose "$1" $(pwd) cd $(pwd) && | export ${HOME} test
+	2>/dev/null -eu awk 2>/dev/null test && done
+readonly readonly done cd "$1" -eu awk echo --verbose
+	2>/dev/null printf $(pwd) | grep /usr/bin then $(pwd) -eu
+		"$1" sed $(pwd) --verbose printf
+${HOME} | 'quoted text' then cd cd test "$1" /usr/bin printf echo 'quoted text'
+printf 'quoted text' export && echo ${HOME} test
+		x=1 cd "$@" sed cd grep test then "$1" && && awk $(pwd) "$1" grep
+2>/dev/null cd echo ${HOME} grep $(pwd)
+		local sed awk /usr/bin -eu local ${HOME} "$1" test "$1" "$@" test done awk
+		readonly then echo cd --verbose
+"$1" grep $(pwd) | 'quoted text' "$@" /usr/bin /usr/bin cd then grep 2>/dev/null
+	| 2>/dev/null 2>/dev/null local echo
+		--verbose $(pwd) printf printf
+		x=1 printf "$@" export export readonly
+		echo local | 2>/dev/null "$1" test "$1" readonly
+${HOME} done readonly grep then /usr/bin
+		local cd -eu local --verbose export local then done -eu readonly local
+	"$1" 2>/dev/null -eu x=1
+		| | test "$@" local grep test readonly
+	x=1 --verbose "$1" --verbose export -eu --verbose
+awk sed -eu local export --verbose echo sed cd echo "$@"
+		--verbose printf "$@" -eu grep sed -eu test readonly
+		readonly /usr/bin -eu
+		readonly --verbose test x=1 2>/dev/null test --verbose | sed
+	grep && test "$1" -eu && 'quoted text'
+		test --verbose 2>/dev/null "$@" export 2>/dev/null grep
+	readonly cd awk grep export ${HOME} | /usr/bin 'quoted text' printf -eu
+	local /usr/bin done readonly
+	--verbose /usr/bin export 'quoted text' 2>/dev/null
+x=1 cd | 'quoted text' | grep && && awk ${HOME} $(pwd) -eu cd && /usr/bin sed
+		"$1" grep $(pwd) 'quoted text' printf local
+--verbose | then $(pwd) "$1" test
+	test x=1 grep echo --verbose cd ${HOME} done test local
+test awk readonly x=1 test cd test ${HOME} echo
+		x=1 2>/dev/null /usr/bin echo local 'quoted text'
+	awk | && x=1 'quoted text' sed echo | printf local ${HOME} "$@"
+		export 2>/dev/null "$@" | printf grep ${HOME}
+$(pwd) --verbose 'quoted text' echo && /usr/bin cd echo local -eu
+2>/dev/null /usr/bin $(pwd) then x=1 -eu
+		grep done "$1" test awk
+test grep test local "$@" readonly ${HOME}
+awk "$1" done echo then printf sed readonly test -eu local export
+		x=1 then /usr/bin && -eu | awk grep test x=1 /usr/bin
+		2>/dev/null grep grep "$@"
+	2>/dev/null done awk export "$@" awk test echo "$1" cd 'quoted text' | x=1
+		cd x=1 -eu awk ${HOME} "$@" test export readonly awk sed "$@" test 'quoted text'
+readonly cd $(pwd) -eu grep sed
+&& x=1 -eu then $(pwd) test test done printf done export "$1" cd --verbose
+	printf ${HOME} done test 2>/dev/null x=1 local
+	export x=1 -eu echo "$@" export |
+cd && | ${HOME} | sed then echo ${HOME} echo cd cd awk cd
+	$(pwd) /usr/bin echo cd test cd export local && 2>/dev/null done then x=1
+readonly echo "$@" -eu echo done
+		/usr/bin 'quoted text' | printf 'quoted text' x=1 then awk sed 2>/dev/null
+		2>/dev/null test | done --verbose readonly test test grep done
+		'quoted text' --verbose test $(pwd) ${HOME} -eu cd 2>/dev/null
+	printf "$1" test --verbose export "$1"
+done local --verbose ${HOME}
+	export local export $(pwd) done "$1" awk x=1 'quoted text'
+	'quoted text' --verbose -eu test "$1" ${HOME} --verbose --verbose
+&& ${HOME} 'quoted text' &&
+	${HOME} printf test 'quoted text' && "$1" | ${HOME} local export ${HOME}
+	-eu sed cd && readonly | $(pwd) "$@" | "$1" grep ${HOME} then awk
+	x=1 grep done done echo
+	2>/dev/null printf echo -eu 2>/dev/null
+		"$@" local | -eu echo awk | 2>/dev/null 'quoted text'
+		'quoted text' grep grep "$@" local x=1 x=1 | "$1" awk grep $(pwd)
+	-eu done readonly && awk
+2>/dev/null && printf local echo 'quoted text' -eu local
+	readonly && cd sed local awk 2>/dev/null 2>/dev/null
+	readonly | echo readonly local x=1 x=1 2>/dev/null awk cd
+		--verbose && /usr/bin 'quoted text'
+"$1" -eu printf printf test then done
+	${HOME} && x=1 sed test
+		cd "$@" /usr/bin ${HOME} local done 'quoted text'
+x=1 --verbose /usr/bin /usr/bin $(pwd) grep local
+		sed local $(pwd) --verbose -eu x=1
+		printf readonly sed local test x=1 $(pwd) --verbose /usr/bin /usr/bin sed
+-eu "$@" | grep -eu cd -eu cd $(pwd) --verbose
+&& awk cd awk | cd then grep test grep sed 2>/dev/null x=1 readonly --verbose
+		local && test 'quoted text' test echo /usr/bin cd test local
+		export sed echo 'quoted text' "$1" test echo 'quoted text' awk "$1" -eu | done
+--verbose --verbose $(pwd) -eu | 'quoted text'
+test printf 'quoted text' && 'quoted text' test "$@" echo "$1" export
+	"$@" && test grep ${HOME} then awk
+	grep awk readonly export cd $(pwd) echo $(pwd)
+$(pwd) "$1" cd sed --verbose | ${HOME} "$@" --verbose ${HOME} local
+-eu export /usr/bin 'quoted text' 'quoted text' then
+echo local grep test "$@" | echo export --verbose 'quoted text'
+		awk readonly then awk grep ${HOME}
+/usr/bin export -eu test 'quoted text' -eu -eu
+		${HOME} x=1 --verbose 'quoted text'
+		"$@" readonly -eu --verbose --verbose x=1 grep printf echo x=1 test
+"$@" $(pwd) echo x=1 grep "$@" $(pwd) "$1" -eu ${HOME}
+"$@" --verbose cd 'quoted text' && ${HOME} cd printf /usr/bin grep
+		awk done $(pwd) done x=1 ${HOME}
+		awk "$@" local --verbose printf -eu awk export "$@" -eu -eu /usr/bin
+		&& grep "$@" ${HOME} 2>/dev/null | |
+	awk --verbose echo $(pwd) | test readonly cd | x=1 done
+	| -eu done then /usr/bin x=1 awk readonly awk local then "$@"
+	export ${HOME} --verbose cd awk sed
+		-eu -eu --verbose awk echo awk 'quoted text' export -eu test ${HOME}
+	"$1" sed $(pwd) local /usr/bin $(pwd) done then ${HOME}
+	/usr/bin export 'quoted text' local -eu
+"$@" awk -eu "$@" readonly -eu x=1 export
+	done "$1" cd "$1" local awk cd --verbose
+	echo 'quoted text' then --verbose readonly done "$1" 'quoted text' 2>/dev/null
+${HOME} --verbose sed 2>/dev/null
+		"$@" | "$@" cd --verbose export x=1 echo test --verbose
+	&& readonly | /usr/bin sed && readonly ${HOME}
+cd cd echo test /usr/bin /usr/bin /usr/bin
+readonly readonly 'quoted text' sed readonly
+| done | printf local awk 'quoted text' 'quoted text'
+grep "$1" readonly sed && 2>/dev/null local x=1 x=1 | /usr/bin
+		'quoted text' $(pwd) && x=1 then awk sed
+$(pwd) 2>/dev/null "$1"
+	echo then then && then "$1" sed 2>/dev/null done | local x=1 export x=1 /usr/bin
+test ${HOME} -eu $(pwd) echo echo printf x=1 awk printf
+'quoted text' | local then sed printf echo && awk /usr/bin && echo && local
+	awk -eu test /usr/bin export
+${HOME} 2>/dev/null | done cd && test printf ${HOME} 2>/dev/null done ${HOME} &&
+-eu test $(pwd) local --verbose done x=1 /usr/bin
+export export "$@" export grep 'quoted text'
+--verbose x=1 test /usr/bin -eu echo test /usr/bin echo readonly "$@" sed --verbose
+	'quoted text' test test -eu &&
+	'quoted text' cd local
+		2>/dev/null local grep "$1" --verbose done --verbose sed echo echo
+		-eu | "$1" printf cd grep -eu /usr/bin "$@" grep | --verbose export --verbose
+		echo local grep awk printf test cd "$@" sed echo test "$@" echo
+	${HOME} && -eu printf x=1 local 'quoted text'
+		printf export -eu sed | "$@" done cd | "$1" readonly x=1
+		"$@" "$@" sed /usr/bin --verbose local | export grep then printf readonly echo
+x=1 test ${HOME} awk sed export
+printf cd awk readonly export
+		"$@" awk printf echo && echo x=1 --verbose /usr/bin
+		done -eu awk test awk /usr/bin x=1 cd
+	2>/dev/null grep echo $(pwd) sed "$1" ${HOME}
+		x=1 done 2>/dev/null grep 'quoted text' sed export then sed
+	$(pwd) then && "$@" then $(pwd) x=1 'quoted text'
+		--verbose printf -eu local cd printf readonly | -eu sed 'quoted text'
+| ${HOME} then echo --verbose sed x=1 local "$1" done && cd --verbose
+	"$@" -eu readonly done $(pwd) local 'quoted text' readonly x=1 2>/dev/null
+		&& ${HOME} done 'quoted text' readonly
+awk x=1 sed -eu then grep | printf echo printf
+local printf done done 'quoted text'
+		2>/dev/null awk -eu local awk
+		readonly && "$@" export 'quoted text' export | then local awk echo /usr/bin local
+		/usr/bin && printf "$1" "$@" -eu readonly
+		${HOME} "$@" printf readonly
+	cd 2>/dev/null | test test sed echo export
+		/usr/bin grep 'quoted text' "$1" && | done
+		readonly export done 'quoted text' && "$@" x=1 | "$1" sed done grep 'quoted text'
+awk grep x=1 then /usr/bin && 'quoted text'
+	| | /usr/bin local test | test "$1" then
+done x=1 done --verbose grep export test "$1" ${HOME}
+	local grep then cd --verbose sed readonly ${HOME} /usr/bin
+		cd printf 2>/dev/null 2>/dev/null
+	then local -eu sed -eu
+then --verbose echo local export
+		export 2>/dev/null export 2>/dev/null && 'quoted text'
+		readonly --verbose readonly cd grep cd $(pwd) | /usr/bin
+		echo readonly x=1 $(pwd) test /usr/bin cd 2>/dev/null
+		&& done ${HOME} done -eu echo && local
+		-eu -eu $(pwd) -eu awk test -eu $(pwd)
+	sed sed export printf ${HOME} then $(pwd) sed --verbose echo $(pwd) done test
+		$(pwd) readonly export -eu done readonly --verbose
+		-eu -eu done x=1 printf ${HOME} 2>/dev/null readonly then grep then test
+		&& readonly && done cd test ${HOME} "$@" | readonly $(pwd) 2>/dev/null cd &&
+	x=1 sed readonly echo "$1" cd printf printf awk -eu
+"$1" -eu x=1 then readonly 'quoted text' readonly local awk
+--verbose then sed x=1 cd x=1 ${HOME}
+	--verbose /usr/bin then --verbose
+	printf --verbose 2>/dev/null | ${HOME}
+x=1 sed echo echo /usr/bin echo readonly
+	2>/dev/null then x=1 done export "$1" 2>/dev/null then
+		readonly ${HOME} "$1" cd test local && && "$@" -eu echo printf test 'quoted text'
+local export --verbose awk && /usr/bin | grep
+		2>/dev/null -eu "$@" | printf "$@" awk "$@" ${HOME}
+	done export "$1" "$1" 2>/dev/null
+2>/dev/null /usr/bin then test awk sed "$1" printf
+'quoted text' $(pwd) export && cd done grep sed awk
+	${HOME} printf then grep && local 2>/dev/null printf && | | grep printf grep done
+		local x=1 awk | x=1 -eu awk --verbose $(pwd) sed | ${HOME} --verbose
+		x=1 printf test grep sed &&
+	'quoted text' export sed x=1 2>/dev/null done awk --verbose 2>/dev/null
+echo test 'quoted text' readonly awk $(pwd) 'quoted text'
+		2>/dev/null test test x=1 then readonly /usr/bin ${HOME} echo 2>/dev/null
+		export ${HOME} cd x=1 printf test
+done "$@" && cd x=1 cd awk awk
+"$1" sed echo x=1 2>/dev/null
+awk /usr/bin echo grep test "$1" grep local echo export "$@"
+awk cd printf && sed readonly 2>/dev/null awk $(pwd) done "$1"
+		cd x=1 "$1" readonly export test sed grep sed readonly cd
+		cd /usr/bin cd $(pwd) "$@" ${HOME} && 2>/dev/null local readonly printf
+	&& grep ${HOME} "$1" done
+	-eu x=1 export then local done readonly export export
+		${HOME} printf sed export printf test sed awk "$1" export 2>/dev/null
+readonly export export
+		sed && "$@" then "$1" grep sed $(pwd) echo local readonly
+	awk test 2>/dev/null 2>/dev/null
+x=1 "$1" && 2>/dev/null echo readonly test cd -eu && sed
+sed "$1" awk "$@" x=1 sed test done "$@"
+test "$1" awk cd done | then "$1" awk --verbose printf test ${HOME} -eu 2>/dev/null
+		&& printf readonly $(pwd) -eu awk
+	/usr/bin 'quoted text' | -eu printf "$@" local "$@" | sed | -eu
+		"$@" sed 'quoted text' test ${HOME} "$1" cd cd /usr/bin
+		--verbose ${HOME} "$@" "$@" done printf local -eu test $(pwd) "$@"
+local --verbose x=1 cd -eu && then test "$1" done local echo grep
+grep done sed "$@" echo sed && -eu /usr/bin 'quoted text' /usr/bin
+		x=1 "$1" 'quoted text' 'quoted text'
+	awk /usr/bin "$@" cd --verbose grep sed 2>/dev/null && -eu
+		done x=1 "$@" $(pwd) $(pwd) cd cd test && done && $(pwd)
+--verbose export test x=1 sed
+	&& echo $(pwd) "$1" sed "$@" -eu awk export then ${HOME} test cd --verbose
+	done then echo sed test /usr/bin
+/usr/bin --verbose ${HOME}
+		"$@" then /usr/bin 'quoted text'
+	local printf export readonly x=1 grep 2>/dev/null
+echo 2>/dev/null local printf 2>/dev/null done --verbose x=1 $(pwd)
+	${HOME} $(pwd) awk ${HOME} --verbose
+		cd x=1 2>/dev/null "$1" "$1"
+	echo export echo -eu x=1 readonly grep $(pwd) export local "$1" --verbose
+		then | x=1 /usr/bin echo "$1" "$1" ${HOME} && && --verbose
+		&& then ${HOME} ${HOME} awk grep cd sed then ${HOME} $(pwd) ${HOME} 2>/dev/null
+	"$@" test awk grep | printf x=1 local
+"$@" $(pwd) 'quoted text' done 'quoted text' printf 'quoted text'
+		"$1" readonly "$1" grep awk x=1 /usr/bin "$@" "$@"
+		awk $(pwd) 'quoted text' local awk readonly done
+	${HOME} test readonly 'quoted text' then 'quoted text'
+awk "$@" export "$@" -eu
+	echo $(pwd) --verbose cd readonly test --verbose
+	readonly cd | test sed done
+"$1" $(pwd) 'quoted text' done readonly done --verbose | "$1" "$@" local
+${HOME} | 2>/dev/null grep -eu then --verbose $(pwd) awk cd "$1" --verbose
+		| 2>/dev/null readonly done awk
+		"$1" test grep sed /usr/bin && && x=1 test then
+awk 2>/dev/null test export export awk 2>/dev/null /usr/bin
+		done "$1" ${HOME} "$@" then cd cd x=1 'quoted text' | local readonly $(pwd)
+"$@" x=1 echo grep echo then /usr/bin --verbose "$@" awk -eu awk
+sed export then "$@" && test done cd ${HOME} "$1" x=1 ${HOME}
+	&& "$@" --verbose x=1 ${HOME} ${HOME} cd 'quoted text' 'quoted text' x=1
+${HOME} | printf awk ${HOME} sed grep x=1 awk
+	2>/dev/null export ${HOME} echo
+export "$@" && && grep echo x=1 "$@"
+grep ${HOME} /usr/bin echo ${HOME} /usr/bin 'quoted text'
+		$(pwd) 'quoted text' echo && 2>/dev/null grep 2>/dev/null ${HOME}
+		-eu ${HOME} "$1" $(pwd) $(pwd) $(pwd)
+		--verbose "$1" $(pwd) then "$1" $(pwd) local
+${HOME} printf then "$1" ${HOME}
+		${HOME} local -eu 'quoted text' export readonly export 2>/dev/null 'quoted text'
+		awk "$@" ${HOME} "$1" && local cd | "$@" export
+export && /usr/bin | sed $(pwd) cd 'quoted text' "$@" then "$1" "$1" x=1
+'quoted text' grep export local echo -eu test local sed
+readonly -eu 'quoted text' x=1 printf
+	'quoted text' && /usr/bin -eu awk printf export
+	&& x=1 -eu -eu sed --verbose sed && --verbose echo /usr/bin echo echo
+		export done printf readonly | &&
+	export local --verbose readonly
+	done 2>/dev/null test ${HOME} --verbose 'quoted text'
+	2>/dev/null x=1 readonly readonly $(pwd) printf -eu && && local echo /usr/bin
+		2>/dev/null sed export sed
+	cd "$1" $(pwd) test test sed
+	${HOME} ${HOME} 'quoted text' done /usr/bin
+${HOME} sed && export $(pwd) $(pwd) "$1" ${HOME}
+		-eu export 'quoted text'
+	${HOME} test sed -eu test 'quoted text' local cd grep awk "$1" then test | echo
+		printf sed ${HOME} "$@" test && /usr/bin then --verbose
+		--verbose export $(pwd) "$@" /usr/bin 'quoted text' test $(pwd) "$@" $(pwd)
+	| | "$1" sed "$1" local then grep && echo 2>/dev/null test readonly test export
+		$(pwd) test --verbose ${HOME} echo $(pwd) test awk printf --verbose
+		/usr/bin readonly local "$1" $(pwd) export local "$@"
+'quoted text' done local done cd -eu x=1 --verbose "$@" -eu printf
+&& "$1" printf done && $(pwd) -eu "$@" readonly awk 'quoted text' test
+		-eu && 2>/dev/null done printf awk --verbose "$@" 2>/dev/null
+		2>/dev/null --verbose 2>/dev/null x=1 /usr/bin test printf && -eu ${HOME}
+printf grep "$1" echo sed "$1" then export readonly then readonly sed
+sed "$1" readonly --verbose ${HOME} sed cd "$@" printf | printf
+		'quoted text' ${HOME} $(pwd) 2>/dev/null done
+		echo ${HOME} grep test readonly /usr/bin test local
+	awk awk test readonly ${HOME} 'quoted text' done
+	"$1" test /usr/bin 'quoted text' printf echo
+		${HOME} 2>/dev/null sed -eu
+		cd grep grep x=1 local export done
+done cd $(pwd) 2>/dev/null awk && 2>/dev/null -eu done ${HOME} echo
+		"$@" done echo printf printf readonly /usr/bin 'quoted text'
+	2>/dev/null --verbose local cd then /usr/bin test | ${HOME} awk local
+readonly done $(pwd) ${HOME} && /usr/bin sed --verbose $(pwd) $(pwd) then "$@"
+	then "$1" readonly --verbose
+	done 2>/dev/null "$1" test export 2>/dev/null "$1" 'quoted text'
+${HOME} test --verbose 2>/dev/null && ${HOME} echo "$@" "$1" readonly
+		/usr/bin echo --verbose sed done readonly done sed /usr/bin grep awk --verbose
+	awk --verbose then "$@" && grep 2>/dev/null printf test cd awk echo test && echo
+		grep --verbose x=1 sed ${HOME}
+	then 'quoted text' done
+	export awk local done then grep readonly grep sed --verbose readonly readonly test
+done $(pwd) test printf readonly x=1 test then x=1 export
+/usr/bin "$1" grep -eu x=1 --verbose test ${HOME} "$1" | /usr/bin "$1" $(pwd)
+-eu 'quoted text' -eu x=1 $(pwd) echo /usr/bin test then local --verbose sed 'quoted text'
+		"$1" 'quoted text' | 'quoted text' export awk ${HOME} 'quoted text'
+	x=1 x=1 2>/dev/null then then "$@" grep x=1 -eu
+		"$@" printf printf 'quoted text' then printf && ${HOME} "$@" --verbose
+"$@" then "$@" export sed ${HOME} done $(pwd) -eu ${HOME}
+/usr/bin "$@" echo cd 'quoted text'
+	'quoted text' ${HOME} test x=1 --verbose cd --verbose
+		| 'quoted text' awk x=1 local --verbose done awk -eu
+export readonly then sed then --verbose echo readonly cd "$1"
+		readonly done $(pwd) grep readonly grep then sed ${HOME} && && | export
+		&& awk done $(pwd) | --verbose && local local echo awk -eu 2>/dev/null
+	'quoted text' export $(pwd) awk echo local sed
+	awk x=1 /usr/bin test | sed --verbose 'quoted text' 'quoted text' sed ${HOME}
+		&& | cd ${HOME} /usr/bin 2>/dev/null echo grep -eu -eu
+		echo "$@" test export -eu /usr/bin grep
+		/usr/bin && awk "$1" && 'quoted text' printf sed printf "$@" | ${HOME}
+&& echo sed -eu x=1 echo 2>/dev/null
+		'quoted text' | --verbose --verbose
+	/usr/bin "$1" --verbose -eu sed "$@" test export
+test echo grep printf "$1" "$1"
+		--verbose ${HOME} then
+	grep ${HOME} printf export
+	test | then ${HOME} done $(pwd) $(pwd) sed x=1 2>/dev/null
+awk readonly export test grep grep x=1 done "$1" test sed
+/usr/bin then echo local "$1" readonly -eu local then awk local
+x=1 ${HOME} ${HOME} awk 2>/dev/null awk grep x=1 /usr/bin grep local export
+		test --verbose done 'quoted text'
+		&& cd ${HOME} /usr/bin then 2>/dev/null cd
+	-eu sed export cd --verbose export grep sed x=1 /usr/bin
+-eu -eu | "$@" export test awk readonly
+		echo then cd /usr/bin /usr/bin printf
+		local printf --verbose readonly cd done 'quoted text'
+		awk printf then /usr/bin ${HOME} 'quoted text'
+		'quoted text' $(pwd) sed cd /usr/bin readonly "$@" cd ${HOME} test local 'quoted text'
+	readonly | echo cd x=1 "$1" && /usr/bin local x=1 awk $(pwd) 'quoted text'
+	cd ${HOME} export grep --verbose $(pwd) | x=1 grep sed 2>/dev/null
+		then readonly | cd readonly ${HOME}
+	"$@" sed --verbose -eu -eu && test -eu ${HOME} sed 2>/dev/null "$1"
+	"$1" printf sed x=1 "$@" | readonly awk cd printf
+	${HOME} readonly "$1" grep x=1 printf && --verbose $(pwd) /usr/bin /usr/bin &&
+		export awk ${HOME} 2>/dev/null 2>/dev/null readonly
+	-eu done --verbose /usr/bin /usr/bin 2>/dev/null grep local printf local local then
+		echo export then awk cd "$@"
+printf -eu readonly readonly 2>/dev/null 2>/dev/null 2>/dev/null sed
+	"$@" local then /usr/bin grep then printf done "$1" -eu
+	| test /usr/bin echo grep /usr/bin /usr/bin export test 2>/dev/null
+x=1 grep readonly grep then
+		"$@" echo echo done then done printf cd readonly "$1" 2>/dev/null
+/usr/bin grep | printf awk /usr/bin local x=1 | "$1" 'quoted text' grep echo local
+	test echo readonly --verbose /usr/bin
+	&& export /usr/bin x=1 awk $(pwd) readonly ${HOME} then
+	2>/dev/null done export "$1" /usr/bin cd grep
+local readonly 2>/dev/null awk $(pwd) then local then awk export /usr/bin $(pwd)
+'quoted text' "$1" "$1" printf | "$1" | 2>/dev/null $(pwd)
+		grep echo x=1 printf ${HOME} local sed
+"$1" sed -eu ${HOME} awk awk test sed /usr/bin readonly
+awk printf -eu grep $(pwd) test done echo | "$@" "$1" local
+local awk cd awk 2>/dev/null 'quoted text' export awk printf
+2>/dev/null echo test --verbose
+	sed test | -eu 2>/dev/null done && local "$@" export $(pwd) x=1
+	local local grep ${HOME} 2>/dev/null $(pwd) 'quoted text'
+		x=1 "$1" -eu test "$1" -eu grep $(pwd) export /usr/bin readonly | cd && x=1 ${HOME}
+		local 'quoted text' 'quoted text' 'quoted text'
+-eu grep x=1 $(pwd) done export && /usr/bin $(pwd) "$1" local printf
+	2>/dev/null x=1 $(pwd) done /usr/bin echo sed $(pwd) echo ${HOME}
+grep && "$1" done done $(pwd) "$@" && --verbose /usr/bin | "$@"
+local | export then && readonly 2>/dev/null then | test -eu | sed grep
+--verbose --verbose 2>/dev/null grep 2>/dev/null
+		then awk x=1 echo $(pwd) && ${HOME}
+		grep "$1" $(pwd) $(pwd) 2>/dev/null /usr/bin local -eu 2>/dev/null --verbose then
+| x=1 /usr/bin sed 'quoted text' "$@" cd cd $(pwd) sed --verbose local
+readonly --verbose $(pwd) --verbose ${HOME} ${HOME} local grep
+printf --verbose "$@" ${HOME} local ${HOME} grep
+		test then $(pwd) done /usr/bin done
+		/usr/bin -eu readonly "$1" grep
+		${HOME} "$1" export awk --verbose local done then --verbose
+	printf "$@" "$@" export cd then readonly "$@"
+	done ${HOME} echo && && ${HOME} 'quoted text' ${HOME} printf echo
+grep awk printf test sed printf
+	local export && 'quoted text' test --verbose
+	| -eu ${HOME} "$@" printf && -eu
+		then ${HOME} 'quoted text' export 2>/dev/null
+	$(pwd) cd 2>/dev/null awk sed "$@" printf done && && -eu "$1"
+		/usr/bin grep done 2>/dev/null
+		readonly cd grep printf && local then cd /usr/bin
+	then readonly echo awk cd "$1" --verbose printf 2>/dev/null awk
+		'quoted text' test printf
+	${HOME} readonly then echo --verbose && printf printf -eu echo local
+	sed printf export cd "$1" -eu grep test | cd grep printf awk
+	grep --verbose test printf
+	grep -eu readonly readonly
+	&& $(pwd) awk && --verbose /usr/bin export
+test cd cd "$1" awk x=1 'quoted text' sed grep 'quoted text' 2>/dev/null
+		/usr/bin "$1" awk printf grep test local local
+		2>/dev/null test | grep
+printf x=1 sed local cd awk export | x=1 test cd
+	x=1 awk /usr/bin "$@" ${HOME} --verbose | $(pwd)
+readonly 'quoted text' local readonly "$1" printf test then
+	sed awk export ${HOME} export
+		'quoted text' -eu "$1" "$1" then awk
+printf printf done ${HOME} readonly cd ${HOME} 'quoted text' readonly
+		local test /usr/bin printf readonly printf "$1" 'quoted text'
+		"$@" -eu 'quoted text' "$@" -eu 2>/dev/null
+		2>/dev/null && echo export x=1 | grep grep 'quoted text' done test "$1"
+${HOME} awk sed $(pwd) test
+		'quoted text' grep readonly 'quoted text'
+		| echo awk "$@" done 'quoted text' /usr/bin cd echo $(pwd) "$@" && "$1"
+		| "$@" ${HOME} | 'quoted text' printf sed $(pwd) ${HOME} ${HOME} --verbose
+awk "$@" readonly cd test 2>/dev/null export "$1" sed /usr/bin "$1" then
+awk | 'quoted text' 'quoted text' cd done export then | test ${HOME} $(pwd) 2>/dev/null
+		readonly echo 'quoted text' 2>/dev/null sed x=1 readonly $(pwd)
+test export test /usr/bin test readonly | readonly then x=1 echo then awk /usr/bin
+	&& 2>/dev/null then printf x=1 && readonly then awk | $(pwd)
+awk "$1" awk $(pwd) 2>/dev/null ${HOME} cd ${HOME} --verbose readonly
+		echo && awk sed "$1" | export
+		sed sed | printf echo printf ${HOME} awk local | grep && local grep ${HOME} printf
+cd cd sed echo /usr/bin cd "$1" printf "$1" done
+	x=1 readonly $(pwd) printf "$1" grep then sed $(pwd) | && 2>/dev/null awk echo
+| printf -eu /usr/bin printf sed echo --verbose
+-eu && | 2>/dev/null grep then && 2>/dev/null cd --verbose 'quoted text'
+/usr/bin --verbose && printf printf test test -eu "$1" awk then | --verbose
+&& && 'quoted text' readonly "$@" /usr/bin "$@" 'quoted text'
+'quoted text' printf "$1" export echo $(pwd)
+	-eu then 'quoted text' "$1" echo echo 'quoted text' local | && $(pwd) ${HOME}
+	test echo 'quoted text'
+		&& "$@" /usr/bin "$1" done readonly
+done sed echo printf grep echo 'quoted text' then local echo /usr/bin cd 2>/dev/null
+	test done "$@" "$@" printf grep ${HOME} ${HOME}
+local local 'quoted text' echo ${HOME}
+		"$1" --verbose --verbose
+awk then done export /usr/bin && ${HOME}
+		${HOME} sed done "$@" local test awk && done
+	'quoted text' grep done grep "$@" then 2>/dev/null | | ${HOME}
+readonly cd printf cd done "$1" cd echo printf
+		export && -eu && test test local | export
+		&& test export local -eu cd echo
+		--verbose | then "$1" echo "$1" cd then --verbose x=1 done test 2>/dev/null
+	${HOME} local x=1 cd /usr/bin "$@" cd "$1" "$1"
+$(pwd) sed /usr/bin cd printf -eu -eu
+		"$1" | export ${HOME} printf --verbose awk echo "$@" grep then awk echo --verbose
+awk echo "$1" --verbose
+local ${HOME} local then ${HOME} 2>/dev/null sed && echo readonly
+echo $(pwd) export echo x=1 sed --verbose
+	done readonly test -eu done echo sed ${HOME} printf ${HOME}
+	2>/dev/null /usr/bin sed then sed sed echo local local cd "$@" x=1 local awk
+--verbose "$@" sed 2>/dev/null x=1 readonly readonly | $(pwd) local local done
+	cd local awk export sed -eu
+		2>/dev/null && test grep |
+--verbose cd && $(pwd) sed --verbose
+	export 'quoted text' $(pwd) $(pwd) local
+x=1 echo -eu local "$1" echo 'quoted text'
+	local echo "$1" /usr/bin && test export -eu grep echo "$1" readonly
+	/usr/bin test readonly $(pwd) ${HOME} 2>/dev/null
+"$1" 2>/dev/null ${HOME}
+grep /usr/bin awk grep && $(pwd)
+	local ${HOME} "$@" && -eu | && -eu ${HOME} local readonly sed
+	echo echo 2>/dev/null $(pwd) --verbose
+&& printf x=1 -eu | ${HOME} local readonly
+printf 'quoted text' cd then grep /usr/bin
+${HOME} ${HOME} ${HOME} echo test local -eu awk "$1" --verbose && grep local
+	"$@" local echo local echo | awk echo $(pwd) then done | sed 2>/dev/null sed
+		&& local readonly ${HOME} echo && echo readonly test done /usr/bin
+"$@" done printf 2>/dev/null "$@" x=1
+"$@" test /usr/bin 2>/dev/null 2>/dev/null export x=1 x=1 awk export
+		"$1" local -eu ${HOME} test 2>/dev/null
+	2>/dev/null grep sed "$@" test then x=1 awk echo
+		then --verbose awk readonly 'quoted text' 'quoted text'
+		export sed /usr/bin | done printf readonly -eu
+test 'quoted text' test echo readonly printf "$@" readonly "$1" readonly
+	-eu 2>/dev/null && local ${HOME}
+		then $(pwd) "$@" cd && sed --verbose | test "$1"
+		&& then 2>/dev/null printf | /usr/bin
+	cd export /usr/bin sed && export
+&& readonly | readonly cd 2>/dev/null echo 2>/dev/null echo sed test sed echo
+		done echo sed echo sed awk && sed then
+awk && x=1 cd then done then "$1" echo cd awk $(pwd) && "$1" x=1 x=1 &&
+	$(pwd) "$@" echo then test grep "$@" $(pwd) done "$1"
+"$@" ${HOME} 'quoted text' x=1 test done /usr/bin /usr/bin 'quoted text'
+	grep readonly test "$@" export awk 2>/dev/null cd test readonly
+		sed test then "$@" "$1" 2>/dev/null -eu ${HOME} readonly echo x=1 test
+${HOME} printf | "$@" done -eu then test /usr/bin -eu done sed "$@" "$1"
+	test x=1 cd "$1" export test 2>/dev/null
+		${HOME} "$1" cd 'quoted text' --verbose grep x=1 then readonly awk echo -eu
+		2>/dev/null cd 'quoted text' awk
+	local "$1" echo cd x=1 test printf sed "$@" ${HOME} 'quoted text'
+x=1 export "$@" readonly "$1" readonly grep then "$1" | printf
+		| "$@" sed /usr/bin $(pwd) echo printf done | then local
+	cd grep then ${HOME} local
+		readonly readonly "$1" "$1" cd echo grep echo export
+export local "$@" --verbose && | ${HOME}
+/usr/bin 2>/dev/null x=1 test 2>/dev/null
+	grep grep grep local grep --verbose x=1 | ${HOME} "$1" printf
+	--verbose awk $(pwd) export test readonly done 2>/dev/null
+	/usr/bin ${HOME} "$1" then local 'quoted text' test
+local 'quoted text' then "$1" 'quoted text' /usr/bin grep
+		$(pwd) $(pwd) --verbose test
+		grep | -eu cd $(pwd) "$1" then
+printf sed 'quoted text' --verbose | echo printf | -eu "$@" readonly | readonly
+		printf grep /usr/bin "$1" done "$@" local
+done "$1" printf readonly && /usr/bin
+	&& then grep $(pwd) echo awk readonly
+	-eu test --verbose "$@" -eu echo "$@" export echo echo 2>/dev/null | grep
+awk export "$1" printf done
+		grep "$1" x=1 && sed echo local 'quoted text'
+		then test export echo "$@" "$1" export test export --verbose test "$@" --verbose
+		${HOME} done 2>/dev/null 2>/dev/null awk --verbose --verbose cd awk local
+	printf 2>/dev/null --verbose 'quoted text' echo 'quoted text'
+readonly "$@" then /usr/bin then $(pwd) local then $(pwd) local echo readonly
+	export echo awk cd done $(pwd) ${HOME}
+--verbose printf awk && "$1" then local done
+		printf cd then && printf x=1 /usr/bin
+		'quoted text' printf /usr/bin awk awk && ${HOME} | grep printf
+	2>/dev/null $(pwd) -eu local readonly done "$@" awk | ${HOME} "$@"
+		awk export export && /usr/bin test done "$@" | /usr/bin
+		then export $(pwd) x=1 sed printf then done "$1" export
+${HOME} sed sed && test
+	readonly awk done x=1 | grep export cd "$@" "$@" echo "$1" x=1 awk /usr/bin
+	2>/dev/null 2>/dev/null export
+	printf then echo local test cd --verbose
+	2>/dev/null x=1 local | local
+'quoted text' --verbose -eu then x=1 sed $(pwd) | readonly 2>/dev/null
+--verbose sed sed "$@" ${HOME} ${HOME} local done 'quoted text'
+		then "$1" ${HOME} local test awk done "$1" echo | /usr/bin printf
+		--verbose then done printf "$1" echo "$1" local
+	then 'quoted text' export grep sed | local sed x=1 cd 2>/dev/null /usr/bin sed
+$(pwd) $(pwd) $(pwd) && /usr/bin x=1 /usr/bin -eu readonly printf readonly $(pwd)
+then 'quoted text' export /usr/bin printf printf then 'quoted text' readonly --verbose
+	awk 2>/dev/null /usr/bin awk printf local
+	x=1 cd /usr/bin done --verbose /usr/bin
+		"$@" done cd grep readonly cd --verbose | &&
+	'quoted text' 'quoted text' "$1" readonly | readonly x=1 | grep
+	test awk done -eu ${HOME} "$@" printf "$1"
+"$1" -eu 'quoted text' "$1" test readonly
+--verbose x=1 | && then "$@" printf 2>/dev/null x=1 --verbose awk 2>/dev/null
+#include c99.sh
+export /usr/bin $(pwd) ${HOME} local local | && printf grep
+		-eu grep $(pwd) "$1" printf then "$1" printf done cd | "$@" --verbose
+	cd done 2>/dev/null -eu export "$@" 'quoted text' echo
+$(pwd) $(pwd) then done --verbose "$1" 'quoted text'
+	--verbose && grep ${HOME} then done cd --verbose $(pwd) echo local
+	--verbose ${HOME} printf
+	export then $(pwd) "$@"
+2>/dev/null echo /usr/bin
+	${HOME} /usr/bin export ${HOME} printf readonly
+printf && /usr/bin done printf readonly ${HOME} && "$1" --verbose --verbose test
+		readonly -eu && cd grep ${HOME} printf
+		readonly | --verbose --verbose 2>/dev/null "$@" test | then x=1 x=1 $(pwd) local
+		'quoted text' done && --verbose --verbose $(pwd) | ${HOME} awk readonly cd "$1"
+		echo "$@" $(pwd) 'quoted text' /usr/bin local x=1 x=1 && cd readonly cd then
+/usr/bin /usr/bin | "$@" x=1
+	sed /usr/bin export x=1 | x=1 export $(pwd) export
+		2>/dev/null "$1" | | cd awk readonly export done
+grep --verbose echo test && test "$@" test -eu awk --verbose grep "$1" 2>/dev/null
+	then /usr/bin readonly printf -eu --verbose x=1
+		$(pwd) $(pwd) 'quoted text'
+		| | x=1 export && 2>/dev/null "$1" x=1 cd --verbose done test 2>/dev/null export
+		--verbose done /usr/bin local
+		$(pwd) test x=1 test readonly echo | $(pwd)
+		$(pwd) echo printf local done | | readonly "$1" test &&
+		$(pwd) && awk "$1" done done sed
+	| 'quoted text' $(pwd) "$@" local awk
+		-eu local | grep | 'quoted text' echo "$@" done "$@" ${HOME} export -eu $(pwd)
+"$@" 'quoted text' $(pwd) /usr/bin readonly export -eu printf ${HOME}
+		/usr/bin -eu sed 2>/dev/null /usr/bin done
+	test then x=1 export grep local test "$@" 2>/dev/null
+| ${HOME} 'quoted text'
+sed local export "$@" export
+	--verbose sed readonly --verbose "$@" local awk local
+/usr/bin awk ${HOME} "$@" awk | export | then local
+	readonly "$@" test -eu | done readonly /usr/bin x=1 echo
+	"$@" sed test -eu echo -eu -eu -eu echo | done echo
+x=1 && ${HOME} export --verbose awk
+/usr/bin x=1 readonly | x=1
+	readonly test readonly sed echo
+		sed grep sed cd x=1 --verbose cd -eu "$1" readonly cd 2>/dev/null then
+/usr/bin then echo done --verbose 'quoted text'
+		/usr/bin x=1 printf $(pwd)
+readonly sed done /usr/bin $(pwd) && 'quoted text' test
+	&& 'quoted text' | | local ${HOME}
+	then export -eu grep | -eu x=1 sed printf
+		x=1 printf printf /usr/bin 2>/dev/null test /usr/bin --verbose export readonly
+		${HOME} "$@" cd "$1" 2>/dev/null ${HOME}
+x=1 export echo printf sed printf grep echo echo done /usr/bin sed
+local --verbose awk export | export && cd x=1 -eu done readonly
+printf cd cd echo export 2>/dev/null && | "$1" then awk |
+${HOME} export /usr/bin printf awk awk grep then 'quoted text' "$1" |
+	${HOME} /usr/bin then local echo 2>/dev/null x=1 "$@" cd sed
+"$1" cd grep && "$@" "$@" grep $(pwd) x=1
+readonly cd export export 2>/dev/null ${HOME} -eu 'quoted text'
+	echo "$1" export ${HOME} -eu /usr/bin | cd -eu --verbose
+test x=1 readonly then done ${HOME} 2>/dev/null export x=1 test cd test cd
+		"$1" then readonly grep test 2>/dev/null $(pwd) test local
+done done printf done grep awk --verbose --verbose && awk | local local ${HOME}
+2>/dev/null cd ${HOME} "$1" cd printf echo | ${HOME}
+$(pwd) 2>/dev/null x=1 --verbose -eu && $(pwd) x=1
+done readonly local --verbose x=1 | "$@" test 2>/dev/null && /usr/bin
+	"$@" $(pwd) $(pwd) --verbose local
+done test 'quoted text' readonly ${HOME} cd echo echo grep test 'quoted text'
+	${HOME} /usr/bin x=1 sed x=1 /usr/bin x=1 $(pwd) 2>/dev/null printf
+		"$@" printf "$@" awk $(pwd) done 2>/dev/null
+	| | "$@" 2>/dev/null test --verbose done 'quoted text' ${HOME} && local
+		"$1" echo /usr/bin $(pwd) 'quoted text' done
+	local | echo done test ${HOME} export
+-eu awk test x=1 'quoted text' then
+--verbose "$@" grep 'quoted text' readonly local export printf
+		| "$@" local 2>/dev/null echo grep
+		&& | 'quoted text' $(pwd)
+		"$1" -eu "$1" done then "$1" done then printf 'quoted text' 2>/dev/null then
+		local export 'quoted text' awk | done
+	then && awk export && && awk export && "$1" test $(pwd) "$1" cd && local
+		grep | "$1" /usr/bin -eu /usr/bin export
+		sed awk grep /usr/bin sed awk then "$1" grep
+echo "$@" then export sed && grep local && x=1 awk "$1"
+echo "$1" | cd printf && x=1 local awk local ${HOME} 'quoted text' /usr/bin 'quoted text'
+		--verbose "$@" then ${HOME} test local "$1" 2>/dev/null $(pwd)
+	$(pwd) /usr/bin x=1 done local /usr/bin "$1" test test "$@"
+		printf echo "$@" "$@" export test "$1" && 'quoted text' grep &&
+test --verbose /usr/bin ${HOME} 2>/dev/null
+| 2>/dev/null "$1" x=1 printf then awk sed 'quoted text'
+		test -eu ${HOME} echo printf /usr/bin test -eu "$1" --verbose sed |
+		-eu awk readonly export sed | | done awk awk then x=1 then "$1" ${HOME} done printf
+"$@" | cd 'quoted text' "$@" 'quoted text' 2>/dev/null sed awk printf then
+	cd -eu sed /usr/bin awk $(pwd) /usr/bin && test grep 'quoted text' printf 2>/dev/null
+"$1" /usr/bin awk awk then "$@" cd printf echo done && /usr/bin ${HOME}
+2>/dev/null sed "$1" test /usr/bin export sed test /usr/bin echo x=1 then local
+		2>/dev/null x=1 'quoted text' 2>/dev/null ${HOME}
+		test "$@" x=1 cd "$1"
+		echo 2>/dev/null "$@" "$@"
+	test printf done grep 2>/dev/null echo export --verbose
+		/usr/bin printf done sed $(pwd) then test -eu && "$@" ${HOME} awk x=1
+		done printf printf $(pwd) echo export ${HOME} export printf test "$1" done
+"$1" local ${HOME} && && readonly
+	$(pwd) 'quoted text' export 2>/dev/null
+		&& grep "$1" | "$@" sed export 2>/dev/null readonly --verbose grep then
+	/usr/bin cd | readonly $(pwd) test "$1" done awk awk && sed "$@"
+x=1 "$@" grep 'quoted text' && "$@" /usr/bin | ${HOME} x=1 $(pwd) $(pwd) test
+		2>/dev/null local $(pwd) "$@" && local then
+printf 2>/dev/null ${HOME} cd $(pwd) "$@" && &&
+done printf x=1 grep 'quoted text' ${HOME} cd test ${HOME} $(pwd)
+$(pwd) "$1" readonly
+2>/dev/null -eu "$@" --verbose
+		${HOME} then /usr/bin 'quoted text'
+		&& cd && 2>/dev/null ${HOME} && "$@" --verbose
+/usr/bin -eu "$@" ${HOME} sed
+then grep x=1 --verbose export --verbose "$@" /usr/bin cd x=1
+then test sed cd "$1" && 2>/dev/null
+	--verbose && grep 'quoted text' awk | $(pwd) local | local sed local local /usr/bin
+done done x=1 test "$1" awk -eu export
+		2>/dev/null -eu x=1 | readonly export export readonly readonly
+		$(pwd) /usr/bin export grep readonly && | $(pwd) ${HOME} "$@"
+	then readonly 2>/dev/null then --verbose 'quoted text'
+		&& 'quoted text' x=1 && test then --verbose --verbose done printf
+done ${HOME} | x=1 /usr/bin sed local "$@" sed export sed -eu $(pwd)
+	--verbose awk then "$@" | && local done $(pwd) echo ${HOME}
+		done readonly export -eu
+	grep grep "$@" local $(pwd) -eu done grep --verbose sed
+		${HOME} --verbose done "$1" grep
+		--verbose --verbose /usr/bin
+		done x=1 then 2>/dev/null 'quoted text' "$@" local
+	--verbose export printf readonly "$1" awk echo
+| echo printf $(pwd) printf awk local | printf export cd awk --verbose test grep
+	done printf then local printf --verbose printf
+	${HOME} printf "$1" $(pwd) --verbose /usr/bin readonly $(pwd)
+	$(pwd) readonly done test then 2>/dev/null
+		| --verbose "$@" echo | -eu "$@" local local readonly
+${HOME} printf echo test "$@" printf ${HOME}
+	sed x=1 sed cd | cd -eu echo | -eu done printf
+test 'quoted text' echo /usr/bin -eu "$1" readonly &&
+		echo export 2>/dev/null 2>/dev/null "$1" then
+		| /usr/bin done test printf test | $(pwd) done $(pwd) | 2>/dev/null
+		readonly awk /usr/bin $(pwd) then x=1 test x=1
+	local | 2>/dev/null 'quoted text' done then x=1 printf 2>/dev/null
+		${HOME} cd --verbose "$1" | ${HOME}
+	-eu sed echo done test && /usr/bin /usr/bin | x=1 sed test $(pwd) cd -eu
+	awk printf test --verbose local
+--verbose $(pwd) cd local 'quoted text' local && then echo local &&
+2>/dev/null test "$1" readonly --verbose
+		cd "$1" export "$1" $(pwd) 2>/dev/null test cd grep readonly --verbose grep
+	test | export test then && test 2>/dev/null
+	$(pwd) printf cd "$1" | ${HOME} printf printf /usr/bin $(pwd)
+	done export printf awk 'quoted text' cd readonly cd | test cd awk test test
+sed then && "$1" done done 2>/dev/null export | export /usr/bin "$1"
+readonly 'quoted text' ${HOME} /usr/bin sed printf done && cd 2>/dev/null
+	$(pwd) -eu ${HOME} printf cd
+	cd done then 'quoted text' export
+	$(pwd) && test | local 2>/dev/null echo "$1" "$1"
+x=1 | ${HOME} 'quoted text' /usr/bin -eu export
+'quoted text' echo awk x=1 echo then readonly then cd export $(pwd) --verbose
+		test "$@" readonly grep then ${HOME} x=1
+		cd export --verbose export $(pwd)
+		grep export printf sed test &&
+		export -eu awk /usr/bin 2>/dev/null $(pwd) x=1 | grep && export -eu 2>/dev/null
+printf "$1" /usr/bin export local $(pwd) then awk x=1 x=1 --verbose 2>/dev/null
+	done && -eu awk sed && then "$1" $(pwd) awk local export test
+	--verbose export cd $(pwd) readonly && grep $(pwd) local 'quoted text'
+		readonly && ${HOME} printf echo "$@" printf readonly
+		${HOME} "$@" 'quoted text' local
+	&& echo && "$1" export --verbose then
+		awk echo "$1" "$@" export 'quoted text'
+		echo ${HOME} && echo export "$1" grep "$@" cd printf done
+"$@" "$@" ${HOME} 'quoted text' export
+/usr/bin && | cd /usr/bin sed /usr/bin /usr/bin "$1" && 'quoted text'
+/usr/bin /usr/bin x=1 printf "$@" --verbose then export && grep
+sed echo $(pwd) cd test printf -eu | awk sed x=1 test -eu
+		grep 'quoted text' /usr/bin -eu /usr/bin cd 2>/dev/null echo $(pwd)
+		sed done ${HOME} $(pwd) awk awk
+"$1" test test && grep x=1
+readonly 'quoted text' export sed && | local
+	"$1" done cd export -eu cd printf
+--verbose cd then 'quoted text' sed "$1" test sed --verbose
+"$1" cd ${HOME} test ${HOME} /usr/bin 2>/dev/null readonly readonly
+	grep export sed | awk test -eu cd grep 'quoted text' awk
+$(pwd) 'quoted text' done --verbose
+awk -eu done awk then
+	&& x=1 "$@" && printf && export --verbose sed 2>/dev/null $(pwd) then
+then echo grep awk ${HOME} && cd 2>/dev/null then readonly
+		x=1 done "$@" "$@" | ${HOME} awk printf test | 2>/dev/null
+&& -eu echo cd readonly done local /usr/bin sed
+sed | ${HOME} --verbose then 2>/dev/null
+${HOME} "$1" sed awk && 'quoted text'
+		$(pwd) -eu done sed | export local
+then done | then echo echo cd done printf cd "$1" then export --verbose ${HOME}
+	'quoted text' test awk grep "$1" readonly sed "$1" export /usr/bin cd
+x=1 local x=1 ${HOME} sed echo cd printf $(pwd)
+	awk /usr/bin /usr/bin /usr/bin export --verbose
+		readonly cd awk | "$@" local | x=1 2>/dev/null
+		/usr/bin 2>/dev/null && "$@" export sed done /usr/bin printf
+		then "$1" ${HOME} "$1" printf grep export ${HOME} "$1" local x=1 x=1 $(pwd)
+	-eu echo "$1" local then then then /usr/bin /usr/bin && 2>/dev/null
+	"$@" readonly $(pwd) grep | | x=1 2>/dev/null --verbose 2>/dev/null
+	-eu done awk x=1 test awk 2>/dev/null ${HOME} ${HOME} x=1
+		/usr/bin then then grep export /usr/bin grep done && test printf && sed
+		&& $(pwd) export export 'quoted text'
+		"$1" printf "$1" local 2>/dev/null "$@" --verbose $(pwd) sed 'quoted text'
+		awk $(pwd) "$1" echo awk test sed ${HOME} export test test
+	done | sed then && $(pwd) cd export ${HOME} echo && "$1" "$@"
+		readonly printf /usr/bin printf echo --verbose then 'quoted text' 2>/dev/null
+		&& $(pwd) 'quoted text'
+	grep printf 'quoted text' "$@" sed "$@" "$1" readonly $(pwd) local printf
+		echo 'quoted text' -eu local local sed done echo
+then "$@" cd $(pwd) printf export echo
+$(pwd) -eu x=1 "$@" $(pwd) awk done
+done /usr/bin ${HOME} && printf
+done grep done export "$1" /usr/bin
+	/usr/bin 'quoted text' printf -eu grep x=1 local /usr/bin then -eu 2>/dev/null
+'quoted text' cd "$1" && done local "$@" awk --verbose export
+		/usr/bin "$1" local awk -eu $(pwd) -eu --verbose $(pwd) then
+	sed "$1" --verbose $(pwd) 2>/dev/null cd 'quoted text'
+cd test cd 'quoted text' /usr/bin done cd done -eu test "$1" | | echo | test readonly
+	test local then x=1 "$@" --verbose grep ${HOME} test test | then
+x=1 test x=1 printf readonly readonly
+	/usr/bin | then printf --verbose "$@" cd
+		awk /usr/bin local echo then /usr/bin | x=1 && export | -eu "$1" then /usr/bin
+$(pwd) sed /usr/bin done x=1 export "$1" -eu && test echo /usr/bin local
+		readonly 'quoted text' grep 'quoted text'
+	readonly 'quoted text'
+		| && echo "$1" x=1 local done printf done cd -eu /usr/bin
+	2>/dev/null local cd local -eu readonly /usr/bin cd sed -eu export
+		"$@" 'quoted text' ${HOME} | /usr/bin x=1 test test ${HOME} printf cd done
+	2>/dev/null then ${HOME} then x=1 -eu sed grep then printf x=1 | 2>/dev/null
+	| x=1 --verbose 2>/dev/null test readonly && done
+	"$1" /usr/bin $(pwd) --verbose
+	"$1" grep cd echo 'quoted text' then export readonly && ${HOME} $(pwd)
+	2>/dev/null --verbose $(pwd) $(pwd) export x=1 echo && export export printf readonly
+		export && 2>/dev/null /usr/bin /usr/bin /usr/bin done -eu
+		'quoted text' -eu echo ${HOME} /usr/bin
+		export && --verbose "$1" test test --verbose echo
+export --verbose 'quoted text' grep ${HOME} grep && ${HOME} 'quoted text'
+		sed "$@" cd $(pwd) 'quoted text' "$1" && 'quoted text' then ${HOME} --verbose 2>/dev/null
+		done --verbose awk cd | 2>/dev/null $(pwd) local printf
+"$@" local && grep cd echo "$@" | awk printf
+	x=1 done awk /usr/bin readonly
+		2>/dev/null 'quoted text' | done sed -eu --verbose grep 'quoted text'
+	export local 'quoted text' export cd 'quoted text' /usr/bin "$1" 'quoted text'
+	export --verbose awk | test
+		"$@" /usr/bin grep "$1" 2>/dev/null x=1 "$1" grep
+		export --verbose awk printf "$1" awk
+	readonly x=1 ${HOME} readonly
+	export done awk "$@" export -eu then "$1"
+		test printf $(pwd) -eu cd 'quoted text' sed
+	-eu export readonly 'quoted text' -eu done done -eu x=1 echo sed && local
+readonly 'quoted text' 2>/dev/null
+		printf test local awk | ${HOME} done
+	--verbose x=1 'quoted text' /usr/bin then test cd sed awk echo
+--verbose then test sed "$1" "$1" | --verbose x=1
+	cd local readonly "$@" done | "$1" test -eu
+printf && && readonly "$@" echo local echo cd readonly done --verbose
+	sed test echo "$1" done /usr/bin test
+	-eu done grep x=1 && grep -eu 'quoted text' "$1" | 'quoted text' awk export echo
+	then printf 'quoted text'
+2>/dev/null then grep local sed echo ${HOME} awk local x=1 local -eu
+		test -eu sed cd then -eu "$@" "$1" done | $(pwd) --verbose 2>/dev/null
+	"$@" grep awk awk awk -eu awk
+/usr/bin readonly "$1" "$@" done printf
+	sed cd local test "$1" local
+	grep x=1 2>/dev/null 'quoted text' local -eu grep awk sed
+	&& ${HOME} cd local --verbose sed then
+	readonly cd x=1 then /usr/bin then cd sed $(pwd)
+		then then "$1" /usr/bin
+printf export && sed ${HOME} printf test export
+2>/dev/null x=1 grep local sed /usr/bin "$1" echo
+readonly "$@" local awk test /usr/bin "$@" echo
+	/usr/bin sed test grep x=1 test "$1" "$@"
+		| | local "$1" cd local && 'quoted text' -eu awk done $(pwd) local sed sed
+		awk then --verbose "$1" 'quoted text' --verbose cd $(pwd) | then /usr/bin
+	awk "$@" $(pwd) && "$@" | ${HOME} x=1 'quoted text'
+	printf grep | $(pwd) "$@"
+	x=1 local sed done ${HOME} printf echo ${HOME} grep $(pwd) &&
+		printf test then --verbose readonly readonly 'quoted text' printf
+	2>/dev/null awk grep | 'quoted text' awk $(pwd) --verbose 2>/dev/null "$@"
+		${HOME} export readonly
+| --verbose echo 'quoted text' export readonly
+printf then echo "$1" grep 2>/dev/null
+	'quoted text' /usr/bin grep
+	${HOME} && ${HOME} | then done printf "$1" /usr/bin
+	done readonly cd export 'quoted text' test cd then grep "$1" printf --verbose
+printf test export echo && test "$@" done -eu then /usr/bin
+		sed $(pwd) x=1 /usr/bin && export sed /usr/bin grep
+		awk | x=1 x=1 -eu 'quoted text' cd test printf
+		&& test "$@" -eu done
+awk local ${HOME} && printf echo -eu 2>/dev/null
+		-eu sed awk cd readonly test && -eu local 2>/dev/null local
+	x=1 ${HOME} "$@" -eu x=1 echo awk "$@" /usr/bin export
+		then "$@" | 2>/dev/null
+-eu 'quoted text' echo x=1 export cd
+		awk | x=1 then awk cd ${HOME} && printf | local 2>/dev/null grep printf
+	echo | 2>/dev/null --verbose /usr/bin
+	cd --verbose done done grep echo 2>/dev/null then && 'quoted text' printf "$1"
+	grep -eu 'quoted text' 'quoted text' 'quoted text' /usr/bin --verbose /usr/bin readonly
+		then "$@" done cd /usr/bin echo done awk $(pwd) "$1"
+	printf awk grep 'quoted text' | "$1" "$1" test 2>/dev/null
+	"$1" -eu | 'quoted text'
+		then export test | then --verbose grep grep && then cd awk &&
+	grep done "$@" "$1" x=1 local sed grep export test "$1" $(pwd) 'quoted text'
+		awk then /usr/bin -eu local "$@" local awk "$1" awk /usr/bin
+	$(pwd) x=1 && printf 2>/dev/null
+	cd 2>/dev/null x=1 export 2>/dev/null | readonly
+$(pwd) readonly printf printf 'quoted text' cd
+	'quoted text' 'quoted text' done
+	"$1" -eu printf "$1" printf && export export "$@" && /usr/bin "$@"
+awk cd 2>/dev/null printf
+	test done awk -eu | ${HOME} readonly "$@" done -eu sed test | -eu sed
+		done printf grep && ${HOME} readonly && "$@"
+		test cd $(pwd) readonly cd local && "$1" grep
+then "$@" sed && awk echo awk
+		"$@" && $(pwd) echo --verbose "$@" /usr/bin
+	test ${HOME} done sed awk cd 2>/dev/null ${HOME} sed
+	"$@" | x=1 "$1" /usr/bin cd printf cd export
+	printf x=1 x=1 export | readonly
+'quoted text' readonly | 2>/dev/null 'quoted text' ${HOME} readonly export test
+	export "$1" $(pwd) /usr/bin cd done 2>/dev/null sed 2>/dev/null printf
+then x=1 cd --verbose export export done /usr/bin
+${HOME} --verbose && cd done export "$1" 2>/dev/null printf readonly printf
+then local then && && "$1" done /usr/bin $(pwd) sed
+	test 'quoted text' && printf grep done
+$(pwd) printf done "$1" --verbose | "$@" awk export
+export grep then done export -eu then done "$@" --verbose 'quoted text'
+echo sed local cd "$@" ${HOME} awk | "$1" printf
+		printf echo "$@" $(pwd) $(pwd) test readonly printf "$@" test x=1 grep
+		'quoted text' | done export -eu $(pwd) --verbose sed $(pwd) export awk |
+	sed cd "$@" && --verbose grep readonly --verbose ${HOME} "$1" 'quoted text'
+		test awk 2>/dev/null ${HOME} $(pwd) && $(pwd) ${HOME} ${HOME}
+&& done --verbose cd 2>/dev/null ${HOME} then ${HOME}
+	readonly $(pwd) grep -eu $(pwd) cd | local done sed
+		| "$@" x=1 --verbose 'quoted text' x=1 sed
+/usr/bin 2>/dev/null done
+		grep done 2>/dev/null local
+		done printf export echo echo awk --verbose
+$(pwd) /usr/bin && "$@" "$1" | test awk local test
+	x=1 "$@" grep | grep grep done grep
+		done ${HOME} grep awk export
+		readonly printf "$@" printf 2>/dev/null export $(pwd)
+	| awk $(pwd) /usr/bin local && $(pwd) local printf local x=1 x=1 awk echo export
+		export grep 'quoted text'
+	sed "$1" test sed export done cd ${HOME}
+		${HOME} --verbose cd $(pwd) grep readonly --verbose
+	${HOME} cd 2>/dev/null sed echo sed | 2>/dev/null
+readonly printf readonly
+		x=1 echo --verbose -eu 2>/dev/null then /usr/bin | 'quoted text' cd | ${HOME} &&
+x=1 test 2>/dev/null ${HOME}
+	grep --verbose sed awk "$@" test x=1 "$1" sed printf ${HOME} echo | /usr/bin
+		--verbose "$@" local && then awk echo
+		grep sed grep export -eu $(pwd) printf grep ${HOME}
+printf $(pwd) && 'quoted text' | "$1" local | then sed | then ${HOME}
+"$@" then "$@" done x=1
+		readonly local awk export local readonly awk local export ${HOME} test local
+	awk ${HOME} readonly "$1" "$@" sed --verbose /usr/bin local grep then
+	cd local done cd -eu 'quoted text'
+	"$1" -eu export --verbose | -eu -eu
+		$(pwd) readonly && awk
+2>/dev/null x=1 done awk
+	test "$1" done sed /usr/bin echo | | local "$@" x=1
+	cd sed $(pwd) "$@" done -eu 2>/dev/null
+	/usr/bin "$@" cd && ${HOME} cd grep -eu "$@" x=1 grep grep export cd export
+		local /usr/bin 'quoted text' "$1" 2>/dev/null
+&& "$1" /usr/bin ${HOME} "$1" cd done
+		cd awk local x=1 cd then | grep grep 2>/dev/null
+readonly 2>/dev/null local && "$@" "$@" sed ${HOME}
+		-eu echo /usr/bin then then x=1 --verbose grep done 'quoted text' printf
+	${HOME} && $(pwd) sed cd awk then cd $(pwd) awk local && 2>/dev/null "$1" awk
+		x=1 sed | && echo echo && --verbose then -eu x=1 echo sed -eu grep done echo
+	/usr/bin readonly echo "$@" awk x=1 x=1
+		x=1 'quoted text' test --verbose --verbose
+		grep "$@" --verbose "$1" /usr/bin export /usr/bin then 2>/dev/null
+		export 2>/dev/null local local | ${HOME} then x=1 printf -eu
+		local done local x=1 local 2>/dev/null
+2>/dev/null printf -eu -eu 'quoted text'
+		--verbose readonly echo x=1 /usr/bin x=1 --verbose done --verbose test
+local 'quoted text' export "$1" echo "$@" then done
+	test && /usr/bin then test cd awk sed "$@"
+		grep sed grep ${HOME} $(pwd) readonly "$@"
+		| /usr/bin | -eu awk echo "$1" test
+	$(pwd) then && export cd echo readonly readonly 2>/dev/null
+printf local $(pwd) --verbose done
+		"$1" 'quoted text' 2>/dev/null "$1"
+	done $(pwd) x=1 then cd 'quoted text' readonly 2>/dev/null ${HOME} /usr/bin
+grep echo grep test $(pwd) --verbose "$1"
+	test x=1 local sed readonly test test export "$1" /usr/bin local
+	/usr/bin "$1" sed test export local -eu awk "$1"
+$(pwd) 2>/dev/null echo "$@" 2>/dev/null 'quoted text'
+	${HOME} $(pwd) echo export test printf -eu $(pwd) -eu readonly export grep
+	done $(pwd) /usr/bin done
+&& 'quoted text' printf
+	-eu /usr/bin $(pwd) "$@" "$1" 2>/dev/null done $(pwd)
+${HOME} "$@" | local sed --verbose grep grep export 'quoted text'
+	"$1" $(pwd) -eu readonly -eu test $(pwd) -eu 'quoted text' ${HOME} readonly
+		"$1" "$@" echo --verbose ${HOME} x=1 printf "$1" printf --verbose
+$(pwd) -eu awk && 2>/dev/null
+		echo export then sed /usr/bin readonly done sed 'quoted text' $(pwd) grep
+		"$1" "$1" export --verbose then cd /usr/bin
+		$(pwd) 'quoted text' /usr/bin then awk sed cd && echo "$1"
+${HOME} x=1 | --verbose -eu grep echo local /usr/bin && -eu
+-eu 'quoted text' printf printf sed "$1" "$1" test readonly grep
+'quoted text' then test export done "$@"
+		"$1" then "$@" grep export grep awk 'quoted text' /usr/bin done printf grep /usr/bin
+2>/dev/null && && /usr/bin
+	$(pwd) done printf ${HOME}
+	2>/dev/null sed readonly 2>/dev/null
+		awk /usr/bin 'quoted text' ${HOME} readonly 2>/dev/null
+		grep then then grep readonly readonly -eu printf printf grep cd
+	awk export sed test 'quoted text'
+&& -eu --verbose readonly 2>/dev/null && echo x=1 grep local local
+	then sed 'quoted text' 2>/dev/null --verbose "$@" | done echo
+		| | && /usr/bin x=1 readonly cd "$1" printf sed local "$@" local
+	export "$@" then awk $(pwd) awk --verbose 'quoted text'
+		-eu -eu && x=1 done grep && "$1" | "$@" readonly printf test cd x=1 readonly
+		printf && awk "$@" /usr/bin
+	"$1" cd printf | printf printf
+	printf grep echo sed "$@" -eu
+	sed $(pwd) $(pwd) | awk -eu | -eu /usr/bin "$1" export "$1"
+	sed then ${HOME} sed awk local printf $(pwd) | export then done readonly echo
+&& && sed 2>/dev/null 2>/dev/null echo 'quoted text' grep echo
+	2>/dev/null awk grep -eu local
+		&& cd export done readonly | | 'quoted text' readonly
+		'quoted text' "$1" --verbose local grep --verbose
+		x=1 $(pwd) && 2>/dev/null sed then then local --verbose -eu "$1"
+		readonly cd printf | "$1" grep cd && test echo grep test sed then awk awk
+	--verbose && awk && --verbose | $(pwd) sed "$1" done | done && test done 2>/dev/null
+	${HOME} && --verbose export done
+2>/dev/null awk readonly sed "$@" awk | /usr/bin export
+		$(pwd) local $(pwd) local done echo export test "$1" ${HOME} 'quoted text'
+		"$@" readonly export 2>/dev/null
+		-eu "$@" echo 'quoted text' "$1" awk /usr/bin sed sed 'quoted text'
+	--verbose "$@" && 2>/dev/null local --verbose
+printf /usr/bin grep && 2>/dev/null grep test
+		echo | local printf && done awk done "$@" sed && /usr/bin readonly
+	printf x=1 $(pwd) sed readonly then x=1 --verbose
+	"$@" echo /usr/bin -eu /usr/bin done local
+-eu local "$1" | done 'quoted text'
+		'quoted text' x=1 grep | sed /usr/bin
+		grep | "$@" 'quoted text' && "$@" printf export cd local test
+	test ${HOME} "$@" echo
+		sed | $(pwd) then 2>/dev/null "$@" "$1" /usr/bin readonly -eu cd
+--verbose && "$1" | /usr/bin
+		export -eu grep test sed grep readonly -eu sed cd cd "$1" | x=1 done 2>/dev/null
+		| then && test /usr/bin done x=1 test 2>/dev/null ${HOME} "$1" /usr/bin 'quoted text'
+2>/dev/null "$@" done ${HOME} ${HOME} "$@" "$@" $(pwd)
+/usr/bin | -eu && 'quoted text' 2>/dev/null
+echo then export sed "$1" then test "$@" x=1 test cd 'quoted text'
+awk ${HOME} export "$1" | local export local "$1" readonly $(pwd) grep
+		${HOME} 'quoted text' -eu local "$1" && 2>/dev/null | export x=1 x=1 export /usr/bin
+"$1" "$1" "$@" "$1" ${HOME} readonly ${HOME} ${HOME} x=1 -eu
+		2>/dev/null 2>/dev/null "$1" grep readonly /usr/bin
+	x=1 "$@" sed /usr/bin readonly grep -eu
+		cd "$@" | 2>/dev/null then
+	done grep local test local readonly && "$@" x=1 ${HOME} && sed
+	then sed -eu $(pwd) "$1" test --verbose
+	test test test /usr/bin local $(pwd) readonly then printf
+	printf "$1" "$@" readonly export printf done echo $(pwd) printf ${HOME} then cd
+	grep readonly export "$@" readonly
+	echo sed printf done sed 'quoted text'
+--verbose echo "$1" -eu | 'quoted text' | done printf sed | --verbose
+"$@" x=1 --verbose then cd cd sed test done -eu readonly $(pwd)
+awk export "$1" 'quoted text'
+"$@" "$@" --verbose $(pwd) | cd readonly 2>/dev/null
+	sed test "$@" printf $(pwd) 'quoted text' --verbose --verbose | grep test
+	cd 2>/dev/null --verbose | printf 2>/dev/null
+"$@" done 2>/dev/null /usr/bin grep local printf 2>/dev/null printf
+	| local 2>/dev/null --verbose grep x=1 local test $(pwd) grep cd cd then
+grep grep local then ${HOME} $(pwd) $(pwd) local "$1"
+--verbose readonly grep grep 'quoted text'
+printf export -eu then readonly 'quoted text'
+local && printf done
+		readonly 'quoted text' printf && readonly echo awk --verbose /usr/bin
+	done 2>/dev/null awk done x=1 "$1" $(pwd) 'quoted text'
+then done "$1" local 'quoted text' readonly "$1" then echo test | awk then local
+		readonly "$1" 2>/dev/null cd test cd echo $(pwd) -eu
+	done echo done done -eu done export done readonly then sed grep sed then ${HOME}
+-eu readonly test x=1 "$1" 'quoted text' printf printf /usr/bin
+	'quoted text' printf -eu readonly --verbose --verbose readonly grep
+--verbose x=1 $(pwd) printf readonly test echo done sed x=1 then
+		"$@" 2>/dev/null grep cd readonly readonly local /usr/bin && grep
+	&& done | test then readonly local awk 'quoted text'
+		grep x=1 test -eu x=1 'quoted text'
+		awk && sed x=1 then printf ${HOME} done --verbose cd awk grep grep
+		x=1 --verbose export x=1 echo 'quoted text' awk sed then && then sed local $(pwd)
+local && ${HOME} -eu 2>/dev/null 'quoted text' x=1
+"$@" readonly | --verbose
+echo readonly "$@" cd test test --verbose --verbose -eu ${HOME} echo sed "$@"
+printf grep cd | | done | 2>/dev/null
+x=1 $(pwd) && $(pwd) 'quoted text' $(pwd) ${HOME}
+		grep awk -eu $(pwd) local echo "$1" 'quoted text' test done readonly
+	cd | test $(pwd) $(pwd) "$@" /usr/bin done echo "$@" printf
+		then 2>/dev/null ${HOME} cd | readonly /usr/bin readonly printf x=1
+sed done -eu readonly /usr/bin local awk | readonly local | 'quoted text'
+		printf test awk ${HOME} local
+		$(pwd) /usr/bin then 'quoted text' ${HOME} -eu cd && 'quoted text' printf
+		2>/dev/null "$@" -eu | readonly sed
+-eu done sed 'quoted text' sed x=1 -eu ${HOME} -eu ${HOME} 2>/dev/null export
+readonly then local done printf
+2>/dev/null export x=1 local echo readonly local
+test "$1" awk test awk ${HOME} -eu && "$@" | ${HOME} echo $(pwd)
+done local && done readonly x=1 $(pwd) printf echo done
+		${HOME} test echo 'quoted text' x=1 done -eu $(pwd) ${HOME}
+		test --verbose readonly x=1
+cd sed "$1" | 'quoted text' test awk printf export printf readonly "$@"
+awk then sed -eu echo | && /usr/bin --verbose printf export test done
+	--verbose && test "$@" awk x=1 grep | sed 'quoted text'
+-eu && test $(pwd) | /usr/bin 'quoted text'
+		then 2>/dev/null export /usr/bin --verbose && 2>/dev/null --verbose
+	/usr/bin export 2>/dev/null echo printf export
+		'quoted text' 2>/dev/null 'quoted text' | | $(pwd) readonly "$1"
+		/usr/bin ${HOME} ${HOME} && ${HOME} cd --verbose awk printf grep $(pwd) grep then
+		-eu | awk echo printf export && ${HOME} "$1" --verbose "$@" echo cd && done
+	--verbose | "$1" cd $(pwd) -eu cd test export --verbose cd
+	sed readonly "$1" echo
+	| cd then -eu cd grep test -eu /usr/bin "$@" printf done x=1 grep local
+		sed done -eu && test "$1" local printf printf
+export 'quoted text' local
+/usr/bin x=1 grep x=1 'quoted text' test 'quoted text' cd export /usr/bin
+	--verbose echo cd 'quoted text' cd sed sed 2>/dev/null
+	test $(pwd) export test x=1 readonly 'quoted text' test --verbose
+		&& test echo "$1" cd --verbose 'quoted text' --verbose printf
+local -eu local printf && readonly "$@" --verbose
+		sed export /usr/bin local -eu "$@" 'quoted text' done test x=1 echo && ${HOME}
+	--verbose done -eu echo "$@" ${HOME}
+&& done ${HOME} then done then x=1 then
+	| test --verbose "$@" $(pwd) echo
+'quoted text' test done --verbose local && && local
+		$(pwd) done sed done test test x=1 done echo grep sed test
+		test 2>/dev/null grep
+		local "$@" awk local -eu -eu printf | 'quoted text' "$@" grep
+	$(pwd) | local local readonly printf x=1 cd cd && grep 'quoted text' -eu echo
+	$(pwd) done -eu x=1 cd echo 'quoted text' x=1 -eu 'quoted text'
+	$(pwd) cd 'quoted text' && cd sed cd test 'quoted text'
+	then local | echo && 'quoted text' --verbose && &&
+printf "$@" done local | echo printf sed &&
+readonly grep test awk /usr/bin awk grep awk test cd local ${HOME} | then
+&& readonly "$1" local export test export $(pwd)
+cd 'quoted text' | | printf readonly
+		"$1" local test "$@" cd grep cd x=1 cd && printf then -eu cd 'quoted text'
+	-eu readonly local cd local -eu then then && $(pwd) done
+local -eu cd "$@" -eu x=1 -eu printf --verbose
+		sed sed --verbose export local echo then 'quoted text'
+	then x=1 cd sed grep sed x=1 echo x=1 cd
+		done awk "$1" 2>/dev/null export awk -eu sed readonly
+local echo && x=1 done $(pwd) "$1" | local
+		-eu cd ${HOME} 2>/dev/null printf cd &&
+	&& sed echo then ${HOME} ${HOME} "$1" /usr/bin 'quoted text' sed done 'quoted text'
+	| test -eu x=1 awk --verbose
+grep x=1 "$1" x=1 x=1 $(pwd) export test --verbose
+	local $(pwd) echo 'quoted text'
+		2>/dev/null cd echo done sed export
+		export "$1" --verbose readonly -eu x=1 ${HOME}
+test 2>/dev/null /usr/bin /usr/bin "$1" /usr/bin printf
+		-eu "$@" local readonly echo printf "$@"
+		&& awk 'quoted text' -eu "$1" -eu
+	${HOME} $(pwd) echo && then | "$@" echo "$1"
+	local --verbose 2>/dev/null local sed then && local
+	export "$@" done echo cd && --verbose readonly -eu /usr/bin
+export /usr/bin /usr/bin
+x=1 x=1 /usr/bin then 2>/dev/null
+	| --verbose sed -eu echo sed sed cd 'quoted text' "$@" readonly "$1"
+		--verbose awk cd ${HOME} awk
+local | --verbose | echo /usr/bin
+${HOME} readonly "$@" ${HOME} echo test x=1
+	"$@" done --verbose export -eu test 2>/dev/null
+sed 2>/dev/null then sed awk
+		done grep sed then echo &&
+		done 'quoted text' awk -eu 'quoted text' readonly /usr/bin "$@" "$@" "$@"
+	| echo export export && 2>/dev/null done | then readonly
+	'quoted text' 2>/dev/null 2>/dev/null grep local printf | x=1 test ${HOME} local
+readonly grep 'quoted text' x=1 done
+		grep sed readonly done |
+	done then -eu readonly grep grep readonly x=1 awk done
+cd printf sed 2>/dev/null $(pwd) 'quoted text'
+		then grep awk "$1" x=1 then sed export
+2>/dev/null /usr/bin 2>/dev/null $(pwd) local
+	&& /usr/bin test /usr/bin
+cd test grep export sed --verbose
+	export && grep x=1 /usr/bin sed then && /usr/bin ${HOME} $(pwd) readonly
+	2>/dev/null done cd awk local && grep x=1 local grep | grep test local /usr/bin
+		test "$1" awk cd /usr/bin | | --verbose printf grep readonly ${HOME}
+local cd "$@" readonly | --verbose echo grep 'quoted text'
+	done readonly && $(pwd) awk local
+then | then --verbose done
+	awk $(pwd) test $(pwd) cd test readonly -eu awk -eu local 2>/dev/null sed
+		| awk x=1 cd x=1 printf
+readonly echo local printf awk /usr/bin echo $(pwd) "$1" sed | -eu grep
+		sed $(pwd) $(pwd) printf then export $(pwd) ${HOME} local "$@"
+	export 'quoted text' local echo test cd x=1 test awk then cd
+		export test cd test readonly && readonly local cd $(pwd) printf -eu && --verbose
+		"$1" echo done grep cd x=1 echo printf done 2>/dev/null | readonly local
+'quoted text' $(pwd) $(pwd) readonly $(pwd) --verbose
+awk readonly echo "$1" printf local && printf "$1" local -eu "$1" "$@" test --verbose
+		2>/dev/null -eu export 2>/dev/null
+	printf cd export grep
+		-eu x=1 "$@" "$1" x=1 done local then
+	echo -eu 2>/dev/null printf ${HOME} awk
+x=1 printf /usr/bin 2>/dev/null local grep cd 'quoted text' "$@" $(pwd)
+		test "$1" export $(pwd) local echo export
+echo "$1" awk printf sed /usr/bin local ${HOME}
+cd awk export then export -eu "$1" 'quoted text'
+		printf 2>/dev/null x=1 sed "$@" sed then awk sed $(pwd) x=1 readonly
+	cd /usr/bin x=1 --verbose echo 'quoted text' && printf
+	readonly readonly echo --verbose awk done cd grep 2>/dev/null
+		${HOME} "$1" echo done export local awk "$1" test 2>/dev/null
+printf then ${HOME} -eu readonly | -eu echo $(pwd) echo x=1 echo -eu 'quoted text'
+	&& --verbose local sed done "$1" printf | $(pwd) test then "$1" $(pwd)
+&& done | $(pwd) ${HOME} "$@" "$1" sed echo 'quoted text'
+	then awk | $(pwd) -eu | | sed readonly --verbose
+	x=1 ${HOME} local test echo then "$@" /usr/bin $(pwd) readonly
+	$(pwd) awk /usr/bin readonly 2>/dev/null done x=1 x=1
+| cd 2>/dev/null sed && grep
+export 'quoted text' test -eu echo -eu &&
+	"$@" ${HOME} test awk --verbose cd printf grep "$@" export 'quoted text'
+	2>/dev/null && awk "$@" "$@" /usr/bin printf "$@" local readonly /usr/bin &&
+		echo "$@" test grep ${HOME} | printf 2>/dev/null -eu then x=1 | "$1"
+		export x=1 test 'quoted text' awk local done 2>/dev/null
+	then grep export "$1" done --verbose 2>/dev/null && | test sed then | "$@" -eu
+		'quoted text' grep printf /usr/bin "$1" 'quoted text'
+printf cd ${HOME} readonly /usr/bin then readonly 'quoted text'
+| local "$1" grep -eu && ${HOME} --verbose grep 2>/dev/null -eu
+'quoted text' readonly sed --verbose 2>/dev/null then readonly
+	&& 'quoted text' ${HOME} --verbose cd --verbose then awk local "$@" x=1 local
+		x=1 awk done $(pwd) then then then grep ${HOME} readonly cd
+cd export ${HOME} echo test $(pwd) --verbose 2>/dev/null cd 'quoted text'
+2>/dev/null | printf grep 'quoted text' readonly "$1" grep "$@" cd x=1 && /usr/bin
+	sed test 'quoted text' then then local 'quoted text' --verbose |
+		x=1 "$@" test "$1" test ${HOME} 'quoted text' /usr/bin local | /usr/bin
+	| echo "$@" local readonly
+		sed ${HOME} echo -eu printf printf done 'quoted text' cd awk cd printf "$@" ${HOME}
+		"$1" cd cd ${HOME} awk
+	| 2>/dev/null done cd $(pwd) then && local x=1 printf /usr/bin
+$(pwd) printf export ${HOME} awk export then 2>/dev/null
+--verbose x=1 local 'quoted text' then /usr/bin printf x=1 then
+		awk sed "$@" cd /usr/bin 2>/dev/null x=1 "$1" sed
+test 2>/dev/null | x=1 /usr/bin done
+		then awk ${HOME} done "$1" awk printf export ${HOME} $(pwd)
+		"$1" readonly 2>/dev/null grep
+printf --verbose sed 2>/dev/null then printf echo test && /usr/bin
+		2>/dev/null cd /usr/bin export
+		$(pwd) && readonly ${HOME} grep
+	&& awk then 2>/dev/null | sed && awk
+	done && "$1" ${HOME} then 2>/dev/null 'quoted text' done export "$@" done
+	printf test done 2>/dev/null $(pwd) test x=1 $(pwd) then -eu sed then sed /usr/bin
+	export -eu then printf test test /usr/bin
+		echo 'quoted text' | x=1 --verbose local x=1 export "$@"
+		grep 'quoted text' cd grep printf test | -eu test echo grep 'quoted text'
+		2>/dev/null sed readonly 2>/dev/null
+		local | cd then | /usr/bin then "$1" done printf x=1 "$1" "$@" awk done
+"$1" printf | sed sed 'quoted text' ${HOME} 2>/dev/null 'quoted text'
+echo test x=1 "$1" awk
+	test grep done then /usr/bin
+${HOME} /usr/bin cd | echo "$1" 2>/dev/null export test ${HOME} export
+		/usr/bin "$@" local printf
+		&& -eu -eu echo export ${HOME} "$@" echo echo /usr/bin ${HOME} 'quoted text'
+		printf x=1 | local 'quoted text'
+printf export 'quoted text' 2>/dev/null
+		/usr/bin done -eu test printf export cd | readonly 2>/dev/null "$@" 'quoted text'
+test cd readonly local /usr/bin local export export export
+&& -eu test echo $(pwd) awk sed /usr/bin "$@" && /usr/bin local
+		/usr/bin $(pwd) x=1 sed sed test export
+	"$@" test --verbose && printf ${HOME} 'quoted text'
+		2>/dev/null /usr/bin done | printf
+		/usr/bin 2>/dev/null printf /usr/bin 2>/dev/null
+done cd 'quoted text' /usr/bin cd 2>/dev/null printf echo
+		then cd /usr/bin then --verbose cd "$1" x=1
+$(pwd) | $(pwd) readonly --verbose x=1 /usr/bin
+		done 2>/dev/null local "$1" /usr/bin
+		${HOME} | local -eu grep | done x=1 awk | export
+	readonly export 2>/dev/null readonly printf x=1 readonly grep
+	then grep grep grep -eu && echo && && sed export && readonly
+| then -eu local 2>/dev/null then echo local awk | cd -eu then export
+	readonly sed "$@" cd readonly grep then test readonly ${HOME} export test
+local awk ${HOME} done test -eu then then export |
+${HOME} local sed "$@" x=1 then local -eu && ${HOME} && readonly
+awk 2>/dev/null | 'quoted text' --verbose awk readonly awk done echo $(pwd) local
+		/usr/bin $(pwd) 2>/dev/null
+	echo x=1 grep cd cd "$1" cd then --verbose $(pwd) /usr/bin readonly
+	local grep printf -eu printf | awk /usr/bin grep /usr/bin
+	x=1 2>/dev/null 2>/dev/null awk $(pwd) "$@" && && readonly && "$@" test -eu
+$(pwd) /usr/bin sed done 'quoted text'
+		export then test --verbose -eu
+		local && && sed x=1 echo
+x=1 x=1 readonly done grep cd sed readonly
+/usr/bin local grep | $(pwd) 2>/dev/null printf readonly
+awk echo cd 'quoted text' /usr/bin | test local test --verbose grep
+sed awk readonly done && /usr/bin local
+cd printf then | 2>/dev/null test 'quoted text' $(pwd)
+	awk "$@" done ${HOME} "$1" echo
+test done grep test x=1 && -eu 2>/dev/null readonly
+	sed 2>/dev/null 2>/dev/null && x=1 2>/dev/null done printf
+		--verbose readonly -eu sed x=1 -eu sed 'quoted text' done
+echo | -eu awk x=1 test export
+${HOME} 'quoted text' |
+		${HOME} test printf readonly /usr/bin done awk printf
+	"$@" 2>/dev/null printf export grep x=1 /usr/bin readonly 2>/dev/null
+"$1" --verbose test cd ${HOME} && then && sed echo readonly
+		${HOME} 'quoted text' $(pwd) printf "$@" export 2>/dev/null
+		export $(pwd) 'quoted text' echo
+awk done local done "$1" -eu
+	${HOME} 2>/dev/null | test "$1" 'quoted text' /usr/bin awk ${HOME}
+	local local --verbose done printf 'quoted text' grep export printf "$1"
+	readonly export echo sed && | then
+done 'quoted text' sed done /usr/bin 2>/dev/null 2>/dev/null ${HOME} 2>/dev/null
+		| "$1" "$@" x=1 "$@" done ${HOME} ${HOME} "$1" printf test
+		cd awk sed && local export readonly printf ${HOME}
+x=1 "$1" /usr/bin $(pwd) echo |
+		2>/dev/null 'quoted text' $(pwd) $(pwd) --verbose -eu "$@" cd | x=1
+echo 'quoted text' "$1" echo export export $(pwd) awk readonly
+	"$1" awk $(pwd) 'quoted text' ${HOME} --verbose
+	awk $(pwd) grep $(pwd) grep 'quoted text' 2>/dev/null
+		/usr/bin 2>/dev/null "$@" cd done x=1 "$1" | local /usr/bin "$@" echo test
+test awk "$@" printf sed cd | -eu x=1 sed --verbose $(pwd) done --verbose
+		done export sed --verbose readonly readonly awk awk awk local x=1 $(pwd) /usr/bin
+	| | then 'quoted text' | "$@" --verbose 'quoted text' done
+		printf printf export x=1 "$1" then
+		sed sed ${HOME} echo awk ${HOME}
+${HOME} then export local 2>/dev/null
+	sed && cd test sed test "$@" "$@"
+export test awk $(pwd) "$@" local local
+$(pwd) && echo 2>/dev/null sed && awk printf sed
+		2>/dev/null export "$@" test printf readonly echo --verbose then /usr/bin
+	awk -eu then done -eu cd --verbose "$@" cd export cd awk x=1 readonly grep
+then $(pwd) sed printf echo export readonly 'quoted text' local
+	/usr/bin x=1 local 2>/dev/null && "$@" x=1 "$1" 2>/dev/null
+		awk 2>/dev/null x=1 echo /usr/bin readonly
+then test x=1 done --verbose cd awk -eu "$@" then "$@" $(pwd) readonly
+done && "$1" "$@" /usr/bin cd -eu export cd "$1" /usr/bin test
+		--verbose then then awk then
+	"$@" sed x=1 echo 'quoted text'
+	| /usr/bin $(pwd) && grep grep then "$@" export grep readonly --verbose
+echo cd done -eu grep | printf /usr/bin sed 2>/dev/null "$1" x=1 'quoted text'
+	--verbose grep export
+	$(pwd) readonly done --verbose /usr/bin x=1 x=1
+		cd -eu test test $(pwd) printf sed then --verbose "$1"
+printf ${HOME} awk && then && /usr/bin then 2>/dev/null
+export --verbose x=1 test cd "$@" 2>/dev/null
+'quoted text' $(pwd) printf echo local --verbose
+	local grep "$1" -eu 2>/dev/null
+/usr/bin | grep local && local && awk readonly
+		"$1" | && readonly test --verbose 'quoted text' x=1 cd
+		2>/dev/null x=1 cd cd "$1" done readonly ${HOME} cd | /usr/bin done &&
+		2>/dev/null echo echo 2>/dev/null | 2>/dev/null "$1" echo
+/usr/bin "$1" 2>/dev/null grep then awk then x=1 /usr/bin --verbose && grep
+		'quoted text' awk done $(pwd) grep 'quoted text'
+		/usr/bin $(pwd) cd "$@"
+	export -eu done awk export grep echo echo && "$1" "$1" 'quoted text' 2>/dev/null
+	then $(pwd) readonly readonly
+echo cd export ${HOME} "$@" "$1" echo "$1" readonly -eu -eu -eu local 'quoted text'
+done ${HOME} awk printf cd sed "$1" grep awk readonly
+		sed "$@" awk /usr/bin --verbose "$1" echo 'quoted text' done $(pwd) done printf
+		echo | test cd | grep export -eu x=1 /usr/bin -eu "$@" && ${HOME} "$@"
+"$1" | && /usr/bin 'quoted text'
+		-eu awk x=1 cd sed x=1 "$@" echo test /usr/bin test then --verbose readonly done
+		'quoted text' export "$@" && export $(pwd) -eu && printf
+		x=1 printf 2>/dev/null 2>/dev/null echo 2>/dev/null | printf test
+	printf done awk export "$@" readonly
+		readonly readonly awk echo "$1"
+printf export "$@" 2>/dev/null done grep "$@" cd --verbose -eu
+test | then 2>/dev/null grep done 2>/dev/null test export $(pwd) /usr/bin
+local sed 2>/dev/null test
+	2>/dev/null && x=1 ${HOME} awk export
+	sed sed ${HOME} grep printf echo
+	--verbose /usr/bin test done echo "$@" test x=1
+		local then 'quoted text' cd grep export printf
+	${HOME} "$@" 'quoted text' $(pwd) |
+		export cd done x=1 awk cd printf done /usr/bin
+		x=1 $(pwd) 2>/dev/null export grep && | sed test /usr/bin grep && | then /usr/bin
+	grep 'quoted text' echo --verbose sed && local "$1" 2>/dev/null
+	test test ${HOME} $(pwd) 'quoted text' readonly
+	local sed x=1 test test /usr/bin -eu 'quoted text' echo /usr/bin printf
+		x=1 echo $(pwd) /usr/bin grep
+--verbose awk /usr/bin then then test -eu echo test 'quoted text' then
+$(pwd) x=1 --verbose sed -eu grep -eu -eu awk readonly cd
+		printf -eu x=1 $(pwd) 'quoted text' --verbose awk -eu
+	| /usr/bin awk sed $(pwd) local ${HOME}
+		readonly local export "$1" export printf "$1" $(pwd) && 'quoted text' sed export
+then x=1 sed && -eu && export 'quoted text'
+	&& --verbose awk 2>/dev/null printf cd "$@" echo x=1 $(pwd) test ${HOME} then
+		"$@" /usr/bin ${HOME}
+		'quoted text' "$@" test readonly | done echo test grep awk
+$(pwd) awk test local grep /usr/bin && awk
+		echo echo done 2>/dev/null
+echo --verbose sed echo x=1 "$1"
+readonly readonly cd cd done grep 'quoted text'
+cd done --verbose then ${HOME} $(pwd) ${HOME}
+	/usr/bin 2>/dev/null done /usr/bin $(pwd) done "$1" printf
+		$(pwd) "$1" 'quoted text' 2>/dev/null &&
+awk /usr/bin ${HOME} grep local ${HOME}
+| done grep "$1" x=1 echo ${HOME} 'quoted text'
+cd cd test export -eu "$@" ${HOME} --verbose local then --verbose && awk | ${HOME}
+echo echo then /usr/bin sed && readonly sed readonly -eu
+local done local 2>/dev/null echo 2>/dev/null "$1"
+		export ${HOME} --verbose x=1 cd readonly
+printf grep awk sed "$1" ${HOME} printf -eu ${HOME}
+	/usr/bin export | ${HOME} &&
+local awk cd local awk
+"$@" echo then grep $(pwd) "$@" export
+	$(pwd) local x=1 ${HOME} ${HOME} --verbose readonly
+"$@" export cd sed $(pwd) sed --verbose done ${HOME} export sed echo
+		grep && readonly ${HOME} awk done x=1 "$@" printf | ${HOME} export
+	sed /usr/bin ${HOME} cd /usr/bin x=1 | "$1" "$1" done awk local test
+	local -eu done then "$1" "$1" /usr/bin "$1" 2>/dev/null
+		test 2>/dev/null 2>/dev/null
+		"$@" $(pwd) $(pwd) -eu export /usr/bin && test
+--verbose x=1 2>/dev/null grep &&
+		2>/dev/null then echo && "$@" "$@" printf cd $(pwd) -eu 2>/dev/null
+cd awk "$@" echo printf 2>/dev/null --verbose
+		then "$@" local grep echo "$@" "$1" ${HOME} done sed echo 2>/dev/null printf cd
+		echo /usr/bin cd x=1 $(pwd) /usr/bin 2>/dev/null -eu "$@" awk 'quoted text' awk
+export "$@" --verbose "$1" test x=1
+echo && test "$1" then test readonly then --verbose cd local && ${HOME}
+	echo readonly test export 'quoted text'
+		cd "$@" 2>/dev/null && ${HOME}
+		cd x=1 echo sed -eu && printf 2>/dev/null
+		| $(pwd) | "$1" ${HOME} --verbose sed sed awk echo
+		${HOME} "$@" sed "$@" -eu cd --verbose $(pwd) --verbose awk cd then then
+2>/dev/null --verbose 'quoted text'
+	grep x=1 --verbose x=1 'quoted text' echo test readonly x=1 readonly
+sed /usr/bin local "$@" "$@" --verbose echo readonly local
+		${HOME} printf /usr/bin --verbose "$1" printf
+&& local 2>/dev/null $(pwd) awk x=1 | $(pwd) --verbose
+	x=1 "$1" --verbose then grep 2>/dev/null -eu x=1 -eu "$@" awk 2>/dev/null local
+		then grep readonly -eu x=1 /usr/bin $(pwd) 2>/dev/null cd --verbose
+${HOME} "$1" "$1" awk "$@" printf && 'quoted text'
+&& done /usr/bin test sed awk ${HOME}
+	readonly awk $(pwd) done /usr/bin
+readonly -eu done echo local sed test export $(pwd) /usr/bin
+	/usr/bin local && local then cd 'quoted text' then done printf
+	$(pwd) readonly -eu done
+	awk 2>/dev/null printf && -eu local
+		-eu /usr/bin local && --verbose "$1" ${HOME} ${HOME} "$@" $(pwd) -eu awk
+	'quoted text' $(pwd) "$@" printf printf
+		then grep cd x=1 sed local | test 2>/dev/null cd cd local readonly
+		/usr/bin && local awk "$1"
+local local test x=1 grep awk cd echo -eu "$1"
+	then then "$@" 'quoted text' grep --verbose $(pwd) "$1"
+${HOME} export sed done readonly test && 2>/dev/null
+		awk x=1 local echo export
+cd readonly /usr/bin --verbose local x=1 grep sed readonly
+| test local 2>/dev/null -eu test | grep x=1 && awk 'quoted text'
+		test && test grep printf /usr/bin awk echo local readonly -eu sed printf
+-eu done echo "$1" export then /usr/bin 2>/dev/null
+	$(pwd) then $(pwd) readonly
+		"$1" x=1 cd -eu /usr/bin echo cd export printf -eu printf --verbose test 'quoted text'
+	$(pwd) /usr/bin test x=1 sed grep --verbose x=1 export
+printf $(pwd) /usr/bin /usr/bin /usr/bin
+	grep /usr/bin cd && --verbose | local readonly | printf cd 'quoted text'
+		awk $(pwd) 'quoted text' awk cd cd --verbose | echo grep x=1 'quoted text'
+-eu | x=1 ${HOME} awk sed echo
+		sed grep awk /usr/bin test "$1" printf
+echo grep cd export 2>/dev/null then --verbose test 2>/dev/null
+		${HOME} export /usr/bin && readonly x=1 export --verbose
+2>/dev/null x=1 --verbose /usr/bin "$@" 'quoted text' grep export $(pwd)
+	/usr/bin awk readonly grep 2>/dev/null
+		readonly awk then sed /usr/bin "$@" cd -eu sed --verbose
+sed -eu export printf echo printf $(pwd)
+x=1 local 2>/dev/null done echo $(pwd) test printf
+"$1" awk then --verbose
+2>/dev/null "$@" $(pwd) local echo
+readonly | export printf 2>/dev/null
+done grep awk $(pwd) "$@" 'quoted text'
+readonly cd 'quoted text'
+	"$1" /usr/bin awk then && && /usr/bin "$@" done "$1" 2>/dev/null awk "$@"
+$(pwd) local && ${HOME} /usr/bin printf printf
+		done test echo cd x=1 ${HOME} awk local 'quoted text'
+test && printf $(pwd) && 2>/dev/null echo ${HOME}
+test sed grep cd ${HOME} x=1 then
+	readonly printf test echo test --verbose "$1" /usr/bin
+	echo awk test test $(pwd) cd
+sed printf then && printf
+		printf 2>/dev/null done 2>/dev/null "$1" done printf
+readonly "$1" -eu 'quoted text' 'quoted text' 2>/dev/null
+		export x=1 -eu ${HOME} --verbose $(pwd) && 2>/dev/null "$1" $(pwd) sed grep
+	${HOME} | sed test done awk | $(pwd) x=1 | done ${HOME} printf
+	echo 2>/dev/null | export /usr/bin done $(pwd) --verbose
+	-eu /usr/bin cd "$1" -eu cd awk grep 2>/dev/null
+awk --verbose /usr/bin
+	--verbose local cd local
+	sed local test --verbose /usr/bin echo
+	test ${HOME} -eu awk echo echo 'quoted text'
+&& readonly "$1" ${HOME} test cd "$@" cd /usr/bin $(pwd) ${HOME}
+--verbose sed echo test "$@" 'quoted text' done ${HOME} echo /usr/bin 'quoted text'
+	--verbose awk /usr/bin | -eu then
+		sed sed sed local then local
+	then && local readonly ${HOME} && echo local awk 2>/dev/null test --verbose
+		export done done 2>/dev/null grep | | $(pwd) readonly
+		grep echo 2>/dev/null cd
+	'quoted text' $(pwd) local | local then $(pwd) -eu $(pwd) && /usr/bin sed cd &&
+readonly && | awk /usr/bin 2>/dev/null
+'quoted text' test /usr/bin -eu /usr/bin export 'quoted text' awk 'quoted text'
+readonly sed && readonly test ${HOME} -eu "$1" local test "$1" local
+	cd | printf && "$1" awk "$@" "$@" -eu then done
+		cd x=1 awk -eu ${HOME} -eu cd 2>/dev/null test test | 2>/dev/null echo /usr/bin
+readonly -eu awk $(pwd) "$1" 2>/dev/null 2>/dev/null printf echo
+	awk 2>/dev/null readonly x=1 export
+		| && export local export awk
+		$(pwd) cd "$@" awk test && awk local printf && "$@" grep printf
+	2>/dev/null printf && cd
+awk x=1 readonly printf x=1 sed "$@" done awk "$1" 'quoted text' ${HOME} "$@" -eu
+		sed /usr/bin printf 'quoted text' x=1 x=1 --verbose sed
+printf printf | /usr/bin /usr/bin /usr/bin
+	2>/dev/null test -eu readonly ${HOME} | test local
+$(pwd) "$1" printf sed printf export echo --verbose test $(pwd)
+		then /usr/bin test cd x=1 echo awk "$@" 2>/dev/null
+	/usr/bin ${HOME} sed test 'quoted text' then printf echo -eu export $(pwd)
+sed ${HOME} | -eu --verbose
+		"$@" -eu --verbose "$1" $(pwd) "$@"
+	cd $(pwd) grep ${HOME} then 2>/dev/null 2>/dev/null
+	-eu readonly /usr/bin | export grep done then "$1" readonly "$1"
+test "$1" printf -eu then printf ${HOME} local awk done | cd grep --verbose
+${HOME} printf export /usr/bin export -eu -eu "$@" echo ${HOME} echo done
+		x=1 | readonly printf | $(pwd) test cd test /usr/bin echo then --verbose
+	${HOME} "$1" printf local printf $(pwd) "$@" $(pwd) | 2>/dev/null then x=1
+	"$1" printf /usr/bin awk then ${HOME} |
+		grep --verbose /usr/bin ${HOME} | local local
+		grep x=1 2>/dev/null x=1 -eu /usr/bin x=1 done | sed then | "$1" echo
+printf -eu sed 2>/dev/null local
+		-eu then local -eu 'quoted text' printf 2>/dev/null
+	x=1 readonly cd local sed 2>/dev/null
+	awk cd /usr/bin /usr/bin awk 'quoted text' "$1" "$@" 'quoted text'
+	/usr/bin test local 'quoted text' local 'quoted text'
+	${HOME} x=1 done grep --verbose local | printf export
+sed printf | -eu --verbose
+		--verbose $(pwd) -eu test x=1 --verbose echo | printf
+		echo export printf awk "$@" | && "$1" sed cd local
+2>/dev/null readonly printf readonly --verbose --verbose
+		-eu "$1" printf awk x=1
+'quoted text' "$1" "$1"
+	/usr/bin | awk x=1 'quoted text' -eu test && /usr/bin
+/usr/bin test sed local sed
+		"$1" then "$@" done --verbose "$@" 2>/dev/null "$1" -eu "$@" then
+| --verbose awk export echo -eu export awk --verbose /usr/bin
+local "$1" echo | awk --verbose
+		then then && grep "$1" done
+"$@" export --verbose $(pwd)
+		echo ${HOME} $(pwd) && awk "$1" "$@" cd done "$1" && && $(pwd) printf
+$(pwd) && /usr/bin cd | -eu printf && 'quoted text' /usr/bin
+&& then x=1 2>/dev/null printf grep $(pwd) then /usr/bin
+		&& "$@" x=1 sed done "$@"
+${HOME} -eu 2>/dev/null 2>/dev/null awk printf grep readonly 2>/dev/null echo
+| printf local 'quoted text'
+readonly --verbose readonly ${HOME} x=1 "$@" test /usr/bin
+		$(pwd) --verbose done
+		done /usr/bin && /usr/bin
+		&& $(pwd) test "$@" -eu done cd
+	test export grep local | "$@" 2>/dev/null 2>/dev/null --verbose
+${HOME} x=1 sed grep | cd printf grep && 'quoted text'
+	printf $(pwd) readonly done -eu cd awk x=1 ${HOME}
+		printf -eu cd export -eu --verbose readonly
+	readonly sed x=1 awk local /usr/bin
+	echo then -eu --verbose export $(pwd) -eu done test
+	then then -eu -eu ${HOME} | done export
+		--verbose x=1 awk "$@" done then readonly
+	| test --verbose printf test "$@" x=1 -eu sed then
+		then 'quoted text' echo echo export echo printf echo /usr/bin 2>/dev/null
+	cd then /usr/bin then sed cd awk --verbose
+	awk x=1 awk "$@" | grep local grep |
+		then "$1" done 2>/dev/null
+	sed | export && then "$1" then && 'quoted text' sed "$1"
+	done x=1 --verbose && awk x=1 /usr/bin x=1 readonly $(pwd) export awk
+"$@" sed grep ${HOME} sed done echo cd --verbose echo awk echo
+test -eu test ${HOME} cd /usr/bin printf local done test cd $(pwd)
+	x=1 /usr/bin local cd awk "$1" cd export sed $(pwd) done && "$@" sed test -eu $(pwd)
+	$(pwd) sed 'quoted text' export "$1" export /usr/bin local
+	$(pwd) sed test cd then sed x=1 --verbose /usr/bin test printf $(pwd)
+2>/dev/null printf grep done x=1 local readonly ${HOME} 'quoted text' readonly
+readonly test --verbose sed cd sed $(pwd) echo
+	sed $(pwd) cd 2>/dev/null -eu "$@" readonly "$1" awk test --verbose 'quoted text'
+		printf /usr/bin /usr/bin printf readonly "$1" $(pwd) "$1" x=1 done
+	${HOME} done ${HOME} export done local cd "$1" grep 2>/dev/null
+sed "$@" printf && |
+	then awk | ${HOME} export --verbose done then sed 2>/dev/null 2>/dev/null x=1 then
+		-eu local 'quoted text' --verbose then "$1" 'quoted text'
+	then awk && test | printf --verbose 2>/dev/null --verbose
+	"$1" echo 'quoted text' 2>/dev/null
+	export awk --verbose then printf cd done 2>/dev/null
+		${HOME} cd done done cd cd awk -eu cd sed then x=1 ${HOME} --verbose
+"$@" ${HOME} sed cd --verbose
+"$1" done then x=1 | printf /usr/bin "$1" readonly cd then
+local readonly readonly then echo
+readonly 2>/dev/null | 'quoted text' test awk /usr/bin
+| cd test | readonly && then 2>/dev/null awk
+		readonly cd ${HOME} | --verbose 2>/dev/null local "$@" "$@" $(pwd) && then
+		done then | readonly $(pwd) test local readonly | "$1" x=1 && echo $(pwd)
+	/usr/bin local 'quoted text' readonly cd $(pwd) test sed readonly
+	awk grep "$1" done cd 2>/dev/null ${HOME}
+	'quoted text' && "$1" awk readonly --verbose awk && --verbose 2>/dev/null
+	"$@" grep sed grep then ${HOME} local /usr/bin
+echo printf x=1 grep $(pwd) | 'quoted text' "$@" --verbose
+then | $(pwd) done ${HOME} 'quoted text' x=1 | 2>/dev/null
+'quoted text' done local done 2>/dev/null export grep | printf -eu done
+| awk readonly $(pwd) then x=1 -eu "$1" -eu done grep --verbose 2>/dev/null
+		local done --verbose local
+2>/dev/null echo export
+		readonly "$@" "$@" echo
+	2>/dev/null "$@" ${HOME} --verbose awk $(pwd) export -eu
+${HOME} local 2>/dev/null /usr/bin ${HOME} local then x=1 echo "$1" "$1" local
+		&& printf /usr/bin test echo test printf test cd "$1"
+	local --verbose /usr/bin 2>/dev/null
+		test $(pwd) then | $(pwd) awk x=1 export cd | 2>/dev/null /usr/bin $(pwd)
+/usr/bin "$1" readonly readonly
+		test 2>/dev/null "$1" cd
@@ -0,0 +1,2001 @@
+		done ${HOME} "$1" grep x=1 ${HOME} awk echo echo readonly -eu
+&& /usr/bin awk awk printf
+	"$@" "$1" -eu cd cd sed awk awk grep test --verbose --verbose
+	${HOME} && then "$@" awk
+		x=1 --verbose test echo &&
+		$(pwd) -eu --verbose
+done --verbose done cd 'quoted text'
+	--verbose printf -eu 2>/dev/null local then --verbose cd
+local x=1 'quoted text' --verbose awk then
+		export --verbose local -eu grep /usr/bin grep
+/usr/bin grep -eu $(pwd) "$1"
+	"$@" then sed ${HOME} export cd export sed
+	"$1" done printf awk 'quoted text' done printf && --verbose printf | export
+		readonly readonly | && 2>/dev/null echo /usr/bin $(pwd) awk awk "$1" x=1
+		test then "$1" -eu | --verbose export ${HOME}
+		$(pwd) 2>/dev/null awk 'quoted text' "$1" cd 'quoted text' | --verbose
+	cd "$@" --verbose export "$@" grep --verbose export -eu
+		echo 2>/dev/null x=1 readonly done
+	${HOME} && test x=1 grep
+	${HOME} cd | then | sed --verbose
+'quoted text' && "$1" local cd
+'quoted text' readonly --verbose grep local ${HOME}
+awk sed export ${HOME} echo export $(pwd)
+	export && ${HOME} echo sed local ${HOME} printf | echo
+export --verbose local | local test readonly /usr/bin local readonly
+	x=1 "$1" echo done x=1 "$@" then awk sed | local $(pwd) 2>/dev/null
+	echo | local grep sed printf && then sed
+echo grep grep $(pwd) -eu cd ${HOME} "$1" echo && /usr/bin ${HOME}
+2>/dev/null sed 'quoted text' then x=1 then -eu "$1"
+2>/dev/null sed "$@" echo export local --verbose awk grep export then --verbose
+		grep --verbose ${HOME} readonly x=1 /usr/bin
+	sed /usr/bin ${HOME} grep done "$1" | /usr/bin
+		| test cd cd echo && echo 2>/dev/null "$1" echo then grep echo
+		echo 2>/dev/null 2>/dev/null x=1 readonly -eu done export local
+		test 'quoted text' test then test x=1 2>/dev/null
+	'quoted text' "$1" --verbose x=1 awk "$1" printf ${HOME} local
+${HOME} x=1 awk ${HOME} printf
+"$@" /usr/bin 'quoted text' local
+$(pwd) /usr/bin test -eu $(pwd) awk cd then printf -eu sed awk grep readonly |
+	then grep "$@" 'quoted text' --verbose
+		-eu 2>/dev/null readonly 2>/dev/null local x=1 local /usr/bin printf
+local ${HOME} readonly echo
+	$(pwd) printf awk ${HOME}
+	x=1 | $(pwd) cd "$1" x=1 echo
+	${HOME} grep --verbose printf 2>/dev/null local 2>/dev/null export ${HOME}
+		&& "$1" x=1 local cd echo done
+		${HOME} && readonly /usr/bin awk x=1 sed
+x=1 readonly -eu ${HOME} grep
+local cd export /usr/bin 2>/dev/null "$1" then ${HOME}
+		printf test | --verbose local cd -eu 2>/dev/null done printf then
+&& then cd test echo sed && 2>/dev/null
+		'quoted text' test 2>/dev/null readonly 2>/dev/null "$@" $(pwd)
+	"$@" /usr/bin then -eu ${HOME} grep
+		echo ${HOME} then readonly
+then grep grep "$1" then grep x=1 'quoted text'
+	readonly -eu -eu echo "$@" done x=1 'quoted text'
+x=1 "$@" readonly 2>/dev/null ${HOME} "$@" /usr/bin -eu 2>/dev/null /usr/bin
+		readonly /usr/bin echo -eu cd test ${HOME} "$1" "$1" -eu grep /usr/bin
+	| "$@" sed printf printf "$@" ${HOME} /usr/bin "$@" sed done && -eu awk x=1 $(pwd)
+	grep && readonly printf sed then && grep readonly test $(pwd)
+	done "$1" ${HOME} sed -eu sed
+	grep 'quoted text' sed | "$@" 'quoted text' | /usr/bin sed "$@" "$1"
+	| "$@" ${HOME} ${HOME} -eu x=1 awk test "$1"
+	/usr/bin grep local then printf "$@" | "$1" awk "$@" grep && 'quoted text' test
+	"$@" export sed | awk sed echo local sed export done
+cd 'quoted text' echo /usr/bin x=1 grep -eu done then /usr/bin
+	"$1" done sed ${HOME} grep printf /usr/bin x=1 cd x=1 then echo 2>/dev/null $(pwd)
+		awk "$@" -eu x=1 2>/dev/null echo cd && local sed ${HOME} &&
+echo "$1" sed printf done then printf done | x=1 done --verbose
+	$(pwd) sed sed && -eu $(pwd) && && ${HOME} $(pwd) cd | then printf test /usr/bin
+		test sed test then 'quoted text' export grep ${HOME} -eu
+		done test "$1" local --verbose "$@" -eu then "$@"
+	echo --verbose --verbose /usr/bin && $(pwd) sed
+		-eu 2>/dev/null $(pwd) -eu printf "$1" done 2>/dev/null
+		export export sed export --verbose echo $(pwd) readonly
+-eu done $(pwd) export x=1 -eu | $(pwd) test export && local cd ${HOME}
+/usr/bin /usr/bin readonly 'quoted text' sed then cd
+	awk cd ${HOME} | 2>/dev/null | ${HOME} done cd "$@" echo awk
+	${HOME} grep $(pwd) "$1"
+	'quoted text' cd readonly export x=1 'quoted text'
+		sed test echo "$1" done && readonly -eu local readonly $(pwd) local awk
+grep --verbose /usr/bin "$1" ${HOME} --verbose 2>/dev/null 'quoted text'
+		'quoted text' && sed /usr/bin local test /usr/bin "$1" "$@" --verbose readonly
+export 2>/dev/null 'quoted text'
+		done --verbose ${HOME}
+	test "$1" $(pwd) "$@" readonly
+--verbose ${HOME} "$@" 'quoted text' printf "$@" cd
+	readonly done echo local awk echo -eu
+		export ${HOME} /usr/bin 2>/dev/null x=1
+	| printf grep then --verbose
+'quoted text' then readonly | 'quoted text' 2>/dev/null cd echo grep $(pwd)
+then "$1" $(pwd) "$1" sed 'quoted text' awk 2>/dev/null done echo $(pwd)
+printf ${HOME} && then
+	printf ${HOME} sed -eu grep printf done -eu "$@" printf "$@" grep
+then "$1" 2>/dev/null sed 'quoted text'
+	"$1" grep && then test x=1 local done done 2>/dev/null then local | /usr/bin
+	"$@" -eu && readonly awk 'quoted text' --verbose
+export x=1 cd --verbose -eu then /usr/bin
+		awk then awk "$@" readonly 'quoted text' then test test /usr/bin
+local local readonly "$1" cd | then done sed cd "$@" printf 2>/dev/null
+		readonly "$@" then "$1" awk local awk
+done export "$1" test printf | $(pwd) "$1" sed ${HOME} && "$@" done x=1
+	echo $(pwd) 2>/dev/null sed ${HOME} printf readonly
+		cd readonly && test 'quoted text' done printf | --verbose
+	then --verbose $(pwd) -eu awk x=1 readonly cd "$@" grep export ${HOME}
+sed /usr/bin "$@" done 'quoted text' readonly cd x=1 sed awk
+		-eu x=1 printf | --verbose && export local | /usr/bin
+then test awk /usr/bin readonly "$@" done then | $(pwd)
+	done "$@" $(pwd) 2>/dev/null /usr/bin test /usr/bin
+	'quoted text' grep | "$@" readonly
+		echo $(pwd) export echo "$1" readonly cd test local 'quoted text'
+printf && 'quoted text' 2>/dev/null local
+local x=1 printf $(pwd) export then
+	done | awk awk readonly test printf local printf | 'quoted text'
+		-eu readonly /usr/bin export "$@" sed 2>/dev/null echo sed sed grep
+	'quoted text' sed -eu then awk | /usr/bin
+	done cd /usr/bin then sed awk local
+		-eu then | then local /usr/bin echo done grep -eu grep
+	then sed awk echo readonly --verbose
+		cd sed echo | export export "$1" -eu 2>/dev/null --verbose
+export $(pwd) echo awk x=1 -eu 2>/dev/null sed
+		printf echo ${HOME} grep
+echo -eu grep readonly $(pwd) 2>/dev/null
+/usr/bin then $(pwd) grep cd -eu done
+	${HOME} export /usr/bin cd "$1" "$1" grep local awk /usr/bin $(pwd) test "$1"
+	printf ${HOME} /usr/bin cd "$@" x=1 /usr/bin $(pwd) "$@" ${HOME}
+	sed echo ${HOME} sed readonly
+	done /usr/bin printf x=1
+done -eu --verbose "$1" local -eu test /usr/bin "$@" cd export
+export /usr/bin -eu grep echo --verbose
+	/usr/bin done ${HOME} /usr/bin test then grep
+readonly 2>/dev/null echo then grep awk ${HOME} | done grep
+	awk 'quoted text' test x=1 test -eu done done
+		/usr/bin sed x=1 | grep 'quoted text' "$1" echo test grep $(pwd) $(pwd) done
+'quoted text' local echo readonly $(pwd) readonly awk cd x=1 "$@" printf $(pwd)
+		--verbose sed /usr/bin ${HOME}
+then cd awk 2>/dev/null done export
+	readonly then --verbose /usr/bin && echo x=1
+		sed "$@" printf then printf |
+--verbose local echo --verbose x=1 done printf
+--verbose grep echo $(pwd) local && readonly sed | cd /usr/bin
+	&& grep /usr/bin "$@" echo cd test printf | then echo printf echo readonly
+	export local "$@" sed then cd | done x=1 && ${HOME} test
+		"$1" "$1" cd local | readonly
+--verbose ${HOME} 2>/dev/null
+&& ${HOME} then | printf 'quoted text' -eu && 'quoted text'
+2>/dev/null cd && x=1 ${HOME} | done $(pwd) readonly --verbose ${HOME}
+	--verbose export 'quoted text' "$1" 2>/dev/null
+	&& printf cd readonly done ${HOME} test test echo printf /usr/bin
+"$@" awk -eu --verbose done $(pwd)
+	test /usr/bin awk readonly x=1 x=1
+	cd export | "$@" x=1 -eu
+	grep 'quoted text' && local --verbose
+	${HOME} export -eu | then ${HOME}
+		printf readonly 'quoted text' local awk
+	'quoted text' && grep sed echo --verbose echo export --verbose
+		grep grep awk awk x=1 printf awk ${HOME} -eu "$@" printf ${HOME} "$1" ${HOME}
+	local done "$@" -eu printf local ${HOME} "$1" 'quoted text'
+${HOME} 'quoted text' awk
+done ${HOME} && test export echo export /usr/bin x=1 /usr/bin grep
+2>/dev/null -eu sed --verbose $(pwd) then
+	&& export /usr/bin 2>/dev/null
+"$@" | x=1 'quoted text' printf && grep 'quoted text'
+export readonly export | --verbose cd readonly --verbose | local
+		test ${HOME} echo readonly sed
+		| $(pwd) "$1" 2>/dev/null sed echo 'quoted text' $(pwd)
+export sed awk sed then export done cd 2>/dev/null sed echo awk grep
+		cd done readonly "$1" printf export cd $(pwd) --verbose /usr/bin x=1 test
+"$@" ${HOME} "$@" grep printf cd awk
+		x=1 readonly awk $(pwd) cd test --verbose | echo
+	${HOME} grep readonly
+		2>/dev/null local echo 'quoted text' then x=1 /usr/bin cd 'quoted text'
+grep $(pwd) echo --verbose readonly
+	--verbose readonly 'quoted text' 2>/dev/null "$@" printf -eu test local sed
+	x=1 echo echo 2>/dev/null cd "$1" "$1" test readonly export test printf 2>/dev/null
+export printf -eu then then && 2>/dev/null 'quoted text' grep --verbose "$1"
+	grep | sed 'quoted text' 'quoted text' $(pwd) then
+	$(pwd) test then -eu sed 'quoted text' test 'quoted text' readonly 'quoted text'
+'quoted text' -eu -eu | | awk sed | "$@"
+		$(pwd) -eu ${HOME} x=1 awk grep -eu "$@" grep && grep printf readonly
+&& -eu /usr/bin "$@" && --verbose grep local ${HOME}
+		"$@" ${HOME} $(pwd) echo cd grep $(pwd) x=1 sed
+		&& "$1" then test /usr/bin echo "$@" && $(pwd) done
+	printf 'quoted text' export -eu readonly awk x=1 export
+cd then printf echo ${HOME} "$1" printf
+	readonly then 2>/dev/null local "$1"
+		cd | grep test printf 'quoted text' grep then
+grep grep echo 2>/dev/null 2>/dev/null "$1" 2>/dev/null --verbose done awk grep
+		x=1 sed printf export local 2>/dev/null readonly "$@" echo "$1" awk
+| local awk --verbose --verbose
+local /usr/bin 'quoted text' | ${HOME} echo "$@" sed
+"$@" -eu local && export echo grep x=1 awk export 'quoted text' "$1"
+		--verbose export ${HOME} echo export x=1 readonly printf "$1" 'quoted text'
+test awk /usr/bin local 'quoted text' grep awk cd
+	awk x=1 then echo printf -eu "$@" 'quoted text' local 'quoted text'
+	sed $(pwd) 2>/dev/null "$@" x=1 ${HOME} "$1" then
+export /usr/bin export "$@" sed x=1 then --verbose cd "$1" echo
+awk | grep grep printf test 2>/dev/null
+	$(pwd) "$1" done then readonly "$1"
+		cd echo local --verbose cd echo sed
+then -eu -eu done x=1 awk "$@"
+	awk x=1 ${HOME} -eu -eu readonly 2>/dev/null "$@" echo then
+		$(pwd) grep x=1 echo &&
+		then 2>/dev/null ${HOME} "$@" x=1 grep echo export
+		sed /usr/bin grep /usr/bin grep done grep "$@" awk then $(pwd) x=1 "$@" -eu
+	printf cd done 2>/dev/null | && echo -eu printf test --verbose $(pwd)
+printf printf -eu sed "$@" grep echo export sed x=1 "$1" -eu local
+	"$@" done --verbose -eu --verbose $(pwd) echo export echo echo
+		printf readonly test printf -eu "$1" awk $(pwd) && $(pwd) /usr/bin grep echo
+2>/dev/null 2>/dev/null local
+	test "$@" x=1 done x=1 cd "$1" --verbose
+test sed then sed $(pwd) --verbose /usr/bin
+	&& test $(pwd) 2>/dev/null $(pwd) done ${HOME} ${HOME}
+/usr/bin -eu sed export done "$1" | "$1" local awk local echo sed && printf ${HOME}
+'quoted text' && 'quoted text' readonly 'quoted text'
+	x=1 2>/dev/null "$1" readonly | /usr/bin readonly done cd printf
+		readonly | 2>/dev/null | grep local test local -eu 'quoted text' 2>/dev/null
+cd awk "$@" $(pwd) "$1" && && "$@" grep readonly x=1 "$1" x=1 --verbose
+	/usr/bin sed done awk x=1 x=1 test cd sed local
+		$(pwd) ${HOME} awk cd 2>/dev/null ${HOME}
+--verbose "$1" 'quoted text' grep export cd
+test --verbose 2>/dev/null --verbose then "$@" --verbose local
+		grep "$1" readonly readonly
+		"$@" 2>/dev/null "$1" $(pwd) test
+	test echo 'quoted text' echo 2>/dev/null printf cd local grep /usr/bin done
+export export grep local echo grep $(pwd) 2>/dev/null && sed | sed &&
+readonly 'quoted text' local -eu -eu | 2>/dev/null ${HOME} /usr/bin
+	'quoted text' ${HOME} sed "$1" && done then && | test export --verbose then then
+	x=1 ${HOME} --verbose "$@" "$@" then printf sed "$1" x=1
+| done 2>/dev/null ${HOME} $(pwd) --verbose
+		&& cd 'quoted text' then sed && then printf done
+		x=1 /usr/bin test cd -eu -eu /usr/bin && -eu "$1" sed echo sed printf
+	export && 2>/dev/null -eu /usr/bin readonly "$1" printf "$1"
+	${HOME} "$1" /usr/bin local printf
+	$(pwd) /usr/bin printf printf ${HOME} then "$@" && test echo local
+local /usr/bin cd && sed then test --verbose -eu awk ${HOME} | test 2>/dev/null
+printf -eu test "$@" grep readonly readonly awk "$1" $(pwd) awk echo echo
+grep -eu x=1 2>/dev/null --verbose done awk
+	2>/dev/null 2>/dev/null test then awk echo awk echo
+		awk | echo ${HOME} cd && "$1" $(pwd) echo echo
+		grep done "$1" grep 2>/dev/null $(pwd) x=1 "$1" /usr/bin then -eu printf
+		local /usr/bin && export "$1" $(pwd) cd grep $(pwd) sed test /usr/bin | grep
+	'quoted text' printf --verbose | then grep echo 'quoted text' then done then
+| "$@" ${HOME} readonly x=1 &&
+		--verbose 2>/dev/null local -eu then 2>/dev/null local | /usr/bin 2>/dev/null
+&& local --verbose echo /usr/bin -eu
+		--verbose -eu --verbose | local
+| readonly then x=1 then readonly ${HOME} 2>/dev/null done sed |
+x=1 grep grep echo ${HOME} local printf grep --verbose "$@" | echo awk
+	export --verbose | awk --verbose "$1" &&
+local echo export ${HOME} /usr/bin cd $(pwd) export /usr/bin ${HOME}
+	test local echo && echo done --verbose echo
+	"$1" $(pwd) done 2>/dev/null && local && --verbose grep readonly ${HOME}
+		then ${HOME} grep /usr/bin ${HOME} then sed printf && ${HOME}
+		echo | | done --verbose /usr/bin grep done
+	sed -eu "$1" 'quoted text'
+		awk $(pwd) then 'quoted text' awk cd local "$@" cd grep sed readonly |
+"$@" then x=1 'quoted text'
+x=1 cd ${HOME} ${HOME} printf 2>/dev/null /usr/bin readonly
+"$1" "$1" done awk --verbose x=1 readonly cd cd test local 2>/dev/null printf
+	'quoted text' echo export then && x=1 awk readonly printf
+	cd --verbose "$@" test $(pwd) then cd 2>/dev/null
+		/usr/bin then x=1 "$1" /usr/bin
+		&& export "$@" cd ${HOME} export grep -eu $(pwd) then
+		test awk | "$1" "$@" /usr/bin 2>/dev/null cd done | readonly
+		2>/dev/null --verbose readonly "$@" "$@" grep
+		sed | /usr/bin --verbose awk ${HOME} $(pwd) /usr/bin grep readonly --verbose
+		"$@" "$@" sed sed x=1 echo 'quoted text'
+	"$@" | echo then export export sed test awk $(pwd) local && |
+${HOME} sed -eu "$1" export 'quoted text'
+"$@" && x=1 "$1" local awk done ${HOME} 'quoted text'
+	'quoted text' -eu cd export 2>/dev/null
+	test "$@" export done sed "$@" | /usr/bin ${HOME} $(pwd)
+readonly readonly export /usr/bin test $(pwd) readonly 2>/dev/null awk cd
+export x=1 local awk "$1" "$1" awk printf && then 2>/dev/null
+		2>/dev/null ${HOME} test export $(pwd) awk done -eu echo then readonly
+	"$@" grep sed 'quoted text' --verbose
+	--verbose awk -eu readonly $(pwd) 2>/dev/null local export
+	sed sed awk local "$1" printf echo "$1" echo grep ${HOME}
+| ${HOME} | done -eu 2>/dev/null --verbose
+sed 'quoted text' ${HOME} && done
+		grep | grep then done echo grep -eu local sed cd cd 'quoted text'
+echo grep "$@" awk --verbose $(pwd)
+"$1" printf sed "$1" then 'quoted text' --verbose awk | echo done
+	local export --verbose then x=1 2>/dev/null /usr/bin ${HOME}
+printf sed "$1" && local x=1 echo "$@" "$@" ${HOME}
+	cd 2>/dev/null x=1 echo $(pwd) then | grep x=1 then
+| test done $(pwd) $(pwd) local local ${HOME} --verbose export awk
+		/usr/bin readonly then |
+		x=1 test export $(pwd) 2>/dev/null x=1 | local -eu 2>/dev/null done x=1 echo
+&& 'quoted text' cd printf printf -eu "$@" 'quoted text' export "$1" sed sed
+	'quoted text' --verbose readonly --verbose 2>/dev/null
+		x=1 awk /usr/bin test echo x=1 grep done "$1" cd then /usr/bin
+export grep grep local ${HOME} export readonly local /usr/bin grep cd
+		test awk $(pwd) export readonly --verbose awk echo && grep "$@" then x=1 test local
+		"$1" ${HOME} test -eu grep "$1" then 'quoted text'
+cd sed -eu && $(pwd) test grep printf sed cd then sed test "$1" echo /usr/bin
+		awk cd local ${HOME} test awk readonly printf cd then readonly
+	/usr/bin readonly 'quoted text' done 2>/dev/null
+| 2>/dev/null test && 2>/dev/null grep /usr/bin
+export -eu /usr/bin $(pwd) ${HOME} cd readonly | echo local $(pwd) done
+	awk then ${HOME} printf ${HOME} "$@" 'quoted text' --verbose
+		done x=1 echo "$@" ${HOME} awk awk sed
+--verbose | 2>/dev/null 2>/dev/null
+		done | 'quoted text' --verbose ${HOME} 2>/dev/null readonly "$@"
+		test 2>/dev/null --verbose x=1 "$@" awk then
+&& then && export cd | export awk /usr/bin 2>/dev/null sed
+	printf readonly done "$@" cd awk sed cd cd awk "$@" echo ${HOME} 2>/dev/null
+		--verbose echo sed test echo awk echo
+		awk test x=1 2>/dev/null /usr/bin echo export done then
+	test ${HOME} -eu 'quoted text' printf
+		&& sed ${HOME} then cd sed
+		awk grep export --verbose awk then
+echo "$1" -eu echo "$@" && cd x=1 export
+		test export readonly export
+	printf sed cd test printf echo $(pwd) $(pwd) -eu "$@" -eu 'quoted text'
+		export ${HOME} readonly --verbose sed /usr/bin
+	2>/dev/null sed 'quoted text'
+		"$@" 'quoted text' grep /usr/bin sed $(pwd) "$@" && cd then 2>/dev/null
+test "$@" "$1" readonly readonly then done -eu awk /usr/bin
+	printf done echo export
+cd "$1" echo ${HOME} "$@" $(pwd) $(pwd) cd echo | | $(pwd) "$@"
+	-eu test $(pwd) $(pwd) -eu | /usr/bin local --verbose done "$@" && $(pwd)
+'quoted text' awk 'quoted text'
+${HOME} ${HOME} awk ${HOME} printf grep 'quoted text' && "$@" readonly
+export done export $(pwd) printf | --verbose && sed "$@" done --verbose 2>/dev/null
+		$(pwd) ${HOME} export 2>/dev/null -eu
+	$(pwd) cd "$@" cd | $(pwd) test | "$1" export "$@" 2>/dev/null 2>/dev/null --verbose
+		$(pwd) "$1" -eu "$@" ${HOME} --verbose readonly done ${HOME} echo
+	--verbose 2>/dev/null sed && ${HOME} echo "$@" test "$@" -eu export
+		--verbose done readonly --verbose sed readonly 2>/dev/null /usr/bin cd echo
+| --verbose then awk $(pwd) awk
+sed sed 'quoted text' done /usr/bin 'quoted text'
+		"$@" | then "$1" local "$1" "$1" -eu $(pwd) ${HOME} grep --verbose
+-eu then awk awk awk grep "$@" -eu 'quoted text' export cd "$@"
+	-eu done cd | cd "$@" && | test local && export done then printf
+	readonly $(pwd) /usr/bin && -eu /usr/bin 2>/dev/null "$@" x=1 "$1" 'quoted text'
+| printf /usr/bin $(pwd) cd $(pwd) awk echo ${HOME}
+		readonly awk 2>/dev/null readonly ${HOME} ${HOME} --verbose
+/usr/bin awk x=1 2>/dev/null done 2>/dev/null awk -eu
+	2>/dev/null "$@" export --verbose x=1 "$@" /usr/bin && then
+		$(pwd) export export ${HOME} $(pwd) grep | "$1" "$1" "$@"
+test grep x=1 $(pwd) done
+	export local && done "$1" local readonly cd readonly printf sed export
+echo "$@" /usr/bin 2>/dev/null &&
+	then readonly export --verbose readonly
+		done cd awk then /usr/bin --verbose | then -eu 2>/dev/null then && local /usr/bin
+	sed /usr/bin export then cd sed 2>/dev/null
+	/usr/bin | test /usr/bin done /usr/bin
+	2>/dev/null readonly --verbose 'quoted text'
+		awk readonly 'quoted text' ${HOME} echo 2>/dev/null printf cd $(pwd) $(pwd) local
+local awk readonly "$1" 2>/dev/null local x=1 $(pwd) -eu "$@" sed
+grep then ${HOME} then
+		echo then x=1 printf 2>/dev/null ${HOME} then "$@"
+		sed $(pwd) "$@" sed local export ${HOME} "$1" | done
+	| /usr/bin && /usr/bin 'quoted text'
+		sed --verbose sed echo
+		/usr/bin then --verbose
+		--verbose cd export readonly -eu readonly sed $(pwd) x=1
+		${HOME} printf -eu echo
+	$(pwd) | readonly x=1 ${HOME} then && readonly local ${HOME}
+		sed x=1 x=1 $(pwd) sed "$1" printf
+'quoted text' x=1 cd ${HOME} "$@" export grep && && /usr/bin /usr/bin
+test "$1" echo "$1" local echo done 'quoted text'
+	cd then | echo 2>/dev/null --verbose
+	"$1" "$1" -eu "$1" -eu done echo sed then 2>/dev/null && "$@" readonly then
+	grep $(pwd) && export test echo echo "$@" grep "$1"
+		| awk $(pwd) then done 'quoted text' local
+		"$@" export sed then
+	&& cd 'quoted text' x=1 | ${HOME} 'quoted text' printf
+	awk export echo --verbose "$1" then && | "$@" test export 2>/dev/null
+		/usr/bin | 2>/dev/null readonly
+	then then sed | 'quoted text' printf ${HOME}
+	done /usr/bin printf "$1"
+	awk /usr/bin echo export echo
+export | | "$1" | awk printf grep x=1 "$@" local && 2>/dev/null $(pwd) "$@" 'quoted text'
+		"$@" | readonly sed echo x=1 readonly grep printf done printf
+| then 2>/dev/null 2>/dev/null awk echo ${HOME} printf sed test && ${HOME} local
+	"$@" "$1" --verbose x=1 then "$@"
+sed x=1 grep && --verbose "$1" -eu --verbose | -eu --verbose
+		--verbose | printf $(pwd) x=1 readonly ${HOME} then && readonly
+		export test 'quoted text' x=1 done awk -eu grep local printf
+	$(pwd) readonly echo readonly cd local
+	printf | && "$1" test then "$@" 'quoted text' "$@" x=1 $(pwd) | sed
+	/usr/bin test local echo printf readonly x=1 "$1" printf -eu local local
+	printf -eu test cd export
+	done test export "$1" then "$1" && grep printf printf export && | done
+		test | && --verbose cd printf
+	--verbose -eu "$1" -eu test echo local test test done export local
+	&& done sed | cd $(pwd) | x=1 cd "$1" grep
+		done test "$@" $(pwd) test
+	2>/dev/null 2>/dev/null x=1 2>/dev/null then sed $(pwd) "$@"
+		--verbose --verbose echo x=1 ${HOME} cd printf "$@"
+	export x=1 readonly | echo done && -eu readonly | "$@" cd
+x=1 "$@" readonly "$@" test $(pwd) printf 'quoted text' /usr/bin /usr/bin
+	readonly 'quoted text' $(pwd) done local | awk
+		"$@" "$1" awk done printf 2>/dev/null done /usr/bin
+2>/dev/null 'quoted text'
+		grep done 'quoted text' x=1 then --verbose $(pwd) | -eu printf
+		${HOME} -eu "$@" x=1 printf "$1" test 'quoted text'
+	done test awk 2>/dev/null
+		--verbose 2>/dev/null test test sed ${HOME} 2>/dev/null x=1 2>/dev/null grep echo
+	$(pwd) ${HOME} awk done |
+		/usr/bin "$1" then 2>/dev/null x=1 "$1" done done "$1" 2>/dev/null
+	| 'quoted text' cd grep "$@" x=1 x=1 && readonly --verbose
+	awk $(pwd) export printf x=1 export ${HOME}
+	&& 2>/dev/null local 'quoted text'
+		"$1" 2>/dev/null --verbose sed readonly x=1 /usr/bin sed sed awk then done
+readonly 2>/dev/null then | readonly done export --verbose echo
+		"$@" cd -eu then x=1 | "$1" /usr/bin /usr/bin cd then then cd /usr/bin
+	2>/dev/null then $(pwd) awk sed -eu then | test test echo -eu 'quoted text'
+		printf export /usr/bin local
+		awk sed export 2>/dev/null "$@" echo "$@" readonly --verbose
+		grep -eu 'quoted text' test export then 2>/dev/null export then --verbose awk then
+	/usr/bin done readonly ${HOME} export printf --verbose $(pwd) awk local
+		cd export echo done 2>/dev/null
+		/usr/bin -eu sed | printf printf 'quoted text' then ${HOME} local local
+		x=1 test then echo && then "$@" export awk export grep -eu 2>/dev/null
+		cd local 'quoted text' done
+		printf cd local "$1" /usr/bin ${HOME}
+	done -eu x=1 --verbose /usr/bin ${HOME}
+awk test ${HOME} cd local cd
+	awk cd readonly /usr/bin then | /usr/bin test
+	cd awk cd --verbose local ${HOME} sed && && then then x=1 /usr/bin sed echo
+		test && 2>/dev/null $(pwd) --verbose local ${HOME} x=1 local then done readonly
+		${HOME} printf test ${HOME}
+grep /usr/bin readonly && -eu x=1 then "$@" && --verbose cd /usr/bin
+		/usr/bin export printf test /usr/bin && x=1
+	/usr/bin ${HOME} echo $(pwd) | grep printf ${HOME} grep --verbose readonly
+	--verbose x=1 2>/dev/null ${HOME}
+printf /usr/bin export local done export sed done echo ${HOME} ${HOME} echo local
+		export x=1 && 2>/dev/null /usr/bin done test export 2>/dev/null /usr/bin
+		readonly ${HOME} "$1" --verbose export local "$@" | /usr/bin | /usr/bin
+test awk "$@" echo "$1" | x=1 awk printf /usr/bin /usr/bin export "$@"
+		/usr/bin cd ${HOME} ${HOME}
+${HOME} test ${HOME} /usr/bin ${HOME} export local export $(pwd) local readonly
+	--verbose x=1 --verbose "$1" 2>/dev/null "$1" | local 2>/dev/null sed readonly local
+	then grep 2>/dev/null then && sed x=1
+cd $(pwd) export /usr/bin cd local 2>/dev/null -eu --verbose
+echo "$@" "$@" awk --verbose "$1" cd /usr/bin printf grep x=1
+		/usr/bin sed $(pwd) | 'quoted text'
+		'quoted text' grep awk 'quoted text' echo
+awk sed then test printf sed local local && |
+	then 'quoted text' echo x=1 "$@" export 2>/dev/null ${HOME} cd cd grep
+'quoted text' x=1 --verbose 'quoted text' 'quoted text' cd -eu test cd
+	2>/dev/null sed && $(pwd) $(pwd) 2>/dev/null /usr/bin
+--verbose echo grep | grep -eu awk 'quoted text' grep
+	/usr/bin 2>/dev/null /usr/bin readonly && -eu /usr/bin
+local /usr/bin grep /usr/bin
+		cd | $(pwd) /usr/bin --verbose
+		"$@" readonly "$@" "$1" done readonly | "$@" "$1"
+		2>/dev/null done /usr/bin done
+	test cd && "$1" $(pwd) echo /usr/bin
+		"$1" grep local "$1" 'quoted text' && "$@" echo cd echo test test local -eu
+	2>/dev/null "$1" ${HOME}
+printf | echo awk sed $(pwd) 2>/dev/null then export && "$1" test 'quoted text'
+		x=1 printf $(pwd) && local echo export
+	$(pwd) export echo | $(pwd) grep grep && 'quoted text'
+		then printf done grep then echo x=1 then ${HOME} done export && &&
+	2>/dev/null cd /usr/bin test $(pwd) "$@" awk printf awk "$@"
+'quoted text' -eu /usr/bin readonly "$1"
+	then then && && grep then echo 'quoted text' -eu && /usr/bin done --verbose then
+		| 2>/dev/null local echo 'quoted text' done readonly --verbose $(pwd) done
+		grep sed grep x=1 local | grep cd then grep 2>/dev/null | "$1" test ${HOME}
+		cd -eu echo awk then x=1 $(pwd) $(pwd) &&
+grep test grep x=1 | x=1 then &&
+	--verbose ${HOME} echo local local echo ${HOME} --verbose --verbose 2>/dev/null
+		printf echo grep grep printf readonly
+	2>/dev/null 'quoted text' export cd x=1
+		${HOME} sed --verbose awk then
+echo cd x=1 done -eu 'quoted text'
+test cd ${HOME} echo 2>/dev/null cd readonly
+	'quoted text' printf -eu --verbose -eu --verbose grep -eu readonly /usr/bin
+	/usr/bin $(pwd) grep && local
+		printf echo export 'quoted text' grep sed 2>/dev/null
+	local local /usr/bin "$1" x=1 ${HOME} /usr/bin 'quoted text' "$1" export
+		done --verbose test cd printf test then
+/usr/bin "$1" x=1 awk 2>/dev/null x=1 test test && 2>/dev/null local sed --verbose
+	/usr/bin test $(pwd) --verbose "$1" cd --verbose export export readonly
+	${HOME} 'quoted text' sed local printf cd --verbose
+	cd done -eu && test cd && $(pwd)
+		x=1 export test x=1 sed ${HOME} readonly printf
+		'quoted text' cd --verbose && sed "$1" export then --verbose then
+		test then local ${HOME} ${HOME} export "$@" then
+		then "$@" test 2>/dev/null then "$@"
+local test printf && then export grep x=1
+"$1" echo "$1" $(pwd) ${HOME} readonly $(pwd)
+--verbose 'quoted text' done local cd local
+test "$1" awk done printf /usr/bin ${HOME}
+	2>/dev/null x=1 test x=1
+		awk done grep x=1 --verbose printf sed local 2>/dev/null local
+		cd sed x=1 2>/dev/null -eu
+	test x=1 local export local local export cd --verbose echo -eu export
+grep /usr/bin then printf sed
+		| printf then echo "$@" awk ${HOME} "$@" printf
+		-eu 'quoted text' -eu "$1" awk x=1 "$1" cd printf
+		readonly /usr/bin ${HOME} "$@" done "$@" -eu awk readonly
+		"$@" printf export readonly sed local $(pwd) done echo test
+		then local printf export test readonly
+		done export "$@" 'quoted text' printf
+cd "$@" awk sed "$1" echo "$@" | && ${HOME} x=1 "$@" |
+	sed awk done /usr/bin done
+	echo echo 2>/dev/null -eu grep /usr/bin export export -eu 'quoted text'
+2>/dev/null echo grep && cd test awk 'quoted text' grep
+done 2>/dev/null ${HOME} local done --verbose cd $(pwd) cd x=1 --verbose
+2>/dev/null printf ${HOME} printf echo export 'quoted text'
+		test && done local printf done | x=1 &&
+		test && ${HOME} done grep
+	readonly test "$1" --verbose 2>/dev/null then awk 2>/dev/null "$1" echo
+		local /usr/bin x=1 -eu 2>/dev/null done ${HOME} && 'quoted text'
+grep printf 'quoted text' 2>/dev/null -eu
+'quoted text' 'quoted text'
+	printf sed $(pwd) 2>/dev/null readonly
+		export ${HOME} ${HOME} "$1" && printf export local
+		| awk readonly 'quoted text' && awk local 'quoted text' cd /usr/bin
+		| then /usr/bin | export 'quoted text' printf grep
+		then printf 2>/dev/null 2>/dev/null cd "$1"
+		printf $(pwd) echo 2>/dev/null
+&& cd "$@" $(pwd) cd | sed
+	--verbose && cd --verbose "$@" "$1"
+grep sed local --verbose readonly 2>/dev/null
+	$(pwd) printf "$1" export
+		$(pwd) 'quoted text' done --verbose
+		grep readonly --verbose cd printf
+	"$1" 2>/dev/null sed printf "$1" 2>/dev/null cd $(pwd) local local -eu $(pwd)
+		$(pwd) --verbose | printf
+readonly awk ${HOME} printf 2>/dev/null "$@" done sed "$1" | $(pwd) "$1" --verbose
+		'quoted text' /usr/bin local
+${HOME} echo --verbose
+--verbose export grep 'quoted text' then /usr/bin ${HOME}
+		-eu && echo awk local $(pwd) /usr/bin && ${HOME} awk printf grep readonly
+		${HOME} x=1 then printf sed readonly readonly
+		/usr/bin done x=1 awk && x=1 awk 'quoted text'
+		cd readonly local echo 'quoted text'
+		&& --verbose --verbose x=1 "$1" | 'quoted text' 2>/dev/null "$1" sed done echo 'quoted text'
+		$(pwd) readonly ${HOME}
+grep $(pwd) "$1" awk cd local then "$@" cd export $(pwd)
+sed "$1" cd echo local | x=1 readonly ${HOME} --verbose printf "$@" "$@"
+	done /usr/bin readonly sed 'quoted text'
+readonly --verbose local x=1 printf echo "$@" -eu test done && "$1" -eu "$@"
+	2>/dev/null awk cd 2>/dev/null
+		done $(pwd) | grep -eu
+test sed x=1 -eu readonly 'quoted text' $(pwd) --verbose
+	/usr/bin export 2>/dev/null local then echo done done export x=1 |
+awk cd | then 'quoted text' grep "$@" done 'quoted text'
+	/usr/bin awk 'quoted text'
+		&& printf test done then test x=1 $(pwd) && -eu ${HOME} "$@" 2>/dev/null
+local x=1 2>/dev/null printf printf readonly -eu
+	awk test grep 'quoted text' 2>/dev/null
+printf -eu then echo printf done grep 2>/dev/null
+	x=1 readonly --verbose done test $(pwd) x=1 -eu
+$(pwd) "$@" ${HOME} awk export local x=1 /usr/bin 2>/dev/null readonly
+printf echo export grep 2>/dev/null cd -eu x=1 | export then -eu x=1 $(pwd)
+local grep export echo
+"$1" export local readonly 'quoted text' "$@" test /usr/bin grep awk "$1"
+printf "$1" -eu printf x=1 &&
+	echo "$@" x=1 'quoted text' "$1" test && test sed -eu 2>/dev/null ${HOME} grep
+	${HOME} awk "$@" test ${HOME} grep
+	-eu 'quoted text' -eu "$1" then grep $(pwd) test "$1" ${HOME} && "$@"
+		readonly x=1 --verbose x=1
+		"$1" "$@" | cd export "$1" ${HOME}
+		cd ${HOME} ${HOME} $(pwd) cd /usr/bin
+		'quoted text' "$@" readonly
+		"$@" 2>/dev/null ${HOME} awk $(pwd) | test export -eu test
+	done test export x=1 "$@" -eu grep test sed 'quoted text' test && && ${HOME} "$1"
+	awk /usr/bin cd $(pwd) local "$1" readonly readonly
+	local ${HOME} "$@" sed | then echo local x=1 awk
+	readonly sed echo $(pwd) awk | printf && "$1"
+		$(pwd) $(pwd) "$1" then ${HOME} test done -eu printf "$1" export test
+'quoted text' sed printf printf $(pwd)
+		awk test test cd local test -eu $(pwd) export
+	test "$1" $(pwd) --verbose
+--verbose echo ${HOME} && export
+		sed ${HOME} x=1 x=1 $(pwd) 2>/dev/null
+		awk "$@" $(pwd) then /usr/bin /usr/bin
+&& -eu && then -eu done test ${HOME} "$1" grep cd ${HOME}
+	echo grep 2>/dev/null export export 2>/dev/null
+		-eu && --verbose 'quoted text' 'quoted text'
+	printf $(pwd) ${HOME} echo readonly 'quoted text'
+/usr/bin test $(pwd)
+	&& grep awk "$1" 2>/dev/null 'quoted text' grep done "$@" "$@"
+	-eu local -eu grep "$@" printf
+		done $(pwd) | local local
+"$1" "$@" -eu awk && 2>/dev/null "$@" ${HOME} 2>/dev/null cd 2>/dev/null &&
+		'quoted text' 2>/dev/null "$@" "$1" grep readonly
+		-eu ${HOME} awk export test $(pwd) sed then awk then
+	printf && cd echo awk sed --verbose cd local echo x=1
+	sed printf "$@" "$@" --verbose
+	${HOME} -eu then 'quoted text' 'quoted text' --verbose
+--verbose then grep test | -eu sed test
+		'quoted text' 2>/dev/null test test /usr/bin $(pwd) test awk local
+		then awk "$1" | cd 2>/dev/null
+then awk readonly export then export sed
+	${HOME} echo printf $(pwd) 2>/dev/null "$@" &&
+test ${HOME} test 'quoted text' "$@" && | 'quoted text' then grep grep
+		"$1" readonly ${HOME} done export awk
+-eu x=1 2>/dev/null export /usr/bin /usr/bin
+${HOME} awk sed 'quoted text' 'quoted text' --verbose "$@" /usr/bin $(pwd) 'quoted text'
+	then | grep printf sed x=1 done then x=1 local
+	"$@" export $(pwd) then ${HOME} export printf
+	printf 2>/dev/null export awk 'quoted text'
+export cd sed && | echo /usr/bin ${HOME} --verbose "$@" 2>/dev/null
+"$1" done readonly printf 2>/dev/null --verbose x=1 "$1" $(pwd)
+	test -eu echo done echo grep -eu test x=1 "$@" "$@" $(pwd)
+		$(pwd) cd x=1 cd | | x=1 export readonly -eu 2>/dev/null
+"$@" local "$@" awk --verbose grep echo && export awk grep export awk then
+done export test /usr/bin 2>/dev/null readonly grep 'quoted text' --verbose
+		/usr/bin test | | ${HOME} cd ${HOME}
+2>/dev/null printf awk x=1 /usr/bin "$@" 'quoted text'
+echo /usr/bin && x=1
+-eu printf then then "$1" "$1" 'quoted text' "$1" "$@" local
+		${HOME} -eu done "$@" grep "$1" "$1" ${HOME} local x=1 2>/dev/null
+	| sed then grep -eu grep /usr/bin export then 'quoted text' x=1
+	grep echo then /usr/bin $(pwd) | test printf && $(pwd)
+	&& printf then ${HOME} readonly /usr/bin echo && -eu
+		grep ${HOME} --verbose 2>/dev/null
+		export grep 2>/dev/null printf -eu local && "$@" awk cd /usr/bin local
+		readonly "$1" readonly done then |
+grep && 2>/dev/null --verbose
+		${HOME} done readonly sed done $(pwd)
+	$(pwd) | local done readonly
+printf export "$1" local cd ${HOME} cd "$@" && test && export
+		echo 2>/dev/null -eu local sed --verbose -eu sed
+		then "$@" $(pwd) export then grep /usr/bin export
+	grep local /usr/bin | "$1" export
+	'quoted text' awk cd ${HOME} local then printf test sed done --verbose
+	&& "$@" sed echo sed readonly x=1 awk export readonly
+	grep test local test printf done printf
+	-eu ${HOME} /usr/bin "$1" | -eu && && export awk | "$1" local printf grep "$1"
+		/usr/bin "$@" then 'quoted text'
+	readonly $(pwd) sed /usr/bin test 2>/dev/null
+	| grep awk $(pwd) printf echo local then cd sed $(pwd) "$1" done "$@" ${HOME}
+	&& local cd then x=1 && sed cd x=1 readonly
+"$@" cd --verbose 2>/dev/null test
+export done 2>/dev/null local /usr/bin $(pwd) x=1 -eu readonly export
+	readonly | done "$@" done
+	'quoted text' --verbose export x=1 sed "$@" cd awk /usr/bin -eu "$@" 2>/dev/null
+	printf 'quoted text' echo local 'quoted text' local /usr/bin
+export "$1" "$@" && then readonly -eu x=1 ${HOME} done sed sed then | 'quoted text'
+	readonly "$@" grep then cd echo local
+	readonly "$1" /usr/bin export 'quoted text'
+2>/dev/null test ${HOME}
+test ${HOME} -eu cd | -eu then "$@" $(pwd) $(pwd) --verbose local
+	-eu -eu readonly then x=1 sed
+	awk printf readonly &&
+done /usr/bin && local "$@" then x=1 cd done 'quoted text'
+done 'quoted text' grep 2>/dev/null
+		"$@" | local printf && echo /usr/bin "$@" 'quoted text'
+	"$@" x=1 "$1" awk awk x=1 && 2>/dev/null && test $(pwd) local readonly awk done
+		x=1 ${HOME} cd test local $(pwd) ${HOME} printf --verbose
+"$@" local printf cd 'quoted text' then $(pwd) sed printf echo then export
+		readonly -eu $(pwd) 'quoted text' /usr/bin /usr/bin "$1" local "$1" then
+		2>/dev/null 'quoted text' grep /usr/bin local then ${HOME} grep export 2>/dev/null
+"$@" && done ${HOME} grep "$1" 2>/dev/null export export grep export
+	done && test --verbose "$@" | /usr/bin && readonly sed readonly
+readonly -eu cd --verbose readonly /usr/bin
+	echo test /usr/bin $(pwd) echo && && $(pwd) x=1 done test then 'quoted text'
+export echo 2>/dev/null local "$@" $(pwd) 2>/dev/null
+	cd grep then "$@" | $(pwd) -eu then then awk "$1" cd | local
+	awk "$1" /usr/bin 2>/dev/null "$1" ${HOME} x=1 then echo test local
+		x=1 && 'quoted text' 2>/dev/null 'quoted text'
+	grep $(pwd) "$1" awk
+	awk grep 2>/dev/null local then && test cd sed "$1" "$1" awk "$@" "$@" 'quoted text'
+then printf local grep ${HOME} printf -eu $(pwd) then grep cd
+	test --verbose x=1 export export "$@"
+test local awk ${HOME} | "$@" readonly -eu ${HOME} 2>/dev/null test grep
+		cd "$@" test awk test then x=1 "$1" 2>/dev/null
+&& export --verbose 2>/dev/null "$@" echo awk 'quoted text'
+done $(pwd) awk x=1 cd test
+readonly && 'quoted text' 'quoted text'
+sed && /usr/bin --verbose /usr/bin test && then printf && done
+		then export "$@" 2>/dev/null "$@" $(pwd)
+		awk x=1 ${HOME} 2>/dev/null
+	x=1 /usr/bin && cd readonly local x=1 local awk then 2>/dev/null printf
+"$1" 2>/dev/null local printf then sed sed grep x=1
+		readonly local printf ${HOME} grep "$@"
+		--verbose export -eu "$@" $(pwd) 'quoted text'
+readonly local sed 'quoted text'
+x=1 cd $(pwd) /usr/bin grep "$1" $(pwd) printf test /usr/bin --verbose
+	2>/dev/null grep printf grep 'quoted text' readonly cd && cd "$1" export
+	'quoted text' printf 'quoted text' done then test
+	grep | $(pwd) "$@" -eu | done export --verbose local
+		/usr/bin echo done then sed | "$@"
+	grep printf cd x=1 cd ${HOME} readonly echo
+	"$1" export "$@" && done cd printf 2>/dev/null export sed
+echo test x=1 -eu | 'quoted text' 'quoted text'
+	export export local awk /usr/bin cd 2>/dev/null 'quoted text' ${HOME}
+${HOME} 'quoted text' test test
+		| -eu awk --verbose grep then awk /usr/bin -eu local -eu /usr/bin x=1 ${HOME}
+	$(pwd) sed x=1 awk "$@" readonly "$1" | -eu -eu
+${HOME} cd readonly test export sed -eu cd local && "$1" 'quoted text' ${HOME}
+		| 2>/dev/null /usr/bin 'quoted text' export 'quoted text'
+| "$1" readonly then $(pwd) ${HOME} local x=1 grep cd ${HOME} sed -eu 'quoted text'
+${HOME} test /usr/bin echo /usr/bin
+		-eu -eu x=1 --verbose sed echo -eu 'quoted text'
+x=1 readonly export && ${HOME} -eu test $(pwd)
+readonly /usr/bin local --verbose echo echo local "$@" && 2>/dev/null
+"$1" && echo then export test
+		readonly grep "$@" awk
+${HOME} /usr/bin local then then done x=1 'quoted text'
+	-eu test 2>/dev/null awk echo 2>/dev/null
+	done local && --verbose sed x=1
+-eu $(pwd) cd /usr/bin grep $(pwd) readonly /usr/bin --verbose $(pwd)
+		echo grep then "$@" sed readonly grep ${HOME}
+		cd awk -eu awk awk printf
+sed sed then x=1 echo -eu $(pwd) export && sed export readonly readonly
+x=1 then grep x=1 && echo x=1 test cd /usr/bin "$1"
+	awk --verbose printf /usr/bin printf test awk sed $(pwd)
+| /usr/bin then printf grep && $(pwd) awk
+--verbose grep local 2>/dev/null && then -eu /usr/bin -eu local export echo "$1"
+		2>/dev/null done done then 2>/dev/null 2>/dev/null cd | ${HOME} test printf $(pwd)
+		done x=1 ${HOME} x=1 readonly cd awk export printf
+		local $(pwd) 2>/dev/null sed "$@"
+test sed printf grep awk x=1 "$@" 'quoted text' x=1 printf x=1 | --verbose
+echo sed $(pwd) 2>/dev/null x=1 2>/dev/null test "$@"
+-eu ${HOME} export awk sed then grep sed readonly --verbose -eu 2>/dev/null | sed
+		-eu echo awk grep sed then && | /usr/bin
+readonly printf "$@" readonly
+	awk cd awk then 2>/dev/null local test export $(pwd) "$@" echo |
+		sed grep readonly cd 'quoted text'
+	echo $(pwd) ${HOME} printf "$1" ${HOME} --verbose
+		/usr/bin echo local /usr/bin export | --verbose
+	| awk awk test --verbose readonly printf local 'quoted text'
+		--verbose ${HOME} --verbose local | done then
+"$1" then sed $(pwd) "$@" $(pwd)
+-eu done grep "$@" readonly cd local done export then
+/usr/bin readonly test done readonly
+	export ${HOME} echo grep --verbose test echo cd ${HOME} /usr/bin done
+		done sed /usr/bin cd then grep
+	| then x=1 export then then
+	then | "$@" --verbose 'quoted text' cd readonly sed
+	readonly && ${HOME} awk
+printf 2>/dev/null 'quoted text' then x=1 ${HOME} cd readonly
+	"$1" ${HOME} | "$1" test printf "$1" readonly cd 'quoted text'
+x=1 ${HOME} grep awk then export 'quoted text' $(pwd)
+		done cd done -eu printf export
+		export | echo cd "$@" sed sed "$1" -eu | 2>/dev/null
+		then -eu grep export /usr/bin awk &&
+${HOME} test test x=1 test awk cd sed "$1" grep sed sed printf --verbose
+		--verbose "$1" $(pwd) then | --verbose
+	done done awk local $(pwd) /usr/bin printf local
+		local 'quoted text' 'quoted text' test grep echo $(pwd) "$1"
+	&& echo printf 2>/dev/null local local 2>/dev/null "$@" cd 2>/dev/null
+	echo local $(pwd) cd |
+		-eu "$@" echo echo printf x=1
+local done test --verbose test |
+		grep ${HOME} readonly local 'quoted text' "$1" "$@" export "$1" "$@"
+	&& done --verbose readonly grep local "$1" sed readonly
+	sed "$1" && printf /usr/bin x=1 then readonly 2>/dev/null then done $(pwd)
+	printf cd ${HOME} cd local echo x=1 /usr/bin $(pwd) readonly | && export then
+		${HOME} grep 2>/dev/null "$1" done
+	x=1 $(pwd) $(pwd) readonly local done then
+		grep sed x=1 -eu x=1 sed "$1" cd awk /usr/bin done grep && &&
+	echo done readonly test echo cd -eu local $(pwd)
+'quoted text' done grep --verbose then echo "$@" then --verbose
+		/usr/bin 'quoted text' then "$@" local test echo printf "$@" && && sed readonly
+	-eu done x=1 'quoted text' && cd awk | --verbose | grep awk export
+	'quoted text' test "$@" /usr/bin grep test awk
+	cd cd printf "$@" ${HOME} /usr/bin && cd echo
+		-eu done test done 'quoted text' echo
+printf export echo -eu | ${HOME} done -eu 2>/dev/null 'quoted text' "$@" readonly
+		--verbose test && && printf "$1"
+grep local /usr/bin cd sed sed "$1" cd 2>/dev/null
+	then readonly then --verbose 'quoted text' cd export test && "$@" printf
+	readonly $(pwd) readonly awk sed "$1" awk 2>/dev/null -eu /usr/bin sed test
+		&& "$@" grep then ${HOME} && grep then | printf done
+	$(pwd) 2>/dev/null sed "$@" $(pwd)
+		x=1 done sed test && local "$@" export $(pwd) "$1" export export readonly
+		export "$@" 'quoted text' --verbose printf | "$1"
+	export printf && && echo | local
+awk awk 'quoted text' grep local ${HOME} -eu readonly "$@" x=1 /usr/bin
+x=1 then | export grep done printf | -eu echo
+cd 'quoted text' awk done 2>/dev/null grep done cd 'quoted text'
+"$@" then export ${HOME} export /usr/bin
+		-eu "$@" export awk && test | printf
+		done -eu "$1" ${HOME} -eu sed awk then "$1"
+	then test export done 2>/dev/null test local && sed ${HOME}
+/usr/bin "$@" x=1 $(pwd) then 2>/dev/null 2>/dev/null
+$(pwd) | export then 'quoted text' $(pwd) 'quoted text' test 'quoted text'
+/usr/bin grep test done done test readonly
+	-eu x=1 --verbose local echo export /usr/bin
+		readonly grep "$1" printf 'quoted text' | --verbose "$@" done
+	'quoted text' --verbose readonly ${HOME} -eu && cd ${HOME} --verbose $(pwd)
+	echo cd readonly printf ${HOME} local $(pwd) x=1
+"$@" "$@" awk 2>/dev/null
+	| $(pwd) $(pwd) echo --verbose 'quoted text'
+local local /usr/bin /usr/bin "$1" printf
+		readonly awk x=1 "$1" test 'quoted text'
+		grep done 'quoted text' then printf 'quoted text' $(pwd) --verbose awk
+-eu /usr/bin local -eu 'quoted text' local /usr/bin "$1" printf
+cd printf ${HOME} printf done printf test awk x=1
+		printf test export 2>/dev/null readonly | test printf | awk --verbose
+	local local $(pwd) echo then
+		done awk awk "$1" readonly ${HOME}
+	"$@" export /usr/bin readonly
+readonly test cd x=1 | "$@" echo $(pwd) /usr/bin "$@" "$@" printf
+	'quoted text' /usr/bin printf then done readonly awk grep
+		'quoted text' awk done test readonly /usr/bin export
+export cd then ${HOME} cd --verbose -eu "$@" printf local export
+-eu 2>/dev/null awk grep echo printf x=1
+		&& ${HOME} 2>/dev/null x=1
+		readonly "$1" cd export -eu "$@" test 2>/dev/null then
+--verbose grep done printf local && test cd
+	readonly local readonly then cd "$1" grep && awk done
+awk done /usr/bin ${HOME} /usr/bin
+"$@" export export ${HOME} echo cd export x=1 echo 'quoted text'
+cd grep awk -eu readonly export awk
+		x=1 ${HOME} x=1 test cd echo then | /usr/bin printf | test
+	printf "$1" test test 2>/dev/null
+		echo x=1 printf 'quoted text' 2>/dev/null
+		printf readonly test export 'quoted text' sed test sed "$@" 'quoted text' echo &&
+		${HOME} x=1 --verbose
+	-eu 2>/dev/null ${HOME} 'quoted text'
+		test | export -eu $(pwd) "$1" cd test $(pwd) | readonly grep
+sed "$1" 2>/dev/null 2>/dev/null cd -eu 'quoted text'
+		echo echo echo 'quoted text'
+		awk echo local "$1" "$1" 2>/dev/null
+test -eu | "$1" cd test "$1"
+	printf 2>/dev/null -eu $(pwd)
+readonly x=1 ${HOME} local ${HOME}
+		echo done echo then readonly ${HOME} -eu readonly x=1 test
+		test readonly sed 2>/dev/null printf
+		$(pwd) test 'quoted text' test sed /usr/bin /usr/bin
+		| x=1 2>/dev/null done -eu test -eu awk test && 2>/dev/null then then && awk echo
+	awk awk "$1" $(pwd) readonly
+	echo $(pwd) echo | printf | done x=1 readonly awk 2>/dev/null x=1 'quoted text'
+		&& x=1 "$1" awk grep echo x=1 | ${HOME} 'quoted text'
+awk -eu $(pwd) "$@" -eu readonly cd -eu $(pwd)
+	echo -eu test local --verbose
+	x=1 | "$@" local && done local 'quoted text' awk cd -eu
+	| cd echo --verbose export && ${HOME}
+grep ${HOME} sed printf $(pwd)
+	test local 2>/dev/null /usr/bin $(pwd) "$1" 'quoted text' printf
+		| 'quoted text' export ${HOME} done then $(pwd) | awk then printf
+	--verbose -eu $(pwd) -eu awk done grep echo echo echo
+	"$@" && --verbose done "$@" done export awk grep $(pwd) -eu $(pwd) ${HOME} "$1"
+	/usr/bin 'quoted text' then echo $(pwd)
+		$(pwd) then -eu /usr/bin "$@" grep then printf cd
+		then then 'quoted text' -eu "$@" | local done cd awk -eu 'quoted text' "$@" awk
+	test echo --verbose $(pwd) done $(pwd) test awk awk 'quoted text'
+	--verbose awk test test
+		| $(pwd) sed readonly grep awk
+	printf --verbose 'quoted text' "$@" awk "$1" $(pwd) cd printf /usr/bin
+x=1 readonly readonly then cd "$1"
+		grep /usr/bin printf awk --verbose cd export | awk
+sed done $(pwd) done x=1 x=1 readonly readonly export ${HOME} grep
+		grep local awk 'quoted text' | x=1
+		"$@" ${HOME} 'quoted text' x=1 done ${HOME} test awk && $(pwd) x=1 --verbose "$@"
+echo readonly 2>/dev/null "$1" $(pwd) done grep "$1" grep "$1" | awk
+		sed ${HOME} test echo printf awk "$1" 'quoted text' /usr/bin cd then test echo
+	awk awk "$1" $(pwd) then -eu $(pwd) printf $(pwd)
+		printf readonly $(pwd) | ${HOME} awk 'quoted text' "$@" && x=1 cd 2>/dev/null
+		local /usr/bin "$@" ${HOME} then &&
+printf sed test -eu && 'quoted text' printf "$@" grep 2>/dev/null | sed "$@"
+		"$@" awk grep readonly $(pwd) then
+		local | /usr/bin then "$@" sed "$1" -eu "$@" /usr/bin awk
+		--verbose grep $(pwd) echo 'quoted text'
+	awk -eu export "$@" sed $(pwd) export sed awk
+"$@" printf grep test printf --verbose 'quoted text'
+"$1" /usr/bin sed /usr/bin readonly echo "$1" awk --verbose "$1"
+grep && local 2>/dev/null $(pwd) --verbose
+		test echo && sed printf awk local sed cd &&
+	/usr/bin $(pwd) local "$@" awk export sed local cd readonly
+	&& | | 'quoted text' x=1
+		local "$1" sed /usr/bin "$@" 2>/dev/null readonly "$1" "$1" ${HOME} grep
+		then /usr/bin awk 2>/dev/null $(pwd) 2>/dev/null x=1 done sed --verbose sed local
+printf | 'quoted text' printf 'quoted text' "$1" | 2>/dev/null "$1" 'quoted text'
+		-eu awk sed 2>/dev/null ${HOME}
+	x=1 grep then then sed local --verbose printf "$@" done --verbose
+local --verbose sed sed 'quoted text' readonly export "$1" grep /usr/bin sed
+	/usr/bin test awk readonly "$1" 2>/dev/null test readonly
+/usr/bin cd local export "$@" done sed printf -eu printf local export -eu
+	local awk /usr/bin $(pwd) sed test /usr/bin 'quoted text'
+	/usr/bin cd printf | then x=1 $(pwd) grep then
+export printf 'quoted text' test
+printf echo && done local "$@" | readonly
+		readonly export 2>/dev/null x=1 local local --verbose echo 'quoted text'
+&& 2>/dev/null -eu readonly
+awk test 'quoted text' done --verbose readonly | printf test then awk done
+	'quoted text' | --verbose --verbose
+"$@" --verbose -eu | sed 2>/dev/null
+local printf printf 'quoted text' sed -eu local grep then
+grep 'quoted text' | -eu then printf then test done local local readonly grep
+	/usr/bin test sed local $(pwd) cd
+		export ${HOME} sed 2>/dev/null 'quoted text'
+2>/dev/null awk readonly echo printf sed then printf ${HOME} "$@" 'quoted text'
+'quoted text' export --verbose readonly sed cd 'quoted text' -eu
+grep local done printf awk test then | printf
+local && 'quoted text' then
+$(pwd) then readonly awk | export
+		test echo done readonly local readonly --verbose sed sed | /usr/bin echo export
+	/usr/bin then cd | awk $(pwd) awk sed --verbose --verbose "$@" readonly sed
+		--verbose $(pwd) $(pwd) -eu grep
+		awk cd | test && export
+	printf cd done 2>/dev/null --verbose -eu "$1" 2>/dev/null $(pwd)
+	x=1 /usr/bin | echo "$@" sed local
+		printf printf done 'quoted text'
+	readonly "$1" /usr/bin grep cd echo test
+local local sed grep x=1 sed "$@"
+		sed done && x=1 x=1 local $(pwd) x=1 | printf | grep
+	echo local done --verbose cd x=1 x=1
+${HOME} && test x=1 readonly 'quoted text' sed export /usr/bin
+	"$1" /usr/bin awk then --verbose
+test -eu && awk grep && export 'quoted text' export export sed x=1 ${HOME} 'quoted text'
+	/usr/bin | x=1 && --verbose 2>/dev/null
+"$@" echo echo sed printf /usr/bin "$@" local "$@" sed -eu "$@" local &&
+		2>/dev/null echo echo local test done && readonly /usr/bin | test "$1" done sed
+sed echo test awk $(pwd) done $(pwd)
+	export done export grep sed sed /usr/bin /usr/bin done 'quoted text'
+		awk 'quoted text' awk ${HOME} cd "$1" 'quoted text' $(pwd) done then x=1
+cd readonly local 'quoted text' export cd readonly readonly
+	&& export && 'quoted text' "$@" 'quoted text'
+		awk -eu /usr/bin printf test readonly sed && | 2>/dev/null
+awk x=1 export test | --verbose ${HOME} done local "$@" awk 'quoted text' ${HOME}
+echo local then "$@" echo awk "$1" done $(pwd) --verbose
+		/usr/bin "$1" --verbose | --verbose && awk cd 'quoted text' grep done sed "$1"
+		&& /usr/bin x=1 "$1" cd x=1 -eu local && "$@" then "$@" cd $(pwd)
+export sed "$@" done | "$@" export done &&
+| 2>/dev/null ${HOME} x=1 -eu -eu done "$@" grep x=1 awk "$@" echo
+		"$1" export sed printf readonly
+	cd | x=1 printf cd ${HOME} awk && 2>/dev/null -eu $(pwd)
+		awk export 'quoted text' then "$@" 2>/dev/null echo sed awk done export done
+		/usr/bin echo --verbose && $(pwd) && "$@" printf | grep export 2>/dev/null export
+'quoted text' ${HOME} grep
+		local printf ${HOME} | grep /usr/bin grep readonly $(pwd) cd x=1 "$@"
+	2>/dev/null then --verbose test x=1 sed 2>/dev/null 'quoted text' test ${HOME}
+		sed "$1" done test echo printf readonly x=1
+		readonly "$@" "$@" -eu
+test "$1" --verbose $(pwd) | export 'quoted text' --verbose
+--verbose cd sed export readonly
+export echo test && "$@" done "$@"
+		"$1" "$1" sed 'quoted text'
+		readonly printf $(pwd)
+		echo printf ${HOME} $(pwd) "$@" "$@" grep printf $(pwd)
+	then ${HOME} printf awk
+		sed printf readonly $(pwd)
+		grep printf $(pwd) 'quoted text' export
+sed 'quoted text' sed | cd | local then cd grep /usr/bin test local
+test --verbose "$@" local x=1 'quoted text' "$@" printf
+		printf echo x=1 done -eu local sed ${HOME} "$@" --verbose done
+	2>/dev/null echo "$1" "$@" printf export echo --verbose awk cd --verbose
+		${HOME} then local -eu | "$1" done test
+-eu "$1" sed grep $(pwd) sed readonly
+		echo $(pwd) export | "$1" readonly /usr/bin export grep test x=1 -eu local
+		export 2>/dev/null cd test | 'quoted text' awk cd
+	awk readonly export | local $(pwd) "$@" sed
+	${HOME} 2>/dev/null export 2>/dev/null export local --verbose ${HOME}
+		&& x=1 2>/dev/null printf "$1" /usr/bin then export -eu 'quoted text'
+	x=1 /usr/bin sed "$@" $(pwd) 2>/dev/null grep awk
+echo then -eu ${HOME} -eu $(pwd) 2>/dev/null done test &&
+	sed printf "$@" then $(pwd)
+x=1 --verbose test local printf cd -eu printf && test | | "$@" echo /usr/bin
+		--verbose -eu then echo awk x=1 && test grep local 2>/dev/null printf
+'quoted text' 'quoted text' x=1 "$1" local cd 2>/dev/null
+	'quoted text' test test /usr/bin export -eu ${HOME} done
+		"$@" 'quoted text' then test cd
+test $(pwd) awk $(pwd) echo export
+	then export "$@" /usr/bin $(pwd) readonly x=1 -eu x=1 sed echo "$1"
+	printf | test export test cd /usr/bin echo cd sed /usr/bin export | cd $(pwd)
+		'quoted text' done --verbose x=1 $(pwd) x=1 local grep local 2>/dev/null 'quoted text'
+x=1 -eu export "$@" done x=1 "$@" cd x=1
+		$(pwd) readonly "$@" $(pwd) $(pwd)
+		echo | printf cd /usr/bin test 2>/dev/null awk && echo -eu
+	grep && done 'quoted text' ${HOME} "$1" && x=1 export cd --verbose
+	echo | readonly printf -eu readonly echo 2>/dev/null 2>/dev/null --verbose
+| printf local --verbose && printf done then grep sed then
+	awk "$@" done ${HOME} then readonly done test then ${HOME} 'quoted text'
+	"$1" x=1 printf cd "$1" readonly sed sed grep echo sed 2>/dev/null
+cd && "$1" $(pwd) --verbose "$@" grep 'quoted text'
+		&& x=1 printf | --verbose sed ${HOME} local cd "$@" test -eu "$1" cd /usr/bin 'quoted text'
+		x=1 && export | readonly cd $(pwd) readonly printf echo &&
+		grep export test | | test awk $(pwd) grep
+echo "$@" local then --verbose --verbose test
+test /usr/bin test local x=1 "$1" 2>/dev/null ${HOME} 2>/dev/null
+	$(pwd) readonly x=1 2>/dev/null awk && printf | /usr/bin
+	cd then $(pwd) | -eu echo 2>/dev/null cd then local
+		export export "$1" --verbose $(pwd) printf done 2>/dev/null test "$@" cd --verbose
+		x=1 $(pwd) -eu /usr/bin sed /usr/bin local sed then "$1"
+		"$1" printf printf "$1" | | --verbose sed grep cd 2>/dev/null x=1 readonly
+	grep 2>/dev/null ${HOME} $(pwd) "$1"
+	export /usr/bin done done local then sed
+	2>/dev/null test --verbose export
+		"$1" cd echo test local 'quoted text'
+	export local done | cd sed ${HOME} "$1" done grep test x=1
+| test readonly awk printf cd ${HOME} cd sed
+	done then 'quoted text' echo && echo
+		grep done awk local awk --verbose -eu done cd -eu awk "$1" done "$@" done
+		then /usr/bin printf | sed done export && 'quoted text'
+	local sed readonly grep | | -eu grep cd 2>/dev/null --verbose 'quoted text'
+	${HOME} "$@" ${HOME} -eu export 2>/dev/null export readonly local x=1 test awk
+local test local grep test "$1" readonly
+	cd done -eu cd -eu 'quoted text'
+	test x=1 readonly 'quoted text' local
+	${HOME} sed "$@" test cd 'quoted text'
+	2>/dev/null --verbose "$1" /usr/bin 2>/dev/null
+then x=1 local ${HOME} printf 2>/dev/null 2>/dev/null export readonly /usr/bin
+		readonly awk 'quoted text'
+		$(pwd) grep local echo x=1 printf local cd test sed x=1 $(pwd)
+	--verbose done 2>/dev/null
+readonly test 2>/dev/null --verbose then grep --verbose done /usr/bin
+#include c100.sh
+then "$@" printf "$1" cd readonly export ${HOME} 2>/dev/null export then | grep
+--verbose cd local x=1 export sed && printf $(pwd) "$@" "$@" then cd
+done --verbose "$@" "$1" then ${HOME} local x=1 awk /usr/bin --verbose local
+'quoted text' then 'quoted text' -eu echo $(pwd) ${HOME} "$1" printf
+	then && done --verbose
+	"$@" readonly awk sed $(pwd) 'quoted text' local x=1 readonly | 2>/dev/null "$@"
+		${HOME} 2>/dev/null x=1 | export printf "$1" test done -eu
+		$(pwd) ${HOME} done | readonly
+	grep | | printf done "$@" 2>/dev/null 'quoted text' echo
+	sed awk $(pwd) $(pwd) export "$@" export &&
+local /usr/bin --verbose sed
+	test printf local ${HOME} local -eu 'quoted text' readonly "$@"
+sed readonly x=1 grep awk export | "$@" sed readonly 'quoted text'
+	echo "$@" /usr/bin cd --verbose ${HOME} $(pwd) printf then
+		&& | -eu $(pwd) echo cd "$1" readonly | echo && 'quoted text' $(pwd) "$1"
+		grep /usr/bin grep printf grep x=1 sed readonly "$1"
+		export then -eu 'quoted text'
+	echo x=1 sed grep /usr/bin --verbose | done /usr/bin --verbose
+echo sed 2>/dev/null "$1" --verbose /usr/bin then ${HOME} "$@" awk sed awk
+printf ${HOME} awk "$1"
+grep ${HOME} test 'quoted text' && | grep
+/usr/bin 'quoted text' test printf x=1 sed sed | --verbose && local /usr/bin
+readonly readonly export
+		$(pwd) printf local local readonly |
+		| ${HOME} /usr/bin "$@" printf awk $(pwd) printf | ${HOME} /usr/bin $(pwd)
+grep awk "$1" "$1" 'quoted text' $(pwd) --verbose 2>/dev/null
+$(pwd) cd -eu "$@" | /usr/bin -eu 2>/dev/null
+"$1" -eu --verbose export cd echo --verbose cd test
+	${HOME} 2>/dev/null test local sed cd -eu | | -eu -eu
+	| "$1" grep printf cd && readonly readonly readonly
+| awk done 2>/dev/null
+	readonly echo awk | -eu $(pwd) local awk "$@" "$1" awk cd
+$(pwd) printf printf "$@" done
+		cd local local echo && ${HOME}
+		local awk 2>/dev/null then export sed
+--verbose local $(pwd) grep echo "$@" 2>/dev/null ${HOME} done test
+	test test awk -eu then 2>/dev/null done export
+		echo /usr/bin grep grep readonly
+	test local 'quoted text' && awk | 2>/dev/null ${HOME}
+		readonly 'quoted text' then x=1 echo
+printf ${HOME} && export /usr/bin "$@" --verbose -eu echo cd && done $(pwd)
+	| echo done grep 'quoted text' readonly readonly
+		$(pwd) test cd done $(pwd) /usr/bin echo
+	&& grep 'quoted text' | readonly 2>/dev/null /usr/bin export x=1 awk | cd x=1 done
+		done --verbose ${HOME} test && echo -eu
+		export done "$1" "$1" 2>/dev/null done /usr/bin awk echo cd readonly
+		sed --verbose then readonly
+${HOME} && --verbose | export local "$@"
+	| printf printf done | export then done
+awk readonly "$@" then echo cd awk "$1" readonly local local
+		sed /usr/bin echo /usr/bin printf | "$@" cd 2>/dev/null
+		awk "$@" /usr/bin echo readonly "$@" test /usr/bin x=1
+grep awk ${HOME} test 'quoted text' sed
+	sed cd ${HOME} local 'quoted text'
+		done | cd | awk ${HOME} awk x=1 cd 2>/dev/null 2>/dev/null $(pwd) 'quoted text'
+awk x=1 2>/dev/null export cd then sed grep sed ${HOME} 'quoted text' sed
+	2>/dev/null export --verbose --verbose "$@" && 2>/dev/null grep
+awk 2>/dev/null awk echo | awk x=1 x=1 /usr/bin "$1" /usr/bin grep
+-eu 2>/dev/null ${HOME} awk 'quoted text'
+		cd awk ${HOME} grep "$1" 'quoted text' "$1" export 2>/dev/null "$@"
+	| "$1" sed printf "$@" "$@" local $(pwd) then
+	/usr/bin echo ${HOME} -eu /usr/bin then awk local done "$1" "$@" 2>/dev/null
+	"$1" $(pwd) "$@" export 'quoted text' 2>/dev/null echo | echo -eu grep sed --verbose
+	sed 2>/dev/null done echo echo then "$@" "$@" 2>/dev/null "$@" --verbose cd
+		${HOME} x=1 cd x=1 printf 2>/dev/null | test
+/usr/bin "$@" 'quoted text' $(pwd) local readonly awk 2>/dev/null cd
+		cd local cd && --verbose done $(pwd) | sed | 2>/dev/null && readonly test
+		/usr/bin $(pwd) ${HOME} ${HOME} -eu --verbose printf ${HOME} /usr/bin /usr/bin
+	echo /usr/bin then --verbose
+done "$@" echo readonly ${HOME} printf readonly
+		&& /usr/bin "$1" --verbose -eu printf && readonly export local export "$1"
+readonly done then x=1 export -eu printf local "$1"
+		done 'quoted text' echo export | ${HOME} -eu "$@" | x=1 "$@" | "$@"
+"$1" && ${HOME} --verbose readonly ${HOME}
+		"$@" ${HOME} && 2>/dev/null && ${HOME} cd cd test 'quoted text' 2>/dev/null
+"$@" export $(pwd) local x=1 test "$@" then | test ${HOME} readonly --verbose
+		echo cd 'quoted text' printf cd sed $(pwd) $(pwd) | | /usr/bin
+	printf grep --verbose 'quoted text' done --verbose 2>/dev/null
+		export $(pwd) awk printf export cd --verbose awk
+	&& echo -eu done export done printf export export && "$1" 2>/dev/null
+"$1" | && && /usr/bin
+		echo 'quoted text' -eu ${HOME} grep "$1"
+	2>/dev/null sed x=1 'quoted text'
+		${HOME} -eu "$1" echo local sed echo test
+	local && && /usr/bin
+		done "$1" test --verbose readonly then
+	$(pwd) local printf done x=1 $(pwd) /usr/bin awk
+	"$@" 'quoted text' 2>/dev/null grep echo awk 'quoted text' local export
+echo local test grep sed
+--verbose /usr/bin "$@" && "$1" grep
+--verbose readonly then cd &&
+		/usr/bin "$1" "$@" "$@" cd grep echo "$@" cd cd readonly export --verbose 'quoted text'
+		${HOME} 'quoted text' done
+then test "$@" export 2>/dev/null done awk printf && /usr/bin then echo
+	-eu | echo --verbose $(pwd) printf 'quoted text' $(pwd) echo
+&& $(pwd) sed && --verbose awk printf /usr/bin | 2>/dev/null done
+		$(pwd) --verbose ${HOME} sed export "$1" then done x=1 cd x=1 sed then /usr/bin
+	cd --verbose echo --verbose
+		${HOME} ${HOME} && $(pwd) && done --verbose test -eu -eu done /usr/bin
+	/usr/bin 'quoted text' test && --verbose --verbose
+		$(pwd) x=1 echo done done $(pwd)
+		2>/dev/null 2>/dev/null 2>/dev/null
+	--verbose "$1" then readonly
+printf awk | echo local local /usr/bin grep 'quoted text' && then
+awk readonly "$@" -eu printf then 'quoted text' ${HOME} echo "$1"
+	'quoted text' ${HOME} cd cd printf x=1 && | "$@" "$1" echo readonly /usr/bin
+		then | 2>/dev/null $(pwd) echo && ${HOME} sed local -eu | | "$1" echo
+		export done grep grep awk | sed "$@"
+		awk --verbose -eu "$1" 'quoted text' | printf sed export
+	export grep test export readonly test test
+-eu local local printf && $(pwd)
+'quoted text' | done readonly echo 'quoted text'
+		x=1 awk printf test echo "$@" then /usr/bin
+	&& "$@" done "$@" test done then "$1"
+	done cd -eu $(pwd) export && "$@" |
+-eu 2>/dev/null | done sed 'quoted text' --verbose -eu /usr/bin
+		cd sed -eu readonly test
+sed && && printf 'quoted text' done | grep $(pwd) awk printf local done &&
+		test sed grep echo --verbose echo "$@" x=1 cd 2>/dev/null awk readonly | done
+		grep --verbose ${HOME} then "$@" grep 2>/dev/null local printf
+		export x=1 awk 2>/dev/null --verbose cd | ${HOME} && test printf -eu
+	export "$1" && test test "$@" /usr/bin sed echo test /usr/bin 2>/dev/null
+-eu 'quoted text' --verbose "$@" --verbose grep local
+	local | -eu printf --verbose local local 2>/dev/null
+		local "$1" done | && ${HOME} -eu grep x=1 x=1 $(pwd)
+	local && "$@" $(pwd) $(pwd) sed grep $(pwd) then cd cd ${HOME}
+	local cd printf 'quoted text' then /usr/bin cd && ${HOME} sed 2>/dev/null
+echo echo export x=1
+$(pwd) then cd x=1 echo
+	| then 'quoted text' echo grep 'quoted text' "$1"
+	$(pwd) export readonly sed 2>/dev/null
+	sed awk --verbose test cd awk
+		x=1 echo awk --verbose grep printf "$@" $(pwd) sed test then
+	${HOME} grep ${HOME} then
+	x=1 sed test printf sed printf
+echo && then cd readonly ${HOME} awk test awk readonly
+	printf "$1" "$1" cd local ${HOME} then && x=1 then 'quoted text' "$1" grep printf
+		awk 'quoted text' grep
+sed printf ${HOME} local echo -eu $(pwd) sed
+"$@" && --verbose 2>/dev/null | sed "$1" sed sed readonly local /usr/bin $(pwd)
+	awk /usr/bin --verbose
+printf "$1" "$1" printf readonly 'quoted text'
+	-eu echo --verbose $(pwd) "$1" && --verbose readonly
+	--verbose x=1 | -eu test local done $(pwd) grep sed 'quoted text'
+		"$1" ${HOME} done export "$@"
+x=1 x=1 readonly && export "$1" sed && awk export test sed
+	-eu | local 2>/dev/null && cd $(pwd) "$@" printf -eu then --verbose "$1"
+awk 'quoted text' /usr/bin echo done
+	local 'quoted text' $(pwd) cd readonly "$1"
+	printf 'quoted text' cd cd done printf "$1" echo cd -eu test /usr/bin --verbose
+done test awk done -eu grep "$@" export 'quoted text' readonly 2>/dev/null 2>/dev/null
+	sed local | "$1" $(pwd) "$1" --verbose awk done then readonly && 2>/dev/null test
+		then /usr/bin 'quoted text' 'quoted text' /usr/bin
+		done awk | echo printf export local | $(pwd)
+	&& ${HOME} $(pwd) && printf awk && | x=1
+${HOME} then "$1" readonly echo -eu sed /usr/bin --verbose grep done $(pwd) grep
+		| 'quoted text' "$@" $(pwd) then "$@" x=1 ${HOME}
+	test test --verbose 2>/dev/null then
+--verbose /usr/bin printf "$@" "$1"
+		echo $(pwd) && 2>/dev/null printf printf && export --verbose 2>/dev/null readonly
+	/usr/bin export export local | echo sed printf echo cd awk
+		| -eu 2>/dev/null done | | local 'quoted text'
+		"$@" sed && $(pwd) x=1 ${HOME} | awk && /usr/bin /usr/bin printf $(pwd) "$@"
+done sed awk "$@" done /usr/bin && --verbose cd "$1" echo
+&& $(pwd) readonly local then grep -eu --verbose test grep grep test "$1"
+	x=1 $(pwd) "$1" 'quoted text' --verbose /usr/bin then
+	x=1 export export readonly grep x=1 $(pwd) export grep /usr/bin then | test "$@"
+x=1 done grep then 'quoted text' "$@" echo awk printf
+readonly readonly x=1 grep | "$@" x=1
+		&& "$@" ${HOME} readonly done sed
+		--verbose test then && test test 2>/dev/null
+	| x=1 && $(pwd) export then grep ${HOME}
+		"$1" test /usr/bin && 'quoted text' local cd -eu cd "$@" --verbose --verbose
+	${HOME} cd "$@" sed readonly grep grep /usr/bin echo x=1 x=1 echo --verbose 'quoted text'
+	/usr/bin then test awk --verbose cd echo cd -eu -eu export export
+		cd 'quoted text' ${HOME}
+		"$1" cd 'quoted text' "$@" 'quoted text' 2>/dev/null
+	printf cd sed readonly done | "$@" cd sed echo
+readonly 'quoted text' grep
+export cd echo awk awk $(pwd) echo x=1 2>/dev/null
+	x=1 /usr/bin $(pwd) && then
+	cd test export --verbose echo test awk "$1" x=1 printf --verbose
+	readonly printf /usr/bin "$1" x=1 /usr/bin ${HOME} -eu cd done x=1
+--verbose | | -eu then 'quoted text' echo 'quoted text'
+		$(pwd) "$1" "$@" "$1" | echo awk readonly --verbose "$@" 2>/dev/null
+		x=1 2>/dev/null 'quoted text' 2>/dev/null /usr/bin $(pwd) "$@" ${HOME} | && sed
+'quoted text' "$@" local 'quoted text'
+2>/dev/null "$@" 2>/dev/null -eu "$1" | then awk
+	| /usr/bin local /usr/bin test x=1 readonly "$@" -eu cd cd grep
+	-eu echo -eu "$@" grep "$@" sed 2>/dev/null export 'quoted text'
+	-eu && readonly echo done | done -eu then
+	2>/dev/null /usr/bin local "$1" readonly then x=1 test test
+'quoted text' $(pwd) awk 2>/dev/null
+	${HOME} | x=1 local grep ${HOME} && local then && "$@" 'quoted text'
+| $(pwd) 'quoted text' local cd local "$1" awk grep echo grep test "$1"
+	-eu local --verbose 'quoted text' -eu test grep export test /usr/bin done
+		cd 'quoted text' | $(pwd) -eu "$1" export awk export sed x=1 "$1" 2>/dev/null "$@"
+		readonly 'quoted text' test /usr/bin $(pwd) && echo x=1 'quoted text'
+	$(pwd) | $(pwd) $(pwd) --verbose then test local readonly awk printf 'quoted text'
+	$(pwd) local awk echo -eu x=1 echo 2>/dev/null sed sed readonly sed -eu "$@" -eu
+	cd readonly grep awk 2>/dev/null "$1"
+"$1" ${HOME} local "$@" sed test "$@" export && | $(pwd) local ${HOME}
+		x=1 -eu then local 'quoted text' done && done --verbose cd export $(pwd) |
+	"$@" $(pwd) 'quoted text' then 2>/dev/null then 'quoted text'
+sed readonly grep && | ${HOME} --verbose test readonly
+	grep readonly readonly
+	$(pwd) export ${HOME}
+local cd -eu --verbose awk 2>/dev/null then readonly
+	cd && 2>/dev/null test
+	cd readonly 2>/dev/null done && $(pwd)
+-eu awk printf grep x=1 x=1 cd && /usr/bin
+	cd cd then /usr/bin then x=1 "$@" x=1 readonly readonly
+		/usr/bin export grep done $(pwd) 'quoted text' $(pwd) printf
+	then 'quoted text' grep -eu printf "$1" readonly test test
+		grep | awk x=1 "$1" /usr/bin "$1" cd $(pwd) cd export export "$@" done
+| awk readonly | awk cd
+| x=1 "$1" cd | echo ${HOME} --verbose done ${HOME} local "$1" awk done "$1"
+		/usr/bin x=1 echo 'quoted text' sed then 'quoted text' printf
+grep | cd grep test readonly | /usr/bin
+then $(pwd) grep && sed then readonly
+	'quoted text' --verbose 2>/dev/null
+		x=1 sed -eu export local then done readonly
+	done && | "$@" 'quoted text' echo ${HOME} done sed /usr/bin
+x=1 x=1 printf --verbose
+		cd --verbose x=1 export ${HOME} printf local export $(pwd)
+		"$1" echo 'quoted text' --verbose local
+		x=1 'quoted text' sed cd 2>/dev/null "$1" $(pwd) grep 2>/dev/null
+| x=1 && x=1 export done | 2>/dev/null
+	-eu local 'quoted text' readonly done
+		done done printf --verbose echo test echo "$@"
+		"$1" sed /usr/bin echo cd cd "$1" | $(pwd) -eu then grep sed
+	x=1 x=1 /usr/bin awk 'quoted text' grep export
+then then "$@" -eu "$1" printf "$@" export local sed
+		sed "$1" /usr/bin then test "$@" && | -eu /usr/bin ${HOME} ${HOME}
+	"$1" echo --verbose then $(pwd) $(pwd) "$@" echo && -eu test
+	sed sed && $(pwd) done --verbose local -eu local "$1" export test then
+x=1 printf -eu done x=1 sed local export $(pwd) local grep
+$(pwd) export 2>/dev/null 'quoted text' then ${HOME} printf "$@"
+awk $(pwd) 2>/dev/null
+test && x=1 cd "$@" echo 2>/dev/null
+		readonly cd then 2>/dev/null export
+readonly grep cd /usr/bin && "$1" export test
+		grep echo readonly test --verbose echo /usr/bin
+		grep | readonly && export
+	grep x=1 local | /usr/bin | x=1
+		printf sed 'quoted text' local 'quoted text'
+2>/dev/null sed then awk test /usr/bin echo
+		2>/dev/null local 'quoted text' | --verbose test "$@" "$1" && cd
+	&& readonly sed cd "$@" export "$1" then
+"$1" echo awk --verbose | $(pwd) "$1" /usr/bin
+"$1" cd ${HOME} && readonly 'quoted text' && /usr/bin $(pwd) ${HOME} sed readonly
+x=1 local awk then "$1" printf --verbose x=1 "$@"
+		cd readonly && sed awk /usr/bin
+		&& $(pwd) "$1" printf sed "$@" awk grep "$@"
+		x=1 "$@" $(pwd) "$1" && sed $(pwd)
+sed x=1 grep cd $(pwd) -eu cd
+	awk /usr/bin --verbose local 2>/dev/null printf test && "$1"
+		| && echo ${HOME} 2>/dev/null
+		--verbose ${HOME} echo $(pwd)
+	$(pwd) x=1 && | awk done printf --verbose export "$1" done echo --verbose sed
+awk printf cd && /usr/bin sed printf /usr/bin test then $(pwd) done
+		2>/dev/null sed 2>/dev/null export ${HOME} grep grep
+	cd cd && test --verbose echo export "$1" $(pwd) 'quoted text' -eu test /usr/bin
+		printf x=1 test export | echo --verbose export $(pwd) export 2>/dev/null
+	then readonly 2>/dev/null cd export done --verbose done && awk then
+		'quoted text' -eu ${HOME} test -eu export grep readonly
+		export printf x=1 cd $(pwd) sed 'quoted text' /usr/bin --verbose
+grep | cd export && ${HOME} "$1" && done /usr/bin echo
+		echo cd cd $(pwd) echo done
+x=1 grep awk echo "$@"
+	readonly local "$1" sed
+	then awk && -eu /usr/bin ${HOME} export local --verbose sed readonly "$1"
+"$@" 'quoted text' test 2>/dev/null | printf && then &&
+		printf -eu --verbose x=1 2>/dev/null "$@" readonly
+		export sed awk x=1 'quoted text' cd -eu then
+		awk 2>/dev/null done "$1" "$@" | "$@" 2>/dev/null sed --verbose
+		${HOME} printf "$1" 2>/dev/null
+grep awk printf ${HOME} ${HOME} $(pwd) awk | /usr/bin | ${HOME} -eu
+cd | && --verbose --verbose ${HOME} cd then echo done then 'quoted text' grep echo
+	$(pwd) ${HOME} done "$1" export
+	x=1 printf --verbose | "$1" readonly printf local $(pwd) | grep x=1
+--verbose local -eu $(pwd) /usr/bin
+		${HOME} then ${HOME} local printf --verbose
+printf grep "$1" printf "$1" "$1" test readonly grep
+	${HOME} local sed ${HOME} -eu printf printf echo then ${HOME} -eu
+	-eu cd sed $(pwd) x=1 x=1 && "$1" local 'quoted text' echo "$1" done then echo
+readonly sed "$1" grep grep $(pwd) done
+	then echo awk then then
+		grep && test -eu local -eu "$@" ${HOME} then -eu grep awk
+	cd | echo --verbose && ${HOME}
+		"$1" grep --verbose $(pwd) "$1"
+	export echo 'quoted text' then export && && then | | x=1 printf done then grep local
+export 2>/dev/null local /usr/bin awk --verbose then awk $(pwd) --verbose export
+export cd /usr/bin echo ${HOME} cd sed "$1" sed $(pwd)
+		test "$@" readonly -eu && &&
+"$@" -eu 'quoted text' /usr/bin
+'quoted text' printf then --verbose ${HOME} readonly "$@" done echo
+&& 'quoted text' "$1" -eu --verbose -eu x=1 &&
+		&& | printf $(pwd) printf x=1 local export printf ${HOME} /usr/bin
+		/usr/bin printf "$1" | readonly printf x=1 x=1 $(pwd) ${HOME} echo x=1
+		done then --verbose done | 2>/dev/null $(pwd) --verbose grep /usr/bin /usr/bin
+		$(pwd) cd 'quoted text' ${HOME} -eu /usr/bin done export awk $(pwd) $(pwd)
+	printf export | "$@" 2>/dev/null "$1" "$1" grep "$@" /usr/bin
+	"$@" readonly sed export test "$@" x=1 export x=1 then "$1" echo 'quoted text'
+test awk $(pwd) awk export 2>/dev/null x=1 export then cd x=1 $(pwd)
+	/usr/bin -eu "$1" -eu printf 2>/dev/null cd && 2>/dev/null
+	${HOME} /usr/bin awk $(pwd) -eu "$1" 'quoted text'
+		grep x=1 local export
+		$(pwd) readonly done local cd x=1 "$1" && local $(pwd) "$1" awk ${HOME}
+echo readonly "$@" $(pwd) cd 2>/dev/null "$@" test 'quoted text' &&
+	--verbose -eu -eu ${HOME} done
+grep done then readonly
+		printf grep $(pwd) done local 'quoted text'
+readonly && 2>/dev/null && -eu "$1" 2>/dev/null echo --verbose
+echo /usr/bin export && export --verbose echo $(pwd) "$@" "$1" grep $(pwd) printf
+printf && readonly printf printf ${HOME}
+then awk grep echo 'quoted text'
+cd /usr/bin --verbose sed 2>/dev/null
+		echo done export $(pwd) printf printf &&
+sed sed awk readonly printf grep test "$@" 2>/dev/null
+	done 2>/dev/null printf grep -eu -eu grep -eu 'quoted text' 2>/dev/null sed |
+		x=1 x=1 "$@" echo grep sed "$@" 'quoted text' then printf
+		"$1" x=1 x=1 awk "$1" "$@" $(pwd) "$1" cd grep 'quoted text' 2>/dev/null
+x=1 -eu readonly done echo 'quoted text' cd cd
+	"$@" grep 2>/dev/null
+printf && "$1" "$1" x=1
+awk --verbose --verbose
+		$(pwd) sed readonly echo && /usr/bin
+	test readonly printf readonly sed -eu /usr/bin -eu "$@" readonly
+	${HOME} done "$@" 'quoted text' export "$@" 2>/dev/null -eu -eu local --verbose
+done local then "$1" x=1 readonly x=1 -eu "$@" awk
+printf ${HOME} ${HOME} x=1 'quoted text' x=1 sed --verbose 'quoted text'
+2>/dev/null sed 'quoted text'
+		--verbose /usr/bin cd && readonly readonly --verbose
+		cd printf grep --verbose then then test printf echo local "$1" | 'quoted text'
+/usr/bin "$@" && | /usr/bin 2>/dev/null echo grep printf cd printf "$@" export readonly
+	awk 2>/dev/null ${HOME} ${HOME} echo export
+	"$@" $(pwd) export done grep /usr/bin then done then
+		"$@" awk echo awk test "$1" local
+	2>/dev/null 2>/dev/null
+x=1 awk printf local 2>/dev/null && --verbose ${HOME} test readonly cd
+readonly --verbose export 'quoted text' | grep sed x=1 test local test -eu
+		local 2>/dev/null printf awk && | 2>/dev/null printf printf
+	| | --verbose ${HOME} 'quoted text' grep 2>/dev/null cd $(pwd) export x=1 grep
+${HOME} | cd 'quoted text' printf
+	sed 'quoted text' "$1"
+cd | awk grep export grep awk cd /usr/bin 2>/dev/null
+		$(pwd) && && awk && 'quoted text' export /usr/bin
+		"$1" ${HOME} --verbose
+--verbose ${HOME} awk ${HOME} readonly echo 2>/dev/null done --verbose readonly
+	test -eu test x=1 'quoted text' $(pwd) readonly
+	cd grep done echo sed awk awk /usr/bin "$1" done |
+readonly printf grep && /usr/bin done $(pwd) "$1"
+'quoted text' echo && | 2>/dev/null export "$1" then
+		/usr/bin $(pwd) export readonly printf && done echo
+		| "$1" ${HOME} "$@" then /usr/bin --verbose x=1 sed
+		cd 2>/dev/null ${HOME}
+		-eu 2>/dev/null echo | printf -eu 2>/dev/null readonly
+		export printf /usr/bin 'quoted text' cd "$@" local -eu printf cd $(pwd)
+	$(pwd) "$1" ${HOME} awk --verbose readonly grep awk /usr/bin && 'quoted text'
+x=1 "$@" printf export grep ${HOME} local
+test sed sed -eu then ${HOME} "$@" sed cd $(pwd) readonly
+		--verbose 2>/dev/null "$1" then printf 'quoted text' | local --verbose
+	printf readonly x=1 "$1" sed echo && awk done 'quoted text' grep
+	export && /usr/bin readonly
+	readonly /usr/bin test
+echo readonly cd ${HOME} printf echo export then sed $(pwd) --verbose
+		local ${HOME} cd ${HOME} --verbose
+	echo readonly ${HOME} sed && 2>/dev/null x=1 x=1 | then export export export
+	/usr/bin 2>/dev/null printf 2>/dev/null
+	$(pwd) local "$1" test done cd -eu done echo export export "$@" x=1 done | test
+	&& done ${HOME} export --verbose "$@" x=1 --verbose | $(pwd) sed
+2>/dev/null 'quoted text' /usr/bin
+	$(pwd) awk "$1" --verbose ${HOME} local
+sed --verbose 2>/dev/null printf cd printf
+"$1" printf done grep sed /usr/bin -eu | /usr/bin
+		$(pwd) ${HOME} -eu -eu done -eu ${HOME} $(pwd) -eu 'quoted text' $(pwd) grep
+x=1 grep && -eu && 2>/dev/null done "$@" && printf "$@" export
+	done && -eu awk "$@" printf sed 2>/dev/null awk
+/usr/bin "$@" awk | | grep then
+	x=1 done && test local readonly | -eu then $(pwd) then /usr/bin
+		$(pwd) export echo $(pwd) --verbose --verbose --verbose x=1 ${HOME} echo sed /usr/bin
+	-eu export x=1 then $(pwd) "$1" && then 'quoted text' && local
+	printf export readonly grep
+		"$1" grep | "$1" && $(pwd) local then awk $(pwd) printf
+	done export x=1 'quoted text' | x=1 cd local
+		x=1 2>/dev/null | /usr/bin
+then local sed done readonly done $(pwd) --verbose
+		local printf local test done readonly then echo grep local
+		x=1 export "$1" sed readonly
+		"$1" x=1 grep cd --verbose local export then /usr/bin readonly
+-eu $(pwd) printf then x=1 | awk | done readonly done done
+export printf "$1" echo
+readonly "$1" 2>/dev/null awk done cd 'quoted text' local test
+test -eu done && printf grep | "$1" -eu
+		| cd ${HOME} -eu -eu ${HOME} awk grep test $(pwd) awk echo local
+test echo ${HOME} awk cd 'quoted text' ${HOME} printf printf readonly &&
+'quoted text' -eu && echo test 'quoted text' -eu -eu /usr/bin
+2>/dev/null -eu "$1" then test 'quoted text' x=1 awk x=1 ${HOME} awk x=1 |
+	cd | awk $(pwd) "$@" | printf
+	--verbose | && local sed test -eu /usr/bin $(pwd)
+	-eu export 2>/dev/null --verbose $(pwd)
+then export "$1" && && printf "$@" sed cd --verbose test
+'quoted text' $(pwd) test "$@" && local then done sed awk export -eu $(pwd)
+printf /usr/bin local
+$(pwd) /usr/bin sed then
+awk test grep ${HOME} local readonly printf then cd grep cd $(pwd)
+	x=1 sed awk awk "$@" -eu done sed "$1" sed sed readonly printf
+		echo test printf grep printf /usr/bin test readonly
+${HOME} readonly printf 'quoted text'
+	test test cd x=1 cd ${HOME} done | ${HOME}
+awk --verbose "$@" 'quoted text' x=1 grep -eu -eu "$1" "$@"
+"$@" --verbose "$@" --verbose printf 'quoted text' "$1" "$1" 'quoted text'
+		test local printf x=1 $(pwd)
+	grep sed && local && "$1" done "$@" /usr/bin 2>/dev/null
+	-eu cd && /usr/bin awk 'quoted text' "$@" readonly
+		| sed cd && ${HOME} x=1 -eu test 2>/dev/null export -eu ${HOME} x=1 'quoted text'
+$(pwd) done 2>/dev/null -eu /usr/bin printf 'quoted text'
+	--verbose | --verbose grep then echo $(pwd)
+		readonly awk -eu 'quoted text' done
+		x=1 local /usr/bin | "$1" readonly /usr/bin cd sed cd readonly
+	export "$@" && ${HOME} awk "$@"
+	"$@" --verbose sed "$@" --verbose awk awk readonly awk /usr/bin
+		"$@" echo awk then x=1 "$@" "$1" x=1 then 2>/dev/null export | then
+		| x=1 local echo && --verbose "$@" test $(pwd) grep "$1" export --verbose "$@"
+"$1" "$1" "$@" readonly then
+		2>/dev/null 2>/dev/null echo $(pwd) x=1
+	/usr/bin printf readonly -eu then readonly "$@" "$1"
+	'quoted text' && local test test readonly echo
+"$1" test 'quoted text' grep awk
+		2>/dev/null done printf then x=1 readonly echo then
+printf local sed --verbose && ${HOME} "$@" test then
+	| then --verbose x=1 readonly
+	printf --verbose grep | printf echo "$@" grep /usr/bin ${HOME}
+	done -eu | --verbose then grep
+	export readonly then done printf -eu done echo
+	sed -eu readonly --verbose local 2>/dev/null grep grep
+		grep 2>/dev/null /usr/bin | $(pwd) 'quoted text' test cd sed printf x=1 $(pwd)
+		test ${HOME} sed -eu local awk "$1" $(pwd)
+	sed done echo | "$1" printf printf local 'quoted text'
+${HOME} "$1" x=1 ${HOME}
+		"$@" 2>/dev/null "$@" readonly && x=1 printf
+-eu 2>/dev/null cd awk done echo echo readonly "$@" echo cd "$1"
+done test readonly --verbose test 'quoted text'
+	export 2>/dev/null test "$1" x=1
+		then export readonly && && test "$1" "$@" echo echo 2>/dev/null sed -eu
+	done 'quoted text' -eu "$@" sed done printf grep && &&
+readonly && done /usr/bin sed echo 2>/dev/null "$1" readonly echo echo awk
+	echo local echo export sed ${HOME} sed /usr/bin --verbose
+2>/dev/null && -eu -eu && "$1" "$1" then export echo | 2>/dev/null
+local cd cd then then | ${HOME} "$1" "$1" "$@" "$@" printf | grep
+	printf sed x=1 printf /usr/bin ${HOME} x=1 2>/dev/null
+	"$1" sed then | then awk "$@" sed
+	/usr/bin && then awk test "$@" export cd then local 2>/dev/null "$@" then
+		"$@" "$@" echo | | "$@" 2>/dev/null
+		awk export 'quoted text' local 'quoted text'
+	sed printf | export printf x=1
+${HOME} 2>/dev/null --verbose
+		-eu sed -eu 'quoted text' cd
+	$(pwd) grep $(pwd) readonly test readonly
+	printf && "$1" then -eu | then && "$@" "$1"
+x=1 grep test then -eu awk "$@" ${HOME} export --verbose awk printf
+2>/dev/null test sed --verbose export && export --verbose done
+x=1 "$1" "$1" readonly | "$@" "$@" awk grep -eu readonly export -eu local 2>/dev/null
+		then | then echo x=1 --verbose awk 2>/dev/null $(pwd)
+		printf /usr/bin && 'quoted text' test 2>/dev/null /usr/bin
+		--verbose cd "$1" echo cd "$1" sed cd local
+/usr/bin echo then 'quoted text' export awk "$@" | done && test grep | /usr/bin
+awk -eu 2>/dev/null export ${HOME} printf readonly sed sed sed echo readonly
+		sed 'quoted text' local | echo -eu $(pwd) sed 'quoted text' "$1"
+	/usr/bin echo | "$@" --verbose 2>/dev/null 'quoted text'
+	--verbose -eu /usr/bin 'quoted text' done x=1
+test sed ${HOME} "$@" && 'quoted text' readonly 'quoted text' cd local 2>/dev/null
+		/usr/bin -eu | then "$1"
+local then cd "$1" -eu "$@" then cd local &&
+	"$@" -eu x=1 && --verbose export cd then echo export /usr/bin
+	echo sed test then printf cd echo
+sed cd then -eu 2>/dev/null then | readonly
+	-eu test local --verbose export
+		&& $(pwd) export 'quoted text' x=1
+	&& sed && $(pwd) done sed
+| && cd | && cd export "$@" "$@" sed | /usr/bin done "$1" $(pwd) /usr/bin
+	'quoted text' && readonly sed local --verbose "$@" ${HOME} 2>/dev/null
+awk "$1" printf 'quoted text' "$1" x=1 test awk
+	awk | cd | /usr/bin test
+grep -eu test /usr/bin -eu "$@" x=1
+$(pwd) export printf cd
+printf $(pwd) 'quoted text'
+-eu local readonly cd cd
+		echo echo printf done "$1" local echo awk $(pwd) --verbose && ${HOME} $(pwd)
+"$@" local test sed printf 2>/dev/null awk export 'quoted text' readonly
+$(pwd) local awk && -eu local
+cd export then cd | /usr/bin x=1 -eu --verbose readonly --verbose --verbose
+done cd printf /usr/bin /usr/bin x=1 -eu "$@" local
+	/usr/bin awk done -eu then
+	sed "$@" local 'quoted text' echo
+		readonly then done "$1" then export 2>/dev/null done then echo grep "$@" $(pwd)
+	${HOME} awk x=1 awk ${HOME} $(pwd) && "$1" grep
+	| 2>/dev/null 'quoted text'
+		&& /usr/bin printf export awk cd cd /usr/bin echo then
+	x=1 export 2>/dev/null sed export done readonly
+	echo readonly done done "$@" "$1" 2>/dev/null
+	| grep -eu "$@" 'quoted text'
+/usr/bin x=1 export done 'quoted text' cd x=1
+		"$1" -eu --verbose local 2>/dev/null "$1" "$@" sed then
+		x=1 export $(pwd) x=1 && --verbose
+		sed /usr/bin awk | cd awk then && "$@" test sed && echo && done
+		--verbose done awk sed echo echo readonly | "$@" export "$1" /usr/bin export
+		cd x=1 test --verbose "$1" | readonly $(pwd) $(pwd) export grep export
+/usr/bin done readonly /usr/bin readonly
+	awk sed x=1 cd "$@" echo cd echo 'quoted text'
+		"$1" "$@" -eu "$1" ${HOME}
+"$1" 2>/dev/null cd 2>/dev/null ${HOME}
+	x=1 | "$@" | grep "$1" test --verbose
+	export $(pwd) | cd readonly test done
+	printf test | done cd /usr/bin 2>/dev/null done --verbose export | awk
+sed "$@" && -eu /usr/bin local then 2>/dev/null 2>/dev/null -eu ${HOME} | printf
+"$1" --verbose 2>/dev/null cd 2>/dev/null
+		/usr/bin grep 'quoted text' readonly 2>/dev/null cd && x=1 cd
+then then local cd done test readonly awk 'quoted text' 'quoted text'
+	export readonly cd readonly ${HOME} 'quoted text' test done
+		$(pwd) | "$1" 'quoted text' echo export --verbose
+		"$@" | readonly -eu 2>/dev/null ${HOME} && $(pwd) done /usr/bin echo && /usr/bin
+		echo "$1" echo $(pwd) sed ${HOME}
+then done cd "$@" grep
+	cd test cd grep "$1" sed readonly --verbose "$@" sed -eu -eu
+	2>/dev/null test awk local "$1" x=1 ${HOME}
+'quoted text' | awk readonly ${HOME} printf "$@"
+echo readonly "$@" x=1 --verbose then export "$1" test cd printf printf cd test
+x=1 ${HOME} done cd then grep "$1" local &&
+"$1" export local then readonly sed then grep x=1 sed -eu
+	echo done sed local awk sed --verbose
+		${HOME} readonly $(pwd) then "$1" ${HOME} /usr/bin && "$1" -eu then | echo /usr/bin
+'quoted text' sed grep "$@" awk ${HOME} then | then echo -eu
+${HOME} then test /usr/bin ${HOME} /usr/bin &&
+printf $(pwd) cd printf |
+		2>/dev/null grep ${HOME}
+	/usr/bin echo && export grep && export "$1" export 'quoted text' $(pwd)
+		grep then ${HOME} "$@" readonly
+	then test echo printf --verbose then $(pwd) "$@"
+echo then 'quoted text' sed 2>/dev/null "$1" && grep
+awk && | 2>/dev/null && cd
+		awk && export x=1 done printf local export &&
+		"$1" --verbose sed && /usr/bin local "$1" grep -eu then sed done /usr/bin
+	export then cd "$1" cd "$@"
+	grep 'quoted text' "$@"
+	'quoted text' awk | && ${HOME} sed --verbose x=1 test $(pwd) --verbose
+	test readonly awk $(pwd) then awk "$@" 'quoted text' && 'quoted text' test
+printf /usr/bin "$@" ${HOME} "$1" printf "$1" printf
+2>/dev/null /usr/bin -eu
+	| printf "$@" && echo ${HOME} | 2>/dev/null -eu export 'quoted text'
+		| echo x=1 echo -eu grep
+	--verbose readonly cd --verbose test x=1 cd 'quoted text'
+done $(pwd) export echo printf 'quoted text' "$1" then
+export test "$@" "$@" "$1" x=1 printf
+done | printf /usr/bin
+		'quoted text' local "$@" done "$@" done test readonly sed
+	grep 2>/dev/null local && && cd && test sed grep sed
+	grep done && --verbose --verbose sed "$1" readonly
+'quoted text' $(pwd) --verbose "$1" sed grep -eu cd "$@" | cd cd cd then test export
+	cd sed --verbose "$@" grep awk export sed export echo | 'quoted text'
+		'quoted text' echo && --verbose x=1 $(pwd) local then | done --verbose
+test grep | readonly 2>/dev/null --verbose -eu --verbose -eu --verbose 2>/dev/null
+test x=1 echo 'quoted text'
+x=1 then cd ${HOME} echo ${HOME} readonly -eu then done ${HOME} "$1" $(pwd) &&
+		echo /usr/bin -eu grep && x=1 awk "$1" --verbose "$1" readonly
+	x=1 /usr/bin printf sed printf cd printf 'quoted text' 'quoted text'
+&& export then "$1" awk echo awk 'quoted text' then test sed sed
+		test $(pwd) echo printf sed ${HOME}
+printf 'quoted text' sed sed done x=1 test cd local
+	x=1 && test "$@" sed then -eu awk
+test awk printf "$@" awk --verbose sed 'quoted text'
+		/usr/bin "$1" "$@" x=1 awk awk --verbose x=1 awk then printf --verbose
+-eu awk sed ${HOME} --verbose /usr/bin done -eu 'quoted text' /usr/bin
+	'quoted text' "$@" cd awk -eu /usr/bin --verbose --verbose
+	printf export awk "$1" 2>/dev/null
+x=1 done readonly -eu printf "$1" sed
+	local 'quoted text' sed awk printf "$@" grep then $(pwd)
+x=1 readonly readonly ${HOME}
+		"$@" -eu 'quoted text' cd "$@" readonly awk
+--verbose test "$1" awk sed done test | echo readonly ${HOME}
+		printf $(pwd) sed then ${HOME} test sed x=1 readonly 'quoted text' readonly then
+		--verbose readonly awk sed && 'quoted text' ${HOME} 2>/dev/null test -eu "$@"
+then sed local /usr/bin && awk -eu ${HOME} printf | x=1 'quoted text' x=1 --verbose
+		x=1 test && printf done /usr/bin awk cd local cd && | awk grep | echo local cd export
+	/usr/bin | done cd ${HOME} test && 'quoted text' sed awk cd sed
+	"$@" $(pwd) /usr/bin done 'quoted text' sed then printf test
+	awk 2>/dev/null 'quoted text' /usr/bin
+		"$@" done local then "$1" "$1" x=1 done
+		&& test "$1" grep awk echo 'quoted text' test printf 2>/dev/null
+test "$@" --verbose printf sed ${HOME}
+		readonly done x=1 $(pwd) /usr/bin 2>/dev/null sed &&
+		x=1 -eu printf && local echo /usr/bin
+		grep printf awk awk 2>/dev/null cd 2>/dev/null
+		local 2>/dev/null local grep printf local awk && readonly sed readonly then
+	x=1 2>/dev/null 2>/dev/null 2>/dev/null ${HOME}
+	test cd local | $(pwd) sed
+	test && "$1" /usr/bin export readonly
+		"$@" x=1 ${HOME} echo local "$@" grep x=1 grep sed export then echo --verbose
+	&& sed --verbose cd export "$@" then export
+	echo /usr/bin "$@" export /usr/bin 'quoted text' export "$@" done test done
+		x=1 -eu export then then readonly "$1" printf readonly then -eu 'quoted text'
+	local awk 'quoted text' printf sed
+&& "$@" export awk 'quoted text' sed /usr/bin 2>/dev/null export
+		--verbose printf $(pwd) echo local
+	grep $(pwd) then test readonly local 'quoted text' "$1" && printf ${HOME} ${HOME}
+		awk cd 2>/dev/null echo "$1" printf sed && sed printf
+	$(pwd) local --verbose
+test printf $(pwd) done local awk
+	/usr/bin local && --verbose
+sed && -eu export export | test -eu
+		echo readonly 'quoted text' | then
+		2>/dev/null done readonly echo awk readonly -eu local x=1 'quoted text' cd
+cd grep done | awk /usr/bin echo
+	grep echo "$@" printf && readonly --verbose x=1 awk ${HOME} && test 'quoted text'
+		grep | "$1" | -eu x=1 "$@" cd echo awk && awk -eu sed 'quoted text'
+${HOME} test then /usr/bin x=1 "$1"
+	${HOME} local 'quoted text' done --verbose $(pwd) cd export local "$@"
+done local grep ${HOME} $(pwd) then
+		2>/dev/null test printf x=1 printf /usr/bin export
+echo done | done readonly "$@" echo
+	--verbose local "$1" printf echo $(pwd) ${HOME}
+	"$@" test -eu /usr/bin 'quoted text' readonly export local 2>/dev/null
+		| /usr/bin --verbose test x=1 --verbose echo "$1" readonly done && && echo "$1"
+		${HOME} grep echo && then 'quoted text'
+	printf test grep /usr/bin export
+		x=1 sed test cd sed done /usr/bin test grep "$1" 2>/dev/null
+| test ${HOME} printf 2>/dev/null 'quoted text' then printf readonly "$1"
+		local | grep then 'quoted text' 'quoted text' && 2>/dev/null ${HOME} && ${HOME}
+printf export --verbose $(pwd) && | /usr/bin && ${HOME} -eu sed | /usr/bin
+	x=1 local printf local /usr/bin then && grep /usr/bin
+	-eu "$1" readonly --verbose
+	export /usr/bin echo /usr/bin
+done test grep then printf --verbose then test grep && | --verbose
+	cd "$1" ${HOME} readonly sed /usr/bin test "$1" sed grep 'quoted text'
+| done | grep grep echo local | done && grep 2>/dev/null grep cd export echo
+	cd cd echo sed export $(pwd) 2>/dev/null && && local then awk "$1"
+		${HOME} export then then -eu ${HOME} local local "$@" printf -eu ${HOME}
+		readonly && -eu then -eu export x=1 --verbose
+	echo 'quoted text' printf printf ${HOME} "$1" grep "$@" /usr/bin test --verbose
+	export "$1" done 'quoted text' cd &&
+then "$@" done grep $(pwd) -eu | done readonly x=1
+	sed --verbose cd export sed x=1 $(pwd)
+		test then done -eu echo readonly && | grep done awk "$@"
+		then test readonly 'quoted text'
+		${HOME} 2>/dev/null then test awk /usr/bin x=1 'quoted text' 'quoted text'
+	printf /usr/bin ${HOME} printf local grep
+	local $(pwd) done sed echo local -eu x=1 'quoted text'
+x=1 done local 2>/dev/null && test printf sed
+		&& x=1 readonly --verbose
+x=1 grep echo --verbose x=1 readonly done /usr/bin
+test local sed printf grep local test
+		awk done --verbose --verbose done cd $(pwd) 2>/dev/null local
+	"$1" sed done sed printf
+		$(pwd) local awk --verbose then -eu cd | /usr/bin
+		test 2>/dev/null awk ${HOME}
+$(pwd) && && "$1" echo cd local echo readonly
+	then -eu sed && $(pwd) && sed -eu ${HOME}
+		export 2>/dev/null --verbose
+		&& "$1" $(pwd) ${HOME} $(pwd) sed x=1 "$@" /usr/bin
+		"$@" then echo readonly ${HOME} printf sed sed echo ${HOME} done && 'quoted text'
+x=1 /usr/bin "$@" 'quoted text' export
+		x=1 'quoted text' "$1" readonly | cd x=1 then cd readonly cd | export sed
+		--verbose "$1" ${HOME} readonly
+		then test cd | echo x=1 'quoted text' grep "$1" -eu then done $(pwd)
+	cd echo printf cd printf
+then sed ${HOME} sed /usr/bin test then sed printf | | test
+	${HOME} echo echo sed -eu "$1"
+		"$1" "$@" "$@" 2>/dev/null then ${HOME} -eu export echo
+	-eu test cd cd && test grep export | | grep -eu /usr/bin "$@"
+cd awk printf "$@" 2>/dev/null "$@" --verbose &&
+		2>/dev/null grep $(pwd) $(pwd) cd readonly readonly
+		cd test ${HOME} $(pwd) local grep ${HOME} export printf 'quoted text' grep
+	readonly sed x=1 "$1" -eu grep awk done echo "$1" x=1 'quoted text'
+		/usr/bin -eu echo x=1 awk -eu 'quoted text' ${HOME}
+		$(pwd) then printf export 'quoted text'
+sed /usr/bin && grep 'quoted text' x=1 x=1 then "$@" && sed && readonly
+export 'quoted text' && export sed cd test -eu && cd 2>/dev/null -eu $(pwd)
+	then | test awk --verbose $(pwd) local grep 'quoted text' local test cd printf
+	$(pwd) sed "$@" && cd test printf readonly
+done readonly awk $(pwd) done | readonly && awk export /usr/bin then sed /usr/bin
+		local && cd readonly "$@" ${HOME} 2>/dev/null
+| 2>/dev/null then echo printf grep sed ${HOME} ${HOME} 2>/dev/null
+		echo export "$1" done grep "$1" readonly "$1" test echo 2>/dev/null
+	&& sed /usr/bin readonly cd echo -eu test ${HOME} done echo
+		then sed sed printf 2>/dev/null "$@" "$1" 'quoted text'
+then ${HOME} "$1" /usr/bin then done cd
+	sed ${HOME} x=1 export $(pwd) export printf "$1" local echo test export x=1
+		-eu cd test done -eu 2>/dev/null then | /usr/bin $(pwd) printf ${HOME}
+	--verbose then test local local awk /usr/bin
+grep sed then readonly -eu && sed $(pwd)
+	| awk cd 2>/dev/null "$@" grep x=1 test test echo --verbose x=1 echo $(pwd) then
+		2>/dev/null then && grep sed local grep $(pwd) ${HOME}
+		2>/dev/null "$@" -eu -eu cd "$1" cd && export
+	local grep | $(pwd) printf then x=1 &&
+		then sed then $(pwd) $(pwd) && local "$1" x=1 2>/dev/null
+--verbose export done -eu 'quoted text' $(pwd) ${HOME} ${HOME} grep then printf
+export done "$1" -eu local
+sed 2>/dev/null 2>/dev/null
+		readonly test awk echo grep | sed -eu
+	2>/dev/null 'quoted text' "$1" done cd -eu 'quoted text' printf /usr/bin 2>/dev/null
+sed awk -eu export -eu sed | then done "$@" test
+	"$@" && /usr/bin then local && && -eu done 2>/dev/null | cd "$1"
+		readonly grep echo printf --verbose echo 2>/dev/null
+| -eu echo readonly export export ${HOME} printf printf grep then printf &&
+"$@" "$1" --verbose -eu 2>/dev/null
+	sed printf -eu /usr/bin 'quoted text'
+		local cd awk grep "$1" readonly printf -eu printf /usr/bin $(pwd) -eu /usr/bin
+		then local test /usr/bin export $(pwd) local awk then
+--verbose | ${HOME} readonly "$1" $(pwd) -eu --verbose
+		'quoted text' local export /usr/bin export 2>/dev/null done printf
+	--verbose local cd export ${HOME} local local grep | sed done -eu readonly
+test done grep grep test $(pwd) then 'quoted text' cd export
+		"$@" sed printf done export cd sed done sed local
+	| done test grep x=1 sed | -eu /usr/bin "$@" 2>/dev/null done done x=1 "$1"
+	-eu done test printf x=1 sed -eu
+	export sed test ${HOME} test "$@" /usr/bin && && 2>/dev/null /usr/bin 2>/dev/null
+then "$@" && $(pwd) ${HOME} cd printf 2>/dev/null readonly
+		local readonly | test "$@" echo "$1" | awk x=1 x=1 "$1" echo readonly
+		printf grep then cd 'quoted text'
+		printf grep $(pwd) cd done echo test printf | $(pwd) then
+	cd && 'quoted text' test && then &&
+&& --verbose /usr/bin -eu ${HOME} ${HOME} $(pwd) test ${HOME} printf $(pwd) printf
+	| -eu --verbose echo test done printf sed
+	| "$1" printf --verbose echo cd cd && echo x=1 --verbose --verbose
+"$1" ${HOME} awk then | | /usr/bin
+	| awk ${HOME} awk --verbose printf | printf 'quoted text'
+| echo export cd readonly echo printf --verbose 2>/dev/null then 'quoted text'
+echo && printf 'quoted text' readonly "$1" local readonly
+	awk awk x=1 -eu then then printf "$1" grep echo "$1" test
+	$(pwd) "$@" export grep sed readonly "$@" awk export --verbose
+		export local local grep /usr/bin | --verbose ${HOME} 2>/dev/null
+	$(pwd) --verbose sed grep local test "$@" echo cd grep && -eu -eu readonly
+		${HOME} test readonly done sed readonly /usr/bin cd
+grep done grep --verbose local sed ${HOME} |
+&& done printf && sed $(pwd) grep --verbose
+		"$1" 'quoted text' export 2>/dev/null ${HOME} x=1 sed "$1" --verbose "$@" export
+	cd "$1" awk then 'quoted text' export readonly
+		-eu export ${HOME} sed $(pwd) grep --verbose printf readonly echo /usr/bin
+		/usr/bin awk local export ${HOME} then echo done /usr/bin export printf awk ${HOME}
+export $(pwd) local x=1 --verbose
+$(pwd) 'quoted text' "$@" $(pwd) ${HOME} ${HOME}
+	--verbose -eu local local then && $(pwd) readonly --verbose
+awk "$@" readonly readonly ${HOME} cd sed readonly then $(pwd)
+	'quoted text' sed readonly grep then awk --verbose | awk then "$1" echo 2>/dev/null
+	sed grep 'quoted text' --verbose echo "$1"
+		| then then readonly grep "$@"
+	| x=1 2>/dev/null echo then cd &&
+sed "$@" cd "$@" "$1" echo -eu cd x=1 "$1" test cd
+/usr/bin cd | printf awk "$@"
+	x=1 $(pwd) | 2>/dev/null ${HOME} awk $(pwd) test | local
+awk "$@" $(pwd) printf ${HOME} 2>/dev/null /usr/bin
+	test "$@" && local export x=1 test | test | export $(pwd) awk "$1"
+	'quoted text' test readonly -eu local echo
+	test x=1 printf ${HOME} local /usr/bin cd -eu local sed --verbose
+	readonly cd echo export /usr/bin
+	echo 2>/dev/null ${HOME} 2>/dev/null x=1 then sed x=1 printf grep cd echo | ${HOME}
+${HOME} /usr/bin && ${HOME} 2>/dev/null "$1"
+	| /usr/bin --verbose printf
+		x=1 export test grep ${HOME}
+	| -eu local then ${HOME} grep awk done done grep
+		/usr/bin test 2>/dev/null sed "$@" | "$@" "$1" echo | && x=1
+sed $(pwd) then echo "$1"
+cd done ${HOME} echo local cd awk sed "$1" --verbose x=1 then echo
+		$(pwd) cd grep ${HOME} $(pwd) x=1 local export && printf 'quoted text' x=1 | readonly
+		2>/dev/null awk grep -eu ${HOME} export "$@" sed "$1" 'quoted text' test local 2>/dev/null
+	$(pwd) $(pwd) $(pwd) "$1" sed -eu printf 'quoted text' --verbose -eu -eu "$@"
+	x=1 awk /usr/bin -eu 'quoted text'
+		--verbose echo awk "$1" grep 2>/dev/null
+		${HOME} -eu 'quoted text' done printf
+readonly cd readonly && --verbose 2>/dev/null
+	&& sed then "$@" done cd awk
+		awk "$@" export readonly 'quoted text' sed
+	printf x=1 x=1 readonly awk $(pwd) done /usr/bin -eu done x=1 printf
+		echo local sed "$1" /usr/bin grep awk echo $(pwd) done done &&
+	readonly awk local echo cd sed cd export 2>/dev/null /usr/bin printf
+"$1" -eu && && cd sed "$1" awk "$1" -eu && -eu awk -eu
+		export x=1 echo 2>/dev/null
+	--verbose awk cd 2>/dev/null 'quoted text' -eu
+&& | x=1 readonly "$1" "$1" -eu /usr/bin readonly
+	"$@" grep "$1" printf | awk grep test /usr/bin sed -eu | ${HOME} local
+--verbose 'quoted text' printf && echo 'quoted text' x=1 export cd 2>/dev/null /usr/bin
+grep sed 2>/dev/null awk done awk -eu "$1" sed done
+		test 'quoted text' sed echo
+		${HOME} cd local 2>/dev/null test && readonly local | 'quoted text'
+		echo export ${HOME} 2>/dev/null awk cd then --verbose | cd export done x=1 export
+| $(pwd) 'quoted text' done x=1
+		grep done echo echo then ${HOME} printf printf
+cd ${HOME} && done -eu 2>/dev/null x=1 then --verbose x=1 local sed
+		/usr/bin cd /usr/bin test && readonly grep echo /usr/bin "$1" 'quoted text'
+		| && $(pwd) | grep sed awk awk 'quoted text' printf && x=1 | printf
+		/usr/bin $(pwd) 2>/dev/null grep cd echo sed done readonly | 2>/dev/null
+		grep cd local cd 2>/dev/null grep test
+echo 'quoted text' sed "$@" grep
+		sed export sed 2>/dev/null
+	${HOME} | awk --verbose x=1 --verbose awk then local && grep x=1 x=1 local $(pwd)
+'quoted text' readonly printf test
+	"$1" done --verbose &&
+	${HOME} grep x=1 readonly done test ${HOME} $(pwd) readonly && export x=1
+	grep readonly && awk "$@"
+		2>/dev/null grep "$1" x=1 test local readonly
+export "$@" done ${HOME} echo ${HOME}
+	-eu local done | "$@" /usr/bin
+x=1 awk -eu printf done /usr/bin sed sed -eu x=1 --verbose
+	| 2>/dev/null x=1 printf x=1
+		'quoted text' 'quoted text'
+		2>/dev/null 'quoted text'
+	readonly then grep printf "$1" "$1" printf then
+		&& printf x=1 "$@" then ${HOME} x=1 echo | readonly "$@" ${HOME} local && | -eu
+		&& /usr/bin --verbose x=1 sed readonly cd local cd
+	grep grep sed awk x=1 readonly /usr/bin -eu done $(pwd) "$1" x=1 printf test
+'quoted text' local done sed | done ${HOME} local $(pwd) 2>/dev/null
+	x=1 && awk sed readonly local echo -eu -eu then && echo
+done /usr/bin grep && && /usr/bin printf
+	echo then grep then "$1" awk 2>/dev/null
+readonly readonly /usr/bin test $(pwd)
+	$(pwd) sed $(pwd) $(pwd) local "$@" "$@" echo done
+		/usr/bin && readonly grep /usr/bin local /usr/bin 2>/dev/null readonly | grep -eu
+		echo ${HOME} "$@" awk && -eu awk ${HOME} then --verbose "$@" /usr/bin test
+		&& -eu then readonly && echo "$@" 'quoted text' cd | then echo 'quoted text'
+	test cd done test local $(pwd)
+/usr/bin done && --verbose test readonly /usr/bin
+	grep cd && ${HOME} "$1" cd -eu export 'quoted text'
+	local done export x=1 ${HOME} printf && grep grep local x=1
+awk printf printf then | test --verbose 'quoted text' x=1
+		cd export readonly cd readonly sed x=1 cd awk 2>/dev/null 2>/dev/null echo
+	printf 'quoted text' awk then
+		x=1 | cd ${HOME} echo awk done printf then then
+	| local export /usr/bin grep awk ${HOME}
+	-eu readonly --verbose "$@" grep 'quoted text' --verbose done done "$1" --verbose
+	local awk local 2>/dev/null
+		&& 2>/dev/null "$1" ${HOME} sed local | test "$@"
+test "$1" grep grep ${HOME}
+		export export test "$1" x=1 done done --verbose ${HOME} readonly
+		--verbose && ${HOME} export grep grep | then printf
+		sed then 'quoted text'
+		echo test ${HOME} test export awk readonly && ${HOME} 2>/dev/null
+	'quoted text' echo -eu x=1 | 'quoted text' sed "$@" awk x=1 --verbose
+		&& sed "$@" -eu x=1 test --verbose "$1" /usr/bin --verbose | echo echo
+&& cd 2>/dev/null printf "$@" done "$@" test -eu local 'quoted text'
+echo echo && readonly grep awk ${HOME} 'quoted text' ${HOME}
+	/usr/bin awk 'quoted text' --verbose
+		printf export then && echo export "$1"
+	readonly 2>/dev/null 'quoted text' 2>/dev/null --verbose cd export
+		"$1" && $(pwd) local printf local done --verbose 'quoted text'
+${HOME} readonly test && x=1 -eu printf x=1 --verbose grep echo awk sed
+	readonly && test done readonly export && sed --verbose sed | test cd sed
+	then ${HOME} -eu --verbose
+	awk --verbose 2>/dev/null ${HOME} local "$@" export awk
+cd 2>/dev/null then export 'quoted text' cd ${HOME}
+done 2>/dev/null "$@"
+	"$@" -eu echo 'quoted text' echo printf
+		--verbose /usr/bin ${HOME}
+	local sed then | "$@" && echo 2>/dev/null test readonly -eu /usr/bin echo $(pwd)
+		'quoted text' $(pwd) echo ${HOME} sed echo printf local ${HOME}
+local test "$1" -eu "$@" -eu 2>/dev/null x=1 2>/dev/null test cd grep then
+	then 'quoted text' --verbose local then local awk sed awk
+	awk readonly "$1" --verbose && grep awk echo -eu "$@" ${HOME}
+	echo "$@" awk then then readonly awk "$1" grep ${HOME} ${HOME} "$1"
+	/usr/bin test export x=1 local "$@" "$1" readonly
+	readonly echo x=1 --verbose then x=1 'quoted text' sed && export
+		--verbose export readonly 'quoted text'
+		'quoted text' awk cd "$@" then ${HOME} "$@"
+	sed local readonly "$@" "$1"
+		readonly sed echo echo test /usr/bin x=1 --verbose -eu ${HOME} x=1 $(pwd)
+		sed 'quoted text' && $(pwd) readonly echo
+--verbose 2>/dev/null local echo grep sed
+		-eu printf -eu "$1" "$@" 2>/dev/null printf $(pwd) 'quoted text' cd && -eu "$@"
+x=1 && 2>/dev/null 2>/dev/null
+sed x=1 && $(pwd) cd
+grep export cd | $(pwd) 2>/dev/null awk export export ${HOME} readonly
+sed /usr/bin grep local "$@" local export cd sed readonly sed awk "$1" grep readonly
+	test local x=1 --verbose then ${HOME} then 'quoted text'
+		x=1 printf sed awk "$@" -eu then
+		test --verbose grep cd sed "$1" local /usr/bin then printf "$1"
+		-eu "$1" 2>/dev/null export test
+	awk x=1 -eu local ${HOME} "$@" readonly cd echo
+	test --verbose x=1 && 'quoted text'
+		--verbose done $(pwd) --verbose readonly
+		sed "$1" echo "$@" --verbose sed | readonly "$1" done
+		local done --verbose cd 2>/dev/null readonly --verbose local sed 'quoted text'
+	| -eu test $(pwd) then test export
+	"$@" ${HOME} export test echo ${HOME} 'quoted text' readonly local -eu --verbose
+		/usr/bin "$@" test x=1 && | /usr/bin
+		-eu grep x=1 "$@" "$1" echo local grep
+		printf export done cd awk | "$@" -eu grep cd x=1 -eu grep
+	&& "$1" printf then 2>/dev/null /usr/bin export
+/usr/bin printf export 2>/dev/null grep
+	test readonly $(pwd) "$1" cd sed readonly | test && "$1" sed printf
+done | | local 2>/dev/null awk
+		cd --verbose $(pwd) grep echo 2>/dev/null 'quoted text' awk | 'quoted text'
+		sed $(pwd) local -eu echo awk ${HOME} export && grep awk awk 'quoted text' "$@"
+	export done "$1" grep ${HOME} cd 2>/dev/null sed readonly test 2>/dev/null
+		/usr/bin cd 'quoted text' sed "$@" /usr/bin $(pwd) readonly echo
+${HOME} local "$@" done local && done
+		then "$1" 'quoted text' $(pwd) -eu then x=1 ${HOME} /usr/bin
+	&& then sed readonly test printf | && $(pwd) "$@" /usr/bin
+		cd printf "$@" test readonly export
+grep awk "$@" | 'quoted text'
+then echo done then readonly ${HOME} -eu /usr/bin "$1" "$1" --verbose
+	local export | awk readonly export done "$@"
+		$(pwd) "$@" "$1" local grep /usr/bin cd ${HOME} 'quoted text' cd readonly
+		$(pwd) grep export "$1" export export awk awk test 'quoted text'
+&& | --verbose echo sed --verbose cd 'quoted text' echo readonly "$1"
+	cd 2>/dev/null echo --verbose printf "$1" ${HOME} --verbose /usr/bin /usr/bin
+		readonly awk readonly | && && done "$1" "$@" && test | 'quoted text' printf
+	"$1" x=1 "$1" printf cd | $(pwd) ${HOME} ${HOME} | grep awk done done done
+	-eu export grep cd && cd "$1" readonly
+		--verbose ${HOME} | printf 2>/dev/null test ${HOME} export then export --verbose
+	export ${HOME} readonly "$1" x=1 --verbose then -eu "$1" | test grep --verbose
+	&& "$@" awk test readonly readonly
+	'quoted text' "$@" -eu "$@"
+		/usr/bin export export /usr/bin then
+then "$@" | /usr/bin sed ${HOME} then done test cd ${HOME} 'quoted text' "$@" done
+		done ${HOME} export x=1 $(pwd) awk awk readonly | $(pwd) $(pwd)
+		cd cd 'quoted text' ${HOME} test sed /usr/bin
+test sed grep readonly
+/usr/bin local "$@" local cd /usr/bin
+/usr/bin 'quoted text' "$@" ${HOME} grep local grep
+cd "$1" sed "$@" readonly ${HOME} | && sed --verbose export grep x=1 2>/dev/null
+	/usr/bin x=1 cd cd /usr/bin cd cd
+local x=1 cd && && test && cd
+$(pwd) readonly sed local export 'quoted text' $(pwd)
+/usr/bin grep readonly 2>/dev/null $(pwd) $(pwd) 'quoted text' &&
+		/usr/bin test 2>/dev/null x=1 awk 2>/dev/null echo awk --verbose "$@" 'quoted text'
+x=1 ${HOME} --verbose then
+		then sed $(pwd) grep awk "$1"
+		grep "$1" readonly | awk $(pwd)
+	export sed 'quoted text' -eu cd $(pwd) local done "$@" then done done | awk
+		&& echo cd cd /usr/bin "$@"
+sed awk x=1 echo echo sed cd done --verbose 2>/dev/null
+/usr/bin echo "$@" x=1 && 2>/dev/null && export "$@" | printf && done sed
+test && | x=1 --verbose -eu awk readonly export
+	echo && 'quoted text' 'quoted text' $(pwd) then test then x=1 &&
+grep sed readonly local printf done awk --verbose cd 2>/dev/null && "$1"
+		${HOME} ${HOME} x=1 local export grep printf printf done "$@" $(pwd) echo
+printf /usr/bin "$@" sed -eu cd cd /usr/bin --verbose
+	'quoted text' && $(pwd) echo awk local cd then cd echo
+		local export export echo done grep "$1"
+	readonly awk x=1 2>/dev/null test printf echo printf test --verbose --verbose
+		done export /usr/bin local printf local $(pwd) && -eu /usr/bin done --verbose
+test then | awk x=1 awk "$@" $(pwd) /usr/bin x=1 awk echo done
+		awk sed readonly sed && sed echo
+	| then | test local 'quoted text' ${HOME} done 'quoted text'
+	readonly $(pwd) x=1 'quoted text' local | "$@" x=1 local 2>/dev/null --verbose "$1"
+grep 2>/dev/null /usr/bin grep "$1"
+done "$@" export "$1" 2>/dev/null done local 2>/dev/null $(pwd)
+		"$1" printf sed -eu "$@" ${HOME} --verbose && sed readonly /usr/bin local local
+	export x=1 grep local --verbose /usr/bin "$@" grep local cd --verbose done
+	'quoted text' /usr/bin cd && test then -eu export local cd echo --verbose
+	| test 'quoted text' export -eu export /usr/bin export export
+	&& x=1 --verbose local awk export printf "$1" echo | |
+		2>/dev/null x=1 done $(pwd) then 2>/dev/null ${HOME}
+	awk | test ${HOME} grep then -eu export 2>/dev/null
+-eu done printf | readonly x=1 --verbose local sed awk ${HOME} | 2>/dev/null local
+		2>/dev/null done $(pwd) $(pwd) --verbose
+readonly awk && && done grep 2>/dev/null ${HOME}
+	awk 2>/dev/null sed cd $(pwd) test local cd test &&
+	test && done test "$@" x=1 "$1" && readonly -eu echo readonly export cd 'quoted text'
+		2>/dev/null printf grep x=1 x=1 --verbose local export
+		test done sed sed 'quoted text' 2>/dev/null /usr/bin
+		$(pwd) $(pwd) readonly sed then echo
+	awk 2>/dev/null done $(pwd)
+	readonly x=1 echo "$@" test readonly
+		then cd && $(pwd) then -eu 'quoted text' then 2>/dev/null 2>/dev/null
+		awk "$1" "$1" --verbose "$1" "$@" --verbose x=1 sed cd --verbose
+readonly done awk 2>/dev/null sed done "$@" && export then grep cd printf -eu
+done | x=1 | awk /usr/bin 2>/dev/null "$1" awk then awk cd /usr/bin
+		$(pwd) awk printf awk then local $(pwd) echo x=1 export $(pwd) | readonly
+	$(pwd) export x=1 'quoted text'
+		test "$1" local readonly $(pwd) 'quoted text' printf -eu -eu ${HOME}
+	cd /usr/bin export local done echo "$1" x=1 $(pwd) -eu then test done
+		printf -eu && 'quoted text' local echo test x=1 ${HOME} $(pwd) grep awk
+then cd awk local export x=1 echo /usr/bin --verbose
+2>/dev/null done sed sed "$1" test
+printf && awk --verbose
+-eu grep | grep then "$1" export test printf awk
+	then echo test then | printf 2>/dev/null grep readonly
+		"$1" done local --verbose export 2>/dev/null x=1 local
+	grep cd awk local printf | && cd --verbose sed export export
+	readonly echo 'quoted text' echo then && "$1" awk printf awk done awk awk
+		awk export printf 'quoted text'
+-eu test local && then x=1 echo cd done echo echo export "$1" | printf
+	printf grep $(pwd) sed
+printf readonly test echo "$1"
+		-eu then && export $(pwd) ${HOME} cd awk --verbose
+/usr/bin readonly grep grep | done "$1" done export sed test ${HOME}
+		sed x=1 done local cd x=1 grep x=1 | | echo "$1" export && cd
+		${HOME} test ${HOME} | local "$@" printf export printf
+-eu 'quoted text' local
+	"$1" readonly printf 'quoted text' cd --verbose ${HOME} test readonly
+'quoted text' awk cd x=1 echo && local then 'quoted text' grep "$1" local &&
+-eu ${HOME} done grep awk readonly
+		sed ${HOME} cd "$@" x=1 local
+x=1 export "$@" cd | cd -eu local then echo /usr/bin then && "$1" cd grep
+		2>/dev/null export cd /usr/bin ${HOME} grep x=1 -eu echo "$1" export echo
+/usr/bin -eu cd export "$1" test then "$1" /usr/bin "$1" $(pwd) grep then
+		echo | readonly $(pwd) && "$@" $(pwd) cd 2>/dev/null export 'quoted text'
+	"$1" readonly "$@" test 2>/dev/null /usr/bin /usr/bin
+		test grep done x=1 cd ${HOME} -eu "$1" sed -eu -eu | $(pwd) -eu readonly
@@ -0,0 +1,2001 @@
+	2>/dev/null "$@" | grep grep | 'quoted text' then readonly local /usr/bin
+		"$1" | cd printf test "$@" $(pwd) --verbose 2>/dev/null
+	then awk "$1" grep done cd export awk sed printf echo "$@" 'quoted text'
+	done /usr/bin ${HOME} then awk printf printf local
+		2>/dev/null echo $(pwd) ${HOME}
+		"$@" --verbose --verbose ${HOME} local printf local echo done
+'quoted text' then "$1" export printf sed "$@" sed export $(pwd) awk
+		$(pwd) done | sed then test 2>/dev/null
+		$(pwd) 2>/dev/null && -eu export && | ${HOME} /usr/bin && awk done export
+		echo --verbose cd export test $(pwd) echo "$1" ${HOME} 2>/dev/null local ${HOME}
+		--verbose --verbose sed test echo -eu cd echo $(pwd)
+		local cd 2>/dev/null done printf && ${HOME}
+"$@" done ${HOME} x=1 printf done $(pwd) then "$1" then sed done grep
+		"$@" echo $(pwd) x=1 cd &&
+	grep grep sed awk cd 2>/dev/null sed export "$@" done grep
+export ${HOME} sed awk "$@" done test /usr/bin ${HOME} readonly
+test cd local 2>/dev/null && echo awk /usr/bin then done echo
+		--verbose 'quoted text' readonly echo readonly test
+	'quoted text' test readonly -eu readonly export cd local grep readonly
+		"$@" "$1" | cd ${HOME}
+		then x=1 "$1" then 2>/dev/null $(pwd) done awk cd 'quoted text'
+		local grep grep 2>/dev/null printf
+printf "$@" done && x=1 sed
+	local export $(pwd) --verbose
+x=1 'quoted text' cd $(pwd) test | | awk awk 2>/dev/null grep
+$(pwd) local 2>/dev/null 2>/dev/null 2>/dev/null | x=1 --verbose ${HOME} && "$@"
+grep test "$@" readonly then printf done
+"$@" 'quoted text' sed -eu /usr/bin x=1 "$1" echo "$@"
+		$(pwd) local export $(pwd) local x=1 $(pwd) 'quoted text'
+echo /usr/bin 'quoted text' ${HOME} x=1 test echo && echo && $(pwd) ${HOME}
+	sed --verbose "$1" -eu grep done done
+| --verbose && echo done 2>/dev/null -eu ${HOME} awk ${HOME}
+"$1" -eu | echo "$1" --verbose 'quoted text' done ${HOME} done readonly cd x=1
+	x=1 /usr/bin done printf | && local x=1
+	export "$1" "$1" x=1 "$1" echo cd 'quoted text' grep local local &&
+		awk x=1 sed 'quoted text'
+	2>/dev/null ${HOME} /usr/bin test "$@" -eu echo printf
+		then cd cd | then then && test /usr/bin
+	echo awk then grep 2>/dev/null ${HOME} printf 'quoted text'
+readonly sed && /usr/bin ${HOME} done --verbose awk $(pwd) ${HOME}
+	readonly readonly -eu cd awk echo --verbose
+	x=1 local test x=1 "$1" echo local done 'quoted text' $(pwd) &&
+		2>/dev/null "$@" 'quoted text' grep "$1" cd grep readonly
+sed x=1 $(pwd) local ${HOME}
+		printf sed $(pwd) cd awk $(pwd) | sed grep then readonly ${HOME} export done
+		readonly test grep $(pwd)
+$(pwd) sed $(pwd) /usr/bin echo test grep "$@" 'quoted text'
+		sed sed local x=1 | "$1" grep echo printf done then "$@"
+		--verbose x=1 echo x=1
+	awk -eu echo cd ${HOME} x=1 grep && -eu cd export sed cd grep -eu x=1
+		--verbose local awk /usr/bin awk echo
+	grep echo 'quoted text' done grep | echo --verbose sed -eu awk sed /usr/bin
+		echo 2>/dev/null test $(pwd) printf "$1" && /usr/bin 'quoted text' local 'quoted text'
+sed /usr/bin -eu /usr/bin | echo "$@" /usr/bin local $(pwd)
+		done "$@" /usr/bin local -eu 2>/dev/null
+	export ${HOME} then printf
+	${HOME} printf echo 'quoted text' test readonly
+		test printf grep grep x=1 cd "$1"
+		'quoted text' test grep grep echo grep
+		test grep $(pwd) sed then $(pwd) /usr/bin
+echo 2>/dev/null export echo ${HOME} "$@" cd x=1 readonly && then awk
+echo echo local "$1" ${HOME} cd test printf 2>/dev/null
+		sed local ${HOME} -eu then
+		grep printf cd export done readonly awk 2>/dev/null
+echo grep && | grep -eu printf /usr/bin
+		then /usr/bin && $(pwd) $(pwd) local 2>/dev/null readonly
+local | awk 'quoted text' 2>/dev/null local --verbose
+	"$@" 'quoted text' local /usr/bin ${HOME}
+		/usr/bin --verbose readonly "$1" grep sed && -eu sed $(pwd) local | printf 'quoted text'
+local 2>/dev/null /usr/bin readonly "$1" awk 'quoted text'
+x=1 export /usr/bin x=1 sed sed cd 'quoted text'
+		cd printf /usr/bin then grep ${HOME} && 'quoted text' export
+		'quoted text' local printf test ${HOME} 'quoted text' grep
+	${HOME} test && 2>/dev/null | cd echo test done && sed export
+grep awk ${HOME} export
+2>/dev/null --verbose grep "$1" $(pwd) readonly then then readonly
+		--verbose "$1" awk | $(pwd) 2>/dev/null && readonly done "$@" then done
+"$1" readonly done $(pwd) ${HOME} test | x=1 2>/dev/null "$@" sed
+| $(pwd) readonly cd x=1 sed $(pwd) awk then
+	x=1 "$@" x=1 2>/dev/null | local
+	grep sed "$@" && "$@" -eu grep printf --verbose grep ${HOME} awk
+"$@" 'quoted text' 2>/dev/null | printf --verbose readonly grep local ${HOME}
+		| /usr/bin 2>/dev/null --verbose &&
+		export "$1" echo && export cd then readonly awk then
+printf "$1" sed echo 'quoted text' "$1" cd sed then export echo | "$1" | ${HOME}
+		cd grep test 'quoted text' export --verbose /usr/bin
+${HOME} 'quoted text' --verbose $(pwd) $(pwd) local test printf $(pwd) readonly
+test ${HOME} && 2>/dev/null x=1 export then ${HOME} test done 'quoted text'
+sed $(pwd) local 'quoted text'
+test $(pwd) $(pwd) $(pwd) 2>/dev/null
+	$(pwd) awk export awk
+x=1 | && --verbose printf -eu test printf 'quoted text' grep
+	$(pwd) "$1" awk x=1 'quoted text' grep x=1 "$@" ${HOME} "$@" echo "$1" x=1
+		${HOME} local 'quoted text' | "$@" printf | then then cd -eu
+		$(pwd) 'quoted text' done sed
+		awk cd 'quoted text' |
+		local done cd --verbose export done
+		--verbose $(pwd) printf -eu | 'quoted text' echo readonly
+--verbose printf 2>/dev/null | -eu x=1 2>/dev/null
+	done readonly test "$@" /usr/bin awk $(pwd) --verbose ${HOME}
+	sed --verbose readonly awk done done
+		cd export then | done -eu sed --verbose printf test ${HOME} && cd && 2>/dev/null
+		local x=1 printf 2>/dev/null echo x=1 test awk then echo x=1 "$1" x=1 'quoted text'
+2>/dev/null readonly readonly then test --verbose ${HOME} | test 2>/dev/null
+		export 'quoted text' echo 'quoted text'
+echo local echo "$1" /usr/bin 'quoted text' && x=1 cd --verbose -eu "$1" cd
+${HOME} -eu local && 2>/dev/null "$@"
+	2>/dev/null /usr/bin echo /usr/bin 'quoted text' done
+	&& done export $(pwd) sed echo local "$1" "$1" test x=1 sed /usr/bin sed
+		printf ${HOME} grep && "$@" 'quoted text' done /usr/bin
+	printf $(pwd) /usr/bin awk sed /usr/bin then "$1" &&
+		--verbose done readonly &&
+		sed ${HOME} && 'quoted text' ${HOME} $(pwd)
+	local readonly "$1" local 2>/dev/null /usr/bin && readonly
+done readonly done awk grep readonly printf local -eu | ${HOME}
+		'quoted text' then -eu && 'quoted text' readonly && printf done
+	$(pwd) grep awk awk readonly | /usr/bin
+| echo "$@" "$@" cd 'quoted text'
+		'quoted text' "$@" sed grep cd --verbose readonly
+		/usr/bin --verbose local -eu printf
+"$@" local cd printf 2>/dev/null local test sed 'quoted text'
+local grep echo "$@" echo echo sed $(pwd) done ${HOME} grep grep grep "$@"
+		sed echo readonly $(pwd) export
+	&& ${HOME} "$1" -eu -eu -eu export $(pwd) awk x=1
+	${HOME} 'quoted text' | /usr/bin
+	'quoted text' cd grep export && 2>/dev/null 2>/dev/null cd 2>/dev/null export
+		x=1 printf "$1" then 2>/dev/null done 'quoted text' | "$1" "$1" sed
+		local printf ${HOME} then --verbose && | awk
+$(pwd) 'quoted text' 2>/dev/null -eu -eu
+		done readonly --verbose readonly cd && awk printf grep "$@" 2>/dev/null x=1
+	cd ${HOME} 'quoted text' "$1" -eu -eu x=1 export "$1" "$@" ${HOME} readonly ${HOME}
+	then | ${HOME} then "$@" --verbose
+	awk $(pwd) export then 2>/dev/null
+		/usr/bin "$1" done 'quoted text' -eu readonly
+	/usr/bin "$1" test local "$@" grep export 'quoted text' grep grep
+then printf "$1" readonly 'quoted text' done done local ${HOME} printf $(pwd) "$@"
+&& | --verbose /usr/bin awk x=1 "$@" 'quoted text' done cd cd then
+		cd | echo && -eu done && cd done 2>/dev/null
+		"$@" awk ${HOME} 'quoted text' ${HOME}
+		"$1" $(pwd) local ${HOME} x=1
+		'quoted text' done export 2>/dev/null
+awk sed "$1" --verbose grep --verbose done && local
+	&& printf x=1 "$1" -eu | then ${HOME} cd awk local
+printf printf -eu cd /usr/bin awk grep && ${HOME} 'quoted text' && --verbose x=1
+-eu && export done $(pwd) sed -eu grep export "$1"
+		sed cd --verbose "$@" then 2>/dev/null
+then done 2>/dev/null 'quoted text' then cd readonly sed then --verbose
+x=1 $(pwd) export 'quoted text' done -eu export /usr/bin local x=1
+	${HOME} awk then "$@" local | done printf
+test printf 2>/dev/null
+export $(pwd) printf sed && 'quoted text' 2>/dev/null 'quoted text' grep printf
+	test ${HOME} local then 2>/dev/null $(pwd)
+		'quoted text' sed x=1 done 'quoted text' awk export -eu
+test readonly test cd export readonly
+&& x=1 printf --verbose "$1" -eu awk test cd
+"$1" | cd done && cd ${HOME} local local export
+		"$1" $(pwd) $(pwd) ${HOME} x=1 -eu | done sed $(pwd) --verbose
+		local | 'quoted text' "$1" /usr/bin /usr/bin
+	"$1" $(pwd) $(pwd) "$1" export readonly "$@" -eu |
+awk printf $(pwd) grep then "$@" cd ${HOME} /usr/bin --verbose awk awk done
+		local sed 'quoted text' && -eu then /usr/bin
+sed "$1" $(pwd) | /usr/bin
+| "$@" printf readonly local -eu ${HOME} | ${HOME} --verbose ${HOME}
+	echo then cd export --verbose export done ${HOME} done /usr/bin "$@"
+	cd "$@" | sed x=1 grep $(pwd) echo echo 'quoted text' readonly
+	done local echo 2>/dev/null
+	-eu 'quoted text' $(pwd) x=1 cd | done --verbose export
+		cd $(pwd) export /usr/bin awk ${HOME} done
+--verbose --verbose /usr/bin -eu test echo export && /usr/bin local /usr/bin echo
+	| local "$1" "$1" 'quoted text' export
+local --verbose export grep sed grep "$1" "$@" readonly -eu x=1 "$1" awk
+		grep 2>/dev/null 2>/dev/null | "$@" grep -eu grep
+readonly echo "$@" export sed "$@"
+		grep cd readonly printf cd --verbose --verbose sed -eu cd 2>/dev/null -eu
+sed export && 2>/dev/null test cd local echo export | local cd "$1" export then
+	&& awk ${HOME} export /usr/bin then /usr/bin && export readonly
+		2>/dev/null $(pwd) x=1 -eu
+		${HOME} 'quoted text' sed sed export test
+		test echo then done x=1 "$1" "$@" && /usr/bin readonly local /usr/bin
+		'quoted text' $(pwd) 2>/dev/null test | $(pwd) "$1" readonly awk ${HOME}
+	$(pwd) awk sed && readonly
+		awk then 2>/dev/null local $(pwd) ${HOME} cd awk && local x=1 x=1 && export
+-eu grep grep $(pwd) "$@" sed "$@"
+	&& printf | export printf "$1" x=1 local 'quoted text'
+	"$1" 2>/dev/null cd echo
+	awk local $(pwd) cd echo readonly | grep then "$1" "$1" | awk awk
+		then sed test test readonly readonly test ${HOME}
+	echo echo x=1 then ${HOME} export | cd $(pwd)
+/usr/bin && -eu echo echo --verbose export 'quoted text'
+/usr/bin sed grep --verbose
+	awk sed ${HOME} "$@" -eu sed grep --verbose echo 'quoted text' awk
+		grep printf --verbose sed ${HOME} sed done ${HOME} export 'quoted text' $(pwd)
+-eu /usr/bin "$@" ${HOME} --verbose cd --verbose awk 'quoted text'
+printf /usr/bin 2>/dev/null 'quoted text' -eu readonly done "$@" "$1"
+		grep printf done cd 'quoted text'
+	/usr/bin x=1 echo readonly sed /usr/bin 'quoted text' readonly grep
+		awk 'quoted text' ${HOME} grep 'quoted text' 'quoted text' "$@"
+printf $(pwd) echo awk x=1 echo 'quoted text' "$@" echo done awk $(pwd)
+2>/dev/null $(pwd) "$1" awk 'quoted text' && $(pwd)
+		${HOME} 'quoted text' ${HOME} --verbose test | done grep printf
+		x=1 x=1 readonly echo echo
+	then -eu done && x=1 export cd sed $(pwd) readonly sed -eu /usr/bin awk "$@" 'quoted text'
+	&& awk "$@" then echo 2>/dev/null "$@" x=1 2>/dev/null
+		x=1 export ${HOME} ${HOME} | "$@" 2>/dev/null export && ${HOME} then
+		/usr/bin export readonly test readonly test "$1" awk -eu
+		readonly x=1 cd done --verbose done awk
+	&& echo "$@" printf -eu echo $(pwd) | x=1 "$1"
+x=1 grep --verbose $(pwd) 2>/dev/null test
+-eu done local echo readonly -eu | echo ${HOME}
+test "$1" ${HOME} x=1 2>/dev/null readonly --verbose |
+	2>/dev/null /usr/bin -eu /usr/bin x=1 readonly grep sed $(pwd) 'quoted text' $(pwd)
+sed sed -eu ${HOME} &&
+		'quoted text' 'quoted text' then "$1"
+		$(pwd) sed grep 'quoted text'
+grep 'quoted text' local x=1 printf sed | /usr/bin 'quoted text'
+		awk && "$@" 2>/dev/null x=1 sed
+	test echo awk local 2>/dev/null
+		sed export | && done --verbose
+		| readonly awk /usr/bin test 'quoted text' 2>/dev/null
+cd && printf export 'quoted text'
+	readonly 2>/dev/null -eu $(pwd)
+		awk cd --verbose "$@" grep | grep echo readonly "$1" done echo -eu sed
+	awk grep | local printf
+		grep grep && readonly "$@" -eu && printf 'quoted text'
+		readonly grep "$@" cd cd
+	&& "$1" local sed "$1" "$@" 2>/dev/null x=1 'quoted text' done $(pwd)
+	/usr/bin "$@" awk -eu 'quoted text' then printf then
+then printf done echo "$1"
+	printf --verbose echo && grep x=1 $(pwd)
+		echo /usr/bin awk $(pwd) 'quoted text' x=1 x=1 test -eu grep x=1 2>/dev/null
+	${HOME} 'quoted text' 'quoted text' ${HOME} -eu local readonly 2>/dev/null
+		test x=1 cd $(pwd) grep
+-eu export /usr/bin done /usr/bin --verbose /usr/bin 'quoted text' then
+		cd test printf 'quoted text' -eu cd printf
+"$1" echo $(pwd) readonly local "$@" sed
+'quoted text' cd readonly 2>/dev/null sed echo -eu
+"$1" done x=1 && | sed export export 2>/dev/null /usr/bin echo local cd awk export
+		/usr/bin test x=1 -eu test test sed 'quoted text' 'quoted text' "$1"
+	then export 'quoted text' ${HOME} done "$1" local --verbose
+		local 'quoted text' sed "$1" test x=1 export readonly
+	grep $(pwd) done awk done test "$1"
+	echo -eu ${HOME} --verbose printf
+	grep -eu grep $(pwd) /usr/bin export -eu /usr/bin local x=1 done
+		echo printf /usr/bin echo then && "$@" then --verbose ${HOME} x=1 printf
+		&& awk --verbose sed export x=1 printf "$@" echo 2>/dev/null grep
+-eu | --verbose 'quoted text' printf ${HOME} done /usr/bin done --verbose readonly
+		echo export awk --verbose cd test "$1" ${HOME} printf echo | export ${HOME}
+	--verbose export readonly && ${HOME} /usr/bin export local printf $(pwd)
+	"$1" "$@" awk export 2>/dev/null "$1"
+	&& printf echo && local local awk test x=1 awk 'quoted text' x=1 sed --verbose
+		grep local local awk test done ${HOME} -eu done local x=1 "$1" export
+		printf "$@" test test "$1" ${HOME} "$1" test readonly 2>/dev/null
+	/usr/bin ${HOME} --verbose export awk 2>/dev/null && -eu 2>/dev/null
+		test | $(pwd) "$@" $(pwd) echo 'quoted text' done ${HOME} | awk export
+		awk local ${HOME} 2>/dev/null export "$@" x=1 "$@" "$1" /usr/bin
+test cd ${HOME} printf awk --verbose
+export x=1 'quoted text' local
+	'quoted text' && x=1 done local sed test printf then readonly 'quoted text'
+	/usr/bin && /usr/bin then 2>/dev/null awk x=1 -eu readonly "$@" done done 2>/dev/null
+		test sed -eu test test export && 2>/dev/null
+	done echo test cd x=1 "$@" | printf test done /usr/bin readonly
+"$@" ${HOME} $(pwd) "$1"
+		printf 2>/dev/null cd cd cd export --verbose awk readonly awk export -eu
+then | ${HOME} awk awk ${HOME} && done --verbose test
+		printf --verbose | --verbose /usr/bin awk && then /usr/bin | 2>/dev/null
+		printf echo --verbose 'quoted text' -eu -eu export then
+		echo | $(pwd) printf local cd $(pwd) test
+awk test then /usr/bin done export done awk "$1"
+	cd echo test "$1" local grep local ${HOME} echo cd test "$1"
+	&& export then local ${HOME}
+	--verbose 2>/dev/null then grep sed done then "$1" $(pwd) then "$@" ${HOME} && $(pwd)
+	2>/dev/null awk $(pwd) done /usr/bin --verbose $(pwd) cd printf sed done 2>/dev/null
+$(pwd) 2>/dev/null done printf | printf && awk -eu
+	then awk then 'quoted text' export readonly /usr/bin
+	export -eu awk local done local --verbose awk --verbose readonly
+	grep ${HOME} printf local local awk --verbose test then "$@"
+	echo $(pwd) then 2>/dev/null x=1 awk --verbose /usr/bin grep
+x=1 echo export awk test sed sed sed export 'quoted text' local |
+cd sed sed $(pwd) "$@" x=1 grep 'quoted text' $(pwd) grep &&
+	2>/dev/null sed echo sed 2>/dev/null cd x=1
+		${HOME} /usr/bin ${HOME} -eu export done 2>/dev/null
+printf && 'quoted text' done
+-eu --verbose -eu | && ${HOME} export $(pwd) "$@" awk test export cd echo
+/usr/bin export export local -eu 2>/dev/null --verbose
+	"$1" $(pwd) | --verbose
+done /usr/bin -eu done
+		-eu readonly x=1 'quoted text' done 2>/dev/null ${HOME}
+2>/dev/null && then /usr/bin && test echo echo then 'quoted text'
+cd && -eu /usr/bin $(pwd)
+export grep ${HOME} ${HOME}
+2>/dev/null readonly readonly
+	awk local /usr/bin cd local done "$@" $(pwd) x=1 --verbose readonly && x=1 /usr/bin
+export awk readonly awk "$@" && x=1 done test ${HOME}
+		${HOME} --verbose local printf
+		x=1 "$1" "$@" /usr/bin 2>/dev/null | export local 2>/dev/null sed 2>/dev/null
+		printf printf test x=1 | && export $(pwd) 2>/dev/null && |
+-eu /usr/bin sed /usr/bin "$1" 2>/dev/null 2>/dev/null | "$1" --verbose
+/usr/bin 2>/dev/null "$1" readonly sed awk 2>/dev/null readonly
+"$@" export "$1" echo then $(pwd) cd then local cd x=1 "$1" then /usr/bin 'quoted text'
+	/usr/bin $(pwd) test 'quoted text' sed ${HOME} cd cd test 'quoted text'
+local export 2>/dev/null ${HOME}
+	/usr/bin "$@" x=1 export test printf awk "$1" cd "$1" "$1" "$1" "$1" test
+		x=1 $(pwd) 2>/dev/null 2>/dev/null 'quoted text' export export done grep readonly
+	echo x=1 test echo local 'quoted text'
+printf && then local echo "$@" cd readonly 'quoted text'
+"$@" readonly readonly
+export sed done printf 2>/dev/null
+		/usr/bin cd done local "$1" 'quoted text' 'quoted text' printf $(pwd)
+sed x=1 'quoted text' /usr/bin sed grep $(pwd) | && cd 'quoted text'
+		-eu && sed awk /usr/bin
+-eu "$@" "$@" echo "$1" printf then sed export
+	--verbose -eu sed echo export /usr/bin readonly
+		export awk export export ${HOME} 2>/dev/null
+echo $(pwd) printf sed -eu printf /usr/bin export
+	local && test readonly "$1" sed then cd cd readonly echo $(pwd) export
+cd test local "$@" test /usr/bin --verbose cd -eu grep && export "$1"
+	then $(pwd) then -eu $(pwd)
+		--verbose --verbose | --verbose --verbose 'quoted text'
+	readonly 2>/dev/null -eu --verbose
+$(pwd) -eu 'quoted text' sed "$1" $(pwd) /usr/bin
+	-eu readonly 'quoted text' /usr/bin "$@" "$@" |
+sed sed done readonly -eu
+"$@" 'quoted text' -eu 'quoted text' --verbose awk "$@" "$@"
+readonly x=1 done cd test "$1" echo test 'quoted text' |
+x=1 echo echo echo x=1 | then "$1" then then printf sed -eu $(pwd) /usr/bin
+	-eu sed 2>/dev/null readonly
+test $(pwd) then export cd ${HOME} local 2>/dev/null "$@"
+		awk "$1" then echo 'quoted text' done "$1" "$1" sed --verbose x=1 /usr/bin
+	${HOME} x=1 printf && "$@"
+	readonly sed /usr/bin printf printf readonly cd x=1 ${HOME}
+	done readonly readonly "$1" --verbose readonly
+		echo test export $(pwd) 'quoted text' sed
+local /usr/bin "$@" | printf x=1 export
+x=1 $(pwd) local | awk x=1 then
+then "$1" -eu local 'quoted text' done sed "$1" x=1 local local 2>/dev/null
+echo echo export $(pwd) echo grep grep 'quoted text' "$1" readonly
+export /usr/bin then && done awk export ${HOME} $(pwd) 2>/dev/null $(pwd) test
+	$(pwd) ${HOME} 2>/dev/null $(pwd) /usr/bin
+		'quoted text' $(pwd) printf readonly export echo --verbose | x=1 ${HOME}
+		"$1" cd 'quoted text' /usr/bin done local 'quoted text' 'quoted text'
+	printf local x=1 && test export
+	| then "$1" 'quoted text' /usr/bin export "$@" | 2>/dev/null sed readonly
+	awk --verbose grep "$1"
+	done --verbose cd export x=1 2>/dev/null readonly readonly test |
+	export readonly x=1 2>/dev/null 'quoted text' | "$1"
+		test grep /usr/bin grep awk /usr/bin cd echo "$1" done --verbose test x=1 test
+		sed grep x=1 awk 2>/dev/null cd /usr/bin ${HOME} "$@"
+	${HOME} "$1" then /usr/bin | "$1" "$1"
+	awk /usr/bin "$@" grep && done
+		--verbose ${HOME} /usr/bin test cd 2>/dev/null test test
+	printf test sed 'quoted text' done x=1 && x=1 /usr/bin then printf test ${HOME}
+	printf -eu then test readonly grep test local export
+		&& printf export x=1 grep --verbose local "$@" export test "$1" "$1" | cd
+test /usr/bin export grep cd grep cd done "$@" /usr/bin /usr/bin ${HOME}
+		&& 'quoted text' local awk x=1 ${HOME} $(pwd) 'quoted text' printf
+awk local printf local 'quoted text' && then
+		-eu $(pwd) test 2>/dev/null /usr/bin sed readonly export test -eu
+		'quoted text' && /usr/bin && $(pwd) -eu "$@"
+		echo echo /usr/bin $(pwd) --verbose export /usr/bin export
+		grep cd then then /usr/bin 'quoted text' then readonly then done
+echo printf --verbose x=1 | 'quoted text' printf x=1 export --verbose
+		| export "$1" export local export "$1" grep ${HOME} ${HOME} cd /usr/bin local
+		--verbose 2>/dev/null 2>/dev/null --verbose x=1 | $(pwd) --verbose cd sed test
+--verbose -eu && -eu test then 'quoted text' $(pwd) test --verbose done done cd
+awk --verbose "$@" "$@" ${HOME} printf awk test && "$1" && grep $(pwd)
+	grep readonly then grep ${HOME} sed $(pwd) /usr/bin ${HOME} -eu
+readonly sed "$1" 2>/dev/null "$1" /usr/bin readonly "$1"
+	export grep then readonly ${HOME} test --verbose
+		grep printf && -eu 'quoted text' then
+		cd $(pwd) local then "$@" x=1 awk
+| $(pwd) /usr/bin done "$1" -eu echo
+	local "$1" done local readonly 2>/dev/null
+	${HOME} echo grep export
+'quoted text' "$1" then grep
+		awk sed 2>/dev/null sed sed "$@" echo /usr/bin
+		/usr/bin echo then cd "$1" -eu export -eu export then
+"$1" | /usr/bin then x=1 awk printf local done | -eu echo
+		awk done 2>/dev/null grep done readonly test
+		&& && 2>/dev/null local 'quoted text' test test readonly
+	| $(pwd) then "$@" then x=1 printf /usr/bin awk --verbose export
+	readonly "$@" -eu grep sed 'quoted text' && $(pwd)
+		x=1 2>/dev/null /usr/bin && /usr/bin
+		sed --verbose awk printf -eu ${HOME} "$1" awk export --verbose "$@" readonly
+		test 'quoted text' && "$1" local awk grep sed /usr/bin $(pwd) "$1" printf
+grep readonly ${HOME}
+printf export $(pwd) local
+	&& local $(pwd) local "$1" "$@"
+		"$1" 'quoted text' test -eu | local ${HOME} --verbose
+/usr/bin test awk grep sed ${HOME} | "$1" "$1" printf ${HOME}
+	2>/dev/null cd ${HOME} --verbose
+	x=1 echo /usr/bin cd ${HOME} 2>/dev/null 'quoted text' /usr/bin
+		local x=1 && cd -eu done grep test $(pwd)
+		local 'quoted text' /usr/bin -eu echo
+		awk ${HOME} readonly grep -eu | $(pwd) grep echo ${HOME}
+readonly | done then ${HOME}
+	"$@" | readonly | --verbose echo "$@" 'quoted text'
+		--verbose printf | "$1" done readonly grep "$1" cd echo | 'quoted text'
+	/usr/bin -eu "$@" --verbose readonly 2>/dev/null $(pwd) readonly 'quoted text'
+		2>/dev/null /usr/bin "$@" echo local $(pwd) 2>/dev/null "$1" /usr/bin --verbose
+	cd export 2>/dev/null -eu /usr/bin x=1 local
+/usr/bin $(pwd) "$1" printf grep 'quoted text' sed 'quoted text'
+${HOME} export 'quoted text' ${HOME} test ${HOME} done 2>/dev/null $(pwd) 'quoted text'
+	awk $(pwd) -eu readonly 'quoted text'
+	"$1" sed /usr/bin "$1" "$1" cd /usr/bin
+&& x=1 'quoted text'
+2>/dev/null test | readonly grep printf done test test
+/usr/bin done echo done -eu grep cd test awk echo 'quoted text'
+2>/dev/null -eu echo sed "$@" 2>/dev/null awk -eu x=1 2>/dev/null
+"$1" | sed 2>/dev/null grep 'quoted text' sed "$@" printf 'quoted text'
+		cd x=1 readonly test $(pwd) "$1"
+printf $(pwd) done -eu printf sed ${HOME} local done
+	done -eu $(pwd) 2>/dev/null grep test $(pwd) --verbose 'quoted text'
+	test ${HOME} $(pwd) printf readonly sed awk --verbose 2>/dev/null && 2>/dev/null
+| && echo local /usr/bin printf ${HOME} grep --verbose local /usr/bin local
+echo test 'quoted text' &&
+	printf printf -eu --verbose /usr/bin 'quoted text' x=1 test /usr/bin echo
+		printf sed "$@" && /usr/bin "$1" --verbose $(pwd) && /usr/bin
+	$(pwd) readonly -eu printf cd "$1" readonly
+		"$1" test local readonly sed local awk sed 2>/dev/null
+$(pwd) 'quoted text' --verbose
+		sed test ${HOME} /usr/bin local local awk readonly readonly $(pwd) local
+	echo then awk readonly readonly ${HOME} /usr/bin grep readonly grep done local
+	test "$1" "$@" echo 2>/dev/null readonly
+| awk --verbose sed grep sed
+	-eu done sed cd sed ${HOME} "$1" echo echo test /usr/bin $(pwd) then done readonly
+printf | then -eu sed echo --verbose /usr/bin echo "$@" readonly &&
+		local "$1" ${HOME} /usr/bin 2>/dev/null | printf export -eu export
+x=1 -eu local 'quoted text' x=1 ${HOME} echo 2>/dev/null
+	"$@" 'quoted text' awk
+"$1" done "$1" x=1 cd ${HOME} then ${HOME} /usr/bin awk grep --verbose
+'quoted text' awk cd readonly awk local | $(pwd) cd --verbose export then awk
+&& test awk awk cd -eu awk && ${HOME} $(pwd) echo $(pwd) 'quoted text'
+	cd readonly cd local | awk 'quoted text' local 'quoted text'
+		printf -eu awk "$1" | x=1 readonly
+then awk "$1" --verbose && | export sed done ${HOME}
+		-eu 'quoted text' | readonly sed
+		2>/dev/null "$@" -eu readonly && done "$@" --verbose /usr/bin
+	test "$@" 2>/dev/null --verbose && local
+	${HOME} readonly -eu ${HOME} -eu /usr/bin echo awk echo awk --verbose
+	export sed echo printf grep readonly echo x=1 2>/dev/null
+		done awk then $(pwd) /usr/bin "$@" local local -eu then 2>/dev/null "$@" sed
+		"$@" 2>/dev/null $(pwd) x=1 readonly printf "$@" printf "$1"
+	test cd printf 2>/dev/null grep -eu | local printf test cd $(pwd) /usr/bin
+done -eu 2>/dev/null && "$@"
+		&& 2>/dev/null --verbose done done 'quoted text'
+	done ${HOME} --verbose printf | test "$1" printf
+echo ${HOME} "$1" awk export readonly printf grep 2>/dev/null $(pwd) sed "$1"
+	$(pwd) "$@" echo test /usr/bin
+		awk printf 2>/dev/null cd --verbose 'quoted text' local readonly $(pwd) 2>/dev/null
+local "$@" readonly printf --verbose "$1" cd x=1 'quoted text'
+	"$1" -eu --verbose grep export export
+	readonly -eu awk printf x=1 && done "$@"
+		${HOME} x=1 export -eu 'quoted text' | then local 'quoted text' "$1" -eu
+		| --verbose readonly --verbose && local then | then "$1" /usr/bin
+	'quoted text' awk -eu grep grep | cd /usr/bin && test
+$(pwd) export echo --verbose x=1 sed then then sed local export readonly
+	export $(pwd) "$@" "$1"
+x=1 export readonly printf cd "$@" 'quoted text'
+'quoted text' printf echo awk test -eu local "$@" export $(pwd) --verbose $(pwd)
+	test -eu then then readonly then awk 'quoted text' echo --verbose awk && "$1"
+awk "$@" "$@" /usr/bin 'quoted text' "$1" | done
+		"$1" --verbose /usr/bin printf -eu readonly awk | 2>/dev/null sed test cd x=1
+	local awk --verbose done 'quoted text' awk 'quoted text'
+	${HOME} -eu cd grep cd 2>/dev/null
+		-eu && 2>/dev/null --verbose "$@" ${HOME} --verbose
+		/usr/bin x=1 sed ${HOME} && | awk -eu local awk
+printf then 2>/dev/null then test export export test awk /usr/bin 2>/dev/null
+		test readonly | && local export "$1" export cd |
+		${HOME} "$@" grep 2>/dev/null export /usr/bin "$@" --verbose
+		$(pwd) /usr/bin $(pwd) ${HOME} /usr/bin ${HOME} done && | --verbose
+		grep then test printf | awk x=1 readonly
+	$(pwd) local echo && printf /usr/bin $(pwd) readonly ${HOME} | 'quoted text'
+	'quoted text' readonly 'quoted text' echo then 2>/dev/null grep
+echo cd -eu x=1 cd 2>/dev/null then
+		x=1 test --verbose "$1" 'quoted text' done cd ${HOME}
+		| && then echo x=1 "$@" $(pwd) test then
+then cd ${HOME} export test 2>/dev/null
+		awk grep -eu done sed | /usr/bin
+		| "$@" then grep readonly /usr/bin 2>/dev/null x=1 grep
+"$@" /usr/bin -eu $(pwd) x=1 2>/dev/null grep readonly -eu x=1
+"$1" readonly export awk $(pwd) | export local $(pwd) awk x=1
+printf $(pwd) ${HOME} readonly then
+export then && grep grep $(pwd) awk |
+	"$1" done /usr/bin printf printf $(pwd) local | grep | ${HOME} grep
+	then -eu x=1 printf awk ${HOME} && readonly
+		$(pwd) 'quoted text' grep echo /usr/bin then /usr/bin echo
+	sed cd done cd readonly done then done 'quoted text' x=1 ${HOME}
+echo | && export export $(pwd) "$1" echo sed "$1" cd export export
+		local | test && then 2>/dev/null export grep &&
+done ${HOME} test test "$@" 'quoted text' 2>/dev/null && echo sed test
+	-eu 'quoted text' export
+	grep ${HOME} x=1 export && x=1 awk grep 'quoted text' export awk readonly $(pwd)
+	/usr/bin "$@" echo && readonly --verbose
+		readonly && cd test test readonly
+	-eu sed done --verbose cd grep grep 'quoted text'
+	export 'quoted text' /usr/bin grep --verbose echo done "$1" | -eu export
+grep local -eu | cd 2>/dev/null -eu done 2>/dev/null --verbose
+sed sed && 'quoted text' readonly /usr/bin then then $(pwd)
+	2>/dev/null export cd done 2>/dev/null
+printf /usr/bin $(pwd) /usr/bin | /usr/bin
+	/usr/bin && /usr/bin ${HOME} 2>/dev/null echo echo 'quoted text' "$1"
+	awk grep /usr/bin export $(pwd) export /usr/bin "$@"
+	readonly readonly /usr/bin -eu | 'quoted text' /usr/bin /usr/bin
+		x=1 ${HOME} /usr/bin printf export cd
+&& ${HOME} export readonly -eu printf sed 'quoted text' sed
+		test && 2>/dev/null 2>/dev/null sed
+		test export awk readonly echo "$@" then x=1
+		printf local cd $(pwd)
+cd --verbose "$1" 2>/dev/null cd cd readonly sed then "$@"
+printf $(pwd) ${HOME}
+	2>/dev/null -eu "$1" local && --verbose | printf printf $(pwd) $(pwd) $(pwd) --verbose
+local x=1 printf -eu "$@" x=1 --verbose ${HOME} local
+		"$1" -eu --verbose done && -eu then printf
+		x=1 echo ${HOME} sed "$1" echo test "$@" echo -eu test "$@" sed 'quoted text'
+| -eu awk 2>/dev/null "$1" /usr/bin printf done
+2>/dev/null test && sed | grep 2>/dev/null /usr/bin local
+sed echo $(pwd) | local cd ${HOME} printf 'quoted text'
+2>/dev/null then then /usr/bin "$1" 2>/dev/null printf echo | 'quoted text'
+	export | 'quoted text'
+	${HOME} "$@" "$1" /usr/bin | 2>/dev/null
+	$(pwd) /usr/bin sed local | 2>/dev/null -eu "$1" awk && --verbose 2>/dev/null
+&& | export && 'quoted text' readonly "$1" -eu ${HOME} sed
+	grep local -eu sed then /usr/bin local done | $(pwd) ${HOME} grep done /usr/bin
+	sed $(pwd) $(pwd) grep ${HOME}
+sed export x=1 local | grep /usr/bin then
+		local x=1 sed ${HOME} then -eu cd $(pwd) "$@" $(pwd) /usr/bin "$1"
+	--verbose x=1 readonly local local local then "$@" /usr/bin ${HOME}
+	then printf --verbose 'quoted text'
+		"$1" 'quoted text' --verbose -eu sed local sed readonly "$@" -eu 2>/dev/null
+		cd printf echo $(pwd) | test && && "$@" /usr/bin local then local
+$(pwd) "$1" /usr/bin "$@" awk awk /usr/bin cd 'quoted text' export
+	| "$@" "$1" 'quoted text' $(pwd)
+cd && grep awk grep sed awk awk local local local export awk then "$@"
+		/usr/bin ${HOME} then then done 2>/dev/null --verbose
+sed | done cd 'quoted text' export $(pwd) readonly grep then 'quoted text' 'quoted text'
+	readonly done | && then then 'quoted text' awk $(pwd) ${HOME}
+	then x=1 awk done && | 'quoted text' local x=1 2>/dev/null && test "$1"
+$(pwd) grep echo sed x=1 sed export "$@"
+x=1 | "$@" readonly awk $(pwd) && "$1" test -eu export "$@" local
+		local then | then -eu sed x=1 'quoted text' /usr/bin awk
+	2>/dev/null "$1" printf "$@" "$1" echo local "$1" done -eu printf local grep sed
+echo | export && sed export ${HOME} "$1" readonly
+		local echo printf done && readonly cd echo readonly $(pwd)
+$(pwd) --verbose -eu then ${HOME} local test test /usr/bin
+	$(pwd) awk test cd "$@" | echo
+		grep 'quoted text' export 'quoted text'
+		readonly sed cd 2>/dev/null $(pwd) "$1" readonly "$1" && sed -eu 'quoted text'
+	test /usr/bin then done
+		&& "$@" local -eu /usr/bin && --verbose
+		"$@" sed grep then && done grep test "$@"
+		export -eu 'quoted text' sed -eu test test x=1 printf "$@" ${HOME} awk done
+		2>/dev/null sed $(pwd) cd echo sed local export 'quoted text' then
+	sed local ${HOME} 2>/dev/null --verbose && | -eu printf echo grep awk grep x=1
+2>/dev/null && 'quoted text' --verbose && $(pwd) echo done local "$@" cd 'quoted text'
+readonly && cd x=1 awk printf "$@" /usr/bin && $(pwd) echo grep then -eu
+		"$@" grep printf | 'quoted text' /usr/bin echo sed
+	"$@" test ${HOME} echo local "$1" ${HOME} sed grep
+	$(pwd) --verbose 'quoted text' awk --verbose
+		/usr/bin export test ${HOME} sed echo && echo sed echo "$1"
+-eu done readonly | done printf 'quoted text' 'quoted text' grep x=1
+"$@" then | local sed $(pwd) --verbose /usr/bin
+export readonly "$1" then readonly
+export readonly done && "$1" awk 'quoted text'
+		local grep then 'quoted text' then sed 2>/dev/null 2>/dev/null
+--verbose --verbose done local x=1 'quoted text' then 'quoted text' cd test
+then /usr/bin printf && | test echo printf && x=1 echo export "$@" | $(pwd)
+printf /usr/bin && then readonly
+	2>/dev/null then echo sed && readonly "$1" sed ${HOME} done ${HOME} export
+&& grep --verbose ${HOME} then 'quoted text' 2>/dev/null | local ${HOME} local ${HOME}
+	then readonly local "$@" export grep --verbose readonly && cd -eu --verbose
+$(pwd) echo awk test local 2>/dev/null test readonly x=1 2>/dev/null
+		"$1" | echo then export awk /usr/bin $(pwd) test | then x=1 printf 'quoted text'
+2>/dev/null /usr/bin "$1" export --verbose /usr/bin
+	| /usr/bin echo ${HOME}
+	readonly printf ${HOME}
+		| printf | grep cd 'quoted text' 2>/dev/null awk awk
+	${HOME} $(pwd) 'quoted text' done --verbose $(pwd)
+		sed && readonly local echo cd && $(pwd) printf
+		&& sed 2>/dev/null grep $(pwd) awk sed test | ${HOME} 'quoted text'
+x=1 $(pwd) -eu && $(pwd) test readonly
+	printf ${HOME} | local cd $(pwd) grep readonly awk 2>/dev/null $(pwd) &&
+		printf "$@" 'quoted text'
+"$1" $(pwd) printf &&
+	"$1" done x=1 'quoted text'
+-eu sed done awk $(pwd) -eu readonly test /usr/bin --verbose readonly sed printf
+		printf /usr/bin "$@" -eu
+awk /usr/bin && readonly local export | awk -eu done
+"$1" /usr/bin && then export done && readonly cd "$1" cd && grep printf export
+		'quoted text' then printf cd ${HOME} $(pwd) awk --verbose "$@"
+test test --verbose "$@" test export "$@" /usr/bin printf printf done awk
+	export $(pwd) "$1" echo $(pwd) test 2>/dev/null printf export test --verbose
+	readonly awk -eu $(pwd) printf | cd /usr/bin
+export printf 2>/dev/null
+		$(pwd) --verbose export readonly && cd readonly sed 2>/dev/null && done test
+	2>/dev/null printf test
+2>/dev/null 2>/dev/null $(pwd) "$@" cd then $(pwd) readonly
+		"$1" echo 2>/dev/null ${HOME} | 'quoted text' "$1" cd printf
+test /usr/bin awk $(pwd) --verbose printf export --verbose $(pwd) done printf
+	$(pwd) "$1" grep awk "$1" x=1 done
+	export $(pwd) | local printf cd 'quoted text' cd echo /usr/bin local
+		echo 'quoted text' test awk $(pwd) export "$1" sed ${HOME} export export done
+2>/dev/null echo done test grep cd | "$@" sed sed | && x=1 printf ${HOME}
+		awk cd printf --verbose readonly sed cd | /usr/bin $(pwd) awk export && ${HOME}
+		--verbose cd printf grep readonly
+		printf 'quoted text' /usr/bin
+	-eu x=1 export then sed sed && echo cd /usr/bin "$@" readonly done 'quoted text'
+	done ${HOME} done ${HOME}
+		"$@" grep 'quoted text' echo -eu cd cd test export echo cd done then
+	--verbose export && echo /usr/bin grep test "$1" | test cd "$1" then
+awk x=1 --verbose sed test export "$@" ${HOME} && "$1" cd then /usr/bin "$1" |
+	--verbose && awk test x=1
+$(pwd) "$1" test test sed --verbose printf 2>/dev/null
+"$1" | --verbose sed then then test $(pwd) done test echo echo -eu 2>/dev/null
+	awk local "$@" grep x=1 --verbose 2>/dev/null cd printf
+		sed -eu grep test done /usr/bin $(pwd) "$1" "$@" ${HOME} ${HOME}
+then sed --verbose readonly $(pwd) | printf 'quoted text'
+	then sed | grep -eu && --verbose ${HOME} sed then then --verbose echo
+		sed ${HOME} | | cd cd printf readonly
+printf readonly 'quoted text'
+		done grep $(pwd) && ${HOME} echo $(pwd) -eu export export && 'quoted text'
+	cd grep 2>/dev/null printf export done "$@" export 'quoted text'
+sed $(pwd) test echo test
+		sed export printf readonly "$@" awk x=1
+		"$@" x=1 done && ${HOME}
+readonly x=1 export printf export grep export printf awk echo
+		test x=1 done -eu sed 2>/dev/null then then
+		${HOME} | $(pwd) -eu export cd "$1" local
+	awk cd 'quoted text' | ${HOME}
+		2>/dev/null -eu cd $(pwd) ${HOME} --verbose test 2>/dev/null
+		grep sed $(pwd) $(pwd) done 'quoted text'
+"$@" 'quoted text' then --verbose grep
+readonly cd cd export then "$1" && readonly $(pwd) x=1 sed sed ${HOME} ${HOME}
+		--verbose echo | printf sed ${HOME} printf awk local $(pwd) x=1 awk --verbose
+		'quoted text' x=1 'quoted text' 2>/dev/null printf
+	&& sed readonly "$@" then --verbose 'quoted text' echo "$@" then awk done
+	"$@" awk --verbose "$1" sed | test && /usr/bin test readonly cd "$@" cd grep
+	'quoted text' readonly -eu | readonly
+	/usr/bin ${HOME} export test printf test /usr/bin
+		| then sed cd local x=1 done awk 2>/dev/null 2>/dev/null cd
+		readonly 'quoted text' --verbose && local 'quoted text' | sed then sed sed $(pwd)
+--verbose done $(pwd) echo printf printf 'quoted text' grep
+	then then cd "$1" && -eu cd 2>/dev/null awk "$@" echo local awk 'quoted text'
+"$1" grep done readonly "$1" awk sed -eu 'quoted text'
+		local x=1 /usr/bin then "$1" readonly 'quoted text' "$@" then 2>/dev/null
+		then --verbose export cd grep ${HOME}
+	then printf test ${HOME} export awk 2>/dev/null -eu echo -eu "$@" export
+	export ${HOME} x=1 2>/dev/null && $(pwd) printf "$@" export
+	-eu "$@" "$@" then | grep | /usr/bin sed cd cd done 2>/dev/null 'quoted text' "$1"
+${HOME} "$@" --verbose x=1
+/usr/bin $(pwd) done --verbose 2>/dev/null sed 2>/dev/null --verbose
+	done grep test cd cd done sed && grep | export test grep cd && 2>/dev/null
+		local export cd export 'quoted text' -eu --verbose export
+sed x=1 | /usr/bin printf ${HOME}
+2>/dev/null export cd /usr/bin grep sed && test x=1 /usr/bin echo 2>/dev/null
+sed readonly && "$@" | x=1 x=1 test && sed cd awk | local /usr/bin
+	export local "$@" done grep "$1" then x=1 | | && grep "$@" "$@" /usr/bin cd
+		sed local sed done local
+		readonly 'quoted text' ${HOME} "$@" x=1
+-eu "$1" --verbose ${HOME} "$1" echo /usr/bin
+sed --verbose -eu awk -eu awk export /usr/bin
+		export -eu x=1 cd x=1 local "$1" cd local
+		done done cd test /usr/bin $(pwd)
+$(pwd) done "$1" readonly
+		2>/dev/null local cd 'quoted text' && | readonly done /usr/bin "$1" && done |
+export | 2>/dev/null --verbose local $(pwd) done "$1" local
+	/usr/bin "$1" grep test -eu test
+	printf && "$1" 2>/dev/null 2>/dev/null cd grep /usr/bin export $(pwd) | awk awk
+sed grep 2>/dev/null done cd ${HOME} -eu ${HOME}
+printf echo echo --verbose
+	${HOME} local "$1" then done
+cd printf done "$@" $(pwd) awk awk --verbose
+		echo | test $(pwd) local printf echo grep echo awk 2>/dev/null
+/usr/bin echo 'quoted text' -eu && $(pwd)
+	sed then done printf cd --verbose && --verbose x=1 2>/dev/null then readonly
+		sed awk test -eu echo test "$@" awk x=1
+		test -eu x=1 test test grep sed export printf awk
+		cd awk -eu -eu awk "$1" awk --verbose grep |
+		/usr/bin -eu 2>/dev/null | "$@" printf "$@" --verbose
+	sed local -eu awk readonly -eu then ${HOME} --verbose local local
+printf --verbose $(pwd) && "$@" sed done --verbose -eu done | sed export
+	test $(pwd) 2>/dev/null export sed readonly export -eu
+'quoted text' | --verbose /usr/bin
+-eu --verbose cd "$1" --verbose 2>/dev/null
+		/usr/bin awk -eu done -eu x=1 awk
+"$1" printf readonly -eu ${HOME}
+		printf && 2>/dev/null sed /usr/bin 'quoted text'
+readonly export 2>/dev/null 2>/dev/null printf printf $(pwd)
+--verbose grep cd echo -eu -eu && && readonly
+		$(pwd) && local cd then /usr/bin echo done export && local done 2>/dev/null done
+-eu then cd grep sed local printf x=1 then -eu readonly cd awk 2>/dev/null -eu
+		--verbose 2>/dev/null ${HOME} test "$@" echo printf local readonly x=1 grep
+local echo test | then readonly
+	${HOME} grep echo export grep local | test /usr/bin echo grep grep printf $(pwd)
+x=1 test done export "$@" "$1" | "$@" "$@" done awk sed ${HOME} ${HOME} /usr/bin
+		'quoted text' echo ${HOME} test 2>/dev/null grep echo "$1" --verbose
+		&& 2>/dev/null "$1" test "$@" test
+	"$1" grep "$@" export --verbose local test grep cd $(pwd)
+	export sed then done cd ${HOME}
+	"$1" --verbose awk && grep export ${HOME} echo x=1 readonly
+sed $(pwd) | local sed -eu sed echo grep
+	grep /usr/bin test local echo
+	"$1" --verbose echo readonly
+		2>/dev/null echo then test
+	/usr/bin --verbose -eu echo && sed readonly 2>/dev/null then
+		'quoted text' | local sed readonly
+"$1" ${HOME} /usr/bin local export test done readonly "$@" readonly 2>/dev/null
+	grep done sed test export
+	echo local echo -eu $(pwd) | x=1 awk 2>/dev/null export
+	| ${HOME} /usr/bin done
+		printf ${HOME} $(pwd) $(pwd) grep
+		/usr/bin grep $(pwd) grep 2>/dev/null echo awk /usr/bin echo x=1 "$1" done $(pwd)
+	$(pwd) -eu echo ${HOME} $(pwd) 'quoted text'
+		then export printf | x=1 then echo echo awk 'quoted text' awk 2>/dev/null
+awk then "$@" "$1" awk $(pwd) -eu 'quoted text' | | -eu grep ${HOME} readonly
+	done && printf readonly ${HOME} grep
+echo 'quoted text' export echo | "$1" | then awk export then grep
+	export grep $(pwd) /usr/bin ${HOME} "$1"
+	x=1 | export -eu "$@" ${HOME} ${HOME} x=1 awk
+		cd awk test done "$@" /usr/bin export test 'quoted text' $(pwd) readonly done
+${HOME} export -eu && readonly cd readonly then 2>/dev/null $(pwd) x=1 $(pwd)
+x=1 ${HOME} cd 2>/dev/null
+		sed local test x=1 test printf local && $(pwd) 'quoted text'
+'quoted text' "$1" test grep /usr/bin | "$1"
+		local 'quoted text' printf then "$@" cd "$1" cd 'quoted text'
+then -eu x=1 ${HOME} done x=1 echo "$1" "$@" ${HOME}
+		x=1 grep "$1" awk then -eu $(pwd) test 2>/dev/null awk
+| local cd 'quoted text'
+		&& $(pwd) -eu grep echo cd cd done "$1" ${HOME} | "$@" cd 2>/dev/null readonly
+		done echo $(pwd) ${HOME} export test /usr/bin
+	x=1 /usr/bin done $(pwd) "$@" local 'quoted text'
+	${HOME} -eu 2>/dev/null -eu then &&
+		echo ${HOME} cd grep echo 2>/dev/null then
+		printf $(pwd) cd sed then $(pwd) sed "$1" printf $(pwd)
+done cd local -eu -eu --verbose $(pwd) test && | test readonly then awk done
+	done x=1 -eu export echo x=1 cd "$1" awk /usr/bin
+$(pwd) --verbose local local 2>/dev/null
+	export printf echo && | local done x=1
+	readonly grep export done echo then readonly
+	cd done then done 2>/dev/null local && done then awk "$@" done
+		printf $(pwd) cd 'quoted text' echo
+grep echo 'quoted text' cd
+	2>/dev/null echo 'quoted text' ${HOME} x=1
+		"$1" echo done --verbose x=1 then -eu | ${HOME} local awk readonly
+echo cd 'quoted text' --verbose test ${HOME}
+| && ${HOME} /usr/bin | awk $(pwd) | 'quoted text' ${HOME} "$1" sed echo /usr/bin
+		done printf export export x=1 /usr/bin sed cd && --verbose | "$@" "$1" "$@"
+${HOME} 'quoted text' -eu done "$@" --verbose
+	'quoted text' "$@" readonly --verbose ${HOME} --verbose /usr/bin
+		printf local | sed local readonly "$1"
+	2>/dev/null export "$@" "$1" && sed cd then "$1" export echo local export | -eu
+	x=1 -eu test | && done /usr/bin --verbose 'quoted text'
+$(pwd) printf | cd export $(pwd) then echo sed 2>/dev/null
+		| local awk grep /usr/bin test
+		/usr/bin export printf --verbose awk then
+		readonly /usr/bin /usr/bin sed -eu | awk ${HOME} grep 'quoted text' echo
+export export "$1" /usr/bin grep echo awk | cd ${HOME} sed 2>/dev/null local
+done -eu local grep awk done echo $(pwd) cd local export 'quoted text' cd
+	x=1 export --verbose /usr/bin "$@" awk echo x=1
+	local | readonly | x=1 awk echo test /usr/bin /usr/bin
+	local test local | echo awk /usr/bin readonly ${HOME} done 2>/dev/null $(pwd)
+	"$1" $(pwd) local local 'quoted text' awk | sed printf
+		printf "$1" awk ${HOME} ${HOME} readonly "$@" 'quoted text'
+	--verbose x=1 && 'quoted text' 'quoted text' export
+	"$@" x=1 printf -eu export "$1" then readonly 'quoted text' "$1" readonly
+	x=1 grep && "$@" ${HOME} cd done $(pwd)
+		then --verbose awk -eu /usr/bin export --verbose
+	cd local /usr/bin local x=1 export
+	then test sed test ${HOME} export $(pwd) test
+	x=1 then readonly echo cd export awk "$@" /usr/bin --verbose /usr/bin &&
+		2>/dev/null readonly echo && echo local 'quoted text'
+readonly 2>/dev/null /usr/bin
+	--verbose awk /usr/bin 2>/dev/null export grep sed then printf
+2>/dev/null x=1 cd /usr/bin x=1 x=1 'quoted text'
+${HOME} local && $(pwd) -eu
+/usr/bin test && export awk cd printf
+	export && x=1 then awk $(pwd)
+sed echo x=1 echo then 'quoted text' --verbose awk && cd printf $(pwd) "$1"
+		$(pwd) then done && 'quoted text' export readonly
+	2>/dev/null /usr/bin readonly -eu 2>/dev/null export $(pwd) &&
+then | local export sed local done && sed
+&& /usr/bin -eu "$1" x=1 export then done sed then awk grep "$1" done
+readonly then echo test && cd local sed done | then cd --verbose | x=1 then
+	&& export "$@" export printf
+cd "$1" export readonly | "$@" "$1" x=1 local | printf ${HOME} local
+then x=1 grep $(pwd) test ${HOME} export
+local sed cd $(pwd) && "$1" local
+readonly $(pwd) "$1" --verbose | | printf echo echo
+	cd -eu awk "$@" echo test awk local
+		export printf && "$@" 'quoted text' $(pwd) "$1" 'quoted text'
+	sed && "$1" | then &&
+		grep done 2>/dev/null export grep sed printf "$@" -eu awk sed awk | local grep &&
+		local ${HOME} -eu grep -eu done "$@" readonly 2>/dev/null | done test $(pwd) -eu
+		| ${HOME} printf 'quoted text' test x=1 "$@" $(pwd) 2>/dev/null awk test
+		x=1 cd "$1" --verbose awk done
+--verbose cd cd | 'quoted text' -eu awk done
+&& "$@" "$1" cd cd done local export
+	local -eu "$@" /usr/bin
+		/usr/bin then ${HOME} readonly local /usr/bin
+	echo local export sed test /usr/bin sed done && grep --verbose readonly "$@"
+	/usr/bin | printf done $(pwd) grep then /usr/bin $(pwd) local cd cd -eu
+	'quoted text' sed awk
+	${HOME} /usr/bin printf export echo grep
+done grep readonly 'quoted text' cd "$@" --verbose 2>/dev/null then echo then
+awk $(pwd) awk cd test echo 'quoted text' 'quoted text' x=1 printf test
+	then sed "$1" printf 'quoted text' | ${HOME} test awk awk
+		grep done "$1" 'quoted text' readonly 'quoted text' --verbose echo local ${HOME}
+	'quoted text' export -eu "$1" readonly $(pwd) && 2>/dev/null ${HOME} cd "$1"
+2>/dev/null && ${HOME} /usr/bin 2>/dev/null
+	x=1 x=1 sed /usr/bin $(pwd) 2>/dev/null export 2>/dev/null
+		sed echo $(pwd) && awk echo cd cd ${HOME} "$@" sed
+		cd cd sed --verbose | then test
+'quoted text' "$@" echo x=1 | sed ${HOME} then ${HOME} then "$1" test
+		/usr/bin then readonly "$@" ${HOME} "$1" test /usr/bin ${HOME}
+		then /usr/bin local test local 'quoted text' /usr/bin awk "$@" awk
+local sed x=1 cd 2>/dev/null grep local --verbose $(pwd) echo
+readonly echo 2>/dev/null x=1 "$1" echo grep $(pwd) then export
+		x=1 --verbose sed "$@" $(pwd) x=1 awk then grep /usr/bin grep x=1 export grep
+	-eu 2>/dev/null readonly readonly then readonly "$@"
+		-eu && test "$@" grep "$1" then local -eu -eu
+&& -eu readonly "$@" "$1" "$1" test readonly && export
+"$1" --verbose grep local echo sed test awk export
+		grep echo done grep $(pwd) cd sed && printf then ${HOME} $(pwd) -eu
+		then && 'quoted text' readonly
+	| local then grep ${HOME} test
+		cd export 'quoted text' local awk awk test awk 2>/dev/null echo -eu local x=1 printf
+	${HOME} -eu echo awk 'quoted text' grep local
+	cd sed "$1" --verbose ${HOME} | sed printf readonly
+		/usr/bin | x=1 && awk 'quoted text'
+	-eu test && 2>/dev/null x=1 &&
+/usr/bin grep ${HOME} -eu cd 'quoted text' ${HOME} readonly
+	awk done $(pwd) x=1 "$@" $(pwd) "$@" readonly local awk $(pwd) /usr/bin /usr/bin
+"$@" readonly test local readonly then
+	${HOME} ${HOME} -eu then test awk awk && test
+	sed test $(pwd) 2>/dev/null printf test cd /usr/bin
+/usr/bin "$@" x=1 ${HOME} "$1" readonly done --verbose test grep x=1 test
+		&& 2>/dev/null export done "$@" export 2>/dev/null | local
+sed done test grep x=1 && test && sed $(pwd) done test cd --verbose 'quoted text'
+		"$@" printf 'quoted text' "$1" then
+		${HOME} x=1 && 2>/dev/null --verbose /usr/bin 'quoted text'
+awk echo ${HOME} done readonly | && $(pwd)
+	2>/dev/null done cd --verbose done echo && /usr/bin done $(pwd) | -eu x=1 --verbose
+		sed grep grep printf awk local "$1" -eu export
+-eu 'quoted text' cd 'quoted text'
+		'quoted text' && "$@" 'quoted text' "$@" $(pwd) 2>/dev/null printf "$1"
+		awk "$@" $(pwd) 'quoted text' --verbose awk
+	| $(pwd) --verbose export "$@" 'quoted text'
+	-eu then done local awk printf && -eu then local --verbose
+		"$1" "$1" 2>/dev/null printf /usr/bin export sed --verbose
+		/usr/bin done "$1" "$1" && export $(pwd) x=1 -eu --verbose
+	$(pwd) "$1" x=1 "$1" -eu && "$1" done done $(pwd) echo 2>/dev/null done local --verbose
+	'quoted text' echo then grep /usr/bin done sed /usr/bin
+2>/dev/null "$1" /usr/bin 2>/dev/null /usr/bin 'quoted text'
+	/usr/bin "$1" | /usr/bin echo printf 2>/dev/null /usr/bin
+		done sed cd awk awk ${HOME} awk then -eu readonly
+sed /usr/bin done | x=1 ${HOME}
+		cd printf readonly local done --verbose readonly grep
+		"$@" | export test 'quoted text' ${HOME} $(pwd) 2>/dev/null
+test "$1" --verbose $(pwd) printf "$@" then cd printf grep &&
+		readonly done $(pwd) done "$@" x=1 $(pwd) cd 2>/dev/null ${HOME}
+&& "$1" $(pwd) printf local printf grep done cd 2>/dev/null cd printf 'quoted text'
+export grep ${HOME} sed 2>/dev/null "$1" echo 2>/dev/null
+'quoted text' | test "$@" done done && sed then then
+		&& | readonly done ${HOME} | export grep 'quoted text'
+"$1" sed done /usr/bin local sed cd --verbose -eu | $(pwd) grep | && sed | cd then
+&& && then 2>/dev/null 'quoted text'
+		awk echo local grep x=1 done 2>/dev/null 'quoted text' 'quoted text' done readonly
+"$@" local "$1" awk printf export /usr/bin --verbose then cd /usr/bin
+		&& then readonly --verbose local -eu sed $(pwd) -eu readonly
+		| grep local awk /usr/bin
+--verbose done test && | echo printf export
+grep export awk local echo grep
+		printf /usr/bin export "$@" $(pwd) ${HOME} | local test cd test x=1
+awk then local -eu echo $(pwd) 2>/dev/null awk | test awk export "$@" 'quoted text'
+	local /usr/bin ${HOME} && "$@" export
+'quoted text' /usr/bin ${HOME} 'quoted text' "$1" sed && printf cd sed
+	cd cd 'quoted text' /usr/bin ${HOME} readonly awk
+export awk ${HOME} 'quoted text' awk printf printf && echo
+		sed ${HOME} --verbose done sed awk cd $(pwd)
+'quoted text' --verbose && echo 2>/dev/null
+"$@" test local export sed readonly then "$@" done
+$(pwd) 'quoted text' $(pwd) "$@"
+	"$@" printf local cd grep
+2>/dev/null ${HOME} done "$1" --verbose sed 2>/dev/null -eu printf printf echo
+	--verbose sed "$1" grep local $(pwd)
+	--verbose test $(pwd) awk export
+		awk "$1" export /usr/bin 'quoted text' -eu 'quoted text' x=1 awk
+	readonly cd local x=1 --verbose
+	--verbose test -eu ${HOME} -eu && done readonly done printf $(pwd) /usr/bin --verbose
+sed grep -eu --verbose x=1 "$1" test export --verbose export x=1
+		echo local 'quoted text' ${HOME} 2>/dev/null
+cd sed echo ${HOME} local sed readonly && printf local readonly -eu "$1" ${HOME}
+--verbose /usr/bin printf cd done readonly export "$@" x=1 2>/dev/null
+local sed awk then done "$1" ${HOME}
+	${HOME} done 'quoted text' -eu local printf
+sed done $(pwd) "$1" test 'quoted text' printf
+	awk "$1" 'quoted text' 2>/dev/null echo then cd -eu /usr/bin --verbose test
+	printf done 'quoted text' -eu -eu cd /usr/bin then then 2>/dev/null
+	2>/dev/null "$@" $(pwd) export awk awk --verbose
+		&& cd local sed sed grep
+		$(pwd) -eu readonly $(pwd) grep done printf -eu x=1 /usr/bin echo | echo "$@"
+		echo export echo sed x=1 | cd $(pwd) readonly grep export "$1" x=1
+	"$@" ${HOME} "$@" grep export 2>/dev/null | /usr/bin sed 2>/dev/null local -eu
+		readonly local echo done
+	"$1" && 'quoted text' --verbose "$1" printf grep |
+${HOME} awk sed done readonly readonly readonly
+	awk local sed cd done printf -eu local 2>/dev/null cd cd &&
+		"$1" ${HOME} --verbose 2>/dev/null | x=1 sed 2>/dev/null $(pwd) "$1"
+	printf && -eu awk && export /usr/bin 2>/dev/null awk export
+		"$@" echo 2>/dev/null x=1 'quoted text'
+awk then -eu x=1 sed 'quoted text' -eu "$@" $(pwd) printf
+	printf "$@" grep -eu "$@" readonly
+	done | | "$@" "$@" cd "$1"
+printf done --verbose export local grep -eu "$@" done local sed 'quoted text'
+$(pwd) local local -eu awk local export --verbose 2>/dev/null
+		awk cd 'quoted text' 'quoted text' local sed
+		&& --verbose | awk sed /usr/bin 'quoted text' done 2>/dev/null "$@" printf
+then /usr/bin echo -eu 'quoted text' -eu export |
+then ${HOME} "$1" 'quoted text' local ${HOME}
+	${HOME} echo local --verbose 2>/dev/null echo printf $(pwd) $(pwd) cd grep
+	&& 2>/dev/null local -eu "$1" done "$@" local
+		x=1 'quoted text' | $(pwd) 'quoted text'
+	"$1" echo awk x=1 'quoted text' local | cd && test "$1" --verbose --verbose
+	$(pwd) 'quoted text' "$1" && test --verbose export grep grep $(pwd)
+	export cd awk --verbose cd export readonly /usr/bin
+		test awk 2>/dev/null then --verbose | printf grep "$1" "$@" |
+		done | readonly test --verbose done 2>/dev/null echo cd $(pwd) ${HOME} grep export
+	-eu 2>/dev/null 'quoted text' sed 2>/dev/null 2>/dev/null
+readonly -eu echo grep then printf --verbose
+	-eu readonly export done local /usr/bin 2>/dev/null 'quoted text' sed "$@" "$@"
+	echo /usr/bin x=1 "$1" 2>/dev/null grep
+	x=1 "$@" ${HOME} cd echo sed $(pwd) then
+		-eu | sed /usr/bin export "$@" --verbose
+cd awk sed x=1 $(pwd) then 2>/dev/null
+2>/dev/null "$1" readonly awk | cd awk echo export test echo test $(pwd) printf
+	printf export ${HOME} readonly done sed 2>/dev/null
+		cd x=1 /usr/bin 2>/dev/null 'quoted text' echo $(pwd) 2>/dev/null
+		"$@" && && local awk sed "$1" readonly cd cd readonly "$@"
+${HOME} sed readonly $(pwd) export && then
+printf readonly export 2>/dev/null x=1 && awk grep
+	cd "$@" --verbose awk $(pwd) local ${HOME} echo cd
+2>/dev/null then 2>/dev/null echo local 'quoted text' printf printf grep
+	/usr/bin "$1" x=1 --verbose then done printf cd "$1" && local --verbose
+&& "$1" local grep done echo "$1" export | local cd grep
+	readonly 'quoted text' cd echo then 'quoted text' --verbose grep -eu 2>/dev/null
+	printf --verbose -eu then && local && "$@" readonly printf
+cd 2>/dev/null awk "$@" grep && | ${HOME} printf ${HOME} ${HOME}
+'quoted text' echo readonly awk | 2>/dev/null -eu 2>/dev/null done
+		awk done $(pwd) 2>/dev/null 2>/dev/null
+	cd && local && sed sed x=1 awk --verbose -eu test export
+	'quoted text' | "$1" test printf readonly readonly echo cd cd printf 'quoted text'
+	echo readonly test sed 'quoted text' 2>/dev/null
+2>/dev/null x=1 sed x=1 test export then awk /usr/bin
+$(pwd) then /usr/bin && test --verbose awk "$1"
+	echo cd awk then --verbose readonly
+	"$@" 'quoted text' echo then 'quoted text' ${HOME} then
+'quoted text' --verbose then "$1" cd sed
+	-eu grep ${HOME} printf awk x=1 --verbose echo --verbose ${HOME}
+		/usr/bin echo cd "$@" then x=1 ${HOME} local 2>/dev/null then readonly --verbose
+echo readonly "$@" x=1 test
+		-eu done export awk --verbose -eu 2>/dev/null
+then local /usr/bin done awk ${HOME} test done | x=1 "$1"
+	"$@" x=1 'quoted text' local $(pwd) cd cd "$1" grep done -eu test export 'quoted text'
+		readonly x=1 --verbose $(pwd) "$@" test 'quoted text'
+local | echo x=1 | -eu 2>/dev/null then echo readonly local cd printf
+x=1 2>/dev/null local echo 2>/dev/null x=1 grep $(pwd)
+		done $(pwd) sed awk x=1 echo $(pwd) --verbose printf 'quoted text'
+&& sed 2>/dev/null "$1" printf awk awk awk grep grep printf
+'quoted text' done --verbose
+-eu sed ${HOME} readonly && /usr/bin | echo && x=1
+		test x=1 x=1 then /usr/bin "$@" echo grep grep printf | local
+	printf && | readonly done --verbose $(pwd)
+		${HOME} readonly "$@" export x=1 /usr/bin sed | export then | awk export $(pwd)
+	&& 2>/dev/null then cd printf "$1" | echo "$@" --verbose $(pwd) awk then | 2>/dev/null
+	-eu "$1" export $(pwd) readonly
+		test -eu done grep cd cd 2>/dev/null
+		echo "$@" && export grep 'quoted text' | cd cd test /usr/bin
+		awk local ${HOME} -eu 'quoted text' | printf x=1 2>/dev/null 'quoted text'
+	awk test ${HOME} done local test done /usr/bin
+	grep 'quoted text' x=1
+	/usr/bin x=1 && --verbose printf echo "$@" x=1 --verbose 'quoted text'
+		local ${HOME} $(pwd) 'quoted text' cd local awk 'quoted text' readonly
+		echo "$1" "$@" grep awk x=1 awk "$@" /usr/bin readonly -eu grep --verbose
+	awk --verbose x=1 /usr/bin "$1" 2>/dev/null cd "$1" echo export done readonly
+	readonly local readonly then local printf $(pwd) &&
+/usr/bin x=1 x=1 echo ${HOME} $(pwd) then -eu readonly 'quoted text' -eu grep
+&& done x=1 && 'quoted text' done x=1 /usr/bin "$@" echo sed then x=1 local
+		x=1 | readonly x=1 done awk export sed grep readonly
+2>/dev/null awk | -eu printf done
+		${HOME} && 2>/dev/null
+${HOME} ${HOME} grep x=1 "$1" x=1 echo -eu
+		--verbose done test sed test sed $(pwd) cd 'quoted text' --verbose export echo cd
+/usr/bin "$@" test | printf 2>/dev/null
+/usr/bin cd | ${HOME} sed
+local 2>/dev/null /usr/bin -eu sed grep /usr/bin echo --verbose 2>/dev/null $(pwd)
+echo test sed local awk echo ${HOME} local "$1" sed $(pwd) awk cd local
+${HOME} cd /usr/bin local then cd "$@" x=1 readonly readonly sed 2>/dev/null
+		| readonly x=1 local then
+		"$@" x=1 -eu readonly done grep local "$1" local "$1"
+		done readonly printf -eu -eu -eu done x=1 then x=1 -eu --verbose done $(pwd) test
+		test 'quoted text' "$@" sed
+#include c1.sh
+		local printf sed "$1" local
+		$(pwd) sed | done && echo echo | "$1" done
+		export /usr/bin -eu ${HOME} done $(pwd) x=1 printf "$1" readonly
+done && /usr/bin --verbose -eu 'quoted text'
+	"$@" done "$1" printf $(pwd) 'quoted text' --verbose sed
+2>/dev/null printf --verbose $(pwd) --verbose --verbose $(pwd) 'quoted text'
+	--verbose 2>/dev/null --verbose ${HOME}
+	sed 'quoted text' cd "$1" 'quoted text'
+		printf $(pwd) | ${HOME} export 2>/dev/null grep
+	grep local cd "$1" $(pwd) $(pwd) grep done $(pwd) done x=1 sed --verbose
+	export then "$@" grep "$@" printf done x=1 "$@" echo
+cd $(pwd) && awk --verbose 'quoted text' awk cd echo cd echo 2>/dev/null
+		echo | && cd "$1" test -eu --verbose "$1" $(pwd) /usr/bin
+awk $(pwd) && readonly --verbose
+		test $(pwd) done | -eu printf printf
+	/usr/bin && $(pwd) --verbose printf export cd readonly 2>/dev/null sed
+	2>/dev/null echo 'quoted text' export export && "$@" "$@" readonly "$@"
+	test && export x=1 printf /usr/bin -eu 'quoted text'
+		"$@" test grep readonly --verbose $(pwd) echo "$@" | 2>/dev/null "$@"
+$(pwd) 'quoted text' done cd --verbose readonly ${HOME}
+		$(pwd) "$1" then -eu x=1 /usr/bin "$1" && echo grep
+		awk $(pwd) done x=1 awk printf
+/usr/bin | 'quoted text' ${HOME} -eu -eu readonly -eu
+		sed cd printf "$1" readonly readonly
+	2>/dev/null -eu test | local cd printf --verbose -eu done "$1" awk
+export --verbose printf "$1" sed --verbose test ${HOME} --verbose x=1 test
+cd "$1" printf readonly local
+		2>/dev/null -eu printf local "$1" printf local sed
+	done $(pwd) grep && done done printf | echo awk "$@" -eu ${HOME}
+readonly /usr/bin "$@" cd cd
+sed | x=1 && printf readonly "$@"
+export && /usr/bin sed grep /usr/bin --verbose echo | -eu printf /usr/bin
+readonly echo export -eu
+		$(pwd) $(pwd) grep 'quoted text' x=1 $(pwd) && test x=1 'quoted text' &&
+		x=1 cd printf printf "$@" 2>/dev/null x=1 printf
+2>/dev/null done "$1" echo awk export | grep
+then /usr/bin x=1 echo printf test export "$1" &&
+then && -eu 2>/dev/null -eu -eu -eu 2>/dev/null
+	/usr/bin sed "$1" export -eu test /usr/bin grep
+		printf --verbose | x=1 $(pwd) export "$1" done test test readonly
+		printf /usr/bin local x=1 -eu && awk && export
+"$@" cd 2>/dev/null local $(pwd) 'quoted text' awk $(pwd)
+	then grep awk printf 'quoted text' export done "$@" sed 'quoted text' then /usr/bin
+	printf "$@" readonly 'quoted text' export "$1" export /usr/bin "$1" 2>/dev/null
+	test 2>/dev/null grep && "$1" --verbose && then then
+		cd local cd "$1" 2>/dev/null printf 'quoted text' sed ${HOME} /usr/bin awk
+	/usr/bin ${HOME} done then $(pwd) awk | $(pwd) && echo $(pwd) 2>/dev/null
+		awk grep ${HOME} sed |
+		cd cd test sed --verbose cd export
+		local x=1 cd 'quoted text' export 2>/dev/null awk readonly local test 'quoted text'
+		readonly 'quoted text' 'quoted text'
+	local awk awk 2>/dev/null "$@" --verbose local export then printf
+	echo local readonly 'quoted text' -eu sed echo x=1 printf readonly x=1 sed local
+	awk awk "$@" -eu printf x=1 then echo printf /usr/bin echo grep done x=1 awk 'quoted text'
+	printf readonly grep && /usr/bin test x=1 then then ${HOME} export 2>/dev/null
+	${HOME} grep echo echo x=1
+x=1 readonly grep echo && local
+		x=1 echo sed local 2>/dev/null
+		test readonly sed grep "$1" echo awk
+		"$@" printf awk 2>/dev/null
+$(pwd) local cd local then $(pwd) /usr/bin "$@" cd
+readonly echo grep cd grep
+		cd cd 'quoted text' 2>/dev/null $(pwd) | export && cd | --verbose done
+${HOME} readonly grep cd grep ${HOME} /usr/bin echo
+	'quoted text' sed 2>/dev/null sed local "$@" && grep "$1" sed /usr/bin
+&& "$@" local x=1 grep && "$@" printf cd 2>/dev/null cd export grep echo awk
+--verbose grep --verbose -eu done && x=1 --verbose $(pwd)
+	done 'quoted text' "$@" /usr/bin 'quoted text'
+	2>/dev/null "$1" && --verbose "$1" ${HOME}
+		sed local awk sed test 'quoted text' ${HOME} "$1" $(pwd) -eu export
+	done ${HOME} && awk --verbose $(pwd) "$@" "$@" local --verbose "$@"
+'quoted text' 'quoted text'
+		cd then 'quoted text' printf | grep
+		echo ${HOME} --verbose | | sed 'quoted text' printf cd $(pwd) awk awk cd
+grep --verbose --verbose 2>/dev/null 2>/dev/null
+cd /usr/bin local 'quoted text' printf
+then printf echo "$@" ${HOME} grep 2>/dev/null 'quoted text'
+	/usr/bin then sed --verbose ${HOME}
+	2>/dev/null sed local "$@" cd local x=1 then 2>/dev/null then test x=1
+		--verbose done | readonly readonly awk 'quoted text'
+		printf --verbose --verbose --verbose
+	sed 'quoted text' | done export x=1 /usr/bin printf
+$(pwd) -eu test x=1 && done ${HOME} echo readonly local
+		awk cd echo cd test "$1" cd 2>/dev/null grep grep test 2>/dev/null
+		-eu cd sed --verbose $(pwd) test -eu printf then -eu
+		grep readonly cd local "$1" echo --verbose readonly --verbose test sed $(pwd)
+| "$@" grep "$@" x=1
+		done "$@" -eu test 'quoted text' done
+	echo sed cd 2>/dev/null $(pwd) "$1" "$1" export test --verbose
+		grep 2>/dev/null printf
+/usr/bin && then ${HOME} $(pwd) && local awk "$@" grep test | done 2>/dev/null
+grep "$1" && done cd awk 2>/dev/null -eu -eu ${HOME} then
+		"$1" | grep cd printf export "$1" 2>/dev/null
+		test awk done grep printf --verbose
+		--verbose 'quoted text' && cd export | local /usr/bin $(pwd) test done --verbose
+		cd 2>/dev/null test grep echo then test "$1" then local 2>/dev/null 2>/dev/null
+	$(pwd) sed awk --verbose local ${HOME}
+local -eu readonly then "$@" export 2>/dev/null /usr/bin "$@"
+	"$@" readonly export $(pwd) printf readonly test ${HOME} awk 'quoted text'
+"$1" -eu "$1" export echo export cd && test then
+		${HOME} ${HOME} -eu /usr/bin --verbose ${HOME} echo 'quoted text' readonly test
+grep awk 2>/dev/null sed $(pwd)
+	'quoted text' x=1 done awk grep && $(pwd) | ${HOME} ${HOME} ${HOME} awk |
+		test "$@" done -eu 'quoted text' cd -eu local && local sed echo local sed
+&& ${HOME} sed echo 'quoted text' export done printf test export "$1" | "$@" done
+		"$1" "$@" && --verbose && then
+	then local /usr/bin export ${HOME} echo -eu
+x=1 'quoted text' local | sed "$@" 'quoted text'
+	'quoted text' local printf grep /usr/bin --verbose "$@" sed awk grep ${HOME}
+	${HOME} /usr/bin cd printf
+	"$1" ${HOME} then awk export export
+awk x=1 done --verbose awk
+$(pwd) readonly cd awk local ${HOME} then x=1
+printf cd grep x=1 then awk /usr/bin grep
+		| 'quoted text' -eu | --verbose && cd awk cd echo test "$1" grep awk 2>/dev/null
+		done readonly then cd grep
+printf 2>/dev/null --verbose
+printf ${HOME} echo 'quoted text'
+	echo "$1" 2>/dev/null grep "$1" echo
+	export echo "$@" echo awk "$1" printf then sed
+	${HOME} awk test ${HOME} -eu -eu local && --verbose readonly /usr/bin
+	then x=1 done "$@" 2>/dev/null test test 2>/dev/null readonly
+		"$1" "$@" then "$@" "$@" echo
+		| 2>/dev/null done "$@" cd awk && grep "$@"
+	awk printf export && local then local -eu local awk 'quoted text' printf
+	"$1" 'quoted text' -eu "$@" ${HOME} &&
+	grep readonly grep readonly "$@"
+2>/dev/null "$1" ${HOME} "$1" ${HOME} |
+		sed --verbose test 2>/dev/null echo echo | | --verbose
+		"$1" awk /usr/bin printf
+		$(pwd) ${HOME} | cd x=1 done && && && printf export
+	-eu sed export --verbose ${HOME} | awk awk --verbose
+cd grep "$1" --verbose printf awk 'quoted text' --verbose
+		'quoted text' -eu ${HOME} 2>/dev/null
+done local awk sed --verbose /usr/bin cd 'quoted text' export echo cd
+local readonly $(pwd) sed echo "$1" -eu test test ${HOME} 2>/dev/null
+		-eu 'quoted text' -eu test --verbose test &&
+		${HOME} /usr/bin then local -eu -eu "$1" grep
+done awk 'quoted text' export cd x=1 'quoted text' 'quoted text'
+	echo grep local printf then
+	echo 'quoted text' x=1
+readonly --verbose $(pwd) /usr/bin done x=1 readonly
+	"$@" then printf cd grep printf printf awk $(pwd)
+${HOME} 'quoted text' cd readonly
+	'quoted text' /usr/bin echo printf export
+		"$@" "$@" cd export grep then --verbose
+	done x=1 "$1" sed test -eu local done
+	| echo test 2>/dev/null "$@"
+		/usr/bin && grep test -eu cd then sed echo printf
+		/usr/bin local /usr/bin 2>/dev/null cd done 'quoted text' echo $(pwd) | then
+		| awk ${HOME} local readonly done && --verbose done awk readonly
+test --verbose ${HOME} export
+	awk cd | sed x=1 cd /usr/bin export
+"$@" $(pwd) then awk awk 2>/dev/null grep sed local
+		sed cd then export ${HOME} 2>/dev/null
+	2>/dev/null grep export readonly printf ${HOME} "$@"
+&& x=1 && export printf done $(pwd) then "$@" "$1" cd cd /usr/bin
+		x=1 "$@" "$1" -eu echo printf "$@" "$1" x=1 test | printf && 2>/dev/null
+	2>/dev/null "$@" printf "$1" then
+	cd local 2>/dev/null --verbose
+	'quoted text' test export 'quoted text' "$1" readonly echo
+	test ${HOME} cd "$1" test cd -eu -eu ${HOME} 2>/dev/null --verbose
+		/usr/bin grep echo ${HOME} 2>/dev/null --verbose export "$1" /usr/bin
+${HOME} 'quoted text' 2>/dev/null --verbose
+		/usr/bin 'quoted text' then -eu sed sed export grep
+	&& 2>/dev/null ${HOME} --verbose
+--verbose sed sed local sed | &&
+sed $(pwd) x=1 awk ${HOME} then local
+		sed "$@" sed local then 'quoted text'
+		&& /usr/bin echo && awk /usr/bin
+&& echo export local ${HOME} x=1 $(pwd) local /usr/bin echo --verbose
+	done printf readonly grep ${HOME} $(pwd)
+cd | $(pwd) local $(pwd)
+		test export cd then printf 2>/dev/null ${HOME} done sed printf "$1" local -eu
+	export $(pwd) -eu test printf x=1 export 2>/dev/null "$@" x=1
+	then then x=1 awk cd -eu sed local /usr/bin
+		local grep export echo "$1" export
+	"$@" -eu --verbose export -eu readonly test export done awk done
+		readonly then done 2>/dev/null awk --verbose && local
+	| 2>/dev/null -eu printf
+		then && readonly then done "$@" cd local 'quoted text' $(pwd) readonly
+	echo x=1 done 'quoted text' -eu $(pwd) awk echo export "$@" sed done awk && -eu
+	awk "$1" grep test then awk cd sed ${HOME} then /usr/bin | echo $(pwd) test
+	${HOME} "$1" "$@" test grep -eu ${HOME} cd | 'quoted text' awk "$@" sed
+	&& "$@" done && 2>/dev/null cd "$1" "$1" x=1 sed
+	${HOME} | test then 2>/dev/null then cd /usr/bin
+	x=1 /usr/bin cd test && "$1" "$@" 'quoted text' test cd readonly
+		/usr/bin "$@" test readonly 'quoted text'
+		2>/dev/null /usr/bin && echo awk
+		test printf "$@" awk then grep
+		grep "$@" test && && && then 'quoted text' -eu ${HOME} local then
+	done 2>/dev/null 'quoted text' printf 2>/dev/null grep --verbose "$1" --verbose
+-eu printf export grep grep grep "$1" /usr/bin cd echo done /usr/bin -eu cd /usr/bin
+	echo printf sed "$@" &&
+	'quoted text' 'quoted text' printf "$@" then 2>/dev/null 'quoted text'
+then "$1" echo local ${HOME}
+"$@" awk 'quoted text' done
+	2>/dev/null && 'quoted text'
+		export x=1 grep then /usr/bin grep done "$1" 2>/dev/null
+		x=1 then done test cd test ${HOME}
+then echo 'quoted text' ${HOME} cd printf x=1
+		"$@" sed grep then | awk local 'quoted text' && awk printf
+export --verbose cd then $(pwd)
+echo test -eu then "$@" printf
+		then x=1 'quoted text' export /usr/bin ${HOME}
+	printf export grep /usr/bin grep && -eu printf x=1 awk done test
+		2>/dev/null cd x=1 --verbose cd grep -eu "$1" 2>/dev/null
+		$(pwd) --verbose $(pwd) --verbose
+		'quoted text' "$1" cd readonly grep
+	grep --verbose -eu &&
+		/usr/bin printf echo "$@" --verbose "$1" test "$@" "$@" --verbose "$@"
+		readonly sed printf "$1" test printf echo 2>/dev/null 2>/dev/null $(pwd)
+test | ${HOME} -eu && ${HOME} export ${HOME}
+	then -eu $(pwd) 'quoted text' --verbose "$1" awk
+	export && sed done test test $(pwd) readonly
+	| --verbose test readonly echo -eu x=1 "$@" 2>/dev/null 'quoted text' ${HOME} |
+		printf cd $(pwd) && "$@" 2>/dev/null -eu | ${HOME} local
+'quoted text' awk "$@" export
+		export grep export readonly ${HOME} | export /usr/bin sed --verbose
+| cd -eu 2>/dev/null echo /usr/bin local 'quoted text' then 'quoted text' "$@"
+		| ${HOME} grep --verbose then cd echo awk awk $(pwd) | --verbose
+then ${HOME} -eu awk && && ${HOME} -eu test export "$@" printf 'quoted text'
+	--verbose grep export "$1" x=1 readonly -eu cd echo printf readonly
+		&& local "$1" done 2>/dev/null --verbose grep local then && $(pwd) grep test export
+		test sed printf readonly then
+x=1 2>/dev/null --verbose && awk && sed grep export readonly x=1 ${HOME}
+	export local 2>/dev/null -eu export
+&& "$1" && ${HOME} readonly export sed /usr/bin | --verbose
+		--verbose "$@" local --verbose done export
+"$@" "$@" printf grep readonly sed --verbose sed cd then -eu readonly "$@"
+	--verbose x=1 x=1 local done && x=1 readonly 2>/dev/null
+		--verbose 'quoted text' then -eu "$1" local "$@" test printf sed test grep then
+cd /usr/bin $(pwd) cd /usr/bin test cd echo printf
+		printf 'quoted text' && 'quoted text' done
+		then 'quoted text' sed $(pwd)
+	echo --verbose awk sed x=1 "$@" printf
+		$(pwd) grep ${HOME} "$@" export echo 'quoted text'
+		"$@" | readonly echo -eu $(pwd)
+	'quoted text' export cd
+"$1" local 2>/dev/null grep 'quoted text' printf /usr/bin grep
+grep x=1 then x=1 then local export
+readonly -eu readonly -eu
+"$@" && 2>/dev/null sed "$1"
+		&& echo 'quoted text' "$1" cd export && x=1 printf x=1 x=1 x=1 then export
+done local test /usr/bin -eu x=1 cd printf --verbose readonly
+done readonly 'quoted text' ${HOME} sed test local $(pwd) | "$1" sed
+	${HOME} readonly $(pwd) 2>/dev/null sed ${HOME}
+-eu "$1" $(pwd) "$@" printf "$@" $(pwd) export "$1" | grep
+sed && grep -eu -eu -eu cd x=1 local /usr/bin grep x=1
+		readonly cd 'quoted text' echo "$1" | printf local
+&& $(pwd) 2>/dev/null $(pwd) done $(pwd) done /usr/bin | export
+		grep local sed local grep cd awk 2>/dev/null | 2>/dev/null
+	local --verbose echo "$@" awk | cd grep /usr/bin
+	"$1" then echo readonly
+	&& sed local sed -eu 'quoted text' sed cd then then x=1 "$@" 'quoted text' awk
+		--verbose grep cd cd local test x=1 grep awk "$1"
+then 'quoted text' awk $(pwd) x=1
+		then done sed "$@" /usr/bin --verbose cd ${HOME} /usr/bin
+	done export export printf cd grep && local local
+		-eu test /usr/bin 'quoted text' -eu cd test local local cd then sed
+| awk 2>/dev/null | test "$@" --verbose grep "$@" 'quoted text'
+		${HOME} 2>/dev/null x=1 then ${HOME} | readonly /usr/bin local x=1 ${HOME}
+$(pwd) printf --verbose cd "$1" awk ${HOME}
+echo awk /usr/bin | test ${HOME}
+&& --verbose 'quoted text' grep x=1 x=1 export ${HOME} then && grep
+"$1" x=1 local readonly ${HOME} export
+		$(pwd) ${HOME} ${HOME} 'quoted text' export readonly printf awk "$1"
+		local ${HOME} && -eu /usr/bin -eu --verbose
+readonly local 2>/dev/null "$1" awk
+		'quoted text' grep 2>/dev/null sed "$@" x=1 "$@" cd echo awk cd awk
+	local "$1" "$1" x=1 grep awk "$1" test export
+		| echo | "$1" x=1 /usr/bin 'quoted text'
+	sed export ${HOME} "$1" 'quoted text' --verbose && export &&
+	awk "$@" sed echo x=1 -eu -eu test readonly
+echo then ${HOME} ${HOME} 2>/dev/null "$1" && /usr/bin x=1
+		local 'quoted text' 2>/dev/null --verbose export local grep
+	${HOME} sed done "$1" printf x=1 local /usr/bin done then
+		${HOME} done "$1" then then "$1" | -eu "$@" sed cd
+then 2>/dev/null export then $(pwd) -eu 'quoted text' -eu -eu x=1 | echo x=1 test
+		awk | readonly x=1 echo done echo ${HOME} sed $(pwd)
+$(pwd) "$1" /usr/bin "$@" export "$1" $(pwd) awk -eu sed ${HOME}
+--verbose local -eu readonly
+"$1" sed 'quoted text' "$@" grep awk then grep /usr/bin grep $(pwd)
+	| printf then printf "$@" done
+	--verbose grep sed grep --verbose
+	/usr/bin grep && readonly then
+		done done readonly x=1 --verbose grep done --verbose
+done "$@" export grep --verbose 'quoted text' awk
+	2>/dev/null 2>/dev/null then awk ${HOME} ${HOME} echo /usr/bin
+&& test grep x=1 "$@" x=1 sed "$@" x=1 | ${HOME}
+		--verbose -eu "$1" cd ${HOME} echo x=1 $(pwd) grep
+	sed 'quoted text' awk test grep sed
+	cd /usr/bin printf 'quoted text' "$@" && | echo echo
+grep readonly printf then export | ${HOME}
+		/usr/bin 'quoted text' awk 2>/dev/null "$@" 'quoted text' sed
+| awk test echo -eu then sed sed readonly && cd
+then 2>/dev/null cd x=1 readonly echo sed grep cd printf
+cd echo awk cd readonly x=1 test -eu echo ${HOME} then --verbose
+	local cd test awk done cd local
+	grep echo test | local "$@" | then | done readonly sed | sed done 'quoted text'
+	sed 'quoted text' "$@" local
+	readonly --verbose grep ${HOME} $(pwd) $(pwd) --verbose && echo 2>/dev/null
+		done 2>/dev/null printf echo ${HOME} grep export printf "$@" 2>/dev/null
+	test 2>/dev/null test /usr/bin sed && --verbose /usr/bin | 2>/dev/null -eu then
+		--verbose sed sed awk readonly cd export "$@" -eu
+	'quoted text' $(pwd) "$@" $(pwd) readonly
+	"$@" echo && 2>/dev/null test awk done then export done
+	export | export -eu x=1 cd 2>/dev/null 'quoted text'
+	x=1 printf readonly &&
+x=1 | then export done 2>/dev/null 2>/dev/null sed cd cd test done then && $(pwd)
+readonly printf /usr/bin sed "$1" | test --verbose sed grep
+		${HOME} printf --verbose && test "$1" then --verbose
+	${HOME} -eu x=1 awk readonly test ${HOME} && /usr/bin local "$@" && -eu
+&& cd cd x=1 'quoted text' awk x=1 cd --verbose
+readonly && "$@" "$1" done printf
+	/usr/bin then readonly 'quoted text' -eu 'quoted text'
+		| "$1" 'quoted text' awk 'quoted text' cd "$@" local done echo
+awk && && done /usr/bin printf 'quoted text'
+		/usr/bin $(pwd) awk --verbose
+	'quoted text' export sed && | then cd |
+	awk awk readonly "$1" -eu $(pwd) "$@" export ${HOME}
+	test ${HOME} "$1" echo sed printf then
+	export --verbose done grep "$@" awk
+	x=1 done /usr/bin --verbose
+	'quoted text' sed x=1 && --verbose test echo "$1" sed readonly local
+		| then x=1 2>/dev/null echo /usr/bin /usr/bin sed cd export readonly | readonly
+done readonly && | done $(pwd) 'quoted text' grep "$@" ${HOME} local
+	'quoted text' 2>/dev/null local readonly
+	2>/dev/null $(pwd) local done then then ${HOME}
+		grep sed echo --verbose "$1" --verbose done
+	test -eu | sed 2>/dev/null && test sed echo
+"$1" sed then ${HOME} $(pwd) "$@" readonly 2>/dev/null cd sed
+$(pwd) then printf export ${HOME}
+		'quoted text' "$1" local printf printf
+		test cd export | echo -eu grep printf sed
+		printf --verbose "$@" sed local cd
+	2>/dev/null ${HOME} sed awk | && printf grep --verbose $(pwd) done 'quoted text'
+	&& -eu 2>/dev/null --verbose test export test export
+		x=1 'quoted text' sed --verbose grep
+	"$@" grep awk export done "$@" 'quoted text'
+grep printf x=1 export $(pwd) --verbose awk sed
+		printf awk --verbose 2>/dev/null --verbose | test cd then printf readonly
+		grep 2>/dev/null $(pwd) -eu x=1 printf then done && echo done sed cd
+		test cd --verbose cd 'quoted text' printf /usr/bin printf cd export cd printf --verbose
+		printf echo echo sed grep
+$(pwd) x=1 "$1" | x=1 export --verbose sed /usr/bin
+	export $(pwd) x=1 cd grep echo done export local cd grep done readonly
+export $(pwd) && $(pwd) printf printf
+		readonly --verbose 'quoted text' export
+"$@" "$@" printf echo echo test "$1" printf
+		export local "$1" export -eu x=1 x=1 test test "$1" test sed grep | 2>/dev/null
+		&& then 'quoted text'
+		echo done x=1 x=1 grep printf
+		printf echo printf --verbose --verbose $(pwd) && readonly printf
+		echo --verbose test --verbose grep && echo readonly printf | ${HOME} $(pwd) sed
+		readonly 'quoted text' export sed grep "$1" readonly x=1 'quoted text' |
+		/usr/bin test "$1" cd printf
+		export $(pwd) cd local awk done 'quoted text'
+		grep 2>/dev/null | awk
+done echo ${HOME} ${HOME} then /usr/bin printf ${HOME} --verbose x=1 --verbose
+		$(pwd) -eu --verbose printf "$1" /usr/bin
+printf 'quoted text' done
+sed done test printf readonly "$@" printf test
+	printf local -eu | ${HOME} ${HOME} done "$@" 'quoted text' test
+		'quoted text' then grep "$@" | | local printf then awk $(pwd) 2>/dev/null
+		sed cd $(pwd) readonly "$1" ${HOME} done 'quoted text'
+x=1 printf sed && test sed awk done x=1 echo 2>/dev/null echo 2>/dev/null x=1
+x=1 x=1 echo export test "$@"
+		awk | awk done then 'quoted text' --verbose | && && /usr/bin
+--verbose $(pwd) export grep && | printf readonly test readonly -eu "$@"
+		cd test /usr/bin echo "$@" /usr/bin awk "$1" 2>/dev/null grep test
+	then x=1 && awk x=1 echo "$@" printf $(pwd)
+	done export ${HOME} cd x=1 export "$1" | $(pwd) printf
+printf readonly | readonly readonly readonly printf done
+"$1" local done 2>/dev/null cd grep sed "$@" sed /usr/bin 'quoted text' printf printf
+$(pwd) /usr/bin -eu $(pwd) printf export readonly --verbose "$1" then
+done x=1 /usr/bin then echo done "$@" "$1" ${HOME}
+		x=1 2>/dev/null awk local $(pwd) | "$@" 'quoted text' then
+$(pwd) grep then cd x=1 done grep cd readonly ${HOME} local ${HOME} x=1
+		done -eu | grep printf grep cd cd -eu test && local export
+		printf cd $(pwd) $(pwd) echo | $(pwd) /usr/bin local cd export awk local && export
+"$@" done --verbose -eu --verbose 'quoted text' test x=1 echo "$1" local sed
+printf "$@" "$1" test -eu x=1 sed "$@"
+		readonly grep then | "$@" "$1" printf local cd awk echo cd x=1
+	$(pwd) test | grep 2>/dev/null "$1" done export local 'quoted text' "$1" "$1" echo
+	awk ${HOME} done $(pwd) x=1 readonly then "$1"
+		readonly ${HOME} 2>/dev/null | cd export done then
+then awk done && $(pwd) "$@" ${HOME} then done echo then 2>/dev/null
+local then export sed local
+sed 2>/dev/null $(pwd) x=1 test grep 2>/dev/null
+awk 2>/dev/null && "$1" done "$1" -eu "$@" "$1"
+		export | 'quoted text' && sed grep "$1" 'quoted text'
+		| "$@" export then cd x=1 readonly grep x=1 $(pwd) /usr/bin cd export
+		| export x=1 'quoted text'
+x=1 -eu test cd done ${HOME} printf cd printf
+		"$1" local "$@" grep 2>/dev/null awk echo ${HOME} grep readonly -eu done $(pwd)
+		&& x=1 sed export 'quoted text' 'quoted text' cd 2>/dev/null x=1 printf -eu
+-eu 2>/dev/null done readonly -eu "$@" ${HOME} 2>/dev/null
+printf sed -eu "$1" grep x=1 x=1 cd then | cd 'quoted text' -eu awk
+grep test 2>/dev/null test 2>/dev/null "$1" then cd
+		cd sed grep "$1" test
+	'quoted text' sed --verbose export 2>/dev/null 2>/dev/null echo ${HOME} sed
+echo awk readonly 'quoted text' "$1" cd printf "$@" grep export | echo
+then echo /usr/bin then export
+		${HOME} local 2>/dev/null local /usr/bin
+"$1" printf sed test local x=1 -eu /usr/bin printf
+| ${HOME} echo echo | -eu awk $(pwd) 2>/dev/null ${HOME} 'quoted text'
+	printf awk "$1" cd 'quoted text'
+		$(pwd) "$1" "$@" readonly "$@" readonly
+		2>/dev/null local $(pwd) "$1"
+		then --verbose echo x=1 'quoted text' echo --verbose sed 'quoted text'
+--verbose printf sed 'quoted text' grep 2>/dev/null awk &&
+printf grep /usr/bin grep /usr/bin then
+		2>/dev/null /usr/bin ${HOME} $(pwd) 2>/dev/null 'quoted text' $(pwd)
+echo 2>/dev/null echo | "$@" x=1 'quoted text'
+		sed echo ${HOME} echo --verbose cd 2>/dev/null then cd -eu then
+cd /usr/bin x=1 'quoted text'
+	printf awk 'quoted text' echo cd -eu 'quoted text'
+		local done x=1 cd "$1" --verbose
+		&& "$@" grep | local done $(pwd)
+		done ${HOME} /usr/bin then ${HOME} /usr/bin awk awk | /usr/bin
+	then 2>/dev/null printf 'quoted text' test echo && awk
+	--verbose sed echo echo 'quoted text'
+	printf echo && done printf printf printf
+	test | then && grep cd 2>/dev/null readonly | ${HOME} $(pwd)
+	cd printf 'quoted text' 2>/dev/null sed --verbose test local cd
+done export $(pwd) "$1" x=1 done
+/usr/bin "$1" test printf /usr/bin
+		export /usr/bin done && printf && awk sed ${HOME} sed test
+		x=1 awk /usr/bin ${HOME} readonly /usr/bin --verbose $(pwd) "$@"
+local test | | && awk && sed
+	${HOME} 2>/dev/null export --verbose --verbose readonly test printf "$1" printf
+	done "$1" 'quoted text' done x=1 local -eu 'quoted text' "$1" local 2>/dev/null
+	local awk && 'quoted text' -eu | test 'quoted text' awk && "$@" done
+	${HOME} ${HOME} cd /usr/bin readonly /usr/bin cd then echo
+		/usr/bin | awk ${HOME} test echo readonly
+		done echo /usr/bin --verbose
+	cd local && /usr/bin awk ${HOME} local readonly awk
+	grep printf | awk | 'quoted text' then | printf && ${HOME} /usr/bin "$@"
+	/usr/bin && done $(pwd) x=1 $(pwd) | local
+$(pwd) /usr/bin 2>/dev/null cd 'quoted text' export "$@" awk 'quoted text'
+		2>/dev/null "$@" && "$1" then "$1" && export readonly then 'quoted text'
+		grep then -eu --verbose grep 'quoted text' printf echo cd "$1" awk
+	cd cd $(pwd) echo readonly sed 'quoted text'
+grep test | sed sed "$1" && printf printf 2>/dev/null echo $(pwd) 2>/dev/null
+sed "$1" local grep then grep x=1 cd cd /usr/bin "$@" && 2>/dev/null |
+		${HOME} | 'quoted text' readonly done
+	export awk /usr/bin 'quoted text' -eu 'quoted text' grep readonly | export
+"$1" grep /usr/bin 2>/dev/null readonly ${HOME} "$@" -eu -eu -eu && |
+local && echo readonly cd done
+		awk test done $(pwd) awk echo x=1 readonly
+printf --verbose readonly test awk ${HOME} local sed local 2>/dev/null
+		done $(pwd) $(pwd) export grep "$1"
+done /usr/bin 'quoted text'
+"$@" then local local 2>/dev/null done awk export
+		$(pwd) | export then 2>/dev/null sed "$1"
+		done local grep 'quoted text'
+'quoted text' test test export x=1 local printf sed "$@" readonly
+		sed $(pwd) done 'quoted text'
+		x=1 local test grep awk test "$1"
+	export 2>/dev/null done
+local && sed "$1" test "$@" /usr/bin $(pwd) awk && export $(pwd) grep
+	&& echo test /usr/bin && $(pwd) printf
+	awk done test sed then done cd 'quoted text'
+-eu printf sed --verbose
+	--verbose echo done test "$1" "$1"
+--verbose /usr/bin --verbose 'quoted text'
+	readonly grep -eu "$@" grep test awk x=1 "$1"
+"$@" | test /usr/bin -eu local /usr/bin echo awk
+-eu | x=1 /usr/bin 'quoted text' "$1" sed then
+local readonly "$@" done | cd grep | printf -eu echo
+	grep grep && test printf x=1
+-eu test readonly grep cd /usr/bin
+		grep then then /usr/bin x=1 ${HOME} awk printf "$1" && local printf x=1
+		x=1 ${HOME} done && export echo local 2>/dev/null $(pwd) done sed
+		-eu local grep --verbose $(pwd) && test awk ${HOME} grep && then
+printf --verbose /usr/bin 2>/dev/null
+	--verbose /usr/bin | grep $(pwd) ${HOME} local --verbose
+	'quoted text' export sed done "$1" && then && done && |
+	echo test then printf 2>/dev/null echo 2>/dev/null
+		grep sed sed | done /usr/bin --verbose export
+		grep awk then "$@" done done
+local sed echo readonly 'quoted text' x=1 cd readonly -eu test ${HOME} x=1 --verbose
+local ${HOME} "$@" | done /usr/bin readonly printf "$@" 2>/dev/null
+	awk $(pwd) local then -eu && grep export sed /usr/bin ${HOME} ${HOME} &&
+		$(pwd) --verbose "$1" x=1 "$@" && echo $(pwd) 2>/dev/null | sed then
+		printf -eu "$1" local readonly ${HOME} export echo then
+${HOME} done export | 'quoted text' 2>/dev/null
+	| cd --verbose -eu export && | test export && | -eu ${HOME} | "$1" export
+		/usr/bin done "$1" sed x=1 "$@" then $(pwd) export readonly export test test
+2>/dev/null done awk 'quoted text' test 'quoted text' sed
+		local printf $(pwd) cd x=1 $(pwd) "$@" ${HOME} local local
+		--verbose grep sed ${HOME}
+		local echo && cd "$1" then echo
+		$(pwd) grep 2>/dev/null "$@" /usr/bin readonly test test /usr/bin echo | awk
+	export ${HOME} x=1 ${HOME} 'quoted text' && export export --verbose
+--verbose sed /usr/bin x=1 readonly 'quoted text'
+		/usr/bin | /usr/bin sed then
+local local 'quoted text' | 2>/dev/null &&
+		-eu "$1" | -eu && $(pwd) readonly x=1 local
+2>/dev/null local then local 2>/dev/null export
+	"$1" -eu local echo grep then
+		test sed && /usr/bin x=1 then sed | --verbose
+grep export "$@" sed cd /usr/bin
+	| printf cd --verbose grep "$@" test $(pwd) --verbose
+awk grep done printf | --verbose
+echo export 2>/dev/null /usr/bin /usr/bin && $(pwd) echo && 'quoted text'
+export then "$1" x=1
+	printf x=1 "$@" grep export then then awk printf x=1 echo /usr/bin printf && 'quoted text'
+	$(pwd) test readonly printf awk ${HOME} 2>/dev/null --verbose done export
+test "$1" cd readonly local
+--verbose "$1" $(pwd) test 2>/dev/null /usr/bin grep x=1 printf x=1 test grep "$1"
+	readonly --verbose -eu x=1 done /usr/bin && done
+| x=1 --verbose "$1" "$@" local x=1 'quoted text' 2>/dev/null
+"$@" x=1 grep "$@" awk $(pwd) test awk then export readonly
+		awk awk -eu x=1 awk echo -eu cd && echo $(pwd) sed local
+	export "$@" 2>/dev/null
+		-eu echo readonly "$1" readonly test test --verbose
+	readonly | /usr/bin test readonly sed 2>/dev/null sed "$1" x=1
+	awk "$@" --verbose 2>/dev/null printf 'quoted text' $(pwd)
+		x=1 $(pwd) 2>/dev/null export done readonly 2>/dev/null then
+${HOME} "$1" awk readonly test
+	awk 'quoted text' grep | 'quoted text' cd local x=1
+awk grep "$1" "$@" then then "$@" then | | grep readonly sed done x=1
+	awk ${HOME} && readonly echo export done ${HOME} printf
+	then $(pwd) local awk /usr/bin awk
+	"$1" readonly printf x=1 && --verbose test && echo "$1"
+/usr/bin awk test local printf --verbose
+$(pwd) awk -eu 2>/dev/null --verbose cd $(pwd)
+		'quoted text' x=1 --verbose
+x=1 export 'quoted text'
+	done $(pwd) 2>/dev/null export awk 'quoted text' -eu /usr/bin
+	"$@" 'quoted text' done cd -eu export local 'quoted text' test sed
+${HOME} grep 2>/dev/null printf --verbose local x=1 done 'quoted text'
+	--verbose done cd sed sed 'quoted text' ${HOME} x=1 test
+		$(pwd) then && local "$@" echo
+		x=1 && test then --verbose && --verbose ${HOME}
+	echo then -eu "$1" $(pwd) sed x=1 sed x=1 grep done done
+readonly awk cd readonly export then --verbose x=1
+${HOME} 'quoted text' 2>/dev/null
+'quoted text' x=1 ${HOME} $(pwd) -eu awk done | --verbose $(pwd) export
+		grep -eu then | ${HOME} printf
+		'quoted text' "$@" && then && test export awk
+"$1" $(pwd) 'quoted text'
+		awk test /usr/bin printf /usr/bin readonly printf "$@" export "$@" done grep "$@"
+		'quoted text' readonly local
+		$(pwd) | export | echo && grep sed "$1" export "$1" export
+		$(pwd) 2>/dev/null printf |
+	x=1 export "$1" done printf done && grep cd awk -eu test x=1
+awk done printf awk readonly ${HOME} ${HOME}
+&& -eu test printf x=1 "$1" awk local echo -eu "$1" sed grep sed
+echo x=1 "$1" 'quoted text' printf && x=1 local then readonly
+	2>/dev/null echo -eu 'quoted text'
+	cd awk "$@" test echo echo printf "$@"
+	test done test then x=1 | $(pwd) --verbose grep cd test
+grep ${HOME} export test ${HOME} --verbose 2>/dev/null cd "$@" awk ${HOME} readonly
+		"$@" test "$1" -eu "$1" awk --verbose --verbose
+	$(pwd) 'quoted text' /usr/bin
+	/usr/bin then local test && readonly $(pwd) then | &&
+	"$1" done "$@" export | test 2>/dev/null
+	test "$@" && local | --verbose test then readonly ${HOME}
+then -eu $(pwd) local | done test export
+export awk test 2>/dev/null awk && 2>/dev/null -eu
+		sed /usr/bin printf 'quoted text'
+	local readonly /usr/bin echo local cd grep grep sed 'quoted text'
+	-eu 2>/dev/null "$@" grep "$@" -eu cd grep printf --verbose echo export
+		test /usr/bin printf done export export then awk test grep 2>/dev/null done && &&
+		-eu "$1" 2>/dev/null 'quoted text' grep then /usr/bin
+		then ${HOME} x=1 printf grep grep "$1" ${HOME} cd && 2>/dev/null
+	/usr/bin ${HOME} | -eu export 'quoted text' sed "$@" -eu x=1 local "$1" done
+	cd --verbose /usr/bin && -eu $(pwd) && cd awk printf && test
+local /usr/bin && grep x=1 then export -eu -eu cd readonly "$1" then
+		x=1 printf $(pwd) sed && export cd grep echo echo cd export /usr/bin
+	printf export echo && -eu readonly -eu x=1 /usr/bin -eu --verbose
+&& echo cd 'quoted text' readonly readonly grep "$1" then
+	$(pwd) cd $(pwd) echo echo
+test printf "$@" | /usr/bin && sed
+	x=1 cd cd ${HOME} ${HOME} 2>/dev/null
+'quoted text' echo printf "$@"
+echo local awk export | $(pwd) grep readonly -eu x=1 "$1" 2>/dev/null echo
+		2>/dev/null local readonly grep ${HOME} | echo 'quoted text' sed 'quoted text'
+&& test sed $(pwd) readonly ${HOME}
+readonly /usr/bin cd x=1 done -eu local ${HOME} -eu | && && grep test grep
+	printf -eu grep printf --verbose awk | awk cd "$1" 'quoted text'
+		| -eu awk 'quoted text' /usr/bin awk "$1" -eu | | test
+		-eu "$1" 2>/dev/null done $(pwd) -eu readonly 'quoted text' | ${HOME}
+		cd done $(pwd) 'quoted text' done && $(pwd) --verbose test | 'quoted text'
+"$@" "$1" "$1" 'quoted text' then echo | awk $(pwd) cd
+		'quoted text' sed /usr/bin &&
+	then sed readonly $(pwd) && x=1 cd local then "$1" test $(pwd) 2>/dev/null
+		| ${HOME} --verbose ${HOME} --verbose then
+| readonly && local done && local 'quoted text'
+		x=1 && export printf 2>/dev/null
+test /usr/bin then grep export 2>/dev/null
+		$(pwd) grep echo --verbose
+	&& echo echo 2>/dev/null done readonly | echo "$1" readonly 'quoted text' readonly
+		&& /usr/bin | awk done -eu 2>/dev/null /usr/bin
+grep awk --verbose /usr/bin
+		awk $(pwd) echo ${HOME} awk 2>/dev/null echo
+		cd local awk awk $(pwd) 2>/dev/null | echo readonly printf test readonly | local
+		awk readonly cd local grep then
+	/usr/bin "$1" local $(pwd) x=1 'quoted text'
+		grep /usr/bin $(pwd) cd
+'quoted text' grep echo done --verbose 2>/dev/null /usr/bin x=1 'quoted text'
+	cd --verbose "$@" $(pwd) --verbose -eu x=1 "$1" "$@" readonly export x=1
+		x=1 -eu awk "$1" && --verbose readonly echo awk $(pwd) then $(pwd)
+grep 'quoted text' -eu then export --verbose "$@"
+		&& local | readonly echo local readonly test
+	done cd $(pwd) sed -eu sed echo
+sed export done $(pwd) "$1" $(pwd) /usr/bin cd 2>/dev/null
+	${HOME} 'quoted text' -eu "$1" $(pwd) 2>/dev/null
+	test | then echo /usr/bin
+echo && done "$1" awk $(pwd) awk --verbose |
+grep local --verbose cd /usr/bin then awk done $(pwd)
+echo awk grep done "$1"
+		x=1 ${HOME} then then echo grep
+		'quoted text' cd sed printf local
+&& ${HOME} awk done awk -eu cd done awk cd 'quoted text'
+		done 2>/dev/null cd "$@" "$@" readonly "$1" -eu printf
+	2>/dev/null /usr/bin export then export -eu awk /usr/bin -eu readonly "$1" -eu
+		local /usr/bin && | then then
+cd /usr/bin "$1" /usr/bin -eu 2>/dev/null
+	2>/dev/null $(pwd) "$1" "$@"
+	cd | sed readonly echo -eu --verbose 'quoted text' --verbose
+test then "$1" local && echo
+		"$1" ${HOME} "$1" "$1" test done && sed local then readonly &&
+		$(pwd) echo sed done -eu done grep
+2>/dev/null "$1" x=1 readonly "$@" export
+	-eu export export 2>/dev/null then 'quoted text' export
+		2>/dev/null -eu test --verbose && echo x=1 x=1 2>/dev/null
+		export $(pwd) local | grep
+	readonly x=1 ${HOME} then -eu local cd ${HOME} /usr/bin | sed awk x=1 cd -eu
+	readonly done --verbose sed local printf $(pwd) --verbose "$1" x=1 cd grep 2>/dev/null
+	| 2>/dev/null 'quoted text' | test && local echo local test
+"$1" --verbose cd then sed awk done 2>/dev/null readonly export grep
+		printf readonly cd | 'quoted text' 'quoted text' /usr/bin export 'quoted text'
+		test grep readonly | /usr/bin
+		done /usr/bin echo --verbose grep readonly "$1" cd done "$1" ${HOME} $(pwd)
+		test "$1" grep $(pwd) /usr/bin local 'quoted text'
+| sed sed local | then printf ${HOME} 'quoted text'
+		/usr/bin 'quoted text' --verbose echo grep /usr/bin ${HOME} cd grep
+		done | "$@" $(pwd) export $(pwd) x=1
+		${HOME} printf local cd awk test "$1" local awk 'quoted text'
+	2>/dev/null x=1 /usr/bin local
+	-eu sed export done 2>/dev/null local --verbose
+'quoted text' -eu then && awk grep printf 2>/dev/null $(pwd) "$@"
+readonly && x=1 awk echo then then ${HOME} $(pwd) && /usr/bin -eu grep awk "$@"
+	"$@" done 'quoted text' readonly then -eu test && export
+	awk -eu grep echo /usr/bin readonly sed done awk then export | test local
+	export 'quoted text' sed awk "$@" done echo 2>/dev/null
+cd local grep 2>/dev/null 2>/dev/null x=1 cd 'quoted text' done then
+x=1 export local 2>/dev/null export echo -eu
+	echo ${HOME} grep grep
+export local grep "$@" x=1 cd 'quoted text' | x=1 echo
+	cd --verbose then cd --verbose then readonly done echo "$1" echo echo
+		awk then test -eu printf 2>/dev/null sed export export --verbose 'quoted text'
+	${HOME} && cd | printf echo 2>/dev/null "$@" grep then readonly
+export test done test --verbose echo test ${HOME} awk
+	grep "$@" && /usr/bin ${HOME} "$@" 2>/dev/null awk --verbose cd x=1 export $(pwd)
+cd cd 'quoted text' ${HOME} && export "$@" 2>/dev/null
+	x=1 export "$1" printf -eu awk local done ${HOME}
+echo $(pwd) $(pwd) sed export 2>/dev/null
+		cd && "$1" "$1" test |
+	&& x=1 | | test test echo sed echo
+	printf then echo "$1" test done x=1 --verbose test test
+	'quoted text' | /usr/bin | -eu $(pwd) ${HOME}
+	grep readonly && 'quoted text' done
+		'quoted text' echo 2>/dev/null $(pwd) "$@" $(pwd)
+	x=1 ${HOME} "$1" export export "$@" echo --verbose
+		then sed local x=1 "$@" awk printf echo awk x=1 done
+done | test $(pwd) test printf && sed grep 'quoted text'
+	&& && readonly | "$1" --verbose 2>/dev/null
+		local -eu && echo local awk
+	sed x=1 awk cd ${HOME} local readonly && local 'quoted text'
+	| 2>/dev/null local && ${HOME} local test /usr/bin
+done local done then 2>/dev/null && "$1" && printf && cd test sed
+		"$@" readonly cd x=1 2>/dev/null awk then $(pwd)
+printf "$@" local "$@" grep grep export printf $(pwd) local echo
+		grep /usr/bin local done "$@" readonly
+local | printf -eu "$@"
+		printf cd | "$@" /usr/bin -eu "$@" &&
+		readonly --verbose done
+		export $(pwd) -eu $(pwd) test x=1 echo | done
+sed sed "$@" echo -eu local /usr/bin done grep echo $(pwd) && "$1" 'quoted text'
+	x=1 test -eu test && x=1 test --verbose --verbose
+"$1" $(pwd) echo sed export grep grep printf "$1" local && 2>/dev/null
+"$@" test sed printf test awk 'quoted text' 'quoted text' awk
+		-eu $(pwd) $(pwd) $(pwd) | x=1 export -eu test printf "$1" "$@"
+	awk -eu awk ${HOME} then then then "$@" export
+	x=1 --verbose 'quoted text' then $(pwd) export test && test awk &&
+		grep /usr/bin grep -eu -eu grep awk |
+local grep -eu ${HOME} | sed grep && ${HOME}
+		x=1 /usr/bin -eu cd export echo --verbose "$@"
+		done "$@" "$1" 2>/dev/null "$1" test "$@" 'quoted text'
+$(pwd) export cd echo test "$@" && | ${HOME} grep printf
+&& | cd readonly $(pwd) readonly
+		"$1" "$1" sed sed awk | 2>/dev/null 2>/dev/null awk -eu ${HOME}
+"$@" readonly "$1" $(pwd) echo && /usr/bin
+&& done x=1 then export grep ${HOME}
+${HOME} export 2>/dev/null
+	sed "$1" echo | readonly then
+| export $(pwd) grep echo 2>/dev/null echo echo | grep --verbose
+	awk 'quoted text' cd
+	cd -eu cd /usr/bin -eu cd ${HOME} 2>/dev/null $(pwd)
+done then grep -eu 2>/dev/null export test "$@" $(pwd) "$1"
+	grep | --verbose 2>/dev/null && && /usr/bin &&
+	done "$@" printf $(pwd) --verbose | sed -eu ${HOME} echo | --verbose "$1" /usr/bin
+		x=1 test export "$1" x=1 export
+	then x=1 $(pwd) printf ${HOME}
+		'quoted text' x=1 grep $(pwd) grep
+		${HOME} printf /usr/bin done "$1" echo
+		/usr/bin grep -eu 2>/dev/null done sed grep "$@" readonly sed | 'quoted text' $(pwd)
+awk grep test printf ${HOME} sed awk then "$@" echo export ${HOME} then &&
+	done then echo -eu echo /usr/bin then sed sed
+		local | test grep grep --verbose
+x=1 cd then echo done export
+	test local then echo "$1" $(pwd) printf &&
+		done test 'quoted text' | sed printf sed done
+/usr/bin "$1" export readonly export echo readonly awk --verbose
+		"$1" "$1" && 'quoted text' export readonly $(pwd) 'quoted text' done cd 'quoted text'
+		--verbose local "$@" ${HOME}
+		"$1" then export 2>/dev/null -eu -eu readonly
+	| ${HOME} $(pwd) then done readonly 'quoted text' echo
+	"$@" ${HOME} done echo readonly
+	&& sed echo 2>/dev/null cd
+awk -eu export /usr/bin x=1 echo awk test export && /usr/bin local sed "$@" ${HOME}
+test export x=1 grep cd test --verbose
+		${HOME} printf "$1" readonly
+	local $(pwd) printf 2>/dev/null
+	-eu cd done /usr/bin local cd "$1" $(pwd) /usr/bin
+		cd -eu awk printf && /usr/bin grep then test -eu export awk local sed
+local ${HOME} 'quoted text' -eu export local && "$1" awk -eu | /usr/bin
+&& --verbose "$1" /usr/bin cd cd readonly grep done
+export grep echo done "$@" printf awk "$1" test "$1" x=1 printf
+		-eu /usr/bin "$1" then x=1 2>/dev/null 'quoted text'
+local local 2>/dev/null done printf && sed "$@" 'quoted text' done "$1" local
+		test 2>/dev/null done export export "$@" 'quoted text' readonly $(pwd) -eu
+2>/dev/null awk echo 2>/dev/null
+	--verbose 2>/dev/null local x=1 awk | done sed readonly x=1 grep
+		echo local local export
+		2>/dev/null /usr/bin export cd && /usr/bin
+		echo && echo /usr/bin ${HOME} x=1 printf done cd sed test
+	then echo ${HOME} printf awk $(pwd)
+		-eu "$1" export -eu then /usr/bin /usr/bin | x=1
+	echo awk /usr/bin sed 'quoted text' "$@" grep
+		'quoted text' then -eu | 2>/dev/null awk
+	readonly "$1" echo $(pwd) done 'quoted text' grep 2>/dev/null x=1 echo
+then -eu printf /usr/bin export 2>/dev/null "$1" printf x=1 'quoted text'
+local printf $(pwd) --verbose "$@" $(pwd) done echo x=1 test test
+		x=1 | readonly export /usr/bin $(pwd) done && x=1 'quoted text'
+/usr/bin && grep printf echo printf --verbose grep export readonly | done && "$1"
+	sed x=1 awk echo 'quoted text' sed cd "$1" "$@" readonly readonly
+		printf then echo awk 2>/dev/null
+		cd cd "$@" local test 2>/dev/null ${HOME}
+	test awk 'quoted text' -eu "$@" && x=1 cd | readonly export test ${HOME} /usr/bin
+	${HOME} --verbose -eu done cd ${HOME} "$@" export /usr/bin export ${HOME}
+	then x=1 'quoted text'
+		local -eu awk printf grep x=1 /usr/bin | 'quoted text' "$1" echo x=1 grep --verbose
+		x=1 'quoted text' local && test sed sed local done $(pwd)
+"$@" "$@" grep $(pwd)
+	awk "$@" | --verbose $(pwd) grep test | echo local echo --verbose
+	cd cd sed "$@" cd then printf
+		-eu cd /usr/bin local && export done "$1" export | "$1" && echo
+		'quoted text' awk done sed 2>/dev/null printf test "$1" --verbose 2>/dev/null
+	local grep echo done awk sed ${HOME} /usr/bin grep awk ${HOME} awk x=1 test
+		&& && test "$1" x=1 'quoted text' cd $(pwd) 'quoted text' test
+	test then $(pwd) | echo --verbose -eu x=1 printf /usr/bin && --verbose
+	test done && --verbose export
+		$(pwd) then | $(pwd) done local cd && | local cd sed x=1 cd $(pwd)
+	sed "$@" -eu done 'quoted text'
+local ${HOME} grep cd echo sed
+x=1 "$@" cd cd "$@" export test done --verbose awk printf awk export
+	test readonly echo done
+		done readonly $(pwd) test readonly -eu awk export
+		&& sed cd sed sed done export test
+"$1" ${HOME} then 'quoted text' cd ${HOME} -eu | printf
+	"$@" /usr/bin grep /usr/bin test readonly
+		then cd && grep export $(pwd) local "$@" && local echo export ${HOME} 2>/dev/null
+	2>/dev/null readonly "$@" sed done /usr/bin $(pwd) printf readonly awk "$1"
+		x=1 readonly done "$@" && sed export x=1 done test
+	export "$@" ${HOME} grep 2>/dev/null test "$@" "$@"
+export 'quoted text' readonly $(pwd)
+"$@" "$@" "$1" "$@" echo --verbose readonly export echo export
+	done "$@" grep && export
+	printf test grep sed
+	--verbose 'quoted text' x=1 ${HOME} "$1" cd cd | export 2>/dev/null cd done
+	'quoted text' "$1" then
+test readonly test awk x=1 "$@" readonly local
+grep && grep awk --verbose | 'quoted text'
+	${HOME} ${HOME} awk sed ${HOME} ${HOME} export done
+export "$@" then readonly grep readonly 'quoted text' $(pwd)
+	&& export test x=1 sed sed /usr/bin /usr/bin $(pwd) && sed awk ${HOME}
+		&& 2>/dev/null then readonly printf awk export
+then local 2>/dev/null printf cd -eu local export readonly | --verbose
+		test printf awk export | local echo done awk export "$1" export | | test 2>/dev/null
+	--verbose "$1" grep -eu "$1" x=1 "$1" test --verbose
+	local -eu -eu "$@" --verbose printf x=1 then x=1 local 'quoted text' local 2>/dev/null
+	${HOME} ${HOME} | ${HOME} -eu "$@" $(pwd) /usr/bin awk $(pwd)
+		2>/dev/null ${HOME} then awk local then
+cd ${HOME} "$@" test | ${HOME}
+		awk 'quoted text' /usr/bin 'quoted text' -eu ${HOME} test grep test cd
+		then awk "$@" test 2>/dev/null printf | then done echo grep --verbose
+${HOME} $(pwd) --verbose sed sed 'quoted text' done -eu done cd --verbose
+export --verbose awk --verbose -eu --verbose done
+test /usr/bin readonly 'quoted text' grep 2>/dev/null | && done 'quoted text'
+	readonly --verbose /usr/bin cd /usr/bin --verbose --verbose x=1 -eu echo
+	then local local $(pwd)
+	then test test | export printf
+		2>/dev/null "$@" awk test -eu /usr/bin
+export /usr/bin | ${HOME} local /usr/bin "$@" then /usr/bin
+		/usr/bin "$@" && test 2>/dev/null "$1" sed 2>/dev/null --verbose then
+		sed readonly && /usr/bin
+"$1" done 2>/dev/null echo sed /usr/bin grep
+		"$1" -eu test awk awk | | export cd local printf 'quoted text'
+	"$1" $(pwd) x=1 | done 2>/dev/null test /usr/bin
+/usr/bin grep test 2>/dev/null
+		/usr/bin sed echo $(pwd) "$@" printf
+then printf test -eu printf 'quoted text'
+		x=1 $(pwd) awk readonly grep readonly
+	'quoted text' "$1" grep 'quoted text' local && awk --verbose --verbose
+	'quoted text' 'quoted text'
+		--verbose then local test cd readonly
+2>/dev/null "$@" readonly
+x=1 readonly done done test | done "$@" 2>/dev/null
+cd grep local 2>/dev/null $(pwd) --verbose then
+2>/dev/null test cd grep 'quoted text' --verbose
+2>/dev/null -eu $(pwd) grep && test /usr/bin 2>/dev/null --verbose "$@"
+		-eu "$1" | readonly "$@"
+sed cd readonly sed && then cd test readonly test
+&& ${HOME} cd cd done then 'quoted text' cd $(pwd) test local readonly
+		--verbose --verbose test local sed x=1 $(pwd) test "$@" awk cd | /usr/bin 2>/dev/null
+printf done 2>/dev/null "$@" ${HOME} done test "$1" "$1" /usr/bin local then printf
+		then 'quoted text' $(pwd)
+test then done $(pwd) local export readonly ${HOME}
+export --verbose then grep done ${HOME}
+		then sed && test grep "$@" echo -eu printf
+		local cd cd --verbose $(pwd) test sed done sed test "$1"
+	$(pwd) readonly then ${HOME} && sed awk ${HOME} export $(pwd) "$1" awk "$@" &&
+cd done 'quoted text' then -eu export 2>/dev/null
+	local x=1 --verbose "$1" cd then readonly done export
+	echo "$@" cd ${HOME} cd sed grep 2>/dev/null then x=1
+		cd && done --verbose 'quoted text' "$@" && grep printf --verbose --verbose "$1"
+test cd && --verbose ${HOME} export
+		2>/dev/null && -eu | test 'quoted text' "$@"
+		printf x=1 "$1" "$@" cd
+	x=1 | readonly printf "$@" x=1 "$@" "$1" x=1 /usr/bin /usr/bin
+		&& done done grep -eu && cd awk awk --verbose local sed cd /usr/bin
+	| /usr/bin awk local sed 2>/dev/null echo readonly export test -eu sed
+test test $(pwd) 2>/dev/null ${HOME} then "$@" grep
+		-eu local sed echo echo x=1 "$@" then readonly sed local --verbose && -eu
+readonly awk x=1 echo /usr/bin test "$@" -eu 'quoted text' local -eu
+	export 'quoted text' $(pwd) x=1
+		printf ${HOME} "$@" local readonly | sed cd local
+then --verbose x=1 | sed --verbose $(pwd) "$@" cd "$1"
+awk /usr/bin test done "$1" "$1" echo cd x=1 'quoted text'
+	done | cd 'quoted text' "$1" ${HOME} "$1"
+cd && | cd -eu grep -eu done then x=1 "$1"
+test ${HOME} /usr/bin test printf --verbose export
+		sed sed grep then cd "$1" ${HOME}
+	sed echo test 2>/dev/null && echo awk
+	"$1" awk grep 'quoted text' sed printf ${HOME} "$@" printf "$@"
+	$(pwd) 'quoted text' cd then -eu "$@" && sed printf grep printf
+&& 'quoted text' 'quoted text'
+		&& test export "$@" sed export "$@" "$1" awk grep 2>/dev/null --verbose cd "$@"
+/usr/bin done -eu echo printf $(pwd) 2>/dev/null x=1
+	"$@" then done "$1" "$1" | -eu done cd 'quoted text'
+		readonly --verbose grep && | sed 'quoted text' 2>/dev/null --verbose
+test cd $(pwd) cd | "$@" test grep sed local export
+	'quoted text' ${HOME} test printf done x=1 grep
+	echo test awk export 'quoted text' done cd | export ${HOME}
+		grep echo awk local x=1 && 'quoted text' &&
+		/usr/bin local grep 2>/dev/null && "$1" "$@" x=1 sed readonly export
+	local sed -eu awk 'quoted text' | sed sed 'quoted text' x=1 printf --verbose
+		sed "$@" 2>/dev/null
+	"$@" test local "$1" local
+	readonly 'quoted text' local 2>/dev/null awk test "$@" 'quoted text' sed
+	2>/dev/null --verbose "$@" test printf | --verbose export && -eu
+	test grep printf --verbose && 2>/dev/null 2>/dev/null grep local
+local "$1" test "$@" local "$@" "$1" grep "$@"
+	x=1 -eu then readonly export
+grep 2>/dev/null 2>/dev/null
+echo then /usr/bin then done readonly
+		| $(pwd) -eu sed | ${HOME}
+		printf && awk 2>/dev/null then 'quoted text' --verbose sed 2>/dev/null
+		"$@" ${HOME} sed sed | local | ${HOME} grep
+		'quoted text' "$1" readonly grep "$1"
+	printf local --verbose grep grep ${HOME}
+	printf $(pwd) ${HOME} | ${HOME} -eu 'quoted text'
+${HOME} local grep ${HOME} "$1" "$@" test local "$1" 2>/dev/null then
+	"$@" $(pwd) readonly done done echo ${HOME} test 2>/dev/null "$1"
+readonly -eu awk "$@" export 'quoted text'
+then $(pwd) cd echo done "$@" grep
+		cd --verbose printf "$@" echo
+readonly $(pwd) echo && done
+/usr/bin cd && awk 'quoted text' "$1" grep readonly done ${HOME} -eu x=1
+	&& printf --verbose | "$1" echo test sed
+	printf 2>/dev/null --verbose "$@" "$@" grep --verbose
+		done "$1" readonly export | printf
+		readonly --verbose done x=1 $(pwd) cd 'quoted text' then /usr/bin && --verbose
+	-eu cd cd echo export "$@" "$@"
+	"$1" sed export | $(pwd) && 2>/dev/null -eu cd local echo grep 'quoted text'
+		local "$@" then local x=1 $(pwd)
+awk -eu export /usr/bin | grep
+		awk "$1" cd export test --verbose
+		echo ${HOME} ${HOME} done && "$1" done --verbose
+test printf -eu echo sed readonly "$1" -eu
+	then cd $(pwd) -eu "$@" --verbose test awk done -eu awk printf "$1" readonly
+printf echo done /usr/bin | readonly 2>/dev/null printf 'quoted text' -eu
+	-eu x=1 | grep | "$@" readonly 2>/dev/null /usr/bin awk cd ${HOME}
+		echo 'quoted text' -eu && /usr/bin sed sed readonly "$@"
+		test local ${HOME} then sed && "$1" done --verbose
+"$@" grep -eu x=1 x=1 readonly "$1" readonly 2>/dev/null test $(pwd)
+	printf "$1" $(pwd) readonly
+	-eu export -eu --verbose local /usr/bin local -eu local 'quoted text'
+$(pwd) sed -eu 2>/dev/null x=1 | awk -eu readonly "$@" 'quoted text'
+	readonly | /usr/bin /usr/bin x=1 "$@" export done local /usr/bin /usr/bin
+test 2>/dev/null --verbose ${HOME} echo 'quoted text' $(pwd) 'quoted text'
+	echo local grep x=1 -eu grep $(pwd)
+	2>/dev/null done printf "$@" 'quoted text' readonly
+	&& sed printf then 'quoted text' && export ${HOME} readonly "$1" local readonly
+"$1" cd echo done test grep x=1 sed "$@" readonly sed --verbose
+		'quoted text' /usr/bin cd
+	'quoted text' -eu && 2>/dev/null awk /usr/bin local ${HOME} --verbose
+grep then && --verbose x=1 "$@" "$1" test printf grep ${HOME} 'quoted text'
+	'quoted text' grep export export local 2>/dev/null
+	&& 'quoted text' --verbose test
+	printf then export /usr/bin "$@" && then "$@" export
+$(pwd) printf ${HOME} ${HOME} printf "$1" test grep ${HOME} cd awk
+		x=1 $(pwd) -eu sed --verbose | awk echo --verbose
+	"$1" test "$@" | sed && sed printf local local x=1 $(pwd) then
+&& readonly printf echo local 2>/dev/null
+		echo printf grep ${HOME} awk
+&& "$1" "$@" --verbose "$1" ${HOME} sed && readonly x=1
+	printf 'quoted text' awk export awk 2>/dev/null "$@" /usr/bin $(pwd)
+	awk 'quoted text' local -eu export
+-eu x=1 grep && local awk sed sed test && export
+	/usr/bin cd then readonly | readonly 2>/dev/null done then ${HOME} | 'quoted text'
+	${HOME} -eu test echo echo 'quoted text' sed cd "$@" then
+	sed readonly ${HOME} "$@" grep grep && --verbose
+	2>/dev/null $(pwd) /usr/bin 'quoted text' echo
+	--verbose 'quoted text' x=1 "$@" | done "$@" then printf
+${HOME} 'quoted text' sed /usr/bin $(pwd) 'quoted text' "$1" ${HOME} printf
+sed | 'quoted text' --verbose readonly grep
+	cd test then ${HOME} echo -eu then /usr/bin
+--verbose grep awk "$1" "$@" readonly grep /usr/bin
+		grep cd "$1" printf "$@" ${HOME} then sed --verbose
+"$@" printf test --verbose 'quoted text'
+		${HOME} done echo && "$1" 'quoted text'
+/usr/bin "$@" awk local then echo 2>/dev/null
+done x=1 printf test | sed printf awk "$@" printf echo /usr/bin 'quoted text'
+		'quoted text' && test cd 'quoted text'
+		x=1 "$@" readonly export
+-eu printf local echo /usr/bin | $(pwd) then
+	"$1" echo --verbose export echo /usr/bin "$@" | && readonly
+	echo | x=1 2>/dev/null
+awk cd "$@" "$@" --verbose /usr/bin local sed cd export --verbose
+	&& 'quoted text' -eu && readonly done ${HOME} $(pwd)
+-eu | then then local x=1 grep local readonly x=1 $(pwd) "$@" test
+printf ${HOME} | ${HOME} 'quoted text' x=1 echo
+	'quoted text' test "$1" printf local printf && printf test
+		then test && export sed export grep /usr/bin
+| 'quoted text' grep export ${HOME} -eu "$1" printf $(pwd)
+		readonly x=1 --verbose x=1 grep readonly echo --verbose
+		2>/dev/null printf export
+local 2>/dev/null 'quoted text' then cd then awk echo local 2>/dev/null
+	x=1 grep echo 2>/dev/null cd cd readonly && $(pwd)
+"$@" 'quoted text' ${HOME} "$1" awk -eu && /usr/bin then awk /usr/bin echo
+printf awk readonly readonly /usr/bin cd | done -eu sed
+--verbose $(pwd) test echo
+		cd 2>/dev/null then then -eu x=1 cd && "$@" then "$1"
+/usr/bin local "$1" && -eu ${HOME} local x=1 local awk local
+		cd cd 'quoted text' test awk -eu
+	$(pwd) ${HOME} then --verbose
+	"$@" 2>/dev/null cd awk /usr/bin /usr/bin "$1" readonly
+		--verbose "$1" export "$@"
+test printf | grep | echo echo --verbose "$1" sed x=1 "$1" && done 'quoted text'
+test "$1" test $(pwd) ${HOME}
+x=1 grep /usr/bin $(pwd)
+		echo $(pwd) x=1 "$1" test 2>/dev/null 'quoted text' awk
+	export done && | then export
+		export ${HOME} awk export 2>/dev/null sed "$@" echo export | && echo --verbose
+		/usr/bin $(pwd) sed 2>/dev/null echo test cd test | grep 'quoted text'
+	then local sed then local && cd /usr/bin done ${HOME}
+&& sed $(pwd) cd "$@" printf
+	$(pwd) && 2>/dev/null -eu --verbose "$@" readonly then then /usr/bin 2>/dev/null
+done /usr/bin grep awk export && -eu && -eu local --verbose && | ${HOME} test
+	${HOME} printf done then -eu 2>/dev/null done echo && grep export x=1 sed
+	awk cd sed grep readonly
+local x=1 readonly done grep printf 'quoted text' cd "$1" local echo
+		| sed | 2>/dev/null 2>/dev/null then printf
+		&& echo /usr/bin local echo -eu printf ${HOME}
+	sed -eu sed "$1" readonly "$@" ${HOME}
+-eu printf | | "$1" ${HOME} cd "$1" echo
+2>/dev/null readonly awk awk 2>/dev/null x=1 printf
+-eu printf -eu 2>/dev/null grep then -eu 2>/dev/null ${HOME} 2>/dev/null
+	'quoted text' ${HOME} x=1 test then awk "$1" test /usr/bin "$1"
+		sed "$1" ${HOME} "$1" sed test echo export 'quoted text'
+2>/dev/null printf sed printf -eu 2>/dev/null echo "$@" printf cd 2>/dev/null
+	cd --verbose echo "$@" sed test done $(pwd) /usr/bin
+		$(pwd) --verbose $(pwd) 'quoted text'